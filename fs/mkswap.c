@@ -0,0 +1,60 @@
+/*
+ * JOS swap disk image
+ * Creates sparse disk image with partition table
+ * containing single JOS swap partition
+ */
+
+#include <errno.h>
+#include <fcntl.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+/* Prevent inc/types.h, included from inc/partition.h,
+ * from attempting to redefine types defined in the host's inttypes.h. */
+#define JOS_INC_TYPES_H
+
+#include <inc/partition.h>
+
+#define SECTSIZE 512
+/* Partition starts at the second sector of the disk */
+#define SWAP_LBA 1
+
+static void
+usage(void) {
+    fprintf(stderr, "Usage: mkswap swap.img NMEGS\n");
+    exit(2);
+}
+
+int
+main(int argc, char **argv) {
+    if (argc != 3) usage();
+
+    char *s;
+    unsigned long nmegs = strtoul(argv[2], &s, 0);
+    /* LBA28 limit */
+    if (*s || s == argv[2] || !nmegs || nmegs >= 128 * 1024) usage();
+
+    uint8_t sect[SECTSIZE] = {0};
+    struct Partitiondesc part = {
+            .type = PTYPE_JOS_SWAP,
+            .lba_start = SWAP_LBA,
+            .lba_length = nmegs * (1024 * 1024 / SECTSIZE) - SWAP_LBA};
+    memcpy(sect + PTABLE_OFFSET, &part, sizeof part);
+    memcpy(sect + PTABLE_MAGIC_OFFSET, PTABLE_MAGIC, 2);
+
+    int fd = open(argv[1], O_RDWR | O_CREAT | O_TRUNC, 0666);
+    if (fd < 0) {
+        fprintf(stderr, "open %s: %s\n", argv[1], strerror(errno));
+        exit(1);
+    }
+    if (write(fd, sect, SECTSIZE) != SECTSIZE ||
+        ftruncate(fd, (off_t)nmegs * 1024 * 1024) < 0) {
+        fprintf(stderr, "write %s: %s\n", argv[1], strerror(errno));
+        exit(1);
+    }
+    close(fd);
+    return 0;
+}
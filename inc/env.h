@@ -39,6 +39,12 @@ enum {
     ENV_NOT_RUNNABLE
 };
 
+/* Weights of environments for the scheduler, CPU time
+ * is divided between runnable ones proportionally to weights */
+#define SCHED_WEIGHT_MIN     1
+#define SCHED_WEIGHT_DEFAULT 1024
+#define SCHED_WEIGHT_MAX     (1024 * 1024)
+
 /* Special environment types */
 enum EnvType {
     ENV_TYPE_IDLE,
@@ -55,17 +61,43 @@ struct AddressSpace {
     pml4e_t *pml4;     /* Virtual address of pml4 */
     uintptr_t cr3;     /* Physical address of pml4 */
     struct Page *root; /* root node of address space tree */
+    uint16_t pcid;     /* Process-context identifier of TLB entries */
+    uint64_t pcid_gen; /* PCID generation pcid belongs to (0 if none) */
+    uintptr_t fault_next;  /* Address continuing sequential fault stream */
+    uint32_t fault_window; /* Number of pages resolved ahead of the stream */
 };
 
 
 struct Env {
     struct Trapframe env_tf; /* Saved registers */
     struct Env *env_link;    /* Next free Env */
+    struct Env *env_rq_left;  /* Children in the run queue tree (if runnable) */
+    struct Env *env_rq_right;
+    int32_t env_rq_height;    /* Height of the subtree rooted here */
+    uint32_t env_cpu;         /* CPU which run queue env is in (or it last ran on) */
     envid_t env_id;          /* Unique environment identifier */
     envid_t env_parent_id;   /* env_id of this env's parent */
     enum EnvType env_type;   /* Indicates special system environments */
     unsigned env_status;     /* Status of the environment */
     uint32_t env_runs;       /* Number of times environment has run */
+    uint32_t env_pgfaults;   /* Number of page faults taken */
+    uint32_t env_syscalls;   /* Number of system calls made */
+
+    /* Fair scheduling */
+    uint32_t env_weight;     /* Share of CPU relative to SCHED_WEIGHT_DEFAULT */
+    uint64_t env_vruntime;   /* Run time scaled by inverse of weight */
+    uint64_t env_runtime;    /* Total run time in TSC cycles */
+    uint64_t env_run_start;  /* TSC value when env was last started */
+
+    /* Real-time scheduling (if env_rt_period is not 0), all in TSC cycles.
+     * Every period env can run for budget cycles, and it
+     * runs ahead of others if its deadline is the earliest */
+    struct Env *env_rt_next;  /* Next real-time environment */
+    uint64_t env_rt_period;   /* Period of releases */
+    uint64_t env_rt_budget;   /* CPU time per period */
+    uint64_t env_rt_deadline; /* Deadline relative to release */
+    uint64_t env_rt_release;  /* Release time of the current period */
+    uint64_t env_rt_used;     /* CPU time used in the current period */
 
     uint8_t *binary; /* Pointer to process ELF image in kernel memory */
 
@@ -82,6 +114,11 @@ struct Env {
     uint32_t env_ipc_value;  /* Data value sent to us */
     envid_t env_ipc_from;    /* envid of the sender */
     int env_ipc_perm;        /* Perm of page mapping received */
+
+    /* Interrupted region system call */
+    uintptr_t env_region_va; /* Destination address of the call */
+    size_t env_region_done;  /* Number of bytes already processed */
+    uint32_t env_region_op;  /* Index of operation of the batch */
 };
 
 #endif /* !JOS_INC_ENV_H */
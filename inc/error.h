@@ -27,6 +27,9 @@ enum {
     E_FILE_EXISTS = 17, /* File already exists */
     E_NOT_EXEC = 18,    /* File not a valid executable */
     E_NOT_SUPP = 19,    /* Operation not supported */
+    /* Kernel internal, system call is restarted instead of returning it */
+    E_RESTART = 20, /* Operation is interrupted */
+    E_OVERLOAD = 21, /* Not enough CPU time to guarantee */
     MAXERROR
 };
 
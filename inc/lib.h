@@ -83,12 +83,15 @@ int sys_region_refs(void *va, size_t size);
 int sys_region_refs2(void *va, size_t size, void *va2, size_t size2);
 static envid_t sys_exofork(void);
 int sys_env_set_status(envid_t env, int status);
+int sys_env_set_weight(envid_t env, uint32_t weight);
+int sys_env_set_rt(envid_t env, uint64_t period, uint64_t budget, uint64_t deadline);
 int sys_env_set_trapframe(envid_t env, struct Trapframe *tf);
 int sys_env_set_pgfault_upcall(envid_t env, void *upcall);
 int sys_alloc_region(envid_t env, void *pg, size_t size, int perm);
 int sys_map_region(envid_t src_env, void *src_pg,
                    envid_t dst_env, void *dst_pg, size_t size, int perm);
 int sys_unmap_region(envid_t env, void *pg, size_t size);
+int sys_region_batch(const struct RegionOp *ops, size_t count);
 int sys_ipc_try_send(envid_t to_env, uint64_t value, void *pg, size_t size, int perm);
 int sys_ipc_recv(void *rcv_pg, size_t size);
 
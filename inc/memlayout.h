@@ -27,6 +27,10 @@
  *     1 TB -------->  +------------------------------+
  *                     |                              | RW/--
  *                     ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * KERN_META_END --->  +------------------------------+ 0xD000000000
+ *                     |  Page descriptor pools       | RW/--  KERN_META_SIZE
+ * KERN_META_BASE -->  +------------------------------+ 0xC000000000
+ *                     ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
  *                     :              .               : 0x1
  *                     :              .               :
  *                     :              .               :
@@ -47,6 +51,10 @@
  *                     | - - - - - - - - - - - - - - -|                 HUGE_PAGE_SIZE
  *                     |      Invalid Memory (*)      | --/--  KERN_STACK_GAP    |
  *                     +------------------------------+                   |
+ *                     |       CPU1's #PF Stack       | RW/--  KERN_PF_STACK_SIZE |
+ *                     | - - - - - - - - - - - - - - -|                   |
+ *                     |      Invalid Memory (*)      | --/--  KERN_STACK_GAP    |
+ *                     +------------------------------+                   |
  *                     :              .               :                   |
  *                     :              .               :                   |
  *  KERN_HEAP_END -->  +------------------------------+ 0x803fe00000    --+
@@ -112,6 +120,14 @@
 /* Amount of memory mapped by entrypgdir */
 #define BOOT_MEM_SIZE (1024 * 1024 * 1024ULL)
 
+/* Window for page descriptor pools allocated after
+ * kernel address space is set up. Pools are mapped here so
+ * that they can be taken from anywhere in physical memory
+ * (this *should* be defined as a literal number) */
+#define KERN_META_BASE 0xC000000000
+#define KERN_META_SIZE 0x1000000000
+#define KERN_META_END  (KERN_META_BASE + KERN_META_SIZE)
+
 /* Kernel stack */
 #define KERN_STACK_TOP     KERN_BASE_ADDR
 #define PROG_STACK_SIZE    (2 * PAGE_SIZE)                                     /* size of a process stack */
@@ -120,6 +136,18 @@
 #define KERN_STACK_GAP     (8 * PAGE_SIZE)                                     /* size of a kernel stack guard */
 #define KERN_PF_STACK_TOP  (KERN_STACK_TOP - KERN_STACK_SIZE - KERN_STACK_GAP) /* size of page fault handler stack size */
 
+/* Stacks of CPU i are KERN_CPU_STACK_STRIDE * i below those of CPU0,
+ * so the CPU is known from the stack pointer while in kernel */
+#define KERN_CPU_STACK_STRIDE    (KERN_STACK_SIZE + KERN_STACK_GAP + KERN_PF_STACK_SIZE + KERN_STACK_GAP)
+#define KERN_CPU_STACK_TOP(cpu)    (KERN_STACK_TOP - (cpu)*KERN_CPU_STACK_STRIDE)
+#define KERN_CPU_PF_STACK_TOP(cpu) (KERN_PF_STACK_TOP - (cpu)*KERN_CPU_STACK_STRIDE)
+
+/* Application processors start in real mode at this physical
+ * address, page tables used to enter long mode follow the code */
+#define MPENTRY_PADDR 0x7000
+#define MPENTRY_PML4  0x8000
+#define MPENTRY_SIZE  0x4000
+
 /* Memory-mapped IO */
 #define KERN_HEAP_END   (KERN_STACK_TOP - HUGE_PAGE_SIZE)
 #define KERN_HEAP_START (KERN_HEAP_END - HUGE_PAGE_SIZE * 256) /* Max size of kernel heap is 512MB */
@@ -139,6 +139,12 @@
 #define CR4_SMAP       0x00200000 /* SMAP Enable */
 #define CR4_PKE        0x00400000 /* Protected Key Enable */
 
+/* CPUID.01H:ECX feature flags */
+#define CPUID_1_ECX_PCID 0x00020000 /* Process-context identifiers */
+
+/* CPUID.01H:EDX feature flags */
+#define CPUID_1_EDX_PGE 0x00002000 /* Global pages */
+
 /* x86_64 related changes */
 #define EFER_MSR 0xC0000080
 #define EFER_LME (1ULL << 8)
@@ -14,6 +14,7 @@
 /* Partition type constants */
 #define PTYPE_JOS_KERN 0x27 /* JOS kernel */
 #define PTYPE_JOSFS    0x28 /* JOS file system */
+#define PTYPE_JOS_SWAP 0x29 /* JOS swap area */
 
 /* Extended partition identifiers */
 #define PTYPE_DOS_EXTENDED   0x05
@@ -1,6 +1,8 @@
 #ifndef JOS_INC_SYSCALL_H
 #define JOS_INC_SYSCALL_H
 
+#include <inc/types.h>
+
 /* system call numbers */
 enum {
     SYS_cputs = 0,
@@ -18,7 +20,29 @@ enum {
     SYS_yield,
     SYS_ipc_try_send,
     SYS_ipc_recv,
+    SYS_region_batch,
+    SYS_env_set_weight,
+    SYS_env_set_rt,
     NSYSCALLS
 };
 
+/* Operations of SYS_region_batch, arguments are
+ * the same as of corresponding system calls
+ * (srcenv and srcva are only used by REGION_MAP) */
+enum {
+    REGION_ALLOC,
+    REGION_MAP,
+    REGION_UNMAP,
+};
+
+struct RegionOp {
+    int32_t type;
+    int32_t perm;
+    int32_t srcenv, dstenv;
+    uintptr_t srcva, dstva;
+    size_t size;
+};
+
+#define REGION_BATCH_MAX 16
+
 #endif /* !JOS_INC_SYSCALL_H */
@@ -38,7 +38,11 @@
 #define IRQ_SPURIOUS 7
 #define IRQ_CLOCK    8
 #define IRQ_IDE      14
-#define IRQ_ERROR    19
+/* Local APIC timer and inter-processor interrupts */
+#define IRQ_LAPIC_TIMER   17
+#define IRQ_TLB_SHOOTDOWN 18
+#define IRQ_ERROR         19
+#define IRQ_RESCHEDULE    20
 
 #define UTRAP_RSP 152
 #define UTRAP_RIP 136
@@ -1,116 +1,366 @@
 #include <inc/types.h>
-#include <kern/alloc.h>
 #include <inc/assert.h>
+#include <inc/string.h>
+#include <inc/x86.h>
+#include <kern/alloc.h>
+#include <kern/cpu.h>
+#include <kern/pmap.h>
 #include <kern/spinlock.h>
 
-#define SPACE_SIZE 5 * 0x1000
+/*
+ * General purpose kernel allocator.
+ *
+ * Every size class has a list of partially used slabs,
+ * a slab keeps list of freed objects and a bump pointer
+ * to the part of it that was never allocated, so pages
+ * of new slabs (which are lazily allocated zero-filled
+ * kernel heap) are touched only when they are used.
+ * Objects are freed in O(1), since slab header is found
+ * by masking object address. Empty slabs are kept in
+ * the list of free slabs shared by all classes.
+ *
+ * Per-CPU caches of free objects serve most requests
+ * without taking kmalloc_lock, they are refilled and
+ * drained by batches of KCACHE_BATCH objects.
+ */
+
+struct KmallocCache {
+    size_t count;
+    void *objs[KCACHE_SIZE];
+};
+static struct KmallocCache kcaches[NCPU][KMALLOC_CLASSES];
 
-static uint8_t space[SPACE_SIZE];
+static struct Slab partial_slabs[KMALLOC_CLASSES];
+static struct Slab free_slabs, free_runs;
+static bool kmalloc_initialized;
 
-/* empty list to get started */
-static Header base = {.next = (Header *)space, .prev = (Header *)space};
-/* start of free list */
-static Header *freep = NULL;
+/* Part of the last kzalloc_region() chunk that is not used yet */
+static uintptr_t arena_next, arena_end;
+
+static struct spinlock kmalloc_lock;
+
+static size_t kcache_hits, kcache_misses;
+static size_t slabs_total, large_total;
 
 static void
-check_list(void) {
-    asm volatile("cli");
-    Header *prevp = freep, *p = prevp->next;
-    for (; p != freep; p = p->next) {
-        if (prevp != p->prev) panic("Corrupted list.\n");
-        prevp = p;
+slab_list_init(struct Slab *head) {
+    head->next = head->prev = head;
+}
+
+static void
+slab_list_insert(struct Slab *head, struct Slab *slab) {
+    slab->next = head->next;
+    slab->prev = head;
+    head->next->prev = slab;
+    head->next = slab;
+}
+
+static void
+slab_list_remove(struct Slab *slab) {
+    slab->prev->next = slab->next;
+    slab->next->prev = slab->prev;
+    slab_list_init(slab);
+}
+
+static bool
+slab_list_empty(struct Slab *head) {
+    return head->next == head;
+}
+
+inline static size_t
+class_size(int class) {
+    return 1UL << (class + KMALLOC_MIN_SHIFT);
+}
+
+inline static int
+size_class(size_t size) {
+    if (size <= class_size(0)) return 0;
+    return 64 - __builtin_clzl(size - 1) - KMALLOC_MIN_SHIFT;
+}
+
+inline static struct Slab *
+obj_slab(void *obj) {
+    return (struct Slab *)ROUNDDOWN((uintptr_t)obj, SLAB_SIZE);
+}
+
+/* Objects are naturally aligned (up to page size) */
+inline static uintptr_t
+slab_start(struct Slab *slab, int class) {
+    return (uintptr_t)slab + ROUNDUP(sizeof *slab, MIN(class_size(class), PAGE_SIZE));
+}
+
+inline static bool
+slab_full(struct Slab *slab) {
+    return !slab->free && slab->bump + class_size(slab->class) > (uintptr_t)slab + SLAB_SIZE;
+}
+
+static void
+kmalloc_init(void) {
+    for (int i = 0; i < KMALLOC_CLASSES; i++)
+        slab_list_init(&partial_slabs[i]);
+    slab_list_init(&free_slabs);
+    slab_list_init(&free_runs);
+    kmalloc_initialized = 1;
+}
+
+/* Takes nslabs consecutive slabs from the arena */
+static struct Slab *
+slab_run_alloc(size_t nslabs) {
+    size_t size = nslabs * SLAB_SIZE;
+
+    if (arena_next + size > arena_end) {
+        /* Rest of the chunk is kept as free slabs */
+        for (; arena_next + SLAB_SIZE <= arena_end; arena_next += SLAB_SIZE) {
+            struct Slab *slab = (struct Slab *)arena_next;
+            slab->nslabs = 1;
+            slab_list_insert(&free_slabs, slab);
+            slabs_total++;
+        }
+
+        /* One more slab is needed for alignment */
+        size_t chunk = MAX(KMALLOC_CHUNK, size + SLAB_SIZE);
+        uintptr_t base = (uintptr_t)kzalloc_region(chunk);
+        if (!base) return NULL;
+        arena_next = ROUNDUP(base, SLAB_SIZE);
+        arena_end = ROUNDDOWN(base + chunk, SLAB_SIZE);
     }
-    asm volatile("sti");
+
+    struct Slab *slab = (struct Slab *)arena_next;
+    arena_next += size;
+    slab->nslabs = nslabs;
+    if (nslabs == 1) slabs_total++;
+    return slab;
 }
 
-/* malloc: general-purpose storage allocator */
-void *
-test_alloc(uint8_t nbytes) {
+static struct Slab *
+slab_new(int class) {
+    struct Slab *slab;
+    if (!slab_list_empty(&free_slabs)) {
+        slab = free_slabs.next;
+        slab_list_remove(slab);
+    } else if (!(slab = slab_run_alloc(1)))
+        return NULL;
+
+    slab->free = NULL;
+    slab->bump = slab_start(slab, class);
+    slab->inuse = 0;
+    slab->class = class;
+    slab_list_insert(&partial_slabs[class], slab);
+    return slab;
+}
 
-    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
-    // LAB 5: Your code here
+static void *
+slab_obj_alloc(int class) {
+    struct Slab *slab = partial_slabs[class].next;
+    if (slab == &partial_slabs[class] && !(slab = slab_new(class))) return NULL;
 
-    size_t nunits = (nbytes + sizeof(Header) - 1) / sizeof(Header) + 1;
+    void *obj;
+    if (slab->free) {
+        obj = slab->free;
+        slab->free = *(void **)obj;
+    } else {
+        obj = (void *)slab->bump;
+        slab->bump += class_size(class);
+    }
 
-    lock_kernel();
-    /* no free list yet */
-    if (!freep) {
-        Header *hd = (Header *)&space;
+    slab->inuse++;
+    if (slab_full(slab)) slab_list_remove(slab);
+    return obj;
+}
+
+static void
+slab_obj_free(void *obj) {
+    struct Slab *slab = obj_slab(obj);
+    assert(slab->class < KMALLOC_CLASSES && slab->inuse);
 
-        hd->next = (Header *)&base;
-        hd->prev = (Header *)&base;
-        hd->size = (SPACE_SIZE - sizeof(Header)) / sizeof(Header);
+    if (slab_full(slab)) slab_list_insert(&partial_slabs[slab->class], slab);
+    *(void **)obj = slab->free;
+    slab->free = obj;
 
-        freep = &base;
+    if (!--slab->inuse) {
+        slab_list_remove(slab);
+        slab_list_insert(&free_slabs, slab);
     }
+}
+
+/* Large objects start at the cache line after slab header */
+static void *
+kmalloc_large(size_t size) {
+    size_t nslabs = ROUNDUP(size + sizeof(struct Slab), SLAB_SIZE) / SLAB_SIZE;
+
+    uint64_t rflags = read_rflags();
+    asm volatile("cli");
+    spin_lock(&kmalloc_lock);
+    if (!kmalloc_initialized) kmalloc_init();
 
-    check_list();
-
-    for (Header *p = freep->next;; p = p->next) {
-        /* big enough */
-        if (p->size >= nunits) {
-            freep = p->prev;
-            /* exactly */
-            if (p->size == nunits) {
-                p->prev->next = p->next;
-                p->next->prev = p->prev;
-            } else { /* allocate tail end */
-                p->size -= nunits;
-                p += p->size;
-                p->size = nunits;
-            }
-            unlock_kernel();
-            return (void *)(p + 1);
+    /* First fit, the rest of a larger run is split off
+     * and kept as a free run (or a free slab if it is single) */
+    struct Slab *slab = free_runs.next;
+    while (slab != &free_runs && slab->nslabs < nslabs) slab = slab->next;
+    if (slab != &free_runs) {
+        slab_list_remove(slab);
+        if (slab->nslabs > nslabs) {
+            struct Slab *rest = (struct Slab *)((uintptr_t)slab + nslabs * SLAB_SIZE);
+            rest->nslabs = slab->nslabs - nslabs;
+            rest->inuse = 0;
+            rest->class = KMALLOC_LARGE_CLASS;
+            slab_list_insert(rest->nslabs > 1 ? &free_runs : &free_slabs, rest);
+            if (rest->nslabs == 1) slabs_total++;
+            slab->nslabs = nslabs;
         }
+    } else
+        slab = slab_run_alloc(nslabs);
 
+    if (slab) {
+        slab->class = KMALLOC_LARGE_CLASS;
+        slab->inuse = 1;
+        large_total++;
+    }
 
-        /* wrapped around free list */
-        if (p == freep) {
-            unlock_kernel();
-            return NULL;
+    spin_unlock(&kmalloc_lock);
+    write_rflags(rflags);
+    return slab ? slab + 1 : NULL;
+}
+
+void *
+kmalloc(size_t size) {
+    if (!size) return NULL;
+    if (size > KMALLOC_MAX_SIZE) return kmalloc_large(size);
+
+    int class = size_class(size);
+
+    uint64_t rflags = read_rflags();
+    asm volatile("cli");
+
+    struct KmallocCache *cache = &kcaches[cpunum()][class];
+    if (!cache->count) {
+        kcache_misses++;
+        spin_lock(&kmalloc_lock);
+        if (!kmalloc_initialized) kmalloc_init();
+        while (cache->count < KCACHE_BATCH) {
+            void *obj = slab_obj_alloc(class);
+            if (!obj) break;
+            cache->objs[cache->count++] = obj;
         }
+        spin_unlock(&kmalloc_lock);
+    } else
+        kcache_hits++;
+
+    void *res = cache->count ? cache->objs[--cache->count] : NULL;
+
+    write_rflags(rflags);
+    return res;
+}
+
+void *
+kzalloc(size_t size) {
+    void *res = kmalloc(size);
+    if (res) memset(res, 0, size);
+    return res;
+}
+
+void
+kfree(void *ptr) {
+    if (!ptr) return;
+
+    struct Slab *slab = obj_slab(ptr);
+
+    uint64_t rflags = read_rflags();
+    asm volatile("cli");
+
+    if (slab->class == KMALLOC_LARGE_CLASS) {
+        assert(ptr == slab + 1 && slab->inuse == 1);
+        spin_lock(&kmalloc_lock);
+        slab->inuse = 0;
+        slab_list_insert(&free_runs, slab);
+        large_total--;
+        spin_unlock(&kmalloc_lock);
+    } else {
+        assert(slab->class < KMALLOC_CLASSES);
+        struct KmallocCache *cache = &kcaches[cpunum()][slab->class];
+        if (cache->count == KCACHE_SIZE) {
+            /* Return the oldest objects to their slabs */
+            spin_lock(&kmalloc_lock);
+            for (size_t i = 0; i < KCACHE_BATCH; i++)
+                slab_obj_free(cache->objs[i]);
+            spin_unlock(&kmalloc_lock);
+            memmove(cache->objs, cache->objs + KCACHE_BATCH, (KCACHE_SIZE - KCACHE_BATCH) * sizeof *cache->objs);
+            cache->count -= KCACHE_BATCH;
+        }
+        cache->objs[cache->count++] = ptr;
     }
+
+    write_rflags(rflags);
+}
+
+/* Allocator used by kernel space test programs */
+void *
+test_alloc(uint8_t nbytes) {
+    return kmalloc(nbytes);
 }
 
-/* free: put block ap in free list */
 void
 test_free(void *ap) {
+    kfree(ap);
+}
 
-    /* point to block header */
-    Header *bp = (Header *)ap - 1;
-
-    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
-    // LAB 5: Your code here
+void
+dump_kmalloc_stats(void) {
+    size_t total = kcache_hits + kcache_misses;
+    cprintf("Kmalloc: %zu slabs of %luK, %zu large objects, %zu%% per-CPU cache hit rate\n",
+            slabs_total, SLAB_SIZE / 1024, large_total, total ? kcache_hits * 100 / total : 0);
+    for (int class = 0; class < KMALLOC_CLASSES; class ++) {
+        size_t nslabs = 0, inuse = 0;
+        for (struct Slab *slab = partial_slabs[class].next; kmalloc_initialized && slab != &partial_slabs[class]; slab = slab->next) {
+            nslabs++;
+            inuse += slab->inuse;
+        }
+        size_t cached = 0;
+        for (int cpu = 0; cpu < NCPU; cpu++) cached += kcaches[cpu][class].count;
+        if (nslabs || cached)
+            cprintf("  %5zu bytes: %zu partial slabs (%zu objects used), %zu cached\n",
+                    class_size(class), nslabs, inuse, cached);
+    }
+}
 
-    /* freed block at start or end of arena */
+#define BENCH_SLOTS 1024
 
-    lock_kernel();
+/* Random allocations and frees of objects of every
+ * class keeping up to BENCH_SLOTS live ones */
+void
+bench_kmalloc(size_t iterations) {
+    static void *slots[BENCH_SLOTS];
+    uint64_t seed = read_tsc() | 1;
+    uint64_t alloc_cycles = 0, free_cycles = 0;
+    size_t nalloc = 0, nfree = 0, nfail = 0;
 
-    Header *p = freep;
-    for (; !(bp > p && bp < p->next); p = p->next)
-        if (p >= p->next && (bp > p || bp < p->next)) break;
+    for (size_t i = 0; i < iterations; i++) {
+        /* xorshift64 */
+        seed ^= seed << 13;
+        seed ^= seed >> 7;
+        seed ^= seed << 17;
 
-    if (bp + bp->size == p->next && p + p->size == bp) /* join to both */ {
-        p->size += bp->size + p->next->size;
-        p->next->next->prev = p;
-        p->next = p->next->next;
-    } else if (bp + bp->size == p->next) /* join to upper nbr */ {
-        bp->size += p->next->size;
-        bp->next = p->next->next;
-        bp->prev = p->next->prev;
-        p->next->next->prev = bp;
-        p->next = bp;
-    } else if (p + p->size == bp) /* join to lower nbr */ {
-        p->size += bp->size;
-    } else {
-        bp->next = p->next;
-        bp->prev = p;
-        p->next->prev = bp;
-        p->next = bp;
+        void **slot = &slots[seed % BENCH_SLOTS];
+        uint64_t start = read_tsc();
+        if (*slot) {
+            kfree(*slot);
+            *slot = NULL;
+            free_cycles += read_tsc() - start;
+            nfree++;
+        } else {
+            *slot = kmalloc(class_size((seed >> 32) % KMALLOC_CLASSES));
+            alloc_cycles += read_tsc() - start;
+            nalloc++;
+            if (!*slot) nfail++;
+        }
     }
-    freep = p;
 
-    check_list();
+    for (size_t i = 0; i < BENCH_SLOTS; i++) {
+        kfree(slots[i]);
+        slots[i] = NULL;
+    }
 
-    unlock_kernel();
+    cprintf("Kmalloc: %zu allocations (%zu failed), %zu frees\n", nalloc, nfail, nfree);
+    cprintf("  alloc: %lu cycles/op\n", (unsigned long)(nalloc ? alloc_cycles / nalloc : 0));
+    cprintf("  free:  %lu cycles/op\n", (unsigned long)(nfree ? free_cycles / nfree : 0));
 }
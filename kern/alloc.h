@@ -3,16 +3,44 @@
 
 #include <inc/types.h>
 
-/* block header */
-struct header {
-    /* next block */
-    struct header *next;
-    /* prev block */
-    struct header *prev;
-    /* size of this block */
-    size_t size;
-} __attribute__((packed, aligned(_Alignof(max_align_t))));
-
-typedef struct header Header;
+/* Objects of up to KMALLOC_MAX_SIZE bytes are carved from
+ * slabs of SLAB_SIZE bytes, sizes are rounded up to the power of 2.
+ * Larger allocations occupy a run of consecutive slabs.
+ * Slabs are aligned on SLAB_SIZE, so header of the slab
+ * an object belongs to is found by masking its address */
+#define SLAB_SHIFT          16
+#define SLAB_SIZE           (1UL << SLAB_SHIFT)
+#define KMALLOC_MIN_SHIFT   4
+#define KMALLOC_MAX_SHIFT   13
+#define KMALLOC_MAX_SIZE    (1UL << KMALLOC_MAX_SHIFT)
+#define KMALLOC_CLASSES     (KMALLOC_MAX_SHIFT - KMALLOC_MIN_SHIFT + 1)
+#define KMALLOC_LARGE_CLASS KMALLOC_CLASSES
+
+/* Slabs are taken from kzalloc_region() chunks of this size */
+#define KMALLOC_CHUNK (2UL * 1024 * 1024)
+
+/* Per-CPU cache of free objects of every class */
+#define KCACHE_SIZE  32
+#define KCACHE_BATCH (KCACHE_SIZE / 2)
+
+struct Slab {
+    /* Link of partial slabs list of the class or free slabs list */
+    struct Slab *next, *prev;
+    /* List of freed objects (linked through their first word) */
+    void *free;
+    /* Objects at and above this address were never allocated */
+    uintptr_t bump;
+    uint32_t inuse;
+    uint32_t class;
+    /* Number of slabs in the run (for large allocations) */
+    size_t nslabs;
+} __attribute__((aligned(64)));
+
+void *kmalloc(size_t size);
+void *kzalloc(size_t size);
+void kfree(void *ptr);
+
+void dump_kmalloc_stats(void);
+void bench_kmalloc(size_t iterations);
 
 #endif
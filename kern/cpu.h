@@ -1,4 +1,3 @@
-
 #ifndef JOS_INC_CPU_H
 #define JOS_INC_CPU_H
 
@@ -6,11 +5,65 @@
 #include <inc/memlayout.h>
 #include <inc/mmu.h>
 #include <inc/env.h>
+#include <inc/x86.h>
+
+/* Maximum number of CPUs */
+#define NCPU 8
+
+/* Values of status in struct CpuInfo */
+enum {
+    CPU_UNUSED = 0,
+    CPU_STARTED,
+    CPU_HALTED,
+};
+
+/* Per-CPU state */
+struct CpuInfo {
+    uint8_t cpu_id;                 /* Local APIC ID */
+    volatile unsigned cpu_status;   /* The status of the CPU */
+    struct Env *cpu_env;            /* The currently-running environment */
+    struct AddressSpace *cpu_space; /* Address space loaded into CR3 */
+    bool cpu_in_page_fault;         /* Page faults in kernel can't nest */
+    struct Taskstate cpu_ts;        /* Used by x86 to find stack for interrupt */
+    bool cpu_tick_stopped;          /* Scheduler tick is not armed */
+    uint64_t cpu_ticks;             /* Scheduler tick interrupts taken */
+    uint64_t cpu_wakeups;           /* Times the CPU was woken up from halt */
+
+    /* TLB shootdown request: range of addresses to invalidate,
+     * pending flag is cleared by the CPU when it's done */
+    volatile bool cpu_tlb_pending;
+    volatile uintptr_t cpu_tlb_start, cpu_tlb_end;
+};
+
+extern struct CpuInfo cpus[NCPU];
+/* Total number of CPUs in the system (CPU 0 is the bootstrap one) */
+extern int ncpu;
+/* Physical MMIO address of the local APIC */
+extern physaddr_t lapicaddr;
+/* Stack top for the application processor being started */
+extern uintptr_t mpentry_kstack;
+
+/* Index of the CPU we are running on. Kernel stacks of CPUs
+ * are at fixed addresses (see KERN_CPU_STACK_TOP), so it's found
+ * by the stack pointer without accessing the local APIC.
+ * Bootstrap processor starts on its stack at another address */
+static inline int
+cpunum(void) {
+    uintptr_t rsp = read_rsp();
+    if (rsp >= KERN_STACK_TOP || rsp < KERN_STACK_TOP - NCPU * KERN_CPU_STACK_STRIDE) return 0;
+    return (KERN_STACK_TOP - 1 - rsp) / KERN_CPU_STACK_STRIDE;
+}
 
-#define NCPU 1
+#define thiscpu (&cpus[cpunum()])
 
-/* Used by x86 to find stack for interrupt */
-extern struct Taskstate cpu_ts;
+void mp_init(void);
+void lapic_init(void);
+void lapic_eoi(void);
+void lapic_startap(uint8_t apicid, uint32_t addr);
+void lapic_stopap(uint8_t apicid);
+void lapic_ipi(uint8_t apicid, int vector);
+void lapic_timer_oneshot(uint64_t tsc_deadline);
+void lapic_timer_stop(void);
 
 extern char in_intr;
 extern bool in_clk_intr;
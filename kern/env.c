@@ -12,14 +12,12 @@
 #include <kern/trap.h>
 #include <kern/monitor.h>
 #include <kern/sched.h>
+#include <kern/spinlock.h>
 #include <kern/kdebug.h>
 #include <kern/macro.h>
 #include <kern/pmap.h>
 #include <kern/traceopt.h>
 
-/* Currently active environment */
-struct Env *curenv = NULL;
-
 #ifdef CONFIG_KSPACE
 /* All environments */
 struct Env env_array[NENV];
@@ -159,8 +157,22 @@ env_alloc(struct Env **newenv_store, envid_t parent_id, enum EnvType type) {
 #else
     env->env_type = type;
 #endif
-    env->env_status = ENV_RUNNABLE;
     env->env_runs = 0;
+    env->env_pgfaults = 0;
+    env->env_syscalls = 0;
+    env->env_region_done = 0;
+    env->env_region_op = 0;
+
+    /* File system server is shared by all environments */
+    env->env_weight = type == ENV_TYPE_FS ? SCHED_WEIGHT_FS : SCHED_WEIGHT_DEFAULT;
+    env->env_vruntime = 0;
+    env->env_runtime = 0;
+    env->env_run_start = 0;
+    env->env_rt_period = 0;
+    /* New environment starts on the CPU of its parent,
+     * idle CPUs steal it from there if needed */
+    env->env_cpu = cpunum();
+    env_set_status(env, ENV_RUNNABLE);
 
     /* Clear out all the saved register state,
      * to prevent the register values
@@ -447,7 +459,7 @@ env_free(struct Env *env) {
 #endif
 
     /* Return the environment to the free list */
-    env->env_status = ENV_FREE;
+    env_set_status(env, ENV_FREE);
     env->env_link = env_free_list;
     env_free_list = env;
 }
@@ -462,6 +474,12 @@ env_destroy(struct Env *env) {
     /* If env is currently running on other CPUs, we change its state to
      * ENV_DYING. A zombie environment will be freed the next time
      * it traps to the kernel. */
+    if ((env->env_status == ENV_RUNNING || env->env_status == ENV_DYING) && env != curenv) {
+        env_set_status(env, ENV_DYING);
+        /* Make it trap right away */
+        lapic_ipi(cpus[env->env_cpu].cpu_id, IRQ_OFFSET + IRQ_RESCHEDULE);
+        return;
+    }
 
     // LAB 8: Your code here (set in_page_fault = 0)
     if (env == curenv)
@@ -484,6 +502,7 @@ csys_exit(void) {
 void
 csys_yield(struct Trapframe *tf) {
     memcpy(&curenv->env_tf, tf, sizeof(struct Trapframe));
+    sched_skip(curenv);
     sched_yield();
 }
 #endif
@@ -496,6 +515,8 @@ csys_yield(struct Trapframe *tf) {
 
 _Noreturn void
 env_pop_tf(struct Trapframe *tf) {
+    irq_latency_end();
+
     asm volatile(
             "movq %0, %%rsp\n"
             "movq 0(%%rsp), %%r15\n"
@@ -549,6 +570,10 @@ _Noreturn void
 env_run(struct Env *env) {
     assert(env);
 
+    /* Environment that has just become real-time continues on the
+     * boot CPU, only it gets interrupts of the budget timer */
+    if (env->env_rt_period && cpunum()) sched_yield();
+
     if (trace_envs_more) {
         const char *state[] = {"FREE", "DYING", "RUNNABLE", "RUNNING", "NOT_RUNNABLE"};
         if (curenv) cprintf("[%08X] env stopped: %s\n", curenv->env_id, state[curenv->env_status]);
@@ -564,7 +589,7 @@ env_run(struct Env *env) {
         {
             case ENV_RUNNING:
             {
-                curenv->env_status = ENV_RUNNABLE;
+                env_set_status(curenv, ENV_RUNNABLE);
             } break;
             default:
             {
@@ -573,10 +598,16 @@ env_run(struct Env *env) {
         }
     }
     curenv = env;
-    env->env_status = ENV_RUNNING;
+    env->env_cpu = cpunum();
+    env_set_status(env, ENV_RUNNING);
     env->env_runs++;
+    /* Returning from a trap continues the same time slice */
+    if (!env->env_run_start) env->env_run_start = read_tsc();
 
     switch_address_space(&env->address_space);
+
+    /* Kernel is left when user mode environment starts running */
+    if (env->env_tf.tf_cs & 3) unlock_kernel();
     env_pop_tf(&env->env_tf);
 
     while(1) {}
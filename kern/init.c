@@ -10,6 +10,7 @@
 #include <kern/tsc.h>
 #include <kern/console.h>
 #include <kern/pmap.h>
+#include <kern/swap.h>
 #include <kern/env.h>
 #include <kern/timer.h>
 #include <kern/trap.h>
@@ -17,8 +18,12 @@
 #include <kern/picirq.h>
 #include <kern/kclock.h>
 #include <kern/kdebug.h>
+#include <kern/cpu.h>
+#include <kern/spinlock.h>
 #include <kern/traceopt.h>
 
+static void boot_aps(void);
+
 void
 timers_init(void) {
     timertab[0] = timer_rtc;
@@ -127,6 +132,8 @@ early_boot_pml4_init(void) {
 
 void
 i386_init(void) {
+    boot_timer_start();
+
     early_boot_pml4_init();
 
     /* Initialize the console.
@@ -138,24 +145,47 @@ i386_init(void) {
     if (trace_init) {
         cprintf("6828 decimal is %o octal!\n", 6828);
         cprintf("END: %p\n", end);
+        boot_phase("console");
     }
 
     /* Lab 6 memory management initialization functions */
+    uint64_t tsc_start = read_tsc();
     init_memory();
+    if (trace_init) {
+        cprintf("Memory initialized in %lu ms\n", (read_tsc() - tsc_start) * 1000 / tsc_calibrate());
+        boot_phase("memory");
+    }
 
     pic_init();
     timers_init();
+    if (trace_init) boot_phase("timers");
 
     /* Framebuffer init should be done after memory init */
     fb_init();
     if (trace_init) cprintf("Framebuffer initialised\n");
+    if (trace_init) boot_phase("framebuffer");
 
     /* User environment initialization functions */
     env_init();
+    if (trace_init) boot_phase("envs");
+
+    swap_init();
+    if (trace_init) boot_phase("swap");
 
     /* Choose the timer used for scheduling: hpet or pit */
     timers_schedule("hpet0");
 
+    /* Multiprocessor initialization functions */
+    mp_init();
+    lapic_init();
+
+    /* Acquire the big kernel lock before waking up APs */
+    lock_kernel();
+
+    /* Starting non-boot CPUs */
+    boot_aps();
+    if (trace_init) boot_phase("smp");
+
 #ifdef CONFIG_KSPACE
     /* Touch all you want */
     //ENV_CREATE_KERNEL_TYPE(prog_test1);
@@ -185,10 +215,88 @@ i386_init(void) {
     /* Should not be necessary - drains keyboard because interrupt has given up. */
     kbd_intr();
 
+    if (trace_init) boot_phase("env create");
+
     /* Schedule and run the first user environment! */
     sched_yield();
 }
 
+/* While boot_aps is booting a given CPU, it communicates the per-core
+ * stack pointer that should be loaded by mpentry.S to that CPU in
+ * this variable. */
+uintptr_t mpentry_kstack;
+
+/* Builds page tables used by application processors to enter long mode:
+ * the first 2MB containing startup code are identity mapped,
+ * the rest is taken from the kernel address space */
+static void
+mpentry_init_pml4(void) {
+    pte_t *pml4 = KADDR(MPENTRY_PML4);
+    pte_t *pdp = KADDR(MPENTRY_PML4 + PAGE_SIZE);
+    pte_t *pd = KADDR(MPENTRY_PML4 + 2 * PAGE_SIZE);
+
+    memcpy(pml4, kspace.pml4, PAGE_SIZE);
+    memset(pdp, 0, PAGE_SIZE);
+    memset(pd, 0, PAGE_SIZE);
+    pml4[0] = (MPENTRY_PML4 + PAGE_SIZE) | PTE_P | PTE_W;
+    pdp[0] = (MPENTRY_PML4 + 2 * PAGE_SIZE) | PTE_P | PTE_W;
+    pd[0] = PTE_P | PTE_W | PTE_PS;
+}
+
+/* Start the non-boot (AP) processors. */
+static void
+boot_aps(void) {
+    if (ncpu == 1) return;
+
+    extern unsigned char mpentry_start[], mpentry_end[];
+
+    /* Write entry code to unused memory at MPENTRY_PADDR */
+    memmove(KADDR(MPENTRY_PADDR), mpentry_start, mpentry_end - mpentry_start);
+    mpentry_init_pml4();
+
+    pcid_disable();
+
+    /* Boot each AP one at a time */
+    for (int i = 1; i < ncpu; i++) {
+        /* Tell mpentry.S what stack to use */
+        mpentry_kstack = KERN_CPU_STACK_TOP(i);
+        /* Start the CPU at mpentry_start */
+        lapic_startap(cpus[i].cpu_id, MPENTRY_PADDR);
+
+        /* Wait for the CPU to finish some basic setup in mp_main() */
+        uint64_t deadline = read_tsc() + tsc_calibrate();
+        while (cpus[i].cpu_status != CPU_STARTED && read_tsc() < deadline)
+            asm volatile("pause");
+        if (cpus[i].cpu_status == CPU_STARTED) continue;
+
+        /* CPU is reset (it can't be past lock_kernel() in mp_main()),
+         * and dropped, so that the next one takes its place and stack */
+        lapic_stopap(cpus[i].cpu_id);
+        cprintf("SMP: CPU %d did not start\n", cpus[i].cpu_id);
+        memmove(&cpus[i], &cpus[i + 1], (ncpu - i - 1) * sizeof *cpus);
+        memset(&cpus[--ncpu], 0, sizeof *cpus);
+        i--;
+    }
+}
+
+/* Setup code for APs */
+void
+mp_main(void) {
+    init_memory_percpu();
+    lapic_init();
+    trap_init_percpu();
+
+    if (trace_init) cprintf("SMP: CPU %d starting\n", thiscpu->cpu_id);
+    /* Tell boot_aps() we're up */
+    xchg(&thiscpu->cpu_status, CPU_STARTED);
+
+    /* Now that we have finished some basic setup, call sched_yield()
+     * to start running processes on this CPU. But make sure that
+     * only one CPU can enter the scheduler at a time! */
+    lock_kernel();
+    sched_yield();
+}
+
 /* Variable panicstr contains argument to first call to panic; used as flag
  * to indicate that the kernel has already called panic. */
 const char *panicstr = NULL;
@@ -63,6 +63,10 @@ rtc_timer_pic_interrupt(void) {
     // LAB 4: Your code here
     // Enable PIC interrupts.
 
+    /* Periodic interrupt is only enabled when RTC is used for
+     * scheduling, otherwise it would keep waking up idle CPU
+     * since IRQ_CLOCK is shared with HPET one-shot timer */
+    cmos_write8(RTC_BREG, cmos_read8(RTC_BREG) | RTC_PIE);
     pic_irq_unmask(IRQ_CLOCK);
 }
 
@@ -85,7 +89,7 @@ rtc_timer_init(void) {
     // (use cmos_read8/cmos_write8)
 
     uint8_t b = cmos_read8(RTC_BREG);
-    b |= RTC_PIE;
+    b &= ~RTC_PIE;
     cmos_write8(RTC_BREG, b);
     uint8_t a = cmos_read8(RTC_AREG);
     a = RTC_NON_RATE_MASK(a);
@@ -0,0 +1,200 @@
+/* The local APIC manages internal (non-I/O) interrupts.
+ * See Chapter 8 & Appendix C of Intel processor manual volume 3. */
+
+#include <inc/types.h>
+#include <inc/memlayout.h>
+#include <inc/trap.h>
+#include <inc/mmu.h>
+#include <inc/stdio.h>
+#include <inc/x86.h>
+#include <kern/pmap.h>
+#include <kern/cpu.h>
+#include <kern/picirq.h>
+#include <kern/tsc.h>
+
+/* Local APIC registers, divided by 4 for use as uint32_t[] indices. */
+#define ID    (0x0020 / 4) /* ID */
+#define VER   (0x0030 / 4) /* Version */
+#define TPR   (0x0080 / 4) /* Task Priority */
+#define EOI   (0x00B0 / 4) /* EOI */
+#define SVR   (0x00F0 / 4) /* Spurious Interrupt Vector */
+#define ENABLE 0x00000100  /* Unit Enable */
+#define ESR   (0x0280 / 4) /* Error Status */
+#define ICRLO (0x0300 / 4) /* Interrupt Command */
+#define INIT     0x00000500 /* INIT/RESET */
+#define STARTUP  0x00000600 /* Startup IPI */
+#define DELIVS   0x00001000 /* Delivery status */
+#define ASSERT   0x00004000 /* Assert interrupt (vs deassert) */
+#define DEASSERT 0x00000000
+#define LEVEL    0x00008000 /* Level triggered */
+#define BCAST    0x00080000 /* Send to all APICs, including self. */
+#define OTHERS   0x000C0000 /* Send to all APICs, excluding self. */
+#define BUSY     0x00001000
+#define FIXED    0x00000000
+#define ICRHI  (0x0310 / 4)  /* Interrupt Command [63:32] */
+#define TIMER  (0x0320 / 4)  /* Local Vector Table 0 (TIMER) */
+#define X1       0x0000000B  /* divide counts by 1 */
+#define PCINT  (0x0340 / 4)  /* Performance Counter LVT */
+#define LINT0  (0x0350 / 4)  /* Local Vector Table 1 (LINT0) */
+#define LINT1  (0x0360 / 4)  /* Local Vector Table 2 (LINT1) */
+#define ERROR  (0x0370 / 4)  /* Local Vector Table 3 (ERROR) */
+#define MASKED   0x00010000  /* Interrupt masked */
+#define TICR   (0x0380 / 4)  /* Timer Initial Count */
+#define TCCR   (0x0390 / 4)  /* Timer Current Count */
+#define TDCR   (0x03E0 / 4)  /* Timer Divide Configuration */
+
+physaddr_t lapicaddr; /* Initialized in mpconfig.c */
+volatile uint32_t *lapic;
+
+/* Timer ticks per second, measured by the bootstrap processor */
+static uint64_t lapic_timer_freq;
+
+static void
+lapicw(int index, int value) {
+    lapic[index] = value;
+    lapic[ID]; /* wait for write to finish, by reading */
+}
+
+/* Spin for a given number of microseconds */
+static void
+microdelay(int us) {
+    uint64_t end = read_tsc() + tsc_calibrate() * us / 1000000;
+    while (read_tsc() < end) asm volatile("pause");
+}
+
+/* Counts ticks of the local APIC timer during 10ms of TSC */
+static uint64_t
+lapic_timer_calibrate(void) {
+    lapicw(TDCR, X1);
+    lapicw(TIMER, MASKED);
+    lapicw(TICR, UINT32_MAX);
+    microdelay(10000);
+    uint32_t ticks = UINT32_MAX - lapic[TCCR];
+    lapicw(TICR, 0);
+    return ticks * 100ULL;
+}
+
+void
+lapic_init(void) {
+    if (!lapicaddr) return;
+
+    /* lapicaddr is the physical address of the LAPIC's 4K MMIO
+     * region. Map it in to virtual memory so we can access it. */
+    if (!lapic) lapic = mmio_map_region(lapicaddr, PAGE_SIZE);
+
+    /* Enable local APIC; set spurious interrupt vector. */
+    lapicw(SVR, ENABLE | (IRQ_OFFSET + IRQ_SPURIOUS));
+
+    /* Bootstrap processor keeps LINT0 in virtual wire mode set up
+     * by firmware, that's how PIC interrupts reach it. Other
+     * processors don't receive them */
+    if (cpunum()) {
+        lapicw(LINT0, MASKED);
+    } else {
+        lapic_timer_freq = lapic_timer_calibrate();
+        /* Scheduler tick of all processors is one-shot local APIC
+         * timer armed by the scheduler, periodic one is not needed */
+        pic_irq_mask(IRQ_TIMER);
+    }
+
+    /* Timer is stopped until the scheduler arms it */
+    lapicw(TDCR, X1);
+    lapicw(TIMER, MASKED | (IRQ_OFFSET + IRQ_LAPIC_TIMER));
+    lapicw(TICR, 0);
+
+    /* Disable NMI (LINT1) on all CPUs */
+    lapicw(LINT1, MASKED);
+
+    /* Disable performance counter overflow interrupts
+     * on machines that provide that interrupt entry. */
+    if (((lapic[VER] >> 16) & 0xFF) >= 4) lapicw(PCINT, MASKED);
+
+    /* Errors are not handled */
+    lapicw(ERROR, MASKED);
+
+    /* Clear error status register (requires back-to-back writes). */
+    lapicw(ESR, 0);
+    lapicw(ESR, 0);
+
+    /* Ack any outstanding interrupts. */
+    lapicw(EOI, 0);
+
+    /* Send an Init Level De-Assert to synchronize arbitration ID's. */
+    lapicw(ICRHI, 0);
+    lapicw(ICRLO, BCAST | INIT | LEVEL);
+    while (lapic[ICRLO] & DELIVS) asm volatile("pause");
+
+    /* Enable interrupts on the APIC (but not on the processor). */
+    lapicw(TPR, 0);
+}
+
+/* Arms local APIC timer of this CPU to raise
+ * IRQ_LAPIC_TIMER once at the time TSC reaches tsc_deadline */
+void
+lapic_timer_oneshot(uint64_t tsc_deadline) {
+    if (!lapic) return;
+
+    uint64_t now = read_tsc();
+    uint64_t delta = tsc_deadline > now ? tsc_deadline - now : 0;
+    uint64_t ticks = delta * lapic_timer_freq / tsc_calibrate();
+
+    lapicw(TIMER, IRQ_OFFSET + IRQ_LAPIC_TIMER);
+    lapicw(TICR, MIN(MAX(ticks, 1), UINT32_MAX));
+}
+
+/* Stops local APIC timer of this CPU */
+void
+lapic_timer_stop(void) {
+    if (!lapic) return;
+
+    lapicw(TIMER, MASKED | (IRQ_OFFSET + IRQ_LAPIC_TIMER));
+    lapicw(TICR, 0);
+}
+
+/* Acknowledge interrupt. */
+void
+lapic_eoi(void) {
+    if (lapic) lapicw(EOI, 0);
+}
+
+/* Start additional processor running entry code at addr.
+ * See Appendix B of MultiProcessor Specification. */
+void
+lapic_startap(uint8_t apicid, uint32_t addr) {
+    /* "Universal startup algorithm."
+     * Send INIT (level-triggered) interrupt to reset other CPU. */
+    lapicw(ICRHI, apicid << 24);
+    lapicw(ICRLO, INIT | LEVEL | ASSERT);
+    microdelay(200);
+    lapicw(ICRLO, INIT | LEVEL);
+    microdelay(10000);
+
+    /* Send startup IPI (twice!) to enter code.
+     * Regular hardware is supposed to only accept a STARTUP
+     * when it is in the halted state due to an INIT.  So the second
+     * should be ignored, but it is part of the official Intel algorithm. */
+    for (int i = 0; i < 2; i++) {
+        lapicw(ICRHI, apicid << 24);
+        lapicw(ICRLO, STARTUP | (addr >> 12));
+        microdelay(200);
+    }
+}
+
+/* Resets processor that did not start in time, so that
+ * it waits for startup IPI and never runs entry code */
+void
+lapic_stopap(uint8_t apicid) {
+    lapicw(ICRHI, apicid << 24);
+    lapicw(ICRLO, INIT | LEVEL | ASSERT);
+    microdelay(200);
+    lapicw(ICRLO, INIT | LEVEL);
+    microdelay(10000);
+}
+
+/* Sends fixed interrupt with the vector to CPU with the local APIC ID */
+void
+lapic_ipi(uint8_t apicid, int vector) {
+    lapicw(ICRHI, apicid << 24);
+    lapicw(ICRLO, FIXED | ASSERT | vector);
+    while (lapic[ICRLO] & DELIVS) asm volatile("pause");
+}
@@ -9,6 +9,7 @@
 #include <inc/x86.h>
 #include <inc/types.h>
 
+#include <kern/alloc.h>
 #include <kern/console.h>
 #include <kern/monitor.h>
 #include <kern/kdebug.h>
@@ -18,6 +19,7 @@
 #include <kern/pmap.h>
 #include <kern/trap.h>
 #include <kern/kclock.h>
+#include <kern/cpu.h>
 
 #define WHITESPACE "\t\r\n "
 #define MAXARGS    16
@@ -35,6 +37,15 @@ int mon_start(int argc, char **argv, struct Trapframe *tf);
 int mon_stop(int argc, char **argv, struct Trapframe *tf);
 int mon_frequency(int argc, char **argv, struct Trapframe *tf);
 int mon_memory(int argc, char **argv, struct Trapframe *tf);
+int mon_pagebench(int argc, char **argv, struct Trapframe *tf);
+int mon_kmallocbench(int argc, char **argv, struct Trapframe *tf);
+int mon_latency(int argc, char **argv, struct Trapframe *tf);
+int mon_ticks(int argc, char **argv, struct Trapframe *tf);
+int mon_thp(int argc, char **argv, struct Trapframe *tf);
+int mon_cowsplit(int argc, char **argv, struct Trapframe *tf);
+int mon_compact(int argc, char **argv, struct Trapframe *tf);
+int mon_ksm(int argc, char **argv, struct Trapframe *tf);
+int mon_swap(int argc, char **argv, struct Trapframe *tf);
 int mon_pagetable(int argc, char **argv, struct Trapframe *tf);
 int mon_virt(int argc, char **argv, struct Trapframe *tf);
 
@@ -59,6 +70,15 @@ static struct Command commands[] = {
         {"test_debug_info", "Test procedure of getting debug line info", mon_test_debug_info},
 
         {"memory", "Print memory lists", mon_memory},
+        {"pagebench", "Benchmark page allocator [iterations]", mon_pagebench},
+        {"kmallocbench", "Benchmark kernel object allocator [iterations]", mon_kmallocbench},
+        {"latency", "Show histogram of interrupt latency [reset]", mon_latency},
+        {"ticks", "Show scheduler ticks and wakeups from halt of each CPU [reset]", mon_ticks},
+        {"thp", "Promote populated 2M ranges of all environments to huge pages", mon_thp},
+        {"cowsplit", "Copy only 4K of shared huge pages on write [on|off]", mon_cowsplit},
+        {"compact", "Compact memory to recover free pages of given class [class]", mon_compact},
+        {"ksm", "Merge identical pages of all environments", mon_ksm},
+        {"swap", "Evict cold pages of all environments to swap [pages]", mon_swap},
 
         {"dumpcmos", "Print CMOS contents", mon_dumpcmos},
 
@@ -173,6 +193,107 @@ mon_dumpcmos(int argc, char **argv, struct Trapframe *tf) {
 int
 mon_memory(int argc, char **argv, struct Trapframe *tf) {
     dump_memory_lists();
+    dump_page_magazines();
+    dump_zero_pools();
+    dump_thp_stats();
+    dump_ksm_stats();
+    dump_swap_stats();
+    dump_space_pool_stats();
+    dump_kmalloc_stats();
+    dump_fault_around_stats();
+    return 0;
+}
+
+int
+mon_thp(int argc, char **argv, struct Trapframe *tf) {
+    promote_huge_pages(SIZE_MAX);
+    dump_thp_stats();
+    return 0;
+}
+
+int
+mon_cowsplit(int argc, char **argv, struct Trapframe *tf) {
+    if (argc > 1) {
+        if (!strcmp(argv[1], "on"))
+            cow_split_huge = 1;
+        else if (!strcmp(argv[1], "off"))
+            cow_split_huge = 0;
+        else {
+            cprintf("Usage: cowsplit [on|off]\n");
+            return 0;
+        }
+    }
+    cprintf("Copy-on-write huge page splitting is %s\n", cow_split_huge ? "on" : "off");
+    return 0;
+}
+
+int
+mon_ksm(int argc, char **argv, struct Trapframe *tf) {
+    /* Pages are only merged with pages seen by the previous pass */
+    merge_same_pages(SIZE_MAX);
+    merge_same_pages(SIZE_MAX);
+    dump_ksm_stats();
+    return 0;
+}
+
+int
+mon_swap(int argc, char **argv, struct Trapframe *tf) {
+    size_t count = argc > 1 ? strtol(argv[1], NULL, 0) : 256;
+    cprintf("Evicted %zu pages\n", swap_out_pages(count));
+    dump_swap_stats();
+    return 0;
+}
+
+int
+mon_compact(int argc, char **argv, struct Trapframe *tf) {
+    int class = argc > 1 ? strtol(argv[1], NULL, 0) : MAX_ALLOCATION_CLASS;
+    if (class < 0 || class >= MAX_CLASS) {
+        cprintf("Usage: compact [class]\n");
+        return 0;
+    }
+    cprintf("Freed %zu blocks of class %d\n", compact_memory(class, SIZE_MAX), class);
+    dump_memory_lists();
+    return 0;
+}
+
+int
+mon_pagebench(int argc, char **argv, struct Trapframe *tf) {
+    size_t iterations = argc > 1 ? strtol(argv[1], NULL, 0) : 100000;
+    bench_page_alloc(iterations);
+    return 0;
+}
+
+int
+mon_kmallocbench(int argc, char **argv, struct Trapframe *tf) {
+    size_t iterations = argc > 1 ? strtol(argv[1], NULL, 0) : 100000;
+    bench_kmalloc(iterations);
+    dump_kmalloc_stats();
+    return 0;
+}
+
+int
+mon_latency(int argc, char **argv, struct Trapframe *tf) {
+    if (argc > 1 && !strcmp(argv[1], "reset")) {
+        reset_irq_latency();
+        return 0;
+    }
+    dump_irq_latency();
+    return 0;
+}
+
+int
+mon_ticks(int argc, char **argv, struct Trapframe *tf) {
+    bool reset = argc > 1 && !strcmp(argv[1], "reset");
+
+    for (int i = 0; i < ncpu; i++) {
+        if (reset) {
+            cpus[i].cpu_ticks = cpus[i].cpu_wakeups = 0;
+            continue;
+        }
+        cprintf("CPU %d: %lu ticks, %lu wakeups, tick %s\n", i,
+                (unsigned long)cpus[i].cpu_ticks, (unsigned long)cpus[i].cpu_wakeups,
+                cpus[i].cpu_tick_stopped ? "stopped" : "running");
+    }
     return 0;
 }
 
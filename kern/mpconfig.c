@@ -0,0 +1,76 @@
+/* Search for and parse the multiprocessor configuration table
+ * (ACPI MADT lists local APICs of all processors) */
+
+#include <inc/types.h>
+#include <inc/stdio.h>
+#include <inc/string.h>
+#include <inc/memlayout.h>
+#include <inc/x86.h>
+#include <inc/mmu.h>
+#include <inc/env.h>
+#include <inc/assert.h>
+
+#include <kern/cpu.h>
+#include <kern/pmap.h>
+#include <kern/timer.h>
+#include <kern/traceopt.h>
+
+struct CpuInfo cpus[NCPU];
+int ncpu = 1;
+
+/* Per-CPU kernel stacks of application processors
+ * (bootstrap processor uses bootstack and pfstack) */
+unsigned char percpu_kstacks[NCPU - 1][KERN_STACK_SIZE] __attribute__((aligned(PAGE_SIZE)));
+unsigned char percpu_pfstacks[NCPU - 1][KERN_PF_STACK_SIZE] __attribute__((aligned(PAGE_SIZE)));
+
+/* Reads ID of local APIC of the bootstrap processor
+ * (it's in bits 24-31 of the initial APIC ID of CPUID leaf 1) */
+static uint8_t
+boot_apic_id(void) {
+    uint32_t ebx;
+    cpuid(1, NULL, &ebx, NULL, NULL);
+    return ebx >> 24;
+}
+
+/* Fills cpus[] with processors from MADT. The bootstrap
+ * processor is always CPU 0. Without the table (or with
+ * SMP disabled) only bootstrap processor is used */
+void
+mp_init(void) {
+    cpus[0].cpu_id = boot_apic_id();
+    cpus[0].cpu_status = CPU_STARTED;
+
+#ifndef CONFIG_KSPACE
+    MADT *madt = get_madt();
+    if (!madt) {
+        cprintf("SMP: no MADT found, using 1 CPU\n");
+        return;
+    }
+
+    lapicaddr = madt->LocalApicAddress;
+
+    for (uint8_t *ptr = madt->Entries; ptr < (uint8_t *)madt + madt->h.Length;) {
+        MADTEntry *entry = (MADTEntry *)ptr;
+        if (entry->Length < sizeof *entry) break;
+        ptr += entry->Length;
+
+        switch (entry->Type) {
+        case MADT_LOCAL_APIC: {
+            MADTLocalApic *lapic = (MADTLocalApic *)entry;
+            if (!(lapic->Flags & MADT_LAPIC_ENABLED) || lapic->ApicId == cpus[0].cpu_id) break;
+            if (ncpu == NCPU) {
+                cprintf("SMP: too many CPUs, CPU %d disabled\n", lapic->ApicId);
+                break;
+            }
+            cpus[ncpu++].cpu_id = lapic->ApicId;
+            break;
+        }
+        case MADT_LOCAL_APIC_OVERRIDE:
+            lapicaddr = ((MADTLocalApicOverride *)entry)->Address;
+            break;
+        }
+    }
+#endif
+
+    if (trace_init) cprintf("SMP: CPU %d found %d CPU(s)\n", cpus[0].cpu_id, ncpu);
+}
@@ -7,11 +7,15 @@
 #include <inc/uefi.h>
 #include <inc/x86.h>
 
+#include <kern/alloc.h>
+#include <kern/cpu.h>
 #include <kern/env.h>
 #include <kern/kclock.h>
 #include <kern/pmap.h>
+#include <kern/swap.h>
 #include <kern/traceopt.h>
 #include <kern/trap.h>
+#include <kern/tsc.h>
 
 /*
  * Term "page" used here does not
@@ -21,23 +25,143 @@
  * by struct Page
  */
 
-/* for O(1) page allocation */
-static struct List free_classes[MAX_CLASS];
+/* for O(1) page allocation
+ * Free lists are split by position of the page relative
+ * to BOOT_MEM_SIZE, so ALLOC_BOOTMEM requests never need
+ * to skip pages they cannot use */
+#define FREE_LOW  0
+#define FREE_HIGH 1
+static struct Page free_classes[2][MAX_CLASS];
+/* Summary bitmaps of non-empty free lists (bit N is for class N).
+ * Bits are set when page is appended to the list and are
+ * cleared lazily when alloc_page() finds list to be empty */
+static uint64_t free_class_mask[2];
+static_assert(MAX_CLASS <= 64, "Free class bitmap is too small");
+/* Per-CPU magazines of ready 4K and 2M pages.
+ * Pages stored here are detached from the free lists
+ * and hold a single reference owned by the magazine,
+ * so buddy merging never touches them */
+#define MAG_SIZE    32
+#define MAG_BATCH   (MAG_SIZE / 2)
+#define MAG_CLASSES 2
+#define MAG_INDEX(class) ((class) == 0 ? 0 : (class) == MAX_ALLOCATION_CLASS ? 1 : -1)
+struct PageMagazine {
+    size_t count;
+    struct Page *pages[MAG_SIZE];
+};
+static struct PageMagazine magazines[NCPU][MAG_CLASSES];
+static size_t mag_hits[MAG_CLASSES], mag_misses[MAG_CLASSES];
+/* Pools of already zeroed 4K and 2M pages used for
+ * zero-fill faults. They are filled during idle time
+ * and hold pages the same way magazines do */
+#define ZPOOL_SIZE 64
+static const size_t zpool_limit[MAG_CLASSES] = {ZPOOL_SIZE, 8};
+struct ZeroPool {
+    size_t count;
+    struct Page *pages[ZPOOL_SIZE];
+};
+static struct ZeroPool zero_pools[MAG_CLASSES];
+static size_t zpool_hits[MAG_CLASSES], zpool_misses[MAG_CLASSES];
+/* Amount of memory zeroed per idle loop iteration */
+#define ZPOOL_IDLE_BUDGET (2 * MB)
+/* Transparent huge page promotion scanner position and statistics */
+#define THP_SCAN_BUDGET 64
+static size_t thp_env_cursor;
+static uintptr_t thp_va_cursor;
+static size_t thp_scanned, thp_promoted;
+/* Same page merging scanner position, table of page hashes
+ * seen by scanner and statistics. Hash table is indexed
+ * by page content hash and keeps physical addresses,
+ * so stale entries are harmless */
+#define KSM_SCAN_BUDGET 64
+#define KSM_SLOTS       1024
+struct KsmSlot {
+    uint64_t hash;
+    physaddr_t addr;
+    size_t pass;
+};
+static struct KsmSlot ksm_slots[KSM_SLOTS];
+static size_t ksm_env_cursor, ksm_pass = 1;
+static uintptr_t ksm_va_cursor;
+static size_t ksm_scanned, ksm_merged;
+/* Copy only 4K of shared huge pages on write fault */
+bool cow_split_huge = 1;
+static size_t cow_splits;
+/* Blocks are compacted only if at most this part of them is used */
+#define COMPACT_MAX_USED(class) (CLASS_SIZE(class) / 2)
+/* Blocks compacted synchronously when huge allocation fails */
+#define COMPACT_SYNC_BLOCKS 2
+/* Class of failed huge allocation to compact memory for in background */
+static int compact_request;
+/* Statistics of the last compaction */
+static int compact_before = -1, compact_after = -1;
+static size_t compact_migrated, compact_freed;
+/* Swap scanner position and statistics.
+ * Huge pages are not swapped, so no new ones are
+ * created while some pages are in swap.
+ * After fault could not be served SWAP_RECLAIM_PAGES
+ * are evicted in background to make room in advance */
+#define SWAP_IDLE_PAGES    16
+#define SWAP_FAULT_PAGES   32
+#define SWAP_RECLAIM_PAGES 256
+static size_t swap_request;
+static size_t swap_env_cursor;
+static uintptr_t swap_va_cursor;
+static size_t swapped_pages, swap_outs, swap_ins;
+/* Pool of address spaces for env_alloc().
+ * Torn down (and prebuilt) spaces are ready to be adopted
+ * with kernel part of PML4 kept up to date */
+#define SPACE_POOL_SIZE  16
+#define SPACE_POOL_READY 8
+enum SpaceSlotState {
+    SPACE_SLOT_FREE,
+    SPACE_SLOT_READY,
+};
+static struct AddressSpace space_pool[SPACE_POOL_SIZE];
+static uint8_t space_pool_state[SPACE_POOL_SIZE];
+static size_t space_pool_hits, space_pool_misses;
+/* Address spaces of exited environments waiting for teardown.
+ * Teardown is done by teardown_spaces() in slices of bounded
+ * size between scheduling decisions: virtual tree is removed
+ * first and then user page tables, 2M entry at a time */
+struct DeadSpace {
+    struct AddressSpace space;
+    struct DeadSpace *next;
+    /* Next 2M entry of page tables to be freed */
+    size_t pt_cursor;
+};
+static struct DeadSpace *dead_head, *dead_tail;
+static size_t dead_count, teardown_queued, teardown_sync;
+static uint64_t teardown_max_cycles;
+/* Allocatable memory above BOOT_MEM_SIZE is not attached
+ * to the physical tree at boot. It is attached in DEFER_CHUNK
+ * pieces during idle time or when allocation fails */
+#define DEFER_MAX   64
+#define DEFER_CHUNK (1 * GB)
+struct MemoryRegion {
+    uintptr_t start, end;
+};
+static struct MemoryRegion deferred_regions[DEFER_MAX];
+static size_t deferred_count, deferred_size;
 /* List of descriptor pools */
 static struct PagePool *first_pool;
 /* List of free descriptors */
-static struct List free_descriptors;
-static size_t free_desc_count;
+static struct Page free_descriptors;
+static size_t free_desc_count, total_desc_count;
+/* Size of pointer-linked descriptor used before (for statistics) */
+#define PAGE_DESC_SIZE_PTR 64
 /* Physical memory size */
 size_t max_memory_map_addr;
 /* Kernel address space */
 struct AddressSpace kspace;
-/* Currently active address spcae */
-struct AddressSpace *current_space;
 /* Root node of physical memory tree */
 struct Page root;
 /* Top address for page pools mappings */
 static uintptr_t metaheaptop;
+/* Top address of descriptor pools metadata window */
+static uintptr_t metapooltop = KERN_META_BASE;
+/* Descriptor pool is being allocated */
+static bool allocating_pool;
 
 // TODO Test these properly via cpuid
 
@@ -46,9 +170,28 @@ static bool nx_supported = 1;
 /* 1GB pages are supported */
 static bool has_1gb_pages = 1;
 
+/* Global pages are supported and enabled */
+static bool pge_enabled;
+/* Process-context identifiers are supported and enabled */
+static bool pcid_enabled;
+/* Next PCID to assign and current PCID generation.
+ * When all PCIDs are used generation is incremented
+ * and every address space is assigned a new one */
+static uint16_t pcid_next = 1;
+static uint64_t pcid_generation = 1;
+
+#define PCID_COUNT  4096
+#define CR3_NOFLUSH (1ULL << 63)
+
+/* Ranges not smaller than this are invalidated with full TLB flush */
+#define TLB_FLUSH_THRESHOLD (2 * MB)
+
 /* Kernel executable end virtual address */
 extern char end[];
 extern char pfstacktop[], pfstack[];
+/* Stacks of application processors */
+extern unsigned char percpu_kstacks[NCPU - 1][KERN_STACK_SIZE];
+extern unsigned char percpu_pfstacks[NCPU - 1][KERN_PF_STACK_SIZE];
 
 /* Those are internal flags for map_page function */
 #define ALLOC_POOL 0x10000
@@ -59,6 +202,11 @@ extern char pfstacktop[], pfstack[];
 
 /* Descriptor pool page size */
 #define POOL_CLASS 1
+/* Size of pools mapped to metadata window */
+#define META_POOL_CLASS 4
+/* Descriptors kept free for mapping new pool
+ * (enough for splitting both physical and virtual trees) */
+#define POOL_RESERVE (8 * MAX_CLASS)
 
 #define LOOKUP_SPLIT    2
 #define LOOKUP_ALLOC    1
@@ -67,58 +215,114 @@ extern char pfstacktop[], pfstack[];
 #define PAGE_IS_FREE(p) (!(p)->refc && !(p)->left && !(p)->right)
 #define PAGE_IS_UNIQ(p) ((p)->refc == 1 && !(p)->left && !(p)->right)
 
-#define INIT_DESCR 256
+#define INIT_DESCR 512
 
 #define ABSDIFF(x, y) ((x) > (y) ? (x) - (y) : (y) - (x))
 
 #define assert_physical(n) ({ if (trace_memory_more) _assert_root(__FILE__, __LINE__, n, 1); assert(((n)->state & NODE_TYPE_MASK) >= PARTIAL_NODE); })
 #define assert_virtual(n)  ({if (trace_memory_more) _assert_root(__FILE__, __LINE__, n, 0); assert(((n)->state & NODE_TYPE_MASK) < PARTIAL_NODE); })
 
+/* Lists of descriptors are linked through their head members */
+
 inline static bool __attribute__((always_inline))
-list_empty(struct List *list) {
-    return list->next == list;
+list_empty(struct Page *list) {
+    return list->head.next == page_idx(list);
 }
 
 inline static void __attribute__((always_inline))
-list_init(struct List *list) {
-    list->next = list->prev = list;
+list_init(struct Page *list) {
+    list->head.next = list->head.prev = page_idx(list);
 }
 
 /*
  * Appends list element 'new' after list element 'list'
  */
 inline static void __attribute__((always_inline))
-list_append(struct List *list, struct List *new) {
+list_append(struct Page *list, struct Page *new) {
     // LAB 6: Your code here
-    new->next = list->next;
-    new->prev = list;
+    new->head.next = list->head.next;
+    new->head.prev = page_idx(list);
 
-    list->next->prev = new;
-    list->next = new;
+    page_ptr(list->head.next)->head.prev = page_idx(new);
+    list->head.next = page_idx(new);
 }
 
 /*
  * Deletes list element from list.
  * NOTE: Use list_init() on deleted List element
  */
-inline static struct List *__attribute__((always_inline))
-list_del(struct List *list) {
+inline static struct Page *__attribute__((always_inline))
+list_del(struct Page *list) {
     // LAB 6: Your code here.
-    list->next->prev = list->prev;
-    list->prev->next = list->next;
+    page_ptr(list->head.next)->head.prev = list->head.prev;
+    page_ptr(list->head.prev)->head.next = list->head.next;
     list_init(list);
     return list;
 }
 
 
+inline static int
+free_list_index(struct Page *page) {
+    return page2pa(page) >= BOOT_MEM_SIZE ? FREE_HIGH : FREE_LOW;
+}
+
+inline static struct Page *
+free_list_head(struct Page *page) {
+    return &free_classes[free_list_index(page)][page->class];
+}
+
+/* Appends free page to the appropriate free list */
+inline static void
+free_list_insert(struct Page *page) {
+    int idx = free_list_index(page);
+    list_append(&free_classes[idx][page->class], page);
+    free_class_mask[idx] |= 1ULL << page->class;
+}
+
+/*
+ * Returns first page from the smallest non-empty
+ * free list of class not smaller than requested
+ * (or NULL if there's no such list).
+ * The lookup is a bit scan over summary bitmap
+ * so it does not depend on memory fragmentation.
+ */
+static struct Page *
+free_list_find(int idx, int class) {
+    uint64_t mask = free_class_mask[idx] & ~((1ULL << class) - 1);
+    while (mask) {
+        int pclass = __builtin_ctzll(mask);
+        struct Page *list = &free_classes[idx][pclass];
+        if (!list_empty(list)) return page_ptr(list->head.next);
+
+        /* Drop stale bit of a list that became empty */
+        free_class_mask[idx] &= ~(1ULL << pclass);
+        mask &= mask - 1;
+    }
+    return NULL;
+}
+
 static struct Page *alloc_page(int class, int flags);
+static bool magazine_free(struct Page *page);
+static int largest_free_class(void);
+static bool alloc_meta_pool(void);
+static int build_address_space(struct AddressSpace *space);
+static pte_t *page_table_entry(struct AddressSpace *spc, uintptr_t va);
 
 void
 ensure_free_desc(size_t count) {
-    if (free_desc_count < count) {
-        struct Page *res = alloc_page(POOL_CLASS, ALLOC_POOL);
-        (void)res;
-        if (!res) panic("Out of memory\n");
+    /* New pool is allocated while there are still POOL_RESERVE
+     * descriptors left since mapping it consumes descriptors too */
+    if (free_desc_count < count + POOL_RESERVE && !allocating_pool) {
+        bool res;
+#ifndef SANITIZE_SHADOW_BASE
+        /* Shadow memory only covers boot memory, so KASAN
+         * builds always take pools from it */
+        if (current_space)
+            res = alloc_meta_pool();
+        else
+#endif
+            res = !!alloc_page(POOL_CLASS, ALLOC_POOL);
+        if (!res && free_desc_count < count) panic("Out of memory\n");
     }
 
     assert(free_desc_count >= count);
@@ -129,10 +333,10 @@ static struct Page *
 alloc_descriptor(enum PageState state) {
     ensure_free_desc(1);
 
-    struct Page *new = (struct Page *)list_del(free_descriptors.next);
+    struct Page *new = list_del(page_ptr(free_descriptors.head.next));
 
     memset(new, 0, sizeof *new);
-    list_init((struct List *)new);
+    list_init(new);
     new->state = state;
     free_desc_count--;
 
@@ -141,14 +345,73 @@ alloc_descriptor(enum PageState state) {
 
 static void
 free_descriptor(struct Page *page) {
-    list_del((struct List *)page);
-    list_append(&free_descriptors, (struct List *)page);
+    list_del(page);
+    list_append(&free_descriptors, page);
     free_desc_count++;
 }
 
+/*
+ * Reverse mapping.
+ * Every mapping node is linked into the list of its physical page,
+ * so no extra memory is needed even if there is a single mapping.
+ * Root of virtual tree stores offset of address space it belongs to.
+ */
+
+/* Allocates root of virtual tree for the address space */
+static struct Page *
+alloc_space_root(struct AddressSpace *spc) {
+    struct Page *root = alloc_descriptor(INTERMEDIATE_NODE);
+    intptr_t offset = (uintptr_t)spc - KERN_BASE_ADDR;
+    assert(offset && offset == (int32_t)offset);
+    root->space = offset;
+    return root;
+}
+
+/* Finds address space and virtual address of mapping node */
+struct AddressSpace *
+mapping_space(struct Page *mapping, uintptr_t *va) {
+    int class = page_phy(mapping)->class;
+    struct Page *node = mapping;
+    *va = 0;
+    for (struct Page *par; (par = page_parent(node)); node = par, class ++)
+        if (par->right == page_idx(node)) *va |= CLASS_SIZE(class);
+
+    assert(node->space);
+    return (struct AddressSpace *)(KERN_BASE_ADDR + node->space);
+}
+
+/* Environment owning the address space or NULL for
+ * spaces of exited environments and prebuilt ones */
+static struct Env *
+space_env(struct AddressSpace *spc) {
+    struct Env *env = (void *)((uint8_t *)spc - offsetof(struct Env, address_space));
+    return env >= envs && env < envs + NENV ? env : NULL;
+}
+
+/* Whether user code can be accessing the address space right now
+ * on other CPU, which doesn't hold the big kernel lock then.
+ * Memory of such space can't be copied and remapped in background,
+ * since writes and accessed/dirty bits set meanwhile would be lost */
+static bool
+space_busy(struct AddressSpace *spc) {
+    for (int i = 0; i < ncpu; i++)
+        if (i != cpunum() && cpus[i].cpu_space == spc) return 1;
+
+    struct Env *env = space_env(spc);
+    return env && env != curenv && env->env_status == ENV_RUNNING;
+}
+
+/* Number of virtual mappings of physical page */
+size_t
+page_mapcount(struct Page *page) {
+    size_t res = 0;
+    for (struct Page *m = page_ptr(page->head.next); m != page; m = page_ptr(m->head.next)) res++;
+    return res;
+}
+
 static void
 _assert_root(const char *file, int line, struct Page *p, bool phy) {
-    while (p->parent) p = p->parent;
+    while (p->parent) p = page_parent(p);
     if ((p == &root) != phy)
         _panic(file, line, "Page %p (phy %p) should%s be physical\n", p, (void *)PADDR(p), phy ? "" : "n't");
 }
@@ -157,8 +420,8 @@ static void
 free_desc_rec(struct Page *p) {
     while (p) {
         assert(!p->refc);
-        free_desc_rec(p->right);
-        struct Page *tmp = p->left;
+        free_desc_rec(page_right(p));
+        struct Page *tmp = page_left(p);
         free_descriptor(p);
         p = tmp;
     }
@@ -194,18 +457,17 @@ alloc_child(struct Page *parent, bool right) {
     new = alloc_descriptor(parent->state);
 
     if (right)
-        parent->right = new;
+        parent->right = page_idx(new);
     else
-        parent->left = new;
-    new->parent = parent;
+        parent->left = page_idx(new);
+    new->parent = page_idx(parent);
     new->refc = (parent->refc ? 1 : 0);
 
     new->class = parent->class - 1;
 
-    if (right)
-        new->addr = parent->addr + (CLASS_SIZE(new->class) >> CLASS_BASE);
-    else
-        new->addr = parent->addr;
+    /* Address is stored relative to the page size */
+    assert(parent->addr < (1U << 31));
+    new->addr = parent->addr * 2 + right;
 
     return new;
 }
@@ -233,19 +495,19 @@ page_lookup(struct Page *hint, uintptr_t addr, int class, enum PageState type, b
 
             if (was_free) {
                 /* Recalculate free lists for allocatable page */
-                struct Page *other = !right ? node->right : node->left;
+                struct Page *other = !right ? page_right(node) : page_left(node);
                 assert(other->state == ALLOCATABLE_NODE);
-                list_del((struct List *)node);
-                list_append(&free_classes[node->class - 1], (struct List *)other);
+                list_del(node);
+                free_list_insert(other);
             }
 
             if (type != PARTIAL_NODE && node->state != type)
                 node->state = PARTIAL_NODE;
         }
 
-        assert((node->left && node->right) || !alloc);
+        assert((page_left(node) && page_right(node)) || !alloc);
 
-        node = right ? node->right : node->left;
+        node = right ? page_right(node) : page_left(node);
     }
 
     if (alloc) assert(node);
@@ -254,14 +516,14 @@ page_lookup(struct Page *hint, uintptr_t addr, int class, enum PageState type, b
         assert(!node->refc);
 
         /* Need to free old subtree when retyping memory */
-        free_desc_rec(node->left);
-        free_desc_rec(node->right);
-        node->left = node->right = NULL;
-        list_del((struct List *)node);
+        free_desc_rec(page_left(node));
+        free_desc_rec(page_right(node));
+        node->left = node->right = 0;
+        list_del(node);
 
         /* We cannot change RESERVED_NODE memory to ALLOCATABLE_NODE */
         if (type != PARTIAL_NODE && node->state != RESERVED_NODE) node->state = type;
-        if (node->state == ALLOCATABLE_NODE) list_append(&free_classes[node->class], (struct List *)node);
+        if (node->state == ALLOCATABLE_NODE) free_list_insert(node);
 
         if (trace_memory) cprintf("Attaching page (%x) at %p class=%d\n", node->state, (void *)page2pa(node), (int)node->class);
     }
@@ -275,28 +537,28 @@ static void
 page_free(struct Page *page) {
     page->refc = 0;
     while (page != &root) {
-        struct Page *par = page->parent;
+        struct Page *par = page_parent(page);
         assert_physical(par);
         if (par->state == page->state &&
-            PAGE_IS_FREE(par->left) &&
-            PAGE_IS_FREE(par->right)) {
-            free_descriptor(par->left);
-            par->left = NULL;
+            PAGE_IS_FREE(page_left(par)) &&
+            PAGE_IS_FREE(page_right(par))) {
+            free_descriptor(page_left(par));
+            par->left = 0;
 
-            free_descriptor(par->right);
-            par->right = NULL;
+            free_descriptor(page_right(par));
+            par->right = 0;
 
             if (par->state == ALLOCATABLE_NODE) {
-                assert(list_empty((struct List *)par));
-                list_append(&free_classes[par->class], (struct List *)par);
+                assert(list_empty(par));
+                free_list_insert(par);
             }
             page = par;
         } else
             break;
     }
-    list_del((struct List *)page);
+    list_del(page);
     if (page->state == ALLOCATABLE_NODE)
-        list_append(&free_classes[page->class], (struct List *)page);
+        free_list_insert(page);
 }
 
 
@@ -309,16 +571,29 @@ page_ref(struct Page *node) {
      * so need to reference them recursively
      * when refc transitions from 0 to 1 */
     if (!node->refc++) {
-        list_del((struct List *)node);
-        list_init((struct List *)node);
-        page_ref(node->left);
-        page_ref(node->right);
+        list_del(node);
+        list_init(node);
+        page_ref(page_left(node));
+        page_ref(page_right(node));
     }
 }
 
 static void
 page_unref(struct Page *page) {
     if (!page) return;
+
+    /* Swapped out page is gone with its last mapping */
+    if (page->state == SWAP_NODE) {
+        assert(page->refc);
+        if (!--page->refc) {
+            assert(list_empty(page));
+            swap_free_slot(page->addr);
+            free_descriptor(page);
+            swapped_pages--;
+        }
+        return;
+    }
+
     assert_physical(page);
     assert(page->refc);
 
@@ -327,57 +602,65 @@ page_unref(struct Page *page) {
      * to prevent double frees */
 
     if (page->refc == 1) {
-        page_unref(page->left);
-        page_unref(page->right);
+        page_unref(page_left(page));
+        page_unref(page_right(page));
     }
 
     page->refc--;
 
     /* Try to merge free page with adjacent */
     if (PAGE_IS_FREE(page)) {
+#if SANITIZE_SHADOW_BASE
+        if (current_space) {
+            platform_asan_poison(KADDR(page2pa(page)), CLASS_SIZE(page->class));
+        }
+#endif
+        /* Keep page in the magazine if it is possible */
+        if (magazine_free(page)) return;
+
         while (page != &root) {
-            struct Page *par = page->parent;
+            struct Page *par = page_parent(page);
             assert_physical(par);
             if (par->state == page->state &&
-                PAGE_IS_FREE(par->left) &&
-                PAGE_IS_FREE(par->right)) {
-                free_descriptor(par->left);
-                par->left = NULL;
+                PAGE_IS_FREE(page_left(par)) &&
+                PAGE_IS_FREE(page_right(par))) {
+                free_descriptor(page_left(par));
+                par->left = 0;
 
-                free_descriptor(par->right);
-                par->right = NULL;
+                free_descriptor(page_right(par));
+                par->right = 0;
 
                 if (par->state == ALLOCATABLE_NODE) {
-                    assert(list_empty((struct List *)par));
-                    list_append(&free_classes[par->class], (struct List *)par);
+                    assert(list_empty(par));
+                    free_list_insert(par);
                 }
                 page = par;
             } else
                 break;
         }
-        list_del((struct List *)page);
+        list_del(page);
         if (page->state == ALLOCATABLE_NODE)
-            list_append(&free_classes[page->class], (struct List *)page);
-
-#if SANITIZE_SHADOW_BASE
-        if (current_space) {
-            platform_asan_poison(KADDR(page2pa(page)), CLASS_SIZE(page->class));
-        }
-#endif
+            free_list_insert(page);
     }
 }
 
 void
-alloc_virtual_child(struct Page *parent, struct Page **dst) {
+alloc_virtual_child(struct Page *parent, bool right) {
     assert_virtual(parent);
-    assert(parent->phy && parent->phy->left && parent->phy->right);
+    struct Page *phy = page_phy(parent);
+    assert(phy && phy->left && phy->right);
 
-    if ((*dst = alloc_descriptor(parent->state))) {
-        (*dst)->parent = parent;
-        (*dst)->phy = dst == &parent->left ? parent->phy->left : parent->phy->right;
-        page_ref((*dst)->phy);
-        list_append((struct List *)(*dst)->phy, (struct List *)(*dst));
+    struct Page *child = alloc_descriptor(parent->state);
+    if (child) {
+        child->parent = page_idx(parent);
+        child->phy = right ? phy->right : phy->left;
+        page_ref(page_phy(child));
+        list_append(page_phy(child), child);
     }
+    if (right)
+        parent->right = page_idx(child);
+    else
+        parent->left = page_idx(child);
 }
 
 /*
@@ -401,7 +684,7 @@ alloc_virtual_child(struct Page *parent, struct Page **dst) {
  */
 static void
 check_virtual_class(struct Page *node, int class) {
-    while (node->parent) class ++, node = node->parent;
+    while (node->parent) class ++, node = page_parent(node);
     assert(class == MAX_CLASS);
 }
 
@@ -418,7 +701,7 @@ page_lookup_virtual(struct Page *node, uintptr_t addr, int class, int alloc) {
         bool right = addr & CLASS_SIZE(nclass - 1);
 
 
-        struct Page **next = right ? &node->right : &node->left;
+        pageidx_t *next = right ? &node->right : &node->left;
 
         if (!*next) {
             if (!alloc) break;
@@ -427,35 +710,36 @@ page_lookup_virtual(struct Page *node, uintptr_t addr, int class, int alloc) {
 
             assert(nclass);
             if (node->phy) {
-                assert(nclass == node->phy->class);
+                assert(nclass == page_phy(node)->class);
                 assert((node->state & NODE_TYPE_MASK) == MAPPING_NODE);
 
-                struct Page *pleft = page_lookup(node->phy, page2pa(node->phy), node->phy->class - 1, PARTIAL_NODE, 1);
+                struct Page *pleft = page_lookup(page_phy(node), page2pa(page_phy(node)), page_phy(node)->class - 1, PARTIAL_NODE, 1);
                 if (!pleft) return NULL;
 
-                assert(node->phy->left && node->phy->right);
+                assert(page_left(page_phy(node)) && page_right(page_phy(node)));
 
-                alloc_virtual_child(node, &node->left);
+                alloc_virtual_child(node, 0);
                 if (!node->left) return NULL;
-                alloc_virtual_child(node, &node->right);
+                alloc_virtual_child(node, 1);
                 if (!node->right) return NULL;
 
-                list_del((struct List *)node);
-                page_unref(node->phy);
-                node->phy = NULL;
+                list_del(node);
+                page_unref(page_phy(node));
+                node->phy = 0;
                 node->state = INTERMEDIATE_NODE;
             } else {
                 assert(node->state == INTERMEDIATE_NODE);
-                *next = alloc_descriptor(INTERMEDIATE_NODE);
-                (*next)->parent = node;
+                struct Page *new = alloc_descriptor(INTERMEDIATE_NODE);
+                new->parent = page_idx(node);
+                *next = page_idx(new);
             }
             assert(*next);
         }
-        node = *next;
+        node = page_ptr(*next);
         nclass--;
     }
 
-    if (node && (alloc == LOOKUP_ALLOC || (alloc == LOOKUP_SPLIT && node->phy)) && trace_memory_more) {
+    if (node && (alloc == LOOKUP_ALLOC || (alloc == LOOKUP_SPLIT && page_phy(node))) && trace_memory_more) {
         check_virtual_class(node, class);
     }
 
@@ -485,6 +769,61 @@ attach_region(uintptr_t start, uintptr_t end, enum PageState type) {
     }
 }
 
+/* Adds region to the list of deferred memory */
+static bool
+defer_region(uintptr_t start, uintptr_t end) {
+    struct MemoryRegion *last = deferred_count ? &deferred_regions[deferred_count - 1] : NULL;
+    if (last && last->end == start) {
+        last->end = end;
+    } else {
+        if (deferred_count == DEFER_MAX) return 0;
+        deferred_regions[deferred_count++] = (struct MemoryRegion){start, end};
+    }
+    deferred_size += end - start;
+    return 1;
+}
+
+/*
+ * Attaches memory region from memory map.
+ * Only memory within BOOT_MEM_SIZE is attached right away,
+ * allocatable memory above it is deferred
+ */
+static void
+attach_boot_region(uintptr_t start, uintptr_t end, enum PageState type) {
+    if (type == ALLOCATABLE_NODE && end > BOOT_MEM_SIZE) {
+        uintptr_t mid = MAX(start, BOOT_MEM_SIZE);
+        if (defer_region(mid, end)) end = mid;
+    }
+    if (start < end) attach_region(start, end, type);
+}
+
+/*
+ * Attaches at least budget bytes of deferred memory
+ * (or everything that is left). Returns amount of attached memory
+ */
+static size_t
+attach_deferred_memory(size_t budget) {
+    /* Attaching allocates descriptors which might
+     * end up here again if there's no free memory */
+    static bool attaching;
+    if (attaching || !deferred_count) return 0;
+    attaching = 1;
+
+    size_t res = 0;
+    while (deferred_count && res < budget) {
+        struct MemoryRegion *reg = &deferred_regions[deferred_count - 1];
+        uintptr_t end = MIN(reg->end, ROUNDDOWN(reg->start, DEFER_CHUNK) + DEFER_CHUNK);
+        attach_region(reg->start, end, ALLOCATABLE_NODE);
+        res += end - reg->start;
+        if ((reg->start = end) == reg->end) deferred_count--;
+    }
+    deferred_size -= res;
+
+    attaching = 0;
+    if (!deferred_count && trace_init) boot_phase("deferred memory");
+    return res;
+}
+
 static void
 unmap_page_remove(struct Page *node) {
     if (!node) return;
@@ -493,37 +832,42 @@ unmap_page_remove(struct Page *node) {
     if (node->phy) {
         assert(!node->left && !node->right);
         assert((node->state & NODE_TYPE_MASK) == MAPPING_NODE);
-        page_unref(node->phy);
+        page_unref(page_phy(node));
     } else {
         assert((node->state & NODE_TYPE_MASK) == INTERMEDIATE_NODE);
-        unmap_page_remove(node->left);
-        unmap_page_remove(node->right);
+        unmap_page_remove(page_left(node));
+        unmap_page_remove(page_right(node));
     }
 
-    if (node->parent) {
-        *(node->parent->left == node ?
-                  &node->parent->left :
-                  &node->parent->right) = NULL;
+    struct Page *parent = page_parent(node);
+    if (parent) {
+        *(parent->left == page_idx(node) ?
+                  &parent->left :
+                  &parent->right) = 0;
     }
 
     free_descriptor(node);
 }
 
-static void
+/* Returns number of removed present entries */
+static size_t
 remove_pt(pte_t *pt, pte_t base, size_t step, uintptr_t i0, uintptr_t i1) {
     assert(step == 1 * GB || step == 2 * MB || step == 4 * KB || step == 512 * GB);
+    size_t res = 0;
     for (size_t i = i0; i < i1; i++) {
         if (!(pt[i] & PTE_P)) continue;
         assert(!(pt[i] & PTE_PS) || (step == 1 * GB || step == 2 * MB));
 
         if (!(pt[i] & PTE_PS) && step > 4 * KB) {
             pte_t *pt2 = KADDR(PTE_ADDR(pt[i]));
-            remove_pt(pt2, base, step / PT_ENTRY_COUNT, 0, PT_ENTRY_COUNT);
+            res += remove_pt(pt2, base, step / PT_ENTRY_COUNT, 0, PT_ENTRY_COUNT);
             page_unref(page_lookup(NULL, (uintptr_t)PADDR(pt2), 0, PARTIAL_NODE, 0));
         }
 
         pt[i] = 0;
+        res++;
     }
+    return res;
 }
 
 inline static pte_t
@@ -565,72 +909,91 @@ check_physical_tree(struct Page *page) {
     assert(page->class >= 0);
     assert(!(page2pa(page) & CLASS_MASK(page->class)));
     if (page->state == ALLOCATABLE_NODE || page->state == RESERVED_NODE) {
-        if (page->left) assert(page->left->state == page->state);
-        if (page->right) assert(page->right->state == page->state);
+        if (page->left) assert(page_left(page)->state == page->state);
+        if (page->right) assert(page_right(page)->state == page->state);
     }
     if (page->left) {
-        assert(page->left->class + 1 == page->class);
-        assert(page2pa(page) == page2pa(page->left));
+        assert(page_left(page)->class + 1 == page->class);
+        assert(page2pa(page) == page2pa(page_left(page)));
     }
     if (page->right) {
-        assert(page->right->class + 1 == page->class);
-        assert(page->addr + (1ULL << (page->class - 1)) == page->right->addr);
+        assert(page_right(page)->class + 1 == page->class);
+        assert(page->addr * 2 + 1 == page_right(page)->addr);
     }
     if (page->parent) {
-        assert(page->parent->class - 1 == page->class);
-        assert((page->parent->left == page) ^ (page->parent->right == page));
+        assert(page_parent(page)->class - 1 == page->class);
+        assert((page_left(page_parent(page)) == page) ^ (page_right(page_parent(page)) == page));
     } else {
         assert(page->class == MAX_CLASS);
         assert(page == &root);
     }
     if (!page->refc) {
         assert(page->head.next && page->head.prev);
-        if (!list_empty((struct List *)page)) {
-            for (struct List *n = page->head.next;
-                 n != &free_classes[page->class]; n = n->next) {
-                assert(n != &page->head);
+        if (!list_empty(page)) {
+            for (struct Page *n = page_ptr(page->head.next);
+                 n != free_list_head(page); n = page_ptr(n->head.next)) {
+                assert(n != page);
             }
         }
     } else {
-        for (struct List *n = (struct List *)page->head.next;
-             (struct List *)page != n; n = n->next) {
-            struct Page *v = (struct Page *)n;
+        for (struct Page *v = page_ptr(page->head.next);
+             page != v; v = page_ptr(v->head.next)) {
             assert_virtual(v);
-            assert(v->phy == page);
+            assert(page_phy(v) == page);
         }
     }
     if (page->left) {
-        assert(page->left->parent == page);
-        check_physical_tree(page->left);
+        assert(page_parent(page_left(page)) == page);
+        check_physical_tree(page_left(page));
     }
     if (page->right) {
-        assert(page->right->parent == page);
-        check_physical_tree(page->right);
+        assert(page_parent(page_right(page)) == page);
+        check_physical_tree(page_right(page));
     }
 }
 
+/*
+ * Checks that mapping can be found through reverse mapping of
+ * its physical page and that address space and virtual address
+ * found from it lead back to the same mapping
+ */
+static void
+check_rmap(struct Page *mapping) {
+    struct Page *phy = page_phy(mapping), *m = page_ptr(phy->head.next);
+    while (m != phy && m != mapping) m = page_ptr(m->head.next);
+    assert(m == mapping);
+    assert(page_mapcount(phy) <= phy->refc);
+
+    uintptr_t va;
+    struct AddressSpace *spc = mapping_space(mapping, &va);
+    assert(spc && spc->root);
+    assert(!(va & CLASS_MASK(phy->class)));
+    assert(page_lookup_virtual(spc->root, va, phy->class, LOOKUP_PRESERVE) == mapping);
+}
+
 static void
 check_virtual_tree(struct Page *page, int class) {
     assert(class >= 0);
     assert_virtual(page);
     if ((page->state & NODE_TYPE_MASK) == MAPPING_NODE) {
-        assert(page->phy);
+        assert(page_phy(page));
         assert(!(page->state & PROT_LAZY) || !(page->state & PROT_SHARE));
         assert(!page->left && !page->right);
-        assert(page->phy);
-        if (!(page->phy->class == class)) cprintf("%d %d\n", page->phy->class, class);
-        assert(page->phy->class == class);
+        assert(page_phy(page));
+        if (!(page_phy(page)->class == class)) cprintf("%d %d\n", page_phy(page)->class, class);
+        assert(page_phy(page)->class == class);
+        check_rmap(page);
     } else {
         assert(!page->phy);
         assert(page->state == INTERMEDIATE_NODE);
     }
     if (page->left) {
-        assert(page->left->parent == page);
-        check_virtual_tree(page->left, class - 1);
+        assert(page_parent(page_left(page)) == page);
+        check_virtual_tree(page_left(page), class - 1);
     }
     if (page->right) {
-        assert(page->right->parent == page);
-        check_virtual_tree(page->right, class - 1);
+        assert(page_parent(page_right(page)) == page);
+        check_virtual_tree(page_right(page), class - 1);
     }
 }
 
@@ -651,8 +1014,22 @@ dump_virtual_tree(struct Page *node, int class) {
         return;
     }
 
-    dump_virtual_tree(node->left, class + 1);
-    dump_virtual_tree(node->right, class + 1);
+    dump_virtual_tree(page_left(node), class + 1);
+    dump_virtual_tree(page_right(node), class + 1);
+}
+
+/* Total size of pages in free lists */
+static size_t
+free_memory_size(void) {
+    size_t res = 0;
+    for (int idx = FREE_LOW; idx <= FREE_HIGH; idx++) {
+        for (int class = 0; class < MAX_CLASS; class ++) {
+            struct Page *list = &free_classes[idx][class];
+            for (struct Page *page = page_ptr(list->head.next); page != list; page = page_ptr(page->head.next))
+                res += CLASS_SIZE(class);
+        }
+    }
+    return res;
 }
 
 void
@@ -662,19 +1039,18 @@ dump_memory_lists(void) {
     static const int ADDRES_PER_LINE = 4;
 
     for (int class = 0; class < MAX_CLASS; ++class) {
-        struct List *list = &free_classes[class];
-
         cprintf("Class[%d] size(%0llx) {", class, CLASS_SIZE(class));
 
         int i = 0;
-        for (struct List *cur_node = list->next; cur_node != list; cur_node = cur_node->next, ++i) {
-            if (i % ADDRES_PER_LINE == 0) {
-                cprintf("\n    ");
-            }
-
-            struct Page *page = (struct Page*) cur_node;
+        for (int idx = FREE_LOW; idx <= FREE_HIGH; idx++) {
+            struct Page *list = &free_classes[idx][class];
+            for (struct Page *page = page_ptr(list->head.next); page != list; page = page_ptr(page->head.next), ++i) {
+                if (i % ADDRES_PER_LINE == 0) {
+                    cprintf("\n    ");
+                }
 
-            cprintf("0x%08zx ", (uintptr_t) page->addr << CLASS_BASE);
+                cprintf("0x%08zx ", (uintptr_t)page2pa(page));
+            }
         }
 
         cprintf("\n}\n");
@@ -684,6 +1060,19 @@ dump_memory_lists(void) {
         }
     }
 
+    size_t used = total_desc_count - free_desc_count;
+    size_t gbs = MAX(ROUNDUP(max_memory_map_addr, GB) / GB, 1);
+    cprintf("Page descriptors: %zu used of %zu, %llu bytes each (%u with pointer links)\n",
+            used, total_desc_count, PAGE_DESC_SIZE, PAGE_DESC_SIZE_PTR);
+    cprintf("Metadata per GB of memory: %llu bytes (%llu with pointer links)\n",
+            used * PAGE_DESC_SIZE / gbs, (unsigned long long)used * PAGE_DESC_SIZE_PTR / gbs);
+    cprintf("Metadata window: %zuK of %lluM mapped\n",
+            (size_t)((metapooltop - KERN_META_BASE) / KB), KERN_META_SIZE / MB);
+    cprintf("Free memory: %zuM (%zuM not attached yet)\n",
+            (size_t)((free_memory_size() + deferred_size) / MB), (size_t)(deferred_size / MB));
+    cprintf("Largest free class: %d (%d before last compaction, %d after)\n",
+            largest_free_class(), compact_before, compact_after);
+    cprintf("Compaction: %zu pages migrated, %zu blocks freed\n", compact_migrated, compact_freed);
 }
 
 void
@@ -808,6 +1197,13 @@ propagate_pml4(struct AddressSpace *spc) {
         if (envs[i].env_status != ENV_FREE && &envs[i].address_space != spc)
             propagate_one_pml4(&envs[i].address_space, spc);
     }
+    for (size_t i = 0; i < SPACE_POOL_SIZE; i++) {
+        if (space_pool_state[i] != SPACE_SLOT_FREE && &space_pool[i] != spc)
+            propagate_one_pml4(&space_pool[i], spc);
+    }
+    for (struct DeadSpace *dead = dead_head; dead; dead = dead->next) {
+        if (&dead->space != spc) propagate_one_pml4(&dead->space, spc);
+    }
 }
 
 inline static int
@@ -863,12 +1259,81 @@ memcpy_page(struct AddressSpace *dst, uintptr_t va, struct Page *page) {
     switch_address_space(src);
 }
 
+/* Flush whole TLB including global entries of every PCID
+ * (toggling CR4.PGE does this) */
 static void
-tlb_invalidate_range(struct AddressSpace *spc, uintptr_t start, uintptr_t end) {
-    if (current_space == spc || !current_space) {
-        /* If we need to invalidate a lot of memory, just flush whole cache */
-        if (start - end > 512 * GB)
-            lcr3(rcr3());
+tlbflush_global(void) {
+    uint64_t cr4 = rcr4();
+    if (cr4 & CR4_PGE) {
+        lcr4(cr4 & ~CR4_PGE);
+        lcr4(cr4);
+    } else
+        tlbflush();
+}
+
+/* Make every address space get new PCID on next switch */
+static void
+pcid_new_generation(void) {
+    pcid_generation++;
+    pcid_next = 1;
+}
+
+/* Asks other CPUs that might have TLB entries for the range
+ * (ones running in spc, or all of them for kernel addresses)
+ * to invalidate it and waits until they are done. It's called
+ * with the big kernel lock held, so there is one request at a time */
+static void
+tlb_shootdown(struct AddressSpace *spc, uintptr_t start, uintptr_t end) {
+    bool kernel = start >= MAX_USER_ADDRESS;
+    struct CpuInfo *self = thiscpu;
+
+    for (struct CpuInfo *cpu = cpus; cpu < cpus + ncpu; cpu++) {
+        if (cpu == self || cpu->cpu_status == CPU_UNUSED) continue;
+        if (!kernel && cpu->cpu_space != spc) continue;
+
+        cpu->cpu_tlb_start = start;
+        cpu->cpu_tlb_end = end;
+        cpu->cpu_tlb_pending = 1;
+        lapic_ipi(cpu->cpu_id, IRQ_OFFSET + IRQ_TLB_SHOOTDOWN);
+    }
+
+    for (struct CpuInfo *cpu = cpus; cpu < cpus + ncpu; cpu++)
+        while (cpu->cpu_tlb_pending) asm volatile("pause");
+}
+
+/* Serves TLB shootdown request sent to this CPU, if any.
+ * Called from the interrupt handler and while waiting
+ * for the big kernel lock with interrupts disabled */
+void
+tlb_shootdown_poll(void) {
+    struct CpuInfo *cpu = thiscpu;
+    if (!cpu->cpu_tlb_pending) return;
+
+    uintptr_t start = cpu->cpu_tlb_start, end = cpu->cpu_tlb_end;
+    if (end - start >= TLB_FLUSH_THRESHOLD)
+        start >= MAX_USER_ADDRESS ? tlbflush_global() : tlbflush();
+    else
+        for (; start < end; start += PAGE_SIZE) invlpg((void *)start);
+
+    cpu->cpu_tlb_pending = 0;
+}
+
+static void
+do_tlb_invalidate_range(struct AddressSpace *spc, uintptr_t start, uintptr_t end) {
+    /* Upper part of address space is shared by all address spaces */
+    bool kernel = start >= MAX_USER_ADDRESS;
+    bool large = end - start >= TLB_FLUSH_THRESHOLD;
+
+    if (ncpu > 1) tlb_shootdown(spc, start, end);
+
+    if (current_space == spc || !current_space || kernel) {
+        /* If we need to invalidate a lot of memory, just flush whole cache
+         * (page tables might also have been freed in this case, so
+         *  UVPT mappings are also stale).
+         * Kernel mappings are global and survive CR3 reload,
+         * but invlpg invalidates global entries too */
+        if (large)
+            kernel ? tlbflush_global() : tlbflush();
         else {
             while (start < end) {
                 invlpg((void *)start);
@@ -876,6 +1341,64 @@ tlb_invalidate_range(struct AddressSpace *spc, uintptr_t start, uintptr_t end) {
             }
         }
     }
+
+    if (pcid_enabled) {
+        /* Inactive address spaces might still have TLB entries
+         * tagged with their PCIDs, so they need new ones.
+         * Global kernel entries are invalidated above, but paging
+         * structure caches are not global and invlpg drops them
+         * only for current PCID. Page tables can be split or freed
+         * only when the range is at least 2MB (see unmap_page()) */
+        if (kernel && (!pge_enabled || large))
+            pcid_new_generation();
+        else if (spc != current_space)
+            spc->pcid_gen = 0;
+    }
+}
+
+/* Invalidations of user mappings between tlb_batch_begin() and
+ * tlb_batch_end() are merged into a single range (per address space)
+ * and done at the end. Nothing should access user memory
+ * of the address space through its stale mappings in between */
+static int tlb_batch_depth;
+static struct AddressSpace *tlb_batch_space;
+static uintptr_t tlb_batch_start, tlb_batch_stop;
+
+static void
+tlb_batch_flush(void) {
+    struct AddressSpace *spc = tlb_batch_space;
+    if (!spc) return;
+    tlb_batch_space = NULL;
+    do_tlb_invalidate_range(spc, tlb_batch_start, tlb_batch_stop);
+}
+
+void
+tlb_batch_begin(void) {
+    tlb_batch_depth++;
+}
+
+void
+tlb_batch_end(void) {
+    assert(tlb_batch_depth > 0);
+    if (!--tlb_batch_depth) tlb_batch_flush();
+}
+
+static void
+tlb_invalidate_range(struct AddressSpace *spc, uintptr_t start, uintptr_t end) {
+    if (!tlb_batch_depth || start >= MAX_USER_ADDRESS) {
+        do_tlb_invalidate_range(spc, start, end);
+        return;
+    }
+
+    if (tlb_batch_space != spc) {
+        tlb_batch_flush();
+        tlb_batch_space = spc;
+        tlb_batch_start = start;
+        tlb_batch_stop = end;
+    } else {
+        tlb_batch_start = MIN(tlb_batch_start, start);
+        tlb_batch_stop = MAX(tlb_batch_stop, end);
+    }
 }
 
 static void
@@ -889,7 +1412,7 @@ unmap_page(struct AddressSpace *spc, uintptr_t addr, int class) {
     if (node) unmap_page_remove(node);
     /* Disallow root node deallocation */
     if (node == spc->root)
-        spc->root = alloc_descriptor(INTERMEDIATE_NODE);
+        spc->root = alloc_space_root(spc);
 
     uintptr_t end = addr + CLASS_SIZE(class);
     uintptr_t inval_start = addr, inval_end = end;
@@ -1006,11 +1529,14 @@ map_page(struct AddressSpace *spc, uintptr_t addr, struct Page *page, int flags)
         page_ref(page);
         unmap_page(spc, addr, page->class);
         struct Page *mapping = page_lookup_virtual(spc->root, addr, page->class, LOOKUP_ALLOC);
-        if (!mapping) return -E_NO_MEM;
+        if (!mapping) {
+            page_unref(page);
+            return -E_NO_MEM;
+        }
 
-        mapping->phy = page;
+        mapping->phy = page_idx(page);
         mapping->state = (PAGE_PROT(flags) & ~PROT_COMBINE) | MAPPING_NODE;
-        list_append((struct List *)page, (struct List *)mapping);
+        list_append(page, mapping);
     }
 
     if (trace_memory) cprintf("<%p> Mapping [%08lX, %08lX] to [%08lX, %08lX] (class=%d flags=%x)\n", spc,
@@ -1023,6 +1549,10 @@ map_page(struct AddressSpace *spc, uintptr_t addr, struct Page *page, int flags)
     uintptr_t base = page2pa(page) | prot2pte(flags);
     assert(!(page2pa(page) & CLASS_MASK(page->class)));
 
+    /* Kernel part of address space is the same for every
+     * address space, so its TLB entries can survive CR3 reloads */
+    if (spc == &kspace && addr >= MAX_USER_ADDRESS) base |= PTE_G;
+
     size_t pml4i0 = PML4_INDEX(addr), pml4i1 = PML4_INDEX(end);
     /* Fill PML4 range if page size is larger than 512GB */
     if (page->class >= 27) {
@@ -1124,34 +1654,48 @@ unmap_region(struct AddressSpace *dspace, uintptr_t dst, uintptr_t size) {
     }
 }
 
-/* Just allocate page, without mapping it */
+/* Puts descriptors of new pool to the free list */
+static void
+attach_pool(struct PagePool *pool, size_t size) {
+    size_t ndesc = POOL_ENTRIES_FOR_SIZE(size);
+    for (size_t i = 0; i < ndesc; i++)
+        list_append(&free_descriptors, &pool->data[i]);
+    pool->next = first_pool;
+    first_pool = pool;
+    free_desc_count += ndesc;
+    total_desc_count += ndesc;
+}
+
+/* Allocate page from the buddy tree */
 static struct Page *
-alloc_page(int class, int flags) {
-    struct List *li = NULL;
+buddy_alloc_page(int class, int flags) {
     struct Page *peer = NULL;
 
-    if (flags & ALLOC_POOL) flags |= ALLOC_BOOTMEM;
-#ifndef SANITIZE_SHADOW_BASE
-    if (current_space) flags &= ~ALLOC_BOOTMEM;
-#endif
-
     /* Find page that is not smaller than requested
-     * (Pool memory should also be within BOOT_MEM_SIZE) */
-    for (int pclass = class; pclass < MAX_CLASS; pclass++, li = NULL) {
-        for (li = free_classes[pclass].next; li != &free_classes[pclass]; li = li->next) {
-            peer = (struct Page *)li;
-            assert(peer->state == ALLOCATABLE_NODE);
-            assert_physical(peer);
-            if (!(flags & ALLOC_BOOTMEM) || page2pa(peer) + CLASS_SIZE(class) < BOOT_MEM_SIZE) goto found;
+     * (Pool memory should also be within BOOT_MEM_SIZE).
+     * Memory above BOOT_MEM_SIZE is preferred for ordinary
+     * allocations to keep boot memory for pools and page tables */
+    for (;;) {
+        peer = free_list_find(FREE_LOW, class);
+        if (!(flags & ALLOC_BOOTMEM)) {
+            struct Page *high = free_list_find(FREE_HIGH, class);
+            if (high && (!peer || high->class <= peer->class)) peer = high;
+        }
+        if (peer) break;
+
+        /* Deferred memory is above BOOT_MEM_SIZE */
+        if ((flags & ALLOC_BOOTMEM) || !attach_deferred_memory(DEFER_CHUNK)) {
+            /* Huge pages might be recovered by compaction */
+            if (class >= MAX_ALLOCATION_CLASS && !(flags & ALLOC_POOL))
+                compact_request = MAX(compact_request, class);
+            return NULL;
         }
     }
-    return NULL;
 
-found:
-    list_del(li);
+    assert(peer->state == ALLOCATABLE_NODE);
+    assert_physical(peer);
+    list_del(peer);
 
-    size_t ndesc = 0;
-    static bool allocating_pool;
     if (flags & ALLOC_POOL) {
         assert(!allocating_pool);
         allocating_pool = 1;
@@ -1161,14 +1705,11 @@ found:
         /* Need to unpoison early to initiallize lists inplace */
         if (current_space) platform_asan_unpoison(newpool, CLASS_SIZE(class));
 #endif
-        ndesc = POOL_ENTRIES_FOR_SIZE(CLASS_SIZE(class));
-        for (size_t i = 0; i < ndesc; i++)
-            list_append(&free_descriptors, (struct List *)&newpool->data[i]);
-        newpool->next = first_pool;
-        first_pool = newpool;
-        free_desc_count += ndesc;
-        if (trace_memory_more) cprintf("Allocated pool of size %zu at [%08lX, %08lX]\n",
-                                       ndesc, page2pa(peer), page2pa(peer) + (long)CLASS_MASK(class));
+        /* Descriptors should be reachable with 32-bit indices */
+        assert((uintptr_t)newpool + CLASS_SIZE(class) - KERN_BASE_ADDR <= (PAGE_DESC_SIZE << 31));
+        attach_pool(newpool, CLASS_SIZE(class));
+        if (trace_memory_more) cprintf("Allocated pool at [%08lX, %08lX]\n",
+                                       page2pa(peer), page2pa(peer) + (long)CLASS_MASK(class));
     }
 
     struct Page *new = page_lookup(peer, page2pa(peer), class, PARTIAL_NODE, 1);
@@ -1192,6 +1733,203 @@ found:
     return new;
 }
 
+/*
+ * Allocates descriptor pool from any physical memory
+ * and maps it to the metadata window of kernel address space.
+ * Descriptors of the reserve are used for mapping
+ */
+static bool
+alloc_meta_pool(void) {
+    size_t size = CLASS_SIZE(META_POOL_CLASS);
+    if (metapooltop + size > KERN_META_END) return 0;
+
+    assert(!allocating_pool);
+    allocating_pool = 1;
+
+    struct Page *page = alloc_page(META_POOL_CLASS, 0);
+    if (!page || map_page(&kspace, metapooltop, page, PROT_R | PROT_W) < 0) {
+        allocating_pool = 0;
+        return 0;
+    }
+
+    struct PagePool *newpool = (struct PagePool *)metapooltop;
+    metapooltop += size;
+    attach_pool(newpool, size);
+    newpool->peer = page;
+    if (trace_memory_more) cprintf("Allocated pool at [%08lX, %08lX] mapped to %p\n",
+                                   page2pa(page), page2pa(page) + (long)CLASS_MASK(page->class), newpool);
+
+    allocating_pool = 0;
+    return 1;
+}
+
+/*
+ * Takes page from the magazine of current CPU,
+ * refilling it with a batch of pages from the buddy tree
+ * if it is empty
+ */
+static struct Page *
+magazine_alloc(int class) {
+    int idx = MAG_INDEX(class);
+    struct PageMagazine *mag = &magazines[cpunum()][idx];
+
+    if (!mag->count) {
+        mag_misses[idx]++;
+        while (mag->count < MAG_BATCH) {
+            struct Page *page = buddy_alloc_page(class, 0);
+            if (!page) break;
+            page->refc = 1;
+            mag->pages[mag->count++] = page;
+        }
+        if (!mag->count) return NULL;
+    } else
+        mag_hits[idx]++;
+
+    struct Page *page = mag->pages[--mag->count];
+    assert(page->refc == 1 && !page->left && !page->right);
+    page->refc = 0;
+    return page;
+}
+
+/* Returns oldest pages of the magazine to the buddy tree */
+static void
+magazine_drain(struct PageMagazine *mag, size_t count) {
+    count = MIN(count, mag->count);
+    for (size_t i = 0; i < count; i++)
+        page_free(mag->pages[i]);
+    memmove(mag->pages, mag->pages + count, (mag->count - count) * sizeof *mag->pages);
+    mag->count -= count;
+}
+
+/*
+ * Puts just freed page into the magazine of current CPU
+ * (draining a batch if it is full).
+ * Returns 0 if page cannot be cached.
+ */
+static bool
+magazine_free(struct Page *page) {
+    int idx = MAG_INDEX(page->class);
+    if (idx < 0 || page->state != ALLOCATABLE_NODE) return 0;
+
+    struct PageMagazine *mag = &magazines[cpunum()][idx];
+    if (mag->count == MAG_SIZE) magazine_drain(mag, MAG_BATCH);
+
+    assert(list_empty(page));
+    page->refc = 1;
+    mag->pages[mag->count++] = page;
+    return 1;
+}
+
+/* Returns all cached pages to the buddy tree.
+ * Returns 0 if there were no cached pages */
+bool
+drain_page_magazines(void) {
+    bool drained = 0;
+    for (int cpu = 0; cpu < NCPU; cpu++) {
+        for (int i = 0; i < MAG_CLASSES; i++) {
+            drained |= magazines[cpu][i].count > 0;
+            magazine_drain(&magazines[cpu][i], MAG_SIZE);
+        }
+    }
+    return drained;
+}
+
+void
+dump_page_magazines(void) {
+    static const int classes[MAG_CLASSES] = {0, MAX_ALLOCATION_CLASS};
+    for (int i = 0; i < MAG_CLASSES; i++) {
+        size_t cached = 0;
+        for (int cpu = 0; cpu < NCPU; cpu++) cached += magazines[cpu][i].count;
+        cprintf("Magazine class %d: %zu cached, %zu hits, %zu misses\n",
+                classes[i], cached, mag_hits[i], mag_misses[i]);
+    }
+}
+
+/*
+ * Zeroes pages for zero pools until they are full
+ * or at most budget bytes were cleared.
+ * This is called when CPU has nothing else to do.
+ */
+static void
+zero_pool_fill(size_t budget) {
+    static const int classes[MAG_CLASSES] = {0, MAX_ALLOCATION_CLASS};
+    for (int i = 0; i < MAG_CLASSES; i++) {
+        struct ZeroPool *pool = &zero_pools[i];
+        while (pool->count < zpool_limit[i] && budget >= CLASS_SIZE(classes[i])) {
+            struct Page *page = alloc_page(classes[i], 0);
+            if (!page) break;
+            nosan_memset(KADDR(page2pa(page)), 0, CLASS_SIZE(classes[i]));
+            page->refc = 1;
+            pool->pages[pool->count++] = page;
+            budget -= CLASS_SIZE(classes[i]);
+        }
+    }
+}
+
+/* Takes already zeroed page of given class (or returns NULL) */
+static struct Page *
+zero_pool_get(int class) {
+    int idx = MAG_INDEX(class);
+    if (idx < 0) return NULL;
+
+    struct ZeroPool *pool = &zero_pools[idx];
+    if (!pool->count) {
+        zpool_misses[idx]++;
+        return NULL;
+    }
+    zpool_hits[idx]++;
+
+    struct Page *page = pool->pages[--pool->count];
+    assert(page->refc == 1 && !page->left && !page->right);
+    page->refc = 0;
+    return page;
+}
+
+void
+dump_zero_pools(void) {
+    static const int classes[MAG_CLASSES] = {0, MAX_ALLOCATION_CLASS};
+    for (int i = 0; i < MAG_CLASSES; i++) {
+        size_t total = zpool_hits[i] + zpool_misses[i];
+        cprintf("Zero pool class %d: %zu/%zu pages, %zu hits, %zu misses (%zu%% hit rate)\n",
+                classes[i], zero_pools[i].count, zpool_limit[i], zpool_hits[i], zpool_misses[i],
+                total ? zpool_hits[i] * 100 / total : 0);
+    }
+}
+
+
+/* Ordinary 4K and 2M allocations are served by per-CPU magazines */
+static struct Page *
+alloc_page_try(int class, int flags) {
+    if (!(flags & (ALLOC_POOL | ALLOC_BOOTMEM)) && MAG_INDEX(class) >= 0)
+        return magazine_alloc(class);
+    return buddy_alloc_page(class, flags);
+}
+
+/* Just allocate page, without mapping it */
+static struct Page *
+alloc_page(int class, int flags) {
+    if (flags & ALLOC_POOL) flags |= ALLOC_BOOTMEM;
+#ifndef SANITIZE_SHADOW_BASE
+    if (current_space) flags &= ~ALLOC_BOOTMEM;
+#endif
+
+    struct Page *page = alloc_page_try(class, flags);
+
+    /* Pages cached by magazines of all CPUs can't be merged
+     * into larger ones or used by other CPUs, so they
+     * are returned to the buddy tree before giving up */
+    if (!page && drain_page_magazines()) page = alloc_page_try(class, flags);
+
+    /* Huge pages are recovered by moving a few sparsely used
+     * blocks right away instead of waiting for idle time */
+    if (!page && class >= MAX_ALLOCATION_CLASS && current_space &&
+        !(flags & (ALLOC_POOL | ALLOC_BOOTMEM)) &&
+        compact_memory(class, COMPACT_SYNC_BLOCKS)) {
+        page = alloc_page_try(class, flags);
+    }
+    return page;
+}
+
 int
 region_maxref(struct AddressSpace *spc, uintptr_t addr, size_t size) {
     uintptr_t start = ROUNDDOWN(addr, PAGE_SIZE);
@@ -1200,8 +1938,8 @@ region_maxref(struct AddressSpace *spc, uintptr_t addr, size_t size) {
     while (start < end) {
         struct Page *page = page_lookup_virtual(spc->root, start, 0, LOOKUP_PRESERVE);
         if (page && page->phy) {
-            res = MAX(res, page->phy->refc + (page->phy->left || page->phy->right));
-            start += CLASS_SIZE(page->phy->class);
+            res = MAX(res, page_phy(page)->refc + (page_left(page_phy(page)) || page_right(page_phy(page))));
+            start += CLASS_SIZE(page_phy(page)->class);
         } else
             start += CLASS_SIZE(0);
     }
@@ -1283,51 +2021,811 @@ alloc_composite_page(struct AddressSpace *spc, uintptr_t addr, int class, int fl
     return res;
 }
 
-int
-force_alloc_page(struct AddressSpace *spc, uintptr_t va, int maxclass) {
-    int res = -E_FAULT;
-    /* FIXME We need to propagate kernel PML4E
-     * changes to every AddressSpace or just use KPTI
-     * (now it's ok since kernel does not map huge chunks of memory (>= 512GB)
-     * to higher part of address space after initiallization) */
+/*
+ * Checks that virtual subtree is completely covered by
+ * private mappings with equal protection. Protection
+ * is returned via prot (which should be -1 initially)
+ */
+static bool
+thp_check_subtree(struct Page *node, int *prot) {
+    if (!node) return 0;
+    if (!node->phy)
+        return thp_check_subtree(page_left(node), prot) &&
+               thp_check_subtree(page_right(node), prot);
+
+    /* Lazy mappings of unique pages are private as well
+     * (e.g. pieces of split copy-on-write huge page).
+     * Range with swapped out pages (SWAP_NODE) is not promoted */
+    int state = node->state & PROT_ALL & ~PROT_LAZY;
+    if (page_phy(node)->state != ALLOCATABLE_NODE || !PAGE_IS_UNIQ(page_phy(node))) return 0;
+    if (*prot >= 0 && *prot != state) return 0;
+    *prot = state;
+    return 1;
+}
 
-    static_assert(!(MAX_USER_ADDRESS & (HUGE_PAGE_SIZE * 512 * 512 - 1)), "MAX_USER_ADDRESS should be alligned on 512GiB");
+/* Copy contents of every leaf of virtual subtree to huge page at dst */
+static void
+thp_copy_subtree(struct Page *node, int class, uint8_t *dst) {
+    if (node->phy) {
+        nosan_memcpy(dst, KADDR(page2pa(page_phy(node))), CLASS_SIZE(class));
+    } else {
+        thp_copy_subtree(page_left(node), class - 1, dst);
+        thp_copy_subtree(page_right(node), class - 1, dst + CLASS_SIZE(class - 1));
+    }
+}
 
-    /* If we are working with kernel addresses
-     * kspace should be current */
-    struct AddressSpace *old = NULL;
-    assert(current_space);
-    old = switch_address_space(spc = (va > MAX_USER_ADDRESS ? &kspace : spc));
+/*
+ * Replaces 2M range populated by smaller
+ * pages with single huge page if possible.
+ * Memory of file system server is not promoted
+ * since its block cache relies on dirty bits,
+ * nor memory in use by other CPU (see space_busy())
+ */
+static bool
+thp_promote(struct AddressSpace *spc, uintptr_t va, struct Page *node) {
+    int prot = -1;
+    struct Env *env = space_env(spc);
+    if ((env && env->env_type == ENV_TYPE_FS) || space_busy(spc)) return 0;
+    if (page_phy(node) || !thp_check_subtree(node, &prot)) return 0;
 
+    struct Page *page = alloc_page(MAX_ALLOCATION_CLASS, 0);
+    if (!page) return 0;
 
-    /* Lookup page mapping such that it's class it not larger than MAX_ALLOCATION_CLASS */
-    struct Page *page;
-    if (!(page = page_lookup_virtual(spc->root, va, maxclass, LOOKUP_SPLIT))) goto fault;
-    if (!(page = page_lookup_virtual(spc->root, va, 0, LOOKUP_PRESERVE))) goto fault;
-    if (!(page->state & PROT_LAZY)) goto fault;
+    thp_copy_subtree(node, MAX_ALLOCATION_CLASS, KADDR(page2pa(page)));
 
-    va &= ~CLASS_MASK(page->phy->class);
+    /* Reference is held, so that page is freed if it can't be mapped */
+    page_ref(page);
+    int res = map_page(spc, va, page, prot);
+    page_unref(page);
+    if (res < 0) return 0;
+
+    if (trace_memory) cprintf("<%p> Promoted [%08lX, %08lX] to huge page\n",
+                              spc, va, va + (long)CLASS_MASK(MAX_ALLOCATION_CLASS));
+    thp_promoted++;
+    return 1;
+}
+
+/*
+ * Walks virtual tree starting from thp_va_cursor and
+ * tries to promote every 2M range. Returns 1 if budget
+ * was exhausted before the whole tree was scanned.
+ */
+static bool
+thp_scan(struct AddressSpace *spc, struct Page *node, int class, uintptr_t va, size_t *budget) {
+    if (!node || va + CLASS_SIZE(class) <= thp_va_cursor) return 0;
+    if (!*budget) return 1;
+
+    if (class == MAX_ALLOCATION_CLASS || page_phy(node)) {
+        thp_va_cursor = va + CLASS_SIZE(class);
+        if (class == MAX_ALLOCATION_CLASS) {
+            (*budget)--;
+            thp_scanned++;
+            thp_promote(spc, va, node);
+        }
+        return 0;
+    }
+
+    if (thp_scan(spc, page_left(node), class - 1, va, budget)) return 1;
+    return thp_scan(spc, page_right(node), class - 1, va + CLASS_SIZE(class - 1), budget);
+}
+
+/*
+ * Scan user address spaces for densely populated
+ * 2M regions and remap them with huge pages.
+ * At most budget regions are examined per call,
+ * the next call continues from where previous one stopped.
+ */
+void
+promote_huge_pages(size_t budget) {
+    for (size_t n = 0; n < NENV && budget; n++) {
+        struct Env *env = &envs[thp_env_cursor];
+        if (env->env_status != ENV_FREE && env->env_status != ENV_DYING && env->address_space.root) {
+            if (thp_scan(&env->address_space, env->address_space.root, MAX_CLASS, 0, &budget)) return;
+        }
+        thp_env_cursor = (thp_env_cursor + 1) % NENV;
+        thp_va_cursor = 0;
+    }
+}
+
+void
+dump_thp_stats(void) {
+    cprintf("Huge page promotion: %zu ranges scanned, %zu promoted\n", thp_scanned, thp_promoted);
+    cprintf("Copy-on-write huge page splitting is %s: %zu pages split\n",
+            cow_split_huge ? "on" : "off", cow_splits);
+}
+
+/* Largest class of free page (or -1 if there's no free memory) */
+static int
+largest_free_class(void) {
+    for (int class = MAX_CLASS - 1; class >= 0; class --)
+        if (!list_empty(&free_classes[FREE_LOW][class]) ||
+            !list_empty(&free_classes[FREE_HIGH][class])) return class;
+    return -1;
+}
+
+/*
+ * Page can be migrated if it is a 4K page referenced
+ * only by mappings of user address spaces which are
+ * not in use by other CPUs (see space_busy())
+ */
+static bool
+page_movable(struct Page *page) {
+    if (page->class || page->left || page->right) return 0;
+
+    for (struct Page *m = page_ptr(page->head.next); m != page; m = page_ptr(m->head.next)) {
+        uintptr_t va;
+        struct AddressSpace *spc = mapping_space(m, &va);
+        if (spc == &kspace || va >= MAX_USER_ADDRESS || space_busy(spc)) return 0;
+    }
+    return page->refc && page_mapcount(page) == page->refc;
+}
+
+/*
+ * Counts used memory of the block.
+ * Returns 0 if it contains pages that cannot be migrated
+ */
+static bool
+compact_scan(struct Page *node, size_t *used) {
+    if (!node || PAGE_IS_FREE(node)) return 1;
+    if (node->refc) {
+        *used += CLASS_SIZE(node->class);
+        return page_movable(node);
+    }
+    return compact_scan(page_left(node), used) &&
+           compact_scan(page_right(node), used);
+}
+
+/* Finds the least used block of given class that can be compacted */
+static struct Page *
+compact_find(struct Page *node, int class, size_t *best) {
+    if (!node || node->state == RESERVED_NODE || PAGE_IS_FREE(node)) return NULL;
+    if (node->class == class) {
+        size_t used = 0;
+        if (node->state != ALLOCATABLE_NODE || node->refc ||
+            !compact_scan(node, &used) || !used || used >= *best) return NULL;
+        *best = used;
+        return node;
+    }
+
+    struct Page *left = compact_find(page_left(node), class, best);
+    struct Page *right = compact_find(page_right(node), class, best);
+    return right ? right : left;
+}
+
+/* Moves page to the new place and remaps all its mappings */
+static void
+migrate_page(struct Page *page, struct Page *new) {
+    nosan_memcpy(KADDR(page2pa(new)), KADDR(page2pa(page)), CLASS_SIZE(page->class));
+
+    /* Mappings are removed from the list
+     * when they are replaced with new ones */
+    while (!list_empty(page)) {
+        struct Page *mapping = page_ptr(page->head.next);
+        uintptr_t va;
+        struct AddressSpace *spc = mapping_space(mapping, &va);
+        /* Dirty bit is carried over, file system
+         * server writes back only dirty blocks */
+        pte_t *pte = page_table_entry(spc, va);
+        bool dirty = pte && *pte & PTE_D;
+        int res = map_page(spc, va, new, PAGE_PROT(mapping->state));
+        if (res < 0) panic("migrate_page: %i\n", res);
+        if (dirty && (pte = page_table_entry(spc, va))) *pte |= PTE_D;
+    }
+    compact_migrated++;
+}
+
+/*
+ * Migrates pages out of the block, all allocated
+ * pages that are within the block are linked into rejects.
+ * Returns 0 if there's not enough memory elsewhere
+ */
+static bool
+compact_block(struct Page *block, struct Page *node, struct Page *rejects) {
+    if (!node || PAGE_IS_FREE(node)) return 1;
+    if (!node->refc)
+        return compact_block(block, page_left(node), rejects) &&
+               compact_block(block, page_right(node), rejects);
+
+    physaddr_t start = page2pa(block), end = start + CLASS_SIZE(block->class);
+    for (;;) {
+        struct Page *new = buddy_alloc_page(node->class, 0);
+        if (!new) return 0;
+        page_ref(new);
+        if (page2pa(new) < start || page2pa(new) >= end) {
+            migrate_page(node, new);
+            page_unref(new);
+            return 1;
+        }
+        list_append(rejects, new);
+    }
+}
+
+/*
+ * Recovers free pages of given class by moving
+ * pages of user environments out of sparsely used blocks.
+ * At most max_blocks blocks are processed.
+ * Returns number of freed blocks.
+ */
+size_t
+compact_memory(int class, size_t max_blocks) {
+    assert(class >= 0 && class < MAX_CLASS);
+    compact_before = largest_free_class();
+
+    /* Pages moved out of one block might end up in
+     * another one, so limit number of iterations */
+    max_blocks = MIN(max_blocks, (max_memory_map_addr >> (class + CLASS_BASE)) + 1);
+
+    /* Cached pages are not movable, so return them to the buddy tree */
+    drain_page_magazines();
+    for (int i = 0; i < MAG_CLASSES; i++) {
+        while (zero_pools[i].count)
+            page_free(zero_pools[i].pages[--zero_pools[i].count]);
+    }
+
+    size_t freed = 0;
+    while (freed < max_blocks) {
+        size_t best = COMPACT_MAX_USED(class) + 1;
+        struct Page *block = compact_find(&root, class, &best);
+        if (!block) break;
+
+        /* List head should be reachable with 32-bit links,
+         * so it can't be on the stack */
+        static struct Page rejects;
+        list_init(&rejects);
+        bool res = compact_block(block, block, &rejects);
+        while (!list_empty(&rejects)) page_unref(list_del(page_ptr(rejects.head.next)));
+        drain_page_magazines();
+
+        if (!res) break;
+        freed++;
+    }
+
+    compact_freed += freed;
+    compact_after = largest_free_class();
+    return freed;
+}
+
+/* Page can be merged if it is private to user address spaces
+ * and is not shared. Pages of file system server are never
+ * merged since its block cache relies on dirty bits */
+static bool
+ksm_mergeable(struct Page *page) {
+    if (page->state != ALLOCATABLE_NODE || !page_movable(page)) return 0;
+    for (struct Page *m = page_ptr(page->head.next); m != page; m = page_ptr(m->head.next)) {
+        uintptr_t va;
+        struct Env *env = space_env(mapping_space(m, &va));
+        if (m->state & PROT_SHARE || (env && env->env_type == ENV_TYPE_FS)) return 0;
+    }
+    return 1;
+}
+
+static uint64_t
+ksm_hash(struct Page *page) {
+    /* FNV-1a over 64-bit words */
+    uint64_t *data = KADDR(page2pa(page)), hash = 0xCBF29CE484222325ULL;
+    for (size_t i = 0; i < CLASS_SIZE(0) / sizeof *data; i++)
+        hash = (hash ^ data[i]) * 0x100000001B3ULL;
+    return hash;
+}
+
+/* Remaps every mapping of page to target as copy-on-write */
+static void
+ksm_remap(struct Page *page, struct Page *target) {
+    /* New mappings are inserted at the list head, so they are not visited */
+    for (struct Page *m = page_ptr(page->head.next), *next; m != page; m = next) {
+        next = page_ptr(m->head.next);
+        if (page == target && (m->state & PROT_LAZY)) continue;
+
+        uintptr_t va;
+        struct AddressSpace *spc = mapping_space(m, &va);
+        int res = map_page(spc, va, target, PAGE_PROT(m->state) | PROT_LAZY);
+        if (res < 0) panic("ksm_remap: %i\n", res);
+    }
+}
+
+/*
+ * Merges page with identical one found by the previous
+ * scanner pass or remembers its hash
+ */
+static void
+ksm_page(struct Page *page) {
+    if (!ksm_mergeable(page)) return;
+    ksm_scanned++;
+
+    uint64_t hash = ksm_hash(page);
+    struct KsmSlot *slot = &ksm_slots[hash % KSM_SLOTS];
+    if (slot->hash == hash && slot->pass < ksm_pass && slot->addr != page2pa(page)) {
+        struct Page *other = page_lookup(NULL, slot->addr, 0, PARTIAL_NODE, 0);
+        if (other && !other->class && ksm_mergeable(other) &&
+            !memcmp(KADDR(page2pa(other)), KADDR(page2pa(page)), CLASS_SIZE(0))) {
+            ksm_remap(other, other);
+            ksm_remap(page, other);
+            ksm_merged++;
+            return;
+        }
+    }
+
+    slot->hash = hash;
+    slot->addr = page2pa(page);
+    slot->pass = ksm_pass;
+}
+
+/* Scan virtual tree for 4K pages starting from ksm_va_cursor */
+static bool
+ksm_scan(struct Page *node, int class, uintptr_t va, size_t *budget) {
+    if (!node || va + CLASS_SIZE(class) <= ksm_va_cursor) return 0;
+    if (!*budget) return 1;
+
+    if (page_phy(node)) {
+        ksm_va_cursor = va + CLASS_SIZE(class);
+        if (!class) {
+            (*budget)--;
+            /* Node is freed if page is merged */
+            ksm_page(page_phy(node));
+        }
+        return 0;
+    }
+
+    if (ksm_scan(page_left(node), class - 1, va, budget)) return 1;
+    return ksm_scan(page_right(node), class - 1, va + CLASS_SIZE(class - 1), budget);
+}
+
+/*
+ * Scan user address spaces for identical 4K pages
+ * and merge them into single copy-on-write page.
+ * Only pages that have been seen by the previous pass
+ * are merged with, so frequently changed pages are not.
+ * At most budget pages are examined per call,
+ * the next call continues from where previous one stopped.
+ */
+void
+merge_same_pages(size_t budget) {
+    for (size_t n = 0; n < NENV && budget; n++) {
+        struct Env *env = &envs[ksm_env_cursor];
+        if (env->env_status != ENV_FREE && env->env_status != ENV_DYING && env->address_space.root) {
+            if (ksm_scan(env->address_space.root, MAX_CLASS, 0, &budget)) return;
+        }
+        if (!(ksm_env_cursor = (ksm_env_cursor + 1) % NENV)) ksm_pass++;
+        ksm_va_cursor = 0;
+    }
+}
+
+void
+dump_ksm_stats(void) {
+    cprintf("Same page merging: %zu passes, %zu pages scanned, %zu merged\n",
+            ksm_pass - 1, ksm_scanned, ksm_merged);
+}
+
+/*
+ * Swap.
+ * Cold 4K pages of user environments are written to the swap
+ * partition. Every mapping of evicted page is moved to the
+ * swap node descriptor (which keeps slot number in addr and
+ * links mappings just like physical page does) and its page
+ * table entry is cleared, so the next access faults and
+ * the page is read back by force_alloc_page().
+ * Pages are aged with clock algorithm: accessed bits are
+ * cleared by the scanner and the page is evicted only if
+ * none of them has been set again by the next visit.
+ */
+
+/* Returns present 4K page table entry of va or NULL */
+static pte_t *
+page_table_entry(struct AddressSpace *spc, uintptr_t va) {
+    if (!(spc->pml4[PML4_INDEX(va)] & PTE_P)) return NULL;
+    pdpe_t *pdp = KADDR(PTE_ADDR(spc->pml4[PML4_INDEX(va)]));
+    if ((pdp[PDP_INDEX(va)] & (PTE_P | PTE_PS)) != PTE_P) return NULL;
+    pde_t *pd = KADDR(PTE_ADDR(pdp[PDP_INDEX(va)]));
+    if ((pd[PD_INDEX(va)] & (PTE_P | PTE_PS)) != PTE_P) return NULL;
+    pte_t *pt = KADDR(PTE_ADDR(pd[PD_INDEX(va)]));
+    return pt[PT_INDEX(va)] & PTE_P ? &pt[PT_INDEX(va)] : NULL;
+}
+
+/* Page can be evicted if it is private to user address spaces.
+ * Pages of file system server are never evicted since
+ * its block cache relies on present and dirty bits
+ * (ksm_mergeable() excludes them) */
+static bool
+swap_evictable(struct Page *page) {
+    return ksm_mergeable(page);
+}
+
+/* Tests and clears accessed bits of every mapping of the page */
+static bool
+page_referenced(struct Page *page) {
+    bool res = 0;
+    for (struct Page *m = page_ptr(page->head.next); m != page; m = page_ptr(m->head.next)) {
+        uintptr_t va;
+        struct AddressSpace *spc = mapping_space(m, &va);
+        pte_t *pte = page_table_entry(spc, va);
+        if (pte && *pte & PTE_A) {
+            *pte &= ~PTE_A;
+            res = 1;
+        }
+    }
+    return res;
+}
+
+/* Writes page to swap and moves all its mappings to swap node */
+static bool
+swap_out_page(struct Page *page) {
+    uint32_t slot;
+    if (swap_alloc_slot(&slot) < 0) return 0;
+    if (swap_write(slot, KADDR(page2pa(page))) < 0) {
+        swap_free_slot(slot);
+        return 0;
+    }
+
+    struct Page *swp = alloc_descriptor(SWAP_NODE);
+    swp->addr = slot;
+    swp->refc = page->refc;
+
+    while (!list_empty(page)) {
+        struct Page *mapping = list_del(page_ptr(page->head.next));
+        uintptr_t va;
+        struct AddressSpace *spc = mapping_space(mapping, &va);
+        pte_t *pte = page_table_entry(spc, va);
+        if (pte) *pte = 0;
+        tlb_invalidate_range(spc, va, va + PAGE_SIZE);
+        mapping->phy = page_idx(swp);
+        list_append(swp, mapping);
+    }
+
+    /* Every reference was held by a mapping */
+    page->refc = 1;
+    page_unref(page);
+
+    swapped_pages++;
+    swap_outs++;
+    return 1;
+}
+
+/* Reads page back from swap and remaps all mappings of swap node to it */
+static int
+swap_in_page(struct Page *swp) {
+    struct Page *page = alloc_page(0, 0);
+    if (!page) return -E_NO_MEM;
+    page_ref(page);
+
+    int res = swap_read(swp->addr, KADDR(page2pa(page)));
+
+    /* Swap node is freed when the last mapping is replaced */
+    page_ref(swp);
+    while (!res && !list_empty(swp)) {
+        struct Page *mapping = page_ptr(swp->head.next);
+        uintptr_t va;
+        struct AddressSpace *spc = mapping_space(mapping, &va);
+        res = map_page(spc, va, page, PAGE_PROT(mapping->state));
+    }
+    page_unref(swp);
+    page_unref(page);
+
+    if (!res) swap_ins++;
+    return res;
+}
+
+/* Scans virtual tree for 4K pages starting from swap_va_cursor.
+ * Returns 1 if enough pages are evicted */
+static bool
+swap_scan(struct Page *node, int class, uintptr_t va, size_t *count) {
+    if (!node || va + CLASS_SIZE(class) <= swap_va_cursor) return 0;
+    if (!*count) return 1;
+
+    if (page_phy(node)) {
+        swap_va_cursor = va + CLASS_SIZE(class);
+        struct Page *page = page_phy(node);
+        if (!class && swap_evictable(page) && !page_referenced(page) && swap_out_page(page))
+            (*count)--;
+        return 0;
+    }
+
+    if (swap_scan(page_left(node), class - 1, va, count)) return 1;
+    return swap_scan(page_right(node), class - 1, va + CLASS_SIZE(class - 1), count);
+}
+
+/*
+ * Evicts up to count cold pages of user environments to swap.
+ * Every page is visited at most twice, since its accessed
+ * bits are cleared by the first visit.
+ * Returns number of evicted pages.
+ */
+size_t
+swap_out_pages(size_t count) {
+    if (!swap_enabled()) return 0;
+
+    size_t left = count;
+    for (size_t n = 0; n <= 2 * NENV && left; n++) {
+        struct Env *env = &envs[swap_env_cursor];
+        if (env->env_status != ENV_FREE && env->env_status != ENV_DYING &&
+            env->env_type != ENV_TYPE_FS && env->address_space.root) {
+            if (swap_scan(env->address_space.root, MAX_CLASS, 0, &left)) break;
+        }
+        swap_env_cursor = (swap_env_cursor + 1) % NENV;
+        swap_va_cursor = 0;
+    }
+    return count - left;
+}
+
+void
+dump_swap_stats(void) {
+    size_t used, total;
+    swap_usage(&used, &total);
+    cprintf("Swap: %zuK used of %zuK, %zu pages evicted, %zu read back\n",
+            (size_t)(used * PAGE_SIZE / KB), (size_t)(total * PAGE_SIZE / KB), swap_outs, swap_ins);
+}
+
+/* Moves page tables and virtual tree of the space */
+static void
+space_move(struct AddressSpace *dst, struct AddressSpace *src) {
+    dst->pml4 = src->pml4;
+    dst->cr3 = src->cr3;
+    dst->root = src->root;
+    intptr_t offset = (uintptr_t)dst - KERN_BASE_ADDR;
+    assert(offset && offset == (int32_t)offset);
+    dst->root->space = offset;
+    /* TLB might still hold entries of previous owner */
+    dst->pcid_gen = 0;
+    dst->fault_next = 0;
+    dst->fault_window = 0;
+}
+
+/* Frees the space with its page tables and references to kernel ones.
+ * Space is not current for any CPU, so its TLB entries are flushed
+ * when its PCID is reused and PTEs are not cleared before freeing */
+static void
+destroy_address_space(struct AddressSpace *space) {
+    /* Manually unref level 3 kernel page tables */
+    for (size_t i = NUSERPML4; i < PML4_ENTRY_COUNT; i++) {
+        if (kspace.pml4[i] & PTE_P && i != UVPT_INDEX)
+            page_unref(page_lookup(NULL, PTE_ADDR(kspace.pml4[i]), 0, PARTIAL_NODE, 0));
+    }
+
+    /* Unmap all memory from the space
+     * (kernel is cheating and does not store
+     *  metadata for upper part of address space (privileged)
+     *  in tree and only in page tables for user address spaces,
+     *  so unmapping is safe) */
+    unmap_page_remove(space->root);
+    remove_pt(space->pml4, 0, 512 * GB, 0, NUSERPML4);
+
+    /* Also unmap PML4 itself since it is never deallocated by page_uname*/
+    page_unref(page_lookup(NULL, space->cr3, 0, PARTIAL_NODE, 0));
+}
+
+/* Removes up to budget nodes of the subtree,
+ * node itself is freed once it has no children
+ * (unless it is the root). Returns amount of work done */
+static size_t
+teardown_subtree(struct Page *node, size_t budget) {
+    size_t done = 0;
+    for (struct Page *child; done < budget && (child = page_left(node) ? page_left(node) : page_right(node));) {
+        if (child->phy) {
+            unmap_page_remove(child);
+            done++;
+        } else
+            done += teardown_subtree(child, budget - done);
+    }
+
+    if (!node->left && !node->right && page_parent(node)) {
+        unmap_page_remove(node);
+        done++;
+    }
+    return done;
+}
+
+/* Frees user page tables of the space, returns
+ * amount of work done or 0 if there are none left */
+static size_t
+teardown_page_tables(struct DeadSpace *dead, size_t budget) {
+    struct AddressSpace *spc = &dead->space;
+    if (!(spc->pml4[0] & PTE_P)) return 0;
+
+    size_t done = 0;
+    pdpe_t *pdp = KADDR(PTE_ADDR(spc->pml4[0]));
+    while (dead->pt_cursor < PDP_ENTRY_COUNT * PD_ENTRY_COUNT && done < budget) {
+        size_t i = dead->pt_cursor / PD_ENTRY_COUNT, j = dead->pt_cursor % PD_ENTRY_COUNT;
+        if (!(pdp[i] & PTE_P) || pdp[i] & PTE_PS) {
+            dead->pt_cursor += PD_ENTRY_COUNT - j;
+            continue;
+        }
+
+        pde_t *pd = KADDR(PTE_ADDR(pdp[i]));
+        done += 1 + remove_pt(pd, 0, 2 * MB, j, j + 1);
+        if (++dead->pt_cursor % PD_ENTRY_COUNT == 0)
+            done += remove_pt(pdp, 0, 1 * GB, i, i + 1);
+    }
+
+    if (dead->pt_cursor == PDP_ENTRY_COUNT * PD_ENTRY_COUNT)
+        done += remove_pt(spc->pml4, 0, 512 * GB, 0, NUSERPML4);
+    return done;
+}
+
+/* Tears down address spaces of exited environments doing
+ * at most budget units of work (nodes and page table entries).
+ * Finished spaces are returned to the pool if there is room.
+ * Returns amount of work done */
+size_t
+teardown_spaces(size_t budget) {
+    if (!dead_head) return 0;
+
+    uint64_t start = read_tsc();
+    size_t done = 0;
+    while (dead_head && done < budget) {
+        struct DeadSpace *dead = dead_head;
+        struct AddressSpace *spc = &dead->space;
+
+        done += teardown_subtree(spc->root, budget - done);
+        if (spc->root->left || spc->root->right) break;
+        done += teardown_page_tables(dead, budget - done);
+        if (spc->pml4[0] & PTE_P) break;
+
+        if (!(dead_head = dead->next)) dead_tail = NULL;
+        dead_count--;
+
+        size_t i = 0;
+        while (i < SPACE_POOL_SIZE && space_pool_state[i] != SPACE_SLOT_FREE) i++;
+        if (i < SPACE_POOL_SIZE) {
+            space_move(&space_pool[i], spc);
+            space_pool_state[i] = SPACE_SLOT_READY;
+        } else
+            destroy_address_space(spc);
+        kfree(dead);
+    }
+
+    teardown_max_cycles = MAX(teardown_max_cycles, read_tsc() - start);
+    return done;
+}
+
+/* Prebuilds a new space if there are less
+ * than SPACE_POOL_READY ready spaces in the pool */
+static void
+space_pool_work(void) {
+    size_t ready = 0, free = SPACE_POOL_SIZE;
+    for (size_t i = 0; i < SPACE_POOL_SIZE; i++) {
+        if (space_pool_state[i] == SPACE_SLOT_READY) ready++;
+        if (space_pool_state[i] == SPACE_SLOT_FREE && free == SPACE_POOL_SIZE) free = i;
+    }
+
+    if (ready < SPACE_POOL_READY && free < SPACE_POOL_SIZE &&
+        !build_address_space(&space_pool[free]))
+        space_pool_state[free] = SPACE_SLOT_READY;
+}
+
+void
+dump_space_pool_stats(void) {
+    size_t ready = 0;
+    for (size_t i = 0; i < SPACE_POOL_SIZE; i++) ready += space_pool_state[i] == SPACE_SLOT_READY;
+    cprintf("Address space pool: %zu ready of %d, %zu hits, %zu misses\n",
+            ready, SPACE_POOL_SIZE, space_pool_hits, space_pool_misses);
+    cprintf("Teardown: %zu spaces pending, %zu deferred, %zu synchronous, longest slice %lu cycles\n",
+            dead_count, teardown_queued, teardown_sync, (unsigned long)teardown_max_cycles);
+}
+
+/*
+ * Background memory management work
+ * that is done when there are no environments to run
+ */
+void
+pmap_idle_work(void) {
+    if (!current_space) return;
+    attach_deferred_memory(DEFER_CHUNK);
+    if (compact_request) {
+        compact_memory(compact_request, 1);
+        compact_request = 0;
+    }
+    zero_pool_fill(ZPOOL_IDLE_BUDGET);
+    promote_huge_pages(THP_SCAN_BUDGET);
+    merge_same_pages(KSM_SCAN_BUDGET);
+    if (swap_request) {
+        size_t evicted = swap_out_pages(MIN(swap_request, SWAP_IDLE_PAGES));
+        swap_request = evicted ? swap_request - evicted : 0;
+    }
+    teardown_spaces(TEARDOWN_SLICE);
+    space_pool_work();
+}
+
+/* Fault-around limits (see resolve_lazy_fault()) */
+#define FAULT_AROUND_MAX_PAGES 32
+#define FAULT_AROUND_MAX_BYTES (4 * MB)
+/* Window size starting from which zero-filled
+ * 2M ranges are allocated as huge pages */
+#define FAULT_AROUND_PROMOTE 8
+
+static size_t fault_around_pages, fault_around_promoted;
+
+/* Checks whether page is a part of zero filler page */
+inline static bool
+is_zero_filler(struct Page *page) {
+    if (page->state == SWAP_NODE) return 0;
+    physaddr_t pa = page2pa(page);
+    return pa >= PADDR(zero_page_raw) && pa < PADDR(zero_page_raw) + HUGE_PAGE_SIZE;
+}
+
+static int
+do_force_alloc_page(struct AddressSpace *spc, uintptr_t va, int maxclass) {
+    int res = -E_FAULT;
+    /* FIXME We need to propagate kernel PML4E
+     * changes to every AddressSpace or just use KPTI
+     * (now it's ok since kernel does not map huge chunks of memory (>= 512GB)
+     * to higher part of address space after initiallization) */
+
+    static_assert(!(MAX_USER_ADDRESS & (HUGE_PAGE_SIZE * 512 * 512 - 1)), "MAX_USER_ADDRESS should be alligned on 512GiB");
+
+    /* If we are working with kernel addresses
+     * kspace should be current */
+    struct AddressSpace *old = NULL;
+    assert(current_space);
+    old = switch_address_space(spc = (va > MAX_USER_ADDRESS ? &kspace : spc));
 
-    if (PAGE_IS_UNIQ(page->phy)) {
-        /* If we have the only reference to the page and
-         * and its mapping to itself we can actually just
-         * disable lazy flag and not bother copying */
-        res = map_page(spc, va, page->phy, page->state & ~PROT_LAZY);
-    } else {
-        if (trace_memory) {
-            cprintf("<%p> Allocating new page [%08lX, %08lX] flags=%x\n", spc,
-                    va, va + (long)CLASS_MASK(page->phy->class), page->state & PROT_ALL & ~PROT_LAZY);
-        }
 
-        struct Page *phy = page->phy;
-        page_ref(phy);
-        res = alloc_composite_page(spc, va, phy->class, page->state & PROT_ALL & ~PROT_LAZY);
-        if (!res) memcpy_page(spc, va, phy);
-        page_unref(phy);
+    /* Lookup page mapping such that it's class it not larger than MAX_ALLOCATION_CLASS */
+    struct Page *page;
+    if (!(page = page_lookup_virtual(spc->root, va, maxclass, LOOKUP_SPLIT))) goto fault;
+    if (!(page = page_lookup_virtual(spc->root, va, 0, LOOKUP_PRESERVE))) goto fault;
+
+    if (page->phy && page_phy(page)->state == SWAP_NODE) {
+        if ((res = swap_in_page(page_phy(page))) < 0) goto fault;
+        page = page_lookup_virtual(spc->root, va, 0, LOOKUP_PRESERVE);
+        assert(page && page->phy);
+        if (!(page->state & PROT_LAZY)) goto fault;
+    } else if (!(page->state & PROT_LAZY)) goto fault;
+
+    if (cow_split_huge && page_phy(page)->class && !is_zero_filler(page_phy(page)) && !PAGE_IS_UNIQ(page_phy(page))) {
+        /* Split shared huge page mapping and copy only 4K page
+         * containing va, the rest stays shared until written to.
+         * Range is merged back by promote_huge_pages() when all of it
+         * becomes private. */
+        if (!(page = page_lookup_virtual(spc->root, va, 0, LOOKUP_ALLOC))) {
+            res = -E_NO_MEM;
+            goto fault;
+        }
+        cow_splits++;
+    }
+
+    va &= ~CLASS_MASK(page_phy(page)->class);
+
+    if (PAGE_IS_UNIQ(page_phy(page))) {
+        /* If we have the only reference to the page and
+         * and its mapping to itself we can actually just
+         * disable lazy flag and not bother copying */
+        res = map_page(spc, va, page_phy(page), page->state & ~PROT_LAZY);
+    } else {
+        if (trace_memory) {
+            cprintf("<%p> Allocating new page [%08lX, %08lX] flags=%x\n", spc,
+                    va, va + (long)CLASS_MASK(page_phy(page)->class), page->state & PROT_ALL & ~PROT_LAZY);
+        }
+
+        struct Page *phy = page_phy(page), *zpage;
+        if (is_zero_filler(phy) && (zpage = zero_pool_get(phy->class))) {
+            /* Zero-fill fault can be served with pre-zeroed page */
+            res = map_page(spc, va, zpage, page->state & PROT_ALL & ~PROT_LAZY);
+        } else {
+            page_ref(phy);
+            res = alloc_composite_page(spc, va, phy->class, page->state & PROT_ALL & ~PROT_LAZY);
+            if (!res) memcpy_page(spc, va, phy);
+            page_unref(phy);
+        }
     }
 
 fault:
     switch_address_space(old);
+    return res;
+}
+
+int
+force_alloc_page(struct AddressSpace *spc, uintptr_t va, int maxclass) {
+    int res = do_force_alloc_page(spc, va, maxclass);
+    if (va > MAX_USER_ADDRESS) spc = &kspace;
+
+    /* Memory of exited environments is freed first */
+    while (res == -E_NO_MEM && teardown_spaces(SIZE_MAX))
+        res = do_force_alloc_page(spc, va, maxclass);
+
+    /* Make room by evicting cold pages to swap */
+    while (res == -E_NO_MEM && swap_out_pages(SWAP_FAULT_PAGES)) {
+        swap_request = SWAP_RECLAIM_PAGES;
+        res = do_force_alloc_page(spc, va, maxclass);
+    }
 
     if (res == -E_NO_MEM) {
         if (spc != &kspace) {
@@ -1341,6 +2839,122 @@ fault:
     return res;
 }
 
+/* Returns node of virtual tree of given class
+ * containing addr, or NULL if there is none */
+static struct Page *
+virtual_node_at(struct Page *node, uintptr_t addr, int class) {
+    for (int nclass = MAX_CLASS; node && nclass > class; nclass--)
+        node = addr & CLASS_SIZE(nclass - 1) ? page_right(node) : page_left(node);
+    return node;
+}
+
+/* Returns end of the mapping containing va */
+static uintptr_t
+mapping_end(struct AddressSpace *spc, uintptr_t va) {
+    struct Page *node = page_lookup_virtual(spc->root, va, 0, LOOKUP_PRESERVE);
+    int class = node && node->phy ? page_phy(node)->class : 0;
+    return (va & ~CLASS_MASK(class)) + CLASS_SIZE(class);
+}
+
+/*
+ * Checks that virtual subtree is completely covered by
+ * lazy mappings of zero filler page with equal protection.
+ * Protection is returned via prot (which should be -1 initially)
+ */
+static bool
+zero_fill_check_subtree(struct Page *node, int *prot) {
+    if (!node) return 0;
+    if (!node->phy)
+        return zero_fill_check_subtree(page_left(node), prot) &&
+               zero_fill_check_subtree(page_right(node), prot);
+
+    /* Swapped out pages are not zero filler, so range with them is not filled */
+    int state = node->state & PROT_ALL;
+    if (!(state & PROT_LAZY) || !is_zero_filler(page_phy(node))) return 0;
+    if (*prot >= 0 && *prot != state) return 0;
+    *prot = state;
+    return 1;
+}
+
+/* Replaces 2M range of lazily zero-filled small
+ * pages containing va with single zeroed huge page */
+static bool
+fault_around_promote(struct AddressSpace *spc, uintptr_t va) {
+    va &= ~CLASS_MASK(MAX_ALLOCATION_CLASS);
+
+    int prot = -1;
+    struct Page *node = virtual_node_at(spc->root, va, MAX_ALLOCATION_CLASS);
+    if (!node || page_phy(node) || !zero_fill_check_subtree(node, &prot)) return 0;
+
+    struct Page *page = zero_pool_get(MAX_ALLOCATION_CLASS);
+    if (!page) {
+        if (!(page = alloc_page(MAX_ALLOCATION_CLASS, 0))) return 0;
+        nosan_memset(KADDR(page2pa(page)), 0, CLASS_SIZE(MAX_ALLOCATION_CLASS));
+    }
+
+    /* Reference is held, so that page is freed if it can't be mapped */
+    page_ref(page);
+    int res = map_page(spc, va, page, prot & ~PROT_LAZY);
+    page_unref(page);
+    if (res < 0) return 0;
+
+    fault_around_promoted++;
+    return 1;
+}
+
+/*
+ * Resolves lazy copying/allocation fault at va.
+ * If faults of address space form sequential stream,
+ * up to fault_window following writable lazy pages are
+ * resolved in advance, so sequential first-touch of a large
+ * buffer does not take a trap per page. Window is doubled on
+ * every fault continuing the stream and reset otherwise.
+ * Streams entering untouched zero-filled 2M range get a huge page.
+ */
+int
+resolve_lazy_fault(struct AddressSpace *spc, uintptr_t va) {
+    if (va >= MAX_USER_ADDRESS || spc == &kspace)
+        return force_alloc_page(spc, va, MAX_ALLOCATION_CLASS);
+
+    va = ROUNDDOWN(va, PAGE_SIZE);
+    if (va == spc->fault_next)
+        spc->fault_window = MIN(MAX(spc->fault_window * 2, 1), FAULT_AROUND_MAX_PAGES);
+    else
+        spc->fault_window = 0;
+
+    if (spc->fault_window < FAULT_AROUND_PROMOTE || !fault_around_promote(spc, va)) {
+        int res = force_alloc_page(spc, va, MAX_ALLOCATION_CLASS);
+        if (res < 0) {
+            spc->fault_window = 0;
+            return res;
+        }
+    }
+
+    uintptr_t addr = mapping_end(spc, va);
+    uintptr_t limit = MIN(va + FAULT_AROUND_MAX_BYTES, MAX_USER_ADDRESS);
+    for (size_t i = 0; i < spc->fault_window && addr < limit; i++) {
+        struct Page *node = page_lookup_virtual(spc->root, addr, 0, LOOKUP_PRESERVE);
+        if (!node || !node->phy) break;
+        if ((node->state & (PROT_LAZY | PROT_W)) != (PROT_LAZY | PROT_W)) break;
+        if (addr + CLASS_SIZE(MIN((int)page_phy(node)->class, MAX_ALLOCATION_CLASS)) > limit) break;
+
+        /* Running out of memory is not fatal here */
+        if (do_force_alloc_page(spc, addr, MAX_ALLOCATION_CLASS) < 0) break;
+
+        fault_around_pages++;
+        addr = mapping_end(spc, addr);
+    }
+
+    spc->fault_next = addr;
+    return 0;
+}
+
+void
+dump_fault_around_stats(void) {
+    cprintf("Fault-around: %zu pages resolved ahead, %zu ranges promoted to huge pages\n",
+            fault_around_pages, fault_around_promoted);
+}
+
 static int
 do_map_page(struct AddressSpace *dspace, uintptr_t dst, struct AddressSpace *sspace, uintptr_t src, struct Page *phy, int oldflags, int flags) {
     int res;
@@ -1376,6 +2990,17 @@ do_map_page(struct AddressSpace *dspace, uintptr_t dst, struct AddressSpace *ssp
      *      and not before
      */
 
+    /* Swapped out page needs to be read back before it is mapped */
+    if (phy->state == SWAP_NODE) {
+        while ((res = swap_in_page(phy)) == -E_NO_MEM && swap_out_pages(SWAP_FAULT_PAGES))
+            ;
+        if (res < 0) return res;
+
+        struct Page *newv = page_lookup_virtual(sspace->root, src, 0, LOOKUP_PRESERVE);
+        assert(newv && newv->phy);
+        phy = page_phy(newv);
+    }
+
     /* Lock page so it cannot be deallocated during copying/mapping */
     if (!(flags & PROT_LAZY) && (oldflags & PROT_LAZY)) {
         int class = phy->class;
@@ -1385,7 +3010,7 @@ do_map_page(struct AddressSpace *dspace, uintptr_t dst, struct AddressSpace *ssp
         struct Page *newv = page_lookup_virtual(sspace->root, src, class, LOOKUP_PRESERVE);
         check_virtual_class(newv, class);
         assert(newv && newv->phy);
-        phy = newv->phy;
+        phy = page_phy(newv);
     }
 
     page_ref(phy);
@@ -1416,16 +3041,16 @@ do_map_subtree(struct AddressSpace *dspace, uintptr_t dst, struct AddressSpace *
         if (vpage->phy) {
             assert((vpage->state & NODE_TYPE_MASK) == MAPPING_NODE);
             return do_map_page(dspace, dst, sspace, src,
-                               vpage->phy, vpage->state & PROT_ALL, flags);
+                               page_phy(vpage), vpage->state & PROT_ALL, flags);
         }
         assert(vpage->state == INTERMEDIATE_NODE);
 
-        if (vpage->left && (res = do_map_subtree(dspace, dst,
-                                                 sspace, src, vpage->left, class - 1, flags)) < 0) break;
+        if (page_left(vpage) && (res = do_map_subtree(dspace, dst,
+                                                 sspace, src, page_left(vpage), class - 1, flags)) < 0) break;
 
         dst += CLASS_SIZE(class - 1);
         src += CLASS_SIZE(class - 1);
-        vpage = vpage->right;
+        vpage = page_right(vpage);
         class --;
     }
     return res;
@@ -1446,6 +3071,7 @@ do_map_region_one_page(struct AddressSpace *dspace, uintptr_t dst, struct Addres
             if (!res) {
                 assert(current_space);
                 assert(dspace);
+                tlb_batch_flush();
                 struct AddressSpace *old = switch_address_space(dspace);
                 set_wp(0);
                 nosan_memset((void *)dst, flags & ALLOC_ONE ? 0xFF : 0x00, CLASS_SIZE(class));
@@ -1474,9 +3100,9 @@ do_map_region_one_page(struct AddressSpace *dspace, uintptr_t dst, struct Addres
     } else {
         struct Page *page1 = page_lookup_virtual(sspace->root, src, class, LOOKUP_ALLOC);
         assert(page1);
-        if (page1->phy && page1->phy->class > class) {
+        if (page_phy(page1) && page_phy(page1)->class > class) {
             /* We need to split physical page if part of it is remapped */
-            struct Page *page = page_lookup(page1->phy, src, class, PARTIAL_NODE, 1);
+            struct Page *page = page_lookup(page_phy(page1), src, class, PARTIAL_NODE, 1);
             return do_map_page(dspace, dst, sspace, src, page, page1->state & PROT_ALL, flags);
         } else {
             check_virtual_class(page1, class);
@@ -1522,31 +3148,105 @@ map_region(struct AddressSpace *dspace, uintptr_t dst, struct AddressSpace *sspa
     return 0;
 }
 
+/* Checks that page is either empty or covered by a single
+ * mapping, so that it is mapped or unmapped in constant time */
+static bool
+virtual_page_trivial(struct Page *node, uintptr_t addr, int class) {
+    for (int nclass = MAX_CLASS; node && !node->phy && nclass > class; nclass--)
+        node = addr & CLASS_SIZE(nclass - 1) ? page_right(node) : page_left(node);
+    return !node || node->phy || (!node->left && !node->right);
+}
+
+/* Largest page of region decomposition starting at dst (and src).
+ * Pages larger than REGION_CHUNK_CLASS are split if mapping them
+ * takes time proportional to their size or to their contents */
+static int
+region_chunk_class(struct AddressSpace *dspace, uintptr_t dst, struct AddressSpace *sspace,
+                   uintptr_t src, uintptr_t end, int flags) {
+    int class = MIN(addr_common_class(src, dst), MAX_CLASS - 1);
+    while (class && ((dst & CLASS_MASK(class)) || dst + CLASS_SIZE(class) > end)) class--;
+
+    for (; class > REGION_CHUNK_CLASS; class --) {
+        if (flags & (ALLOC_ZERO | ALLOC_ONE)) continue;
+        if (!virtual_page_trivial(dspace->root, dst, class)) continue;
+        if (sspace && !virtual_page_trivial(sspace->root, src, class)) continue;
+        break;
+    }
+    return class;
+}
+
+/*
+ * Restartable versions of map_region() and unmap_region().
+ * Region is processed starting from *done bytes, after deadline
+ * (in TSC cycles) is reached -E_RESTART is returned and *done
+ * is updated, so that operation can be continued later.
+ */
+int
+map_region_bounded(struct AddressSpace *dspace, uintptr_t dst, struct AddressSpace *sspace,
+                   uintptr_t src, uintptr_t size, int flags, size_t *done, uint64_t deadline) {
+    if (src & CLASS_MASK(0) || (!sspace && !(flags & (ALLOC_ZERO | ALLOC_ONE)))) return -E_INVAL;
+    if (dst & CLASS_MASK(0) || !dspace) return -E_INVAL;
+    if (size & CLASS_MASK(0) || !size || *done >= size) return -E_INVAL;
+
+    assert(sspace != dspace || dst <= src || ABSDIFF(src, dst) >= size);
+
+    uintptr_t end = dst + size;
+    dst += *done;
+    src += *done;
+    while (dst < end) {
+        if (read_tsc() > deadline) return -E_RESTART;
+
+        int class = region_chunk_class(dspace, dst, sspace, src, end, flags);
+        int res = do_map_region_one_page(dspace, dst, sspace, src, class, flags);
+        if (res < 0) return res;
+        dst += CLASS_SIZE(class);
+        src += CLASS_SIZE(class);
+        *done += CLASS_SIZE(class);
+    }
+
+    return 0;
+}
+
+int
+unmap_region_bounded(struct AddressSpace *dspace, uintptr_t dst, uintptr_t size, size_t *done, uint64_t deadline) {
+    uintptr_t start = ROUNDDOWN(dst, 1ULL << CLASS_BASE) + *done;
+    uintptr_t end = ROUNDUP(dst + size, 1ULL << CLASS_BASE);
+
+    while (start < end) {
+        if (read_tsc() > deadline) return -E_RESTART;
+
+        int class = region_chunk_class(dspace, start, NULL, start, end, 0);
+        unmap_page(dspace, start, class);
+        start += CLASS_SIZE(class);
+        *done += CLASS_SIZE(class);
+    }
+
+    return 0;
+}
+
 void
 release_address_space(struct AddressSpace *space) {
     /* NOTE: This function should not be called for kspace */
 
-    /* Manually unref level 3 kernel page tables */
-    for (size_t i = NUSERPML4; i < PML4_ENTRY_COUNT; i++) {
-        if (kspace.pml4[i] & PTE_P && i != UVPT_INDEX)
-            page_unref(page_lookup(NULL, PTE_ADDR(kspace.pml4[i]), 0, PARTIAL_NODE, 0));
+    /* Queue the space for teardown_spaces() */
+    struct DeadSpace *dead = kmalloc(sizeof *dead);
+    if (dead) {
+        space_move(&dead->space, space);
+        dead->next = NULL;
+        dead->pt_cursor = 0;
+        *(dead_tail ? &dead_tail->next : &dead_head) = dead;
+        dead_tail = dead;
+        dead_count++;
+        teardown_queued++;
+    } else {
+        destroy_address_space(space);
+        teardown_sync++;
     }
 
-    /* Unmap all memory from the space
-     * (kernel is cheating and does not store
-     *  metadata for upper part of address space (privileged)
-     *  in tree and only in page tables for user address spaces,
-     *  so unmapping is safe) */
-    unmap_page(space, 0, MAX_CLASS);
-
-    /* Also unmap PML4 itself since it is never deallocated by page_uname*/
-    page_unref(page_lookup(NULL, space->cr3, 0, PARTIAL_NODE, 0));
-
     /* Zero-out metadata */
     memset(space, 0, sizeof *space);
 }
 
-
 /*
  * This function is used for switch address spaces
  *
@@ -1559,6 +3259,25 @@ release_address_space(struct AddressSpace *space) {
  *
  * Returns old address space
  */
+/*
+ * Returns CR3 value for address space. If the address space
+ * has PCID from current generation, TLB is not flushed on
+ * switch, otherwise new PCID is assigned and all stale
+ * TLB entries tagged with it are flushed by CR3 load.
+ */
+static uint64_t
+address_space_cr3(struct AddressSpace *space) {
+    if (!pcid_enabled) return space->cr3;
+
+    if (space->pcid_gen == pcid_generation)
+        return space->cr3 | space->pcid | CR3_NOFLUSH;
+
+    if (pcid_next == PCID_COUNT) pcid_new_generation();
+    space->pcid = pcid_next++;
+    space->pcid_gen = pcid_generation;
+    return space->cr3 | space->pcid;
+}
+
 struct AddressSpace *
 switch_address_space(struct AddressSpace *space) {
     assert(space);
@@ -1567,19 +3286,20 @@ switch_address_space(struct AddressSpace *space) {
     if (space == current_space)
         return space;
 
-    lcr3(space->cr3);
+    lcr3(address_space_cr3(space));
     struct AddressSpace *prev = current_space;
     current_space = space;
 
     return prev;
 }
 
-int
-init_address_space(struct AddressSpace *space) {
+static int
+build_address_space(struct AddressSpace *space) {
     /* Allocte page table with alloc_pt into space->cr3
      * (remember to clean flag bits of result with PTE_ADDR) */
     // LAB 8: Your code here
-    alloc_pt(&space->cr3);
+    int res = alloc_pt(&space->cr3);
+    if (res < 0) return res;
     space->cr3 = PTE_ADDR(space->cr3);
 
     /* put its kernel virtual address to space->pml4 */
@@ -1589,7 +3309,13 @@ init_address_space(struct AddressSpace *space) {
     // Allocate virtual tree root node
     // of type INTERMEDIATE_NODE with alloc_rescriptor() of type
     // LAB 8: Your code here
-    space->root = alloc_descriptor(INTERMEDIATE_NODE);
+    space->root = alloc_space_root(space);
+
+    /* Structure might be reused, so make sure that PCID
+     * of previous owner is not inherited with its TLB entries */
+    space->pcid_gen = 0;
+    space->fault_next = 0;
+    space->fault_window = 0;
 
     /* Initialize UVPT */
     // LAB 8: Your code here
@@ -1601,6 +3327,22 @@ init_address_space(struct AddressSpace *space) {
     return 0;
 }
 
+int
+init_address_space(struct AddressSpace *space) {
+    for (size_t i = 0; i < SPACE_POOL_SIZE; i++) {
+        if (space_pool_state[i] != SPACE_SLOT_READY) continue;
+        space_move(space, &space_pool[i]);
+        memset(&space_pool[i], 0, sizeof space_pool[i]);
+        space_pool_state[i] = SPACE_SLOT_FREE;
+        space_pool_hits++;
+        return 0;
+    }
+
+    space_pool_misses++;
+    return build_address_space(space);
+}
+
+
 /* Buffers for filler pages are statically allocated for simplicity
  * (this is also required for early KASAN) */
 __attribute__((aligned(HUGE_PAGE_SIZE))) uint8_t zero_page_raw[HUGE_PAGE_SIZE];
@@ -1617,6 +3359,9 @@ detect_memory(void) {
 
     attach_region(0, PAGE_SIZE, RESERVED_NODE);
 
+    /* Application processors startup code and page tables */
+    attach_region(MPENTRY_PADDR, MPENTRY_PADDR + MPENTRY_SIZE, RESERVED_NODE);
+
     /* Attach kernel and old IO memory
      * (from IOPHYSMEM to the physical address of end label. end points the the
      *  end of kernel executable image.)*/
@@ -1647,7 +3392,7 @@ detect_memory(void) {
              * of type type*/
             // LAB 6: Your code here
 
-            attach_region(start->PhysicalStart, start->PhysicalStart + start->NumberOfPages * EFI_PAGE_SIZE, type);
+            attach_boot_region(start->PhysicalStart, start->PhysicalStart + start->NumberOfPages * EFI_PAGE_SIZE, type);
 
             start = (void *)((uint8_t *)start + uefi_lp->MemoryMapDescriptorSize);
         }
@@ -1663,7 +3408,7 @@ detect_memory(void) {
 
         max_memory_map_addr = extmem ? EXTPHYSMEM + extmem : basemem;
 
-        attach_region(0, max_memory_map_addr, ALLOCATABLE_NODE);
+        attach_boot_region(0, max_memory_map_addr, ALLOCATABLE_NODE);
     }
 
     if (trace_init) {
@@ -1692,8 +3437,10 @@ init_allocator(void) {
     metaheaptop = KERN_HEAP_START + ROUNDUP(uefi_lp->FrameBufferSize, PAGE_SIZE);
 
     /* Initiallize lists */
-    for (size_t i = 0; i < MAX_CLASS; i++)
-        list_init(&free_classes[i]);
+    for (size_t i = 0; i < MAX_CLASS; i++) {
+        list_init(&free_classes[FREE_LOW][i]);
+        list_init(&free_classes[FREE_HIGH][i]);
+    }
 
     /* Initiallize first pool */
 
@@ -1701,11 +3448,11 @@ init_allocator(void) {
                                    PADDR(initial_buffer) + INIT_DESCR * sizeof(struct Page));
 
     list_init(&free_descriptors);
-    free_desc_count = INIT_DESCR;
+    free_desc_count = total_desc_count = INIT_DESCR;
     for (size_t i = 0; i < INIT_DESCR; i++)
-        list_append(&free_descriptors, (struct List *)&initial_buffer[i]);
+        list_append(&free_descriptors, &initial_buffer[i]);
 
-    list_init(&root.head);
+    list_init(&root);
     root.class = MAX_CLASS;
     root.state = PARTIAL_NODE;
 }
@@ -1775,7 +3522,7 @@ init_kspace(void) {
     kspace.cr3 = page2pa(page);
     memset(kspace.pml4, 0, CLASS_SIZE(0));
     kspace.pml4[PML4_INDEX(UVPT)] = kspace.cr3 | PTE_P | PTE_U;
-    kspace.root = alloc_descriptor(INTERMEDIATE_NODE);
+    kspace.root = alloc_space_root(&kspace);
 }
 
 #ifdef SANITIZE_SHADOW_BASE
@@ -1788,8 +3535,8 @@ unpoison_meta(struct Page *node) {
             return;
         }
 
-        if (node->left) unpoison_meta(node->left);
-        node = node->right;
+        if (node->left) unpoison_meta(page_left(node));
+        node = page_right(node);
     }
 }
 
@@ -1838,6 +3585,9 @@ init_memory(void) {
     check_physical_tree(&root);
     if (trace_init) cprintf("Physical memory tree is correct\n");
 
+    /* Physical memory mapping should not overlap metadata window */
+    assert(KERN_BASE_ADDR + max_memory_map_addr <= KERN_META_BASE);
+
     init_kspace();
 
     /* First, only map kernel itself, kernel stacks, UEFI memory
@@ -1889,6 +3639,15 @@ init_memory(void) {
     res = map_physical_region(&kspace, KERN_PF_STACK_TOP - KERN_PF_STACK_SIZE, PADDR(pfstack), KERN_PF_STACK_SIZE, PROT_R | PROT_W);
     assert(!res);
 
+    for (int i = 1; i < NCPU; i++) {
+        res = map_physical_region(&kspace, KERN_CPU_STACK_TOP(i) - KERN_STACK_SIZE,
+                                  PADDR(percpu_kstacks[i - 1]), KERN_STACK_SIZE, PROT_R | PROT_W);
+        assert(!res);
+        res = map_physical_region(&kspace, KERN_CPU_PF_STACK_TOP(i) - KERN_PF_STACK_SIZE,
+                                  PADDR(percpu_pfstacks[i - 1]), KERN_PF_STACK_SIZE, PROT_R | PROT_W);
+        assert(!res);
+    }
+
 #ifdef SANITIZE_SHADOW_BASE
     init_shadow_pre();
 #endif
@@ -1918,7 +3677,14 @@ init_memory(void) {
     /* Set appropriate cr0 and cr4 bits
      * (In assembly code only minimal set of modes was set)*/
     lcr0(CR0_PE | CR0_PG | CR0_AM | CR0_WP | CR0_NE | CR0_MP);
-    lcr4(CR4_PSE | CR4_PAE | CR4_PCE);
+
+    /* PCIDs can only be enabled while current PCID is 0,
+     * which is true for loader page tables */
+    uint32_t ecx;
+    cpuid(1, NULL, NULL, &ecx, NULL);
+    pcid_enabled = !!(ecx & CPUID_1_ECX_PCID);
+    lcr4(CR4_PSE | CR4_PAE | CR4_PCE | (pcid_enabled ? CR4_PCIDE : 0));
+    if (trace_init) cprintf("PCID support is %s\n", pcid_enabled ? "enabled" : "disabled");
 
     /* Enable NX bit (execution protection) */
     uint64_t efer = rdmsr(EFER_MSR);
@@ -1929,6 +3695,12 @@ init_memory(void) {
 
     switch_address_space(&kspace);
 
+    /* Enable global pages only after switching to kernel address space,
+     * since loader page tables have global bit set for every entry */
+    uint32_t edx;
+    cpuid(1, NULL, NULL, NULL, &edx);
+    if ((pge_enabled = !!(edx & CPUID_1_EDX_PGE))) lcr4(rcr4() | CR4_PGE);
+
     /* One page is a page filled with 0xFF values -- ASAN poison */
     nosan_memset(one_page_raw, 0xFF, CLASS_SIZE(MAX_ALLOCATION_CLASS));
 
@@ -2015,6 +3787,37 @@ init_memory(void) {
 
     check_virtual_tree(kspace.root, MAX_CLASS);
     if (trace_init) cprintf("Kernel virutal memory tree is correct\n");
+
+    if (trace_init) cprintf("Free memory: %zuM (%zuM not attached yet)\n",
+                            (size_t)((free_memory_size() + deferred_size) / MB), (size_t)(deferred_size / MB));
+}
+
+/* Sets up paging of application processor the way init_memory()
+ * does it for the bootstrap one. It's started on page tables which
+ * map kernel the same way as kspace does */
+void
+init_memory_percpu(void) {
+    lcr0(CR0_PE | CR0_PG | CR0_AM | CR0_WP | CR0_NE | CR0_MP);
+    lcr4(CR4_PSE | CR4_PAE | CR4_PCE);
+
+    uint64_t efer = rdmsr(EFER_MSR);
+    efer |= EFER_NXE;
+    wrmsr(EFER_MSR, efer);
+
+    switch_address_space(&kspace);
+    if (pge_enabled) lcr4(rcr4() | CR4_PGE);
+}
+
+/* TLB entries of inactive address spaces can't be tracked for
+ * every CPU, so PCIDs are not used once other CPUs are started.
+ * Everything runs with PCID 0 from now on */
+void
+pcid_disable(void) {
+    if (!pcid_enabled) return;
+
+    pcid_enabled = 0;
+    lcr3(current_space->cr3);
+    tlbflush_global();
 }
 
 void
@@ -2035,12 +3838,12 @@ dump_page(const struct Page *p)
             //"    .addr = %p,\n"
             "}\n",
                 p,
-                p->head.next,
-                p->head.prev,
-                p->left,
-                p->right,
-                p->parent,
-                //p->phy,
+                page_ptr(p->head.next),
+                page_ptr(p->head.prev),
+                page_left(p),
+                page_right(p),
+                page_parent(p),
+                //page_phy(p),
                 p->state,
                 p->refc
                 //p->class,
@@ -2076,6 +3879,64 @@ check_page_alloc()
     dump_memory_lists();
 }
 
+#define BENCH_SLOTS 64
+#define BENCH_FRAG  4096
+
+/*
+ * Page allocator stress benchmark.
+ * Physical memory is fragmented first by allocating
+ * BENCH_FRAG 4K pages and releasing every other one,
+ * then random-class pages are allocated and freed in random
+ * order. Average number of cycles per operation is reported.
+ */
+void
+bench_page_alloc(size_t iterations) {
+    static struct Page *frag[BENCH_FRAG];
+    struct Page *slots[BENCH_SLOTS] = {0};
+    uint64_t seed = read_tsc() | 1;
+    uint64_t alloc_cycles = 0, free_cycles = 0;
+    size_t nalloc = 0, nfree = 0, nfail = 0;
+
+    for (size_t i = 0; i < BENCH_FRAG; i++) {
+        if ((frag[i] = alloc_page(0, 0))) page_ref(frag[i]);
+    }
+    for (size_t i = 0; i < BENCH_FRAG; i += 2) {
+        if (frag[i]) page_unref(frag[i]);
+        frag[i] = NULL;
+    }
+
+    for (size_t i = 0; i < iterations; i++) {
+        /* xorshift64 */
+        seed ^= seed << 13;
+        seed ^= seed >> 7;
+        seed ^= seed << 17;
+
+        struct Page **slot = &slots[seed % BENCH_SLOTS];
+        uint64_t start = read_tsc();
+        if (*slot) {
+            page_unref(*slot);
+            *slot = NULL;
+            free_cycles += read_tsc() - start;
+            nfree++;
+        } else {
+            *slot = alloc_page((seed >> 32) % (MAX_ALLOCATION_CLASS + 1), 0);
+            if (*slot) page_ref(*slot);
+            alloc_cycles += read_tsc() - start;
+            nalloc++;
+            if (!*slot) nfail++;
+        }
+    }
+
+    for (size_t i = 0; i < BENCH_SLOTS; i++)
+        if (slots[i]) page_unref(slots[i]);
+    for (size_t i = 0; i < BENCH_FRAG; i++)
+        if (frag[i]) page_unref(frag[i]);
+
+    cprintf("Page allocator: %zu allocations (%zu failed), %zu frees\n", nalloc, nfail, nfree);
+    cprintf("  alloc: %lu cycles/op\n", (unsigned long)(nalloc ? alloc_cycles / nalloc : 0));
+    cprintf("  free:  %lu cycles/op\n", (unsigned long)(nfree ? free_cycles / nfree : 0));
+}
+
 static uintptr_t user_mem_check_addr;
 
 /*
@@ -2102,14 +3963,14 @@ user_mem_check(struct Env *env, const void *va, size_t len, int perm) {
     {
         struct Page* page = page_lookup_virtual(env->address_space.root, (uintptr_t)virtual_address, 0, 0);
         if (
-               page->phy == NULL
+               page_phy(page) == NULL
             || (PAGE_PROT(page->state) & PAGE_PROT(perm)) != PAGE_PROT(perm)
             )
         {
             user_mem_check_addr = virtual_address;
             return -E_FAULT;
         }
-        virtual_address += CLASS_SIZE(page->phy->class);
+        virtual_address += CLASS_SIZE(page_phy(page)->class);
     }
     return 0;
 }
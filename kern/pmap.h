@@ -10,6 +10,7 @@
 #include <inc/assert.h>
 #include <inc/env.h>
 #include <inc/x86.h>
+#include <kern/cpu.h>
 
 #define CLASS_BASE    12
 #define CLASS_SIZE(c) (1ULL << ((c) + CLASS_BASE))
@@ -35,6 +36,15 @@ void __nosan_memmove(void *, void *, size_t);
 
 #define MAX_CLASS 48
 
+/* Work done by teardown_spaces() per scheduling decision */
+#define TEARDOWN_SLICE 1024
+
+/* Region system calls are restarted after this number of TSC cycles
+ * (see map_region_bounded()), pages of the region larger than
+ * REGION_CHUNK_CLASS are split to make them preemptible */
+#define REGION_SLICE_CYCLES (1ULL << 20)
+#define REGION_CHUNK_CLASS  9
+
 #define POOL_ENTRIES_FOR_SIZE(sz) (((sz)-offsetof(struct PagePool, data)) / sizeof(struct Page))
 
 #define KB 1024LL
@@ -72,29 +82,56 @@ enum PageState {
     PARTIAL_NODE = 0x300000,      /* Intermediate node of physical memory tree */
     ALLOCATABLE_NODE = 0x400000,  /* Generic allocatable memory (part of physical tree) */
     RESERVED_NODE = 0x500000,     /* Reserved memory (part of physical tree) */
+    SWAP_NODE = 0x600000,         /* Page evicted to swap slot addr (not a part of any tree) */
     NODE_TYPE_MASK = 0xF00000,
 };
 
 extern __attribute__((aligned(HUGE_PAGE_SIZE))) uint8_t zero_page_raw[HUGE_PAGE_SIZE];
 extern __attribute__((aligned(HUGE_PAGE_SIZE))) uint8_t one_page_raw[HUGE_PAGE_SIZE];
 
+/* Descriptors are linked with 32-bit indices instead of pointers.
+ * Index is the number of descriptor sized slot counting from
+ * KERN_META_BASE for pools mapped to metadata window.
+ * Descriptors in the kernel image and early pools accessed via KADDR
+ * are counted from KERN_BASE_ADDR and have PAGE_IDX_DIRECT bit set.
+ * Index 0 is used as NULL */
+typedef uint32_t pageidx_t;
+
+#define PAGE_DESC_SHIFT 5
+#define PAGE_DESC_SIZE  (1ULL << PAGE_DESC_SHIFT)
+#define PAGE_IDX_DIRECT 0x80000000U
+
+/* Links of descriptor lists */
+struct PageLink {
+    pageidx_t prev, next;
+};
+
 struct Page {
-    struct List head; /* This should be first member */
-    struct Page *left, *right, *parent;
-    enum PageState state;
+    struct PageLink head; /* This should be first member */
+    pageidx_t left, right, parent;
+    uint32_t state : 24; /* enum PageState and PROT_* flags */
+    uint32_t class : 8;  /* = log2(size)-CLASS_BASE (physical pages only) */
     union {
         struct /* physical page */ {
             /* Number of references
              * Child nodes always have class
              * smaller by 1 than their parents */
             uint32_t refc;
-            uintptr_t class : CLASS_BASE;                        /* = log2(size)-CLASS_BASE */
-            uintptr_t addr : sizeof(uintptr_t) * 8 - CLASS_BASE; /* = address >> CLASS_BASE */
+            /* = address >> (CLASS_BASE + class), this is relative
+             * to the page size so that 32 bits are enough for
+             * every node of the tree */
+            uint32_t addr;
+        };
+        struct /* mapping */ {
+            pageidx_t phy; /* If phy == 0 this is intemediate page */
+            /* Offset of struct AddressSpace from KERN_BASE_ADDR
+             * (only set for root of virtual tree) */
+            int32_t space;
         };
-        /* mapping */
-        struct Page *phy; /* If phy == NULL this is intemediate page */
     };
-};
+} __attribute__((aligned(PAGE_DESC_SIZE)));
+
+static_assert(sizeof(struct Page) == PAGE_DESC_SIZE, "struct Page should be compact");
 
 struct PagePool {
     struct Page *peer;     /* Page from which memory is taken */
@@ -104,7 +141,15 @@ struct PagePool {
 
 int map_region(struct AddressSpace *dspace, uintptr_t dst, struct AddressSpace *sspace, uintptr_t src, uintptr_t size, int flags);
 void unmap_region(struct AddressSpace *dspace, uintptr_t dst, uintptr_t size);
+void tlb_batch_begin(void);
+void tlb_batch_end(void);
+void tlb_shootdown_poll(void);
+int map_region_bounded(struct AddressSpace *dspace, uintptr_t dst, struct AddressSpace *sspace,
+                       uintptr_t src, uintptr_t size, int flags, size_t *done, uint64_t deadline);
+int unmap_region_bounded(struct AddressSpace *dspace, uintptr_t dst, uintptr_t size, size_t *done, uint64_t deadline);
 void init_memory(void);
+void init_memory_percpu(void);
+void pcid_disable(void);
 void release_address_space(struct AddressSpace *space);
 struct AddressSpace *switch_address_space(struct AddressSpace *space);
 int init_address_space(struct AddressSpace *space);
@@ -112,11 +157,29 @@ void user_mem_assert(struct Env *env, const void *va, size_t len, int perm);
 int user_mem_check(struct Env *env, const void *va, size_t len, int perm);
 int region_maxref(struct AddressSpace *spc, uintptr_t addr, size_t size);
 int force_alloc_page(struct AddressSpace *spc, uintptr_t va, int maxclass);
+int resolve_lazy_fault(struct AddressSpace *spc, uintptr_t va);
 void dump_page_table(pte_t *pml4);
 void dump_memory_lists(void);
+void dump_page_magazines(void);
+bool drain_page_magazines(void);
+void dump_zero_pools(void);
+void pmap_idle_work(void);
+void promote_huge_pages(size_t budget);
+void dump_thp_stats(void);
+size_t compact_memory(int class, size_t max_blocks);
+void merge_same_pages(size_t budget);
+void dump_ksm_stats(void);
+size_t swap_out_pages(size_t count);
+void dump_swap_stats(void);
+void dump_space_pool_stats(void);
+size_t teardown_spaces(size_t budget);
+struct AddressSpace *mapping_space(struct Page *mapping, uintptr_t *va);
+size_t page_mapcount(struct Page *page);
+void dump_fault_around_stats(void);
 void dump_virtual_tree(struct Page *node, int class);
 
 void check_page_alloc();
+void bench_page_alloc(size_t iterations);
 
 void *kzalloc_region(size_t size);
 
@@ -124,7 +187,9 @@ void *mmio_map_region(physaddr_t addr, size_t size);
 void *mmio_remap_last_region(physaddr_t addr, void *oldva, size_t oldsz, size_t size);
 
 extern struct AddressSpace kspace;
-extern struct AddressSpace *current_space;
+/* Address space of this CPU */
+#define current_space (thiscpu->cpu_space)
+extern bool cow_split_huge;
 extern struct Page root;
 extern char bootstacktop[], bootstack[];
 extern size_t max_memory_map_addr;
@@ -166,9 +231,29 @@ _kaddr(const char *file, int line, physaddr_t pa) {
 
 inline static physaddr_t __attribute__((always_inline))
 page2pa(struct Page *page) {
-    return page->addr << CLASS_BASE;
+    return (physaddr_t)page->addr << (page->class + CLASS_BASE);
+}
+
+inline static struct Page *__attribute__((always_inline))
+page_ptr(pageidx_t idx) {
+    if (!idx) return NULL;
+    uintptr_t base = idx & PAGE_IDX_DIRECT ? KERN_BASE_ADDR : KERN_META_BASE;
+    return (struct Page *)(base + ((uintptr_t)(idx & ~PAGE_IDX_DIRECT) << PAGE_DESC_SHIFT));
 }
 
+inline static pageidx_t __attribute__((always_inline))
+page_idx(struct Page *page) {
+    if (!page) return 0;
+    if ((uintptr_t)page >= KERN_META_BASE) return ((uintptr_t)page - KERN_META_BASE) >> PAGE_DESC_SHIFT;
+    return (((uintptr_t)page - KERN_BASE_ADDR) >> PAGE_DESC_SHIFT) | PAGE_IDX_DIRECT;
+}
+
+/* Accessors for descriptor links */
+#define page_left(p)   page_ptr((p)->left)
+#define page_right(p)  page_ptr((p)->right)
+#define page_parent(p) page_ptr((p)->parent)
+#define page_phy(p)    page_ptr((p)->phy)
+
 inline static void
 set_wp(bool wp) {
     uintptr_t old = rcr0();
@@ -1,47 +1,532 @@
 #include <inc/assert.h>
+#include <inc/error.h>
 #include <inc/x86.h>
+#include <kern/cpu.h>
 #include <kern/env.h>
 #include <kern/monitor.h>
+#include <kern/pmap.h>
+#include <kern/sched.h>
+#include <kern/spinlock.h>
+#include <kern/timer.h>
+#include <kern/trap.h>
+#include <kern/tsc.h>
 
 
-struct Taskstate cpu_ts;
 _Noreturn void sched_halt(void);
+static bool sched_busy(void);
+
+/* Every CPU has its own run queue of environments
+ * that run on it, idle CPUs steal them from busy ones */
+struct RunQueue {
+    /* Runnable environments ordered by virtual runtime, that is
+     * CPU time they consumed divided by their weight, kept as AVL tree.
+     * Running environment is not in the tree, it is inserted back
+     * when preempted, and the one with the least virtual runtime
+     * runs next, so CPU time is shared proportionally to weights */
+    struct Env *root;
+    size_t count;
+
+    /* Virtual runtime of the last picked environment. It never
+     * decreases and is the lower bound for the environments
+     * becoming runnable, so that they don't get CPU time
+     * they were not using back all at once */
+    uint64_t min_vruntime;
+
+    /* Environment that has voluntarily yielded the CPU */
+    struct Env *yielded;
+};
+
+static struct RunQueue run_queues[NCPU];
+
+/* Real-time environments are not in the run queue,
+ * they are kept in this list whatever their status is */
+static struct Env *rt_envs;
+/* Sum of budget / deadline of real-time environments (in per mille) */
+static uint64_t rt_load;
+
+/* Ties are broken by env_id, so that keys are unique */
+inline static bool
+rq_less(struct Env *a, struct Env *b) {
+    return a->env_vruntime < b->env_vruntime ||
+           (a->env_vruntime == b->env_vruntime && a->env_id < b->env_id);
+}
+
+inline static int
+rq_height(struct Env *node) {
+    return node ? node->env_rq_height : 0;
+}
+
+static void
+rq_update(struct Env *node) {
+    node->env_rq_height = 1 + MAX(rq_height(node->env_rq_left), rq_height(node->env_rq_right));
+}
+
+static struct Env *
+rq_rotate_right(struct Env *node) {
+    struct Env *left = node->env_rq_left;
+    node->env_rq_left = left->env_rq_right;
+    left->env_rq_right = node;
+    rq_update(node);
+    rq_update(left);
+    return left;
+}
+
+static struct Env *
+rq_rotate_left(struct Env *node) {
+    struct Env *right = node->env_rq_right;
+    node->env_rq_right = right->env_rq_left;
+    right->env_rq_left = node;
+    rq_update(node);
+    rq_update(right);
+    return right;
+}
+
+/* Restores balance of the subtree after one of its
+ * children changed height by at most one */
+static struct Env *
+rq_balance(struct Env *node) {
+    rq_update(node);
+
+    int balance = rq_height(node->env_rq_left) - rq_height(node->env_rq_right);
+    if (balance > 1) {
+        struct Env *left = node->env_rq_left;
+        if (rq_height(left->env_rq_left) < rq_height(left->env_rq_right))
+            node->env_rq_left = rq_rotate_left(left);
+        return rq_rotate_right(node);
+    }
+    if (balance < -1) {
+        struct Env *right = node->env_rq_right;
+        if (rq_height(right->env_rq_right) < rq_height(right->env_rq_left))
+            node->env_rq_right = rq_rotate_right(right);
+        return rq_rotate_left(node);
+    }
+    return node;
+}
+
+static struct Env *
+rq_insert(struct Env *node, struct Env *env) {
+    if (!node) {
+        env->env_rq_left = env->env_rq_right = NULL;
+        env->env_rq_height = 1;
+        return env;
+    }
+
+    if (rq_less(env, node))
+        node->env_rq_left = rq_insert(node->env_rq_left, env);
+    else
+        node->env_rq_right = rq_insert(node->env_rq_right, env);
+    return rq_balance(node);
+}
+
+/* Detaches the leftmost node of the subtree and stores it to *min */
+static struct Env *
+rq_remove_min(struct Env *node, struct Env **min) {
+    if (!node->env_rq_left) {
+        *min = node;
+        return node->env_rq_right;
+    }
+
+    node->env_rq_left = rq_remove_min(node->env_rq_left, min);
+    return rq_balance(node);
+}
+
+static struct Env *
+rq_remove(struct Env *node, struct Env *env) {
+    assert(node);
+
+    if (node == env) {
+        struct Env *left = env->env_rq_left, *right = env->env_rq_right;
+        env->env_rq_left = env->env_rq_right = NULL;
+        if (!right) return left;
+
+        /* Successor takes place of the removed node */
+        struct Env *next;
+        right = rq_remove_min(right, &next);
+        next->env_rq_left = left;
+        next->env_rq_right = right;
+        return rq_balance(next);
+    }
+
+    if (rq_less(env, node))
+        node->env_rq_left = rq_remove(node->env_rq_left, env);
+    else
+        node->env_rq_right = rq_remove(node->env_rq_right, env);
+    return rq_balance(node);
+}
+
+static struct Env *
+rq_first(struct RunQueue *rq) {
+    struct Env *node = rq->root;
+    while (node && node->env_rq_left) node = node->env_rq_left;
+    return node;
+}
+
+/* Environment following env in the run queue order */
+static struct Env *
+rq_next(struct RunQueue *rq, struct Env *env) {
+    struct Env *res = NULL;
+    for (struct Env *node = rq->root; node;) {
+        if (rq_less(env, node)) {
+            res = node;
+            node = node->env_rq_left;
+        } else {
+            node = node->env_rq_right;
+        }
+    }
+    return res;
+}
+
+static void
+rq_enqueue(struct RunQueue *rq, struct Env *env) {
+    rq->root = rq_insert(rq->root, env);
+    rq->count++;
+}
+
+static void
+rq_dequeue(struct RunQueue *rq, struct Env *env) {
+    rq->root = rq_remove(rq->root, env);
+    rq->count--;
+    if (rq->yielded == env) rq->yielded = NULL;
+}
+
+/* Scheduler tick is needed only while other environments wait for
+ * the CPU or real-time environment runs: it's one-shot timer armed
+ * for the end of the time slice (or the budget) given as TSC value.
+ * It's stopped (deadline is 0) when the CPU is idle or has a single
+ * environment. Without local APIC periodic timer_for_schedule ticks */
+static void
+sched_tick(uint64_t deadline) {
+    if (!lapicaddr) return;
+
+    if (deadline)
+        lapic_timer_oneshot(deadline);
+    else if (!thiscpu->cpu_tick_stopped)
+        lapic_timer_stop();
+    thiscpu->cpu_tick_stopped = !deadline;
+}
+
+/* Makes sure environment just queued to CPU gets it: wakes up
+ * the CPU if it's halted. If the CPU is busy running another one,
+ * some halted CPU is woken up instead to steal it, and if there
+ * is none the tick of the CPU is started if it was stopped.
+ * Real-time environments run on the boot CPU only (the budget
+ * timer interrupts only it) and preempt normal ones right away */
+static void
+sched_kick(struct Env *env) {
+    struct CpuInfo *target = env->env_rt_period ? &cpus[0] : &cpus[env->env_cpu];
+
+    if (target->cpu_status != CPU_HALTED) {
+        /* CPU which is not running anything is about to pick */
+        struct Env *running = target->cpu_env;
+        if (!running || running == env || running->env_status != ENV_RUNNING) return;
+
+        if (env->env_rt_period) {
+            if (running->env_rt_period) return;
+            if (target == thiscpu) {
+                /* Timer fires as soon as the kernel is left */
+                lapic_timer_oneshot(read_tsc());
+                thiscpu->cpu_tick_stopped = 0;
+                return;
+            }
+        } else {
+            struct CpuInfo *idle = cpus;
+            while (idle < cpus + ncpu && idle->cpu_status != CPU_HALTED) idle++;
+
+            if (idle < cpus + ncpu) {
+                target = idle;
+            } else if (!target->cpu_tick_stopped) {
+                return;
+            } else if (target == thiscpu) {
+                sched_tick(read_tsc() + tsc_calibrate() / SCHED_TICK_HZ);
+                return;
+            }
+        }
+    }
+
+    lapic_ipi(target->cpu_id, IRQ_OFFSET + IRQ_RESCHEDULE);
+}
+
+/* Moves environment that would run next on the busiest CPU to this
+ * one if the busiest one has at least two environments waiting
+ * more than this one (or any if this one is idle). Its virtual
+ * runtime keeps the same distance to min_vruntime of the queue */
+static void
+rq_steal(struct RunQueue *rq) {
+    struct RunQueue *busiest = NULL;
+    for (struct RunQueue *other = run_queues; other < run_queues + ncpu; other++)
+        if (other != rq && (!busiest || other->count > busiest->count)) busiest = other;
+
+    if (!busiest || !busiest->count || (rq->count && busiest->count < rq->count + 2)) return;
+
+    struct Env *env = rq_first(busiest);
+    rq_dequeue(busiest, env);
+
+    if (env->env_vruntime >= busiest->min_vruntime) {
+        env->env_vruntime = rq->min_vruntime + (env->env_vruntime - busiest->min_vruntime);
+    } else {
+        uint64_t lag = MIN(busiest->min_vruntime - env->env_vruntime, SCHED_SLEEPER_CREDIT);
+        env->env_vruntime = rq->min_vruntime - MIN(lag, rq->min_vruntime);
+    }
+
+    env->env_cpu = rq - run_queues;
+    rq_enqueue(rq, env);
+}
+
+/* Sets status of the environment keeping
+ * run queues consistent. Every change of
+ * status of allocated environment goes through it */
+void
+env_set_status(struct Env *env, unsigned status) {
+    bool was_queued = env->env_status == ENV_RUNNABLE && !env->env_rt_period;
+    struct RunQueue *rq = &run_queues[env->env_cpu];
+
+    if (was_queued && status != ENV_RUNNABLE) {
+        rq_dequeue(rq, env);
+    } else if (!was_queued && status == ENV_RUNNABLE && !env->env_rt_period) {
+        /* Environment that was blocked or is new is
+         * allowed to be at most SCHED_SLEEPER_CREDIT behind */
+        if (env->env_vruntime + SCHED_SLEEPER_CREDIT < rq->min_vruntime)
+            env->env_vruntime = rq->min_vruntime - SCHED_SLEEPER_CREDIT;
+        rq_enqueue(rq, env);
+        sched_kick(env);
+    } else if (env->env_status != ENV_RUNNABLE && status == ENV_RUNNABLE && env->env_rt_period) {
+        sched_kick(env);
+    }
+
+    env->env_status = status;
+
+    /* Freed environment gives up its reservation */
+    if (status == ENV_FREE && env->env_rt_period)
+        env_set_rt(env, 0, 0, 0);
+}
+
+/* Changes weight of the environment, which is
+ * its key in the run queue if it's runnable */
+void
+env_set_weight(struct Env *env, uint32_t weight) {
+    assert(weight >= SCHED_WEIGHT_MIN && weight <= SCHED_WEIGHT_MAX);
+
+    sched_account(env);
+    env->env_weight = weight;
+}
+
+inline static uint64_t
+rt_load_of(uint64_t budget, uint64_t deadline) {
+    return ROUNDUP(budget * 1000, deadline) / deadline;
+}
+
+/* Moves the environment to real-time class with the given
+ * parameters (or back to normal class if period is 0) if
+ * total load of real-time environments stays acceptable */
+int
+env_set_rt(struct Env *env, uint64_t period, uint64_t budget, uint64_t deadline) {
+    uint64_t old_load = env->env_rt_period ? rt_load_of(env->env_rt_budget, env->env_rt_deadline) : 0;
+    uint64_t new_load = period ? rt_load_of(budget, deadline) : 0;
+    if (rt_load - old_load + new_load > SCHED_RT_MAX_LOAD) return -E_OVERLOAD;
+
+    sched_account(env);
+
+    /* Environment is taken out of its class and put back into new one */
+    unsigned status = env->env_status;
+    if (status == ENV_RUNNABLE) env_set_status(env, ENV_NOT_RUNNABLE);
+
+    if (!env->env_rt_period && period) {
+        env->env_rt_next = rt_envs;
+        rt_envs = env;
+    } else if (env->env_rt_period && !period) {
+        struct Env **pprev = &rt_envs;
+        while (*pprev != env) pprev = &(*pprev)->env_rt_next;
+        *pprev = env->env_rt_next;
+    }
+
+    rt_load = rt_load - old_load + new_load;
+    env->env_rt_period = period;
+    env->env_rt_budget = budget;
+    env->env_rt_deadline = deadline;
+    env->env_rt_release = read_tsc();
+    env->env_rt_used = 0;
+
+    if (status == ENV_RUNNABLE) env_set_status(env, ENV_RUNNABLE);
+
+    /* Real-time environment running on other CPU is moved to the boot one */
+    if (period && status == ENV_RUNNING && env != curenv && env->env_cpu)
+        lapic_ipi(cpus[env->env_cpu].cpu_id, IRQ_OFFSET + IRQ_RESCHEDULE);
+    return 0;
+}
+
+/* Starts new period of real-time environment
+ * with full budget if the current one has ended */
+static void
+rt_replenish(struct Env *env, uint64_t now) {
+    uint64_t elapsed = now - env->env_rt_release;
+    if (elapsed < env->env_rt_period) return;
+
+    env->env_rt_release += elapsed - elapsed % env->env_rt_period;
+    env->env_rt_used = 0;
+}
+
+/* Earliest deadline first: picks runnable real-time
+ * environment with budget left, which deadline is the closest */
+static struct Env *
+rt_pick(uint64_t now) {
+    struct Env *best = NULL;
+    for (struct Env *env = rt_envs; env; env = env->env_rt_next) {
+        rt_replenish(env, now);
+        if (env->env_status != ENV_RUNNABLE || env->env_rt_used >= env->env_rt_budget) continue;
+        if (!best || env->env_rt_release + env->env_rt_deadline < best->env_rt_release + best->env_rt_deadline)
+            best = env;
+    }
+    return best;
+}
+
+/* Arms one-shot timer for the next point real-time environments
+ * need the scheduler: when the chosen one (or one running on other
+ * CPU) exhausts its budget, or when a runnable one that is out of
+ * budget gets the new one */
+static void
+rt_arm_timer(struct Env *next, uint64_t now) {
+    uint64_t event = UINT64_MAX;
+    for (struct Env *env = rt_envs; env; env = env->env_rt_next) {
+        if (env == next)
+            event = MIN(event, now + env->env_rt_budget - env->env_rt_used);
+        else if (env->env_status == ENV_RUNNING && env->env_run_start)
+            event = MIN(event, env->env_run_start + env->env_rt_budget - MIN(env->env_rt_used, env->env_rt_budget));
+        else if (env->env_status == ENV_RUNNABLE && env->env_rt_used >= env->env_rt_budget)
+            event = MIN(event, env->env_rt_release + env->env_rt_period);
+    }
+
+    if (event != UINT64_MAX)
+        hpet_oneshot_arm(event);
+    else
+        hpet_oneshot_cancel();
+}
+
+/* Whether there is a runnable real-time environment
+ * waiting for the start of the next period */
+static bool
+rt_waiting(void) {
+    for (struct Env *env = rt_envs; env; env = env->env_rt_next)
+        if (env->env_status == ENV_RUNNABLE) return 1;
+    return 0;
+}
+
+/* Charges the environment for CPU time used since it was
+ * started (or last charged). Time of normal environments
+ * is scaled by the inverse of their weight, real-time
+ * ones spend the budget of the current period */
+void
+sched_account(struct Env *env) {
+    if (!env->env_run_start || env->env_status == ENV_FREE) return;
+
+    uint64_t now = read_tsc();
+    uint64_t delta = now - env->env_run_start;
+    env->env_run_start = env->env_status == ENV_RUNNING ? now : 0;
+    env->env_runtime += delta;
+
+    if (env->env_rt_period) {
+        env->env_rt_used += delta;
+        return;
+    }
+
+    struct RunQueue *rq = &run_queues[env->env_cpu];
+    bool queued = env->env_status == ENV_RUNNABLE;
+    if (queued) rq->root = rq_remove(rq->root, env);
+    env->env_vruntime += delta * SCHED_WEIGHT_DEFAULT / env->env_weight;
+    if (queued) rq->root = rq_insert(rq->root, env);
+}
+
+/* Makes the next sched_yield() prefer any other
+ * runnable environment over env. Real-time
+ * environment waits for the next period */
+void
+sched_skip(struct Env *env) {
+    if (env->env_rt_period)
+        env->env_rt_used = MAX(env->env_rt_used, env->env_rt_budget);
+    else
+        run_queues[env->env_cpu].yielded = env;
+}
 
 /* Choose a user environment to run and run it */
 _Noreturn void
 sched_yield(void) {
-    /* Implement simple round-robin scheduling.
-     *
-     * Search through 'envs' for an ENV_RUNNABLE environment in
-     * circular fashion starting just after the env was
-     * last running.  Switch to the first such environment found.
-     *
-     * If no envs are runnable, but the environment previously
-     * running is still ENV_RUNNING, it's okay to
-     * choose that environment.
+    /* Environment destroyed by other CPU
+     * while it was running on this one */
+    if (curenv && curenv->env_status == ENV_DYING) {
+        in_page_fault = 0;
+        env_free(curenv);
+        curenv = NULL;
+    }
+
+    /* Free a bounded part of memory of exited environments */
+    teardown_spaces(TEARDOWN_SLICE);
+
+    /* Previously running environment competes with
+     * others for the CPU after being charged for it. */
+    if (curenv) {
+        sched_account(curenv);
+        curenv->env_run_start = 0;
+        if (curenv->env_status == ENV_RUNNING)
+            env_set_status(curenv, ENV_RUNNABLE);
+    }
+
+    /* Real-time environments with budget left run first
+     * (on the boot CPU, which gets budget timer interrupts).
+     * Otherwise environment with the least virtual runtime is
+     * the one that got the least CPU time relative to its weight.
+     * Environment that yielded runs only if it's alone.
+     * CPU takes environments from the busiest one when its
+     * own run queue is (relatively) empty.
      *
      * If there are no runnable environments,
      * simply drop through to the code
      * below to halt the cpu */
 
-    // LAB 3: Your code here:
-    static int last = NENV - 1;
-    int it = (last + 1) % NENV;
-    
-    for (; it != last && envs[it].env_status != ENV_RUNNABLE; it = (it + 1) % NENV)
-        ;
-    last = it;
-    
-    if (envs[it].env_status == ENV_RUNNABLE || envs[it].env_status == ENV_RUNNING)
-        env_run(&envs[it]);
+    struct RunQueue *rq = &run_queues[cpunum()];
+    uint64_t now = read_tsc();
+    struct Env *next = cpunum() ? NULL : rt_pick(now);
+    if (!next) {
+        if (ncpu > 1) rq_steal(rq);
+        next = rq_first(rq);
+        if (next && next == rq->yielded) {
+            struct Env *other = rq_next(rq, next);
+            if (other) next = other;
+        }
+        if (next) rq->min_vruntime = MAX(rq->min_vruntime, next->env_vruntime);
+    }
+    rq->yielded = NULL;
 
-    cprintf("Halt\n");
+    rt_arm_timer(next, now);
+
+    /* Real-time environment is preempted when its budget is exhausted
+     * (the timer above is not there without HPET, so the local one is
+     * armed as well), normal one when its time slice ends if other
+     * environments wait for the CPU. Otherwise tick is stopped */
+    if (next && next->env_rt_period)
+        sched_tick(now + next->env_rt_budget - next->env_rt_used);
+    else if (next && rq->count > 1)
+        sched_tick(now + tsc_calibrate() / SCHED_TICK_HZ);
+    else
+        sched_tick(0);
+    if (next) env_run(next);
+
+    if (!rt_waiting() && !sched_busy()) cprintf("Halt\n");
 
     /* No runnable environments,
      * so just halt the cpu */
     sched_halt();
 }
 
+/* Whether some environment is running on any CPU (or is
+ * to be freed by CPU it was running on when destroyed) */
+static bool
+sched_busy(void) {
+    for (int i = 0; i < ncpu; i++) {
+        struct Env *env = cpus[i].cpu_env;
+        if (env && (env->env_status == ENV_RUNNING || env->env_status == ENV_DYING)) return 1;
+    }
+    return 0;
+}
+
 /* Halt this CPU when there is nothing to do. Wait until the
  * timer interrupt wakes it up. This function never returns */
 _Noreturn void
@@ -49,17 +534,29 @@ sched_halt(void) {
 
     /* For debugging and testing purposes, if there are no runnable
      * environments in the system, then drop into the kernel monitor */
-    int i;
-    for (i = 0; i < NENV; i++)
-        if (envs[i].env_status == ENV_RUNNABLE ||
-            envs[i].env_status == ENV_RUNNING) break;
-    if (i == NENV) {
+    bool queued = 0;
+    for (int i = 0; i < ncpu; i++)
+        queued |= run_queues[i].count > 0;
+    if (!queued && !rt_waiting() && !sched_busy()) {
         cprintf("No runnable environments in the system!\n");
         for (;;) monitor(NULL);
     }
 
     /* Mark that no environment is running on CPU */
     curenv = NULL;
+#ifndef CONFIG_KSPACE
+    /* Address space of the last environment may be freed by other CPU */
+    switch_address_space(&kspace);
+#endif
+
+    /* Use idle time for background memory management */
+    pmap_idle_work();
+    irq_latency_end();
+
+    /* Other CPUs may enter the kernel while this one is halted,
+     * the lock is taken back in trap() when it's woken up */
+    xchg(&thiscpu->cpu_status, CPU_HALTED);
+    unlock_kernel();
 
     /* Reset stack pointer, enable interrupts and then halt */
     asm volatile(
@@ -68,7 +565,8 @@ sched_halt(void) {
             "pushq $0\n"
             "pushq $0\n"
             "sti\n"
-            "hlt\n" ::"a"(cpu_ts.ts_rsp0));
+            "1: hlt\n"
+            "jmp 1b\n" ::"a"(thiscpu->cpu_ts.ts_rsp0));
 
     /* Unreachable */
     for (;;)
@@ -6,6 +6,30 @@
 #error "This is a JOS kernel header; user programs should not #include it"
 #endif
 
+#include <kern/env.h>
+
+/* Default weight of the file system server */
+#define SCHED_WEIGHT_FS (4 * SCHED_WEIGHT_DEFAULT)
+
+/* Virtual runtime (in TSC cycles) an environment
+ * that was not runnable can be behind others */
+#define SCHED_SLEEPER_CREDIT (1ULL << 22)
+
+/* Length of time slice is 1 / SCHED_TICK_HZ seconds
+ * when several environments share the CPU */
+#define SCHED_TICK_HZ 100
+
+/* Part of CPU time (in per mille) real-time environments can reserve,
+ * the rest is left to others. Reservations are admitted as long as sum
+ * of budget / deadline of all of them is below it,
+ * so that EDF meets every deadline */
+#define SCHED_RT_MAX_LOAD 900
+
 _Noreturn void sched_yield(void);
+void sched_skip(struct Env *env);
+void sched_account(struct Env *env);
+void env_set_status(struct Env *env, unsigned status);
+void env_set_weight(struct Env *env, uint32_t weight);
+int env_set_rt(struct Env *env, uint64_t period, uint64_t budget, uint64_t deadline);
 
 #endif /* !JOS_KERN_SCHED_H */
@@ -7,6 +7,7 @@
 #include <inc/string.h>
 #include <kern/spinlock.h>
 #include <kern/kdebug.h>
+#include <kern/pmap.h>
 #include <kern/traceopt.h>
 
 /* The big kernel lock */
@@ -34,7 +35,7 @@ get_caller_pcs(uint64_t pcs[]) {
 /* Check whether this CPU is holding the lock. */
 static int
 holding(struct spinlock *lock) {
-    return lock->locked;
+    return lock->locked && lock->cpu == cpunum();
 }
 #endif
 
@@ -63,10 +64,38 @@ spin_lock(struct spinlock *lk) {
 
         /* Record info about lock acquisition for debugging. */
 #if trace_spinlock
+    lk->cpu = cpunum();
     get_caller_pcs(lk->pcs);
 #endif
 }
 
+/* Try to acquire the lock once, returns whether it succeeded */
+bool
+spin_trylock(struct spinlock *lk) {
+#if trace_spinlock
+    if (holding(lk)) panic("Cannot acquire %s: already holding", lk->name);
+#endif
+
+    if (xchg(&lk->locked, 1)) return 0;
+
+#if trace_spinlock
+    lk->cpu = cpunum();
+    get_caller_pcs(lk->pcs);
+#endif
+    return 1;
+}
+
+/* Acquire the big kernel lock. CPU holding it may be waiting
+ * for TLB shootdown to be done by this one, which can't take
+ * the interrupt now, so requests are served while spinning */
+void
+lock_kernel(void) {
+    while (!spin_trylock(&kernel_lock)) {
+        tlb_shootdown_poll();
+        asm volatile("pause");
+    }
+}
+
 /* Release the lock. */
 void
 spin_unlock(struct spinlock *lk) {
@@ -91,6 +120,7 @@ spin_unlock(struct spinlock *lk) {
     }
 
     lk->pcs[0] = 0;
+    lk->cpu = -1;
 #endif
 
     /* The xchg serializes, so that reads before release are
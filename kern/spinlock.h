@@ -11,6 +11,7 @@ struct spinlock {
 #if trace_spinlock
     /* For debugging: */
     char *name;        /* Name of lock */
+    int cpu;           /* The CPU holding the lock */
     uintptr_t pcs[10]; /* The call stack (an array of program counters)
                         * that locked the lock */
 #endif
@@ -18,16 +19,14 @@ struct spinlock {
 
 void __spin_initlock(struct spinlock *lk, char *name);
 void spin_lock(struct spinlock *lk);
+bool spin_trylock(struct spinlock *lk);
 void spin_unlock(struct spinlock *lk);
 
 #define spin_initlock(lock) __spin_initlock(lock, #lock)
 
 extern struct spinlock kernel_lock;
 
-static inline void
-lock_kernel(void) {
-    spin_lock(&kernel_lock);
-}
+void lock_kernel(void);
 
 static inline void
 unlock_kernel(void) {
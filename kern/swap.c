@@ -0,0 +1,156 @@
+/* See COPYRIGHT for copyright information. */
+
+/*
+ * Swap device.
+ * Minimal PIO IDE driver for the master disk of
+ * the secondary channel (primary one is owned by the
+ * file system environment) and allocator of 4K slots
+ * inside of the JOS swap partition of that disk.
+ */
+
+#include <inc/assert.h>
+#include <inc/error.h>
+#include <inc/partition.h>
+#include <inc/string.h>
+#include <inc/x86.h>
+
+#include <kern/swap.h>
+#include <kern/traceopt.h>
+
+#define PAGE_SECTS (PAGE_SIZE / SWAP_SECTSIZE)
+
+/* Number of status polls before disk is considered to be dead */
+#define IDE_TIMEOUT 1000000
+
+static uint64_t swap_map[SWAP_MAX_SLOTS / 64];
+static uint32_t swap_lba, swap_slots, swap_used, swap_hint;
+
+static int
+ide_wait_ready(bool check_error) {
+    int r = 0;
+    for (size_t i = 0; i < IDE_TIMEOUT; i++) {
+        r = inb(IDE2_BASE + IDE_STATUS);
+        /* Floating bus reads as 0xFF, channel without drives as 0 */
+        if (r == 0xFF || !r) return -E_NOT_FOUND;
+        if ((r & (IDE_BSY | IDE_DRDY)) == IDE_DRDY) {
+            if (check_error && r & (IDE_DF | IDE_ERR)) return -E_UNSPECIFIED;
+            return 0;
+        }
+    }
+    return -E_UNSPECIFIED;
+}
+
+static int
+ide_start(uint32_t secno, size_t nsecs, int cmd) {
+    assert(nsecs && nsecs <= 256);
+    assert(secno < (1U << 28));
+
+    int res = ide_wait_ready(0);
+    if (res < 0) return res;
+
+    outb(IDE2_BASE + IDE_NSECT, nsecs & 0xFF);
+    outb(IDE2_BASE + IDE_LBA0, secno & 0xFF);
+    outb(IDE2_BASE + IDE_LBA1, (secno >> 8) & 0xFF);
+    outb(IDE2_BASE + IDE_LBA2, (secno >> 16) & 0xFF);
+    outb(IDE2_BASE + IDE_DRIVE, 0xE0 | ((secno >> 24) & 0x0F));
+    outb(IDE2_BASE + IDE_COMMAND, cmd);
+    return 0;
+}
+
+static int
+ide_read(uint32_t secno, void *dst, size_t nsecs) {
+    int res = ide_start(secno, nsecs, IDE_CMD_READ);
+    for (; !res && nsecs; nsecs--, dst += SWAP_SECTSIZE) {
+        if ((res = ide_wait_ready(1)) < 0) break;
+        insl(IDE2_BASE + IDE_DATA, dst, SWAP_SECTSIZE / 4);
+    }
+    return res;
+}
+
+static int
+ide_write(uint32_t secno, const void *src, size_t nsecs) {
+    int res = ide_start(secno, nsecs, IDE_CMD_WRITE);
+    for (; !res && nsecs; nsecs--, src += SWAP_SECTSIZE) {
+        if ((res = ide_wait_ready(1)) < 0) break;
+        outsl(IDE2_BASE + IDE_DATA, src, SWAP_SECTSIZE / 4);
+    }
+    /* Wait for the last sector to be written */
+    return res ? res : ide_wait_ready(1);
+}
+
+/* Finds swap partition in the partition table of the disk */
+void
+swap_init(void) {
+    static uint8_t sect[SWAP_SECTSIZE];
+
+    /* Polling driver, interrupts are not needed */
+    outb(IDE2_CTRL, IDE_CTRL_NIEN);
+    outb(IDE2_BASE + IDE_DRIVE, 0xE0);
+
+    if (ide_read(0, sect, 1) < 0 ||
+        memcmp(sect + PTABLE_MAGIC_OFFSET, PTABLE_MAGIC, 2)) {
+        if (trace_init) cprintf("Swap: no disk\n");
+        return;
+    }
+
+    struct Partitiondesc *part = (struct Partitiondesc *)(sect + PTABLE_OFFSET);
+    for (size_t i = 0; i < 4; i++, part++) {
+        if (part->type != PTYPE_JOS_SWAP) continue;
+        swap_lba = part->lba_start;
+        swap_slots = MIN(part->lba_length / PAGE_SECTS, SWAP_MAX_SLOTS);
+        break;
+    }
+
+    if (trace_init) cprintf("Swap: %uK available\n", swap_slots * (uint32_t)(PAGE_SIZE / 1024));
+}
+
+bool
+swap_enabled(void) {
+    return swap_slots;
+}
+
+int
+swap_alloc_slot(uint32_t *slot) {
+    if (swap_used == swap_slots) return -E_NO_DISK;
+
+    /* Search for the free slot starting from the last allocated one,
+     * so that evicted pages are written mostly sequentially */
+    for (uint32_t n = 0, i = swap_hint; n <= swap_slots / 64; n++, i = (i + 64) % ROUNDUP(swap_slots, 64)) {
+        uint64_t free = ~swap_map[i / 64];
+        if (!free) continue;
+        uint32_t res = (i & ~63) + __builtin_ctzll(free);
+        if (res >= swap_slots) continue;
+        swap_map[res / 64] |= 1ULL << (res % 64);
+        swap_used++;
+        swap_hint = res;
+        *slot = res;
+        return 0;
+    }
+    return -E_NO_DISK;
+}
+
+void
+swap_free_slot(uint32_t slot) {
+    assert(slot < swap_slots);
+    assert(swap_map[slot / 64] & (1ULL << (slot % 64)));
+    swap_map[slot / 64] &= ~(1ULL << (slot % 64));
+    swap_used--;
+}
+
+int
+swap_read(uint32_t slot, void *dst) {
+    assert(slot < swap_slots);
+    return ide_read(swap_lba + slot * PAGE_SECTS, dst, PAGE_SECTS);
+}
+
+int
+swap_write(uint32_t slot, const void *src) {
+    assert(slot < swap_slots);
+    return ide_write(swap_lba + slot * PAGE_SECTS, src, PAGE_SECTS);
+}
+
+void
+swap_usage(size_t *used, size_t *total) {
+    *used = swap_used;
+    *total = swap_slots;
+}
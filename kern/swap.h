@@ -0,0 +1,48 @@
+/* See COPYRIGHT for copyright information. */
+
+#ifndef JOS_KERN_SWAP_H
+#define JOS_KERN_SWAP_H
+#ifndef JOS_KERNEL
+#error "This is a JOS kernel header; user programs should not #include it"
+#endif
+
+#include <inc/types.h>
+#include <inc/mmu.h>
+
+/* Secondary IDE channel (swap disk is the master device of it) */
+#define IDE2_BASE 0x170
+#define IDE2_CTRL 0x376
+
+#define IDE_DATA    0
+#define IDE_NSECT   2
+#define IDE_LBA0    3
+#define IDE_LBA1    4
+#define IDE_LBA2    5
+#define IDE_DRIVE   6
+#define IDE_STATUS  7
+#define IDE_COMMAND 7
+
+#define IDE_BSY  0x80
+#define IDE_DRDY 0x40
+#define IDE_DF   0x20
+#define IDE_DRQ  0x08
+#define IDE_ERR  0x01
+
+#define IDE_CMD_READ  0x20
+#define IDE_CMD_WRITE 0x30
+#define IDE_CTRL_NIEN 0x02
+
+#define SWAP_SECTSIZE 512
+
+/* Largest supported swap partition (in 4K slots) */
+#define SWAP_MAX_SLOTS (4ULL * 1024 * 1024 * 1024 / PAGE_SIZE)
+
+void swap_init(void);
+bool swap_enabled(void);
+int swap_alloc_slot(uint32_t *slot);
+void swap_free_slot(uint32_t slot);
+int swap_read(uint32_t slot, void *dst);
+int swap_write(uint32_t slot, const void *src);
+void swap_usage(size_t *used, size_t *total);
+
+#endif /* !JOS_KERN_SWAP_H */
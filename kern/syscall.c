@@ -82,6 +82,7 @@ static void
 sys_yield(void) {
     // LAB 9: Your code here
 
+    sched_skip(curenv);
     sched_yield();
 }
 
@@ -104,7 +105,7 @@ sys_exofork(void) {
     if (res < 0)
         return res;
 
-    child_ptr->env_status = ENV_NOT_RUNNABLE;
+    env_set_status(child_ptr, ENV_NOT_RUNNABLE);
     child_ptr->env_tf = curenv->env_tf;
 
     child_ptr->env_tf.tf_regs.reg_rax = 0;
@@ -135,11 +136,56 @@ sys_env_set_status(envid_t envid, int status) {
     int res = envid2env(envid, &env, 1);
     if (res < 0)
         return res;
-    env->env_status = status;
+    env_set_status(env, status);
 
     return 0;
 }
 
+/* Set scheduling weight of environment envid. Runnable environments
+ * get CPU time proportionally to their weights.
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_BAD_ENV if environment envid doesn't currently exist,
+ *      or the caller doesn't have permission to change envid.
+ *  -E_INVAL if weight is outside of
+ *      [SCHED_WEIGHT_MIN, SCHED_WEIGHT_MAX] range. */
+static int
+sys_env_set_weight(envid_t envid, uint32_t weight) {
+    if (weight < SCHED_WEIGHT_MIN || weight > SCHED_WEIGHT_MAX)
+        return -E_INVAL;
+
+    struct Env *env = NULL;
+    int res = envid2env(envid, &env, 1);
+    if (res < 0) return res;
+
+    env_set_weight(env, weight);
+    return 0;
+}
+
+/* Put environment envid into real-time scheduling class. Every period
+ * TSC cycles it can run for budget cycles, and it's guaranteed to
+ * get them within deadline cycles after the start of the period,
+ * as long as it's runnable. Zero period returns it to the normal class.
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_BAD_ENV if environment envid doesn't currently exist,
+ *      or the caller doesn't have permission to change envid.
+ *  -E_INVAL if budget is 0, or it is larger than deadline,
+ *      or deadline is larger than period.
+ *  -E_OVERLOAD if real-time environments would not be
+ *      able to meet their deadlines. */
+static int
+sys_env_set_rt(envid_t envid, uint64_t period, uint64_t budget, uint64_t deadline) {
+    if (period && (!budget || budget > deadline || deadline > period))
+        return -E_INVAL;
+
+    struct Env *env = NULL;
+    int res = envid2env(envid, &env, 1);
+    if (res < 0) return res;
+
+    return env_set_rt(env, period, budget, deadline);
+}
+
 /* Set the page fault upcall for 'envid' by modifying the corresponding struct
  * Env's 'env_pgfault_upcall' field.  When 'envid' causes a page fault, the
  * kernel will push a fault record onto the exception stack, then branch to
@@ -191,8 +237,30 @@ is_align(uintptr_t va, uintptr_t size)
     return va + size <= MAX_USER_ADDRESS && (va & CLASS_MASK(0)) == 0;
 }
 
+/* Progress of region operation of the current environment,
+ * it is reset unless the call restarts an interrupted one */
+static size_t *
+region_progress(uintptr_t va) {
+    if (curenv->env_region_va != va) {
+        curenv->env_region_done = 0;
+        curenv->env_region_op = 0;
+    }
+    curenv->env_region_va = va;
+    return &curenv->env_region_done;
+}
+
+/* Forgets progress unless the call is going to be restarted */
 static int
-sys_alloc_region(envid_t envid, uintptr_t addr, size_t size, int perm) {
+region_finish(int res) {
+    if (res != -E_RESTART) {
+        curenv->env_region_done = 0;
+        curenv->env_region_op = 0;
+    }
+    return res;
+}
+
+static int
+do_alloc_region(envid_t envid, uintptr_t addr, size_t size, int perm) {
     // LAB 9: Your code here:
 
     if (!is_align(addr, size)
@@ -235,8 +303,8 @@ sys_alloc_region(envid_t envid, uintptr_t addr, size_t size, int perm) {
  *  -E_NO_MEM if there's no memory to allocate any necessary page tables. */
 
 static int
-sys_map_region(envid_t srcenvid, uintptr_t srcva,
-               envid_t dstenvid, uintptr_t dstva, size_t size, int perm) {
+do_map_region(envid_t srcenvid, uintptr_t srcva, envid_t dstenvid, uintptr_t dstva,
+              size_t size, int perm, size_t *done, uint64_t deadline) {
     // LAB 9: Your code here
 
     if (perm & (~PROT_ALL)) return -E_INVAL;
@@ -255,13 +323,27 @@ sys_map_region(envid_t srcenvid, uintptr_t srcva,
 
     perm |= PROT_USER_;
 
-    res = map_region(&dst->address_space, dstva, &src->address_space, srcva, size, perm);
+    res = map_region_bounded(&dst->address_space, dstva, &src->address_space, srcva, size, perm, done, deadline);
     if (res < 0)
         return res;
 
     return 0;
 }
 
+static int
+sys_alloc_region(envid_t envid, uintptr_t addr, size_t size, int perm) {
+    return do_alloc_region(envid, addr, size, perm);
+}
+
+/* Huge regions are mapped in slices, the call
+ * is restarted after pending interrupts are handled */
+static int
+sys_map_region(envid_t srcenvid, uintptr_t srcva,
+               envid_t dstenvid, uintptr_t dstva, size_t size, int perm) {
+    return region_finish(do_map_region(srcenvid, srcva, dstenvid, dstva, size, perm,
+                                       region_progress(dstva), read_tsc() + REGION_SLICE_CYCLES));
+}
+
 /* Unmap the region of memory at 'va' in the address space of 'envid'.
  * If no page is mapped, the function silently succeeds.
  *
@@ -270,7 +352,7 @@ sys_map_region(envid_t srcenvid, uintptr_t srcva,
  *      or the caller doesn't have permission to change envid.
  *  -E_INVAL if va >= MAX_USER_ADDRESS, or va is not page-aligned. */
 static int
-sys_unmap_region(envid_t envid, uintptr_t va, size_t size) {
+do_unmap_region(envid_t envid, uintptr_t va, size_t size, size_t *done, uint64_t deadline) {
     /* Hint: This function is a wrapper around unmap_region(). */
 
     // LAB 9: Your code here
@@ -283,11 +365,68 @@ sys_unmap_region(envid_t envid, uintptr_t va, size_t size) {
     if (res < 0)
         return res;
 
-    unmap_region(&env->address_space, va, size);
+    res = unmap_region_bounded(&env->address_space, va, size, done, deadline);
+    if (res < 0)
+        return res;
 
     return 0;
 }
 
+static int
+sys_unmap_region(envid_t envid, uintptr_t va, size_t size) {
+    return region_finish(do_unmap_region(envid, va, size,
+                                         region_progress(va), read_tsc() + REGION_SLICE_CYCLES));
+}
+
+/* Performs up to REGION_BATCH_MAX region operations in order,
+ * TLB is invalidated once after all of them.
+ * Stops at the first failed operation (preceding ones are not undone).
+ * Batch is restarted from the interrupted operation like sys_map_region.
+ *
+ * Return 0 on success, < 0 on error.  Errors are:
+ *  -E_INVAL if count is larger than REGION_BATCH_MAX
+ *      or operation type is unknown.
+ *  Errors of the failed operation. */
+static int
+sys_region_batch(const struct RegionOp *uops, size_t count) {
+    struct RegionOp ops[REGION_BATCH_MAX];
+    if (count > REGION_BATCH_MAX) return -E_INVAL;
+
+    user_mem_assert(curenv, uops, count * sizeof *uops, PROT_R);
+    nosan_memcpy(ops, (void *)uops, count * sizeof *uops);
+
+    uint64_t deadline = read_tsc() + REGION_SLICE_CYCLES;
+    size_t *done = region_progress((uintptr_t)uops);
+    int res = 0;
+
+    tlb_batch_begin();
+    while (!res && curenv->env_region_op < count) {
+        struct RegionOp *op = &ops[curenv->env_region_op];
+        switch (op->type) {
+        case REGION_ALLOC:
+            res = do_alloc_region(op->dstenv, op->dstva, op->size, op->perm);
+            break;
+        case REGION_MAP:
+            res = do_map_region(op->srcenv, op->srcva, op->dstenv, op->dstva, op->size, op->perm, done, deadline);
+            break;
+        case REGION_UNMAP:
+            res = do_unmap_region(op->dstenv, op->dstva, op->size, done, deadline);
+            break;
+        default:
+            res = -E_INVAL;
+        }
+
+        if (!res) {
+            curenv->env_region_op++;
+            *done = 0;
+        }
+    }
+    tlb_batch_end();
+
+    return region_finish(res);
+}
+
+
 /* Try to send 'value' to the target env 'envid'.
  * If srcva < MAX_USER_ADDRESS, then also send region currently mapped at 'srcva',
  * so receiver also gets mapping.
@@ -365,7 +504,7 @@ sys_ipc_try_send(envid_t envid, uint32_t value, uintptr_t srcva, size_t size, in
     dstenv->env_ipc_value   = value;
     dstenv->env_ipc_perm    = perm;
 
-    dstenv->env_status = ENV_RUNNABLE;
+    env_set_status(dstenv, ENV_RUNNABLE);
     dstenv->env_tf.tf_regs.reg_rax = 0;
     return 0;
 }
@@ -398,7 +537,7 @@ sys_ipc_recv(uintptr_t dstva, uintptr_t maxsize) {
     curenv->env_ipc_dstva = dstva;
     curenv->env_ipc_maxsz = maxsize;
 
-    curenv->env_status = ENV_NOT_RUNNABLE;
+    env_set_status(curenv, ENV_NOT_RUNNABLE);
     sched_yield();
 }
 
@@ -528,6 +667,12 @@ syscall(uintptr_t syscallno, uintptr_t a1, uintptr_t a2, uintptr_t a3, uintptr_t
     // LAB 11: Your code here
         case SYS_env_set_trapframe:
             return sys_env_set_trapframe((envid_t)a1, (struct Trapframe *)a2);
+        case SYS_region_batch:
+            return sys_region_batch((const struct RegionOp *)a1, (size_t)a2);
+        case SYS_env_set_weight:
+            return sys_env_set_weight((envid_t)a1, (uint32_t)a2);
+        case SYS_env_set_rt:
+            return sys_env_set_rt((envid_t)a1, (uint64_t)a2, (uint64_t)a3, (uint64_t)a4);
         default:
             return -E_NO_SYS;
     }
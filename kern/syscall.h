@@ -6,6 +6,9 @@
 
 #include <inc/syscall.h>
 
+/* Length of int $T_SYSCALL instruction (for restarting system calls) */
+#define SYSCALL_INSN_LEN 2
+
 uintptr_t syscall(uintptr_t num, uintptr_t a1, uintptr_t a2, uintptr_t a3, uintptr_t a4, uintptr_t a5, uintptr_t a6);
 
 #endif /* !JOS_KERN_SYSCALL_H */
@@ -10,6 +10,7 @@
 #include <kern/picirq.h>
 #include <kern/trap.h>
 #include <kern/pmap.h>
+#include <kern/tsc.h>
 
 #define kilo      (1000ULL)
 #define Mega      (kilo * kilo)
@@ -199,6 +200,16 @@ get_hpet(void) {
     return khpet;
 }
 
+/* Obtain and map MADT ACPI table address. */
+MADT *
+get_madt(void) {
+    static MADT *kmadt = NULL;
+    if (kmadt == NULL)
+        kmadt = acpi_find_table("APIC");
+
+    return kmadt;
+}
+
 /* Getting physical HPET timer address from its table. */
 HPETRegister *
 hpet_register(void) {
@@ -243,6 +254,10 @@ static volatile HPETRegister *hpetReg;
 static uint64_t hpetFemto = 0;
 /* HPET timer frequency */
 static uint64_t hpetFreq = 0;
+/* HPET timer 2 is available as one-shot timer */
+static bool hpetOneshot = 0;
+/* One-shot timer is armed and has not fired yet */
+static bool hpetOneshotArmed = 0;
 
 /* HPET timer initialisation */
 void
@@ -257,6 +272,14 @@ hpet_init() {
         /* cprintf("hpetFemto = %llu\n", hpetFemto); */
         hpetFreq = (1 * Peta) / hpetFemto;
         /* cprintf("HPET: Frequency = %d.%03dMHz\n", (uintptr_t)(hpetFreq / Mega), (uintptr_t)(hpetFreq % Mega)); */
+        /* Timer 2 is routed to IRQ_CLOCK (if it's allowed) as one-shot one.
+         * It is level triggered, so that its interrupts can be told
+         * apart from RTC ones by the interrupt status register */
+        if (HPET_NUM_TIM_CAP(cap) > 2 &&
+            HPET_TN_INT_ROUTE_CAP(hpetReg->TIM2_CONF) & (1 << IRQ_CLOCK)) {
+            hpetReg->TIM2_CONF = (IRQ_CLOCK << HPET_TN_INT_ROUTE_SHIFT) | HPET_TN_INT_TYPE_CNF;
+            hpetOneshot = 1;
+        }
         /* Enable ENABLE_CNF bit to enable timer */
         hpetReg->GEN_CONF |= HPET_ENABLE_CNF;
         nmi_enable();
@@ -333,6 +356,53 @@ hpet_handle_interrupts_tim1(void) {
     pic_send_eoi(IRQ_CLOCK);
 }
 
+/* One-shot timer never fires closer than this (in HPET ticks) to the time
+ * it's armed, so that comparator is not set to the value already passed */
+#define HPET_ONESHOT_MIN_TICKS 100
+/* Longer delays are shortened, timer is simply armed again when it fires */
+#define HPET_ONESHOT_MAX_CYCLES (1ULL << 34)
+
+/* Arms one-shot timer to raise IRQ_CLOCK at the time
+ * TSC reaches tsc_deadline. Does nothing if there is no HPET */
+void
+hpet_oneshot_arm(uint64_t tsc_deadline) {
+    if (!hpetOneshot) return;
+
+    uint64_t now = read_tsc();
+    uint64_t delta = tsc_deadline > now ? MIN(tsc_deadline - now, HPET_ONESHOT_MAX_CYCLES) : 0;
+    uint64_t ticks = MAX(delta * hpetFreq / tsc_calibrate(), HPET_ONESHOT_MIN_TICKS);
+
+    nmi_disable();
+    hpetReg->TIM2_CONF &= ~HPET_TN_INT_ENB_CNF;
+    hpetReg->TIM2_COMP = hpetReg->MAIN_CNT + ticks;
+    hpetReg->TIM2_CONF |= HPET_TN_INT_ENB_CNF;
+    nmi_enable();
+
+    pic_irq_unmask(IRQ_CLOCK);
+    hpetOneshotArmed = 1;
+}
+
+void
+hpet_oneshot_cancel(void) {
+    if (!hpetOneshotArmed) return;
+    hpetReg->TIM2_CONF &= ~HPET_TN_INT_ENB_CNF;
+    hpetOneshotArmed = 0;
+}
+
+/* Acknowledges interrupt of one-shot timer.
+ * Returns false if IRQ_CLOCK was raised by something else */
+bool
+hpet_oneshot_ack(void) {
+    if (!hpetOneshot || !(hpetReg->GINTR_STA & (1 << 2))) return 0;
+
+    hpetReg->TIM2_CONF &= ~HPET_TN_INT_ENB_CNF;
+    hpetOneshotArmed = 0;
+    /* Status bits are cleared by writing 1 */
+    hpetReg->GINTR_STA = 1 << 2;
+    pic_send_eoi(IRQ_CLOCK);
+    return 1;
+}
+
 /* Calculate CPU frequency in Hz with the help with HPET timer.
  * HINT Use hpet_get_main_cnt function and do not forget about
  * about pause instruction. */
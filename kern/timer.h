@@ -94,6 +94,10 @@ typedef struct {
 #define HPET_TN_VAL_SET_CNF     (1 << 6)
 #define HPET_TN_SIZE_CAP        (1 << 5)
 #define HPET_TN_PER_INT_CAP     (1 << 4)
+#define HPET_TN_INT_TYPE_CNF    (1 << 1)
+#define HPET_TN_INT_ROUTE_SHIFT 9
+#define HPET_TN_INT_ROUTE_CAP(conf) ((conf) >> 32)
+#define HPET_NUM_TIM_CAP(cap)   ((((cap) >> 8) & 0x1F) + 1)
 #define HPET_TN_TIM_CONF_OFFSET 0
 #define HPET_TN_TIM_COMP_OFFSET 8
 
@@ -175,12 +179,45 @@ typedef struct {
     uint8_t Reserved3[3];
 } FADT;
 
+/* Multiple APIC Description Table */
+typedef struct {
+    ACPISDTHeader h;
+    uint32_t LocalApicAddress;
+    uint32_t Flags;
+    uint8_t Entries[];
+} MADT;
+
+typedef struct {
+    uint8_t Type;
+    uint8_t Length;
+} MADTEntry;
+
+#define MADT_LOCAL_APIC          0
+#define MADT_LOCAL_APIC_OVERRIDE 5
+
+typedef struct {
+    MADTEntry h;
+    uint8_t ProcessorId;
+    uint8_t ApicId;
+    uint32_t Flags;
+} MADTLocalApic;
+
+#define MADT_LAPIC_ENABLED        (1 << 0)
+#define MADT_LAPIC_ONLINE_CAPABLE (1 << 1)
+
+typedef struct {
+    MADTEntry h;
+    uint16_t Reserved;
+    uint64_t Address;
+} MADTLocalApicOverride;
+
 #pragma pack(pop)
 
 void acpi_enable(void);
 RSDP *get_rsdp(void);
 FADT *get_fadt(void);
 HPET *get_hpet(void);
+MADT *get_madt(void);
 
 void hpet_print_struct(void);
 void hpet_init(void);
@@ -190,6 +227,9 @@ void hpet_enable_interrupts_tim1(void);
 uint64_t hpet_cpu_frequency(void);
 void hpet_handle_interrupts_tim0(void);
 void hpet_handle_interrupts_tim1(void);
+void hpet_oneshot_arm(uint64_t tsc_deadline);
+void hpet_oneshot_cancel(void);
+bool hpet_oneshot_ack(void);
 
 uint32_t pmtimer_get_timeval(void);
 uint64_t pmtimer_cpu_frequency(void);
@@ -1,11 +1,13 @@
 #include <inc/mmu.h>
 #include <inc/x86.h>
 #include <inc/assert.h>
+#include <inc/error.h>
 #include <inc/string.h>
 
 #include <kern/pmap.h>
 #include <kern/trap.h>
 #include <kern/console.h>
+#include <kern/cpu.h>
 #include <kern/monitor.h>
 #include <kern/env.h>
 #include <kern/syscall.h>
@@ -13,10 +15,9 @@
 #include <kern/kclock.h>
 #include <kern/picirq.h>
 #include <kern/timer.h>
+#include <kern/spinlock.h>
 #include <kern/traceopt.h>
 
-static struct Taskstate ts;
-
 /* For debugging, so print_trapframe can distinguish between printing
  * a saved trapframe and printing the current trapframe and print some
  * additional information in the latter case */
@@ -168,6 +169,12 @@ trap_init(void) {
     idt[IRQ_OFFSET + IRQ_KBD]    = GATE(0, GD_KT, kbd_thdlr,    0);
     idt[IRQ_OFFSET + IRQ_SERIAL] = GATE(0, GD_KT, serial_thdlr, 0);
 
+    /* Local APIC interrupts */
+    idt[IRQ_OFFSET + IRQ_SPURIOUS]      = GATE(0, GD_KT, spurious_thdlr,      0);
+    idt[IRQ_OFFSET + IRQ_LAPIC_TIMER]   = GATE(0, GD_KT, lapic_timer_thdlr,   0);
+    idt[IRQ_OFFSET + IRQ_TLB_SHOOTDOWN] = GATE(0, GD_KT, tlb_shootdown_thdlr, 0);
+    idt[IRQ_OFFSET + IRQ_RESCHEDULE]    = GATE(0, GD_KT, reschedule_thdlr,    0);
+
     /* Per-CPU setup */
     trap_init_percpu();
 }
@@ -202,15 +209,18 @@ trap_init_percpu(void) {
 
     /* Setup a TSS so that we get the right stack
      * when we trap to the kernel. */
-    ts.ts_rsp0 = KERN_STACK_TOP;
-    ts.ts_ist1 = KERN_PF_STACK_TOP;
+    int cpu = cpunum();
+    struct Taskstate *ts = &cpus[cpu].cpu_ts;
+    ts->ts_rsp0 = KERN_CPU_STACK_TOP(cpu);
+    ts->ts_ist1 = KERN_CPU_PF_STACK_TOP(cpu);
 
-    /* Initialize the TSS slot of the gdt. */
-    *(volatile struct Segdesc64 *)(&gdt[(GD_TSS0 >> 3)]) = SEG64_TSS(STS_T64A, ((uint64_t)&ts), sizeof(struct Taskstate), 0);
+    /* Initialize the TSS slot of the gdt (TSS descriptor takes two slots). */
+    uint16_t sel = GD_TSS0 + cpu * sizeof(struct Segdesc64);
+    *(volatile struct Segdesc64 *)(&gdt[sel >> 3]) = SEG64_TSS(STS_T64A, ((uint64_t)ts), sizeof(struct Taskstate), 0);
 
     /* Load the TSS selector (like other segment selectors, the
      * bottom three bits are special; we leave them 0) */
-    ltr(GD_TSS0);
+    ltr(sel);
 
     /* Load the IDT */
     lidt(&idt_pd);
@@ -273,8 +283,8 @@ print_regs(struct PushRegs *regs) {
 static void
 trap_dispatch(struct Trapframe *tf) {
     switch (tf->tf_trapno) {
-    case T_SYSCALL:
-        tf->tf_regs.reg_rax = syscall(
+    case T_SYSCALL: {
+        int64_t res = syscall(
                 tf->tf_regs.reg_rax,
                 tf->tf_regs.reg_rdx,
                 tf->tf_regs.reg_rcx,
@@ -282,7 +292,16 @@ trap_dispatch(struct Trapframe *tf) {
                 tf->tf_regs.reg_rdi,
                 tf->tf_regs.reg_rsi,
                 tf->tf_regs.reg_r8);
+        /* Interrupted system call is executed again (with the same
+         * registers) after pending interrupts are handled */
+        if (res == -E_RESTART)
+            tf->tf_rip -= SYSCALL_INSN_LEN;
+        else {
+            tf->tf_regs.reg_rax = res;
+            curenv->env_syscalls++;
+        }
         return;
+    }
     case T_PGFLT:
         /* Handle processor exceptions. */
         // LAB 9: Your code here.
@@ -292,6 +311,8 @@ trap_dispatch(struct Trapframe *tf) {
     case T_BRKPT:
         // LAB 8: Your code here
         print_trapframe(tf);
+        /* Time spent in monitor is not a latency */
+        irq_latency_end();
         monitor(NULL);
         return;
     case IRQ_OFFSET + IRQ_SPURIOUS:
@@ -304,9 +325,23 @@ trap_dispatch(struct Trapframe *tf) {
         }
         return;
     case IRQ_OFFSET + IRQ_TIMER:
-    case IRQ_OFFSET + IRQ_CLOCK:
         // LAB 5: Your code here
         timer_for_schedule->handle_interrupts();
+        thiscpu->cpu_ticks++;
+        sched_yield();
+        return;
+    case IRQ_OFFSET + IRQ_CLOCK:
+        /* HPET one-shot timer shares the line with RTC */
+        if (!hpet_oneshot_ack()) timer_rtc.handle_interrupts();
+        sched_yield();
+        return;
+    case IRQ_OFFSET + IRQ_LAPIC_TIMER:
+        thiscpu->cpu_ticks++;
+        lapic_eoi();
+        sched_yield();
+        return;
+    case IRQ_OFFSET + IRQ_RESCHEDULE:
+        lapic_eoi();
         sched_yield();
         return;
         /* Handle keyboard and serial interrupts. */
@@ -325,8 +360,41 @@ trap_dispatch(struct Trapframe *tf) {
     }
 }
 
-/* We do not support recursive page faults in-kernel */
-bool in_page_fault;
+/* Histogram of intervals spent in kernel with interrupts disabled
+ * (from trap entry till return to user mode or halt), any interrupt
+ * arriving in the meantime is delayed by up to this time.
+ * Bucket i counts intervals of [2^i, 2^(i+1)) TSC cycles */
+static uint64_t irq_off_start[NCPU];
+static size_t irq_off_hist[IRQ_LATENCY_BUCKETS];
+static uint64_t irq_off_max;
+
+void
+irq_latency_end(void) {
+    uint64_t start = irq_off_start[cpunum()];
+    if (!start) return;
+    irq_off_start[cpunum()] = 0;
+
+    uint64_t cycles = read_tsc() - start;
+    int bucket = cycles ? 63 - __builtin_clzll(cycles) : 0;
+    irq_off_hist[MIN(bucket, IRQ_LATENCY_BUCKETS - 1)]++;
+    irq_off_max = MAX(irq_off_max, cycles);
+}
+
+void
+dump_irq_latency(void) {
+    size_t total = 0;
+    for (int i = 0; i < IRQ_LATENCY_BUCKETS; i++) total += irq_off_hist[i];
+    cprintf("Interrupts disabled in kernel: %zu intervals, longest %lu cycles\n",
+            total, (unsigned long)irq_off_max);
+    for (int i = 0; i < IRQ_LATENCY_BUCKETS; i++)
+        if (irq_off_hist[i]) cprintf("  < 2^%-2d cycles: %zu\n", i + 1, irq_off_hist[i]);
+}
+
+void
+reset_irq_latency(void) {
+    memset(irq_off_hist, 0, sizeof irq_off_hist);
+    irq_off_max = 0;
+}
 
 _Noreturn void
 trap(struct Trapframe *tf) {
@@ -339,6 +407,8 @@ trap(struct Trapframe *tf) {
     extern char *panicstr;
     if (panicstr) asm volatile("hlt");
 
+    irq_off_start[cpunum()] = read_tsc();
+
     /* Check that interrupts are disabled.  If this assertion
      * fails, DO NOT be tempted to fix it by inserting a "cli" in
      * the interrupt path */ 
@@ -347,6 +417,20 @@ trap(struct Trapframe *tf) {
     if (trace_traps) cprintf("Incoming TRAP[%ld] frame at %p\n", tf->tf_trapno, tf);
     if (trace_traps_more) print_trapframe(tf);
 
+    /* TLB shootdown is served without the big kernel lock,
+     * since the CPU which requested it holds the lock */
+    if (tf->tf_trapno == IRQ_OFFSET + IRQ_TLB_SHOOTDOWN) {
+        tlb_shootdown_poll();
+        lapic_eoi();
+        env_pop_tf(tf);
+    }
+
+    /* The big kernel lock is taken on entry from user mode or
+     * by the CPU halted in sched_halt(), otherwise it is held already */
+    bool halted = xchg(&thiscpu->cpu_status, CPU_STARTED) == CPU_HALTED;
+    if (halted || (tf->tf_cs & 3)) lock_kernel();
+    if (halted) thiscpu->cpu_wakeups++;
+
     /* #PF should be handled separately */
     if (tf->tf_trapno == T_PGFLT) {
         assert(current_space);
@@ -372,8 +456,10 @@ trap(struct Trapframe *tf) {
          * It is required to be handled here because of in-kernel page faults
          * which can happen with curenv == NULL */
 
+        if (curenv && va < MAX_USER_ADDRESS) curenv->env_pgfaults++;
+
         /* Read processor's CR2 register to find the faulting address */
-        int res = force_alloc_page(current_space, va, MAX_ALLOCATION_CLASS);
+        int res = resolve_lazy_fault(current_space, va);
         if (trace_pagefaults) {
             bool can_redir = tf->tf_err & FEC_U && curenv && curenv->env_pgfault_upcall;
             cprintf("<%p> Page fault ip=%08lX va=%08lX err=%c%c%c%c%c -> %s\n", current_space, tf->tf_rip, va,
@@ -386,10 +472,18 @@ trap(struct Trapframe *tf) {
         }
         if (!res) {
             in_page_fault = 0;
+            if (tf->tf_cs & 3) unlock_kernel();
             env_pop_tf(tf);
         }
     }
 
+    /* Interrupt has woken up CPU halted in sched_halt(),
+     * there is no environment to return to */
+    if (!curenv) {
+        trap_dispatch(tf);
+        sched_yield();
+    }
+
     assert(curenv);
 
     /* Copy trap frame (which is currently on the stack)
@@ -403,6 +497,11 @@ trap(struct Trapframe *tf) {
      * print_trapframe can print some additional information */
     last_tf = tf;
 
+    /* Environment destroyed by other CPU while running on this one
+     * is freed by sched_yield(), only interrupts are still handled */
+    if (curenv->env_status == ENV_DYING && (tf->tf_trapno < IRQ_OFFSET || tf->tf_trapno == T_SYSCALL))
+        sched_yield();
+
     /* Dispatch based on what type of trap occurred */
     trap_dispatch(tf);
 
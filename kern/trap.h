@@ -8,12 +8,14 @@
 
 #include <inc/trap.h>
 #include <inc/mmu.h>
+#include <kern/cpu.h>
 
 /* The kernel's interrupt descriptor table */
 extern struct Gatedesc idt[];
 extern struct Pseudodesc idt_pd;
 
-extern bool in_page_fault;
+/* We do not support recursive page faults in-kernel */
+#define in_page_fault (thiscpu->cpu_in_page_fault)
 
 extern void clock_thdlr();
 extern void timer_thdlr();
@@ -40,6 +42,11 @@ extern void simderr_thdlr();
 extern void kbd_thdlr();
 extern void serial_thdlr();
 
+extern void spurious_thdlr();
+extern void lapic_timer_thdlr();
+extern void tlb_shootdown_thdlr();
+extern void reschedule_thdlr();
+
 extern void syscall_thdlr();
 
 void clock_idt_init(void);
@@ -48,4 +55,10 @@ void trap_init_percpu(void);
 void print_regs(struct PushRegs *regs);
 void print_trapframe(struct Trapframe *tf);
 
+#define IRQ_LATENCY_BUCKETS 40
+
+void irq_latency_end(void);
+void dump_irq_latency(void);
+void reset_irq_latency(void);
+
 #endif /* JOS_KERN_TRAP_H */
@@ -178,6 +178,24 @@ tsc_calibrate(void) {
     return cpu_freq * 1000;
 }
 
+/* TSC values at boot start and at the end of previous boot phase */
+static uint64_t boot_tsc, boot_phase_tsc;
+
+void
+boot_timer_start(void) {
+    boot_tsc = boot_phase_tsc = read_tsc();
+}
+
+/* Prints duration of boot phase that has just finished
+ * and total time since boot_timer_start() */
+void
+boot_phase(const char *name) {
+    uint64_t now = read_tsc(), mhz = tsc_calibrate() / 1000000;
+    cprintf("Boot phase %s: %lu us (total %lu us)\n", name,
+            (now - boot_phase_tsc) / mhz, (now - boot_tsc) / mhz);
+    boot_phase_tsc = now;
+}
+
 void
 print_time(unsigned seconds) {
     cprintf("%u\n", seconds);
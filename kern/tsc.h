@@ -46,5 +46,7 @@ uint64_t tsc_calibrate(void);
 void timer_start(const char *name);
 void timer_stop(void);
 void timer_cpu_frequency(const char *name);
+void boot_timer_start(void);
+void boot_phase(const char *name);
 
 #endif /* !JOS_KERN_TSC_H */
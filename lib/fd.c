@@ -43,7 +43,14 @@ fd2data(struct Fd *fd) {
  * On error, *fd_store is set to 0. */
 int
 fd_alloc(struct Fd **fd_store) {
-    for (int i = 0; i < MAXFD; i++) {
+    return fd_alloc_from(0, fd_store);
+}
+
+/* Like fd_alloc(), but only considers fds starting from fdnum,
+ * so that several fds can be found before their pages are allocated */
+int
+fd_alloc_from(int fdnum, struct Fd **fd_store) {
+    for (int i = MAX(fdnum, 0); i < MAXFD; i++) {
         struct Fd *fd = INDEX2FD(i);
         if (!(get_prot(fd) & PROT_R)) {
             *fd_store = fd;
@@ -31,17 +31,22 @@ pipe(int pfd[2]) {
     static_assert(sizeof(struct Pipe) <= PAGE_SIZE, "PIPEBUFSIZ is too large");
 
 
-    /* Allocate the file descriptor table entries */
+    /* Find two file descriptor table entries
+     * (second one is searched after the first one
+     * since neither of them is allocated yet) */
     if ((res = fd_alloc(&fd0)) < 0 ||
-        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+        (res = fd_alloc_from(fd2num(fd0) + 1, &fd1)) < 0) goto err;
 
-    if ((res = fd_alloc(&fd1)) < 0 ||
-        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
-
-    /* allocate the pipe structure as first data page in both */
+    /* Allocate them and the pipe structure as first data page
+     * in both of them with a single system call */
     va = fd2data(fd0);
-    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
-    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+    struct RegionOp ops[] = {
+            {.type = REGION_ALLOC, .dstva = (uintptr_t)fd0, .size = PAGE_SIZE, .perm = PROT_RW | PROT_SHARE},
+            {.type = REGION_ALLOC, .dstva = (uintptr_t)fd1, .size = PAGE_SIZE, .perm = PROT_RW | PROT_SHARE},
+            {.type = REGION_ALLOC, .dstva = (uintptr_t)va, .size = PAGE_SIZE, .perm = PROT_RW | PROT_SHARE},
+            {.type = REGION_MAP, .srcva = (uintptr_t)va, .dstva = (uintptr_t)fd2data(fd1), .size = PAGE_SIZE, .perm = PROT_RW | PROT_SHARE},
+    };
+    if ((res = sys_region_batch(ops, sizeof ops / sizeof *ops)) < 0) goto err1;
 
     assert(sys_region_refs(va, PAGE_SIZE) == 2);
 
@@ -61,12 +66,11 @@ pipe(int pfd[2]) {
     pfd[1] = fd2num(fd1);
     return 0;
 
-err3:
-    sys_unmap_region(0, va, PAGE_SIZE);
-err2:
-    sys_unmap_region(0, fd1, PAGE_SIZE);
 err1:
-    sys_unmap_region(0, fd0, PAGE_SIZE);
+    /* Some of the operations might have succeeded */
+    for (size_t i = 0; i < sizeof ops / sizeof *ops; i++)
+        ops[i].type = REGION_UNMAP;
+    sys_region_batch(ops, sizeof ops / sizeof *ops);
 err:
     return res;
 }
@@ -9,6 +9,41 @@ static int map_segment(envid_t child, uintptr_t va, size_t memsz,
                        int fd, size_t filesz, off_t fileoffset, int perm);
 static int copy_shared_region(void *start, void *end, void *arg);
 
+/* Region operations are queued and submitted with a single
+ * sys_region_batch() call right before memory at UTEMP is reused */
+static struct RegionOp region_queue[REGION_BATCH_MAX];
+static size_t region_queued;
+
+static int
+region_flush(void) {
+    int res = region_queued ? sys_region_batch(region_queue, region_queued) : 0;
+
+    /* Operations following the failed one are not performed,
+     * but memory at UTEMP still has to be unmapped from ours */
+    for (size_t i = 0; res < 0 && i < region_queued; i++) {
+        struct RegionOp *op = &region_queue[i];
+        if (op->type == REGION_UNMAP && !op->dstenv)
+            sys_unmap_region(0, (void *)op->dstva, op->size);
+    }
+    region_queued = 0;
+    return res;
+}
+
+static int
+region_queue_op(int type, envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+    int res = region_queued == REGION_BATCH_MAX ? region_flush() : 0;
+    region_queue[region_queued++] = (struct RegionOp){
+            .type = type,
+            .perm = perm,
+            .srcenv = srcenv,
+            .dstenv = dstenv,
+            .srcva = (uintptr_t)srcva,
+            .dstva = (uintptr_t)dstva,
+            .size = size,
+    };
+    return res;
+}
+
 /* Spawn a child process from a program image loaded from the file system.
  * prog: the pathname of the program to run.
  * argv: pointer to null-terminated array of pointers to strings,
@@ -128,7 +163,8 @@ spawn(const char *prog, const char **argv) {
     close(fd);
 
     /* Copy shared library state. */
-    if ((res = foreach_shared_region(copy_shared_region, &child)) < 0)
+    if ((res = foreach_shared_region(copy_shared_region, &child)) < 0 ||
+        (res = region_flush()) < 0)
         panic("copy_shared_region: %i", res);
 
     if ((res = sys_env_set_trapframe(child, &child_tf)) < 0)
@@ -140,6 +176,7 @@ spawn(const char *prog, const char **argv) {
     return child;
 
 error:
+    region_flush();
     sys_env_destroy(child);
 error2:
     close(fd);
@@ -213,7 +250,8 @@ init_stack(envid_t child, const char **argv, struct Trapframe *tf) {
     if ((void *)(argv_store - 2) < (void *)UTEMP) return -E_NO_MEM;
 
     /* Allocate the stack pages at UTEMP. */
-    if ((res = sys_alloc_region(0, UTEMP, USER_STACK_SIZE, PROT_RW)) < 0) return res;
+    if ((res = region_queue_op(REGION_ALLOC, 0, NULL, 0, UTEMP, USER_STACK_SIZE, PROT_RW)) < 0 ||
+        (res = region_flush()) < 0) return res;
 
     /*    * Initialize 'argv_store[i]' to point to argument string i,
      *      for all 0 <= i < argc.
@@ -246,18 +284,18 @@ init_stack(envid_t child, const char **argv, struct Trapframe *tf) {
     tf->tf_rsp = UTEMP2USTACK(&argv_store[-2]);
 
     /* After completing the stack, map it into the child's address space
-     * and unmap it from ours! */
-    if (sys_map_region(0, UTEMP, child, (void *)(USER_STACK_TOP - USER_STACK_SIZE),
-                       USER_STACK_SIZE, PROT_RW) < 0) goto error;
-error:
-    if (sys_unmap_region(0, UTEMP, USER_STACK_SIZE) < 0) goto error;
-    return res;
+     * and unmap it from ours! (Both are done along with the next batch,
+     * unmapping is queued even if mapping can't be, see region_flush()) */
+    res = region_queue_op(REGION_MAP, 0, UTEMP, child, (void *)(USER_STACK_TOP - USER_STACK_SIZE),
+                          USER_STACK_SIZE, PROT_RW);
+    int unmap = region_queue_op(REGION_UNMAP, 0, NULL, 0, UTEMP, USER_STACK_SIZE, 0);
+    return res < 0 ? res : unmap;
 }
 
 static int
 copy_shared_region(void *start, void *end, void *arg) {
     envid_t child = *(envid_t *)arg;
-    return sys_map_region(0, start, child, start, end - start, get_prot(start));
+    return region_queue_op(REGION_MAP, 0, start, child, start, end - start, get_prot(start));
 }
 
 
@@ -284,8 +322,9 @@ map_segment(envid_t child, uintptr_t va, size_t memsz,
     /* read filesz to UTEMP */
     /* Map read section conents to child */
     /* Unmap it from parent */
-    res = sys_alloc_region(0, UTEMP, memsz, PROT_RW | PROT_X | ALLOC_ZERO);
-    if (res < 0) {
+    /* Previously queued operations are submitted along with the allocation */
+    res = region_queue_op(REGION_ALLOC, 0, NULL, 0, UTEMP, memsz, PROT_RW | PROT_X | ALLOC_ZERO);
+    if (res < 0 || (res = region_flush()) < 0) {
         return res;
     }
     res = seek(fd, fileoffset);
@@ -296,11 +335,11 @@ map_segment(envid_t child, uintptr_t va, size_t memsz,
     if (res < 0) {
         goto cleanup;
     }
-    res = sys_map_region(0, UTEMP, child, (void*)va, memsz, perm);
+    res = region_queue_op(REGION_MAP, 0, UTEMP, child, (void *)va, memsz, perm);
     if (res < 0) {
         goto cleanup;
     }
 cleanup:
-    sys_unmap_region(0, UTEMP, memsz);
+    region_queue_op(REGION_UNMAP, 0, NULL, 0, UTEMP, memsz, 0);
     return res;
 }
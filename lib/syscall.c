@@ -112,6 +112,23 @@ sys_unmap_region(envid_t envid, void *va, size_t size) {
     return res;
 }
 
+int
+sys_region_batch(const struct RegionOp *ops, size_t count) {
+    int res = syscall(SYS_region_batch, 1, (uintptr_t)ops, count, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    for (size_t i = 0; !res && thisenv && i < count; i++) {
+        void *va = (void *)ops[i].dstva;
+        if (ops[i].dstenv != CURENVID || ((uintptr_t)va >= SANITIZE_USER_SHADOW_BASE &&
+                                          (uintptr_t)va < SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) continue;
+        if (ops[i].type == REGION_UNMAP)
+            platform_asan_poison(va, ops[i].size);
+        else
+            platform_asan_unpoison(va, ops[i].size);
+    }
+#endif
+    return res;
+}
+
 /* sys_exofork is inlined in lib.h */
 
 int
@@ -119,6 +136,16 @@ sys_env_set_status(envid_t envid, int status) {
     return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
 }
 
+int
+sys_env_set_weight(envid_t envid, uint32_t weight) {
+    return syscall(SYS_env_set_weight, 1, envid, weight, 0, 0, 0, 0);
+}
+
+int
+sys_env_set_rt(envid_t envid, uint64_t period, uint64_t budget, uint64_t deadline) {
+    return syscall(SYS_env_set_rt, 1, envid, period, budget, deadline, 0, 0);
+}
+
 int
 sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
     return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
@@ -0,0 +1,10241 @@
+
+obj/fs/fs:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 8e 25 00 00       	call   8025b1 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <ide_wait_ready>:
+}
+
+static inline uint8_t __attribute__((always_inline))
+inb(int port) {
+    uint8_t data;
+    asm volatile("inb %w1,%0"
+  800025:	ba f7 01 00 00       	mov    $0x1f7,%edx
+  80002a:	ec                   	in     (%dx),%al
+
+static int
+ide_wait_ready(bool check_error) {
+    int r;
+
+    while (((r = inb(0x1F7)) & (IDE_BSY | IDE_DRDY)) != IDE_DRDY) /* nothing */
+  80002b:	89 c1                	mov    %eax,%ecx
+  80002d:	83 e1 c0             	and    $0xffffffc0,%ecx
+  800030:	80 f9 40             	cmp    $0x40,%cl
+  800033:	75 f5                	jne    80002a <ide_wait_ready+0x5>
+        ;
+
+    if (check_error && (r & (IDE_DF | IDE_ERR)) != 0) return -1;
+    return 0;
+  800035:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (check_error && (r & (IDE_DF | IDE_ERR)) != 0) return -1;
+  80003a:	40 84 ff             	test   %dil,%dil
+  80003d:	74 0a                	je     800049 <ide_wait_ready+0x24>
+  80003f:	a8 21                	test   $0x21,%al
+  800041:	0f 95 c2             	setne  %dl
+  800044:	0f b6 d2             	movzbl %dl,%edx
+  800047:	f7 da                	neg    %edx
+}
+  800049:	89 d0                	mov    %edx,%eax
+  80004b:	c3                   	ret
+
+000000000080004c <ide_probe_disk1>:
+
+bool
+ide_probe_disk1(void) {
+  80004c:	55                   	push   %rbp
+  80004d:	48 89 e5             	mov    %rsp,%rbp
+  800050:	53                   	push   %rbx
+  800051:	48 83 ec 08          	sub    $0x8,%rsp
+    int x;
+
+    /* Wait for Device 0 to be ready */
+    ide_wait_ready(0);
+  800055:	bf 00 00 00 00       	mov    $0x0,%edi
+  80005a:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  800061:	00 00 00 
+  800064:	ff d0                	call   *%rax
+                 : "memory", "cc");
+}
+
+static inline void __attribute__((always_inline))
+outb(int port, uint8_t data) {
+    asm volatile("outb %0,%w1" ::"a"(data), "d"(port));
+  800066:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  80006b:	ba f6 01 00 00       	mov    $0x1f6,%edx
+  800070:	ee                   	out    %al,(%dx)
+    asm volatile("inb %w1,%0"
+  800071:	ba f7 01 00 00       	mov    $0x1f7,%edx
+  800076:	ec                   	in     (%dx),%al
+
+    /* Switch to Device 1 */
+    outb(0x1F6, 0xE0 | (1 << 4));
+
+    /* Check for Device 1 to be ready for a while */
+    for (x = 0; x < 1000 && (inb(0x1F7) & (IDE_BSY | IDE_DF | IDE_ERR)) != 0; x++) /* nothing */
+  800077:	a8 a1                	test   $0xa1,%al
+  800079:	74 54                	je     8000cf <ide_probe_disk1+0x83>
+  80007b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800080:	83 c1 01             	add    $0x1,%ecx
+  800083:	81 f9 e8 03 00 00    	cmp    $0x3e8,%ecx
+  800089:	74 05                	je     800090 <ide_probe_disk1+0x44>
+  80008b:	ec                   	in     (%dx),%al
+  80008c:	a8 a1                	test   $0xa1,%al
+  80008e:	75 f0                	jne    800080 <ide_probe_disk1+0x34>
+    asm volatile("outb %0,%w1" ::"a"(data), "d"(port));
+  800090:	b8 e0 ff ff ff       	mov    $0xffffffe0,%eax
+  800095:	ba f6 01 00 00       	mov    $0x1f6,%edx
+  80009a:	ee                   	out    %al,(%dx)
+        ;
+
+    /* Switch back to Device 0 */
+    outb(0x1F6, 0xE0 | (0 << 4));
+
+    cprintf("Device 1 presence: %d\n", (x < 1000));
+  80009b:	81 f9 e7 03 00 00    	cmp    $0x3e7,%ecx
+  8000a1:	0f 9e c3             	setle  %bl
+  8000a4:	40 0f 9e c6          	setle  %sil
+  8000a8:	40 0f b6 f6          	movzbl %sil,%esi
+  8000ac:	48 bf e0 54 80 00 00 	movabs $0x8054e0,%rdi
+  8000b3:	00 00 00 
+  8000b6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000bb:	48 ba cd 27 80 00 00 	movabs $0x8027cd,%rdx
+  8000c2:	00 00 00 
+  8000c5:	ff d2                	call   *%rdx
+    return (x < 1000);
+}
+  8000c7:	89 d8                	mov    %ebx,%eax
+  8000c9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8000cd:	c9                   	leave
+  8000ce:	c3                   	ret
+    for (x = 0; x < 1000 && (inb(0x1F7) & (IDE_BSY | IDE_DF | IDE_ERR)) != 0; x++) /* nothing */
+  8000cf:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8000d4:	eb ba                	jmp    800090 <ide_probe_disk1+0x44>
+
+00000000008000d6 <ide_set_disk>:
+
+void
+ide_set_disk(int d) {
+    if (d != 0 && d != 1)
+  8000d6:	83 ff 01             	cmp    $0x1,%edi
+  8000d9:	77 0c                	ja     8000e7 <ide_set_disk+0x11>
+        panic("bad disk number");
+    diskno = d;
+  8000db:	89 f8                	mov    %edi,%eax
+  8000dd:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  8000e4:	00 00 
+  8000e6:	c3                   	ret
+ide_set_disk(int d) {
+  8000e7:	55                   	push   %rbp
+  8000e8:	48 89 e5             	mov    %rsp,%rbp
+        panic("bad disk number");
+  8000eb:	48 ba f7 54 80 00 00 	movabs $0x8054f7,%rdx
+  8000f2:	00 00 00 
+  8000f5:	be 34 00 00 00       	mov    $0x34,%esi
+  8000fa:	48 bf 07 55 80 00 00 	movabs $0x805507,%rdi
+  800101:	00 00 00 
+  800104:	b8 00 00 00 00       	mov    $0x0,%eax
+  800109:	48 b9 7d 26 80 00 00 	movabs $0x80267d,%rcx
+  800110:	00 00 00 
+  800113:	ff d1                	call   *%rcx
+
+0000000000800115 <ide_read>:
+}
+
+int
+ide_read(uint32_t secno, void *dst, size_t nsecs) {
+  800115:	55                   	push   %rbp
+  800116:	48 89 e5             	mov    %rsp,%rbp
+  800119:	41 55                	push   %r13
+  80011b:	41 54                	push   %r12
+  80011d:	53                   	push   %rbx
+  80011e:	48 83 ec 08          	sub    $0x8,%rsp
+    int r;
+
+    assert(nsecs <= 256);
+  800122:	48 81 fa 00 01 00 00 	cmp    $0x100,%rdx
+  800129:	0f 87 c0 00 00 00    	ja     8001ef <ide_read+0xda>
+  80012f:	41 89 fd             	mov    %edi,%r13d
+  800132:	48 89 f3             	mov    %rsi,%rbx
+  800135:	49 89 d4             	mov    %rdx,%r12
+
+    ide_wait_ready(0);
+  800138:	bf 00 00 00 00       	mov    $0x0,%edi
+  80013d:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  800144:	00 00 00 
+  800147:	ff d0                	call   *%rax
+  800149:	ba f2 01 00 00       	mov    $0x1f2,%edx
+  80014e:	44 89 e0             	mov    %r12d,%eax
+  800151:	ee                   	out    %al,(%dx)
+  800152:	ba f3 01 00 00       	mov    $0x1f3,%edx
+  800157:	44 89 e8             	mov    %r13d,%eax
+  80015a:	ee                   	out    %al,(%dx)
+
+    outb(0x1F2, nsecs);
+    outb(0x1F3, secno & 0xFF);
+    outb(0x1F4, (secno >> 8) & 0xFF);
+  80015b:	44 89 e8             	mov    %r13d,%eax
+  80015e:	c1 e8 08             	shr    $0x8,%eax
+  800161:	ba f4 01 00 00       	mov    $0x1f4,%edx
+  800166:	ee                   	out    %al,(%dx)
+    outb(0x1F5, (secno >> 16) & 0xFF);
+  800167:	44 89 e8             	mov    %r13d,%eax
+  80016a:	c1 e8 10             	shr    $0x10,%eax
+  80016d:	ba f5 01 00 00       	mov    $0x1f5,%edx
+  800172:	ee                   	out    %al,(%dx)
+    outb(0x1F6, 0xE0 | ((diskno & 1) << 4) | ((secno >> 24) & 0x0F));
+  800173:	a1 00 70 80 00 00 00 	movabs 0x807000,%eax
+  80017a:	00 00 
+  80017c:	c1 e0 04             	shl    $0x4,%eax
+  80017f:	83 e0 10             	and    $0x10,%eax
+  800182:	41 c1 ed 18          	shr    $0x18,%r13d
+  800186:	41 83 e5 0f          	and    $0xf,%r13d
+  80018a:	44 09 e8             	or     %r13d,%eax
+  80018d:	83 c8 e0             	or     $0xffffffe0,%eax
+  800190:	ba f6 01 00 00       	mov    $0x1f6,%edx
+  800195:	ee                   	out    %al,(%dx)
+  800196:	b8 20 00 00 00       	mov    $0x20,%eax
+  80019b:	ba f7 01 00 00       	mov    $0x1f7,%edx
+  8001a0:	ee                   	out    %al,(%dx)
+    outb(0x1F7, 0x20); /* CMD 0x20 means read sector */
+
+    for (; nsecs > 0; nsecs--, dst += SECTSIZE) {
+  8001a1:	4d 85 e4             	test   %r12,%r12
+  8001a4:	74 7e                	je     800224 <ide_read+0x10f>
+  8001a6:	49 c1 e4 09          	shl    $0x9,%r12
+  8001aa:	49 01 dc             	add    %rbx,%r12
+        if ((r = ide_wait_ready(1)) < 0) return r;
+  8001ad:	49 bd 25 00 80 00 00 	movabs $0x800025,%r13
+  8001b4:	00 00 00 
+  8001b7:	bf 01 00 00 00       	mov    $0x1,%edi
+  8001bc:	41 ff d5             	call   *%r13
+  8001bf:	85 c0                	test   %eax,%eax
+  8001c1:	78 21                	js     8001e4 <ide_read+0xcf>
+    asm volatile("cld\n\trepne\n\tinsl"
+  8001c3:	48 89 df             	mov    %rbx,%rdi
+  8001c6:	b9 80 00 00 00       	mov    $0x80,%ecx
+  8001cb:	ba f0 01 00 00       	mov    $0x1f0,%edx
+  8001d0:	fc                   	cld
+  8001d1:	f2 6d                	repnz insl (%dx),%es:(%rdi)
+    for (; nsecs > 0; nsecs--, dst += SECTSIZE) {
+  8001d3:	48 81 c3 00 02 00 00 	add    $0x200,%rbx
+  8001da:	49 39 dc             	cmp    %rbx,%r12
+  8001dd:	75 d8                	jne    8001b7 <ide_read+0xa2>
+        insl(0x1F0, dst, SECTSIZE / 4);
+    }
+
+    return 0;
+  8001df:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8001e4:	48 83 c4 08          	add    $0x8,%rsp
+  8001e8:	5b                   	pop    %rbx
+  8001e9:	41 5c                	pop    %r12
+  8001eb:	41 5d                	pop    %r13
+  8001ed:	5d                   	pop    %rbp
+  8001ee:	c3                   	ret
+    assert(nsecs <= 256);
+  8001ef:	48 b9 10 55 80 00 00 	movabs $0x805510,%rcx
+  8001f6:	00 00 00 
+  8001f9:	48 ba 1d 55 80 00 00 	movabs $0x80551d,%rdx
+  800200:	00 00 00 
+  800203:	be 3c 00 00 00       	mov    $0x3c,%esi
+  800208:	48 bf 07 55 80 00 00 	movabs $0x805507,%rdi
+  80020f:	00 00 00 
+  800212:	b8 00 00 00 00       	mov    $0x0,%eax
+  800217:	49 b8 7d 26 80 00 00 	movabs $0x80267d,%r8
+  80021e:	00 00 00 
+  800221:	41 ff d0             	call   *%r8
+    return 0;
+  800224:	b8 00 00 00 00       	mov    $0x0,%eax
+  800229:	eb b9                	jmp    8001e4 <ide_read+0xcf>
+
+000000000080022b <ide_write>:
+
+int
+ide_write(uint32_t secno, const void *src, size_t nsecs) {
+  80022b:	55                   	push   %rbp
+  80022c:	48 89 e5             	mov    %rsp,%rbp
+  80022f:	41 55                	push   %r13
+  800231:	41 54                	push   %r12
+  800233:	53                   	push   %rbx
+  800234:	48 83 ec 08          	sub    $0x8,%rsp
+    int r;
+
+    assert(nsecs <= 256);
+  800238:	48 81 fa 00 01 00 00 	cmp    $0x100,%rdx
+  80023f:	0f 87 c0 00 00 00    	ja     800305 <ide_write+0xda>
+  800245:	41 89 fd             	mov    %edi,%r13d
+  800248:	48 89 f3             	mov    %rsi,%rbx
+  80024b:	49 89 d4             	mov    %rdx,%r12
+
+    ide_wait_ready(0);
+  80024e:	bf 00 00 00 00       	mov    $0x0,%edi
+  800253:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  80025a:	00 00 00 
+  80025d:	ff d0                	call   *%rax
+    asm volatile("outb %0,%w1" ::"a"(data), "d"(port));
+  80025f:	ba f2 01 00 00       	mov    $0x1f2,%edx
+  800264:	44 89 e0             	mov    %r12d,%eax
+  800267:	ee                   	out    %al,(%dx)
+  800268:	ba f3 01 00 00       	mov    $0x1f3,%edx
+  80026d:	44 89 e8             	mov    %r13d,%eax
+  800270:	ee                   	out    %al,(%dx)
+
+    outb(0x1F2, nsecs);
+    outb(0x1F3, secno & 0xFF);
+    outb(0x1F4, (secno >> 8) & 0xFF);
+  800271:	44 89 e8             	mov    %r13d,%eax
+  800274:	c1 e8 08             	shr    $0x8,%eax
+  800277:	ba f4 01 00 00       	mov    $0x1f4,%edx
+  80027c:	ee                   	out    %al,(%dx)
+    outb(0x1F5, (secno >> 16) & 0xFF);
+  80027d:	44 89 e8             	mov    %r13d,%eax
+  800280:	c1 e8 10             	shr    $0x10,%eax
+  800283:	ba f5 01 00 00       	mov    $0x1f5,%edx
+  800288:	ee                   	out    %al,(%dx)
+    outb(0x1F6, 0xE0 | ((diskno & 1) << 4) | ((secno >> 24) & 0x0F));
+  800289:	a1 00 70 80 00 00 00 	movabs 0x807000,%eax
+  800290:	00 00 
+  800292:	c1 e0 04             	shl    $0x4,%eax
+  800295:	83 e0 10             	and    $0x10,%eax
+  800298:	41 c1 ed 18          	shr    $0x18,%r13d
+  80029c:	41 83 e5 0f          	and    $0xf,%r13d
+  8002a0:	44 09 e8             	or     %r13d,%eax
+  8002a3:	83 c8 e0             	or     $0xffffffe0,%eax
+  8002a6:	ba f6 01 00 00       	mov    $0x1f6,%edx
+  8002ab:	ee                   	out    %al,(%dx)
+  8002ac:	b8 30 00 00 00       	mov    $0x30,%eax
+  8002b1:	ba f7 01 00 00       	mov    $0x1f7,%edx
+  8002b6:	ee                   	out    %al,(%dx)
+    outb(0x1F7, 0x30); /* CMD 0x30 means write sector */
+
+    for (; nsecs > 0; nsecs--, src += SECTSIZE) {
+  8002b7:	4d 85 e4             	test   %r12,%r12
+  8002ba:	74 7e                	je     80033a <ide_write+0x10f>
+  8002bc:	49 c1 e4 09          	shl    $0x9,%r12
+  8002c0:	49 01 dc             	add    %rbx,%r12
+        if ((r = ide_wait_ready(1)) < 0) return r;
+  8002c3:	49 bd 25 00 80 00 00 	movabs $0x800025,%r13
+  8002ca:	00 00 00 
+  8002cd:	bf 01 00 00 00       	mov    $0x1,%edi
+  8002d2:	41 ff d5             	call   *%r13
+  8002d5:	85 c0                	test   %eax,%eax
+  8002d7:	78 21                	js     8002fa <ide_write+0xcf>
+                 : "cc");
+}
+
+static inline void __attribute__((always_inline))
+outsl(int port, const void *addr, int cnt) {
+    asm volatile("cld\n\trepne\n\toutsl"
+  8002d9:	48 89 de             	mov    %rbx,%rsi
+  8002dc:	b9 80 00 00 00       	mov    $0x80,%ecx
+  8002e1:	ba f0 01 00 00       	mov    $0x1f0,%edx
+  8002e6:	fc                   	cld
+  8002e7:	f2 6f                	repnz outsl %ds:(%rsi),(%dx)
+    for (; nsecs > 0; nsecs--, src += SECTSIZE) {
+  8002e9:	48 81 c3 00 02 00 00 	add    $0x200,%rbx
+  8002f0:	49 39 dc             	cmp    %rbx,%r12
+  8002f3:	75 d8                	jne    8002cd <ide_write+0xa2>
+        outsl(0x1F0, src, SECTSIZE / 4);
+    }
+
+    return 0;
+  8002f5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8002fa:	48 83 c4 08          	add    $0x8,%rsp
+  8002fe:	5b                   	pop    %rbx
+  8002ff:	41 5c                	pop    %r12
+  800301:	41 5d                	pop    %r13
+  800303:	5d                   	pop    %rbp
+  800304:	c3                   	ret
+    assert(nsecs <= 256);
+  800305:	48 b9 10 55 80 00 00 	movabs $0x805510,%rcx
+  80030c:	00 00 00 
+  80030f:	48 ba 1d 55 80 00 00 	movabs $0x80551d,%rdx
+  800316:	00 00 00 
+  800319:	be 53 00 00 00       	mov    $0x53,%esi
+  80031e:	48 bf 07 55 80 00 00 	movabs $0x805507,%rdi
+  800325:	00 00 00 
+  800328:	b8 00 00 00 00       	mov    $0x0,%eax
+  80032d:	49 b8 7d 26 80 00 00 	movabs $0x80267d,%r8
+  800334:	00 00 00 
+  800337:	41 ff d0             	call   *%r8
+    return 0;
+  80033a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80033f:	eb b9                	jmp    8002fa <ide_write+0xcf>
+
+0000000000800341 <bc_pgfault>:
+
+/* Fault any disk block that is read in to memory by
+ * loading it from disk. */
+static bool
+bc_pgfault(struct UTrapframe *utf) {
+    void *addr = (void *)utf->utf_fault_va;
+  800341:	48 8b 17             	mov    (%rdi),%rdx
+    blockno_t blockno = ((uintptr_t)addr - (uintptr_t)DISKMAP) / BLKSIZE;
+  800344:	48 8d ba 00 00 00 f0 	lea    -0x10000000(%rdx),%rdi
+
+    /* Check that the fault was within the block cache region */
+    if (addr < (void *)DISKMAP || addr >= (void *)(DISKMAP + DISKSIZE)) return 0;
+  80034b:	b8 ff ff ff bf       	mov    $0xbfffffff,%eax
+  800350:	48 39 f8             	cmp    %rdi,%rax
+  800353:	0f 82 b8 00 00 00    	jb     800411 <bc_pgfault+0xd0>
+bc_pgfault(struct UTrapframe *utf) {
+  800359:	55                   	push   %rbp
+  80035a:	48 89 e5             	mov    %rsp,%rbp
+  80035d:	41 54                	push   %r12
+  80035f:	53                   	push   %rbx
+    blockno_t blockno = ((uintptr_t)addr - (uintptr_t)DISKMAP) / BLKSIZE;
+  800360:	48 89 fb             	mov    %rdi,%rbx
+  800363:	48 c1 eb 0c          	shr    $0xc,%rbx
+  800367:	89 d9                	mov    %ebx,%ecx
+
+    /* Sanity check the block number. */
+    if (super && blockno >= super->s_nblocks)
+  800369:	48 a1 08 c0 80 00 00 	movabs 0x80c008,%rax
+  800370:	00 00 00 
+  800373:	48 85 c0             	test   %rax,%rax
+  800376:	74 09                	je     800381 <bc_pgfault+0x40>
+  800378:	44 8b 40 04          	mov    0x4(%rax),%r8d
+  80037c:	44 39 c3             	cmp    %r8d,%ebx
+  80037f:	73 43                	jae    8003c4 <bc_pgfault+0x83>
+     * of the block from the disk into that page.
+     * Hint: first round addr to page boundary. fs/ide.c has code to read
+     * the disk. */
+    // LAB 10: Your code here
+
+    addr = ROUNDDOWN(addr, BLKSIZE);
+  800381:	48 81 e2 00 f0 ff ff 	and    $0xfffffffffffff000,%rdx
+  800388:	49 89 d4             	mov    %rdx,%r12
+
+    int res = sys_alloc_region(thisenv->env_id, addr, BLKSIZE, PTE_SYSCALL);
+  80038b:	48 a1 10 c0 80 00 00 	movabs 0x80c010,%rax
+  800392:	00 00 00 
+  800395:	8b b8 e0 00 00 00    	mov    0xe0(%rax),%edi
+  80039b:	b9 07 0e 00 00       	mov    $0xe07,%ecx
+  8003a0:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8003a5:	4c 89 e6             	mov    %r12,%rsi
+  8003a8:	48 b8 a2 36 80 00 00 	movabs $0x8036a2,%rax
+  8003af:	00 00 00 
+  8003b2:	ff d0                	call   *%rax
+  8003b4:	89 c2                	mov    %eax,%edx
+    if (res)
+        return 0;
+  8003b6:	b8 00 00 00 00       	mov    $0x0,%eax
+    if (res)
+  8003bb:	85 d2                	test   %edx,%edx
+  8003bd:	74 30                	je     8003ef <bc_pgfault+0xae>
+    res = ide_read(blockno * BLKSECTS, addr, BLKSECTS);
+    if (res)
+        return 0;
+
+    return 1;
+}
+  8003bf:	5b                   	pop    %rbx
+  8003c0:	41 5c                	pop    %r12
+  8003c2:	5d                   	pop    %rbp
+  8003c3:	c3                   	ret
+        panic("reading non-existent block %08x out of %08x\n", blockno, super->s_nblocks);
+  8003c4:	48 ba 38 55 80 00 00 	movabs $0x805538,%rdx
+  8003cb:	00 00 00 
+  8003ce:	be 1c 00 00 00       	mov    $0x1c,%esi
+  8003d3:	48 bf d4 55 80 00 00 	movabs $0x8055d4,%rdi
+  8003da:	00 00 00 
+  8003dd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003e2:	49 b9 7d 26 80 00 00 	movabs $0x80267d,%r9
+  8003e9:	00 00 00 
+  8003ec:	41 ff d1             	call   *%r9
+    res = ide_read(blockno * BLKSECTS, addr, BLKSECTS);
+  8003ef:	8d 3c dd 00 00 00 00 	lea    0x0(,%rbx,8),%edi
+  8003f6:	ba 08 00 00 00       	mov    $0x8,%edx
+  8003fb:	4c 89 e6             	mov    %r12,%rsi
+  8003fe:	48 b8 15 01 80 00 00 	movabs $0x800115,%rax
+  800405:	00 00 00 
+  800408:	ff d0                	call   *%rax
+    if (res)
+  80040a:	85 c0                	test   %eax,%eax
+  80040c:	0f 94 c0             	sete   %al
+  80040f:	eb ae                	jmp    8003bf <bc_pgfault+0x7e>
+    if (addr < (void *)DISKMAP || addr >= (void *)(DISKMAP + DISKSIZE)) return 0;
+  800411:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800416:	c3                   	ret
+
+0000000000800417 <diskaddr>:
+    if (blockno == 0 || (super && blockno >= super->s_nblocks))
+  800417:	85 ff                	test   %edi,%edi
+  800419:	74 21                	je     80043c <diskaddr+0x25>
+  80041b:	48 a1 08 c0 80 00 00 	movabs 0x80c008,%rax
+  800422:	00 00 00 
+  800425:	48 85 c0             	test   %rax,%rax
+  800428:	74 05                	je     80042f <diskaddr+0x18>
+  80042a:	3b 78 04             	cmp    0x4(%rax),%edi
+  80042d:	73 0d                	jae    80043c <diskaddr+0x25>
+    void *r = (void *)(uintptr_t)(DISKMAP + blockno * BLKSIZE);
+  80042f:	89 f8                	mov    %edi,%eax
+  800431:	48 05 00 00 01 00    	add    $0x10000,%rax
+  800437:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  80043b:	c3                   	ret
+diskaddr(uint32_t blockno) {
+  80043c:	55                   	push   %rbp
+  80043d:	48 89 e5             	mov    %rsp,%rbp
+        panic("bad block number %08x in diskaddr", blockno);
+  800440:	89 f9                	mov    %edi,%ecx
+  800442:	48 ba 68 55 80 00 00 	movabs $0x805568,%rdx
+  800449:	00 00 00 
+  80044c:	be 08 00 00 00       	mov    $0x8,%esi
+  800451:	48 bf d4 55 80 00 00 	movabs $0x8055d4,%rdi
+  800458:	00 00 00 
+  80045b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800460:	49 b8 7d 26 80 00 00 	movabs $0x80267d,%r8
+  800467:	00 00 00 
+  80046a:	41 ff d0             	call   *%r8
+
+000000000080046d <flush_block>:
+ * Hint: Use the PTE_SYSCALL constant when calling sys_page_map.
+ * Hint: Don't forget to round addr down. */
+
+
+void
+flush_block(void *addr) {
+  80046d:	55                   	push   %rbp
+  80046e:	48 89 e5             	mov    %rsp,%rbp
+  800471:	41 55                	push   %r13
+  800473:	41 54                	push   %r12
+  800475:	53                   	push   %rbx
+  800476:	48 83 ec 08          	sub    $0x8,%rsp
+  80047a:	48 89 fb             	mov    %rdi,%rbx
+    blockno_t blockno = ((uintptr_t)addr - (uintptr_t)DISKMAP) / BLKSIZE;
+  80047d:	48 8d 87 00 00 00 f0 	lea    -0x10000000(%rdi),%rax
+  800484:	49 89 c4             	mov    %rax,%r12
+  800487:	49 c1 ec 0c          	shr    $0xc,%r12
+
+    if (addr < (void *)(uintptr_t)DISKMAP || addr >= (void *)(uintptr_t)(DISKMAP + DISKSIZE))
+  80048b:	ba ff ff ff bf       	mov    $0xbfffffff,%edx
+  800490:	48 39 c2             	cmp    %rax,%rdx
+  800493:	0f 82 cc 00 00 00    	jb     800565 <flush_block+0xf8>
+  800499:	44 89 e7             	mov    %r12d,%edi
+        panic("flush_block of bad va %p", addr);
+    if (blockno && super && blockno >= super->s_nblocks)
+  80049c:	45 85 e4             	test   %r12d,%r12d
+  80049f:	74 1c                	je     8004bd <flush_block+0x50>
+  8004a1:	48 a1 08 c0 80 00 00 	movabs 0x80c008,%rax
+  8004a8:	00 00 00 
+  8004ab:	48 85 c0             	test   %rax,%rax
+  8004ae:	74 0d                	je     8004bd <flush_block+0x50>
+  8004b0:	44 8b 40 04          	mov    0x4(%rax),%r8d
+  8004b4:	45 39 c4             	cmp    %r8d,%r12d
+  8004b7:	0f 83 d6 00 00 00    	jae    800593 <flush_block+0x126>
+        panic("reading non-existent block %08x out of %08x\n", blockno, super->s_nblocks);
+
+    // LAB 10: Your code here.
+
+    void *blockptr = diskaddr(blockno);//ROUNDDOWN(addr, BLKSIZE);
+  8004bd:	48 b8 17 04 80 00 00 	movabs $0x800417,%rax
+  8004c4:	00 00 00 
+  8004c7:	ff d0                	call   *%rax
+  8004c9:	49 89 c5             	mov    %rax,%r13
+
+    pte_t page_status = get_uvpt_entry(addr);
+  8004cc:	48 89 df             	mov    %rbx,%rdi
+  8004cf:	48 b8 07 50 80 00 00 	movabs $0x805007,%rax
+  8004d6:	00 00 00 
+  8004d9:	ff d0                	call   *%rax
+
+    if (!(page_status & PTE_P))
+  8004db:	a8 01                	test   $0x1,%al
+  8004dd:	74 7b                	je     80055a <flush_block+0xed>
+        return;
+
+    if (page_status & PTE_D)
+  8004df:	a8 40                	test   $0x40,%al
+  8004e1:	74 60                	je     800543 <flush_block+0xd6>
+    {
+        int res = ide_write(blockno * BLKSECTS, blockptr, BLKSECTS);
+  8004e3:	42 8d 3c e5 00 00 00 	lea    0x0(,%r12,8),%edi
+  8004ea:	00 
+  8004eb:	ba 08 00 00 00       	mov    $0x8,%edx
+  8004f0:	4c 89 ee             	mov    %r13,%rsi
+  8004f3:	48 b8 2b 02 80 00 00 	movabs $0x80022b,%rax
+  8004fa:	00 00 00 
+  8004fd:	ff d0                	call   *%rax
+        if (res)
+  8004ff:	85 c0                	test   %eax,%eax
+  800501:	0f 85 ba 00 00 00    	jne    8005c1 <flush_block+0x154>
+            panic("flush_block: ide_write error");
+        res = sys_map_region(
+                            thisenv->env_id,
+                            blockptr,
+                            thisenv->env_id,
+  800507:	48 a1 10 c0 80 00 00 	movabs 0x80c010,%rax
+  80050e:	00 00 00 
+  800511:	8b 90 e0 00 00 00    	mov    0xe0(%rax),%edx
+                            thisenv->env_id,
+  800517:	8b b8 e0 00 00 00    	mov    0xe0(%rax),%edi
+        res = sys_map_region(
+  80051d:	41 b9 00 01 00 00    	mov    $0x100,%r9d
+  800523:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  800529:	4c 89 e9             	mov    %r13,%rcx
+  80052c:	4c 89 ee             	mov    %r13,%rsi
+  80052f:	48 b8 09 37 80 00 00 	movabs $0x803709,%rax
+  800536:	00 00 00 
+  800539:	ff d0                	call   *%rax
+                            blockptr,
+                            BLKSIZE,
+                            PROT_COMBINE
+                            );
+        if (res)
+  80053b:	85 c0                	test   %eax,%eax
+  80053d:	0f 85 a8 00 00 00    	jne    8005eb <flush_block+0x17e>
+            panic("flush_block: cannot map region");
+    }
+
+
+    assert(!is_page_dirty(addr));
+  800543:	48 89 df             	mov    %rbx,%rdi
+  800546:	48 b8 01 51 80 00 00 	movabs $0x805101,%rax
+  80054d:	00 00 00 
+  800550:	ff d0                	call   *%rax
+  800552:	84 c0                	test   %al,%al
+  800554:	0f 85 bb 00 00 00    	jne    800615 <flush_block+0x1a8>
+}
+  80055a:	48 83 c4 08          	add    $0x8,%rsp
+  80055e:	5b                   	pop    %rbx
+  80055f:	41 5c                	pop    %r12
+  800561:	41 5d                	pop    %r13
+  800563:	5d                   	pop    %rbp
+  800564:	c3                   	ret
+        panic("flush_block of bad va %p", addr);
+  800565:	48 89 f9             	mov    %rdi,%rcx
+  800568:	48 ba dc 55 80 00 00 	movabs $0x8055dc,%rdx
+  80056f:	00 00 00 
+  800572:	be 3f 00 00 00       	mov    $0x3f,%esi
+  800577:	48 bf d4 55 80 00 00 	movabs $0x8055d4,%rdi
+  80057e:	00 00 00 
+  800581:	b8 00 00 00 00       	mov    $0x0,%eax
+  800586:	49 b8 7d 26 80 00 00 	movabs $0x80267d,%r8
+  80058d:	00 00 00 
+  800590:	41 ff d0             	call   *%r8
+        panic("reading non-existent block %08x out of %08x\n", blockno, super->s_nblocks);
+  800593:	44 89 e1             	mov    %r12d,%ecx
+  800596:	48 ba 38 55 80 00 00 	movabs $0x805538,%rdx
+  80059d:	00 00 00 
+  8005a0:	be 41 00 00 00       	mov    $0x41,%esi
+  8005a5:	48 bf d4 55 80 00 00 	movabs $0x8055d4,%rdi
+  8005ac:	00 00 00 
+  8005af:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005b4:	49 b9 7d 26 80 00 00 	movabs $0x80267d,%r9
+  8005bb:	00 00 00 
+  8005be:	41 ff d1             	call   *%r9
+            panic("flush_block: ide_write error");
+  8005c1:	48 ba f5 55 80 00 00 	movabs $0x8055f5,%rdx
+  8005c8:	00 00 00 
+  8005cb:	be 50 00 00 00       	mov    $0x50,%esi
+  8005d0:	48 bf d4 55 80 00 00 	movabs $0x8055d4,%rdi
+  8005d7:	00 00 00 
+  8005da:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005df:	48 b9 7d 26 80 00 00 	movabs $0x80267d,%rcx
+  8005e6:	00 00 00 
+  8005e9:	ff d1                	call   *%rcx
+            panic("flush_block: cannot map region");
+  8005eb:	48 ba 90 55 80 00 00 	movabs $0x805590,%rdx
+  8005f2:	00 00 00 
+  8005f5:	be 5a 00 00 00       	mov    $0x5a,%esi
+  8005fa:	48 bf d4 55 80 00 00 	movabs $0x8055d4,%rdi
+  800601:	00 00 00 
+  800604:	b8 00 00 00 00       	mov    $0x0,%eax
+  800609:	48 b9 7d 26 80 00 00 	movabs $0x80267d,%rcx
+  800610:	00 00 00 
+  800613:	ff d1                	call   *%rcx
+    assert(!is_page_dirty(addr));
+  800615:	48 b9 12 56 80 00 00 	movabs $0x805612,%rcx
+  80061c:	00 00 00 
+  80061f:	48 ba 1d 55 80 00 00 	movabs $0x80551d,%rdx
+  800626:	00 00 00 
+  800629:	be 5e 00 00 00       	mov    $0x5e,%esi
+  80062e:	48 bf d4 55 80 00 00 	movabs $0x8055d4,%rdi
+  800635:	00 00 00 
+  800638:	b8 00 00 00 00       	mov    $0x0,%eax
+  80063d:	49 b8 7d 26 80 00 00 	movabs $0x80267d,%r8
+  800644:	00 00 00 
+  800647:	41 ff d0             	call   *%r8
+
+000000000080064a <bc_init>:
+
+    cprintf("block cache is good\n");
+}
+
+void
+bc_init(void) {
+  80064a:	55                   	push   %rbp
+  80064b:	48 89 e5             	mov    %rsp,%rbp
+  80064e:	41 54                	push   %r12
+  800650:	53                   	push   %rbx
+  800651:	48 81 ec 10 02 00 00 	sub    $0x210,%rsp
+    struct Super super;
+    add_pgfault_handler(bc_pgfault);
+  800658:	48 bf 41 03 80 00 00 	movabs $0x800341,%rdi
+  80065f:	00 00 00 
+  800662:	48 b8 67 3b 80 00 00 	movabs $0x803b67,%rax
+  800669:	00 00 00 
+  80066c:	ff d0                	call   *%rax
+    memmove(&backup, diskaddr(1), sizeof backup);
+  80066e:	bf 01 00 00 00       	mov    $0x1,%edi
+  800673:	48 bb 17 04 80 00 00 	movabs $0x800417,%rbx
+  80067a:	00 00 00 
+  80067d:	ff d3                	call   *%rbx
+  80067f:	48 89 c6             	mov    %rax,%rsi
+  800682:	ba 08 01 00 00       	mov    $0x108,%edx
+  800687:	48 8d bd e0 fd ff ff 	lea    -0x220(%rbp),%rdi
+  80068e:	48 b8 ec 32 80 00 00 	movabs $0x8032ec,%rax
+  800695:	00 00 00 
+  800698:	ff d0                	call   *%rax
+    strcpy(diskaddr(1), "OOPS!\n");
+  80069a:	bf 01 00 00 00       	mov    $0x1,%edi
+  80069f:	ff d3                	call   *%rbx
+  8006a1:	48 89 c7             	mov    %rax,%rdi
+  8006a4:	48 be 27 56 80 00 00 	movabs $0x805627,%rsi
+  8006ab:	00 00 00 
+  8006ae:	48 b8 f2 30 80 00 00 	movabs $0x8030f2,%rax
+  8006b5:	00 00 00 
+  8006b8:	ff d0                	call   *%rax
+    flush_block(diskaddr(1));
+  8006ba:	bf 01 00 00 00       	mov    $0x1,%edi
+  8006bf:	ff d3                	call   *%rbx
+  8006c1:	48 89 c7             	mov    %rax,%rdi
+  8006c4:	48 b8 6d 04 80 00 00 	movabs $0x80046d,%rax
+  8006cb:	00 00 00 
+  8006ce:	ff d0                	call   *%rax
+    assert(is_page_present(diskaddr(1)));
+  8006d0:	bf 01 00 00 00       	mov    $0x1,%edi
+  8006d5:	ff d3                	call   *%rbx
+  8006d7:	48 89 c7             	mov    %rax,%rdi
+  8006da:	48 b8 1a 51 80 00 00 	movabs $0x80511a,%rax
+  8006e1:	00 00 00 
+  8006e4:	ff d0                	call   *%rax
+  8006e6:	84 c0                	test   %al,%al
+  8006e8:	0f 84 25 01 00 00    	je     800813 <bc_init+0x1c9>
+    assert(!is_page_dirty(diskaddr(1)));
+  8006ee:	bf 01 00 00 00       	mov    $0x1,%edi
+  8006f3:	48 b8 17 04 80 00 00 	movabs $0x800417,%rax
+  8006fa:	00 00 00 
+  8006fd:	ff d0                	call   *%rax
+  8006ff:	48 89 c7             	mov    %rax,%rdi
+  800702:	48 b8 01 51 80 00 00 	movabs $0x805101,%rax
+  800709:	00 00 00 
+  80070c:	ff d0                	call   *%rax
+  80070e:	84 c0                	test   %al,%al
+  800710:	0f 85 2d 01 00 00    	jne    800843 <bc_init+0x1f9>
+    sys_unmap_region(0, diskaddr(1), PAGE_SIZE);
+  800716:	bf 01 00 00 00       	mov    $0x1,%edi
+  80071b:	48 bb 17 04 80 00 00 	movabs $0x800417,%rbx
+  800722:	00 00 00 
+  800725:	ff d3                	call   *%rbx
+  800727:	48 89 c6             	mov    %rax,%rsi
+  80072a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80072f:	bf 00 00 00 00       	mov    $0x0,%edi
+  800734:	48 b8 6e 37 80 00 00 	movabs $0x80376e,%rax
+  80073b:	00 00 00 
+  80073e:	ff d0                	call   *%rax
+    assert(!is_page_present(diskaddr(1)));
+  800740:	bf 01 00 00 00       	mov    $0x1,%edi
+  800745:	ff d3                	call   *%rbx
+  800747:	48 89 c7             	mov    %rax,%rdi
+  80074a:	48 b8 1a 51 80 00 00 	movabs $0x80511a,%rax
+  800751:	00 00 00 
+  800754:	ff d0                	call   *%rax
+  800756:	84 c0                	test   %al,%al
+  800758:	0f 85 1a 01 00 00    	jne    800878 <bc_init+0x22e>
+    assert(strcmp(diskaddr(1), "OOPS!\n") == 0);
+  80075e:	bf 01 00 00 00       	mov    $0x1,%edi
+  800763:	48 b8 17 04 80 00 00 	movabs $0x800417,%rax
+  80076a:	00 00 00 
+  80076d:	ff d0                	call   *%rax
+  80076f:	48 89 c7             	mov    %rax,%rdi
+  800772:	48 be 27 56 80 00 00 	movabs $0x805627,%rsi
+  800779:	00 00 00 
+  80077c:	48 b8 96 31 80 00 00 	movabs $0x803196,%rax
+  800783:	00 00 00 
+  800786:	ff d0                	call   *%rax
+  800788:	85 c0                	test   %eax,%eax
+  80078a:	0f 85 1d 01 00 00    	jne    8008ad <bc_init+0x263>
+    memmove(diskaddr(1), &backup, sizeof backup);
+  800790:	bf 01 00 00 00       	mov    $0x1,%edi
+  800795:	48 bb 17 04 80 00 00 	movabs $0x800417,%rbx
+  80079c:	00 00 00 
+  80079f:	ff d3                	call   *%rbx
+  8007a1:	48 89 c7             	mov    %rax,%rdi
+  8007a4:	ba 08 01 00 00       	mov    $0x108,%edx
+  8007a9:	48 8d b5 e0 fd ff ff 	lea    -0x220(%rbp),%rsi
+  8007b0:	49 bc ec 32 80 00 00 	movabs $0x8032ec,%r12
+  8007b7:	00 00 00 
+  8007ba:	41 ff d4             	call   *%r12
+    flush_block(diskaddr(1));
+  8007bd:	bf 01 00 00 00       	mov    $0x1,%edi
+  8007c2:	ff d3                	call   *%rbx
+  8007c4:	48 89 c7             	mov    %rax,%rdi
+  8007c7:	48 b8 6d 04 80 00 00 	movabs $0x80046d,%rax
+  8007ce:	00 00 00 
+  8007d1:	ff d0                	call   *%rax
+    cprintf("block cache is good\n");
+  8007d3:	48 bf 68 56 80 00 00 	movabs $0x805668,%rdi
+  8007da:	00 00 00 
+  8007dd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007e2:	48 ba cd 27 80 00 00 	movabs $0x8027cd,%rdx
+  8007e9:	00 00 00 
+  8007ec:	ff d2                	call   *%rdx
+    check_bc();
+
+    /* Cache the super block by reading it once */
+    memmove(&super, diskaddr(1), sizeof super);
+  8007ee:	bf 01 00 00 00       	mov    $0x1,%edi
+  8007f3:	ff d3                	call   *%rbx
+  8007f5:	48 89 c6             	mov    %rax,%rsi
+  8007f8:	ba 08 01 00 00       	mov    $0x108,%edx
+  8007fd:	48 8d bd e8 fe ff ff 	lea    -0x118(%rbp),%rdi
+  800804:	41 ff d4             	call   *%r12
+}
+  800807:	48 81 c4 10 02 00 00 	add    $0x210,%rsp
+  80080e:	5b                   	pop    %rbx
+  80080f:	41 5c                	pop    %r12
+  800811:	5d                   	pop    %rbp
+  800812:	c3                   	ret
+    assert(is_page_present(diskaddr(1)));
+  800813:	48 b9 4b 56 80 00 00 	movabs $0x80564b,%rcx
+  80081a:	00 00 00 
+  80081d:	48 ba 1d 55 80 00 00 	movabs $0x80551d,%rdx
+  800824:	00 00 00 
+  800827:	be 6d 00 00 00       	mov    $0x6d,%esi
+  80082c:	48 bf d4 55 80 00 00 	movabs $0x8055d4,%rdi
+  800833:	00 00 00 
+  800836:	49 b8 7d 26 80 00 00 	movabs $0x80267d,%r8
+  80083d:	00 00 00 
+  800840:	41 ff d0             	call   *%r8
+    assert(!is_page_dirty(diskaddr(1)));
+  800843:	48 b9 2e 56 80 00 00 	movabs $0x80562e,%rcx
+  80084a:	00 00 00 
+  80084d:	48 ba 1d 55 80 00 00 	movabs $0x80551d,%rdx
+  800854:	00 00 00 
+  800857:	be 6e 00 00 00       	mov    $0x6e,%esi
+  80085c:	48 bf d4 55 80 00 00 	movabs $0x8055d4,%rdi
+  800863:	00 00 00 
+  800866:	b8 00 00 00 00       	mov    $0x0,%eax
+  80086b:	49 b8 7d 26 80 00 00 	movabs $0x80267d,%r8
+  800872:	00 00 00 
+  800875:	41 ff d0             	call   *%r8
+    assert(!is_page_present(diskaddr(1)));
+  800878:	48 b9 4a 56 80 00 00 	movabs $0x80564a,%rcx
+  80087f:	00 00 00 
+  800882:	48 ba 1d 55 80 00 00 	movabs $0x80551d,%rdx
+  800889:	00 00 00 
+  80088c:	be 72 00 00 00       	mov    $0x72,%esi
+  800891:	48 bf d4 55 80 00 00 	movabs $0x8055d4,%rdi
+  800898:	00 00 00 
+  80089b:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008a0:	49 b8 7d 26 80 00 00 	movabs $0x80267d,%r8
+  8008a7:	00 00 00 
+  8008aa:	41 ff d0             	call   *%r8
+    assert(strcmp(diskaddr(1), "OOPS!\n") == 0);
+  8008ad:	48 b9 b0 55 80 00 00 	movabs $0x8055b0,%rcx
+  8008b4:	00 00 00 
+  8008b7:	48 ba 1d 55 80 00 00 	movabs $0x80551d,%rdx
+  8008be:	00 00 00 
+  8008c1:	be 75 00 00 00       	mov    $0x75,%esi
+  8008c6:	48 bf d4 55 80 00 00 	movabs $0x8055d4,%rdi
+  8008cd:	00 00 00 
+  8008d0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008d5:	49 b8 7d 26 80 00 00 	movabs $0x80267d,%r8
+  8008dc:	00 00 00 
+  8008df:	41 ff d0             	call   *%r8
+
+00000000008008e2 <check_super>:
+ *                         Super block
+ ****************************************************************/
+
+/* Validate the file system super-block. */
+void
+check_super(void) {
+  8008e2:	55                   	push   %rbp
+  8008e3:	48 89 e5             	mov    %rsp,%rbp
+    if (super->s_magic != FS_MAGIC)
+  8008e6:	48 a1 08 c0 80 00 00 	movabs 0x80c008,%rax
+  8008ed:	00 00 00 
+  8008f0:	8b 08                	mov    (%rax),%ecx
+  8008f2:	81 f9 ae 30 05 4a    	cmp    $0x4a0530ae,%ecx
+  8008f8:	75 26                	jne    800920 <check_super+0x3e>
+        panic("bad file system magic number %08x", super->s_magic);
+
+    if (super->s_nblocks > DISKSIZE / BLKSIZE)
+  8008fa:	81 78 04 00 00 0c 00 	cmpl   $0xc0000,0x4(%rax)
+  800901:	77 48                	ja     80094b <check_super+0x69>
+        panic("file system is too large");
+
+    cprintf("superblock is good\n");
+  800903:	48 bf c3 56 80 00 00 	movabs $0x8056c3,%rdi
+  80090a:	00 00 00 
+  80090d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800912:	48 ba cd 27 80 00 00 	movabs $0x8027cd,%rdx
+  800919:	00 00 00 
+  80091c:	ff d2                	call   *%rdx
+}
+  80091e:	5d                   	pop    %rbp
+  80091f:	c3                   	ret
+        panic("bad file system magic number %08x", super->s_magic);
+  800920:	48 ba 80 56 80 00 00 	movabs $0x805680,%rdx
+  800927:	00 00 00 
+  80092a:	be 13 00 00 00       	mov    $0x13,%esi
+  80092f:	48 bf a2 56 80 00 00 	movabs $0x8056a2,%rdi
+  800936:	00 00 00 
+  800939:	b8 00 00 00 00       	mov    $0x0,%eax
+  80093e:	49 b8 7d 26 80 00 00 	movabs $0x80267d,%r8
+  800945:	00 00 00 
+  800948:	41 ff d0             	call   *%r8
+        panic("file system is too large");
+  80094b:	48 ba aa 56 80 00 00 	movabs $0x8056aa,%rdx
+  800952:	00 00 00 
+  800955:	be 16 00 00 00       	mov    $0x16,%esi
+  80095a:	48 bf a2 56 80 00 00 	movabs $0x8056a2,%rdi
+  800961:	00 00 00 
+  800964:	b8 00 00 00 00       	mov    $0x0,%eax
+  800969:	48 b9 7d 26 80 00 00 	movabs $0x80267d,%rcx
+  800970:	00 00 00 
+  800973:	ff d1                	call   *%rcx
+
+0000000000800975 <block_is_free>:
+
+/* Check to see if the block bitmap indicates that block 'blockno' is free.
+ * Return 1 if the block is free, 0 if not. */
+bool
+block_is_free(uint32_t blockno) {
+    if (super == 0 || blockno >= super->s_nblocks) return 0;
+  800975:	48 a1 08 c0 80 00 00 	movabs 0x80c008,%rax
+  80097c:	00 00 00 
+  80097f:	48 85 c0             	test   %rax,%rax
+  800982:	74 2d                	je     8009b1 <block_is_free+0x3c>
+  800984:	ba 00 00 00 00       	mov    $0x0,%edx
+  800989:	3b 78 04             	cmp    0x4(%rax),%edi
+  80098c:	73 20                	jae    8009ae <block_is_free+0x39>
+    if (TSTBIT(bitmap, blockno)) return 1;
+  80098e:	89 fe                	mov    %edi,%esi
+  800990:	c1 ee 05             	shr    $0x5,%esi
+  800993:	89 f6                	mov    %esi,%esi
+  800995:	ba 01 00 00 00       	mov    $0x1,%edx
+  80099a:	89 f9                	mov    %edi,%ecx
+  80099c:	d3 e2                	shl    %cl,%edx
+  80099e:	48 a1 00 c0 80 00 00 	movabs 0x80c000,%rax
+  8009a5:	00 00 00 
+  8009a8:	23 14 b0             	and    (%rax,%rsi,4),%edx
+  8009ab:	0f 95 c2             	setne  %dl
+    return 0;
+}
+  8009ae:	89 d0                	mov    %edx,%eax
+  8009b0:	c3                   	ret
+    if (super == 0 || blockno >= super->s_nblocks) return 0;
+  8009b1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8009b6:	eb f6                	jmp    8009ae <block_is_free+0x39>
+
+00000000008009b8 <free_block>:
+
+/* Mark a block free in the bitmap */
+void
+free_block(uint32_t blockno) {
+    /* Blockno zero is the null pointer of block numbers. */
+    if (blockno == 0) panic("attempt to free zero block");
+  8009b8:	85 ff                	test   %edi,%edi
+  8009ba:	74 1e                	je     8009da <free_block+0x22>
+    SETBIT(bitmap, blockno);
+  8009bc:	89 fa                	mov    %edi,%edx
+  8009be:	c1 ea 05             	shr    $0x5,%edx
+  8009c1:	89 d2                	mov    %edx,%edx
+  8009c3:	48 a1 00 c0 80 00 00 	movabs 0x80c000,%rax
+  8009ca:	00 00 00 
+  8009cd:	be 01 00 00 00       	mov    $0x1,%esi
+  8009d2:	89 f9                	mov    %edi,%ecx
+  8009d4:	d3 e6                	shl    %cl,%esi
+  8009d6:	09 34 90             	or     %esi,(%rax,%rdx,4)
+  8009d9:	c3                   	ret
+free_block(uint32_t blockno) {
+  8009da:	55                   	push   %rbp
+  8009db:	48 89 e5             	mov    %rsp,%rbp
+    if (blockno == 0) panic("attempt to free zero block");
+  8009de:	48 ba d7 56 80 00 00 	movabs $0x8056d7,%rdx
+  8009e5:	00 00 00 
+  8009e8:	be 2c 00 00 00       	mov    $0x2c,%esi
+  8009ed:	48 bf a2 56 80 00 00 	movabs $0x8056a2,%rdi
+  8009f4:	00 00 00 
+  8009f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009fc:	48 b9 7d 26 80 00 00 	movabs $0x80267d,%rcx
+  800a03:	00 00 00 
+  800a06:	ff d1                	call   *%rcx
+
+0000000000800a08 <alloc_block>:
+ * Return block number allocated on success,
+ * 0 if we are out of blocks.
+ *
+ * Hint: use free_block as an example for manipulating the bitmap. */
+blockno_t
+alloc_block(void) {
+  800a08:	55                   	push   %rbp
+  800a09:	48 89 e5             	mov    %rsp,%rbp
+  800a0c:	53                   	push   %rbx
+  800a0d:	48 83 ec 08          	sub    $0x8,%rsp
+     * super->s_nblocks blocks in the disk altogether. */
+
+    // LAB 10: Your code here
+
+    blockno_t b = 2;
+    for (; b < super->s_nblocks; ++b)
+  800a11:	48 a1 08 c0 80 00 00 	movabs 0x80c008,%rax
+  800a18:	00 00 00 
+  800a1b:	8b 78 04             	mov    0x4(%rax),%edi
+  800a1e:	83 ff 02             	cmp    $0x2,%edi
+  800a21:	0f 86 84 00 00 00    	jbe    800aab <alloc_block+0xa3>
+        if (TSTBIT(bitmap, b))
+  800a27:	48 a1 00 c0 80 00 00 	movabs 0x80c000,%rax
+  800a2e:	00 00 00 
+  800a31:	44 8b 08             	mov    (%rax),%r9d
+  800a34:	41 83 e1 04          	and    $0x4,%r9d
+  800a38:	75 7a                	jne    800ab4 <alloc_block+0xac>
+    blockno_t b = 2;
+  800a3a:	bb 02 00 00 00       	mov    $0x2,%ebx
+        if (TSTBIT(bitmap, b))
+  800a3f:	41 b8 01 00 00 00    	mov    $0x1,%r8d
+    for (; b < super->s_nblocks; ++b)
+  800a45:	83 c3 01             	add    $0x1,%ebx
+  800a48:	39 fb                	cmp    %edi,%ebx
+  800a4a:	74 56                	je     800aa2 <alloc_block+0x9a>
+        if (TSTBIT(bitmap, b))
+  800a4c:	89 de                	mov    %ebx,%esi
+  800a4e:	c1 ee 05             	shr    $0x5,%esi
+  800a51:	89 f6                	mov    %esi,%esi
+  800a53:	44 89 c2             	mov    %r8d,%edx
+  800a56:	89 d9                	mov    %ebx,%ecx
+  800a58:	d3 e2                	shl    %cl,%edx
+  800a5a:	23 14 b0             	and    (%rax,%rsi,4),%edx
+  800a5d:	74 e6                	je     800a45 <alloc_block+0x3d>
+            break;
+
+    if (b == super->s_nblocks)
+        return 0;
+
+    CLRBIT(bitmap, b);
+  800a5f:	89 da                	mov    %ebx,%edx
+  800a61:	c1 ea 05             	shr    $0x5,%edx
+  800a64:	89 d2                	mov    %edx,%edx
+  800a66:	48 a1 00 c0 80 00 00 	movabs 0x80c000,%rax
+  800a6d:	00 00 00 
+  800a70:	be fe ff ff ff       	mov    $0xfffffffe,%esi
+  800a75:	89 d9                	mov    %ebx,%ecx
+  800a77:	d3 c6                	rol    %cl,%esi
+  800a79:	21 34 90             	and    %esi,(%rax,%rdx,4)
+    flush_block(diskaddr(2 + b / BLKBITSIZE));
+  800a7c:	89 df                	mov    %ebx,%edi
+  800a7e:	c1 ef 0f             	shr    $0xf,%edi
+  800a81:	83 c7 02             	add    $0x2,%edi
+  800a84:	48 b8 17 04 80 00 00 	movabs $0x800417,%rax
+  800a8b:	00 00 00 
+  800a8e:	ff d0                	call   *%rax
+  800a90:	48 89 c7             	mov    %rax,%rdi
+  800a93:	48 b8 6d 04 80 00 00 	movabs $0x80046d,%rax
+  800a9a:	00 00 00 
+  800a9d:	ff d0                	call   *%rax
+
+    return b;
+  800a9f:	41 89 d9             	mov    %ebx,%r9d
+}
+  800aa2:	44 89 c8             	mov    %r9d,%eax
+  800aa5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800aa9:	c9                   	leave
+  800aaa:	c3                   	ret
+    if (b == super->s_nblocks)
+  800aab:	74 0e                	je     800abb <alloc_block+0xb3>
+    blockno_t b = 2;
+  800aad:	bb 02 00 00 00       	mov    $0x2,%ebx
+  800ab2:	eb ab                	jmp    800a5f <alloc_block+0x57>
+  800ab4:	bb 02 00 00 00       	mov    $0x2,%ebx
+  800ab9:	eb a4                	jmp    800a5f <alloc_block+0x57>
+        return 0;
+  800abb:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800ac1:	eb df                	jmp    800aa2 <alloc_block+0x9a>
+
+0000000000800ac3 <check_bitmap>:
+/* Validate the file system bitmap.
+ *
+ * Check that all reserved blocks -- 0, 1, and the bitmap blocks themselves --
+ * are all marked as in-use. */
+void
+check_bitmap(void) {
+  800ac3:	55                   	push   %rbp
+  800ac4:	48 89 e5             	mov    %rsp,%rbp
+  800ac7:	41 55                	push   %r13
+  800ac9:	41 54                	push   %r12
+  800acb:	53                   	push   %rbx
+  800acc:	48 83 ec 08          	sub    $0x8,%rsp
+
+    /* Make sure all bitmap blocks are marked in-use */
+    for (uint32_t i = 0; i * BLKBITSIZE < super->s_nblocks; i++)
+  800ad0:	48 a1 08 c0 80 00 00 	movabs 0x80c008,%rax
+  800ad7:	00 00 00 
+  800ada:	8b 40 04             	mov    0x4(%rax),%eax
+  800add:	85 c0                	test   %eax,%eax
+  800adf:	74 2a                	je     800b0b <check_bitmap+0x48>
+  800ae1:	41 89 c4             	mov    %eax,%r12d
+  800ae4:	bb 00 00 00 00       	mov    $0x0,%ebx
+        assert(!block_is_free(2 + i));
+  800ae9:	49 bd 75 09 80 00 00 	movabs $0x800975,%r13
+  800af0:	00 00 00 
+  800af3:	8d 7b 02             	lea    0x2(%rbx),%edi
+  800af6:	41 ff d5             	call   *%r13
+  800af9:	84 c0                	test   %al,%al
+  800afb:	75 62                	jne    800b5f <check_bitmap+0x9c>
+    for (uint32_t i = 0; i * BLKBITSIZE < super->s_nblocks; i++)
+  800afd:	83 c3 01             	add    $0x1,%ebx
+  800b00:	89 d8                	mov    %ebx,%eax
+  800b02:	48 c1 e0 0f          	shl    $0xf,%rax
+  800b06:	4c 39 e0             	cmp    %r12,%rax
+  800b09:	7c e8                	jl     800af3 <check_bitmap+0x30>
+
+    /* Make sure the reserved and root blocks are marked in-use. */
+
+    assert(!block_is_free(1));
+  800b0b:	bf 01 00 00 00       	mov    $0x1,%edi
+  800b10:	48 b8 75 09 80 00 00 	movabs $0x800975,%rax
+  800b17:	00 00 00 
+  800b1a:	ff d0                	call   *%rax
+  800b1c:	84 c0                	test   %al,%al
+  800b1e:	75 74                	jne    800b94 <check_bitmap+0xd1>
+    assert(!block_is_free(0));
+  800b20:	bf 00 00 00 00       	mov    $0x0,%edi
+  800b25:	48 b8 75 09 80 00 00 	movabs $0x800975,%rax
+  800b2c:	00 00 00 
+  800b2f:	ff d0                	call   *%rax
+  800b31:	84 c0                	test   %al,%al
+  800b33:	0f 85 90 00 00 00    	jne    800bc9 <check_bitmap+0x106>
+
+    cprintf("bitmap is good\n");
+  800b39:	48 bf 2c 57 80 00 00 	movabs $0x80572c,%rdi
+  800b40:	00 00 00 
+  800b43:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b48:	48 ba cd 27 80 00 00 	movabs $0x8027cd,%rdx
+  800b4f:	00 00 00 
+  800b52:	ff d2                	call   *%rdx
+}
+  800b54:	48 83 c4 08          	add    $0x8,%rsp
+  800b58:	5b                   	pop    %rbx
+  800b59:	41 5c                	pop    %r12
+  800b5b:	41 5d                	pop    %r13
+  800b5d:	5d                   	pop    %rbp
+  800b5e:	c3                   	ret
+        assert(!block_is_free(2 + i));
+  800b5f:	48 b9 f2 56 80 00 00 	movabs $0x8056f2,%rcx
+  800b66:	00 00 00 
+  800b69:	48 ba 1d 55 80 00 00 	movabs $0x80551d,%rdx
+  800b70:	00 00 00 
+  800b73:	be 57 00 00 00       	mov    $0x57,%esi
+  800b78:	48 bf a2 56 80 00 00 	movabs $0x8056a2,%rdi
+  800b7f:	00 00 00 
+  800b82:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b87:	49 b8 7d 26 80 00 00 	movabs $0x80267d,%r8
+  800b8e:	00 00 00 
+  800b91:	41 ff d0             	call   *%r8
+    assert(!block_is_free(1));
+  800b94:	48 b9 08 57 80 00 00 	movabs $0x805708,%rcx
+  800b9b:	00 00 00 
+  800b9e:	48 ba 1d 55 80 00 00 	movabs $0x80551d,%rdx
+  800ba5:	00 00 00 
+  800ba8:	be 5b 00 00 00       	mov    $0x5b,%esi
+  800bad:	48 bf a2 56 80 00 00 	movabs $0x8056a2,%rdi
+  800bb4:	00 00 00 
+  800bb7:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bbc:	49 b8 7d 26 80 00 00 	movabs $0x80267d,%r8
+  800bc3:	00 00 00 
+  800bc6:	41 ff d0             	call   *%r8
+    assert(!block_is_free(0));
+  800bc9:	48 b9 1a 57 80 00 00 	movabs $0x80571a,%rcx
+  800bd0:	00 00 00 
+  800bd3:	48 ba 1d 55 80 00 00 	movabs $0x80551d,%rdx
+  800bda:	00 00 00 
+  800bdd:	be 5c 00 00 00       	mov    $0x5c,%esi
+  800be2:	48 bf a2 56 80 00 00 	movabs $0x8056a2,%rdi
+  800be9:	00 00 00 
+  800bec:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bf1:	49 b8 7d 26 80 00 00 	movabs $0x80267d,%r8
+  800bf8:	00 00 00 
+  800bfb:	41 ff d0             	call   *%r8
+
+0000000000800bfe <fs_init>:
+ *                    File system structures
+ ****************************************************************/
+
+/* Initialize the file system */
+void
+fs_init(void) {
+  800bfe:	55                   	push   %rbp
+  800bff:	48 89 e5             	mov    %rsp,%rbp
+  800c02:	53                   	push   %rbx
+  800c03:	48 83 ec 08          	sub    $0x8,%rsp
+    static_assert(sizeof(struct File) == 256, "Unsupported file size");
+
+    /* Find a JOS disk.  Use the second IDE disk (number 1) if availabl */
+    if (ide_probe_disk1())
+  800c07:	48 b8 4c 00 80 00 00 	movabs $0x80004c,%rax
+  800c0e:	00 00 00 
+  800c11:	ff d0                	call   *%rax
+  800c13:	84 c0                	test   %al,%al
+  800c15:	74 67                	je     800c7e <fs_init+0x80>
+        ide_set_disk(1);
+  800c17:	bf 01 00 00 00       	mov    $0x1,%edi
+  800c1c:	48 b8 d6 00 80 00 00 	movabs $0x8000d6,%rax
+  800c23:	00 00 00 
+  800c26:	ff d0                	call   *%rax
+    else
+        ide_set_disk(0);
+    bc_init();
+  800c28:	48 b8 4a 06 80 00 00 	movabs $0x80064a,%rax
+  800c2f:	00 00 00 
+  800c32:	ff d0                	call   *%rax
+
+    /* Set "super" to point to the super block. */
+    super = diskaddr(1);
+  800c34:	bf 01 00 00 00       	mov    $0x1,%edi
+  800c39:	48 bb 17 04 80 00 00 	movabs $0x800417,%rbx
+  800c40:	00 00 00 
+  800c43:	ff d3                	call   *%rbx
+  800c45:	48 a3 08 c0 80 00 00 	movabs %rax,0x80c008
+  800c4c:	00 00 00 
+    check_super();
+  800c4f:	48 b8 e2 08 80 00 00 	movabs $0x8008e2,%rax
+  800c56:	00 00 00 
+  800c59:	ff d0                	call   *%rax
+
+    /* Set "bitmap" to the beginning of the first bitmap block. */
+    bitmap = diskaddr(2);
+  800c5b:	bf 02 00 00 00       	mov    $0x2,%edi
+  800c60:	ff d3                	call   *%rbx
+  800c62:	48 a3 00 c0 80 00 00 	movabs %rax,0x80c000
+  800c69:	00 00 00 
+
+    check_bitmap();
+  800c6c:	48 b8 c3 0a 80 00 00 	movabs $0x800ac3,%rax
+  800c73:	00 00 00 
+  800c76:	ff d0                	call   *%rax
+}
+  800c78:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800c7c:	c9                   	leave
+  800c7d:	c3                   	ret
+        ide_set_disk(0);
+  800c7e:	bf 00 00 00 00       	mov    $0x0,%edi
+  800c83:	48 b8 d6 00 80 00 00 	movabs $0x8000d6,%rax
+  800c8a:	00 00 00 
+  800c8d:	ff d0                	call   *%rax
+  800c8f:	eb 97                	jmp    800c28 <fs_init+0x2a>
+
+0000000000800c91 <file_block_walk>:
+ * Hint: Don't forget to clear any block you allocate. */
+int
+file_block_walk(struct File *f, blockno_t filebno, blockno_t **ppdiskbno, bool alloc) {
+    // LAB 10: Your code here
+
+    *ppdiskbno = 0;
+  800c91:	48 c7 02 00 00 00 00 	movq   $0x0,(%rdx)
+
+    if (filebno >= NDIRECT + NINDIRECT)
+  800c98:	81 fe 09 04 00 00    	cmp    $0x409,%esi
+  800c9e:	0f 87 82 00 00 00    	ja     800d26 <file_block_walk+0x95>
+file_block_walk(struct File *f, blockno_t filebno, blockno_t **ppdiskbno, bool alloc) {
+  800ca4:	55                   	push   %rbp
+  800ca5:	48 89 e5             	mov    %rsp,%rbp
+  800ca8:	41 55                	push   %r13
+  800caa:	41 54                	push   %r12
+  800cac:	53                   	push   %rbx
+  800cad:	48 83 ec 08          	sub    $0x8,%rsp
+  800cb1:	49 89 fc             	mov    %rdi,%r12
+  800cb4:	89 f3                	mov    %esi,%ebx
+  800cb6:	49 89 d5             	mov    %rdx,%r13
+        return -E_INVAL;
+
+    if (filebno < NDIRECT)
+  800cb9:	83 fe 09             	cmp    $0x9,%esi
+  800cbc:	76 54                	jbe    800d12 <file_block_walk+0x81>
+        #pragma GCC diagnostic pop
+
+        return 0;
+    }
+
+    if (f->f_indirect == 0)
+  800cbe:	83 bf b0 00 00 00 00 	cmpl   $0x0,0xb0(%rdi)
+  800cc5:	75 1c                	jne    800ce3 <file_block_walk+0x52>
+    {
+        if (!alloc)
+  800cc7:	84 c9                	test   %cl,%cl
+  800cc9:	74 61                	je     800d2c <file_block_walk+0x9b>
+            return -E_NOT_FOUND;
+        f->f_indirect = alloc_block();
+  800ccb:	48 b8 08 0a 80 00 00 	movabs $0x800a08,%rax
+  800cd2:	00 00 00 
+  800cd5:	ff d0                	call   *%rax
+  800cd7:	41 89 84 24 b0 00 00 	mov    %eax,0xb0(%r12)
+  800cde:	00 
+        if (f->f_indirect == 0)
+  800cdf:	85 c0                	test   %eax,%eax
+  800ce1:	74 50                	je     800d33 <file_block_walk+0xa2>
+            return -E_NO_DISK;
+    }
+
+    blockno_t *indirect_block = (blockno_t*)diskaddr(f->f_indirect);
+  800ce3:	41 8b bc 24 b0 00 00 	mov    0xb0(%r12),%edi
+  800cea:	00 
+  800ceb:	48 b8 17 04 80 00 00 	movabs $0x800417,%rax
+  800cf2:	00 00 00 
+  800cf5:	ff d0                	call   *%rax
+    *ppdiskbno = &indirect_block[filebno - NDIRECT];
+  800cf7:	8d 53 f6             	lea    -0xa(%rbx),%edx
+  800cfa:	48 8d 04 90          	lea    (%rax,%rdx,4),%rax
+  800cfe:	49 89 45 00          	mov    %rax,0x0(%r13)
+
+    return 0;
+  800d02:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800d07:	48 83 c4 08          	add    $0x8,%rsp
+  800d0b:	5b                   	pop    %rbx
+  800d0c:	41 5c                	pop    %r12
+  800d0e:	41 5d                	pop    %r13
+  800d10:	5d                   	pop    %rbp
+  800d11:	c3                   	ret
+        *ppdiskbno = &f->f_direct[filebno];
+  800d12:	89 f3                	mov    %esi,%ebx
+  800d14:	48 8d 84 9f 88 00 00 	lea    0x88(%rdi,%rbx,4),%rax
+  800d1b:	00 
+  800d1c:	48 89 02             	mov    %rax,(%rdx)
+        return 0;
+  800d1f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d24:	eb e1                	jmp    800d07 <file_block_walk+0x76>
+        return -E_INVAL;
+  800d26:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  800d2b:	c3                   	ret
+            return -E_NOT_FOUND;
+  800d2c:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800d31:	eb d4                	jmp    800d07 <file_block_walk+0x76>
+            return -E_NO_DISK;
+  800d33:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  800d38:	eb cd                	jmp    800d07 <file_block_walk+0x76>
+
+0000000000800d3a <file_get_block>:
+ *  -E_NO_DISK if a block needed to be allocated but the disk is full.
+ *  -E_INVAL if filebno is out of range.
+ *
+ * Hint: Use file_block_walk and alloc_block. */
+int
+file_get_block(struct File *f, uint32_t filebno, char **blk) {
+  800d3a:	55                   	push   %rbp
+  800d3b:	48 89 e5             	mov    %rsp,%rbp
+  800d3e:	41 54                	push   %r12
+  800d40:	53                   	push   %rbx
+  800d41:	48 83 ec 10          	sub    $0x10,%rsp
+  800d45:	48 89 d3             	mov    %rdx,%rbx
+    // LAB 10: Your code here
+
+    *blk = 0;
+  800d48:	48 c7 02 00 00 00 00 	movq   $0x0,(%rdx)
+    blockno_t *pdiskbno = NULL;
+    int res = file_block_walk(f, filebno, &pdiskbno, 1);
+  800d4f:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800d54:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  800d58:	48 b8 91 0c 80 00 00 	movabs $0x800c91,%rax
+  800d5f:	00 00 00 
+  800d62:	ff d0                	call   *%rax
+    if (res < 0)
+  800d64:	85 c0                	test   %eax,%eax
+  800d66:	78 37                	js     800d9f <file_get_block+0x65>
+        return res;
+
+    if (*pdiskbno == 0)
+  800d68:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  800d6c:	41 83 3c 24 00       	cmpl   $0x0,(%r12)
+  800d71:	75 14                	jne    800d87 <file_get_block+0x4d>
+    {
+        *pdiskbno = alloc_block();
+  800d73:	48 b8 08 0a 80 00 00 	movabs $0x800a08,%rax
+  800d7a:	00 00 00 
+  800d7d:	ff d0                	call   *%rax
+  800d7f:	41 89 04 24          	mov    %eax,(%r12)
+        if (*pdiskbno == 0)
+  800d83:	85 c0                	test   %eax,%eax
+  800d85:	74 21                	je     800da8 <file_get_block+0x6e>
+            return -E_NO_DISK;
+    }
+    
+    *blk = diskaddr(*pdiskbno);
+  800d87:	41 8b 3c 24          	mov    (%r12),%edi
+  800d8b:	48 b8 17 04 80 00 00 	movabs $0x800417,%rax
+  800d92:	00 00 00 
+  800d95:	ff d0                	call   *%rax
+  800d97:	48 89 03             	mov    %rax,(%rbx)
+
+    return 0;
+  800d9a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800d9f:	48 83 c4 10          	add    $0x10,%rsp
+  800da3:	5b                   	pop    %rbx
+  800da4:	41 5c                	pop    %r12
+  800da6:	5d                   	pop    %rbp
+  800da7:	c3                   	ret
+            return -E_NO_DISK;
+  800da8:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  800dad:	eb f0                	jmp    800d9f <file_get_block+0x65>
+
+0000000000800daf <walk_path>:
+ * and set *pdir to the directory the file is in.
+ * If we cannot find the file but find the directory
+ * it should be in, set *pdir and copy the final path
+ * element into lastelem. */
+static int
+walk_path(const char *path, struct File **pdir, struct File **pf, char *lastelem) {
+  800daf:	55                   	push   %rbp
+  800db0:	48 89 e5             	mov    %rsp,%rbp
+  800db3:	41 57                	push   %r15
+  800db5:	41 56                	push   %r14
+  800db7:	41 55                	push   %r13
+  800db9:	41 54                	push   %r12
+  800dbb:	53                   	push   %rbx
+  800dbc:	48 81 ec c8 00 00 00 	sub    $0xc8,%rsp
+  800dc3:	48 89 d3             	mov    %rdx,%rbx
+  800dc6:	49 89 cd             	mov    %rcx,%r13
+    while (*p == '/')
+  800dc9:	80 3f 2f             	cmpb   $0x2f,(%rdi)
+  800dcc:	75 09                	jne    800dd7 <walk_path+0x28>
+        p++;
+  800dce:	48 83 c7 01          	add    $0x1,%rdi
+    while (*p == '/')
+  800dd2:	80 3f 2f             	cmpb   $0x2f,(%rdi)
+  800dd5:	74 f7                	je     800dce <walk_path+0x1f>
+    int r;
+
+    //if (*path != '/')
+    //    return -E_BAD_PATH;
+    path = skip_slash(path);
+    f = &super->s_root;
+  800dd7:	48 a1 08 c0 80 00 00 	movabs 0x80c008,%rax
+  800dde:	00 00 00 
+  800de1:	4c 8d 78 08          	lea    0x8(%rax),%r15
+    dir = 0;
+    name[0] = 0;
+  800de5:	c6 85 50 ff ff ff 00 	movb   $0x0,-0xb0(%rbp)
+
+    if (pdir)
+  800dec:	48 85 f6             	test   %rsi,%rsi
+  800def:	74 07                	je     800df8 <walk_path+0x49>
+        *pdir = 0;
+  800df1:	48 c7 06 00 00 00 00 	movq   $0x0,(%rsi)
+    *pf = 0;
+  800df8:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+    dir = 0;
+  800dff:	ba 00 00 00 00       	mov    $0x0,%edx
+            if (strcmp(f[j].f_name, name) == 0) {
+  800e04:	49 be 96 31 80 00 00 	movabs $0x803196,%r14
+  800e0b:	00 00 00 
+  800e0e:	48 89 b5 18 ff ff ff 	mov    %rsi,-0xe8(%rbp)
+  800e15:	48 89 fe             	mov    %rdi,%rsi
+  800e18:	4c 89 ad 10 ff ff ff 	mov    %r13,-0xf0(%rbp)
+    while (*path != '\0') {
+  800e1f:	e9 90 00 00 00       	jmp    800eb4 <walk_path+0x105>
+        dir = f;
+        p = path;
+        while (*path != '/' && *path != '\0')
+  800e24:	49 89 f4             	mov    %rsi,%r12
+            path++;
+        if (path - p >= MAXNAMELEN)
+  800e27:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  800e2d:	e9 b9 00 00 00       	jmp    800eeb <walk_path+0x13c>
+    while (*p == '/')
+  800e32:	4c 89 e6             	mov    %r12,%rsi
+  800e35:	e9 e9 00 00 00       	jmp    800f23 <walk_path+0x174>
+    assert((dir->f_size % BLKSIZE) == 0);
+  800e3a:	48 b9 3c 57 80 00 00 	movabs $0x80573c,%rcx
+  800e41:	00 00 00 
+  800e44:	48 ba 1d 55 80 00 00 	movabs $0x80551d,%rdx
+  800e4b:	00 00 00 
+  800e4e:	be d4 00 00 00       	mov    $0xd4,%esi
+  800e53:	48 bf a2 56 80 00 00 	movabs $0x8056a2,%rdi
+  800e5a:	00 00 00 
+  800e5d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e62:	49 b8 7d 26 80 00 00 	movabs $0x80267d,%r8
+  800e69:	00 00 00 
+  800e6c:	41 ff d0             	call   *%r8
+  800e6f:	48 8b b5 28 ff ff ff 	mov    -0xd8(%rbp),%rsi
+  800e76:	48 8b 9d 20 ff ff ff 	mov    -0xe0(%rbp),%rbx
+  800e7d:	4c 89 bd 38 ff ff ff 	mov    %r15,-0xc8(%rbp)
+  800e84:	eb 1c                	jmp    800ea2 <walk_path+0xf3>
+    for (blockno_t i = 0; i < nblock; i++) {
+  800e86:	4c 89 bd 38 ff ff ff 	mov    %r15,-0xc8(%rbp)
+    return -E_NOT_FOUND;
+  800e8d:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800e92:	eb 0e                	jmp    800ea2 <walk_path+0xf3>
+  800e94:	48 8b b5 28 ff ff ff 	mov    -0xd8(%rbp),%rsi
+  800e9b:	48 8b 9d 20 ff ff ff 	mov    -0xe0(%rbp),%rbx
+  800ea2:	4c 89 fa             	mov    %r15,%rdx
+        path = skip_slash(path);
+
+        if (dir->f_type != FTYPE_DIR)
+            return -E_NOT_FOUND;
+
+        if ((r = dir_lookup(dir, name, &f)) < 0) {
+  800ea5:	85 c0                	test   %eax,%eax
+  800ea7:	0f 88 48 01 00 00    	js     800ff5 <walk_path+0x246>
+  800ead:	4c 8b bd 38 ff ff ff 	mov    -0xc8(%rbp),%r15
+    while (*path != '\0') {
+  800eb4:	0f b6 06             	movzbl (%rsi),%eax
+  800eb7:	84 c0                	test   %al,%al
+  800eb9:	0f 84 80 01 00 00    	je     80103f <walk_path+0x290>
+        while (*path != '/' && *path != '\0')
+  800ebf:	3c 2f                	cmp    $0x2f,%al
+  800ec1:	0f 84 5d ff ff ff    	je     800e24 <walk_path+0x75>
+  800ec7:	49 89 f4             	mov    %rsi,%r12
+            path++;
+  800eca:	49 83 c4 01          	add    $0x1,%r12
+        while (*path != '/' && *path != '\0')
+  800ece:	41 0f b6 04 24       	movzbl (%r12),%eax
+  800ed3:	3c 2f                	cmp    $0x2f,%al
+  800ed5:	74 04                	je     800edb <walk_path+0x12c>
+  800ed7:	84 c0                	test   %al,%al
+  800ed9:	75 ef                	jne    800eca <walk_path+0x11b>
+        if (path - p >= MAXNAMELEN)
+  800edb:	4d 89 e5             	mov    %r12,%r13
+  800ede:	49 29 f5             	sub    %rsi,%r13
+  800ee1:	49 83 fd 7f          	cmp    $0x7f,%r13
+  800ee5:	0f 8f 81 01 00 00    	jg     80106c <walk_path+0x2bd>
+        memmove(name, p, path - p);
+  800eeb:	4c 89 ea             	mov    %r13,%rdx
+  800eee:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  800ef5:	48 b8 ec 32 80 00 00 	movabs $0x8032ec,%rax
+  800efc:	00 00 00 
+  800eff:	ff d0                	call   *%rax
+        name[path - p] = '\0';
+  800f01:	42 c6 84 2d 50 ff ff 	movb   $0x0,-0xb0(%rbp,%r13,1)
+  800f08:	ff 00 
+    while (*p == '/')
+  800f0a:	41 80 3c 24 2f       	cmpb   $0x2f,(%r12)
+  800f0f:	0f 85 1d ff ff ff    	jne    800e32 <walk_path+0x83>
+        p++;
+  800f15:	49 83 c4 01          	add    $0x1,%r12
+    while (*p == '/')
+  800f19:	41 80 3c 24 2f       	cmpb   $0x2f,(%r12)
+  800f1e:	74 f5                	je     800f15 <walk_path+0x166>
+        p++;
+  800f20:	4c 89 e6             	mov    %r12,%rsi
+        if (dir->f_type != FTYPE_DIR)
+  800f23:	41 83 bf 84 00 00 00 	cmpl   $0x1,0x84(%r15)
+  800f2a:	01 
+  800f2b:	0f 85 43 01 00 00    	jne    801074 <walk_path+0x2c5>
+    assert((dir->f_size % BLKSIZE) == 0);
+  800f31:	41 8b 97 80 00 00 00 	mov    0x80(%r15),%edx
+  800f38:	f7 c2 ff 0f 00 00    	test   $0xfff,%edx
+  800f3e:	0f 85 f6 fe ff ff    	jne    800e3a <walk_path+0x8b>
+    blockno_t nblock = dir->f_size / BLKSIZE;
+  800f44:	8d 82 ff 0f 00 00    	lea    0xfff(%rdx),%eax
+  800f4a:	85 d2                	test   %edx,%edx
+  800f4c:	0f 49 c2             	cmovns %edx,%eax
+    for (blockno_t i = 0; i < nblock; i++) {
+  800f4f:	c1 f8 0c             	sar    $0xc,%eax
+  800f52:	89 85 34 ff ff ff    	mov    %eax,-0xcc(%rbp)
+  800f58:	0f 84 28 ff ff ff    	je     800e86 <walk_path+0xd7>
+  800f5e:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            if (strcmp(f[j].f_name, name) == 0) {
+  800f64:	48 89 b5 28 ff ff ff 	mov    %rsi,-0xd8(%rbp)
+  800f6b:	48 89 9d 20 ff ff ff 	mov    %rbx,-0xe0(%rbp)
+        int res = file_get_block(dir, i, &blk);
+  800f72:	48 8d 95 48 ff ff ff 	lea    -0xb8(%rbp),%rdx
+  800f79:	44 89 e6             	mov    %r12d,%esi
+  800f7c:	4c 89 ff             	mov    %r15,%rdi
+  800f7f:	48 b8 3a 0d 80 00 00 	movabs $0x800d3a,%rax
+  800f86:	00 00 00 
+  800f89:	ff d0                	call   *%rax
+        if (res < 0) return res;
+  800f8b:	85 c0                	test   %eax,%eax
+  800f8d:	0f 88 dc fe ff ff    	js     800e6f <walk_path+0xc0>
+        for (blockno_t j = 0; j < BLKFILES; j++)
+  800f93:	48 8b 9d 48 ff ff ff 	mov    -0xb8(%rbp),%rbx
+  800f9a:	4c 8d ab 00 10 00 00 	lea    0x1000(%rbx),%r13
+            if (strcmp(f[j].f_name, name) == 0) {
+  800fa1:	48 89 9d 38 ff ff ff 	mov    %rbx,-0xc8(%rbp)
+  800fa8:	48 8d b5 50 ff ff ff 	lea    -0xb0(%rbp),%rsi
+  800faf:	48 89 df             	mov    %rbx,%rdi
+  800fb2:	41 ff d6             	call   *%r14
+  800fb5:	85 c0                	test   %eax,%eax
+  800fb7:	0f 84 d7 fe ff ff    	je     800e94 <walk_path+0xe5>
+        for (blockno_t j = 0; j < BLKFILES; j++)
+  800fbd:	48 81 c3 00 01 00 00 	add    $0x100,%rbx
+  800fc4:	4c 39 eb             	cmp    %r13,%rbx
+  800fc7:	75 d8                	jne    800fa1 <walk_path+0x1f2>
+    for (blockno_t i = 0; i < nblock; i++) {
+  800fc9:	41 83 c4 01          	add    $0x1,%r12d
+  800fcd:	44 39 a5 34 ff ff ff 	cmp    %r12d,-0xcc(%rbp)
+  800fd4:	75 9c                	jne    800f72 <walk_path+0x1c3>
+  800fd6:	48 8b b5 28 ff ff ff 	mov    -0xd8(%rbp),%rsi
+  800fdd:	48 8b 9d 20 ff ff ff 	mov    -0xe0(%rbp),%rbx
+  800fe4:	4c 89 bd 38 ff ff ff 	mov    %r15,-0xc8(%rbp)
+    return -E_NOT_FOUND;
+  800feb:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800ff0:	e9 ad fe ff ff       	jmp    800ea2 <walk_path+0xf3>
+            if (r == -E_NOT_FOUND && *path == '\0') {
+  800ff5:	41 89 c4             	mov    %eax,%r12d
+  800ff8:	48 89 f7             	mov    %rsi,%rdi
+  800ffb:	48 8b b5 18 ff ff ff 	mov    -0xe8(%rbp),%rsi
+  801002:	4c 8b ad 10 ff ff ff 	mov    -0xf0(%rbp),%r13
+  801009:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  80100c:	75 49                	jne    801057 <walk_path+0x2a8>
+  80100e:	80 3f 00             	cmpb   $0x0,(%rdi)
+  801011:	75 44                	jne    801057 <walk_path+0x2a8>
+                if (pdir)
+  801013:	48 85 f6             	test   %rsi,%rsi
+  801016:	74 03                	je     80101b <walk_path+0x26c>
+                    *pdir = dir;
+  801018:	4c 89 3e             	mov    %r15,(%rsi)
+                if (lastelem)
+  80101b:	4d 85 ed             	test   %r13,%r13
+  80101e:	74 16                	je     801036 <walk_path+0x287>
+                    strcpy(lastelem, name);
+  801020:	48 8d b5 50 ff ff ff 	lea    -0xb0(%rbp),%rsi
+  801027:	4c 89 ef             	mov    %r13,%rdi
+  80102a:	48 b8 f2 30 80 00 00 	movabs $0x8030f2,%rax
+  801031:	00 00 00 
+  801034:	ff d0                	call   *%rax
+                *pf = 0;
+  801036:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  80103d:	eb 18                	jmp    801057 <walk_path+0x2a8>
+            }
+            return r;
+        }
+    }
+
+    if (pdir)
+  80103f:	48 8b b5 18 ff ff ff 	mov    -0xe8(%rbp),%rsi
+  801046:	48 85 f6             	test   %rsi,%rsi
+  801049:	74 03                	je     80104e <walk_path+0x29f>
+        *pdir = dir;
+  80104b:	48 89 16             	mov    %rdx,(%rsi)
+    *pf = f;
+  80104e:	4c 89 3b             	mov    %r15,(%rbx)
+    return 0;
+  801051:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+}
+  801057:	44 89 e0             	mov    %r12d,%eax
+  80105a:	48 81 c4 c8 00 00 00 	add    $0xc8,%rsp
+  801061:	5b                   	pop    %rbx
+  801062:	41 5c                	pop    %r12
+  801064:	41 5d                	pop    %r13
+  801066:	41 5e                	pop    %r14
+  801068:	41 5f                	pop    %r15
+  80106a:	5d                   	pop    %rbp
+  80106b:	c3                   	ret
+            return -E_BAD_PATH;
+  80106c:	41 bc f0 ff ff ff    	mov    $0xfffffff0,%r12d
+  801072:	eb e3                	jmp    801057 <walk_path+0x2a8>
+            return -E_NOT_FOUND;
+  801074:	41 bc f1 ff ff ff    	mov    $0xfffffff1,%r12d
+  80107a:	eb db                	jmp    801057 <walk_path+0x2a8>
+
+000000000080107c <file_open>:
+}
+
+/* Open "path".  On success set *pf to point at the file and return 0.
+ * On error return < 0. */
+int
+file_open(const char *path, struct File **pf) {
+  80107c:	55                   	push   %rbp
+  80107d:	48 89 e5             	mov    %rsp,%rbp
+  801080:	48 89 f2             	mov    %rsi,%rdx
+    return walk_path(path, 0, pf, 0);
+  801083:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801088:	be 00 00 00 00       	mov    $0x0,%esi
+  80108d:	48 b8 af 0d 80 00 00 	movabs $0x800daf,%rax
+  801094:	00 00 00 
+  801097:	ff d0                	call   *%rax
+}
+  801099:	5d                   	pop    %rbp
+  80109a:	c3                   	ret
+
+000000000080109b <file_read>:
+
+/* Read count bytes from f into buf, starting from seek position
+ * offset.  This meant to mimic the standard pread function.
+ * Returns the number of bytes read, < 0 on error. */
+ssize_t
+file_read(struct File *f, void *buf, size_t count, off_t offset) {
+  80109b:	55                   	push   %rbp
+  80109c:	48 89 e5             	mov    %rsp,%rbp
+  80109f:	41 57                	push   %r15
+  8010a1:	41 56                	push   %r14
+  8010a3:	41 55                	push   %r13
+  8010a5:	41 54                	push   %r12
+  8010a7:	53                   	push   %rbx
+  8010a8:	48 83 ec 28          	sub    $0x28,%rsp
+  8010ac:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  8010b0:	89 cb                	mov    %ecx,%ebx
+    char *blk;
+
+    if (offset >= f->f_size)
+  8010b2:	8b 8f 80 00 00 00    	mov    0x80(%rdi),%ecx
+        return 0;
+  8010b8:	b8 00 00 00 00       	mov    $0x0,%eax
+    if (offset >= f->f_size)
+  8010bd:	39 d9                	cmp    %ebx,%ecx
+  8010bf:	0f 8e 9c 00 00 00    	jle    801161 <file_read+0xc6>
+  8010c5:	49 89 f5             	mov    %rsi,%r13
+
+    count = MIN(count, f->f_size - offset);
+  8010c8:	29 d9                	sub    %ebx,%ecx
+  8010ca:	48 63 c9             	movslq %ecx,%rcx
+  8010cd:	48 39 d1             	cmp    %rdx,%rcx
+  8010d0:	48 0f 46 d1          	cmovbe %rcx,%rdx
+  8010d4:	48 89 55 b0          	mov    %rdx,-0x50(%rbp)
+
+    for (off_t pos = offset; pos < offset + count;) {
+  8010d8:	4c 63 f3             	movslq %ebx,%r14
+  8010db:	4e 8d 3c 32          	lea    (%rdx,%r14,1),%r15
+  8010df:	4d 39 fe             	cmp    %r15,%r14
+  8010e2:	73 79                	jae    80115d <file_read+0xc2>
+        int r = file_get_block(f, pos / BLKSIZE, &blk);
+  8010e4:	8d b3 ff 0f 00 00    	lea    0xfff(%rbx),%esi
+  8010ea:	85 db                	test   %ebx,%ebx
+  8010ec:	0f 49 f3             	cmovns %ebx,%esi
+  8010ef:	c1 fe 0c             	sar    $0xc,%esi
+  8010f2:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  8010f6:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  8010fa:	48 b8 3a 0d 80 00 00 	movabs $0x800d3a,%rax
+  801101:	00 00 00 
+  801104:	ff d0                	call   *%rax
+        if (r < 0) return r;
+  801106:	85 c0                	test   %eax,%eax
+  801108:	78 66                	js     801170 <file_read+0xd5>
+
+        int bn = MIN(BLKSIZE - pos % BLKSIZE, offset + count - pos);
+  80110a:	89 d8                	mov    %ebx,%eax
+  80110c:	c1 f8 1f             	sar    $0x1f,%eax
+  80110f:	c1 e8 14             	shr    $0x14,%eax
+  801112:	8d 34 03             	lea    (%rbx,%rax,1),%esi
+  801115:	81 e6 ff 0f 00 00    	and    $0xfff,%esi
+  80111b:	29 c6                	sub    %eax,%esi
+  80111d:	48 63 f6             	movslq %esi,%rsi
+  801120:	41 bc 00 10 00 00    	mov    $0x1000,%r12d
+  801126:	49 29 f4             	sub    %rsi,%r12
+  801129:	4c 89 f8             	mov    %r15,%rax
+  80112c:	4c 29 f0             	sub    %r14,%rax
+  80112f:	49 39 c4             	cmp    %rax,%r12
+  801132:	4c 0f 47 e0          	cmova  %rax,%r12
+        memmove(buf, blk + pos % BLKSIZE, bn);
+  801136:	4d 63 f4             	movslq %r12d,%r14
+  801139:	48 03 75 c8          	add    -0x38(%rbp),%rsi
+  80113d:	4c 89 f2             	mov    %r14,%rdx
+  801140:	4c 89 ef             	mov    %r13,%rdi
+  801143:	48 b8 ec 32 80 00 00 	movabs $0x8032ec,%rax
+  80114a:	00 00 00 
+  80114d:	ff d0                	call   *%rax
+        pos += bn;
+  80114f:	44 01 e3             	add    %r12d,%ebx
+        buf += bn;
+  801152:	4d 01 f5             	add    %r14,%r13
+    for (off_t pos = offset; pos < offset + count;) {
+  801155:	4c 63 f3             	movslq %ebx,%r14
+  801158:	4d 39 fe             	cmp    %r15,%r14
+  80115b:	72 87                	jb     8010e4 <file_read+0x49>
+    }
+
+    return count;
+  80115d:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+}
+  801161:	48 83 c4 28          	add    $0x28,%rsp
+  801165:	5b                   	pop    %rbx
+  801166:	41 5c                	pop    %r12
+  801168:	41 5d                	pop    %r13
+  80116a:	41 5e                	pop    %r14
+  80116c:	41 5f                	pop    %r15
+  80116e:	5d                   	pop    %rbp
+  80116f:	c3                   	ret
+        if (r < 0) return r;
+  801170:	48 98                	cltq
+  801172:	eb ed                	jmp    801161 <file_read+0xc6>
+
+0000000000801174 <file_set_size>:
+    }
+}
+
+/* Set the size of file f, truncating or extending as necessary. */
+int
+file_set_size(struct File *f, off_t newsize) {
+  801174:	55                   	push   %rbp
+  801175:	48 89 e5             	mov    %rsp,%rbp
+  801178:	41 57                	push   %r15
+  80117a:	41 56                	push   %r14
+  80117c:	41 55                	push   %r13
+  80117e:	41 54                	push   %r12
+  801180:	53                   	push   %rbx
+  801181:	48 83 ec 28          	sub    $0x28,%rsp
+  801185:	49 89 fc             	mov    %rdi,%r12
+  801188:	89 75 bc             	mov    %esi,-0x44(%rbp)
+    if (f->f_size > newsize)
+  80118b:	8b 87 80 00 00 00    	mov    0x80(%rdi),%eax
+  801191:	39 f0                	cmp    %esi,%eax
+  801193:	7f 2e                	jg     8011c3 <file_set_size+0x4f>
+        file_truncate_blocks(f, newsize);
+    f->f_size = newsize;
+  801195:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  801198:	41 89 84 24 80 00 00 	mov    %eax,0x80(%r12)
+  80119f:	00 
+    flush_block(f);
+  8011a0:	4c 89 e7             	mov    %r12,%rdi
+  8011a3:	48 b8 6d 04 80 00 00 	movabs $0x80046d,%rax
+  8011aa:	00 00 00 
+  8011ad:	ff d0                	call   *%rax
+    return 0;
+}
+  8011af:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011b4:	48 83 c4 28          	add    $0x28,%rsp
+  8011b8:	5b                   	pop    %rbx
+  8011b9:	41 5c                	pop    %r12
+  8011bb:	41 5d                	pop    %r13
+  8011bd:	41 5e                	pop    %r14
+  8011bf:	41 5f                	pop    %r15
+  8011c1:	5d                   	pop    %rbp
+  8011c2:	c3                   	ret
+    blockno_t old_nblocks = CEILDIV(f->f_size, BLKSIZE);
+  8011c3:	48 98                	cltq
+  8011c5:	48 05 ff 0f 00 00    	add    $0xfff,%rax
+  8011cb:	48 c1 e8 0c          	shr    $0xc,%rax
+  8011cf:	41 89 c6             	mov    %eax,%r14d
+    blockno_t new_nblocks = CEILDIV(newsize, BLKSIZE);
+  8011d2:	48 63 d6             	movslq %esi,%rdx
+  8011d5:	48 81 c2 ff 0f 00 00 	add    $0xfff,%rdx
+  8011dc:	48 c1 ea 0c          	shr    $0xc,%rdx
+  8011e0:	48 89 55 b0          	mov    %rdx,-0x50(%rbp)
+    for (blockno_t bno = new_nblocks; bno < old_nblocks; bno++) {
+  8011e4:	39 c2                	cmp    %eax,%edx
+  8011e6:	73 0e                	jae    8011f6 <file_set_size+0x82>
+  8011e8:	89 d3                	mov    %edx,%ebx
+    int res = file_block_walk(f, filebno, &ptr, 0);
+  8011ea:	49 bf 91 0c 80 00 00 	movabs $0x800c91,%r15
+  8011f1:	00 00 00 
+  8011f4:	eb 54                	jmp    80124a <file_set_size+0xd6>
+    if (new_nblocks <= NDIRECT && f->f_indirect) {
+  8011f6:	83 7d b0 0a          	cmpl   $0xa,-0x50(%rbp)
+  8011fa:	77 99                	ja     801195 <file_set_size+0x21>
+  8011fc:	41 8b bc 24 b0 00 00 	mov    0xb0(%r12),%edi
+  801203:	00 
+  801204:	85 ff                	test   %edi,%edi
+  801206:	74 8d                	je     801195 <file_set_size+0x21>
+        free_block(f->f_indirect);
+  801208:	48 b8 b8 09 80 00 00 	movabs $0x8009b8,%rax
+  80120f:	00 00 00 
+  801212:	ff d0                	call   *%rax
+        f->f_indirect = 0;
+  801214:	41 c7 84 24 b0 00 00 	movl   $0x0,0xb0(%r12)
+  80121b:	00 00 00 00 00 
+  801220:	e9 70 ff ff ff       	jmp    801195 <file_set_size+0x21>
+        if (res < 0) cprintf("warning: file_free_block: %i", res);
+  801225:	89 c6                	mov    %eax,%esi
+  801227:	48 bf 59 57 80 00 00 	movabs $0x805759,%rdi
+  80122e:	00 00 00 
+  801231:	b8 00 00 00 00       	mov    $0x0,%eax
+  801236:	48 b9 cd 27 80 00 00 	movabs $0x8027cd,%rcx
+  80123d:	00 00 00 
+  801240:	ff d1                	call   *%rcx
+    for (blockno_t bno = new_nblocks; bno < old_nblocks; bno++) {
+  801242:	83 c3 01             	add    $0x1,%ebx
+  801245:	44 39 f3             	cmp    %r14d,%ebx
+  801248:	73 ac                	jae    8011f6 <file_set_size+0x82>
+    int res = file_block_walk(f, filebno, &ptr, 0);
+  80124a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80124f:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  801253:	89 de                	mov    %ebx,%esi
+  801255:	4c 89 e7             	mov    %r12,%rdi
+  801258:	41 ff d7             	call   *%r15
+    if (res < 0) return res;
+  80125b:	85 c0                	test   %eax,%eax
+  80125d:	78 c6                	js     801225 <file_set_size+0xb1>
+    if (*ptr) {
+  80125f:	4c 8b 6d c8          	mov    -0x38(%rbp),%r13
+  801263:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  801267:	85 ff                	test   %edi,%edi
+  801269:	74 d7                	je     801242 <file_set_size+0xce>
+        free_block(*ptr);
+  80126b:	48 b8 b8 09 80 00 00 	movabs $0x8009b8,%rax
+  801272:	00 00 00 
+  801275:	ff d0                	call   *%rax
+        *ptr = 0;
+  801277:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  80127e:	00 
+  80127f:	eb c1                	jmp    801242 <file_set_size+0xce>
+
+0000000000801281 <file_write>:
+file_write(struct File *f, const void *buf, size_t count, off_t offset) {
+  801281:	55                   	push   %rbp
+  801282:	48 89 e5             	mov    %rsp,%rbp
+  801285:	41 57                	push   %r15
+  801287:	41 56                	push   %r14
+  801289:	41 55                	push   %r13
+  80128b:	41 54                	push   %r12
+  80128d:	53                   	push   %rbx
+  80128e:	48 83 ec 28          	sub    $0x28,%rsp
+  801292:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  801296:	49 89 f5             	mov    %rsi,%r13
+  801299:	48 89 55 b0          	mov    %rdx,-0x50(%rbp)
+  80129d:	89 cb                	mov    %ecx,%ebx
+    if (offset + count > f->f_size)
+  80129f:	4c 63 e1             	movslq %ecx,%r12
+  8012a2:	4d 8d 34 14          	lea    (%r12,%rdx,1),%r14
+  8012a6:	48 63 87 80 00 00 00 	movslq 0x80(%rdi),%rax
+  8012ad:	4c 39 f0             	cmp    %r14,%rax
+  8012b0:	0f 82 98 00 00 00    	jb     80134e <file_write+0xcd>
+        if ((res = file_get_block(f, pos / BLKSIZE, &blk)) < 0) return res;
+  8012b6:	49 bf 3a 0d 80 00 00 	movabs $0x800d3a,%r15
+  8012bd:	00 00 00 
+    for (off_t pos = offset; pos < offset + count;) {
+  8012c0:	4d 39 f4             	cmp    %r14,%r12
+  8012c3:	73 76                	jae    80133b <file_write+0xba>
+        if ((res = file_get_block(f, pos / BLKSIZE, &blk)) < 0) return res;
+  8012c5:	8d b3 ff 0f 00 00    	lea    0xfff(%rbx),%esi
+  8012cb:	85 db                	test   %ebx,%ebx
+  8012cd:	0f 49 f3             	cmovns %ebx,%esi
+  8012d0:	c1 fe 0c             	sar    $0xc,%esi
+  8012d3:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  8012d7:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  8012db:	41 ff d7             	call   *%r15
+  8012de:	85 c0                	test   %eax,%eax
+  8012e0:	0f 88 88 00 00 00    	js     80136e <file_write+0xed>
+        uint32_t bn = MIN(BLKSIZE - pos % BLKSIZE, offset + count - pos);
+  8012e6:	89 d8                	mov    %ebx,%eax
+  8012e8:	c1 f8 1f             	sar    $0x1f,%eax
+  8012eb:	c1 e8 14             	shr    $0x14,%eax
+  8012ee:	8d 3c 03             	lea    (%rbx,%rax,1),%edi
+  8012f1:	81 e7 ff 0f 00 00    	and    $0xfff,%edi
+  8012f7:	29 c7                	sub    %eax,%edi
+  8012f9:	48 63 ff             	movslq %edi,%rdi
+  8012fc:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801301:	48 29 fa             	sub    %rdi,%rdx
+  801304:	4c 89 f0             	mov    %r14,%rax
+  801307:	4c 29 e0             	sub    %r12,%rax
+  80130a:	48 39 c2             	cmp    %rax,%rdx
+  80130d:	48 0f 46 c2          	cmovbe %rdx,%rax
+  801311:	49 89 c4             	mov    %rax,%r12
+        memmove(blk + pos % BLKSIZE, buf, bn);
+  801314:	48 03 7d c8          	add    -0x38(%rbp),%rdi
+  801318:	48 89 c2             	mov    %rax,%rdx
+  80131b:	4c 89 ee             	mov    %r13,%rsi
+  80131e:	48 b8 ec 32 80 00 00 	movabs $0x8032ec,%rax
+  801325:	00 00 00 
+  801328:	ff d0                	call   *%rax
+        pos += bn;
+  80132a:	42 8d 04 23          	lea    (%rbx,%r12,1),%eax
+  80132e:	89 c3                	mov    %eax,%ebx
+        buf += bn;
+  801330:	4d 01 e5             	add    %r12,%r13
+    for (off_t pos = offset; pos < offset + count;) {
+  801333:	4c 63 e0             	movslq %eax,%r12
+  801336:	4d 39 f4             	cmp    %r14,%r12
+  801339:	72 8a                	jb     8012c5 <file_write+0x44>
+    return count;
+  80133b:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+}
+  80133f:	48 83 c4 28          	add    $0x28,%rsp
+  801343:	5b                   	pop    %rbx
+  801344:	41 5c                	pop    %r12
+  801346:	41 5d                	pop    %r13
+  801348:	41 5e                	pop    %r14
+  80134a:	41 5f                	pop    %r15
+  80134c:	5d                   	pop    %rbp
+  80134d:	c3                   	ret
+        if ((res = file_set_size(f, offset + count)) < 0) return res;
+  80134e:	8b 45 b0             	mov    -0x50(%rbp),%eax
+  801351:	8d 34 01             	lea    (%rcx,%rax,1),%esi
+  801354:	48 b8 74 11 80 00 00 	movabs $0x801174,%rax
+  80135b:	00 00 00 
+  80135e:	ff d0                	call   *%rax
+  801360:	89 c2                	mov    %eax,%edx
+  801362:	48 98                	cltq
+  801364:	85 d2                	test   %edx,%edx
+  801366:	0f 89 4a ff ff ff    	jns    8012b6 <file_write+0x35>
+  80136c:	eb d1                	jmp    80133f <file_write+0xbe>
+        if ((res = file_get_block(f, pos / BLKSIZE, &blk)) < 0) return res;
+  80136e:	48 98                	cltq
+  801370:	eb cd                	jmp    80133f <file_write+0xbe>
+
+0000000000801372 <file_flush>:
+/* Flush the contents and metadata of file f out to disk.
+ * Loop over all the blocks in file.
+ * Translate the file block number into a disk block number
+ * and then check whether that disk block is dirty.  If so, write it out. */
+void
+file_flush(struct File *f) {
+  801372:	55                   	push   %rbp
+  801373:	48 89 e5             	mov    %rsp,%rbp
+  801376:	41 57                	push   %r15
+  801378:	41 56                	push   %r14
+  80137a:	41 55                	push   %r13
+  80137c:	41 54                	push   %r12
+  80137e:	53                   	push   %rbx
+  80137f:	48 83 ec 18          	sub    $0x18,%rsp
+  801383:	49 89 fc             	mov    %rdi,%r12
+    blockno_t *pdiskbno;
+
+    for (blockno_t i = 0; i < CEILDIV(f->f_size, BLKSIZE); i++) {
+  801386:	48 63 87 80 00 00 00 	movslq 0x80(%rdi),%rax
+  80138d:	48 05 ff 0f 00 00    	add    $0xfff,%rax
+  801393:	48 c1 e8 0c          	shr    $0xc,%rax
+  801397:	85 c0                	test   %eax,%eax
+  801399:	74 6d                	je     801408 <file_flush+0x96>
+  80139b:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (file_block_walk(f, i, &pdiskbno, 0) < 0 ||
+  8013a0:	49 bd 91 0c 80 00 00 	movabs $0x800c91,%r13
+  8013a7:	00 00 00 
+            pdiskbno == NULL || *pdiskbno == 0)
+            continue;
+        flush_block(diskaddr(*pdiskbno));
+  8013aa:	49 bf 17 04 80 00 00 	movabs $0x800417,%r15
+  8013b1:	00 00 00 
+  8013b4:	49 be 6d 04 80 00 00 	movabs $0x80046d,%r14
+  8013bb:	00 00 00 
+  8013be:	eb 19                	jmp    8013d9 <file_flush+0x67>
+    for (blockno_t i = 0; i < CEILDIV(f->f_size, BLKSIZE); i++) {
+  8013c0:	83 c3 01             	add    $0x1,%ebx
+  8013c3:	49 63 84 24 80 00 00 	movslq 0x80(%r12),%rax
+  8013ca:	00 
+  8013cb:	48 05 ff 0f 00 00    	add    $0xfff,%rax
+  8013d1:	48 c1 e8 0c          	shr    $0xc,%rax
+  8013d5:	39 c3                	cmp    %eax,%ebx
+  8013d7:	73 2f                	jae    801408 <file_flush+0x96>
+        if (file_block_walk(f, i, &pdiskbno, 0) < 0 ||
+  8013d9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8013de:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  8013e2:	89 de                	mov    %ebx,%esi
+  8013e4:	4c 89 e7             	mov    %r12,%rdi
+  8013e7:	41 ff d5             	call   *%r13
+  8013ea:	85 c0                	test   %eax,%eax
+  8013ec:	78 d2                	js     8013c0 <file_flush+0x4e>
+            pdiskbno == NULL || *pdiskbno == 0)
+  8013ee:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+        if (file_block_walk(f, i, &pdiskbno, 0) < 0 ||
+  8013f2:	48 85 c0             	test   %rax,%rax
+  8013f5:	74 c9                	je     8013c0 <file_flush+0x4e>
+            pdiskbno == NULL || *pdiskbno == 0)
+  8013f7:	8b 38                	mov    (%rax),%edi
+  8013f9:	85 ff                	test   %edi,%edi
+  8013fb:	74 c3                	je     8013c0 <file_flush+0x4e>
+        flush_block(diskaddr(*pdiskbno));
+  8013fd:	41 ff d7             	call   *%r15
+  801400:	48 89 c7             	mov    %rax,%rdi
+  801403:	41 ff d6             	call   *%r14
+  801406:	eb b8                	jmp    8013c0 <file_flush+0x4e>
+    }
+    if (f->f_indirect)
+  801408:	41 8b bc 24 b0 00 00 	mov    0xb0(%r12),%edi
+  80140f:	00 
+  801410:	85 ff                	test   %edi,%edi
+  801412:	75 1e                	jne    801432 <file_flush+0xc0>
+        flush_block(diskaddr(f->f_indirect));
+    flush_block(f);
+  801414:	4c 89 e7             	mov    %r12,%rdi
+  801417:	48 b8 6d 04 80 00 00 	movabs $0x80046d,%rax
+  80141e:	00 00 00 
+  801421:	ff d0                	call   *%rax
+}
+  801423:	48 83 c4 18          	add    $0x18,%rsp
+  801427:	5b                   	pop    %rbx
+  801428:	41 5c                	pop    %r12
+  80142a:	41 5d                	pop    %r13
+  80142c:	41 5e                	pop    %r14
+  80142e:	41 5f                	pop    %r15
+  801430:	5d                   	pop    %rbp
+  801431:	c3                   	ret
+        flush_block(diskaddr(f->f_indirect));
+  801432:	48 b8 17 04 80 00 00 	movabs $0x800417,%rax
+  801439:	00 00 00 
+  80143c:	ff d0                	call   *%rax
+  80143e:	48 89 c7             	mov    %rax,%rdi
+  801441:	48 b8 6d 04 80 00 00 	movabs $0x80046d,%rax
+  801448:	00 00 00 
+  80144b:	ff d0                	call   *%rax
+  80144d:	eb c5                	jmp    801414 <file_flush+0xa2>
+
+000000000080144f <file_create>:
+file_create(const char *path, struct File **pf) {
+  80144f:	55                   	push   %rbp
+  801450:	48 89 e5             	mov    %rsp,%rbp
+  801453:	41 57                	push   %r15
+  801455:	41 56                	push   %r14
+  801457:	41 55                	push   %r13
+  801459:	41 54                	push   %r12
+  80145b:	53                   	push   %rbx
+  80145c:	48 81 ec b8 00 00 00 	sub    $0xb8,%rsp
+  801463:	48 89 b5 28 ff ff ff 	mov    %rsi,-0xd8(%rbp)
+    if (!(res = walk_path(path, &dir, &filp, name))) return -E_FILE_EXISTS;
+  80146a:	48 8d 8d 50 ff ff ff 	lea    -0xb0(%rbp),%rcx
+  801471:	48 8d 95 40 ff ff ff 	lea    -0xc0(%rbp),%rdx
+  801478:	48 8d b5 48 ff ff ff 	lea    -0xb8(%rbp),%rsi
+  80147f:	48 b8 af 0d 80 00 00 	movabs $0x800daf,%rax
+  801486:	00 00 00 
+  801489:	ff d0                	call   *%rax
+  80148b:	85 c0                	test   %eax,%eax
+  80148d:	0f 84 55 01 00 00    	je     8015e8 <file_create+0x199>
+  801493:	89 c3                	mov    %eax,%ebx
+    if (res != -E_NOT_FOUND || dir == 0) return res;
+  801495:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  801498:	0f 85 fd 00 00 00    	jne    80159b <file_create+0x14c>
+  80149e:	4c 8b ad 48 ff ff ff 	mov    -0xb8(%rbp),%r13
+  8014a5:	4d 85 ed             	test   %r13,%r13
+  8014a8:	0f 84 ed 00 00 00    	je     80159b <file_create+0x14c>
+    assert((dir->f_size % BLKSIZE) == 0);
+  8014ae:	41 8b 85 80 00 00 00 	mov    0x80(%r13),%eax
+  8014b5:	89 c3                	mov    %eax,%ebx
+  8014b7:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+  8014bd:	0f 85 ec 00 00 00    	jne    8015af <file_create+0x160>
+    blockno_t nblock = dir->f_size / BLKSIZE;
+  8014c3:	8d 90 ff 0f 00 00    	lea    0xfff(%rax),%edx
+  8014c9:	85 c0                	test   %eax,%eax
+  8014cb:	0f 48 c2             	cmovs  %edx,%eax
+    for (blockno_t i = 0; i < nblock; i++) {
+  8014ce:	c1 f8 0c             	sar    $0xc,%eax
+  8014d1:	89 85 24 ff ff ff    	mov    %eax,-0xdc(%rbp)
+  8014d7:	74 56                	je     80152f <file_create+0xe0>
+  8014d9:	41 be 00 00 00 00    	mov    $0x0,%r14d
+        int res = file_get_block(dir, i, &blk);
+  8014df:	49 bf 3a 0d 80 00 00 	movabs $0x800d3a,%r15
+  8014e6:	00 00 00 
+  8014e9:	48 8d 95 38 ff ff ff 	lea    -0xc8(%rbp),%rdx
+  8014f0:	44 89 f6             	mov    %r14d,%esi
+  8014f3:	4c 89 ef             	mov    %r13,%rdi
+  8014f6:	41 ff d7             	call   *%r15
+        if (res < 0) return res;
+  8014f9:	85 c0                	test   %eax,%eax
+  8014fb:	0f 88 e3 00 00 00    	js     8015e4 <file_create+0x195>
+        for (blockno_t j = 0; j < BLKFILES; j++) {
+  801501:	48 8b 85 38 ff ff ff 	mov    -0xc8(%rbp),%rax
+  801508:	48 8d 90 00 10 00 00 	lea    0x1000(%rax),%rdx
+            if (f[j].f_name[0] == '\0') {
+  80150f:	49 89 c4             	mov    %rax,%r12
+  801512:	80 38 00             	cmpb   $0x0,(%rax)
+  801515:	74 4e                	je     801565 <file_create+0x116>
+        for (blockno_t j = 0; j < BLKFILES; j++) {
+  801517:	48 05 00 01 00 00    	add    $0x100,%rax
+  80151d:	48 39 d0             	cmp    %rdx,%rax
+  801520:	75 ed                	jne    80150f <file_create+0xc0>
+    for (blockno_t i = 0; i < nblock; i++) {
+  801522:	41 83 c6 01          	add    $0x1,%r14d
+  801526:	44 39 b5 24 ff ff ff 	cmp    %r14d,-0xdc(%rbp)
+  80152d:	75 ba                	jne    8014e9 <file_create+0x9a>
+    dir->f_size += BLKSIZE;
+  80152f:	41 81 85 80 00 00 00 	addl   $0x1000,0x80(%r13)
+  801536:	00 10 00 00 
+    int res = file_get_block(dir, nblock, &blk);
+  80153a:	48 8d 95 38 ff ff ff 	lea    -0xc8(%rbp),%rdx
+  801541:	8b b5 24 ff ff ff    	mov    -0xdc(%rbp),%esi
+  801547:	4c 89 ef             	mov    %r13,%rdi
+  80154a:	48 b8 3a 0d 80 00 00 	movabs $0x800d3a,%rax
+  801551:	00 00 00 
+  801554:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801556:	85 c0                	test   %eax,%eax
+  801558:	0f 88 91 00 00 00    	js     8015ef <file_create+0x1a0>
+    *file = (struct File *)blk;
+  80155e:	4c 8b a5 38 ff ff ff 	mov    -0xc8(%rbp),%r12
+  801565:	4c 89 a5 40 ff ff ff 	mov    %r12,-0xc0(%rbp)
+    strcpy(filp->f_name, name);
+  80156c:	48 8d b5 50 ff ff ff 	lea    -0xb0(%rbp),%rsi
+  801573:	4c 89 e7             	mov    %r12,%rdi
+  801576:	48 b8 f2 30 80 00 00 	movabs $0x8030f2,%rax
+  80157d:	00 00 00 
+  801580:	ff d0                	call   *%rax
+    *pf = filp;
+  801582:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  801589:	4c 89 20             	mov    %r12,(%rax)
+    file_flush(dir);
+  80158c:	4c 89 ef             	mov    %r13,%rdi
+  80158f:	48 b8 72 13 80 00 00 	movabs $0x801372,%rax
+  801596:	00 00 00 
+  801599:	ff d0                	call   *%rax
+}
+  80159b:	89 d8                	mov    %ebx,%eax
+  80159d:	48 81 c4 b8 00 00 00 	add    $0xb8,%rsp
+  8015a4:	5b                   	pop    %rbx
+  8015a5:	41 5c                	pop    %r12
+  8015a7:	41 5d                	pop    %r13
+  8015a9:	41 5e                	pop    %r14
+  8015ab:	41 5f                	pop    %r15
+  8015ad:	5d                   	pop    %rbp
+  8015ae:	c3                   	ret
+    assert((dir->f_size % BLKSIZE) == 0);
+  8015af:	48 b9 3c 57 80 00 00 	movabs $0x80573c,%rcx
+  8015b6:	00 00 00 
+  8015b9:	48 ba 1d 55 80 00 00 	movabs $0x80551d,%rdx
+  8015c0:	00 00 00 
+  8015c3:	be eb 00 00 00       	mov    $0xeb,%esi
+  8015c8:	48 bf a2 56 80 00 00 	movabs $0x8056a2,%rdi
+  8015cf:	00 00 00 
+  8015d2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015d7:	49 b8 7d 26 80 00 00 	movabs $0x80267d,%r8
+  8015de:	00 00 00 
+  8015e1:	41 ff d0             	call   *%r8
+        int res = file_get_block(dir, i, &blk);
+  8015e4:	89 c3                	mov    %eax,%ebx
+  8015e6:	eb b3                	jmp    80159b <file_create+0x14c>
+    if (!(res = walk_path(path, &dir, &filp, name))) return -E_FILE_EXISTS;
+  8015e8:	bb ef ff ff ff       	mov    $0xffffffef,%ebx
+  8015ed:	eb ac                	jmp    80159b <file_create+0x14c>
+    if (res < 0) return res;
+  8015ef:	89 c3                	mov    %eax,%ebx
+  8015f1:	eb a8                	jmp    80159b <file_create+0x14c>
+
+00000000008015f3 <fs_sync>:
+
+/* Sync the entire file system.  A big hammer. */
+void
+fs_sync(void) {
+    for (int i = 1; i < super->s_nblocks; i++) {
+  8015f3:	48 a1 08 c0 80 00 00 	movabs 0x80c008,%rax
+  8015fa:	00 00 00 
+  8015fd:	83 78 04 01          	cmpl   $0x1,0x4(%rax)
+  801601:	76 4e                	jbe    801651 <fs_sync+0x5e>
+fs_sync(void) {
+  801603:	55                   	push   %rbp
+  801604:	48 89 e5             	mov    %rsp,%rbp
+  801607:	41 56                	push   %r14
+  801609:	41 55                	push   %r13
+  80160b:	41 54                	push   %r12
+  80160d:	53                   	push   %rbx
+    for (int i = 1; i < super->s_nblocks; i++) {
+  80160e:	bb 01 00 00 00       	mov    $0x1,%ebx
+        flush_block(diskaddr(i));
+  801613:	49 be 17 04 80 00 00 	movabs $0x800417,%r14
+  80161a:	00 00 00 
+  80161d:	49 bd 6d 04 80 00 00 	movabs $0x80046d,%r13
+  801624:	00 00 00 
+    for (int i = 1; i < super->s_nblocks; i++) {
+  801627:	49 bc 08 c0 80 00 00 	movabs $0x80c008,%r12
+  80162e:	00 00 00 
+        flush_block(diskaddr(i));
+  801631:	89 df                	mov    %ebx,%edi
+  801633:	41 ff d6             	call   *%r14
+  801636:	48 89 c7             	mov    %rax,%rdi
+  801639:	41 ff d5             	call   *%r13
+    for (int i = 1; i < super->s_nblocks; i++) {
+  80163c:	83 c3 01             	add    $0x1,%ebx
+  80163f:	49 8b 04 24          	mov    (%r12),%rax
+  801643:	3b 58 04             	cmp    0x4(%rax),%ebx
+  801646:	72 e9                	jb     801631 <fs_sync+0x3e>
+    }
+}
+  801648:	5b                   	pop    %rbx
+  801649:	41 5c                	pop    %r12
+  80164b:	41 5d                	pop    %r13
+  80164d:	41 5e                	pop    %r14
+  80164f:	5d                   	pop    %rbp
+  801650:	c3                   	ret
+  801651:	c3                   	ret
+
+0000000000801652 <serve_sync>:
+    file_flush(o->o_file);
+    return 0;
+}
+
+int
+serve_sync(envid_t envid, union Fsipc *req) {
+  801652:	55                   	push   %rbp
+  801653:	48 89 e5             	mov    %rsp,%rbp
+    fs_sync();
+  801656:	48 b8 f3 15 80 00 00 	movabs $0x8015f3,%rax
+  80165d:	00 00 00 
+  801660:	ff d0                	call   *%rax
+    return 0;
+}
+  801662:	b8 00 00 00 00       	mov    $0x0,%eax
+  801667:	5d                   	pop    %rbp
+  801668:	c3                   	ret
+
+0000000000801669 <serve_init>:
+    for (size_t i = 0; i < MAXOPEN; i++) {
+  801669:	48 ba 80 70 80 00 00 	movabs $0x807080,%rdx
+  801670:	00 00 00 
+  801673:	b9 00 00 00 00       	mov    $0x0,%ecx
+    uintptr_t va = FILE_BASE;
+  801678:	48 b8 00 00 00 00 02 	movabs $0x200000000,%rax
+  80167f:	00 00 00 
+    for (size_t i = 0; i < MAXOPEN; i++) {
+  801682:	48 be 00 00 20 00 02 	movabs $0x200200000,%rsi
+  801689:	00 00 00 
+        opentab[i].o_fileid = i;
+  80168c:	89 0a                	mov    %ecx,(%rdx)
+        opentab[i].o_fd = (struct Fd *)va;
+  80168e:	48 89 42 18          	mov    %rax,0x18(%rdx)
+        va += PAGE_SIZE;
+  801692:	48 05 00 10 00 00    	add    $0x1000,%rax
+    for (size_t i = 0; i < MAXOPEN; i++) {
+  801698:	48 83 c1 01          	add    $0x1,%rcx
+  80169c:	48 83 c2 20          	add    $0x20,%rdx
+  8016a0:	48 39 f0             	cmp    %rsi,%rax
+  8016a3:	75 e7                	jne    80168c <serve_init+0x23>
+}
+  8016a5:	c3                   	ret
+
+00000000008016a6 <openfile_alloc>:
+openfile_alloc(struct OpenFile **o) {
+  8016a6:	55                   	push   %rbp
+  8016a7:	48 89 e5             	mov    %rsp,%rbp
+  8016aa:	41 56                	push   %r14
+  8016ac:	41 55                	push   %r13
+  8016ae:	41 54                	push   %r12
+  8016b0:	53                   	push   %rbx
+  8016b1:	49 89 fc             	mov    %rdi,%r12
+    for (size_t i = 0; i < MAXOPEN; i++) {
+  8016b4:	49 bd 98 70 80 00 00 	movabs $0x807098,%r13
+  8016bb:	00 00 00 
+  8016be:	bb 00 00 00 00       	mov    $0x0,%ebx
+        switch (sys_region_refs(opentab[i].o_fd, PAGE_SIZE)) {
+  8016c3:	49 be 44 36 80 00 00 	movabs $0x803644,%r14
+  8016ca:	00 00 00 
+  8016cd:	49 8b 7d 00          	mov    0x0(%r13),%rdi
+  8016d1:	be 00 10 00 00       	mov    $0x1000,%esi
+  8016d6:	41 ff d6             	call   *%r14
+  8016d9:	85 c0                	test   %eax,%eax
+  8016db:	74 1d                	je     8016fa <openfile_alloc+0x54>
+  8016dd:	83 f8 01             	cmp    $0x1,%eax
+  8016e0:	74 4d                	je     80172f <openfile_alloc+0x89>
+    for (size_t i = 0; i < MAXOPEN; i++) {
+  8016e2:	48 83 c3 01          	add    $0x1,%rbx
+  8016e6:	49 83 c5 20          	add    $0x20,%r13
+  8016ea:	48 81 fb 00 02 00 00 	cmp    $0x200,%rbx
+  8016f1:	75 da                	jne    8016cd <openfile_alloc+0x27>
+    return -E_MAX_OPEN;
+  8016f3:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+  8016f8:	eb 70                	jmp    80176a <openfile_alloc+0xc4>
+            int res = sys_alloc_region(0, opentab[i].o_fd, PAGE_SIZE, PROT_RW);
+  8016fa:	48 89 d8             	mov    %rbx,%rax
+  8016fd:	48 c1 e0 05          	shl    $0x5,%rax
+  801701:	48 ba 80 70 80 00 00 	movabs $0x807080,%rdx
+  801708:	00 00 00 
+  80170b:	48 8b 74 02 18       	mov    0x18(%rdx,%rax,1),%rsi
+  801710:	b9 06 00 00 00       	mov    $0x6,%ecx
+  801715:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80171a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80171f:	48 b8 a2 36 80 00 00 	movabs $0x8036a2,%rax
+  801726:	00 00 00 
+  801729:	ff d0                	call   *%rax
+            if (res < 0) return res;
+  80172b:	85 c0                	test   %eax,%eax
+  80172d:	78 3b                	js     80176a <openfile_alloc+0xc4>
+            opentab[i].o_fileid += MAXOPEN;
+  80172f:	48 c1 e3 05          	shl    $0x5,%rbx
+  801733:	48 b8 80 70 80 00 00 	movabs $0x807080,%rax
+  80173a:	00 00 00 
+  80173d:	48 01 c3             	add    %rax,%rbx
+  801740:	81 03 00 02 00 00    	addl   $0x200,(%rbx)
+            *o = &opentab[i];
+  801746:	49 89 1c 24          	mov    %rbx,(%r12)
+            memset(opentab[i].o_fd, 0, PAGE_SIZE);
+  80174a:	48 8b 7b 18          	mov    0x18(%rbx),%rdi
+  80174e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801753:	be 00 00 00 00       	mov    $0x0,%esi
+  801758:	48 b8 3e 32 80 00 00 	movabs $0x80323e,%rax
+  80175f:	00 00 00 
+  801762:	ff d0                	call   *%rax
+            return (*o)->o_fileid;
+  801764:	49 8b 04 24          	mov    (%r12),%rax
+  801768:	8b 00                	mov    (%rax),%eax
+}
+  80176a:	5b                   	pop    %rbx
+  80176b:	41 5c                	pop    %r12
+  80176d:	41 5d                	pop    %r13
+  80176f:	41 5e                	pop    %r14
+  801771:	5d                   	pop    %rbp
+  801772:	c3                   	ret
+
+0000000000801773 <openfile_lookup>:
+openfile_lookup(envid_t envid, uint32_t fileid, struct OpenFile **po) {
+  801773:	55                   	push   %rbp
+  801774:	48 89 e5             	mov    %rsp,%rbp
+  801777:	41 56                	push   %r14
+  801779:	41 55                	push   %r13
+  80177b:	41 54                	push   %r12
+  80177d:	53                   	push   %rbx
+  80177e:	41 89 f5             	mov    %esi,%r13d
+  801781:	49 89 d6             	mov    %rdx,%r14
+    o = &opentab[fileid % MAXOPEN];
+  801784:	41 89 f4             	mov    %esi,%r12d
+  801787:	41 81 e4 ff 01 00 00 	and    $0x1ff,%r12d
+  80178e:	44 89 e3             	mov    %r12d,%ebx
+  801791:	48 c1 e3 05          	shl    $0x5,%rbx
+  801795:	48 b8 80 70 80 00 00 	movabs $0x807080,%rax
+  80179c:	00 00 00 
+  80179f:	48 01 c3             	add    %rax,%rbx
+    if (sys_region_refs(o->o_fd, PAGE_SIZE) <= 1 || o->o_fileid != fileid)
+  8017a2:	48 8b 7b 18          	mov    0x18(%rbx),%rdi
+  8017a6:	be 00 10 00 00       	mov    $0x1000,%esi
+  8017ab:	48 b8 44 36 80 00 00 	movabs $0x803644,%rax
+  8017b2:	00 00 00 
+  8017b5:	ff d0                	call   *%rax
+  8017b7:	83 f8 01             	cmp    $0x1,%eax
+  8017ba:	7e 28                	jle    8017e4 <openfile_lookup+0x71>
+  8017bc:	45 89 e4             	mov    %r12d,%r12d
+  8017bf:	49 c1 e4 05          	shl    $0x5,%r12
+  8017c3:	48 b8 80 70 80 00 00 	movabs $0x807080,%rax
+  8017ca:	00 00 00 
+  8017cd:	46 39 2c 20          	cmp    %r13d,(%rax,%r12,1)
+  8017d1:	75 18                	jne    8017eb <openfile_lookup+0x78>
+    *po = o;
+  8017d3:	49 89 1e             	mov    %rbx,(%r14)
+    return 0;
+  8017d6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8017db:	5b                   	pop    %rbx
+  8017dc:	41 5c                	pop    %r12
+  8017de:	41 5d                	pop    %r13
+  8017e0:	41 5e                	pop    %r14
+  8017e2:	5d                   	pop    %rbp
+  8017e3:	c3                   	ret
+        return -E_INVAL;
+  8017e4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8017e9:	eb f0                	jmp    8017db <openfile_lookup+0x68>
+  8017eb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8017f0:	eb e9                	jmp    8017db <openfile_lookup+0x68>
+
+00000000008017f2 <serve_set_size>:
+serve_set_size(envid_t envid, union Fsipc *ipc) {
+  8017f2:	55                   	push   %rbp
+  8017f3:	48 89 e5             	mov    %rsp,%rbp
+  8017f6:	53                   	push   %rbx
+  8017f7:	48 83 ec 18          	sub    $0x18,%rsp
+  8017fb:	48 89 f3             	mov    %rsi,%rbx
+    if ((r = openfile_lookup(envid, req->req_fileid, &o)) < 0)
+  8017fe:	8b 36                	mov    (%rsi),%esi
+  801800:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  801804:	48 b8 73 17 80 00 00 	movabs $0x801773,%rax
+  80180b:	00 00 00 
+  80180e:	ff d0                	call   *%rax
+  801810:	85 c0                	test   %eax,%eax
+  801812:	78 17                	js     80182b <serve_set_size+0x39>
+    return file_set_size(o->o_file, req->req_size);
+  801814:	8b 73 04             	mov    0x4(%rbx),%esi
+  801817:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80181b:	48 8b 78 08          	mov    0x8(%rax),%rdi
+  80181f:	48 b8 74 11 80 00 00 	movabs $0x801174,%rax
+  801826:	00 00 00 
+  801829:	ff d0                	call   *%rax
+}
+  80182b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80182f:	c9                   	leave
+  801830:	c3                   	ret
+
+0000000000801831 <serve_read>:
+serve_read(envid_t envid, union Fsipc *ipc) {
+  801831:	55                   	push   %rbp
+  801832:	48 89 e5             	mov    %rsp,%rbp
+  801835:	41 54                	push   %r12
+  801837:	53                   	push   %rbx
+  801838:	48 83 ec 10          	sub    $0x10,%rsp
+  80183c:	48 89 f3             	mov    %rsi,%rbx
+    struct OpenFile *openfile = NULL;
+  80183f:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  801846:	00 
+    int res = openfile_lookup(envid, req->req_fileid, &openfile);
+  801847:	8b 36                	mov    (%rsi),%esi
+  801849:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  80184d:	48 b8 73 17 80 00 00 	movabs $0x801773,%rax
+  801854:	00 00 00 
+  801857:	ff d0                	call   *%rax
+    if (res < 0)
+  801859:	85 c0                	test   %eax,%eax
+  80185b:	78 43                	js     8018a0 <serve_read+0x6f>
+    if (req->req_n > sizeof(ipc->readRet.ret_buf))
+  80185d:	48 81 7b 08 00 10 00 	cmpq   $0x1000,0x8(%rbx)
+  801864:	00 
+  801865:	76 08                	jbe    80186f <serve_read+0x3e>
+        req->req_n = sizeof(ipc->readRet.ret_buf);
+  801867:	48 c7 43 08 00 10 00 	movq   $0x1000,0x8(%rbx)
+  80186e:	00 
+                                  openfile->o_fd->fd_offset
+  80186f:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+    ssize_t read_bytes = file_read(
+  801873:	49 8b 44 24 18       	mov    0x18(%r12),%rax
+  801878:	8b 48 04             	mov    0x4(%rax),%ecx
+  80187b:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  80187f:	49 8b 7c 24 08       	mov    0x8(%r12),%rdi
+  801884:	48 89 de             	mov    %rbx,%rsi
+  801887:	48 b8 9b 10 80 00 00 	movabs $0x80109b,%rax
+  80188e:	00 00 00 
+  801891:	ff d0                	call   *%rax
+    if (read_bytes < 0)
+  801893:	48 85 c0             	test   %rax,%rax
+  801896:	78 08                	js     8018a0 <serve_read+0x6f>
+    openfile->o_fd->fd_offset += read_bytes;
+  801898:	49 8b 54 24 18       	mov    0x18(%r12),%rdx
+  80189d:	01 42 04             	add    %eax,0x4(%rdx)
+}
+  8018a0:	48 83 c4 10          	add    $0x10,%rsp
+  8018a4:	5b                   	pop    %rbx
+  8018a5:	41 5c                	pop    %r12
+  8018a7:	5d                   	pop    %rbp
+  8018a8:	c3                   	ret
+
+00000000008018a9 <serve_write>:
+serve_write(envid_t envid, union Fsipc *ipc) {
+  8018a9:	55                   	push   %rbp
+  8018aa:	48 89 e5             	mov    %rsp,%rbp
+  8018ad:	41 54                	push   %r12
+  8018af:	53                   	push   %rbx
+  8018b0:	48 83 ec 10          	sub    $0x10,%rsp
+  8018b4:	48 89 f3             	mov    %rsi,%rbx
+    struct OpenFile *openfile = NULL;
+  8018b7:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  8018be:	00 
+    int res = openfile_lookup(envid, req->req_fileid, &openfile);
+  8018bf:	8b 36                	mov    (%rsi),%esi
+  8018c1:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  8018c5:	48 b8 73 17 80 00 00 	movabs $0x801773,%rax
+  8018cc:	00 00 00 
+  8018cf:	ff d0                	call   *%rax
+    if (res < 0)
+  8018d1:	85 c0                	test   %eax,%eax
+  8018d3:	78 3b                	js     801910 <serve_write+0x67>
+    if (req->req_n > sizeof(req->req_buf))
+  8018d5:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  8018d9:	48 81 fa f0 0f 00 00 	cmp    $0xff0,%rdx
+  8018e0:	77 37                	ja     801919 <serve_write+0x70>
+                                      openfile->o_fd->fd_offset
+  8018e2:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+    ssize_t written_bytes = file_write(
+  8018e6:	49 8b 44 24 18       	mov    0x18(%r12),%rax
+  8018eb:	8b 48 04             	mov    0x4(%rax),%ecx
+                                      &req->req_buf,
+  8018ee:	48 8d 73 10          	lea    0x10(%rbx),%rsi
+    ssize_t written_bytes = file_write(
+  8018f2:	49 8b 7c 24 08       	mov    0x8(%r12),%rdi
+  8018f7:	48 b8 81 12 80 00 00 	movabs $0x801281,%rax
+  8018fe:	00 00 00 
+  801901:	ff d0                	call   *%rax
+    if (written_bytes < 0)
+  801903:	48 85 c0             	test   %rax,%rax
+  801906:	78 08                	js     801910 <serve_write+0x67>
+    openfile->o_fd->fd_offset += written_bytes;
+  801908:	49 8b 54 24 18       	mov    0x18(%r12),%rdx
+  80190d:	01 42 04             	add    %eax,0x4(%rdx)
+}
+  801910:	48 83 c4 10          	add    $0x10,%rsp
+  801914:	5b                   	pop    %rbx
+  801915:	41 5c                	pop    %r12
+  801917:	5d                   	pop    %rbp
+  801918:	c3                   	ret
+        return -E_INVAL;
+  801919:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80191e:	eb f0                	jmp    801910 <serve_write+0x67>
+
+0000000000801920 <serve_stat>:
+serve_stat(envid_t envid, union Fsipc *ipc) {
+  801920:	55                   	push   %rbp
+  801921:	48 89 e5             	mov    %rsp,%rbp
+  801924:	41 54                	push   %r12
+  801926:	53                   	push   %rbx
+  801927:	48 83 ec 10          	sub    $0x10,%rsp
+  80192b:	48 89 f3             	mov    %rsi,%rbx
+    int res = openfile_lookup(envid, req->req_fileid, &o);
+  80192e:	8b 36                	mov    (%rsi),%esi
+  801930:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  801934:	48 b8 73 17 80 00 00 	movabs $0x801773,%rax
+  80193b:	00 00 00 
+  80193e:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801940:	85 c0                	test   %eax,%eax
+  801942:	78 46                	js     80198a <serve_stat+0x6a>
+    strcpy(ret->ret_name, o->o_file->f_name);
+  801944:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801948:	49 8b 74 24 08       	mov    0x8(%r12),%rsi
+  80194d:	48 89 df             	mov    %rbx,%rdi
+  801950:	48 b8 f2 30 80 00 00 	movabs $0x8030f2,%rax
+  801957:	00 00 00 
+  80195a:	ff d0                	call   *%rax
+    ret->ret_size = o->o_file->f_size;
+  80195c:	49 8b 44 24 08       	mov    0x8(%r12),%rax
+  801961:	8b 80 80 00 00 00    	mov    0x80(%rax),%eax
+  801967:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    ret->ret_isdir = (o->o_file->f_type == FTYPE_DIR);
+  80196d:	49 8b 44 24 08       	mov    0x8(%r12),%rax
+  801972:	83 b8 84 00 00 00 01 	cmpl   $0x1,0x84(%rax)
+  801979:	0f 94 c0             	sete   %al
+  80197c:	0f b6 c0             	movzbl %al,%eax
+  80197f:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  801985:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80198a:	48 83 c4 10          	add    $0x10,%rsp
+  80198e:	5b                   	pop    %rbx
+  80198f:	41 5c                	pop    %r12
+  801991:	5d                   	pop    %rbp
+  801992:	c3                   	ret
+
+0000000000801993 <serve_flush>:
+serve_flush(envid_t envid, union Fsipc *ipc) {
+  801993:	55                   	push   %rbp
+  801994:	48 89 e5             	mov    %rsp,%rbp
+  801997:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = openfile_lookup(envid, req->req_fileid, &o);
+  80199b:	8b 36                	mov    (%rsi),%esi
+  80199d:	48 8d 55 f8          	lea    -0x8(%rbp),%rdx
+  8019a1:	48 b8 73 17 80 00 00 	movabs $0x801773,%rax
+  8019a8:	00 00 00 
+  8019ab:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8019ad:	85 c0                	test   %eax,%eax
+  8019af:	78 19                	js     8019ca <serve_flush+0x37>
+    file_flush(o->o_file);
+  8019b1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8019b5:	48 8b 78 08          	mov    0x8(%rax),%rdi
+  8019b9:	48 b8 72 13 80 00 00 	movabs $0x801372,%rax
+  8019c0:	00 00 00 
+  8019c3:	ff d0                	call   *%rax
+    return 0;
+  8019c5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8019ca:	c9                   	leave
+  8019cb:	c3                   	ret
+
+00000000008019cc <serve_open>:
+           void **pg_store, int *perm_store) {
+  8019cc:	55                   	push   %rbp
+  8019cd:	48 89 e5             	mov    %rsp,%rbp
+  8019d0:	41 55                	push   %r13
+  8019d2:	41 54                	push   %r12
+  8019d4:	53                   	push   %rbx
+  8019d5:	48 81 ec 18 04 00 00 	sub    $0x418,%rsp
+  8019dc:	48 89 f3             	mov    %rsi,%rbx
+  8019df:	49 89 d5             	mov    %rdx,%r13
+  8019e2:	49 89 cc             	mov    %rcx,%r12
+    memmove(path, req->req_path, MAXPATHLEN);
+  8019e5:	ba 00 04 00 00       	mov    $0x400,%edx
+  8019ea:	48 8d bd e0 fb ff ff 	lea    -0x420(%rbp),%rdi
+  8019f1:	48 b8 ec 32 80 00 00 	movabs $0x8032ec,%rax
+  8019f8:	00 00 00 
+  8019fb:	ff d0                	call   *%rax
+    path[MAXPATHLEN - 1] = 0;
+  8019fd:	c6 45 df 00          	movb   $0x0,-0x21(%rbp)
+    if ((res = openfile_alloc(&o)) < 0) {
+  801a01:	48 8d bd d0 fb ff ff 	lea    -0x430(%rbp),%rdi
+  801a08:	48 b8 a6 16 80 00 00 	movabs $0x8016a6,%rax
+  801a0f:	00 00 00 
+  801a12:	ff d0                	call   *%rax
+  801a14:	85 c0                	test   %eax,%eax
+  801a16:	0f 88 fa 00 00 00    	js     801b16 <serve_open+0x14a>
+    if (req->req_omode & O_CREAT) {
+  801a1c:	f6 83 01 04 00 00 01 	testb  $0x1,0x401(%rbx)
+  801a23:	74 34                	je     801a59 <serve_open+0x8d>
+        if ((res = file_create(path, &f)) < 0) {
+  801a25:	48 8d b5 d8 fb ff ff 	lea    -0x428(%rbp),%rsi
+  801a2c:	48 8d bd e0 fb ff ff 	lea    -0x420(%rbp),%rdi
+  801a33:	48 b8 4f 14 80 00 00 	movabs $0x80144f,%rax
+  801a3a:	00 00 00 
+  801a3d:	ff d0                	call   *%rax
+  801a3f:	85 c0                	test   %eax,%eax
+  801a41:	79 38                	jns    801a7b <serve_open+0xaf>
+            if (!(req->req_omode & O_EXCL) && res == -E_FILE_EXISTS)
+  801a43:	f6 83 01 04 00 00 04 	testb  $0x4,0x401(%rbx)
+  801a4a:	0f 85 c6 00 00 00    	jne    801b16 <serve_open+0x14a>
+  801a50:	83 f8 ef             	cmp    $0xffffffef,%eax
+  801a53:	0f 85 bd 00 00 00    	jne    801b16 <serve_open+0x14a>
+        if ((res = file_open(path, &f)) < 0) {
+  801a59:	48 8d b5 d8 fb ff ff 	lea    -0x428(%rbp),%rsi
+  801a60:	48 8d bd e0 fb ff ff 	lea    -0x420(%rbp),%rdi
+  801a67:	48 b8 7c 10 80 00 00 	movabs $0x80107c,%rax
+  801a6e:	00 00 00 
+  801a71:	ff d0                	call   *%rax
+  801a73:	85 c0                	test   %eax,%eax
+  801a75:	0f 88 9b 00 00 00    	js     801b16 <serve_open+0x14a>
+    if (req->req_omode & O_TRUNC) {
+  801a7b:	f6 83 01 04 00 00 02 	testb  $0x2,0x401(%rbx)
+  801a82:	74 1c                	je     801aa0 <serve_open+0xd4>
+        if ((res = file_set_size(f, 0)) < 0) {
+  801a84:	be 00 00 00 00       	mov    $0x0,%esi
+  801a89:	48 8b bd d8 fb ff ff 	mov    -0x428(%rbp),%rdi
+  801a90:	48 b8 74 11 80 00 00 	movabs $0x801174,%rax
+  801a97:	00 00 00 
+  801a9a:	ff d0                	call   *%rax
+  801a9c:	85 c0                	test   %eax,%eax
+  801a9e:	78 76                	js     801b16 <serve_open+0x14a>
+    if ((res = file_open(path, &f)) < 0) {
+  801aa0:	48 8d b5 d8 fb ff ff 	lea    -0x428(%rbp),%rsi
+  801aa7:	48 8d bd e0 fb ff ff 	lea    -0x420(%rbp),%rdi
+  801aae:	48 b8 7c 10 80 00 00 	movabs $0x80107c,%rax
+  801ab5:	00 00 00 
+  801ab8:	ff d0                	call   *%rax
+  801aba:	85 c0                	test   %eax,%eax
+  801abc:	78 58                	js     801b16 <serve_open+0x14a>
+    o->o_file = f;
+  801abe:	48 8b 95 d0 fb ff ff 	mov    -0x430(%rbp),%rdx
+  801ac5:	48 8b 85 d8 fb ff ff 	mov    -0x428(%rbp),%rax
+  801acc:	48 89 42 08          	mov    %rax,0x8(%rdx)
+    o->o_fd->fd_file.id = o->o_fileid;
+  801ad0:	48 8b 42 18          	mov    0x18(%rdx),%rax
+  801ad4:	8b 0a                	mov    (%rdx),%ecx
+  801ad6:	89 48 0c             	mov    %ecx,0xc(%rax)
+    o->o_fd->fd_omode = req->req_omode & O_ACCMODE;
+  801ad9:	48 8b 4a 18          	mov    0x18(%rdx),%rcx
+  801add:	8b 83 00 04 00 00    	mov    0x400(%rbx),%eax
+  801ae3:	83 e0 03             	and    $0x3,%eax
+  801ae6:	89 41 08             	mov    %eax,0x8(%rcx)
+    o->o_fd->fd_dev_id = devfile.dev_id;
+  801ae9:	48 8b 4a 18          	mov    0x18(%rdx),%rcx
+  801aed:	a1 a0 b0 80 00 00 00 	movabs 0x80b0a0,%eax
+  801af4:	00 00 
+  801af6:	89 01                	mov    %eax,(%rcx)
+    o->o_mode = req->req_omode;
+  801af8:	8b 83 00 04 00 00    	mov    0x400(%rbx),%eax
+  801afe:	89 42 10             	mov    %eax,0x10(%rdx)
+    *pg_store = o->o_fd;
+  801b01:	48 8b 42 18          	mov    0x18(%rdx),%rax
+  801b05:	49 89 45 00          	mov    %rax,0x0(%r13)
+    *perm_store = PROT_RW | PROT_SHARE;
+  801b09:	41 c7 04 24 46 00 00 	movl   $0x46,(%r12)
+  801b10:	00 
+    return 0;
+  801b11:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801b16:	48 81 c4 18 04 00 00 	add    $0x418,%rsp
+  801b1d:	5b                   	pop    %rbx
+  801b1e:	41 5c                	pop    %r12
+  801b20:	41 5d                	pop    %r13
+  801b22:	5d                   	pop    %rbp
+  801b23:	c3                   	ret
+
+0000000000801b24 <serve>:
+        [FSREQ_SET_SIZE] = serve_set_size,
+        [FSREQ_SYNC] = serve_sync};
+#define NHANDLERS (sizeof(handlers) / sizeof(handlers[0]))
+
+void
+serve(void) {
+  801b24:	55                   	push   %rbp
+  801b25:	48 89 e5             	mov    %rsp,%rbp
+  801b28:	41 56                	push   %r14
+  801b2a:	41 55                	push   %r13
+  801b2c:	41 54                	push   %r12
+  801b2e:	53                   	push   %rbx
+  801b2f:	48 83 ec 20          	sub    $0x20,%rsp
+    void *pg;
+
+    while (1) {
+        perm = 0;
+        size_t sz = PAGE_SIZE;
+        req = ipc_recv((int32_t *)&whom, fsreq, &sz, &perm);
+  801b33:	48 bb 68 70 80 00 00 	movabs $0x807068,%rbx
+  801b3a:	00 00 00 
+  801b3d:	49 bc bc 3d 80 00 00 	movabs $0x803dbc,%r12
+  801b44:	00 00 00 
+            res = handlers[req](whom, fsreq);
+        } else {
+            cprintf("Invalid request code %d from %08x\n", req, whom);
+            res = -E_INVAL;
+        }
+        ipc_send(whom, res, pg, PAGE_SIZE, perm);
+  801b47:	49 be 91 3e 80 00 00 	movabs $0x803e91,%r14
+  801b4e:	00 00 00 
+        sys_unmap_region(0, fsreq, PAGE_SIZE);
+  801b51:	49 bd 6e 37 80 00 00 	movabs $0x80376e,%r13
+  801b58:	00 00 00 
+  801b5b:	eb 1e                	jmp    801b7b <serve+0x57>
+            cprintf("Invalid request from %08x: no argument page\n", whom);
+  801b5d:	8b 75 dc             	mov    -0x24(%rbp),%esi
+  801b60:	48 bf 78 57 80 00 00 	movabs $0x805778,%rdi
+  801b67:	00 00 00 
+  801b6a:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b6f:	48 ba cd 27 80 00 00 	movabs $0x8027cd,%rdx
+  801b76:	00 00 00 
+  801b79:	ff d2                	call   *%rdx
+        perm = 0;
+  801b7b:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%rbp)
+        size_t sz = PAGE_SIZE;
+  801b82:	48 c7 45 c8 00 10 00 	movq   $0x1000,-0x38(%rbp)
+  801b89:	00 
+        req = ipc_recv((int32_t *)&whom, fsreq, &sz, &perm);
+  801b8a:	48 8b 33             	mov    (%rbx),%rsi
+  801b8d:	48 8d 4d d8          	lea    -0x28(%rbp),%rcx
+  801b91:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  801b95:	48 8d 7d dc          	lea    -0x24(%rbp),%rdi
+  801b99:	41 ff d4             	call   *%r12
+  801b9c:	89 c6                	mov    %eax,%esi
+        if (!(perm & PROT_R)) {
+  801b9e:	f6 45 d8 04          	testb  $0x4,-0x28(%rbp)
+  801ba2:	74 b9                	je     801b5d <serve+0x39>
+        pg = NULL;
+  801ba4:	48 c7 45 d0 00 00 00 	movq   $0x0,-0x30(%rbp)
+  801bab:	00 
+        if (req == FSREQ_OPEN) {
+  801bac:	83 f8 01             	cmp    $0x1,%eax
+  801baf:	74 26                	je     801bd7 <serve+0xb3>
+        } else if (req < NHANDLERS && handlers[req]) {
+  801bb1:	83 f8 08             	cmp    $0x8,%eax
+  801bb4:	77 3f                	ja     801bf5 <serve+0xd1>
+  801bb6:	89 c0                	mov    %eax,%eax
+  801bb8:	48 ba 20 70 80 00 00 	movabs $0x807020,%rdx
+  801bbf:	00 00 00 
+  801bc2:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  801bc6:	48 85 c0             	test   %rax,%rax
+  801bc9:	74 2a                	je     801bf5 <serve+0xd1>
+            res = handlers[req](whom, fsreq);
+  801bcb:	48 8b 33             	mov    (%rbx),%rsi
+  801bce:	8b 7d dc             	mov    -0x24(%rbp),%edi
+  801bd1:	ff d0                	call   *%rax
+  801bd3:	89 c6                	mov    %eax,%esi
+  801bd5:	eb 41                	jmp    801c18 <serve+0xf4>
+            res = serve_open(whom, (struct Fsreq_open *)fsreq, &pg, &perm);
+  801bd7:	48 8b 33             	mov    (%rbx),%rsi
+  801bda:	48 8d 4d d8          	lea    -0x28(%rbp),%rcx
+  801bde:	48 8d 55 d0          	lea    -0x30(%rbp),%rdx
+  801be2:	8b 7d dc             	mov    -0x24(%rbp),%edi
+  801be5:	48 b8 cc 19 80 00 00 	movabs $0x8019cc,%rax
+  801bec:	00 00 00 
+  801bef:	ff d0                	call   *%rax
+  801bf1:	89 c6                	mov    %eax,%esi
+  801bf3:	eb 23                	jmp    801c18 <serve+0xf4>
+            cprintf("Invalid request code %d from %08x\n", req, whom);
+  801bf5:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  801bf8:	48 bf a8 57 80 00 00 	movabs $0x8057a8,%rdi
+  801bff:	00 00 00 
+  801c02:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c07:	48 b9 cd 27 80 00 00 	movabs $0x8027cd,%rcx
+  801c0e:	00 00 00 
+  801c11:	ff d1                	call   *%rcx
+            res = -E_INVAL;
+  801c13:	be fd ff ff ff       	mov    $0xfffffffd,%esi
+        ipc_send(whom, res, pg, PAGE_SIZE, perm);
+  801c18:	44 8b 45 d8          	mov    -0x28(%rbp),%r8d
+  801c1c:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  801c21:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  801c25:	8b 7d dc             	mov    -0x24(%rbp),%edi
+  801c28:	41 ff d6             	call   *%r14
+        sys_unmap_region(0, fsreq, PAGE_SIZE);
+  801c2b:	48 8b 33             	mov    (%rbx),%rsi
+  801c2e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801c33:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c38:	41 ff d5             	call   *%r13
+  801c3b:	e9 3b ff ff ff       	jmp    801b7b <serve+0x57>
+
+0000000000801c40 <umain>:
+    }
+}
+
+void
+umain(int argc, char **argv) {
+  801c40:	55                   	push   %rbp
+  801c41:	48 89 e5             	mov    %rsp,%rbp
+  801c44:	53                   	push   %rbx
+  801c45:	48 83 ec 08          	sub    $0x8,%rsp
+    static_assert(sizeof(struct File) == 256, "Unsupported file size");
+    binaryname = "fs";
+  801c49:	48 b8 cb 57 80 00 00 	movabs $0x8057cb,%rax
+  801c50:	00 00 00 
+  801c53:	48 a3 80 b0 80 00 00 	movabs %rax,0x80b080
+  801c5a:	00 00 00 
+    cprintf("FS is running\n");
+  801c5d:	48 bf ce 57 80 00 00 	movabs $0x8057ce,%rdi
+  801c64:	00 00 00 
+  801c67:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c6c:	48 bb cd 27 80 00 00 	movabs $0x8027cd,%rbx
+  801c73:	00 00 00 
+  801c76:	ff d3                	call   *%rbx
+    asm volatile("outw %0,%w1" ::"a"(data), "d"(port));
+  801c78:	b8 00 8a ff ff       	mov    $0xffff8a00,%eax
+  801c7d:	ba 00 8a 00 00       	mov    $0x8a00,%edx
+  801c82:	66 ef                	out    %ax,(%dx)
+
+    /* Check that we are able to do I/O */
+    outw(0x8A00, 0x8A00);
+    cprintf("FS can do I/O\n");
+  801c84:	48 bf dd 57 80 00 00 	movabs $0x8057dd,%rdi
+  801c8b:	00 00 00 
+  801c8e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c93:	ff d3                	call   *%rbx
+
+    serve_init();
+  801c95:	48 b8 69 16 80 00 00 	movabs $0x801669,%rax
+  801c9c:	00 00 00 
+  801c9f:	ff d0                	call   *%rax
+    fs_init();
+  801ca1:	48 b8 fe 0b 80 00 00 	movabs $0x800bfe,%rax
+  801ca8:	00 00 00 
+  801cab:	ff d0                	call   *%rax
+    fs_test();
+  801cad:	48 b8 86 1e 80 00 00 	movabs $0x801e86,%rax
+  801cb4:	00 00 00 
+  801cb7:	ff d0                	call   *%rax
+    serve();
+  801cb9:	48 b8 24 1b 80 00 00 	movabs $0x801b24,%rax
+  801cc0:	00 00 00 
+  801cc3:	ff d0                	call   *%rax
+
+0000000000801cc5 <check_dir>:
+void
+check_dir(struct File *dir) {
+    uint32_t *blk;
+    struct File *files;
+
+    blockno_t nblock = dir->f_size / BLKSIZE;
+  801cc5:	8b 8f 80 00 00 00    	mov    0x80(%rdi),%ecx
+  801ccb:	8d 81 ff 0f 00 00    	lea    0xfff(%rcx),%eax
+  801cd1:	85 c9                	test   %ecx,%ecx
+  801cd3:	0f 49 c1             	cmovns %ecx,%eax
+    for (blockno_t i = 0; i < nblock; ++i) {
+  801cd6:	c1 f8 0c             	sar    $0xc,%eax
+  801cd9:	0f 84 a6 01 00 00    	je     801e85 <check_dir+0x1c0>
+check_dir(struct File *dir) {
+  801cdf:	55                   	push   %rbp
+  801ce0:	48 89 e5             	mov    %rsp,%rbp
+  801ce3:	41 57                	push   %r15
+  801ce5:	41 56                	push   %r14
+  801ce7:	41 55                	push   %r13
+  801ce9:	41 54                	push   %r12
+  801ceb:	53                   	push   %rbx
+  801cec:	48 83 ec 28          	sub    $0x28,%rsp
+  801cf0:	41 89 c5             	mov    %eax,%r13d
+    for (blockno_t i = 0; i < nblock; ++i) {
+  801cf3:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+                        check_dir(f);
+                    }
+                    if (file_block_walk(f, k, &pdiskbno, 0) < 0 || pdiskbno == NULL || *pdiskbno == 0) {
+                        continue;
+                    }
+                    assert(!block_is_free(*pdiskbno));
+  801cf9:	49 89 fe             	mov    %rdi,%r14
+  801cfc:	e9 2d 01 00 00       	jmp    801e2e <check_dir+0x169>
+                        check_dir(f);
+  801d01:	4c 89 e7             	mov    %r12,%rdi
+  801d04:	48 b8 c5 1c 80 00 00 	movabs $0x801cc5,%rax
+  801d0b:	00 00 00 
+  801d0e:	ff d0                	call   *%rax
+  801d10:	eb 26                	jmp    801d38 <check_dir+0x73>
+                for (blockno_t k = 0; k < CEILDIV(f->f_size, BLKSIZE); ++k) {
+  801d12:	41 83 c6 01          	add    $0x1,%r14d
+  801d16:	49 63 84 24 80 00 00 	movslq 0x80(%r12),%rax
+  801d1d:	00 
+  801d1e:	48 05 ff 0f 00 00    	add    $0xfff,%rax
+  801d24:	48 c1 e8 0c          	shr    $0xc,%rax
+  801d28:	41 39 c6             	cmp    %eax,%r14d
+  801d2b:	73 7e                	jae    801dab <check_dir+0xe6>
+                    if (f->f_type == FTYPE_DIR) {
+  801d2d:	41 83 bc 24 84 00 00 	cmpl   $0x1,0x84(%r12)
+  801d34:	00 01 
+  801d36:	74 c9                	je     801d01 <check_dir+0x3c>
+                    if (file_block_walk(f, k, &pdiskbno, 0) < 0 || pdiskbno == NULL || *pdiskbno == 0) {
+  801d38:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801d3d:	48 8d 55 c0          	lea    -0x40(%rbp),%rdx
+  801d41:	44 89 f6             	mov    %r14d,%esi
+  801d44:	4c 89 e7             	mov    %r12,%rdi
+  801d47:	48 b8 91 0c 80 00 00 	movabs $0x800c91,%rax
+  801d4e:	00 00 00 
+  801d51:	ff d0                	call   *%rax
+  801d53:	85 c0                	test   %eax,%eax
+  801d55:	78 bb                	js     801d12 <check_dir+0x4d>
+  801d57:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  801d5b:	48 85 c0             	test   %rax,%rax
+  801d5e:	74 b2                	je     801d12 <check_dir+0x4d>
+  801d60:	8b 38                	mov    (%rax),%edi
+  801d62:	85 ff                	test   %edi,%edi
+  801d64:	74 ac                	je     801d12 <check_dir+0x4d>
+                    assert(!block_is_free(*pdiskbno));
+  801d66:	48 b8 75 09 80 00 00 	movabs $0x800975,%rax
+  801d6d:	00 00 00 
+  801d70:	ff d0                	call   *%rax
+  801d72:	84 c0                	test   %al,%al
+  801d74:	74 9c                	je     801d12 <check_dir+0x4d>
+  801d76:	48 b9 0a 58 80 00 00 	movabs $0x80580a,%rcx
+  801d7d:	00 00 00 
+  801d80:	48 ba 1d 55 80 00 00 	movabs $0x80551d,%rdx
+  801d87:	00 00 00 
+  801d8a:	be 28 00 00 00       	mov    $0x28,%esi
+  801d8f:	48 bf 24 58 80 00 00 	movabs $0x805824,%rdi
+  801d96:	00 00 00 
+  801d99:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d9e:	49 b8 7d 26 80 00 00 	movabs $0x80267d,%r8
+  801da5:	00 00 00 
+  801da8:	41 ff d0             	call   *%r8
+        for (blockno_t j = 0; j < BLKFILES; ++j) {
+  801dab:	48 81 c3 00 01 00 00 	add    $0x100,%rbx
+  801db2:	4c 39 fb             	cmp    %r15,%rbx
+  801db5:	74 66                	je     801e1d <check_dir+0x158>
+            struct File *f = &(files[j]);
+  801db7:	49 89 dc             	mov    %rbx,%r12
+            if (strcmp(f->f_name, "\0") != 0) {
+  801dba:	48 be ec 57 80 00 00 	movabs $0x8057ec,%rsi
+  801dc1:	00 00 00 
+  801dc4:	48 89 df             	mov    %rbx,%rdi
+  801dc7:	48 b8 96 31 80 00 00 	movabs $0x803196,%rax
+  801dce:	00 00 00 
+  801dd1:	ff d0                	call   *%rax
+  801dd3:	85 c0                	test   %eax,%eax
+  801dd5:	74 d4                	je     801dab <check_dir+0xe6>
+                blockno_t *pdiskbno = NULL;
+  801dd7:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  801dde:	00 
+                cprintf("checking consistency of %s\n", f->f_name);
+  801ddf:	48 89 de             	mov    %rbx,%rsi
+  801de2:	48 bf ee 57 80 00 00 	movabs $0x8057ee,%rdi
+  801de9:	00 00 00 
+  801dec:	b8 00 00 00 00       	mov    $0x0,%eax
+  801df1:	48 ba cd 27 80 00 00 	movabs $0x8027cd,%rdx
+  801df8:	00 00 00 
+  801dfb:	ff d2                	call   *%rdx
+                for (blockno_t k = 0; k < CEILDIV(f->f_size, BLKSIZE); ++k) {
+  801dfd:	48 63 83 80 00 00 00 	movslq 0x80(%rbx),%rax
+  801e04:	48 05 ff 0f 00 00    	add    $0xfff,%rax
+  801e0a:	48 c1 e8 0c          	shr    $0xc,%rax
+  801e0e:	85 c0                	test   %eax,%eax
+  801e10:	74 99                	je     801dab <check_dir+0xe6>
+  801e12:	41 be 00 00 00 00    	mov    $0x0,%r14d
+  801e18:	e9 10 ff ff ff       	jmp    801d2d <check_dir+0x68>
+  801e1d:	44 8b 65 bc          	mov    -0x44(%rbp),%r12d
+  801e21:	4c 8b 75 b0          	mov    -0x50(%rbp),%r14
+    for (blockno_t i = 0; i < nblock; ++i) {
+  801e25:	41 83 c4 01          	add    $0x1,%r12d
+  801e29:	45 39 e5             	cmp    %r12d,%r13d
+  801e2c:	74 48                	je     801e76 <check_dir+0x1b1>
+        if (file_block_walk(dir, i, &blk, 0) < 0) continue;
+  801e2e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801e33:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  801e37:	44 89 e6             	mov    %r12d,%esi
+  801e3a:	4c 89 f7             	mov    %r14,%rdi
+  801e3d:	48 b8 91 0c 80 00 00 	movabs $0x800c91,%rax
+  801e44:	00 00 00 
+  801e47:	ff d0                	call   *%rax
+  801e49:	85 c0                	test   %eax,%eax
+  801e4b:	78 d8                	js     801e25 <check_dir+0x160>
+        files = (struct File *)diskaddr(*blk);
+  801e4d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801e51:	8b 38                	mov    (%rax),%edi
+  801e53:	48 b8 17 04 80 00 00 	movabs $0x800417,%rax
+  801e5a:	00 00 00 
+  801e5d:	ff d0                	call   *%rax
+  801e5f:	48 89 c3             	mov    %rax,%rbx
+        for (blockno_t j = 0; j < BLKFILES; ++j) {
+  801e62:	4c 8d b8 00 10 00 00 	lea    0x1000(%rax),%r15
+            if (strcmp(f->f_name, "\0") != 0) {
+  801e69:	44 89 65 bc          	mov    %r12d,-0x44(%rbp)
+  801e6d:	4c 89 75 b0          	mov    %r14,-0x50(%rbp)
+  801e71:	e9 41 ff ff ff       	jmp    801db7 <check_dir+0xf2>
+                }
+            }
+        }
+    }
+}
+  801e76:	48 83 c4 28          	add    $0x28,%rsp
+  801e7a:	5b                   	pop    %rbx
+  801e7b:	41 5c                	pop    %r12
+  801e7d:	41 5d                	pop    %r13
+  801e7f:	41 5e                	pop    %r14
+  801e81:	41 5f                	pop    %r15
+  801e83:	5d                   	pop    %rbp
+  801e84:	c3                   	ret
+  801e85:	c3                   	ret
+
+0000000000801e86 <fs_test>:
+
+void
+fs_test(void) {
+  801e86:	55                   	push   %rbp
+  801e87:	48 89 e5             	mov    %rsp,%rbp
+  801e8a:	53                   	push   %rbx
+  801e8b:	48 83 ec 18          	sub    $0x18,%rsp
+    int r;
+    char *blk;
+    uint32_t *bits;
+
+    /* Back up bitmap */
+    if ((r = sys_alloc_region(0, (void *)PAGE_SIZE, PAGE_SIZE, PROT_RW)) < 0)
+  801e8f:	b9 06 00 00 00       	mov    $0x6,%ecx
+  801e94:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801e99:	be 00 10 00 00       	mov    $0x1000,%esi
+  801e9e:	bf 00 00 00 00       	mov    $0x0,%edi
+  801ea3:	48 b8 a2 36 80 00 00 	movabs $0x8036a2,%rax
+  801eaa:	00 00 00 
+  801ead:	ff d0                	call   *%rax
+  801eaf:	85 c0                	test   %eax,%eax
+  801eb1:	0f 88 34 03 00 00    	js     8021eb <fs_test+0x365>
+        panic("sys_page_alloc: %i", r);
+    bits = (uint32_t *)PAGE_SIZE;
+    memmove(bits, bitmap, PAGE_SIZE);
+  801eb7:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801ebc:	48 b8 00 c0 80 00 00 	movabs $0x80c000,%rax
+  801ec3:	00 00 00 
+  801ec6:	48 8b 30             	mov    (%rax),%rsi
+  801ec9:	bf 00 10 00 00       	mov    $0x1000,%edi
+  801ece:	48 b8 ec 32 80 00 00 	movabs $0x8032ec,%rax
+  801ed5:	00 00 00 
+  801ed8:	ff d0                	call   *%rax
+    /* Allocate block */
+    if (!(r = alloc_block()))
+  801eda:	48 b8 08 0a 80 00 00 	movabs $0x800a08,%rax
+  801ee1:	00 00 00 
+  801ee4:	ff d0                	call   *%rax
+  801ee6:	89 c1                	mov    %eax,%ecx
+  801ee8:	85 c0                	test   %eax,%eax
+  801eea:	0f 84 28 03 00 00    	je     802218 <fs_test+0x392>
+        panic("alloc_block: %i", -E_NO_DISK);
+    /* Check that block was free */
+    assert(TSTBIT(bits, r));
+  801ef0:	8d 50 1f             	lea    0x1f(%rax),%edx
+  801ef3:	0f 49 d0             	cmovns %eax,%edx
+  801ef6:	c1 fa 05             	sar    $0x5,%edx
+  801ef9:	48 63 d2             	movslq %edx,%rdx
+  801efc:	b8 01 00 00 00       	mov    $0x1,%eax
+  801f01:	d3 e0                	shl    %cl,%eax
+  801f03:	89 c1                	mov    %eax,%ecx
+  801f05:	23 04 95 00 10 00 00 	and    0x1000(,%rdx,4),%eax
+  801f0c:	0f 84 36 03 00 00    	je     802248 <fs_test+0x3c2>
+    /* And is not free any more */
+    assert(!TSTBIT(bitmap, r));
+  801f12:	48 a1 00 c0 80 00 00 	movabs 0x80c000,%rax
+  801f19:	00 00 00 
+  801f1c:	23 0c 90             	and    (%rax,%rdx,4),%ecx
+  801f1f:	0f 85 53 03 00 00    	jne    802278 <fs_test+0x3f2>
+    cprintf("alloc_block is good\n");
+  801f25:	48 bf 74 58 80 00 00 	movabs $0x805874,%rdi
+  801f2c:	00 00 00 
+  801f2f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f34:	48 bb cd 27 80 00 00 	movabs $0x8027cd,%rbx
+  801f3b:	00 00 00 
+  801f3e:	ff d3                	call   *%rbx
+    check_dir(&super->s_root);
+  801f40:	48 a1 08 c0 80 00 00 	movabs 0x80c008,%rax
+  801f47:	00 00 00 
+  801f4a:	48 8d 78 08          	lea    0x8(%rax),%rdi
+  801f4e:	48 b8 c5 1c 80 00 00 	movabs $0x801cc5,%rax
+  801f55:	00 00 00 
+  801f58:	ff d0                	call   *%rax
+    check_consistency();
+    cprintf("fs consistency is good\n");
+  801f5a:	48 bf 89 58 80 00 00 	movabs $0x805889,%rdi
+  801f61:	00 00 00 
+  801f64:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f69:	ff d3                	call   *%rbx
+
+    if ((r = file_open("/not-found", &f)) < 0 && r != -E_NOT_FOUND)
+  801f6b:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801f6f:	48 bf a1 58 80 00 00 	movabs $0x8058a1,%rdi
+  801f76:	00 00 00 
+  801f79:	48 b8 7c 10 80 00 00 	movabs $0x80107c,%rax
+  801f80:	00 00 00 
+  801f83:	ff d0                	call   *%rax
+  801f85:	85 c0                	test   %eax,%eax
+  801f87:	0f 88 20 03 00 00    	js     8022ad <fs_test+0x427>
+        panic("file_open /not-found: %i", r);
+    else if (r == 0)
+  801f8d:	0f 84 50 03 00 00    	je     8022e3 <fs_test+0x45d>
+        panic("file_open /not-found succeeded!");
+    if ((r = file_open("/newmotd", &f)) < 0)
+  801f93:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801f97:	48 bf c5 58 80 00 00 	movabs $0x8058c5,%rdi
+  801f9e:	00 00 00 
+  801fa1:	48 b8 7c 10 80 00 00 	movabs $0x80107c,%rax
+  801fa8:	00 00 00 
+  801fab:	ff d0                	call   *%rax
+  801fad:	85 c0                	test   %eax,%eax
+  801faf:	0f 88 53 03 00 00    	js     802308 <fs_test+0x482>
+        panic("file_open /newmotd: %i", r);
+    cprintf("file_open is good\n");
+  801fb5:	48 bf e5 58 80 00 00 	movabs $0x8058e5,%rdi
+  801fbc:	00 00 00 
+  801fbf:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fc4:	48 ba cd 27 80 00 00 	movabs $0x8027cd,%rdx
+  801fcb:	00 00 00 
+  801fce:	ff d2                	call   *%rdx
+
+    if ((r = file_get_block(f, 0, &blk)) < 0)
+  801fd0:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  801fd4:	be 00 00 00 00       	mov    $0x0,%esi
+  801fd9:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  801fdd:	48 b8 3a 0d 80 00 00 	movabs $0x800d3a,%rax
+  801fe4:	00 00 00 
+  801fe7:	ff d0                	call   *%rax
+  801fe9:	85 c0                	test   %eax,%eax
+  801feb:	0f 88 44 03 00 00    	js     802335 <fs_test+0x4af>
+        panic("file_get_block: %i", r);
+    if (strcmp(blk, msg) != 0)
+  801ff1:	48 be 00 5a 80 00 00 	movabs $0x805a00,%rsi
+  801ff8:	00 00 00 
+  801ffb:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+  801fff:	48 b8 96 31 80 00 00 	movabs $0x803196,%rax
+  802006:	00 00 00 
+  802009:	ff d0                	call   *%rax
+  80200b:	85 c0                	test   %eax,%eax
+  80200d:	0f 85 4f 03 00 00    	jne    802362 <fs_test+0x4dc>
+        panic("file_get_block returned wrong data");
+    cprintf("file_get_block is good\n");
+  802013:	48 bf 0b 59 80 00 00 	movabs $0x80590b,%rdi
+  80201a:	00 00 00 
+  80201d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802022:	48 ba cd 27 80 00 00 	movabs $0x8027cd,%rdx
+  802029:	00 00 00 
+  80202c:	ff d2                	call   *%rdx
+
+    *(volatile char *)blk = *(volatile char *)blk;
+  80202e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802032:	0f b6 10             	movzbl (%rax),%edx
+  802035:	88 10                	mov    %dl,(%rax)
+    assert(is_page_dirty(blk));
+  802037:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+  80203b:	48 b8 01 51 80 00 00 	movabs $0x805101,%rax
+  802042:	00 00 00 
+  802045:	ff d0                	call   *%rax
+  802047:	84 c0                	test   %al,%al
+  802049:	0f 84 3d 03 00 00    	je     80238c <fs_test+0x506>
+    file_flush(f);
+  80204f:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  802053:	48 b8 72 13 80 00 00 	movabs $0x801372,%rax
+  80205a:	00 00 00 
+  80205d:	ff d0                	call   *%rax
+    assert(!is_page_dirty(blk));
+  80205f:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+  802063:	48 b8 01 51 80 00 00 	movabs $0x805101,%rax
+  80206a:	00 00 00 
+  80206d:	ff d0                	call   *%rax
+  80206f:	84 c0                	test   %al,%al
+  802071:	0f 85 45 03 00 00    	jne    8023bc <fs_test+0x536>
+    cprintf("file_flush is good\n");
+  802077:	48 bf 37 59 80 00 00 	movabs $0x805937,%rdi
+  80207e:	00 00 00 
+  802081:	b8 00 00 00 00       	mov    $0x0,%eax
+  802086:	48 ba cd 27 80 00 00 	movabs $0x8027cd,%rdx
+  80208d:	00 00 00 
+  802090:	ff d2                	call   *%rdx
+
+    if ((r = file_set_size(f, 0)) < 0)
+  802092:	be 00 00 00 00       	mov    $0x0,%esi
+  802097:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  80209b:	48 b8 74 11 80 00 00 	movabs $0x801174,%rax
+  8020a2:	00 00 00 
+  8020a5:	ff d0                	call   *%rax
+  8020a7:	85 c0                	test   %eax,%eax
+  8020a9:	0f 88 42 03 00 00    	js     8023f1 <fs_test+0x56b>
+        panic("file_set_size: %i", r);
+    assert(f->f_direct[0] == 0);
+  8020af:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  8020b3:	83 bf 88 00 00 00 00 	cmpl   $0x0,0x88(%rdi)
+  8020ba:	0f 85 5e 03 00 00    	jne    80241e <fs_test+0x598>
+    assert(!is_page_dirty(f));
+  8020c0:	48 b8 01 51 80 00 00 	movabs $0x805101,%rax
+  8020c7:	00 00 00 
+  8020ca:	ff d0                	call   *%rax
+  8020cc:	84 c0                	test   %al,%al
+  8020ce:	0f 85 7f 03 00 00    	jne    802453 <fs_test+0x5cd>
+    cprintf("file_truncate is good\n");
+  8020d4:	48 bf 83 59 80 00 00 	movabs $0x805983,%rdi
+  8020db:	00 00 00 
+  8020de:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020e3:	48 ba cd 27 80 00 00 	movabs $0x8027cd,%rdx
+  8020ea:	00 00 00 
+  8020ed:	ff d2                	call   *%rdx
+
+    if ((r = file_set_size(f, strlen(msg))) < 0)
+  8020ef:	48 bf 00 5a 80 00 00 	movabs $0x805a00,%rdi
+  8020f6:	00 00 00 
+  8020f9:	48 b8 b4 30 80 00 00 	movabs $0x8030b4,%rax
+  802100:	00 00 00 
+  802103:	ff d0                	call   *%rax
+  802105:	89 c6                	mov    %eax,%esi
+  802107:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  80210b:	48 b8 74 11 80 00 00 	movabs $0x801174,%rax
+  802112:	00 00 00 
+  802115:	ff d0                	call   *%rax
+  802117:	85 c0                	test   %eax,%eax
+  802119:	0f 88 69 03 00 00    	js     802488 <fs_test+0x602>
+        panic("file_set_size 2: %i", r);
+    assert(!is_page_dirty(f));
+  80211f:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  802123:	48 b8 01 51 80 00 00 	movabs $0x805101,%rax
+  80212a:	00 00 00 
+  80212d:	ff d0                	call   *%rax
+  80212f:	84 c0                	test   %al,%al
+  802131:	0f 85 7e 03 00 00    	jne    8024b5 <fs_test+0x62f>
+    if ((r = file_get_block(f, 0, &blk)) < 0)
+  802137:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  80213b:	be 00 00 00 00       	mov    $0x0,%esi
+  802140:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  802144:	48 b8 3a 0d 80 00 00 	movabs $0x800d3a,%rax
+  80214b:	00 00 00 
+  80214e:	ff d0                	call   *%rax
+  802150:	85 c0                	test   %eax,%eax
+  802152:	0f 88 92 03 00 00    	js     8024ea <fs_test+0x664>
+        panic("file_get_block 2: %i", r);
+    strcpy(blk, msg);
+  802158:	48 be 00 5a 80 00 00 	movabs $0x805a00,%rsi
+  80215f:	00 00 00 
+  802162:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+  802166:	48 b8 f2 30 80 00 00 	movabs $0x8030f2,%rax
+  80216d:	00 00 00 
+  802170:	ff d0                	call   *%rax
+    assert(is_page_dirty(blk));
+  802172:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+  802176:	48 b8 01 51 80 00 00 	movabs $0x805101,%rax
+  80217d:	00 00 00 
+  802180:	ff d0                	call   *%rax
+  802182:	84 c0                	test   %al,%al
+  802184:	0f 84 8d 03 00 00    	je     802517 <fs_test+0x691>
+    file_flush(f);
+  80218a:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  80218e:	48 b8 72 13 80 00 00 	movabs $0x801372,%rax
+  802195:	00 00 00 
+  802198:	ff d0                	call   *%rax
+    assert(!is_page_dirty(blk));
+  80219a:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+  80219e:	48 b8 01 51 80 00 00 	movabs $0x805101,%rax
+  8021a5:	00 00 00 
+  8021a8:	ff d0                	call   *%rax
+  8021aa:	84 c0                	test   %al,%al
+  8021ac:	0f 85 95 03 00 00    	jne    802547 <fs_test+0x6c1>
+    assert(!is_page_dirty(f));
+  8021b2:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  8021b6:	48 b8 01 51 80 00 00 	movabs $0x805101,%rax
+  8021bd:	00 00 00 
+  8021c0:	ff d0                	call   *%rax
+  8021c2:	84 c0                	test   %al,%al
+  8021c4:	0f 85 b2 03 00 00    	jne    80257c <fs_test+0x6f6>
+    cprintf("file rewrite is good\n");
+  8021ca:	48 bf c3 59 80 00 00 	movabs $0x8059c3,%rdi
+  8021d1:	00 00 00 
+  8021d4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021d9:	48 ba cd 27 80 00 00 	movabs $0x8027cd,%rdx
+  8021e0:	00 00 00 
+  8021e3:	ff d2                	call   *%rdx
+}
+  8021e5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8021e9:	c9                   	leave
+  8021ea:	c3                   	ret
+        panic("sys_page_alloc: %i", r);
+  8021eb:	89 c1                	mov    %eax,%ecx
+  8021ed:	48 ba 2e 58 80 00 00 	movabs $0x80582e,%rdx
+  8021f4:	00 00 00 
+  8021f7:	be 38 00 00 00       	mov    $0x38,%esi
+  8021fc:	48 bf 24 58 80 00 00 	movabs $0x805824,%rdi
+  802203:	00 00 00 
+  802206:	b8 00 00 00 00       	mov    $0x0,%eax
+  80220b:	49 b8 7d 26 80 00 00 	movabs $0x80267d,%r8
+  802212:	00 00 00 
+  802215:	41 ff d0             	call   *%r8
+        panic("alloc_block: %i", -E_NO_DISK);
+  802218:	b9 f3 ff ff ff       	mov    $0xfffffff3,%ecx
+  80221d:	48 ba 41 58 80 00 00 	movabs $0x805841,%rdx
+  802224:	00 00 00 
+  802227:	be 3d 00 00 00       	mov    $0x3d,%esi
+  80222c:	48 bf 24 58 80 00 00 	movabs $0x805824,%rdi
+  802233:	00 00 00 
+  802236:	b8 00 00 00 00       	mov    $0x0,%eax
+  80223b:	49 b8 7d 26 80 00 00 	movabs $0x80267d,%r8
+  802242:	00 00 00 
+  802245:	41 ff d0             	call   *%r8
+    assert(TSTBIT(bits, r));
+  802248:	48 b9 51 58 80 00 00 	movabs $0x805851,%rcx
+  80224f:	00 00 00 
+  802252:	48 ba 1d 55 80 00 00 	movabs $0x80551d,%rdx
+  802259:	00 00 00 
+  80225c:	be 3f 00 00 00       	mov    $0x3f,%esi
+  802261:	48 bf 24 58 80 00 00 	movabs $0x805824,%rdi
+  802268:	00 00 00 
+  80226b:	49 b8 7d 26 80 00 00 	movabs $0x80267d,%r8
+  802272:	00 00 00 
+  802275:	41 ff d0             	call   *%r8
+    assert(!TSTBIT(bitmap, r));
+  802278:	48 b9 61 58 80 00 00 	movabs $0x805861,%rcx
+  80227f:	00 00 00 
+  802282:	48 ba 1d 55 80 00 00 	movabs $0x80551d,%rdx
+  802289:	00 00 00 
+  80228c:	be 41 00 00 00       	mov    $0x41,%esi
+  802291:	48 bf 24 58 80 00 00 	movabs $0x805824,%rdi
+  802298:	00 00 00 
+  80229b:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022a0:	49 b8 7d 26 80 00 00 	movabs $0x80267d,%r8
+  8022a7:	00 00 00 
+  8022aa:	41 ff d0             	call   *%r8
+    if ((r = file_open("/not-found", &f)) < 0 && r != -E_NOT_FOUND)
+  8022ad:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  8022b0:	0f 84 dd fc ff ff    	je     801f93 <fs_test+0x10d>
+        panic("file_open /not-found: %i", r);
+  8022b6:	89 c1                	mov    %eax,%ecx
+  8022b8:	48 ba ac 58 80 00 00 	movabs $0x8058ac,%rdx
+  8022bf:	00 00 00 
+  8022c2:	be 47 00 00 00       	mov    $0x47,%esi
+  8022c7:	48 bf 24 58 80 00 00 	movabs $0x805824,%rdi
+  8022ce:	00 00 00 
+  8022d1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022d6:	49 b8 7d 26 80 00 00 	movabs $0x80267d,%r8
+  8022dd:	00 00 00 
+  8022e0:	41 ff d0             	call   *%r8
+        panic("file_open /not-found succeeded!");
+  8022e3:	48 ba e0 59 80 00 00 	movabs $0x8059e0,%rdx
+  8022ea:	00 00 00 
+  8022ed:	be 49 00 00 00       	mov    $0x49,%esi
+  8022f2:	48 bf 24 58 80 00 00 	movabs $0x805824,%rdi
+  8022f9:	00 00 00 
+  8022fc:	48 b9 7d 26 80 00 00 	movabs $0x80267d,%rcx
+  802303:	00 00 00 
+  802306:	ff d1                	call   *%rcx
+        panic("file_open /newmotd: %i", r);
+  802308:	89 c1                	mov    %eax,%ecx
+  80230a:	48 ba ce 58 80 00 00 	movabs $0x8058ce,%rdx
+  802311:	00 00 00 
+  802314:	be 4b 00 00 00       	mov    $0x4b,%esi
+  802319:	48 bf 24 58 80 00 00 	movabs $0x805824,%rdi
+  802320:	00 00 00 
+  802323:	b8 00 00 00 00       	mov    $0x0,%eax
+  802328:	49 b8 7d 26 80 00 00 	movabs $0x80267d,%r8
+  80232f:	00 00 00 
+  802332:	41 ff d0             	call   *%r8
+        panic("file_get_block: %i", r);
+  802335:	89 c1                	mov    %eax,%ecx
+  802337:	48 ba f8 58 80 00 00 	movabs $0x8058f8,%rdx
+  80233e:	00 00 00 
+  802341:	be 4f 00 00 00       	mov    $0x4f,%esi
+  802346:	48 bf 24 58 80 00 00 	movabs $0x805824,%rdi
+  80234d:	00 00 00 
+  802350:	b8 00 00 00 00       	mov    $0x0,%eax
+  802355:	49 b8 7d 26 80 00 00 	movabs $0x80267d,%r8
+  80235c:	00 00 00 
+  80235f:	41 ff d0             	call   *%r8
+        panic("file_get_block returned wrong data");
+  802362:	48 ba 28 5a 80 00 00 	movabs $0x805a28,%rdx
+  802369:	00 00 00 
+  80236c:	be 51 00 00 00       	mov    $0x51,%esi
+  802371:	48 bf 24 58 80 00 00 	movabs $0x805824,%rdi
+  802378:	00 00 00 
+  80237b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802380:	48 b9 7d 26 80 00 00 	movabs $0x80267d,%rcx
+  802387:	00 00 00 
+  80238a:	ff d1                	call   *%rcx
+    assert(is_page_dirty(blk));
+  80238c:	48 b9 24 59 80 00 00 	movabs $0x805924,%rcx
+  802393:	00 00 00 
+  802396:	48 ba 1d 55 80 00 00 	movabs $0x80551d,%rdx
+  80239d:	00 00 00 
+  8023a0:	be 55 00 00 00       	mov    $0x55,%esi
+  8023a5:	48 bf 24 58 80 00 00 	movabs $0x805824,%rdi
+  8023ac:	00 00 00 
+  8023af:	49 b8 7d 26 80 00 00 	movabs $0x80267d,%r8
+  8023b6:	00 00 00 
+  8023b9:	41 ff d0             	call   *%r8
+    assert(!is_page_dirty(blk));
+  8023bc:	48 b9 23 59 80 00 00 	movabs $0x805923,%rcx
+  8023c3:	00 00 00 
+  8023c6:	48 ba 1d 55 80 00 00 	movabs $0x80551d,%rdx
+  8023cd:	00 00 00 
+  8023d0:	be 57 00 00 00       	mov    $0x57,%esi
+  8023d5:	48 bf 24 58 80 00 00 	movabs $0x805824,%rdi
+  8023dc:	00 00 00 
+  8023df:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023e4:	49 b8 7d 26 80 00 00 	movabs $0x80267d,%r8
+  8023eb:	00 00 00 
+  8023ee:	41 ff d0             	call   *%r8
+        panic("file_set_size: %i", r);
+  8023f1:	89 c1                	mov    %eax,%ecx
+  8023f3:	48 ba 4b 59 80 00 00 	movabs $0x80594b,%rdx
+  8023fa:	00 00 00 
+  8023fd:	be 5b 00 00 00       	mov    $0x5b,%esi
+  802402:	48 bf 24 58 80 00 00 	movabs $0x805824,%rdi
+  802409:	00 00 00 
+  80240c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802411:	49 b8 7d 26 80 00 00 	movabs $0x80267d,%r8
+  802418:	00 00 00 
+  80241b:	41 ff d0             	call   *%r8
+    assert(f->f_direct[0] == 0);
+  80241e:	48 b9 5d 59 80 00 00 	movabs $0x80595d,%rcx
+  802425:	00 00 00 
+  802428:	48 ba 1d 55 80 00 00 	movabs $0x80551d,%rdx
+  80242f:	00 00 00 
+  802432:	be 5c 00 00 00       	mov    $0x5c,%esi
+  802437:	48 bf 24 58 80 00 00 	movabs $0x805824,%rdi
+  80243e:	00 00 00 
+  802441:	b8 00 00 00 00       	mov    $0x0,%eax
+  802446:	49 b8 7d 26 80 00 00 	movabs $0x80267d,%r8
+  80244d:	00 00 00 
+  802450:	41 ff d0             	call   *%r8
+    assert(!is_page_dirty(f));
+  802453:	48 b9 71 59 80 00 00 	movabs $0x805971,%rcx
+  80245a:	00 00 00 
+  80245d:	48 ba 1d 55 80 00 00 	movabs $0x80551d,%rdx
+  802464:	00 00 00 
+  802467:	be 5d 00 00 00       	mov    $0x5d,%esi
+  80246c:	48 bf 24 58 80 00 00 	movabs $0x805824,%rdi
+  802473:	00 00 00 
+  802476:	b8 00 00 00 00       	mov    $0x0,%eax
+  80247b:	49 b8 7d 26 80 00 00 	movabs $0x80267d,%r8
+  802482:	00 00 00 
+  802485:	41 ff d0             	call   *%r8
+        panic("file_set_size 2: %i", r);
+  802488:	89 c1                	mov    %eax,%ecx
+  80248a:	48 ba 9a 59 80 00 00 	movabs $0x80599a,%rdx
+  802491:	00 00 00 
+  802494:	be 61 00 00 00       	mov    $0x61,%esi
+  802499:	48 bf 24 58 80 00 00 	movabs $0x805824,%rdi
+  8024a0:	00 00 00 
+  8024a3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024a8:	49 b8 7d 26 80 00 00 	movabs $0x80267d,%r8
+  8024af:	00 00 00 
+  8024b2:	41 ff d0             	call   *%r8
+    assert(!is_page_dirty(f));
+  8024b5:	48 b9 71 59 80 00 00 	movabs $0x805971,%rcx
+  8024bc:	00 00 00 
+  8024bf:	48 ba 1d 55 80 00 00 	movabs $0x80551d,%rdx
+  8024c6:	00 00 00 
+  8024c9:	be 62 00 00 00       	mov    $0x62,%esi
+  8024ce:	48 bf 24 58 80 00 00 	movabs $0x805824,%rdi
+  8024d5:	00 00 00 
+  8024d8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024dd:	49 b8 7d 26 80 00 00 	movabs $0x80267d,%r8
+  8024e4:	00 00 00 
+  8024e7:	41 ff d0             	call   *%r8
+        panic("file_get_block 2: %i", r);
+  8024ea:	89 c1                	mov    %eax,%ecx
+  8024ec:	48 ba ae 59 80 00 00 	movabs $0x8059ae,%rdx
+  8024f3:	00 00 00 
+  8024f6:	be 64 00 00 00       	mov    $0x64,%esi
+  8024fb:	48 bf 24 58 80 00 00 	movabs $0x805824,%rdi
+  802502:	00 00 00 
+  802505:	b8 00 00 00 00       	mov    $0x0,%eax
+  80250a:	49 b8 7d 26 80 00 00 	movabs $0x80267d,%r8
+  802511:	00 00 00 
+  802514:	41 ff d0             	call   *%r8
+    assert(is_page_dirty(blk));
+  802517:	48 b9 24 59 80 00 00 	movabs $0x805924,%rcx
+  80251e:	00 00 00 
+  802521:	48 ba 1d 55 80 00 00 	movabs $0x80551d,%rdx
+  802528:	00 00 00 
+  80252b:	be 66 00 00 00       	mov    $0x66,%esi
+  802530:	48 bf 24 58 80 00 00 	movabs $0x805824,%rdi
+  802537:	00 00 00 
+  80253a:	49 b8 7d 26 80 00 00 	movabs $0x80267d,%r8
+  802541:	00 00 00 
+  802544:	41 ff d0             	call   *%r8
+    assert(!is_page_dirty(blk));
+  802547:	48 b9 23 59 80 00 00 	movabs $0x805923,%rcx
+  80254e:	00 00 00 
+  802551:	48 ba 1d 55 80 00 00 	movabs $0x80551d,%rdx
+  802558:	00 00 00 
+  80255b:	be 68 00 00 00       	mov    $0x68,%esi
+  802560:	48 bf 24 58 80 00 00 	movabs $0x805824,%rdi
+  802567:	00 00 00 
+  80256a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80256f:	49 b8 7d 26 80 00 00 	movabs $0x80267d,%r8
+  802576:	00 00 00 
+  802579:	41 ff d0             	call   *%r8
+    assert(!is_page_dirty(f));
+  80257c:	48 b9 71 59 80 00 00 	movabs $0x805971,%rcx
+  802583:	00 00 00 
+  802586:	48 ba 1d 55 80 00 00 	movabs $0x80551d,%rdx
+  80258d:	00 00 00 
+  802590:	be 69 00 00 00       	mov    $0x69,%esi
+  802595:	48 bf 24 58 80 00 00 	movabs $0x805824,%rdi
+  80259c:	00 00 00 
+  80259f:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025a4:	49 b8 7d 26 80 00 00 	movabs $0x80267d,%r8
+  8025ab:	00 00 00 
+  8025ae:	41 ff d0             	call   *%r8
+
+00000000008025b1 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  8025b1:	55                   	push   %rbp
+  8025b2:	48 89 e5             	mov    %rsp,%rbp
+  8025b5:	41 56                	push   %r14
+  8025b7:	41 55                	push   %r13
+  8025b9:	41 54                	push   %r12
+  8025bb:	53                   	push   %rbx
+  8025bc:	41 89 fd             	mov    %edi,%r13d
+  8025bf:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  8025c2:	48 ba 58 b1 80 00 00 	movabs $0x80b158,%rdx
+  8025c9:	00 00 00 
+  8025cc:	48 b8 58 b1 80 00 00 	movabs $0x80b158,%rax
+  8025d3:	00 00 00 
+  8025d6:	48 39 c2             	cmp    %rax,%rdx
+  8025d9:	73 17                	jae    8025f2 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  8025db:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  8025de:	49 89 c4             	mov    %rax,%r12
+  8025e1:	48 83 c3 08          	add    $0x8,%rbx
+  8025e5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025ea:	ff 53 f8             	call   *-0x8(%rbx)
+  8025ed:	4c 39 e3             	cmp    %r12,%rbx
+  8025f0:	72 ef                	jb     8025e1 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+    envid_t this_env_id = sys_getenvid();
+  8025f2:	48 b8 e2 35 80 00 00 	movabs $0x8035e2,%rax
+  8025f9:	00 00 00 
+  8025fc:	ff d0                	call   *%rax
+    thisenv = &((struct Env*)UENVS)[ENVX(this_env_id)];
+  8025fe:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802603:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+  80260a:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  802611:	00 00 00 
+  802614:	48 01 d0             	add    %rdx,%rax
+  802617:	48 a3 10 c0 80 00 00 	movabs %rax,0x80c010
+  80261e:	00 00 00 
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  802621:	45 85 ed             	test   %r13d,%r13d
+  802624:	7e 0d                	jle    802633 <libmain+0x82>
+  802626:	49 8b 06             	mov    (%r14),%rax
+  802629:	48 a3 80 b0 80 00 00 	movabs %rax,0x80b080
+  802630:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  802633:	4c 89 f6             	mov    %r14,%rsi
+  802636:	44 89 ef             	mov    %r13d,%edi
+  802639:	48 b8 40 1c 80 00 00 	movabs $0x801c40,%rax
+  802640:	00 00 00 
+  802643:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  802645:	48 b8 5a 26 80 00 00 	movabs $0x80265a,%rax
+  80264c:	00 00 00 
+  80264f:	ff d0                	call   *%rax
+#endif
+}
+  802651:	5b                   	pop    %rbx
+  802652:	41 5c                	pop    %r12
+  802654:	41 5d                	pop    %r13
+  802656:	41 5e                	pop    %r14
+  802658:	5d                   	pop    %rbp
+  802659:	c3                   	ret
+
+000000000080265a <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  80265a:	55                   	push   %rbp
+  80265b:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  80265e:	48 b8 dd 41 80 00 00 	movabs $0x8041dd,%rax
+  802665:	00 00 00 
+  802668:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  80266a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80266f:	48 b8 77 35 80 00 00 	movabs $0x803577,%rax
+  802676:	00 00 00 
+  802679:	ff d0                	call   *%rax
+}
+  80267b:	5d                   	pop    %rbp
+  80267c:	c3                   	ret
+
+000000000080267d <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  80267d:	55                   	push   %rbp
+  80267e:	48 89 e5             	mov    %rsp,%rbp
+  802681:	41 56                	push   %r14
+  802683:	41 55                	push   %r13
+  802685:	41 54                	push   %r12
+  802687:	53                   	push   %rbx
+  802688:	48 83 ec 50          	sub    $0x50,%rsp
+  80268c:	49 89 fc             	mov    %rdi,%r12
+  80268f:	41 89 f5             	mov    %esi,%r13d
+  802692:	48 89 d3             	mov    %rdx,%rbx
+  802695:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  802699:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  80269d:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  8026a1:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  8026a8:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8026ac:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  8026b0:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  8026b4:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  8026b8:	48 b8 80 b0 80 00 00 	movabs $0x80b080,%rax
+  8026bf:	00 00 00 
+  8026c2:	4c 8b 30             	mov    (%rax),%r14
+  8026c5:	48 b8 e2 35 80 00 00 	movabs $0x8035e2,%rax
+  8026cc:	00 00 00 
+  8026cf:	ff d0                	call   *%rax
+  8026d1:	89 c6                	mov    %eax,%esi
+  8026d3:	45 89 e8             	mov    %r13d,%r8d
+  8026d6:	4c 89 e1             	mov    %r12,%rcx
+  8026d9:	4c 89 f2             	mov    %r14,%rdx
+  8026dc:	48 bf 58 5a 80 00 00 	movabs $0x805a58,%rdi
+  8026e3:	00 00 00 
+  8026e6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8026eb:	49 bc cd 27 80 00 00 	movabs $0x8027cd,%r12
+  8026f2:	00 00 00 
+  8026f5:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  8026f8:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  8026fc:	48 89 df             	mov    %rbx,%rdi
+  8026ff:	48 b8 69 27 80 00 00 	movabs $0x802769,%rax
+  802706:	00 00 00 
+  802709:	ff d0                	call   *%rax
+    cprintf("\n");
+  80270b:	48 bf 2c 56 80 00 00 	movabs $0x80562c,%rdi
+  802712:	00 00 00 
+  802715:	b8 00 00 00 00       	mov    $0x0,%eax
+  80271a:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  80271d:	cc                   	int3
+  80271e:	eb fd                	jmp    80271d <_panic+0xa0>
+
+0000000000802720 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  802720:	55                   	push   %rbp
+  802721:	48 89 e5             	mov    %rsp,%rbp
+  802724:	53                   	push   %rbx
+  802725:	48 83 ec 08          	sub    $0x8,%rsp
+  802729:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  80272c:	8b 06                	mov    (%rsi),%eax
+  80272e:	8d 50 01             	lea    0x1(%rax),%edx
+  802731:	89 16                	mov    %edx,(%rsi)
+  802733:	48 98                	cltq
+  802735:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  80273a:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  802740:	74 0a                	je     80274c <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  802742:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  802746:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80274a:	c9                   	leave
+  80274b:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  80274c:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  802750:	be ff 00 00 00       	mov    $0xff,%esi
+  802755:	48 b8 19 35 80 00 00 	movabs $0x803519,%rax
+  80275c:	00 00 00 
+  80275f:	ff d0                	call   *%rax
+        state->offset = 0;
+  802761:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  802767:	eb d9                	jmp    802742 <putch+0x22>
+
+0000000000802769 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  802769:	55                   	push   %rbp
+  80276a:	48 89 e5             	mov    %rsp,%rbp
+  80276d:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  802774:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  802777:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  80277e:	b9 21 00 00 00       	mov    $0x21,%ecx
+  802783:	b8 00 00 00 00       	mov    $0x0,%eax
+  802788:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  80278b:	48 89 f1             	mov    %rsi,%rcx
+  80278e:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  802795:	48 bf 20 27 80 00 00 	movabs $0x802720,%rdi
+  80279c:	00 00 00 
+  80279f:	48 b8 1d 29 80 00 00 	movabs $0x80291d,%rax
+  8027a6:	00 00 00 
+  8027a9:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  8027ab:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  8027b2:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  8027b9:	48 b8 19 35 80 00 00 	movabs $0x803519,%rax
+  8027c0:	00 00 00 
+  8027c3:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  8027c5:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  8027cb:	c9                   	leave
+  8027cc:	c3                   	ret
+
+00000000008027cd <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  8027cd:	55                   	push   %rbp
+  8027ce:	48 89 e5             	mov    %rsp,%rbp
+  8027d1:	48 83 ec 50          	sub    $0x50,%rsp
+  8027d5:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8027d9:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8027dd:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8027e1:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8027e5:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  8027e9:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  8027f0:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8027f4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8027f8:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8027fc:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  802800:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  802804:	48 b8 69 27 80 00 00 	movabs $0x802769,%rax
+  80280b:	00 00 00 
+  80280e:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  802810:	c9                   	leave
+  802811:	c3                   	ret
+
+0000000000802812 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  802812:	55                   	push   %rbp
+  802813:	48 89 e5             	mov    %rsp,%rbp
+  802816:	41 57                	push   %r15
+  802818:	41 56                	push   %r14
+  80281a:	41 55                	push   %r13
+  80281c:	41 54                	push   %r12
+  80281e:	53                   	push   %rbx
+  80281f:	48 83 ec 18          	sub    $0x18,%rsp
+  802823:	49 89 fc             	mov    %rdi,%r12
+  802826:	49 89 f5             	mov    %rsi,%r13
+  802829:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  80282d:	8b 45 10             	mov    0x10(%rbp),%eax
+  802830:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  802833:	41 89 cf             	mov    %ecx,%r15d
+  802836:	4c 39 fa             	cmp    %r15,%rdx
+  802839:	73 5b                	jae    802896 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  80283b:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  80283f:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  802843:	85 db                	test   %ebx,%ebx
+  802845:	7e 0e                	jle    802855 <print_num+0x43>
+            putch(padc, put_arg);
+  802847:	4c 89 ee             	mov    %r13,%rsi
+  80284a:	44 89 f7             	mov    %r14d,%edi
+  80284d:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  802850:	83 eb 01             	sub    $0x1,%ebx
+  802853:	75 f2                	jne    802847 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  802855:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  802859:	48 b9 8c 5a 80 00 00 	movabs $0x805a8c,%rcx
+  802860:	00 00 00 
+  802863:	48 b8 7b 5a 80 00 00 	movabs $0x805a7b,%rax
+  80286a:	00 00 00 
+  80286d:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  802871:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802875:	ba 00 00 00 00       	mov    $0x0,%edx
+  80287a:	49 f7 f7             	div    %r15
+  80287d:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  802881:	4c 89 ee             	mov    %r13,%rsi
+  802884:	41 ff d4             	call   *%r12
+}
+  802887:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  80288b:	5b                   	pop    %rbx
+  80288c:	41 5c                	pop    %r12
+  80288e:	41 5d                	pop    %r13
+  802890:	41 5e                	pop    %r14
+  802892:	41 5f                	pop    %r15
+  802894:	5d                   	pop    %rbp
+  802895:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  802896:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80289a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80289f:	49 f7 f7             	div    %r15
+  8028a2:	48 83 ec 08          	sub    $0x8,%rsp
+  8028a6:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  8028aa:	52                   	push   %rdx
+  8028ab:	45 0f be c9          	movsbl %r9b,%r9d
+  8028af:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  8028b3:	48 89 c2             	mov    %rax,%rdx
+  8028b6:	48 b8 12 28 80 00 00 	movabs $0x802812,%rax
+  8028bd:	00 00 00 
+  8028c0:	ff d0                	call   *%rax
+  8028c2:	48 83 c4 10          	add    $0x10,%rsp
+  8028c6:	eb 8d                	jmp    802855 <print_num+0x43>
+
+00000000008028c8 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  8028c8:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  8028cc:	48 8b 06             	mov    (%rsi),%rax
+  8028cf:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  8028d3:	73 0a                	jae    8028df <sprintputch+0x17>
+        *state->start++ = ch;
+  8028d5:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8028d9:	48 89 16             	mov    %rdx,(%rsi)
+  8028dc:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  8028df:	c3                   	ret
+
+00000000008028e0 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  8028e0:	55                   	push   %rbp
+  8028e1:	48 89 e5             	mov    %rsp,%rbp
+  8028e4:	48 83 ec 50          	sub    $0x50,%rsp
+  8028e8:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8028ec:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8028f0:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  8028f4:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8028fb:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8028ff:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802903:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  802907:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  80290b:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80290f:	48 b8 1d 29 80 00 00 	movabs $0x80291d,%rax
+  802916:	00 00 00 
+  802919:	ff d0                	call   *%rax
+}
+  80291b:	c9                   	leave
+  80291c:	c3                   	ret
+
+000000000080291d <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  80291d:	55                   	push   %rbp
+  80291e:	48 89 e5             	mov    %rsp,%rbp
+  802921:	41 57                	push   %r15
+  802923:	41 56                	push   %r14
+  802925:	41 55                	push   %r13
+  802927:	41 54                	push   %r12
+  802929:	53                   	push   %rbx
+  80292a:	48 83 ec 38          	sub    $0x38,%rsp
+  80292e:	49 89 fe             	mov    %rdi,%r14
+  802931:	49 89 f5             	mov    %rsi,%r13
+  802934:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  802937:	48 8b 01             	mov    (%rcx),%rax
+  80293a:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  80293e:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  802942:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802946:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  80294a:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  80294e:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  802952:	0f b6 3b             	movzbl (%rbx),%edi
+  802955:	40 80 ff 25          	cmp    $0x25,%dil
+  802959:	74 18                	je     802973 <vprintfmt+0x56>
+            if (!ch) return;
+  80295b:	40 84 ff             	test   %dil,%dil
+  80295e:	0f 84 b1 06 00 00    	je     803015 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  802964:	40 0f b6 ff          	movzbl %dil,%edi
+  802968:	4c 89 ee             	mov    %r13,%rsi
+  80296b:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  80296e:	4c 89 e3             	mov    %r12,%rbx
+  802971:	eb db                	jmp    80294e <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  802973:	be 00 00 00 00       	mov    $0x0,%esi
+  802978:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  80297c:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  802981:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  802987:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  80298e:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  802992:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  802997:	41 0f b6 04 24       	movzbl (%r12),%eax
+  80299c:	88 45 a0             	mov    %al,-0x60(%rbp)
+  80299f:	83 e8 23             	sub    $0x23,%eax
+  8029a2:	3c 57                	cmp    $0x57,%al
+  8029a4:	0f 87 51 06 00 00    	ja     802ffb <vprintfmt+0x6de>
+  8029aa:	0f b6 c0             	movzbl %al,%eax
+  8029ad:	48 b9 40 5c 80 00 00 	movabs $0x805c40,%rcx
+  8029b4:	00 00 00 
+  8029b7:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  8029ba:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  8029bd:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  8029c1:	eb cf                	jmp    802992 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  8029c3:	49 89 dc             	mov    %rbx,%r12
+  8029c6:	be 01 00 00 00       	mov    $0x1,%esi
+  8029cb:	eb c5                	jmp    802992 <vprintfmt+0x75>
+            padc = ch;
+  8029cd:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  8029d1:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8029d4:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8029d7:	eb b9                	jmp    802992 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8029d9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8029dc:	83 f8 2f             	cmp    $0x2f,%eax
+  8029df:	77 24                	ja     802a05 <vprintfmt+0xe8>
+  8029e1:	89 c1                	mov    %eax,%ecx
+  8029e3:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  8029e7:	83 c0 08             	add    $0x8,%eax
+  8029ea:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8029ed:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  8029f0:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  8029f3:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8029f7:	79 99                	jns    802992 <vprintfmt+0x75>
+                width = precision;
+  8029f9:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  8029fd:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  802a03:	eb 8d                	jmp    802992 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  802a05:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  802a09:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  802a0d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802a11:	eb da                	jmp    8029ed <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  802a13:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  802a18:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  802a1c:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  802a22:	3c 39                	cmp    $0x39,%al
+  802a24:	77 1c                	ja     802a42 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  802a26:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  802a2a:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  802a2e:	0f b6 c0             	movzbl %al,%eax
+  802a31:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  802a36:	0f b6 03             	movzbl (%rbx),%eax
+  802a39:	3c 39                	cmp    $0x39,%al
+  802a3b:	76 e9                	jbe    802a26 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  802a3d:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  802a40:	eb b1                	jmp    8029f3 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  802a42:	49 89 dc             	mov    %rbx,%r12
+  802a45:	eb ac                	jmp    8029f3 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  802a47:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  802a4a:	85 c9                	test   %ecx,%ecx
+  802a4c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a51:	0f 49 c1             	cmovns %ecx,%eax
+  802a54:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  802a57:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  802a5a:	e9 33 ff ff ff       	jmp    802992 <vprintfmt+0x75>
+            lflag++;
+  802a5f:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  802a62:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  802a65:	e9 28 ff ff ff       	jmp    802992 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  802a6a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802a6d:	83 f8 2f             	cmp    $0x2f,%eax
+  802a70:	77 19                	ja     802a8b <vprintfmt+0x16e>
+  802a72:	89 c2                	mov    %eax,%edx
+  802a74:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802a78:	83 c0 08             	add    $0x8,%eax
+  802a7b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802a7e:	8b 3a                	mov    (%rdx),%edi
+  802a80:	4c 89 ee             	mov    %r13,%rsi
+  802a83:	41 ff d6             	call   *%r14
+            break;
+  802a86:	e9 c3 fe ff ff       	jmp    80294e <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  802a8b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802a8f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802a93:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802a97:	eb e5                	jmp    802a7e <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  802a99:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802a9c:	83 f8 2f             	cmp    $0x2f,%eax
+  802a9f:	77 5a                	ja     802afb <vprintfmt+0x1de>
+  802aa1:	89 c2                	mov    %eax,%edx
+  802aa3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802aa7:	83 c0 08             	add    $0x8,%eax
+  802aaa:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  802aad:	8b 02                	mov    (%rdx),%eax
+  802aaf:	89 c1                	mov    %eax,%ecx
+  802ab1:	f7 d9                	neg    %ecx
+  802ab3:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  802ab6:	83 f9 15             	cmp    $0x15,%ecx
+  802ab9:	7f 4e                	jg     802b09 <vprintfmt+0x1ec>
+  802abb:	48 63 c1             	movslq %ecx,%rax
+  802abe:	48 ba 00 5f 80 00 00 	movabs $0x805f00,%rdx
+  802ac5:	00 00 00 
+  802ac8:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802acc:	48 85 c0             	test   %rax,%rax
+  802acf:	74 38                	je     802b09 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  802ad1:	48 89 c1             	mov    %rax,%rcx
+  802ad4:	48 ba 2f 55 80 00 00 	movabs $0x80552f,%rdx
+  802adb:	00 00 00 
+  802ade:	4c 89 ee             	mov    %r13,%rsi
+  802ae1:	4c 89 f7             	mov    %r14,%rdi
+  802ae4:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ae9:	49 b8 e0 28 80 00 00 	movabs $0x8028e0,%r8
+  802af0:	00 00 00 
+  802af3:	41 ff d0             	call   *%r8
+  802af6:	e9 53 fe ff ff       	jmp    80294e <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  802afb:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802aff:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802b03:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802b07:	eb a4                	jmp    802aad <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  802b09:	48 ba a4 5a 80 00 00 	movabs $0x805aa4,%rdx
+  802b10:	00 00 00 
+  802b13:	4c 89 ee             	mov    %r13,%rsi
+  802b16:	4c 89 f7             	mov    %r14,%rdi
+  802b19:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b1e:	49 b8 e0 28 80 00 00 	movabs $0x8028e0,%r8
+  802b25:	00 00 00 
+  802b28:	41 ff d0             	call   *%r8
+  802b2b:	e9 1e fe ff ff       	jmp    80294e <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  802b30:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802b33:	83 f8 2f             	cmp    $0x2f,%eax
+  802b36:	77 6c                	ja     802ba4 <vprintfmt+0x287>
+  802b38:	89 c2                	mov    %eax,%edx
+  802b3a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802b3e:	83 c0 08             	add    $0x8,%eax
+  802b41:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802b44:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  802b47:	48 85 d2             	test   %rdx,%rdx
+  802b4a:	48 b8 9d 5a 80 00 00 	movabs $0x805a9d,%rax
+  802b51:	00 00 00 
+  802b54:	48 0f 45 c2          	cmovne %rdx,%rax
+  802b58:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  802b5c:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  802b60:	7e 06                	jle    802b68 <vprintfmt+0x24b>
+  802b62:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  802b66:	75 4a                	jne    802bb2 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  802b68:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  802b6c:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  802b70:	0f b6 00             	movzbl (%rax),%eax
+  802b73:	84 c0                	test   %al,%al
+  802b75:	0f 85 9a 00 00 00    	jne    802c15 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  802b7b:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  802b7e:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  802b82:	85 c0                	test   %eax,%eax
+  802b84:	0f 8e c4 fd ff ff    	jle    80294e <vprintfmt+0x31>
+  802b8a:	4c 89 ee             	mov    %r13,%rsi
+  802b8d:	bf 20 00 00 00       	mov    $0x20,%edi
+  802b92:	41 ff d6             	call   *%r14
+  802b95:	41 83 ec 01          	sub    $0x1,%r12d
+  802b99:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  802b9d:	75 eb                	jne    802b8a <vprintfmt+0x26d>
+  802b9f:	e9 aa fd ff ff       	jmp    80294e <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  802ba4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802ba8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802bac:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802bb0:	eb 92                	jmp    802b44 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  802bb2:	49 63 f7             	movslq %r15d,%rsi
+  802bb5:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  802bb9:	48 b8 cf 30 80 00 00 	movabs $0x8030cf,%rax
+  802bc0:	00 00 00 
+  802bc3:	ff d0                	call   *%rax
+  802bc5:	48 89 c2             	mov    %rax,%rdx
+  802bc8:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  802bcb:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  802bcd:	8d 70 ff             	lea    -0x1(%rax),%esi
+  802bd0:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  802bd3:	85 c0                	test   %eax,%eax
+  802bd5:	7e 91                	jle    802b68 <vprintfmt+0x24b>
+  802bd7:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  802bdc:	4c 89 ee             	mov    %r13,%rsi
+  802bdf:	44 89 e7             	mov    %r12d,%edi
+  802be2:	41 ff d6             	call   *%r14
+  802be5:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  802be9:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  802bec:	83 f8 ff             	cmp    $0xffffffff,%eax
+  802bef:	75 eb                	jne    802bdc <vprintfmt+0x2bf>
+  802bf1:	e9 72 ff ff ff       	jmp    802b68 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  802bf6:	0f b6 f8             	movzbl %al,%edi
+  802bf9:	4c 89 ee             	mov    %r13,%rsi
+  802bfc:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  802bff:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  802c03:	49 83 c4 01          	add    $0x1,%r12
+  802c07:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  802c0d:	84 c0                	test   %al,%al
+  802c0f:	0f 84 66 ff ff ff    	je     802b7b <vprintfmt+0x25e>
+  802c15:	45 85 ff             	test   %r15d,%r15d
+  802c18:	78 0a                	js     802c24 <vprintfmt+0x307>
+  802c1a:	41 83 ef 01          	sub    $0x1,%r15d
+  802c1e:	0f 88 57 ff ff ff    	js     802b7b <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  802c24:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  802c28:	74 cc                	je     802bf6 <vprintfmt+0x2d9>
+  802c2a:	8d 50 e0             	lea    -0x20(%rax),%edx
+  802c2d:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  802c32:	80 fa 5e             	cmp    $0x5e,%dl
+  802c35:	77 c2                	ja     802bf9 <vprintfmt+0x2dc>
+  802c37:	eb bd                	jmp    802bf6 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  802c39:	40 84 f6             	test   %sil,%sil
+  802c3c:	75 26                	jne    802c64 <vprintfmt+0x347>
+    switch (lflag) {
+  802c3e:	85 d2                	test   %edx,%edx
+  802c40:	74 59                	je     802c9b <vprintfmt+0x37e>
+  802c42:	83 fa 01             	cmp    $0x1,%edx
+  802c45:	74 7b                	je     802cc2 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  802c47:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802c4a:	83 f8 2f             	cmp    $0x2f,%eax
+  802c4d:	0f 87 96 00 00 00    	ja     802ce9 <vprintfmt+0x3cc>
+  802c53:	89 c2                	mov    %eax,%edx
+  802c55:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802c59:	83 c0 08             	add    $0x8,%eax
+  802c5c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802c5f:	4c 8b 22             	mov    (%rdx),%r12
+  802c62:	eb 17                	jmp    802c7b <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  802c64:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802c67:	83 f8 2f             	cmp    $0x2f,%eax
+  802c6a:	77 21                	ja     802c8d <vprintfmt+0x370>
+  802c6c:	89 c2                	mov    %eax,%edx
+  802c6e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802c72:	83 c0 08             	add    $0x8,%eax
+  802c75:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802c78:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  802c7b:	4d 85 e4             	test   %r12,%r12
+  802c7e:	78 7a                	js     802cfa <vprintfmt+0x3dd>
+            num = i;
+  802c80:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  802c83:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  802c88:	e9 50 02 00 00       	jmp    802edd <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  802c8d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802c91:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802c95:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802c99:	eb dd                	jmp    802c78 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  802c9b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802c9e:	83 f8 2f             	cmp    $0x2f,%eax
+  802ca1:	77 11                	ja     802cb4 <vprintfmt+0x397>
+  802ca3:	89 c2                	mov    %eax,%edx
+  802ca5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802ca9:	83 c0 08             	add    $0x8,%eax
+  802cac:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802caf:	4c 63 22             	movslq (%rdx),%r12
+  802cb2:	eb c7                	jmp    802c7b <vprintfmt+0x35e>
+  802cb4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802cb8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802cbc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802cc0:	eb ed                	jmp    802caf <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  802cc2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802cc5:	83 f8 2f             	cmp    $0x2f,%eax
+  802cc8:	77 11                	ja     802cdb <vprintfmt+0x3be>
+  802cca:	89 c2                	mov    %eax,%edx
+  802ccc:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802cd0:	83 c0 08             	add    $0x8,%eax
+  802cd3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802cd6:	4c 8b 22             	mov    (%rdx),%r12
+  802cd9:	eb a0                	jmp    802c7b <vprintfmt+0x35e>
+  802cdb:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802cdf:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802ce3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802ce7:	eb ed                	jmp    802cd6 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  802ce9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802ced:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802cf1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802cf5:	e9 65 ff ff ff       	jmp    802c5f <vprintfmt+0x342>
+                putch('-', put_arg);
+  802cfa:	4c 89 ee             	mov    %r13,%rsi
+  802cfd:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  802d02:	41 ff d6             	call   *%r14
+                i = -i;
+  802d05:	49 f7 dc             	neg    %r12
+  802d08:	e9 73 ff ff ff       	jmp    802c80 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  802d0d:	40 84 f6             	test   %sil,%sil
+  802d10:	75 32                	jne    802d44 <vprintfmt+0x427>
+    switch (lflag) {
+  802d12:	85 d2                	test   %edx,%edx
+  802d14:	74 5d                	je     802d73 <vprintfmt+0x456>
+  802d16:	83 fa 01             	cmp    $0x1,%edx
+  802d19:	0f 84 82 00 00 00    	je     802da1 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  802d1f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802d22:	83 f8 2f             	cmp    $0x2f,%eax
+  802d25:	0f 87 a5 00 00 00    	ja     802dd0 <vprintfmt+0x4b3>
+  802d2b:	89 c2                	mov    %eax,%edx
+  802d2d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802d31:	83 c0 08             	add    $0x8,%eax
+  802d34:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802d37:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  802d3a:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  802d3f:	e9 99 01 00 00       	jmp    802edd <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  802d44:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802d47:	83 f8 2f             	cmp    $0x2f,%eax
+  802d4a:	77 19                	ja     802d65 <vprintfmt+0x448>
+  802d4c:	89 c2                	mov    %eax,%edx
+  802d4e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802d52:	83 c0 08             	add    $0x8,%eax
+  802d55:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802d58:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  802d5b:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  802d60:	e9 78 01 00 00       	jmp    802edd <vprintfmt+0x5c0>
+  802d65:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802d69:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802d6d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802d71:	eb e5                	jmp    802d58 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  802d73:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802d76:	83 f8 2f             	cmp    $0x2f,%eax
+  802d79:	77 18                	ja     802d93 <vprintfmt+0x476>
+  802d7b:	89 c2                	mov    %eax,%edx
+  802d7d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802d81:	83 c0 08             	add    $0x8,%eax
+  802d84:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802d87:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  802d89:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  802d8e:	e9 4a 01 00 00       	jmp    802edd <vprintfmt+0x5c0>
+  802d93:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802d97:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802d9b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802d9f:	eb e6                	jmp    802d87 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  802da1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802da4:	83 f8 2f             	cmp    $0x2f,%eax
+  802da7:	77 19                	ja     802dc2 <vprintfmt+0x4a5>
+  802da9:	89 c2                	mov    %eax,%edx
+  802dab:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802daf:	83 c0 08             	add    $0x8,%eax
+  802db2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802db5:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  802db8:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  802dbd:	e9 1b 01 00 00       	jmp    802edd <vprintfmt+0x5c0>
+  802dc2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802dc6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802dca:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802dce:	eb e5                	jmp    802db5 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  802dd0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802dd4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802dd8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802ddc:	e9 56 ff ff ff       	jmp    802d37 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  802de1:	40 84 f6             	test   %sil,%sil
+  802de4:	75 2e                	jne    802e14 <vprintfmt+0x4f7>
+    switch (lflag) {
+  802de6:	85 d2                	test   %edx,%edx
+  802de8:	74 59                	je     802e43 <vprintfmt+0x526>
+  802dea:	83 fa 01             	cmp    $0x1,%edx
+  802ded:	74 7f                	je     802e6e <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  802def:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802df2:	83 f8 2f             	cmp    $0x2f,%eax
+  802df5:	0f 87 9f 00 00 00    	ja     802e9a <vprintfmt+0x57d>
+  802dfb:	89 c2                	mov    %eax,%edx
+  802dfd:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802e01:	83 c0 08             	add    $0x8,%eax
+  802e04:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802e07:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  802e0a:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  802e0f:	e9 c9 00 00 00       	jmp    802edd <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  802e14:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802e17:	83 f8 2f             	cmp    $0x2f,%eax
+  802e1a:	77 19                	ja     802e35 <vprintfmt+0x518>
+  802e1c:	89 c2                	mov    %eax,%edx
+  802e1e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802e22:	83 c0 08             	add    $0x8,%eax
+  802e25:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802e28:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  802e2b:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  802e30:	e9 a8 00 00 00       	jmp    802edd <vprintfmt+0x5c0>
+  802e35:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802e39:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802e3d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802e41:	eb e5                	jmp    802e28 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  802e43:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802e46:	83 f8 2f             	cmp    $0x2f,%eax
+  802e49:	77 15                	ja     802e60 <vprintfmt+0x543>
+  802e4b:	89 c2                	mov    %eax,%edx
+  802e4d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802e51:	83 c0 08             	add    $0x8,%eax
+  802e54:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802e57:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  802e59:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  802e5e:	eb 7d                	jmp    802edd <vprintfmt+0x5c0>
+  802e60:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802e64:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802e68:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802e6c:	eb e9                	jmp    802e57 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  802e6e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802e71:	83 f8 2f             	cmp    $0x2f,%eax
+  802e74:	77 16                	ja     802e8c <vprintfmt+0x56f>
+  802e76:	89 c2                	mov    %eax,%edx
+  802e78:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802e7c:	83 c0 08             	add    $0x8,%eax
+  802e7f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802e82:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  802e85:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  802e8a:	eb 51                	jmp    802edd <vprintfmt+0x5c0>
+  802e8c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802e90:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802e94:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802e98:	eb e8                	jmp    802e82 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  802e9a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802e9e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802ea2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802ea6:	e9 5c ff ff ff       	jmp    802e07 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  802eab:	4c 89 ee             	mov    %r13,%rsi
+  802eae:	bf 30 00 00 00       	mov    $0x30,%edi
+  802eb3:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  802eb6:	4c 89 ee             	mov    %r13,%rsi
+  802eb9:	bf 78 00 00 00       	mov    $0x78,%edi
+  802ebe:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  802ec1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802ec4:	83 f8 2f             	cmp    $0x2f,%eax
+  802ec7:	77 47                	ja     802f10 <vprintfmt+0x5f3>
+  802ec9:	89 c2                	mov    %eax,%edx
+  802ecb:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802ecf:	83 c0 08             	add    $0x8,%eax
+  802ed2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802ed5:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  802ed8:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  802edd:	48 83 ec 08          	sub    $0x8,%rsp
+  802ee1:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  802ee5:	0f 94 c0             	sete   %al
+  802ee8:	0f b6 c0             	movzbl %al,%eax
+  802eeb:	50                   	push   %rax
+  802eec:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  802ef1:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  802ef5:	4c 89 ee             	mov    %r13,%rsi
+  802ef8:	4c 89 f7             	mov    %r14,%rdi
+  802efb:	48 b8 12 28 80 00 00 	movabs $0x802812,%rax
+  802f02:	00 00 00 
+  802f05:	ff d0                	call   *%rax
+            break;
+  802f07:	48 83 c4 10          	add    $0x10,%rsp
+  802f0b:	e9 3e fa ff ff       	jmp    80294e <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  802f10:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802f14:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802f18:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802f1c:	eb b7                	jmp    802ed5 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  802f1e:	40 84 f6             	test   %sil,%sil
+  802f21:	75 2b                	jne    802f4e <vprintfmt+0x631>
+    switch (lflag) {
+  802f23:	85 d2                	test   %edx,%edx
+  802f25:	74 56                	je     802f7d <vprintfmt+0x660>
+  802f27:	83 fa 01             	cmp    $0x1,%edx
+  802f2a:	74 7f                	je     802fab <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  802f2c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802f2f:	83 f8 2f             	cmp    $0x2f,%eax
+  802f32:	0f 87 a2 00 00 00    	ja     802fda <vprintfmt+0x6bd>
+  802f38:	89 c2                	mov    %eax,%edx
+  802f3a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802f3e:	83 c0 08             	add    $0x8,%eax
+  802f41:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802f44:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  802f47:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  802f4c:	eb 8f                	jmp    802edd <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  802f4e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802f51:	83 f8 2f             	cmp    $0x2f,%eax
+  802f54:	77 19                	ja     802f6f <vprintfmt+0x652>
+  802f56:	89 c2                	mov    %eax,%edx
+  802f58:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802f5c:	83 c0 08             	add    $0x8,%eax
+  802f5f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802f62:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  802f65:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  802f6a:	e9 6e ff ff ff       	jmp    802edd <vprintfmt+0x5c0>
+  802f6f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802f73:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802f77:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802f7b:	eb e5                	jmp    802f62 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  802f7d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802f80:	83 f8 2f             	cmp    $0x2f,%eax
+  802f83:	77 18                	ja     802f9d <vprintfmt+0x680>
+  802f85:	89 c2                	mov    %eax,%edx
+  802f87:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802f8b:	83 c0 08             	add    $0x8,%eax
+  802f8e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802f91:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  802f93:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  802f98:	e9 40 ff ff ff       	jmp    802edd <vprintfmt+0x5c0>
+  802f9d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802fa1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802fa5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802fa9:	eb e6                	jmp    802f91 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  802fab:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802fae:	83 f8 2f             	cmp    $0x2f,%eax
+  802fb1:	77 19                	ja     802fcc <vprintfmt+0x6af>
+  802fb3:	89 c2                	mov    %eax,%edx
+  802fb5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802fb9:	83 c0 08             	add    $0x8,%eax
+  802fbc:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802fbf:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  802fc2:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  802fc7:	e9 11 ff ff ff       	jmp    802edd <vprintfmt+0x5c0>
+  802fcc:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802fd0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802fd4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802fd8:	eb e5                	jmp    802fbf <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  802fda:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802fde:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802fe2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802fe6:	e9 59 ff ff ff       	jmp    802f44 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  802feb:	4c 89 ee             	mov    %r13,%rsi
+  802fee:	bf 25 00 00 00       	mov    $0x25,%edi
+  802ff3:	41 ff d6             	call   *%r14
+            break;
+  802ff6:	e9 53 f9 ff ff       	jmp    80294e <vprintfmt+0x31>
+            putch('%', put_arg);
+  802ffb:	4c 89 ee             	mov    %r13,%rsi
+  802ffe:	bf 25 00 00 00       	mov    $0x25,%edi
+  803003:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  803006:	48 83 eb 01          	sub    $0x1,%rbx
+  80300a:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  80300e:	75 f6                	jne    803006 <vprintfmt+0x6e9>
+  803010:	e9 39 f9 ff ff       	jmp    80294e <vprintfmt+0x31>
+}
+  803015:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  803019:	5b                   	pop    %rbx
+  80301a:	41 5c                	pop    %r12
+  80301c:	41 5d                	pop    %r13
+  80301e:	41 5e                	pop    %r14
+  803020:	41 5f                	pop    %r15
+  803022:	5d                   	pop    %rbp
+  803023:	c3                   	ret
+
+0000000000803024 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  803024:	55                   	push   %rbp
+  803025:	48 89 e5             	mov    %rsp,%rbp
+  803028:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  80302c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  803030:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  803035:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  803039:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  803040:	48 85 ff             	test   %rdi,%rdi
+  803043:	74 2b                	je     803070 <vsnprintf+0x4c>
+  803045:	48 85 f6             	test   %rsi,%rsi
+  803048:	74 26                	je     803070 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  80304a:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80304e:	48 bf c8 28 80 00 00 	movabs $0x8028c8,%rdi
+  803055:	00 00 00 
+  803058:	48 b8 1d 29 80 00 00 	movabs $0x80291d,%rax
+  80305f:	00 00 00 
+  803062:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  803064:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803068:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  80306b:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  80306e:	c9                   	leave
+  80306f:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  803070:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803075:	eb f7                	jmp    80306e <vsnprintf+0x4a>
+
+0000000000803077 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  803077:	55                   	push   %rbp
+  803078:	48 89 e5             	mov    %rsp,%rbp
+  80307b:	48 83 ec 50          	sub    $0x50,%rsp
+  80307f:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  803083:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  803087:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  80308b:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  803092:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803096:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80309a:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80309e:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  8030a2:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8030a6:	48 b8 24 30 80 00 00 	movabs $0x803024,%rax
+  8030ad:	00 00 00 
+  8030b0:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  8030b2:	c9                   	leave
+  8030b3:	c3                   	ret
+
+00000000008030b4 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  8030b4:	80 3f 00             	cmpb   $0x0,(%rdi)
+  8030b7:	74 10                	je     8030c9 <strlen+0x15>
+    size_t n = 0;
+  8030b9:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  8030be:	48 83 c0 01          	add    $0x1,%rax
+  8030c2:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  8030c6:	75 f6                	jne    8030be <strlen+0xa>
+  8030c8:	c3                   	ret
+    size_t n = 0;
+  8030c9:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  8030ce:	c3                   	ret
+
+00000000008030cf <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  8030cf:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  8030d2:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  8030d7:	48 85 f6             	test   %rsi,%rsi
+  8030da:	74 11                	je     8030ed <strnlen+0x1e>
+  8030dc:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  8030e0:	74 0c                	je     8030ee <strnlen+0x1f>
+  8030e2:	48 83 c2 01          	add    $0x1,%rdx
+  8030e6:	48 39 d0             	cmp    %rdx,%rax
+  8030e9:	75 f1                	jne    8030dc <strnlen+0xd>
+  8030eb:	eb 04                	jmp    8030f1 <strnlen+0x22>
+  8030ed:	c3                   	ret
+  8030ee:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  8030f1:	c3                   	ret
+
+00000000008030f2 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  8030f2:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  8030f5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8030fa:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  8030fe:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  803101:	48 83 c2 01          	add    $0x1,%rdx
+  803105:	84 c9                	test   %cl,%cl
+  803107:	75 f1                	jne    8030fa <strcpy+0x8>
+        ;
+    return res;
+}
+  803109:	c3                   	ret
+
+000000000080310a <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  80310a:	55                   	push   %rbp
+  80310b:	48 89 e5             	mov    %rsp,%rbp
+  80310e:	41 54                	push   %r12
+  803110:	53                   	push   %rbx
+  803111:	48 89 fb             	mov    %rdi,%rbx
+  803114:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  803117:	48 b8 b4 30 80 00 00 	movabs $0x8030b4,%rax
+  80311e:	00 00 00 
+  803121:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  803123:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  803127:	4c 89 e6             	mov    %r12,%rsi
+  80312a:	48 b8 f2 30 80 00 00 	movabs $0x8030f2,%rax
+  803131:	00 00 00 
+  803134:	ff d0                	call   *%rax
+    return dst;
+}
+  803136:	48 89 d8             	mov    %rbx,%rax
+  803139:	5b                   	pop    %rbx
+  80313a:	41 5c                	pop    %r12
+  80313c:	5d                   	pop    %rbp
+  80313d:	c3                   	ret
+
+000000000080313e <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  80313e:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  803141:	48 85 d2             	test   %rdx,%rdx
+  803144:	74 1f                	je     803165 <strncpy+0x27>
+  803146:	48 01 fa             	add    %rdi,%rdx
+  803149:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  80314c:	48 83 c1 01          	add    $0x1,%rcx
+  803150:	44 0f b6 06          	movzbl (%rsi),%r8d
+  803154:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  803158:	41 80 f8 01          	cmp    $0x1,%r8b
+  80315c:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  803160:	48 39 ca             	cmp    %rcx,%rdx
+  803163:	75 e7                	jne    80314c <strncpy+0xe>
+    }
+    return ret;
+}
+  803165:	c3                   	ret
+
+0000000000803166 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  803166:	48 89 f8             	mov    %rdi,%rax
+  803169:	48 85 d2             	test   %rdx,%rdx
+  80316c:	74 24                	je     803192 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  80316e:	48 83 ea 01          	sub    $0x1,%rdx
+  803172:	74 1b                	je     80318f <strlcpy+0x29>
+  803174:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  803178:	0f b6 16             	movzbl (%rsi),%edx
+  80317b:	84 d2                	test   %dl,%dl
+  80317d:	74 10                	je     80318f <strlcpy+0x29>
+            *dst++ = *src++;
+  80317f:	48 83 c6 01          	add    $0x1,%rsi
+  803183:	48 83 c0 01          	add    $0x1,%rax
+  803187:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  80318a:	48 39 c8             	cmp    %rcx,%rax
+  80318d:	75 e9                	jne    803178 <strlcpy+0x12>
+        *dst = '\0';
+  80318f:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  803192:	48 29 f8             	sub    %rdi,%rax
+}
+  803195:	c3                   	ret
+
+0000000000803196 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  803196:	0f b6 07             	movzbl (%rdi),%eax
+  803199:	84 c0                	test   %al,%al
+  80319b:	74 13                	je     8031b0 <strcmp+0x1a>
+  80319d:	38 06                	cmp    %al,(%rsi)
+  80319f:	75 0f                	jne    8031b0 <strcmp+0x1a>
+  8031a1:	48 83 c7 01          	add    $0x1,%rdi
+  8031a5:	48 83 c6 01          	add    $0x1,%rsi
+  8031a9:	0f b6 07             	movzbl (%rdi),%eax
+  8031ac:	84 c0                	test   %al,%al
+  8031ae:	75 ed                	jne    80319d <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  8031b0:	0f b6 c0             	movzbl %al,%eax
+  8031b3:	0f b6 16             	movzbl (%rsi),%edx
+  8031b6:	29 d0                	sub    %edx,%eax
+}
+  8031b8:	c3                   	ret
+
+00000000008031b9 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  8031b9:	48 85 d2             	test   %rdx,%rdx
+  8031bc:	74 1f                	je     8031dd <strncmp+0x24>
+  8031be:	0f b6 07             	movzbl (%rdi),%eax
+  8031c1:	84 c0                	test   %al,%al
+  8031c3:	74 1e                	je     8031e3 <strncmp+0x2a>
+  8031c5:	3a 06                	cmp    (%rsi),%al
+  8031c7:	75 1a                	jne    8031e3 <strncmp+0x2a>
+  8031c9:	48 83 c7 01          	add    $0x1,%rdi
+  8031cd:	48 83 c6 01          	add    $0x1,%rsi
+  8031d1:	48 83 ea 01          	sub    $0x1,%rdx
+  8031d5:	75 e7                	jne    8031be <strncmp+0x5>
+
+    if (!n) return 0;
+  8031d7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8031dc:	c3                   	ret
+  8031dd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8031e2:	c3                   	ret
+  8031e3:	48 85 d2             	test   %rdx,%rdx
+  8031e6:	74 09                	je     8031f1 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  8031e8:	0f b6 07             	movzbl (%rdi),%eax
+  8031eb:	0f b6 16             	movzbl (%rsi),%edx
+  8031ee:	29 d0                	sub    %edx,%eax
+  8031f0:	c3                   	ret
+    if (!n) return 0;
+  8031f1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8031f6:	c3                   	ret
+
+00000000008031f7 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  8031f7:	0f b6 17             	movzbl (%rdi),%edx
+  8031fa:	84 d2                	test   %dl,%dl
+  8031fc:	74 18                	je     803216 <strchr+0x1f>
+        if (*str == c) {
+  8031fe:	0f be d2             	movsbl %dl,%edx
+  803201:	39 f2                	cmp    %esi,%edx
+  803203:	74 17                	je     80321c <strchr+0x25>
+    for (; *str; str++) {
+  803205:	48 83 c7 01          	add    $0x1,%rdi
+  803209:	0f b6 17             	movzbl (%rdi),%edx
+  80320c:	84 d2                	test   %dl,%dl
+  80320e:	75 ee                	jne    8031fe <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  803210:	b8 00 00 00 00       	mov    $0x0,%eax
+  803215:	c3                   	ret
+  803216:	b8 00 00 00 00       	mov    $0x0,%eax
+  80321b:	c3                   	ret
+  80321c:	48 89 f8             	mov    %rdi,%rax
+}
+  80321f:	c3                   	ret
+
+0000000000803220 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  803220:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  803223:	0f b6 17             	movzbl (%rdi),%edx
+  803226:	84 d2                	test   %dl,%dl
+  803228:	74 13                	je     80323d <strfind+0x1d>
+  80322a:	0f be d2             	movsbl %dl,%edx
+  80322d:	39 f2                	cmp    %esi,%edx
+  80322f:	74 0b                	je     80323c <strfind+0x1c>
+  803231:	48 83 c0 01          	add    $0x1,%rax
+  803235:	0f b6 10             	movzbl (%rax),%edx
+  803238:	84 d2                	test   %dl,%dl
+  80323a:	75 ee                	jne    80322a <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  80323c:	c3                   	ret
+  80323d:	c3                   	ret
+
+000000000080323e <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  80323e:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  803241:	48 89 f8             	mov    %rdi,%rax
+  803244:	48 f7 d8             	neg    %rax
+  803247:	83 e0 07             	and    $0x7,%eax
+  80324a:	49 89 d1             	mov    %rdx,%r9
+  80324d:	49 29 c1             	sub    %rax,%r9
+  803250:	78 36                	js     803288 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  803252:	40 0f b6 c6          	movzbl %sil,%eax
+  803256:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  80325d:	01 01 01 
+  803260:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  803264:	40 f6 c7 07          	test   $0x7,%dil
+  803268:	75 38                	jne    8032a2 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  80326a:	4c 89 c9             	mov    %r9,%rcx
+  80326d:	48 c1 f9 03          	sar    $0x3,%rcx
+  803271:	74 0c                	je     80327f <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  803273:	fc                   	cld
+  803274:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  803277:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  80327b:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  80327f:	4d 85 c9             	test   %r9,%r9
+  803282:	75 45                	jne    8032c9 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  803284:	4c 89 c0             	mov    %r8,%rax
+  803287:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  803288:	48 85 d2             	test   %rdx,%rdx
+  80328b:	74 f7                	je     803284 <memset+0x46>
+  80328d:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  803290:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  803293:	48 83 c0 01          	add    $0x1,%rax
+  803297:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  80329b:	48 39 c2             	cmp    %rax,%rdx
+  80329e:	75 f3                	jne    803293 <memset+0x55>
+  8032a0:	eb e2                	jmp    803284 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  8032a2:	40 f6 c7 01          	test   $0x1,%dil
+  8032a6:	74 06                	je     8032ae <memset+0x70>
+  8032a8:	88 07                	mov    %al,(%rdi)
+  8032aa:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  8032ae:	40 f6 c7 02          	test   $0x2,%dil
+  8032b2:	74 07                	je     8032bb <memset+0x7d>
+  8032b4:	66 89 07             	mov    %ax,(%rdi)
+  8032b7:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  8032bb:	40 f6 c7 04          	test   $0x4,%dil
+  8032bf:	74 a9                	je     80326a <memset+0x2c>
+  8032c1:	89 07                	mov    %eax,(%rdi)
+  8032c3:	48 83 c7 04          	add    $0x4,%rdi
+  8032c7:	eb a1                	jmp    80326a <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  8032c9:	41 f6 c1 04          	test   $0x4,%r9b
+  8032cd:	74 06                	je     8032d5 <memset+0x97>
+  8032cf:	89 07                	mov    %eax,(%rdi)
+  8032d1:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  8032d5:	41 f6 c1 02          	test   $0x2,%r9b
+  8032d9:	74 07                	je     8032e2 <memset+0xa4>
+  8032db:	66 89 07             	mov    %ax,(%rdi)
+  8032de:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  8032e2:	41 f6 c1 01          	test   $0x1,%r9b
+  8032e6:	74 9c                	je     803284 <memset+0x46>
+  8032e8:	88 07                	mov    %al,(%rdi)
+  8032ea:	eb 98                	jmp    803284 <memset+0x46>
+
+00000000008032ec <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  8032ec:	48 89 f8             	mov    %rdi,%rax
+  8032ef:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  8032f2:	48 39 fe             	cmp    %rdi,%rsi
+  8032f5:	73 3b                	jae    803332 <memmove+0x46>
+  8032f7:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  8032fb:	48 39 d7             	cmp    %rdx,%rdi
+  8032fe:	73 32                	jae    803332 <memmove+0x46>
+        s += n;
+        d += n;
+  803300:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  803304:	48 89 d6             	mov    %rdx,%rsi
+  803307:	48 09 fe             	or     %rdi,%rsi
+  80330a:	48 09 ce             	or     %rcx,%rsi
+  80330d:	40 f6 c6 07          	test   $0x7,%sil
+  803311:	75 12                	jne    803325 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  803313:	48 83 ef 08          	sub    $0x8,%rdi
+  803317:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  80331b:	48 c1 e9 03          	shr    $0x3,%rcx
+  80331f:	fd                   	std
+  803320:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  803323:	fc                   	cld
+  803324:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  803325:	48 83 ef 01          	sub    $0x1,%rdi
+  803329:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  80332d:	fd                   	std
+  80332e:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  803330:	eb f1                	jmp    803323 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  803332:	48 89 f2             	mov    %rsi,%rdx
+  803335:	48 09 c2             	or     %rax,%rdx
+  803338:	48 09 ca             	or     %rcx,%rdx
+  80333b:	f6 c2 07             	test   $0x7,%dl
+  80333e:	75 0c                	jne    80334c <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  803340:	48 c1 e9 03          	shr    $0x3,%rcx
+  803344:	48 89 c7             	mov    %rax,%rdi
+  803347:	fc                   	cld
+  803348:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  80334b:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  80334c:	48 89 c7             	mov    %rax,%rdi
+  80334f:	fc                   	cld
+  803350:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  803352:	c3                   	ret
+
+0000000000803353 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  803353:	55                   	push   %rbp
+  803354:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  803357:	48 b8 ec 32 80 00 00 	movabs $0x8032ec,%rax
+  80335e:	00 00 00 
+  803361:	ff d0                	call   *%rax
+}
+  803363:	5d                   	pop    %rbp
+  803364:	c3                   	ret
+
+0000000000803365 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  803365:	55                   	push   %rbp
+  803366:	48 89 e5             	mov    %rsp,%rbp
+  803369:	41 57                	push   %r15
+  80336b:	41 56                	push   %r14
+  80336d:	41 55                	push   %r13
+  80336f:	41 54                	push   %r12
+  803371:	53                   	push   %rbx
+  803372:	48 83 ec 08          	sub    $0x8,%rsp
+  803376:	49 89 fe             	mov    %rdi,%r14
+  803379:	49 89 f7             	mov    %rsi,%r15
+  80337c:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  80337f:	48 89 f7             	mov    %rsi,%rdi
+  803382:	48 b8 b4 30 80 00 00 	movabs $0x8030b4,%rax
+  803389:	00 00 00 
+  80338c:	ff d0                	call   *%rax
+  80338e:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  803391:	48 89 de             	mov    %rbx,%rsi
+  803394:	4c 89 f7             	mov    %r14,%rdi
+  803397:	48 b8 cf 30 80 00 00 	movabs $0x8030cf,%rax
+  80339e:	00 00 00 
+  8033a1:	ff d0                	call   *%rax
+  8033a3:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  8033a6:	48 39 c3             	cmp    %rax,%rbx
+  8033a9:	74 36                	je     8033e1 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  8033ab:	48 89 d8             	mov    %rbx,%rax
+  8033ae:	4c 29 e8             	sub    %r13,%rax
+  8033b1:	49 39 c4             	cmp    %rax,%r12
+  8033b4:	73 31                	jae    8033e7 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  8033b6:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  8033bb:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8033bf:	4c 89 fe             	mov    %r15,%rsi
+  8033c2:	48 b8 53 33 80 00 00 	movabs $0x803353,%rax
+  8033c9:	00 00 00 
+  8033cc:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  8033ce:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  8033d2:	48 83 c4 08          	add    $0x8,%rsp
+  8033d6:	5b                   	pop    %rbx
+  8033d7:	41 5c                	pop    %r12
+  8033d9:	41 5d                	pop    %r13
+  8033db:	41 5e                	pop    %r14
+  8033dd:	41 5f                	pop    %r15
+  8033df:	5d                   	pop    %rbp
+  8033e0:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  8033e1:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  8033e5:	eb eb                	jmp    8033d2 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  8033e7:	48 83 eb 01          	sub    $0x1,%rbx
+  8033eb:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8033ef:	48 89 da             	mov    %rbx,%rdx
+  8033f2:	4c 89 fe             	mov    %r15,%rsi
+  8033f5:	48 b8 53 33 80 00 00 	movabs $0x803353,%rax
+  8033fc:	00 00 00 
+  8033ff:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  803401:	49 01 de             	add    %rbx,%r14
+  803404:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  803409:	eb c3                	jmp    8033ce <strlcat+0x69>
+
+000000000080340b <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  80340b:	48 85 d2             	test   %rdx,%rdx
+  80340e:	74 2d                	je     80343d <memcmp+0x32>
+  803410:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  803415:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  803419:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  80341e:	44 38 c1             	cmp    %r8b,%cl
+  803421:	75 0f                	jne    803432 <memcmp+0x27>
+    while (n-- > 0) {
+  803423:	48 83 c0 01          	add    $0x1,%rax
+  803427:	48 39 c2             	cmp    %rax,%rdx
+  80342a:	75 e9                	jne    803415 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  80342c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803431:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  803432:	0f b6 c1             	movzbl %cl,%eax
+  803435:	45 0f b6 c0          	movzbl %r8b,%r8d
+  803439:	44 29 c0             	sub    %r8d,%eax
+  80343c:	c3                   	ret
+    return 0;
+  80343d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803442:	c3                   	ret
+
+0000000000803443 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  803443:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  803447:	48 39 c7             	cmp    %rax,%rdi
+  80344a:	73 0f                	jae    80345b <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  80344c:	40 38 37             	cmp    %sil,(%rdi)
+  80344f:	74 0e                	je     80345f <memfind+0x1c>
+    for (; src < end; src++) {
+  803451:	48 83 c7 01          	add    $0x1,%rdi
+  803455:	48 39 f8             	cmp    %rdi,%rax
+  803458:	75 f2                	jne    80344c <memfind+0x9>
+  80345a:	c3                   	ret
+  80345b:	48 89 f8             	mov    %rdi,%rax
+  80345e:	c3                   	ret
+  80345f:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  803462:	c3                   	ret
+
+0000000000803463 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  803463:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  803466:	0f b6 37             	movzbl (%rdi),%esi
+  803469:	40 80 fe 20          	cmp    $0x20,%sil
+  80346d:	74 06                	je     803475 <strtol+0x12>
+  80346f:	40 80 fe 09          	cmp    $0x9,%sil
+  803473:	75 13                	jne    803488 <strtol+0x25>
+  803475:	48 83 c7 01          	add    $0x1,%rdi
+  803479:	0f b6 37             	movzbl (%rdi),%esi
+  80347c:	40 80 fe 20          	cmp    $0x20,%sil
+  803480:	74 f3                	je     803475 <strtol+0x12>
+  803482:	40 80 fe 09          	cmp    $0x9,%sil
+  803486:	74 ed                	je     803475 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  803488:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  80348b:	83 e0 fd             	and    $0xfffffffd,%eax
+  80348e:	3c 01                	cmp    $0x1,%al
+  803490:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  803494:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  80349a:	75 0f                	jne    8034ab <strtol+0x48>
+  80349c:	80 3f 30             	cmpb   $0x30,(%rdi)
+  80349f:	74 14                	je     8034b5 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  8034a1:	85 d2                	test   %edx,%edx
+  8034a3:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8034a8:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  8034ab:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  8034b0:	4c 63 ca             	movslq %edx,%r9
+  8034b3:	eb 36                	jmp    8034eb <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8034b5:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  8034b9:	74 0f                	je     8034ca <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  8034bb:	85 d2                	test   %edx,%edx
+  8034bd:	75 ec                	jne    8034ab <strtol+0x48>
+        s++;
+  8034bf:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  8034c3:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  8034c8:	eb e1                	jmp    8034ab <strtol+0x48>
+        s += 2;
+  8034ca:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  8034ce:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  8034d3:	eb d6                	jmp    8034ab <strtol+0x48>
+            dig -= '0';
+  8034d5:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  8034d8:	44 0f b6 c1          	movzbl %cl,%r8d
+  8034dc:	41 39 d0             	cmp    %edx,%r8d
+  8034df:	7d 21                	jge    803502 <strtol+0x9f>
+        val = val * base + dig;
+  8034e1:	49 0f af c1          	imul   %r9,%rax
+  8034e5:	0f b6 c9             	movzbl %cl,%ecx
+  8034e8:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  8034eb:	48 83 c7 01          	add    $0x1,%rdi
+  8034ef:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  8034f3:	80 f9 39             	cmp    $0x39,%cl
+  8034f6:	76 dd                	jbe    8034d5 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  8034f8:	80 f9 7b             	cmp    $0x7b,%cl
+  8034fb:	77 05                	ja     803502 <strtol+0x9f>
+            dig -= 'a' - 10;
+  8034fd:	83 e9 57             	sub    $0x57,%ecx
+  803500:	eb d6                	jmp    8034d8 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  803502:	4d 85 d2             	test   %r10,%r10
+  803505:	74 03                	je     80350a <strtol+0xa7>
+  803507:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  80350a:	48 89 c2             	mov    %rax,%rdx
+  80350d:	48 f7 da             	neg    %rdx
+  803510:	40 80 fe 2d          	cmp    $0x2d,%sil
+  803514:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  803518:	c3                   	ret
+
+0000000000803519 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  803519:	55                   	push   %rbp
+  80351a:	48 89 e5             	mov    %rsp,%rbp
+  80351d:	53                   	push   %rbx
+  80351e:	48 89 fa             	mov    %rdi,%rdx
+  803521:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  803524:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  803529:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80352e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  803533:	be 00 00 00 00       	mov    $0x0,%esi
+  803538:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80353e:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  803540:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803544:	c9                   	leave
+  803545:	c3                   	ret
+
+0000000000803546 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  803546:	55                   	push   %rbp
+  803547:	48 89 e5             	mov    %rsp,%rbp
+  80354a:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80354b:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  803550:	ba 00 00 00 00       	mov    $0x0,%edx
+  803555:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80355a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80355f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  803564:	be 00 00 00 00       	mov    $0x0,%esi
+  803569:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80356f:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  803571:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803575:	c9                   	leave
+  803576:	c3                   	ret
+
+0000000000803577 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  803577:	55                   	push   %rbp
+  803578:	48 89 e5             	mov    %rsp,%rbp
+  80357b:	53                   	push   %rbx
+  80357c:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  803580:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  803583:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  803588:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80358d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803592:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  803597:	be 00 00 00 00       	mov    $0x0,%esi
+  80359c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8035a2:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8035a4:	48 85 c0             	test   %rax,%rax
+  8035a7:	7f 06                	jg     8035af <sys_env_destroy+0x38>
+}
+  8035a9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8035ad:	c9                   	leave
+  8035ae:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8035af:	49 89 c0             	mov    %rax,%r8
+  8035b2:	b9 03 00 00 00       	mov    $0x3,%ecx
+  8035b7:	48 ba d0 5f 80 00 00 	movabs $0x805fd0,%rdx
+  8035be:	00 00 00 
+  8035c1:	be 26 00 00 00       	mov    $0x26,%esi
+  8035c6:	48 bf ef 5f 80 00 00 	movabs $0x805fef,%rdi
+  8035cd:	00 00 00 
+  8035d0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8035d5:	49 b9 7d 26 80 00 00 	movabs $0x80267d,%r9
+  8035dc:	00 00 00 
+  8035df:	41 ff d1             	call   *%r9
+
+00000000008035e2 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  8035e2:	55                   	push   %rbp
+  8035e3:	48 89 e5             	mov    %rsp,%rbp
+  8035e6:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8035e7:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8035ec:	ba 00 00 00 00       	mov    $0x0,%edx
+  8035f1:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8035f6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8035fb:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  803600:	be 00 00 00 00       	mov    $0x0,%esi
+  803605:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80360b:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  80360d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803611:	c9                   	leave
+  803612:	c3                   	ret
+
+0000000000803613 <sys_yield>:
+
+void
+sys_yield(void) {
+  803613:	55                   	push   %rbp
+  803614:	48 89 e5             	mov    %rsp,%rbp
+  803617:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  803618:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80361d:	ba 00 00 00 00       	mov    $0x0,%edx
+  803622:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  803627:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80362c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  803631:	be 00 00 00 00       	mov    $0x0,%esi
+  803636:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80363c:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  80363e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803642:	c9                   	leave
+  803643:	c3                   	ret
+
+0000000000803644 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  803644:	55                   	push   %rbp
+  803645:	48 89 e5             	mov    %rsp,%rbp
+  803648:	53                   	push   %rbx
+  803649:	48 89 fa             	mov    %rdi,%rdx
+  80364c:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80364f:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  803654:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  80365b:	00 00 00 
+  80365e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  803663:	be 00 00 00 00       	mov    $0x0,%esi
+  803668:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80366e:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  803670:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803674:	c9                   	leave
+  803675:	c3                   	ret
+
+0000000000803676 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  803676:	55                   	push   %rbp
+  803677:	48 89 e5             	mov    %rsp,%rbp
+  80367a:	53                   	push   %rbx
+  80367b:	49 89 f8             	mov    %rdi,%r8
+  80367e:	48 89 d3             	mov    %rdx,%rbx
+  803681:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  803684:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  803689:	4c 89 c2             	mov    %r8,%rdx
+  80368c:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80368f:	be 00 00 00 00       	mov    $0x0,%esi
+  803694:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80369a:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  80369c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8036a0:	c9                   	leave
+  8036a1:	c3                   	ret
+
+00000000008036a2 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  8036a2:	55                   	push   %rbp
+  8036a3:	48 89 e5             	mov    %rsp,%rbp
+  8036a6:	53                   	push   %rbx
+  8036a7:	48 83 ec 08          	sub    $0x8,%rsp
+  8036ab:	89 f8                	mov    %edi,%eax
+  8036ad:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  8036b0:	48 63 f9             	movslq %ecx,%rdi
+  8036b3:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8036b6:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8036bb:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8036be:	be 00 00 00 00       	mov    $0x0,%esi
+  8036c3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8036c9:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8036cb:	48 85 c0             	test   %rax,%rax
+  8036ce:	7f 06                	jg     8036d6 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  8036d0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8036d4:	c9                   	leave
+  8036d5:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8036d6:	49 89 c0             	mov    %rax,%r8
+  8036d9:	b9 04 00 00 00       	mov    $0x4,%ecx
+  8036de:	48 ba d0 5f 80 00 00 	movabs $0x805fd0,%rdx
+  8036e5:	00 00 00 
+  8036e8:	be 26 00 00 00       	mov    $0x26,%esi
+  8036ed:	48 bf ef 5f 80 00 00 	movabs $0x805fef,%rdi
+  8036f4:	00 00 00 
+  8036f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8036fc:	49 b9 7d 26 80 00 00 	movabs $0x80267d,%r9
+  803703:	00 00 00 
+  803706:	41 ff d1             	call   *%r9
+
+0000000000803709 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  803709:	55                   	push   %rbp
+  80370a:	48 89 e5             	mov    %rsp,%rbp
+  80370d:	53                   	push   %rbx
+  80370e:	48 83 ec 08          	sub    $0x8,%rsp
+  803712:	89 f8                	mov    %edi,%eax
+  803714:	49 89 f2             	mov    %rsi,%r10
+  803717:	48 89 cf             	mov    %rcx,%rdi
+  80371a:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  80371d:	48 63 da             	movslq %edx,%rbx
+  803720:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  803723:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  803728:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80372b:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  80372e:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  803730:	48 85 c0             	test   %rax,%rax
+  803733:	7f 06                	jg     80373b <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  803735:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803739:	c9                   	leave
+  80373a:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80373b:	49 89 c0             	mov    %rax,%r8
+  80373e:	b9 05 00 00 00       	mov    $0x5,%ecx
+  803743:	48 ba d0 5f 80 00 00 	movabs $0x805fd0,%rdx
+  80374a:	00 00 00 
+  80374d:	be 26 00 00 00       	mov    $0x26,%esi
+  803752:	48 bf ef 5f 80 00 00 	movabs $0x805fef,%rdi
+  803759:	00 00 00 
+  80375c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803761:	49 b9 7d 26 80 00 00 	movabs $0x80267d,%r9
+  803768:	00 00 00 
+  80376b:	41 ff d1             	call   *%r9
+
+000000000080376e <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  80376e:	55                   	push   %rbp
+  80376f:	48 89 e5             	mov    %rsp,%rbp
+  803772:	53                   	push   %rbx
+  803773:	48 83 ec 08          	sub    $0x8,%rsp
+  803777:	48 89 f1             	mov    %rsi,%rcx
+  80377a:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  80377d:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  803780:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  803785:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80378a:	be 00 00 00 00       	mov    $0x0,%esi
+  80378f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  803795:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  803797:	48 85 c0             	test   %rax,%rax
+  80379a:	7f 06                	jg     8037a2 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  80379c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8037a0:	c9                   	leave
+  8037a1:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8037a2:	49 89 c0             	mov    %rax,%r8
+  8037a5:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8037aa:	48 ba d0 5f 80 00 00 	movabs $0x805fd0,%rdx
+  8037b1:	00 00 00 
+  8037b4:	be 26 00 00 00       	mov    $0x26,%esi
+  8037b9:	48 bf ef 5f 80 00 00 	movabs $0x805fef,%rdi
+  8037c0:	00 00 00 
+  8037c3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8037c8:	49 b9 7d 26 80 00 00 	movabs $0x80267d,%r9
+  8037cf:	00 00 00 
+  8037d2:	41 ff d1             	call   *%r9
+
+00000000008037d5 <sys_region_batch>:
+
+int
+sys_region_batch(const struct RegionOp *ops, size_t count) {
+  8037d5:	55                   	push   %rbp
+  8037d6:	48 89 e5             	mov    %rsp,%rbp
+  8037d9:	53                   	push   %rbx
+  8037da:	48 83 ec 08          	sub    $0x8,%rsp
+  8037de:	48 89 fa             	mov    %rdi,%rdx
+  8037e1:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8037e4:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8037e9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8037ee:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8037f3:	be 00 00 00 00       	mov    $0x0,%esi
+  8037f8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8037fe:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  803800:	48 85 c0             	test   %rax,%rax
+  803803:	7f 06                	jg     80380b <sys_region_batch+0x36>
+        else
+            platform_asan_unpoison(va, ops[i].size);
+    }
+#endif
+    return res;
+}
+  803805:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803809:	c9                   	leave
+  80380a:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80380b:	49 89 c0             	mov    %rax,%r8
+  80380e:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  803813:	48 ba d0 5f 80 00 00 	movabs $0x805fd0,%rdx
+  80381a:	00 00 00 
+  80381d:	be 26 00 00 00       	mov    $0x26,%esi
+  803822:	48 bf ef 5f 80 00 00 	movabs $0x805fef,%rdi
+  803829:	00 00 00 
+  80382c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803831:	49 b9 7d 26 80 00 00 	movabs $0x80267d,%r9
+  803838:	00 00 00 
+  80383b:	41 ff d1             	call   *%r9
+
+000000000080383e <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  80383e:	55                   	push   %rbp
+  80383f:	48 89 e5             	mov    %rsp,%rbp
+  803842:	53                   	push   %rbx
+  803843:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  803847:	48 63 ce             	movslq %esi,%rcx
+  80384a:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80384d:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  803852:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803857:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80385c:	be 00 00 00 00       	mov    $0x0,%esi
+  803861:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  803867:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  803869:	48 85 c0             	test   %rax,%rax
+  80386c:	7f 06                	jg     803874 <sys_env_set_status+0x36>
+}
+  80386e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803872:	c9                   	leave
+  803873:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  803874:	49 89 c0             	mov    %rax,%r8
+  803877:	b9 09 00 00 00       	mov    $0x9,%ecx
+  80387c:	48 ba d0 5f 80 00 00 	movabs $0x805fd0,%rdx
+  803883:	00 00 00 
+  803886:	be 26 00 00 00       	mov    $0x26,%esi
+  80388b:	48 bf ef 5f 80 00 00 	movabs $0x805fef,%rdi
+  803892:	00 00 00 
+  803895:	b8 00 00 00 00       	mov    $0x0,%eax
+  80389a:	49 b9 7d 26 80 00 00 	movabs $0x80267d,%r9
+  8038a1:	00 00 00 
+  8038a4:	41 ff d1             	call   *%r9
+
+00000000008038a7 <sys_env_set_weight>:
+
+int
+sys_env_set_weight(envid_t envid, uint32_t weight) {
+  8038a7:	55                   	push   %rbp
+  8038a8:	48 89 e5             	mov    %rsp,%rbp
+  8038ab:	53                   	push   %rbx
+  8038ac:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_weight, 1, envid, weight, 0, 0, 0, 0);
+  8038b0:	89 f1                	mov    %esi,%ecx
+  8038b2:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8038b5:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8038ba:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8038bf:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8038c4:	be 00 00 00 00       	mov    $0x0,%esi
+  8038c9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8038cf:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8038d1:	48 85 c0             	test   %rax,%rax
+  8038d4:	7f 06                	jg     8038dc <sys_env_set_weight+0x35>
+}
+  8038d6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8038da:	c9                   	leave
+  8038db:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8038dc:	49 89 c0             	mov    %rax,%r8
+  8038df:	b9 10 00 00 00       	mov    $0x10,%ecx
+  8038e4:	48 ba d0 5f 80 00 00 	movabs $0x805fd0,%rdx
+  8038eb:	00 00 00 
+  8038ee:	be 26 00 00 00       	mov    $0x26,%esi
+  8038f3:	48 bf ef 5f 80 00 00 	movabs $0x805fef,%rdi
+  8038fa:	00 00 00 
+  8038fd:	b8 00 00 00 00       	mov    $0x0,%eax
+  803902:	49 b9 7d 26 80 00 00 	movabs $0x80267d,%r9
+  803909:	00 00 00 
+  80390c:	41 ff d1             	call   *%r9
+
+000000000080390f <sys_env_set_rt>:
+
+int
+sys_env_set_rt(envid_t envid, uint64_t period, uint64_t budget, uint64_t deadline) {
+  80390f:	55                   	push   %rbp
+  803910:	48 89 e5             	mov    %rsp,%rbp
+  803913:	53                   	push   %rbx
+  803914:	48 83 ec 08          	sub    $0x8,%rsp
+  803918:	89 f8                	mov    %edi,%eax
+  80391a:	48 89 d3             	mov    %rdx,%rbx
+  80391d:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_env_set_rt, 1, envid, period, budget, deadline, 0, 0);
+  803920:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  803923:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  803928:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80392b:	be 00 00 00 00       	mov    $0x0,%esi
+  803930:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  803936:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  803938:	48 85 c0             	test   %rax,%rax
+  80393b:	7f 06                	jg     803943 <sys_env_set_rt+0x34>
+}
+  80393d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803941:	c9                   	leave
+  803942:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  803943:	49 89 c0             	mov    %rax,%r8
+  803946:	b9 11 00 00 00       	mov    $0x11,%ecx
+  80394b:	48 ba d0 5f 80 00 00 	movabs $0x805fd0,%rdx
+  803952:	00 00 00 
+  803955:	be 26 00 00 00       	mov    $0x26,%esi
+  80395a:	48 bf ef 5f 80 00 00 	movabs $0x805fef,%rdi
+  803961:	00 00 00 
+  803964:	b8 00 00 00 00       	mov    $0x0,%eax
+  803969:	49 b9 7d 26 80 00 00 	movabs $0x80267d,%r9
+  803970:	00 00 00 
+  803973:	41 ff d1             	call   *%r9
+
+0000000000803976 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  803976:	55                   	push   %rbp
+  803977:	48 89 e5             	mov    %rsp,%rbp
+  80397a:	53                   	push   %rbx
+  80397b:	48 83 ec 08          	sub    $0x8,%rsp
+  80397f:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  803982:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  803985:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80398a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80398f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  803994:	be 00 00 00 00       	mov    $0x0,%esi
+  803999:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80399f:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8039a1:	48 85 c0             	test   %rax,%rax
+  8039a4:	7f 06                	jg     8039ac <sys_env_set_trapframe+0x36>
+}
+  8039a6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8039aa:	c9                   	leave
+  8039ab:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8039ac:	49 89 c0             	mov    %rax,%r8
+  8039af:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  8039b4:	48 ba d0 5f 80 00 00 	movabs $0x805fd0,%rdx
+  8039bb:	00 00 00 
+  8039be:	be 26 00 00 00       	mov    $0x26,%esi
+  8039c3:	48 bf ef 5f 80 00 00 	movabs $0x805fef,%rdi
+  8039ca:	00 00 00 
+  8039cd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8039d2:	49 b9 7d 26 80 00 00 	movabs $0x80267d,%r9
+  8039d9:	00 00 00 
+  8039dc:	41 ff d1             	call   *%r9
+
+00000000008039df <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  8039df:	55                   	push   %rbp
+  8039e0:	48 89 e5             	mov    %rsp,%rbp
+  8039e3:	53                   	push   %rbx
+  8039e4:	48 83 ec 08          	sub    $0x8,%rsp
+  8039e8:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  8039eb:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8039ee:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8039f3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8039f8:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8039fd:	be 00 00 00 00       	mov    $0x0,%esi
+  803a02:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  803a08:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  803a0a:	48 85 c0             	test   %rax,%rax
+  803a0d:	7f 06                	jg     803a15 <sys_env_set_pgfault_upcall+0x36>
+}
+  803a0f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803a13:	c9                   	leave
+  803a14:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  803a15:	49 89 c0             	mov    %rax,%r8
+  803a18:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  803a1d:	48 ba d0 5f 80 00 00 	movabs $0x805fd0,%rdx
+  803a24:	00 00 00 
+  803a27:	be 26 00 00 00       	mov    $0x26,%esi
+  803a2c:	48 bf ef 5f 80 00 00 	movabs $0x805fef,%rdi
+  803a33:	00 00 00 
+  803a36:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a3b:	49 b9 7d 26 80 00 00 	movabs $0x80267d,%r9
+  803a42:	00 00 00 
+  803a45:	41 ff d1             	call   *%r9
+
+0000000000803a48 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  803a48:	55                   	push   %rbp
+  803a49:	48 89 e5             	mov    %rsp,%rbp
+  803a4c:	53                   	push   %rbx
+  803a4d:	89 f8                	mov    %edi,%eax
+  803a4f:	49 89 f1             	mov    %rsi,%r9
+  803a52:	48 89 d3             	mov    %rdx,%rbx
+  803a55:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  803a58:	49 63 f0             	movslq %r8d,%rsi
+  803a5b:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  803a5e:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  803a63:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  803a66:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  803a6c:	cd 30                	int    $0x30
+}
+  803a6e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803a72:	c9                   	leave
+  803a73:	c3                   	ret
+
+0000000000803a74 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  803a74:	55                   	push   %rbp
+  803a75:	48 89 e5             	mov    %rsp,%rbp
+  803a78:	53                   	push   %rbx
+  803a79:	48 83 ec 08          	sub    $0x8,%rsp
+  803a7d:	48 89 fa             	mov    %rdi,%rdx
+  803a80:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  803a83:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  803a88:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803a8d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  803a92:	be 00 00 00 00       	mov    $0x0,%esi
+  803a97:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  803a9d:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  803a9f:	48 85 c0             	test   %rax,%rax
+  803aa2:	7f 06                	jg     803aaa <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  803aa4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803aa8:	c9                   	leave
+  803aa9:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  803aaa:	49 89 c0             	mov    %rax,%r8
+  803aad:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  803ab2:	48 ba d0 5f 80 00 00 	movabs $0x805fd0,%rdx
+  803ab9:	00 00 00 
+  803abc:	be 26 00 00 00       	mov    $0x26,%esi
+  803ac1:	48 bf ef 5f 80 00 00 	movabs $0x805fef,%rdi
+  803ac8:	00 00 00 
+  803acb:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ad0:	49 b9 7d 26 80 00 00 	movabs $0x80267d,%r9
+  803ad7:	00 00 00 
+  803ada:	41 ff d1             	call   *%r9
+
+0000000000803add <_handle_vectored_pagefault>:
+/* Vector size */
+static size_t _pfhandler_off = 0;
+static bool _pfhandler_inititiallized = 0;
+
+void
+_handle_vectored_pagefault(struct UTrapframe *utf) {
+  803add:	55                   	push   %rbp
+  803ade:	48 89 e5             	mov    %rsp,%rbp
+  803ae1:	41 56                	push   %r14
+  803ae3:	41 55                	push   %r13
+  803ae5:	41 54                	push   %r12
+  803ae7:	53                   	push   %rbx
+  803ae8:	49 89 fc             	mov    %rdi,%r12
+    /* This trying to handle pagefault until
+     * some handler returns 1, that indicates
+     * successfully handled exception */
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  803aeb:	48 b8 68 c0 80 00 00 	movabs $0x80c068,%rax
+  803af2:	00 00 00 
+  803af5:	48 83 38 00          	cmpq   $0x0,(%rax)
+  803af9:	74 27                	je     803b22 <_handle_vectored_pagefault+0x45>
+  803afb:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (_pfhandler_vec[i](utf)) return;
+  803b00:	49 bd 20 c0 80 00 00 	movabs $0x80c020,%r13
+  803b07:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  803b0a:	49 89 c6             	mov    %rax,%r14
+        if (_pfhandler_vec[i](utf)) return;
+  803b0d:	4c 89 e7             	mov    %r12,%rdi
+  803b10:	41 ff 54 dd 00       	call   *0x0(%r13,%rbx,8)
+  803b15:	84 c0                	test   %al,%al
+  803b17:	75 45                	jne    803b5e <_handle_vectored_pagefault+0x81>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  803b19:	48 83 c3 01          	add    $0x1,%rbx
+  803b1d:	49 3b 1e             	cmp    (%r14),%rbx
+  803b20:	72 eb                	jb     803b0d <_handle_vectored_pagefault+0x30>
+
+    /* Unhandled exceptions just cause panic */
+    panic("Userspace page fault rip=%08lX va=%08lX err=%x\n",
+  803b22:	49 8b 8c 24 88 00 00 	mov    0x88(%r12),%rcx
+  803b29:	00 
+  803b2a:	45 8b 4c 24 08       	mov    0x8(%r12),%r9d
+  803b2f:	4d 8b 04 24          	mov    (%r12),%r8
+  803b33:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  803b3a:	00 00 00 
+  803b3d:	be 1d 00 00 00       	mov    $0x1d,%esi
+  803b42:	48 bf 30 60 80 00 00 	movabs $0x806030,%rdi
+  803b49:	00 00 00 
+  803b4c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b51:	49 ba 7d 26 80 00 00 	movabs $0x80267d,%r10
+  803b58:	00 00 00 
+  803b5b:	41 ff d2             	call   *%r10
+          utf->utf_rip, utf->utf_fault_va, (int)utf->utf_err);
+}
+  803b5e:	5b                   	pop    %rbx
+  803b5f:	41 5c                	pop    %r12
+  803b61:	41 5d                	pop    %r13
+  803b63:	41 5e                	pop    %r14
+  803b65:	5d                   	pop    %rbp
+  803b66:	c3                   	ret
+
+0000000000803b67 <add_pgfault_handler>:
+ * The first time we register a handler, we need to
+ * allocate an exception stack (one page of memory with its top
+ * at USER_EXCEPTION_STACK_TOP), and tell the kernel to call the assembly-language
+ * _pgfault_upcall routine when a page fault occurs. */
+int
+add_pgfault_handler(pf_handler_t handler) {
+  803b67:	55                   	push   %rbp
+  803b68:	48 89 e5             	mov    %rsp,%rbp
+  803b6b:	53                   	push   %rbx
+  803b6c:	48 83 ec 08          	sub    $0x8,%rsp
+  803b70:	48 89 fb             	mov    %rdi,%rbx
+    int res = 0;
+  803b73:	be 00 00 00 00       	mov    $0x0,%esi
+    if (!_pfhandler_inititiallized) {
+  803b78:	48 b8 60 c0 80 00 00 	movabs $0x80c060,%rax
+  803b7f:	00 00 00 
+  803b82:	80 38 00             	cmpb   $0x0,(%rax)
+  803b85:	74 68                	je     803bef <add_pgfault_handler+0x88>
+            goto end;
+        }
+        _pfhandler_inititiallized = 1;
+    }
+
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  803b87:	48 b8 68 c0 80 00 00 	movabs $0x80c068,%rax
+  803b8e:	00 00 00 
+  803b91:	48 8b 08             	mov    (%rax),%rcx
+  803b94:	ba 00 00 00 00       	mov    $0x0,%edx
+        if (handler == _pfhandler_vec[i]) return 0;
+  803b99:	48 b8 20 c0 80 00 00 	movabs $0x80c020,%rax
+  803ba0:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  803ba3:	48 85 c9             	test   %rcx,%rcx
+  803ba6:	0f 84 e0 00 00 00    	je     803c8c <add_pgfault_handler+0x125>
+        if (handler == _pfhandler_vec[i]) return 0;
+  803bac:	48 39 1c d0          	cmp    %rbx,(%rax,%rdx,8)
+  803bb0:	0f 84 c9 00 00 00    	je     803c7f <add_pgfault_handler+0x118>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  803bb6:	48 83 c2 01          	add    $0x1,%rdx
+  803bba:	48 39 ca             	cmp    %rcx,%rdx
+  803bbd:	75 ed                	jne    803bac <add_pgfault_handler+0x45>
+
+    if (_pfhandler_off == MAX_PFHANDLER)
+  803bbf:	48 83 f9 08          	cmp    $0x8,%rcx
+  803bc3:	0f 84 84 00 00 00    	je     803c4d <add_pgfault_handler+0xe6>
+        res = -E_INVAL;
+    else
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  803bc9:	48 8d 41 01          	lea    0x1(%rcx),%rax
+  803bcd:	48 a3 68 c0 80 00 00 	movabs %rax,0x80c068
+  803bd4:	00 00 00 
+  803bd7:	48 b8 20 c0 80 00 00 	movabs $0x80c020,%rax
+  803bde:	00 00 00 
+  803be1:	48 89 1c c8          	mov    %rbx,(%rax,%rcx,8)
+
+end:
+    if (res < 0) {
+  803be5:	85 f6                	test   %esi,%esi
+  803be7:	0f 89 97 00 00 00    	jns    803c84 <add_pgfault_handler+0x11d>
+  803bed:	eb 63                	jmp    803c52 <add_pgfault_handler+0xeb>
+        res = sys_alloc_region(0, (void*)(USER_EXCEPTION_STACK_TOP - USER_EXCEPTION_STACK_SIZE),
+  803bef:	b9 06 00 10 00       	mov    $0x100006,%ecx
+  803bf4:	ba 00 80 00 00       	mov    $0x8000,%edx
+  803bf9:	48 be 00 80 ff ff 7f 	movabs $0x7fffff8000,%rsi
+  803c00:	00 00 00 
+  803c03:	bf 00 00 00 00       	mov    $0x0,%edi
+  803c08:	48 b8 a2 36 80 00 00 	movabs $0x8036a2,%rax
+  803c0f:	00 00 00 
+  803c12:	ff d0                	call   *%rax
+  803c14:	89 c6                	mov    %eax,%esi
+        if (res < 0) {
+  803c16:	85 c0                	test   %eax,%eax
+  803c18:	78 38                	js     803c52 <add_pgfault_handler+0xeb>
+        res = sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  803c1a:	48 be 68 3d 80 00 00 	movabs $0x803d68,%rsi
+  803c21:	00 00 00 
+  803c24:	bf 00 00 00 00       	mov    $0x0,%edi
+  803c29:	48 b8 df 39 80 00 00 	movabs $0x8039df,%rax
+  803c30:	00 00 00 
+  803c33:	ff d0                	call   *%rax
+  803c35:	89 c6                	mov    %eax,%esi
+        if (res < 0) {
+  803c37:	85 c0                	test   %eax,%eax
+  803c39:	78 17                	js     803c52 <add_pgfault_handler+0xeb>
+        _pfhandler_inititiallized = 1;
+  803c3b:	48 b8 60 c0 80 00 00 	movabs $0x80c060,%rax
+  803c42:	00 00 00 
+  803c45:	c6 00 01             	movb   $0x1,(%rax)
+  803c48:	e9 3a ff ff ff       	jmp    803b87 <add_pgfault_handler+0x20>
+        res = -E_INVAL;
+  803c4d:	be fd ff ff ff       	mov    $0xfffffffd,%esi
+        panic("set_pgfault_handler: %i", res);
+  803c52:	89 f1                	mov    %esi,%ecx
+  803c54:	48 ba 3e 60 80 00 00 	movabs $0x80603e,%rdx
+  803c5b:	00 00 00 
+  803c5e:	be 43 00 00 00       	mov    $0x43,%esi
+  803c63:	48 bf 30 60 80 00 00 	movabs $0x806030,%rdi
+  803c6a:	00 00 00 
+  803c6d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803c72:	49 b8 7d 26 80 00 00 	movabs $0x80267d,%r8
+  803c79:	00 00 00 
+  803c7c:	41 ff d0             	call   *%r8
+        if (handler == _pfhandler_vec[i]) return 0;
+  803c7f:	be 00 00 00 00       	mov    $0x0,%esi
+    }
+    return res;
+}
+  803c84:	89 f0                	mov    %esi,%eax
+  803c86:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803c8a:	c9                   	leave
+  803c8b:	c3                   	ret
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  803c8c:	48 b8 68 c0 80 00 00 	movabs $0x80c068,%rax
+  803c93:	00 00 00 
+  803c96:	48 c7 00 01 00 00 00 	movq   $0x1,(%rax)
+  803c9d:	48 89 d8             	mov    %rbx,%rax
+  803ca0:	48 a3 20 c0 80 00 00 	movabs %rax,0x80c020
+  803ca7:	00 00 00 
+    if (res < 0) {
+  803caa:	eb d8                	jmp    803c84 <add_pgfault_handler+0x11d>
+
+0000000000803cac <remove_pgfault_handler>:
+
+void
+remove_pgfault_handler(pf_handler_t handler) {
+  803cac:	55                   	push   %rbp
+  803cad:	48 89 e5             	mov    %rsp,%rbp
+    assert(_pfhandler_inititiallized);
+  803cb0:	48 b8 60 c0 80 00 00 	movabs $0x80c060,%rax
+  803cb7:	00 00 00 
+  803cba:	80 38 00             	cmpb   $0x0,(%rax)
+  803cbd:	74 33                	je     803cf2 <remove_pgfault_handler+0x46>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  803cbf:	48 a1 68 c0 80 00 00 	movabs 0x80c068,%rax
+  803cc6:	00 00 00 
+  803cc9:	b9 00 00 00 00       	mov    $0x0,%ecx
+        if (_pfhandler_vec[i] == handler) {
+  803cce:	48 ba 20 c0 80 00 00 	movabs $0x80c020,%rdx
+  803cd5:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  803cd8:	48 85 c0             	test   %rax,%rax
+  803cdb:	0f 84 85 00 00 00    	je     803d66 <remove_pgfault_handler+0xba>
+        if (_pfhandler_vec[i] == handler) {
+  803ce1:	48 39 3c ca          	cmp    %rdi,(%rdx,%rcx,8)
+  803ce5:	74 40                	je     803d27 <remove_pgfault_handler+0x7b>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  803ce7:	48 83 c1 01          	add    $0x1,%rcx
+  803ceb:	48 39 c1             	cmp    %rax,%rcx
+  803cee:	75 f1                	jne    803ce1 <remove_pgfault_handler+0x35>
+  803cf0:	eb 74                	jmp    803d66 <remove_pgfault_handler+0xba>
+    assert(_pfhandler_inititiallized);
+  803cf2:	48 b9 56 60 80 00 00 	movabs $0x806056,%rcx
+  803cf9:	00 00 00 
+  803cfc:	48 ba 1d 55 80 00 00 	movabs $0x80551d,%rdx
+  803d03:	00 00 00 
+  803d06:	be 4a 00 00 00       	mov    $0x4a,%esi
+  803d0b:	48 bf 30 60 80 00 00 	movabs $0x806030,%rdi
+  803d12:	00 00 00 
+  803d15:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d1a:	49 b8 7d 26 80 00 00 	movabs $0x80267d,%r8
+  803d21:	00 00 00 
+  803d24:	41 ff d0             	call   *%r8
+            memmove(_pfhandler_vec + i, _pfhandler_vec + i + 1, (_pfhandler_off - i - 1) * sizeof(*handler));
+  803d27:	48 8d 34 cd 08 00 00 	lea    0x8(,%rcx,8),%rsi
+  803d2e:	00 
+  803d2f:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  803d33:	48 29 ca             	sub    %rcx,%rdx
+  803d36:	48 b8 20 c0 80 00 00 	movabs $0x80c020,%rax
+  803d3d:	00 00 00 
+  803d40:	48 8d 0c 06          	lea    (%rsi,%rax,1),%rcx
+  803d44:	48 8d 7c 30 f8       	lea    -0x8(%rax,%rsi,1),%rdi
+  803d49:	48 89 ce             	mov    %rcx,%rsi
+  803d4c:	48 b8 ec 32 80 00 00 	movabs $0x8032ec,%rax
+  803d53:	00 00 00 
+  803d56:	ff d0                	call   *%rax
+            _pfhandler_off--;
+  803d58:	48 b8 68 c0 80 00 00 	movabs $0x80c068,%rax
+  803d5f:	00 00 00 
+  803d62:	48 83 28 01          	subq   $0x1,(%rax)
+            return;
+        }
+    }
+}
+  803d66:	5d                   	pop    %rbp
+  803d67:	c3                   	ret
+
+0000000000803d68 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+    # Call the C page fault handler.
+    movq  %rsp,%rdi # passing the function argument in rdi
+  803d68:	48 89 e7             	mov    %rsp,%rdi
+    movabs $_handle_vectored_pagefault, %rax
+  803d6b:	48 b8 dd 3a 80 00 00 	movabs $0x803add,%rax
+  803d72:	00 00 00 
+    call *%rax
+  803d75:	ff d0                	call   *%rax
+    # registers are available for intermediate calculations.  You
+    # may find that you have to rearrange your code in non-obvious
+    # ways as registers become unavailable as scratch space.
+
+    # LAB 9: Your code here
+    addq $16, %rsp
+  803d77:	48 83 c4 10          	add    $0x10,%rsp
+	movq %rsp, %rax
+  803d7b:	48 89 e0             	mov    %rsp,%rax
+	movq 120(%rsp), %rbx
+  803d7e:	48 8b 5c 24 78       	mov    0x78(%rsp),%rbx
+	movq 136(%rsp), %rcx
+  803d83:	48 8b 8c 24 88 00 00 	mov    0x88(%rsp),%rcx
+  803d8a:	00 
+	movq %rcx, %rsp
+  803d8b:	48 89 cc             	mov    %rcx,%rsp
+    pushq %rbx
+  803d8e:	53                   	push   %rbx
+    movq %rax, %rsp
+  803d8f:	48 89 c4             	mov    %rax,%rsp
+
+	subq $8, %rcx
+  803d92:	48 83 e9 08          	sub    $0x8,%rcx
+	movq %rcx, 136(%rsp)
+  803d96:	48 89 8c 24 88 00 00 	mov    %rcx,0x88(%rsp)
+  803d9d:	00 
+
+    # Restore the trap-time registers.  After you do this, you
+    # can no longer modify any general-purpose registers (POPA).
+    # LAB 9: Your code here
+
+    pop %r15
+  803d9e:	41 5f                	pop    %r15
+    pop %r14
+  803da0:	41 5e                	pop    %r14
+    pop %r13
+  803da2:	41 5d                	pop    %r13
+    pop %r12
+  803da4:	41 5c                	pop    %r12
+    pop %r11
+  803da6:	41 5b                	pop    %r11
+    pop %r10
+  803da8:	41 5a                	pop    %r10
+    pop %r9
+  803daa:	41 59                	pop    %r9
+    pop %r8
+  803dac:	41 58                	pop    %r8
+    pop %rsi
+  803dae:	5e                   	pop    %rsi
+    pop %rdi
+  803daf:	5f                   	pop    %rdi
+    pop %rbp
+  803db0:	5d                   	pop    %rbp
+    pop %rdx
+  803db1:	5a                   	pop    %rdx
+    pop %rcx
+  803db2:	59                   	pop    %rcx
+    pop %rbx
+  803db3:	5b                   	pop    %rbx
+    pop %rax
+  803db4:	58                   	pop    %rax
+    # Restore rflags from the stack.  After you do this, you can
+    # no longer use arithmetic operations or anything else that
+    # modifies rflags.
+    # LAB 9: Your code here
+
+    addq $8, %rsp
+  803db5:	48 83 c4 08          	add    $0x8,%rsp
+    popfq
+  803db9:	9d                   	popf
+
+    # Switch back to the adjusted trap-time stack.
+    # LAB 9: Your code here
+
+    pop %rsp
+  803dba:	5c                   	pop    %rsp
+
+    # Return to re-execute the instruction that faulted.
+    ret
+  803dbb:	c3                   	ret
+
+0000000000803dbc <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  803dbc:	55                   	push   %rbp
+  803dbd:	48 89 e5             	mov    %rsp,%rbp
+  803dc0:	41 55                	push   %r13
+  803dc2:	41 54                	push   %r12
+  803dc4:	53                   	push   %rbx
+  803dc5:	48 83 ec 08          	sub    $0x8,%rsp
+  803dc9:	49 89 fc             	mov    %rdi,%r12
+  803dcc:	48 89 f7             	mov    %rsi,%rdi
+  803dcf:	48 89 d3             	mov    %rdx,%rbx
+  803dd2:	49 89 cd             	mov    %rcx,%r13
+    // LAB 9: Your code here:
+    int res = sys_ipc_recv(!pg ? (void*)MAX_USER_ADDRESS : pg, !size ? 0 : *size);
+  803dd5:	be 00 00 00 00       	mov    $0x0,%esi
+  803dda:	48 85 d2             	test   %rdx,%rdx
+  803ddd:	74 03                	je     803de2 <ipc_recv+0x26>
+  803ddf:	48 8b 32             	mov    (%rdx),%rsi
+  803de2:	48 85 ff             	test   %rdi,%rdi
+  803de5:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803dec:	00 00 00 
+  803def:	48 0f 44 f8          	cmove  %rax,%rdi
+  803df3:	48 b8 74 3a 80 00 00 	movabs $0x803a74,%rax
+  803dfa:	00 00 00 
+  803dfd:	ff d0                	call   *%rax
+    if (res < 0) {
+  803dff:	85 c0                	test   %eax,%eax
+  803e01:	78 66                	js     803e69 <ipc_recv+0xad>
+        if (size) {
+            *size = 0;
+        }
+        return res;
+    }
+    if (from_env_store) {
+  803e03:	4d 85 e4             	test   %r12,%r12
+  803e06:	74 14                	je     803e1c <ipc_recv+0x60>
+        *from_env_store = thisenv->env_ipc_from;
+  803e08:	48 a1 10 c0 80 00 00 	movabs 0x80c010,%rax
+  803e0f:	00 00 00 
+  803e12:	8b 80 ac 01 00 00    	mov    0x1ac(%rax),%eax
+  803e18:	41 89 04 24          	mov    %eax,(%r12)
+    }
+    if (perm_store) {
+  803e1c:	4d 85 ed             	test   %r13,%r13
+  803e1f:	74 14                	je     803e35 <ipc_recv+0x79>
+        *perm_store = thisenv->env_ipc_perm;
+  803e21:	48 a1 10 c0 80 00 00 	movabs 0x80c010,%rax
+  803e28:	00 00 00 
+  803e2b:	8b 80 b0 01 00 00    	mov    0x1b0(%rax),%eax
+  803e31:	41 89 45 00          	mov    %eax,0x0(%r13)
+    }
+    if (size) {
+  803e35:	48 85 db             	test   %rbx,%rbx
+  803e38:	74 14                	je     803e4e <ipc_recv+0x92>
+        *size = thisenv->env_ipc_maxsz;
+  803e3a:	48 a1 10 c0 80 00 00 	movabs 0x80c010,%rax
+  803e41:	00 00 00 
+  803e44:	48 8b 80 a0 01 00 00 	mov    0x1a0(%rax),%rax
+  803e4b:	48 89 03             	mov    %rax,(%rbx)
+    }
+    return thisenv->env_ipc_value;
+  803e4e:	48 a1 10 c0 80 00 00 	movabs 0x80c010,%rax
+  803e55:	00 00 00 
+  803e58:	8b 80 a8 01 00 00    	mov    0x1a8(%rax),%eax
+}
+  803e5e:	48 83 c4 08          	add    $0x8,%rsp
+  803e62:	5b                   	pop    %rbx
+  803e63:	41 5c                	pop    %r12
+  803e65:	41 5d                	pop    %r13
+  803e67:	5d                   	pop    %rbp
+  803e68:	c3                   	ret
+        if (from_env_store) {
+  803e69:	4d 85 e4             	test   %r12,%r12
+  803e6c:	74 08                	je     803e76 <ipc_recv+0xba>
+            *from_env_store = 0;
+  803e6e:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  803e75:	00 
+        if (perm_store) {
+  803e76:	4d 85 ed             	test   %r13,%r13
+  803e79:	74 08                	je     803e83 <ipc_recv+0xc7>
+            *perm_store = 0;
+  803e7b:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  803e82:	00 
+        if (size) {
+  803e83:	48 85 db             	test   %rbx,%rbx
+  803e86:	74 d6                	je     803e5e <ipc_recv+0xa2>
+            *size = 0;
+  803e88:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  803e8f:	eb cd                	jmp    803e5e <ipc_recv+0xa2>
+
+0000000000803e91 <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  803e91:	55                   	push   %rbp
+  803e92:	48 89 e5             	mov    %rsp,%rbp
+  803e95:	41 57                	push   %r15
+  803e97:	41 56                	push   %r14
+  803e99:	41 55                	push   %r13
+  803e9b:	41 54                	push   %r12
+  803e9d:	53                   	push   %rbx
+  803e9e:	48 83 ec 18          	sub    $0x18,%rsp
+  803ea2:	41 89 fd             	mov    %edi,%r13d
+  803ea5:	89 75 cc             	mov    %esi,-0x34(%rbp)
+  803ea8:	49 89 cc             	mov    %rcx,%r12
+  803eab:	44 89 45 c8          	mov    %r8d,-0x38(%rbp)
+    // LAB 9: Your code here:
+    int res = 0;
+    while ((res = sys_ipc_try_send(to_env, val, !pg ? (void*)MAX_USER_ADDRESS : pg, size, perm)) < 0) {
+  803eaf:	48 85 d2             	test   %rdx,%rdx
+  803eb2:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803eb9:	00 00 00 
+  803ebc:	48 0f 45 c2          	cmovne %rdx,%rax
+  803ec0:	48 89 c3             	mov    %rax,%rbx
+  803ec3:	49 be 48 3a 80 00 00 	movabs $0x803a48,%r14
+  803eca:	00 00 00 
+        if (res != -E_IPC_NOT_RECV) {
+            panic("sys_ipc_try_send failed: %i", res);
+        }
+        sys_yield();
+  803ecd:	49 bf 13 36 80 00 00 	movabs $0x803613,%r15
+  803ed4:	00 00 00 
+    while ((res = sys_ipc_try_send(to_env, val, !pg ? (void*)MAX_USER_ADDRESS : pg, size, perm)) < 0) {
+  803ed7:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  803eda:	44 8b 45 c8          	mov    -0x38(%rbp),%r8d
+  803ede:	4c 89 e1             	mov    %r12,%rcx
+  803ee1:	48 89 da             	mov    %rbx,%rdx
+  803ee4:	44 89 ef             	mov    %r13d,%edi
+  803ee7:	41 ff d6             	call   *%r14
+  803eea:	85 c0                	test   %eax,%eax
+  803eec:	79 37                	jns    803f25 <ipc_send+0x94>
+        if (res != -E_IPC_NOT_RECV) {
+  803eee:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  803ef1:	75 05                	jne    803ef8 <ipc_send+0x67>
+        sys_yield();
+  803ef3:	41 ff d7             	call   *%r15
+  803ef6:	eb df                	jmp    803ed7 <ipc_send+0x46>
+            panic("sys_ipc_try_send failed: %i", res);
+  803ef8:	89 c1                	mov    %eax,%ecx
+  803efa:	48 ba 70 60 80 00 00 	movabs $0x806070,%rdx
+  803f01:	00 00 00 
+  803f04:	be 40 00 00 00       	mov    $0x40,%esi
+  803f09:	48 bf 8c 60 80 00 00 	movabs $0x80608c,%rdi
+  803f10:	00 00 00 
+  803f13:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f18:	49 b8 7d 26 80 00 00 	movabs $0x80267d,%r8
+  803f1f:	00 00 00 
+  803f22:	41 ff d0             	call   *%r8
+    }
+    return;
+}
+  803f25:	48 83 c4 18          	add    $0x18,%rsp
+  803f29:	5b                   	pop    %rbx
+  803f2a:	41 5c                	pop    %r12
+  803f2c:	41 5d                	pop    %r13
+  803f2e:	41 5e                	pop    %r14
+  803f30:	41 5f                	pop    %r15
+  803f32:	5d                   	pop    %rbp
+  803f33:	c3                   	ret
+
+0000000000803f34 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  803f34:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  803f39:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  803f40:	00 00 00 
+  803f43:	48 69 d0 d0 01 00 00 	imul   $0x1d0,%rax,%rdx
+  803f4a:	48 01 ca             	add    %rcx,%rdx
+  803f4d:	8b 92 e8 00 00 00    	mov    0xe8(%rdx),%edx
+  803f53:	39 fa                	cmp    %edi,%edx
+  803f55:	74 12                	je     803f69 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  803f57:	48 83 c0 01          	add    $0x1,%rax
+  803f5b:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  803f61:	75 e0                	jne    803f43 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  803f63:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803f68:	c3                   	ret
+            return envs[i].env_id;
+  803f69:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+  803f70:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  803f77:	00 00 00 
+  803f7a:	48 01 d0             	add    %rdx,%rax
+  803f7d:	8b 80 e0 00 00 00    	mov    0xe0(%rax),%eax
+  803f83:	c3                   	ret
+
+0000000000803f84 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  803f84:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  803f8b:	ff ff ff 
+  803f8e:	48 01 f8             	add    %rdi,%rax
+  803f91:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  803f95:	c3                   	ret
+
+0000000000803f96 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  803f96:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  803f9d:	ff ff ff 
+  803fa0:	48 01 f8             	add    %rdi,%rax
+  803fa3:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  803fa7:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  803fad:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  803fb1:	c3                   	ret
+
+0000000000803fb2 <fd_alloc_from>:
+}
+
+/* Like fd_alloc(), but only considers fds starting from fdnum,
+ * so that several fds can be found before their pages are allocated */
+int
+fd_alloc_from(int fdnum, struct Fd **fd_store) {
+  803fb2:	55                   	push   %rbp
+  803fb3:	48 89 e5             	mov    %rsp,%rbp
+  803fb6:	41 57                	push   %r15
+  803fb8:	41 56                	push   %r14
+  803fba:	41 55                	push   %r13
+  803fbc:	41 54                	push   %r12
+  803fbe:	53                   	push   %rbx
+  803fbf:	48 83 ec 08          	sub    $0x8,%rsp
+  803fc3:	49 89 f7             	mov    %rsi,%r15
+    for (int i = MAX(fdnum, 0); i < MAXFD; i++) {
+  803fc6:	85 ff                	test   %edi,%edi
+  803fc8:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  803fce:	44 0f 49 e7          	cmovns %edi,%r12d
+  803fd2:	83 ff 1f             	cmp    $0x1f,%edi
+  803fd5:	7f 37                	jg     80400e <fd_alloc_from+0x5c>
+  803fd7:	49 63 dc             	movslq %r12d,%rbx
+  803fda:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  803fe1:	48 c1 e3 0c          	shl    $0xc,%rbx
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  803fe5:	49 be bb 50 80 00 00 	movabs $0x8050bb,%r14
+  803fec:	00 00 00 
+        struct Fd *fd = INDEX2FD(i);
+  803fef:	49 89 dd             	mov    %rbx,%r13
+        if (!(get_prot(fd) & PROT_R)) {
+  803ff2:	48 89 df             	mov    %rbx,%rdi
+  803ff5:	41 ff d6             	call   *%r14
+  803ff8:	83 e0 04             	and    $0x4,%eax
+  803ffb:	74 1c                	je     804019 <fd_alloc_from+0x67>
+    for (int i = MAX(fdnum, 0); i < MAXFD; i++) {
+  803ffd:	41 83 c4 01          	add    $0x1,%r12d
+  804001:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  804008:	41 83 fc 1f          	cmp    $0x1f,%r12d
+  80400c:	7e e1                	jle    803fef <fd_alloc_from+0x3d>
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  80400e:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  804014:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  804019:	4d 89 2f             	mov    %r13,(%r15)
+}
+  80401c:	48 83 c4 08          	add    $0x8,%rsp
+  804020:	5b                   	pop    %rbx
+  804021:	41 5c                	pop    %r12
+  804023:	41 5d                	pop    %r13
+  804025:	41 5e                	pop    %r14
+  804027:	41 5f                	pop    %r15
+  804029:	5d                   	pop    %rbp
+  80402a:	c3                   	ret
+
+000000000080402b <fd_alloc>:
+fd_alloc(struct Fd **fd_store) {
+  80402b:	55                   	push   %rbp
+  80402c:	48 89 e5             	mov    %rsp,%rbp
+  80402f:	48 89 fe             	mov    %rdi,%rsi
+    return fd_alloc_from(0, fd_store);
+  804032:	bf 00 00 00 00       	mov    $0x0,%edi
+  804037:	48 b8 b2 3f 80 00 00 	movabs $0x803fb2,%rax
+  80403e:	00 00 00 
+  804041:	ff d0                	call   *%rax
+}
+  804043:	5d                   	pop    %rbp
+  804044:	c3                   	ret
+
+0000000000804045 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  804045:	83 ff 1f             	cmp    $0x1f,%edi
+  804048:	77 39                	ja     804083 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  80404a:	55                   	push   %rbp
+  80404b:	48 89 e5             	mov    %rsp,%rbp
+  80404e:	41 54                	push   %r12
+  804050:	53                   	push   %rbx
+  804051:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  804054:	48 63 df             	movslq %edi,%rbx
+  804057:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  80405e:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  804062:	48 89 df             	mov    %rbx,%rdi
+  804065:	48 b8 bb 50 80 00 00 	movabs $0x8050bb,%rax
+  80406c:	00 00 00 
+  80406f:	ff d0                	call   *%rax
+  804071:	a8 04                	test   $0x4,%al
+  804073:	74 14                	je     804089 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  804075:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  804079:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80407e:	5b                   	pop    %rbx
+  80407f:	41 5c                	pop    %r12
+  804081:	5d                   	pop    %rbp
+  804082:	c3                   	ret
+        return -E_INVAL;
+  804083:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  804088:	c3                   	ret
+        return -E_INVAL;
+  804089:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80408e:	eb ee                	jmp    80407e <fd_lookup+0x39>
+
+0000000000804090 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  804090:	55                   	push   %rbp
+  804091:	48 89 e5             	mov    %rsp,%rbp
+  804094:	41 54                	push   %r12
+  804096:	53                   	push   %rbx
+  804097:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  80409a:	48 b8 20 61 80 00 00 	movabs $0x806120,%rax
+  8040a1:	00 00 00 
+  8040a4:	48 bb a0 b0 80 00 00 	movabs $0x80b0a0,%rbx
+  8040ab:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  8040ae:	39 3b                	cmp    %edi,(%rbx)
+  8040b0:	74 47                	je     8040f9 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  8040b2:	48 83 c0 08          	add    $0x8,%rax
+  8040b6:	48 8b 18             	mov    (%rax),%rbx
+  8040b9:	48 85 db             	test   %rbx,%rbx
+  8040bc:	75 f0                	jne    8040ae <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8040be:	48 a1 10 c0 80 00 00 	movabs 0x80c010,%rax
+  8040c5:	00 00 00 
+  8040c8:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+  8040ce:	89 fa                	mov    %edi,%edx
+  8040d0:	48 bf 98 60 80 00 00 	movabs $0x806098,%rdi
+  8040d7:	00 00 00 
+  8040da:	b8 00 00 00 00       	mov    $0x0,%eax
+  8040df:	48 b9 cd 27 80 00 00 	movabs $0x8027cd,%rcx
+  8040e6:	00 00 00 
+  8040e9:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  8040eb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  8040f0:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  8040f4:	5b                   	pop    %rbx
+  8040f5:	41 5c                	pop    %r12
+  8040f7:	5d                   	pop    %rbp
+  8040f8:	c3                   	ret
+            return 0;
+  8040f9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8040fe:	eb f0                	jmp    8040f0 <dev_lookup+0x60>
+
+0000000000804100 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  804100:	55                   	push   %rbp
+  804101:	48 89 e5             	mov    %rsp,%rbp
+  804104:	41 55                	push   %r13
+  804106:	41 54                	push   %r12
+  804108:	53                   	push   %rbx
+  804109:	48 83 ec 18          	sub    $0x18,%rsp
+  80410d:	48 89 fb             	mov    %rdi,%rbx
+  804110:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  804113:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  80411a:	ff ff ff 
+  80411d:	48 01 df             	add    %rbx,%rdi
+  804120:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  804124:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  804128:	48 b8 45 40 80 00 00 	movabs $0x804045,%rax
+  80412f:	00 00 00 
+  804132:	ff d0                	call   *%rax
+  804134:	41 89 c5             	mov    %eax,%r13d
+  804137:	85 c0                	test   %eax,%eax
+  804139:	78 06                	js     804141 <fd_close+0x41>
+  80413b:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  80413f:	74 1a                	je     80415b <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  804141:	45 84 e4             	test   %r12b,%r12b
+  804144:	b8 00 00 00 00       	mov    $0x0,%eax
+  804149:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  80414d:	44 89 e8             	mov    %r13d,%eax
+  804150:	48 83 c4 18          	add    $0x18,%rsp
+  804154:	5b                   	pop    %rbx
+  804155:	41 5c                	pop    %r12
+  804157:	41 5d                	pop    %r13
+  804159:	5d                   	pop    %rbp
+  80415a:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  80415b:	8b 3b                	mov    (%rbx),%edi
+  80415d:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  804161:	48 b8 90 40 80 00 00 	movabs $0x804090,%rax
+  804168:	00 00 00 
+  80416b:	ff d0                	call   *%rax
+  80416d:	41 89 c5             	mov    %eax,%r13d
+  804170:	85 c0                	test   %eax,%eax
+  804172:	78 1b                	js     80418f <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  804174:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804178:	48 8b 40 20          	mov    0x20(%rax),%rax
+  80417c:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  804182:	48 85 c0             	test   %rax,%rax
+  804185:	74 08                	je     80418f <fd_close+0x8f>
+  804187:	48 89 df             	mov    %rbx,%rdi
+  80418a:	ff d0                	call   *%rax
+  80418c:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  80418f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804194:	48 89 de             	mov    %rbx,%rsi
+  804197:	bf 00 00 00 00       	mov    $0x0,%edi
+  80419c:	48 b8 6e 37 80 00 00 	movabs $0x80376e,%rax
+  8041a3:	00 00 00 
+  8041a6:	ff d0                	call   *%rax
+    return res;
+  8041a8:	eb a3                	jmp    80414d <fd_close+0x4d>
+
+00000000008041aa <close>:
+
+int
+close(int fdnum) {
+  8041aa:	55                   	push   %rbp
+  8041ab:	48 89 e5             	mov    %rsp,%rbp
+  8041ae:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  8041b2:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8041b6:	48 b8 45 40 80 00 00 	movabs $0x804045,%rax
+  8041bd:	00 00 00 
+  8041c0:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8041c2:	85 c0                	test   %eax,%eax
+  8041c4:	78 15                	js     8041db <close+0x31>
+
+    return fd_close(fd, 1);
+  8041c6:	be 01 00 00 00       	mov    $0x1,%esi
+  8041cb:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8041cf:	48 b8 00 41 80 00 00 	movabs $0x804100,%rax
+  8041d6:	00 00 00 
+  8041d9:	ff d0                	call   *%rax
+}
+  8041db:	c9                   	leave
+  8041dc:	c3                   	ret
+
+00000000008041dd <close_all>:
+
+void
+close_all(void) {
+  8041dd:	55                   	push   %rbp
+  8041de:	48 89 e5             	mov    %rsp,%rbp
+  8041e1:	41 54                	push   %r12
+  8041e3:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  8041e4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8041e9:	49 bc aa 41 80 00 00 	movabs $0x8041aa,%r12
+  8041f0:	00 00 00 
+  8041f3:	89 df                	mov    %ebx,%edi
+  8041f5:	41 ff d4             	call   *%r12
+  8041f8:	83 c3 01             	add    $0x1,%ebx
+  8041fb:	83 fb 20             	cmp    $0x20,%ebx
+  8041fe:	75 f3                	jne    8041f3 <close_all+0x16>
+}
+  804200:	5b                   	pop    %rbx
+  804201:	41 5c                	pop    %r12
+  804203:	5d                   	pop    %rbp
+  804204:	c3                   	ret
+
+0000000000804205 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  804205:	55                   	push   %rbp
+  804206:	48 89 e5             	mov    %rsp,%rbp
+  804209:	41 57                	push   %r15
+  80420b:	41 56                	push   %r14
+  80420d:	41 55                	push   %r13
+  80420f:	41 54                	push   %r12
+  804211:	53                   	push   %rbx
+  804212:	48 83 ec 18          	sub    $0x18,%rsp
+  804216:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  804219:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  80421d:	48 b8 45 40 80 00 00 	movabs $0x804045,%rax
+  804224:	00 00 00 
+  804227:	ff d0                	call   *%rax
+  804229:	89 c3                	mov    %eax,%ebx
+  80422b:	85 c0                	test   %eax,%eax
+  80422d:	0f 88 b8 00 00 00    	js     8042eb <dup+0xe6>
+    close(newfdnum);
+  804233:	44 89 e7             	mov    %r12d,%edi
+  804236:	48 b8 aa 41 80 00 00 	movabs $0x8041aa,%rax
+  80423d:	00 00 00 
+  804240:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  804242:	4d 63 ec             	movslq %r12d,%r13
+  804245:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  80424c:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  804250:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  804254:	4c 89 ff             	mov    %r15,%rdi
+  804257:	49 be 96 3f 80 00 00 	movabs $0x803f96,%r14
+  80425e:	00 00 00 
+  804261:	41 ff d6             	call   *%r14
+  804264:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  804267:	4c 89 ef             	mov    %r13,%rdi
+  80426a:	41 ff d6             	call   *%r14
+  80426d:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  804270:	48 89 df             	mov    %rbx,%rdi
+  804273:	48 b8 bb 50 80 00 00 	movabs $0x8050bb,%rax
+  80427a:	00 00 00 
+  80427d:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  80427f:	a8 04                	test   $0x4,%al
+  804281:	74 2b                	je     8042ae <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  804283:	41 89 c1             	mov    %eax,%r9d
+  804286:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  80428c:	4c 89 f1             	mov    %r14,%rcx
+  80428f:	ba 00 00 00 00       	mov    $0x0,%edx
+  804294:	48 89 de             	mov    %rbx,%rsi
+  804297:	bf 00 00 00 00       	mov    $0x0,%edi
+  80429c:	48 b8 09 37 80 00 00 	movabs $0x803709,%rax
+  8042a3:	00 00 00 
+  8042a6:	ff d0                	call   *%rax
+  8042a8:	89 c3                	mov    %eax,%ebx
+  8042aa:	85 c0                	test   %eax,%eax
+  8042ac:	78 4e                	js     8042fc <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  8042ae:	4c 89 ff             	mov    %r15,%rdi
+  8042b1:	48 b8 bb 50 80 00 00 	movabs $0x8050bb,%rax
+  8042b8:	00 00 00 
+  8042bb:	ff d0                	call   *%rax
+  8042bd:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  8042c0:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8042c6:	4c 89 e9             	mov    %r13,%rcx
+  8042c9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8042ce:	4c 89 fe             	mov    %r15,%rsi
+  8042d1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8042d6:	48 b8 09 37 80 00 00 	movabs $0x803709,%rax
+  8042dd:	00 00 00 
+  8042e0:	ff d0                	call   *%rax
+  8042e2:	89 c3                	mov    %eax,%ebx
+  8042e4:	85 c0                	test   %eax,%eax
+  8042e6:	78 14                	js     8042fc <dup+0xf7>
+
+    return newfdnum;
+  8042e8:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  8042eb:	89 d8                	mov    %ebx,%eax
+  8042ed:	48 83 c4 18          	add    $0x18,%rsp
+  8042f1:	5b                   	pop    %rbx
+  8042f2:	41 5c                	pop    %r12
+  8042f4:	41 5d                	pop    %r13
+  8042f6:	41 5e                	pop    %r14
+  8042f8:	41 5f                	pop    %r15
+  8042fa:	5d                   	pop    %rbp
+  8042fb:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  8042fc:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804301:	4c 89 ee             	mov    %r13,%rsi
+  804304:	bf 00 00 00 00       	mov    $0x0,%edi
+  804309:	49 bc 6e 37 80 00 00 	movabs $0x80376e,%r12
+  804310:	00 00 00 
+  804313:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  804316:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80431b:	4c 89 f6             	mov    %r14,%rsi
+  80431e:	bf 00 00 00 00       	mov    $0x0,%edi
+  804323:	41 ff d4             	call   *%r12
+    return res;
+  804326:	eb c3                	jmp    8042eb <dup+0xe6>
+
+0000000000804328 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  804328:	55                   	push   %rbp
+  804329:	48 89 e5             	mov    %rsp,%rbp
+  80432c:	41 56                	push   %r14
+  80432e:	41 55                	push   %r13
+  804330:	41 54                	push   %r12
+  804332:	53                   	push   %rbx
+  804333:	48 83 ec 10          	sub    $0x10,%rsp
+  804337:	89 fb                	mov    %edi,%ebx
+  804339:	49 89 f4             	mov    %rsi,%r12
+  80433c:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80433f:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  804343:	48 b8 45 40 80 00 00 	movabs $0x804045,%rax
+  80434a:	00 00 00 
+  80434d:	ff d0                	call   *%rax
+  80434f:	85 c0                	test   %eax,%eax
+  804351:	78 4c                	js     80439f <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  804353:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  804357:	41 8b 3e             	mov    (%r14),%edi
+  80435a:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80435e:	48 b8 90 40 80 00 00 	movabs $0x804090,%rax
+  804365:	00 00 00 
+  804368:	ff d0                	call   *%rax
+  80436a:	85 c0                	test   %eax,%eax
+  80436c:	78 35                	js     8043a3 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  80436e:	41 8b 46 08          	mov    0x8(%r14),%eax
+  804372:	83 e0 03             	and    $0x3,%eax
+  804375:	83 f8 01             	cmp    $0x1,%eax
+  804378:	74 2d                	je     8043a7 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  80437a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80437e:	48 8b 40 10          	mov    0x10(%rax),%rax
+  804382:	48 85 c0             	test   %rax,%rax
+  804385:	74 56                	je     8043dd <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  804387:	4c 89 ea             	mov    %r13,%rdx
+  80438a:	4c 89 e6             	mov    %r12,%rsi
+  80438d:	4c 89 f7             	mov    %r14,%rdi
+  804390:	ff d0                	call   *%rax
+}
+  804392:	48 83 c4 10          	add    $0x10,%rsp
+  804396:	5b                   	pop    %rbx
+  804397:	41 5c                	pop    %r12
+  804399:	41 5d                	pop    %r13
+  80439b:	41 5e                	pop    %r14
+  80439d:	5d                   	pop    %rbp
+  80439e:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80439f:	48 98                	cltq
+  8043a1:	eb ef                	jmp    804392 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8043a3:	48 98                	cltq
+  8043a5:	eb eb                	jmp    804392 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8043a7:	48 a1 10 c0 80 00 00 	movabs 0x80c010,%rax
+  8043ae:	00 00 00 
+  8043b1:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+  8043b7:	89 da                	mov    %ebx,%edx
+  8043b9:	48 bf d9 60 80 00 00 	movabs $0x8060d9,%rdi
+  8043c0:	00 00 00 
+  8043c3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8043c8:	48 b9 cd 27 80 00 00 	movabs $0x8027cd,%rcx
+  8043cf:	00 00 00 
+  8043d2:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8043d4:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8043db:	eb b5                	jmp    804392 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  8043dd:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  8043e4:	eb ac                	jmp    804392 <read+0x6a>
+
+00000000008043e6 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  8043e6:	55                   	push   %rbp
+  8043e7:	48 89 e5             	mov    %rsp,%rbp
+  8043ea:	41 57                	push   %r15
+  8043ec:	41 56                	push   %r14
+  8043ee:	41 55                	push   %r13
+  8043f0:	41 54                	push   %r12
+  8043f2:	53                   	push   %rbx
+  8043f3:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  8043f7:	48 85 d2             	test   %rdx,%rdx
+  8043fa:	74 54                	je     804450 <readn+0x6a>
+  8043fc:	41 89 fd             	mov    %edi,%r13d
+  8043ff:	49 89 f6             	mov    %rsi,%r14
+  804402:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  804405:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  80440a:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  80440f:	49 bf 28 43 80 00 00 	movabs $0x804328,%r15
+  804416:	00 00 00 
+  804419:	4c 89 e2             	mov    %r12,%rdx
+  80441c:	48 29 f2             	sub    %rsi,%rdx
+  80441f:	4c 01 f6             	add    %r14,%rsi
+  804422:	44 89 ef             	mov    %r13d,%edi
+  804425:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  804428:	85 c0                	test   %eax,%eax
+  80442a:	78 20                	js     80444c <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  80442c:	01 c3                	add    %eax,%ebx
+  80442e:	85 c0                	test   %eax,%eax
+  804430:	74 08                	je     80443a <readn+0x54>
+  804432:	48 63 f3             	movslq %ebx,%rsi
+  804435:	4c 39 e6             	cmp    %r12,%rsi
+  804438:	72 df                	jb     804419 <readn+0x33>
+    }
+    return res;
+  80443a:	48 63 c3             	movslq %ebx,%rax
+}
+  80443d:	48 83 c4 08          	add    $0x8,%rsp
+  804441:	5b                   	pop    %rbx
+  804442:	41 5c                	pop    %r12
+  804444:	41 5d                	pop    %r13
+  804446:	41 5e                	pop    %r14
+  804448:	41 5f                	pop    %r15
+  80444a:	5d                   	pop    %rbp
+  80444b:	c3                   	ret
+        if (inc < 0) return inc;
+  80444c:	48 98                	cltq
+  80444e:	eb ed                	jmp    80443d <readn+0x57>
+    int inc = 1, res = 0;
+  804450:	bb 00 00 00 00       	mov    $0x0,%ebx
+  804455:	eb e3                	jmp    80443a <readn+0x54>
+
+0000000000804457 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  804457:	55                   	push   %rbp
+  804458:	48 89 e5             	mov    %rsp,%rbp
+  80445b:	41 56                	push   %r14
+  80445d:	41 55                	push   %r13
+  80445f:	41 54                	push   %r12
+  804461:	53                   	push   %rbx
+  804462:	48 83 ec 10          	sub    $0x10,%rsp
+  804466:	89 fb                	mov    %edi,%ebx
+  804468:	49 89 f4             	mov    %rsi,%r12
+  80446b:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80446e:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  804472:	48 b8 45 40 80 00 00 	movabs $0x804045,%rax
+  804479:	00 00 00 
+  80447c:	ff d0                	call   *%rax
+  80447e:	85 c0                	test   %eax,%eax
+  804480:	78 47                	js     8044c9 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  804482:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  804486:	41 8b 3e             	mov    (%r14),%edi
+  804489:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80448d:	48 b8 90 40 80 00 00 	movabs $0x804090,%rax
+  804494:	00 00 00 
+  804497:	ff d0                	call   *%rax
+  804499:	85 c0                	test   %eax,%eax
+  80449b:	78 30                	js     8044cd <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80449d:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  8044a2:	74 2d                	je     8044d1 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  8044a4:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8044a8:	48 8b 40 18          	mov    0x18(%rax),%rax
+  8044ac:	48 85 c0             	test   %rax,%rax
+  8044af:	74 56                	je     804507 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  8044b1:	4c 89 ea             	mov    %r13,%rdx
+  8044b4:	4c 89 e6             	mov    %r12,%rsi
+  8044b7:	4c 89 f7             	mov    %r14,%rdi
+  8044ba:	ff d0                	call   *%rax
+}
+  8044bc:	48 83 c4 10          	add    $0x10,%rsp
+  8044c0:	5b                   	pop    %rbx
+  8044c1:	41 5c                	pop    %r12
+  8044c3:	41 5d                	pop    %r13
+  8044c5:	41 5e                	pop    %r14
+  8044c7:	5d                   	pop    %rbp
+  8044c8:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8044c9:	48 98                	cltq
+  8044cb:	eb ef                	jmp    8044bc <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8044cd:	48 98                	cltq
+  8044cf:	eb eb                	jmp    8044bc <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8044d1:	48 a1 10 c0 80 00 00 	movabs 0x80c010,%rax
+  8044d8:	00 00 00 
+  8044db:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+  8044e1:	89 da                	mov    %ebx,%edx
+  8044e3:	48 bf f5 60 80 00 00 	movabs $0x8060f5,%rdi
+  8044ea:	00 00 00 
+  8044ed:	b8 00 00 00 00       	mov    $0x0,%eax
+  8044f2:	48 b9 cd 27 80 00 00 	movabs $0x8027cd,%rcx
+  8044f9:	00 00 00 
+  8044fc:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8044fe:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  804505:	eb b5                	jmp    8044bc <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  804507:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  80450e:	eb ac                	jmp    8044bc <write+0x65>
+
+0000000000804510 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  804510:	55                   	push   %rbp
+  804511:	48 89 e5             	mov    %rsp,%rbp
+  804514:	53                   	push   %rbx
+  804515:	48 83 ec 18          	sub    $0x18,%rsp
+  804519:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80451b:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80451f:	48 b8 45 40 80 00 00 	movabs $0x804045,%rax
+  804526:	00 00 00 
+  804529:	ff d0                	call   *%rax
+  80452b:	85 c0                	test   %eax,%eax
+  80452d:	78 0c                	js     80453b <seek+0x2b>
+
+    fd->fd_offset = offset;
+  80452f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804533:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  804536:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80453b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80453f:	c9                   	leave
+  804540:	c3                   	ret
+
+0000000000804541 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  804541:	55                   	push   %rbp
+  804542:	48 89 e5             	mov    %rsp,%rbp
+  804545:	41 55                	push   %r13
+  804547:	41 54                	push   %r12
+  804549:	53                   	push   %rbx
+  80454a:	48 83 ec 18          	sub    $0x18,%rsp
+  80454e:	89 fb                	mov    %edi,%ebx
+  804550:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  804553:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  804557:	48 b8 45 40 80 00 00 	movabs $0x804045,%rax
+  80455e:	00 00 00 
+  804561:	ff d0                	call   *%rax
+  804563:	85 c0                	test   %eax,%eax
+  804565:	78 38                	js     80459f <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  804567:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  80456b:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  80456f:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  804573:	48 b8 90 40 80 00 00 	movabs $0x804090,%rax
+  80457a:	00 00 00 
+  80457d:	ff d0                	call   *%rax
+  80457f:	85 c0                	test   %eax,%eax
+  804581:	78 1c                	js     80459f <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  804583:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  804588:	74 20                	je     8045aa <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  80458a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80458e:	48 8b 40 30          	mov    0x30(%rax),%rax
+  804592:	48 85 c0             	test   %rax,%rax
+  804595:	74 47                	je     8045de <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  804597:	44 89 e6             	mov    %r12d,%esi
+  80459a:	4c 89 ef             	mov    %r13,%rdi
+  80459d:	ff d0                	call   *%rax
+}
+  80459f:	48 83 c4 18          	add    $0x18,%rsp
+  8045a3:	5b                   	pop    %rbx
+  8045a4:	41 5c                	pop    %r12
+  8045a6:	41 5d                	pop    %r13
+  8045a8:	5d                   	pop    %rbp
+  8045a9:	c3                   	ret
+                thisenv->env_id, fdnum);
+  8045aa:	48 a1 10 c0 80 00 00 	movabs 0x80c010,%rax
+  8045b1:	00 00 00 
+  8045b4:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8045ba:	89 da                	mov    %ebx,%edx
+  8045bc:	48 bf b8 60 80 00 00 	movabs $0x8060b8,%rdi
+  8045c3:	00 00 00 
+  8045c6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8045cb:	48 b9 cd 27 80 00 00 	movabs $0x8027cd,%rcx
+  8045d2:	00 00 00 
+  8045d5:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8045d7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8045dc:	eb c1                	jmp    80459f <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  8045de:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8045e3:	eb ba                	jmp    80459f <ftruncate+0x5e>
+
+00000000008045e5 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  8045e5:	55                   	push   %rbp
+  8045e6:	48 89 e5             	mov    %rsp,%rbp
+  8045e9:	41 54                	push   %r12
+  8045eb:	53                   	push   %rbx
+  8045ec:	48 83 ec 10          	sub    $0x10,%rsp
+  8045f0:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8045f3:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8045f7:	48 b8 45 40 80 00 00 	movabs $0x804045,%rax
+  8045fe:	00 00 00 
+  804601:	ff d0                	call   *%rax
+  804603:	85 c0                	test   %eax,%eax
+  804605:	78 4e                	js     804655 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  804607:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  80460b:	41 8b 3c 24          	mov    (%r12),%edi
+  80460f:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  804613:	48 b8 90 40 80 00 00 	movabs $0x804090,%rax
+  80461a:	00 00 00 
+  80461d:	ff d0                	call   *%rax
+  80461f:	85 c0                	test   %eax,%eax
+  804621:	78 32                	js     804655 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  804623:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804627:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  80462c:	74 30                	je     80465e <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  80462e:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  804631:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  804638:	00 00 00 
+    stat->st_isdir = 0;
+  80463b:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  804642:	00 00 00 
+    stat->st_dev = dev;
+  804645:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  80464c:	48 89 de             	mov    %rbx,%rsi
+  80464f:	4c 89 e7             	mov    %r12,%rdi
+  804652:	ff 50 28             	call   *0x28(%rax)
+}
+  804655:	48 83 c4 10          	add    $0x10,%rsp
+  804659:	5b                   	pop    %rbx
+  80465a:	41 5c                	pop    %r12
+  80465c:	5d                   	pop    %rbp
+  80465d:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  80465e:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  804663:	eb f0                	jmp    804655 <fstat+0x70>
+
+0000000000804665 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  804665:	55                   	push   %rbp
+  804666:	48 89 e5             	mov    %rsp,%rbp
+  804669:	41 54                	push   %r12
+  80466b:	53                   	push   %rbx
+  80466c:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  80466f:	be 00 00 00 00       	mov    $0x0,%esi
+  804674:	48 b8 48 4a 80 00 00 	movabs $0x804a48,%rax
+  80467b:	00 00 00 
+  80467e:	ff d0                	call   *%rax
+  804680:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  804682:	85 c0                	test   %eax,%eax
+  804684:	78 25                	js     8046ab <stat+0x46>
+
+    int res = fstat(fd, stat);
+  804686:	4c 89 e6             	mov    %r12,%rsi
+  804689:	89 c7                	mov    %eax,%edi
+  80468b:	48 b8 e5 45 80 00 00 	movabs $0x8045e5,%rax
+  804692:	00 00 00 
+  804695:	ff d0                	call   *%rax
+  804697:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  80469a:	89 df                	mov    %ebx,%edi
+  80469c:	48 b8 aa 41 80 00 00 	movabs $0x8041aa,%rax
+  8046a3:	00 00 00 
+  8046a6:	ff d0                	call   *%rax
+
+    return res;
+  8046a8:	44 89 e3             	mov    %r12d,%ebx
+}
+  8046ab:	89 d8                	mov    %ebx,%eax
+  8046ad:	5b                   	pop    %rbx
+  8046ae:	41 5c                	pop    %r12
+  8046b0:	5d                   	pop    %rbp
+  8046b1:	c3                   	ret
+
+00000000008046b2 <fsipc>:
+ * response may be written back to fsipcbuf.
+ * type: request code, passed as the simple integer IPC value.
+ * dstva: virtual address at which to receive reply page, 0 if none.
+ * Returns result from the file server. */
+static int
+fsipc(unsigned type, void *dstva) {
+  8046b2:	55                   	push   %rbp
+  8046b3:	48 89 e5             	mov    %rsp,%rbp
+  8046b6:	41 54                	push   %r12
+  8046b8:	53                   	push   %rbx
+  8046b9:	48 83 ec 10          	sub    $0x10,%rsp
+  8046bd:	41 89 fc             	mov    %edi,%r12d
+  8046c0:	48 89 f3             	mov    %rsi,%rbx
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8046c3:	48 b8 00 e0 80 00 00 	movabs $0x80e000,%rax
+  8046ca:	00 00 00 
+  8046cd:	83 38 00             	cmpl   $0x0,(%rax)
+  8046d0:	74 5e                	je     804730 <fsipc+0x7e>
+    if (debug) {
+        cprintf("[%08x] fsipc %d %08x\n",
+                thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+    }
+
+    ipc_send(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW);
+  8046d2:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8046d8:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8046dd:	48 ba 00 d0 80 00 00 	movabs $0x80d000,%rdx
+  8046e4:	00 00 00 
+  8046e7:	44 89 e6             	mov    %r12d,%esi
+  8046ea:	48 b8 00 e0 80 00 00 	movabs $0x80e000,%rax
+  8046f1:	00 00 00 
+  8046f4:	8b 38                	mov    (%rax),%edi
+  8046f6:	48 b8 91 3e 80 00 00 	movabs $0x803e91,%rax
+  8046fd:	00 00 00 
+  804700:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  804702:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  804709:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  80470a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80470f:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  804713:	48 89 de             	mov    %rbx,%rsi
+  804716:	bf 00 00 00 00       	mov    $0x0,%edi
+  80471b:	48 b8 bc 3d 80 00 00 	movabs $0x803dbc,%rax
+  804722:	00 00 00 
+  804725:	ff d0                	call   *%rax
+}
+  804727:	48 83 c4 10          	add    $0x10,%rsp
+  80472b:	5b                   	pop    %rbx
+  80472c:	41 5c                	pop    %r12
+  80472e:	5d                   	pop    %rbp
+  80472f:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  804730:	bf 03 00 00 00       	mov    $0x3,%edi
+  804735:	48 b8 34 3f 80 00 00 	movabs $0x803f34,%rax
+  80473c:	00 00 00 
+  80473f:	ff d0                	call   *%rax
+  804741:	a3 00 e0 80 00 00 00 	movabs %eax,0x80e000
+  804748:	00 00 
+  80474a:	eb 86                	jmp    8046d2 <fsipc+0x20>
+
+000000000080474c <devfile_trunc>:
+    return 0;
+}
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  80474c:	55                   	push   %rbp
+  80474d:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  804750:	48 b8 00 d0 80 00 00 	movabs $0x80d000,%rax
+  804757:	00 00 00 
+  80475a:	8b 57 0c             	mov    0xc(%rdi),%edx
+  80475d:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  80475f:	89 70 04             	mov    %esi,0x4(%rax)
+
+    return fsipc(FSREQ_SET_SIZE, NULL);
+  804762:	be 00 00 00 00       	mov    $0x0,%esi
+  804767:	bf 02 00 00 00       	mov    $0x2,%edi
+  80476c:	48 b8 b2 46 80 00 00 	movabs $0x8046b2,%rax
+  804773:	00 00 00 
+  804776:	ff d0                	call   *%rax
+}
+  804778:	5d                   	pop    %rbp
+  804779:	c3                   	ret
+
+000000000080477a <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  80477a:	55                   	push   %rbp
+  80477b:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  80477e:	8b 47 0c             	mov    0xc(%rdi),%eax
+  804781:	a3 00 d0 80 00 00 00 	movabs %eax,0x80d000
+  804788:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  80478a:	be 00 00 00 00       	mov    $0x0,%esi
+  80478f:	bf 06 00 00 00       	mov    $0x6,%edi
+  804794:	48 b8 b2 46 80 00 00 	movabs $0x8046b2,%rax
+  80479b:	00 00 00 
+  80479e:	ff d0                	call   *%rax
+}
+  8047a0:	5d                   	pop    %rbp
+  8047a1:	c3                   	ret
+
+00000000008047a2 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  8047a2:	55                   	push   %rbp
+  8047a3:	48 89 e5             	mov    %rsp,%rbp
+  8047a6:	41 54                	push   %r12
+  8047a8:	53                   	push   %rbx
+  8047a9:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8047ac:	8b 47 0c             	mov    0xc(%rdi),%eax
+  8047af:	a3 00 d0 80 00 00 00 	movabs %eax,0x80d000
+  8047b6:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  8047b8:	be 00 00 00 00       	mov    $0x0,%esi
+  8047bd:	bf 05 00 00 00       	mov    $0x5,%edi
+  8047c2:	48 b8 b2 46 80 00 00 	movabs $0x8046b2,%rax
+  8047c9:	00 00 00 
+  8047cc:	ff d0                	call   *%rax
+    if (res < 0) {
+  8047ce:	85 c0                	test   %eax,%eax
+  8047d0:	78 3d                	js     80480f <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8047d2:	49 bc 00 d0 80 00 00 	movabs $0x80d000,%r12
+  8047d9:	00 00 00 
+  8047dc:	4c 89 e6             	mov    %r12,%rsi
+  8047df:	48 89 df             	mov    %rbx,%rdi
+  8047e2:	48 b8 f2 30 80 00 00 	movabs $0x8030f2,%rax
+  8047e9:	00 00 00 
+  8047ec:	ff d0                	call   *%rax
+    st->st_size  = fsipcbuf.statRet.ret_size;
+  8047ee:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  8047f5:	00 
+  8047f6:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8047fc:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  804803:	00 
+  804804:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  80480a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80480f:	5b                   	pop    %rbx
+  804810:	41 5c                	pop    %r12
+  804812:	5d                   	pop    %rbp
+  804813:	c3                   	ret
+
+0000000000804814 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  804814:	55                   	push   %rbp
+  804815:	48 89 e5             	mov    %rsp,%rbp
+  804818:	41 57                	push   %r15
+  80481a:	41 56                	push   %r14
+  80481c:	41 55                	push   %r13
+  80481e:	41 54                	push   %r12
+  804820:	53                   	push   %rbx
+  804821:	48 83 ec 18          	sub    $0x18,%rsp
+  804825:	49 89 fe             	mov    %rdi,%r14
+  804828:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+  80482c:	48 89 d3             	mov    %rdx,%rbx
+    while (n > sizeof(fsipcbuf.write.req_buf))
+  80482f:	48 81 fa f0 0f 00 00 	cmp    $0xff0,%rdx
+  804836:	0f 86 e4 00 00 00    	jbe    804920 <devfile_write+0x10c>
+  80483c:	49 89 f4             	mov    %rsi,%r12
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  80483f:	49 bd 00 d0 80 00 00 	movabs $0x80d000,%r13
+  804846:	00 00 00 
+        memcpy(fsipcbuf.write.req_buf, buf, sizeof(fsipcbuf.write.req_buf));
+  804849:	49 bf 53 33 80 00 00 	movabs $0x803353,%r15
+  804850:	00 00 00 
+  804853:	eb 03                	jmp    804858 <devfile_write+0x44>
+        buf += sizeof(fsipcbuf.write.req_buf);
+  804855:	49 89 f4             	mov    %rsi,%r12
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  804858:	41 8b 46 0c          	mov    0xc(%r14),%eax
+  80485c:	41 89 45 00          	mov    %eax,0x0(%r13)
+        fsipcbuf.write.req_n      = sizeof(fsipcbuf.write.req_buf);
+  804860:	49 c7 45 08 f0 0f 00 	movq   $0xff0,0x8(%r13)
+  804867:	00 
+        memcpy(fsipcbuf.write.req_buf, buf, sizeof(fsipcbuf.write.req_buf));
+  804868:	ba f0 0f 00 00       	mov    $0xff0,%edx
+  80486d:	4c 89 e6             	mov    %r12,%rsi
+  804870:	48 bf 10 d0 80 00 00 	movabs $0x80d010,%rdi
+  804877:	00 00 00 
+  80487a:	41 ff d7             	call   *%r15
+        ssize_t res = fsipc(FSREQ_WRITE, NULL);
+  80487d:	be 00 00 00 00       	mov    $0x0,%esi
+  804882:	bf 04 00 00 00       	mov    $0x4,%edi
+  804887:	48 b8 b2 46 80 00 00 	movabs $0x8046b2,%rax
+  80488e:	00 00 00 
+  804891:	ff d0                	call   *%rax
+  804893:	48 63 d0             	movslq %eax,%rdx
+        if (res < 0 || res < sizeof(fsipcbuf.write.req_buf))
+  804896:	3d ef 0f 00 00       	cmp    $0xfef,%eax
+  80489b:	7e 71                	jle    80490e <devfile_write+0xfa>
+        buf += sizeof(fsipcbuf.write.req_buf);
+  80489d:	49 8d b4 24 f0 0f 00 	lea    0xff0(%r12),%rsi
+  8048a4:	00 
+        n -= sizeof(fsipcbuf.write.req_buf);
+  8048a5:	48 81 eb f0 0f 00 00 	sub    $0xff0,%rbx
+    while (n > sizeof(fsipcbuf.write.req_buf))
+  8048ac:	48 81 fb f0 0f 00 00 	cmp    $0xff0,%rbx
+  8048b3:	77 a0                	ja     804855 <devfile_write+0x41>
+        written += sizeof(fsipcbuf.write.req_buf);
+  8048b5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8048b9:	49 29 c4             	sub    %rax,%r12
+  8048bc:	4d 8d a4 24 f0 0f 00 	lea    0xff0(%r12),%r12
+  8048c3:	00 
+    fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8048c4:	48 b8 00 d0 80 00 00 	movabs $0x80d000,%rax
+  8048cb:	00 00 00 
+  8048ce:	41 8b 56 0c          	mov    0xc(%r14),%edx
+  8048d2:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.write.req_n      = n;
+  8048d4:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    memcpy(fsipcbuf.write.req_buf, buf, n);
+  8048d8:	48 89 da             	mov    %rbx,%rdx
+  8048db:	48 8d 78 10          	lea    0x10(%rax),%rdi
+  8048df:	48 b8 53 33 80 00 00 	movabs $0x803353,%rax
+  8048e6:	00 00 00 
+  8048e9:	ff d0                	call   *%rax
+    ssize_t res = fsipc(FSREQ_WRITE, NULL);
+  8048eb:	be 00 00 00 00       	mov    $0x0,%esi
+  8048f0:	bf 04 00 00 00       	mov    $0x4,%edi
+  8048f5:	48 b8 b2 46 80 00 00 	movabs $0x8046b2,%rax
+  8048fc:	00 00 00 
+  8048ff:	ff d0                	call   *%rax
+  804901:	48 63 d0             	movslq %eax,%rdx
+    written += res;
+  804904:	49 01 d4             	add    %rdx,%r12
+  804907:	48 85 d2             	test   %rdx,%rdx
+  80490a:	49 0f 49 d4          	cmovns %r12,%rdx
+}
+  80490e:	48 89 d0             	mov    %rdx,%rax
+  804911:	48 83 c4 18          	add    $0x18,%rsp
+  804915:	5b                   	pop    %rbx
+  804916:	41 5c                	pop    %r12
+  804918:	41 5d                	pop    %r13
+  80491a:	41 5e                	pop    %r14
+  80491c:	41 5f                	pop    %r15
+  80491e:	5d                   	pop    %rbp
+  80491f:	c3                   	ret
+    while (n > sizeof(fsipcbuf.write.req_buf))
+  804920:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+    ssize_t written = 0;
+  804924:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80492a:	eb 98                	jmp    8048c4 <devfile_write+0xb0>
+
+000000000080492c <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  80492c:	55                   	push   %rbp
+  80492d:	48 89 e5             	mov    %rsp,%rbp
+  804930:	41 57                	push   %r15
+  804932:	41 56                	push   %r14
+  804934:	41 55                	push   %r13
+  804936:	41 54                	push   %r12
+  804938:	53                   	push   %rbx
+  804939:	48 83 ec 18          	sub    $0x18,%rsp
+  80493d:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  804941:	49 89 f6             	mov    %rsi,%r14
+  804944:	49 89 d4             	mov    %rdx,%r12
+    while (n > sizeof(fsipcbuf.readRet.ret_buf))
+  804947:	48 81 fa 00 10 00 00 	cmp    $0x1000,%rdx
+  80494e:	0f 86 ea 00 00 00    	jbe    804a3e <devfile_read+0x112>
+    ssize_t readsz = 0;
+  804954:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  80495b:	00 
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  80495c:	49 bf 00 d0 80 00 00 	movabs $0x80d000,%r15
+  804963:	00 00 00 
+  804966:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80496a:	8b 40 0c             	mov    0xc(%rax),%eax
+  80496d:	41 89 07             	mov    %eax,(%r15)
+        fsipcbuf.read.req_n = sizeof(fsipcbuf.readRet.ret_buf);
+  804970:	49 c7 47 08 00 10 00 	movq   $0x1000,0x8(%r15)
+  804977:	00 
+        ssize_t res = fsipc(FSREQ_READ, NULL);
+  804978:	be 00 00 00 00       	mov    $0x0,%esi
+  80497d:	bf 03 00 00 00       	mov    $0x3,%edi
+  804982:	48 b8 b2 46 80 00 00 	movabs $0x8046b2,%rax
+  804989:	00 00 00 
+  80498c:	ff d0                	call   *%rax
+  80498e:	4c 63 e8             	movslq %eax,%r13
+        if (res < 0)
+  804991:	4d 85 ed             	test   %r13,%r13
+  804994:	0f 88 92 00 00 00    	js     804a2c <devfile_read+0x100>
+        memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  80499a:	4c 89 ea             	mov    %r13,%rdx
+  80499d:	4c 89 fe             	mov    %r15,%rsi
+  8049a0:	4c 89 f7             	mov    %r14,%rdi
+  8049a3:	48 b8 53 33 80 00 00 	movabs $0x803353,%rax
+  8049aa:	00 00 00 
+  8049ad:	ff d0                	call   *%rax
+        if (res < sizeof(fsipcbuf.readRet.ret_buf))
+  8049af:	49 81 fd ff 0f 00 00 	cmp    $0xfff,%r13
+  8049b6:	76 6d                	jbe    804a25 <devfile_read+0xf9>
+        readsz += res;
+  8049b8:	4c 01 6d c0          	add    %r13,-0x40(%rbp)
+        buf += res;
+  8049bc:	4d 01 ee             	add    %r13,%r14
+        n -= res;
+  8049bf:	4d 29 ec             	sub    %r13,%r12
+    while (n > sizeof(fsipcbuf.readRet.ret_buf))
+  8049c2:	49 81 fc 00 10 00 00 	cmp    $0x1000,%r12
+  8049c9:	77 9b                	ja     804966 <devfile_read+0x3a>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8049cb:	48 b8 00 d0 80 00 00 	movabs $0x80d000,%rax
+  8049d2:	00 00 00 
+  8049d5:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  8049d9:	8b 51 0c             	mov    0xc(%rcx),%edx
+  8049dc:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.read.req_n = n;
+  8049de:	4c 89 60 08          	mov    %r12,0x8(%rax)
+    ssize_t res = fsipc(FSREQ_READ, NULL);
+  8049e2:	be 00 00 00 00       	mov    $0x0,%esi
+  8049e7:	bf 03 00 00 00       	mov    $0x3,%edi
+  8049ec:	48 b8 b2 46 80 00 00 	movabs $0x8046b2,%rax
+  8049f3:	00 00 00 
+  8049f6:	ff d0                	call   *%rax
+  8049f8:	4c 63 e8             	movslq %eax,%r13
+    if (res < 0)
+  8049fb:	4d 85 ed             	test   %r13,%r13
+  8049fe:	78 2c                	js     804a2c <devfile_read+0x100>
+    memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  804a00:	4c 89 ea             	mov    %r13,%rdx
+  804a03:	48 be 00 d0 80 00 00 	movabs $0x80d000,%rsi
+  804a0a:	00 00 00 
+  804a0d:	4c 89 f7             	mov    %r14,%rdi
+  804a10:	48 b8 53 33 80 00 00 	movabs $0x803353,%rax
+  804a17:	00 00 00 
+  804a1a:	ff d0                	call   *%rax
+    readsz += res;
+  804a1c:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804a20:	49 01 c5             	add    %rax,%r13
+    return readsz;
+  804a23:	eb 07                	jmp    804a2c <devfile_read+0x100>
+            return readsz + res;
+  804a25:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804a29:	49 01 c5             	add    %rax,%r13
+}
+  804a2c:	4c 89 e8             	mov    %r13,%rax
+  804a2f:	48 83 c4 18          	add    $0x18,%rsp
+  804a33:	5b                   	pop    %rbx
+  804a34:	41 5c                	pop    %r12
+  804a36:	41 5d                	pop    %r13
+  804a38:	41 5e                	pop    %r14
+  804a3a:	41 5f                	pop    %r15
+  804a3c:	5d                   	pop    %rbp
+  804a3d:	c3                   	ret
+    ssize_t readsz = 0;
+  804a3e:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  804a45:	00 
+  804a46:	eb 83                	jmp    8049cb <devfile_read+0x9f>
+
+0000000000804a48 <open>:
+open(const char *path, int mode) {
+  804a48:	55                   	push   %rbp
+  804a49:	48 89 e5             	mov    %rsp,%rbp
+  804a4c:	41 55                	push   %r13
+  804a4e:	41 54                	push   %r12
+  804a50:	53                   	push   %rbx
+  804a51:	48 83 ec 18          	sub    $0x18,%rsp
+  804a55:	49 89 fc             	mov    %rdi,%r12
+  804a58:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  804a5b:	48 b8 b4 30 80 00 00 	movabs $0x8030b4,%rax
+  804a62:	00 00 00 
+  804a65:	ff d0                	call   *%rax
+  804a67:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  804a6d:	0f 87 8a 00 00 00    	ja     804afd <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  804a73:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  804a77:	48 b8 2b 40 80 00 00 	movabs $0x80402b,%rax
+  804a7e:	00 00 00 
+  804a81:	ff d0                	call   *%rax
+  804a83:	89 c3                	mov    %eax,%ebx
+  804a85:	85 c0                	test   %eax,%eax
+  804a87:	78 50                	js     804ad9 <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  804a89:	4c 89 e6             	mov    %r12,%rsi
+  804a8c:	48 bb 00 d0 80 00 00 	movabs $0x80d000,%rbx
+  804a93:	00 00 00 
+  804a96:	48 89 df             	mov    %rbx,%rdi
+  804a99:	48 b8 f2 30 80 00 00 	movabs $0x8030f2,%rax
+  804aa0:	00 00 00 
+  804aa3:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  804aa5:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  804aac:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  804ab0:	bf 01 00 00 00       	mov    $0x1,%edi
+  804ab5:	48 b8 b2 46 80 00 00 	movabs $0x8046b2,%rax
+  804abc:	00 00 00 
+  804abf:	ff d0                	call   *%rax
+  804ac1:	89 c3                	mov    %eax,%ebx
+  804ac3:	85 c0                	test   %eax,%eax
+  804ac5:	78 1f                	js     804ae6 <open+0x9e>
+    return fd2num(fd);
+  804ac7:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  804acb:	48 b8 84 3f 80 00 00 	movabs $0x803f84,%rax
+  804ad2:	00 00 00 
+  804ad5:	ff d0                	call   *%rax
+  804ad7:	89 c3                	mov    %eax,%ebx
+}
+  804ad9:	89 d8                	mov    %ebx,%eax
+  804adb:	48 83 c4 18          	add    $0x18,%rsp
+  804adf:	5b                   	pop    %rbx
+  804ae0:	41 5c                	pop    %r12
+  804ae2:	41 5d                	pop    %r13
+  804ae4:	5d                   	pop    %rbp
+  804ae5:	c3                   	ret
+        fd_close(fd, 0);
+  804ae6:	be 00 00 00 00       	mov    $0x0,%esi
+  804aeb:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  804aef:	48 b8 00 41 80 00 00 	movabs $0x804100,%rax
+  804af6:	00 00 00 
+  804af9:	ff d0                	call   *%rax
+        return res;
+  804afb:	eb dc                	jmp    804ad9 <open+0x91>
+        return -E_BAD_PATH;
+  804afd:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  804b02:	eb d5                	jmp    804ad9 <open+0x91>
+
+0000000000804b04 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  804b04:	55                   	push   %rbp
+  804b05:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc(FSREQ_SYNC, NULL);
+  804b08:	be 00 00 00 00       	mov    $0x0,%esi
+  804b0d:	bf 08 00 00 00       	mov    $0x8,%edi
+  804b12:	48 b8 b2 46 80 00 00 	movabs $0x8046b2,%rax
+  804b19:	00 00 00 
+  804b1c:	ff d0                	call   *%rax
+}
+  804b1e:	5d                   	pop    %rbp
+  804b1f:	c3                   	ret
+
+0000000000804b20 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  804b20:	55                   	push   %rbp
+  804b21:	48 89 e5             	mov    %rsp,%rbp
+  804b24:	41 54                	push   %r12
+  804b26:	53                   	push   %rbx
+  804b27:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  804b2a:	48 b8 96 3f 80 00 00 	movabs $0x803f96,%rax
+  804b31:	00 00 00 
+  804b34:	ff d0                	call   *%rax
+  804b36:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  804b39:	48 be 40 61 80 00 00 	movabs $0x806140,%rsi
+  804b40:	00 00 00 
+  804b43:	48 89 df             	mov    %rbx,%rdi
+  804b46:	48 b8 f2 30 80 00 00 	movabs $0x8030f2,%rax
+  804b4d:	00 00 00 
+  804b50:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  804b52:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  804b57:	41 2b 04 24          	sub    (%r12),%eax
+  804b5b:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  804b61:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  804b68:	00 00 00 
+    stat->st_dev = &devpipe;
+  804b6b:	48 b8 e0 b0 80 00 00 	movabs $0x80b0e0,%rax
+  804b72:	00 00 00 
+  804b75:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  804b7c:	b8 00 00 00 00       	mov    $0x0,%eax
+  804b81:	5b                   	pop    %rbx
+  804b82:	41 5c                	pop    %r12
+  804b84:	5d                   	pop    %rbp
+  804b85:	c3                   	ret
+
+0000000000804b86 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  804b86:	55                   	push   %rbp
+  804b87:	48 89 e5             	mov    %rsp,%rbp
+  804b8a:	41 54                	push   %r12
+  804b8c:	53                   	push   %rbx
+  804b8d:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  804b90:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804b95:	48 89 fe             	mov    %rdi,%rsi
+  804b98:	bf 00 00 00 00       	mov    $0x0,%edi
+  804b9d:	49 bc 6e 37 80 00 00 	movabs $0x80376e,%r12
+  804ba4:	00 00 00 
+  804ba7:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  804baa:	48 89 df             	mov    %rbx,%rdi
+  804bad:	48 b8 96 3f 80 00 00 	movabs $0x803f96,%rax
+  804bb4:	00 00 00 
+  804bb7:	ff d0                	call   *%rax
+  804bb9:	48 89 c6             	mov    %rax,%rsi
+  804bbc:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804bc1:	bf 00 00 00 00       	mov    $0x0,%edi
+  804bc6:	41 ff d4             	call   *%r12
+}
+  804bc9:	5b                   	pop    %rbx
+  804bca:	41 5c                	pop    %r12
+  804bcc:	5d                   	pop    %rbp
+  804bcd:	c3                   	ret
+
+0000000000804bce <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  804bce:	55                   	push   %rbp
+  804bcf:	48 89 e5             	mov    %rsp,%rbp
+  804bd2:	41 57                	push   %r15
+  804bd4:	41 56                	push   %r14
+  804bd6:	41 55                	push   %r13
+  804bd8:	41 54                	push   %r12
+  804bda:	53                   	push   %rbx
+  804bdb:	48 83 ec 18          	sub    $0x18,%rsp
+  804bdf:	49 89 fc             	mov    %rdi,%r12
+  804be2:	49 89 f5             	mov    %rsi,%r13
+  804be5:	49 89 d7             	mov    %rdx,%r15
+  804be8:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  804bec:	48 b8 96 3f 80 00 00 	movabs $0x803f96,%rax
+  804bf3:	00 00 00 
+  804bf6:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  804bf8:	4d 85 ff             	test   %r15,%r15
+  804bfb:	0f 84 af 00 00 00    	je     804cb0 <devpipe_write+0xe2>
+  804c01:	48 89 c3             	mov    %rax,%rbx
+  804c04:	4c 89 f8             	mov    %r15,%rax
+  804c07:	4d 89 ef             	mov    %r13,%r15
+  804c0a:	4c 01 e8             	add    %r13,%rax
+  804c0d:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  804c11:	49 bd 76 36 80 00 00 	movabs $0x803676,%r13
+  804c18:	00 00 00 
+            sys_yield();
+  804c1b:	49 be 13 36 80 00 00 	movabs $0x803613,%r14
+  804c22:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  804c25:	8b 73 04             	mov    0x4(%rbx),%esi
+  804c28:	48 63 ce             	movslq %esi,%rcx
+  804c2b:	48 63 03             	movslq (%rbx),%rax
+  804c2e:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  804c34:	48 39 c1             	cmp    %rax,%rcx
+  804c37:	72 2e                	jb     804c67 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  804c39:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  804c3e:	48 89 da             	mov    %rbx,%rdx
+  804c41:	be 00 10 00 00       	mov    $0x1000,%esi
+  804c46:	4c 89 e7             	mov    %r12,%rdi
+  804c49:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  804c4c:	85 c0                	test   %eax,%eax
+  804c4e:	74 66                	je     804cb6 <devpipe_write+0xe8>
+            sys_yield();
+  804c50:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  804c53:	8b 73 04             	mov    0x4(%rbx),%esi
+  804c56:	48 63 ce             	movslq %esi,%rcx
+  804c59:	48 63 03             	movslq (%rbx),%rax
+  804c5c:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  804c62:	48 39 c1             	cmp    %rax,%rcx
+  804c65:	73 d2                	jae    804c39 <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  804c67:	41 0f b6 3f          	movzbl (%r15),%edi
+  804c6b:	48 89 ca             	mov    %rcx,%rdx
+  804c6e:	48 c1 ea 03          	shr    $0x3,%rdx
+  804c72:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  804c79:	08 10 20 
+  804c7c:	48 f7 e2             	mul    %rdx
+  804c7f:	48 c1 ea 06          	shr    $0x6,%rdx
+  804c83:	48 89 d0             	mov    %rdx,%rax
+  804c86:	48 c1 e0 09          	shl    $0x9,%rax
+  804c8a:	48 29 d0             	sub    %rdx,%rax
+  804c8d:	48 c1 e0 03          	shl    $0x3,%rax
+  804c91:	48 29 c1             	sub    %rax,%rcx
+  804c94:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  804c99:	83 c6 01             	add    $0x1,%esi
+  804c9c:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  804c9f:	49 83 c7 01          	add    $0x1,%r15
+  804ca3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804ca7:	49 39 c7             	cmp    %rax,%r15
+  804caa:	0f 85 75 ff ff ff    	jne    804c25 <devpipe_write+0x57>
+    return n;
+  804cb0:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804cb4:	eb 05                	jmp    804cbb <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  804cb6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804cbb:	48 83 c4 18          	add    $0x18,%rsp
+  804cbf:	5b                   	pop    %rbx
+  804cc0:	41 5c                	pop    %r12
+  804cc2:	41 5d                	pop    %r13
+  804cc4:	41 5e                	pop    %r14
+  804cc6:	41 5f                	pop    %r15
+  804cc8:	5d                   	pop    %rbp
+  804cc9:	c3                   	ret
+
+0000000000804cca <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  804cca:	55                   	push   %rbp
+  804ccb:	48 89 e5             	mov    %rsp,%rbp
+  804cce:	41 57                	push   %r15
+  804cd0:	41 56                	push   %r14
+  804cd2:	41 55                	push   %r13
+  804cd4:	41 54                	push   %r12
+  804cd6:	53                   	push   %rbx
+  804cd7:	48 83 ec 18          	sub    $0x18,%rsp
+  804cdb:	49 89 fc             	mov    %rdi,%r12
+  804cde:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  804ce2:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  804ce6:	48 b8 96 3f 80 00 00 	movabs $0x803f96,%rax
+  804ced:	00 00 00 
+  804cf0:	ff d0                	call   *%rax
+  804cf2:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  804cf5:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  804cfb:	49 bd 76 36 80 00 00 	movabs $0x803676,%r13
+  804d02:	00 00 00 
+            sys_yield();
+  804d05:	49 be 13 36 80 00 00 	movabs $0x803613,%r14
+  804d0c:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  804d0f:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  804d14:	74 7d                	je     804d93 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  804d16:	8b 03                	mov    (%rbx),%eax
+  804d18:	3b 43 04             	cmp    0x4(%rbx),%eax
+  804d1b:	75 26                	jne    804d43 <devpipe_read+0x79>
+            if (i > 0) return i;
+  804d1d:	4d 85 ff             	test   %r15,%r15
+  804d20:	75 77                	jne    804d99 <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  804d22:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  804d27:	48 89 da             	mov    %rbx,%rdx
+  804d2a:	be 00 10 00 00       	mov    $0x1000,%esi
+  804d2f:	4c 89 e7             	mov    %r12,%rdi
+  804d32:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  804d35:	85 c0                	test   %eax,%eax
+  804d37:	74 72                	je     804dab <devpipe_read+0xe1>
+            sys_yield();
+  804d39:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  804d3c:	8b 03                	mov    (%rbx),%eax
+  804d3e:	3b 43 04             	cmp    0x4(%rbx),%eax
+  804d41:	74 df                	je     804d22 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  804d43:	48 63 c8             	movslq %eax,%rcx
+  804d46:	48 89 ca             	mov    %rcx,%rdx
+  804d49:	48 c1 ea 03          	shr    $0x3,%rdx
+  804d4d:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  804d54:	08 10 20 
+  804d57:	48 89 d0             	mov    %rdx,%rax
+  804d5a:	48 f7 e6             	mul    %rsi
+  804d5d:	48 c1 ea 06          	shr    $0x6,%rdx
+  804d61:	48 89 d0             	mov    %rdx,%rax
+  804d64:	48 c1 e0 09          	shl    $0x9,%rax
+  804d68:	48 29 d0             	sub    %rdx,%rax
+  804d6b:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  804d72:	00 
+  804d73:	48 89 c8             	mov    %rcx,%rax
+  804d76:	48 29 d0             	sub    %rdx,%rax
+  804d79:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  804d7e:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  804d82:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  804d86:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  804d89:	49 83 c7 01          	add    $0x1,%r15
+  804d8d:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  804d91:	75 83                	jne    804d16 <devpipe_read+0x4c>
+    return n;
+  804d93:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804d97:	eb 03                	jmp    804d9c <devpipe_read+0xd2>
+            if (i > 0) return i;
+  804d99:	4c 89 f8             	mov    %r15,%rax
+}
+  804d9c:	48 83 c4 18          	add    $0x18,%rsp
+  804da0:	5b                   	pop    %rbx
+  804da1:	41 5c                	pop    %r12
+  804da3:	41 5d                	pop    %r13
+  804da5:	41 5e                	pop    %r14
+  804da7:	41 5f                	pop    %r15
+  804da9:	5d                   	pop    %rbp
+  804daa:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  804dab:	b8 00 00 00 00       	mov    $0x0,%eax
+  804db0:	eb ea                	jmp    804d9c <devpipe_read+0xd2>
+
+0000000000804db2 <pipe>:
+pipe(int pfd[2]) {
+  804db2:	55                   	push   %rbp
+  804db3:	48 89 e5             	mov    %rsp,%rbp
+  804db6:	41 55                	push   %r13
+  804db8:	41 54                	push   %r12
+  804dba:	53                   	push   %rbx
+  804dbb:	48 81 ec b8 00 00 00 	sub    $0xb8,%rsp
+  804dc2:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  804dc5:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  804dc9:	48 b8 2b 40 80 00 00 	movabs $0x80402b,%rax
+  804dd0:	00 00 00 
+  804dd3:	ff d0                	call   *%rax
+  804dd5:	89 c3                	mov    %eax,%ebx
+  804dd7:	85 c0                	test   %eax,%eax
+  804dd9:	0f 88 51 01 00 00    	js     804f30 <pipe+0x17e>
+        (res = fd_alloc_from(fd2num(fd0) + 1, &fd1)) < 0) goto err;
+  804ddf:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  804de3:	48 b8 84 3f 80 00 00 	movabs $0x803f84,%rax
+  804dea:	00 00 00 
+  804ded:	ff d0                	call   *%rax
+  804def:	8d 78 01             	lea    0x1(%rax),%edi
+  804df2:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  804df6:	48 b8 b2 3f 80 00 00 	movabs $0x803fb2,%rax
+  804dfd:	00 00 00 
+  804e00:	ff d0                	call   *%rax
+  804e02:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  804e04:	85 c0                	test   %eax,%eax
+  804e06:	0f 88 24 01 00 00    	js     804f30 <pipe+0x17e>
+    va = fd2data(fd0);
+  804e0c:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  804e10:	48 bb 96 3f 80 00 00 	movabs $0x803f96,%rbx
+  804e17:	00 00 00 
+  804e1a:	ff d3                	call   *%rbx
+  804e1c:	49 89 c5             	mov    %rax,%r13
+    struct RegionOp ops[] = {
+  804e1f:	48 8d bd 30 ff ff ff 	lea    -0xd0(%rbp),%rdi
+  804e26:	b9 14 00 00 00       	mov    $0x14,%ecx
+  804e2b:	b8 00 00 00 00       	mov    $0x0,%eax
+  804e30:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+  804e33:	c7 85 34 ff ff ff 46 	movl   $0x46,-0xcc(%rbp)
+  804e3a:	00 00 00 
+  804e3d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804e41:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+  804e48:	48 c7 85 50 ff ff ff 	movq   $0x1000,-0xb0(%rbp)
+  804e4f:	00 10 00 00 
+  804e53:	c7 85 5c ff ff ff 46 	movl   $0x46,-0xa4(%rbp)
+  804e5a:	00 00 00 
+            {.type = REGION_ALLOC, .dstva = (uintptr_t)fd1, .size = PAGE_SIZE, .perm = PROT_RW | PROT_SHARE},
+  804e5d:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+    struct RegionOp ops[] = {
+  804e61:	48 89 bd 70 ff ff ff 	mov    %rdi,-0x90(%rbp)
+  804e68:	48 c7 85 78 ff ff ff 	movq   $0x1000,-0x88(%rbp)
+  804e6f:	00 10 00 00 
+  804e73:	c7 45 84 46 00 00 00 	movl   $0x46,-0x7c(%rbp)
+  804e7a:	4c 89 6d 98          	mov    %r13,-0x68(%rbp)
+  804e7e:	48 c7 45 a0 00 10 00 	movq   $0x1000,-0x60(%rbp)
+  804e85:	00 
+  804e86:	c7 45 a8 01 00 00 00 	movl   $0x1,-0x58(%rbp)
+  804e8d:	c7 45 ac 46 00 00 00 	movl   $0x46,-0x54(%rbp)
+  804e94:	4c 89 6d b8          	mov    %r13,-0x48(%rbp)
+            {.type = REGION_MAP, .srcva = (uintptr_t)va, .dstva = (uintptr_t)fd2data(fd1), .size = PAGE_SIZE, .perm = PROT_RW | PROT_SHARE},
+  804e98:	ff d3                	call   *%rbx
+    struct RegionOp ops[] = {
+  804e9a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  804e9e:	48 c7 45 c8 00 10 00 	movq   $0x1000,-0x38(%rbp)
+  804ea5:	00 
+    if ((res = sys_region_batch(ops, sizeof ops / sizeof *ops)) < 0) goto err1;
+  804ea6:	be 04 00 00 00       	mov    $0x4,%esi
+  804eab:	48 8d bd 30 ff ff ff 	lea    -0xd0(%rbp),%rdi
+  804eb2:	48 b8 d5 37 80 00 00 	movabs $0x8037d5,%rax
+  804eb9:	00 00 00 
+  804ebc:	ff d0                	call   *%rax
+  804ebe:	89 c3                	mov    %eax,%ebx
+  804ec0:	85 c0                	test   %eax,%eax
+  804ec2:	0f 88 ad 00 00 00    	js     804f75 <pipe+0x1c3>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  804ec8:	be 00 10 00 00       	mov    $0x1000,%esi
+  804ecd:	4c 89 ef             	mov    %r13,%rdi
+  804ed0:	48 b8 44 36 80 00 00 	movabs $0x803644,%rax
+  804ed7:	00 00 00 
+  804eda:	ff d0                	call   *%rax
+  804edc:	83 f8 02             	cmp    $0x2,%eax
+  804edf:	75 5f                	jne    804f40 <pipe+0x18e>
+    fd0->fd_dev_id = devpipe.dev_id;
+  804ee1:	a1 e0 b0 80 00 00 00 	movabs 0x80b0e0,%eax
+  804ee8:	00 00 
+  804eea:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  804eee:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  804ef0:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  804ef4:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  804efb:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  804eff:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  804f01:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804f05:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  804f0c:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  804f10:	48 bb 84 3f 80 00 00 	movabs $0x803f84,%rbx
+  804f17:	00 00 00 
+  804f1a:	ff d3                	call   *%rbx
+  804f1c:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  804f20:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  804f24:	ff d3                	call   *%rbx
+  804f26:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  804f2b:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  804f30:	89 d8                	mov    %ebx,%eax
+  804f32:	48 81 c4 b8 00 00 00 	add    $0xb8,%rsp
+  804f39:	5b                   	pop    %rbx
+  804f3a:	41 5c                	pop    %r12
+  804f3c:	41 5d                	pop    %r13
+  804f3e:	5d                   	pop    %rbp
+  804f3f:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  804f40:	48 b9 58 61 80 00 00 	movabs $0x806158,%rcx
+  804f47:	00 00 00 
+  804f4a:	48 ba 1d 55 80 00 00 	movabs $0x80551d,%rdx
+  804f51:	00 00 00 
+  804f54:	be 33 00 00 00       	mov    $0x33,%esi
+  804f59:	48 bf 47 61 80 00 00 	movabs $0x806147,%rdi
+  804f60:	00 00 00 
+  804f63:	b8 00 00 00 00       	mov    $0x0,%eax
+  804f68:	49 b8 7d 26 80 00 00 	movabs $0x80267d,%r8
+  804f6f:	00 00 00 
+  804f72:	41 ff d0             	call   *%r8
+        ops[i].type = REGION_UNMAP;
+  804f75:	c7 85 30 ff ff ff 02 	movl   $0x2,-0xd0(%rbp)
+  804f7c:	00 00 00 
+  804f7f:	c7 85 58 ff ff ff 02 	movl   $0x2,-0xa8(%rbp)
+  804f86:	00 00 00 
+  804f89:	c7 45 80 02 00 00 00 	movl   $0x2,-0x80(%rbp)
+  804f90:	c7 45 a8 02 00 00 00 	movl   $0x2,-0x58(%rbp)
+    sys_region_batch(ops, sizeof ops / sizeof *ops);
+  804f97:	be 04 00 00 00       	mov    $0x4,%esi
+  804f9c:	48 8d bd 30 ff ff ff 	lea    -0xd0(%rbp),%rdi
+  804fa3:	48 b8 d5 37 80 00 00 	movabs $0x8037d5,%rax
+  804faa:	00 00 00 
+  804fad:	ff d0                	call   *%rax
+  804faf:	e9 7c ff ff ff       	jmp    804f30 <pipe+0x17e>
+
+0000000000804fb4 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  804fb4:	55                   	push   %rbp
+  804fb5:	48 89 e5             	mov    %rsp,%rbp
+  804fb8:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  804fbc:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  804fc0:	48 b8 45 40 80 00 00 	movabs $0x804045,%rax
+  804fc7:	00 00 00 
+  804fca:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  804fcc:	85 c0                	test   %eax,%eax
+  804fce:	78 35                	js     805005 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  804fd0:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  804fd4:	48 b8 96 3f 80 00 00 	movabs $0x803f96,%rax
+  804fdb:	00 00 00 
+  804fde:	ff d0                	call   *%rax
+  804fe0:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  804fe3:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  804fe8:	be 00 10 00 00       	mov    $0x1000,%esi
+  804fed:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  804ff1:	48 b8 76 36 80 00 00 	movabs $0x803676,%rax
+  804ff8:	00 00 00 
+  804ffb:	ff d0                	call   *%rax
+  804ffd:	85 c0                	test   %eax,%eax
+  804fff:	0f 94 c0             	sete   %al
+  805002:	0f b6 c0             	movzbl %al,%eax
+}
+  805005:	c9                   	leave
+  805006:	c3                   	ret
+
+0000000000805007 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  805007:	48 89 f8             	mov    %rdi,%rax
+  80500a:	48 c1 e8 27          	shr    $0x27,%rax
+  80500e:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  805015:	01 00 00 
+  805018:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80501c:	f6 c2 01             	test   $0x1,%dl
+  80501f:	74 6d                	je     80508e <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  805021:	48 89 f8             	mov    %rdi,%rax
+  805024:	48 c1 e8 1e          	shr    $0x1e,%rax
+  805028:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  80502f:	01 00 00 
+  805032:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  805036:	f6 c2 01             	test   $0x1,%dl
+  805039:	74 62                	je     80509d <get_uvpt_entry+0x96>
+  80503b:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  805042:	01 00 00 
+  805045:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  805049:	f6 c2 80             	test   $0x80,%dl
+  80504c:	75 4f                	jne    80509d <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  80504e:	48 89 f8             	mov    %rdi,%rax
+  805051:	48 c1 e8 15          	shr    $0x15,%rax
+  805055:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  80505c:	01 00 00 
+  80505f:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  805063:	f6 c2 01             	test   $0x1,%dl
+  805066:	74 44                	je     8050ac <get_uvpt_entry+0xa5>
+  805068:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  80506f:	01 00 00 
+  805072:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  805076:	f6 c2 80             	test   $0x80,%dl
+  805079:	75 31                	jne    8050ac <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  80507b:	48 c1 ef 0c          	shr    $0xc,%rdi
+  80507f:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  805086:	01 00 00 
+  805089:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  80508d:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  80508e:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  805095:	01 00 00 
+  805098:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80509c:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  80509d:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8050a4:	01 00 00 
+  8050a7:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8050ab:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8050ac:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8050b3:	01 00 00 
+  8050b6:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8050ba:	c3                   	ret
+
+00000000008050bb <get_prot>:
+
+int
+get_prot(void *va) {
+  8050bb:	55                   	push   %rbp
+  8050bc:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8050bf:	48 b8 07 50 80 00 00 	movabs $0x805007,%rax
+  8050c6:	00 00 00 
+  8050c9:	ff d0                	call   *%rax
+  8050cb:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  8050ce:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  8050d3:	89 c1                	mov    %eax,%ecx
+  8050d5:	83 c9 04             	or     $0x4,%ecx
+  8050d8:	f6 c2 01             	test   $0x1,%dl
+  8050db:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  8050de:	89 c1                	mov    %eax,%ecx
+  8050e0:	83 c9 02             	or     $0x2,%ecx
+  8050e3:	f6 c2 02             	test   $0x2,%dl
+  8050e6:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  8050e9:	89 c1                	mov    %eax,%ecx
+  8050eb:	83 c9 01             	or     $0x1,%ecx
+  8050ee:	48 85 d2             	test   %rdx,%rdx
+  8050f1:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  8050f4:	89 c1                	mov    %eax,%ecx
+  8050f6:	83 c9 40             	or     $0x40,%ecx
+  8050f9:	f6 c6 04             	test   $0x4,%dh
+  8050fc:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  8050ff:	5d                   	pop    %rbp
+  805100:	c3                   	ret
+
+0000000000805101 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  805101:	55                   	push   %rbp
+  805102:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  805105:	48 b8 07 50 80 00 00 	movabs $0x805007,%rax
+  80510c:	00 00 00 
+  80510f:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  805111:	48 c1 e8 06          	shr    $0x6,%rax
+  805115:	83 e0 01             	and    $0x1,%eax
+}
+  805118:	5d                   	pop    %rbp
+  805119:	c3                   	ret
+
+000000000080511a <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  80511a:	55                   	push   %rbp
+  80511b:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  80511e:	48 b8 07 50 80 00 00 	movabs $0x805007,%rax
+  805125:	00 00 00 
+  805128:	ff d0                	call   *%rax
+  80512a:	83 e0 01             	and    $0x1,%eax
+}
+  80512d:	5d                   	pop    %rbp
+  80512e:	c3                   	ret
+
+000000000080512f <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  80512f:	55                   	push   %rbp
+  805130:	48 89 e5             	mov    %rsp,%rbp
+  805133:	41 57                	push   %r15
+  805135:	41 56                	push   %r14
+  805137:	41 55                	push   %r13
+  805139:	41 54                	push   %r12
+  80513b:	53                   	push   %rbx
+  80513c:	48 83 ec 38          	sub    $0x38,%rsp
+  805140:	49 89 f7             	mov    %rsi,%r15
+  805143:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+                    }
+                    continue;
+                }
+                for (int ptei = 0; ptei < PT_ENTRY_COUNT; ptei++) {
+                    uintptr_t pte_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, pdei, ptei, 0);
+                    pte_t pte = uvpt[VPT(pte_addr)];
+  805149:	49 bd 00 00 00 00 00 	movabs $0x10000000000,%r13
+  805150:	01 00 00 
+  805153:	4d 89 e6             	mov    %r12,%r14
+  805156:	49 89 fc             	mov    %rdi,%r12
+  805159:	e9 19 01 00 00       	jmp    805277 <foreach_shared_region+0x148>
+  80515e:	48 89 5d b0          	mov    %rbx,-0x50(%rbp)
+  805162:	4c 89 75 a8          	mov    %r14,-0x58(%rbp)
+  805166:	eb 52                	jmp    8051ba <foreach_shared_region+0x8b>
+                for (int ptei = 0; ptei < PT_ENTRY_COUNT; ptei++) {
+  805168:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  80516f:	48 81 fb 00 00 20 00 	cmp    $0x200000,%rbx
+  805176:	74 2e                	je     8051a6 <foreach_shared_region+0x77>
+                    uintptr_t pte_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, pdei, ptei, 0);
+  805178:	48 89 df             	mov    %rbx,%rdi
+  80517b:	4c 09 f7             	or     %r14,%rdi
+                    pte_t pte = uvpt[VPT(pte_addr)];
+  80517e:	48 89 f8             	mov    %rdi,%rax
+  805181:	48 c1 e8 0c          	shr    $0xc,%rax
+  805185:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+                    if ((pte & PTE_P) && (pte & PTE_SHARE)) {
+  80518a:	25 01 04 00 00       	and    $0x401,%eax
+  80518f:	48 3d 01 04 00 00    	cmp    $0x401,%rax
+  805195:	75 d1                	jne    805168 <foreach_shared_region+0x39>
+                        fun((void*)pte_addr, (void*)(pte_addr + PAGE_SIZE), arg);
+  805197:	48 8d b7 00 10 00 00 	lea    0x1000(%rdi),%rsi
+  80519e:	4c 89 fa             	mov    %r15,%rdx
+  8051a1:	41 ff d4             	call   *%r12
+  8051a4:	eb c2                	jmp    805168 <foreach_shared_region+0x39>
+            for (int pdei = 0; pdei < PD_ENTRY_COUNT; pdei++) {
+  8051a6:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  8051ad:	00 
+  8051ae:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8051b2:	48 3d 00 00 00 40    	cmp    $0x40000000,%rax
+  8051b8:	74 46                	je     805200 <foreach_shared_region+0xd1>
+                uintptr_t pde_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, pdei, 0, 0);
+  8051ba:	4c 8b 75 c8          	mov    -0x38(%rbp),%r14
+  8051be:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8051c2:	49 09 c6             	or     %rax,%r14
+                pde_t pde = uvpd[VPD(pde_addr)];
+  8051c5:	4c 89 f0             	mov    %r14,%rax
+  8051c8:	48 c1 e8 15          	shr    $0x15,%rax
+  8051cc:	48 b9 00 00 00 80 00 	movabs $0x10080000000,%rcx
+  8051d3:	01 00 00 
+  8051d6:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+                if (!(pde & PTE_P)) {
+  8051da:	a8 01                	test   $0x1,%al
+  8051dc:	74 c8                	je     8051a6 <foreach_shared_region+0x77>
+                if (pde & PTE_PS) {
+  8051de:	48 89 c3             	mov    %rax,%rbx
+  8051e1:	81 e3 80 00 00 00    	and    $0x80,%ebx
+  8051e7:	74 8f                	je     805178 <foreach_shared_region+0x49>
+                    if (pde & PTE_SHARE) {
+  8051e9:	f6 c4 04             	test   $0x4,%ah
+  8051ec:	74 b8                	je     8051a6 <foreach_shared_region+0x77>
+                        fun((void*)pde_addr, (void*)(pde_addr + 1024 * 1024 * 2), arg);
+  8051ee:	49 8d b6 00 00 20 00 	lea    0x200000(%r14),%rsi
+  8051f5:	4c 89 fa             	mov    %r15,%rdx
+  8051f8:	4c 89 f7             	mov    %r14,%rdi
+  8051fb:	41 ff d4             	call   *%r12
+  8051fe:	eb a6                	jmp    8051a6 <foreach_shared_region+0x77>
+  805200:	48 8b 5d b0          	mov    -0x50(%rbp),%rbx
+  805204:	4c 8b 75 a8          	mov    -0x58(%rbp),%r14
+        for (int pdpei = 0; pdpei < PDP_ENTRY_COUNT; pdpei++) {
+  805208:	48 81 c3 00 00 00 40 	add    $0x40000000,%rbx
+  80520f:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  805216:	00 00 00 
+  805219:	48 39 c3             	cmp    %rax,%rbx
+  80521c:	74 4c                	je     80526a <foreach_shared_region+0x13b>
+            uintptr_t pdpe_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, 0, 0, 0);
+  80521e:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  805222:	48 09 d8             	or     %rbx,%rax
+  805225:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+            pdpe_t pdpe = uvpdp[VPDP(pdpe_addr)];
+  805229:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80522d:	48 b9 00 00 40 80 00 	movabs $0x10080400000,%rcx
+  805234:	01 00 00 
+  805237:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+            if (!(pdpe & PTE_P)) {
+  80523b:	a8 01                	test   $0x1,%al
+  80523d:	74 c9                	je     805208 <foreach_shared_region+0xd9>
+            if (pdpe & PTE_PS) {
+  80523f:	48 89 c1             	mov    %rax,%rcx
+  805242:	81 e1 80 00 00 00    	and    $0x80,%ecx
+  805248:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  80524c:	0f 84 0c ff ff ff    	je     80515e <foreach_shared_region+0x2f>
+                if (pdpe & PTE_SHARE) {
+  805252:	f6 c4 04             	test   $0x4,%ah
+  805255:	74 b1                	je     805208 <foreach_shared_region+0xd9>
+                    fun((void*)pdpe_addr, (void*)(pdpe_addr + 1024 * 1024 * 1024), arg); 
+  805257:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  80525b:	48 8d b7 00 00 00 40 	lea    0x40000000(%rdi),%rsi
+  805262:	4c 89 fa             	mov    %r15,%rdx
+  805265:	41 ff d4             	call   *%r12
+  805268:	eb 9e                	jmp    805208 <foreach_shared_region+0xd9>
+    for (int pml4ei = 0; pml4ei < PML4_ENTRY_COUNT; pml4ei++) {
+  80526a:	49 83 c6 01          	add    $0x1,%r14
+  80526e:	49 81 fe 00 02 00 00 	cmp    $0x200,%r14
+  805275:	74 24                	je     80529b <foreach_shared_region+0x16c>
+        pml4e_t pml4e = uvpml4[VPML4(pml4_addr)];
+  805277:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  80527e:	01 00 00 
+  805281:	4a 8b 04 f0          	mov    (%rax,%r14,8),%rax
+        if (!(pml4e & PTE_P)) {
+  805285:	a8 01                	test   $0x1,%al
+  805287:	74 e1                	je     80526a <foreach_shared_region+0x13b>
+  805289:	4c 89 f0             	mov    %r14,%rax
+  80528c:	48 c1 e0 27          	shl    $0x27,%rax
+  805290:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  805294:	bb 00 00 00 00       	mov    $0x0,%ebx
+  805299:	eb 83                	jmp    80521e <foreach_shared_region+0xef>
+            }
+        }
+    }
+    
+    return 0;
+}
+  80529b:	b8 00 00 00 00       	mov    $0x0,%eax
+  8052a0:	48 83 c4 38          	add    $0x38,%rsp
+  8052a4:	5b                   	pop    %rbx
+  8052a5:	41 5c                	pop    %r12
+  8052a7:	41 5d                	pop    %r13
+  8052a9:	41 5e                	pop    %r14
+  8052ab:	41 5f                	pop    %r15
+  8052ad:	5d                   	pop    %rbp
+  8052ae:	c3                   	ret
+
+00000000008052af <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  8052af:	b8 00 00 00 00       	mov    $0x0,%eax
+  8052b4:	c3                   	ret
+
+00000000008052b5 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  8052b5:	55                   	push   %rbp
+  8052b6:	48 89 e5             	mov    %rsp,%rbp
+  8052b9:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  8052bc:	48 be 7c 61 80 00 00 	movabs $0x80617c,%rsi
+  8052c3:	00 00 00 
+  8052c6:	48 b8 f2 30 80 00 00 	movabs $0x8030f2,%rax
+  8052cd:	00 00 00 
+  8052d0:	ff d0                	call   *%rax
+    return 0;
+}
+  8052d2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8052d7:	5d                   	pop    %rbp
+  8052d8:	c3                   	ret
+
+00000000008052d9 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8052d9:	55                   	push   %rbp
+  8052da:	48 89 e5             	mov    %rsp,%rbp
+  8052dd:	41 57                	push   %r15
+  8052df:	41 56                	push   %r14
+  8052e1:	41 55                	push   %r13
+  8052e3:	41 54                	push   %r12
+  8052e5:	53                   	push   %rbx
+  8052e6:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  8052ed:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  8052f4:	48 85 d2             	test   %rdx,%rdx
+  8052f7:	74 7a                	je     805373 <devcons_write+0x9a>
+  8052f9:	49 89 d6             	mov    %rdx,%r14
+  8052fc:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  805302:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  805307:	49 bf ec 32 80 00 00 	movabs $0x8032ec,%r15
+  80530e:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  805311:	4c 89 f3             	mov    %r14,%rbx
+  805314:	48 29 f3             	sub    %rsi,%rbx
+  805317:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  80531c:	48 39 c3             	cmp    %rax,%rbx
+  80531f:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  805323:	4c 63 eb             	movslq %ebx,%r13
+  805326:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  80532d:	48 01 c6             	add    %rax,%rsi
+  805330:	4c 89 ea             	mov    %r13,%rdx
+  805333:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  80533a:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  80533d:	4c 89 ee             	mov    %r13,%rsi
+  805340:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  805347:	48 b8 19 35 80 00 00 	movabs $0x803519,%rax
+  80534e:	00 00 00 
+  805351:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  805353:	41 01 dc             	add    %ebx,%r12d
+  805356:	49 63 f4             	movslq %r12d,%rsi
+  805359:	4c 39 f6             	cmp    %r14,%rsi
+  80535c:	72 b3                	jb     805311 <devcons_write+0x38>
+    return res;
+  80535e:	49 63 c4             	movslq %r12d,%rax
+}
+  805361:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  805368:	5b                   	pop    %rbx
+  805369:	41 5c                	pop    %r12
+  80536b:	41 5d                	pop    %r13
+  80536d:	41 5e                	pop    %r14
+  80536f:	41 5f                	pop    %r15
+  805371:	5d                   	pop    %rbp
+  805372:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  805373:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  805379:	eb e3                	jmp    80535e <devcons_write+0x85>
+
+000000000080537b <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  80537b:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  80537e:	ba 00 00 00 00       	mov    $0x0,%edx
+  805383:	48 85 c0             	test   %rax,%rax
+  805386:	74 55                	je     8053dd <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  805388:	55                   	push   %rbp
+  805389:	48 89 e5             	mov    %rsp,%rbp
+  80538c:	41 55                	push   %r13
+  80538e:	41 54                	push   %r12
+  805390:	53                   	push   %rbx
+  805391:	48 83 ec 08          	sub    $0x8,%rsp
+  805395:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  805398:	48 bb 46 35 80 00 00 	movabs $0x803546,%rbx
+  80539f:	00 00 00 
+  8053a2:	49 bc 13 36 80 00 00 	movabs $0x803613,%r12
+  8053a9:	00 00 00 
+  8053ac:	eb 03                	jmp    8053b1 <devcons_read+0x36>
+  8053ae:	41 ff d4             	call   *%r12
+  8053b1:	ff d3                	call   *%rbx
+  8053b3:	85 c0                	test   %eax,%eax
+  8053b5:	74 f7                	je     8053ae <devcons_read+0x33>
+    if (c < 0) return c;
+  8053b7:	48 63 d0             	movslq %eax,%rdx
+  8053ba:	78 13                	js     8053cf <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  8053bc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8053c1:	83 f8 04             	cmp    $0x4,%eax
+  8053c4:	74 09                	je     8053cf <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  8053c6:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  8053ca:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  8053cf:	48 89 d0             	mov    %rdx,%rax
+  8053d2:	48 83 c4 08          	add    $0x8,%rsp
+  8053d6:	5b                   	pop    %rbx
+  8053d7:	41 5c                	pop    %r12
+  8053d9:	41 5d                	pop    %r13
+  8053db:	5d                   	pop    %rbp
+  8053dc:	c3                   	ret
+  8053dd:	48 89 d0             	mov    %rdx,%rax
+  8053e0:	c3                   	ret
+
+00000000008053e1 <cputchar>:
+cputchar(int ch) {
+  8053e1:	55                   	push   %rbp
+  8053e2:	48 89 e5             	mov    %rsp,%rbp
+  8053e5:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  8053e9:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  8053ed:	be 01 00 00 00       	mov    $0x1,%esi
+  8053f2:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  8053f6:	48 b8 19 35 80 00 00 	movabs $0x803519,%rax
+  8053fd:	00 00 00 
+  805400:	ff d0                	call   *%rax
+}
+  805402:	c9                   	leave
+  805403:	c3                   	ret
+
+0000000000805404 <getchar>:
+getchar(void) {
+  805404:	55                   	push   %rbp
+  805405:	48 89 e5             	mov    %rsp,%rbp
+  805408:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  80540c:	ba 01 00 00 00       	mov    $0x1,%edx
+  805411:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  805415:	bf 00 00 00 00       	mov    $0x0,%edi
+  80541a:	48 b8 28 43 80 00 00 	movabs $0x804328,%rax
+  805421:	00 00 00 
+  805424:	ff d0                	call   *%rax
+  805426:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  805428:	85 c0                	test   %eax,%eax
+  80542a:	78 06                	js     805432 <getchar+0x2e>
+  80542c:	74 08                	je     805436 <getchar+0x32>
+  80542e:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  805432:	89 d0                	mov    %edx,%eax
+  805434:	c9                   	leave
+  805435:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  805436:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  80543b:	eb f5                	jmp    805432 <getchar+0x2e>
+
+000000000080543d <iscons>:
+iscons(int fdnum) {
+  80543d:	55                   	push   %rbp
+  80543e:	48 89 e5             	mov    %rsp,%rbp
+  805441:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  805445:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  805449:	48 b8 45 40 80 00 00 	movabs $0x804045,%rax
+  805450:	00 00 00 
+  805453:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  805455:	85 c0                	test   %eax,%eax
+  805457:	78 18                	js     805471 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  805459:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80545d:	48 b8 20 b1 80 00 00 	movabs $0x80b120,%rax
+  805464:	00 00 00 
+  805467:	8b 00                	mov    (%rax),%eax
+  805469:	39 02                	cmp    %eax,(%rdx)
+  80546b:	0f 94 c0             	sete   %al
+  80546e:	0f b6 c0             	movzbl %al,%eax
+}
+  805471:	c9                   	leave
+  805472:	c3                   	ret
+
+0000000000805473 <opencons>:
+opencons(void) {
+  805473:	55                   	push   %rbp
+  805474:	48 89 e5             	mov    %rsp,%rbp
+  805477:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  80547b:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  80547f:	48 b8 2b 40 80 00 00 	movabs $0x80402b,%rax
+  805486:	00 00 00 
+  805489:	ff d0                	call   *%rax
+  80548b:	85 c0                	test   %eax,%eax
+  80548d:	78 49                	js     8054d8 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  80548f:	b9 46 00 00 00       	mov    $0x46,%ecx
+  805494:	ba 00 10 00 00       	mov    $0x1000,%edx
+  805499:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  80549d:	bf 00 00 00 00       	mov    $0x0,%edi
+  8054a2:	48 b8 a2 36 80 00 00 	movabs $0x8036a2,%rax
+  8054a9:	00 00 00 
+  8054ac:	ff d0                	call   *%rax
+  8054ae:	85 c0                	test   %eax,%eax
+  8054b0:	78 26                	js     8054d8 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  8054b2:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8054b6:	a1 20 b1 80 00 00 00 	movabs 0x80b120,%eax
+  8054bd:	00 00 
+  8054bf:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  8054c1:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8054c5:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  8054cc:	48 b8 84 3f 80 00 00 	movabs $0x803f84,%rax
+  8054d3:	00 00 00 
+  8054d6:	ff d0                	call   *%rax
+}
+  8054d8:	c9                   	leave
+  8054d9:	c3                   	ret
+  8054da:	66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+
+00000000008054e0 <__rodata_start>:
+  8054e0:	44                   	rex.R
+  8054e1:	65 76 69             	gs jbe 80554d <__rodata_start+0x6d>
+  8054e4:	63 65 20             	movsxd 0x20(%rbp),%esp
+  8054e7:	31 20                	xor    %esp,(%rax)
+  8054e9:	70 72                	jo     80555d <__rodata_start+0x7d>
+  8054eb:	65 73 65             	gs jae 805553 <__rodata_start+0x73>
+  8054ee:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8054ef:	63 65 3a             	movsxd 0x3a(%rbp),%esp
+  8054f2:	20 25 64 0a 00 62    	and    %ah,0x62000a64(%rip)        # 62805f5c <__bss_end+0x61ff6f5c>
+  8054f8:	61                   	(bad)
+  8054f9:	64 20 64 69 73       	and    %ah,%fs:0x73(%rcx,%rbp,2)
+  8054fe:	6b 20 6e             	imul   $0x6e,(%rax),%esp
+  805501:	75 6d                	jne    805570 <__rodata_start+0x90>
+  805503:	62 65                	(bad)
+  805505:	72 00                	jb     805507 <__rodata_start+0x27>
+  805507:	66 73 2f             	data16 jae 805539 <__rodata_start+0x59>
+  80550a:	69 64 65 2e 63 00 6e 	imul   $0x736e0063,0x2e(%rbp,%riz,2),%esp
+  805511:	73 
+  805512:	65 63 73 20          	movsxd %gs:0x20(%rbx),%esi
+  805516:	3c 3d                	cmp    $0x3d,%al
+  805518:	20 32                	and    %dh,(%rdx)
+  80551a:	35 36 00 61 73       	xor    $0x73610036,%eax
+  80551f:	73 65                	jae    805586 <__rodata_start+0xa6>
+  805521:	72 74                	jb     805597 <__rodata_start+0xb7>
+  805523:	69 6f 6e 20 66 61 69 	imul   $0x69616620,0x6e(%rdi),%ebp
+  80552a:	6c                   	insb   (%dx),%es:(%rdi)
+  80552b:	65 64 3a 20          	gs cmp %fs:(%rax),%ah
+  80552f:	25 73 00 66 0f       	and    $0xf660073,%eax
+  805534:	1f                   	(bad)
+  805535:	44 00 00             	add    %r8b,(%rax)
+  805538:	72 65                	jb     80559f <__rodata_start+0xbf>
+  80553a:	61                   	(bad)
+  80553b:	64 69 6e 67 20 6e 6f 	imul   $0x6e6f6e20,%fs:0x67(%rsi),%ebp
+  805542:	6e 
+  805543:	2d 65 78 69 73       	sub    $0x73697865,%eax
+  805548:	74 65                	je     8055af <__rodata_start+0xcf>
+  80554a:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80554b:	74 20                	je     80556d <__rodata_start+0x8d>
+  80554d:	62                   	(bad)
+  80554e:	6c                   	insb   (%dx),%es:(%rdi)
+  80554f:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805550:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  805553:	25 30 38 78 20       	and    $0x20783830,%eax
+  805558:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805559:	75 74                	jne    8055cf <__rodata_start+0xef>
+  80555b:	20 6f 66             	and    %ch,0x66(%rdi)
+  80555e:	20 25 30 38 78 0a    	and    %ah,0xa783830(%rip)        # af88d94 <__bss_end+0xa779d94>
+  805564:	00 00                	add    %al,(%rax)
+  805566:	00 00                	add    %al,(%rax)
+  805568:	62 61 64 20 62       	(bad)
+  80556d:	6c                   	insb   (%dx),%es:(%rdi)
+  80556e:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80556f:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  805572:	6e                   	outsb  %ds:(%rsi),(%dx)
+  805573:	75 6d                	jne    8055e2 <__rodata_start+0x102>
+  805575:	62 65                	(bad)
+  805577:	72 20                	jb     805599 <__rodata_start+0xb9>
+  805579:	25 30 38 78 20       	and    $0x20783830,%eax
+  80557e:	69 6e 20 64 69 73 6b 	imul   $0x6b736964,0x20(%rsi),%ebp
+  805585:	61                   	(bad)
+  805586:	64 64 72 00          	fs fs jb 80558a <__rodata_start+0xaa>
+  80558a:	00 00                	add    %al,(%rax)
+  80558c:	00 00                	add    %al,(%rax)
+  80558e:	00 00                	add    %al,(%rax)
+  805590:	66 6c                	data16 insb (%dx),%es:(%rdi)
+  805592:	75 73                	jne    805607 <__rodata_start+0x127>
+  805594:	68 5f 62 6c 6f       	push   $0x6f6c625f
+  805599:	63 6b 3a             	movsxd 0x3a(%rbx),%ebp
+  80559c:	20 63 61             	and    %ah,0x61(%rbx)
+  80559f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8055a0:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8055a1:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8055a2:	74 20                	je     8055c4 <__rodata_start+0xe4>
+  8055a4:	6d                   	insl   (%dx),%es:(%rdi)
+  8055a5:	61                   	(bad)
+  8055a6:	70 20                	jo     8055c8 <__rodata_start+0xe8>
+  8055a8:	72 65                	jb     80560f <__rodata_start+0x12f>
+  8055aa:	67 69 6f 6e 00 00 73 	imul   $0x74730000,0x6e(%edi),%ebp
+  8055b1:	74 
+  8055b2:	72 63                	jb     805617 <__rodata_start+0x137>
+  8055b4:	6d                   	insl   (%dx),%es:(%rdi)
+  8055b5:	70 28                	jo     8055df <__rodata_start+0xff>
+  8055b7:	64 69 73 6b 61 64 64 	imul   $0x72646461,%fs:0x6b(%rbx),%esi
+  8055be:	72 
+  8055bf:	28 31                	sub    %dh,(%rcx)
+  8055c1:	29 2c 20             	sub    %ebp,(%rax,%riz,1)
+  8055c4:	22 4f 4f             	and    0x4f(%rdi),%cl
+  8055c7:	50                   	push   %rax
+  8055c8:	53                   	push   %rbx
+  8055c9:	21 5c 6e 22          	and    %ebx,0x22(%rsi,%rbp,2)
+  8055cd:	29 20                	sub    %esp,(%rax)
+  8055cf:	3d 3d 20 30 00       	cmp    $0x30203d,%eax
+  8055d4:	66 73 2f             	data16 jae 805606 <__rodata_start+0x126>
+  8055d7:	62 63 2e 63 00       	(bad)
+  8055dc:	66 6c                	data16 insb (%dx),%es:(%rdi)
+  8055de:	75 73                	jne    805653 <__rodata_start+0x173>
+  8055e0:	68 5f 62 6c 6f       	push   $0x6f6c625f
+  8055e5:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  8055e8:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8055e9:	66 20 62 61          	data16 and %ah,0x61(%rdx)
+  8055ed:	64 20 76 61          	and    %dh,%fs:0x61(%rsi)
+  8055f1:	20 25 70 00 66 6c    	and    %ah,0x6c660070(%rip)        # 6ce65667 <__bss_end+0x6c656667>
+  8055f7:	75 73                	jne    80566c <__rodata_start+0x18c>
+  8055f9:	68 5f 62 6c 6f       	push   $0x6f6c625f
+  8055fe:	63 6b 3a             	movsxd 0x3a(%rbx),%ebp
+  805601:	20 69 64             	and    %ch,0x64(%rcx)
+  805604:	65 5f                	gs pop %rdi
+  805606:	77 72                	ja     80567a <__rodata_start+0x19a>
+  805608:	69 74 65 20 65 72 72 	imul   $0x6f727265,0x20(%rbp,%riz,2),%esi
+  80560f:	6f 
+  805610:	72 00                	jb     805612 <__rodata_start+0x132>
+  805612:	21 69 73             	and    %ebp,0x73(%rcx)
+  805615:	5f                   	pop    %rdi
+  805616:	70 61                	jo     805679 <__rodata_start+0x199>
+  805618:	67 65 5f             	addr32 gs pop %rdi
+  80561b:	64 69 72 74 79 28 61 	imul   $0x64612879,%fs:0x74(%rdx),%esi
+  805622:	64 
+  805623:	64 72 29             	fs jb  80564f <__rodata_start+0x16f>
+  805626:	00 4f 4f             	add    %cl,0x4f(%rdi)
+  805629:	50                   	push   %rax
+  80562a:	53                   	push   %rbx
+  80562b:	21 0a                	and    %ecx,(%rdx)
+  80562d:	00 21                	add    %ah,(%rcx)
+  80562f:	69 73 5f 70 61 67 65 	imul   $0x65676170,0x5f(%rbx),%esi
+  805636:	5f                   	pop    %rdi
+  805637:	64 69 72 74 79 28 64 	imul   $0x69642879,%fs:0x74(%rdx),%esi
+  80563e:	69 
+  80563f:	73 6b                	jae    8056ac <__rodata_start+0x1cc>
+  805641:	61                   	(bad)
+  805642:	64 64 72 28          	fs fs jb 80566e <__rodata_start+0x18e>
+  805646:	31 29                	xor    %ebp,(%rcx)
+  805648:	29 00                	sub    %eax,(%rax)
+  80564a:	21 69 73             	and    %ebp,0x73(%rcx)
+  80564d:	5f                   	pop    %rdi
+  80564e:	70 61                	jo     8056b1 <__rodata_start+0x1d1>
+  805650:	67 65 5f             	addr32 gs pop %rdi
+  805653:	70 72                	jo     8056c7 <__rodata_start+0x1e7>
+  805655:	65 73 65             	gs jae 8056bd <__rodata_start+0x1dd>
+  805658:	6e                   	outsb  %ds:(%rsi),(%dx)
+  805659:	74 28                	je     805683 <__rodata_start+0x1a3>
+  80565b:	64 69 73 6b 61 64 64 	imul   $0x72646461,%fs:0x6b(%rbx),%esi
+  805662:	72 
+  805663:	28 31                	sub    %dh,(%rcx)
+  805665:	29 29                	sub    %ebp,(%rcx)
+  805667:	00 62 6c             	add    %ah,0x6c(%rdx)
+  80566a:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80566b:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  80566e:	63 61 63             	movsxd 0x63(%rcx),%esp
+  805671:	68 65 20 69 73       	push   $0x73692065
+  805676:	20 67 6f             	and    %ah,0x6f(%rdi)
+  805679:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80567a:	64 0a 00             	or     %fs:(%rax),%al
+  80567d:	0f 1f 00             	nopl   (%rax)
+  805680:	62 61 64 20 66       	(bad)
+  805685:	69 6c 65 20 73 79 73 	imul   $0x74737973,0x20(%rbp,%riz,2),%ebp
+  80568c:	74 
+  80568d:	65 6d                	gs insl (%dx),%es:(%rdi)
+  80568f:	20 6d 61             	and    %ch,0x61(%rbp)
+  805692:	67 69 63 20 6e 75 6d 	imul   $0x626d756e,0x20(%ebx),%esp
+  805699:	62 
+  80569a:	65 72 20             	gs jb  8056bd <__rodata_start+0x1dd>
+  80569d:	25 30 38 78 00       	and    $0x783830,%eax
+  8056a2:	66 73 2f             	data16 jae 8056d4 <__rodata_start+0x1f4>
+  8056a5:	66 73 2e             	data16 jae 8056d6 <__rodata_start+0x1f6>
+  8056a8:	63 00                	movsxd (%rax),%eax
+  8056aa:	66 69 6c 65 20 73 79 	imul   $0x7973,0x20(%rbp,%riz,2),%bp
+  8056b1:	73 74                	jae    805727 <__rodata_start+0x247>
+  8056b3:	65 6d                	gs insl (%dx),%es:(%rdi)
+  8056b5:	20 69 73             	and    %ch,0x73(%rcx)
+  8056b8:	20 74 6f 6f          	and    %dh,0x6f(%rdi,%rbp,2)
+  8056bc:	20 6c 61 72          	and    %ch,0x72(%rcx,%riz,2)
+  8056c0:	67 65 00 73 75       	add    %dh,%gs:0x75(%ebx)
+  8056c5:	70 65                	jo     80572c <__rodata_start+0x24c>
+  8056c7:	72 62                	jb     80572b <__rodata_start+0x24b>
+  8056c9:	6c                   	insb   (%dx),%es:(%rdi)
+  8056ca:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8056cb:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  8056ce:	69 73 20 67 6f 6f 64 	imul   $0x646f6f67,0x20(%rbx),%esi
+  8056d5:	0a 00                	or     (%rax),%al
+  8056d7:	61                   	(bad)
+  8056d8:	74 74                	je     80574e <__rodata_start+0x26e>
+  8056da:	65 6d                	gs insl (%dx),%es:(%rdi)
+  8056dc:	70 74                	jo     805752 <__rodata_start+0x272>
+  8056de:	20 74 6f 20          	and    %dh,0x20(%rdi,%rbp,2)
+  8056e2:	66 72 65             	data16 jb 80574a <__rodata_start+0x26a>
+  8056e5:	65 20 7a 65          	and    %bh,%gs:0x65(%rdx)
+  8056e9:	72 6f                	jb     80575a <__rodata_start+0x27a>
+  8056eb:	20 62 6c             	and    %ah,0x6c(%rdx)
+  8056ee:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8056ef:	63 6b 00             	movsxd 0x0(%rbx),%ebp
+  8056f2:	21 62 6c             	and    %esp,0x6c(%rdx)
+  8056f5:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8056f6:	63 6b 5f             	movsxd 0x5f(%rbx),%ebp
+  8056f9:	69 73 5f 66 72 65 65 	imul   $0x65657266,0x5f(%rbx),%esi
+  805700:	28 32                	sub    %dh,(%rdx)
+  805702:	20 2b                	and    %ch,(%rbx)
+  805704:	20 69 29             	and    %ch,0x29(%rcx)
+  805707:	00 21                	add    %ah,(%rcx)
+  805709:	62                   	(bad)
+  80570a:	6c                   	insb   (%dx),%es:(%rdi)
+  80570b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80570c:	63 6b 5f             	movsxd 0x5f(%rbx),%ebp
+  80570f:	69 73 5f 66 72 65 65 	imul   $0x65657266,0x5f(%rbx),%esi
+  805716:	28 31                	sub    %dh,(%rcx)
+  805718:	29 00                	sub    %eax,(%rax)
+  80571a:	21 62 6c             	and    %esp,0x6c(%rdx)
+  80571d:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80571e:	63 6b 5f             	movsxd 0x5f(%rbx),%ebp
+  805721:	69 73 5f 66 72 65 65 	imul   $0x65657266,0x5f(%rbx),%esi
+  805728:	28 30                	sub    %dh,(%rax)
+  80572a:	29 00                	sub    %eax,(%rax)
+  80572c:	62                   	(bad)
+  80572d:	69 74 6d 61 70 20 69 	imul   $0x73692070,0x61(%rbp,%rbp,2),%esi
+  805734:	73 
+  805735:	20 67 6f             	and    %ah,0x6f(%rdi)
+  805738:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805739:	64 0a 00             	or     %fs:(%rax),%al
+  80573c:	28 64 69 72          	sub    %ah,0x72(%rcx,%rbp,2)
+  805740:	2d 3e 66 5f 73       	sub    $0x735f663e,%eax
+  805745:	69 7a 65 20 25 20 42 	imul   $0x42202520,0x65(%rdx),%edi
+  80574c:	4c                   	rex.WR
+  80574d:	4b 53                	rex.WXB push %r11
+  80574f:	49 5a                	rex.WB pop %r10
+  805751:	45 29 20             	sub    %r12d,(%r8)
+  805754:	3d 3d 20 30 00       	cmp    $0x30203d,%eax
+  805759:	77 61                	ja     8057bc <__rodata_start+0x2dc>
+  80575b:	72 6e                	jb     8057cb <__rodata_start+0x2eb>
+  80575d:	69 6e 67 3a 20 66 69 	imul   $0x6966203a,0x67(%rsi),%ebp
+  805764:	6c                   	insb   (%dx),%es:(%rdi)
+  805765:	65 5f                	gs pop %rdi
+  805767:	66 72 65             	data16 jb 8057cf <__rodata_start+0x2ef>
+  80576a:	65 5f                	gs pop %rdi
+  80576c:	62                   	(bad)
+  80576d:	6c                   	insb   (%dx),%es:(%rdi)
+  80576e:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80576f:	63 6b 3a             	movsxd 0x3a(%rbx),%ebp
+  805772:	20 25 69 00 66 90    	and    %ah,-0x6f99ff97(%rip)        # ffffffff90e657e1 <uvpml4+0xfffffeff10a637e1>
+  805778:	49 6e                	rex.WB outsb %ds:(%rsi),(%dx)
+  80577a:	76 61                	jbe    8057dd <__rodata_start+0x2fd>
+  80577c:	6c                   	insb   (%dx),%es:(%rdi)
+  80577d:	69 64 20 72 65 71 75 	imul   $0x65757165,0x72(%rax,%riz,1),%esp
+  805784:	65 
+  805785:	73 74                	jae    8057fb <__rodata_start+0x31b>
+  805787:	20 66 72             	and    %ah,0x72(%rsi)
+  80578a:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80578b:	6d                   	insl   (%dx),%es:(%rdi)
+  80578c:	20 25 30 38 78 3a    	and    %ah,0x3a783830(%rip)        # 3af88fc2 <__bss_end+0x3a779fc2>
+  805792:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  805795:	20 61 72             	and    %ah,0x72(%rcx)
+  805798:	67 75 6d             	addr32 jne 805808 <__rodata_start+0x328>
+  80579b:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  80579d:	74 20                	je     8057bf <__rodata_start+0x2df>
+  80579f:	70 61                	jo     805802 <__rodata_start+0x322>
+  8057a1:	67 65 0a 00          	or     %gs:(%eax),%al
+  8057a5:	00 00                	add    %al,(%rax)
+  8057a7:	00 49 6e             	add    %cl,0x6e(%rcx)
+  8057aa:	76 61                	jbe    80580d <__rodata_start+0x32d>
+  8057ac:	6c                   	insb   (%dx),%es:(%rdi)
+  8057ad:	69 64 20 72 65 71 75 	imul   $0x65757165,0x72(%rax,%riz,1),%esp
+  8057b4:	65 
+  8057b5:	73 74                	jae    80582b <__rodata_start+0x34b>
+  8057b7:	20 63 6f             	and    %ah,0x6f(%rbx)
+  8057ba:	64 65 20 25 64 20 66 	fs and %ah,%gs:0x72662064(%rip)        # 72e67826 <__bss_end+0x72658826>
+  8057c1:	72 
+  8057c2:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8057c3:	6d                   	insl   (%dx),%es:(%rdi)
+  8057c4:	20 25 30 38 78 0a    	and    %ah,0xa783830(%rip)        # af88ffa <__bss_end+0xa779ffa>
+  8057ca:	00 66 73             	add    %ah,0x73(%rsi)
+  8057cd:	00 46 53             	add    %al,0x53(%rsi)
+  8057d0:	20 69 73             	and    %ch,0x73(%rcx)
+  8057d3:	20 72 75             	and    %dh,0x75(%rdx)
+  8057d6:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8057d7:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8057d8:	69 6e 67 0a 00 46 53 	imul   $0x5346000a,0x67(%rsi),%ebp
+  8057df:	20 63 61             	and    %ah,0x61(%rbx)
+  8057e2:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8057e3:	20 64 6f 20          	and    %ah,0x20(%rdi,%rbp,2)
+  8057e7:	49 2f                	rex.WB (bad)
+  8057e9:	4f 0a 00             	rex.WRXB or (%r8),%r8b
+  8057ec:	00 00                	add    %al,(%rax)
+  8057ee:	63 68 65             	movsxd 0x65(%rax),%ebp
+  8057f1:	63 6b 69             	movsxd 0x69(%rbx),%ebp
+  8057f4:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8057f5:	67 20 63 6f          	and    %ah,0x6f(%ebx)
+  8057f9:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8057fa:	73 69                	jae    805865 <__rodata_start+0x385>
+  8057fc:	73 74                	jae    805872 <__rodata_start+0x392>
+  8057fe:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  805800:	63 79 20             	movsxd 0x20(%rcx),%edi
+  805803:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805804:	66 20 25 73 0a 00 21 	data16 and %ah,0x21000a73(%rip)        # 2180627e <__bss_end+0x20ff727e>
+  80580b:	62                   	(bad)
+  80580c:	6c                   	insb   (%dx),%es:(%rdi)
+  80580d:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80580e:	63 6b 5f             	movsxd 0x5f(%rbx),%ebp
+  805811:	69 73 5f 66 72 65 65 	imul   $0x65657266,0x5f(%rbx),%esi
+  805818:	28 2a                	sub    %ch,(%rdx)
+  80581a:	70 64                	jo     805880 <__rodata_start+0x3a0>
+  80581c:	69 73 6b 62 6e 6f 29 	imul   $0x296f6e62,0x6b(%rbx),%esi
+  805823:	00 66 73             	add    %ah,0x73(%rsi)
+  805826:	2f                   	(bad)
+  805827:	74 65                	je     80588e <__rodata_start+0x3ae>
+  805829:	73 74                	jae    80589f <__rodata_start+0x3bf>
+  80582b:	2e 63 00             	cs movsxd (%rax),%eax
+  80582e:	73 79                	jae    8058a9 <__rodata_start+0x3c9>
+  805830:	73 5f                	jae    805891 <__rodata_start+0x3b1>
+  805832:	70 61                	jo     805895 <__rodata_start+0x3b5>
+  805834:	67 65 5f             	addr32 gs pop %rdi
+  805837:	61                   	(bad)
+  805838:	6c                   	insb   (%dx),%es:(%rdi)
+  805839:	6c                   	insb   (%dx),%es:(%rdi)
+  80583a:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80583b:	63 3a                	movsxd (%rdx),%edi
+  80583d:	20 25 69 00 61 6c    	and    %ah,0x6c610069(%rip)        # 6ce158ac <__bss_end+0x6c6068ac>
+  805843:	6c                   	insb   (%dx),%es:(%rdi)
+  805844:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805845:	63 5f 62             	movsxd 0x62(%rdi),%ebx
+  805848:	6c                   	insb   (%dx),%es:(%rdi)
+  805849:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80584a:	63 6b 3a             	movsxd 0x3a(%rbx),%ebp
+  80584d:	20 25 69 00 54 53    	and    %ah,0x53540069(%rip)        # 53d458bc <__bss_end+0x535368bc>
+  805853:	54                   	push   %rsp
+  805854:	42                   	rex.X
+  805855:	49 54                	rex.WB push %r12
+  805857:	28 62 69             	sub    %ah,0x69(%rdx)
+  80585a:	74 73                	je     8058cf <__rodata_start+0x3ef>
+  80585c:	2c 20                	sub    $0x20,%al
+  80585e:	72 29                	jb     805889 <__rodata_start+0x3a9>
+  805860:	00 21                	add    %ah,(%rcx)
+  805862:	54                   	push   %rsp
+  805863:	53                   	push   %rbx
+  805864:	54                   	push   %rsp
+  805865:	42                   	rex.X
+  805866:	49 54                	rex.WB push %r12
+  805868:	28 62 69             	sub    %ah,0x69(%rdx)
+  80586b:	74 6d                	je     8058da <__rodata_start+0x3fa>
+  80586d:	61                   	(bad)
+  80586e:	70 2c                	jo     80589c <__rodata_start+0x3bc>
+  805870:	20 72 29             	and    %dh,0x29(%rdx)
+  805873:	00 61 6c             	add    %ah,0x6c(%rcx)
+  805876:	6c                   	insb   (%dx),%es:(%rdi)
+  805877:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805878:	63 5f 62             	movsxd 0x62(%rdi),%ebx
+  80587b:	6c                   	insb   (%dx),%es:(%rdi)
+  80587c:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80587d:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  805880:	69 73 20 67 6f 6f 64 	imul   $0x646f6f67,0x20(%rbx),%esi
+  805887:	0a 00                	or     (%rax),%al
+  805889:	66 73 20             	data16 jae 8058ac <__rodata_start+0x3cc>
+  80588c:	63 6f 6e             	movsxd 0x6e(%rdi),%ebp
+  80588f:	73 69                	jae    8058fa <__rodata_start+0x41a>
+  805891:	73 74                	jae    805907 <__rodata_start+0x427>
+  805893:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  805895:	63 79 20             	movsxd 0x20(%rcx),%edi
+  805898:	69 73 20 67 6f 6f 64 	imul   $0x646f6f67,0x20(%rbx),%esi
+  80589f:	0a 00                	or     (%rax),%al
+  8058a1:	2f                   	(bad)
+  8058a2:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8058a3:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8058a4:	74 2d                	je     8058d3 <__rodata_start+0x3f3>
+  8058a6:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  8058a8:	75 6e                	jne    805918 <__rodata_start+0x438>
+  8058aa:	64 00 66 69          	add    %ah,%fs:0x69(%rsi)
+  8058ae:	6c                   	insb   (%dx),%es:(%rdi)
+  8058af:	65 5f                	gs pop %rdi
+  8058b1:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8058b2:	70 65                	jo     805919 <__rodata_start+0x439>
+  8058b4:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8058b5:	20 2f                	and    %ch,(%rdi)
+  8058b7:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8058b8:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8058b9:	74 2d                	je     8058e8 <__rodata_start+0x408>
+  8058bb:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  8058bd:	75 6e                	jne    80592d <__rodata_start+0x44d>
+  8058bf:	64 3a 20             	cmp    %fs:(%rax),%ah
+  8058c2:	25 69 00 2f 6e       	and    $0x6e2f0069,%eax
+  8058c7:	65 77 6d             	gs ja  805937 <__rodata_start+0x457>
+  8058ca:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8058cb:	74 64                	je     805931 <__rodata_start+0x451>
+  8058cd:	00 66 69             	add    %ah,0x69(%rsi)
+  8058d0:	6c                   	insb   (%dx),%es:(%rdi)
+  8058d1:	65 5f                	gs pop %rdi
+  8058d3:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8058d4:	70 65                	jo     80593b <__rodata_start+0x45b>
+  8058d6:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8058d7:	20 2f                	and    %ch,(%rdi)
+  8058d9:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8058da:	65 77 6d             	gs ja  80594a <__rodata_start+0x46a>
+  8058dd:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8058de:	74 64                	je     805944 <__rodata_start+0x464>
+  8058e0:	3a 20                	cmp    (%rax),%ah
+  8058e2:	25 69 00 66 69       	and    $0x69660069,%eax
+  8058e7:	6c                   	insb   (%dx),%es:(%rdi)
+  8058e8:	65 5f                	gs pop %rdi
+  8058ea:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8058eb:	70 65                	jo     805952 <__rodata_start+0x472>
+  8058ed:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8058ee:	20 69 73             	and    %ch,0x73(%rcx)
+  8058f1:	20 67 6f             	and    %ah,0x6f(%rdi)
+  8058f4:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8058f5:	64 0a 00             	or     %fs:(%rax),%al
+  8058f8:	66 69 6c 65 5f 67 65 	imul   $0x6567,0x5f(%rbp,%riz,2),%bp
+  8058ff:	74 5f                	je     805960 <__rodata_start+0x480>
+  805901:	62                   	(bad)
+  805902:	6c                   	insb   (%dx),%es:(%rdi)
+  805903:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805904:	63 6b 3a             	movsxd 0x3a(%rbx),%ebp
+  805907:	20 25 69 00 66 69    	and    %ah,0x69660069(%rip)        # 69e65976 <__bss_end+0x69656976>
+  80590d:	6c                   	insb   (%dx),%es:(%rdi)
+  80590e:	65 5f                	gs pop %rdi
+  805910:	67 65 74 5f          	addr32 gs je 805973 <__rodata_start+0x493>
+  805914:	62                   	(bad)
+  805915:	6c                   	insb   (%dx),%es:(%rdi)
+  805916:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805917:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  80591a:	69 73 20 67 6f 6f 64 	imul   $0x646f6f67,0x20(%rbx),%esi
+  805921:	0a 00                	or     (%rax),%al
+  805923:	21 69 73             	and    %ebp,0x73(%rcx)
+  805926:	5f                   	pop    %rdi
+  805927:	70 61                	jo     80598a <__rodata_start+0x4aa>
+  805929:	67 65 5f             	addr32 gs pop %rdi
+  80592c:	64 69 72 74 79 28 62 	imul   $0x6c622879,%fs:0x74(%rdx),%esi
+  805933:	6c 
+  805934:	6b 29 00             	imul   $0x0,(%rcx),%ebp
+  805937:	66 69 6c 65 5f 66 6c 	imul   $0x6c66,0x5f(%rbp,%riz,2),%bp
+  80593e:	75 73                	jne    8059b3 <__rodata_start+0x4d3>
+  805940:	68 20 69 73 20       	push   $0x20736920
+  805945:	67 6f                	outsl  %ds:(%esi),(%dx)
+  805947:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805948:	64 0a 00             	or     %fs:(%rax),%al
+  80594b:	66 69 6c 65 5f 73 65 	imul   $0x6573,0x5f(%rbp,%riz,2),%bp
+  805952:	74 5f                	je     8059b3 <__rodata_start+0x4d3>
+  805954:	73 69                	jae    8059bf <__rodata_start+0x4df>
+  805956:	7a 65                	jp     8059bd <__rodata_start+0x4dd>
+  805958:	3a 20                	cmp    (%rax),%ah
+  80595a:	25 69 00 66 2d       	and    $0x2d660069,%eax
+  80595f:	3e 66 5f             	ds pop %di
+  805962:	64 69 72 65 63 74 5b 	imul   $0x305b7463,%fs:0x65(%rdx),%esi
+  805969:	30 
+  80596a:	5d                   	pop    %rbp
+  80596b:	20 3d 3d 20 30 00    	and    %bh,0x30203d(%rip)        # b079ae <__bss_end+0x2f89ae>
+  805971:	21 69 73             	and    %ebp,0x73(%rcx)
+  805974:	5f                   	pop    %rdi
+  805975:	70 61                	jo     8059d8 <__rodata_start+0x4f8>
+  805977:	67 65 5f             	addr32 gs pop %rdi
+  80597a:	64 69 72 74 79 28 66 	imul   $0x29662879,%fs:0x74(%rdx),%esi
+  805981:	29 
+  805982:	00 66 69             	add    %ah,0x69(%rsi)
+  805985:	6c                   	insb   (%dx),%es:(%rdi)
+  805986:	65 5f                	gs pop %rdi
+  805988:	74 72                	je     8059fc <__rodata_start+0x51c>
+  80598a:	75 6e                	jne    8059fa <__rodata_start+0x51a>
+  80598c:	63 61 74             	movsxd 0x74(%rcx),%esp
+  80598f:	65 20 69 73          	and    %ch,%gs:0x73(%rcx)
+  805993:	20 67 6f             	and    %ah,0x6f(%rdi)
+  805996:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805997:	64 0a 00             	or     %fs:(%rax),%al
+  80599a:	66 69 6c 65 5f 73 65 	imul   $0x6573,0x5f(%rbp,%riz,2),%bp
+  8059a1:	74 5f                	je     805a02 <__rodata_start+0x522>
+  8059a3:	73 69                	jae    805a0e <__rodata_start+0x52e>
+  8059a5:	7a 65                	jp     805a0c <__rodata_start+0x52c>
+  8059a7:	20 32                	and    %dh,(%rdx)
+  8059a9:	3a 20                	cmp    (%rax),%ah
+  8059ab:	25 69 00 66 69       	and    $0x69660069,%eax
+  8059b0:	6c                   	insb   (%dx),%es:(%rdi)
+  8059b1:	65 5f                	gs pop %rdi
+  8059b3:	67 65 74 5f          	addr32 gs je 805a16 <__rodata_start+0x536>
+  8059b7:	62                   	(bad)
+  8059b8:	6c                   	insb   (%dx),%es:(%rdi)
+  8059b9:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8059ba:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  8059bd:	32 3a                	xor    (%rdx),%bh
+  8059bf:	20 25 69 00 66 69    	and    %ah,0x69660069(%rip)        # 69e65a2e <__bss_end+0x69656a2e>
+  8059c5:	6c                   	insb   (%dx),%es:(%rdi)
+  8059c6:	65 20 72 65          	and    %dh,%gs:0x65(%rdx)
+  8059ca:	77 72                	ja     805a3e <__rodata_start+0x55e>
+  8059cc:	69 74 65 20 69 73 20 	imul   $0x67207369,0x20(%rbp,%riz,2),%esi
+  8059d3:	67 
+  8059d4:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8059d5:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8059d6:	64 0a 00             	or     %fs:(%rax),%al
+  8059d9:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+  8059e0:	66 69 6c 65 5f 6f 70 	imul   $0x706f,0x5f(%rbp,%riz,2),%bp
+  8059e7:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  8059e9:	20 2f                	and    %ch,(%rdi)
+  8059eb:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8059ec:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8059ed:	74 2d                	je     805a1c <__rodata_start+0x53c>
+  8059ef:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  8059f1:	75 6e                	jne    805a61 <__rodata_start+0x581>
+  8059f3:	64 20 73 75          	and    %dh,%fs:0x75(%rbx)
+  8059f7:	63 63 65             	movsxd 0x65(%rbx),%esp
+  8059fa:	65 64 65 64 21 00    	gs fs gs and %eax,%fs:(%rax)
+  805a00:	54                   	push   %rsp
+  805a01:	68 69 73 20 69       	push   $0x69207369
+  805a06:	73 20                	jae    805a28 <__rodata_start+0x548>
+  805a08:	74 68                	je     805a72 <__rodata_start+0x592>
+  805a0a:	65 20 4e 45          	and    %cl,%gs:0x45(%rsi)
+  805a0e:	57                   	push   %rdi
+  805a0f:	20 6d 65             	and    %ch,0x65(%rbp)
+  805a12:	73 73                	jae    805a87 <__rodata_start+0x5a7>
+  805a14:	61                   	(bad)
+  805a15:	67 65 20 6f 66       	and    %ch,%gs:0x66(%edi)
+  805a1a:	20 74 68 65          	and    %dh,0x65(%rax,%rbp,2)
+  805a1e:	20 64 61 79          	and    %ah,0x79(%rcx,%riz,2)
+  805a22:	21 0a                	and    %ecx,(%rdx)
+  805a24:	0a 00                	or     (%rax),%al
+  805a26:	00 00                	add    %al,(%rax)
+  805a28:	66 69 6c 65 5f 67 65 	imul   $0x6567,0x5f(%rbp,%riz,2),%bp
+  805a2f:	74 5f                	je     805a90 <__rodata_start+0x5b0>
+  805a31:	62                   	(bad)
+  805a32:	6c                   	insb   (%dx),%es:(%rdi)
+  805a33:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805a34:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  805a37:	72 65                	jb     805a9e <__rodata_start+0x5be>
+  805a39:	74 75                	je     805ab0 <__rodata_start+0x5d0>
+  805a3b:	72 6e                	jb     805aab <__rodata_start+0x5cb>
+  805a3d:	65 64 20 77 72       	gs and %dh,%fs:0x72(%rdi)
+  805a42:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805a43:	6e                   	outsb  %ds:(%rsi),(%dx)
+  805a44:	67 20 64 61 74       	and    %ah,0x74(%ecx,%eiz,2)
+  805a49:	61                   	(bad)
+  805a4a:	00 3c 75 6e 6b 6e 6f 	add    %bh,0x6f6e6b6e(,%rsi,2)
+  805a51:	77 6e                	ja     805ac1 <__rodata_start+0x5e1>
+  805a53:	3e 00 0f             	ds add %cl,(%rdi)
+  805a56:	1f                   	(bad)
+  805a57:	00 5b 25             	add    %bl,0x25(%rbx)
+  805a5a:	30 38                	xor    %bh,(%rax)
+  805a5c:	78 5d                	js     805abb <__rodata_start+0x5db>
+  805a5e:	20 75 73             	and    %dh,0x73(%rbp)
+  805a61:	65 72 20             	gs jb  805a84 <__rodata_start+0x5a4>
+  805a64:	70 61                	jo     805ac7 <__rodata_start+0x5e7>
+  805a66:	6e                   	outsb  %ds:(%rsi),(%dx)
+  805a67:	69 63 20 69 6e 20 25 	imul   $0x25206e69,0x20(%rbx),%esp
+  805a6e:	73 20                	jae    805a90 <__rodata_start+0x5b0>
+  805a70:	61                   	(bad)
+  805a71:	74 20                	je     805a93 <__rodata_start+0x5b3>
+  805a73:	25 73 3a 25 64       	and    $0x64253a73,%eax
+  805a78:	3a 20                	cmp    (%rax),%ah
+  805a7a:	00 30                	add    %dh,(%rax)
+  805a7c:	31 32                	xor    %esi,(%rdx)
+  805a7e:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  805a85:	41                   	rex.B
+  805a86:	42                   	rex.X
+  805a87:	43                   	rex.XB
+  805a88:	44                   	rex.R
+  805a89:	45                   	rex.RB
+  805a8a:	46 00 30             	rex.RX add %r14b,(%rax)
+  805a8d:	31 32                	xor    %esi,(%rdx)
+  805a8f:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  805a96:	61                   	(bad)
+  805a97:	62 63 64 65 66       	(bad)
+  805a9c:	00 28                	add    %ch,(%rax)
+  805a9e:	6e                   	outsb  %ds:(%rsi),(%dx)
+  805a9f:	75 6c                	jne    805b0d <__rodata_start+0x62d>
+  805aa1:	6c                   	insb   (%dx),%es:(%rdi)
+  805aa2:	29 00                	sub    %eax,(%rax)
+  805aa4:	65 72 72             	gs jb  805b19 <__rodata_start+0x639>
+  805aa7:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805aa8:	72 20                	jb     805aca <__rodata_start+0x5ea>
+  805aaa:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  805aaf:	73 70                	jae    805b21 <__rodata_start+0x641>
+  805ab1:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  805ab5:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  805abc:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805abd:	72 00                	jb     805abf <__rodata_start+0x5df>
+  805abf:	62 61 64 20 65       	(bad)
+  805ac4:	6e                   	outsb  %ds:(%rsi),(%dx)
+  805ac5:	76 69                	jbe    805b30 <__rodata_start+0x650>
+  805ac7:	72 6f                	jb     805b38 <__rodata_start+0x658>
+  805ac9:	6e                   	outsb  %ds:(%rsi),(%dx)
+  805aca:	6d                   	insl   (%dx),%es:(%rdi)
+  805acb:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  805acd:	74 00                	je     805acf <__rodata_start+0x5ef>
+  805acf:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  805ad6:	20 70 61             	and    %dh,0x61(%rax)
+  805ad9:	72 61                	jb     805b3c <__rodata_start+0x65c>
+  805adb:	6d                   	insl   (%dx),%es:(%rdi)
+  805adc:	65 74 65             	gs je  805b44 <__rodata_start+0x664>
+  805adf:	72 00                	jb     805ae1 <__rodata_start+0x601>
+  805ae1:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805ae2:	75 74                	jne    805b58 <__rodata_start+0x678>
+  805ae4:	20 6f 66             	and    %ch,0x66(%rdi)
+  805ae7:	20 6d 65             	and    %ch,0x65(%rbp)
+  805aea:	6d                   	insl   (%dx),%es:(%rdi)
+  805aeb:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805aec:	72 79                	jb     805b67 <__rodata_start+0x687>
+  805aee:	00 6f 75             	add    %ch,0x75(%rdi)
+  805af1:	74 20                	je     805b13 <__rodata_start+0x633>
+  805af3:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805af4:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  805af8:	76 69                	jbe    805b63 <__rodata_start+0x683>
+  805afa:	72 6f                	jb     805b6b <__rodata_start+0x68b>
+  805afc:	6e                   	outsb  %ds:(%rsi),(%dx)
+  805afd:	6d                   	insl   (%dx),%es:(%rdi)
+  805afe:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  805b00:	74 73                	je     805b75 <__rodata_start+0x695>
+  805b02:	00 63 6f             	add    %ah,0x6f(%rbx)
+  805b05:	72 72                	jb     805b79 <__rodata_start+0x699>
+  805b07:	75 70                	jne    805b79 <__rodata_start+0x699>
+  805b09:	74 65                	je     805b70 <__rodata_start+0x690>
+  805b0b:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  805b10:	75 67                	jne    805b79 <__rodata_start+0x699>
+  805b12:	20 69 6e             	and    %ch,0x6e(%rcx)
+  805b15:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  805b17:	00 73 65             	add    %dh,0x65(%rbx)
+  805b1a:	67 6d                	insl   (%dx),%es:(%edi)
+  805b1c:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  805b1e:	74 61                	je     805b81 <__rodata_start+0x6a1>
+  805b20:	74 69                	je     805b8b <__rodata_start+0x6ab>
+  805b22:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805b23:	6e                   	outsb  %ds:(%rsi),(%dx)
+  805b24:	20 66 61             	and    %ah,0x61(%rsi)
+  805b27:	75 6c                	jne    805b95 <__rodata_start+0x6b5>
+  805b29:	74 00                	je     805b2b <__rodata_start+0x64b>
+  805b2b:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  805b32:	20 45 4c             	and    %al,0x4c(%rbp)
+  805b35:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  805b39:	61                   	(bad)
+  805b3a:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  805b3f:	20 73 75             	and    %dh,0x75(%rbx)
+  805b42:	63 68 20             	movsxd 0x20(%rax),%ebp
+  805b45:	73 79                	jae    805bc0 <__rodata_start+0x6e0>
+  805b47:	73 74                	jae    805bbd <__rodata_start+0x6dd>
+  805b49:	65 6d                	gs insl (%dx),%es:(%rdi)
+  805b4b:	20 63 61             	and    %ah,0x61(%rbx)
+  805b4e:	6c                   	insb   (%dx),%es:(%rdi)
+  805b4f:	6c                   	insb   (%dx),%es:(%rdi)
+  805b50:	00 65 6e             	add    %ah,0x6e(%rbp)
+  805b53:	74 72                	je     805bc7 <__rodata_start+0x6e7>
+  805b55:	79 20                	jns    805b77 <__rodata_start+0x697>
+  805b57:	6e                   	outsb  %ds:(%rsi),(%dx)
+  805b58:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805b59:	74 20                	je     805b7b <__rodata_start+0x69b>
+  805b5b:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  805b5d:	75 6e                	jne    805bcd <__rodata_start+0x6ed>
+  805b5f:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  805b63:	76 20                	jbe    805b85 <__rodata_start+0x6a5>
+  805b65:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  805b6c:	72 65                	jb     805bd3 <__rodata_start+0x6f3>
+  805b6e:	63 76 69             	movsxd 0x69(%rsi),%esi
+  805b71:	6e                   	outsb  %ds:(%rsi),(%dx)
+  805b72:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  805b76:	65 78 70             	gs js  805be9 <__rodata_start+0x709>
+  805b79:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  805b7e:	20 65 6e             	and    %ah,0x6e(%rbp)
+  805b81:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  805b85:	20 66 69             	and    %ah,0x69(%rsi)
+  805b88:	6c                   	insb   (%dx),%es:(%rdi)
+  805b89:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  805b8d:	20 66 72             	and    %ah,0x72(%rsi)
+  805b90:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  805b95:	61                   	(bad)
+  805b96:	63 65 20             	movsxd 0x20(%rbp),%esp
+  805b99:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805b9a:	6e                   	outsb  %ds:(%rsi),(%dx)
+  805b9b:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  805b9f:	6b 00 74             	imul   $0x74,(%rax),%eax
+  805ba2:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805ba3:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805ba4:	20 6d 61             	and    %ch,0x61(%rbp)
+  805ba7:	6e                   	outsb  %ds:(%rsi),(%dx)
+  805ba8:	79 20                	jns    805bca <__rodata_start+0x6ea>
+  805baa:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  805bb1:	72 65                	jb     805c18 <__rodata_start+0x738>
+  805bb3:	20 6f 70             	and    %ch,0x70(%rdi)
+  805bb6:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  805bb8:	00 66 69             	add    %ah,0x69(%rsi)
+  805bbb:	6c                   	insb   (%dx),%es:(%rdi)
+  805bbc:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  805bc0:	20 62 6c             	and    %ah,0x6c(%rdx)
+  805bc3:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805bc4:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  805bc7:	6e                   	outsb  %ds:(%rsi),(%dx)
+  805bc8:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805bc9:	74 20                	je     805beb <__rodata_start+0x70b>
+  805bcb:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  805bcd:	75 6e                	jne    805c3d <__rodata_start+0x75d>
+  805bcf:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  805bd3:	76 61                	jbe    805c36 <__rodata_start+0x756>
+  805bd5:	6c                   	insb   (%dx),%es:(%rdi)
+  805bd6:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  805bdd:	00 
+  805bde:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  805be5:	72 65                	jb     805c4c <__rodata_start+0x76c>
+  805be7:	61                   	(bad)
+  805be8:	64 79 20             	fs jns 805c0b <__rodata_start+0x72b>
+  805beb:	65 78 69             	gs js  805c57 <__rodata_start+0x777>
+  805bee:	73 74                	jae    805c64 <__rodata_start+0x784>
+  805bf0:	73 00                	jae    805bf2 <__rodata_start+0x712>
+  805bf2:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805bf3:	70 65                	jo     805c5a <__rodata_start+0x77a>
+  805bf5:	72 61                	jb     805c58 <__rodata_start+0x778>
+  805bf7:	74 69                	je     805c62 <__rodata_start+0x782>
+  805bf9:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805bfa:	6e                   	outsb  %ds:(%rsi),(%dx)
+  805bfb:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  805bfe:	74 20                	je     805c20 <__rodata_start+0x740>
+  805c00:	73 75                	jae    805c77 <__rodata_start+0x797>
+  805c02:	70 70                	jo     805c74 <__rodata_start+0x794>
+  805c04:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805c05:	72 74                	jb     805c7b <__rodata_start+0x79b>
+  805c07:	65 64 00 6f 70       	gs add %ch,%fs:0x70(%rdi)
+  805c0c:	65 72 61             	gs jb  805c70 <__rodata_start+0x790>
+  805c0f:	74 69                	je     805c7a <__rodata_start+0x79a>
+  805c11:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805c12:	6e                   	outsb  %ds:(%rsi),(%dx)
+  805c13:	20 69 6e             	and    %ch,0x6e(%rcx)
+  805c16:	74 65                	je     805c7d <__rodata_start+0x79d>
+  805c18:	72 72                	jb     805c8c <__rodata_start+0x7ac>
+  805c1a:	75 70                	jne    805c8c <__rodata_start+0x7ac>
+  805c1c:	74 65                	je     805c83 <__rodata_start+0x7a3>
+  805c1e:	64 00 6e 6f          	add    %ch,%fs:0x6f(%rsi)
+  805c22:	74 20                	je     805c44 <__rodata_start+0x764>
+  805c24:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  805c26:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805c27:	75 67                	jne    805c90 <__rodata_start+0x7b0>
+  805c29:	68 20 43 50 55       	push   $0x55504320
+  805c2e:	20 74 69 6d          	and    %dh,0x6d(%rcx,%rbp,2)
+  805c32:	65 00 66 2e          	add    %ah,%gs:0x2e(%rsi)
+  805c36:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+  805c3d:	00 
+  805c3e:	66 90                	xchg   %ax,%ax
+  805c40:	ba 29 80 00 00       	mov    $0x8029,%edx
+  805c45:	00 00                	add    %al,(%rax)
+  805c47:	00 fb                	add    %bh,%bl
+  805c49:	2f                   	(bad)
+  805c4a:	80 00 00             	addb   $0x0,(%rax)
+  805c4d:	00 00                	add    %al,(%rax)
+  805c4f:	00 eb                	add    %ch,%bl
+  805c51:	2f                   	(bad)
+  805c52:	80 00 00             	addb   $0x0,(%rax)
+  805c55:	00 00                	add    %al,(%rax)
+  805c57:	00 fb                	add    %bh,%bl
+  805c59:	2f                   	(bad)
+  805c5a:	80 00 00             	addb   $0x0,(%rax)
+  805c5d:	00 00                	add    %al,(%rax)
+  805c5f:	00 fb                	add    %bh,%bl
+  805c61:	2f                   	(bad)
+  805c62:	80 00 00             	addb   $0x0,(%rax)
+  805c65:	00 00                	add    %al,(%rax)
+  805c67:	00 fb                	add    %bh,%bl
+  805c69:	2f                   	(bad)
+  805c6a:	80 00 00             	addb   $0x0,(%rax)
+  805c6d:	00 00                	add    %al,(%rax)
+  805c6f:	00 fb                	add    %bh,%bl
+  805c71:	2f                   	(bad)
+  805c72:	80 00 00             	addb   $0x0,(%rax)
+  805c75:	00 00                	add    %al,(%rax)
+  805c77:	00 d9                	add    %bl,%cl
+  805c79:	29 80 00 00 00 00    	sub    %eax,0x0(%rax)
+  805c7f:	00 fb                	add    %bh,%bl
+  805c81:	2f                   	(bad)
+  805c82:	80 00 00             	addb   $0x0,(%rax)
+  805c85:	00 00                	add    %al,(%rax)
+  805c87:	00 fb                	add    %bh,%bl
+  805c89:	2f                   	(bad)
+  805c8a:	80 00 00             	addb   $0x0,(%rax)
+  805c8d:	00 00                	add    %al,(%rax)
+  805c8f:	00 cd                	add    %cl,%ch
+  805c91:	29 80 00 00 00 00    	sub    %eax,0x0(%rax)
+  805c97:	00 47 2a             	add    %al,0x2a(%rdi)
+  805c9a:	80 00 00             	addb   $0x0,(%rax)
+  805c9d:	00 00                	add    %al,(%rax)
+  805c9f:	00 fb                	add    %bh,%bl
+  805ca1:	2f                   	(bad)
+  805ca2:	80 00 00             	addb   $0x0,(%rax)
+  805ca5:	00 00                	add    %al,(%rax)
+  805ca7:	00 cd                	add    %cl,%ch
+  805ca9:	29 80 00 00 00 00    	sub    %eax,0x0(%rax)
+  805caf:	00 13                	add    %dl,(%rbx)
+  805cb1:	2a 80 00 00 00 00    	sub    0x0(%rax),%al
+  805cb7:	00 13                	add    %dl,(%rbx)
+  805cb9:	2a 80 00 00 00 00    	sub    0x0(%rax),%al
+  805cbf:	00 13                	add    %dl,(%rbx)
+  805cc1:	2a 80 00 00 00 00    	sub    0x0(%rax),%al
+  805cc7:	00 13                	add    %dl,(%rbx)
+  805cc9:	2a 80 00 00 00 00    	sub    0x0(%rax),%al
+  805ccf:	00 13                	add    %dl,(%rbx)
+  805cd1:	2a 80 00 00 00 00    	sub    0x0(%rax),%al
+  805cd7:	00 13                	add    %dl,(%rbx)
+  805cd9:	2a 80 00 00 00 00    	sub    0x0(%rax),%al
+  805cdf:	00 13                	add    %dl,(%rbx)
+  805ce1:	2a 80 00 00 00 00    	sub    0x0(%rax),%al
+  805ce7:	00 13                	add    %dl,(%rbx)
+  805ce9:	2a 80 00 00 00 00    	sub    0x0(%rax),%al
+  805cef:	00 13                	add    %dl,(%rbx)
+  805cf1:	2a 80 00 00 00 00    	sub    0x0(%rax),%al
+  805cf7:	00 fb                	add    %bh,%bl
+  805cf9:	2f                   	(bad)
+  805cfa:	80 00 00             	addb   $0x0,(%rax)
+  805cfd:	00 00                	add    %al,(%rax)
+  805cff:	00 fb                	add    %bh,%bl
+  805d01:	2f                   	(bad)
+  805d02:	80 00 00             	addb   $0x0,(%rax)
+  805d05:	00 00                	add    %al,(%rax)
+  805d07:	00 fb                	add    %bh,%bl
+  805d09:	2f                   	(bad)
+  805d0a:	80 00 00             	addb   $0x0,(%rax)
+  805d0d:	00 00                	add    %al,(%rax)
+  805d0f:	00 fb                	add    %bh,%bl
+  805d11:	2f                   	(bad)
+  805d12:	80 00 00             	addb   $0x0,(%rax)
+  805d15:	00 00                	add    %al,(%rax)
+  805d17:	00 fb                	add    %bh,%bl
+  805d19:	2f                   	(bad)
+  805d1a:	80 00 00             	addb   $0x0,(%rax)
+  805d1d:	00 00                	add    %al,(%rax)
+  805d1f:	00 fb                	add    %bh,%bl
+  805d21:	2f                   	(bad)
+  805d22:	80 00 00             	addb   $0x0,(%rax)
+  805d25:	00 00                	add    %al,(%rax)
+  805d27:	00 fb                	add    %bh,%bl
+  805d29:	2f                   	(bad)
+  805d2a:	80 00 00             	addb   $0x0,(%rax)
+  805d2d:	00 00                	add    %al,(%rax)
+  805d2f:	00 fb                	add    %bh,%bl
+  805d31:	2f                   	(bad)
+  805d32:	80 00 00             	addb   $0x0,(%rax)
+  805d35:	00 00                	add    %al,(%rax)
+  805d37:	00 fb                	add    %bh,%bl
+  805d39:	2f                   	(bad)
+  805d3a:	80 00 00             	addb   $0x0,(%rax)
+  805d3d:	00 00                	add    %al,(%rax)
+  805d3f:	00 fb                	add    %bh,%bl
+  805d41:	2f                   	(bad)
+  805d42:	80 00 00             	addb   $0x0,(%rax)
+  805d45:	00 00                	add    %al,(%rax)
+  805d47:	00 fb                	add    %bh,%bl
+  805d49:	2f                   	(bad)
+  805d4a:	80 00 00             	addb   $0x0,(%rax)
+  805d4d:	00 00                	add    %al,(%rax)
+  805d4f:	00 fb                	add    %bh,%bl
+  805d51:	2f                   	(bad)
+  805d52:	80 00 00             	addb   $0x0,(%rax)
+  805d55:	00 00                	add    %al,(%rax)
+  805d57:	00 fb                	add    %bh,%bl
+  805d59:	2f                   	(bad)
+  805d5a:	80 00 00             	addb   $0x0,(%rax)
+  805d5d:	00 00                	add    %al,(%rax)
+  805d5f:	00 fb                	add    %bh,%bl
+  805d61:	2f                   	(bad)
+  805d62:	80 00 00             	addb   $0x0,(%rax)
+  805d65:	00 00                	add    %al,(%rax)
+  805d67:	00 fb                	add    %bh,%bl
+  805d69:	2f                   	(bad)
+  805d6a:	80 00 00             	addb   $0x0,(%rax)
+  805d6d:	00 00                	add    %al,(%rax)
+  805d6f:	00 fb                	add    %bh,%bl
+  805d71:	2f                   	(bad)
+  805d72:	80 00 00             	addb   $0x0,(%rax)
+  805d75:	00 00                	add    %al,(%rax)
+  805d77:	00 fb                	add    %bh,%bl
+  805d79:	2f                   	(bad)
+  805d7a:	80 00 00             	addb   $0x0,(%rax)
+  805d7d:	00 00                	add    %al,(%rax)
+  805d7f:	00 fb                	add    %bh,%bl
+  805d81:	2f                   	(bad)
+  805d82:	80 00 00             	addb   $0x0,(%rax)
+  805d85:	00 00                	add    %al,(%rax)
+  805d87:	00 fb                	add    %bh,%bl
+  805d89:	2f                   	(bad)
+  805d8a:	80 00 00             	addb   $0x0,(%rax)
+  805d8d:	00 00                	add    %al,(%rax)
+  805d8f:	00 fb                	add    %bh,%bl
+  805d91:	2f                   	(bad)
+  805d92:	80 00 00             	addb   $0x0,(%rax)
+  805d95:	00 00                	add    %al,(%rax)
+  805d97:	00 fb                	add    %bh,%bl
+  805d99:	2f                   	(bad)
+  805d9a:	80 00 00             	addb   $0x0,(%rax)
+  805d9d:	00 00                	add    %al,(%rax)
+  805d9f:	00 fb                	add    %bh,%bl
+  805da1:	2f                   	(bad)
+  805da2:	80 00 00             	addb   $0x0,(%rax)
+  805da5:	00 00                	add    %al,(%rax)
+  805da7:	00 fb                	add    %bh,%bl
+  805da9:	2f                   	(bad)
+  805daa:	80 00 00             	addb   $0x0,(%rax)
+  805dad:	00 00                	add    %al,(%rax)
+  805daf:	00 fb                	add    %bh,%bl
+  805db1:	2f                   	(bad)
+  805db2:	80 00 00             	addb   $0x0,(%rax)
+  805db5:	00 00                	add    %al,(%rax)
+  805db7:	00 fb                	add    %bh,%bl
+  805db9:	2f                   	(bad)
+  805dba:	80 00 00             	addb   $0x0,(%rax)
+  805dbd:	00 00                	add    %al,(%rax)
+  805dbf:	00 fb                	add    %bh,%bl
+  805dc1:	2f                   	(bad)
+  805dc2:	80 00 00             	addb   $0x0,(%rax)
+  805dc5:	00 00                	add    %al,(%rax)
+  805dc7:	00 fb                	add    %bh,%bl
+  805dc9:	2f                   	(bad)
+  805dca:	80 00 00             	addb   $0x0,(%rax)
+  805dcd:	00 00                	add    %al,(%rax)
+  805dcf:	00 fb                	add    %bh,%bl
+  805dd1:	2f                   	(bad)
+  805dd2:	80 00 00             	addb   $0x0,(%rax)
+  805dd5:	00 00                	add    %al,(%rax)
+  805dd7:	00 fb                	add    %bh,%bl
+  805dd9:	2f                   	(bad)
+  805dda:	80 00 00             	addb   $0x0,(%rax)
+  805ddd:	00 00                	add    %al,(%rax)
+  805ddf:	00 fb                	add    %bh,%bl
+  805de1:	2f                   	(bad)
+  805de2:	80 00 00             	addb   $0x0,(%rax)
+  805de5:	00 00                	add    %al,(%rax)
+  805de7:	00 1e                	add    %bl,(%rsi)
+  805de9:	2f                   	(bad)
+  805dea:	80 00 00             	addb   $0x0,(%rax)
+  805ded:	00 00                	add    %al,(%rax)
+  805def:	00 fb                	add    %bh,%bl
+  805df1:	2f                   	(bad)
+  805df2:	80 00 00             	addb   $0x0,(%rax)
+  805df5:	00 00                	add    %al,(%rax)
+  805df7:	00 fb                	add    %bh,%bl
+  805df9:	2f                   	(bad)
+  805dfa:	80 00 00             	addb   $0x0,(%rax)
+  805dfd:	00 00                	add    %al,(%rax)
+  805dff:	00 fb                	add    %bh,%bl
+  805e01:	2f                   	(bad)
+  805e02:	80 00 00             	addb   $0x0,(%rax)
+  805e05:	00 00                	add    %al,(%rax)
+  805e07:	00 fb                	add    %bh,%bl
+  805e09:	2f                   	(bad)
+  805e0a:	80 00 00             	addb   $0x0,(%rax)
+  805e0d:	00 00                	add    %al,(%rax)
+  805e0f:	00 fb                	add    %bh,%bl
+  805e11:	2f                   	(bad)
+  805e12:	80 00 00             	addb   $0x0,(%rax)
+  805e15:	00 00                	add    %al,(%rax)
+  805e17:	00 fb                	add    %bh,%bl
+  805e19:	2f                   	(bad)
+  805e1a:	80 00 00             	addb   $0x0,(%rax)
+  805e1d:	00 00                	add    %al,(%rax)
+  805e1f:	00 fb                	add    %bh,%bl
+  805e21:	2f                   	(bad)
+  805e22:	80 00 00             	addb   $0x0,(%rax)
+  805e25:	00 00                	add    %al,(%rax)
+  805e27:	00 fb                	add    %bh,%bl
+  805e29:	2f                   	(bad)
+  805e2a:	80 00 00             	addb   $0x0,(%rax)
+  805e2d:	00 00                	add    %al,(%rax)
+  805e2f:	00 fb                	add    %bh,%bl
+  805e31:	2f                   	(bad)
+  805e32:	80 00 00             	addb   $0x0,(%rax)
+  805e35:	00 00                	add    %al,(%rax)
+  805e37:	00 fb                	add    %bh,%bl
+  805e39:	2f                   	(bad)
+  805e3a:	80 00 00             	addb   $0x0,(%rax)
+  805e3d:	00 00                	add    %al,(%rax)
+  805e3f:	00 6a 2a             	add    %ch,0x2a(%rdx)
+  805e42:	80 00 00             	addb   $0x0,(%rax)
+  805e45:	00 00                	add    %al,(%rax)
+  805e47:	00 39                	add    %bh,(%rcx)
+  805e49:	2c 80                	sub    $0x80,%al
+  805e4b:	00 00                	add    %al,(%rax)
+  805e4d:	00 00                	add    %al,(%rax)
+  805e4f:	00 fb                	add    %bh,%bl
+  805e51:	2f                   	(bad)
+  805e52:	80 00 00             	addb   $0x0,(%rax)
+  805e55:	00 00                	add    %al,(%rax)
+  805e57:	00 fb                	add    %bh,%bl
+  805e59:	2f                   	(bad)
+  805e5a:	80 00 00             	addb   $0x0,(%rax)
+  805e5d:	00 00                	add    %al,(%rax)
+  805e5f:	00 fb                	add    %bh,%bl
+  805e61:	2f                   	(bad)
+  805e62:	80 00 00             	addb   $0x0,(%rax)
+  805e65:	00 00                	add    %al,(%rax)
+  805e67:	00 fb                	add    %bh,%bl
+  805e69:	2f                   	(bad)
+  805e6a:	80 00 00             	addb   $0x0,(%rax)
+  805e6d:	00 00                	add    %al,(%rax)
+  805e6f:	00 99 2a 80 00 00    	add    %bl,0x802a(%rcx)
+  805e75:	00 00                	add    %al,(%rax)
+  805e77:	00 fb                	add    %bh,%bl
+  805e79:	2f                   	(bad)
+  805e7a:	80 00 00             	addb   $0x0,(%rax)
+  805e7d:	00 00                	add    %al,(%rax)
+  805e7f:	00 fb                	add    %bh,%bl
+  805e81:	2f                   	(bad)
+  805e82:	80 00 00             	addb   $0x0,(%rax)
+  805e85:	00 00                	add    %al,(%rax)
+  805e87:	00 5f 2a             	add    %bl,0x2a(%rdi)
+  805e8a:	80 00 00             	addb   $0x0,(%rax)
+  805e8d:	00 00                	add    %al,(%rax)
+  805e8f:	00 fb                	add    %bh,%bl
+  805e91:	2f                   	(bad)
+  805e92:	80 00 00             	addb   $0x0,(%rax)
+  805e95:	00 00                	add    %al,(%rax)
+  805e97:	00 fb                	add    %bh,%bl
+  805e99:	2f                   	(bad)
+  805e9a:	80 00 00             	addb   $0x0,(%rax)
+  805e9d:	00 00                	add    %al,(%rax)
+  805e9f:	00 e1                	add    %ah,%cl
+  805ea1:	2d 80 00 00 00       	sub    $0x80,%eax
+  805ea6:	00 00                	add    %al,(%rax)
+  805ea8:	ab                   	stos   %eax,%es:(%rdi)
+  805ea9:	2e 80 00 00          	cs addb $0x0,(%rax)
+  805ead:	00 00                	add    %al,(%rax)
+  805eaf:	00 fb                	add    %bh,%bl
+  805eb1:	2f                   	(bad)
+  805eb2:	80 00 00             	addb   $0x0,(%rax)
+  805eb5:	00 00                	add    %al,(%rax)
+  805eb7:	00 fb                	add    %bh,%bl
+  805eb9:	2f                   	(bad)
+  805eba:	80 00 00             	addb   $0x0,(%rax)
+  805ebd:	00 00                	add    %al,(%rax)
+  805ebf:	00 30                	add    %dh,(%rax)
+  805ec1:	2b 80 00 00 00 00    	sub    0x0(%rax),%eax
+  805ec7:	00 fb                	add    %bh,%bl
+  805ec9:	2f                   	(bad)
+  805eca:	80 00 00             	addb   $0x0,(%rax)
+  805ecd:	00 00                	add    %al,(%rax)
+  805ecf:	00 0d 2d 80 00 00    	add    %cl,0x802d(%rip)        # 80df02 <fsipcbuf+0xf02>
+  805ed5:	00 00                	add    %al,(%rax)
+  805ed7:	00 fb                	add    %bh,%bl
+  805ed9:	2f                   	(bad)
+  805eda:	80 00 00             	addb   $0x0,(%rax)
+  805edd:	00 00                	add    %al,(%rax)
+  805edf:	00 fb                	add    %bh,%bl
+  805ee1:	2f                   	(bad)
+  805ee2:	80 00 00             	addb   $0x0,(%rax)
+  805ee5:	00 00                	add    %al,(%rax)
+  805ee7:	00 1e                	add    %bl,(%rsi)
+  805ee9:	2f                   	(bad)
+  805eea:	80 00 00             	addb   $0x0,(%rax)
+  805eed:	00 00                	add    %al,(%rax)
+  805eef:	00 fb                	add    %bh,%bl
+  805ef1:	2f                   	(bad)
+  805ef2:	80 00 00             	addb   $0x0,(%rax)
+  805ef5:	00 00                	add    %al,(%rax)
+  805ef7:	00 c3                	add    %al,%bl
+  805ef9:	29 80 00 00 00 00    	sub    %eax,0x0(%rax)
+	...
+
+0000000000805f00 <error_string>:
+	...
+  805f08:	ad 5a 80 00 00 00 00 00 bf 5a 80 00 00 00 00 00     .Z.......Z......
+  805f18:	cf 5a 80 00 00 00 00 00 e1 5a 80 00 00 00 00 00     .Z.......Z......
+  805f28:	ef 5a 80 00 00 00 00 00 03 5b 80 00 00 00 00 00     .Z.......[......
+  805f38:	18 5b 80 00 00 00 00 00 2b 5b 80 00 00 00 00 00     .[......+[......
+  805f48:	3d 5b 80 00 00 00 00 00 51 5b 80 00 00 00 00 00     =[......Q[......
+  805f58:	61 5b 80 00 00 00 00 00 74 5b 80 00 00 00 00 00     a[......t[......
+  805f68:	8b 5b 80 00 00 00 00 00 a1 5b 80 00 00 00 00 00     .[.......[......
+  805f78:	b9 5b 80 00 00 00 00 00 d1 5b 80 00 00 00 00 00     .[.......[......
+  805f88:	de 5b 80 00 00 00 00 00 b0 5f 80 00 00 00 00 00     .[......._......
+  805f98:	f2 5b 80 00 00 00 00 00 0a 5c 80 00 00 00 00 00     .[.......\......
+  805fa8:	20 5c 80 00 00 00 00 00 66 69 6c 65 20 69 73 20      \......file is 
+  805fb8:	6e 6f 74 20 61 20 76 61 6c 69 64 20 65 78 65 63     not a valid exec
+  805fc8:	75 74 61 62 6c 65 00 90 73 79 73 63 61 6c 6c 20     utable..syscall 
+  805fd8:	25 7a 64 20 72 65 74 75 72 6e 65 64 20 25 7a 64     %zd returned %zd
+  805fe8:	20 28 3e 20 30 29 00 6c 69 62 2f 73 79 73 63 61      (> 0).lib/sysca
+  805ff8:	6c 6c 2e 63 00 0f 1f 00 55 73 65 72 73 70 61 63     ll.c....Userspac
+  806008:	65 20 70 61 67 65 20 66 61 75 6c 74 20 72 69 70     e page fault rip
+  806018:	3d 25 30 38 6c 58 20 76 61 3d 25 30 38 6c 58 20     =%08lX va=%08lX 
+  806028:	65 72 72 3d 25 78 0a 00 6c 69 62 2f 70 67 66 61     err=%x..lib/pgfa
+  806038:	75 6c 74 2e 63 00 73 65 74 5f 70 67 66 61 75 6c     ult.c.set_pgfaul
+  806048:	74 5f 68 61 6e 64 6c 65 72 3a 20 25 69 00 5f 70     t_handler: %i._p
+  806058:	66 68 61 6e 64 6c 65 72 5f 69 6e 69 74 69 74 69     fhandler_inititi
+  806068:	61 6c 6c 69 7a 65 64 00 73 79 73 5f 69 70 63 5f     allized.sys_ipc_
+  806078:	74 72 79 5f 73 65 6e 64 20 66 61 69 6c 65 64 3a     try_send failed:
+  806088:	20 25 69 00 6c 69 62 2f 69 70 63 2e 63 00 66 90      %i.lib/ipc.c.f.
+  806098:	5b 25 30 38 78 5d 20 75 6e 6b 6e 6f 77 6e 20 64     [%08x] unknown d
+  8060a8:	65 76 69 63 65 20 74 79 70 65 20 25 64 0a 00 00     evice type %d...
+  8060b8:	5b 25 30 38 78 5d 20 66 74 72 75 6e 63 61 74 65     [%08x] ftruncate
+  8060c8:	20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65 0a      %d -- bad mode.
+  8060d8:	00 5b 25 30 38 78 5d 20 72 65 61 64 20 25 64 20     .[%08x] read %d 
+  8060e8:	2d 2d 20 62 61 64 20 6d 6f 64 65 0a 00 5b 25 30     -- bad mode..[%0
+  8060f8:	38 78 5d 20 77 72 69 74 65 20 25 64 20 2d 2d 20     8x] write %d -- 
+  806108:	62 61 64 20 6d 6f 64 65 0a 00 66 2e 0f 1f 84 00     bad mode..f.....
+  806118:	00 00 00 00 0f 1f 40 00                             ......@.
+
+0000000000806120 <devtab>:
+  806120:	a0 b0 80 00 00 00 00 00 e0 b0 80 00 00 00 00 00     ................
+  806130:	20 b1 80 00 00 00 00 00 00 00 00 00 00 00 00 00      ...............
+  806140:	3c 70 69 70 65 3e 00 6c 69 62 2f 70 69 70 65 2e     <pipe>.lib/pipe.
+  806150:	63 00 70 69 70 65 00 90 73 79 73 5f 72 65 67 69     c.pipe..sys_regi
+  806160:	6f 6e 5f 72 65 66 73 28 76 61 2c 20 50 41 47 45     on_refs(va, PAGE
+  806170:	5f 53 49 5a 45 29 20 3d 3d 20 32 00 3c 63 6f 6e     _SIZE) == 2.<con
+  806180:	73 3e 00 63 6f 6e 73 00 66 2e 0f 1f 84 00 00 00     s>.cons.f.......
+  806190:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8061a0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8061b0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8061c0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8061d0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8061e0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8061f0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806200:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806210:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806220:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806230:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806240:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806250:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806260:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806270:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806280:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806290:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8062a0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8062b0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8062c0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8062d0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8062e0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8062f0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806300:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806310:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806320:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806330:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806340:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806350:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806360:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806370:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806380:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806390:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8063a0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8063b0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8063c0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8063d0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8063e0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8063f0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806400:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806410:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806420:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806430:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806440:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806450:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806460:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806470:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806480:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806490:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8064a0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8064b0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8064c0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8064d0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8064e0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8064f0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806500:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806510:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806520:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806530:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806540:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806550:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806560:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806570:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806580:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806590:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8065a0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8065b0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8065c0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8065d0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8065e0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8065f0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806600:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806610:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806620:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806630:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806640:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806650:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806660:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806670:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806680:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806690:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8066a0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8066b0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8066c0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8066d0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8066e0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8066f0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806700:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806710:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806720:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806730:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806740:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806750:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806760:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806770:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806780:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806790:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8067a0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8067b0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8067c0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8067d0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8067e0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8067f0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806800:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806810:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806820:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806830:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806840:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806850:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806860:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806870:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806880:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806890:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8068a0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8068b0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8068c0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8068d0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8068e0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8068f0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806900:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806910:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806920:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806930:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806940:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806950:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806960:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806970:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806980:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806990:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8069a0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8069b0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8069c0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8069d0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8069e0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8069f0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806a00:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806a10:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806a20:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806a30:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806a40:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806a50:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806a60:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806a70:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806a80:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806a90:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806aa0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806ab0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806ac0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806ad0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806ae0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806af0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806b00:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806b10:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806b20:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806b30:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806b40:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806b50:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806b60:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806b70:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806b80:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806b90:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806ba0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806bb0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806bc0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806bd0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806be0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806bf0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806c00:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806c10:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806c20:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806c30:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806c40:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806c50:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806c60:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806c70:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806c80:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806c90:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806ca0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806cb0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806cc0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806cd0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806ce0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806cf0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806d00:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806d10:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806d20:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806d30:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806d40:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806d50:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806d60:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806d70:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806d80:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806d90:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806da0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806db0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806dc0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806dd0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806de0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806df0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806e00:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806e10:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806e20:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806e30:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806e40:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806e50:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806e60:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806e70:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806e80:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806e90:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806ea0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806eb0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806ec0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806ed0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806ee0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806ef0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806f00:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806f10:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806f20:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806f30:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806f40:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806f50:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806f60:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806f70:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806f80:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806f90:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806fa0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806fb0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806fc0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806fd0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806fe0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806ff0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 0f 1f 40 00     ..f...........@.
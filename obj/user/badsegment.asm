@@ -0,0 +1,5435 @@
+
+obj/user/badsegment:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 09 00 00 00       	call   80002c <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+    /* Try to load the kernel's TSS selector into the DS register. */
+    asm volatile("movw $0x38,%ax; movw %ax,%ds");
+  800025:	66 b8 38 00          	mov    $0x38,%ax
+  800029:	8e d8                	mov    %eax,%ds
+}
+  80002b:	c3                   	ret
+
+000000000080002c <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  80002c:	55                   	push   %rbp
+  80002d:	48 89 e5             	mov    %rsp,%rbp
+  800030:	41 56                	push   %r14
+  800032:	41 55                	push   %r13
+  800034:	41 54                	push   %r12
+  800036:	53                   	push   %rbx
+  800037:	41 89 fd             	mov    %edi,%r13d
+  80003a:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  80003d:	48 ba d8 40 80 00 00 	movabs $0x8040d8,%rdx
+  800044:	00 00 00 
+  800047:	48 b8 d8 40 80 00 00 	movabs $0x8040d8,%rax
+  80004e:	00 00 00 
+  800051:	48 39 c2             	cmp    %rax,%rdx
+  800054:	73 17                	jae    80006d <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  800056:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  800059:	49 89 c4             	mov    %rax,%r12
+  80005c:	48 83 c3 08          	add    $0x8,%rbx
+  800060:	b8 00 00 00 00       	mov    $0x0,%eax
+  800065:	ff 53 f8             	call   *-0x8(%rbx)
+  800068:	4c 39 e3             	cmp    %r12,%rbx
+  80006b:	72 ef                	jb     80005c <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+    envid_t this_env_id = sys_getenvid();
+  80006d:	48 b8 c1 01 80 00 00 	movabs $0x8001c1,%rax
+  800074:	00 00 00 
+  800077:	ff d0                	call   *%rax
+    thisenv = &((struct Env*)UENVS)[ENVX(this_env_id)];
+  800079:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80007e:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+  800085:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  80008c:	00 00 00 
+  80008f:	48 01 d0             	add    %rdx,%rax
+  800092:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  800099:	00 00 00 
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  80009c:	45 85 ed             	test   %r13d,%r13d
+  80009f:	7e 0d                	jle    8000ae <libmain+0x82>
+  8000a1:	49 8b 06             	mov    (%r14),%rax
+  8000a4:	48 a3 00 40 80 00 00 	movabs %rax,0x804000
+  8000ab:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8000ae:	4c 89 f6             	mov    %r14,%rsi
+  8000b1:	44 89 ef             	mov    %r13d,%edi
+  8000b4:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8000bb:	00 00 00 
+  8000be:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8000c0:	48 b8 d5 00 80 00 00 	movabs $0x8000d5,%rax
+  8000c7:	00 00 00 
+  8000ca:	ff d0                	call   *%rax
+#endif
+}
+  8000cc:	5b                   	pop    %rbx
+  8000cd:	41 5c                	pop    %r12
+  8000cf:	41 5d                	pop    %r13
+  8000d1:	41 5e                	pop    %r14
+  8000d3:	5d                   	pop    %rbp
+  8000d4:	c3                   	ret
+
+00000000008000d5 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8000d5:	55                   	push   %rbp
+  8000d6:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  8000d9:	48 b8 15 09 80 00 00 	movabs $0x800915,%rax
+  8000e0:	00 00 00 
+  8000e3:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  8000e5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8000ea:	48 b8 56 01 80 00 00 	movabs $0x800156,%rax
+  8000f1:	00 00 00 
+  8000f4:	ff d0                	call   *%rax
+}
+  8000f6:	5d                   	pop    %rbp
+  8000f7:	c3                   	ret
+
+00000000008000f8 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  8000f8:	55                   	push   %rbp
+  8000f9:	48 89 e5             	mov    %rsp,%rbp
+  8000fc:	53                   	push   %rbx
+  8000fd:	48 89 fa             	mov    %rdi,%rdx
+  800100:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  800103:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800108:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80010d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800112:	be 00 00 00 00       	mov    $0x0,%esi
+  800117:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80011d:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  80011f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800123:	c9                   	leave
+  800124:	c3                   	ret
+
+0000000000800125 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  800125:	55                   	push   %rbp
+  800126:	48 89 e5             	mov    %rsp,%rbp
+  800129:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80012a:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80012f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800134:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800139:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80013e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800143:	be 00 00 00 00       	mov    $0x0,%esi
+  800148:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80014e:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  800150:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800154:	c9                   	leave
+  800155:	c3                   	ret
+
+0000000000800156 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  800156:	55                   	push   %rbp
+  800157:	48 89 e5             	mov    %rsp,%rbp
+  80015a:	53                   	push   %rbx
+  80015b:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  80015f:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800162:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800167:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80016c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800171:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800176:	be 00 00 00 00       	mov    $0x0,%esi
+  80017b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800181:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800183:	48 85 c0             	test   %rax,%rax
+  800186:	7f 06                	jg     80018e <sys_env_destroy+0x38>
+}
+  800188:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80018c:	c9                   	leave
+  80018d:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80018e:	49 89 c0             	mov    %rax,%r8
+  800191:	b9 03 00 00 00       	mov    $0x3,%ecx
+  800196:	48 ba 88 2c 80 00 00 	movabs $0x802c88,%rdx
+  80019d:	00 00 00 
+  8001a0:	be 26 00 00 00       	mov    $0x26,%esi
+  8001a5:	48 bf a7 2c 80 00 00 	movabs $0x802ca7,%rdi
+  8001ac:	00 00 00 
+  8001af:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001b4:	49 b9 12 1c 80 00 00 	movabs $0x801c12,%r9
+  8001bb:	00 00 00 
+  8001be:	41 ff d1             	call   *%r9
+
+00000000008001c1 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  8001c1:	55                   	push   %rbp
+  8001c2:	48 89 e5             	mov    %rsp,%rbp
+  8001c5:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8001c6:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8001cb:	ba 00 00 00 00       	mov    $0x0,%edx
+  8001d0:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8001d5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8001da:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8001df:	be 00 00 00 00       	mov    $0x0,%esi
+  8001e4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8001ea:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  8001ec:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8001f0:	c9                   	leave
+  8001f1:	c3                   	ret
+
+00000000008001f2 <sys_yield>:
+
+void
+sys_yield(void) {
+  8001f2:	55                   	push   %rbp
+  8001f3:	48 89 e5             	mov    %rsp,%rbp
+  8001f6:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8001f7:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8001fc:	ba 00 00 00 00       	mov    $0x0,%edx
+  800201:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800206:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80020b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800210:	be 00 00 00 00       	mov    $0x0,%esi
+  800215:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80021b:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  80021d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800221:	c9                   	leave
+  800222:	c3                   	ret
+
+0000000000800223 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  800223:	55                   	push   %rbp
+  800224:	48 89 e5             	mov    %rsp,%rbp
+  800227:	53                   	push   %rbx
+  800228:	48 89 fa             	mov    %rdi,%rdx
+  80022b:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80022e:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800233:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  80023a:	00 00 00 
+  80023d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800242:	be 00 00 00 00       	mov    $0x0,%esi
+  800247:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80024d:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  80024f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800253:	c9                   	leave
+  800254:	c3                   	ret
+
+0000000000800255 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  800255:	55                   	push   %rbp
+  800256:	48 89 e5             	mov    %rsp,%rbp
+  800259:	53                   	push   %rbx
+  80025a:	49 89 f8             	mov    %rdi,%r8
+  80025d:	48 89 d3             	mov    %rdx,%rbx
+  800260:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  800263:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800268:	4c 89 c2             	mov    %r8,%rdx
+  80026b:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80026e:	be 00 00 00 00       	mov    $0x0,%esi
+  800273:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800279:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  80027b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80027f:	c9                   	leave
+  800280:	c3                   	ret
+
+0000000000800281 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  800281:	55                   	push   %rbp
+  800282:	48 89 e5             	mov    %rsp,%rbp
+  800285:	53                   	push   %rbx
+  800286:	48 83 ec 08          	sub    $0x8,%rsp
+  80028a:	89 f8                	mov    %edi,%eax
+  80028c:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  80028f:	48 63 f9             	movslq %ecx,%rdi
+  800292:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800295:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80029a:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80029d:	be 00 00 00 00       	mov    $0x0,%esi
+  8002a2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8002a8:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8002aa:	48 85 c0             	test   %rax,%rax
+  8002ad:	7f 06                	jg     8002b5 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  8002af:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8002b3:	c9                   	leave
+  8002b4:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8002b5:	49 89 c0             	mov    %rax,%r8
+  8002b8:	b9 04 00 00 00       	mov    $0x4,%ecx
+  8002bd:	48 ba 88 2c 80 00 00 	movabs $0x802c88,%rdx
+  8002c4:	00 00 00 
+  8002c7:	be 26 00 00 00       	mov    $0x26,%esi
+  8002cc:	48 bf a7 2c 80 00 00 	movabs $0x802ca7,%rdi
+  8002d3:	00 00 00 
+  8002d6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002db:	49 b9 12 1c 80 00 00 	movabs $0x801c12,%r9
+  8002e2:	00 00 00 
+  8002e5:	41 ff d1             	call   *%r9
+
+00000000008002e8 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8002e8:	55                   	push   %rbp
+  8002e9:	48 89 e5             	mov    %rsp,%rbp
+  8002ec:	53                   	push   %rbx
+  8002ed:	48 83 ec 08          	sub    $0x8,%rsp
+  8002f1:	89 f8                	mov    %edi,%eax
+  8002f3:	49 89 f2             	mov    %rsi,%r10
+  8002f6:	48 89 cf             	mov    %rcx,%rdi
+  8002f9:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  8002fc:	48 63 da             	movslq %edx,%rbx
+  8002ff:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800302:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800307:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80030a:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  80030d:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80030f:	48 85 c0             	test   %rax,%rax
+  800312:	7f 06                	jg     80031a <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  800314:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800318:	c9                   	leave
+  800319:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80031a:	49 89 c0             	mov    %rax,%r8
+  80031d:	b9 05 00 00 00       	mov    $0x5,%ecx
+  800322:	48 ba 88 2c 80 00 00 	movabs $0x802c88,%rdx
+  800329:	00 00 00 
+  80032c:	be 26 00 00 00       	mov    $0x26,%esi
+  800331:	48 bf a7 2c 80 00 00 	movabs $0x802ca7,%rdi
+  800338:	00 00 00 
+  80033b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800340:	49 b9 12 1c 80 00 00 	movabs $0x801c12,%r9
+  800347:	00 00 00 
+  80034a:	41 ff d1             	call   *%r9
+
+000000000080034d <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  80034d:	55                   	push   %rbp
+  80034e:	48 89 e5             	mov    %rsp,%rbp
+  800351:	53                   	push   %rbx
+  800352:	48 83 ec 08          	sub    $0x8,%rsp
+  800356:	48 89 f1             	mov    %rsi,%rcx
+  800359:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  80035c:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80035f:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800364:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800369:	be 00 00 00 00       	mov    $0x0,%esi
+  80036e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800374:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800376:	48 85 c0             	test   %rax,%rax
+  800379:	7f 06                	jg     800381 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  80037b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80037f:	c9                   	leave
+  800380:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800381:	49 89 c0             	mov    %rax,%r8
+  800384:	b9 06 00 00 00       	mov    $0x6,%ecx
+  800389:	48 ba 88 2c 80 00 00 	movabs $0x802c88,%rdx
+  800390:	00 00 00 
+  800393:	be 26 00 00 00       	mov    $0x26,%esi
+  800398:	48 bf a7 2c 80 00 00 	movabs $0x802ca7,%rdi
+  80039f:	00 00 00 
+  8003a2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003a7:	49 b9 12 1c 80 00 00 	movabs $0x801c12,%r9
+  8003ae:	00 00 00 
+  8003b1:	41 ff d1             	call   *%r9
+
+00000000008003b4 <sys_region_batch>:
+
+int
+sys_region_batch(const struct RegionOp *ops, size_t count) {
+  8003b4:	55                   	push   %rbp
+  8003b5:	48 89 e5             	mov    %rsp,%rbp
+  8003b8:	53                   	push   %rbx
+  8003b9:	48 83 ec 08          	sub    $0x8,%rsp
+  8003bd:	48 89 fa             	mov    %rdi,%rdx
+  8003c0:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8003c3:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8003c8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8003cd:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8003d2:	be 00 00 00 00       	mov    $0x0,%esi
+  8003d7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8003dd:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8003df:	48 85 c0             	test   %rax,%rax
+  8003e2:	7f 06                	jg     8003ea <sys_region_batch+0x36>
+        else
+            platform_asan_unpoison(va, ops[i].size);
+    }
+#endif
+    return res;
+}
+  8003e4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8003e8:	c9                   	leave
+  8003e9:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8003ea:	49 89 c0             	mov    %rax,%r8
+  8003ed:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  8003f2:	48 ba 88 2c 80 00 00 	movabs $0x802c88,%rdx
+  8003f9:	00 00 00 
+  8003fc:	be 26 00 00 00       	mov    $0x26,%esi
+  800401:	48 bf a7 2c 80 00 00 	movabs $0x802ca7,%rdi
+  800408:	00 00 00 
+  80040b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800410:	49 b9 12 1c 80 00 00 	movabs $0x801c12,%r9
+  800417:	00 00 00 
+  80041a:	41 ff d1             	call   *%r9
+
+000000000080041d <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  80041d:	55                   	push   %rbp
+  80041e:	48 89 e5             	mov    %rsp,%rbp
+  800421:	53                   	push   %rbx
+  800422:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  800426:	48 63 ce             	movslq %esi,%rcx
+  800429:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80042c:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800431:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800436:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80043b:	be 00 00 00 00       	mov    $0x0,%esi
+  800440:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800446:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800448:	48 85 c0             	test   %rax,%rax
+  80044b:	7f 06                	jg     800453 <sys_env_set_status+0x36>
+}
+  80044d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800451:	c9                   	leave
+  800452:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800453:	49 89 c0             	mov    %rax,%r8
+  800456:	b9 09 00 00 00       	mov    $0x9,%ecx
+  80045b:	48 ba 88 2c 80 00 00 	movabs $0x802c88,%rdx
+  800462:	00 00 00 
+  800465:	be 26 00 00 00       	mov    $0x26,%esi
+  80046a:	48 bf a7 2c 80 00 00 	movabs $0x802ca7,%rdi
+  800471:	00 00 00 
+  800474:	b8 00 00 00 00       	mov    $0x0,%eax
+  800479:	49 b9 12 1c 80 00 00 	movabs $0x801c12,%r9
+  800480:	00 00 00 
+  800483:	41 ff d1             	call   *%r9
+
+0000000000800486 <sys_env_set_weight>:
+
+int
+sys_env_set_weight(envid_t envid, uint32_t weight) {
+  800486:	55                   	push   %rbp
+  800487:	48 89 e5             	mov    %rsp,%rbp
+  80048a:	53                   	push   %rbx
+  80048b:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_weight, 1, envid, weight, 0, 0, 0, 0);
+  80048f:	89 f1                	mov    %esi,%ecx
+  800491:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800494:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800499:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80049e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8004a3:	be 00 00 00 00       	mov    $0x0,%esi
+  8004a8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8004ae:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8004b0:	48 85 c0             	test   %rax,%rax
+  8004b3:	7f 06                	jg     8004bb <sys_env_set_weight+0x35>
+}
+  8004b5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8004b9:	c9                   	leave
+  8004ba:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8004bb:	49 89 c0             	mov    %rax,%r8
+  8004be:	b9 10 00 00 00       	mov    $0x10,%ecx
+  8004c3:	48 ba 88 2c 80 00 00 	movabs $0x802c88,%rdx
+  8004ca:	00 00 00 
+  8004cd:	be 26 00 00 00       	mov    $0x26,%esi
+  8004d2:	48 bf a7 2c 80 00 00 	movabs $0x802ca7,%rdi
+  8004d9:	00 00 00 
+  8004dc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004e1:	49 b9 12 1c 80 00 00 	movabs $0x801c12,%r9
+  8004e8:	00 00 00 
+  8004eb:	41 ff d1             	call   *%r9
+
+00000000008004ee <sys_env_set_rt>:
+
+int
+sys_env_set_rt(envid_t envid, uint64_t period, uint64_t budget, uint64_t deadline) {
+  8004ee:	55                   	push   %rbp
+  8004ef:	48 89 e5             	mov    %rsp,%rbp
+  8004f2:	53                   	push   %rbx
+  8004f3:	48 83 ec 08          	sub    $0x8,%rsp
+  8004f7:	89 f8                	mov    %edi,%eax
+  8004f9:	48 89 d3             	mov    %rdx,%rbx
+  8004fc:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_env_set_rt, 1, envid, period, budget, deadline, 0, 0);
+  8004ff:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800502:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800507:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80050a:	be 00 00 00 00       	mov    $0x0,%esi
+  80050f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800515:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800517:	48 85 c0             	test   %rax,%rax
+  80051a:	7f 06                	jg     800522 <sys_env_set_rt+0x34>
+}
+  80051c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800520:	c9                   	leave
+  800521:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800522:	49 89 c0             	mov    %rax,%r8
+  800525:	b9 11 00 00 00       	mov    $0x11,%ecx
+  80052a:	48 ba 88 2c 80 00 00 	movabs $0x802c88,%rdx
+  800531:	00 00 00 
+  800534:	be 26 00 00 00       	mov    $0x26,%esi
+  800539:	48 bf a7 2c 80 00 00 	movabs $0x802ca7,%rdi
+  800540:	00 00 00 
+  800543:	b8 00 00 00 00       	mov    $0x0,%eax
+  800548:	49 b9 12 1c 80 00 00 	movabs $0x801c12,%r9
+  80054f:	00 00 00 
+  800552:	41 ff d1             	call   *%r9
+
+0000000000800555 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  800555:	55                   	push   %rbp
+  800556:	48 89 e5             	mov    %rsp,%rbp
+  800559:	53                   	push   %rbx
+  80055a:	48 83 ec 08          	sub    $0x8,%rsp
+  80055e:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  800561:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800564:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800569:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80056e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800573:	be 00 00 00 00       	mov    $0x0,%esi
+  800578:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80057e:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800580:	48 85 c0             	test   %rax,%rax
+  800583:	7f 06                	jg     80058b <sys_env_set_trapframe+0x36>
+}
+  800585:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800589:	c9                   	leave
+  80058a:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80058b:	49 89 c0             	mov    %rax,%r8
+  80058e:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  800593:	48 ba 88 2c 80 00 00 	movabs $0x802c88,%rdx
+  80059a:	00 00 00 
+  80059d:	be 26 00 00 00       	mov    $0x26,%esi
+  8005a2:	48 bf a7 2c 80 00 00 	movabs $0x802ca7,%rdi
+  8005a9:	00 00 00 
+  8005ac:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005b1:	49 b9 12 1c 80 00 00 	movabs $0x801c12,%r9
+  8005b8:	00 00 00 
+  8005bb:	41 ff d1             	call   *%r9
+
+00000000008005be <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  8005be:	55                   	push   %rbp
+  8005bf:	48 89 e5             	mov    %rsp,%rbp
+  8005c2:	53                   	push   %rbx
+  8005c3:	48 83 ec 08          	sub    $0x8,%rsp
+  8005c7:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  8005ca:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8005cd:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8005d2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8005d7:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8005dc:	be 00 00 00 00       	mov    $0x0,%esi
+  8005e1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8005e7:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8005e9:	48 85 c0             	test   %rax,%rax
+  8005ec:	7f 06                	jg     8005f4 <sys_env_set_pgfault_upcall+0x36>
+}
+  8005ee:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8005f2:	c9                   	leave
+  8005f3:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8005f4:	49 89 c0             	mov    %rax,%r8
+  8005f7:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  8005fc:	48 ba 88 2c 80 00 00 	movabs $0x802c88,%rdx
+  800603:	00 00 00 
+  800606:	be 26 00 00 00       	mov    $0x26,%esi
+  80060b:	48 bf a7 2c 80 00 00 	movabs $0x802ca7,%rdi
+  800612:	00 00 00 
+  800615:	b8 00 00 00 00       	mov    $0x0,%eax
+  80061a:	49 b9 12 1c 80 00 00 	movabs $0x801c12,%r9
+  800621:	00 00 00 
+  800624:	41 ff d1             	call   *%r9
+
+0000000000800627 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  800627:	55                   	push   %rbp
+  800628:	48 89 e5             	mov    %rsp,%rbp
+  80062b:	53                   	push   %rbx
+  80062c:	89 f8                	mov    %edi,%eax
+  80062e:	49 89 f1             	mov    %rsi,%r9
+  800631:	48 89 d3             	mov    %rdx,%rbx
+  800634:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  800637:	49 63 f0             	movslq %r8d,%rsi
+  80063a:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80063d:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800642:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800645:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80064b:	cd 30                	int    $0x30
+}
+  80064d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800651:	c9                   	leave
+  800652:	c3                   	ret
+
+0000000000800653 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  800653:	55                   	push   %rbp
+  800654:	48 89 e5             	mov    %rsp,%rbp
+  800657:	53                   	push   %rbx
+  800658:	48 83 ec 08          	sub    $0x8,%rsp
+  80065c:	48 89 fa             	mov    %rdi,%rdx
+  80065f:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  800662:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800667:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80066c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800671:	be 00 00 00 00       	mov    $0x0,%esi
+  800676:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80067c:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80067e:	48 85 c0             	test   %rax,%rax
+  800681:	7f 06                	jg     800689 <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  800683:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800687:	c9                   	leave
+  800688:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800689:	49 89 c0             	mov    %rax,%r8
+  80068c:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  800691:	48 ba 88 2c 80 00 00 	movabs $0x802c88,%rdx
+  800698:	00 00 00 
+  80069b:	be 26 00 00 00       	mov    $0x26,%esi
+  8006a0:	48 bf a7 2c 80 00 00 	movabs $0x802ca7,%rdi
+  8006a7:	00 00 00 
+  8006aa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006af:	49 b9 12 1c 80 00 00 	movabs $0x801c12,%r9
+  8006b6:	00 00 00 
+  8006b9:	41 ff d1             	call   *%r9
+
+00000000008006bc <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8006bc:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8006c3:	ff ff ff 
+  8006c6:	48 01 f8             	add    %rdi,%rax
+  8006c9:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  8006cd:	c3                   	ret
+
+00000000008006ce <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8006ce:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8006d5:	ff ff ff 
+  8006d8:	48 01 f8             	add    %rdi,%rax
+  8006db:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  8006df:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  8006e5:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  8006e9:	c3                   	ret
+
+00000000008006ea <fd_alloc_from>:
+}
+
+/* Like fd_alloc(), but only considers fds starting from fdnum,
+ * so that several fds can be found before their pages are allocated */
+int
+fd_alloc_from(int fdnum, struct Fd **fd_store) {
+  8006ea:	55                   	push   %rbp
+  8006eb:	48 89 e5             	mov    %rsp,%rbp
+  8006ee:	41 57                	push   %r15
+  8006f0:	41 56                	push   %r14
+  8006f2:	41 55                	push   %r13
+  8006f4:	41 54                	push   %r12
+  8006f6:	53                   	push   %rbx
+  8006f7:	48 83 ec 08          	sub    $0x8,%rsp
+  8006fb:	49 89 f7             	mov    %rsi,%r15
+    for (int i = MAX(fdnum, 0); i < MAXFD; i++) {
+  8006fe:	85 ff                	test   %edi,%edi
+  800700:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  800706:	44 0f 49 e7          	cmovns %edi,%r12d
+  80070a:	83 ff 1f             	cmp    $0x1f,%edi
+  80070d:	7f 37                	jg     800746 <fd_alloc_from+0x5c>
+  80070f:	49 63 dc             	movslq %r12d,%rbx
+  800712:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  800719:	48 c1 e3 0c          	shl    $0xc,%rbx
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  80071d:	49 be f3 17 80 00 00 	movabs $0x8017f3,%r14
+  800724:	00 00 00 
+        struct Fd *fd = INDEX2FD(i);
+  800727:	49 89 dd             	mov    %rbx,%r13
+        if (!(get_prot(fd) & PROT_R)) {
+  80072a:	48 89 df             	mov    %rbx,%rdi
+  80072d:	41 ff d6             	call   *%r14
+  800730:	83 e0 04             	and    $0x4,%eax
+  800733:	74 1c                	je     800751 <fd_alloc_from+0x67>
+    for (int i = MAX(fdnum, 0); i < MAXFD; i++) {
+  800735:	41 83 c4 01          	add    $0x1,%r12d
+  800739:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  800740:	41 83 fc 1f          	cmp    $0x1f,%r12d
+  800744:	7e e1                	jle    800727 <fd_alloc_from+0x3d>
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  800746:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  80074c:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  800751:	4d 89 2f             	mov    %r13,(%r15)
+}
+  800754:	48 83 c4 08          	add    $0x8,%rsp
+  800758:	5b                   	pop    %rbx
+  800759:	41 5c                	pop    %r12
+  80075b:	41 5d                	pop    %r13
+  80075d:	41 5e                	pop    %r14
+  80075f:	41 5f                	pop    %r15
+  800761:	5d                   	pop    %rbp
+  800762:	c3                   	ret
+
+0000000000800763 <fd_alloc>:
+fd_alloc(struct Fd **fd_store) {
+  800763:	55                   	push   %rbp
+  800764:	48 89 e5             	mov    %rsp,%rbp
+  800767:	48 89 fe             	mov    %rdi,%rsi
+    return fd_alloc_from(0, fd_store);
+  80076a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80076f:	48 b8 ea 06 80 00 00 	movabs $0x8006ea,%rax
+  800776:	00 00 00 
+  800779:	ff d0                	call   *%rax
+}
+  80077b:	5d                   	pop    %rbp
+  80077c:	c3                   	ret
+
+000000000080077d <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  80077d:	83 ff 1f             	cmp    $0x1f,%edi
+  800780:	77 39                	ja     8007bb <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  800782:	55                   	push   %rbp
+  800783:	48 89 e5             	mov    %rsp,%rbp
+  800786:	41 54                	push   %r12
+  800788:	53                   	push   %rbx
+  800789:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  80078c:	48 63 df             	movslq %edi,%rbx
+  80078f:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  800796:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  80079a:	48 89 df             	mov    %rbx,%rdi
+  80079d:	48 b8 f3 17 80 00 00 	movabs $0x8017f3,%rax
+  8007a4:	00 00 00 
+  8007a7:	ff d0                	call   *%rax
+  8007a9:	a8 04                	test   $0x4,%al
+  8007ab:	74 14                	je     8007c1 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  8007ad:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  8007b1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8007b6:	5b                   	pop    %rbx
+  8007b7:	41 5c                	pop    %r12
+  8007b9:	5d                   	pop    %rbp
+  8007ba:	c3                   	ret
+        return -E_INVAL;
+  8007bb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8007c0:	c3                   	ret
+        return -E_INVAL;
+  8007c1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8007c6:	eb ee                	jmp    8007b6 <fd_lookup+0x39>
+
+00000000008007c8 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  8007c8:	55                   	push   %rbp
+  8007c9:	48 89 e5             	mov    %rsp,%rbp
+  8007cc:	41 54                	push   %r12
+  8007ce:	53                   	push   %rbx
+  8007cf:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  8007d2:	48 b8 40 2d 80 00 00 	movabs $0x802d40,%rax
+  8007d9:	00 00 00 
+  8007dc:	48 bb 20 40 80 00 00 	movabs $0x804020,%rbx
+  8007e3:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  8007e6:	39 3b                	cmp    %edi,(%rbx)
+  8007e8:	74 47                	je     800831 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  8007ea:	48 83 c0 08          	add    $0x8,%rax
+  8007ee:	48 8b 18             	mov    (%rax),%rbx
+  8007f1:	48 85 db             	test   %rbx,%rbx
+  8007f4:	75 f0                	jne    8007e6 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8007f6:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  8007fd:	00 00 00 
+  800800:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+  800806:	89 fa                	mov    %edi,%edx
+  800808:	48 bf b8 2c 80 00 00 	movabs $0x802cb8,%rdi
+  80080f:	00 00 00 
+  800812:	b8 00 00 00 00       	mov    $0x0,%eax
+  800817:	48 b9 62 1d 80 00 00 	movabs $0x801d62,%rcx
+  80081e:	00 00 00 
+  800821:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  800823:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  800828:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  80082c:	5b                   	pop    %rbx
+  80082d:	41 5c                	pop    %r12
+  80082f:	5d                   	pop    %rbp
+  800830:	c3                   	ret
+            return 0;
+  800831:	b8 00 00 00 00       	mov    $0x0,%eax
+  800836:	eb f0                	jmp    800828 <dev_lookup+0x60>
+
+0000000000800838 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  800838:	55                   	push   %rbp
+  800839:	48 89 e5             	mov    %rsp,%rbp
+  80083c:	41 55                	push   %r13
+  80083e:	41 54                	push   %r12
+  800840:	53                   	push   %rbx
+  800841:	48 83 ec 18          	sub    $0x18,%rsp
+  800845:	48 89 fb             	mov    %rdi,%rbx
+  800848:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80084b:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  800852:	ff ff ff 
+  800855:	48 01 df             	add    %rbx,%rdi
+  800858:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  80085c:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800860:	48 b8 7d 07 80 00 00 	movabs $0x80077d,%rax
+  800867:	00 00 00 
+  80086a:	ff d0                	call   *%rax
+  80086c:	41 89 c5             	mov    %eax,%r13d
+  80086f:	85 c0                	test   %eax,%eax
+  800871:	78 06                	js     800879 <fd_close+0x41>
+  800873:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  800877:	74 1a                	je     800893 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  800879:	45 84 e4             	test   %r12b,%r12b
+  80087c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800881:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  800885:	44 89 e8             	mov    %r13d,%eax
+  800888:	48 83 c4 18          	add    $0x18,%rsp
+  80088c:	5b                   	pop    %rbx
+  80088d:	41 5c                	pop    %r12
+  80088f:	41 5d                	pop    %r13
+  800891:	5d                   	pop    %rbp
+  800892:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  800893:	8b 3b                	mov    (%rbx),%edi
+  800895:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800899:	48 b8 c8 07 80 00 00 	movabs $0x8007c8,%rax
+  8008a0:	00 00 00 
+  8008a3:	ff d0                	call   *%rax
+  8008a5:	41 89 c5             	mov    %eax,%r13d
+  8008a8:	85 c0                	test   %eax,%eax
+  8008aa:	78 1b                	js     8008c7 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  8008ac:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8008b0:	48 8b 40 20          	mov    0x20(%rax),%rax
+  8008b4:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  8008ba:	48 85 c0             	test   %rax,%rax
+  8008bd:	74 08                	je     8008c7 <fd_close+0x8f>
+  8008bf:	48 89 df             	mov    %rbx,%rdi
+  8008c2:	ff d0                	call   *%rax
+  8008c4:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8008c7:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8008cc:	48 89 de             	mov    %rbx,%rsi
+  8008cf:	bf 00 00 00 00       	mov    $0x0,%edi
+  8008d4:	48 b8 4d 03 80 00 00 	movabs $0x80034d,%rax
+  8008db:	00 00 00 
+  8008de:	ff d0                	call   *%rax
+    return res;
+  8008e0:	eb a3                	jmp    800885 <fd_close+0x4d>
+
+00000000008008e2 <close>:
+
+int
+close(int fdnum) {
+  8008e2:	55                   	push   %rbp
+  8008e3:	48 89 e5             	mov    %rsp,%rbp
+  8008e6:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  8008ea:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8008ee:	48 b8 7d 07 80 00 00 	movabs $0x80077d,%rax
+  8008f5:	00 00 00 
+  8008f8:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8008fa:	85 c0                	test   %eax,%eax
+  8008fc:	78 15                	js     800913 <close+0x31>
+
+    return fd_close(fd, 1);
+  8008fe:	be 01 00 00 00       	mov    $0x1,%esi
+  800903:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  800907:	48 b8 38 08 80 00 00 	movabs $0x800838,%rax
+  80090e:	00 00 00 
+  800911:	ff d0                	call   *%rax
+}
+  800913:	c9                   	leave
+  800914:	c3                   	ret
+
+0000000000800915 <close_all>:
+
+void
+close_all(void) {
+  800915:	55                   	push   %rbp
+  800916:	48 89 e5             	mov    %rsp,%rbp
+  800919:	41 54                	push   %r12
+  80091b:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  80091c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800921:	49 bc e2 08 80 00 00 	movabs $0x8008e2,%r12
+  800928:	00 00 00 
+  80092b:	89 df                	mov    %ebx,%edi
+  80092d:	41 ff d4             	call   *%r12
+  800930:	83 c3 01             	add    $0x1,%ebx
+  800933:	83 fb 20             	cmp    $0x20,%ebx
+  800936:	75 f3                	jne    80092b <close_all+0x16>
+}
+  800938:	5b                   	pop    %rbx
+  800939:	41 5c                	pop    %r12
+  80093b:	5d                   	pop    %rbp
+  80093c:	c3                   	ret
+
+000000000080093d <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  80093d:	55                   	push   %rbp
+  80093e:	48 89 e5             	mov    %rsp,%rbp
+  800941:	41 57                	push   %r15
+  800943:	41 56                	push   %r14
+  800945:	41 55                	push   %r13
+  800947:	41 54                	push   %r12
+  800949:	53                   	push   %rbx
+  80094a:	48 83 ec 18          	sub    $0x18,%rsp
+  80094e:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  800951:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  800955:	48 b8 7d 07 80 00 00 	movabs $0x80077d,%rax
+  80095c:	00 00 00 
+  80095f:	ff d0                	call   *%rax
+  800961:	89 c3                	mov    %eax,%ebx
+  800963:	85 c0                	test   %eax,%eax
+  800965:	0f 88 b8 00 00 00    	js     800a23 <dup+0xe6>
+    close(newfdnum);
+  80096b:	44 89 e7             	mov    %r12d,%edi
+  80096e:	48 b8 e2 08 80 00 00 	movabs $0x8008e2,%rax
+  800975:	00 00 00 
+  800978:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  80097a:	4d 63 ec             	movslq %r12d,%r13
+  80097d:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  800984:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  800988:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  80098c:	4c 89 ff             	mov    %r15,%rdi
+  80098f:	49 be ce 06 80 00 00 	movabs $0x8006ce,%r14
+  800996:	00 00 00 
+  800999:	41 ff d6             	call   *%r14
+  80099c:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  80099f:	4c 89 ef             	mov    %r13,%rdi
+  8009a2:	41 ff d6             	call   *%r14
+  8009a5:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  8009a8:	48 89 df             	mov    %rbx,%rdi
+  8009ab:	48 b8 f3 17 80 00 00 	movabs $0x8017f3,%rax
+  8009b2:	00 00 00 
+  8009b5:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  8009b7:	a8 04                	test   $0x4,%al
+  8009b9:	74 2b                	je     8009e6 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  8009bb:	41 89 c1             	mov    %eax,%r9d
+  8009be:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8009c4:	4c 89 f1             	mov    %r14,%rcx
+  8009c7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8009cc:	48 89 de             	mov    %rbx,%rsi
+  8009cf:	bf 00 00 00 00       	mov    $0x0,%edi
+  8009d4:	48 b8 e8 02 80 00 00 	movabs $0x8002e8,%rax
+  8009db:	00 00 00 
+  8009de:	ff d0                	call   *%rax
+  8009e0:	89 c3                	mov    %eax,%ebx
+  8009e2:	85 c0                	test   %eax,%eax
+  8009e4:	78 4e                	js     800a34 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  8009e6:	4c 89 ff             	mov    %r15,%rdi
+  8009e9:	48 b8 f3 17 80 00 00 	movabs $0x8017f3,%rax
+  8009f0:	00 00 00 
+  8009f3:	ff d0                	call   *%rax
+  8009f5:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  8009f8:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8009fe:	4c 89 e9             	mov    %r13,%rcx
+  800a01:	ba 00 00 00 00       	mov    $0x0,%edx
+  800a06:	4c 89 fe             	mov    %r15,%rsi
+  800a09:	bf 00 00 00 00       	mov    $0x0,%edi
+  800a0e:	48 b8 e8 02 80 00 00 	movabs $0x8002e8,%rax
+  800a15:	00 00 00 
+  800a18:	ff d0                	call   *%rax
+  800a1a:	89 c3                	mov    %eax,%ebx
+  800a1c:	85 c0                	test   %eax,%eax
+  800a1e:	78 14                	js     800a34 <dup+0xf7>
+
+    return newfdnum;
+  800a20:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  800a23:	89 d8                	mov    %ebx,%eax
+  800a25:	48 83 c4 18          	add    $0x18,%rsp
+  800a29:	5b                   	pop    %rbx
+  800a2a:	41 5c                	pop    %r12
+  800a2c:	41 5d                	pop    %r13
+  800a2e:	41 5e                	pop    %r14
+  800a30:	41 5f                	pop    %r15
+  800a32:	5d                   	pop    %rbp
+  800a33:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  800a34:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800a39:	4c 89 ee             	mov    %r13,%rsi
+  800a3c:	bf 00 00 00 00       	mov    $0x0,%edi
+  800a41:	49 bc 4d 03 80 00 00 	movabs $0x80034d,%r12
+  800a48:	00 00 00 
+  800a4b:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  800a4e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800a53:	4c 89 f6             	mov    %r14,%rsi
+  800a56:	bf 00 00 00 00       	mov    $0x0,%edi
+  800a5b:	41 ff d4             	call   *%r12
+    return res;
+  800a5e:	eb c3                	jmp    800a23 <dup+0xe6>
+
+0000000000800a60 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  800a60:	55                   	push   %rbp
+  800a61:	48 89 e5             	mov    %rsp,%rbp
+  800a64:	41 56                	push   %r14
+  800a66:	41 55                	push   %r13
+  800a68:	41 54                	push   %r12
+  800a6a:	53                   	push   %rbx
+  800a6b:	48 83 ec 10          	sub    $0x10,%rsp
+  800a6f:	89 fb                	mov    %edi,%ebx
+  800a71:	49 89 f4             	mov    %rsi,%r12
+  800a74:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800a77:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800a7b:	48 b8 7d 07 80 00 00 	movabs $0x80077d,%rax
+  800a82:	00 00 00 
+  800a85:	ff d0                	call   *%rax
+  800a87:	85 c0                	test   %eax,%eax
+  800a89:	78 4c                	js     800ad7 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800a8b:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  800a8f:	41 8b 3e             	mov    (%r14),%edi
+  800a92:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800a96:	48 b8 c8 07 80 00 00 	movabs $0x8007c8,%rax
+  800a9d:	00 00 00 
+  800aa0:	ff d0                	call   *%rax
+  800aa2:	85 c0                	test   %eax,%eax
+  800aa4:	78 35                	js     800adb <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  800aa6:	41 8b 46 08          	mov    0x8(%r14),%eax
+  800aaa:	83 e0 03             	and    $0x3,%eax
+  800aad:	83 f8 01             	cmp    $0x1,%eax
+  800ab0:	74 2d                	je     800adf <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  800ab2:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800ab6:	48 8b 40 10          	mov    0x10(%rax),%rax
+  800aba:	48 85 c0             	test   %rax,%rax
+  800abd:	74 56                	je     800b15 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  800abf:	4c 89 ea             	mov    %r13,%rdx
+  800ac2:	4c 89 e6             	mov    %r12,%rsi
+  800ac5:	4c 89 f7             	mov    %r14,%rdi
+  800ac8:	ff d0                	call   *%rax
+}
+  800aca:	48 83 c4 10          	add    $0x10,%rsp
+  800ace:	5b                   	pop    %rbx
+  800acf:	41 5c                	pop    %r12
+  800ad1:	41 5d                	pop    %r13
+  800ad3:	41 5e                	pop    %r14
+  800ad5:	5d                   	pop    %rbp
+  800ad6:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800ad7:	48 98                	cltq
+  800ad9:	eb ef                	jmp    800aca <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800adb:	48 98                	cltq
+  800add:	eb eb                	jmp    800aca <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  800adf:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  800ae6:	00 00 00 
+  800ae9:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+  800aef:	89 da                	mov    %ebx,%edx
+  800af1:	48 bf f9 2c 80 00 00 	movabs $0x802cf9,%rdi
+  800af8:	00 00 00 
+  800afb:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b00:	48 b9 62 1d 80 00 00 	movabs $0x801d62,%rcx
+  800b07:	00 00 00 
+  800b0a:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  800b0c:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  800b13:	eb b5                	jmp    800aca <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  800b15:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  800b1c:	eb ac                	jmp    800aca <read+0x6a>
+
+0000000000800b1e <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  800b1e:	55                   	push   %rbp
+  800b1f:	48 89 e5             	mov    %rsp,%rbp
+  800b22:	41 57                	push   %r15
+  800b24:	41 56                	push   %r14
+  800b26:	41 55                	push   %r13
+  800b28:	41 54                	push   %r12
+  800b2a:	53                   	push   %rbx
+  800b2b:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  800b2f:	48 85 d2             	test   %rdx,%rdx
+  800b32:	74 54                	je     800b88 <readn+0x6a>
+  800b34:	41 89 fd             	mov    %edi,%r13d
+  800b37:	49 89 f6             	mov    %rsi,%r14
+  800b3a:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  800b3d:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  800b42:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  800b47:	49 bf 60 0a 80 00 00 	movabs $0x800a60,%r15
+  800b4e:	00 00 00 
+  800b51:	4c 89 e2             	mov    %r12,%rdx
+  800b54:	48 29 f2             	sub    %rsi,%rdx
+  800b57:	4c 01 f6             	add    %r14,%rsi
+  800b5a:	44 89 ef             	mov    %r13d,%edi
+  800b5d:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  800b60:	85 c0                	test   %eax,%eax
+  800b62:	78 20                	js     800b84 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  800b64:	01 c3                	add    %eax,%ebx
+  800b66:	85 c0                	test   %eax,%eax
+  800b68:	74 08                	je     800b72 <readn+0x54>
+  800b6a:	48 63 f3             	movslq %ebx,%rsi
+  800b6d:	4c 39 e6             	cmp    %r12,%rsi
+  800b70:	72 df                	jb     800b51 <readn+0x33>
+    }
+    return res;
+  800b72:	48 63 c3             	movslq %ebx,%rax
+}
+  800b75:	48 83 c4 08          	add    $0x8,%rsp
+  800b79:	5b                   	pop    %rbx
+  800b7a:	41 5c                	pop    %r12
+  800b7c:	41 5d                	pop    %r13
+  800b7e:	41 5e                	pop    %r14
+  800b80:	41 5f                	pop    %r15
+  800b82:	5d                   	pop    %rbp
+  800b83:	c3                   	ret
+        if (inc < 0) return inc;
+  800b84:	48 98                	cltq
+  800b86:	eb ed                	jmp    800b75 <readn+0x57>
+    int inc = 1, res = 0;
+  800b88:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800b8d:	eb e3                	jmp    800b72 <readn+0x54>
+
+0000000000800b8f <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  800b8f:	55                   	push   %rbp
+  800b90:	48 89 e5             	mov    %rsp,%rbp
+  800b93:	41 56                	push   %r14
+  800b95:	41 55                	push   %r13
+  800b97:	41 54                	push   %r12
+  800b99:	53                   	push   %rbx
+  800b9a:	48 83 ec 10          	sub    $0x10,%rsp
+  800b9e:	89 fb                	mov    %edi,%ebx
+  800ba0:	49 89 f4             	mov    %rsi,%r12
+  800ba3:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800ba6:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800baa:	48 b8 7d 07 80 00 00 	movabs $0x80077d,%rax
+  800bb1:	00 00 00 
+  800bb4:	ff d0                	call   *%rax
+  800bb6:	85 c0                	test   %eax,%eax
+  800bb8:	78 47                	js     800c01 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800bba:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  800bbe:	41 8b 3e             	mov    (%r14),%edi
+  800bc1:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800bc5:	48 b8 c8 07 80 00 00 	movabs $0x8007c8,%rax
+  800bcc:	00 00 00 
+  800bcf:	ff d0                	call   *%rax
+  800bd1:	85 c0                	test   %eax,%eax
+  800bd3:	78 30                	js     800c05 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800bd5:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  800bda:	74 2d                	je     800c09 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  800bdc:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800be0:	48 8b 40 18          	mov    0x18(%rax),%rax
+  800be4:	48 85 c0             	test   %rax,%rax
+  800be7:	74 56                	je     800c3f <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  800be9:	4c 89 ea             	mov    %r13,%rdx
+  800bec:	4c 89 e6             	mov    %r12,%rsi
+  800bef:	4c 89 f7             	mov    %r14,%rdi
+  800bf2:	ff d0                	call   *%rax
+}
+  800bf4:	48 83 c4 10          	add    $0x10,%rsp
+  800bf8:	5b                   	pop    %rbx
+  800bf9:	41 5c                	pop    %r12
+  800bfb:	41 5d                	pop    %r13
+  800bfd:	41 5e                	pop    %r14
+  800bff:	5d                   	pop    %rbp
+  800c00:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800c01:	48 98                	cltq
+  800c03:	eb ef                	jmp    800bf4 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800c05:	48 98                	cltq
+  800c07:	eb eb                	jmp    800bf4 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  800c09:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  800c10:	00 00 00 
+  800c13:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+  800c19:	89 da                	mov    %ebx,%edx
+  800c1b:	48 bf 15 2d 80 00 00 	movabs $0x802d15,%rdi
+  800c22:	00 00 00 
+  800c25:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c2a:	48 b9 62 1d 80 00 00 	movabs $0x801d62,%rcx
+  800c31:	00 00 00 
+  800c34:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  800c36:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  800c3d:	eb b5                	jmp    800bf4 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  800c3f:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  800c46:	eb ac                	jmp    800bf4 <write+0x65>
+
+0000000000800c48 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  800c48:	55                   	push   %rbp
+  800c49:	48 89 e5             	mov    %rsp,%rbp
+  800c4c:	53                   	push   %rbx
+  800c4d:	48 83 ec 18          	sub    $0x18,%rsp
+  800c51:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800c53:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800c57:	48 b8 7d 07 80 00 00 	movabs $0x80077d,%rax
+  800c5e:	00 00 00 
+  800c61:	ff d0                	call   *%rax
+  800c63:	85 c0                	test   %eax,%eax
+  800c65:	78 0c                	js     800c73 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  800c67:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800c6b:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  800c6e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800c73:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800c77:	c9                   	leave
+  800c78:	c3                   	ret
+
+0000000000800c79 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  800c79:	55                   	push   %rbp
+  800c7a:	48 89 e5             	mov    %rsp,%rbp
+  800c7d:	41 55                	push   %r13
+  800c7f:	41 54                	push   %r12
+  800c81:	53                   	push   %rbx
+  800c82:	48 83 ec 18          	sub    $0x18,%rsp
+  800c86:	89 fb                	mov    %edi,%ebx
+  800c88:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800c8b:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800c8f:	48 b8 7d 07 80 00 00 	movabs $0x80077d,%rax
+  800c96:	00 00 00 
+  800c99:	ff d0                	call   *%rax
+  800c9b:	85 c0                	test   %eax,%eax
+  800c9d:	78 38                	js     800cd7 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800c9f:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  800ca3:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  800ca7:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800cab:	48 b8 c8 07 80 00 00 	movabs $0x8007c8,%rax
+  800cb2:	00 00 00 
+  800cb5:	ff d0                	call   *%rax
+  800cb7:	85 c0                	test   %eax,%eax
+  800cb9:	78 1c                	js     800cd7 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800cbb:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  800cc0:	74 20                	je     800ce2 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  800cc2:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800cc6:	48 8b 40 30          	mov    0x30(%rax),%rax
+  800cca:	48 85 c0             	test   %rax,%rax
+  800ccd:	74 47                	je     800d16 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  800ccf:	44 89 e6             	mov    %r12d,%esi
+  800cd2:	4c 89 ef             	mov    %r13,%rdi
+  800cd5:	ff d0                	call   *%rax
+}
+  800cd7:	48 83 c4 18          	add    $0x18,%rsp
+  800cdb:	5b                   	pop    %rbx
+  800cdc:	41 5c                	pop    %r12
+  800cde:	41 5d                	pop    %r13
+  800ce0:	5d                   	pop    %rbp
+  800ce1:	c3                   	ret
+                thisenv->env_id, fdnum);
+  800ce2:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  800ce9:	00 00 00 
+  800cec:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  800cf2:	89 da                	mov    %ebx,%edx
+  800cf4:	48 bf d8 2c 80 00 00 	movabs $0x802cd8,%rdi
+  800cfb:	00 00 00 
+  800cfe:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d03:	48 b9 62 1d 80 00 00 	movabs $0x801d62,%rcx
+  800d0a:	00 00 00 
+  800d0d:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  800d0f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800d14:	eb c1                	jmp    800cd7 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  800d16:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  800d1b:	eb ba                	jmp    800cd7 <ftruncate+0x5e>
+
+0000000000800d1d <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  800d1d:	55                   	push   %rbp
+  800d1e:	48 89 e5             	mov    %rsp,%rbp
+  800d21:	41 54                	push   %r12
+  800d23:	53                   	push   %rbx
+  800d24:	48 83 ec 10          	sub    $0x10,%rsp
+  800d28:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800d2b:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800d2f:	48 b8 7d 07 80 00 00 	movabs $0x80077d,%rax
+  800d36:	00 00 00 
+  800d39:	ff d0                	call   *%rax
+  800d3b:	85 c0                	test   %eax,%eax
+  800d3d:	78 4e                	js     800d8d <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800d3f:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  800d43:	41 8b 3c 24          	mov    (%r12),%edi
+  800d47:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  800d4b:	48 b8 c8 07 80 00 00 	movabs $0x8007c8,%rax
+  800d52:	00 00 00 
+  800d55:	ff d0                	call   *%rax
+  800d57:	85 c0                	test   %eax,%eax
+  800d59:	78 32                	js     800d8d <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  800d5b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800d5f:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  800d64:	74 30                	je     800d96 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  800d66:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  800d69:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  800d70:	00 00 00 
+    stat->st_isdir = 0;
+  800d73:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  800d7a:	00 00 00 
+    stat->st_dev = dev;
+  800d7d:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  800d84:	48 89 de             	mov    %rbx,%rsi
+  800d87:	4c 89 e7             	mov    %r12,%rdi
+  800d8a:	ff 50 28             	call   *0x28(%rax)
+}
+  800d8d:	48 83 c4 10          	add    $0x10,%rsp
+  800d91:	5b                   	pop    %rbx
+  800d92:	41 5c                	pop    %r12
+  800d94:	5d                   	pop    %rbp
+  800d95:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  800d96:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  800d9b:	eb f0                	jmp    800d8d <fstat+0x70>
+
+0000000000800d9d <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  800d9d:	55                   	push   %rbp
+  800d9e:	48 89 e5             	mov    %rsp,%rbp
+  800da1:	41 54                	push   %r12
+  800da3:	53                   	push   %rbx
+  800da4:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  800da7:	be 00 00 00 00       	mov    $0x0,%esi
+  800dac:	48 b8 80 11 80 00 00 	movabs $0x801180,%rax
+  800db3:	00 00 00 
+  800db6:	ff d0                	call   *%rax
+  800db8:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  800dba:	85 c0                	test   %eax,%eax
+  800dbc:	78 25                	js     800de3 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  800dbe:	4c 89 e6             	mov    %r12,%rsi
+  800dc1:	89 c7                	mov    %eax,%edi
+  800dc3:	48 b8 1d 0d 80 00 00 	movabs $0x800d1d,%rax
+  800dca:	00 00 00 
+  800dcd:	ff d0                	call   *%rax
+  800dcf:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  800dd2:	89 df                	mov    %ebx,%edi
+  800dd4:	48 b8 e2 08 80 00 00 	movabs $0x8008e2,%rax
+  800ddb:	00 00 00 
+  800dde:	ff d0                	call   *%rax
+
+    return res;
+  800de0:	44 89 e3             	mov    %r12d,%ebx
+}
+  800de3:	89 d8                	mov    %ebx,%eax
+  800de5:	5b                   	pop    %rbx
+  800de6:	41 5c                	pop    %r12
+  800de8:	5d                   	pop    %rbp
+  800de9:	c3                   	ret
+
+0000000000800dea <fsipc>:
+ * response may be written back to fsipcbuf.
+ * type: request code, passed as the simple integer IPC value.
+ * dstva: virtual address at which to receive reply page, 0 if none.
+ * Returns result from the file server. */
+static int
+fsipc(unsigned type, void *dstva) {
+  800dea:	55                   	push   %rbp
+  800deb:	48 89 e5             	mov    %rsp,%rbp
+  800dee:	41 54                	push   %r12
+  800df0:	53                   	push   %rbx
+  800df1:	48 83 ec 10          	sub    $0x10,%rsp
+  800df5:	41 89 fc             	mov    %edi,%r12d
+  800df8:	48 89 f3             	mov    %rsi,%rbx
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  800dfb:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  800e02:	00 00 00 
+  800e05:	83 38 00             	cmpl   $0x0,(%rax)
+  800e08:	74 5e                	je     800e68 <fsipc+0x7e>
+    if (debug) {
+        cprintf("[%08x] fsipc %d %08x\n",
+                thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+    }
+
+    ipc_send(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW);
+  800e0a:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  800e10:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  800e15:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  800e1c:	00 00 00 
+  800e1f:	44 89 e6             	mov    %r12d,%esi
+  800e22:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  800e29:	00 00 00 
+  800e2c:	8b 38                	mov    (%rax),%edi
+  800e2e:	48 b8 83 2b 80 00 00 	movabs $0x802b83,%rax
+  800e35:	00 00 00 
+  800e38:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  800e3a:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  800e41:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  800e42:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e47:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  800e4b:	48 89 de             	mov    %rbx,%rsi
+  800e4e:	bf 00 00 00 00       	mov    $0x0,%edi
+  800e53:	48 b8 ae 2a 80 00 00 	movabs $0x802aae,%rax
+  800e5a:	00 00 00 
+  800e5d:	ff d0                	call   *%rax
+}
+  800e5f:	48 83 c4 10          	add    $0x10,%rsp
+  800e63:	5b                   	pop    %rbx
+  800e64:	41 5c                	pop    %r12
+  800e66:	5d                   	pop    %rbp
+  800e67:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  800e68:	bf 03 00 00 00       	mov    $0x3,%edi
+  800e6d:	48 b8 26 2c 80 00 00 	movabs $0x802c26,%rax
+  800e74:	00 00 00 
+  800e77:	ff d0                	call   *%rax
+  800e79:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  800e80:	00 00 
+  800e82:	eb 86                	jmp    800e0a <fsipc+0x20>
+
+0000000000800e84 <devfile_trunc>:
+    return 0;
+}
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  800e84:	55                   	push   %rbp
+  800e85:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  800e88:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  800e8f:	00 00 00 
+  800e92:	8b 57 0c             	mov    0xc(%rdi),%edx
+  800e95:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  800e97:	89 70 04             	mov    %esi,0x4(%rax)
+
+    return fsipc(FSREQ_SET_SIZE, NULL);
+  800e9a:	be 00 00 00 00       	mov    $0x0,%esi
+  800e9f:	bf 02 00 00 00       	mov    $0x2,%edi
+  800ea4:	48 b8 ea 0d 80 00 00 	movabs $0x800dea,%rax
+  800eab:	00 00 00 
+  800eae:	ff d0                	call   *%rax
+}
+  800eb0:	5d                   	pop    %rbp
+  800eb1:	c3                   	ret
+
+0000000000800eb2 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  800eb2:	55                   	push   %rbp
+  800eb3:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  800eb6:	8b 47 0c             	mov    0xc(%rdi),%eax
+  800eb9:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  800ec0:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  800ec2:	be 00 00 00 00       	mov    $0x0,%esi
+  800ec7:	bf 06 00 00 00       	mov    $0x6,%edi
+  800ecc:	48 b8 ea 0d 80 00 00 	movabs $0x800dea,%rax
+  800ed3:	00 00 00 
+  800ed6:	ff d0                	call   *%rax
+}
+  800ed8:	5d                   	pop    %rbp
+  800ed9:	c3                   	ret
+
+0000000000800eda <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  800eda:	55                   	push   %rbp
+  800edb:	48 89 e5             	mov    %rsp,%rbp
+  800ede:	41 54                	push   %r12
+  800ee0:	53                   	push   %rbx
+  800ee1:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  800ee4:	8b 47 0c             	mov    0xc(%rdi),%eax
+  800ee7:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  800eee:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  800ef0:	be 00 00 00 00       	mov    $0x0,%esi
+  800ef5:	bf 05 00 00 00       	mov    $0x5,%edi
+  800efa:	48 b8 ea 0d 80 00 00 	movabs $0x800dea,%rax
+  800f01:	00 00 00 
+  800f04:	ff d0                	call   *%rax
+    if (res < 0) {
+  800f06:	85 c0                	test   %eax,%eax
+  800f08:	78 3d                	js     800f47 <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  800f0a:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  800f11:	00 00 00 
+  800f14:	4c 89 e6             	mov    %r12,%rsi
+  800f17:	48 89 df             	mov    %rbx,%rdi
+  800f1a:	48 b8 87 26 80 00 00 	movabs $0x802687,%rax
+  800f21:	00 00 00 
+  800f24:	ff d0                	call   *%rax
+    st->st_size  = fsipcbuf.statRet.ret_size;
+  800f26:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  800f2d:	00 
+  800f2e:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  800f34:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  800f3b:	00 
+  800f3c:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  800f42:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800f47:	5b                   	pop    %rbx
+  800f48:	41 5c                	pop    %r12
+  800f4a:	5d                   	pop    %rbp
+  800f4b:	c3                   	ret
+
+0000000000800f4c <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  800f4c:	55                   	push   %rbp
+  800f4d:	48 89 e5             	mov    %rsp,%rbp
+  800f50:	41 57                	push   %r15
+  800f52:	41 56                	push   %r14
+  800f54:	41 55                	push   %r13
+  800f56:	41 54                	push   %r12
+  800f58:	53                   	push   %rbx
+  800f59:	48 83 ec 18          	sub    $0x18,%rsp
+  800f5d:	49 89 fe             	mov    %rdi,%r14
+  800f60:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+  800f64:	48 89 d3             	mov    %rdx,%rbx
+    while (n > sizeof(fsipcbuf.write.req_buf))
+  800f67:	48 81 fa f0 0f 00 00 	cmp    $0xff0,%rdx
+  800f6e:	0f 86 e4 00 00 00    	jbe    801058 <devfile_write+0x10c>
+  800f74:	49 89 f4             	mov    %rsi,%r12
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  800f77:	49 bd 00 60 80 00 00 	movabs $0x806000,%r13
+  800f7e:	00 00 00 
+        memcpy(fsipcbuf.write.req_buf, buf, sizeof(fsipcbuf.write.req_buf));
+  800f81:	49 bf e8 28 80 00 00 	movabs $0x8028e8,%r15
+  800f88:	00 00 00 
+  800f8b:	eb 03                	jmp    800f90 <devfile_write+0x44>
+        buf += sizeof(fsipcbuf.write.req_buf);
+  800f8d:	49 89 f4             	mov    %rsi,%r12
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  800f90:	41 8b 46 0c          	mov    0xc(%r14),%eax
+  800f94:	41 89 45 00          	mov    %eax,0x0(%r13)
+        fsipcbuf.write.req_n      = sizeof(fsipcbuf.write.req_buf);
+  800f98:	49 c7 45 08 f0 0f 00 	movq   $0xff0,0x8(%r13)
+  800f9f:	00 
+        memcpy(fsipcbuf.write.req_buf, buf, sizeof(fsipcbuf.write.req_buf));
+  800fa0:	ba f0 0f 00 00       	mov    $0xff0,%edx
+  800fa5:	4c 89 e6             	mov    %r12,%rsi
+  800fa8:	48 bf 10 60 80 00 00 	movabs $0x806010,%rdi
+  800faf:	00 00 00 
+  800fb2:	41 ff d7             	call   *%r15
+        ssize_t res = fsipc(FSREQ_WRITE, NULL);
+  800fb5:	be 00 00 00 00       	mov    $0x0,%esi
+  800fba:	bf 04 00 00 00       	mov    $0x4,%edi
+  800fbf:	48 b8 ea 0d 80 00 00 	movabs $0x800dea,%rax
+  800fc6:	00 00 00 
+  800fc9:	ff d0                	call   *%rax
+  800fcb:	48 63 d0             	movslq %eax,%rdx
+        if (res < 0 || res < sizeof(fsipcbuf.write.req_buf))
+  800fce:	3d ef 0f 00 00       	cmp    $0xfef,%eax
+  800fd3:	7e 71                	jle    801046 <devfile_write+0xfa>
+        buf += sizeof(fsipcbuf.write.req_buf);
+  800fd5:	49 8d b4 24 f0 0f 00 	lea    0xff0(%r12),%rsi
+  800fdc:	00 
+        n -= sizeof(fsipcbuf.write.req_buf);
+  800fdd:	48 81 eb f0 0f 00 00 	sub    $0xff0,%rbx
+    while (n > sizeof(fsipcbuf.write.req_buf))
+  800fe4:	48 81 fb f0 0f 00 00 	cmp    $0xff0,%rbx
+  800feb:	77 a0                	ja     800f8d <devfile_write+0x41>
+        written += sizeof(fsipcbuf.write.req_buf);
+  800fed:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800ff1:	49 29 c4             	sub    %rax,%r12
+  800ff4:	4d 8d a4 24 f0 0f 00 	lea    0xff0(%r12),%r12
+  800ffb:	00 
+    fsipcbuf.write.req_fileid = fd->fd_file.id;
+  800ffc:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  801003:	00 00 00 
+  801006:	41 8b 56 0c          	mov    0xc(%r14),%edx
+  80100a:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.write.req_n      = n;
+  80100c:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    memcpy(fsipcbuf.write.req_buf, buf, n);
+  801010:	48 89 da             	mov    %rbx,%rdx
+  801013:	48 8d 78 10          	lea    0x10(%rax),%rdi
+  801017:	48 b8 e8 28 80 00 00 	movabs $0x8028e8,%rax
+  80101e:	00 00 00 
+  801021:	ff d0                	call   *%rax
+    ssize_t res = fsipc(FSREQ_WRITE, NULL);
+  801023:	be 00 00 00 00       	mov    $0x0,%esi
+  801028:	bf 04 00 00 00       	mov    $0x4,%edi
+  80102d:	48 b8 ea 0d 80 00 00 	movabs $0x800dea,%rax
+  801034:	00 00 00 
+  801037:	ff d0                	call   *%rax
+  801039:	48 63 d0             	movslq %eax,%rdx
+    written += res;
+  80103c:	49 01 d4             	add    %rdx,%r12
+  80103f:	48 85 d2             	test   %rdx,%rdx
+  801042:	49 0f 49 d4          	cmovns %r12,%rdx
+}
+  801046:	48 89 d0             	mov    %rdx,%rax
+  801049:	48 83 c4 18          	add    $0x18,%rsp
+  80104d:	5b                   	pop    %rbx
+  80104e:	41 5c                	pop    %r12
+  801050:	41 5d                	pop    %r13
+  801052:	41 5e                	pop    %r14
+  801054:	41 5f                	pop    %r15
+  801056:	5d                   	pop    %rbp
+  801057:	c3                   	ret
+    while (n > sizeof(fsipcbuf.write.req_buf))
+  801058:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+    ssize_t written = 0;
+  80105c:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  801062:	eb 98                	jmp    800ffc <devfile_write+0xb0>
+
+0000000000801064 <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  801064:	55                   	push   %rbp
+  801065:	48 89 e5             	mov    %rsp,%rbp
+  801068:	41 57                	push   %r15
+  80106a:	41 56                	push   %r14
+  80106c:	41 55                	push   %r13
+  80106e:	41 54                	push   %r12
+  801070:	53                   	push   %rbx
+  801071:	48 83 ec 18          	sub    $0x18,%rsp
+  801075:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  801079:	49 89 f6             	mov    %rsi,%r14
+  80107c:	49 89 d4             	mov    %rdx,%r12
+    while (n > sizeof(fsipcbuf.readRet.ret_buf))
+  80107f:	48 81 fa 00 10 00 00 	cmp    $0x1000,%rdx
+  801086:	0f 86 ea 00 00 00    	jbe    801176 <devfile_read+0x112>
+    ssize_t readsz = 0;
+  80108c:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  801093:	00 
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801094:	49 bf 00 60 80 00 00 	movabs $0x806000,%r15
+  80109b:	00 00 00 
+  80109e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8010a2:	8b 40 0c             	mov    0xc(%rax),%eax
+  8010a5:	41 89 07             	mov    %eax,(%r15)
+        fsipcbuf.read.req_n = sizeof(fsipcbuf.readRet.ret_buf);
+  8010a8:	49 c7 47 08 00 10 00 	movq   $0x1000,0x8(%r15)
+  8010af:	00 
+        ssize_t res = fsipc(FSREQ_READ, NULL);
+  8010b0:	be 00 00 00 00       	mov    $0x0,%esi
+  8010b5:	bf 03 00 00 00       	mov    $0x3,%edi
+  8010ba:	48 b8 ea 0d 80 00 00 	movabs $0x800dea,%rax
+  8010c1:	00 00 00 
+  8010c4:	ff d0                	call   *%rax
+  8010c6:	4c 63 e8             	movslq %eax,%r13
+        if (res < 0)
+  8010c9:	4d 85 ed             	test   %r13,%r13
+  8010cc:	0f 88 92 00 00 00    	js     801164 <devfile_read+0x100>
+        memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  8010d2:	4c 89 ea             	mov    %r13,%rdx
+  8010d5:	4c 89 fe             	mov    %r15,%rsi
+  8010d8:	4c 89 f7             	mov    %r14,%rdi
+  8010db:	48 b8 e8 28 80 00 00 	movabs $0x8028e8,%rax
+  8010e2:	00 00 00 
+  8010e5:	ff d0                	call   *%rax
+        if (res < sizeof(fsipcbuf.readRet.ret_buf))
+  8010e7:	49 81 fd ff 0f 00 00 	cmp    $0xfff,%r13
+  8010ee:	76 6d                	jbe    80115d <devfile_read+0xf9>
+        readsz += res;
+  8010f0:	4c 01 6d c0          	add    %r13,-0x40(%rbp)
+        buf += res;
+  8010f4:	4d 01 ee             	add    %r13,%r14
+        n -= res;
+  8010f7:	4d 29 ec             	sub    %r13,%r12
+    while (n > sizeof(fsipcbuf.readRet.ret_buf))
+  8010fa:	49 81 fc 00 10 00 00 	cmp    $0x1000,%r12
+  801101:	77 9b                	ja     80109e <devfile_read+0x3a>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801103:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  80110a:	00 00 00 
+  80110d:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  801111:	8b 51 0c             	mov    0xc(%rcx),%edx
+  801114:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.read.req_n = n;
+  801116:	4c 89 60 08          	mov    %r12,0x8(%rax)
+    ssize_t res = fsipc(FSREQ_READ, NULL);
+  80111a:	be 00 00 00 00       	mov    $0x0,%esi
+  80111f:	bf 03 00 00 00       	mov    $0x3,%edi
+  801124:	48 b8 ea 0d 80 00 00 	movabs $0x800dea,%rax
+  80112b:	00 00 00 
+  80112e:	ff d0                	call   *%rax
+  801130:	4c 63 e8             	movslq %eax,%r13
+    if (res < 0)
+  801133:	4d 85 ed             	test   %r13,%r13
+  801136:	78 2c                	js     801164 <devfile_read+0x100>
+    memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  801138:	4c 89 ea             	mov    %r13,%rdx
+  80113b:	48 be 00 60 80 00 00 	movabs $0x806000,%rsi
+  801142:	00 00 00 
+  801145:	4c 89 f7             	mov    %r14,%rdi
+  801148:	48 b8 e8 28 80 00 00 	movabs $0x8028e8,%rax
+  80114f:	00 00 00 
+  801152:	ff d0                	call   *%rax
+    readsz += res;
+  801154:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  801158:	49 01 c5             	add    %rax,%r13
+    return readsz;
+  80115b:	eb 07                	jmp    801164 <devfile_read+0x100>
+            return readsz + res;
+  80115d:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  801161:	49 01 c5             	add    %rax,%r13
+}
+  801164:	4c 89 e8             	mov    %r13,%rax
+  801167:	48 83 c4 18          	add    $0x18,%rsp
+  80116b:	5b                   	pop    %rbx
+  80116c:	41 5c                	pop    %r12
+  80116e:	41 5d                	pop    %r13
+  801170:	41 5e                	pop    %r14
+  801172:	41 5f                	pop    %r15
+  801174:	5d                   	pop    %rbp
+  801175:	c3                   	ret
+    ssize_t readsz = 0;
+  801176:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  80117d:	00 
+  80117e:	eb 83                	jmp    801103 <devfile_read+0x9f>
+
+0000000000801180 <open>:
+open(const char *path, int mode) {
+  801180:	55                   	push   %rbp
+  801181:	48 89 e5             	mov    %rsp,%rbp
+  801184:	41 55                	push   %r13
+  801186:	41 54                	push   %r12
+  801188:	53                   	push   %rbx
+  801189:	48 83 ec 18          	sub    $0x18,%rsp
+  80118d:	49 89 fc             	mov    %rdi,%r12
+  801190:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  801193:	48 b8 49 26 80 00 00 	movabs $0x802649,%rax
+  80119a:	00 00 00 
+  80119d:	ff d0                	call   *%rax
+  80119f:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  8011a5:	0f 87 8a 00 00 00    	ja     801235 <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8011ab:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  8011af:	48 b8 63 07 80 00 00 	movabs $0x800763,%rax
+  8011b6:	00 00 00 
+  8011b9:	ff d0                	call   *%rax
+  8011bb:	89 c3                	mov    %eax,%ebx
+  8011bd:	85 c0                	test   %eax,%eax
+  8011bf:	78 50                	js     801211 <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  8011c1:	4c 89 e6             	mov    %r12,%rsi
+  8011c4:	48 bb 00 60 80 00 00 	movabs $0x806000,%rbx
+  8011cb:	00 00 00 
+  8011ce:	48 89 df             	mov    %rbx,%rdi
+  8011d1:	48 b8 87 26 80 00 00 	movabs $0x802687,%rax
+  8011d8:	00 00 00 
+  8011db:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  8011dd:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  8011e4:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8011e8:	bf 01 00 00 00       	mov    $0x1,%edi
+  8011ed:	48 b8 ea 0d 80 00 00 	movabs $0x800dea,%rax
+  8011f4:	00 00 00 
+  8011f7:	ff d0                	call   *%rax
+  8011f9:	89 c3                	mov    %eax,%ebx
+  8011fb:	85 c0                	test   %eax,%eax
+  8011fd:	78 1f                	js     80121e <open+0x9e>
+    return fd2num(fd);
+  8011ff:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  801203:	48 b8 bc 06 80 00 00 	movabs $0x8006bc,%rax
+  80120a:	00 00 00 
+  80120d:	ff d0                	call   *%rax
+  80120f:	89 c3                	mov    %eax,%ebx
+}
+  801211:	89 d8                	mov    %ebx,%eax
+  801213:	48 83 c4 18          	add    $0x18,%rsp
+  801217:	5b                   	pop    %rbx
+  801218:	41 5c                	pop    %r12
+  80121a:	41 5d                	pop    %r13
+  80121c:	5d                   	pop    %rbp
+  80121d:	c3                   	ret
+        fd_close(fd, 0);
+  80121e:	be 00 00 00 00       	mov    $0x0,%esi
+  801223:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  801227:	48 b8 38 08 80 00 00 	movabs $0x800838,%rax
+  80122e:	00 00 00 
+  801231:	ff d0                	call   *%rax
+        return res;
+  801233:	eb dc                	jmp    801211 <open+0x91>
+        return -E_BAD_PATH;
+  801235:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  80123a:	eb d5                	jmp    801211 <open+0x91>
+
+000000000080123c <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  80123c:	55                   	push   %rbp
+  80123d:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc(FSREQ_SYNC, NULL);
+  801240:	be 00 00 00 00       	mov    $0x0,%esi
+  801245:	bf 08 00 00 00       	mov    $0x8,%edi
+  80124a:	48 b8 ea 0d 80 00 00 	movabs $0x800dea,%rax
+  801251:	00 00 00 
+  801254:	ff d0                	call   *%rax
+}
+  801256:	5d                   	pop    %rbp
+  801257:	c3                   	ret
+
+0000000000801258 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  801258:	55                   	push   %rbp
+  801259:	48 89 e5             	mov    %rsp,%rbp
+  80125c:	41 54                	push   %r12
+  80125e:	53                   	push   %rbx
+  80125f:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  801262:	48 b8 ce 06 80 00 00 	movabs $0x8006ce,%rax
+  801269:	00 00 00 
+  80126c:	ff d0                	call   *%rax
+  80126e:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  801271:	48 be 60 2d 80 00 00 	movabs $0x802d60,%rsi
+  801278:	00 00 00 
+  80127b:	48 89 df             	mov    %rbx,%rdi
+  80127e:	48 b8 87 26 80 00 00 	movabs $0x802687,%rax
+  801285:	00 00 00 
+  801288:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  80128a:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  80128f:	41 2b 04 24          	sub    (%r12),%eax
+  801293:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  801299:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8012a0:	00 00 00 
+    stat->st_dev = &devpipe;
+  8012a3:	48 b8 60 40 80 00 00 	movabs $0x804060,%rax
+  8012aa:	00 00 00 
+  8012ad:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  8012b4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012b9:	5b                   	pop    %rbx
+  8012ba:	41 5c                	pop    %r12
+  8012bc:	5d                   	pop    %rbp
+  8012bd:	c3                   	ret
+
+00000000008012be <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  8012be:	55                   	push   %rbp
+  8012bf:	48 89 e5             	mov    %rsp,%rbp
+  8012c2:	41 54                	push   %r12
+  8012c4:	53                   	push   %rbx
+  8012c5:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8012c8:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8012cd:	48 89 fe             	mov    %rdi,%rsi
+  8012d0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8012d5:	49 bc 4d 03 80 00 00 	movabs $0x80034d,%r12
+  8012dc:	00 00 00 
+  8012df:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  8012e2:	48 89 df             	mov    %rbx,%rdi
+  8012e5:	48 b8 ce 06 80 00 00 	movabs $0x8006ce,%rax
+  8012ec:	00 00 00 
+  8012ef:	ff d0                	call   *%rax
+  8012f1:	48 89 c6             	mov    %rax,%rsi
+  8012f4:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8012f9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8012fe:	41 ff d4             	call   *%r12
+}
+  801301:	5b                   	pop    %rbx
+  801302:	41 5c                	pop    %r12
+  801304:	5d                   	pop    %rbp
+  801305:	c3                   	ret
+
+0000000000801306 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  801306:	55                   	push   %rbp
+  801307:	48 89 e5             	mov    %rsp,%rbp
+  80130a:	41 57                	push   %r15
+  80130c:	41 56                	push   %r14
+  80130e:	41 55                	push   %r13
+  801310:	41 54                	push   %r12
+  801312:	53                   	push   %rbx
+  801313:	48 83 ec 18          	sub    $0x18,%rsp
+  801317:	49 89 fc             	mov    %rdi,%r12
+  80131a:	49 89 f5             	mov    %rsi,%r13
+  80131d:	49 89 d7             	mov    %rdx,%r15
+  801320:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  801324:	48 b8 ce 06 80 00 00 	movabs $0x8006ce,%rax
+  80132b:	00 00 00 
+  80132e:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  801330:	4d 85 ff             	test   %r15,%r15
+  801333:	0f 84 af 00 00 00    	je     8013e8 <devpipe_write+0xe2>
+  801339:	48 89 c3             	mov    %rax,%rbx
+  80133c:	4c 89 f8             	mov    %r15,%rax
+  80133f:	4d 89 ef             	mov    %r13,%r15
+  801342:	4c 01 e8             	add    %r13,%rax
+  801345:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  801349:	49 bd 55 02 80 00 00 	movabs $0x800255,%r13
+  801350:	00 00 00 
+            sys_yield();
+  801353:	49 be f2 01 80 00 00 	movabs $0x8001f2,%r14
+  80135a:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  80135d:	8b 73 04             	mov    0x4(%rbx),%esi
+  801360:	48 63 ce             	movslq %esi,%rcx
+  801363:	48 63 03             	movslq (%rbx),%rax
+  801366:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  80136c:	48 39 c1             	cmp    %rax,%rcx
+  80136f:	72 2e                	jb     80139f <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  801371:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  801376:	48 89 da             	mov    %rbx,%rdx
+  801379:	be 00 10 00 00       	mov    $0x1000,%esi
+  80137e:	4c 89 e7             	mov    %r12,%rdi
+  801381:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  801384:	85 c0                	test   %eax,%eax
+  801386:	74 66                	je     8013ee <devpipe_write+0xe8>
+            sys_yield();
+  801388:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  80138b:	8b 73 04             	mov    0x4(%rbx),%esi
+  80138e:	48 63 ce             	movslq %esi,%rcx
+  801391:	48 63 03             	movslq (%rbx),%rax
+  801394:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  80139a:	48 39 c1             	cmp    %rax,%rcx
+  80139d:	73 d2                	jae    801371 <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  80139f:	41 0f b6 3f          	movzbl (%r15),%edi
+  8013a3:	48 89 ca             	mov    %rcx,%rdx
+  8013a6:	48 c1 ea 03          	shr    $0x3,%rdx
+  8013aa:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  8013b1:	08 10 20 
+  8013b4:	48 f7 e2             	mul    %rdx
+  8013b7:	48 c1 ea 06          	shr    $0x6,%rdx
+  8013bb:	48 89 d0             	mov    %rdx,%rax
+  8013be:	48 c1 e0 09          	shl    $0x9,%rax
+  8013c2:	48 29 d0             	sub    %rdx,%rax
+  8013c5:	48 c1 e0 03          	shl    $0x3,%rax
+  8013c9:	48 29 c1             	sub    %rax,%rcx
+  8013cc:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  8013d1:	83 c6 01             	add    $0x1,%esi
+  8013d4:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8013d7:	49 83 c7 01          	add    $0x1,%r15
+  8013db:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8013df:	49 39 c7             	cmp    %rax,%r15
+  8013e2:	0f 85 75 ff ff ff    	jne    80135d <devpipe_write+0x57>
+    return n;
+  8013e8:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8013ec:	eb 05                	jmp    8013f3 <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  8013ee:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8013f3:	48 83 c4 18          	add    $0x18,%rsp
+  8013f7:	5b                   	pop    %rbx
+  8013f8:	41 5c                	pop    %r12
+  8013fa:	41 5d                	pop    %r13
+  8013fc:	41 5e                	pop    %r14
+  8013fe:	41 5f                	pop    %r15
+  801400:	5d                   	pop    %rbp
+  801401:	c3                   	ret
+
+0000000000801402 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  801402:	55                   	push   %rbp
+  801403:	48 89 e5             	mov    %rsp,%rbp
+  801406:	41 57                	push   %r15
+  801408:	41 56                	push   %r14
+  80140a:	41 55                	push   %r13
+  80140c:	41 54                	push   %r12
+  80140e:	53                   	push   %rbx
+  80140f:	48 83 ec 18          	sub    $0x18,%rsp
+  801413:	49 89 fc             	mov    %rdi,%r12
+  801416:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  80141a:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80141e:	48 b8 ce 06 80 00 00 	movabs $0x8006ce,%rax
+  801425:	00 00 00 
+  801428:	ff d0                	call   *%rax
+  80142a:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  80142d:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  801433:	49 bd 55 02 80 00 00 	movabs $0x800255,%r13
+  80143a:	00 00 00 
+            sys_yield();
+  80143d:	49 be f2 01 80 00 00 	movabs $0x8001f2,%r14
+  801444:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  801447:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  80144c:	74 7d                	je     8014cb <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  80144e:	8b 03                	mov    (%rbx),%eax
+  801450:	3b 43 04             	cmp    0x4(%rbx),%eax
+  801453:	75 26                	jne    80147b <devpipe_read+0x79>
+            if (i > 0) return i;
+  801455:	4d 85 ff             	test   %r15,%r15
+  801458:	75 77                	jne    8014d1 <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80145a:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80145f:	48 89 da             	mov    %rbx,%rdx
+  801462:	be 00 10 00 00       	mov    $0x1000,%esi
+  801467:	4c 89 e7             	mov    %r12,%rdi
+  80146a:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  80146d:	85 c0                	test   %eax,%eax
+  80146f:	74 72                	je     8014e3 <devpipe_read+0xe1>
+            sys_yield();
+  801471:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  801474:	8b 03                	mov    (%rbx),%eax
+  801476:	3b 43 04             	cmp    0x4(%rbx),%eax
+  801479:	74 df                	je     80145a <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  80147b:	48 63 c8             	movslq %eax,%rcx
+  80147e:	48 89 ca             	mov    %rcx,%rdx
+  801481:	48 c1 ea 03          	shr    $0x3,%rdx
+  801485:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  80148c:	08 10 20 
+  80148f:	48 89 d0             	mov    %rdx,%rax
+  801492:	48 f7 e6             	mul    %rsi
+  801495:	48 c1 ea 06          	shr    $0x6,%rdx
+  801499:	48 89 d0             	mov    %rdx,%rax
+  80149c:	48 c1 e0 09          	shl    $0x9,%rax
+  8014a0:	48 29 d0             	sub    %rdx,%rax
+  8014a3:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  8014aa:	00 
+  8014ab:	48 89 c8             	mov    %rcx,%rax
+  8014ae:	48 29 d0             	sub    %rdx,%rax
+  8014b1:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  8014b6:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8014ba:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  8014be:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8014c1:	49 83 c7 01          	add    $0x1,%r15
+  8014c5:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  8014c9:	75 83                	jne    80144e <devpipe_read+0x4c>
+    return n;
+  8014cb:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8014cf:	eb 03                	jmp    8014d4 <devpipe_read+0xd2>
+            if (i > 0) return i;
+  8014d1:	4c 89 f8             	mov    %r15,%rax
+}
+  8014d4:	48 83 c4 18          	add    $0x18,%rsp
+  8014d8:	5b                   	pop    %rbx
+  8014d9:	41 5c                	pop    %r12
+  8014db:	41 5d                	pop    %r13
+  8014dd:	41 5e                	pop    %r14
+  8014df:	41 5f                	pop    %r15
+  8014e1:	5d                   	pop    %rbp
+  8014e2:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  8014e3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014e8:	eb ea                	jmp    8014d4 <devpipe_read+0xd2>
+
+00000000008014ea <pipe>:
+pipe(int pfd[2]) {
+  8014ea:	55                   	push   %rbp
+  8014eb:	48 89 e5             	mov    %rsp,%rbp
+  8014ee:	41 55                	push   %r13
+  8014f0:	41 54                	push   %r12
+  8014f2:	53                   	push   %rbx
+  8014f3:	48 81 ec b8 00 00 00 	sub    $0xb8,%rsp
+  8014fa:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8014fd:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  801501:	48 b8 63 07 80 00 00 	movabs $0x800763,%rax
+  801508:	00 00 00 
+  80150b:	ff d0                	call   *%rax
+  80150d:	89 c3                	mov    %eax,%ebx
+  80150f:	85 c0                	test   %eax,%eax
+  801511:	0f 88 51 01 00 00    	js     801668 <pipe+0x17e>
+        (res = fd_alloc_from(fd2num(fd0) + 1, &fd1)) < 0) goto err;
+  801517:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80151b:	48 b8 bc 06 80 00 00 	movabs $0x8006bc,%rax
+  801522:	00 00 00 
+  801525:	ff d0                	call   *%rax
+  801527:	8d 78 01             	lea    0x1(%rax),%edi
+  80152a:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80152e:	48 b8 ea 06 80 00 00 	movabs $0x8006ea,%rax
+  801535:	00 00 00 
+  801538:	ff d0                	call   *%rax
+  80153a:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  80153c:	85 c0                	test   %eax,%eax
+  80153e:	0f 88 24 01 00 00    	js     801668 <pipe+0x17e>
+    va = fd2data(fd0);
+  801544:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  801548:	48 bb ce 06 80 00 00 	movabs $0x8006ce,%rbx
+  80154f:	00 00 00 
+  801552:	ff d3                	call   *%rbx
+  801554:	49 89 c5             	mov    %rax,%r13
+    struct RegionOp ops[] = {
+  801557:	48 8d bd 30 ff ff ff 	lea    -0xd0(%rbp),%rdi
+  80155e:	b9 14 00 00 00       	mov    $0x14,%ecx
+  801563:	b8 00 00 00 00       	mov    $0x0,%eax
+  801568:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+  80156b:	c7 85 34 ff ff ff 46 	movl   $0x46,-0xcc(%rbp)
+  801572:	00 00 00 
+  801575:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801579:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+  801580:	48 c7 85 50 ff ff ff 	movq   $0x1000,-0xb0(%rbp)
+  801587:	00 10 00 00 
+  80158b:	c7 85 5c ff ff ff 46 	movl   $0x46,-0xa4(%rbp)
+  801592:	00 00 00 
+            {.type = REGION_ALLOC, .dstva = (uintptr_t)fd1, .size = PAGE_SIZE, .perm = PROT_RW | PROT_SHARE},
+  801595:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+    struct RegionOp ops[] = {
+  801599:	48 89 bd 70 ff ff ff 	mov    %rdi,-0x90(%rbp)
+  8015a0:	48 c7 85 78 ff ff ff 	movq   $0x1000,-0x88(%rbp)
+  8015a7:	00 10 00 00 
+  8015ab:	c7 45 84 46 00 00 00 	movl   $0x46,-0x7c(%rbp)
+  8015b2:	4c 89 6d 98          	mov    %r13,-0x68(%rbp)
+  8015b6:	48 c7 45 a0 00 10 00 	movq   $0x1000,-0x60(%rbp)
+  8015bd:	00 
+  8015be:	c7 45 a8 01 00 00 00 	movl   $0x1,-0x58(%rbp)
+  8015c5:	c7 45 ac 46 00 00 00 	movl   $0x46,-0x54(%rbp)
+  8015cc:	4c 89 6d b8          	mov    %r13,-0x48(%rbp)
+            {.type = REGION_MAP, .srcva = (uintptr_t)va, .dstva = (uintptr_t)fd2data(fd1), .size = PAGE_SIZE, .perm = PROT_RW | PROT_SHARE},
+  8015d0:	ff d3                	call   *%rbx
+    struct RegionOp ops[] = {
+  8015d2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8015d6:	48 c7 45 c8 00 10 00 	movq   $0x1000,-0x38(%rbp)
+  8015dd:	00 
+    if ((res = sys_region_batch(ops, sizeof ops / sizeof *ops)) < 0) goto err1;
+  8015de:	be 04 00 00 00       	mov    $0x4,%esi
+  8015e3:	48 8d bd 30 ff ff ff 	lea    -0xd0(%rbp),%rdi
+  8015ea:	48 b8 b4 03 80 00 00 	movabs $0x8003b4,%rax
+  8015f1:	00 00 00 
+  8015f4:	ff d0                	call   *%rax
+  8015f6:	89 c3                	mov    %eax,%ebx
+  8015f8:	85 c0                	test   %eax,%eax
+  8015fa:	0f 88 ad 00 00 00    	js     8016ad <pipe+0x1c3>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  801600:	be 00 10 00 00       	mov    $0x1000,%esi
+  801605:	4c 89 ef             	mov    %r13,%rdi
+  801608:	48 b8 23 02 80 00 00 	movabs $0x800223,%rax
+  80160f:	00 00 00 
+  801612:	ff d0                	call   *%rax
+  801614:	83 f8 02             	cmp    $0x2,%eax
+  801617:	75 5f                	jne    801678 <pipe+0x18e>
+    fd0->fd_dev_id = devpipe.dev_id;
+  801619:	a1 60 40 80 00 00 00 	movabs 0x804060,%eax
+  801620:	00 00 
+  801622:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801626:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  801628:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80162c:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  801633:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  801637:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  801639:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80163d:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  801644:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  801648:	48 bb bc 06 80 00 00 	movabs $0x8006bc,%rbx
+  80164f:	00 00 00 
+  801652:	ff d3                	call   *%rbx
+  801654:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  801658:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  80165c:	ff d3                	call   *%rbx
+  80165e:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  801663:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  801668:	89 d8                	mov    %ebx,%eax
+  80166a:	48 81 c4 b8 00 00 00 	add    $0xb8,%rsp
+  801671:	5b                   	pop    %rbx
+  801672:	41 5c                	pop    %r12
+  801674:	41 5d                	pop    %r13
+  801676:	5d                   	pop    %rbp
+  801677:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  801678:	48 b9 90 2d 80 00 00 	movabs $0x802d90,%rcx
+  80167f:	00 00 00 
+  801682:	48 ba 67 2d 80 00 00 	movabs $0x802d67,%rdx
+  801689:	00 00 00 
+  80168c:	be 33 00 00 00       	mov    $0x33,%esi
+  801691:	48 bf 7c 2d 80 00 00 	movabs $0x802d7c,%rdi
+  801698:	00 00 00 
+  80169b:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016a0:	49 b8 12 1c 80 00 00 	movabs $0x801c12,%r8
+  8016a7:	00 00 00 
+  8016aa:	41 ff d0             	call   *%r8
+        ops[i].type = REGION_UNMAP;
+  8016ad:	c7 85 30 ff ff ff 02 	movl   $0x2,-0xd0(%rbp)
+  8016b4:	00 00 00 
+  8016b7:	c7 85 58 ff ff ff 02 	movl   $0x2,-0xa8(%rbp)
+  8016be:	00 00 00 
+  8016c1:	c7 45 80 02 00 00 00 	movl   $0x2,-0x80(%rbp)
+  8016c8:	c7 45 a8 02 00 00 00 	movl   $0x2,-0x58(%rbp)
+    sys_region_batch(ops, sizeof ops / sizeof *ops);
+  8016cf:	be 04 00 00 00       	mov    $0x4,%esi
+  8016d4:	48 8d bd 30 ff ff ff 	lea    -0xd0(%rbp),%rdi
+  8016db:	48 b8 b4 03 80 00 00 	movabs $0x8003b4,%rax
+  8016e2:	00 00 00 
+  8016e5:	ff d0                	call   *%rax
+  8016e7:	e9 7c ff ff ff       	jmp    801668 <pipe+0x17e>
+
+00000000008016ec <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  8016ec:	55                   	push   %rbp
+  8016ed:	48 89 e5             	mov    %rsp,%rbp
+  8016f0:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8016f4:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8016f8:	48 b8 7d 07 80 00 00 	movabs $0x80077d,%rax
+  8016ff:	00 00 00 
+  801702:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801704:	85 c0                	test   %eax,%eax
+  801706:	78 35                	js     80173d <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  801708:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80170c:	48 b8 ce 06 80 00 00 	movabs $0x8006ce,%rax
+  801713:	00 00 00 
+  801716:	ff d0                	call   *%rax
+  801718:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80171b:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  801720:	be 00 10 00 00       	mov    $0x1000,%esi
+  801725:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801729:	48 b8 55 02 80 00 00 	movabs $0x800255,%rax
+  801730:	00 00 00 
+  801733:	ff d0                	call   *%rax
+  801735:	85 c0                	test   %eax,%eax
+  801737:	0f 94 c0             	sete   %al
+  80173a:	0f b6 c0             	movzbl %al,%eax
+}
+  80173d:	c9                   	leave
+  80173e:	c3                   	ret
+
+000000000080173f <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  80173f:	48 89 f8             	mov    %rdi,%rax
+  801742:	48 c1 e8 27          	shr    $0x27,%rax
+  801746:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  80174d:	01 00 00 
+  801750:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  801754:	f6 c2 01             	test   $0x1,%dl
+  801757:	74 6d                	je     8017c6 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  801759:	48 89 f8             	mov    %rdi,%rax
+  80175c:	48 c1 e8 1e          	shr    $0x1e,%rax
+  801760:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  801767:	01 00 00 
+  80176a:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80176e:	f6 c2 01             	test   $0x1,%dl
+  801771:	74 62                	je     8017d5 <get_uvpt_entry+0x96>
+  801773:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  80177a:	01 00 00 
+  80177d:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  801781:	f6 c2 80             	test   $0x80,%dl
+  801784:	75 4f                	jne    8017d5 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  801786:	48 89 f8             	mov    %rdi,%rax
+  801789:	48 c1 e8 15          	shr    $0x15,%rax
+  80178d:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  801794:	01 00 00 
+  801797:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80179b:	f6 c2 01             	test   $0x1,%dl
+  80179e:	74 44                	je     8017e4 <get_uvpt_entry+0xa5>
+  8017a0:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8017a7:	01 00 00 
+  8017aa:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8017ae:	f6 c2 80             	test   $0x80,%dl
+  8017b1:	75 31                	jne    8017e4 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  8017b3:	48 c1 ef 0c          	shr    $0xc,%rdi
+  8017b7:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8017be:	01 00 00 
+  8017c1:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  8017c5:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8017c6:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  8017cd:	01 00 00 
+  8017d0:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8017d4:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8017d5:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8017dc:	01 00 00 
+  8017df:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8017e3:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8017e4:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8017eb:	01 00 00 
+  8017ee:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8017f2:	c3                   	ret
+
+00000000008017f3 <get_prot>:
+
+int
+get_prot(void *va) {
+  8017f3:	55                   	push   %rbp
+  8017f4:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8017f7:	48 b8 3f 17 80 00 00 	movabs $0x80173f,%rax
+  8017fe:	00 00 00 
+  801801:	ff d0                	call   *%rax
+  801803:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  801806:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  80180b:	89 c1                	mov    %eax,%ecx
+  80180d:	83 c9 04             	or     $0x4,%ecx
+  801810:	f6 c2 01             	test   $0x1,%dl
+  801813:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  801816:	89 c1                	mov    %eax,%ecx
+  801818:	83 c9 02             	or     $0x2,%ecx
+  80181b:	f6 c2 02             	test   $0x2,%dl
+  80181e:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  801821:	89 c1                	mov    %eax,%ecx
+  801823:	83 c9 01             	or     $0x1,%ecx
+  801826:	48 85 d2             	test   %rdx,%rdx
+  801829:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  80182c:	89 c1                	mov    %eax,%ecx
+  80182e:	83 c9 40             	or     $0x40,%ecx
+  801831:	f6 c6 04             	test   $0x4,%dh
+  801834:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  801837:	5d                   	pop    %rbp
+  801838:	c3                   	ret
+
+0000000000801839 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  801839:	55                   	push   %rbp
+  80183a:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  80183d:	48 b8 3f 17 80 00 00 	movabs $0x80173f,%rax
+  801844:	00 00 00 
+  801847:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  801849:	48 c1 e8 06          	shr    $0x6,%rax
+  80184d:	83 e0 01             	and    $0x1,%eax
+}
+  801850:	5d                   	pop    %rbp
+  801851:	c3                   	ret
+
+0000000000801852 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  801852:	55                   	push   %rbp
+  801853:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  801856:	48 b8 3f 17 80 00 00 	movabs $0x80173f,%rax
+  80185d:	00 00 00 
+  801860:	ff d0                	call   *%rax
+  801862:	83 e0 01             	and    $0x1,%eax
+}
+  801865:	5d                   	pop    %rbp
+  801866:	c3                   	ret
+
+0000000000801867 <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  801867:	55                   	push   %rbp
+  801868:	48 89 e5             	mov    %rsp,%rbp
+  80186b:	41 57                	push   %r15
+  80186d:	41 56                	push   %r14
+  80186f:	41 55                	push   %r13
+  801871:	41 54                	push   %r12
+  801873:	53                   	push   %rbx
+  801874:	48 83 ec 38          	sub    $0x38,%rsp
+  801878:	49 89 f7             	mov    %rsi,%r15
+  80187b:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+                    }
+                    continue;
+                }
+                for (int ptei = 0; ptei < PT_ENTRY_COUNT; ptei++) {
+                    uintptr_t pte_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, pdei, ptei, 0);
+                    pte_t pte = uvpt[VPT(pte_addr)];
+  801881:	49 bd 00 00 00 00 00 	movabs $0x10000000000,%r13
+  801888:	01 00 00 
+  80188b:	4d 89 e6             	mov    %r12,%r14
+  80188e:	49 89 fc             	mov    %rdi,%r12
+  801891:	e9 19 01 00 00       	jmp    8019af <foreach_shared_region+0x148>
+  801896:	48 89 5d b0          	mov    %rbx,-0x50(%rbp)
+  80189a:	4c 89 75 a8          	mov    %r14,-0x58(%rbp)
+  80189e:	eb 52                	jmp    8018f2 <foreach_shared_region+0x8b>
+                for (int ptei = 0; ptei < PT_ENTRY_COUNT; ptei++) {
+  8018a0:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8018a7:	48 81 fb 00 00 20 00 	cmp    $0x200000,%rbx
+  8018ae:	74 2e                	je     8018de <foreach_shared_region+0x77>
+                    uintptr_t pte_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, pdei, ptei, 0);
+  8018b0:	48 89 df             	mov    %rbx,%rdi
+  8018b3:	4c 09 f7             	or     %r14,%rdi
+                    pte_t pte = uvpt[VPT(pte_addr)];
+  8018b6:	48 89 f8             	mov    %rdi,%rax
+  8018b9:	48 c1 e8 0c          	shr    $0xc,%rax
+  8018bd:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+                    if ((pte & PTE_P) && (pte & PTE_SHARE)) {
+  8018c2:	25 01 04 00 00       	and    $0x401,%eax
+  8018c7:	48 3d 01 04 00 00    	cmp    $0x401,%rax
+  8018cd:	75 d1                	jne    8018a0 <foreach_shared_region+0x39>
+                        fun((void*)pte_addr, (void*)(pte_addr + PAGE_SIZE), arg);
+  8018cf:	48 8d b7 00 10 00 00 	lea    0x1000(%rdi),%rsi
+  8018d6:	4c 89 fa             	mov    %r15,%rdx
+  8018d9:	41 ff d4             	call   *%r12
+  8018dc:	eb c2                	jmp    8018a0 <foreach_shared_region+0x39>
+            for (int pdei = 0; pdei < PD_ENTRY_COUNT; pdei++) {
+  8018de:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  8018e5:	00 
+  8018e6:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8018ea:	48 3d 00 00 00 40    	cmp    $0x40000000,%rax
+  8018f0:	74 46                	je     801938 <foreach_shared_region+0xd1>
+                uintptr_t pde_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, pdei, 0, 0);
+  8018f2:	4c 8b 75 c8          	mov    -0x38(%rbp),%r14
+  8018f6:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8018fa:	49 09 c6             	or     %rax,%r14
+                pde_t pde = uvpd[VPD(pde_addr)];
+  8018fd:	4c 89 f0             	mov    %r14,%rax
+  801900:	48 c1 e8 15          	shr    $0x15,%rax
+  801904:	48 b9 00 00 00 80 00 	movabs $0x10080000000,%rcx
+  80190b:	01 00 00 
+  80190e:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+                if (!(pde & PTE_P)) {
+  801912:	a8 01                	test   $0x1,%al
+  801914:	74 c8                	je     8018de <foreach_shared_region+0x77>
+                if (pde & PTE_PS) {
+  801916:	48 89 c3             	mov    %rax,%rbx
+  801919:	81 e3 80 00 00 00    	and    $0x80,%ebx
+  80191f:	74 8f                	je     8018b0 <foreach_shared_region+0x49>
+                    if (pde & PTE_SHARE) {
+  801921:	f6 c4 04             	test   $0x4,%ah
+  801924:	74 b8                	je     8018de <foreach_shared_region+0x77>
+                        fun((void*)pde_addr, (void*)(pde_addr + 1024 * 1024 * 2), arg);
+  801926:	49 8d b6 00 00 20 00 	lea    0x200000(%r14),%rsi
+  80192d:	4c 89 fa             	mov    %r15,%rdx
+  801930:	4c 89 f7             	mov    %r14,%rdi
+  801933:	41 ff d4             	call   *%r12
+  801936:	eb a6                	jmp    8018de <foreach_shared_region+0x77>
+  801938:	48 8b 5d b0          	mov    -0x50(%rbp),%rbx
+  80193c:	4c 8b 75 a8          	mov    -0x58(%rbp),%r14
+        for (int pdpei = 0; pdpei < PDP_ENTRY_COUNT; pdpei++) {
+  801940:	48 81 c3 00 00 00 40 	add    $0x40000000,%rbx
+  801947:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80194e:	00 00 00 
+  801951:	48 39 c3             	cmp    %rax,%rbx
+  801954:	74 4c                	je     8019a2 <foreach_shared_region+0x13b>
+            uintptr_t pdpe_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, 0, 0, 0);
+  801956:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  80195a:	48 09 d8             	or     %rbx,%rax
+  80195d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+            pdpe_t pdpe = uvpdp[VPDP(pdpe_addr)];
+  801961:	48 c1 e8 1e          	shr    $0x1e,%rax
+  801965:	48 b9 00 00 40 80 00 	movabs $0x10080400000,%rcx
+  80196c:	01 00 00 
+  80196f:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+            if (!(pdpe & PTE_P)) {
+  801973:	a8 01                	test   $0x1,%al
+  801975:	74 c9                	je     801940 <foreach_shared_region+0xd9>
+            if (pdpe & PTE_PS) {
+  801977:	48 89 c1             	mov    %rax,%rcx
+  80197a:	81 e1 80 00 00 00    	and    $0x80,%ecx
+  801980:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  801984:	0f 84 0c ff ff ff    	je     801896 <foreach_shared_region+0x2f>
+                if (pdpe & PTE_SHARE) {
+  80198a:	f6 c4 04             	test   $0x4,%ah
+  80198d:	74 b1                	je     801940 <foreach_shared_region+0xd9>
+                    fun((void*)pdpe_addr, (void*)(pdpe_addr + 1024 * 1024 * 1024), arg); 
+  80198f:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  801993:	48 8d b7 00 00 00 40 	lea    0x40000000(%rdi),%rsi
+  80199a:	4c 89 fa             	mov    %r15,%rdx
+  80199d:	41 ff d4             	call   *%r12
+  8019a0:	eb 9e                	jmp    801940 <foreach_shared_region+0xd9>
+    for (int pml4ei = 0; pml4ei < PML4_ENTRY_COUNT; pml4ei++) {
+  8019a2:	49 83 c6 01          	add    $0x1,%r14
+  8019a6:	49 81 fe 00 02 00 00 	cmp    $0x200,%r14
+  8019ad:	74 24                	je     8019d3 <foreach_shared_region+0x16c>
+        pml4e_t pml4e = uvpml4[VPML4(pml4_addr)];
+  8019af:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  8019b6:	01 00 00 
+  8019b9:	4a 8b 04 f0          	mov    (%rax,%r14,8),%rax
+        if (!(pml4e & PTE_P)) {
+  8019bd:	a8 01                	test   $0x1,%al
+  8019bf:	74 e1                	je     8019a2 <foreach_shared_region+0x13b>
+  8019c1:	4c 89 f0             	mov    %r14,%rax
+  8019c4:	48 c1 e0 27          	shl    $0x27,%rax
+  8019c8:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8019cc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8019d1:	eb 83                	jmp    801956 <foreach_shared_region+0xef>
+            }
+        }
+    }
+    
+    return 0;
+}
+  8019d3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019d8:	48 83 c4 38          	add    $0x38,%rsp
+  8019dc:	5b                   	pop    %rbx
+  8019dd:	41 5c                	pop    %r12
+  8019df:	41 5d                	pop    %r13
+  8019e1:	41 5e                	pop    %r14
+  8019e3:	41 5f                	pop    %r15
+  8019e5:	5d                   	pop    %rbp
+  8019e6:	c3                   	ret
+
+00000000008019e7 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  8019e7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019ec:	c3                   	ret
+
+00000000008019ed <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  8019ed:	55                   	push   %rbp
+  8019ee:	48 89 e5             	mov    %rsp,%rbp
+  8019f1:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  8019f4:	48 be b4 2d 80 00 00 	movabs $0x802db4,%rsi
+  8019fb:	00 00 00 
+  8019fe:	48 b8 87 26 80 00 00 	movabs $0x802687,%rax
+  801a05:	00 00 00 
+  801a08:	ff d0                	call   *%rax
+    return 0;
+}
+  801a0a:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a0f:	5d                   	pop    %rbp
+  801a10:	c3                   	ret
+
+0000000000801a11 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  801a11:	55                   	push   %rbp
+  801a12:	48 89 e5             	mov    %rsp,%rbp
+  801a15:	41 57                	push   %r15
+  801a17:	41 56                	push   %r14
+  801a19:	41 55                	push   %r13
+  801a1b:	41 54                	push   %r12
+  801a1d:	53                   	push   %rbx
+  801a1e:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  801a25:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  801a2c:	48 85 d2             	test   %rdx,%rdx
+  801a2f:	74 7a                	je     801aab <devcons_write+0x9a>
+  801a31:	49 89 d6             	mov    %rdx,%r14
+  801a34:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  801a3a:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  801a3f:	49 bf 81 28 80 00 00 	movabs $0x802881,%r15
+  801a46:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  801a49:	4c 89 f3             	mov    %r14,%rbx
+  801a4c:	48 29 f3             	sub    %rsi,%rbx
+  801a4f:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  801a54:	48 39 c3             	cmp    %rax,%rbx
+  801a57:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  801a5b:	4c 63 eb             	movslq %ebx,%r13
+  801a5e:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  801a65:	48 01 c6             	add    %rax,%rsi
+  801a68:	4c 89 ea             	mov    %r13,%rdx
+  801a6b:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  801a72:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  801a75:	4c 89 ee             	mov    %r13,%rsi
+  801a78:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  801a7f:	48 b8 f8 00 80 00 00 	movabs $0x8000f8,%rax
+  801a86:	00 00 00 
+  801a89:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  801a8b:	41 01 dc             	add    %ebx,%r12d
+  801a8e:	49 63 f4             	movslq %r12d,%rsi
+  801a91:	4c 39 f6             	cmp    %r14,%rsi
+  801a94:	72 b3                	jb     801a49 <devcons_write+0x38>
+    return res;
+  801a96:	49 63 c4             	movslq %r12d,%rax
+}
+  801a99:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  801aa0:	5b                   	pop    %rbx
+  801aa1:	41 5c                	pop    %r12
+  801aa3:	41 5d                	pop    %r13
+  801aa5:	41 5e                	pop    %r14
+  801aa7:	41 5f                	pop    %r15
+  801aa9:	5d                   	pop    %rbp
+  801aaa:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  801aab:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  801ab1:	eb e3                	jmp    801a96 <devcons_write+0x85>
+
+0000000000801ab3 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  801ab3:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  801ab6:	ba 00 00 00 00       	mov    $0x0,%edx
+  801abb:	48 85 c0             	test   %rax,%rax
+  801abe:	74 55                	je     801b15 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  801ac0:	55                   	push   %rbp
+  801ac1:	48 89 e5             	mov    %rsp,%rbp
+  801ac4:	41 55                	push   %r13
+  801ac6:	41 54                	push   %r12
+  801ac8:	53                   	push   %rbx
+  801ac9:	48 83 ec 08          	sub    $0x8,%rsp
+  801acd:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  801ad0:	48 bb 25 01 80 00 00 	movabs $0x800125,%rbx
+  801ad7:	00 00 00 
+  801ada:	49 bc f2 01 80 00 00 	movabs $0x8001f2,%r12
+  801ae1:	00 00 00 
+  801ae4:	eb 03                	jmp    801ae9 <devcons_read+0x36>
+  801ae6:	41 ff d4             	call   *%r12
+  801ae9:	ff d3                	call   *%rbx
+  801aeb:	85 c0                	test   %eax,%eax
+  801aed:	74 f7                	je     801ae6 <devcons_read+0x33>
+    if (c < 0) return c;
+  801aef:	48 63 d0             	movslq %eax,%rdx
+  801af2:	78 13                	js     801b07 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  801af4:	ba 00 00 00 00       	mov    $0x0,%edx
+  801af9:	83 f8 04             	cmp    $0x4,%eax
+  801afc:	74 09                	je     801b07 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  801afe:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  801b02:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  801b07:	48 89 d0             	mov    %rdx,%rax
+  801b0a:	48 83 c4 08          	add    $0x8,%rsp
+  801b0e:	5b                   	pop    %rbx
+  801b0f:	41 5c                	pop    %r12
+  801b11:	41 5d                	pop    %r13
+  801b13:	5d                   	pop    %rbp
+  801b14:	c3                   	ret
+  801b15:	48 89 d0             	mov    %rdx,%rax
+  801b18:	c3                   	ret
+
+0000000000801b19 <cputchar>:
+cputchar(int ch) {
+  801b19:	55                   	push   %rbp
+  801b1a:	48 89 e5             	mov    %rsp,%rbp
+  801b1d:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  801b21:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  801b25:	be 01 00 00 00       	mov    $0x1,%esi
+  801b2a:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  801b2e:	48 b8 f8 00 80 00 00 	movabs $0x8000f8,%rax
+  801b35:	00 00 00 
+  801b38:	ff d0                	call   *%rax
+}
+  801b3a:	c9                   	leave
+  801b3b:	c3                   	ret
+
+0000000000801b3c <getchar>:
+getchar(void) {
+  801b3c:	55                   	push   %rbp
+  801b3d:	48 89 e5             	mov    %rsp,%rbp
+  801b40:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  801b44:	ba 01 00 00 00       	mov    $0x1,%edx
+  801b49:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  801b4d:	bf 00 00 00 00       	mov    $0x0,%edi
+  801b52:	48 b8 60 0a 80 00 00 	movabs $0x800a60,%rax
+  801b59:	00 00 00 
+  801b5c:	ff d0                	call   *%rax
+  801b5e:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  801b60:	85 c0                	test   %eax,%eax
+  801b62:	78 06                	js     801b6a <getchar+0x2e>
+  801b64:	74 08                	je     801b6e <getchar+0x32>
+  801b66:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  801b6a:	89 d0                	mov    %edx,%eax
+  801b6c:	c9                   	leave
+  801b6d:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  801b6e:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  801b73:	eb f5                	jmp    801b6a <getchar+0x2e>
+
+0000000000801b75 <iscons>:
+iscons(int fdnum) {
+  801b75:	55                   	push   %rbp
+  801b76:	48 89 e5             	mov    %rsp,%rbp
+  801b79:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  801b7d:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801b81:	48 b8 7d 07 80 00 00 	movabs $0x80077d,%rax
+  801b88:	00 00 00 
+  801b8b:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801b8d:	85 c0                	test   %eax,%eax
+  801b8f:	78 18                	js     801ba9 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  801b91:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801b95:	48 b8 a0 40 80 00 00 	movabs $0x8040a0,%rax
+  801b9c:	00 00 00 
+  801b9f:	8b 00                	mov    (%rax),%eax
+  801ba1:	39 02                	cmp    %eax,(%rdx)
+  801ba3:	0f 94 c0             	sete   %al
+  801ba6:	0f b6 c0             	movzbl %al,%eax
+}
+  801ba9:	c9                   	leave
+  801baa:	c3                   	ret
+
+0000000000801bab <opencons>:
+opencons(void) {
+  801bab:	55                   	push   %rbp
+  801bac:	48 89 e5             	mov    %rsp,%rbp
+  801baf:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  801bb3:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  801bb7:	48 b8 63 07 80 00 00 	movabs $0x800763,%rax
+  801bbe:	00 00 00 
+  801bc1:	ff d0                	call   *%rax
+  801bc3:	85 c0                	test   %eax,%eax
+  801bc5:	78 49                	js     801c10 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  801bc7:	b9 46 00 00 00       	mov    $0x46,%ecx
+  801bcc:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801bd1:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  801bd5:	bf 00 00 00 00       	mov    $0x0,%edi
+  801bda:	48 b8 81 02 80 00 00 	movabs $0x800281,%rax
+  801be1:	00 00 00 
+  801be4:	ff d0                	call   *%rax
+  801be6:	85 c0                	test   %eax,%eax
+  801be8:	78 26                	js     801c10 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  801bea:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801bee:	a1 a0 40 80 00 00 00 	movabs 0x8040a0,%eax
+  801bf5:	00 00 
+  801bf7:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  801bf9:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801bfd:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  801c04:	48 b8 bc 06 80 00 00 	movabs $0x8006bc,%rax
+  801c0b:	00 00 00 
+  801c0e:	ff d0                	call   *%rax
+}
+  801c10:	c9                   	leave
+  801c11:	c3                   	ret
+
+0000000000801c12 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  801c12:	55                   	push   %rbp
+  801c13:	48 89 e5             	mov    %rsp,%rbp
+  801c16:	41 56                	push   %r14
+  801c18:	41 55                	push   %r13
+  801c1a:	41 54                	push   %r12
+  801c1c:	53                   	push   %rbx
+  801c1d:	48 83 ec 50          	sub    $0x50,%rsp
+  801c21:	49 89 fc             	mov    %rdi,%r12
+  801c24:	41 89 f5             	mov    %esi,%r13d
+  801c27:	48 89 d3             	mov    %rdx,%rbx
+  801c2a:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  801c2e:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  801c32:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  801c36:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  801c3d:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801c41:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  801c45:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  801c49:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  801c4d:	48 b8 00 40 80 00 00 	movabs $0x804000,%rax
+  801c54:	00 00 00 
+  801c57:	4c 8b 30             	mov    (%rax),%r14
+  801c5a:	48 b8 c1 01 80 00 00 	movabs $0x8001c1,%rax
+  801c61:	00 00 00 
+  801c64:	ff d0                	call   *%rax
+  801c66:	89 c6                	mov    %eax,%esi
+  801c68:	45 89 e8             	mov    %r13d,%r8d
+  801c6b:	4c 89 e1             	mov    %r12,%rcx
+  801c6e:	4c 89 f2             	mov    %r14,%rdx
+  801c71:	48 bf c0 2d 80 00 00 	movabs $0x802dc0,%rdi
+  801c78:	00 00 00 
+  801c7b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c80:	49 bc 62 1d 80 00 00 	movabs $0x801d62,%r12
+  801c87:	00 00 00 
+  801c8a:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  801c8d:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  801c91:	48 89 df             	mov    %rbx,%rdi
+  801c94:	48 b8 fe 1c 80 00 00 	movabs $0x801cfe,%rax
+  801c9b:	00 00 00 
+  801c9e:	ff d0                	call   *%rax
+    cprintf("\n");
+  801ca0:	48 bf 13 2d 80 00 00 	movabs $0x802d13,%rdi
+  801ca7:	00 00 00 
+  801caa:	b8 00 00 00 00       	mov    $0x0,%eax
+  801caf:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  801cb2:	cc                   	int3
+  801cb3:	eb fd                	jmp    801cb2 <_panic+0xa0>
+
+0000000000801cb5 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  801cb5:	55                   	push   %rbp
+  801cb6:	48 89 e5             	mov    %rsp,%rbp
+  801cb9:	53                   	push   %rbx
+  801cba:	48 83 ec 08          	sub    $0x8,%rsp
+  801cbe:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  801cc1:	8b 06                	mov    (%rsi),%eax
+  801cc3:	8d 50 01             	lea    0x1(%rax),%edx
+  801cc6:	89 16                	mov    %edx,(%rsi)
+  801cc8:	48 98                	cltq
+  801cca:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  801ccf:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  801cd5:	74 0a                	je     801ce1 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  801cd7:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  801cdb:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801cdf:	c9                   	leave
+  801ce0:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  801ce1:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  801ce5:	be ff 00 00 00       	mov    $0xff,%esi
+  801cea:	48 b8 f8 00 80 00 00 	movabs $0x8000f8,%rax
+  801cf1:	00 00 00 
+  801cf4:	ff d0                	call   *%rax
+        state->offset = 0;
+  801cf6:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  801cfc:	eb d9                	jmp    801cd7 <putch+0x22>
+
+0000000000801cfe <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  801cfe:	55                   	push   %rbp
+  801cff:	48 89 e5             	mov    %rsp,%rbp
+  801d02:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  801d09:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  801d0c:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  801d13:	b9 21 00 00 00       	mov    $0x21,%ecx
+  801d18:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d1d:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  801d20:	48 89 f1             	mov    %rsi,%rcx
+  801d23:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  801d2a:	48 bf b5 1c 80 00 00 	movabs $0x801cb5,%rdi
+  801d31:	00 00 00 
+  801d34:	48 b8 b2 1e 80 00 00 	movabs $0x801eb2,%rax
+  801d3b:	00 00 00 
+  801d3e:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  801d40:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  801d47:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  801d4e:	48 b8 f8 00 80 00 00 	movabs $0x8000f8,%rax
+  801d55:	00 00 00 
+  801d58:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  801d5a:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  801d60:	c9                   	leave
+  801d61:	c3                   	ret
+
+0000000000801d62 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  801d62:	55                   	push   %rbp
+  801d63:	48 89 e5             	mov    %rsp,%rbp
+  801d66:	48 83 ec 50          	sub    $0x50,%rsp
+  801d6a:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  801d6e:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  801d72:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801d76:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  801d7a:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  801d7e:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  801d85:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801d89:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801d8d:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  801d91:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  801d95:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  801d99:	48 b8 fe 1c 80 00 00 	movabs $0x801cfe,%rax
+  801da0:	00 00 00 
+  801da3:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  801da5:	c9                   	leave
+  801da6:	c3                   	ret
+
+0000000000801da7 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  801da7:	55                   	push   %rbp
+  801da8:	48 89 e5             	mov    %rsp,%rbp
+  801dab:	41 57                	push   %r15
+  801dad:	41 56                	push   %r14
+  801daf:	41 55                	push   %r13
+  801db1:	41 54                	push   %r12
+  801db3:	53                   	push   %rbx
+  801db4:	48 83 ec 18          	sub    $0x18,%rsp
+  801db8:	49 89 fc             	mov    %rdi,%r12
+  801dbb:	49 89 f5             	mov    %rsi,%r13
+  801dbe:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801dc2:	8b 45 10             	mov    0x10(%rbp),%eax
+  801dc5:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  801dc8:	41 89 cf             	mov    %ecx,%r15d
+  801dcb:	4c 39 fa             	cmp    %r15,%rdx
+  801dce:	73 5b                	jae    801e2b <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  801dd0:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  801dd4:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  801dd8:	85 db                	test   %ebx,%ebx
+  801dda:	7e 0e                	jle    801dea <print_num+0x43>
+            putch(padc, put_arg);
+  801ddc:	4c 89 ee             	mov    %r13,%rsi
+  801ddf:	44 89 f7             	mov    %r14d,%edi
+  801de2:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  801de5:	83 eb 01             	sub    $0x1,%ebx
+  801de8:	75 f2                	jne    801ddc <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  801dea:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  801dee:	48 b9 f4 2d 80 00 00 	movabs $0x802df4,%rcx
+  801df5:	00 00 00 
+  801df8:	48 b8 e3 2d 80 00 00 	movabs $0x802de3,%rax
+  801dff:	00 00 00 
+  801e02:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  801e06:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801e0a:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e0f:	49 f7 f7             	div    %r15
+  801e12:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  801e16:	4c 89 ee             	mov    %r13,%rsi
+  801e19:	41 ff d4             	call   *%r12
+}
+  801e1c:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  801e20:	5b                   	pop    %rbx
+  801e21:	41 5c                	pop    %r12
+  801e23:	41 5d                	pop    %r13
+  801e25:	41 5e                	pop    %r14
+  801e27:	41 5f                	pop    %r15
+  801e29:	5d                   	pop    %rbp
+  801e2a:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  801e2b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801e2f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e34:	49 f7 f7             	div    %r15
+  801e37:	48 83 ec 08          	sub    $0x8,%rsp
+  801e3b:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  801e3f:	52                   	push   %rdx
+  801e40:	45 0f be c9          	movsbl %r9b,%r9d
+  801e44:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  801e48:	48 89 c2             	mov    %rax,%rdx
+  801e4b:	48 b8 a7 1d 80 00 00 	movabs $0x801da7,%rax
+  801e52:	00 00 00 
+  801e55:	ff d0                	call   *%rax
+  801e57:	48 83 c4 10          	add    $0x10,%rsp
+  801e5b:	eb 8d                	jmp    801dea <print_num+0x43>
+
+0000000000801e5d <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  801e5d:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  801e61:	48 8b 06             	mov    (%rsi),%rax
+  801e64:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  801e68:	73 0a                	jae    801e74 <sprintputch+0x17>
+        *state->start++ = ch;
+  801e6a:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801e6e:	48 89 16             	mov    %rdx,(%rsi)
+  801e71:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  801e74:	c3                   	ret
+
+0000000000801e75 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  801e75:	55                   	push   %rbp
+  801e76:	48 89 e5             	mov    %rsp,%rbp
+  801e79:	48 83 ec 50          	sub    $0x50,%rsp
+  801e7d:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801e81:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  801e85:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  801e89:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  801e90:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801e94:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801e98:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  801e9c:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  801ea0:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  801ea4:	48 b8 b2 1e 80 00 00 	movabs $0x801eb2,%rax
+  801eab:	00 00 00 
+  801eae:	ff d0                	call   *%rax
+}
+  801eb0:	c9                   	leave
+  801eb1:	c3                   	ret
+
+0000000000801eb2 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  801eb2:	55                   	push   %rbp
+  801eb3:	48 89 e5             	mov    %rsp,%rbp
+  801eb6:	41 57                	push   %r15
+  801eb8:	41 56                	push   %r14
+  801eba:	41 55                	push   %r13
+  801ebc:	41 54                	push   %r12
+  801ebe:	53                   	push   %rbx
+  801ebf:	48 83 ec 38          	sub    $0x38,%rsp
+  801ec3:	49 89 fe             	mov    %rdi,%r14
+  801ec6:	49 89 f5             	mov    %rsi,%r13
+  801ec9:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  801ecc:	48 8b 01             	mov    (%rcx),%rax
+  801ecf:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  801ed3:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  801ed7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801edb:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  801edf:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  801ee3:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  801ee7:	0f b6 3b             	movzbl (%rbx),%edi
+  801eea:	40 80 ff 25          	cmp    $0x25,%dil
+  801eee:	74 18                	je     801f08 <vprintfmt+0x56>
+            if (!ch) return;
+  801ef0:	40 84 ff             	test   %dil,%dil
+  801ef3:	0f 84 b1 06 00 00    	je     8025aa <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  801ef9:	40 0f b6 ff          	movzbl %dil,%edi
+  801efd:	4c 89 ee             	mov    %r13,%rsi
+  801f00:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  801f03:	4c 89 e3             	mov    %r12,%rbx
+  801f06:	eb db                	jmp    801ee3 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  801f08:	be 00 00 00 00       	mov    $0x0,%esi
+  801f0d:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  801f11:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  801f16:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  801f1c:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  801f23:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  801f27:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  801f2c:	41 0f b6 04 24       	movzbl (%r12),%eax
+  801f31:	88 45 a0             	mov    %al,-0x60(%rbp)
+  801f34:	83 e8 23             	sub    $0x23,%eax
+  801f37:	3c 57                	cmp    $0x57,%al
+  801f39:	0f 87 51 06 00 00    	ja     802590 <vprintfmt+0x6de>
+  801f3f:	0f b6 c0             	movzbl %al,%eax
+  801f42:	48 b9 a0 2f 80 00 00 	movabs $0x802fa0,%rcx
+  801f49:	00 00 00 
+  801f4c:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  801f4f:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  801f52:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  801f56:	eb cf                	jmp    801f27 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  801f58:	49 89 dc             	mov    %rbx,%r12
+  801f5b:	be 01 00 00 00       	mov    $0x1,%esi
+  801f60:	eb c5                	jmp    801f27 <vprintfmt+0x75>
+            padc = ch;
+  801f62:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  801f66:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  801f69:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801f6c:	eb b9                	jmp    801f27 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  801f6e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801f71:	83 f8 2f             	cmp    $0x2f,%eax
+  801f74:	77 24                	ja     801f9a <vprintfmt+0xe8>
+  801f76:	89 c1                	mov    %eax,%ecx
+  801f78:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  801f7c:	83 c0 08             	add    $0x8,%eax
+  801f7f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801f82:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  801f85:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  801f88:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  801f8c:	79 99                	jns    801f27 <vprintfmt+0x75>
+                width = precision;
+  801f8e:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  801f92:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  801f98:	eb 8d                	jmp    801f27 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  801f9a:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  801f9e:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  801fa2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801fa6:	eb da                	jmp    801f82 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  801fa8:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  801fad:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  801fb1:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  801fb7:	3c 39                	cmp    $0x39,%al
+  801fb9:	77 1c                	ja     801fd7 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  801fbb:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  801fbf:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  801fc3:	0f b6 c0             	movzbl %al,%eax
+  801fc6:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  801fcb:	0f b6 03             	movzbl (%rbx),%eax
+  801fce:	3c 39                	cmp    $0x39,%al
+  801fd0:	76 e9                	jbe    801fbb <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  801fd2:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  801fd5:	eb b1                	jmp    801f88 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  801fd7:	49 89 dc             	mov    %rbx,%r12
+  801fda:	eb ac                	jmp    801f88 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  801fdc:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  801fdf:	85 c9                	test   %ecx,%ecx
+  801fe1:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fe6:	0f 49 c1             	cmovns %ecx,%eax
+  801fe9:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  801fec:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801fef:	e9 33 ff ff ff       	jmp    801f27 <vprintfmt+0x75>
+            lflag++;
+  801ff4:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  801ff7:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801ffa:	e9 28 ff ff ff       	jmp    801f27 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  801fff:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802002:	83 f8 2f             	cmp    $0x2f,%eax
+  802005:	77 19                	ja     802020 <vprintfmt+0x16e>
+  802007:	89 c2                	mov    %eax,%edx
+  802009:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80200d:	83 c0 08             	add    $0x8,%eax
+  802010:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802013:	8b 3a                	mov    (%rdx),%edi
+  802015:	4c 89 ee             	mov    %r13,%rsi
+  802018:	41 ff d6             	call   *%r14
+            break;
+  80201b:	e9 c3 fe ff ff       	jmp    801ee3 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  802020:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802024:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802028:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80202c:	eb e5                	jmp    802013 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  80202e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802031:	83 f8 2f             	cmp    $0x2f,%eax
+  802034:	77 5a                	ja     802090 <vprintfmt+0x1de>
+  802036:	89 c2                	mov    %eax,%edx
+  802038:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80203c:	83 c0 08             	add    $0x8,%eax
+  80203f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  802042:	8b 02                	mov    (%rdx),%eax
+  802044:	89 c1                	mov    %eax,%ecx
+  802046:	f7 d9                	neg    %ecx
+  802048:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  80204b:	83 f9 15             	cmp    $0x15,%ecx
+  80204e:	7f 4e                	jg     80209e <vprintfmt+0x1ec>
+  802050:	48 63 c1             	movslq %ecx,%rax
+  802053:	48 ba 60 32 80 00 00 	movabs $0x803260,%rdx
+  80205a:	00 00 00 
+  80205d:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802061:	48 85 c0             	test   %rax,%rax
+  802064:	74 38                	je     80209e <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  802066:	48 89 c1             	mov    %rax,%rcx
+  802069:	48 ba 79 2d 80 00 00 	movabs $0x802d79,%rdx
+  802070:	00 00 00 
+  802073:	4c 89 ee             	mov    %r13,%rsi
+  802076:	4c 89 f7             	mov    %r14,%rdi
+  802079:	b8 00 00 00 00       	mov    $0x0,%eax
+  80207e:	49 b8 75 1e 80 00 00 	movabs $0x801e75,%r8
+  802085:	00 00 00 
+  802088:	41 ff d0             	call   *%r8
+  80208b:	e9 53 fe ff ff       	jmp    801ee3 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  802090:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802094:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802098:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80209c:	eb a4                	jmp    802042 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  80209e:	48 ba 0c 2e 80 00 00 	movabs $0x802e0c,%rdx
+  8020a5:	00 00 00 
+  8020a8:	4c 89 ee             	mov    %r13,%rsi
+  8020ab:	4c 89 f7             	mov    %r14,%rdi
+  8020ae:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020b3:	49 b8 75 1e 80 00 00 	movabs $0x801e75,%r8
+  8020ba:	00 00 00 
+  8020bd:	41 ff d0             	call   *%r8
+  8020c0:	e9 1e fe ff ff       	jmp    801ee3 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8020c5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8020c8:	83 f8 2f             	cmp    $0x2f,%eax
+  8020cb:	77 6c                	ja     802139 <vprintfmt+0x287>
+  8020cd:	89 c2                	mov    %eax,%edx
+  8020cf:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8020d3:	83 c0 08             	add    $0x8,%eax
+  8020d6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8020d9:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  8020dc:	48 85 d2             	test   %rdx,%rdx
+  8020df:	48 b8 05 2e 80 00 00 	movabs $0x802e05,%rax
+  8020e6:	00 00 00 
+  8020e9:	48 0f 45 c2          	cmovne %rdx,%rax
+  8020ed:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  8020f1:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8020f5:	7e 06                	jle    8020fd <vprintfmt+0x24b>
+  8020f7:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  8020fb:	75 4a                	jne    802147 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8020fd:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  802101:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  802105:	0f b6 00             	movzbl (%rax),%eax
+  802108:	84 c0                	test   %al,%al
+  80210a:	0f 85 9a 00 00 00    	jne    8021aa <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  802110:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  802113:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  802117:	85 c0                	test   %eax,%eax
+  802119:	0f 8e c4 fd ff ff    	jle    801ee3 <vprintfmt+0x31>
+  80211f:	4c 89 ee             	mov    %r13,%rsi
+  802122:	bf 20 00 00 00       	mov    $0x20,%edi
+  802127:	41 ff d6             	call   *%r14
+  80212a:	41 83 ec 01          	sub    $0x1,%r12d
+  80212e:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  802132:	75 eb                	jne    80211f <vprintfmt+0x26d>
+  802134:	e9 aa fd ff ff       	jmp    801ee3 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  802139:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80213d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802141:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802145:	eb 92                	jmp    8020d9 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  802147:	49 63 f7             	movslq %r15d,%rsi
+  80214a:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  80214e:	48 b8 64 26 80 00 00 	movabs $0x802664,%rax
+  802155:	00 00 00 
+  802158:	ff d0                	call   *%rax
+  80215a:	48 89 c2             	mov    %rax,%rdx
+  80215d:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  802160:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  802162:	8d 70 ff             	lea    -0x1(%rax),%esi
+  802165:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  802168:	85 c0                	test   %eax,%eax
+  80216a:	7e 91                	jle    8020fd <vprintfmt+0x24b>
+  80216c:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  802171:	4c 89 ee             	mov    %r13,%rsi
+  802174:	44 89 e7             	mov    %r12d,%edi
+  802177:	41 ff d6             	call   *%r14
+  80217a:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  80217e:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  802181:	83 f8 ff             	cmp    $0xffffffff,%eax
+  802184:	75 eb                	jne    802171 <vprintfmt+0x2bf>
+  802186:	e9 72 ff ff ff       	jmp    8020fd <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  80218b:	0f b6 f8             	movzbl %al,%edi
+  80218e:	4c 89 ee             	mov    %r13,%rsi
+  802191:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  802194:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  802198:	49 83 c4 01          	add    $0x1,%r12
+  80219c:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  8021a2:	84 c0                	test   %al,%al
+  8021a4:	0f 84 66 ff ff ff    	je     802110 <vprintfmt+0x25e>
+  8021aa:	45 85 ff             	test   %r15d,%r15d
+  8021ad:	78 0a                	js     8021b9 <vprintfmt+0x307>
+  8021af:	41 83 ef 01          	sub    $0x1,%r15d
+  8021b3:	0f 88 57 ff ff ff    	js     802110 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8021b9:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  8021bd:	74 cc                	je     80218b <vprintfmt+0x2d9>
+  8021bf:	8d 50 e0             	lea    -0x20(%rax),%edx
+  8021c2:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  8021c7:	80 fa 5e             	cmp    $0x5e,%dl
+  8021ca:	77 c2                	ja     80218e <vprintfmt+0x2dc>
+  8021cc:	eb bd                	jmp    80218b <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  8021ce:	40 84 f6             	test   %sil,%sil
+  8021d1:	75 26                	jne    8021f9 <vprintfmt+0x347>
+    switch (lflag) {
+  8021d3:	85 d2                	test   %edx,%edx
+  8021d5:	74 59                	je     802230 <vprintfmt+0x37e>
+  8021d7:	83 fa 01             	cmp    $0x1,%edx
+  8021da:	74 7b                	je     802257 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  8021dc:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8021df:	83 f8 2f             	cmp    $0x2f,%eax
+  8021e2:	0f 87 96 00 00 00    	ja     80227e <vprintfmt+0x3cc>
+  8021e8:	89 c2                	mov    %eax,%edx
+  8021ea:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8021ee:	83 c0 08             	add    $0x8,%eax
+  8021f1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8021f4:	4c 8b 22             	mov    (%rdx),%r12
+  8021f7:	eb 17                	jmp    802210 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  8021f9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8021fc:	83 f8 2f             	cmp    $0x2f,%eax
+  8021ff:	77 21                	ja     802222 <vprintfmt+0x370>
+  802201:	89 c2                	mov    %eax,%edx
+  802203:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802207:	83 c0 08             	add    $0x8,%eax
+  80220a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80220d:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  802210:	4d 85 e4             	test   %r12,%r12
+  802213:	78 7a                	js     80228f <vprintfmt+0x3dd>
+            num = i;
+  802215:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  802218:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  80221d:	e9 50 02 00 00       	jmp    802472 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  802222:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802226:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80222a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80222e:	eb dd                	jmp    80220d <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  802230:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802233:	83 f8 2f             	cmp    $0x2f,%eax
+  802236:	77 11                	ja     802249 <vprintfmt+0x397>
+  802238:	89 c2                	mov    %eax,%edx
+  80223a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80223e:	83 c0 08             	add    $0x8,%eax
+  802241:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802244:	4c 63 22             	movslq (%rdx),%r12
+  802247:	eb c7                	jmp    802210 <vprintfmt+0x35e>
+  802249:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80224d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802251:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802255:	eb ed                	jmp    802244 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  802257:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80225a:	83 f8 2f             	cmp    $0x2f,%eax
+  80225d:	77 11                	ja     802270 <vprintfmt+0x3be>
+  80225f:	89 c2                	mov    %eax,%edx
+  802261:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802265:	83 c0 08             	add    $0x8,%eax
+  802268:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80226b:	4c 8b 22             	mov    (%rdx),%r12
+  80226e:	eb a0                	jmp    802210 <vprintfmt+0x35e>
+  802270:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802274:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802278:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80227c:	eb ed                	jmp    80226b <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  80227e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802282:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802286:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80228a:	e9 65 ff ff ff       	jmp    8021f4 <vprintfmt+0x342>
+                putch('-', put_arg);
+  80228f:	4c 89 ee             	mov    %r13,%rsi
+  802292:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  802297:	41 ff d6             	call   *%r14
+                i = -i;
+  80229a:	49 f7 dc             	neg    %r12
+  80229d:	e9 73 ff ff ff       	jmp    802215 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  8022a2:	40 84 f6             	test   %sil,%sil
+  8022a5:	75 32                	jne    8022d9 <vprintfmt+0x427>
+    switch (lflag) {
+  8022a7:	85 d2                	test   %edx,%edx
+  8022a9:	74 5d                	je     802308 <vprintfmt+0x456>
+  8022ab:	83 fa 01             	cmp    $0x1,%edx
+  8022ae:	0f 84 82 00 00 00    	je     802336 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  8022b4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8022b7:	83 f8 2f             	cmp    $0x2f,%eax
+  8022ba:	0f 87 a5 00 00 00    	ja     802365 <vprintfmt+0x4b3>
+  8022c0:	89 c2                	mov    %eax,%edx
+  8022c2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8022c6:	83 c0 08             	add    $0x8,%eax
+  8022c9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8022cc:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8022cf:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  8022d4:	e9 99 01 00 00       	jmp    802472 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8022d9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8022dc:	83 f8 2f             	cmp    $0x2f,%eax
+  8022df:	77 19                	ja     8022fa <vprintfmt+0x448>
+  8022e1:	89 c2                	mov    %eax,%edx
+  8022e3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8022e7:	83 c0 08             	add    $0x8,%eax
+  8022ea:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8022ed:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8022f0:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8022f5:	e9 78 01 00 00       	jmp    802472 <vprintfmt+0x5c0>
+  8022fa:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8022fe:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802302:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802306:	eb e5                	jmp    8022ed <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  802308:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80230b:	83 f8 2f             	cmp    $0x2f,%eax
+  80230e:	77 18                	ja     802328 <vprintfmt+0x476>
+  802310:	89 c2                	mov    %eax,%edx
+  802312:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802316:	83 c0 08             	add    $0x8,%eax
+  802319:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80231c:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  80231e:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  802323:	e9 4a 01 00 00       	jmp    802472 <vprintfmt+0x5c0>
+  802328:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80232c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802330:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802334:	eb e6                	jmp    80231c <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  802336:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802339:	83 f8 2f             	cmp    $0x2f,%eax
+  80233c:	77 19                	ja     802357 <vprintfmt+0x4a5>
+  80233e:	89 c2                	mov    %eax,%edx
+  802340:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802344:	83 c0 08             	add    $0x8,%eax
+  802347:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80234a:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  80234d:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  802352:	e9 1b 01 00 00       	jmp    802472 <vprintfmt+0x5c0>
+  802357:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80235b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80235f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802363:	eb e5                	jmp    80234a <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  802365:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802369:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80236d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802371:	e9 56 ff ff ff       	jmp    8022cc <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  802376:	40 84 f6             	test   %sil,%sil
+  802379:	75 2e                	jne    8023a9 <vprintfmt+0x4f7>
+    switch (lflag) {
+  80237b:	85 d2                	test   %edx,%edx
+  80237d:	74 59                	je     8023d8 <vprintfmt+0x526>
+  80237f:	83 fa 01             	cmp    $0x1,%edx
+  802382:	74 7f                	je     802403 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  802384:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802387:	83 f8 2f             	cmp    $0x2f,%eax
+  80238a:	0f 87 9f 00 00 00    	ja     80242f <vprintfmt+0x57d>
+  802390:	89 c2                	mov    %eax,%edx
+  802392:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802396:	83 c0 08             	add    $0x8,%eax
+  802399:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80239c:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  80239f:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  8023a4:	e9 c9 00 00 00       	jmp    802472 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8023a9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8023ac:	83 f8 2f             	cmp    $0x2f,%eax
+  8023af:	77 19                	ja     8023ca <vprintfmt+0x518>
+  8023b1:	89 c2                	mov    %eax,%edx
+  8023b3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8023b7:	83 c0 08             	add    $0x8,%eax
+  8023ba:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8023bd:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8023c0:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8023c5:	e9 a8 00 00 00       	jmp    802472 <vprintfmt+0x5c0>
+  8023ca:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8023ce:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8023d2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8023d6:	eb e5                	jmp    8023bd <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  8023d8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8023db:	83 f8 2f             	cmp    $0x2f,%eax
+  8023de:	77 15                	ja     8023f5 <vprintfmt+0x543>
+  8023e0:	89 c2                	mov    %eax,%edx
+  8023e2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8023e6:	83 c0 08             	add    $0x8,%eax
+  8023e9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8023ec:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  8023ee:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  8023f3:	eb 7d                	jmp    802472 <vprintfmt+0x5c0>
+  8023f5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8023f9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8023fd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802401:	eb e9                	jmp    8023ec <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  802403:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802406:	83 f8 2f             	cmp    $0x2f,%eax
+  802409:	77 16                	ja     802421 <vprintfmt+0x56f>
+  80240b:	89 c2                	mov    %eax,%edx
+  80240d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802411:	83 c0 08             	add    $0x8,%eax
+  802414:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802417:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  80241a:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  80241f:	eb 51                	jmp    802472 <vprintfmt+0x5c0>
+  802421:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802425:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802429:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80242d:	eb e8                	jmp    802417 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  80242f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802433:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802437:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80243b:	e9 5c ff ff ff       	jmp    80239c <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  802440:	4c 89 ee             	mov    %r13,%rsi
+  802443:	bf 30 00 00 00       	mov    $0x30,%edi
+  802448:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  80244b:	4c 89 ee             	mov    %r13,%rsi
+  80244e:	bf 78 00 00 00       	mov    $0x78,%edi
+  802453:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  802456:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802459:	83 f8 2f             	cmp    $0x2f,%eax
+  80245c:	77 47                	ja     8024a5 <vprintfmt+0x5f3>
+  80245e:	89 c2                	mov    %eax,%edx
+  802460:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802464:	83 c0 08             	add    $0x8,%eax
+  802467:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80246a:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  80246d:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  802472:	48 83 ec 08          	sub    $0x8,%rsp
+  802476:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  80247a:	0f 94 c0             	sete   %al
+  80247d:	0f b6 c0             	movzbl %al,%eax
+  802480:	50                   	push   %rax
+  802481:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  802486:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  80248a:	4c 89 ee             	mov    %r13,%rsi
+  80248d:	4c 89 f7             	mov    %r14,%rdi
+  802490:	48 b8 a7 1d 80 00 00 	movabs $0x801da7,%rax
+  802497:	00 00 00 
+  80249a:	ff d0                	call   *%rax
+            break;
+  80249c:	48 83 c4 10          	add    $0x10,%rsp
+  8024a0:	e9 3e fa ff ff       	jmp    801ee3 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  8024a5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8024a9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8024ad:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8024b1:	eb b7                	jmp    80246a <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  8024b3:	40 84 f6             	test   %sil,%sil
+  8024b6:	75 2b                	jne    8024e3 <vprintfmt+0x631>
+    switch (lflag) {
+  8024b8:	85 d2                	test   %edx,%edx
+  8024ba:	74 56                	je     802512 <vprintfmt+0x660>
+  8024bc:	83 fa 01             	cmp    $0x1,%edx
+  8024bf:	74 7f                	je     802540 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  8024c1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8024c4:	83 f8 2f             	cmp    $0x2f,%eax
+  8024c7:	0f 87 a2 00 00 00    	ja     80256f <vprintfmt+0x6bd>
+  8024cd:	89 c2                	mov    %eax,%edx
+  8024cf:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8024d3:	83 c0 08             	add    $0x8,%eax
+  8024d6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8024d9:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8024dc:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  8024e1:	eb 8f                	jmp    802472 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8024e3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8024e6:	83 f8 2f             	cmp    $0x2f,%eax
+  8024e9:	77 19                	ja     802504 <vprintfmt+0x652>
+  8024eb:	89 c2                	mov    %eax,%edx
+  8024ed:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8024f1:	83 c0 08             	add    $0x8,%eax
+  8024f4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8024f7:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8024fa:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8024ff:	e9 6e ff ff ff       	jmp    802472 <vprintfmt+0x5c0>
+  802504:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802508:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80250c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802510:	eb e5                	jmp    8024f7 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  802512:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802515:	83 f8 2f             	cmp    $0x2f,%eax
+  802518:	77 18                	ja     802532 <vprintfmt+0x680>
+  80251a:	89 c2                	mov    %eax,%edx
+  80251c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802520:	83 c0 08             	add    $0x8,%eax
+  802523:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802526:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  802528:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  80252d:	e9 40 ff ff ff       	jmp    802472 <vprintfmt+0x5c0>
+  802532:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802536:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80253a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80253e:	eb e6                	jmp    802526 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  802540:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802543:	83 f8 2f             	cmp    $0x2f,%eax
+  802546:	77 19                	ja     802561 <vprintfmt+0x6af>
+  802548:	89 c2                	mov    %eax,%edx
+  80254a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80254e:	83 c0 08             	add    $0x8,%eax
+  802551:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802554:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  802557:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  80255c:	e9 11 ff ff ff       	jmp    802472 <vprintfmt+0x5c0>
+  802561:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802565:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802569:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80256d:	eb e5                	jmp    802554 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  80256f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802573:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802577:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80257b:	e9 59 ff ff ff       	jmp    8024d9 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  802580:	4c 89 ee             	mov    %r13,%rsi
+  802583:	bf 25 00 00 00       	mov    $0x25,%edi
+  802588:	41 ff d6             	call   *%r14
+            break;
+  80258b:	e9 53 f9 ff ff       	jmp    801ee3 <vprintfmt+0x31>
+            putch('%', put_arg);
+  802590:	4c 89 ee             	mov    %r13,%rsi
+  802593:	bf 25 00 00 00       	mov    $0x25,%edi
+  802598:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  80259b:	48 83 eb 01          	sub    $0x1,%rbx
+  80259f:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  8025a3:	75 f6                	jne    80259b <vprintfmt+0x6e9>
+  8025a5:	e9 39 f9 ff ff       	jmp    801ee3 <vprintfmt+0x31>
+}
+  8025aa:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8025ae:	5b                   	pop    %rbx
+  8025af:	41 5c                	pop    %r12
+  8025b1:	41 5d                	pop    %r13
+  8025b3:	41 5e                	pop    %r14
+  8025b5:	41 5f                	pop    %r15
+  8025b7:	5d                   	pop    %rbp
+  8025b8:	c3                   	ret
+
+00000000008025b9 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  8025b9:	55                   	push   %rbp
+  8025ba:	48 89 e5             	mov    %rsp,%rbp
+  8025bd:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  8025c1:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8025c5:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  8025ca:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  8025ce:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  8025d5:	48 85 ff             	test   %rdi,%rdi
+  8025d8:	74 2b                	je     802605 <vsnprintf+0x4c>
+  8025da:	48 85 f6             	test   %rsi,%rsi
+  8025dd:	74 26                	je     802605 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  8025df:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8025e3:	48 bf 5d 1e 80 00 00 	movabs $0x801e5d,%rdi
+  8025ea:	00 00 00 
+  8025ed:	48 b8 b2 1e 80 00 00 	movabs $0x801eb2,%rax
+  8025f4:	00 00 00 
+  8025f7:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  8025f9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8025fd:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  802600:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  802603:	c9                   	leave
+  802604:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  802605:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80260a:	eb f7                	jmp    802603 <vsnprintf+0x4a>
+
+000000000080260c <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  80260c:	55                   	push   %rbp
+  80260d:	48 89 e5             	mov    %rsp,%rbp
+  802610:	48 83 ec 50          	sub    $0x50,%rsp
+  802614:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  802618:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80261c:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  802620:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  802627:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80262b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80262f:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  802633:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  802637:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80263b:	48 b8 b9 25 80 00 00 	movabs $0x8025b9,%rax
+  802642:	00 00 00 
+  802645:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  802647:	c9                   	leave
+  802648:	c3                   	ret
+
+0000000000802649 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  802649:	80 3f 00             	cmpb   $0x0,(%rdi)
+  80264c:	74 10                	je     80265e <strlen+0x15>
+    size_t n = 0;
+  80264e:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  802653:	48 83 c0 01          	add    $0x1,%rax
+  802657:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  80265b:	75 f6                	jne    802653 <strlen+0xa>
+  80265d:	c3                   	ret
+    size_t n = 0;
+  80265e:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  802663:	c3                   	ret
+
+0000000000802664 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  802664:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  802667:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  80266c:	48 85 f6             	test   %rsi,%rsi
+  80266f:	74 11                	je     802682 <strnlen+0x1e>
+  802671:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  802675:	74 0c                	je     802683 <strnlen+0x1f>
+  802677:	48 83 c2 01          	add    $0x1,%rdx
+  80267b:	48 39 d0             	cmp    %rdx,%rax
+  80267e:	75 f1                	jne    802671 <strnlen+0xd>
+  802680:	eb 04                	jmp    802686 <strnlen+0x22>
+  802682:	c3                   	ret
+  802683:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  802686:	c3                   	ret
+
+0000000000802687 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  802687:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  80268a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80268f:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  802693:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  802696:	48 83 c2 01          	add    $0x1,%rdx
+  80269a:	84 c9                	test   %cl,%cl
+  80269c:	75 f1                	jne    80268f <strcpy+0x8>
+        ;
+    return res;
+}
+  80269e:	c3                   	ret
+
+000000000080269f <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  80269f:	55                   	push   %rbp
+  8026a0:	48 89 e5             	mov    %rsp,%rbp
+  8026a3:	41 54                	push   %r12
+  8026a5:	53                   	push   %rbx
+  8026a6:	48 89 fb             	mov    %rdi,%rbx
+  8026a9:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  8026ac:	48 b8 49 26 80 00 00 	movabs $0x802649,%rax
+  8026b3:	00 00 00 
+  8026b6:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  8026b8:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  8026bc:	4c 89 e6             	mov    %r12,%rsi
+  8026bf:	48 b8 87 26 80 00 00 	movabs $0x802687,%rax
+  8026c6:	00 00 00 
+  8026c9:	ff d0                	call   *%rax
+    return dst;
+}
+  8026cb:	48 89 d8             	mov    %rbx,%rax
+  8026ce:	5b                   	pop    %rbx
+  8026cf:	41 5c                	pop    %r12
+  8026d1:	5d                   	pop    %rbp
+  8026d2:	c3                   	ret
+
+00000000008026d3 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8026d3:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  8026d6:	48 85 d2             	test   %rdx,%rdx
+  8026d9:	74 1f                	je     8026fa <strncpy+0x27>
+  8026db:	48 01 fa             	add    %rdi,%rdx
+  8026de:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  8026e1:	48 83 c1 01          	add    $0x1,%rcx
+  8026e5:	44 0f b6 06          	movzbl (%rsi),%r8d
+  8026e9:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  8026ed:	41 80 f8 01          	cmp    $0x1,%r8b
+  8026f1:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  8026f5:	48 39 ca             	cmp    %rcx,%rdx
+  8026f8:	75 e7                	jne    8026e1 <strncpy+0xe>
+    }
+    return ret;
+}
+  8026fa:	c3                   	ret
+
+00000000008026fb <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  8026fb:	48 89 f8             	mov    %rdi,%rax
+  8026fe:	48 85 d2             	test   %rdx,%rdx
+  802701:	74 24                	je     802727 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  802703:	48 83 ea 01          	sub    $0x1,%rdx
+  802707:	74 1b                	je     802724 <strlcpy+0x29>
+  802709:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  80270d:	0f b6 16             	movzbl (%rsi),%edx
+  802710:	84 d2                	test   %dl,%dl
+  802712:	74 10                	je     802724 <strlcpy+0x29>
+            *dst++ = *src++;
+  802714:	48 83 c6 01          	add    $0x1,%rsi
+  802718:	48 83 c0 01          	add    $0x1,%rax
+  80271c:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  80271f:	48 39 c8             	cmp    %rcx,%rax
+  802722:	75 e9                	jne    80270d <strlcpy+0x12>
+        *dst = '\0';
+  802724:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  802727:	48 29 f8             	sub    %rdi,%rax
+}
+  80272a:	c3                   	ret
+
+000000000080272b <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  80272b:	0f b6 07             	movzbl (%rdi),%eax
+  80272e:	84 c0                	test   %al,%al
+  802730:	74 13                	je     802745 <strcmp+0x1a>
+  802732:	38 06                	cmp    %al,(%rsi)
+  802734:	75 0f                	jne    802745 <strcmp+0x1a>
+  802736:	48 83 c7 01          	add    $0x1,%rdi
+  80273a:	48 83 c6 01          	add    $0x1,%rsi
+  80273e:	0f b6 07             	movzbl (%rdi),%eax
+  802741:	84 c0                	test   %al,%al
+  802743:	75 ed                	jne    802732 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  802745:	0f b6 c0             	movzbl %al,%eax
+  802748:	0f b6 16             	movzbl (%rsi),%edx
+  80274b:	29 d0                	sub    %edx,%eax
+}
+  80274d:	c3                   	ret
+
+000000000080274e <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  80274e:	48 85 d2             	test   %rdx,%rdx
+  802751:	74 1f                	je     802772 <strncmp+0x24>
+  802753:	0f b6 07             	movzbl (%rdi),%eax
+  802756:	84 c0                	test   %al,%al
+  802758:	74 1e                	je     802778 <strncmp+0x2a>
+  80275a:	3a 06                	cmp    (%rsi),%al
+  80275c:	75 1a                	jne    802778 <strncmp+0x2a>
+  80275e:	48 83 c7 01          	add    $0x1,%rdi
+  802762:	48 83 c6 01          	add    $0x1,%rsi
+  802766:	48 83 ea 01          	sub    $0x1,%rdx
+  80276a:	75 e7                	jne    802753 <strncmp+0x5>
+
+    if (!n) return 0;
+  80276c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802771:	c3                   	ret
+  802772:	b8 00 00 00 00       	mov    $0x0,%eax
+  802777:	c3                   	ret
+  802778:	48 85 d2             	test   %rdx,%rdx
+  80277b:	74 09                	je     802786 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  80277d:	0f b6 07             	movzbl (%rdi),%eax
+  802780:	0f b6 16             	movzbl (%rsi),%edx
+  802783:	29 d0                	sub    %edx,%eax
+  802785:	c3                   	ret
+    if (!n) return 0;
+  802786:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80278b:	c3                   	ret
+
+000000000080278c <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  80278c:	0f b6 17             	movzbl (%rdi),%edx
+  80278f:	84 d2                	test   %dl,%dl
+  802791:	74 18                	je     8027ab <strchr+0x1f>
+        if (*str == c) {
+  802793:	0f be d2             	movsbl %dl,%edx
+  802796:	39 f2                	cmp    %esi,%edx
+  802798:	74 17                	je     8027b1 <strchr+0x25>
+    for (; *str; str++) {
+  80279a:	48 83 c7 01          	add    $0x1,%rdi
+  80279e:	0f b6 17             	movzbl (%rdi),%edx
+  8027a1:	84 d2                	test   %dl,%dl
+  8027a3:	75 ee                	jne    802793 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  8027a5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027aa:	c3                   	ret
+  8027ab:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027b0:	c3                   	ret
+  8027b1:	48 89 f8             	mov    %rdi,%rax
+}
+  8027b4:	c3                   	ret
+
+00000000008027b5 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  8027b5:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  8027b8:	0f b6 17             	movzbl (%rdi),%edx
+  8027bb:	84 d2                	test   %dl,%dl
+  8027bd:	74 13                	je     8027d2 <strfind+0x1d>
+  8027bf:	0f be d2             	movsbl %dl,%edx
+  8027c2:	39 f2                	cmp    %esi,%edx
+  8027c4:	74 0b                	je     8027d1 <strfind+0x1c>
+  8027c6:	48 83 c0 01          	add    $0x1,%rax
+  8027ca:	0f b6 10             	movzbl (%rax),%edx
+  8027cd:	84 d2                	test   %dl,%dl
+  8027cf:	75 ee                	jne    8027bf <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  8027d1:	c3                   	ret
+  8027d2:	c3                   	ret
+
+00000000008027d3 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  8027d3:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  8027d6:	48 89 f8             	mov    %rdi,%rax
+  8027d9:	48 f7 d8             	neg    %rax
+  8027dc:	83 e0 07             	and    $0x7,%eax
+  8027df:	49 89 d1             	mov    %rdx,%r9
+  8027e2:	49 29 c1             	sub    %rax,%r9
+  8027e5:	78 36                	js     80281d <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  8027e7:	40 0f b6 c6          	movzbl %sil,%eax
+  8027eb:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  8027f2:	01 01 01 
+  8027f5:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  8027f9:	40 f6 c7 07          	test   $0x7,%dil
+  8027fd:	75 38                	jne    802837 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  8027ff:	4c 89 c9             	mov    %r9,%rcx
+  802802:	48 c1 f9 03          	sar    $0x3,%rcx
+  802806:	74 0c                	je     802814 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  802808:	fc                   	cld
+  802809:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  80280c:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  802810:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  802814:	4d 85 c9             	test   %r9,%r9
+  802817:	75 45                	jne    80285e <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  802819:	4c 89 c0             	mov    %r8,%rax
+  80281c:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  80281d:	48 85 d2             	test   %rdx,%rdx
+  802820:	74 f7                	je     802819 <memset+0x46>
+  802822:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  802825:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  802828:	48 83 c0 01          	add    $0x1,%rax
+  80282c:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  802830:	48 39 c2             	cmp    %rax,%rdx
+  802833:	75 f3                	jne    802828 <memset+0x55>
+  802835:	eb e2                	jmp    802819 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  802837:	40 f6 c7 01          	test   $0x1,%dil
+  80283b:	74 06                	je     802843 <memset+0x70>
+  80283d:	88 07                	mov    %al,(%rdi)
+  80283f:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  802843:	40 f6 c7 02          	test   $0x2,%dil
+  802847:	74 07                	je     802850 <memset+0x7d>
+  802849:	66 89 07             	mov    %ax,(%rdi)
+  80284c:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  802850:	40 f6 c7 04          	test   $0x4,%dil
+  802854:	74 a9                	je     8027ff <memset+0x2c>
+  802856:	89 07                	mov    %eax,(%rdi)
+  802858:	48 83 c7 04          	add    $0x4,%rdi
+  80285c:	eb a1                	jmp    8027ff <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  80285e:	41 f6 c1 04          	test   $0x4,%r9b
+  802862:	74 06                	je     80286a <memset+0x97>
+  802864:	89 07                	mov    %eax,(%rdi)
+  802866:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  80286a:	41 f6 c1 02          	test   $0x2,%r9b
+  80286e:	74 07                	je     802877 <memset+0xa4>
+  802870:	66 89 07             	mov    %ax,(%rdi)
+  802873:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  802877:	41 f6 c1 01          	test   $0x1,%r9b
+  80287b:	74 9c                	je     802819 <memset+0x46>
+  80287d:	88 07                	mov    %al,(%rdi)
+  80287f:	eb 98                	jmp    802819 <memset+0x46>
+
+0000000000802881 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  802881:	48 89 f8             	mov    %rdi,%rax
+  802884:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  802887:	48 39 fe             	cmp    %rdi,%rsi
+  80288a:	73 3b                	jae    8028c7 <memmove+0x46>
+  80288c:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  802890:	48 39 d7             	cmp    %rdx,%rdi
+  802893:	73 32                	jae    8028c7 <memmove+0x46>
+        s += n;
+        d += n;
+  802895:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  802899:	48 89 d6             	mov    %rdx,%rsi
+  80289c:	48 09 fe             	or     %rdi,%rsi
+  80289f:	48 09 ce             	or     %rcx,%rsi
+  8028a2:	40 f6 c6 07          	test   $0x7,%sil
+  8028a6:	75 12                	jne    8028ba <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  8028a8:	48 83 ef 08          	sub    $0x8,%rdi
+  8028ac:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  8028b0:	48 c1 e9 03          	shr    $0x3,%rcx
+  8028b4:	fd                   	std
+  8028b5:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  8028b8:	fc                   	cld
+  8028b9:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  8028ba:	48 83 ef 01          	sub    $0x1,%rdi
+  8028be:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  8028c2:	fd                   	std
+  8028c3:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  8028c5:	eb f1                	jmp    8028b8 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  8028c7:	48 89 f2             	mov    %rsi,%rdx
+  8028ca:	48 09 c2             	or     %rax,%rdx
+  8028cd:	48 09 ca             	or     %rcx,%rdx
+  8028d0:	f6 c2 07             	test   $0x7,%dl
+  8028d3:	75 0c                	jne    8028e1 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  8028d5:	48 c1 e9 03          	shr    $0x3,%rcx
+  8028d9:	48 89 c7             	mov    %rax,%rdi
+  8028dc:	fc                   	cld
+  8028dd:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  8028e0:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  8028e1:	48 89 c7             	mov    %rax,%rdi
+  8028e4:	fc                   	cld
+  8028e5:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  8028e7:	c3                   	ret
+
+00000000008028e8 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  8028e8:	55                   	push   %rbp
+  8028e9:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  8028ec:	48 b8 81 28 80 00 00 	movabs $0x802881,%rax
+  8028f3:	00 00 00 
+  8028f6:	ff d0                	call   *%rax
+}
+  8028f8:	5d                   	pop    %rbp
+  8028f9:	c3                   	ret
+
+00000000008028fa <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  8028fa:	55                   	push   %rbp
+  8028fb:	48 89 e5             	mov    %rsp,%rbp
+  8028fe:	41 57                	push   %r15
+  802900:	41 56                	push   %r14
+  802902:	41 55                	push   %r13
+  802904:	41 54                	push   %r12
+  802906:	53                   	push   %rbx
+  802907:	48 83 ec 08          	sub    $0x8,%rsp
+  80290b:	49 89 fe             	mov    %rdi,%r14
+  80290e:	49 89 f7             	mov    %rsi,%r15
+  802911:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  802914:	48 89 f7             	mov    %rsi,%rdi
+  802917:	48 b8 49 26 80 00 00 	movabs $0x802649,%rax
+  80291e:	00 00 00 
+  802921:	ff d0                	call   *%rax
+  802923:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  802926:	48 89 de             	mov    %rbx,%rsi
+  802929:	4c 89 f7             	mov    %r14,%rdi
+  80292c:	48 b8 64 26 80 00 00 	movabs $0x802664,%rax
+  802933:	00 00 00 
+  802936:	ff d0                	call   *%rax
+  802938:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  80293b:	48 39 c3             	cmp    %rax,%rbx
+  80293e:	74 36                	je     802976 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  802940:	48 89 d8             	mov    %rbx,%rax
+  802943:	4c 29 e8             	sub    %r13,%rax
+  802946:	49 39 c4             	cmp    %rax,%r12
+  802949:	73 31                	jae    80297c <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  80294b:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  802950:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  802954:	4c 89 fe             	mov    %r15,%rsi
+  802957:	48 b8 e8 28 80 00 00 	movabs $0x8028e8,%rax
+  80295e:	00 00 00 
+  802961:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  802963:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  802967:	48 83 c4 08          	add    $0x8,%rsp
+  80296b:	5b                   	pop    %rbx
+  80296c:	41 5c                	pop    %r12
+  80296e:	41 5d                	pop    %r13
+  802970:	41 5e                	pop    %r14
+  802972:	41 5f                	pop    %r15
+  802974:	5d                   	pop    %rbp
+  802975:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  802976:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  80297a:	eb eb                	jmp    802967 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  80297c:	48 83 eb 01          	sub    $0x1,%rbx
+  802980:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  802984:	48 89 da             	mov    %rbx,%rdx
+  802987:	4c 89 fe             	mov    %r15,%rsi
+  80298a:	48 b8 e8 28 80 00 00 	movabs $0x8028e8,%rax
+  802991:	00 00 00 
+  802994:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  802996:	49 01 de             	add    %rbx,%r14
+  802999:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  80299e:	eb c3                	jmp    802963 <strlcat+0x69>
+
+00000000008029a0 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  8029a0:	48 85 d2             	test   %rdx,%rdx
+  8029a3:	74 2d                	je     8029d2 <memcmp+0x32>
+  8029a5:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  8029aa:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  8029ae:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  8029b3:	44 38 c1             	cmp    %r8b,%cl
+  8029b6:	75 0f                	jne    8029c7 <memcmp+0x27>
+    while (n-- > 0) {
+  8029b8:	48 83 c0 01          	add    $0x1,%rax
+  8029bc:	48 39 c2             	cmp    %rax,%rdx
+  8029bf:	75 e9                	jne    8029aa <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  8029c1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029c6:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  8029c7:	0f b6 c1             	movzbl %cl,%eax
+  8029ca:	45 0f b6 c0          	movzbl %r8b,%r8d
+  8029ce:	44 29 c0             	sub    %r8d,%eax
+  8029d1:	c3                   	ret
+    return 0;
+  8029d2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8029d7:	c3                   	ret
+
+00000000008029d8 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  8029d8:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  8029dc:	48 39 c7             	cmp    %rax,%rdi
+  8029df:	73 0f                	jae    8029f0 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  8029e1:	40 38 37             	cmp    %sil,(%rdi)
+  8029e4:	74 0e                	je     8029f4 <memfind+0x1c>
+    for (; src < end; src++) {
+  8029e6:	48 83 c7 01          	add    $0x1,%rdi
+  8029ea:	48 39 f8             	cmp    %rdi,%rax
+  8029ed:	75 f2                	jne    8029e1 <memfind+0x9>
+  8029ef:	c3                   	ret
+  8029f0:	48 89 f8             	mov    %rdi,%rax
+  8029f3:	c3                   	ret
+  8029f4:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  8029f7:	c3                   	ret
+
+00000000008029f8 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  8029f8:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  8029fb:	0f b6 37             	movzbl (%rdi),%esi
+  8029fe:	40 80 fe 20          	cmp    $0x20,%sil
+  802a02:	74 06                	je     802a0a <strtol+0x12>
+  802a04:	40 80 fe 09          	cmp    $0x9,%sil
+  802a08:	75 13                	jne    802a1d <strtol+0x25>
+  802a0a:	48 83 c7 01          	add    $0x1,%rdi
+  802a0e:	0f b6 37             	movzbl (%rdi),%esi
+  802a11:	40 80 fe 20          	cmp    $0x20,%sil
+  802a15:	74 f3                	je     802a0a <strtol+0x12>
+  802a17:	40 80 fe 09          	cmp    $0x9,%sil
+  802a1b:	74 ed                	je     802a0a <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  802a1d:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  802a20:	83 e0 fd             	and    $0xfffffffd,%eax
+  802a23:	3c 01                	cmp    $0x1,%al
+  802a25:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  802a29:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  802a2f:	75 0f                	jne    802a40 <strtol+0x48>
+  802a31:	80 3f 30             	cmpb   $0x30,(%rdi)
+  802a34:	74 14                	je     802a4a <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  802a36:	85 d2                	test   %edx,%edx
+  802a38:	b8 0a 00 00 00       	mov    $0xa,%eax
+  802a3d:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  802a40:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  802a45:	4c 63 ca             	movslq %edx,%r9
+  802a48:	eb 36                	jmp    802a80 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  802a4a:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  802a4e:	74 0f                	je     802a5f <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  802a50:	85 d2                	test   %edx,%edx
+  802a52:	75 ec                	jne    802a40 <strtol+0x48>
+        s++;
+  802a54:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  802a58:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  802a5d:	eb e1                	jmp    802a40 <strtol+0x48>
+        s += 2;
+  802a5f:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  802a63:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  802a68:	eb d6                	jmp    802a40 <strtol+0x48>
+            dig -= '0';
+  802a6a:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  802a6d:	44 0f b6 c1          	movzbl %cl,%r8d
+  802a71:	41 39 d0             	cmp    %edx,%r8d
+  802a74:	7d 21                	jge    802a97 <strtol+0x9f>
+        val = val * base + dig;
+  802a76:	49 0f af c1          	imul   %r9,%rax
+  802a7a:	0f b6 c9             	movzbl %cl,%ecx
+  802a7d:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  802a80:	48 83 c7 01          	add    $0x1,%rdi
+  802a84:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  802a88:	80 f9 39             	cmp    $0x39,%cl
+  802a8b:	76 dd                	jbe    802a6a <strtol+0x72>
+        else if (dig - 'a' < 27)
+  802a8d:	80 f9 7b             	cmp    $0x7b,%cl
+  802a90:	77 05                	ja     802a97 <strtol+0x9f>
+            dig -= 'a' - 10;
+  802a92:	83 e9 57             	sub    $0x57,%ecx
+  802a95:	eb d6                	jmp    802a6d <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  802a97:	4d 85 d2             	test   %r10,%r10
+  802a9a:	74 03                	je     802a9f <strtol+0xa7>
+  802a9c:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  802a9f:	48 89 c2             	mov    %rax,%rdx
+  802aa2:	48 f7 da             	neg    %rdx
+  802aa5:	40 80 fe 2d          	cmp    $0x2d,%sil
+  802aa9:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  802aad:	c3                   	ret
+
+0000000000802aae <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  802aae:	55                   	push   %rbp
+  802aaf:	48 89 e5             	mov    %rsp,%rbp
+  802ab2:	41 55                	push   %r13
+  802ab4:	41 54                	push   %r12
+  802ab6:	53                   	push   %rbx
+  802ab7:	48 83 ec 08          	sub    $0x8,%rsp
+  802abb:	49 89 fc             	mov    %rdi,%r12
+  802abe:	48 89 f7             	mov    %rsi,%rdi
+  802ac1:	48 89 d3             	mov    %rdx,%rbx
+  802ac4:	49 89 cd             	mov    %rcx,%r13
+    // LAB 9: Your code here:
+    int res = sys_ipc_recv(!pg ? (void*)MAX_USER_ADDRESS : pg, !size ? 0 : *size);
+  802ac7:	be 00 00 00 00       	mov    $0x0,%esi
+  802acc:	48 85 d2             	test   %rdx,%rdx
+  802acf:	74 03                	je     802ad4 <ipc_recv+0x26>
+  802ad1:	48 8b 32             	mov    (%rdx),%rsi
+  802ad4:	48 85 ff             	test   %rdi,%rdi
+  802ad7:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802ade:	00 00 00 
+  802ae1:	48 0f 44 f8          	cmove  %rax,%rdi
+  802ae5:	48 b8 53 06 80 00 00 	movabs $0x800653,%rax
+  802aec:	00 00 00 
+  802aef:	ff d0                	call   *%rax
+    if (res < 0) {
+  802af1:	85 c0                	test   %eax,%eax
+  802af3:	78 66                	js     802b5b <ipc_recv+0xad>
+        if (size) {
+            *size = 0;
+        }
+        return res;
+    }
+    if (from_env_store) {
+  802af5:	4d 85 e4             	test   %r12,%r12
+  802af8:	74 14                	je     802b0e <ipc_recv+0x60>
+        *from_env_store = thisenv->env_ipc_from;
+  802afa:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802b01:	00 00 00 
+  802b04:	8b 80 ac 01 00 00    	mov    0x1ac(%rax),%eax
+  802b0a:	41 89 04 24          	mov    %eax,(%r12)
+    }
+    if (perm_store) {
+  802b0e:	4d 85 ed             	test   %r13,%r13
+  802b11:	74 14                	je     802b27 <ipc_recv+0x79>
+        *perm_store = thisenv->env_ipc_perm;
+  802b13:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802b1a:	00 00 00 
+  802b1d:	8b 80 b0 01 00 00    	mov    0x1b0(%rax),%eax
+  802b23:	41 89 45 00          	mov    %eax,0x0(%r13)
+    }
+    if (size) {
+  802b27:	48 85 db             	test   %rbx,%rbx
+  802b2a:	74 14                	je     802b40 <ipc_recv+0x92>
+        *size = thisenv->env_ipc_maxsz;
+  802b2c:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802b33:	00 00 00 
+  802b36:	48 8b 80 a0 01 00 00 	mov    0x1a0(%rax),%rax
+  802b3d:	48 89 03             	mov    %rax,(%rbx)
+    }
+    return thisenv->env_ipc_value;
+  802b40:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802b47:	00 00 00 
+  802b4a:	8b 80 a8 01 00 00    	mov    0x1a8(%rax),%eax
+}
+  802b50:	48 83 c4 08          	add    $0x8,%rsp
+  802b54:	5b                   	pop    %rbx
+  802b55:	41 5c                	pop    %r12
+  802b57:	41 5d                	pop    %r13
+  802b59:	5d                   	pop    %rbp
+  802b5a:	c3                   	ret
+        if (from_env_store) {
+  802b5b:	4d 85 e4             	test   %r12,%r12
+  802b5e:	74 08                	je     802b68 <ipc_recv+0xba>
+            *from_env_store = 0;
+  802b60:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  802b67:	00 
+        if (perm_store) {
+  802b68:	4d 85 ed             	test   %r13,%r13
+  802b6b:	74 08                	je     802b75 <ipc_recv+0xc7>
+            *perm_store = 0;
+  802b6d:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  802b74:	00 
+        if (size) {
+  802b75:	48 85 db             	test   %rbx,%rbx
+  802b78:	74 d6                	je     802b50 <ipc_recv+0xa2>
+            *size = 0;
+  802b7a:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  802b81:	eb cd                	jmp    802b50 <ipc_recv+0xa2>
+
+0000000000802b83 <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  802b83:	55                   	push   %rbp
+  802b84:	48 89 e5             	mov    %rsp,%rbp
+  802b87:	41 57                	push   %r15
+  802b89:	41 56                	push   %r14
+  802b8b:	41 55                	push   %r13
+  802b8d:	41 54                	push   %r12
+  802b8f:	53                   	push   %rbx
+  802b90:	48 83 ec 18          	sub    $0x18,%rsp
+  802b94:	41 89 fd             	mov    %edi,%r13d
+  802b97:	89 75 cc             	mov    %esi,-0x34(%rbp)
+  802b9a:	49 89 cc             	mov    %rcx,%r12
+  802b9d:	44 89 45 c8          	mov    %r8d,-0x38(%rbp)
+    // LAB 9: Your code here:
+    int res = 0;
+    while ((res = sys_ipc_try_send(to_env, val, !pg ? (void*)MAX_USER_ADDRESS : pg, size, perm)) < 0) {
+  802ba1:	48 85 d2             	test   %rdx,%rdx
+  802ba4:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802bab:	00 00 00 
+  802bae:	48 0f 45 c2          	cmovne %rdx,%rax
+  802bb2:	48 89 c3             	mov    %rax,%rbx
+  802bb5:	49 be 27 06 80 00 00 	movabs $0x800627,%r14
+  802bbc:	00 00 00 
+        if (res != -E_IPC_NOT_RECV) {
+            panic("sys_ipc_try_send failed: %i", res);
+        }
+        sys_yield();
+  802bbf:	49 bf f2 01 80 00 00 	movabs $0x8001f2,%r15
+  802bc6:	00 00 00 
+    while ((res = sys_ipc_try_send(to_env, val, !pg ? (void*)MAX_USER_ADDRESS : pg, size, perm)) < 0) {
+  802bc9:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  802bcc:	44 8b 45 c8          	mov    -0x38(%rbp),%r8d
+  802bd0:	4c 89 e1             	mov    %r12,%rcx
+  802bd3:	48 89 da             	mov    %rbx,%rdx
+  802bd6:	44 89 ef             	mov    %r13d,%edi
+  802bd9:	41 ff d6             	call   *%r14
+  802bdc:	85 c0                	test   %eax,%eax
+  802bde:	79 37                	jns    802c17 <ipc_send+0x94>
+        if (res != -E_IPC_NOT_RECV) {
+  802be0:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  802be3:	75 05                	jne    802bea <ipc_send+0x67>
+        sys_yield();
+  802be5:	41 ff d7             	call   *%r15
+  802be8:	eb df                	jmp    802bc9 <ipc_send+0x46>
+            panic("sys_ipc_try_send failed: %i", res);
+  802bea:	89 c1                	mov    %eax,%ecx
+  802bec:	48 ba 2f 33 80 00 00 	movabs $0x80332f,%rdx
+  802bf3:	00 00 00 
+  802bf6:	be 40 00 00 00       	mov    $0x40,%esi
+  802bfb:	48 bf 4b 33 80 00 00 	movabs $0x80334b,%rdi
+  802c02:	00 00 00 
+  802c05:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c0a:	49 b8 12 1c 80 00 00 	movabs $0x801c12,%r8
+  802c11:	00 00 00 
+  802c14:	41 ff d0             	call   *%r8
+    }
+    return;
+}
+  802c17:	48 83 c4 18          	add    $0x18,%rsp
+  802c1b:	5b                   	pop    %rbx
+  802c1c:	41 5c                	pop    %r12
+  802c1e:	41 5d                	pop    %r13
+  802c20:	41 5e                	pop    %r14
+  802c22:	41 5f                	pop    %r15
+  802c24:	5d                   	pop    %rbp
+  802c25:	c3                   	ret
+
+0000000000802c26 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  802c26:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  802c2b:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  802c32:	00 00 00 
+  802c35:	48 69 d0 d0 01 00 00 	imul   $0x1d0,%rax,%rdx
+  802c3c:	48 01 ca             	add    %rcx,%rdx
+  802c3f:	8b 92 e8 00 00 00    	mov    0xe8(%rdx),%edx
+  802c45:	39 fa                	cmp    %edi,%edx
+  802c47:	74 12                	je     802c5b <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  802c49:	48 83 c0 01          	add    $0x1,%rax
+  802c4d:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  802c53:	75 e0                	jne    802c35 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  802c55:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802c5a:	c3                   	ret
+            return envs[i].env_id;
+  802c5b:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+  802c62:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  802c69:	00 00 00 
+  802c6c:	48 01 d0             	add    %rdx,%rax
+  802c6f:	8b 80 e0 00 00 00    	mov    0xe0(%rax),%eax
+  802c75:	c3                   	ret
+  802c76:	66 90                	xchg   %ax,%ax
+
+0000000000802c78 <__rodata_start>:
+  802c78:	3c 75                	cmp    $0x75,%al
+  802c7a:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802c7b:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  802c7f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802c80:	3e 00 66 0f          	ds add %ah,0xf(%rsi)
+  802c84:	1f                   	(bad)
+  802c85:	44 00 00             	add    %r8b,(%rax)
+  802c88:	73 79                	jae    802d03 <__rodata_start+0x8b>
+  802c8a:	73 63                	jae    802cef <__rodata_start+0x77>
+  802c8c:	61                   	(bad)
+  802c8d:	6c                   	insb   (%dx),%es:(%rdi)
+  802c8e:	6c                   	insb   (%dx),%es:(%rdi)
+  802c8f:	20 25 7a 64 20 72    	and    %ah,0x7220647a(%rip)        # 72a0910f <__bss_end+0x7220110f>
+  802c95:	65 74 75             	gs je  802d0d <__rodata_start+0x95>
+  802c98:	72 6e                	jb     802d08 <__rodata_start+0x90>
+  802c9a:	65 64 20 25 7a 64 20 	gs and %ah,%fs:0x2820647a(%rip)        # 28a0911c <__bss_end+0x2820111c>
+  802ca1:	28 
+  802ca2:	3e 20 30             	ds and %dh,(%rax)
+  802ca5:	29 00                	sub    %eax,(%rax)
+  802ca7:	6c                   	insb   (%dx),%es:(%rdi)
+  802ca8:	69 62 2f 73 79 73 63 	imul   $0x63737973,0x2f(%rdx),%esp
+  802caf:	61                   	(bad)
+  802cb0:	6c                   	insb   (%dx),%es:(%rdi)
+  802cb1:	6c                   	insb   (%dx),%es:(%rdi)
+  802cb2:	2e 63 00             	cs movsxd (%rax),%eax
+  802cb5:	0f 1f 00             	nopl   (%rax)
+  802cb8:	5b                   	pop    %rbx
+  802cb9:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  802cbe:	20 75 6e             	and    %dh,0x6e(%rbp)
+  802cc1:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  802cc5:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802cc6:	20 64 65 76          	and    %ah,0x76(%rbp,%riz,2)
+  802cca:	69 63 65 20 74 79 70 	imul   $0x70797420,0x65(%rbx),%esp
+  802cd1:	65 20 25 64 0a 00 00 	and    %ah,%gs:0xa64(%rip)        # 80373c <error_string+0x4dc>
+  802cd8:	5b                   	pop    %rbx
+  802cd9:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  802cde:	20 66 74             	and    %ah,0x74(%rsi)
+  802ce1:	72 75                	jb     802d58 <devtab+0x18>
+  802ce3:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802ce4:	63 61 74             	movsxd 0x74(%rcx),%esp
+  802ce7:	65 20 25 64 20 2d 2d 	and    %ah,%gs:0x2d2d2064(%rip)        # 2dad4d52 <__bss_end+0x2d2ccd52>
+  802cee:	20 62 61             	and    %ah,0x61(%rdx)
+  802cf1:	64 20 6d 6f          	and    %ch,%fs:0x6f(%rbp)
+  802cf5:	64 65 0a 00          	fs or  %gs:(%rax),%al
+  802cf9:	5b                   	pop    %rbx
+  802cfa:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  802cff:	20 72 65             	and    %dh,0x65(%rdx)
+  802d02:	61                   	(bad)
+  802d03:	64 20 25 64 20 2d 2d 	and    %ah,%fs:0x2d2d2064(%rip)        # 2dad4d6e <__bss_end+0x2d2ccd6e>
+  802d0a:	20 62 61             	and    %ah,0x61(%rdx)
+  802d0d:	64 20 6d 6f          	and    %ch,%fs:0x6f(%rbp)
+  802d11:	64 65 0a 00          	fs or  %gs:(%rax),%al
+  802d15:	5b                   	pop    %rbx
+  802d16:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  802d1b:	20 77 72             	and    %dh,0x72(%rdi)
+  802d1e:	69 74 65 20 25 64 20 	imul   $0x2d206425,0x20(%rbp,%riz,2),%esi
+  802d25:	2d 
+  802d26:	2d 20 62 61 64       	sub    $0x64616220,%eax
+  802d2b:	20 6d 6f             	and    %ch,0x6f(%rbp)
+  802d2e:	64 65 0a 00          	fs or  %gs:(%rax),%al
+  802d32:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  802d39:	00 00 00 
+  802d3c:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000802d40 <devtab>:
+  802d40:	20 40 80 00 00 00 00 00 60 40 80 00 00 00 00 00      @......`@......
+  802d50:	a0 40 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .@..............
+  802d60:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  802d70:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  802d80:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  802d90:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  802da0:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  802db0:	3d 20 32 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73 00     = 2.<cons>.cons.
+  802dc0:	5b 25 30 38 78 5d 20 75 73 65 72 20 70 61 6e 69     [%08x] user pani
+  802dd0:	63 20 69 6e 20 25 73 20 61 74 20 25 73 3a 25 64     c in %s at %s:%d
+  802de0:	3a 20 00 30 31 32 33 34 35 36 37 38 39 41 42 43     : .0123456789ABC
+  802df0:	44 45 46 00 30 31 32 33 34 35 36 37 38 39 61 62     DEF.0123456789ab
+  802e00:	63 64 65 66 00 28 6e 75 6c 6c 29 00 65 72 72 6f     cdef.(null).erro
+  802e10:	72 20 25 64 00 75 6e 73 70 65 63 69 66 69 65 64     r %d.unspecified
+  802e20:	20 65 72 72 6f 72 00 62 61 64 20 65 6e 76 69 72      error.bad envir
+  802e30:	6f 6e 6d 65 6e 74 00 69 6e 76 61 6c 69 64 20 70     onment.invalid p
+  802e40:	61 72 61 6d 65 74 65 72 00 6f 75 74 20 6f 66 20     arameter.out of 
+  802e50:	6d 65 6d 6f 72 79 00 6f 75 74 20 6f 66 20 65 6e     memory.out of en
+  802e60:	76 69 72 6f 6e 6d 65 6e 74 73 00 63 6f 72 72 75     vironments.corru
+  802e70:	70 74 65 64 20 64 65 62 75 67 20 69 6e 66 6f 00     pted debug info.
+  802e80:	73 65 67 6d 65 6e 74 61 74 69 6f 6e 20 66 61 75     segmentation fau
+  802e90:	6c 74 00 69 6e 76 61 6c 69 64 20 45 4c 46 20 69     lt.invalid ELF i
+  802ea0:	6d 61 67 65 00 6e 6f 20 73 75 63 68 20 73 79 73     mage.no such sys
+  802eb0:	74 65 6d 20 63 61 6c 6c 00 65 6e 74 72 79 20 6e     tem call.entry n
+  802ec0:	6f 74 20 66 6f 75 6e 64 00 65 6e 76 20 69 73 20     ot found.env is 
+  802ed0:	6e 6f 74 20 72 65 63 76 69 6e 67 00 75 6e 65 78     not recving.unex
+  802ee0:	70 65 63 74 65 64 20 65 6e 64 20 6f 66 20 66 69     pected end of fi
+  802ef0:	6c 65 00 6e 6f 20 66 72 65 65 20 73 70 61 63 65     le.no free space
+  802f00:	20 6f 6e 20 64 69 73 6b 00 74 6f 6f 20 6d 61 6e      on disk.too man
+  802f10:	79 20 66 69 6c 65 73 20 61 72 65 20 6f 70 65 6e     y files are open
+  802f20:	00 66 69 6c 65 20 6f 72 20 62 6c 6f 63 6b 20 6e     .file or block n
+  802f30:	6f 74 20 66 6f 75 6e 64 00 69 6e 76 61 6c 69 64     ot found.invalid
+  802f40:	20 70 61 74 68 00 66 69 6c 65 20 61 6c 72 65 61      path.file alrea
+  802f50:	64 79 20 65 78 69 73 74 73 00 6f 70 65 72 61 74     dy exists.operat
+  802f60:	69 6f 6e 20 6e 6f 74 20 73 75 70 70 6f 72 74 65     ion not supporte
+  802f70:	64 00 6f 70 65 72 61 74 69 6f 6e 20 69 6e 74 65     d.operation inte
+  802f80:	72 72 75 70 74 65 64 00 6e 6f 74 20 65 6e 6f 75     rrupted.not enou
+  802f90:	67 68 20 43 50 55 20 74 69 6d 65 00 0f 1f 40 00     gh CPU time...@.
+  802fa0:	4f 1f 80 00 00 00 00 00 90 25 80 00 00 00 00 00     O........%......
+  802fb0:	80 25 80 00 00 00 00 00 90 25 80 00 00 00 00 00     .%.......%......
+  802fc0:	90 25 80 00 00 00 00 00 90 25 80 00 00 00 00 00     .%.......%......
+  802fd0:	90 25 80 00 00 00 00 00 6e 1f 80 00 00 00 00 00     .%......n.......
+  802fe0:	90 25 80 00 00 00 00 00 90 25 80 00 00 00 00 00     .%.......%......
+  802ff0:	62 1f 80 00 00 00 00 00 dc 1f 80 00 00 00 00 00     b...............
+  803000:	90 25 80 00 00 00 00 00 62 1f 80 00 00 00 00 00     .%......b.......
+  803010:	a8 1f 80 00 00 00 00 00 a8 1f 80 00 00 00 00 00     ................
+  803020:	a8 1f 80 00 00 00 00 00 a8 1f 80 00 00 00 00 00     ................
+  803030:	a8 1f 80 00 00 00 00 00 a8 1f 80 00 00 00 00 00     ................
+  803040:	a8 1f 80 00 00 00 00 00 a8 1f 80 00 00 00 00 00     ................
+  803050:	a8 1f 80 00 00 00 00 00 90 25 80 00 00 00 00 00     .........%......
+  803060:	90 25 80 00 00 00 00 00 90 25 80 00 00 00 00 00     .%.......%......
+  803070:	90 25 80 00 00 00 00 00 90 25 80 00 00 00 00 00     .%.......%......
+  803080:	90 25 80 00 00 00 00 00 90 25 80 00 00 00 00 00     .%.......%......
+  803090:	90 25 80 00 00 00 00 00 90 25 80 00 00 00 00 00     .%.......%......
+  8030a0:	90 25 80 00 00 00 00 00 90 25 80 00 00 00 00 00     .%.......%......
+  8030b0:	90 25 80 00 00 00 00 00 90 25 80 00 00 00 00 00     .%.......%......
+  8030c0:	90 25 80 00 00 00 00 00 90 25 80 00 00 00 00 00     .%.......%......
+  8030d0:	90 25 80 00 00 00 00 00 90 25 80 00 00 00 00 00     .%.......%......
+  8030e0:	90 25 80 00 00 00 00 00 90 25 80 00 00 00 00 00     .%.......%......
+  8030f0:	90 25 80 00 00 00 00 00 90 25 80 00 00 00 00 00     .%.......%......
+  803100:	90 25 80 00 00 00 00 00 90 25 80 00 00 00 00 00     .%.......%......
+  803110:	90 25 80 00 00 00 00 00 90 25 80 00 00 00 00 00     .%.......%......
+  803120:	90 25 80 00 00 00 00 00 90 25 80 00 00 00 00 00     .%.......%......
+  803130:	90 25 80 00 00 00 00 00 90 25 80 00 00 00 00 00     .%.......%......
+  803140:	90 25 80 00 00 00 00 00 b3 24 80 00 00 00 00 00     .%.......$......
+  803150:	90 25 80 00 00 00 00 00 90 25 80 00 00 00 00 00     .%.......%......
+  803160:	90 25 80 00 00 00 00 00 90 25 80 00 00 00 00 00     .%.......%......
+  803170:	90 25 80 00 00 00 00 00 90 25 80 00 00 00 00 00     .%.......%......
+  803180:	90 25 80 00 00 00 00 00 90 25 80 00 00 00 00 00     .%.......%......
+  803190:	90 25 80 00 00 00 00 00 90 25 80 00 00 00 00 00     .%.......%......
+  8031a0:	ff 1f 80 00 00 00 00 00 ce 21 80 00 00 00 00 00     .........!......
+  8031b0:	90 25 80 00 00 00 00 00 90 25 80 00 00 00 00 00     .%.......%......
+  8031c0:	90 25 80 00 00 00 00 00 90 25 80 00 00 00 00 00     .%.......%......
+  8031d0:	2e 20 80 00 00 00 00 00 90 25 80 00 00 00 00 00     . .......%......
+  8031e0:	90 25 80 00 00 00 00 00 f4 1f 80 00 00 00 00 00     .%..............
+  8031f0:	90 25 80 00 00 00 00 00 90 25 80 00 00 00 00 00     .%.......%......
+  803200:	76 23 80 00 00 00 00 00 40 24 80 00 00 00 00 00     v#......@$......
+  803210:	90 25 80 00 00 00 00 00 90 25 80 00 00 00 00 00     .%.......%......
+  803220:	c5 20 80 00 00 00 00 00 90 25 80 00 00 00 00 00     . .......%......
+  803230:	a2 22 80 00 00 00 00 00 90 25 80 00 00 00 00 00     .".......%......
+  803240:	90 25 80 00 00 00 00 00 b3 24 80 00 00 00 00 00     .%.......$......
+  803250:	90 25 80 00 00 00 00 00 58 1f 80 00 00 00 00 00     .%......X.......
+
+0000000000803260 <error_string>:
+	...
+  803268:	15 2e 80 00 00 00 00 00 27 2e 80 00 00 00 00 00     ........'.......
+  803278:	37 2e 80 00 00 00 00 00 49 2e 80 00 00 00 00 00     7.......I.......
+  803288:	57 2e 80 00 00 00 00 00 6b 2e 80 00 00 00 00 00     W.......k.......
+  803298:	80 2e 80 00 00 00 00 00 93 2e 80 00 00 00 00 00     ................
+  8032a8:	a5 2e 80 00 00 00 00 00 b9 2e 80 00 00 00 00 00     ................
+  8032b8:	c9 2e 80 00 00 00 00 00 dc 2e 80 00 00 00 00 00     ................
+  8032c8:	f3 2e 80 00 00 00 00 00 09 2f 80 00 00 00 00 00     ........./......
+  8032d8:	21 2f 80 00 00 00 00 00 39 2f 80 00 00 00 00 00     !/......9/......
+  8032e8:	46 2f 80 00 00 00 00 00 10 33 80 00 00 00 00 00     F/.......3......
+  8032f8:	5a 2f 80 00 00 00 00 00 72 2f 80 00 00 00 00 00     Z/......r/......
+  803308:	88 2f 80 00 00 00 00 00 66 69 6c 65 20 69 73 20     ./......file is 
+  803318:	6e 6f 74 20 61 20 76 61 6c 69 64 20 65 78 65 63     not a valid exec
+  803328:	75 74 61 62 6c 65 00 73 79 73 5f 69 70 63 5f 74     utable.sys_ipc_t
+  803338:	72 79 5f 73 65 6e 64 20 66 61 69 6c 65 64 3a 20     ry_send failed: 
+  803348:	25 69 00 6c 69 62 2f 69 70 63 2e 63 00 66 2e 0f     %i.lib/ipc.c.f..
+  803358:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803368:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803378:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803388:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803398:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8033a8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8033b8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8033c8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8033d8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8033e8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8033f8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803408:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803418:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803428:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803438:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803448:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803458:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803468:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803478:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803488:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803498:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8034a8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8034b8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8034c8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8034d8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8034e8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8034f8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803508:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803518:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803528:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803538:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803548:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803558:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803568:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803578:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803588:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803598:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8035a8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8035b8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8035c8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8035d8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8035e8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8035f8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803608:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803618:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803628:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803638:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803648:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803658:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803668:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803678:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803688:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803698:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8036a8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8036b8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8036c8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8036d8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8036e8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8036f8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803708:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803718:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803728:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803738:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803748:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803758:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803768:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803778:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803788:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803798:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8037a8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8037b8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8037c8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8037d8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8037e8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8037f8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803808:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803818:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803828:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803838:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803848:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803858:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803868:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803878:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803888:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803898:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8038a8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8038b8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8038c8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8038d8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8038e8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8038f8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803908:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803918:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803928:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803938:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803948:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803958:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803968:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803978:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803988:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803998:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8039a8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8039b8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8039c8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8039d8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8039e8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8039f8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803a08:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803a18:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803a28:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803a38:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803a48:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803a58:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803a68:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803a78:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803a88:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803a98:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803aa8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803ab8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803ac8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803ad8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803ae8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803af8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803b08:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803b18:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803b28:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803b38:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803b48:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803b58:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803b68:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803b78:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803b88:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803b98:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803ba8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803bb8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803bc8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803bd8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803be8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803bf8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803c08:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803c18:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803c28:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803c38:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803c48:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803c58:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803c68:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803c78:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803c88:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803c98:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803ca8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803cb8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803cc8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803cd8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803ce8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803cf8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803d08:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803d18:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803d28:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803d38:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803d48:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803d58:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803d68:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803d78:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803d88:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803d98:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803da8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803db8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803dc8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803dd8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803de8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803df8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803e08:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803e18:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803e28:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803e38:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803e48:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803e58:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803e68:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803e78:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803e88:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803e98:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803ea8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803eb8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803ec8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803ed8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803ee8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803ef8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803f08:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803f18:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803f28:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803f38:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803f48:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803f58:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803f68:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803f78:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803f88:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803f98:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803fa8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803fb8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803fc8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803fd8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803fe8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803ff8:	00 00 00 00 00 0f 1f 00                             ........
@@ -0,0 +1,5772 @@
+
+obj/user/bounds:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 3a 00 00 00       	call   80005d <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+/* Test for UBSAN support - accessing array element with an out-of-borders index */
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	48 83 ec 10          	sub    $0x10,%rsp
+    int a[4] = {0};
+    /* Trying to print the value of the fifth element of the array (which causes undefined behavior).
+     * The "cprintf" function is sanitized by UBSAN because lib/Makefrag accesses the USER_SAN_CFLAGS variable.
+     * The access operator ([]) is not used because it will trigger -Warray-bounds option of Clang,
+     * which will make this test unrunnable because of -Werror flag which is specified in GNUmakefile. */
+    cprintf("%d\n", *(a + 5));
+  80002d:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  800034:	00 
+  800035:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  80003c:	00 
+  80003d:	8b 75 04             	mov    0x4(%rbp),%esi
+  800040:	48 bf a8 2c 80 00 00 	movabs $0x802ca8,%rdi
+  800047:	00 00 00 
+  80004a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80004f:	48 ba d6 01 80 00 00 	movabs $0x8001d6,%rdx
+  800056:	00 00 00 
+  800059:	ff d2                	call   *%rdx
+}
+  80005b:	c9                   	leave
+  80005c:	c3                   	ret
+
+000000000080005d <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  80005d:	55                   	push   %rbp
+  80005e:	48 89 e5             	mov    %rsp,%rbp
+  800061:	41 56                	push   %r14
+  800063:	41 55                	push   %r13
+  800065:	41 54                	push   %r12
+  800067:	53                   	push   %rbx
+  800068:	41 89 fd             	mov    %edi,%r13d
+  80006b:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  80006e:	48 ba d8 40 80 00 00 	movabs $0x8040d8,%rdx
+  800075:	00 00 00 
+  800078:	48 b8 d8 40 80 00 00 	movabs $0x8040d8,%rax
+  80007f:	00 00 00 
+  800082:	48 39 c2             	cmp    %rax,%rdx
+  800085:	73 17                	jae    80009e <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  800087:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  80008a:	49 89 c4             	mov    %rax,%r12
+  80008d:	48 83 c3 08          	add    $0x8,%rbx
+  800091:	b8 00 00 00 00       	mov    $0x0,%eax
+  800096:	ff 53 f8             	call   *-0x8(%rbx)
+  800099:	4c 39 e3             	cmp    %r12,%rbx
+  80009c:	72 ef                	jb     80008d <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+    envid_t this_env_id = sys_getenvid();
+  80009e:	48 b8 eb 0f 80 00 00 	movabs $0x800feb,%rax
+  8000a5:	00 00 00 
+  8000a8:	ff d0                	call   *%rax
+    thisenv = &((struct Env*)UENVS)[ENVX(this_env_id)];
+  8000aa:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8000af:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+  8000b6:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8000bd:	00 00 00 
+  8000c0:	48 01 d0             	add    %rdx,%rax
+  8000c3:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  8000ca:	00 00 00 
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8000cd:	45 85 ed             	test   %r13d,%r13d
+  8000d0:	7e 0d                	jle    8000df <libmain+0x82>
+  8000d2:	49 8b 06             	mov    (%r14),%rax
+  8000d5:	48 a3 00 40 80 00 00 	movabs %rax,0x804000
+  8000dc:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8000df:	4c 89 f6             	mov    %r14,%rsi
+  8000e2:	44 89 ef             	mov    %r13d,%edi
+  8000e5:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8000ec:	00 00 00 
+  8000ef:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8000f1:	48 b8 06 01 80 00 00 	movabs $0x800106,%rax
+  8000f8:	00 00 00 
+  8000fb:	ff d0                	call   *%rax
+#endif
+}
+  8000fd:	5b                   	pop    %rbx
+  8000fe:	41 5c                	pop    %r12
+  800100:	41 5d                	pop    %r13
+  800102:	41 5e                	pop    %r14
+  800104:	5d                   	pop    %rbp
+  800105:	c3                   	ret
+
+0000000000800106 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  800106:	55                   	push   %rbp
+  800107:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  80010a:	48 b8 3f 17 80 00 00 	movabs $0x80173f,%rax
+  800111:	00 00 00 
+  800114:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  800116:	bf 00 00 00 00       	mov    $0x0,%edi
+  80011b:	48 b8 80 0f 80 00 00 	movabs $0x800f80,%rax
+  800122:	00 00 00 
+  800125:	ff d0                	call   *%rax
+}
+  800127:	5d                   	pop    %rbp
+  800128:	c3                   	ret
+
+0000000000800129 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  800129:	55                   	push   %rbp
+  80012a:	48 89 e5             	mov    %rsp,%rbp
+  80012d:	53                   	push   %rbx
+  80012e:	48 83 ec 08          	sub    $0x8,%rsp
+  800132:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  800135:	8b 06                	mov    (%rsi),%eax
+  800137:	8d 50 01             	lea    0x1(%rax),%edx
+  80013a:	89 16                	mov    %edx,(%rsi)
+  80013c:	48 98                	cltq
+  80013e:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  800143:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  800149:	74 0a                	je     800155 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  80014b:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  80014f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800153:	c9                   	leave
+  800154:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  800155:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  800159:	be ff 00 00 00       	mov    $0xff,%esi
+  80015e:	48 b8 22 0f 80 00 00 	movabs $0x800f22,%rax
+  800165:	00 00 00 
+  800168:	ff d0                	call   *%rax
+        state->offset = 0;
+  80016a:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  800170:	eb d9                	jmp    80014b <putch+0x22>
+
+0000000000800172 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  800172:	55                   	push   %rbp
+  800173:	48 89 e5             	mov    %rsp,%rbp
+  800176:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  80017d:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  800180:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  800187:	b9 21 00 00 00       	mov    $0x21,%ecx
+  80018c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800191:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  800194:	48 89 f1             	mov    %rsi,%rcx
+  800197:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  80019e:	48 bf 29 01 80 00 00 	movabs $0x800129,%rdi
+  8001a5:	00 00 00 
+  8001a8:	48 b8 26 03 80 00 00 	movabs $0x800326,%rax
+  8001af:	00 00 00 
+  8001b2:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  8001b4:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  8001bb:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  8001c2:	48 b8 22 0f 80 00 00 	movabs $0x800f22,%rax
+  8001c9:	00 00 00 
+  8001cc:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  8001ce:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  8001d4:	c9                   	leave
+  8001d5:	c3                   	ret
+
+00000000008001d6 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  8001d6:	55                   	push   %rbp
+  8001d7:	48 89 e5             	mov    %rsp,%rbp
+  8001da:	48 83 ec 50          	sub    $0x50,%rsp
+  8001de:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8001e2:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8001e6:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8001ea:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8001ee:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  8001f2:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  8001f9:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8001fd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800201:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800205:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  800209:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  80020d:	48 b8 72 01 80 00 00 	movabs $0x800172,%rax
+  800214:	00 00 00 
+  800217:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  800219:	c9                   	leave
+  80021a:	c3                   	ret
+
+000000000080021b <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  80021b:	55                   	push   %rbp
+  80021c:	48 89 e5             	mov    %rsp,%rbp
+  80021f:	41 57                	push   %r15
+  800221:	41 56                	push   %r14
+  800223:	41 55                	push   %r13
+  800225:	41 54                	push   %r12
+  800227:	53                   	push   %rbx
+  800228:	48 83 ec 18          	sub    $0x18,%rsp
+  80022c:	49 89 fc             	mov    %rdi,%r12
+  80022f:	49 89 f5             	mov    %rsi,%r13
+  800232:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800236:	8b 45 10             	mov    0x10(%rbp),%eax
+  800239:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  80023c:	41 89 cf             	mov    %ecx,%r15d
+  80023f:	4c 39 fa             	cmp    %r15,%rdx
+  800242:	73 5b                	jae    80029f <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  800244:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  800248:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  80024c:	85 db                	test   %ebx,%ebx
+  80024e:	7e 0e                	jle    80025e <print_num+0x43>
+            putch(padc, put_arg);
+  800250:	4c 89 ee             	mov    %r13,%rsi
+  800253:	44 89 f7             	mov    %r14d,%edi
+  800256:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  800259:	83 eb 01             	sub    $0x1,%ebx
+  80025c:	75 f2                	jne    800250 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  80025e:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  800262:	48 b9 c7 2c 80 00 00 	movabs $0x802cc7,%rcx
+  800269:	00 00 00 
+  80026c:	48 b8 b6 2c 80 00 00 	movabs $0x802cb6,%rax
+  800273:	00 00 00 
+  800276:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  80027a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80027e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800283:	49 f7 f7             	div    %r15
+  800286:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  80028a:	4c 89 ee             	mov    %r13,%rsi
+  80028d:	41 ff d4             	call   *%r12
+}
+  800290:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800294:	5b                   	pop    %rbx
+  800295:	41 5c                	pop    %r12
+  800297:	41 5d                	pop    %r13
+  800299:	41 5e                	pop    %r14
+  80029b:	41 5f                	pop    %r15
+  80029d:	5d                   	pop    %rbp
+  80029e:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  80029f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8002a3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8002a8:	49 f7 f7             	div    %r15
+  8002ab:	48 83 ec 08          	sub    $0x8,%rsp
+  8002af:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  8002b3:	52                   	push   %rdx
+  8002b4:	45 0f be c9          	movsbl %r9b,%r9d
+  8002b8:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  8002bc:	48 89 c2             	mov    %rax,%rdx
+  8002bf:	48 b8 1b 02 80 00 00 	movabs $0x80021b,%rax
+  8002c6:	00 00 00 
+  8002c9:	ff d0                	call   *%rax
+  8002cb:	48 83 c4 10          	add    $0x10,%rsp
+  8002cf:	eb 8d                	jmp    80025e <print_num+0x43>
+
+00000000008002d1 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  8002d1:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  8002d5:	48 8b 06             	mov    (%rsi),%rax
+  8002d8:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  8002dc:	73 0a                	jae    8002e8 <sprintputch+0x17>
+        *state->start++ = ch;
+  8002de:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8002e2:	48 89 16             	mov    %rdx,(%rsi)
+  8002e5:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  8002e8:	c3                   	ret
+
+00000000008002e9 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  8002e9:	55                   	push   %rbp
+  8002ea:	48 89 e5             	mov    %rsp,%rbp
+  8002ed:	48 83 ec 50          	sub    $0x50,%rsp
+  8002f1:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8002f5:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8002f9:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  8002fd:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800304:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800308:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80030c:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800310:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  800314:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800318:	48 b8 26 03 80 00 00 	movabs $0x800326,%rax
+  80031f:	00 00 00 
+  800322:	ff d0                	call   *%rax
+}
+  800324:	c9                   	leave
+  800325:	c3                   	ret
+
+0000000000800326 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  800326:	55                   	push   %rbp
+  800327:	48 89 e5             	mov    %rsp,%rbp
+  80032a:	41 57                	push   %r15
+  80032c:	41 56                	push   %r14
+  80032e:	41 55                	push   %r13
+  800330:	41 54                	push   %r12
+  800332:	53                   	push   %rbx
+  800333:	48 83 ec 38          	sub    $0x38,%rsp
+  800337:	49 89 fe             	mov    %rdi,%r14
+  80033a:	49 89 f5             	mov    %rsi,%r13
+  80033d:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  800340:	48 8b 01             	mov    (%rcx),%rax
+  800343:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  800347:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  80034b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80034f:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  800353:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  800357:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  80035b:	0f b6 3b             	movzbl (%rbx),%edi
+  80035e:	40 80 ff 25          	cmp    $0x25,%dil
+  800362:	74 18                	je     80037c <vprintfmt+0x56>
+            if (!ch) return;
+  800364:	40 84 ff             	test   %dil,%dil
+  800367:	0f 84 b1 06 00 00    	je     800a1e <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  80036d:	40 0f b6 ff          	movzbl %dil,%edi
+  800371:	4c 89 ee             	mov    %r13,%rsi
+  800374:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  800377:	4c 89 e3             	mov    %r12,%rbx
+  80037a:	eb db                	jmp    800357 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  80037c:	be 00 00 00 00       	mov    $0x0,%esi
+  800381:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  800385:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  80038a:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800390:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  800397:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  80039b:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  8003a0:	41 0f b6 04 24       	movzbl (%r12),%eax
+  8003a5:	88 45 a0             	mov    %al,-0x60(%rbp)
+  8003a8:	83 e8 23             	sub    $0x23,%eax
+  8003ab:	3c 57                	cmp    $0x57,%al
+  8003ad:	0f 87 51 06 00 00    	ja     800a04 <vprintfmt+0x6de>
+  8003b3:	0f b6 c0             	movzbl %al,%eax
+  8003b6:	48 b9 80 2e 80 00 00 	movabs $0x802e80,%rcx
+  8003bd:	00 00 00 
+  8003c0:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  8003c3:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  8003c6:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  8003ca:	eb cf                	jmp    80039b <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  8003cc:	49 89 dc             	mov    %rbx,%r12
+  8003cf:	be 01 00 00 00       	mov    $0x1,%esi
+  8003d4:	eb c5                	jmp    80039b <vprintfmt+0x75>
+            padc = ch;
+  8003d6:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  8003da:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8003dd:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8003e0:	eb b9                	jmp    80039b <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8003e2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8003e5:	83 f8 2f             	cmp    $0x2f,%eax
+  8003e8:	77 24                	ja     80040e <vprintfmt+0xe8>
+  8003ea:	89 c1                	mov    %eax,%ecx
+  8003ec:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  8003f0:	83 c0 08             	add    $0x8,%eax
+  8003f3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8003f6:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  8003f9:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  8003fc:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800400:	79 99                	jns    80039b <vprintfmt+0x75>
+                width = precision;
+  800402:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  800406:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  80040c:	eb 8d                	jmp    80039b <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  80040e:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  800412:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  800416:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80041a:	eb da                	jmp    8003f6 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  80041c:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  800421:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800425:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  80042b:	3c 39                	cmp    $0x39,%al
+  80042d:	77 1c                	ja     80044b <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  80042f:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  800433:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  800437:	0f b6 c0             	movzbl %al,%eax
+  80043a:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  80043f:	0f b6 03             	movzbl (%rbx),%eax
+  800442:	3c 39                	cmp    $0x39,%al
+  800444:	76 e9                	jbe    80042f <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  800446:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  800449:	eb b1                	jmp    8003fc <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  80044b:	49 89 dc             	mov    %rbx,%r12
+  80044e:	eb ac                	jmp    8003fc <vprintfmt+0xd6>
+            width = MAX(0, width);
+  800450:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  800453:	85 c9                	test   %ecx,%ecx
+  800455:	b8 00 00 00 00       	mov    $0x0,%eax
+  80045a:	0f 49 c1             	cmovns %ecx,%eax
+  80045d:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  800460:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800463:	e9 33 ff ff ff       	jmp    80039b <vprintfmt+0x75>
+            lflag++;
+  800468:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  80046b:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80046e:	e9 28 ff ff ff       	jmp    80039b <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  800473:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800476:	83 f8 2f             	cmp    $0x2f,%eax
+  800479:	77 19                	ja     800494 <vprintfmt+0x16e>
+  80047b:	89 c2                	mov    %eax,%edx
+  80047d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800481:	83 c0 08             	add    $0x8,%eax
+  800484:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800487:	8b 3a                	mov    (%rdx),%edi
+  800489:	4c 89 ee             	mov    %r13,%rsi
+  80048c:	41 ff d6             	call   *%r14
+            break;
+  80048f:	e9 c3 fe ff ff       	jmp    800357 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  800494:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800498:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80049c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8004a0:	eb e5                	jmp    800487 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  8004a2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8004a5:	83 f8 2f             	cmp    $0x2f,%eax
+  8004a8:	77 5a                	ja     800504 <vprintfmt+0x1de>
+  8004aa:	89 c2                	mov    %eax,%edx
+  8004ac:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8004b0:	83 c0 08             	add    $0x8,%eax
+  8004b3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  8004b6:	8b 02                	mov    (%rdx),%eax
+  8004b8:	89 c1                	mov    %eax,%ecx
+  8004ba:	f7 d9                	neg    %ecx
+  8004bc:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  8004bf:	83 f9 15             	cmp    $0x15,%ecx
+  8004c2:	7f 4e                	jg     800512 <vprintfmt+0x1ec>
+  8004c4:	48 63 c1             	movslq %ecx,%rax
+  8004c7:	48 ba 40 31 80 00 00 	movabs $0x803140,%rdx
+  8004ce:	00 00 00 
+  8004d1:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8004d5:	48 85 c0             	test   %rax,%rax
+  8004d8:	74 38                	je     800512 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  8004da:	48 89 c1             	mov    %rax,%rcx
+  8004dd:	48 ba f9 32 80 00 00 	movabs $0x8032f9,%rdx
+  8004e4:	00 00 00 
+  8004e7:	4c 89 ee             	mov    %r13,%rsi
+  8004ea:	4c 89 f7             	mov    %r14,%rdi
+  8004ed:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004f2:	49 b8 e9 02 80 00 00 	movabs $0x8002e9,%r8
+  8004f9:	00 00 00 
+  8004fc:	41 ff d0             	call   *%r8
+  8004ff:	e9 53 fe ff ff       	jmp    800357 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  800504:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800508:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80050c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800510:	eb a4                	jmp    8004b6 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  800512:	48 ba df 2c 80 00 00 	movabs $0x802cdf,%rdx
+  800519:	00 00 00 
+  80051c:	4c 89 ee             	mov    %r13,%rsi
+  80051f:	4c 89 f7             	mov    %r14,%rdi
+  800522:	b8 00 00 00 00       	mov    $0x0,%eax
+  800527:	49 b8 e9 02 80 00 00 	movabs $0x8002e9,%r8
+  80052e:	00 00 00 
+  800531:	41 ff d0             	call   *%r8
+  800534:	e9 1e fe ff ff       	jmp    800357 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800539:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80053c:	83 f8 2f             	cmp    $0x2f,%eax
+  80053f:	77 6c                	ja     8005ad <vprintfmt+0x287>
+  800541:	89 c2                	mov    %eax,%edx
+  800543:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800547:	83 c0 08             	add    $0x8,%eax
+  80054a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80054d:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  800550:	48 85 d2             	test   %rdx,%rdx
+  800553:	48 b8 d8 2c 80 00 00 	movabs $0x802cd8,%rax
+  80055a:	00 00 00 
+  80055d:	48 0f 45 c2          	cmovne %rdx,%rax
+  800561:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  800565:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800569:	7e 06                	jle    800571 <vprintfmt+0x24b>
+  80056b:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  80056f:	75 4a                	jne    8005bb <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800571:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800575:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  800579:	0f b6 00             	movzbl (%rax),%eax
+  80057c:	84 c0                	test   %al,%al
+  80057e:	0f 85 9a 00 00 00    	jne    80061e <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  800584:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800587:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  80058b:	85 c0                	test   %eax,%eax
+  80058d:	0f 8e c4 fd ff ff    	jle    800357 <vprintfmt+0x31>
+  800593:	4c 89 ee             	mov    %r13,%rsi
+  800596:	bf 20 00 00 00       	mov    $0x20,%edi
+  80059b:	41 ff d6             	call   *%r14
+  80059e:	41 83 ec 01          	sub    $0x1,%r12d
+  8005a2:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  8005a6:	75 eb                	jne    800593 <vprintfmt+0x26d>
+  8005a8:	e9 aa fd ff ff       	jmp    800357 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8005ad:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8005b1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8005b5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8005b9:	eb 92                	jmp    80054d <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  8005bb:	49 63 f7             	movslq %r15d,%rsi
+  8005be:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  8005c2:	48 b8 d8 0a 80 00 00 	movabs $0x800ad8,%rax
+  8005c9:	00 00 00 
+  8005cc:	ff d0                	call   *%rax
+  8005ce:	48 89 c2             	mov    %rax,%rdx
+  8005d1:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8005d4:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  8005d6:	8d 70 ff             	lea    -0x1(%rax),%esi
+  8005d9:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  8005dc:	85 c0                	test   %eax,%eax
+  8005de:	7e 91                	jle    800571 <vprintfmt+0x24b>
+  8005e0:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  8005e5:	4c 89 ee             	mov    %r13,%rsi
+  8005e8:	44 89 e7             	mov    %r12d,%edi
+  8005eb:	41 ff d6             	call   *%r14
+  8005ee:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8005f2:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8005f5:	83 f8 ff             	cmp    $0xffffffff,%eax
+  8005f8:	75 eb                	jne    8005e5 <vprintfmt+0x2bf>
+  8005fa:	e9 72 ff ff ff       	jmp    800571 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8005ff:	0f b6 f8             	movzbl %al,%edi
+  800602:	4c 89 ee             	mov    %r13,%rsi
+  800605:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800608:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  80060c:	49 83 c4 01          	add    $0x1,%r12
+  800610:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  800616:	84 c0                	test   %al,%al
+  800618:	0f 84 66 ff ff ff    	je     800584 <vprintfmt+0x25e>
+  80061e:	45 85 ff             	test   %r15d,%r15d
+  800621:	78 0a                	js     80062d <vprintfmt+0x307>
+  800623:	41 83 ef 01          	sub    $0x1,%r15d
+  800627:	0f 88 57 ff ff ff    	js     800584 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  80062d:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  800631:	74 cc                	je     8005ff <vprintfmt+0x2d9>
+  800633:	8d 50 e0             	lea    -0x20(%rax),%edx
+  800636:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  80063b:	80 fa 5e             	cmp    $0x5e,%dl
+  80063e:	77 c2                	ja     800602 <vprintfmt+0x2dc>
+  800640:	eb bd                	jmp    8005ff <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  800642:	40 84 f6             	test   %sil,%sil
+  800645:	75 26                	jne    80066d <vprintfmt+0x347>
+    switch (lflag) {
+  800647:	85 d2                	test   %edx,%edx
+  800649:	74 59                	je     8006a4 <vprintfmt+0x37e>
+  80064b:	83 fa 01             	cmp    $0x1,%edx
+  80064e:	74 7b                	je     8006cb <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  800650:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800653:	83 f8 2f             	cmp    $0x2f,%eax
+  800656:	0f 87 96 00 00 00    	ja     8006f2 <vprintfmt+0x3cc>
+  80065c:	89 c2                	mov    %eax,%edx
+  80065e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800662:	83 c0 08             	add    $0x8,%eax
+  800665:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800668:	4c 8b 22             	mov    (%rdx),%r12
+  80066b:	eb 17                	jmp    800684 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  80066d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800670:	83 f8 2f             	cmp    $0x2f,%eax
+  800673:	77 21                	ja     800696 <vprintfmt+0x370>
+  800675:	89 c2                	mov    %eax,%edx
+  800677:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80067b:	83 c0 08             	add    $0x8,%eax
+  80067e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800681:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  800684:	4d 85 e4             	test   %r12,%r12
+  800687:	78 7a                	js     800703 <vprintfmt+0x3dd>
+            num = i;
+  800689:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  80068c:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  800691:	e9 50 02 00 00       	jmp    8008e6 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800696:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80069a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80069e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006a2:	eb dd                	jmp    800681 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  8006a4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006a7:	83 f8 2f             	cmp    $0x2f,%eax
+  8006aa:	77 11                	ja     8006bd <vprintfmt+0x397>
+  8006ac:	89 c2                	mov    %eax,%edx
+  8006ae:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8006b2:	83 c0 08             	add    $0x8,%eax
+  8006b5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8006b8:	4c 63 22             	movslq (%rdx),%r12
+  8006bb:	eb c7                	jmp    800684 <vprintfmt+0x35e>
+  8006bd:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8006c1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006c5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006c9:	eb ed                	jmp    8006b8 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  8006cb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006ce:	83 f8 2f             	cmp    $0x2f,%eax
+  8006d1:	77 11                	ja     8006e4 <vprintfmt+0x3be>
+  8006d3:	89 c2                	mov    %eax,%edx
+  8006d5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8006d9:	83 c0 08             	add    $0x8,%eax
+  8006dc:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8006df:	4c 8b 22             	mov    (%rdx),%r12
+  8006e2:	eb a0                	jmp    800684 <vprintfmt+0x35e>
+  8006e4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8006e8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006ec:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006f0:	eb ed                	jmp    8006df <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  8006f2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8006f6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006fa:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006fe:	e9 65 ff ff ff       	jmp    800668 <vprintfmt+0x342>
+                putch('-', put_arg);
+  800703:	4c 89 ee             	mov    %r13,%rsi
+  800706:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  80070b:	41 ff d6             	call   *%r14
+                i = -i;
+  80070e:	49 f7 dc             	neg    %r12
+  800711:	e9 73 ff ff ff       	jmp    800689 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  800716:	40 84 f6             	test   %sil,%sil
+  800719:	75 32                	jne    80074d <vprintfmt+0x427>
+    switch (lflag) {
+  80071b:	85 d2                	test   %edx,%edx
+  80071d:	74 5d                	je     80077c <vprintfmt+0x456>
+  80071f:	83 fa 01             	cmp    $0x1,%edx
+  800722:	0f 84 82 00 00 00    	je     8007aa <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  800728:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80072b:	83 f8 2f             	cmp    $0x2f,%eax
+  80072e:	0f 87 a5 00 00 00    	ja     8007d9 <vprintfmt+0x4b3>
+  800734:	89 c2                	mov    %eax,%edx
+  800736:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80073a:	83 c0 08             	add    $0x8,%eax
+  80073d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800740:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800743:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  800748:	e9 99 01 00 00       	jmp    8008e6 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  80074d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800750:	83 f8 2f             	cmp    $0x2f,%eax
+  800753:	77 19                	ja     80076e <vprintfmt+0x448>
+  800755:	89 c2                	mov    %eax,%edx
+  800757:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80075b:	83 c0 08             	add    $0x8,%eax
+  80075e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800761:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800764:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800769:	e9 78 01 00 00       	jmp    8008e6 <vprintfmt+0x5c0>
+  80076e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800772:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800776:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80077a:	eb e5                	jmp    800761 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  80077c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80077f:	83 f8 2f             	cmp    $0x2f,%eax
+  800782:	77 18                	ja     80079c <vprintfmt+0x476>
+  800784:	89 c2                	mov    %eax,%edx
+  800786:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80078a:	83 c0 08             	add    $0x8,%eax
+  80078d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800790:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800792:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  800797:	e9 4a 01 00 00       	jmp    8008e6 <vprintfmt+0x5c0>
+  80079c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007a0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007a4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007a8:	eb e6                	jmp    800790 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  8007aa:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007ad:	83 f8 2f             	cmp    $0x2f,%eax
+  8007b0:	77 19                	ja     8007cb <vprintfmt+0x4a5>
+  8007b2:	89 c2                	mov    %eax,%edx
+  8007b4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007b8:	83 c0 08             	add    $0x8,%eax
+  8007bb:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007be:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8007c1:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  8007c6:	e9 1b 01 00 00       	jmp    8008e6 <vprintfmt+0x5c0>
+  8007cb:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007cf:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007d3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007d7:	eb e5                	jmp    8007be <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  8007d9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007dd:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007e1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007e5:	e9 56 ff ff ff       	jmp    800740 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  8007ea:	40 84 f6             	test   %sil,%sil
+  8007ed:	75 2e                	jne    80081d <vprintfmt+0x4f7>
+    switch (lflag) {
+  8007ef:	85 d2                	test   %edx,%edx
+  8007f1:	74 59                	je     80084c <vprintfmt+0x526>
+  8007f3:	83 fa 01             	cmp    $0x1,%edx
+  8007f6:	74 7f                	je     800877 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  8007f8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007fb:	83 f8 2f             	cmp    $0x2f,%eax
+  8007fe:	0f 87 9f 00 00 00    	ja     8008a3 <vprintfmt+0x57d>
+  800804:	89 c2                	mov    %eax,%edx
+  800806:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80080a:	83 c0 08             	add    $0x8,%eax
+  80080d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800810:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800813:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  800818:	e9 c9 00 00 00       	jmp    8008e6 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  80081d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800820:	83 f8 2f             	cmp    $0x2f,%eax
+  800823:	77 19                	ja     80083e <vprintfmt+0x518>
+  800825:	89 c2                	mov    %eax,%edx
+  800827:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80082b:	83 c0 08             	add    $0x8,%eax
+  80082e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800831:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800834:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800839:	e9 a8 00 00 00       	jmp    8008e6 <vprintfmt+0x5c0>
+  80083e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800842:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800846:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80084a:	eb e5                	jmp    800831 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  80084c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80084f:	83 f8 2f             	cmp    $0x2f,%eax
+  800852:	77 15                	ja     800869 <vprintfmt+0x543>
+  800854:	89 c2                	mov    %eax,%edx
+  800856:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80085a:	83 c0 08             	add    $0x8,%eax
+  80085d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800860:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  800862:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  800867:	eb 7d                	jmp    8008e6 <vprintfmt+0x5c0>
+  800869:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80086d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800871:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800875:	eb e9                	jmp    800860 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  800877:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80087a:	83 f8 2f             	cmp    $0x2f,%eax
+  80087d:	77 16                	ja     800895 <vprintfmt+0x56f>
+  80087f:	89 c2                	mov    %eax,%edx
+  800881:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800885:	83 c0 08             	add    $0x8,%eax
+  800888:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80088b:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  80088e:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  800893:	eb 51                	jmp    8008e6 <vprintfmt+0x5c0>
+  800895:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800899:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80089d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008a1:	eb e8                	jmp    80088b <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  8008a3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008a7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008ab:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008af:	e9 5c ff ff ff       	jmp    800810 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  8008b4:	4c 89 ee             	mov    %r13,%rsi
+  8008b7:	bf 30 00 00 00       	mov    $0x30,%edi
+  8008bc:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  8008bf:	4c 89 ee             	mov    %r13,%rsi
+  8008c2:	bf 78 00 00 00       	mov    $0x78,%edi
+  8008c7:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  8008ca:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008cd:	83 f8 2f             	cmp    $0x2f,%eax
+  8008d0:	77 47                	ja     800919 <vprintfmt+0x5f3>
+  8008d2:	89 c2                	mov    %eax,%edx
+  8008d4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008d8:	83 c0 08             	add    $0x8,%eax
+  8008db:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008de:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8008e1:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  8008e6:	48 83 ec 08          	sub    $0x8,%rsp
+  8008ea:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  8008ee:	0f 94 c0             	sete   %al
+  8008f1:	0f b6 c0             	movzbl %al,%eax
+  8008f4:	50                   	push   %rax
+  8008f5:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  8008fa:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  8008fe:	4c 89 ee             	mov    %r13,%rsi
+  800901:	4c 89 f7             	mov    %r14,%rdi
+  800904:	48 b8 1b 02 80 00 00 	movabs $0x80021b,%rax
+  80090b:	00 00 00 
+  80090e:	ff d0                	call   *%rax
+            break;
+  800910:	48 83 c4 10          	add    $0x10,%rsp
+  800914:	e9 3e fa ff ff       	jmp    800357 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800919:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80091d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800921:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800925:	eb b7                	jmp    8008de <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  800927:	40 84 f6             	test   %sil,%sil
+  80092a:	75 2b                	jne    800957 <vprintfmt+0x631>
+    switch (lflag) {
+  80092c:	85 d2                	test   %edx,%edx
+  80092e:	74 56                	je     800986 <vprintfmt+0x660>
+  800930:	83 fa 01             	cmp    $0x1,%edx
+  800933:	74 7f                	je     8009b4 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800935:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800938:	83 f8 2f             	cmp    $0x2f,%eax
+  80093b:	0f 87 a2 00 00 00    	ja     8009e3 <vprintfmt+0x6bd>
+  800941:	89 c2                	mov    %eax,%edx
+  800943:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800947:	83 c0 08             	add    $0x8,%eax
+  80094a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80094d:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800950:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800955:	eb 8f                	jmp    8008e6 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800957:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80095a:	83 f8 2f             	cmp    $0x2f,%eax
+  80095d:	77 19                	ja     800978 <vprintfmt+0x652>
+  80095f:	89 c2                	mov    %eax,%edx
+  800961:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800965:	83 c0 08             	add    $0x8,%eax
+  800968:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80096b:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  80096e:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800973:	e9 6e ff ff ff       	jmp    8008e6 <vprintfmt+0x5c0>
+  800978:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80097c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800980:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800984:	eb e5                	jmp    80096b <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800986:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800989:	83 f8 2f             	cmp    $0x2f,%eax
+  80098c:	77 18                	ja     8009a6 <vprintfmt+0x680>
+  80098e:	89 c2                	mov    %eax,%edx
+  800990:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800994:	83 c0 08             	add    $0x8,%eax
+  800997:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80099a:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  80099c:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  8009a1:	e9 40 ff ff ff       	jmp    8008e6 <vprintfmt+0x5c0>
+  8009a6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009aa:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009ae:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009b2:	eb e6                	jmp    80099a <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  8009b4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009b7:	83 f8 2f             	cmp    $0x2f,%eax
+  8009ba:	77 19                	ja     8009d5 <vprintfmt+0x6af>
+  8009bc:	89 c2                	mov    %eax,%edx
+  8009be:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009c2:	83 c0 08             	add    $0x8,%eax
+  8009c5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009c8:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8009cb:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  8009d0:	e9 11 ff ff ff       	jmp    8008e6 <vprintfmt+0x5c0>
+  8009d5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009d9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009dd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009e1:	eb e5                	jmp    8009c8 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  8009e3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009e7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009eb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009ef:	e9 59 ff ff ff       	jmp    80094d <vprintfmt+0x627>
+            putch(ch, put_arg);
+  8009f4:	4c 89 ee             	mov    %r13,%rsi
+  8009f7:	bf 25 00 00 00       	mov    $0x25,%edi
+  8009fc:	41 ff d6             	call   *%r14
+            break;
+  8009ff:	e9 53 f9 ff ff       	jmp    800357 <vprintfmt+0x31>
+            putch('%', put_arg);
+  800a04:	4c 89 ee             	mov    %r13,%rsi
+  800a07:	bf 25 00 00 00       	mov    $0x25,%edi
+  800a0c:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800a0f:	48 83 eb 01          	sub    $0x1,%rbx
+  800a13:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800a17:	75 f6                	jne    800a0f <vprintfmt+0x6e9>
+  800a19:	e9 39 f9 ff ff       	jmp    800357 <vprintfmt+0x31>
+}
+  800a1e:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800a22:	5b                   	pop    %rbx
+  800a23:	41 5c                	pop    %r12
+  800a25:	41 5d                	pop    %r13
+  800a27:	41 5e                	pop    %r14
+  800a29:	41 5f                	pop    %r15
+  800a2b:	5d                   	pop    %rbp
+  800a2c:	c3                   	ret
+
+0000000000800a2d <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800a2d:	55                   	push   %rbp
+  800a2e:	48 89 e5             	mov    %rsp,%rbp
+  800a31:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800a35:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800a39:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800a3e:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800a42:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800a49:	48 85 ff             	test   %rdi,%rdi
+  800a4c:	74 2b                	je     800a79 <vsnprintf+0x4c>
+  800a4e:	48 85 f6             	test   %rsi,%rsi
+  800a51:	74 26                	je     800a79 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800a53:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800a57:	48 bf d1 02 80 00 00 	movabs $0x8002d1,%rdi
+  800a5e:	00 00 00 
+  800a61:	48 b8 26 03 80 00 00 	movabs $0x800326,%rax
+  800a68:	00 00 00 
+  800a6b:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800a6d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800a71:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800a74:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800a77:	c9                   	leave
+  800a78:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800a79:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800a7e:	eb f7                	jmp    800a77 <vsnprintf+0x4a>
+
+0000000000800a80 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800a80:	55                   	push   %rbp
+  800a81:	48 89 e5             	mov    %rsp,%rbp
+  800a84:	48 83 ec 50          	sub    $0x50,%rsp
+  800a88:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800a8c:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800a90:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800a94:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800a9b:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800a9f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800aa3:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800aa7:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800aab:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800aaf:	48 b8 2d 0a 80 00 00 	movabs $0x800a2d,%rax
+  800ab6:	00 00 00 
+  800ab9:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800abb:	c9                   	leave
+  800abc:	c3                   	ret
+
+0000000000800abd <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800abd:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800ac0:	74 10                	je     800ad2 <strlen+0x15>
+    size_t n = 0;
+  800ac2:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800ac7:	48 83 c0 01          	add    $0x1,%rax
+  800acb:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800acf:	75 f6                	jne    800ac7 <strlen+0xa>
+  800ad1:	c3                   	ret
+    size_t n = 0;
+  800ad2:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800ad7:	c3                   	ret
+
+0000000000800ad8 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800ad8:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800adb:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800ae0:	48 85 f6             	test   %rsi,%rsi
+  800ae3:	74 11                	je     800af6 <strnlen+0x1e>
+  800ae5:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800ae9:	74 0c                	je     800af7 <strnlen+0x1f>
+  800aeb:	48 83 c2 01          	add    $0x1,%rdx
+  800aef:	48 39 d0             	cmp    %rdx,%rax
+  800af2:	75 f1                	jne    800ae5 <strnlen+0xd>
+  800af4:	eb 04                	jmp    800afa <strnlen+0x22>
+  800af6:	c3                   	ret
+  800af7:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800afa:	c3                   	ret
+
+0000000000800afb <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800afb:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800afe:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b03:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800b07:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800b0a:	48 83 c2 01          	add    $0x1,%rdx
+  800b0e:	84 c9                	test   %cl,%cl
+  800b10:	75 f1                	jne    800b03 <strcpy+0x8>
+        ;
+    return res;
+}
+  800b12:	c3                   	ret
+
+0000000000800b13 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800b13:	55                   	push   %rbp
+  800b14:	48 89 e5             	mov    %rsp,%rbp
+  800b17:	41 54                	push   %r12
+  800b19:	53                   	push   %rbx
+  800b1a:	48 89 fb             	mov    %rdi,%rbx
+  800b1d:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800b20:	48 b8 bd 0a 80 00 00 	movabs $0x800abd,%rax
+  800b27:	00 00 00 
+  800b2a:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800b2c:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800b30:	4c 89 e6             	mov    %r12,%rsi
+  800b33:	48 b8 fb 0a 80 00 00 	movabs $0x800afb,%rax
+  800b3a:	00 00 00 
+  800b3d:	ff d0                	call   *%rax
+    return dst;
+}
+  800b3f:	48 89 d8             	mov    %rbx,%rax
+  800b42:	5b                   	pop    %rbx
+  800b43:	41 5c                	pop    %r12
+  800b45:	5d                   	pop    %rbp
+  800b46:	c3                   	ret
+
+0000000000800b47 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800b47:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800b4a:	48 85 d2             	test   %rdx,%rdx
+  800b4d:	74 1f                	je     800b6e <strncpy+0x27>
+  800b4f:	48 01 fa             	add    %rdi,%rdx
+  800b52:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800b55:	48 83 c1 01          	add    $0x1,%rcx
+  800b59:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800b5d:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800b61:	41 80 f8 01          	cmp    $0x1,%r8b
+  800b65:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800b69:	48 39 ca             	cmp    %rcx,%rdx
+  800b6c:	75 e7                	jne    800b55 <strncpy+0xe>
+    }
+    return ret;
+}
+  800b6e:	c3                   	ret
+
+0000000000800b6f <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800b6f:	48 89 f8             	mov    %rdi,%rax
+  800b72:	48 85 d2             	test   %rdx,%rdx
+  800b75:	74 24                	je     800b9b <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800b77:	48 83 ea 01          	sub    $0x1,%rdx
+  800b7b:	74 1b                	je     800b98 <strlcpy+0x29>
+  800b7d:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800b81:	0f b6 16             	movzbl (%rsi),%edx
+  800b84:	84 d2                	test   %dl,%dl
+  800b86:	74 10                	je     800b98 <strlcpy+0x29>
+            *dst++ = *src++;
+  800b88:	48 83 c6 01          	add    $0x1,%rsi
+  800b8c:	48 83 c0 01          	add    $0x1,%rax
+  800b90:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800b93:	48 39 c8             	cmp    %rcx,%rax
+  800b96:	75 e9                	jne    800b81 <strlcpy+0x12>
+        *dst = '\0';
+  800b98:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800b9b:	48 29 f8             	sub    %rdi,%rax
+}
+  800b9e:	c3                   	ret
+
+0000000000800b9f <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800b9f:	0f b6 07             	movzbl (%rdi),%eax
+  800ba2:	84 c0                	test   %al,%al
+  800ba4:	74 13                	je     800bb9 <strcmp+0x1a>
+  800ba6:	38 06                	cmp    %al,(%rsi)
+  800ba8:	75 0f                	jne    800bb9 <strcmp+0x1a>
+  800baa:	48 83 c7 01          	add    $0x1,%rdi
+  800bae:	48 83 c6 01          	add    $0x1,%rsi
+  800bb2:	0f b6 07             	movzbl (%rdi),%eax
+  800bb5:	84 c0                	test   %al,%al
+  800bb7:	75 ed                	jne    800ba6 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800bb9:	0f b6 c0             	movzbl %al,%eax
+  800bbc:	0f b6 16             	movzbl (%rsi),%edx
+  800bbf:	29 d0                	sub    %edx,%eax
+}
+  800bc1:	c3                   	ret
+
+0000000000800bc2 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800bc2:	48 85 d2             	test   %rdx,%rdx
+  800bc5:	74 1f                	je     800be6 <strncmp+0x24>
+  800bc7:	0f b6 07             	movzbl (%rdi),%eax
+  800bca:	84 c0                	test   %al,%al
+  800bcc:	74 1e                	je     800bec <strncmp+0x2a>
+  800bce:	3a 06                	cmp    (%rsi),%al
+  800bd0:	75 1a                	jne    800bec <strncmp+0x2a>
+  800bd2:	48 83 c7 01          	add    $0x1,%rdi
+  800bd6:	48 83 c6 01          	add    $0x1,%rsi
+  800bda:	48 83 ea 01          	sub    $0x1,%rdx
+  800bde:	75 e7                	jne    800bc7 <strncmp+0x5>
+
+    if (!n) return 0;
+  800be0:	b8 00 00 00 00       	mov    $0x0,%eax
+  800be5:	c3                   	ret
+  800be6:	b8 00 00 00 00       	mov    $0x0,%eax
+  800beb:	c3                   	ret
+  800bec:	48 85 d2             	test   %rdx,%rdx
+  800bef:	74 09                	je     800bfa <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800bf1:	0f b6 07             	movzbl (%rdi),%eax
+  800bf4:	0f b6 16             	movzbl (%rsi),%edx
+  800bf7:	29 d0                	sub    %edx,%eax
+  800bf9:	c3                   	ret
+    if (!n) return 0;
+  800bfa:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800bff:	c3                   	ret
+
+0000000000800c00 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800c00:	0f b6 17             	movzbl (%rdi),%edx
+  800c03:	84 d2                	test   %dl,%dl
+  800c05:	74 18                	je     800c1f <strchr+0x1f>
+        if (*str == c) {
+  800c07:	0f be d2             	movsbl %dl,%edx
+  800c0a:	39 f2                	cmp    %esi,%edx
+  800c0c:	74 17                	je     800c25 <strchr+0x25>
+    for (; *str; str++) {
+  800c0e:	48 83 c7 01          	add    $0x1,%rdi
+  800c12:	0f b6 17             	movzbl (%rdi),%edx
+  800c15:	84 d2                	test   %dl,%dl
+  800c17:	75 ee                	jne    800c07 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800c19:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c1e:	c3                   	ret
+  800c1f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c24:	c3                   	ret
+  800c25:	48 89 f8             	mov    %rdi,%rax
+}
+  800c28:	c3                   	ret
+
+0000000000800c29 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800c29:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800c2c:	0f b6 17             	movzbl (%rdi),%edx
+  800c2f:	84 d2                	test   %dl,%dl
+  800c31:	74 13                	je     800c46 <strfind+0x1d>
+  800c33:	0f be d2             	movsbl %dl,%edx
+  800c36:	39 f2                	cmp    %esi,%edx
+  800c38:	74 0b                	je     800c45 <strfind+0x1c>
+  800c3a:	48 83 c0 01          	add    $0x1,%rax
+  800c3e:	0f b6 10             	movzbl (%rax),%edx
+  800c41:	84 d2                	test   %dl,%dl
+  800c43:	75 ee                	jne    800c33 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800c45:	c3                   	ret
+  800c46:	c3                   	ret
+
+0000000000800c47 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800c47:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800c4a:	48 89 f8             	mov    %rdi,%rax
+  800c4d:	48 f7 d8             	neg    %rax
+  800c50:	83 e0 07             	and    $0x7,%eax
+  800c53:	49 89 d1             	mov    %rdx,%r9
+  800c56:	49 29 c1             	sub    %rax,%r9
+  800c59:	78 36                	js     800c91 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800c5b:	40 0f b6 c6          	movzbl %sil,%eax
+  800c5f:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800c66:	01 01 01 
+  800c69:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800c6d:	40 f6 c7 07          	test   $0x7,%dil
+  800c71:	75 38                	jne    800cab <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800c73:	4c 89 c9             	mov    %r9,%rcx
+  800c76:	48 c1 f9 03          	sar    $0x3,%rcx
+  800c7a:	74 0c                	je     800c88 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800c7c:	fc                   	cld
+  800c7d:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800c80:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800c84:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800c88:	4d 85 c9             	test   %r9,%r9
+  800c8b:	75 45                	jne    800cd2 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800c8d:	4c 89 c0             	mov    %r8,%rax
+  800c90:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800c91:	48 85 d2             	test   %rdx,%rdx
+  800c94:	74 f7                	je     800c8d <memset+0x46>
+  800c96:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800c99:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800c9c:	48 83 c0 01          	add    $0x1,%rax
+  800ca0:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  800ca4:	48 39 c2             	cmp    %rax,%rdx
+  800ca7:	75 f3                	jne    800c9c <memset+0x55>
+  800ca9:	eb e2                	jmp    800c8d <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  800cab:	40 f6 c7 01          	test   $0x1,%dil
+  800caf:	74 06                	je     800cb7 <memset+0x70>
+  800cb1:	88 07                	mov    %al,(%rdi)
+  800cb3:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800cb7:	40 f6 c7 02          	test   $0x2,%dil
+  800cbb:	74 07                	je     800cc4 <memset+0x7d>
+  800cbd:	66 89 07             	mov    %ax,(%rdi)
+  800cc0:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800cc4:	40 f6 c7 04          	test   $0x4,%dil
+  800cc8:	74 a9                	je     800c73 <memset+0x2c>
+  800cca:	89 07                	mov    %eax,(%rdi)
+  800ccc:	48 83 c7 04          	add    $0x4,%rdi
+  800cd0:	eb a1                	jmp    800c73 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800cd2:	41 f6 c1 04          	test   $0x4,%r9b
+  800cd6:	74 06                	je     800cde <memset+0x97>
+  800cd8:	89 07                	mov    %eax,(%rdi)
+  800cda:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800cde:	41 f6 c1 02          	test   $0x2,%r9b
+  800ce2:	74 07                	je     800ceb <memset+0xa4>
+  800ce4:	66 89 07             	mov    %ax,(%rdi)
+  800ce7:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  800ceb:	41 f6 c1 01          	test   $0x1,%r9b
+  800cef:	74 9c                	je     800c8d <memset+0x46>
+  800cf1:	88 07                	mov    %al,(%rdi)
+  800cf3:	eb 98                	jmp    800c8d <memset+0x46>
+
+0000000000800cf5 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  800cf5:	48 89 f8             	mov    %rdi,%rax
+  800cf8:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  800cfb:	48 39 fe             	cmp    %rdi,%rsi
+  800cfe:	73 3b                	jae    800d3b <memmove+0x46>
+  800d00:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  800d04:	48 39 d7             	cmp    %rdx,%rdi
+  800d07:	73 32                	jae    800d3b <memmove+0x46>
+        s += n;
+        d += n;
+  800d09:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800d0d:	48 89 d6             	mov    %rdx,%rsi
+  800d10:	48 09 fe             	or     %rdi,%rsi
+  800d13:	48 09 ce             	or     %rcx,%rsi
+  800d16:	40 f6 c6 07          	test   $0x7,%sil
+  800d1a:	75 12                	jne    800d2e <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  800d1c:	48 83 ef 08          	sub    $0x8,%rdi
+  800d20:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  800d24:	48 c1 e9 03          	shr    $0x3,%rcx
+  800d28:	fd                   	std
+  800d29:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  800d2c:	fc                   	cld
+  800d2d:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  800d2e:	48 83 ef 01          	sub    $0x1,%rdi
+  800d32:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  800d36:	fd                   	std
+  800d37:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  800d39:	eb f1                	jmp    800d2c <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800d3b:	48 89 f2             	mov    %rsi,%rdx
+  800d3e:	48 09 c2             	or     %rax,%rdx
+  800d41:	48 09 ca             	or     %rcx,%rdx
+  800d44:	f6 c2 07             	test   $0x7,%dl
+  800d47:	75 0c                	jne    800d55 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  800d49:	48 c1 e9 03          	shr    $0x3,%rcx
+  800d4d:	48 89 c7             	mov    %rax,%rdi
+  800d50:	fc                   	cld
+  800d51:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  800d54:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  800d55:	48 89 c7             	mov    %rax,%rdi
+  800d58:	fc                   	cld
+  800d59:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  800d5b:	c3                   	ret
+
+0000000000800d5c <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  800d5c:	55                   	push   %rbp
+  800d5d:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  800d60:	48 b8 f5 0c 80 00 00 	movabs $0x800cf5,%rax
+  800d67:	00 00 00 
+  800d6a:	ff d0                	call   *%rax
+}
+  800d6c:	5d                   	pop    %rbp
+  800d6d:	c3                   	ret
+
+0000000000800d6e <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  800d6e:	55                   	push   %rbp
+  800d6f:	48 89 e5             	mov    %rsp,%rbp
+  800d72:	41 57                	push   %r15
+  800d74:	41 56                	push   %r14
+  800d76:	41 55                	push   %r13
+  800d78:	41 54                	push   %r12
+  800d7a:	53                   	push   %rbx
+  800d7b:	48 83 ec 08          	sub    $0x8,%rsp
+  800d7f:	49 89 fe             	mov    %rdi,%r14
+  800d82:	49 89 f7             	mov    %rsi,%r15
+  800d85:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  800d88:	48 89 f7             	mov    %rsi,%rdi
+  800d8b:	48 b8 bd 0a 80 00 00 	movabs $0x800abd,%rax
+  800d92:	00 00 00 
+  800d95:	ff d0                	call   *%rax
+  800d97:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  800d9a:	48 89 de             	mov    %rbx,%rsi
+  800d9d:	4c 89 f7             	mov    %r14,%rdi
+  800da0:	48 b8 d8 0a 80 00 00 	movabs $0x800ad8,%rax
+  800da7:	00 00 00 
+  800daa:	ff d0                	call   *%rax
+  800dac:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  800daf:	48 39 c3             	cmp    %rax,%rbx
+  800db2:	74 36                	je     800dea <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  800db4:	48 89 d8             	mov    %rbx,%rax
+  800db7:	4c 29 e8             	sub    %r13,%rax
+  800dba:	49 39 c4             	cmp    %rax,%r12
+  800dbd:	73 31                	jae    800df0 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  800dbf:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  800dc4:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800dc8:	4c 89 fe             	mov    %r15,%rsi
+  800dcb:	48 b8 5c 0d 80 00 00 	movabs $0x800d5c,%rax
+  800dd2:	00 00 00 
+  800dd5:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  800dd7:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  800ddb:	48 83 c4 08          	add    $0x8,%rsp
+  800ddf:	5b                   	pop    %rbx
+  800de0:	41 5c                	pop    %r12
+  800de2:	41 5d                	pop    %r13
+  800de4:	41 5e                	pop    %r14
+  800de6:	41 5f                	pop    %r15
+  800de8:	5d                   	pop    %rbp
+  800de9:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  800dea:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800dee:	eb eb                	jmp    800ddb <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  800df0:	48 83 eb 01          	sub    $0x1,%rbx
+  800df4:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800df8:	48 89 da             	mov    %rbx,%rdx
+  800dfb:	4c 89 fe             	mov    %r15,%rsi
+  800dfe:	48 b8 5c 0d 80 00 00 	movabs $0x800d5c,%rax
+  800e05:	00 00 00 
+  800e08:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  800e0a:	49 01 de             	add    %rbx,%r14
+  800e0d:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  800e12:	eb c3                	jmp    800dd7 <strlcat+0x69>
+
+0000000000800e14 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  800e14:	48 85 d2             	test   %rdx,%rdx
+  800e17:	74 2d                	je     800e46 <memcmp+0x32>
+  800e19:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  800e1e:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800e22:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  800e27:	44 38 c1             	cmp    %r8b,%cl
+  800e2a:	75 0f                	jne    800e3b <memcmp+0x27>
+    while (n-- > 0) {
+  800e2c:	48 83 c0 01          	add    $0x1,%rax
+  800e30:	48 39 c2             	cmp    %rax,%rdx
+  800e33:	75 e9                	jne    800e1e <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  800e35:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e3a:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  800e3b:	0f b6 c1             	movzbl %cl,%eax
+  800e3e:	45 0f b6 c0          	movzbl %r8b,%r8d
+  800e42:	44 29 c0             	sub    %r8d,%eax
+  800e45:	c3                   	ret
+    return 0;
+  800e46:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800e4b:	c3                   	ret
+
+0000000000800e4c <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  800e4c:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  800e50:	48 39 c7             	cmp    %rax,%rdi
+  800e53:	73 0f                	jae    800e64 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  800e55:	40 38 37             	cmp    %sil,(%rdi)
+  800e58:	74 0e                	je     800e68 <memfind+0x1c>
+    for (; src < end; src++) {
+  800e5a:	48 83 c7 01          	add    $0x1,%rdi
+  800e5e:	48 39 f8             	cmp    %rdi,%rax
+  800e61:	75 f2                	jne    800e55 <memfind+0x9>
+  800e63:	c3                   	ret
+  800e64:	48 89 f8             	mov    %rdi,%rax
+  800e67:	c3                   	ret
+  800e68:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  800e6b:	c3                   	ret
+
+0000000000800e6c <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  800e6c:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  800e6f:	0f b6 37             	movzbl (%rdi),%esi
+  800e72:	40 80 fe 20          	cmp    $0x20,%sil
+  800e76:	74 06                	je     800e7e <strtol+0x12>
+  800e78:	40 80 fe 09          	cmp    $0x9,%sil
+  800e7c:	75 13                	jne    800e91 <strtol+0x25>
+  800e7e:	48 83 c7 01          	add    $0x1,%rdi
+  800e82:	0f b6 37             	movzbl (%rdi),%esi
+  800e85:	40 80 fe 20          	cmp    $0x20,%sil
+  800e89:	74 f3                	je     800e7e <strtol+0x12>
+  800e8b:	40 80 fe 09          	cmp    $0x9,%sil
+  800e8f:	74 ed                	je     800e7e <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  800e91:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  800e94:	83 e0 fd             	and    $0xfffffffd,%eax
+  800e97:	3c 01                	cmp    $0x1,%al
+  800e99:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  800e9d:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  800ea3:	75 0f                	jne    800eb4 <strtol+0x48>
+  800ea5:	80 3f 30             	cmpb   $0x30,(%rdi)
+  800ea8:	74 14                	je     800ebe <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  800eaa:	85 d2                	test   %edx,%edx
+  800eac:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800eb1:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  800eb4:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  800eb9:	4c 63 ca             	movslq %edx,%r9
+  800ebc:	eb 36                	jmp    800ef4 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  800ebe:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  800ec2:	74 0f                	je     800ed3 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  800ec4:	85 d2                	test   %edx,%edx
+  800ec6:	75 ec                	jne    800eb4 <strtol+0x48>
+        s++;
+  800ec8:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  800ecc:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  800ed1:	eb e1                	jmp    800eb4 <strtol+0x48>
+        s += 2;
+  800ed3:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  800ed7:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  800edc:	eb d6                	jmp    800eb4 <strtol+0x48>
+            dig -= '0';
+  800ede:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  800ee1:	44 0f b6 c1          	movzbl %cl,%r8d
+  800ee5:	41 39 d0             	cmp    %edx,%r8d
+  800ee8:	7d 21                	jge    800f0b <strtol+0x9f>
+        val = val * base + dig;
+  800eea:	49 0f af c1          	imul   %r9,%rax
+  800eee:	0f b6 c9             	movzbl %cl,%ecx
+  800ef1:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  800ef4:	48 83 c7 01          	add    $0x1,%rdi
+  800ef8:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  800efc:	80 f9 39             	cmp    $0x39,%cl
+  800eff:	76 dd                	jbe    800ede <strtol+0x72>
+        else if (dig - 'a' < 27)
+  800f01:	80 f9 7b             	cmp    $0x7b,%cl
+  800f04:	77 05                	ja     800f0b <strtol+0x9f>
+            dig -= 'a' - 10;
+  800f06:	83 e9 57             	sub    $0x57,%ecx
+  800f09:	eb d6                	jmp    800ee1 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  800f0b:	4d 85 d2             	test   %r10,%r10
+  800f0e:	74 03                	je     800f13 <strtol+0xa7>
+  800f10:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  800f13:	48 89 c2             	mov    %rax,%rdx
+  800f16:	48 f7 da             	neg    %rdx
+  800f19:	40 80 fe 2d          	cmp    $0x2d,%sil
+  800f1d:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  800f21:	c3                   	ret
+
+0000000000800f22 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  800f22:	55                   	push   %rbp
+  800f23:	48 89 e5             	mov    %rsp,%rbp
+  800f26:	53                   	push   %rbx
+  800f27:	48 89 fa             	mov    %rdi,%rdx
+  800f2a:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  800f2d:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800f32:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f37:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800f3c:	be 00 00 00 00       	mov    $0x0,%esi
+  800f41:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800f47:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  800f49:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800f4d:	c9                   	leave
+  800f4e:	c3                   	ret
+
+0000000000800f4f <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  800f4f:	55                   	push   %rbp
+  800f50:	48 89 e5             	mov    %rsp,%rbp
+  800f53:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  800f54:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800f59:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f5e:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800f63:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f68:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800f6d:	be 00 00 00 00       	mov    $0x0,%esi
+  800f72:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800f78:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  800f7a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800f7e:	c9                   	leave
+  800f7f:	c3                   	ret
+
+0000000000800f80 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  800f80:	55                   	push   %rbp
+  800f81:	48 89 e5             	mov    %rsp,%rbp
+  800f84:	53                   	push   %rbx
+  800f85:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  800f89:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800f8c:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800f91:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800f96:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f9b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800fa0:	be 00 00 00 00       	mov    $0x0,%esi
+  800fa5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800fab:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800fad:	48 85 c0             	test   %rax,%rax
+  800fb0:	7f 06                	jg     800fb8 <sys_env_destroy+0x38>
+}
+  800fb2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800fb6:	c9                   	leave
+  800fb7:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800fb8:	49 89 c0             	mov    %rax,%r8
+  800fbb:	b9 03 00 00 00       	mov    $0x3,%ecx
+  800fc0:	48 ba 10 32 80 00 00 	movabs $0x803210,%rdx
+  800fc7:	00 00 00 
+  800fca:	be 26 00 00 00       	mov    $0x26,%esi
+  800fcf:	48 bf 2f 32 80 00 00 	movabs $0x80322f,%rdi
+  800fd6:	00 00 00 
+  800fd9:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fde:	49 b9 3c 2a 80 00 00 	movabs $0x802a3c,%r9
+  800fe5:	00 00 00 
+  800fe8:	41 ff d1             	call   *%r9
+
+0000000000800feb <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  800feb:	55                   	push   %rbp
+  800fec:	48 89 e5             	mov    %rsp,%rbp
+  800fef:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  800ff0:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800ff5:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ffa:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800fff:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801004:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801009:	be 00 00 00 00       	mov    $0x0,%esi
+  80100e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801014:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  801016:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80101a:	c9                   	leave
+  80101b:	c3                   	ret
+
+000000000080101c <sys_yield>:
+
+void
+sys_yield(void) {
+  80101c:	55                   	push   %rbp
+  80101d:	48 89 e5             	mov    %rsp,%rbp
+  801020:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801021:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801026:	ba 00 00 00 00       	mov    $0x0,%edx
+  80102b:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801030:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801035:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80103a:	be 00 00 00 00       	mov    $0x0,%esi
+  80103f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801045:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  801047:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80104b:	c9                   	leave
+  80104c:	c3                   	ret
+
+000000000080104d <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  80104d:	55                   	push   %rbp
+  80104e:	48 89 e5             	mov    %rsp,%rbp
+  801051:	53                   	push   %rbx
+  801052:	48 89 fa             	mov    %rdi,%rdx
+  801055:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801058:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80105d:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  801064:	00 00 00 
+  801067:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80106c:	be 00 00 00 00       	mov    $0x0,%esi
+  801071:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801077:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  801079:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80107d:	c9                   	leave
+  80107e:	c3                   	ret
+
+000000000080107f <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  80107f:	55                   	push   %rbp
+  801080:	48 89 e5             	mov    %rsp,%rbp
+  801083:	53                   	push   %rbx
+  801084:	49 89 f8             	mov    %rdi,%r8
+  801087:	48 89 d3             	mov    %rdx,%rbx
+  80108a:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80108d:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801092:	4c 89 c2             	mov    %r8,%rdx
+  801095:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801098:	be 00 00 00 00       	mov    $0x0,%esi
+  80109d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8010a3:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  8010a5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8010a9:	c9                   	leave
+  8010aa:	c3                   	ret
+
+00000000008010ab <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  8010ab:	55                   	push   %rbp
+  8010ac:	48 89 e5             	mov    %rsp,%rbp
+  8010af:	53                   	push   %rbx
+  8010b0:	48 83 ec 08          	sub    $0x8,%rsp
+  8010b4:	89 f8                	mov    %edi,%eax
+  8010b6:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  8010b9:	48 63 f9             	movslq %ecx,%rdi
+  8010bc:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8010bf:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8010c4:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8010c7:	be 00 00 00 00       	mov    $0x0,%esi
+  8010cc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8010d2:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8010d4:	48 85 c0             	test   %rax,%rax
+  8010d7:	7f 06                	jg     8010df <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  8010d9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8010dd:	c9                   	leave
+  8010de:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8010df:	49 89 c0             	mov    %rax,%r8
+  8010e2:	b9 04 00 00 00       	mov    $0x4,%ecx
+  8010e7:	48 ba 10 32 80 00 00 	movabs $0x803210,%rdx
+  8010ee:	00 00 00 
+  8010f1:	be 26 00 00 00       	mov    $0x26,%esi
+  8010f6:	48 bf 2f 32 80 00 00 	movabs $0x80322f,%rdi
+  8010fd:	00 00 00 
+  801100:	b8 00 00 00 00       	mov    $0x0,%eax
+  801105:	49 b9 3c 2a 80 00 00 	movabs $0x802a3c,%r9
+  80110c:	00 00 00 
+  80110f:	41 ff d1             	call   *%r9
+
+0000000000801112 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801112:	55                   	push   %rbp
+  801113:	48 89 e5             	mov    %rsp,%rbp
+  801116:	53                   	push   %rbx
+  801117:	48 83 ec 08          	sub    $0x8,%rsp
+  80111b:	89 f8                	mov    %edi,%eax
+  80111d:	49 89 f2             	mov    %rsi,%r10
+  801120:	48 89 cf             	mov    %rcx,%rdi
+  801123:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  801126:	48 63 da             	movslq %edx,%rbx
+  801129:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80112c:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801131:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801134:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  801137:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801139:	48 85 c0             	test   %rax,%rax
+  80113c:	7f 06                	jg     801144 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  80113e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801142:	c9                   	leave
+  801143:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801144:	49 89 c0             	mov    %rax,%r8
+  801147:	b9 05 00 00 00       	mov    $0x5,%ecx
+  80114c:	48 ba 10 32 80 00 00 	movabs $0x803210,%rdx
+  801153:	00 00 00 
+  801156:	be 26 00 00 00       	mov    $0x26,%esi
+  80115b:	48 bf 2f 32 80 00 00 	movabs $0x80322f,%rdi
+  801162:	00 00 00 
+  801165:	b8 00 00 00 00       	mov    $0x0,%eax
+  80116a:	49 b9 3c 2a 80 00 00 	movabs $0x802a3c,%r9
+  801171:	00 00 00 
+  801174:	41 ff d1             	call   *%r9
+
+0000000000801177 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  801177:	55                   	push   %rbp
+  801178:	48 89 e5             	mov    %rsp,%rbp
+  80117b:	53                   	push   %rbx
+  80117c:	48 83 ec 08          	sub    $0x8,%rsp
+  801180:	48 89 f1             	mov    %rsi,%rcx
+  801183:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  801186:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801189:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80118e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801193:	be 00 00 00 00       	mov    $0x0,%esi
+  801198:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80119e:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8011a0:	48 85 c0             	test   %rax,%rax
+  8011a3:	7f 06                	jg     8011ab <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  8011a5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8011a9:	c9                   	leave
+  8011aa:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8011ab:	49 89 c0             	mov    %rax,%r8
+  8011ae:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8011b3:	48 ba 10 32 80 00 00 	movabs $0x803210,%rdx
+  8011ba:	00 00 00 
+  8011bd:	be 26 00 00 00       	mov    $0x26,%esi
+  8011c2:	48 bf 2f 32 80 00 00 	movabs $0x80322f,%rdi
+  8011c9:	00 00 00 
+  8011cc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011d1:	49 b9 3c 2a 80 00 00 	movabs $0x802a3c,%r9
+  8011d8:	00 00 00 
+  8011db:	41 ff d1             	call   *%r9
+
+00000000008011de <sys_region_batch>:
+
+int
+sys_region_batch(const struct RegionOp *ops, size_t count) {
+  8011de:	55                   	push   %rbp
+  8011df:	48 89 e5             	mov    %rsp,%rbp
+  8011e2:	53                   	push   %rbx
+  8011e3:	48 83 ec 08          	sub    $0x8,%rsp
+  8011e7:	48 89 fa             	mov    %rdi,%rdx
+  8011ea:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8011ed:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8011f2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011f7:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8011fc:	be 00 00 00 00       	mov    $0x0,%esi
+  801201:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801207:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801209:	48 85 c0             	test   %rax,%rax
+  80120c:	7f 06                	jg     801214 <sys_region_batch+0x36>
+        else
+            platform_asan_unpoison(va, ops[i].size);
+    }
+#endif
+    return res;
+}
+  80120e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801212:	c9                   	leave
+  801213:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801214:	49 89 c0             	mov    %rax,%r8
+  801217:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  80121c:	48 ba 10 32 80 00 00 	movabs $0x803210,%rdx
+  801223:	00 00 00 
+  801226:	be 26 00 00 00       	mov    $0x26,%esi
+  80122b:	48 bf 2f 32 80 00 00 	movabs $0x80322f,%rdi
+  801232:	00 00 00 
+  801235:	b8 00 00 00 00       	mov    $0x0,%eax
+  80123a:	49 b9 3c 2a 80 00 00 	movabs $0x802a3c,%r9
+  801241:	00 00 00 
+  801244:	41 ff d1             	call   *%r9
+
+0000000000801247 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  801247:	55                   	push   %rbp
+  801248:	48 89 e5             	mov    %rsp,%rbp
+  80124b:	53                   	push   %rbx
+  80124c:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  801250:	48 63 ce             	movslq %esi,%rcx
+  801253:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801256:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80125b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801260:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801265:	be 00 00 00 00       	mov    $0x0,%esi
+  80126a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801270:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801272:	48 85 c0             	test   %rax,%rax
+  801275:	7f 06                	jg     80127d <sys_env_set_status+0x36>
+}
+  801277:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80127b:	c9                   	leave
+  80127c:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80127d:	49 89 c0             	mov    %rax,%r8
+  801280:	b9 09 00 00 00       	mov    $0x9,%ecx
+  801285:	48 ba 10 32 80 00 00 	movabs $0x803210,%rdx
+  80128c:	00 00 00 
+  80128f:	be 26 00 00 00       	mov    $0x26,%esi
+  801294:	48 bf 2f 32 80 00 00 	movabs $0x80322f,%rdi
+  80129b:	00 00 00 
+  80129e:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012a3:	49 b9 3c 2a 80 00 00 	movabs $0x802a3c,%r9
+  8012aa:	00 00 00 
+  8012ad:	41 ff d1             	call   *%r9
+
+00000000008012b0 <sys_env_set_weight>:
+
+int
+sys_env_set_weight(envid_t envid, uint32_t weight) {
+  8012b0:	55                   	push   %rbp
+  8012b1:	48 89 e5             	mov    %rsp,%rbp
+  8012b4:	53                   	push   %rbx
+  8012b5:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_weight, 1, envid, weight, 0, 0, 0, 0);
+  8012b9:	89 f1                	mov    %esi,%ecx
+  8012bb:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8012be:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8012c3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012c8:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012cd:	be 00 00 00 00       	mov    $0x0,%esi
+  8012d2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8012d8:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8012da:	48 85 c0             	test   %rax,%rax
+  8012dd:	7f 06                	jg     8012e5 <sys_env_set_weight+0x35>
+}
+  8012df:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012e3:	c9                   	leave
+  8012e4:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8012e5:	49 89 c0             	mov    %rax,%r8
+  8012e8:	b9 10 00 00 00       	mov    $0x10,%ecx
+  8012ed:	48 ba 10 32 80 00 00 	movabs $0x803210,%rdx
+  8012f4:	00 00 00 
+  8012f7:	be 26 00 00 00       	mov    $0x26,%esi
+  8012fc:	48 bf 2f 32 80 00 00 	movabs $0x80322f,%rdi
+  801303:	00 00 00 
+  801306:	b8 00 00 00 00       	mov    $0x0,%eax
+  80130b:	49 b9 3c 2a 80 00 00 	movabs $0x802a3c,%r9
+  801312:	00 00 00 
+  801315:	41 ff d1             	call   *%r9
+
+0000000000801318 <sys_env_set_rt>:
+
+int
+sys_env_set_rt(envid_t envid, uint64_t period, uint64_t budget, uint64_t deadline) {
+  801318:	55                   	push   %rbp
+  801319:	48 89 e5             	mov    %rsp,%rbp
+  80131c:	53                   	push   %rbx
+  80131d:	48 83 ec 08          	sub    $0x8,%rsp
+  801321:	89 f8                	mov    %edi,%eax
+  801323:	48 89 d3             	mov    %rdx,%rbx
+  801326:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_env_set_rt, 1, envid, period, budget, deadline, 0, 0);
+  801329:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80132c:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801331:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801334:	be 00 00 00 00       	mov    $0x0,%esi
+  801339:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80133f:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801341:	48 85 c0             	test   %rax,%rax
+  801344:	7f 06                	jg     80134c <sys_env_set_rt+0x34>
+}
+  801346:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80134a:	c9                   	leave
+  80134b:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80134c:	49 89 c0             	mov    %rax,%r8
+  80134f:	b9 11 00 00 00       	mov    $0x11,%ecx
+  801354:	48 ba 10 32 80 00 00 	movabs $0x803210,%rdx
+  80135b:	00 00 00 
+  80135e:	be 26 00 00 00       	mov    $0x26,%esi
+  801363:	48 bf 2f 32 80 00 00 	movabs $0x80322f,%rdi
+  80136a:	00 00 00 
+  80136d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801372:	49 b9 3c 2a 80 00 00 	movabs $0x802a3c,%r9
+  801379:	00 00 00 
+  80137c:	41 ff d1             	call   *%r9
+
+000000000080137f <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  80137f:	55                   	push   %rbp
+  801380:	48 89 e5             	mov    %rsp,%rbp
+  801383:	53                   	push   %rbx
+  801384:	48 83 ec 08          	sub    $0x8,%rsp
+  801388:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  80138b:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80138e:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801393:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801398:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80139d:	be 00 00 00 00       	mov    $0x0,%esi
+  8013a2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013a8:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8013aa:	48 85 c0             	test   %rax,%rax
+  8013ad:	7f 06                	jg     8013b5 <sys_env_set_trapframe+0x36>
+}
+  8013af:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013b3:	c9                   	leave
+  8013b4:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8013b5:	49 89 c0             	mov    %rax,%r8
+  8013b8:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  8013bd:	48 ba 10 32 80 00 00 	movabs $0x803210,%rdx
+  8013c4:	00 00 00 
+  8013c7:	be 26 00 00 00       	mov    $0x26,%esi
+  8013cc:	48 bf 2f 32 80 00 00 	movabs $0x80322f,%rdi
+  8013d3:	00 00 00 
+  8013d6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013db:	49 b9 3c 2a 80 00 00 	movabs $0x802a3c,%r9
+  8013e2:	00 00 00 
+  8013e5:	41 ff d1             	call   *%r9
+
+00000000008013e8 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  8013e8:	55                   	push   %rbp
+  8013e9:	48 89 e5             	mov    %rsp,%rbp
+  8013ec:	53                   	push   %rbx
+  8013ed:	48 83 ec 08          	sub    $0x8,%rsp
+  8013f1:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  8013f4:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8013f7:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8013fc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801401:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801406:	be 00 00 00 00       	mov    $0x0,%esi
+  80140b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801411:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801413:	48 85 c0             	test   %rax,%rax
+  801416:	7f 06                	jg     80141e <sys_env_set_pgfault_upcall+0x36>
+}
+  801418:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80141c:	c9                   	leave
+  80141d:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80141e:	49 89 c0             	mov    %rax,%r8
+  801421:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  801426:	48 ba 10 32 80 00 00 	movabs $0x803210,%rdx
+  80142d:	00 00 00 
+  801430:	be 26 00 00 00       	mov    $0x26,%esi
+  801435:	48 bf 2f 32 80 00 00 	movabs $0x80322f,%rdi
+  80143c:	00 00 00 
+  80143f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801444:	49 b9 3c 2a 80 00 00 	movabs $0x802a3c,%r9
+  80144b:	00 00 00 
+  80144e:	41 ff d1             	call   *%r9
+
+0000000000801451 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  801451:	55                   	push   %rbp
+  801452:	48 89 e5             	mov    %rsp,%rbp
+  801455:	53                   	push   %rbx
+  801456:	89 f8                	mov    %edi,%eax
+  801458:	49 89 f1             	mov    %rsi,%r9
+  80145b:	48 89 d3             	mov    %rdx,%rbx
+  80145e:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  801461:	49 63 f0             	movslq %r8d,%rsi
+  801464:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801467:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80146c:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80146f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801475:	cd 30                	int    $0x30
+}
+  801477:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80147b:	c9                   	leave
+  80147c:	c3                   	ret
+
+000000000080147d <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  80147d:	55                   	push   %rbp
+  80147e:	48 89 e5             	mov    %rsp,%rbp
+  801481:	53                   	push   %rbx
+  801482:	48 83 ec 08          	sub    $0x8,%rsp
+  801486:	48 89 fa             	mov    %rdi,%rdx
+  801489:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80148c:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801491:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801496:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80149b:	be 00 00 00 00       	mov    $0x0,%esi
+  8014a0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014a6:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8014a8:	48 85 c0             	test   %rax,%rax
+  8014ab:	7f 06                	jg     8014b3 <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8014ad:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014b1:	c9                   	leave
+  8014b2:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8014b3:	49 89 c0             	mov    %rax,%r8
+  8014b6:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  8014bb:	48 ba 10 32 80 00 00 	movabs $0x803210,%rdx
+  8014c2:	00 00 00 
+  8014c5:	be 26 00 00 00       	mov    $0x26,%esi
+  8014ca:	48 bf 2f 32 80 00 00 	movabs $0x80322f,%rdi
+  8014d1:	00 00 00 
+  8014d4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014d9:	49 b9 3c 2a 80 00 00 	movabs $0x802a3c,%r9
+  8014e0:	00 00 00 
+  8014e3:	41 ff d1             	call   *%r9
+
+00000000008014e6 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8014e6:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8014ed:	ff ff ff 
+  8014f0:	48 01 f8             	add    %rdi,%rax
+  8014f3:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  8014f7:	c3                   	ret
+
+00000000008014f8 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8014f8:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8014ff:	ff ff ff 
+  801502:	48 01 f8             	add    %rdi,%rax
+  801505:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  801509:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  80150f:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  801513:	c3                   	ret
+
+0000000000801514 <fd_alloc_from>:
+}
+
+/* Like fd_alloc(), but only considers fds starting from fdnum,
+ * so that several fds can be found before their pages are allocated */
+int
+fd_alloc_from(int fdnum, struct Fd **fd_store) {
+  801514:	55                   	push   %rbp
+  801515:	48 89 e5             	mov    %rsp,%rbp
+  801518:	41 57                	push   %r15
+  80151a:	41 56                	push   %r14
+  80151c:	41 55                	push   %r13
+  80151e:	41 54                	push   %r12
+  801520:	53                   	push   %rbx
+  801521:	48 83 ec 08          	sub    $0x8,%rsp
+  801525:	49 89 f7             	mov    %rsi,%r15
+    for (int i = MAX(fdnum, 0); i < MAXFD; i++) {
+  801528:	85 ff                	test   %edi,%edi
+  80152a:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  801530:	44 0f 49 e7          	cmovns %edi,%r12d
+  801534:	83 ff 1f             	cmp    $0x1f,%edi
+  801537:	7f 37                	jg     801570 <fd_alloc_from+0x5c>
+  801539:	49 63 dc             	movslq %r12d,%rbx
+  80153c:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  801543:	48 c1 e3 0c          	shl    $0xc,%rbx
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  801547:	49 be 1d 26 80 00 00 	movabs $0x80261d,%r14
+  80154e:	00 00 00 
+        struct Fd *fd = INDEX2FD(i);
+  801551:	49 89 dd             	mov    %rbx,%r13
+        if (!(get_prot(fd) & PROT_R)) {
+  801554:	48 89 df             	mov    %rbx,%rdi
+  801557:	41 ff d6             	call   *%r14
+  80155a:	83 e0 04             	and    $0x4,%eax
+  80155d:	74 1c                	je     80157b <fd_alloc_from+0x67>
+    for (int i = MAX(fdnum, 0); i < MAXFD; i++) {
+  80155f:	41 83 c4 01          	add    $0x1,%r12d
+  801563:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  80156a:	41 83 fc 1f          	cmp    $0x1f,%r12d
+  80156e:	7e e1                	jle    801551 <fd_alloc_from+0x3d>
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  801570:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801576:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  80157b:	4d 89 2f             	mov    %r13,(%r15)
+}
+  80157e:	48 83 c4 08          	add    $0x8,%rsp
+  801582:	5b                   	pop    %rbx
+  801583:	41 5c                	pop    %r12
+  801585:	41 5d                	pop    %r13
+  801587:	41 5e                	pop    %r14
+  801589:	41 5f                	pop    %r15
+  80158b:	5d                   	pop    %rbp
+  80158c:	c3                   	ret
+
+000000000080158d <fd_alloc>:
+fd_alloc(struct Fd **fd_store) {
+  80158d:	55                   	push   %rbp
+  80158e:	48 89 e5             	mov    %rsp,%rbp
+  801591:	48 89 fe             	mov    %rdi,%rsi
+    return fd_alloc_from(0, fd_store);
+  801594:	bf 00 00 00 00       	mov    $0x0,%edi
+  801599:	48 b8 14 15 80 00 00 	movabs $0x801514,%rax
+  8015a0:	00 00 00 
+  8015a3:	ff d0                	call   *%rax
+}
+  8015a5:	5d                   	pop    %rbp
+  8015a6:	c3                   	ret
+
+00000000008015a7 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  8015a7:	83 ff 1f             	cmp    $0x1f,%edi
+  8015aa:	77 39                	ja     8015e5 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  8015ac:	55                   	push   %rbp
+  8015ad:	48 89 e5             	mov    %rsp,%rbp
+  8015b0:	41 54                	push   %r12
+  8015b2:	53                   	push   %rbx
+  8015b3:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  8015b6:	48 63 df             	movslq %edi,%rbx
+  8015b9:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  8015c0:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  8015c4:	48 89 df             	mov    %rbx,%rdi
+  8015c7:	48 b8 1d 26 80 00 00 	movabs $0x80261d,%rax
+  8015ce:	00 00 00 
+  8015d1:	ff d0                	call   *%rax
+  8015d3:	a8 04                	test   $0x4,%al
+  8015d5:	74 14                	je     8015eb <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  8015d7:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  8015db:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8015e0:	5b                   	pop    %rbx
+  8015e1:	41 5c                	pop    %r12
+  8015e3:	5d                   	pop    %rbp
+  8015e4:	c3                   	ret
+        return -E_INVAL;
+  8015e5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8015ea:	c3                   	ret
+        return -E_INVAL;
+  8015eb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8015f0:	eb ee                	jmp    8015e0 <fd_lookup+0x39>
+
+00000000008015f2 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  8015f2:	55                   	push   %rbp
+  8015f3:	48 89 e5             	mov    %rsp,%rbp
+  8015f6:	41 54                	push   %r12
+  8015f8:	53                   	push   %rbx
+  8015f9:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  8015fc:	48 b8 c0 32 80 00 00 	movabs $0x8032c0,%rax
+  801603:	00 00 00 
+  801606:	48 bb 20 40 80 00 00 	movabs $0x804020,%rbx
+  80160d:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  801610:	39 3b                	cmp    %edi,(%rbx)
+  801612:	74 47                	je     80165b <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  801614:	48 83 c0 08          	add    $0x8,%rax
+  801618:	48 8b 18             	mov    (%rax),%rbx
+  80161b:	48 85 db             	test   %rbx,%rbx
+  80161e:	75 f0                	jne    801610 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801620:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801627:	00 00 00 
+  80162a:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+  801630:	89 fa                	mov    %edi,%edx
+  801632:	48 bf 40 32 80 00 00 	movabs $0x803240,%rdi
+  801639:	00 00 00 
+  80163c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801641:	48 b9 d6 01 80 00 00 	movabs $0x8001d6,%rcx
+  801648:	00 00 00 
+  80164b:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  80164d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  801652:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  801656:	5b                   	pop    %rbx
+  801657:	41 5c                	pop    %r12
+  801659:	5d                   	pop    %rbp
+  80165a:	c3                   	ret
+            return 0;
+  80165b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801660:	eb f0                	jmp    801652 <dev_lookup+0x60>
+
+0000000000801662 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  801662:	55                   	push   %rbp
+  801663:	48 89 e5             	mov    %rsp,%rbp
+  801666:	41 55                	push   %r13
+  801668:	41 54                	push   %r12
+  80166a:	53                   	push   %rbx
+  80166b:	48 83 ec 18          	sub    $0x18,%rsp
+  80166f:	48 89 fb             	mov    %rdi,%rbx
+  801672:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801675:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  80167c:	ff ff ff 
+  80167f:	48 01 df             	add    %rbx,%rdi
+  801682:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  801686:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80168a:	48 b8 a7 15 80 00 00 	movabs $0x8015a7,%rax
+  801691:	00 00 00 
+  801694:	ff d0                	call   *%rax
+  801696:	41 89 c5             	mov    %eax,%r13d
+  801699:	85 c0                	test   %eax,%eax
+  80169b:	78 06                	js     8016a3 <fd_close+0x41>
+  80169d:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  8016a1:	74 1a                	je     8016bd <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  8016a3:	45 84 e4             	test   %r12b,%r12b
+  8016a6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016ab:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  8016af:	44 89 e8             	mov    %r13d,%eax
+  8016b2:	48 83 c4 18          	add    $0x18,%rsp
+  8016b6:	5b                   	pop    %rbx
+  8016b7:	41 5c                	pop    %r12
+  8016b9:	41 5d                	pop    %r13
+  8016bb:	5d                   	pop    %rbp
+  8016bc:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8016bd:	8b 3b                	mov    (%rbx),%edi
+  8016bf:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8016c3:	48 b8 f2 15 80 00 00 	movabs $0x8015f2,%rax
+  8016ca:	00 00 00 
+  8016cd:	ff d0                	call   *%rax
+  8016cf:	41 89 c5             	mov    %eax,%r13d
+  8016d2:	85 c0                	test   %eax,%eax
+  8016d4:	78 1b                	js     8016f1 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  8016d6:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8016da:	48 8b 40 20          	mov    0x20(%rax),%rax
+  8016de:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  8016e4:	48 85 c0             	test   %rax,%rax
+  8016e7:	74 08                	je     8016f1 <fd_close+0x8f>
+  8016e9:	48 89 df             	mov    %rbx,%rdi
+  8016ec:	ff d0                	call   *%rax
+  8016ee:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8016f1:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8016f6:	48 89 de             	mov    %rbx,%rsi
+  8016f9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8016fe:	48 b8 77 11 80 00 00 	movabs $0x801177,%rax
+  801705:	00 00 00 
+  801708:	ff d0                	call   *%rax
+    return res;
+  80170a:	eb a3                	jmp    8016af <fd_close+0x4d>
+
+000000000080170c <close>:
+
+int
+close(int fdnum) {
+  80170c:	55                   	push   %rbp
+  80170d:	48 89 e5             	mov    %rsp,%rbp
+  801710:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  801714:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801718:	48 b8 a7 15 80 00 00 	movabs $0x8015a7,%rax
+  80171f:	00 00 00 
+  801722:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801724:	85 c0                	test   %eax,%eax
+  801726:	78 15                	js     80173d <close+0x31>
+
+    return fd_close(fd, 1);
+  801728:	be 01 00 00 00       	mov    $0x1,%esi
+  80172d:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801731:	48 b8 62 16 80 00 00 	movabs $0x801662,%rax
+  801738:	00 00 00 
+  80173b:	ff d0                	call   *%rax
+}
+  80173d:	c9                   	leave
+  80173e:	c3                   	ret
+
+000000000080173f <close_all>:
+
+void
+close_all(void) {
+  80173f:	55                   	push   %rbp
+  801740:	48 89 e5             	mov    %rsp,%rbp
+  801743:	41 54                	push   %r12
+  801745:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  801746:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80174b:	49 bc 0c 17 80 00 00 	movabs $0x80170c,%r12
+  801752:	00 00 00 
+  801755:	89 df                	mov    %ebx,%edi
+  801757:	41 ff d4             	call   *%r12
+  80175a:	83 c3 01             	add    $0x1,%ebx
+  80175d:	83 fb 20             	cmp    $0x20,%ebx
+  801760:	75 f3                	jne    801755 <close_all+0x16>
+}
+  801762:	5b                   	pop    %rbx
+  801763:	41 5c                	pop    %r12
+  801765:	5d                   	pop    %rbp
+  801766:	c3                   	ret
+
+0000000000801767 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  801767:	55                   	push   %rbp
+  801768:	48 89 e5             	mov    %rsp,%rbp
+  80176b:	41 57                	push   %r15
+  80176d:	41 56                	push   %r14
+  80176f:	41 55                	push   %r13
+  801771:	41 54                	push   %r12
+  801773:	53                   	push   %rbx
+  801774:	48 83 ec 18          	sub    $0x18,%rsp
+  801778:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  80177b:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  80177f:	48 b8 a7 15 80 00 00 	movabs $0x8015a7,%rax
+  801786:	00 00 00 
+  801789:	ff d0                	call   *%rax
+  80178b:	89 c3                	mov    %eax,%ebx
+  80178d:	85 c0                	test   %eax,%eax
+  80178f:	0f 88 b8 00 00 00    	js     80184d <dup+0xe6>
+    close(newfdnum);
+  801795:	44 89 e7             	mov    %r12d,%edi
+  801798:	48 b8 0c 17 80 00 00 	movabs $0x80170c,%rax
+  80179f:	00 00 00 
+  8017a2:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  8017a4:	4d 63 ec             	movslq %r12d,%r13
+  8017a7:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  8017ae:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  8017b2:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  8017b6:	4c 89 ff             	mov    %r15,%rdi
+  8017b9:	49 be f8 14 80 00 00 	movabs $0x8014f8,%r14
+  8017c0:	00 00 00 
+  8017c3:	41 ff d6             	call   *%r14
+  8017c6:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  8017c9:	4c 89 ef             	mov    %r13,%rdi
+  8017cc:	41 ff d6             	call   *%r14
+  8017cf:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  8017d2:	48 89 df             	mov    %rbx,%rdi
+  8017d5:	48 b8 1d 26 80 00 00 	movabs $0x80261d,%rax
+  8017dc:	00 00 00 
+  8017df:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  8017e1:	a8 04                	test   $0x4,%al
+  8017e3:	74 2b                	je     801810 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  8017e5:	41 89 c1             	mov    %eax,%r9d
+  8017e8:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8017ee:	4c 89 f1             	mov    %r14,%rcx
+  8017f1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8017f6:	48 89 de             	mov    %rbx,%rsi
+  8017f9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8017fe:	48 b8 12 11 80 00 00 	movabs $0x801112,%rax
+  801805:	00 00 00 
+  801808:	ff d0                	call   *%rax
+  80180a:	89 c3                	mov    %eax,%ebx
+  80180c:	85 c0                	test   %eax,%eax
+  80180e:	78 4e                	js     80185e <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  801810:	4c 89 ff             	mov    %r15,%rdi
+  801813:	48 b8 1d 26 80 00 00 	movabs $0x80261d,%rax
+  80181a:	00 00 00 
+  80181d:	ff d0                	call   *%rax
+  80181f:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801822:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801828:	4c 89 e9             	mov    %r13,%rcx
+  80182b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801830:	4c 89 fe             	mov    %r15,%rsi
+  801833:	bf 00 00 00 00       	mov    $0x0,%edi
+  801838:	48 b8 12 11 80 00 00 	movabs $0x801112,%rax
+  80183f:	00 00 00 
+  801842:	ff d0                	call   *%rax
+  801844:	89 c3                	mov    %eax,%ebx
+  801846:	85 c0                	test   %eax,%eax
+  801848:	78 14                	js     80185e <dup+0xf7>
+
+    return newfdnum;
+  80184a:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  80184d:	89 d8                	mov    %ebx,%eax
+  80184f:	48 83 c4 18          	add    $0x18,%rsp
+  801853:	5b                   	pop    %rbx
+  801854:	41 5c                	pop    %r12
+  801856:	41 5d                	pop    %r13
+  801858:	41 5e                	pop    %r14
+  80185a:	41 5f                	pop    %r15
+  80185c:	5d                   	pop    %rbp
+  80185d:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  80185e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801863:	4c 89 ee             	mov    %r13,%rsi
+  801866:	bf 00 00 00 00       	mov    $0x0,%edi
+  80186b:	49 bc 77 11 80 00 00 	movabs $0x801177,%r12
+  801872:	00 00 00 
+  801875:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  801878:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80187d:	4c 89 f6             	mov    %r14,%rsi
+  801880:	bf 00 00 00 00       	mov    $0x0,%edi
+  801885:	41 ff d4             	call   *%r12
+    return res;
+  801888:	eb c3                	jmp    80184d <dup+0xe6>
+
+000000000080188a <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  80188a:	55                   	push   %rbp
+  80188b:	48 89 e5             	mov    %rsp,%rbp
+  80188e:	41 56                	push   %r14
+  801890:	41 55                	push   %r13
+  801892:	41 54                	push   %r12
+  801894:	53                   	push   %rbx
+  801895:	48 83 ec 10          	sub    $0x10,%rsp
+  801899:	89 fb                	mov    %edi,%ebx
+  80189b:	49 89 f4             	mov    %rsi,%r12
+  80189e:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8018a1:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8018a5:	48 b8 a7 15 80 00 00 	movabs $0x8015a7,%rax
+  8018ac:	00 00 00 
+  8018af:	ff d0                	call   *%rax
+  8018b1:	85 c0                	test   %eax,%eax
+  8018b3:	78 4c                	js     801901 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8018b5:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  8018b9:	41 8b 3e             	mov    (%r14),%edi
+  8018bc:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8018c0:	48 b8 f2 15 80 00 00 	movabs $0x8015f2,%rax
+  8018c7:	00 00 00 
+  8018ca:	ff d0                	call   *%rax
+  8018cc:	85 c0                	test   %eax,%eax
+  8018ce:	78 35                	js     801905 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8018d0:	41 8b 46 08          	mov    0x8(%r14),%eax
+  8018d4:	83 e0 03             	and    $0x3,%eax
+  8018d7:	83 f8 01             	cmp    $0x1,%eax
+  8018da:	74 2d                	je     801909 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  8018dc:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8018e0:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8018e4:	48 85 c0             	test   %rax,%rax
+  8018e7:	74 56                	je     80193f <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  8018e9:	4c 89 ea             	mov    %r13,%rdx
+  8018ec:	4c 89 e6             	mov    %r12,%rsi
+  8018ef:	4c 89 f7             	mov    %r14,%rdi
+  8018f2:	ff d0                	call   *%rax
+}
+  8018f4:	48 83 c4 10          	add    $0x10,%rsp
+  8018f8:	5b                   	pop    %rbx
+  8018f9:	41 5c                	pop    %r12
+  8018fb:	41 5d                	pop    %r13
+  8018fd:	41 5e                	pop    %r14
+  8018ff:	5d                   	pop    %rbp
+  801900:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801901:	48 98                	cltq
+  801903:	eb ef                	jmp    8018f4 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801905:	48 98                	cltq
+  801907:	eb eb                	jmp    8018f4 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801909:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801910:	00 00 00 
+  801913:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+  801919:	89 da                	mov    %ebx,%edx
+  80191b:	48 bf 81 32 80 00 00 	movabs $0x803281,%rdi
+  801922:	00 00 00 
+  801925:	b8 00 00 00 00       	mov    $0x0,%eax
+  80192a:	48 b9 d6 01 80 00 00 	movabs $0x8001d6,%rcx
+  801931:	00 00 00 
+  801934:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801936:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80193d:	eb b5                	jmp    8018f4 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  80193f:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801946:	eb ac                	jmp    8018f4 <read+0x6a>
+
+0000000000801948 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801948:	55                   	push   %rbp
+  801949:	48 89 e5             	mov    %rsp,%rbp
+  80194c:	41 57                	push   %r15
+  80194e:	41 56                	push   %r14
+  801950:	41 55                	push   %r13
+  801952:	41 54                	push   %r12
+  801954:	53                   	push   %rbx
+  801955:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  801959:	48 85 d2             	test   %rdx,%rdx
+  80195c:	74 54                	je     8019b2 <readn+0x6a>
+  80195e:	41 89 fd             	mov    %edi,%r13d
+  801961:	49 89 f6             	mov    %rsi,%r14
+  801964:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  801967:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  80196c:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  801971:	49 bf 8a 18 80 00 00 	movabs $0x80188a,%r15
+  801978:	00 00 00 
+  80197b:	4c 89 e2             	mov    %r12,%rdx
+  80197e:	48 29 f2             	sub    %rsi,%rdx
+  801981:	4c 01 f6             	add    %r14,%rsi
+  801984:	44 89 ef             	mov    %r13d,%edi
+  801987:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  80198a:	85 c0                	test   %eax,%eax
+  80198c:	78 20                	js     8019ae <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  80198e:	01 c3                	add    %eax,%ebx
+  801990:	85 c0                	test   %eax,%eax
+  801992:	74 08                	je     80199c <readn+0x54>
+  801994:	48 63 f3             	movslq %ebx,%rsi
+  801997:	4c 39 e6             	cmp    %r12,%rsi
+  80199a:	72 df                	jb     80197b <readn+0x33>
+    }
+    return res;
+  80199c:	48 63 c3             	movslq %ebx,%rax
+}
+  80199f:	48 83 c4 08          	add    $0x8,%rsp
+  8019a3:	5b                   	pop    %rbx
+  8019a4:	41 5c                	pop    %r12
+  8019a6:	41 5d                	pop    %r13
+  8019a8:	41 5e                	pop    %r14
+  8019aa:	41 5f                	pop    %r15
+  8019ac:	5d                   	pop    %rbp
+  8019ad:	c3                   	ret
+        if (inc < 0) return inc;
+  8019ae:	48 98                	cltq
+  8019b0:	eb ed                	jmp    80199f <readn+0x57>
+    int inc = 1, res = 0;
+  8019b2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8019b7:	eb e3                	jmp    80199c <readn+0x54>
+
+00000000008019b9 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  8019b9:	55                   	push   %rbp
+  8019ba:	48 89 e5             	mov    %rsp,%rbp
+  8019bd:	41 56                	push   %r14
+  8019bf:	41 55                	push   %r13
+  8019c1:	41 54                	push   %r12
+  8019c3:	53                   	push   %rbx
+  8019c4:	48 83 ec 10          	sub    $0x10,%rsp
+  8019c8:	89 fb                	mov    %edi,%ebx
+  8019ca:	49 89 f4             	mov    %rsi,%r12
+  8019cd:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8019d0:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8019d4:	48 b8 a7 15 80 00 00 	movabs $0x8015a7,%rax
+  8019db:	00 00 00 
+  8019de:	ff d0                	call   *%rax
+  8019e0:	85 c0                	test   %eax,%eax
+  8019e2:	78 47                	js     801a2b <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8019e4:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  8019e8:	41 8b 3e             	mov    (%r14),%edi
+  8019eb:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8019ef:	48 b8 f2 15 80 00 00 	movabs $0x8015f2,%rax
+  8019f6:	00 00 00 
+  8019f9:	ff d0                	call   *%rax
+  8019fb:	85 c0                	test   %eax,%eax
+  8019fd:	78 30                	js     801a2f <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8019ff:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  801a04:	74 2d                	je     801a33 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801a06:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801a0a:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801a0e:	48 85 c0             	test   %rax,%rax
+  801a11:	74 56                	je     801a69 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  801a13:	4c 89 ea             	mov    %r13,%rdx
+  801a16:	4c 89 e6             	mov    %r12,%rsi
+  801a19:	4c 89 f7             	mov    %r14,%rdi
+  801a1c:	ff d0                	call   *%rax
+}
+  801a1e:	48 83 c4 10          	add    $0x10,%rsp
+  801a22:	5b                   	pop    %rbx
+  801a23:	41 5c                	pop    %r12
+  801a25:	41 5d                	pop    %r13
+  801a27:	41 5e                	pop    %r14
+  801a29:	5d                   	pop    %rbp
+  801a2a:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801a2b:	48 98                	cltq
+  801a2d:	eb ef                	jmp    801a1e <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801a2f:	48 98                	cltq
+  801a31:	eb eb                	jmp    801a1e <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801a33:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801a3a:	00 00 00 
+  801a3d:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+  801a43:	89 da                	mov    %ebx,%edx
+  801a45:	48 bf 9d 32 80 00 00 	movabs $0x80329d,%rdi
+  801a4c:	00 00 00 
+  801a4f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a54:	48 b9 d6 01 80 00 00 	movabs $0x8001d6,%rcx
+  801a5b:	00 00 00 
+  801a5e:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801a60:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801a67:	eb b5                	jmp    801a1e <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801a69:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801a70:	eb ac                	jmp    801a1e <write+0x65>
+
+0000000000801a72 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  801a72:	55                   	push   %rbp
+  801a73:	48 89 e5             	mov    %rsp,%rbp
+  801a76:	53                   	push   %rbx
+  801a77:	48 83 ec 18          	sub    $0x18,%rsp
+  801a7b:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801a7d:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801a81:	48 b8 a7 15 80 00 00 	movabs $0x8015a7,%rax
+  801a88:	00 00 00 
+  801a8b:	ff d0                	call   *%rax
+  801a8d:	85 c0                	test   %eax,%eax
+  801a8f:	78 0c                	js     801a9d <seek+0x2b>
+
+    fd->fd_offset = offset;
+  801a91:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801a95:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  801a98:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801a9d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801aa1:	c9                   	leave
+  801aa2:	c3                   	ret
+
+0000000000801aa3 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  801aa3:	55                   	push   %rbp
+  801aa4:	48 89 e5             	mov    %rsp,%rbp
+  801aa7:	41 55                	push   %r13
+  801aa9:	41 54                	push   %r12
+  801aab:	53                   	push   %rbx
+  801aac:	48 83 ec 18          	sub    $0x18,%rsp
+  801ab0:	89 fb                	mov    %edi,%ebx
+  801ab2:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801ab5:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801ab9:	48 b8 a7 15 80 00 00 	movabs $0x8015a7,%rax
+  801ac0:	00 00 00 
+  801ac3:	ff d0                	call   *%rax
+  801ac5:	85 c0                	test   %eax,%eax
+  801ac7:	78 38                	js     801b01 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801ac9:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  801acd:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  801ad1:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801ad5:	48 b8 f2 15 80 00 00 	movabs $0x8015f2,%rax
+  801adc:	00 00 00 
+  801adf:	ff d0                	call   *%rax
+  801ae1:	85 c0                	test   %eax,%eax
+  801ae3:	78 1c                	js     801b01 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801ae5:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  801aea:	74 20                	je     801b0c <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801aec:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801af0:	48 8b 40 30          	mov    0x30(%rax),%rax
+  801af4:	48 85 c0             	test   %rax,%rax
+  801af7:	74 47                	je     801b40 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  801af9:	44 89 e6             	mov    %r12d,%esi
+  801afc:	4c 89 ef             	mov    %r13,%rdi
+  801aff:	ff d0                	call   *%rax
+}
+  801b01:	48 83 c4 18          	add    $0x18,%rsp
+  801b05:	5b                   	pop    %rbx
+  801b06:	41 5c                	pop    %r12
+  801b08:	41 5d                	pop    %r13
+  801b0a:	5d                   	pop    %rbp
+  801b0b:	c3                   	ret
+                thisenv->env_id, fdnum);
+  801b0c:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801b13:	00 00 00 
+  801b16:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801b1c:	89 da                	mov    %ebx,%edx
+  801b1e:	48 bf 60 32 80 00 00 	movabs $0x803260,%rdi
+  801b25:	00 00 00 
+  801b28:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b2d:	48 b9 d6 01 80 00 00 	movabs $0x8001d6,%rcx
+  801b34:	00 00 00 
+  801b37:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801b39:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801b3e:	eb c1                	jmp    801b01 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801b40:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801b45:	eb ba                	jmp    801b01 <ftruncate+0x5e>
+
+0000000000801b47 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  801b47:	55                   	push   %rbp
+  801b48:	48 89 e5             	mov    %rsp,%rbp
+  801b4b:	41 54                	push   %r12
+  801b4d:	53                   	push   %rbx
+  801b4e:	48 83 ec 10          	sub    $0x10,%rsp
+  801b52:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801b55:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801b59:	48 b8 a7 15 80 00 00 	movabs $0x8015a7,%rax
+  801b60:	00 00 00 
+  801b63:	ff d0                	call   *%rax
+  801b65:	85 c0                	test   %eax,%eax
+  801b67:	78 4e                	js     801bb7 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801b69:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801b6d:	41 8b 3c 24          	mov    (%r12),%edi
+  801b71:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801b75:	48 b8 f2 15 80 00 00 	movabs $0x8015f2,%rax
+  801b7c:	00 00 00 
+  801b7f:	ff d0                	call   *%rax
+  801b81:	85 c0                	test   %eax,%eax
+  801b83:	78 32                	js     801bb7 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801b85:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801b89:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  801b8e:	74 30                	je     801bc0 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  801b90:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  801b93:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  801b9a:	00 00 00 
+    stat->st_isdir = 0;
+  801b9d:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  801ba4:	00 00 00 
+    stat->st_dev = dev;
+  801ba7:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  801bae:	48 89 de             	mov    %rbx,%rsi
+  801bb1:	4c 89 e7             	mov    %r12,%rdi
+  801bb4:	ff 50 28             	call   *0x28(%rax)
+}
+  801bb7:	48 83 c4 10          	add    $0x10,%rsp
+  801bbb:	5b                   	pop    %rbx
+  801bbc:	41 5c                	pop    %r12
+  801bbe:	5d                   	pop    %rbp
+  801bbf:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801bc0:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801bc5:	eb f0                	jmp    801bb7 <fstat+0x70>
+
+0000000000801bc7 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  801bc7:	55                   	push   %rbp
+  801bc8:	48 89 e5             	mov    %rsp,%rbp
+  801bcb:	41 54                	push   %r12
+  801bcd:	53                   	push   %rbx
+  801bce:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  801bd1:	be 00 00 00 00       	mov    $0x0,%esi
+  801bd6:	48 b8 aa 1f 80 00 00 	movabs $0x801faa,%rax
+  801bdd:	00 00 00 
+  801be0:	ff d0                	call   *%rax
+  801be2:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  801be4:	85 c0                	test   %eax,%eax
+  801be6:	78 25                	js     801c0d <stat+0x46>
+
+    int res = fstat(fd, stat);
+  801be8:	4c 89 e6             	mov    %r12,%rsi
+  801beb:	89 c7                	mov    %eax,%edi
+  801bed:	48 b8 47 1b 80 00 00 	movabs $0x801b47,%rax
+  801bf4:	00 00 00 
+  801bf7:	ff d0                	call   *%rax
+  801bf9:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  801bfc:	89 df                	mov    %ebx,%edi
+  801bfe:	48 b8 0c 17 80 00 00 	movabs $0x80170c,%rax
+  801c05:	00 00 00 
+  801c08:	ff d0                	call   *%rax
+
+    return res;
+  801c0a:	44 89 e3             	mov    %r12d,%ebx
+}
+  801c0d:	89 d8                	mov    %ebx,%eax
+  801c0f:	5b                   	pop    %rbx
+  801c10:	41 5c                	pop    %r12
+  801c12:	5d                   	pop    %rbp
+  801c13:	c3                   	ret
+
+0000000000801c14 <fsipc>:
+ * response may be written back to fsipcbuf.
+ * type: request code, passed as the simple integer IPC value.
+ * dstva: virtual address at which to receive reply page, 0 if none.
+ * Returns result from the file server. */
+static int
+fsipc(unsigned type, void *dstva) {
+  801c14:	55                   	push   %rbp
+  801c15:	48 89 e5             	mov    %rsp,%rbp
+  801c18:	41 54                	push   %r12
+  801c1a:	53                   	push   %rbx
+  801c1b:	48 83 ec 10          	sub    $0x10,%rsp
+  801c1f:	41 89 fc             	mov    %edi,%r12d
+  801c22:	48 89 f3             	mov    %rsi,%rbx
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  801c25:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  801c2c:	00 00 00 
+  801c2f:	83 38 00             	cmpl   $0x0,(%rax)
+  801c32:	74 5e                	je     801c92 <fsipc+0x7e>
+    if (debug) {
+        cprintf("[%08x] fsipc %d %08x\n",
+                thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+    }
+
+    ipc_send(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW);
+  801c34:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  801c3a:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  801c3f:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  801c46:	00 00 00 
+  801c49:	44 89 e6             	mov    %r12d,%esi
+  801c4c:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  801c53:	00 00 00 
+  801c56:	8b 38                	mov    (%rax),%edi
+  801c58:	48 b8 b4 2b 80 00 00 	movabs $0x802bb4,%rax
+  801c5f:	00 00 00 
+  801c62:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  801c64:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  801c6b:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  801c6c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801c71:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  801c75:	48 89 de             	mov    %rbx,%rsi
+  801c78:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c7d:	48 b8 df 2a 80 00 00 	movabs $0x802adf,%rax
+  801c84:	00 00 00 
+  801c87:	ff d0                	call   *%rax
+}
+  801c89:	48 83 c4 10          	add    $0x10,%rsp
+  801c8d:	5b                   	pop    %rbx
+  801c8e:	41 5c                	pop    %r12
+  801c90:	5d                   	pop    %rbp
+  801c91:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  801c92:	bf 03 00 00 00       	mov    $0x3,%edi
+  801c97:	48 b8 57 2c 80 00 00 	movabs $0x802c57,%rax
+  801c9e:	00 00 00 
+  801ca1:	ff d0                	call   *%rax
+  801ca3:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  801caa:	00 00 
+  801cac:	eb 86                	jmp    801c34 <fsipc+0x20>
+
+0000000000801cae <devfile_trunc>:
+    return 0;
+}
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  801cae:	55                   	push   %rbp
+  801caf:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801cb2:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  801cb9:	00 00 00 
+  801cbc:	8b 57 0c             	mov    0xc(%rdi),%edx
+  801cbf:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  801cc1:	89 70 04             	mov    %esi,0x4(%rax)
+
+    return fsipc(FSREQ_SET_SIZE, NULL);
+  801cc4:	be 00 00 00 00       	mov    $0x0,%esi
+  801cc9:	bf 02 00 00 00       	mov    $0x2,%edi
+  801cce:	48 b8 14 1c 80 00 00 	movabs $0x801c14,%rax
+  801cd5:	00 00 00 
+  801cd8:	ff d0                	call   *%rax
+}
+  801cda:	5d                   	pop    %rbp
+  801cdb:	c3                   	ret
+
+0000000000801cdc <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  801cdc:	55                   	push   %rbp
+  801cdd:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801ce0:	8b 47 0c             	mov    0xc(%rdi),%eax
+  801ce3:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  801cea:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  801cec:	be 00 00 00 00       	mov    $0x0,%esi
+  801cf1:	bf 06 00 00 00       	mov    $0x6,%edi
+  801cf6:	48 b8 14 1c 80 00 00 	movabs $0x801c14,%rax
+  801cfd:	00 00 00 
+  801d00:	ff d0                	call   *%rax
+}
+  801d02:	5d                   	pop    %rbp
+  801d03:	c3                   	ret
+
+0000000000801d04 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  801d04:	55                   	push   %rbp
+  801d05:	48 89 e5             	mov    %rsp,%rbp
+  801d08:	41 54                	push   %r12
+  801d0a:	53                   	push   %rbx
+  801d0b:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801d0e:	8b 47 0c             	mov    0xc(%rdi),%eax
+  801d11:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  801d18:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  801d1a:	be 00 00 00 00       	mov    $0x0,%esi
+  801d1f:	bf 05 00 00 00       	mov    $0x5,%edi
+  801d24:	48 b8 14 1c 80 00 00 	movabs $0x801c14,%rax
+  801d2b:	00 00 00 
+  801d2e:	ff d0                	call   *%rax
+    if (res < 0) {
+  801d30:	85 c0                	test   %eax,%eax
+  801d32:	78 3d                	js     801d71 <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801d34:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  801d3b:	00 00 00 
+  801d3e:	4c 89 e6             	mov    %r12,%rsi
+  801d41:	48 89 df             	mov    %rbx,%rdi
+  801d44:	48 b8 fb 0a 80 00 00 	movabs $0x800afb,%rax
+  801d4b:	00 00 00 
+  801d4e:	ff d0                	call   *%rax
+    st->st_size  = fsipcbuf.statRet.ret_size;
+  801d50:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  801d57:	00 
+  801d58:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801d5e:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  801d65:	00 
+  801d66:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  801d6c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801d71:	5b                   	pop    %rbx
+  801d72:	41 5c                	pop    %r12
+  801d74:	5d                   	pop    %rbp
+  801d75:	c3                   	ret
+
+0000000000801d76 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  801d76:	55                   	push   %rbp
+  801d77:	48 89 e5             	mov    %rsp,%rbp
+  801d7a:	41 57                	push   %r15
+  801d7c:	41 56                	push   %r14
+  801d7e:	41 55                	push   %r13
+  801d80:	41 54                	push   %r12
+  801d82:	53                   	push   %rbx
+  801d83:	48 83 ec 18          	sub    $0x18,%rsp
+  801d87:	49 89 fe             	mov    %rdi,%r14
+  801d8a:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+  801d8e:	48 89 d3             	mov    %rdx,%rbx
+    while (n > sizeof(fsipcbuf.write.req_buf))
+  801d91:	48 81 fa f0 0f 00 00 	cmp    $0xff0,%rdx
+  801d98:	0f 86 e4 00 00 00    	jbe    801e82 <devfile_write+0x10c>
+  801d9e:	49 89 f4             	mov    %rsi,%r12
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801da1:	49 bd 00 60 80 00 00 	movabs $0x806000,%r13
+  801da8:	00 00 00 
+        memcpy(fsipcbuf.write.req_buf, buf, sizeof(fsipcbuf.write.req_buf));
+  801dab:	49 bf 5c 0d 80 00 00 	movabs $0x800d5c,%r15
+  801db2:	00 00 00 
+  801db5:	eb 03                	jmp    801dba <devfile_write+0x44>
+        buf += sizeof(fsipcbuf.write.req_buf);
+  801db7:	49 89 f4             	mov    %rsi,%r12
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801dba:	41 8b 46 0c          	mov    0xc(%r14),%eax
+  801dbe:	41 89 45 00          	mov    %eax,0x0(%r13)
+        fsipcbuf.write.req_n      = sizeof(fsipcbuf.write.req_buf);
+  801dc2:	49 c7 45 08 f0 0f 00 	movq   $0xff0,0x8(%r13)
+  801dc9:	00 
+        memcpy(fsipcbuf.write.req_buf, buf, sizeof(fsipcbuf.write.req_buf));
+  801dca:	ba f0 0f 00 00       	mov    $0xff0,%edx
+  801dcf:	4c 89 e6             	mov    %r12,%rsi
+  801dd2:	48 bf 10 60 80 00 00 	movabs $0x806010,%rdi
+  801dd9:	00 00 00 
+  801ddc:	41 ff d7             	call   *%r15
+        ssize_t res = fsipc(FSREQ_WRITE, NULL);
+  801ddf:	be 00 00 00 00       	mov    $0x0,%esi
+  801de4:	bf 04 00 00 00       	mov    $0x4,%edi
+  801de9:	48 b8 14 1c 80 00 00 	movabs $0x801c14,%rax
+  801df0:	00 00 00 
+  801df3:	ff d0                	call   *%rax
+  801df5:	48 63 d0             	movslq %eax,%rdx
+        if (res < 0 || res < sizeof(fsipcbuf.write.req_buf))
+  801df8:	3d ef 0f 00 00       	cmp    $0xfef,%eax
+  801dfd:	7e 71                	jle    801e70 <devfile_write+0xfa>
+        buf += sizeof(fsipcbuf.write.req_buf);
+  801dff:	49 8d b4 24 f0 0f 00 	lea    0xff0(%r12),%rsi
+  801e06:	00 
+        n -= sizeof(fsipcbuf.write.req_buf);
+  801e07:	48 81 eb f0 0f 00 00 	sub    $0xff0,%rbx
+    while (n > sizeof(fsipcbuf.write.req_buf))
+  801e0e:	48 81 fb f0 0f 00 00 	cmp    $0xff0,%rbx
+  801e15:	77 a0                	ja     801db7 <devfile_write+0x41>
+        written += sizeof(fsipcbuf.write.req_buf);
+  801e17:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801e1b:	49 29 c4             	sub    %rax,%r12
+  801e1e:	4d 8d a4 24 f0 0f 00 	lea    0xff0(%r12),%r12
+  801e25:	00 
+    fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801e26:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  801e2d:	00 00 00 
+  801e30:	41 8b 56 0c          	mov    0xc(%r14),%edx
+  801e34:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.write.req_n      = n;
+  801e36:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    memcpy(fsipcbuf.write.req_buf, buf, n);
+  801e3a:	48 89 da             	mov    %rbx,%rdx
+  801e3d:	48 8d 78 10          	lea    0x10(%rax),%rdi
+  801e41:	48 b8 5c 0d 80 00 00 	movabs $0x800d5c,%rax
+  801e48:	00 00 00 
+  801e4b:	ff d0                	call   *%rax
+    ssize_t res = fsipc(FSREQ_WRITE, NULL);
+  801e4d:	be 00 00 00 00       	mov    $0x0,%esi
+  801e52:	bf 04 00 00 00       	mov    $0x4,%edi
+  801e57:	48 b8 14 1c 80 00 00 	movabs $0x801c14,%rax
+  801e5e:	00 00 00 
+  801e61:	ff d0                	call   *%rax
+  801e63:	48 63 d0             	movslq %eax,%rdx
+    written += res;
+  801e66:	49 01 d4             	add    %rdx,%r12
+  801e69:	48 85 d2             	test   %rdx,%rdx
+  801e6c:	49 0f 49 d4          	cmovns %r12,%rdx
+}
+  801e70:	48 89 d0             	mov    %rdx,%rax
+  801e73:	48 83 c4 18          	add    $0x18,%rsp
+  801e77:	5b                   	pop    %rbx
+  801e78:	41 5c                	pop    %r12
+  801e7a:	41 5d                	pop    %r13
+  801e7c:	41 5e                	pop    %r14
+  801e7e:	41 5f                	pop    %r15
+  801e80:	5d                   	pop    %rbp
+  801e81:	c3                   	ret
+    while (n > sizeof(fsipcbuf.write.req_buf))
+  801e82:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+    ssize_t written = 0;
+  801e86:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  801e8c:	eb 98                	jmp    801e26 <devfile_write+0xb0>
+
+0000000000801e8e <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  801e8e:	55                   	push   %rbp
+  801e8f:	48 89 e5             	mov    %rsp,%rbp
+  801e92:	41 57                	push   %r15
+  801e94:	41 56                	push   %r14
+  801e96:	41 55                	push   %r13
+  801e98:	41 54                	push   %r12
+  801e9a:	53                   	push   %rbx
+  801e9b:	48 83 ec 18          	sub    $0x18,%rsp
+  801e9f:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  801ea3:	49 89 f6             	mov    %rsi,%r14
+  801ea6:	49 89 d4             	mov    %rdx,%r12
+    while (n > sizeof(fsipcbuf.readRet.ret_buf))
+  801ea9:	48 81 fa 00 10 00 00 	cmp    $0x1000,%rdx
+  801eb0:	0f 86 ea 00 00 00    	jbe    801fa0 <devfile_read+0x112>
+    ssize_t readsz = 0;
+  801eb6:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  801ebd:	00 
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801ebe:	49 bf 00 60 80 00 00 	movabs $0x806000,%r15
+  801ec5:	00 00 00 
+  801ec8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801ecc:	8b 40 0c             	mov    0xc(%rax),%eax
+  801ecf:	41 89 07             	mov    %eax,(%r15)
+        fsipcbuf.read.req_n = sizeof(fsipcbuf.readRet.ret_buf);
+  801ed2:	49 c7 47 08 00 10 00 	movq   $0x1000,0x8(%r15)
+  801ed9:	00 
+        ssize_t res = fsipc(FSREQ_READ, NULL);
+  801eda:	be 00 00 00 00       	mov    $0x0,%esi
+  801edf:	bf 03 00 00 00       	mov    $0x3,%edi
+  801ee4:	48 b8 14 1c 80 00 00 	movabs $0x801c14,%rax
+  801eeb:	00 00 00 
+  801eee:	ff d0                	call   *%rax
+  801ef0:	4c 63 e8             	movslq %eax,%r13
+        if (res < 0)
+  801ef3:	4d 85 ed             	test   %r13,%r13
+  801ef6:	0f 88 92 00 00 00    	js     801f8e <devfile_read+0x100>
+        memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  801efc:	4c 89 ea             	mov    %r13,%rdx
+  801eff:	4c 89 fe             	mov    %r15,%rsi
+  801f02:	4c 89 f7             	mov    %r14,%rdi
+  801f05:	48 b8 5c 0d 80 00 00 	movabs $0x800d5c,%rax
+  801f0c:	00 00 00 
+  801f0f:	ff d0                	call   *%rax
+        if (res < sizeof(fsipcbuf.readRet.ret_buf))
+  801f11:	49 81 fd ff 0f 00 00 	cmp    $0xfff,%r13
+  801f18:	76 6d                	jbe    801f87 <devfile_read+0xf9>
+        readsz += res;
+  801f1a:	4c 01 6d c0          	add    %r13,-0x40(%rbp)
+        buf += res;
+  801f1e:	4d 01 ee             	add    %r13,%r14
+        n -= res;
+  801f21:	4d 29 ec             	sub    %r13,%r12
+    while (n > sizeof(fsipcbuf.readRet.ret_buf))
+  801f24:	49 81 fc 00 10 00 00 	cmp    $0x1000,%r12
+  801f2b:	77 9b                	ja     801ec8 <devfile_read+0x3a>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801f2d:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  801f34:	00 00 00 
+  801f37:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  801f3b:	8b 51 0c             	mov    0xc(%rcx),%edx
+  801f3e:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.read.req_n = n;
+  801f40:	4c 89 60 08          	mov    %r12,0x8(%rax)
+    ssize_t res = fsipc(FSREQ_READ, NULL);
+  801f44:	be 00 00 00 00       	mov    $0x0,%esi
+  801f49:	bf 03 00 00 00       	mov    $0x3,%edi
+  801f4e:	48 b8 14 1c 80 00 00 	movabs $0x801c14,%rax
+  801f55:	00 00 00 
+  801f58:	ff d0                	call   *%rax
+  801f5a:	4c 63 e8             	movslq %eax,%r13
+    if (res < 0)
+  801f5d:	4d 85 ed             	test   %r13,%r13
+  801f60:	78 2c                	js     801f8e <devfile_read+0x100>
+    memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  801f62:	4c 89 ea             	mov    %r13,%rdx
+  801f65:	48 be 00 60 80 00 00 	movabs $0x806000,%rsi
+  801f6c:	00 00 00 
+  801f6f:	4c 89 f7             	mov    %r14,%rdi
+  801f72:	48 b8 5c 0d 80 00 00 	movabs $0x800d5c,%rax
+  801f79:	00 00 00 
+  801f7c:	ff d0                	call   *%rax
+    readsz += res;
+  801f7e:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  801f82:	49 01 c5             	add    %rax,%r13
+    return readsz;
+  801f85:	eb 07                	jmp    801f8e <devfile_read+0x100>
+            return readsz + res;
+  801f87:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  801f8b:	49 01 c5             	add    %rax,%r13
+}
+  801f8e:	4c 89 e8             	mov    %r13,%rax
+  801f91:	48 83 c4 18          	add    $0x18,%rsp
+  801f95:	5b                   	pop    %rbx
+  801f96:	41 5c                	pop    %r12
+  801f98:	41 5d                	pop    %r13
+  801f9a:	41 5e                	pop    %r14
+  801f9c:	41 5f                	pop    %r15
+  801f9e:	5d                   	pop    %rbp
+  801f9f:	c3                   	ret
+    ssize_t readsz = 0;
+  801fa0:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  801fa7:	00 
+  801fa8:	eb 83                	jmp    801f2d <devfile_read+0x9f>
+
+0000000000801faa <open>:
+open(const char *path, int mode) {
+  801faa:	55                   	push   %rbp
+  801fab:	48 89 e5             	mov    %rsp,%rbp
+  801fae:	41 55                	push   %r13
+  801fb0:	41 54                	push   %r12
+  801fb2:	53                   	push   %rbx
+  801fb3:	48 83 ec 18          	sub    $0x18,%rsp
+  801fb7:	49 89 fc             	mov    %rdi,%r12
+  801fba:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  801fbd:	48 b8 bd 0a 80 00 00 	movabs $0x800abd,%rax
+  801fc4:	00 00 00 
+  801fc7:	ff d0                	call   *%rax
+  801fc9:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  801fcf:	0f 87 8a 00 00 00    	ja     80205f <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  801fd5:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  801fd9:	48 b8 8d 15 80 00 00 	movabs $0x80158d,%rax
+  801fe0:	00 00 00 
+  801fe3:	ff d0                	call   *%rax
+  801fe5:	89 c3                	mov    %eax,%ebx
+  801fe7:	85 c0                	test   %eax,%eax
+  801fe9:	78 50                	js     80203b <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  801feb:	4c 89 e6             	mov    %r12,%rsi
+  801fee:	48 bb 00 60 80 00 00 	movabs $0x806000,%rbx
+  801ff5:	00 00 00 
+  801ff8:	48 89 df             	mov    %rbx,%rdi
+  801ffb:	48 b8 fb 0a 80 00 00 	movabs $0x800afb,%rax
+  802002:	00 00 00 
+  802005:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  802007:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  80200e:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802012:	bf 01 00 00 00       	mov    $0x1,%edi
+  802017:	48 b8 14 1c 80 00 00 	movabs $0x801c14,%rax
+  80201e:	00 00 00 
+  802021:	ff d0                	call   *%rax
+  802023:	89 c3                	mov    %eax,%ebx
+  802025:	85 c0                	test   %eax,%eax
+  802027:	78 1f                	js     802048 <open+0x9e>
+    return fd2num(fd);
+  802029:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80202d:	48 b8 e6 14 80 00 00 	movabs $0x8014e6,%rax
+  802034:	00 00 00 
+  802037:	ff d0                	call   *%rax
+  802039:	89 c3                	mov    %eax,%ebx
+}
+  80203b:	89 d8                	mov    %ebx,%eax
+  80203d:	48 83 c4 18          	add    $0x18,%rsp
+  802041:	5b                   	pop    %rbx
+  802042:	41 5c                	pop    %r12
+  802044:	41 5d                	pop    %r13
+  802046:	5d                   	pop    %rbp
+  802047:	c3                   	ret
+        fd_close(fd, 0);
+  802048:	be 00 00 00 00       	mov    $0x0,%esi
+  80204d:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802051:	48 b8 62 16 80 00 00 	movabs $0x801662,%rax
+  802058:	00 00 00 
+  80205b:	ff d0                	call   *%rax
+        return res;
+  80205d:	eb dc                	jmp    80203b <open+0x91>
+        return -E_BAD_PATH;
+  80205f:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  802064:	eb d5                	jmp    80203b <open+0x91>
+
+0000000000802066 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  802066:	55                   	push   %rbp
+  802067:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc(FSREQ_SYNC, NULL);
+  80206a:	be 00 00 00 00       	mov    $0x0,%esi
+  80206f:	bf 08 00 00 00       	mov    $0x8,%edi
+  802074:	48 b8 14 1c 80 00 00 	movabs $0x801c14,%rax
+  80207b:	00 00 00 
+  80207e:	ff d0                	call   *%rax
+}
+  802080:	5d                   	pop    %rbp
+  802081:	c3                   	ret
+
+0000000000802082 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  802082:	55                   	push   %rbp
+  802083:	48 89 e5             	mov    %rsp,%rbp
+  802086:	41 54                	push   %r12
+  802088:	53                   	push   %rbx
+  802089:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80208c:	48 b8 f8 14 80 00 00 	movabs $0x8014f8,%rax
+  802093:	00 00 00 
+  802096:	ff d0                	call   *%rax
+  802098:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  80209b:	48 be e0 32 80 00 00 	movabs $0x8032e0,%rsi
+  8020a2:	00 00 00 
+  8020a5:	48 89 df             	mov    %rbx,%rdi
+  8020a8:	48 b8 fb 0a 80 00 00 	movabs $0x800afb,%rax
+  8020af:	00 00 00 
+  8020b2:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  8020b4:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  8020b9:	41 2b 04 24          	sub    (%r12),%eax
+  8020bd:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  8020c3:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8020ca:	00 00 00 
+    stat->st_dev = &devpipe;
+  8020cd:	48 b8 60 40 80 00 00 	movabs $0x804060,%rax
+  8020d4:	00 00 00 
+  8020d7:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  8020de:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020e3:	5b                   	pop    %rbx
+  8020e4:	41 5c                	pop    %r12
+  8020e6:	5d                   	pop    %rbp
+  8020e7:	c3                   	ret
+
+00000000008020e8 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  8020e8:	55                   	push   %rbp
+  8020e9:	48 89 e5             	mov    %rsp,%rbp
+  8020ec:	41 54                	push   %r12
+  8020ee:	53                   	push   %rbx
+  8020ef:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8020f2:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8020f7:	48 89 fe             	mov    %rdi,%rsi
+  8020fa:	bf 00 00 00 00       	mov    $0x0,%edi
+  8020ff:	49 bc 77 11 80 00 00 	movabs $0x801177,%r12
+  802106:	00 00 00 
+  802109:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  80210c:	48 89 df             	mov    %rbx,%rdi
+  80210f:	48 b8 f8 14 80 00 00 	movabs $0x8014f8,%rax
+  802116:	00 00 00 
+  802119:	ff d0                	call   *%rax
+  80211b:	48 89 c6             	mov    %rax,%rsi
+  80211e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802123:	bf 00 00 00 00       	mov    $0x0,%edi
+  802128:	41 ff d4             	call   *%r12
+}
+  80212b:	5b                   	pop    %rbx
+  80212c:	41 5c                	pop    %r12
+  80212e:	5d                   	pop    %rbp
+  80212f:	c3                   	ret
+
+0000000000802130 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  802130:	55                   	push   %rbp
+  802131:	48 89 e5             	mov    %rsp,%rbp
+  802134:	41 57                	push   %r15
+  802136:	41 56                	push   %r14
+  802138:	41 55                	push   %r13
+  80213a:	41 54                	push   %r12
+  80213c:	53                   	push   %rbx
+  80213d:	48 83 ec 18          	sub    $0x18,%rsp
+  802141:	49 89 fc             	mov    %rdi,%r12
+  802144:	49 89 f5             	mov    %rsi,%r13
+  802147:	49 89 d7             	mov    %rdx,%r15
+  80214a:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80214e:	48 b8 f8 14 80 00 00 	movabs $0x8014f8,%rax
+  802155:	00 00 00 
+  802158:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  80215a:	4d 85 ff             	test   %r15,%r15
+  80215d:	0f 84 af 00 00 00    	je     802212 <devpipe_write+0xe2>
+  802163:	48 89 c3             	mov    %rax,%rbx
+  802166:	4c 89 f8             	mov    %r15,%rax
+  802169:	4d 89 ef             	mov    %r13,%r15
+  80216c:	4c 01 e8             	add    %r13,%rax
+  80216f:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802173:	49 bd 7f 10 80 00 00 	movabs $0x80107f,%r13
+  80217a:	00 00 00 
+            sys_yield();
+  80217d:	49 be 1c 10 80 00 00 	movabs $0x80101c,%r14
+  802184:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  802187:	8b 73 04             	mov    0x4(%rbx),%esi
+  80218a:	48 63 ce             	movslq %esi,%rcx
+  80218d:	48 63 03             	movslq (%rbx),%rax
+  802190:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  802196:	48 39 c1             	cmp    %rax,%rcx
+  802199:	72 2e                	jb     8021c9 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80219b:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8021a0:	48 89 da             	mov    %rbx,%rdx
+  8021a3:	be 00 10 00 00       	mov    $0x1000,%esi
+  8021a8:	4c 89 e7             	mov    %r12,%rdi
+  8021ab:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  8021ae:	85 c0                	test   %eax,%eax
+  8021b0:	74 66                	je     802218 <devpipe_write+0xe8>
+            sys_yield();
+  8021b2:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  8021b5:	8b 73 04             	mov    0x4(%rbx),%esi
+  8021b8:	48 63 ce             	movslq %esi,%rcx
+  8021bb:	48 63 03             	movslq (%rbx),%rax
+  8021be:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  8021c4:	48 39 c1             	cmp    %rax,%rcx
+  8021c7:	73 d2                	jae    80219b <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8021c9:	41 0f b6 3f          	movzbl (%r15),%edi
+  8021cd:	48 89 ca             	mov    %rcx,%rdx
+  8021d0:	48 c1 ea 03          	shr    $0x3,%rdx
+  8021d4:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  8021db:	08 10 20 
+  8021de:	48 f7 e2             	mul    %rdx
+  8021e1:	48 c1 ea 06          	shr    $0x6,%rdx
+  8021e5:	48 89 d0             	mov    %rdx,%rax
+  8021e8:	48 c1 e0 09          	shl    $0x9,%rax
+  8021ec:	48 29 d0             	sub    %rdx,%rax
+  8021ef:	48 c1 e0 03          	shl    $0x3,%rax
+  8021f3:	48 29 c1             	sub    %rax,%rcx
+  8021f6:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  8021fb:	83 c6 01             	add    $0x1,%esi
+  8021fe:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  802201:	49 83 c7 01          	add    $0x1,%r15
+  802205:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802209:	49 39 c7             	cmp    %rax,%r15
+  80220c:	0f 85 75 ff ff ff    	jne    802187 <devpipe_write+0x57>
+    return n;
+  802212:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802216:	eb 05                	jmp    80221d <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  802218:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80221d:	48 83 c4 18          	add    $0x18,%rsp
+  802221:	5b                   	pop    %rbx
+  802222:	41 5c                	pop    %r12
+  802224:	41 5d                	pop    %r13
+  802226:	41 5e                	pop    %r14
+  802228:	41 5f                	pop    %r15
+  80222a:	5d                   	pop    %rbp
+  80222b:	c3                   	ret
+
+000000000080222c <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  80222c:	55                   	push   %rbp
+  80222d:	48 89 e5             	mov    %rsp,%rbp
+  802230:	41 57                	push   %r15
+  802232:	41 56                	push   %r14
+  802234:	41 55                	push   %r13
+  802236:	41 54                	push   %r12
+  802238:	53                   	push   %rbx
+  802239:	48 83 ec 18          	sub    $0x18,%rsp
+  80223d:	49 89 fc             	mov    %rdi,%r12
+  802240:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  802244:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802248:	48 b8 f8 14 80 00 00 	movabs $0x8014f8,%rax
+  80224f:	00 00 00 
+  802252:	ff d0                	call   *%rax
+  802254:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  802257:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80225d:	49 bd 7f 10 80 00 00 	movabs $0x80107f,%r13
+  802264:	00 00 00 
+            sys_yield();
+  802267:	49 be 1c 10 80 00 00 	movabs $0x80101c,%r14
+  80226e:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  802271:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  802276:	74 7d                	je     8022f5 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  802278:	8b 03                	mov    (%rbx),%eax
+  80227a:	3b 43 04             	cmp    0x4(%rbx),%eax
+  80227d:	75 26                	jne    8022a5 <devpipe_read+0x79>
+            if (i > 0) return i;
+  80227f:	4d 85 ff             	test   %r15,%r15
+  802282:	75 77                	jne    8022fb <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802284:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802289:	48 89 da             	mov    %rbx,%rdx
+  80228c:	be 00 10 00 00       	mov    $0x1000,%esi
+  802291:	4c 89 e7             	mov    %r12,%rdi
+  802294:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  802297:	85 c0                	test   %eax,%eax
+  802299:	74 72                	je     80230d <devpipe_read+0xe1>
+            sys_yield();
+  80229b:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  80229e:	8b 03                	mov    (%rbx),%eax
+  8022a0:	3b 43 04             	cmp    0x4(%rbx),%eax
+  8022a3:	74 df                	je     802284 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  8022a5:	48 63 c8             	movslq %eax,%rcx
+  8022a8:	48 89 ca             	mov    %rcx,%rdx
+  8022ab:	48 c1 ea 03          	shr    $0x3,%rdx
+  8022af:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  8022b6:	08 10 20 
+  8022b9:	48 89 d0             	mov    %rdx,%rax
+  8022bc:	48 f7 e6             	mul    %rsi
+  8022bf:	48 c1 ea 06          	shr    $0x6,%rdx
+  8022c3:	48 89 d0             	mov    %rdx,%rax
+  8022c6:	48 c1 e0 09          	shl    $0x9,%rax
+  8022ca:	48 29 d0             	sub    %rdx,%rax
+  8022cd:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  8022d4:	00 
+  8022d5:	48 89 c8             	mov    %rcx,%rax
+  8022d8:	48 29 d0             	sub    %rdx,%rax
+  8022db:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  8022e0:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8022e4:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  8022e8:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8022eb:	49 83 c7 01          	add    $0x1,%r15
+  8022ef:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  8022f3:	75 83                	jne    802278 <devpipe_read+0x4c>
+    return n;
+  8022f5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8022f9:	eb 03                	jmp    8022fe <devpipe_read+0xd2>
+            if (i > 0) return i;
+  8022fb:	4c 89 f8             	mov    %r15,%rax
+}
+  8022fe:	48 83 c4 18          	add    $0x18,%rsp
+  802302:	5b                   	pop    %rbx
+  802303:	41 5c                	pop    %r12
+  802305:	41 5d                	pop    %r13
+  802307:	41 5e                	pop    %r14
+  802309:	41 5f                	pop    %r15
+  80230b:	5d                   	pop    %rbp
+  80230c:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  80230d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802312:	eb ea                	jmp    8022fe <devpipe_read+0xd2>
+
+0000000000802314 <pipe>:
+pipe(int pfd[2]) {
+  802314:	55                   	push   %rbp
+  802315:	48 89 e5             	mov    %rsp,%rbp
+  802318:	41 55                	push   %r13
+  80231a:	41 54                	push   %r12
+  80231c:	53                   	push   %rbx
+  80231d:	48 81 ec b8 00 00 00 	sub    $0xb8,%rsp
+  802324:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  802327:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  80232b:	48 b8 8d 15 80 00 00 	movabs $0x80158d,%rax
+  802332:	00 00 00 
+  802335:	ff d0                	call   *%rax
+  802337:	89 c3                	mov    %eax,%ebx
+  802339:	85 c0                	test   %eax,%eax
+  80233b:	0f 88 51 01 00 00    	js     802492 <pipe+0x17e>
+        (res = fd_alloc_from(fd2num(fd0) + 1, &fd1)) < 0) goto err;
+  802341:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802345:	48 b8 e6 14 80 00 00 	movabs $0x8014e6,%rax
+  80234c:	00 00 00 
+  80234f:	ff d0                	call   *%rax
+  802351:	8d 78 01             	lea    0x1(%rax),%edi
+  802354:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802358:	48 b8 14 15 80 00 00 	movabs $0x801514,%rax
+  80235f:	00 00 00 
+  802362:	ff d0                	call   *%rax
+  802364:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  802366:	85 c0                	test   %eax,%eax
+  802368:	0f 88 24 01 00 00    	js     802492 <pipe+0x17e>
+    va = fd2data(fd0);
+  80236e:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802372:	48 bb f8 14 80 00 00 	movabs $0x8014f8,%rbx
+  802379:	00 00 00 
+  80237c:	ff d3                	call   *%rbx
+  80237e:	49 89 c5             	mov    %rax,%r13
+    struct RegionOp ops[] = {
+  802381:	48 8d bd 30 ff ff ff 	lea    -0xd0(%rbp),%rdi
+  802388:	b9 14 00 00 00       	mov    $0x14,%ecx
+  80238d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802392:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+  802395:	c7 85 34 ff ff ff 46 	movl   $0x46,-0xcc(%rbp)
+  80239c:	00 00 00 
+  80239f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8023a3:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+  8023aa:	48 c7 85 50 ff ff ff 	movq   $0x1000,-0xb0(%rbp)
+  8023b1:	00 10 00 00 
+  8023b5:	c7 85 5c ff ff ff 46 	movl   $0x46,-0xa4(%rbp)
+  8023bc:	00 00 00 
+            {.type = REGION_ALLOC, .dstva = (uintptr_t)fd1, .size = PAGE_SIZE, .perm = PROT_RW | PROT_SHARE},
+  8023bf:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+    struct RegionOp ops[] = {
+  8023c3:	48 89 bd 70 ff ff ff 	mov    %rdi,-0x90(%rbp)
+  8023ca:	48 c7 85 78 ff ff ff 	movq   $0x1000,-0x88(%rbp)
+  8023d1:	00 10 00 00 
+  8023d5:	c7 45 84 46 00 00 00 	movl   $0x46,-0x7c(%rbp)
+  8023dc:	4c 89 6d 98          	mov    %r13,-0x68(%rbp)
+  8023e0:	48 c7 45 a0 00 10 00 	movq   $0x1000,-0x60(%rbp)
+  8023e7:	00 
+  8023e8:	c7 45 a8 01 00 00 00 	movl   $0x1,-0x58(%rbp)
+  8023ef:	c7 45 ac 46 00 00 00 	movl   $0x46,-0x54(%rbp)
+  8023f6:	4c 89 6d b8          	mov    %r13,-0x48(%rbp)
+            {.type = REGION_MAP, .srcva = (uintptr_t)va, .dstva = (uintptr_t)fd2data(fd1), .size = PAGE_SIZE, .perm = PROT_RW | PROT_SHARE},
+  8023fa:	ff d3                	call   *%rbx
+    struct RegionOp ops[] = {
+  8023fc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802400:	48 c7 45 c8 00 10 00 	movq   $0x1000,-0x38(%rbp)
+  802407:	00 
+    if ((res = sys_region_batch(ops, sizeof ops / sizeof *ops)) < 0) goto err1;
+  802408:	be 04 00 00 00       	mov    $0x4,%esi
+  80240d:	48 8d bd 30 ff ff ff 	lea    -0xd0(%rbp),%rdi
+  802414:	48 b8 de 11 80 00 00 	movabs $0x8011de,%rax
+  80241b:	00 00 00 
+  80241e:	ff d0                	call   *%rax
+  802420:	89 c3                	mov    %eax,%ebx
+  802422:	85 c0                	test   %eax,%eax
+  802424:	0f 88 ad 00 00 00    	js     8024d7 <pipe+0x1c3>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  80242a:	be 00 10 00 00       	mov    $0x1000,%esi
+  80242f:	4c 89 ef             	mov    %r13,%rdi
+  802432:	48 b8 4d 10 80 00 00 	movabs $0x80104d,%rax
+  802439:	00 00 00 
+  80243c:	ff d0                	call   *%rax
+  80243e:	83 f8 02             	cmp    $0x2,%eax
+  802441:	75 5f                	jne    8024a2 <pipe+0x18e>
+    fd0->fd_dev_id = devpipe.dev_id;
+  802443:	a1 60 40 80 00 00 00 	movabs 0x804060,%eax
+  80244a:	00 00 
+  80244c:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802450:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  802452:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802456:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  80245d:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  802461:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  802463:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802467:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  80246e:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802472:	48 bb e6 14 80 00 00 	movabs $0x8014e6,%rbx
+  802479:	00 00 00 
+  80247c:	ff d3                	call   *%rbx
+  80247e:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  802482:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  802486:	ff d3                	call   *%rbx
+  802488:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  80248d:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  802492:	89 d8                	mov    %ebx,%eax
+  802494:	48 81 c4 b8 00 00 00 	add    $0xb8,%rsp
+  80249b:	5b                   	pop    %rbx
+  80249c:	41 5c                	pop    %r12
+  80249e:	41 5d                	pop    %r13
+  8024a0:	5d                   	pop    %rbp
+  8024a1:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8024a2:	48 b9 10 33 80 00 00 	movabs $0x803310,%rcx
+  8024a9:	00 00 00 
+  8024ac:	48 ba e7 32 80 00 00 	movabs $0x8032e7,%rdx
+  8024b3:	00 00 00 
+  8024b6:	be 33 00 00 00       	mov    $0x33,%esi
+  8024bb:	48 bf fc 32 80 00 00 	movabs $0x8032fc,%rdi
+  8024c2:	00 00 00 
+  8024c5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024ca:	49 b8 3c 2a 80 00 00 	movabs $0x802a3c,%r8
+  8024d1:	00 00 00 
+  8024d4:	41 ff d0             	call   *%r8
+        ops[i].type = REGION_UNMAP;
+  8024d7:	c7 85 30 ff ff ff 02 	movl   $0x2,-0xd0(%rbp)
+  8024de:	00 00 00 
+  8024e1:	c7 85 58 ff ff ff 02 	movl   $0x2,-0xa8(%rbp)
+  8024e8:	00 00 00 
+  8024eb:	c7 45 80 02 00 00 00 	movl   $0x2,-0x80(%rbp)
+  8024f2:	c7 45 a8 02 00 00 00 	movl   $0x2,-0x58(%rbp)
+    sys_region_batch(ops, sizeof ops / sizeof *ops);
+  8024f9:	be 04 00 00 00       	mov    $0x4,%esi
+  8024fe:	48 8d bd 30 ff ff ff 	lea    -0xd0(%rbp),%rdi
+  802505:	48 b8 de 11 80 00 00 	movabs $0x8011de,%rax
+  80250c:	00 00 00 
+  80250f:	ff d0                	call   *%rax
+  802511:	e9 7c ff ff ff       	jmp    802492 <pipe+0x17e>
+
+0000000000802516 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  802516:	55                   	push   %rbp
+  802517:	48 89 e5             	mov    %rsp,%rbp
+  80251a:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  80251e:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802522:	48 b8 a7 15 80 00 00 	movabs $0x8015a7,%rax
+  802529:	00 00 00 
+  80252c:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80252e:	85 c0                	test   %eax,%eax
+  802530:	78 35                	js     802567 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  802532:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802536:	48 b8 f8 14 80 00 00 	movabs $0x8014f8,%rax
+  80253d:	00 00 00 
+  802540:	ff d0                	call   *%rax
+  802542:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802545:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80254a:	be 00 10 00 00       	mov    $0x1000,%esi
+  80254f:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802553:	48 b8 7f 10 80 00 00 	movabs $0x80107f,%rax
+  80255a:	00 00 00 
+  80255d:	ff d0                	call   *%rax
+  80255f:	85 c0                	test   %eax,%eax
+  802561:	0f 94 c0             	sete   %al
+  802564:	0f b6 c0             	movzbl %al,%eax
+}
+  802567:	c9                   	leave
+  802568:	c3                   	ret
+
+0000000000802569 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  802569:	48 89 f8             	mov    %rdi,%rax
+  80256c:	48 c1 e8 27          	shr    $0x27,%rax
+  802570:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  802577:	01 00 00 
+  80257a:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80257e:	f6 c2 01             	test   $0x1,%dl
+  802581:	74 6d                	je     8025f0 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  802583:	48 89 f8             	mov    %rdi,%rax
+  802586:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80258a:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802591:	01 00 00 
+  802594:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802598:	f6 c2 01             	test   $0x1,%dl
+  80259b:	74 62                	je     8025ff <get_uvpt_entry+0x96>
+  80259d:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8025a4:	01 00 00 
+  8025a7:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8025ab:	f6 c2 80             	test   $0x80,%dl
+  8025ae:	75 4f                	jne    8025ff <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8025b0:	48 89 f8             	mov    %rdi,%rax
+  8025b3:	48 c1 e8 15          	shr    $0x15,%rax
+  8025b7:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8025be:	01 00 00 
+  8025c1:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8025c5:	f6 c2 01             	test   $0x1,%dl
+  8025c8:	74 44                	je     80260e <get_uvpt_entry+0xa5>
+  8025ca:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8025d1:	01 00 00 
+  8025d4:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8025d8:	f6 c2 80             	test   $0x80,%dl
+  8025db:	75 31                	jne    80260e <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  8025dd:	48 c1 ef 0c          	shr    $0xc,%rdi
+  8025e1:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8025e8:	01 00 00 
+  8025eb:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  8025ef:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8025f0:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  8025f7:	01 00 00 
+  8025fa:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8025fe:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8025ff:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802606:	01 00 00 
+  802609:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80260d:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  80260e:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802615:	01 00 00 
+  802618:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80261c:	c3                   	ret
+
+000000000080261d <get_prot>:
+
+int
+get_prot(void *va) {
+  80261d:	55                   	push   %rbp
+  80261e:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  802621:	48 b8 69 25 80 00 00 	movabs $0x802569,%rax
+  802628:	00 00 00 
+  80262b:	ff d0                	call   *%rax
+  80262d:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  802630:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  802635:	89 c1                	mov    %eax,%ecx
+  802637:	83 c9 04             	or     $0x4,%ecx
+  80263a:	f6 c2 01             	test   $0x1,%dl
+  80263d:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  802640:	89 c1                	mov    %eax,%ecx
+  802642:	83 c9 02             	or     $0x2,%ecx
+  802645:	f6 c2 02             	test   $0x2,%dl
+  802648:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  80264b:	89 c1                	mov    %eax,%ecx
+  80264d:	83 c9 01             	or     $0x1,%ecx
+  802650:	48 85 d2             	test   %rdx,%rdx
+  802653:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  802656:	89 c1                	mov    %eax,%ecx
+  802658:	83 c9 40             	or     $0x40,%ecx
+  80265b:	f6 c6 04             	test   $0x4,%dh
+  80265e:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  802661:	5d                   	pop    %rbp
+  802662:	c3                   	ret
+
+0000000000802663 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  802663:	55                   	push   %rbp
+  802664:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  802667:	48 b8 69 25 80 00 00 	movabs $0x802569,%rax
+  80266e:	00 00 00 
+  802671:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  802673:	48 c1 e8 06          	shr    $0x6,%rax
+  802677:	83 e0 01             	and    $0x1,%eax
+}
+  80267a:	5d                   	pop    %rbp
+  80267b:	c3                   	ret
+
+000000000080267c <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  80267c:	55                   	push   %rbp
+  80267d:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  802680:	48 b8 69 25 80 00 00 	movabs $0x802569,%rax
+  802687:	00 00 00 
+  80268a:	ff d0                	call   *%rax
+  80268c:	83 e0 01             	and    $0x1,%eax
+}
+  80268f:	5d                   	pop    %rbp
+  802690:	c3                   	ret
+
+0000000000802691 <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  802691:	55                   	push   %rbp
+  802692:	48 89 e5             	mov    %rsp,%rbp
+  802695:	41 57                	push   %r15
+  802697:	41 56                	push   %r14
+  802699:	41 55                	push   %r13
+  80269b:	41 54                	push   %r12
+  80269d:	53                   	push   %rbx
+  80269e:	48 83 ec 38          	sub    $0x38,%rsp
+  8026a2:	49 89 f7             	mov    %rsi,%r15
+  8026a5:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+                    }
+                    continue;
+                }
+                for (int ptei = 0; ptei < PT_ENTRY_COUNT; ptei++) {
+                    uintptr_t pte_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, pdei, ptei, 0);
+                    pte_t pte = uvpt[VPT(pte_addr)];
+  8026ab:	49 bd 00 00 00 00 00 	movabs $0x10000000000,%r13
+  8026b2:	01 00 00 
+  8026b5:	4d 89 e6             	mov    %r12,%r14
+  8026b8:	49 89 fc             	mov    %rdi,%r12
+  8026bb:	e9 19 01 00 00       	jmp    8027d9 <foreach_shared_region+0x148>
+  8026c0:	48 89 5d b0          	mov    %rbx,-0x50(%rbp)
+  8026c4:	4c 89 75 a8          	mov    %r14,-0x58(%rbp)
+  8026c8:	eb 52                	jmp    80271c <foreach_shared_region+0x8b>
+                for (int ptei = 0; ptei < PT_ENTRY_COUNT; ptei++) {
+  8026ca:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8026d1:	48 81 fb 00 00 20 00 	cmp    $0x200000,%rbx
+  8026d8:	74 2e                	je     802708 <foreach_shared_region+0x77>
+                    uintptr_t pte_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, pdei, ptei, 0);
+  8026da:	48 89 df             	mov    %rbx,%rdi
+  8026dd:	4c 09 f7             	or     %r14,%rdi
+                    pte_t pte = uvpt[VPT(pte_addr)];
+  8026e0:	48 89 f8             	mov    %rdi,%rax
+  8026e3:	48 c1 e8 0c          	shr    $0xc,%rax
+  8026e7:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+                    if ((pte & PTE_P) && (pte & PTE_SHARE)) {
+  8026ec:	25 01 04 00 00       	and    $0x401,%eax
+  8026f1:	48 3d 01 04 00 00    	cmp    $0x401,%rax
+  8026f7:	75 d1                	jne    8026ca <foreach_shared_region+0x39>
+                        fun((void*)pte_addr, (void*)(pte_addr + PAGE_SIZE), arg);
+  8026f9:	48 8d b7 00 10 00 00 	lea    0x1000(%rdi),%rsi
+  802700:	4c 89 fa             	mov    %r15,%rdx
+  802703:	41 ff d4             	call   *%r12
+  802706:	eb c2                	jmp    8026ca <foreach_shared_region+0x39>
+            for (int pdei = 0; pdei < PD_ENTRY_COUNT; pdei++) {
+  802708:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  80270f:	00 
+  802710:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802714:	48 3d 00 00 00 40    	cmp    $0x40000000,%rax
+  80271a:	74 46                	je     802762 <foreach_shared_region+0xd1>
+                uintptr_t pde_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, pdei, 0, 0);
+  80271c:	4c 8b 75 c8          	mov    -0x38(%rbp),%r14
+  802720:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802724:	49 09 c6             	or     %rax,%r14
+                pde_t pde = uvpd[VPD(pde_addr)];
+  802727:	4c 89 f0             	mov    %r14,%rax
+  80272a:	48 c1 e8 15          	shr    $0x15,%rax
+  80272e:	48 b9 00 00 00 80 00 	movabs $0x10080000000,%rcx
+  802735:	01 00 00 
+  802738:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+                if (!(pde & PTE_P)) {
+  80273c:	a8 01                	test   $0x1,%al
+  80273e:	74 c8                	je     802708 <foreach_shared_region+0x77>
+                if (pde & PTE_PS) {
+  802740:	48 89 c3             	mov    %rax,%rbx
+  802743:	81 e3 80 00 00 00    	and    $0x80,%ebx
+  802749:	74 8f                	je     8026da <foreach_shared_region+0x49>
+                    if (pde & PTE_SHARE) {
+  80274b:	f6 c4 04             	test   $0x4,%ah
+  80274e:	74 b8                	je     802708 <foreach_shared_region+0x77>
+                        fun((void*)pde_addr, (void*)(pde_addr + 1024 * 1024 * 2), arg);
+  802750:	49 8d b6 00 00 20 00 	lea    0x200000(%r14),%rsi
+  802757:	4c 89 fa             	mov    %r15,%rdx
+  80275a:	4c 89 f7             	mov    %r14,%rdi
+  80275d:	41 ff d4             	call   *%r12
+  802760:	eb a6                	jmp    802708 <foreach_shared_region+0x77>
+  802762:	48 8b 5d b0          	mov    -0x50(%rbp),%rbx
+  802766:	4c 8b 75 a8          	mov    -0x58(%rbp),%r14
+        for (int pdpei = 0; pdpei < PDP_ENTRY_COUNT; pdpei++) {
+  80276a:	48 81 c3 00 00 00 40 	add    $0x40000000,%rbx
+  802771:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802778:	00 00 00 
+  80277b:	48 39 c3             	cmp    %rax,%rbx
+  80277e:	74 4c                	je     8027cc <foreach_shared_region+0x13b>
+            uintptr_t pdpe_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, 0, 0, 0);
+  802780:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802784:	48 09 d8             	or     %rbx,%rax
+  802787:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+            pdpe_t pdpe = uvpdp[VPDP(pdpe_addr)];
+  80278b:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80278f:	48 b9 00 00 40 80 00 	movabs $0x10080400000,%rcx
+  802796:	01 00 00 
+  802799:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+            if (!(pdpe & PTE_P)) {
+  80279d:	a8 01                	test   $0x1,%al
+  80279f:	74 c9                	je     80276a <foreach_shared_region+0xd9>
+            if (pdpe & PTE_PS) {
+  8027a1:	48 89 c1             	mov    %rax,%rcx
+  8027a4:	81 e1 80 00 00 00    	and    $0x80,%ecx
+  8027aa:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  8027ae:	0f 84 0c ff ff ff    	je     8026c0 <foreach_shared_region+0x2f>
+                if (pdpe & PTE_SHARE) {
+  8027b4:	f6 c4 04             	test   $0x4,%ah
+  8027b7:	74 b1                	je     80276a <foreach_shared_region+0xd9>
+                    fun((void*)pdpe_addr, (void*)(pdpe_addr + 1024 * 1024 * 1024), arg); 
+  8027b9:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  8027bd:	48 8d b7 00 00 00 40 	lea    0x40000000(%rdi),%rsi
+  8027c4:	4c 89 fa             	mov    %r15,%rdx
+  8027c7:	41 ff d4             	call   *%r12
+  8027ca:	eb 9e                	jmp    80276a <foreach_shared_region+0xd9>
+    for (int pml4ei = 0; pml4ei < PML4_ENTRY_COUNT; pml4ei++) {
+  8027cc:	49 83 c6 01          	add    $0x1,%r14
+  8027d0:	49 81 fe 00 02 00 00 	cmp    $0x200,%r14
+  8027d7:	74 24                	je     8027fd <foreach_shared_region+0x16c>
+        pml4e_t pml4e = uvpml4[VPML4(pml4_addr)];
+  8027d9:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  8027e0:	01 00 00 
+  8027e3:	4a 8b 04 f0          	mov    (%rax,%r14,8),%rax
+        if (!(pml4e & PTE_P)) {
+  8027e7:	a8 01                	test   $0x1,%al
+  8027e9:	74 e1                	je     8027cc <foreach_shared_region+0x13b>
+  8027eb:	4c 89 f0             	mov    %r14,%rax
+  8027ee:	48 c1 e0 27          	shl    $0x27,%rax
+  8027f2:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8027f6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8027fb:	eb 83                	jmp    802780 <foreach_shared_region+0xef>
+            }
+        }
+    }
+    
+    return 0;
+}
+  8027fd:	b8 00 00 00 00       	mov    $0x0,%eax
+  802802:	48 83 c4 38          	add    $0x38,%rsp
+  802806:	5b                   	pop    %rbx
+  802807:	41 5c                	pop    %r12
+  802809:	41 5d                	pop    %r13
+  80280b:	41 5e                	pop    %r14
+  80280d:	41 5f                	pop    %r15
+  80280f:	5d                   	pop    %rbp
+  802810:	c3                   	ret
+
+0000000000802811 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  802811:	b8 00 00 00 00       	mov    $0x0,%eax
+  802816:	c3                   	ret
+
+0000000000802817 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  802817:	55                   	push   %rbp
+  802818:	48 89 e5             	mov    %rsp,%rbp
+  80281b:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  80281e:	48 be 34 33 80 00 00 	movabs $0x803334,%rsi
+  802825:	00 00 00 
+  802828:	48 b8 fb 0a 80 00 00 	movabs $0x800afb,%rax
+  80282f:	00 00 00 
+  802832:	ff d0                	call   *%rax
+    return 0;
+}
+  802834:	b8 00 00 00 00       	mov    $0x0,%eax
+  802839:	5d                   	pop    %rbp
+  80283a:	c3                   	ret
+
+000000000080283b <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  80283b:	55                   	push   %rbp
+  80283c:	48 89 e5             	mov    %rsp,%rbp
+  80283f:	41 57                	push   %r15
+  802841:	41 56                	push   %r14
+  802843:	41 55                	push   %r13
+  802845:	41 54                	push   %r12
+  802847:	53                   	push   %rbx
+  802848:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  80284f:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  802856:	48 85 d2             	test   %rdx,%rdx
+  802859:	74 7a                	je     8028d5 <devcons_write+0x9a>
+  80285b:	49 89 d6             	mov    %rdx,%r14
+  80285e:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802864:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  802869:	49 bf f5 0c 80 00 00 	movabs $0x800cf5,%r15
+  802870:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  802873:	4c 89 f3             	mov    %r14,%rbx
+  802876:	48 29 f3             	sub    %rsi,%rbx
+  802879:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  80287e:	48 39 c3             	cmp    %rax,%rbx
+  802881:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  802885:	4c 63 eb             	movslq %ebx,%r13
+  802888:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  80288f:	48 01 c6             	add    %rax,%rsi
+  802892:	4c 89 ea             	mov    %r13,%rdx
+  802895:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  80289c:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  80289f:	4c 89 ee             	mov    %r13,%rsi
+  8028a2:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  8028a9:	48 b8 22 0f 80 00 00 	movabs $0x800f22,%rax
+  8028b0:	00 00 00 
+  8028b3:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  8028b5:	41 01 dc             	add    %ebx,%r12d
+  8028b8:	49 63 f4             	movslq %r12d,%rsi
+  8028bb:	4c 39 f6             	cmp    %r14,%rsi
+  8028be:	72 b3                	jb     802873 <devcons_write+0x38>
+    return res;
+  8028c0:	49 63 c4             	movslq %r12d,%rax
+}
+  8028c3:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  8028ca:	5b                   	pop    %rbx
+  8028cb:	41 5c                	pop    %r12
+  8028cd:	41 5d                	pop    %r13
+  8028cf:	41 5e                	pop    %r14
+  8028d1:	41 5f                	pop    %r15
+  8028d3:	5d                   	pop    %rbp
+  8028d4:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  8028d5:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8028db:	eb e3                	jmp    8028c0 <devcons_write+0x85>
+
+00000000008028dd <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8028dd:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  8028e0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8028e5:	48 85 c0             	test   %rax,%rax
+  8028e8:	74 55                	je     80293f <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8028ea:	55                   	push   %rbp
+  8028eb:	48 89 e5             	mov    %rsp,%rbp
+  8028ee:	41 55                	push   %r13
+  8028f0:	41 54                	push   %r12
+  8028f2:	53                   	push   %rbx
+  8028f3:	48 83 ec 08          	sub    $0x8,%rsp
+  8028f7:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  8028fa:	48 bb 4f 0f 80 00 00 	movabs $0x800f4f,%rbx
+  802901:	00 00 00 
+  802904:	49 bc 1c 10 80 00 00 	movabs $0x80101c,%r12
+  80290b:	00 00 00 
+  80290e:	eb 03                	jmp    802913 <devcons_read+0x36>
+  802910:	41 ff d4             	call   *%r12
+  802913:	ff d3                	call   *%rbx
+  802915:	85 c0                	test   %eax,%eax
+  802917:	74 f7                	je     802910 <devcons_read+0x33>
+    if (c < 0) return c;
+  802919:	48 63 d0             	movslq %eax,%rdx
+  80291c:	78 13                	js     802931 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  80291e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802923:	83 f8 04             	cmp    $0x4,%eax
+  802926:	74 09                	je     802931 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  802928:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  80292c:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  802931:	48 89 d0             	mov    %rdx,%rax
+  802934:	48 83 c4 08          	add    $0x8,%rsp
+  802938:	5b                   	pop    %rbx
+  802939:	41 5c                	pop    %r12
+  80293b:	41 5d                	pop    %r13
+  80293d:	5d                   	pop    %rbp
+  80293e:	c3                   	ret
+  80293f:	48 89 d0             	mov    %rdx,%rax
+  802942:	c3                   	ret
+
+0000000000802943 <cputchar>:
+cputchar(int ch) {
+  802943:	55                   	push   %rbp
+  802944:	48 89 e5             	mov    %rsp,%rbp
+  802947:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  80294b:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  80294f:	be 01 00 00 00       	mov    $0x1,%esi
+  802954:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  802958:	48 b8 22 0f 80 00 00 	movabs $0x800f22,%rax
+  80295f:	00 00 00 
+  802962:	ff d0                	call   *%rax
+}
+  802964:	c9                   	leave
+  802965:	c3                   	ret
+
+0000000000802966 <getchar>:
+getchar(void) {
+  802966:	55                   	push   %rbp
+  802967:	48 89 e5             	mov    %rsp,%rbp
+  80296a:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  80296e:	ba 01 00 00 00       	mov    $0x1,%edx
+  802973:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  802977:	bf 00 00 00 00       	mov    $0x0,%edi
+  80297c:	48 b8 8a 18 80 00 00 	movabs $0x80188a,%rax
+  802983:	00 00 00 
+  802986:	ff d0                	call   *%rax
+  802988:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  80298a:	85 c0                	test   %eax,%eax
+  80298c:	78 06                	js     802994 <getchar+0x2e>
+  80298e:	74 08                	je     802998 <getchar+0x32>
+  802990:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  802994:	89 d0                	mov    %edx,%eax
+  802996:	c9                   	leave
+  802997:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  802998:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  80299d:	eb f5                	jmp    802994 <getchar+0x2e>
+
+000000000080299f <iscons>:
+iscons(int fdnum) {
+  80299f:	55                   	push   %rbp
+  8029a0:	48 89 e5             	mov    %rsp,%rbp
+  8029a3:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8029a7:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8029ab:	48 b8 a7 15 80 00 00 	movabs $0x8015a7,%rax
+  8029b2:	00 00 00 
+  8029b5:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8029b7:	85 c0                	test   %eax,%eax
+  8029b9:	78 18                	js     8029d3 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  8029bb:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8029bf:	48 b8 a0 40 80 00 00 	movabs $0x8040a0,%rax
+  8029c6:	00 00 00 
+  8029c9:	8b 00                	mov    (%rax),%eax
+  8029cb:	39 02                	cmp    %eax,(%rdx)
+  8029cd:	0f 94 c0             	sete   %al
+  8029d0:	0f b6 c0             	movzbl %al,%eax
+}
+  8029d3:	c9                   	leave
+  8029d4:	c3                   	ret
+
+00000000008029d5 <opencons>:
+opencons(void) {
+  8029d5:	55                   	push   %rbp
+  8029d6:	48 89 e5             	mov    %rsp,%rbp
+  8029d9:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8029dd:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  8029e1:	48 b8 8d 15 80 00 00 	movabs $0x80158d,%rax
+  8029e8:	00 00 00 
+  8029eb:	ff d0                	call   *%rax
+  8029ed:	85 c0                	test   %eax,%eax
+  8029ef:	78 49                	js     802a3a <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  8029f1:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8029f6:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8029fb:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  8029ff:	bf 00 00 00 00       	mov    $0x0,%edi
+  802a04:	48 b8 ab 10 80 00 00 	movabs $0x8010ab,%rax
+  802a0b:	00 00 00 
+  802a0e:	ff d0                	call   *%rax
+  802a10:	85 c0                	test   %eax,%eax
+  802a12:	78 26                	js     802a3a <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  802a14:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802a18:	a1 a0 40 80 00 00 00 	movabs 0x8040a0,%eax
+  802a1f:	00 00 
+  802a21:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  802a23:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802a27:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  802a2e:	48 b8 e6 14 80 00 00 	movabs $0x8014e6,%rax
+  802a35:	00 00 00 
+  802a38:	ff d0                	call   *%rax
+}
+  802a3a:	c9                   	leave
+  802a3b:	c3                   	ret
+
+0000000000802a3c <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  802a3c:	55                   	push   %rbp
+  802a3d:	48 89 e5             	mov    %rsp,%rbp
+  802a40:	41 56                	push   %r14
+  802a42:	41 55                	push   %r13
+  802a44:	41 54                	push   %r12
+  802a46:	53                   	push   %rbx
+  802a47:	48 83 ec 50          	sub    $0x50,%rsp
+  802a4b:	49 89 fc             	mov    %rdi,%r12
+  802a4e:	41 89 f5             	mov    %esi,%r13d
+  802a51:	48 89 d3             	mov    %rdx,%rbx
+  802a54:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  802a58:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  802a5c:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  802a60:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  802a67:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802a6b:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  802a6f:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  802a73:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  802a77:	48 b8 00 40 80 00 00 	movabs $0x804000,%rax
+  802a7e:	00 00 00 
+  802a81:	4c 8b 30             	mov    (%rax),%r14
+  802a84:	48 b8 eb 0f 80 00 00 	movabs $0x800feb,%rax
+  802a8b:	00 00 00 
+  802a8e:	ff d0                	call   *%rax
+  802a90:	89 c6                	mov    %eax,%esi
+  802a92:	45 89 e8             	mov    %r13d,%r8d
+  802a95:	4c 89 e1             	mov    %r12,%rcx
+  802a98:	4c 89 f2             	mov    %r14,%rdx
+  802a9b:	48 bf 40 33 80 00 00 	movabs $0x803340,%rdi
+  802aa2:	00 00 00 
+  802aa5:	b8 00 00 00 00       	mov    $0x0,%eax
+  802aaa:	49 bc d6 01 80 00 00 	movabs $0x8001d6,%r12
+  802ab1:	00 00 00 
+  802ab4:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  802ab7:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  802abb:	48 89 df             	mov    %rbx,%rdi
+  802abe:	48 b8 72 01 80 00 00 	movabs $0x800172,%rax
+  802ac5:	00 00 00 
+  802ac8:	ff d0                	call   *%rax
+    cprintf("\n");
+  802aca:	48 bf aa 2c 80 00 00 	movabs $0x802caa,%rdi
+  802ad1:	00 00 00 
+  802ad4:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ad9:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  802adc:	cc                   	int3
+  802add:	eb fd                	jmp    802adc <_panic+0xa0>
+
+0000000000802adf <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  802adf:	55                   	push   %rbp
+  802ae0:	48 89 e5             	mov    %rsp,%rbp
+  802ae3:	41 55                	push   %r13
+  802ae5:	41 54                	push   %r12
+  802ae7:	53                   	push   %rbx
+  802ae8:	48 83 ec 08          	sub    $0x8,%rsp
+  802aec:	49 89 fc             	mov    %rdi,%r12
+  802aef:	48 89 f7             	mov    %rsi,%rdi
+  802af2:	48 89 d3             	mov    %rdx,%rbx
+  802af5:	49 89 cd             	mov    %rcx,%r13
+    // LAB 9: Your code here:
+    int res = sys_ipc_recv(!pg ? (void*)MAX_USER_ADDRESS : pg, !size ? 0 : *size);
+  802af8:	be 00 00 00 00       	mov    $0x0,%esi
+  802afd:	48 85 d2             	test   %rdx,%rdx
+  802b00:	74 03                	je     802b05 <ipc_recv+0x26>
+  802b02:	48 8b 32             	mov    (%rdx),%rsi
+  802b05:	48 85 ff             	test   %rdi,%rdi
+  802b08:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802b0f:	00 00 00 
+  802b12:	48 0f 44 f8          	cmove  %rax,%rdi
+  802b16:	48 b8 7d 14 80 00 00 	movabs $0x80147d,%rax
+  802b1d:	00 00 00 
+  802b20:	ff d0                	call   *%rax
+    if (res < 0) {
+  802b22:	85 c0                	test   %eax,%eax
+  802b24:	78 66                	js     802b8c <ipc_recv+0xad>
+        if (size) {
+            *size = 0;
+        }
+        return res;
+    }
+    if (from_env_store) {
+  802b26:	4d 85 e4             	test   %r12,%r12
+  802b29:	74 14                	je     802b3f <ipc_recv+0x60>
+        *from_env_store = thisenv->env_ipc_from;
+  802b2b:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802b32:	00 00 00 
+  802b35:	8b 80 ac 01 00 00    	mov    0x1ac(%rax),%eax
+  802b3b:	41 89 04 24          	mov    %eax,(%r12)
+    }
+    if (perm_store) {
+  802b3f:	4d 85 ed             	test   %r13,%r13
+  802b42:	74 14                	je     802b58 <ipc_recv+0x79>
+        *perm_store = thisenv->env_ipc_perm;
+  802b44:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802b4b:	00 00 00 
+  802b4e:	8b 80 b0 01 00 00    	mov    0x1b0(%rax),%eax
+  802b54:	41 89 45 00          	mov    %eax,0x0(%r13)
+    }
+    if (size) {
+  802b58:	48 85 db             	test   %rbx,%rbx
+  802b5b:	74 14                	je     802b71 <ipc_recv+0x92>
+        *size = thisenv->env_ipc_maxsz;
+  802b5d:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802b64:	00 00 00 
+  802b67:	48 8b 80 a0 01 00 00 	mov    0x1a0(%rax),%rax
+  802b6e:	48 89 03             	mov    %rax,(%rbx)
+    }
+    return thisenv->env_ipc_value;
+  802b71:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802b78:	00 00 00 
+  802b7b:	8b 80 a8 01 00 00    	mov    0x1a8(%rax),%eax
+}
+  802b81:	48 83 c4 08          	add    $0x8,%rsp
+  802b85:	5b                   	pop    %rbx
+  802b86:	41 5c                	pop    %r12
+  802b88:	41 5d                	pop    %r13
+  802b8a:	5d                   	pop    %rbp
+  802b8b:	c3                   	ret
+        if (from_env_store) {
+  802b8c:	4d 85 e4             	test   %r12,%r12
+  802b8f:	74 08                	je     802b99 <ipc_recv+0xba>
+            *from_env_store = 0;
+  802b91:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  802b98:	00 
+        if (perm_store) {
+  802b99:	4d 85 ed             	test   %r13,%r13
+  802b9c:	74 08                	je     802ba6 <ipc_recv+0xc7>
+            *perm_store = 0;
+  802b9e:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  802ba5:	00 
+        if (size) {
+  802ba6:	48 85 db             	test   %rbx,%rbx
+  802ba9:	74 d6                	je     802b81 <ipc_recv+0xa2>
+            *size = 0;
+  802bab:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  802bb2:	eb cd                	jmp    802b81 <ipc_recv+0xa2>
+
+0000000000802bb4 <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  802bb4:	55                   	push   %rbp
+  802bb5:	48 89 e5             	mov    %rsp,%rbp
+  802bb8:	41 57                	push   %r15
+  802bba:	41 56                	push   %r14
+  802bbc:	41 55                	push   %r13
+  802bbe:	41 54                	push   %r12
+  802bc0:	53                   	push   %rbx
+  802bc1:	48 83 ec 18          	sub    $0x18,%rsp
+  802bc5:	41 89 fd             	mov    %edi,%r13d
+  802bc8:	89 75 cc             	mov    %esi,-0x34(%rbp)
+  802bcb:	49 89 cc             	mov    %rcx,%r12
+  802bce:	44 89 45 c8          	mov    %r8d,-0x38(%rbp)
+    // LAB 9: Your code here:
+    int res = 0;
+    while ((res = sys_ipc_try_send(to_env, val, !pg ? (void*)MAX_USER_ADDRESS : pg, size, perm)) < 0) {
+  802bd2:	48 85 d2             	test   %rdx,%rdx
+  802bd5:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802bdc:	00 00 00 
+  802bdf:	48 0f 45 c2          	cmovne %rdx,%rax
+  802be3:	48 89 c3             	mov    %rax,%rbx
+  802be6:	49 be 51 14 80 00 00 	movabs $0x801451,%r14
+  802bed:	00 00 00 
+        if (res != -E_IPC_NOT_RECV) {
+            panic("sys_ipc_try_send failed: %i", res);
+        }
+        sys_yield();
+  802bf0:	49 bf 1c 10 80 00 00 	movabs $0x80101c,%r15
+  802bf7:	00 00 00 
+    while ((res = sys_ipc_try_send(to_env, val, !pg ? (void*)MAX_USER_ADDRESS : pg, size, perm)) < 0) {
+  802bfa:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  802bfd:	44 8b 45 c8          	mov    -0x38(%rbp),%r8d
+  802c01:	4c 89 e1             	mov    %r12,%rcx
+  802c04:	48 89 da             	mov    %rbx,%rdx
+  802c07:	44 89 ef             	mov    %r13d,%edi
+  802c0a:	41 ff d6             	call   *%r14
+  802c0d:	85 c0                	test   %eax,%eax
+  802c0f:	79 37                	jns    802c48 <ipc_send+0x94>
+        if (res != -E_IPC_NOT_RECV) {
+  802c11:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  802c14:	75 05                	jne    802c1b <ipc_send+0x67>
+        sys_yield();
+  802c16:	41 ff d7             	call   *%r15
+  802c19:	eb df                	jmp    802bfa <ipc_send+0x46>
+            panic("sys_ipc_try_send failed: %i", res);
+  802c1b:	89 c1                	mov    %eax,%ecx
+  802c1d:	48 ba 63 33 80 00 00 	movabs $0x803363,%rdx
+  802c24:	00 00 00 
+  802c27:	be 40 00 00 00       	mov    $0x40,%esi
+  802c2c:	48 bf 7f 33 80 00 00 	movabs $0x80337f,%rdi
+  802c33:	00 00 00 
+  802c36:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c3b:	49 b8 3c 2a 80 00 00 	movabs $0x802a3c,%r8
+  802c42:	00 00 00 
+  802c45:	41 ff d0             	call   *%r8
+    }
+    return;
+}
+  802c48:	48 83 c4 18          	add    $0x18,%rsp
+  802c4c:	5b                   	pop    %rbx
+  802c4d:	41 5c                	pop    %r12
+  802c4f:	41 5d                	pop    %r13
+  802c51:	41 5e                	pop    %r14
+  802c53:	41 5f                	pop    %r15
+  802c55:	5d                   	pop    %rbp
+  802c56:	c3                   	ret
+
+0000000000802c57 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  802c57:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  802c5c:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  802c63:	00 00 00 
+  802c66:	48 69 d0 d0 01 00 00 	imul   $0x1d0,%rax,%rdx
+  802c6d:	48 01 ca             	add    %rcx,%rdx
+  802c70:	8b 92 e8 00 00 00    	mov    0xe8(%rdx),%edx
+  802c76:	39 fa                	cmp    %edi,%edx
+  802c78:	74 12                	je     802c8c <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  802c7a:	48 83 c0 01          	add    $0x1,%rax
+  802c7e:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  802c84:	75 e0                	jne    802c66 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  802c86:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802c8b:	c3                   	ret
+            return envs[i].env_id;
+  802c8c:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+  802c93:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  802c9a:	00 00 00 
+  802c9d:	48 01 d0             	add    %rdx,%rax
+  802ca0:	8b 80 e0 00 00 00    	mov    0xe0(%rax),%eax
+  802ca6:	c3                   	ret
+  802ca7:	90                   	nop
+
+0000000000802ca8 <__rodata_start>:
+  802ca8:	25 64 0a 00 3c       	and    $0x3c000a64,%eax
+  802cad:	75 6e                	jne    802d1d <__rodata_start+0x75>
+  802caf:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  802cb3:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802cb4:	3e 00 30             	ds add %dh,(%rax)
+  802cb7:	31 32                	xor    %esi,(%rdx)
+  802cb9:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  802cc0:	41                   	rex.B
+  802cc1:	42                   	rex.X
+  802cc2:	43                   	rex.XB
+  802cc3:	44                   	rex.R
+  802cc4:	45                   	rex.RB
+  802cc5:	46 00 30             	rex.RX add %r14b,(%rax)
+  802cc8:	31 32                	xor    %esi,(%rdx)
+  802cca:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  802cd1:	61                   	(bad)
+  802cd2:	62 63 64 65 66       	(bad)
+  802cd7:	00 28                	add    %ch,(%rax)
+  802cd9:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802cda:	75 6c                	jne    802d48 <__rodata_start+0xa0>
+  802cdc:	6c                   	insb   (%dx),%es:(%rdi)
+  802cdd:	29 00                	sub    %eax,(%rax)
+  802cdf:	65 72 72             	gs jb  802d54 <__rodata_start+0xac>
+  802ce2:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802ce3:	72 20                	jb     802d05 <__rodata_start+0x5d>
+  802ce5:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  802cea:	73 70                	jae    802d5c <__rodata_start+0xb4>
+  802cec:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  802cf0:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  802cf7:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802cf8:	72 00                	jb     802cfa <__rodata_start+0x52>
+  802cfa:	62 61 64 20 65       	(bad)
+  802cff:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802d00:	76 69                	jbe    802d6b <__rodata_start+0xc3>
+  802d02:	72 6f                	jb     802d73 <__rodata_start+0xcb>
+  802d04:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802d05:	6d                   	insl   (%dx),%es:(%rdi)
+  802d06:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  802d08:	74 00                	je     802d0a <__rodata_start+0x62>
+  802d0a:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  802d11:	20 70 61             	and    %dh,0x61(%rax)
+  802d14:	72 61                	jb     802d77 <__rodata_start+0xcf>
+  802d16:	6d                   	insl   (%dx),%es:(%rdi)
+  802d17:	65 74 65             	gs je  802d7f <__rodata_start+0xd7>
+  802d1a:	72 00                	jb     802d1c <__rodata_start+0x74>
+  802d1c:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802d1d:	75 74                	jne    802d93 <__rodata_start+0xeb>
+  802d1f:	20 6f 66             	and    %ch,0x66(%rdi)
+  802d22:	20 6d 65             	and    %ch,0x65(%rbp)
+  802d25:	6d                   	insl   (%dx),%es:(%rdi)
+  802d26:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802d27:	72 79                	jb     802da2 <__rodata_start+0xfa>
+  802d29:	00 6f 75             	add    %ch,0x75(%rdi)
+  802d2c:	74 20                	je     802d4e <__rodata_start+0xa6>
+  802d2e:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802d2f:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  802d33:	76 69                	jbe    802d9e <__rodata_start+0xf6>
+  802d35:	72 6f                	jb     802da6 <__rodata_start+0xfe>
+  802d37:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802d38:	6d                   	insl   (%dx),%es:(%rdi)
+  802d39:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  802d3b:	74 73                	je     802db0 <__rodata_start+0x108>
+  802d3d:	00 63 6f             	add    %ah,0x6f(%rbx)
+  802d40:	72 72                	jb     802db4 <__rodata_start+0x10c>
+  802d42:	75 70                	jne    802db4 <__rodata_start+0x10c>
+  802d44:	74 65                	je     802dab <__rodata_start+0x103>
+  802d46:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  802d4b:	75 67                	jne    802db4 <__rodata_start+0x10c>
+  802d4d:	20 69 6e             	and    %ch,0x6e(%rcx)
+  802d50:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  802d52:	00 73 65             	add    %dh,0x65(%rbx)
+  802d55:	67 6d                	insl   (%dx),%es:(%edi)
+  802d57:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  802d59:	74 61                	je     802dbc <__rodata_start+0x114>
+  802d5b:	74 69                	je     802dc6 <__rodata_start+0x11e>
+  802d5d:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802d5e:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802d5f:	20 66 61             	and    %ah,0x61(%rsi)
+  802d62:	75 6c                	jne    802dd0 <__rodata_start+0x128>
+  802d64:	74 00                	je     802d66 <__rodata_start+0xbe>
+  802d66:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  802d6d:	20 45 4c             	and    %al,0x4c(%rbp)
+  802d70:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  802d74:	61                   	(bad)
+  802d75:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  802d7a:	20 73 75             	and    %dh,0x75(%rbx)
+  802d7d:	63 68 20             	movsxd 0x20(%rax),%ebp
+  802d80:	73 79                	jae    802dfb <__rodata_start+0x153>
+  802d82:	73 74                	jae    802df8 <__rodata_start+0x150>
+  802d84:	65 6d                	gs insl (%dx),%es:(%rdi)
+  802d86:	20 63 61             	and    %ah,0x61(%rbx)
+  802d89:	6c                   	insb   (%dx),%es:(%rdi)
+  802d8a:	6c                   	insb   (%dx),%es:(%rdi)
+  802d8b:	00 65 6e             	add    %ah,0x6e(%rbp)
+  802d8e:	74 72                	je     802e02 <__rodata_start+0x15a>
+  802d90:	79 20                	jns    802db2 <__rodata_start+0x10a>
+  802d92:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802d93:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802d94:	74 20                	je     802db6 <__rodata_start+0x10e>
+  802d96:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  802d98:	75 6e                	jne    802e08 <__rodata_start+0x160>
+  802d9a:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  802d9e:	76 20                	jbe    802dc0 <__rodata_start+0x118>
+  802da0:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  802da7:	72 65                	jb     802e0e <__rodata_start+0x166>
+  802da9:	63 76 69             	movsxd 0x69(%rsi),%esi
+  802dac:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802dad:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  802db1:	65 78 70             	gs js  802e24 <__rodata_start+0x17c>
+  802db4:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  802db9:	20 65 6e             	and    %ah,0x6e(%rbp)
+  802dbc:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  802dc0:	20 66 69             	and    %ah,0x69(%rsi)
+  802dc3:	6c                   	insb   (%dx),%es:(%rdi)
+  802dc4:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  802dc8:	20 66 72             	and    %ah,0x72(%rsi)
+  802dcb:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  802dd0:	61                   	(bad)
+  802dd1:	63 65 20             	movsxd 0x20(%rbp),%esp
+  802dd4:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802dd5:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802dd6:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  802dda:	6b 00 74             	imul   $0x74,(%rax),%eax
+  802ddd:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802dde:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802ddf:	20 6d 61             	and    %ch,0x61(%rbp)
+  802de2:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802de3:	79 20                	jns    802e05 <__rodata_start+0x15d>
+  802de5:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  802dec:	72 65                	jb     802e53 <__rodata_start+0x1ab>
+  802dee:	20 6f 70             	and    %ch,0x70(%rdi)
+  802df1:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  802df3:	00 66 69             	add    %ah,0x69(%rsi)
+  802df6:	6c                   	insb   (%dx),%es:(%rdi)
+  802df7:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  802dfb:	20 62 6c             	and    %ah,0x6c(%rdx)
+  802dfe:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802dff:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  802e02:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802e03:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802e04:	74 20                	je     802e26 <__rodata_start+0x17e>
+  802e06:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  802e08:	75 6e                	jne    802e78 <__rodata_start+0x1d0>
+  802e0a:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  802e0e:	76 61                	jbe    802e71 <__rodata_start+0x1c9>
+  802e10:	6c                   	insb   (%dx),%es:(%rdi)
+  802e11:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  802e18:	00 
+  802e19:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  802e20:	72 65                	jb     802e87 <__rodata_start+0x1df>
+  802e22:	61                   	(bad)
+  802e23:	64 79 20             	fs jns 802e46 <__rodata_start+0x19e>
+  802e26:	65 78 69             	gs js  802e92 <__rodata_start+0x1ea>
+  802e29:	73 74                	jae    802e9f <__rodata_start+0x1f7>
+  802e2b:	73 00                	jae    802e2d <__rodata_start+0x185>
+  802e2d:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802e2e:	70 65                	jo     802e95 <__rodata_start+0x1ed>
+  802e30:	72 61                	jb     802e93 <__rodata_start+0x1eb>
+  802e32:	74 69                	je     802e9d <__rodata_start+0x1f5>
+  802e34:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802e35:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802e36:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  802e39:	74 20                	je     802e5b <__rodata_start+0x1b3>
+  802e3b:	73 75                	jae    802eb2 <__rodata_start+0x20a>
+  802e3d:	70 70                	jo     802eaf <__rodata_start+0x207>
+  802e3f:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802e40:	72 74                	jb     802eb6 <__rodata_start+0x20e>
+  802e42:	65 64 00 6f 70       	gs add %ch,%fs:0x70(%rdi)
+  802e47:	65 72 61             	gs jb  802eab <__rodata_start+0x203>
+  802e4a:	74 69                	je     802eb5 <__rodata_start+0x20d>
+  802e4c:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802e4d:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802e4e:	20 69 6e             	and    %ch,0x6e(%rcx)
+  802e51:	74 65                	je     802eb8 <__rodata_start+0x210>
+  802e53:	72 72                	jb     802ec7 <__rodata_start+0x21f>
+  802e55:	75 70                	jne    802ec7 <__rodata_start+0x21f>
+  802e57:	74 65                	je     802ebe <__rodata_start+0x216>
+  802e59:	64 00 6e 6f          	add    %ch,%fs:0x6f(%rsi)
+  802e5d:	74 20                	je     802e7f <__rodata_start+0x1d7>
+  802e5f:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  802e61:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802e62:	75 67                	jne    802ecb <__rodata_start+0x223>
+  802e64:	68 20 43 50 55       	push   $0x55504320
+  802e69:	20 74 69 6d          	and    %dh,0x6d(%rcx,%rbp,2)
+  802e6d:	65 00 66 2e          	add    %ah,%gs:0x2e(%rsi)
+  802e71:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+  802e78:	00 
+  802e79:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+  802e80:	c3                   	ret
+  802e81:	03 80 00 00 00 00    	add    0x0(%rax),%eax
+  802e87:	00 04 0a             	add    %al,(%rdx,%rcx,1)
+  802e8a:	80 00 00             	addb   $0x0,(%rax)
+  802e8d:	00 00                	add    %al,(%rax)
+  802e8f:	00 f4                	add    %dh,%ah
+  802e91:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802e97:	00 04 0a             	add    %al,(%rdx,%rcx,1)
+  802e9a:	80 00 00             	addb   $0x0,(%rax)
+  802e9d:	00 00                	add    %al,(%rax)
+  802e9f:	00 04 0a             	add    %al,(%rdx,%rcx,1)
+  802ea2:	80 00 00             	addb   $0x0,(%rax)
+  802ea5:	00 00                	add    %al,(%rax)
+  802ea7:	00 04 0a             	add    %al,(%rdx,%rcx,1)
+  802eaa:	80 00 00             	addb   $0x0,(%rax)
+  802ead:	00 00                	add    %al,(%rax)
+  802eaf:	00 04 0a             	add    %al,(%rdx,%rcx,1)
+  802eb2:	80 00 00             	addb   $0x0,(%rax)
+  802eb5:	00 00                	add    %al,(%rax)
+  802eb7:	00 e2                	add    %ah,%dl
+  802eb9:	03 80 00 00 00 00    	add    0x0(%rax),%eax
+  802ebf:	00 04 0a             	add    %al,(%rdx,%rcx,1)
+  802ec2:	80 00 00             	addb   $0x0,(%rax)
+  802ec5:	00 00                	add    %al,(%rax)
+  802ec7:	00 04 0a             	add    %al,(%rdx,%rcx,1)
+  802eca:	80 00 00             	addb   $0x0,(%rax)
+  802ecd:	00 00                	add    %al,(%rax)
+  802ecf:	00 d6                	add    %dl,%dh
+  802ed1:	03 80 00 00 00 00    	add    0x0(%rax),%eax
+  802ed7:	00 50 04             	add    %dl,0x4(%rax)
+  802eda:	80 00 00             	addb   $0x0,(%rax)
+  802edd:	00 00                	add    %al,(%rax)
+  802edf:	00 04 0a             	add    %al,(%rdx,%rcx,1)
+  802ee2:	80 00 00             	addb   $0x0,(%rax)
+  802ee5:	00 00                	add    %al,(%rax)
+  802ee7:	00 d6                	add    %dl,%dh
+  802ee9:	03 80 00 00 00 00    	add    0x0(%rax),%eax
+  802eef:	00 1c 04             	add    %bl,(%rsp,%rax,1)
+  802ef2:	80 00 00             	addb   $0x0,(%rax)
+  802ef5:	00 00                	add    %al,(%rax)
+  802ef7:	00 1c 04             	add    %bl,(%rsp,%rax,1)
+  802efa:	80 00 00             	addb   $0x0,(%rax)
+  802efd:	00 00                	add    %al,(%rax)
+  802eff:	00 1c 04             	add    %bl,(%rsp,%rax,1)
+  802f02:	80 00 00             	addb   $0x0,(%rax)
+  802f05:	00 00                	add    %al,(%rax)
+  802f07:	00 1c 04             	add    %bl,(%rsp,%rax,1)
+  802f0a:	80 00 00             	addb   $0x0,(%rax)
+  802f0d:	00 00                	add    %al,(%rax)
+  802f0f:	00 1c 04             	add    %bl,(%rsp,%rax,1)
+  802f12:	80 00 00             	addb   $0x0,(%rax)
+  802f15:	00 00                	add    %al,(%rax)
+  802f17:	00 1c 04             	add    %bl,(%rsp,%rax,1)
+  802f1a:	80 00 00             	addb   $0x0,(%rax)
+  802f1d:	00 00                	add    %al,(%rax)
+  802f1f:	00 1c 04             	add    %bl,(%rsp,%rax,1)
+  802f22:	80 00 00             	addb   $0x0,(%rax)
+  802f25:	00 00                	add    %al,(%rax)
+  802f27:	00 1c 04             	add    %bl,(%rsp,%rax,1)
+  802f2a:	80 00 00             	addb   $0x0,(%rax)
+  802f2d:	00 00                	add    %al,(%rax)
+  802f2f:	00 1c 04             	add    %bl,(%rsp,%rax,1)
+  802f32:	80 00 00             	addb   $0x0,(%rax)
+  802f35:	00 00                	add    %al,(%rax)
+  802f37:	00 04 0a             	add    %al,(%rdx,%rcx,1)
+  802f3a:	80 00 00             	addb   $0x0,(%rax)
+  802f3d:	00 00                	add    %al,(%rax)
+  802f3f:	00 04 0a             	add    %al,(%rdx,%rcx,1)
+  802f42:	80 00 00             	addb   $0x0,(%rax)
+  802f45:	00 00                	add    %al,(%rax)
+  802f47:	00 04 0a             	add    %al,(%rdx,%rcx,1)
+  802f4a:	80 00 00             	addb   $0x0,(%rax)
+  802f4d:	00 00                	add    %al,(%rax)
+  802f4f:	00 04 0a             	add    %al,(%rdx,%rcx,1)
+  802f52:	80 00 00             	addb   $0x0,(%rax)
+  802f55:	00 00                	add    %al,(%rax)
+  802f57:	00 04 0a             	add    %al,(%rdx,%rcx,1)
+  802f5a:	80 00 00             	addb   $0x0,(%rax)
+  802f5d:	00 00                	add    %al,(%rax)
+  802f5f:	00 04 0a             	add    %al,(%rdx,%rcx,1)
+  802f62:	80 00 00             	addb   $0x0,(%rax)
+  802f65:	00 00                	add    %al,(%rax)
+  802f67:	00 04 0a             	add    %al,(%rdx,%rcx,1)
+  802f6a:	80 00 00             	addb   $0x0,(%rax)
+  802f6d:	00 00                	add    %al,(%rax)
+  802f6f:	00 04 0a             	add    %al,(%rdx,%rcx,1)
+  802f72:	80 00 00             	addb   $0x0,(%rax)
+  802f75:	00 00                	add    %al,(%rax)
+  802f77:	00 04 0a             	add    %al,(%rdx,%rcx,1)
+  802f7a:	80 00 00             	addb   $0x0,(%rax)
+  802f7d:	00 00                	add    %al,(%rax)
+  802f7f:	00 04 0a             	add    %al,(%rdx,%rcx,1)
+  802f82:	80 00 00             	addb   $0x0,(%rax)
+  802f85:	00 00                	add    %al,(%rax)
+  802f87:	00 04 0a             	add    %al,(%rdx,%rcx,1)
+  802f8a:	80 00 00             	addb   $0x0,(%rax)
+  802f8d:	00 00                	add    %al,(%rax)
+  802f8f:	00 04 0a             	add    %al,(%rdx,%rcx,1)
+  802f92:	80 00 00             	addb   $0x0,(%rax)
+  802f95:	00 00                	add    %al,(%rax)
+  802f97:	00 04 0a             	add    %al,(%rdx,%rcx,1)
+  802f9a:	80 00 00             	addb   $0x0,(%rax)
+  802f9d:	00 00                	add    %al,(%rax)
+  802f9f:	00 04 0a             	add    %al,(%rdx,%rcx,1)
+  802fa2:	80 00 00             	addb   $0x0,(%rax)
+  802fa5:	00 00                	add    %al,(%rax)
+  802fa7:	00 04 0a             	add    %al,(%rdx,%rcx,1)
+  802faa:	80 00 00             	addb   $0x0,(%rax)
+  802fad:	00 00                	add    %al,(%rax)
+  802faf:	00 04 0a             	add    %al,(%rdx,%rcx,1)
+  802fb2:	80 00 00             	addb   $0x0,(%rax)
+  802fb5:	00 00                	add    %al,(%rax)
+  802fb7:	00 04 0a             	add    %al,(%rdx,%rcx,1)
+  802fba:	80 00 00             	addb   $0x0,(%rax)
+  802fbd:	00 00                	add    %al,(%rax)
+  802fbf:	00 04 0a             	add    %al,(%rdx,%rcx,1)
+  802fc2:	80 00 00             	addb   $0x0,(%rax)
+  802fc5:	00 00                	add    %al,(%rax)
+  802fc7:	00 04 0a             	add    %al,(%rdx,%rcx,1)
+  802fca:	80 00 00             	addb   $0x0,(%rax)
+  802fcd:	00 00                	add    %al,(%rax)
+  802fcf:	00 04 0a             	add    %al,(%rdx,%rcx,1)
+  802fd2:	80 00 00             	addb   $0x0,(%rax)
+  802fd5:	00 00                	add    %al,(%rax)
+  802fd7:	00 04 0a             	add    %al,(%rdx,%rcx,1)
+  802fda:	80 00 00             	addb   $0x0,(%rax)
+  802fdd:	00 00                	add    %al,(%rax)
+  802fdf:	00 04 0a             	add    %al,(%rdx,%rcx,1)
+  802fe2:	80 00 00             	addb   $0x0,(%rax)
+  802fe5:	00 00                	add    %al,(%rax)
+  802fe7:	00 04 0a             	add    %al,(%rdx,%rcx,1)
+  802fea:	80 00 00             	addb   $0x0,(%rax)
+  802fed:	00 00                	add    %al,(%rax)
+  802fef:	00 04 0a             	add    %al,(%rdx,%rcx,1)
+  802ff2:	80 00 00             	addb   $0x0,(%rax)
+  802ff5:	00 00                	add    %al,(%rax)
+  802ff7:	00 04 0a             	add    %al,(%rdx,%rcx,1)
+  802ffa:	80 00 00             	addb   $0x0,(%rax)
+  802ffd:	00 00                	add    %al,(%rax)
+  802fff:	00 04 0a             	add    %al,(%rdx,%rcx,1)
+  803002:	80 00 00             	addb   $0x0,(%rax)
+  803005:	00 00                	add    %al,(%rax)
+  803007:	00 04 0a             	add    %al,(%rdx,%rcx,1)
+  80300a:	80 00 00             	addb   $0x0,(%rax)
+  80300d:	00 00                	add    %al,(%rax)
+  80300f:	00 04 0a             	add    %al,(%rdx,%rcx,1)
+  803012:	80 00 00             	addb   $0x0,(%rax)
+  803015:	00 00                	add    %al,(%rax)
+  803017:	00 04 0a             	add    %al,(%rdx,%rcx,1)
+  80301a:	80 00 00             	addb   $0x0,(%rax)
+  80301d:	00 00                	add    %al,(%rax)
+  80301f:	00 04 0a             	add    %al,(%rdx,%rcx,1)
+  803022:	80 00 00             	addb   $0x0,(%rax)
+  803025:	00 00                	add    %al,(%rax)
+  803027:	00 27                	add    %ah,(%rdi)
+  803029:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  80302f:	00 04 0a             	add    %al,(%rdx,%rcx,1)
+  803032:	80 00 00             	addb   $0x0,(%rax)
+  803035:	00 00                	add    %al,(%rax)
+  803037:	00 04 0a             	add    %al,(%rdx,%rcx,1)
+  80303a:	80 00 00             	addb   $0x0,(%rax)
+  80303d:	00 00                	add    %al,(%rax)
+  80303f:	00 04 0a             	add    %al,(%rdx,%rcx,1)
+  803042:	80 00 00             	addb   $0x0,(%rax)
+  803045:	00 00                	add    %al,(%rax)
+  803047:	00 04 0a             	add    %al,(%rdx,%rcx,1)
+  80304a:	80 00 00             	addb   $0x0,(%rax)
+  80304d:	00 00                	add    %al,(%rax)
+  80304f:	00 04 0a             	add    %al,(%rdx,%rcx,1)
+  803052:	80 00 00             	addb   $0x0,(%rax)
+  803055:	00 00                	add    %al,(%rax)
+  803057:	00 04 0a             	add    %al,(%rdx,%rcx,1)
+  80305a:	80 00 00             	addb   $0x0,(%rax)
+  80305d:	00 00                	add    %al,(%rax)
+  80305f:	00 04 0a             	add    %al,(%rdx,%rcx,1)
+  803062:	80 00 00             	addb   $0x0,(%rax)
+  803065:	00 00                	add    %al,(%rax)
+  803067:	00 04 0a             	add    %al,(%rdx,%rcx,1)
+  80306a:	80 00 00             	addb   $0x0,(%rax)
+  80306d:	00 00                	add    %al,(%rax)
+  80306f:	00 04 0a             	add    %al,(%rdx,%rcx,1)
+  803072:	80 00 00             	addb   $0x0,(%rax)
+  803075:	00 00                	add    %al,(%rax)
+  803077:	00 04 0a             	add    %al,(%rdx,%rcx,1)
+  80307a:	80 00 00             	addb   $0x0,(%rax)
+  80307d:	00 00                	add    %al,(%rax)
+  80307f:	00 73 04             	add    %dh,0x4(%rbx)
+  803082:	80 00 00             	addb   $0x0,(%rax)
+  803085:	00 00                	add    %al,(%rax)
+  803087:	00 42 06             	add    %al,0x6(%rdx)
+  80308a:	80 00 00             	addb   $0x0,(%rax)
+  80308d:	00 00                	add    %al,(%rax)
+  80308f:	00 04 0a             	add    %al,(%rdx,%rcx,1)
+  803092:	80 00 00             	addb   $0x0,(%rax)
+  803095:	00 00                	add    %al,(%rax)
+  803097:	00 04 0a             	add    %al,(%rdx,%rcx,1)
+  80309a:	80 00 00             	addb   $0x0,(%rax)
+  80309d:	00 00                	add    %al,(%rax)
+  80309f:	00 04 0a             	add    %al,(%rdx,%rcx,1)
+  8030a2:	80 00 00             	addb   $0x0,(%rax)
+  8030a5:	00 00                	add    %al,(%rax)
+  8030a7:	00 04 0a             	add    %al,(%rdx,%rcx,1)
+  8030aa:	80 00 00             	addb   $0x0,(%rax)
+  8030ad:	00 00                	add    %al,(%rax)
+  8030af:	00 a2 04 80 00 00    	add    %ah,0x8004(%rdx)
+  8030b5:	00 00                	add    %al,(%rax)
+  8030b7:	00 04 0a             	add    %al,(%rdx,%rcx,1)
+  8030ba:	80 00 00             	addb   $0x0,(%rax)
+  8030bd:	00 00                	add    %al,(%rax)
+  8030bf:	00 04 0a             	add    %al,(%rdx,%rcx,1)
+  8030c2:	80 00 00             	addb   $0x0,(%rax)
+  8030c5:	00 00                	add    %al,(%rax)
+  8030c7:	00 68 04             	add    %ch,0x4(%rax)
+  8030ca:	80 00 00             	addb   $0x0,(%rax)
+  8030cd:	00 00                	add    %al,(%rax)
+  8030cf:	00 04 0a             	add    %al,(%rdx,%rcx,1)
+  8030d2:	80 00 00             	addb   $0x0,(%rax)
+  8030d5:	00 00                	add    %al,(%rax)
+  8030d7:	00 04 0a             	add    %al,(%rdx,%rcx,1)
+  8030da:	80 00 00             	addb   $0x0,(%rax)
+  8030dd:	00 00                	add    %al,(%rax)
+  8030df:	00 ea                	add    %ch,%dl
+  8030e1:	07                   	(bad)
+  8030e2:	80 00 00             	addb   $0x0,(%rax)
+  8030e5:	00 00                	add    %al,(%rax)
+  8030e7:	00 b4 08 80 00 00 00 	add    %dh,0x80(%rax,%rcx,1)
+  8030ee:	00 00                	add    %al,(%rax)
+  8030f0:	04 0a                	add    $0xa,%al
+  8030f2:	80 00 00             	addb   $0x0,(%rax)
+  8030f5:	00 00                	add    %al,(%rax)
+  8030f7:	00 04 0a             	add    %al,(%rdx,%rcx,1)
+  8030fa:	80 00 00             	addb   $0x0,(%rax)
+  8030fd:	00 00                	add    %al,(%rax)
+  8030ff:	00 39                	add    %bh,(%rcx)
+  803101:	05 80 00 00 00       	add    $0x80,%eax
+  803106:	00 00                	add    %al,(%rax)
+  803108:	04 0a                	add    $0xa,%al
+  80310a:	80 00 00             	addb   $0x0,(%rax)
+  80310d:	00 00                	add    %al,(%rax)
+  80310f:	00 16                	add    %dl,(%rsi)
+  803111:	07                   	(bad)
+  803112:	80 00 00             	addb   $0x0,(%rax)
+  803115:	00 00                	add    %al,(%rax)
+  803117:	00 04 0a             	add    %al,(%rdx,%rcx,1)
+  80311a:	80 00 00             	addb   $0x0,(%rax)
+  80311d:	00 00                	add    %al,(%rax)
+  80311f:	00 04 0a             	add    %al,(%rdx,%rcx,1)
+  803122:	80 00 00             	addb   $0x0,(%rax)
+  803125:	00 00                	add    %al,(%rax)
+  803127:	00 27                	add    %ah,(%rdi)
+  803129:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  80312f:	00 04 0a             	add    %al,(%rdx,%rcx,1)
+  803132:	80 00 00             	addb   $0x0,(%rax)
+  803135:	00 00                	add    %al,(%rax)
+  803137:	00 cc                	add    %cl,%ah
+  803139:	03 80 00 00 00 00    	add    0x0(%rax),%eax
+	...
+
+0000000000803140 <error_string>:
+	...
+  803148:	e8 2c 80 00 00 00 00 00 fa 2c 80 00 00 00 00 00     .,.......,......
+  803158:	0a 2d 80 00 00 00 00 00 1c 2d 80 00 00 00 00 00     .-.......-......
+  803168:	2a 2d 80 00 00 00 00 00 3e 2d 80 00 00 00 00 00     *-......>-......
+  803178:	53 2d 80 00 00 00 00 00 66 2d 80 00 00 00 00 00     S-......f-......
+  803188:	78 2d 80 00 00 00 00 00 8c 2d 80 00 00 00 00 00     x-.......-......
+  803198:	9c 2d 80 00 00 00 00 00 af 2d 80 00 00 00 00 00     .-.......-......
+  8031a8:	c6 2d 80 00 00 00 00 00 dc 2d 80 00 00 00 00 00     .-.......-......
+  8031b8:	f4 2d 80 00 00 00 00 00 0c 2e 80 00 00 00 00 00     .-..............
+  8031c8:	19 2e 80 00 00 00 00 00 f0 31 80 00 00 00 00 00     .........1......
+  8031d8:	2d 2e 80 00 00 00 00 00 45 2e 80 00 00 00 00 00     -.......E.......
+  8031e8:	5b 2e 80 00 00 00 00 00 66 69 6c 65 20 69 73 20     [.......file is 
+  8031f8:	6e 6f 74 20 61 20 76 61 6c 69 64 20 65 78 65 63     not a valid exec
+  803208:	75 74 61 62 6c 65 00 90 73 79 73 63 61 6c 6c 20     utable..syscall 
+  803218:	25 7a 64 20 72 65 74 75 72 6e 65 64 20 25 7a 64     %zd returned %zd
+  803228:	20 28 3e 20 30 29 00 6c 69 62 2f 73 79 73 63 61      (> 0).lib/sysca
+  803238:	6c 6c 2e 63 00 0f 1f 00 5b 25 30 38 78 5d 20 75     ll.c....[%08x] u
+  803248:	6e 6b 6e 6f 77 6e 20 64 65 76 69 63 65 20 74 79     nknown device ty
+  803258:	70 65 20 25 64 0a 00 00 5b 25 30 38 78 5d 20 66     pe %d...[%08x] f
+  803268:	74 72 75 6e 63 61 74 65 20 25 64 20 2d 2d 20 62     truncate %d -- b
+  803278:	61 64 20 6d 6f 64 65 0a 00 5b 25 30 38 78 5d 20     ad mode..[%08x] 
+  803288:	72 65 61 64 20 25 64 20 2d 2d 20 62 61 64 20 6d     read %d -- bad m
+  803298:	6f 64 65 0a 00 5b 25 30 38 78 5d 20 77 72 69 74     ode..[%08x] writ
+  8032a8:	65 20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65     e %d -- bad mode
+  8032b8:	0a 00 66 0f 1f 44 00 00                             ..f..D..
+
+00000000008032c0 <devtab>:
+  8032c0:	20 40 80 00 00 00 00 00 60 40 80 00 00 00 00 00      @......`@......
+  8032d0:	a0 40 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .@..............
+  8032e0:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  8032f0:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  803300:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  803310:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  803320:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  803330:	3d 20 32 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73 00     = 2.<cons>.cons.
+  803340:	5b 25 30 38 78 5d 20 75 73 65 72 20 70 61 6e 69     [%08x] user pani
+  803350:	63 20 69 6e 20 25 73 20 61 74 20 25 73 3a 25 64     c in %s at %s:%d
+  803360:	3a 20 00 73 79 73 5f 69 70 63 5f 74 72 79 5f 73     : .sys_ipc_try_s
+  803370:	65 6e 64 20 66 61 69 6c 65 64 3a 20 25 69 00 6c     end failed: %i.l
+  803380:	69 62 2f 69 70 63 2e 63 00 66 2e 0f 1f 84 00 00     ib/ipc.c.f......
+  803390:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8033a0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8033b0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8033c0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8033d0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8033e0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8033f0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803400:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803410:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803420:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803430:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803440:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803450:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803460:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803470:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803480:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803490:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8034a0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8034b0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8034c0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8034d0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8034e0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8034f0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803500:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803510:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803520:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803530:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803540:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803550:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803560:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803570:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803580:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803590:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8035a0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8035b0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8035c0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8035d0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8035e0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8035f0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803600:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803610:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803620:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803630:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803640:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803650:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803660:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803670:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803680:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803690:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8036a0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8036b0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8036c0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8036d0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8036e0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8036f0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803700:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803710:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803720:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803730:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803740:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803750:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803760:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803770:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803780:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803790:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8037a0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8037b0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8037c0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8037d0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8037e0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8037f0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803800:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803810:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803820:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803830:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803840:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803850:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803860:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803870:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803880:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803890:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8038a0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8038b0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8038c0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8038d0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8038e0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8038f0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803900:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803910:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803920:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803930:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803940:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803950:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803960:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803970:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803980:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803990:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8039a0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8039b0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8039c0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8039d0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8039e0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8039f0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803a00:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803a10:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803a20:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803a30:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803a40:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803a50:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803a60:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803a70:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803a80:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803a90:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803aa0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803ab0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803ac0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803ad0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803ae0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803af0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803b00:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803b10:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803b20:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803b30:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803b40:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803b50:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803b60:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803b70:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803b80:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803b90:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803ba0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803bb0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803bc0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803bd0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803be0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803bf0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803c00:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803c10:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803c20:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803c30:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803c40:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803c50:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803c60:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803c70:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803c80:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803c90:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803ca0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803cb0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803cc0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803cd0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803ce0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803cf0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803d00:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803d10:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803d20:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803d30:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803d40:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803d50:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803d60:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803d70:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803d80:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803d90:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803da0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803db0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803dc0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803dd0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803de0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803df0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803e00:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803e10:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803e20:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803e30:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803e40:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803e50:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803e60:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803e70:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803e80:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803e90:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803ea0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803eb0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803ec0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803ed0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803ee0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803ef0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803f00:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803f10:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803f20:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803f30:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803f40:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803f50:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803f60:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803f70:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803f80:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803f90:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803fa0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803fb0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803fc0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803fd0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803fe0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803ff0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 90     .....f..........
@@ -0,0 +1,5434 @@
+
+obj/user/breakpoint:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 04 00 00 00       	call   800027 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+    asm volatile("int $3");
+  800025:	cc                   	int3
+}
+  800026:	c3                   	ret
+
+0000000000800027 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800027:	55                   	push   %rbp
+  800028:	48 89 e5             	mov    %rsp,%rbp
+  80002b:	41 56                	push   %r14
+  80002d:	41 55                	push   %r13
+  80002f:	41 54                	push   %r12
+  800031:	53                   	push   %rbx
+  800032:	41 89 fd             	mov    %edi,%r13d
+  800035:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800038:	48 ba d8 40 80 00 00 	movabs $0x8040d8,%rdx
+  80003f:	00 00 00 
+  800042:	48 b8 d8 40 80 00 00 	movabs $0x8040d8,%rax
+  800049:	00 00 00 
+  80004c:	48 39 c2             	cmp    %rax,%rdx
+  80004f:	73 17                	jae    800068 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  800051:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  800054:	49 89 c4             	mov    %rax,%r12
+  800057:	48 83 c3 08          	add    $0x8,%rbx
+  80005b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800060:	ff 53 f8             	call   *-0x8(%rbx)
+  800063:	4c 39 e3             	cmp    %r12,%rbx
+  800066:	72 ef                	jb     800057 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+    envid_t this_env_id = sys_getenvid();
+  800068:	48 b8 bc 01 80 00 00 	movabs $0x8001bc,%rax
+  80006f:	00 00 00 
+  800072:	ff d0                	call   *%rax
+    thisenv = &((struct Env*)UENVS)[ENVX(this_env_id)];
+  800074:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800079:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+  800080:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  800087:	00 00 00 
+  80008a:	48 01 d0             	add    %rdx,%rax
+  80008d:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  800094:	00 00 00 
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  800097:	45 85 ed             	test   %r13d,%r13d
+  80009a:	7e 0d                	jle    8000a9 <libmain+0x82>
+  80009c:	49 8b 06             	mov    (%r14),%rax
+  80009f:	48 a3 00 40 80 00 00 	movabs %rax,0x804000
+  8000a6:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8000a9:	4c 89 f6             	mov    %r14,%rsi
+  8000ac:	44 89 ef             	mov    %r13d,%edi
+  8000af:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8000b6:	00 00 00 
+  8000b9:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8000bb:	48 b8 d0 00 80 00 00 	movabs $0x8000d0,%rax
+  8000c2:	00 00 00 
+  8000c5:	ff d0                	call   *%rax
+#endif
+}
+  8000c7:	5b                   	pop    %rbx
+  8000c8:	41 5c                	pop    %r12
+  8000ca:	41 5d                	pop    %r13
+  8000cc:	41 5e                	pop    %r14
+  8000ce:	5d                   	pop    %rbp
+  8000cf:	c3                   	ret
+
+00000000008000d0 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8000d0:	55                   	push   %rbp
+  8000d1:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  8000d4:	48 b8 10 09 80 00 00 	movabs $0x800910,%rax
+  8000db:	00 00 00 
+  8000de:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  8000e0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8000e5:	48 b8 51 01 80 00 00 	movabs $0x800151,%rax
+  8000ec:	00 00 00 
+  8000ef:	ff d0                	call   *%rax
+}
+  8000f1:	5d                   	pop    %rbp
+  8000f2:	c3                   	ret
+
+00000000008000f3 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  8000f3:	55                   	push   %rbp
+  8000f4:	48 89 e5             	mov    %rsp,%rbp
+  8000f7:	53                   	push   %rbx
+  8000f8:	48 89 fa             	mov    %rdi,%rdx
+  8000fb:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8000fe:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800103:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800108:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80010d:	be 00 00 00 00       	mov    $0x0,%esi
+  800112:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800118:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  80011a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80011e:	c9                   	leave
+  80011f:	c3                   	ret
+
+0000000000800120 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  800120:	55                   	push   %rbp
+  800121:	48 89 e5             	mov    %rsp,%rbp
+  800124:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  800125:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80012a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80012f:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800134:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800139:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80013e:	be 00 00 00 00       	mov    $0x0,%esi
+  800143:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800149:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  80014b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80014f:	c9                   	leave
+  800150:	c3                   	ret
+
+0000000000800151 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  800151:	55                   	push   %rbp
+  800152:	48 89 e5             	mov    %rsp,%rbp
+  800155:	53                   	push   %rbx
+  800156:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  80015a:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80015d:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800162:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800167:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80016c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800171:	be 00 00 00 00       	mov    $0x0,%esi
+  800176:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80017c:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80017e:	48 85 c0             	test   %rax,%rax
+  800181:	7f 06                	jg     800189 <sys_env_destroy+0x38>
+}
+  800183:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800187:	c9                   	leave
+  800188:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800189:	49 89 c0             	mov    %rax,%r8
+  80018c:	b9 03 00 00 00       	mov    $0x3,%ecx
+  800191:	48 ba 88 2c 80 00 00 	movabs $0x802c88,%rdx
+  800198:	00 00 00 
+  80019b:	be 26 00 00 00       	mov    $0x26,%esi
+  8001a0:	48 bf a7 2c 80 00 00 	movabs $0x802ca7,%rdi
+  8001a7:	00 00 00 
+  8001aa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001af:	49 b9 0d 1c 80 00 00 	movabs $0x801c0d,%r9
+  8001b6:	00 00 00 
+  8001b9:	41 ff d1             	call   *%r9
+
+00000000008001bc <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  8001bc:	55                   	push   %rbp
+  8001bd:	48 89 e5             	mov    %rsp,%rbp
+  8001c0:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8001c1:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8001c6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8001cb:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8001d0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8001d5:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8001da:	be 00 00 00 00       	mov    $0x0,%esi
+  8001df:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8001e5:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  8001e7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8001eb:	c9                   	leave
+  8001ec:	c3                   	ret
+
+00000000008001ed <sys_yield>:
+
+void
+sys_yield(void) {
+  8001ed:	55                   	push   %rbp
+  8001ee:	48 89 e5             	mov    %rsp,%rbp
+  8001f1:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8001f2:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8001f7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8001fc:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800201:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800206:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80020b:	be 00 00 00 00       	mov    $0x0,%esi
+  800210:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800216:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  800218:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80021c:	c9                   	leave
+  80021d:	c3                   	ret
+
+000000000080021e <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  80021e:	55                   	push   %rbp
+  80021f:	48 89 e5             	mov    %rsp,%rbp
+  800222:	53                   	push   %rbx
+  800223:	48 89 fa             	mov    %rdi,%rdx
+  800226:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  800229:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80022e:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  800235:	00 00 00 
+  800238:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80023d:	be 00 00 00 00       	mov    $0x0,%esi
+  800242:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800248:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  80024a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80024e:	c9                   	leave
+  80024f:	c3                   	ret
+
+0000000000800250 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  800250:	55                   	push   %rbp
+  800251:	48 89 e5             	mov    %rsp,%rbp
+  800254:	53                   	push   %rbx
+  800255:	49 89 f8             	mov    %rdi,%r8
+  800258:	48 89 d3             	mov    %rdx,%rbx
+  80025b:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80025e:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800263:	4c 89 c2             	mov    %r8,%rdx
+  800266:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800269:	be 00 00 00 00       	mov    $0x0,%esi
+  80026e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800274:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  800276:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80027a:	c9                   	leave
+  80027b:	c3                   	ret
+
+000000000080027c <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  80027c:	55                   	push   %rbp
+  80027d:	48 89 e5             	mov    %rsp,%rbp
+  800280:	53                   	push   %rbx
+  800281:	48 83 ec 08          	sub    $0x8,%rsp
+  800285:	89 f8                	mov    %edi,%eax
+  800287:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  80028a:	48 63 f9             	movslq %ecx,%rdi
+  80028d:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800290:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800295:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800298:	be 00 00 00 00       	mov    $0x0,%esi
+  80029d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8002a3:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8002a5:	48 85 c0             	test   %rax,%rax
+  8002a8:	7f 06                	jg     8002b0 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  8002aa:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8002ae:	c9                   	leave
+  8002af:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8002b0:	49 89 c0             	mov    %rax,%r8
+  8002b3:	b9 04 00 00 00       	mov    $0x4,%ecx
+  8002b8:	48 ba 88 2c 80 00 00 	movabs $0x802c88,%rdx
+  8002bf:	00 00 00 
+  8002c2:	be 26 00 00 00       	mov    $0x26,%esi
+  8002c7:	48 bf a7 2c 80 00 00 	movabs $0x802ca7,%rdi
+  8002ce:	00 00 00 
+  8002d1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002d6:	49 b9 0d 1c 80 00 00 	movabs $0x801c0d,%r9
+  8002dd:	00 00 00 
+  8002e0:	41 ff d1             	call   *%r9
+
+00000000008002e3 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8002e3:	55                   	push   %rbp
+  8002e4:	48 89 e5             	mov    %rsp,%rbp
+  8002e7:	53                   	push   %rbx
+  8002e8:	48 83 ec 08          	sub    $0x8,%rsp
+  8002ec:	89 f8                	mov    %edi,%eax
+  8002ee:	49 89 f2             	mov    %rsi,%r10
+  8002f1:	48 89 cf             	mov    %rcx,%rdi
+  8002f4:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  8002f7:	48 63 da             	movslq %edx,%rbx
+  8002fa:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8002fd:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800302:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800305:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  800308:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80030a:	48 85 c0             	test   %rax,%rax
+  80030d:	7f 06                	jg     800315 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  80030f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800313:	c9                   	leave
+  800314:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800315:	49 89 c0             	mov    %rax,%r8
+  800318:	b9 05 00 00 00       	mov    $0x5,%ecx
+  80031d:	48 ba 88 2c 80 00 00 	movabs $0x802c88,%rdx
+  800324:	00 00 00 
+  800327:	be 26 00 00 00       	mov    $0x26,%esi
+  80032c:	48 bf a7 2c 80 00 00 	movabs $0x802ca7,%rdi
+  800333:	00 00 00 
+  800336:	b8 00 00 00 00       	mov    $0x0,%eax
+  80033b:	49 b9 0d 1c 80 00 00 	movabs $0x801c0d,%r9
+  800342:	00 00 00 
+  800345:	41 ff d1             	call   *%r9
+
+0000000000800348 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  800348:	55                   	push   %rbp
+  800349:	48 89 e5             	mov    %rsp,%rbp
+  80034c:	53                   	push   %rbx
+  80034d:	48 83 ec 08          	sub    $0x8,%rsp
+  800351:	48 89 f1             	mov    %rsi,%rcx
+  800354:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  800357:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80035a:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80035f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800364:	be 00 00 00 00       	mov    $0x0,%esi
+  800369:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80036f:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800371:	48 85 c0             	test   %rax,%rax
+  800374:	7f 06                	jg     80037c <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  800376:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80037a:	c9                   	leave
+  80037b:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80037c:	49 89 c0             	mov    %rax,%r8
+  80037f:	b9 06 00 00 00       	mov    $0x6,%ecx
+  800384:	48 ba 88 2c 80 00 00 	movabs $0x802c88,%rdx
+  80038b:	00 00 00 
+  80038e:	be 26 00 00 00       	mov    $0x26,%esi
+  800393:	48 bf a7 2c 80 00 00 	movabs $0x802ca7,%rdi
+  80039a:	00 00 00 
+  80039d:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003a2:	49 b9 0d 1c 80 00 00 	movabs $0x801c0d,%r9
+  8003a9:	00 00 00 
+  8003ac:	41 ff d1             	call   *%r9
+
+00000000008003af <sys_region_batch>:
+
+int
+sys_region_batch(const struct RegionOp *ops, size_t count) {
+  8003af:	55                   	push   %rbp
+  8003b0:	48 89 e5             	mov    %rsp,%rbp
+  8003b3:	53                   	push   %rbx
+  8003b4:	48 83 ec 08          	sub    $0x8,%rsp
+  8003b8:	48 89 fa             	mov    %rdi,%rdx
+  8003bb:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8003be:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8003c3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8003c8:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8003cd:	be 00 00 00 00       	mov    $0x0,%esi
+  8003d2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8003d8:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8003da:	48 85 c0             	test   %rax,%rax
+  8003dd:	7f 06                	jg     8003e5 <sys_region_batch+0x36>
+        else
+            platform_asan_unpoison(va, ops[i].size);
+    }
+#endif
+    return res;
+}
+  8003df:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8003e3:	c9                   	leave
+  8003e4:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8003e5:	49 89 c0             	mov    %rax,%r8
+  8003e8:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  8003ed:	48 ba 88 2c 80 00 00 	movabs $0x802c88,%rdx
+  8003f4:	00 00 00 
+  8003f7:	be 26 00 00 00       	mov    $0x26,%esi
+  8003fc:	48 bf a7 2c 80 00 00 	movabs $0x802ca7,%rdi
+  800403:	00 00 00 
+  800406:	b8 00 00 00 00       	mov    $0x0,%eax
+  80040b:	49 b9 0d 1c 80 00 00 	movabs $0x801c0d,%r9
+  800412:	00 00 00 
+  800415:	41 ff d1             	call   *%r9
+
+0000000000800418 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  800418:	55                   	push   %rbp
+  800419:	48 89 e5             	mov    %rsp,%rbp
+  80041c:	53                   	push   %rbx
+  80041d:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  800421:	48 63 ce             	movslq %esi,%rcx
+  800424:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800427:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80042c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800431:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800436:	be 00 00 00 00       	mov    $0x0,%esi
+  80043b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800441:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800443:	48 85 c0             	test   %rax,%rax
+  800446:	7f 06                	jg     80044e <sys_env_set_status+0x36>
+}
+  800448:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80044c:	c9                   	leave
+  80044d:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80044e:	49 89 c0             	mov    %rax,%r8
+  800451:	b9 09 00 00 00       	mov    $0x9,%ecx
+  800456:	48 ba 88 2c 80 00 00 	movabs $0x802c88,%rdx
+  80045d:	00 00 00 
+  800460:	be 26 00 00 00       	mov    $0x26,%esi
+  800465:	48 bf a7 2c 80 00 00 	movabs $0x802ca7,%rdi
+  80046c:	00 00 00 
+  80046f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800474:	49 b9 0d 1c 80 00 00 	movabs $0x801c0d,%r9
+  80047b:	00 00 00 
+  80047e:	41 ff d1             	call   *%r9
+
+0000000000800481 <sys_env_set_weight>:
+
+int
+sys_env_set_weight(envid_t envid, uint32_t weight) {
+  800481:	55                   	push   %rbp
+  800482:	48 89 e5             	mov    %rsp,%rbp
+  800485:	53                   	push   %rbx
+  800486:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_weight, 1, envid, weight, 0, 0, 0, 0);
+  80048a:	89 f1                	mov    %esi,%ecx
+  80048c:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80048f:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800494:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800499:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80049e:	be 00 00 00 00       	mov    $0x0,%esi
+  8004a3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8004a9:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8004ab:	48 85 c0             	test   %rax,%rax
+  8004ae:	7f 06                	jg     8004b6 <sys_env_set_weight+0x35>
+}
+  8004b0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8004b4:	c9                   	leave
+  8004b5:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8004b6:	49 89 c0             	mov    %rax,%r8
+  8004b9:	b9 10 00 00 00       	mov    $0x10,%ecx
+  8004be:	48 ba 88 2c 80 00 00 	movabs $0x802c88,%rdx
+  8004c5:	00 00 00 
+  8004c8:	be 26 00 00 00       	mov    $0x26,%esi
+  8004cd:	48 bf a7 2c 80 00 00 	movabs $0x802ca7,%rdi
+  8004d4:	00 00 00 
+  8004d7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004dc:	49 b9 0d 1c 80 00 00 	movabs $0x801c0d,%r9
+  8004e3:	00 00 00 
+  8004e6:	41 ff d1             	call   *%r9
+
+00000000008004e9 <sys_env_set_rt>:
+
+int
+sys_env_set_rt(envid_t envid, uint64_t period, uint64_t budget, uint64_t deadline) {
+  8004e9:	55                   	push   %rbp
+  8004ea:	48 89 e5             	mov    %rsp,%rbp
+  8004ed:	53                   	push   %rbx
+  8004ee:	48 83 ec 08          	sub    $0x8,%rsp
+  8004f2:	89 f8                	mov    %edi,%eax
+  8004f4:	48 89 d3             	mov    %rdx,%rbx
+  8004f7:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_env_set_rt, 1, envid, period, budget, deadline, 0, 0);
+  8004fa:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8004fd:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800502:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800505:	be 00 00 00 00       	mov    $0x0,%esi
+  80050a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800510:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800512:	48 85 c0             	test   %rax,%rax
+  800515:	7f 06                	jg     80051d <sys_env_set_rt+0x34>
+}
+  800517:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80051b:	c9                   	leave
+  80051c:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80051d:	49 89 c0             	mov    %rax,%r8
+  800520:	b9 11 00 00 00       	mov    $0x11,%ecx
+  800525:	48 ba 88 2c 80 00 00 	movabs $0x802c88,%rdx
+  80052c:	00 00 00 
+  80052f:	be 26 00 00 00       	mov    $0x26,%esi
+  800534:	48 bf a7 2c 80 00 00 	movabs $0x802ca7,%rdi
+  80053b:	00 00 00 
+  80053e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800543:	49 b9 0d 1c 80 00 00 	movabs $0x801c0d,%r9
+  80054a:	00 00 00 
+  80054d:	41 ff d1             	call   *%r9
+
+0000000000800550 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  800550:	55                   	push   %rbp
+  800551:	48 89 e5             	mov    %rsp,%rbp
+  800554:	53                   	push   %rbx
+  800555:	48 83 ec 08          	sub    $0x8,%rsp
+  800559:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  80055c:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80055f:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800564:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800569:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80056e:	be 00 00 00 00       	mov    $0x0,%esi
+  800573:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800579:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80057b:	48 85 c0             	test   %rax,%rax
+  80057e:	7f 06                	jg     800586 <sys_env_set_trapframe+0x36>
+}
+  800580:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800584:	c9                   	leave
+  800585:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800586:	49 89 c0             	mov    %rax,%r8
+  800589:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  80058e:	48 ba 88 2c 80 00 00 	movabs $0x802c88,%rdx
+  800595:	00 00 00 
+  800598:	be 26 00 00 00       	mov    $0x26,%esi
+  80059d:	48 bf a7 2c 80 00 00 	movabs $0x802ca7,%rdi
+  8005a4:	00 00 00 
+  8005a7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005ac:	49 b9 0d 1c 80 00 00 	movabs $0x801c0d,%r9
+  8005b3:	00 00 00 
+  8005b6:	41 ff d1             	call   *%r9
+
+00000000008005b9 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  8005b9:	55                   	push   %rbp
+  8005ba:	48 89 e5             	mov    %rsp,%rbp
+  8005bd:	53                   	push   %rbx
+  8005be:	48 83 ec 08          	sub    $0x8,%rsp
+  8005c2:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  8005c5:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8005c8:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8005cd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8005d2:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8005d7:	be 00 00 00 00       	mov    $0x0,%esi
+  8005dc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8005e2:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8005e4:	48 85 c0             	test   %rax,%rax
+  8005e7:	7f 06                	jg     8005ef <sys_env_set_pgfault_upcall+0x36>
+}
+  8005e9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8005ed:	c9                   	leave
+  8005ee:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8005ef:	49 89 c0             	mov    %rax,%r8
+  8005f2:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  8005f7:	48 ba 88 2c 80 00 00 	movabs $0x802c88,%rdx
+  8005fe:	00 00 00 
+  800601:	be 26 00 00 00       	mov    $0x26,%esi
+  800606:	48 bf a7 2c 80 00 00 	movabs $0x802ca7,%rdi
+  80060d:	00 00 00 
+  800610:	b8 00 00 00 00       	mov    $0x0,%eax
+  800615:	49 b9 0d 1c 80 00 00 	movabs $0x801c0d,%r9
+  80061c:	00 00 00 
+  80061f:	41 ff d1             	call   *%r9
+
+0000000000800622 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  800622:	55                   	push   %rbp
+  800623:	48 89 e5             	mov    %rsp,%rbp
+  800626:	53                   	push   %rbx
+  800627:	89 f8                	mov    %edi,%eax
+  800629:	49 89 f1             	mov    %rsi,%r9
+  80062c:	48 89 d3             	mov    %rdx,%rbx
+  80062f:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  800632:	49 63 f0             	movslq %r8d,%rsi
+  800635:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800638:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80063d:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800640:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800646:	cd 30                	int    $0x30
+}
+  800648:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80064c:	c9                   	leave
+  80064d:	c3                   	ret
+
+000000000080064e <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  80064e:	55                   	push   %rbp
+  80064f:	48 89 e5             	mov    %rsp,%rbp
+  800652:	53                   	push   %rbx
+  800653:	48 83 ec 08          	sub    $0x8,%rsp
+  800657:	48 89 fa             	mov    %rdi,%rdx
+  80065a:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80065d:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800662:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800667:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80066c:	be 00 00 00 00       	mov    $0x0,%esi
+  800671:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800677:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800679:	48 85 c0             	test   %rax,%rax
+  80067c:	7f 06                	jg     800684 <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  80067e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800682:	c9                   	leave
+  800683:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800684:	49 89 c0             	mov    %rax,%r8
+  800687:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  80068c:	48 ba 88 2c 80 00 00 	movabs $0x802c88,%rdx
+  800693:	00 00 00 
+  800696:	be 26 00 00 00       	mov    $0x26,%esi
+  80069b:	48 bf a7 2c 80 00 00 	movabs $0x802ca7,%rdi
+  8006a2:	00 00 00 
+  8006a5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006aa:	49 b9 0d 1c 80 00 00 	movabs $0x801c0d,%r9
+  8006b1:	00 00 00 
+  8006b4:	41 ff d1             	call   *%r9
+
+00000000008006b7 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8006b7:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8006be:	ff ff ff 
+  8006c1:	48 01 f8             	add    %rdi,%rax
+  8006c4:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  8006c8:	c3                   	ret
+
+00000000008006c9 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8006c9:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8006d0:	ff ff ff 
+  8006d3:	48 01 f8             	add    %rdi,%rax
+  8006d6:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  8006da:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  8006e0:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  8006e4:	c3                   	ret
+
+00000000008006e5 <fd_alloc_from>:
+}
+
+/* Like fd_alloc(), but only considers fds starting from fdnum,
+ * so that several fds can be found before their pages are allocated */
+int
+fd_alloc_from(int fdnum, struct Fd **fd_store) {
+  8006e5:	55                   	push   %rbp
+  8006e6:	48 89 e5             	mov    %rsp,%rbp
+  8006e9:	41 57                	push   %r15
+  8006eb:	41 56                	push   %r14
+  8006ed:	41 55                	push   %r13
+  8006ef:	41 54                	push   %r12
+  8006f1:	53                   	push   %rbx
+  8006f2:	48 83 ec 08          	sub    $0x8,%rsp
+  8006f6:	49 89 f7             	mov    %rsi,%r15
+    for (int i = MAX(fdnum, 0); i < MAXFD; i++) {
+  8006f9:	85 ff                	test   %edi,%edi
+  8006fb:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  800701:	44 0f 49 e7          	cmovns %edi,%r12d
+  800705:	83 ff 1f             	cmp    $0x1f,%edi
+  800708:	7f 37                	jg     800741 <fd_alloc_from+0x5c>
+  80070a:	49 63 dc             	movslq %r12d,%rbx
+  80070d:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  800714:	48 c1 e3 0c          	shl    $0xc,%rbx
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  800718:	49 be ee 17 80 00 00 	movabs $0x8017ee,%r14
+  80071f:	00 00 00 
+        struct Fd *fd = INDEX2FD(i);
+  800722:	49 89 dd             	mov    %rbx,%r13
+        if (!(get_prot(fd) & PROT_R)) {
+  800725:	48 89 df             	mov    %rbx,%rdi
+  800728:	41 ff d6             	call   *%r14
+  80072b:	83 e0 04             	and    $0x4,%eax
+  80072e:	74 1c                	je     80074c <fd_alloc_from+0x67>
+    for (int i = MAX(fdnum, 0); i < MAXFD; i++) {
+  800730:	41 83 c4 01          	add    $0x1,%r12d
+  800734:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  80073b:	41 83 fc 1f          	cmp    $0x1f,%r12d
+  80073f:	7e e1                	jle    800722 <fd_alloc_from+0x3d>
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  800741:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  800747:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  80074c:	4d 89 2f             	mov    %r13,(%r15)
+}
+  80074f:	48 83 c4 08          	add    $0x8,%rsp
+  800753:	5b                   	pop    %rbx
+  800754:	41 5c                	pop    %r12
+  800756:	41 5d                	pop    %r13
+  800758:	41 5e                	pop    %r14
+  80075a:	41 5f                	pop    %r15
+  80075c:	5d                   	pop    %rbp
+  80075d:	c3                   	ret
+
+000000000080075e <fd_alloc>:
+fd_alloc(struct Fd **fd_store) {
+  80075e:	55                   	push   %rbp
+  80075f:	48 89 e5             	mov    %rsp,%rbp
+  800762:	48 89 fe             	mov    %rdi,%rsi
+    return fd_alloc_from(0, fd_store);
+  800765:	bf 00 00 00 00       	mov    $0x0,%edi
+  80076a:	48 b8 e5 06 80 00 00 	movabs $0x8006e5,%rax
+  800771:	00 00 00 
+  800774:	ff d0                	call   *%rax
+}
+  800776:	5d                   	pop    %rbp
+  800777:	c3                   	ret
+
+0000000000800778 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  800778:	83 ff 1f             	cmp    $0x1f,%edi
+  80077b:	77 39                	ja     8007b6 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  80077d:	55                   	push   %rbp
+  80077e:	48 89 e5             	mov    %rsp,%rbp
+  800781:	41 54                	push   %r12
+  800783:	53                   	push   %rbx
+  800784:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  800787:	48 63 df             	movslq %edi,%rbx
+  80078a:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  800791:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  800795:	48 89 df             	mov    %rbx,%rdi
+  800798:	48 b8 ee 17 80 00 00 	movabs $0x8017ee,%rax
+  80079f:	00 00 00 
+  8007a2:	ff d0                	call   *%rax
+  8007a4:	a8 04                	test   $0x4,%al
+  8007a6:	74 14                	je     8007bc <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  8007a8:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  8007ac:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8007b1:	5b                   	pop    %rbx
+  8007b2:	41 5c                	pop    %r12
+  8007b4:	5d                   	pop    %rbp
+  8007b5:	c3                   	ret
+        return -E_INVAL;
+  8007b6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8007bb:	c3                   	ret
+        return -E_INVAL;
+  8007bc:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8007c1:	eb ee                	jmp    8007b1 <fd_lookup+0x39>
+
+00000000008007c3 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  8007c3:	55                   	push   %rbp
+  8007c4:	48 89 e5             	mov    %rsp,%rbp
+  8007c7:	41 54                	push   %r12
+  8007c9:	53                   	push   %rbx
+  8007ca:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  8007cd:	48 b8 40 2d 80 00 00 	movabs $0x802d40,%rax
+  8007d4:	00 00 00 
+  8007d7:	48 bb 20 40 80 00 00 	movabs $0x804020,%rbx
+  8007de:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  8007e1:	39 3b                	cmp    %edi,(%rbx)
+  8007e3:	74 47                	je     80082c <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  8007e5:	48 83 c0 08          	add    $0x8,%rax
+  8007e9:	48 8b 18             	mov    (%rax),%rbx
+  8007ec:	48 85 db             	test   %rbx,%rbx
+  8007ef:	75 f0                	jne    8007e1 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8007f1:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  8007f8:	00 00 00 
+  8007fb:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+  800801:	89 fa                	mov    %edi,%edx
+  800803:	48 bf b8 2c 80 00 00 	movabs $0x802cb8,%rdi
+  80080a:	00 00 00 
+  80080d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800812:	48 b9 5d 1d 80 00 00 	movabs $0x801d5d,%rcx
+  800819:	00 00 00 
+  80081c:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  80081e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  800823:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  800827:	5b                   	pop    %rbx
+  800828:	41 5c                	pop    %r12
+  80082a:	5d                   	pop    %rbp
+  80082b:	c3                   	ret
+            return 0;
+  80082c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800831:	eb f0                	jmp    800823 <dev_lookup+0x60>
+
+0000000000800833 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  800833:	55                   	push   %rbp
+  800834:	48 89 e5             	mov    %rsp,%rbp
+  800837:	41 55                	push   %r13
+  800839:	41 54                	push   %r12
+  80083b:	53                   	push   %rbx
+  80083c:	48 83 ec 18          	sub    $0x18,%rsp
+  800840:	48 89 fb             	mov    %rdi,%rbx
+  800843:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  800846:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  80084d:	ff ff ff 
+  800850:	48 01 df             	add    %rbx,%rdi
+  800853:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  800857:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80085b:	48 b8 78 07 80 00 00 	movabs $0x800778,%rax
+  800862:	00 00 00 
+  800865:	ff d0                	call   *%rax
+  800867:	41 89 c5             	mov    %eax,%r13d
+  80086a:	85 c0                	test   %eax,%eax
+  80086c:	78 06                	js     800874 <fd_close+0x41>
+  80086e:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  800872:	74 1a                	je     80088e <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  800874:	45 84 e4             	test   %r12b,%r12b
+  800877:	b8 00 00 00 00       	mov    $0x0,%eax
+  80087c:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  800880:	44 89 e8             	mov    %r13d,%eax
+  800883:	48 83 c4 18          	add    $0x18,%rsp
+  800887:	5b                   	pop    %rbx
+  800888:	41 5c                	pop    %r12
+  80088a:	41 5d                	pop    %r13
+  80088c:	5d                   	pop    %rbp
+  80088d:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  80088e:	8b 3b                	mov    (%rbx),%edi
+  800890:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800894:	48 b8 c3 07 80 00 00 	movabs $0x8007c3,%rax
+  80089b:	00 00 00 
+  80089e:	ff d0                	call   *%rax
+  8008a0:	41 89 c5             	mov    %eax,%r13d
+  8008a3:	85 c0                	test   %eax,%eax
+  8008a5:	78 1b                	js     8008c2 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  8008a7:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8008ab:	48 8b 40 20          	mov    0x20(%rax),%rax
+  8008af:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  8008b5:	48 85 c0             	test   %rax,%rax
+  8008b8:	74 08                	je     8008c2 <fd_close+0x8f>
+  8008ba:	48 89 df             	mov    %rbx,%rdi
+  8008bd:	ff d0                	call   *%rax
+  8008bf:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8008c2:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8008c7:	48 89 de             	mov    %rbx,%rsi
+  8008ca:	bf 00 00 00 00       	mov    $0x0,%edi
+  8008cf:	48 b8 48 03 80 00 00 	movabs $0x800348,%rax
+  8008d6:	00 00 00 
+  8008d9:	ff d0                	call   *%rax
+    return res;
+  8008db:	eb a3                	jmp    800880 <fd_close+0x4d>
+
+00000000008008dd <close>:
+
+int
+close(int fdnum) {
+  8008dd:	55                   	push   %rbp
+  8008de:	48 89 e5             	mov    %rsp,%rbp
+  8008e1:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  8008e5:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8008e9:	48 b8 78 07 80 00 00 	movabs $0x800778,%rax
+  8008f0:	00 00 00 
+  8008f3:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8008f5:	85 c0                	test   %eax,%eax
+  8008f7:	78 15                	js     80090e <close+0x31>
+
+    return fd_close(fd, 1);
+  8008f9:	be 01 00 00 00       	mov    $0x1,%esi
+  8008fe:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  800902:	48 b8 33 08 80 00 00 	movabs $0x800833,%rax
+  800909:	00 00 00 
+  80090c:	ff d0                	call   *%rax
+}
+  80090e:	c9                   	leave
+  80090f:	c3                   	ret
+
+0000000000800910 <close_all>:
+
+void
+close_all(void) {
+  800910:	55                   	push   %rbp
+  800911:	48 89 e5             	mov    %rsp,%rbp
+  800914:	41 54                	push   %r12
+  800916:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  800917:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80091c:	49 bc dd 08 80 00 00 	movabs $0x8008dd,%r12
+  800923:	00 00 00 
+  800926:	89 df                	mov    %ebx,%edi
+  800928:	41 ff d4             	call   *%r12
+  80092b:	83 c3 01             	add    $0x1,%ebx
+  80092e:	83 fb 20             	cmp    $0x20,%ebx
+  800931:	75 f3                	jne    800926 <close_all+0x16>
+}
+  800933:	5b                   	pop    %rbx
+  800934:	41 5c                	pop    %r12
+  800936:	5d                   	pop    %rbp
+  800937:	c3                   	ret
+
+0000000000800938 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  800938:	55                   	push   %rbp
+  800939:	48 89 e5             	mov    %rsp,%rbp
+  80093c:	41 57                	push   %r15
+  80093e:	41 56                	push   %r14
+  800940:	41 55                	push   %r13
+  800942:	41 54                	push   %r12
+  800944:	53                   	push   %rbx
+  800945:	48 83 ec 18          	sub    $0x18,%rsp
+  800949:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  80094c:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  800950:	48 b8 78 07 80 00 00 	movabs $0x800778,%rax
+  800957:	00 00 00 
+  80095a:	ff d0                	call   *%rax
+  80095c:	89 c3                	mov    %eax,%ebx
+  80095e:	85 c0                	test   %eax,%eax
+  800960:	0f 88 b8 00 00 00    	js     800a1e <dup+0xe6>
+    close(newfdnum);
+  800966:	44 89 e7             	mov    %r12d,%edi
+  800969:	48 b8 dd 08 80 00 00 	movabs $0x8008dd,%rax
+  800970:	00 00 00 
+  800973:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  800975:	4d 63 ec             	movslq %r12d,%r13
+  800978:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  80097f:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  800983:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  800987:	4c 89 ff             	mov    %r15,%rdi
+  80098a:	49 be c9 06 80 00 00 	movabs $0x8006c9,%r14
+  800991:	00 00 00 
+  800994:	41 ff d6             	call   *%r14
+  800997:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  80099a:	4c 89 ef             	mov    %r13,%rdi
+  80099d:	41 ff d6             	call   *%r14
+  8009a0:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  8009a3:	48 89 df             	mov    %rbx,%rdi
+  8009a6:	48 b8 ee 17 80 00 00 	movabs $0x8017ee,%rax
+  8009ad:	00 00 00 
+  8009b0:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  8009b2:	a8 04                	test   $0x4,%al
+  8009b4:	74 2b                	je     8009e1 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  8009b6:	41 89 c1             	mov    %eax,%r9d
+  8009b9:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8009bf:	4c 89 f1             	mov    %r14,%rcx
+  8009c2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8009c7:	48 89 de             	mov    %rbx,%rsi
+  8009ca:	bf 00 00 00 00       	mov    $0x0,%edi
+  8009cf:	48 b8 e3 02 80 00 00 	movabs $0x8002e3,%rax
+  8009d6:	00 00 00 
+  8009d9:	ff d0                	call   *%rax
+  8009db:	89 c3                	mov    %eax,%ebx
+  8009dd:	85 c0                	test   %eax,%eax
+  8009df:	78 4e                	js     800a2f <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  8009e1:	4c 89 ff             	mov    %r15,%rdi
+  8009e4:	48 b8 ee 17 80 00 00 	movabs $0x8017ee,%rax
+  8009eb:	00 00 00 
+  8009ee:	ff d0                	call   *%rax
+  8009f0:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  8009f3:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8009f9:	4c 89 e9             	mov    %r13,%rcx
+  8009fc:	ba 00 00 00 00       	mov    $0x0,%edx
+  800a01:	4c 89 fe             	mov    %r15,%rsi
+  800a04:	bf 00 00 00 00       	mov    $0x0,%edi
+  800a09:	48 b8 e3 02 80 00 00 	movabs $0x8002e3,%rax
+  800a10:	00 00 00 
+  800a13:	ff d0                	call   *%rax
+  800a15:	89 c3                	mov    %eax,%ebx
+  800a17:	85 c0                	test   %eax,%eax
+  800a19:	78 14                	js     800a2f <dup+0xf7>
+
+    return newfdnum;
+  800a1b:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  800a1e:	89 d8                	mov    %ebx,%eax
+  800a20:	48 83 c4 18          	add    $0x18,%rsp
+  800a24:	5b                   	pop    %rbx
+  800a25:	41 5c                	pop    %r12
+  800a27:	41 5d                	pop    %r13
+  800a29:	41 5e                	pop    %r14
+  800a2b:	41 5f                	pop    %r15
+  800a2d:	5d                   	pop    %rbp
+  800a2e:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  800a2f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800a34:	4c 89 ee             	mov    %r13,%rsi
+  800a37:	bf 00 00 00 00       	mov    $0x0,%edi
+  800a3c:	49 bc 48 03 80 00 00 	movabs $0x800348,%r12
+  800a43:	00 00 00 
+  800a46:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  800a49:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800a4e:	4c 89 f6             	mov    %r14,%rsi
+  800a51:	bf 00 00 00 00       	mov    $0x0,%edi
+  800a56:	41 ff d4             	call   *%r12
+    return res;
+  800a59:	eb c3                	jmp    800a1e <dup+0xe6>
+
+0000000000800a5b <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  800a5b:	55                   	push   %rbp
+  800a5c:	48 89 e5             	mov    %rsp,%rbp
+  800a5f:	41 56                	push   %r14
+  800a61:	41 55                	push   %r13
+  800a63:	41 54                	push   %r12
+  800a65:	53                   	push   %rbx
+  800a66:	48 83 ec 10          	sub    $0x10,%rsp
+  800a6a:	89 fb                	mov    %edi,%ebx
+  800a6c:	49 89 f4             	mov    %rsi,%r12
+  800a6f:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800a72:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800a76:	48 b8 78 07 80 00 00 	movabs $0x800778,%rax
+  800a7d:	00 00 00 
+  800a80:	ff d0                	call   *%rax
+  800a82:	85 c0                	test   %eax,%eax
+  800a84:	78 4c                	js     800ad2 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800a86:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  800a8a:	41 8b 3e             	mov    (%r14),%edi
+  800a8d:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800a91:	48 b8 c3 07 80 00 00 	movabs $0x8007c3,%rax
+  800a98:	00 00 00 
+  800a9b:	ff d0                	call   *%rax
+  800a9d:	85 c0                	test   %eax,%eax
+  800a9f:	78 35                	js     800ad6 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  800aa1:	41 8b 46 08          	mov    0x8(%r14),%eax
+  800aa5:	83 e0 03             	and    $0x3,%eax
+  800aa8:	83 f8 01             	cmp    $0x1,%eax
+  800aab:	74 2d                	je     800ada <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  800aad:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800ab1:	48 8b 40 10          	mov    0x10(%rax),%rax
+  800ab5:	48 85 c0             	test   %rax,%rax
+  800ab8:	74 56                	je     800b10 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  800aba:	4c 89 ea             	mov    %r13,%rdx
+  800abd:	4c 89 e6             	mov    %r12,%rsi
+  800ac0:	4c 89 f7             	mov    %r14,%rdi
+  800ac3:	ff d0                	call   *%rax
+}
+  800ac5:	48 83 c4 10          	add    $0x10,%rsp
+  800ac9:	5b                   	pop    %rbx
+  800aca:	41 5c                	pop    %r12
+  800acc:	41 5d                	pop    %r13
+  800ace:	41 5e                	pop    %r14
+  800ad0:	5d                   	pop    %rbp
+  800ad1:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800ad2:	48 98                	cltq
+  800ad4:	eb ef                	jmp    800ac5 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800ad6:	48 98                	cltq
+  800ad8:	eb eb                	jmp    800ac5 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  800ada:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  800ae1:	00 00 00 
+  800ae4:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+  800aea:	89 da                	mov    %ebx,%edx
+  800aec:	48 bf f9 2c 80 00 00 	movabs $0x802cf9,%rdi
+  800af3:	00 00 00 
+  800af6:	b8 00 00 00 00       	mov    $0x0,%eax
+  800afb:	48 b9 5d 1d 80 00 00 	movabs $0x801d5d,%rcx
+  800b02:	00 00 00 
+  800b05:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  800b07:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  800b0e:	eb b5                	jmp    800ac5 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  800b10:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  800b17:	eb ac                	jmp    800ac5 <read+0x6a>
+
+0000000000800b19 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  800b19:	55                   	push   %rbp
+  800b1a:	48 89 e5             	mov    %rsp,%rbp
+  800b1d:	41 57                	push   %r15
+  800b1f:	41 56                	push   %r14
+  800b21:	41 55                	push   %r13
+  800b23:	41 54                	push   %r12
+  800b25:	53                   	push   %rbx
+  800b26:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  800b2a:	48 85 d2             	test   %rdx,%rdx
+  800b2d:	74 54                	je     800b83 <readn+0x6a>
+  800b2f:	41 89 fd             	mov    %edi,%r13d
+  800b32:	49 89 f6             	mov    %rsi,%r14
+  800b35:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  800b38:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  800b3d:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  800b42:	49 bf 5b 0a 80 00 00 	movabs $0x800a5b,%r15
+  800b49:	00 00 00 
+  800b4c:	4c 89 e2             	mov    %r12,%rdx
+  800b4f:	48 29 f2             	sub    %rsi,%rdx
+  800b52:	4c 01 f6             	add    %r14,%rsi
+  800b55:	44 89 ef             	mov    %r13d,%edi
+  800b58:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  800b5b:	85 c0                	test   %eax,%eax
+  800b5d:	78 20                	js     800b7f <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  800b5f:	01 c3                	add    %eax,%ebx
+  800b61:	85 c0                	test   %eax,%eax
+  800b63:	74 08                	je     800b6d <readn+0x54>
+  800b65:	48 63 f3             	movslq %ebx,%rsi
+  800b68:	4c 39 e6             	cmp    %r12,%rsi
+  800b6b:	72 df                	jb     800b4c <readn+0x33>
+    }
+    return res;
+  800b6d:	48 63 c3             	movslq %ebx,%rax
+}
+  800b70:	48 83 c4 08          	add    $0x8,%rsp
+  800b74:	5b                   	pop    %rbx
+  800b75:	41 5c                	pop    %r12
+  800b77:	41 5d                	pop    %r13
+  800b79:	41 5e                	pop    %r14
+  800b7b:	41 5f                	pop    %r15
+  800b7d:	5d                   	pop    %rbp
+  800b7e:	c3                   	ret
+        if (inc < 0) return inc;
+  800b7f:	48 98                	cltq
+  800b81:	eb ed                	jmp    800b70 <readn+0x57>
+    int inc = 1, res = 0;
+  800b83:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800b88:	eb e3                	jmp    800b6d <readn+0x54>
+
+0000000000800b8a <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  800b8a:	55                   	push   %rbp
+  800b8b:	48 89 e5             	mov    %rsp,%rbp
+  800b8e:	41 56                	push   %r14
+  800b90:	41 55                	push   %r13
+  800b92:	41 54                	push   %r12
+  800b94:	53                   	push   %rbx
+  800b95:	48 83 ec 10          	sub    $0x10,%rsp
+  800b99:	89 fb                	mov    %edi,%ebx
+  800b9b:	49 89 f4             	mov    %rsi,%r12
+  800b9e:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800ba1:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800ba5:	48 b8 78 07 80 00 00 	movabs $0x800778,%rax
+  800bac:	00 00 00 
+  800baf:	ff d0                	call   *%rax
+  800bb1:	85 c0                	test   %eax,%eax
+  800bb3:	78 47                	js     800bfc <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800bb5:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  800bb9:	41 8b 3e             	mov    (%r14),%edi
+  800bbc:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800bc0:	48 b8 c3 07 80 00 00 	movabs $0x8007c3,%rax
+  800bc7:	00 00 00 
+  800bca:	ff d0                	call   *%rax
+  800bcc:	85 c0                	test   %eax,%eax
+  800bce:	78 30                	js     800c00 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800bd0:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  800bd5:	74 2d                	je     800c04 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  800bd7:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800bdb:	48 8b 40 18          	mov    0x18(%rax),%rax
+  800bdf:	48 85 c0             	test   %rax,%rax
+  800be2:	74 56                	je     800c3a <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  800be4:	4c 89 ea             	mov    %r13,%rdx
+  800be7:	4c 89 e6             	mov    %r12,%rsi
+  800bea:	4c 89 f7             	mov    %r14,%rdi
+  800bed:	ff d0                	call   *%rax
+}
+  800bef:	48 83 c4 10          	add    $0x10,%rsp
+  800bf3:	5b                   	pop    %rbx
+  800bf4:	41 5c                	pop    %r12
+  800bf6:	41 5d                	pop    %r13
+  800bf8:	41 5e                	pop    %r14
+  800bfa:	5d                   	pop    %rbp
+  800bfb:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800bfc:	48 98                	cltq
+  800bfe:	eb ef                	jmp    800bef <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800c00:	48 98                	cltq
+  800c02:	eb eb                	jmp    800bef <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  800c04:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  800c0b:	00 00 00 
+  800c0e:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+  800c14:	89 da                	mov    %ebx,%edx
+  800c16:	48 bf 15 2d 80 00 00 	movabs $0x802d15,%rdi
+  800c1d:	00 00 00 
+  800c20:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c25:	48 b9 5d 1d 80 00 00 	movabs $0x801d5d,%rcx
+  800c2c:	00 00 00 
+  800c2f:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  800c31:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  800c38:	eb b5                	jmp    800bef <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  800c3a:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  800c41:	eb ac                	jmp    800bef <write+0x65>
+
+0000000000800c43 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  800c43:	55                   	push   %rbp
+  800c44:	48 89 e5             	mov    %rsp,%rbp
+  800c47:	53                   	push   %rbx
+  800c48:	48 83 ec 18          	sub    $0x18,%rsp
+  800c4c:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800c4e:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800c52:	48 b8 78 07 80 00 00 	movabs $0x800778,%rax
+  800c59:	00 00 00 
+  800c5c:	ff d0                	call   *%rax
+  800c5e:	85 c0                	test   %eax,%eax
+  800c60:	78 0c                	js     800c6e <seek+0x2b>
+
+    fd->fd_offset = offset;
+  800c62:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800c66:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  800c69:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800c6e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800c72:	c9                   	leave
+  800c73:	c3                   	ret
+
+0000000000800c74 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  800c74:	55                   	push   %rbp
+  800c75:	48 89 e5             	mov    %rsp,%rbp
+  800c78:	41 55                	push   %r13
+  800c7a:	41 54                	push   %r12
+  800c7c:	53                   	push   %rbx
+  800c7d:	48 83 ec 18          	sub    $0x18,%rsp
+  800c81:	89 fb                	mov    %edi,%ebx
+  800c83:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800c86:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800c8a:	48 b8 78 07 80 00 00 	movabs $0x800778,%rax
+  800c91:	00 00 00 
+  800c94:	ff d0                	call   *%rax
+  800c96:	85 c0                	test   %eax,%eax
+  800c98:	78 38                	js     800cd2 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800c9a:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  800c9e:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  800ca2:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800ca6:	48 b8 c3 07 80 00 00 	movabs $0x8007c3,%rax
+  800cad:	00 00 00 
+  800cb0:	ff d0                	call   *%rax
+  800cb2:	85 c0                	test   %eax,%eax
+  800cb4:	78 1c                	js     800cd2 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800cb6:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  800cbb:	74 20                	je     800cdd <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  800cbd:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800cc1:	48 8b 40 30          	mov    0x30(%rax),%rax
+  800cc5:	48 85 c0             	test   %rax,%rax
+  800cc8:	74 47                	je     800d11 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  800cca:	44 89 e6             	mov    %r12d,%esi
+  800ccd:	4c 89 ef             	mov    %r13,%rdi
+  800cd0:	ff d0                	call   *%rax
+}
+  800cd2:	48 83 c4 18          	add    $0x18,%rsp
+  800cd6:	5b                   	pop    %rbx
+  800cd7:	41 5c                	pop    %r12
+  800cd9:	41 5d                	pop    %r13
+  800cdb:	5d                   	pop    %rbp
+  800cdc:	c3                   	ret
+                thisenv->env_id, fdnum);
+  800cdd:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  800ce4:	00 00 00 
+  800ce7:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  800ced:	89 da                	mov    %ebx,%edx
+  800cef:	48 bf d8 2c 80 00 00 	movabs $0x802cd8,%rdi
+  800cf6:	00 00 00 
+  800cf9:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cfe:	48 b9 5d 1d 80 00 00 	movabs $0x801d5d,%rcx
+  800d05:	00 00 00 
+  800d08:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  800d0a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800d0f:	eb c1                	jmp    800cd2 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  800d11:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  800d16:	eb ba                	jmp    800cd2 <ftruncate+0x5e>
+
+0000000000800d18 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  800d18:	55                   	push   %rbp
+  800d19:	48 89 e5             	mov    %rsp,%rbp
+  800d1c:	41 54                	push   %r12
+  800d1e:	53                   	push   %rbx
+  800d1f:	48 83 ec 10          	sub    $0x10,%rsp
+  800d23:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800d26:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800d2a:	48 b8 78 07 80 00 00 	movabs $0x800778,%rax
+  800d31:	00 00 00 
+  800d34:	ff d0                	call   *%rax
+  800d36:	85 c0                	test   %eax,%eax
+  800d38:	78 4e                	js     800d88 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800d3a:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  800d3e:	41 8b 3c 24          	mov    (%r12),%edi
+  800d42:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  800d46:	48 b8 c3 07 80 00 00 	movabs $0x8007c3,%rax
+  800d4d:	00 00 00 
+  800d50:	ff d0                	call   *%rax
+  800d52:	85 c0                	test   %eax,%eax
+  800d54:	78 32                	js     800d88 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  800d56:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800d5a:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  800d5f:	74 30                	je     800d91 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  800d61:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  800d64:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  800d6b:	00 00 00 
+    stat->st_isdir = 0;
+  800d6e:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  800d75:	00 00 00 
+    stat->st_dev = dev;
+  800d78:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  800d7f:	48 89 de             	mov    %rbx,%rsi
+  800d82:	4c 89 e7             	mov    %r12,%rdi
+  800d85:	ff 50 28             	call   *0x28(%rax)
+}
+  800d88:	48 83 c4 10          	add    $0x10,%rsp
+  800d8c:	5b                   	pop    %rbx
+  800d8d:	41 5c                	pop    %r12
+  800d8f:	5d                   	pop    %rbp
+  800d90:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  800d91:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  800d96:	eb f0                	jmp    800d88 <fstat+0x70>
+
+0000000000800d98 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  800d98:	55                   	push   %rbp
+  800d99:	48 89 e5             	mov    %rsp,%rbp
+  800d9c:	41 54                	push   %r12
+  800d9e:	53                   	push   %rbx
+  800d9f:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  800da2:	be 00 00 00 00       	mov    $0x0,%esi
+  800da7:	48 b8 7b 11 80 00 00 	movabs $0x80117b,%rax
+  800dae:	00 00 00 
+  800db1:	ff d0                	call   *%rax
+  800db3:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  800db5:	85 c0                	test   %eax,%eax
+  800db7:	78 25                	js     800dde <stat+0x46>
+
+    int res = fstat(fd, stat);
+  800db9:	4c 89 e6             	mov    %r12,%rsi
+  800dbc:	89 c7                	mov    %eax,%edi
+  800dbe:	48 b8 18 0d 80 00 00 	movabs $0x800d18,%rax
+  800dc5:	00 00 00 
+  800dc8:	ff d0                	call   *%rax
+  800dca:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  800dcd:	89 df                	mov    %ebx,%edi
+  800dcf:	48 b8 dd 08 80 00 00 	movabs $0x8008dd,%rax
+  800dd6:	00 00 00 
+  800dd9:	ff d0                	call   *%rax
+
+    return res;
+  800ddb:	44 89 e3             	mov    %r12d,%ebx
+}
+  800dde:	89 d8                	mov    %ebx,%eax
+  800de0:	5b                   	pop    %rbx
+  800de1:	41 5c                	pop    %r12
+  800de3:	5d                   	pop    %rbp
+  800de4:	c3                   	ret
+
+0000000000800de5 <fsipc>:
+ * response may be written back to fsipcbuf.
+ * type: request code, passed as the simple integer IPC value.
+ * dstva: virtual address at which to receive reply page, 0 if none.
+ * Returns result from the file server. */
+static int
+fsipc(unsigned type, void *dstva) {
+  800de5:	55                   	push   %rbp
+  800de6:	48 89 e5             	mov    %rsp,%rbp
+  800de9:	41 54                	push   %r12
+  800deb:	53                   	push   %rbx
+  800dec:	48 83 ec 10          	sub    $0x10,%rsp
+  800df0:	41 89 fc             	mov    %edi,%r12d
+  800df3:	48 89 f3             	mov    %rsi,%rbx
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  800df6:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  800dfd:	00 00 00 
+  800e00:	83 38 00             	cmpl   $0x0,(%rax)
+  800e03:	74 5e                	je     800e63 <fsipc+0x7e>
+    if (debug) {
+        cprintf("[%08x] fsipc %d %08x\n",
+                thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+    }
+
+    ipc_send(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW);
+  800e05:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  800e0b:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  800e10:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  800e17:	00 00 00 
+  800e1a:	44 89 e6             	mov    %r12d,%esi
+  800e1d:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  800e24:	00 00 00 
+  800e27:	8b 38                	mov    (%rax),%edi
+  800e29:	48 b8 7e 2b 80 00 00 	movabs $0x802b7e,%rax
+  800e30:	00 00 00 
+  800e33:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  800e35:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  800e3c:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  800e3d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e42:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  800e46:	48 89 de             	mov    %rbx,%rsi
+  800e49:	bf 00 00 00 00       	mov    $0x0,%edi
+  800e4e:	48 b8 a9 2a 80 00 00 	movabs $0x802aa9,%rax
+  800e55:	00 00 00 
+  800e58:	ff d0                	call   *%rax
+}
+  800e5a:	48 83 c4 10          	add    $0x10,%rsp
+  800e5e:	5b                   	pop    %rbx
+  800e5f:	41 5c                	pop    %r12
+  800e61:	5d                   	pop    %rbp
+  800e62:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  800e63:	bf 03 00 00 00       	mov    $0x3,%edi
+  800e68:	48 b8 21 2c 80 00 00 	movabs $0x802c21,%rax
+  800e6f:	00 00 00 
+  800e72:	ff d0                	call   *%rax
+  800e74:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  800e7b:	00 00 
+  800e7d:	eb 86                	jmp    800e05 <fsipc+0x20>
+
+0000000000800e7f <devfile_trunc>:
+    return 0;
+}
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  800e7f:	55                   	push   %rbp
+  800e80:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  800e83:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  800e8a:	00 00 00 
+  800e8d:	8b 57 0c             	mov    0xc(%rdi),%edx
+  800e90:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  800e92:	89 70 04             	mov    %esi,0x4(%rax)
+
+    return fsipc(FSREQ_SET_SIZE, NULL);
+  800e95:	be 00 00 00 00       	mov    $0x0,%esi
+  800e9a:	bf 02 00 00 00       	mov    $0x2,%edi
+  800e9f:	48 b8 e5 0d 80 00 00 	movabs $0x800de5,%rax
+  800ea6:	00 00 00 
+  800ea9:	ff d0                	call   *%rax
+}
+  800eab:	5d                   	pop    %rbp
+  800eac:	c3                   	ret
+
+0000000000800ead <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  800ead:	55                   	push   %rbp
+  800eae:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  800eb1:	8b 47 0c             	mov    0xc(%rdi),%eax
+  800eb4:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  800ebb:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  800ebd:	be 00 00 00 00       	mov    $0x0,%esi
+  800ec2:	bf 06 00 00 00       	mov    $0x6,%edi
+  800ec7:	48 b8 e5 0d 80 00 00 	movabs $0x800de5,%rax
+  800ece:	00 00 00 
+  800ed1:	ff d0                	call   *%rax
+}
+  800ed3:	5d                   	pop    %rbp
+  800ed4:	c3                   	ret
+
+0000000000800ed5 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  800ed5:	55                   	push   %rbp
+  800ed6:	48 89 e5             	mov    %rsp,%rbp
+  800ed9:	41 54                	push   %r12
+  800edb:	53                   	push   %rbx
+  800edc:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  800edf:	8b 47 0c             	mov    0xc(%rdi),%eax
+  800ee2:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  800ee9:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  800eeb:	be 00 00 00 00       	mov    $0x0,%esi
+  800ef0:	bf 05 00 00 00       	mov    $0x5,%edi
+  800ef5:	48 b8 e5 0d 80 00 00 	movabs $0x800de5,%rax
+  800efc:	00 00 00 
+  800eff:	ff d0                	call   *%rax
+    if (res < 0) {
+  800f01:	85 c0                	test   %eax,%eax
+  800f03:	78 3d                	js     800f42 <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  800f05:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  800f0c:	00 00 00 
+  800f0f:	4c 89 e6             	mov    %r12,%rsi
+  800f12:	48 89 df             	mov    %rbx,%rdi
+  800f15:	48 b8 82 26 80 00 00 	movabs $0x802682,%rax
+  800f1c:	00 00 00 
+  800f1f:	ff d0                	call   *%rax
+    st->st_size  = fsipcbuf.statRet.ret_size;
+  800f21:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  800f28:	00 
+  800f29:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  800f2f:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  800f36:	00 
+  800f37:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  800f3d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800f42:	5b                   	pop    %rbx
+  800f43:	41 5c                	pop    %r12
+  800f45:	5d                   	pop    %rbp
+  800f46:	c3                   	ret
+
+0000000000800f47 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  800f47:	55                   	push   %rbp
+  800f48:	48 89 e5             	mov    %rsp,%rbp
+  800f4b:	41 57                	push   %r15
+  800f4d:	41 56                	push   %r14
+  800f4f:	41 55                	push   %r13
+  800f51:	41 54                	push   %r12
+  800f53:	53                   	push   %rbx
+  800f54:	48 83 ec 18          	sub    $0x18,%rsp
+  800f58:	49 89 fe             	mov    %rdi,%r14
+  800f5b:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+  800f5f:	48 89 d3             	mov    %rdx,%rbx
+    while (n > sizeof(fsipcbuf.write.req_buf))
+  800f62:	48 81 fa f0 0f 00 00 	cmp    $0xff0,%rdx
+  800f69:	0f 86 e4 00 00 00    	jbe    801053 <devfile_write+0x10c>
+  800f6f:	49 89 f4             	mov    %rsi,%r12
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  800f72:	49 bd 00 60 80 00 00 	movabs $0x806000,%r13
+  800f79:	00 00 00 
+        memcpy(fsipcbuf.write.req_buf, buf, sizeof(fsipcbuf.write.req_buf));
+  800f7c:	49 bf e3 28 80 00 00 	movabs $0x8028e3,%r15
+  800f83:	00 00 00 
+  800f86:	eb 03                	jmp    800f8b <devfile_write+0x44>
+        buf += sizeof(fsipcbuf.write.req_buf);
+  800f88:	49 89 f4             	mov    %rsi,%r12
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  800f8b:	41 8b 46 0c          	mov    0xc(%r14),%eax
+  800f8f:	41 89 45 00          	mov    %eax,0x0(%r13)
+        fsipcbuf.write.req_n      = sizeof(fsipcbuf.write.req_buf);
+  800f93:	49 c7 45 08 f0 0f 00 	movq   $0xff0,0x8(%r13)
+  800f9a:	00 
+        memcpy(fsipcbuf.write.req_buf, buf, sizeof(fsipcbuf.write.req_buf));
+  800f9b:	ba f0 0f 00 00       	mov    $0xff0,%edx
+  800fa0:	4c 89 e6             	mov    %r12,%rsi
+  800fa3:	48 bf 10 60 80 00 00 	movabs $0x806010,%rdi
+  800faa:	00 00 00 
+  800fad:	41 ff d7             	call   *%r15
+        ssize_t res = fsipc(FSREQ_WRITE, NULL);
+  800fb0:	be 00 00 00 00       	mov    $0x0,%esi
+  800fb5:	bf 04 00 00 00       	mov    $0x4,%edi
+  800fba:	48 b8 e5 0d 80 00 00 	movabs $0x800de5,%rax
+  800fc1:	00 00 00 
+  800fc4:	ff d0                	call   *%rax
+  800fc6:	48 63 d0             	movslq %eax,%rdx
+        if (res < 0 || res < sizeof(fsipcbuf.write.req_buf))
+  800fc9:	3d ef 0f 00 00       	cmp    $0xfef,%eax
+  800fce:	7e 71                	jle    801041 <devfile_write+0xfa>
+        buf += sizeof(fsipcbuf.write.req_buf);
+  800fd0:	49 8d b4 24 f0 0f 00 	lea    0xff0(%r12),%rsi
+  800fd7:	00 
+        n -= sizeof(fsipcbuf.write.req_buf);
+  800fd8:	48 81 eb f0 0f 00 00 	sub    $0xff0,%rbx
+    while (n > sizeof(fsipcbuf.write.req_buf))
+  800fdf:	48 81 fb f0 0f 00 00 	cmp    $0xff0,%rbx
+  800fe6:	77 a0                	ja     800f88 <devfile_write+0x41>
+        written += sizeof(fsipcbuf.write.req_buf);
+  800fe8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800fec:	49 29 c4             	sub    %rax,%r12
+  800fef:	4d 8d a4 24 f0 0f 00 	lea    0xff0(%r12),%r12
+  800ff6:	00 
+    fsipcbuf.write.req_fileid = fd->fd_file.id;
+  800ff7:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  800ffe:	00 00 00 
+  801001:	41 8b 56 0c          	mov    0xc(%r14),%edx
+  801005:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.write.req_n      = n;
+  801007:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    memcpy(fsipcbuf.write.req_buf, buf, n);
+  80100b:	48 89 da             	mov    %rbx,%rdx
+  80100e:	48 8d 78 10          	lea    0x10(%rax),%rdi
+  801012:	48 b8 e3 28 80 00 00 	movabs $0x8028e3,%rax
+  801019:	00 00 00 
+  80101c:	ff d0                	call   *%rax
+    ssize_t res = fsipc(FSREQ_WRITE, NULL);
+  80101e:	be 00 00 00 00       	mov    $0x0,%esi
+  801023:	bf 04 00 00 00       	mov    $0x4,%edi
+  801028:	48 b8 e5 0d 80 00 00 	movabs $0x800de5,%rax
+  80102f:	00 00 00 
+  801032:	ff d0                	call   *%rax
+  801034:	48 63 d0             	movslq %eax,%rdx
+    written += res;
+  801037:	49 01 d4             	add    %rdx,%r12
+  80103a:	48 85 d2             	test   %rdx,%rdx
+  80103d:	49 0f 49 d4          	cmovns %r12,%rdx
+}
+  801041:	48 89 d0             	mov    %rdx,%rax
+  801044:	48 83 c4 18          	add    $0x18,%rsp
+  801048:	5b                   	pop    %rbx
+  801049:	41 5c                	pop    %r12
+  80104b:	41 5d                	pop    %r13
+  80104d:	41 5e                	pop    %r14
+  80104f:	41 5f                	pop    %r15
+  801051:	5d                   	pop    %rbp
+  801052:	c3                   	ret
+    while (n > sizeof(fsipcbuf.write.req_buf))
+  801053:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+    ssize_t written = 0;
+  801057:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80105d:	eb 98                	jmp    800ff7 <devfile_write+0xb0>
+
+000000000080105f <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  80105f:	55                   	push   %rbp
+  801060:	48 89 e5             	mov    %rsp,%rbp
+  801063:	41 57                	push   %r15
+  801065:	41 56                	push   %r14
+  801067:	41 55                	push   %r13
+  801069:	41 54                	push   %r12
+  80106b:	53                   	push   %rbx
+  80106c:	48 83 ec 18          	sub    $0x18,%rsp
+  801070:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  801074:	49 89 f6             	mov    %rsi,%r14
+  801077:	49 89 d4             	mov    %rdx,%r12
+    while (n > sizeof(fsipcbuf.readRet.ret_buf))
+  80107a:	48 81 fa 00 10 00 00 	cmp    $0x1000,%rdx
+  801081:	0f 86 ea 00 00 00    	jbe    801171 <devfile_read+0x112>
+    ssize_t readsz = 0;
+  801087:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  80108e:	00 
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  80108f:	49 bf 00 60 80 00 00 	movabs $0x806000,%r15
+  801096:	00 00 00 
+  801099:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80109d:	8b 40 0c             	mov    0xc(%rax),%eax
+  8010a0:	41 89 07             	mov    %eax,(%r15)
+        fsipcbuf.read.req_n = sizeof(fsipcbuf.readRet.ret_buf);
+  8010a3:	49 c7 47 08 00 10 00 	movq   $0x1000,0x8(%r15)
+  8010aa:	00 
+        ssize_t res = fsipc(FSREQ_READ, NULL);
+  8010ab:	be 00 00 00 00       	mov    $0x0,%esi
+  8010b0:	bf 03 00 00 00       	mov    $0x3,%edi
+  8010b5:	48 b8 e5 0d 80 00 00 	movabs $0x800de5,%rax
+  8010bc:	00 00 00 
+  8010bf:	ff d0                	call   *%rax
+  8010c1:	4c 63 e8             	movslq %eax,%r13
+        if (res < 0)
+  8010c4:	4d 85 ed             	test   %r13,%r13
+  8010c7:	0f 88 92 00 00 00    	js     80115f <devfile_read+0x100>
+        memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  8010cd:	4c 89 ea             	mov    %r13,%rdx
+  8010d0:	4c 89 fe             	mov    %r15,%rsi
+  8010d3:	4c 89 f7             	mov    %r14,%rdi
+  8010d6:	48 b8 e3 28 80 00 00 	movabs $0x8028e3,%rax
+  8010dd:	00 00 00 
+  8010e0:	ff d0                	call   *%rax
+        if (res < sizeof(fsipcbuf.readRet.ret_buf))
+  8010e2:	49 81 fd ff 0f 00 00 	cmp    $0xfff,%r13
+  8010e9:	76 6d                	jbe    801158 <devfile_read+0xf9>
+        readsz += res;
+  8010eb:	4c 01 6d c0          	add    %r13,-0x40(%rbp)
+        buf += res;
+  8010ef:	4d 01 ee             	add    %r13,%r14
+        n -= res;
+  8010f2:	4d 29 ec             	sub    %r13,%r12
+    while (n > sizeof(fsipcbuf.readRet.ret_buf))
+  8010f5:	49 81 fc 00 10 00 00 	cmp    $0x1000,%r12
+  8010fc:	77 9b                	ja     801099 <devfile_read+0x3a>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8010fe:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  801105:	00 00 00 
+  801108:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  80110c:	8b 51 0c             	mov    0xc(%rcx),%edx
+  80110f:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.read.req_n = n;
+  801111:	4c 89 60 08          	mov    %r12,0x8(%rax)
+    ssize_t res = fsipc(FSREQ_READ, NULL);
+  801115:	be 00 00 00 00       	mov    $0x0,%esi
+  80111a:	bf 03 00 00 00       	mov    $0x3,%edi
+  80111f:	48 b8 e5 0d 80 00 00 	movabs $0x800de5,%rax
+  801126:	00 00 00 
+  801129:	ff d0                	call   *%rax
+  80112b:	4c 63 e8             	movslq %eax,%r13
+    if (res < 0)
+  80112e:	4d 85 ed             	test   %r13,%r13
+  801131:	78 2c                	js     80115f <devfile_read+0x100>
+    memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  801133:	4c 89 ea             	mov    %r13,%rdx
+  801136:	48 be 00 60 80 00 00 	movabs $0x806000,%rsi
+  80113d:	00 00 00 
+  801140:	4c 89 f7             	mov    %r14,%rdi
+  801143:	48 b8 e3 28 80 00 00 	movabs $0x8028e3,%rax
+  80114a:	00 00 00 
+  80114d:	ff d0                	call   *%rax
+    readsz += res;
+  80114f:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  801153:	49 01 c5             	add    %rax,%r13
+    return readsz;
+  801156:	eb 07                	jmp    80115f <devfile_read+0x100>
+            return readsz + res;
+  801158:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80115c:	49 01 c5             	add    %rax,%r13
+}
+  80115f:	4c 89 e8             	mov    %r13,%rax
+  801162:	48 83 c4 18          	add    $0x18,%rsp
+  801166:	5b                   	pop    %rbx
+  801167:	41 5c                	pop    %r12
+  801169:	41 5d                	pop    %r13
+  80116b:	41 5e                	pop    %r14
+  80116d:	41 5f                	pop    %r15
+  80116f:	5d                   	pop    %rbp
+  801170:	c3                   	ret
+    ssize_t readsz = 0;
+  801171:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  801178:	00 
+  801179:	eb 83                	jmp    8010fe <devfile_read+0x9f>
+
+000000000080117b <open>:
+open(const char *path, int mode) {
+  80117b:	55                   	push   %rbp
+  80117c:	48 89 e5             	mov    %rsp,%rbp
+  80117f:	41 55                	push   %r13
+  801181:	41 54                	push   %r12
+  801183:	53                   	push   %rbx
+  801184:	48 83 ec 18          	sub    $0x18,%rsp
+  801188:	49 89 fc             	mov    %rdi,%r12
+  80118b:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  80118e:	48 b8 44 26 80 00 00 	movabs $0x802644,%rax
+  801195:	00 00 00 
+  801198:	ff d0                	call   *%rax
+  80119a:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  8011a0:	0f 87 8a 00 00 00    	ja     801230 <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8011a6:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  8011aa:	48 b8 5e 07 80 00 00 	movabs $0x80075e,%rax
+  8011b1:	00 00 00 
+  8011b4:	ff d0                	call   *%rax
+  8011b6:	89 c3                	mov    %eax,%ebx
+  8011b8:	85 c0                	test   %eax,%eax
+  8011ba:	78 50                	js     80120c <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  8011bc:	4c 89 e6             	mov    %r12,%rsi
+  8011bf:	48 bb 00 60 80 00 00 	movabs $0x806000,%rbx
+  8011c6:	00 00 00 
+  8011c9:	48 89 df             	mov    %rbx,%rdi
+  8011cc:	48 b8 82 26 80 00 00 	movabs $0x802682,%rax
+  8011d3:	00 00 00 
+  8011d6:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  8011d8:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  8011df:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8011e3:	bf 01 00 00 00       	mov    $0x1,%edi
+  8011e8:	48 b8 e5 0d 80 00 00 	movabs $0x800de5,%rax
+  8011ef:	00 00 00 
+  8011f2:	ff d0                	call   *%rax
+  8011f4:	89 c3                	mov    %eax,%ebx
+  8011f6:	85 c0                	test   %eax,%eax
+  8011f8:	78 1f                	js     801219 <open+0x9e>
+    return fd2num(fd);
+  8011fa:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8011fe:	48 b8 b7 06 80 00 00 	movabs $0x8006b7,%rax
+  801205:	00 00 00 
+  801208:	ff d0                	call   *%rax
+  80120a:	89 c3                	mov    %eax,%ebx
+}
+  80120c:	89 d8                	mov    %ebx,%eax
+  80120e:	48 83 c4 18          	add    $0x18,%rsp
+  801212:	5b                   	pop    %rbx
+  801213:	41 5c                	pop    %r12
+  801215:	41 5d                	pop    %r13
+  801217:	5d                   	pop    %rbp
+  801218:	c3                   	ret
+        fd_close(fd, 0);
+  801219:	be 00 00 00 00       	mov    $0x0,%esi
+  80121e:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  801222:	48 b8 33 08 80 00 00 	movabs $0x800833,%rax
+  801229:	00 00 00 
+  80122c:	ff d0                	call   *%rax
+        return res;
+  80122e:	eb dc                	jmp    80120c <open+0x91>
+        return -E_BAD_PATH;
+  801230:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  801235:	eb d5                	jmp    80120c <open+0x91>
+
+0000000000801237 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  801237:	55                   	push   %rbp
+  801238:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc(FSREQ_SYNC, NULL);
+  80123b:	be 00 00 00 00       	mov    $0x0,%esi
+  801240:	bf 08 00 00 00       	mov    $0x8,%edi
+  801245:	48 b8 e5 0d 80 00 00 	movabs $0x800de5,%rax
+  80124c:	00 00 00 
+  80124f:	ff d0                	call   *%rax
+}
+  801251:	5d                   	pop    %rbp
+  801252:	c3                   	ret
+
+0000000000801253 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  801253:	55                   	push   %rbp
+  801254:	48 89 e5             	mov    %rsp,%rbp
+  801257:	41 54                	push   %r12
+  801259:	53                   	push   %rbx
+  80125a:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80125d:	48 b8 c9 06 80 00 00 	movabs $0x8006c9,%rax
+  801264:	00 00 00 
+  801267:	ff d0                	call   *%rax
+  801269:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  80126c:	48 be 60 2d 80 00 00 	movabs $0x802d60,%rsi
+  801273:	00 00 00 
+  801276:	48 89 df             	mov    %rbx,%rdi
+  801279:	48 b8 82 26 80 00 00 	movabs $0x802682,%rax
+  801280:	00 00 00 
+  801283:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  801285:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  80128a:	41 2b 04 24          	sub    (%r12),%eax
+  80128e:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  801294:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  80129b:	00 00 00 
+    stat->st_dev = &devpipe;
+  80129e:	48 b8 60 40 80 00 00 	movabs $0x804060,%rax
+  8012a5:	00 00 00 
+  8012a8:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  8012af:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012b4:	5b                   	pop    %rbx
+  8012b5:	41 5c                	pop    %r12
+  8012b7:	5d                   	pop    %rbp
+  8012b8:	c3                   	ret
+
+00000000008012b9 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  8012b9:	55                   	push   %rbp
+  8012ba:	48 89 e5             	mov    %rsp,%rbp
+  8012bd:	41 54                	push   %r12
+  8012bf:	53                   	push   %rbx
+  8012c0:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8012c3:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8012c8:	48 89 fe             	mov    %rdi,%rsi
+  8012cb:	bf 00 00 00 00       	mov    $0x0,%edi
+  8012d0:	49 bc 48 03 80 00 00 	movabs $0x800348,%r12
+  8012d7:	00 00 00 
+  8012da:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  8012dd:	48 89 df             	mov    %rbx,%rdi
+  8012e0:	48 b8 c9 06 80 00 00 	movabs $0x8006c9,%rax
+  8012e7:	00 00 00 
+  8012ea:	ff d0                	call   *%rax
+  8012ec:	48 89 c6             	mov    %rax,%rsi
+  8012ef:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8012f4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8012f9:	41 ff d4             	call   *%r12
+}
+  8012fc:	5b                   	pop    %rbx
+  8012fd:	41 5c                	pop    %r12
+  8012ff:	5d                   	pop    %rbp
+  801300:	c3                   	ret
+
+0000000000801301 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  801301:	55                   	push   %rbp
+  801302:	48 89 e5             	mov    %rsp,%rbp
+  801305:	41 57                	push   %r15
+  801307:	41 56                	push   %r14
+  801309:	41 55                	push   %r13
+  80130b:	41 54                	push   %r12
+  80130d:	53                   	push   %rbx
+  80130e:	48 83 ec 18          	sub    $0x18,%rsp
+  801312:	49 89 fc             	mov    %rdi,%r12
+  801315:	49 89 f5             	mov    %rsi,%r13
+  801318:	49 89 d7             	mov    %rdx,%r15
+  80131b:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80131f:	48 b8 c9 06 80 00 00 	movabs $0x8006c9,%rax
+  801326:	00 00 00 
+  801329:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  80132b:	4d 85 ff             	test   %r15,%r15
+  80132e:	0f 84 af 00 00 00    	je     8013e3 <devpipe_write+0xe2>
+  801334:	48 89 c3             	mov    %rax,%rbx
+  801337:	4c 89 f8             	mov    %r15,%rax
+  80133a:	4d 89 ef             	mov    %r13,%r15
+  80133d:	4c 01 e8             	add    %r13,%rax
+  801340:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  801344:	49 bd 50 02 80 00 00 	movabs $0x800250,%r13
+  80134b:	00 00 00 
+            sys_yield();
+  80134e:	49 be ed 01 80 00 00 	movabs $0x8001ed,%r14
+  801355:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  801358:	8b 73 04             	mov    0x4(%rbx),%esi
+  80135b:	48 63 ce             	movslq %esi,%rcx
+  80135e:	48 63 03             	movslq (%rbx),%rax
+  801361:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  801367:	48 39 c1             	cmp    %rax,%rcx
+  80136a:	72 2e                	jb     80139a <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80136c:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  801371:	48 89 da             	mov    %rbx,%rdx
+  801374:	be 00 10 00 00       	mov    $0x1000,%esi
+  801379:	4c 89 e7             	mov    %r12,%rdi
+  80137c:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  80137f:	85 c0                	test   %eax,%eax
+  801381:	74 66                	je     8013e9 <devpipe_write+0xe8>
+            sys_yield();
+  801383:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  801386:	8b 73 04             	mov    0x4(%rbx),%esi
+  801389:	48 63 ce             	movslq %esi,%rcx
+  80138c:	48 63 03             	movslq (%rbx),%rax
+  80138f:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  801395:	48 39 c1             	cmp    %rax,%rcx
+  801398:	73 d2                	jae    80136c <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  80139a:	41 0f b6 3f          	movzbl (%r15),%edi
+  80139e:	48 89 ca             	mov    %rcx,%rdx
+  8013a1:	48 c1 ea 03          	shr    $0x3,%rdx
+  8013a5:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  8013ac:	08 10 20 
+  8013af:	48 f7 e2             	mul    %rdx
+  8013b2:	48 c1 ea 06          	shr    $0x6,%rdx
+  8013b6:	48 89 d0             	mov    %rdx,%rax
+  8013b9:	48 c1 e0 09          	shl    $0x9,%rax
+  8013bd:	48 29 d0             	sub    %rdx,%rax
+  8013c0:	48 c1 e0 03          	shl    $0x3,%rax
+  8013c4:	48 29 c1             	sub    %rax,%rcx
+  8013c7:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  8013cc:	83 c6 01             	add    $0x1,%esi
+  8013cf:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8013d2:	49 83 c7 01          	add    $0x1,%r15
+  8013d6:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8013da:	49 39 c7             	cmp    %rax,%r15
+  8013dd:	0f 85 75 ff ff ff    	jne    801358 <devpipe_write+0x57>
+    return n;
+  8013e3:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8013e7:	eb 05                	jmp    8013ee <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  8013e9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8013ee:	48 83 c4 18          	add    $0x18,%rsp
+  8013f2:	5b                   	pop    %rbx
+  8013f3:	41 5c                	pop    %r12
+  8013f5:	41 5d                	pop    %r13
+  8013f7:	41 5e                	pop    %r14
+  8013f9:	41 5f                	pop    %r15
+  8013fb:	5d                   	pop    %rbp
+  8013fc:	c3                   	ret
+
+00000000008013fd <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  8013fd:	55                   	push   %rbp
+  8013fe:	48 89 e5             	mov    %rsp,%rbp
+  801401:	41 57                	push   %r15
+  801403:	41 56                	push   %r14
+  801405:	41 55                	push   %r13
+  801407:	41 54                	push   %r12
+  801409:	53                   	push   %rbx
+  80140a:	48 83 ec 18          	sub    $0x18,%rsp
+  80140e:	49 89 fc             	mov    %rdi,%r12
+  801411:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  801415:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  801419:	48 b8 c9 06 80 00 00 	movabs $0x8006c9,%rax
+  801420:	00 00 00 
+  801423:	ff d0                	call   *%rax
+  801425:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  801428:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80142e:	49 bd 50 02 80 00 00 	movabs $0x800250,%r13
+  801435:	00 00 00 
+            sys_yield();
+  801438:	49 be ed 01 80 00 00 	movabs $0x8001ed,%r14
+  80143f:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  801442:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  801447:	74 7d                	je     8014c6 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  801449:	8b 03                	mov    (%rbx),%eax
+  80144b:	3b 43 04             	cmp    0x4(%rbx),%eax
+  80144e:	75 26                	jne    801476 <devpipe_read+0x79>
+            if (i > 0) return i;
+  801450:	4d 85 ff             	test   %r15,%r15
+  801453:	75 77                	jne    8014cc <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  801455:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80145a:	48 89 da             	mov    %rbx,%rdx
+  80145d:	be 00 10 00 00       	mov    $0x1000,%esi
+  801462:	4c 89 e7             	mov    %r12,%rdi
+  801465:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  801468:	85 c0                	test   %eax,%eax
+  80146a:	74 72                	je     8014de <devpipe_read+0xe1>
+            sys_yield();
+  80146c:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  80146f:	8b 03                	mov    (%rbx),%eax
+  801471:	3b 43 04             	cmp    0x4(%rbx),%eax
+  801474:	74 df                	je     801455 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  801476:	48 63 c8             	movslq %eax,%rcx
+  801479:	48 89 ca             	mov    %rcx,%rdx
+  80147c:	48 c1 ea 03          	shr    $0x3,%rdx
+  801480:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  801487:	08 10 20 
+  80148a:	48 89 d0             	mov    %rdx,%rax
+  80148d:	48 f7 e6             	mul    %rsi
+  801490:	48 c1 ea 06          	shr    $0x6,%rdx
+  801494:	48 89 d0             	mov    %rdx,%rax
+  801497:	48 c1 e0 09          	shl    $0x9,%rax
+  80149b:	48 29 d0             	sub    %rdx,%rax
+  80149e:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  8014a5:	00 
+  8014a6:	48 89 c8             	mov    %rcx,%rax
+  8014a9:	48 29 d0             	sub    %rdx,%rax
+  8014ac:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  8014b1:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8014b5:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  8014b9:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8014bc:	49 83 c7 01          	add    $0x1,%r15
+  8014c0:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  8014c4:	75 83                	jne    801449 <devpipe_read+0x4c>
+    return n;
+  8014c6:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8014ca:	eb 03                	jmp    8014cf <devpipe_read+0xd2>
+            if (i > 0) return i;
+  8014cc:	4c 89 f8             	mov    %r15,%rax
+}
+  8014cf:	48 83 c4 18          	add    $0x18,%rsp
+  8014d3:	5b                   	pop    %rbx
+  8014d4:	41 5c                	pop    %r12
+  8014d6:	41 5d                	pop    %r13
+  8014d8:	41 5e                	pop    %r14
+  8014da:	41 5f                	pop    %r15
+  8014dc:	5d                   	pop    %rbp
+  8014dd:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  8014de:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014e3:	eb ea                	jmp    8014cf <devpipe_read+0xd2>
+
+00000000008014e5 <pipe>:
+pipe(int pfd[2]) {
+  8014e5:	55                   	push   %rbp
+  8014e6:	48 89 e5             	mov    %rsp,%rbp
+  8014e9:	41 55                	push   %r13
+  8014eb:	41 54                	push   %r12
+  8014ed:	53                   	push   %rbx
+  8014ee:	48 81 ec b8 00 00 00 	sub    $0xb8,%rsp
+  8014f5:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8014f8:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  8014fc:	48 b8 5e 07 80 00 00 	movabs $0x80075e,%rax
+  801503:	00 00 00 
+  801506:	ff d0                	call   *%rax
+  801508:	89 c3                	mov    %eax,%ebx
+  80150a:	85 c0                	test   %eax,%eax
+  80150c:	0f 88 51 01 00 00    	js     801663 <pipe+0x17e>
+        (res = fd_alloc_from(fd2num(fd0) + 1, &fd1)) < 0) goto err;
+  801512:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  801516:	48 b8 b7 06 80 00 00 	movabs $0x8006b7,%rax
+  80151d:	00 00 00 
+  801520:	ff d0                	call   *%rax
+  801522:	8d 78 01             	lea    0x1(%rax),%edi
+  801525:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801529:	48 b8 e5 06 80 00 00 	movabs $0x8006e5,%rax
+  801530:	00 00 00 
+  801533:	ff d0                	call   *%rax
+  801535:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  801537:	85 c0                	test   %eax,%eax
+  801539:	0f 88 24 01 00 00    	js     801663 <pipe+0x17e>
+    va = fd2data(fd0);
+  80153f:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  801543:	48 bb c9 06 80 00 00 	movabs $0x8006c9,%rbx
+  80154a:	00 00 00 
+  80154d:	ff d3                	call   *%rbx
+  80154f:	49 89 c5             	mov    %rax,%r13
+    struct RegionOp ops[] = {
+  801552:	48 8d bd 30 ff ff ff 	lea    -0xd0(%rbp),%rdi
+  801559:	b9 14 00 00 00       	mov    $0x14,%ecx
+  80155e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801563:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+  801566:	c7 85 34 ff ff ff 46 	movl   $0x46,-0xcc(%rbp)
+  80156d:	00 00 00 
+  801570:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801574:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+  80157b:	48 c7 85 50 ff ff ff 	movq   $0x1000,-0xb0(%rbp)
+  801582:	00 10 00 00 
+  801586:	c7 85 5c ff ff ff 46 	movl   $0x46,-0xa4(%rbp)
+  80158d:	00 00 00 
+            {.type = REGION_ALLOC, .dstva = (uintptr_t)fd1, .size = PAGE_SIZE, .perm = PROT_RW | PROT_SHARE},
+  801590:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+    struct RegionOp ops[] = {
+  801594:	48 89 bd 70 ff ff ff 	mov    %rdi,-0x90(%rbp)
+  80159b:	48 c7 85 78 ff ff ff 	movq   $0x1000,-0x88(%rbp)
+  8015a2:	00 10 00 00 
+  8015a6:	c7 45 84 46 00 00 00 	movl   $0x46,-0x7c(%rbp)
+  8015ad:	4c 89 6d 98          	mov    %r13,-0x68(%rbp)
+  8015b1:	48 c7 45 a0 00 10 00 	movq   $0x1000,-0x60(%rbp)
+  8015b8:	00 
+  8015b9:	c7 45 a8 01 00 00 00 	movl   $0x1,-0x58(%rbp)
+  8015c0:	c7 45 ac 46 00 00 00 	movl   $0x46,-0x54(%rbp)
+  8015c7:	4c 89 6d b8          	mov    %r13,-0x48(%rbp)
+            {.type = REGION_MAP, .srcva = (uintptr_t)va, .dstva = (uintptr_t)fd2data(fd1), .size = PAGE_SIZE, .perm = PROT_RW | PROT_SHARE},
+  8015cb:	ff d3                	call   *%rbx
+    struct RegionOp ops[] = {
+  8015cd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8015d1:	48 c7 45 c8 00 10 00 	movq   $0x1000,-0x38(%rbp)
+  8015d8:	00 
+    if ((res = sys_region_batch(ops, sizeof ops / sizeof *ops)) < 0) goto err1;
+  8015d9:	be 04 00 00 00       	mov    $0x4,%esi
+  8015de:	48 8d bd 30 ff ff ff 	lea    -0xd0(%rbp),%rdi
+  8015e5:	48 b8 af 03 80 00 00 	movabs $0x8003af,%rax
+  8015ec:	00 00 00 
+  8015ef:	ff d0                	call   *%rax
+  8015f1:	89 c3                	mov    %eax,%ebx
+  8015f3:	85 c0                	test   %eax,%eax
+  8015f5:	0f 88 ad 00 00 00    	js     8016a8 <pipe+0x1c3>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8015fb:	be 00 10 00 00       	mov    $0x1000,%esi
+  801600:	4c 89 ef             	mov    %r13,%rdi
+  801603:	48 b8 1e 02 80 00 00 	movabs $0x80021e,%rax
+  80160a:	00 00 00 
+  80160d:	ff d0                	call   *%rax
+  80160f:	83 f8 02             	cmp    $0x2,%eax
+  801612:	75 5f                	jne    801673 <pipe+0x18e>
+    fd0->fd_dev_id = devpipe.dev_id;
+  801614:	a1 60 40 80 00 00 00 	movabs 0x804060,%eax
+  80161b:	00 00 
+  80161d:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801621:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  801623:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801627:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  80162e:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  801632:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  801634:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801638:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  80163f:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  801643:	48 bb b7 06 80 00 00 	movabs $0x8006b7,%rbx
+  80164a:	00 00 00 
+  80164d:	ff d3                	call   *%rbx
+  80164f:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  801653:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  801657:	ff d3                	call   *%rbx
+  801659:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  80165e:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  801663:	89 d8                	mov    %ebx,%eax
+  801665:	48 81 c4 b8 00 00 00 	add    $0xb8,%rsp
+  80166c:	5b                   	pop    %rbx
+  80166d:	41 5c                	pop    %r12
+  80166f:	41 5d                	pop    %r13
+  801671:	5d                   	pop    %rbp
+  801672:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  801673:	48 b9 90 2d 80 00 00 	movabs $0x802d90,%rcx
+  80167a:	00 00 00 
+  80167d:	48 ba 67 2d 80 00 00 	movabs $0x802d67,%rdx
+  801684:	00 00 00 
+  801687:	be 33 00 00 00       	mov    $0x33,%esi
+  80168c:	48 bf 7c 2d 80 00 00 	movabs $0x802d7c,%rdi
+  801693:	00 00 00 
+  801696:	b8 00 00 00 00       	mov    $0x0,%eax
+  80169b:	49 b8 0d 1c 80 00 00 	movabs $0x801c0d,%r8
+  8016a2:	00 00 00 
+  8016a5:	41 ff d0             	call   *%r8
+        ops[i].type = REGION_UNMAP;
+  8016a8:	c7 85 30 ff ff ff 02 	movl   $0x2,-0xd0(%rbp)
+  8016af:	00 00 00 
+  8016b2:	c7 85 58 ff ff ff 02 	movl   $0x2,-0xa8(%rbp)
+  8016b9:	00 00 00 
+  8016bc:	c7 45 80 02 00 00 00 	movl   $0x2,-0x80(%rbp)
+  8016c3:	c7 45 a8 02 00 00 00 	movl   $0x2,-0x58(%rbp)
+    sys_region_batch(ops, sizeof ops / sizeof *ops);
+  8016ca:	be 04 00 00 00       	mov    $0x4,%esi
+  8016cf:	48 8d bd 30 ff ff ff 	lea    -0xd0(%rbp),%rdi
+  8016d6:	48 b8 af 03 80 00 00 	movabs $0x8003af,%rax
+  8016dd:	00 00 00 
+  8016e0:	ff d0                	call   *%rax
+  8016e2:	e9 7c ff ff ff       	jmp    801663 <pipe+0x17e>
+
+00000000008016e7 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  8016e7:	55                   	push   %rbp
+  8016e8:	48 89 e5             	mov    %rsp,%rbp
+  8016eb:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8016ef:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8016f3:	48 b8 78 07 80 00 00 	movabs $0x800778,%rax
+  8016fa:	00 00 00 
+  8016fd:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8016ff:	85 c0                	test   %eax,%eax
+  801701:	78 35                	js     801738 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  801703:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801707:	48 b8 c9 06 80 00 00 	movabs $0x8006c9,%rax
+  80170e:	00 00 00 
+  801711:	ff d0                	call   *%rax
+  801713:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  801716:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80171b:	be 00 10 00 00       	mov    $0x1000,%esi
+  801720:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801724:	48 b8 50 02 80 00 00 	movabs $0x800250,%rax
+  80172b:	00 00 00 
+  80172e:	ff d0                	call   *%rax
+  801730:	85 c0                	test   %eax,%eax
+  801732:	0f 94 c0             	sete   %al
+  801735:	0f b6 c0             	movzbl %al,%eax
+}
+  801738:	c9                   	leave
+  801739:	c3                   	ret
+
+000000000080173a <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  80173a:	48 89 f8             	mov    %rdi,%rax
+  80173d:	48 c1 e8 27          	shr    $0x27,%rax
+  801741:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  801748:	01 00 00 
+  80174b:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80174f:	f6 c2 01             	test   $0x1,%dl
+  801752:	74 6d                	je     8017c1 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  801754:	48 89 f8             	mov    %rdi,%rax
+  801757:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80175b:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  801762:	01 00 00 
+  801765:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  801769:	f6 c2 01             	test   $0x1,%dl
+  80176c:	74 62                	je     8017d0 <get_uvpt_entry+0x96>
+  80176e:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  801775:	01 00 00 
+  801778:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80177c:	f6 c2 80             	test   $0x80,%dl
+  80177f:	75 4f                	jne    8017d0 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  801781:	48 89 f8             	mov    %rdi,%rax
+  801784:	48 c1 e8 15          	shr    $0x15,%rax
+  801788:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  80178f:	01 00 00 
+  801792:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  801796:	f6 c2 01             	test   $0x1,%dl
+  801799:	74 44                	je     8017df <get_uvpt_entry+0xa5>
+  80179b:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8017a2:	01 00 00 
+  8017a5:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8017a9:	f6 c2 80             	test   $0x80,%dl
+  8017ac:	75 31                	jne    8017df <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  8017ae:	48 c1 ef 0c          	shr    $0xc,%rdi
+  8017b2:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8017b9:	01 00 00 
+  8017bc:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  8017c0:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8017c1:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  8017c8:	01 00 00 
+  8017cb:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8017cf:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8017d0:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8017d7:	01 00 00 
+  8017da:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8017de:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8017df:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8017e6:	01 00 00 
+  8017e9:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8017ed:	c3                   	ret
+
+00000000008017ee <get_prot>:
+
+int
+get_prot(void *va) {
+  8017ee:	55                   	push   %rbp
+  8017ef:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8017f2:	48 b8 3a 17 80 00 00 	movabs $0x80173a,%rax
+  8017f9:	00 00 00 
+  8017fc:	ff d0                	call   *%rax
+  8017fe:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  801801:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  801806:	89 c1                	mov    %eax,%ecx
+  801808:	83 c9 04             	or     $0x4,%ecx
+  80180b:	f6 c2 01             	test   $0x1,%dl
+  80180e:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  801811:	89 c1                	mov    %eax,%ecx
+  801813:	83 c9 02             	or     $0x2,%ecx
+  801816:	f6 c2 02             	test   $0x2,%dl
+  801819:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  80181c:	89 c1                	mov    %eax,%ecx
+  80181e:	83 c9 01             	or     $0x1,%ecx
+  801821:	48 85 d2             	test   %rdx,%rdx
+  801824:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  801827:	89 c1                	mov    %eax,%ecx
+  801829:	83 c9 40             	or     $0x40,%ecx
+  80182c:	f6 c6 04             	test   $0x4,%dh
+  80182f:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  801832:	5d                   	pop    %rbp
+  801833:	c3                   	ret
+
+0000000000801834 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  801834:	55                   	push   %rbp
+  801835:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  801838:	48 b8 3a 17 80 00 00 	movabs $0x80173a,%rax
+  80183f:	00 00 00 
+  801842:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  801844:	48 c1 e8 06          	shr    $0x6,%rax
+  801848:	83 e0 01             	and    $0x1,%eax
+}
+  80184b:	5d                   	pop    %rbp
+  80184c:	c3                   	ret
+
+000000000080184d <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  80184d:	55                   	push   %rbp
+  80184e:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  801851:	48 b8 3a 17 80 00 00 	movabs $0x80173a,%rax
+  801858:	00 00 00 
+  80185b:	ff d0                	call   *%rax
+  80185d:	83 e0 01             	and    $0x1,%eax
+}
+  801860:	5d                   	pop    %rbp
+  801861:	c3                   	ret
+
+0000000000801862 <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  801862:	55                   	push   %rbp
+  801863:	48 89 e5             	mov    %rsp,%rbp
+  801866:	41 57                	push   %r15
+  801868:	41 56                	push   %r14
+  80186a:	41 55                	push   %r13
+  80186c:	41 54                	push   %r12
+  80186e:	53                   	push   %rbx
+  80186f:	48 83 ec 38          	sub    $0x38,%rsp
+  801873:	49 89 f7             	mov    %rsi,%r15
+  801876:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+                    }
+                    continue;
+                }
+                for (int ptei = 0; ptei < PT_ENTRY_COUNT; ptei++) {
+                    uintptr_t pte_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, pdei, ptei, 0);
+                    pte_t pte = uvpt[VPT(pte_addr)];
+  80187c:	49 bd 00 00 00 00 00 	movabs $0x10000000000,%r13
+  801883:	01 00 00 
+  801886:	4d 89 e6             	mov    %r12,%r14
+  801889:	49 89 fc             	mov    %rdi,%r12
+  80188c:	e9 19 01 00 00       	jmp    8019aa <foreach_shared_region+0x148>
+  801891:	48 89 5d b0          	mov    %rbx,-0x50(%rbp)
+  801895:	4c 89 75 a8          	mov    %r14,-0x58(%rbp)
+  801899:	eb 52                	jmp    8018ed <foreach_shared_region+0x8b>
+                for (int ptei = 0; ptei < PT_ENTRY_COUNT; ptei++) {
+  80189b:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8018a2:	48 81 fb 00 00 20 00 	cmp    $0x200000,%rbx
+  8018a9:	74 2e                	je     8018d9 <foreach_shared_region+0x77>
+                    uintptr_t pte_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, pdei, ptei, 0);
+  8018ab:	48 89 df             	mov    %rbx,%rdi
+  8018ae:	4c 09 f7             	or     %r14,%rdi
+                    pte_t pte = uvpt[VPT(pte_addr)];
+  8018b1:	48 89 f8             	mov    %rdi,%rax
+  8018b4:	48 c1 e8 0c          	shr    $0xc,%rax
+  8018b8:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+                    if ((pte & PTE_P) && (pte & PTE_SHARE)) {
+  8018bd:	25 01 04 00 00       	and    $0x401,%eax
+  8018c2:	48 3d 01 04 00 00    	cmp    $0x401,%rax
+  8018c8:	75 d1                	jne    80189b <foreach_shared_region+0x39>
+                        fun((void*)pte_addr, (void*)(pte_addr + PAGE_SIZE), arg);
+  8018ca:	48 8d b7 00 10 00 00 	lea    0x1000(%rdi),%rsi
+  8018d1:	4c 89 fa             	mov    %r15,%rdx
+  8018d4:	41 ff d4             	call   *%r12
+  8018d7:	eb c2                	jmp    80189b <foreach_shared_region+0x39>
+            for (int pdei = 0; pdei < PD_ENTRY_COUNT; pdei++) {
+  8018d9:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  8018e0:	00 
+  8018e1:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8018e5:	48 3d 00 00 00 40    	cmp    $0x40000000,%rax
+  8018eb:	74 46                	je     801933 <foreach_shared_region+0xd1>
+                uintptr_t pde_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, pdei, 0, 0);
+  8018ed:	4c 8b 75 c8          	mov    -0x38(%rbp),%r14
+  8018f1:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8018f5:	49 09 c6             	or     %rax,%r14
+                pde_t pde = uvpd[VPD(pde_addr)];
+  8018f8:	4c 89 f0             	mov    %r14,%rax
+  8018fb:	48 c1 e8 15          	shr    $0x15,%rax
+  8018ff:	48 b9 00 00 00 80 00 	movabs $0x10080000000,%rcx
+  801906:	01 00 00 
+  801909:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+                if (!(pde & PTE_P)) {
+  80190d:	a8 01                	test   $0x1,%al
+  80190f:	74 c8                	je     8018d9 <foreach_shared_region+0x77>
+                if (pde & PTE_PS) {
+  801911:	48 89 c3             	mov    %rax,%rbx
+  801914:	81 e3 80 00 00 00    	and    $0x80,%ebx
+  80191a:	74 8f                	je     8018ab <foreach_shared_region+0x49>
+                    if (pde & PTE_SHARE) {
+  80191c:	f6 c4 04             	test   $0x4,%ah
+  80191f:	74 b8                	je     8018d9 <foreach_shared_region+0x77>
+                        fun((void*)pde_addr, (void*)(pde_addr + 1024 * 1024 * 2), arg);
+  801921:	49 8d b6 00 00 20 00 	lea    0x200000(%r14),%rsi
+  801928:	4c 89 fa             	mov    %r15,%rdx
+  80192b:	4c 89 f7             	mov    %r14,%rdi
+  80192e:	41 ff d4             	call   *%r12
+  801931:	eb a6                	jmp    8018d9 <foreach_shared_region+0x77>
+  801933:	48 8b 5d b0          	mov    -0x50(%rbp),%rbx
+  801937:	4c 8b 75 a8          	mov    -0x58(%rbp),%r14
+        for (int pdpei = 0; pdpei < PDP_ENTRY_COUNT; pdpei++) {
+  80193b:	48 81 c3 00 00 00 40 	add    $0x40000000,%rbx
+  801942:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  801949:	00 00 00 
+  80194c:	48 39 c3             	cmp    %rax,%rbx
+  80194f:	74 4c                	je     80199d <foreach_shared_region+0x13b>
+            uintptr_t pdpe_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, 0, 0, 0);
+  801951:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  801955:	48 09 d8             	or     %rbx,%rax
+  801958:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+            pdpe_t pdpe = uvpdp[VPDP(pdpe_addr)];
+  80195c:	48 c1 e8 1e          	shr    $0x1e,%rax
+  801960:	48 b9 00 00 40 80 00 	movabs $0x10080400000,%rcx
+  801967:	01 00 00 
+  80196a:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+            if (!(pdpe & PTE_P)) {
+  80196e:	a8 01                	test   $0x1,%al
+  801970:	74 c9                	je     80193b <foreach_shared_region+0xd9>
+            if (pdpe & PTE_PS) {
+  801972:	48 89 c1             	mov    %rax,%rcx
+  801975:	81 e1 80 00 00 00    	and    $0x80,%ecx
+  80197b:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  80197f:	0f 84 0c ff ff ff    	je     801891 <foreach_shared_region+0x2f>
+                if (pdpe & PTE_SHARE) {
+  801985:	f6 c4 04             	test   $0x4,%ah
+  801988:	74 b1                	je     80193b <foreach_shared_region+0xd9>
+                    fun((void*)pdpe_addr, (void*)(pdpe_addr + 1024 * 1024 * 1024), arg); 
+  80198a:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  80198e:	48 8d b7 00 00 00 40 	lea    0x40000000(%rdi),%rsi
+  801995:	4c 89 fa             	mov    %r15,%rdx
+  801998:	41 ff d4             	call   *%r12
+  80199b:	eb 9e                	jmp    80193b <foreach_shared_region+0xd9>
+    for (int pml4ei = 0; pml4ei < PML4_ENTRY_COUNT; pml4ei++) {
+  80199d:	49 83 c6 01          	add    $0x1,%r14
+  8019a1:	49 81 fe 00 02 00 00 	cmp    $0x200,%r14
+  8019a8:	74 24                	je     8019ce <foreach_shared_region+0x16c>
+        pml4e_t pml4e = uvpml4[VPML4(pml4_addr)];
+  8019aa:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  8019b1:	01 00 00 
+  8019b4:	4a 8b 04 f0          	mov    (%rax,%r14,8),%rax
+        if (!(pml4e & PTE_P)) {
+  8019b8:	a8 01                	test   $0x1,%al
+  8019ba:	74 e1                	je     80199d <foreach_shared_region+0x13b>
+  8019bc:	4c 89 f0             	mov    %r14,%rax
+  8019bf:	48 c1 e0 27          	shl    $0x27,%rax
+  8019c3:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8019c7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8019cc:	eb 83                	jmp    801951 <foreach_shared_region+0xef>
+            }
+        }
+    }
+    
+    return 0;
+}
+  8019ce:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019d3:	48 83 c4 38          	add    $0x38,%rsp
+  8019d7:	5b                   	pop    %rbx
+  8019d8:	41 5c                	pop    %r12
+  8019da:	41 5d                	pop    %r13
+  8019dc:	41 5e                	pop    %r14
+  8019de:	41 5f                	pop    %r15
+  8019e0:	5d                   	pop    %rbp
+  8019e1:	c3                   	ret
+
+00000000008019e2 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  8019e2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019e7:	c3                   	ret
+
+00000000008019e8 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  8019e8:	55                   	push   %rbp
+  8019e9:	48 89 e5             	mov    %rsp,%rbp
+  8019ec:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  8019ef:	48 be b4 2d 80 00 00 	movabs $0x802db4,%rsi
+  8019f6:	00 00 00 
+  8019f9:	48 b8 82 26 80 00 00 	movabs $0x802682,%rax
+  801a00:	00 00 00 
+  801a03:	ff d0                	call   *%rax
+    return 0;
+}
+  801a05:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a0a:	5d                   	pop    %rbp
+  801a0b:	c3                   	ret
+
+0000000000801a0c <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  801a0c:	55                   	push   %rbp
+  801a0d:	48 89 e5             	mov    %rsp,%rbp
+  801a10:	41 57                	push   %r15
+  801a12:	41 56                	push   %r14
+  801a14:	41 55                	push   %r13
+  801a16:	41 54                	push   %r12
+  801a18:	53                   	push   %rbx
+  801a19:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  801a20:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  801a27:	48 85 d2             	test   %rdx,%rdx
+  801a2a:	74 7a                	je     801aa6 <devcons_write+0x9a>
+  801a2c:	49 89 d6             	mov    %rdx,%r14
+  801a2f:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  801a35:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  801a3a:	49 bf 7c 28 80 00 00 	movabs $0x80287c,%r15
+  801a41:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  801a44:	4c 89 f3             	mov    %r14,%rbx
+  801a47:	48 29 f3             	sub    %rsi,%rbx
+  801a4a:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  801a4f:	48 39 c3             	cmp    %rax,%rbx
+  801a52:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  801a56:	4c 63 eb             	movslq %ebx,%r13
+  801a59:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  801a60:	48 01 c6             	add    %rax,%rsi
+  801a63:	4c 89 ea             	mov    %r13,%rdx
+  801a66:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  801a6d:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  801a70:	4c 89 ee             	mov    %r13,%rsi
+  801a73:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  801a7a:	48 b8 f3 00 80 00 00 	movabs $0x8000f3,%rax
+  801a81:	00 00 00 
+  801a84:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  801a86:	41 01 dc             	add    %ebx,%r12d
+  801a89:	49 63 f4             	movslq %r12d,%rsi
+  801a8c:	4c 39 f6             	cmp    %r14,%rsi
+  801a8f:	72 b3                	jb     801a44 <devcons_write+0x38>
+    return res;
+  801a91:	49 63 c4             	movslq %r12d,%rax
+}
+  801a94:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  801a9b:	5b                   	pop    %rbx
+  801a9c:	41 5c                	pop    %r12
+  801a9e:	41 5d                	pop    %r13
+  801aa0:	41 5e                	pop    %r14
+  801aa2:	41 5f                	pop    %r15
+  801aa4:	5d                   	pop    %rbp
+  801aa5:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  801aa6:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  801aac:	eb e3                	jmp    801a91 <devcons_write+0x85>
+
+0000000000801aae <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  801aae:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  801ab1:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ab6:	48 85 c0             	test   %rax,%rax
+  801ab9:	74 55                	je     801b10 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  801abb:	55                   	push   %rbp
+  801abc:	48 89 e5             	mov    %rsp,%rbp
+  801abf:	41 55                	push   %r13
+  801ac1:	41 54                	push   %r12
+  801ac3:	53                   	push   %rbx
+  801ac4:	48 83 ec 08          	sub    $0x8,%rsp
+  801ac8:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  801acb:	48 bb 20 01 80 00 00 	movabs $0x800120,%rbx
+  801ad2:	00 00 00 
+  801ad5:	49 bc ed 01 80 00 00 	movabs $0x8001ed,%r12
+  801adc:	00 00 00 
+  801adf:	eb 03                	jmp    801ae4 <devcons_read+0x36>
+  801ae1:	41 ff d4             	call   *%r12
+  801ae4:	ff d3                	call   *%rbx
+  801ae6:	85 c0                	test   %eax,%eax
+  801ae8:	74 f7                	je     801ae1 <devcons_read+0x33>
+    if (c < 0) return c;
+  801aea:	48 63 d0             	movslq %eax,%rdx
+  801aed:	78 13                	js     801b02 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  801aef:	ba 00 00 00 00       	mov    $0x0,%edx
+  801af4:	83 f8 04             	cmp    $0x4,%eax
+  801af7:	74 09                	je     801b02 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  801af9:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  801afd:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  801b02:	48 89 d0             	mov    %rdx,%rax
+  801b05:	48 83 c4 08          	add    $0x8,%rsp
+  801b09:	5b                   	pop    %rbx
+  801b0a:	41 5c                	pop    %r12
+  801b0c:	41 5d                	pop    %r13
+  801b0e:	5d                   	pop    %rbp
+  801b0f:	c3                   	ret
+  801b10:	48 89 d0             	mov    %rdx,%rax
+  801b13:	c3                   	ret
+
+0000000000801b14 <cputchar>:
+cputchar(int ch) {
+  801b14:	55                   	push   %rbp
+  801b15:	48 89 e5             	mov    %rsp,%rbp
+  801b18:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  801b1c:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  801b20:	be 01 00 00 00       	mov    $0x1,%esi
+  801b25:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  801b29:	48 b8 f3 00 80 00 00 	movabs $0x8000f3,%rax
+  801b30:	00 00 00 
+  801b33:	ff d0                	call   *%rax
+}
+  801b35:	c9                   	leave
+  801b36:	c3                   	ret
+
+0000000000801b37 <getchar>:
+getchar(void) {
+  801b37:	55                   	push   %rbp
+  801b38:	48 89 e5             	mov    %rsp,%rbp
+  801b3b:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  801b3f:	ba 01 00 00 00       	mov    $0x1,%edx
+  801b44:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  801b48:	bf 00 00 00 00       	mov    $0x0,%edi
+  801b4d:	48 b8 5b 0a 80 00 00 	movabs $0x800a5b,%rax
+  801b54:	00 00 00 
+  801b57:	ff d0                	call   *%rax
+  801b59:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  801b5b:	85 c0                	test   %eax,%eax
+  801b5d:	78 06                	js     801b65 <getchar+0x2e>
+  801b5f:	74 08                	je     801b69 <getchar+0x32>
+  801b61:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  801b65:	89 d0                	mov    %edx,%eax
+  801b67:	c9                   	leave
+  801b68:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  801b69:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  801b6e:	eb f5                	jmp    801b65 <getchar+0x2e>
+
+0000000000801b70 <iscons>:
+iscons(int fdnum) {
+  801b70:	55                   	push   %rbp
+  801b71:	48 89 e5             	mov    %rsp,%rbp
+  801b74:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  801b78:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801b7c:	48 b8 78 07 80 00 00 	movabs $0x800778,%rax
+  801b83:	00 00 00 
+  801b86:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801b88:	85 c0                	test   %eax,%eax
+  801b8a:	78 18                	js     801ba4 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  801b8c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801b90:	48 b8 a0 40 80 00 00 	movabs $0x8040a0,%rax
+  801b97:	00 00 00 
+  801b9a:	8b 00                	mov    (%rax),%eax
+  801b9c:	39 02                	cmp    %eax,(%rdx)
+  801b9e:	0f 94 c0             	sete   %al
+  801ba1:	0f b6 c0             	movzbl %al,%eax
+}
+  801ba4:	c9                   	leave
+  801ba5:	c3                   	ret
+
+0000000000801ba6 <opencons>:
+opencons(void) {
+  801ba6:	55                   	push   %rbp
+  801ba7:	48 89 e5             	mov    %rsp,%rbp
+  801baa:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  801bae:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  801bb2:	48 b8 5e 07 80 00 00 	movabs $0x80075e,%rax
+  801bb9:	00 00 00 
+  801bbc:	ff d0                	call   *%rax
+  801bbe:	85 c0                	test   %eax,%eax
+  801bc0:	78 49                	js     801c0b <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  801bc2:	b9 46 00 00 00       	mov    $0x46,%ecx
+  801bc7:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801bcc:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  801bd0:	bf 00 00 00 00       	mov    $0x0,%edi
+  801bd5:	48 b8 7c 02 80 00 00 	movabs $0x80027c,%rax
+  801bdc:	00 00 00 
+  801bdf:	ff d0                	call   *%rax
+  801be1:	85 c0                	test   %eax,%eax
+  801be3:	78 26                	js     801c0b <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  801be5:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801be9:	a1 a0 40 80 00 00 00 	movabs 0x8040a0,%eax
+  801bf0:	00 00 
+  801bf2:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  801bf4:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801bf8:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  801bff:	48 b8 b7 06 80 00 00 	movabs $0x8006b7,%rax
+  801c06:	00 00 00 
+  801c09:	ff d0                	call   *%rax
+}
+  801c0b:	c9                   	leave
+  801c0c:	c3                   	ret
+
+0000000000801c0d <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  801c0d:	55                   	push   %rbp
+  801c0e:	48 89 e5             	mov    %rsp,%rbp
+  801c11:	41 56                	push   %r14
+  801c13:	41 55                	push   %r13
+  801c15:	41 54                	push   %r12
+  801c17:	53                   	push   %rbx
+  801c18:	48 83 ec 50          	sub    $0x50,%rsp
+  801c1c:	49 89 fc             	mov    %rdi,%r12
+  801c1f:	41 89 f5             	mov    %esi,%r13d
+  801c22:	48 89 d3             	mov    %rdx,%rbx
+  801c25:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  801c29:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  801c2d:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  801c31:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  801c38:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801c3c:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  801c40:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  801c44:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  801c48:	48 b8 00 40 80 00 00 	movabs $0x804000,%rax
+  801c4f:	00 00 00 
+  801c52:	4c 8b 30             	mov    (%rax),%r14
+  801c55:	48 b8 bc 01 80 00 00 	movabs $0x8001bc,%rax
+  801c5c:	00 00 00 
+  801c5f:	ff d0                	call   *%rax
+  801c61:	89 c6                	mov    %eax,%esi
+  801c63:	45 89 e8             	mov    %r13d,%r8d
+  801c66:	4c 89 e1             	mov    %r12,%rcx
+  801c69:	4c 89 f2             	mov    %r14,%rdx
+  801c6c:	48 bf c0 2d 80 00 00 	movabs $0x802dc0,%rdi
+  801c73:	00 00 00 
+  801c76:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c7b:	49 bc 5d 1d 80 00 00 	movabs $0x801d5d,%r12
+  801c82:	00 00 00 
+  801c85:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  801c88:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  801c8c:	48 89 df             	mov    %rbx,%rdi
+  801c8f:	48 b8 f9 1c 80 00 00 	movabs $0x801cf9,%rax
+  801c96:	00 00 00 
+  801c99:	ff d0                	call   *%rax
+    cprintf("\n");
+  801c9b:	48 bf 13 2d 80 00 00 	movabs $0x802d13,%rdi
+  801ca2:	00 00 00 
+  801ca5:	b8 00 00 00 00       	mov    $0x0,%eax
+  801caa:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  801cad:	cc                   	int3
+  801cae:	eb fd                	jmp    801cad <_panic+0xa0>
+
+0000000000801cb0 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  801cb0:	55                   	push   %rbp
+  801cb1:	48 89 e5             	mov    %rsp,%rbp
+  801cb4:	53                   	push   %rbx
+  801cb5:	48 83 ec 08          	sub    $0x8,%rsp
+  801cb9:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  801cbc:	8b 06                	mov    (%rsi),%eax
+  801cbe:	8d 50 01             	lea    0x1(%rax),%edx
+  801cc1:	89 16                	mov    %edx,(%rsi)
+  801cc3:	48 98                	cltq
+  801cc5:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  801cca:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  801cd0:	74 0a                	je     801cdc <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  801cd2:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  801cd6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801cda:	c9                   	leave
+  801cdb:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  801cdc:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  801ce0:	be ff 00 00 00       	mov    $0xff,%esi
+  801ce5:	48 b8 f3 00 80 00 00 	movabs $0x8000f3,%rax
+  801cec:	00 00 00 
+  801cef:	ff d0                	call   *%rax
+        state->offset = 0;
+  801cf1:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  801cf7:	eb d9                	jmp    801cd2 <putch+0x22>
+
+0000000000801cf9 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  801cf9:	55                   	push   %rbp
+  801cfa:	48 89 e5             	mov    %rsp,%rbp
+  801cfd:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  801d04:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  801d07:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  801d0e:	b9 21 00 00 00       	mov    $0x21,%ecx
+  801d13:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d18:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  801d1b:	48 89 f1             	mov    %rsi,%rcx
+  801d1e:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  801d25:	48 bf b0 1c 80 00 00 	movabs $0x801cb0,%rdi
+  801d2c:	00 00 00 
+  801d2f:	48 b8 ad 1e 80 00 00 	movabs $0x801ead,%rax
+  801d36:	00 00 00 
+  801d39:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  801d3b:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  801d42:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  801d49:	48 b8 f3 00 80 00 00 	movabs $0x8000f3,%rax
+  801d50:	00 00 00 
+  801d53:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  801d55:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  801d5b:	c9                   	leave
+  801d5c:	c3                   	ret
+
+0000000000801d5d <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  801d5d:	55                   	push   %rbp
+  801d5e:	48 89 e5             	mov    %rsp,%rbp
+  801d61:	48 83 ec 50          	sub    $0x50,%rsp
+  801d65:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  801d69:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  801d6d:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801d71:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  801d75:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  801d79:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  801d80:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801d84:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801d88:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  801d8c:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  801d90:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  801d94:	48 b8 f9 1c 80 00 00 	movabs $0x801cf9,%rax
+  801d9b:	00 00 00 
+  801d9e:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  801da0:	c9                   	leave
+  801da1:	c3                   	ret
+
+0000000000801da2 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  801da2:	55                   	push   %rbp
+  801da3:	48 89 e5             	mov    %rsp,%rbp
+  801da6:	41 57                	push   %r15
+  801da8:	41 56                	push   %r14
+  801daa:	41 55                	push   %r13
+  801dac:	41 54                	push   %r12
+  801dae:	53                   	push   %rbx
+  801daf:	48 83 ec 18          	sub    $0x18,%rsp
+  801db3:	49 89 fc             	mov    %rdi,%r12
+  801db6:	49 89 f5             	mov    %rsi,%r13
+  801db9:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801dbd:	8b 45 10             	mov    0x10(%rbp),%eax
+  801dc0:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  801dc3:	41 89 cf             	mov    %ecx,%r15d
+  801dc6:	4c 39 fa             	cmp    %r15,%rdx
+  801dc9:	73 5b                	jae    801e26 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  801dcb:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  801dcf:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  801dd3:	85 db                	test   %ebx,%ebx
+  801dd5:	7e 0e                	jle    801de5 <print_num+0x43>
+            putch(padc, put_arg);
+  801dd7:	4c 89 ee             	mov    %r13,%rsi
+  801dda:	44 89 f7             	mov    %r14d,%edi
+  801ddd:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  801de0:	83 eb 01             	sub    $0x1,%ebx
+  801de3:	75 f2                	jne    801dd7 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  801de5:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  801de9:	48 b9 f4 2d 80 00 00 	movabs $0x802df4,%rcx
+  801df0:	00 00 00 
+  801df3:	48 b8 e3 2d 80 00 00 	movabs $0x802de3,%rax
+  801dfa:	00 00 00 
+  801dfd:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  801e01:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801e05:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e0a:	49 f7 f7             	div    %r15
+  801e0d:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  801e11:	4c 89 ee             	mov    %r13,%rsi
+  801e14:	41 ff d4             	call   *%r12
+}
+  801e17:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  801e1b:	5b                   	pop    %rbx
+  801e1c:	41 5c                	pop    %r12
+  801e1e:	41 5d                	pop    %r13
+  801e20:	41 5e                	pop    %r14
+  801e22:	41 5f                	pop    %r15
+  801e24:	5d                   	pop    %rbp
+  801e25:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  801e26:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801e2a:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e2f:	49 f7 f7             	div    %r15
+  801e32:	48 83 ec 08          	sub    $0x8,%rsp
+  801e36:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  801e3a:	52                   	push   %rdx
+  801e3b:	45 0f be c9          	movsbl %r9b,%r9d
+  801e3f:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  801e43:	48 89 c2             	mov    %rax,%rdx
+  801e46:	48 b8 a2 1d 80 00 00 	movabs $0x801da2,%rax
+  801e4d:	00 00 00 
+  801e50:	ff d0                	call   *%rax
+  801e52:	48 83 c4 10          	add    $0x10,%rsp
+  801e56:	eb 8d                	jmp    801de5 <print_num+0x43>
+
+0000000000801e58 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  801e58:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  801e5c:	48 8b 06             	mov    (%rsi),%rax
+  801e5f:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  801e63:	73 0a                	jae    801e6f <sprintputch+0x17>
+        *state->start++ = ch;
+  801e65:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801e69:	48 89 16             	mov    %rdx,(%rsi)
+  801e6c:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  801e6f:	c3                   	ret
+
+0000000000801e70 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  801e70:	55                   	push   %rbp
+  801e71:	48 89 e5             	mov    %rsp,%rbp
+  801e74:	48 83 ec 50          	sub    $0x50,%rsp
+  801e78:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801e7c:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  801e80:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  801e84:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  801e8b:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801e8f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801e93:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  801e97:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  801e9b:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  801e9f:	48 b8 ad 1e 80 00 00 	movabs $0x801ead,%rax
+  801ea6:	00 00 00 
+  801ea9:	ff d0                	call   *%rax
+}
+  801eab:	c9                   	leave
+  801eac:	c3                   	ret
+
+0000000000801ead <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  801ead:	55                   	push   %rbp
+  801eae:	48 89 e5             	mov    %rsp,%rbp
+  801eb1:	41 57                	push   %r15
+  801eb3:	41 56                	push   %r14
+  801eb5:	41 55                	push   %r13
+  801eb7:	41 54                	push   %r12
+  801eb9:	53                   	push   %rbx
+  801eba:	48 83 ec 38          	sub    $0x38,%rsp
+  801ebe:	49 89 fe             	mov    %rdi,%r14
+  801ec1:	49 89 f5             	mov    %rsi,%r13
+  801ec4:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  801ec7:	48 8b 01             	mov    (%rcx),%rax
+  801eca:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  801ece:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  801ed2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801ed6:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  801eda:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  801ede:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  801ee2:	0f b6 3b             	movzbl (%rbx),%edi
+  801ee5:	40 80 ff 25          	cmp    $0x25,%dil
+  801ee9:	74 18                	je     801f03 <vprintfmt+0x56>
+            if (!ch) return;
+  801eeb:	40 84 ff             	test   %dil,%dil
+  801eee:	0f 84 b1 06 00 00    	je     8025a5 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  801ef4:	40 0f b6 ff          	movzbl %dil,%edi
+  801ef8:	4c 89 ee             	mov    %r13,%rsi
+  801efb:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  801efe:	4c 89 e3             	mov    %r12,%rbx
+  801f01:	eb db                	jmp    801ede <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  801f03:	be 00 00 00 00       	mov    $0x0,%esi
+  801f08:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  801f0c:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  801f11:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  801f17:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  801f1e:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  801f22:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  801f27:	41 0f b6 04 24       	movzbl (%r12),%eax
+  801f2c:	88 45 a0             	mov    %al,-0x60(%rbp)
+  801f2f:	83 e8 23             	sub    $0x23,%eax
+  801f32:	3c 57                	cmp    $0x57,%al
+  801f34:	0f 87 51 06 00 00    	ja     80258b <vprintfmt+0x6de>
+  801f3a:	0f b6 c0             	movzbl %al,%eax
+  801f3d:	48 b9 a0 2f 80 00 00 	movabs $0x802fa0,%rcx
+  801f44:	00 00 00 
+  801f47:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  801f4a:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  801f4d:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  801f51:	eb cf                	jmp    801f22 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  801f53:	49 89 dc             	mov    %rbx,%r12
+  801f56:	be 01 00 00 00       	mov    $0x1,%esi
+  801f5b:	eb c5                	jmp    801f22 <vprintfmt+0x75>
+            padc = ch;
+  801f5d:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  801f61:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  801f64:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801f67:	eb b9                	jmp    801f22 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  801f69:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801f6c:	83 f8 2f             	cmp    $0x2f,%eax
+  801f6f:	77 24                	ja     801f95 <vprintfmt+0xe8>
+  801f71:	89 c1                	mov    %eax,%ecx
+  801f73:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  801f77:	83 c0 08             	add    $0x8,%eax
+  801f7a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801f7d:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  801f80:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  801f83:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  801f87:	79 99                	jns    801f22 <vprintfmt+0x75>
+                width = precision;
+  801f89:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  801f8d:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  801f93:	eb 8d                	jmp    801f22 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  801f95:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  801f99:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  801f9d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801fa1:	eb da                	jmp    801f7d <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  801fa3:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  801fa8:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  801fac:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  801fb2:	3c 39                	cmp    $0x39,%al
+  801fb4:	77 1c                	ja     801fd2 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  801fb6:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  801fba:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  801fbe:	0f b6 c0             	movzbl %al,%eax
+  801fc1:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  801fc6:	0f b6 03             	movzbl (%rbx),%eax
+  801fc9:	3c 39                	cmp    $0x39,%al
+  801fcb:	76 e9                	jbe    801fb6 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  801fcd:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  801fd0:	eb b1                	jmp    801f83 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  801fd2:	49 89 dc             	mov    %rbx,%r12
+  801fd5:	eb ac                	jmp    801f83 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  801fd7:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  801fda:	85 c9                	test   %ecx,%ecx
+  801fdc:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fe1:	0f 49 c1             	cmovns %ecx,%eax
+  801fe4:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  801fe7:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801fea:	e9 33 ff ff ff       	jmp    801f22 <vprintfmt+0x75>
+            lflag++;
+  801fef:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  801ff2:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801ff5:	e9 28 ff ff ff       	jmp    801f22 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  801ffa:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801ffd:	83 f8 2f             	cmp    $0x2f,%eax
+  802000:	77 19                	ja     80201b <vprintfmt+0x16e>
+  802002:	89 c2                	mov    %eax,%edx
+  802004:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802008:	83 c0 08             	add    $0x8,%eax
+  80200b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80200e:	8b 3a                	mov    (%rdx),%edi
+  802010:	4c 89 ee             	mov    %r13,%rsi
+  802013:	41 ff d6             	call   *%r14
+            break;
+  802016:	e9 c3 fe ff ff       	jmp    801ede <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  80201b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80201f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802023:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802027:	eb e5                	jmp    80200e <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  802029:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80202c:	83 f8 2f             	cmp    $0x2f,%eax
+  80202f:	77 5a                	ja     80208b <vprintfmt+0x1de>
+  802031:	89 c2                	mov    %eax,%edx
+  802033:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802037:	83 c0 08             	add    $0x8,%eax
+  80203a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  80203d:	8b 02                	mov    (%rdx),%eax
+  80203f:	89 c1                	mov    %eax,%ecx
+  802041:	f7 d9                	neg    %ecx
+  802043:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  802046:	83 f9 15             	cmp    $0x15,%ecx
+  802049:	7f 4e                	jg     802099 <vprintfmt+0x1ec>
+  80204b:	48 63 c1             	movslq %ecx,%rax
+  80204e:	48 ba 60 32 80 00 00 	movabs $0x803260,%rdx
+  802055:	00 00 00 
+  802058:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80205c:	48 85 c0             	test   %rax,%rax
+  80205f:	74 38                	je     802099 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  802061:	48 89 c1             	mov    %rax,%rcx
+  802064:	48 ba 79 2d 80 00 00 	movabs $0x802d79,%rdx
+  80206b:	00 00 00 
+  80206e:	4c 89 ee             	mov    %r13,%rsi
+  802071:	4c 89 f7             	mov    %r14,%rdi
+  802074:	b8 00 00 00 00       	mov    $0x0,%eax
+  802079:	49 b8 70 1e 80 00 00 	movabs $0x801e70,%r8
+  802080:	00 00 00 
+  802083:	41 ff d0             	call   *%r8
+  802086:	e9 53 fe ff ff       	jmp    801ede <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  80208b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80208f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802093:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802097:	eb a4                	jmp    80203d <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  802099:	48 ba 0c 2e 80 00 00 	movabs $0x802e0c,%rdx
+  8020a0:	00 00 00 
+  8020a3:	4c 89 ee             	mov    %r13,%rsi
+  8020a6:	4c 89 f7             	mov    %r14,%rdi
+  8020a9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020ae:	49 b8 70 1e 80 00 00 	movabs $0x801e70,%r8
+  8020b5:	00 00 00 
+  8020b8:	41 ff d0             	call   *%r8
+  8020bb:	e9 1e fe ff ff       	jmp    801ede <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8020c0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8020c3:	83 f8 2f             	cmp    $0x2f,%eax
+  8020c6:	77 6c                	ja     802134 <vprintfmt+0x287>
+  8020c8:	89 c2                	mov    %eax,%edx
+  8020ca:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8020ce:	83 c0 08             	add    $0x8,%eax
+  8020d1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8020d4:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  8020d7:	48 85 d2             	test   %rdx,%rdx
+  8020da:	48 b8 05 2e 80 00 00 	movabs $0x802e05,%rax
+  8020e1:	00 00 00 
+  8020e4:	48 0f 45 c2          	cmovne %rdx,%rax
+  8020e8:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  8020ec:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8020f0:	7e 06                	jle    8020f8 <vprintfmt+0x24b>
+  8020f2:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  8020f6:	75 4a                	jne    802142 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8020f8:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8020fc:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  802100:	0f b6 00             	movzbl (%rax),%eax
+  802103:	84 c0                	test   %al,%al
+  802105:	0f 85 9a 00 00 00    	jne    8021a5 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  80210b:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80210e:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  802112:	85 c0                	test   %eax,%eax
+  802114:	0f 8e c4 fd ff ff    	jle    801ede <vprintfmt+0x31>
+  80211a:	4c 89 ee             	mov    %r13,%rsi
+  80211d:	bf 20 00 00 00       	mov    $0x20,%edi
+  802122:	41 ff d6             	call   *%r14
+  802125:	41 83 ec 01          	sub    $0x1,%r12d
+  802129:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  80212d:	75 eb                	jne    80211a <vprintfmt+0x26d>
+  80212f:	e9 aa fd ff ff       	jmp    801ede <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  802134:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802138:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80213c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802140:	eb 92                	jmp    8020d4 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  802142:	49 63 f7             	movslq %r15d,%rsi
+  802145:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  802149:	48 b8 5f 26 80 00 00 	movabs $0x80265f,%rax
+  802150:	00 00 00 
+  802153:	ff d0                	call   *%rax
+  802155:	48 89 c2             	mov    %rax,%rdx
+  802158:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80215b:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  80215d:	8d 70 ff             	lea    -0x1(%rax),%esi
+  802160:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  802163:	85 c0                	test   %eax,%eax
+  802165:	7e 91                	jle    8020f8 <vprintfmt+0x24b>
+  802167:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  80216c:	4c 89 ee             	mov    %r13,%rsi
+  80216f:	44 89 e7             	mov    %r12d,%edi
+  802172:	41 ff d6             	call   *%r14
+  802175:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  802179:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80217c:	83 f8 ff             	cmp    $0xffffffff,%eax
+  80217f:	75 eb                	jne    80216c <vprintfmt+0x2bf>
+  802181:	e9 72 ff ff ff       	jmp    8020f8 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  802186:	0f b6 f8             	movzbl %al,%edi
+  802189:	4c 89 ee             	mov    %r13,%rsi
+  80218c:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  80218f:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  802193:	49 83 c4 01          	add    $0x1,%r12
+  802197:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  80219d:	84 c0                	test   %al,%al
+  80219f:	0f 84 66 ff ff ff    	je     80210b <vprintfmt+0x25e>
+  8021a5:	45 85 ff             	test   %r15d,%r15d
+  8021a8:	78 0a                	js     8021b4 <vprintfmt+0x307>
+  8021aa:	41 83 ef 01          	sub    $0x1,%r15d
+  8021ae:	0f 88 57 ff ff ff    	js     80210b <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8021b4:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  8021b8:	74 cc                	je     802186 <vprintfmt+0x2d9>
+  8021ba:	8d 50 e0             	lea    -0x20(%rax),%edx
+  8021bd:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  8021c2:	80 fa 5e             	cmp    $0x5e,%dl
+  8021c5:	77 c2                	ja     802189 <vprintfmt+0x2dc>
+  8021c7:	eb bd                	jmp    802186 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  8021c9:	40 84 f6             	test   %sil,%sil
+  8021cc:	75 26                	jne    8021f4 <vprintfmt+0x347>
+    switch (lflag) {
+  8021ce:	85 d2                	test   %edx,%edx
+  8021d0:	74 59                	je     80222b <vprintfmt+0x37e>
+  8021d2:	83 fa 01             	cmp    $0x1,%edx
+  8021d5:	74 7b                	je     802252 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  8021d7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8021da:	83 f8 2f             	cmp    $0x2f,%eax
+  8021dd:	0f 87 96 00 00 00    	ja     802279 <vprintfmt+0x3cc>
+  8021e3:	89 c2                	mov    %eax,%edx
+  8021e5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8021e9:	83 c0 08             	add    $0x8,%eax
+  8021ec:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8021ef:	4c 8b 22             	mov    (%rdx),%r12
+  8021f2:	eb 17                	jmp    80220b <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  8021f4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8021f7:	83 f8 2f             	cmp    $0x2f,%eax
+  8021fa:	77 21                	ja     80221d <vprintfmt+0x370>
+  8021fc:	89 c2                	mov    %eax,%edx
+  8021fe:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802202:	83 c0 08             	add    $0x8,%eax
+  802205:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802208:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  80220b:	4d 85 e4             	test   %r12,%r12
+  80220e:	78 7a                	js     80228a <vprintfmt+0x3dd>
+            num = i;
+  802210:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  802213:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  802218:	e9 50 02 00 00       	jmp    80246d <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  80221d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802221:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802225:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802229:	eb dd                	jmp    802208 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  80222b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80222e:	83 f8 2f             	cmp    $0x2f,%eax
+  802231:	77 11                	ja     802244 <vprintfmt+0x397>
+  802233:	89 c2                	mov    %eax,%edx
+  802235:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802239:	83 c0 08             	add    $0x8,%eax
+  80223c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80223f:	4c 63 22             	movslq (%rdx),%r12
+  802242:	eb c7                	jmp    80220b <vprintfmt+0x35e>
+  802244:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802248:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80224c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802250:	eb ed                	jmp    80223f <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  802252:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802255:	83 f8 2f             	cmp    $0x2f,%eax
+  802258:	77 11                	ja     80226b <vprintfmt+0x3be>
+  80225a:	89 c2                	mov    %eax,%edx
+  80225c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802260:	83 c0 08             	add    $0x8,%eax
+  802263:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802266:	4c 8b 22             	mov    (%rdx),%r12
+  802269:	eb a0                	jmp    80220b <vprintfmt+0x35e>
+  80226b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80226f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802273:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802277:	eb ed                	jmp    802266 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  802279:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80227d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802281:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802285:	e9 65 ff ff ff       	jmp    8021ef <vprintfmt+0x342>
+                putch('-', put_arg);
+  80228a:	4c 89 ee             	mov    %r13,%rsi
+  80228d:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  802292:	41 ff d6             	call   *%r14
+                i = -i;
+  802295:	49 f7 dc             	neg    %r12
+  802298:	e9 73 ff ff ff       	jmp    802210 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  80229d:	40 84 f6             	test   %sil,%sil
+  8022a0:	75 32                	jne    8022d4 <vprintfmt+0x427>
+    switch (lflag) {
+  8022a2:	85 d2                	test   %edx,%edx
+  8022a4:	74 5d                	je     802303 <vprintfmt+0x456>
+  8022a6:	83 fa 01             	cmp    $0x1,%edx
+  8022a9:	0f 84 82 00 00 00    	je     802331 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  8022af:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8022b2:	83 f8 2f             	cmp    $0x2f,%eax
+  8022b5:	0f 87 a5 00 00 00    	ja     802360 <vprintfmt+0x4b3>
+  8022bb:	89 c2                	mov    %eax,%edx
+  8022bd:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8022c1:	83 c0 08             	add    $0x8,%eax
+  8022c4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8022c7:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8022ca:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  8022cf:	e9 99 01 00 00       	jmp    80246d <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8022d4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8022d7:	83 f8 2f             	cmp    $0x2f,%eax
+  8022da:	77 19                	ja     8022f5 <vprintfmt+0x448>
+  8022dc:	89 c2                	mov    %eax,%edx
+  8022de:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8022e2:	83 c0 08             	add    $0x8,%eax
+  8022e5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8022e8:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8022eb:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8022f0:	e9 78 01 00 00       	jmp    80246d <vprintfmt+0x5c0>
+  8022f5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8022f9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8022fd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802301:	eb e5                	jmp    8022e8 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  802303:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802306:	83 f8 2f             	cmp    $0x2f,%eax
+  802309:	77 18                	ja     802323 <vprintfmt+0x476>
+  80230b:	89 c2                	mov    %eax,%edx
+  80230d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802311:	83 c0 08             	add    $0x8,%eax
+  802314:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802317:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  802319:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  80231e:	e9 4a 01 00 00       	jmp    80246d <vprintfmt+0x5c0>
+  802323:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802327:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80232b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80232f:	eb e6                	jmp    802317 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  802331:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802334:	83 f8 2f             	cmp    $0x2f,%eax
+  802337:	77 19                	ja     802352 <vprintfmt+0x4a5>
+  802339:	89 c2                	mov    %eax,%edx
+  80233b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80233f:	83 c0 08             	add    $0x8,%eax
+  802342:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802345:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  802348:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  80234d:	e9 1b 01 00 00       	jmp    80246d <vprintfmt+0x5c0>
+  802352:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802356:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80235a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80235e:	eb e5                	jmp    802345 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  802360:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802364:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802368:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80236c:	e9 56 ff ff ff       	jmp    8022c7 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  802371:	40 84 f6             	test   %sil,%sil
+  802374:	75 2e                	jne    8023a4 <vprintfmt+0x4f7>
+    switch (lflag) {
+  802376:	85 d2                	test   %edx,%edx
+  802378:	74 59                	je     8023d3 <vprintfmt+0x526>
+  80237a:	83 fa 01             	cmp    $0x1,%edx
+  80237d:	74 7f                	je     8023fe <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  80237f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802382:	83 f8 2f             	cmp    $0x2f,%eax
+  802385:	0f 87 9f 00 00 00    	ja     80242a <vprintfmt+0x57d>
+  80238b:	89 c2                	mov    %eax,%edx
+  80238d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802391:	83 c0 08             	add    $0x8,%eax
+  802394:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802397:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  80239a:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  80239f:	e9 c9 00 00 00       	jmp    80246d <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8023a4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8023a7:	83 f8 2f             	cmp    $0x2f,%eax
+  8023aa:	77 19                	ja     8023c5 <vprintfmt+0x518>
+  8023ac:	89 c2                	mov    %eax,%edx
+  8023ae:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8023b2:	83 c0 08             	add    $0x8,%eax
+  8023b5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8023b8:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8023bb:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8023c0:	e9 a8 00 00 00       	jmp    80246d <vprintfmt+0x5c0>
+  8023c5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8023c9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8023cd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8023d1:	eb e5                	jmp    8023b8 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  8023d3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8023d6:	83 f8 2f             	cmp    $0x2f,%eax
+  8023d9:	77 15                	ja     8023f0 <vprintfmt+0x543>
+  8023db:	89 c2                	mov    %eax,%edx
+  8023dd:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8023e1:	83 c0 08             	add    $0x8,%eax
+  8023e4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8023e7:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  8023e9:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  8023ee:	eb 7d                	jmp    80246d <vprintfmt+0x5c0>
+  8023f0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8023f4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8023f8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8023fc:	eb e9                	jmp    8023e7 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  8023fe:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802401:	83 f8 2f             	cmp    $0x2f,%eax
+  802404:	77 16                	ja     80241c <vprintfmt+0x56f>
+  802406:	89 c2                	mov    %eax,%edx
+  802408:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80240c:	83 c0 08             	add    $0x8,%eax
+  80240f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802412:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  802415:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  80241a:	eb 51                	jmp    80246d <vprintfmt+0x5c0>
+  80241c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802420:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802424:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802428:	eb e8                	jmp    802412 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  80242a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80242e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802432:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802436:	e9 5c ff ff ff       	jmp    802397 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  80243b:	4c 89 ee             	mov    %r13,%rsi
+  80243e:	bf 30 00 00 00       	mov    $0x30,%edi
+  802443:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  802446:	4c 89 ee             	mov    %r13,%rsi
+  802449:	bf 78 00 00 00       	mov    $0x78,%edi
+  80244e:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  802451:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802454:	83 f8 2f             	cmp    $0x2f,%eax
+  802457:	77 47                	ja     8024a0 <vprintfmt+0x5f3>
+  802459:	89 c2                	mov    %eax,%edx
+  80245b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80245f:	83 c0 08             	add    $0x8,%eax
+  802462:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802465:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  802468:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  80246d:	48 83 ec 08          	sub    $0x8,%rsp
+  802471:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  802475:	0f 94 c0             	sete   %al
+  802478:	0f b6 c0             	movzbl %al,%eax
+  80247b:	50                   	push   %rax
+  80247c:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  802481:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  802485:	4c 89 ee             	mov    %r13,%rsi
+  802488:	4c 89 f7             	mov    %r14,%rdi
+  80248b:	48 b8 a2 1d 80 00 00 	movabs $0x801da2,%rax
+  802492:	00 00 00 
+  802495:	ff d0                	call   *%rax
+            break;
+  802497:	48 83 c4 10          	add    $0x10,%rsp
+  80249b:	e9 3e fa ff ff       	jmp    801ede <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  8024a0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8024a4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8024a8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8024ac:	eb b7                	jmp    802465 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  8024ae:	40 84 f6             	test   %sil,%sil
+  8024b1:	75 2b                	jne    8024de <vprintfmt+0x631>
+    switch (lflag) {
+  8024b3:	85 d2                	test   %edx,%edx
+  8024b5:	74 56                	je     80250d <vprintfmt+0x660>
+  8024b7:	83 fa 01             	cmp    $0x1,%edx
+  8024ba:	74 7f                	je     80253b <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  8024bc:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8024bf:	83 f8 2f             	cmp    $0x2f,%eax
+  8024c2:	0f 87 a2 00 00 00    	ja     80256a <vprintfmt+0x6bd>
+  8024c8:	89 c2                	mov    %eax,%edx
+  8024ca:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8024ce:	83 c0 08             	add    $0x8,%eax
+  8024d1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8024d4:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8024d7:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  8024dc:	eb 8f                	jmp    80246d <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8024de:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8024e1:	83 f8 2f             	cmp    $0x2f,%eax
+  8024e4:	77 19                	ja     8024ff <vprintfmt+0x652>
+  8024e6:	89 c2                	mov    %eax,%edx
+  8024e8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8024ec:	83 c0 08             	add    $0x8,%eax
+  8024ef:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8024f2:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8024f5:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8024fa:	e9 6e ff ff ff       	jmp    80246d <vprintfmt+0x5c0>
+  8024ff:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802503:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802507:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80250b:	eb e5                	jmp    8024f2 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  80250d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802510:	83 f8 2f             	cmp    $0x2f,%eax
+  802513:	77 18                	ja     80252d <vprintfmt+0x680>
+  802515:	89 c2                	mov    %eax,%edx
+  802517:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80251b:	83 c0 08             	add    $0x8,%eax
+  80251e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802521:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  802523:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  802528:	e9 40 ff ff ff       	jmp    80246d <vprintfmt+0x5c0>
+  80252d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802531:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802535:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802539:	eb e6                	jmp    802521 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  80253b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80253e:	83 f8 2f             	cmp    $0x2f,%eax
+  802541:	77 19                	ja     80255c <vprintfmt+0x6af>
+  802543:	89 c2                	mov    %eax,%edx
+  802545:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802549:	83 c0 08             	add    $0x8,%eax
+  80254c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80254f:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  802552:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  802557:	e9 11 ff ff ff       	jmp    80246d <vprintfmt+0x5c0>
+  80255c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802560:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802564:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802568:	eb e5                	jmp    80254f <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  80256a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80256e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802572:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802576:	e9 59 ff ff ff       	jmp    8024d4 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  80257b:	4c 89 ee             	mov    %r13,%rsi
+  80257e:	bf 25 00 00 00       	mov    $0x25,%edi
+  802583:	41 ff d6             	call   *%r14
+            break;
+  802586:	e9 53 f9 ff ff       	jmp    801ede <vprintfmt+0x31>
+            putch('%', put_arg);
+  80258b:	4c 89 ee             	mov    %r13,%rsi
+  80258e:	bf 25 00 00 00       	mov    $0x25,%edi
+  802593:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  802596:	48 83 eb 01          	sub    $0x1,%rbx
+  80259a:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  80259e:	75 f6                	jne    802596 <vprintfmt+0x6e9>
+  8025a0:	e9 39 f9 ff ff       	jmp    801ede <vprintfmt+0x31>
+}
+  8025a5:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8025a9:	5b                   	pop    %rbx
+  8025aa:	41 5c                	pop    %r12
+  8025ac:	41 5d                	pop    %r13
+  8025ae:	41 5e                	pop    %r14
+  8025b0:	41 5f                	pop    %r15
+  8025b2:	5d                   	pop    %rbp
+  8025b3:	c3                   	ret
+
+00000000008025b4 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  8025b4:	55                   	push   %rbp
+  8025b5:	48 89 e5             	mov    %rsp,%rbp
+  8025b8:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  8025bc:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8025c0:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  8025c5:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  8025c9:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  8025d0:	48 85 ff             	test   %rdi,%rdi
+  8025d3:	74 2b                	je     802600 <vsnprintf+0x4c>
+  8025d5:	48 85 f6             	test   %rsi,%rsi
+  8025d8:	74 26                	je     802600 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  8025da:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8025de:	48 bf 58 1e 80 00 00 	movabs $0x801e58,%rdi
+  8025e5:	00 00 00 
+  8025e8:	48 b8 ad 1e 80 00 00 	movabs $0x801ead,%rax
+  8025ef:	00 00 00 
+  8025f2:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  8025f4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8025f8:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  8025fb:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  8025fe:	c9                   	leave
+  8025ff:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  802600:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802605:	eb f7                	jmp    8025fe <vsnprintf+0x4a>
+
+0000000000802607 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  802607:	55                   	push   %rbp
+  802608:	48 89 e5             	mov    %rsp,%rbp
+  80260b:	48 83 ec 50          	sub    $0x50,%rsp
+  80260f:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  802613:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  802617:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  80261b:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  802622:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802626:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80262a:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80262e:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  802632:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  802636:	48 b8 b4 25 80 00 00 	movabs $0x8025b4,%rax
+  80263d:	00 00 00 
+  802640:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  802642:	c9                   	leave
+  802643:	c3                   	ret
+
+0000000000802644 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  802644:	80 3f 00             	cmpb   $0x0,(%rdi)
+  802647:	74 10                	je     802659 <strlen+0x15>
+    size_t n = 0;
+  802649:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  80264e:	48 83 c0 01          	add    $0x1,%rax
+  802652:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  802656:	75 f6                	jne    80264e <strlen+0xa>
+  802658:	c3                   	ret
+    size_t n = 0;
+  802659:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  80265e:	c3                   	ret
+
+000000000080265f <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  80265f:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  802662:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  802667:	48 85 f6             	test   %rsi,%rsi
+  80266a:	74 11                	je     80267d <strnlen+0x1e>
+  80266c:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  802670:	74 0c                	je     80267e <strnlen+0x1f>
+  802672:	48 83 c2 01          	add    $0x1,%rdx
+  802676:	48 39 d0             	cmp    %rdx,%rax
+  802679:	75 f1                	jne    80266c <strnlen+0xd>
+  80267b:	eb 04                	jmp    802681 <strnlen+0x22>
+  80267d:	c3                   	ret
+  80267e:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  802681:	c3                   	ret
+
+0000000000802682 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  802682:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  802685:	ba 00 00 00 00       	mov    $0x0,%edx
+  80268a:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  80268e:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  802691:	48 83 c2 01          	add    $0x1,%rdx
+  802695:	84 c9                	test   %cl,%cl
+  802697:	75 f1                	jne    80268a <strcpy+0x8>
+        ;
+    return res;
+}
+  802699:	c3                   	ret
+
+000000000080269a <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  80269a:	55                   	push   %rbp
+  80269b:	48 89 e5             	mov    %rsp,%rbp
+  80269e:	41 54                	push   %r12
+  8026a0:	53                   	push   %rbx
+  8026a1:	48 89 fb             	mov    %rdi,%rbx
+  8026a4:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  8026a7:	48 b8 44 26 80 00 00 	movabs $0x802644,%rax
+  8026ae:	00 00 00 
+  8026b1:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  8026b3:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  8026b7:	4c 89 e6             	mov    %r12,%rsi
+  8026ba:	48 b8 82 26 80 00 00 	movabs $0x802682,%rax
+  8026c1:	00 00 00 
+  8026c4:	ff d0                	call   *%rax
+    return dst;
+}
+  8026c6:	48 89 d8             	mov    %rbx,%rax
+  8026c9:	5b                   	pop    %rbx
+  8026ca:	41 5c                	pop    %r12
+  8026cc:	5d                   	pop    %rbp
+  8026cd:	c3                   	ret
+
+00000000008026ce <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8026ce:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  8026d1:	48 85 d2             	test   %rdx,%rdx
+  8026d4:	74 1f                	je     8026f5 <strncpy+0x27>
+  8026d6:	48 01 fa             	add    %rdi,%rdx
+  8026d9:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  8026dc:	48 83 c1 01          	add    $0x1,%rcx
+  8026e0:	44 0f b6 06          	movzbl (%rsi),%r8d
+  8026e4:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  8026e8:	41 80 f8 01          	cmp    $0x1,%r8b
+  8026ec:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  8026f0:	48 39 ca             	cmp    %rcx,%rdx
+  8026f3:	75 e7                	jne    8026dc <strncpy+0xe>
+    }
+    return ret;
+}
+  8026f5:	c3                   	ret
+
+00000000008026f6 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  8026f6:	48 89 f8             	mov    %rdi,%rax
+  8026f9:	48 85 d2             	test   %rdx,%rdx
+  8026fc:	74 24                	je     802722 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  8026fe:	48 83 ea 01          	sub    $0x1,%rdx
+  802702:	74 1b                	je     80271f <strlcpy+0x29>
+  802704:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  802708:	0f b6 16             	movzbl (%rsi),%edx
+  80270b:	84 d2                	test   %dl,%dl
+  80270d:	74 10                	je     80271f <strlcpy+0x29>
+            *dst++ = *src++;
+  80270f:	48 83 c6 01          	add    $0x1,%rsi
+  802713:	48 83 c0 01          	add    $0x1,%rax
+  802717:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  80271a:	48 39 c8             	cmp    %rcx,%rax
+  80271d:	75 e9                	jne    802708 <strlcpy+0x12>
+        *dst = '\0';
+  80271f:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  802722:	48 29 f8             	sub    %rdi,%rax
+}
+  802725:	c3                   	ret
+
+0000000000802726 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  802726:	0f b6 07             	movzbl (%rdi),%eax
+  802729:	84 c0                	test   %al,%al
+  80272b:	74 13                	je     802740 <strcmp+0x1a>
+  80272d:	38 06                	cmp    %al,(%rsi)
+  80272f:	75 0f                	jne    802740 <strcmp+0x1a>
+  802731:	48 83 c7 01          	add    $0x1,%rdi
+  802735:	48 83 c6 01          	add    $0x1,%rsi
+  802739:	0f b6 07             	movzbl (%rdi),%eax
+  80273c:	84 c0                	test   %al,%al
+  80273e:	75 ed                	jne    80272d <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  802740:	0f b6 c0             	movzbl %al,%eax
+  802743:	0f b6 16             	movzbl (%rsi),%edx
+  802746:	29 d0                	sub    %edx,%eax
+}
+  802748:	c3                   	ret
+
+0000000000802749 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  802749:	48 85 d2             	test   %rdx,%rdx
+  80274c:	74 1f                	je     80276d <strncmp+0x24>
+  80274e:	0f b6 07             	movzbl (%rdi),%eax
+  802751:	84 c0                	test   %al,%al
+  802753:	74 1e                	je     802773 <strncmp+0x2a>
+  802755:	3a 06                	cmp    (%rsi),%al
+  802757:	75 1a                	jne    802773 <strncmp+0x2a>
+  802759:	48 83 c7 01          	add    $0x1,%rdi
+  80275d:	48 83 c6 01          	add    $0x1,%rsi
+  802761:	48 83 ea 01          	sub    $0x1,%rdx
+  802765:	75 e7                	jne    80274e <strncmp+0x5>
+
+    if (!n) return 0;
+  802767:	b8 00 00 00 00       	mov    $0x0,%eax
+  80276c:	c3                   	ret
+  80276d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802772:	c3                   	ret
+  802773:	48 85 d2             	test   %rdx,%rdx
+  802776:	74 09                	je     802781 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  802778:	0f b6 07             	movzbl (%rdi),%eax
+  80277b:	0f b6 16             	movzbl (%rsi),%edx
+  80277e:	29 d0                	sub    %edx,%eax
+  802780:	c3                   	ret
+    if (!n) return 0;
+  802781:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802786:	c3                   	ret
+
+0000000000802787 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  802787:	0f b6 17             	movzbl (%rdi),%edx
+  80278a:	84 d2                	test   %dl,%dl
+  80278c:	74 18                	je     8027a6 <strchr+0x1f>
+        if (*str == c) {
+  80278e:	0f be d2             	movsbl %dl,%edx
+  802791:	39 f2                	cmp    %esi,%edx
+  802793:	74 17                	je     8027ac <strchr+0x25>
+    for (; *str; str++) {
+  802795:	48 83 c7 01          	add    $0x1,%rdi
+  802799:	0f b6 17             	movzbl (%rdi),%edx
+  80279c:	84 d2                	test   %dl,%dl
+  80279e:	75 ee                	jne    80278e <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  8027a0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027a5:	c3                   	ret
+  8027a6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027ab:	c3                   	ret
+  8027ac:	48 89 f8             	mov    %rdi,%rax
+}
+  8027af:	c3                   	ret
+
+00000000008027b0 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  8027b0:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  8027b3:	0f b6 17             	movzbl (%rdi),%edx
+  8027b6:	84 d2                	test   %dl,%dl
+  8027b8:	74 13                	je     8027cd <strfind+0x1d>
+  8027ba:	0f be d2             	movsbl %dl,%edx
+  8027bd:	39 f2                	cmp    %esi,%edx
+  8027bf:	74 0b                	je     8027cc <strfind+0x1c>
+  8027c1:	48 83 c0 01          	add    $0x1,%rax
+  8027c5:	0f b6 10             	movzbl (%rax),%edx
+  8027c8:	84 d2                	test   %dl,%dl
+  8027ca:	75 ee                	jne    8027ba <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  8027cc:	c3                   	ret
+  8027cd:	c3                   	ret
+
+00000000008027ce <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  8027ce:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  8027d1:	48 89 f8             	mov    %rdi,%rax
+  8027d4:	48 f7 d8             	neg    %rax
+  8027d7:	83 e0 07             	and    $0x7,%eax
+  8027da:	49 89 d1             	mov    %rdx,%r9
+  8027dd:	49 29 c1             	sub    %rax,%r9
+  8027e0:	78 36                	js     802818 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  8027e2:	40 0f b6 c6          	movzbl %sil,%eax
+  8027e6:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  8027ed:	01 01 01 
+  8027f0:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  8027f4:	40 f6 c7 07          	test   $0x7,%dil
+  8027f8:	75 38                	jne    802832 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  8027fa:	4c 89 c9             	mov    %r9,%rcx
+  8027fd:	48 c1 f9 03          	sar    $0x3,%rcx
+  802801:	74 0c                	je     80280f <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  802803:	fc                   	cld
+  802804:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  802807:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  80280b:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  80280f:	4d 85 c9             	test   %r9,%r9
+  802812:	75 45                	jne    802859 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  802814:	4c 89 c0             	mov    %r8,%rax
+  802817:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  802818:	48 85 d2             	test   %rdx,%rdx
+  80281b:	74 f7                	je     802814 <memset+0x46>
+  80281d:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  802820:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  802823:	48 83 c0 01          	add    $0x1,%rax
+  802827:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  80282b:	48 39 c2             	cmp    %rax,%rdx
+  80282e:	75 f3                	jne    802823 <memset+0x55>
+  802830:	eb e2                	jmp    802814 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  802832:	40 f6 c7 01          	test   $0x1,%dil
+  802836:	74 06                	je     80283e <memset+0x70>
+  802838:	88 07                	mov    %al,(%rdi)
+  80283a:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  80283e:	40 f6 c7 02          	test   $0x2,%dil
+  802842:	74 07                	je     80284b <memset+0x7d>
+  802844:	66 89 07             	mov    %ax,(%rdi)
+  802847:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  80284b:	40 f6 c7 04          	test   $0x4,%dil
+  80284f:	74 a9                	je     8027fa <memset+0x2c>
+  802851:	89 07                	mov    %eax,(%rdi)
+  802853:	48 83 c7 04          	add    $0x4,%rdi
+  802857:	eb a1                	jmp    8027fa <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  802859:	41 f6 c1 04          	test   $0x4,%r9b
+  80285d:	74 06                	je     802865 <memset+0x97>
+  80285f:	89 07                	mov    %eax,(%rdi)
+  802861:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  802865:	41 f6 c1 02          	test   $0x2,%r9b
+  802869:	74 07                	je     802872 <memset+0xa4>
+  80286b:	66 89 07             	mov    %ax,(%rdi)
+  80286e:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  802872:	41 f6 c1 01          	test   $0x1,%r9b
+  802876:	74 9c                	je     802814 <memset+0x46>
+  802878:	88 07                	mov    %al,(%rdi)
+  80287a:	eb 98                	jmp    802814 <memset+0x46>
+
+000000000080287c <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  80287c:	48 89 f8             	mov    %rdi,%rax
+  80287f:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  802882:	48 39 fe             	cmp    %rdi,%rsi
+  802885:	73 3b                	jae    8028c2 <memmove+0x46>
+  802887:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  80288b:	48 39 d7             	cmp    %rdx,%rdi
+  80288e:	73 32                	jae    8028c2 <memmove+0x46>
+        s += n;
+        d += n;
+  802890:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  802894:	48 89 d6             	mov    %rdx,%rsi
+  802897:	48 09 fe             	or     %rdi,%rsi
+  80289a:	48 09 ce             	or     %rcx,%rsi
+  80289d:	40 f6 c6 07          	test   $0x7,%sil
+  8028a1:	75 12                	jne    8028b5 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  8028a3:	48 83 ef 08          	sub    $0x8,%rdi
+  8028a7:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  8028ab:	48 c1 e9 03          	shr    $0x3,%rcx
+  8028af:	fd                   	std
+  8028b0:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  8028b3:	fc                   	cld
+  8028b4:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  8028b5:	48 83 ef 01          	sub    $0x1,%rdi
+  8028b9:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  8028bd:	fd                   	std
+  8028be:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  8028c0:	eb f1                	jmp    8028b3 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  8028c2:	48 89 f2             	mov    %rsi,%rdx
+  8028c5:	48 09 c2             	or     %rax,%rdx
+  8028c8:	48 09 ca             	or     %rcx,%rdx
+  8028cb:	f6 c2 07             	test   $0x7,%dl
+  8028ce:	75 0c                	jne    8028dc <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  8028d0:	48 c1 e9 03          	shr    $0x3,%rcx
+  8028d4:	48 89 c7             	mov    %rax,%rdi
+  8028d7:	fc                   	cld
+  8028d8:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  8028db:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  8028dc:	48 89 c7             	mov    %rax,%rdi
+  8028df:	fc                   	cld
+  8028e0:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  8028e2:	c3                   	ret
+
+00000000008028e3 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  8028e3:	55                   	push   %rbp
+  8028e4:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  8028e7:	48 b8 7c 28 80 00 00 	movabs $0x80287c,%rax
+  8028ee:	00 00 00 
+  8028f1:	ff d0                	call   *%rax
+}
+  8028f3:	5d                   	pop    %rbp
+  8028f4:	c3                   	ret
+
+00000000008028f5 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  8028f5:	55                   	push   %rbp
+  8028f6:	48 89 e5             	mov    %rsp,%rbp
+  8028f9:	41 57                	push   %r15
+  8028fb:	41 56                	push   %r14
+  8028fd:	41 55                	push   %r13
+  8028ff:	41 54                	push   %r12
+  802901:	53                   	push   %rbx
+  802902:	48 83 ec 08          	sub    $0x8,%rsp
+  802906:	49 89 fe             	mov    %rdi,%r14
+  802909:	49 89 f7             	mov    %rsi,%r15
+  80290c:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  80290f:	48 89 f7             	mov    %rsi,%rdi
+  802912:	48 b8 44 26 80 00 00 	movabs $0x802644,%rax
+  802919:	00 00 00 
+  80291c:	ff d0                	call   *%rax
+  80291e:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  802921:	48 89 de             	mov    %rbx,%rsi
+  802924:	4c 89 f7             	mov    %r14,%rdi
+  802927:	48 b8 5f 26 80 00 00 	movabs $0x80265f,%rax
+  80292e:	00 00 00 
+  802931:	ff d0                	call   *%rax
+  802933:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  802936:	48 39 c3             	cmp    %rax,%rbx
+  802939:	74 36                	je     802971 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  80293b:	48 89 d8             	mov    %rbx,%rax
+  80293e:	4c 29 e8             	sub    %r13,%rax
+  802941:	49 39 c4             	cmp    %rax,%r12
+  802944:	73 31                	jae    802977 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  802946:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  80294b:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  80294f:	4c 89 fe             	mov    %r15,%rsi
+  802952:	48 b8 e3 28 80 00 00 	movabs $0x8028e3,%rax
+  802959:	00 00 00 
+  80295c:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  80295e:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  802962:	48 83 c4 08          	add    $0x8,%rsp
+  802966:	5b                   	pop    %rbx
+  802967:	41 5c                	pop    %r12
+  802969:	41 5d                	pop    %r13
+  80296b:	41 5e                	pop    %r14
+  80296d:	41 5f                	pop    %r15
+  80296f:	5d                   	pop    %rbp
+  802970:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  802971:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  802975:	eb eb                	jmp    802962 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  802977:	48 83 eb 01          	sub    $0x1,%rbx
+  80297b:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  80297f:	48 89 da             	mov    %rbx,%rdx
+  802982:	4c 89 fe             	mov    %r15,%rsi
+  802985:	48 b8 e3 28 80 00 00 	movabs $0x8028e3,%rax
+  80298c:	00 00 00 
+  80298f:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  802991:	49 01 de             	add    %rbx,%r14
+  802994:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  802999:	eb c3                	jmp    80295e <strlcat+0x69>
+
+000000000080299b <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  80299b:	48 85 d2             	test   %rdx,%rdx
+  80299e:	74 2d                	je     8029cd <memcmp+0x32>
+  8029a0:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  8029a5:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  8029a9:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  8029ae:	44 38 c1             	cmp    %r8b,%cl
+  8029b1:	75 0f                	jne    8029c2 <memcmp+0x27>
+    while (n-- > 0) {
+  8029b3:	48 83 c0 01          	add    $0x1,%rax
+  8029b7:	48 39 c2             	cmp    %rax,%rdx
+  8029ba:	75 e9                	jne    8029a5 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  8029bc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029c1:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  8029c2:	0f b6 c1             	movzbl %cl,%eax
+  8029c5:	45 0f b6 c0          	movzbl %r8b,%r8d
+  8029c9:	44 29 c0             	sub    %r8d,%eax
+  8029cc:	c3                   	ret
+    return 0;
+  8029cd:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8029d2:	c3                   	ret
+
+00000000008029d3 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  8029d3:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  8029d7:	48 39 c7             	cmp    %rax,%rdi
+  8029da:	73 0f                	jae    8029eb <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  8029dc:	40 38 37             	cmp    %sil,(%rdi)
+  8029df:	74 0e                	je     8029ef <memfind+0x1c>
+    for (; src < end; src++) {
+  8029e1:	48 83 c7 01          	add    $0x1,%rdi
+  8029e5:	48 39 f8             	cmp    %rdi,%rax
+  8029e8:	75 f2                	jne    8029dc <memfind+0x9>
+  8029ea:	c3                   	ret
+  8029eb:	48 89 f8             	mov    %rdi,%rax
+  8029ee:	c3                   	ret
+  8029ef:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  8029f2:	c3                   	ret
+
+00000000008029f3 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  8029f3:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  8029f6:	0f b6 37             	movzbl (%rdi),%esi
+  8029f9:	40 80 fe 20          	cmp    $0x20,%sil
+  8029fd:	74 06                	je     802a05 <strtol+0x12>
+  8029ff:	40 80 fe 09          	cmp    $0x9,%sil
+  802a03:	75 13                	jne    802a18 <strtol+0x25>
+  802a05:	48 83 c7 01          	add    $0x1,%rdi
+  802a09:	0f b6 37             	movzbl (%rdi),%esi
+  802a0c:	40 80 fe 20          	cmp    $0x20,%sil
+  802a10:	74 f3                	je     802a05 <strtol+0x12>
+  802a12:	40 80 fe 09          	cmp    $0x9,%sil
+  802a16:	74 ed                	je     802a05 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  802a18:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  802a1b:	83 e0 fd             	and    $0xfffffffd,%eax
+  802a1e:	3c 01                	cmp    $0x1,%al
+  802a20:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  802a24:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  802a2a:	75 0f                	jne    802a3b <strtol+0x48>
+  802a2c:	80 3f 30             	cmpb   $0x30,(%rdi)
+  802a2f:	74 14                	je     802a45 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  802a31:	85 d2                	test   %edx,%edx
+  802a33:	b8 0a 00 00 00       	mov    $0xa,%eax
+  802a38:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  802a3b:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  802a40:	4c 63 ca             	movslq %edx,%r9
+  802a43:	eb 36                	jmp    802a7b <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  802a45:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  802a49:	74 0f                	je     802a5a <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  802a4b:	85 d2                	test   %edx,%edx
+  802a4d:	75 ec                	jne    802a3b <strtol+0x48>
+        s++;
+  802a4f:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  802a53:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  802a58:	eb e1                	jmp    802a3b <strtol+0x48>
+        s += 2;
+  802a5a:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  802a5e:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  802a63:	eb d6                	jmp    802a3b <strtol+0x48>
+            dig -= '0';
+  802a65:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  802a68:	44 0f b6 c1          	movzbl %cl,%r8d
+  802a6c:	41 39 d0             	cmp    %edx,%r8d
+  802a6f:	7d 21                	jge    802a92 <strtol+0x9f>
+        val = val * base + dig;
+  802a71:	49 0f af c1          	imul   %r9,%rax
+  802a75:	0f b6 c9             	movzbl %cl,%ecx
+  802a78:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  802a7b:	48 83 c7 01          	add    $0x1,%rdi
+  802a7f:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  802a83:	80 f9 39             	cmp    $0x39,%cl
+  802a86:	76 dd                	jbe    802a65 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  802a88:	80 f9 7b             	cmp    $0x7b,%cl
+  802a8b:	77 05                	ja     802a92 <strtol+0x9f>
+            dig -= 'a' - 10;
+  802a8d:	83 e9 57             	sub    $0x57,%ecx
+  802a90:	eb d6                	jmp    802a68 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  802a92:	4d 85 d2             	test   %r10,%r10
+  802a95:	74 03                	je     802a9a <strtol+0xa7>
+  802a97:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  802a9a:	48 89 c2             	mov    %rax,%rdx
+  802a9d:	48 f7 da             	neg    %rdx
+  802aa0:	40 80 fe 2d          	cmp    $0x2d,%sil
+  802aa4:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  802aa8:	c3                   	ret
+
+0000000000802aa9 <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  802aa9:	55                   	push   %rbp
+  802aaa:	48 89 e5             	mov    %rsp,%rbp
+  802aad:	41 55                	push   %r13
+  802aaf:	41 54                	push   %r12
+  802ab1:	53                   	push   %rbx
+  802ab2:	48 83 ec 08          	sub    $0x8,%rsp
+  802ab6:	49 89 fc             	mov    %rdi,%r12
+  802ab9:	48 89 f7             	mov    %rsi,%rdi
+  802abc:	48 89 d3             	mov    %rdx,%rbx
+  802abf:	49 89 cd             	mov    %rcx,%r13
+    // LAB 9: Your code here:
+    int res = sys_ipc_recv(!pg ? (void*)MAX_USER_ADDRESS : pg, !size ? 0 : *size);
+  802ac2:	be 00 00 00 00       	mov    $0x0,%esi
+  802ac7:	48 85 d2             	test   %rdx,%rdx
+  802aca:	74 03                	je     802acf <ipc_recv+0x26>
+  802acc:	48 8b 32             	mov    (%rdx),%rsi
+  802acf:	48 85 ff             	test   %rdi,%rdi
+  802ad2:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802ad9:	00 00 00 
+  802adc:	48 0f 44 f8          	cmove  %rax,%rdi
+  802ae0:	48 b8 4e 06 80 00 00 	movabs $0x80064e,%rax
+  802ae7:	00 00 00 
+  802aea:	ff d0                	call   *%rax
+    if (res < 0) {
+  802aec:	85 c0                	test   %eax,%eax
+  802aee:	78 66                	js     802b56 <ipc_recv+0xad>
+        if (size) {
+            *size = 0;
+        }
+        return res;
+    }
+    if (from_env_store) {
+  802af0:	4d 85 e4             	test   %r12,%r12
+  802af3:	74 14                	je     802b09 <ipc_recv+0x60>
+        *from_env_store = thisenv->env_ipc_from;
+  802af5:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802afc:	00 00 00 
+  802aff:	8b 80 ac 01 00 00    	mov    0x1ac(%rax),%eax
+  802b05:	41 89 04 24          	mov    %eax,(%r12)
+    }
+    if (perm_store) {
+  802b09:	4d 85 ed             	test   %r13,%r13
+  802b0c:	74 14                	je     802b22 <ipc_recv+0x79>
+        *perm_store = thisenv->env_ipc_perm;
+  802b0e:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802b15:	00 00 00 
+  802b18:	8b 80 b0 01 00 00    	mov    0x1b0(%rax),%eax
+  802b1e:	41 89 45 00          	mov    %eax,0x0(%r13)
+    }
+    if (size) {
+  802b22:	48 85 db             	test   %rbx,%rbx
+  802b25:	74 14                	je     802b3b <ipc_recv+0x92>
+        *size = thisenv->env_ipc_maxsz;
+  802b27:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802b2e:	00 00 00 
+  802b31:	48 8b 80 a0 01 00 00 	mov    0x1a0(%rax),%rax
+  802b38:	48 89 03             	mov    %rax,(%rbx)
+    }
+    return thisenv->env_ipc_value;
+  802b3b:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802b42:	00 00 00 
+  802b45:	8b 80 a8 01 00 00    	mov    0x1a8(%rax),%eax
+}
+  802b4b:	48 83 c4 08          	add    $0x8,%rsp
+  802b4f:	5b                   	pop    %rbx
+  802b50:	41 5c                	pop    %r12
+  802b52:	41 5d                	pop    %r13
+  802b54:	5d                   	pop    %rbp
+  802b55:	c3                   	ret
+        if (from_env_store) {
+  802b56:	4d 85 e4             	test   %r12,%r12
+  802b59:	74 08                	je     802b63 <ipc_recv+0xba>
+            *from_env_store = 0;
+  802b5b:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  802b62:	00 
+        if (perm_store) {
+  802b63:	4d 85 ed             	test   %r13,%r13
+  802b66:	74 08                	je     802b70 <ipc_recv+0xc7>
+            *perm_store = 0;
+  802b68:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  802b6f:	00 
+        if (size) {
+  802b70:	48 85 db             	test   %rbx,%rbx
+  802b73:	74 d6                	je     802b4b <ipc_recv+0xa2>
+            *size = 0;
+  802b75:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  802b7c:	eb cd                	jmp    802b4b <ipc_recv+0xa2>
+
+0000000000802b7e <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  802b7e:	55                   	push   %rbp
+  802b7f:	48 89 e5             	mov    %rsp,%rbp
+  802b82:	41 57                	push   %r15
+  802b84:	41 56                	push   %r14
+  802b86:	41 55                	push   %r13
+  802b88:	41 54                	push   %r12
+  802b8a:	53                   	push   %rbx
+  802b8b:	48 83 ec 18          	sub    $0x18,%rsp
+  802b8f:	41 89 fd             	mov    %edi,%r13d
+  802b92:	89 75 cc             	mov    %esi,-0x34(%rbp)
+  802b95:	49 89 cc             	mov    %rcx,%r12
+  802b98:	44 89 45 c8          	mov    %r8d,-0x38(%rbp)
+    // LAB 9: Your code here:
+    int res = 0;
+    while ((res = sys_ipc_try_send(to_env, val, !pg ? (void*)MAX_USER_ADDRESS : pg, size, perm)) < 0) {
+  802b9c:	48 85 d2             	test   %rdx,%rdx
+  802b9f:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802ba6:	00 00 00 
+  802ba9:	48 0f 45 c2          	cmovne %rdx,%rax
+  802bad:	48 89 c3             	mov    %rax,%rbx
+  802bb0:	49 be 22 06 80 00 00 	movabs $0x800622,%r14
+  802bb7:	00 00 00 
+        if (res != -E_IPC_NOT_RECV) {
+            panic("sys_ipc_try_send failed: %i", res);
+        }
+        sys_yield();
+  802bba:	49 bf ed 01 80 00 00 	movabs $0x8001ed,%r15
+  802bc1:	00 00 00 
+    while ((res = sys_ipc_try_send(to_env, val, !pg ? (void*)MAX_USER_ADDRESS : pg, size, perm)) < 0) {
+  802bc4:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  802bc7:	44 8b 45 c8          	mov    -0x38(%rbp),%r8d
+  802bcb:	4c 89 e1             	mov    %r12,%rcx
+  802bce:	48 89 da             	mov    %rbx,%rdx
+  802bd1:	44 89 ef             	mov    %r13d,%edi
+  802bd4:	41 ff d6             	call   *%r14
+  802bd7:	85 c0                	test   %eax,%eax
+  802bd9:	79 37                	jns    802c12 <ipc_send+0x94>
+        if (res != -E_IPC_NOT_RECV) {
+  802bdb:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  802bde:	75 05                	jne    802be5 <ipc_send+0x67>
+        sys_yield();
+  802be0:	41 ff d7             	call   *%r15
+  802be3:	eb df                	jmp    802bc4 <ipc_send+0x46>
+            panic("sys_ipc_try_send failed: %i", res);
+  802be5:	89 c1                	mov    %eax,%ecx
+  802be7:	48 ba 2f 33 80 00 00 	movabs $0x80332f,%rdx
+  802bee:	00 00 00 
+  802bf1:	be 40 00 00 00       	mov    $0x40,%esi
+  802bf6:	48 bf 4b 33 80 00 00 	movabs $0x80334b,%rdi
+  802bfd:	00 00 00 
+  802c00:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c05:	49 b8 0d 1c 80 00 00 	movabs $0x801c0d,%r8
+  802c0c:	00 00 00 
+  802c0f:	41 ff d0             	call   *%r8
+    }
+    return;
+}
+  802c12:	48 83 c4 18          	add    $0x18,%rsp
+  802c16:	5b                   	pop    %rbx
+  802c17:	41 5c                	pop    %r12
+  802c19:	41 5d                	pop    %r13
+  802c1b:	41 5e                	pop    %r14
+  802c1d:	41 5f                	pop    %r15
+  802c1f:	5d                   	pop    %rbp
+  802c20:	c3                   	ret
+
+0000000000802c21 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  802c21:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  802c26:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  802c2d:	00 00 00 
+  802c30:	48 69 d0 d0 01 00 00 	imul   $0x1d0,%rax,%rdx
+  802c37:	48 01 ca             	add    %rcx,%rdx
+  802c3a:	8b 92 e8 00 00 00    	mov    0xe8(%rdx),%edx
+  802c40:	39 fa                	cmp    %edi,%edx
+  802c42:	74 12                	je     802c56 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  802c44:	48 83 c0 01          	add    $0x1,%rax
+  802c48:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  802c4e:	75 e0                	jne    802c30 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  802c50:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802c55:	c3                   	ret
+            return envs[i].env_id;
+  802c56:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+  802c5d:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  802c64:	00 00 00 
+  802c67:	48 01 d0             	add    %rdx,%rax
+  802c6a:	8b 80 e0 00 00 00    	mov    0xe0(%rax),%eax
+  802c70:	c3                   	ret
+  802c71:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000802c78 <__rodata_start>:
+  802c78:	3c 75                	cmp    $0x75,%al
+  802c7a:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802c7b:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  802c7f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802c80:	3e 00 66 0f          	ds add %ah,0xf(%rsi)
+  802c84:	1f                   	(bad)
+  802c85:	44 00 00             	add    %r8b,(%rax)
+  802c88:	73 79                	jae    802d03 <__rodata_start+0x8b>
+  802c8a:	73 63                	jae    802cef <__rodata_start+0x77>
+  802c8c:	61                   	(bad)
+  802c8d:	6c                   	insb   (%dx),%es:(%rdi)
+  802c8e:	6c                   	insb   (%dx),%es:(%rdi)
+  802c8f:	20 25 7a 64 20 72    	and    %ah,0x7220647a(%rip)        # 72a0910f <__bss_end+0x7220110f>
+  802c95:	65 74 75             	gs je  802d0d <__rodata_start+0x95>
+  802c98:	72 6e                	jb     802d08 <__rodata_start+0x90>
+  802c9a:	65 64 20 25 7a 64 20 	gs and %ah,%fs:0x2820647a(%rip)        # 28a0911c <__bss_end+0x2820111c>
+  802ca1:	28 
+  802ca2:	3e 20 30             	ds and %dh,(%rax)
+  802ca5:	29 00                	sub    %eax,(%rax)
+  802ca7:	6c                   	insb   (%dx),%es:(%rdi)
+  802ca8:	69 62 2f 73 79 73 63 	imul   $0x63737973,0x2f(%rdx),%esp
+  802caf:	61                   	(bad)
+  802cb0:	6c                   	insb   (%dx),%es:(%rdi)
+  802cb1:	6c                   	insb   (%dx),%es:(%rdi)
+  802cb2:	2e 63 00             	cs movsxd (%rax),%eax
+  802cb5:	0f 1f 00             	nopl   (%rax)
+  802cb8:	5b                   	pop    %rbx
+  802cb9:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  802cbe:	20 75 6e             	and    %dh,0x6e(%rbp)
+  802cc1:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  802cc5:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802cc6:	20 64 65 76          	and    %ah,0x76(%rbp,%riz,2)
+  802cca:	69 63 65 20 74 79 70 	imul   $0x70797420,0x65(%rbx),%esp
+  802cd1:	65 20 25 64 0a 00 00 	and    %ah,%gs:0xa64(%rip)        # 80373c <error_string+0x4dc>
+  802cd8:	5b                   	pop    %rbx
+  802cd9:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  802cde:	20 66 74             	and    %ah,0x74(%rsi)
+  802ce1:	72 75                	jb     802d58 <devtab+0x18>
+  802ce3:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802ce4:	63 61 74             	movsxd 0x74(%rcx),%esp
+  802ce7:	65 20 25 64 20 2d 2d 	and    %ah,%gs:0x2d2d2064(%rip)        # 2dad4d52 <__bss_end+0x2d2ccd52>
+  802cee:	20 62 61             	and    %ah,0x61(%rdx)
+  802cf1:	64 20 6d 6f          	and    %ch,%fs:0x6f(%rbp)
+  802cf5:	64 65 0a 00          	fs or  %gs:(%rax),%al
+  802cf9:	5b                   	pop    %rbx
+  802cfa:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  802cff:	20 72 65             	and    %dh,0x65(%rdx)
+  802d02:	61                   	(bad)
+  802d03:	64 20 25 64 20 2d 2d 	and    %ah,%fs:0x2d2d2064(%rip)        # 2dad4d6e <__bss_end+0x2d2ccd6e>
+  802d0a:	20 62 61             	and    %ah,0x61(%rdx)
+  802d0d:	64 20 6d 6f          	and    %ch,%fs:0x6f(%rbp)
+  802d11:	64 65 0a 00          	fs or  %gs:(%rax),%al
+  802d15:	5b                   	pop    %rbx
+  802d16:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  802d1b:	20 77 72             	and    %dh,0x72(%rdi)
+  802d1e:	69 74 65 20 25 64 20 	imul   $0x2d206425,0x20(%rbp,%riz,2),%esi
+  802d25:	2d 
+  802d26:	2d 20 62 61 64       	sub    $0x64616220,%eax
+  802d2b:	20 6d 6f             	and    %ch,0x6f(%rbp)
+  802d2e:	64 65 0a 00          	fs or  %gs:(%rax),%al
+  802d32:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  802d39:	00 00 00 
+  802d3c:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000802d40 <devtab>:
+  802d40:	20 40 80 00 00 00 00 00 60 40 80 00 00 00 00 00      @......`@......
+  802d50:	a0 40 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .@..............
+  802d60:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  802d70:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  802d80:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  802d90:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  802da0:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  802db0:	3d 20 32 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73 00     = 2.<cons>.cons.
+  802dc0:	5b 25 30 38 78 5d 20 75 73 65 72 20 70 61 6e 69     [%08x] user pani
+  802dd0:	63 20 69 6e 20 25 73 20 61 74 20 25 73 3a 25 64     c in %s at %s:%d
+  802de0:	3a 20 00 30 31 32 33 34 35 36 37 38 39 41 42 43     : .0123456789ABC
+  802df0:	44 45 46 00 30 31 32 33 34 35 36 37 38 39 61 62     DEF.0123456789ab
+  802e00:	63 64 65 66 00 28 6e 75 6c 6c 29 00 65 72 72 6f     cdef.(null).erro
+  802e10:	72 20 25 64 00 75 6e 73 70 65 63 69 66 69 65 64     r %d.unspecified
+  802e20:	20 65 72 72 6f 72 00 62 61 64 20 65 6e 76 69 72      error.bad envir
+  802e30:	6f 6e 6d 65 6e 74 00 69 6e 76 61 6c 69 64 20 70     onment.invalid p
+  802e40:	61 72 61 6d 65 74 65 72 00 6f 75 74 20 6f 66 20     arameter.out of 
+  802e50:	6d 65 6d 6f 72 79 00 6f 75 74 20 6f 66 20 65 6e     memory.out of en
+  802e60:	76 69 72 6f 6e 6d 65 6e 74 73 00 63 6f 72 72 75     vironments.corru
+  802e70:	70 74 65 64 20 64 65 62 75 67 20 69 6e 66 6f 00     pted debug info.
+  802e80:	73 65 67 6d 65 6e 74 61 74 69 6f 6e 20 66 61 75     segmentation fau
+  802e90:	6c 74 00 69 6e 76 61 6c 69 64 20 45 4c 46 20 69     lt.invalid ELF i
+  802ea0:	6d 61 67 65 00 6e 6f 20 73 75 63 68 20 73 79 73     mage.no such sys
+  802eb0:	74 65 6d 20 63 61 6c 6c 00 65 6e 74 72 79 20 6e     tem call.entry n
+  802ec0:	6f 74 20 66 6f 75 6e 64 00 65 6e 76 20 69 73 20     ot found.env is 
+  802ed0:	6e 6f 74 20 72 65 63 76 69 6e 67 00 75 6e 65 78     not recving.unex
+  802ee0:	70 65 63 74 65 64 20 65 6e 64 20 6f 66 20 66 69     pected end of fi
+  802ef0:	6c 65 00 6e 6f 20 66 72 65 65 20 73 70 61 63 65     le.no free space
+  802f00:	20 6f 6e 20 64 69 73 6b 00 74 6f 6f 20 6d 61 6e      on disk.too man
+  802f10:	79 20 66 69 6c 65 73 20 61 72 65 20 6f 70 65 6e     y files are open
+  802f20:	00 66 69 6c 65 20 6f 72 20 62 6c 6f 63 6b 20 6e     .file or block n
+  802f30:	6f 74 20 66 6f 75 6e 64 00 69 6e 76 61 6c 69 64     ot found.invalid
+  802f40:	20 70 61 74 68 00 66 69 6c 65 20 61 6c 72 65 61      path.file alrea
+  802f50:	64 79 20 65 78 69 73 74 73 00 6f 70 65 72 61 74     dy exists.operat
+  802f60:	69 6f 6e 20 6e 6f 74 20 73 75 70 70 6f 72 74 65     ion not supporte
+  802f70:	64 00 6f 70 65 72 61 74 69 6f 6e 20 69 6e 74 65     d.operation inte
+  802f80:	72 72 75 70 74 65 64 00 6e 6f 74 20 65 6e 6f 75     rrupted.not enou
+  802f90:	67 68 20 43 50 55 20 74 69 6d 65 00 0f 1f 40 00     gh CPU time...@.
+  802fa0:	4a 1f 80 00 00 00 00 00 8b 25 80 00 00 00 00 00     J........%......
+  802fb0:	7b 25 80 00 00 00 00 00 8b 25 80 00 00 00 00 00     {%.......%......
+  802fc0:	8b 25 80 00 00 00 00 00 8b 25 80 00 00 00 00 00     .%.......%......
+  802fd0:	8b 25 80 00 00 00 00 00 69 1f 80 00 00 00 00 00     .%......i.......
+  802fe0:	8b 25 80 00 00 00 00 00 8b 25 80 00 00 00 00 00     .%.......%......
+  802ff0:	5d 1f 80 00 00 00 00 00 d7 1f 80 00 00 00 00 00     ]...............
+  803000:	8b 25 80 00 00 00 00 00 5d 1f 80 00 00 00 00 00     .%......].......
+  803010:	a3 1f 80 00 00 00 00 00 a3 1f 80 00 00 00 00 00     ................
+  803020:	a3 1f 80 00 00 00 00 00 a3 1f 80 00 00 00 00 00     ................
+  803030:	a3 1f 80 00 00 00 00 00 a3 1f 80 00 00 00 00 00     ................
+  803040:	a3 1f 80 00 00 00 00 00 a3 1f 80 00 00 00 00 00     ................
+  803050:	a3 1f 80 00 00 00 00 00 8b 25 80 00 00 00 00 00     .........%......
+  803060:	8b 25 80 00 00 00 00 00 8b 25 80 00 00 00 00 00     .%.......%......
+  803070:	8b 25 80 00 00 00 00 00 8b 25 80 00 00 00 00 00     .%.......%......
+  803080:	8b 25 80 00 00 00 00 00 8b 25 80 00 00 00 00 00     .%.......%......
+  803090:	8b 25 80 00 00 00 00 00 8b 25 80 00 00 00 00 00     .%.......%......
+  8030a0:	8b 25 80 00 00 00 00 00 8b 25 80 00 00 00 00 00     .%.......%......
+  8030b0:	8b 25 80 00 00 00 00 00 8b 25 80 00 00 00 00 00     .%.......%......
+  8030c0:	8b 25 80 00 00 00 00 00 8b 25 80 00 00 00 00 00     .%.......%......
+  8030d0:	8b 25 80 00 00 00 00 00 8b 25 80 00 00 00 00 00     .%.......%......
+  8030e0:	8b 25 80 00 00 00 00 00 8b 25 80 00 00 00 00 00     .%.......%......
+  8030f0:	8b 25 80 00 00 00 00 00 8b 25 80 00 00 00 00 00     .%.......%......
+  803100:	8b 25 80 00 00 00 00 00 8b 25 80 00 00 00 00 00     .%.......%......
+  803110:	8b 25 80 00 00 00 00 00 8b 25 80 00 00 00 00 00     .%.......%......
+  803120:	8b 25 80 00 00 00 00 00 8b 25 80 00 00 00 00 00     .%.......%......
+  803130:	8b 25 80 00 00 00 00 00 8b 25 80 00 00 00 00 00     .%.......%......
+  803140:	8b 25 80 00 00 00 00 00 ae 24 80 00 00 00 00 00     .%.......$......
+  803150:	8b 25 80 00 00 00 00 00 8b 25 80 00 00 00 00 00     .%.......%......
+  803160:	8b 25 80 00 00 00 00 00 8b 25 80 00 00 00 00 00     .%.......%......
+  803170:	8b 25 80 00 00 00 00 00 8b 25 80 00 00 00 00 00     .%.......%......
+  803180:	8b 25 80 00 00 00 00 00 8b 25 80 00 00 00 00 00     .%.......%......
+  803190:	8b 25 80 00 00 00 00 00 8b 25 80 00 00 00 00 00     .%.......%......
+  8031a0:	fa 1f 80 00 00 00 00 00 c9 21 80 00 00 00 00 00     .........!......
+  8031b0:	8b 25 80 00 00 00 00 00 8b 25 80 00 00 00 00 00     .%.......%......
+  8031c0:	8b 25 80 00 00 00 00 00 8b 25 80 00 00 00 00 00     .%.......%......
+  8031d0:	29 20 80 00 00 00 00 00 8b 25 80 00 00 00 00 00     ) .......%......
+  8031e0:	8b 25 80 00 00 00 00 00 ef 1f 80 00 00 00 00 00     .%..............
+  8031f0:	8b 25 80 00 00 00 00 00 8b 25 80 00 00 00 00 00     .%.......%......
+  803200:	71 23 80 00 00 00 00 00 3b 24 80 00 00 00 00 00     q#......;$......
+  803210:	8b 25 80 00 00 00 00 00 8b 25 80 00 00 00 00 00     .%.......%......
+  803220:	c0 20 80 00 00 00 00 00 8b 25 80 00 00 00 00 00     . .......%......
+  803230:	9d 22 80 00 00 00 00 00 8b 25 80 00 00 00 00 00     .".......%......
+  803240:	8b 25 80 00 00 00 00 00 ae 24 80 00 00 00 00 00     .%.......$......
+  803250:	8b 25 80 00 00 00 00 00 53 1f 80 00 00 00 00 00     .%......S.......
+
+0000000000803260 <error_string>:
+	...
+  803268:	15 2e 80 00 00 00 00 00 27 2e 80 00 00 00 00 00     ........'.......
+  803278:	37 2e 80 00 00 00 00 00 49 2e 80 00 00 00 00 00     7.......I.......
+  803288:	57 2e 80 00 00 00 00 00 6b 2e 80 00 00 00 00 00     W.......k.......
+  803298:	80 2e 80 00 00 00 00 00 93 2e 80 00 00 00 00 00     ................
+  8032a8:	a5 2e 80 00 00 00 00 00 b9 2e 80 00 00 00 00 00     ................
+  8032b8:	c9 2e 80 00 00 00 00 00 dc 2e 80 00 00 00 00 00     ................
+  8032c8:	f3 2e 80 00 00 00 00 00 09 2f 80 00 00 00 00 00     ........./......
+  8032d8:	21 2f 80 00 00 00 00 00 39 2f 80 00 00 00 00 00     !/......9/......
+  8032e8:	46 2f 80 00 00 00 00 00 10 33 80 00 00 00 00 00     F/.......3......
+  8032f8:	5a 2f 80 00 00 00 00 00 72 2f 80 00 00 00 00 00     Z/......r/......
+  803308:	88 2f 80 00 00 00 00 00 66 69 6c 65 20 69 73 20     ./......file is 
+  803318:	6e 6f 74 20 61 20 76 61 6c 69 64 20 65 78 65 63     not a valid exec
+  803328:	75 74 61 62 6c 65 00 73 79 73 5f 69 70 63 5f 74     utable.sys_ipc_t
+  803338:	72 79 5f 73 65 6e 64 20 66 61 69 6c 65 64 3a 20     ry_send failed: 
+  803348:	25 69 00 6c 69 62 2f 69 70 63 2e 63 00 66 2e 0f     %i.lib/ipc.c.f..
+  803358:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803368:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803378:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803388:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803398:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8033a8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8033b8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8033c8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8033d8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8033e8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8033f8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803408:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803418:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803428:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803438:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803448:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803458:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803468:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803478:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803488:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803498:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8034a8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8034b8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8034c8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8034d8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8034e8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8034f8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803508:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803518:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803528:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803538:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803548:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803558:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803568:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803578:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803588:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803598:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8035a8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8035b8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8035c8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8035d8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8035e8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8035f8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803608:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803618:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803628:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803638:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803648:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803658:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803668:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803678:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803688:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803698:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8036a8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8036b8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8036c8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8036d8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8036e8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8036f8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803708:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803718:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803728:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803738:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803748:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803758:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803768:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803778:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803788:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803798:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8037a8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8037b8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8037c8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8037d8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8037e8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8037f8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803808:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803818:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803828:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803838:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803848:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803858:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803868:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803878:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803888:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803898:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8038a8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8038b8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8038c8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8038d8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8038e8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8038f8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803908:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803918:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803928:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803938:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803948:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803958:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803968:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803978:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803988:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803998:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8039a8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8039b8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8039c8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8039d8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8039e8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8039f8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803a08:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803a18:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803a28:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803a38:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803a48:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803a58:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803a68:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803a78:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803a88:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803a98:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803aa8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803ab8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803ac8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803ad8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803ae8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803af8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803b08:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803b18:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803b28:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803b38:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803b48:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803b58:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803b68:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803b78:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803b88:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803b98:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803ba8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803bb8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803bc8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803bd8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803be8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803bf8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803c08:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803c18:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803c28:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803c38:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803c48:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803c58:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803c68:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803c78:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803c88:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803c98:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803ca8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803cb8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803cc8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803cd8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803ce8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803cf8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803d08:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803d18:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803d28:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803d38:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803d48:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803d58:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803d68:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803d78:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803d88:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803d98:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803da8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803db8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803dc8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803dd8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803de8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803df8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803e08:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803e18:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803e28:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803e38:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803e48:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803e58:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803e68:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803e78:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803e88:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803e98:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803ea8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803eb8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803ec8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803ed8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803ee8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803ef8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803f08:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803f18:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803f28:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803f38:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803f48:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803f58:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803f68:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803f78:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803f88:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803f98:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803fa8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803fb8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803fc8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803fd8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803fe8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803ff8:	00 00 00 00 00 0f 1f 00                             ........
@@ -0,0 +1,5442 @@
+
+obj/user/buggyhello:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 1e 00 00 00       	call   800041 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+ * kernel should destroy user environment in response */
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+    sys_cputs((char *)1, 1);
+  800029:	be 01 00 00 00       	mov    $0x1,%esi
+  80002e:	bf 01 00 00 00       	mov    $0x1,%edi
+  800033:	48 b8 0d 01 80 00 00 	movabs $0x80010d,%rax
+  80003a:	00 00 00 
+  80003d:	ff d0                	call   *%rax
+}
+  80003f:	5d                   	pop    %rbp
+  800040:	c3                   	ret
+
+0000000000800041 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800041:	55                   	push   %rbp
+  800042:	48 89 e5             	mov    %rsp,%rbp
+  800045:	41 56                	push   %r14
+  800047:	41 55                	push   %r13
+  800049:	41 54                	push   %r12
+  80004b:	53                   	push   %rbx
+  80004c:	41 89 fd             	mov    %edi,%r13d
+  80004f:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800052:	48 ba d8 40 80 00 00 	movabs $0x8040d8,%rdx
+  800059:	00 00 00 
+  80005c:	48 b8 d8 40 80 00 00 	movabs $0x8040d8,%rax
+  800063:	00 00 00 
+  800066:	48 39 c2             	cmp    %rax,%rdx
+  800069:	73 17                	jae    800082 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  80006b:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  80006e:	49 89 c4             	mov    %rax,%r12
+  800071:	48 83 c3 08          	add    $0x8,%rbx
+  800075:	b8 00 00 00 00       	mov    $0x0,%eax
+  80007a:	ff 53 f8             	call   *-0x8(%rbx)
+  80007d:	4c 39 e3             	cmp    %r12,%rbx
+  800080:	72 ef                	jb     800071 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+    envid_t this_env_id = sys_getenvid();
+  800082:	48 b8 d6 01 80 00 00 	movabs $0x8001d6,%rax
+  800089:	00 00 00 
+  80008c:	ff d0                	call   *%rax
+    thisenv = &((struct Env*)UENVS)[ENVX(this_env_id)];
+  80008e:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800093:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+  80009a:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8000a1:	00 00 00 
+  8000a4:	48 01 d0             	add    %rdx,%rax
+  8000a7:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  8000ae:	00 00 00 
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8000b1:	45 85 ed             	test   %r13d,%r13d
+  8000b4:	7e 0d                	jle    8000c3 <libmain+0x82>
+  8000b6:	49 8b 06             	mov    (%r14),%rax
+  8000b9:	48 a3 00 40 80 00 00 	movabs %rax,0x804000
+  8000c0:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8000c3:	4c 89 f6             	mov    %r14,%rsi
+  8000c6:	44 89 ef             	mov    %r13d,%edi
+  8000c9:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8000d0:	00 00 00 
+  8000d3:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8000d5:	48 b8 ea 00 80 00 00 	movabs $0x8000ea,%rax
+  8000dc:	00 00 00 
+  8000df:	ff d0                	call   *%rax
+#endif
+}
+  8000e1:	5b                   	pop    %rbx
+  8000e2:	41 5c                	pop    %r12
+  8000e4:	41 5d                	pop    %r13
+  8000e6:	41 5e                	pop    %r14
+  8000e8:	5d                   	pop    %rbp
+  8000e9:	c3                   	ret
+
+00000000008000ea <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8000ea:	55                   	push   %rbp
+  8000eb:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  8000ee:	48 b8 2a 09 80 00 00 	movabs $0x80092a,%rax
+  8000f5:	00 00 00 
+  8000f8:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  8000fa:	bf 00 00 00 00       	mov    $0x0,%edi
+  8000ff:	48 b8 6b 01 80 00 00 	movabs $0x80016b,%rax
+  800106:	00 00 00 
+  800109:	ff d0                	call   *%rax
+}
+  80010b:	5d                   	pop    %rbp
+  80010c:	c3                   	ret
+
+000000000080010d <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  80010d:	55                   	push   %rbp
+  80010e:	48 89 e5             	mov    %rsp,%rbp
+  800111:	53                   	push   %rbx
+  800112:	48 89 fa             	mov    %rdi,%rdx
+  800115:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  800118:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80011d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800122:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800127:	be 00 00 00 00       	mov    $0x0,%esi
+  80012c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800132:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  800134:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800138:	c9                   	leave
+  800139:	c3                   	ret
+
+000000000080013a <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  80013a:	55                   	push   %rbp
+  80013b:	48 89 e5             	mov    %rsp,%rbp
+  80013e:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80013f:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800144:	ba 00 00 00 00       	mov    $0x0,%edx
+  800149:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80014e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800153:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800158:	be 00 00 00 00       	mov    $0x0,%esi
+  80015d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800163:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  800165:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800169:	c9                   	leave
+  80016a:	c3                   	ret
+
+000000000080016b <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  80016b:	55                   	push   %rbp
+  80016c:	48 89 e5             	mov    %rsp,%rbp
+  80016f:	53                   	push   %rbx
+  800170:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  800174:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800177:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80017c:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800181:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800186:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80018b:	be 00 00 00 00       	mov    $0x0,%esi
+  800190:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800196:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800198:	48 85 c0             	test   %rax,%rax
+  80019b:	7f 06                	jg     8001a3 <sys_env_destroy+0x38>
+}
+  80019d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8001a1:	c9                   	leave
+  8001a2:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8001a3:	49 89 c0             	mov    %rax,%r8
+  8001a6:	b9 03 00 00 00       	mov    $0x3,%ecx
+  8001ab:	48 ba a0 2c 80 00 00 	movabs $0x802ca0,%rdx
+  8001b2:	00 00 00 
+  8001b5:	be 26 00 00 00       	mov    $0x26,%esi
+  8001ba:	48 bf bf 2c 80 00 00 	movabs $0x802cbf,%rdi
+  8001c1:	00 00 00 
+  8001c4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001c9:	49 b9 27 1c 80 00 00 	movabs $0x801c27,%r9
+  8001d0:	00 00 00 
+  8001d3:	41 ff d1             	call   *%r9
+
+00000000008001d6 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  8001d6:	55                   	push   %rbp
+  8001d7:	48 89 e5             	mov    %rsp,%rbp
+  8001da:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8001db:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8001e0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8001e5:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8001ea:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8001ef:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8001f4:	be 00 00 00 00       	mov    $0x0,%esi
+  8001f9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8001ff:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  800201:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800205:	c9                   	leave
+  800206:	c3                   	ret
+
+0000000000800207 <sys_yield>:
+
+void
+sys_yield(void) {
+  800207:	55                   	push   %rbp
+  800208:	48 89 e5             	mov    %rsp,%rbp
+  80020b:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80020c:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800211:	ba 00 00 00 00       	mov    $0x0,%edx
+  800216:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80021b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800220:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800225:	be 00 00 00 00       	mov    $0x0,%esi
+  80022a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800230:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  800232:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800236:	c9                   	leave
+  800237:	c3                   	ret
+
+0000000000800238 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  800238:	55                   	push   %rbp
+  800239:	48 89 e5             	mov    %rsp,%rbp
+  80023c:	53                   	push   %rbx
+  80023d:	48 89 fa             	mov    %rdi,%rdx
+  800240:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  800243:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800248:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  80024f:	00 00 00 
+  800252:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800257:	be 00 00 00 00       	mov    $0x0,%esi
+  80025c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800262:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  800264:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800268:	c9                   	leave
+  800269:	c3                   	ret
+
+000000000080026a <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  80026a:	55                   	push   %rbp
+  80026b:	48 89 e5             	mov    %rsp,%rbp
+  80026e:	53                   	push   %rbx
+  80026f:	49 89 f8             	mov    %rdi,%r8
+  800272:	48 89 d3             	mov    %rdx,%rbx
+  800275:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  800278:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80027d:	4c 89 c2             	mov    %r8,%rdx
+  800280:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800283:	be 00 00 00 00       	mov    $0x0,%esi
+  800288:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80028e:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  800290:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800294:	c9                   	leave
+  800295:	c3                   	ret
+
+0000000000800296 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  800296:	55                   	push   %rbp
+  800297:	48 89 e5             	mov    %rsp,%rbp
+  80029a:	53                   	push   %rbx
+  80029b:	48 83 ec 08          	sub    $0x8,%rsp
+  80029f:	89 f8                	mov    %edi,%eax
+  8002a1:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  8002a4:	48 63 f9             	movslq %ecx,%rdi
+  8002a7:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8002aa:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8002af:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8002b2:	be 00 00 00 00       	mov    $0x0,%esi
+  8002b7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8002bd:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8002bf:	48 85 c0             	test   %rax,%rax
+  8002c2:	7f 06                	jg     8002ca <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  8002c4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8002c8:	c9                   	leave
+  8002c9:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8002ca:	49 89 c0             	mov    %rax,%r8
+  8002cd:	b9 04 00 00 00       	mov    $0x4,%ecx
+  8002d2:	48 ba a0 2c 80 00 00 	movabs $0x802ca0,%rdx
+  8002d9:	00 00 00 
+  8002dc:	be 26 00 00 00       	mov    $0x26,%esi
+  8002e1:	48 bf bf 2c 80 00 00 	movabs $0x802cbf,%rdi
+  8002e8:	00 00 00 
+  8002eb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002f0:	49 b9 27 1c 80 00 00 	movabs $0x801c27,%r9
+  8002f7:	00 00 00 
+  8002fa:	41 ff d1             	call   *%r9
+
+00000000008002fd <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8002fd:	55                   	push   %rbp
+  8002fe:	48 89 e5             	mov    %rsp,%rbp
+  800301:	53                   	push   %rbx
+  800302:	48 83 ec 08          	sub    $0x8,%rsp
+  800306:	89 f8                	mov    %edi,%eax
+  800308:	49 89 f2             	mov    %rsi,%r10
+  80030b:	48 89 cf             	mov    %rcx,%rdi
+  80030e:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  800311:	48 63 da             	movslq %edx,%rbx
+  800314:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800317:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80031c:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80031f:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  800322:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800324:	48 85 c0             	test   %rax,%rax
+  800327:	7f 06                	jg     80032f <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  800329:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80032d:	c9                   	leave
+  80032e:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80032f:	49 89 c0             	mov    %rax,%r8
+  800332:	b9 05 00 00 00       	mov    $0x5,%ecx
+  800337:	48 ba a0 2c 80 00 00 	movabs $0x802ca0,%rdx
+  80033e:	00 00 00 
+  800341:	be 26 00 00 00       	mov    $0x26,%esi
+  800346:	48 bf bf 2c 80 00 00 	movabs $0x802cbf,%rdi
+  80034d:	00 00 00 
+  800350:	b8 00 00 00 00       	mov    $0x0,%eax
+  800355:	49 b9 27 1c 80 00 00 	movabs $0x801c27,%r9
+  80035c:	00 00 00 
+  80035f:	41 ff d1             	call   *%r9
+
+0000000000800362 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  800362:	55                   	push   %rbp
+  800363:	48 89 e5             	mov    %rsp,%rbp
+  800366:	53                   	push   %rbx
+  800367:	48 83 ec 08          	sub    $0x8,%rsp
+  80036b:	48 89 f1             	mov    %rsi,%rcx
+  80036e:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  800371:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800374:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800379:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80037e:	be 00 00 00 00       	mov    $0x0,%esi
+  800383:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800389:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80038b:	48 85 c0             	test   %rax,%rax
+  80038e:	7f 06                	jg     800396 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  800390:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800394:	c9                   	leave
+  800395:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800396:	49 89 c0             	mov    %rax,%r8
+  800399:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80039e:	48 ba a0 2c 80 00 00 	movabs $0x802ca0,%rdx
+  8003a5:	00 00 00 
+  8003a8:	be 26 00 00 00       	mov    $0x26,%esi
+  8003ad:	48 bf bf 2c 80 00 00 	movabs $0x802cbf,%rdi
+  8003b4:	00 00 00 
+  8003b7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003bc:	49 b9 27 1c 80 00 00 	movabs $0x801c27,%r9
+  8003c3:	00 00 00 
+  8003c6:	41 ff d1             	call   *%r9
+
+00000000008003c9 <sys_region_batch>:
+
+int
+sys_region_batch(const struct RegionOp *ops, size_t count) {
+  8003c9:	55                   	push   %rbp
+  8003ca:	48 89 e5             	mov    %rsp,%rbp
+  8003cd:	53                   	push   %rbx
+  8003ce:	48 83 ec 08          	sub    $0x8,%rsp
+  8003d2:	48 89 fa             	mov    %rdi,%rdx
+  8003d5:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8003d8:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8003dd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8003e2:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8003e7:	be 00 00 00 00       	mov    $0x0,%esi
+  8003ec:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8003f2:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8003f4:	48 85 c0             	test   %rax,%rax
+  8003f7:	7f 06                	jg     8003ff <sys_region_batch+0x36>
+        else
+            platform_asan_unpoison(va, ops[i].size);
+    }
+#endif
+    return res;
+}
+  8003f9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8003fd:	c9                   	leave
+  8003fe:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8003ff:	49 89 c0             	mov    %rax,%r8
+  800402:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  800407:	48 ba a0 2c 80 00 00 	movabs $0x802ca0,%rdx
+  80040e:	00 00 00 
+  800411:	be 26 00 00 00       	mov    $0x26,%esi
+  800416:	48 bf bf 2c 80 00 00 	movabs $0x802cbf,%rdi
+  80041d:	00 00 00 
+  800420:	b8 00 00 00 00       	mov    $0x0,%eax
+  800425:	49 b9 27 1c 80 00 00 	movabs $0x801c27,%r9
+  80042c:	00 00 00 
+  80042f:	41 ff d1             	call   *%r9
+
+0000000000800432 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  800432:	55                   	push   %rbp
+  800433:	48 89 e5             	mov    %rsp,%rbp
+  800436:	53                   	push   %rbx
+  800437:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  80043b:	48 63 ce             	movslq %esi,%rcx
+  80043e:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800441:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800446:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80044b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800450:	be 00 00 00 00       	mov    $0x0,%esi
+  800455:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80045b:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80045d:	48 85 c0             	test   %rax,%rax
+  800460:	7f 06                	jg     800468 <sys_env_set_status+0x36>
+}
+  800462:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800466:	c9                   	leave
+  800467:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800468:	49 89 c0             	mov    %rax,%r8
+  80046b:	b9 09 00 00 00       	mov    $0x9,%ecx
+  800470:	48 ba a0 2c 80 00 00 	movabs $0x802ca0,%rdx
+  800477:	00 00 00 
+  80047a:	be 26 00 00 00       	mov    $0x26,%esi
+  80047f:	48 bf bf 2c 80 00 00 	movabs $0x802cbf,%rdi
+  800486:	00 00 00 
+  800489:	b8 00 00 00 00       	mov    $0x0,%eax
+  80048e:	49 b9 27 1c 80 00 00 	movabs $0x801c27,%r9
+  800495:	00 00 00 
+  800498:	41 ff d1             	call   *%r9
+
+000000000080049b <sys_env_set_weight>:
+
+int
+sys_env_set_weight(envid_t envid, uint32_t weight) {
+  80049b:	55                   	push   %rbp
+  80049c:	48 89 e5             	mov    %rsp,%rbp
+  80049f:	53                   	push   %rbx
+  8004a0:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_weight, 1, envid, weight, 0, 0, 0, 0);
+  8004a4:	89 f1                	mov    %esi,%ecx
+  8004a6:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8004a9:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8004ae:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8004b3:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8004b8:	be 00 00 00 00       	mov    $0x0,%esi
+  8004bd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8004c3:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8004c5:	48 85 c0             	test   %rax,%rax
+  8004c8:	7f 06                	jg     8004d0 <sys_env_set_weight+0x35>
+}
+  8004ca:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8004ce:	c9                   	leave
+  8004cf:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8004d0:	49 89 c0             	mov    %rax,%r8
+  8004d3:	b9 10 00 00 00       	mov    $0x10,%ecx
+  8004d8:	48 ba a0 2c 80 00 00 	movabs $0x802ca0,%rdx
+  8004df:	00 00 00 
+  8004e2:	be 26 00 00 00       	mov    $0x26,%esi
+  8004e7:	48 bf bf 2c 80 00 00 	movabs $0x802cbf,%rdi
+  8004ee:	00 00 00 
+  8004f1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004f6:	49 b9 27 1c 80 00 00 	movabs $0x801c27,%r9
+  8004fd:	00 00 00 
+  800500:	41 ff d1             	call   *%r9
+
+0000000000800503 <sys_env_set_rt>:
+
+int
+sys_env_set_rt(envid_t envid, uint64_t period, uint64_t budget, uint64_t deadline) {
+  800503:	55                   	push   %rbp
+  800504:	48 89 e5             	mov    %rsp,%rbp
+  800507:	53                   	push   %rbx
+  800508:	48 83 ec 08          	sub    $0x8,%rsp
+  80050c:	89 f8                	mov    %edi,%eax
+  80050e:	48 89 d3             	mov    %rdx,%rbx
+  800511:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_env_set_rt, 1, envid, period, budget, deadline, 0, 0);
+  800514:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800517:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80051c:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80051f:	be 00 00 00 00       	mov    $0x0,%esi
+  800524:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80052a:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80052c:	48 85 c0             	test   %rax,%rax
+  80052f:	7f 06                	jg     800537 <sys_env_set_rt+0x34>
+}
+  800531:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800535:	c9                   	leave
+  800536:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800537:	49 89 c0             	mov    %rax,%r8
+  80053a:	b9 11 00 00 00       	mov    $0x11,%ecx
+  80053f:	48 ba a0 2c 80 00 00 	movabs $0x802ca0,%rdx
+  800546:	00 00 00 
+  800549:	be 26 00 00 00       	mov    $0x26,%esi
+  80054e:	48 bf bf 2c 80 00 00 	movabs $0x802cbf,%rdi
+  800555:	00 00 00 
+  800558:	b8 00 00 00 00       	mov    $0x0,%eax
+  80055d:	49 b9 27 1c 80 00 00 	movabs $0x801c27,%r9
+  800564:	00 00 00 
+  800567:	41 ff d1             	call   *%r9
+
+000000000080056a <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  80056a:	55                   	push   %rbp
+  80056b:	48 89 e5             	mov    %rsp,%rbp
+  80056e:	53                   	push   %rbx
+  80056f:	48 83 ec 08          	sub    $0x8,%rsp
+  800573:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  800576:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800579:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80057e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800583:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800588:	be 00 00 00 00       	mov    $0x0,%esi
+  80058d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800593:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800595:	48 85 c0             	test   %rax,%rax
+  800598:	7f 06                	jg     8005a0 <sys_env_set_trapframe+0x36>
+}
+  80059a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80059e:	c9                   	leave
+  80059f:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8005a0:	49 89 c0             	mov    %rax,%r8
+  8005a3:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  8005a8:	48 ba a0 2c 80 00 00 	movabs $0x802ca0,%rdx
+  8005af:	00 00 00 
+  8005b2:	be 26 00 00 00       	mov    $0x26,%esi
+  8005b7:	48 bf bf 2c 80 00 00 	movabs $0x802cbf,%rdi
+  8005be:	00 00 00 
+  8005c1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005c6:	49 b9 27 1c 80 00 00 	movabs $0x801c27,%r9
+  8005cd:	00 00 00 
+  8005d0:	41 ff d1             	call   *%r9
+
+00000000008005d3 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  8005d3:	55                   	push   %rbp
+  8005d4:	48 89 e5             	mov    %rsp,%rbp
+  8005d7:	53                   	push   %rbx
+  8005d8:	48 83 ec 08          	sub    $0x8,%rsp
+  8005dc:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  8005df:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8005e2:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8005e7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8005ec:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8005f1:	be 00 00 00 00       	mov    $0x0,%esi
+  8005f6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8005fc:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8005fe:	48 85 c0             	test   %rax,%rax
+  800601:	7f 06                	jg     800609 <sys_env_set_pgfault_upcall+0x36>
+}
+  800603:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800607:	c9                   	leave
+  800608:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800609:	49 89 c0             	mov    %rax,%r8
+  80060c:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  800611:	48 ba a0 2c 80 00 00 	movabs $0x802ca0,%rdx
+  800618:	00 00 00 
+  80061b:	be 26 00 00 00       	mov    $0x26,%esi
+  800620:	48 bf bf 2c 80 00 00 	movabs $0x802cbf,%rdi
+  800627:	00 00 00 
+  80062a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80062f:	49 b9 27 1c 80 00 00 	movabs $0x801c27,%r9
+  800636:	00 00 00 
+  800639:	41 ff d1             	call   *%r9
+
+000000000080063c <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  80063c:	55                   	push   %rbp
+  80063d:	48 89 e5             	mov    %rsp,%rbp
+  800640:	53                   	push   %rbx
+  800641:	89 f8                	mov    %edi,%eax
+  800643:	49 89 f1             	mov    %rsi,%r9
+  800646:	48 89 d3             	mov    %rdx,%rbx
+  800649:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  80064c:	49 63 f0             	movslq %r8d,%rsi
+  80064f:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800652:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800657:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80065a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800660:	cd 30                	int    $0x30
+}
+  800662:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800666:	c9                   	leave
+  800667:	c3                   	ret
+
+0000000000800668 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  800668:	55                   	push   %rbp
+  800669:	48 89 e5             	mov    %rsp,%rbp
+  80066c:	53                   	push   %rbx
+  80066d:	48 83 ec 08          	sub    $0x8,%rsp
+  800671:	48 89 fa             	mov    %rdi,%rdx
+  800674:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  800677:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80067c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800681:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800686:	be 00 00 00 00       	mov    $0x0,%esi
+  80068b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800691:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800693:	48 85 c0             	test   %rax,%rax
+  800696:	7f 06                	jg     80069e <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  800698:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80069c:	c9                   	leave
+  80069d:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80069e:	49 89 c0             	mov    %rax,%r8
+  8006a1:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  8006a6:	48 ba a0 2c 80 00 00 	movabs $0x802ca0,%rdx
+  8006ad:	00 00 00 
+  8006b0:	be 26 00 00 00       	mov    $0x26,%esi
+  8006b5:	48 bf bf 2c 80 00 00 	movabs $0x802cbf,%rdi
+  8006bc:	00 00 00 
+  8006bf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006c4:	49 b9 27 1c 80 00 00 	movabs $0x801c27,%r9
+  8006cb:	00 00 00 
+  8006ce:	41 ff d1             	call   *%r9
+
+00000000008006d1 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8006d1:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8006d8:	ff ff ff 
+  8006db:	48 01 f8             	add    %rdi,%rax
+  8006de:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  8006e2:	c3                   	ret
+
+00000000008006e3 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8006e3:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8006ea:	ff ff ff 
+  8006ed:	48 01 f8             	add    %rdi,%rax
+  8006f0:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  8006f4:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  8006fa:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  8006fe:	c3                   	ret
+
+00000000008006ff <fd_alloc_from>:
+}
+
+/* Like fd_alloc(), but only considers fds starting from fdnum,
+ * so that several fds can be found before their pages are allocated */
+int
+fd_alloc_from(int fdnum, struct Fd **fd_store) {
+  8006ff:	55                   	push   %rbp
+  800700:	48 89 e5             	mov    %rsp,%rbp
+  800703:	41 57                	push   %r15
+  800705:	41 56                	push   %r14
+  800707:	41 55                	push   %r13
+  800709:	41 54                	push   %r12
+  80070b:	53                   	push   %rbx
+  80070c:	48 83 ec 08          	sub    $0x8,%rsp
+  800710:	49 89 f7             	mov    %rsi,%r15
+    for (int i = MAX(fdnum, 0); i < MAXFD; i++) {
+  800713:	85 ff                	test   %edi,%edi
+  800715:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80071b:	44 0f 49 e7          	cmovns %edi,%r12d
+  80071f:	83 ff 1f             	cmp    $0x1f,%edi
+  800722:	7f 37                	jg     80075b <fd_alloc_from+0x5c>
+  800724:	49 63 dc             	movslq %r12d,%rbx
+  800727:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  80072e:	48 c1 e3 0c          	shl    $0xc,%rbx
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  800732:	49 be 08 18 80 00 00 	movabs $0x801808,%r14
+  800739:	00 00 00 
+        struct Fd *fd = INDEX2FD(i);
+  80073c:	49 89 dd             	mov    %rbx,%r13
+        if (!(get_prot(fd) & PROT_R)) {
+  80073f:	48 89 df             	mov    %rbx,%rdi
+  800742:	41 ff d6             	call   *%r14
+  800745:	83 e0 04             	and    $0x4,%eax
+  800748:	74 1c                	je     800766 <fd_alloc_from+0x67>
+    for (int i = MAX(fdnum, 0); i < MAXFD; i++) {
+  80074a:	41 83 c4 01          	add    $0x1,%r12d
+  80074e:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  800755:	41 83 fc 1f          	cmp    $0x1f,%r12d
+  800759:	7e e1                	jle    80073c <fd_alloc_from+0x3d>
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  80075b:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  800761:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  800766:	4d 89 2f             	mov    %r13,(%r15)
+}
+  800769:	48 83 c4 08          	add    $0x8,%rsp
+  80076d:	5b                   	pop    %rbx
+  80076e:	41 5c                	pop    %r12
+  800770:	41 5d                	pop    %r13
+  800772:	41 5e                	pop    %r14
+  800774:	41 5f                	pop    %r15
+  800776:	5d                   	pop    %rbp
+  800777:	c3                   	ret
+
+0000000000800778 <fd_alloc>:
+fd_alloc(struct Fd **fd_store) {
+  800778:	55                   	push   %rbp
+  800779:	48 89 e5             	mov    %rsp,%rbp
+  80077c:	48 89 fe             	mov    %rdi,%rsi
+    return fd_alloc_from(0, fd_store);
+  80077f:	bf 00 00 00 00       	mov    $0x0,%edi
+  800784:	48 b8 ff 06 80 00 00 	movabs $0x8006ff,%rax
+  80078b:	00 00 00 
+  80078e:	ff d0                	call   *%rax
+}
+  800790:	5d                   	pop    %rbp
+  800791:	c3                   	ret
+
+0000000000800792 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  800792:	83 ff 1f             	cmp    $0x1f,%edi
+  800795:	77 39                	ja     8007d0 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  800797:	55                   	push   %rbp
+  800798:	48 89 e5             	mov    %rsp,%rbp
+  80079b:	41 54                	push   %r12
+  80079d:	53                   	push   %rbx
+  80079e:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  8007a1:	48 63 df             	movslq %edi,%rbx
+  8007a4:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  8007ab:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  8007af:	48 89 df             	mov    %rbx,%rdi
+  8007b2:	48 b8 08 18 80 00 00 	movabs $0x801808,%rax
+  8007b9:	00 00 00 
+  8007bc:	ff d0                	call   *%rax
+  8007be:	a8 04                	test   $0x4,%al
+  8007c0:	74 14                	je     8007d6 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  8007c2:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  8007c6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8007cb:	5b                   	pop    %rbx
+  8007cc:	41 5c                	pop    %r12
+  8007ce:	5d                   	pop    %rbp
+  8007cf:	c3                   	ret
+        return -E_INVAL;
+  8007d0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8007d5:	c3                   	ret
+        return -E_INVAL;
+  8007d6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8007db:	eb ee                	jmp    8007cb <fd_lookup+0x39>
+
+00000000008007dd <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  8007dd:	55                   	push   %rbp
+  8007de:	48 89 e5             	mov    %rsp,%rbp
+  8007e1:	41 54                	push   %r12
+  8007e3:	53                   	push   %rbx
+  8007e4:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  8007e7:	48 b8 60 2d 80 00 00 	movabs $0x802d60,%rax
+  8007ee:	00 00 00 
+  8007f1:	48 bb 20 40 80 00 00 	movabs $0x804020,%rbx
+  8007f8:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  8007fb:	39 3b                	cmp    %edi,(%rbx)
+  8007fd:	74 47                	je     800846 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  8007ff:	48 83 c0 08          	add    $0x8,%rax
+  800803:	48 8b 18             	mov    (%rax),%rbx
+  800806:	48 85 db             	test   %rbx,%rbx
+  800809:	75 f0                	jne    8007fb <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  80080b:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  800812:	00 00 00 
+  800815:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+  80081b:	89 fa                	mov    %edi,%edx
+  80081d:	48 bf d0 2c 80 00 00 	movabs $0x802cd0,%rdi
+  800824:	00 00 00 
+  800827:	b8 00 00 00 00       	mov    $0x0,%eax
+  80082c:	48 b9 77 1d 80 00 00 	movabs $0x801d77,%rcx
+  800833:	00 00 00 
+  800836:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  800838:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  80083d:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  800841:	5b                   	pop    %rbx
+  800842:	41 5c                	pop    %r12
+  800844:	5d                   	pop    %rbp
+  800845:	c3                   	ret
+            return 0;
+  800846:	b8 00 00 00 00       	mov    $0x0,%eax
+  80084b:	eb f0                	jmp    80083d <dev_lookup+0x60>
+
+000000000080084d <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  80084d:	55                   	push   %rbp
+  80084e:	48 89 e5             	mov    %rsp,%rbp
+  800851:	41 55                	push   %r13
+  800853:	41 54                	push   %r12
+  800855:	53                   	push   %rbx
+  800856:	48 83 ec 18          	sub    $0x18,%rsp
+  80085a:	48 89 fb             	mov    %rdi,%rbx
+  80085d:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  800860:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  800867:	ff ff ff 
+  80086a:	48 01 df             	add    %rbx,%rdi
+  80086d:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  800871:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800875:	48 b8 92 07 80 00 00 	movabs $0x800792,%rax
+  80087c:	00 00 00 
+  80087f:	ff d0                	call   *%rax
+  800881:	41 89 c5             	mov    %eax,%r13d
+  800884:	85 c0                	test   %eax,%eax
+  800886:	78 06                	js     80088e <fd_close+0x41>
+  800888:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  80088c:	74 1a                	je     8008a8 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  80088e:	45 84 e4             	test   %r12b,%r12b
+  800891:	b8 00 00 00 00       	mov    $0x0,%eax
+  800896:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  80089a:	44 89 e8             	mov    %r13d,%eax
+  80089d:	48 83 c4 18          	add    $0x18,%rsp
+  8008a1:	5b                   	pop    %rbx
+  8008a2:	41 5c                	pop    %r12
+  8008a4:	41 5d                	pop    %r13
+  8008a6:	5d                   	pop    %rbp
+  8008a7:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8008a8:	8b 3b                	mov    (%rbx),%edi
+  8008aa:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8008ae:	48 b8 dd 07 80 00 00 	movabs $0x8007dd,%rax
+  8008b5:	00 00 00 
+  8008b8:	ff d0                	call   *%rax
+  8008ba:	41 89 c5             	mov    %eax,%r13d
+  8008bd:	85 c0                	test   %eax,%eax
+  8008bf:	78 1b                	js     8008dc <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  8008c1:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8008c5:	48 8b 40 20          	mov    0x20(%rax),%rax
+  8008c9:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  8008cf:	48 85 c0             	test   %rax,%rax
+  8008d2:	74 08                	je     8008dc <fd_close+0x8f>
+  8008d4:	48 89 df             	mov    %rbx,%rdi
+  8008d7:	ff d0                	call   *%rax
+  8008d9:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8008dc:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8008e1:	48 89 de             	mov    %rbx,%rsi
+  8008e4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8008e9:	48 b8 62 03 80 00 00 	movabs $0x800362,%rax
+  8008f0:	00 00 00 
+  8008f3:	ff d0                	call   *%rax
+    return res;
+  8008f5:	eb a3                	jmp    80089a <fd_close+0x4d>
+
+00000000008008f7 <close>:
+
+int
+close(int fdnum) {
+  8008f7:	55                   	push   %rbp
+  8008f8:	48 89 e5             	mov    %rsp,%rbp
+  8008fb:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  8008ff:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  800903:	48 b8 92 07 80 00 00 	movabs $0x800792,%rax
+  80090a:	00 00 00 
+  80090d:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80090f:	85 c0                	test   %eax,%eax
+  800911:	78 15                	js     800928 <close+0x31>
+
+    return fd_close(fd, 1);
+  800913:	be 01 00 00 00       	mov    $0x1,%esi
+  800918:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80091c:	48 b8 4d 08 80 00 00 	movabs $0x80084d,%rax
+  800923:	00 00 00 
+  800926:	ff d0                	call   *%rax
+}
+  800928:	c9                   	leave
+  800929:	c3                   	ret
+
+000000000080092a <close_all>:
+
+void
+close_all(void) {
+  80092a:	55                   	push   %rbp
+  80092b:	48 89 e5             	mov    %rsp,%rbp
+  80092e:	41 54                	push   %r12
+  800930:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  800931:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800936:	49 bc f7 08 80 00 00 	movabs $0x8008f7,%r12
+  80093d:	00 00 00 
+  800940:	89 df                	mov    %ebx,%edi
+  800942:	41 ff d4             	call   *%r12
+  800945:	83 c3 01             	add    $0x1,%ebx
+  800948:	83 fb 20             	cmp    $0x20,%ebx
+  80094b:	75 f3                	jne    800940 <close_all+0x16>
+}
+  80094d:	5b                   	pop    %rbx
+  80094e:	41 5c                	pop    %r12
+  800950:	5d                   	pop    %rbp
+  800951:	c3                   	ret
+
+0000000000800952 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  800952:	55                   	push   %rbp
+  800953:	48 89 e5             	mov    %rsp,%rbp
+  800956:	41 57                	push   %r15
+  800958:	41 56                	push   %r14
+  80095a:	41 55                	push   %r13
+  80095c:	41 54                	push   %r12
+  80095e:	53                   	push   %rbx
+  80095f:	48 83 ec 18          	sub    $0x18,%rsp
+  800963:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  800966:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  80096a:	48 b8 92 07 80 00 00 	movabs $0x800792,%rax
+  800971:	00 00 00 
+  800974:	ff d0                	call   *%rax
+  800976:	89 c3                	mov    %eax,%ebx
+  800978:	85 c0                	test   %eax,%eax
+  80097a:	0f 88 b8 00 00 00    	js     800a38 <dup+0xe6>
+    close(newfdnum);
+  800980:	44 89 e7             	mov    %r12d,%edi
+  800983:	48 b8 f7 08 80 00 00 	movabs $0x8008f7,%rax
+  80098a:	00 00 00 
+  80098d:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  80098f:	4d 63 ec             	movslq %r12d,%r13
+  800992:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  800999:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  80099d:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  8009a1:	4c 89 ff             	mov    %r15,%rdi
+  8009a4:	49 be e3 06 80 00 00 	movabs $0x8006e3,%r14
+  8009ab:	00 00 00 
+  8009ae:	41 ff d6             	call   *%r14
+  8009b1:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  8009b4:	4c 89 ef             	mov    %r13,%rdi
+  8009b7:	41 ff d6             	call   *%r14
+  8009ba:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  8009bd:	48 89 df             	mov    %rbx,%rdi
+  8009c0:	48 b8 08 18 80 00 00 	movabs $0x801808,%rax
+  8009c7:	00 00 00 
+  8009ca:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  8009cc:	a8 04                	test   $0x4,%al
+  8009ce:	74 2b                	je     8009fb <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  8009d0:	41 89 c1             	mov    %eax,%r9d
+  8009d3:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8009d9:	4c 89 f1             	mov    %r14,%rcx
+  8009dc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8009e1:	48 89 de             	mov    %rbx,%rsi
+  8009e4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8009e9:	48 b8 fd 02 80 00 00 	movabs $0x8002fd,%rax
+  8009f0:	00 00 00 
+  8009f3:	ff d0                	call   *%rax
+  8009f5:	89 c3                	mov    %eax,%ebx
+  8009f7:	85 c0                	test   %eax,%eax
+  8009f9:	78 4e                	js     800a49 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  8009fb:	4c 89 ff             	mov    %r15,%rdi
+  8009fe:	48 b8 08 18 80 00 00 	movabs $0x801808,%rax
+  800a05:	00 00 00 
+  800a08:	ff d0                	call   *%rax
+  800a0a:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  800a0d:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  800a13:	4c 89 e9             	mov    %r13,%rcx
+  800a16:	ba 00 00 00 00       	mov    $0x0,%edx
+  800a1b:	4c 89 fe             	mov    %r15,%rsi
+  800a1e:	bf 00 00 00 00       	mov    $0x0,%edi
+  800a23:	48 b8 fd 02 80 00 00 	movabs $0x8002fd,%rax
+  800a2a:	00 00 00 
+  800a2d:	ff d0                	call   *%rax
+  800a2f:	89 c3                	mov    %eax,%ebx
+  800a31:	85 c0                	test   %eax,%eax
+  800a33:	78 14                	js     800a49 <dup+0xf7>
+
+    return newfdnum;
+  800a35:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  800a38:	89 d8                	mov    %ebx,%eax
+  800a3a:	48 83 c4 18          	add    $0x18,%rsp
+  800a3e:	5b                   	pop    %rbx
+  800a3f:	41 5c                	pop    %r12
+  800a41:	41 5d                	pop    %r13
+  800a43:	41 5e                	pop    %r14
+  800a45:	41 5f                	pop    %r15
+  800a47:	5d                   	pop    %rbp
+  800a48:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  800a49:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800a4e:	4c 89 ee             	mov    %r13,%rsi
+  800a51:	bf 00 00 00 00       	mov    $0x0,%edi
+  800a56:	49 bc 62 03 80 00 00 	movabs $0x800362,%r12
+  800a5d:	00 00 00 
+  800a60:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  800a63:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800a68:	4c 89 f6             	mov    %r14,%rsi
+  800a6b:	bf 00 00 00 00       	mov    $0x0,%edi
+  800a70:	41 ff d4             	call   *%r12
+    return res;
+  800a73:	eb c3                	jmp    800a38 <dup+0xe6>
+
+0000000000800a75 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  800a75:	55                   	push   %rbp
+  800a76:	48 89 e5             	mov    %rsp,%rbp
+  800a79:	41 56                	push   %r14
+  800a7b:	41 55                	push   %r13
+  800a7d:	41 54                	push   %r12
+  800a7f:	53                   	push   %rbx
+  800a80:	48 83 ec 10          	sub    $0x10,%rsp
+  800a84:	89 fb                	mov    %edi,%ebx
+  800a86:	49 89 f4             	mov    %rsi,%r12
+  800a89:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800a8c:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800a90:	48 b8 92 07 80 00 00 	movabs $0x800792,%rax
+  800a97:	00 00 00 
+  800a9a:	ff d0                	call   *%rax
+  800a9c:	85 c0                	test   %eax,%eax
+  800a9e:	78 4c                	js     800aec <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800aa0:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  800aa4:	41 8b 3e             	mov    (%r14),%edi
+  800aa7:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800aab:	48 b8 dd 07 80 00 00 	movabs $0x8007dd,%rax
+  800ab2:	00 00 00 
+  800ab5:	ff d0                	call   *%rax
+  800ab7:	85 c0                	test   %eax,%eax
+  800ab9:	78 35                	js     800af0 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  800abb:	41 8b 46 08          	mov    0x8(%r14),%eax
+  800abf:	83 e0 03             	and    $0x3,%eax
+  800ac2:	83 f8 01             	cmp    $0x1,%eax
+  800ac5:	74 2d                	je     800af4 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  800ac7:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800acb:	48 8b 40 10          	mov    0x10(%rax),%rax
+  800acf:	48 85 c0             	test   %rax,%rax
+  800ad2:	74 56                	je     800b2a <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  800ad4:	4c 89 ea             	mov    %r13,%rdx
+  800ad7:	4c 89 e6             	mov    %r12,%rsi
+  800ada:	4c 89 f7             	mov    %r14,%rdi
+  800add:	ff d0                	call   *%rax
+}
+  800adf:	48 83 c4 10          	add    $0x10,%rsp
+  800ae3:	5b                   	pop    %rbx
+  800ae4:	41 5c                	pop    %r12
+  800ae6:	41 5d                	pop    %r13
+  800ae8:	41 5e                	pop    %r14
+  800aea:	5d                   	pop    %rbp
+  800aeb:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800aec:	48 98                	cltq
+  800aee:	eb ef                	jmp    800adf <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800af0:	48 98                	cltq
+  800af2:	eb eb                	jmp    800adf <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  800af4:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  800afb:	00 00 00 
+  800afe:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+  800b04:	89 da                	mov    %ebx,%edx
+  800b06:	48 bf 11 2d 80 00 00 	movabs $0x802d11,%rdi
+  800b0d:	00 00 00 
+  800b10:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b15:	48 b9 77 1d 80 00 00 	movabs $0x801d77,%rcx
+  800b1c:	00 00 00 
+  800b1f:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  800b21:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  800b28:	eb b5                	jmp    800adf <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  800b2a:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  800b31:	eb ac                	jmp    800adf <read+0x6a>
+
+0000000000800b33 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  800b33:	55                   	push   %rbp
+  800b34:	48 89 e5             	mov    %rsp,%rbp
+  800b37:	41 57                	push   %r15
+  800b39:	41 56                	push   %r14
+  800b3b:	41 55                	push   %r13
+  800b3d:	41 54                	push   %r12
+  800b3f:	53                   	push   %rbx
+  800b40:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  800b44:	48 85 d2             	test   %rdx,%rdx
+  800b47:	74 54                	je     800b9d <readn+0x6a>
+  800b49:	41 89 fd             	mov    %edi,%r13d
+  800b4c:	49 89 f6             	mov    %rsi,%r14
+  800b4f:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  800b52:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  800b57:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  800b5c:	49 bf 75 0a 80 00 00 	movabs $0x800a75,%r15
+  800b63:	00 00 00 
+  800b66:	4c 89 e2             	mov    %r12,%rdx
+  800b69:	48 29 f2             	sub    %rsi,%rdx
+  800b6c:	4c 01 f6             	add    %r14,%rsi
+  800b6f:	44 89 ef             	mov    %r13d,%edi
+  800b72:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  800b75:	85 c0                	test   %eax,%eax
+  800b77:	78 20                	js     800b99 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  800b79:	01 c3                	add    %eax,%ebx
+  800b7b:	85 c0                	test   %eax,%eax
+  800b7d:	74 08                	je     800b87 <readn+0x54>
+  800b7f:	48 63 f3             	movslq %ebx,%rsi
+  800b82:	4c 39 e6             	cmp    %r12,%rsi
+  800b85:	72 df                	jb     800b66 <readn+0x33>
+    }
+    return res;
+  800b87:	48 63 c3             	movslq %ebx,%rax
+}
+  800b8a:	48 83 c4 08          	add    $0x8,%rsp
+  800b8e:	5b                   	pop    %rbx
+  800b8f:	41 5c                	pop    %r12
+  800b91:	41 5d                	pop    %r13
+  800b93:	41 5e                	pop    %r14
+  800b95:	41 5f                	pop    %r15
+  800b97:	5d                   	pop    %rbp
+  800b98:	c3                   	ret
+        if (inc < 0) return inc;
+  800b99:	48 98                	cltq
+  800b9b:	eb ed                	jmp    800b8a <readn+0x57>
+    int inc = 1, res = 0;
+  800b9d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ba2:	eb e3                	jmp    800b87 <readn+0x54>
+
+0000000000800ba4 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  800ba4:	55                   	push   %rbp
+  800ba5:	48 89 e5             	mov    %rsp,%rbp
+  800ba8:	41 56                	push   %r14
+  800baa:	41 55                	push   %r13
+  800bac:	41 54                	push   %r12
+  800bae:	53                   	push   %rbx
+  800baf:	48 83 ec 10          	sub    $0x10,%rsp
+  800bb3:	89 fb                	mov    %edi,%ebx
+  800bb5:	49 89 f4             	mov    %rsi,%r12
+  800bb8:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800bbb:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800bbf:	48 b8 92 07 80 00 00 	movabs $0x800792,%rax
+  800bc6:	00 00 00 
+  800bc9:	ff d0                	call   *%rax
+  800bcb:	85 c0                	test   %eax,%eax
+  800bcd:	78 47                	js     800c16 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800bcf:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  800bd3:	41 8b 3e             	mov    (%r14),%edi
+  800bd6:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800bda:	48 b8 dd 07 80 00 00 	movabs $0x8007dd,%rax
+  800be1:	00 00 00 
+  800be4:	ff d0                	call   *%rax
+  800be6:	85 c0                	test   %eax,%eax
+  800be8:	78 30                	js     800c1a <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800bea:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  800bef:	74 2d                	je     800c1e <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  800bf1:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800bf5:	48 8b 40 18          	mov    0x18(%rax),%rax
+  800bf9:	48 85 c0             	test   %rax,%rax
+  800bfc:	74 56                	je     800c54 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  800bfe:	4c 89 ea             	mov    %r13,%rdx
+  800c01:	4c 89 e6             	mov    %r12,%rsi
+  800c04:	4c 89 f7             	mov    %r14,%rdi
+  800c07:	ff d0                	call   *%rax
+}
+  800c09:	48 83 c4 10          	add    $0x10,%rsp
+  800c0d:	5b                   	pop    %rbx
+  800c0e:	41 5c                	pop    %r12
+  800c10:	41 5d                	pop    %r13
+  800c12:	41 5e                	pop    %r14
+  800c14:	5d                   	pop    %rbp
+  800c15:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800c16:	48 98                	cltq
+  800c18:	eb ef                	jmp    800c09 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800c1a:	48 98                	cltq
+  800c1c:	eb eb                	jmp    800c09 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  800c1e:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  800c25:	00 00 00 
+  800c28:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+  800c2e:	89 da                	mov    %ebx,%edx
+  800c30:	48 bf 2d 2d 80 00 00 	movabs $0x802d2d,%rdi
+  800c37:	00 00 00 
+  800c3a:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c3f:	48 b9 77 1d 80 00 00 	movabs $0x801d77,%rcx
+  800c46:	00 00 00 
+  800c49:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  800c4b:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  800c52:	eb b5                	jmp    800c09 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  800c54:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  800c5b:	eb ac                	jmp    800c09 <write+0x65>
+
+0000000000800c5d <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  800c5d:	55                   	push   %rbp
+  800c5e:	48 89 e5             	mov    %rsp,%rbp
+  800c61:	53                   	push   %rbx
+  800c62:	48 83 ec 18          	sub    $0x18,%rsp
+  800c66:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800c68:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800c6c:	48 b8 92 07 80 00 00 	movabs $0x800792,%rax
+  800c73:	00 00 00 
+  800c76:	ff d0                	call   *%rax
+  800c78:	85 c0                	test   %eax,%eax
+  800c7a:	78 0c                	js     800c88 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  800c7c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800c80:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  800c83:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800c88:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800c8c:	c9                   	leave
+  800c8d:	c3                   	ret
+
+0000000000800c8e <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  800c8e:	55                   	push   %rbp
+  800c8f:	48 89 e5             	mov    %rsp,%rbp
+  800c92:	41 55                	push   %r13
+  800c94:	41 54                	push   %r12
+  800c96:	53                   	push   %rbx
+  800c97:	48 83 ec 18          	sub    $0x18,%rsp
+  800c9b:	89 fb                	mov    %edi,%ebx
+  800c9d:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800ca0:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800ca4:	48 b8 92 07 80 00 00 	movabs $0x800792,%rax
+  800cab:	00 00 00 
+  800cae:	ff d0                	call   *%rax
+  800cb0:	85 c0                	test   %eax,%eax
+  800cb2:	78 38                	js     800cec <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800cb4:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  800cb8:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  800cbc:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800cc0:	48 b8 dd 07 80 00 00 	movabs $0x8007dd,%rax
+  800cc7:	00 00 00 
+  800cca:	ff d0                	call   *%rax
+  800ccc:	85 c0                	test   %eax,%eax
+  800cce:	78 1c                	js     800cec <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800cd0:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  800cd5:	74 20                	je     800cf7 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  800cd7:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800cdb:	48 8b 40 30          	mov    0x30(%rax),%rax
+  800cdf:	48 85 c0             	test   %rax,%rax
+  800ce2:	74 47                	je     800d2b <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  800ce4:	44 89 e6             	mov    %r12d,%esi
+  800ce7:	4c 89 ef             	mov    %r13,%rdi
+  800cea:	ff d0                	call   *%rax
+}
+  800cec:	48 83 c4 18          	add    $0x18,%rsp
+  800cf0:	5b                   	pop    %rbx
+  800cf1:	41 5c                	pop    %r12
+  800cf3:	41 5d                	pop    %r13
+  800cf5:	5d                   	pop    %rbp
+  800cf6:	c3                   	ret
+                thisenv->env_id, fdnum);
+  800cf7:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  800cfe:	00 00 00 
+  800d01:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  800d07:	89 da                	mov    %ebx,%edx
+  800d09:	48 bf f0 2c 80 00 00 	movabs $0x802cf0,%rdi
+  800d10:	00 00 00 
+  800d13:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d18:	48 b9 77 1d 80 00 00 	movabs $0x801d77,%rcx
+  800d1f:	00 00 00 
+  800d22:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  800d24:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800d29:	eb c1                	jmp    800cec <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  800d2b:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  800d30:	eb ba                	jmp    800cec <ftruncate+0x5e>
+
+0000000000800d32 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  800d32:	55                   	push   %rbp
+  800d33:	48 89 e5             	mov    %rsp,%rbp
+  800d36:	41 54                	push   %r12
+  800d38:	53                   	push   %rbx
+  800d39:	48 83 ec 10          	sub    $0x10,%rsp
+  800d3d:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800d40:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800d44:	48 b8 92 07 80 00 00 	movabs $0x800792,%rax
+  800d4b:	00 00 00 
+  800d4e:	ff d0                	call   *%rax
+  800d50:	85 c0                	test   %eax,%eax
+  800d52:	78 4e                	js     800da2 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800d54:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  800d58:	41 8b 3c 24          	mov    (%r12),%edi
+  800d5c:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  800d60:	48 b8 dd 07 80 00 00 	movabs $0x8007dd,%rax
+  800d67:	00 00 00 
+  800d6a:	ff d0                	call   *%rax
+  800d6c:	85 c0                	test   %eax,%eax
+  800d6e:	78 32                	js     800da2 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  800d70:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800d74:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  800d79:	74 30                	je     800dab <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  800d7b:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  800d7e:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  800d85:	00 00 00 
+    stat->st_isdir = 0;
+  800d88:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  800d8f:	00 00 00 
+    stat->st_dev = dev;
+  800d92:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  800d99:	48 89 de             	mov    %rbx,%rsi
+  800d9c:	4c 89 e7             	mov    %r12,%rdi
+  800d9f:	ff 50 28             	call   *0x28(%rax)
+}
+  800da2:	48 83 c4 10          	add    $0x10,%rsp
+  800da6:	5b                   	pop    %rbx
+  800da7:	41 5c                	pop    %r12
+  800da9:	5d                   	pop    %rbp
+  800daa:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  800dab:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  800db0:	eb f0                	jmp    800da2 <fstat+0x70>
+
+0000000000800db2 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  800db2:	55                   	push   %rbp
+  800db3:	48 89 e5             	mov    %rsp,%rbp
+  800db6:	41 54                	push   %r12
+  800db8:	53                   	push   %rbx
+  800db9:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  800dbc:	be 00 00 00 00       	mov    $0x0,%esi
+  800dc1:	48 b8 95 11 80 00 00 	movabs $0x801195,%rax
+  800dc8:	00 00 00 
+  800dcb:	ff d0                	call   *%rax
+  800dcd:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  800dcf:	85 c0                	test   %eax,%eax
+  800dd1:	78 25                	js     800df8 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  800dd3:	4c 89 e6             	mov    %r12,%rsi
+  800dd6:	89 c7                	mov    %eax,%edi
+  800dd8:	48 b8 32 0d 80 00 00 	movabs $0x800d32,%rax
+  800ddf:	00 00 00 
+  800de2:	ff d0                	call   *%rax
+  800de4:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  800de7:	89 df                	mov    %ebx,%edi
+  800de9:	48 b8 f7 08 80 00 00 	movabs $0x8008f7,%rax
+  800df0:	00 00 00 
+  800df3:	ff d0                	call   *%rax
+
+    return res;
+  800df5:	44 89 e3             	mov    %r12d,%ebx
+}
+  800df8:	89 d8                	mov    %ebx,%eax
+  800dfa:	5b                   	pop    %rbx
+  800dfb:	41 5c                	pop    %r12
+  800dfd:	5d                   	pop    %rbp
+  800dfe:	c3                   	ret
+
+0000000000800dff <fsipc>:
+ * response may be written back to fsipcbuf.
+ * type: request code, passed as the simple integer IPC value.
+ * dstva: virtual address at which to receive reply page, 0 if none.
+ * Returns result from the file server. */
+static int
+fsipc(unsigned type, void *dstva) {
+  800dff:	55                   	push   %rbp
+  800e00:	48 89 e5             	mov    %rsp,%rbp
+  800e03:	41 54                	push   %r12
+  800e05:	53                   	push   %rbx
+  800e06:	48 83 ec 10          	sub    $0x10,%rsp
+  800e0a:	41 89 fc             	mov    %edi,%r12d
+  800e0d:	48 89 f3             	mov    %rsi,%rbx
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  800e10:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  800e17:	00 00 00 
+  800e1a:	83 38 00             	cmpl   $0x0,(%rax)
+  800e1d:	74 5e                	je     800e7d <fsipc+0x7e>
+    if (debug) {
+        cprintf("[%08x] fsipc %d %08x\n",
+                thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+    }
+
+    ipc_send(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW);
+  800e1f:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  800e25:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  800e2a:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  800e31:	00 00 00 
+  800e34:	44 89 e6             	mov    %r12d,%esi
+  800e37:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  800e3e:	00 00 00 
+  800e41:	8b 38                	mov    (%rax),%edi
+  800e43:	48 b8 98 2b 80 00 00 	movabs $0x802b98,%rax
+  800e4a:	00 00 00 
+  800e4d:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  800e4f:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  800e56:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  800e57:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e5c:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  800e60:	48 89 de             	mov    %rbx,%rsi
+  800e63:	bf 00 00 00 00       	mov    $0x0,%edi
+  800e68:	48 b8 c3 2a 80 00 00 	movabs $0x802ac3,%rax
+  800e6f:	00 00 00 
+  800e72:	ff d0                	call   *%rax
+}
+  800e74:	48 83 c4 10          	add    $0x10,%rsp
+  800e78:	5b                   	pop    %rbx
+  800e79:	41 5c                	pop    %r12
+  800e7b:	5d                   	pop    %rbp
+  800e7c:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  800e7d:	bf 03 00 00 00       	mov    $0x3,%edi
+  800e82:	48 b8 3b 2c 80 00 00 	movabs $0x802c3b,%rax
+  800e89:	00 00 00 
+  800e8c:	ff d0                	call   *%rax
+  800e8e:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  800e95:	00 00 
+  800e97:	eb 86                	jmp    800e1f <fsipc+0x20>
+
+0000000000800e99 <devfile_trunc>:
+    return 0;
+}
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  800e99:	55                   	push   %rbp
+  800e9a:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  800e9d:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  800ea4:	00 00 00 
+  800ea7:	8b 57 0c             	mov    0xc(%rdi),%edx
+  800eaa:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  800eac:	89 70 04             	mov    %esi,0x4(%rax)
+
+    return fsipc(FSREQ_SET_SIZE, NULL);
+  800eaf:	be 00 00 00 00       	mov    $0x0,%esi
+  800eb4:	bf 02 00 00 00       	mov    $0x2,%edi
+  800eb9:	48 b8 ff 0d 80 00 00 	movabs $0x800dff,%rax
+  800ec0:	00 00 00 
+  800ec3:	ff d0                	call   *%rax
+}
+  800ec5:	5d                   	pop    %rbp
+  800ec6:	c3                   	ret
+
+0000000000800ec7 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  800ec7:	55                   	push   %rbp
+  800ec8:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  800ecb:	8b 47 0c             	mov    0xc(%rdi),%eax
+  800ece:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  800ed5:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  800ed7:	be 00 00 00 00       	mov    $0x0,%esi
+  800edc:	bf 06 00 00 00       	mov    $0x6,%edi
+  800ee1:	48 b8 ff 0d 80 00 00 	movabs $0x800dff,%rax
+  800ee8:	00 00 00 
+  800eeb:	ff d0                	call   *%rax
+}
+  800eed:	5d                   	pop    %rbp
+  800eee:	c3                   	ret
+
+0000000000800eef <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  800eef:	55                   	push   %rbp
+  800ef0:	48 89 e5             	mov    %rsp,%rbp
+  800ef3:	41 54                	push   %r12
+  800ef5:	53                   	push   %rbx
+  800ef6:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  800ef9:	8b 47 0c             	mov    0xc(%rdi),%eax
+  800efc:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  800f03:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  800f05:	be 00 00 00 00       	mov    $0x0,%esi
+  800f0a:	bf 05 00 00 00       	mov    $0x5,%edi
+  800f0f:	48 b8 ff 0d 80 00 00 	movabs $0x800dff,%rax
+  800f16:	00 00 00 
+  800f19:	ff d0                	call   *%rax
+    if (res < 0) {
+  800f1b:	85 c0                	test   %eax,%eax
+  800f1d:	78 3d                	js     800f5c <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  800f1f:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  800f26:	00 00 00 
+  800f29:	4c 89 e6             	mov    %r12,%rsi
+  800f2c:	48 89 df             	mov    %rbx,%rdi
+  800f2f:	48 b8 9c 26 80 00 00 	movabs $0x80269c,%rax
+  800f36:	00 00 00 
+  800f39:	ff d0                	call   *%rax
+    st->st_size  = fsipcbuf.statRet.ret_size;
+  800f3b:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  800f42:	00 
+  800f43:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  800f49:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  800f50:	00 
+  800f51:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  800f57:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800f5c:	5b                   	pop    %rbx
+  800f5d:	41 5c                	pop    %r12
+  800f5f:	5d                   	pop    %rbp
+  800f60:	c3                   	ret
+
+0000000000800f61 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  800f61:	55                   	push   %rbp
+  800f62:	48 89 e5             	mov    %rsp,%rbp
+  800f65:	41 57                	push   %r15
+  800f67:	41 56                	push   %r14
+  800f69:	41 55                	push   %r13
+  800f6b:	41 54                	push   %r12
+  800f6d:	53                   	push   %rbx
+  800f6e:	48 83 ec 18          	sub    $0x18,%rsp
+  800f72:	49 89 fe             	mov    %rdi,%r14
+  800f75:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+  800f79:	48 89 d3             	mov    %rdx,%rbx
+    while (n > sizeof(fsipcbuf.write.req_buf))
+  800f7c:	48 81 fa f0 0f 00 00 	cmp    $0xff0,%rdx
+  800f83:	0f 86 e4 00 00 00    	jbe    80106d <devfile_write+0x10c>
+  800f89:	49 89 f4             	mov    %rsi,%r12
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  800f8c:	49 bd 00 60 80 00 00 	movabs $0x806000,%r13
+  800f93:	00 00 00 
+        memcpy(fsipcbuf.write.req_buf, buf, sizeof(fsipcbuf.write.req_buf));
+  800f96:	49 bf fd 28 80 00 00 	movabs $0x8028fd,%r15
+  800f9d:	00 00 00 
+  800fa0:	eb 03                	jmp    800fa5 <devfile_write+0x44>
+        buf += sizeof(fsipcbuf.write.req_buf);
+  800fa2:	49 89 f4             	mov    %rsi,%r12
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  800fa5:	41 8b 46 0c          	mov    0xc(%r14),%eax
+  800fa9:	41 89 45 00          	mov    %eax,0x0(%r13)
+        fsipcbuf.write.req_n      = sizeof(fsipcbuf.write.req_buf);
+  800fad:	49 c7 45 08 f0 0f 00 	movq   $0xff0,0x8(%r13)
+  800fb4:	00 
+        memcpy(fsipcbuf.write.req_buf, buf, sizeof(fsipcbuf.write.req_buf));
+  800fb5:	ba f0 0f 00 00       	mov    $0xff0,%edx
+  800fba:	4c 89 e6             	mov    %r12,%rsi
+  800fbd:	48 bf 10 60 80 00 00 	movabs $0x806010,%rdi
+  800fc4:	00 00 00 
+  800fc7:	41 ff d7             	call   *%r15
+        ssize_t res = fsipc(FSREQ_WRITE, NULL);
+  800fca:	be 00 00 00 00       	mov    $0x0,%esi
+  800fcf:	bf 04 00 00 00       	mov    $0x4,%edi
+  800fd4:	48 b8 ff 0d 80 00 00 	movabs $0x800dff,%rax
+  800fdb:	00 00 00 
+  800fde:	ff d0                	call   *%rax
+  800fe0:	48 63 d0             	movslq %eax,%rdx
+        if (res < 0 || res < sizeof(fsipcbuf.write.req_buf))
+  800fe3:	3d ef 0f 00 00       	cmp    $0xfef,%eax
+  800fe8:	7e 71                	jle    80105b <devfile_write+0xfa>
+        buf += sizeof(fsipcbuf.write.req_buf);
+  800fea:	49 8d b4 24 f0 0f 00 	lea    0xff0(%r12),%rsi
+  800ff1:	00 
+        n -= sizeof(fsipcbuf.write.req_buf);
+  800ff2:	48 81 eb f0 0f 00 00 	sub    $0xff0,%rbx
+    while (n > sizeof(fsipcbuf.write.req_buf))
+  800ff9:	48 81 fb f0 0f 00 00 	cmp    $0xff0,%rbx
+  801000:	77 a0                	ja     800fa2 <devfile_write+0x41>
+        written += sizeof(fsipcbuf.write.req_buf);
+  801002:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801006:	49 29 c4             	sub    %rax,%r12
+  801009:	4d 8d a4 24 f0 0f 00 	lea    0xff0(%r12),%r12
+  801010:	00 
+    fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801011:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  801018:	00 00 00 
+  80101b:	41 8b 56 0c          	mov    0xc(%r14),%edx
+  80101f:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.write.req_n      = n;
+  801021:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    memcpy(fsipcbuf.write.req_buf, buf, n);
+  801025:	48 89 da             	mov    %rbx,%rdx
+  801028:	48 8d 78 10          	lea    0x10(%rax),%rdi
+  80102c:	48 b8 fd 28 80 00 00 	movabs $0x8028fd,%rax
+  801033:	00 00 00 
+  801036:	ff d0                	call   *%rax
+    ssize_t res = fsipc(FSREQ_WRITE, NULL);
+  801038:	be 00 00 00 00       	mov    $0x0,%esi
+  80103d:	bf 04 00 00 00       	mov    $0x4,%edi
+  801042:	48 b8 ff 0d 80 00 00 	movabs $0x800dff,%rax
+  801049:	00 00 00 
+  80104c:	ff d0                	call   *%rax
+  80104e:	48 63 d0             	movslq %eax,%rdx
+    written += res;
+  801051:	49 01 d4             	add    %rdx,%r12
+  801054:	48 85 d2             	test   %rdx,%rdx
+  801057:	49 0f 49 d4          	cmovns %r12,%rdx
+}
+  80105b:	48 89 d0             	mov    %rdx,%rax
+  80105e:	48 83 c4 18          	add    $0x18,%rsp
+  801062:	5b                   	pop    %rbx
+  801063:	41 5c                	pop    %r12
+  801065:	41 5d                	pop    %r13
+  801067:	41 5e                	pop    %r14
+  801069:	41 5f                	pop    %r15
+  80106b:	5d                   	pop    %rbp
+  80106c:	c3                   	ret
+    while (n > sizeof(fsipcbuf.write.req_buf))
+  80106d:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+    ssize_t written = 0;
+  801071:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  801077:	eb 98                	jmp    801011 <devfile_write+0xb0>
+
+0000000000801079 <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  801079:	55                   	push   %rbp
+  80107a:	48 89 e5             	mov    %rsp,%rbp
+  80107d:	41 57                	push   %r15
+  80107f:	41 56                	push   %r14
+  801081:	41 55                	push   %r13
+  801083:	41 54                	push   %r12
+  801085:	53                   	push   %rbx
+  801086:	48 83 ec 18          	sub    $0x18,%rsp
+  80108a:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  80108e:	49 89 f6             	mov    %rsi,%r14
+  801091:	49 89 d4             	mov    %rdx,%r12
+    while (n > sizeof(fsipcbuf.readRet.ret_buf))
+  801094:	48 81 fa 00 10 00 00 	cmp    $0x1000,%rdx
+  80109b:	0f 86 ea 00 00 00    	jbe    80118b <devfile_read+0x112>
+    ssize_t readsz = 0;
+  8010a1:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  8010a8:	00 
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8010a9:	49 bf 00 60 80 00 00 	movabs $0x806000,%r15
+  8010b0:	00 00 00 
+  8010b3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8010b7:	8b 40 0c             	mov    0xc(%rax),%eax
+  8010ba:	41 89 07             	mov    %eax,(%r15)
+        fsipcbuf.read.req_n = sizeof(fsipcbuf.readRet.ret_buf);
+  8010bd:	49 c7 47 08 00 10 00 	movq   $0x1000,0x8(%r15)
+  8010c4:	00 
+        ssize_t res = fsipc(FSREQ_READ, NULL);
+  8010c5:	be 00 00 00 00       	mov    $0x0,%esi
+  8010ca:	bf 03 00 00 00       	mov    $0x3,%edi
+  8010cf:	48 b8 ff 0d 80 00 00 	movabs $0x800dff,%rax
+  8010d6:	00 00 00 
+  8010d9:	ff d0                	call   *%rax
+  8010db:	4c 63 e8             	movslq %eax,%r13
+        if (res < 0)
+  8010de:	4d 85 ed             	test   %r13,%r13
+  8010e1:	0f 88 92 00 00 00    	js     801179 <devfile_read+0x100>
+        memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  8010e7:	4c 89 ea             	mov    %r13,%rdx
+  8010ea:	4c 89 fe             	mov    %r15,%rsi
+  8010ed:	4c 89 f7             	mov    %r14,%rdi
+  8010f0:	48 b8 fd 28 80 00 00 	movabs $0x8028fd,%rax
+  8010f7:	00 00 00 
+  8010fa:	ff d0                	call   *%rax
+        if (res < sizeof(fsipcbuf.readRet.ret_buf))
+  8010fc:	49 81 fd ff 0f 00 00 	cmp    $0xfff,%r13
+  801103:	76 6d                	jbe    801172 <devfile_read+0xf9>
+        readsz += res;
+  801105:	4c 01 6d c0          	add    %r13,-0x40(%rbp)
+        buf += res;
+  801109:	4d 01 ee             	add    %r13,%r14
+        n -= res;
+  80110c:	4d 29 ec             	sub    %r13,%r12
+    while (n > sizeof(fsipcbuf.readRet.ret_buf))
+  80110f:	49 81 fc 00 10 00 00 	cmp    $0x1000,%r12
+  801116:	77 9b                	ja     8010b3 <devfile_read+0x3a>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801118:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  80111f:	00 00 00 
+  801122:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  801126:	8b 51 0c             	mov    0xc(%rcx),%edx
+  801129:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.read.req_n = n;
+  80112b:	4c 89 60 08          	mov    %r12,0x8(%rax)
+    ssize_t res = fsipc(FSREQ_READ, NULL);
+  80112f:	be 00 00 00 00       	mov    $0x0,%esi
+  801134:	bf 03 00 00 00       	mov    $0x3,%edi
+  801139:	48 b8 ff 0d 80 00 00 	movabs $0x800dff,%rax
+  801140:	00 00 00 
+  801143:	ff d0                	call   *%rax
+  801145:	4c 63 e8             	movslq %eax,%r13
+    if (res < 0)
+  801148:	4d 85 ed             	test   %r13,%r13
+  80114b:	78 2c                	js     801179 <devfile_read+0x100>
+    memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  80114d:	4c 89 ea             	mov    %r13,%rdx
+  801150:	48 be 00 60 80 00 00 	movabs $0x806000,%rsi
+  801157:	00 00 00 
+  80115a:	4c 89 f7             	mov    %r14,%rdi
+  80115d:	48 b8 fd 28 80 00 00 	movabs $0x8028fd,%rax
+  801164:	00 00 00 
+  801167:	ff d0                	call   *%rax
+    readsz += res;
+  801169:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80116d:	49 01 c5             	add    %rax,%r13
+    return readsz;
+  801170:	eb 07                	jmp    801179 <devfile_read+0x100>
+            return readsz + res;
+  801172:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  801176:	49 01 c5             	add    %rax,%r13
+}
+  801179:	4c 89 e8             	mov    %r13,%rax
+  80117c:	48 83 c4 18          	add    $0x18,%rsp
+  801180:	5b                   	pop    %rbx
+  801181:	41 5c                	pop    %r12
+  801183:	41 5d                	pop    %r13
+  801185:	41 5e                	pop    %r14
+  801187:	41 5f                	pop    %r15
+  801189:	5d                   	pop    %rbp
+  80118a:	c3                   	ret
+    ssize_t readsz = 0;
+  80118b:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  801192:	00 
+  801193:	eb 83                	jmp    801118 <devfile_read+0x9f>
+
+0000000000801195 <open>:
+open(const char *path, int mode) {
+  801195:	55                   	push   %rbp
+  801196:	48 89 e5             	mov    %rsp,%rbp
+  801199:	41 55                	push   %r13
+  80119b:	41 54                	push   %r12
+  80119d:	53                   	push   %rbx
+  80119e:	48 83 ec 18          	sub    $0x18,%rsp
+  8011a2:	49 89 fc             	mov    %rdi,%r12
+  8011a5:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  8011a8:	48 b8 5e 26 80 00 00 	movabs $0x80265e,%rax
+  8011af:	00 00 00 
+  8011b2:	ff d0                	call   *%rax
+  8011b4:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  8011ba:	0f 87 8a 00 00 00    	ja     80124a <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8011c0:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  8011c4:	48 b8 78 07 80 00 00 	movabs $0x800778,%rax
+  8011cb:	00 00 00 
+  8011ce:	ff d0                	call   *%rax
+  8011d0:	89 c3                	mov    %eax,%ebx
+  8011d2:	85 c0                	test   %eax,%eax
+  8011d4:	78 50                	js     801226 <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  8011d6:	4c 89 e6             	mov    %r12,%rsi
+  8011d9:	48 bb 00 60 80 00 00 	movabs $0x806000,%rbx
+  8011e0:	00 00 00 
+  8011e3:	48 89 df             	mov    %rbx,%rdi
+  8011e6:	48 b8 9c 26 80 00 00 	movabs $0x80269c,%rax
+  8011ed:	00 00 00 
+  8011f0:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  8011f2:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  8011f9:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8011fd:	bf 01 00 00 00       	mov    $0x1,%edi
+  801202:	48 b8 ff 0d 80 00 00 	movabs $0x800dff,%rax
+  801209:	00 00 00 
+  80120c:	ff d0                	call   *%rax
+  80120e:	89 c3                	mov    %eax,%ebx
+  801210:	85 c0                	test   %eax,%eax
+  801212:	78 1f                	js     801233 <open+0x9e>
+    return fd2num(fd);
+  801214:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  801218:	48 b8 d1 06 80 00 00 	movabs $0x8006d1,%rax
+  80121f:	00 00 00 
+  801222:	ff d0                	call   *%rax
+  801224:	89 c3                	mov    %eax,%ebx
+}
+  801226:	89 d8                	mov    %ebx,%eax
+  801228:	48 83 c4 18          	add    $0x18,%rsp
+  80122c:	5b                   	pop    %rbx
+  80122d:	41 5c                	pop    %r12
+  80122f:	41 5d                	pop    %r13
+  801231:	5d                   	pop    %rbp
+  801232:	c3                   	ret
+        fd_close(fd, 0);
+  801233:	be 00 00 00 00       	mov    $0x0,%esi
+  801238:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80123c:	48 b8 4d 08 80 00 00 	movabs $0x80084d,%rax
+  801243:	00 00 00 
+  801246:	ff d0                	call   *%rax
+        return res;
+  801248:	eb dc                	jmp    801226 <open+0x91>
+        return -E_BAD_PATH;
+  80124a:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  80124f:	eb d5                	jmp    801226 <open+0x91>
+
+0000000000801251 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  801251:	55                   	push   %rbp
+  801252:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc(FSREQ_SYNC, NULL);
+  801255:	be 00 00 00 00       	mov    $0x0,%esi
+  80125a:	bf 08 00 00 00       	mov    $0x8,%edi
+  80125f:	48 b8 ff 0d 80 00 00 	movabs $0x800dff,%rax
+  801266:	00 00 00 
+  801269:	ff d0                	call   *%rax
+}
+  80126b:	5d                   	pop    %rbp
+  80126c:	c3                   	ret
+
+000000000080126d <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  80126d:	55                   	push   %rbp
+  80126e:	48 89 e5             	mov    %rsp,%rbp
+  801271:	41 54                	push   %r12
+  801273:	53                   	push   %rbx
+  801274:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  801277:	48 b8 e3 06 80 00 00 	movabs $0x8006e3,%rax
+  80127e:	00 00 00 
+  801281:	ff d0                	call   *%rax
+  801283:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  801286:	48 be 80 2d 80 00 00 	movabs $0x802d80,%rsi
+  80128d:	00 00 00 
+  801290:	48 89 df             	mov    %rbx,%rdi
+  801293:	48 b8 9c 26 80 00 00 	movabs $0x80269c,%rax
+  80129a:	00 00 00 
+  80129d:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  80129f:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  8012a4:	41 2b 04 24          	sub    (%r12),%eax
+  8012a8:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  8012ae:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8012b5:	00 00 00 
+    stat->st_dev = &devpipe;
+  8012b8:	48 b8 60 40 80 00 00 	movabs $0x804060,%rax
+  8012bf:	00 00 00 
+  8012c2:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  8012c9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012ce:	5b                   	pop    %rbx
+  8012cf:	41 5c                	pop    %r12
+  8012d1:	5d                   	pop    %rbp
+  8012d2:	c3                   	ret
+
+00000000008012d3 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  8012d3:	55                   	push   %rbp
+  8012d4:	48 89 e5             	mov    %rsp,%rbp
+  8012d7:	41 54                	push   %r12
+  8012d9:	53                   	push   %rbx
+  8012da:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8012dd:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8012e2:	48 89 fe             	mov    %rdi,%rsi
+  8012e5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8012ea:	49 bc 62 03 80 00 00 	movabs $0x800362,%r12
+  8012f1:	00 00 00 
+  8012f4:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  8012f7:	48 89 df             	mov    %rbx,%rdi
+  8012fa:	48 b8 e3 06 80 00 00 	movabs $0x8006e3,%rax
+  801301:	00 00 00 
+  801304:	ff d0                	call   *%rax
+  801306:	48 89 c6             	mov    %rax,%rsi
+  801309:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80130e:	bf 00 00 00 00       	mov    $0x0,%edi
+  801313:	41 ff d4             	call   *%r12
+}
+  801316:	5b                   	pop    %rbx
+  801317:	41 5c                	pop    %r12
+  801319:	5d                   	pop    %rbp
+  80131a:	c3                   	ret
+
+000000000080131b <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  80131b:	55                   	push   %rbp
+  80131c:	48 89 e5             	mov    %rsp,%rbp
+  80131f:	41 57                	push   %r15
+  801321:	41 56                	push   %r14
+  801323:	41 55                	push   %r13
+  801325:	41 54                	push   %r12
+  801327:	53                   	push   %rbx
+  801328:	48 83 ec 18          	sub    $0x18,%rsp
+  80132c:	49 89 fc             	mov    %rdi,%r12
+  80132f:	49 89 f5             	mov    %rsi,%r13
+  801332:	49 89 d7             	mov    %rdx,%r15
+  801335:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  801339:	48 b8 e3 06 80 00 00 	movabs $0x8006e3,%rax
+  801340:	00 00 00 
+  801343:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  801345:	4d 85 ff             	test   %r15,%r15
+  801348:	0f 84 af 00 00 00    	je     8013fd <devpipe_write+0xe2>
+  80134e:	48 89 c3             	mov    %rax,%rbx
+  801351:	4c 89 f8             	mov    %r15,%rax
+  801354:	4d 89 ef             	mov    %r13,%r15
+  801357:	4c 01 e8             	add    %r13,%rax
+  80135a:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80135e:	49 bd 6a 02 80 00 00 	movabs $0x80026a,%r13
+  801365:	00 00 00 
+            sys_yield();
+  801368:	49 be 07 02 80 00 00 	movabs $0x800207,%r14
+  80136f:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  801372:	8b 73 04             	mov    0x4(%rbx),%esi
+  801375:	48 63 ce             	movslq %esi,%rcx
+  801378:	48 63 03             	movslq (%rbx),%rax
+  80137b:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  801381:	48 39 c1             	cmp    %rax,%rcx
+  801384:	72 2e                	jb     8013b4 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  801386:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80138b:	48 89 da             	mov    %rbx,%rdx
+  80138e:	be 00 10 00 00       	mov    $0x1000,%esi
+  801393:	4c 89 e7             	mov    %r12,%rdi
+  801396:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  801399:	85 c0                	test   %eax,%eax
+  80139b:	74 66                	je     801403 <devpipe_write+0xe8>
+            sys_yield();
+  80139d:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  8013a0:	8b 73 04             	mov    0x4(%rbx),%esi
+  8013a3:	48 63 ce             	movslq %esi,%rcx
+  8013a6:	48 63 03             	movslq (%rbx),%rax
+  8013a9:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  8013af:	48 39 c1             	cmp    %rax,%rcx
+  8013b2:	73 d2                	jae    801386 <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8013b4:	41 0f b6 3f          	movzbl (%r15),%edi
+  8013b8:	48 89 ca             	mov    %rcx,%rdx
+  8013bb:	48 c1 ea 03          	shr    $0x3,%rdx
+  8013bf:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  8013c6:	08 10 20 
+  8013c9:	48 f7 e2             	mul    %rdx
+  8013cc:	48 c1 ea 06          	shr    $0x6,%rdx
+  8013d0:	48 89 d0             	mov    %rdx,%rax
+  8013d3:	48 c1 e0 09          	shl    $0x9,%rax
+  8013d7:	48 29 d0             	sub    %rdx,%rax
+  8013da:	48 c1 e0 03          	shl    $0x3,%rax
+  8013de:	48 29 c1             	sub    %rax,%rcx
+  8013e1:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  8013e6:	83 c6 01             	add    $0x1,%esi
+  8013e9:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8013ec:	49 83 c7 01          	add    $0x1,%r15
+  8013f0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8013f4:	49 39 c7             	cmp    %rax,%r15
+  8013f7:	0f 85 75 ff ff ff    	jne    801372 <devpipe_write+0x57>
+    return n;
+  8013fd:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  801401:	eb 05                	jmp    801408 <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  801403:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801408:	48 83 c4 18          	add    $0x18,%rsp
+  80140c:	5b                   	pop    %rbx
+  80140d:	41 5c                	pop    %r12
+  80140f:	41 5d                	pop    %r13
+  801411:	41 5e                	pop    %r14
+  801413:	41 5f                	pop    %r15
+  801415:	5d                   	pop    %rbp
+  801416:	c3                   	ret
+
+0000000000801417 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  801417:	55                   	push   %rbp
+  801418:	48 89 e5             	mov    %rsp,%rbp
+  80141b:	41 57                	push   %r15
+  80141d:	41 56                	push   %r14
+  80141f:	41 55                	push   %r13
+  801421:	41 54                	push   %r12
+  801423:	53                   	push   %rbx
+  801424:	48 83 ec 18          	sub    $0x18,%rsp
+  801428:	49 89 fc             	mov    %rdi,%r12
+  80142b:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  80142f:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  801433:	48 b8 e3 06 80 00 00 	movabs $0x8006e3,%rax
+  80143a:	00 00 00 
+  80143d:	ff d0                	call   *%rax
+  80143f:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  801442:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  801448:	49 bd 6a 02 80 00 00 	movabs $0x80026a,%r13
+  80144f:	00 00 00 
+            sys_yield();
+  801452:	49 be 07 02 80 00 00 	movabs $0x800207,%r14
+  801459:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  80145c:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  801461:	74 7d                	je     8014e0 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  801463:	8b 03                	mov    (%rbx),%eax
+  801465:	3b 43 04             	cmp    0x4(%rbx),%eax
+  801468:	75 26                	jne    801490 <devpipe_read+0x79>
+            if (i > 0) return i;
+  80146a:	4d 85 ff             	test   %r15,%r15
+  80146d:	75 77                	jne    8014e6 <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80146f:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  801474:	48 89 da             	mov    %rbx,%rdx
+  801477:	be 00 10 00 00       	mov    $0x1000,%esi
+  80147c:	4c 89 e7             	mov    %r12,%rdi
+  80147f:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  801482:	85 c0                	test   %eax,%eax
+  801484:	74 72                	je     8014f8 <devpipe_read+0xe1>
+            sys_yield();
+  801486:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  801489:	8b 03                	mov    (%rbx),%eax
+  80148b:	3b 43 04             	cmp    0x4(%rbx),%eax
+  80148e:	74 df                	je     80146f <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  801490:	48 63 c8             	movslq %eax,%rcx
+  801493:	48 89 ca             	mov    %rcx,%rdx
+  801496:	48 c1 ea 03          	shr    $0x3,%rdx
+  80149a:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  8014a1:	08 10 20 
+  8014a4:	48 89 d0             	mov    %rdx,%rax
+  8014a7:	48 f7 e6             	mul    %rsi
+  8014aa:	48 c1 ea 06          	shr    $0x6,%rdx
+  8014ae:	48 89 d0             	mov    %rdx,%rax
+  8014b1:	48 c1 e0 09          	shl    $0x9,%rax
+  8014b5:	48 29 d0             	sub    %rdx,%rax
+  8014b8:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  8014bf:	00 
+  8014c0:	48 89 c8             	mov    %rcx,%rax
+  8014c3:	48 29 d0             	sub    %rdx,%rax
+  8014c6:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  8014cb:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8014cf:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  8014d3:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8014d6:	49 83 c7 01          	add    $0x1,%r15
+  8014da:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  8014de:	75 83                	jne    801463 <devpipe_read+0x4c>
+    return n;
+  8014e0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8014e4:	eb 03                	jmp    8014e9 <devpipe_read+0xd2>
+            if (i > 0) return i;
+  8014e6:	4c 89 f8             	mov    %r15,%rax
+}
+  8014e9:	48 83 c4 18          	add    $0x18,%rsp
+  8014ed:	5b                   	pop    %rbx
+  8014ee:	41 5c                	pop    %r12
+  8014f0:	41 5d                	pop    %r13
+  8014f2:	41 5e                	pop    %r14
+  8014f4:	41 5f                	pop    %r15
+  8014f6:	5d                   	pop    %rbp
+  8014f7:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  8014f8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014fd:	eb ea                	jmp    8014e9 <devpipe_read+0xd2>
+
+00000000008014ff <pipe>:
+pipe(int pfd[2]) {
+  8014ff:	55                   	push   %rbp
+  801500:	48 89 e5             	mov    %rsp,%rbp
+  801503:	41 55                	push   %r13
+  801505:	41 54                	push   %r12
+  801507:	53                   	push   %rbx
+  801508:	48 81 ec b8 00 00 00 	sub    $0xb8,%rsp
+  80150f:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  801512:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  801516:	48 b8 78 07 80 00 00 	movabs $0x800778,%rax
+  80151d:	00 00 00 
+  801520:	ff d0                	call   *%rax
+  801522:	89 c3                	mov    %eax,%ebx
+  801524:	85 c0                	test   %eax,%eax
+  801526:	0f 88 51 01 00 00    	js     80167d <pipe+0x17e>
+        (res = fd_alloc_from(fd2num(fd0) + 1, &fd1)) < 0) goto err;
+  80152c:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  801530:	48 b8 d1 06 80 00 00 	movabs $0x8006d1,%rax
+  801537:	00 00 00 
+  80153a:	ff d0                	call   *%rax
+  80153c:	8d 78 01             	lea    0x1(%rax),%edi
+  80153f:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801543:	48 b8 ff 06 80 00 00 	movabs $0x8006ff,%rax
+  80154a:	00 00 00 
+  80154d:	ff d0                	call   *%rax
+  80154f:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  801551:	85 c0                	test   %eax,%eax
+  801553:	0f 88 24 01 00 00    	js     80167d <pipe+0x17e>
+    va = fd2data(fd0);
+  801559:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80155d:	48 bb e3 06 80 00 00 	movabs $0x8006e3,%rbx
+  801564:	00 00 00 
+  801567:	ff d3                	call   *%rbx
+  801569:	49 89 c5             	mov    %rax,%r13
+    struct RegionOp ops[] = {
+  80156c:	48 8d bd 30 ff ff ff 	lea    -0xd0(%rbp),%rdi
+  801573:	b9 14 00 00 00       	mov    $0x14,%ecx
+  801578:	b8 00 00 00 00       	mov    $0x0,%eax
+  80157d:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+  801580:	c7 85 34 ff ff ff 46 	movl   $0x46,-0xcc(%rbp)
+  801587:	00 00 00 
+  80158a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80158e:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+  801595:	48 c7 85 50 ff ff ff 	movq   $0x1000,-0xb0(%rbp)
+  80159c:	00 10 00 00 
+  8015a0:	c7 85 5c ff ff ff 46 	movl   $0x46,-0xa4(%rbp)
+  8015a7:	00 00 00 
+            {.type = REGION_ALLOC, .dstva = (uintptr_t)fd1, .size = PAGE_SIZE, .perm = PROT_RW | PROT_SHARE},
+  8015aa:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+    struct RegionOp ops[] = {
+  8015ae:	48 89 bd 70 ff ff ff 	mov    %rdi,-0x90(%rbp)
+  8015b5:	48 c7 85 78 ff ff ff 	movq   $0x1000,-0x88(%rbp)
+  8015bc:	00 10 00 00 
+  8015c0:	c7 45 84 46 00 00 00 	movl   $0x46,-0x7c(%rbp)
+  8015c7:	4c 89 6d 98          	mov    %r13,-0x68(%rbp)
+  8015cb:	48 c7 45 a0 00 10 00 	movq   $0x1000,-0x60(%rbp)
+  8015d2:	00 
+  8015d3:	c7 45 a8 01 00 00 00 	movl   $0x1,-0x58(%rbp)
+  8015da:	c7 45 ac 46 00 00 00 	movl   $0x46,-0x54(%rbp)
+  8015e1:	4c 89 6d b8          	mov    %r13,-0x48(%rbp)
+            {.type = REGION_MAP, .srcva = (uintptr_t)va, .dstva = (uintptr_t)fd2data(fd1), .size = PAGE_SIZE, .perm = PROT_RW | PROT_SHARE},
+  8015e5:	ff d3                	call   *%rbx
+    struct RegionOp ops[] = {
+  8015e7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8015eb:	48 c7 45 c8 00 10 00 	movq   $0x1000,-0x38(%rbp)
+  8015f2:	00 
+    if ((res = sys_region_batch(ops, sizeof ops / sizeof *ops)) < 0) goto err1;
+  8015f3:	be 04 00 00 00       	mov    $0x4,%esi
+  8015f8:	48 8d bd 30 ff ff ff 	lea    -0xd0(%rbp),%rdi
+  8015ff:	48 b8 c9 03 80 00 00 	movabs $0x8003c9,%rax
+  801606:	00 00 00 
+  801609:	ff d0                	call   *%rax
+  80160b:	89 c3                	mov    %eax,%ebx
+  80160d:	85 c0                	test   %eax,%eax
+  80160f:	0f 88 ad 00 00 00    	js     8016c2 <pipe+0x1c3>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  801615:	be 00 10 00 00       	mov    $0x1000,%esi
+  80161a:	4c 89 ef             	mov    %r13,%rdi
+  80161d:	48 b8 38 02 80 00 00 	movabs $0x800238,%rax
+  801624:	00 00 00 
+  801627:	ff d0                	call   *%rax
+  801629:	83 f8 02             	cmp    $0x2,%eax
+  80162c:	75 5f                	jne    80168d <pipe+0x18e>
+    fd0->fd_dev_id = devpipe.dev_id;
+  80162e:	a1 60 40 80 00 00 00 	movabs 0x804060,%eax
+  801635:	00 00 
+  801637:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80163b:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  80163d:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801641:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  801648:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  80164c:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  80164e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801652:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  801659:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80165d:	48 bb d1 06 80 00 00 	movabs $0x8006d1,%rbx
+  801664:	00 00 00 
+  801667:	ff d3                	call   *%rbx
+  801669:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  80166d:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  801671:	ff d3                	call   *%rbx
+  801673:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  801678:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  80167d:	89 d8                	mov    %ebx,%eax
+  80167f:	48 81 c4 b8 00 00 00 	add    $0xb8,%rsp
+  801686:	5b                   	pop    %rbx
+  801687:	41 5c                	pop    %r12
+  801689:	41 5d                	pop    %r13
+  80168b:	5d                   	pop    %rbp
+  80168c:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  80168d:	48 b9 b0 2d 80 00 00 	movabs $0x802db0,%rcx
+  801694:	00 00 00 
+  801697:	48 ba 87 2d 80 00 00 	movabs $0x802d87,%rdx
+  80169e:	00 00 00 
+  8016a1:	be 33 00 00 00       	mov    $0x33,%esi
+  8016a6:	48 bf 9c 2d 80 00 00 	movabs $0x802d9c,%rdi
+  8016ad:	00 00 00 
+  8016b0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016b5:	49 b8 27 1c 80 00 00 	movabs $0x801c27,%r8
+  8016bc:	00 00 00 
+  8016bf:	41 ff d0             	call   *%r8
+        ops[i].type = REGION_UNMAP;
+  8016c2:	c7 85 30 ff ff ff 02 	movl   $0x2,-0xd0(%rbp)
+  8016c9:	00 00 00 
+  8016cc:	c7 85 58 ff ff ff 02 	movl   $0x2,-0xa8(%rbp)
+  8016d3:	00 00 00 
+  8016d6:	c7 45 80 02 00 00 00 	movl   $0x2,-0x80(%rbp)
+  8016dd:	c7 45 a8 02 00 00 00 	movl   $0x2,-0x58(%rbp)
+    sys_region_batch(ops, sizeof ops / sizeof *ops);
+  8016e4:	be 04 00 00 00       	mov    $0x4,%esi
+  8016e9:	48 8d bd 30 ff ff ff 	lea    -0xd0(%rbp),%rdi
+  8016f0:	48 b8 c9 03 80 00 00 	movabs $0x8003c9,%rax
+  8016f7:	00 00 00 
+  8016fa:	ff d0                	call   *%rax
+  8016fc:	e9 7c ff ff ff       	jmp    80167d <pipe+0x17e>
+
+0000000000801701 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  801701:	55                   	push   %rbp
+  801702:	48 89 e5             	mov    %rsp,%rbp
+  801705:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  801709:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80170d:	48 b8 92 07 80 00 00 	movabs $0x800792,%rax
+  801714:	00 00 00 
+  801717:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801719:	85 c0                	test   %eax,%eax
+  80171b:	78 35                	js     801752 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  80171d:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801721:	48 b8 e3 06 80 00 00 	movabs $0x8006e3,%rax
+  801728:	00 00 00 
+  80172b:	ff d0                	call   *%rax
+  80172d:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  801730:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  801735:	be 00 10 00 00       	mov    $0x1000,%esi
+  80173a:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80173e:	48 b8 6a 02 80 00 00 	movabs $0x80026a,%rax
+  801745:	00 00 00 
+  801748:	ff d0                	call   *%rax
+  80174a:	85 c0                	test   %eax,%eax
+  80174c:	0f 94 c0             	sete   %al
+  80174f:	0f b6 c0             	movzbl %al,%eax
+}
+  801752:	c9                   	leave
+  801753:	c3                   	ret
+
+0000000000801754 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  801754:	48 89 f8             	mov    %rdi,%rax
+  801757:	48 c1 e8 27          	shr    $0x27,%rax
+  80175b:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  801762:	01 00 00 
+  801765:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  801769:	f6 c2 01             	test   $0x1,%dl
+  80176c:	74 6d                	je     8017db <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  80176e:	48 89 f8             	mov    %rdi,%rax
+  801771:	48 c1 e8 1e          	shr    $0x1e,%rax
+  801775:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  80177c:	01 00 00 
+  80177f:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  801783:	f6 c2 01             	test   $0x1,%dl
+  801786:	74 62                	je     8017ea <get_uvpt_entry+0x96>
+  801788:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  80178f:	01 00 00 
+  801792:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  801796:	f6 c2 80             	test   $0x80,%dl
+  801799:	75 4f                	jne    8017ea <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  80179b:	48 89 f8             	mov    %rdi,%rax
+  80179e:	48 c1 e8 15          	shr    $0x15,%rax
+  8017a2:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8017a9:	01 00 00 
+  8017ac:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8017b0:	f6 c2 01             	test   $0x1,%dl
+  8017b3:	74 44                	je     8017f9 <get_uvpt_entry+0xa5>
+  8017b5:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8017bc:	01 00 00 
+  8017bf:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8017c3:	f6 c2 80             	test   $0x80,%dl
+  8017c6:	75 31                	jne    8017f9 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  8017c8:	48 c1 ef 0c          	shr    $0xc,%rdi
+  8017cc:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8017d3:	01 00 00 
+  8017d6:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  8017da:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8017db:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  8017e2:	01 00 00 
+  8017e5:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8017e9:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8017ea:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8017f1:	01 00 00 
+  8017f4:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8017f8:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8017f9:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  801800:	01 00 00 
+  801803:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  801807:	c3                   	ret
+
+0000000000801808 <get_prot>:
+
+int
+get_prot(void *va) {
+  801808:	55                   	push   %rbp
+  801809:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  80180c:	48 b8 54 17 80 00 00 	movabs $0x801754,%rax
+  801813:	00 00 00 
+  801816:	ff d0                	call   *%rax
+  801818:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  80181b:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  801820:	89 c1                	mov    %eax,%ecx
+  801822:	83 c9 04             	or     $0x4,%ecx
+  801825:	f6 c2 01             	test   $0x1,%dl
+  801828:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  80182b:	89 c1                	mov    %eax,%ecx
+  80182d:	83 c9 02             	or     $0x2,%ecx
+  801830:	f6 c2 02             	test   $0x2,%dl
+  801833:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  801836:	89 c1                	mov    %eax,%ecx
+  801838:	83 c9 01             	or     $0x1,%ecx
+  80183b:	48 85 d2             	test   %rdx,%rdx
+  80183e:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  801841:	89 c1                	mov    %eax,%ecx
+  801843:	83 c9 40             	or     $0x40,%ecx
+  801846:	f6 c6 04             	test   $0x4,%dh
+  801849:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  80184c:	5d                   	pop    %rbp
+  80184d:	c3                   	ret
+
+000000000080184e <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  80184e:	55                   	push   %rbp
+  80184f:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  801852:	48 b8 54 17 80 00 00 	movabs $0x801754,%rax
+  801859:	00 00 00 
+  80185c:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  80185e:	48 c1 e8 06          	shr    $0x6,%rax
+  801862:	83 e0 01             	and    $0x1,%eax
+}
+  801865:	5d                   	pop    %rbp
+  801866:	c3                   	ret
+
+0000000000801867 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  801867:	55                   	push   %rbp
+  801868:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  80186b:	48 b8 54 17 80 00 00 	movabs $0x801754,%rax
+  801872:	00 00 00 
+  801875:	ff d0                	call   *%rax
+  801877:	83 e0 01             	and    $0x1,%eax
+}
+  80187a:	5d                   	pop    %rbp
+  80187b:	c3                   	ret
+
+000000000080187c <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  80187c:	55                   	push   %rbp
+  80187d:	48 89 e5             	mov    %rsp,%rbp
+  801880:	41 57                	push   %r15
+  801882:	41 56                	push   %r14
+  801884:	41 55                	push   %r13
+  801886:	41 54                	push   %r12
+  801888:	53                   	push   %rbx
+  801889:	48 83 ec 38          	sub    $0x38,%rsp
+  80188d:	49 89 f7             	mov    %rsi,%r15
+  801890:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+                    }
+                    continue;
+                }
+                for (int ptei = 0; ptei < PT_ENTRY_COUNT; ptei++) {
+                    uintptr_t pte_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, pdei, ptei, 0);
+                    pte_t pte = uvpt[VPT(pte_addr)];
+  801896:	49 bd 00 00 00 00 00 	movabs $0x10000000000,%r13
+  80189d:	01 00 00 
+  8018a0:	4d 89 e6             	mov    %r12,%r14
+  8018a3:	49 89 fc             	mov    %rdi,%r12
+  8018a6:	e9 19 01 00 00       	jmp    8019c4 <foreach_shared_region+0x148>
+  8018ab:	48 89 5d b0          	mov    %rbx,-0x50(%rbp)
+  8018af:	4c 89 75 a8          	mov    %r14,-0x58(%rbp)
+  8018b3:	eb 52                	jmp    801907 <foreach_shared_region+0x8b>
+                for (int ptei = 0; ptei < PT_ENTRY_COUNT; ptei++) {
+  8018b5:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8018bc:	48 81 fb 00 00 20 00 	cmp    $0x200000,%rbx
+  8018c3:	74 2e                	je     8018f3 <foreach_shared_region+0x77>
+                    uintptr_t pte_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, pdei, ptei, 0);
+  8018c5:	48 89 df             	mov    %rbx,%rdi
+  8018c8:	4c 09 f7             	or     %r14,%rdi
+                    pte_t pte = uvpt[VPT(pte_addr)];
+  8018cb:	48 89 f8             	mov    %rdi,%rax
+  8018ce:	48 c1 e8 0c          	shr    $0xc,%rax
+  8018d2:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+                    if ((pte & PTE_P) && (pte & PTE_SHARE)) {
+  8018d7:	25 01 04 00 00       	and    $0x401,%eax
+  8018dc:	48 3d 01 04 00 00    	cmp    $0x401,%rax
+  8018e2:	75 d1                	jne    8018b5 <foreach_shared_region+0x39>
+                        fun((void*)pte_addr, (void*)(pte_addr + PAGE_SIZE), arg);
+  8018e4:	48 8d b7 00 10 00 00 	lea    0x1000(%rdi),%rsi
+  8018eb:	4c 89 fa             	mov    %r15,%rdx
+  8018ee:	41 ff d4             	call   *%r12
+  8018f1:	eb c2                	jmp    8018b5 <foreach_shared_region+0x39>
+            for (int pdei = 0; pdei < PD_ENTRY_COUNT; pdei++) {
+  8018f3:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  8018fa:	00 
+  8018fb:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8018ff:	48 3d 00 00 00 40    	cmp    $0x40000000,%rax
+  801905:	74 46                	je     80194d <foreach_shared_region+0xd1>
+                uintptr_t pde_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, pdei, 0, 0);
+  801907:	4c 8b 75 c8          	mov    -0x38(%rbp),%r14
+  80190b:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80190f:	49 09 c6             	or     %rax,%r14
+                pde_t pde = uvpd[VPD(pde_addr)];
+  801912:	4c 89 f0             	mov    %r14,%rax
+  801915:	48 c1 e8 15          	shr    $0x15,%rax
+  801919:	48 b9 00 00 00 80 00 	movabs $0x10080000000,%rcx
+  801920:	01 00 00 
+  801923:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+                if (!(pde & PTE_P)) {
+  801927:	a8 01                	test   $0x1,%al
+  801929:	74 c8                	je     8018f3 <foreach_shared_region+0x77>
+                if (pde & PTE_PS) {
+  80192b:	48 89 c3             	mov    %rax,%rbx
+  80192e:	81 e3 80 00 00 00    	and    $0x80,%ebx
+  801934:	74 8f                	je     8018c5 <foreach_shared_region+0x49>
+                    if (pde & PTE_SHARE) {
+  801936:	f6 c4 04             	test   $0x4,%ah
+  801939:	74 b8                	je     8018f3 <foreach_shared_region+0x77>
+                        fun((void*)pde_addr, (void*)(pde_addr + 1024 * 1024 * 2), arg);
+  80193b:	49 8d b6 00 00 20 00 	lea    0x200000(%r14),%rsi
+  801942:	4c 89 fa             	mov    %r15,%rdx
+  801945:	4c 89 f7             	mov    %r14,%rdi
+  801948:	41 ff d4             	call   *%r12
+  80194b:	eb a6                	jmp    8018f3 <foreach_shared_region+0x77>
+  80194d:	48 8b 5d b0          	mov    -0x50(%rbp),%rbx
+  801951:	4c 8b 75 a8          	mov    -0x58(%rbp),%r14
+        for (int pdpei = 0; pdpei < PDP_ENTRY_COUNT; pdpei++) {
+  801955:	48 81 c3 00 00 00 40 	add    $0x40000000,%rbx
+  80195c:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  801963:	00 00 00 
+  801966:	48 39 c3             	cmp    %rax,%rbx
+  801969:	74 4c                	je     8019b7 <foreach_shared_region+0x13b>
+            uintptr_t pdpe_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, 0, 0, 0);
+  80196b:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  80196f:	48 09 d8             	or     %rbx,%rax
+  801972:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+            pdpe_t pdpe = uvpdp[VPDP(pdpe_addr)];
+  801976:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80197a:	48 b9 00 00 40 80 00 	movabs $0x10080400000,%rcx
+  801981:	01 00 00 
+  801984:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+            if (!(pdpe & PTE_P)) {
+  801988:	a8 01                	test   $0x1,%al
+  80198a:	74 c9                	je     801955 <foreach_shared_region+0xd9>
+            if (pdpe & PTE_PS) {
+  80198c:	48 89 c1             	mov    %rax,%rcx
+  80198f:	81 e1 80 00 00 00    	and    $0x80,%ecx
+  801995:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  801999:	0f 84 0c ff ff ff    	je     8018ab <foreach_shared_region+0x2f>
+                if (pdpe & PTE_SHARE) {
+  80199f:	f6 c4 04             	test   $0x4,%ah
+  8019a2:	74 b1                	je     801955 <foreach_shared_region+0xd9>
+                    fun((void*)pdpe_addr, (void*)(pdpe_addr + 1024 * 1024 * 1024), arg); 
+  8019a4:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  8019a8:	48 8d b7 00 00 00 40 	lea    0x40000000(%rdi),%rsi
+  8019af:	4c 89 fa             	mov    %r15,%rdx
+  8019b2:	41 ff d4             	call   *%r12
+  8019b5:	eb 9e                	jmp    801955 <foreach_shared_region+0xd9>
+    for (int pml4ei = 0; pml4ei < PML4_ENTRY_COUNT; pml4ei++) {
+  8019b7:	49 83 c6 01          	add    $0x1,%r14
+  8019bb:	49 81 fe 00 02 00 00 	cmp    $0x200,%r14
+  8019c2:	74 24                	je     8019e8 <foreach_shared_region+0x16c>
+        pml4e_t pml4e = uvpml4[VPML4(pml4_addr)];
+  8019c4:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  8019cb:	01 00 00 
+  8019ce:	4a 8b 04 f0          	mov    (%rax,%r14,8),%rax
+        if (!(pml4e & PTE_P)) {
+  8019d2:	a8 01                	test   $0x1,%al
+  8019d4:	74 e1                	je     8019b7 <foreach_shared_region+0x13b>
+  8019d6:	4c 89 f0             	mov    %r14,%rax
+  8019d9:	48 c1 e0 27          	shl    $0x27,%rax
+  8019dd:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8019e1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8019e6:	eb 83                	jmp    80196b <foreach_shared_region+0xef>
+            }
+        }
+    }
+    
+    return 0;
+}
+  8019e8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019ed:	48 83 c4 38          	add    $0x38,%rsp
+  8019f1:	5b                   	pop    %rbx
+  8019f2:	41 5c                	pop    %r12
+  8019f4:	41 5d                	pop    %r13
+  8019f6:	41 5e                	pop    %r14
+  8019f8:	41 5f                	pop    %r15
+  8019fa:	5d                   	pop    %rbp
+  8019fb:	c3                   	ret
+
+00000000008019fc <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  8019fc:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a01:	c3                   	ret
+
+0000000000801a02 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  801a02:	55                   	push   %rbp
+  801a03:	48 89 e5             	mov    %rsp,%rbp
+  801a06:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  801a09:	48 be d4 2d 80 00 00 	movabs $0x802dd4,%rsi
+  801a10:	00 00 00 
+  801a13:	48 b8 9c 26 80 00 00 	movabs $0x80269c,%rax
+  801a1a:	00 00 00 
+  801a1d:	ff d0                	call   *%rax
+    return 0;
+}
+  801a1f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a24:	5d                   	pop    %rbp
+  801a25:	c3                   	ret
+
+0000000000801a26 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  801a26:	55                   	push   %rbp
+  801a27:	48 89 e5             	mov    %rsp,%rbp
+  801a2a:	41 57                	push   %r15
+  801a2c:	41 56                	push   %r14
+  801a2e:	41 55                	push   %r13
+  801a30:	41 54                	push   %r12
+  801a32:	53                   	push   %rbx
+  801a33:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  801a3a:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  801a41:	48 85 d2             	test   %rdx,%rdx
+  801a44:	74 7a                	je     801ac0 <devcons_write+0x9a>
+  801a46:	49 89 d6             	mov    %rdx,%r14
+  801a49:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  801a4f:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  801a54:	49 bf 96 28 80 00 00 	movabs $0x802896,%r15
+  801a5b:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  801a5e:	4c 89 f3             	mov    %r14,%rbx
+  801a61:	48 29 f3             	sub    %rsi,%rbx
+  801a64:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  801a69:	48 39 c3             	cmp    %rax,%rbx
+  801a6c:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  801a70:	4c 63 eb             	movslq %ebx,%r13
+  801a73:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  801a7a:	48 01 c6             	add    %rax,%rsi
+  801a7d:	4c 89 ea             	mov    %r13,%rdx
+  801a80:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  801a87:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  801a8a:	4c 89 ee             	mov    %r13,%rsi
+  801a8d:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  801a94:	48 b8 0d 01 80 00 00 	movabs $0x80010d,%rax
+  801a9b:	00 00 00 
+  801a9e:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  801aa0:	41 01 dc             	add    %ebx,%r12d
+  801aa3:	49 63 f4             	movslq %r12d,%rsi
+  801aa6:	4c 39 f6             	cmp    %r14,%rsi
+  801aa9:	72 b3                	jb     801a5e <devcons_write+0x38>
+    return res;
+  801aab:	49 63 c4             	movslq %r12d,%rax
+}
+  801aae:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  801ab5:	5b                   	pop    %rbx
+  801ab6:	41 5c                	pop    %r12
+  801ab8:	41 5d                	pop    %r13
+  801aba:	41 5e                	pop    %r14
+  801abc:	41 5f                	pop    %r15
+  801abe:	5d                   	pop    %rbp
+  801abf:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  801ac0:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  801ac6:	eb e3                	jmp    801aab <devcons_write+0x85>
+
+0000000000801ac8 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  801ac8:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  801acb:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ad0:	48 85 c0             	test   %rax,%rax
+  801ad3:	74 55                	je     801b2a <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  801ad5:	55                   	push   %rbp
+  801ad6:	48 89 e5             	mov    %rsp,%rbp
+  801ad9:	41 55                	push   %r13
+  801adb:	41 54                	push   %r12
+  801add:	53                   	push   %rbx
+  801ade:	48 83 ec 08          	sub    $0x8,%rsp
+  801ae2:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  801ae5:	48 bb 3a 01 80 00 00 	movabs $0x80013a,%rbx
+  801aec:	00 00 00 
+  801aef:	49 bc 07 02 80 00 00 	movabs $0x800207,%r12
+  801af6:	00 00 00 
+  801af9:	eb 03                	jmp    801afe <devcons_read+0x36>
+  801afb:	41 ff d4             	call   *%r12
+  801afe:	ff d3                	call   *%rbx
+  801b00:	85 c0                	test   %eax,%eax
+  801b02:	74 f7                	je     801afb <devcons_read+0x33>
+    if (c < 0) return c;
+  801b04:	48 63 d0             	movslq %eax,%rdx
+  801b07:	78 13                	js     801b1c <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  801b09:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b0e:	83 f8 04             	cmp    $0x4,%eax
+  801b11:	74 09                	je     801b1c <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  801b13:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  801b17:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  801b1c:	48 89 d0             	mov    %rdx,%rax
+  801b1f:	48 83 c4 08          	add    $0x8,%rsp
+  801b23:	5b                   	pop    %rbx
+  801b24:	41 5c                	pop    %r12
+  801b26:	41 5d                	pop    %r13
+  801b28:	5d                   	pop    %rbp
+  801b29:	c3                   	ret
+  801b2a:	48 89 d0             	mov    %rdx,%rax
+  801b2d:	c3                   	ret
+
+0000000000801b2e <cputchar>:
+cputchar(int ch) {
+  801b2e:	55                   	push   %rbp
+  801b2f:	48 89 e5             	mov    %rsp,%rbp
+  801b32:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  801b36:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  801b3a:	be 01 00 00 00       	mov    $0x1,%esi
+  801b3f:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  801b43:	48 b8 0d 01 80 00 00 	movabs $0x80010d,%rax
+  801b4a:	00 00 00 
+  801b4d:	ff d0                	call   *%rax
+}
+  801b4f:	c9                   	leave
+  801b50:	c3                   	ret
+
+0000000000801b51 <getchar>:
+getchar(void) {
+  801b51:	55                   	push   %rbp
+  801b52:	48 89 e5             	mov    %rsp,%rbp
+  801b55:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  801b59:	ba 01 00 00 00       	mov    $0x1,%edx
+  801b5e:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  801b62:	bf 00 00 00 00       	mov    $0x0,%edi
+  801b67:	48 b8 75 0a 80 00 00 	movabs $0x800a75,%rax
+  801b6e:	00 00 00 
+  801b71:	ff d0                	call   *%rax
+  801b73:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  801b75:	85 c0                	test   %eax,%eax
+  801b77:	78 06                	js     801b7f <getchar+0x2e>
+  801b79:	74 08                	je     801b83 <getchar+0x32>
+  801b7b:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  801b7f:	89 d0                	mov    %edx,%eax
+  801b81:	c9                   	leave
+  801b82:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  801b83:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  801b88:	eb f5                	jmp    801b7f <getchar+0x2e>
+
+0000000000801b8a <iscons>:
+iscons(int fdnum) {
+  801b8a:	55                   	push   %rbp
+  801b8b:	48 89 e5             	mov    %rsp,%rbp
+  801b8e:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  801b92:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801b96:	48 b8 92 07 80 00 00 	movabs $0x800792,%rax
+  801b9d:	00 00 00 
+  801ba0:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801ba2:	85 c0                	test   %eax,%eax
+  801ba4:	78 18                	js     801bbe <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  801ba6:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801baa:	48 b8 a0 40 80 00 00 	movabs $0x8040a0,%rax
+  801bb1:	00 00 00 
+  801bb4:	8b 00                	mov    (%rax),%eax
+  801bb6:	39 02                	cmp    %eax,(%rdx)
+  801bb8:	0f 94 c0             	sete   %al
+  801bbb:	0f b6 c0             	movzbl %al,%eax
+}
+  801bbe:	c9                   	leave
+  801bbf:	c3                   	ret
+
+0000000000801bc0 <opencons>:
+opencons(void) {
+  801bc0:	55                   	push   %rbp
+  801bc1:	48 89 e5             	mov    %rsp,%rbp
+  801bc4:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  801bc8:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  801bcc:	48 b8 78 07 80 00 00 	movabs $0x800778,%rax
+  801bd3:	00 00 00 
+  801bd6:	ff d0                	call   *%rax
+  801bd8:	85 c0                	test   %eax,%eax
+  801bda:	78 49                	js     801c25 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  801bdc:	b9 46 00 00 00       	mov    $0x46,%ecx
+  801be1:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801be6:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  801bea:	bf 00 00 00 00       	mov    $0x0,%edi
+  801bef:	48 b8 96 02 80 00 00 	movabs $0x800296,%rax
+  801bf6:	00 00 00 
+  801bf9:	ff d0                	call   *%rax
+  801bfb:	85 c0                	test   %eax,%eax
+  801bfd:	78 26                	js     801c25 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  801bff:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801c03:	a1 a0 40 80 00 00 00 	movabs 0x8040a0,%eax
+  801c0a:	00 00 
+  801c0c:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  801c0e:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801c12:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  801c19:	48 b8 d1 06 80 00 00 	movabs $0x8006d1,%rax
+  801c20:	00 00 00 
+  801c23:	ff d0                	call   *%rax
+}
+  801c25:	c9                   	leave
+  801c26:	c3                   	ret
+
+0000000000801c27 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  801c27:	55                   	push   %rbp
+  801c28:	48 89 e5             	mov    %rsp,%rbp
+  801c2b:	41 56                	push   %r14
+  801c2d:	41 55                	push   %r13
+  801c2f:	41 54                	push   %r12
+  801c31:	53                   	push   %rbx
+  801c32:	48 83 ec 50          	sub    $0x50,%rsp
+  801c36:	49 89 fc             	mov    %rdi,%r12
+  801c39:	41 89 f5             	mov    %esi,%r13d
+  801c3c:	48 89 d3             	mov    %rdx,%rbx
+  801c3f:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  801c43:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  801c47:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  801c4b:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  801c52:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801c56:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  801c5a:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  801c5e:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  801c62:	48 b8 00 40 80 00 00 	movabs $0x804000,%rax
+  801c69:	00 00 00 
+  801c6c:	4c 8b 30             	mov    (%rax),%r14
+  801c6f:	48 b8 d6 01 80 00 00 	movabs $0x8001d6,%rax
+  801c76:	00 00 00 
+  801c79:	ff d0                	call   *%rax
+  801c7b:	89 c6                	mov    %eax,%esi
+  801c7d:	45 89 e8             	mov    %r13d,%r8d
+  801c80:	4c 89 e1             	mov    %r12,%rcx
+  801c83:	4c 89 f2             	mov    %r14,%rdx
+  801c86:	48 bf e0 2d 80 00 00 	movabs $0x802de0,%rdi
+  801c8d:	00 00 00 
+  801c90:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c95:	49 bc 77 1d 80 00 00 	movabs $0x801d77,%r12
+  801c9c:	00 00 00 
+  801c9f:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  801ca2:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  801ca6:	48 89 df             	mov    %rbx,%rdi
+  801ca9:	48 b8 13 1d 80 00 00 	movabs $0x801d13,%rax
+  801cb0:	00 00 00 
+  801cb3:	ff d0                	call   *%rax
+    cprintf("\n");
+  801cb5:	48 bf 2b 2d 80 00 00 	movabs $0x802d2b,%rdi
+  801cbc:	00 00 00 
+  801cbf:	b8 00 00 00 00       	mov    $0x0,%eax
+  801cc4:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  801cc7:	cc                   	int3
+  801cc8:	eb fd                	jmp    801cc7 <_panic+0xa0>
+
+0000000000801cca <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  801cca:	55                   	push   %rbp
+  801ccb:	48 89 e5             	mov    %rsp,%rbp
+  801cce:	53                   	push   %rbx
+  801ccf:	48 83 ec 08          	sub    $0x8,%rsp
+  801cd3:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  801cd6:	8b 06                	mov    (%rsi),%eax
+  801cd8:	8d 50 01             	lea    0x1(%rax),%edx
+  801cdb:	89 16                	mov    %edx,(%rsi)
+  801cdd:	48 98                	cltq
+  801cdf:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  801ce4:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  801cea:	74 0a                	je     801cf6 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  801cec:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  801cf0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801cf4:	c9                   	leave
+  801cf5:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  801cf6:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  801cfa:	be ff 00 00 00       	mov    $0xff,%esi
+  801cff:	48 b8 0d 01 80 00 00 	movabs $0x80010d,%rax
+  801d06:	00 00 00 
+  801d09:	ff d0                	call   *%rax
+        state->offset = 0;
+  801d0b:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  801d11:	eb d9                	jmp    801cec <putch+0x22>
+
+0000000000801d13 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  801d13:	55                   	push   %rbp
+  801d14:	48 89 e5             	mov    %rsp,%rbp
+  801d17:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  801d1e:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  801d21:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  801d28:	b9 21 00 00 00       	mov    $0x21,%ecx
+  801d2d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d32:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  801d35:	48 89 f1             	mov    %rsi,%rcx
+  801d38:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  801d3f:	48 bf ca 1c 80 00 00 	movabs $0x801cca,%rdi
+  801d46:	00 00 00 
+  801d49:	48 b8 c7 1e 80 00 00 	movabs $0x801ec7,%rax
+  801d50:	00 00 00 
+  801d53:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  801d55:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  801d5c:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  801d63:	48 b8 0d 01 80 00 00 	movabs $0x80010d,%rax
+  801d6a:	00 00 00 
+  801d6d:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  801d6f:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  801d75:	c9                   	leave
+  801d76:	c3                   	ret
+
+0000000000801d77 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  801d77:	55                   	push   %rbp
+  801d78:	48 89 e5             	mov    %rsp,%rbp
+  801d7b:	48 83 ec 50          	sub    $0x50,%rsp
+  801d7f:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  801d83:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  801d87:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801d8b:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  801d8f:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  801d93:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  801d9a:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801d9e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801da2:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  801da6:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  801daa:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  801dae:	48 b8 13 1d 80 00 00 	movabs $0x801d13,%rax
+  801db5:	00 00 00 
+  801db8:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  801dba:	c9                   	leave
+  801dbb:	c3                   	ret
+
+0000000000801dbc <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  801dbc:	55                   	push   %rbp
+  801dbd:	48 89 e5             	mov    %rsp,%rbp
+  801dc0:	41 57                	push   %r15
+  801dc2:	41 56                	push   %r14
+  801dc4:	41 55                	push   %r13
+  801dc6:	41 54                	push   %r12
+  801dc8:	53                   	push   %rbx
+  801dc9:	48 83 ec 18          	sub    $0x18,%rsp
+  801dcd:	49 89 fc             	mov    %rdi,%r12
+  801dd0:	49 89 f5             	mov    %rsi,%r13
+  801dd3:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801dd7:	8b 45 10             	mov    0x10(%rbp),%eax
+  801dda:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  801ddd:	41 89 cf             	mov    %ecx,%r15d
+  801de0:	4c 39 fa             	cmp    %r15,%rdx
+  801de3:	73 5b                	jae    801e40 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  801de5:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  801de9:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  801ded:	85 db                	test   %ebx,%ebx
+  801def:	7e 0e                	jle    801dff <print_num+0x43>
+            putch(padc, put_arg);
+  801df1:	4c 89 ee             	mov    %r13,%rsi
+  801df4:	44 89 f7             	mov    %r14d,%edi
+  801df7:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  801dfa:	83 eb 01             	sub    $0x1,%ebx
+  801dfd:	75 f2                	jne    801df1 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  801dff:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  801e03:	48 b9 14 2e 80 00 00 	movabs $0x802e14,%rcx
+  801e0a:	00 00 00 
+  801e0d:	48 b8 03 2e 80 00 00 	movabs $0x802e03,%rax
+  801e14:	00 00 00 
+  801e17:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  801e1b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801e1f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e24:	49 f7 f7             	div    %r15
+  801e27:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  801e2b:	4c 89 ee             	mov    %r13,%rsi
+  801e2e:	41 ff d4             	call   *%r12
+}
+  801e31:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  801e35:	5b                   	pop    %rbx
+  801e36:	41 5c                	pop    %r12
+  801e38:	41 5d                	pop    %r13
+  801e3a:	41 5e                	pop    %r14
+  801e3c:	41 5f                	pop    %r15
+  801e3e:	5d                   	pop    %rbp
+  801e3f:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  801e40:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801e44:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e49:	49 f7 f7             	div    %r15
+  801e4c:	48 83 ec 08          	sub    $0x8,%rsp
+  801e50:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  801e54:	52                   	push   %rdx
+  801e55:	45 0f be c9          	movsbl %r9b,%r9d
+  801e59:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  801e5d:	48 89 c2             	mov    %rax,%rdx
+  801e60:	48 b8 bc 1d 80 00 00 	movabs $0x801dbc,%rax
+  801e67:	00 00 00 
+  801e6a:	ff d0                	call   *%rax
+  801e6c:	48 83 c4 10          	add    $0x10,%rsp
+  801e70:	eb 8d                	jmp    801dff <print_num+0x43>
+
+0000000000801e72 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  801e72:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  801e76:	48 8b 06             	mov    (%rsi),%rax
+  801e79:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  801e7d:	73 0a                	jae    801e89 <sprintputch+0x17>
+        *state->start++ = ch;
+  801e7f:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801e83:	48 89 16             	mov    %rdx,(%rsi)
+  801e86:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  801e89:	c3                   	ret
+
+0000000000801e8a <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  801e8a:	55                   	push   %rbp
+  801e8b:	48 89 e5             	mov    %rsp,%rbp
+  801e8e:	48 83 ec 50          	sub    $0x50,%rsp
+  801e92:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801e96:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  801e9a:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  801e9e:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  801ea5:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801ea9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801ead:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  801eb1:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  801eb5:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  801eb9:	48 b8 c7 1e 80 00 00 	movabs $0x801ec7,%rax
+  801ec0:	00 00 00 
+  801ec3:	ff d0                	call   *%rax
+}
+  801ec5:	c9                   	leave
+  801ec6:	c3                   	ret
+
+0000000000801ec7 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  801ec7:	55                   	push   %rbp
+  801ec8:	48 89 e5             	mov    %rsp,%rbp
+  801ecb:	41 57                	push   %r15
+  801ecd:	41 56                	push   %r14
+  801ecf:	41 55                	push   %r13
+  801ed1:	41 54                	push   %r12
+  801ed3:	53                   	push   %rbx
+  801ed4:	48 83 ec 38          	sub    $0x38,%rsp
+  801ed8:	49 89 fe             	mov    %rdi,%r14
+  801edb:	49 89 f5             	mov    %rsi,%r13
+  801ede:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  801ee1:	48 8b 01             	mov    (%rcx),%rax
+  801ee4:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  801ee8:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  801eec:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801ef0:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  801ef4:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  801ef8:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  801efc:	0f b6 3b             	movzbl (%rbx),%edi
+  801eff:	40 80 ff 25          	cmp    $0x25,%dil
+  801f03:	74 18                	je     801f1d <vprintfmt+0x56>
+            if (!ch) return;
+  801f05:	40 84 ff             	test   %dil,%dil
+  801f08:	0f 84 b1 06 00 00    	je     8025bf <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  801f0e:	40 0f b6 ff          	movzbl %dil,%edi
+  801f12:	4c 89 ee             	mov    %r13,%rsi
+  801f15:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  801f18:	4c 89 e3             	mov    %r12,%rbx
+  801f1b:	eb db                	jmp    801ef8 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  801f1d:	be 00 00 00 00       	mov    $0x0,%esi
+  801f22:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  801f26:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  801f2b:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  801f31:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  801f38:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  801f3c:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  801f41:	41 0f b6 04 24       	movzbl (%r12),%eax
+  801f46:	88 45 a0             	mov    %al,-0x60(%rbp)
+  801f49:	83 e8 23             	sub    $0x23,%eax
+  801f4c:	3c 57                	cmp    $0x57,%al
+  801f4e:	0f 87 51 06 00 00    	ja     8025a5 <vprintfmt+0x6de>
+  801f54:	0f b6 c0             	movzbl %al,%eax
+  801f57:	48 b9 c0 2f 80 00 00 	movabs $0x802fc0,%rcx
+  801f5e:	00 00 00 
+  801f61:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  801f64:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  801f67:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  801f6b:	eb cf                	jmp    801f3c <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  801f6d:	49 89 dc             	mov    %rbx,%r12
+  801f70:	be 01 00 00 00       	mov    $0x1,%esi
+  801f75:	eb c5                	jmp    801f3c <vprintfmt+0x75>
+            padc = ch;
+  801f77:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  801f7b:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  801f7e:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801f81:	eb b9                	jmp    801f3c <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  801f83:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801f86:	83 f8 2f             	cmp    $0x2f,%eax
+  801f89:	77 24                	ja     801faf <vprintfmt+0xe8>
+  801f8b:	89 c1                	mov    %eax,%ecx
+  801f8d:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  801f91:	83 c0 08             	add    $0x8,%eax
+  801f94:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801f97:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  801f9a:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  801f9d:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  801fa1:	79 99                	jns    801f3c <vprintfmt+0x75>
+                width = precision;
+  801fa3:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  801fa7:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  801fad:	eb 8d                	jmp    801f3c <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  801faf:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  801fb3:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  801fb7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801fbb:	eb da                	jmp    801f97 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  801fbd:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  801fc2:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  801fc6:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  801fcc:	3c 39                	cmp    $0x39,%al
+  801fce:	77 1c                	ja     801fec <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  801fd0:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  801fd4:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  801fd8:	0f b6 c0             	movzbl %al,%eax
+  801fdb:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  801fe0:	0f b6 03             	movzbl (%rbx),%eax
+  801fe3:	3c 39                	cmp    $0x39,%al
+  801fe5:	76 e9                	jbe    801fd0 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  801fe7:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  801fea:	eb b1                	jmp    801f9d <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  801fec:	49 89 dc             	mov    %rbx,%r12
+  801fef:	eb ac                	jmp    801f9d <vprintfmt+0xd6>
+            width = MAX(0, width);
+  801ff1:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  801ff4:	85 c9                	test   %ecx,%ecx
+  801ff6:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ffb:	0f 49 c1             	cmovns %ecx,%eax
+  801ffe:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  802001:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  802004:	e9 33 ff ff ff       	jmp    801f3c <vprintfmt+0x75>
+            lflag++;
+  802009:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  80200c:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80200f:	e9 28 ff ff ff       	jmp    801f3c <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  802014:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802017:	83 f8 2f             	cmp    $0x2f,%eax
+  80201a:	77 19                	ja     802035 <vprintfmt+0x16e>
+  80201c:	89 c2                	mov    %eax,%edx
+  80201e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802022:	83 c0 08             	add    $0x8,%eax
+  802025:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802028:	8b 3a                	mov    (%rdx),%edi
+  80202a:	4c 89 ee             	mov    %r13,%rsi
+  80202d:	41 ff d6             	call   *%r14
+            break;
+  802030:	e9 c3 fe ff ff       	jmp    801ef8 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  802035:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802039:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80203d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802041:	eb e5                	jmp    802028 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  802043:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802046:	83 f8 2f             	cmp    $0x2f,%eax
+  802049:	77 5a                	ja     8020a5 <vprintfmt+0x1de>
+  80204b:	89 c2                	mov    %eax,%edx
+  80204d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802051:	83 c0 08             	add    $0x8,%eax
+  802054:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  802057:	8b 02                	mov    (%rdx),%eax
+  802059:	89 c1                	mov    %eax,%ecx
+  80205b:	f7 d9                	neg    %ecx
+  80205d:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  802060:	83 f9 15             	cmp    $0x15,%ecx
+  802063:	7f 4e                	jg     8020b3 <vprintfmt+0x1ec>
+  802065:	48 63 c1             	movslq %ecx,%rax
+  802068:	48 ba 80 32 80 00 00 	movabs $0x803280,%rdx
+  80206f:	00 00 00 
+  802072:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802076:	48 85 c0             	test   %rax,%rax
+  802079:	74 38                	je     8020b3 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  80207b:	48 89 c1             	mov    %rax,%rcx
+  80207e:	48 ba 99 2d 80 00 00 	movabs $0x802d99,%rdx
+  802085:	00 00 00 
+  802088:	4c 89 ee             	mov    %r13,%rsi
+  80208b:	4c 89 f7             	mov    %r14,%rdi
+  80208e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802093:	49 b8 8a 1e 80 00 00 	movabs $0x801e8a,%r8
+  80209a:	00 00 00 
+  80209d:	41 ff d0             	call   *%r8
+  8020a0:	e9 53 fe ff ff       	jmp    801ef8 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  8020a5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8020a9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8020ad:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8020b1:	eb a4                	jmp    802057 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  8020b3:	48 ba 2c 2e 80 00 00 	movabs $0x802e2c,%rdx
+  8020ba:	00 00 00 
+  8020bd:	4c 89 ee             	mov    %r13,%rsi
+  8020c0:	4c 89 f7             	mov    %r14,%rdi
+  8020c3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020c8:	49 b8 8a 1e 80 00 00 	movabs $0x801e8a,%r8
+  8020cf:	00 00 00 
+  8020d2:	41 ff d0             	call   *%r8
+  8020d5:	e9 1e fe ff ff       	jmp    801ef8 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8020da:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8020dd:	83 f8 2f             	cmp    $0x2f,%eax
+  8020e0:	77 6c                	ja     80214e <vprintfmt+0x287>
+  8020e2:	89 c2                	mov    %eax,%edx
+  8020e4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8020e8:	83 c0 08             	add    $0x8,%eax
+  8020eb:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8020ee:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  8020f1:	48 85 d2             	test   %rdx,%rdx
+  8020f4:	48 b8 25 2e 80 00 00 	movabs $0x802e25,%rax
+  8020fb:	00 00 00 
+  8020fe:	48 0f 45 c2          	cmovne %rdx,%rax
+  802102:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  802106:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  80210a:	7e 06                	jle    802112 <vprintfmt+0x24b>
+  80210c:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  802110:	75 4a                	jne    80215c <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  802112:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  802116:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  80211a:	0f b6 00             	movzbl (%rax),%eax
+  80211d:	84 c0                	test   %al,%al
+  80211f:	0f 85 9a 00 00 00    	jne    8021bf <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  802125:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  802128:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  80212c:	85 c0                	test   %eax,%eax
+  80212e:	0f 8e c4 fd ff ff    	jle    801ef8 <vprintfmt+0x31>
+  802134:	4c 89 ee             	mov    %r13,%rsi
+  802137:	bf 20 00 00 00       	mov    $0x20,%edi
+  80213c:	41 ff d6             	call   *%r14
+  80213f:	41 83 ec 01          	sub    $0x1,%r12d
+  802143:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  802147:	75 eb                	jne    802134 <vprintfmt+0x26d>
+  802149:	e9 aa fd ff ff       	jmp    801ef8 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  80214e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802152:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802156:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80215a:	eb 92                	jmp    8020ee <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  80215c:	49 63 f7             	movslq %r15d,%rsi
+  80215f:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  802163:	48 b8 79 26 80 00 00 	movabs $0x802679,%rax
+  80216a:	00 00 00 
+  80216d:	ff d0                	call   *%rax
+  80216f:	48 89 c2             	mov    %rax,%rdx
+  802172:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  802175:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  802177:	8d 70 ff             	lea    -0x1(%rax),%esi
+  80217a:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  80217d:	85 c0                	test   %eax,%eax
+  80217f:	7e 91                	jle    802112 <vprintfmt+0x24b>
+  802181:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  802186:	4c 89 ee             	mov    %r13,%rsi
+  802189:	44 89 e7             	mov    %r12d,%edi
+  80218c:	41 ff d6             	call   *%r14
+  80218f:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  802193:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  802196:	83 f8 ff             	cmp    $0xffffffff,%eax
+  802199:	75 eb                	jne    802186 <vprintfmt+0x2bf>
+  80219b:	e9 72 ff ff ff       	jmp    802112 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8021a0:	0f b6 f8             	movzbl %al,%edi
+  8021a3:	4c 89 ee             	mov    %r13,%rsi
+  8021a6:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8021a9:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8021ad:	49 83 c4 01          	add    $0x1,%r12
+  8021b1:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  8021b7:	84 c0                	test   %al,%al
+  8021b9:	0f 84 66 ff ff ff    	je     802125 <vprintfmt+0x25e>
+  8021bf:	45 85 ff             	test   %r15d,%r15d
+  8021c2:	78 0a                	js     8021ce <vprintfmt+0x307>
+  8021c4:	41 83 ef 01          	sub    $0x1,%r15d
+  8021c8:	0f 88 57 ff ff ff    	js     802125 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8021ce:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  8021d2:	74 cc                	je     8021a0 <vprintfmt+0x2d9>
+  8021d4:	8d 50 e0             	lea    -0x20(%rax),%edx
+  8021d7:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  8021dc:	80 fa 5e             	cmp    $0x5e,%dl
+  8021df:	77 c2                	ja     8021a3 <vprintfmt+0x2dc>
+  8021e1:	eb bd                	jmp    8021a0 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  8021e3:	40 84 f6             	test   %sil,%sil
+  8021e6:	75 26                	jne    80220e <vprintfmt+0x347>
+    switch (lflag) {
+  8021e8:	85 d2                	test   %edx,%edx
+  8021ea:	74 59                	je     802245 <vprintfmt+0x37e>
+  8021ec:	83 fa 01             	cmp    $0x1,%edx
+  8021ef:	74 7b                	je     80226c <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  8021f1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8021f4:	83 f8 2f             	cmp    $0x2f,%eax
+  8021f7:	0f 87 96 00 00 00    	ja     802293 <vprintfmt+0x3cc>
+  8021fd:	89 c2                	mov    %eax,%edx
+  8021ff:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802203:	83 c0 08             	add    $0x8,%eax
+  802206:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802209:	4c 8b 22             	mov    (%rdx),%r12
+  80220c:	eb 17                	jmp    802225 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  80220e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802211:	83 f8 2f             	cmp    $0x2f,%eax
+  802214:	77 21                	ja     802237 <vprintfmt+0x370>
+  802216:	89 c2                	mov    %eax,%edx
+  802218:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80221c:	83 c0 08             	add    $0x8,%eax
+  80221f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802222:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  802225:	4d 85 e4             	test   %r12,%r12
+  802228:	78 7a                	js     8022a4 <vprintfmt+0x3dd>
+            num = i;
+  80222a:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  80222d:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  802232:	e9 50 02 00 00       	jmp    802487 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  802237:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80223b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80223f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802243:	eb dd                	jmp    802222 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  802245:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802248:	83 f8 2f             	cmp    $0x2f,%eax
+  80224b:	77 11                	ja     80225e <vprintfmt+0x397>
+  80224d:	89 c2                	mov    %eax,%edx
+  80224f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802253:	83 c0 08             	add    $0x8,%eax
+  802256:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802259:	4c 63 22             	movslq (%rdx),%r12
+  80225c:	eb c7                	jmp    802225 <vprintfmt+0x35e>
+  80225e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802262:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802266:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80226a:	eb ed                	jmp    802259 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  80226c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80226f:	83 f8 2f             	cmp    $0x2f,%eax
+  802272:	77 11                	ja     802285 <vprintfmt+0x3be>
+  802274:	89 c2                	mov    %eax,%edx
+  802276:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80227a:	83 c0 08             	add    $0x8,%eax
+  80227d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802280:	4c 8b 22             	mov    (%rdx),%r12
+  802283:	eb a0                	jmp    802225 <vprintfmt+0x35e>
+  802285:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802289:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80228d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802291:	eb ed                	jmp    802280 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  802293:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802297:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80229b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80229f:	e9 65 ff ff ff       	jmp    802209 <vprintfmt+0x342>
+                putch('-', put_arg);
+  8022a4:	4c 89 ee             	mov    %r13,%rsi
+  8022a7:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  8022ac:	41 ff d6             	call   *%r14
+                i = -i;
+  8022af:	49 f7 dc             	neg    %r12
+  8022b2:	e9 73 ff ff ff       	jmp    80222a <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  8022b7:	40 84 f6             	test   %sil,%sil
+  8022ba:	75 32                	jne    8022ee <vprintfmt+0x427>
+    switch (lflag) {
+  8022bc:	85 d2                	test   %edx,%edx
+  8022be:	74 5d                	je     80231d <vprintfmt+0x456>
+  8022c0:	83 fa 01             	cmp    $0x1,%edx
+  8022c3:	0f 84 82 00 00 00    	je     80234b <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  8022c9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8022cc:	83 f8 2f             	cmp    $0x2f,%eax
+  8022cf:	0f 87 a5 00 00 00    	ja     80237a <vprintfmt+0x4b3>
+  8022d5:	89 c2                	mov    %eax,%edx
+  8022d7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8022db:	83 c0 08             	add    $0x8,%eax
+  8022de:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8022e1:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8022e4:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  8022e9:	e9 99 01 00 00       	jmp    802487 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8022ee:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8022f1:	83 f8 2f             	cmp    $0x2f,%eax
+  8022f4:	77 19                	ja     80230f <vprintfmt+0x448>
+  8022f6:	89 c2                	mov    %eax,%edx
+  8022f8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8022fc:	83 c0 08             	add    $0x8,%eax
+  8022ff:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802302:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  802305:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  80230a:	e9 78 01 00 00       	jmp    802487 <vprintfmt+0x5c0>
+  80230f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802313:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802317:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80231b:	eb e5                	jmp    802302 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  80231d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802320:	83 f8 2f             	cmp    $0x2f,%eax
+  802323:	77 18                	ja     80233d <vprintfmt+0x476>
+  802325:	89 c2                	mov    %eax,%edx
+  802327:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80232b:	83 c0 08             	add    $0x8,%eax
+  80232e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802331:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  802333:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  802338:	e9 4a 01 00 00       	jmp    802487 <vprintfmt+0x5c0>
+  80233d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802341:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802345:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802349:	eb e6                	jmp    802331 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  80234b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80234e:	83 f8 2f             	cmp    $0x2f,%eax
+  802351:	77 19                	ja     80236c <vprintfmt+0x4a5>
+  802353:	89 c2                	mov    %eax,%edx
+  802355:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802359:	83 c0 08             	add    $0x8,%eax
+  80235c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80235f:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  802362:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  802367:	e9 1b 01 00 00       	jmp    802487 <vprintfmt+0x5c0>
+  80236c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802370:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802374:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802378:	eb e5                	jmp    80235f <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  80237a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80237e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802382:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802386:	e9 56 ff ff ff       	jmp    8022e1 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  80238b:	40 84 f6             	test   %sil,%sil
+  80238e:	75 2e                	jne    8023be <vprintfmt+0x4f7>
+    switch (lflag) {
+  802390:	85 d2                	test   %edx,%edx
+  802392:	74 59                	je     8023ed <vprintfmt+0x526>
+  802394:	83 fa 01             	cmp    $0x1,%edx
+  802397:	74 7f                	je     802418 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  802399:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80239c:	83 f8 2f             	cmp    $0x2f,%eax
+  80239f:	0f 87 9f 00 00 00    	ja     802444 <vprintfmt+0x57d>
+  8023a5:	89 c2                	mov    %eax,%edx
+  8023a7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8023ab:	83 c0 08             	add    $0x8,%eax
+  8023ae:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8023b1:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8023b4:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  8023b9:	e9 c9 00 00 00       	jmp    802487 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8023be:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8023c1:	83 f8 2f             	cmp    $0x2f,%eax
+  8023c4:	77 19                	ja     8023df <vprintfmt+0x518>
+  8023c6:	89 c2                	mov    %eax,%edx
+  8023c8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8023cc:	83 c0 08             	add    $0x8,%eax
+  8023cf:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8023d2:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8023d5:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8023da:	e9 a8 00 00 00       	jmp    802487 <vprintfmt+0x5c0>
+  8023df:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8023e3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8023e7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8023eb:	eb e5                	jmp    8023d2 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  8023ed:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8023f0:	83 f8 2f             	cmp    $0x2f,%eax
+  8023f3:	77 15                	ja     80240a <vprintfmt+0x543>
+  8023f5:	89 c2                	mov    %eax,%edx
+  8023f7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8023fb:	83 c0 08             	add    $0x8,%eax
+  8023fe:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802401:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  802403:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  802408:	eb 7d                	jmp    802487 <vprintfmt+0x5c0>
+  80240a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80240e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802412:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802416:	eb e9                	jmp    802401 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  802418:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80241b:	83 f8 2f             	cmp    $0x2f,%eax
+  80241e:	77 16                	ja     802436 <vprintfmt+0x56f>
+  802420:	89 c2                	mov    %eax,%edx
+  802422:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802426:	83 c0 08             	add    $0x8,%eax
+  802429:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80242c:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  80242f:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  802434:	eb 51                	jmp    802487 <vprintfmt+0x5c0>
+  802436:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80243a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80243e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802442:	eb e8                	jmp    80242c <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  802444:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802448:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80244c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802450:	e9 5c ff ff ff       	jmp    8023b1 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  802455:	4c 89 ee             	mov    %r13,%rsi
+  802458:	bf 30 00 00 00       	mov    $0x30,%edi
+  80245d:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  802460:	4c 89 ee             	mov    %r13,%rsi
+  802463:	bf 78 00 00 00       	mov    $0x78,%edi
+  802468:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  80246b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80246e:	83 f8 2f             	cmp    $0x2f,%eax
+  802471:	77 47                	ja     8024ba <vprintfmt+0x5f3>
+  802473:	89 c2                	mov    %eax,%edx
+  802475:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802479:	83 c0 08             	add    $0x8,%eax
+  80247c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80247f:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  802482:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  802487:	48 83 ec 08          	sub    $0x8,%rsp
+  80248b:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  80248f:	0f 94 c0             	sete   %al
+  802492:	0f b6 c0             	movzbl %al,%eax
+  802495:	50                   	push   %rax
+  802496:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  80249b:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  80249f:	4c 89 ee             	mov    %r13,%rsi
+  8024a2:	4c 89 f7             	mov    %r14,%rdi
+  8024a5:	48 b8 bc 1d 80 00 00 	movabs $0x801dbc,%rax
+  8024ac:	00 00 00 
+  8024af:	ff d0                	call   *%rax
+            break;
+  8024b1:	48 83 c4 10          	add    $0x10,%rsp
+  8024b5:	e9 3e fa ff ff       	jmp    801ef8 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  8024ba:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8024be:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8024c2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8024c6:	eb b7                	jmp    80247f <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  8024c8:	40 84 f6             	test   %sil,%sil
+  8024cb:	75 2b                	jne    8024f8 <vprintfmt+0x631>
+    switch (lflag) {
+  8024cd:	85 d2                	test   %edx,%edx
+  8024cf:	74 56                	je     802527 <vprintfmt+0x660>
+  8024d1:	83 fa 01             	cmp    $0x1,%edx
+  8024d4:	74 7f                	je     802555 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  8024d6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8024d9:	83 f8 2f             	cmp    $0x2f,%eax
+  8024dc:	0f 87 a2 00 00 00    	ja     802584 <vprintfmt+0x6bd>
+  8024e2:	89 c2                	mov    %eax,%edx
+  8024e4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8024e8:	83 c0 08             	add    $0x8,%eax
+  8024eb:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8024ee:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8024f1:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  8024f6:	eb 8f                	jmp    802487 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8024f8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8024fb:	83 f8 2f             	cmp    $0x2f,%eax
+  8024fe:	77 19                	ja     802519 <vprintfmt+0x652>
+  802500:	89 c2                	mov    %eax,%edx
+  802502:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802506:	83 c0 08             	add    $0x8,%eax
+  802509:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80250c:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  80250f:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  802514:	e9 6e ff ff ff       	jmp    802487 <vprintfmt+0x5c0>
+  802519:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80251d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802521:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802525:	eb e5                	jmp    80250c <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  802527:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80252a:	83 f8 2f             	cmp    $0x2f,%eax
+  80252d:	77 18                	ja     802547 <vprintfmt+0x680>
+  80252f:	89 c2                	mov    %eax,%edx
+  802531:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802535:	83 c0 08             	add    $0x8,%eax
+  802538:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80253b:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  80253d:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  802542:	e9 40 ff ff ff       	jmp    802487 <vprintfmt+0x5c0>
+  802547:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80254b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80254f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802553:	eb e6                	jmp    80253b <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  802555:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802558:	83 f8 2f             	cmp    $0x2f,%eax
+  80255b:	77 19                	ja     802576 <vprintfmt+0x6af>
+  80255d:	89 c2                	mov    %eax,%edx
+  80255f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802563:	83 c0 08             	add    $0x8,%eax
+  802566:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802569:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  80256c:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  802571:	e9 11 ff ff ff       	jmp    802487 <vprintfmt+0x5c0>
+  802576:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80257a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80257e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802582:	eb e5                	jmp    802569 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  802584:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802588:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80258c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802590:	e9 59 ff ff ff       	jmp    8024ee <vprintfmt+0x627>
+            putch(ch, put_arg);
+  802595:	4c 89 ee             	mov    %r13,%rsi
+  802598:	bf 25 00 00 00       	mov    $0x25,%edi
+  80259d:	41 ff d6             	call   *%r14
+            break;
+  8025a0:	e9 53 f9 ff ff       	jmp    801ef8 <vprintfmt+0x31>
+            putch('%', put_arg);
+  8025a5:	4c 89 ee             	mov    %r13,%rsi
+  8025a8:	bf 25 00 00 00       	mov    $0x25,%edi
+  8025ad:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  8025b0:	48 83 eb 01          	sub    $0x1,%rbx
+  8025b4:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  8025b8:	75 f6                	jne    8025b0 <vprintfmt+0x6e9>
+  8025ba:	e9 39 f9 ff ff       	jmp    801ef8 <vprintfmt+0x31>
+}
+  8025bf:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8025c3:	5b                   	pop    %rbx
+  8025c4:	41 5c                	pop    %r12
+  8025c6:	41 5d                	pop    %r13
+  8025c8:	41 5e                	pop    %r14
+  8025ca:	41 5f                	pop    %r15
+  8025cc:	5d                   	pop    %rbp
+  8025cd:	c3                   	ret
+
+00000000008025ce <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  8025ce:	55                   	push   %rbp
+  8025cf:	48 89 e5             	mov    %rsp,%rbp
+  8025d2:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  8025d6:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8025da:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  8025df:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  8025e3:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  8025ea:	48 85 ff             	test   %rdi,%rdi
+  8025ed:	74 2b                	je     80261a <vsnprintf+0x4c>
+  8025ef:	48 85 f6             	test   %rsi,%rsi
+  8025f2:	74 26                	je     80261a <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  8025f4:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8025f8:	48 bf 72 1e 80 00 00 	movabs $0x801e72,%rdi
+  8025ff:	00 00 00 
+  802602:	48 b8 c7 1e 80 00 00 	movabs $0x801ec7,%rax
+  802609:	00 00 00 
+  80260c:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  80260e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802612:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  802615:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  802618:	c9                   	leave
+  802619:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  80261a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80261f:	eb f7                	jmp    802618 <vsnprintf+0x4a>
+
+0000000000802621 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  802621:	55                   	push   %rbp
+  802622:	48 89 e5             	mov    %rsp,%rbp
+  802625:	48 83 ec 50          	sub    $0x50,%rsp
+  802629:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80262d:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  802631:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  802635:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  80263c:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802640:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802644:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  802648:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  80264c:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  802650:	48 b8 ce 25 80 00 00 	movabs $0x8025ce,%rax
+  802657:	00 00 00 
+  80265a:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  80265c:	c9                   	leave
+  80265d:	c3                   	ret
+
+000000000080265e <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  80265e:	80 3f 00             	cmpb   $0x0,(%rdi)
+  802661:	74 10                	je     802673 <strlen+0x15>
+    size_t n = 0;
+  802663:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  802668:	48 83 c0 01          	add    $0x1,%rax
+  80266c:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  802670:	75 f6                	jne    802668 <strlen+0xa>
+  802672:	c3                   	ret
+    size_t n = 0;
+  802673:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  802678:	c3                   	ret
+
+0000000000802679 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  802679:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  80267c:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  802681:	48 85 f6             	test   %rsi,%rsi
+  802684:	74 11                	je     802697 <strnlen+0x1e>
+  802686:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  80268a:	74 0c                	je     802698 <strnlen+0x1f>
+  80268c:	48 83 c2 01          	add    $0x1,%rdx
+  802690:	48 39 d0             	cmp    %rdx,%rax
+  802693:	75 f1                	jne    802686 <strnlen+0xd>
+  802695:	eb 04                	jmp    80269b <strnlen+0x22>
+  802697:	c3                   	ret
+  802698:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  80269b:	c3                   	ret
+
+000000000080269c <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  80269c:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  80269f:	ba 00 00 00 00       	mov    $0x0,%edx
+  8026a4:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  8026a8:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  8026ab:	48 83 c2 01          	add    $0x1,%rdx
+  8026af:	84 c9                	test   %cl,%cl
+  8026b1:	75 f1                	jne    8026a4 <strcpy+0x8>
+        ;
+    return res;
+}
+  8026b3:	c3                   	ret
+
+00000000008026b4 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  8026b4:	55                   	push   %rbp
+  8026b5:	48 89 e5             	mov    %rsp,%rbp
+  8026b8:	41 54                	push   %r12
+  8026ba:	53                   	push   %rbx
+  8026bb:	48 89 fb             	mov    %rdi,%rbx
+  8026be:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  8026c1:	48 b8 5e 26 80 00 00 	movabs $0x80265e,%rax
+  8026c8:	00 00 00 
+  8026cb:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  8026cd:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  8026d1:	4c 89 e6             	mov    %r12,%rsi
+  8026d4:	48 b8 9c 26 80 00 00 	movabs $0x80269c,%rax
+  8026db:	00 00 00 
+  8026de:	ff d0                	call   *%rax
+    return dst;
+}
+  8026e0:	48 89 d8             	mov    %rbx,%rax
+  8026e3:	5b                   	pop    %rbx
+  8026e4:	41 5c                	pop    %r12
+  8026e6:	5d                   	pop    %rbp
+  8026e7:	c3                   	ret
+
+00000000008026e8 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8026e8:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  8026eb:	48 85 d2             	test   %rdx,%rdx
+  8026ee:	74 1f                	je     80270f <strncpy+0x27>
+  8026f0:	48 01 fa             	add    %rdi,%rdx
+  8026f3:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  8026f6:	48 83 c1 01          	add    $0x1,%rcx
+  8026fa:	44 0f b6 06          	movzbl (%rsi),%r8d
+  8026fe:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  802702:	41 80 f8 01          	cmp    $0x1,%r8b
+  802706:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  80270a:	48 39 ca             	cmp    %rcx,%rdx
+  80270d:	75 e7                	jne    8026f6 <strncpy+0xe>
+    }
+    return ret;
+}
+  80270f:	c3                   	ret
+
+0000000000802710 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  802710:	48 89 f8             	mov    %rdi,%rax
+  802713:	48 85 d2             	test   %rdx,%rdx
+  802716:	74 24                	je     80273c <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  802718:	48 83 ea 01          	sub    $0x1,%rdx
+  80271c:	74 1b                	je     802739 <strlcpy+0x29>
+  80271e:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  802722:	0f b6 16             	movzbl (%rsi),%edx
+  802725:	84 d2                	test   %dl,%dl
+  802727:	74 10                	je     802739 <strlcpy+0x29>
+            *dst++ = *src++;
+  802729:	48 83 c6 01          	add    $0x1,%rsi
+  80272d:	48 83 c0 01          	add    $0x1,%rax
+  802731:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  802734:	48 39 c8             	cmp    %rcx,%rax
+  802737:	75 e9                	jne    802722 <strlcpy+0x12>
+        *dst = '\0';
+  802739:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  80273c:	48 29 f8             	sub    %rdi,%rax
+}
+  80273f:	c3                   	ret
+
+0000000000802740 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  802740:	0f b6 07             	movzbl (%rdi),%eax
+  802743:	84 c0                	test   %al,%al
+  802745:	74 13                	je     80275a <strcmp+0x1a>
+  802747:	38 06                	cmp    %al,(%rsi)
+  802749:	75 0f                	jne    80275a <strcmp+0x1a>
+  80274b:	48 83 c7 01          	add    $0x1,%rdi
+  80274f:	48 83 c6 01          	add    $0x1,%rsi
+  802753:	0f b6 07             	movzbl (%rdi),%eax
+  802756:	84 c0                	test   %al,%al
+  802758:	75 ed                	jne    802747 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  80275a:	0f b6 c0             	movzbl %al,%eax
+  80275d:	0f b6 16             	movzbl (%rsi),%edx
+  802760:	29 d0                	sub    %edx,%eax
+}
+  802762:	c3                   	ret
+
+0000000000802763 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  802763:	48 85 d2             	test   %rdx,%rdx
+  802766:	74 1f                	je     802787 <strncmp+0x24>
+  802768:	0f b6 07             	movzbl (%rdi),%eax
+  80276b:	84 c0                	test   %al,%al
+  80276d:	74 1e                	je     80278d <strncmp+0x2a>
+  80276f:	3a 06                	cmp    (%rsi),%al
+  802771:	75 1a                	jne    80278d <strncmp+0x2a>
+  802773:	48 83 c7 01          	add    $0x1,%rdi
+  802777:	48 83 c6 01          	add    $0x1,%rsi
+  80277b:	48 83 ea 01          	sub    $0x1,%rdx
+  80277f:	75 e7                	jne    802768 <strncmp+0x5>
+
+    if (!n) return 0;
+  802781:	b8 00 00 00 00       	mov    $0x0,%eax
+  802786:	c3                   	ret
+  802787:	b8 00 00 00 00       	mov    $0x0,%eax
+  80278c:	c3                   	ret
+  80278d:	48 85 d2             	test   %rdx,%rdx
+  802790:	74 09                	je     80279b <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  802792:	0f b6 07             	movzbl (%rdi),%eax
+  802795:	0f b6 16             	movzbl (%rsi),%edx
+  802798:	29 d0                	sub    %edx,%eax
+  80279a:	c3                   	ret
+    if (!n) return 0;
+  80279b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8027a0:	c3                   	ret
+
+00000000008027a1 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  8027a1:	0f b6 17             	movzbl (%rdi),%edx
+  8027a4:	84 d2                	test   %dl,%dl
+  8027a6:	74 18                	je     8027c0 <strchr+0x1f>
+        if (*str == c) {
+  8027a8:	0f be d2             	movsbl %dl,%edx
+  8027ab:	39 f2                	cmp    %esi,%edx
+  8027ad:	74 17                	je     8027c6 <strchr+0x25>
+    for (; *str; str++) {
+  8027af:	48 83 c7 01          	add    $0x1,%rdi
+  8027b3:	0f b6 17             	movzbl (%rdi),%edx
+  8027b6:	84 d2                	test   %dl,%dl
+  8027b8:	75 ee                	jne    8027a8 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  8027ba:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027bf:	c3                   	ret
+  8027c0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027c5:	c3                   	ret
+  8027c6:	48 89 f8             	mov    %rdi,%rax
+}
+  8027c9:	c3                   	ret
+
+00000000008027ca <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  8027ca:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  8027cd:	0f b6 17             	movzbl (%rdi),%edx
+  8027d0:	84 d2                	test   %dl,%dl
+  8027d2:	74 13                	je     8027e7 <strfind+0x1d>
+  8027d4:	0f be d2             	movsbl %dl,%edx
+  8027d7:	39 f2                	cmp    %esi,%edx
+  8027d9:	74 0b                	je     8027e6 <strfind+0x1c>
+  8027db:	48 83 c0 01          	add    $0x1,%rax
+  8027df:	0f b6 10             	movzbl (%rax),%edx
+  8027e2:	84 d2                	test   %dl,%dl
+  8027e4:	75 ee                	jne    8027d4 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  8027e6:	c3                   	ret
+  8027e7:	c3                   	ret
+
+00000000008027e8 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  8027e8:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  8027eb:	48 89 f8             	mov    %rdi,%rax
+  8027ee:	48 f7 d8             	neg    %rax
+  8027f1:	83 e0 07             	and    $0x7,%eax
+  8027f4:	49 89 d1             	mov    %rdx,%r9
+  8027f7:	49 29 c1             	sub    %rax,%r9
+  8027fa:	78 36                	js     802832 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  8027fc:	40 0f b6 c6          	movzbl %sil,%eax
+  802800:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  802807:	01 01 01 
+  80280a:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  80280e:	40 f6 c7 07          	test   $0x7,%dil
+  802812:	75 38                	jne    80284c <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  802814:	4c 89 c9             	mov    %r9,%rcx
+  802817:	48 c1 f9 03          	sar    $0x3,%rcx
+  80281b:	74 0c                	je     802829 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  80281d:	fc                   	cld
+  80281e:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  802821:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  802825:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  802829:	4d 85 c9             	test   %r9,%r9
+  80282c:	75 45                	jne    802873 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  80282e:	4c 89 c0             	mov    %r8,%rax
+  802831:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  802832:	48 85 d2             	test   %rdx,%rdx
+  802835:	74 f7                	je     80282e <memset+0x46>
+  802837:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  80283a:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  80283d:	48 83 c0 01          	add    $0x1,%rax
+  802841:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  802845:	48 39 c2             	cmp    %rax,%rdx
+  802848:	75 f3                	jne    80283d <memset+0x55>
+  80284a:	eb e2                	jmp    80282e <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  80284c:	40 f6 c7 01          	test   $0x1,%dil
+  802850:	74 06                	je     802858 <memset+0x70>
+  802852:	88 07                	mov    %al,(%rdi)
+  802854:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  802858:	40 f6 c7 02          	test   $0x2,%dil
+  80285c:	74 07                	je     802865 <memset+0x7d>
+  80285e:	66 89 07             	mov    %ax,(%rdi)
+  802861:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  802865:	40 f6 c7 04          	test   $0x4,%dil
+  802869:	74 a9                	je     802814 <memset+0x2c>
+  80286b:	89 07                	mov    %eax,(%rdi)
+  80286d:	48 83 c7 04          	add    $0x4,%rdi
+  802871:	eb a1                	jmp    802814 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  802873:	41 f6 c1 04          	test   $0x4,%r9b
+  802877:	74 06                	je     80287f <memset+0x97>
+  802879:	89 07                	mov    %eax,(%rdi)
+  80287b:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  80287f:	41 f6 c1 02          	test   $0x2,%r9b
+  802883:	74 07                	je     80288c <memset+0xa4>
+  802885:	66 89 07             	mov    %ax,(%rdi)
+  802888:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  80288c:	41 f6 c1 01          	test   $0x1,%r9b
+  802890:	74 9c                	je     80282e <memset+0x46>
+  802892:	88 07                	mov    %al,(%rdi)
+  802894:	eb 98                	jmp    80282e <memset+0x46>
+
+0000000000802896 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  802896:	48 89 f8             	mov    %rdi,%rax
+  802899:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  80289c:	48 39 fe             	cmp    %rdi,%rsi
+  80289f:	73 3b                	jae    8028dc <memmove+0x46>
+  8028a1:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  8028a5:	48 39 d7             	cmp    %rdx,%rdi
+  8028a8:	73 32                	jae    8028dc <memmove+0x46>
+        s += n;
+        d += n;
+  8028aa:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  8028ae:	48 89 d6             	mov    %rdx,%rsi
+  8028b1:	48 09 fe             	or     %rdi,%rsi
+  8028b4:	48 09 ce             	or     %rcx,%rsi
+  8028b7:	40 f6 c6 07          	test   $0x7,%sil
+  8028bb:	75 12                	jne    8028cf <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  8028bd:	48 83 ef 08          	sub    $0x8,%rdi
+  8028c1:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  8028c5:	48 c1 e9 03          	shr    $0x3,%rcx
+  8028c9:	fd                   	std
+  8028ca:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  8028cd:	fc                   	cld
+  8028ce:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  8028cf:	48 83 ef 01          	sub    $0x1,%rdi
+  8028d3:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  8028d7:	fd                   	std
+  8028d8:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  8028da:	eb f1                	jmp    8028cd <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  8028dc:	48 89 f2             	mov    %rsi,%rdx
+  8028df:	48 09 c2             	or     %rax,%rdx
+  8028e2:	48 09 ca             	or     %rcx,%rdx
+  8028e5:	f6 c2 07             	test   $0x7,%dl
+  8028e8:	75 0c                	jne    8028f6 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  8028ea:	48 c1 e9 03          	shr    $0x3,%rcx
+  8028ee:	48 89 c7             	mov    %rax,%rdi
+  8028f1:	fc                   	cld
+  8028f2:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  8028f5:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  8028f6:	48 89 c7             	mov    %rax,%rdi
+  8028f9:	fc                   	cld
+  8028fa:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  8028fc:	c3                   	ret
+
+00000000008028fd <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  8028fd:	55                   	push   %rbp
+  8028fe:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  802901:	48 b8 96 28 80 00 00 	movabs $0x802896,%rax
+  802908:	00 00 00 
+  80290b:	ff d0                	call   *%rax
+}
+  80290d:	5d                   	pop    %rbp
+  80290e:	c3                   	ret
+
+000000000080290f <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  80290f:	55                   	push   %rbp
+  802910:	48 89 e5             	mov    %rsp,%rbp
+  802913:	41 57                	push   %r15
+  802915:	41 56                	push   %r14
+  802917:	41 55                	push   %r13
+  802919:	41 54                	push   %r12
+  80291b:	53                   	push   %rbx
+  80291c:	48 83 ec 08          	sub    $0x8,%rsp
+  802920:	49 89 fe             	mov    %rdi,%r14
+  802923:	49 89 f7             	mov    %rsi,%r15
+  802926:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  802929:	48 89 f7             	mov    %rsi,%rdi
+  80292c:	48 b8 5e 26 80 00 00 	movabs $0x80265e,%rax
+  802933:	00 00 00 
+  802936:	ff d0                	call   *%rax
+  802938:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  80293b:	48 89 de             	mov    %rbx,%rsi
+  80293e:	4c 89 f7             	mov    %r14,%rdi
+  802941:	48 b8 79 26 80 00 00 	movabs $0x802679,%rax
+  802948:	00 00 00 
+  80294b:	ff d0                	call   *%rax
+  80294d:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  802950:	48 39 c3             	cmp    %rax,%rbx
+  802953:	74 36                	je     80298b <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  802955:	48 89 d8             	mov    %rbx,%rax
+  802958:	4c 29 e8             	sub    %r13,%rax
+  80295b:	49 39 c4             	cmp    %rax,%r12
+  80295e:	73 31                	jae    802991 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  802960:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  802965:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  802969:	4c 89 fe             	mov    %r15,%rsi
+  80296c:	48 b8 fd 28 80 00 00 	movabs $0x8028fd,%rax
+  802973:	00 00 00 
+  802976:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  802978:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  80297c:	48 83 c4 08          	add    $0x8,%rsp
+  802980:	5b                   	pop    %rbx
+  802981:	41 5c                	pop    %r12
+  802983:	41 5d                	pop    %r13
+  802985:	41 5e                	pop    %r14
+  802987:	41 5f                	pop    %r15
+  802989:	5d                   	pop    %rbp
+  80298a:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  80298b:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  80298f:	eb eb                	jmp    80297c <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  802991:	48 83 eb 01          	sub    $0x1,%rbx
+  802995:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  802999:	48 89 da             	mov    %rbx,%rdx
+  80299c:	4c 89 fe             	mov    %r15,%rsi
+  80299f:	48 b8 fd 28 80 00 00 	movabs $0x8028fd,%rax
+  8029a6:	00 00 00 
+  8029a9:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  8029ab:	49 01 de             	add    %rbx,%r14
+  8029ae:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  8029b3:	eb c3                	jmp    802978 <strlcat+0x69>
+
+00000000008029b5 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  8029b5:	48 85 d2             	test   %rdx,%rdx
+  8029b8:	74 2d                	je     8029e7 <memcmp+0x32>
+  8029ba:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  8029bf:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  8029c3:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  8029c8:	44 38 c1             	cmp    %r8b,%cl
+  8029cb:	75 0f                	jne    8029dc <memcmp+0x27>
+    while (n-- > 0) {
+  8029cd:	48 83 c0 01          	add    $0x1,%rax
+  8029d1:	48 39 c2             	cmp    %rax,%rdx
+  8029d4:	75 e9                	jne    8029bf <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  8029d6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029db:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  8029dc:	0f b6 c1             	movzbl %cl,%eax
+  8029df:	45 0f b6 c0          	movzbl %r8b,%r8d
+  8029e3:	44 29 c0             	sub    %r8d,%eax
+  8029e6:	c3                   	ret
+    return 0;
+  8029e7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8029ec:	c3                   	ret
+
+00000000008029ed <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  8029ed:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  8029f1:	48 39 c7             	cmp    %rax,%rdi
+  8029f4:	73 0f                	jae    802a05 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  8029f6:	40 38 37             	cmp    %sil,(%rdi)
+  8029f9:	74 0e                	je     802a09 <memfind+0x1c>
+    for (; src < end; src++) {
+  8029fb:	48 83 c7 01          	add    $0x1,%rdi
+  8029ff:	48 39 f8             	cmp    %rdi,%rax
+  802a02:	75 f2                	jne    8029f6 <memfind+0x9>
+  802a04:	c3                   	ret
+  802a05:	48 89 f8             	mov    %rdi,%rax
+  802a08:	c3                   	ret
+  802a09:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  802a0c:	c3                   	ret
+
+0000000000802a0d <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  802a0d:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  802a10:	0f b6 37             	movzbl (%rdi),%esi
+  802a13:	40 80 fe 20          	cmp    $0x20,%sil
+  802a17:	74 06                	je     802a1f <strtol+0x12>
+  802a19:	40 80 fe 09          	cmp    $0x9,%sil
+  802a1d:	75 13                	jne    802a32 <strtol+0x25>
+  802a1f:	48 83 c7 01          	add    $0x1,%rdi
+  802a23:	0f b6 37             	movzbl (%rdi),%esi
+  802a26:	40 80 fe 20          	cmp    $0x20,%sil
+  802a2a:	74 f3                	je     802a1f <strtol+0x12>
+  802a2c:	40 80 fe 09          	cmp    $0x9,%sil
+  802a30:	74 ed                	je     802a1f <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  802a32:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  802a35:	83 e0 fd             	and    $0xfffffffd,%eax
+  802a38:	3c 01                	cmp    $0x1,%al
+  802a3a:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  802a3e:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  802a44:	75 0f                	jne    802a55 <strtol+0x48>
+  802a46:	80 3f 30             	cmpb   $0x30,(%rdi)
+  802a49:	74 14                	je     802a5f <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  802a4b:	85 d2                	test   %edx,%edx
+  802a4d:	b8 0a 00 00 00       	mov    $0xa,%eax
+  802a52:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  802a55:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  802a5a:	4c 63 ca             	movslq %edx,%r9
+  802a5d:	eb 36                	jmp    802a95 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  802a5f:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  802a63:	74 0f                	je     802a74 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  802a65:	85 d2                	test   %edx,%edx
+  802a67:	75 ec                	jne    802a55 <strtol+0x48>
+        s++;
+  802a69:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  802a6d:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  802a72:	eb e1                	jmp    802a55 <strtol+0x48>
+        s += 2;
+  802a74:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  802a78:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  802a7d:	eb d6                	jmp    802a55 <strtol+0x48>
+            dig -= '0';
+  802a7f:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  802a82:	44 0f b6 c1          	movzbl %cl,%r8d
+  802a86:	41 39 d0             	cmp    %edx,%r8d
+  802a89:	7d 21                	jge    802aac <strtol+0x9f>
+        val = val * base + dig;
+  802a8b:	49 0f af c1          	imul   %r9,%rax
+  802a8f:	0f b6 c9             	movzbl %cl,%ecx
+  802a92:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  802a95:	48 83 c7 01          	add    $0x1,%rdi
+  802a99:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  802a9d:	80 f9 39             	cmp    $0x39,%cl
+  802aa0:	76 dd                	jbe    802a7f <strtol+0x72>
+        else if (dig - 'a' < 27)
+  802aa2:	80 f9 7b             	cmp    $0x7b,%cl
+  802aa5:	77 05                	ja     802aac <strtol+0x9f>
+            dig -= 'a' - 10;
+  802aa7:	83 e9 57             	sub    $0x57,%ecx
+  802aaa:	eb d6                	jmp    802a82 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  802aac:	4d 85 d2             	test   %r10,%r10
+  802aaf:	74 03                	je     802ab4 <strtol+0xa7>
+  802ab1:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  802ab4:	48 89 c2             	mov    %rax,%rdx
+  802ab7:	48 f7 da             	neg    %rdx
+  802aba:	40 80 fe 2d          	cmp    $0x2d,%sil
+  802abe:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  802ac2:	c3                   	ret
+
+0000000000802ac3 <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  802ac3:	55                   	push   %rbp
+  802ac4:	48 89 e5             	mov    %rsp,%rbp
+  802ac7:	41 55                	push   %r13
+  802ac9:	41 54                	push   %r12
+  802acb:	53                   	push   %rbx
+  802acc:	48 83 ec 08          	sub    $0x8,%rsp
+  802ad0:	49 89 fc             	mov    %rdi,%r12
+  802ad3:	48 89 f7             	mov    %rsi,%rdi
+  802ad6:	48 89 d3             	mov    %rdx,%rbx
+  802ad9:	49 89 cd             	mov    %rcx,%r13
+    // LAB 9: Your code here:
+    int res = sys_ipc_recv(!pg ? (void*)MAX_USER_ADDRESS : pg, !size ? 0 : *size);
+  802adc:	be 00 00 00 00       	mov    $0x0,%esi
+  802ae1:	48 85 d2             	test   %rdx,%rdx
+  802ae4:	74 03                	je     802ae9 <ipc_recv+0x26>
+  802ae6:	48 8b 32             	mov    (%rdx),%rsi
+  802ae9:	48 85 ff             	test   %rdi,%rdi
+  802aec:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802af3:	00 00 00 
+  802af6:	48 0f 44 f8          	cmove  %rax,%rdi
+  802afa:	48 b8 68 06 80 00 00 	movabs $0x800668,%rax
+  802b01:	00 00 00 
+  802b04:	ff d0                	call   *%rax
+    if (res < 0) {
+  802b06:	85 c0                	test   %eax,%eax
+  802b08:	78 66                	js     802b70 <ipc_recv+0xad>
+        if (size) {
+            *size = 0;
+        }
+        return res;
+    }
+    if (from_env_store) {
+  802b0a:	4d 85 e4             	test   %r12,%r12
+  802b0d:	74 14                	je     802b23 <ipc_recv+0x60>
+        *from_env_store = thisenv->env_ipc_from;
+  802b0f:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802b16:	00 00 00 
+  802b19:	8b 80 ac 01 00 00    	mov    0x1ac(%rax),%eax
+  802b1f:	41 89 04 24          	mov    %eax,(%r12)
+    }
+    if (perm_store) {
+  802b23:	4d 85 ed             	test   %r13,%r13
+  802b26:	74 14                	je     802b3c <ipc_recv+0x79>
+        *perm_store = thisenv->env_ipc_perm;
+  802b28:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802b2f:	00 00 00 
+  802b32:	8b 80 b0 01 00 00    	mov    0x1b0(%rax),%eax
+  802b38:	41 89 45 00          	mov    %eax,0x0(%r13)
+    }
+    if (size) {
+  802b3c:	48 85 db             	test   %rbx,%rbx
+  802b3f:	74 14                	je     802b55 <ipc_recv+0x92>
+        *size = thisenv->env_ipc_maxsz;
+  802b41:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802b48:	00 00 00 
+  802b4b:	48 8b 80 a0 01 00 00 	mov    0x1a0(%rax),%rax
+  802b52:	48 89 03             	mov    %rax,(%rbx)
+    }
+    return thisenv->env_ipc_value;
+  802b55:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802b5c:	00 00 00 
+  802b5f:	8b 80 a8 01 00 00    	mov    0x1a8(%rax),%eax
+}
+  802b65:	48 83 c4 08          	add    $0x8,%rsp
+  802b69:	5b                   	pop    %rbx
+  802b6a:	41 5c                	pop    %r12
+  802b6c:	41 5d                	pop    %r13
+  802b6e:	5d                   	pop    %rbp
+  802b6f:	c3                   	ret
+        if (from_env_store) {
+  802b70:	4d 85 e4             	test   %r12,%r12
+  802b73:	74 08                	je     802b7d <ipc_recv+0xba>
+            *from_env_store = 0;
+  802b75:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  802b7c:	00 
+        if (perm_store) {
+  802b7d:	4d 85 ed             	test   %r13,%r13
+  802b80:	74 08                	je     802b8a <ipc_recv+0xc7>
+            *perm_store = 0;
+  802b82:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  802b89:	00 
+        if (size) {
+  802b8a:	48 85 db             	test   %rbx,%rbx
+  802b8d:	74 d6                	je     802b65 <ipc_recv+0xa2>
+            *size = 0;
+  802b8f:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  802b96:	eb cd                	jmp    802b65 <ipc_recv+0xa2>
+
+0000000000802b98 <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  802b98:	55                   	push   %rbp
+  802b99:	48 89 e5             	mov    %rsp,%rbp
+  802b9c:	41 57                	push   %r15
+  802b9e:	41 56                	push   %r14
+  802ba0:	41 55                	push   %r13
+  802ba2:	41 54                	push   %r12
+  802ba4:	53                   	push   %rbx
+  802ba5:	48 83 ec 18          	sub    $0x18,%rsp
+  802ba9:	41 89 fd             	mov    %edi,%r13d
+  802bac:	89 75 cc             	mov    %esi,-0x34(%rbp)
+  802baf:	49 89 cc             	mov    %rcx,%r12
+  802bb2:	44 89 45 c8          	mov    %r8d,-0x38(%rbp)
+    // LAB 9: Your code here:
+    int res = 0;
+    while ((res = sys_ipc_try_send(to_env, val, !pg ? (void*)MAX_USER_ADDRESS : pg, size, perm)) < 0) {
+  802bb6:	48 85 d2             	test   %rdx,%rdx
+  802bb9:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802bc0:	00 00 00 
+  802bc3:	48 0f 45 c2          	cmovne %rdx,%rax
+  802bc7:	48 89 c3             	mov    %rax,%rbx
+  802bca:	49 be 3c 06 80 00 00 	movabs $0x80063c,%r14
+  802bd1:	00 00 00 
+        if (res != -E_IPC_NOT_RECV) {
+            panic("sys_ipc_try_send failed: %i", res);
+        }
+        sys_yield();
+  802bd4:	49 bf 07 02 80 00 00 	movabs $0x800207,%r15
+  802bdb:	00 00 00 
+    while ((res = sys_ipc_try_send(to_env, val, !pg ? (void*)MAX_USER_ADDRESS : pg, size, perm)) < 0) {
+  802bde:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  802be1:	44 8b 45 c8          	mov    -0x38(%rbp),%r8d
+  802be5:	4c 89 e1             	mov    %r12,%rcx
+  802be8:	48 89 da             	mov    %rbx,%rdx
+  802beb:	44 89 ef             	mov    %r13d,%edi
+  802bee:	41 ff d6             	call   *%r14
+  802bf1:	85 c0                	test   %eax,%eax
+  802bf3:	79 37                	jns    802c2c <ipc_send+0x94>
+        if (res != -E_IPC_NOT_RECV) {
+  802bf5:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  802bf8:	75 05                	jne    802bff <ipc_send+0x67>
+        sys_yield();
+  802bfa:	41 ff d7             	call   *%r15
+  802bfd:	eb df                	jmp    802bde <ipc_send+0x46>
+            panic("sys_ipc_try_send failed: %i", res);
+  802bff:	89 c1                	mov    %eax,%ecx
+  802c01:	48 ba 4f 33 80 00 00 	movabs $0x80334f,%rdx
+  802c08:	00 00 00 
+  802c0b:	be 40 00 00 00       	mov    $0x40,%esi
+  802c10:	48 bf 6b 33 80 00 00 	movabs $0x80336b,%rdi
+  802c17:	00 00 00 
+  802c1a:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c1f:	49 b8 27 1c 80 00 00 	movabs $0x801c27,%r8
+  802c26:	00 00 00 
+  802c29:	41 ff d0             	call   *%r8
+    }
+    return;
+}
+  802c2c:	48 83 c4 18          	add    $0x18,%rsp
+  802c30:	5b                   	pop    %rbx
+  802c31:	41 5c                	pop    %r12
+  802c33:	41 5d                	pop    %r13
+  802c35:	41 5e                	pop    %r14
+  802c37:	41 5f                	pop    %r15
+  802c39:	5d                   	pop    %rbp
+  802c3a:	c3                   	ret
+
+0000000000802c3b <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  802c3b:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  802c40:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  802c47:	00 00 00 
+  802c4a:	48 69 d0 d0 01 00 00 	imul   $0x1d0,%rax,%rdx
+  802c51:	48 01 ca             	add    %rcx,%rdx
+  802c54:	8b 92 e8 00 00 00    	mov    0xe8(%rdx),%edx
+  802c5a:	39 fa                	cmp    %edi,%edx
+  802c5c:	74 12                	je     802c70 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  802c5e:	48 83 c0 01          	add    $0x1,%rax
+  802c62:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  802c68:	75 e0                	jne    802c4a <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  802c6a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802c6f:	c3                   	ret
+            return envs[i].env_id;
+  802c70:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+  802c77:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  802c7e:	00 00 00 
+  802c81:	48 01 d0             	add    %rdx,%rax
+  802c84:	8b 80 e0 00 00 00    	mov    0xe0(%rax),%eax
+  802c8a:	c3                   	ret
+  802c8b:	0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+
+0000000000802c90 <__rodata_start>:
+  802c90:	3c 75                	cmp    $0x75,%al
+  802c92:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802c93:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  802c97:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802c98:	3e 00 66 0f          	ds add %ah,0xf(%rsi)
+  802c9c:	1f                   	(bad)
+  802c9d:	44 00 00             	add    %r8b,(%rax)
+  802ca0:	73 79                	jae    802d1b <__rodata_start+0x8b>
+  802ca2:	73 63                	jae    802d07 <__rodata_start+0x77>
+  802ca4:	61                   	(bad)
+  802ca5:	6c                   	insb   (%dx),%es:(%rdi)
+  802ca6:	6c                   	insb   (%dx),%es:(%rdi)
+  802ca7:	20 25 7a 64 20 72    	and    %ah,0x7220647a(%rip)        # 72a09127 <__bss_end+0x72201127>
+  802cad:	65 74 75             	gs je  802d25 <__rodata_start+0x95>
+  802cb0:	72 6e                	jb     802d20 <__rodata_start+0x90>
+  802cb2:	65 64 20 25 7a 64 20 	gs and %ah,%fs:0x2820647a(%rip)        # 28a09134 <__bss_end+0x28201134>
+  802cb9:	28 
+  802cba:	3e 20 30             	ds and %dh,(%rax)
+  802cbd:	29 00                	sub    %eax,(%rax)
+  802cbf:	6c                   	insb   (%dx),%es:(%rdi)
+  802cc0:	69 62 2f 73 79 73 63 	imul   $0x63737973,0x2f(%rdx),%esp
+  802cc7:	61                   	(bad)
+  802cc8:	6c                   	insb   (%dx),%es:(%rdi)
+  802cc9:	6c                   	insb   (%dx),%es:(%rdi)
+  802cca:	2e 63 00             	cs movsxd (%rax),%eax
+  802ccd:	0f 1f 00             	nopl   (%rax)
+  802cd0:	5b                   	pop    %rbx
+  802cd1:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  802cd6:	20 75 6e             	and    %dh,0x6e(%rbp)
+  802cd9:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  802cdd:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802cde:	20 64 65 76          	and    %ah,0x76(%rbp,%riz,2)
+  802ce2:	69 63 65 20 74 79 70 	imul   $0x70797420,0x65(%rbx),%esp
+  802ce9:	65 20 25 64 0a 00 00 	and    %ah,%gs:0xa64(%rip)        # 803754 <error_string+0x4d4>
+  802cf0:	5b                   	pop    %rbx
+  802cf1:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  802cf6:	20 66 74             	and    %ah,0x74(%rsi)
+  802cf9:	72 75                	jb     802d70 <devtab+0x10>
+  802cfb:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802cfc:	63 61 74             	movsxd 0x74(%rcx),%esp
+  802cff:	65 20 25 64 20 2d 2d 	and    %ah,%gs:0x2d2d2064(%rip)        # 2dad4d6a <__bss_end+0x2d2ccd6a>
+  802d06:	20 62 61             	and    %ah,0x61(%rdx)
+  802d09:	64 20 6d 6f          	and    %ch,%fs:0x6f(%rbp)
+  802d0d:	64 65 0a 00          	fs or  %gs:(%rax),%al
+  802d11:	5b                   	pop    %rbx
+  802d12:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  802d17:	20 72 65             	and    %dh,0x65(%rdx)
+  802d1a:	61                   	(bad)
+  802d1b:	64 20 25 64 20 2d 2d 	and    %ah,%fs:0x2d2d2064(%rip)        # 2dad4d86 <__bss_end+0x2d2ccd86>
+  802d22:	20 62 61             	and    %ah,0x61(%rdx)
+  802d25:	64 20 6d 6f          	and    %ch,%fs:0x6f(%rbp)
+  802d29:	64 65 0a 00          	fs or  %gs:(%rax),%al
+  802d2d:	5b                   	pop    %rbx
+  802d2e:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  802d33:	20 77 72             	and    %dh,0x72(%rdi)
+  802d36:	69 74 65 20 25 64 20 	imul   $0x2d206425,0x20(%rbp,%riz,2),%esi
+  802d3d:	2d 
+  802d3e:	2d 20 62 61 64       	sub    $0x64616220,%eax
+  802d43:	20 6d 6f             	and    %ch,0x6f(%rbp)
+  802d46:	64 65 0a 00          	fs or  %gs:(%rax),%al
+  802d4a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  802d51:	00 00 00 
+  802d54:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  802d5b:	00 00 00 
+  802d5e:	66 90                	xchg   %ax,%ax
+
+0000000000802d60 <devtab>:
+  802d60:	20 40 80 00 00 00 00 00 60 40 80 00 00 00 00 00      @......`@......
+  802d70:	a0 40 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .@..............
+  802d80:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  802d90:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  802da0:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  802db0:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  802dc0:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  802dd0:	3d 20 32 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73 00     = 2.<cons>.cons.
+  802de0:	5b 25 30 38 78 5d 20 75 73 65 72 20 70 61 6e 69     [%08x] user pani
+  802df0:	63 20 69 6e 20 25 73 20 61 74 20 25 73 3a 25 64     c in %s at %s:%d
+  802e00:	3a 20 00 30 31 32 33 34 35 36 37 38 39 41 42 43     : .0123456789ABC
+  802e10:	44 45 46 00 30 31 32 33 34 35 36 37 38 39 61 62     DEF.0123456789ab
+  802e20:	63 64 65 66 00 28 6e 75 6c 6c 29 00 65 72 72 6f     cdef.(null).erro
+  802e30:	72 20 25 64 00 75 6e 73 70 65 63 69 66 69 65 64     r %d.unspecified
+  802e40:	20 65 72 72 6f 72 00 62 61 64 20 65 6e 76 69 72      error.bad envir
+  802e50:	6f 6e 6d 65 6e 74 00 69 6e 76 61 6c 69 64 20 70     onment.invalid p
+  802e60:	61 72 61 6d 65 74 65 72 00 6f 75 74 20 6f 66 20     arameter.out of 
+  802e70:	6d 65 6d 6f 72 79 00 6f 75 74 20 6f 66 20 65 6e     memory.out of en
+  802e80:	76 69 72 6f 6e 6d 65 6e 74 73 00 63 6f 72 72 75     vironments.corru
+  802e90:	70 74 65 64 20 64 65 62 75 67 20 69 6e 66 6f 00     pted debug info.
+  802ea0:	73 65 67 6d 65 6e 74 61 74 69 6f 6e 20 66 61 75     segmentation fau
+  802eb0:	6c 74 00 69 6e 76 61 6c 69 64 20 45 4c 46 20 69     lt.invalid ELF i
+  802ec0:	6d 61 67 65 00 6e 6f 20 73 75 63 68 20 73 79 73     mage.no such sys
+  802ed0:	74 65 6d 20 63 61 6c 6c 00 65 6e 74 72 79 20 6e     tem call.entry n
+  802ee0:	6f 74 20 66 6f 75 6e 64 00 65 6e 76 20 69 73 20     ot found.env is 
+  802ef0:	6e 6f 74 20 72 65 63 76 69 6e 67 00 75 6e 65 78     not recving.unex
+  802f00:	70 65 63 74 65 64 20 65 6e 64 20 6f 66 20 66 69     pected end of fi
+  802f10:	6c 65 00 6e 6f 20 66 72 65 65 20 73 70 61 63 65     le.no free space
+  802f20:	20 6f 6e 20 64 69 73 6b 00 74 6f 6f 20 6d 61 6e      on disk.too man
+  802f30:	79 20 66 69 6c 65 73 20 61 72 65 20 6f 70 65 6e     y files are open
+  802f40:	00 66 69 6c 65 20 6f 72 20 62 6c 6f 63 6b 20 6e     .file or block n
+  802f50:	6f 74 20 66 6f 75 6e 64 00 69 6e 76 61 6c 69 64     ot found.invalid
+  802f60:	20 70 61 74 68 00 66 69 6c 65 20 61 6c 72 65 61      path.file alrea
+  802f70:	64 79 20 65 78 69 73 74 73 00 6f 70 65 72 61 74     dy exists.operat
+  802f80:	69 6f 6e 20 6e 6f 74 20 73 75 70 70 6f 72 74 65     ion not supporte
+  802f90:	64 00 6f 70 65 72 61 74 69 6f 6e 20 69 6e 74 65     d.operation inte
+  802fa0:	72 72 75 70 74 65 64 00 6e 6f 74 20 65 6e 6f 75     rrupted.not enou
+  802fb0:	67 68 20 43 50 55 20 74 69 6d 65 00 0f 1f 40 00     gh CPU time...@.
+  802fc0:	64 1f 80 00 00 00 00 00 a5 25 80 00 00 00 00 00     d........%......
+  802fd0:	95 25 80 00 00 00 00 00 a5 25 80 00 00 00 00 00     .%.......%......
+  802fe0:	a5 25 80 00 00 00 00 00 a5 25 80 00 00 00 00 00     .%.......%......
+  802ff0:	a5 25 80 00 00 00 00 00 83 1f 80 00 00 00 00 00     .%..............
+  803000:	a5 25 80 00 00 00 00 00 a5 25 80 00 00 00 00 00     .%.......%......
+  803010:	77 1f 80 00 00 00 00 00 f1 1f 80 00 00 00 00 00     w...............
+  803020:	a5 25 80 00 00 00 00 00 77 1f 80 00 00 00 00 00     .%......w.......
+  803030:	bd 1f 80 00 00 00 00 00 bd 1f 80 00 00 00 00 00     ................
+  803040:	bd 1f 80 00 00 00 00 00 bd 1f 80 00 00 00 00 00     ................
+  803050:	bd 1f 80 00 00 00 00 00 bd 1f 80 00 00 00 00 00     ................
+  803060:	bd 1f 80 00 00 00 00 00 bd 1f 80 00 00 00 00 00     ................
+  803070:	bd 1f 80 00 00 00 00 00 a5 25 80 00 00 00 00 00     .........%......
+  803080:	a5 25 80 00 00 00 00 00 a5 25 80 00 00 00 00 00     .%.......%......
+  803090:	a5 25 80 00 00 00 00 00 a5 25 80 00 00 00 00 00     .%.......%......
+  8030a0:	a5 25 80 00 00 00 00 00 a5 25 80 00 00 00 00 00     .%.......%......
+  8030b0:	a5 25 80 00 00 00 00 00 a5 25 80 00 00 00 00 00     .%.......%......
+  8030c0:	a5 25 80 00 00 00 00 00 a5 25 80 00 00 00 00 00     .%.......%......
+  8030d0:	a5 25 80 00 00 00 00 00 a5 25 80 00 00 00 00 00     .%.......%......
+  8030e0:	a5 25 80 00 00 00 00 00 a5 25 80 00 00 00 00 00     .%.......%......
+  8030f0:	a5 25 80 00 00 00 00 00 a5 25 80 00 00 00 00 00     .%.......%......
+  803100:	a5 25 80 00 00 00 00 00 a5 25 80 00 00 00 00 00     .%.......%......
+  803110:	a5 25 80 00 00 00 00 00 a5 25 80 00 00 00 00 00     .%.......%......
+  803120:	a5 25 80 00 00 00 00 00 a5 25 80 00 00 00 00 00     .%.......%......
+  803130:	a5 25 80 00 00 00 00 00 a5 25 80 00 00 00 00 00     .%.......%......
+  803140:	a5 25 80 00 00 00 00 00 a5 25 80 00 00 00 00 00     .%.......%......
+  803150:	a5 25 80 00 00 00 00 00 a5 25 80 00 00 00 00 00     .%.......%......
+  803160:	a5 25 80 00 00 00 00 00 c8 24 80 00 00 00 00 00     .%.......$......
+  803170:	a5 25 80 00 00 00 00 00 a5 25 80 00 00 00 00 00     .%.......%......
+  803180:	a5 25 80 00 00 00 00 00 a5 25 80 00 00 00 00 00     .%.......%......
+  803190:	a5 25 80 00 00 00 00 00 a5 25 80 00 00 00 00 00     .%.......%......
+  8031a0:	a5 25 80 00 00 00 00 00 a5 25 80 00 00 00 00 00     .%.......%......
+  8031b0:	a5 25 80 00 00 00 00 00 a5 25 80 00 00 00 00 00     .%.......%......
+  8031c0:	14 20 80 00 00 00 00 00 e3 21 80 00 00 00 00 00     . .......!......
+  8031d0:	a5 25 80 00 00 00 00 00 a5 25 80 00 00 00 00 00     .%.......%......
+  8031e0:	a5 25 80 00 00 00 00 00 a5 25 80 00 00 00 00 00     .%.......%......
+  8031f0:	43 20 80 00 00 00 00 00 a5 25 80 00 00 00 00 00     C .......%......
+  803200:	a5 25 80 00 00 00 00 00 09 20 80 00 00 00 00 00     .%....... ......
+  803210:	a5 25 80 00 00 00 00 00 a5 25 80 00 00 00 00 00     .%.......%......
+  803220:	8b 23 80 00 00 00 00 00 55 24 80 00 00 00 00 00     .#......U$......
+  803230:	a5 25 80 00 00 00 00 00 a5 25 80 00 00 00 00 00     .%.......%......
+  803240:	da 20 80 00 00 00 00 00 a5 25 80 00 00 00 00 00     . .......%......
+  803250:	b7 22 80 00 00 00 00 00 a5 25 80 00 00 00 00 00     .".......%......
+  803260:	a5 25 80 00 00 00 00 00 c8 24 80 00 00 00 00 00     .%.......$......
+  803270:	a5 25 80 00 00 00 00 00 6d 1f 80 00 00 00 00 00     .%......m.......
+
+0000000000803280 <error_string>:
+	...
+  803288:	35 2e 80 00 00 00 00 00 47 2e 80 00 00 00 00 00     5.......G.......
+  803298:	57 2e 80 00 00 00 00 00 69 2e 80 00 00 00 00 00     W.......i.......
+  8032a8:	77 2e 80 00 00 00 00 00 8b 2e 80 00 00 00 00 00     w...............
+  8032b8:	a0 2e 80 00 00 00 00 00 b3 2e 80 00 00 00 00 00     ................
+  8032c8:	c5 2e 80 00 00 00 00 00 d9 2e 80 00 00 00 00 00     ................
+  8032d8:	e9 2e 80 00 00 00 00 00 fc 2e 80 00 00 00 00 00     ................
+  8032e8:	13 2f 80 00 00 00 00 00 29 2f 80 00 00 00 00 00     ./......)/......
+  8032f8:	41 2f 80 00 00 00 00 00 59 2f 80 00 00 00 00 00     A/......Y/......
+  803308:	66 2f 80 00 00 00 00 00 30 33 80 00 00 00 00 00     f/......03......
+  803318:	7a 2f 80 00 00 00 00 00 92 2f 80 00 00 00 00 00     z/......./......
+  803328:	a8 2f 80 00 00 00 00 00 66 69 6c 65 20 69 73 20     ./......file is 
+  803338:	6e 6f 74 20 61 20 76 61 6c 69 64 20 65 78 65 63     not a valid exec
+  803348:	75 74 61 62 6c 65 00 73 79 73 5f 69 70 63 5f 74     utable.sys_ipc_t
+  803358:	72 79 5f 73 65 6e 64 20 66 61 69 6c 65 64 3a 20     ry_send failed: 
+  803368:	25 69 00 6c 69 62 2f 69 70 63 2e 63 00 66 2e 0f     %i.lib/ipc.c.f..
+  803378:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803388:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803398:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8033a8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8033b8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8033c8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8033d8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8033e8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8033f8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803408:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803418:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803428:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803438:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803448:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803458:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803468:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803478:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803488:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803498:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8034a8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8034b8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8034c8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8034d8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8034e8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8034f8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803508:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803518:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803528:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803538:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803548:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803558:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803568:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803578:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803588:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803598:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8035a8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8035b8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8035c8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8035d8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8035e8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8035f8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803608:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803618:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803628:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803638:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803648:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803658:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803668:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803678:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803688:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803698:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8036a8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8036b8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8036c8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8036d8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8036e8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8036f8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803708:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803718:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803728:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803738:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803748:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803758:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803768:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803778:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803788:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803798:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8037a8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8037b8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8037c8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8037d8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8037e8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8037f8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803808:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803818:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803828:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803838:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803848:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803858:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803868:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803878:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803888:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803898:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8038a8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8038b8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8038c8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8038d8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8038e8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8038f8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803908:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803918:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803928:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803938:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803948:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803958:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803968:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803978:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803988:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803998:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8039a8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8039b8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8039c8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8039d8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8039e8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8039f8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803a08:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803a18:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803a28:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803a38:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803a48:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803a58:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803a68:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803a78:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803a88:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803a98:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803aa8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803ab8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803ac8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803ad8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803ae8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803af8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803b08:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803b18:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803b28:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803b38:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803b48:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803b58:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803b68:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803b78:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803b88:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803b98:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803ba8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803bb8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803bc8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803bd8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803be8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803bf8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803c08:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803c18:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803c28:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803c38:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803c48:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803c58:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803c68:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803c78:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803c88:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803c98:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803ca8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803cb8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803cc8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803cd8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803ce8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803cf8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803d08:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803d18:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803d28:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803d38:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803d48:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803d58:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803d68:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803d78:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803d88:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803d98:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803da8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803db8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803dc8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803dd8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803de8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803df8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803e08:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803e18:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803e28:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803e38:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803e48:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803e58:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803e68:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803e78:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803e88:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803e98:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803ea8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803eb8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803ec8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803ed8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803ee8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803ef8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803f08:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803f18:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803f28:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803f38:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803f48:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803f58:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803f68:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803f78:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803f88:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803f98:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803fa8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803fb8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803fc8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803fd8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803fe8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803ff8:	1f 84 00 00 00 00 00 90                             ........
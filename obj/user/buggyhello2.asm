@@ -0,0 +1,5442 @@
+
+obj/user/buggyhello2:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 26 00 00 00       	call   800049 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+#include <inc/lib.h>
+
+const char *hello = "hello, world\n";
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+    sys_cputs(hello, 1024 * 1024);
+  800029:	be 00 00 10 00       	mov    $0x100000,%esi
+  80002e:	48 b8 00 40 80 00 00 	movabs $0x804000,%rax
+  800035:	00 00 00 
+  800038:	48 8b 38             	mov    (%rax),%rdi
+  80003b:	48 b8 15 01 80 00 00 	movabs $0x800115,%rax
+  800042:	00 00 00 
+  800045:	ff d0                	call   *%rax
+}
+  800047:	5d                   	pop    %rbp
+  800048:	c3                   	ret
+
+0000000000800049 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800049:	55                   	push   %rbp
+  80004a:	48 89 e5             	mov    %rsp,%rbp
+  80004d:	41 56                	push   %r14
+  80004f:	41 55                	push   %r13
+  800051:	41 54                	push   %r12
+  800053:	53                   	push   %rbx
+  800054:	41 89 fd             	mov    %edi,%r13d
+  800057:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  80005a:	48 ba d8 40 80 00 00 	movabs $0x8040d8,%rdx
+  800061:	00 00 00 
+  800064:	48 b8 d8 40 80 00 00 	movabs $0x8040d8,%rax
+  80006b:	00 00 00 
+  80006e:	48 39 c2             	cmp    %rax,%rdx
+  800071:	73 17                	jae    80008a <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  800073:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  800076:	49 89 c4             	mov    %rax,%r12
+  800079:	48 83 c3 08          	add    $0x8,%rbx
+  80007d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800082:	ff 53 f8             	call   *-0x8(%rbx)
+  800085:	4c 39 e3             	cmp    %r12,%rbx
+  800088:	72 ef                	jb     800079 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+    envid_t this_env_id = sys_getenvid();
+  80008a:	48 b8 de 01 80 00 00 	movabs $0x8001de,%rax
+  800091:	00 00 00 
+  800094:	ff d0                	call   *%rax
+    thisenv = &((struct Env*)UENVS)[ENVX(this_env_id)];
+  800096:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80009b:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+  8000a2:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8000a9:	00 00 00 
+  8000ac:	48 01 d0             	add    %rdx,%rax
+  8000af:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  8000b6:	00 00 00 
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8000b9:	45 85 ed             	test   %r13d,%r13d
+  8000bc:	7e 0d                	jle    8000cb <libmain+0x82>
+  8000be:	49 8b 06             	mov    (%r14),%rax
+  8000c1:	48 a3 08 40 80 00 00 	movabs %rax,0x804008
+  8000c8:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8000cb:	4c 89 f6             	mov    %r14,%rsi
+  8000ce:	44 89 ef             	mov    %r13d,%edi
+  8000d1:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8000d8:	00 00 00 
+  8000db:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8000dd:	48 b8 f2 00 80 00 00 	movabs $0x8000f2,%rax
+  8000e4:	00 00 00 
+  8000e7:	ff d0                	call   *%rax
+#endif
+}
+  8000e9:	5b                   	pop    %rbx
+  8000ea:	41 5c                	pop    %r12
+  8000ec:	41 5d                	pop    %r13
+  8000ee:	41 5e                	pop    %r14
+  8000f0:	5d                   	pop    %rbp
+  8000f1:	c3                   	ret
+
+00000000008000f2 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8000f2:	55                   	push   %rbp
+  8000f3:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  8000f6:	48 b8 32 09 80 00 00 	movabs $0x800932,%rax
+  8000fd:	00 00 00 
+  800100:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  800102:	bf 00 00 00 00       	mov    $0x0,%edi
+  800107:	48 b8 73 01 80 00 00 	movabs $0x800173,%rax
+  80010e:	00 00 00 
+  800111:	ff d0                	call   *%rax
+}
+  800113:	5d                   	pop    %rbp
+  800114:	c3                   	ret
+
+0000000000800115 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  800115:	55                   	push   %rbp
+  800116:	48 89 e5             	mov    %rsp,%rbp
+  800119:	53                   	push   %rbx
+  80011a:	48 89 fa             	mov    %rdi,%rdx
+  80011d:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  800120:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800125:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80012a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80012f:	be 00 00 00 00       	mov    $0x0,%esi
+  800134:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80013a:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  80013c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800140:	c9                   	leave
+  800141:	c3                   	ret
+
+0000000000800142 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  800142:	55                   	push   %rbp
+  800143:	48 89 e5             	mov    %rsp,%rbp
+  800146:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  800147:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80014c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800151:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800156:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80015b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800160:	be 00 00 00 00       	mov    $0x0,%esi
+  800165:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80016b:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  80016d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800171:	c9                   	leave
+  800172:	c3                   	ret
+
+0000000000800173 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  800173:	55                   	push   %rbp
+  800174:	48 89 e5             	mov    %rsp,%rbp
+  800177:	53                   	push   %rbx
+  800178:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  80017c:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80017f:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800184:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800189:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80018e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800193:	be 00 00 00 00       	mov    $0x0,%esi
+  800198:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80019e:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8001a0:	48 85 c0             	test   %rax,%rax
+  8001a3:	7f 06                	jg     8001ab <sys_env_destroy+0x38>
+}
+  8001a5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8001a9:	c9                   	leave
+  8001aa:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8001ab:	49 89 c0             	mov    %rax,%r8
+  8001ae:	b9 03 00 00 00       	mov    $0x3,%ecx
+  8001b3:	48 ba b0 2c 80 00 00 	movabs $0x802cb0,%rdx
+  8001ba:	00 00 00 
+  8001bd:	be 26 00 00 00       	mov    $0x26,%esi
+  8001c2:	48 bf cf 2c 80 00 00 	movabs $0x802ccf,%rdi
+  8001c9:	00 00 00 
+  8001cc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001d1:	49 b9 2f 1c 80 00 00 	movabs $0x801c2f,%r9
+  8001d8:	00 00 00 
+  8001db:	41 ff d1             	call   *%r9
+
+00000000008001de <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  8001de:	55                   	push   %rbp
+  8001df:	48 89 e5             	mov    %rsp,%rbp
+  8001e2:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8001e3:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8001e8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8001ed:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8001f2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8001f7:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8001fc:	be 00 00 00 00       	mov    $0x0,%esi
+  800201:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800207:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  800209:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80020d:	c9                   	leave
+  80020e:	c3                   	ret
+
+000000000080020f <sys_yield>:
+
+void
+sys_yield(void) {
+  80020f:	55                   	push   %rbp
+  800210:	48 89 e5             	mov    %rsp,%rbp
+  800213:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  800214:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800219:	ba 00 00 00 00       	mov    $0x0,%edx
+  80021e:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800223:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800228:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80022d:	be 00 00 00 00       	mov    $0x0,%esi
+  800232:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800238:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  80023a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80023e:	c9                   	leave
+  80023f:	c3                   	ret
+
+0000000000800240 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  800240:	55                   	push   %rbp
+  800241:	48 89 e5             	mov    %rsp,%rbp
+  800244:	53                   	push   %rbx
+  800245:	48 89 fa             	mov    %rdi,%rdx
+  800248:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80024b:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800250:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  800257:	00 00 00 
+  80025a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80025f:	be 00 00 00 00       	mov    $0x0,%esi
+  800264:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80026a:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  80026c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800270:	c9                   	leave
+  800271:	c3                   	ret
+
+0000000000800272 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  800272:	55                   	push   %rbp
+  800273:	48 89 e5             	mov    %rsp,%rbp
+  800276:	53                   	push   %rbx
+  800277:	49 89 f8             	mov    %rdi,%r8
+  80027a:	48 89 d3             	mov    %rdx,%rbx
+  80027d:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  800280:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800285:	4c 89 c2             	mov    %r8,%rdx
+  800288:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80028b:	be 00 00 00 00       	mov    $0x0,%esi
+  800290:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800296:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  800298:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80029c:	c9                   	leave
+  80029d:	c3                   	ret
+
+000000000080029e <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  80029e:	55                   	push   %rbp
+  80029f:	48 89 e5             	mov    %rsp,%rbp
+  8002a2:	53                   	push   %rbx
+  8002a3:	48 83 ec 08          	sub    $0x8,%rsp
+  8002a7:	89 f8                	mov    %edi,%eax
+  8002a9:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  8002ac:	48 63 f9             	movslq %ecx,%rdi
+  8002af:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8002b2:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8002b7:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8002ba:	be 00 00 00 00       	mov    $0x0,%esi
+  8002bf:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8002c5:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8002c7:	48 85 c0             	test   %rax,%rax
+  8002ca:	7f 06                	jg     8002d2 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  8002cc:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8002d0:	c9                   	leave
+  8002d1:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8002d2:	49 89 c0             	mov    %rax,%r8
+  8002d5:	b9 04 00 00 00       	mov    $0x4,%ecx
+  8002da:	48 ba b0 2c 80 00 00 	movabs $0x802cb0,%rdx
+  8002e1:	00 00 00 
+  8002e4:	be 26 00 00 00       	mov    $0x26,%esi
+  8002e9:	48 bf cf 2c 80 00 00 	movabs $0x802ccf,%rdi
+  8002f0:	00 00 00 
+  8002f3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002f8:	49 b9 2f 1c 80 00 00 	movabs $0x801c2f,%r9
+  8002ff:	00 00 00 
+  800302:	41 ff d1             	call   *%r9
+
+0000000000800305 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  800305:	55                   	push   %rbp
+  800306:	48 89 e5             	mov    %rsp,%rbp
+  800309:	53                   	push   %rbx
+  80030a:	48 83 ec 08          	sub    $0x8,%rsp
+  80030e:	89 f8                	mov    %edi,%eax
+  800310:	49 89 f2             	mov    %rsi,%r10
+  800313:	48 89 cf             	mov    %rcx,%rdi
+  800316:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  800319:	48 63 da             	movslq %edx,%rbx
+  80031c:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80031f:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800324:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800327:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  80032a:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80032c:	48 85 c0             	test   %rax,%rax
+  80032f:	7f 06                	jg     800337 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  800331:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800335:	c9                   	leave
+  800336:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800337:	49 89 c0             	mov    %rax,%r8
+  80033a:	b9 05 00 00 00       	mov    $0x5,%ecx
+  80033f:	48 ba b0 2c 80 00 00 	movabs $0x802cb0,%rdx
+  800346:	00 00 00 
+  800349:	be 26 00 00 00       	mov    $0x26,%esi
+  80034e:	48 bf cf 2c 80 00 00 	movabs $0x802ccf,%rdi
+  800355:	00 00 00 
+  800358:	b8 00 00 00 00       	mov    $0x0,%eax
+  80035d:	49 b9 2f 1c 80 00 00 	movabs $0x801c2f,%r9
+  800364:	00 00 00 
+  800367:	41 ff d1             	call   *%r9
+
+000000000080036a <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  80036a:	55                   	push   %rbp
+  80036b:	48 89 e5             	mov    %rsp,%rbp
+  80036e:	53                   	push   %rbx
+  80036f:	48 83 ec 08          	sub    $0x8,%rsp
+  800373:	48 89 f1             	mov    %rsi,%rcx
+  800376:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  800379:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80037c:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800381:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800386:	be 00 00 00 00       	mov    $0x0,%esi
+  80038b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800391:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800393:	48 85 c0             	test   %rax,%rax
+  800396:	7f 06                	jg     80039e <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  800398:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80039c:	c9                   	leave
+  80039d:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80039e:	49 89 c0             	mov    %rax,%r8
+  8003a1:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8003a6:	48 ba b0 2c 80 00 00 	movabs $0x802cb0,%rdx
+  8003ad:	00 00 00 
+  8003b0:	be 26 00 00 00       	mov    $0x26,%esi
+  8003b5:	48 bf cf 2c 80 00 00 	movabs $0x802ccf,%rdi
+  8003bc:	00 00 00 
+  8003bf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003c4:	49 b9 2f 1c 80 00 00 	movabs $0x801c2f,%r9
+  8003cb:	00 00 00 
+  8003ce:	41 ff d1             	call   *%r9
+
+00000000008003d1 <sys_region_batch>:
+
+int
+sys_region_batch(const struct RegionOp *ops, size_t count) {
+  8003d1:	55                   	push   %rbp
+  8003d2:	48 89 e5             	mov    %rsp,%rbp
+  8003d5:	53                   	push   %rbx
+  8003d6:	48 83 ec 08          	sub    $0x8,%rsp
+  8003da:	48 89 fa             	mov    %rdi,%rdx
+  8003dd:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8003e0:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8003e5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8003ea:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8003ef:	be 00 00 00 00       	mov    $0x0,%esi
+  8003f4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8003fa:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8003fc:	48 85 c0             	test   %rax,%rax
+  8003ff:	7f 06                	jg     800407 <sys_region_batch+0x36>
+        else
+            platform_asan_unpoison(va, ops[i].size);
+    }
+#endif
+    return res;
+}
+  800401:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800405:	c9                   	leave
+  800406:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800407:	49 89 c0             	mov    %rax,%r8
+  80040a:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  80040f:	48 ba b0 2c 80 00 00 	movabs $0x802cb0,%rdx
+  800416:	00 00 00 
+  800419:	be 26 00 00 00       	mov    $0x26,%esi
+  80041e:	48 bf cf 2c 80 00 00 	movabs $0x802ccf,%rdi
+  800425:	00 00 00 
+  800428:	b8 00 00 00 00       	mov    $0x0,%eax
+  80042d:	49 b9 2f 1c 80 00 00 	movabs $0x801c2f,%r9
+  800434:	00 00 00 
+  800437:	41 ff d1             	call   *%r9
+
+000000000080043a <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  80043a:	55                   	push   %rbp
+  80043b:	48 89 e5             	mov    %rsp,%rbp
+  80043e:	53                   	push   %rbx
+  80043f:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  800443:	48 63 ce             	movslq %esi,%rcx
+  800446:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800449:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80044e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800453:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800458:	be 00 00 00 00       	mov    $0x0,%esi
+  80045d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800463:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800465:	48 85 c0             	test   %rax,%rax
+  800468:	7f 06                	jg     800470 <sys_env_set_status+0x36>
+}
+  80046a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80046e:	c9                   	leave
+  80046f:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800470:	49 89 c0             	mov    %rax,%r8
+  800473:	b9 09 00 00 00       	mov    $0x9,%ecx
+  800478:	48 ba b0 2c 80 00 00 	movabs $0x802cb0,%rdx
+  80047f:	00 00 00 
+  800482:	be 26 00 00 00       	mov    $0x26,%esi
+  800487:	48 bf cf 2c 80 00 00 	movabs $0x802ccf,%rdi
+  80048e:	00 00 00 
+  800491:	b8 00 00 00 00       	mov    $0x0,%eax
+  800496:	49 b9 2f 1c 80 00 00 	movabs $0x801c2f,%r9
+  80049d:	00 00 00 
+  8004a0:	41 ff d1             	call   *%r9
+
+00000000008004a3 <sys_env_set_weight>:
+
+int
+sys_env_set_weight(envid_t envid, uint32_t weight) {
+  8004a3:	55                   	push   %rbp
+  8004a4:	48 89 e5             	mov    %rsp,%rbp
+  8004a7:	53                   	push   %rbx
+  8004a8:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_weight, 1, envid, weight, 0, 0, 0, 0);
+  8004ac:	89 f1                	mov    %esi,%ecx
+  8004ae:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8004b1:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8004b6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8004bb:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8004c0:	be 00 00 00 00       	mov    $0x0,%esi
+  8004c5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8004cb:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8004cd:	48 85 c0             	test   %rax,%rax
+  8004d0:	7f 06                	jg     8004d8 <sys_env_set_weight+0x35>
+}
+  8004d2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8004d6:	c9                   	leave
+  8004d7:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8004d8:	49 89 c0             	mov    %rax,%r8
+  8004db:	b9 10 00 00 00       	mov    $0x10,%ecx
+  8004e0:	48 ba b0 2c 80 00 00 	movabs $0x802cb0,%rdx
+  8004e7:	00 00 00 
+  8004ea:	be 26 00 00 00       	mov    $0x26,%esi
+  8004ef:	48 bf cf 2c 80 00 00 	movabs $0x802ccf,%rdi
+  8004f6:	00 00 00 
+  8004f9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004fe:	49 b9 2f 1c 80 00 00 	movabs $0x801c2f,%r9
+  800505:	00 00 00 
+  800508:	41 ff d1             	call   *%r9
+
+000000000080050b <sys_env_set_rt>:
+
+int
+sys_env_set_rt(envid_t envid, uint64_t period, uint64_t budget, uint64_t deadline) {
+  80050b:	55                   	push   %rbp
+  80050c:	48 89 e5             	mov    %rsp,%rbp
+  80050f:	53                   	push   %rbx
+  800510:	48 83 ec 08          	sub    $0x8,%rsp
+  800514:	89 f8                	mov    %edi,%eax
+  800516:	48 89 d3             	mov    %rdx,%rbx
+  800519:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_env_set_rt, 1, envid, period, budget, deadline, 0, 0);
+  80051c:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80051f:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800524:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800527:	be 00 00 00 00       	mov    $0x0,%esi
+  80052c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800532:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800534:	48 85 c0             	test   %rax,%rax
+  800537:	7f 06                	jg     80053f <sys_env_set_rt+0x34>
+}
+  800539:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80053d:	c9                   	leave
+  80053e:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80053f:	49 89 c0             	mov    %rax,%r8
+  800542:	b9 11 00 00 00       	mov    $0x11,%ecx
+  800547:	48 ba b0 2c 80 00 00 	movabs $0x802cb0,%rdx
+  80054e:	00 00 00 
+  800551:	be 26 00 00 00       	mov    $0x26,%esi
+  800556:	48 bf cf 2c 80 00 00 	movabs $0x802ccf,%rdi
+  80055d:	00 00 00 
+  800560:	b8 00 00 00 00       	mov    $0x0,%eax
+  800565:	49 b9 2f 1c 80 00 00 	movabs $0x801c2f,%r9
+  80056c:	00 00 00 
+  80056f:	41 ff d1             	call   *%r9
+
+0000000000800572 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  800572:	55                   	push   %rbp
+  800573:	48 89 e5             	mov    %rsp,%rbp
+  800576:	53                   	push   %rbx
+  800577:	48 83 ec 08          	sub    $0x8,%rsp
+  80057b:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  80057e:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800581:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800586:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80058b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800590:	be 00 00 00 00       	mov    $0x0,%esi
+  800595:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80059b:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80059d:	48 85 c0             	test   %rax,%rax
+  8005a0:	7f 06                	jg     8005a8 <sys_env_set_trapframe+0x36>
+}
+  8005a2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8005a6:	c9                   	leave
+  8005a7:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8005a8:	49 89 c0             	mov    %rax,%r8
+  8005ab:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  8005b0:	48 ba b0 2c 80 00 00 	movabs $0x802cb0,%rdx
+  8005b7:	00 00 00 
+  8005ba:	be 26 00 00 00       	mov    $0x26,%esi
+  8005bf:	48 bf cf 2c 80 00 00 	movabs $0x802ccf,%rdi
+  8005c6:	00 00 00 
+  8005c9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005ce:	49 b9 2f 1c 80 00 00 	movabs $0x801c2f,%r9
+  8005d5:	00 00 00 
+  8005d8:	41 ff d1             	call   *%r9
+
+00000000008005db <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  8005db:	55                   	push   %rbp
+  8005dc:	48 89 e5             	mov    %rsp,%rbp
+  8005df:	53                   	push   %rbx
+  8005e0:	48 83 ec 08          	sub    $0x8,%rsp
+  8005e4:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  8005e7:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8005ea:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8005ef:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8005f4:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8005f9:	be 00 00 00 00       	mov    $0x0,%esi
+  8005fe:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800604:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800606:	48 85 c0             	test   %rax,%rax
+  800609:	7f 06                	jg     800611 <sys_env_set_pgfault_upcall+0x36>
+}
+  80060b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80060f:	c9                   	leave
+  800610:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800611:	49 89 c0             	mov    %rax,%r8
+  800614:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  800619:	48 ba b0 2c 80 00 00 	movabs $0x802cb0,%rdx
+  800620:	00 00 00 
+  800623:	be 26 00 00 00       	mov    $0x26,%esi
+  800628:	48 bf cf 2c 80 00 00 	movabs $0x802ccf,%rdi
+  80062f:	00 00 00 
+  800632:	b8 00 00 00 00       	mov    $0x0,%eax
+  800637:	49 b9 2f 1c 80 00 00 	movabs $0x801c2f,%r9
+  80063e:	00 00 00 
+  800641:	41 ff d1             	call   *%r9
+
+0000000000800644 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  800644:	55                   	push   %rbp
+  800645:	48 89 e5             	mov    %rsp,%rbp
+  800648:	53                   	push   %rbx
+  800649:	89 f8                	mov    %edi,%eax
+  80064b:	49 89 f1             	mov    %rsi,%r9
+  80064e:	48 89 d3             	mov    %rdx,%rbx
+  800651:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  800654:	49 63 f0             	movslq %r8d,%rsi
+  800657:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80065a:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80065f:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800662:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800668:	cd 30                	int    $0x30
+}
+  80066a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80066e:	c9                   	leave
+  80066f:	c3                   	ret
+
+0000000000800670 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  800670:	55                   	push   %rbp
+  800671:	48 89 e5             	mov    %rsp,%rbp
+  800674:	53                   	push   %rbx
+  800675:	48 83 ec 08          	sub    $0x8,%rsp
+  800679:	48 89 fa             	mov    %rdi,%rdx
+  80067c:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80067f:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800684:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800689:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80068e:	be 00 00 00 00       	mov    $0x0,%esi
+  800693:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800699:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80069b:	48 85 c0             	test   %rax,%rax
+  80069e:	7f 06                	jg     8006a6 <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8006a0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8006a4:	c9                   	leave
+  8006a5:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8006a6:	49 89 c0             	mov    %rax,%r8
+  8006a9:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  8006ae:	48 ba b0 2c 80 00 00 	movabs $0x802cb0,%rdx
+  8006b5:	00 00 00 
+  8006b8:	be 26 00 00 00       	mov    $0x26,%esi
+  8006bd:	48 bf cf 2c 80 00 00 	movabs $0x802ccf,%rdi
+  8006c4:	00 00 00 
+  8006c7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006cc:	49 b9 2f 1c 80 00 00 	movabs $0x801c2f,%r9
+  8006d3:	00 00 00 
+  8006d6:	41 ff d1             	call   *%r9
+
+00000000008006d9 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8006d9:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8006e0:	ff ff ff 
+  8006e3:	48 01 f8             	add    %rdi,%rax
+  8006e6:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  8006ea:	c3                   	ret
+
+00000000008006eb <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8006eb:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8006f2:	ff ff ff 
+  8006f5:	48 01 f8             	add    %rdi,%rax
+  8006f8:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  8006fc:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  800702:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  800706:	c3                   	ret
+
+0000000000800707 <fd_alloc_from>:
+}
+
+/* Like fd_alloc(), but only considers fds starting from fdnum,
+ * so that several fds can be found before their pages are allocated */
+int
+fd_alloc_from(int fdnum, struct Fd **fd_store) {
+  800707:	55                   	push   %rbp
+  800708:	48 89 e5             	mov    %rsp,%rbp
+  80070b:	41 57                	push   %r15
+  80070d:	41 56                	push   %r14
+  80070f:	41 55                	push   %r13
+  800711:	41 54                	push   %r12
+  800713:	53                   	push   %rbx
+  800714:	48 83 ec 08          	sub    $0x8,%rsp
+  800718:	49 89 f7             	mov    %rsi,%r15
+    for (int i = MAX(fdnum, 0); i < MAXFD; i++) {
+  80071b:	85 ff                	test   %edi,%edi
+  80071d:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  800723:	44 0f 49 e7          	cmovns %edi,%r12d
+  800727:	83 ff 1f             	cmp    $0x1f,%edi
+  80072a:	7f 37                	jg     800763 <fd_alloc_from+0x5c>
+  80072c:	49 63 dc             	movslq %r12d,%rbx
+  80072f:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  800736:	48 c1 e3 0c          	shl    $0xc,%rbx
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  80073a:	49 be 10 18 80 00 00 	movabs $0x801810,%r14
+  800741:	00 00 00 
+        struct Fd *fd = INDEX2FD(i);
+  800744:	49 89 dd             	mov    %rbx,%r13
+        if (!(get_prot(fd) & PROT_R)) {
+  800747:	48 89 df             	mov    %rbx,%rdi
+  80074a:	41 ff d6             	call   *%r14
+  80074d:	83 e0 04             	and    $0x4,%eax
+  800750:	74 1c                	je     80076e <fd_alloc_from+0x67>
+    for (int i = MAX(fdnum, 0); i < MAXFD; i++) {
+  800752:	41 83 c4 01          	add    $0x1,%r12d
+  800756:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  80075d:	41 83 fc 1f          	cmp    $0x1f,%r12d
+  800761:	7e e1                	jle    800744 <fd_alloc_from+0x3d>
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  800763:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  800769:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  80076e:	4d 89 2f             	mov    %r13,(%r15)
+}
+  800771:	48 83 c4 08          	add    $0x8,%rsp
+  800775:	5b                   	pop    %rbx
+  800776:	41 5c                	pop    %r12
+  800778:	41 5d                	pop    %r13
+  80077a:	41 5e                	pop    %r14
+  80077c:	41 5f                	pop    %r15
+  80077e:	5d                   	pop    %rbp
+  80077f:	c3                   	ret
+
+0000000000800780 <fd_alloc>:
+fd_alloc(struct Fd **fd_store) {
+  800780:	55                   	push   %rbp
+  800781:	48 89 e5             	mov    %rsp,%rbp
+  800784:	48 89 fe             	mov    %rdi,%rsi
+    return fd_alloc_from(0, fd_store);
+  800787:	bf 00 00 00 00       	mov    $0x0,%edi
+  80078c:	48 b8 07 07 80 00 00 	movabs $0x800707,%rax
+  800793:	00 00 00 
+  800796:	ff d0                	call   *%rax
+}
+  800798:	5d                   	pop    %rbp
+  800799:	c3                   	ret
+
+000000000080079a <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  80079a:	83 ff 1f             	cmp    $0x1f,%edi
+  80079d:	77 39                	ja     8007d8 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  80079f:	55                   	push   %rbp
+  8007a0:	48 89 e5             	mov    %rsp,%rbp
+  8007a3:	41 54                	push   %r12
+  8007a5:	53                   	push   %rbx
+  8007a6:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  8007a9:	48 63 df             	movslq %edi,%rbx
+  8007ac:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  8007b3:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  8007b7:	48 89 df             	mov    %rbx,%rdi
+  8007ba:	48 b8 10 18 80 00 00 	movabs $0x801810,%rax
+  8007c1:	00 00 00 
+  8007c4:	ff d0                	call   *%rax
+  8007c6:	a8 04                	test   $0x4,%al
+  8007c8:	74 14                	je     8007de <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  8007ca:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  8007ce:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8007d3:	5b                   	pop    %rbx
+  8007d4:	41 5c                	pop    %r12
+  8007d6:	5d                   	pop    %rbp
+  8007d7:	c3                   	ret
+        return -E_INVAL;
+  8007d8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8007dd:	c3                   	ret
+        return -E_INVAL;
+  8007de:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8007e3:	eb ee                	jmp    8007d3 <fd_lookup+0x39>
+
+00000000008007e5 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  8007e5:	55                   	push   %rbp
+  8007e6:	48 89 e5             	mov    %rsp,%rbp
+  8007e9:	41 54                	push   %r12
+  8007eb:	53                   	push   %rbx
+  8007ec:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  8007ef:	48 b8 60 2d 80 00 00 	movabs $0x802d60,%rax
+  8007f6:	00 00 00 
+  8007f9:	48 bb 20 40 80 00 00 	movabs $0x804020,%rbx
+  800800:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  800803:	39 3b                	cmp    %edi,(%rbx)
+  800805:	74 47                	je     80084e <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  800807:	48 83 c0 08          	add    $0x8,%rax
+  80080b:	48 8b 18             	mov    (%rax),%rbx
+  80080e:	48 85 db             	test   %rbx,%rbx
+  800811:	75 f0                	jne    800803 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  800813:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  80081a:	00 00 00 
+  80081d:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+  800823:	89 fa                	mov    %edi,%edx
+  800825:	48 bf e0 2c 80 00 00 	movabs $0x802ce0,%rdi
+  80082c:	00 00 00 
+  80082f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800834:	48 b9 7f 1d 80 00 00 	movabs $0x801d7f,%rcx
+  80083b:	00 00 00 
+  80083e:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  800840:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  800845:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  800849:	5b                   	pop    %rbx
+  80084a:	41 5c                	pop    %r12
+  80084c:	5d                   	pop    %rbp
+  80084d:	c3                   	ret
+            return 0;
+  80084e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800853:	eb f0                	jmp    800845 <dev_lookup+0x60>
+
+0000000000800855 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  800855:	55                   	push   %rbp
+  800856:	48 89 e5             	mov    %rsp,%rbp
+  800859:	41 55                	push   %r13
+  80085b:	41 54                	push   %r12
+  80085d:	53                   	push   %rbx
+  80085e:	48 83 ec 18          	sub    $0x18,%rsp
+  800862:	48 89 fb             	mov    %rdi,%rbx
+  800865:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  800868:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  80086f:	ff ff ff 
+  800872:	48 01 df             	add    %rbx,%rdi
+  800875:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  800879:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80087d:	48 b8 9a 07 80 00 00 	movabs $0x80079a,%rax
+  800884:	00 00 00 
+  800887:	ff d0                	call   *%rax
+  800889:	41 89 c5             	mov    %eax,%r13d
+  80088c:	85 c0                	test   %eax,%eax
+  80088e:	78 06                	js     800896 <fd_close+0x41>
+  800890:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  800894:	74 1a                	je     8008b0 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  800896:	45 84 e4             	test   %r12b,%r12b
+  800899:	b8 00 00 00 00       	mov    $0x0,%eax
+  80089e:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  8008a2:	44 89 e8             	mov    %r13d,%eax
+  8008a5:	48 83 c4 18          	add    $0x18,%rsp
+  8008a9:	5b                   	pop    %rbx
+  8008aa:	41 5c                	pop    %r12
+  8008ac:	41 5d                	pop    %r13
+  8008ae:	5d                   	pop    %rbp
+  8008af:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8008b0:	8b 3b                	mov    (%rbx),%edi
+  8008b2:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8008b6:	48 b8 e5 07 80 00 00 	movabs $0x8007e5,%rax
+  8008bd:	00 00 00 
+  8008c0:	ff d0                	call   *%rax
+  8008c2:	41 89 c5             	mov    %eax,%r13d
+  8008c5:	85 c0                	test   %eax,%eax
+  8008c7:	78 1b                	js     8008e4 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  8008c9:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8008cd:	48 8b 40 20          	mov    0x20(%rax),%rax
+  8008d1:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  8008d7:	48 85 c0             	test   %rax,%rax
+  8008da:	74 08                	je     8008e4 <fd_close+0x8f>
+  8008dc:	48 89 df             	mov    %rbx,%rdi
+  8008df:	ff d0                	call   *%rax
+  8008e1:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8008e4:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8008e9:	48 89 de             	mov    %rbx,%rsi
+  8008ec:	bf 00 00 00 00       	mov    $0x0,%edi
+  8008f1:	48 b8 6a 03 80 00 00 	movabs $0x80036a,%rax
+  8008f8:	00 00 00 
+  8008fb:	ff d0                	call   *%rax
+    return res;
+  8008fd:	eb a3                	jmp    8008a2 <fd_close+0x4d>
+
+00000000008008ff <close>:
+
+int
+close(int fdnum) {
+  8008ff:	55                   	push   %rbp
+  800900:	48 89 e5             	mov    %rsp,%rbp
+  800903:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  800907:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80090b:	48 b8 9a 07 80 00 00 	movabs $0x80079a,%rax
+  800912:	00 00 00 
+  800915:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  800917:	85 c0                	test   %eax,%eax
+  800919:	78 15                	js     800930 <close+0x31>
+
+    return fd_close(fd, 1);
+  80091b:	be 01 00 00 00       	mov    $0x1,%esi
+  800920:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  800924:	48 b8 55 08 80 00 00 	movabs $0x800855,%rax
+  80092b:	00 00 00 
+  80092e:	ff d0                	call   *%rax
+}
+  800930:	c9                   	leave
+  800931:	c3                   	ret
+
+0000000000800932 <close_all>:
+
+void
+close_all(void) {
+  800932:	55                   	push   %rbp
+  800933:	48 89 e5             	mov    %rsp,%rbp
+  800936:	41 54                	push   %r12
+  800938:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  800939:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80093e:	49 bc ff 08 80 00 00 	movabs $0x8008ff,%r12
+  800945:	00 00 00 
+  800948:	89 df                	mov    %ebx,%edi
+  80094a:	41 ff d4             	call   *%r12
+  80094d:	83 c3 01             	add    $0x1,%ebx
+  800950:	83 fb 20             	cmp    $0x20,%ebx
+  800953:	75 f3                	jne    800948 <close_all+0x16>
+}
+  800955:	5b                   	pop    %rbx
+  800956:	41 5c                	pop    %r12
+  800958:	5d                   	pop    %rbp
+  800959:	c3                   	ret
+
+000000000080095a <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  80095a:	55                   	push   %rbp
+  80095b:	48 89 e5             	mov    %rsp,%rbp
+  80095e:	41 57                	push   %r15
+  800960:	41 56                	push   %r14
+  800962:	41 55                	push   %r13
+  800964:	41 54                	push   %r12
+  800966:	53                   	push   %rbx
+  800967:	48 83 ec 18          	sub    $0x18,%rsp
+  80096b:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  80096e:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  800972:	48 b8 9a 07 80 00 00 	movabs $0x80079a,%rax
+  800979:	00 00 00 
+  80097c:	ff d0                	call   *%rax
+  80097e:	89 c3                	mov    %eax,%ebx
+  800980:	85 c0                	test   %eax,%eax
+  800982:	0f 88 b8 00 00 00    	js     800a40 <dup+0xe6>
+    close(newfdnum);
+  800988:	44 89 e7             	mov    %r12d,%edi
+  80098b:	48 b8 ff 08 80 00 00 	movabs $0x8008ff,%rax
+  800992:	00 00 00 
+  800995:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  800997:	4d 63 ec             	movslq %r12d,%r13
+  80099a:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  8009a1:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  8009a5:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  8009a9:	4c 89 ff             	mov    %r15,%rdi
+  8009ac:	49 be eb 06 80 00 00 	movabs $0x8006eb,%r14
+  8009b3:	00 00 00 
+  8009b6:	41 ff d6             	call   *%r14
+  8009b9:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  8009bc:	4c 89 ef             	mov    %r13,%rdi
+  8009bf:	41 ff d6             	call   *%r14
+  8009c2:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  8009c5:	48 89 df             	mov    %rbx,%rdi
+  8009c8:	48 b8 10 18 80 00 00 	movabs $0x801810,%rax
+  8009cf:	00 00 00 
+  8009d2:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  8009d4:	a8 04                	test   $0x4,%al
+  8009d6:	74 2b                	je     800a03 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  8009d8:	41 89 c1             	mov    %eax,%r9d
+  8009db:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8009e1:	4c 89 f1             	mov    %r14,%rcx
+  8009e4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8009e9:	48 89 de             	mov    %rbx,%rsi
+  8009ec:	bf 00 00 00 00       	mov    $0x0,%edi
+  8009f1:	48 b8 05 03 80 00 00 	movabs $0x800305,%rax
+  8009f8:	00 00 00 
+  8009fb:	ff d0                	call   *%rax
+  8009fd:	89 c3                	mov    %eax,%ebx
+  8009ff:	85 c0                	test   %eax,%eax
+  800a01:	78 4e                	js     800a51 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  800a03:	4c 89 ff             	mov    %r15,%rdi
+  800a06:	48 b8 10 18 80 00 00 	movabs $0x801810,%rax
+  800a0d:	00 00 00 
+  800a10:	ff d0                	call   *%rax
+  800a12:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  800a15:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  800a1b:	4c 89 e9             	mov    %r13,%rcx
+  800a1e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800a23:	4c 89 fe             	mov    %r15,%rsi
+  800a26:	bf 00 00 00 00       	mov    $0x0,%edi
+  800a2b:	48 b8 05 03 80 00 00 	movabs $0x800305,%rax
+  800a32:	00 00 00 
+  800a35:	ff d0                	call   *%rax
+  800a37:	89 c3                	mov    %eax,%ebx
+  800a39:	85 c0                	test   %eax,%eax
+  800a3b:	78 14                	js     800a51 <dup+0xf7>
+
+    return newfdnum;
+  800a3d:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  800a40:	89 d8                	mov    %ebx,%eax
+  800a42:	48 83 c4 18          	add    $0x18,%rsp
+  800a46:	5b                   	pop    %rbx
+  800a47:	41 5c                	pop    %r12
+  800a49:	41 5d                	pop    %r13
+  800a4b:	41 5e                	pop    %r14
+  800a4d:	41 5f                	pop    %r15
+  800a4f:	5d                   	pop    %rbp
+  800a50:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  800a51:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800a56:	4c 89 ee             	mov    %r13,%rsi
+  800a59:	bf 00 00 00 00       	mov    $0x0,%edi
+  800a5e:	49 bc 6a 03 80 00 00 	movabs $0x80036a,%r12
+  800a65:	00 00 00 
+  800a68:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  800a6b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800a70:	4c 89 f6             	mov    %r14,%rsi
+  800a73:	bf 00 00 00 00       	mov    $0x0,%edi
+  800a78:	41 ff d4             	call   *%r12
+    return res;
+  800a7b:	eb c3                	jmp    800a40 <dup+0xe6>
+
+0000000000800a7d <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  800a7d:	55                   	push   %rbp
+  800a7e:	48 89 e5             	mov    %rsp,%rbp
+  800a81:	41 56                	push   %r14
+  800a83:	41 55                	push   %r13
+  800a85:	41 54                	push   %r12
+  800a87:	53                   	push   %rbx
+  800a88:	48 83 ec 10          	sub    $0x10,%rsp
+  800a8c:	89 fb                	mov    %edi,%ebx
+  800a8e:	49 89 f4             	mov    %rsi,%r12
+  800a91:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800a94:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800a98:	48 b8 9a 07 80 00 00 	movabs $0x80079a,%rax
+  800a9f:	00 00 00 
+  800aa2:	ff d0                	call   *%rax
+  800aa4:	85 c0                	test   %eax,%eax
+  800aa6:	78 4c                	js     800af4 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800aa8:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  800aac:	41 8b 3e             	mov    (%r14),%edi
+  800aaf:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800ab3:	48 b8 e5 07 80 00 00 	movabs $0x8007e5,%rax
+  800aba:	00 00 00 
+  800abd:	ff d0                	call   *%rax
+  800abf:	85 c0                	test   %eax,%eax
+  800ac1:	78 35                	js     800af8 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  800ac3:	41 8b 46 08          	mov    0x8(%r14),%eax
+  800ac7:	83 e0 03             	and    $0x3,%eax
+  800aca:	83 f8 01             	cmp    $0x1,%eax
+  800acd:	74 2d                	je     800afc <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  800acf:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800ad3:	48 8b 40 10          	mov    0x10(%rax),%rax
+  800ad7:	48 85 c0             	test   %rax,%rax
+  800ada:	74 56                	je     800b32 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  800adc:	4c 89 ea             	mov    %r13,%rdx
+  800adf:	4c 89 e6             	mov    %r12,%rsi
+  800ae2:	4c 89 f7             	mov    %r14,%rdi
+  800ae5:	ff d0                	call   *%rax
+}
+  800ae7:	48 83 c4 10          	add    $0x10,%rsp
+  800aeb:	5b                   	pop    %rbx
+  800aec:	41 5c                	pop    %r12
+  800aee:	41 5d                	pop    %r13
+  800af0:	41 5e                	pop    %r14
+  800af2:	5d                   	pop    %rbp
+  800af3:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800af4:	48 98                	cltq
+  800af6:	eb ef                	jmp    800ae7 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800af8:	48 98                	cltq
+  800afa:	eb eb                	jmp    800ae7 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  800afc:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  800b03:	00 00 00 
+  800b06:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+  800b0c:	89 da                	mov    %ebx,%edx
+  800b0e:	48 bf 21 2d 80 00 00 	movabs $0x802d21,%rdi
+  800b15:	00 00 00 
+  800b18:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b1d:	48 b9 7f 1d 80 00 00 	movabs $0x801d7f,%rcx
+  800b24:	00 00 00 
+  800b27:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  800b29:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  800b30:	eb b5                	jmp    800ae7 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  800b32:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  800b39:	eb ac                	jmp    800ae7 <read+0x6a>
+
+0000000000800b3b <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  800b3b:	55                   	push   %rbp
+  800b3c:	48 89 e5             	mov    %rsp,%rbp
+  800b3f:	41 57                	push   %r15
+  800b41:	41 56                	push   %r14
+  800b43:	41 55                	push   %r13
+  800b45:	41 54                	push   %r12
+  800b47:	53                   	push   %rbx
+  800b48:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  800b4c:	48 85 d2             	test   %rdx,%rdx
+  800b4f:	74 54                	je     800ba5 <readn+0x6a>
+  800b51:	41 89 fd             	mov    %edi,%r13d
+  800b54:	49 89 f6             	mov    %rsi,%r14
+  800b57:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  800b5a:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  800b5f:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  800b64:	49 bf 7d 0a 80 00 00 	movabs $0x800a7d,%r15
+  800b6b:	00 00 00 
+  800b6e:	4c 89 e2             	mov    %r12,%rdx
+  800b71:	48 29 f2             	sub    %rsi,%rdx
+  800b74:	4c 01 f6             	add    %r14,%rsi
+  800b77:	44 89 ef             	mov    %r13d,%edi
+  800b7a:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  800b7d:	85 c0                	test   %eax,%eax
+  800b7f:	78 20                	js     800ba1 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  800b81:	01 c3                	add    %eax,%ebx
+  800b83:	85 c0                	test   %eax,%eax
+  800b85:	74 08                	je     800b8f <readn+0x54>
+  800b87:	48 63 f3             	movslq %ebx,%rsi
+  800b8a:	4c 39 e6             	cmp    %r12,%rsi
+  800b8d:	72 df                	jb     800b6e <readn+0x33>
+    }
+    return res;
+  800b8f:	48 63 c3             	movslq %ebx,%rax
+}
+  800b92:	48 83 c4 08          	add    $0x8,%rsp
+  800b96:	5b                   	pop    %rbx
+  800b97:	41 5c                	pop    %r12
+  800b99:	41 5d                	pop    %r13
+  800b9b:	41 5e                	pop    %r14
+  800b9d:	41 5f                	pop    %r15
+  800b9f:	5d                   	pop    %rbp
+  800ba0:	c3                   	ret
+        if (inc < 0) return inc;
+  800ba1:	48 98                	cltq
+  800ba3:	eb ed                	jmp    800b92 <readn+0x57>
+    int inc = 1, res = 0;
+  800ba5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800baa:	eb e3                	jmp    800b8f <readn+0x54>
+
+0000000000800bac <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  800bac:	55                   	push   %rbp
+  800bad:	48 89 e5             	mov    %rsp,%rbp
+  800bb0:	41 56                	push   %r14
+  800bb2:	41 55                	push   %r13
+  800bb4:	41 54                	push   %r12
+  800bb6:	53                   	push   %rbx
+  800bb7:	48 83 ec 10          	sub    $0x10,%rsp
+  800bbb:	89 fb                	mov    %edi,%ebx
+  800bbd:	49 89 f4             	mov    %rsi,%r12
+  800bc0:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800bc3:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800bc7:	48 b8 9a 07 80 00 00 	movabs $0x80079a,%rax
+  800bce:	00 00 00 
+  800bd1:	ff d0                	call   *%rax
+  800bd3:	85 c0                	test   %eax,%eax
+  800bd5:	78 47                	js     800c1e <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800bd7:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  800bdb:	41 8b 3e             	mov    (%r14),%edi
+  800bde:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800be2:	48 b8 e5 07 80 00 00 	movabs $0x8007e5,%rax
+  800be9:	00 00 00 
+  800bec:	ff d0                	call   *%rax
+  800bee:	85 c0                	test   %eax,%eax
+  800bf0:	78 30                	js     800c22 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800bf2:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  800bf7:	74 2d                	je     800c26 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  800bf9:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800bfd:	48 8b 40 18          	mov    0x18(%rax),%rax
+  800c01:	48 85 c0             	test   %rax,%rax
+  800c04:	74 56                	je     800c5c <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  800c06:	4c 89 ea             	mov    %r13,%rdx
+  800c09:	4c 89 e6             	mov    %r12,%rsi
+  800c0c:	4c 89 f7             	mov    %r14,%rdi
+  800c0f:	ff d0                	call   *%rax
+}
+  800c11:	48 83 c4 10          	add    $0x10,%rsp
+  800c15:	5b                   	pop    %rbx
+  800c16:	41 5c                	pop    %r12
+  800c18:	41 5d                	pop    %r13
+  800c1a:	41 5e                	pop    %r14
+  800c1c:	5d                   	pop    %rbp
+  800c1d:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800c1e:	48 98                	cltq
+  800c20:	eb ef                	jmp    800c11 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800c22:	48 98                	cltq
+  800c24:	eb eb                	jmp    800c11 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  800c26:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  800c2d:	00 00 00 
+  800c30:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+  800c36:	89 da                	mov    %ebx,%edx
+  800c38:	48 bf 3d 2d 80 00 00 	movabs $0x802d3d,%rdi
+  800c3f:	00 00 00 
+  800c42:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c47:	48 b9 7f 1d 80 00 00 	movabs $0x801d7f,%rcx
+  800c4e:	00 00 00 
+  800c51:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  800c53:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  800c5a:	eb b5                	jmp    800c11 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  800c5c:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  800c63:	eb ac                	jmp    800c11 <write+0x65>
+
+0000000000800c65 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  800c65:	55                   	push   %rbp
+  800c66:	48 89 e5             	mov    %rsp,%rbp
+  800c69:	53                   	push   %rbx
+  800c6a:	48 83 ec 18          	sub    $0x18,%rsp
+  800c6e:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800c70:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800c74:	48 b8 9a 07 80 00 00 	movabs $0x80079a,%rax
+  800c7b:	00 00 00 
+  800c7e:	ff d0                	call   *%rax
+  800c80:	85 c0                	test   %eax,%eax
+  800c82:	78 0c                	js     800c90 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  800c84:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800c88:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  800c8b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800c90:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800c94:	c9                   	leave
+  800c95:	c3                   	ret
+
+0000000000800c96 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  800c96:	55                   	push   %rbp
+  800c97:	48 89 e5             	mov    %rsp,%rbp
+  800c9a:	41 55                	push   %r13
+  800c9c:	41 54                	push   %r12
+  800c9e:	53                   	push   %rbx
+  800c9f:	48 83 ec 18          	sub    $0x18,%rsp
+  800ca3:	89 fb                	mov    %edi,%ebx
+  800ca5:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800ca8:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800cac:	48 b8 9a 07 80 00 00 	movabs $0x80079a,%rax
+  800cb3:	00 00 00 
+  800cb6:	ff d0                	call   *%rax
+  800cb8:	85 c0                	test   %eax,%eax
+  800cba:	78 38                	js     800cf4 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800cbc:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  800cc0:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  800cc4:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800cc8:	48 b8 e5 07 80 00 00 	movabs $0x8007e5,%rax
+  800ccf:	00 00 00 
+  800cd2:	ff d0                	call   *%rax
+  800cd4:	85 c0                	test   %eax,%eax
+  800cd6:	78 1c                	js     800cf4 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800cd8:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  800cdd:	74 20                	je     800cff <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  800cdf:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800ce3:	48 8b 40 30          	mov    0x30(%rax),%rax
+  800ce7:	48 85 c0             	test   %rax,%rax
+  800cea:	74 47                	je     800d33 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  800cec:	44 89 e6             	mov    %r12d,%esi
+  800cef:	4c 89 ef             	mov    %r13,%rdi
+  800cf2:	ff d0                	call   *%rax
+}
+  800cf4:	48 83 c4 18          	add    $0x18,%rsp
+  800cf8:	5b                   	pop    %rbx
+  800cf9:	41 5c                	pop    %r12
+  800cfb:	41 5d                	pop    %r13
+  800cfd:	5d                   	pop    %rbp
+  800cfe:	c3                   	ret
+                thisenv->env_id, fdnum);
+  800cff:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  800d06:	00 00 00 
+  800d09:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  800d0f:	89 da                	mov    %ebx,%edx
+  800d11:	48 bf 00 2d 80 00 00 	movabs $0x802d00,%rdi
+  800d18:	00 00 00 
+  800d1b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d20:	48 b9 7f 1d 80 00 00 	movabs $0x801d7f,%rcx
+  800d27:	00 00 00 
+  800d2a:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  800d2c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800d31:	eb c1                	jmp    800cf4 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  800d33:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  800d38:	eb ba                	jmp    800cf4 <ftruncate+0x5e>
+
+0000000000800d3a <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  800d3a:	55                   	push   %rbp
+  800d3b:	48 89 e5             	mov    %rsp,%rbp
+  800d3e:	41 54                	push   %r12
+  800d40:	53                   	push   %rbx
+  800d41:	48 83 ec 10          	sub    $0x10,%rsp
+  800d45:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800d48:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800d4c:	48 b8 9a 07 80 00 00 	movabs $0x80079a,%rax
+  800d53:	00 00 00 
+  800d56:	ff d0                	call   *%rax
+  800d58:	85 c0                	test   %eax,%eax
+  800d5a:	78 4e                	js     800daa <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800d5c:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  800d60:	41 8b 3c 24          	mov    (%r12),%edi
+  800d64:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  800d68:	48 b8 e5 07 80 00 00 	movabs $0x8007e5,%rax
+  800d6f:	00 00 00 
+  800d72:	ff d0                	call   *%rax
+  800d74:	85 c0                	test   %eax,%eax
+  800d76:	78 32                	js     800daa <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  800d78:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800d7c:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  800d81:	74 30                	je     800db3 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  800d83:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  800d86:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  800d8d:	00 00 00 
+    stat->st_isdir = 0;
+  800d90:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  800d97:	00 00 00 
+    stat->st_dev = dev;
+  800d9a:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  800da1:	48 89 de             	mov    %rbx,%rsi
+  800da4:	4c 89 e7             	mov    %r12,%rdi
+  800da7:	ff 50 28             	call   *0x28(%rax)
+}
+  800daa:	48 83 c4 10          	add    $0x10,%rsp
+  800dae:	5b                   	pop    %rbx
+  800daf:	41 5c                	pop    %r12
+  800db1:	5d                   	pop    %rbp
+  800db2:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  800db3:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  800db8:	eb f0                	jmp    800daa <fstat+0x70>
+
+0000000000800dba <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  800dba:	55                   	push   %rbp
+  800dbb:	48 89 e5             	mov    %rsp,%rbp
+  800dbe:	41 54                	push   %r12
+  800dc0:	53                   	push   %rbx
+  800dc1:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  800dc4:	be 00 00 00 00       	mov    $0x0,%esi
+  800dc9:	48 b8 9d 11 80 00 00 	movabs $0x80119d,%rax
+  800dd0:	00 00 00 
+  800dd3:	ff d0                	call   *%rax
+  800dd5:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  800dd7:	85 c0                	test   %eax,%eax
+  800dd9:	78 25                	js     800e00 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  800ddb:	4c 89 e6             	mov    %r12,%rsi
+  800dde:	89 c7                	mov    %eax,%edi
+  800de0:	48 b8 3a 0d 80 00 00 	movabs $0x800d3a,%rax
+  800de7:	00 00 00 
+  800dea:	ff d0                	call   *%rax
+  800dec:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  800def:	89 df                	mov    %ebx,%edi
+  800df1:	48 b8 ff 08 80 00 00 	movabs $0x8008ff,%rax
+  800df8:	00 00 00 
+  800dfb:	ff d0                	call   *%rax
+
+    return res;
+  800dfd:	44 89 e3             	mov    %r12d,%ebx
+}
+  800e00:	89 d8                	mov    %ebx,%eax
+  800e02:	5b                   	pop    %rbx
+  800e03:	41 5c                	pop    %r12
+  800e05:	5d                   	pop    %rbp
+  800e06:	c3                   	ret
+
+0000000000800e07 <fsipc>:
+ * response may be written back to fsipcbuf.
+ * type: request code, passed as the simple integer IPC value.
+ * dstva: virtual address at which to receive reply page, 0 if none.
+ * Returns result from the file server. */
+static int
+fsipc(unsigned type, void *dstva) {
+  800e07:	55                   	push   %rbp
+  800e08:	48 89 e5             	mov    %rsp,%rbp
+  800e0b:	41 54                	push   %r12
+  800e0d:	53                   	push   %rbx
+  800e0e:	48 83 ec 10          	sub    $0x10,%rsp
+  800e12:	41 89 fc             	mov    %edi,%r12d
+  800e15:	48 89 f3             	mov    %rsi,%rbx
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  800e18:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  800e1f:	00 00 00 
+  800e22:	83 38 00             	cmpl   $0x0,(%rax)
+  800e25:	74 5e                	je     800e85 <fsipc+0x7e>
+    if (debug) {
+        cprintf("[%08x] fsipc %d %08x\n",
+                thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+    }
+
+    ipc_send(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW);
+  800e27:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  800e2d:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  800e32:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  800e39:	00 00 00 
+  800e3c:	44 89 e6             	mov    %r12d,%esi
+  800e3f:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  800e46:	00 00 00 
+  800e49:	8b 38                	mov    (%rax),%edi
+  800e4b:	48 b8 a0 2b 80 00 00 	movabs $0x802ba0,%rax
+  800e52:	00 00 00 
+  800e55:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  800e57:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  800e5e:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  800e5f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e64:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  800e68:	48 89 de             	mov    %rbx,%rsi
+  800e6b:	bf 00 00 00 00       	mov    $0x0,%edi
+  800e70:	48 b8 cb 2a 80 00 00 	movabs $0x802acb,%rax
+  800e77:	00 00 00 
+  800e7a:	ff d0                	call   *%rax
+}
+  800e7c:	48 83 c4 10          	add    $0x10,%rsp
+  800e80:	5b                   	pop    %rbx
+  800e81:	41 5c                	pop    %r12
+  800e83:	5d                   	pop    %rbp
+  800e84:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  800e85:	bf 03 00 00 00       	mov    $0x3,%edi
+  800e8a:	48 b8 43 2c 80 00 00 	movabs $0x802c43,%rax
+  800e91:	00 00 00 
+  800e94:	ff d0                	call   *%rax
+  800e96:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  800e9d:	00 00 
+  800e9f:	eb 86                	jmp    800e27 <fsipc+0x20>
+
+0000000000800ea1 <devfile_trunc>:
+    return 0;
+}
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  800ea1:	55                   	push   %rbp
+  800ea2:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  800ea5:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  800eac:	00 00 00 
+  800eaf:	8b 57 0c             	mov    0xc(%rdi),%edx
+  800eb2:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  800eb4:	89 70 04             	mov    %esi,0x4(%rax)
+
+    return fsipc(FSREQ_SET_SIZE, NULL);
+  800eb7:	be 00 00 00 00       	mov    $0x0,%esi
+  800ebc:	bf 02 00 00 00       	mov    $0x2,%edi
+  800ec1:	48 b8 07 0e 80 00 00 	movabs $0x800e07,%rax
+  800ec8:	00 00 00 
+  800ecb:	ff d0                	call   *%rax
+}
+  800ecd:	5d                   	pop    %rbp
+  800ece:	c3                   	ret
+
+0000000000800ecf <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  800ecf:	55                   	push   %rbp
+  800ed0:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  800ed3:	8b 47 0c             	mov    0xc(%rdi),%eax
+  800ed6:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  800edd:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  800edf:	be 00 00 00 00       	mov    $0x0,%esi
+  800ee4:	bf 06 00 00 00       	mov    $0x6,%edi
+  800ee9:	48 b8 07 0e 80 00 00 	movabs $0x800e07,%rax
+  800ef0:	00 00 00 
+  800ef3:	ff d0                	call   *%rax
+}
+  800ef5:	5d                   	pop    %rbp
+  800ef6:	c3                   	ret
+
+0000000000800ef7 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  800ef7:	55                   	push   %rbp
+  800ef8:	48 89 e5             	mov    %rsp,%rbp
+  800efb:	41 54                	push   %r12
+  800efd:	53                   	push   %rbx
+  800efe:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  800f01:	8b 47 0c             	mov    0xc(%rdi),%eax
+  800f04:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  800f0b:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  800f0d:	be 00 00 00 00       	mov    $0x0,%esi
+  800f12:	bf 05 00 00 00       	mov    $0x5,%edi
+  800f17:	48 b8 07 0e 80 00 00 	movabs $0x800e07,%rax
+  800f1e:	00 00 00 
+  800f21:	ff d0                	call   *%rax
+    if (res < 0) {
+  800f23:	85 c0                	test   %eax,%eax
+  800f25:	78 3d                	js     800f64 <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  800f27:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  800f2e:	00 00 00 
+  800f31:	4c 89 e6             	mov    %r12,%rsi
+  800f34:	48 89 df             	mov    %rbx,%rdi
+  800f37:	48 b8 a4 26 80 00 00 	movabs $0x8026a4,%rax
+  800f3e:	00 00 00 
+  800f41:	ff d0                	call   *%rax
+    st->st_size  = fsipcbuf.statRet.ret_size;
+  800f43:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  800f4a:	00 
+  800f4b:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  800f51:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  800f58:	00 
+  800f59:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  800f5f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800f64:	5b                   	pop    %rbx
+  800f65:	41 5c                	pop    %r12
+  800f67:	5d                   	pop    %rbp
+  800f68:	c3                   	ret
+
+0000000000800f69 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  800f69:	55                   	push   %rbp
+  800f6a:	48 89 e5             	mov    %rsp,%rbp
+  800f6d:	41 57                	push   %r15
+  800f6f:	41 56                	push   %r14
+  800f71:	41 55                	push   %r13
+  800f73:	41 54                	push   %r12
+  800f75:	53                   	push   %rbx
+  800f76:	48 83 ec 18          	sub    $0x18,%rsp
+  800f7a:	49 89 fe             	mov    %rdi,%r14
+  800f7d:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+  800f81:	48 89 d3             	mov    %rdx,%rbx
+    while (n > sizeof(fsipcbuf.write.req_buf))
+  800f84:	48 81 fa f0 0f 00 00 	cmp    $0xff0,%rdx
+  800f8b:	0f 86 e4 00 00 00    	jbe    801075 <devfile_write+0x10c>
+  800f91:	49 89 f4             	mov    %rsi,%r12
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  800f94:	49 bd 00 60 80 00 00 	movabs $0x806000,%r13
+  800f9b:	00 00 00 
+        memcpy(fsipcbuf.write.req_buf, buf, sizeof(fsipcbuf.write.req_buf));
+  800f9e:	49 bf 05 29 80 00 00 	movabs $0x802905,%r15
+  800fa5:	00 00 00 
+  800fa8:	eb 03                	jmp    800fad <devfile_write+0x44>
+        buf += sizeof(fsipcbuf.write.req_buf);
+  800faa:	49 89 f4             	mov    %rsi,%r12
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  800fad:	41 8b 46 0c          	mov    0xc(%r14),%eax
+  800fb1:	41 89 45 00          	mov    %eax,0x0(%r13)
+        fsipcbuf.write.req_n      = sizeof(fsipcbuf.write.req_buf);
+  800fb5:	49 c7 45 08 f0 0f 00 	movq   $0xff0,0x8(%r13)
+  800fbc:	00 
+        memcpy(fsipcbuf.write.req_buf, buf, sizeof(fsipcbuf.write.req_buf));
+  800fbd:	ba f0 0f 00 00       	mov    $0xff0,%edx
+  800fc2:	4c 89 e6             	mov    %r12,%rsi
+  800fc5:	48 bf 10 60 80 00 00 	movabs $0x806010,%rdi
+  800fcc:	00 00 00 
+  800fcf:	41 ff d7             	call   *%r15
+        ssize_t res = fsipc(FSREQ_WRITE, NULL);
+  800fd2:	be 00 00 00 00       	mov    $0x0,%esi
+  800fd7:	bf 04 00 00 00       	mov    $0x4,%edi
+  800fdc:	48 b8 07 0e 80 00 00 	movabs $0x800e07,%rax
+  800fe3:	00 00 00 
+  800fe6:	ff d0                	call   *%rax
+  800fe8:	48 63 d0             	movslq %eax,%rdx
+        if (res < 0 || res < sizeof(fsipcbuf.write.req_buf))
+  800feb:	3d ef 0f 00 00       	cmp    $0xfef,%eax
+  800ff0:	7e 71                	jle    801063 <devfile_write+0xfa>
+        buf += sizeof(fsipcbuf.write.req_buf);
+  800ff2:	49 8d b4 24 f0 0f 00 	lea    0xff0(%r12),%rsi
+  800ff9:	00 
+        n -= sizeof(fsipcbuf.write.req_buf);
+  800ffa:	48 81 eb f0 0f 00 00 	sub    $0xff0,%rbx
+    while (n > sizeof(fsipcbuf.write.req_buf))
+  801001:	48 81 fb f0 0f 00 00 	cmp    $0xff0,%rbx
+  801008:	77 a0                	ja     800faa <devfile_write+0x41>
+        written += sizeof(fsipcbuf.write.req_buf);
+  80100a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80100e:	49 29 c4             	sub    %rax,%r12
+  801011:	4d 8d a4 24 f0 0f 00 	lea    0xff0(%r12),%r12
+  801018:	00 
+    fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801019:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  801020:	00 00 00 
+  801023:	41 8b 56 0c          	mov    0xc(%r14),%edx
+  801027:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.write.req_n      = n;
+  801029:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    memcpy(fsipcbuf.write.req_buf, buf, n);
+  80102d:	48 89 da             	mov    %rbx,%rdx
+  801030:	48 8d 78 10          	lea    0x10(%rax),%rdi
+  801034:	48 b8 05 29 80 00 00 	movabs $0x802905,%rax
+  80103b:	00 00 00 
+  80103e:	ff d0                	call   *%rax
+    ssize_t res = fsipc(FSREQ_WRITE, NULL);
+  801040:	be 00 00 00 00       	mov    $0x0,%esi
+  801045:	bf 04 00 00 00       	mov    $0x4,%edi
+  80104a:	48 b8 07 0e 80 00 00 	movabs $0x800e07,%rax
+  801051:	00 00 00 
+  801054:	ff d0                	call   *%rax
+  801056:	48 63 d0             	movslq %eax,%rdx
+    written += res;
+  801059:	49 01 d4             	add    %rdx,%r12
+  80105c:	48 85 d2             	test   %rdx,%rdx
+  80105f:	49 0f 49 d4          	cmovns %r12,%rdx
+}
+  801063:	48 89 d0             	mov    %rdx,%rax
+  801066:	48 83 c4 18          	add    $0x18,%rsp
+  80106a:	5b                   	pop    %rbx
+  80106b:	41 5c                	pop    %r12
+  80106d:	41 5d                	pop    %r13
+  80106f:	41 5e                	pop    %r14
+  801071:	41 5f                	pop    %r15
+  801073:	5d                   	pop    %rbp
+  801074:	c3                   	ret
+    while (n > sizeof(fsipcbuf.write.req_buf))
+  801075:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+    ssize_t written = 0;
+  801079:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80107f:	eb 98                	jmp    801019 <devfile_write+0xb0>
+
+0000000000801081 <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  801081:	55                   	push   %rbp
+  801082:	48 89 e5             	mov    %rsp,%rbp
+  801085:	41 57                	push   %r15
+  801087:	41 56                	push   %r14
+  801089:	41 55                	push   %r13
+  80108b:	41 54                	push   %r12
+  80108d:	53                   	push   %rbx
+  80108e:	48 83 ec 18          	sub    $0x18,%rsp
+  801092:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  801096:	49 89 f6             	mov    %rsi,%r14
+  801099:	49 89 d4             	mov    %rdx,%r12
+    while (n > sizeof(fsipcbuf.readRet.ret_buf))
+  80109c:	48 81 fa 00 10 00 00 	cmp    $0x1000,%rdx
+  8010a3:	0f 86 ea 00 00 00    	jbe    801193 <devfile_read+0x112>
+    ssize_t readsz = 0;
+  8010a9:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  8010b0:	00 
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8010b1:	49 bf 00 60 80 00 00 	movabs $0x806000,%r15
+  8010b8:	00 00 00 
+  8010bb:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8010bf:	8b 40 0c             	mov    0xc(%rax),%eax
+  8010c2:	41 89 07             	mov    %eax,(%r15)
+        fsipcbuf.read.req_n = sizeof(fsipcbuf.readRet.ret_buf);
+  8010c5:	49 c7 47 08 00 10 00 	movq   $0x1000,0x8(%r15)
+  8010cc:	00 
+        ssize_t res = fsipc(FSREQ_READ, NULL);
+  8010cd:	be 00 00 00 00       	mov    $0x0,%esi
+  8010d2:	bf 03 00 00 00       	mov    $0x3,%edi
+  8010d7:	48 b8 07 0e 80 00 00 	movabs $0x800e07,%rax
+  8010de:	00 00 00 
+  8010e1:	ff d0                	call   *%rax
+  8010e3:	4c 63 e8             	movslq %eax,%r13
+        if (res < 0)
+  8010e6:	4d 85 ed             	test   %r13,%r13
+  8010e9:	0f 88 92 00 00 00    	js     801181 <devfile_read+0x100>
+        memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  8010ef:	4c 89 ea             	mov    %r13,%rdx
+  8010f2:	4c 89 fe             	mov    %r15,%rsi
+  8010f5:	4c 89 f7             	mov    %r14,%rdi
+  8010f8:	48 b8 05 29 80 00 00 	movabs $0x802905,%rax
+  8010ff:	00 00 00 
+  801102:	ff d0                	call   *%rax
+        if (res < sizeof(fsipcbuf.readRet.ret_buf))
+  801104:	49 81 fd ff 0f 00 00 	cmp    $0xfff,%r13
+  80110b:	76 6d                	jbe    80117a <devfile_read+0xf9>
+        readsz += res;
+  80110d:	4c 01 6d c0          	add    %r13,-0x40(%rbp)
+        buf += res;
+  801111:	4d 01 ee             	add    %r13,%r14
+        n -= res;
+  801114:	4d 29 ec             	sub    %r13,%r12
+    while (n > sizeof(fsipcbuf.readRet.ret_buf))
+  801117:	49 81 fc 00 10 00 00 	cmp    $0x1000,%r12
+  80111e:	77 9b                	ja     8010bb <devfile_read+0x3a>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801120:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  801127:	00 00 00 
+  80112a:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  80112e:	8b 51 0c             	mov    0xc(%rcx),%edx
+  801131:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.read.req_n = n;
+  801133:	4c 89 60 08          	mov    %r12,0x8(%rax)
+    ssize_t res = fsipc(FSREQ_READ, NULL);
+  801137:	be 00 00 00 00       	mov    $0x0,%esi
+  80113c:	bf 03 00 00 00       	mov    $0x3,%edi
+  801141:	48 b8 07 0e 80 00 00 	movabs $0x800e07,%rax
+  801148:	00 00 00 
+  80114b:	ff d0                	call   *%rax
+  80114d:	4c 63 e8             	movslq %eax,%r13
+    if (res < 0)
+  801150:	4d 85 ed             	test   %r13,%r13
+  801153:	78 2c                	js     801181 <devfile_read+0x100>
+    memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  801155:	4c 89 ea             	mov    %r13,%rdx
+  801158:	48 be 00 60 80 00 00 	movabs $0x806000,%rsi
+  80115f:	00 00 00 
+  801162:	4c 89 f7             	mov    %r14,%rdi
+  801165:	48 b8 05 29 80 00 00 	movabs $0x802905,%rax
+  80116c:	00 00 00 
+  80116f:	ff d0                	call   *%rax
+    readsz += res;
+  801171:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  801175:	49 01 c5             	add    %rax,%r13
+    return readsz;
+  801178:	eb 07                	jmp    801181 <devfile_read+0x100>
+            return readsz + res;
+  80117a:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80117e:	49 01 c5             	add    %rax,%r13
+}
+  801181:	4c 89 e8             	mov    %r13,%rax
+  801184:	48 83 c4 18          	add    $0x18,%rsp
+  801188:	5b                   	pop    %rbx
+  801189:	41 5c                	pop    %r12
+  80118b:	41 5d                	pop    %r13
+  80118d:	41 5e                	pop    %r14
+  80118f:	41 5f                	pop    %r15
+  801191:	5d                   	pop    %rbp
+  801192:	c3                   	ret
+    ssize_t readsz = 0;
+  801193:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  80119a:	00 
+  80119b:	eb 83                	jmp    801120 <devfile_read+0x9f>
+
+000000000080119d <open>:
+open(const char *path, int mode) {
+  80119d:	55                   	push   %rbp
+  80119e:	48 89 e5             	mov    %rsp,%rbp
+  8011a1:	41 55                	push   %r13
+  8011a3:	41 54                	push   %r12
+  8011a5:	53                   	push   %rbx
+  8011a6:	48 83 ec 18          	sub    $0x18,%rsp
+  8011aa:	49 89 fc             	mov    %rdi,%r12
+  8011ad:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  8011b0:	48 b8 66 26 80 00 00 	movabs $0x802666,%rax
+  8011b7:	00 00 00 
+  8011ba:	ff d0                	call   *%rax
+  8011bc:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  8011c2:	0f 87 8a 00 00 00    	ja     801252 <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8011c8:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  8011cc:	48 b8 80 07 80 00 00 	movabs $0x800780,%rax
+  8011d3:	00 00 00 
+  8011d6:	ff d0                	call   *%rax
+  8011d8:	89 c3                	mov    %eax,%ebx
+  8011da:	85 c0                	test   %eax,%eax
+  8011dc:	78 50                	js     80122e <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  8011de:	4c 89 e6             	mov    %r12,%rsi
+  8011e1:	48 bb 00 60 80 00 00 	movabs $0x806000,%rbx
+  8011e8:	00 00 00 
+  8011eb:	48 89 df             	mov    %rbx,%rdi
+  8011ee:	48 b8 a4 26 80 00 00 	movabs $0x8026a4,%rax
+  8011f5:	00 00 00 
+  8011f8:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  8011fa:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801201:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  801205:	bf 01 00 00 00       	mov    $0x1,%edi
+  80120a:	48 b8 07 0e 80 00 00 	movabs $0x800e07,%rax
+  801211:	00 00 00 
+  801214:	ff d0                	call   *%rax
+  801216:	89 c3                	mov    %eax,%ebx
+  801218:	85 c0                	test   %eax,%eax
+  80121a:	78 1f                	js     80123b <open+0x9e>
+    return fd2num(fd);
+  80121c:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  801220:	48 b8 d9 06 80 00 00 	movabs $0x8006d9,%rax
+  801227:	00 00 00 
+  80122a:	ff d0                	call   *%rax
+  80122c:	89 c3                	mov    %eax,%ebx
+}
+  80122e:	89 d8                	mov    %ebx,%eax
+  801230:	48 83 c4 18          	add    $0x18,%rsp
+  801234:	5b                   	pop    %rbx
+  801235:	41 5c                	pop    %r12
+  801237:	41 5d                	pop    %r13
+  801239:	5d                   	pop    %rbp
+  80123a:	c3                   	ret
+        fd_close(fd, 0);
+  80123b:	be 00 00 00 00       	mov    $0x0,%esi
+  801240:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  801244:	48 b8 55 08 80 00 00 	movabs $0x800855,%rax
+  80124b:	00 00 00 
+  80124e:	ff d0                	call   *%rax
+        return res;
+  801250:	eb dc                	jmp    80122e <open+0x91>
+        return -E_BAD_PATH;
+  801252:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  801257:	eb d5                	jmp    80122e <open+0x91>
+
+0000000000801259 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  801259:	55                   	push   %rbp
+  80125a:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc(FSREQ_SYNC, NULL);
+  80125d:	be 00 00 00 00       	mov    $0x0,%esi
+  801262:	bf 08 00 00 00       	mov    $0x8,%edi
+  801267:	48 b8 07 0e 80 00 00 	movabs $0x800e07,%rax
+  80126e:	00 00 00 
+  801271:	ff d0                	call   *%rax
+}
+  801273:	5d                   	pop    %rbp
+  801274:	c3                   	ret
+
+0000000000801275 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  801275:	55                   	push   %rbp
+  801276:	48 89 e5             	mov    %rsp,%rbp
+  801279:	41 54                	push   %r12
+  80127b:	53                   	push   %rbx
+  80127c:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80127f:	48 b8 eb 06 80 00 00 	movabs $0x8006eb,%rax
+  801286:	00 00 00 
+  801289:	ff d0                	call   *%rax
+  80128b:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  80128e:	48 be 80 2d 80 00 00 	movabs $0x802d80,%rsi
+  801295:	00 00 00 
+  801298:	48 89 df             	mov    %rbx,%rdi
+  80129b:	48 b8 a4 26 80 00 00 	movabs $0x8026a4,%rax
+  8012a2:	00 00 00 
+  8012a5:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  8012a7:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  8012ac:	41 2b 04 24          	sub    (%r12),%eax
+  8012b0:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  8012b6:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8012bd:	00 00 00 
+    stat->st_dev = &devpipe;
+  8012c0:	48 b8 60 40 80 00 00 	movabs $0x804060,%rax
+  8012c7:	00 00 00 
+  8012ca:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  8012d1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012d6:	5b                   	pop    %rbx
+  8012d7:	41 5c                	pop    %r12
+  8012d9:	5d                   	pop    %rbp
+  8012da:	c3                   	ret
+
+00000000008012db <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  8012db:	55                   	push   %rbp
+  8012dc:	48 89 e5             	mov    %rsp,%rbp
+  8012df:	41 54                	push   %r12
+  8012e1:	53                   	push   %rbx
+  8012e2:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8012e5:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8012ea:	48 89 fe             	mov    %rdi,%rsi
+  8012ed:	bf 00 00 00 00       	mov    $0x0,%edi
+  8012f2:	49 bc 6a 03 80 00 00 	movabs $0x80036a,%r12
+  8012f9:	00 00 00 
+  8012fc:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  8012ff:	48 89 df             	mov    %rbx,%rdi
+  801302:	48 b8 eb 06 80 00 00 	movabs $0x8006eb,%rax
+  801309:	00 00 00 
+  80130c:	ff d0                	call   *%rax
+  80130e:	48 89 c6             	mov    %rax,%rsi
+  801311:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801316:	bf 00 00 00 00       	mov    $0x0,%edi
+  80131b:	41 ff d4             	call   *%r12
+}
+  80131e:	5b                   	pop    %rbx
+  80131f:	41 5c                	pop    %r12
+  801321:	5d                   	pop    %rbp
+  801322:	c3                   	ret
+
+0000000000801323 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  801323:	55                   	push   %rbp
+  801324:	48 89 e5             	mov    %rsp,%rbp
+  801327:	41 57                	push   %r15
+  801329:	41 56                	push   %r14
+  80132b:	41 55                	push   %r13
+  80132d:	41 54                	push   %r12
+  80132f:	53                   	push   %rbx
+  801330:	48 83 ec 18          	sub    $0x18,%rsp
+  801334:	49 89 fc             	mov    %rdi,%r12
+  801337:	49 89 f5             	mov    %rsi,%r13
+  80133a:	49 89 d7             	mov    %rdx,%r15
+  80133d:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  801341:	48 b8 eb 06 80 00 00 	movabs $0x8006eb,%rax
+  801348:	00 00 00 
+  80134b:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  80134d:	4d 85 ff             	test   %r15,%r15
+  801350:	0f 84 af 00 00 00    	je     801405 <devpipe_write+0xe2>
+  801356:	48 89 c3             	mov    %rax,%rbx
+  801359:	4c 89 f8             	mov    %r15,%rax
+  80135c:	4d 89 ef             	mov    %r13,%r15
+  80135f:	4c 01 e8             	add    %r13,%rax
+  801362:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  801366:	49 bd 72 02 80 00 00 	movabs $0x800272,%r13
+  80136d:	00 00 00 
+            sys_yield();
+  801370:	49 be 0f 02 80 00 00 	movabs $0x80020f,%r14
+  801377:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  80137a:	8b 73 04             	mov    0x4(%rbx),%esi
+  80137d:	48 63 ce             	movslq %esi,%rcx
+  801380:	48 63 03             	movslq (%rbx),%rax
+  801383:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  801389:	48 39 c1             	cmp    %rax,%rcx
+  80138c:	72 2e                	jb     8013bc <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80138e:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  801393:	48 89 da             	mov    %rbx,%rdx
+  801396:	be 00 10 00 00       	mov    $0x1000,%esi
+  80139b:	4c 89 e7             	mov    %r12,%rdi
+  80139e:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  8013a1:	85 c0                	test   %eax,%eax
+  8013a3:	74 66                	je     80140b <devpipe_write+0xe8>
+            sys_yield();
+  8013a5:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  8013a8:	8b 73 04             	mov    0x4(%rbx),%esi
+  8013ab:	48 63 ce             	movslq %esi,%rcx
+  8013ae:	48 63 03             	movslq (%rbx),%rax
+  8013b1:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  8013b7:	48 39 c1             	cmp    %rax,%rcx
+  8013ba:	73 d2                	jae    80138e <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8013bc:	41 0f b6 3f          	movzbl (%r15),%edi
+  8013c0:	48 89 ca             	mov    %rcx,%rdx
+  8013c3:	48 c1 ea 03          	shr    $0x3,%rdx
+  8013c7:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  8013ce:	08 10 20 
+  8013d1:	48 f7 e2             	mul    %rdx
+  8013d4:	48 c1 ea 06          	shr    $0x6,%rdx
+  8013d8:	48 89 d0             	mov    %rdx,%rax
+  8013db:	48 c1 e0 09          	shl    $0x9,%rax
+  8013df:	48 29 d0             	sub    %rdx,%rax
+  8013e2:	48 c1 e0 03          	shl    $0x3,%rax
+  8013e6:	48 29 c1             	sub    %rax,%rcx
+  8013e9:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  8013ee:	83 c6 01             	add    $0x1,%esi
+  8013f1:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8013f4:	49 83 c7 01          	add    $0x1,%r15
+  8013f8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8013fc:	49 39 c7             	cmp    %rax,%r15
+  8013ff:	0f 85 75 ff ff ff    	jne    80137a <devpipe_write+0x57>
+    return n;
+  801405:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  801409:	eb 05                	jmp    801410 <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  80140b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801410:	48 83 c4 18          	add    $0x18,%rsp
+  801414:	5b                   	pop    %rbx
+  801415:	41 5c                	pop    %r12
+  801417:	41 5d                	pop    %r13
+  801419:	41 5e                	pop    %r14
+  80141b:	41 5f                	pop    %r15
+  80141d:	5d                   	pop    %rbp
+  80141e:	c3                   	ret
+
+000000000080141f <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  80141f:	55                   	push   %rbp
+  801420:	48 89 e5             	mov    %rsp,%rbp
+  801423:	41 57                	push   %r15
+  801425:	41 56                	push   %r14
+  801427:	41 55                	push   %r13
+  801429:	41 54                	push   %r12
+  80142b:	53                   	push   %rbx
+  80142c:	48 83 ec 18          	sub    $0x18,%rsp
+  801430:	49 89 fc             	mov    %rdi,%r12
+  801433:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  801437:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80143b:	48 b8 eb 06 80 00 00 	movabs $0x8006eb,%rax
+  801442:	00 00 00 
+  801445:	ff d0                	call   *%rax
+  801447:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  80144a:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  801450:	49 bd 72 02 80 00 00 	movabs $0x800272,%r13
+  801457:	00 00 00 
+            sys_yield();
+  80145a:	49 be 0f 02 80 00 00 	movabs $0x80020f,%r14
+  801461:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  801464:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  801469:	74 7d                	je     8014e8 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  80146b:	8b 03                	mov    (%rbx),%eax
+  80146d:	3b 43 04             	cmp    0x4(%rbx),%eax
+  801470:	75 26                	jne    801498 <devpipe_read+0x79>
+            if (i > 0) return i;
+  801472:	4d 85 ff             	test   %r15,%r15
+  801475:	75 77                	jne    8014ee <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  801477:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80147c:	48 89 da             	mov    %rbx,%rdx
+  80147f:	be 00 10 00 00       	mov    $0x1000,%esi
+  801484:	4c 89 e7             	mov    %r12,%rdi
+  801487:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  80148a:	85 c0                	test   %eax,%eax
+  80148c:	74 72                	je     801500 <devpipe_read+0xe1>
+            sys_yield();
+  80148e:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  801491:	8b 03                	mov    (%rbx),%eax
+  801493:	3b 43 04             	cmp    0x4(%rbx),%eax
+  801496:	74 df                	je     801477 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  801498:	48 63 c8             	movslq %eax,%rcx
+  80149b:	48 89 ca             	mov    %rcx,%rdx
+  80149e:	48 c1 ea 03          	shr    $0x3,%rdx
+  8014a2:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  8014a9:	08 10 20 
+  8014ac:	48 89 d0             	mov    %rdx,%rax
+  8014af:	48 f7 e6             	mul    %rsi
+  8014b2:	48 c1 ea 06          	shr    $0x6,%rdx
+  8014b6:	48 89 d0             	mov    %rdx,%rax
+  8014b9:	48 c1 e0 09          	shl    $0x9,%rax
+  8014bd:	48 29 d0             	sub    %rdx,%rax
+  8014c0:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  8014c7:	00 
+  8014c8:	48 89 c8             	mov    %rcx,%rax
+  8014cb:	48 29 d0             	sub    %rdx,%rax
+  8014ce:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  8014d3:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8014d7:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  8014db:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8014de:	49 83 c7 01          	add    $0x1,%r15
+  8014e2:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  8014e6:	75 83                	jne    80146b <devpipe_read+0x4c>
+    return n;
+  8014e8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8014ec:	eb 03                	jmp    8014f1 <devpipe_read+0xd2>
+            if (i > 0) return i;
+  8014ee:	4c 89 f8             	mov    %r15,%rax
+}
+  8014f1:	48 83 c4 18          	add    $0x18,%rsp
+  8014f5:	5b                   	pop    %rbx
+  8014f6:	41 5c                	pop    %r12
+  8014f8:	41 5d                	pop    %r13
+  8014fa:	41 5e                	pop    %r14
+  8014fc:	41 5f                	pop    %r15
+  8014fe:	5d                   	pop    %rbp
+  8014ff:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  801500:	b8 00 00 00 00       	mov    $0x0,%eax
+  801505:	eb ea                	jmp    8014f1 <devpipe_read+0xd2>
+
+0000000000801507 <pipe>:
+pipe(int pfd[2]) {
+  801507:	55                   	push   %rbp
+  801508:	48 89 e5             	mov    %rsp,%rbp
+  80150b:	41 55                	push   %r13
+  80150d:	41 54                	push   %r12
+  80150f:	53                   	push   %rbx
+  801510:	48 81 ec b8 00 00 00 	sub    $0xb8,%rsp
+  801517:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  80151a:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  80151e:	48 b8 80 07 80 00 00 	movabs $0x800780,%rax
+  801525:	00 00 00 
+  801528:	ff d0                	call   *%rax
+  80152a:	89 c3                	mov    %eax,%ebx
+  80152c:	85 c0                	test   %eax,%eax
+  80152e:	0f 88 51 01 00 00    	js     801685 <pipe+0x17e>
+        (res = fd_alloc_from(fd2num(fd0) + 1, &fd1)) < 0) goto err;
+  801534:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  801538:	48 b8 d9 06 80 00 00 	movabs $0x8006d9,%rax
+  80153f:	00 00 00 
+  801542:	ff d0                	call   *%rax
+  801544:	8d 78 01             	lea    0x1(%rax),%edi
+  801547:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80154b:	48 b8 07 07 80 00 00 	movabs $0x800707,%rax
+  801552:	00 00 00 
+  801555:	ff d0                	call   *%rax
+  801557:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  801559:	85 c0                	test   %eax,%eax
+  80155b:	0f 88 24 01 00 00    	js     801685 <pipe+0x17e>
+    va = fd2data(fd0);
+  801561:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  801565:	48 bb eb 06 80 00 00 	movabs $0x8006eb,%rbx
+  80156c:	00 00 00 
+  80156f:	ff d3                	call   *%rbx
+  801571:	49 89 c5             	mov    %rax,%r13
+    struct RegionOp ops[] = {
+  801574:	48 8d bd 30 ff ff ff 	lea    -0xd0(%rbp),%rdi
+  80157b:	b9 14 00 00 00       	mov    $0x14,%ecx
+  801580:	b8 00 00 00 00       	mov    $0x0,%eax
+  801585:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+  801588:	c7 85 34 ff ff ff 46 	movl   $0x46,-0xcc(%rbp)
+  80158f:	00 00 00 
+  801592:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801596:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+  80159d:	48 c7 85 50 ff ff ff 	movq   $0x1000,-0xb0(%rbp)
+  8015a4:	00 10 00 00 
+  8015a8:	c7 85 5c ff ff ff 46 	movl   $0x46,-0xa4(%rbp)
+  8015af:	00 00 00 
+            {.type = REGION_ALLOC, .dstva = (uintptr_t)fd1, .size = PAGE_SIZE, .perm = PROT_RW | PROT_SHARE},
+  8015b2:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+    struct RegionOp ops[] = {
+  8015b6:	48 89 bd 70 ff ff ff 	mov    %rdi,-0x90(%rbp)
+  8015bd:	48 c7 85 78 ff ff ff 	movq   $0x1000,-0x88(%rbp)
+  8015c4:	00 10 00 00 
+  8015c8:	c7 45 84 46 00 00 00 	movl   $0x46,-0x7c(%rbp)
+  8015cf:	4c 89 6d 98          	mov    %r13,-0x68(%rbp)
+  8015d3:	48 c7 45 a0 00 10 00 	movq   $0x1000,-0x60(%rbp)
+  8015da:	00 
+  8015db:	c7 45 a8 01 00 00 00 	movl   $0x1,-0x58(%rbp)
+  8015e2:	c7 45 ac 46 00 00 00 	movl   $0x46,-0x54(%rbp)
+  8015e9:	4c 89 6d b8          	mov    %r13,-0x48(%rbp)
+            {.type = REGION_MAP, .srcva = (uintptr_t)va, .dstva = (uintptr_t)fd2data(fd1), .size = PAGE_SIZE, .perm = PROT_RW | PROT_SHARE},
+  8015ed:	ff d3                	call   *%rbx
+    struct RegionOp ops[] = {
+  8015ef:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8015f3:	48 c7 45 c8 00 10 00 	movq   $0x1000,-0x38(%rbp)
+  8015fa:	00 
+    if ((res = sys_region_batch(ops, sizeof ops / sizeof *ops)) < 0) goto err1;
+  8015fb:	be 04 00 00 00       	mov    $0x4,%esi
+  801600:	48 8d bd 30 ff ff ff 	lea    -0xd0(%rbp),%rdi
+  801607:	48 b8 d1 03 80 00 00 	movabs $0x8003d1,%rax
+  80160e:	00 00 00 
+  801611:	ff d0                	call   *%rax
+  801613:	89 c3                	mov    %eax,%ebx
+  801615:	85 c0                	test   %eax,%eax
+  801617:	0f 88 ad 00 00 00    	js     8016ca <pipe+0x1c3>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  80161d:	be 00 10 00 00       	mov    $0x1000,%esi
+  801622:	4c 89 ef             	mov    %r13,%rdi
+  801625:	48 b8 40 02 80 00 00 	movabs $0x800240,%rax
+  80162c:	00 00 00 
+  80162f:	ff d0                	call   *%rax
+  801631:	83 f8 02             	cmp    $0x2,%eax
+  801634:	75 5f                	jne    801695 <pipe+0x18e>
+    fd0->fd_dev_id = devpipe.dev_id;
+  801636:	a1 60 40 80 00 00 00 	movabs 0x804060,%eax
+  80163d:	00 00 
+  80163f:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801643:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  801645:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801649:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  801650:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  801654:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  801656:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80165a:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  801661:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  801665:	48 bb d9 06 80 00 00 	movabs $0x8006d9,%rbx
+  80166c:	00 00 00 
+  80166f:	ff d3                	call   *%rbx
+  801671:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  801675:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  801679:	ff d3                	call   *%rbx
+  80167b:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  801680:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  801685:	89 d8                	mov    %ebx,%eax
+  801687:	48 81 c4 b8 00 00 00 	add    $0xb8,%rsp
+  80168e:	5b                   	pop    %rbx
+  80168f:	41 5c                	pop    %r12
+  801691:	41 5d                	pop    %r13
+  801693:	5d                   	pop    %rbp
+  801694:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  801695:	48 b9 b0 2d 80 00 00 	movabs $0x802db0,%rcx
+  80169c:	00 00 00 
+  80169f:	48 ba 87 2d 80 00 00 	movabs $0x802d87,%rdx
+  8016a6:	00 00 00 
+  8016a9:	be 33 00 00 00       	mov    $0x33,%esi
+  8016ae:	48 bf 9c 2d 80 00 00 	movabs $0x802d9c,%rdi
+  8016b5:	00 00 00 
+  8016b8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016bd:	49 b8 2f 1c 80 00 00 	movabs $0x801c2f,%r8
+  8016c4:	00 00 00 
+  8016c7:	41 ff d0             	call   *%r8
+        ops[i].type = REGION_UNMAP;
+  8016ca:	c7 85 30 ff ff ff 02 	movl   $0x2,-0xd0(%rbp)
+  8016d1:	00 00 00 
+  8016d4:	c7 85 58 ff ff ff 02 	movl   $0x2,-0xa8(%rbp)
+  8016db:	00 00 00 
+  8016de:	c7 45 80 02 00 00 00 	movl   $0x2,-0x80(%rbp)
+  8016e5:	c7 45 a8 02 00 00 00 	movl   $0x2,-0x58(%rbp)
+    sys_region_batch(ops, sizeof ops / sizeof *ops);
+  8016ec:	be 04 00 00 00       	mov    $0x4,%esi
+  8016f1:	48 8d bd 30 ff ff ff 	lea    -0xd0(%rbp),%rdi
+  8016f8:	48 b8 d1 03 80 00 00 	movabs $0x8003d1,%rax
+  8016ff:	00 00 00 
+  801702:	ff d0                	call   *%rax
+  801704:	e9 7c ff ff ff       	jmp    801685 <pipe+0x17e>
+
+0000000000801709 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  801709:	55                   	push   %rbp
+  80170a:	48 89 e5             	mov    %rsp,%rbp
+  80170d:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  801711:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801715:	48 b8 9a 07 80 00 00 	movabs $0x80079a,%rax
+  80171c:	00 00 00 
+  80171f:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801721:	85 c0                	test   %eax,%eax
+  801723:	78 35                	js     80175a <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  801725:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801729:	48 b8 eb 06 80 00 00 	movabs $0x8006eb,%rax
+  801730:	00 00 00 
+  801733:	ff d0                	call   *%rax
+  801735:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  801738:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80173d:	be 00 10 00 00       	mov    $0x1000,%esi
+  801742:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801746:	48 b8 72 02 80 00 00 	movabs $0x800272,%rax
+  80174d:	00 00 00 
+  801750:	ff d0                	call   *%rax
+  801752:	85 c0                	test   %eax,%eax
+  801754:	0f 94 c0             	sete   %al
+  801757:	0f b6 c0             	movzbl %al,%eax
+}
+  80175a:	c9                   	leave
+  80175b:	c3                   	ret
+
+000000000080175c <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  80175c:	48 89 f8             	mov    %rdi,%rax
+  80175f:	48 c1 e8 27          	shr    $0x27,%rax
+  801763:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  80176a:	01 00 00 
+  80176d:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  801771:	f6 c2 01             	test   $0x1,%dl
+  801774:	74 6d                	je     8017e3 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  801776:	48 89 f8             	mov    %rdi,%rax
+  801779:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80177d:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  801784:	01 00 00 
+  801787:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80178b:	f6 c2 01             	test   $0x1,%dl
+  80178e:	74 62                	je     8017f2 <get_uvpt_entry+0x96>
+  801790:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  801797:	01 00 00 
+  80179a:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80179e:	f6 c2 80             	test   $0x80,%dl
+  8017a1:	75 4f                	jne    8017f2 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8017a3:	48 89 f8             	mov    %rdi,%rax
+  8017a6:	48 c1 e8 15          	shr    $0x15,%rax
+  8017aa:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8017b1:	01 00 00 
+  8017b4:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8017b8:	f6 c2 01             	test   $0x1,%dl
+  8017bb:	74 44                	je     801801 <get_uvpt_entry+0xa5>
+  8017bd:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8017c4:	01 00 00 
+  8017c7:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8017cb:	f6 c2 80             	test   $0x80,%dl
+  8017ce:	75 31                	jne    801801 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  8017d0:	48 c1 ef 0c          	shr    $0xc,%rdi
+  8017d4:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8017db:	01 00 00 
+  8017de:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  8017e2:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8017e3:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  8017ea:	01 00 00 
+  8017ed:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8017f1:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8017f2:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8017f9:	01 00 00 
+  8017fc:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  801800:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  801801:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  801808:	01 00 00 
+  80180b:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80180f:	c3                   	ret
+
+0000000000801810 <get_prot>:
+
+int
+get_prot(void *va) {
+  801810:	55                   	push   %rbp
+  801811:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  801814:	48 b8 5c 17 80 00 00 	movabs $0x80175c,%rax
+  80181b:	00 00 00 
+  80181e:	ff d0                	call   *%rax
+  801820:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  801823:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  801828:	89 c1                	mov    %eax,%ecx
+  80182a:	83 c9 04             	or     $0x4,%ecx
+  80182d:	f6 c2 01             	test   $0x1,%dl
+  801830:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  801833:	89 c1                	mov    %eax,%ecx
+  801835:	83 c9 02             	or     $0x2,%ecx
+  801838:	f6 c2 02             	test   $0x2,%dl
+  80183b:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  80183e:	89 c1                	mov    %eax,%ecx
+  801840:	83 c9 01             	or     $0x1,%ecx
+  801843:	48 85 d2             	test   %rdx,%rdx
+  801846:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  801849:	89 c1                	mov    %eax,%ecx
+  80184b:	83 c9 40             	or     $0x40,%ecx
+  80184e:	f6 c6 04             	test   $0x4,%dh
+  801851:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  801854:	5d                   	pop    %rbp
+  801855:	c3                   	ret
+
+0000000000801856 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  801856:	55                   	push   %rbp
+  801857:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  80185a:	48 b8 5c 17 80 00 00 	movabs $0x80175c,%rax
+  801861:	00 00 00 
+  801864:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  801866:	48 c1 e8 06          	shr    $0x6,%rax
+  80186a:	83 e0 01             	and    $0x1,%eax
+}
+  80186d:	5d                   	pop    %rbp
+  80186e:	c3                   	ret
+
+000000000080186f <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  80186f:	55                   	push   %rbp
+  801870:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  801873:	48 b8 5c 17 80 00 00 	movabs $0x80175c,%rax
+  80187a:	00 00 00 
+  80187d:	ff d0                	call   *%rax
+  80187f:	83 e0 01             	and    $0x1,%eax
+}
+  801882:	5d                   	pop    %rbp
+  801883:	c3                   	ret
+
+0000000000801884 <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  801884:	55                   	push   %rbp
+  801885:	48 89 e5             	mov    %rsp,%rbp
+  801888:	41 57                	push   %r15
+  80188a:	41 56                	push   %r14
+  80188c:	41 55                	push   %r13
+  80188e:	41 54                	push   %r12
+  801890:	53                   	push   %rbx
+  801891:	48 83 ec 38          	sub    $0x38,%rsp
+  801895:	49 89 f7             	mov    %rsi,%r15
+  801898:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+                    }
+                    continue;
+                }
+                for (int ptei = 0; ptei < PT_ENTRY_COUNT; ptei++) {
+                    uintptr_t pte_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, pdei, ptei, 0);
+                    pte_t pte = uvpt[VPT(pte_addr)];
+  80189e:	49 bd 00 00 00 00 00 	movabs $0x10000000000,%r13
+  8018a5:	01 00 00 
+  8018a8:	4d 89 e6             	mov    %r12,%r14
+  8018ab:	49 89 fc             	mov    %rdi,%r12
+  8018ae:	e9 19 01 00 00       	jmp    8019cc <foreach_shared_region+0x148>
+  8018b3:	48 89 5d b0          	mov    %rbx,-0x50(%rbp)
+  8018b7:	4c 89 75 a8          	mov    %r14,-0x58(%rbp)
+  8018bb:	eb 52                	jmp    80190f <foreach_shared_region+0x8b>
+                for (int ptei = 0; ptei < PT_ENTRY_COUNT; ptei++) {
+  8018bd:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8018c4:	48 81 fb 00 00 20 00 	cmp    $0x200000,%rbx
+  8018cb:	74 2e                	je     8018fb <foreach_shared_region+0x77>
+                    uintptr_t pte_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, pdei, ptei, 0);
+  8018cd:	48 89 df             	mov    %rbx,%rdi
+  8018d0:	4c 09 f7             	or     %r14,%rdi
+                    pte_t pte = uvpt[VPT(pte_addr)];
+  8018d3:	48 89 f8             	mov    %rdi,%rax
+  8018d6:	48 c1 e8 0c          	shr    $0xc,%rax
+  8018da:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+                    if ((pte & PTE_P) && (pte & PTE_SHARE)) {
+  8018df:	25 01 04 00 00       	and    $0x401,%eax
+  8018e4:	48 3d 01 04 00 00    	cmp    $0x401,%rax
+  8018ea:	75 d1                	jne    8018bd <foreach_shared_region+0x39>
+                        fun((void*)pte_addr, (void*)(pte_addr + PAGE_SIZE), arg);
+  8018ec:	48 8d b7 00 10 00 00 	lea    0x1000(%rdi),%rsi
+  8018f3:	4c 89 fa             	mov    %r15,%rdx
+  8018f6:	41 ff d4             	call   *%r12
+  8018f9:	eb c2                	jmp    8018bd <foreach_shared_region+0x39>
+            for (int pdei = 0; pdei < PD_ENTRY_COUNT; pdei++) {
+  8018fb:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  801902:	00 
+  801903:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801907:	48 3d 00 00 00 40    	cmp    $0x40000000,%rax
+  80190d:	74 46                	je     801955 <foreach_shared_region+0xd1>
+                uintptr_t pde_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, pdei, 0, 0);
+  80190f:	4c 8b 75 c8          	mov    -0x38(%rbp),%r14
+  801913:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  801917:	49 09 c6             	or     %rax,%r14
+                pde_t pde = uvpd[VPD(pde_addr)];
+  80191a:	4c 89 f0             	mov    %r14,%rax
+  80191d:	48 c1 e8 15          	shr    $0x15,%rax
+  801921:	48 b9 00 00 00 80 00 	movabs $0x10080000000,%rcx
+  801928:	01 00 00 
+  80192b:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+                if (!(pde & PTE_P)) {
+  80192f:	a8 01                	test   $0x1,%al
+  801931:	74 c8                	je     8018fb <foreach_shared_region+0x77>
+                if (pde & PTE_PS) {
+  801933:	48 89 c3             	mov    %rax,%rbx
+  801936:	81 e3 80 00 00 00    	and    $0x80,%ebx
+  80193c:	74 8f                	je     8018cd <foreach_shared_region+0x49>
+                    if (pde & PTE_SHARE) {
+  80193e:	f6 c4 04             	test   $0x4,%ah
+  801941:	74 b8                	je     8018fb <foreach_shared_region+0x77>
+                        fun((void*)pde_addr, (void*)(pde_addr + 1024 * 1024 * 2), arg);
+  801943:	49 8d b6 00 00 20 00 	lea    0x200000(%r14),%rsi
+  80194a:	4c 89 fa             	mov    %r15,%rdx
+  80194d:	4c 89 f7             	mov    %r14,%rdi
+  801950:	41 ff d4             	call   *%r12
+  801953:	eb a6                	jmp    8018fb <foreach_shared_region+0x77>
+  801955:	48 8b 5d b0          	mov    -0x50(%rbp),%rbx
+  801959:	4c 8b 75 a8          	mov    -0x58(%rbp),%r14
+        for (int pdpei = 0; pdpei < PDP_ENTRY_COUNT; pdpei++) {
+  80195d:	48 81 c3 00 00 00 40 	add    $0x40000000,%rbx
+  801964:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80196b:	00 00 00 
+  80196e:	48 39 c3             	cmp    %rax,%rbx
+  801971:	74 4c                	je     8019bf <foreach_shared_region+0x13b>
+            uintptr_t pdpe_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, 0, 0, 0);
+  801973:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  801977:	48 09 d8             	or     %rbx,%rax
+  80197a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+            pdpe_t pdpe = uvpdp[VPDP(pdpe_addr)];
+  80197e:	48 c1 e8 1e          	shr    $0x1e,%rax
+  801982:	48 b9 00 00 40 80 00 	movabs $0x10080400000,%rcx
+  801989:	01 00 00 
+  80198c:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+            if (!(pdpe & PTE_P)) {
+  801990:	a8 01                	test   $0x1,%al
+  801992:	74 c9                	je     80195d <foreach_shared_region+0xd9>
+            if (pdpe & PTE_PS) {
+  801994:	48 89 c1             	mov    %rax,%rcx
+  801997:	81 e1 80 00 00 00    	and    $0x80,%ecx
+  80199d:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  8019a1:	0f 84 0c ff ff ff    	je     8018b3 <foreach_shared_region+0x2f>
+                if (pdpe & PTE_SHARE) {
+  8019a7:	f6 c4 04             	test   $0x4,%ah
+  8019aa:	74 b1                	je     80195d <foreach_shared_region+0xd9>
+                    fun((void*)pdpe_addr, (void*)(pdpe_addr + 1024 * 1024 * 1024), arg); 
+  8019ac:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  8019b0:	48 8d b7 00 00 00 40 	lea    0x40000000(%rdi),%rsi
+  8019b7:	4c 89 fa             	mov    %r15,%rdx
+  8019ba:	41 ff d4             	call   *%r12
+  8019bd:	eb 9e                	jmp    80195d <foreach_shared_region+0xd9>
+    for (int pml4ei = 0; pml4ei < PML4_ENTRY_COUNT; pml4ei++) {
+  8019bf:	49 83 c6 01          	add    $0x1,%r14
+  8019c3:	49 81 fe 00 02 00 00 	cmp    $0x200,%r14
+  8019ca:	74 24                	je     8019f0 <foreach_shared_region+0x16c>
+        pml4e_t pml4e = uvpml4[VPML4(pml4_addr)];
+  8019cc:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  8019d3:	01 00 00 
+  8019d6:	4a 8b 04 f0          	mov    (%rax,%r14,8),%rax
+        if (!(pml4e & PTE_P)) {
+  8019da:	a8 01                	test   $0x1,%al
+  8019dc:	74 e1                	je     8019bf <foreach_shared_region+0x13b>
+  8019de:	4c 89 f0             	mov    %r14,%rax
+  8019e1:	48 c1 e0 27          	shl    $0x27,%rax
+  8019e5:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8019e9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8019ee:	eb 83                	jmp    801973 <foreach_shared_region+0xef>
+            }
+        }
+    }
+    
+    return 0;
+}
+  8019f0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019f5:	48 83 c4 38          	add    $0x38,%rsp
+  8019f9:	5b                   	pop    %rbx
+  8019fa:	41 5c                	pop    %r12
+  8019fc:	41 5d                	pop    %r13
+  8019fe:	41 5e                	pop    %r14
+  801a00:	41 5f                	pop    %r15
+  801a02:	5d                   	pop    %rbp
+  801a03:	c3                   	ret
+
+0000000000801a04 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  801a04:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a09:	c3                   	ret
+
+0000000000801a0a <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  801a0a:	55                   	push   %rbp
+  801a0b:	48 89 e5             	mov    %rsp,%rbp
+  801a0e:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  801a11:	48 be d4 2d 80 00 00 	movabs $0x802dd4,%rsi
+  801a18:	00 00 00 
+  801a1b:	48 b8 a4 26 80 00 00 	movabs $0x8026a4,%rax
+  801a22:	00 00 00 
+  801a25:	ff d0                	call   *%rax
+    return 0;
+}
+  801a27:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a2c:	5d                   	pop    %rbp
+  801a2d:	c3                   	ret
+
+0000000000801a2e <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  801a2e:	55                   	push   %rbp
+  801a2f:	48 89 e5             	mov    %rsp,%rbp
+  801a32:	41 57                	push   %r15
+  801a34:	41 56                	push   %r14
+  801a36:	41 55                	push   %r13
+  801a38:	41 54                	push   %r12
+  801a3a:	53                   	push   %rbx
+  801a3b:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  801a42:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  801a49:	48 85 d2             	test   %rdx,%rdx
+  801a4c:	74 7a                	je     801ac8 <devcons_write+0x9a>
+  801a4e:	49 89 d6             	mov    %rdx,%r14
+  801a51:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  801a57:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  801a5c:	49 bf 9e 28 80 00 00 	movabs $0x80289e,%r15
+  801a63:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  801a66:	4c 89 f3             	mov    %r14,%rbx
+  801a69:	48 29 f3             	sub    %rsi,%rbx
+  801a6c:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  801a71:	48 39 c3             	cmp    %rax,%rbx
+  801a74:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  801a78:	4c 63 eb             	movslq %ebx,%r13
+  801a7b:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  801a82:	48 01 c6             	add    %rax,%rsi
+  801a85:	4c 89 ea             	mov    %r13,%rdx
+  801a88:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  801a8f:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  801a92:	4c 89 ee             	mov    %r13,%rsi
+  801a95:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  801a9c:	48 b8 15 01 80 00 00 	movabs $0x800115,%rax
+  801aa3:	00 00 00 
+  801aa6:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  801aa8:	41 01 dc             	add    %ebx,%r12d
+  801aab:	49 63 f4             	movslq %r12d,%rsi
+  801aae:	4c 39 f6             	cmp    %r14,%rsi
+  801ab1:	72 b3                	jb     801a66 <devcons_write+0x38>
+    return res;
+  801ab3:	49 63 c4             	movslq %r12d,%rax
+}
+  801ab6:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  801abd:	5b                   	pop    %rbx
+  801abe:	41 5c                	pop    %r12
+  801ac0:	41 5d                	pop    %r13
+  801ac2:	41 5e                	pop    %r14
+  801ac4:	41 5f                	pop    %r15
+  801ac6:	5d                   	pop    %rbp
+  801ac7:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  801ac8:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  801ace:	eb e3                	jmp    801ab3 <devcons_write+0x85>
+
+0000000000801ad0 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  801ad0:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  801ad3:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ad8:	48 85 c0             	test   %rax,%rax
+  801adb:	74 55                	je     801b32 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  801add:	55                   	push   %rbp
+  801ade:	48 89 e5             	mov    %rsp,%rbp
+  801ae1:	41 55                	push   %r13
+  801ae3:	41 54                	push   %r12
+  801ae5:	53                   	push   %rbx
+  801ae6:	48 83 ec 08          	sub    $0x8,%rsp
+  801aea:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  801aed:	48 bb 42 01 80 00 00 	movabs $0x800142,%rbx
+  801af4:	00 00 00 
+  801af7:	49 bc 0f 02 80 00 00 	movabs $0x80020f,%r12
+  801afe:	00 00 00 
+  801b01:	eb 03                	jmp    801b06 <devcons_read+0x36>
+  801b03:	41 ff d4             	call   *%r12
+  801b06:	ff d3                	call   *%rbx
+  801b08:	85 c0                	test   %eax,%eax
+  801b0a:	74 f7                	je     801b03 <devcons_read+0x33>
+    if (c < 0) return c;
+  801b0c:	48 63 d0             	movslq %eax,%rdx
+  801b0f:	78 13                	js     801b24 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  801b11:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b16:	83 f8 04             	cmp    $0x4,%eax
+  801b19:	74 09                	je     801b24 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  801b1b:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  801b1f:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  801b24:	48 89 d0             	mov    %rdx,%rax
+  801b27:	48 83 c4 08          	add    $0x8,%rsp
+  801b2b:	5b                   	pop    %rbx
+  801b2c:	41 5c                	pop    %r12
+  801b2e:	41 5d                	pop    %r13
+  801b30:	5d                   	pop    %rbp
+  801b31:	c3                   	ret
+  801b32:	48 89 d0             	mov    %rdx,%rax
+  801b35:	c3                   	ret
+
+0000000000801b36 <cputchar>:
+cputchar(int ch) {
+  801b36:	55                   	push   %rbp
+  801b37:	48 89 e5             	mov    %rsp,%rbp
+  801b3a:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  801b3e:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  801b42:	be 01 00 00 00       	mov    $0x1,%esi
+  801b47:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  801b4b:	48 b8 15 01 80 00 00 	movabs $0x800115,%rax
+  801b52:	00 00 00 
+  801b55:	ff d0                	call   *%rax
+}
+  801b57:	c9                   	leave
+  801b58:	c3                   	ret
+
+0000000000801b59 <getchar>:
+getchar(void) {
+  801b59:	55                   	push   %rbp
+  801b5a:	48 89 e5             	mov    %rsp,%rbp
+  801b5d:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  801b61:	ba 01 00 00 00       	mov    $0x1,%edx
+  801b66:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  801b6a:	bf 00 00 00 00       	mov    $0x0,%edi
+  801b6f:	48 b8 7d 0a 80 00 00 	movabs $0x800a7d,%rax
+  801b76:	00 00 00 
+  801b79:	ff d0                	call   *%rax
+  801b7b:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  801b7d:	85 c0                	test   %eax,%eax
+  801b7f:	78 06                	js     801b87 <getchar+0x2e>
+  801b81:	74 08                	je     801b8b <getchar+0x32>
+  801b83:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  801b87:	89 d0                	mov    %edx,%eax
+  801b89:	c9                   	leave
+  801b8a:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  801b8b:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  801b90:	eb f5                	jmp    801b87 <getchar+0x2e>
+
+0000000000801b92 <iscons>:
+iscons(int fdnum) {
+  801b92:	55                   	push   %rbp
+  801b93:	48 89 e5             	mov    %rsp,%rbp
+  801b96:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  801b9a:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801b9e:	48 b8 9a 07 80 00 00 	movabs $0x80079a,%rax
+  801ba5:	00 00 00 
+  801ba8:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801baa:	85 c0                	test   %eax,%eax
+  801bac:	78 18                	js     801bc6 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  801bae:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801bb2:	48 b8 a0 40 80 00 00 	movabs $0x8040a0,%rax
+  801bb9:	00 00 00 
+  801bbc:	8b 00                	mov    (%rax),%eax
+  801bbe:	39 02                	cmp    %eax,(%rdx)
+  801bc0:	0f 94 c0             	sete   %al
+  801bc3:	0f b6 c0             	movzbl %al,%eax
+}
+  801bc6:	c9                   	leave
+  801bc7:	c3                   	ret
+
+0000000000801bc8 <opencons>:
+opencons(void) {
+  801bc8:	55                   	push   %rbp
+  801bc9:	48 89 e5             	mov    %rsp,%rbp
+  801bcc:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  801bd0:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  801bd4:	48 b8 80 07 80 00 00 	movabs $0x800780,%rax
+  801bdb:	00 00 00 
+  801bde:	ff d0                	call   *%rax
+  801be0:	85 c0                	test   %eax,%eax
+  801be2:	78 49                	js     801c2d <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  801be4:	b9 46 00 00 00       	mov    $0x46,%ecx
+  801be9:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801bee:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  801bf2:	bf 00 00 00 00       	mov    $0x0,%edi
+  801bf7:	48 b8 9e 02 80 00 00 	movabs $0x80029e,%rax
+  801bfe:	00 00 00 
+  801c01:	ff d0                	call   *%rax
+  801c03:	85 c0                	test   %eax,%eax
+  801c05:	78 26                	js     801c2d <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  801c07:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801c0b:	a1 a0 40 80 00 00 00 	movabs 0x8040a0,%eax
+  801c12:	00 00 
+  801c14:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  801c16:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801c1a:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  801c21:	48 b8 d9 06 80 00 00 	movabs $0x8006d9,%rax
+  801c28:	00 00 00 
+  801c2b:	ff d0                	call   *%rax
+}
+  801c2d:	c9                   	leave
+  801c2e:	c3                   	ret
+
+0000000000801c2f <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  801c2f:	55                   	push   %rbp
+  801c30:	48 89 e5             	mov    %rsp,%rbp
+  801c33:	41 56                	push   %r14
+  801c35:	41 55                	push   %r13
+  801c37:	41 54                	push   %r12
+  801c39:	53                   	push   %rbx
+  801c3a:	48 83 ec 50          	sub    $0x50,%rsp
+  801c3e:	49 89 fc             	mov    %rdi,%r12
+  801c41:	41 89 f5             	mov    %esi,%r13d
+  801c44:	48 89 d3             	mov    %rdx,%rbx
+  801c47:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  801c4b:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  801c4f:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  801c53:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  801c5a:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801c5e:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  801c62:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  801c66:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  801c6a:	48 b8 08 40 80 00 00 	movabs $0x804008,%rax
+  801c71:	00 00 00 
+  801c74:	4c 8b 30             	mov    (%rax),%r14
+  801c77:	48 b8 de 01 80 00 00 	movabs $0x8001de,%rax
+  801c7e:	00 00 00 
+  801c81:	ff d0                	call   *%rax
+  801c83:	89 c6                	mov    %eax,%esi
+  801c85:	45 89 e8             	mov    %r13d,%r8d
+  801c88:	4c 89 e1             	mov    %r12,%rcx
+  801c8b:	4c 89 f2             	mov    %r14,%rdx
+  801c8e:	48 bf e0 2d 80 00 00 	movabs $0x802de0,%rdi
+  801c95:	00 00 00 
+  801c98:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c9d:	49 bc 7f 1d 80 00 00 	movabs $0x801d7f,%r12
+  801ca4:	00 00 00 
+  801ca7:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  801caa:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  801cae:	48 89 df             	mov    %rbx,%rdi
+  801cb1:	48 b8 1b 1d 80 00 00 	movabs $0x801d1b,%rax
+  801cb8:	00 00 00 
+  801cbb:	ff d0                	call   *%rax
+    cprintf("\n");
+  801cbd:	48 bf a4 2c 80 00 00 	movabs $0x802ca4,%rdi
+  801cc4:	00 00 00 
+  801cc7:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ccc:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  801ccf:	cc                   	int3
+  801cd0:	eb fd                	jmp    801ccf <_panic+0xa0>
+
+0000000000801cd2 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  801cd2:	55                   	push   %rbp
+  801cd3:	48 89 e5             	mov    %rsp,%rbp
+  801cd6:	53                   	push   %rbx
+  801cd7:	48 83 ec 08          	sub    $0x8,%rsp
+  801cdb:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  801cde:	8b 06                	mov    (%rsi),%eax
+  801ce0:	8d 50 01             	lea    0x1(%rax),%edx
+  801ce3:	89 16                	mov    %edx,(%rsi)
+  801ce5:	48 98                	cltq
+  801ce7:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  801cec:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  801cf2:	74 0a                	je     801cfe <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  801cf4:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  801cf8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801cfc:	c9                   	leave
+  801cfd:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  801cfe:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  801d02:	be ff 00 00 00       	mov    $0xff,%esi
+  801d07:	48 b8 15 01 80 00 00 	movabs $0x800115,%rax
+  801d0e:	00 00 00 
+  801d11:	ff d0                	call   *%rax
+        state->offset = 0;
+  801d13:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  801d19:	eb d9                	jmp    801cf4 <putch+0x22>
+
+0000000000801d1b <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  801d1b:	55                   	push   %rbp
+  801d1c:	48 89 e5             	mov    %rsp,%rbp
+  801d1f:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  801d26:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  801d29:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  801d30:	b9 21 00 00 00       	mov    $0x21,%ecx
+  801d35:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d3a:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  801d3d:	48 89 f1             	mov    %rsi,%rcx
+  801d40:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  801d47:	48 bf d2 1c 80 00 00 	movabs $0x801cd2,%rdi
+  801d4e:	00 00 00 
+  801d51:	48 b8 cf 1e 80 00 00 	movabs $0x801ecf,%rax
+  801d58:	00 00 00 
+  801d5b:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  801d5d:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  801d64:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  801d6b:	48 b8 15 01 80 00 00 	movabs $0x800115,%rax
+  801d72:	00 00 00 
+  801d75:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  801d77:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  801d7d:	c9                   	leave
+  801d7e:	c3                   	ret
+
+0000000000801d7f <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  801d7f:	55                   	push   %rbp
+  801d80:	48 89 e5             	mov    %rsp,%rbp
+  801d83:	48 83 ec 50          	sub    $0x50,%rsp
+  801d87:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  801d8b:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  801d8f:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801d93:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  801d97:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  801d9b:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  801da2:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801da6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801daa:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  801dae:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  801db2:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  801db6:	48 b8 1b 1d 80 00 00 	movabs $0x801d1b,%rax
+  801dbd:	00 00 00 
+  801dc0:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  801dc2:	c9                   	leave
+  801dc3:	c3                   	ret
+
+0000000000801dc4 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  801dc4:	55                   	push   %rbp
+  801dc5:	48 89 e5             	mov    %rsp,%rbp
+  801dc8:	41 57                	push   %r15
+  801dca:	41 56                	push   %r14
+  801dcc:	41 55                	push   %r13
+  801dce:	41 54                	push   %r12
+  801dd0:	53                   	push   %rbx
+  801dd1:	48 83 ec 18          	sub    $0x18,%rsp
+  801dd5:	49 89 fc             	mov    %rdi,%r12
+  801dd8:	49 89 f5             	mov    %rsi,%r13
+  801ddb:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801ddf:	8b 45 10             	mov    0x10(%rbp),%eax
+  801de2:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  801de5:	41 89 cf             	mov    %ecx,%r15d
+  801de8:	4c 39 fa             	cmp    %r15,%rdx
+  801deb:	73 5b                	jae    801e48 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  801ded:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  801df1:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  801df5:	85 db                	test   %ebx,%ebx
+  801df7:	7e 0e                	jle    801e07 <print_num+0x43>
+            putch(padc, put_arg);
+  801df9:	4c 89 ee             	mov    %r13,%rsi
+  801dfc:	44 89 f7             	mov    %r14d,%edi
+  801dff:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  801e02:	83 eb 01             	sub    $0x1,%ebx
+  801e05:	75 f2                	jne    801df9 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  801e07:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  801e0b:	48 b9 14 2e 80 00 00 	movabs $0x802e14,%rcx
+  801e12:	00 00 00 
+  801e15:	48 b8 03 2e 80 00 00 	movabs $0x802e03,%rax
+  801e1c:	00 00 00 
+  801e1f:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  801e23:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801e27:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e2c:	49 f7 f7             	div    %r15
+  801e2f:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  801e33:	4c 89 ee             	mov    %r13,%rsi
+  801e36:	41 ff d4             	call   *%r12
+}
+  801e39:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  801e3d:	5b                   	pop    %rbx
+  801e3e:	41 5c                	pop    %r12
+  801e40:	41 5d                	pop    %r13
+  801e42:	41 5e                	pop    %r14
+  801e44:	41 5f                	pop    %r15
+  801e46:	5d                   	pop    %rbp
+  801e47:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  801e48:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801e4c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e51:	49 f7 f7             	div    %r15
+  801e54:	48 83 ec 08          	sub    $0x8,%rsp
+  801e58:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  801e5c:	52                   	push   %rdx
+  801e5d:	45 0f be c9          	movsbl %r9b,%r9d
+  801e61:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  801e65:	48 89 c2             	mov    %rax,%rdx
+  801e68:	48 b8 c4 1d 80 00 00 	movabs $0x801dc4,%rax
+  801e6f:	00 00 00 
+  801e72:	ff d0                	call   *%rax
+  801e74:	48 83 c4 10          	add    $0x10,%rsp
+  801e78:	eb 8d                	jmp    801e07 <print_num+0x43>
+
+0000000000801e7a <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  801e7a:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  801e7e:	48 8b 06             	mov    (%rsi),%rax
+  801e81:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  801e85:	73 0a                	jae    801e91 <sprintputch+0x17>
+        *state->start++ = ch;
+  801e87:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801e8b:	48 89 16             	mov    %rdx,(%rsi)
+  801e8e:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  801e91:	c3                   	ret
+
+0000000000801e92 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  801e92:	55                   	push   %rbp
+  801e93:	48 89 e5             	mov    %rsp,%rbp
+  801e96:	48 83 ec 50          	sub    $0x50,%rsp
+  801e9a:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801e9e:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  801ea2:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  801ea6:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  801ead:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801eb1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801eb5:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  801eb9:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  801ebd:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  801ec1:	48 b8 cf 1e 80 00 00 	movabs $0x801ecf,%rax
+  801ec8:	00 00 00 
+  801ecb:	ff d0                	call   *%rax
+}
+  801ecd:	c9                   	leave
+  801ece:	c3                   	ret
+
+0000000000801ecf <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  801ecf:	55                   	push   %rbp
+  801ed0:	48 89 e5             	mov    %rsp,%rbp
+  801ed3:	41 57                	push   %r15
+  801ed5:	41 56                	push   %r14
+  801ed7:	41 55                	push   %r13
+  801ed9:	41 54                	push   %r12
+  801edb:	53                   	push   %rbx
+  801edc:	48 83 ec 38          	sub    $0x38,%rsp
+  801ee0:	49 89 fe             	mov    %rdi,%r14
+  801ee3:	49 89 f5             	mov    %rsi,%r13
+  801ee6:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  801ee9:	48 8b 01             	mov    (%rcx),%rax
+  801eec:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  801ef0:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  801ef4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801ef8:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  801efc:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  801f00:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  801f04:	0f b6 3b             	movzbl (%rbx),%edi
+  801f07:	40 80 ff 25          	cmp    $0x25,%dil
+  801f0b:	74 18                	je     801f25 <vprintfmt+0x56>
+            if (!ch) return;
+  801f0d:	40 84 ff             	test   %dil,%dil
+  801f10:	0f 84 b1 06 00 00    	je     8025c7 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  801f16:	40 0f b6 ff          	movzbl %dil,%edi
+  801f1a:	4c 89 ee             	mov    %r13,%rsi
+  801f1d:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  801f20:	4c 89 e3             	mov    %r12,%rbx
+  801f23:	eb db                	jmp    801f00 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  801f25:	be 00 00 00 00       	mov    $0x0,%esi
+  801f2a:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  801f2e:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  801f33:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  801f39:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  801f40:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  801f44:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  801f49:	41 0f b6 04 24       	movzbl (%r12),%eax
+  801f4e:	88 45 a0             	mov    %al,-0x60(%rbp)
+  801f51:	83 e8 23             	sub    $0x23,%eax
+  801f54:	3c 57                	cmp    $0x57,%al
+  801f56:	0f 87 51 06 00 00    	ja     8025ad <vprintfmt+0x6de>
+  801f5c:	0f b6 c0             	movzbl %al,%eax
+  801f5f:	48 b9 c0 2f 80 00 00 	movabs $0x802fc0,%rcx
+  801f66:	00 00 00 
+  801f69:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  801f6c:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  801f6f:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  801f73:	eb cf                	jmp    801f44 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  801f75:	49 89 dc             	mov    %rbx,%r12
+  801f78:	be 01 00 00 00       	mov    $0x1,%esi
+  801f7d:	eb c5                	jmp    801f44 <vprintfmt+0x75>
+            padc = ch;
+  801f7f:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  801f83:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  801f86:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801f89:	eb b9                	jmp    801f44 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  801f8b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801f8e:	83 f8 2f             	cmp    $0x2f,%eax
+  801f91:	77 24                	ja     801fb7 <vprintfmt+0xe8>
+  801f93:	89 c1                	mov    %eax,%ecx
+  801f95:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  801f99:	83 c0 08             	add    $0x8,%eax
+  801f9c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801f9f:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  801fa2:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  801fa5:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  801fa9:	79 99                	jns    801f44 <vprintfmt+0x75>
+                width = precision;
+  801fab:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  801faf:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  801fb5:	eb 8d                	jmp    801f44 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  801fb7:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  801fbb:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  801fbf:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801fc3:	eb da                	jmp    801f9f <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  801fc5:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  801fca:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  801fce:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  801fd4:	3c 39                	cmp    $0x39,%al
+  801fd6:	77 1c                	ja     801ff4 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  801fd8:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  801fdc:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  801fe0:	0f b6 c0             	movzbl %al,%eax
+  801fe3:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  801fe8:	0f b6 03             	movzbl (%rbx),%eax
+  801feb:	3c 39                	cmp    $0x39,%al
+  801fed:	76 e9                	jbe    801fd8 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  801fef:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  801ff2:	eb b1                	jmp    801fa5 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  801ff4:	49 89 dc             	mov    %rbx,%r12
+  801ff7:	eb ac                	jmp    801fa5 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  801ff9:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  801ffc:	85 c9                	test   %ecx,%ecx
+  801ffe:	b8 00 00 00 00       	mov    $0x0,%eax
+  802003:	0f 49 c1             	cmovns %ecx,%eax
+  802006:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  802009:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80200c:	e9 33 ff ff ff       	jmp    801f44 <vprintfmt+0x75>
+            lflag++;
+  802011:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  802014:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  802017:	e9 28 ff ff ff       	jmp    801f44 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  80201c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80201f:	83 f8 2f             	cmp    $0x2f,%eax
+  802022:	77 19                	ja     80203d <vprintfmt+0x16e>
+  802024:	89 c2                	mov    %eax,%edx
+  802026:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80202a:	83 c0 08             	add    $0x8,%eax
+  80202d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802030:	8b 3a                	mov    (%rdx),%edi
+  802032:	4c 89 ee             	mov    %r13,%rsi
+  802035:	41 ff d6             	call   *%r14
+            break;
+  802038:	e9 c3 fe ff ff       	jmp    801f00 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  80203d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802041:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802045:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802049:	eb e5                	jmp    802030 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  80204b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80204e:	83 f8 2f             	cmp    $0x2f,%eax
+  802051:	77 5a                	ja     8020ad <vprintfmt+0x1de>
+  802053:	89 c2                	mov    %eax,%edx
+  802055:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802059:	83 c0 08             	add    $0x8,%eax
+  80205c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  80205f:	8b 02                	mov    (%rdx),%eax
+  802061:	89 c1                	mov    %eax,%ecx
+  802063:	f7 d9                	neg    %ecx
+  802065:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  802068:	83 f9 15             	cmp    $0x15,%ecx
+  80206b:	7f 4e                	jg     8020bb <vprintfmt+0x1ec>
+  80206d:	48 63 c1             	movslq %ecx,%rax
+  802070:	48 ba 80 32 80 00 00 	movabs $0x803280,%rdx
+  802077:	00 00 00 
+  80207a:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80207e:	48 85 c0             	test   %rax,%rax
+  802081:	74 38                	je     8020bb <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  802083:	48 89 c1             	mov    %rax,%rcx
+  802086:	48 ba 99 2d 80 00 00 	movabs $0x802d99,%rdx
+  80208d:	00 00 00 
+  802090:	4c 89 ee             	mov    %r13,%rsi
+  802093:	4c 89 f7             	mov    %r14,%rdi
+  802096:	b8 00 00 00 00       	mov    $0x0,%eax
+  80209b:	49 b8 92 1e 80 00 00 	movabs $0x801e92,%r8
+  8020a2:	00 00 00 
+  8020a5:	41 ff d0             	call   *%r8
+  8020a8:	e9 53 fe ff ff       	jmp    801f00 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  8020ad:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8020b1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8020b5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8020b9:	eb a4                	jmp    80205f <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  8020bb:	48 ba 2c 2e 80 00 00 	movabs $0x802e2c,%rdx
+  8020c2:	00 00 00 
+  8020c5:	4c 89 ee             	mov    %r13,%rsi
+  8020c8:	4c 89 f7             	mov    %r14,%rdi
+  8020cb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020d0:	49 b8 92 1e 80 00 00 	movabs $0x801e92,%r8
+  8020d7:	00 00 00 
+  8020da:	41 ff d0             	call   *%r8
+  8020dd:	e9 1e fe ff ff       	jmp    801f00 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8020e2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8020e5:	83 f8 2f             	cmp    $0x2f,%eax
+  8020e8:	77 6c                	ja     802156 <vprintfmt+0x287>
+  8020ea:	89 c2                	mov    %eax,%edx
+  8020ec:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8020f0:	83 c0 08             	add    $0x8,%eax
+  8020f3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8020f6:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  8020f9:	48 85 d2             	test   %rdx,%rdx
+  8020fc:	48 b8 25 2e 80 00 00 	movabs $0x802e25,%rax
+  802103:	00 00 00 
+  802106:	48 0f 45 c2          	cmovne %rdx,%rax
+  80210a:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  80210e:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  802112:	7e 06                	jle    80211a <vprintfmt+0x24b>
+  802114:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  802118:	75 4a                	jne    802164 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  80211a:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  80211e:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  802122:	0f b6 00             	movzbl (%rax),%eax
+  802125:	84 c0                	test   %al,%al
+  802127:	0f 85 9a 00 00 00    	jne    8021c7 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  80212d:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  802130:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  802134:	85 c0                	test   %eax,%eax
+  802136:	0f 8e c4 fd ff ff    	jle    801f00 <vprintfmt+0x31>
+  80213c:	4c 89 ee             	mov    %r13,%rsi
+  80213f:	bf 20 00 00 00       	mov    $0x20,%edi
+  802144:	41 ff d6             	call   *%r14
+  802147:	41 83 ec 01          	sub    $0x1,%r12d
+  80214b:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  80214f:	75 eb                	jne    80213c <vprintfmt+0x26d>
+  802151:	e9 aa fd ff ff       	jmp    801f00 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  802156:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80215a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80215e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802162:	eb 92                	jmp    8020f6 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  802164:	49 63 f7             	movslq %r15d,%rsi
+  802167:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  80216b:	48 b8 81 26 80 00 00 	movabs $0x802681,%rax
+  802172:	00 00 00 
+  802175:	ff d0                	call   *%rax
+  802177:	48 89 c2             	mov    %rax,%rdx
+  80217a:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80217d:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  80217f:	8d 70 ff             	lea    -0x1(%rax),%esi
+  802182:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  802185:	85 c0                	test   %eax,%eax
+  802187:	7e 91                	jle    80211a <vprintfmt+0x24b>
+  802189:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  80218e:	4c 89 ee             	mov    %r13,%rsi
+  802191:	44 89 e7             	mov    %r12d,%edi
+  802194:	41 ff d6             	call   *%r14
+  802197:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  80219b:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80219e:	83 f8 ff             	cmp    $0xffffffff,%eax
+  8021a1:	75 eb                	jne    80218e <vprintfmt+0x2bf>
+  8021a3:	e9 72 ff ff ff       	jmp    80211a <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8021a8:	0f b6 f8             	movzbl %al,%edi
+  8021ab:	4c 89 ee             	mov    %r13,%rsi
+  8021ae:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8021b1:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8021b5:	49 83 c4 01          	add    $0x1,%r12
+  8021b9:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  8021bf:	84 c0                	test   %al,%al
+  8021c1:	0f 84 66 ff ff ff    	je     80212d <vprintfmt+0x25e>
+  8021c7:	45 85 ff             	test   %r15d,%r15d
+  8021ca:	78 0a                	js     8021d6 <vprintfmt+0x307>
+  8021cc:	41 83 ef 01          	sub    $0x1,%r15d
+  8021d0:	0f 88 57 ff ff ff    	js     80212d <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8021d6:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  8021da:	74 cc                	je     8021a8 <vprintfmt+0x2d9>
+  8021dc:	8d 50 e0             	lea    -0x20(%rax),%edx
+  8021df:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  8021e4:	80 fa 5e             	cmp    $0x5e,%dl
+  8021e7:	77 c2                	ja     8021ab <vprintfmt+0x2dc>
+  8021e9:	eb bd                	jmp    8021a8 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  8021eb:	40 84 f6             	test   %sil,%sil
+  8021ee:	75 26                	jne    802216 <vprintfmt+0x347>
+    switch (lflag) {
+  8021f0:	85 d2                	test   %edx,%edx
+  8021f2:	74 59                	je     80224d <vprintfmt+0x37e>
+  8021f4:	83 fa 01             	cmp    $0x1,%edx
+  8021f7:	74 7b                	je     802274 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  8021f9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8021fc:	83 f8 2f             	cmp    $0x2f,%eax
+  8021ff:	0f 87 96 00 00 00    	ja     80229b <vprintfmt+0x3cc>
+  802205:	89 c2                	mov    %eax,%edx
+  802207:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80220b:	83 c0 08             	add    $0x8,%eax
+  80220e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802211:	4c 8b 22             	mov    (%rdx),%r12
+  802214:	eb 17                	jmp    80222d <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  802216:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802219:	83 f8 2f             	cmp    $0x2f,%eax
+  80221c:	77 21                	ja     80223f <vprintfmt+0x370>
+  80221e:	89 c2                	mov    %eax,%edx
+  802220:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802224:	83 c0 08             	add    $0x8,%eax
+  802227:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80222a:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  80222d:	4d 85 e4             	test   %r12,%r12
+  802230:	78 7a                	js     8022ac <vprintfmt+0x3dd>
+            num = i;
+  802232:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  802235:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  80223a:	e9 50 02 00 00       	jmp    80248f <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  80223f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802243:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802247:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80224b:	eb dd                	jmp    80222a <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  80224d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802250:	83 f8 2f             	cmp    $0x2f,%eax
+  802253:	77 11                	ja     802266 <vprintfmt+0x397>
+  802255:	89 c2                	mov    %eax,%edx
+  802257:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80225b:	83 c0 08             	add    $0x8,%eax
+  80225e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802261:	4c 63 22             	movslq (%rdx),%r12
+  802264:	eb c7                	jmp    80222d <vprintfmt+0x35e>
+  802266:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80226a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80226e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802272:	eb ed                	jmp    802261 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  802274:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802277:	83 f8 2f             	cmp    $0x2f,%eax
+  80227a:	77 11                	ja     80228d <vprintfmt+0x3be>
+  80227c:	89 c2                	mov    %eax,%edx
+  80227e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802282:	83 c0 08             	add    $0x8,%eax
+  802285:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802288:	4c 8b 22             	mov    (%rdx),%r12
+  80228b:	eb a0                	jmp    80222d <vprintfmt+0x35e>
+  80228d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802291:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802295:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802299:	eb ed                	jmp    802288 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  80229b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80229f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8022a3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8022a7:	e9 65 ff ff ff       	jmp    802211 <vprintfmt+0x342>
+                putch('-', put_arg);
+  8022ac:	4c 89 ee             	mov    %r13,%rsi
+  8022af:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  8022b4:	41 ff d6             	call   *%r14
+                i = -i;
+  8022b7:	49 f7 dc             	neg    %r12
+  8022ba:	e9 73 ff ff ff       	jmp    802232 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  8022bf:	40 84 f6             	test   %sil,%sil
+  8022c2:	75 32                	jne    8022f6 <vprintfmt+0x427>
+    switch (lflag) {
+  8022c4:	85 d2                	test   %edx,%edx
+  8022c6:	74 5d                	je     802325 <vprintfmt+0x456>
+  8022c8:	83 fa 01             	cmp    $0x1,%edx
+  8022cb:	0f 84 82 00 00 00    	je     802353 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  8022d1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8022d4:	83 f8 2f             	cmp    $0x2f,%eax
+  8022d7:	0f 87 a5 00 00 00    	ja     802382 <vprintfmt+0x4b3>
+  8022dd:	89 c2                	mov    %eax,%edx
+  8022df:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8022e3:	83 c0 08             	add    $0x8,%eax
+  8022e6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8022e9:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8022ec:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  8022f1:	e9 99 01 00 00       	jmp    80248f <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8022f6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8022f9:	83 f8 2f             	cmp    $0x2f,%eax
+  8022fc:	77 19                	ja     802317 <vprintfmt+0x448>
+  8022fe:	89 c2                	mov    %eax,%edx
+  802300:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802304:	83 c0 08             	add    $0x8,%eax
+  802307:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80230a:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  80230d:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  802312:	e9 78 01 00 00       	jmp    80248f <vprintfmt+0x5c0>
+  802317:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80231b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80231f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802323:	eb e5                	jmp    80230a <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  802325:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802328:	83 f8 2f             	cmp    $0x2f,%eax
+  80232b:	77 18                	ja     802345 <vprintfmt+0x476>
+  80232d:	89 c2                	mov    %eax,%edx
+  80232f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802333:	83 c0 08             	add    $0x8,%eax
+  802336:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802339:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  80233b:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  802340:	e9 4a 01 00 00       	jmp    80248f <vprintfmt+0x5c0>
+  802345:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802349:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80234d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802351:	eb e6                	jmp    802339 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  802353:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802356:	83 f8 2f             	cmp    $0x2f,%eax
+  802359:	77 19                	ja     802374 <vprintfmt+0x4a5>
+  80235b:	89 c2                	mov    %eax,%edx
+  80235d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802361:	83 c0 08             	add    $0x8,%eax
+  802364:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802367:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  80236a:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  80236f:	e9 1b 01 00 00       	jmp    80248f <vprintfmt+0x5c0>
+  802374:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802378:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80237c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802380:	eb e5                	jmp    802367 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  802382:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802386:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80238a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80238e:	e9 56 ff ff ff       	jmp    8022e9 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  802393:	40 84 f6             	test   %sil,%sil
+  802396:	75 2e                	jne    8023c6 <vprintfmt+0x4f7>
+    switch (lflag) {
+  802398:	85 d2                	test   %edx,%edx
+  80239a:	74 59                	je     8023f5 <vprintfmt+0x526>
+  80239c:	83 fa 01             	cmp    $0x1,%edx
+  80239f:	74 7f                	je     802420 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  8023a1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8023a4:	83 f8 2f             	cmp    $0x2f,%eax
+  8023a7:	0f 87 9f 00 00 00    	ja     80244c <vprintfmt+0x57d>
+  8023ad:	89 c2                	mov    %eax,%edx
+  8023af:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8023b3:	83 c0 08             	add    $0x8,%eax
+  8023b6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8023b9:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8023bc:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  8023c1:	e9 c9 00 00 00       	jmp    80248f <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8023c6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8023c9:	83 f8 2f             	cmp    $0x2f,%eax
+  8023cc:	77 19                	ja     8023e7 <vprintfmt+0x518>
+  8023ce:	89 c2                	mov    %eax,%edx
+  8023d0:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8023d4:	83 c0 08             	add    $0x8,%eax
+  8023d7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8023da:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8023dd:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8023e2:	e9 a8 00 00 00       	jmp    80248f <vprintfmt+0x5c0>
+  8023e7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8023eb:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8023ef:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8023f3:	eb e5                	jmp    8023da <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  8023f5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8023f8:	83 f8 2f             	cmp    $0x2f,%eax
+  8023fb:	77 15                	ja     802412 <vprintfmt+0x543>
+  8023fd:	89 c2                	mov    %eax,%edx
+  8023ff:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802403:	83 c0 08             	add    $0x8,%eax
+  802406:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802409:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  80240b:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  802410:	eb 7d                	jmp    80248f <vprintfmt+0x5c0>
+  802412:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802416:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80241a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80241e:	eb e9                	jmp    802409 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  802420:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802423:	83 f8 2f             	cmp    $0x2f,%eax
+  802426:	77 16                	ja     80243e <vprintfmt+0x56f>
+  802428:	89 c2                	mov    %eax,%edx
+  80242a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80242e:	83 c0 08             	add    $0x8,%eax
+  802431:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802434:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  802437:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  80243c:	eb 51                	jmp    80248f <vprintfmt+0x5c0>
+  80243e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802442:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802446:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80244a:	eb e8                	jmp    802434 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  80244c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802450:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802454:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802458:	e9 5c ff ff ff       	jmp    8023b9 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  80245d:	4c 89 ee             	mov    %r13,%rsi
+  802460:	bf 30 00 00 00       	mov    $0x30,%edi
+  802465:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  802468:	4c 89 ee             	mov    %r13,%rsi
+  80246b:	bf 78 00 00 00       	mov    $0x78,%edi
+  802470:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  802473:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802476:	83 f8 2f             	cmp    $0x2f,%eax
+  802479:	77 47                	ja     8024c2 <vprintfmt+0x5f3>
+  80247b:	89 c2                	mov    %eax,%edx
+  80247d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802481:	83 c0 08             	add    $0x8,%eax
+  802484:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802487:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  80248a:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  80248f:	48 83 ec 08          	sub    $0x8,%rsp
+  802493:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  802497:	0f 94 c0             	sete   %al
+  80249a:	0f b6 c0             	movzbl %al,%eax
+  80249d:	50                   	push   %rax
+  80249e:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  8024a3:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  8024a7:	4c 89 ee             	mov    %r13,%rsi
+  8024aa:	4c 89 f7             	mov    %r14,%rdi
+  8024ad:	48 b8 c4 1d 80 00 00 	movabs $0x801dc4,%rax
+  8024b4:	00 00 00 
+  8024b7:	ff d0                	call   *%rax
+            break;
+  8024b9:	48 83 c4 10          	add    $0x10,%rsp
+  8024bd:	e9 3e fa ff ff       	jmp    801f00 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  8024c2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8024c6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8024ca:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8024ce:	eb b7                	jmp    802487 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  8024d0:	40 84 f6             	test   %sil,%sil
+  8024d3:	75 2b                	jne    802500 <vprintfmt+0x631>
+    switch (lflag) {
+  8024d5:	85 d2                	test   %edx,%edx
+  8024d7:	74 56                	je     80252f <vprintfmt+0x660>
+  8024d9:	83 fa 01             	cmp    $0x1,%edx
+  8024dc:	74 7f                	je     80255d <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  8024de:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8024e1:	83 f8 2f             	cmp    $0x2f,%eax
+  8024e4:	0f 87 a2 00 00 00    	ja     80258c <vprintfmt+0x6bd>
+  8024ea:	89 c2                	mov    %eax,%edx
+  8024ec:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8024f0:	83 c0 08             	add    $0x8,%eax
+  8024f3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8024f6:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8024f9:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  8024fe:	eb 8f                	jmp    80248f <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  802500:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802503:	83 f8 2f             	cmp    $0x2f,%eax
+  802506:	77 19                	ja     802521 <vprintfmt+0x652>
+  802508:	89 c2                	mov    %eax,%edx
+  80250a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80250e:	83 c0 08             	add    $0x8,%eax
+  802511:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802514:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  802517:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  80251c:	e9 6e ff ff ff       	jmp    80248f <vprintfmt+0x5c0>
+  802521:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802525:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802529:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80252d:	eb e5                	jmp    802514 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  80252f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802532:	83 f8 2f             	cmp    $0x2f,%eax
+  802535:	77 18                	ja     80254f <vprintfmt+0x680>
+  802537:	89 c2                	mov    %eax,%edx
+  802539:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80253d:	83 c0 08             	add    $0x8,%eax
+  802540:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802543:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  802545:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  80254a:	e9 40 ff ff ff       	jmp    80248f <vprintfmt+0x5c0>
+  80254f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802553:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802557:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80255b:	eb e6                	jmp    802543 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  80255d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802560:	83 f8 2f             	cmp    $0x2f,%eax
+  802563:	77 19                	ja     80257e <vprintfmt+0x6af>
+  802565:	89 c2                	mov    %eax,%edx
+  802567:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80256b:	83 c0 08             	add    $0x8,%eax
+  80256e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802571:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  802574:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  802579:	e9 11 ff ff ff       	jmp    80248f <vprintfmt+0x5c0>
+  80257e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802582:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802586:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80258a:	eb e5                	jmp    802571 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  80258c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802590:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802594:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802598:	e9 59 ff ff ff       	jmp    8024f6 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  80259d:	4c 89 ee             	mov    %r13,%rsi
+  8025a0:	bf 25 00 00 00       	mov    $0x25,%edi
+  8025a5:	41 ff d6             	call   *%r14
+            break;
+  8025a8:	e9 53 f9 ff ff       	jmp    801f00 <vprintfmt+0x31>
+            putch('%', put_arg);
+  8025ad:	4c 89 ee             	mov    %r13,%rsi
+  8025b0:	bf 25 00 00 00       	mov    $0x25,%edi
+  8025b5:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  8025b8:	48 83 eb 01          	sub    $0x1,%rbx
+  8025bc:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  8025c0:	75 f6                	jne    8025b8 <vprintfmt+0x6e9>
+  8025c2:	e9 39 f9 ff ff       	jmp    801f00 <vprintfmt+0x31>
+}
+  8025c7:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8025cb:	5b                   	pop    %rbx
+  8025cc:	41 5c                	pop    %r12
+  8025ce:	41 5d                	pop    %r13
+  8025d0:	41 5e                	pop    %r14
+  8025d2:	41 5f                	pop    %r15
+  8025d4:	5d                   	pop    %rbp
+  8025d5:	c3                   	ret
+
+00000000008025d6 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  8025d6:	55                   	push   %rbp
+  8025d7:	48 89 e5             	mov    %rsp,%rbp
+  8025da:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  8025de:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8025e2:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  8025e7:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  8025eb:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  8025f2:	48 85 ff             	test   %rdi,%rdi
+  8025f5:	74 2b                	je     802622 <vsnprintf+0x4c>
+  8025f7:	48 85 f6             	test   %rsi,%rsi
+  8025fa:	74 26                	je     802622 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  8025fc:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802600:	48 bf 7a 1e 80 00 00 	movabs $0x801e7a,%rdi
+  802607:	00 00 00 
+  80260a:	48 b8 cf 1e 80 00 00 	movabs $0x801ecf,%rax
+  802611:	00 00 00 
+  802614:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  802616:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80261a:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  80261d:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  802620:	c9                   	leave
+  802621:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  802622:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802627:	eb f7                	jmp    802620 <vsnprintf+0x4a>
+
+0000000000802629 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  802629:	55                   	push   %rbp
+  80262a:	48 89 e5             	mov    %rsp,%rbp
+  80262d:	48 83 ec 50          	sub    $0x50,%rsp
+  802631:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  802635:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  802639:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  80263d:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  802644:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802648:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80264c:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  802650:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  802654:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  802658:	48 b8 d6 25 80 00 00 	movabs $0x8025d6,%rax
+  80265f:	00 00 00 
+  802662:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  802664:	c9                   	leave
+  802665:	c3                   	ret
+
+0000000000802666 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  802666:	80 3f 00             	cmpb   $0x0,(%rdi)
+  802669:	74 10                	je     80267b <strlen+0x15>
+    size_t n = 0;
+  80266b:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  802670:	48 83 c0 01          	add    $0x1,%rax
+  802674:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  802678:	75 f6                	jne    802670 <strlen+0xa>
+  80267a:	c3                   	ret
+    size_t n = 0;
+  80267b:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  802680:	c3                   	ret
+
+0000000000802681 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  802681:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  802684:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  802689:	48 85 f6             	test   %rsi,%rsi
+  80268c:	74 11                	je     80269f <strnlen+0x1e>
+  80268e:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  802692:	74 0c                	je     8026a0 <strnlen+0x1f>
+  802694:	48 83 c2 01          	add    $0x1,%rdx
+  802698:	48 39 d0             	cmp    %rdx,%rax
+  80269b:	75 f1                	jne    80268e <strnlen+0xd>
+  80269d:	eb 04                	jmp    8026a3 <strnlen+0x22>
+  80269f:	c3                   	ret
+  8026a0:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  8026a3:	c3                   	ret
+
+00000000008026a4 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  8026a4:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  8026a7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8026ac:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  8026b0:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  8026b3:	48 83 c2 01          	add    $0x1,%rdx
+  8026b7:	84 c9                	test   %cl,%cl
+  8026b9:	75 f1                	jne    8026ac <strcpy+0x8>
+        ;
+    return res;
+}
+  8026bb:	c3                   	ret
+
+00000000008026bc <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  8026bc:	55                   	push   %rbp
+  8026bd:	48 89 e5             	mov    %rsp,%rbp
+  8026c0:	41 54                	push   %r12
+  8026c2:	53                   	push   %rbx
+  8026c3:	48 89 fb             	mov    %rdi,%rbx
+  8026c6:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  8026c9:	48 b8 66 26 80 00 00 	movabs $0x802666,%rax
+  8026d0:	00 00 00 
+  8026d3:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  8026d5:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  8026d9:	4c 89 e6             	mov    %r12,%rsi
+  8026dc:	48 b8 a4 26 80 00 00 	movabs $0x8026a4,%rax
+  8026e3:	00 00 00 
+  8026e6:	ff d0                	call   *%rax
+    return dst;
+}
+  8026e8:	48 89 d8             	mov    %rbx,%rax
+  8026eb:	5b                   	pop    %rbx
+  8026ec:	41 5c                	pop    %r12
+  8026ee:	5d                   	pop    %rbp
+  8026ef:	c3                   	ret
+
+00000000008026f0 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8026f0:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  8026f3:	48 85 d2             	test   %rdx,%rdx
+  8026f6:	74 1f                	je     802717 <strncpy+0x27>
+  8026f8:	48 01 fa             	add    %rdi,%rdx
+  8026fb:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  8026fe:	48 83 c1 01          	add    $0x1,%rcx
+  802702:	44 0f b6 06          	movzbl (%rsi),%r8d
+  802706:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  80270a:	41 80 f8 01          	cmp    $0x1,%r8b
+  80270e:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  802712:	48 39 ca             	cmp    %rcx,%rdx
+  802715:	75 e7                	jne    8026fe <strncpy+0xe>
+    }
+    return ret;
+}
+  802717:	c3                   	ret
+
+0000000000802718 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  802718:	48 89 f8             	mov    %rdi,%rax
+  80271b:	48 85 d2             	test   %rdx,%rdx
+  80271e:	74 24                	je     802744 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  802720:	48 83 ea 01          	sub    $0x1,%rdx
+  802724:	74 1b                	je     802741 <strlcpy+0x29>
+  802726:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  80272a:	0f b6 16             	movzbl (%rsi),%edx
+  80272d:	84 d2                	test   %dl,%dl
+  80272f:	74 10                	je     802741 <strlcpy+0x29>
+            *dst++ = *src++;
+  802731:	48 83 c6 01          	add    $0x1,%rsi
+  802735:	48 83 c0 01          	add    $0x1,%rax
+  802739:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  80273c:	48 39 c8             	cmp    %rcx,%rax
+  80273f:	75 e9                	jne    80272a <strlcpy+0x12>
+        *dst = '\0';
+  802741:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  802744:	48 29 f8             	sub    %rdi,%rax
+}
+  802747:	c3                   	ret
+
+0000000000802748 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  802748:	0f b6 07             	movzbl (%rdi),%eax
+  80274b:	84 c0                	test   %al,%al
+  80274d:	74 13                	je     802762 <strcmp+0x1a>
+  80274f:	38 06                	cmp    %al,(%rsi)
+  802751:	75 0f                	jne    802762 <strcmp+0x1a>
+  802753:	48 83 c7 01          	add    $0x1,%rdi
+  802757:	48 83 c6 01          	add    $0x1,%rsi
+  80275b:	0f b6 07             	movzbl (%rdi),%eax
+  80275e:	84 c0                	test   %al,%al
+  802760:	75 ed                	jne    80274f <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  802762:	0f b6 c0             	movzbl %al,%eax
+  802765:	0f b6 16             	movzbl (%rsi),%edx
+  802768:	29 d0                	sub    %edx,%eax
+}
+  80276a:	c3                   	ret
+
+000000000080276b <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  80276b:	48 85 d2             	test   %rdx,%rdx
+  80276e:	74 1f                	je     80278f <strncmp+0x24>
+  802770:	0f b6 07             	movzbl (%rdi),%eax
+  802773:	84 c0                	test   %al,%al
+  802775:	74 1e                	je     802795 <strncmp+0x2a>
+  802777:	3a 06                	cmp    (%rsi),%al
+  802779:	75 1a                	jne    802795 <strncmp+0x2a>
+  80277b:	48 83 c7 01          	add    $0x1,%rdi
+  80277f:	48 83 c6 01          	add    $0x1,%rsi
+  802783:	48 83 ea 01          	sub    $0x1,%rdx
+  802787:	75 e7                	jne    802770 <strncmp+0x5>
+
+    if (!n) return 0;
+  802789:	b8 00 00 00 00       	mov    $0x0,%eax
+  80278e:	c3                   	ret
+  80278f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802794:	c3                   	ret
+  802795:	48 85 d2             	test   %rdx,%rdx
+  802798:	74 09                	je     8027a3 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  80279a:	0f b6 07             	movzbl (%rdi),%eax
+  80279d:	0f b6 16             	movzbl (%rsi),%edx
+  8027a0:	29 d0                	sub    %edx,%eax
+  8027a2:	c3                   	ret
+    if (!n) return 0;
+  8027a3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8027a8:	c3                   	ret
+
+00000000008027a9 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  8027a9:	0f b6 17             	movzbl (%rdi),%edx
+  8027ac:	84 d2                	test   %dl,%dl
+  8027ae:	74 18                	je     8027c8 <strchr+0x1f>
+        if (*str == c) {
+  8027b0:	0f be d2             	movsbl %dl,%edx
+  8027b3:	39 f2                	cmp    %esi,%edx
+  8027b5:	74 17                	je     8027ce <strchr+0x25>
+    for (; *str; str++) {
+  8027b7:	48 83 c7 01          	add    $0x1,%rdi
+  8027bb:	0f b6 17             	movzbl (%rdi),%edx
+  8027be:	84 d2                	test   %dl,%dl
+  8027c0:	75 ee                	jne    8027b0 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  8027c2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027c7:	c3                   	ret
+  8027c8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027cd:	c3                   	ret
+  8027ce:	48 89 f8             	mov    %rdi,%rax
+}
+  8027d1:	c3                   	ret
+
+00000000008027d2 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  8027d2:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  8027d5:	0f b6 17             	movzbl (%rdi),%edx
+  8027d8:	84 d2                	test   %dl,%dl
+  8027da:	74 13                	je     8027ef <strfind+0x1d>
+  8027dc:	0f be d2             	movsbl %dl,%edx
+  8027df:	39 f2                	cmp    %esi,%edx
+  8027e1:	74 0b                	je     8027ee <strfind+0x1c>
+  8027e3:	48 83 c0 01          	add    $0x1,%rax
+  8027e7:	0f b6 10             	movzbl (%rax),%edx
+  8027ea:	84 d2                	test   %dl,%dl
+  8027ec:	75 ee                	jne    8027dc <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  8027ee:	c3                   	ret
+  8027ef:	c3                   	ret
+
+00000000008027f0 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  8027f0:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  8027f3:	48 89 f8             	mov    %rdi,%rax
+  8027f6:	48 f7 d8             	neg    %rax
+  8027f9:	83 e0 07             	and    $0x7,%eax
+  8027fc:	49 89 d1             	mov    %rdx,%r9
+  8027ff:	49 29 c1             	sub    %rax,%r9
+  802802:	78 36                	js     80283a <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  802804:	40 0f b6 c6          	movzbl %sil,%eax
+  802808:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  80280f:	01 01 01 
+  802812:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  802816:	40 f6 c7 07          	test   $0x7,%dil
+  80281a:	75 38                	jne    802854 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  80281c:	4c 89 c9             	mov    %r9,%rcx
+  80281f:	48 c1 f9 03          	sar    $0x3,%rcx
+  802823:	74 0c                	je     802831 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  802825:	fc                   	cld
+  802826:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  802829:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  80282d:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  802831:	4d 85 c9             	test   %r9,%r9
+  802834:	75 45                	jne    80287b <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  802836:	4c 89 c0             	mov    %r8,%rax
+  802839:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  80283a:	48 85 d2             	test   %rdx,%rdx
+  80283d:	74 f7                	je     802836 <memset+0x46>
+  80283f:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  802842:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  802845:	48 83 c0 01          	add    $0x1,%rax
+  802849:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  80284d:	48 39 c2             	cmp    %rax,%rdx
+  802850:	75 f3                	jne    802845 <memset+0x55>
+  802852:	eb e2                	jmp    802836 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  802854:	40 f6 c7 01          	test   $0x1,%dil
+  802858:	74 06                	je     802860 <memset+0x70>
+  80285a:	88 07                	mov    %al,(%rdi)
+  80285c:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  802860:	40 f6 c7 02          	test   $0x2,%dil
+  802864:	74 07                	je     80286d <memset+0x7d>
+  802866:	66 89 07             	mov    %ax,(%rdi)
+  802869:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  80286d:	40 f6 c7 04          	test   $0x4,%dil
+  802871:	74 a9                	je     80281c <memset+0x2c>
+  802873:	89 07                	mov    %eax,(%rdi)
+  802875:	48 83 c7 04          	add    $0x4,%rdi
+  802879:	eb a1                	jmp    80281c <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  80287b:	41 f6 c1 04          	test   $0x4,%r9b
+  80287f:	74 06                	je     802887 <memset+0x97>
+  802881:	89 07                	mov    %eax,(%rdi)
+  802883:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  802887:	41 f6 c1 02          	test   $0x2,%r9b
+  80288b:	74 07                	je     802894 <memset+0xa4>
+  80288d:	66 89 07             	mov    %ax,(%rdi)
+  802890:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  802894:	41 f6 c1 01          	test   $0x1,%r9b
+  802898:	74 9c                	je     802836 <memset+0x46>
+  80289a:	88 07                	mov    %al,(%rdi)
+  80289c:	eb 98                	jmp    802836 <memset+0x46>
+
+000000000080289e <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  80289e:	48 89 f8             	mov    %rdi,%rax
+  8028a1:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  8028a4:	48 39 fe             	cmp    %rdi,%rsi
+  8028a7:	73 3b                	jae    8028e4 <memmove+0x46>
+  8028a9:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  8028ad:	48 39 d7             	cmp    %rdx,%rdi
+  8028b0:	73 32                	jae    8028e4 <memmove+0x46>
+        s += n;
+        d += n;
+  8028b2:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  8028b6:	48 89 d6             	mov    %rdx,%rsi
+  8028b9:	48 09 fe             	or     %rdi,%rsi
+  8028bc:	48 09 ce             	or     %rcx,%rsi
+  8028bf:	40 f6 c6 07          	test   $0x7,%sil
+  8028c3:	75 12                	jne    8028d7 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  8028c5:	48 83 ef 08          	sub    $0x8,%rdi
+  8028c9:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  8028cd:	48 c1 e9 03          	shr    $0x3,%rcx
+  8028d1:	fd                   	std
+  8028d2:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  8028d5:	fc                   	cld
+  8028d6:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  8028d7:	48 83 ef 01          	sub    $0x1,%rdi
+  8028db:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  8028df:	fd                   	std
+  8028e0:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  8028e2:	eb f1                	jmp    8028d5 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  8028e4:	48 89 f2             	mov    %rsi,%rdx
+  8028e7:	48 09 c2             	or     %rax,%rdx
+  8028ea:	48 09 ca             	or     %rcx,%rdx
+  8028ed:	f6 c2 07             	test   $0x7,%dl
+  8028f0:	75 0c                	jne    8028fe <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  8028f2:	48 c1 e9 03          	shr    $0x3,%rcx
+  8028f6:	48 89 c7             	mov    %rax,%rdi
+  8028f9:	fc                   	cld
+  8028fa:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  8028fd:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  8028fe:	48 89 c7             	mov    %rax,%rdi
+  802901:	fc                   	cld
+  802902:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  802904:	c3                   	ret
+
+0000000000802905 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  802905:	55                   	push   %rbp
+  802906:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  802909:	48 b8 9e 28 80 00 00 	movabs $0x80289e,%rax
+  802910:	00 00 00 
+  802913:	ff d0                	call   *%rax
+}
+  802915:	5d                   	pop    %rbp
+  802916:	c3                   	ret
+
+0000000000802917 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  802917:	55                   	push   %rbp
+  802918:	48 89 e5             	mov    %rsp,%rbp
+  80291b:	41 57                	push   %r15
+  80291d:	41 56                	push   %r14
+  80291f:	41 55                	push   %r13
+  802921:	41 54                	push   %r12
+  802923:	53                   	push   %rbx
+  802924:	48 83 ec 08          	sub    $0x8,%rsp
+  802928:	49 89 fe             	mov    %rdi,%r14
+  80292b:	49 89 f7             	mov    %rsi,%r15
+  80292e:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  802931:	48 89 f7             	mov    %rsi,%rdi
+  802934:	48 b8 66 26 80 00 00 	movabs $0x802666,%rax
+  80293b:	00 00 00 
+  80293e:	ff d0                	call   *%rax
+  802940:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  802943:	48 89 de             	mov    %rbx,%rsi
+  802946:	4c 89 f7             	mov    %r14,%rdi
+  802949:	48 b8 81 26 80 00 00 	movabs $0x802681,%rax
+  802950:	00 00 00 
+  802953:	ff d0                	call   *%rax
+  802955:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  802958:	48 39 c3             	cmp    %rax,%rbx
+  80295b:	74 36                	je     802993 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  80295d:	48 89 d8             	mov    %rbx,%rax
+  802960:	4c 29 e8             	sub    %r13,%rax
+  802963:	49 39 c4             	cmp    %rax,%r12
+  802966:	73 31                	jae    802999 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  802968:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  80296d:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  802971:	4c 89 fe             	mov    %r15,%rsi
+  802974:	48 b8 05 29 80 00 00 	movabs $0x802905,%rax
+  80297b:	00 00 00 
+  80297e:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  802980:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  802984:	48 83 c4 08          	add    $0x8,%rsp
+  802988:	5b                   	pop    %rbx
+  802989:	41 5c                	pop    %r12
+  80298b:	41 5d                	pop    %r13
+  80298d:	41 5e                	pop    %r14
+  80298f:	41 5f                	pop    %r15
+  802991:	5d                   	pop    %rbp
+  802992:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  802993:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  802997:	eb eb                	jmp    802984 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  802999:	48 83 eb 01          	sub    $0x1,%rbx
+  80299d:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8029a1:	48 89 da             	mov    %rbx,%rdx
+  8029a4:	4c 89 fe             	mov    %r15,%rsi
+  8029a7:	48 b8 05 29 80 00 00 	movabs $0x802905,%rax
+  8029ae:	00 00 00 
+  8029b1:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  8029b3:	49 01 de             	add    %rbx,%r14
+  8029b6:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  8029bb:	eb c3                	jmp    802980 <strlcat+0x69>
+
+00000000008029bd <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  8029bd:	48 85 d2             	test   %rdx,%rdx
+  8029c0:	74 2d                	je     8029ef <memcmp+0x32>
+  8029c2:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  8029c7:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  8029cb:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  8029d0:	44 38 c1             	cmp    %r8b,%cl
+  8029d3:	75 0f                	jne    8029e4 <memcmp+0x27>
+    while (n-- > 0) {
+  8029d5:	48 83 c0 01          	add    $0x1,%rax
+  8029d9:	48 39 c2             	cmp    %rax,%rdx
+  8029dc:	75 e9                	jne    8029c7 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  8029de:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029e3:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  8029e4:	0f b6 c1             	movzbl %cl,%eax
+  8029e7:	45 0f b6 c0          	movzbl %r8b,%r8d
+  8029eb:	44 29 c0             	sub    %r8d,%eax
+  8029ee:	c3                   	ret
+    return 0;
+  8029ef:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8029f4:	c3                   	ret
+
+00000000008029f5 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  8029f5:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  8029f9:	48 39 c7             	cmp    %rax,%rdi
+  8029fc:	73 0f                	jae    802a0d <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  8029fe:	40 38 37             	cmp    %sil,(%rdi)
+  802a01:	74 0e                	je     802a11 <memfind+0x1c>
+    for (; src < end; src++) {
+  802a03:	48 83 c7 01          	add    $0x1,%rdi
+  802a07:	48 39 f8             	cmp    %rdi,%rax
+  802a0a:	75 f2                	jne    8029fe <memfind+0x9>
+  802a0c:	c3                   	ret
+  802a0d:	48 89 f8             	mov    %rdi,%rax
+  802a10:	c3                   	ret
+  802a11:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  802a14:	c3                   	ret
+
+0000000000802a15 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  802a15:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  802a18:	0f b6 37             	movzbl (%rdi),%esi
+  802a1b:	40 80 fe 20          	cmp    $0x20,%sil
+  802a1f:	74 06                	je     802a27 <strtol+0x12>
+  802a21:	40 80 fe 09          	cmp    $0x9,%sil
+  802a25:	75 13                	jne    802a3a <strtol+0x25>
+  802a27:	48 83 c7 01          	add    $0x1,%rdi
+  802a2b:	0f b6 37             	movzbl (%rdi),%esi
+  802a2e:	40 80 fe 20          	cmp    $0x20,%sil
+  802a32:	74 f3                	je     802a27 <strtol+0x12>
+  802a34:	40 80 fe 09          	cmp    $0x9,%sil
+  802a38:	74 ed                	je     802a27 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  802a3a:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  802a3d:	83 e0 fd             	and    $0xfffffffd,%eax
+  802a40:	3c 01                	cmp    $0x1,%al
+  802a42:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  802a46:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  802a4c:	75 0f                	jne    802a5d <strtol+0x48>
+  802a4e:	80 3f 30             	cmpb   $0x30,(%rdi)
+  802a51:	74 14                	je     802a67 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  802a53:	85 d2                	test   %edx,%edx
+  802a55:	b8 0a 00 00 00       	mov    $0xa,%eax
+  802a5a:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  802a5d:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  802a62:	4c 63 ca             	movslq %edx,%r9
+  802a65:	eb 36                	jmp    802a9d <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  802a67:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  802a6b:	74 0f                	je     802a7c <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  802a6d:	85 d2                	test   %edx,%edx
+  802a6f:	75 ec                	jne    802a5d <strtol+0x48>
+        s++;
+  802a71:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  802a75:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  802a7a:	eb e1                	jmp    802a5d <strtol+0x48>
+        s += 2;
+  802a7c:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  802a80:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  802a85:	eb d6                	jmp    802a5d <strtol+0x48>
+            dig -= '0';
+  802a87:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  802a8a:	44 0f b6 c1          	movzbl %cl,%r8d
+  802a8e:	41 39 d0             	cmp    %edx,%r8d
+  802a91:	7d 21                	jge    802ab4 <strtol+0x9f>
+        val = val * base + dig;
+  802a93:	49 0f af c1          	imul   %r9,%rax
+  802a97:	0f b6 c9             	movzbl %cl,%ecx
+  802a9a:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  802a9d:	48 83 c7 01          	add    $0x1,%rdi
+  802aa1:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  802aa5:	80 f9 39             	cmp    $0x39,%cl
+  802aa8:	76 dd                	jbe    802a87 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  802aaa:	80 f9 7b             	cmp    $0x7b,%cl
+  802aad:	77 05                	ja     802ab4 <strtol+0x9f>
+            dig -= 'a' - 10;
+  802aaf:	83 e9 57             	sub    $0x57,%ecx
+  802ab2:	eb d6                	jmp    802a8a <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  802ab4:	4d 85 d2             	test   %r10,%r10
+  802ab7:	74 03                	je     802abc <strtol+0xa7>
+  802ab9:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  802abc:	48 89 c2             	mov    %rax,%rdx
+  802abf:	48 f7 da             	neg    %rdx
+  802ac2:	40 80 fe 2d          	cmp    $0x2d,%sil
+  802ac6:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  802aca:	c3                   	ret
+
+0000000000802acb <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  802acb:	55                   	push   %rbp
+  802acc:	48 89 e5             	mov    %rsp,%rbp
+  802acf:	41 55                	push   %r13
+  802ad1:	41 54                	push   %r12
+  802ad3:	53                   	push   %rbx
+  802ad4:	48 83 ec 08          	sub    $0x8,%rsp
+  802ad8:	49 89 fc             	mov    %rdi,%r12
+  802adb:	48 89 f7             	mov    %rsi,%rdi
+  802ade:	48 89 d3             	mov    %rdx,%rbx
+  802ae1:	49 89 cd             	mov    %rcx,%r13
+    // LAB 9: Your code here:
+    int res = sys_ipc_recv(!pg ? (void*)MAX_USER_ADDRESS : pg, !size ? 0 : *size);
+  802ae4:	be 00 00 00 00       	mov    $0x0,%esi
+  802ae9:	48 85 d2             	test   %rdx,%rdx
+  802aec:	74 03                	je     802af1 <ipc_recv+0x26>
+  802aee:	48 8b 32             	mov    (%rdx),%rsi
+  802af1:	48 85 ff             	test   %rdi,%rdi
+  802af4:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802afb:	00 00 00 
+  802afe:	48 0f 44 f8          	cmove  %rax,%rdi
+  802b02:	48 b8 70 06 80 00 00 	movabs $0x800670,%rax
+  802b09:	00 00 00 
+  802b0c:	ff d0                	call   *%rax
+    if (res < 0) {
+  802b0e:	85 c0                	test   %eax,%eax
+  802b10:	78 66                	js     802b78 <ipc_recv+0xad>
+        if (size) {
+            *size = 0;
+        }
+        return res;
+    }
+    if (from_env_store) {
+  802b12:	4d 85 e4             	test   %r12,%r12
+  802b15:	74 14                	je     802b2b <ipc_recv+0x60>
+        *from_env_store = thisenv->env_ipc_from;
+  802b17:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802b1e:	00 00 00 
+  802b21:	8b 80 ac 01 00 00    	mov    0x1ac(%rax),%eax
+  802b27:	41 89 04 24          	mov    %eax,(%r12)
+    }
+    if (perm_store) {
+  802b2b:	4d 85 ed             	test   %r13,%r13
+  802b2e:	74 14                	je     802b44 <ipc_recv+0x79>
+        *perm_store = thisenv->env_ipc_perm;
+  802b30:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802b37:	00 00 00 
+  802b3a:	8b 80 b0 01 00 00    	mov    0x1b0(%rax),%eax
+  802b40:	41 89 45 00          	mov    %eax,0x0(%r13)
+    }
+    if (size) {
+  802b44:	48 85 db             	test   %rbx,%rbx
+  802b47:	74 14                	je     802b5d <ipc_recv+0x92>
+        *size = thisenv->env_ipc_maxsz;
+  802b49:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802b50:	00 00 00 
+  802b53:	48 8b 80 a0 01 00 00 	mov    0x1a0(%rax),%rax
+  802b5a:	48 89 03             	mov    %rax,(%rbx)
+    }
+    return thisenv->env_ipc_value;
+  802b5d:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802b64:	00 00 00 
+  802b67:	8b 80 a8 01 00 00    	mov    0x1a8(%rax),%eax
+}
+  802b6d:	48 83 c4 08          	add    $0x8,%rsp
+  802b71:	5b                   	pop    %rbx
+  802b72:	41 5c                	pop    %r12
+  802b74:	41 5d                	pop    %r13
+  802b76:	5d                   	pop    %rbp
+  802b77:	c3                   	ret
+        if (from_env_store) {
+  802b78:	4d 85 e4             	test   %r12,%r12
+  802b7b:	74 08                	je     802b85 <ipc_recv+0xba>
+            *from_env_store = 0;
+  802b7d:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  802b84:	00 
+        if (perm_store) {
+  802b85:	4d 85 ed             	test   %r13,%r13
+  802b88:	74 08                	je     802b92 <ipc_recv+0xc7>
+            *perm_store = 0;
+  802b8a:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  802b91:	00 
+        if (size) {
+  802b92:	48 85 db             	test   %rbx,%rbx
+  802b95:	74 d6                	je     802b6d <ipc_recv+0xa2>
+            *size = 0;
+  802b97:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  802b9e:	eb cd                	jmp    802b6d <ipc_recv+0xa2>
+
+0000000000802ba0 <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  802ba0:	55                   	push   %rbp
+  802ba1:	48 89 e5             	mov    %rsp,%rbp
+  802ba4:	41 57                	push   %r15
+  802ba6:	41 56                	push   %r14
+  802ba8:	41 55                	push   %r13
+  802baa:	41 54                	push   %r12
+  802bac:	53                   	push   %rbx
+  802bad:	48 83 ec 18          	sub    $0x18,%rsp
+  802bb1:	41 89 fd             	mov    %edi,%r13d
+  802bb4:	89 75 cc             	mov    %esi,-0x34(%rbp)
+  802bb7:	49 89 cc             	mov    %rcx,%r12
+  802bba:	44 89 45 c8          	mov    %r8d,-0x38(%rbp)
+    // LAB 9: Your code here:
+    int res = 0;
+    while ((res = sys_ipc_try_send(to_env, val, !pg ? (void*)MAX_USER_ADDRESS : pg, size, perm)) < 0) {
+  802bbe:	48 85 d2             	test   %rdx,%rdx
+  802bc1:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802bc8:	00 00 00 
+  802bcb:	48 0f 45 c2          	cmovne %rdx,%rax
+  802bcf:	48 89 c3             	mov    %rax,%rbx
+  802bd2:	49 be 44 06 80 00 00 	movabs $0x800644,%r14
+  802bd9:	00 00 00 
+        if (res != -E_IPC_NOT_RECV) {
+            panic("sys_ipc_try_send failed: %i", res);
+        }
+        sys_yield();
+  802bdc:	49 bf 0f 02 80 00 00 	movabs $0x80020f,%r15
+  802be3:	00 00 00 
+    while ((res = sys_ipc_try_send(to_env, val, !pg ? (void*)MAX_USER_ADDRESS : pg, size, perm)) < 0) {
+  802be6:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  802be9:	44 8b 45 c8          	mov    -0x38(%rbp),%r8d
+  802bed:	4c 89 e1             	mov    %r12,%rcx
+  802bf0:	48 89 da             	mov    %rbx,%rdx
+  802bf3:	44 89 ef             	mov    %r13d,%edi
+  802bf6:	41 ff d6             	call   *%r14
+  802bf9:	85 c0                	test   %eax,%eax
+  802bfb:	79 37                	jns    802c34 <ipc_send+0x94>
+        if (res != -E_IPC_NOT_RECV) {
+  802bfd:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  802c00:	75 05                	jne    802c07 <ipc_send+0x67>
+        sys_yield();
+  802c02:	41 ff d7             	call   *%r15
+  802c05:	eb df                	jmp    802be6 <ipc_send+0x46>
+            panic("sys_ipc_try_send failed: %i", res);
+  802c07:	89 c1                	mov    %eax,%ecx
+  802c09:	48 ba 4f 33 80 00 00 	movabs $0x80334f,%rdx
+  802c10:	00 00 00 
+  802c13:	be 40 00 00 00       	mov    $0x40,%esi
+  802c18:	48 bf 6b 33 80 00 00 	movabs $0x80336b,%rdi
+  802c1f:	00 00 00 
+  802c22:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c27:	49 b8 2f 1c 80 00 00 	movabs $0x801c2f,%r8
+  802c2e:	00 00 00 
+  802c31:	41 ff d0             	call   *%r8
+    }
+    return;
+}
+  802c34:	48 83 c4 18          	add    $0x18,%rsp
+  802c38:	5b                   	pop    %rbx
+  802c39:	41 5c                	pop    %r12
+  802c3b:	41 5d                	pop    %r13
+  802c3d:	41 5e                	pop    %r14
+  802c3f:	41 5f                	pop    %r15
+  802c41:	5d                   	pop    %rbp
+  802c42:	c3                   	ret
+
+0000000000802c43 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  802c43:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  802c48:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  802c4f:	00 00 00 
+  802c52:	48 69 d0 d0 01 00 00 	imul   $0x1d0,%rax,%rdx
+  802c59:	48 01 ca             	add    %rcx,%rdx
+  802c5c:	8b 92 e8 00 00 00    	mov    0xe8(%rdx),%edx
+  802c62:	39 fa                	cmp    %edi,%edx
+  802c64:	74 12                	je     802c78 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  802c66:	48 83 c0 01          	add    $0x1,%rax
+  802c6a:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  802c70:	75 e0                	jne    802c52 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  802c72:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802c77:	c3                   	ret
+            return envs[i].env_id;
+  802c78:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+  802c7f:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  802c86:	00 00 00 
+  802c89:	48 01 d0             	add    %rdx,%rax
+  802c8c:	8b 80 e0 00 00 00    	mov    0xe0(%rax),%eax
+  802c92:	c3                   	ret
+  802c93:	0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+
+0000000000802c98 <__rodata_start>:
+  802c98:	68 65 6c 6c 6f       	push   $0x6f6c6c65
+  802c9d:	2c 20                	sub    $0x20,%al
+  802c9f:	77 6f                	ja     802d10 <__rodata_start+0x78>
+  802ca1:	72 6c                	jb     802d0f <__rodata_start+0x77>
+  802ca3:	64 0a 00             	or     %fs:(%rax),%al
+  802ca6:	3c 75                	cmp    $0x75,%al
+  802ca8:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802ca9:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  802cad:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802cae:	3e 00 73 79          	ds add %dh,0x79(%rbx)
+  802cb2:	73 63                	jae    802d17 <__rodata_start+0x7f>
+  802cb4:	61                   	(bad)
+  802cb5:	6c                   	insb   (%dx),%es:(%rdi)
+  802cb6:	6c                   	insb   (%dx),%es:(%rdi)
+  802cb7:	20 25 7a 64 20 72    	and    %ah,0x7220647a(%rip)        # 72a09137 <__bss_end+0x72201137>
+  802cbd:	65 74 75             	gs je  802d35 <__rodata_start+0x9d>
+  802cc0:	72 6e                	jb     802d30 <__rodata_start+0x98>
+  802cc2:	65 64 20 25 7a 64 20 	gs and %ah,%fs:0x2820647a(%rip)        # 28a09144 <__bss_end+0x28201144>
+  802cc9:	28 
+  802cca:	3e 20 30             	ds and %dh,(%rax)
+  802ccd:	29 00                	sub    %eax,(%rax)
+  802ccf:	6c                   	insb   (%dx),%es:(%rdi)
+  802cd0:	69 62 2f 73 79 73 63 	imul   $0x63737973,0x2f(%rdx),%esp
+  802cd7:	61                   	(bad)
+  802cd8:	6c                   	insb   (%dx),%es:(%rdi)
+  802cd9:	6c                   	insb   (%dx),%es:(%rdi)
+  802cda:	2e 63 00             	cs movsxd (%rax),%eax
+  802cdd:	0f 1f 00             	nopl   (%rax)
+  802ce0:	5b                   	pop    %rbx
+  802ce1:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  802ce6:	20 75 6e             	and    %dh,0x6e(%rbp)
+  802ce9:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  802ced:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802cee:	20 64 65 76          	and    %ah,0x76(%rbp,%riz,2)
+  802cf2:	69 63 65 20 74 79 70 	imul   $0x70797420,0x65(%rbx),%esp
+  802cf9:	65 20 25 64 0a 00 00 	and    %ah,%gs:0xa64(%rip)        # 803764 <error_string+0x4e4>
+  802d00:	5b                   	pop    %rbx
+  802d01:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  802d06:	20 66 74             	and    %ah,0x74(%rsi)
+  802d09:	72 75                	jb     802d80 <devtab+0x20>
+  802d0b:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802d0c:	63 61 74             	movsxd 0x74(%rcx),%esp
+  802d0f:	65 20 25 64 20 2d 2d 	and    %ah,%gs:0x2d2d2064(%rip)        # 2dad4d7a <__bss_end+0x2d2ccd7a>
+  802d16:	20 62 61             	and    %ah,0x61(%rdx)
+  802d19:	64 20 6d 6f          	and    %ch,%fs:0x6f(%rbp)
+  802d1d:	64 65 0a 00          	fs or  %gs:(%rax),%al
+  802d21:	5b                   	pop    %rbx
+  802d22:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  802d27:	20 72 65             	and    %dh,0x65(%rdx)
+  802d2a:	61                   	(bad)
+  802d2b:	64 20 25 64 20 2d 2d 	and    %ah,%fs:0x2d2d2064(%rip)        # 2dad4d96 <__bss_end+0x2d2ccd96>
+  802d32:	20 62 61             	and    %ah,0x61(%rdx)
+  802d35:	64 20 6d 6f          	and    %ch,%fs:0x6f(%rbp)
+  802d39:	64 65 0a 00          	fs or  %gs:(%rax),%al
+  802d3d:	5b                   	pop    %rbx
+  802d3e:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  802d43:	20 77 72             	and    %dh,0x72(%rdi)
+  802d46:	69 74 65 20 25 64 20 	imul   $0x2d206425,0x20(%rbp,%riz,2),%esi
+  802d4d:	2d 
+  802d4e:	2d 20 62 61 64       	sub    $0x64616220,%eax
+  802d53:	20 6d 6f             	and    %ch,0x6f(%rbp)
+  802d56:	64 65 0a 00          	fs or  %gs:(%rax),%al
+  802d5a:	66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+
+0000000000802d60 <devtab>:
+  802d60:	20 40 80 00 00 00 00 00 60 40 80 00 00 00 00 00      @......`@......
+  802d70:	a0 40 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .@..............
+  802d80:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  802d90:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  802da0:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  802db0:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  802dc0:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  802dd0:	3d 20 32 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73 00     = 2.<cons>.cons.
+  802de0:	5b 25 30 38 78 5d 20 75 73 65 72 20 70 61 6e 69     [%08x] user pani
+  802df0:	63 20 69 6e 20 25 73 20 61 74 20 25 73 3a 25 64     c in %s at %s:%d
+  802e00:	3a 20 00 30 31 32 33 34 35 36 37 38 39 41 42 43     : .0123456789ABC
+  802e10:	44 45 46 00 30 31 32 33 34 35 36 37 38 39 61 62     DEF.0123456789ab
+  802e20:	63 64 65 66 00 28 6e 75 6c 6c 29 00 65 72 72 6f     cdef.(null).erro
+  802e30:	72 20 25 64 00 75 6e 73 70 65 63 69 66 69 65 64     r %d.unspecified
+  802e40:	20 65 72 72 6f 72 00 62 61 64 20 65 6e 76 69 72      error.bad envir
+  802e50:	6f 6e 6d 65 6e 74 00 69 6e 76 61 6c 69 64 20 70     onment.invalid p
+  802e60:	61 72 61 6d 65 74 65 72 00 6f 75 74 20 6f 66 20     arameter.out of 
+  802e70:	6d 65 6d 6f 72 79 00 6f 75 74 20 6f 66 20 65 6e     memory.out of en
+  802e80:	76 69 72 6f 6e 6d 65 6e 74 73 00 63 6f 72 72 75     vironments.corru
+  802e90:	70 74 65 64 20 64 65 62 75 67 20 69 6e 66 6f 00     pted debug info.
+  802ea0:	73 65 67 6d 65 6e 74 61 74 69 6f 6e 20 66 61 75     segmentation fau
+  802eb0:	6c 74 00 69 6e 76 61 6c 69 64 20 45 4c 46 20 69     lt.invalid ELF i
+  802ec0:	6d 61 67 65 00 6e 6f 20 73 75 63 68 20 73 79 73     mage.no such sys
+  802ed0:	74 65 6d 20 63 61 6c 6c 00 65 6e 74 72 79 20 6e     tem call.entry n
+  802ee0:	6f 74 20 66 6f 75 6e 64 00 65 6e 76 20 69 73 20     ot found.env is 
+  802ef0:	6e 6f 74 20 72 65 63 76 69 6e 67 00 75 6e 65 78     not recving.unex
+  802f00:	70 65 63 74 65 64 20 65 6e 64 20 6f 66 20 66 69     pected end of fi
+  802f10:	6c 65 00 6e 6f 20 66 72 65 65 20 73 70 61 63 65     le.no free space
+  802f20:	20 6f 6e 20 64 69 73 6b 00 74 6f 6f 20 6d 61 6e      on disk.too man
+  802f30:	79 20 66 69 6c 65 73 20 61 72 65 20 6f 70 65 6e     y files are open
+  802f40:	00 66 69 6c 65 20 6f 72 20 62 6c 6f 63 6b 20 6e     .file or block n
+  802f50:	6f 74 20 66 6f 75 6e 64 00 69 6e 76 61 6c 69 64     ot found.invalid
+  802f60:	20 70 61 74 68 00 66 69 6c 65 20 61 6c 72 65 61      path.file alrea
+  802f70:	64 79 20 65 78 69 73 74 73 00 6f 70 65 72 61 74     dy exists.operat
+  802f80:	69 6f 6e 20 6e 6f 74 20 73 75 70 70 6f 72 74 65     ion not supporte
+  802f90:	64 00 6f 70 65 72 61 74 69 6f 6e 20 69 6e 74 65     d.operation inte
+  802fa0:	72 72 75 70 74 65 64 00 6e 6f 74 20 65 6e 6f 75     rrupted.not enou
+  802fb0:	67 68 20 43 50 55 20 74 69 6d 65 00 0f 1f 40 00     gh CPU time...@.
+  802fc0:	6c 1f 80 00 00 00 00 00 ad 25 80 00 00 00 00 00     l........%......
+  802fd0:	9d 25 80 00 00 00 00 00 ad 25 80 00 00 00 00 00     .%.......%......
+  802fe0:	ad 25 80 00 00 00 00 00 ad 25 80 00 00 00 00 00     .%.......%......
+  802ff0:	ad 25 80 00 00 00 00 00 8b 1f 80 00 00 00 00 00     .%..............
+  803000:	ad 25 80 00 00 00 00 00 ad 25 80 00 00 00 00 00     .%.......%......
+  803010:	7f 1f 80 00 00 00 00 00 f9 1f 80 00 00 00 00 00     ................
+  803020:	ad 25 80 00 00 00 00 00 7f 1f 80 00 00 00 00 00     .%..............
+  803030:	c5 1f 80 00 00 00 00 00 c5 1f 80 00 00 00 00 00     ................
+  803040:	c5 1f 80 00 00 00 00 00 c5 1f 80 00 00 00 00 00     ................
+  803050:	c5 1f 80 00 00 00 00 00 c5 1f 80 00 00 00 00 00     ................
+  803060:	c5 1f 80 00 00 00 00 00 c5 1f 80 00 00 00 00 00     ................
+  803070:	c5 1f 80 00 00 00 00 00 ad 25 80 00 00 00 00 00     .........%......
+  803080:	ad 25 80 00 00 00 00 00 ad 25 80 00 00 00 00 00     .%.......%......
+  803090:	ad 25 80 00 00 00 00 00 ad 25 80 00 00 00 00 00     .%.......%......
+  8030a0:	ad 25 80 00 00 00 00 00 ad 25 80 00 00 00 00 00     .%.......%......
+  8030b0:	ad 25 80 00 00 00 00 00 ad 25 80 00 00 00 00 00     .%.......%......
+  8030c0:	ad 25 80 00 00 00 00 00 ad 25 80 00 00 00 00 00     .%.......%......
+  8030d0:	ad 25 80 00 00 00 00 00 ad 25 80 00 00 00 00 00     .%.......%......
+  8030e0:	ad 25 80 00 00 00 00 00 ad 25 80 00 00 00 00 00     .%.......%......
+  8030f0:	ad 25 80 00 00 00 00 00 ad 25 80 00 00 00 00 00     .%.......%......
+  803100:	ad 25 80 00 00 00 00 00 ad 25 80 00 00 00 00 00     .%.......%......
+  803110:	ad 25 80 00 00 00 00 00 ad 25 80 00 00 00 00 00     .%.......%......
+  803120:	ad 25 80 00 00 00 00 00 ad 25 80 00 00 00 00 00     .%.......%......
+  803130:	ad 25 80 00 00 00 00 00 ad 25 80 00 00 00 00 00     .%.......%......
+  803140:	ad 25 80 00 00 00 00 00 ad 25 80 00 00 00 00 00     .%.......%......
+  803150:	ad 25 80 00 00 00 00 00 ad 25 80 00 00 00 00 00     .%.......%......
+  803160:	ad 25 80 00 00 00 00 00 d0 24 80 00 00 00 00 00     .%.......$......
+  803170:	ad 25 80 00 00 00 00 00 ad 25 80 00 00 00 00 00     .%.......%......
+  803180:	ad 25 80 00 00 00 00 00 ad 25 80 00 00 00 00 00     .%.......%......
+  803190:	ad 25 80 00 00 00 00 00 ad 25 80 00 00 00 00 00     .%.......%......
+  8031a0:	ad 25 80 00 00 00 00 00 ad 25 80 00 00 00 00 00     .%.......%......
+  8031b0:	ad 25 80 00 00 00 00 00 ad 25 80 00 00 00 00 00     .%.......%......
+  8031c0:	1c 20 80 00 00 00 00 00 eb 21 80 00 00 00 00 00     . .......!......
+  8031d0:	ad 25 80 00 00 00 00 00 ad 25 80 00 00 00 00 00     .%.......%......
+  8031e0:	ad 25 80 00 00 00 00 00 ad 25 80 00 00 00 00 00     .%.......%......
+  8031f0:	4b 20 80 00 00 00 00 00 ad 25 80 00 00 00 00 00     K .......%......
+  803200:	ad 25 80 00 00 00 00 00 11 20 80 00 00 00 00 00     .%....... ......
+  803210:	ad 25 80 00 00 00 00 00 ad 25 80 00 00 00 00 00     .%.......%......
+  803220:	93 23 80 00 00 00 00 00 5d 24 80 00 00 00 00 00     .#......]$......
+  803230:	ad 25 80 00 00 00 00 00 ad 25 80 00 00 00 00 00     .%.......%......
+  803240:	e2 20 80 00 00 00 00 00 ad 25 80 00 00 00 00 00     . .......%......
+  803250:	bf 22 80 00 00 00 00 00 ad 25 80 00 00 00 00 00     .".......%......
+  803260:	ad 25 80 00 00 00 00 00 d0 24 80 00 00 00 00 00     .%.......$......
+  803270:	ad 25 80 00 00 00 00 00 75 1f 80 00 00 00 00 00     .%......u.......
+
+0000000000803280 <error_string>:
+	...
+  803288:	35 2e 80 00 00 00 00 00 47 2e 80 00 00 00 00 00     5.......G.......
+  803298:	57 2e 80 00 00 00 00 00 69 2e 80 00 00 00 00 00     W.......i.......
+  8032a8:	77 2e 80 00 00 00 00 00 8b 2e 80 00 00 00 00 00     w...............
+  8032b8:	a0 2e 80 00 00 00 00 00 b3 2e 80 00 00 00 00 00     ................
+  8032c8:	c5 2e 80 00 00 00 00 00 d9 2e 80 00 00 00 00 00     ................
+  8032d8:	e9 2e 80 00 00 00 00 00 fc 2e 80 00 00 00 00 00     ................
+  8032e8:	13 2f 80 00 00 00 00 00 29 2f 80 00 00 00 00 00     ./......)/......
+  8032f8:	41 2f 80 00 00 00 00 00 59 2f 80 00 00 00 00 00     A/......Y/......
+  803308:	66 2f 80 00 00 00 00 00 30 33 80 00 00 00 00 00     f/......03......
+  803318:	7a 2f 80 00 00 00 00 00 92 2f 80 00 00 00 00 00     z/......./......
+  803328:	a8 2f 80 00 00 00 00 00 66 69 6c 65 20 69 73 20     ./......file is 
+  803338:	6e 6f 74 20 61 20 76 61 6c 69 64 20 65 78 65 63     not a valid exec
+  803348:	75 74 61 62 6c 65 00 73 79 73 5f 69 70 63 5f 74     utable.sys_ipc_t
+  803358:	72 79 5f 73 65 6e 64 20 66 61 69 6c 65 64 3a 20     ry_send failed: 
+  803368:	25 69 00 6c 69 62 2f 69 70 63 2e 63 00 66 2e 0f     %i.lib/ipc.c.f..
+  803378:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803388:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803398:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8033a8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8033b8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8033c8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8033d8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8033e8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8033f8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803408:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803418:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803428:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803438:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803448:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803458:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803468:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803478:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803488:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803498:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8034a8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8034b8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8034c8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8034d8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8034e8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8034f8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803508:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803518:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803528:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803538:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803548:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803558:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803568:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803578:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803588:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803598:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8035a8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8035b8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8035c8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8035d8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8035e8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8035f8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803608:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803618:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803628:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803638:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803648:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803658:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803668:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803678:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803688:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803698:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8036a8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8036b8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8036c8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8036d8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8036e8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8036f8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803708:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803718:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803728:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803738:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803748:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803758:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803768:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803778:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803788:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803798:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8037a8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8037b8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8037c8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8037d8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8037e8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8037f8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803808:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803818:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803828:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803838:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803848:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803858:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803868:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803878:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803888:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803898:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8038a8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8038b8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8038c8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8038d8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8038e8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8038f8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803908:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803918:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803928:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803938:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803948:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803958:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803968:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803978:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803988:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803998:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8039a8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8039b8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8039c8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8039d8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8039e8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8039f8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803a08:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803a18:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803a28:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803a38:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803a48:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803a58:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803a68:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803a78:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803a88:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803a98:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803aa8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803ab8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803ac8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803ad8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803ae8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803af8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803b08:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803b18:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803b28:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803b38:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803b48:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803b58:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803b68:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803b78:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803b88:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803b98:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803ba8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803bb8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803bc8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803bd8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803be8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803bf8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803c08:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803c18:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803c28:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803c38:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803c48:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803c58:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803c68:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803c78:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803c88:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803c98:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803ca8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803cb8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803cc8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803cd8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803ce8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803cf8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803d08:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803d18:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803d28:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803d38:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803d48:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803d58:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803d68:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803d78:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803d88:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803d98:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803da8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803db8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803dc8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803dd8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803de8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803df8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803e08:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803e18:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803e28:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803e38:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803e48:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803e58:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803e68:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803e78:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803e88:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803e98:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803ea8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803eb8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803ec8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803ed8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803ee8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803ef8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803f08:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803f18:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803f28:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803f38:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803f48:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803f58:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803f68:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803f78:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803f88:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803f98:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803fa8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803fb8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803fc8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803fd8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803fe8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803ff8:	1f 84 00 00 00 00 00 90                             ........
@@ -0,0 +1,6012 @@
+
+obj/user/ctxswitch:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 86 01 00 00       	call   8001a9 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+
+#define ROUNDS 10000
+#define WARMUP 100
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 56                	push   %r14
+  80002b:	41 55                	push   %r13
+  80002d:	41 54                	push   %r12
+  80002f:	53                   	push   %rbx
+  800030:	48 83 ec 10          	sub    $0x10,%rsp
+    envid_t who;
+
+    if ((who = fork()) != 0) {
+  800034:	48 b8 32 16 80 00 00 	movabs $0x801632,%rax
+  80003b:	00 00 00 
+  80003e:	ff d0                	call   *%rax
+  800040:	89 45 dc             	mov    %eax,-0x24(%rbp)
+                ROUNDS, (unsigned long)(cycles / ROUNDS));
+        return;
+    }
+
+    while (1) {
+        uint32_t i = ipc_recv(&who, 0, 0, 0);
+  800043:	48 bb 96 17 80 00 00 	movabs $0x801796,%rbx
+  80004a:	00 00 00 
+        if (i == WARMUP + ROUNDS) return;
+        ipc_send(who, i, 0, 0, 0);
+  80004d:	49 bc 6b 18 80 00 00 	movabs $0x80186b,%r12
+  800054:	00 00 00 
+    if ((who = fork()) != 0) {
+  800057:	85 c0                	test   %eax,%eax
+  800059:	0f 84 14 01 00 00    	je     800173 <umain+0x14e>
+        for (uint32_t i = 0; i < WARMUP + ROUNDS; i++) {
+  80005f:	bb 00 00 00 00       	mov    $0x0,%ebx
+        uint64_t start = 0;
+  800064:	41 be 00 00 00 00    	mov    $0x0,%r14d
+            ipc_send(who, i, 0, 0, 0);
+  80006a:	49 bd 6b 18 80 00 00 	movabs $0x80186b,%r13
+  800071:	00 00 00 
+            ipc_recv(&who, 0, 0, 0);
+  800074:	49 bc 96 17 80 00 00 	movabs $0x801796,%r12
+  80007b:	00 00 00 
+  80007e:	eb 3f                	jmp    8000bf <umain+0x9a>
+}
+
+static inline uint64_t __attribute__((always_inline))
+read_tsc(void) {
+    uint32_t lo, hi;
+    asm volatile("rdtsc"
+  800080:	0f 31                	rdtsc
+                 : "=a"(lo), "=d"(hi));
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  800082:	48 c1 e2 20          	shl    $0x20,%rdx
+  800086:	89 c0                	mov    %eax,%eax
+  800088:	48 09 c2             	or     %rax,%rdx
+  80008b:	49 89 d6             	mov    %rdx,%r14
+            ipc_send(who, i, 0, 0, 0);
+  80008e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800094:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800099:	ba 00 00 00 00       	mov    $0x0,%edx
+  80009e:	89 de                	mov    %ebx,%esi
+  8000a0:	8b 7d dc             	mov    -0x24(%rbp),%edi
+  8000a3:	41 ff d5             	call   *%r13
+            ipc_recv(&who, 0, 0, 0);
+  8000a6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8000ab:	ba 00 00 00 00       	mov    $0x0,%edx
+  8000b0:	be 00 00 00 00       	mov    $0x0,%esi
+  8000b5:	48 8d 7d dc          	lea    -0x24(%rbp),%rdi
+  8000b9:	41 ff d4             	call   *%r12
+        for (uint32_t i = 0; i < WARMUP + ROUNDS; i++) {
+  8000bc:	83 c3 01             	add    $0x1,%ebx
+            if (i == WARMUP) start = read_tsc();
+  8000bf:	83 fb 64             	cmp    $0x64,%ebx
+  8000c2:	74 bc                	je     800080 <umain+0x5b>
+            ipc_send(who, i, 0, 0, 0);
+  8000c4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8000ca:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8000cf:	ba 00 00 00 00       	mov    $0x0,%edx
+  8000d4:	89 de                	mov    %ebx,%esi
+  8000d6:	8b 7d dc             	mov    -0x24(%rbp),%edi
+  8000d9:	41 ff d5             	call   *%r13
+            ipc_recv(&who, 0, 0, 0);
+  8000dc:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8000e1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8000e6:	be 00 00 00 00       	mov    $0x0,%esi
+  8000eb:	48 8d 7d dc          	lea    -0x24(%rbp),%rdi
+  8000ef:	41 ff d4             	call   *%r12
+        for (uint32_t i = 0; i < WARMUP + ROUNDS; i++) {
+  8000f2:	83 c3 01             	add    $0x1,%ebx
+  8000f5:	81 fb 74 27 00 00    	cmp    $0x2774,%ebx
+  8000fb:	75 c2                	jne    8000bf <umain+0x9a>
+    asm volatile("rdtsc"
+  8000fd:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  8000ff:	48 c1 e2 20          	shl    $0x20,%rdx
+  800103:	89 c0                	mov    %eax,%eax
+  800105:	48 09 c2             	or     %rax,%rdx
+        uint64_t cycles = read_tsc() - start;
+  800108:	4c 29 f2             	sub    %r14,%rdx
+  80010b:	48 89 d3             	mov    %rdx,%rbx
+        ipc_send(who, WARMUP + ROUNDS, 0, 0, 0);
+  80010e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800114:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800119:	ba 00 00 00 00       	mov    $0x0,%edx
+  80011e:	be 74 27 00 00       	mov    $0x2774,%esi
+  800123:	8b 7d dc             	mov    -0x24(%rbp),%edi
+  800126:	48 b8 6b 18 80 00 00 	movabs $0x80186b,%rax
+  80012d:	00 00 00 
+  800130:	ff d0                	call   *%rax
+                ROUNDS, (unsigned long)(cycles / ROUNDS));
+  800132:	48 ba 4b 59 86 38 d6 	movabs $0x346dc5d63886594b,%rdx
+  800139:	c5 6d 34 
+  80013c:	48 89 d8             	mov    %rbx,%rax
+  80013f:	48 f7 e2             	mul    %rdx
+  800142:	48 c1 ea 0b          	shr    $0xb,%rdx
+        cprintf("ctxswitch: %d round trips, %lu cycles per round trip\n",
+  800146:	be 10 27 00 00       	mov    $0x2710,%esi
+  80014b:	48 bf 58 2f 80 00 00 	movabs $0x802f58,%rdi
+  800152:	00 00 00 
+  800155:	b8 00 00 00 00       	mov    $0x0,%eax
+  80015a:	48 b9 22 03 80 00 00 	movabs $0x800322,%rcx
+  800161:	00 00 00 
+  800164:	ff d1                	call   *%rcx
+    }
+}
+  800166:	48 83 c4 10          	add    $0x10,%rsp
+  80016a:	5b                   	pop    %rbx
+  80016b:	41 5c                	pop    %r12
+  80016d:	41 5d                	pop    %r13
+  80016f:	41 5e                	pop    %r14
+  800171:	5d                   	pop    %rbp
+  800172:	c3                   	ret
+        uint32_t i = ipc_recv(&who, 0, 0, 0);
+  800173:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800178:	ba 00 00 00 00       	mov    $0x0,%edx
+  80017d:	be 00 00 00 00       	mov    $0x0,%esi
+  800182:	48 8d 7d dc          	lea    -0x24(%rbp),%rdi
+  800186:	ff d3                	call   *%rbx
+  800188:	89 c6                	mov    %eax,%esi
+        if (i == WARMUP + ROUNDS) return;
+  80018a:	3d 74 27 00 00       	cmp    $0x2774,%eax
+  80018f:	74 d5                	je     800166 <umain+0x141>
+        ipc_send(who, i, 0, 0, 0);
+  800191:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800197:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80019c:	ba 00 00 00 00       	mov    $0x0,%edx
+  8001a1:	8b 7d dc             	mov    -0x24(%rbp),%edi
+  8001a4:	41 ff d4             	call   *%r12
+    while (1) {
+  8001a7:	eb ca                	jmp    800173 <umain+0x14e>
+
+00000000008001a9 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  8001a9:	55                   	push   %rbp
+  8001aa:	48 89 e5             	mov    %rsp,%rbp
+  8001ad:	41 56                	push   %r14
+  8001af:	41 55                	push   %r13
+  8001b1:	41 54                	push   %r12
+  8001b3:	53                   	push   %rbx
+  8001b4:	41 89 fd             	mov    %edi,%r13d
+  8001b7:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  8001ba:	48 ba d8 40 80 00 00 	movabs $0x8040d8,%rdx
+  8001c1:	00 00 00 
+  8001c4:	48 b8 d8 40 80 00 00 	movabs $0x8040d8,%rax
+  8001cb:	00 00 00 
+  8001ce:	48 39 c2             	cmp    %rax,%rdx
+  8001d1:	73 17                	jae    8001ea <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  8001d3:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  8001d6:	49 89 c4             	mov    %rax,%r12
+  8001d9:	48 83 c3 08          	add    $0x8,%rbx
+  8001dd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001e2:	ff 53 f8             	call   *-0x8(%rbx)
+  8001e5:	4c 39 e3             	cmp    %r12,%rbx
+  8001e8:	72 ef                	jb     8001d9 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+    envid_t this_env_id = sys_getenvid();
+  8001ea:	48 b8 37 11 80 00 00 	movabs $0x801137,%rax
+  8001f1:	00 00 00 
+  8001f4:	ff d0                	call   *%rax
+    thisenv = &((struct Env*)UENVS)[ENVX(this_env_id)];
+  8001f6:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8001fb:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+  800202:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  800209:	00 00 00 
+  80020c:	48 01 d0             	add    %rdx,%rax
+  80020f:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  800216:	00 00 00 
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  800219:	45 85 ed             	test   %r13d,%r13d
+  80021c:	7e 0d                	jle    80022b <libmain+0x82>
+  80021e:	49 8b 06             	mov    (%r14),%rax
+  800221:	48 a3 00 40 80 00 00 	movabs %rax,0x804000
+  800228:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  80022b:	4c 89 f6             	mov    %r14,%rsi
+  80022e:	44 89 ef             	mov    %r13d,%edi
+  800231:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  800238:	00 00 00 
+  80023b:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  80023d:	48 b8 52 02 80 00 00 	movabs $0x800252,%rax
+  800244:	00 00 00 
+  800247:	ff d0                	call   *%rax
+#endif
+}
+  800249:	5b                   	pop    %rbx
+  80024a:	41 5c                	pop    %r12
+  80024c:	41 5d                	pop    %r13
+  80024e:	41 5e                	pop    %r14
+  800250:	5d                   	pop    %rbp
+  800251:	c3                   	ret
+
+0000000000800252 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  800252:	55                   	push   %rbp
+  800253:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  800256:	48 b8 b7 1b 80 00 00 	movabs $0x801bb7,%rax
+  80025d:	00 00 00 
+  800260:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  800262:	bf 00 00 00 00       	mov    $0x0,%edi
+  800267:	48 b8 cc 10 80 00 00 	movabs $0x8010cc,%rax
+  80026e:	00 00 00 
+  800271:	ff d0                	call   *%rax
+}
+  800273:	5d                   	pop    %rbp
+  800274:	c3                   	ret
+
+0000000000800275 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  800275:	55                   	push   %rbp
+  800276:	48 89 e5             	mov    %rsp,%rbp
+  800279:	53                   	push   %rbx
+  80027a:	48 83 ec 08          	sub    $0x8,%rsp
+  80027e:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  800281:	8b 06                	mov    (%rsi),%eax
+  800283:	8d 50 01             	lea    0x1(%rax),%edx
+  800286:	89 16                	mov    %edx,(%rsi)
+  800288:	48 98                	cltq
+  80028a:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  80028f:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  800295:	74 0a                	je     8002a1 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  800297:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  80029b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80029f:	c9                   	leave
+  8002a0:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  8002a1:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  8002a5:	be ff 00 00 00       	mov    $0xff,%esi
+  8002aa:	48 b8 6e 10 80 00 00 	movabs $0x80106e,%rax
+  8002b1:	00 00 00 
+  8002b4:	ff d0                	call   *%rax
+        state->offset = 0;
+  8002b6:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  8002bc:	eb d9                	jmp    800297 <putch+0x22>
+
+00000000008002be <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  8002be:	55                   	push   %rbp
+  8002bf:	48 89 e5             	mov    %rsp,%rbp
+  8002c2:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  8002c9:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  8002cc:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  8002d3:	b9 21 00 00 00       	mov    $0x21,%ecx
+  8002d8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002dd:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  8002e0:	48 89 f1             	mov    %rsi,%rcx
+  8002e3:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  8002ea:	48 bf 75 02 80 00 00 	movabs $0x800275,%rdi
+  8002f1:	00 00 00 
+  8002f4:	48 b8 72 04 80 00 00 	movabs $0x800472,%rax
+  8002fb:	00 00 00 
+  8002fe:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  800300:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  800307:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  80030e:	48 b8 6e 10 80 00 00 	movabs $0x80106e,%rax
+  800315:	00 00 00 
+  800318:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  80031a:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  800320:	c9                   	leave
+  800321:	c3                   	ret
+
+0000000000800322 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  800322:	55                   	push   %rbp
+  800323:	48 89 e5             	mov    %rsp,%rbp
+  800326:	48 83 ec 50          	sub    $0x50,%rsp
+  80032a:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  80032e:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  800332:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800336:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80033a:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  80033e:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  800345:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800349:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80034d:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800351:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  800355:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  800359:	48 b8 be 02 80 00 00 	movabs $0x8002be,%rax
+  800360:	00 00 00 
+  800363:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  800365:	c9                   	leave
+  800366:	c3                   	ret
+
+0000000000800367 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  800367:	55                   	push   %rbp
+  800368:	48 89 e5             	mov    %rsp,%rbp
+  80036b:	41 57                	push   %r15
+  80036d:	41 56                	push   %r14
+  80036f:	41 55                	push   %r13
+  800371:	41 54                	push   %r12
+  800373:	53                   	push   %rbx
+  800374:	48 83 ec 18          	sub    $0x18,%rsp
+  800378:	49 89 fc             	mov    %rdi,%r12
+  80037b:	49 89 f5             	mov    %rsi,%r13
+  80037e:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800382:	8b 45 10             	mov    0x10(%rbp),%eax
+  800385:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  800388:	41 89 cf             	mov    %ecx,%r15d
+  80038b:	4c 39 fa             	cmp    %r15,%rdx
+  80038e:	73 5b                	jae    8003eb <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  800390:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  800394:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  800398:	85 db                	test   %ebx,%ebx
+  80039a:	7e 0e                	jle    8003aa <print_num+0x43>
+            putch(padc, put_arg);
+  80039c:	4c 89 ee             	mov    %r13,%rsi
+  80039f:	44 89 f7             	mov    %r14d,%edi
+  8003a2:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  8003a5:	83 eb 01             	sub    $0x1,%ebx
+  8003a8:	75 f2                	jne    80039c <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  8003aa:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  8003ae:	48 b9 a9 2f 80 00 00 	movabs $0x802fa9,%rcx
+  8003b5:	00 00 00 
+  8003b8:	48 b8 98 2f 80 00 00 	movabs $0x802f98,%rax
+  8003bf:	00 00 00 
+  8003c2:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  8003c6:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8003ca:	ba 00 00 00 00       	mov    $0x0,%edx
+  8003cf:	49 f7 f7             	div    %r15
+  8003d2:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  8003d6:	4c 89 ee             	mov    %r13,%rsi
+  8003d9:	41 ff d4             	call   *%r12
+}
+  8003dc:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8003e0:	5b                   	pop    %rbx
+  8003e1:	41 5c                	pop    %r12
+  8003e3:	41 5d                	pop    %r13
+  8003e5:	41 5e                	pop    %r14
+  8003e7:	41 5f                	pop    %r15
+  8003e9:	5d                   	pop    %rbp
+  8003ea:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  8003eb:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8003ef:	ba 00 00 00 00       	mov    $0x0,%edx
+  8003f4:	49 f7 f7             	div    %r15
+  8003f7:	48 83 ec 08          	sub    $0x8,%rsp
+  8003fb:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  8003ff:	52                   	push   %rdx
+  800400:	45 0f be c9          	movsbl %r9b,%r9d
+  800404:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  800408:	48 89 c2             	mov    %rax,%rdx
+  80040b:	48 b8 67 03 80 00 00 	movabs $0x800367,%rax
+  800412:	00 00 00 
+  800415:	ff d0                	call   *%rax
+  800417:	48 83 c4 10          	add    $0x10,%rsp
+  80041b:	eb 8d                	jmp    8003aa <print_num+0x43>
+
+000000000080041d <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  80041d:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  800421:	48 8b 06             	mov    (%rsi),%rax
+  800424:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  800428:	73 0a                	jae    800434 <sprintputch+0x17>
+        *state->start++ = ch;
+  80042a:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80042e:	48 89 16             	mov    %rdx,(%rsi)
+  800431:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  800434:	c3                   	ret
+
+0000000000800435 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  800435:	55                   	push   %rbp
+  800436:	48 89 e5             	mov    %rsp,%rbp
+  800439:	48 83 ec 50          	sub    $0x50,%rsp
+  80043d:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800441:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800445:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  800449:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800450:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800454:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800458:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80045c:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  800460:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800464:	48 b8 72 04 80 00 00 	movabs $0x800472,%rax
+  80046b:	00 00 00 
+  80046e:	ff d0                	call   *%rax
+}
+  800470:	c9                   	leave
+  800471:	c3                   	ret
+
+0000000000800472 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  800472:	55                   	push   %rbp
+  800473:	48 89 e5             	mov    %rsp,%rbp
+  800476:	41 57                	push   %r15
+  800478:	41 56                	push   %r14
+  80047a:	41 55                	push   %r13
+  80047c:	41 54                	push   %r12
+  80047e:	53                   	push   %rbx
+  80047f:	48 83 ec 38          	sub    $0x38,%rsp
+  800483:	49 89 fe             	mov    %rdi,%r14
+  800486:	49 89 f5             	mov    %rsi,%r13
+  800489:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  80048c:	48 8b 01             	mov    (%rcx),%rax
+  80048f:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  800493:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800497:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80049b:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  80049f:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  8004a3:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  8004a7:	0f b6 3b             	movzbl (%rbx),%edi
+  8004aa:	40 80 ff 25          	cmp    $0x25,%dil
+  8004ae:	74 18                	je     8004c8 <vprintfmt+0x56>
+            if (!ch) return;
+  8004b0:	40 84 ff             	test   %dil,%dil
+  8004b3:	0f 84 b1 06 00 00    	je     800b6a <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  8004b9:	40 0f b6 ff          	movzbl %dil,%edi
+  8004bd:	4c 89 ee             	mov    %r13,%rsi
+  8004c0:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  8004c3:	4c 89 e3             	mov    %r12,%rbx
+  8004c6:	eb db                	jmp    8004a3 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  8004c8:	be 00 00 00 00       	mov    $0x0,%esi
+  8004cd:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  8004d1:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  8004d6:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8004dc:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  8004e3:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8004e7:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  8004ec:	41 0f b6 04 24       	movzbl (%r12),%eax
+  8004f1:	88 45 a0             	mov    %al,-0x60(%rbp)
+  8004f4:	83 e8 23             	sub    $0x23,%eax
+  8004f7:	3c 57                	cmp    $0x57,%al
+  8004f9:	0f 87 51 06 00 00    	ja     800b50 <vprintfmt+0x6de>
+  8004ff:	0f b6 c0             	movzbl %al,%eax
+  800502:	48 b9 60 31 80 00 00 	movabs $0x803160,%rcx
+  800509:	00 00 00 
+  80050c:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  80050f:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  800512:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  800516:	eb cf                	jmp    8004e7 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  800518:	49 89 dc             	mov    %rbx,%r12
+  80051b:	be 01 00 00 00       	mov    $0x1,%esi
+  800520:	eb c5                	jmp    8004e7 <vprintfmt+0x75>
+            padc = ch;
+  800522:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  800526:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800529:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80052c:	eb b9                	jmp    8004e7 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  80052e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800531:	83 f8 2f             	cmp    $0x2f,%eax
+  800534:	77 24                	ja     80055a <vprintfmt+0xe8>
+  800536:	89 c1                	mov    %eax,%ecx
+  800538:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  80053c:	83 c0 08             	add    $0x8,%eax
+  80053f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800542:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  800545:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  800548:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  80054c:	79 99                	jns    8004e7 <vprintfmt+0x75>
+                width = precision;
+  80054e:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  800552:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800558:	eb 8d                	jmp    8004e7 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  80055a:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80055e:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  800562:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800566:	eb da                	jmp    800542 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  800568:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  80056d:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800571:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  800577:	3c 39                	cmp    $0x39,%al
+  800579:	77 1c                	ja     800597 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  80057b:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  80057f:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  800583:	0f b6 c0             	movzbl %al,%eax
+  800586:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  80058b:	0f b6 03             	movzbl (%rbx),%eax
+  80058e:	3c 39                	cmp    $0x39,%al
+  800590:	76 e9                	jbe    80057b <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  800592:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  800595:	eb b1                	jmp    800548 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  800597:	49 89 dc             	mov    %rbx,%r12
+  80059a:	eb ac                	jmp    800548 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  80059c:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  80059f:	85 c9                	test   %ecx,%ecx
+  8005a1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005a6:	0f 49 c1             	cmovns %ecx,%eax
+  8005a9:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  8005ac:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8005af:	e9 33 ff ff ff       	jmp    8004e7 <vprintfmt+0x75>
+            lflag++;
+  8005b4:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  8005b7:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8005ba:	e9 28 ff ff ff       	jmp    8004e7 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  8005bf:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8005c2:	83 f8 2f             	cmp    $0x2f,%eax
+  8005c5:	77 19                	ja     8005e0 <vprintfmt+0x16e>
+  8005c7:	89 c2                	mov    %eax,%edx
+  8005c9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8005cd:	83 c0 08             	add    $0x8,%eax
+  8005d0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8005d3:	8b 3a                	mov    (%rdx),%edi
+  8005d5:	4c 89 ee             	mov    %r13,%rsi
+  8005d8:	41 ff d6             	call   *%r14
+            break;
+  8005db:	e9 c3 fe ff ff       	jmp    8004a3 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  8005e0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8005e4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8005e8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8005ec:	eb e5                	jmp    8005d3 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  8005ee:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8005f1:	83 f8 2f             	cmp    $0x2f,%eax
+  8005f4:	77 5a                	ja     800650 <vprintfmt+0x1de>
+  8005f6:	89 c2                	mov    %eax,%edx
+  8005f8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8005fc:	83 c0 08             	add    $0x8,%eax
+  8005ff:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  800602:	8b 02                	mov    (%rdx),%eax
+  800604:	89 c1                	mov    %eax,%ecx
+  800606:	f7 d9                	neg    %ecx
+  800608:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  80060b:	83 f9 15             	cmp    $0x15,%ecx
+  80060e:	7f 4e                	jg     80065e <vprintfmt+0x1ec>
+  800610:	48 63 c1             	movslq %ecx,%rax
+  800613:	48 ba 20 34 80 00 00 	movabs $0x803420,%rdx
+  80061a:	00 00 00 
+  80061d:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  800621:	48 85 c0             	test   %rax,%rax
+  800624:	74 38                	je     80065e <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  800626:	48 89 c1             	mov    %rax,%rcx
+  800629:	48 ba 39 36 80 00 00 	movabs $0x803639,%rdx
+  800630:	00 00 00 
+  800633:	4c 89 ee             	mov    %r13,%rsi
+  800636:	4c 89 f7             	mov    %r14,%rdi
+  800639:	b8 00 00 00 00       	mov    $0x0,%eax
+  80063e:	49 b8 35 04 80 00 00 	movabs $0x800435,%r8
+  800645:	00 00 00 
+  800648:	41 ff d0             	call   *%r8
+  80064b:	e9 53 fe ff ff       	jmp    8004a3 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  800650:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800654:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800658:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80065c:	eb a4                	jmp    800602 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  80065e:	48 ba c1 2f 80 00 00 	movabs $0x802fc1,%rdx
+  800665:	00 00 00 
+  800668:	4c 89 ee             	mov    %r13,%rsi
+  80066b:	4c 89 f7             	mov    %r14,%rdi
+  80066e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800673:	49 b8 35 04 80 00 00 	movabs $0x800435,%r8
+  80067a:	00 00 00 
+  80067d:	41 ff d0             	call   *%r8
+  800680:	e9 1e fe ff ff       	jmp    8004a3 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800685:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800688:	83 f8 2f             	cmp    $0x2f,%eax
+  80068b:	77 6c                	ja     8006f9 <vprintfmt+0x287>
+  80068d:	89 c2                	mov    %eax,%edx
+  80068f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800693:	83 c0 08             	add    $0x8,%eax
+  800696:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800699:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  80069c:	48 85 d2             	test   %rdx,%rdx
+  80069f:	48 b8 ba 2f 80 00 00 	movabs $0x802fba,%rax
+  8006a6:	00 00 00 
+  8006a9:	48 0f 45 c2          	cmovne %rdx,%rax
+  8006ad:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  8006b1:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8006b5:	7e 06                	jle    8006bd <vprintfmt+0x24b>
+  8006b7:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  8006bb:	75 4a                	jne    800707 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8006bd:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8006c1:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8006c5:	0f b6 00             	movzbl (%rax),%eax
+  8006c8:	84 c0                	test   %al,%al
+  8006ca:	0f 85 9a 00 00 00    	jne    80076a <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  8006d0:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8006d3:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  8006d7:	85 c0                	test   %eax,%eax
+  8006d9:	0f 8e c4 fd ff ff    	jle    8004a3 <vprintfmt+0x31>
+  8006df:	4c 89 ee             	mov    %r13,%rsi
+  8006e2:	bf 20 00 00 00       	mov    $0x20,%edi
+  8006e7:	41 ff d6             	call   *%r14
+  8006ea:	41 83 ec 01          	sub    $0x1,%r12d
+  8006ee:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  8006f2:	75 eb                	jne    8006df <vprintfmt+0x26d>
+  8006f4:	e9 aa fd ff ff       	jmp    8004a3 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8006f9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8006fd:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800701:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800705:	eb 92                	jmp    800699 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  800707:	49 63 f7             	movslq %r15d,%rsi
+  80070a:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  80070e:	48 b8 24 0c 80 00 00 	movabs $0x800c24,%rax
+  800715:	00 00 00 
+  800718:	ff d0                	call   *%rax
+  80071a:	48 89 c2             	mov    %rax,%rdx
+  80071d:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800720:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  800722:	8d 70 ff             	lea    -0x1(%rax),%esi
+  800725:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  800728:	85 c0                	test   %eax,%eax
+  80072a:	7e 91                	jle    8006bd <vprintfmt+0x24b>
+  80072c:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  800731:	4c 89 ee             	mov    %r13,%rsi
+  800734:	44 89 e7             	mov    %r12d,%edi
+  800737:	41 ff d6             	call   *%r14
+  80073a:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  80073e:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800741:	83 f8 ff             	cmp    $0xffffffff,%eax
+  800744:	75 eb                	jne    800731 <vprintfmt+0x2bf>
+  800746:	e9 72 ff ff ff       	jmp    8006bd <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  80074b:	0f b6 f8             	movzbl %al,%edi
+  80074e:	4c 89 ee             	mov    %r13,%rsi
+  800751:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800754:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800758:	49 83 c4 01          	add    $0x1,%r12
+  80075c:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  800762:	84 c0                	test   %al,%al
+  800764:	0f 84 66 ff ff ff    	je     8006d0 <vprintfmt+0x25e>
+  80076a:	45 85 ff             	test   %r15d,%r15d
+  80076d:	78 0a                	js     800779 <vprintfmt+0x307>
+  80076f:	41 83 ef 01          	sub    $0x1,%r15d
+  800773:	0f 88 57 ff ff ff    	js     8006d0 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800779:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  80077d:	74 cc                	je     80074b <vprintfmt+0x2d9>
+  80077f:	8d 50 e0             	lea    -0x20(%rax),%edx
+  800782:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800787:	80 fa 5e             	cmp    $0x5e,%dl
+  80078a:	77 c2                	ja     80074e <vprintfmt+0x2dc>
+  80078c:	eb bd                	jmp    80074b <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  80078e:	40 84 f6             	test   %sil,%sil
+  800791:	75 26                	jne    8007b9 <vprintfmt+0x347>
+    switch (lflag) {
+  800793:	85 d2                	test   %edx,%edx
+  800795:	74 59                	je     8007f0 <vprintfmt+0x37e>
+  800797:	83 fa 01             	cmp    $0x1,%edx
+  80079a:	74 7b                	je     800817 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  80079c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80079f:	83 f8 2f             	cmp    $0x2f,%eax
+  8007a2:	0f 87 96 00 00 00    	ja     80083e <vprintfmt+0x3cc>
+  8007a8:	89 c2                	mov    %eax,%edx
+  8007aa:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007ae:	83 c0 08             	add    $0x8,%eax
+  8007b1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007b4:	4c 8b 22             	mov    (%rdx),%r12
+  8007b7:	eb 17                	jmp    8007d0 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  8007b9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007bc:	83 f8 2f             	cmp    $0x2f,%eax
+  8007bf:	77 21                	ja     8007e2 <vprintfmt+0x370>
+  8007c1:	89 c2                	mov    %eax,%edx
+  8007c3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007c7:	83 c0 08             	add    $0x8,%eax
+  8007ca:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007cd:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  8007d0:	4d 85 e4             	test   %r12,%r12
+  8007d3:	78 7a                	js     80084f <vprintfmt+0x3dd>
+            num = i;
+  8007d5:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  8007d8:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  8007dd:	e9 50 02 00 00       	jmp    800a32 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8007e2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007e6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007ea:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007ee:	eb dd                	jmp    8007cd <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  8007f0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007f3:	83 f8 2f             	cmp    $0x2f,%eax
+  8007f6:	77 11                	ja     800809 <vprintfmt+0x397>
+  8007f8:	89 c2                	mov    %eax,%edx
+  8007fa:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007fe:	83 c0 08             	add    $0x8,%eax
+  800801:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800804:	4c 63 22             	movslq (%rdx),%r12
+  800807:	eb c7                	jmp    8007d0 <vprintfmt+0x35e>
+  800809:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80080d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800811:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800815:	eb ed                	jmp    800804 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  800817:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80081a:	83 f8 2f             	cmp    $0x2f,%eax
+  80081d:	77 11                	ja     800830 <vprintfmt+0x3be>
+  80081f:	89 c2                	mov    %eax,%edx
+  800821:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800825:	83 c0 08             	add    $0x8,%eax
+  800828:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80082b:	4c 8b 22             	mov    (%rdx),%r12
+  80082e:	eb a0                	jmp    8007d0 <vprintfmt+0x35e>
+  800830:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800834:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800838:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80083c:	eb ed                	jmp    80082b <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  80083e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800842:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800846:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80084a:	e9 65 ff ff ff       	jmp    8007b4 <vprintfmt+0x342>
+                putch('-', put_arg);
+  80084f:	4c 89 ee             	mov    %r13,%rsi
+  800852:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800857:	41 ff d6             	call   *%r14
+                i = -i;
+  80085a:	49 f7 dc             	neg    %r12
+  80085d:	e9 73 ff ff ff       	jmp    8007d5 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  800862:	40 84 f6             	test   %sil,%sil
+  800865:	75 32                	jne    800899 <vprintfmt+0x427>
+    switch (lflag) {
+  800867:	85 d2                	test   %edx,%edx
+  800869:	74 5d                	je     8008c8 <vprintfmt+0x456>
+  80086b:	83 fa 01             	cmp    $0x1,%edx
+  80086e:	0f 84 82 00 00 00    	je     8008f6 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  800874:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800877:	83 f8 2f             	cmp    $0x2f,%eax
+  80087a:	0f 87 a5 00 00 00    	ja     800925 <vprintfmt+0x4b3>
+  800880:	89 c2                	mov    %eax,%edx
+  800882:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800886:	83 c0 08             	add    $0x8,%eax
+  800889:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80088c:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  80088f:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  800894:	e9 99 01 00 00       	jmp    800a32 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800899:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80089c:	83 f8 2f             	cmp    $0x2f,%eax
+  80089f:	77 19                	ja     8008ba <vprintfmt+0x448>
+  8008a1:	89 c2                	mov    %eax,%edx
+  8008a3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008a7:	83 c0 08             	add    $0x8,%eax
+  8008aa:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008ad:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8008b0:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8008b5:	e9 78 01 00 00       	jmp    800a32 <vprintfmt+0x5c0>
+  8008ba:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008be:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008c2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008c6:	eb e5                	jmp    8008ad <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  8008c8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008cb:	83 f8 2f             	cmp    $0x2f,%eax
+  8008ce:	77 18                	ja     8008e8 <vprintfmt+0x476>
+  8008d0:	89 c2                	mov    %eax,%edx
+  8008d2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008d6:	83 c0 08             	add    $0x8,%eax
+  8008d9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008dc:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  8008de:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  8008e3:	e9 4a 01 00 00       	jmp    800a32 <vprintfmt+0x5c0>
+  8008e8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008ec:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008f0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008f4:	eb e6                	jmp    8008dc <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  8008f6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008f9:	83 f8 2f             	cmp    $0x2f,%eax
+  8008fc:	77 19                	ja     800917 <vprintfmt+0x4a5>
+  8008fe:	89 c2                	mov    %eax,%edx
+  800900:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800904:	83 c0 08             	add    $0x8,%eax
+  800907:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80090a:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  80090d:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  800912:	e9 1b 01 00 00       	jmp    800a32 <vprintfmt+0x5c0>
+  800917:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80091b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80091f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800923:	eb e5                	jmp    80090a <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  800925:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800929:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80092d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800931:	e9 56 ff ff ff       	jmp    80088c <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  800936:	40 84 f6             	test   %sil,%sil
+  800939:	75 2e                	jne    800969 <vprintfmt+0x4f7>
+    switch (lflag) {
+  80093b:	85 d2                	test   %edx,%edx
+  80093d:	74 59                	je     800998 <vprintfmt+0x526>
+  80093f:	83 fa 01             	cmp    $0x1,%edx
+  800942:	74 7f                	je     8009c3 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  800944:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800947:	83 f8 2f             	cmp    $0x2f,%eax
+  80094a:	0f 87 9f 00 00 00    	ja     8009ef <vprintfmt+0x57d>
+  800950:	89 c2                	mov    %eax,%edx
+  800952:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800956:	83 c0 08             	add    $0x8,%eax
+  800959:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80095c:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  80095f:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  800964:	e9 c9 00 00 00       	jmp    800a32 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800969:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80096c:	83 f8 2f             	cmp    $0x2f,%eax
+  80096f:	77 19                	ja     80098a <vprintfmt+0x518>
+  800971:	89 c2                	mov    %eax,%edx
+  800973:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800977:	83 c0 08             	add    $0x8,%eax
+  80097a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80097d:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800980:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800985:	e9 a8 00 00 00       	jmp    800a32 <vprintfmt+0x5c0>
+  80098a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80098e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800992:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800996:	eb e5                	jmp    80097d <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  800998:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80099b:	83 f8 2f             	cmp    $0x2f,%eax
+  80099e:	77 15                	ja     8009b5 <vprintfmt+0x543>
+  8009a0:	89 c2                	mov    %eax,%edx
+  8009a2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009a6:	83 c0 08             	add    $0x8,%eax
+  8009a9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009ac:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  8009ae:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  8009b3:	eb 7d                	jmp    800a32 <vprintfmt+0x5c0>
+  8009b5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009b9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009bd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009c1:	eb e9                	jmp    8009ac <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  8009c3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009c6:	83 f8 2f             	cmp    $0x2f,%eax
+  8009c9:	77 16                	ja     8009e1 <vprintfmt+0x56f>
+  8009cb:	89 c2                	mov    %eax,%edx
+  8009cd:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009d1:	83 c0 08             	add    $0x8,%eax
+  8009d4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009d7:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8009da:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  8009df:	eb 51                	jmp    800a32 <vprintfmt+0x5c0>
+  8009e1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009e5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009e9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009ed:	eb e8                	jmp    8009d7 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  8009ef:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009f3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009f7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009fb:	e9 5c ff ff ff       	jmp    80095c <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  800a00:	4c 89 ee             	mov    %r13,%rsi
+  800a03:	bf 30 00 00 00       	mov    $0x30,%edi
+  800a08:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800a0b:	4c 89 ee             	mov    %r13,%rsi
+  800a0e:	bf 78 00 00 00       	mov    $0x78,%edi
+  800a13:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800a16:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a19:	83 f8 2f             	cmp    $0x2f,%eax
+  800a1c:	77 47                	ja     800a65 <vprintfmt+0x5f3>
+  800a1e:	89 c2                	mov    %eax,%edx
+  800a20:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a24:	83 c0 08             	add    $0x8,%eax
+  800a27:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a2a:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800a2d:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800a32:	48 83 ec 08          	sub    $0x8,%rsp
+  800a36:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800a3a:	0f 94 c0             	sete   %al
+  800a3d:	0f b6 c0             	movzbl %al,%eax
+  800a40:	50                   	push   %rax
+  800a41:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800a46:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800a4a:	4c 89 ee             	mov    %r13,%rsi
+  800a4d:	4c 89 f7             	mov    %r14,%rdi
+  800a50:	48 b8 67 03 80 00 00 	movabs $0x800367,%rax
+  800a57:	00 00 00 
+  800a5a:	ff d0                	call   *%rax
+            break;
+  800a5c:	48 83 c4 10          	add    $0x10,%rsp
+  800a60:	e9 3e fa ff ff       	jmp    8004a3 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800a65:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a69:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a6d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a71:	eb b7                	jmp    800a2a <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  800a73:	40 84 f6             	test   %sil,%sil
+  800a76:	75 2b                	jne    800aa3 <vprintfmt+0x631>
+    switch (lflag) {
+  800a78:	85 d2                	test   %edx,%edx
+  800a7a:	74 56                	je     800ad2 <vprintfmt+0x660>
+  800a7c:	83 fa 01             	cmp    $0x1,%edx
+  800a7f:	74 7f                	je     800b00 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800a81:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a84:	83 f8 2f             	cmp    $0x2f,%eax
+  800a87:	0f 87 a2 00 00 00    	ja     800b2f <vprintfmt+0x6bd>
+  800a8d:	89 c2                	mov    %eax,%edx
+  800a8f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a93:	83 c0 08             	add    $0x8,%eax
+  800a96:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a99:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800a9c:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800aa1:	eb 8f                	jmp    800a32 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800aa3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800aa6:	83 f8 2f             	cmp    $0x2f,%eax
+  800aa9:	77 19                	ja     800ac4 <vprintfmt+0x652>
+  800aab:	89 c2                	mov    %eax,%edx
+  800aad:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ab1:	83 c0 08             	add    $0x8,%eax
+  800ab4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ab7:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800aba:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800abf:	e9 6e ff ff ff       	jmp    800a32 <vprintfmt+0x5c0>
+  800ac4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ac8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800acc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ad0:	eb e5                	jmp    800ab7 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800ad2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ad5:	83 f8 2f             	cmp    $0x2f,%eax
+  800ad8:	77 18                	ja     800af2 <vprintfmt+0x680>
+  800ada:	89 c2                	mov    %eax,%edx
+  800adc:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ae0:	83 c0 08             	add    $0x8,%eax
+  800ae3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ae6:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800ae8:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800aed:	e9 40 ff ff ff       	jmp    800a32 <vprintfmt+0x5c0>
+  800af2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800af6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800afa:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800afe:	eb e6                	jmp    800ae6 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800b00:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b03:	83 f8 2f             	cmp    $0x2f,%eax
+  800b06:	77 19                	ja     800b21 <vprintfmt+0x6af>
+  800b08:	89 c2                	mov    %eax,%edx
+  800b0a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b0e:	83 c0 08             	add    $0x8,%eax
+  800b11:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b14:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800b17:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800b1c:	e9 11 ff ff ff       	jmp    800a32 <vprintfmt+0x5c0>
+  800b21:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b25:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b29:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b2d:	eb e5                	jmp    800b14 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800b2f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b33:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b37:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b3b:	e9 59 ff ff ff       	jmp    800a99 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800b40:	4c 89 ee             	mov    %r13,%rsi
+  800b43:	bf 25 00 00 00       	mov    $0x25,%edi
+  800b48:	41 ff d6             	call   *%r14
+            break;
+  800b4b:	e9 53 f9 ff ff       	jmp    8004a3 <vprintfmt+0x31>
+            putch('%', put_arg);
+  800b50:	4c 89 ee             	mov    %r13,%rsi
+  800b53:	bf 25 00 00 00       	mov    $0x25,%edi
+  800b58:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800b5b:	48 83 eb 01          	sub    $0x1,%rbx
+  800b5f:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800b63:	75 f6                	jne    800b5b <vprintfmt+0x6e9>
+  800b65:	e9 39 f9 ff ff       	jmp    8004a3 <vprintfmt+0x31>
+}
+  800b6a:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800b6e:	5b                   	pop    %rbx
+  800b6f:	41 5c                	pop    %r12
+  800b71:	41 5d                	pop    %r13
+  800b73:	41 5e                	pop    %r14
+  800b75:	41 5f                	pop    %r15
+  800b77:	5d                   	pop    %rbp
+  800b78:	c3                   	ret
+
+0000000000800b79 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800b79:	55                   	push   %rbp
+  800b7a:	48 89 e5             	mov    %rsp,%rbp
+  800b7d:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800b81:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800b85:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800b8a:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800b8e:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800b95:	48 85 ff             	test   %rdi,%rdi
+  800b98:	74 2b                	je     800bc5 <vsnprintf+0x4c>
+  800b9a:	48 85 f6             	test   %rsi,%rsi
+  800b9d:	74 26                	je     800bc5 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800b9f:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800ba3:	48 bf 1d 04 80 00 00 	movabs $0x80041d,%rdi
+  800baa:	00 00 00 
+  800bad:	48 b8 72 04 80 00 00 	movabs $0x800472,%rax
+  800bb4:	00 00 00 
+  800bb7:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800bb9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800bbd:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800bc0:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800bc3:	c9                   	leave
+  800bc4:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800bc5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800bca:	eb f7                	jmp    800bc3 <vsnprintf+0x4a>
+
+0000000000800bcc <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800bcc:	55                   	push   %rbp
+  800bcd:	48 89 e5             	mov    %rsp,%rbp
+  800bd0:	48 83 ec 50          	sub    $0x50,%rsp
+  800bd4:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800bd8:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800bdc:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800be0:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800be7:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800beb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bef:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800bf3:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800bf7:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800bfb:	48 b8 79 0b 80 00 00 	movabs $0x800b79,%rax
+  800c02:	00 00 00 
+  800c05:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800c07:	c9                   	leave
+  800c08:	c3                   	ret
+
+0000000000800c09 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800c09:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800c0c:	74 10                	je     800c1e <strlen+0x15>
+    size_t n = 0;
+  800c0e:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800c13:	48 83 c0 01          	add    $0x1,%rax
+  800c17:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800c1b:	75 f6                	jne    800c13 <strlen+0xa>
+  800c1d:	c3                   	ret
+    size_t n = 0;
+  800c1e:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800c23:	c3                   	ret
+
+0000000000800c24 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800c24:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800c27:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800c2c:	48 85 f6             	test   %rsi,%rsi
+  800c2f:	74 11                	je     800c42 <strnlen+0x1e>
+  800c31:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800c35:	74 0c                	je     800c43 <strnlen+0x1f>
+  800c37:	48 83 c2 01          	add    $0x1,%rdx
+  800c3b:	48 39 d0             	cmp    %rdx,%rax
+  800c3e:	75 f1                	jne    800c31 <strnlen+0xd>
+  800c40:	eb 04                	jmp    800c46 <strnlen+0x22>
+  800c42:	c3                   	ret
+  800c43:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800c46:	c3                   	ret
+
+0000000000800c47 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800c47:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800c4a:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c4f:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800c53:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800c56:	48 83 c2 01          	add    $0x1,%rdx
+  800c5a:	84 c9                	test   %cl,%cl
+  800c5c:	75 f1                	jne    800c4f <strcpy+0x8>
+        ;
+    return res;
+}
+  800c5e:	c3                   	ret
+
+0000000000800c5f <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800c5f:	55                   	push   %rbp
+  800c60:	48 89 e5             	mov    %rsp,%rbp
+  800c63:	41 54                	push   %r12
+  800c65:	53                   	push   %rbx
+  800c66:	48 89 fb             	mov    %rdi,%rbx
+  800c69:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800c6c:	48 b8 09 0c 80 00 00 	movabs $0x800c09,%rax
+  800c73:	00 00 00 
+  800c76:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800c78:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800c7c:	4c 89 e6             	mov    %r12,%rsi
+  800c7f:	48 b8 47 0c 80 00 00 	movabs $0x800c47,%rax
+  800c86:	00 00 00 
+  800c89:	ff d0                	call   *%rax
+    return dst;
+}
+  800c8b:	48 89 d8             	mov    %rbx,%rax
+  800c8e:	5b                   	pop    %rbx
+  800c8f:	41 5c                	pop    %r12
+  800c91:	5d                   	pop    %rbp
+  800c92:	c3                   	ret
+
+0000000000800c93 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800c93:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800c96:	48 85 d2             	test   %rdx,%rdx
+  800c99:	74 1f                	je     800cba <strncpy+0x27>
+  800c9b:	48 01 fa             	add    %rdi,%rdx
+  800c9e:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800ca1:	48 83 c1 01          	add    $0x1,%rcx
+  800ca5:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800ca9:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800cad:	41 80 f8 01          	cmp    $0x1,%r8b
+  800cb1:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800cb5:	48 39 ca             	cmp    %rcx,%rdx
+  800cb8:	75 e7                	jne    800ca1 <strncpy+0xe>
+    }
+    return ret;
+}
+  800cba:	c3                   	ret
+
+0000000000800cbb <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800cbb:	48 89 f8             	mov    %rdi,%rax
+  800cbe:	48 85 d2             	test   %rdx,%rdx
+  800cc1:	74 24                	je     800ce7 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800cc3:	48 83 ea 01          	sub    $0x1,%rdx
+  800cc7:	74 1b                	je     800ce4 <strlcpy+0x29>
+  800cc9:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800ccd:	0f b6 16             	movzbl (%rsi),%edx
+  800cd0:	84 d2                	test   %dl,%dl
+  800cd2:	74 10                	je     800ce4 <strlcpy+0x29>
+            *dst++ = *src++;
+  800cd4:	48 83 c6 01          	add    $0x1,%rsi
+  800cd8:	48 83 c0 01          	add    $0x1,%rax
+  800cdc:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800cdf:	48 39 c8             	cmp    %rcx,%rax
+  800ce2:	75 e9                	jne    800ccd <strlcpy+0x12>
+        *dst = '\0';
+  800ce4:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800ce7:	48 29 f8             	sub    %rdi,%rax
+}
+  800cea:	c3                   	ret
+
+0000000000800ceb <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800ceb:	0f b6 07             	movzbl (%rdi),%eax
+  800cee:	84 c0                	test   %al,%al
+  800cf0:	74 13                	je     800d05 <strcmp+0x1a>
+  800cf2:	38 06                	cmp    %al,(%rsi)
+  800cf4:	75 0f                	jne    800d05 <strcmp+0x1a>
+  800cf6:	48 83 c7 01          	add    $0x1,%rdi
+  800cfa:	48 83 c6 01          	add    $0x1,%rsi
+  800cfe:	0f b6 07             	movzbl (%rdi),%eax
+  800d01:	84 c0                	test   %al,%al
+  800d03:	75 ed                	jne    800cf2 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800d05:	0f b6 c0             	movzbl %al,%eax
+  800d08:	0f b6 16             	movzbl (%rsi),%edx
+  800d0b:	29 d0                	sub    %edx,%eax
+}
+  800d0d:	c3                   	ret
+
+0000000000800d0e <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800d0e:	48 85 d2             	test   %rdx,%rdx
+  800d11:	74 1f                	je     800d32 <strncmp+0x24>
+  800d13:	0f b6 07             	movzbl (%rdi),%eax
+  800d16:	84 c0                	test   %al,%al
+  800d18:	74 1e                	je     800d38 <strncmp+0x2a>
+  800d1a:	3a 06                	cmp    (%rsi),%al
+  800d1c:	75 1a                	jne    800d38 <strncmp+0x2a>
+  800d1e:	48 83 c7 01          	add    $0x1,%rdi
+  800d22:	48 83 c6 01          	add    $0x1,%rsi
+  800d26:	48 83 ea 01          	sub    $0x1,%rdx
+  800d2a:	75 e7                	jne    800d13 <strncmp+0x5>
+
+    if (!n) return 0;
+  800d2c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d31:	c3                   	ret
+  800d32:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d37:	c3                   	ret
+  800d38:	48 85 d2             	test   %rdx,%rdx
+  800d3b:	74 09                	je     800d46 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800d3d:	0f b6 07             	movzbl (%rdi),%eax
+  800d40:	0f b6 16             	movzbl (%rsi),%edx
+  800d43:	29 d0                	sub    %edx,%eax
+  800d45:	c3                   	ret
+    if (!n) return 0;
+  800d46:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800d4b:	c3                   	ret
+
+0000000000800d4c <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800d4c:	0f b6 17             	movzbl (%rdi),%edx
+  800d4f:	84 d2                	test   %dl,%dl
+  800d51:	74 18                	je     800d6b <strchr+0x1f>
+        if (*str == c) {
+  800d53:	0f be d2             	movsbl %dl,%edx
+  800d56:	39 f2                	cmp    %esi,%edx
+  800d58:	74 17                	je     800d71 <strchr+0x25>
+    for (; *str; str++) {
+  800d5a:	48 83 c7 01          	add    $0x1,%rdi
+  800d5e:	0f b6 17             	movzbl (%rdi),%edx
+  800d61:	84 d2                	test   %dl,%dl
+  800d63:	75 ee                	jne    800d53 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800d65:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d6a:	c3                   	ret
+  800d6b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d70:	c3                   	ret
+  800d71:	48 89 f8             	mov    %rdi,%rax
+}
+  800d74:	c3                   	ret
+
+0000000000800d75 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800d75:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800d78:	0f b6 17             	movzbl (%rdi),%edx
+  800d7b:	84 d2                	test   %dl,%dl
+  800d7d:	74 13                	je     800d92 <strfind+0x1d>
+  800d7f:	0f be d2             	movsbl %dl,%edx
+  800d82:	39 f2                	cmp    %esi,%edx
+  800d84:	74 0b                	je     800d91 <strfind+0x1c>
+  800d86:	48 83 c0 01          	add    $0x1,%rax
+  800d8a:	0f b6 10             	movzbl (%rax),%edx
+  800d8d:	84 d2                	test   %dl,%dl
+  800d8f:	75 ee                	jne    800d7f <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800d91:	c3                   	ret
+  800d92:	c3                   	ret
+
+0000000000800d93 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800d93:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800d96:	48 89 f8             	mov    %rdi,%rax
+  800d99:	48 f7 d8             	neg    %rax
+  800d9c:	83 e0 07             	and    $0x7,%eax
+  800d9f:	49 89 d1             	mov    %rdx,%r9
+  800da2:	49 29 c1             	sub    %rax,%r9
+  800da5:	78 36                	js     800ddd <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800da7:	40 0f b6 c6          	movzbl %sil,%eax
+  800dab:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800db2:	01 01 01 
+  800db5:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800db9:	40 f6 c7 07          	test   $0x7,%dil
+  800dbd:	75 38                	jne    800df7 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800dbf:	4c 89 c9             	mov    %r9,%rcx
+  800dc2:	48 c1 f9 03          	sar    $0x3,%rcx
+  800dc6:	74 0c                	je     800dd4 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800dc8:	fc                   	cld
+  800dc9:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800dcc:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800dd0:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800dd4:	4d 85 c9             	test   %r9,%r9
+  800dd7:	75 45                	jne    800e1e <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800dd9:	4c 89 c0             	mov    %r8,%rax
+  800ddc:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800ddd:	48 85 d2             	test   %rdx,%rdx
+  800de0:	74 f7                	je     800dd9 <memset+0x46>
+  800de2:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800de5:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800de8:	48 83 c0 01          	add    $0x1,%rax
+  800dec:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  800df0:	48 39 c2             	cmp    %rax,%rdx
+  800df3:	75 f3                	jne    800de8 <memset+0x55>
+  800df5:	eb e2                	jmp    800dd9 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  800df7:	40 f6 c7 01          	test   $0x1,%dil
+  800dfb:	74 06                	je     800e03 <memset+0x70>
+  800dfd:	88 07                	mov    %al,(%rdi)
+  800dff:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800e03:	40 f6 c7 02          	test   $0x2,%dil
+  800e07:	74 07                	je     800e10 <memset+0x7d>
+  800e09:	66 89 07             	mov    %ax,(%rdi)
+  800e0c:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800e10:	40 f6 c7 04          	test   $0x4,%dil
+  800e14:	74 a9                	je     800dbf <memset+0x2c>
+  800e16:	89 07                	mov    %eax,(%rdi)
+  800e18:	48 83 c7 04          	add    $0x4,%rdi
+  800e1c:	eb a1                	jmp    800dbf <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800e1e:	41 f6 c1 04          	test   $0x4,%r9b
+  800e22:	74 06                	je     800e2a <memset+0x97>
+  800e24:	89 07                	mov    %eax,(%rdi)
+  800e26:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800e2a:	41 f6 c1 02          	test   $0x2,%r9b
+  800e2e:	74 07                	je     800e37 <memset+0xa4>
+  800e30:	66 89 07             	mov    %ax,(%rdi)
+  800e33:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  800e37:	41 f6 c1 01          	test   $0x1,%r9b
+  800e3b:	74 9c                	je     800dd9 <memset+0x46>
+  800e3d:	88 07                	mov    %al,(%rdi)
+  800e3f:	eb 98                	jmp    800dd9 <memset+0x46>
+
+0000000000800e41 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  800e41:	48 89 f8             	mov    %rdi,%rax
+  800e44:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  800e47:	48 39 fe             	cmp    %rdi,%rsi
+  800e4a:	73 3b                	jae    800e87 <memmove+0x46>
+  800e4c:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  800e50:	48 39 d7             	cmp    %rdx,%rdi
+  800e53:	73 32                	jae    800e87 <memmove+0x46>
+        s += n;
+        d += n;
+  800e55:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800e59:	48 89 d6             	mov    %rdx,%rsi
+  800e5c:	48 09 fe             	or     %rdi,%rsi
+  800e5f:	48 09 ce             	or     %rcx,%rsi
+  800e62:	40 f6 c6 07          	test   $0x7,%sil
+  800e66:	75 12                	jne    800e7a <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  800e68:	48 83 ef 08          	sub    $0x8,%rdi
+  800e6c:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  800e70:	48 c1 e9 03          	shr    $0x3,%rcx
+  800e74:	fd                   	std
+  800e75:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  800e78:	fc                   	cld
+  800e79:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  800e7a:	48 83 ef 01          	sub    $0x1,%rdi
+  800e7e:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  800e82:	fd                   	std
+  800e83:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  800e85:	eb f1                	jmp    800e78 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800e87:	48 89 f2             	mov    %rsi,%rdx
+  800e8a:	48 09 c2             	or     %rax,%rdx
+  800e8d:	48 09 ca             	or     %rcx,%rdx
+  800e90:	f6 c2 07             	test   $0x7,%dl
+  800e93:	75 0c                	jne    800ea1 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  800e95:	48 c1 e9 03          	shr    $0x3,%rcx
+  800e99:	48 89 c7             	mov    %rax,%rdi
+  800e9c:	fc                   	cld
+  800e9d:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  800ea0:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  800ea1:	48 89 c7             	mov    %rax,%rdi
+  800ea4:	fc                   	cld
+  800ea5:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  800ea7:	c3                   	ret
+
+0000000000800ea8 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  800ea8:	55                   	push   %rbp
+  800ea9:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  800eac:	48 b8 41 0e 80 00 00 	movabs $0x800e41,%rax
+  800eb3:	00 00 00 
+  800eb6:	ff d0                	call   *%rax
+}
+  800eb8:	5d                   	pop    %rbp
+  800eb9:	c3                   	ret
+
+0000000000800eba <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  800eba:	55                   	push   %rbp
+  800ebb:	48 89 e5             	mov    %rsp,%rbp
+  800ebe:	41 57                	push   %r15
+  800ec0:	41 56                	push   %r14
+  800ec2:	41 55                	push   %r13
+  800ec4:	41 54                	push   %r12
+  800ec6:	53                   	push   %rbx
+  800ec7:	48 83 ec 08          	sub    $0x8,%rsp
+  800ecb:	49 89 fe             	mov    %rdi,%r14
+  800ece:	49 89 f7             	mov    %rsi,%r15
+  800ed1:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  800ed4:	48 89 f7             	mov    %rsi,%rdi
+  800ed7:	48 b8 09 0c 80 00 00 	movabs $0x800c09,%rax
+  800ede:	00 00 00 
+  800ee1:	ff d0                	call   *%rax
+  800ee3:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  800ee6:	48 89 de             	mov    %rbx,%rsi
+  800ee9:	4c 89 f7             	mov    %r14,%rdi
+  800eec:	48 b8 24 0c 80 00 00 	movabs $0x800c24,%rax
+  800ef3:	00 00 00 
+  800ef6:	ff d0                	call   *%rax
+  800ef8:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  800efb:	48 39 c3             	cmp    %rax,%rbx
+  800efe:	74 36                	je     800f36 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  800f00:	48 89 d8             	mov    %rbx,%rax
+  800f03:	4c 29 e8             	sub    %r13,%rax
+  800f06:	49 39 c4             	cmp    %rax,%r12
+  800f09:	73 31                	jae    800f3c <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  800f0b:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  800f10:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800f14:	4c 89 fe             	mov    %r15,%rsi
+  800f17:	48 b8 a8 0e 80 00 00 	movabs $0x800ea8,%rax
+  800f1e:	00 00 00 
+  800f21:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  800f23:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  800f27:	48 83 c4 08          	add    $0x8,%rsp
+  800f2b:	5b                   	pop    %rbx
+  800f2c:	41 5c                	pop    %r12
+  800f2e:	41 5d                	pop    %r13
+  800f30:	41 5e                	pop    %r14
+  800f32:	41 5f                	pop    %r15
+  800f34:	5d                   	pop    %rbp
+  800f35:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  800f36:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800f3a:	eb eb                	jmp    800f27 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  800f3c:	48 83 eb 01          	sub    $0x1,%rbx
+  800f40:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800f44:	48 89 da             	mov    %rbx,%rdx
+  800f47:	4c 89 fe             	mov    %r15,%rsi
+  800f4a:	48 b8 a8 0e 80 00 00 	movabs $0x800ea8,%rax
+  800f51:	00 00 00 
+  800f54:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  800f56:	49 01 de             	add    %rbx,%r14
+  800f59:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  800f5e:	eb c3                	jmp    800f23 <strlcat+0x69>
+
+0000000000800f60 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  800f60:	48 85 d2             	test   %rdx,%rdx
+  800f63:	74 2d                	je     800f92 <memcmp+0x32>
+  800f65:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  800f6a:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800f6e:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  800f73:	44 38 c1             	cmp    %r8b,%cl
+  800f76:	75 0f                	jne    800f87 <memcmp+0x27>
+    while (n-- > 0) {
+  800f78:	48 83 c0 01          	add    $0x1,%rax
+  800f7c:	48 39 c2             	cmp    %rax,%rdx
+  800f7f:	75 e9                	jne    800f6a <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  800f81:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f86:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  800f87:	0f b6 c1             	movzbl %cl,%eax
+  800f8a:	45 0f b6 c0          	movzbl %r8b,%r8d
+  800f8e:	44 29 c0             	sub    %r8d,%eax
+  800f91:	c3                   	ret
+    return 0;
+  800f92:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800f97:	c3                   	ret
+
+0000000000800f98 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  800f98:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  800f9c:	48 39 c7             	cmp    %rax,%rdi
+  800f9f:	73 0f                	jae    800fb0 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  800fa1:	40 38 37             	cmp    %sil,(%rdi)
+  800fa4:	74 0e                	je     800fb4 <memfind+0x1c>
+    for (; src < end; src++) {
+  800fa6:	48 83 c7 01          	add    $0x1,%rdi
+  800faa:	48 39 f8             	cmp    %rdi,%rax
+  800fad:	75 f2                	jne    800fa1 <memfind+0x9>
+  800faf:	c3                   	ret
+  800fb0:	48 89 f8             	mov    %rdi,%rax
+  800fb3:	c3                   	ret
+  800fb4:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  800fb7:	c3                   	ret
+
+0000000000800fb8 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  800fb8:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  800fbb:	0f b6 37             	movzbl (%rdi),%esi
+  800fbe:	40 80 fe 20          	cmp    $0x20,%sil
+  800fc2:	74 06                	je     800fca <strtol+0x12>
+  800fc4:	40 80 fe 09          	cmp    $0x9,%sil
+  800fc8:	75 13                	jne    800fdd <strtol+0x25>
+  800fca:	48 83 c7 01          	add    $0x1,%rdi
+  800fce:	0f b6 37             	movzbl (%rdi),%esi
+  800fd1:	40 80 fe 20          	cmp    $0x20,%sil
+  800fd5:	74 f3                	je     800fca <strtol+0x12>
+  800fd7:	40 80 fe 09          	cmp    $0x9,%sil
+  800fdb:	74 ed                	je     800fca <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  800fdd:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  800fe0:	83 e0 fd             	and    $0xfffffffd,%eax
+  800fe3:	3c 01                	cmp    $0x1,%al
+  800fe5:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  800fe9:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  800fef:	75 0f                	jne    801000 <strtol+0x48>
+  800ff1:	80 3f 30             	cmpb   $0x30,(%rdi)
+  800ff4:	74 14                	je     80100a <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  800ff6:	85 d2                	test   %edx,%edx
+  800ff8:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800ffd:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  801000:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  801005:	4c 63 ca             	movslq %edx,%r9
+  801008:	eb 36                	jmp    801040 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  80100a:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  80100e:	74 0f                	je     80101f <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  801010:	85 d2                	test   %edx,%edx
+  801012:	75 ec                	jne    801000 <strtol+0x48>
+        s++;
+  801014:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  801018:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  80101d:	eb e1                	jmp    801000 <strtol+0x48>
+        s += 2;
+  80101f:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  801023:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  801028:	eb d6                	jmp    801000 <strtol+0x48>
+            dig -= '0';
+  80102a:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  80102d:	44 0f b6 c1          	movzbl %cl,%r8d
+  801031:	41 39 d0             	cmp    %edx,%r8d
+  801034:	7d 21                	jge    801057 <strtol+0x9f>
+        val = val * base + dig;
+  801036:	49 0f af c1          	imul   %r9,%rax
+  80103a:	0f b6 c9             	movzbl %cl,%ecx
+  80103d:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  801040:	48 83 c7 01          	add    $0x1,%rdi
+  801044:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  801048:	80 f9 39             	cmp    $0x39,%cl
+  80104b:	76 dd                	jbe    80102a <strtol+0x72>
+        else if (dig - 'a' < 27)
+  80104d:	80 f9 7b             	cmp    $0x7b,%cl
+  801050:	77 05                	ja     801057 <strtol+0x9f>
+            dig -= 'a' - 10;
+  801052:	83 e9 57             	sub    $0x57,%ecx
+  801055:	eb d6                	jmp    80102d <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  801057:	4d 85 d2             	test   %r10,%r10
+  80105a:	74 03                	je     80105f <strtol+0xa7>
+  80105c:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  80105f:	48 89 c2             	mov    %rax,%rdx
+  801062:	48 f7 da             	neg    %rdx
+  801065:	40 80 fe 2d          	cmp    $0x2d,%sil
+  801069:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  80106d:	c3                   	ret
+
+000000000080106e <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  80106e:	55                   	push   %rbp
+  80106f:	48 89 e5             	mov    %rsp,%rbp
+  801072:	53                   	push   %rbx
+  801073:	48 89 fa             	mov    %rdi,%rdx
+  801076:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801079:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80107e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801083:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801088:	be 00 00 00 00       	mov    $0x0,%esi
+  80108d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801093:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  801095:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801099:	c9                   	leave
+  80109a:	c3                   	ret
+
+000000000080109b <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  80109b:	55                   	push   %rbp
+  80109c:	48 89 e5             	mov    %rsp,%rbp
+  80109f:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8010a0:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8010a5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010aa:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8010af:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010b4:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8010b9:	be 00 00 00 00       	mov    $0x0,%esi
+  8010be:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8010c4:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  8010c6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8010ca:	c9                   	leave
+  8010cb:	c3                   	ret
+
+00000000008010cc <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  8010cc:	55                   	push   %rbp
+  8010cd:	48 89 e5             	mov    %rsp,%rbp
+  8010d0:	53                   	push   %rbx
+  8010d1:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  8010d5:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8010d8:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8010dd:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8010e2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010e7:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8010ec:	be 00 00 00 00       	mov    $0x0,%esi
+  8010f1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8010f7:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8010f9:	48 85 c0             	test   %rax,%rax
+  8010fc:	7f 06                	jg     801104 <sys_env_destroy+0x38>
+}
+  8010fe:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801102:	c9                   	leave
+  801103:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801104:	49 89 c0             	mov    %rax,%r8
+  801107:	b9 03 00 00 00       	mov    $0x3,%ecx
+  80110c:	48 ba f0 34 80 00 00 	movabs $0x8034f0,%rdx
+  801113:	00 00 00 
+  801116:	be 26 00 00 00       	mov    $0x26,%esi
+  80111b:	48 bf 0f 35 80 00 00 	movabs $0x80350f,%rdi
+  801122:	00 00 00 
+  801125:	b8 00 00 00 00       	mov    $0x0,%eax
+  80112a:	49 b9 b4 2e 80 00 00 	movabs $0x802eb4,%r9
+  801131:	00 00 00 
+  801134:	41 ff d1             	call   *%r9
+
+0000000000801137 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  801137:	55                   	push   %rbp
+  801138:	48 89 e5             	mov    %rsp,%rbp
+  80113b:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80113c:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801141:	ba 00 00 00 00       	mov    $0x0,%edx
+  801146:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80114b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801150:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801155:	be 00 00 00 00       	mov    $0x0,%esi
+  80115a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801160:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  801162:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801166:	c9                   	leave
+  801167:	c3                   	ret
+
+0000000000801168 <sys_yield>:
+
+void
+sys_yield(void) {
+  801168:	55                   	push   %rbp
+  801169:	48 89 e5             	mov    %rsp,%rbp
+  80116c:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80116d:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801172:	ba 00 00 00 00       	mov    $0x0,%edx
+  801177:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80117c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801181:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801186:	be 00 00 00 00       	mov    $0x0,%esi
+  80118b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801191:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  801193:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801197:	c9                   	leave
+  801198:	c3                   	ret
+
+0000000000801199 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  801199:	55                   	push   %rbp
+  80119a:	48 89 e5             	mov    %rsp,%rbp
+  80119d:	53                   	push   %rbx
+  80119e:	48 89 fa             	mov    %rdi,%rdx
+  8011a1:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8011a4:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8011a9:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  8011b0:	00 00 00 
+  8011b3:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8011b8:	be 00 00 00 00       	mov    $0x0,%esi
+  8011bd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8011c3:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  8011c5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8011c9:	c9                   	leave
+  8011ca:	c3                   	ret
+
+00000000008011cb <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  8011cb:	55                   	push   %rbp
+  8011cc:	48 89 e5             	mov    %rsp,%rbp
+  8011cf:	53                   	push   %rbx
+  8011d0:	49 89 f8             	mov    %rdi,%r8
+  8011d3:	48 89 d3             	mov    %rdx,%rbx
+  8011d6:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8011d9:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8011de:	4c 89 c2             	mov    %r8,%rdx
+  8011e1:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8011e4:	be 00 00 00 00       	mov    $0x0,%esi
+  8011e9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8011ef:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  8011f1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8011f5:	c9                   	leave
+  8011f6:	c3                   	ret
+
+00000000008011f7 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  8011f7:	55                   	push   %rbp
+  8011f8:	48 89 e5             	mov    %rsp,%rbp
+  8011fb:	53                   	push   %rbx
+  8011fc:	48 83 ec 08          	sub    $0x8,%rsp
+  801200:	89 f8                	mov    %edi,%eax
+  801202:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  801205:	48 63 f9             	movslq %ecx,%rdi
+  801208:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80120b:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801210:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801213:	be 00 00 00 00       	mov    $0x0,%esi
+  801218:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80121e:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801220:	48 85 c0             	test   %rax,%rax
+  801223:	7f 06                	jg     80122b <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  801225:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801229:	c9                   	leave
+  80122a:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80122b:	49 89 c0             	mov    %rax,%r8
+  80122e:	b9 04 00 00 00       	mov    $0x4,%ecx
+  801233:	48 ba f0 34 80 00 00 	movabs $0x8034f0,%rdx
+  80123a:	00 00 00 
+  80123d:	be 26 00 00 00       	mov    $0x26,%esi
+  801242:	48 bf 0f 35 80 00 00 	movabs $0x80350f,%rdi
+  801249:	00 00 00 
+  80124c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801251:	49 b9 b4 2e 80 00 00 	movabs $0x802eb4,%r9
+  801258:	00 00 00 
+  80125b:	41 ff d1             	call   *%r9
+
+000000000080125e <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  80125e:	55                   	push   %rbp
+  80125f:	48 89 e5             	mov    %rsp,%rbp
+  801262:	53                   	push   %rbx
+  801263:	48 83 ec 08          	sub    $0x8,%rsp
+  801267:	89 f8                	mov    %edi,%eax
+  801269:	49 89 f2             	mov    %rsi,%r10
+  80126c:	48 89 cf             	mov    %rcx,%rdi
+  80126f:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  801272:	48 63 da             	movslq %edx,%rbx
+  801275:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801278:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80127d:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801280:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  801283:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801285:	48 85 c0             	test   %rax,%rax
+  801288:	7f 06                	jg     801290 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  80128a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80128e:	c9                   	leave
+  80128f:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801290:	49 89 c0             	mov    %rax,%r8
+  801293:	b9 05 00 00 00       	mov    $0x5,%ecx
+  801298:	48 ba f0 34 80 00 00 	movabs $0x8034f0,%rdx
+  80129f:	00 00 00 
+  8012a2:	be 26 00 00 00       	mov    $0x26,%esi
+  8012a7:	48 bf 0f 35 80 00 00 	movabs $0x80350f,%rdi
+  8012ae:	00 00 00 
+  8012b1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012b6:	49 b9 b4 2e 80 00 00 	movabs $0x802eb4,%r9
+  8012bd:	00 00 00 
+  8012c0:	41 ff d1             	call   *%r9
+
+00000000008012c3 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  8012c3:	55                   	push   %rbp
+  8012c4:	48 89 e5             	mov    %rsp,%rbp
+  8012c7:	53                   	push   %rbx
+  8012c8:	48 83 ec 08          	sub    $0x8,%rsp
+  8012cc:	48 89 f1             	mov    %rsi,%rcx
+  8012cf:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  8012d2:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8012d5:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8012da:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012df:	be 00 00 00 00       	mov    $0x0,%esi
+  8012e4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8012ea:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8012ec:	48 85 c0             	test   %rax,%rax
+  8012ef:	7f 06                	jg     8012f7 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  8012f1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012f5:	c9                   	leave
+  8012f6:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8012f7:	49 89 c0             	mov    %rax,%r8
+  8012fa:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8012ff:	48 ba f0 34 80 00 00 	movabs $0x8034f0,%rdx
+  801306:	00 00 00 
+  801309:	be 26 00 00 00       	mov    $0x26,%esi
+  80130e:	48 bf 0f 35 80 00 00 	movabs $0x80350f,%rdi
+  801315:	00 00 00 
+  801318:	b8 00 00 00 00       	mov    $0x0,%eax
+  80131d:	49 b9 b4 2e 80 00 00 	movabs $0x802eb4,%r9
+  801324:	00 00 00 
+  801327:	41 ff d1             	call   *%r9
+
+000000000080132a <sys_region_batch>:
+
+int
+sys_region_batch(const struct RegionOp *ops, size_t count) {
+  80132a:	55                   	push   %rbp
+  80132b:	48 89 e5             	mov    %rsp,%rbp
+  80132e:	53                   	push   %rbx
+  80132f:	48 83 ec 08          	sub    $0x8,%rsp
+  801333:	48 89 fa             	mov    %rdi,%rdx
+  801336:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801339:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80133e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801343:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801348:	be 00 00 00 00       	mov    $0x0,%esi
+  80134d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801353:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801355:	48 85 c0             	test   %rax,%rax
+  801358:	7f 06                	jg     801360 <sys_region_batch+0x36>
+        else
+            platform_asan_unpoison(va, ops[i].size);
+    }
+#endif
+    return res;
+}
+  80135a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80135e:	c9                   	leave
+  80135f:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801360:	49 89 c0             	mov    %rax,%r8
+  801363:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  801368:	48 ba f0 34 80 00 00 	movabs $0x8034f0,%rdx
+  80136f:	00 00 00 
+  801372:	be 26 00 00 00       	mov    $0x26,%esi
+  801377:	48 bf 0f 35 80 00 00 	movabs $0x80350f,%rdi
+  80137e:	00 00 00 
+  801381:	b8 00 00 00 00       	mov    $0x0,%eax
+  801386:	49 b9 b4 2e 80 00 00 	movabs $0x802eb4,%r9
+  80138d:	00 00 00 
+  801390:	41 ff d1             	call   *%r9
+
+0000000000801393 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  801393:	55                   	push   %rbp
+  801394:	48 89 e5             	mov    %rsp,%rbp
+  801397:	53                   	push   %rbx
+  801398:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  80139c:	48 63 ce             	movslq %esi,%rcx
+  80139f:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8013a2:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8013a7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013ac:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013b1:	be 00 00 00 00       	mov    $0x0,%esi
+  8013b6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013bc:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8013be:	48 85 c0             	test   %rax,%rax
+  8013c1:	7f 06                	jg     8013c9 <sys_env_set_status+0x36>
+}
+  8013c3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013c7:	c9                   	leave
+  8013c8:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8013c9:	49 89 c0             	mov    %rax,%r8
+  8013cc:	b9 09 00 00 00       	mov    $0x9,%ecx
+  8013d1:	48 ba f0 34 80 00 00 	movabs $0x8034f0,%rdx
+  8013d8:	00 00 00 
+  8013db:	be 26 00 00 00       	mov    $0x26,%esi
+  8013e0:	48 bf 0f 35 80 00 00 	movabs $0x80350f,%rdi
+  8013e7:	00 00 00 
+  8013ea:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013ef:	49 b9 b4 2e 80 00 00 	movabs $0x802eb4,%r9
+  8013f6:	00 00 00 
+  8013f9:	41 ff d1             	call   *%r9
+
+00000000008013fc <sys_env_set_weight>:
+
+int
+sys_env_set_weight(envid_t envid, uint32_t weight) {
+  8013fc:	55                   	push   %rbp
+  8013fd:	48 89 e5             	mov    %rsp,%rbp
+  801400:	53                   	push   %rbx
+  801401:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_weight, 1, envid, weight, 0, 0, 0, 0);
+  801405:	89 f1                	mov    %esi,%ecx
+  801407:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80140a:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80140f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801414:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801419:	be 00 00 00 00       	mov    $0x0,%esi
+  80141e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801424:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801426:	48 85 c0             	test   %rax,%rax
+  801429:	7f 06                	jg     801431 <sys_env_set_weight+0x35>
+}
+  80142b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80142f:	c9                   	leave
+  801430:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801431:	49 89 c0             	mov    %rax,%r8
+  801434:	b9 10 00 00 00       	mov    $0x10,%ecx
+  801439:	48 ba f0 34 80 00 00 	movabs $0x8034f0,%rdx
+  801440:	00 00 00 
+  801443:	be 26 00 00 00       	mov    $0x26,%esi
+  801448:	48 bf 0f 35 80 00 00 	movabs $0x80350f,%rdi
+  80144f:	00 00 00 
+  801452:	b8 00 00 00 00       	mov    $0x0,%eax
+  801457:	49 b9 b4 2e 80 00 00 	movabs $0x802eb4,%r9
+  80145e:	00 00 00 
+  801461:	41 ff d1             	call   *%r9
+
+0000000000801464 <sys_env_set_rt>:
+
+int
+sys_env_set_rt(envid_t envid, uint64_t period, uint64_t budget, uint64_t deadline) {
+  801464:	55                   	push   %rbp
+  801465:	48 89 e5             	mov    %rsp,%rbp
+  801468:	53                   	push   %rbx
+  801469:	48 83 ec 08          	sub    $0x8,%rsp
+  80146d:	89 f8                	mov    %edi,%eax
+  80146f:	48 89 d3             	mov    %rdx,%rbx
+  801472:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_env_set_rt, 1, envid, period, budget, deadline, 0, 0);
+  801475:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801478:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80147d:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801480:	be 00 00 00 00       	mov    $0x0,%esi
+  801485:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80148b:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80148d:	48 85 c0             	test   %rax,%rax
+  801490:	7f 06                	jg     801498 <sys_env_set_rt+0x34>
+}
+  801492:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801496:	c9                   	leave
+  801497:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801498:	49 89 c0             	mov    %rax,%r8
+  80149b:	b9 11 00 00 00       	mov    $0x11,%ecx
+  8014a0:	48 ba f0 34 80 00 00 	movabs $0x8034f0,%rdx
+  8014a7:	00 00 00 
+  8014aa:	be 26 00 00 00       	mov    $0x26,%esi
+  8014af:	48 bf 0f 35 80 00 00 	movabs $0x80350f,%rdi
+  8014b6:	00 00 00 
+  8014b9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014be:	49 b9 b4 2e 80 00 00 	movabs $0x802eb4,%r9
+  8014c5:	00 00 00 
+  8014c8:	41 ff d1             	call   *%r9
+
+00000000008014cb <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  8014cb:	55                   	push   %rbp
+  8014cc:	48 89 e5             	mov    %rsp,%rbp
+  8014cf:	53                   	push   %rbx
+  8014d0:	48 83 ec 08          	sub    $0x8,%rsp
+  8014d4:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  8014d7:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8014da:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8014df:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014e4:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014e9:	be 00 00 00 00       	mov    $0x0,%esi
+  8014ee:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014f4:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8014f6:	48 85 c0             	test   %rax,%rax
+  8014f9:	7f 06                	jg     801501 <sys_env_set_trapframe+0x36>
+}
+  8014fb:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014ff:	c9                   	leave
+  801500:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801501:	49 89 c0             	mov    %rax,%r8
+  801504:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  801509:	48 ba f0 34 80 00 00 	movabs $0x8034f0,%rdx
+  801510:	00 00 00 
+  801513:	be 26 00 00 00       	mov    $0x26,%esi
+  801518:	48 bf 0f 35 80 00 00 	movabs $0x80350f,%rdi
+  80151f:	00 00 00 
+  801522:	b8 00 00 00 00       	mov    $0x0,%eax
+  801527:	49 b9 b4 2e 80 00 00 	movabs $0x802eb4,%r9
+  80152e:	00 00 00 
+  801531:	41 ff d1             	call   *%r9
+
+0000000000801534 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  801534:	55                   	push   %rbp
+  801535:	48 89 e5             	mov    %rsp,%rbp
+  801538:	53                   	push   %rbx
+  801539:	48 83 ec 08          	sub    $0x8,%rsp
+  80153d:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  801540:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801543:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801548:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80154d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801552:	be 00 00 00 00       	mov    $0x0,%esi
+  801557:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80155d:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80155f:	48 85 c0             	test   %rax,%rax
+  801562:	7f 06                	jg     80156a <sys_env_set_pgfault_upcall+0x36>
+}
+  801564:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801568:	c9                   	leave
+  801569:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80156a:	49 89 c0             	mov    %rax,%r8
+  80156d:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  801572:	48 ba f0 34 80 00 00 	movabs $0x8034f0,%rdx
+  801579:	00 00 00 
+  80157c:	be 26 00 00 00       	mov    $0x26,%esi
+  801581:	48 bf 0f 35 80 00 00 	movabs $0x80350f,%rdi
+  801588:	00 00 00 
+  80158b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801590:	49 b9 b4 2e 80 00 00 	movabs $0x802eb4,%r9
+  801597:	00 00 00 
+  80159a:	41 ff d1             	call   *%r9
+
+000000000080159d <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  80159d:	55                   	push   %rbp
+  80159e:	48 89 e5             	mov    %rsp,%rbp
+  8015a1:	53                   	push   %rbx
+  8015a2:	89 f8                	mov    %edi,%eax
+  8015a4:	49 89 f1             	mov    %rsi,%r9
+  8015a7:	48 89 d3             	mov    %rdx,%rbx
+  8015aa:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  8015ad:	49 63 f0             	movslq %r8d,%rsi
+  8015b0:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8015b3:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8015b8:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015bb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015c1:	cd 30                	int    $0x30
+}
+  8015c3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015c7:	c9                   	leave
+  8015c8:	c3                   	ret
+
+00000000008015c9 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  8015c9:	55                   	push   %rbp
+  8015ca:	48 89 e5             	mov    %rsp,%rbp
+  8015cd:	53                   	push   %rbx
+  8015ce:	48 83 ec 08          	sub    $0x8,%rsp
+  8015d2:	48 89 fa             	mov    %rdi,%rdx
+  8015d5:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8015d8:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8015dd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015e2:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015e7:	be 00 00 00 00       	mov    $0x0,%esi
+  8015ec:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015f2:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8015f4:	48 85 c0             	test   %rax,%rax
+  8015f7:	7f 06                	jg     8015ff <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8015f9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015fd:	c9                   	leave
+  8015fe:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8015ff:	49 89 c0             	mov    %rax,%r8
+  801602:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  801607:	48 ba f0 34 80 00 00 	movabs $0x8034f0,%rdx
+  80160e:	00 00 00 
+  801611:	be 26 00 00 00       	mov    $0x26,%esi
+  801616:	48 bf 0f 35 80 00 00 	movabs $0x80350f,%rdi
+  80161d:	00 00 00 
+  801620:	b8 00 00 00 00       	mov    $0x0,%eax
+  801625:	49 b9 b4 2e 80 00 00 	movabs $0x802eb4,%r9
+  80162c:	00 00 00 
+  80162f:	41 ff d1             	call   *%r9
+
+0000000000801632 <fork>:
+ * Hint:
+ *   Use sys_map_region, it can perform address space copying in one call
+ *   Remember to fix "thisenv" in the child process.
+ */
+envid_t
+fork(void) {
+  801632:	55                   	push   %rbp
+  801633:	48 89 e5             	mov    %rsp,%rbp
+  801636:	41 55                	push   %r13
+  801638:	41 54                	push   %r12
+  80163a:	53                   	push   %rbx
+  80163b:	48 83 ec 08          	sub    $0x8,%rsp
+
+/* This must be inlined. Exercise for reader: why? */
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+    envid_t ret;
+    asm volatile("int %2"
+  80163f:	b8 08 00 00 00       	mov    $0x8,%eax
+  801644:	cd 30                	int    $0x30
+  801646:	41 89 c5             	mov    %eax,%r13d
+    // LAB 9: Your code here
+
+    envid_t child_id = sys_exofork();
+    if (child_id < 0) {
+  801649:	85 c0                	test   %eax,%eax
+  80164b:	0f 88 ae 00 00 00    	js     8016ff <fork+0xcd>
+  801651:	89 c3                	mov    %eax,%ebx
+        return child_id;
+    }
+    if (child_id == 0) {
+  801653:	0f 84 b4 00 00 00    	je     80170d <fork+0xdb>
+        thisenv = &envs[ENVX(sys_getenvid())];
+        return 0;
+    }
+    int res = sys_map_region(0, NULL, child_id, NULL, MAX_USER_ADDRESS, PROT_ALL | PROT_LAZY | PROT_COMBINE);
+  801659:	41 b9 df 01 00 00    	mov    $0x1df,%r9d
+  80165f:	49 b8 00 00 00 00 80 	movabs $0x8000000000,%r8
+  801666:	00 00 00 
+  801669:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80166e:	89 c2                	mov    %eax,%edx
+  801670:	be 00 00 00 00       	mov    $0x0,%esi
+  801675:	bf 00 00 00 00       	mov    $0x0,%edi
+  80167a:	48 b8 5e 12 80 00 00 	movabs $0x80125e,%rax
+  801681:	00 00 00 
+  801684:	ff d0                	call   *%rax
+  801686:	41 89 c4             	mov    %eax,%r12d
+    if (res < 0) {
+  801689:	85 c0                	test   %eax,%eax
+  80168b:	78 5d                	js     8016ea <fork+0xb8>
+        goto error;
+    }
+    res = sys_env_set_pgfault_upcall(child_id, envs[ENVX(sys_getenvid())].env_pgfault_upcall);
+  80168d:	48 b8 37 11 80 00 00 	movabs $0x801137,%rax
+  801694:	00 00 00 
+  801697:	ff d0                	call   *%rax
+  801699:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80169e:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+  8016a5:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8016ac:	00 00 00 
+  8016af:	48 01 d0             	add    %rdx,%rax
+  8016b2:	48 8b b0 88 01 00 00 	mov    0x188(%rax),%rsi
+  8016b9:	44 89 ef             	mov    %r13d,%edi
+  8016bc:	48 b8 34 15 80 00 00 	movabs $0x801534,%rax
+  8016c3:	00 00 00 
+  8016c6:	ff d0                	call   *%rax
+  8016c8:	41 89 c4             	mov    %eax,%r12d
+    if (res < 0) {
+  8016cb:	85 c0                	test   %eax,%eax
+  8016cd:	78 1b                	js     8016ea <fork+0xb8>
+        goto error;
+    }
+    res = sys_env_set_status(child_id, ENV_RUNNABLE);
+  8016cf:	be 02 00 00 00       	mov    $0x2,%esi
+  8016d4:	44 89 ef             	mov    %r13d,%edi
+  8016d7:	48 b8 93 13 80 00 00 	movabs $0x801393,%rax
+  8016de:	00 00 00 
+  8016e1:	ff d0                	call   *%rax
+  8016e3:	41 89 c4             	mov    %eax,%r12d
+    if (res < 0) {
+  8016e6:	85 c0                	test   %eax,%eax
+  8016e8:	79 15                	jns    8016ff <fork+0xcd>
+        goto error;
+    }
+    return child_id;
+error:
+    ;
+    int res2 = sys_env_destroy(child_id);
+  8016ea:	89 df                	mov    %ebx,%edi
+  8016ec:	48 b8 cc 10 80 00 00 	movabs $0x8010cc,%rax
+  8016f3:	00 00 00 
+  8016f6:	ff d0                	call   *%rax
+    if (res2 < 0) {
+  8016f8:	85 c0                	test   %eax,%eax
+  8016fa:	78 42                	js     80173e <fork+0x10c>
+        panic("Fork double fault");
+    }
+    return res;
+  8016fc:	45 89 e5             	mov    %r12d,%r13d
+}
+  8016ff:	44 89 e8             	mov    %r13d,%eax
+  801702:	48 83 c4 08          	add    $0x8,%rsp
+  801706:	5b                   	pop    %rbx
+  801707:	41 5c                	pop    %r12
+  801709:	41 5d                	pop    %r13
+  80170b:	5d                   	pop    %rbp
+  80170c:	c3                   	ret
+        thisenv = &envs[ENVX(sys_getenvid())];
+  80170d:	48 b8 37 11 80 00 00 	movabs $0x801137,%rax
+  801714:	00 00 00 
+  801717:	ff d0                	call   *%rax
+  801719:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80171e:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+  801725:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  80172c:	00 00 00 
+  80172f:	48 01 d0             	add    %rdx,%rax
+  801732:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  801739:	00 00 00 
+        return 0;
+  80173c:	eb c1                	jmp    8016ff <fork+0xcd>
+        panic("Fork double fault");
+  80173e:	48 ba 1d 35 80 00 00 	movabs $0x80351d,%rdx
+  801745:	00 00 00 
+  801748:	be 2f 00 00 00       	mov    $0x2f,%esi
+  80174d:	48 bf 2f 35 80 00 00 	movabs $0x80352f,%rdi
+  801754:	00 00 00 
+  801757:	b8 00 00 00 00       	mov    $0x0,%eax
+  80175c:	48 b9 b4 2e 80 00 00 	movabs $0x802eb4,%rcx
+  801763:	00 00 00 
+  801766:	ff d1                	call   *%rcx
+
+0000000000801768 <sfork>:
+
+envid_t
+sfork() {
+  801768:	55                   	push   %rbp
+  801769:	48 89 e5             	mov    %rsp,%rbp
+    panic("sfork() is not implemented");
+  80176c:	48 ba 3a 35 80 00 00 	movabs $0x80353a,%rdx
+  801773:	00 00 00 
+  801776:	be 36 00 00 00       	mov    $0x36,%esi
+  80177b:	48 bf 2f 35 80 00 00 	movabs $0x80352f,%rdi
+  801782:	00 00 00 
+  801785:	b8 00 00 00 00       	mov    $0x0,%eax
+  80178a:	48 b9 b4 2e 80 00 00 	movabs $0x802eb4,%rcx
+  801791:	00 00 00 
+  801794:	ff d1                	call   *%rcx
+
+0000000000801796 <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  801796:	55                   	push   %rbp
+  801797:	48 89 e5             	mov    %rsp,%rbp
+  80179a:	41 55                	push   %r13
+  80179c:	41 54                	push   %r12
+  80179e:	53                   	push   %rbx
+  80179f:	48 83 ec 08          	sub    $0x8,%rsp
+  8017a3:	49 89 fc             	mov    %rdi,%r12
+  8017a6:	48 89 f7             	mov    %rsi,%rdi
+  8017a9:	48 89 d3             	mov    %rdx,%rbx
+  8017ac:	49 89 cd             	mov    %rcx,%r13
+    // LAB 9: Your code here:
+    int res = sys_ipc_recv(!pg ? (void*)MAX_USER_ADDRESS : pg, !size ? 0 : *size);
+  8017af:	be 00 00 00 00       	mov    $0x0,%esi
+  8017b4:	48 85 d2             	test   %rdx,%rdx
+  8017b7:	74 03                	je     8017bc <ipc_recv+0x26>
+  8017b9:	48 8b 32             	mov    (%rdx),%rsi
+  8017bc:	48 85 ff             	test   %rdi,%rdi
+  8017bf:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8017c6:	00 00 00 
+  8017c9:	48 0f 44 f8          	cmove  %rax,%rdi
+  8017cd:	48 b8 c9 15 80 00 00 	movabs $0x8015c9,%rax
+  8017d4:	00 00 00 
+  8017d7:	ff d0                	call   *%rax
+    if (res < 0) {
+  8017d9:	85 c0                	test   %eax,%eax
+  8017db:	78 66                	js     801843 <ipc_recv+0xad>
+        if (size) {
+            *size = 0;
+        }
+        return res;
+    }
+    if (from_env_store) {
+  8017dd:	4d 85 e4             	test   %r12,%r12
+  8017e0:	74 14                	je     8017f6 <ipc_recv+0x60>
+        *from_env_store = thisenv->env_ipc_from;
+  8017e2:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  8017e9:	00 00 00 
+  8017ec:	8b 80 ac 01 00 00    	mov    0x1ac(%rax),%eax
+  8017f2:	41 89 04 24          	mov    %eax,(%r12)
+    }
+    if (perm_store) {
+  8017f6:	4d 85 ed             	test   %r13,%r13
+  8017f9:	74 14                	je     80180f <ipc_recv+0x79>
+        *perm_store = thisenv->env_ipc_perm;
+  8017fb:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801802:	00 00 00 
+  801805:	8b 80 b0 01 00 00    	mov    0x1b0(%rax),%eax
+  80180b:	41 89 45 00          	mov    %eax,0x0(%r13)
+    }
+    if (size) {
+  80180f:	48 85 db             	test   %rbx,%rbx
+  801812:	74 14                	je     801828 <ipc_recv+0x92>
+        *size = thisenv->env_ipc_maxsz;
+  801814:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  80181b:	00 00 00 
+  80181e:	48 8b 80 a0 01 00 00 	mov    0x1a0(%rax),%rax
+  801825:	48 89 03             	mov    %rax,(%rbx)
+    }
+    return thisenv->env_ipc_value;
+  801828:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  80182f:	00 00 00 
+  801832:	8b 80 a8 01 00 00    	mov    0x1a8(%rax),%eax
+}
+  801838:	48 83 c4 08          	add    $0x8,%rsp
+  80183c:	5b                   	pop    %rbx
+  80183d:	41 5c                	pop    %r12
+  80183f:	41 5d                	pop    %r13
+  801841:	5d                   	pop    %rbp
+  801842:	c3                   	ret
+        if (from_env_store) {
+  801843:	4d 85 e4             	test   %r12,%r12
+  801846:	74 08                	je     801850 <ipc_recv+0xba>
+            *from_env_store = 0;
+  801848:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  80184f:	00 
+        if (perm_store) {
+  801850:	4d 85 ed             	test   %r13,%r13
+  801853:	74 08                	je     80185d <ipc_recv+0xc7>
+            *perm_store = 0;
+  801855:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  80185c:	00 
+        if (size) {
+  80185d:	48 85 db             	test   %rbx,%rbx
+  801860:	74 d6                	je     801838 <ipc_recv+0xa2>
+            *size = 0;
+  801862:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  801869:	eb cd                	jmp    801838 <ipc_recv+0xa2>
+
+000000000080186b <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  80186b:	55                   	push   %rbp
+  80186c:	48 89 e5             	mov    %rsp,%rbp
+  80186f:	41 57                	push   %r15
+  801871:	41 56                	push   %r14
+  801873:	41 55                	push   %r13
+  801875:	41 54                	push   %r12
+  801877:	53                   	push   %rbx
+  801878:	48 83 ec 18          	sub    $0x18,%rsp
+  80187c:	41 89 fd             	mov    %edi,%r13d
+  80187f:	89 75 cc             	mov    %esi,-0x34(%rbp)
+  801882:	49 89 cc             	mov    %rcx,%r12
+  801885:	44 89 45 c8          	mov    %r8d,-0x38(%rbp)
+    // LAB 9: Your code here:
+    int res = 0;
+    while ((res = sys_ipc_try_send(to_env, val, !pg ? (void*)MAX_USER_ADDRESS : pg, size, perm)) < 0) {
+  801889:	48 85 d2             	test   %rdx,%rdx
+  80188c:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  801893:	00 00 00 
+  801896:	48 0f 45 c2          	cmovne %rdx,%rax
+  80189a:	48 89 c3             	mov    %rax,%rbx
+  80189d:	49 be 9d 15 80 00 00 	movabs $0x80159d,%r14
+  8018a4:	00 00 00 
+        if (res != -E_IPC_NOT_RECV) {
+            panic("sys_ipc_try_send failed: %i", res);
+        }
+        sys_yield();
+  8018a7:	49 bf 68 11 80 00 00 	movabs $0x801168,%r15
+  8018ae:	00 00 00 
+    while ((res = sys_ipc_try_send(to_env, val, !pg ? (void*)MAX_USER_ADDRESS : pg, size, perm)) < 0) {
+  8018b1:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  8018b4:	44 8b 45 c8          	mov    -0x38(%rbp),%r8d
+  8018b8:	4c 89 e1             	mov    %r12,%rcx
+  8018bb:	48 89 da             	mov    %rbx,%rdx
+  8018be:	44 89 ef             	mov    %r13d,%edi
+  8018c1:	41 ff d6             	call   *%r14
+  8018c4:	85 c0                	test   %eax,%eax
+  8018c6:	79 37                	jns    8018ff <ipc_send+0x94>
+        if (res != -E_IPC_NOT_RECV) {
+  8018c8:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  8018cb:	75 05                	jne    8018d2 <ipc_send+0x67>
+        sys_yield();
+  8018cd:	41 ff d7             	call   *%r15
+  8018d0:	eb df                	jmp    8018b1 <ipc_send+0x46>
+            panic("sys_ipc_try_send failed: %i", res);
+  8018d2:	89 c1                	mov    %eax,%ecx
+  8018d4:	48 ba 55 35 80 00 00 	movabs $0x803555,%rdx
+  8018db:	00 00 00 
+  8018de:	be 40 00 00 00       	mov    $0x40,%esi
+  8018e3:	48 bf 71 35 80 00 00 	movabs $0x803571,%rdi
+  8018ea:	00 00 00 
+  8018ed:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018f2:	49 b8 b4 2e 80 00 00 	movabs $0x802eb4,%r8
+  8018f9:	00 00 00 
+  8018fc:	41 ff d0             	call   *%r8
+    }
+    return;
+}
+  8018ff:	48 83 c4 18          	add    $0x18,%rsp
+  801903:	5b                   	pop    %rbx
+  801904:	41 5c                	pop    %r12
+  801906:	41 5d                	pop    %r13
+  801908:	41 5e                	pop    %r14
+  80190a:	41 5f                	pop    %r15
+  80190c:	5d                   	pop    %rbp
+  80190d:	c3                   	ret
+
+000000000080190e <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  80190e:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  801913:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  80191a:	00 00 00 
+  80191d:	48 69 d0 d0 01 00 00 	imul   $0x1d0,%rax,%rdx
+  801924:	48 01 ca             	add    %rcx,%rdx
+  801927:	8b 92 e8 00 00 00    	mov    0xe8(%rdx),%edx
+  80192d:	39 fa                	cmp    %edi,%edx
+  80192f:	74 12                	je     801943 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  801931:	48 83 c0 01          	add    $0x1,%rax
+  801935:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  80193b:	75 e0                	jne    80191d <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  80193d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801942:	c3                   	ret
+            return envs[i].env_id;
+  801943:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+  80194a:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  801951:	00 00 00 
+  801954:	48 01 d0             	add    %rdx,%rax
+  801957:	8b 80 e0 00 00 00    	mov    0xe0(%rax),%eax
+  80195d:	c3                   	ret
+
+000000000080195e <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80195e:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801965:	ff ff ff 
+  801968:	48 01 f8             	add    %rdi,%rax
+  80196b:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  80196f:	c3                   	ret
+
+0000000000801970 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801970:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801977:	ff ff ff 
+  80197a:	48 01 f8             	add    %rdi,%rax
+  80197d:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  801981:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  801987:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  80198b:	c3                   	ret
+
+000000000080198c <fd_alloc_from>:
+}
+
+/* Like fd_alloc(), but only considers fds starting from fdnum,
+ * so that several fds can be found before their pages are allocated */
+int
+fd_alloc_from(int fdnum, struct Fd **fd_store) {
+  80198c:	55                   	push   %rbp
+  80198d:	48 89 e5             	mov    %rsp,%rbp
+  801990:	41 57                	push   %r15
+  801992:	41 56                	push   %r14
+  801994:	41 55                	push   %r13
+  801996:	41 54                	push   %r12
+  801998:	53                   	push   %rbx
+  801999:	48 83 ec 08          	sub    $0x8,%rsp
+  80199d:	49 89 f7             	mov    %rsi,%r15
+    for (int i = MAX(fdnum, 0); i < MAXFD; i++) {
+  8019a0:	85 ff                	test   %edi,%edi
+  8019a2:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8019a8:	44 0f 49 e7          	cmovns %edi,%r12d
+  8019ac:	83 ff 1f             	cmp    $0x1f,%edi
+  8019af:	7f 37                	jg     8019e8 <fd_alloc_from+0x5c>
+  8019b1:	49 63 dc             	movslq %r12d,%rbx
+  8019b4:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  8019bb:	48 c1 e3 0c          	shl    $0xc,%rbx
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  8019bf:	49 be 95 2a 80 00 00 	movabs $0x802a95,%r14
+  8019c6:	00 00 00 
+        struct Fd *fd = INDEX2FD(i);
+  8019c9:	49 89 dd             	mov    %rbx,%r13
+        if (!(get_prot(fd) & PROT_R)) {
+  8019cc:	48 89 df             	mov    %rbx,%rdi
+  8019cf:	41 ff d6             	call   *%r14
+  8019d2:	83 e0 04             	and    $0x4,%eax
+  8019d5:	74 1c                	je     8019f3 <fd_alloc_from+0x67>
+    for (int i = MAX(fdnum, 0); i < MAXFD; i++) {
+  8019d7:	41 83 c4 01          	add    $0x1,%r12d
+  8019db:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8019e2:	41 83 fc 1f          	cmp    $0x1f,%r12d
+  8019e6:	7e e1                	jle    8019c9 <fd_alloc_from+0x3d>
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  8019e8:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  8019ee:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  8019f3:	4d 89 2f             	mov    %r13,(%r15)
+}
+  8019f6:	48 83 c4 08          	add    $0x8,%rsp
+  8019fa:	5b                   	pop    %rbx
+  8019fb:	41 5c                	pop    %r12
+  8019fd:	41 5d                	pop    %r13
+  8019ff:	41 5e                	pop    %r14
+  801a01:	41 5f                	pop    %r15
+  801a03:	5d                   	pop    %rbp
+  801a04:	c3                   	ret
+
+0000000000801a05 <fd_alloc>:
+fd_alloc(struct Fd **fd_store) {
+  801a05:	55                   	push   %rbp
+  801a06:	48 89 e5             	mov    %rsp,%rbp
+  801a09:	48 89 fe             	mov    %rdi,%rsi
+    return fd_alloc_from(0, fd_store);
+  801a0c:	bf 00 00 00 00       	mov    $0x0,%edi
+  801a11:	48 b8 8c 19 80 00 00 	movabs $0x80198c,%rax
+  801a18:	00 00 00 
+  801a1b:	ff d0                	call   *%rax
+}
+  801a1d:	5d                   	pop    %rbp
+  801a1e:	c3                   	ret
+
+0000000000801a1f <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  801a1f:	83 ff 1f             	cmp    $0x1f,%edi
+  801a22:	77 39                	ja     801a5d <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  801a24:	55                   	push   %rbp
+  801a25:	48 89 e5             	mov    %rsp,%rbp
+  801a28:	41 54                	push   %r12
+  801a2a:	53                   	push   %rbx
+  801a2b:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  801a2e:	48 63 df             	movslq %edi,%rbx
+  801a31:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  801a38:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  801a3c:	48 89 df             	mov    %rbx,%rdi
+  801a3f:	48 b8 95 2a 80 00 00 	movabs $0x802a95,%rax
+  801a46:	00 00 00 
+  801a49:	ff d0                	call   *%rax
+  801a4b:	a8 04                	test   $0x4,%al
+  801a4d:	74 14                	je     801a63 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  801a4f:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  801a53:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801a58:	5b                   	pop    %rbx
+  801a59:	41 5c                	pop    %r12
+  801a5b:	5d                   	pop    %rbp
+  801a5c:	c3                   	ret
+        return -E_INVAL;
+  801a5d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801a62:	c3                   	ret
+        return -E_INVAL;
+  801a63:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801a68:	eb ee                	jmp    801a58 <fd_lookup+0x39>
+
+0000000000801a6a <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  801a6a:	55                   	push   %rbp
+  801a6b:	48 89 e5             	mov    %rsp,%rbp
+  801a6e:	41 54                	push   %r12
+  801a70:	53                   	push   %rbx
+  801a71:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  801a74:	48 b8 00 36 80 00 00 	movabs $0x803600,%rax
+  801a7b:	00 00 00 
+  801a7e:	48 bb 20 40 80 00 00 	movabs $0x804020,%rbx
+  801a85:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  801a88:	39 3b                	cmp    %edi,(%rbx)
+  801a8a:	74 47                	je     801ad3 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  801a8c:	48 83 c0 08          	add    $0x8,%rax
+  801a90:	48 8b 18             	mov    (%rax),%rbx
+  801a93:	48 85 db             	test   %rbx,%rbx
+  801a96:	75 f0                	jne    801a88 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801a98:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801a9f:	00 00 00 
+  801aa2:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+  801aa8:	89 fa                	mov    %edi,%edx
+  801aaa:	48 bf 80 35 80 00 00 	movabs $0x803580,%rdi
+  801ab1:	00 00 00 
+  801ab4:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ab9:	48 b9 22 03 80 00 00 	movabs $0x800322,%rcx
+  801ac0:	00 00 00 
+  801ac3:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  801ac5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  801aca:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  801ace:	5b                   	pop    %rbx
+  801acf:	41 5c                	pop    %r12
+  801ad1:	5d                   	pop    %rbp
+  801ad2:	c3                   	ret
+            return 0;
+  801ad3:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ad8:	eb f0                	jmp    801aca <dev_lookup+0x60>
+
+0000000000801ada <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  801ada:	55                   	push   %rbp
+  801adb:	48 89 e5             	mov    %rsp,%rbp
+  801ade:	41 55                	push   %r13
+  801ae0:	41 54                	push   %r12
+  801ae2:	53                   	push   %rbx
+  801ae3:	48 83 ec 18          	sub    $0x18,%rsp
+  801ae7:	48 89 fb             	mov    %rdi,%rbx
+  801aea:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801aed:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  801af4:	ff ff ff 
+  801af7:	48 01 df             	add    %rbx,%rdi
+  801afa:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  801afe:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801b02:	48 b8 1f 1a 80 00 00 	movabs $0x801a1f,%rax
+  801b09:	00 00 00 
+  801b0c:	ff d0                	call   *%rax
+  801b0e:	41 89 c5             	mov    %eax,%r13d
+  801b11:	85 c0                	test   %eax,%eax
+  801b13:	78 06                	js     801b1b <fd_close+0x41>
+  801b15:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  801b19:	74 1a                	je     801b35 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  801b1b:	45 84 e4             	test   %r12b,%r12b
+  801b1e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b23:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  801b27:	44 89 e8             	mov    %r13d,%eax
+  801b2a:	48 83 c4 18          	add    $0x18,%rsp
+  801b2e:	5b                   	pop    %rbx
+  801b2f:	41 5c                	pop    %r12
+  801b31:	41 5d                	pop    %r13
+  801b33:	5d                   	pop    %rbp
+  801b34:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801b35:	8b 3b                	mov    (%rbx),%edi
+  801b37:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801b3b:	48 b8 6a 1a 80 00 00 	movabs $0x801a6a,%rax
+  801b42:	00 00 00 
+  801b45:	ff d0                	call   *%rax
+  801b47:	41 89 c5             	mov    %eax,%r13d
+  801b4a:	85 c0                	test   %eax,%eax
+  801b4c:	78 1b                	js     801b69 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  801b4e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801b52:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801b56:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801b5c:	48 85 c0             	test   %rax,%rax
+  801b5f:	74 08                	je     801b69 <fd_close+0x8f>
+  801b61:	48 89 df             	mov    %rbx,%rdi
+  801b64:	ff d0                	call   *%rax
+  801b66:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801b69:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801b6e:	48 89 de             	mov    %rbx,%rsi
+  801b71:	bf 00 00 00 00       	mov    $0x0,%edi
+  801b76:	48 b8 c3 12 80 00 00 	movabs $0x8012c3,%rax
+  801b7d:	00 00 00 
+  801b80:	ff d0                	call   *%rax
+    return res;
+  801b82:	eb a3                	jmp    801b27 <fd_close+0x4d>
+
+0000000000801b84 <close>:
+
+int
+close(int fdnum) {
+  801b84:	55                   	push   %rbp
+  801b85:	48 89 e5             	mov    %rsp,%rbp
+  801b88:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  801b8c:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801b90:	48 b8 1f 1a 80 00 00 	movabs $0x801a1f,%rax
+  801b97:	00 00 00 
+  801b9a:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801b9c:	85 c0                	test   %eax,%eax
+  801b9e:	78 15                	js     801bb5 <close+0x31>
+
+    return fd_close(fd, 1);
+  801ba0:	be 01 00 00 00       	mov    $0x1,%esi
+  801ba5:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801ba9:	48 b8 da 1a 80 00 00 	movabs $0x801ada,%rax
+  801bb0:	00 00 00 
+  801bb3:	ff d0                	call   *%rax
+}
+  801bb5:	c9                   	leave
+  801bb6:	c3                   	ret
+
+0000000000801bb7 <close_all>:
+
+void
+close_all(void) {
+  801bb7:	55                   	push   %rbp
+  801bb8:	48 89 e5             	mov    %rsp,%rbp
+  801bbb:	41 54                	push   %r12
+  801bbd:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  801bbe:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801bc3:	49 bc 84 1b 80 00 00 	movabs $0x801b84,%r12
+  801bca:	00 00 00 
+  801bcd:	89 df                	mov    %ebx,%edi
+  801bcf:	41 ff d4             	call   *%r12
+  801bd2:	83 c3 01             	add    $0x1,%ebx
+  801bd5:	83 fb 20             	cmp    $0x20,%ebx
+  801bd8:	75 f3                	jne    801bcd <close_all+0x16>
+}
+  801bda:	5b                   	pop    %rbx
+  801bdb:	41 5c                	pop    %r12
+  801bdd:	5d                   	pop    %rbp
+  801bde:	c3                   	ret
+
+0000000000801bdf <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  801bdf:	55                   	push   %rbp
+  801be0:	48 89 e5             	mov    %rsp,%rbp
+  801be3:	41 57                	push   %r15
+  801be5:	41 56                	push   %r14
+  801be7:	41 55                	push   %r13
+  801be9:	41 54                	push   %r12
+  801beb:	53                   	push   %rbx
+  801bec:	48 83 ec 18          	sub    $0x18,%rsp
+  801bf0:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  801bf3:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801bf7:	48 b8 1f 1a 80 00 00 	movabs $0x801a1f,%rax
+  801bfe:	00 00 00 
+  801c01:	ff d0                	call   *%rax
+  801c03:	89 c3                	mov    %eax,%ebx
+  801c05:	85 c0                	test   %eax,%eax
+  801c07:	0f 88 b8 00 00 00    	js     801cc5 <dup+0xe6>
+    close(newfdnum);
+  801c0d:	44 89 e7             	mov    %r12d,%edi
+  801c10:	48 b8 84 1b 80 00 00 	movabs $0x801b84,%rax
+  801c17:	00 00 00 
+  801c1a:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  801c1c:	4d 63 ec             	movslq %r12d,%r13
+  801c1f:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  801c26:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  801c2a:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  801c2e:	4c 89 ff             	mov    %r15,%rdi
+  801c31:	49 be 70 19 80 00 00 	movabs $0x801970,%r14
+  801c38:	00 00 00 
+  801c3b:	41 ff d6             	call   *%r14
+  801c3e:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  801c41:	4c 89 ef             	mov    %r13,%rdi
+  801c44:	41 ff d6             	call   *%r14
+  801c47:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  801c4a:	48 89 df             	mov    %rbx,%rdi
+  801c4d:	48 b8 95 2a 80 00 00 	movabs $0x802a95,%rax
+  801c54:	00 00 00 
+  801c57:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  801c59:	a8 04                	test   $0x4,%al
+  801c5b:	74 2b                	je     801c88 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  801c5d:	41 89 c1             	mov    %eax,%r9d
+  801c60:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801c66:	4c 89 f1             	mov    %r14,%rcx
+  801c69:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c6e:	48 89 de             	mov    %rbx,%rsi
+  801c71:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c76:	48 b8 5e 12 80 00 00 	movabs $0x80125e,%rax
+  801c7d:	00 00 00 
+  801c80:	ff d0                	call   *%rax
+  801c82:	89 c3                	mov    %eax,%ebx
+  801c84:	85 c0                	test   %eax,%eax
+  801c86:	78 4e                	js     801cd6 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  801c88:	4c 89 ff             	mov    %r15,%rdi
+  801c8b:	48 b8 95 2a 80 00 00 	movabs $0x802a95,%rax
+  801c92:	00 00 00 
+  801c95:	ff d0                	call   *%rax
+  801c97:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801c9a:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801ca0:	4c 89 e9             	mov    %r13,%rcx
+  801ca3:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ca8:	4c 89 fe             	mov    %r15,%rsi
+  801cab:	bf 00 00 00 00       	mov    $0x0,%edi
+  801cb0:	48 b8 5e 12 80 00 00 	movabs $0x80125e,%rax
+  801cb7:	00 00 00 
+  801cba:	ff d0                	call   *%rax
+  801cbc:	89 c3                	mov    %eax,%ebx
+  801cbe:	85 c0                	test   %eax,%eax
+  801cc0:	78 14                	js     801cd6 <dup+0xf7>
+
+    return newfdnum;
+  801cc2:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  801cc5:	89 d8                	mov    %ebx,%eax
+  801cc7:	48 83 c4 18          	add    $0x18,%rsp
+  801ccb:	5b                   	pop    %rbx
+  801ccc:	41 5c                	pop    %r12
+  801cce:	41 5d                	pop    %r13
+  801cd0:	41 5e                	pop    %r14
+  801cd2:	41 5f                	pop    %r15
+  801cd4:	5d                   	pop    %rbp
+  801cd5:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  801cd6:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801cdb:	4c 89 ee             	mov    %r13,%rsi
+  801cde:	bf 00 00 00 00       	mov    $0x0,%edi
+  801ce3:	49 bc c3 12 80 00 00 	movabs $0x8012c3,%r12
+  801cea:	00 00 00 
+  801ced:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  801cf0:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801cf5:	4c 89 f6             	mov    %r14,%rsi
+  801cf8:	bf 00 00 00 00       	mov    $0x0,%edi
+  801cfd:	41 ff d4             	call   *%r12
+    return res;
+  801d00:	eb c3                	jmp    801cc5 <dup+0xe6>
+
+0000000000801d02 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  801d02:	55                   	push   %rbp
+  801d03:	48 89 e5             	mov    %rsp,%rbp
+  801d06:	41 56                	push   %r14
+  801d08:	41 55                	push   %r13
+  801d0a:	41 54                	push   %r12
+  801d0c:	53                   	push   %rbx
+  801d0d:	48 83 ec 10          	sub    $0x10,%rsp
+  801d11:	89 fb                	mov    %edi,%ebx
+  801d13:	49 89 f4             	mov    %rsi,%r12
+  801d16:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801d19:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801d1d:	48 b8 1f 1a 80 00 00 	movabs $0x801a1f,%rax
+  801d24:	00 00 00 
+  801d27:	ff d0                	call   *%rax
+  801d29:	85 c0                	test   %eax,%eax
+  801d2b:	78 4c                	js     801d79 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801d2d:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801d31:	41 8b 3e             	mov    (%r14),%edi
+  801d34:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801d38:	48 b8 6a 1a 80 00 00 	movabs $0x801a6a,%rax
+  801d3f:	00 00 00 
+  801d42:	ff d0                	call   *%rax
+  801d44:	85 c0                	test   %eax,%eax
+  801d46:	78 35                	js     801d7d <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801d48:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801d4c:	83 e0 03             	and    $0x3,%eax
+  801d4f:	83 f8 01             	cmp    $0x1,%eax
+  801d52:	74 2d                	je     801d81 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801d54:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801d58:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801d5c:	48 85 c0             	test   %rax,%rax
+  801d5f:	74 56                	je     801db7 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  801d61:	4c 89 ea             	mov    %r13,%rdx
+  801d64:	4c 89 e6             	mov    %r12,%rsi
+  801d67:	4c 89 f7             	mov    %r14,%rdi
+  801d6a:	ff d0                	call   *%rax
+}
+  801d6c:	48 83 c4 10          	add    $0x10,%rsp
+  801d70:	5b                   	pop    %rbx
+  801d71:	41 5c                	pop    %r12
+  801d73:	41 5d                	pop    %r13
+  801d75:	41 5e                	pop    %r14
+  801d77:	5d                   	pop    %rbp
+  801d78:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801d79:	48 98                	cltq
+  801d7b:	eb ef                	jmp    801d6c <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801d7d:	48 98                	cltq
+  801d7f:	eb eb                	jmp    801d6c <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801d81:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801d88:	00 00 00 
+  801d8b:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+  801d91:	89 da                	mov    %ebx,%edx
+  801d93:	48 bf c1 35 80 00 00 	movabs $0x8035c1,%rdi
+  801d9a:	00 00 00 
+  801d9d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801da2:	48 b9 22 03 80 00 00 	movabs $0x800322,%rcx
+  801da9:	00 00 00 
+  801dac:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801dae:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801db5:	eb b5                	jmp    801d6c <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801db7:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801dbe:	eb ac                	jmp    801d6c <read+0x6a>
+
+0000000000801dc0 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801dc0:	55                   	push   %rbp
+  801dc1:	48 89 e5             	mov    %rsp,%rbp
+  801dc4:	41 57                	push   %r15
+  801dc6:	41 56                	push   %r14
+  801dc8:	41 55                	push   %r13
+  801dca:	41 54                	push   %r12
+  801dcc:	53                   	push   %rbx
+  801dcd:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  801dd1:	48 85 d2             	test   %rdx,%rdx
+  801dd4:	74 54                	je     801e2a <readn+0x6a>
+  801dd6:	41 89 fd             	mov    %edi,%r13d
+  801dd9:	49 89 f6             	mov    %rsi,%r14
+  801ddc:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  801ddf:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  801de4:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  801de9:	49 bf 02 1d 80 00 00 	movabs $0x801d02,%r15
+  801df0:	00 00 00 
+  801df3:	4c 89 e2             	mov    %r12,%rdx
+  801df6:	48 29 f2             	sub    %rsi,%rdx
+  801df9:	4c 01 f6             	add    %r14,%rsi
+  801dfc:	44 89 ef             	mov    %r13d,%edi
+  801dff:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  801e02:	85 c0                	test   %eax,%eax
+  801e04:	78 20                	js     801e26 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  801e06:	01 c3                	add    %eax,%ebx
+  801e08:	85 c0                	test   %eax,%eax
+  801e0a:	74 08                	je     801e14 <readn+0x54>
+  801e0c:	48 63 f3             	movslq %ebx,%rsi
+  801e0f:	4c 39 e6             	cmp    %r12,%rsi
+  801e12:	72 df                	jb     801df3 <readn+0x33>
+    }
+    return res;
+  801e14:	48 63 c3             	movslq %ebx,%rax
+}
+  801e17:	48 83 c4 08          	add    $0x8,%rsp
+  801e1b:	5b                   	pop    %rbx
+  801e1c:	41 5c                	pop    %r12
+  801e1e:	41 5d                	pop    %r13
+  801e20:	41 5e                	pop    %r14
+  801e22:	41 5f                	pop    %r15
+  801e24:	5d                   	pop    %rbp
+  801e25:	c3                   	ret
+        if (inc < 0) return inc;
+  801e26:	48 98                	cltq
+  801e28:	eb ed                	jmp    801e17 <readn+0x57>
+    int inc = 1, res = 0;
+  801e2a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801e2f:	eb e3                	jmp    801e14 <readn+0x54>
+
+0000000000801e31 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  801e31:	55                   	push   %rbp
+  801e32:	48 89 e5             	mov    %rsp,%rbp
+  801e35:	41 56                	push   %r14
+  801e37:	41 55                	push   %r13
+  801e39:	41 54                	push   %r12
+  801e3b:	53                   	push   %rbx
+  801e3c:	48 83 ec 10          	sub    $0x10,%rsp
+  801e40:	89 fb                	mov    %edi,%ebx
+  801e42:	49 89 f4             	mov    %rsi,%r12
+  801e45:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801e48:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801e4c:	48 b8 1f 1a 80 00 00 	movabs $0x801a1f,%rax
+  801e53:	00 00 00 
+  801e56:	ff d0                	call   *%rax
+  801e58:	85 c0                	test   %eax,%eax
+  801e5a:	78 47                	js     801ea3 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801e5c:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801e60:	41 8b 3e             	mov    (%r14),%edi
+  801e63:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801e67:	48 b8 6a 1a 80 00 00 	movabs $0x801a6a,%rax
+  801e6e:	00 00 00 
+  801e71:	ff d0                	call   *%rax
+  801e73:	85 c0                	test   %eax,%eax
+  801e75:	78 30                	js     801ea7 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801e77:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  801e7c:	74 2d                	je     801eab <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801e7e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801e82:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801e86:	48 85 c0             	test   %rax,%rax
+  801e89:	74 56                	je     801ee1 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  801e8b:	4c 89 ea             	mov    %r13,%rdx
+  801e8e:	4c 89 e6             	mov    %r12,%rsi
+  801e91:	4c 89 f7             	mov    %r14,%rdi
+  801e94:	ff d0                	call   *%rax
+}
+  801e96:	48 83 c4 10          	add    $0x10,%rsp
+  801e9a:	5b                   	pop    %rbx
+  801e9b:	41 5c                	pop    %r12
+  801e9d:	41 5d                	pop    %r13
+  801e9f:	41 5e                	pop    %r14
+  801ea1:	5d                   	pop    %rbp
+  801ea2:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801ea3:	48 98                	cltq
+  801ea5:	eb ef                	jmp    801e96 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801ea7:	48 98                	cltq
+  801ea9:	eb eb                	jmp    801e96 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801eab:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801eb2:	00 00 00 
+  801eb5:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+  801ebb:	89 da                	mov    %ebx,%edx
+  801ebd:	48 bf dd 35 80 00 00 	movabs $0x8035dd,%rdi
+  801ec4:	00 00 00 
+  801ec7:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ecc:	48 b9 22 03 80 00 00 	movabs $0x800322,%rcx
+  801ed3:	00 00 00 
+  801ed6:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801ed8:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801edf:	eb b5                	jmp    801e96 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801ee1:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801ee8:	eb ac                	jmp    801e96 <write+0x65>
+
+0000000000801eea <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  801eea:	55                   	push   %rbp
+  801eeb:	48 89 e5             	mov    %rsp,%rbp
+  801eee:	53                   	push   %rbx
+  801eef:	48 83 ec 18          	sub    $0x18,%rsp
+  801ef3:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801ef5:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801ef9:	48 b8 1f 1a 80 00 00 	movabs $0x801a1f,%rax
+  801f00:	00 00 00 
+  801f03:	ff d0                	call   *%rax
+  801f05:	85 c0                	test   %eax,%eax
+  801f07:	78 0c                	js     801f15 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  801f09:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801f0d:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  801f10:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801f15:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801f19:	c9                   	leave
+  801f1a:	c3                   	ret
+
+0000000000801f1b <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  801f1b:	55                   	push   %rbp
+  801f1c:	48 89 e5             	mov    %rsp,%rbp
+  801f1f:	41 55                	push   %r13
+  801f21:	41 54                	push   %r12
+  801f23:	53                   	push   %rbx
+  801f24:	48 83 ec 18          	sub    $0x18,%rsp
+  801f28:	89 fb                	mov    %edi,%ebx
+  801f2a:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801f2d:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801f31:	48 b8 1f 1a 80 00 00 	movabs $0x801a1f,%rax
+  801f38:	00 00 00 
+  801f3b:	ff d0                	call   *%rax
+  801f3d:	85 c0                	test   %eax,%eax
+  801f3f:	78 38                	js     801f79 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801f41:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  801f45:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  801f49:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801f4d:	48 b8 6a 1a 80 00 00 	movabs $0x801a6a,%rax
+  801f54:	00 00 00 
+  801f57:	ff d0                	call   *%rax
+  801f59:	85 c0                	test   %eax,%eax
+  801f5b:	78 1c                	js     801f79 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801f5d:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  801f62:	74 20                	je     801f84 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801f64:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801f68:	48 8b 40 30          	mov    0x30(%rax),%rax
+  801f6c:	48 85 c0             	test   %rax,%rax
+  801f6f:	74 47                	je     801fb8 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  801f71:	44 89 e6             	mov    %r12d,%esi
+  801f74:	4c 89 ef             	mov    %r13,%rdi
+  801f77:	ff d0                	call   *%rax
+}
+  801f79:	48 83 c4 18          	add    $0x18,%rsp
+  801f7d:	5b                   	pop    %rbx
+  801f7e:	41 5c                	pop    %r12
+  801f80:	41 5d                	pop    %r13
+  801f82:	5d                   	pop    %rbp
+  801f83:	c3                   	ret
+                thisenv->env_id, fdnum);
+  801f84:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801f8b:	00 00 00 
+  801f8e:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801f94:	89 da                	mov    %ebx,%edx
+  801f96:	48 bf a0 35 80 00 00 	movabs $0x8035a0,%rdi
+  801f9d:	00 00 00 
+  801fa0:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fa5:	48 b9 22 03 80 00 00 	movabs $0x800322,%rcx
+  801fac:	00 00 00 
+  801faf:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801fb1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801fb6:	eb c1                	jmp    801f79 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801fb8:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801fbd:	eb ba                	jmp    801f79 <ftruncate+0x5e>
+
+0000000000801fbf <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  801fbf:	55                   	push   %rbp
+  801fc0:	48 89 e5             	mov    %rsp,%rbp
+  801fc3:	41 54                	push   %r12
+  801fc5:	53                   	push   %rbx
+  801fc6:	48 83 ec 10          	sub    $0x10,%rsp
+  801fca:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801fcd:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801fd1:	48 b8 1f 1a 80 00 00 	movabs $0x801a1f,%rax
+  801fd8:	00 00 00 
+  801fdb:	ff d0                	call   *%rax
+  801fdd:	85 c0                	test   %eax,%eax
+  801fdf:	78 4e                	js     80202f <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801fe1:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801fe5:	41 8b 3c 24          	mov    (%r12),%edi
+  801fe9:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801fed:	48 b8 6a 1a 80 00 00 	movabs $0x801a6a,%rax
+  801ff4:	00 00 00 
+  801ff7:	ff d0                	call   *%rax
+  801ff9:	85 c0                	test   %eax,%eax
+  801ffb:	78 32                	js     80202f <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801ffd:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802001:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  802006:	74 30                	je     802038 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  802008:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  80200b:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  802012:	00 00 00 
+    stat->st_isdir = 0;
+  802015:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  80201c:	00 00 00 
+    stat->st_dev = dev;
+  80201f:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  802026:	48 89 de             	mov    %rbx,%rsi
+  802029:	4c 89 e7             	mov    %r12,%rdi
+  80202c:	ff 50 28             	call   *0x28(%rax)
+}
+  80202f:	48 83 c4 10          	add    $0x10,%rsp
+  802033:	5b                   	pop    %rbx
+  802034:	41 5c                	pop    %r12
+  802036:	5d                   	pop    %rbp
+  802037:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  802038:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80203d:	eb f0                	jmp    80202f <fstat+0x70>
+
+000000000080203f <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  80203f:	55                   	push   %rbp
+  802040:	48 89 e5             	mov    %rsp,%rbp
+  802043:	41 54                	push   %r12
+  802045:	53                   	push   %rbx
+  802046:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  802049:	be 00 00 00 00       	mov    $0x0,%esi
+  80204e:	48 b8 22 24 80 00 00 	movabs $0x802422,%rax
+  802055:	00 00 00 
+  802058:	ff d0                	call   *%rax
+  80205a:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  80205c:	85 c0                	test   %eax,%eax
+  80205e:	78 25                	js     802085 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  802060:	4c 89 e6             	mov    %r12,%rsi
+  802063:	89 c7                	mov    %eax,%edi
+  802065:	48 b8 bf 1f 80 00 00 	movabs $0x801fbf,%rax
+  80206c:	00 00 00 
+  80206f:	ff d0                	call   *%rax
+  802071:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  802074:	89 df                	mov    %ebx,%edi
+  802076:	48 b8 84 1b 80 00 00 	movabs $0x801b84,%rax
+  80207d:	00 00 00 
+  802080:	ff d0                	call   *%rax
+
+    return res;
+  802082:	44 89 e3             	mov    %r12d,%ebx
+}
+  802085:	89 d8                	mov    %ebx,%eax
+  802087:	5b                   	pop    %rbx
+  802088:	41 5c                	pop    %r12
+  80208a:	5d                   	pop    %rbp
+  80208b:	c3                   	ret
+
+000000000080208c <fsipc>:
+ * response may be written back to fsipcbuf.
+ * type: request code, passed as the simple integer IPC value.
+ * dstva: virtual address at which to receive reply page, 0 if none.
+ * Returns result from the file server. */
+static int
+fsipc(unsigned type, void *dstva) {
+  80208c:	55                   	push   %rbp
+  80208d:	48 89 e5             	mov    %rsp,%rbp
+  802090:	41 54                	push   %r12
+  802092:	53                   	push   %rbx
+  802093:	48 83 ec 10          	sub    $0x10,%rsp
+  802097:	41 89 fc             	mov    %edi,%r12d
+  80209a:	48 89 f3             	mov    %rsi,%rbx
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  80209d:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  8020a4:	00 00 00 
+  8020a7:	83 38 00             	cmpl   $0x0,(%rax)
+  8020aa:	74 5e                	je     80210a <fsipc+0x7e>
+    if (debug) {
+        cprintf("[%08x] fsipc %d %08x\n",
+                thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+    }
+
+    ipc_send(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW);
+  8020ac:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8020b2:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8020b7:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  8020be:	00 00 00 
+  8020c1:	44 89 e6             	mov    %r12d,%esi
+  8020c4:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  8020cb:	00 00 00 
+  8020ce:	8b 38                	mov    (%rax),%edi
+  8020d0:	48 b8 6b 18 80 00 00 	movabs $0x80186b,%rax
+  8020d7:	00 00 00 
+  8020da:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  8020dc:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  8020e3:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  8020e4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8020e9:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  8020ed:	48 89 de             	mov    %rbx,%rsi
+  8020f0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8020f5:	48 b8 96 17 80 00 00 	movabs $0x801796,%rax
+  8020fc:	00 00 00 
+  8020ff:	ff d0                	call   *%rax
+}
+  802101:	48 83 c4 10          	add    $0x10,%rsp
+  802105:	5b                   	pop    %rbx
+  802106:	41 5c                	pop    %r12
+  802108:	5d                   	pop    %rbp
+  802109:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  80210a:	bf 03 00 00 00       	mov    $0x3,%edi
+  80210f:	48 b8 0e 19 80 00 00 	movabs $0x80190e,%rax
+  802116:	00 00 00 
+  802119:	ff d0                	call   *%rax
+  80211b:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  802122:	00 00 
+  802124:	eb 86                	jmp    8020ac <fsipc+0x20>
+
+0000000000802126 <devfile_trunc>:
+    return 0;
+}
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  802126:	55                   	push   %rbp
+  802127:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  80212a:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  802131:	00 00 00 
+  802134:	8b 57 0c             	mov    0xc(%rdi),%edx
+  802137:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  802139:	89 70 04             	mov    %esi,0x4(%rax)
+
+    return fsipc(FSREQ_SET_SIZE, NULL);
+  80213c:	be 00 00 00 00       	mov    $0x0,%esi
+  802141:	bf 02 00 00 00       	mov    $0x2,%edi
+  802146:	48 b8 8c 20 80 00 00 	movabs $0x80208c,%rax
+  80214d:	00 00 00 
+  802150:	ff d0                	call   *%rax
+}
+  802152:	5d                   	pop    %rbp
+  802153:	c3                   	ret
+
+0000000000802154 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  802154:	55                   	push   %rbp
+  802155:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  802158:	8b 47 0c             	mov    0xc(%rdi),%eax
+  80215b:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  802162:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  802164:	be 00 00 00 00       	mov    $0x0,%esi
+  802169:	bf 06 00 00 00       	mov    $0x6,%edi
+  80216e:	48 b8 8c 20 80 00 00 	movabs $0x80208c,%rax
+  802175:	00 00 00 
+  802178:	ff d0                	call   *%rax
+}
+  80217a:	5d                   	pop    %rbp
+  80217b:	c3                   	ret
+
+000000000080217c <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  80217c:	55                   	push   %rbp
+  80217d:	48 89 e5             	mov    %rsp,%rbp
+  802180:	41 54                	push   %r12
+  802182:	53                   	push   %rbx
+  802183:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802186:	8b 47 0c             	mov    0xc(%rdi),%eax
+  802189:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  802190:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  802192:	be 00 00 00 00       	mov    $0x0,%esi
+  802197:	bf 05 00 00 00       	mov    $0x5,%edi
+  80219c:	48 b8 8c 20 80 00 00 	movabs $0x80208c,%rax
+  8021a3:	00 00 00 
+  8021a6:	ff d0                	call   *%rax
+    if (res < 0) {
+  8021a8:	85 c0                	test   %eax,%eax
+  8021aa:	78 3d                	js     8021e9 <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8021ac:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  8021b3:	00 00 00 
+  8021b6:	4c 89 e6             	mov    %r12,%rsi
+  8021b9:	48 89 df             	mov    %rbx,%rdi
+  8021bc:	48 b8 47 0c 80 00 00 	movabs $0x800c47,%rax
+  8021c3:	00 00 00 
+  8021c6:	ff d0                	call   *%rax
+    st->st_size  = fsipcbuf.statRet.ret_size;
+  8021c8:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  8021cf:	00 
+  8021d0:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8021d6:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  8021dd:	00 
+  8021de:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  8021e4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8021e9:	5b                   	pop    %rbx
+  8021ea:	41 5c                	pop    %r12
+  8021ec:	5d                   	pop    %rbp
+  8021ed:	c3                   	ret
+
+00000000008021ee <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  8021ee:	55                   	push   %rbp
+  8021ef:	48 89 e5             	mov    %rsp,%rbp
+  8021f2:	41 57                	push   %r15
+  8021f4:	41 56                	push   %r14
+  8021f6:	41 55                	push   %r13
+  8021f8:	41 54                	push   %r12
+  8021fa:	53                   	push   %rbx
+  8021fb:	48 83 ec 18          	sub    $0x18,%rsp
+  8021ff:	49 89 fe             	mov    %rdi,%r14
+  802202:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+  802206:	48 89 d3             	mov    %rdx,%rbx
+    while (n > sizeof(fsipcbuf.write.req_buf))
+  802209:	48 81 fa f0 0f 00 00 	cmp    $0xff0,%rdx
+  802210:	0f 86 e4 00 00 00    	jbe    8022fa <devfile_write+0x10c>
+  802216:	49 89 f4             	mov    %rsi,%r12
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802219:	49 bd 00 60 80 00 00 	movabs $0x806000,%r13
+  802220:	00 00 00 
+        memcpy(fsipcbuf.write.req_buf, buf, sizeof(fsipcbuf.write.req_buf));
+  802223:	49 bf a8 0e 80 00 00 	movabs $0x800ea8,%r15
+  80222a:	00 00 00 
+  80222d:	eb 03                	jmp    802232 <devfile_write+0x44>
+        buf += sizeof(fsipcbuf.write.req_buf);
+  80222f:	49 89 f4             	mov    %rsi,%r12
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802232:	41 8b 46 0c          	mov    0xc(%r14),%eax
+  802236:	41 89 45 00          	mov    %eax,0x0(%r13)
+        fsipcbuf.write.req_n      = sizeof(fsipcbuf.write.req_buf);
+  80223a:	49 c7 45 08 f0 0f 00 	movq   $0xff0,0x8(%r13)
+  802241:	00 
+        memcpy(fsipcbuf.write.req_buf, buf, sizeof(fsipcbuf.write.req_buf));
+  802242:	ba f0 0f 00 00       	mov    $0xff0,%edx
+  802247:	4c 89 e6             	mov    %r12,%rsi
+  80224a:	48 bf 10 60 80 00 00 	movabs $0x806010,%rdi
+  802251:	00 00 00 
+  802254:	41 ff d7             	call   *%r15
+        ssize_t res = fsipc(FSREQ_WRITE, NULL);
+  802257:	be 00 00 00 00       	mov    $0x0,%esi
+  80225c:	bf 04 00 00 00       	mov    $0x4,%edi
+  802261:	48 b8 8c 20 80 00 00 	movabs $0x80208c,%rax
+  802268:	00 00 00 
+  80226b:	ff d0                	call   *%rax
+  80226d:	48 63 d0             	movslq %eax,%rdx
+        if (res < 0 || res < sizeof(fsipcbuf.write.req_buf))
+  802270:	3d ef 0f 00 00       	cmp    $0xfef,%eax
+  802275:	7e 71                	jle    8022e8 <devfile_write+0xfa>
+        buf += sizeof(fsipcbuf.write.req_buf);
+  802277:	49 8d b4 24 f0 0f 00 	lea    0xff0(%r12),%rsi
+  80227e:	00 
+        n -= sizeof(fsipcbuf.write.req_buf);
+  80227f:	48 81 eb f0 0f 00 00 	sub    $0xff0,%rbx
+    while (n > sizeof(fsipcbuf.write.req_buf))
+  802286:	48 81 fb f0 0f 00 00 	cmp    $0xff0,%rbx
+  80228d:	77 a0                	ja     80222f <devfile_write+0x41>
+        written += sizeof(fsipcbuf.write.req_buf);
+  80228f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802293:	49 29 c4             	sub    %rax,%r12
+  802296:	4d 8d a4 24 f0 0f 00 	lea    0xff0(%r12),%r12
+  80229d:	00 
+    fsipcbuf.write.req_fileid = fd->fd_file.id;
+  80229e:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  8022a5:	00 00 00 
+  8022a8:	41 8b 56 0c          	mov    0xc(%r14),%edx
+  8022ac:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.write.req_n      = n;
+  8022ae:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    memcpy(fsipcbuf.write.req_buf, buf, n);
+  8022b2:	48 89 da             	mov    %rbx,%rdx
+  8022b5:	48 8d 78 10          	lea    0x10(%rax),%rdi
+  8022b9:	48 b8 a8 0e 80 00 00 	movabs $0x800ea8,%rax
+  8022c0:	00 00 00 
+  8022c3:	ff d0                	call   *%rax
+    ssize_t res = fsipc(FSREQ_WRITE, NULL);
+  8022c5:	be 00 00 00 00       	mov    $0x0,%esi
+  8022ca:	bf 04 00 00 00       	mov    $0x4,%edi
+  8022cf:	48 b8 8c 20 80 00 00 	movabs $0x80208c,%rax
+  8022d6:	00 00 00 
+  8022d9:	ff d0                	call   *%rax
+  8022db:	48 63 d0             	movslq %eax,%rdx
+    written += res;
+  8022de:	49 01 d4             	add    %rdx,%r12
+  8022e1:	48 85 d2             	test   %rdx,%rdx
+  8022e4:	49 0f 49 d4          	cmovns %r12,%rdx
+}
+  8022e8:	48 89 d0             	mov    %rdx,%rax
+  8022eb:	48 83 c4 18          	add    $0x18,%rsp
+  8022ef:	5b                   	pop    %rbx
+  8022f0:	41 5c                	pop    %r12
+  8022f2:	41 5d                	pop    %r13
+  8022f4:	41 5e                	pop    %r14
+  8022f6:	41 5f                	pop    %r15
+  8022f8:	5d                   	pop    %rbp
+  8022f9:	c3                   	ret
+    while (n > sizeof(fsipcbuf.write.req_buf))
+  8022fa:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+    ssize_t written = 0;
+  8022fe:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802304:	eb 98                	jmp    80229e <devfile_write+0xb0>
+
+0000000000802306 <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  802306:	55                   	push   %rbp
+  802307:	48 89 e5             	mov    %rsp,%rbp
+  80230a:	41 57                	push   %r15
+  80230c:	41 56                	push   %r14
+  80230e:	41 55                	push   %r13
+  802310:	41 54                	push   %r12
+  802312:	53                   	push   %rbx
+  802313:	48 83 ec 18          	sub    $0x18,%rsp
+  802317:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  80231b:	49 89 f6             	mov    %rsi,%r14
+  80231e:	49 89 d4             	mov    %rdx,%r12
+    while (n > sizeof(fsipcbuf.readRet.ret_buf))
+  802321:	48 81 fa 00 10 00 00 	cmp    $0x1000,%rdx
+  802328:	0f 86 ea 00 00 00    	jbe    802418 <devfile_read+0x112>
+    ssize_t readsz = 0;
+  80232e:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  802335:	00 
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802336:	49 bf 00 60 80 00 00 	movabs $0x806000,%r15
+  80233d:	00 00 00 
+  802340:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802344:	8b 40 0c             	mov    0xc(%rax),%eax
+  802347:	41 89 07             	mov    %eax,(%r15)
+        fsipcbuf.read.req_n = sizeof(fsipcbuf.readRet.ret_buf);
+  80234a:	49 c7 47 08 00 10 00 	movq   $0x1000,0x8(%r15)
+  802351:	00 
+        ssize_t res = fsipc(FSREQ_READ, NULL);
+  802352:	be 00 00 00 00       	mov    $0x0,%esi
+  802357:	bf 03 00 00 00       	mov    $0x3,%edi
+  80235c:	48 b8 8c 20 80 00 00 	movabs $0x80208c,%rax
+  802363:	00 00 00 
+  802366:	ff d0                	call   *%rax
+  802368:	4c 63 e8             	movslq %eax,%r13
+        if (res < 0)
+  80236b:	4d 85 ed             	test   %r13,%r13
+  80236e:	0f 88 92 00 00 00    	js     802406 <devfile_read+0x100>
+        memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  802374:	4c 89 ea             	mov    %r13,%rdx
+  802377:	4c 89 fe             	mov    %r15,%rsi
+  80237a:	4c 89 f7             	mov    %r14,%rdi
+  80237d:	48 b8 a8 0e 80 00 00 	movabs $0x800ea8,%rax
+  802384:	00 00 00 
+  802387:	ff d0                	call   *%rax
+        if (res < sizeof(fsipcbuf.readRet.ret_buf))
+  802389:	49 81 fd ff 0f 00 00 	cmp    $0xfff,%r13
+  802390:	76 6d                	jbe    8023ff <devfile_read+0xf9>
+        readsz += res;
+  802392:	4c 01 6d c0          	add    %r13,-0x40(%rbp)
+        buf += res;
+  802396:	4d 01 ee             	add    %r13,%r14
+        n -= res;
+  802399:	4d 29 ec             	sub    %r13,%r12
+    while (n > sizeof(fsipcbuf.readRet.ret_buf))
+  80239c:	49 81 fc 00 10 00 00 	cmp    $0x1000,%r12
+  8023a3:	77 9b                	ja     802340 <devfile_read+0x3a>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8023a5:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  8023ac:	00 00 00 
+  8023af:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  8023b3:	8b 51 0c             	mov    0xc(%rcx),%edx
+  8023b6:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.read.req_n = n;
+  8023b8:	4c 89 60 08          	mov    %r12,0x8(%rax)
+    ssize_t res = fsipc(FSREQ_READ, NULL);
+  8023bc:	be 00 00 00 00       	mov    $0x0,%esi
+  8023c1:	bf 03 00 00 00       	mov    $0x3,%edi
+  8023c6:	48 b8 8c 20 80 00 00 	movabs $0x80208c,%rax
+  8023cd:	00 00 00 
+  8023d0:	ff d0                	call   *%rax
+  8023d2:	4c 63 e8             	movslq %eax,%r13
+    if (res < 0)
+  8023d5:	4d 85 ed             	test   %r13,%r13
+  8023d8:	78 2c                	js     802406 <devfile_read+0x100>
+    memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  8023da:	4c 89 ea             	mov    %r13,%rdx
+  8023dd:	48 be 00 60 80 00 00 	movabs $0x806000,%rsi
+  8023e4:	00 00 00 
+  8023e7:	4c 89 f7             	mov    %r14,%rdi
+  8023ea:	48 b8 a8 0e 80 00 00 	movabs $0x800ea8,%rax
+  8023f1:	00 00 00 
+  8023f4:	ff d0                	call   *%rax
+    readsz += res;
+  8023f6:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8023fa:	49 01 c5             	add    %rax,%r13
+    return readsz;
+  8023fd:	eb 07                	jmp    802406 <devfile_read+0x100>
+            return readsz + res;
+  8023ff:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802403:	49 01 c5             	add    %rax,%r13
+}
+  802406:	4c 89 e8             	mov    %r13,%rax
+  802409:	48 83 c4 18          	add    $0x18,%rsp
+  80240d:	5b                   	pop    %rbx
+  80240e:	41 5c                	pop    %r12
+  802410:	41 5d                	pop    %r13
+  802412:	41 5e                	pop    %r14
+  802414:	41 5f                	pop    %r15
+  802416:	5d                   	pop    %rbp
+  802417:	c3                   	ret
+    ssize_t readsz = 0;
+  802418:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  80241f:	00 
+  802420:	eb 83                	jmp    8023a5 <devfile_read+0x9f>
+
+0000000000802422 <open>:
+open(const char *path, int mode) {
+  802422:	55                   	push   %rbp
+  802423:	48 89 e5             	mov    %rsp,%rbp
+  802426:	41 55                	push   %r13
+  802428:	41 54                	push   %r12
+  80242a:	53                   	push   %rbx
+  80242b:	48 83 ec 18          	sub    $0x18,%rsp
+  80242f:	49 89 fc             	mov    %rdi,%r12
+  802432:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  802435:	48 b8 09 0c 80 00 00 	movabs $0x800c09,%rax
+  80243c:	00 00 00 
+  80243f:	ff d0                	call   *%rax
+  802441:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802447:	0f 87 8a 00 00 00    	ja     8024d7 <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  80244d:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802451:	48 b8 05 1a 80 00 00 	movabs $0x801a05,%rax
+  802458:	00 00 00 
+  80245b:	ff d0                	call   *%rax
+  80245d:	89 c3                	mov    %eax,%ebx
+  80245f:	85 c0                	test   %eax,%eax
+  802461:	78 50                	js     8024b3 <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  802463:	4c 89 e6             	mov    %r12,%rsi
+  802466:	48 bb 00 60 80 00 00 	movabs $0x806000,%rbx
+  80246d:	00 00 00 
+  802470:	48 89 df             	mov    %rbx,%rdi
+  802473:	48 b8 47 0c 80 00 00 	movabs $0x800c47,%rax
+  80247a:	00 00 00 
+  80247d:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  80247f:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  802486:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  80248a:	bf 01 00 00 00       	mov    $0x1,%edi
+  80248f:	48 b8 8c 20 80 00 00 	movabs $0x80208c,%rax
+  802496:	00 00 00 
+  802499:	ff d0                	call   *%rax
+  80249b:	89 c3                	mov    %eax,%ebx
+  80249d:	85 c0                	test   %eax,%eax
+  80249f:	78 1f                	js     8024c0 <open+0x9e>
+    return fd2num(fd);
+  8024a1:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8024a5:	48 b8 5e 19 80 00 00 	movabs $0x80195e,%rax
+  8024ac:	00 00 00 
+  8024af:	ff d0                	call   *%rax
+  8024b1:	89 c3                	mov    %eax,%ebx
+}
+  8024b3:	89 d8                	mov    %ebx,%eax
+  8024b5:	48 83 c4 18          	add    $0x18,%rsp
+  8024b9:	5b                   	pop    %rbx
+  8024ba:	41 5c                	pop    %r12
+  8024bc:	41 5d                	pop    %r13
+  8024be:	5d                   	pop    %rbp
+  8024bf:	c3                   	ret
+        fd_close(fd, 0);
+  8024c0:	be 00 00 00 00       	mov    $0x0,%esi
+  8024c5:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8024c9:	48 b8 da 1a 80 00 00 	movabs $0x801ada,%rax
+  8024d0:	00 00 00 
+  8024d3:	ff d0                	call   *%rax
+        return res;
+  8024d5:	eb dc                	jmp    8024b3 <open+0x91>
+        return -E_BAD_PATH;
+  8024d7:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  8024dc:	eb d5                	jmp    8024b3 <open+0x91>
+
+00000000008024de <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  8024de:	55                   	push   %rbp
+  8024df:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc(FSREQ_SYNC, NULL);
+  8024e2:	be 00 00 00 00       	mov    $0x0,%esi
+  8024e7:	bf 08 00 00 00       	mov    $0x8,%edi
+  8024ec:	48 b8 8c 20 80 00 00 	movabs $0x80208c,%rax
+  8024f3:	00 00 00 
+  8024f6:	ff d0                	call   *%rax
+}
+  8024f8:	5d                   	pop    %rbp
+  8024f9:	c3                   	ret
+
+00000000008024fa <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  8024fa:	55                   	push   %rbp
+  8024fb:	48 89 e5             	mov    %rsp,%rbp
+  8024fe:	41 54                	push   %r12
+  802500:	53                   	push   %rbx
+  802501:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802504:	48 b8 70 19 80 00 00 	movabs $0x801970,%rax
+  80250b:	00 00 00 
+  80250e:	ff d0                	call   *%rax
+  802510:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  802513:	48 be 20 36 80 00 00 	movabs $0x803620,%rsi
+  80251a:	00 00 00 
+  80251d:	48 89 df             	mov    %rbx,%rdi
+  802520:	48 b8 47 0c 80 00 00 	movabs $0x800c47,%rax
+  802527:	00 00 00 
+  80252a:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  80252c:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  802531:	41 2b 04 24          	sub    (%r12),%eax
+  802535:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  80253b:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  802542:	00 00 00 
+    stat->st_dev = &devpipe;
+  802545:	48 b8 60 40 80 00 00 	movabs $0x804060,%rax
+  80254c:	00 00 00 
+  80254f:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  802556:	b8 00 00 00 00       	mov    $0x0,%eax
+  80255b:	5b                   	pop    %rbx
+  80255c:	41 5c                	pop    %r12
+  80255e:	5d                   	pop    %rbp
+  80255f:	c3                   	ret
+
+0000000000802560 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  802560:	55                   	push   %rbp
+  802561:	48 89 e5             	mov    %rsp,%rbp
+  802564:	41 54                	push   %r12
+  802566:	53                   	push   %rbx
+  802567:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  80256a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80256f:	48 89 fe             	mov    %rdi,%rsi
+  802572:	bf 00 00 00 00       	mov    $0x0,%edi
+  802577:	49 bc c3 12 80 00 00 	movabs $0x8012c3,%r12
+  80257e:	00 00 00 
+  802581:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  802584:	48 89 df             	mov    %rbx,%rdi
+  802587:	48 b8 70 19 80 00 00 	movabs $0x801970,%rax
+  80258e:	00 00 00 
+  802591:	ff d0                	call   *%rax
+  802593:	48 89 c6             	mov    %rax,%rsi
+  802596:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80259b:	bf 00 00 00 00       	mov    $0x0,%edi
+  8025a0:	41 ff d4             	call   *%r12
+}
+  8025a3:	5b                   	pop    %rbx
+  8025a4:	41 5c                	pop    %r12
+  8025a6:	5d                   	pop    %rbp
+  8025a7:	c3                   	ret
+
+00000000008025a8 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8025a8:	55                   	push   %rbp
+  8025a9:	48 89 e5             	mov    %rsp,%rbp
+  8025ac:	41 57                	push   %r15
+  8025ae:	41 56                	push   %r14
+  8025b0:	41 55                	push   %r13
+  8025b2:	41 54                	push   %r12
+  8025b4:	53                   	push   %rbx
+  8025b5:	48 83 ec 18          	sub    $0x18,%rsp
+  8025b9:	49 89 fc             	mov    %rdi,%r12
+  8025bc:	49 89 f5             	mov    %rsi,%r13
+  8025bf:	49 89 d7             	mov    %rdx,%r15
+  8025c2:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8025c6:	48 b8 70 19 80 00 00 	movabs $0x801970,%rax
+  8025cd:	00 00 00 
+  8025d0:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  8025d2:	4d 85 ff             	test   %r15,%r15
+  8025d5:	0f 84 af 00 00 00    	je     80268a <devpipe_write+0xe2>
+  8025db:	48 89 c3             	mov    %rax,%rbx
+  8025de:	4c 89 f8             	mov    %r15,%rax
+  8025e1:	4d 89 ef             	mov    %r13,%r15
+  8025e4:	4c 01 e8             	add    %r13,%rax
+  8025e7:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8025eb:	49 bd cb 11 80 00 00 	movabs $0x8011cb,%r13
+  8025f2:	00 00 00 
+            sys_yield();
+  8025f5:	49 be 68 11 80 00 00 	movabs $0x801168,%r14
+  8025fc:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  8025ff:	8b 73 04             	mov    0x4(%rbx),%esi
+  802602:	48 63 ce             	movslq %esi,%rcx
+  802605:	48 63 03             	movslq (%rbx),%rax
+  802608:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  80260e:	48 39 c1             	cmp    %rax,%rcx
+  802611:	72 2e                	jb     802641 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802613:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802618:	48 89 da             	mov    %rbx,%rdx
+  80261b:	be 00 10 00 00       	mov    $0x1000,%esi
+  802620:	4c 89 e7             	mov    %r12,%rdi
+  802623:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  802626:	85 c0                	test   %eax,%eax
+  802628:	74 66                	je     802690 <devpipe_write+0xe8>
+            sys_yield();
+  80262a:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  80262d:	8b 73 04             	mov    0x4(%rbx),%esi
+  802630:	48 63 ce             	movslq %esi,%rcx
+  802633:	48 63 03             	movslq (%rbx),%rax
+  802636:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  80263c:	48 39 c1             	cmp    %rax,%rcx
+  80263f:	73 d2                	jae    802613 <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  802641:	41 0f b6 3f          	movzbl (%r15),%edi
+  802645:	48 89 ca             	mov    %rcx,%rdx
+  802648:	48 c1 ea 03          	shr    $0x3,%rdx
+  80264c:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  802653:	08 10 20 
+  802656:	48 f7 e2             	mul    %rdx
+  802659:	48 c1 ea 06          	shr    $0x6,%rdx
+  80265d:	48 89 d0             	mov    %rdx,%rax
+  802660:	48 c1 e0 09          	shl    $0x9,%rax
+  802664:	48 29 d0             	sub    %rdx,%rax
+  802667:	48 c1 e0 03          	shl    $0x3,%rax
+  80266b:	48 29 c1             	sub    %rax,%rcx
+  80266e:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  802673:	83 c6 01             	add    $0x1,%esi
+  802676:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  802679:	49 83 c7 01          	add    $0x1,%r15
+  80267d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802681:	49 39 c7             	cmp    %rax,%r15
+  802684:	0f 85 75 ff ff ff    	jne    8025ff <devpipe_write+0x57>
+    return n;
+  80268a:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80268e:	eb 05                	jmp    802695 <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  802690:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802695:	48 83 c4 18          	add    $0x18,%rsp
+  802699:	5b                   	pop    %rbx
+  80269a:	41 5c                	pop    %r12
+  80269c:	41 5d                	pop    %r13
+  80269e:	41 5e                	pop    %r14
+  8026a0:	41 5f                	pop    %r15
+  8026a2:	5d                   	pop    %rbp
+  8026a3:	c3                   	ret
+
+00000000008026a4 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  8026a4:	55                   	push   %rbp
+  8026a5:	48 89 e5             	mov    %rsp,%rbp
+  8026a8:	41 57                	push   %r15
+  8026aa:	41 56                	push   %r14
+  8026ac:	41 55                	push   %r13
+  8026ae:	41 54                	push   %r12
+  8026b0:	53                   	push   %rbx
+  8026b1:	48 83 ec 18          	sub    $0x18,%rsp
+  8026b5:	49 89 fc             	mov    %rdi,%r12
+  8026b8:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  8026bc:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8026c0:	48 b8 70 19 80 00 00 	movabs $0x801970,%rax
+  8026c7:	00 00 00 
+  8026ca:	ff d0                	call   *%rax
+  8026cc:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  8026cf:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8026d5:	49 bd cb 11 80 00 00 	movabs $0x8011cb,%r13
+  8026dc:	00 00 00 
+            sys_yield();
+  8026df:	49 be 68 11 80 00 00 	movabs $0x801168,%r14
+  8026e6:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  8026e9:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  8026ee:	74 7d                	je     80276d <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  8026f0:	8b 03                	mov    (%rbx),%eax
+  8026f2:	3b 43 04             	cmp    0x4(%rbx),%eax
+  8026f5:	75 26                	jne    80271d <devpipe_read+0x79>
+            if (i > 0) return i;
+  8026f7:	4d 85 ff             	test   %r15,%r15
+  8026fa:	75 77                	jne    802773 <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8026fc:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802701:	48 89 da             	mov    %rbx,%rdx
+  802704:	be 00 10 00 00       	mov    $0x1000,%esi
+  802709:	4c 89 e7             	mov    %r12,%rdi
+  80270c:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  80270f:	85 c0                	test   %eax,%eax
+  802711:	74 72                	je     802785 <devpipe_read+0xe1>
+            sys_yield();
+  802713:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  802716:	8b 03                	mov    (%rbx),%eax
+  802718:	3b 43 04             	cmp    0x4(%rbx),%eax
+  80271b:	74 df                	je     8026fc <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  80271d:	48 63 c8             	movslq %eax,%rcx
+  802720:	48 89 ca             	mov    %rcx,%rdx
+  802723:	48 c1 ea 03          	shr    $0x3,%rdx
+  802727:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  80272e:	08 10 20 
+  802731:	48 89 d0             	mov    %rdx,%rax
+  802734:	48 f7 e6             	mul    %rsi
+  802737:	48 c1 ea 06          	shr    $0x6,%rdx
+  80273b:	48 89 d0             	mov    %rdx,%rax
+  80273e:	48 c1 e0 09          	shl    $0x9,%rax
+  802742:	48 29 d0             	sub    %rdx,%rax
+  802745:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  80274c:	00 
+  80274d:	48 89 c8             	mov    %rcx,%rax
+  802750:	48 29 d0             	sub    %rdx,%rax
+  802753:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  802758:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80275c:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  802760:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  802763:	49 83 c7 01          	add    $0x1,%r15
+  802767:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  80276b:	75 83                	jne    8026f0 <devpipe_read+0x4c>
+    return n;
+  80276d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802771:	eb 03                	jmp    802776 <devpipe_read+0xd2>
+            if (i > 0) return i;
+  802773:	4c 89 f8             	mov    %r15,%rax
+}
+  802776:	48 83 c4 18          	add    $0x18,%rsp
+  80277a:	5b                   	pop    %rbx
+  80277b:	41 5c                	pop    %r12
+  80277d:	41 5d                	pop    %r13
+  80277f:	41 5e                	pop    %r14
+  802781:	41 5f                	pop    %r15
+  802783:	5d                   	pop    %rbp
+  802784:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  802785:	b8 00 00 00 00       	mov    $0x0,%eax
+  80278a:	eb ea                	jmp    802776 <devpipe_read+0xd2>
+
+000000000080278c <pipe>:
+pipe(int pfd[2]) {
+  80278c:	55                   	push   %rbp
+  80278d:	48 89 e5             	mov    %rsp,%rbp
+  802790:	41 55                	push   %r13
+  802792:	41 54                	push   %r12
+  802794:	53                   	push   %rbx
+  802795:	48 81 ec b8 00 00 00 	sub    $0xb8,%rsp
+  80279c:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  80279f:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  8027a3:	48 b8 05 1a 80 00 00 	movabs $0x801a05,%rax
+  8027aa:	00 00 00 
+  8027ad:	ff d0                	call   *%rax
+  8027af:	89 c3                	mov    %eax,%ebx
+  8027b1:	85 c0                	test   %eax,%eax
+  8027b3:	0f 88 51 01 00 00    	js     80290a <pipe+0x17e>
+        (res = fd_alloc_from(fd2num(fd0) + 1, &fd1)) < 0) goto err;
+  8027b9:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8027bd:	48 b8 5e 19 80 00 00 	movabs $0x80195e,%rax
+  8027c4:	00 00 00 
+  8027c7:	ff d0                	call   *%rax
+  8027c9:	8d 78 01             	lea    0x1(%rax),%edi
+  8027cc:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8027d0:	48 b8 8c 19 80 00 00 	movabs $0x80198c,%rax
+  8027d7:	00 00 00 
+  8027da:	ff d0                	call   *%rax
+  8027dc:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8027de:	85 c0                	test   %eax,%eax
+  8027e0:	0f 88 24 01 00 00    	js     80290a <pipe+0x17e>
+    va = fd2data(fd0);
+  8027e6:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8027ea:	48 bb 70 19 80 00 00 	movabs $0x801970,%rbx
+  8027f1:	00 00 00 
+  8027f4:	ff d3                	call   *%rbx
+  8027f6:	49 89 c5             	mov    %rax,%r13
+    struct RegionOp ops[] = {
+  8027f9:	48 8d bd 30 ff ff ff 	lea    -0xd0(%rbp),%rdi
+  802800:	b9 14 00 00 00       	mov    $0x14,%ecx
+  802805:	b8 00 00 00 00       	mov    $0x0,%eax
+  80280a:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+  80280d:	c7 85 34 ff ff ff 46 	movl   $0x46,-0xcc(%rbp)
+  802814:	00 00 00 
+  802817:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80281b:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+  802822:	48 c7 85 50 ff ff ff 	movq   $0x1000,-0xb0(%rbp)
+  802829:	00 10 00 00 
+  80282d:	c7 85 5c ff ff ff 46 	movl   $0x46,-0xa4(%rbp)
+  802834:	00 00 00 
+            {.type = REGION_ALLOC, .dstva = (uintptr_t)fd1, .size = PAGE_SIZE, .perm = PROT_RW | PROT_SHARE},
+  802837:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+    struct RegionOp ops[] = {
+  80283b:	48 89 bd 70 ff ff ff 	mov    %rdi,-0x90(%rbp)
+  802842:	48 c7 85 78 ff ff ff 	movq   $0x1000,-0x88(%rbp)
+  802849:	00 10 00 00 
+  80284d:	c7 45 84 46 00 00 00 	movl   $0x46,-0x7c(%rbp)
+  802854:	4c 89 6d 98          	mov    %r13,-0x68(%rbp)
+  802858:	48 c7 45 a0 00 10 00 	movq   $0x1000,-0x60(%rbp)
+  80285f:	00 
+  802860:	c7 45 a8 01 00 00 00 	movl   $0x1,-0x58(%rbp)
+  802867:	c7 45 ac 46 00 00 00 	movl   $0x46,-0x54(%rbp)
+  80286e:	4c 89 6d b8          	mov    %r13,-0x48(%rbp)
+            {.type = REGION_MAP, .srcva = (uintptr_t)va, .dstva = (uintptr_t)fd2data(fd1), .size = PAGE_SIZE, .perm = PROT_RW | PROT_SHARE},
+  802872:	ff d3                	call   *%rbx
+    struct RegionOp ops[] = {
+  802874:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802878:	48 c7 45 c8 00 10 00 	movq   $0x1000,-0x38(%rbp)
+  80287f:	00 
+    if ((res = sys_region_batch(ops, sizeof ops / sizeof *ops)) < 0) goto err1;
+  802880:	be 04 00 00 00       	mov    $0x4,%esi
+  802885:	48 8d bd 30 ff ff ff 	lea    -0xd0(%rbp),%rdi
+  80288c:	48 b8 2a 13 80 00 00 	movabs $0x80132a,%rax
+  802893:	00 00 00 
+  802896:	ff d0                	call   *%rax
+  802898:	89 c3                	mov    %eax,%ebx
+  80289a:	85 c0                	test   %eax,%eax
+  80289c:	0f 88 ad 00 00 00    	js     80294f <pipe+0x1c3>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8028a2:	be 00 10 00 00       	mov    $0x1000,%esi
+  8028a7:	4c 89 ef             	mov    %r13,%rdi
+  8028aa:	48 b8 99 11 80 00 00 	movabs $0x801199,%rax
+  8028b1:	00 00 00 
+  8028b4:	ff d0                	call   *%rax
+  8028b6:	83 f8 02             	cmp    $0x2,%eax
+  8028b9:	75 5f                	jne    80291a <pipe+0x18e>
+    fd0->fd_dev_id = devpipe.dev_id;
+  8028bb:	a1 60 40 80 00 00 00 	movabs 0x804060,%eax
+  8028c2:	00 00 
+  8028c4:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8028c8:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  8028ca:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8028ce:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  8028d5:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8028d9:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  8028db:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8028df:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  8028e6:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8028ea:	48 bb 5e 19 80 00 00 	movabs $0x80195e,%rbx
+  8028f1:	00 00 00 
+  8028f4:	ff d3                	call   *%rbx
+  8028f6:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  8028fa:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  8028fe:	ff d3                	call   *%rbx
+  802900:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  802905:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  80290a:	89 d8                	mov    %ebx,%eax
+  80290c:	48 81 c4 b8 00 00 00 	add    $0xb8,%rsp
+  802913:	5b                   	pop    %rbx
+  802914:	41 5c                	pop    %r12
+  802916:	41 5d                	pop    %r13
+  802918:	5d                   	pop    %rbp
+  802919:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  80291a:	48 b9 50 36 80 00 00 	movabs $0x803650,%rcx
+  802921:	00 00 00 
+  802924:	48 ba 27 36 80 00 00 	movabs $0x803627,%rdx
+  80292b:	00 00 00 
+  80292e:	be 33 00 00 00       	mov    $0x33,%esi
+  802933:	48 bf 3c 36 80 00 00 	movabs $0x80363c,%rdi
+  80293a:	00 00 00 
+  80293d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802942:	49 b8 b4 2e 80 00 00 	movabs $0x802eb4,%r8
+  802949:	00 00 00 
+  80294c:	41 ff d0             	call   *%r8
+        ops[i].type = REGION_UNMAP;
+  80294f:	c7 85 30 ff ff ff 02 	movl   $0x2,-0xd0(%rbp)
+  802956:	00 00 00 
+  802959:	c7 85 58 ff ff ff 02 	movl   $0x2,-0xa8(%rbp)
+  802960:	00 00 00 
+  802963:	c7 45 80 02 00 00 00 	movl   $0x2,-0x80(%rbp)
+  80296a:	c7 45 a8 02 00 00 00 	movl   $0x2,-0x58(%rbp)
+    sys_region_batch(ops, sizeof ops / sizeof *ops);
+  802971:	be 04 00 00 00       	mov    $0x4,%esi
+  802976:	48 8d bd 30 ff ff ff 	lea    -0xd0(%rbp),%rdi
+  80297d:	48 b8 2a 13 80 00 00 	movabs $0x80132a,%rax
+  802984:	00 00 00 
+  802987:	ff d0                	call   *%rax
+  802989:	e9 7c ff ff ff       	jmp    80290a <pipe+0x17e>
+
+000000000080298e <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  80298e:	55                   	push   %rbp
+  80298f:	48 89 e5             	mov    %rsp,%rbp
+  802992:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  802996:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80299a:	48 b8 1f 1a 80 00 00 	movabs $0x801a1f,%rax
+  8029a1:	00 00 00 
+  8029a4:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8029a6:	85 c0                	test   %eax,%eax
+  8029a8:	78 35                	js     8029df <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  8029aa:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8029ae:	48 b8 70 19 80 00 00 	movabs $0x801970,%rax
+  8029b5:	00 00 00 
+  8029b8:	ff d0                	call   *%rax
+  8029ba:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8029bd:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8029c2:	be 00 10 00 00       	mov    $0x1000,%esi
+  8029c7:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8029cb:	48 b8 cb 11 80 00 00 	movabs $0x8011cb,%rax
+  8029d2:	00 00 00 
+  8029d5:	ff d0                	call   *%rax
+  8029d7:	85 c0                	test   %eax,%eax
+  8029d9:	0f 94 c0             	sete   %al
+  8029dc:	0f b6 c0             	movzbl %al,%eax
+}
+  8029df:	c9                   	leave
+  8029e0:	c3                   	ret
+
+00000000008029e1 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8029e1:	48 89 f8             	mov    %rdi,%rax
+  8029e4:	48 c1 e8 27          	shr    $0x27,%rax
+  8029e8:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  8029ef:	01 00 00 
+  8029f2:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8029f6:	f6 c2 01             	test   $0x1,%dl
+  8029f9:	74 6d                	je     802a68 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8029fb:	48 89 f8             	mov    %rdi,%rax
+  8029fe:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802a02:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802a09:	01 00 00 
+  802a0c:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802a10:	f6 c2 01             	test   $0x1,%dl
+  802a13:	74 62                	je     802a77 <get_uvpt_entry+0x96>
+  802a15:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802a1c:	01 00 00 
+  802a1f:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802a23:	f6 c2 80             	test   $0x80,%dl
+  802a26:	75 4f                	jne    802a77 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  802a28:	48 89 f8             	mov    %rdi,%rax
+  802a2b:	48 c1 e8 15          	shr    $0x15,%rax
+  802a2f:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802a36:	01 00 00 
+  802a39:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802a3d:	f6 c2 01             	test   $0x1,%dl
+  802a40:	74 44                	je     802a86 <get_uvpt_entry+0xa5>
+  802a42:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802a49:	01 00 00 
+  802a4c:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802a50:	f6 c2 80             	test   $0x80,%dl
+  802a53:	75 31                	jne    802a86 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  802a55:	48 c1 ef 0c          	shr    $0xc,%rdi
+  802a59:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802a60:	01 00 00 
+  802a63:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  802a67:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  802a68:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  802a6f:	01 00 00 
+  802a72:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802a76:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  802a77:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802a7e:	01 00 00 
+  802a81:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802a85:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  802a86:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802a8d:	01 00 00 
+  802a90:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802a94:	c3                   	ret
+
+0000000000802a95 <get_prot>:
+
+int
+get_prot(void *va) {
+  802a95:	55                   	push   %rbp
+  802a96:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  802a99:	48 b8 e1 29 80 00 00 	movabs $0x8029e1,%rax
+  802aa0:	00 00 00 
+  802aa3:	ff d0                	call   *%rax
+  802aa5:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  802aa8:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  802aad:	89 c1                	mov    %eax,%ecx
+  802aaf:	83 c9 04             	or     $0x4,%ecx
+  802ab2:	f6 c2 01             	test   $0x1,%dl
+  802ab5:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  802ab8:	89 c1                	mov    %eax,%ecx
+  802aba:	83 c9 02             	or     $0x2,%ecx
+  802abd:	f6 c2 02             	test   $0x2,%dl
+  802ac0:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  802ac3:	89 c1                	mov    %eax,%ecx
+  802ac5:	83 c9 01             	or     $0x1,%ecx
+  802ac8:	48 85 d2             	test   %rdx,%rdx
+  802acb:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  802ace:	89 c1                	mov    %eax,%ecx
+  802ad0:	83 c9 40             	or     $0x40,%ecx
+  802ad3:	f6 c6 04             	test   $0x4,%dh
+  802ad6:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  802ad9:	5d                   	pop    %rbp
+  802ada:	c3                   	ret
+
+0000000000802adb <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  802adb:	55                   	push   %rbp
+  802adc:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  802adf:	48 b8 e1 29 80 00 00 	movabs $0x8029e1,%rax
+  802ae6:	00 00 00 
+  802ae9:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  802aeb:	48 c1 e8 06          	shr    $0x6,%rax
+  802aef:	83 e0 01             	and    $0x1,%eax
+}
+  802af2:	5d                   	pop    %rbp
+  802af3:	c3                   	ret
+
+0000000000802af4 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  802af4:	55                   	push   %rbp
+  802af5:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  802af8:	48 b8 e1 29 80 00 00 	movabs $0x8029e1,%rax
+  802aff:	00 00 00 
+  802b02:	ff d0                	call   *%rax
+  802b04:	83 e0 01             	and    $0x1,%eax
+}
+  802b07:	5d                   	pop    %rbp
+  802b08:	c3                   	ret
+
+0000000000802b09 <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  802b09:	55                   	push   %rbp
+  802b0a:	48 89 e5             	mov    %rsp,%rbp
+  802b0d:	41 57                	push   %r15
+  802b0f:	41 56                	push   %r14
+  802b11:	41 55                	push   %r13
+  802b13:	41 54                	push   %r12
+  802b15:	53                   	push   %rbx
+  802b16:	48 83 ec 38          	sub    $0x38,%rsp
+  802b1a:	49 89 f7             	mov    %rsi,%r15
+  802b1d:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+                    }
+                    continue;
+                }
+                for (int ptei = 0; ptei < PT_ENTRY_COUNT; ptei++) {
+                    uintptr_t pte_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, pdei, ptei, 0);
+                    pte_t pte = uvpt[VPT(pte_addr)];
+  802b23:	49 bd 00 00 00 00 00 	movabs $0x10000000000,%r13
+  802b2a:	01 00 00 
+  802b2d:	4d 89 e6             	mov    %r12,%r14
+  802b30:	49 89 fc             	mov    %rdi,%r12
+  802b33:	e9 19 01 00 00       	jmp    802c51 <foreach_shared_region+0x148>
+  802b38:	48 89 5d b0          	mov    %rbx,-0x50(%rbp)
+  802b3c:	4c 89 75 a8          	mov    %r14,-0x58(%rbp)
+  802b40:	eb 52                	jmp    802b94 <foreach_shared_region+0x8b>
+                for (int ptei = 0; ptei < PT_ENTRY_COUNT; ptei++) {
+  802b42:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802b49:	48 81 fb 00 00 20 00 	cmp    $0x200000,%rbx
+  802b50:	74 2e                	je     802b80 <foreach_shared_region+0x77>
+                    uintptr_t pte_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, pdei, ptei, 0);
+  802b52:	48 89 df             	mov    %rbx,%rdi
+  802b55:	4c 09 f7             	or     %r14,%rdi
+                    pte_t pte = uvpt[VPT(pte_addr)];
+  802b58:	48 89 f8             	mov    %rdi,%rax
+  802b5b:	48 c1 e8 0c          	shr    $0xc,%rax
+  802b5f:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+                    if ((pte & PTE_P) && (pte & PTE_SHARE)) {
+  802b64:	25 01 04 00 00       	and    $0x401,%eax
+  802b69:	48 3d 01 04 00 00    	cmp    $0x401,%rax
+  802b6f:	75 d1                	jne    802b42 <foreach_shared_region+0x39>
+                        fun((void*)pte_addr, (void*)(pte_addr + PAGE_SIZE), arg);
+  802b71:	48 8d b7 00 10 00 00 	lea    0x1000(%rdi),%rsi
+  802b78:	4c 89 fa             	mov    %r15,%rdx
+  802b7b:	41 ff d4             	call   *%r12
+  802b7e:	eb c2                	jmp    802b42 <foreach_shared_region+0x39>
+            for (int pdei = 0; pdei < PD_ENTRY_COUNT; pdei++) {
+  802b80:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  802b87:	00 
+  802b88:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802b8c:	48 3d 00 00 00 40    	cmp    $0x40000000,%rax
+  802b92:	74 46                	je     802bda <foreach_shared_region+0xd1>
+                uintptr_t pde_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, pdei, 0, 0);
+  802b94:	4c 8b 75 c8          	mov    -0x38(%rbp),%r14
+  802b98:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802b9c:	49 09 c6             	or     %rax,%r14
+                pde_t pde = uvpd[VPD(pde_addr)];
+  802b9f:	4c 89 f0             	mov    %r14,%rax
+  802ba2:	48 c1 e8 15          	shr    $0x15,%rax
+  802ba6:	48 b9 00 00 00 80 00 	movabs $0x10080000000,%rcx
+  802bad:	01 00 00 
+  802bb0:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+                if (!(pde & PTE_P)) {
+  802bb4:	a8 01                	test   $0x1,%al
+  802bb6:	74 c8                	je     802b80 <foreach_shared_region+0x77>
+                if (pde & PTE_PS) {
+  802bb8:	48 89 c3             	mov    %rax,%rbx
+  802bbb:	81 e3 80 00 00 00    	and    $0x80,%ebx
+  802bc1:	74 8f                	je     802b52 <foreach_shared_region+0x49>
+                    if (pde & PTE_SHARE) {
+  802bc3:	f6 c4 04             	test   $0x4,%ah
+  802bc6:	74 b8                	je     802b80 <foreach_shared_region+0x77>
+                        fun((void*)pde_addr, (void*)(pde_addr + 1024 * 1024 * 2), arg);
+  802bc8:	49 8d b6 00 00 20 00 	lea    0x200000(%r14),%rsi
+  802bcf:	4c 89 fa             	mov    %r15,%rdx
+  802bd2:	4c 89 f7             	mov    %r14,%rdi
+  802bd5:	41 ff d4             	call   *%r12
+  802bd8:	eb a6                	jmp    802b80 <foreach_shared_region+0x77>
+  802bda:	48 8b 5d b0          	mov    -0x50(%rbp),%rbx
+  802bde:	4c 8b 75 a8          	mov    -0x58(%rbp),%r14
+        for (int pdpei = 0; pdpei < PDP_ENTRY_COUNT; pdpei++) {
+  802be2:	48 81 c3 00 00 00 40 	add    $0x40000000,%rbx
+  802be9:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802bf0:	00 00 00 
+  802bf3:	48 39 c3             	cmp    %rax,%rbx
+  802bf6:	74 4c                	je     802c44 <foreach_shared_region+0x13b>
+            uintptr_t pdpe_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, 0, 0, 0);
+  802bf8:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802bfc:	48 09 d8             	or     %rbx,%rax
+  802bff:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+            pdpe_t pdpe = uvpdp[VPDP(pdpe_addr)];
+  802c03:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802c07:	48 b9 00 00 40 80 00 	movabs $0x10080400000,%rcx
+  802c0e:	01 00 00 
+  802c11:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+            if (!(pdpe & PTE_P)) {
+  802c15:	a8 01                	test   $0x1,%al
+  802c17:	74 c9                	je     802be2 <foreach_shared_region+0xd9>
+            if (pdpe & PTE_PS) {
+  802c19:	48 89 c1             	mov    %rax,%rcx
+  802c1c:	81 e1 80 00 00 00    	and    $0x80,%ecx
+  802c22:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  802c26:	0f 84 0c ff ff ff    	je     802b38 <foreach_shared_region+0x2f>
+                if (pdpe & PTE_SHARE) {
+  802c2c:	f6 c4 04             	test   $0x4,%ah
+  802c2f:	74 b1                	je     802be2 <foreach_shared_region+0xd9>
+                    fun((void*)pdpe_addr, (void*)(pdpe_addr + 1024 * 1024 * 1024), arg); 
+  802c31:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  802c35:	48 8d b7 00 00 00 40 	lea    0x40000000(%rdi),%rsi
+  802c3c:	4c 89 fa             	mov    %r15,%rdx
+  802c3f:	41 ff d4             	call   *%r12
+  802c42:	eb 9e                	jmp    802be2 <foreach_shared_region+0xd9>
+    for (int pml4ei = 0; pml4ei < PML4_ENTRY_COUNT; pml4ei++) {
+  802c44:	49 83 c6 01          	add    $0x1,%r14
+  802c48:	49 81 fe 00 02 00 00 	cmp    $0x200,%r14
+  802c4f:	74 24                	je     802c75 <foreach_shared_region+0x16c>
+        pml4e_t pml4e = uvpml4[VPML4(pml4_addr)];
+  802c51:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  802c58:	01 00 00 
+  802c5b:	4a 8b 04 f0          	mov    (%rax,%r14,8),%rax
+        if (!(pml4e & PTE_P)) {
+  802c5f:	a8 01                	test   $0x1,%al
+  802c61:	74 e1                	je     802c44 <foreach_shared_region+0x13b>
+  802c63:	4c 89 f0             	mov    %r14,%rax
+  802c66:	48 c1 e0 27          	shl    $0x27,%rax
+  802c6a:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  802c6e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802c73:	eb 83                	jmp    802bf8 <foreach_shared_region+0xef>
+            }
+        }
+    }
+    
+    return 0;
+}
+  802c75:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c7a:	48 83 c4 38          	add    $0x38,%rsp
+  802c7e:	5b                   	pop    %rbx
+  802c7f:	41 5c                	pop    %r12
+  802c81:	41 5d                	pop    %r13
+  802c83:	41 5e                	pop    %r14
+  802c85:	41 5f                	pop    %r15
+  802c87:	5d                   	pop    %rbp
+  802c88:	c3                   	ret
+
+0000000000802c89 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  802c89:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c8e:	c3                   	ret
+
+0000000000802c8f <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  802c8f:	55                   	push   %rbp
+  802c90:	48 89 e5             	mov    %rsp,%rbp
+  802c93:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  802c96:	48 be 74 36 80 00 00 	movabs $0x803674,%rsi
+  802c9d:	00 00 00 
+  802ca0:	48 b8 47 0c 80 00 00 	movabs $0x800c47,%rax
+  802ca7:	00 00 00 
+  802caa:	ff d0                	call   *%rax
+    return 0;
+}
+  802cac:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cb1:	5d                   	pop    %rbp
+  802cb2:	c3                   	ret
+
+0000000000802cb3 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  802cb3:	55                   	push   %rbp
+  802cb4:	48 89 e5             	mov    %rsp,%rbp
+  802cb7:	41 57                	push   %r15
+  802cb9:	41 56                	push   %r14
+  802cbb:	41 55                	push   %r13
+  802cbd:	41 54                	push   %r12
+  802cbf:	53                   	push   %rbx
+  802cc0:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  802cc7:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  802cce:	48 85 d2             	test   %rdx,%rdx
+  802cd1:	74 7a                	je     802d4d <devcons_write+0x9a>
+  802cd3:	49 89 d6             	mov    %rdx,%r14
+  802cd6:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802cdc:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  802ce1:	49 bf 41 0e 80 00 00 	movabs $0x800e41,%r15
+  802ce8:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  802ceb:	4c 89 f3             	mov    %r14,%rbx
+  802cee:	48 29 f3             	sub    %rsi,%rbx
+  802cf1:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802cf6:	48 39 c3             	cmp    %rax,%rbx
+  802cf9:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  802cfd:	4c 63 eb             	movslq %ebx,%r13
+  802d00:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  802d07:	48 01 c6             	add    %rax,%rsi
+  802d0a:	4c 89 ea             	mov    %r13,%rdx
+  802d0d:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802d14:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  802d17:	4c 89 ee             	mov    %r13,%rsi
+  802d1a:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802d21:	48 b8 6e 10 80 00 00 	movabs $0x80106e,%rax
+  802d28:	00 00 00 
+  802d2b:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  802d2d:	41 01 dc             	add    %ebx,%r12d
+  802d30:	49 63 f4             	movslq %r12d,%rsi
+  802d33:	4c 39 f6             	cmp    %r14,%rsi
+  802d36:	72 b3                	jb     802ceb <devcons_write+0x38>
+    return res;
+  802d38:	49 63 c4             	movslq %r12d,%rax
+}
+  802d3b:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  802d42:	5b                   	pop    %rbx
+  802d43:	41 5c                	pop    %r12
+  802d45:	41 5d                	pop    %r13
+  802d47:	41 5e                	pop    %r14
+  802d49:	41 5f                	pop    %r15
+  802d4b:	5d                   	pop    %rbp
+  802d4c:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  802d4d:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802d53:	eb e3                	jmp    802d38 <devcons_write+0x85>
+
+0000000000802d55 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  802d55:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  802d58:	ba 00 00 00 00       	mov    $0x0,%edx
+  802d5d:	48 85 c0             	test   %rax,%rax
+  802d60:	74 55                	je     802db7 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  802d62:	55                   	push   %rbp
+  802d63:	48 89 e5             	mov    %rsp,%rbp
+  802d66:	41 55                	push   %r13
+  802d68:	41 54                	push   %r12
+  802d6a:	53                   	push   %rbx
+  802d6b:	48 83 ec 08          	sub    $0x8,%rsp
+  802d6f:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  802d72:	48 bb 9b 10 80 00 00 	movabs $0x80109b,%rbx
+  802d79:	00 00 00 
+  802d7c:	49 bc 68 11 80 00 00 	movabs $0x801168,%r12
+  802d83:	00 00 00 
+  802d86:	eb 03                	jmp    802d8b <devcons_read+0x36>
+  802d88:	41 ff d4             	call   *%r12
+  802d8b:	ff d3                	call   *%rbx
+  802d8d:	85 c0                	test   %eax,%eax
+  802d8f:	74 f7                	je     802d88 <devcons_read+0x33>
+    if (c < 0) return c;
+  802d91:	48 63 d0             	movslq %eax,%rdx
+  802d94:	78 13                	js     802da9 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  802d96:	ba 00 00 00 00       	mov    $0x0,%edx
+  802d9b:	83 f8 04             	cmp    $0x4,%eax
+  802d9e:	74 09                	je     802da9 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  802da0:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  802da4:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  802da9:	48 89 d0             	mov    %rdx,%rax
+  802dac:	48 83 c4 08          	add    $0x8,%rsp
+  802db0:	5b                   	pop    %rbx
+  802db1:	41 5c                	pop    %r12
+  802db3:	41 5d                	pop    %r13
+  802db5:	5d                   	pop    %rbp
+  802db6:	c3                   	ret
+  802db7:	48 89 d0             	mov    %rdx,%rax
+  802dba:	c3                   	ret
+
+0000000000802dbb <cputchar>:
+cputchar(int ch) {
+  802dbb:	55                   	push   %rbp
+  802dbc:	48 89 e5             	mov    %rsp,%rbp
+  802dbf:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  802dc3:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  802dc7:	be 01 00 00 00       	mov    $0x1,%esi
+  802dcc:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  802dd0:	48 b8 6e 10 80 00 00 	movabs $0x80106e,%rax
+  802dd7:	00 00 00 
+  802dda:	ff d0                	call   *%rax
+}
+  802ddc:	c9                   	leave
+  802ddd:	c3                   	ret
+
+0000000000802dde <getchar>:
+getchar(void) {
+  802dde:	55                   	push   %rbp
+  802ddf:	48 89 e5             	mov    %rsp,%rbp
+  802de2:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  802de6:	ba 01 00 00 00       	mov    $0x1,%edx
+  802deb:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  802def:	bf 00 00 00 00       	mov    $0x0,%edi
+  802df4:	48 b8 02 1d 80 00 00 	movabs $0x801d02,%rax
+  802dfb:	00 00 00 
+  802dfe:	ff d0                	call   *%rax
+  802e00:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  802e02:	85 c0                	test   %eax,%eax
+  802e04:	78 06                	js     802e0c <getchar+0x2e>
+  802e06:	74 08                	je     802e10 <getchar+0x32>
+  802e08:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  802e0c:	89 d0                	mov    %edx,%eax
+  802e0e:	c9                   	leave
+  802e0f:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  802e10:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  802e15:	eb f5                	jmp    802e0c <getchar+0x2e>
+
+0000000000802e17 <iscons>:
+iscons(int fdnum) {
+  802e17:	55                   	push   %rbp
+  802e18:	48 89 e5             	mov    %rsp,%rbp
+  802e1b:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  802e1f:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802e23:	48 b8 1f 1a 80 00 00 	movabs $0x801a1f,%rax
+  802e2a:	00 00 00 
+  802e2d:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802e2f:	85 c0                	test   %eax,%eax
+  802e31:	78 18                	js     802e4b <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  802e33:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802e37:	48 b8 a0 40 80 00 00 	movabs $0x8040a0,%rax
+  802e3e:	00 00 00 
+  802e41:	8b 00                	mov    (%rax),%eax
+  802e43:	39 02                	cmp    %eax,(%rdx)
+  802e45:	0f 94 c0             	sete   %al
+  802e48:	0f b6 c0             	movzbl %al,%eax
+}
+  802e4b:	c9                   	leave
+  802e4c:	c3                   	ret
+
+0000000000802e4d <opencons>:
+opencons(void) {
+  802e4d:	55                   	push   %rbp
+  802e4e:	48 89 e5             	mov    %rsp,%rbp
+  802e51:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802e55:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  802e59:	48 b8 05 1a 80 00 00 	movabs $0x801a05,%rax
+  802e60:	00 00 00 
+  802e63:	ff d0                	call   *%rax
+  802e65:	85 c0                	test   %eax,%eax
+  802e67:	78 49                	js     802eb2 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  802e69:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802e6e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802e73:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  802e77:	bf 00 00 00 00       	mov    $0x0,%edi
+  802e7c:	48 b8 f7 11 80 00 00 	movabs $0x8011f7,%rax
+  802e83:	00 00 00 
+  802e86:	ff d0                	call   *%rax
+  802e88:	85 c0                	test   %eax,%eax
+  802e8a:	78 26                	js     802eb2 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  802e8c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802e90:	a1 a0 40 80 00 00 00 	movabs 0x8040a0,%eax
+  802e97:	00 00 
+  802e99:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  802e9b:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802e9f:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  802ea6:	48 b8 5e 19 80 00 00 	movabs $0x80195e,%rax
+  802ead:	00 00 00 
+  802eb0:	ff d0                	call   *%rax
+}
+  802eb2:	c9                   	leave
+  802eb3:	c3                   	ret
+
+0000000000802eb4 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  802eb4:	55                   	push   %rbp
+  802eb5:	48 89 e5             	mov    %rsp,%rbp
+  802eb8:	41 56                	push   %r14
+  802eba:	41 55                	push   %r13
+  802ebc:	41 54                	push   %r12
+  802ebe:	53                   	push   %rbx
+  802ebf:	48 83 ec 50          	sub    $0x50,%rsp
+  802ec3:	49 89 fc             	mov    %rdi,%r12
+  802ec6:	41 89 f5             	mov    %esi,%r13d
+  802ec9:	48 89 d3             	mov    %rdx,%rbx
+  802ecc:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  802ed0:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  802ed4:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  802ed8:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  802edf:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802ee3:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  802ee7:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  802eeb:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  802eef:	48 b8 00 40 80 00 00 	movabs $0x804000,%rax
+  802ef6:	00 00 00 
+  802ef9:	4c 8b 30             	mov    (%rax),%r14
+  802efc:	48 b8 37 11 80 00 00 	movabs $0x801137,%rax
+  802f03:	00 00 00 
+  802f06:	ff d0                	call   *%rax
+  802f08:	89 c6                	mov    %eax,%esi
+  802f0a:	45 89 e8             	mov    %r13d,%r8d
+  802f0d:	4c 89 e1             	mov    %r12,%rcx
+  802f10:	4c 89 f2             	mov    %r14,%rdx
+  802f13:	48 bf 80 36 80 00 00 	movabs $0x803680,%rdi
+  802f1a:	00 00 00 
+  802f1d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f22:	49 bc 22 03 80 00 00 	movabs $0x800322,%r12
+  802f29:	00 00 00 
+  802f2c:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  802f2f:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  802f33:	48 89 df             	mov    %rbx,%rdi
+  802f36:	48 b8 be 02 80 00 00 	movabs $0x8002be,%rax
+  802f3d:	00 00 00 
+  802f40:	ff d0                	call   *%rax
+    cprintf("\n");
+  802f42:	48 bf db 35 80 00 00 	movabs $0x8035db,%rdi
+  802f49:	00 00 00 
+  802f4c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f51:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  802f54:	cc                   	int3
+  802f55:	eb fd                	jmp    802f54 <_panic+0xa0>
+  802f57:	90                   	nop
+
+0000000000802f58 <__rodata_start>:
+  802f58:	63 74 78 73          	movsxd 0x73(%rax,%rdi,2),%esi
+  802f5c:	77 69                	ja     802fc7 <__rodata_start+0x6f>
+  802f5e:	74 63                	je     802fc3 <__rodata_start+0x6b>
+  802f60:	68 3a 20 25 64       	push   $0x6425203a
+  802f65:	20 72 6f             	and    %dh,0x6f(%rdx)
+  802f68:	75 6e                	jne    802fd8 <__rodata_start+0x80>
+  802f6a:	64 20 74 72 69       	and    %dh,%fs:0x69(%rdx,%rsi,2)
+  802f6f:	70 73                	jo     802fe4 <__rodata_start+0x8c>
+  802f71:	2c 20                	sub    $0x20,%al
+  802f73:	25 6c 75 20 63       	and    $0x6320756c,%eax
+  802f78:	79 63                	jns    802fdd <__rodata_start+0x85>
+  802f7a:	6c                   	insb   (%dx),%es:(%rdi)
+  802f7b:	65 73 20             	gs jae 802f9e <__rodata_start+0x46>
+  802f7e:	70 65                	jo     802fe5 <__rodata_start+0x8d>
+  802f80:	72 20                	jb     802fa2 <__rodata_start+0x4a>
+  802f82:	72 6f                	jb     802ff3 <__rodata_start+0x9b>
+  802f84:	75 6e                	jne    802ff4 <__rodata_start+0x9c>
+  802f86:	64 20 74 72 69       	and    %dh,%fs:0x69(%rdx,%rsi,2)
+  802f8b:	70 0a                	jo     802f97 <__rodata_start+0x3f>
+  802f8d:	00 3c 75 6e 6b 6e 6f 	add    %bh,0x6f6e6b6e(,%rsi,2)
+  802f94:	77 6e                	ja     803004 <__rodata_start+0xac>
+  802f96:	3e 00 30             	ds add %dh,(%rax)
+  802f99:	31 32                	xor    %esi,(%rdx)
+  802f9b:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  802fa2:	41                   	rex.B
+  802fa3:	42                   	rex.X
+  802fa4:	43                   	rex.XB
+  802fa5:	44                   	rex.R
+  802fa6:	45                   	rex.RB
+  802fa7:	46 00 30             	rex.RX add %r14b,(%rax)
+  802faa:	31 32                	xor    %esi,(%rdx)
+  802fac:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  802fb3:	61                   	(bad)
+  802fb4:	62 63 64 65 66       	(bad)
+  802fb9:	00 28                	add    %ch,(%rax)
+  802fbb:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802fbc:	75 6c                	jne    80302a <__rodata_start+0xd2>
+  802fbe:	6c                   	insb   (%dx),%es:(%rdi)
+  802fbf:	29 00                	sub    %eax,(%rax)
+  802fc1:	65 72 72             	gs jb  803036 <__rodata_start+0xde>
+  802fc4:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802fc5:	72 20                	jb     802fe7 <__rodata_start+0x8f>
+  802fc7:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  802fcc:	73 70                	jae    80303e <__rodata_start+0xe6>
+  802fce:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  802fd2:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  802fd9:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802fda:	72 00                	jb     802fdc <__rodata_start+0x84>
+  802fdc:	62 61 64 20 65       	(bad)
+  802fe1:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802fe2:	76 69                	jbe    80304d <__rodata_start+0xf5>
+  802fe4:	72 6f                	jb     803055 <__rodata_start+0xfd>
+  802fe6:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802fe7:	6d                   	insl   (%dx),%es:(%rdi)
+  802fe8:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  802fea:	74 00                	je     802fec <__rodata_start+0x94>
+  802fec:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  802ff3:	20 70 61             	and    %dh,0x61(%rax)
+  802ff6:	72 61                	jb     803059 <__rodata_start+0x101>
+  802ff8:	6d                   	insl   (%dx),%es:(%rdi)
+  802ff9:	65 74 65             	gs je  803061 <__rodata_start+0x109>
+  802ffc:	72 00                	jb     802ffe <__rodata_start+0xa6>
+  802ffe:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802fff:	75 74                	jne    803075 <__rodata_start+0x11d>
+  803001:	20 6f 66             	and    %ch,0x66(%rdi)
+  803004:	20 6d 65             	and    %ch,0x65(%rbp)
+  803007:	6d                   	insl   (%dx),%es:(%rdi)
+  803008:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803009:	72 79                	jb     803084 <__rodata_start+0x12c>
+  80300b:	00 6f 75             	add    %ch,0x75(%rdi)
+  80300e:	74 20                	je     803030 <__rodata_start+0xd8>
+  803010:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803011:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  803015:	76 69                	jbe    803080 <__rodata_start+0x128>
+  803017:	72 6f                	jb     803088 <__rodata_start+0x130>
+  803019:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80301a:	6d                   	insl   (%dx),%es:(%rdi)
+  80301b:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  80301d:	74 73                	je     803092 <__rodata_start+0x13a>
+  80301f:	00 63 6f             	add    %ah,0x6f(%rbx)
+  803022:	72 72                	jb     803096 <__rodata_start+0x13e>
+  803024:	75 70                	jne    803096 <__rodata_start+0x13e>
+  803026:	74 65                	je     80308d <__rodata_start+0x135>
+  803028:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  80302d:	75 67                	jne    803096 <__rodata_start+0x13e>
+  80302f:	20 69 6e             	and    %ch,0x6e(%rcx)
+  803032:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  803034:	00 73 65             	add    %dh,0x65(%rbx)
+  803037:	67 6d                	insl   (%dx),%es:(%edi)
+  803039:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  80303b:	74 61                	je     80309e <__rodata_start+0x146>
+  80303d:	74 69                	je     8030a8 <__rodata_start+0x150>
+  80303f:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803040:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803041:	20 66 61             	and    %ah,0x61(%rsi)
+  803044:	75 6c                	jne    8030b2 <__rodata_start+0x15a>
+  803046:	74 00                	je     803048 <__rodata_start+0xf0>
+  803048:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  80304f:	20 45 4c             	and    %al,0x4c(%rbp)
+  803052:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  803056:	61                   	(bad)
+  803057:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  80305c:	20 73 75             	and    %dh,0x75(%rbx)
+  80305f:	63 68 20             	movsxd 0x20(%rax),%ebp
+  803062:	73 79                	jae    8030dd <__rodata_start+0x185>
+  803064:	73 74                	jae    8030da <__rodata_start+0x182>
+  803066:	65 6d                	gs insl (%dx),%es:(%rdi)
+  803068:	20 63 61             	and    %ah,0x61(%rbx)
+  80306b:	6c                   	insb   (%dx),%es:(%rdi)
+  80306c:	6c                   	insb   (%dx),%es:(%rdi)
+  80306d:	00 65 6e             	add    %ah,0x6e(%rbp)
+  803070:	74 72                	je     8030e4 <__rodata_start+0x18c>
+  803072:	79 20                	jns    803094 <__rodata_start+0x13c>
+  803074:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803075:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803076:	74 20                	je     803098 <__rodata_start+0x140>
+  803078:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  80307a:	75 6e                	jne    8030ea <__rodata_start+0x192>
+  80307c:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  803080:	76 20                	jbe    8030a2 <__rodata_start+0x14a>
+  803082:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  803089:	72 65                	jb     8030f0 <__rodata_start+0x198>
+  80308b:	63 76 69             	movsxd 0x69(%rsi),%esi
+  80308e:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80308f:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  803093:	65 78 70             	gs js  803106 <__rodata_start+0x1ae>
+  803096:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  80309b:	20 65 6e             	and    %ah,0x6e(%rbp)
+  80309e:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  8030a2:	20 66 69             	and    %ah,0x69(%rsi)
+  8030a5:	6c                   	insb   (%dx),%es:(%rdi)
+  8030a6:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  8030aa:	20 66 72             	and    %ah,0x72(%rsi)
+  8030ad:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  8030b2:	61                   	(bad)
+  8030b3:	63 65 20             	movsxd 0x20(%rbp),%esp
+  8030b6:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8030b7:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8030b8:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  8030bc:	6b 00 74             	imul   $0x74,(%rax),%eax
+  8030bf:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8030c0:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8030c1:	20 6d 61             	and    %ch,0x61(%rbp)
+  8030c4:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8030c5:	79 20                	jns    8030e7 <__rodata_start+0x18f>
+  8030c7:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  8030ce:	72 65                	jb     803135 <__rodata_start+0x1dd>
+  8030d0:	20 6f 70             	and    %ch,0x70(%rdi)
+  8030d3:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  8030d5:	00 66 69             	add    %ah,0x69(%rsi)
+  8030d8:	6c                   	insb   (%dx),%es:(%rdi)
+  8030d9:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  8030dd:	20 62 6c             	and    %ah,0x6c(%rdx)
+  8030e0:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8030e1:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  8030e4:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8030e5:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8030e6:	74 20                	je     803108 <__rodata_start+0x1b0>
+  8030e8:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  8030ea:	75 6e                	jne    80315a <__rodata_start+0x202>
+  8030ec:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  8030f0:	76 61                	jbe    803153 <__rodata_start+0x1fb>
+  8030f2:	6c                   	insb   (%dx),%es:(%rdi)
+  8030f3:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  8030fa:	00 
+  8030fb:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  803102:	72 65                	jb     803169 <__rodata_start+0x211>
+  803104:	61                   	(bad)
+  803105:	64 79 20             	fs jns 803128 <__rodata_start+0x1d0>
+  803108:	65 78 69             	gs js  803174 <__rodata_start+0x21c>
+  80310b:	73 74                	jae    803181 <__rodata_start+0x229>
+  80310d:	73 00                	jae    80310f <__rodata_start+0x1b7>
+  80310f:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803110:	70 65                	jo     803177 <__rodata_start+0x21f>
+  803112:	72 61                	jb     803175 <__rodata_start+0x21d>
+  803114:	74 69                	je     80317f <__rodata_start+0x227>
+  803116:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803117:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803118:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  80311b:	74 20                	je     80313d <__rodata_start+0x1e5>
+  80311d:	73 75                	jae    803194 <__rodata_start+0x23c>
+  80311f:	70 70                	jo     803191 <__rodata_start+0x239>
+  803121:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803122:	72 74                	jb     803198 <__rodata_start+0x240>
+  803124:	65 64 00 6f 70       	gs add %ch,%fs:0x70(%rdi)
+  803129:	65 72 61             	gs jb  80318d <__rodata_start+0x235>
+  80312c:	74 69                	je     803197 <__rodata_start+0x23f>
+  80312e:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80312f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803130:	20 69 6e             	and    %ch,0x6e(%rcx)
+  803133:	74 65                	je     80319a <__rodata_start+0x242>
+  803135:	72 72                	jb     8031a9 <__rodata_start+0x251>
+  803137:	75 70                	jne    8031a9 <__rodata_start+0x251>
+  803139:	74 65                	je     8031a0 <__rodata_start+0x248>
+  80313b:	64 00 6e 6f          	add    %ch,%fs:0x6f(%rsi)
+  80313f:	74 20                	je     803161 <__rodata_start+0x209>
+  803141:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803143:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803144:	75 67                	jne    8031ad <__rodata_start+0x255>
+  803146:	68 20 43 50 55       	push   $0x55504320
+  80314b:	20 74 69 6d          	and    %dh,0x6d(%rcx,%rbp,2)
+  80314f:	65 00 66 2e          	add    %ah,%gs:0x2e(%rsi)
+  803153:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+  80315a:	00 
+  80315b:	0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+  803160:	0f 05                	syscall
+  803162:	80 00 00             	addb   $0x0,(%rax)
+  803165:	00 00                	add    %al,(%rax)
+  803167:	00 50 0b             	add    %dl,0xb(%rax)
+  80316a:	80 00 00             	addb   $0x0,(%rax)
+  80316d:	00 00                	add    %al,(%rax)
+  80316f:	00 40 0b             	add    %al,0xb(%rax)
+  803172:	80 00 00             	addb   $0x0,(%rax)
+  803175:	00 00                	add    %al,(%rax)
+  803177:	00 50 0b             	add    %dl,0xb(%rax)
+  80317a:	80 00 00             	addb   $0x0,(%rax)
+  80317d:	00 00                	add    %al,(%rax)
+  80317f:	00 50 0b             	add    %dl,0xb(%rax)
+  803182:	80 00 00             	addb   $0x0,(%rax)
+  803185:	00 00                	add    %al,(%rax)
+  803187:	00 50 0b             	add    %dl,0xb(%rax)
+  80318a:	80 00 00             	addb   $0x0,(%rax)
+  80318d:	00 00                	add    %al,(%rax)
+  80318f:	00 50 0b             	add    %dl,0xb(%rax)
+  803192:	80 00 00             	addb   $0x0,(%rax)
+  803195:	00 00                	add    %al,(%rax)
+  803197:	00 2e                	add    %ch,(%rsi)
+  803199:	05 80 00 00 00       	add    $0x80,%eax
+  80319e:	00 00                	add    %al,(%rax)
+  8031a0:	50                   	push   %rax
+  8031a1:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  8031a7:	00 50 0b             	add    %dl,0xb(%rax)
+  8031aa:	80 00 00             	addb   $0x0,(%rax)
+  8031ad:	00 00                	add    %al,(%rax)
+  8031af:	00 22                	add    %ah,(%rdx)
+  8031b1:	05 80 00 00 00       	add    $0x80,%eax
+  8031b6:	00 00                	add    %al,(%rax)
+  8031b8:	9c                   	pushf
+  8031b9:	05 80 00 00 00       	add    $0x80,%eax
+  8031be:	00 00                	add    %al,(%rax)
+  8031c0:	50                   	push   %rax
+  8031c1:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  8031c7:	00 22                	add    %ah,(%rdx)
+  8031c9:	05 80 00 00 00       	add    $0x80,%eax
+  8031ce:	00 00                	add    %al,(%rax)
+  8031d0:	68 05 80 00 00       	push   $0x8005
+  8031d5:	00 00                	add    %al,(%rax)
+  8031d7:	00 68 05             	add    %ch,0x5(%rax)
+  8031da:	80 00 00             	addb   $0x0,(%rax)
+  8031dd:	00 00                	add    %al,(%rax)
+  8031df:	00 68 05             	add    %ch,0x5(%rax)
+  8031e2:	80 00 00             	addb   $0x0,(%rax)
+  8031e5:	00 00                	add    %al,(%rax)
+  8031e7:	00 68 05             	add    %ch,0x5(%rax)
+  8031ea:	80 00 00             	addb   $0x0,(%rax)
+  8031ed:	00 00                	add    %al,(%rax)
+  8031ef:	00 68 05             	add    %ch,0x5(%rax)
+  8031f2:	80 00 00             	addb   $0x0,(%rax)
+  8031f5:	00 00                	add    %al,(%rax)
+  8031f7:	00 68 05             	add    %ch,0x5(%rax)
+  8031fa:	80 00 00             	addb   $0x0,(%rax)
+  8031fd:	00 00                	add    %al,(%rax)
+  8031ff:	00 68 05             	add    %ch,0x5(%rax)
+  803202:	80 00 00             	addb   $0x0,(%rax)
+  803205:	00 00                	add    %al,(%rax)
+  803207:	00 68 05             	add    %ch,0x5(%rax)
+  80320a:	80 00 00             	addb   $0x0,(%rax)
+  80320d:	00 00                	add    %al,(%rax)
+  80320f:	00 68 05             	add    %ch,0x5(%rax)
+  803212:	80 00 00             	addb   $0x0,(%rax)
+  803215:	00 00                	add    %al,(%rax)
+  803217:	00 50 0b             	add    %dl,0xb(%rax)
+  80321a:	80 00 00             	addb   $0x0,(%rax)
+  80321d:	00 00                	add    %al,(%rax)
+  80321f:	00 50 0b             	add    %dl,0xb(%rax)
+  803222:	80 00 00             	addb   $0x0,(%rax)
+  803225:	00 00                	add    %al,(%rax)
+  803227:	00 50 0b             	add    %dl,0xb(%rax)
+  80322a:	80 00 00             	addb   $0x0,(%rax)
+  80322d:	00 00                	add    %al,(%rax)
+  80322f:	00 50 0b             	add    %dl,0xb(%rax)
+  803232:	80 00 00             	addb   $0x0,(%rax)
+  803235:	00 00                	add    %al,(%rax)
+  803237:	00 50 0b             	add    %dl,0xb(%rax)
+  80323a:	80 00 00             	addb   $0x0,(%rax)
+  80323d:	00 00                	add    %al,(%rax)
+  80323f:	00 50 0b             	add    %dl,0xb(%rax)
+  803242:	80 00 00             	addb   $0x0,(%rax)
+  803245:	00 00                	add    %al,(%rax)
+  803247:	00 50 0b             	add    %dl,0xb(%rax)
+  80324a:	80 00 00             	addb   $0x0,(%rax)
+  80324d:	00 00                	add    %al,(%rax)
+  80324f:	00 50 0b             	add    %dl,0xb(%rax)
+  803252:	80 00 00             	addb   $0x0,(%rax)
+  803255:	00 00                	add    %al,(%rax)
+  803257:	00 50 0b             	add    %dl,0xb(%rax)
+  80325a:	80 00 00             	addb   $0x0,(%rax)
+  80325d:	00 00                	add    %al,(%rax)
+  80325f:	00 50 0b             	add    %dl,0xb(%rax)
+  803262:	80 00 00             	addb   $0x0,(%rax)
+  803265:	00 00                	add    %al,(%rax)
+  803267:	00 50 0b             	add    %dl,0xb(%rax)
+  80326a:	80 00 00             	addb   $0x0,(%rax)
+  80326d:	00 00                	add    %al,(%rax)
+  80326f:	00 50 0b             	add    %dl,0xb(%rax)
+  803272:	80 00 00             	addb   $0x0,(%rax)
+  803275:	00 00                	add    %al,(%rax)
+  803277:	00 50 0b             	add    %dl,0xb(%rax)
+  80327a:	80 00 00             	addb   $0x0,(%rax)
+  80327d:	00 00                	add    %al,(%rax)
+  80327f:	00 50 0b             	add    %dl,0xb(%rax)
+  803282:	80 00 00             	addb   $0x0,(%rax)
+  803285:	00 00                	add    %al,(%rax)
+  803287:	00 50 0b             	add    %dl,0xb(%rax)
+  80328a:	80 00 00             	addb   $0x0,(%rax)
+  80328d:	00 00                	add    %al,(%rax)
+  80328f:	00 50 0b             	add    %dl,0xb(%rax)
+  803292:	80 00 00             	addb   $0x0,(%rax)
+  803295:	00 00                	add    %al,(%rax)
+  803297:	00 50 0b             	add    %dl,0xb(%rax)
+  80329a:	80 00 00             	addb   $0x0,(%rax)
+  80329d:	00 00                	add    %al,(%rax)
+  80329f:	00 50 0b             	add    %dl,0xb(%rax)
+  8032a2:	80 00 00             	addb   $0x0,(%rax)
+  8032a5:	00 00                	add    %al,(%rax)
+  8032a7:	00 50 0b             	add    %dl,0xb(%rax)
+  8032aa:	80 00 00             	addb   $0x0,(%rax)
+  8032ad:	00 00                	add    %al,(%rax)
+  8032af:	00 50 0b             	add    %dl,0xb(%rax)
+  8032b2:	80 00 00             	addb   $0x0,(%rax)
+  8032b5:	00 00                	add    %al,(%rax)
+  8032b7:	00 50 0b             	add    %dl,0xb(%rax)
+  8032ba:	80 00 00             	addb   $0x0,(%rax)
+  8032bd:	00 00                	add    %al,(%rax)
+  8032bf:	00 50 0b             	add    %dl,0xb(%rax)
+  8032c2:	80 00 00             	addb   $0x0,(%rax)
+  8032c5:	00 00                	add    %al,(%rax)
+  8032c7:	00 50 0b             	add    %dl,0xb(%rax)
+  8032ca:	80 00 00             	addb   $0x0,(%rax)
+  8032cd:	00 00                	add    %al,(%rax)
+  8032cf:	00 50 0b             	add    %dl,0xb(%rax)
+  8032d2:	80 00 00             	addb   $0x0,(%rax)
+  8032d5:	00 00                	add    %al,(%rax)
+  8032d7:	00 50 0b             	add    %dl,0xb(%rax)
+  8032da:	80 00 00             	addb   $0x0,(%rax)
+  8032dd:	00 00                	add    %al,(%rax)
+  8032df:	00 50 0b             	add    %dl,0xb(%rax)
+  8032e2:	80 00 00             	addb   $0x0,(%rax)
+  8032e5:	00 00                	add    %al,(%rax)
+  8032e7:	00 50 0b             	add    %dl,0xb(%rax)
+  8032ea:	80 00 00             	addb   $0x0,(%rax)
+  8032ed:	00 00                	add    %al,(%rax)
+  8032ef:	00 50 0b             	add    %dl,0xb(%rax)
+  8032f2:	80 00 00             	addb   $0x0,(%rax)
+  8032f5:	00 00                	add    %al,(%rax)
+  8032f7:	00 50 0b             	add    %dl,0xb(%rax)
+  8032fa:	80 00 00             	addb   $0x0,(%rax)
+  8032fd:	00 00                	add    %al,(%rax)
+  8032ff:	00 50 0b             	add    %dl,0xb(%rax)
+  803302:	80 00 00             	addb   $0x0,(%rax)
+  803305:	00 00                	add    %al,(%rax)
+  803307:	00 73 0a             	add    %dh,0xa(%rbx)
+  80330a:	80 00 00             	addb   $0x0,(%rax)
+  80330d:	00 00                	add    %al,(%rax)
+  80330f:	00 50 0b             	add    %dl,0xb(%rax)
+  803312:	80 00 00             	addb   $0x0,(%rax)
+  803315:	00 00                	add    %al,(%rax)
+  803317:	00 50 0b             	add    %dl,0xb(%rax)
+  80331a:	80 00 00             	addb   $0x0,(%rax)
+  80331d:	00 00                	add    %al,(%rax)
+  80331f:	00 50 0b             	add    %dl,0xb(%rax)
+  803322:	80 00 00             	addb   $0x0,(%rax)
+  803325:	00 00                	add    %al,(%rax)
+  803327:	00 50 0b             	add    %dl,0xb(%rax)
+  80332a:	80 00 00             	addb   $0x0,(%rax)
+  80332d:	00 00                	add    %al,(%rax)
+  80332f:	00 50 0b             	add    %dl,0xb(%rax)
+  803332:	80 00 00             	addb   $0x0,(%rax)
+  803335:	00 00                	add    %al,(%rax)
+  803337:	00 50 0b             	add    %dl,0xb(%rax)
+  80333a:	80 00 00             	addb   $0x0,(%rax)
+  80333d:	00 00                	add    %al,(%rax)
+  80333f:	00 50 0b             	add    %dl,0xb(%rax)
+  803342:	80 00 00             	addb   $0x0,(%rax)
+  803345:	00 00                	add    %al,(%rax)
+  803347:	00 50 0b             	add    %dl,0xb(%rax)
+  80334a:	80 00 00             	addb   $0x0,(%rax)
+  80334d:	00 00                	add    %al,(%rax)
+  80334f:	00 50 0b             	add    %dl,0xb(%rax)
+  803352:	80 00 00             	addb   $0x0,(%rax)
+  803355:	00 00                	add    %al,(%rax)
+  803357:	00 50 0b             	add    %dl,0xb(%rax)
+  80335a:	80 00 00             	addb   $0x0,(%rax)
+  80335d:	00 00                	add    %al,(%rax)
+  80335f:	00 bf 05 80 00 00    	add    %bh,0x8005(%rdi)
+  803365:	00 00                	add    %al,(%rax)
+  803367:	00 8e 07 80 00 00    	add    %cl,0x8007(%rsi)
+  80336d:	00 00                	add    %al,(%rax)
+  80336f:	00 50 0b             	add    %dl,0xb(%rax)
+  803372:	80 00 00             	addb   $0x0,(%rax)
+  803375:	00 00                	add    %al,(%rax)
+  803377:	00 50 0b             	add    %dl,0xb(%rax)
+  80337a:	80 00 00             	addb   $0x0,(%rax)
+  80337d:	00 00                	add    %al,(%rax)
+  80337f:	00 50 0b             	add    %dl,0xb(%rax)
+  803382:	80 00 00             	addb   $0x0,(%rax)
+  803385:	00 00                	add    %al,(%rax)
+  803387:	00 50 0b             	add    %dl,0xb(%rax)
+  80338a:	80 00 00             	addb   $0x0,(%rax)
+  80338d:	00 00                	add    %al,(%rax)
+  80338f:	00 ee                	add    %ch,%dh
+  803391:	05 80 00 00 00       	add    $0x80,%eax
+  803396:	00 00                	add    %al,(%rax)
+  803398:	50                   	push   %rax
+  803399:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  80339f:	00 50 0b             	add    %dl,0xb(%rax)
+  8033a2:	80 00 00             	addb   $0x0,(%rax)
+  8033a5:	00 00                	add    %al,(%rax)
+  8033a7:	00 b4 05 80 00 00 00 	add    %dh,0x80(%rbp,%rax,1)
+  8033ae:	00 00                	add    %al,(%rax)
+  8033b0:	50                   	push   %rax
+  8033b1:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  8033b7:	00 50 0b             	add    %dl,0xb(%rax)
+  8033ba:	80 00 00             	addb   $0x0,(%rax)
+  8033bd:	00 00                	add    %al,(%rax)
+  8033bf:	00 36                	add    %dh,(%rsi)
+  8033c1:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  8033c7:	00 00                	add    %al,(%rax)
+  8033c9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8033cf:	00 50 0b             	add    %dl,0xb(%rax)
+  8033d2:	80 00 00             	addb   $0x0,(%rax)
+  8033d5:	00 00                	add    %al,(%rax)
+  8033d7:	00 50 0b             	add    %dl,0xb(%rax)
+  8033da:	80 00 00             	addb   $0x0,(%rax)
+  8033dd:	00 00                	add    %al,(%rax)
+  8033df:	00 85 06 80 00 00    	add    %al,0x8006(%rbp)
+  8033e5:	00 00                	add    %al,(%rax)
+  8033e7:	00 50 0b             	add    %dl,0xb(%rax)
+  8033ea:	80 00 00             	addb   $0x0,(%rax)
+  8033ed:	00 00                	add    %al,(%rax)
+  8033ef:	00 62 08             	add    %ah,0x8(%rdx)
+  8033f2:	80 00 00             	addb   $0x0,(%rax)
+  8033f5:	00 00                	add    %al,(%rax)
+  8033f7:	00 50 0b             	add    %dl,0xb(%rax)
+  8033fa:	80 00 00             	addb   $0x0,(%rax)
+  8033fd:	00 00                	add    %al,(%rax)
+  8033ff:	00 50 0b             	add    %dl,0xb(%rax)
+  803402:	80 00 00             	addb   $0x0,(%rax)
+  803405:	00 00                	add    %al,(%rax)
+  803407:	00 73 0a             	add    %dh,0xa(%rbx)
+  80340a:	80 00 00             	addb   $0x0,(%rax)
+  80340d:	00 00                	add    %al,(%rax)
+  80340f:	00 50 0b             	add    %dl,0xb(%rax)
+  803412:	80 00 00             	addb   $0x0,(%rax)
+  803415:	00 00                	add    %al,(%rax)
+  803417:	00 18                	add    %bl,(%rax)
+  803419:	05 80 00 00 00       	add    $0x80,%eax
+	...
+
+0000000000803420 <error_string>:
+	...
+  803428:	ca 2f 80 00 00 00 00 00 dc 2f 80 00 00 00 00 00     ./......./......
+  803438:	ec 2f 80 00 00 00 00 00 fe 2f 80 00 00 00 00 00     ./......./......
+  803448:	0c 30 80 00 00 00 00 00 20 30 80 00 00 00 00 00     .0...... 0......
+  803458:	35 30 80 00 00 00 00 00 48 30 80 00 00 00 00 00     50......H0......
+  803468:	5a 30 80 00 00 00 00 00 6e 30 80 00 00 00 00 00     Z0......n0......
+  803478:	7e 30 80 00 00 00 00 00 91 30 80 00 00 00 00 00     ~0.......0......
+  803488:	a8 30 80 00 00 00 00 00 be 30 80 00 00 00 00 00     .0.......0......
+  803498:	d6 30 80 00 00 00 00 00 ee 30 80 00 00 00 00 00     .0.......0......
+  8034a8:	fb 30 80 00 00 00 00 00 d0 34 80 00 00 00 00 00     .0.......4......
+  8034b8:	0f 31 80 00 00 00 00 00 27 31 80 00 00 00 00 00     .1......'1......
+  8034c8:	3d 31 80 00 00 00 00 00 66 69 6c 65 20 69 73 20     =1......file is 
+  8034d8:	6e 6f 74 20 61 20 76 61 6c 69 64 20 65 78 65 63     not a valid exec
+  8034e8:	75 74 61 62 6c 65 00 90 73 79 73 63 61 6c 6c 20     utable..syscall 
+  8034f8:	25 7a 64 20 72 65 74 75 72 6e 65 64 20 25 7a 64     %zd returned %zd
+  803508:	20 28 3e 20 30 29 00 6c 69 62 2f 73 79 73 63 61      (> 0).lib/sysca
+  803518:	6c 6c 2e 63 00 46 6f 72 6b 20 64 6f 75 62 6c 65     ll.c.Fork double
+  803528:	20 66 61 75 6c 74 00 6c 69 62 2f 66 6f 72 6b 2e      fault.lib/fork.
+  803538:	63 00 73 66 6f 72 6b 28 29 20 69 73 20 6e 6f 74     c.sfork() is not
+  803548:	20 69 6d 70 6c 65 6d 65 6e 74 65 64 00 73 79 73      implemented.sys
+  803558:	5f 69 70 63 5f 74 72 79 5f 73 65 6e 64 20 66 61     _ipc_try_send fa
+  803568:	69 6c 65 64 3a 20 25 69 00 6c 69 62 2f 69 70 63     iled: %i.lib/ipc
+  803578:	2e 63 00 0f 1f 44 00 00 5b 25 30 38 78 5d 20 75     .c...D..[%08x] u
+  803588:	6e 6b 6e 6f 77 6e 20 64 65 76 69 63 65 20 74 79     nknown device ty
+  803598:	70 65 20 25 64 0a 00 00 5b 25 30 38 78 5d 20 66     pe %d...[%08x] f
+  8035a8:	74 72 75 6e 63 61 74 65 20 25 64 20 2d 2d 20 62     truncate %d -- b
+  8035b8:	61 64 20 6d 6f 64 65 0a 00 5b 25 30 38 78 5d 20     ad mode..[%08x] 
+  8035c8:	72 65 61 64 20 25 64 20 2d 2d 20 62 61 64 20 6d     read %d -- bad m
+  8035d8:	6f 64 65 0a 00 5b 25 30 38 78 5d 20 77 72 69 74     ode..[%08x] writ
+  8035e8:	65 20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65     e %d -- bad mode
+  8035f8:	0a 00 66 0f 1f 44 00 00                             ..f..D..
+
+0000000000803600 <devtab>:
+  803600:	20 40 80 00 00 00 00 00 60 40 80 00 00 00 00 00      @......`@......
+  803610:	a0 40 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .@..............
+  803620:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  803630:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  803640:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  803650:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  803660:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  803670:	3d 20 32 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73 00     = 2.<cons>.cons.
+  803680:	5b 25 30 38 78 5d 20 75 73 65 72 20 70 61 6e 69     [%08x] user pani
+  803690:	63 20 69 6e 20 25 73 20 61 74 20 25 73 3a 25 64     c in %s at %s:%d
+  8036a0:	3a 20 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     : .f.........f..
+  8036b0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8036c0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8036d0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8036e0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8036f0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803700:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803710:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803720:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803730:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803740:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803750:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803760:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803770:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803780:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803790:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8037a0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8037b0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8037c0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8037d0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8037e0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8037f0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803800:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803810:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803820:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803830:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803840:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803850:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803860:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803870:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803880:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803890:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8038a0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8038b0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8038c0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8038d0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8038e0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8038f0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803900:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803910:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803920:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803930:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803940:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803950:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803960:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803970:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803980:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803990:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8039a0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8039b0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8039c0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8039d0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8039e0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8039f0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803a00:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803a10:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803a20:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803a30:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803a40:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803a50:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803a60:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803a70:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803a80:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803a90:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803aa0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803ab0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803ac0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803ad0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803ae0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803af0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803b00:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803b10:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803b20:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803b30:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803b40:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803b50:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803b60:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803b70:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803b80:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803b90:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803ba0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803bb0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803bc0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803bd0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803be0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803bf0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803c00:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803c10:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803c20:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803c30:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803c40:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803c50:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803c60:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803c70:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803c80:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803c90:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803ca0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803cb0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803cc0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803cd0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803ce0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803cf0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803d00:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803d10:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803d20:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803d30:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803d40:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803d50:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803d60:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803d70:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803d80:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803d90:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803da0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803db0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803dc0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803dd0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803de0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803df0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803e00:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803e10:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803e20:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803e30:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803e40:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803e50:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803e60:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803e70:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803e80:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803e90:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803ea0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803eb0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803ec0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803ed0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803ee0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803ef0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803f00:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803f10:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803f20:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803f30:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803f40:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803f50:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803f60:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803f70:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803f80:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803f90:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803fa0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803fb0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803fc0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803fd0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803fe0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803ff0:	2e 0f 1f 84 00 00 00 00 00 0f 1f 80 00 00 00 00     ................
@@ -0,0 +1,5720 @@
+
+obj/user/divzero:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 3d 00 00 00       	call   800060 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+#include <inc/lib.h>
+
+volatile int zero;
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+    cprintf("1337/0 is %08x!\n", 1337 / zero);
+  800029:	48 b8 00 50 80 00 00 	movabs $0x805000,%rax
+  800030:	00 00 00 
+  800033:	8b 08                	mov    (%rax),%ecx
+  800035:	b8 39 05 00 00       	mov    $0x539,%eax
+  80003a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80003f:	f7 f9                	idiv   %ecx
+  800041:	89 c6                	mov    %eax,%esi
+  800043:	48 bf b0 2c 80 00 00 	movabs $0x802cb0,%rdi
+  80004a:	00 00 00 
+  80004d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800052:	48 ba d9 01 80 00 00 	movabs $0x8001d9,%rdx
+  800059:	00 00 00 
+  80005c:	ff d2                	call   *%rdx
+}
+  80005e:	5d                   	pop    %rbp
+  80005f:	c3                   	ret
+
+0000000000800060 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800060:	55                   	push   %rbp
+  800061:	48 89 e5             	mov    %rsp,%rbp
+  800064:	41 56                	push   %r14
+  800066:	41 55                	push   %r13
+  800068:	41 54                	push   %r12
+  80006a:	53                   	push   %rbx
+  80006b:	41 89 fd             	mov    %edi,%r13d
+  80006e:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800071:	48 ba d8 40 80 00 00 	movabs $0x8040d8,%rdx
+  800078:	00 00 00 
+  80007b:	48 b8 d8 40 80 00 00 	movabs $0x8040d8,%rax
+  800082:	00 00 00 
+  800085:	48 39 c2             	cmp    %rax,%rdx
+  800088:	73 17                	jae    8000a1 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  80008a:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  80008d:	49 89 c4             	mov    %rax,%r12
+  800090:	48 83 c3 08          	add    $0x8,%rbx
+  800094:	b8 00 00 00 00       	mov    $0x0,%eax
+  800099:	ff 53 f8             	call   *-0x8(%rbx)
+  80009c:	4c 39 e3             	cmp    %r12,%rbx
+  80009f:	72 ef                	jb     800090 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+    envid_t this_env_id = sys_getenvid();
+  8000a1:	48 b8 ee 0f 80 00 00 	movabs $0x800fee,%rax
+  8000a8:	00 00 00 
+  8000ab:	ff d0                	call   *%rax
+    thisenv = &((struct Env*)UENVS)[ENVX(this_env_id)];
+  8000ad:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8000b2:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+  8000b9:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8000c0:	00 00 00 
+  8000c3:	48 01 d0             	add    %rdx,%rax
+  8000c6:	48 a3 08 50 80 00 00 	movabs %rax,0x805008
+  8000cd:	00 00 00 
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8000d0:	45 85 ed             	test   %r13d,%r13d
+  8000d3:	7e 0d                	jle    8000e2 <libmain+0x82>
+  8000d5:	49 8b 06             	mov    (%r14),%rax
+  8000d8:	48 a3 00 40 80 00 00 	movabs %rax,0x804000
+  8000df:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8000e2:	4c 89 f6             	mov    %r14,%rsi
+  8000e5:	44 89 ef             	mov    %r13d,%edi
+  8000e8:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8000ef:	00 00 00 
+  8000f2:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8000f4:	48 b8 09 01 80 00 00 	movabs $0x800109,%rax
+  8000fb:	00 00 00 
+  8000fe:	ff d0                	call   *%rax
+#endif
+}
+  800100:	5b                   	pop    %rbx
+  800101:	41 5c                	pop    %r12
+  800103:	41 5d                	pop    %r13
+  800105:	41 5e                	pop    %r14
+  800107:	5d                   	pop    %rbp
+  800108:	c3                   	ret
+
+0000000000800109 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  800109:	55                   	push   %rbp
+  80010a:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  80010d:	48 b8 42 17 80 00 00 	movabs $0x801742,%rax
+  800114:	00 00 00 
+  800117:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  800119:	bf 00 00 00 00       	mov    $0x0,%edi
+  80011e:	48 b8 83 0f 80 00 00 	movabs $0x800f83,%rax
+  800125:	00 00 00 
+  800128:	ff d0                	call   *%rax
+}
+  80012a:	5d                   	pop    %rbp
+  80012b:	c3                   	ret
+
+000000000080012c <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  80012c:	55                   	push   %rbp
+  80012d:	48 89 e5             	mov    %rsp,%rbp
+  800130:	53                   	push   %rbx
+  800131:	48 83 ec 08          	sub    $0x8,%rsp
+  800135:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  800138:	8b 06                	mov    (%rsi),%eax
+  80013a:	8d 50 01             	lea    0x1(%rax),%edx
+  80013d:	89 16                	mov    %edx,(%rsi)
+  80013f:	48 98                	cltq
+  800141:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  800146:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  80014c:	74 0a                	je     800158 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  80014e:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  800152:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800156:	c9                   	leave
+  800157:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  800158:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  80015c:	be ff 00 00 00       	mov    $0xff,%esi
+  800161:	48 b8 25 0f 80 00 00 	movabs $0x800f25,%rax
+  800168:	00 00 00 
+  80016b:	ff d0                	call   *%rax
+        state->offset = 0;
+  80016d:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  800173:	eb d9                	jmp    80014e <putch+0x22>
+
+0000000000800175 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  800175:	55                   	push   %rbp
+  800176:	48 89 e5             	mov    %rsp,%rbp
+  800179:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  800180:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  800183:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  80018a:	b9 21 00 00 00       	mov    $0x21,%ecx
+  80018f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800194:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  800197:	48 89 f1             	mov    %rsi,%rcx
+  80019a:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  8001a1:	48 bf 2c 01 80 00 00 	movabs $0x80012c,%rdi
+  8001a8:	00 00 00 
+  8001ab:	48 b8 29 03 80 00 00 	movabs $0x800329,%rax
+  8001b2:	00 00 00 
+  8001b5:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  8001b7:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  8001be:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  8001c5:	48 b8 25 0f 80 00 00 	movabs $0x800f25,%rax
+  8001cc:	00 00 00 
+  8001cf:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  8001d1:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  8001d7:	c9                   	leave
+  8001d8:	c3                   	ret
+
+00000000008001d9 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  8001d9:	55                   	push   %rbp
+  8001da:	48 89 e5             	mov    %rsp,%rbp
+  8001dd:	48 83 ec 50          	sub    $0x50,%rsp
+  8001e1:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8001e5:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8001e9:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8001ed:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8001f1:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  8001f5:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  8001fc:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800200:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800204:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800208:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  80020c:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  800210:	48 b8 75 01 80 00 00 	movabs $0x800175,%rax
+  800217:	00 00 00 
+  80021a:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  80021c:	c9                   	leave
+  80021d:	c3                   	ret
+
+000000000080021e <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  80021e:	55                   	push   %rbp
+  80021f:	48 89 e5             	mov    %rsp,%rbp
+  800222:	41 57                	push   %r15
+  800224:	41 56                	push   %r14
+  800226:	41 55                	push   %r13
+  800228:	41 54                	push   %r12
+  80022a:	53                   	push   %rbx
+  80022b:	48 83 ec 18          	sub    $0x18,%rsp
+  80022f:	49 89 fc             	mov    %rdi,%r12
+  800232:	49 89 f5             	mov    %rsi,%r13
+  800235:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800239:	8b 45 10             	mov    0x10(%rbp),%eax
+  80023c:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  80023f:	41 89 cf             	mov    %ecx,%r15d
+  800242:	4c 39 fa             	cmp    %r15,%rdx
+  800245:	73 5b                	jae    8002a2 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  800247:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  80024b:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  80024f:	85 db                	test   %ebx,%ebx
+  800251:	7e 0e                	jle    800261 <print_num+0x43>
+            putch(padc, put_arg);
+  800253:	4c 89 ee             	mov    %r13,%rsi
+  800256:	44 89 f7             	mov    %r14d,%edi
+  800259:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  80025c:	83 eb 01             	sub    $0x1,%ebx
+  80025f:	75 f2                	jne    800253 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  800261:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  800265:	48 b9 dc 2c 80 00 00 	movabs $0x802cdc,%rcx
+  80026c:	00 00 00 
+  80026f:	48 b8 cb 2c 80 00 00 	movabs $0x802ccb,%rax
+  800276:	00 00 00 
+  800279:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  80027d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800281:	ba 00 00 00 00       	mov    $0x0,%edx
+  800286:	49 f7 f7             	div    %r15
+  800289:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  80028d:	4c 89 ee             	mov    %r13,%rsi
+  800290:	41 ff d4             	call   *%r12
+}
+  800293:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800297:	5b                   	pop    %rbx
+  800298:	41 5c                	pop    %r12
+  80029a:	41 5d                	pop    %r13
+  80029c:	41 5e                	pop    %r14
+  80029e:	41 5f                	pop    %r15
+  8002a0:	5d                   	pop    %rbp
+  8002a1:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  8002a2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8002a6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8002ab:	49 f7 f7             	div    %r15
+  8002ae:	48 83 ec 08          	sub    $0x8,%rsp
+  8002b2:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  8002b6:	52                   	push   %rdx
+  8002b7:	45 0f be c9          	movsbl %r9b,%r9d
+  8002bb:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  8002bf:	48 89 c2             	mov    %rax,%rdx
+  8002c2:	48 b8 1e 02 80 00 00 	movabs $0x80021e,%rax
+  8002c9:	00 00 00 
+  8002cc:	ff d0                	call   *%rax
+  8002ce:	48 83 c4 10          	add    $0x10,%rsp
+  8002d2:	eb 8d                	jmp    800261 <print_num+0x43>
+
+00000000008002d4 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  8002d4:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  8002d8:	48 8b 06             	mov    (%rsi),%rax
+  8002db:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  8002df:	73 0a                	jae    8002eb <sprintputch+0x17>
+        *state->start++ = ch;
+  8002e1:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8002e5:	48 89 16             	mov    %rdx,(%rsi)
+  8002e8:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  8002eb:	c3                   	ret
+
+00000000008002ec <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  8002ec:	55                   	push   %rbp
+  8002ed:	48 89 e5             	mov    %rsp,%rbp
+  8002f0:	48 83 ec 50          	sub    $0x50,%rsp
+  8002f4:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8002f8:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8002fc:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  800300:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800307:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80030b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80030f:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800313:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  800317:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80031b:	48 b8 29 03 80 00 00 	movabs $0x800329,%rax
+  800322:	00 00 00 
+  800325:	ff d0                	call   *%rax
+}
+  800327:	c9                   	leave
+  800328:	c3                   	ret
+
+0000000000800329 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  800329:	55                   	push   %rbp
+  80032a:	48 89 e5             	mov    %rsp,%rbp
+  80032d:	41 57                	push   %r15
+  80032f:	41 56                	push   %r14
+  800331:	41 55                	push   %r13
+  800333:	41 54                	push   %r12
+  800335:	53                   	push   %rbx
+  800336:	48 83 ec 38          	sub    $0x38,%rsp
+  80033a:	49 89 fe             	mov    %rdi,%r14
+  80033d:	49 89 f5             	mov    %rsi,%r13
+  800340:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  800343:	48 8b 01             	mov    (%rcx),%rax
+  800346:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  80034a:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  80034e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800352:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  800356:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  80035a:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  80035e:	0f b6 3b             	movzbl (%rbx),%edi
+  800361:	40 80 ff 25          	cmp    $0x25,%dil
+  800365:	74 18                	je     80037f <vprintfmt+0x56>
+            if (!ch) return;
+  800367:	40 84 ff             	test   %dil,%dil
+  80036a:	0f 84 b1 06 00 00    	je     800a21 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  800370:	40 0f b6 ff          	movzbl %dil,%edi
+  800374:	4c 89 ee             	mov    %r13,%rsi
+  800377:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  80037a:	4c 89 e3             	mov    %r12,%rbx
+  80037d:	eb db                	jmp    80035a <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  80037f:	be 00 00 00 00       	mov    $0x0,%esi
+  800384:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  800388:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  80038d:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800393:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  80039a:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  80039e:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  8003a3:	41 0f b6 04 24       	movzbl (%r12),%eax
+  8003a8:	88 45 a0             	mov    %al,-0x60(%rbp)
+  8003ab:	83 e8 23             	sub    $0x23,%eax
+  8003ae:	3c 57                	cmp    $0x57,%al
+  8003b0:	0f 87 51 06 00 00    	ja     800a07 <vprintfmt+0x6de>
+  8003b6:	0f b6 c0             	movzbl %al,%eax
+  8003b9:	48 b9 a0 2e 80 00 00 	movabs $0x802ea0,%rcx
+  8003c0:	00 00 00 
+  8003c3:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  8003c6:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  8003c9:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  8003cd:	eb cf                	jmp    80039e <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  8003cf:	49 89 dc             	mov    %rbx,%r12
+  8003d2:	be 01 00 00 00       	mov    $0x1,%esi
+  8003d7:	eb c5                	jmp    80039e <vprintfmt+0x75>
+            padc = ch;
+  8003d9:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  8003dd:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8003e0:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8003e3:	eb b9                	jmp    80039e <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8003e5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8003e8:	83 f8 2f             	cmp    $0x2f,%eax
+  8003eb:	77 24                	ja     800411 <vprintfmt+0xe8>
+  8003ed:	89 c1                	mov    %eax,%ecx
+  8003ef:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  8003f3:	83 c0 08             	add    $0x8,%eax
+  8003f6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8003f9:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  8003fc:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  8003ff:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800403:	79 99                	jns    80039e <vprintfmt+0x75>
+                width = precision;
+  800405:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  800409:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  80040f:	eb 8d                	jmp    80039e <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800411:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  800415:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  800419:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80041d:	eb da                	jmp    8003f9 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  80041f:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  800424:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800428:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  80042e:	3c 39                	cmp    $0x39,%al
+  800430:	77 1c                	ja     80044e <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  800432:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  800436:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  80043a:	0f b6 c0             	movzbl %al,%eax
+  80043d:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800442:	0f b6 03             	movzbl (%rbx),%eax
+  800445:	3c 39                	cmp    $0x39,%al
+  800447:	76 e9                	jbe    800432 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  800449:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  80044c:	eb b1                	jmp    8003ff <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  80044e:	49 89 dc             	mov    %rbx,%r12
+  800451:	eb ac                	jmp    8003ff <vprintfmt+0xd6>
+            width = MAX(0, width);
+  800453:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  800456:	85 c9                	test   %ecx,%ecx
+  800458:	b8 00 00 00 00       	mov    $0x0,%eax
+  80045d:	0f 49 c1             	cmovns %ecx,%eax
+  800460:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  800463:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800466:	e9 33 ff ff ff       	jmp    80039e <vprintfmt+0x75>
+            lflag++;
+  80046b:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  80046e:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800471:	e9 28 ff ff ff       	jmp    80039e <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  800476:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800479:	83 f8 2f             	cmp    $0x2f,%eax
+  80047c:	77 19                	ja     800497 <vprintfmt+0x16e>
+  80047e:	89 c2                	mov    %eax,%edx
+  800480:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800484:	83 c0 08             	add    $0x8,%eax
+  800487:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80048a:	8b 3a                	mov    (%rdx),%edi
+  80048c:	4c 89 ee             	mov    %r13,%rsi
+  80048f:	41 ff d6             	call   *%r14
+            break;
+  800492:	e9 c3 fe ff ff       	jmp    80035a <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  800497:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80049b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80049f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8004a3:	eb e5                	jmp    80048a <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  8004a5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8004a8:	83 f8 2f             	cmp    $0x2f,%eax
+  8004ab:	77 5a                	ja     800507 <vprintfmt+0x1de>
+  8004ad:	89 c2                	mov    %eax,%edx
+  8004af:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8004b3:	83 c0 08             	add    $0x8,%eax
+  8004b6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  8004b9:	8b 02                	mov    (%rdx),%eax
+  8004bb:	89 c1                	mov    %eax,%ecx
+  8004bd:	f7 d9                	neg    %ecx
+  8004bf:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  8004c2:	83 f9 15             	cmp    $0x15,%ecx
+  8004c5:	7f 4e                	jg     800515 <vprintfmt+0x1ec>
+  8004c7:	48 63 c1             	movslq %ecx,%rax
+  8004ca:	48 ba 60 31 80 00 00 	movabs $0x803160,%rdx
+  8004d1:	00 00 00 
+  8004d4:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8004d8:	48 85 c0             	test   %rax,%rax
+  8004db:	74 38                	je     800515 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  8004dd:	48 89 c1             	mov    %rax,%rcx
+  8004e0:	48 ba 19 33 80 00 00 	movabs $0x803319,%rdx
+  8004e7:	00 00 00 
+  8004ea:	4c 89 ee             	mov    %r13,%rsi
+  8004ed:	4c 89 f7             	mov    %r14,%rdi
+  8004f0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004f5:	49 b8 ec 02 80 00 00 	movabs $0x8002ec,%r8
+  8004fc:	00 00 00 
+  8004ff:	41 ff d0             	call   *%r8
+  800502:	e9 53 fe ff ff       	jmp    80035a <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  800507:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80050b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80050f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800513:	eb a4                	jmp    8004b9 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  800515:	48 ba f4 2c 80 00 00 	movabs $0x802cf4,%rdx
+  80051c:	00 00 00 
+  80051f:	4c 89 ee             	mov    %r13,%rsi
+  800522:	4c 89 f7             	mov    %r14,%rdi
+  800525:	b8 00 00 00 00       	mov    $0x0,%eax
+  80052a:	49 b8 ec 02 80 00 00 	movabs $0x8002ec,%r8
+  800531:	00 00 00 
+  800534:	41 ff d0             	call   *%r8
+  800537:	e9 1e fe ff ff       	jmp    80035a <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  80053c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80053f:	83 f8 2f             	cmp    $0x2f,%eax
+  800542:	77 6c                	ja     8005b0 <vprintfmt+0x287>
+  800544:	89 c2                	mov    %eax,%edx
+  800546:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80054a:	83 c0 08             	add    $0x8,%eax
+  80054d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800550:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  800553:	48 85 d2             	test   %rdx,%rdx
+  800556:	48 b8 ed 2c 80 00 00 	movabs $0x802ced,%rax
+  80055d:	00 00 00 
+  800560:	48 0f 45 c2          	cmovne %rdx,%rax
+  800564:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  800568:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  80056c:	7e 06                	jle    800574 <vprintfmt+0x24b>
+  80056e:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  800572:	75 4a                	jne    8005be <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800574:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800578:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  80057c:	0f b6 00             	movzbl (%rax),%eax
+  80057f:	84 c0                	test   %al,%al
+  800581:	0f 85 9a 00 00 00    	jne    800621 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  800587:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80058a:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  80058e:	85 c0                	test   %eax,%eax
+  800590:	0f 8e c4 fd ff ff    	jle    80035a <vprintfmt+0x31>
+  800596:	4c 89 ee             	mov    %r13,%rsi
+  800599:	bf 20 00 00 00       	mov    $0x20,%edi
+  80059e:	41 ff d6             	call   *%r14
+  8005a1:	41 83 ec 01          	sub    $0x1,%r12d
+  8005a5:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  8005a9:	75 eb                	jne    800596 <vprintfmt+0x26d>
+  8005ab:	e9 aa fd ff ff       	jmp    80035a <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8005b0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8005b4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8005b8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8005bc:	eb 92                	jmp    800550 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  8005be:	49 63 f7             	movslq %r15d,%rsi
+  8005c1:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  8005c5:	48 b8 db 0a 80 00 00 	movabs $0x800adb,%rax
+  8005cc:	00 00 00 
+  8005cf:	ff d0                	call   *%rax
+  8005d1:	48 89 c2             	mov    %rax,%rdx
+  8005d4:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8005d7:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  8005d9:	8d 70 ff             	lea    -0x1(%rax),%esi
+  8005dc:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  8005df:	85 c0                	test   %eax,%eax
+  8005e1:	7e 91                	jle    800574 <vprintfmt+0x24b>
+  8005e3:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  8005e8:	4c 89 ee             	mov    %r13,%rsi
+  8005eb:	44 89 e7             	mov    %r12d,%edi
+  8005ee:	41 ff d6             	call   *%r14
+  8005f1:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8005f5:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8005f8:	83 f8 ff             	cmp    $0xffffffff,%eax
+  8005fb:	75 eb                	jne    8005e8 <vprintfmt+0x2bf>
+  8005fd:	e9 72 ff ff ff       	jmp    800574 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800602:	0f b6 f8             	movzbl %al,%edi
+  800605:	4c 89 ee             	mov    %r13,%rsi
+  800608:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  80060b:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  80060f:	49 83 c4 01          	add    $0x1,%r12
+  800613:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  800619:	84 c0                	test   %al,%al
+  80061b:	0f 84 66 ff ff ff    	je     800587 <vprintfmt+0x25e>
+  800621:	45 85 ff             	test   %r15d,%r15d
+  800624:	78 0a                	js     800630 <vprintfmt+0x307>
+  800626:	41 83 ef 01          	sub    $0x1,%r15d
+  80062a:	0f 88 57 ff ff ff    	js     800587 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800630:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  800634:	74 cc                	je     800602 <vprintfmt+0x2d9>
+  800636:	8d 50 e0             	lea    -0x20(%rax),%edx
+  800639:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  80063e:	80 fa 5e             	cmp    $0x5e,%dl
+  800641:	77 c2                	ja     800605 <vprintfmt+0x2dc>
+  800643:	eb bd                	jmp    800602 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  800645:	40 84 f6             	test   %sil,%sil
+  800648:	75 26                	jne    800670 <vprintfmt+0x347>
+    switch (lflag) {
+  80064a:	85 d2                	test   %edx,%edx
+  80064c:	74 59                	je     8006a7 <vprintfmt+0x37e>
+  80064e:	83 fa 01             	cmp    $0x1,%edx
+  800651:	74 7b                	je     8006ce <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  800653:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800656:	83 f8 2f             	cmp    $0x2f,%eax
+  800659:	0f 87 96 00 00 00    	ja     8006f5 <vprintfmt+0x3cc>
+  80065f:	89 c2                	mov    %eax,%edx
+  800661:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800665:	83 c0 08             	add    $0x8,%eax
+  800668:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80066b:	4c 8b 22             	mov    (%rdx),%r12
+  80066e:	eb 17                	jmp    800687 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  800670:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800673:	83 f8 2f             	cmp    $0x2f,%eax
+  800676:	77 21                	ja     800699 <vprintfmt+0x370>
+  800678:	89 c2                	mov    %eax,%edx
+  80067a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80067e:	83 c0 08             	add    $0x8,%eax
+  800681:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800684:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  800687:	4d 85 e4             	test   %r12,%r12
+  80068a:	78 7a                	js     800706 <vprintfmt+0x3dd>
+            num = i;
+  80068c:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  80068f:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  800694:	e9 50 02 00 00       	jmp    8008e9 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800699:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80069d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006a1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006a5:	eb dd                	jmp    800684 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  8006a7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006aa:	83 f8 2f             	cmp    $0x2f,%eax
+  8006ad:	77 11                	ja     8006c0 <vprintfmt+0x397>
+  8006af:	89 c2                	mov    %eax,%edx
+  8006b1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8006b5:	83 c0 08             	add    $0x8,%eax
+  8006b8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8006bb:	4c 63 22             	movslq (%rdx),%r12
+  8006be:	eb c7                	jmp    800687 <vprintfmt+0x35e>
+  8006c0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8006c4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006c8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006cc:	eb ed                	jmp    8006bb <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  8006ce:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006d1:	83 f8 2f             	cmp    $0x2f,%eax
+  8006d4:	77 11                	ja     8006e7 <vprintfmt+0x3be>
+  8006d6:	89 c2                	mov    %eax,%edx
+  8006d8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8006dc:	83 c0 08             	add    $0x8,%eax
+  8006df:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8006e2:	4c 8b 22             	mov    (%rdx),%r12
+  8006e5:	eb a0                	jmp    800687 <vprintfmt+0x35e>
+  8006e7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8006eb:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006ef:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006f3:	eb ed                	jmp    8006e2 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  8006f5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8006f9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006fd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800701:	e9 65 ff ff ff       	jmp    80066b <vprintfmt+0x342>
+                putch('-', put_arg);
+  800706:	4c 89 ee             	mov    %r13,%rsi
+  800709:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  80070e:	41 ff d6             	call   *%r14
+                i = -i;
+  800711:	49 f7 dc             	neg    %r12
+  800714:	e9 73 ff ff ff       	jmp    80068c <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  800719:	40 84 f6             	test   %sil,%sil
+  80071c:	75 32                	jne    800750 <vprintfmt+0x427>
+    switch (lflag) {
+  80071e:	85 d2                	test   %edx,%edx
+  800720:	74 5d                	je     80077f <vprintfmt+0x456>
+  800722:	83 fa 01             	cmp    $0x1,%edx
+  800725:	0f 84 82 00 00 00    	je     8007ad <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  80072b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80072e:	83 f8 2f             	cmp    $0x2f,%eax
+  800731:	0f 87 a5 00 00 00    	ja     8007dc <vprintfmt+0x4b3>
+  800737:	89 c2                	mov    %eax,%edx
+  800739:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80073d:	83 c0 08             	add    $0x8,%eax
+  800740:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800743:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800746:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  80074b:	e9 99 01 00 00       	jmp    8008e9 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800750:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800753:	83 f8 2f             	cmp    $0x2f,%eax
+  800756:	77 19                	ja     800771 <vprintfmt+0x448>
+  800758:	89 c2                	mov    %eax,%edx
+  80075a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80075e:	83 c0 08             	add    $0x8,%eax
+  800761:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800764:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800767:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  80076c:	e9 78 01 00 00       	jmp    8008e9 <vprintfmt+0x5c0>
+  800771:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800775:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800779:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80077d:	eb e5                	jmp    800764 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  80077f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800782:	83 f8 2f             	cmp    $0x2f,%eax
+  800785:	77 18                	ja     80079f <vprintfmt+0x476>
+  800787:	89 c2                	mov    %eax,%edx
+  800789:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80078d:	83 c0 08             	add    $0x8,%eax
+  800790:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800793:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800795:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  80079a:	e9 4a 01 00 00       	jmp    8008e9 <vprintfmt+0x5c0>
+  80079f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007a3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007a7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007ab:	eb e6                	jmp    800793 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  8007ad:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007b0:	83 f8 2f             	cmp    $0x2f,%eax
+  8007b3:	77 19                	ja     8007ce <vprintfmt+0x4a5>
+  8007b5:	89 c2                	mov    %eax,%edx
+  8007b7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007bb:	83 c0 08             	add    $0x8,%eax
+  8007be:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007c1:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8007c4:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  8007c9:	e9 1b 01 00 00       	jmp    8008e9 <vprintfmt+0x5c0>
+  8007ce:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007d2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007d6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007da:	eb e5                	jmp    8007c1 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  8007dc:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007e0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007e4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007e8:	e9 56 ff ff ff       	jmp    800743 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  8007ed:	40 84 f6             	test   %sil,%sil
+  8007f0:	75 2e                	jne    800820 <vprintfmt+0x4f7>
+    switch (lflag) {
+  8007f2:	85 d2                	test   %edx,%edx
+  8007f4:	74 59                	je     80084f <vprintfmt+0x526>
+  8007f6:	83 fa 01             	cmp    $0x1,%edx
+  8007f9:	74 7f                	je     80087a <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  8007fb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007fe:	83 f8 2f             	cmp    $0x2f,%eax
+  800801:	0f 87 9f 00 00 00    	ja     8008a6 <vprintfmt+0x57d>
+  800807:	89 c2                	mov    %eax,%edx
+  800809:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80080d:	83 c0 08             	add    $0x8,%eax
+  800810:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800813:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800816:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  80081b:	e9 c9 00 00 00       	jmp    8008e9 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800820:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800823:	83 f8 2f             	cmp    $0x2f,%eax
+  800826:	77 19                	ja     800841 <vprintfmt+0x518>
+  800828:	89 c2                	mov    %eax,%edx
+  80082a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80082e:	83 c0 08             	add    $0x8,%eax
+  800831:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800834:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800837:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  80083c:	e9 a8 00 00 00       	jmp    8008e9 <vprintfmt+0x5c0>
+  800841:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800845:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800849:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80084d:	eb e5                	jmp    800834 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  80084f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800852:	83 f8 2f             	cmp    $0x2f,%eax
+  800855:	77 15                	ja     80086c <vprintfmt+0x543>
+  800857:	89 c2                	mov    %eax,%edx
+  800859:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80085d:	83 c0 08             	add    $0x8,%eax
+  800860:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800863:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  800865:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  80086a:	eb 7d                	jmp    8008e9 <vprintfmt+0x5c0>
+  80086c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800870:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800874:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800878:	eb e9                	jmp    800863 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  80087a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80087d:	83 f8 2f             	cmp    $0x2f,%eax
+  800880:	77 16                	ja     800898 <vprintfmt+0x56f>
+  800882:	89 c2                	mov    %eax,%edx
+  800884:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800888:	83 c0 08             	add    $0x8,%eax
+  80088b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80088e:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800891:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  800896:	eb 51                	jmp    8008e9 <vprintfmt+0x5c0>
+  800898:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80089c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008a0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008a4:	eb e8                	jmp    80088e <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  8008a6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008aa:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008ae:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008b2:	e9 5c ff ff ff       	jmp    800813 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  8008b7:	4c 89 ee             	mov    %r13,%rsi
+  8008ba:	bf 30 00 00 00       	mov    $0x30,%edi
+  8008bf:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  8008c2:	4c 89 ee             	mov    %r13,%rsi
+  8008c5:	bf 78 00 00 00       	mov    $0x78,%edi
+  8008ca:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  8008cd:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008d0:	83 f8 2f             	cmp    $0x2f,%eax
+  8008d3:	77 47                	ja     80091c <vprintfmt+0x5f3>
+  8008d5:	89 c2                	mov    %eax,%edx
+  8008d7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008db:	83 c0 08             	add    $0x8,%eax
+  8008de:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008e1:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8008e4:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  8008e9:	48 83 ec 08          	sub    $0x8,%rsp
+  8008ed:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  8008f1:	0f 94 c0             	sete   %al
+  8008f4:	0f b6 c0             	movzbl %al,%eax
+  8008f7:	50                   	push   %rax
+  8008f8:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  8008fd:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800901:	4c 89 ee             	mov    %r13,%rsi
+  800904:	4c 89 f7             	mov    %r14,%rdi
+  800907:	48 b8 1e 02 80 00 00 	movabs $0x80021e,%rax
+  80090e:	00 00 00 
+  800911:	ff d0                	call   *%rax
+            break;
+  800913:	48 83 c4 10          	add    $0x10,%rsp
+  800917:	e9 3e fa ff ff       	jmp    80035a <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  80091c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800920:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800924:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800928:	eb b7                	jmp    8008e1 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  80092a:	40 84 f6             	test   %sil,%sil
+  80092d:	75 2b                	jne    80095a <vprintfmt+0x631>
+    switch (lflag) {
+  80092f:	85 d2                	test   %edx,%edx
+  800931:	74 56                	je     800989 <vprintfmt+0x660>
+  800933:	83 fa 01             	cmp    $0x1,%edx
+  800936:	74 7f                	je     8009b7 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800938:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80093b:	83 f8 2f             	cmp    $0x2f,%eax
+  80093e:	0f 87 a2 00 00 00    	ja     8009e6 <vprintfmt+0x6bd>
+  800944:	89 c2                	mov    %eax,%edx
+  800946:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80094a:	83 c0 08             	add    $0x8,%eax
+  80094d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800950:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800953:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800958:	eb 8f                	jmp    8008e9 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  80095a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80095d:	83 f8 2f             	cmp    $0x2f,%eax
+  800960:	77 19                	ja     80097b <vprintfmt+0x652>
+  800962:	89 c2                	mov    %eax,%edx
+  800964:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800968:	83 c0 08             	add    $0x8,%eax
+  80096b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80096e:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800971:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800976:	e9 6e ff ff ff       	jmp    8008e9 <vprintfmt+0x5c0>
+  80097b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80097f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800983:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800987:	eb e5                	jmp    80096e <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800989:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80098c:	83 f8 2f             	cmp    $0x2f,%eax
+  80098f:	77 18                	ja     8009a9 <vprintfmt+0x680>
+  800991:	89 c2                	mov    %eax,%edx
+  800993:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800997:	83 c0 08             	add    $0x8,%eax
+  80099a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80099d:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  80099f:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  8009a4:	e9 40 ff ff ff       	jmp    8008e9 <vprintfmt+0x5c0>
+  8009a9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009ad:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009b1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009b5:	eb e6                	jmp    80099d <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  8009b7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009ba:	83 f8 2f             	cmp    $0x2f,%eax
+  8009bd:	77 19                	ja     8009d8 <vprintfmt+0x6af>
+  8009bf:	89 c2                	mov    %eax,%edx
+  8009c1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009c5:	83 c0 08             	add    $0x8,%eax
+  8009c8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009cb:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8009ce:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  8009d3:	e9 11 ff ff ff       	jmp    8008e9 <vprintfmt+0x5c0>
+  8009d8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009dc:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009e0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009e4:	eb e5                	jmp    8009cb <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  8009e6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009ea:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009ee:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009f2:	e9 59 ff ff ff       	jmp    800950 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  8009f7:	4c 89 ee             	mov    %r13,%rsi
+  8009fa:	bf 25 00 00 00       	mov    $0x25,%edi
+  8009ff:	41 ff d6             	call   *%r14
+            break;
+  800a02:	e9 53 f9 ff ff       	jmp    80035a <vprintfmt+0x31>
+            putch('%', put_arg);
+  800a07:	4c 89 ee             	mov    %r13,%rsi
+  800a0a:	bf 25 00 00 00       	mov    $0x25,%edi
+  800a0f:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800a12:	48 83 eb 01          	sub    $0x1,%rbx
+  800a16:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800a1a:	75 f6                	jne    800a12 <vprintfmt+0x6e9>
+  800a1c:	e9 39 f9 ff ff       	jmp    80035a <vprintfmt+0x31>
+}
+  800a21:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800a25:	5b                   	pop    %rbx
+  800a26:	41 5c                	pop    %r12
+  800a28:	41 5d                	pop    %r13
+  800a2a:	41 5e                	pop    %r14
+  800a2c:	41 5f                	pop    %r15
+  800a2e:	5d                   	pop    %rbp
+  800a2f:	c3                   	ret
+
+0000000000800a30 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800a30:	55                   	push   %rbp
+  800a31:	48 89 e5             	mov    %rsp,%rbp
+  800a34:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800a38:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800a3c:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800a41:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800a45:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800a4c:	48 85 ff             	test   %rdi,%rdi
+  800a4f:	74 2b                	je     800a7c <vsnprintf+0x4c>
+  800a51:	48 85 f6             	test   %rsi,%rsi
+  800a54:	74 26                	je     800a7c <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800a56:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800a5a:	48 bf d4 02 80 00 00 	movabs $0x8002d4,%rdi
+  800a61:	00 00 00 
+  800a64:	48 b8 29 03 80 00 00 	movabs $0x800329,%rax
+  800a6b:	00 00 00 
+  800a6e:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800a70:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800a74:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800a77:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800a7a:	c9                   	leave
+  800a7b:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800a7c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800a81:	eb f7                	jmp    800a7a <vsnprintf+0x4a>
+
+0000000000800a83 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800a83:	55                   	push   %rbp
+  800a84:	48 89 e5             	mov    %rsp,%rbp
+  800a87:	48 83 ec 50          	sub    $0x50,%rsp
+  800a8b:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800a8f:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800a93:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800a97:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800a9e:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800aa2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800aa6:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800aaa:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800aae:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800ab2:	48 b8 30 0a 80 00 00 	movabs $0x800a30,%rax
+  800ab9:	00 00 00 
+  800abc:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800abe:	c9                   	leave
+  800abf:	c3                   	ret
+
+0000000000800ac0 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800ac0:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800ac3:	74 10                	je     800ad5 <strlen+0x15>
+    size_t n = 0;
+  800ac5:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800aca:	48 83 c0 01          	add    $0x1,%rax
+  800ace:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800ad2:	75 f6                	jne    800aca <strlen+0xa>
+  800ad4:	c3                   	ret
+    size_t n = 0;
+  800ad5:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800ada:	c3                   	ret
+
+0000000000800adb <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800adb:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800ade:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800ae3:	48 85 f6             	test   %rsi,%rsi
+  800ae6:	74 11                	je     800af9 <strnlen+0x1e>
+  800ae8:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800aec:	74 0c                	je     800afa <strnlen+0x1f>
+  800aee:	48 83 c2 01          	add    $0x1,%rdx
+  800af2:	48 39 d0             	cmp    %rdx,%rax
+  800af5:	75 f1                	jne    800ae8 <strnlen+0xd>
+  800af7:	eb 04                	jmp    800afd <strnlen+0x22>
+  800af9:	c3                   	ret
+  800afa:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800afd:	c3                   	ret
+
+0000000000800afe <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800afe:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800b01:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b06:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800b0a:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800b0d:	48 83 c2 01          	add    $0x1,%rdx
+  800b11:	84 c9                	test   %cl,%cl
+  800b13:	75 f1                	jne    800b06 <strcpy+0x8>
+        ;
+    return res;
+}
+  800b15:	c3                   	ret
+
+0000000000800b16 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800b16:	55                   	push   %rbp
+  800b17:	48 89 e5             	mov    %rsp,%rbp
+  800b1a:	41 54                	push   %r12
+  800b1c:	53                   	push   %rbx
+  800b1d:	48 89 fb             	mov    %rdi,%rbx
+  800b20:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800b23:	48 b8 c0 0a 80 00 00 	movabs $0x800ac0,%rax
+  800b2a:	00 00 00 
+  800b2d:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800b2f:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800b33:	4c 89 e6             	mov    %r12,%rsi
+  800b36:	48 b8 fe 0a 80 00 00 	movabs $0x800afe,%rax
+  800b3d:	00 00 00 
+  800b40:	ff d0                	call   *%rax
+    return dst;
+}
+  800b42:	48 89 d8             	mov    %rbx,%rax
+  800b45:	5b                   	pop    %rbx
+  800b46:	41 5c                	pop    %r12
+  800b48:	5d                   	pop    %rbp
+  800b49:	c3                   	ret
+
+0000000000800b4a <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800b4a:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800b4d:	48 85 d2             	test   %rdx,%rdx
+  800b50:	74 1f                	je     800b71 <strncpy+0x27>
+  800b52:	48 01 fa             	add    %rdi,%rdx
+  800b55:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800b58:	48 83 c1 01          	add    $0x1,%rcx
+  800b5c:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800b60:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800b64:	41 80 f8 01          	cmp    $0x1,%r8b
+  800b68:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800b6c:	48 39 ca             	cmp    %rcx,%rdx
+  800b6f:	75 e7                	jne    800b58 <strncpy+0xe>
+    }
+    return ret;
+}
+  800b71:	c3                   	ret
+
+0000000000800b72 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800b72:	48 89 f8             	mov    %rdi,%rax
+  800b75:	48 85 d2             	test   %rdx,%rdx
+  800b78:	74 24                	je     800b9e <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800b7a:	48 83 ea 01          	sub    $0x1,%rdx
+  800b7e:	74 1b                	je     800b9b <strlcpy+0x29>
+  800b80:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800b84:	0f b6 16             	movzbl (%rsi),%edx
+  800b87:	84 d2                	test   %dl,%dl
+  800b89:	74 10                	je     800b9b <strlcpy+0x29>
+            *dst++ = *src++;
+  800b8b:	48 83 c6 01          	add    $0x1,%rsi
+  800b8f:	48 83 c0 01          	add    $0x1,%rax
+  800b93:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800b96:	48 39 c8             	cmp    %rcx,%rax
+  800b99:	75 e9                	jne    800b84 <strlcpy+0x12>
+        *dst = '\0';
+  800b9b:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800b9e:	48 29 f8             	sub    %rdi,%rax
+}
+  800ba1:	c3                   	ret
+
+0000000000800ba2 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800ba2:	0f b6 07             	movzbl (%rdi),%eax
+  800ba5:	84 c0                	test   %al,%al
+  800ba7:	74 13                	je     800bbc <strcmp+0x1a>
+  800ba9:	38 06                	cmp    %al,(%rsi)
+  800bab:	75 0f                	jne    800bbc <strcmp+0x1a>
+  800bad:	48 83 c7 01          	add    $0x1,%rdi
+  800bb1:	48 83 c6 01          	add    $0x1,%rsi
+  800bb5:	0f b6 07             	movzbl (%rdi),%eax
+  800bb8:	84 c0                	test   %al,%al
+  800bba:	75 ed                	jne    800ba9 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800bbc:	0f b6 c0             	movzbl %al,%eax
+  800bbf:	0f b6 16             	movzbl (%rsi),%edx
+  800bc2:	29 d0                	sub    %edx,%eax
+}
+  800bc4:	c3                   	ret
+
+0000000000800bc5 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800bc5:	48 85 d2             	test   %rdx,%rdx
+  800bc8:	74 1f                	je     800be9 <strncmp+0x24>
+  800bca:	0f b6 07             	movzbl (%rdi),%eax
+  800bcd:	84 c0                	test   %al,%al
+  800bcf:	74 1e                	je     800bef <strncmp+0x2a>
+  800bd1:	3a 06                	cmp    (%rsi),%al
+  800bd3:	75 1a                	jne    800bef <strncmp+0x2a>
+  800bd5:	48 83 c7 01          	add    $0x1,%rdi
+  800bd9:	48 83 c6 01          	add    $0x1,%rsi
+  800bdd:	48 83 ea 01          	sub    $0x1,%rdx
+  800be1:	75 e7                	jne    800bca <strncmp+0x5>
+
+    if (!n) return 0;
+  800be3:	b8 00 00 00 00       	mov    $0x0,%eax
+  800be8:	c3                   	ret
+  800be9:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bee:	c3                   	ret
+  800bef:	48 85 d2             	test   %rdx,%rdx
+  800bf2:	74 09                	je     800bfd <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800bf4:	0f b6 07             	movzbl (%rdi),%eax
+  800bf7:	0f b6 16             	movzbl (%rsi),%edx
+  800bfa:	29 d0                	sub    %edx,%eax
+  800bfc:	c3                   	ret
+    if (!n) return 0;
+  800bfd:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800c02:	c3                   	ret
+
+0000000000800c03 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800c03:	0f b6 17             	movzbl (%rdi),%edx
+  800c06:	84 d2                	test   %dl,%dl
+  800c08:	74 18                	je     800c22 <strchr+0x1f>
+        if (*str == c) {
+  800c0a:	0f be d2             	movsbl %dl,%edx
+  800c0d:	39 f2                	cmp    %esi,%edx
+  800c0f:	74 17                	je     800c28 <strchr+0x25>
+    for (; *str; str++) {
+  800c11:	48 83 c7 01          	add    $0x1,%rdi
+  800c15:	0f b6 17             	movzbl (%rdi),%edx
+  800c18:	84 d2                	test   %dl,%dl
+  800c1a:	75 ee                	jne    800c0a <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800c1c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c21:	c3                   	ret
+  800c22:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c27:	c3                   	ret
+  800c28:	48 89 f8             	mov    %rdi,%rax
+}
+  800c2b:	c3                   	ret
+
+0000000000800c2c <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800c2c:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800c2f:	0f b6 17             	movzbl (%rdi),%edx
+  800c32:	84 d2                	test   %dl,%dl
+  800c34:	74 13                	je     800c49 <strfind+0x1d>
+  800c36:	0f be d2             	movsbl %dl,%edx
+  800c39:	39 f2                	cmp    %esi,%edx
+  800c3b:	74 0b                	je     800c48 <strfind+0x1c>
+  800c3d:	48 83 c0 01          	add    $0x1,%rax
+  800c41:	0f b6 10             	movzbl (%rax),%edx
+  800c44:	84 d2                	test   %dl,%dl
+  800c46:	75 ee                	jne    800c36 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800c48:	c3                   	ret
+  800c49:	c3                   	ret
+
+0000000000800c4a <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800c4a:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800c4d:	48 89 f8             	mov    %rdi,%rax
+  800c50:	48 f7 d8             	neg    %rax
+  800c53:	83 e0 07             	and    $0x7,%eax
+  800c56:	49 89 d1             	mov    %rdx,%r9
+  800c59:	49 29 c1             	sub    %rax,%r9
+  800c5c:	78 36                	js     800c94 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800c5e:	40 0f b6 c6          	movzbl %sil,%eax
+  800c62:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800c69:	01 01 01 
+  800c6c:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800c70:	40 f6 c7 07          	test   $0x7,%dil
+  800c74:	75 38                	jne    800cae <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800c76:	4c 89 c9             	mov    %r9,%rcx
+  800c79:	48 c1 f9 03          	sar    $0x3,%rcx
+  800c7d:	74 0c                	je     800c8b <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800c7f:	fc                   	cld
+  800c80:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800c83:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800c87:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800c8b:	4d 85 c9             	test   %r9,%r9
+  800c8e:	75 45                	jne    800cd5 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800c90:	4c 89 c0             	mov    %r8,%rax
+  800c93:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800c94:	48 85 d2             	test   %rdx,%rdx
+  800c97:	74 f7                	je     800c90 <memset+0x46>
+  800c99:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800c9c:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800c9f:	48 83 c0 01          	add    $0x1,%rax
+  800ca3:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  800ca7:	48 39 c2             	cmp    %rax,%rdx
+  800caa:	75 f3                	jne    800c9f <memset+0x55>
+  800cac:	eb e2                	jmp    800c90 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  800cae:	40 f6 c7 01          	test   $0x1,%dil
+  800cb2:	74 06                	je     800cba <memset+0x70>
+  800cb4:	88 07                	mov    %al,(%rdi)
+  800cb6:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800cba:	40 f6 c7 02          	test   $0x2,%dil
+  800cbe:	74 07                	je     800cc7 <memset+0x7d>
+  800cc0:	66 89 07             	mov    %ax,(%rdi)
+  800cc3:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800cc7:	40 f6 c7 04          	test   $0x4,%dil
+  800ccb:	74 a9                	je     800c76 <memset+0x2c>
+  800ccd:	89 07                	mov    %eax,(%rdi)
+  800ccf:	48 83 c7 04          	add    $0x4,%rdi
+  800cd3:	eb a1                	jmp    800c76 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800cd5:	41 f6 c1 04          	test   $0x4,%r9b
+  800cd9:	74 06                	je     800ce1 <memset+0x97>
+  800cdb:	89 07                	mov    %eax,(%rdi)
+  800cdd:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800ce1:	41 f6 c1 02          	test   $0x2,%r9b
+  800ce5:	74 07                	je     800cee <memset+0xa4>
+  800ce7:	66 89 07             	mov    %ax,(%rdi)
+  800cea:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  800cee:	41 f6 c1 01          	test   $0x1,%r9b
+  800cf2:	74 9c                	je     800c90 <memset+0x46>
+  800cf4:	88 07                	mov    %al,(%rdi)
+  800cf6:	eb 98                	jmp    800c90 <memset+0x46>
+
+0000000000800cf8 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  800cf8:	48 89 f8             	mov    %rdi,%rax
+  800cfb:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  800cfe:	48 39 fe             	cmp    %rdi,%rsi
+  800d01:	73 3b                	jae    800d3e <memmove+0x46>
+  800d03:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  800d07:	48 39 d7             	cmp    %rdx,%rdi
+  800d0a:	73 32                	jae    800d3e <memmove+0x46>
+        s += n;
+        d += n;
+  800d0c:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800d10:	48 89 d6             	mov    %rdx,%rsi
+  800d13:	48 09 fe             	or     %rdi,%rsi
+  800d16:	48 09 ce             	or     %rcx,%rsi
+  800d19:	40 f6 c6 07          	test   $0x7,%sil
+  800d1d:	75 12                	jne    800d31 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  800d1f:	48 83 ef 08          	sub    $0x8,%rdi
+  800d23:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  800d27:	48 c1 e9 03          	shr    $0x3,%rcx
+  800d2b:	fd                   	std
+  800d2c:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  800d2f:	fc                   	cld
+  800d30:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  800d31:	48 83 ef 01          	sub    $0x1,%rdi
+  800d35:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  800d39:	fd                   	std
+  800d3a:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  800d3c:	eb f1                	jmp    800d2f <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800d3e:	48 89 f2             	mov    %rsi,%rdx
+  800d41:	48 09 c2             	or     %rax,%rdx
+  800d44:	48 09 ca             	or     %rcx,%rdx
+  800d47:	f6 c2 07             	test   $0x7,%dl
+  800d4a:	75 0c                	jne    800d58 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  800d4c:	48 c1 e9 03          	shr    $0x3,%rcx
+  800d50:	48 89 c7             	mov    %rax,%rdi
+  800d53:	fc                   	cld
+  800d54:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  800d57:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  800d58:	48 89 c7             	mov    %rax,%rdi
+  800d5b:	fc                   	cld
+  800d5c:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  800d5e:	c3                   	ret
+
+0000000000800d5f <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  800d5f:	55                   	push   %rbp
+  800d60:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  800d63:	48 b8 f8 0c 80 00 00 	movabs $0x800cf8,%rax
+  800d6a:	00 00 00 
+  800d6d:	ff d0                	call   *%rax
+}
+  800d6f:	5d                   	pop    %rbp
+  800d70:	c3                   	ret
+
+0000000000800d71 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  800d71:	55                   	push   %rbp
+  800d72:	48 89 e5             	mov    %rsp,%rbp
+  800d75:	41 57                	push   %r15
+  800d77:	41 56                	push   %r14
+  800d79:	41 55                	push   %r13
+  800d7b:	41 54                	push   %r12
+  800d7d:	53                   	push   %rbx
+  800d7e:	48 83 ec 08          	sub    $0x8,%rsp
+  800d82:	49 89 fe             	mov    %rdi,%r14
+  800d85:	49 89 f7             	mov    %rsi,%r15
+  800d88:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  800d8b:	48 89 f7             	mov    %rsi,%rdi
+  800d8e:	48 b8 c0 0a 80 00 00 	movabs $0x800ac0,%rax
+  800d95:	00 00 00 
+  800d98:	ff d0                	call   *%rax
+  800d9a:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  800d9d:	48 89 de             	mov    %rbx,%rsi
+  800da0:	4c 89 f7             	mov    %r14,%rdi
+  800da3:	48 b8 db 0a 80 00 00 	movabs $0x800adb,%rax
+  800daa:	00 00 00 
+  800dad:	ff d0                	call   *%rax
+  800daf:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  800db2:	48 39 c3             	cmp    %rax,%rbx
+  800db5:	74 36                	je     800ded <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  800db7:	48 89 d8             	mov    %rbx,%rax
+  800dba:	4c 29 e8             	sub    %r13,%rax
+  800dbd:	49 39 c4             	cmp    %rax,%r12
+  800dc0:	73 31                	jae    800df3 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  800dc2:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  800dc7:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800dcb:	4c 89 fe             	mov    %r15,%rsi
+  800dce:	48 b8 5f 0d 80 00 00 	movabs $0x800d5f,%rax
+  800dd5:	00 00 00 
+  800dd8:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  800dda:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  800dde:	48 83 c4 08          	add    $0x8,%rsp
+  800de2:	5b                   	pop    %rbx
+  800de3:	41 5c                	pop    %r12
+  800de5:	41 5d                	pop    %r13
+  800de7:	41 5e                	pop    %r14
+  800de9:	41 5f                	pop    %r15
+  800deb:	5d                   	pop    %rbp
+  800dec:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  800ded:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800df1:	eb eb                	jmp    800dde <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  800df3:	48 83 eb 01          	sub    $0x1,%rbx
+  800df7:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800dfb:	48 89 da             	mov    %rbx,%rdx
+  800dfe:	4c 89 fe             	mov    %r15,%rsi
+  800e01:	48 b8 5f 0d 80 00 00 	movabs $0x800d5f,%rax
+  800e08:	00 00 00 
+  800e0b:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  800e0d:	49 01 de             	add    %rbx,%r14
+  800e10:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  800e15:	eb c3                	jmp    800dda <strlcat+0x69>
+
+0000000000800e17 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  800e17:	48 85 d2             	test   %rdx,%rdx
+  800e1a:	74 2d                	je     800e49 <memcmp+0x32>
+  800e1c:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  800e21:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800e25:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  800e2a:	44 38 c1             	cmp    %r8b,%cl
+  800e2d:	75 0f                	jne    800e3e <memcmp+0x27>
+    while (n-- > 0) {
+  800e2f:	48 83 c0 01          	add    $0x1,%rax
+  800e33:	48 39 c2             	cmp    %rax,%rdx
+  800e36:	75 e9                	jne    800e21 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  800e38:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e3d:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  800e3e:	0f b6 c1             	movzbl %cl,%eax
+  800e41:	45 0f b6 c0          	movzbl %r8b,%r8d
+  800e45:	44 29 c0             	sub    %r8d,%eax
+  800e48:	c3                   	ret
+    return 0;
+  800e49:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800e4e:	c3                   	ret
+
+0000000000800e4f <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  800e4f:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  800e53:	48 39 c7             	cmp    %rax,%rdi
+  800e56:	73 0f                	jae    800e67 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  800e58:	40 38 37             	cmp    %sil,(%rdi)
+  800e5b:	74 0e                	je     800e6b <memfind+0x1c>
+    for (; src < end; src++) {
+  800e5d:	48 83 c7 01          	add    $0x1,%rdi
+  800e61:	48 39 f8             	cmp    %rdi,%rax
+  800e64:	75 f2                	jne    800e58 <memfind+0x9>
+  800e66:	c3                   	ret
+  800e67:	48 89 f8             	mov    %rdi,%rax
+  800e6a:	c3                   	ret
+  800e6b:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  800e6e:	c3                   	ret
+
+0000000000800e6f <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  800e6f:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  800e72:	0f b6 37             	movzbl (%rdi),%esi
+  800e75:	40 80 fe 20          	cmp    $0x20,%sil
+  800e79:	74 06                	je     800e81 <strtol+0x12>
+  800e7b:	40 80 fe 09          	cmp    $0x9,%sil
+  800e7f:	75 13                	jne    800e94 <strtol+0x25>
+  800e81:	48 83 c7 01          	add    $0x1,%rdi
+  800e85:	0f b6 37             	movzbl (%rdi),%esi
+  800e88:	40 80 fe 20          	cmp    $0x20,%sil
+  800e8c:	74 f3                	je     800e81 <strtol+0x12>
+  800e8e:	40 80 fe 09          	cmp    $0x9,%sil
+  800e92:	74 ed                	je     800e81 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  800e94:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  800e97:	83 e0 fd             	and    $0xfffffffd,%eax
+  800e9a:	3c 01                	cmp    $0x1,%al
+  800e9c:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  800ea0:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  800ea6:	75 0f                	jne    800eb7 <strtol+0x48>
+  800ea8:	80 3f 30             	cmpb   $0x30,(%rdi)
+  800eab:	74 14                	je     800ec1 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  800ead:	85 d2                	test   %edx,%edx
+  800eaf:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800eb4:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  800eb7:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  800ebc:	4c 63 ca             	movslq %edx,%r9
+  800ebf:	eb 36                	jmp    800ef7 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  800ec1:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  800ec5:	74 0f                	je     800ed6 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  800ec7:	85 d2                	test   %edx,%edx
+  800ec9:	75 ec                	jne    800eb7 <strtol+0x48>
+        s++;
+  800ecb:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  800ecf:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  800ed4:	eb e1                	jmp    800eb7 <strtol+0x48>
+        s += 2;
+  800ed6:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  800eda:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  800edf:	eb d6                	jmp    800eb7 <strtol+0x48>
+            dig -= '0';
+  800ee1:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  800ee4:	44 0f b6 c1          	movzbl %cl,%r8d
+  800ee8:	41 39 d0             	cmp    %edx,%r8d
+  800eeb:	7d 21                	jge    800f0e <strtol+0x9f>
+        val = val * base + dig;
+  800eed:	49 0f af c1          	imul   %r9,%rax
+  800ef1:	0f b6 c9             	movzbl %cl,%ecx
+  800ef4:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  800ef7:	48 83 c7 01          	add    $0x1,%rdi
+  800efb:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  800eff:	80 f9 39             	cmp    $0x39,%cl
+  800f02:	76 dd                	jbe    800ee1 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  800f04:	80 f9 7b             	cmp    $0x7b,%cl
+  800f07:	77 05                	ja     800f0e <strtol+0x9f>
+            dig -= 'a' - 10;
+  800f09:	83 e9 57             	sub    $0x57,%ecx
+  800f0c:	eb d6                	jmp    800ee4 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  800f0e:	4d 85 d2             	test   %r10,%r10
+  800f11:	74 03                	je     800f16 <strtol+0xa7>
+  800f13:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  800f16:	48 89 c2             	mov    %rax,%rdx
+  800f19:	48 f7 da             	neg    %rdx
+  800f1c:	40 80 fe 2d          	cmp    $0x2d,%sil
+  800f20:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  800f24:	c3                   	ret
+
+0000000000800f25 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  800f25:	55                   	push   %rbp
+  800f26:	48 89 e5             	mov    %rsp,%rbp
+  800f29:	53                   	push   %rbx
+  800f2a:	48 89 fa             	mov    %rdi,%rdx
+  800f2d:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  800f30:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800f35:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f3a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800f3f:	be 00 00 00 00       	mov    $0x0,%esi
+  800f44:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800f4a:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  800f4c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800f50:	c9                   	leave
+  800f51:	c3                   	ret
+
+0000000000800f52 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  800f52:	55                   	push   %rbp
+  800f53:	48 89 e5             	mov    %rsp,%rbp
+  800f56:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  800f57:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800f5c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f61:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800f66:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f6b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800f70:	be 00 00 00 00       	mov    $0x0,%esi
+  800f75:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800f7b:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  800f7d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800f81:	c9                   	leave
+  800f82:	c3                   	ret
+
+0000000000800f83 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  800f83:	55                   	push   %rbp
+  800f84:	48 89 e5             	mov    %rsp,%rbp
+  800f87:	53                   	push   %rbx
+  800f88:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  800f8c:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800f8f:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800f94:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800f99:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f9e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800fa3:	be 00 00 00 00       	mov    $0x0,%esi
+  800fa8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800fae:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800fb0:	48 85 c0             	test   %rax,%rax
+  800fb3:	7f 06                	jg     800fbb <sys_env_destroy+0x38>
+}
+  800fb5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800fb9:	c9                   	leave
+  800fba:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800fbb:	49 89 c0             	mov    %rax,%r8
+  800fbe:	b9 03 00 00 00       	mov    $0x3,%ecx
+  800fc3:	48 ba 30 32 80 00 00 	movabs $0x803230,%rdx
+  800fca:	00 00 00 
+  800fcd:	be 26 00 00 00       	mov    $0x26,%esi
+  800fd2:	48 bf 4f 32 80 00 00 	movabs $0x80324f,%rdi
+  800fd9:	00 00 00 
+  800fdc:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fe1:	49 b9 3f 2a 80 00 00 	movabs $0x802a3f,%r9
+  800fe8:	00 00 00 
+  800feb:	41 ff d1             	call   *%r9
+
+0000000000800fee <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  800fee:	55                   	push   %rbp
+  800fef:	48 89 e5             	mov    %rsp,%rbp
+  800ff2:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  800ff3:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800ff8:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ffd:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801002:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801007:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80100c:	be 00 00 00 00       	mov    $0x0,%esi
+  801011:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801017:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  801019:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80101d:	c9                   	leave
+  80101e:	c3                   	ret
+
+000000000080101f <sys_yield>:
+
+void
+sys_yield(void) {
+  80101f:	55                   	push   %rbp
+  801020:	48 89 e5             	mov    %rsp,%rbp
+  801023:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801024:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801029:	ba 00 00 00 00       	mov    $0x0,%edx
+  80102e:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801033:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801038:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80103d:	be 00 00 00 00       	mov    $0x0,%esi
+  801042:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801048:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  80104a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80104e:	c9                   	leave
+  80104f:	c3                   	ret
+
+0000000000801050 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  801050:	55                   	push   %rbp
+  801051:	48 89 e5             	mov    %rsp,%rbp
+  801054:	53                   	push   %rbx
+  801055:	48 89 fa             	mov    %rdi,%rdx
+  801058:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80105b:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801060:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  801067:	00 00 00 
+  80106a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80106f:	be 00 00 00 00       	mov    $0x0,%esi
+  801074:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80107a:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  80107c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801080:	c9                   	leave
+  801081:	c3                   	ret
+
+0000000000801082 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  801082:	55                   	push   %rbp
+  801083:	48 89 e5             	mov    %rsp,%rbp
+  801086:	53                   	push   %rbx
+  801087:	49 89 f8             	mov    %rdi,%r8
+  80108a:	48 89 d3             	mov    %rdx,%rbx
+  80108d:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801090:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801095:	4c 89 c2             	mov    %r8,%rdx
+  801098:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80109b:	be 00 00 00 00       	mov    $0x0,%esi
+  8010a0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8010a6:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  8010a8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8010ac:	c9                   	leave
+  8010ad:	c3                   	ret
+
+00000000008010ae <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  8010ae:	55                   	push   %rbp
+  8010af:	48 89 e5             	mov    %rsp,%rbp
+  8010b2:	53                   	push   %rbx
+  8010b3:	48 83 ec 08          	sub    $0x8,%rsp
+  8010b7:	89 f8                	mov    %edi,%eax
+  8010b9:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  8010bc:	48 63 f9             	movslq %ecx,%rdi
+  8010bf:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8010c2:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8010c7:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8010ca:	be 00 00 00 00       	mov    $0x0,%esi
+  8010cf:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8010d5:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8010d7:	48 85 c0             	test   %rax,%rax
+  8010da:	7f 06                	jg     8010e2 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  8010dc:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8010e0:	c9                   	leave
+  8010e1:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8010e2:	49 89 c0             	mov    %rax,%r8
+  8010e5:	b9 04 00 00 00       	mov    $0x4,%ecx
+  8010ea:	48 ba 30 32 80 00 00 	movabs $0x803230,%rdx
+  8010f1:	00 00 00 
+  8010f4:	be 26 00 00 00       	mov    $0x26,%esi
+  8010f9:	48 bf 4f 32 80 00 00 	movabs $0x80324f,%rdi
+  801100:	00 00 00 
+  801103:	b8 00 00 00 00       	mov    $0x0,%eax
+  801108:	49 b9 3f 2a 80 00 00 	movabs $0x802a3f,%r9
+  80110f:	00 00 00 
+  801112:	41 ff d1             	call   *%r9
+
+0000000000801115 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801115:	55                   	push   %rbp
+  801116:	48 89 e5             	mov    %rsp,%rbp
+  801119:	53                   	push   %rbx
+  80111a:	48 83 ec 08          	sub    $0x8,%rsp
+  80111e:	89 f8                	mov    %edi,%eax
+  801120:	49 89 f2             	mov    %rsi,%r10
+  801123:	48 89 cf             	mov    %rcx,%rdi
+  801126:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  801129:	48 63 da             	movslq %edx,%rbx
+  80112c:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80112f:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801134:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801137:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  80113a:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80113c:	48 85 c0             	test   %rax,%rax
+  80113f:	7f 06                	jg     801147 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  801141:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801145:	c9                   	leave
+  801146:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801147:	49 89 c0             	mov    %rax,%r8
+  80114a:	b9 05 00 00 00       	mov    $0x5,%ecx
+  80114f:	48 ba 30 32 80 00 00 	movabs $0x803230,%rdx
+  801156:	00 00 00 
+  801159:	be 26 00 00 00       	mov    $0x26,%esi
+  80115e:	48 bf 4f 32 80 00 00 	movabs $0x80324f,%rdi
+  801165:	00 00 00 
+  801168:	b8 00 00 00 00       	mov    $0x0,%eax
+  80116d:	49 b9 3f 2a 80 00 00 	movabs $0x802a3f,%r9
+  801174:	00 00 00 
+  801177:	41 ff d1             	call   *%r9
+
+000000000080117a <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  80117a:	55                   	push   %rbp
+  80117b:	48 89 e5             	mov    %rsp,%rbp
+  80117e:	53                   	push   %rbx
+  80117f:	48 83 ec 08          	sub    $0x8,%rsp
+  801183:	48 89 f1             	mov    %rsi,%rcx
+  801186:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  801189:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80118c:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801191:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801196:	be 00 00 00 00       	mov    $0x0,%esi
+  80119b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8011a1:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8011a3:	48 85 c0             	test   %rax,%rax
+  8011a6:	7f 06                	jg     8011ae <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  8011a8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8011ac:	c9                   	leave
+  8011ad:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8011ae:	49 89 c0             	mov    %rax,%r8
+  8011b1:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8011b6:	48 ba 30 32 80 00 00 	movabs $0x803230,%rdx
+  8011bd:	00 00 00 
+  8011c0:	be 26 00 00 00       	mov    $0x26,%esi
+  8011c5:	48 bf 4f 32 80 00 00 	movabs $0x80324f,%rdi
+  8011cc:	00 00 00 
+  8011cf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011d4:	49 b9 3f 2a 80 00 00 	movabs $0x802a3f,%r9
+  8011db:	00 00 00 
+  8011de:	41 ff d1             	call   *%r9
+
+00000000008011e1 <sys_region_batch>:
+
+int
+sys_region_batch(const struct RegionOp *ops, size_t count) {
+  8011e1:	55                   	push   %rbp
+  8011e2:	48 89 e5             	mov    %rsp,%rbp
+  8011e5:	53                   	push   %rbx
+  8011e6:	48 83 ec 08          	sub    $0x8,%rsp
+  8011ea:	48 89 fa             	mov    %rdi,%rdx
+  8011ed:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8011f0:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8011f5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011fa:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8011ff:	be 00 00 00 00       	mov    $0x0,%esi
+  801204:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80120a:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80120c:	48 85 c0             	test   %rax,%rax
+  80120f:	7f 06                	jg     801217 <sys_region_batch+0x36>
+        else
+            platform_asan_unpoison(va, ops[i].size);
+    }
+#endif
+    return res;
+}
+  801211:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801215:	c9                   	leave
+  801216:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801217:	49 89 c0             	mov    %rax,%r8
+  80121a:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  80121f:	48 ba 30 32 80 00 00 	movabs $0x803230,%rdx
+  801226:	00 00 00 
+  801229:	be 26 00 00 00       	mov    $0x26,%esi
+  80122e:	48 bf 4f 32 80 00 00 	movabs $0x80324f,%rdi
+  801235:	00 00 00 
+  801238:	b8 00 00 00 00       	mov    $0x0,%eax
+  80123d:	49 b9 3f 2a 80 00 00 	movabs $0x802a3f,%r9
+  801244:	00 00 00 
+  801247:	41 ff d1             	call   *%r9
+
+000000000080124a <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  80124a:	55                   	push   %rbp
+  80124b:	48 89 e5             	mov    %rsp,%rbp
+  80124e:	53                   	push   %rbx
+  80124f:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  801253:	48 63 ce             	movslq %esi,%rcx
+  801256:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801259:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80125e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801263:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801268:	be 00 00 00 00       	mov    $0x0,%esi
+  80126d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801273:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801275:	48 85 c0             	test   %rax,%rax
+  801278:	7f 06                	jg     801280 <sys_env_set_status+0x36>
+}
+  80127a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80127e:	c9                   	leave
+  80127f:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801280:	49 89 c0             	mov    %rax,%r8
+  801283:	b9 09 00 00 00       	mov    $0x9,%ecx
+  801288:	48 ba 30 32 80 00 00 	movabs $0x803230,%rdx
+  80128f:	00 00 00 
+  801292:	be 26 00 00 00       	mov    $0x26,%esi
+  801297:	48 bf 4f 32 80 00 00 	movabs $0x80324f,%rdi
+  80129e:	00 00 00 
+  8012a1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012a6:	49 b9 3f 2a 80 00 00 	movabs $0x802a3f,%r9
+  8012ad:	00 00 00 
+  8012b0:	41 ff d1             	call   *%r9
+
+00000000008012b3 <sys_env_set_weight>:
+
+int
+sys_env_set_weight(envid_t envid, uint32_t weight) {
+  8012b3:	55                   	push   %rbp
+  8012b4:	48 89 e5             	mov    %rsp,%rbp
+  8012b7:	53                   	push   %rbx
+  8012b8:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_weight, 1, envid, weight, 0, 0, 0, 0);
+  8012bc:	89 f1                	mov    %esi,%ecx
+  8012be:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8012c1:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8012c6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012cb:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012d0:	be 00 00 00 00       	mov    $0x0,%esi
+  8012d5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8012db:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8012dd:	48 85 c0             	test   %rax,%rax
+  8012e0:	7f 06                	jg     8012e8 <sys_env_set_weight+0x35>
+}
+  8012e2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012e6:	c9                   	leave
+  8012e7:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8012e8:	49 89 c0             	mov    %rax,%r8
+  8012eb:	b9 10 00 00 00       	mov    $0x10,%ecx
+  8012f0:	48 ba 30 32 80 00 00 	movabs $0x803230,%rdx
+  8012f7:	00 00 00 
+  8012fa:	be 26 00 00 00       	mov    $0x26,%esi
+  8012ff:	48 bf 4f 32 80 00 00 	movabs $0x80324f,%rdi
+  801306:	00 00 00 
+  801309:	b8 00 00 00 00       	mov    $0x0,%eax
+  80130e:	49 b9 3f 2a 80 00 00 	movabs $0x802a3f,%r9
+  801315:	00 00 00 
+  801318:	41 ff d1             	call   *%r9
+
+000000000080131b <sys_env_set_rt>:
+
+int
+sys_env_set_rt(envid_t envid, uint64_t period, uint64_t budget, uint64_t deadline) {
+  80131b:	55                   	push   %rbp
+  80131c:	48 89 e5             	mov    %rsp,%rbp
+  80131f:	53                   	push   %rbx
+  801320:	48 83 ec 08          	sub    $0x8,%rsp
+  801324:	89 f8                	mov    %edi,%eax
+  801326:	48 89 d3             	mov    %rdx,%rbx
+  801329:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_env_set_rt, 1, envid, period, budget, deadline, 0, 0);
+  80132c:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80132f:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801334:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801337:	be 00 00 00 00       	mov    $0x0,%esi
+  80133c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801342:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801344:	48 85 c0             	test   %rax,%rax
+  801347:	7f 06                	jg     80134f <sys_env_set_rt+0x34>
+}
+  801349:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80134d:	c9                   	leave
+  80134e:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80134f:	49 89 c0             	mov    %rax,%r8
+  801352:	b9 11 00 00 00       	mov    $0x11,%ecx
+  801357:	48 ba 30 32 80 00 00 	movabs $0x803230,%rdx
+  80135e:	00 00 00 
+  801361:	be 26 00 00 00       	mov    $0x26,%esi
+  801366:	48 bf 4f 32 80 00 00 	movabs $0x80324f,%rdi
+  80136d:	00 00 00 
+  801370:	b8 00 00 00 00       	mov    $0x0,%eax
+  801375:	49 b9 3f 2a 80 00 00 	movabs $0x802a3f,%r9
+  80137c:	00 00 00 
+  80137f:	41 ff d1             	call   *%r9
+
+0000000000801382 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  801382:	55                   	push   %rbp
+  801383:	48 89 e5             	mov    %rsp,%rbp
+  801386:	53                   	push   %rbx
+  801387:	48 83 ec 08          	sub    $0x8,%rsp
+  80138b:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  80138e:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801391:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801396:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80139b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013a0:	be 00 00 00 00       	mov    $0x0,%esi
+  8013a5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013ab:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8013ad:	48 85 c0             	test   %rax,%rax
+  8013b0:	7f 06                	jg     8013b8 <sys_env_set_trapframe+0x36>
+}
+  8013b2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013b6:	c9                   	leave
+  8013b7:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8013b8:	49 89 c0             	mov    %rax,%r8
+  8013bb:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  8013c0:	48 ba 30 32 80 00 00 	movabs $0x803230,%rdx
+  8013c7:	00 00 00 
+  8013ca:	be 26 00 00 00       	mov    $0x26,%esi
+  8013cf:	48 bf 4f 32 80 00 00 	movabs $0x80324f,%rdi
+  8013d6:	00 00 00 
+  8013d9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013de:	49 b9 3f 2a 80 00 00 	movabs $0x802a3f,%r9
+  8013e5:	00 00 00 
+  8013e8:	41 ff d1             	call   *%r9
+
+00000000008013eb <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  8013eb:	55                   	push   %rbp
+  8013ec:	48 89 e5             	mov    %rsp,%rbp
+  8013ef:	53                   	push   %rbx
+  8013f0:	48 83 ec 08          	sub    $0x8,%rsp
+  8013f4:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  8013f7:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8013fa:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8013ff:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801404:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801409:	be 00 00 00 00       	mov    $0x0,%esi
+  80140e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801414:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801416:	48 85 c0             	test   %rax,%rax
+  801419:	7f 06                	jg     801421 <sys_env_set_pgfault_upcall+0x36>
+}
+  80141b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80141f:	c9                   	leave
+  801420:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801421:	49 89 c0             	mov    %rax,%r8
+  801424:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  801429:	48 ba 30 32 80 00 00 	movabs $0x803230,%rdx
+  801430:	00 00 00 
+  801433:	be 26 00 00 00       	mov    $0x26,%esi
+  801438:	48 bf 4f 32 80 00 00 	movabs $0x80324f,%rdi
+  80143f:	00 00 00 
+  801442:	b8 00 00 00 00       	mov    $0x0,%eax
+  801447:	49 b9 3f 2a 80 00 00 	movabs $0x802a3f,%r9
+  80144e:	00 00 00 
+  801451:	41 ff d1             	call   *%r9
+
+0000000000801454 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  801454:	55                   	push   %rbp
+  801455:	48 89 e5             	mov    %rsp,%rbp
+  801458:	53                   	push   %rbx
+  801459:	89 f8                	mov    %edi,%eax
+  80145b:	49 89 f1             	mov    %rsi,%r9
+  80145e:	48 89 d3             	mov    %rdx,%rbx
+  801461:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  801464:	49 63 f0             	movslq %r8d,%rsi
+  801467:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80146a:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80146f:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801472:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801478:	cd 30                	int    $0x30
+}
+  80147a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80147e:	c9                   	leave
+  80147f:	c3                   	ret
+
+0000000000801480 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  801480:	55                   	push   %rbp
+  801481:	48 89 e5             	mov    %rsp,%rbp
+  801484:	53                   	push   %rbx
+  801485:	48 83 ec 08          	sub    $0x8,%rsp
+  801489:	48 89 fa             	mov    %rdi,%rdx
+  80148c:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80148f:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801494:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801499:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80149e:	be 00 00 00 00       	mov    $0x0,%esi
+  8014a3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014a9:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8014ab:	48 85 c0             	test   %rax,%rax
+  8014ae:	7f 06                	jg     8014b6 <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8014b0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014b4:	c9                   	leave
+  8014b5:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8014b6:	49 89 c0             	mov    %rax,%r8
+  8014b9:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  8014be:	48 ba 30 32 80 00 00 	movabs $0x803230,%rdx
+  8014c5:	00 00 00 
+  8014c8:	be 26 00 00 00       	mov    $0x26,%esi
+  8014cd:	48 bf 4f 32 80 00 00 	movabs $0x80324f,%rdi
+  8014d4:	00 00 00 
+  8014d7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014dc:	49 b9 3f 2a 80 00 00 	movabs $0x802a3f,%r9
+  8014e3:	00 00 00 
+  8014e6:	41 ff d1             	call   *%r9
+
+00000000008014e9 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8014e9:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8014f0:	ff ff ff 
+  8014f3:	48 01 f8             	add    %rdi,%rax
+  8014f6:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  8014fa:	c3                   	ret
+
+00000000008014fb <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8014fb:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801502:	ff ff ff 
+  801505:	48 01 f8             	add    %rdi,%rax
+  801508:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  80150c:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  801512:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  801516:	c3                   	ret
+
+0000000000801517 <fd_alloc_from>:
+}
+
+/* Like fd_alloc(), but only considers fds starting from fdnum,
+ * so that several fds can be found before their pages are allocated */
+int
+fd_alloc_from(int fdnum, struct Fd **fd_store) {
+  801517:	55                   	push   %rbp
+  801518:	48 89 e5             	mov    %rsp,%rbp
+  80151b:	41 57                	push   %r15
+  80151d:	41 56                	push   %r14
+  80151f:	41 55                	push   %r13
+  801521:	41 54                	push   %r12
+  801523:	53                   	push   %rbx
+  801524:	48 83 ec 08          	sub    $0x8,%rsp
+  801528:	49 89 f7             	mov    %rsi,%r15
+    for (int i = MAX(fdnum, 0); i < MAXFD; i++) {
+  80152b:	85 ff                	test   %edi,%edi
+  80152d:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  801533:	44 0f 49 e7          	cmovns %edi,%r12d
+  801537:	83 ff 1f             	cmp    $0x1f,%edi
+  80153a:	7f 37                	jg     801573 <fd_alloc_from+0x5c>
+  80153c:	49 63 dc             	movslq %r12d,%rbx
+  80153f:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  801546:	48 c1 e3 0c          	shl    $0xc,%rbx
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  80154a:	49 be 20 26 80 00 00 	movabs $0x802620,%r14
+  801551:	00 00 00 
+        struct Fd *fd = INDEX2FD(i);
+  801554:	49 89 dd             	mov    %rbx,%r13
+        if (!(get_prot(fd) & PROT_R)) {
+  801557:	48 89 df             	mov    %rbx,%rdi
+  80155a:	41 ff d6             	call   *%r14
+  80155d:	83 e0 04             	and    $0x4,%eax
+  801560:	74 1c                	je     80157e <fd_alloc_from+0x67>
+    for (int i = MAX(fdnum, 0); i < MAXFD; i++) {
+  801562:	41 83 c4 01          	add    $0x1,%r12d
+  801566:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  80156d:	41 83 fc 1f          	cmp    $0x1f,%r12d
+  801571:	7e e1                	jle    801554 <fd_alloc_from+0x3d>
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  801573:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801579:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  80157e:	4d 89 2f             	mov    %r13,(%r15)
+}
+  801581:	48 83 c4 08          	add    $0x8,%rsp
+  801585:	5b                   	pop    %rbx
+  801586:	41 5c                	pop    %r12
+  801588:	41 5d                	pop    %r13
+  80158a:	41 5e                	pop    %r14
+  80158c:	41 5f                	pop    %r15
+  80158e:	5d                   	pop    %rbp
+  80158f:	c3                   	ret
+
+0000000000801590 <fd_alloc>:
+fd_alloc(struct Fd **fd_store) {
+  801590:	55                   	push   %rbp
+  801591:	48 89 e5             	mov    %rsp,%rbp
+  801594:	48 89 fe             	mov    %rdi,%rsi
+    return fd_alloc_from(0, fd_store);
+  801597:	bf 00 00 00 00       	mov    $0x0,%edi
+  80159c:	48 b8 17 15 80 00 00 	movabs $0x801517,%rax
+  8015a3:	00 00 00 
+  8015a6:	ff d0                	call   *%rax
+}
+  8015a8:	5d                   	pop    %rbp
+  8015a9:	c3                   	ret
+
+00000000008015aa <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  8015aa:	83 ff 1f             	cmp    $0x1f,%edi
+  8015ad:	77 39                	ja     8015e8 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  8015af:	55                   	push   %rbp
+  8015b0:	48 89 e5             	mov    %rsp,%rbp
+  8015b3:	41 54                	push   %r12
+  8015b5:	53                   	push   %rbx
+  8015b6:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  8015b9:	48 63 df             	movslq %edi,%rbx
+  8015bc:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  8015c3:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  8015c7:	48 89 df             	mov    %rbx,%rdi
+  8015ca:	48 b8 20 26 80 00 00 	movabs $0x802620,%rax
+  8015d1:	00 00 00 
+  8015d4:	ff d0                	call   *%rax
+  8015d6:	a8 04                	test   $0x4,%al
+  8015d8:	74 14                	je     8015ee <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  8015da:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  8015de:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8015e3:	5b                   	pop    %rbx
+  8015e4:	41 5c                	pop    %r12
+  8015e6:	5d                   	pop    %rbp
+  8015e7:	c3                   	ret
+        return -E_INVAL;
+  8015e8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8015ed:	c3                   	ret
+        return -E_INVAL;
+  8015ee:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8015f3:	eb ee                	jmp    8015e3 <fd_lookup+0x39>
+
+00000000008015f5 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  8015f5:	55                   	push   %rbp
+  8015f6:	48 89 e5             	mov    %rsp,%rbp
+  8015f9:	41 54                	push   %r12
+  8015fb:	53                   	push   %rbx
+  8015fc:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  8015ff:	48 b8 e0 32 80 00 00 	movabs $0x8032e0,%rax
+  801606:	00 00 00 
+  801609:	48 bb 20 40 80 00 00 	movabs $0x804020,%rbx
+  801610:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  801613:	39 3b                	cmp    %edi,(%rbx)
+  801615:	74 47                	je     80165e <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  801617:	48 83 c0 08          	add    $0x8,%rax
+  80161b:	48 8b 18             	mov    (%rax),%rbx
+  80161e:	48 85 db             	test   %rbx,%rbx
+  801621:	75 f0                	jne    801613 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801623:	48 a1 08 50 80 00 00 	movabs 0x805008,%rax
+  80162a:	00 00 00 
+  80162d:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+  801633:	89 fa                	mov    %edi,%edx
+  801635:	48 bf 60 32 80 00 00 	movabs $0x803260,%rdi
+  80163c:	00 00 00 
+  80163f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801644:	48 b9 d9 01 80 00 00 	movabs $0x8001d9,%rcx
+  80164b:	00 00 00 
+  80164e:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  801650:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  801655:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  801659:	5b                   	pop    %rbx
+  80165a:	41 5c                	pop    %r12
+  80165c:	5d                   	pop    %rbp
+  80165d:	c3                   	ret
+            return 0;
+  80165e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801663:	eb f0                	jmp    801655 <dev_lookup+0x60>
+
+0000000000801665 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  801665:	55                   	push   %rbp
+  801666:	48 89 e5             	mov    %rsp,%rbp
+  801669:	41 55                	push   %r13
+  80166b:	41 54                	push   %r12
+  80166d:	53                   	push   %rbx
+  80166e:	48 83 ec 18          	sub    $0x18,%rsp
+  801672:	48 89 fb             	mov    %rdi,%rbx
+  801675:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801678:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  80167f:	ff ff ff 
+  801682:	48 01 df             	add    %rbx,%rdi
+  801685:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  801689:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80168d:	48 b8 aa 15 80 00 00 	movabs $0x8015aa,%rax
+  801694:	00 00 00 
+  801697:	ff d0                	call   *%rax
+  801699:	41 89 c5             	mov    %eax,%r13d
+  80169c:	85 c0                	test   %eax,%eax
+  80169e:	78 06                	js     8016a6 <fd_close+0x41>
+  8016a0:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  8016a4:	74 1a                	je     8016c0 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  8016a6:	45 84 e4             	test   %r12b,%r12b
+  8016a9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016ae:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  8016b2:	44 89 e8             	mov    %r13d,%eax
+  8016b5:	48 83 c4 18          	add    $0x18,%rsp
+  8016b9:	5b                   	pop    %rbx
+  8016ba:	41 5c                	pop    %r12
+  8016bc:	41 5d                	pop    %r13
+  8016be:	5d                   	pop    %rbp
+  8016bf:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8016c0:	8b 3b                	mov    (%rbx),%edi
+  8016c2:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8016c6:	48 b8 f5 15 80 00 00 	movabs $0x8015f5,%rax
+  8016cd:	00 00 00 
+  8016d0:	ff d0                	call   *%rax
+  8016d2:	41 89 c5             	mov    %eax,%r13d
+  8016d5:	85 c0                	test   %eax,%eax
+  8016d7:	78 1b                	js     8016f4 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  8016d9:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8016dd:	48 8b 40 20          	mov    0x20(%rax),%rax
+  8016e1:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  8016e7:	48 85 c0             	test   %rax,%rax
+  8016ea:	74 08                	je     8016f4 <fd_close+0x8f>
+  8016ec:	48 89 df             	mov    %rbx,%rdi
+  8016ef:	ff d0                	call   *%rax
+  8016f1:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8016f4:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8016f9:	48 89 de             	mov    %rbx,%rsi
+  8016fc:	bf 00 00 00 00       	mov    $0x0,%edi
+  801701:	48 b8 7a 11 80 00 00 	movabs $0x80117a,%rax
+  801708:	00 00 00 
+  80170b:	ff d0                	call   *%rax
+    return res;
+  80170d:	eb a3                	jmp    8016b2 <fd_close+0x4d>
+
+000000000080170f <close>:
+
+int
+close(int fdnum) {
+  80170f:	55                   	push   %rbp
+  801710:	48 89 e5             	mov    %rsp,%rbp
+  801713:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  801717:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80171b:	48 b8 aa 15 80 00 00 	movabs $0x8015aa,%rax
+  801722:	00 00 00 
+  801725:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801727:	85 c0                	test   %eax,%eax
+  801729:	78 15                	js     801740 <close+0x31>
+
+    return fd_close(fd, 1);
+  80172b:	be 01 00 00 00       	mov    $0x1,%esi
+  801730:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801734:	48 b8 65 16 80 00 00 	movabs $0x801665,%rax
+  80173b:	00 00 00 
+  80173e:	ff d0                	call   *%rax
+}
+  801740:	c9                   	leave
+  801741:	c3                   	ret
+
+0000000000801742 <close_all>:
+
+void
+close_all(void) {
+  801742:	55                   	push   %rbp
+  801743:	48 89 e5             	mov    %rsp,%rbp
+  801746:	41 54                	push   %r12
+  801748:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  801749:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80174e:	49 bc 0f 17 80 00 00 	movabs $0x80170f,%r12
+  801755:	00 00 00 
+  801758:	89 df                	mov    %ebx,%edi
+  80175a:	41 ff d4             	call   *%r12
+  80175d:	83 c3 01             	add    $0x1,%ebx
+  801760:	83 fb 20             	cmp    $0x20,%ebx
+  801763:	75 f3                	jne    801758 <close_all+0x16>
+}
+  801765:	5b                   	pop    %rbx
+  801766:	41 5c                	pop    %r12
+  801768:	5d                   	pop    %rbp
+  801769:	c3                   	ret
+
+000000000080176a <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  80176a:	55                   	push   %rbp
+  80176b:	48 89 e5             	mov    %rsp,%rbp
+  80176e:	41 57                	push   %r15
+  801770:	41 56                	push   %r14
+  801772:	41 55                	push   %r13
+  801774:	41 54                	push   %r12
+  801776:	53                   	push   %rbx
+  801777:	48 83 ec 18          	sub    $0x18,%rsp
+  80177b:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  80177e:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801782:	48 b8 aa 15 80 00 00 	movabs $0x8015aa,%rax
+  801789:	00 00 00 
+  80178c:	ff d0                	call   *%rax
+  80178e:	89 c3                	mov    %eax,%ebx
+  801790:	85 c0                	test   %eax,%eax
+  801792:	0f 88 b8 00 00 00    	js     801850 <dup+0xe6>
+    close(newfdnum);
+  801798:	44 89 e7             	mov    %r12d,%edi
+  80179b:	48 b8 0f 17 80 00 00 	movabs $0x80170f,%rax
+  8017a2:	00 00 00 
+  8017a5:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  8017a7:	4d 63 ec             	movslq %r12d,%r13
+  8017aa:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  8017b1:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  8017b5:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  8017b9:	4c 89 ff             	mov    %r15,%rdi
+  8017bc:	49 be fb 14 80 00 00 	movabs $0x8014fb,%r14
+  8017c3:	00 00 00 
+  8017c6:	41 ff d6             	call   *%r14
+  8017c9:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  8017cc:	4c 89 ef             	mov    %r13,%rdi
+  8017cf:	41 ff d6             	call   *%r14
+  8017d2:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  8017d5:	48 89 df             	mov    %rbx,%rdi
+  8017d8:	48 b8 20 26 80 00 00 	movabs $0x802620,%rax
+  8017df:	00 00 00 
+  8017e2:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  8017e4:	a8 04                	test   $0x4,%al
+  8017e6:	74 2b                	je     801813 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  8017e8:	41 89 c1             	mov    %eax,%r9d
+  8017eb:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8017f1:	4c 89 f1             	mov    %r14,%rcx
+  8017f4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8017f9:	48 89 de             	mov    %rbx,%rsi
+  8017fc:	bf 00 00 00 00       	mov    $0x0,%edi
+  801801:	48 b8 15 11 80 00 00 	movabs $0x801115,%rax
+  801808:	00 00 00 
+  80180b:	ff d0                	call   *%rax
+  80180d:	89 c3                	mov    %eax,%ebx
+  80180f:	85 c0                	test   %eax,%eax
+  801811:	78 4e                	js     801861 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  801813:	4c 89 ff             	mov    %r15,%rdi
+  801816:	48 b8 20 26 80 00 00 	movabs $0x802620,%rax
+  80181d:	00 00 00 
+  801820:	ff d0                	call   *%rax
+  801822:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801825:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  80182b:	4c 89 e9             	mov    %r13,%rcx
+  80182e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801833:	4c 89 fe             	mov    %r15,%rsi
+  801836:	bf 00 00 00 00       	mov    $0x0,%edi
+  80183b:	48 b8 15 11 80 00 00 	movabs $0x801115,%rax
+  801842:	00 00 00 
+  801845:	ff d0                	call   *%rax
+  801847:	89 c3                	mov    %eax,%ebx
+  801849:	85 c0                	test   %eax,%eax
+  80184b:	78 14                	js     801861 <dup+0xf7>
+
+    return newfdnum;
+  80184d:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  801850:	89 d8                	mov    %ebx,%eax
+  801852:	48 83 c4 18          	add    $0x18,%rsp
+  801856:	5b                   	pop    %rbx
+  801857:	41 5c                	pop    %r12
+  801859:	41 5d                	pop    %r13
+  80185b:	41 5e                	pop    %r14
+  80185d:	41 5f                	pop    %r15
+  80185f:	5d                   	pop    %rbp
+  801860:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  801861:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801866:	4c 89 ee             	mov    %r13,%rsi
+  801869:	bf 00 00 00 00       	mov    $0x0,%edi
+  80186e:	49 bc 7a 11 80 00 00 	movabs $0x80117a,%r12
+  801875:	00 00 00 
+  801878:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  80187b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801880:	4c 89 f6             	mov    %r14,%rsi
+  801883:	bf 00 00 00 00       	mov    $0x0,%edi
+  801888:	41 ff d4             	call   *%r12
+    return res;
+  80188b:	eb c3                	jmp    801850 <dup+0xe6>
+
+000000000080188d <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  80188d:	55                   	push   %rbp
+  80188e:	48 89 e5             	mov    %rsp,%rbp
+  801891:	41 56                	push   %r14
+  801893:	41 55                	push   %r13
+  801895:	41 54                	push   %r12
+  801897:	53                   	push   %rbx
+  801898:	48 83 ec 10          	sub    $0x10,%rsp
+  80189c:	89 fb                	mov    %edi,%ebx
+  80189e:	49 89 f4             	mov    %rsi,%r12
+  8018a1:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8018a4:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8018a8:	48 b8 aa 15 80 00 00 	movabs $0x8015aa,%rax
+  8018af:	00 00 00 
+  8018b2:	ff d0                	call   *%rax
+  8018b4:	85 c0                	test   %eax,%eax
+  8018b6:	78 4c                	js     801904 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8018b8:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  8018bc:	41 8b 3e             	mov    (%r14),%edi
+  8018bf:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8018c3:	48 b8 f5 15 80 00 00 	movabs $0x8015f5,%rax
+  8018ca:	00 00 00 
+  8018cd:	ff d0                	call   *%rax
+  8018cf:	85 c0                	test   %eax,%eax
+  8018d1:	78 35                	js     801908 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8018d3:	41 8b 46 08          	mov    0x8(%r14),%eax
+  8018d7:	83 e0 03             	and    $0x3,%eax
+  8018da:	83 f8 01             	cmp    $0x1,%eax
+  8018dd:	74 2d                	je     80190c <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  8018df:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8018e3:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8018e7:	48 85 c0             	test   %rax,%rax
+  8018ea:	74 56                	je     801942 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  8018ec:	4c 89 ea             	mov    %r13,%rdx
+  8018ef:	4c 89 e6             	mov    %r12,%rsi
+  8018f2:	4c 89 f7             	mov    %r14,%rdi
+  8018f5:	ff d0                	call   *%rax
+}
+  8018f7:	48 83 c4 10          	add    $0x10,%rsp
+  8018fb:	5b                   	pop    %rbx
+  8018fc:	41 5c                	pop    %r12
+  8018fe:	41 5d                	pop    %r13
+  801900:	41 5e                	pop    %r14
+  801902:	5d                   	pop    %rbp
+  801903:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801904:	48 98                	cltq
+  801906:	eb ef                	jmp    8018f7 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801908:	48 98                	cltq
+  80190a:	eb eb                	jmp    8018f7 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  80190c:	48 a1 08 50 80 00 00 	movabs 0x805008,%rax
+  801913:	00 00 00 
+  801916:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+  80191c:	89 da                	mov    %ebx,%edx
+  80191e:	48 bf a1 32 80 00 00 	movabs $0x8032a1,%rdi
+  801925:	00 00 00 
+  801928:	b8 00 00 00 00       	mov    $0x0,%eax
+  80192d:	48 b9 d9 01 80 00 00 	movabs $0x8001d9,%rcx
+  801934:	00 00 00 
+  801937:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801939:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801940:	eb b5                	jmp    8018f7 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801942:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801949:	eb ac                	jmp    8018f7 <read+0x6a>
+
+000000000080194b <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  80194b:	55                   	push   %rbp
+  80194c:	48 89 e5             	mov    %rsp,%rbp
+  80194f:	41 57                	push   %r15
+  801951:	41 56                	push   %r14
+  801953:	41 55                	push   %r13
+  801955:	41 54                	push   %r12
+  801957:	53                   	push   %rbx
+  801958:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  80195c:	48 85 d2             	test   %rdx,%rdx
+  80195f:	74 54                	je     8019b5 <readn+0x6a>
+  801961:	41 89 fd             	mov    %edi,%r13d
+  801964:	49 89 f6             	mov    %rsi,%r14
+  801967:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  80196a:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  80196f:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  801974:	49 bf 8d 18 80 00 00 	movabs $0x80188d,%r15
+  80197b:	00 00 00 
+  80197e:	4c 89 e2             	mov    %r12,%rdx
+  801981:	48 29 f2             	sub    %rsi,%rdx
+  801984:	4c 01 f6             	add    %r14,%rsi
+  801987:	44 89 ef             	mov    %r13d,%edi
+  80198a:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  80198d:	85 c0                	test   %eax,%eax
+  80198f:	78 20                	js     8019b1 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  801991:	01 c3                	add    %eax,%ebx
+  801993:	85 c0                	test   %eax,%eax
+  801995:	74 08                	je     80199f <readn+0x54>
+  801997:	48 63 f3             	movslq %ebx,%rsi
+  80199a:	4c 39 e6             	cmp    %r12,%rsi
+  80199d:	72 df                	jb     80197e <readn+0x33>
+    }
+    return res;
+  80199f:	48 63 c3             	movslq %ebx,%rax
+}
+  8019a2:	48 83 c4 08          	add    $0x8,%rsp
+  8019a6:	5b                   	pop    %rbx
+  8019a7:	41 5c                	pop    %r12
+  8019a9:	41 5d                	pop    %r13
+  8019ab:	41 5e                	pop    %r14
+  8019ad:	41 5f                	pop    %r15
+  8019af:	5d                   	pop    %rbp
+  8019b0:	c3                   	ret
+        if (inc < 0) return inc;
+  8019b1:	48 98                	cltq
+  8019b3:	eb ed                	jmp    8019a2 <readn+0x57>
+    int inc = 1, res = 0;
+  8019b5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8019ba:	eb e3                	jmp    80199f <readn+0x54>
+
+00000000008019bc <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  8019bc:	55                   	push   %rbp
+  8019bd:	48 89 e5             	mov    %rsp,%rbp
+  8019c0:	41 56                	push   %r14
+  8019c2:	41 55                	push   %r13
+  8019c4:	41 54                	push   %r12
+  8019c6:	53                   	push   %rbx
+  8019c7:	48 83 ec 10          	sub    $0x10,%rsp
+  8019cb:	89 fb                	mov    %edi,%ebx
+  8019cd:	49 89 f4             	mov    %rsi,%r12
+  8019d0:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8019d3:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8019d7:	48 b8 aa 15 80 00 00 	movabs $0x8015aa,%rax
+  8019de:	00 00 00 
+  8019e1:	ff d0                	call   *%rax
+  8019e3:	85 c0                	test   %eax,%eax
+  8019e5:	78 47                	js     801a2e <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8019e7:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  8019eb:	41 8b 3e             	mov    (%r14),%edi
+  8019ee:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8019f2:	48 b8 f5 15 80 00 00 	movabs $0x8015f5,%rax
+  8019f9:	00 00 00 
+  8019fc:	ff d0                	call   *%rax
+  8019fe:	85 c0                	test   %eax,%eax
+  801a00:	78 30                	js     801a32 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801a02:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  801a07:	74 2d                	je     801a36 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801a09:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801a0d:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801a11:	48 85 c0             	test   %rax,%rax
+  801a14:	74 56                	je     801a6c <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  801a16:	4c 89 ea             	mov    %r13,%rdx
+  801a19:	4c 89 e6             	mov    %r12,%rsi
+  801a1c:	4c 89 f7             	mov    %r14,%rdi
+  801a1f:	ff d0                	call   *%rax
+}
+  801a21:	48 83 c4 10          	add    $0x10,%rsp
+  801a25:	5b                   	pop    %rbx
+  801a26:	41 5c                	pop    %r12
+  801a28:	41 5d                	pop    %r13
+  801a2a:	41 5e                	pop    %r14
+  801a2c:	5d                   	pop    %rbp
+  801a2d:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801a2e:	48 98                	cltq
+  801a30:	eb ef                	jmp    801a21 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801a32:	48 98                	cltq
+  801a34:	eb eb                	jmp    801a21 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801a36:	48 a1 08 50 80 00 00 	movabs 0x805008,%rax
+  801a3d:	00 00 00 
+  801a40:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+  801a46:	89 da                	mov    %ebx,%edx
+  801a48:	48 bf bd 32 80 00 00 	movabs $0x8032bd,%rdi
+  801a4f:	00 00 00 
+  801a52:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a57:	48 b9 d9 01 80 00 00 	movabs $0x8001d9,%rcx
+  801a5e:	00 00 00 
+  801a61:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801a63:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801a6a:	eb b5                	jmp    801a21 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801a6c:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801a73:	eb ac                	jmp    801a21 <write+0x65>
+
+0000000000801a75 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  801a75:	55                   	push   %rbp
+  801a76:	48 89 e5             	mov    %rsp,%rbp
+  801a79:	53                   	push   %rbx
+  801a7a:	48 83 ec 18          	sub    $0x18,%rsp
+  801a7e:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801a80:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801a84:	48 b8 aa 15 80 00 00 	movabs $0x8015aa,%rax
+  801a8b:	00 00 00 
+  801a8e:	ff d0                	call   *%rax
+  801a90:	85 c0                	test   %eax,%eax
+  801a92:	78 0c                	js     801aa0 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  801a94:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801a98:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  801a9b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801aa0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801aa4:	c9                   	leave
+  801aa5:	c3                   	ret
+
+0000000000801aa6 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  801aa6:	55                   	push   %rbp
+  801aa7:	48 89 e5             	mov    %rsp,%rbp
+  801aaa:	41 55                	push   %r13
+  801aac:	41 54                	push   %r12
+  801aae:	53                   	push   %rbx
+  801aaf:	48 83 ec 18          	sub    $0x18,%rsp
+  801ab3:	89 fb                	mov    %edi,%ebx
+  801ab5:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801ab8:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801abc:	48 b8 aa 15 80 00 00 	movabs $0x8015aa,%rax
+  801ac3:	00 00 00 
+  801ac6:	ff d0                	call   *%rax
+  801ac8:	85 c0                	test   %eax,%eax
+  801aca:	78 38                	js     801b04 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801acc:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  801ad0:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  801ad4:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801ad8:	48 b8 f5 15 80 00 00 	movabs $0x8015f5,%rax
+  801adf:	00 00 00 
+  801ae2:	ff d0                	call   *%rax
+  801ae4:	85 c0                	test   %eax,%eax
+  801ae6:	78 1c                	js     801b04 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801ae8:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  801aed:	74 20                	je     801b0f <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801aef:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801af3:	48 8b 40 30          	mov    0x30(%rax),%rax
+  801af7:	48 85 c0             	test   %rax,%rax
+  801afa:	74 47                	je     801b43 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  801afc:	44 89 e6             	mov    %r12d,%esi
+  801aff:	4c 89 ef             	mov    %r13,%rdi
+  801b02:	ff d0                	call   *%rax
+}
+  801b04:	48 83 c4 18          	add    $0x18,%rsp
+  801b08:	5b                   	pop    %rbx
+  801b09:	41 5c                	pop    %r12
+  801b0b:	41 5d                	pop    %r13
+  801b0d:	5d                   	pop    %rbp
+  801b0e:	c3                   	ret
+                thisenv->env_id, fdnum);
+  801b0f:	48 a1 08 50 80 00 00 	movabs 0x805008,%rax
+  801b16:	00 00 00 
+  801b19:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801b1f:	89 da                	mov    %ebx,%edx
+  801b21:	48 bf 80 32 80 00 00 	movabs $0x803280,%rdi
+  801b28:	00 00 00 
+  801b2b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b30:	48 b9 d9 01 80 00 00 	movabs $0x8001d9,%rcx
+  801b37:	00 00 00 
+  801b3a:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801b3c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801b41:	eb c1                	jmp    801b04 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801b43:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801b48:	eb ba                	jmp    801b04 <ftruncate+0x5e>
+
+0000000000801b4a <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  801b4a:	55                   	push   %rbp
+  801b4b:	48 89 e5             	mov    %rsp,%rbp
+  801b4e:	41 54                	push   %r12
+  801b50:	53                   	push   %rbx
+  801b51:	48 83 ec 10          	sub    $0x10,%rsp
+  801b55:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801b58:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801b5c:	48 b8 aa 15 80 00 00 	movabs $0x8015aa,%rax
+  801b63:	00 00 00 
+  801b66:	ff d0                	call   *%rax
+  801b68:	85 c0                	test   %eax,%eax
+  801b6a:	78 4e                	js     801bba <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801b6c:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801b70:	41 8b 3c 24          	mov    (%r12),%edi
+  801b74:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801b78:	48 b8 f5 15 80 00 00 	movabs $0x8015f5,%rax
+  801b7f:	00 00 00 
+  801b82:	ff d0                	call   *%rax
+  801b84:	85 c0                	test   %eax,%eax
+  801b86:	78 32                	js     801bba <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801b88:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801b8c:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  801b91:	74 30                	je     801bc3 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  801b93:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  801b96:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  801b9d:	00 00 00 
+    stat->st_isdir = 0;
+  801ba0:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  801ba7:	00 00 00 
+    stat->st_dev = dev;
+  801baa:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  801bb1:	48 89 de             	mov    %rbx,%rsi
+  801bb4:	4c 89 e7             	mov    %r12,%rdi
+  801bb7:	ff 50 28             	call   *0x28(%rax)
+}
+  801bba:	48 83 c4 10          	add    $0x10,%rsp
+  801bbe:	5b                   	pop    %rbx
+  801bbf:	41 5c                	pop    %r12
+  801bc1:	5d                   	pop    %rbp
+  801bc2:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801bc3:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801bc8:	eb f0                	jmp    801bba <fstat+0x70>
+
+0000000000801bca <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  801bca:	55                   	push   %rbp
+  801bcb:	48 89 e5             	mov    %rsp,%rbp
+  801bce:	41 54                	push   %r12
+  801bd0:	53                   	push   %rbx
+  801bd1:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  801bd4:	be 00 00 00 00       	mov    $0x0,%esi
+  801bd9:	48 b8 ad 1f 80 00 00 	movabs $0x801fad,%rax
+  801be0:	00 00 00 
+  801be3:	ff d0                	call   *%rax
+  801be5:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  801be7:	85 c0                	test   %eax,%eax
+  801be9:	78 25                	js     801c10 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  801beb:	4c 89 e6             	mov    %r12,%rsi
+  801bee:	89 c7                	mov    %eax,%edi
+  801bf0:	48 b8 4a 1b 80 00 00 	movabs $0x801b4a,%rax
+  801bf7:	00 00 00 
+  801bfa:	ff d0                	call   *%rax
+  801bfc:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  801bff:	89 df                	mov    %ebx,%edi
+  801c01:	48 b8 0f 17 80 00 00 	movabs $0x80170f,%rax
+  801c08:	00 00 00 
+  801c0b:	ff d0                	call   *%rax
+
+    return res;
+  801c0d:	44 89 e3             	mov    %r12d,%ebx
+}
+  801c10:	89 d8                	mov    %ebx,%eax
+  801c12:	5b                   	pop    %rbx
+  801c13:	41 5c                	pop    %r12
+  801c15:	5d                   	pop    %rbp
+  801c16:	c3                   	ret
+
+0000000000801c17 <fsipc>:
+ * response may be written back to fsipcbuf.
+ * type: request code, passed as the simple integer IPC value.
+ * dstva: virtual address at which to receive reply page, 0 if none.
+ * Returns result from the file server. */
+static int
+fsipc(unsigned type, void *dstva) {
+  801c17:	55                   	push   %rbp
+  801c18:	48 89 e5             	mov    %rsp,%rbp
+  801c1b:	41 54                	push   %r12
+  801c1d:	53                   	push   %rbx
+  801c1e:	48 83 ec 10          	sub    $0x10,%rsp
+  801c22:	41 89 fc             	mov    %edi,%r12d
+  801c25:	48 89 f3             	mov    %rsi,%rbx
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  801c28:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  801c2f:	00 00 00 
+  801c32:	83 38 00             	cmpl   $0x0,(%rax)
+  801c35:	74 5e                	je     801c95 <fsipc+0x7e>
+    if (debug) {
+        cprintf("[%08x] fsipc %d %08x\n",
+                thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+    }
+
+    ipc_send(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW);
+  801c37:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  801c3d:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  801c42:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  801c49:	00 00 00 
+  801c4c:	44 89 e6             	mov    %r12d,%esi
+  801c4f:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  801c56:	00 00 00 
+  801c59:	8b 38                	mov    (%rax),%edi
+  801c5b:	48 b8 b7 2b 80 00 00 	movabs $0x802bb7,%rax
+  801c62:	00 00 00 
+  801c65:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  801c67:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  801c6e:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  801c6f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801c74:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  801c78:	48 89 de             	mov    %rbx,%rsi
+  801c7b:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c80:	48 b8 e2 2a 80 00 00 	movabs $0x802ae2,%rax
+  801c87:	00 00 00 
+  801c8a:	ff d0                	call   *%rax
+}
+  801c8c:	48 83 c4 10          	add    $0x10,%rsp
+  801c90:	5b                   	pop    %rbx
+  801c91:	41 5c                	pop    %r12
+  801c93:	5d                   	pop    %rbp
+  801c94:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  801c95:	bf 03 00 00 00       	mov    $0x3,%edi
+  801c9a:	48 b8 5a 2c 80 00 00 	movabs $0x802c5a,%rax
+  801ca1:	00 00 00 
+  801ca4:	ff d0                	call   *%rax
+  801ca6:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  801cad:	00 00 
+  801caf:	eb 86                	jmp    801c37 <fsipc+0x20>
+
+0000000000801cb1 <devfile_trunc>:
+    return 0;
+}
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  801cb1:	55                   	push   %rbp
+  801cb2:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801cb5:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  801cbc:	00 00 00 
+  801cbf:	8b 57 0c             	mov    0xc(%rdi),%edx
+  801cc2:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  801cc4:	89 70 04             	mov    %esi,0x4(%rax)
+
+    return fsipc(FSREQ_SET_SIZE, NULL);
+  801cc7:	be 00 00 00 00       	mov    $0x0,%esi
+  801ccc:	bf 02 00 00 00       	mov    $0x2,%edi
+  801cd1:	48 b8 17 1c 80 00 00 	movabs $0x801c17,%rax
+  801cd8:	00 00 00 
+  801cdb:	ff d0                	call   *%rax
+}
+  801cdd:	5d                   	pop    %rbp
+  801cde:	c3                   	ret
+
+0000000000801cdf <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  801cdf:	55                   	push   %rbp
+  801ce0:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801ce3:	8b 47 0c             	mov    0xc(%rdi),%eax
+  801ce6:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  801ced:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  801cef:	be 00 00 00 00       	mov    $0x0,%esi
+  801cf4:	bf 06 00 00 00       	mov    $0x6,%edi
+  801cf9:	48 b8 17 1c 80 00 00 	movabs $0x801c17,%rax
+  801d00:	00 00 00 
+  801d03:	ff d0                	call   *%rax
+}
+  801d05:	5d                   	pop    %rbp
+  801d06:	c3                   	ret
+
+0000000000801d07 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  801d07:	55                   	push   %rbp
+  801d08:	48 89 e5             	mov    %rsp,%rbp
+  801d0b:	41 54                	push   %r12
+  801d0d:	53                   	push   %rbx
+  801d0e:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801d11:	8b 47 0c             	mov    0xc(%rdi),%eax
+  801d14:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  801d1b:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  801d1d:	be 00 00 00 00       	mov    $0x0,%esi
+  801d22:	bf 05 00 00 00       	mov    $0x5,%edi
+  801d27:	48 b8 17 1c 80 00 00 	movabs $0x801c17,%rax
+  801d2e:	00 00 00 
+  801d31:	ff d0                	call   *%rax
+    if (res < 0) {
+  801d33:	85 c0                	test   %eax,%eax
+  801d35:	78 3d                	js     801d74 <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801d37:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  801d3e:	00 00 00 
+  801d41:	4c 89 e6             	mov    %r12,%rsi
+  801d44:	48 89 df             	mov    %rbx,%rdi
+  801d47:	48 b8 fe 0a 80 00 00 	movabs $0x800afe,%rax
+  801d4e:	00 00 00 
+  801d51:	ff d0                	call   *%rax
+    st->st_size  = fsipcbuf.statRet.ret_size;
+  801d53:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  801d5a:	00 
+  801d5b:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801d61:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  801d68:	00 
+  801d69:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  801d6f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801d74:	5b                   	pop    %rbx
+  801d75:	41 5c                	pop    %r12
+  801d77:	5d                   	pop    %rbp
+  801d78:	c3                   	ret
+
+0000000000801d79 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  801d79:	55                   	push   %rbp
+  801d7a:	48 89 e5             	mov    %rsp,%rbp
+  801d7d:	41 57                	push   %r15
+  801d7f:	41 56                	push   %r14
+  801d81:	41 55                	push   %r13
+  801d83:	41 54                	push   %r12
+  801d85:	53                   	push   %rbx
+  801d86:	48 83 ec 18          	sub    $0x18,%rsp
+  801d8a:	49 89 fe             	mov    %rdi,%r14
+  801d8d:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+  801d91:	48 89 d3             	mov    %rdx,%rbx
+    while (n > sizeof(fsipcbuf.write.req_buf))
+  801d94:	48 81 fa f0 0f 00 00 	cmp    $0xff0,%rdx
+  801d9b:	0f 86 e4 00 00 00    	jbe    801e85 <devfile_write+0x10c>
+  801da1:	49 89 f4             	mov    %rsi,%r12
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801da4:	49 bd 00 60 80 00 00 	movabs $0x806000,%r13
+  801dab:	00 00 00 
+        memcpy(fsipcbuf.write.req_buf, buf, sizeof(fsipcbuf.write.req_buf));
+  801dae:	49 bf 5f 0d 80 00 00 	movabs $0x800d5f,%r15
+  801db5:	00 00 00 
+  801db8:	eb 03                	jmp    801dbd <devfile_write+0x44>
+        buf += sizeof(fsipcbuf.write.req_buf);
+  801dba:	49 89 f4             	mov    %rsi,%r12
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801dbd:	41 8b 46 0c          	mov    0xc(%r14),%eax
+  801dc1:	41 89 45 00          	mov    %eax,0x0(%r13)
+        fsipcbuf.write.req_n      = sizeof(fsipcbuf.write.req_buf);
+  801dc5:	49 c7 45 08 f0 0f 00 	movq   $0xff0,0x8(%r13)
+  801dcc:	00 
+        memcpy(fsipcbuf.write.req_buf, buf, sizeof(fsipcbuf.write.req_buf));
+  801dcd:	ba f0 0f 00 00       	mov    $0xff0,%edx
+  801dd2:	4c 89 e6             	mov    %r12,%rsi
+  801dd5:	48 bf 10 60 80 00 00 	movabs $0x806010,%rdi
+  801ddc:	00 00 00 
+  801ddf:	41 ff d7             	call   *%r15
+        ssize_t res = fsipc(FSREQ_WRITE, NULL);
+  801de2:	be 00 00 00 00       	mov    $0x0,%esi
+  801de7:	bf 04 00 00 00       	mov    $0x4,%edi
+  801dec:	48 b8 17 1c 80 00 00 	movabs $0x801c17,%rax
+  801df3:	00 00 00 
+  801df6:	ff d0                	call   *%rax
+  801df8:	48 63 d0             	movslq %eax,%rdx
+        if (res < 0 || res < sizeof(fsipcbuf.write.req_buf))
+  801dfb:	3d ef 0f 00 00       	cmp    $0xfef,%eax
+  801e00:	7e 71                	jle    801e73 <devfile_write+0xfa>
+        buf += sizeof(fsipcbuf.write.req_buf);
+  801e02:	49 8d b4 24 f0 0f 00 	lea    0xff0(%r12),%rsi
+  801e09:	00 
+        n -= sizeof(fsipcbuf.write.req_buf);
+  801e0a:	48 81 eb f0 0f 00 00 	sub    $0xff0,%rbx
+    while (n > sizeof(fsipcbuf.write.req_buf))
+  801e11:	48 81 fb f0 0f 00 00 	cmp    $0xff0,%rbx
+  801e18:	77 a0                	ja     801dba <devfile_write+0x41>
+        written += sizeof(fsipcbuf.write.req_buf);
+  801e1a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801e1e:	49 29 c4             	sub    %rax,%r12
+  801e21:	4d 8d a4 24 f0 0f 00 	lea    0xff0(%r12),%r12
+  801e28:	00 
+    fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801e29:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  801e30:	00 00 00 
+  801e33:	41 8b 56 0c          	mov    0xc(%r14),%edx
+  801e37:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.write.req_n      = n;
+  801e39:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    memcpy(fsipcbuf.write.req_buf, buf, n);
+  801e3d:	48 89 da             	mov    %rbx,%rdx
+  801e40:	48 8d 78 10          	lea    0x10(%rax),%rdi
+  801e44:	48 b8 5f 0d 80 00 00 	movabs $0x800d5f,%rax
+  801e4b:	00 00 00 
+  801e4e:	ff d0                	call   *%rax
+    ssize_t res = fsipc(FSREQ_WRITE, NULL);
+  801e50:	be 00 00 00 00       	mov    $0x0,%esi
+  801e55:	bf 04 00 00 00       	mov    $0x4,%edi
+  801e5a:	48 b8 17 1c 80 00 00 	movabs $0x801c17,%rax
+  801e61:	00 00 00 
+  801e64:	ff d0                	call   *%rax
+  801e66:	48 63 d0             	movslq %eax,%rdx
+    written += res;
+  801e69:	49 01 d4             	add    %rdx,%r12
+  801e6c:	48 85 d2             	test   %rdx,%rdx
+  801e6f:	49 0f 49 d4          	cmovns %r12,%rdx
+}
+  801e73:	48 89 d0             	mov    %rdx,%rax
+  801e76:	48 83 c4 18          	add    $0x18,%rsp
+  801e7a:	5b                   	pop    %rbx
+  801e7b:	41 5c                	pop    %r12
+  801e7d:	41 5d                	pop    %r13
+  801e7f:	41 5e                	pop    %r14
+  801e81:	41 5f                	pop    %r15
+  801e83:	5d                   	pop    %rbp
+  801e84:	c3                   	ret
+    while (n > sizeof(fsipcbuf.write.req_buf))
+  801e85:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+    ssize_t written = 0;
+  801e89:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  801e8f:	eb 98                	jmp    801e29 <devfile_write+0xb0>
+
+0000000000801e91 <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  801e91:	55                   	push   %rbp
+  801e92:	48 89 e5             	mov    %rsp,%rbp
+  801e95:	41 57                	push   %r15
+  801e97:	41 56                	push   %r14
+  801e99:	41 55                	push   %r13
+  801e9b:	41 54                	push   %r12
+  801e9d:	53                   	push   %rbx
+  801e9e:	48 83 ec 18          	sub    $0x18,%rsp
+  801ea2:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  801ea6:	49 89 f6             	mov    %rsi,%r14
+  801ea9:	49 89 d4             	mov    %rdx,%r12
+    while (n > sizeof(fsipcbuf.readRet.ret_buf))
+  801eac:	48 81 fa 00 10 00 00 	cmp    $0x1000,%rdx
+  801eb3:	0f 86 ea 00 00 00    	jbe    801fa3 <devfile_read+0x112>
+    ssize_t readsz = 0;
+  801eb9:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  801ec0:	00 
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801ec1:	49 bf 00 60 80 00 00 	movabs $0x806000,%r15
+  801ec8:	00 00 00 
+  801ecb:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801ecf:	8b 40 0c             	mov    0xc(%rax),%eax
+  801ed2:	41 89 07             	mov    %eax,(%r15)
+        fsipcbuf.read.req_n = sizeof(fsipcbuf.readRet.ret_buf);
+  801ed5:	49 c7 47 08 00 10 00 	movq   $0x1000,0x8(%r15)
+  801edc:	00 
+        ssize_t res = fsipc(FSREQ_READ, NULL);
+  801edd:	be 00 00 00 00       	mov    $0x0,%esi
+  801ee2:	bf 03 00 00 00       	mov    $0x3,%edi
+  801ee7:	48 b8 17 1c 80 00 00 	movabs $0x801c17,%rax
+  801eee:	00 00 00 
+  801ef1:	ff d0                	call   *%rax
+  801ef3:	4c 63 e8             	movslq %eax,%r13
+        if (res < 0)
+  801ef6:	4d 85 ed             	test   %r13,%r13
+  801ef9:	0f 88 92 00 00 00    	js     801f91 <devfile_read+0x100>
+        memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  801eff:	4c 89 ea             	mov    %r13,%rdx
+  801f02:	4c 89 fe             	mov    %r15,%rsi
+  801f05:	4c 89 f7             	mov    %r14,%rdi
+  801f08:	48 b8 5f 0d 80 00 00 	movabs $0x800d5f,%rax
+  801f0f:	00 00 00 
+  801f12:	ff d0                	call   *%rax
+        if (res < sizeof(fsipcbuf.readRet.ret_buf))
+  801f14:	49 81 fd ff 0f 00 00 	cmp    $0xfff,%r13
+  801f1b:	76 6d                	jbe    801f8a <devfile_read+0xf9>
+        readsz += res;
+  801f1d:	4c 01 6d c0          	add    %r13,-0x40(%rbp)
+        buf += res;
+  801f21:	4d 01 ee             	add    %r13,%r14
+        n -= res;
+  801f24:	4d 29 ec             	sub    %r13,%r12
+    while (n > sizeof(fsipcbuf.readRet.ret_buf))
+  801f27:	49 81 fc 00 10 00 00 	cmp    $0x1000,%r12
+  801f2e:	77 9b                	ja     801ecb <devfile_read+0x3a>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801f30:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  801f37:	00 00 00 
+  801f3a:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  801f3e:	8b 51 0c             	mov    0xc(%rcx),%edx
+  801f41:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.read.req_n = n;
+  801f43:	4c 89 60 08          	mov    %r12,0x8(%rax)
+    ssize_t res = fsipc(FSREQ_READ, NULL);
+  801f47:	be 00 00 00 00       	mov    $0x0,%esi
+  801f4c:	bf 03 00 00 00       	mov    $0x3,%edi
+  801f51:	48 b8 17 1c 80 00 00 	movabs $0x801c17,%rax
+  801f58:	00 00 00 
+  801f5b:	ff d0                	call   *%rax
+  801f5d:	4c 63 e8             	movslq %eax,%r13
+    if (res < 0)
+  801f60:	4d 85 ed             	test   %r13,%r13
+  801f63:	78 2c                	js     801f91 <devfile_read+0x100>
+    memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  801f65:	4c 89 ea             	mov    %r13,%rdx
+  801f68:	48 be 00 60 80 00 00 	movabs $0x806000,%rsi
+  801f6f:	00 00 00 
+  801f72:	4c 89 f7             	mov    %r14,%rdi
+  801f75:	48 b8 5f 0d 80 00 00 	movabs $0x800d5f,%rax
+  801f7c:	00 00 00 
+  801f7f:	ff d0                	call   *%rax
+    readsz += res;
+  801f81:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  801f85:	49 01 c5             	add    %rax,%r13
+    return readsz;
+  801f88:	eb 07                	jmp    801f91 <devfile_read+0x100>
+            return readsz + res;
+  801f8a:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  801f8e:	49 01 c5             	add    %rax,%r13
+}
+  801f91:	4c 89 e8             	mov    %r13,%rax
+  801f94:	48 83 c4 18          	add    $0x18,%rsp
+  801f98:	5b                   	pop    %rbx
+  801f99:	41 5c                	pop    %r12
+  801f9b:	41 5d                	pop    %r13
+  801f9d:	41 5e                	pop    %r14
+  801f9f:	41 5f                	pop    %r15
+  801fa1:	5d                   	pop    %rbp
+  801fa2:	c3                   	ret
+    ssize_t readsz = 0;
+  801fa3:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  801faa:	00 
+  801fab:	eb 83                	jmp    801f30 <devfile_read+0x9f>
+
+0000000000801fad <open>:
+open(const char *path, int mode) {
+  801fad:	55                   	push   %rbp
+  801fae:	48 89 e5             	mov    %rsp,%rbp
+  801fb1:	41 55                	push   %r13
+  801fb3:	41 54                	push   %r12
+  801fb5:	53                   	push   %rbx
+  801fb6:	48 83 ec 18          	sub    $0x18,%rsp
+  801fba:	49 89 fc             	mov    %rdi,%r12
+  801fbd:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  801fc0:	48 b8 c0 0a 80 00 00 	movabs $0x800ac0,%rax
+  801fc7:	00 00 00 
+  801fca:	ff d0                	call   *%rax
+  801fcc:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  801fd2:	0f 87 8a 00 00 00    	ja     802062 <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  801fd8:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  801fdc:	48 b8 90 15 80 00 00 	movabs $0x801590,%rax
+  801fe3:	00 00 00 
+  801fe6:	ff d0                	call   *%rax
+  801fe8:	89 c3                	mov    %eax,%ebx
+  801fea:	85 c0                	test   %eax,%eax
+  801fec:	78 50                	js     80203e <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  801fee:	4c 89 e6             	mov    %r12,%rsi
+  801ff1:	48 bb 00 60 80 00 00 	movabs $0x806000,%rbx
+  801ff8:	00 00 00 
+  801ffb:	48 89 df             	mov    %rbx,%rdi
+  801ffe:	48 b8 fe 0a 80 00 00 	movabs $0x800afe,%rax
+  802005:	00 00 00 
+  802008:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  80200a:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  802011:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802015:	bf 01 00 00 00       	mov    $0x1,%edi
+  80201a:	48 b8 17 1c 80 00 00 	movabs $0x801c17,%rax
+  802021:	00 00 00 
+  802024:	ff d0                	call   *%rax
+  802026:	89 c3                	mov    %eax,%ebx
+  802028:	85 c0                	test   %eax,%eax
+  80202a:	78 1f                	js     80204b <open+0x9e>
+    return fd2num(fd);
+  80202c:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802030:	48 b8 e9 14 80 00 00 	movabs $0x8014e9,%rax
+  802037:	00 00 00 
+  80203a:	ff d0                	call   *%rax
+  80203c:	89 c3                	mov    %eax,%ebx
+}
+  80203e:	89 d8                	mov    %ebx,%eax
+  802040:	48 83 c4 18          	add    $0x18,%rsp
+  802044:	5b                   	pop    %rbx
+  802045:	41 5c                	pop    %r12
+  802047:	41 5d                	pop    %r13
+  802049:	5d                   	pop    %rbp
+  80204a:	c3                   	ret
+        fd_close(fd, 0);
+  80204b:	be 00 00 00 00       	mov    $0x0,%esi
+  802050:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802054:	48 b8 65 16 80 00 00 	movabs $0x801665,%rax
+  80205b:	00 00 00 
+  80205e:	ff d0                	call   *%rax
+        return res;
+  802060:	eb dc                	jmp    80203e <open+0x91>
+        return -E_BAD_PATH;
+  802062:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  802067:	eb d5                	jmp    80203e <open+0x91>
+
+0000000000802069 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  802069:	55                   	push   %rbp
+  80206a:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc(FSREQ_SYNC, NULL);
+  80206d:	be 00 00 00 00       	mov    $0x0,%esi
+  802072:	bf 08 00 00 00       	mov    $0x8,%edi
+  802077:	48 b8 17 1c 80 00 00 	movabs $0x801c17,%rax
+  80207e:	00 00 00 
+  802081:	ff d0                	call   *%rax
+}
+  802083:	5d                   	pop    %rbp
+  802084:	c3                   	ret
+
+0000000000802085 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  802085:	55                   	push   %rbp
+  802086:	48 89 e5             	mov    %rsp,%rbp
+  802089:	41 54                	push   %r12
+  80208b:	53                   	push   %rbx
+  80208c:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80208f:	48 b8 fb 14 80 00 00 	movabs $0x8014fb,%rax
+  802096:	00 00 00 
+  802099:	ff d0                	call   *%rax
+  80209b:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  80209e:	48 be 00 33 80 00 00 	movabs $0x803300,%rsi
+  8020a5:	00 00 00 
+  8020a8:	48 89 df             	mov    %rbx,%rdi
+  8020ab:	48 b8 fe 0a 80 00 00 	movabs $0x800afe,%rax
+  8020b2:	00 00 00 
+  8020b5:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  8020b7:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  8020bc:	41 2b 04 24          	sub    (%r12),%eax
+  8020c0:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  8020c6:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8020cd:	00 00 00 
+    stat->st_dev = &devpipe;
+  8020d0:	48 b8 60 40 80 00 00 	movabs $0x804060,%rax
+  8020d7:	00 00 00 
+  8020da:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  8020e1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020e6:	5b                   	pop    %rbx
+  8020e7:	41 5c                	pop    %r12
+  8020e9:	5d                   	pop    %rbp
+  8020ea:	c3                   	ret
+
+00000000008020eb <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  8020eb:	55                   	push   %rbp
+  8020ec:	48 89 e5             	mov    %rsp,%rbp
+  8020ef:	41 54                	push   %r12
+  8020f1:	53                   	push   %rbx
+  8020f2:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8020f5:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8020fa:	48 89 fe             	mov    %rdi,%rsi
+  8020fd:	bf 00 00 00 00       	mov    $0x0,%edi
+  802102:	49 bc 7a 11 80 00 00 	movabs $0x80117a,%r12
+  802109:	00 00 00 
+  80210c:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  80210f:	48 89 df             	mov    %rbx,%rdi
+  802112:	48 b8 fb 14 80 00 00 	movabs $0x8014fb,%rax
+  802119:	00 00 00 
+  80211c:	ff d0                	call   *%rax
+  80211e:	48 89 c6             	mov    %rax,%rsi
+  802121:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802126:	bf 00 00 00 00       	mov    $0x0,%edi
+  80212b:	41 ff d4             	call   *%r12
+}
+  80212e:	5b                   	pop    %rbx
+  80212f:	41 5c                	pop    %r12
+  802131:	5d                   	pop    %rbp
+  802132:	c3                   	ret
+
+0000000000802133 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  802133:	55                   	push   %rbp
+  802134:	48 89 e5             	mov    %rsp,%rbp
+  802137:	41 57                	push   %r15
+  802139:	41 56                	push   %r14
+  80213b:	41 55                	push   %r13
+  80213d:	41 54                	push   %r12
+  80213f:	53                   	push   %rbx
+  802140:	48 83 ec 18          	sub    $0x18,%rsp
+  802144:	49 89 fc             	mov    %rdi,%r12
+  802147:	49 89 f5             	mov    %rsi,%r13
+  80214a:	49 89 d7             	mov    %rdx,%r15
+  80214d:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802151:	48 b8 fb 14 80 00 00 	movabs $0x8014fb,%rax
+  802158:	00 00 00 
+  80215b:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  80215d:	4d 85 ff             	test   %r15,%r15
+  802160:	0f 84 af 00 00 00    	je     802215 <devpipe_write+0xe2>
+  802166:	48 89 c3             	mov    %rax,%rbx
+  802169:	4c 89 f8             	mov    %r15,%rax
+  80216c:	4d 89 ef             	mov    %r13,%r15
+  80216f:	4c 01 e8             	add    %r13,%rax
+  802172:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802176:	49 bd 82 10 80 00 00 	movabs $0x801082,%r13
+  80217d:	00 00 00 
+            sys_yield();
+  802180:	49 be 1f 10 80 00 00 	movabs $0x80101f,%r14
+  802187:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  80218a:	8b 73 04             	mov    0x4(%rbx),%esi
+  80218d:	48 63 ce             	movslq %esi,%rcx
+  802190:	48 63 03             	movslq (%rbx),%rax
+  802193:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  802199:	48 39 c1             	cmp    %rax,%rcx
+  80219c:	72 2e                	jb     8021cc <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80219e:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8021a3:	48 89 da             	mov    %rbx,%rdx
+  8021a6:	be 00 10 00 00       	mov    $0x1000,%esi
+  8021ab:	4c 89 e7             	mov    %r12,%rdi
+  8021ae:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  8021b1:	85 c0                	test   %eax,%eax
+  8021b3:	74 66                	je     80221b <devpipe_write+0xe8>
+            sys_yield();
+  8021b5:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  8021b8:	8b 73 04             	mov    0x4(%rbx),%esi
+  8021bb:	48 63 ce             	movslq %esi,%rcx
+  8021be:	48 63 03             	movslq (%rbx),%rax
+  8021c1:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  8021c7:	48 39 c1             	cmp    %rax,%rcx
+  8021ca:	73 d2                	jae    80219e <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8021cc:	41 0f b6 3f          	movzbl (%r15),%edi
+  8021d0:	48 89 ca             	mov    %rcx,%rdx
+  8021d3:	48 c1 ea 03          	shr    $0x3,%rdx
+  8021d7:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  8021de:	08 10 20 
+  8021e1:	48 f7 e2             	mul    %rdx
+  8021e4:	48 c1 ea 06          	shr    $0x6,%rdx
+  8021e8:	48 89 d0             	mov    %rdx,%rax
+  8021eb:	48 c1 e0 09          	shl    $0x9,%rax
+  8021ef:	48 29 d0             	sub    %rdx,%rax
+  8021f2:	48 c1 e0 03          	shl    $0x3,%rax
+  8021f6:	48 29 c1             	sub    %rax,%rcx
+  8021f9:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  8021fe:	83 c6 01             	add    $0x1,%esi
+  802201:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  802204:	49 83 c7 01          	add    $0x1,%r15
+  802208:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80220c:	49 39 c7             	cmp    %rax,%r15
+  80220f:	0f 85 75 ff ff ff    	jne    80218a <devpipe_write+0x57>
+    return n;
+  802215:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802219:	eb 05                	jmp    802220 <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  80221b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802220:	48 83 c4 18          	add    $0x18,%rsp
+  802224:	5b                   	pop    %rbx
+  802225:	41 5c                	pop    %r12
+  802227:	41 5d                	pop    %r13
+  802229:	41 5e                	pop    %r14
+  80222b:	41 5f                	pop    %r15
+  80222d:	5d                   	pop    %rbp
+  80222e:	c3                   	ret
+
+000000000080222f <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  80222f:	55                   	push   %rbp
+  802230:	48 89 e5             	mov    %rsp,%rbp
+  802233:	41 57                	push   %r15
+  802235:	41 56                	push   %r14
+  802237:	41 55                	push   %r13
+  802239:	41 54                	push   %r12
+  80223b:	53                   	push   %rbx
+  80223c:	48 83 ec 18          	sub    $0x18,%rsp
+  802240:	49 89 fc             	mov    %rdi,%r12
+  802243:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  802247:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80224b:	48 b8 fb 14 80 00 00 	movabs $0x8014fb,%rax
+  802252:	00 00 00 
+  802255:	ff d0                	call   *%rax
+  802257:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  80225a:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802260:	49 bd 82 10 80 00 00 	movabs $0x801082,%r13
+  802267:	00 00 00 
+            sys_yield();
+  80226a:	49 be 1f 10 80 00 00 	movabs $0x80101f,%r14
+  802271:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  802274:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  802279:	74 7d                	je     8022f8 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  80227b:	8b 03                	mov    (%rbx),%eax
+  80227d:	3b 43 04             	cmp    0x4(%rbx),%eax
+  802280:	75 26                	jne    8022a8 <devpipe_read+0x79>
+            if (i > 0) return i;
+  802282:	4d 85 ff             	test   %r15,%r15
+  802285:	75 77                	jne    8022fe <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802287:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80228c:	48 89 da             	mov    %rbx,%rdx
+  80228f:	be 00 10 00 00       	mov    $0x1000,%esi
+  802294:	4c 89 e7             	mov    %r12,%rdi
+  802297:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  80229a:	85 c0                	test   %eax,%eax
+  80229c:	74 72                	je     802310 <devpipe_read+0xe1>
+            sys_yield();
+  80229e:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  8022a1:	8b 03                	mov    (%rbx),%eax
+  8022a3:	3b 43 04             	cmp    0x4(%rbx),%eax
+  8022a6:	74 df                	je     802287 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  8022a8:	48 63 c8             	movslq %eax,%rcx
+  8022ab:	48 89 ca             	mov    %rcx,%rdx
+  8022ae:	48 c1 ea 03          	shr    $0x3,%rdx
+  8022b2:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  8022b9:	08 10 20 
+  8022bc:	48 89 d0             	mov    %rdx,%rax
+  8022bf:	48 f7 e6             	mul    %rsi
+  8022c2:	48 c1 ea 06          	shr    $0x6,%rdx
+  8022c6:	48 89 d0             	mov    %rdx,%rax
+  8022c9:	48 c1 e0 09          	shl    $0x9,%rax
+  8022cd:	48 29 d0             	sub    %rdx,%rax
+  8022d0:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  8022d7:	00 
+  8022d8:	48 89 c8             	mov    %rcx,%rax
+  8022db:	48 29 d0             	sub    %rdx,%rax
+  8022de:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  8022e3:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8022e7:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  8022eb:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8022ee:	49 83 c7 01          	add    $0x1,%r15
+  8022f2:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  8022f6:	75 83                	jne    80227b <devpipe_read+0x4c>
+    return n;
+  8022f8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8022fc:	eb 03                	jmp    802301 <devpipe_read+0xd2>
+            if (i > 0) return i;
+  8022fe:	4c 89 f8             	mov    %r15,%rax
+}
+  802301:	48 83 c4 18          	add    $0x18,%rsp
+  802305:	5b                   	pop    %rbx
+  802306:	41 5c                	pop    %r12
+  802308:	41 5d                	pop    %r13
+  80230a:	41 5e                	pop    %r14
+  80230c:	41 5f                	pop    %r15
+  80230e:	5d                   	pop    %rbp
+  80230f:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  802310:	b8 00 00 00 00       	mov    $0x0,%eax
+  802315:	eb ea                	jmp    802301 <devpipe_read+0xd2>
+
+0000000000802317 <pipe>:
+pipe(int pfd[2]) {
+  802317:	55                   	push   %rbp
+  802318:	48 89 e5             	mov    %rsp,%rbp
+  80231b:	41 55                	push   %r13
+  80231d:	41 54                	push   %r12
+  80231f:	53                   	push   %rbx
+  802320:	48 81 ec b8 00 00 00 	sub    $0xb8,%rsp
+  802327:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  80232a:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  80232e:	48 b8 90 15 80 00 00 	movabs $0x801590,%rax
+  802335:	00 00 00 
+  802338:	ff d0                	call   *%rax
+  80233a:	89 c3                	mov    %eax,%ebx
+  80233c:	85 c0                	test   %eax,%eax
+  80233e:	0f 88 51 01 00 00    	js     802495 <pipe+0x17e>
+        (res = fd_alloc_from(fd2num(fd0) + 1, &fd1)) < 0) goto err;
+  802344:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802348:	48 b8 e9 14 80 00 00 	movabs $0x8014e9,%rax
+  80234f:	00 00 00 
+  802352:	ff d0                	call   *%rax
+  802354:	8d 78 01             	lea    0x1(%rax),%edi
+  802357:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80235b:	48 b8 17 15 80 00 00 	movabs $0x801517,%rax
+  802362:	00 00 00 
+  802365:	ff d0                	call   *%rax
+  802367:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  802369:	85 c0                	test   %eax,%eax
+  80236b:	0f 88 24 01 00 00    	js     802495 <pipe+0x17e>
+    va = fd2data(fd0);
+  802371:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802375:	48 bb fb 14 80 00 00 	movabs $0x8014fb,%rbx
+  80237c:	00 00 00 
+  80237f:	ff d3                	call   *%rbx
+  802381:	49 89 c5             	mov    %rax,%r13
+    struct RegionOp ops[] = {
+  802384:	48 8d bd 30 ff ff ff 	lea    -0xd0(%rbp),%rdi
+  80238b:	b9 14 00 00 00       	mov    $0x14,%ecx
+  802390:	b8 00 00 00 00       	mov    $0x0,%eax
+  802395:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+  802398:	c7 85 34 ff ff ff 46 	movl   $0x46,-0xcc(%rbp)
+  80239f:	00 00 00 
+  8023a2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8023a6:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+  8023ad:	48 c7 85 50 ff ff ff 	movq   $0x1000,-0xb0(%rbp)
+  8023b4:	00 10 00 00 
+  8023b8:	c7 85 5c ff ff ff 46 	movl   $0x46,-0xa4(%rbp)
+  8023bf:	00 00 00 
+            {.type = REGION_ALLOC, .dstva = (uintptr_t)fd1, .size = PAGE_SIZE, .perm = PROT_RW | PROT_SHARE},
+  8023c2:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+    struct RegionOp ops[] = {
+  8023c6:	48 89 bd 70 ff ff ff 	mov    %rdi,-0x90(%rbp)
+  8023cd:	48 c7 85 78 ff ff ff 	movq   $0x1000,-0x88(%rbp)
+  8023d4:	00 10 00 00 
+  8023d8:	c7 45 84 46 00 00 00 	movl   $0x46,-0x7c(%rbp)
+  8023df:	4c 89 6d 98          	mov    %r13,-0x68(%rbp)
+  8023e3:	48 c7 45 a0 00 10 00 	movq   $0x1000,-0x60(%rbp)
+  8023ea:	00 
+  8023eb:	c7 45 a8 01 00 00 00 	movl   $0x1,-0x58(%rbp)
+  8023f2:	c7 45 ac 46 00 00 00 	movl   $0x46,-0x54(%rbp)
+  8023f9:	4c 89 6d b8          	mov    %r13,-0x48(%rbp)
+            {.type = REGION_MAP, .srcva = (uintptr_t)va, .dstva = (uintptr_t)fd2data(fd1), .size = PAGE_SIZE, .perm = PROT_RW | PROT_SHARE},
+  8023fd:	ff d3                	call   *%rbx
+    struct RegionOp ops[] = {
+  8023ff:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802403:	48 c7 45 c8 00 10 00 	movq   $0x1000,-0x38(%rbp)
+  80240a:	00 
+    if ((res = sys_region_batch(ops, sizeof ops / sizeof *ops)) < 0) goto err1;
+  80240b:	be 04 00 00 00       	mov    $0x4,%esi
+  802410:	48 8d bd 30 ff ff ff 	lea    -0xd0(%rbp),%rdi
+  802417:	48 b8 e1 11 80 00 00 	movabs $0x8011e1,%rax
+  80241e:	00 00 00 
+  802421:	ff d0                	call   *%rax
+  802423:	89 c3                	mov    %eax,%ebx
+  802425:	85 c0                	test   %eax,%eax
+  802427:	0f 88 ad 00 00 00    	js     8024da <pipe+0x1c3>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  80242d:	be 00 10 00 00       	mov    $0x1000,%esi
+  802432:	4c 89 ef             	mov    %r13,%rdi
+  802435:	48 b8 50 10 80 00 00 	movabs $0x801050,%rax
+  80243c:	00 00 00 
+  80243f:	ff d0                	call   *%rax
+  802441:	83 f8 02             	cmp    $0x2,%eax
+  802444:	75 5f                	jne    8024a5 <pipe+0x18e>
+    fd0->fd_dev_id = devpipe.dev_id;
+  802446:	a1 60 40 80 00 00 00 	movabs 0x804060,%eax
+  80244d:	00 00 
+  80244f:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802453:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  802455:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802459:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  802460:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  802464:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  802466:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80246a:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  802471:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802475:	48 bb e9 14 80 00 00 	movabs $0x8014e9,%rbx
+  80247c:	00 00 00 
+  80247f:	ff d3                	call   *%rbx
+  802481:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  802485:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  802489:	ff d3                	call   *%rbx
+  80248b:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  802490:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  802495:	89 d8                	mov    %ebx,%eax
+  802497:	48 81 c4 b8 00 00 00 	add    $0xb8,%rsp
+  80249e:	5b                   	pop    %rbx
+  80249f:	41 5c                	pop    %r12
+  8024a1:	41 5d                	pop    %r13
+  8024a3:	5d                   	pop    %rbp
+  8024a4:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8024a5:	48 b9 30 33 80 00 00 	movabs $0x803330,%rcx
+  8024ac:	00 00 00 
+  8024af:	48 ba 07 33 80 00 00 	movabs $0x803307,%rdx
+  8024b6:	00 00 00 
+  8024b9:	be 33 00 00 00       	mov    $0x33,%esi
+  8024be:	48 bf 1c 33 80 00 00 	movabs $0x80331c,%rdi
+  8024c5:	00 00 00 
+  8024c8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024cd:	49 b8 3f 2a 80 00 00 	movabs $0x802a3f,%r8
+  8024d4:	00 00 00 
+  8024d7:	41 ff d0             	call   *%r8
+        ops[i].type = REGION_UNMAP;
+  8024da:	c7 85 30 ff ff ff 02 	movl   $0x2,-0xd0(%rbp)
+  8024e1:	00 00 00 
+  8024e4:	c7 85 58 ff ff ff 02 	movl   $0x2,-0xa8(%rbp)
+  8024eb:	00 00 00 
+  8024ee:	c7 45 80 02 00 00 00 	movl   $0x2,-0x80(%rbp)
+  8024f5:	c7 45 a8 02 00 00 00 	movl   $0x2,-0x58(%rbp)
+    sys_region_batch(ops, sizeof ops / sizeof *ops);
+  8024fc:	be 04 00 00 00       	mov    $0x4,%esi
+  802501:	48 8d bd 30 ff ff ff 	lea    -0xd0(%rbp),%rdi
+  802508:	48 b8 e1 11 80 00 00 	movabs $0x8011e1,%rax
+  80250f:	00 00 00 
+  802512:	ff d0                	call   *%rax
+  802514:	e9 7c ff ff ff       	jmp    802495 <pipe+0x17e>
+
+0000000000802519 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  802519:	55                   	push   %rbp
+  80251a:	48 89 e5             	mov    %rsp,%rbp
+  80251d:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  802521:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802525:	48 b8 aa 15 80 00 00 	movabs $0x8015aa,%rax
+  80252c:	00 00 00 
+  80252f:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802531:	85 c0                	test   %eax,%eax
+  802533:	78 35                	js     80256a <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  802535:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802539:	48 b8 fb 14 80 00 00 	movabs $0x8014fb,%rax
+  802540:	00 00 00 
+  802543:	ff d0                	call   *%rax
+  802545:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802548:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80254d:	be 00 10 00 00       	mov    $0x1000,%esi
+  802552:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802556:	48 b8 82 10 80 00 00 	movabs $0x801082,%rax
+  80255d:	00 00 00 
+  802560:	ff d0                	call   *%rax
+  802562:	85 c0                	test   %eax,%eax
+  802564:	0f 94 c0             	sete   %al
+  802567:	0f b6 c0             	movzbl %al,%eax
+}
+  80256a:	c9                   	leave
+  80256b:	c3                   	ret
+
+000000000080256c <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  80256c:	48 89 f8             	mov    %rdi,%rax
+  80256f:	48 c1 e8 27          	shr    $0x27,%rax
+  802573:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  80257a:	01 00 00 
+  80257d:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802581:	f6 c2 01             	test   $0x1,%dl
+  802584:	74 6d                	je     8025f3 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  802586:	48 89 f8             	mov    %rdi,%rax
+  802589:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80258d:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802594:	01 00 00 
+  802597:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80259b:	f6 c2 01             	test   $0x1,%dl
+  80259e:	74 62                	je     802602 <get_uvpt_entry+0x96>
+  8025a0:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8025a7:	01 00 00 
+  8025aa:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8025ae:	f6 c2 80             	test   $0x80,%dl
+  8025b1:	75 4f                	jne    802602 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8025b3:	48 89 f8             	mov    %rdi,%rax
+  8025b6:	48 c1 e8 15          	shr    $0x15,%rax
+  8025ba:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8025c1:	01 00 00 
+  8025c4:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8025c8:	f6 c2 01             	test   $0x1,%dl
+  8025cb:	74 44                	je     802611 <get_uvpt_entry+0xa5>
+  8025cd:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8025d4:	01 00 00 
+  8025d7:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8025db:	f6 c2 80             	test   $0x80,%dl
+  8025de:	75 31                	jne    802611 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  8025e0:	48 c1 ef 0c          	shr    $0xc,%rdi
+  8025e4:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8025eb:	01 00 00 
+  8025ee:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  8025f2:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8025f3:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  8025fa:	01 00 00 
+  8025fd:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802601:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  802602:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802609:	01 00 00 
+  80260c:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802610:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  802611:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802618:	01 00 00 
+  80261b:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80261f:	c3                   	ret
+
+0000000000802620 <get_prot>:
+
+int
+get_prot(void *va) {
+  802620:	55                   	push   %rbp
+  802621:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  802624:	48 b8 6c 25 80 00 00 	movabs $0x80256c,%rax
+  80262b:	00 00 00 
+  80262e:	ff d0                	call   *%rax
+  802630:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  802633:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  802638:	89 c1                	mov    %eax,%ecx
+  80263a:	83 c9 04             	or     $0x4,%ecx
+  80263d:	f6 c2 01             	test   $0x1,%dl
+  802640:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  802643:	89 c1                	mov    %eax,%ecx
+  802645:	83 c9 02             	or     $0x2,%ecx
+  802648:	f6 c2 02             	test   $0x2,%dl
+  80264b:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  80264e:	89 c1                	mov    %eax,%ecx
+  802650:	83 c9 01             	or     $0x1,%ecx
+  802653:	48 85 d2             	test   %rdx,%rdx
+  802656:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  802659:	89 c1                	mov    %eax,%ecx
+  80265b:	83 c9 40             	or     $0x40,%ecx
+  80265e:	f6 c6 04             	test   $0x4,%dh
+  802661:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  802664:	5d                   	pop    %rbp
+  802665:	c3                   	ret
+
+0000000000802666 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  802666:	55                   	push   %rbp
+  802667:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  80266a:	48 b8 6c 25 80 00 00 	movabs $0x80256c,%rax
+  802671:	00 00 00 
+  802674:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  802676:	48 c1 e8 06          	shr    $0x6,%rax
+  80267a:	83 e0 01             	and    $0x1,%eax
+}
+  80267d:	5d                   	pop    %rbp
+  80267e:	c3                   	ret
+
+000000000080267f <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  80267f:	55                   	push   %rbp
+  802680:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  802683:	48 b8 6c 25 80 00 00 	movabs $0x80256c,%rax
+  80268a:	00 00 00 
+  80268d:	ff d0                	call   *%rax
+  80268f:	83 e0 01             	and    $0x1,%eax
+}
+  802692:	5d                   	pop    %rbp
+  802693:	c3                   	ret
+
+0000000000802694 <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  802694:	55                   	push   %rbp
+  802695:	48 89 e5             	mov    %rsp,%rbp
+  802698:	41 57                	push   %r15
+  80269a:	41 56                	push   %r14
+  80269c:	41 55                	push   %r13
+  80269e:	41 54                	push   %r12
+  8026a0:	53                   	push   %rbx
+  8026a1:	48 83 ec 38          	sub    $0x38,%rsp
+  8026a5:	49 89 f7             	mov    %rsi,%r15
+  8026a8:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+                    }
+                    continue;
+                }
+                for (int ptei = 0; ptei < PT_ENTRY_COUNT; ptei++) {
+                    uintptr_t pte_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, pdei, ptei, 0);
+                    pte_t pte = uvpt[VPT(pte_addr)];
+  8026ae:	49 bd 00 00 00 00 00 	movabs $0x10000000000,%r13
+  8026b5:	01 00 00 
+  8026b8:	4d 89 e6             	mov    %r12,%r14
+  8026bb:	49 89 fc             	mov    %rdi,%r12
+  8026be:	e9 19 01 00 00       	jmp    8027dc <foreach_shared_region+0x148>
+  8026c3:	48 89 5d b0          	mov    %rbx,-0x50(%rbp)
+  8026c7:	4c 89 75 a8          	mov    %r14,-0x58(%rbp)
+  8026cb:	eb 52                	jmp    80271f <foreach_shared_region+0x8b>
+                for (int ptei = 0; ptei < PT_ENTRY_COUNT; ptei++) {
+  8026cd:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8026d4:	48 81 fb 00 00 20 00 	cmp    $0x200000,%rbx
+  8026db:	74 2e                	je     80270b <foreach_shared_region+0x77>
+                    uintptr_t pte_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, pdei, ptei, 0);
+  8026dd:	48 89 df             	mov    %rbx,%rdi
+  8026e0:	4c 09 f7             	or     %r14,%rdi
+                    pte_t pte = uvpt[VPT(pte_addr)];
+  8026e3:	48 89 f8             	mov    %rdi,%rax
+  8026e6:	48 c1 e8 0c          	shr    $0xc,%rax
+  8026ea:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+                    if ((pte & PTE_P) && (pte & PTE_SHARE)) {
+  8026ef:	25 01 04 00 00       	and    $0x401,%eax
+  8026f4:	48 3d 01 04 00 00    	cmp    $0x401,%rax
+  8026fa:	75 d1                	jne    8026cd <foreach_shared_region+0x39>
+                        fun((void*)pte_addr, (void*)(pte_addr + PAGE_SIZE), arg);
+  8026fc:	48 8d b7 00 10 00 00 	lea    0x1000(%rdi),%rsi
+  802703:	4c 89 fa             	mov    %r15,%rdx
+  802706:	41 ff d4             	call   *%r12
+  802709:	eb c2                	jmp    8026cd <foreach_shared_region+0x39>
+            for (int pdei = 0; pdei < PD_ENTRY_COUNT; pdei++) {
+  80270b:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  802712:	00 
+  802713:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802717:	48 3d 00 00 00 40    	cmp    $0x40000000,%rax
+  80271d:	74 46                	je     802765 <foreach_shared_region+0xd1>
+                uintptr_t pde_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, pdei, 0, 0);
+  80271f:	4c 8b 75 c8          	mov    -0x38(%rbp),%r14
+  802723:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802727:	49 09 c6             	or     %rax,%r14
+                pde_t pde = uvpd[VPD(pde_addr)];
+  80272a:	4c 89 f0             	mov    %r14,%rax
+  80272d:	48 c1 e8 15          	shr    $0x15,%rax
+  802731:	48 b9 00 00 00 80 00 	movabs $0x10080000000,%rcx
+  802738:	01 00 00 
+  80273b:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+                if (!(pde & PTE_P)) {
+  80273f:	a8 01                	test   $0x1,%al
+  802741:	74 c8                	je     80270b <foreach_shared_region+0x77>
+                if (pde & PTE_PS) {
+  802743:	48 89 c3             	mov    %rax,%rbx
+  802746:	81 e3 80 00 00 00    	and    $0x80,%ebx
+  80274c:	74 8f                	je     8026dd <foreach_shared_region+0x49>
+                    if (pde & PTE_SHARE) {
+  80274e:	f6 c4 04             	test   $0x4,%ah
+  802751:	74 b8                	je     80270b <foreach_shared_region+0x77>
+                        fun((void*)pde_addr, (void*)(pde_addr + 1024 * 1024 * 2), arg);
+  802753:	49 8d b6 00 00 20 00 	lea    0x200000(%r14),%rsi
+  80275a:	4c 89 fa             	mov    %r15,%rdx
+  80275d:	4c 89 f7             	mov    %r14,%rdi
+  802760:	41 ff d4             	call   *%r12
+  802763:	eb a6                	jmp    80270b <foreach_shared_region+0x77>
+  802765:	48 8b 5d b0          	mov    -0x50(%rbp),%rbx
+  802769:	4c 8b 75 a8          	mov    -0x58(%rbp),%r14
+        for (int pdpei = 0; pdpei < PDP_ENTRY_COUNT; pdpei++) {
+  80276d:	48 81 c3 00 00 00 40 	add    $0x40000000,%rbx
+  802774:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80277b:	00 00 00 
+  80277e:	48 39 c3             	cmp    %rax,%rbx
+  802781:	74 4c                	je     8027cf <foreach_shared_region+0x13b>
+            uintptr_t pdpe_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, 0, 0, 0);
+  802783:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802787:	48 09 d8             	or     %rbx,%rax
+  80278a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+            pdpe_t pdpe = uvpdp[VPDP(pdpe_addr)];
+  80278e:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802792:	48 b9 00 00 40 80 00 	movabs $0x10080400000,%rcx
+  802799:	01 00 00 
+  80279c:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+            if (!(pdpe & PTE_P)) {
+  8027a0:	a8 01                	test   $0x1,%al
+  8027a2:	74 c9                	je     80276d <foreach_shared_region+0xd9>
+            if (pdpe & PTE_PS) {
+  8027a4:	48 89 c1             	mov    %rax,%rcx
+  8027a7:	81 e1 80 00 00 00    	and    $0x80,%ecx
+  8027ad:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  8027b1:	0f 84 0c ff ff ff    	je     8026c3 <foreach_shared_region+0x2f>
+                if (pdpe & PTE_SHARE) {
+  8027b7:	f6 c4 04             	test   $0x4,%ah
+  8027ba:	74 b1                	je     80276d <foreach_shared_region+0xd9>
+                    fun((void*)pdpe_addr, (void*)(pdpe_addr + 1024 * 1024 * 1024), arg); 
+  8027bc:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  8027c0:	48 8d b7 00 00 00 40 	lea    0x40000000(%rdi),%rsi
+  8027c7:	4c 89 fa             	mov    %r15,%rdx
+  8027ca:	41 ff d4             	call   *%r12
+  8027cd:	eb 9e                	jmp    80276d <foreach_shared_region+0xd9>
+    for (int pml4ei = 0; pml4ei < PML4_ENTRY_COUNT; pml4ei++) {
+  8027cf:	49 83 c6 01          	add    $0x1,%r14
+  8027d3:	49 81 fe 00 02 00 00 	cmp    $0x200,%r14
+  8027da:	74 24                	je     802800 <foreach_shared_region+0x16c>
+        pml4e_t pml4e = uvpml4[VPML4(pml4_addr)];
+  8027dc:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  8027e3:	01 00 00 
+  8027e6:	4a 8b 04 f0          	mov    (%rax,%r14,8),%rax
+        if (!(pml4e & PTE_P)) {
+  8027ea:	a8 01                	test   $0x1,%al
+  8027ec:	74 e1                	je     8027cf <foreach_shared_region+0x13b>
+  8027ee:	4c 89 f0             	mov    %r14,%rax
+  8027f1:	48 c1 e0 27          	shl    $0x27,%rax
+  8027f5:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8027f9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8027fe:	eb 83                	jmp    802783 <foreach_shared_region+0xef>
+            }
+        }
+    }
+    
+    return 0;
+}
+  802800:	b8 00 00 00 00       	mov    $0x0,%eax
+  802805:	48 83 c4 38          	add    $0x38,%rsp
+  802809:	5b                   	pop    %rbx
+  80280a:	41 5c                	pop    %r12
+  80280c:	41 5d                	pop    %r13
+  80280e:	41 5e                	pop    %r14
+  802810:	41 5f                	pop    %r15
+  802812:	5d                   	pop    %rbp
+  802813:	c3                   	ret
+
+0000000000802814 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  802814:	b8 00 00 00 00       	mov    $0x0,%eax
+  802819:	c3                   	ret
+
+000000000080281a <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  80281a:	55                   	push   %rbp
+  80281b:	48 89 e5             	mov    %rsp,%rbp
+  80281e:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  802821:	48 be 54 33 80 00 00 	movabs $0x803354,%rsi
+  802828:	00 00 00 
+  80282b:	48 b8 fe 0a 80 00 00 	movabs $0x800afe,%rax
+  802832:	00 00 00 
+  802835:	ff d0                	call   *%rax
+    return 0;
+}
+  802837:	b8 00 00 00 00       	mov    $0x0,%eax
+  80283c:	5d                   	pop    %rbp
+  80283d:	c3                   	ret
+
+000000000080283e <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  80283e:	55                   	push   %rbp
+  80283f:	48 89 e5             	mov    %rsp,%rbp
+  802842:	41 57                	push   %r15
+  802844:	41 56                	push   %r14
+  802846:	41 55                	push   %r13
+  802848:	41 54                	push   %r12
+  80284a:	53                   	push   %rbx
+  80284b:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  802852:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  802859:	48 85 d2             	test   %rdx,%rdx
+  80285c:	74 7a                	je     8028d8 <devcons_write+0x9a>
+  80285e:	49 89 d6             	mov    %rdx,%r14
+  802861:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802867:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  80286c:	49 bf f8 0c 80 00 00 	movabs $0x800cf8,%r15
+  802873:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  802876:	4c 89 f3             	mov    %r14,%rbx
+  802879:	48 29 f3             	sub    %rsi,%rbx
+  80287c:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802881:	48 39 c3             	cmp    %rax,%rbx
+  802884:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  802888:	4c 63 eb             	movslq %ebx,%r13
+  80288b:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  802892:	48 01 c6             	add    %rax,%rsi
+  802895:	4c 89 ea             	mov    %r13,%rdx
+  802898:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  80289f:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  8028a2:	4c 89 ee             	mov    %r13,%rsi
+  8028a5:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  8028ac:	48 b8 25 0f 80 00 00 	movabs $0x800f25,%rax
+  8028b3:	00 00 00 
+  8028b6:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  8028b8:	41 01 dc             	add    %ebx,%r12d
+  8028bb:	49 63 f4             	movslq %r12d,%rsi
+  8028be:	4c 39 f6             	cmp    %r14,%rsi
+  8028c1:	72 b3                	jb     802876 <devcons_write+0x38>
+    return res;
+  8028c3:	49 63 c4             	movslq %r12d,%rax
+}
+  8028c6:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  8028cd:	5b                   	pop    %rbx
+  8028ce:	41 5c                	pop    %r12
+  8028d0:	41 5d                	pop    %r13
+  8028d2:	41 5e                	pop    %r14
+  8028d4:	41 5f                	pop    %r15
+  8028d6:	5d                   	pop    %rbp
+  8028d7:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  8028d8:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8028de:	eb e3                	jmp    8028c3 <devcons_write+0x85>
+
+00000000008028e0 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8028e0:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  8028e3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8028e8:	48 85 c0             	test   %rax,%rax
+  8028eb:	74 55                	je     802942 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8028ed:	55                   	push   %rbp
+  8028ee:	48 89 e5             	mov    %rsp,%rbp
+  8028f1:	41 55                	push   %r13
+  8028f3:	41 54                	push   %r12
+  8028f5:	53                   	push   %rbx
+  8028f6:	48 83 ec 08          	sub    $0x8,%rsp
+  8028fa:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  8028fd:	48 bb 52 0f 80 00 00 	movabs $0x800f52,%rbx
+  802904:	00 00 00 
+  802907:	49 bc 1f 10 80 00 00 	movabs $0x80101f,%r12
+  80290e:	00 00 00 
+  802911:	eb 03                	jmp    802916 <devcons_read+0x36>
+  802913:	41 ff d4             	call   *%r12
+  802916:	ff d3                	call   *%rbx
+  802918:	85 c0                	test   %eax,%eax
+  80291a:	74 f7                	je     802913 <devcons_read+0x33>
+    if (c < 0) return c;
+  80291c:	48 63 d0             	movslq %eax,%rdx
+  80291f:	78 13                	js     802934 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  802921:	ba 00 00 00 00       	mov    $0x0,%edx
+  802926:	83 f8 04             	cmp    $0x4,%eax
+  802929:	74 09                	je     802934 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  80292b:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  80292f:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  802934:	48 89 d0             	mov    %rdx,%rax
+  802937:	48 83 c4 08          	add    $0x8,%rsp
+  80293b:	5b                   	pop    %rbx
+  80293c:	41 5c                	pop    %r12
+  80293e:	41 5d                	pop    %r13
+  802940:	5d                   	pop    %rbp
+  802941:	c3                   	ret
+  802942:	48 89 d0             	mov    %rdx,%rax
+  802945:	c3                   	ret
+
+0000000000802946 <cputchar>:
+cputchar(int ch) {
+  802946:	55                   	push   %rbp
+  802947:	48 89 e5             	mov    %rsp,%rbp
+  80294a:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  80294e:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  802952:	be 01 00 00 00       	mov    $0x1,%esi
+  802957:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  80295b:	48 b8 25 0f 80 00 00 	movabs $0x800f25,%rax
+  802962:	00 00 00 
+  802965:	ff d0                	call   *%rax
+}
+  802967:	c9                   	leave
+  802968:	c3                   	ret
+
+0000000000802969 <getchar>:
+getchar(void) {
+  802969:	55                   	push   %rbp
+  80296a:	48 89 e5             	mov    %rsp,%rbp
+  80296d:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  802971:	ba 01 00 00 00       	mov    $0x1,%edx
+  802976:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  80297a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80297f:	48 b8 8d 18 80 00 00 	movabs $0x80188d,%rax
+  802986:	00 00 00 
+  802989:	ff d0                	call   *%rax
+  80298b:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  80298d:	85 c0                	test   %eax,%eax
+  80298f:	78 06                	js     802997 <getchar+0x2e>
+  802991:	74 08                	je     80299b <getchar+0x32>
+  802993:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  802997:	89 d0                	mov    %edx,%eax
+  802999:	c9                   	leave
+  80299a:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  80299b:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  8029a0:	eb f5                	jmp    802997 <getchar+0x2e>
+
+00000000008029a2 <iscons>:
+iscons(int fdnum) {
+  8029a2:	55                   	push   %rbp
+  8029a3:	48 89 e5             	mov    %rsp,%rbp
+  8029a6:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8029aa:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8029ae:	48 b8 aa 15 80 00 00 	movabs $0x8015aa,%rax
+  8029b5:	00 00 00 
+  8029b8:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8029ba:	85 c0                	test   %eax,%eax
+  8029bc:	78 18                	js     8029d6 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  8029be:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8029c2:	48 b8 a0 40 80 00 00 	movabs $0x8040a0,%rax
+  8029c9:	00 00 00 
+  8029cc:	8b 00                	mov    (%rax),%eax
+  8029ce:	39 02                	cmp    %eax,(%rdx)
+  8029d0:	0f 94 c0             	sete   %al
+  8029d3:	0f b6 c0             	movzbl %al,%eax
+}
+  8029d6:	c9                   	leave
+  8029d7:	c3                   	ret
+
+00000000008029d8 <opencons>:
+opencons(void) {
+  8029d8:	55                   	push   %rbp
+  8029d9:	48 89 e5             	mov    %rsp,%rbp
+  8029dc:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8029e0:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  8029e4:	48 b8 90 15 80 00 00 	movabs $0x801590,%rax
+  8029eb:	00 00 00 
+  8029ee:	ff d0                	call   *%rax
+  8029f0:	85 c0                	test   %eax,%eax
+  8029f2:	78 49                	js     802a3d <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  8029f4:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8029f9:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8029fe:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  802a02:	bf 00 00 00 00       	mov    $0x0,%edi
+  802a07:	48 b8 ae 10 80 00 00 	movabs $0x8010ae,%rax
+  802a0e:	00 00 00 
+  802a11:	ff d0                	call   *%rax
+  802a13:	85 c0                	test   %eax,%eax
+  802a15:	78 26                	js     802a3d <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  802a17:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802a1b:	a1 a0 40 80 00 00 00 	movabs 0x8040a0,%eax
+  802a22:	00 00 
+  802a24:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  802a26:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802a2a:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  802a31:	48 b8 e9 14 80 00 00 	movabs $0x8014e9,%rax
+  802a38:	00 00 00 
+  802a3b:	ff d0                	call   *%rax
+}
+  802a3d:	c9                   	leave
+  802a3e:	c3                   	ret
+
+0000000000802a3f <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  802a3f:	55                   	push   %rbp
+  802a40:	48 89 e5             	mov    %rsp,%rbp
+  802a43:	41 56                	push   %r14
+  802a45:	41 55                	push   %r13
+  802a47:	41 54                	push   %r12
+  802a49:	53                   	push   %rbx
+  802a4a:	48 83 ec 50          	sub    $0x50,%rsp
+  802a4e:	49 89 fc             	mov    %rdi,%r12
+  802a51:	41 89 f5             	mov    %esi,%r13d
+  802a54:	48 89 d3             	mov    %rdx,%rbx
+  802a57:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  802a5b:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  802a5f:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  802a63:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  802a6a:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802a6e:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  802a72:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  802a76:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  802a7a:	48 b8 00 40 80 00 00 	movabs $0x804000,%rax
+  802a81:	00 00 00 
+  802a84:	4c 8b 30             	mov    (%rax),%r14
+  802a87:	48 b8 ee 0f 80 00 00 	movabs $0x800fee,%rax
+  802a8e:	00 00 00 
+  802a91:	ff d0                	call   *%rax
+  802a93:	89 c6                	mov    %eax,%esi
+  802a95:	45 89 e8             	mov    %r13d,%r8d
+  802a98:	4c 89 e1             	mov    %r12,%rcx
+  802a9b:	4c 89 f2             	mov    %r14,%rdx
+  802a9e:	48 bf 60 33 80 00 00 	movabs $0x803360,%rdi
+  802aa5:	00 00 00 
+  802aa8:	b8 00 00 00 00       	mov    $0x0,%eax
+  802aad:	49 bc d9 01 80 00 00 	movabs $0x8001d9,%r12
+  802ab4:	00 00 00 
+  802ab7:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  802aba:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  802abe:	48 89 df             	mov    %rbx,%rdi
+  802ac1:	48 b8 75 01 80 00 00 	movabs $0x800175,%rax
+  802ac8:	00 00 00 
+  802acb:	ff d0                	call   *%rax
+    cprintf("\n");
+  802acd:	48 bf bf 2c 80 00 00 	movabs $0x802cbf,%rdi
+  802ad4:	00 00 00 
+  802ad7:	b8 00 00 00 00       	mov    $0x0,%eax
+  802adc:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  802adf:	cc                   	int3
+  802ae0:	eb fd                	jmp    802adf <_panic+0xa0>
+
+0000000000802ae2 <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  802ae2:	55                   	push   %rbp
+  802ae3:	48 89 e5             	mov    %rsp,%rbp
+  802ae6:	41 55                	push   %r13
+  802ae8:	41 54                	push   %r12
+  802aea:	53                   	push   %rbx
+  802aeb:	48 83 ec 08          	sub    $0x8,%rsp
+  802aef:	49 89 fc             	mov    %rdi,%r12
+  802af2:	48 89 f7             	mov    %rsi,%rdi
+  802af5:	48 89 d3             	mov    %rdx,%rbx
+  802af8:	49 89 cd             	mov    %rcx,%r13
+    // LAB 9: Your code here:
+    int res = sys_ipc_recv(!pg ? (void*)MAX_USER_ADDRESS : pg, !size ? 0 : *size);
+  802afb:	be 00 00 00 00       	mov    $0x0,%esi
+  802b00:	48 85 d2             	test   %rdx,%rdx
+  802b03:	74 03                	je     802b08 <ipc_recv+0x26>
+  802b05:	48 8b 32             	mov    (%rdx),%rsi
+  802b08:	48 85 ff             	test   %rdi,%rdi
+  802b0b:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802b12:	00 00 00 
+  802b15:	48 0f 44 f8          	cmove  %rax,%rdi
+  802b19:	48 b8 80 14 80 00 00 	movabs $0x801480,%rax
+  802b20:	00 00 00 
+  802b23:	ff d0                	call   *%rax
+    if (res < 0) {
+  802b25:	85 c0                	test   %eax,%eax
+  802b27:	78 66                	js     802b8f <ipc_recv+0xad>
+        if (size) {
+            *size = 0;
+        }
+        return res;
+    }
+    if (from_env_store) {
+  802b29:	4d 85 e4             	test   %r12,%r12
+  802b2c:	74 14                	je     802b42 <ipc_recv+0x60>
+        *from_env_store = thisenv->env_ipc_from;
+  802b2e:	48 a1 08 50 80 00 00 	movabs 0x805008,%rax
+  802b35:	00 00 00 
+  802b38:	8b 80 ac 01 00 00    	mov    0x1ac(%rax),%eax
+  802b3e:	41 89 04 24          	mov    %eax,(%r12)
+    }
+    if (perm_store) {
+  802b42:	4d 85 ed             	test   %r13,%r13
+  802b45:	74 14                	je     802b5b <ipc_recv+0x79>
+        *perm_store = thisenv->env_ipc_perm;
+  802b47:	48 a1 08 50 80 00 00 	movabs 0x805008,%rax
+  802b4e:	00 00 00 
+  802b51:	8b 80 b0 01 00 00    	mov    0x1b0(%rax),%eax
+  802b57:	41 89 45 00          	mov    %eax,0x0(%r13)
+    }
+    if (size) {
+  802b5b:	48 85 db             	test   %rbx,%rbx
+  802b5e:	74 14                	je     802b74 <ipc_recv+0x92>
+        *size = thisenv->env_ipc_maxsz;
+  802b60:	48 a1 08 50 80 00 00 	movabs 0x805008,%rax
+  802b67:	00 00 00 
+  802b6a:	48 8b 80 a0 01 00 00 	mov    0x1a0(%rax),%rax
+  802b71:	48 89 03             	mov    %rax,(%rbx)
+    }
+    return thisenv->env_ipc_value;
+  802b74:	48 a1 08 50 80 00 00 	movabs 0x805008,%rax
+  802b7b:	00 00 00 
+  802b7e:	8b 80 a8 01 00 00    	mov    0x1a8(%rax),%eax
+}
+  802b84:	48 83 c4 08          	add    $0x8,%rsp
+  802b88:	5b                   	pop    %rbx
+  802b89:	41 5c                	pop    %r12
+  802b8b:	41 5d                	pop    %r13
+  802b8d:	5d                   	pop    %rbp
+  802b8e:	c3                   	ret
+        if (from_env_store) {
+  802b8f:	4d 85 e4             	test   %r12,%r12
+  802b92:	74 08                	je     802b9c <ipc_recv+0xba>
+            *from_env_store = 0;
+  802b94:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  802b9b:	00 
+        if (perm_store) {
+  802b9c:	4d 85 ed             	test   %r13,%r13
+  802b9f:	74 08                	je     802ba9 <ipc_recv+0xc7>
+            *perm_store = 0;
+  802ba1:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  802ba8:	00 
+        if (size) {
+  802ba9:	48 85 db             	test   %rbx,%rbx
+  802bac:	74 d6                	je     802b84 <ipc_recv+0xa2>
+            *size = 0;
+  802bae:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  802bb5:	eb cd                	jmp    802b84 <ipc_recv+0xa2>
+
+0000000000802bb7 <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  802bb7:	55                   	push   %rbp
+  802bb8:	48 89 e5             	mov    %rsp,%rbp
+  802bbb:	41 57                	push   %r15
+  802bbd:	41 56                	push   %r14
+  802bbf:	41 55                	push   %r13
+  802bc1:	41 54                	push   %r12
+  802bc3:	53                   	push   %rbx
+  802bc4:	48 83 ec 18          	sub    $0x18,%rsp
+  802bc8:	41 89 fd             	mov    %edi,%r13d
+  802bcb:	89 75 cc             	mov    %esi,-0x34(%rbp)
+  802bce:	49 89 cc             	mov    %rcx,%r12
+  802bd1:	44 89 45 c8          	mov    %r8d,-0x38(%rbp)
+    // LAB 9: Your code here:
+    int res = 0;
+    while ((res = sys_ipc_try_send(to_env, val, !pg ? (void*)MAX_USER_ADDRESS : pg, size, perm)) < 0) {
+  802bd5:	48 85 d2             	test   %rdx,%rdx
+  802bd8:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802bdf:	00 00 00 
+  802be2:	48 0f 45 c2          	cmovne %rdx,%rax
+  802be6:	48 89 c3             	mov    %rax,%rbx
+  802be9:	49 be 54 14 80 00 00 	movabs $0x801454,%r14
+  802bf0:	00 00 00 
+        if (res != -E_IPC_NOT_RECV) {
+            panic("sys_ipc_try_send failed: %i", res);
+        }
+        sys_yield();
+  802bf3:	49 bf 1f 10 80 00 00 	movabs $0x80101f,%r15
+  802bfa:	00 00 00 
+    while ((res = sys_ipc_try_send(to_env, val, !pg ? (void*)MAX_USER_ADDRESS : pg, size, perm)) < 0) {
+  802bfd:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  802c00:	44 8b 45 c8          	mov    -0x38(%rbp),%r8d
+  802c04:	4c 89 e1             	mov    %r12,%rcx
+  802c07:	48 89 da             	mov    %rbx,%rdx
+  802c0a:	44 89 ef             	mov    %r13d,%edi
+  802c0d:	41 ff d6             	call   *%r14
+  802c10:	85 c0                	test   %eax,%eax
+  802c12:	79 37                	jns    802c4b <ipc_send+0x94>
+        if (res != -E_IPC_NOT_RECV) {
+  802c14:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  802c17:	75 05                	jne    802c1e <ipc_send+0x67>
+        sys_yield();
+  802c19:	41 ff d7             	call   *%r15
+  802c1c:	eb df                	jmp    802bfd <ipc_send+0x46>
+            panic("sys_ipc_try_send failed: %i", res);
+  802c1e:	89 c1                	mov    %eax,%ecx
+  802c20:	48 ba 83 33 80 00 00 	movabs $0x803383,%rdx
+  802c27:	00 00 00 
+  802c2a:	be 40 00 00 00       	mov    $0x40,%esi
+  802c2f:	48 bf 9f 33 80 00 00 	movabs $0x80339f,%rdi
+  802c36:	00 00 00 
+  802c39:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c3e:	49 b8 3f 2a 80 00 00 	movabs $0x802a3f,%r8
+  802c45:	00 00 00 
+  802c48:	41 ff d0             	call   *%r8
+    }
+    return;
+}
+  802c4b:	48 83 c4 18          	add    $0x18,%rsp
+  802c4f:	5b                   	pop    %rbx
+  802c50:	41 5c                	pop    %r12
+  802c52:	41 5d                	pop    %r13
+  802c54:	41 5e                	pop    %r14
+  802c56:	41 5f                	pop    %r15
+  802c58:	5d                   	pop    %rbp
+  802c59:	c3                   	ret
+
+0000000000802c5a <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  802c5a:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  802c5f:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  802c66:	00 00 00 
+  802c69:	48 69 d0 d0 01 00 00 	imul   $0x1d0,%rax,%rdx
+  802c70:	48 01 ca             	add    %rcx,%rdx
+  802c73:	8b 92 e8 00 00 00    	mov    0xe8(%rdx),%edx
+  802c79:	39 fa                	cmp    %edi,%edx
+  802c7b:	74 12                	je     802c8f <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  802c7d:	48 83 c0 01          	add    $0x1,%rax
+  802c81:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  802c87:	75 e0                	jne    802c69 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  802c89:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802c8e:	c3                   	ret
+            return envs[i].env_id;
+  802c8f:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+  802c96:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  802c9d:	00 00 00 
+  802ca0:	48 01 d0             	add    %rdx,%rax
+  802ca3:	8b 80 e0 00 00 00    	mov    0xe0(%rax),%eax
+  802ca9:	c3                   	ret
+  802caa:	66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+
+0000000000802cb0 <__rodata_start>:
+  802cb0:	31 33                	xor    %esi,(%rbx)
+  802cb2:	33 37                	xor    (%rdi),%esi
+  802cb4:	2f                   	(bad)
+  802cb5:	30 20                	xor    %ah,(%rax)
+  802cb7:	69 73 20 25 30 38 78 	imul   $0x78383025,0x20(%rbx),%esi
+  802cbe:	21 0a                	and    %ecx,(%rdx)
+  802cc0:	00 3c 75 6e 6b 6e 6f 	add    %bh,0x6f6e6b6e(,%rsi,2)
+  802cc7:	77 6e                	ja     802d37 <__rodata_start+0x87>
+  802cc9:	3e 00 30             	ds add %dh,(%rax)
+  802ccc:	31 32                	xor    %esi,(%rdx)
+  802cce:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  802cd5:	41                   	rex.B
+  802cd6:	42                   	rex.X
+  802cd7:	43                   	rex.XB
+  802cd8:	44                   	rex.R
+  802cd9:	45                   	rex.RB
+  802cda:	46 00 30             	rex.RX add %r14b,(%rax)
+  802cdd:	31 32                	xor    %esi,(%rdx)
+  802cdf:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  802ce6:	61                   	(bad)
+  802ce7:	62 63 64 65 66       	(bad)
+  802cec:	00 28                	add    %ch,(%rax)
+  802cee:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802cef:	75 6c                	jne    802d5d <__rodata_start+0xad>
+  802cf1:	6c                   	insb   (%dx),%es:(%rdi)
+  802cf2:	29 00                	sub    %eax,(%rax)
+  802cf4:	65 72 72             	gs jb  802d69 <__rodata_start+0xb9>
+  802cf7:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802cf8:	72 20                	jb     802d1a <__rodata_start+0x6a>
+  802cfa:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  802cff:	73 70                	jae    802d71 <__rodata_start+0xc1>
+  802d01:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  802d05:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  802d0c:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802d0d:	72 00                	jb     802d0f <__rodata_start+0x5f>
+  802d0f:	62 61 64 20 65       	(bad)
+  802d14:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802d15:	76 69                	jbe    802d80 <__rodata_start+0xd0>
+  802d17:	72 6f                	jb     802d88 <__rodata_start+0xd8>
+  802d19:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802d1a:	6d                   	insl   (%dx),%es:(%rdi)
+  802d1b:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  802d1d:	74 00                	je     802d1f <__rodata_start+0x6f>
+  802d1f:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  802d26:	20 70 61             	and    %dh,0x61(%rax)
+  802d29:	72 61                	jb     802d8c <__rodata_start+0xdc>
+  802d2b:	6d                   	insl   (%dx),%es:(%rdi)
+  802d2c:	65 74 65             	gs je  802d94 <__rodata_start+0xe4>
+  802d2f:	72 00                	jb     802d31 <__rodata_start+0x81>
+  802d31:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802d32:	75 74                	jne    802da8 <__rodata_start+0xf8>
+  802d34:	20 6f 66             	and    %ch,0x66(%rdi)
+  802d37:	20 6d 65             	and    %ch,0x65(%rbp)
+  802d3a:	6d                   	insl   (%dx),%es:(%rdi)
+  802d3b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802d3c:	72 79                	jb     802db7 <__rodata_start+0x107>
+  802d3e:	00 6f 75             	add    %ch,0x75(%rdi)
+  802d41:	74 20                	je     802d63 <__rodata_start+0xb3>
+  802d43:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802d44:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  802d48:	76 69                	jbe    802db3 <__rodata_start+0x103>
+  802d4a:	72 6f                	jb     802dbb <__rodata_start+0x10b>
+  802d4c:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802d4d:	6d                   	insl   (%dx),%es:(%rdi)
+  802d4e:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  802d50:	74 73                	je     802dc5 <__rodata_start+0x115>
+  802d52:	00 63 6f             	add    %ah,0x6f(%rbx)
+  802d55:	72 72                	jb     802dc9 <__rodata_start+0x119>
+  802d57:	75 70                	jne    802dc9 <__rodata_start+0x119>
+  802d59:	74 65                	je     802dc0 <__rodata_start+0x110>
+  802d5b:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  802d60:	75 67                	jne    802dc9 <__rodata_start+0x119>
+  802d62:	20 69 6e             	and    %ch,0x6e(%rcx)
+  802d65:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  802d67:	00 73 65             	add    %dh,0x65(%rbx)
+  802d6a:	67 6d                	insl   (%dx),%es:(%edi)
+  802d6c:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  802d6e:	74 61                	je     802dd1 <__rodata_start+0x121>
+  802d70:	74 69                	je     802ddb <__rodata_start+0x12b>
+  802d72:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802d73:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802d74:	20 66 61             	and    %ah,0x61(%rsi)
+  802d77:	75 6c                	jne    802de5 <__rodata_start+0x135>
+  802d79:	74 00                	je     802d7b <__rodata_start+0xcb>
+  802d7b:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  802d82:	20 45 4c             	and    %al,0x4c(%rbp)
+  802d85:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  802d89:	61                   	(bad)
+  802d8a:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  802d8f:	20 73 75             	and    %dh,0x75(%rbx)
+  802d92:	63 68 20             	movsxd 0x20(%rax),%ebp
+  802d95:	73 79                	jae    802e10 <__rodata_start+0x160>
+  802d97:	73 74                	jae    802e0d <__rodata_start+0x15d>
+  802d99:	65 6d                	gs insl (%dx),%es:(%rdi)
+  802d9b:	20 63 61             	and    %ah,0x61(%rbx)
+  802d9e:	6c                   	insb   (%dx),%es:(%rdi)
+  802d9f:	6c                   	insb   (%dx),%es:(%rdi)
+  802da0:	00 65 6e             	add    %ah,0x6e(%rbp)
+  802da3:	74 72                	je     802e17 <__rodata_start+0x167>
+  802da5:	79 20                	jns    802dc7 <__rodata_start+0x117>
+  802da7:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802da8:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802da9:	74 20                	je     802dcb <__rodata_start+0x11b>
+  802dab:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  802dad:	75 6e                	jne    802e1d <__rodata_start+0x16d>
+  802daf:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  802db3:	76 20                	jbe    802dd5 <__rodata_start+0x125>
+  802db5:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  802dbc:	72 65                	jb     802e23 <__rodata_start+0x173>
+  802dbe:	63 76 69             	movsxd 0x69(%rsi),%esi
+  802dc1:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802dc2:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  802dc6:	65 78 70             	gs js  802e39 <__rodata_start+0x189>
+  802dc9:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  802dce:	20 65 6e             	and    %ah,0x6e(%rbp)
+  802dd1:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  802dd5:	20 66 69             	and    %ah,0x69(%rsi)
+  802dd8:	6c                   	insb   (%dx),%es:(%rdi)
+  802dd9:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  802ddd:	20 66 72             	and    %ah,0x72(%rsi)
+  802de0:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  802de5:	61                   	(bad)
+  802de6:	63 65 20             	movsxd 0x20(%rbp),%esp
+  802de9:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802dea:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802deb:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  802def:	6b 00 74             	imul   $0x74,(%rax),%eax
+  802df2:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802df3:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802df4:	20 6d 61             	and    %ch,0x61(%rbp)
+  802df7:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802df8:	79 20                	jns    802e1a <__rodata_start+0x16a>
+  802dfa:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  802e01:	72 65                	jb     802e68 <__rodata_start+0x1b8>
+  802e03:	20 6f 70             	and    %ch,0x70(%rdi)
+  802e06:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  802e08:	00 66 69             	add    %ah,0x69(%rsi)
+  802e0b:	6c                   	insb   (%dx),%es:(%rdi)
+  802e0c:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  802e10:	20 62 6c             	and    %ah,0x6c(%rdx)
+  802e13:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802e14:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  802e17:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802e18:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802e19:	74 20                	je     802e3b <__rodata_start+0x18b>
+  802e1b:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  802e1d:	75 6e                	jne    802e8d <__rodata_start+0x1dd>
+  802e1f:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  802e23:	76 61                	jbe    802e86 <__rodata_start+0x1d6>
+  802e25:	6c                   	insb   (%dx),%es:(%rdi)
+  802e26:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  802e2d:	00 
+  802e2e:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  802e35:	72 65                	jb     802e9c <__rodata_start+0x1ec>
+  802e37:	61                   	(bad)
+  802e38:	64 79 20             	fs jns 802e5b <__rodata_start+0x1ab>
+  802e3b:	65 78 69             	gs js  802ea7 <__rodata_start+0x1f7>
+  802e3e:	73 74                	jae    802eb4 <__rodata_start+0x204>
+  802e40:	73 00                	jae    802e42 <__rodata_start+0x192>
+  802e42:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802e43:	70 65                	jo     802eaa <__rodata_start+0x1fa>
+  802e45:	72 61                	jb     802ea8 <__rodata_start+0x1f8>
+  802e47:	74 69                	je     802eb2 <__rodata_start+0x202>
+  802e49:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802e4a:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802e4b:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  802e4e:	74 20                	je     802e70 <__rodata_start+0x1c0>
+  802e50:	73 75                	jae    802ec7 <__rodata_start+0x217>
+  802e52:	70 70                	jo     802ec4 <__rodata_start+0x214>
+  802e54:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802e55:	72 74                	jb     802ecb <__rodata_start+0x21b>
+  802e57:	65 64 00 6f 70       	gs add %ch,%fs:0x70(%rdi)
+  802e5c:	65 72 61             	gs jb  802ec0 <__rodata_start+0x210>
+  802e5f:	74 69                	je     802eca <__rodata_start+0x21a>
+  802e61:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802e62:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802e63:	20 69 6e             	and    %ch,0x6e(%rcx)
+  802e66:	74 65                	je     802ecd <__rodata_start+0x21d>
+  802e68:	72 72                	jb     802edc <__rodata_start+0x22c>
+  802e6a:	75 70                	jne    802edc <__rodata_start+0x22c>
+  802e6c:	74 65                	je     802ed3 <__rodata_start+0x223>
+  802e6e:	64 00 6e 6f          	add    %ch,%fs:0x6f(%rsi)
+  802e72:	74 20                	je     802e94 <__rodata_start+0x1e4>
+  802e74:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  802e76:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802e77:	75 67                	jne    802ee0 <__rodata_start+0x230>
+  802e79:	68 20 43 50 55       	push   $0x55504320
+  802e7e:	20 74 69 6d          	and    %dh,0x6d(%rcx,%rbp,2)
+  802e82:	65 00 66 2e          	add    %ah,%gs:0x2e(%rsi)
+  802e86:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+  802e8d:	00 
+  802e8e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  802e95:	00 00 00 
+  802e98:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+  802e9f:	00 
+  802ea0:	c6 03 80             	movb   $0x80,(%rbx)
+  802ea3:	00 00                	add    %al,(%rax)
+  802ea5:	00 00                	add    %al,(%rax)
+  802ea7:	00 07                	add    %al,(%rdi)
+  802ea9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  802eaf:	00 f7                	add    %dh,%bh
+  802eb1:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802eb7:	00 07                	add    %al,(%rdi)
+  802eb9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  802ebf:	00 07                	add    %al,(%rdi)
+  802ec1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  802ec7:	00 07                	add    %al,(%rdi)
+  802ec9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  802ecf:	00 07                	add    %al,(%rdi)
+  802ed1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  802ed7:	00 e5                	add    %ah,%ch
+  802ed9:	03 80 00 00 00 00    	add    0x0(%rax),%eax
+  802edf:	00 07                	add    %al,(%rdi)
+  802ee1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  802ee7:	00 07                	add    %al,(%rdi)
+  802ee9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  802eef:	00 d9                	add    %bl,%cl
+  802ef1:	03 80 00 00 00 00    	add    0x0(%rax),%eax
+  802ef7:	00 53 04             	add    %dl,0x4(%rbx)
+  802efa:	80 00 00             	addb   $0x0,(%rax)
+  802efd:	00 00                	add    %al,(%rax)
+  802eff:	00 07                	add    %al,(%rdi)
+  802f01:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  802f07:	00 d9                	add    %bl,%cl
+  802f09:	03 80 00 00 00 00    	add    0x0(%rax),%eax
+  802f0f:	00 1f                	add    %bl,(%rdi)
+  802f11:	04 80                	add    $0x80,%al
+  802f13:	00 00                	add    %al,(%rax)
+  802f15:	00 00                	add    %al,(%rax)
+  802f17:	00 1f                	add    %bl,(%rdi)
+  802f19:	04 80                	add    $0x80,%al
+  802f1b:	00 00                	add    %al,(%rax)
+  802f1d:	00 00                	add    %al,(%rax)
+  802f1f:	00 1f                	add    %bl,(%rdi)
+  802f21:	04 80                	add    $0x80,%al
+  802f23:	00 00                	add    %al,(%rax)
+  802f25:	00 00                	add    %al,(%rax)
+  802f27:	00 1f                	add    %bl,(%rdi)
+  802f29:	04 80                	add    $0x80,%al
+  802f2b:	00 00                	add    %al,(%rax)
+  802f2d:	00 00                	add    %al,(%rax)
+  802f2f:	00 1f                	add    %bl,(%rdi)
+  802f31:	04 80                	add    $0x80,%al
+  802f33:	00 00                	add    %al,(%rax)
+  802f35:	00 00                	add    %al,(%rax)
+  802f37:	00 1f                	add    %bl,(%rdi)
+  802f39:	04 80                	add    $0x80,%al
+  802f3b:	00 00                	add    %al,(%rax)
+  802f3d:	00 00                	add    %al,(%rax)
+  802f3f:	00 1f                	add    %bl,(%rdi)
+  802f41:	04 80                	add    $0x80,%al
+  802f43:	00 00                	add    %al,(%rax)
+  802f45:	00 00                	add    %al,(%rax)
+  802f47:	00 1f                	add    %bl,(%rdi)
+  802f49:	04 80                	add    $0x80,%al
+  802f4b:	00 00                	add    %al,(%rax)
+  802f4d:	00 00                	add    %al,(%rax)
+  802f4f:	00 1f                	add    %bl,(%rdi)
+  802f51:	04 80                	add    $0x80,%al
+  802f53:	00 00                	add    %al,(%rax)
+  802f55:	00 00                	add    %al,(%rax)
+  802f57:	00 07                	add    %al,(%rdi)
+  802f59:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  802f5f:	00 07                	add    %al,(%rdi)
+  802f61:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  802f67:	00 07                	add    %al,(%rdi)
+  802f69:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  802f6f:	00 07                	add    %al,(%rdi)
+  802f71:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  802f77:	00 07                	add    %al,(%rdi)
+  802f79:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  802f7f:	00 07                	add    %al,(%rdi)
+  802f81:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  802f87:	00 07                	add    %al,(%rdi)
+  802f89:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  802f8f:	00 07                	add    %al,(%rdi)
+  802f91:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  802f97:	00 07                	add    %al,(%rdi)
+  802f99:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  802f9f:	00 07                	add    %al,(%rdi)
+  802fa1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  802fa7:	00 07                	add    %al,(%rdi)
+  802fa9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  802faf:	00 07                	add    %al,(%rdi)
+  802fb1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  802fb7:	00 07                	add    %al,(%rdi)
+  802fb9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  802fbf:	00 07                	add    %al,(%rdi)
+  802fc1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  802fc7:	00 07                	add    %al,(%rdi)
+  802fc9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  802fcf:	00 07                	add    %al,(%rdi)
+  802fd1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  802fd7:	00 07                	add    %al,(%rdi)
+  802fd9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  802fdf:	00 07                	add    %al,(%rdi)
+  802fe1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  802fe7:	00 07                	add    %al,(%rdi)
+  802fe9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  802fef:	00 07                	add    %al,(%rdi)
+  802ff1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  802ff7:	00 07                	add    %al,(%rdi)
+  802ff9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  802fff:	00 07                	add    %al,(%rdi)
+  803001:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803007:	00 07                	add    %al,(%rdi)
+  803009:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80300f:	00 07                	add    %al,(%rdi)
+  803011:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803017:	00 07                	add    %al,(%rdi)
+  803019:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80301f:	00 07                	add    %al,(%rdi)
+  803021:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803027:	00 07                	add    %al,(%rdi)
+  803029:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80302f:	00 07                	add    %al,(%rdi)
+  803031:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803037:	00 07                	add    %al,(%rdi)
+  803039:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80303f:	00 07                	add    %al,(%rdi)
+  803041:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803047:	00 2a                	add    %ch,(%rdx)
+  803049:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  80304f:	00 07                	add    %al,(%rdi)
+  803051:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803057:	00 07                	add    %al,(%rdi)
+  803059:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80305f:	00 07                	add    %al,(%rdi)
+  803061:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803067:	00 07                	add    %al,(%rdi)
+  803069:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80306f:	00 07                	add    %al,(%rdi)
+  803071:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803077:	00 07                	add    %al,(%rdi)
+  803079:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80307f:	00 07                	add    %al,(%rdi)
+  803081:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803087:	00 07                	add    %al,(%rdi)
+  803089:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80308f:	00 07                	add    %al,(%rdi)
+  803091:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803097:	00 07                	add    %al,(%rdi)
+  803099:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80309f:	00 76 04             	add    %dh,0x4(%rsi)
+  8030a2:	80 00 00             	addb   $0x0,(%rax)
+  8030a5:	00 00                	add    %al,(%rax)
+  8030a7:	00 45 06             	add    %al,0x6(%rbp)
+  8030aa:	80 00 00             	addb   $0x0,(%rax)
+  8030ad:	00 00                	add    %al,(%rax)
+  8030af:	00 07                	add    %al,(%rdi)
+  8030b1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8030b7:	00 07                	add    %al,(%rdi)
+  8030b9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8030bf:	00 07                	add    %al,(%rdi)
+  8030c1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8030c7:	00 07                	add    %al,(%rdi)
+  8030c9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8030cf:	00 a5 04 80 00 00    	add    %ah,0x8004(%rbp)
+  8030d5:	00 00                	add    %al,(%rax)
+  8030d7:	00 07                	add    %al,(%rdi)
+  8030d9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8030df:	00 07                	add    %al,(%rdi)
+  8030e1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8030e7:	00 6b 04             	add    %ch,0x4(%rbx)
+  8030ea:	80 00 00             	addb   $0x0,(%rax)
+  8030ed:	00 00                	add    %al,(%rax)
+  8030ef:	00 07                	add    %al,(%rdi)
+  8030f1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8030f7:	00 07                	add    %al,(%rdi)
+  8030f9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8030ff:	00 ed                	add    %ch,%ch
+  803101:	07                   	(bad)
+  803102:	80 00 00             	addb   $0x0,(%rax)
+  803105:	00 00                	add    %al,(%rax)
+  803107:	00 b7 08 80 00 00    	add    %dh,0x8008(%rdi)
+  80310d:	00 00                	add    %al,(%rax)
+  80310f:	00 07                	add    %al,(%rdi)
+  803111:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803117:	00 07                	add    %al,(%rdi)
+  803119:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80311f:	00 3c 05 80 00 00 00 	add    %bh,0x80(,%rax,1)
+  803126:	00 00                	add    %al,(%rax)
+  803128:	07                   	(bad)
+  803129:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80312f:	00 19                	add    %bl,(%rcx)
+  803131:	07                   	(bad)
+  803132:	80 00 00             	addb   $0x0,(%rax)
+  803135:	00 00                	add    %al,(%rax)
+  803137:	00 07                	add    %al,(%rdi)
+  803139:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80313f:	00 07                	add    %al,(%rdi)
+  803141:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803147:	00 2a                	add    %ch,(%rdx)
+  803149:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  80314f:	00 07                	add    %al,(%rdi)
+  803151:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803157:	00 cf                	add    %cl,%bh
+  803159:	03 80 00 00 00 00    	add    0x0(%rax),%eax
+	...
+
+0000000000803160 <error_string>:
+	...
+  803168:	fd 2c 80 00 00 00 00 00 0f 2d 80 00 00 00 00 00     .,.......-......
+  803178:	1f 2d 80 00 00 00 00 00 31 2d 80 00 00 00 00 00     .-......1-......
+  803188:	3f 2d 80 00 00 00 00 00 53 2d 80 00 00 00 00 00     ?-......S-......
+  803198:	68 2d 80 00 00 00 00 00 7b 2d 80 00 00 00 00 00     h-......{-......
+  8031a8:	8d 2d 80 00 00 00 00 00 a1 2d 80 00 00 00 00 00     .-.......-......
+  8031b8:	b1 2d 80 00 00 00 00 00 c4 2d 80 00 00 00 00 00     .-.......-......
+  8031c8:	db 2d 80 00 00 00 00 00 f1 2d 80 00 00 00 00 00     .-.......-......
+  8031d8:	09 2e 80 00 00 00 00 00 21 2e 80 00 00 00 00 00     ........!.......
+  8031e8:	2e 2e 80 00 00 00 00 00 10 32 80 00 00 00 00 00     .........2......
+  8031f8:	42 2e 80 00 00 00 00 00 5a 2e 80 00 00 00 00 00     B.......Z.......
+  803208:	70 2e 80 00 00 00 00 00 66 69 6c 65 20 69 73 20     p.......file is 
+  803218:	6e 6f 74 20 61 20 76 61 6c 69 64 20 65 78 65 63     not a valid exec
+  803228:	75 74 61 62 6c 65 00 90 73 79 73 63 61 6c 6c 20     utable..syscall 
+  803238:	25 7a 64 20 72 65 74 75 72 6e 65 64 20 25 7a 64     %zd returned %zd
+  803248:	20 28 3e 20 30 29 00 6c 69 62 2f 73 79 73 63 61      (> 0).lib/sysca
+  803258:	6c 6c 2e 63 00 0f 1f 00 5b 25 30 38 78 5d 20 75     ll.c....[%08x] u
+  803268:	6e 6b 6e 6f 77 6e 20 64 65 76 69 63 65 20 74 79     nknown device ty
+  803278:	70 65 20 25 64 0a 00 00 5b 25 30 38 78 5d 20 66     pe %d...[%08x] f
+  803288:	74 72 75 6e 63 61 74 65 20 25 64 20 2d 2d 20 62     truncate %d -- b
+  803298:	61 64 20 6d 6f 64 65 0a 00 5b 25 30 38 78 5d 20     ad mode..[%08x] 
+  8032a8:	72 65 61 64 20 25 64 20 2d 2d 20 62 61 64 20 6d     read %d -- bad m
+  8032b8:	6f 64 65 0a 00 5b 25 30 38 78 5d 20 77 72 69 74     ode..[%08x] writ
+  8032c8:	65 20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65     e %d -- bad mode
+  8032d8:	0a 00 66 0f 1f 44 00 00                             ..f..D..
+
+00000000008032e0 <devtab>:
+  8032e0:	20 40 80 00 00 00 00 00 60 40 80 00 00 00 00 00      @......`@......
+  8032f0:	a0 40 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .@..............
+  803300:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  803310:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  803320:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  803330:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  803340:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  803350:	3d 20 32 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73 00     = 2.<cons>.cons.
+  803360:	5b 25 30 38 78 5d 20 75 73 65 72 20 70 61 6e 69     [%08x] user pani
+  803370:	63 20 69 6e 20 25 73 20 61 74 20 25 73 3a 25 64     c in %s at %s:%d
+  803380:	3a 20 00 73 79 73 5f 69 70 63 5f 74 72 79 5f 73     : .sys_ipc_try_s
+  803390:	65 6e 64 20 66 61 69 6c 65 64 3a 20 25 69 00 6c     end failed: %i.l
+  8033a0:	69 62 2f 69 70 63 2e 63 00 66 2e 0f 1f 84 00 00     ib/ipc.c.f......
+  8033b0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8033c0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8033d0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8033e0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8033f0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803400:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803410:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803420:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803430:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803440:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803450:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803460:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803470:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803480:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803490:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8034a0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8034b0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8034c0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8034d0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8034e0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8034f0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803500:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803510:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803520:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803530:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803540:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803550:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803560:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803570:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803580:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803590:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8035a0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8035b0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8035c0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8035d0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8035e0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8035f0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803600:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803610:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803620:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803630:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803640:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803650:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803660:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803670:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803680:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803690:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8036a0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8036b0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8036c0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8036d0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8036e0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8036f0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803700:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803710:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803720:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803730:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803740:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803750:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803760:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803770:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803780:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803790:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8037a0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8037b0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8037c0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8037d0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8037e0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8037f0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803800:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803810:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803820:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803830:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803840:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803850:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803860:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803870:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803880:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803890:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8038a0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8038b0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8038c0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8038d0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8038e0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8038f0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803900:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803910:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803920:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803930:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803940:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803950:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803960:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803970:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803980:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803990:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8039a0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8039b0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8039c0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8039d0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8039e0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8039f0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803a00:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803a10:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803a20:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803a30:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803a40:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803a50:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803a60:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803a70:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803a80:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803a90:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803aa0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803ab0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803ac0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803ad0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803ae0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803af0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803b00:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803b10:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803b20:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803b30:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803b40:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803b50:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803b60:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803b70:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803b80:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803b90:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803ba0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803bb0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803bc0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803bd0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803be0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803bf0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803c00:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803c10:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803c20:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803c30:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803c40:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803c50:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803c60:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803c70:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803c80:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803c90:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803ca0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803cb0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803cc0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803cd0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803ce0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803cf0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803d00:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803d10:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803d20:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803d30:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803d40:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803d50:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803d60:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803d70:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803d80:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803d90:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803da0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803db0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803dc0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803dd0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803de0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803df0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803e00:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803e10:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803e20:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803e30:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803e40:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803e50:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803e60:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803e70:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803e80:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803e90:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803ea0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803eb0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803ec0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803ed0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803ee0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803ef0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803f00:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803f10:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803f20:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803f30:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803f40:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803f50:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803f60:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803f70:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803f80:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803f90:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803fa0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803fb0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803fc0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803fd0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803fe0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803ff0:	1f 84 00 00 00 00 00 66 0f 1f 84 00 00 00 00 00     .......f........
@@ -0,0 +1,5865 @@
+
+obj/user/dumbfork:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 81 01 00 00       	call   8001a4 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <dumbfork>:
+        sys_yield();
+    }
+}
+
+envid_t
+dumbfork(void) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	53                   	push   %rbx
+  80002a:	48 83 ec 08          	sub    $0x8,%rsp
+
+/* This must be inlined. Exercise for reader: why? */
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+    envid_t ret;
+    asm volatile("int %2"
+  80002e:	b8 08 00 00 00       	mov    $0x8,%eax
+  800033:	cd 30                	int    $0x30
+  800035:	89 c3                	mov    %eax,%ebx
+     * The kernel will initialize it with a copy of our register state,
+     * so that the child will appear to have called sys_exofork() too -
+     * except that in the child, this "fake" call to sys_exofork()
+     * will return 0 instead of the envid of the child. */
+    envid = sys_exofork();
+    if (envid < 0)
+  800037:	85 c0                	test   %eax,%eax
+  800039:	78 4e                	js     800089 <dumbfork+0x64>
+        panic("sys_exofork: %i", envid);
+    if (envid == 0) {
+  80003b:	74 79                	je     8000b6 <dumbfork+0x91>
+        return 0;
+    }
+
+    /* We're the parent.
+     * Eagerly lazily copy our entire address space into the child. */
+    sys_map_region(0, NULL, envid, NULL, MAX_USER_ADDRESS, PROT_ALL | PROT_LAZY | PROT_COMBINE);
+  80003d:	41 b9 df 01 00 00    	mov    $0x1df,%r9d
+  800043:	49 b8 00 00 00 00 80 	movabs $0x8000000000,%r8
+  80004a:	00 00 00 
+  80004d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800052:	89 c2                	mov    %eax,%edx
+  800054:	be 00 00 00 00       	mov    $0x0,%esi
+  800059:	bf 00 00 00 00       	mov    $0x0,%edi
+  80005e:	48 b8 fc 12 80 00 00 	movabs $0x8012fc,%rax
+  800065:	00 00 00 
+  800068:	ff d0                	call   *%rax
+
+    /* Start the child environment running */
+    if ((r = sys_env_set_status(envid, ENV_RUNNABLE)) < 0)
+  80006a:	be 02 00 00 00       	mov    $0x2,%esi
+  80006f:	89 df                	mov    %ebx,%edi
+  800071:	48 b8 31 14 80 00 00 	movabs $0x801431,%rax
+  800078:	00 00 00 
+  80007b:	ff d0                	call   *%rax
+  80007d:	85 c0                	test   %eax,%eax
+  80007f:	78 66                	js     8000e7 <dumbfork+0xc2>
+        panic("sys_env_set_status: %i", r);
+
+    return envid;
+}
+  800081:	89 d8                	mov    %ebx,%eax
+  800083:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800087:	c9                   	leave
+  800088:	c3                   	ret
+        panic("sys_exofork: %i", envid);
+  800089:	89 c1                	mov    %eax,%ecx
+  80008b:	48 ba f0 2d 80 00 00 	movabs $0x802df0,%rdx
+  800092:	00 00 00 
+  800095:	be 23 00 00 00       	mov    $0x23,%esi
+  80009a:	48 bf 00 2e 80 00 00 	movabs $0x802e00,%rdi
+  8000a1:	00 00 00 
+  8000a4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000a9:	49 b8 70 02 80 00 00 	movabs $0x800270,%r8
+  8000b0:	00 00 00 
+  8000b3:	41 ff d0             	call   *%r8
+        thisenv = &envs[ENVX(sys_getenvid())];
+  8000b6:	48 b8 d5 11 80 00 00 	movabs $0x8011d5,%rax
+  8000bd:	00 00 00 
+  8000c0:	ff d0                	call   *%rax
+  8000c2:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8000c7:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+  8000ce:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8000d5:	00 00 00 
+  8000d8:	48 01 d0             	add    %rdx,%rax
+  8000db:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  8000e2:	00 00 00 
+        return 0;
+  8000e5:	eb 9a                	jmp    800081 <dumbfork+0x5c>
+        panic("sys_env_set_status: %i", r);
+  8000e7:	89 c1                	mov    %eax,%ecx
+  8000e9:	48 ba 10 2e 80 00 00 	movabs $0x802e10,%rdx
+  8000f0:	00 00 00 
+  8000f3:	be 33 00 00 00       	mov    $0x33,%esi
+  8000f8:	48 bf 00 2e 80 00 00 	movabs $0x802e00,%rdi
+  8000ff:	00 00 00 
+  800102:	b8 00 00 00 00       	mov    $0x0,%eax
+  800107:	49 b8 70 02 80 00 00 	movabs $0x800270,%r8
+  80010e:	00 00 00 
+  800111:	41 ff d0             	call   *%r8
+
+0000000000800114 <umain>:
+umain(int argc, char **argv) {
+  800114:	55                   	push   %rbp
+  800115:	48 89 e5             	mov    %rsp,%rbp
+  800118:	41 57                	push   %r15
+  80011a:	41 56                	push   %r14
+  80011c:	41 55                	push   %r13
+  80011e:	41 54                	push   %r12
+  800120:	53                   	push   %rbx
+  800121:	48 83 ec 08          	sub    $0x8,%rsp
+    who = dumbfork();
+  800125:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  80012c:	00 00 00 
+  80012f:	ff d0                	call   *%rax
+  800131:	41 89 c4             	mov    %eax,%r12d
+    for (int i = 0; i < (who ? 10 : 20); i++) {
+  800134:	85 c0                	test   %eax,%eax
+  800136:	49 bd 27 2e 80 00 00 	movabs $0x802e27,%r13
+  80013d:	00 00 00 
+  800140:	48 b8 2e 2e 80 00 00 	movabs $0x802e2e,%rax
+  800147:	00 00 00 
+  80014a:	4c 0f 44 e8          	cmove  %rax,%r13
+  80014e:	bb 00 00 00 00       	mov    $0x0,%ebx
+        cprintf("%d: I am the %s!\n", i, who ? "parent" : "child");
+  800153:	49 bf c0 03 80 00 00 	movabs $0x8003c0,%r15
+  80015a:	00 00 00 
+        sys_yield();
+  80015d:	49 be 06 12 80 00 00 	movabs $0x801206,%r14
+  800164:	00 00 00 
+    for (int i = 0; i < (who ? 10 : 20); i++) {
+  800167:	eb 22                	jmp    80018b <umain+0x77>
+  800169:	83 fb 13             	cmp    $0x13,%ebx
+  80016c:	7f 27                	jg     800195 <umain+0x81>
+        cprintf("%d: I am the %s!\n", i, who ? "parent" : "child");
+  80016e:	4c 89 ea             	mov    %r13,%rdx
+  800171:	89 de                	mov    %ebx,%esi
+  800173:	48 bf 34 2e 80 00 00 	movabs $0x802e34,%rdi
+  80017a:	00 00 00 
+  80017d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800182:	41 ff d7             	call   *%r15
+        sys_yield();
+  800185:	41 ff d6             	call   *%r14
+    for (int i = 0; i < (who ? 10 : 20); i++) {
+  800188:	83 c3 01             	add    $0x1,%ebx
+  80018b:	45 85 e4             	test   %r12d,%r12d
+  80018e:	74 d9                	je     800169 <umain+0x55>
+  800190:	83 fb 09             	cmp    $0x9,%ebx
+  800193:	7e d9                	jle    80016e <umain+0x5a>
+}
+  800195:	48 83 c4 08          	add    $0x8,%rsp
+  800199:	5b                   	pop    %rbx
+  80019a:	41 5c                	pop    %r12
+  80019c:	41 5d                	pop    %r13
+  80019e:	41 5e                	pop    %r14
+  8001a0:	41 5f                	pop    %r15
+  8001a2:	5d                   	pop    %rbp
+  8001a3:	c3                   	ret
+
+00000000008001a4 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  8001a4:	55                   	push   %rbp
+  8001a5:	48 89 e5             	mov    %rsp,%rbp
+  8001a8:	41 56                	push   %r14
+  8001aa:	41 55                	push   %r13
+  8001ac:	41 54                	push   %r12
+  8001ae:	53                   	push   %rbx
+  8001af:	41 89 fd             	mov    %edi,%r13d
+  8001b2:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  8001b5:	48 ba d8 40 80 00 00 	movabs $0x8040d8,%rdx
+  8001bc:	00 00 00 
+  8001bf:	48 b8 d8 40 80 00 00 	movabs $0x8040d8,%rax
+  8001c6:	00 00 00 
+  8001c9:	48 39 c2             	cmp    %rax,%rdx
+  8001cc:	73 17                	jae    8001e5 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  8001ce:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  8001d1:	49 89 c4             	mov    %rax,%r12
+  8001d4:	48 83 c3 08          	add    $0x8,%rbx
+  8001d8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001dd:	ff 53 f8             	call   *-0x8(%rbx)
+  8001e0:	4c 39 e3             	cmp    %r12,%rbx
+  8001e3:	72 ef                	jb     8001d4 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+    envid_t this_env_id = sys_getenvid();
+  8001e5:	48 b8 d5 11 80 00 00 	movabs $0x8011d5,%rax
+  8001ec:	00 00 00 
+  8001ef:	ff d0                	call   *%rax
+    thisenv = &((struct Env*)UENVS)[ENVX(this_env_id)];
+  8001f1:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8001f6:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+  8001fd:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  800204:	00 00 00 
+  800207:	48 01 d0             	add    %rdx,%rax
+  80020a:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  800211:	00 00 00 
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  800214:	45 85 ed             	test   %r13d,%r13d
+  800217:	7e 0d                	jle    800226 <libmain+0x82>
+  800219:	49 8b 06             	mov    (%r14),%rax
+  80021c:	48 a3 00 40 80 00 00 	movabs %rax,0x804000
+  800223:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  800226:	4c 89 f6             	mov    %r14,%rsi
+  800229:	44 89 ef             	mov    %r13d,%edi
+  80022c:	48 b8 14 01 80 00 00 	movabs $0x800114,%rax
+  800233:	00 00 00 
+  800236:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  800238:	48 b8 4d 02 80 00 00 	movabs $0x80024d,%rax
+  80023f:	00 00 00 
+  800242:	ff d0                	call   *%rax
+#endif
+}
+  800244:	5b                   	pop    %rbx
+  800245:	41 5c                	pop    %r12
+  800247:	41 5d                	pop    %r13
+  800249:	41 5e                	pop    %r14
+  80024b:	5d                   	pop    %rbp
+  80024c:	c3                   	ret
+
+000000000080024d <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  80024d:	55                   	push   %rbp
+  80024e:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  800251:	48 b8 29 19 80 00 00 	movabs $0x801929,%rax
+  800258:	00 00 00 
+  80025b:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  80025d:	bf 00 00 00 00       	mov    $0x0,%edi
+  800262:	48 b8 6a 11 80 00 00 	movabs $0x80116a,%rax
+  800269:	00 00 00 
+  80026c:	ff d0                	call   *%rax
+}
+  80026e:	5d                   	pop    %rbp
+  80026f:	c3                   	ret
+
+0000000000800270 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  800270:	55                   	push   %rbp
+  800271:	48 89 e5             	mov    %rsp,%rbp
+  800274:	41 56                	push   %r14
+  800276:	41 55                	push   %r13
+  800278:	41 54                	push   %r12
+  80027a:	53                   	push   %rbx
+  80027b:	48 83 ec 50          	sub    $0x50,%rsp
+  80027f:	49 89 fc             	mov    %rdi,%r12
+  800282:	41 89 f5             	mov    %esi,%r13d
+  800285:	48 89 d3             	mov    %rdx,%rbx
+  800288:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  80028c:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  800290:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800294:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  80029b:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80029f:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  8002a3:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  8002a7:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  8002ab:	48 b8 00 40 80 00 00 	movabs $0x804000,%rax
+  8002b2:	00 00 00 
+  8002b5:	4c 8b 30             	mov    (%rax),%r14
+  8002b8:	48 b8 d5 11 80 00 00 	movabs $0x8011d5,%rax
+  8002bf:	00 00 00 
+  8002c2:	ff d0                	call   *%rax
+  8002c4:	89 c6                	mov    %eax,%esi
+  8002c6:	45 89 e8             	mov    %r13d,%r8d
+  8002c9:	4c 89 e1             	mov    %r12,%rcx
+  8002cc:	4c 89 f2             	mov    %r14,%rdx
+  8002cf:	48 bf 50 2e 80 00 00 	movabs $0x802e50,%rdi
+  8002d6:	00 00 00 
+  8002d9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002de:	49 bc c0 03 80 00 00 	movabs $0x8003c0,%r12
+  8002e5:	00 00 00 
+  8002e8:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  8002eb:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  8002ef:	48 89 df             	mov    %rbx,%rdi
+  8002f2:	48 b8 5c 03 80 00 00 	movabs $0x80035c,%rax
+  8002f9:	00 00 00 
+  8002fc:	ff d0                	call   *%rax
+    cprintf("\n");
+  8002fe:	48 bf 44 2e 80 00 00 	movabs $0x802e44,%rdi
+  800305:	00 00 00 
+  800308:	b8 00 00 00 00       	mov    $0x0,%eax
+  80030d:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  800310:	cc                   	int3
+  800311:	eb fd                	jmp    800310 <_panic+0xa0>
+
+0000000000800313 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  800313:	55                   	push   %rbp
+  800314:	48 89 e5             	mov    %rsp,%rbp
+  800317:	53                   	push   %rbx
+  800318:	48 83 ec 08          	sub    $0x8,%rsp
+  80031c:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  80031f:	8b 06                	mov    (%rsi),%eax
+  800321:	8d 50 01             	lea    0x1(%rax),%edx
+  800324:	89 16                	mov    %edx,(%rsi)
+  800326:	48 98                	cltq
+  800328:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  80032d:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  800333:	74 0a                	je     80033f <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  800335:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  800339:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80033d:	c9                   	leave
+  80033e:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  80033f:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  800343:	be ff 00 00 00       	mov    $0xff,%esi
+  800348:	48 b8 0c 11 80 00 00 	movabs $0x80110c,%rax
+  80034f:	00 00 00 
+  800352:	ff d0                	call   *%rax
+        state->offset = 0;
+  800354:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  80035a:	eb d9                	jmp    800335 <putch+0x22>
+
+000000000080035c <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  80035c:	55                   	push   %rbp
+  80035d:	48 89 e5             	mov    %rsp,%rbp
+  800360:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  800367:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  80036a:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  800371:	b9 21 00 00 00       	mov    $0x21,%ecx
+  800376:	b8 00 00 00 00       	mov    $0x0,%eax
+  80037b:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  80037e:	48 89 f1             	mov    %rsi,%rcx
+  800381:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  800388:	48 bf 13 03 80 00 00 	movabs $0x800313,%rdi
+  80038f:	00 00 00 
+  800392:	48 b8 10 05 80 00 00 	movabs $0x800510,%rax
+  800399:	00 00 00 
+  80039c:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  80039e:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  8003a5:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  8003ac:	48 b8 0c 11 80 00 00 	movabs $0x80110c,%rax
+  8003b3:	00 00 00 
+  8003b6:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  8003b8:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  8003be:	c9                   	leave
+  8003bf:	c3                   	ret
+
+00000000008003c0 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  8003c0:	55                   	push   %rbp
+  8003c1:	48 89 e5             	mov    %rsp,%rbp
+  8003c4:	48 83 ec 50          	sub    $0x50,%rsp
+  8003c8:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8003cc:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8003d0:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8003d4:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8003d8:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  8003dc:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  8003e3:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8003e7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8003eb:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8003ef:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  8003f3:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  8003f7:	48 b8 5c 03 80 00 00 	movabs $0x80035c,%rax
+  8003fe:	00 00 00 
+  800401:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  800403:	c9                   	leave
+  800404:	c3                   	ret
+
+0000000000800405 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  800405:	55                   	push   %rbp
+  800406:	48 89 e5             	mov    %rsp,%rbp
+  800409:	41 57                	push   %r15
+  80040b:	41 56                	push   %r14
+  80040d:	41 55                	push   %r13
+  80040f:	41 54                	push   %r12
+  800411:	53                   	push   %rbx
+  800412:	48 83 ec 18          	sub    $0x18,%rsp
+  800416:	49 89 fc             	mov    %rdi,%r12
+  800419:	49 89 f5             	mov    %rsi,%r13
+  80041c:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800420:	8b 45 10             	mov    0x10(%rbp),%eax
+  800423:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  800426:	41 89 cf             	mov    %ecx,%r15d
+  800429:	4c 39 fa             	cmp    %r15,%rdx
+  80042c:	73 5b                	jae    800489 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  80042e:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  800432:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  800436:	85 db                	test   %ebx,%ebx
+  800438:	7e 0e                	jle    800448 <print_num+0x43>
+            putch(padc, put_arg);
+  80043a:	4c 89 ee             	mov    %r13,%rsi
+  80043d:	44 89 f7             	mov    %r14d,%edi
+  800440:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  800443:	83 eb 01             	sub    $0x1,%ebx
+  800446:	75 f2                	jne    80043a <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  800448:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  80044c:	48 b9 84 2e 80 00 00 	movabs $0x802e84,%rcx
+  800453:	00 00 00 
+  800456:	48 b8 73 2e 80 00 00 	movabs $0x802e73,%rax
+  80045d:	00 00 00 
+  800460:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  800464:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800468:	ba 00 00 00 00       	mov    $0x0,%edx
+  80046d:	49 f7 f7             	div    %r15
+  800470:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  800474:	4c 89 ee             	mov    %r13,%rsi
+  800477:	41 ff d4             	call   *%r12
+}
+  80047a:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  80047e:	5b                   	pop    %rbx
+  80047f:	41 5c                	pop    %r12
+  800481:	41 5d                	pop    %r13
+  800483:	41 5e                	pop    %r14
+  800485:	41 5f                	pop    %r15
+  800487:	5d                   	pop    %rbp
+  800488:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  800489:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80048d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800492:	49 f7 f7             	div    %r15
+  800495:	48 83 ec 08          	sub    $0x8,%rsp
+  800499:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  80049d:	52                   	push   %rdx
+  80049e:	45 0f be c9          	movsbl %r9b,%r9d
+  8004a2:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  8004a6:	48 89 c2             	mov    %rax,%rdx
+  8004a9:	48 b8 05 04 80 00 00 	movabs $0x800405,%rax
+  8004b0:	00 00 00 
+  8004b3:	ff d0                	call   *%rax
+  8004b5:	48 83 c4 10          	add    $0x10,%rsp
+  8004b9:	eb 8d                	jmp    800448 <print_num+0x43>
+
+00000000008004bb <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  8004bb:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  8004bf:	48 8b 06             	mov    (%rsi),%rax
+  8004c2:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  8004c6:	73 0a                	jae    8004d2 <sprintputch+0x17>
+        *state->start++ = ch;
+  8004c8:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8004cc:	48 89 16             	mov    %rdx,(%rsi)
+  8004cf:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  8004d2:	c3                   	ret
+
+00000000008004d3 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  8004d3:	55                   	push   %rbp
+  8004d4:	48 89 e5             	mov    %rsp,%rbp
+  8004d7:	48 83 ec 50          	sub    $0x50,%rsp
+  8004db:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8004df:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8004e3:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  8004e7:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8004ee:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8004f2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8004f6:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8004fa:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  8004fe:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800502:	48 b8 10 05 80 00 00 	movabs $0x800510,%rax
+  800509:	00 00 00 
+  80050c:	ff d0                	call   *%rax
+}
+  80050e:	c9                   	leave
+  80050f:	c3                   	ret
+
+0000000000800510 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  800510:	55                   	push   %rbp
+  800511:	48 89 e5             	mov    %rsp,%rbp
+  800514:	41 57                	push   %r15
+  800516:	41 56                	push   %r14
+  800518:	41 55                	push   %r13
+  80051a:	41 54                	push   %r12
+  80051c:	53                   	push   %rbx
+  80051d:	48 83 ec 38          	sub    $0x38,%rsp
+  800521:	49 89 fe             	mov    %rdi,%r14
+  800524:	49 89 f5             	mov    %rsi,%r13
+  800527:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  80052a:	48 8b 01             	mov    (%rcx),%rax
+  80052d:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  800531:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800535:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800539:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  80053d:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  800541:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  800545:	0f b6 3b             	movzbl (%rbx),%edi
+  800548:	40 80 ff 25          	cmp    $0x25,%dil
+  80054c:	74 18                	je     800566 <vprintfmt+0x56>
+            if (!ch) return;
+  80054e:	40 84 ff             	test   %dil,%dil
+  800551:	0f 84 b1 06 00 00    	je     800c08 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  800557:	40 0f b6 ff          	movzbl %dil,%edi
+  80055b:	4c 89 ee             	mov    %r13,%rsi
+  80055e:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  800561:	4c 89 e3             	mov    %r12,%rbx
+  800564:	eb db                	jmp    800541 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  800566:	be 00 00 00 00       	mov    $0x0,%esi
+  80056b:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  80056f:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  800574:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  80057a:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  800581:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800585:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  80058a:	41 0f b6 04 24       	movzbl (%r12),%eax
+  80058f:	88 45 a0             	mov    %al,-0x60(%rbp)
+  800592:	83 e8 23             	sub    $0x23,%eax
+  800595:	3c 57                	cmp    $0x57,%al
+  800597:	0f 87 51 06 00 00    	ja     800bee <vprintfmt+0x6de>
+  80059d:	0f b6 c0             	movzbl %al,%eax
+  8005a0:	48 b9 40 30 80 00 00 	movabs $0x803040,%rcx
+  8005a7:	00 00 00 
+  8005aa:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  8005ad:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  8005b0:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  8005b4:	eb cf                	jmp    800585 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  8005b6:	49 89 dc             	mov    %rbx,%r12
+  8005b9:	be 01 00 00 00       	mov    $0x1,%esi
+  8005be:	eb c5                	jmp    800585 <vprintfmt+0x75>
+            padc = ch;
+  8005c0:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  8005c4:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8005c7:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8005ca:	eb b9                	jmp    800585 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8005cc:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8005cf:	83 f8 2f             	cmp    $0x2f,%eax
+  8005d2:	77 24                	ja     8005f8 <vprintfmt+0xe8>
+  8005d4:	89 c1                	mov    %eax,%ecx
+  8005d6:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  8005da:	83 c0 08             	add    $0x8,%eax
+  8005dd:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8005e0:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  8005e3:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  8005e6:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8005ea:	79 99                	jns    800585 <vprintfmt+0x75>
+                width = precision;
+  8005ec:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  8005f0:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8005f6:	eb 8d                	jmp    800585 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8005f8:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8005fc:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  800600:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800604:	eb da                	jmp    8005e0 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  800606:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  80060b:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  80060f:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  800615:	3c 39                	cmp    $0x39,%al
+  800617:	77 1c                	ja     800635 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  800619:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  80061d:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  800621:	0f b6 c0             	movzbl %al,%eax
+  800624:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800629:	0f b6 03             	movzbl (%rbx),%eax
+  80062c:	3c 39                	cmp    $0x39,%al
+  80062e:	76 e9                	jbe    800619 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  800630:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  800633:	eb b1                	jmp    8005e6 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  800635:	49 89 dc             	mov    %rbx,%r12
+  800638:	eb ac                	jmp    8005e6 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  80063a:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  80063d:	85 c9                	test   %ecx,%ecx
+  80063f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800644:	0f 49 c1             	cmovns %ecx,%eax
+  800647:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  80064a:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80064d:	e9 33 ff ff ff       	jmp    800585 <vprintfmt+0x75>
+            lflag++;
+  800652:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  800655:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800658:	e9 28 ff ff ff       	jmp    800585 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  80065d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800660:	83 f8 2f             	cmp    $0x2f,%eax
+  800663:	77 19                	ja     80067e <vprintfmt+0x16e>
+  800665:	89 c2                	mov    %eax,%edx
+  800667:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80066b:	83 c0 08             	add    $0x8,%eax
+  80066e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800671:	8b 3a                	mov    (%rdx),%edi
+  800673:	4c 89 ee             	mov    %r13,%rsi
+  800676:	41 ff d6             	call   *%r14
+            break;
+  800679:	e9 c3 fe ff ff       	jmp    800541 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  80067e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800682:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800686:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80068a:	eb e5                	jmp    800671 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  80068c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80068f:	83 f8 2f             	cmp    $0x2f,%eax
+  800692:	77 5a                	ja     8006ee <vprintfmt+0x1de>
+  800694:	89 c2                	mov    %eax,%edx
+  800696:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80069a:	83 c0 08             	add    $0x8,%eax
+  80069d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  8006a0:	8b 02                	mov    (%rdx),%eax
+  8006a2:	89 c1                	mov    %eax,%ecx
+  8006a4:	f7 d9                	neg    %ecx
+  8006a6:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  8006a9:	83 f9 15             	cmp    $0x15,%ecx
+  8006ac:	7f 4e                	jg     8006fc <vprintfmt+0x1ec>
+  8006ae:	48 63 c1             	movslq %ecx,%rax
+  8006b1:	48 ba 00 33 80 00 00 	movabs $0x803300,%rdx
+  8006b8:	00 00 00 
+  8006bb:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8006bf:	48 85 c0             	test   %rax,%rax
+  8006c2:	74 38                	je     8006fc <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  8006c4:	48 89 c1             	mov    %rax,%rcx
+  8006c7:	48 ba b9 34 80 00 00 	movabs $0x8034b9,%rdx
+  8006ce:	00 00 00 
+  8006d1:	4c 89 ee             	mov    %r13,%rsi
+  8006d4:	4c 89 f7             	mov    %r14,%rdi
+  8006d7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006dc:	49 b8 d3 04 80 00 00 	movabs $0x8004d3,%r8
+  8006e3:	00 00 00 
+  8006e6:	41 ff d0             	call   *%r8
+  8006e9:	e9 53 fe ff ff       	jmp    800541 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  8006ee:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8006f2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006f6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006fa:	eb a4                	jmp    8006a0 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  8006fc:	48 ba 9c 2e 80 00 00 	movabs $0x802e9c,%rdx
+  800703:	00 00 00 
+  800706:	4c 89 ee             	mov    %r13,%rsi
+  800709:	4c 89 f7             	mov    %r14,%rdi
+  80070c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800711:	49 b8 d3 04 80 00 00 	movabs $0x8004d3,%r8
+  800718:	00 00 00 
+  80071b:	41 ff d0             	call   *%r8
+  80071e:	e9 1e fe ff ff       	jmp    800541 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800723:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800726:	83 f8 2f             	cmp    $0x2f,%eax
+  800729:	77 6c                	ja     800797 <vprintfmt+0x287>
+  80072b:	89 c2                	mov    %eax,%edx
+  80072d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800731:	83 c0 08             	add    $0x8,%eax
+  800734:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800737:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  80073a:	48 85 d2             	test   %rdx,%rdx
+  80073d:	48 b8 95 2e 80 00 00 	movabs $0x802e95,%rax
+  800744:	00 00 00 
+  800747:	48 0f 45 c2          	cmovne %rdx,%rax
+  80074b:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  80074f:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800753:	7e 06                	jle    80075b <vprintfmt+0x24b>
+  800755:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  800759:	75 4a                	jne    8007a5 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  80075b:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  80075f:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  800763:	0f b6 00             	movzbl (%rax),%eax
+  800766:	84 c0                	test   %al,%al
+  800768:	0f 85 9a 00 00 00    	jne    800808 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  80076e:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800771:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  800775:	85 c0                	test   %eax,%eax
+  800777:	0f 8e c4 fd ff ff    	jle    800541 <vprintfmt+0x31>
+  80077d:	4c 89 ee             	mov    %r13,%rsi
+  800780:	bf 20 00 00 00       	mov    $0x20,%edi
+  800785:	41 ff d6             	call   *%r14
+  800788:	41 83 ec 01          	sub    $0x1,%r12d
+  80078c:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  800790:	75 eb                	jne    80077d <vprintfmt+0x26d>
+  800792:	e9 aa fd ff ff       	jmp    800541 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800797:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80079b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80079f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007a3:	eb 92                	jmp    800737 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  8007a5:	49 63 f7             	movslq %r15d,%rsi
+  8007a8:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  8007ac:	48 b8 c2 0c 80 00 00 	movabs $0x800cc2,%rax
+  8007b3:	00 00 00 
+  8007b6:	ff d0                	call   *%rax
+  8007b8:	48 89 c2             	mov    %rax,%rdx
+  8007bb:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8007be:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  8007c0:	8d 70 ff             	lea    -0x1(%rax),%esi
+  8007c3:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  8007c6:	85 c0                	test   %eax,%eax
+  8007c8:	7e 91                	jle    80075b <vprintfmt+0x24b>
+  8007ca:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  8007cf:	4c 89 ee             	mov    %r13,%rsi
+  8007d2:	44 89 e7             	mov    %r12d,%edi
+  8007d5:	41 ff d6             	call   *%r14
+  8007d8:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8007dc:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8007df:	83 f8 ff             	cmp    $0xffffffff,%eax
+  8007e2:	75 eb                	jne    8007cf <vprintfmt+0x2bf>
+  8007e4:	e9 72 ff ff ff       	jmp    80075b <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8007e9:	0f b6 f8             	movzbl %al,%edi
+  8007ec:	4c 89 ee             	mov    %r13,%rsi
+  8007ef:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8007f2:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8007f6:	49 83 c4 01          	add    $0x1,%r12
+  8007fa:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  800800:	84 c0                	test   %al,%al
+  800802:	0f 84 66 ff ff ff    	je     80076e <vprintfmt+0x25e>
+  800808:	45 85 ff             	test   %r15d,%r15d
+  80080b:	78 0a                	js     800817 <vprintfmt+0x307>
+  80080d:	41 83 ef 01          	sub    $0x1,%r15d
+  800811:	0f 88 57 ff ff ff    	js     80076e <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800817:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  80081b:	74 cc                	je     8007e9 <vprintfmt+0x2d9>
+  80081d:	8d 50 e0             	lea    -0x20(%rax),%edx
+  800820:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800825:	80 fa 5e             	cmp    $0x5e,%dl
+  800828:	77 c2                	ja     8007ec <vprintfmt+0x2dc>
+  80082a:	eb bd                	jmp    8007e9 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  80082c:	40 84 f6             	test   %sil,%sil
+  80082f:	75 26                	jne    800857 <vprintfmt+0x347>
+    switch (lflag) {
+  800831:	85 d2                	test   %edx,%edx
+  800833:	74 59                	je     80088e <vprintfmt+0x37e>
+  800835:	83 fa 01             	cmp    $0x1,%edx
+  800838:	74 7b                	je     8008b5 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  80083a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80083d:	83 f8 2f             	cmp    $0x2f,%eax
+  800840:	0f 87 96 00 00 00    	ja     8008dc <vprintfmt+0x3cc>
+  800846:	89 c2                	mov    %eax,%edx
+  800848:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80084c:	83 c0 08             	add    $0x8,%eax
+  80084f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800852:	4c 8b 22             	mov    (%rdx),%r12
+  800855:	eb 17                	jmp    80086e <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  800857:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80085a:	83 f8 2f             	cmp    $0x2f,%eax
+  80085d:	77 21                	ja     800880 <vprintfmt+0x370>
+  80085f:	89 c2                	mov    %eax,%edx
+  800861:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800865:	83 c0 08             	add    $0x8,%eax
+  800868:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80086b:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  80086e:	4d 85 e4             	test   %r12,%r12
+  800871:	78 7a                	js     8008ed <vprintfmt+0x3dd>
+            num = i;
+  800873:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  800876:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  80087b:	e9 50 02 00 00       	jmp    800ad0 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800880:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800884:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800888:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80088c:	eb dd                	jmp    80086b <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  80088e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800891:	83 f8 2f             	cmp    $0x2f,%eax
+  800894:	77 11                	ja     8008a7 <vprintfmt+0x397>
+  800896:	89 c2                	mov    %eax,%edx
+  800898:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80089c:	83 c0 08             	add    $0x8,%eax
+  80089f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008a2:	4c 63 22             	movslq (%rdx),%r12
+  8008a5:	eb c7                	jmp    80086e <vprintfmt+0x35e>
+  8008a7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008ab:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008af:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008b3:	eb ed                	jmp    8008a2 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  8008b5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008b8:	83 f8 2f             	cmp    $0x2f,%eax
+  8008bb:	77 11                	ja     8008ce <vprintfmt+0x3be>
+  8008bd:	89 c2                	mov    %eax,%edx
+  8008bf:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008c3:	83 c0 08             	add    $0x8,%eax
+  8008c6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008c9:	4c 8b 22             	mov    (%rdx),%r12
+  8008cc:	eb a0                	jmp    80086e <vprintfmt+0x35e>
+  8008ce:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008d2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008d6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008da:	eb ed                	jmp    8008c9 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  8008dc:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008e0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008e4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008e8:	e9 65 ff ff ff       	jmp    800852 <vprintfmt+0x342>
+                putch('-', put_arg);
+  8008ed:	4c 89 ee             	mov    %r13,%rsi
+  8008f0:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  8008f5:	41 ff d6             	call   *%r14
+                i = -i;
+  8008f8:	49 f7 dc             	neg    %r12
+  8008fb:	e9 73 ff ff ff       	jmp    800873 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  800900:	40 84 f6             	test   %sil,%sil
+  800903:	75 32                	jne    800937 <vprintfmt+0x427>
+    switch (lflag) {
+  800905:	85 d2                	test   %edx,%edx
+  800907:	74 5d                	je     800966 <vprintfmt+0x456>
+  800909:	83 fa 01             	cmp    $0x1,%edx
+  80090c:	0f 84 82 00 00 00    	je     800994 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  800912:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800915:	83 f8 2f             	cmp    $0x2f,%eax
+  800918:	0f 87 a5 00 00 00    	ja     8009c3 <vprintfmt+0x4b3>
+  80091e:	89 c2                	mov    %eax,%edx
+  800920:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800924:	83 c0 08             	add    $0x8,%eax
+  800927:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80092a:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  80092d:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  800932:	e9 99 01 00 00       	jmp    800ad0 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800937:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80093a:	83 f8 2f             	cmp    $0x2f,%eax
+  80093d:	77 19                	ja     800958 <vprintfmt+0x448>
+  80093f:	89 c2                	mov    %eax,%edx
+  800941:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800945:	83 c0 08             	add    $0x8,%eax
+  800948:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80094b:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  80094e:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800953:	e9 78 01 00 00       	jmp    800ad0 <vprintfmt+0x5c0>
+  800958:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80095c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800960:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800964:	eb e5                	jmp    80094b <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  800966:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800969:	83 f8 2f             	cmp    $0x2f,%eax
+  80096c:	77 18                	ja     800986 <vprintfmt+0x476>
+  80096e:	89 c2                	mov    %eax,%edx
+  800970:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800974:	83 c0 08             	add    $0x8,%eax
+  800977:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80097a:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  80097c:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  800981:	e9 4a 01 00 00       	jmp    800ad0 <vprintfmt+0x5c0>
+  800986:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80098a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80098e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800992:	eb e6                	jmp    80097a <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  800994:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800997:	83 f8 2f             	cmp    $0x2f,%eax
+  80099a:	77 19                	ja     8009b5 <vprintfmt+0x4a5>
+  80099c:	89 c2                	mov    %eax,%edx
+  80099e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009a2:	83 c0 08             	add    $0x8,%eax
+  8009a5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009a8:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8009ab:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  8009b0:	e9 1b 01 00 00       	jmp    800ad0 <vprintfmt+0x5c0>
+  8009b5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009b9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009bd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009c1:	eb e5                	jmp    8009a8 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  8009c3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009c7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009cb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009cf:	e9 56 ff ff ff       	jmp    80092a <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  8009d4:	40 84 f6             	test   %sil,%sil
+  8009d7:	75 2e                	jne    800a07 <vprintfmt+0x4f7>
+    switch (lflag) {
+  8009d9:	85 d2                	test   %edx,%edx
+  8009db:	74 59                	je     800a36 <vprintfmt+0x526>
+  8009dd:	83 fa 01             	cmp    $0x1,%edx
+  8009e0:	74 7f                	je     800a61 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  8009e2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009e5:	83 f8 2f             	cmp    $0x2f,%eax
+  8009e8:	0f 87 9f 00 00 00    	ja     800a8d <vprintfmt+0x57d>
+  8009ee:	89 c2                	mov    %eax,%edx
+  8009f0:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009f4:	83 c0 08             	add    $0x8,%eax
+  8009f7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009fa:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8009fd:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  800a02:	e9 c9 00 00 00       	jmp    800ad0 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800a07:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a0a:	83 f8 2f             	cmp    $0x2f,%eax
+  800a0d:	77 19                	ja     800a28 <vprintfmt+0x518>
+  800a0f:	89 c2                	mov    %eax,%edx
+  800a11:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a15:	83 c0 08             	add    $0x8,%eax
+  800a18:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a1b:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800a1e:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800a23:	e9 a8 00 00 00       	jmp    800ad0 <vprintfmt+0x5c0>
+  800a28:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a2c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a30:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a34:	eb e5                	jmp    800a1b <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  800a36:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a39:	83 f8 2f             	cmp    $0x2f,%eax
+  800a3c:	77 15                	ja     800a53 <vprintfmt+0x543>
+  800a3e:	89 c2                	mov    %eax,%edx
+  800a40:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a44:	83 c0 08             	add    $0x8,%eax
+  800a47:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a4a:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  800a4c:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  800a51:	eb 7d                	jmp    800ad0 <vprintfmt+0x5c0>
+  800a53:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a57:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a5b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a5f:	eb e9                	jmp    800a4a <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  800a61:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a64:	83 f8 2f             	cmp    $0x2f,%eax
+  800a67:	77 16                	ja     800a7f <vprintfmt+0x56f>
+  800a69:	89 c2                	mov    %eax,%edx
+  800a6b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a6f:	83 c0 08             	add    $0x8,%eax
+  800a72:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a75:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800a78:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  800a7d:	eb 51                	jmp    800ad0 <vprintfmt+0x5c0>
+  800a7f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a83:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a87:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a8b:	eb e8                	jmp    800a75 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  800a8d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a91:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a95:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a99:	e9 5c ff ff ff       	jmp    8009fa <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  800a9e:	4c 89 ee             	mov    %r13,%rsi
+  800aa1:	bf 30 00 00 00       	mov    $0x30,%edi
+  800aa6:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800aa9:	4c 89 ee             	mov    %r13,%rsi
+  800aac:	bf 78 00 00 00       	mov    $0x78,%edi
+  800ab1:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800ab4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ab7:	83 f8 2f             	cmp    $0x2f,%eax
+  800aba:	77 47                	ja     800b03 <vprintfmt+0x5f3>
+  800abc:	89 c2                	mov    %eax,%edx
+  800abe:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ac2:	83 c0 08             	add    $0x8,%eax
+  800ac5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ac8:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800acb:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800ad0:	48 83 ec 08          	sub    $0x8,%rsp
+  800ad4:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800ad8:	0f 94 c0             	sete   %al
+  800adb:	0f b6 c0             	movzbl %al,%eax
+  800ade:	50                   	push   %rax
+  800adf:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800ae4:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800ae8:	4c 89 ee             	mov    %r13,%rsi
+  800aeb:	4c 89 f7             	mov    %r14,%rdi
+  800aee:	48 b8 05 04 80 00 00 	movabs $0x800405,%rax
+  800af5:	00 00 00 
+  800af8:	ff d0                	call   *%rax
+            break;
+  800afa:	48 83 c4 10          	add    $0x10,%rsp
+  800afe:	e9 3e fa ff ff       	jmp    800541 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800b03:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b07:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b0b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b0f:	eb b7                	jmp    800ac8 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  800b11:	40 84 f6             	test   %sil,%sil
+  800b14:	75 2b                	jne    800b41 <vprintfmt+0x631>
+    switch (lflag) {
+  800b16:	85 d2                	test   %edx,%edx
+  800b18:	74 56                	je     800b70 <vprintfmt+0x660>
+  800b1a:	83 fa 01             	cmp    $0x1,%edx
+  800b1d:	74 7f                	je     800b9e <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800b1f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b22:	83 f8 2f             	cmp    $0x2f,%eax
+  800b25:	0f 87 a2 00 00 00    	ja     800bcd <vprintfmt+0x6bd>
+  800b2b:	89 c2                	mov    %eax,%edx
+  800b2d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b31:	83 c0 08             	add    $0x8,%eax
+  800b34:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b37:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800b3a:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800b3f:	eb 8f                	jmp    800ad0 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800b41:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b44:	83 f8 2f             	cmp    $0x2f,%eax
+  800b47:	77 19                	ja     800b62 <vprintfmt+0x652>
+  800b49:	89 c2                	mov    %eax,%edx
+  800b4b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b4f:	83 c0 08             	add    $0x8,%eax
+  800b52:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b55:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800b58:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800b5d:	e9 6e ff ff ff       	jmp    800ad0 <vprintfmt+0x5c0>
+  800b62:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b66:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b6a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b6e:	eb e5                	jmp    800b55 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800b70:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b73:	83 f8 2f             	cmp    $0x2f,%eax
+  800b76:	77 18                	ja     800b90 <vprintfmt+0x680>
+  800b78:	89 c2                	mov    %eax,%edx
+  800b7a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b7e:	83 c0 08             	add    $0x8,%eax
+  800b81:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b84:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800b86:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800b8b:	e9 40 ff ff ff       	jmp    800ad0 <vprintfmt+0x5c0>
+  800b90:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b94:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b98:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b9c:	eb e6                	jmp    800b84 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800b9e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ba1:	83 f8 2f             	cmp    $0x2f,%eax
+  800ba4:	77 19                	ja     800bbf <vprintfmt+0x6af>
+  800ba6:	89 c2                	mov    %eax,%edx
+  800ba8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800bac:	83 c0 08             	add    $0x8,%eax
+  800baf:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800bb2:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800bb5:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800bba:	e9 11 ff ff ff       	jmp    800ad0 <vprintfmt+0x5c0>
+  800bbf:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bc3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bc7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bcb:	eb e5                	jmp    800bb2 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800bcd:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bd1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bd5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bd9:	e9 59 ff ff ff       	jmp    800b37 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800bde:	4c 89 ee             	mov    %r13,%rsi
+  800be1:	bf 25 00 00 00       	mov    $0x25,%edi
+  800be6:	41 ff d6             	call   *%r14
+            break;
+  800be9:	e9 53 f9 ff ff       	jmp    800541 <vprintfmt+0x31>
+            putch('%', put_arg);
+  800bee:	4c 89 ee             	mov    %r13,%rsi
+  800bf1:	bf 25 00 00 00       	mov    $0x25,%edi
+  800bf6:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800bf9:	48 83 eb 01          	sub    $0x1,%rbx
+  800bfd:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800c01:	75 f6                	jne    800bf9 <vprintfmt+0x6e9>
+  800c03:	e9 39 f9 ff ff       	jmp    800541 <vprintfmt+0x31>
+}
+  800c08:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800c0c:	5b                   	pop    %rbx
+  800c0d:	41 5c                	pop    %r12
+  800c0f:	41 5d                	pop    %r13
+  800c11:	41 5e                	pop    %r14
+  800c13:	41 5f                	pop    %r15
+  800c15:	5d                   	pop    %rbp
+  800c16:	c3                   	ret
+
+0000000000800c17 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800c17:	55                   	push   %rbp
+  800c18:	48 89 e5             	mov    %rsp,%rbp
+  800c1b:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800c1f:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800c23:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800c28:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800c2c:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800c33:	48 85 ff             	test   %rdi,%rdi
+  800c36:	74 2b                	je     800c63 <vsnprintf+0x4c>
+  800c38:	48 85 f6             	test   %rsi,%rsi
+  800c3b:	74 26                	je     800c63 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800c3d:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800c41:	48 bf bb 04 80 00 00 	movabs $0x8004bb,%rdi
+  800c48:	00 00 00 
+  800c4b:	48 b8 10 05 80 00 00 	movabs $0x800510,%rax
+  800c52:	00 00 00 
+  800c55:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800c57:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800c5b:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800c5e:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800c61:	c9                   	leave
+  800c62:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800c63:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800c68:	eb f7                	jmp    800c61 <vsnprintf+0x4a>
+
+0000000000800c6a <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800c6a:	55                   	push   %rbp
+  800c6b:	48 89 e5             	mov    %rsp,%rbp
+  800c6e:	48 83 ec 50          	sub    $0x50,%rsp
+  800c72:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800c76:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800c7a:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800c7e:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800c85:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800c89:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c8d:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800c91:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800c95:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800c99:	48 b8 17 0c 80 00 00 	movabs $0x800c17,%rax
+  800ca0:	00 00 00 
+  800ca3:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800ca5:	c9                   	leave
+  800ca6:	c3                   	ret
+
+0000000000800ca7 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800ca7:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800caa:	74 10                	je     800cbc <strlen+0x15>
+    size_t n = 0;
+  800cac:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800cb1:	48 83 c0 01          	add    $0x1,%rax
+  800cb5:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800cb9:	75 f6                	jne    800cb1 <strlen+0xa>
+  800cbb:	c3                   	ret
+    size_t n = 0;
+  800cbc:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800cc1:	c3                   	ret
+
+0000000000800cc2 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800cc2:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800cc5:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800cca:	48 85 f6             	test   %rsi,%rsi
+  800ccd:	74 11                	je     800ce0 <strnlen+0x1e>
+  800ccf:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800cd3:	74 0c                	je     800ce1 <strnlen+0x1f>
+  800cd5:	48 83 c2 01          	add    $0x1,%rdx
+  800cd9:	48 39 d0             	cmp    %rdx,%rax
+  800cdc:	75 f1                	jne    800ccf <strnlen+0xd>
+  800cde:	eb 04                	jmp    800ce4 <strnlen+0x22>
+  800ce0:	c3                   	ret
+  800ce1:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800ce4:	c3                   	ret
+
+0000000000800ce5 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800ce5:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800ce8:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ced:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800cf1:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800cf4:	48 83 c2 01          	add    $0x1,%rdx
+  800cf8:	84 c9                	test   %cl,%cl
+  800cfa:	75 f1                	jne    800ced <strcpy+0x8>
+        ;
+    return res;
+}
+  800cfc:	c3                   	ret
+
+0000000000800cfd <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800cfd:	55                   	push   %rbp
+  800cfe:	48 89 e5             	mov    %rsp,%rbp
+  800d01:	41 54                	push   %r12
+  800d03:	53                   	push   %rbx
+  800d04:	48 89 fb             	mov    %rdi,%rbx
+  800d07:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800d0a:	48 b8 a7 0c 80 00 00 	movabs $0x800ca7,%rax
+  800d11:	00 00 00 
+  800d14:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800d16:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800d1a:	4c 89 e6             	mov    %r12,%rsi
+  800d1d:	48 b8 e5 0c 80 00 00 	movabs $0x800ce5,%rax
+  800d24:	00 00 00 
+  800d27:	ff d0                	call   *%rax
+    return dst;
+}
+  800d29:	48 89 d8             	mov    %rbx,%rax
+  800d2c:	5b                   	pop    %rbx
+  800d2d:	41 5c                	pop    %r12
+  800d2f:	5d                   	pop    %rbp
+  800d30:	c3                   	ret
+
+0000000000800d31 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800d31:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800d34:	48 85 d2             	test   %rdx,%rdx
+  800d37:	74 1f                	je     800d58 <strncpy+0x27>
+  800d39:	48 01 fa             	add    %rdi,%rdx
+  800d3c:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800d3f:	48 83 c1 01          	add    $0x1,%rcx
+  800d43:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800d47:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800d4b:	41 80 f8 01          	cmp    $0x1,%r8b
+  800d4f:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800d53:	48 39 ca             	cmp    %rcx,%rdx
+  800d56:	75 e7                	jne    800d3f <strncpy+0xe>
+    }
+    return ret;
+}
+  800d58:	c3                   	ret
+
+0000000000800d59 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800d59:	48 89 f8             	mov    %rdi,%rax
+  800d5c:	48 85 d2             	test   %rdx,%rdx
+  800d5f:	74 24                	je     800d85 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800d61:	48 83 ea 01          	sub    $0x1,%rdx
+  800d65:	74 1b                	je     800d82 <strlcpy+0x29>
+  800d67:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800d6b:	0f b6 16             	movzbl (%rsi),%edx
+  800d6e:	84 d2                	test   %dl,%dl
+  800d70:	74 10                	je     800d82 <strlcpy+0x29>
+            *dst++ = *src++;
+  800d72:	48 83 c6 01          	add    $0x1,%rsi
+  800d76:	48 83 c0 01          	add    $0x1,%rax
+  800d7a:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800d7d:	48 39 c8             	cmp    %rcx,%rax
+  800d80:	75 e9                	jne    800d6b <strlcpy+0x12>
+        *dst = '\0';
+  800d82:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800d85:	48 29 f8             	sub    %rdi,%rax
+}
+  800d88:	c3                   	ret
+
+0000000000800d89 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800d89:	0f b6 07             	movzbl (%rdi),%eax
+  800d8c:	84 c0                	test   %al,%al
+  800d8e:	74 13                	je     800da3 <strcmp+0x1a>
+  800d90:	38 06                	cmp    %al,(%rsi)
+  800d92:	75 0f                	jne    800da3 <strcmp+0x1a>
+  800d94:	48 83 c7 01          	add    $0x1,%rdi
+  800d98:	48 83 c6 01          	add    $0x1,%rsi
+  800d9c:	0f b6 07             	movzbl (%rdi),%eax
+  800d9f:	84 c0                	test   %al,%al
+  800da1:	75 ed                	jne    800d90 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800da3:	0f b6 c0             	movzbl %al,%eax
+  800da6:	0f b6 16             	movzbl (%rsi),%edx
+  800da9:	29 d0                	sub    %edx,%eax
+}
+  800dab:	c3                   	ret
+
+0000000000800dac <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800dac:	48 85 d2             	test   %rdx,%rdx
+  800daf:	74 1f                	je     800dd0 <strncmp+0x24>
+  800db1:	0f b6 07             	movzbl (%rdi),%eax
+  800db4:	84 c0                	test   %al,%al
+  800db6:	74 1e                	je     800dd6 <strncmp+0x2a>
+  800db8:	3a 06                	cmp    (%rsi),%al
+  800dba:	75 1a                	jne    800dd6 <strncmp+0x2a>
+  800dbc:	48 83 c7 01          	add    $0x1,%rdi
+  800dc0:	48 83 c6 01          	add    $0x1,%rsi
+  800dc4:	48 83 ea 01          	sub    $0x1,%rdx
+  800dc8:	75 e7                	jne    800db1 <strncmp+0x5>
+
+    if (!n) return 0;
+  800dca:	b8 00 00 00 00       	mov    $0x0,%eax
+  800dcf:	c3                   	ret
+  800dd0:	b8 00 00 00 00       	mov    $0x0,%eax
+  800dd5:	c3                   	ret
+  800dd6:	48 85 d2             	test   %rdx,%rdx
+  800dd9:	74 09                	je     800de4 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800ddb:	0f b6 07             	movzbl (%rdi),%eax
+  800dde:	0f b6 16             	movzbl (%rsi),%edx
+  800de1:	29 d0                	sub    %edx,%eax
+  800de3:	c3                   	ret
+    if (!n) return 0;
+  800de4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800de9:	c3                   	ret
+
+0000000000800dea <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800dea:	0f b6 17             	movzbl (%rdi),%edx
+  800ded:	84 d2                	test   %dl,%dl
+  800def:	74 18                	je     800e09 <strchr+0x1f>
+        if (*str == c) {
+  800df1:	0f be d2             	movsbl %dl,%edx
+  800df4:	39 f2                	cmp    %esi,%edx
+  800df6:	74 17                	je     800e0f <strchr+0x25>
+    for (; *str; str++) {
+  800df8:	48 83 c7 01          	add    $0x1,%rdi
+  800dfc:	0f b6 17             	movzbl (%rdi),%edx
+  800dff:	84 d2                	test   %dl,%dl
+  800e01:	75 ee                	jne    800df1 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800e03:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e08:	c3                   	ret
+  800e09:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e0e:	c3                   	ret
+  800e0f:	48 89 f8             	mov    %rdi,%rax
+}
+  800e12:	c3                   	ret
+
+0000000000800e13 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800e13:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800e16:	0f b6 17             	movzbl (%rdi),%edx
+  800e19:	84 d2                	test   %dl,%dl
+  800e1b:	74 13                	je     800e30 <strfind+0x1d>
+  800e1d:	0f be d2             	movsbl %dl,%edx
+  800e20:	39 f2                	cmp    %esi,%edx
+  800e22:	74 0b                	je     800e2f <strfind+0x1c>
+  800e24:	48 83 c0 01          	add    $0x1,%rax
+  800e28:	0f b6 10             	movzbl (%rax),%edx
+  800e2b:	84 d2                	test   %dl,%dl
+  800e2d:	75 ee                	jne    800e1d <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800e2f:	c3                   	ret
+  800e30:	c3                   	ret
+
+0000000000800e31 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800e31:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800e34:	48 89 f8             	mov    %rdi,%rax
+  800e37:	48 f7 d8             	neg    %rax
+  800e3a:	83 e0 07             	and    $0x7,%eax
+  800e3d:	49 89 d1             	mov    %rdx,%r9
+  800e40:	49 29 c1             	sub    %rax,%r9
+  800e43:	78 36                	js     800e7b <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800e45:	40 0f b6 c6          	movzbl %sil,%eax
+  800e49:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800e50:	01 01 01 
+  800e53:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800e57:	40 f6 c7 07          	test   $0x7,%dil
+  800e5b:	75 38                	jne    800e95 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800e5d:	4c 89 c9             	mov    %r9,%rcx
+  800e60:	48 c1 f9 03          	sar    $0x3,%rcx
+  800e64:	74 0c                	je     800e72 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800e66:	fc                   	cld
+  800e67:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800e6a:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800e6e:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800e72:	4d 85 c9             	test   %r9,%r9
+  800e75:	75 45                	jne    800ebc <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800e77:	4c 89 c0             	mov    %r8,%rax
+  800e7a:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800e7b:	48 85 d2             	test   %rdx,%rdx
+  800e7e:	74 f7                	je     800e77 <memset+0x46>
+  800e80:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800e83:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800e86:	48 83 c0 01          	add    $0x1,%rax
+  800e8a:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  800e8e:	48 39 c2             	cmp    %rax,%rdx
+  800e91:	75 f3                	jne    800e86 <memset+0x55>
+  800e93:	eb e2                	jmp    800e77 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  800e95:	40 f6 c7 01          	test   $0x1,%dil
+  800e99:	74 06                	je     800ea1 <memset+0x70>
+  800e9b:	88 07                	mov    %al,(%rdi)
+  800e9d:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800ea1:	40 f6 c7 02          	test   $0x2,%dil
+  800ea5:	74 07                	je     800eae <memset+0x7d>
+  800ea7:	66 89 07             	mov    %ax,(%rdi)
+  800eaa:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800eae:	40 f6 c7 04          	test   $0x4,%dil
+  800eb2:	74 a9                	je     800e5d <memset+0x2c>
+  800eb4:	89 07                	mov    %eax,(%rdi)
+  800eb6:	48 83 c7 04          	add    $0x4,%rdi
+  800eba:	eb a1                	jmp    800e5d <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800ebc:	41 f6 c1 04          	test   $0x4,%r9b
+  800ec0:	74 06                	je     800ec8 <memset+0x97>
+  800ec2:	89 07                	mov    %eax,(%rdi)
+  800ec4:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800ec8:	41 f6 c1 02          	test   $0x2,%r9b
+  800ecc:	74 07                	je     800ed5 <memset+0xa4>
+  800ece:	66 89 07             	mov    %ax,(%rdi)
+  800ed1:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  800ed5:	41 f6 c1 01          	test   $0x1,%r9b
+  800ed9:	74 9c                	je     800e77 <memset+0x46>
+  800edb:	88 07                	mov    %al,(%rdi)
+  800edd:	eb 98                	jmp    800e77 <memset+0x46>
+
+0000000000800edf <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  800edf:	48 89 f8             	mov    %rdi,%rax
+  800ee2:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  800ee5:	48 39 fe             	cmp    %rdi,%rsi
+  800ee8:	73 3b                	jae    800f25 <memmove+0x46>
+  800eea:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  800eee:	48 39 d7             	cmp    %rdx,%rdi
+  800ef1:	73 32                	jae    800f25 <memmove+0x46>
+        s += n;
+        d += n;
+  800ef3:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800ef7:	48 89 d6             	mov    %rdx,%rsi
+  800efa:	48 09 fe             	or     %rdi,%rsi
+  800efd:	48 09 ce             	or     %rcx,%rsi
+  800f00:	40 f6 c6 07          	test   $0x7,%sil
+  800f04:	75 12                	jne    800f18 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  800f06:	48 83 ef 08          	sub    $0x8,%rdi
+  800f0a:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  800f0e:	48 c1 e9 03          	shr    $0x3,%rcx
+  800f12:	fd                   	std
+  800f13:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  800f16:	fc                   	cld
+  800f17:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  800f18:	48 83 ef 01          	sub    $0x1,%rdi
+  800f1c:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  800f20:	fd                   	std
+  800f21:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  800f23:	eb f1                	jmp    800f16 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800f25:	48 89 f2             	mov    %rsi,%rdx
+  800f28:	48 09 c2             	or     %rax,%rdx
+  800f2b:	48 09 ca             	or     %rcx,%rdx
+  800f2e:	f6 c2 07             	test   $0x7,%dl
+  800f31:	75 0c                	jne    800f3f <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  800f33:	48 c1 e9 03          	shr    $0x3,%rcx
+  800f37:	48 89 c7             	mov    %rax,%rdi
+  800f3a:	fc                   	cld
+  800f3b:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  800f3e:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  800f3f:	48 89 c7             	mov    %rax,%rdi
+  800f42:	fc                   	cld
+  800f43:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  800f45:	c3                   	ret
+
+0000000000800f46 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  800f46:	55                   	push   %rbp
+  800f47:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  800f4a:	48 b8 df 0e 80 00 00 	movabs $0x800edf,%rax
+  800f51:	00 00 00 
+  800f54:	ff d0                	call   *%rax
+}
+  800f56:	5d                   	pop    %rbp
+  800f57:	c3                   	ret
+
+0000000000800f58 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  800f58:	55                   	push   %rbp
+  800f59:	48 89 e5             	mov    %rsp,%rbp
+  800f5c:	41 57                	push   %r15
+  800f5e:	41 56                	push   %r14
+  800f60:	41 55                	push   %r13
+  800f62:	41 54                	push   %r12
+  800f64:	53                   	push   %rbx
+  800f65:	48 83 ec 08          	sub    $0x8,%rsp
+  800f69:	49 89 fe             	mov    %rdi,%r14
+  800f6c:	49 89 f7             	mov    %rsi,%r15
+  800f6f:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  800f72:	48 89 f7             	mov    %rsi,%rdi
+  800f75:	48 b8 a7 0c 80 00 00 	movabs $0x800ca7,%rax
+  800f7c:	00 00 00 
+  800f7f:	ff d0                	call   *%rax
+  800f81:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  800f84:	48 89 de             	mov    %rbx,%rsi
+  800f87:	4c 89 f7             	mov    %r14,%rdi
+  800f8a:	48 b8 c2 0c 80 00 00 	movabs $0x800cc2,%rax
+  800f91:	00 00 00 
+  800f94:	ff d0                	call   *%rax
+  800f96:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  800f99:	48 39 c3             	cmp    %rax,%rbx
+  800f9c:	74 36                	je     800fd4 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  800f9e:	48 89 d8             	mov    %rbx,%rax
+  800fa1:	4c 29 e8             	sub    %r13,%rax
+  800fa4:	49 39 c4             	cmp    %rax,%r12
+  800fa7:	73 31                	jae    800fda <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  800fa9:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  800fae:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800fb2:	4c 89 fe             	mov    %r15,%rsi
+  800fb5:	48 b8 46 0f 80 00 00 	movabs $0x800f46,%rax
+  800fbc:	00 00 00 
+  800fbf:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  800fc1:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  800fc5:	48 83 c4 08          	add    $0x8,%rsp
+  800fc9:	5b                   	pop    %rbx
+  800fca:	41 5c                	pop    %r12
+  800fcc:	41 5d                	pop    %r13
+  800fce:	41 5e                	pop    %r14
+  800fd0:	41 5f                	pop    %r15
+  800fd2:	5d                   	pop    %rbp
+  800fd3:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  800fd4:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800fd8:	eb eb                	jmp    800fc5 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  800fda:	48 83 eb 01          	sub    $0x1,%rbx
+  800fde:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800fe2:	48 89 da             	mov    %rbx,%rdx
+  800fe5:	4c 89 fe             	mov    %r15,%rsi
+  800fe8:	48 b8 46 0f 80 00 00 	movabs $0x800f46,%rax
+  800fef:	00 00 00 
+  800ff2:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  800ff4:	49 01 de             	add    %rbx,%r14
+  800ff7:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  800ffc:	eb c3                	jmp    800fc1 <strlcat+0x69>
+
+0000000000800ffe <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  800ffe:	48 85 d2             	test   %rdx,%rdx
+  801001:	74 2d                	je     801030 <memcmp+0x32>
+  801003:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  801008:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  80100c:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  801011:	44 38 c1             	cmp    %r8b,%cl
+  801014:	75 0f                	jne    801025 <memcmp+0x27>
+    while (n-- > 0) {
+  801016:	48 83 c0 01          	add    $0x1,%rax
+  80101a:	48 39 c2             	cmp    %rax,%rdx
+  80101d:	75 e9                	jne    801008 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  80101f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801024:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  801025:	0f b6 c1             	movzbl %cl,%eax
+  801028:	45 0f b6 c0          	movzbl %r8b,%r8d
+  80102c:	44 29 c0             	sub    %r8d,%eax
+  80102f:	c3                   	ret
+    return 0;
+  801030:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801035:	c3                   	ret
+
+0000000000801036 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  801036:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  80103a:	48 39 c7             	cmp    %rax,%rdi
+  80103d:	73 0f                	jae    80104e <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  80103f:	40 38 37             	cmp    %sil,(%rdi)
+  801042:	74 0e                	je     801052 <memfind+0x1c>
+    for (; src < end; src++) {
+  801044:	48 83 c7 01          	add    $0x1,%rdi
+  801048:	48 39 f8             	cmp    %rdi,%rax
+  80104b:	75 f2                	jne    80103f <memfind+0x9>
+  80104d:	c3                   	ret
+  80104e:	48 89 f8             	mov    %rdi,%rax
+  801051:	c3                   	ret
+  801052:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  801055:	c3                   	ret
+
+0000000000801056 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  801056:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  801059:	0f b6 37             	movzbl (%rdi),%esi
+  80105c:	40 80 fe 20          	cmp    $0x20,%sil
+  801060:	74 06                	je     801068 <strtol+0x12>
+  801062:	40 80 fe 09          	cmp    $0x9,%sil
+  801066:	75 13                	jne    80107b <strtol+0x25>
+  801068:	48 83 c7 01          	add    $0x1,%rdi
+  80106c:	0f b6 37             	movzbl (%rdi),%esi
+  80106f:	40 80 fe 20          	cmp    $0x20,%sil
+  801073:	74 f3                	je     801068 <strtol+0x12>
+  801075:	40 80 fe 09          	cmp    $0x9,%sil
+  801079:	74 ed                	je     801068 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  80107b:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  80107e:	83 e0 fd             	and    $0xfffffffd,%eax
+  801081:	3c 01                	cmp    $0x1,%al
+  801083:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801087:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  80108d:	75 0f                	jne    80109e <strtol+0x48>
+  80108f:	80 3f 30             	cmpb   $0x30,(%rdi)
+  801092:	74 14                	je     8010a8 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  801094:	85 d2                	test   %edx,%edx
+  801096:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80109b:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  80109e:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  8010a3:	4c 63 ca             	movslq %edx,%r9
+  8010a6:	eb 36                	jmp    8010de <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8010a8:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  8010ac:	74 0f                	je     8010bd <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  8010ae:	85 d2                	test   %edx,%edx
+  8010b0:	75 ec                	jne    80109e <strtol+0x48>
+        s++;
+  8010b2:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  8010b6:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  8010bb:	eb e1                	jmp    80109e <strtol+0x48>
+        s += 2;
+  8010bd:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  8010c1:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  8010c6:	eb d6                	jmp    80109e <strtol+0x48>
+            dig -= '0';
+  8010c8:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  8010cb:	44 0f b6 c1          	movzbl %cl,%r8d
+  8010cf:	41 39 d0             	cmp    %edx,%r8d
+  8010d2:	7d 21                	jge    8010f5 <strtol+0x9f>
+        val = val * base + dig;
+  8010d4:	49 0f af c1          	imul   %r9,%rax
+  8010d8:	0f b6 c9             	movzbl %cl,%ecx
+  8010db:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  8010de:	48 83 c7 01          	add    $0x1,%rdi
+  8010e2:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  8010e6:	80 f9 39             	cmp    $0x39,%cl
+  8010e9:	76 dd                	jbe    8010c8 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  8010eb:	80 f9 7b             	cmp    $0x7b,%cl
+  8010ee:	77 05                	ja     8010f5 <strtol+0x9f>
+            dig -= 'a' - 10;
+  8010f0:	83 e9 57             	sub    $0x57,%ecx
+  8010f3:	eb d6                	jmp    8010cb <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  8010f5:	4d 85 d2             	test   %r10,%r10
+  8010f8:	74 03                	je     8010fd <strtol+0xa7>
+  8010fa:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  8010fd:	48 89 c2             	mov    %rax,%rdx
+  801100:	48 f7 da             	neg    %rdx
+  801103:	40 80 fe 2d          	cmp    $0x2d,%sil
+  801107:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  80110b:	c3                   	ret
+
+000000000080110c <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  80110c:	55                   	push   %rbp
+  80110d:	48 89 e5             	mov    %rsp,%rbp
+  801110:	53                   	push   %rbx
+  801111:	48 89 fa             	mov    %rdi,%rdx
+  801114:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801117:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80111c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801121:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801126:	be 00 00 00 00       	mov    $0x0,%esi
+  80112b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801131:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  801133:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801137:	c9                   	leave
+  801138:	c3                   	ret
+
+0000000000801139 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  801139:	55                   	push   %rbp
+  80113a:	48 89 e5             	mov    %rsp,%rbp
+  80113d:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80113e:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801143:	ba 00 00 00 00       	mov    $0x0,%edx
+  801148:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80114d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801152:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801157:	be 00 00 00 00       	mov    $0x0,%esi
+  80115c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801162:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  801164:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801168:	c9                   	leave
+  801169:	c3                   	ret
+
+000000000080116a <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  80116a:	55                   	push   %rbp
+  80116b:	48 89 e5             	mov    %rsp,%rbp
+  80116e:	53                   	push   %rbx
+  80116f:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  801173:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801176:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80117b:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801180:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801185:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80118a:	be 00 00 00 00       	mov    $0x0,%esi
+  80118f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801195:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801197:	48 85 c0             	test   %rax,%rax
+  80119a:	7f 06                	jg     8011a2 <sys_env_destroy+0x38>
+}
+  80119c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8011a0:	c9                   	leave
+  8011a1:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8011a2:	49 89 c0             	mov    %rax,%r8
+  8011a5:	b9 03 00 00 00       	mov    $0x3,%ecx
+  8011aa:	48 ba d0 33 80 00 00 	movabs $0x8033d0,%rdx
+  8011b1:	00 00 00 
+  8011b4:	be 26 00 00 00       	mov    $0x26,%esi
+  8011b9:	48 bf ef 33 80 00 00 	movabs $0x8033ef,%rdi
+  8011c0:	00 00 00 
+  8011c3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011c8:	49 b9 70 02 80 00 00 	movabs $0x800270,%r9
+  8011cf:	00 00 00 
+  8011d2:	41 ff d1             	call   *%r9
+
+00000000008011d5 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  8011d5:	55                   	push   %rbp
+  8011d6:	48 89 e5             	mov    %rsp,%rbp
+  8011d9:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8011da:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8011df:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011e4:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8011e9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011ee:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8011f3:	be 00 00 00 00       	mov    $0x0,%esi
+  8011f8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8011fe:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  801200:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801204:	c9                   	leave
+  801205:	c3                   	ret
+
+0000000000801206 <sys_yield>:
+
+void
+sys_yield(void) {
+  801206:	55                   	push   %rbp
+  801207:	48 89 e5             	mov    %rsp,%rbp
+  80120a:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80120b:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801210:	ba 00 00 00 00       	mov    $0x0,%edx
+  801215:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80121a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80121f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801224:	be 00 00 00 00       	mov    $0x0,%esi
+  801229:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80122f:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  801231:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801235:	c9                   	leave
+  801236:	c3                   	ret
+
+0000000000801237 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  801237:	55                   	push   %rbp
+  801238:	48 89 e5             	mov    %rsp,%rbp
+  80123b:	53                   	push   %rbx
+  80123c:	48 89 fa             	mov    %rdi,%rdx
+  80123f:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801242:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801247:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  80124e:	00 00 00 
+  801251:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801256:	be 00 00 00 00       	mov    $0x0,%esi
+  80125b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801261:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  801263:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801267:	c9                   	leave
+  801268:	c3                   	ret
+
+0000000000801269 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  801269:	55                   	push   %rbp
+  80126a:	48 89 e5             	mov    %rsp,%rbp
+  80126d:	53                   	push   %rbx
+  80126e:	49 89 f8             	mov    %rdi,%r8
+  801271:	48 89 d3             	mov    %rdx,%rbx
+  801274:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801277:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80127c:	4c 89 c2             	mov    %r8,%rdx
+  80127f:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801282:	be 00 00 00 00       	mov    $0x0,%esi
+  801287:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80128d:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  80128f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801293:	c9                   	leave
+  801294:	c3                   	ret
+
+0000000000801295 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  801295:	55                   	push   %rbp
+  801296:	48 89 e5             	mov    %rsp,%rbp
+  801299:	53                   	push   %rbx
+  80129a:	48 83 ec 08          	sub    $0x8,%rsp
+  80129e:	89 f8                	mov    %edi,%eax
+  8012a0:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  8012a3:	48 63 f9             	movslq %ecx,%rdi
+  8012a6:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8012a9:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8012ae:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012b1:	be 00 00 00 00       	mov    $0x0,%esi
+  8012b6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8012bc:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8012be:	48 85 c0             	test   %rax,%rax
+  8012c1:	7f 06                	jg     8012c9 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  8012c3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012c7:	c9                   	leave
+  8012c8:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8012c9:	49 89 c0             	mov    %rax,%r8
+  8012cc:	b9 04 00 00 00       	mov    $0x4,%ecx
+  8012d1:	48 ba d0 33 80 00 00 	movabs $0x8033d0,%rdx
+  8012d8:	00 00 00 
+  8012db:	be 26 00 00 00       	mov    $0x26,%esi
+  8012e0:	48 bf ef 33 80 00 00 	movabs $0x8033ef,%rdi
+  8012e7:	00 00 00 
+  8012ea:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012ef:	49 b9 70 02 80 00 00 	movabs $0x800270,%r9
+  8012f6:	00 00 00 
+  8012f9:	41 ff d1             	call   *%r9
+
+00000000008012fc <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8012fc:	55                   	push   %rbp
+  8012fd:	48 89 e5             	mov    %rsp,%rbp
+  801300:	53                   	push   %rbx
+  801301:	48 83 ec 08          	sub    $0x8,%rsp
+  801305:	89 f8                	mov    %edi,%eax
+  801307:	49 89 f2             	mov    %rsi,%r10
+  80130a:	48 89 cf             	mov    %rcx,%rdi
+  80130d:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  801310:	48 63 da             	movslq %edx,%rbx
+  801313:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801316:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80131b:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80131e:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  801321:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801323:	48 85 c0             	test   %rax,%rax
+  801326:	7f 06                	jg     80132e <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  801328:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80132c:	c9                   	leave
+  80132d:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80132e:	49 89 c0             	mov    %rax,%r8
+  801331:	b9 05 00 00 00       	mov    $0x5,%ecx
+  801336:	48 ba d0 33 80 00 00 	movabs $0x8033d0,%rdx
+  80133d:	00 00 00 
+  801340:	be 26 00 00 00       	mov    $0x26,%esi
+  801345:	48 bf ef 33 80 00 00 	movabs $0x8033ef,%rdi
+  80134c:	00 00 00 
+  80134f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801354:	49 b9 70 02 80 00 00 	movabs $0x800270,%r9
+  80135b:	00 00 00 
+  80135e:	41 ff d1             	call   *%r9
+
+0000000000801361 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  801361:	55                   	push   %rbp
+  801362:	48 89 e5             	mov    %rsp,%rbp
+  801365:	53                   	push   %rbx
+  801366:	48 83 ec 08          	sub    $0x8,%rsp
+  80136a:	48 89 f1             	mov    %rsi,%rcx
+  80136d:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  801370:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801373:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801378:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80137d:	be 00 00 00 00       	mov    $0x0,%esi
+  801382:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801388:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80138a:	48 85 c0             	test   %rax,%rax
+  80138d:	7f 06                	jg     801395 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  80138f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801393:	c9                   	leave
+  801394:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801395:	49 89 c0             	mov    %rax,%r8
+  801398:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80139d:	48 ba d0 33 80 00 00 	movabs $0x8033d0,%rdx
+  8013a4:	00 00 00 
+  8013a7:	be 26 00 00 00       	mov    $0x26,%esi
+  8013ac:	48 bf ef 33 80 00 00 	movabs $0x8033ef,%rdi
+  8013b3:	00 00 00 
+  8013b6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013bb:	49 b9 70 02 80 00 00 	movabs $0x800270,%r9
+  8013c2:	00 00 00 
+  8013c5:	41 ff d1             	call   *%r9
+
+00000000008013c8 <sys_region_batch>:
+
+int
+sys_region_batch(const struct RegionOp *ops, size_t count) {
+  8013c8:	55                   	push   %rbp
+  8013c9:	48 89 e5             	mov    %rsp,%rbp
+  8013cc:	53                   	push   %rbx
+  8013cd:	48 83 ec 08          	sub    $0x8,%rsp
+  8013d1:	48 89 fa             	mov    %rdi,%rdx
+  8013d4:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8013d7:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8013dc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013e1:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013e6:	be 00 00 00 00       	mov    $0x0,%esi
+  8013eb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013f1:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8013f3:	48 85 c0             	test   %rax,%rax
+  8013f6:	7f 06                	jg     8013fe <sys_region_batch+0x36>
+        else
+            platform_asan_unpoison(va, ops[i].size);
+    }
+#endif
+    return res;
+}
+  8013f8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013fc:	c9                   	leave
+  8013fd:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8013fe:	49 89 c0             	mov    %rax,%r8
+  801401:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  801406:	48 ba d0 33 80 00 00 	movabs $0x8033d0,%rdx
+  80140d:	00 00 00 
+  801410:	be 26 00 00 00       	mov    $0x26,%esi
+  801415:	48 bf ef 33 80 00 00 	movabs $0x8033ef,%rdi
+  80141c:	00 00 00 
+  80141f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801424:	49 b9 70 02 80 00 00 	movabs $0x800270,%r9
+  80142b:	00 00 00 
+  80142e:	41 ff d1             	call   *%r9
+
+0000000000801431 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  801431:	55                   	push   %rbp
+  801432:	48 89 e5             	mov    %rsp,%rbp
+  801435:	53                   	push   %rbx
+  801436:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  80143a:	48 63 ce             	movslq %esi,%rcx
+  80143d:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801440:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801445:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80144a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80144f:	be 00 00 00 00       	mov    $0x0,%esi
+  801454:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80145a:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80145c:	48 85 c0             	test   %rax,%rax
+  80145f:	7f 06                	jg     801467 <sys_env_set_status+0x36>
+}
+  801461:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801465:	c9                   	leave
+  801466:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801467:	49 89 c0             	mov    %rax,%r8
+  80146a:	b9 09 00 00 00       	mov    $0x9,%ecx
+  80146f:	48 ba d0 33 80 00 00 	movabs $0x8033d0,%rdx
+  801476:	00 00 00 
+  801479:	be 26 00 00 00       	mov    $0x26,%esi
+  80147e:	48 bf ef 33 80 00 00 	movabs $0x8033ef,%rdi
+  801485:	00 00 00 
+  801488:	b8 00 00 00 00       	mov    $0x0,%eax
+  80148d:	49 b9 70 02 80 00 00 	movabs $0x800270,%r9
+  801494:	00 00 00 
+  801497:	41 ff d1             	call   *%r9
+
+000000000080149a <sys_env_set_weight>:
+
+int
+sys_env_set_weight(envid_t envid, uint32_t weight) {
+  80149a:	55                   	push   %rbp
+  80149b:	48 89 e5             	mov    %rsp,%rbp
+  80149e:	53                   	push   %rbx
+  80149f:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_weight, 1, envid, weight, 0, 0, 0, 0);
+  8014a3:	89 f1                	mov    %esi,%ecx
+  8014a5:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8014a8:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8014ad:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014b2:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014b7:	be 00 00 00 00       	mov    $0x0,%esi
+  8014bc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014c2:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8014c4:	48 85 c0             	test   %rax,%rax
+  8014c7:	7f 06                	jg     8014cf <sys_env_set_weight+0x35>
+}
+  8014c9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014cd:	c9                   	leave
+  8014ce:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8014cf:	49 89 c0             	mov    %rax,%r8
+  8014d2:	b9 10 00 00 00       	mov    $0x10,%ecx
+  8014d7:	48 ba d0 33 80 00 00 	movabs $0x8033d0,%rdx
+  8014de:	00 00 00 
+  8014e1:	be 26 00 00 00       	mov    $0x26,%esi
+  8014e6:	48 bf ef 33 80 00 00 	movabs $0x8033ef,%rdi
+  8014ed:	00 00 00 
+  8014f0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014f5:	49 b9 70 02 80 00 00 	movabs $0x800270,%r9
+  8014fc:	00 00 00 
+  8014ff:	41 ff d1             	call   *%r9
+
+0000000000801502 <sys_env_set_rt>:
+
+int
+sys_env_set_rt(envid_t envid, uint64_t period, uint64_t budget, uint64_t deadline) {
+  801502:	55                   	push   %rbp
+  801503:	48 89 e5             	mov    %rsp,%rbp
+  801506:	53                   	push   %rbx
+  801507:	48 83 ec 08          	sub    $0x8,%rsp
+  80150b:	89 f8                	mov    %edi,%eax
+  80150d:	48 89 d3             	mov    %rdx,%rbx
+  801510:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_env_set_rt, 1, envid, period, budget, deadline, 0, 0);
+  801513:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801516:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80151b:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80151e:	be 00 00 00 00       	mov    $0x0,%esi
+  801523:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801529:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80152b:	48 85 c0             	test   %rax,%rax
+  80152e:	7f 06                	jg     801536 <sys_env_set_rt+0x34>
+}
+  801530:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801534:	c9                   	leave
+  801535:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801536:	49 89 c0             	mov    %rax,%r8
+  801539:	b9 11 00 00 00       	mov    $0x11,%ecx
+  80153e:	48 ba d0 33 80 00 00 	movabs $0x8033d0,%rdx
+  801545:	00 00 00 
+  801548:	be 26 00 00 00       	mov    $0x26,%esi
+  80154d:	48 bf ef 33 80 00 00 	movabs $0x8033ef,%rdi
+  801554:	00 00 00 
+  801557:	b8 00 00 00 00       	mov    $0x0,%eax
+  80155c:	49 b9 70 02 80 00 00 	movabs $0x800270,%r9
+  801563:	00 00 00 
+  801566:	41 ff d1             	call   *%r9
+
+0000000000801569 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  801569:	55                   	push   %rbp
+  80156a:	48 89 e5             	mov    %rsp,%rbp
+  80156d:	53                   	push   %rbx
+  80156e:	48 83 ec 08          	sub    $0x8,%rsp
+  801572:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  801575:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801578:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80157d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801582:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801587:	be 00 00 00 00       	mov    $0x0,%esi
+  80158c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801592:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801594:	48 85 c0             	test   %rax,%rax
+  801597:	7f 06                	jg     80159f <sys_env_set_trapframe+0x36>
+}
+  801599:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80159d:	c9                   	leave
+  80159e:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80159f:	49 89 c0             	mov    %rax,%r8
+  8015a2:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  8015a7:	48 ba d0 33 80 00 00 	movabs $0x8033d0,%rdx
+  8015ae:	00 00 00 
+  8015b1:	be 26 00 00 00       	mov    $0x26,%esi
+  8015b6:	48 bf ef 33 80 00 00 	movabs $0x8033ef,%rdi
+  8015bd:	00 00 00 
+  8015c0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015c5:	49 b9 70 02 80 00 00 	movabs $0x800270,%r9
+  8015cc:	00 00 00 
+  8015cf:	41 ff d1             	call   *%r9
+
+00000000008015d2 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  8015d2:	55                   	push   %rbp
+  8015d3:	48 89 e5             	mov    %rsp,%rbp
+  8015d6:	53                   	push   %rbx
+  8015d7:	48 83 ec 08          	sub    $0x8,%rsp
+  8015db:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  8015de:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8015e1:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8015e6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015eb:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015f0:	be 00 00 00 00       	mov    $0x0,%esi
+  8015f5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015fb:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8015fd:	48 85 c0             	test   %rax,%rax
+  801600:	7f 06                	jg     801608 <sys_env_set_pgfault_upcall+0x36>
+}
+  801602:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801606:	c9                   	leave
+  801607:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801608:	49 89 c0             	mov    %rax,%r8
+  80160b:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  801610:	48 ba d0 33 80 00 00 	movabs $0x8033d0,%rdx
+  801617:	00 00 00 
+  80161a:	be 26 00 00 00       	mov    $0x26,%esi
+  80161f:	48 bf ef 33 80 00 00 	movabs $0x8033ef,%rdi
+  801626:	00 00 00 
+  801629:	b8 00 00 00 00       	mov    $0x0,%eax
+  80162e:	49 b9 70 02 80 00 00 	movabs $0x800270,%r9
+  801635:	00 00 00 
+  801638:	41 ff d1             	call   *%r9
+
+000000000080163b <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  80163b:	55                   	push   %rbp
+  80163c:	48 89 e5             	mov    %rsp,%rbp
+  80163f:	53                   	push   %rbx
+  801640:	89 f8                	mov    %edi,%eax
+  801642:	49 89 f1             	mov    %rsi,%r9
+  801645:	48 89 d3             	mov    %rdx,%rbx
+  801648:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  80164b:	49 63 f0             	movslq %r8d,%rsi
+  80164e:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801651:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801656:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801659:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80165f:	cd 30                	int    $0x30
+}
+  801661:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801665:	c9                   	leave
+  801666:	c3                   	ret
+
+0000000000801667 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  801667:	55                   	push   %rbp
+  801668:	48 89 e5             	mov    %rsp,%rbp
+  80166b:	53                   	push   %rbx
+  80166c:	48 83 ec 08          	sub    $0x8,%rsp
+  801670:	48 89 fa             	mov    %rdi,%rdx
+  801673:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801676:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80167b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801680:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801685:	be 00 00 00 00       	mov    $0x0,%esi
+  80168a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801690:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801692:	48 85 c0             	test   %rax,%rax
+  801695:	7f 06                	jg     80169d <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801697:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80169b:	c9                   	leave
+  80169c:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80169d:	49 89 c0             	mov    %rax,%r8
+  8016a0:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  8016a5:	48 ba d0 33 80 00 00 	movabs $0x8033d0,%rdx
+  8016ac:	00 00 00 
+  8016af:	be 26 00 00 00       	mov    $0x26,%esi
+  8016b4:	48 bf ef 33 80 00 00 	movabs $0x8033ef,%rdi
+  8016bb:	00 00 00 
+  8016be:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016c3:	49 b9 70 02 80 00 00 	movabs $0x800270,%r9
+  8016ca:	00 00 00 
+  8016cd:	41 ff d1             	call   *%r9
+
+00000000008016d0 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8016d0:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8016d7:	ff ff ff 
+  8016da:	48 01 f8             	add    %rdi,%rax
+  8016dd:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  8016e1:	c3                   	ret
+
+00000000008016e2 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8016e2:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8016e9:	ff ff ff 
+  8016ec:	48 01 f8             	add    %rdi,%rax
+  8016ef:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  8016f3:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  8016f9:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  8016fd:	c3                   	ret
+
+00000000008016fe <fd_alloc_from>:
+}
+
+/* Like fd_alloc(), but only considers fds starting from fdnum,
+ * so that several fds can be found before their pages are allocated */
+int
+fd_alloc_from(int fdnum, struct Fd **fd_store) {
+  8016fe:	55                   	push   %rbp
+  8016ff:	48 89 e5             	mov    %rsp,%rbp
+  801702:	41 57                	push   %r15
+  801704:	41 56                	push   %r14
+  801706:	41 55                	push   %r13
+  801708:	41 54                	push   %r12
+  80170a:	53                   	push   %rbx
+  80170b:	48 83 ec 08          	sub    $0x8,%rsp
+  80170f:	49 89 f7             	mov    %rsi,%r15
+    for (int i = MAX(fdnum, 0); i < MAXFD; i++) {
+  801712:	85 ff                	test   %edi,%edi
+  801714:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80171a:	44 0f 49 e7          	cmovns %edi,%r12d
+  80171e:	83 ff 1f             	cmp    $0x1f,%edi
+  801721:	7f 37                	jg     80175a <fd_alloc_from+0x5c>
+  801723:	49 63 dc             	movslq %r12d,%rbx
+  801726:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  80172d:	48 c1 e3 0c          	shl    $0xc,%rbx
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  801731:	49 be 07 28 80 00 00 	movabs $0x802807,%r14
+  801738:	00 00 00 
+        struct Fd *fd = INDEX2FD(i);
+  80173b:	49 89 dd             	mov    %rbx,%r13
+        if (!(get_prot(fd) & PROT_R)) {
+  80173e:	48 89 df             	mov    %rbx,%rdi
+  801741:	41 ff d6             	call   *%r14
+  801744:	83 e0 04             	and    $0x4,%eax
+  801747:	74 1c                	je     801765 <fd_alloc_from+0x67>
+    for (int i = MAX(fdnum, 0); i < MAXFD; i++) {
+  801749:	41 83 c4 01          	add    $0x1,%r12d
+  80174d:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801754:	41 83 fc 1f          	cmp    $0x1f,%r12d
+  801758:	7e e1                	jle    80173b <fd_alloc_from+0x3d>
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  80175a:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801760:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  801765:	4d 89 2f             	mov    %r13,(%r15)
+}
+  801768:	48 83 c4 08          	add    $0x8,%rsp
+  80176c:	5b                   	pop    %rbx
+  80176d:	41 5c                	pop    %r12
+  80176f:	41 5d                	pop    %r13
+  801771:	41 5e                	pop    %r14
+  801773:	41 5f                	pop    %r15
+  801775:	5d                   	pop    %rbp
+  801776:	c3                   	ret
+
+0000000000801777 <fd_alloc>:
+fd_alloc(struct Fd **fd_store) {
+  801777:	55                   	push   %rbp
+  801778:	48 89 e5             	mov    %rsp,%rbp
+  80177b:	48 89 fe             	mov    %rdi,%rsi
+    return fd_alloc_from(0, fd_store);
+  80177e:	bf 00 00 00 00       	mov    $0x0,%edi
+  801783:	48 b8 fe 16 80 00 00 	movabs $0x8016fe,%rax
+  80178a:	00 00 00 
+  80178d:	ff d0                	call   *%rax
+}
+  80178f:	5d                   	pop    %rbp
+  801790:	c3                   	ret
+
+0000000000801791 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  801791:	83 ff 1f             	cmp    $0x1f,%edi
+  801794:	77 39                	ja     8017cf <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  801796:	55                   	push   %rbp
+  801797:	48 89 e5             	mov    %rsp,%rbp
+  80179a:	41 54                	push   %r12
+  80179c:	53                   	push   %rbx
+  80179d:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  8017a0:	48 63 df             	movslq %edi,%rbx
+  8017a3:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  8017aa:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  8017ae:	48 89 df             	mov    %rbx,%rdi
+  8017b1:	48 b8 07 28 80 00 00 	movabs $0x802807,%rax
+  8017b8:	00 00 00 
+  8017bb:	ff d0                	call   *%rax
+  8017bd:	a8 04                	test   $0x4,%al
+  8017bf:	74 14                	je     8017d5 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  8017c1:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  8017c5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8017ca:	5b                   	pop    %rbx
+  8017cb:	41 5c                	pop    %r12
+  8017cd:	5d                   	pop    %rbp
+  8017ce:	c3                   	ret
+        return -E_INVAL;
+  8017cf:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8017d4:	c3                   	ret
+        return -E_INVAL;
+  8017d5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8017da:	eb ee                	jmp    8017ca <fd_lookup+0x39>
+
+00000000008017dc <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  8017dc:	55                   	push   %rbp
+  8017dd:	48 89 e5             	mov    %rsp,%rbp
+  8017e0:	41 54                	push   %r12
+  8017e2:	53                   	push   %rbx
+  8017e3:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  8017e6:	48 b8 80 34 80 00 00 	movabs $0x803480,%rax
+  8017ed:	00 00 00 
+  8017f0:	48 bb 20 40 80 00 00 	movabs $0x804020,%rbx
+  8017f7:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  8017fa:	39 3b                	cmp    %edi,(%rbx)
+  8017fc:	74 47                	je     801845 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  8017fe:	48 83 c0 08          	add    $0x8,%rax
+  801802:	48 8b 18             	mov    (%rax),%rbx
+  801805:	48 85 db             	test   %rbx,%rbx
+  801808:	75 f0                	jne    8017fa <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  80180a:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801811:	00 00 00 
+  801814:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+  80181a:	89 fa                	mov    %edi,%edx
+  80181c:	48 bf 00 34 80 00 00 	movabs $0x803400,%rdi
+  801823:	00 00 00 
+  801826:	b8 00 00 00 00       	mov    $0x0,%eax
+  80182b:	48 b9 c0 03 80 00 00 	movabs $0x8003c0,%rcx
+  801832:	00 00 00 
+  801835:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  801837:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  80183c:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  801840:	5b                   	pop    %rbx
+  801841:	41 5c                	pop    %r12
+  801843:	5d                   	pop    %rbp
+  801844:	c3                   	ret
+            return 0;
+  801845:	b8 00 00 00 00       	mov    $0x0,%eax
+  80184a:	eb f0                	jmp    80183c <dev_lookup+0x60>
+
+000000000080184c <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  80184c:	55                   	push   %rbp
+  80184d:	48 89 e5             	mov    %rsp,%rbp
+  801850:	41 55                	push   %r13
+  801852:	41 54                	push   %r12
+  801854:	53                   	push   %rbx
+  801855:	48 83 ec 18          	sub    $0x18,%rsp
+  801859:	48 89 fb             	mov    %rdi,%rbx
+  80185c:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80185f:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  801866:	ff ff ff 
+  801869:	48 01 df             	add    %rbx,%rdi
+  80186c:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  801870:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801874:	48 b8 91 17 80 00 00 	movabs $0x801791,%rax
+  80187b:	00 00 00 
+  80187e:	ff d0                	call   *%rax
+  801880:	41 89 c5             	mov    %eax,%r13d
+  801883:	85 c0                	test   %eax,%eax
+  801885:	78 06                	js     80188d <fd_close+0x41>
+  801887:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  80188b:	74 1a                	je     8018a7 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  80188d:	45 84 e4             	test   %r12b,%r12b
+  801890:	b8 00 00 00 00       	mov    $0x0,%eax
+  801895:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  801899:	44 89 e8             	mov    %r13d,%eax
+  80189c:	48 83 c4 18          	add    $0x18,%rsp
+  8018a0:	5b                   	pop    %rbx
+  8018a1:	41 5c                	pop    %r12
+  8018a3:	41 5d                	pop    %r13
+  8018a5:	5d                   	pop    %rbp
+  8018a6:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8018a7:	8b 3b                	mov    (%rbx),%edi
+  8018a9:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8018ad:	48 b8 dc 17 80 00 00 	movabs $0x8017dc,%rax
+  8018b4:	00 00 00 
+  8018b7:	ff d0                	call   *%rax
+  8018b9:	41 89 c5             	mov    %eax,%r13d
+  8018bc:	85 c0                	test   %eax,%eax
+  8018be:	78 1b                	js     8018db <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  8018c0:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8018c4:	48 8b 40 20          	mov    0x20(%rax),%rax
+  8018c8:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  8018ce:	48 85 c0             	test   %rax,%rax
+  8018d1:	74 08                	je     8018db <fd_close+0x8f>
+  8018d3:	48 89 df             	mov    %rbx,%rdi
+  8018d6:	ff d0                	call   *%rax
+  8018d8:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8018db:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8018e0:	48 89 de             	mov    %rbx,%rsi
+  8018e3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8018e8:	48 b8 61 13 80 00 00 	movabs $0x801361,%rax
+  8018ef:	00 00 00 
+  8018f2:	ff d0                	call   *%rax
+    return res;
+  8018f4:	eb a3                	jmp    801899 <fd_close+0x4d>
+
+00000000008018f6 <close>:
+
+int
+close(int fdnum) {
+  8018f6:	55                   	push   %rbp
+  8018f7:	48 89 e5             	mov    %rsp,%rbp
+  8018fa:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  8018fe:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801902:	48 b8 91 17 80 00 00 	movabs $0x801791,%rax
+  801909:	00 00 00 
+  80190c:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80190e:	85 c0                	test   %eax,%eax
+  801910:	78 15                	js     801927 <close+0x31>
+
+    return fd_close(fd, 1);
+  801912:	be 01 00 00 00       	mov    $0x1,%esi
+  801917:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80191b:	48 b8 4c 18 80 00 00 	movabs $0x80184c,%rax
+  801922:	00 00 00 
+  801925:	ff d0                	call   *%rax
+}
+  801927:	c9                   	leave
+  801928:	c3                   	ret
+
+0000000000801929 <close_all>:
+
+void
+close_all(void) {
+  801929:	55                   	push   %rbp
+  80192a:	48 89 e5             	mov    %rsp,%rbp
+  80192d:	41 54                	push   %r12
+  80192f:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  801930:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801935:	49 bc f6 18 80 00 00 	movabs $0x8018f6,%r12
+  80193c:	00 00 00 
+  80193f:	89 df                	mov    %ebx,%edi
+  801941:	41 ff d4             	call   *%r12
+  801944:	83 c3 01             	add    $0x1,%ebx
+  801947:	83 fb 20             	cmp    $0x20,%ebx
+  80194a:	75 f3                	jne    80193f <close_all+0x16>
+}
+  80194c:	5b                   	pop    %rbx
+  80194d:	41 5c                	pop    %r12
+  80194f:	5d                   	pop    %rbp
+  801950:	c3                   	ret
+
+0000000000801951 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  801951:	55                   	push   %rbp
+  801952:	48 89 e5             	mov    %rsp,%rbp
+  801955:	41 57                	push   %r15
+  801957:	41 56                	push   %r14
+  801959:	41 55                	push   %r13
+  80195b:	41 54                	push   %r12
+  80195d:	53                   	push   %rbx
+  80195e:	48 83 ec 18          	sub    $0x18,%rsp
+  801962:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  801965:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801969:	48 b8 91 17 80 00 00 	movabs $0x801791,%rax
+  801970:	00 00 00 
+  801973:	ff d0                	call   *%rax
+  801975:	89 c3                	mov    %eax,%ebx
+  801977:	85 c0                	test   %eax,%eax
+  801979:	0f 88 b8 00 00 00    	js     801a37 <dup+0xe6>
+    close(newfdnum);
+  80197f:	44 89 e7             	mov    %r12d,%edi
+  801982:	48 b8 f6 18 80 00 00 	movabs $0x8018f6,%rax
+  801989:	00 00 00 
+  80198c:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  80198e:	4d 63 ec             	movslq %r12d,%r13
+  801991:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  801998:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  80199c:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  8019a0:	4c 89 ff             	mov    %r15,%rdi
+  8019a3:	49 be e2 16 80 00 00 	movabs $0x8016e2,%r14
+  8019aa:	00 00 00 
+  8019ad:	41 ff d6             	call   *%r14
+  8019b0:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  8019b3:	4c 89 ef             	mov    %r13,%rdi
+  8019b6:	41 ff d6             	call   *%r14
+  8019b9:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  8019bc:	48 89 df             	mov    %rbx,%rdi
+  8019bf:	48 b8 07 28 80 00 00 	movabs $0x802807,%rax
+  8019c6:	00 00 00 
+  8019c9:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  8019cb:	a8 04                	test   $0x4,%al
+  8019cd:	74 2b                	je     8019fa <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  8019cf:	41 89 c1             	mov    %eax,%r9d
+  8019d2:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8019d8:	4c 89 f1             	mov    %r14,%rcx
+  8019db:	ba 00 00 00 00       	mov    $0x0,%edx
+  8019e0:	48 89 de             	mov    %rbx,%rsi
+  8019e3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8019e8:	48 b8 fc 12 80 00 00 	movabs $0x8012fc,%rax
+  8019ef:	00 00 00 
+  8019f2:	ff d0                	call   *%rax
+  8019f4:	89 c3                	mov    %eax,%ebx
+  8019f6:	85 c0                	test   %eax,%eax
+  8019f8:	78 4e                	js     801a48 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  8019fa:	4c 89 ff             	mov    %r15,%rdi
+  8019fd:	48 b8 07 28 80 00 00 	movabs $0x802807,%rax
+  801a04:	00 00 00 
+  801a07:	ff d0                	call   *%rax
+  801a09:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801a0c:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801a12:	4c 89 e9             	mov    %r13,%rcx
+  801a15:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a1a:	4c 89 fe             	mov    %r15,%rsi
+  801a1d:	bf 00 00 00 00       	mov    $0x0,%edi
+  801a22:	48 b8 fc 12 80 00 00 	movabs $0x8012fc,%rax
+  801a29:	00 00 00 
+  801a2c:	ff d0                	call   *%rax
+  801a2e:	89 c3                	mov    %eax,%ebx
+  801a30:	85 c0                	test   %eax,%eax
+  801a32:	78 14                	js     801a48 <dup+0xf7>
+
+    return newfdnum;
+  801a34:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  801a37:	89 d8                	mov    %ebx,%eax
+  801a39:	48 83 c4 18          	add    $0x18,%rsp
+  801a3d:	5b                   	pop    %rbx
+  801a3e:	41 5c                	pop    %r12
+  801a40:	41 5d                	pop    %r13
+  801a42:	41 5e                	pop    %r14
+  801a44:	41 5f                	pop    %r15
+  801a46:	5d                   	pop    %rbp
+  801a47:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  801a48:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801a4d:	4c 89 ee             	mov    %r13,%rsi
+  801a50:	bf 00 00 00 00       	mov    $0x0,%edi
+  801a55:	49 bc 61 13 80 00 00 	movabs $0x801361,%r12
+  801a5c:	00 00 00 
+  801a5f:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  801a62:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801a67:	4c 89 f6             	mov    %r14,%rsi
+  801a6a:	bf 00 00 00 00       	mov    $0x0,%edi
+  801a6f:	41 ff d4             	call   *%r12
+    return res;
+  801a72:	eb c3                	jmp    801a37 <dup+0xe6>
+
+0000000000801a74 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  801a74:	55                   	push   %rbp
+  801a75:	48 89 e5             	mov    %rsp,%rbp
+  801a78:	41 56                	push   %r14
+  801a7a:	41 55                	push   %r13
+  801a7c:	41 54                	push   %r12
+  801a7e:	53                   	push   %rbx
+  801a7f:	48 83 ec 10          	sub    $0x10,%rsp
+  801a83:	89 fb                	mov    %edi,%ebx
+  801a85:	49 89 f4             	mov    %rsi,%r12
+  801a88:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801a8b:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801a8f:	48 b8 91 17 80 00 00 	movabs $0x801791,%rax
+  801a96:	00 00 00 
+  801a99:	ff d0                	call   *%rax
+  801a9b:	85 c0                	test   %eax,%eax
+  801a9d:	78 4c                	js     801aeb <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801a9f:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801aa3:	41 8b 3e             	mov    (%r14),%edi
+  801aa6:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801aaa:	48 b8 dc 17 80 00 00 	movabs $0x8017dc,%rax
+  801ab1:	00 00 00 
+  801ab4:	ff d0                	call   *%rax
+  801ab6:	85 c0                	test   %eax,%eax
+  801ab8:	78 35                	js     801aef <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801aba:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801abe:	83 e0 03             	and    $0x3,%eax
+  801ac1:	83 f8 01             	cmp    $0x1,%eax
+  801ac4:	74 2d                	je     801af3 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801ac6:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801aca:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801ace:	48 85 c0             	test   %rax,%rax
+  801ad1:	74 56                	je     801b29 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  801ad3:	4c 89 ea             	mov    %r13,%rdx
+  801ad6:	4c 89 e6             	mov    %r12,%rsi
+  801ad9:	4c 89 f7             	mov    %r14,%rdi
+  801adc:	ff d0                	call   *%rax
+}
+  801ade:	48 83 c4 10          	add    $0x10,%rsp
+  801ae2:	5b                   	pop    %rbx
+  801ae3:	41 5c                	pop    %r12
+  801ae5:	41 5d                	pop    %r13
+  801ae7:	41 5e                	pop    %r14
+  801ae9:	5d                   	pop    %rbp
+  801aea:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801aeb:	48 98                	cltq
+  801aed:	eb ef                	jmp    801ade <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801aef:	48 98                	cltq
+  801af1:	eb eb                	jmp    801ade <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801af3:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801afa:	00 00 00 
+  801afd:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+  801b03:	89 da                	mov    %ebx,%edx
+  801b05:	48 bf 41 34 80 00 00 	movabs $0x803441,%rdi
+  801b0c:	00 00 00 
+  801b0f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b14:	48 b9 c0 03 80 00 00 	movabs $0x8003c0,%rcx
+  801b1b:	00 00 00 
+  801b1e:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801b20:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801b27:	eb b5                	jmp    801ade <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801b29:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801b30:	eb ac                	jmp    801ade <read+0x6a>
+
+0000000000801b32 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801b32:	55                   	push   %rbp
+  801b33:	48 89 e5             	mov    %rsp,%rbp
+  801b36:	41 57                	push   %r15
+  801b38:	41 56                	push   %r14
+  801b3a:	41 55                	push   %r13
+  801b3c:	41 54                	push   %r12
+  801b3e:	53                   	push   %rbx
+  801b3f:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  801b43:	48 85 d2             	test   %rdx,%rdx
+  801b46:	74 54                	je     801b9c <readn+0x6a>
+  801b48:	41 89 fd             	mov    %edi,%r13d
+  801b4b:	49 89 f6             	mov    %rsi,%r14
+  801b4e:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  801b51:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  801b56:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  801b5b:	49 bf 74 1a 80 00 00 	movabs $0x801a74,%r15
+  801b62:	00 00 00 
+  801b65:	4c 89 e2             	mov    %r12,%rdx
+  801b68:	48 29 f2             	sub    %rsi,%rdx
+  801b6b:	4c 01 f6             	add    %r14,%rsi
+  801b6e:	44 89 ef             	mov    %r13d,%edi
+  801b71:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  801b74:	85 c0                	test   %eax,%eax
+  801b76:	78 20                	js     801b98 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  801b78:	01 c3                	add    %eax,%ebx
+  801b7a:	85 c0                	test   %eax,%eax
+  801b7c:	74 08                	je     801b86 <readn+0x54>
+  801b7e:	48 63 f3             	movslq %ebx,%rsi
+  801b81:	4c 39 e6             	cmp    %r12,%rsi
+  801b84:	72 df                	jb     801b65 <readn+0x33>
+    }
+    return res;
+  801b86:	48 63 c3             	movslq %ebx,%rax
+}
+  801b89:	48 83 c4 08          	add    $0x8,%rsp
+  801b8d:	5b                   	pop    %rbx
+  801b8e:	41 5c                	pop    %r12
+  801b90:	41 5d                	pop    %r13
+  801b92:	41 5e                	pop    %r14
+  801b94:	41 5f                	pop    %r15
+  801b96:	5d                   	pop    %rbp
+  801b97:	c3                   	ret
+        if (inc < 0) return inc;
+  801b98:	48 98                	cltq
+  801b9a:	eb ed                	jmp    801b89 <readn+0x57>
+    int inc = 1, res = 0;
+  801b9c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801ba1:	eb e3                	jmp    801b86 <readn+0x54>
+
+0000000000801ba3 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  801ba3:	55                   	push   %rbp
+  801ba4:	48 89 e5             	mov    %rsp,%rbp
+  801ba7:	41 56                	push   %r14
+  801ba9:	41 55                	push   %r13
+  801bab:	41 54                	push   %r12
+  801bad:	53                   	push   %rbx
+  801bae:	48 83 ec 10          	sub    $0x10,%rsp
+  801bb2:	89 fb                	mov    %edi,%ebx
+  801bb4:	49 89 f4             	mov    %rsi,%r12
+  801bb7:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801bba:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801bbe:	48 b8 91 17 80 00 00 	movabs $0x801791,%rax
+  801bc5:	00 00 00 
+  801bc8:	ff d0                	call   *%rax
+  801bca:	85 c0                	test   %eax,%eax
+  801bcc:	78 47                	js     801c15 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801bce:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801bd2:	41 8b 3e             	mov    (%r14),%edi
+  801bd5:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801bd9:	48 b8 dc 17 80 00 00 	movabs $0x8017dc,%rax
+  801be0:	00 00 00 
+  801be3:	ff d0                	call   *%rax
+  801be5:	85 c0                	test   %eax,%eax
+  801be7:	78 30                	js     801c19 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801be9:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  801bee:	74 2d                	je     801c1d <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801bf0:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801bf4:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801bf8:	48 85 c0             	test   %rax,%rax
+  801bfb:	74 56                	je     801c53 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  801bfd:	4c 89 ea             	mov    %r13,%rdx
+  801c00:	4c 89 e6             	mov    %r12,%rsi
+  801c03:	4c 89 f7             	mov    %r14,%rdi
+  801c06:	ff d0                	call   *%rax
+}
+  801c08:	48 83 c4 10          	add    $0x10,%rsp
+  801c0c:	5b                   	pop    %rbx
+  801c0d:	41 5c                	pop    %r12
+  801c0f:	41 5d                	pop    %r13
+  801c11:	41 5e                	pop    %r14
+  801c13:	5d                   	pop    %rbp
+  801c14:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801c15:	48 98                	cltq
+  801c17:	eb ef                	jmp    801c08 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801c19:	48 98                	cltq
+  801c1b:	eb eb                	jmp    801c08 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801c1d:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801c24:	00 00 00 
+  801c27:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+  801c2d:	89 da                	mov    %ebx,%edx
+  801c2f:	48 bf 5d 34 80 00 00 	movabs $0x80345d,%rdi
+  801c36:	00 00 00 
+  801c39:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c3e:	48 b9 c0 03 80 00 00 	movabs $0x8003c0,%rcx
+  801c45:	00 00 00 
+  801c48:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801c4a:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801c51:	eb b5                	jmp    801c08 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801c53:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801c5a:	eb ac                	jmp    801c08 <write+0x65>
+
+0000000000801c5c <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  801c5c:	55                   	push   %rbp
+  801c5d:	48 89 e5             	mov    %rsp,%rbp
+  801c60:	53                   	push   %rbx
+  801c61:	48 83 ec 18          	sub    $0x18,%rsp
+  801c65:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801c67:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801c6b:	48 b8 91 17 80 00 00 	movabs $0x801791,%rax
+  801c72:	00 00 00 
+  801c75:	ff d0                	call   *%rax
+  801c77:	85 c0                	test   %eax,%eax
+  801c79:	78 0c                	js     801c87 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  801c7b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801c7f:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  801c82:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801c87:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801c8b:	c9                   	leave
+  801c8c:	c3                   	ret
+
+0000000000801c8d <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  801c8d:	55                   	push   %rbp
+  801c8e:	48 89 e5             	mov    %rsp,%rbp
+  801c91:	41 55                	push   %r13
+  801c93:	41 54                	push   %r12
+  801c95:	53                   	push   %rbx
+  801c96:	48 83 ec 18          	sub    $0x18,%rsp
+  801c9a:	89 fb                	mov    %edi,%ebx
+  801c9c:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801c9f:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801ca3:	48 b8 91 17 80 00 00 	movabs $0x801791,%rax
+  801caa:	00 00 00 
+  801cad:	ff d0                	call   *%rax
+  801caf:	85 c0                	test   %eax,%eax
+  801cb1:	78 38                	js     801ceb <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801cb3:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  801cb7:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  801cbb:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801cbf:	48 b8 dc 17 80 00 00 	movabs $0x8017dc,%rax
+  801cc6:	00 00 00 
+  801cc9:	ff d0                	call   *%rax
+  801ccb:	85 c0                	test   %eax,%eax
+  801ccd:	78 1c                	js     801ceb <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801ccf:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  801cd4:	74 20                	je     801cf6 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801cd6:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801cda:	48 8b 40 30          	mov    0x30(%rax),%rax
+  801cde:	48 85 c0             	test   %rax,%rax
+  801ce1:	74 47                	je     801d2a <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  801ce3:	44 89 e6             	mov    %r12d,%esi
+  801ce6:	4c 89 ef             	mov    %r13,%rdi
+  801ce9:	ff d0                	call   *%rax
+}
+  801ceb:	48 83 c4 18          	add    $0x18,%rsp
+  801cef:	5b                   	pop    %rbx
+  801cf0:	41 5c                	pop    %r12
+  801cf2:	41 5d                	pop    %r13
+  801cf4:	5d                   	pop    %rbp
+  801cf5:	c3                   	ret
+                thisenv->env_id, fdnum);
+  801cf6:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801cfd:	00 00 00 
+  801d00:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801d06:	89 da                	mov    %ebx,%edx
+  801d08:	48 bf 20 34 80 00 00 	movabs $0x803420,%rdi
+  801d0f:	00 00 00 
+  801d12:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d17:	48 b9 c0 03 80 00 00 	movabs $0x8003c0,%rcx
+  801d1e:	00 00 00 
+  801d21:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801d23:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801d28:	eb c1                	jmp    801ceb <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801d2a:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801d2f:	eb ba                	jmp    801ceb <ftruncate+0x5e>
+
+0000000000801d31 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  801d31:	55                   	push   %rbp
+  801d32:	48 89 e5             	mov    %rsp,%rbp
+  801d35:	41 54                	push   %r12
+  801d37:	53                   	push   %rbx
+  801d38:	48 83 ec 10          	sub    $0x10,%rsp
+  801d3c:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801d3f:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801d43:	48 b8 91 17 80 00 00 	movabs $0x801791,%rax
+  801d4a:	00 00 00 
+  801d4d:	ff d0                	call   *%rax
+  801d4f:	85 c0                	test   %eax,%eax
+  801d51:	78 4e                	js     801da1 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801d53:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801d57:	41 8b 3c 24          	mov    (%r12),%edi
+  801d5b:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801d5f:	48 b8 dc 17 80 00 00 	movabs $0x8017dc,%rax
+  801d66:	00 00 00 
+  801d69:	ff d0                	call   *%rax
+  801d6b:	85 c0                	test   %eax,%eax
+  801d6d:	78 32                	js     801da1 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801d6f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801d73:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  801d78:	74 30                	je     801daa <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  801d7a:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  801d7d:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  801d84:	00 00 00 
+    stat->st_isdir = 0;
+  801d87:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  801d8e:	00 00 00 
+    stat->st_dev = dev;
+  801d91:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  801d98:	48 89 de             	mov    %rbx,%rsi
+  801d9b:	4c 89 e7             	mov    %r12,%rdi
+  801d9e:	ff 50 28             	call   *0x28(%rax)
+}
+  801da1:	48 83 c4 10          	add    $0x10,%rsp
+  801da5:	5b                   	pop    %rbx
+  801da6:	41 5c                	pop    %r12
+  801da8:	5d                   	pop    %rbp
+  801da9:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801daa:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801daf:	eb f0                	jmp    801da1 <fstat+0x70>
+
+0000000000801db1 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  801db1:	55                   	push   %rbp
+  801db2:	48 89 e5             	mov    %rsp,%rbp
+  801db5:	41 54                	push   %r12
+  801db7:	53                   	push   %rbx
+  801db8:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  801dbb:	be 00 00 00 00       	mov    $0x0,%esi
+  801dc0:	48 b8 94 21 80 00 00 	movabs $0x802194,%rax
+  801dc7:	00 00 00 
+  801dca:	ff d0                	call   *%rax
+  801dcc:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  801dce:	85 c0                	test   %eax,%eax
+  801dd0:	78 25                	js     801df7 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  801dd2:	4c 89 e6             	mov    %r12,%rsi
+  801dd5:	89 c7                	mov    %eax,%edi
+  801dd7:	48 b8 31 1d 80 00 00 	movabs $0x801d31,%rax
+  801dde:	00 00 00 
+  801de1:	ff d0                	call   *%rax
+  801de3:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  801de6:	89 df                	mov    %ebx,%edi
+  801de8:	48 b8 f6 18 80 00 00 	movabs $0x8018f6,%rax
+  801def:	00 00 00 
+  801df2:	ff d0                	call   *%rax
+
+    return res;
+  801df4:	44 89 e3             	mov    %r12d,%ebx
+}
+  801df7:	89 d8                	mov    %ebx,%eax
+  801df9:	5b                   	pop    %rbx
+  801dfa:	41 5c                	pop    %r12
+  801dfc:	5d                   	pop    %rbp
+  801dfd:	c3                   	ret
+
+0000000000801dfe <fsipc>:
+ * response may be written back to fsipcbuf.
+ * type: request code, passed as the simple integer IPC value.
+ * dstva: virtual address at which to receive reply page, 0 if none.
+ * Returns result from the file server. */
+static int
+fsipc(unsigned type, void *dstva) {
+  801dfe:	55                   	push   %rbp
+  801dff:	48 89 e5             	mov    %rsp,%rbp
+  801e02:	41 54                	push   %r12
+  801e04:	53                   	push   %rbx
+  801e05:	48 83 ec 10          	sub    $0x10,%rsp
+  801e09:	41 89 fc             	mov    %edi,%r12d
+  801e0c:	48 89 f3             	mov    %rsi,%rbx
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  801e0f:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  801e16:	00 00 00 
+  801e19:	83 38 00             	cmpl   $0x0,(%rax)
+  801e1c:	74 5e                	je     801e7c <fsipc+0x7e>
+    if (debug) {
+        cprintf("[%08x] fsipc %d %08x\n",
+                thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+    }
+
+    ipc_send(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW);
+  801e1e:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  801e24:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  801e29:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  801e30:	00 00 00 
+  801e33:	44 89 e6             	mov    %r12d,%esi
+  801e36:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  801e3d:	00 00 00 
+  801e40:	8b 38                	mov    (%rax),%edi
+  801e42:	48 b8 fb 2c 80 00 00 	movabs $0x802cfb,%rax
+  801e49:	00 00 00 
+  801e4c:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  801e4e:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  801e55:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  801e56:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801e5b:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  801e5f:	48 89 de             	mov    %rbx,%rsi
+  801e62:	bf 00 00 00 00       	mov    $0x0,%edi
+  801e67:	48 b8 26 2c 80 00 00 	movabs $0x802c26,%rax
+  801e6e:	00 00 00 
+  801e71:	ff d0                	call   *%rax
+}
+  801e73:	48 83 c4 10          	add    $0x10,%rsp
+  801e77:	5b                   	pop    %rbx
+  801e78:	41 5c                	pop    %r12
+  801e7a:	5d                   	pop    %rbp
+  801e7b:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  801e7c:	bf 03 00 00 00       	mov    $0x3,%edi
+  801e81:	48 b8 9e 2d 80 00 00 	movabs $0x802d9e,%rax
+  801e88:	00 00 00 
+  801e8b:	ff d0                	call   *%rax
+  801e8d:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  801e94:	00 00 
+  801e96:	eb 86                	jmp    801e1e <fsipc+0x20>
+
+0000000000801e98 <devfile_trunc>:
+    return 0;
+}
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  801e98:	55                   	push   %rbp
+  801e99:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801e9c:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  801ea3:	00 00 00 
+  801ea6:	8b 57 0c             	mov    0xc(%rdi),%edx
+  801ea9:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  801eab:	89 70 04             	mov    %esi,0x4(%rax)
+
+    return fsipc(FSREQ_SET_SIZE, NULL);
+  801eae:	be 00 00 00 00       	mov    $0x0,%esi
+  801eb3:	bf 02 00 00 00       	mov    $0x2,%edi
+  801eb8:	48 b8 fe 1d 80 00 00 	movabs $0x801dfe,%rax
+  801ebf:	00 00 00 
+  801ec2:	ff d0                	call   *%rax
+}
+  801ec4:	5d                   	pop    %rbp
+  801ec5:	c3                   	ret
+
+0000000000801ec6 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  801ec6:	55                   	push   %rbp
+  801ec7:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801eca:	8b 47 0c             	mov    0xc(%rdi),%eax
+  801ecd:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  801ed4:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  801ed6:	be 00 00 00 00       	mov    $0x0,%esi
+  801edb:	bf 06 00 00 00       	mov    $0x6,%edi
+  801ee0:	48 b8 fe 1d 80 00 00 	movabs $0x801dfe,%rax
+  801ee7:	00 00 00 
+  801eea:	ff d0                	call   *%rax
+}
+  801eec:	5d                   	pop    %rbp
+  801eed:	c3                   	ret
+
+0000000000801eee <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  801eee:	55                   	push   %rbp
+  801eef:	48 89 e5             	mov    %rsp,%rbp
+  801ef2:	41 54                	push   %r12
+  801ef4:	53                   	push   %rbx
+  801ef5:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801ef8:	8b 47 0c             	mov    0xc(%rdi),%eax
+  801efb:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  801f02:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  801f04:	be 00 00 00 00       	mov    $0x0,%esi
+  801f09:	bf 05 00 00 00       	mov    $0x5,%edi
+  801f0e:	48 b8 fe 1d 80 00 00 	movabs $0x801dfe,%rax
+  801f15:	00 00 00 
+  801f18:	ff d0                	call   *%rax
+    if (res < 0) {
+  801f1a:	85 c0                	test   %eax,%eax
+  801f1c:	78 3d                	js     801f5b <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801f1e:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  801f25:	00 00 00 
+  801f28:	4c 89 e6             	mov    %r12,%rsi
+  801f2b:	48 89 df             	mov    %rbx,%rdi
+  801f2e:	48 b8 e5 0c 80 00 00 	movabs $0x800ce5,%rax
+  801f35:	00 00 00 
+  801f38:	ff d0                	call   *%rax
+    st->st_size  = fsipcbuf.statRet.ret_size;
+  801f3a:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  801f41:	00 
+  801f42:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801f48:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  801f4f:	00 
+  801f50:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  801f56:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801f5b:	5b                   	pop    %rbx
+  801f5c:	41 5c                	pop    %r12
+  801f5e:	5d                   	pop    %rbp
+  801f5f:	c3                   	ret
+
+0000000000801f60 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  801f60:	55                   	push   %rbp
+  801f61:	48 89 e5             	mov    %rsp,%rbp
+  801f64:	41 57                	push   %r15
+  801f66:	41 56                	push   %r14
+  801f68:	41 55                	push   %r13
+  801f6a:	41 54                	push   %r12
+  801f6c:	53                   	push   %rbx
+  801f6d:	48 83 ec 18          	sub    $0x18,%rsp
+  801f71:	49 89 fe             	mov    %rdi,%r14
+  801f74:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+  801f78:	48 89 d3             	mov    %rdx,%rbx
+    while (n > sizeof(fsipcbuf.write.req_buf))
+  801f7b:	48 81 fa f0 0f 00 00 	cmp    $0xff0,%rdx
+  801f82:	0f 86 e4 00 00 00    	jbe    80206c <devfile_write+0x10c>
+  801f88:	49 89 f4             	mov    %rsi,%r12
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801f8b:	49 bd 00 60 80 00 00 	movabs $0x806000,%r13
+  801f92:	00 00 00 
+        memcpy(fsipcbuf.write.req_buf, buf, sizeof(fsipcbuf.write.req_buf));
+  801f95:	49 bf 46 0f 80 00 00 	movabs $0x800f46,%r15
+  801f9c:	00 00 00 
+  801f9f:	eb 03                	jmp    801fa4 <devfile_write+0x44>
+        buf += sizeof(fsipcbuf.write.req_buf);
+  801fa1:	49 89 f4             	mov    %rsi,%r12
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801fa4:	41 8b 46 0c          	mov    0xc(%r14),%eax
+  801fa8:	41 89 45 00          	mov    %eax,0x0(%r13)
+        fsipcbuf.write.req_n      = sizeof(fsipcbuf.write.req_buf);
+  801fac:	49 c7 45 08 f0 0f 00 	movq   $0xff0,0x8(%r13)
+  801fb3:	00 
+        memcpy(fsipcbuf.write.req_buf, buf, sizeof(fsipcbuf.write.req_buf));
+  801fb4:	ba f0 0f 00 00       	mov    $0xff0,%edx
+  801fb9:	4c 89 e6             	mov    %r12,%rsi
+  801fbc:	48 bf 10 60 80 00 00 	movabs $0x806010,%rdi
+  801fc3:	00 00 00 
+  801fc6:	41 ff d7             	call   *%r15
+        ssize_t res = fsipc(FSREQ_WRITE, NULL);
+  801fc9:	be 00 00 00 00       	mov    $0x0,%esi
+  801fce:	bf 04 00 00 00       	mov    $0x4,%edi
+  801fd3:	48 b8 fe 1d 80 00 00 	movabs $0x801dfe,%rax
+  801fda:	00 00 00 
+  801fdd:	ff d0                	call   *%rax
+  801fdf:	48 63 d0             	movslq %eax,%rdx
+        if (res < 0 || res < sizeof(fsipcbuf.write.req_buf))
+  801fe2:	3d ef 0f 00 00       	cmp    $0xfef,%eax
+  801fe7:	7e 71                	jle    80205a <devfile_write+0xfa>
+        buf += sizeof(fsipcbuf.write.req_buf);
+  801fe9:	49 8d b4 24 f0 0f 00 	lea    0xff0(%r12),%rsi
+  801ff0:	00 
+        n -= sizeof(fsipcbuf.write.req_buf);
+  801ff1:	48 81 eb f0 0f 00 00 	sub    $0xff0,%rbx
+    while (n > sizeof(fsipcbuf.write.req_buf))
+  801ff8:	48 81 fb f0 0f 00 00 	cmp    $0xff0,%rbx
+  801fff:	77 a0                	ja     801fa1 <devfile_write+0x41>
+        written += sizeof(fsipcbuf.write.req_buf);
+  802001:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802005:	49 29 c4             	sub    %rax,%r12
+  802008:	4d 8d a4 24 f0 0f 00 	lea    0xff0(%r12),%r12
+  80200f:	00 
+    fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802010:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  802017:	00 00 00 
+  80201a:	41 8b 56 0c          	mov    0xc(%r14),%edx
+  80201e:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.write.req_n      = n;
+  802020:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    memcpy(fsipcbuf.write.req_buf, buf, n);
+  802024:	48 89 da             	mov    %rbx,%rdx
+  802027:	48 8d 78 10          	lea    0x10(%rax),%rdi
+  80202b:	48 b8 46 0f 80 00 00 	movabs $0x800f46,%rax
+  802032:	00 00 00 
+  802035:	ff d0                	call   *%rax
+    ssize_t res = fsipc(FSREQ_WRITE, NULL);
+  802037:	be 00 00 00 00       	mov    $0x0,%esi
+  80203c:	bf 04 00 00 00       	mov    $0x4,%edi
+  802041:	48 b8 fe 1d 80 00 00 	movabs $0x801dfe,%rax
+  802048:	00 00 00 
+  80204b:	ff d0                	call   *%rax
+  80204d:	48 63 d0             	movslq %eax,%rdx
+    written += res;
+  802050:	49 01 d4             	add    %rdx,%r12
+  802053:	48 85 d2             	test   %rdx,%rdx
+  802056:	49 0f 49 d4          	cmovns %r12,%rdx
+}
+  80205a:	48 89 d0             	mov    %rdx,%rax
+  80205d:	48 83 c4 18          	add    $0x18,%rsp
+  802061:	5b                   	pop    %rbx
+  802062:	41 5c                	pop    %r12
+  802064:	41 5d                	pop    %r13
+  802066:	41 5e                	pop    %r14
+  802068:	41 5f                	pop    %r15
+  80206a:	5d                   	pop    %rbp
+  80206b:	c3                   	ret
+    while (n > sizeof(fsipcbuf.write.req_buf))
+  80206c:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+    ssize_t written = 0;
+  802070:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802076:	eb 98                	jmp    802010 <devfile_write+0xb0>
+
+0000000000802078 <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  802078:	55                   	push   %rbp
+  802079:	48 89 e5             	mov    %rsp,%rbp
+  80207c:	41 57                	push   %r15
+  80207e:	41 56                	push   %r14
+  802080:	41 55                	push   %r13
+  802082:	41 54                	push   %r12
+  802084:	53                   	push   %rbx
+  802085:	48 83 ec 18          	sub    $0x18,%rsp
+  802089:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  80208d:	49 89 f6             	mov    %rsi,%r14
+  802090:	49 89 d4             	mov    %rdx,%r12
+    while (n > sizeof(fsipcbuf.readRet.ret_buf))
+  802093:	48 81 fa 00 10 00 00 	cmp    $0x1000,%rdx
+  80209a:	0f 86 ea 00 00 00    	jbe    80218a <devfile_read+0x112>
+    ssize_t readsz = 0;
+  8020a0:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  8020a7:	00 
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8020a8:	49 bf 00 60 80 00 00 	movabs $0x806000,%r15
+  8020af:	00 00 00 
+  8020b2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8020b6:	8b 40 0c             	mov    0xc(%rax),%eax
+  8020b9:	41 89 07             	mov    %eax,(%r15)
+        fsipcbuf.read.req_n = sizeof(fsipcbuf.readRet.ret_buf);
+  8020bc:	49 c7 47 08 00 10 00 	movq   $0x1000,0x8(%r15)
+  8020c3:	00 
+        ssize_t res = fsipc(FSREQ_READ, NULL);
+  8020c4:	be 00 00 00 00       	mov    $0x0,%esi
+  8020c9:	bf 03 00 00 00       	mov    $0x3,%edi
+  8020ce:	48 b8 fe 1d 80 00 00 	movabs $0x801dfe,%rax
+  8020d5:	00 00 00 
+  8020d8:	ff d0                	call   *%rax
+  8020da:	4c 63 e8             	movslq %eax,%r13
+        if (res < 0)
+  8020dd:	4d 85 ed             	test   %r13,%r13
+  8020e0:	0f 88 92 00 00 00    	js     802178 <devfile_read+0x100>
+        memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  8020e6:	4c 89 ea             	mov    %r13,%rdx
+  8020e9:	4c 89 fe             	mov    %r15,%rsi
+  8020ec:	4c 89 f7             	mov    %r14,%rdi
+  8020ef:	48 b8 46 0f 80 00 00 	movabs $0x800f46,%rax
+  8020f6:	00 00 00 
+  8020f9:	ff d0                	call   *%rax
+        if (res < sizeof(fsipcbuf.readRet.ret_buf))
+  8020fb:	49 81 fd ff 0f 00 00 	cmp    $0xfff,%r13
+  802102:	76 6d                	jbe    802171 <devfile_read+0xf9>
+        readsz += res;
+  802104:	4c 01 6d c0          	add    %r13,-0x40(%rbp)
+        buf += res;
+  802108:	4d 01 ee             	add    %r13,%r14
+        n -= res;
+  80210b:	4d 29 ec             	sub    %r13,%r12
+    while (n > sizeof(fsipcbuf.readRet.ret_buf))
+  80210e:	49 81 fc 00 10 00 00 	cmp    $0x1000,%r12
+  802115:	77 9b                	ja     8020b2 <devfile_read+0x3a>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802117:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  80211e:	00 00 00 
+  802121:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  802125:	8b 51 0c             	mov    0xc(%rcx),%edx
+  802128:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.read.req_n = n;
+  80212a:	4c 89 60 08          	mov    %r12,0x8(%rax)
+    ssize_t res = fsipc(FSREQ_READ, NULL);
+  80212e:	be 00 00 00 00       	mov    $0x0,%esi
+  802133:	bf 03 00 00 00       	mov    $0x3,%edi
+  802138:	48 b8 fe 1d 80 00 00 	movabs $0x801dfe,%rax
+  80213f:	00 00 00 
+  802142:	ff d0                	call   *%rax
+  802144:	4c 63 e8             	movslq %eax,%r13
+    if (res < 0)
+  802147:	4d 85 ed             	test   %r13,%r13
+  80214a:	78 2c                	js     802178 <devfile_read+0x100>
+    memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  80214c:	4c 89 ea             	mov    %r13,%rdx
+  80214f:	48 be 00 60 80 00 00 	movabs $0x806000,%rsi
+  802156:	00 00 00 
+  802159:	4c 89 f7             	mov    %r14,%rdi
+  80215c:	48 b8 46 0f 80 00 00 	movabs $0x800f46,%rax
+  802163:	00 00 00 
+  802166:	ff d0                	call   *%rax
+    readsz += res;
+  802168:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80216c:	49 01 c5             	add    %rax,%r13
+    return readsz;
+  80216f:	eb 07                	jmp    802178 <devfile_read+0x100>
+            return readsz + res;
+  802171:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802175:	49 01 c5             	add    %rax,%r13
+}
+  802178:	4c 89 e8             	mov    %r13,%rax
+  80217b:	48 83 c4 18          	add    $0x18,%rsp
+  80217f:	5b                   	pop    %rbx
+  802180:	41 5c                	pop    %r12
+  802182:	41 5d                	pop    %r13
+  802184:	41 5e                	pop    %r14
+  802186:	41 5f                	pop    %r15
+  802188:	5d                   	pop    %rbp
+  802189:	c3                   	ret
+    ssize_t readsz = 0;
+  80218a:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  802191:	00 
+  802192:	eb 83                	jmp    802117 <devfile_read+0x9f>
+
+0000000000802194 <open>:
+open(const char *path, int mode) {
+  802194:	55                   	push   %rbp
+  802195:	48 89 e5             	mov    %rsp,%rbp
+  802198:	41 55                	push   %r13
+  80219a:	41 54                	push   %r12
+  80219c:	53                   	push   %rbx
+  80219d:	48 83 ec 18          	sub    $0x18,%rsp
+  8021a1:	49 89 fc             	mov    %rdi,%r12
+  8021a4:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  8021a7:	48 b8 a7 0c 80 00 00 	movabs $0x800ca7,%rax
+  8021ae:	00 00 00 
+  8021b1:	ff d0                	call   *%rax
+  8021b3:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  8021b9:	0f 87 8a 00 00 00    	ja     802249 <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8021bf:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  8021c3:	48 b8 77 17 80 00 00 	movabs $0x801777,%rax
+  8021ca:	00 00 00 
+  8021cd:	ff d0                	call   *%rax
+  8021cf:	89 c3                	mov    %eax,%ebx
+  8021d1:	85 c0                	test   %eax,%eax
+  8021d3:	78 50                	js     802225 <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  8021d5:	4c 89 e6             	mov    %r12,%rsi
+  8021d8:	48 bb 00 60 80 00 00 	movabs $0x806000,%rbx
+  8021df:	00 00 00 
+  8021e2:	48 89 df             	mov    %rbx,%rdi
+  8021e5:	48 b8 e5 0c 80 00 00 	movabs $0x800ce5,%rax
+  8021ec:	00 00 00 
+  8021ef:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  8021f1:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  8021f8:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8021fc:	bf 01 00 00 00       	mov    $0x1,%edi
+  802201:	48 b8 fe 1d 80 00 00 	movabs $0x801dfe,%rax
+  802208:	00 00 00 
+  80220b:	ff d0                	call   *%rax
+  80220d:	89 c3                	mov    %eax,%ebx
+  80220f:	85 c0                	test   %eax,%eax
+  802211:	78 1f                	js     802232 <open+0x9e>
+    return fd2num(fd);
+  802213:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802217:	48 b8 d0 16 80 00 00 	movabs $0x8016d0,%rax
+  80221e:	00 00 00 
+  802221:	ff d0                	call   *%rax
+  802223:	89 c3                	mov    %eax,%ebx
+}
+  802225:	89 d8                	mov    %ebx,%eax
+  802227:	48 83 c4 18          	add    $0x18,%rsp
+  80222b:	5b                   	pop    %rbx
+  80222c:	41 5c                	pop    %r12
+  80222e:	41 5d                	pop    %r13
+  802230:	5d                   	pop    %rbp
+  802231:	c3                   	ret
+        fd_close(fd, 0);
+  802232:	be 00 00 00 00       	mov    $0x0,%esi
+  802237:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80223b:	48 b8 4c 18 80 00 00 	movabs $0x80184c,%rax
+  802242:	00 00 00 
+  802245:	ff d0                	call   *%rax
+        return res;
+  802247:	eb dc                	jmp    802225 <open+0x91>
+        return -E_BAD_PATH;
+  802249:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  80224e:	eb d5                	jmp    802225 <open+0x91>
+
+0000000000802250 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  802250:	55                   	push   %rbp
+  802251:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc(FSREQ_SYNC, NULL);
+  802254:	be 00 00 00 00       	mov    $0x0,%esi
+  802259:	bf 08 00 00 00       	mov    $0x8,%edi
+  80225e:	48 b8 fe 1d 80 00 00 	movabs $0x801dfe,%rax
+  802265:	00 00 00 
+  802268:	ff d0                	call   *%rax
+}
+  80226a:	5d                   	pop    %rbp
+  80226b:	c3                   	ret
+
+000000000080226c <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  80226c:	55                   	push   %rbp
+  80226d:	48 89 e5             	mov    %rsp,%rbp
+  802270:	41 54                	push   %r12
+  802272:	53                   	push   %rbx
+  802273:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802276:	48 b8 e2 16 80 00 00 	movabs $0x8016e2,%rax
+  80227d:	00 00 00 
+  802280:	ff d0                	call   *%rax
+  802282:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  802285:	48 be a0 34 80 00 00 	movabs $0x8034a0,%rsi
+  80228c:	00 00 00 
+  80228f:	48 89 df             	mov    %rbx,%rdi
+  802292:	48 b8 e5 0c 80 00 00 	movabs $0x800ce5,%rax
+  802299:	00 00 00 
+  80229c:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  80229e:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  8022a3:	41 2b 04 24          	sub    (%r12),%eax
+  8022a7:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  8022ad:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8022b4:	00 00 00 
+    stat->st_dev = &devpipe;
+  8022b7:	48 b8 60 40 80 00 00 	movabs $0x804060,%rax
+  8022be:	00 00 00 
+  8022c1:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  8022c8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022cd:	5b                   	pop    %rbx
+  8022ce:	41 5c                	pop    %r12
+  8022d0:	5d                   	pop    %rbp
+  8022d1:	c3                   	ret
+
+00000000008022d2 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  8022d2:	55                   	push   %rbp
+  8022d3:	48 89 e5             	mov    %rsp,%rbp
+  8022d6:	41 54                	push   %r12
+  8022d8:	53                   	push   %rbx
+  8022d9:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8022dc:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8022e1:	48 89 fe             	mov    %rdi,%rsi
+  8022e4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8022e9:	49 bc 61 13 80 00 00 	movabs $0x801361,%r12
+  8022f0:	00 00 00 
+  8022f3:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  8022f6:	48 89 df             	mov    %rbx,%rdi
+  8022f9:	48 b8 e2 16 80 00 00 	movabs $0x8016e2,%rax
+  802300:	00 00 00 
+  802303:	ff d0                	call   *%rax
+  802305:	48 89 c6             	mov    %rax,%rsi
+  802308:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80230d:	bf 00 00 00 00       	mov    $0x0,%edi
+  802312:	41 ff d4             	call   *%r12
+}
+  802315:	5b                   	pop    %rbx
+  802316:	41 5c                	pop    %r12
+  802318:	5d                   	pop    %rbp
+  802319:	c3                   	ret
+
+000000000080231a <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  80231a:	55                   	push   %rbp
+  80231b:	48 89 e5             	mov    %rsp,%rbp
+  80231e:	41 57                	push   %r15
+  802320:	41 56                	push   %r14
+  802322:	41 55                	push   %r13
+  802324:	41 54                	push   %r12
+  802326:	53                   	push   %rbx
+  802327:	48 83 ec 18          	sub    $0x18,%rsp
+  80232b:	49 89 fc             	mov    %rdi,%r12
+  80232e:	49 89 f5             	mov    %rsi,%r13
+  802331:	49 89 d7             	mov    %rdx,%r15
+  802334:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802338:	48 b8 e2 16 80 00 00 	movabs $0x8016e2,%rax
+  80233f:	00 00 00 
+  802342:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  802344:	4d 85 ff             	test   %r15,%r15
+  802347:	0f 84 af 00 00 00    	je     8023fc <devpipe_write+0xe2>
+  80234d:	48 89 c3             	mov    %rax,%rbx
+  802350:	4c 89 f8             	mov    %r15,%rax
+  802353:	4d 89 ef             	mov    %r13,%r15
+  802356:	4c 01 e8             	add    %r13,%rax
+  802359:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80235d:	49 bd 69 12 80 00 00 	movabs $0x801269,%r13
+  802364:	00 00 00 
+            sys_yield();
+  802367:	49 be 06 12 80 00 00 	movabs $0x801206,%r14
+  80236e:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  802371:	8b 73 04             	mov    0x4(%rbx),%esi
+  802374:	48 63 ce             	movslq %esi,%rcx
+  802377:	48 63 03             	movslq (%rbx),%rax
+  80237a:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  802380:	48 39 c1             	cmp    %rax,%rcx
+  802383:	72 2e                	jb     8023b3 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802385:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80238a:	48 89 da             	mov    %rbx,%rdx
+  80238d:	be 00 10 00 00       	mov    $0x1000,%esi
+  802392:	4c 89 e7             	mov    %r12,%rdi
+  802395:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  802398:	85 c0                	test   %eax,%eax
+  80239a:	74 66                	je     802402 <devpipe_write+0xe8>
+            sys_yield();
+  80239c:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  80239f:	8b 73 04             	mov    0x4(%rbx),%esi
+  8023a2:	48 63 ce             	movslq %esi,%rcx
+  8023a5:	48 63 03             	movslq (%rbx),%rax
+  8023a8:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  8023ae:	48 39 c1             	cmp    %rax,%rcx
+  8023b1:	73 d2                	jae    802385 <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8023b3:	41 0f b6 3f          	movzbl (%r15),%edi
+  8023b7:	48 89 ca             	mov    %rcx,%rdx
+  8023ba:	48 c1 ea 03          	shr    $0x3,%rdx
+  8023be:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  8023c5:	08 10 20 
+  8023c8:	48 f7 e2             	mul    %rdx
+  8023cb:	48 c1 ea 06          	shr    $0x6,%rdx
+  8023cf:	48 89 d0             	mov    %rdx,%rax
+  8023d2:	48 c1 e0 09          	shl    $0x9,%rax
+  8023d6:	48 29 d0             	sub    %rdx,%rax
+  8023d9:	48 c1 e0 03          	shl    $0x3,%rax
+  8023dd:	48 29 c1             	sub    %rax,%rcx
+  8023e0:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  8023e5:	83 c6 01             	add    $0x1,%esi
+  8023e8:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8023eb:	49 83 c7 01          	add    $0x1,%r15
+  8023ef:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8023f3:	49 39 c7             	cmp    %rax,%r15
+  8023f6:	0f 85 75 ff ff ff    	jne    802371 <devpipe_write+0x57>
+    return n;
+  8023fc:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802400:	eb 05                	jmp    802407 <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  802402:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802407:	48 83 c4 18          	add    $0x18,%rsp
+  80240b:	5b                   	pop    %rbx
+  80240c:	41 5c                	pop    %r12
+  80240e:	41 5d                	pop    %r13
+  802410:	41 5e                	pop    %r14
+  802412:	41 5f                	pop    %r15
+  802414:	5d                   	pop    %rbp
+  802415:	c3                   	ret
+
+0000000000802416 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  802416:	55                   	push   %rbp
+  802417:	48 89 e5             	mov    %rsp,%rbp
+  80241a:	41 57                	push   %r15
+  80241c:	41 56                	push   %r14
+  80241e:	41 55                	push   %r13
+  802420:	41 54                	push   %r12
+  802422:	53                   	push   %rbx
+  802423:	48 83 ec 18          	sub    $0x18,%rsp
+  802427:	49 89 fc             	mov    %rdi,%r12
+  80242a:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  80242e:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802432:	48 b8 e2 16 80 00 00 	movabs $0x8016e2,%rax
+  802439:	00 00 00 
+  80243c:	ff d0                	call   *%rax
+  80243e:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  802441:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802447:	49 bd 69 12 80 00 00 	movabs $0x801269,%r13
+  80244e:	00 00 00 
+            sys_yield();
+  802451:	49 be 06 12 80 00 00 	movabs $0x801206,%r14
+  802458:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  80245b:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  802460:	74 7d                	je     8024df <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  802462:	8b 03                	mov    (%rbx),%eax
+  802464:	3b 43 04             	cmp    0x4(%rbx),%eax
+  802467:	75 26                	jne    80248f <devpipe_read+0x79>
+            if (i > 0) return i;
+  802469:	4d 85 ff             	test   %r15,%r15
+  80246c:	75 77                	jne    8024e5 <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80246e:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802473:	48 89 da             	mov    %rbx,%rdx
+  802476:	be 00 10 00 00       	mov    $0x1000,%esi
+  80247b:	4c 89 e7             	mov    %r12,%rdi
+  80247e:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  802481:	85 c0                	test   %eax,%eax
+  802483:	74 72                	je     8024f7 <devpipe_read+0xe1>
+            sys_yield();
+  802485:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  802488:	8b 03                	mov    (%rbx),%eax
+  80248a:	3b 43 04             	cmp    0x4(%rbx),%eax
+  80248d:	74 df                	je     80246e <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  80248f:	48 63 c8             	movslq %eax,%rcx
+  802492:	48 89 ca             	mov    %rcx,%rdx
+  802495:	48 c1 ea 03          	shr    $0x3,%rdx
+  802499:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  8024a0:	08 10 20 
+  8024a3:	48 89 d0             	mov    %rdx,%rax
+  8024a6:	48 f7 e6             	mul    %rsi
+  8024a9:	48 c1 ea 06          	shr    $0x6,%rdx
+  8024ad:	48 89 d0             	mov    %rdx,%rax
+  8024b0:	48 c1 e0 09          	shl    $0x9,%rax
+  8024b4:	48 29 d0             	sub    %rdx,%rax
+  8024b7:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  8024be:	00 
+  8024bf:	48 89 c8             	mov    %rcx,%rax
+  8024c2:	48 29 d0             	sub    %rdx,%rax
+  8024c5:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  8024ca:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8024ce:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  8024d2:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8024d5:	49 83 c7 01          	add    $0x1,%r15
+  8024d9:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  8024dd:	75 83                	jne    802462 <devpipe_read+0x4c>
+    return n;
+  8024df:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8024e3:	eb 03                	jmp    8024e8 <devpipe_read+0xd2>
+            if (i > 0) return i;
+  8024e5:	4c 89 f8             	mov    %r15,%rax
+}
+  8024e8:	48 83 c4 18          	add    $0x18,%rsp
+  8024ec:	5b                   	pop    %rbx
+  8024ed:	41 5c                	pop    %r12
+  8024ef:	41 5d                	pop    %r13
+  8024f1:	41 5e                	pop    %r14
+  8024f3:	41 5f                	pop    %r15
+  8024f5:	5d                   	pop    %rbp
+  8024f6:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  8024f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024fc:	eb ea                	jmp    8024e8 <devpipe_read+0xd2>
+
+00000000008024fe <pipe>:
+pipe(int pfd[2]) {
+  8024fe:	55                   	push   %rbp
+  8024ff:	48 89 e5             	mov    %rsp,%rbp
+  802502:	41 55                	push   %r13
+  802504:	41 54                	push   %r12
+  802506:	53                   	push   %rbx
+  802507:	48 81 ec b8 00 00 00 	sub    $0xb8,%rsp
+  80250e:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  802511:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802515:	48 b8 77 17 80 00 00 	movabs $0x801777,%rax
+  80251c:	00 00 00 
+  80251f:	ff d0                	call   *%rax
+  802521:	89 c3                	mov    %eax,%ebx
+  802523:	85 c0                	test   %eax,%eax
+  802525:	0f 88 51 01 00 00    	js     80267c <pipe+0x17e>
+        (res = fd_alloc_from(fd2num(fd0) + 1, &fd1)) < 0) goto err;
+  80252b:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80252f:	48 b8 d0 16 80 00 00 	movabs $0x8016d0,%rax
+  802536:	00 00 00 
+  802539:	ff d0                	call   *%rax
+  80253b:	8d 78 01             	lea    0x1(%rax),%edi
+  80253e:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802542:	48 b8 fe 16 80 00 00 	movabs $0x8016fe,%rax
+  802549:	00 00 00 
+  80254c:	ff d0                	call   *%rax
+  80254e:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  802550:	85 c0                	test   %eax,%eax
+  802552:	0f 88 24 01 00 00    	js     80267c <pipe+0x17e>
+    va = fd2data(fd0);
+  802558:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80255c:	48 bb e2 16 80 00 00 	movabs $0x8016e2,%rbx
+  802563:	00 00 00 
+  802566:	ff d3                	call   *%rbx
+  802568:	49 89 c5             	mov    %rax,%r13
+    struct RegionOp ops[] = {
+  80256b:	48 8d bd 30 ff ff ff 	lea    -0xd0(%rbp),%rdi
+  802572:	b9 14 00 00 00       	mov    $0x14,%ecx
+  802577:	b8 00 00 00 00       	mov    $0x0,%eax
+  80257c:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+  80257f:	c7 85 34 ff ff ff 46 	movl   $0x46,-0xcc(%rbp)
+  802586:	00 00 00 
+  802589:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80258d:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+  802594:	48 c7 85 50 ff ff ff 	movq   $0x1000,-0xb0(%rbp)
+  80259b:	00 10 00 00 
+  80259f:	c7 85 5c ff ff ff 46 	movl   $0x46,-0xa4(%rbp)
+  8025a6:	00 00 00 
+            {.type = REGION_ALLOC, .dstva = (uintptr_t)fd1, .size = PAGE_SIZE, .perm = PROT_RW | PROT_SHARE},
+  8025a9:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+    struct RegionOp ops[] = {
+  8025ad:	48 89 bd 70 ff ff ff 	mov    %rdi,-0x90(%rbp)
+  8025b4:	48 c7 85 78 ff ff ff 	movq   $0x1000,-0x88(%rbp)
+  8025bb:	00 10 00 00 
+  8025bf:	c7 45 84 46 00 00 00 	movl   $0x46,-0x7c(%rbp)
+  8025c6:	4c 89 6d 98          	mov    %r13,-0x68(%rbp)
+  8025ca:	48 c7 45 a0 00 10 00 	movq   $0x1000,-0x60(%rbp)
+  8025d1:	00 
+  8025d2:	c7 45 a8 01 00 00 00 	movl   $0x1,-0x58(%rbp)
+  8025d9:	c7 45 ac 46 00 00 00 	movl   $0x46,-0x54(%rbp)
+  8025e0:	4c 89 6d b8          	mov    %r13,-0x48(%rbp)
+            {.type = REGION_MAP, .srcva = (uintptr_t)va, .dstva = (uintptr_t)fd2data(fd1), .size = PAGE_SIZE, .perm = PROT_RW | PROT_SHARE},
+  8025e4:	ff d3                	call   *%rbx
+    struct RegionOp ops[] = {
+  8025e6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8025ea:	48 c7 45 c8 00 10 00 	movq   $0x1000,-0x38(%rbp)
+  8025f1:	00 
+    if ((res = sys_region_batch(ops, sizeof ops / sizeof *ops)) < 0) goto err1;
+  8025f2:	be 04 00 00 00       	mov    $0x4,%esi
+  8025f7:	48 8d bd 30 ff ff ff 	lea    -0xd0(%rbp),%rdi
+  8025fe:	48 b8 c8 13 80 00 00 	movabs $0x8013c8,%rax
+  802605:	00 00 00 
+  802608:	ff d0                	call   *%rax
+  80260a:	89 c3                	mov    %eax,%ebx
+  80260c:	85 c0                	test   %eax,%eax
+  80260e:	0f 88 ad 00 00 00    	js     8026c1 <pipe+0x1c3>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  802614:	be 00 10 00 00       	mov    $0x1000,%esi
+  802619:	4c 89 ef             	mov    %r13,%rdi
+  80261c:	48 b8 37 12 80 00 00 	movabs $0x801237,%rax
+  802623:	00 00 00 
+  802626:	ff d0                	call   *%rax
+  802628:	83 f8 02             	cmp    $0x2,%eax
+  80262b:	75 5f                	jne    80268c <pipe+0x18e>
+    fd0->fd_dev_id = devpipe.dev_id;
+  80262d:	a1 60 40 80 00 00 00 	movabs 0x804060,%eax
+  802634:	00 00 
+  802636:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80263a:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  80263c:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802640:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  802647:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  80264b:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  80264d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802651:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  802658:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80265c:	48 bb d0 16 80 00 00 	movabs $0x8016d0,%rbx
+  802663:	00 00 00 
+  802666:	ff d3                	call   *%rbx
+  802668:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  80266c:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  802670:	ff d3                	call   *%rbx
+  802672:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  802677:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  80267c:	89 d8                	mov    %ebx,%eax
+  80267e:	48 81 c4 b8 00 00 00 	add    $0xb8,%rsp
+  802685:	5b                   	pop    %rbx
+  802686:	41 5c                	pop    %r12
+  802688:	41 5d                	pop    %r13
+  80268a:	5d                   	pop    %rbp
+  80268b:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  80268c:	48 b9 d0 34 80 00 00 	movabs $0x8034d0,%rcx
+  802693:	00 00 00 
+  802696:	48 ba a7 34 80 00 00 	movabs $0x8034a7,%rdx
+  80269d:	00 00 00 
+  8026a0:	be 33 00 00 00       	mov    $0x33,%esi
+  8026a5:	48 bf bc 34 80 00 00 	movabs $0x8034bc,%rdi
+  8026ac:	00 00 00 
+  8026af:	b8 00 00 00 00       	mov    $0x0,%eax
+  8026b4:	49 b8 70 02 80 00 00 	movabs $0x800270,%r8
+  8026bb:	00 00 00 
+  8026be:	41 ff d0             	call   *%r8
+        ops[i].type = REGION_UNMAP;
+  8026c1:	c7 85 30 ff ff ff 02 	movl   $0x2,-0xd0(%rbp)
+  8026c8:	00 00 00 
+  8026cb:	c7 85 58 ff ff ff 02 	movl   $0x2,-0xa8(%rbp)
+  8026d2:	00 00 00 
+  8026d5:	c7 45 80 02 00 00 00 	movl   $0x2,-0x80(%rbp)
+  8026dc:	c7 45 a8 02 00 00 00 	movl   $0x2,-0x58(%rbp)
+    sys_region_batch(ops, sizeof ops / sizeof *ops);
+  8026e3:	be 04 00 00 00       	mov    $0x4,%esi
+  8026e8:	48 8d bd 30 ff ff ff 	lea    -0xd0(%rbp),%rdi
+  8026ef:	48 b8 c8 13 80 00 00 	movabs $0x8013c8,%rax
+  8026f6:	00 00 00 
+  8026f9:	ff d0                	call   *%rax
+  8026fb:	e9 7c ff ff ff       	jmp    80267c <pipe+0x17e>
+
+0000000000802700 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  802700:	55                   	push   %rbp
+  802701:	48 89 e5             	mov    %rsp,%rbp
+  802704:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  802708:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80270c:	48 b8 91 17 80 00 00 	movabs $0x801791,%rax
+  802713:	00 00 00 
+  802716:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802718:	85 c0                	test   %eax,%eax
+  80271a:	78 35                	js     802751 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  80271c:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802720:	48 b8 e2 16 80 00 00 	movabs $0x8016e2,%rax
+  802727:	00 00 00 
+  80272a:	ff d0                	call   *%rax
+  80272c:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80272f:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802734:	be 00 10 00 00       	mov    $0x1000,%esi
+  802739:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80273d:	48 b8 69 12 80 00 00 	movabs $0x801269,%rax
+  802744:	00 00 00 
+  802747:	ff d0                	call   *%rax
+  802749:	85 c0                	test   %eax,%eax
+  80274b:	0f 94 c0             	sete   %al
+  80274e:	0f b6 c0             	movzbl %al,%eax
+}
+  802751:	c9                   	leave
+  802752:	c3                   	ret
+
+0000000000802753 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  802753:	48 89 f8             	mov    %rdi,%rax
+  802756:	48 c1 e8 27          	shr    $0x27,%rax
+  80275a:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  802761:	01 00 00 
+  802764:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802768:	f6 c2 01             	test   $0x1,%dl
+  80276b:	74 6d                	je     8027da <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  80276d:	48 89 f8             	mov    %rdi,%rax
+  802770:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802774:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  80277b:	01 00 00 
+  80277e:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802782:	f6 c2 01             	test   $0x1,%dl
+  802785:	74 62                	je     8027e9 <get_uvpt_entry+0x96>
+  802787:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  80278e:	01 00 00 
+  802791:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802795:	f6 c2 80             	test   $0x80,%dl
+  802798:	75 4f                	jne    8027e9 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  80279a:	48 89 f8             	mov    %rdi,%rax
+  80279d:	48 c1 e8 15          	shr    $0x15,%rax
+  8027a1:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8027a8:	01 00 00 
+  8027ab:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8027af:	f6 c2 01             	test   $0x1,%dl
+  8027b2:	74 44                	je     8027f8 <get_uvpt_entry+0xa5>
+  8027b4:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8027bb:	01 00 00 
+  8027be:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8027c2:	f6 c2 80             	test   $0x80,%dl
+  8027c5:	75 31                	jne    8027f8 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  8027c7:	48 c1 ef 0c          	shr    $0xc,%rdi
+  8027cb:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8027d2:	01 00 00 
+  8027d5:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  8027d9:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8027da:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  8027e1:	01 00 00 
+  8027e4:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8027e8:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8027e9:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8027f0:	01 00 00 
+  8027f3:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8027f7:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8027f8:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8027ff:	01 00 00 
+  802802:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802806:	c3                   	ret
+
+0000000000802807 <get_prot>:
+
+int
+get_prot(void *va) {
+  802807:	55                   	push   %rbp
+  802808:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  80280b:	48 b8 53 27 80 00 00 	movabs $0x802753,%rax
+  802812:	00 00 00 
+  802815:	ff d0                	call   *%rax
+  802817:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  80281a:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  80281f:	89 c1                	mov    %eax,%ecx
+  802821:	83 c9 04             	or     $0x4,%ecx
+  802824:	f6 c2 01             	test   $0x1,%dl
+  802827:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  80282a:	89 c1                	mov    %eax,%ecx
+  80282c:	83 c9 02             	or     $0x2,%ecx
+  80282f:	f6 c2 02             	test   $0x2,%dl
+  802832:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  802835:	89 c1                	mov    %eax,%ecx
+  802837:	83 c9 01             	or     $0x1,%ecx
+  80283a:	48 85 d2             	test   %rdx,%rdx
+  80283d:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  802840:	89 c1                	mov    %eax,%ecx
+  802842:	83 c9 40             	or     $0x40,%ecx
+  802845:	f6 c6 04             	test   $0x4,%dh
+  802848:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  80284b:	5d                   	pop    %rbp
+  80284c:	c3                   	ret
+
+000000000080284d <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  80284d:	55                   	push   %rbp
+  80284e:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  802851:	48 b8 53 27 80 00 00 	movabs $0x802753,%rax
+  802858:	00 00 00 
+  80285b:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  80285d:	48 c1 e8 06          	shr    $0x6,%rax
+  802861:	83 e0 01             	and    $0x1,%eax
+}
+  802864:	5d                   	pop    %rbp
+  802865:	c3                   	ret
+
+0000000000802866 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  802866:	55                   	push   %rbp
+  802867:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  80286a:	48 b8 53 27 80 00 00 	movabs $0x802753,%rax
+  802871:	00 00 00 
+  802874:	ff d0                	call   *%rax
+  802876:	83 e0 01             	and    $0x1,%eax
+}
+  802879:	5d                   	pop    %rbp
+  80287a:	c3                   	ret
+
+000000000080287b <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  80287b:	55                   	push   %rbp
+  80287c:	48 89 e5             	mov    %rsp,%rbp
+  80287f:	41 57                	push   %r15
+  802881:	41 56                	push   %r14
+  802883:	41 55                	push   %r13
+  802885:	41 54                	push   %r12
+  802887:	53                   	push   %rbx
+  802888:	48 83 ec 38          	sub    $0x38,%rsp
+  80288c:	49 89 f7             	mov    %rsi,%r15
+  80288f:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+                    }
+                    continue;
+                }
+                for (int ptei = 0; ptei < PT_ENTRY_COUNT; ptei++) {
+                    uintptr_t pte_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, pdei, ptei, 0);
+                    pte_t pte = uvpt[VPT(pte_addr)];
+  802895:	49 bd 00 00 00 00 00 	movabs $0x10000000000,%r13
+  80289c:	01 00 00 
+  80289f:	4d 89 e6             	mov    %r12,%r14
+  8028a2:	49 89 fc             	mov    %rdi,%r12
+  8028a5:	e9 19 01 00 00       	jmp    8029c3 <foreach_shared_region+0x148>
+  8028aa:	48 89 5d b0          	mov    %rbx,-0x50(%rbp)
+  8028ae:	4c 89 75 a8          	mov    %r14,-0x58(%rbp)
+  8028b2:	eb 52                	jmp    802906 <foreach_shared_region+0x8b>
+                for (int ptei = 0; ptei < PT_ENTRY_COUNT; ptei++) {
+  8028b4:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8028bb:	48 81 fb 00 00 20 00 	cmp    $0x200000,%rbx
+  8028c2:	74 2e                	je     8028f2 <foreach_shared_region+0x77>
+                    uintptr_t pte_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, pdei, ptei, 0);
+  8028c4:	48 89 df             	mov    %rbx,%rdi
+  8028c7:	4c 09 f7             	or     %r14,%rdi
+                    pte_t pte = uvpt[VPT(pte_addr)];
+  8028ca:	48 89 f8             	mov    %rdi,%rax
+  8028cd:	48 c1 e8 0c          	shr    $0xc,%rax
+  8028d1:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+                    if ((pte & PTE_P) && (pte & PTE_SHARE)) {
+  8028d6:	25 01 04 00 00       	and    $0x401,%eax
+  8028db:	48 3d 01 04 00 00    	cmp    $0x401,%rax
+  8028e1:	75 d1                	jne    8028b4 <foreach_shared_region+0x39>
+                        fun((void*)pte_addr, (void*)(pte_addr + PAGE_SIZE), arg);
+  8028e3:	48 8d b7 00 10 00 00 	lea    0x1000(%rdi),%rsi
+  8028ea:	4c 89 fa             	mov    %r15,%rdx
+  8028ed:	41 ff d4             	call   *%r12
+  8028f0:	eb c2                	jmp    8028b4 <foreach_shared_region+0x39>
+            for (int pdei = 0; pdei < PD_ENTRY_COUNT; pdei++) {
+  8028f2:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  8028f9:	00 
+  8028fa:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8028fe:	48 3d 00 00 00 40    	cmp    $0x40000000,%rax
+  802904:	74 46                	je     80294c <foreach_shared_region+0xd1>
+                uintptr_t pde_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, pdei, 0, 0);
+  802906:	4c 8b 75 c8          	mov    -0x38(%rbp),%r14
+  80290a:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80290e:	49 09 c6             	or     %rax,%r14
+                pde_t pde = uvpd[VPD(pde_addr)];
+  802911:	4c 89 f0             	mov    %r14,%rax
+  802914:	48 c1 e8 15          	shr    $0x15,%rax
+  802918:	48 b9 00 00 00 80 00 	movabs $0x10080000000,%rcx
+  80291f:	01 00 00 
+  802922:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+                if (!(pde & PTE_P)) {
+  802926:	a8 01                	test   $0x1,%al
+  802928:	74 c8                	je     8028f2 <foreach_shared_region+0x77>
+                if (pde & PTE_PS) {
+  80292a:	48 89 c3             	mov    %rax,%rbx
+  80292d:	81 e3 80 00 00 00    	and    $0x80,%ebx
+  802933:	74 8f                	je     8028c4 <foreach_shared_region+0x49>
+                    if (pde & PTE_SHARE) {
+  802935:	f6 c4 04             	test   $0x4,%ah
+  802938:	74 b8                	je     8028f2 <foreach_shared_region+0x77>
+                        fun((void*)pde_addr, (void*)(pde_addr + 1024 * 1024 * 2), arg);
+  80293a:	49 8d b6 00 00 20 00 	lea    0x200000(%r14),%rsi
+  802941:	4c 89 fa             	mov    %r15,%rdx
+  802944:	4c 89 f7             	mov    %r14,%rdi
+  802947:	41 ff d4             	call   *%r12
+  80294a:	eb a6                	jmp    8028f2 <foreach_shared_region+0x77>
+  80294c:	48 8b 5d b0          	mov    -0x50(%rbp),%rbx
+  802950:	4c 8b 75 a8          	mov    -0x58(%rbp),%r14
+        for (int pdpei = 0; pdpei < PDP_ENTRY_COUNT; pdpei++) {
+  802954:	48 81 c3 00 00 00 40 	add    $0x40000000,%rbx
+  80295b:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802962:	00 00 00 
+  802965:	48 39 c3             	cmp    %rax,%rbx
+  802968:	74 4c                	je     8029b6 <foreach_shared_region+0x13b>
+            uintptr_t pdpe_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, 0, 0, 0);
+  80296a:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  80296e:	48 09 d8             	or     %rbx,%rax
+  802971:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+            pdpe_t pdpe = uvpdp[VPDP(pdpe_addr)];
+  802975:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802979:	48 b9 00 00 40 80 00 	movabs $0x10080400000,%rcx
+  802980:	01 00 00 
+  802983:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+            if (!(pdpe & PTE_P)) {
+  802987:	a8 01                	test   $0x1,%al
+  802989:	74 c9                	je     802954 <foreach_shared_region+0xd9>
+            if (pdpe & PTE_PS) {
+  80298b:	48 89 c1             	mov    %rax,%rcx
+  80298e:	81 e1 80 00 00 00    	and    $0x80,%ecx
+  802994:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  802998:	0f 84 0c ff ff ff    	je     8028aa <foreach_shared_region+0x2f>
+                if (pdpe & PTE_SHARE) {
+  80299e:	f6 c4 04             	test   $0x4,%ah
+  8029a1:	74 b1                	je     802954 <foreach_shared_region+0xd9>
+                    fun((void*)pdpe_addr, (void*)(pdpe_addr + 1024 * 1024 * 1024), arg); 
+  8029a3:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  8029a7:	48 8d b7 00 00 00 40 	lea    0x40000000(%rdi),%rsi
+  8029ae:	4c 89 fa             	mov    %r15,%rdx
+  8029b1:	41 ff d4             	call   *%r12
+  8029b4:	eb 9e                	jmp    802954 <foreach_shared_region+0xd9>
+    for (int pml4ei = 0; pml4ei < PML4_ENTRY_COUNT; pml4ei++) {
+  8029b6:	49 83 c6 01          	add    $0x1,%r14
+  8029ba:	49 81 fe 00 02 00 00 	cmp    $0x200,%r14
+  8029c1:	74 24                	je     8029e7 <foreach_shared_region+0x16c>
+        pml4e_t pml4e = uvpml4[VPML4(pml4_addr)];
+  8029c3:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  8029ca:	01 00 00 
+  8029cd:	4a 8b 04 f0          	mov    (%rax,%r14,8),%rax
+        if (!(pml4e & PTE_P)) {
+  8029d1:	a8 01                	test   $0x1,%al
+  8029d3:	74 e1                	je     8029b6 <foreach_shared_region+0x13b>
+  8029d5:	4c 89 f0             	mov    %r14,%rax
+  8029d8:	48 c1 e0 27          	shl    $0x27,%rax
+  8029dc:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8029e0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8029e5:	eb 83                	jmp    80296a <foreach_shared_region+0xef>
+            }
+        }
+    }
+    
+    return 0;
+}
+  8029e7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029ec:	48 83 c4 38          	add    $0x38,%rsp
+  8029f0:	5b                   	pop    %rbx
+  8029f1:	41 5c                	pop    %r12
+  8029f3:	41 5d                	pop    %r13
+  8029f5:	41 5e                	pop    %r14
+  8029f7:	41 5f                	pop    %r15
+  8029f9:	5d                   	pop    %rbp
+  8029fa:	c3                   	ret
+
+00000000008029fb <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  8029fb:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a00:	c3                   	ret
+
+0000000000802a01 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  802a01:	55                   	push   %rbp
+  802a02:	48 89 e5             	mov    %rsp,%rbp
+  802a05:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  802a08:	48 be f4 34 80 00 00 	movabs $0x8034f4,%rsi
+  802a0f:	00 00 00 
+  802a12:	48 b8 e5 0c 80 00 00 	movabs $0x800ce5,%rax
+  802a19:	00 00 00 
+  802a1c:	ff d0                	call   *%rax
+    return 0;
+}
+  802a1e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a23:	5d                   	pop    %rbp
+  802a24:	c3                   	ret
+
+0000000000802a25 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  802a25:	55                   	push   %rbp
+  802a26:	48 89 e5             	mov    %rsp,%rbp
+  802a29:	41 57                	push   %r15
+  802a2b:	41 56                	push   %r14
+  802a2d:	41 55                	push   %r13
+  802a2f:	41 54                	push   %r12
+  802a31:	53                   	push   %rbx
+  802a32:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  802a39:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  802a40:	48 85 d2             	test   %rdx,%rdx
+  802a43:	74 7a                	je     802abf <devcons_write+0x9a>
+  802a45:	49 89 d6             	mov    %rdx,%r14
+  802a48:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802a4e:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  802a53:	49 bf df 0e 80 00 00 	movabs $0x800edf,%r15
+  802a5a:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  802a5d:	4c 89 f3             	mov    %r14,%rbx
+  802a60:	48 29 f3             	sub    %rsi,%rbx
+  802a63:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802a68:	48 39 c3             	cmp    %rax,%rbx
+  802a6b:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  802a6f:	4c 63 eb             	movslq %ebx,%r13
+  802a72:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  802a79:	48 01 c6             	add    %rax,%rsi
+  802a7c:	4c 89 ea             	mov    %r13,%rdx
+  802a7f:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802a86:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  802a89:	4c 89 ee             	mov    %r13,%rsi
+  802a8c:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802a93:	48 b8 0c 11 80 00 00 	movabs $0x80110c,%rax
+  802a9a:	00 00 00 
+  802a9d:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  802a9f:	41 01 dc             	add    %ebx,%r12d
+  802aa2:	49 63 f4             	movslq %r12d,%rsi
+  802aa5:	4c 39 f6             	cmp    %r14,%rsi
+  802aa8:	72 b3                	jb     802a5d <devcons_write+0x38>
+    return res;
+  802aaa:	49 63 c4             	movslq %r12d,%rax
+}
+  802aad:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  802ab4:	5b                   	pop    %rbx
+  802ab5:	41 5c                	pop    %r12
+  802ab7:	41 5d                	pop    %r13
+  802ab9:	41 5e                	pop    %r14
+  802abb:	41 5f                	pop    %r15
+  802abd:	5d                   	pop    %rbp
+  802abe:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  802abf:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802ac5:	eb e3                	jmp    802aaa <devcons_write+0x85>
+
+0000000000802ac7 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  802ac7:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  802aca:	ba 00 00 00 00       	mov    $0x0,%edx
+  802acf:	48 85 c0             	test   %rax,%rax
+  802ad2:	74 55                	je     802b29 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  802ad4:	55                   	push   %rbp
+  802ad5:	48 89 e5             	mov    %rsp,%rbp
+  802ad8:	41 55                	push   %r13
+  802ada:	41 54                	push   %r12
+  802adc:	53                   	push   %rbx
+  802add:	48 83 ec 08          	sub    $0x8,%rsp
+  802ae1:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  802ae4:	48 bb 39 11 80 00 00 	movabs $0x801139,%rbx
+  802aeb:	00 00 00 
+  802aee:	49 bc 06 12 80 00 00 	movabs $0x801206,%r12
+  802af5:	00 00 00 
+  802af8:	eb 03                	jmp    802afd <devcons_read+0x36>
+  802afa:	41 ff d4             	call   *%r12
+  802afd:	ff d3                	call   *%rbx
+  802aff:	85 c0                	test   %eax,%eax
+  802b01:	74 f7                	je     802afa <devcons_read+0x33>
+    if (c < 0) return c;
+  802b03:	48 63 d0             	movslq %eax,%rdx
+  802b06:	78 13                	js     802b1b <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  802b08:	ba 00 00 00 00       	mov    $0x0,%edx
+  802b0d:	83 f8 04             	cmp    $0x4,%eax
+  802b10:	74 09                	je     802b1b <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  802b12:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  802b16:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  802b1b:	48 89 d0             	mov    %rdx,%rax
+  802b1e:	48 83 c4 08          	add    $0x8,%rsp
+  802b22:	5b                   	pop    %rbx
+  802b23:	41 5c                	pop    %r12
+  802b25:	41 5d                	pop    %r13
+  802b27:	5d                   	pop    %rbp
+  802b28:	c3                   	ret
+  802b29:	48 89 d0             	mov    %rdx,%rax
+  802b2c:	c3                   	ret
+
+0000000000802b2d <cputchar>:
+cputchar(int ch) {
+  802b2d:	55                   	push   %rbp
+  802b2e:	48 89 e5             	mov    %rsp,%rbp
+  802b31:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  802b35:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  802b39:	be 01 00 00 00       	mov    $0x1,%esi
+  802b3e:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  802b42:	48 b8 0c 11 80 00 00 	movabs $0x80110c,%rax
+  802b49:	00 00 00 
+  802b4c:	ff d0                	call   *%rax
+}
+  802b4e:	c9                   	leave
+  802b4f:	c3                   	ret
+
+0000000000802b50 <getchar>:
+getchar(void) {
+  802b50:	55                   	push   %rbp
+  802b51:	48 89 e5             	mov    %rsp,%rbp
+  802b54:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  802b58:	ba 01 00 00 00       	mov    $0x1,%edx
+  802b5d:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  802b61:	bf 00 00 00 00       	mov    $0x0,%edi
+  802b66:	48 b8 74 1a 80 00 00 	movabs $0x801a74,%rax
+  802b6d:	00 00 00 
+  802b70:	ff d0                	call   *%rax
+  802b72:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  802b74:	85 c0                	test   %eax,%eax
+  802b76:	78 06                	js     802b7e <getchar+0x2e>
+  802b78:	74 08                	je     802b82 <getchar+0x32>
+  802b7a:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  802b7e:	89 d0                	mov    %edx,%eax
+  802b80:	c9                   	leave
+  802b81:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  802b82:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  802b87:	eb f5                	jmp    802b7e <getchar+0x2e>
+
+0000000000802b89 <iscons>:
+iscons(int fdnum) {
+  802b89:	55                   	push   %rbp
+  802b8a:	48 89 e5             	mov    %rsp,%rbp
+  802b8d:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  802b91:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802b95:	48 b8 91 17 80 00 00 	movabs $0x801791,%rax
+  802b9c:	00 00 00 
+  802b9f:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802ba1:	85 c0                	test   %eax,%eax
+  802ba3:	78 18                	js     802bbd <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  802ba5:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802ba9:	48 b8 a0 40 80 00 00 	movabs $0x8040a0,%rax
+  802bb0:	00 00 00 
+  802bb3:	8b 00                	mov    (%rax),%eax
+  802bb5:	39 02                	cmp    %eax,(%rdx)
+  802bb7:	0f 94 c0             	sete   %al
+  802bba:	0f b6 c0             	movzbl %al,%eax
+}
+  802bbd:	c9                   	leave
+  802bbe:	c3                   	ret
+
+0000000000802bbf <opencons>:
+opencons(void) {
+  802bbf:	55                   	push   %rbp
+  802bc0:	48 89 e5             	mov    %rsp,%rbp
+  802bc3:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802bc7:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  802bcb:	48 b8 77 17 80 00 00 	movabs $0x801777,%rax
+  802bd2:	00 00 00 
+  802bd5:	ff d0                	call   *%rax
+  802bd7:	85 c0                	test   %eax,%eax
+  802bd9:	78 49                	js     802c24 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  802bdb:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802be0:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802be5:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  802be9:	bf 00 00 00 00       	mov    $0x0,%edi
+  802bee:	48 b8 95 12 80 00 00 	movabs $0x801295,%rax
+  802bf5:	00 00 00 
+  802bf8:	ff d0                	call   *%rax
+  802bfa:	85 c0                	test   %eax,%eax
+  802bfc:	78 26                	js     802c24 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  802bfe:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802c02:	a1 a0 40 80 00 00 00 	movabs 0x8040a0,%eax
+  802c09:	00 00 
+  802c0b:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  802c0d:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802c11:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  802c18:	48 b8 d0 16 80 00 00 	movabs $0x8016d0,%rax
+  802c1f:	00 00 00 
+  802c22:	ff d0                	call   *%rax
+}
+  802c24:	c9                   	leave
+  802c25:	c3                   	ret
+
+0000000000802c26 <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  802c26:	55                   	push   %rbp
+  802c27:	48 89 e5             	mov    %rsp,%rbp
+  802c2a:	41 55                	push   %r13
+  802c2c:	41 54                	push   %r12
+  802c2e:	53                   	push   %rbx
+  802c2f:	48 83 ec 08          	sub    $0x8,%rsp
+  802c33:	49 89 fc             	mov    %rdi,%r12
+  802c36:	48 89 f7             	mov    %rsi,%rdi
+  802c39:	48 89 d3             	mov    %rdx,%rbx
+  802c3c:	49 89 cd             	mov    %rcx,%r13
+    // LAB 9: Your code here:
+    int res = sys_ipc_recv(!pg ? (void*)MAX_USER_ADDRESS : pg, !size ? 0 : *size);
+  802c3f:	be 00 00 00 00       	mov    $0x0,%esi
+  802c44:	48 85 d2             	test   %rdx,%rdx
+  802c47:	74 03                	je     802c4c <ipc_recv+0x26>
+  802c49:	48 8b 32             	mov    (%rdx),%rsi
+  802c4c:	48 85 ff             	test   %rdi,%rdi
+  802c4f:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802c56:	00 00 00 
+  802c59:	48 0f 44 f8          	cmove  %rax,%rdi
+  802c5d:	48 b8 67 16 80 00 00 	movabs $0x801667,%rax
+  802c64:	00 00 00 
+  802c67:	ff d0                	call   *%rax
+    if (res < 0) {
+  802c69:	85 c0                	test   %eax,%eax
+  802c6b:	78 66                	js     802cd3 <ipc_recv+0xad>
+        if (size) {
+            *size = 0;
+        }
+        return res;
+    }
+    if (from_env_store) {
+  802c6d:	4d 85 e4             	test   %r12,%r12
+  802c70:	74 14                	je     802c86 <ipc_recv+0x60>
+        *from_env_store = thisenv->env_ipc_from;
+  802c72:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802c79:	00 00 00 
+  802c7c:	8b 80 ac 01 00 00    	mov    0x1ac(%rax),%eax
+  802c82:	41 89 04 24          	mov    %eax,(%r12)
+    }
+    if (perm_store) {
+  802c86:	4d 85 ed             	test   %r13,%r13
+  802c89:	74 14                	je     802c9f <ipc_recv+0x79>
+        *perm_store = thisenv->env_ipc_perm;
+  802c8b:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802c92:	00 00 00 
+  802c95:	8b 80 b0 01 00 00    	mov    0x1b0(%rax),%eax
+  802c9b:	41 89 45 00          	mov    %eax,0x0(%r13)
+    }
+    if (size) {
+  802c9f:	48 85 db             	test   %rbx,%rbx
+  802ca2:	74 14                	je     802cb8 <ipc_recv+0x92>
+        *size = thisenv->env_ipc_maxsz;
+  802ca4:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802cab:	00 00 00 
+  802cae:	48 8b 80 a0 01 00 00 	mov    0x1a0(%rax),%rax
+  802cb5:	48 89 03             	mov    %rax,(%rbx)
+    }
+    return thisenv->env_ipc_value;
+  802cb8:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802cbf:	00 00 00 
+  802cc2:	8b 80 a8 01 00 00    	mov    0x1a8(%rax),%eax
+}
+  802cc8:	48 83 c4 08          	add    $0x8,%rsp
+  802ccc:	5b                   	pop    %rbx
+  802ccd:	41 5c                	pop    %r12
+  802ccf:	41 5d                	pop    %r13
+  802cd1:	5d                   	pop    %rbp
+  802cd2:	c3                   	ret
+        if (from_env_store) {
+  802cd3:	4d 85 e4             	test   %r12,%r12
+  802cd6:	74 08                	je     802ce0 <ipc_recv+0xba>
+            *from_env_store = 0;
+  802cd8:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  802cdf:	00 
+        if (perm_store) {
+  802ce0:	4d 85 ed             	test   %r13,%r13
+  802ce3:	74 08                	je     802ced <ipc_recv+0xc7>
+            *perm_store = 0;
+  802ce5:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  802cec:	00 
+        if (size) {
+  802ced:	48 85 db             	test   %rbx,%rbx
+  802cf0:	74 d6                	je     802cc8 <ipc_recv+0xa2>
+            *size = 0;
+  802cf2:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  802cf9:	eb cd                	jmp    802cc8 <ipc_recv+0xa2>
+
+0000000000802cfb <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  802cfb:	55                   	push   %rbp
+  802cfc:	48 89 e5             	mov    %rsp,%rbp
+  802cff:	41 57                	push   %r15
+  802d01:	41 56                	push   %r14
+  802d03:	41 55                	push   %r13
+  802d05:	41 54                	push   %r12
+  802d07:	53                   	push   %rbx
+  802d08:	48 83 ec 18          	sub    $0x18,%rsp
+  802d0c:	41 89 fd             	mov    %edi,%r13d
+  802d0f:	89 75 cc             	mov    %esi,-0x34(%rbp)
+  802d12:	49 89 cc             	mov    %rcx,%r12
+  802d15:	44 89 45 c8          	mov    %r8d,-0x38(%rbp)
+    // LAB 9: Your code here:
+    int res = 0;
+    while ((res = sys_ipc_try_send(to_env, val, !pg ? (void*)MAX_USER_ADDRESS : pg, size, perm)) < 0) {
+  802d19:	48 85 d2             	test   %rdx,%rdx
+  802d1c:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802d23:	00 00 00 
+  802d26:	48 0f 45 c2          	cmovne %rdx,%rax
+  802d2a:	48 89 c3             	mov    %rax,%rbx
+  802d2d:	49 be 3b 16 80 00 00 	movabs $0x80163b,%r14
+  802d34:	00 00 00 
+        if (res != -E_IPC_NOT_RECV) {
+            panic("sys_ipc_try_send failed: %i", res);
+        }
+        sys_yield();
+  802d37:	49 bf 06 12 80 00 00 	movabs $0x801206,%r15
+  802d3e:	00 00 00 
+    while ((res = sys_ipc_try_send(to_env, val, !pg ? (void*)MAX_USER_ADDRESS : pg, size, perm)) < 0) {
+  802d41:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  802d44:	44 8b 45 c8          	mov    -0x38(%rbp),%r8d
+  802d48:	4c 89 e1             	mov    %r12,%rcx
+  802d4b:	48 89 da             	mov    %rbx,%rdx
+  802d4e:	44 89 ef             	mov    %r13d,%edi
+  802d51:	41 ff d6             	call   *%r14
+  802d54:	85 c0                	test   %eax,%eax
+  802d56:	79 37                	jns    802d8f <ipc_send+0x94>
+        if (res != -E_IPC_NOT_RECV) {
+  802d58:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  802d5b:	75 05                	jne    802d62 <ipc_send+0x67>
+        sys_yield();
+  802d5d:	41 ff d7             	call   *%r15
+  802d60:	eb df                	jmp    802d41 <ipc_send+0x46>
+            panic("sys_ipc_try_send failed: %i", res);
+  802d62:	89 c1                	mov    %eax,%ecx
+  802d64:	48 ba 00 35 80 00 00 	movabs $0x803500,%rdx
+  802d6b:	00 00 00 
+  802d6e:	be 40 00 00 00       	mov    $0x40,%esi
+  802d73:	48 bf 1c 35 80 00 00 	movabs $0x80351c,%rdi
+  802d7a:	00 00 00 
+  802d7d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d82:	49 b8 70 02 80 00 00 	movabs $0x800270,%r8
+  802d89:	00 00 00 
+  802d8c:	41 ff d0             	call   *%r8
+    }
+    return;
+}
+  802d8f:	48 83 c4 18          	add    $0x18,%rsp
+  802d93:	5b                   	pop    %rbx
+  802d94:	41 5c                	pop    %r12
+  802d96:	41 5d                	pop    %r13
+  802d98:	41 5e                	pop    %r14
+  802d9a:	41 5f                	pop    %r15
+  802d9c:	5d                   	pop    %rbp
+  802d9d:	c3                   	ret
+
+0000000000802d9e <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  802d9e:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  802da3:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  802daa:	00 00 00 
+  802dad:	48 69 d0 d0 01 00 00 	imul   $0x1d0,%rax,%rdx
+  802db4:	48 01 ca             	add    %rcx,%rdx
+  802db7:	8b 92 e8 00 00 00    	mov    0xe8(%rdx),%edx
+  802dbd:	39 fa                	cmp    %edi,%edx
+  802dbf:	74 12                	je     802dd3 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  802dc1:	48 83 c0 01          	add    $0x1,%rax
+  802dc5:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  802dcb:	75 e0                	jne    802dad <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  802dcd:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802dd2:	c3                   	ret
+            return envs[i].env_id;
+  802dd3:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+  802dda:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  802de1:	00 00 00 
+  802de4:	48 01 d0             	add    %rdx,%rax
+  802de7:	8b 80 e0 00 00 00    	mov    0xe0(%rax),%eax
+  802ded:	c3                   	ret
+  802dee:	66 90                	xchg   %ax,%ax
+
+0000000000802df0 <__rodata_start>:
+  802df0:	73 79                	jae    802e6b <__rodata_start+0x7b>
+  802df2:	73 5f                	jae    802e53 <__rodata_start+0x63>
+  802df4:	65 78 6f             	gs js  802e66 <__rodata_start+0x76>
+  802df7:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  802df9:	72 6b                	jb     802e66 <__rodata_start+0x76>
+  802dfb:	3a 20                	cmp    (%rax),%ah
+  802dfd:	25 69 00 75 73       	and    $0x73750069,%eax
+  802e02:	65 72 2f             	gs jb  802e34 <__rodata_start+0x44>
+  802e05:	64 75 6d             	fs jne 802e75 <__rodata_start+0x85>
+  802e08:	62 66 6f 72 6b       	(bad)
+  802e0d:	2e 63 00             	cs movsxd (%rax),%eax
+  802e10:	73 79                	jae    802e8b <__rodata_start+0x9b>
+  802e12:	73 5f                	jae    802e73 <__rodata_start+0x83>
+  802e14:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  802e16:	76 5f                	jbe    802e77 <__rodata_start+0x87>
+  802e18:	73 65                	jae    802e7f <__rodata_start+0x8f>
+  802e1a:	74 5f                	je     802e7b <__rodata_start+0x8b>
+  802e1c:	73 74                	jae    802e92 <__rodata_start+0xa2>
+  802e1e:	61                   	(bad)
+  802e1f:	74 75                	je     802e96 <__rodata_start+0xa6>
+  802e21:	73 3a                	jae    802e5d <__rodata_start+0x6d>
+  802e23:	20 25 69 00 70 61    	and    %ah,0x61700069(%rip)        # 61f02e92 <__bss_end+0x616fae92>
+  802e29:	72 65                	jb     802e90 <__rodata_start+0xa0>
+  802e2b:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802e2c:	74 00                	je     802e2e <__rodata_start+0x3e>
+  802e2e:	63 68 69             	movsxd 0x69(%rax),%ebp
+  802e31:	6c                   	insb   (%dx),%es:(%rdi)
+  802e32:	64 00 25 64 3a 20 49 	add    %ah,%fs:0x49203a64(%rip)        # 49a0689d <__bss_end+0x491fe89d>
+  802e39:	20 61 6d             	and    %ah,0x6d(%rcx)
+  802e3c:	20 74 68 65          	and    %dh,0x65(%rax,%rbp,2)
+  802e40:	20 25 73 21 0a 00    	and    %ah,0xa2173(%rip)        # 8a4fb9 <__bss_end+0x9cfb9>
+  802e46:	3c 75                	cmp    $0x75,%al
+  802e48:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802e49:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  802e4d:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802e4e:	3e 00 5b 25          	ds add %bl,0x25(%rbx)
+  802e52:	30 38                	xor    %bh,(%rax)
+  802e54:	78 5d                	js     802eb3 <__rodata_start+0xc3>
+  802e56:	20 75 73             	and    %dh,0x73(%rbp)
+  802e59:	65 72 20             	gs jb  802e7c <__rodata_start+0x8c>
+  802e5c:	70 61                	jo     802ebf <__rodata_start+0xcf>
+  802e5e:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802e5f:	69 63 20 69 6e 20 25 	imul   $0x25206e69,0x20(%rbx),%esp
+  802e66:	73 20                	jae    802e88 <__rodata_start+0x98>
+  802e68:	61                   	(bad)
+  802e69:	74 20                	je     802e8b <__rodata_start+0x9b>
+  802e6b:	25 73 3a 25 64       	and    $0x64253a73,%eax
+  802e70:	3a 20                	cmp    (%rax),%ah
+  802e72:	00 30                	add    %dh,(%rax)
+  802e74:	31 32                	xor    %esi,(%rdx)
+  802e76:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  802e7d:	41                   	rex.B
+  802e7e:	42                   	rex.X
+  802e7f:	43                   	rex.XB
+  802e80:	44                   	rex.R
+  802e81:	45                   	rex.RB
+  802e82:	46 00 30             	rex.RX add %r14b,(%rax)
+  802e85:	31 32                	xor    %esi,(%rdx)
+  802e87:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  802e8e:	61                   	(bad)
+  802e8f:	62 63 64 65 66       	(bad)
+  802e94:	00 28                	add    %ch,(%rax)
+  802e96:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802e97:	75 6c                	jne    802f05 <__rodata_start+0x115>
+  802e99:	6c                   	insb   (%dx),%es:(%rdi)
+  802e9a:	29 00                	sub    %eax,(%rax)
+  802e9c:	65 72 72             	gs jb  802f11 <__rodata_start+0x121>
+  802e9f:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802ea0:	72 20                	jb     802ec2 <__rodata_start+0xd2>
+  802ea2:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  802ea7:	73 70                	jae    802f19 <__rodata_start+0x129>
+  802ea9:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  802ead:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  802eb4:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802eb5:	72 00                	jb     802eb7 <__rodata_start+0xc7>
+  802eb7:	62 61 64 20 65       	(bad)
+  802ebc:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802ebd:	76 69                	jbe    802f28 <__rodata_start+0x138>
+  802ebf:	72 6f                	jb     802f30 <__rodata_start+0x140>
+  802ec1:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802ec2:	6d                   	insl   (%dx),%es:(%rdi)
+  802ec3:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  802ec5:	74 00                	je     802ec7 <__rodata_start+0xd7>
+  802ec7:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  802ece:	20 70 61             	and    %dh,0x61(%rax)
+  802ed1:	72 61                	jb     802f34 <__rodata_start+0x144>
+  802ed3:	6d                   	insl   (%dx),%es:(%rdi)
+  802ed4:	65 74 65             	gs je  802f3c <__rodata_start+0x14c>
+  802ed7:	72 00                	jb     802ed9 <__rodata_start+0xe9>
+  802ed9:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802eda:	75 74                	jne    802f50 <__rodata_start+0x160>
+  802edc:	20 6f 66             	and    %ch,0x66(%rdi)
+  802edf:	20 6d 65             	and    %ch,0x65(%rbp)
+  802ee2:	6d                   	insl   (%dx),%es:(%rdi)
+  802ee3:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802ee4:	72 79                	jb     802f5f <__rodata_start+0x16f>
+  802ee6:	00 6f 75             	add    %ch,0x75(%rdi)
+  802ee9:	74 20                	je     802f0b <__rodata_start+0x11b>
+  802eeb:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802eec:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  802ef0:	76 69                	jbe    802f5b <__rodata_start+0x16b>
+  802ef2:	72 6f                	jb     802f63 <__rodata_start+0x173>
+  802ef4:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802ef5:	6d                   	insl   (%dx),%es:(%rdi)
+  802ef6:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  802ef8:	74 73                	je     802f6d <__rodata_start+0x17d>
+  802efa:	00 63 6f             	add    %ah,0x6f(%rbx)
+  802efd:	72 72                	jb     802f71 <__rodata_start+0x181>
+  802eff:	75 70                	jne    802f71 <__rodata_start+0x181>
+  802f01:	74 65                	je     802f68 <__rodata_start+0x178>
+  802f03:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  802f08:	75 67                	jne    802f71 <__rodata_start+0x181>
+  802f0a:	20 69 6e             	and    %ch,0x6e(%rcx)
+  802f0d:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  802f0f:	00 73 65             	add    %dh,0x65(%rbx)
+  802f12:	67 6d                	insl   (%dx),%es:(%edi)
+  802f14:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  802f16:	74 61                	je     802f79 <__rodata_start+0x189>
+  802f18:	74 69                	je     802f83 <__rodata_start+0x193>
+  802f1a:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802f1b:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802f1c:	20 66 61             	and    %ah,0x61(%rsi)
+  802f1f:	75 6c                	jne    802f8d <__rodata_start+0x19d>
+  802f21:	74 00                	je     802f23 <__rodata_start+0x133>
+  802f23:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  802f2a:	20 45 4c             	and    %al,0x4c(%rbp)
+  802f2d:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  802f31:	61                   	(bad)
+  802f32:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  802f37:	20 73 75             	and    %dh,0x75(%rbx)
+  802f3a:	63 68 20             	movsxd 0x20(%rax),%ebp
+  802f3d:	73 79                	jae    802fb8 <__rodata_start+0x1c8>
+  802f3f:	73 74                	jae    802fb5 <__rodata_start+0x1c5>
+  802f41:	65 6d                	gs insl (%dx),%es:(%rdi)
+  802f43:	20 63 61             	and    %ah,0x61(%rbx)
+  802f46:	6c                   	insb   (%dx),%es:(%rdi)
+  802f47:	6c                   	insb   (%dx),%es:(%rdi)
+  802f48:	00 65 6e             	add    %ah,0x6e(%rbp)
+  802f4b:	74 72                	je     802fbf <__rodata_start+0x1cf>
+  802f4d:	79 20                	jns    802f6f <__rodata_start+0x17f>
+  802f4f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802f50:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802f51:	74 20                	je     802f73 <__rodata_start+0x183>
+  802f53:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  802f55:	75 6e                	jne    802fc5 <__rodata_start+0x1d5>
+  802f57:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  802f5b:	76 20                	jbe    802f7d <__rodata_start+0x18d>
+  802f5d:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  802f64:	72 65                	jb     802fcb <__rodata_start+0x1db>
+  802f66:	63 76 69             	movsxd 0x69(%rsi),%esi
+  802f69:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802f6a:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  802f6e:	65 78 70             	gs js  802fe1 <__rodata_start+0x1f1>
+  802f71:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  802f76:	20 65 6e             	and    %ah,0x6e(%rbp)
+  802f79:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  802f7d:	20 66 69             	and    %ah,0x69(%rsi)
+  802f80:	6c                   	insb   (%dx),%es:(%rdi)
+  802f81:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  802f85:	20 66 72             	and    %ah,0x72(%rsi)
+  802f88:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  802f8d:	61                   	(bad)
+  802f8e:	63 65 20             	movsxd 0x20(%rbp),%esp
+  802f91:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802f92:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802f93:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  802f97:	6b 00 74             	imul   $0x74,(%rax),%eax
+  802f9a:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802f9b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802f9c:	20 6d 61             	and    %ch,0x61(%rbp)
+  802f9f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802fa0:	79 20                	jns    802fc2 <__rodata_start+0x1d2>
+  802fa2:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  802fa9:	72 65                	jb     803010 <__rodata_start+0x220>
+  802fab:	20 6f 70             	and    %ch,0x70(%rdi)
+  802fae:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  802fb0:	00 66 69             	add    %ah,0x69(%rsi)
+  802fb3:	6c                   	insb   (%dx),%es:(%rdi)
+  802fb4:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  802fb8:	20 62 6c             	and    %ah,0x6c(%rdx)
+  802fbb:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802fbc:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  802fbf:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802fc0:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802fc1:	74 20                	je     802fe3 <__rodata_start+0x1f3>
+  802fc3:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  802fc5:	75 6e                	jne    803035 <__rodata_start+0x245>
+  802fc7:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  802fcb:	76 61                	jbe    80302e <__rodata_start+0x23e>
+  802fcd:	6c                   	insb   (%dx),%es:(%rdi)
+  802fce:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  802fd5:	00 
+  802fd6:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  802fdd:	72 65                	jb     803044 <__rodata_start+0x254>
+  802fdf:	61                   	(bad)
+  802fe0:	64 79 20             	fs jns 803003 <__rodata_start+0x213>
+  802fe3:	65 78 69             	gs js  80304f <__rodata_start+0x25f>
+  802fe6:	73 74                	jae    80305c <__rodata_start+0x26c>
+  802fe8:	73 00                	jae    802fea <__rodata_start+0x1fa>
+  802fea:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802feb:	70 65                	jo     803052 <__rodata_start+0x262>
+  802fed:	72 61                	jb     803050 <__rodata_start+0x260>
+  802fef:	74 69                	je     80305a <__rodata_start+0x26a>
+  802ff1:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802ff2:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802ff3:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  802ff6:	74 20                	je     803018 <__rodata_start+0x228>
+  802ff8:	73 75                	jae    80306f <__rodata_start+0x27f>
+  802ffa:	70 70                	jo     80306c <__rodata_start+0x27c>
+  802ffc:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802ffd:	72 74                	jb     803073 <__rodata_start+0x283>
+  802fff:	65 64 00 6f 70       	gs add %ch,%fs:0x70(%rdi)
+  803004:	65 72 61             	gs jb  803068 <__rodata_start+0x278>
+  803007:	74 69                	je     803072 <__rodata_start+0x282>
+  803009:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80300a:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80300b:	20 69 6e             	and    %ch,0x6e(%rcx)
+  80300e:	74 65                	je     803075 <__rodata_start+0x285>
+  803010:	72 72                	jb     803084 <__rodata_start+0x294>
+  803012:	75 70                	jne    803084 <__rodata_start+0x294>
+  803014:	74 65                	je     80307b <__rodata_start+0x28b>
+  803016:	64 00 6e 6f          	add    %ch,%fs:0x6f(%rsi)
+  80301a:	74 20                	je     80303c <__rodata_start+0x24c>
+  80301c:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  80301e:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80301f:	75 67                	jne    803088 <__rodata_start+0x298>
+  803021:	68 20 43 50 55       	push   $0x55504320
+  803026:	20 74 69 6d          	and    %dh,0x6d(%rcx,%rbp,2)
+  80302a:	65 00 66 2e          	add    %ah,%gs:0x2e(%rsi)
+  80302e:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+  803035:	00 
+  803036:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80303d:	00 00 00 
+  803040:	ad                   	lods   %ds:(%rsi),%eax
+  803041:	05 80 00 00 00       	add    $0x80,%eax
+  803046:	00 00                	add    %al,(%rax)
+  803048:	ee                   	out    %al,(%dx)
+  803049:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  80304f:	00 de                	add    %bl,%dh
+  803051:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803057:	00 ee                	add    %ch,%dh
+  803059:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  80305f:	00 ee                	add    %ch,%dh
+  803061:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803067:	00 ee                	add    %ch,%dh
+  803069:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  80306f:	00 ee                	add    %ch,%dh
+  803071:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803077:	00 cc                	add    %cl,%ah
+  803079:	05 80 00 00 00       	add    $0x80,%eax
+  80307e:	00 00                	add    %al,(%rax)
+  803080:	ee                   	out    %al,(%dx)
+  803081:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803087:	00 ee                	add    %ch,%dh
+  803089:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  80308f:	00 c0                	add    %al,%al
+  803091:	05 80 00 00 00       	add    $0x80,%eax
+  803096:	00 00                	add    %al,(%rax)
+  803098:	3a 06                	cmp    (%rsi),%al
+  80309a:	80 00 00             	addb   $0x0,(%rax)
+  80309d:	00 00                	add    %al,(%rax)
+  80309f:	00 ee                	add    %ch,%dh
+  8030a1:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  8030a7:	00 c0                	add    %al,%al
+  8030a9:	05 80 00 00 00       	add    $0x80,%eax
+  8030ae:	00 00                	add    %al,(%rax)
+  8030b0:	06                   	(bad)
+  8030b1:	06                   	(bad)
+  8030b2:	80 00 00             	addb   $0x0,(%rax)
+  8030b5:	00 00                	add    %al,(%rax)
+  8030b7:	00 06                	add    %al,(%rsi)
+  8030b9:	06                   	(bad)
+  8030ba:	80 00 00             	addb   $0x0,(%rax)
+  8030bd:	00 00                	add    %al,(%rax)
+  8030bf:	00 06                	add    %al,(%rsi)
+  8030c1:	06                   	(bad)
+  8030c2:	80 00 00             	addb   $0x0,(%rax)
+  8030c5:	00 00                	add    %al,(%rax)
+  8030c7:	00 06                	add    %al,(%rsi)
+  8030c9:	06                   	(bad)
+  8030ca:	80 00 00             	addb   $0x0,(%rax)
+  8030cd:	00 00                	add    %al,(%rax)
+  8030cf:	00 06                	add    %al,(%rsi)
+  8030d1:	06                   	(bad)
+  8030d2:	80 00 00             	addb   $0x0,(%rax)
+  8030d5:	00 00                	add    %al,(%rax)
+  8030d7:	00 06                	add    %al,(%rsi)
+  8030d9:	06                   	(bad)
+  8030da:	80 00 00             	addb   $0x0,(%rax)
+  8030dd:	00 00                	add    %al,(%rax)
+  8030df:	00 06                	add    %al,(%rsi)
+  8030e1:	06                   	(bad)
+  8030e2:	80 00 00             	addb   $0x0,(%rax)
+  8030e5:	00 00                	add    %al,(%rax)
+  8030e7:	00 06                	add    %al,(%rsi)
+  8030e9:	06                   	(bad)
+  8030ea:	80 00 00             	addb   $0x0,(%rax)
+  8030ed:	00 00                	add    %al,(%rax)
+  8030ef:	00 06                	add    %al,(%rsi)
+  8030f1:	06                   	(bad)
+  8030f2:	80 00 00             	addb   $0x0,(%rax)
+  8030f5:	00 00                	add    %al,(%rax)
+  8030f7:	00 ee                	add    %ch,%dh
+  8030f9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  8030ff:	00 ee                	add    %ch,%dh
+  803101:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803107:	00 ee                	add    %ch,%dh
+  803109:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  80310f:	00 ee                	add    %ch,%dh
+  803111:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803117:	00 ee                	add    %ch,%dh
+  803119:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  80311f:	00 ee                	add    %ch,%dh
+  803121:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803127:	00 ee                	add    %ch,%dh
+  803129:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  80312f:	00 ee                	add    %ch,%dh
+  803131:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803137:	00 ee                	add    %ch,%dh
+  803139:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  80313f:	00 ee                	add    %ch,%dh
+  803141:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803147:	00 ee                	add    %ch,%dh
+  803149:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  80314f:	00 ee                	add    %ch,%dh
+  803151:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803157:	00 ee                	add    %ch,%dh
+  803159:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  80315f:	00 ee                	add    %ch,%dh
+  803161:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803167:	00 ee                	add    %ch,%dh
+  803169:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  80316f:	00 ee                	add    %ch,%dh
+  803171:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803177:	00 ee                	add    %ch,%dh
+  803179:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  80317f:	00 ee                	add    %ch,%dh
+  803181:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803187:	00 ee                	add    %ch,%dh
+  803189:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  80318f:	00 ee                	add    %ch,%dh
+  803191:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803197:	00 ee                	add    %ch,%dh
+  803199:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  80319f:	00 ee                	add    %ch,%dh
+  8031a1:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  8031a7:	00 ee                	add    %ch,%dh
+  8031a9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  8031af:	00 ee                	add    %ch,%dh
+  8031b1:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  8031b7:	00 ee                	add    %ch,%dh
+  8031b9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  8031bf:	00 ee                	add    %ch,%dh
+  8031c1:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  8031c7:	00 ee                	add    %ch,%dh
+  8031c9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  8031cf:	00 ee                	add    %ch,%dh
+  8031d1:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  8031d7:	00 ee                	add    %ch,%dh
+  8031d9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  8031df:	00 ee                	add    %ch,%dh
+  8031e1:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  8031e7:	00 11                	add    %dl,(%rcx)
+  8031e9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  8031ef:	00 ee                	add    %ch,%dh
+  8031f1:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  8031f7:	00 ee                	add    %ch,%dh
+  8031f9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  8031ff:	00 ee                	add    %ch,%dh
+  803201:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803207:	00 ee                	add    %ch,%dh
+  803209:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  80320f:	00 ee                	add    %ch,%dh
+  803211:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803217:	00 ee                	add    %ch,%dh
+  803219:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  80321f:	00 ee                	add    %ch,%dh
+  803221:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803227:	00 ee                	add    %ch,%dh
+  803229:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  80322f:	00 ee                	add    %ch,%dh
+  803231:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803237:	00 ee                	add    %ch,%dh
+  803239:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  80323f:	00 5d 06             	add    %bl,0x6(%rbp)
+  803242:	80 00 00             	addb   $0x0,(%rax)
+  803245:	00 00                	add    %al,(%rax)
+  803247:	00 2c 08             	add    %ch,(%rax,%rcx,1)
+  80324a:	80 00 00             	addb   $0x0,(%rax)
+  80324d:	00 00                	add    %al,(%rax)
+  80324f:	00 ee                	add    %ch,%dh
+  803251:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803257:	00 ee                	add    %ch,%dh
+  803259:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  80325f:	00 ee                	add    %ch,%dh
+  803261:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803267:	00 ee                	add    %ch,%dh
+  803269:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  80326f:	00 8c 06 80 00 00 00 	add    %cl,0x80(%rsi,%rax,1)
+  803276:	00 00                	add    %al,(%rax)
+  803278:	ee                   	out    %al,(%dx)
+  803279:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  80327f:	00 ee                	add    %ch,%dh
+  803281:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803287:	00 52 06             	add    %dl,0x6(%rdx)
+  80328a:	80 00 00             	addb   $0x0,(%rax)
+  80328d:	00 00                	add    %al,(%rax)
+  80328f:	00 ee                	add    %ch,%dh
+  803291:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803297:	00 ee                	add    %ch,%dh
+  803299:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  80329f:	00 d4                	add    %dl,%ah
+  8032a1:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  8032a7:	00 9e 0a 80 00 00    	add    %bl,0x800a(%rsi)
+  8032ad:	00 00                	add    %al,(%rax)
+  8032af:	00 ee                	add    %ch,%dh
+  8032b1:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  8032b7:	00 ee                	add    %ch,%dh
+  8032b9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  8032bf:	00 23                	add    %ah,(%rbx)
+  8032c1:	07                   	(bad)
+  8032c2:	80 00 00             	addb   $0x0,(%rax)
+  8032c5:	00 00                	add    %al,(%rax)
+  8032c7:	00 ee                	add    %ch,%dh
+  8032c9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  8032cf:	00 00                	add    %al,(%rax)
+  8032d1:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  8032d7:	00 ee                	add    %ch,%dh
+  8032d9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  8032df:	00 ee                	add    %ch,%dh
+  8032e1:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  8032e7:	00 11                	add    %dl,(%rcx)
+  8032e9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  8032ef:	00 ee                	add    %ch,%dh
+  8032f1:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  8032f7:	00 b6 05 80 00 00    	add    %dh,0x8005(%rsi)
+  8032fd:	00 00                	add    %al,(%rax)
+	...
+
+0000000000803300 <error_string>:
+	...
+  803308:	a5 2e 80 00 00 00 00 00 b7 2e 80 00 00 00 00 00     ................
+  803318:	c7 2e 80 00 00 00 00 00 d9 2e 80 00 00 00 00 00     ................
+  803328:	e7 2e 80 00 00 00 00 00 fb 2e 80 00 00 00 00 00     ................
+  803338:	10 2f 80 00 00 00 00 00 23 2f 80 00 00 00 00 00     ./......#/......
+  803348:	35 2f 80 00 00 00 00 00 49 2f 80 00 00 00 00 00     5/......I/......
+  803358:	59 2f 80 00 00 00 00 00 6c 2f 80 00 00 00 00 00     Y/......l/......
+  803368:	83 2f 80 00 00 00 00 00 99 2f 80 00 00 00 00 00     ./......./......
+  803378:	b1 2f 80 00 00 00 00 00 c9 2f 80 00 00 00 00 00     ./......./......
+  803388:	d6 2f 80 00 00 00 00 00 b0 33 80 00 00 00 00 00     ./.......3......
+  803398:	ea 2f 80 00 00 00 00 00 02 30 80 00 00 00 00 00     ./.......0......
+  8033a8:	18 30 80 00 00 00 00 00 66 69 6c 65 20 69 73 20     .0......file is 
+  8033b8:	6e 6f 74 20 61 20 76 61 6c 69 64 20 65 78 65 63     not a valid exec
+  8033c8:	75 74 61 62 6c 65 00 90 73 79 73 63 61 6c 6c 20     utable..syscall 
+  8033d8:	25 7a 64 20 72 65 74 75 72 6e 65 64 20 25 7a 64     %zd returned %zd
+  8033e8:	20 28 3e 20 30 29 00 6c 69 62 2f 73 79 73 63 61      (> 0).lib/sysca
+  8033f8:	6c 6c 2e 63 00 0f 1f 00 5b 25 30 38 78 5d 20 75     ll.c....[%08x] u
+  803408:	6e 6b 6e 6f 77 6e 20 64 65 76 69 63 65 20 74 79     nknown device ty
+  803418:	70 65 20 25 64 0a 00 00 5b 25 30 38 78 5d 20 66     pe %d...[%08x] f
+  803428:	74 72 75 6e 63 61 74 65 20 25 64 20 2d 2d 20 62     truncate %d -- b
+  803438:	61 64 20 6d 6f 64 65 0a 00 5b 25 30 38 78 5d 20     ad mode..[%08x] 
+  803448:	72 65 61 64 20 25 64 20 2d 2d 20 62 61 64 20 6d     read %d -- bad m
+  803458:	6f 64 65 0a 00 5b 25 30 38 78 5d 20 77 72 69 74     ode..[%08x] writ
+  803468:	65 20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65     e %d -- bad mode
+  803478:	0a 00 66 0f 1f 44 00 00                             ..f..D..
+
+0000000000803480 <devtab>:
+  803480:	20 40 80 00 00 00 00 00 60 40 80 00 00 00 00 00      @......`@......
+  803490:	a0 40 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .@..............
+  8034a0:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  8034b0:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  8034c0:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  8034d0:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  8034e0:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  8034f0:	3d 20 32 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73 00     = 2.<cons>.cons.
+  803500:	73 79 73 5f 69 70 63 5f 74 72 79 5f 73 65 6e 64     sys_ipc_try_send
+  803510:	20 66 61 69 6c 65 64 3a 20 25 69 00 6c 69 62 2f      failed: %i.lib/
+  803520:	69 70 63 2e 63 00 66 2e 0f 1f 84 00 00 00 00 00     ipc.c.f.........
+  803530:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803540:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803550:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803560:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803570:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803580:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803590:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8035a0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8035b0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8035c0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8035d0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8035e0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8035f0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803600:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803610:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803620:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803630:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803640:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803650:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803660:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803670:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803680:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803690:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8036a0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8036b0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8036c0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8036d0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8036e0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8036f0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803700:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803710:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803720:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803730:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803740:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803750:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803760:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803770:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803780:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803790:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8037a0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8037b0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8037c0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8037d0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8037e0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8037f0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803800:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803810:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803820:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803830:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803840:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803850:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803860:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803870:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803880:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803890:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8038a0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8038b0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8038c0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8038d0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8038e0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8038f0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803900:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803910:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803920:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803930:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803940:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803950:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803960:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803970:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803980:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803990:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8039a0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8039b0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8039c0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8039d0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8039e0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8039f0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803a00:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803a10:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803a20:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803a30:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803a40:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803a50:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803a60:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803a70:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803a80:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803a90:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803aa0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803ab0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803ac0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803ad0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803ae0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803af0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803b00:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803b10:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803b20:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803b30:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803b40:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803b50:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803b60:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803b70:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803b80:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803b90:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803ba0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803bb0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803bc0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803bd0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803be0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803bf0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803c00:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803c10:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803c20:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803c30:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803c40:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803c50:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803c60:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803c70:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803c80:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803c90:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803ca0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803cb0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803cc0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803cd0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803ce0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803cf0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803d00:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803d10:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803d20:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803d30:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803d40:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803d50:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803d60:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803d70:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803d80:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803d90:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803da0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803db0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803dc0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803dd0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803de0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803df0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803e00:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803e10:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803e20:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803e30:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803e40:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803e50:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803e60:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803e70:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803e80:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803e90:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803ea0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803eb0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803ec0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803ed0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803ee0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803ef0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803f00:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803f10:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803f20:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803f30:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803f40:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803f50:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803f60:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803f70:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803f80:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803f90:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803fa0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803fb0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803fc0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803fd0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803fe0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803ff0:	0f 1f 84 00 00 00 00 00 0f 1f 84 00 00 00 00 00     ................
@@ -0,0 +1,5443 @@
+
+obj/user/evilhello:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 23 00 00 00       	call   800046 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+ * kernel should destroy user environment in response */
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+    /* try to print the kernel entry point as a string!  mua ha ha! */
+    sys_cputs((char *)0x804020000c, 100);
+  800029:	be 64 00 00 00       	mov    $0x64,%esi
+  80002e:	48 bf 0c 00 20 40 80 	movabs $0x804020000c,%rdi
+  800035:	00 00 00 
+  800038:	48 b8 12 01 80 00 00 	movabs $0x800112,%rax
+  80003f:	00 00 00 
+  800042:	ff d0                	call   *%rax
+}
+  800044:	5d                   	pop    %rbp
+  800045:	c3                   	ret
+
+0000000000800046 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800046:	55                   	push   %rbp
+  800047:	48 89 e5             	mov    %rsp,%rbp
+  80004a:	41 56                	push   %r14
+  80004c:	41 55                	push   %r13
+  80004e:	41 54                	push   %r12
+  800050:	53                   	push   %rbx
+  800051:	41 89 fd             	mov    %edi,%r13d
+  800054:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800057:	48 ba d8 40 80 00 00 	movabs $0x8040d8,%rdx
+  80005e:	00 00 00 
+  800061:	48 b8 d8 40 80 00 00 	movabs $0x8040d8,%rax
+  800068:	00 00 00 
+  80006b:	48 39 c2             	cmp    %rax,%rdx
+  80006e:	73 17                	jae    800087 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  800070:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  800073:	49 89 c4             	mov    %rax,%r12
+  800076:	48 83 c3 08          	add    $0x8,%rbx
+  80007a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80007f:	ff 53 f8             	call   *-0x8(%rbx)
+  800082:	4c 39 e3             	cmp    %r12,%rbx
+  800085:	72 ef                	jb     800076 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+    envid_t this_env_id = sys_getenvid();
+  800087:	48 b8 db 01 80 00 00 	movabs $0x8001db,%rax
+  80008e:	00 00 00 
+  800091:	ff d0                	call   *%rax
+    thisenv = &((struct Env*)UENVS)[ENVX(this_env_id)];
+  800093:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800098:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+  80009f:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8000a6:	00 00 00 
+  8000a9:	48 01 d0             	add    %rdx,%rax
+  8000ac:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  8000b3:	00 00 00 
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8000b6:	45 85 ed             	test   %r13d,%r13d
+  8000b9:	7e 0d                	jle    8000c8 <libmain+0x82>
+  8000bb:	49 8b 06             	mov    (%r14),%rax
+  8000be:	48 a3 00 40 80 00 00 	movabs %rax,0x804000
+  8000c5:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8000c8:	4c 89 f6             	mov    %r14,%rsi
+  8000cb:	44 89 ef             	mov    %r13d,%edi
+  8000ce:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8000d5:	00 00 00 
+  8000d8:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8000da:	48 b8 ef 00 80 00 00 	movabs $0x8000ef,%rax
+  8000e1:	00 00 00 
+  8000e4:	ff d0                	call   *%rax
+#endif
+}
+  8000e6:	5b                   	pop    %rbx
+  8000e7:	41 5c                	pop    %r12
+  8000e9:	41 5d                	pop    %r13
+  8000eb:	41 5e                	pop    %r14
+  8000ed:	5d                   	pop    %rbp
+  8000ee:	c3                   	ret
+
+00000000008000ef <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8000ef:	55                   	push   %rbp
+  8000f0:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  8000f3:	48 b8 2f 09 80 00 00 	movabs $0x80092f,%rax
+  8000fa:	00 00 00 
+  8000fd:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  8000ff:	bf 00 00 00 00       	mov    $0x0,%edi
+  800104:	48 b8 70 01 80 00 00 	movabs $0x800170,%rax
+  80010b:	00 00 00 
+  80010e:	ff d0                	call   *%rax
+}
+  800110:	5d                   	pop    %rbp
+  800111:	c3                   	ret
+
+0000000000800112 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  800112:	55                   	push   %rbp
+  800113:	48 89 e5             	mov    %rsp,%rbp
+  800116:	53                   	push   %rbx
+  800117:	48 89 fa             	mov    %rdi,%rdx
+  80011a:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80011d:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800122:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800127:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80012c:	be 00 00 00 00       	mov    $0x0,%esi
+  800131:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800137:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  800139:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80013d:	c9                   	leave
+  80013e:	c3                   	ret
+
+000000000080013f <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  80013f:	55                   	push   %rbp
+  800140:	48 89 e5             	mov    %rsp,%rbp
+  800143:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  800144:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800149:	ba 00 00 00 00       	mov    $0x0,%edx
+  80014e:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800153:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800158:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80015d:	be 00 00 00 00       	mov    $0x0,%esi
+  800162:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800168:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  80016a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80016e:	c9                   	leave
+  80016f:	c3                   	ret
+
+0000000000800170 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  800170:	55                   	push   %rbp
+  800171:	48 89 e5             	mov    %rsp,%rbp
+  800174:	53                   	push   %rbx
+  800175:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  800179:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80017c:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800181:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800186:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80018b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800190:	be 00 00 00 00       	mov    $0x0,%esi
+  800195:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80019b:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80019d:	48 85 c0             	test   %rax,%rax
+  8001a0:	7f 06                	jg     8001a8 <sys_env_destroy+0x38>
+}
+  8001a2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8001a6:	c9                   	leave
+  8001a7:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8001a8:	49 89 c0             	mov    %rax,%r8
+  8001ab:	b9 03 00 00 00       	mov    $0x3,%ecx
+  8001b0:	48 ba a0 2c 80 00 00 	movabs $0x802ca0,%rdx
+  8001b7:	00 00 00 
+  8001ba:	be 26 00 00 00       	mov    $0x26,%esi
+  8001bf:	48 bf bf 2c 80 00 00 	movabs $0x802cbf,%rdi
+  8001c6:	00 00 00 
+  8001c9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001ce:	49 b9 2c 1c 80 00 00 	movabs $0x801c2c,%r9
+  8001d5:	00 00 00 
+  8001d8:	41 ff d1             	call   *%r9
+
+00000000008001db <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  8001db:	55                   	push   %rbp
+  8001dc:	48 89 e5             	mov    %rsp,%rbp
+  8001df:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8001e0:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8001e5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8001ea:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8001ef:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8001f4:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8001f9:	be 00 00 00 00       	mov    $0x0,%esi
+  8001fe:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800204:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  800206:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80020a:	c9                   	leave
+  80020b:	c3                   	ret
+
+000000000080020c <sys_yield>:
+
+void
+sys_yield(void) {
+  80020c:	55                   	push   %rbp
+  80020d:	48 89 e5             	mov    %rsp,%rbp
+  800210:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  800211:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800216:	ba 00 00 00 00       	mov    $0x0,%edx
+  80021b:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800220:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800225:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80022a:	be 00 00 00 00       	mov    $0x0,%esi
+  80022f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800235:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  800237:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80023b:	c9                   	leave
+  80023c:	c3                   	ret
+
+000000000080023d <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  80023d:	55                   	push   %rbp
+  80023e:	48 89 e5             	mov    %rsp,%rbp
+  800241:	53                   	push   %rbx
+  800242:	48 89 fa             	mov    %rdi,%rdx
+  800245:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  800248:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80024d:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  800254:	00 00 00 
+  800257:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80025c:	be 00 00 00 00       	mov    $0x0,%esi
+  800261:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800267:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  800269:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80026d:	c9                   	leave
+  80026e:	c3                   	ret
+
+000000000080026f <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  80026f:	55                   	push   %rbp
+  800270:	48 89 e5             	mov    %rsp,%rbp
+  800273:	53                   	push   %rbx
+  800274:	49 89 f8             	mov    %rdi,%r8
+  800277:	48 89 d3             	mov    %rdx,%rbx
+  80027a:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80027d:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800282:	4c 89 c2             	mov    %r8,%rdx
+  800285:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800288:	be 00 00 00 00       	mov    $0x0,%esi
+  80028d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800293:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  800295:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800299:	c9                   	leave
+  80029a:	c3                   	ret
+
+000000000080029b <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  80029b:	55                   	push   %rbp
+  80029c:	48 89 e5             	mov    %rsp,%rbp
+  80029f:	53                   	push   %rbx
+  8002a0:	48 83 ec 08          	sub    $0x8,%rsp
+  8002a4:	89 f8                	mov    %edi,%eax
+  8002a6:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  8002a9:	48 63 f9             	movslq %ecx,%rdi
+  8002ac:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8002af:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8002b4:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8002b7:	be 00 00 00 00       	mov    $0x0,%esi
+  8002bc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8002c2:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8002c4:	48 85 c0             	test   %rax,%rax
+  8002c7:	7f 06                	jg     8002cf <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  8002c9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8002cd:	c9                   	leave
+  8002ce:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8002cf:	49 89 c0             	mov    %rax,%r8
+  8002d2:	b9 04 00 00 00       	mov    $0x4,%ecx
+  8002d7:	48 ba a0 2c 80 00 00 	movabs $0x802ca0,%rdx
+  8002de:	00 00 00 
+  8002e1:	be 26 00 00 00       	mov    $0x26,%esi
+  8002e6:	48 bf bf 2c 80 00 00 	movabs $0x802cbf,%rdi
+  8002ed:	00 00 00 
+  8002f0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002f5:	49 b9 2c 1c 80 00 00 	movabs $0x801c2c,%r9
+  8002fc:	00 00 00 
+  8002ff:	41 ff d1             	call   *%r9
+
+0000000000800302 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  800302:	55                   	push   %rbp
+  800303:	48 89 e5             	mov    %rsp,%rbp
+  800306:	53                   	push   %rbx
+  800307:	48 83 ec 08          	sub    $0x8,%rsp
+  80030b:	89 f8                	mov    %edi,%eax
+  80030d:	49 89 f2             	mov    %rsi,%r10
+  800310:	48 89 cf             	mov    %rcx,%rdi
+  800313:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  800316:	48 63 da             	movslq %edx,%rbx
+  800319:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80031c:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800321:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800324:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  800327:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800329:	48 85 c0             	test   %rax,%rax
+  80032c:	7f 06                	jg     800334 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  80032e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800332:	c9                   	leave
+  800333:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800334:	49 89 c0             	mov    %rax,%r8
+  800337:	b9 05 00 00 00       	mov    $0x5,%ecx
+  80033c:	48 ba a0 2c 80 00 00 	movabs $0x802ca0,%rdx
+  800343:	00 00 00 
+  800346:	be 26 00 00 00       	mov    $0x26,%esi
+  80034b:	48 bf bf 2c 80 00 00 	movabs $0x802cbf,%rdi
+  800352:	00 00 00 
+  800355:	b8 00 00 00 00       	mov    $0x0,%eax
+  80035a:	49 b9 2c 1c 80 00 00 	movabs $0x801c2c,%r9
+  800361:	00 00 00 
+  800364:	41 ff d1             	call   *%r9
+
+0000000000800367 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  800367:	55                   	push   %rbp
+  800368:	48 89 e5             	mov    %rsp,%rbp
+  80036b:	53                   	push   %rbx
+  80036c:	48 83 ec 08          	sub    $0x8,%rsp
+  800370:	48 89 f1             	mov    %rsi,%rcx
+  800373:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  800376:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800379:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80037e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800383:	be 00 00 00 00       	mov    $0x0,%esi
+  800388:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80038e:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800390:	48 85 c0             	test   %rax,%rax
+  800393:	7f 06                	jg     80039b <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  800395:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800399:	c9                   	leave
+  80039a:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80039b:	49 89 c0             	mov    %rax,%r8
+  80039e:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8003a3:	48 ba a0 2c 80 00 00 	movabs $0x802ca0,%rdx
+  8003aa:	00 00 00 
+  8003ad:	be 26 00 00 00       	mov    $0x26,%esi
+  8003b2:	48 bf bf 2c 80 00 00 	movabs $0x802cbf,%rdi
+  8003b9:	00 00 00 
+  8003bc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003c1:	49 b9 2c 1c 80 00 00 	movabs $0x801c2c,%r9
+  8003c8:	00 00 00 
+  8003cb:	41 ff d1             	call   *%r9
+
+00000000008003ce <sys_region_batch>:
+
+int
+sys_region_batch(const struct RegionOp *ops, size_t count) {
+  8003ce:	55                   	push   %rbp
+  8003cf:	48 89 e5             	mov    %rsp,%rbp
+  8003d2:	53                   	push   %rbx
+  8003d3:	48 83 ec 08          	sub    $0x8,%rsp
+  8003d7:	48 89 fa             	mov    %rdi,%rdx
+  8003da:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8003dd:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8003e2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8003e7:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8003ec:	be 00 00 00 00       	mov    $0x0,%esi
+  8003f1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8003f7:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8003f9:	48 85 c0             	test   %rax,%rax
+  8003fc:	7f 06                	jg     800404 <sys_region_batch+0x36>
+        else
+            platform_asan_unpoison(va, ops[i].size);
+    }
+#endif
+    return res;
+}
+  8003fe:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800402:	c9                   	leave
+  800403:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800404:	49 89 c0             	mov    %rax,%r8
+  800407:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  80040c:	48 ba a0 2c 80 00 00 	movabs $0x802ca0,%rdx
+  800413:	00 00 00 
+  800416:	be 26 00 00 00       	mov    $0x26,%esi
+  80041b:	48 bf bf 2c 80 00 00 	movabs $0x802cbf,%rdi
+  800422:	00 00 00 
+  800425:	b8 00 00 00 00       	mov    $0x0,%eax
+  80042a:	49 b9 2c 1c 80 00 00 	movabs $0x801c2c,%r9
+  800431:	00 00 00 
+  800434:	41 ff d1             	call   *%r9
+
+0000000000800437 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  800437:	55                   	push   %rbp
+  800438:	48 89 e5             	mov    %rsp,%rbp
+  80043b:	53                   	push   %rbx
+  80043c:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  800440:	48 63 ce             	movslq %esi,%rcx
+  800443:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800446:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80044b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800450:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800455:	be 00 00 00 00       	mov    $0x0,%esi
+  80045a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800460:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800462:	48 85 c0             	test   %rax,%rax
+  800465:	7f 06                	jg     80046d <sys_env_set_status+0x36>
+}
+  800467:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80046b:	c9                   	leave
+  80046c:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80046d:	49 89 c0             	mov    %rax,%r8
+  800470:	b9 09 00 00 00       	mov    $0x9,%ecx
+  800475:	48 ba a0 2c 80 00 00 	movabs $0x802ca0,%rdx
+  80047c:	00 00 00 
+  80047f:	be 26 00 00 00       	mov    $0x26,%esi
+  800484:	48 bf bf 2c 80 00 00 	movabs $0x802cbf,%rdi
+  80048b:	00 00 00 
+  80048e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800493:	49 b9 2c 1c 80 00 00 	movabs $0x801c2c,%r9
+  80049a:	00 00 00 
+  80049d:	41 ff d1             	call   *%r9
+
+00000000008004a0 <sys_env_set_weight>:
+
+int
+sys_env_set_weight(envid_t envid, uint32_t weight) {
+  8004a0:	55                   	push   %rbp
+  8004a1:	48 89 e5             	mov    %rsp,%rbp
+  8004a4:	53                   	push   %rbx
+  8004a5:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_weight, 1, envid, weight, 0, 0, 0, 0);
+  8004a9:	89 f1                	mov    %esi,%ecx
+  8004ab:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8004ae:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8004b3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8004b8:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8004bd:	be 00 00 00 00       	mov    $0x0,%esi
+  8004c2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8004c8:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8004ca:	48 85 c0             	test   %rax,%rax
+  8004cd:	7f 06                	jg     8004d5 <sys_env_set_weight+0x35>
+}
+  8004cf:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8004d3:	c9                   	leave
+  8004d4:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8004d5:	49 89 c0             	mov    %rax,%r8
+  8004d8:	b9 10 00 00 00       	mov    $0x10,%ecx
+  8004dd:	48 ba a0 2c 80 00 00 	movabs $0x802ca0,%rdx
+  8004e4:	00 00 00 
+  8004e7:	be 26 00 00 00       	mov    $0x26,%esi
+  8004ec:	48 bf bf 2c 80 00 00 	movabs $0x802cbf,%rdi
+  8004f3:	00 00 00 
+  8004f6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004fb:	49 b9 2c 1c 80 00 00 	movabs $0x801c2c,%r9
+  800502:	00 00 00 
+  800505:	41 ff d1             	call   *%r9
+
+0000000000800508 <sys_env_set_rt>:
+
+int
+sys_env_set_rt(envid_t envid, uint64_t period, uint64_t budget, uint64_t deadline) {
+  800508:	55                   	push   %rbp
+  800509:	48 89 e5             	mov    %rsp,%rbp
+  80050c:	53                   	push   %rbx
+  80050d:	48 83 ec 08          	sub    $0x8,%rsp
+  800511:	89 f8                	mov    %edi,%eax
+  800513:	48 89 d3             	mov    %rdx,%rbx
+  800516:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_env_set_rt, 1, envid, period, budget, deadline, 0, 0);
+  800519:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80051c:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800521:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800524:	be 00 00 00 00       	mov    $0x0,%esi
+  800529:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80052f:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800531:	48 85 c0             	test   %rax,%rax
+  800534:	7f 06                	jg     80053c <sys_env_set_rt+0x34>
+}
+  800536:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80053a:	c9                   	leave
+  80053b:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80053c:	49 89 c0             	mov    %rax,%r8
+  80053f:	b9 11 00 00 00       	mov    $0x11,%ecx
+  800544:	48 ba a0 2c 80 00 00 	movabs $0x802ca0,%rdx
+  80054b:	00 00 00 
+  80054e:	be 26 00 00 00       	mov    $0x26,%esi
+  800553:	48 bf bf 2c 80 00 00 	movabs $0x802cbf,%rdi
+  80055a:	00 00 00 
+  80055d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800562:	49 b9 2c 1c 80 00 00 	movabs $0x801c2c,%r9
+  800569:	00 00 00 
+  80056c:	41 ff d1             	call   *%r9
+
+000000000080056f <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  80056f:	55                   	push   %rbp
+  800570:	48 89 e5             	mov    %rsp,%rbp
+  800573:	53                   	push   %rbx
+  800574:	48 83 ec 08          	sub    $0x8,%rsp
+  800578:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  80057b:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80057e:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800583:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800588:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80058d:	be 00 00 00 00       	mov    $0x0,%esi
+  800592:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800598:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80059a:	48 85 c0             	test   %rax,%rax
+  80059d:	7f 06                	jg     8005a5 <sys_env_set_trapframe+0x36>
+}
+  80059f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8005a3:	c9                   	leave
+  8005a4:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8005a5:	49 89 c0             	mov    %rax,%r8
+  8005a8:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  8005ad:	48 ba a0 2c 80 00 00 	movabs $0x802ca0,%rdx
+  8005b4:	00 00 00 
+  8005b7:	be 26 00 00 00       	mov    $0x26,%esi
+  8005bc:	48 bf bf 2c 80 00 00 	movabs $0x802cbf,%rdi
+  8005c3:	00 00 00 
+  8005c6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005cb:	49 b9 2c 1c 80 00 00 	movabs $0x801c2c,%r9
+  8005d2:	00 00 00 
+  8005d5:	41 ff d1             	call   *%r9
+
+00000000008005d8 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  8005d8:	55                   	push   %rbp
+  8005d9:	48 89 e5             	mov    %rsp,%rbp
+  8005dc:	53                   	push   %rbx
+  8005dd:	48 83 ec 08          	sub    $0x8,%rsp
+  8005e1:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  8005e4:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8005e7:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8005ec:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8005f1:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8005f6:	be 00 00 00 00       	mov    $0x0,%esi
+  8005fb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800601:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800603:	48 85 c0             	test   %rax,%rax
+  800606:	7f 06                	jg     80060e <sys_env_set_pgfault_upcall+0x36>
+}
+  800608:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80060c:	c9                   	leave
+  80060d:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80060e:	49 89 c0             	mov    %rax,%r8
+  800611:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  800616:	48 ba a0 2c 80 00 00 	movabs $0x802ca0,%rdx
+  80061d:	00 00 00 
+  800620:	be 26 00 00 00       	mov    $0x26,%esi
+  800625:	48 bf bf 2c 80 00 00 	movabs $0x802cbf,%rdi
+  80062c:	00 00 00 
+  80062f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800634:	49 b9 2c 1c 80 00 00 	movabs $0x801c2c,%r9
+  80063b:	00 00 00 
+  80063e:	41 ff d1             	call   *%r9
+
+0000000000800641 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  800641:	55                   	push   %rbp
+  800642:	48 89 e5             	mov    %rsp,%rbp
+  800645:	53                   	push   %rbx
+  800646:	89 f8                	mov    %edi,%eax
+  800648:	49 89 f1             	mov    %rsi,%r9
+  80064b:	48 89 d3             	mov    %rdx,%rbx
+  80064e:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  800651:	49 63 f0             	movslq %r8d,%rsi
+  800654:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800657:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80065c:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80065f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800665:	cd 30                	int    $0x30
+}
+  800667:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80066b:	c9                   	leave
+  80066c:	c3                   	ret
+
+000000000080066d <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  80066d:	55                   	push   %rbp
+  80066e:	48 89 e5             	mov    %rsp,%rbp
+  800671:	53                   	push   %rbx
+  800672:	48 83 ec 08          	sub    $0x8,%rsp
+  800676:	48 89 fa             	mov    %rdi,%rdx
+  800679:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80067c:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800681:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800686:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80068b:	be 00 00 00 00       	mov    $0x0,%esi
+  800690:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800696:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800698:	48 85 c0             	test   %rax,%rax
+  80069b:	7f 06                	jg     8006a3 <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  80069d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8006a1:	c9                   	leave
+  8006a2:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8006a3:	49 89 c0             	mov    %rax,%r8
+  8006a6:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  8006ab:	48 ba a0 2c 80 00 00 	movabs $0x802ca0,%rdx
+  8006b2:	00 00 00 
+  8006b5:	be 26 00 00 00       	mov    $0x26,%esi
+  8006ba:	48 bf bf 2c 80 00 00 	movabs $0x802cbf,%rdi
+  8006c1:	00 00 00 
+  8006c4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006c9:	49 b9 2c 1c 80 00 00 	movabs $0x801c2c,%r9
+  8006d0:	00 00 00 
+  8006d3:	41 ff d1             	call   *%r9
+
+00000000008006d6 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8006d6:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8006dd:	ff ff ff 
+  8006e0:	48 01 f8             	add    %rdi,%rax
+  8006e3:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  8006e7:	c3                   	ret
+
+00000000008006e8 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8006e8:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8006ef:	ff ff ff 
+  8006f2:	48 01 f8             	add    %rdi,%rax
+  8006f5:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  8006f9:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  8006ff:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  800703:	c3                   	ret
+
+0000000000800704 <fd_alloc_from>:
+}
+
+/* Like fd_alloc(), but only considers fds starting from fdnum,
+ * so that several fds can be found before their pages are allocated */
+int
+fd_alloc_from(int fdnum, struct Fd **fd_store) {
+  800704:	55                   	push   %rbp
+  800705:	48 89 e5             	mov    %rsp,%rbp
+  800708:	41 57                	push   %r15
+  80070a:	41 56                	push   %r14
+  80070c:	41 55                	push   %r13
+  80070e:	41 54                	push   %r12
+  800710:	53                   	push   %rbx
+  800711:	48 83 ec 08          	sub    $0x8,%rsp
+  800715:	49 89 f7             	mov    %rsi,%r15
+    for (int i = MAX(fdnum, 0); i < MAXFD; i++) {
+  800718:	85 ff                	test   %edi,%edi
+  80071a:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  800720:	44 0f 49 e7          	cmovns %edi,%r12d
+  800724:	83 ff 1f             	cmp    $0x1f,%edi
+  800727:	7f 37                	jg     800760 <fd_alloc_from+0x5c>
+  800729:	49 63 dc             	movslq %r12d,%rbx
+  80072c:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  800733:	48 c1 e3 0c          	shl    $0xc,%rbx
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  800737:	49 be 0d 18 80 00 00 	movabs $0x80180d,%r14
+  80073e:	00 00 00 
+        struct Fd *fd = INDEX2FD(i);
+  800741:	49 89 dd             	mov    %rbx,%r13
+        if (!(get_prot(fd) & PROT_R)) {
+  800744:	48 89 df             	mov    %rbx,%rdi
+  800747:	41 ff d6             	call   *%r14
+  80074a:	83 e0 04             	and    $0x4,%eax
+  80074d:	74 1c                	je     80076b <fd_alloc_from+0x67>
+    for (int i = MAX(fdnum, 0); i < MAXFD; i++) {
+  80074f:	41 83 c4 01          	add    $0x1,%r12d
+  800753:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  80075a:	41 83 fc 1f          	cmp    $0x1f,%r12d
+  80075e:	7e e1                	jle    800741 <fd_alloc_from+0x3d>
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  800760:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  800766:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  80076b:	4d 89 2f             	mov    %r13,(%r15)
+}
+  80076e:	48 83 c4 08          	add    $0x8,%rsp
+  800772:	5b                   	pop    %rbx
+  800773:	41 5c                	pop    %r12
+  800775:	41 5d                	pop    %r13
+  800777:	41 5e                	pop    %r14
+  800779:	41 5f                	pop    %r15
+  80077b:	5d                   	pop    %rbp
+  80077c:	c3                   	ret
+
+000000000080077d <fd_alloc>:
+fd_alloc(struct Fd **fd_store) {
+  80077d:	55                   	push   %rbp
+  80077e:	48 89 e5             	mov    %rsp,%rbp
+  800781:	48 89 fe             	mov    %rdi,%rsi
+    return fd_alloc_from(0, fd_store);
+  800784:	bf 00 00 00 00       	mov    $0x0,%edi
+  800789:	48 b8 04 07 80 00 00 	movabs $0x800704,%rax
+  800790:	00 00 00 
+  800793:	ff d0                	call   *%rax
+}
+  800795:	5d                   	pop    %rbp
+  800796:	c3                   	ret
+
+0000000000800797 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  800797:	83 ff 1f             	cmp    $0x1f,%edi
+  80079a:	77 39                	ja     8007d5 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  80079c:	55                   	push   %rbp
+  80079d:	48 89 e5             	mov    %rsp,%rbp
+  8007a0:	41 54                	push   %r12
+  8007a2:	53                   	push   %rbx
+  8007a3:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  8007a6:	48 63 df             	movslq %edi,%rbx
+  8007a9:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  8007b0:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  8007b4:	48 89 df             	mov    %rbx,%rdi
+  8007b7:	48 b8 0d 18 80 00 00 	movabs $0x80180d,%rax
+  8007be:	00 00 00 
+  8007c1:	ff d0                	call   *%rax
+  8007c3:	a8 04                	test   $0x4,%al
+  8007c5:	74 14                	je     8007db <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  8007c7:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  8007cb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8007d0:	5b                   	pop    %rbx
+  8007d1:	41 5c                	pop    %r12
+  8007d3:	5d                   	pop    %rbp
+  8007d4:	c3                   	ret
+        return -E_INVAL;
+  8007d5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8007da:	c3                   	ret
+        return -E_INVAL;
+  8007db:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8007e0:	eb ee                	jmp    8007d0 <fd_lookup+0x39>
+
+00000000008007e2 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  8007e2:	55                   	push   %rbp
+  8007e3:	48 89 e5             	mov    %rsp,%rbp
+  8007e6:	41 54                	push   %r12
+  8007e8:	53                   	push   %rbx
+  8007e9:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  8007ec:	48 b8 60 2d 80 00 00 	movabs $0x802d60,%rax
+  8007f3:	00 00 00 
+  8007f6:	48 bb 20 40 80 00 00 	movabs $0x804020,%rbx
+  8007fd:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  800800:	39 3b                	cmp    %edi,(%rbx)
+  800802:	74 47                	je     80084b <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  800804:	48 83 c0 08          	add    $0x8,%rax
+  800808:	48 8b 18             	mov    (%rax),%rbx
+  80080b:	48 85 db             	test   %rbx,%rbx
+  80080e:	75 f0                	jne    800800 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  800810:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  800817:	00 00 00 
+  80081a:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+  800820:	89 fa                	mov    %edi,%edx
+  800822:	48 bf d0 2c 80 00 00 	movabs $0x802cd0,%rdi
+  800829:	00 00 00 
+  80082c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800831:	48 b9 7c 1d 80 00 00 	movabs $0x801d7c,%rcx
+  800838:	00 00 00 
+  80083b:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  80083d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  800842:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  800846:	5b                   	pop    %rbx
+  800847:	41 5c                	pop    %r12
+  800849:	5d                   	pop    %rbp
+  80084a:	c3                   	ret
+            return 0;
+  80084b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800850:	eb f0                	jmp    800842 <dev_lookup+0x60>
+
+0000000000800852 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  800852:	55                   	push   %rbp
+  800853:	48 89 e5             	mov    %rsp,%rbp
+  800856:	41 55                	push   %r13
+  800858:	41 54                	push   %r12
+  80085a:	53                   	push   %rbx
+  80085b:	48 83 ec 18          	sub    $0x18,%rsp
+  80085f:	48 89 fb             	mov    %rdi,%rbx
+  800862:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  800865:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  80086c:	ff ff ff 
+  80086f:	48 01 df             	add    %rbx,%rdi
+  800872:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  800876:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80087a:	48 b8 97 07 80 00 00 	movabs $0x800797,%rax
+  800881:	00 00 00 
+  800884:	ff d0                	call   *%rax
+  800886:	41 89 c5             	mov    %eax,%r13d
+  800889:	85 c0                	test   %eax,%eax
+  80088b:	78 06                	js     800893 <fd_close+0x41>
+  80088d:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  800891:	74 1a                	je     8008ad <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  800893:	45 84 e4             	test   %r12b,%r12b
+  800896:	b8 00 00 00 00       	mov    $0x0,%eax
+  80089b:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  80089f:	44 89 e8             	mov    %r13d,%eax
+  8008a2:	48 83 c4 18          	add    $0x18,%rsp
+  8008a6:	5b                   	pop    %rbx
+  8008a7:	41 5c                	pop    %r12
+  8008a9:	41 5d                	pop    %r13
+  8008ab:	5d                   	pop    %rbp
+  8008ac:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8008ad:	8b 3b                	mov    (%rbx),%edi
+  8008af:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8008b3:	48 b8 e2 07 80 00 00 	movabs $0x8007e2,%rax
+  8008ba:	00 00 00 
+  8008bd:	ff d0                	call   *%rax
+  8008bf:	41 89 c5             	mov    %eax,%r13d
+  8008c2:	85 c0                	test   %eax,%eax
+  8008c4:	78 1b                	js     8008e1 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  8008c6:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8008ca:	48 8b 40 20          	mov    0x20(%rax),%rax
+  8008ce:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  8008d4:	48 85 c0             	test   %rax,%rax
+  8008d7:	74 08                	je     8008e1 <fd_close+0x8f>
+  8008d9:	48 89 df             	mov    %rbx,%rdi
+  8008dc:	ff d0                	call   *%rax
+  8008de:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8008e1:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8008e6:	48 89 de             	mov    %rbx,%rsi
+  8008e9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8008ee:	48 b8 67 03 80 00 00 	movabs $0x800367,%rax
+  8008f5:	00 00 00 
+  8008f8:	ff d0                	call   *%rax
+    return res;
+  8008fa:	eb a3                	jmp    80089f <fd_close+0x4d>
+
+00000000008008fc <close>:
+
+int
+close(int fdnum) {
+  8008fc:	55                   	push   %rbp
+  8008fd:	48 89 e5             	mov    %rsp,%rbp
+  800900:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  800904:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  800908:	48 b8 97 07 80 00 00 	movabs $0x800797,%rax
+  80090f:	00 00 00 
+  800912:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  800914:	85 c0                	test   %eax,%eax
+  800916:	78 15                	js     80092d <close+0x31>
+
+    return fd_close(fd, 1);
+  800918:	be 01 00 00 00       	mov    $0x1,%esi
+  80091d:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  800921:	48 b8 52 08 80 00 00 	movabs $0x800852,%rax
+  800928:	00 00 00 
+  80092b:	ff d0                	call   *%rax
+}
+  80092d:	c9                   	leave
+  80092e:	c3                   	ret
+
+000000000080092f <close_all>:
+
+void
+close_all(void) {
+  80092f:	55                   	push   %rbp
+  800930:	48 89 e5             	mov    %rsp,%rbp
+  800933:	41 54                	push   %r12
+  800935:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  800936:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80093b:	49 bc fc 08 80 00 00 	movabs $0x8008fc,%r12
+  800942:	00 00 00 
+  800945:	89 df                	mov    %ebx,%edi
+  800947:	41 ff d4             	call   *%r12
+  80094a:	83 c3 01             	add    $0x1,%ebx
+  80094d:	83 fb 20             	cmp    $0x20,%ebx
+  800950:	75 f3                	jne    800945 <close_all+0x16>
+}
+  800952:	5b                   	pop    %rbx
+  800953:	41 5c                	pop    %r12
+  800955:	5d                   	pop    %rbp
+  800956:	c3                   	ret
+
+0000000000800957 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  800957:	55                   	push   %rbp
+  800958:	48 89 e5             	mov    %rsp,%rbp
+  80095b:	41 57                	push   %r15
+  80095d:	41 56                	push   %r14
+  80095f:	41 55                	push   %r13
+  800961:	41 54                	push   %r12
+  800963:	53                   	push   %rbx
+  800964:	48 83 ec 18          	sub    $0x18,%rsp
+  800968:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  80096b:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  80096f:	48 b8 97 07 80 00 00 	movabs $0x800797,%rax
+  800976:	00 00 00 
+  800979:	ff d0                	call   *%rax
+  80097b:	89 c3                	mov    %eax,%ebx
+  80097d:	85 c0                	test   %eax,%eax
+  80097f:	0f 88 b8 00 00 00    	js     800a3d <dup+0xe6>
+    close(newfdnum);
+  800985:	44 89 e7             	mov    %r12d,%edi
+  800988:	48 b8 fc 08 80 00 00 	movabs $0x8008fc,%rax
+  80098f:	00 00 00 
+  800992:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  800994:	4d 63 ec             	movslq %r12d,%r13
+  800997:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  80099e:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  8009a2:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  8009a6:	4c 89 ff             	mov    %r15,%rdi
+  8009a9:	49 be e8 06 80 00 00 	movabs $0x8006e8,%r14
+  8009b0:	00 00 00 
+  8009b3:	41 ff d6             	call   *%r14
+  8009b6:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  8009b9:	4c 89 ef             	mov    %r13,%rdi
+  8009bc:	41 ff d6             	call   *%r14
+  8009bf:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  8009c2:	48 89 df             	mov    %rbx,%rdi
+  8009c5:	48 b8 0d 18 80 00 00 	movabs $0x80180d,%rax
+  8009cc:	00 00 00 
+  8009cf:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  8009d1:	a8 04                	test   $0x4,%al
+  8009d3:	74 2b                	je     800a00 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  8009d5:	41 89 c1             	mov    %eax,%r9d
+  8009d8:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8009de:	4c 89 f1             	mov    %r14,%rcx
+  8009e1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8009e6:	48 89 de             	mov    %rbx,%rsi
+  8009e9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8009ee:	48 b8 02 03 80 00 00 	movabs $0x800302,%rax
+  8009f5:	00 00 00 
+  8009f8:	ff d0                	call   *%rax
+  8009fa:	89 c3                	mov    %eax,%ebx
+  8009fc:	85 c0                	test   %eax,%eax
+  8009fe:	78 4e                	js     800a4e <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  800a00:	4c 89 ff             	mov    %r15,%rdi
+  800a03:	48 b8 0d 18 80 00 00 	movabs $0x80180d,%rax
+  800a0a:	00 00 00 
+  800a0d:	ff d0                	call   *%rax
+  800a0f:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  800a12:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  800a18:	4c 89 e9             	mov    %r13,%rcx
+  800a1b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800a20:	4c 89 fe             	mov    %r15,%rsi
+  800a23:	bf 00 00 00 00       	mov    $0x0,%edi
+  800a28:	48 b8 02 03 80 00 00 	movabs $0x800302,%rax
+  800a2f:	00 00 00 
+  800a32:	ff d0                	call   *%rax
+  800a34:	89 c3                	mov    %eax,%ebx
+  800a36:	85 c0                	test   %eax,%eax
+  800a38:	78 14                	js     800a4e <dup+0xf7>
+
+    return newfdnum;
+  800a3a:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  800a3d:	89 d8                	mov    %ebx,%eax
+  800a3f:	48 83 c4 18          	add    $0x18,%rsp
+  800a43:	5b                   	pop    %rbx
+  800a44:	41 5c                	pop    %r12
+  800a46:	41 5d                	pop    %r13
+  800a48:	41 5e                	pop    %r14
+  800a4a:	41 5f                	pop    %r15
+  800a4c:	5d                   	pop    %rbp
+  800a4d:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  800a4e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800a53:	4c 89 ee             	mov    %r13,%rsi
+  800a56:	bf 00 00 00 00       	mov    $0x0,%edi
+  800a5b:	49 bc 67 03 80 00 00 	movabs $0x800367,%r12
+  800a62:	00 00 00 
+  800a65:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  800a68:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800a6d:	4c 89 f6             	mov    %r14,%rsi
+  800a70:	bf 00 00 00 00       	mov    $0x0,%edi
+  800a75:	41 ff d4             	call   *%r12
+    return res;
+  800a78:	eb c3                	jmp    800a3d <dup+0xe6>
+
+0000000000800a7a <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  800a7a:	55                   	push   %rbp
+  800a7b:	48 89 e5             	mov    %rsp,%rbp
+  800a7e:	41 56                	push   %r14
+  800a80:	41 55                	push   %r13
+  800a82:	41 54                	push   %r12
+  800a84:	53                   	push   %rbx
+  800a85:	48 83 ec 10          	sub    $0x10,%rsp
+  800a89:	89 fb                	mov    %edi,%ebx
+  800a8b:	49 89 f4             	mov    %rsi,%r12
+  800a8e:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800a91:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800a95:	48 b8 97 07 80 00 00 	movabs $0x800797,%rax
+  800a9c:	00 00 00 
+  800a9f:	ff d0                	call   *%rax
+  800aa1:	85 c0                	test   %eax,%eax
+  800aa3:	78 4c                	js     800af1 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800aa5:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  800aa9:	41 8b 3e             	mov    (%r14),%edi
+  800aac:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800ab0:	48 b8 e2 07 80 00 00 	movabs $0x8007e2,%rax
+  800ab7:	00 00 00 
+  800aba:	ff d0                	call   *%rax
+  800abc:	85 c0                	test   %eax,%eax
+  800abe:	78 35                	js     800af5 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  800ac0:	41 8b 46 08          	mov    0x8(%r14),%eax
+  800ac4:	83 e0 03             	and    $0x3,%eax
+  800ac7:	83 f8 01             	cmp    $0x1,%eax
+  800aca:	74 2d                	je     800af9 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  800acc:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800ad0:	48 8b 40 10          	mov    0x10(%rax),%rax
+  800ad4:	48 85 c0             	test   %rax,%rax
+  800ad7:	74 56                	je     800b2f <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  800ad9:	4c 89 ea             	mov    %r13,%rdx
+  800adc:	4c 89 e6             	mov    %r12,%rsi
+  800adf:	4c 89 f7             	mov    %r14,%rdi
+  800ae2:	ff d0                	call   *%rax
+}
+  800ae4:	48 83 c4 10          	add    $0x10,%rsp
+  800ae8:	5b                   	pop    %rbx
+  800ae9:	41 5c                	pop    %r12
+  800aeb:	41 5d                	pop    %r13
+  800aed:	41 5e                	pop    %r14
+  800aef:	5d                   	pop    %rbp
+  800af0:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800af1:	48 98                	cltq
+  800af3:	eb ef                	jmp    800ae4 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800af5:	48 98                	cltq
+  800af7:	eb eb                	jmp    800ae4 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  800af9:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  800b00:	00 00 00 
+  800b03:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+  800b09:	89 da                	mov    %ebx,%edx
+  800b0b:	48 bf 11 2d 80 00 00 	movabs $0x802d11,%rdi
+  800b12:	00 00 00 
+  800b15:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b1a:	48 b9 7c 1d 80 00 00 	movabs $0x801d7c,%rcx
+  800b21:	00 00 00 
+  800b24:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  800b26:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  800b2d:	eb b5                	jmp    800ae4 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  800b2f:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  800b36:	eb ac                	jmp    800ae4 <read+0x6a>
+
+0000000000800b38 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  800b38:	55                   	push   %rbp
+  800b39:	48 89 e5             	mov    %rsp,%rbp
+  800b3c:	41 57                	push   %r15
+  800b3e:	41 56                	push   %r14
+  800b40:	41 55                	push   %r13
+  800b42:	41 54                	push   %r12
+  800b44:	53                   	push   %rbx
+  800b45:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  800b49:	48 85 d2             	test   %rdx,%rdx
+  800b4c:	74 54                	je     800ba2 <readn+0x6a>
+  800b4e:	41 89 fd             	mov    %edi,%r13d
+  800b51:	49 89 f6             	mov    %rsi,%r14
+  800b54:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  800b57:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  800b5c:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  800b61:	49 bf 7a 0a 80 00 00 	movabs $0x800a7a,%r15
+  800b68:	00 00 00 
+  800b6b:	4c 89 e2             	mov    %r12,%rdx
+  800b6e:	48 29 f2             	sub    %rsi,%rdx
+  800b71:	4c 01 f6             	add    %r14,%rsi
+  800b74:	44 89 ef             	mov    %r13d,%edi
+  800b77:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  800b7a:	85 c0                	test   %eax,%eax
+  800b7c:	78 20                	js     800b9e <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  800b7e:	01 c3                	add    %eax,%ebx
+  800b80:	85 c0                	test   %eax,%eax
+  800b82:	74 08                	je     800b8c <readn+0x54>
+  800b84:	48 63 f3             	movslq %ebx,%rsi
+  800b87:	4c 39 e6             	cmp    %r12,%rsi
+  800b8a:	72 df                	jb     800b6b <readn+0x33>
+    }
+    return res;
+  800b8c:	48 63 c3             	movslq %ebx,%rax
+}
+  800b8f:	48 83 c4 08          	add    $0x8,%rsp
+  800b93:	5b                   	pop    %rbx
+  800b94:	41 5c                	pop    %r12
+  800b96:	41 5d                	pop    %r13
+  800b98:	41 5e                	pop    %r14
+  800b9a:	41 5f                	pop    %r15
+  800b9c:	5d                   	pop    %rbp
+  800b9d:	c3                   	ret
+        if (inc < 0) return inc;
+  800b9e:	48 98                	cltq
+  800ba0:	eb ed                	jmp    800b8f <readn+0x57>
+    int inc = 1, res = 0;
+  800ba2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ba7:	eb e3                	jmp    800b8c <readn+0x54>
+
+0000000000800ba9 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  800ba9:	55                   	push   %rbp
+  800baa:	48 89 e5             	mov    %rsp,%rbp
+  800bad:	41 56                	push   %r14
+  800baf:	41 55                	push   %r13
+  800bb1:	41 54                	push   %r12
+  800bb3:	53                   	push   %rbx
+  800bb4:	48 83 ec 10          	sub    $0x10,%rsp
+  800bb8:	89 fb                	mov    %edi,%ebx
+  800bba:	49 89 f4             	mov    %rsi,%r12
+  800bbd:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800bc0:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800bc4:	48 b8 97 07 80 00 00 	movabs $0x800797,%rax
+  800bcb:	00 00 00 
+  800bce:	ff d0                	call   *%rax
+  800bd0:	85 c0                	test   %eax,%eax
+  800bd2:	78 47                	js     800c1b <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800bd4:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  800bd8:	41 8b 3e             	mov    (%r14),%edi
+  800bdb:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800bdf:	48 b8 e2 07 80 00 00 	movabs $0x8007e2,%rax
+  800be6:	00 00 00 
+  800be9:	ff d0                	call   *%rax
+  800beb:	85 c0                	test   %eax,%eax
+  800bed:	78 30                	js     800c1f <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800bef:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  800bf4:	74 2d                	je     800c23 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  800bf6:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800bfa:	48 8b 40 18          	mov    0x18(%rax),%rax
+  800bfe:	48 85 c0             	test   %rax,%rax
+  800c01:	74 56                	je     800c59 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  800c03:	4c 89 ea             	mov    %r13,%rdx
+  800c06:	4c 89 e6             	mov    %r12,%rsi
+  800c09:	4c 89 f7             	mov    %r14,%rdi
+  800c0c:	ff d0                	call   *%rax
+}
+  800c0e:	48 83 c4 10          	add    $0x10,%rsp
+  800c12:	5b                   	pop    %rbx
+  800c13:	41 5c                	pop    %r12
+  800c15:	41 5d                	pop    %r13
+  800c17:	41 5e                	pop    %r14
+  800c19:	5d                   	pop    %rbp
+  800c1a:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800c1b:	48 98                	cltq
+  800c1d:	eb ef                	jmp    800c0e <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800c1f:	48 98                	cltq
+  800c21:	eb eb                	jmp    800c0e <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  800c23:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  800c2a:	00 00 00 
+  800c2d:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+  800c33:	89 da                	mov    %ebx,%edx
+  800c35:	48 bf 2d 2d 80 00 00 	movabs $0x802d2d,%rdi
+  800c3c:	00 00 00 
+  800c3f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c44:	48 b9 7c 1d 80 00 00 	movabs $0x801d7c,%rcx
+  800c4b:	00 00 00 
+  800c4e:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  800c50:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  800c57:	eb b5                	jmp    800c0e <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  800c59:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  800c60:	eb ac                	jmp    800c0e <write+0x65>
+
+0000000000800c62 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  800c62:	55                   	push   %rbp
+  800c63:	48 89 e5             	mov    %rsp,%rbp
+  800c66:	53                   	push   %rbx
+  800c67:	48 83 ec 18          	sub    $0x18,%rsp
+  800c6b:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800c6d:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800c71:	48 b8 97 07 80 00 00 	movabs $0x800797,%rax
+  800c78:	00 00 00 
+  800c7b:	ff d0                	call   *%rax
+  800c7d:	85 c0                	test   %eax,%eax
+  800c7f:	78 0c                	js     800c8d <seek+0x2b>
+
+    fd->fd_offset = offset;
+  800c81:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800c85:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  800c88:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800c8d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800c91:	c9                   	leave
+  800c92:	c3                   	ret
+
+0000000000800c93 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  800c93:	55                   	push   %rbp
+  800c94:	48 89 e5             	mov    %rsp,%rbp
+  800c97:	41 55                	push   %r13
+  800c99:	41 54                	push   %r12
+  800c9b:	53                   	push   %rbx
+  800c9c:	48 83 ec 18          	sub    $0x18,%rsp
+  800ca0:	89 fb                	mov    %edi,%ebx
+  800ca2:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800ca5:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800ca9:	48 b8 97 07 80 00 00 	movabs $0x800797,%rax
+  800cb0:	00 00 00 
+  800cb3:	ff d0                	call   *%rax
+  800cb5:	85 c0                	test   %eax,%eax
+  800cb7:	78 38                	js     800cf1 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800cb9:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  800cbd:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  800cc1:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800cc5:	48 b8 e2 07 80 00 00 	movabs $0x8007e2,%rax
+  800ccc:	00 00 00 
+  800ccf:	ff d0                	call   *%rax
+  800cd1:	85 c0                	test   %eax,%eax
+  800cd3:	78 1c                	js     800cf1 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800cd5:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  800cda:	74 20                	je     800cfc <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  800cdc:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800ce0:	48 8b 40 30          	mov    0x30(%rax),%rax
+  800ce4:	48 85 c0             	test   %rax,%rax
+  800ce7:	74 47                	je     800d30 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  800ce9:	44 89 e6             	mov    %r12d,%esi
+  800cec:	4c 89 ef             	mov    %r13,%rdi
+  800cef:	ff d0                	call   *%rax
+}
+  800cf1:	48 83 c4 18          	add    $0x18,%rsp
+  800cf5:	5b                   	pop    %rbx
+  800cf6:	41 5c                	pop    %r12
+  800cf8:	41 5d                	pop    %r13
+  800cfa:	5d                   	pop    %rbp
+  800cfb:	c3                   	ret
+                thisenv->env_id, fdnum);
+  800cfc:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  800d03:	00 00 00 
+  800d06:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  800d0c:	89 da                	mov    %ebx,%edx
+  800d0e:	48 bf f0 2c 80 00 00 	movabs $0x802cf0,%rdi
+  800d15:	00 00 00 
+  800d18:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d1d:	48 b9 7c 1d 80 00 00 	movabs $0x801d7c,%rcx
+  800d24:	00 00 00 
+  800d27:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  800d29:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800d2e:	eb c1                	jmp    800cf1 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  800d30:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  800d35:	eb ba                	jmp    800cf1 <ftruncate+0x5e>
+
+0000000000800d37 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  800d37:	55                   	push   %rbp
+  800d38:	48 89 e5             	mov    %rsp,%rbp
+  800d3b:	41 54                	push   %r12
+  800d3d:	53                   	push   %rbx
+  800d3e:	48 83 ec 10          	sub    $0x10,%rsp
+  800d42:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800d45:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800d49:	48 b8 97 07 80 00 00 	movabs $0x800797,%rax
+  800d50:	00 00 00 
+  800d53:	ff d0                	call   *%rax
+  800d55:	85 c0                	test   %eax,%eax
+  800d57:	78 4e                	js     800da7 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800d59:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  800d5d:	41 8b 3c 24          	mov    (%r12),%edi
+  800d61:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  800d65:	48 b8 e2 07 80 00 00 	movabs $0x8007e2,%rax
+  800d6c:	00 00 00 
+  800d6f:	ff d0                	call   *%rax
+  800d71:	85 c0                	test   %eax,%eax
+  800d73:	78 32                	js     800da7 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  800d75:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800d79:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  800d7e:	74 30                	je     800db0 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  800d80:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  800d83:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  800d8a:	00 00 00 
+    stat->st_isdir = 0;
+  800d8d:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  800d94:	00 00 00 
+    stat->st_dev = dev;
+  800d97:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  800d9e:	48 89 de             	mov    %rbx,%rsi
+  800da1:	4c 89 e7             	mov    %r12,%rdi
+  800da4:	ff 50 28             	call   *0x28(%rax)
+}
+  800da7:	48 83 c4 10          	add    $0x10,%rsp
+  800dab:	5b                   	pop    %rbx
+  800dac:	41 5c                	pop    %r12
+  800dae:	5d                   	pop    %rbp
+  800daf:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  800db0:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  800db5:	eb f0                	jmp    800da7 <fstat+0x70>
+
+0000000000800db7 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  800db7:	55                   	push   %rbp
+  800db8:	48 89 e5             	mov    %rsp,%rbp
+  800dbb:	41 54                	push   %r12
+  800dbd:	53                   	push   %rbx
+  800dbe:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  800dc1:	be 00 00 00 00       	mov    $0x0,%esi
+  800dc6:	48 b8 9a 11 80 00 00 	movabs $0x80119a,%rax
+  800dcd:	00 00 00 
+  800dd0:	ff d0                	call   *%rax
+  800dd2:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  800dd4:	85 c0                	test   %eax,%eax
+  800dd6:	78 25                	js     800dfd <stat+0x46>
+
+    int res = fstat(fd, stat);
+  800dd8:	4c 89 e6             	mov    %r12,%rsi
+  800ddb:	89 c7                	mov    %eax,%edi
+  800ddd:	48 b8 37 0d 80 00 00 	movabs $0x800d37,%rax
+  800de4:	00 00 00 
+  800de7:	ff d0                	call   *%rax
+  800de9:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  800dec:	89 df                	mov    %ebx,%edi
+  800dee:	48 b8 fc 08 80 00 00 	movabs $0x8008fc,%rax
+  800df5:	00 00 00 
+  800df8:	ff d0                	call   *%rax
+
+    return res;
+  800dfa:	44 89 e3             	mov    %r12d,%ebx
+}
+  800dfd:	89 d8                	mov    %ebx,%eax
+  800dff:	5b                   	pop    %rbx
+  800e00:	41 5c                	pop    %r12
+  800e02:	5d                   	pop    %rbp
+  800e03:	c3                   	ret
+
+0000000000800e04 <fsipc>:
+ * response may be written back to fsipcbuf.
+ * type: request code, passed as the simple integer IPC value.
+ * dstva: virtual address at which to receive reply page, 0 if none.
+ * Returns result from the file server. */
+static int
+fsipc(unsigned type, void *dstva) {
+  800e04:	55                   	push   %rbp
+  800e05:	48 89 e5             	mov    %rsp,%rbp
+  800e08:	41 54                	push   %r12
+  800e0a:	53                   	push   %rbx
+  800e0b:	48 83 ec 10          	sub    $0x10,%rsp
+  800e0f:	41 89 fc             	mov    %edi,%r12d
+  800e12:	48 89 f3             	mov    %rsi,%rbx
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  800e15:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  800e1c:	00 00 00 
+  800e1f:	83 38 00             	cmpl   $0x0,(%rax)
+  800e22:	74 5e                	je     800e82 <fsipc+0x7e>
+    if (debug) {
+        cprintf("[%08x] fsipc %d %08x\n",
+                thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+    }
+
+    ipc_send(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW);
+  800e24:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  800e2a:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  800e2f:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  800e36:	00 00 00 
+  800e39:	44 89 e6             	mov    %r12d,%esi
+  800e3c:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  800e43:	00 00 00 
+  800e46:	8b 38                	mov    (%rax),%edi
+  800e48:	48 b8 9d 2b 80 00 00 	movabs $0x802b9d,%rax
+  800e4f:	00 00 00 
+  800e52:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  800e54:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  800e5b:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  800e5c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e61:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  800e65:	48 89 de             	mov    %rbx,%rsi
+  800e68:	bf 00 00 00 00       	mov    $0x0,%edi
+  800e6d:	48 b8 c8 2a 80 00 00 	movabs $0x802ac8,%rax
+  800e74:	00 00 00 
+  800e77:	ff d0                	call   *%rax
+}
+  800e79:	48 83 c4 10          	add    $0x10,%rsp
+  800e7d:	5b                   	pop    %rbx
+  800e7e:	41 5c                	pop    %r12
+  800e80:	5d                   	pop    %rbp
+  800e81:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  800e82:	bf 03 00 00 00       	mov    $0x3,%edi
+  800e87:	48 b8 40 2c 80 00 00 	movabs $0x802c40,%rax
+  800e8e:	00 00 00 
+  800e91:	ff d0                	call   *%rax
+  800e93:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  800e9a:	00 00 
+  800e9c:	eb 86                	jmp    800e24 <fsipc+0x20>
+
+0000000000800e9e <devfile_trunc>:
+    return 0;
+}
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  800e9e:	55                   	push   %rbp
+  800e9f:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  800ea2:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  800ea9:	00 00 00 
+  800eac:	8b 57 0c             	mov    0xc(%rdi),%edx
+  800eaf:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  800eb1:	89 70 04             	mov    %esi,0x4(%rax)
+
+    return fsipc(FSREQ_SET_SIZE, NULL);
+  800eb4:	be 00 00 00 00       	mov    $0x0,%esi
+  800eb9:	bf 02 00 00 00       	mov    $0x2,%edi
+  800ebe:	48 b8 04 0e 80 00 00 	movabs $0x800e04,%rax
+  800ec5:	00 00 00 
+  800ec8:	ff d0                	call   *%rax
+}
+  800eca:	5d                   	pop    %rbp
+  800ecb:	c3                   	ret
+
+0000000000800ecc <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  800ecc:	55                   	push   %rbp
+  800ecd:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  800ed0:	8b 47 0c             	mov    0xc(%rdi),%eax
+  800ed3:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  800eda:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  800edc:	be 00 00 00 00       	mov    $0x0,%esi
+  800ee1:	bf 06 00 00 00       	mov    $0x6,%edi
+  800ee6:	48 b8 04 0e 80 00 00 	movabs $0x800e04,%rax
+  800eed:	00 00 00 
+  800ef0:	ff d0                	call   *%rax
+}
+  800ef2:	5d                   	pop    %rbp
+  800ef3:	c3                   	ret
+
+0000000000800ef4 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  800ef4:	55                   	push   %rbp
+  800ef5:	48 89 e5             	mov    %rsp,%rbp
+  800ef8:	41 54                	push   %r12
+  800efa:	53                   	push   %rbx
+  800efb:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  800efe:	8b 47 0c             	mov    0xc(%rdi),%eax
+  800f01:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  800f08:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  800f0a:	be 00 00 00 00       	mov    $0x0,%esi
+  800f0f:	bf 05 00 00 00       	mov    $0x5,%edi
+  800f14:	48 b8 04 0e 80 00 00 	movabs $0x800e04,%rax
+  800f1b:	00 00 00 
+  800f1e:	ff d0                	call   *%rax
+    if (res < 0) {
+  800f20:	85 c0                	test   %eax,%eax
+  800f22:	78 3d                	js     800f61 <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  800f24:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  800f2b:	00 00 00 
+  800f2e:	4c 89 e6             	mov    %r12,%rsi
+  800f31:	48 89 df             	mov    %rbx,%rdi
+  800f34:	48 b8 a1 26 80 00 00 	movabs $0x8026a1,%rax
+  800f3b:	00 00 00 
+  800f3e:	ff d0                	call   *%rax
+    st->st_size  = fsipcbuf.statRet.ret_size;
+  800f40:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  800f47:	00 
+  800f48:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  800f4e:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  800f55:	00 
+  800f56:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  800f5c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800f61:	5b                   	pop    %rbx
+  800f62:	41 5c                	pop    %r12
+  800f64:	5d                   	pop    %rbp
+  800f65:	c3                   	ret
+
+0000000000800f66 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  800f66:	55                   	push   %rbp
+  800f67:	48 89 e5             	mov    %rsp,%rbp
+  800f6a:	41 57                	push   %r15
+  800f6c:	41 56                	push   %r14
+  800f6e:	41 55                	push   %r13
+  800f70:	41 54                	push   %r12
+  800f72:	53                   	push   %rbx
+  800f73:	48 83 ec 18          	sub    $0x18,%rsp
+  800f77:	49 89 fe             	mov    %rdi,%r14
+  800f7a:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+  800f7e:	48 89 d3             	mov    %rdx,%rbx
+    while (n > sizeof(fsipcbuf.write.req_buf))
+  800f81:	48 81 fa f0 0f 00 00 	cmp    $0xff0,%rdx
+  800f88:	0f 86 e4 00 00 00    	jbe    801072 <devfile_write+0x10c>
+  800f8e:	49 89 f4             	mov    %rsi,%r12
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  800f91:	49 bd 00 60 80 00 00 	movabs $0x806000,%r13
+  800f98:	00 00 00 
+        memcpy(fsipcbuf.write.req_buf, buf, sizeof(fsipcbuf.write.req_buf));
+  800f9b:	49 bf 02 29 80 00 00 	movabs $0x802902,%r15
+  800fa2:	00 00 00 
+  800fa5:	eb 03                	jmp    800faa <devfile_write+0x44>
+        buf += sizeof(fsipcbuf.write.req_buf);
+  800fa7:	49 89 f4             	mov    %rsi,%r12
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  800faa:	41 8b 46 0c          	mov    0xc(%r14),%eax
+  800fae:	41 89 45 00          	mov    %eax,0x0(%r13)
+        fsipcbuf.write.req_n      = sizeof(fsipcbuf.write.req_buf);
+  800fb2:	49 c7 45 08 f0 0f 00 	movq   $0xff0,0x8(%r13)
+  800fb9:	00 
+        memcpy(fsipcbuf.write.req_buf, buf, sizeof(fsipcbuf.write.req_buf));
+  800fba:	ba f0 0f 00 00       	mov    $0xff0,%edx
+  800fbf:	4c 89 e6             	mov    %r12,%rsi
+  800fc2:	48 bf 10 60 80 00 00 	movabs $0x806010,%rdi
+  800fc9:	00 00 00 
+  800fcc:	41 ff d7             	call   *%r15
+        ssize_t res = fsipc(FSREQ_WRITE, NULL);
+  800fcf:	be 00 00 00 00       	mov    $0x0,%esi
+  800fd4:	bf 04 00 00 00       	mov    $0x4,%edi
+  800fd9:	48 b8 04 0e 80 00 00 	movabs $0x800e04,%rax
+  800fe0:	00 00 00 
+  800fe3:	ff d0                	call   *%rax
+  800fe5:	48 63 d0             	movslq %eax,%rdx
+        if (res < 0 || res < sizeof(fsipcbuf.write.req_buf))
+  800fe8:	3d ef 0f 00 00       	cmp    $0xfef,%eax
+  800fed:	7e 71                	jle    801060 <devfile_write+0xfa>
+        buf += sizeof(fsipcbuf.write.req_buf);
+  800fef:	49 8d b4 24 f0 0f 00 	lea    0xff0(%r12),%rsi
+  800ff6:	00 
+        n -= sizeof(fsipcbuf.write.req_buf);
+  800ff7:	48 81 eb f0 0f 00 00 	sub    $0xff0,%rbx
+    while (n > sizeof(fsipcbuf.write.req_buf))
+  800ffe:	48 81 fb f0 0f 00 00 	cmp    $0xff0,%rbx
+  801005:	77 a0                	ja     800fa7 <devfile_write+0x41>
+        written += sizeof(fsipcbuf.write.req_buf);
+  801007:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80100b:	49 29 c4             	sub    %rax,%r12
+  80100e:	4d 8d a4 24 f0 0f 00 	lea    0xff0(%r12),%r12
+  801015:	00 
+    fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801016:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  80101d:	00 00 00 
+  801020:	41 8b 56 0c          	mov    0xc(%r14),%edx
+  801024:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.write.req_n      = n;
+  801026:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    memcpy(fsipcbuf.write.req_buf, buf, n);
+  80102a:	48 89 da             	mov    %rbx,%rdx
+  80102d:	48 8d 78 10          	lea    0x10(%rax),%rdi
+  801031:	48 b8 02 29 80 00 00 	movabs $0x802902,%rax
+  801038:	00 00 00 
+  80103b:	ff d0                	call   *%rax
+    ssize_t res = fsipc(FSREQ_WRITE, NULL);
+  80103d:	be 00 00 00 00       	mov    $0x0,%esi
+  801042:	bf 04 00 00 00       	mov    $0x4,%edi
+  801047:	48 b8 04 0e 80 00 00 	movabs $0x800e04,%rax
+  80104e:	00 00 00 
+  801051:	ff d0                	call   *%rax
+  801053:	48 63 d0             	movslq %eax,%rdx
+    written += res;
+  801056:	49 01 d4             	add    %rdx,%r12
+  801059:	48 85 d2             	test   %rdx,%rdx
+  80105c:	49 0f 49 d4          	cmovns %r12,%rdx
+}
+  801060:	48 89 d0             	mov    %rdx,%rax
+  801063:	48 83 c4 18          	add    $0x18,%rsp
+  801067:	5b                   	pop    %rbx
+  801068:	41 5c                	pop    %r12
+  80106a:	41 5d                	pop    %r13
+  80106c:	41 5e                	pop    %r14
+  80106e:	41 5f                	pop    %r15
+  801070:	5d                   	pop    %rbp
+  801071:	c3                   	ret
+    while (n > sizeof(fsipcbuf.write.req_buf))
+  801072:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+    ssize_t written = 0;
+  801076:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80107c:	eb 98                	jmp    801016 <devfile_write+0xb0>
+
+000000000080107e <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  80107e:	55                   	push   %rbp
+  80107f:	48 89 e5             	mov    %rsp,%rbp
+  801082:	41 57                	push   %r15
+  801084:	41 56                	push   %r14
+  801086:	41 55                	push   %r13
+  801088:	41 54                	push   %r12
+  80108a:	53                   	push   %rbx
+  80108b:	48 83 ec 18          	sub    $0x18,%rsp
+  80108f:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  801093:	49 89 f6             	mov    %rsi,%r14
+  801096:	49 89 d4             	mov    %rdx,%r12
+    while (n > sizeof(fsipcbuf.readRet.ret_buf))
+  801099:	48 81 fa 00 10 00 00 	cmp    $0x1000,%rdx
+  8010a0:	0f 86 ea 00 00 00    	jbe    801190 <devfile_read+0x112>
+    ssize_t readsz = 0;
+  8010a6:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  8010ad:	00 
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8010ae:	49 bf 00 60 80 00 00 	movabs $0x806000,%r15
+  8010b5:	00 00 00 
+  8010b8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8010bc:	8b 40 0c             	mov    0xc(%rax),%eax
+  8010bf:	41 89 07             	mov    %eax,(%r15)
+        fsipcbuf.read.req_n = sizeof(fsipcbuf.readRet.ret_buf);
+  8010c2:	49 c7 47 08 00 10 00 	movq   $0x1000,0x8(%r15)
+  8010c9:	00 
+        ssize_t res = fsipc(FSREQ_READ, NULL);
+  8010ca:	be 00 00 00 00       	mov    $0x0,%esi
+  8010cf:	bf 03 00 00 00       	mov    $0x3,%edi
+  8010d4:	48 b8 04 0e 80 00 00 	movabs $0x800e04,%rax
+  8010db:	00 00 00 
+  8010de:	ff d0                	call   *%rax
+  8010e0:	4c 63 e8             	movslq %eax,%r13
+        if (res < 0)
+  8010e3:	4d 85 ed             	test   %r13,%r13
+  8010e6:	0f 88 92 00 00 00    	js     80117e <devfile_read+0x100>
+        memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  8010ec:	4c 89 ea             	mov    %r13,%rdx
+  8010ef:	4c 89 fe             	mov    %r15,%rsi
+  8010f2:	4c 89 f7             	mov    %r14,%rdi
+  8010f5:	48 b8 02 29 80 00 00 	movabs $0x802902,%rax
+  8010fc:	00 00 00 
+  8010ff:	ff d0                	call   *%rax
+        if (res < sizeof(fsipcbuf.readRet.ret_buf))
+  801101:	49 81 fd ff 0f 00 00 	cmp    $0xfff,%r13
+  801108:	76 6d                	jbe    801177 <devfile_read+0xf9>
+        readsz += res;
+  80110a:	4c 01 6d c0          	add    %r13,-0x40(%rbp)
+        buf += res;
+  80110e:	4d 01 ee             	add    %r13,%r14
+        n -= res;
+  801111:	4d 29 ec             	sub    %r13,%r12
+    while (n > sizeof(fsipcbuf.readRet.ret_buf))
+  801114:	49 81 fc 00 10 00 00 	cmp    $0x1000,%r12
+  80111b:	77 9b                	ja     8010b8 <devfile_read+0x3a>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  80111d:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  801124:	00 00 00 
+  801127:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  80112b:	8b 51 0c             	mov    0xc(%rcx),%edx
+  80112e:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.read.req_n = n;
+  801130:	4c 89 60 08          	mov    %r12,0x8(%rax)
+    ssize_t res = fsipc(FSREQ_READ, NULL);
+  801134:	be 00 00 00 00       	mov    $0x0,%esi
+  801139:	bf 03 00 00 00       	mov    $0x3,%edi
+  80113e:	48 b8 04 0e 80 00 00 	movabs $0x800e04,%rax
+  801145:	00 00 00 
+  801148:	ff d0                	call   *%rax
+  80114a:	4c 63 e8             	movslq %eax,%r13
+    if (res < 0)
+  80114d:	4d 85 ed             	test   %r13,%r13
+  801150:	78 2c                	js     80117e <devfile_read+0x100>
+    memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  801152:	4c 89 ea             	mov    %r13,%rdx
+  801155:	48 be 00 60 80 00 00 	movabs $0x806000,%rsi
+  80115c:	00 00 00 
+  80115f:	4c 89 f7             	mov    %r14,%rdi
+  801162:	48 b8 02 29 80 00 00 	movabs $0x802902,%rax
+  801169:	00 00 00 
+  80116c:	ff d0                	call   *%rax
+    readsz += res;
+  80116e:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  801172:	49 01 c5             	add    %rax,%r13
+    return readsz;
+  801175:	eb 07                	jmp    80117e <devfile_read+0x100>
+            return readsz + res;
+  801177:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80117b:	49 01 c5             	add    %rax,%r13
+}
+  80117e:	4c 89 e8             	mov    %r13,%rax
+  801181:	48 83 c4 18          	add    $0x18,%rsp
+  801185:	5b                   	pop    %rbx
+  801186:	41 5c                	pop    %r12
+  801188:	41 5d                	pop    %r13
+  80118a:	41 5e                	pop    %r14
+  80118c:	41 5f                	pop    %r15
+  80118e:	5d                   	pop    %rbp
+  80118f:	c3                   	ret
+    ssize_t readsz = 0;
+  801190:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  801197:	00 
+  801198:	eb 83                	jmp    80111d <devfile_read+0x9f>
+
+000000000080119a <open>:
+open(const char *path, int mode) {
+  80119a:	55                   	push   %rbp
+  80119b:	48 89 e5             	mov    %rsp,%rbp
+  80119e:	41 55                	push   %r13
+  8011a0:	41 54                	push   %r12
+  8011a2:	53                   	push   %rbx
+  8011a3:	48 83 ec 18          	sub    $0x18,%rsp
+  8011a7:	49 89 fc             	mov    %rdi,%r12
+  8011aa:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  8011ad:	48 b8 63 26 80 00 00 	movabs $0x802663,%rax
+  8011b4:	00 00 00 
+  8011b7:	ff d0                	call   *%rax
+  8011b9:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  8011bf:	0f 87 8a 00 00 00    	ja     80124f <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8011c5:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  8011c9:	48 b8 7d 07 80 00 00 	movabs $0x80077d,%rax
+  8011d0:	00 00 00 
+  8011d3:	ff d0                	call   *%rax
+  8011d5:	89 c3                	mov    %eax,%ebx
+  8011d7:	85 c0                	test   %eax,%eax
+  8011d9:	78 50                	js     80122b <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  8011db:	4c 89 e6             	mov    %r12,%rsi
+  8011de:	48 bb 00 60 80 00 00 	movabs $0x806000,%rbx
+  8011e5:	00 00 00 
+  8011e8:	48 89 df             	mov    %rbx,%rdi
+  8011eb:	48 b8 a1 26 80 00 00 	movabs $0x8026a1,%rax
+  8011f2:	00 00 00 
+  8011f5:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  8011f7:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  8011fe:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  801202:	bf 01 00 00 00       	mov    $0x1,%edi
+  801207:	48 b8 04 0e 80 00 00 	movabs $0x800e04,%rax
+  80120e:	00 00 00 
+  801211:	ff d0                	call   *%rax
+  801213:	89 c3                	mov    %eax,%ebx
+  801215:	85 c0                	test   %eax,%eax
+  801217:	78 1f                	js     801238 <open+0x9e>
+    return fd2num(fd);
+  801219:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80121d:	48 b8 d6 06 80 00 00 	movabs $0x8006d6,%rax
+  801224:	00 00 00 
+  801227:	ff d0                	call   *%rax
+  801229:	89 c3                	mov    %eax,%ebx
+}
+  80122b:	89 d8                	mov    %ebx,%eax
+  80122d:	48 83 c4 18          	add    $0x18,%rsp
+  801231:	5b                   	pop    %rbx
+  801232:	41 5c                	pop    %r12
+  801234:	41 5d                	pop    %r13
+  801236:	5d                   	pop    %rbp
+  801237:	c3                   	ret
+        fd_close(fd, 0);
+  801238:	be 00 00 00 00       	mov    $0x0,%esi
+  80123d:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  801241:	48 b8 52 08 80 00 00 	movabs $0x800852,%rax
+  801248:	00 00 00 
+  80124b:	ff d0                	call   *%rax
+        return res;
+  80124d:	eb dc                	jmp    80122b <open+0x91>
+        return -E_BAD_PATH;
+  80124f:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  801254:	eb d5                	jmp    80122b <open+0x91>
+
+0000000000801256 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  801256:	55                   	push   %rbp
+  801257:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc(FSREQ_SYNC, NULL);
+  80125a:	be 00 00 00 00       	mov    $0x0,%esi
+  80125f:	bf 08 00 00 00       	mov    $0x8,%edi
+  801264:	48 b8 04 0e 80 00 00 	movabs $0x800e04,%rax
+  80126b:	00 00 00 
+  80126e:	ff d0                	call   *%rax
+}
+  801270:	5d                   	pop    %rbp
+  801271:	c3                   	ret
+
+0000000000801272 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  801272:	55                   	push   %rbp
+  801273:	48 89 e5             	mov    %rsp,%rbp
+  801276:	41 54                	push   %r12
+  801278:	53                   	push   %rbx
+  801279:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80127c:	48 b8 e8 06 80 00 00 	movabs $0x8006e8,%rax
+  801283:	00 00 00 
+  801286:	ff d0                	call   *%rax
+  801288:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  80128b:	48 be 80 2d 80 00 00 	movabs $0x802d80,%rsi
+  801292:	00 00 00 
+  801295:	48 89 df             	mov    %rbx,%rdi
+  801298:	48 b8 a1 26 80 00 00 	movabs $0x8026a1,%rax
+  80129f:	00 00 00 
+  8012a2:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  8012a4:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  8012a9:	41 2b 04 24          	sub    (%r12),%eax
+  8012ad:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  8012b3:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8012ba:	00 00 00 
+    stat->st_dev = &devpipe;
+  8012bd:	48 b8 60 40 80 00 00 	movabs $0x804060,%rax
+  8012c4:	00 00 00 
+  8012c7:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  8012ce:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012d3:	5b                   	pop    %rbx
+  8012d4:	41 5c                	pop    %r12
+  8012d6:	5d                   	pop    %rbp
+  8012d7:	c3                   	ret
+
+00000000008012d8 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  8012d8:	55                   	push   %rbp
+  8012d9:	48 89 e5             	mov    %rsp,%rbp
+  8012dc:	41 54                	push   %r12
+  8012de:	53                   	push   %rbx
+  8012df:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8012e2:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8012e7:	48 89 fe             	mov    %rdi,%rsi
+  8012ea:	bf 00 00 00 00       	mov    $0x0,%edi
+  8012ef:	49 bc 67 03 80 00 00 	movabs $0x800367,%r12
+  8012f6:	00 00 00 
+  8012f9:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  8012fc:	48 89 df             	mov    %rbx,%rdi
+  8012ff:	48 b8 e8 06 80 00 00 	movabs $0x8006e8,%rax
+  801306:	00 00 00 
+  801309:	ff d0                	call   *%rax
+  80130b:	48 89 c6             	mov    %rax,%rsi
+  80130e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801313:	bf 00 00 00 00       	mov    $0x0,%edi
+  801318:	41 ff d4             	call   *%r12
+}
+  80131b:	5b                   	pop    %rbx
+  80131c:	41 5c                	pop    %r12
+  80131e:	5d                   	pop    %rbp
+  80131f:	c3                   	ret
+
+0000000000801320 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  801320:	55                   	push   %rbp
+  801321:	48 89 e5             	mov    %rsp,%rbp
+  801324:	41 57                	push   %r15
+  801326:	41 56                	push   %r14
+  801328:	41 55                	push   %r13
+  80132a:	41 54                	push   %r12
+  80132c:	53                   	push   %rbx
+  80132d:	48 83 ec 18          	sub    $0x18,%rsp
+  801331:	49 89 fc             	mov    %rdi,%r12
+  801334:	49 89 f5             	mov    %rsi,%r13
+  801337:	49 89 d7             	mov    %rdx,%r15
+  80133a:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80133e:	48 b8 e8 06 80 00 00 	movabs $0x8006e8,%rax
+  801345:	00 00 00 
+  801348:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  80134a:	4d 85 ff             	test   %r15,%r15
+  80134d:	0f 84 af 00 00 00    	je     801402 <devpipe_write+0xe2>
+  801353:	48 89 c3             	mov    %rax,%rbx
+  801356:	4c 89 f8             	mov    %r15,%rax
+  801359:	4d 89 ef             	mov    %r13,%r15
+  80135c:	4c 01 e8             	add    %r13,%rax
+  80135f:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  801363:	49 bd 6f 02 80 00 00 	movabs $0x80026f,%r13
+  80136a:	00 00 00 
+            sys_yield();
+  80136d:	49 be 0c 02 80 00 00 	movabs $0x80020c,%r14
+  801374:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  801377:	8b 73 04             	mov    0x4(%rbx),%esi
+  80137a:	48 63 ce             	movslq %esi,%rcx
+  80137d:	48 63 03             	movslq (%rbx),%rax
+  801380:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  801386:	48 39 c1             	cmp    %rax,%rcx
+  801389:	72 2e                	jb     8013b9 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80138b:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  801390:	48 89 da             	mov    %rbx,%rdx
+  801393:	be 00 10 00 00       	mov    $0x1000,%esi
+  801398:	4c 89 e7             	mov    %r12,%rdi
+  80139b:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  80139e:	85 c0                	test   %eax,%eax
+  8013a0:	74 66                	je     801408 <devpipe_write+0xe8>
+            sys_yield();
+  8013a2:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  8013a5:	8b 73 04             	mov    0x4(%rbx),%esi
+  8013a8:	48 63 ce             	movslq %esi,%rcx
+  8013ab:	48 63 03             	movslq (%rbx),%rax
+  8013ae:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  8013b4:	48 39 c1             	cmp    %rax,%rcx
+  8013b7:	73 d2                	jae    80138b <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8013b9:	41 0f b6 3f          	movzbl (%r15),%edi
+  8013bd:	48 89 ca             	mov    %rcx,%rdx
+  8013c0:	48 c1 ea 03          	shr    $0x3,%rdx
+  8013c4:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  8013cb:	08 10 20 
+  8013ce:	48 f7 e2             	mul    %rdx
+  8013d1:	48 c1 ea 06          	shr    $0x6,%rdx
+  8013d5:	48 89 d0             	mov    %rdx,%rax
+  8013d8:	48 c1 e0 09          	shl    $0x9,%rax
+  8013dc:	48 29 d0             	sub    %rdx,%rax
+  8013df:	48 c1 e0 03          	shl    $0x3,%rax
+  8013e3:	48 29 c1             	sub    %rax,%rcx
+  8013e6:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  8013eb:	83 c6 01             	add    $0x1,%esi
+  8013ee:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8013f1:	49 83 c7 01          	add    $0x1,%r15
+  8013f5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8013f9:	49 39 c7             	cmp    %rax,%r15
+  8013fc:	0f 85 75 ff ff ff    	jne    801377 <devpipe_write+0x57>
+    return n;
+  801402:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  801406:	eb 05                	jmp    80140d <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  801408:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80140d:	48 83 c4 18          	add    $0x18,%rsp
+  801411:	5b                   	pop    %rbx
+  801412:	41 5c                	pop    %r12
+  801414:	41 5d                	pop    %r13
+  801416:	41 5e                	pop    %r14
+  801418:	41 5f                	pop    %r15
+  80141a:	5d                   	pop    %rbp
+  80141b:	c3                   	ret
+
+000000000080141c <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  80141c:	55                   	push   %rbp
+  80141d:	48 89 e5             	mov    %rsp,%rbp
+  801420:	41 57                	push   %r15
+  801422:	41 56                	push   %r14
+  801424:	41 55                	push   %r13
+  801426:	41 54                	push   %r12
+  801428:	53                   	push   %rbx
+  801429:	48 83 ec 18          	sub    $0x18,%rsp
+  80142d:	49 89 fc             	mov    %rdi,%r12
+  801430:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  801434:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  801438:	48 b8 e8 06 80 00 00 	movabs $0x8006e8,%rax
+  80143f:	00 00 00 
+  801442:	ff d0                	call   *%rax
+  801444:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  801447:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80144d:	49 bd 6f 02 80 00 00 	movabs $0x80026f,%r13
+  801454:	00 00 00 
+            sys_yield();
+  801457:	49 be 0c 02 80 00 00 	movabs $0x80020c,%r14
+  80145e:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  801461:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  801466:	74 7d                	je     8014e5 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  801468:	8b 03                	mov    (%rbx),%eax
+  80146a:	3b 43 04             	cmp    0x4(%rbx),%eax
+  80146d:	75 26                	jne    801495 <devpipe_read+0x79>
+            if (i > 0) return i;
+  80146f:	4d 85 ff             	test   %r15,%r15
+  801472:	75 77                	jne    8014eb <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  801474:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  801479:	48 89 da             	mov    %rbx,%rdx
+  80147c:	be 00 10 00 00       	mov    $0x1000,%esi
+  801481:	4c 89 e7             	mov    %r12,%rdi
+  801484:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  801487:	85 c0                	test   %eax,%eax
+  801489:	74 72                	je     8014fd <devpipe_read+0xe1>
+            sys_yield();
+  80148b:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  80148e:	8b 03                	mov    (%rbx),%eax
+  801490:	3b 43 04             	cmp    0x4(%rbx),%eax
+  801493:	74 df                	je     801474 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  801495:	48 63 c8             	movslq %eax,%rcx
+  801498:	48 89 ca             	mov    %rcx,%rdx
+  80149b:	48 c1 ea 03          	shr    $0x3,%rdx
+  80149f:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  8014a6:	08 10 20 
+  8014a9:	48 89 d0             	mov    %rdx,%rax
+  8014ac:	48 f7 e6             	mul    %rsi
+  8014af:	48 c1 ea 06          	shr    $0x6,%rdx
+  8014b3:	48 89 d0             	mov    %rdx,%rax
+  8014b6:	48 c1 e0 09          	shl    $0x9,%rax
+  8014ba:	48 29 d0             	sub    %rdx,%rax
+  8014bd:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  8014c4:	00 
+  8014c5:	48 89 c8             	mov    %rcx,%rax
+  8014c8:	48 29 d0             	sub    %rdx,%rax
+  8014cb:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  8014d0:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8014d4:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  8014d8:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8014db:	49 83 c7 01          	add    $0x1,%r15
+  8014df:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  8014e3:	75 83                	jne    801468 <devpipe_read+0x4c>
+    return n;
+  8014e5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8014e9:	eb 03                	jmp    8014ee <devpipe_read+0xd2>
+            if (i > 0) return i;
+  8014eb:	4c 89 f8             	mov    %r15,%rax
+}
+  8014ee:	48 83 c4 18          	add    $0x18,%rsp
+  8014f2:	5b                   	pop    %rbx
+  8014f3:	41 5c                	pop    %r12
+  8014f5:	41 5d                	pop    %r13
+  8014f7:	41 5e                	pop    %r14
+  8014f9:	41 5f                	pop    %r15
+  8014fb:	5d                   	pop    %rbp
+  8014fc:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  8014fd:	b8 00 00 00 00       	mov    $0x0,%eax
+  801502:	eb ea                	jmp    8014ee <devpipe_read+0xd2>
+
+0000000000801504 <pipe>:
+pipe(int pfd[2]) {
+  801504:	55                   	push   %rbp
+  801505:	48 89 e5             	mov    %rsp,%rbp
+  801508:	41 55                	push   %r13
+  80150a:	41 54                	push   %r12
+  80150c:	53                   	push   %rbx
+  80150d:	48 81 ec b8 00 00 00 	sub    $0xb8,%rsp
+  801514:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  801517:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  80151b:	48 b8 7d 07 80 00 00 	movabs $0x80077d,%rax
+  801522:	00 00 00 
+  801525:	ff d0                	call   *%rax
+  801527:	89 c3                	mov    %eax,%ebx
+  801529:	85 c0                	test   %eax,%eax
+  80152b:	0f 88 51 01 00 00    	js     801682 <pipe+0x17e>
+        (res = fd_alloc_from(fd2num(fd0) + 1, &fd1)) < 0) goto err;
+  801531:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  801535:	48 b8 d6 06 80 00 00 	movabs $0x8006d6,%rax
+  80153c:	00 00 00 
+  80153f:	ff d0                	call   *%rax
+  801541:	8d 78 01             	lea    0x1(%rax),%edi
+  801544:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801548:	48 b8 04 07 80 00 00 	movabs $0x800704,%rax
+  80154f:	00 00 00 
+  801552:	ff d0                	call   *%rax
+  801554:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  801556:	85 c0                	test   %eax,%eax
+  801558:	0f 88 24 01 00 00    	js     801682 <pipe+0x17e>
+    va = fd2data(fd0);
+  80155e:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  801562:	48 bb e8 06 80 00 00 	movabs $0x8006e8,%rbx
+  801569:	00 00 00 
+  80156c:	ff d3                	call   *%rbx
+  80156e:	49 89 c5             	mov    %rax,%r13
+    struct RegionOp ops[] = {
+  801571:	48 8d bd 30 ff ff ff 	lea    -0xd0(%rbp),%rdi
+  801578:	b9 14 00 00 00       	mov    $0x14,%ecx
+  80157d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801582:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+  801585:	c7 85 34 ff ff ff 46 	movl   $0x46,-0xcc(%rbp)
+  80158c:	00 00 00 
+  80158f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801593:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+  80159a:	48 c7 85 50 ff ff ff 	movq   $0x1000,-0xb0(%rbp)
+  8015a1:	00 10 00 00 
+  8015a5:	c7 85 5c ff ff ff 46 	movl   $0x46,-0xa4(%rbp)
+  8015ac:	00 00 00 
+            {.type = REGION_ALLOC, .dstva = (uintptr_t)fd1, .size = PAGE_SIZE, .perm = PROT_RW | PROT_SHARE},
+  8015af:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+    struct RegionOp ops[] = {
+  8015b3:	48 89 bd 70 ff ff ff 	mov    %rdi,-0x90(%rbp)
+  8015ba:	48 c7 85 78 ff ff ff 	movq   $0x1000,-0x88(%rbp)
+  8015c1:	00 10 00 00 
+  8015c5:	c7 45 84 46 00 00 00 	movl   $0x46,-0x7c(%rbp)
+  8015cc:	4c 89 6d 98          	mov    %r13,-0x68(%rbp)
+  8015d0:	48 c7 45 a0 00 10 00 	movq   $0x1000,-0x60(%rbp)
+  8015d7:	00 
+  8015d8:	c7 45 a8 01 00 00 00 	movl   $0x1,-0x58(%rbp)
+  8015df:	c7 45 ac 46 00 00 00 	movl   $0x46,-0x54(%rbp)
+  8015e6:	4c 89 6d b8          	mov    %r13,-0x48(%rbp)
+            {.type = REGION_MAP, .srcva = (uintptr_t)va, .dstva = (uintptr_t)fd2data(fd1), .size = PAGE_SIZE, .perm = PROT_RW | PROT_SHARE},
+  8015ea:	ff d3                	call   *%rbx
+    struct RegionOp ops[] = {
+  8015ec:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8015f0:	48 c7 45 c8 00 10 00 	movq   $0x1000,-0x38(%rbp)
+  8015f7:	00 
+    if ((res = sys_region_batch(ops, sizeof ops / sizeof *ops)) < 0) goto err1;
+  8015f8:	be 04 00 00 00       	mov    $0x4,%esi
+  8015fd:	48 8d bd 30 ff ff ff 	lea    -0xd0(%rbp),%rdi
+  801604:	48 b8 ce 03 80 00 00 	movabs $0x8003ce,%rax
+  80160b:	00 00 00 
+  80160e:	ff d0                	call   *%rax
+  801610:	89 c3                	mov    %eax,%ebx
+  801612:	85 c0                	test   %eax,%eax
+  801614:	0f 88 ad 00 00 00    	js     8016c7 <pipe+0x1c3>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  80161a:	be 00 10 00 00       	mov    $0x1000,%esi
+  80161f:	4c 89 ef             	mov    %r13,%rdi
+  801622:	48 b8 3d 02 80 00 00 	movabs $0x80023d,%rax
+  801629:	00 00 00 
+  80162c:	ff d0                	call   *%rax
+  80162e:	83 f8 02             	cmp    $0x2,%eax
+  801631:	75 5f                	jne    801692 <pipe+0x18e>
+    fd0->fd_dev_id = devpipe.dev_id;
+  801633:	a1 60 40 80 00 00 00 	movabs 0x804060,%eax
+  80163a:	00 00 
+  80163c:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801640:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  801642:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801646:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  80164d:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  801651:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  801653:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801657:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  80165e:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  801662:	48 bb d6 06 80 00 00 	movabs $0x8006d6,%rbx
+  801669:	00 00 00 
+  80166c:	ff d3                	call   *%rbx
+  80166e:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  801672:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  801676:	ff d3                	call   *%rbx
+  801678:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  80167d:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  801682:	89 d8                	mov    %ebx,%eax
+  801684:	48 81 c4 b8 00 00 00 	add    $0xb8,%rsp
+  80168b:	5b                   	pop    %rbx
+  80168c:	41 5c                	pop    %r12
+  80168e:	41 5d                	pop    %r13
+  801690:	5d                   	pop    %rbp
+  801691:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  801692:	48 b9 b0 2d 80 00 00 	movabs $0x802db0,%rcx
+  801699:	00 00 00 
+  80169c:	48 ba 87 2d 80 00 00 	movabs $0x802d87,%rdx
+  8016a3:	00 00 00 
+  8016a6:	be 33 00 00 00       	mov    $0x33,%esi
+  8016ab:	48 bf 9c 2d 80 00 00 	movabs $0x802d9c,%rdi
+  8016b2:	00 00 00 
+  8016b5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016ba:	49 b8 2c 1c 80 00 00 	movabs $0x801c2c,%r8
+  8016c1:	00 00 00 
+  8016c4:	41 ff d0             	call   *%r8
+        ops[i].type = REGION_UNMAP;
+  8016c7:	c7 85 30 ff ff ff 02 	movl   $0x2,-0xd0(%rbp)
+  8016ce:	00 00 00 
+  8016d1:	c7 85 58 ff ff ff 02 	movl   $0x2,-0xa8(%rbp)
+  8016d8:	00 00 00 
+  8016db:	c7 45 80 02 00 00 00 	movl   $0x2,-0x80(%rbp)
+  8016e2:	c7 45 a8 02 00 00 00 	movl   $0x2,-0x58(%rbp)
+    sys_region_batch(ops, sizeof ops / sizeof *ops);
+  8016e9:	be 04 00 00 00       	mov    $0x4,%esi
+  8016ee:	48 8d bd 30 ff ff ff 	lea    -0xd0(%rbp),%rdi
+  8016f5:	48 b8 ce 03 80 00 00 	movabs $0x8003ce,%rax
+  8016fc:	00 00 00 
+  8016ff:	ff d0                	call   *%rax
+  801701:	e9 7c ff ff ff       	jmp    801682 <pipe+0x17e>
+
+0000000000801706 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  801706:	55                   	push   %rbp
+  801707:	48 89 e5             	mov    %rsp,%rbp
+  80170a:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  80170e:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801712:	48 b8 97 07 80 00 00 	movabs $0x800797,%rax
+  801719:	00 00 00 
+  80171c:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80171e:	85 c0                	test   %eax,%eax
+  801720:	78 35                	js     801757 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  801722:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801726:	48 b8 e8 06 80 00 00 	movabs $0x8006e8,%rax
+  80172d:	00 00 00 
+  801730:	ff d0                	call   *%rax
+  801732:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  801735:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80173a:	be 00 10 00 00       	mov    $0x1000,%esi
+  80173f:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801743:	48 b8 6f 02 80 00 00 	movabs $0x80026f,%rax
+  80174a:	00 00 00 
+  80174d:	ff d0                	call   *%rax
+  80174f:	85 c0                	test   %eax,%eax
+  801751:	0f 94 c0             	sete   %al
+  801754:	0f b6 c0             	movzbl %al,%eax
+}
+  801757:	c9                   	leave
+  801758:	c3                   	ret
+
+0000000000801759 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  801759:	48 89 f8             	mov    %rdi,%rax
+  80175c:	48 c1 e8 27          	shr    $0x27,%rax
+  801760:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  801767:	01 00 00 
+  80176a:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80176e:	f6 c2 01             	test   $0x1,%dl
+  801771:	74 6d                	je     8017e0 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  801773:	48 89 f8             	mov    %rdi,%rax
+  801776:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80177a:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  801781:	01 00 00 
+  801784:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  801788:	f6 c2 01             	test   $0x1,%dl
+  80178b:	74 62                	je     8017ef <get_uvpt_entry+0x96>
+  80178d:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  801794:	01 00 00 
+  801797:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80179b:	f6 c2 80             	test   $0x80,%dl
+  80179e:	75 4f                	jne    8017ef <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8017a0:	48 89 f8             	mov    %rdi,%rax
+  8017a3:	48 c1 e8 15          	shr    $0x15,%rax
+  8017a7:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8017ae:	01 00 00 
+  8017b1:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8017b5:	f6 c2 01             	test   $0x1,%dl
+  8017b8:	74 44                	je     8017fe <get_uvpt_entry+0xa5>
+  8017ba:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8017c1:	01 00 00 
+  8017c4:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8017c8:	f6 c2 80             	test   $0x80,%dl
+  8017cb:	75 31                	jne    8017fe <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  8017cd:	48 c1 ef 0c          	shr    $0xc,%rdi
+  8017d1:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8017d8:	01 00 00 
+  8017db:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  8017df:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8017e0:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  8017e7:	01 00 00 
+  8017ea:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8017ee:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8017ef:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8017f6:	01 00 00 
+  8017f9:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8017fd:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8017fe:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  801805:	01 00 00 
+  801808:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80180c:	c3                   	ret
+
+000000000080180d <get_prot>:
+
+int
+get_prot(void *va) {
+  80180d:	55                   	push   %rbp
+  80180e:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  801811:	48 b8 59 17 80 00 00 	movabs $0x801759,%rax
+  801818:	00 00 00 
+  80181b:	ff d0                	call   *%rax
+  80181d:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  801820:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  801825:	89 c1                	mov    %eax,%ecx
+  801827:	83 c9 04             	or     $0x4,%ecx
+  80182a:	f6 c2 01             	test   $0x1,%dl
+  80182d:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  801830:	89 c1                	mov    %eax,%ecx
+  801832:	83 c9 02             	or     $0x2,%ecx
+  801835:	f6 c2 02             	test   $0x2,%dl
+  801838:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  80183b:	89 c1                	mov    %eax,%ecx
+  80183d:	83 c9 01             	or     $0x1,%ecx
+  801840:	48 85 d2             	test   %rdx,%rdx
+  801843:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  801846:	89 c1                	mov    %eax,%ecx
+  801848:	83 c9 40             	or     $0x40,%ecx
+  80184b:	f6 c6 04             	test   $0x4,%dh
+  80184e:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  801851:	5d                   	pop    %rbp
+  801852:	c3                   	ret
+
+0000000000801853 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  801853:	55                   	push   %rbp
+  801854:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  801857:	48 b8 59 17 80 00 00 	movabs $0x801759,%rax
+  80185e:	00 00 00 
+  801861:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  801863:	48 c1 e8 06          	shr    $0x6,%rax
+  801867:	83 e0 01             	and    $0x1,%eax
+}
+  80186a:	5d                   	pop    %rbp
+  80186b:	c3                   	ret
+
+000000000080186c <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  80186c:	55                   	push   %rbp
+  80186d:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  801870:	48 b8 59 17 80 00 00 	movabs $0x801759,%rax
+  801877:	00 00 00 
+  80187a:	ff d0                	call   *%rax
+  80187c:	83 e0 01             	and    $0x1,%eax
+}
+  80187f:	5d                   	pop    %rbp
+  801880:	c3                   	ret
+
+0000000000801881 <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  801881:	55                   	push   %rbp
+  801882:	48 89 e5             	mov    %rsp,%rbp
+  801885:	41 57                	push   %r15
+  801887:	41 56                	push   %r14
+  801889:	41 55                	push   %r13
+  80188b:	41 54                	push   %r12
+  80188d:	53                   	push   %rbx
+  80188e:	48 83 ec 38          	sub    $0x38,%rsp
+  801892:	49 89 f7             	mov    %rsi,%r15
+  801895:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+                    }
+                    continue;
+                }
+                for (int ptei = 0; ptei < PT_ENTRY_COUNT; ptei++) {
+                    uintptr_t pte_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, pdei, ptei, 0);
+                    pte_t pte = uvpt[VPT(pte_addr)];
+  80189b:	49 bd 00 00 00 00 00 	movabs $0x10000000000,%r13
+  8018a2:	01 00 00 
+  8018a5:	4d 89 e6             	mov    %r12,%r14
+  8018a8:	49 89 fc             	mov    %rdi,%r12
+  8018ab:	e9 19 01 00 00       	jmp    8019c9 <foreach_shared_region+0x148>
+  8018b0:	48 89 5d b0          	mov    %rbx,-0x50(%rbp)
+  8018b4:	4c 89 75 a8          	mov    %r14,-0x58(%rbp)
+  8018b8:	eb 52                	jmp    80190c <foreach_shared_region+0x8b>
+                for (int ptei = 0; ptei < PT_ENTRY_COUNT; ptei++) {
+  8018ba:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8018c1:	48 81 fb 00 00 20 00 	cmp    $0x200000,%rbx
+  8018c8:	74 2e                	je     8018f8 <foreach_shared_region+0x77>
+                    uintptr_t pte_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, pdei, ptei, 0);
+  8018ca:	48 89 df             	mov    %rbx,%rdi
+  8018cd:	4c 09 f7             	or     %r14,%rdi
+                    pte_t pte = uvpt[VPT(pte_addr)];
+  8018d0:	48 89 f8             	mov    %rdi,%rax
+  8018d3:	48 c1 e8 0c          	shr    $0xc,%rax
+  8018d7:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+                    if ((pte & PTE_P) && (pte & PTE_SHARE)) {
+  8018dc:	25 01 04 00 00       	and    $0x401,%eax
+  8018e1:	48 3d 01 04 00 00    	cmp    $0x401,%rax
+  8018e7:	75 d1                	jne    8018ba <foreach_shared_region+0x39>
+                        fun((void*)pte_addr, (void*)(pte_addr + PAGE_SIZE), arg);
+  8018e9:	48 8d b7 00 10 00 00 	lea    0x1000(%rdi),%rsi
+  8018f0:	4c 89 fa             	mov    %r15,%rdx
+  8018f3:	41 ff d4             	call   *%r12
+  8018f6:	eb c2                	jmp    8018ba <foreach_shared_region+0x39>
+            for (int pdei = 0; pdei < PD_ENTRY_COUNT; pdei++) {
+  8018f8:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  8018ff:	00 
+  801900:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801904:	48 3d 00 00 00 40    	cmp    $0x40000000,%rax
+  80190a:	74 46                	je     801952 <foreach_shared_region+0xd1>
+                uintptr_t pde_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, pdei, 0, 0);
+  80190c:	4c 8b 75 c8          	mov    -0x38(%rbp),%r14
+  801910:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  801914:	49 09 c6             	or     %rax,%r14
+                pde_t pde = uvpd[VPD(pde_addr)];
+  801917:	4c 89 f0             	mov    %r14,%rax
+  80191a:	48 c1 e8 15          	shr    $0x15,%rax
+  80191e:	48 b9 00 00 00 80 00 	movabs $0x10080000000,%rcx
+  801925:	01 00 00 
+  801928:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+                if (!(pde & PTE_P)) {
+  80192c:	a8 01                	test   $0x1,%al
+  80192e:	74 c8                	je     8018f8 <foreach_shared_region+0x77>
+                if (pde & PTE_PS) {
+  801930:	48 89 c3             	mov    %rax,%rbx
+  801933:	81 e3 80 00 00 00    	and    $0x80,%ebx
+  801939:	74 8f                	je     8018ca <foreach_shared_region+0x49>
+                    if (pde & PTE_SHARE) {
+  80193b:	f6 c4 04             	test   $0x4,%ah
+  80193e:	74 b8                	je     8018f8 <foreach_shared_region+0x77>
+                        fun((void*)pde_addr, (void*)(pde_addr + 1024 * 1024 * 2), arg);
+  801940:	49 8d b6 00 00 20 00 	lea    0x200000(%r14),%rsi
+  801947:	4c 89 fa             	mov    %r15,%rdx
+  80194a:	4c 89 f7             	mov    %r14,%rdi
+  80194d:	41 ff d4             	call   *%r12
+  801950:	eb a6                	jmp    8018f8 <foreach_shared_region+0x77>
+  801952:	48 8b 5d b0          	mov    -0x50(%rbp),%rbx
+  801956:	4c 8b 75 a8          	mov    -0x58(%rbp),%r14
+        for (int pdpei = 0; pdpei < PDP_ENTRY_COUNT; pdpei++) {
+  80195a:	48 81 c3 00 00 00 40 	add    $0x40000000,%rbx
+  801961:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  801968:	00 00 00 
+  80196b:	48 39 c3             	cmp    %rax,%rbx
+  80196e:	74 4c                	je     8019bc <foreach_shared_region+0x13b>
+            uintptr_t pdpe_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, 0, 0, 0);
+  801970:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  801974:	48 09 d8             	or     %rbx,%rax
+  801977:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+            pdpe_t pdpe = uvpdp[VPDP(pdpe_addr)];
+  80197b:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80197f:	48 b9 00 00 40 80 00 	movabs $0x10080400000,%rcx
+  801986:	01 00 00 
+  801989:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+            if (!(pdpe & PTE_P)) {
+  80198d:	a8 01                	test   $0x1,%al
+  80198f:	74 c9                	je     80195a <foreach_shared_region+0xd9>
+            if (pdpe & PTE_PS) {
+  801991:	48 89 c1             	mov    %rax,%rcx
+  801994:	81 e1 80 00 00 00    	and    $0x80,%ecx
+  80199a:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  80199e:	0f 84 0c ff ff ff    	je     8018b0 <foreach_shared_region+0x2f>
+                if (pdpe & PTE_SHARE) {
+  8019a4:	f6 c4 04             	test   $0x4,%ah
+  8019a7:	74 b1                	je     80195a <foreach_shared_region+0xd9>
+                    fun((void*)pdpe_addr, (void*)(pdpe_addr + 1024 * 1024 * 1024), arg); 
+  8019a9:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  8019ad:	48 8d b7 00 00 00 40 	lea    0x40000000(%rdi),%rsi
+  8019b4:	4c 89 fa             	mov    %r15,%rdx
+  8019b7:	41 ff d4             	call   *%r12
+  8019ba:	eb 9e                	jmp    80195a <foreach_shared_region+0xd9>
+    for (int pml4ei = 0; pml4ei < PML4_ENTRY_COUNT; pml4ei++) {
+  8019bc:	49 83 c6 01          	add    $0x1,%r14
+  8019c0:	49 81 fe 00 02 00 00 	cmp    $0x200,%r14
+  8019c7:	74 24                	je     8019ed <foreach_shared_region+0x16c>
+        pml4e_t pml4e = uvpml4[VPML4(pml4_addr)];
+  8019c9:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  8019d0:	01 00 00 
+  8019d3:	4a 8b 04 f0          	mov    (%rax,%r14,8),%rax
+        if (!(pml4e & PTE_P)) {
+  8019d7:	a8 01                	test   $0x1,%al
+  8019d9:	74 e1                	je     8019bc <foreach_shared_region+0x13b>
+  8019db:	4c 89 f0             	mov    %r14,%rax
+  8019de:	48 c1 e0 27          	shl    $0x27,%rax
+  8019e2:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8019e6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8019eb:	eb 83                	jmp    801970 <foreach_shared_region+0xef>
+            }
+        }
+    }
+    
+    return 0;
+}
+  8019ed:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019f2:	48 83 c4 38          	add    $0x38,%rsp
+  8019f6:	5b                   	pop    %rbx
+  8019f7:	41 5c                	pop    %r12
+  8019f9:	41 5d                	pop    %r13
+  8019fb:	41 5e                	pop    %r14
+  8019fd:	41 5f                	pop    %r15
+  8019ff:	5d                   	pop    %rbp
+  801a00:	c3                   	ret
+
+0000000000801a01 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  801a01:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a06:	c3                   	ret
+
+0000000000801a07 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  801a07:	55                   	push   %rbp
+  801a08:	48 89 e5             	mov    %rsp,%rbp
+  801a0b:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  801a0e:	48 be d4 2d 80 00 00 	movabs $0x802dd4,%rsi
+  801a15:	00 00 00 
+  801a18:	48 b8 a1 26 80 00 00 	movabs $0x8026a1,%rax
+  801a1f:	00 00 00 
+  801a22:	ff d0                	call   *%rax
+    return 0;
+}
+  801a24:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a29:	5d                   	pop    %rbp
+  801a2a:	c3                   	ret
+
+0000000000801a2b <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  801a2b:	55                   	push   %rbp
+  801a2c:	48 89 e5             	mov    %rsp,%rbp
+  801a2f:	41 57                	push   %r15
+  801a31:	41 56                	push   %r14
+  801a33:	41 55                	push   %r13
+  801a35:	41 54                	push   %r12
+  801a37:	53                   	push   %rbx
+  801a38:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  801a3f:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  801a46:	48 85 d2             	test   %rdx,%rdx
+  801a49:	74 7a                	je     801ac5 <devcons_write+0x9a>
+  801a4b:	49 89 d6             	mov    %rdx,%r14
+  801a4e:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  801a54:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  801a59:	49 bf 9b 28 80 00 00 	movabs $0x80289b,%r15
+  801a60:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  801a63:	4c 89 f3             	mov    %r14,%rbx
+  801a66:	48 29 f3             	sub    %rsi,%rbx
+  801a69:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  801a6e:	48 39 c3             	cmp    %rax,%rbx
+  801a71:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  801a75:	4c 63 eb             	movslq %ebx,%r13
+  801a78:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  801a7f:	48 01 c6             	add    %rax,%rsi
+  801a82:	4c 89 ea             	mov    %r13,%rdx
+  801a85:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  801a8c:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  801a8f:	4c 89 ee             	mov    %r13,%rsi
+  801a92:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  801a99:	48 b8 12 01 80 00 00 	movabs $0x800112,%rax
+  801aa0:	00 00 00 
+  801aa3:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  801aa5:	41 01 dc             	add    %ebx,%r12d
+  801aa8:	49 63 f4             	movslq %r12d,%rsi
+  801aab:	4c 39 f6             	cmp    %r14,%rsi
+  801aae:	72 b3                	jb     801a63 <devcons_write+0x38>
+    return res;
+  801ab0:	49 63 c4             	movslq %r12d,%rax
+}
+  801ab3:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  801aba:	5b                   	pop    %rbx
+  801abb:	41 5c                	pop    %r12
+  801abd:	41 5d                	pop    %r13
+  801abf:	41 5e                	pop    %r14
+  801ac1:	41 5f                	pop    %r15
+  801ac3:	5d                   	pop    %rbp
+  801ac4:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  801ac5:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  801acb:	eb e3                	jmp    801ab0 <devcons_write+0x85>
+
+0000000000801acd <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  801acd:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  801ad0:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ad5:	48 85 c0             	test   %rax,%rax
+  801ad8:	74 55                	je     801b2f <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  801ada:	55                   	push   %rbp
+  801adb:	48 89 e5             	mov    %rsp,%rbp
+  801ade:	41 55                	push   %r13
+  801ae0:	41 54                	push   %r12
+  801ae2:	53                   	push   %rbx
+  801ae3:	48 83 ec 08          	sub    $0x8,%rsp
+  801ae7:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  801aea:	48 bb 3f 01 80 00 00 	movabs $0x80013f,%rbx
+  801af1:	00 00 00 
+  801af4:	49 bc 0c 02 80 00 00 	movabs $0x80020c,%r12
+  801afb:	00 00 00 
+  801afe:	eb 03                	jmp    801b03 <devcons_read+0x36>
+  801b00:	41 ff d4             	call   *%r12
+  801b03:	ff d3                	call   *%rbx
+  801b05:	85 c0                	test   %eax,%eax
+  801b07:	74 f7                	je     801b00 <devcons_read+0x33>
+    if (c < 0) return c;
+  801b09:	48 63 d0             	movslq %eax,%rdx
+  801b0c:	78 13                	js     801b21 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  801b0e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b13:	83 f8 04             	cmp    $0x4,%eax
+  801b16:	74 09                	je     801b21 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  801b18:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  801b1c:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  801b21:	48 89 d0             	mov    %rdx,%rax
+  801b24:	48 83 c4 08          	add    $0x8,%rsp
+  801b28:	5b                   	pop    %rbx
+  801b29:	41 5c                	pop    %r12
+  801b2b:	41 5d                	pop    %r13
+  801b2d:	5d                   	pop    %rbp
+  801b2e:	c3                   	ret
+  801b2f:	48 89 d0             	mov    %rdx,%rax
+  801b32:	c3                   	ret
+
+0000000000801b33 <cputchar>:
+cputchar(int ch) {
+  801b33:	55                   	push   %rbp
+  801b34:	48 89 e5             	mov    %rsp,%rbp
+  801b37:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  801b3b:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  801b3f:	be 01 00 00 00       	mov    $0x1,%esi
+  801b44:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  801b48:	48 b8 12 01 80 00 00 	movabs $0x800112,%rax
+  801b4f:	00 00 00 
+  801b52:	ff d0                	call   *%rax
+}
+  801b54:	c9                   	leave
+  801b55:	c3                   	ret
+
+0000000000801b56 <getchar>:
+getchar(void) {
+  801b56:	55                   	push   %rbp
+  801b57:	48 89 e5             	mov    %rsp,%rbp
+  801b5a:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  801b5e:	ba 01 00 00 00       	mov    $0x1,%edx
+  801b63:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  801b67:	bf 00 00 00 00       	mov    $0x0,%edi
+  801b6c:	48 b8 7a 0a 80 00 00 	movabs $0x800a7a,%rax
+  801b73:	00 00 00 
+  801b76:	ff d0                	call   *%rax
+  801b78:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  801b7a:	85 c0                	test   %eax,%eax
+  801b7c:	78 06                	js     801b84 <getchar+0x2e>
+  801b7e:	74 08                	je     801b88 <getchar+0x32>
+  801b80:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  801b84:	89 d0                	mov    %edx,%eax
+  801b86:	c9                   	leave
+  801b87:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  801b88:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  801b8d:	eb f5                	jmp    801b84 <getchar+0x2e>
+
+0000000000801b8f <iscons>:
+iscons(int fdnum) {
+  801b8f:	55                   	push   %rbp
+  801b90:	48 89 e5             	mov    %rsp,%rbp
+  801b93:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  801b97:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801b9b:	48 b8 97 07 80 00 00 	movabs $0x800797,%rax
+  801ba2:	00 00 00 
+  801ba5:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801ba7:	85 c0                	test   %eax,%eax
+  801ba9:	78 18                	js     801bc3 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  801bab:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801baf:	48 b8 a0 40 80 00 00 	movabs $0x8040a0,%rax
+  801bb6:	00 00 00 
+  801bb9:	8b 00                	mov    (%rax),%eax
+  801bbb:	39 02                	cmp    %eax,(%rdx)
+  801bbd:	0f 94 c0             	sete   %al
+  801bc0:	0f b6 c0             	movzbl %al,%eax
+}
+  801bc3:	c9                   	leave
+  801bc4:	c3                   	ret
+
+0000000000801bc5 <opencons>:
+opencons(void) {
+  801bc5:	55                   	push   %rbp
+  801bc6:	48 89 e5             	mov    %rsp,%rbp
+  801bc9:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  801bcd:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  801bd1:	48 b8 7d 07 80 00 00 	movabs $0x80077d,%rax
+  801bd8:	00 00 00 
+  801bdb:	ff d0                	call   *%rax
+  801bdd:	85 c0                	test   %eax,%eax
+  801bdf:	78 49                	js     801c2a <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  801be1:	b9 46 00 00 00       	mov    $0x46,%ecx
+  801be6:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801beb:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  801bef:	bf 00 00 00 00       	mov    $0x0,%edi
+  801bf4:	48 b8 9b 02 80 00 00 	movabs $0x80029b,%rax
+  801bfb:	00 00 00 
+  801bfe:	ff d0                	call   *%rax
+  801c00:	85 c0                	test   %eax,%eax
+  801c02:	78 26                	js     801c2a <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  801c04:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801c08:	a1 a0 40 80 00 00 00 	movabs 0x8040a0,%eax
+  801c0f:	00 00 
+  801c11:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  801c13:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801c17:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  801c1e:	48 b8 d6 06 80 00 00 	movabs $0x8006d6,%rax
+  801c25:	00 00 00 
+  801c28:	ff d0                	call   *%rax
+}
+  801c2a:	c9                   	leave
+  801c2b:	c3                   	ret
+
+0000000000801c2c <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  801c2c:	55                   	push   %rbp
+  801c2d:	48 89 e5             	mov    %rsp,%rbp
+  801c30:	41 56                	push   %r14
+  801c32:	41 55                	push   %r13
+  801c34:	41 54                	push   %r12
+  801c36:	53                   	push   %rbx
+  801c37:	48 83 ec 50          	sub    $0x50,%rsp
+  801c3b:	49 89 fc             	mov    %rdi,%r12
+  801c3e:	41 89 f5             	mov    %esi,%r13d
+  801c41:	48 89 d3             	mov    %rdx,%rbx
+  801c44:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  801c48:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  801c4c:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  801c50:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  801c57:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801c5b:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  801c5f:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  801c63:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  801c67:	48 b8 00 40 80 00 00 	movabs $0x804000,%rax
+  801c6e:	00 00 00 
+  801c71:	4c 8b 30             	mov    (%rax),%r14
+  801c74:	48 b8 db 01 80 00 00 	movabs $0x8001db,%rax
+  801c7b:	00 00 00 
+  801c7e:	ff d0                	call   *%rax
+  801c80:	89 c6                	mov    %eax,%esi
+  801c82:	45 89 e8             	mov    %r13d,%r8d
+  801c85:	4c 89 e1             	mov    %r12,%rcx
+  801c88:	4c 89 f2             	mov    %r14,%rdx
+  801c8b:	48 bf e0 2d 80 00 00 	movabs $0x802de0,%rdi
+  801c92:	00 00 00 
+  801c95:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c9a:	49 bc 7c 1d 80 00 00 	movabs $0x801d7c,%r12
+  801ca1:	00 00 00 
+  801ca4:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  801ca7:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  801cab:	48 89 df             	mov    %rbx,%rdi
+  801cae:	48 b8 18 1d 80 00 00 	movabs $0x801d18,%rax
+  801cb5:	00 00 00 
+  801cb8:	ff d0                	call   *%rax
+    cprintf("\n");
+  801cba:	48 bf 2b 2d 80 00 00 	movabs $0x802d2b,%rdi
+  801cc1:	00 00 00 
+  801cc4:	b8 00 00 00 00       	mov    $0x0,%eax
+  801cc9:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  801ccc:	cc                   	int3
+  801ccd:	eb fd                	jmp    801ccc <_panic+0xa0>
+
+0000000000801ccf <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  801ccf:	55                   	push   %rbp
+  801cd0:	48 89 e5             	mov    %rsp,%rbp
+  801cd3:	53                   	push   %rbx
+  801cd4:	48 83 ec 08          	sub    $0x8,%rsp
+  801cd8:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  801cdb:	8b 06                	mov    (%rsi),%eax
+  801cdd:	8d 50 01             	lea    0x1(%rax),%edx
+  801ce0:	89 16                	mov    %edx,(%rsi)
+  801ce2:	48 98                	cltq
+  801ce4:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  801ce9:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  801cef:	74 0a                	je     801cfb <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  801cf1:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  801cf5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801cf9:	c9                   	leave
+  801cfa:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  801cfb:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  801cff:	be ff 00 00 00       	mov    $0xff,%esi
+  801d04:	48 b8 12 01 80 00 00 	movabs $0x800112,%rax
+  801d0b:	00 00 00 
+  801d0e:	ff d0                	call   *%rax
+        state->offset = 0;
+  801d10:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  801d16:	eb d9                	jmp    801cf1 <putch+0x22>
+
+0000000000801d18 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  801d18:	55                   	push   %rbp
+  801d19:	48 89 e5             	mov    %rsp,%rbp
+  801d1c:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  801d23:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  801d26:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  801d2d:	b9 21 00 00 00       	mov    $0x21,%ecx
+  801d32:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d37:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  801d3a:	48 89 f1             	mov    %rsi,%rcx
+  801d3d:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  801d44:	48 bf cf 1c 80 00 00 	movabs $0x801ccf,%rdi
+  801d4b:	00 00 00 
+  801d4e:	48 b8 cc 1e 80 00 00 	movabs $0x801ecc,%rax
+  801d55:	00 00 00 
+  801d58:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  801d5a:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  801d61:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  801d68:	48 b8 12 01 80 00 00 	movabs $0x800112,%rax
+  801d6f:	00 00 00 
+  801d72:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  801d74:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  801d7a:	c9                   	leave
+  801d7b:	c3                   	ret
+
+0000000000801d7c <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  801d7c:	55                   	push   %rbp
+  801d7d:	48 89 e5             	mov    %rsp,%rbp
+  801d80:	48 83 ec 50          	sub    $0x50,%rsp
+  801d84:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  801d88:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  801d8c:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801d90:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  801d94:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  801d98:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  801d9f:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801da3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801da7:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  801dab:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  801daf:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  801db3:	48 b8 18 1d 80 00 00 	movabs $0x801d18,%rax
+  801dba:	00 00 00 
+  801dbd:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  801dbf:	c9                   	leave
+  801dc0:	c3                   	ret
+
+0000000000801dc1 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  801dc1:	55                   	push   %rbp
+  801dc2:	48 89 e5             	mov    %rsp,%rbp
+  801dc5:	41 57                	push   %r15
+  801dc7:	41 56                	push   %r14
+  801dc9:	41 55                	push   %r13
+  801dcb:	41 54                	push   %r12
+  801dcd:	53                   	push   %rbx
+  801dce:	48 83 ec 18          	sub    $0x18,%rsp
+  801dd2:	49 89 fc             	mov    %rdi,%r12
+  801dd5:	49 89 f5             	mov    %rsi,%r13
+  801dd8:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801ddc:	8b 45 10             	mov    0x10(%rbp),%eax
+  801ddf:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  801de2:	41 89 cf             	mov    %ecx,%r15d
+  801de5:	4c 39 fa             	cmp    %r15,%rdx
+  801de8:	73 5b                	jae    801e45 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  801dea:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  801dee:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  801df2:	85 db                	test   %ebx,%ebx
+  801df4:	7e 0e                	jle    801e04 <print_num+0x43>
+            putch(padc, put_arg);
+  801df6:	4c 89 ee             	mov    %r13,%rsi
+  801df9:	44 89 f7             	mov    %r14d,%edi
+  801dfc:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  801dff:	83 eb 01             	sub    $0x1,%ebx
+  801e02:	75 f2                	jne    801df6 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  801e04:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  801e08:	48 b9 14 2e 80 00 00 	movabs $0x802e14,%rcx
+  801e0f:	00 00 00 
+  801e12:	48 b8 03 2e 80 00 00 	movabs $0x802e03,%rax
+  801e19:	00 00 00 
+  801e1c:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  801e20:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801e24:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e29:	49 f7 f7             	div    %r15
+  801e2c:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  801e30:	4c 89 ee             	mov    %r13,%rsi
+  801e33:	41 ff d4             	call   *%r12
+}
+  801e36:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  801e3a:	5b                   	pop    %rbx
+  801e3b:	41 5c                	pop    %r12
+  801e3d:	41 5d                	pop    %r13
+  801e3f:	41 5e                	pop    %r14
+  801e41:	41 5f                	pop    %r15
+  801e43:	5d                   	pop    %rbp
+  801e44:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  801e45:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801e49:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e4e:	49 f7 f7             	div    %r15
+  801e51:	48 83 ec 08          	sub    $0x8,%rsp
+  801e55:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  801e59:	52                   	push   %rdx
+  801e5a:	45 0f be c9          	movsbl %r9b,%r9d
+  801e5e:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  801e62:	48 89 c2             	mov    %rax,%rdx
+  801e65:	48 b8 c1 1d 80 00 00 	movabs $0x801dc1,%rax
+  801e6c:	00 00 00 
+  801e6f:	ff d0                	call   *%rax
+  801e71:	48 83 c4 10          	add    $0x10,%rsp
+  801e75:	eb 8d                	jmp    801e04 <print_num+0x43>
+
+0000000000801e77 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  801e77:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  801e7b:	48 8b 06             	mov    (%rsi),%rax
+  801e7e:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  801e82:	73 0a                	jae    801e8e <sprintputch+0x17>
+        *state->start++ = ch;
+  801e84:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801e88:	48 89 16             	mov    %rdx,(%rsi)
+  801e8b:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  801e8e:	c3                   	ret
+
+0000000000801e8f <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  801e8f:	55                   	push   %rbp
+  801e90:	48 89 e5             	mov    %rsp,%rbp
+  801e93:	48 83 ec 50          	sub    $0x50,%rsp
+  801e97:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801e9b:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  801e9f:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  801ea3:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  801eaa:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801eae:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801eb2:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  801eb6:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  801eba:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  801ebe:	48 b8 cc 1e 80 00 00 	movabs $0x801ecc,%rax
+  801ec5:	00 00 00 
+  801ec8:	ff d0                	call   *%rax
+}
+  801eca:	c9                   	leave
+  801ecb:	c3                   	ret
+
+0000000000801ecc <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  801ecc:	55                   	push   %rbp
+  801ecd:	48 89 e5             	mov    %rsp,%rbp
+  801ed0:	41 57                	push   %r15
+  801ed2:	41 56                	push   %r14
+  801ed4:	41 55                	push   %r13
+  801ed6:	41 54                	push   %r12
+  801ed8:	53                   	push   %rbx
+  801ed9:	48 83 ec 38          	sub    $0x38,%rsp
+  801edd:	49 89 fe             	mov    %rdi,%r14
+  801ee0:	49 89 f5             	mov    %rsi,%r13
+  801ee3:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  801ee6:	48 8b 01             	mov    (%rcx),%rax
+  801ee9:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  801eed:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  801ef1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801ef5:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  801ef9:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  801efd:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  801f01:	0f b6 3b             	movzbl (%rbx),%edi
+  801f04:	40 80 ff 25          	cmp    $0x25,%dil
+  801f08:	74 18                	je     801f22 <vprintfmt+0x56>
+            if (!ch) return;
+  801f0a:	40 84 ff             	test   %dil,%dil
+  801f0d:	0f 84 b1 06 00 00    	je     8025c4 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  801f13:	40 0f b6 ff          	movzbl %dil,%edi
+  801f17:	4c 89 ee             	mov    %r13,%rsi
+  801f1a:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  801f1d:	4c 89 e3             	mov    %r12,%rbx
+  801f20:	eb db                	jmp    801efd <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  801f22:	be 00 00 00 00       	mov    $0x0,%esi
+  801f27:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  801f2b:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  801f30:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  801f36:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  801f3d:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  801f41:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  801f46:	41 0f b6 04 24       	movzbl (%r12),%eax
+  801f4b:	88 45 a0             	mov    %al,-0x60(%rbp)
+  801f4e:	83 e8 23             	sub    $0x23,%eax
+  801f51:	3c 57                	cmp    $0x57,%al
+  801f53:	0f 87 51 06 00 00    	ja     8025aa <vprintfmt+0x6de>
+  801f59:	0f b6 c0             	movzbl %al,%eax
+  801f5c:	48 b9 c0 2f 80 00 00 	movabs $0x802fc0,%rcx
+  801f63:	00 00 00 
+  801f66:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  801f69:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  801f6c:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  801f70:	eb cf                	jmp    801f41 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  801f72:	49 89 dc             	mov    %rbx,%r12
+  801f75:	be 01 00 00 00       	mov    $0x1,%esi
+  801f7a:	eb c5                	jmp    801f41 <vprintfmt+0x75>
+            padc = ch;
+  801f7c:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  801f80:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  801f83:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801f86:	eb b9                	jmp    801f41 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  801f88:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801f8b:	83 f8 2f             	cmp    $0x2f,%eax
+  801f8e:	77 24                	ja     801fb4 <vprintfmt+0xe8>
+  801f90:	89 c1                	mov    %eax,%ecx
+  801f92:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  801f96:	83 c0 08             	add    $0x8,%eax
+  801f99:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801f9c:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  801f9f:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  801fa2:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  801fa6:	79 99                	jns    801f41 <vprintfmt+0x75>
+                width = precision;
+  801fa8:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  801fac:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  801fb2:	eb 8d                	jmp    801f41 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  801fb4:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  801fb8:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  801fbc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801fc0:	eb da                	jmp    801f9c <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  801fc2:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  801fc7:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  801fcb:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  801fd1:	3c 39                	cmp    $0x39,%al
+  801fd3:	77 1c                	ja     801ff1 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  801fd5:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  801fd9:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  801fdd:	0f b6 c0             	movzbl %al,%eax
+  801fe0:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  801fe5:	0f b6 03             	movzbl (%rbx),%eax
+  801fe8:	3c 39                	cmp    $0x39,%al
+  801fea:	76 e9                	jbe    801fd5 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  801fec:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  801fef:	eb b1                	jmp    801fa2 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  801ff1:	49 89 dc             	mov    %rbx,%r12
+  801ff4:	eb ac                	jmp    801fa2 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  801ff6:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  801ff9:	85 c9                	test   %ecx,%ecx
+  801ffb:	b8 00 00 00 00       	mov    $0x0,%eax
+  802000:	0f 49 c1             	cmovns %ecx,%eax
+  802003:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  802006:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  802009:	e9 33 ff ff ff       	jmp    801f41 <vprintfmt+0x75>
+            lflag++;
+  80200e:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  802011:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  802014:	e9 28 ff ff ff       	jmp    801f41 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  802019:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80201c:	83 f8 2f             	cmp    $0x2f,%eax
+  80201f:	77 19                	ja     80203a <vprintfmt+0x16e>
+  802021:	89 c2                	mov    %eax,%edx
+  802023:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802027:	83 c0 08             	add    $0x8,%eax
+  80202a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80202d:	8b 3a                	mov    (%rdx),%edi
+  80202f:	4c 89 ee             	mov    %r13,%rsi
+  802032:	41 ff d6             	call   *%r14
+            break;
+  802035:	e9 c3 fe ff ff       	jmp    801efd <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  80203a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80203e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802042:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802046:	eb e5                	jmp    80202d <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  802048:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80204b:	83 f8 2f             	cmp    $0x2f,%eax
+  80204e:	77 5a                	ja     8020aa <vprintfmt+0x1de>
+  802050:	89 c2                	mov    %eax,%edx
+  802052:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802056:	83 c0 08             	add    $0x8,%eax
+  802059:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  80205c:	8b 02                	mov    (%rdx),%eax
+  80205e:	89 c1                	mov    %eax,%ecx
+  802060:	f7 d9                	neg    %ecx
+  802062:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  802065:	83 f9 15             	cmp    $0x15,%ecx
+  802068:	7f 4e                	jg     8020b8 <vprintfmt+0x1ec>
+  80206a:	48 63 c1             	movslq %ecx,%rax
+  80206d:	48 ba 80 32 80 00 00 	movabs $0x803280,%rdx
+  802074:	00 00 00 
+  802077:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80207b:	48 85 c0             	test   %rax,%rax
+  80207e:	74 38                	je     8020b8 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  802080:	48 89 c1             	mov    %rax,%rcx
+  802083:	48 ba 99 2d 80 00 00 	movabs $0x802d99,%rdx
+  80208a:	00 00 00 
+  80208d:	4c 89 ee             	mov    %r13,%rsi
+  802090:	4c 89 f7             	mov    %r14,%rdi
+  802093:	b8 00 00 00 00       	mov    $0x0,%eax
+  802098:	49 b8 8f 1e 80 00 00 	movabs $0x801e8f,%r8
+  80209f:	00 00 00 
+  8020a2:	41 ff d0             	call   *%r8
+  8020a5:	e9 53 fe ff ff       	jmp    801efd <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  8020aa:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8020ae:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8020b2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8020b6:	eb a4                	jmp    80205c <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  8020b8:	48 ba 2c 2e 80 00 00 	movabs $0x802e2c,%rdx
+  8020bf:	00 00 00 
+  8020c2:	4c 89 ee             	mov    %r13,%rsi
+  8020c5:	4c 89 f7             	mov    %r14,%rdi
+  8020c8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020cd:	49 b8 8f 1e 80 00 00 	movabs $0x801e8f,%r8
+  8020d4:	00 00 00 
+  8020d7:	41 ff d0             	call   *%r8
+  8020da:	e9 1e fe ff ff       	jmp    801efd <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8020df:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8020e2:	83 f8 2f             	cmp    $0x2f,%eax
+  8020e5:	77 6c                	ja     802153 <vprintfmt+0x287>
+  8020e7:	89 c2                	mov    %eax,%edx
+  8020e9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8020ed:	83 c0 08             	add    $0x8,%eax
+  8020f0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8020f3:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  8020f6:	48 85 d2             	test   %rdx,%rdx
+  8020f9:	48 b8 25 2e 80 00 00 	movabs $0x802e25,%rax
+  802100:	00 00 00 
+  802103:	48 0f 45 c2          	cmovne %rdx,%rax
+  802107:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  80210b:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  80210f:	7e 06                	jle    802117 <vprintfmt+0x24b>
+  802111:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  802115:	75 4a                	jne    802161 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  802117:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  80211b:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  80211f:	0f b6 00             	movzbl (%rax),%eax
+  802122:	84 c0                	test   %al,%al
+  802124:	0f 85 9a 00 00 00    	jne    8021c4 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  80212a:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80212d:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  802131:	85 c0                	test   %eax,%eax
+  802133:	0f 8e c4 fd ff ff    	jle    801efd <vprintfmt+0x31>
+  802139:	4c 89 ee             	mov    %r13,%rsi
+  80213c:	bf 20 00 00 00       	mov    $0x20,%edi
+  802141:	41 ff d6             	call   *%r14
+  802144:	41 83 ec 01          	sub    $0x1,%r12d
+  802148:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  80214c:	75 eb                	jne    802139 <vprintfmt+0x26d>
+  80214e:	e9 aa fd ff ff       	jmp    801efd <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  802153:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802157:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80215b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80215f:	eb 92                	jmp    8020f3 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  802161:	49 63 f7             	movslq %r15d,%rsi
+  802164:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  802168:	48 b8 7e 26 80 00 00 	movabs $0x80267e,%rax
+  80216f:	00 00 00 
+  802172:	ff d0                	call   *%rax
+  802174:	48 89 c2             	mov    %rax,%rdx
+  802177:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80217a:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  80217c:	8d 70 ff             	lea    -0x1(%rax),%esi
+  80217f:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  802182:	85 c0                	test   %eax,%eax
+  802184:	7e 91                	jle    802117 <vprintfmt+0x24b>
+  802186:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  80218b:	4c 89 ee             	mov    %r13,%rsi
+  80218e:	44 89 e7             	mov    %r12d,%edi
+  802191:	41 ff d6             	call   *%r14
+  802194:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  802198:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80219b:	83 f8 ff             	cmp    $0xffffffff,%eax
+  80219e:	75 eb                	jne    80218b <vprintfmt+0x2bf>
+  8021a0:	e9 72 ff ff ff       	jmp    802117 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8021a5:	0f b6 f8             	movzbl %al,%edi
+  8021a8:	4c 89 ee             	mov    %r13,%rsi
+  8021ab:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8021ae:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8021b2:	49 83 c4 01          	add    $0x1,%r12
+  8021b6:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  8021bc:	84 c0                	test   %al,%al
+  8021be:	0f 84 66 ff ff ff    	je     80212a <vprintfmt+0x25e>
+  8021c4:	45 85 ff             	test   %r15d,%r15d
+  8021c7:	78 0a                	js     8021d3 <vprintfmt+0x307>
+  8021c9:	41 83 ef 01          	sub    $0x1,%r15d
+  8021cd:	0f 88 57 ff ff ff    	js     80212a <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8021d3:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  8021d7:	74 cc                	je     8021a5 <vprintfmt+0x2d9>
+  8021d9:	8d 50 e0             	lea    -0x20(%rax),%edx
+  8021dc:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  8021e1:	80 fa 5e             	cmp    $0x5e,%dl
+  8021e4:	77 c2                	ja     8021a8 <vprintfmt+0x2dc>
+  8021e6:	eb bd                	jmp    8021a5 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  8021e8:	40 84 f6             	test   %sil,%sil
+  8021eb:	75 26                	jne    802213 <vprintfmt+0x347>
+    switch (lflag) {
+  8021ed:	85 d2                	test   %edx,%edx
+  8021ef:	74 59                	je     80224a <vprintfmt+0x37e>
+  8021f1:	83 fa 01             	cmp    $0x1,%edx
+  8021f4:	74 7b                	je     802271 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  8021f6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8021f9:	83 f8 2f             	cmp    $0x2f,%eax
+  8021fc:	0f 87 96 00 00 00    	ja     802298 <vprintfmt+0x3cc>
+  802202:	89 c2                	mov    %eax,%edx
+  802204:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802208:	83 c0 08             	add    $0x8,%eax
+  80220b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80220e:	4c 8b 22             	mov    (%rdx),%r12
+  802211:	eb 17                	jmp    80222a <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  802213:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802216:	83 f8 2f             	cmp    $0x2f,%eax
+  802219:	77 21                	ja     80223c <vprintfmt+0x370>
+  80221b:	89 c2                	mov    %eax,%edx
+  80221d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802221:	83 c0 08             	add    $0x8,%eax
+  802224:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802227:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  80222a:	4d 85 e4             	test   %r12,%r12
+  80222d:	78 7a                	js     8022a9 <vprintfmt+0x3dd>
+            num = i;
+  80222f:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  802232:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  802237:	e9 50 02 00 00       	jmp    80248c <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  80223c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802240:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802244:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802248:	eb dd                	jmp    802227 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  80224a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80224d:	83 f8 2f             	cmp    $0x2f,%eax
+  802250:	77 11                	ja     802263 <vprintfmt+0x397>
+  802252:	89 c2                	mov    %eax,%edx
+  802254:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802258:	83 c0 08             	add    $0x8,%eax
+  80225b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80225e:	4c 63 22             	movslq (%rdx),%r12
+  802261:	eb c7                	jmp    80222a <vprintfmt+0x35e>
+  802263:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802267:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80226b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80226f:	eb ed                	jmp    80225e <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  802271:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802274:	83 f8 2f             	cmp    $0x2f,%eax
+  802277:	77 11                	ja     80228a <vprintfmt+0x3be>
+  802279:	89 c2                	mov    %eax,%edx
+  80227b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80227f:	83 c0 08             	add    $0x8,%eax
+  802282:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802285:	4c 8b 22             	mov    (%rdx),%r12
+  802288:	eb a0                	jmp    80222a <vprintfmt+0x35e>
+  80228a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80228e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802292:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802296:	eb ed                	jmp    802285 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  802298:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80229c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8022a0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8022a4:	e9 65 ff ff ff       	jmp    80220e <vprintfmt+0x342>
+                putch('-', put_arg);
+  8022a9:	4c 89 ee             	mov    %r13,%rsi
+  8022ac:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  8022b1:	41 ff d6             	call   *%r14
+                i = -i;
+  8022b4:	49 f7 dc             	neg    %r12
+  8022b7:	e9 73 ff ff ff       	jmp    80222f <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  8022bc:	40 84 f6             	test   %sil,%sil
+  8022bf:	75 32                	jne    8022f3 <vprintfmt+0x427>
+    switch (lflag) {
+  8022c1:	85 d2                	test   %edx,%edx
+  8022c3:	74 5d                	je     802322 <vprintfmt+0x456>
+  8022c5:	83 fa 01             	cmp    $0x1,%edx
+  8022c8:	0f 84 82 00 00 00    	je     802350 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  8022ce:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8022d1:	83 f8 2f             	cmp    $0x2f,%eax
+  8022d4:	0f 87 a5 00 00 00    	ja     80237f <vprintfmt+0x4b3>
+  8022da:	89 c2                	mov    %eax,%edx
+  8022dc:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8022e0:	83 c0 08             	add    $0x8,%eax
+  8022e3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8022e6:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8022e9:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  8022ee:	e9 99 01 00 00       	jmp    80248c <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8022f3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8022f6:	83 f8 2f             	cmp    $0x2f,%eax
+  8022f9:	77 19                	ja     802314 <vprintfmt+0x448>
+  8022fb:	89 c2                	mov    %eax,%edx
+  8022fd:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802301:	83 c0 08             	add    $0x8,%eax
+  802304:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802307:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  80230a:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  80230f:	e9 78 01 00 00       	jmp    80248c <vprintfmt+0x5c0>
+  802314:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802318:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80231c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802320:	eb e5                	jmp    802307 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  802322:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802325:	83 f8 2f             	cmp    $0x2f,%eax
+  802328:	77 18                	ja     802342 <vprintfmt+0x476>
+  80232a:	89 c2                	mov    %eax,%edx
+  80232c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802330:	83 c0 08             	add    $0x8,%eax
+  802333:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802336:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  802338:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  80233d:	e9 4a 01 00 00       	jmp    80248c <vprintfmt+0x5c0>
+  802342:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802346:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80234a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80234e:	eb e6                	jmp    802336 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  802350:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802353:	83 f8 2f             	cmp    $0x2f,%eax
+  802356:	77 19                	ja     802371 <vprintfmt+0x4a5>
+  802358:	89 c2                	mov    %eax,%edx
+  80235a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80235e:	83 c0 08             	add    $0x8,%eax
+  802361:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802364:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  802367:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  80236c:	e9 1b 01 00 00       	jmp    80248c <vprintfmt+0x5c0>
+  802371:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802375:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802379:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80237d:	eb e5                	jmp    802364 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  80237f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802383:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802387:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80238b:	e9 56 ff ff ff       	jmp    8022e6 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  802390:	40 84 f6             	test   %sil,%sil
+  802393:	75 2e                	jne    8023c3 <vprintfmt+0x4f7>
+    switch (lflag) {
+  802395:	85 d2                	test   %edx,%edx
+  802397:	74 59                	je     8023f2 <vprintfmt+0x526>
+  802399:	83 fa 01             	cmp    $0x1,%edx
+  80239c:	74 7f                	je     80241d <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  80239e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8023a1:	83 f8 2f             	cmp    $0x2f,%eax
+  8023a4:	0f 87 9f 00 00 00    	ja     802449 <vprintfmt+0x57d>
+  8023aa:	89 c2                	mov    %eax,%edx
+  8023ac:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8023b0:	83 c0 08             	add    $0x8,%eax
+  8023b3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8023b6:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8023b9:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  8023be:	e9 c9 00 00 00       	jmp    80248c <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8023c3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8023c6:	83 f8 2f             	cmp    $0x2f,%eax
+  8023c9:	77 19                	ja     8023e4 <vprintfmt+0x518>
+  8023cb:	89 c2                	mov    %eax,%edx
+  8023cd:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8023d1:	83 c0 08             	add    $0x8,%eax
+  8023d4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8023d7:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8023da:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8023df:	e9 a8 00 00 00       	jmp    80248c <vprintfmt+0x5c0>
+  8023e4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8023e8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8023ec:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8023f0:	eb e5                	jmp    8023d7 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  8023f2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8023f5:	83 f8 2f             	cmp    $0x2f,%eax
+  8023f8:	77 15                	ja     80240f <vprintfmt+0x543>
+  8023fa:	89 c2                	mov    %eax,%edx
+  8023fc:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802400:	83 c0 08             	add    $0x8,%eax
+  802403:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802406:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  802408:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  80240d:	eb 7d                	jmp    80248c <vprintfmt+0x5c0>
+  80240f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802413:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802417:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80241b:	eb e9                	jmp    802406 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  80241d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802420:	83 f8 2f             	cmp    $0x2f,%eax
+  802423:	77 16                	ja     80243b <vprintfmt+0x56f>
+  802425:	89 c2                	mov    %eax,%edx
+  802427:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80242b:	83 c0 08             	add    $0x8,%eax
+  80242e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802431:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  802434:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  802439:	eb 51                	jmp    80248c <vprintfmt+0x5c0>
+  80243b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80243f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802443:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802447:	eb e8                	jmp    802431 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  802449:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80244d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802451:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802455:	e9 5c ff ff ff       	jmp    8023b6 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  80245a:	4c 89 ee             	mov    %r13,%rsi
+  80245d:	bf 30 00 00 00       	mov    $0x30,%edi
+  802462:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  802465:	4c 89 ee             	mov    %r13,%rsi
+  802468:	bf 78 00 00 00       	mov    $0x78,%edi
+  80246d:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  802470:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802473:	83 f8 2f             	cmp    $0x2f,%eax
+  802476:	77 47                	ja     8024bf <vprintfmt+0x5f3>
+  802478:	89 c2                	mov    %eax,%edx
+  80247a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80247e:	83 c0 08             	add    $0x8,%eax
+  802481:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802484:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  802487:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  80248c:	48 83 ec 08          	sub    $0x8,%rsp
+  802490:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  802494:	0f 94 c0             	sete   %al
+  802497:	0f b6 c0             	movzbl %al,%eax
+  80249a:	50                   	push   %rax
+  80249b:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  8024a0:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  8024a4:	4c 89 ee             	mov    %r13,%rsi
+  8024a7:	4c 89 f7             	mov    %r14,%rdi
+  8024aa:	48 b8 c1 1d 80 00 00 	movabs $0x801dc1,%rax
+  8024b1:	00 00 00 
+  8024b4:	ff d0                	call   *%rax
+            break;
+  8024b6:	48 83 c4 10          	add    $0x10,%rsp
+  8024ba:	e9 3e fa ff ff       	jmp    801efd <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  8024bf:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8024c3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8024c7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8024cb:	eb b7                	jmp    802484 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  8024cd:	40 84 f6             	test   %sil,%sil
+  8024d0:	75 2b                	jne    8024fd <vprintfmt+0x631>
+    switch (lflag) {
+  8024d2:	85 d2                	test   %edx,%edx
+  8024d4:	74 56                	je     80252c <vprintfmt+0x660>
+  8024d6:	83 fa 01             	cmp    $0x1,%edx
+  8024d9:	74 7f                	je     80255a <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  8024db:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8024de:	83 f8 2f             	cmp    $0x2f,%eax
+  8024e1:	0f 87 a2 00 00 00    	ja     802589 <vprintfmt+0x6bd>
+  8024e7:	89 c2                	mov    %eax,%edx
+  8024e9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8024ed:	83 c0 08             	add    $0x8,%eax
+  8024f0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8024f3:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8024f6:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  8024fb:	eb 8f                	jmp    80248c <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8024fd:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802500:	83 f8 2f             	cmp    $0x2f,%eax
+  802503:	77 19                	ja     80251e <vprintfmt+0x652>
+  802505:	89 c2                	mov    %eax,%edx
+  802507:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80250b:	83 c0 08             	add    $0x8,%eax
+  80250e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802511:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  802514:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  802519:	e9 6e ff ff ff       	jmp    80248c <vprintfmt+0x5c0>
+  80251e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802522:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802526:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80252a:	eb e5                	jmp    802511 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  80252c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80252f:	83 f8 2f             	cmp    $0x2f,%eax
+  802532:	77 18                	ja     80254c <vprintfmt+0x680>
+  802534:	89 c2                	mov    %eax,%edx
+  802536:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80253a:	83 c0 08             	add    $0x8,%eax
+  80253d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802540:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  802542:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  802547:	e9 40 ff ff ff       	jmp    80248c <vprintfmt+0x5c0>
+  80254c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802550:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802554:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802558:	eb e6                	jmp    802540 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  80255a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80255d:	83 f8 2f             	cmp    $0x2f,%eax
+  802560:	77 19                	ja     80257b <vprintfmt+0x6af>
+  802562:	89 c2                	mov    %eax,%edx
+  802564:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802568:	83 c0 08             	add    $0x8,%eax
+  80256b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80256e:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  802571:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  802576:	e9 11 ff ff ff       	jmp    80248c <vprintfmt+0x5c0>
+  80257b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80257f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802583:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802587:	eb e5                	jmp    80256e <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  802589:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80258d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802591:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802595:	e9 59 ff ff ff       	jmp    8024f3 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  80259a:	4c 89 ee             	mov    %r13,%rsi
+  80259d:	bf 25 00 00 00       	mov    $0x25,%edi
+  8025a2:	41 ff d6             	call   *%r14
+            break;
+  8025a5:	e9 53 f9 ff ff       	jmp    801efd <vprintfmt+0x31>
+            putch('%', put_arg);
+  8025aa:	4c 89 ee             	mov    %r13,%rsi
+  8025ad:	bf 25 00 00 00       	mov    $0x25,%edi
+  8025b2:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  8025b5:	48 83 eb 01          	sub    $0x1,%rbx
+  8025b9:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  8025bd:	75 f6                	jne    8025b5 <vprintfmt+0x6e9>
+  8025bf:	e9 39 f9 ff ff       	jmp    801efd <vprintfmt+0x31>
+}
+  8025c4:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8025c8:	5b                   	pop    %rbx
+  8025c9:	41 5c                	pop    %r12
+  8025cb:	41 5d                	pop    %r13
+  8025cd:	41 5e                	pop    %r14
+  8025cf:	41 5f                	pop    %r15
+  8025d1:	5d                   	pop    %rbp
+  8025d2:	c3                   	ret
+
+00000000008025d3 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  8025d3:	55                   	push   %rbp
+  8025d4:	48 89 e5             	mov    %rsp,%rbp
+  8025d7:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  8025db:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8025df:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  8025e4:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  8025e8:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  8025ef:	48 85 ff             	test   %rdi,%rdi
+  8025f2:	74 2b                	je     80261f <vsnprintf+0x4c>
+  8025f4:	48 85 f6             	test   %rsi,%rsi
+  8025f7:	74 26                	je     80261f <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  8025f9:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8025fd:	48 bf 77 1e 80 00 00 	movabs $0x801e77,%rdi
+  802604:	00 00 00 
+  802607:	48 b8 cc 1e 80 00 00 	movabs $0x801ecc,%rax
+  80260e:	00 00 00 
+  802611:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  802613:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802617:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  80261a:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  80261d:	c9                   	leave
+  80261e:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  80261f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802624:	eb f7                	jmp    80261d <vsnprintf+0x4a>
+
+0000000000802626 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  802626:	55                   	push   %rbp
+  802627:	48 89 e5             	mov    %rsp,%rbp
+  80262a:	48 83 ec 50          	sub    $0x50,%rsp
+  80262e:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  802632:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  802636:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  80263a:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  802641:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802645:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802649:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80264d:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  802651:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  802655:	48 b8 d3 25 80 00 00 	movabs $0x8025d3,%rax
+  80265c:	00 00 00 
+  80265f:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  802661:	c9                   	leave
+  802662:	c3                   	ret
+
+0000000000802663 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  802663:	80 3f 00             	cmpb   $0x0,(%rdi)
+  802666:	74 10                	je     802678 <strlen+0x15>
+    size_t n = 0;
+  802668:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  80266d:	48 83 c0 01          	add    $0x1,%rax
+  802671:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  802675:	75 f6                	jne    80266d <strlen+0xa>
+  802677:	c3                   	ret
+    size_t n = 0;
+  802678:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  80267d:	c3                   	ret
+
+000000000080267e <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  80267e:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  802681:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  802686:	48 85 f6             	test   %rsi,%rsi
+  802689:	74 11                	je     80269c <strnlen+0x1e>
+  80268b:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  80268f:	74 0c                	je     80269d <strnlen+0x1f>
+  802691:	48 83 c2 01          	add    $0x1,%rdx
+  802695:	48 39 d0             	cmp    %rdx,%rax
+  802698:	75 f1                	jne    80268b <strnlen+0xd>
+  80269a:	eb 04                	jmp    8026a0 <strnlen+0x22>
+  80269c:	c3                   	ret
+  80269d:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  8026a0:	c3                   	ret
+
+00000000008026a1 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  8026a1:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  8026a4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8026a9:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  8026ad:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  8026b0:	48 83 c2 01          	add    $0x1,%rdx
+  8026b4:	84 c9                	test   %cl,%cl
+  8026b6:	75 f1                	jne    8026a9 <strcpy+0x8>
+        ;
+    return res;
+}
+  8026b8:	c3                   	ret
+
+00000000008026b9 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  8026b9:	55                   	push   %rbp
+  8026ba:	48 89 e5             	mov    %rsp,%rbp
+  8026bd:	41 54                	push   %r12
+  8026bf:	53                   	push   %rbx
+  8026c0:	48 89 fb             	mov    %rdi,%rbx
+  8026c3:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  8026c6:	48 b8 63 26 80 00 00 	movabs $0x802663,%rax
+  8026cd:	00 00 00 
+  8026d0:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  8026d2:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  8026d6:	4c 89 e6             	mov    %r12,%rsi
+  8026d9:	48 b8 a1 26 80 00 00 	movabs $0x8026a1,%rax
+  8026e0:	00 00 00 
+  8026e3:	ff d0                	call   *%rax
+    return dst;
+}
+  8026e5:	48 89 d8             	mov    %rbx,%rax
+  8026e8:	5b                   	pop    %rbx
+  8026e9:	41 5c                	pop    %r12
+  8026eb:	5d                   	pop    %rbp
+  8026ec:	c3                   	ret
+
+00000000008026ed <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8026ed:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  8026f0:	48 85 d2             	test   %rdx,%rdx
+  8026f3:	74 1f                	je     802714 <strncpy+0x27>
+  8026f5:	48 01 fa             	add    %rdi,%rdx
+  8026f8:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  8026fb:	48 83 c1 01          	add    $0x1,%rcx
+  8026ff:	44 0f b6 06          	movzbl (%rsi),%r8d
+  802703:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  802707:	41 80 f8 01          	cmp    $0x1,%r8b
+  80270b:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  80270f:	48 39 ca             	cmp    %rcx,%rdx
+  802712:	75 e7                	jne    8026fb <strncpy+0xe>
+    }
+    return ret;
+}
+  802714:	c3                   	ret
+
+0000000000802715 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  802715:	48 89 f8             	mov    %rdi,%rax
+  802718:	48 85 d2             	test   %rdx,%rdx
+  80271b:	74 24                	je     802741 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  80271d:	48 83 ea 01          	sub    $0x1,%rdx
+  802721:	74 1b                	je     80273e <strlcpy+0x29>
+  802723:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  802727:	0f b6 16             	movzbl (%rsi),%edx
+  80272a:	84 d2                	test   %dl,%dl
+  80272c:	74 10                	je     80273e <strlcpy+0x29>
+            *dst++ = *src++;
+  80272e:	48 83 c6 01          	add    $0x1,%rsi
+  802732:	48 83 c0 01          	add    $0x1,%rax
+  802736:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  802739:	48 39 c8             	cmp    %rcx,%rax
+  80273c:	75 e9                	jne    802727 <strlcpy+0x12>
+        *dst = '\0';
+  80273e:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  802741:	48 29 f8             	sub    %rdi,%rax
+}
+  802744:	c3                   	ret
+
+0000000000802745 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  802745:	0f b6 07             	movzbl (%rdi),%eax
+  802748:	84 c0                	test   %al,%al
+  80274a:	74 13                	je     80275f <strcmp+0x1a>
+  80274c:	38 06                	cmp    %al,(%rsi)
+  80274e:	75 0f                	jne    80275f <strcmp+0x1a>
+  802750:	48 83 c7 01          	add    $0x1,%rdi
+  802754:	48 83 c6 01          	add    $0x1,%rsi
+  802758:	0f b6 07             	movzbl (%rdi),%eax
+  80275b:	84 c0                	test   %al,%al
+  80275d:	75 ed                	jne    80274c <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  80275f:	0f b6 c0             	movzbl %al,%eax
+  802762:	0f b6 16             	movzbl (%rsi),%edx
+  802765:	29 d0                	sub    %edx,%eax
+}
+  802767:	c3                   	ret
+
+0000000000802768 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  802768:	48 85 d2             	test   %rdx,%rdx
+  80276b:	74 1f                	je     80278c <strncmp+0x24>
+  80276d:	0f b6 07             	movzbl (%rdi),%eax
+  802770:	84 c0                	test   %al,%al
+  802772:	74 1e                	je     802792 <strncmp+0x2a>
+  802774:	3a 06                	cmp    (%rsi),%al
+  802776:	75 1a                	jne    802792 <strncmp+0x2a>
+  802778:	48 83 c7 01          	add    $0x1,%rdi
+  80277c:	48 83 c6 01          	add    $0x1,%rsi
+  802780:	48 83 ea 01          	sub    $0x1,%rdx
+  802784:	75 e7                	jne    80276d <strncmp+0x5>
+
+    if (!n) return 0;
+  802786:	b8 00 00 00 00       	mov    $0x0,%eax
+  80278b:	c3                   	ret
+  80278c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802791:	c3                   	ret
+  802792:	48 85 d2             	test   %rdx,%rdx
+  802795:	74 09                	je     8027a0 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  802797:	0f b6 07             	movzbl (%rdi),%eax
+  80279a:	0f b6 16             	movzbl (%rsi),%edx
+  80279d:	29 d0                	sub    %edx,%eax
+  80279f:	c3                   	ret
+    if (!n) return 0;
+  8027a0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8027a5:	c3                   	ret
+
+00000000008027a6 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  8027a6:	0f b6 17             	movzbl (%rdi),%edx
+  8027a9:	84 d2                	test   %dl,%dl
+  8027ab:	74 18                	je     8027c5 <strchr+0x1f>
+        if (*str == c) {
+  8027ad:	0f be d2             	movsbl %dl,%edx
+  8027b0:	39 f2                	cmp    %esi,%edx
+  8027b2:	74 17                	je     8027cb <strchr+0x25>
+    for (; *str; str++) {
+  8027b4:	48 83 c7 01          	add    $0x1,%rdi
+  8027b8:	0f b6 17             	movzbl (%rdi),%edx
+  8027bb:	84 d2                	test   %dl,%dl
+  8027bd:	75 ee                	jne    8027ad <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  8027bf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027c4:	c3                   	ret
+  8027c5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027ca:	c3                   	ret
+  8027cb:	48 89 f8             	mov    %rdi,%rax
+}
+  8027ce:	c3                   	ret
+
+00000000008027cf <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  8027cf:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  8027d2:	0f b6 17             	movzbl (%rdi),%edx
+  8027d5:	84 d2                	test   %dl,%dl
+  8027d7:	74 13                	je     8027ec <strfind+0x1d>
+  8027d9:	0f be d2             	movsbl %dl,%edx
+  8027dc:	39 f2                	cmp    %esi,%edx
+  8027de:	74 0b                	je     8027eb <strfind+0x1c>
+  8027e0:	48 83 c0 01          	add    $0x1,%rax
+  8027e4:	0f b6 10             	movzbl (%rax),%edx
+  8027e7:	84 d2                	test   %dl,%dl
+  8027e9:	75 ee                	jne    8027d9 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  8027eb:	c3                   	ret
+  8027ec:	c3                   	ret
+
+00000000008027ed <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  8027ed:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  8027f0:	48 89 f8             	mov    %rdi,%rax
+  8027f3:	48 f7 d8             	neg    %rax
+  8027f6:	83 e0 07             	and    $0x7,%eax
+  8027f9:	49 89 d1             	mov    %rdx,%r9
+  8027fc:	49 29 c1             	sub    %rax,%r9
+  8027ff:	78 36                	js     802837 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  802801:	40 0f b6 c6          	movzbl %sil,%eax
+  802805:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  80280c:	01 01 01 
+  80280f:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  802813:	40 f6 c7 07          	test   $0x7,%dil
+  802817:	75 38                	jne    802851 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  802819:	4c 89 c9             	mov    %r9,%rcx
+  80281c:	48 c1 f9 03          	sar    $0x3,%rcx
+  802820:	74 0c                	je     80282e <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  802822:	fc                   	cld
+  802823:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  802826:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  80282a:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  80282e:	4d 85 c9             	test   %r9,%r9
+  802831:	75 45                	jne    802878 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  802833:	4c 89 c0             	mov    %r8,%rax
+  802836:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  802837:	48 85 d2             	test   %rdx,%rdx
+  80283a:	74 f7                	je     802833 <memset+0x46>
+  80283c:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  80283f:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  802842:	48 83 c0 01          	add    $0x1,%rax
+  802846:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  80284a:	48 39 c2             	cmp    %rax,%rdx
+  80284d:	75 f3                	jne    802842 <memset+0x55>
+  80284f:	eb e2                	jmp    802833 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  802851:	40 f6 c7 01          	test   $0x1,%dil
+  802855:	74 06                	je     80285d <memset+0x70>
+  802857:	88 07                	mov    %al,(%rdi)
+  802859:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  80285d:	40 f6 c7 02          	test   $0x2,%dil
+  802861:	74 07                	je     80286a <memset+0x7d>
+  802863:	66 89 07             	mov    %ax,(%rdi)
+  802866:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  80286a:	40 f6 c7 04          	test   $0x4,%dil
+  80286e:	74 a9                	je     802819 <memset+0x2c>
+  802870:	89 07                	mov    %eax,(%rdi)
+  802872:	48 83 c7 04          	add    $0x4,%rdi
+  802876:	eb a1                	jmp    802819 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  802878:	41 f6 c1 04          	test   $0x4,%r9b
+  80287c:	74 06                	je     802884 <memset+0x97>
+  80287e:	89 07                	mov    %eax,(%rdi)
+  802880:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  802884:	41 f6 c1 02          	test   $0x2,%r9b
+  802888:	74 07                	je     802891 <memset+0xa4>
+  80288a:	66 89 07             	mov    %ax,(%rdi)
+  80288d:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  802891:	41 f6 c1 01          	test   $0x1,%r9b
+  802895:	74 9c                	je     802833 <memset+0x46>
+  802897:	88 07                	mov    %al,(%rdi)
+  802899:	eb 98                	jmp    802833 <memset+0x46>
+
+000000000080289b <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  80289b:	48 89 f8             	mov    %rdi,%rax
+  80289e:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  8028a1:	48 39 fe             	cmp    %rdi,%rsi
+  8028a4:	73 3b                	jae    8028e1 <memmove+0x46>
+  8028a6:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  8028aa:	48 39 d7             	cmp    %rdx,%rdi
+  8028ad:	73 32                	jae    8028e1 <memmove+0x46>
+        s += n;
+        d += n;
+  8028af:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  8028b3:	48 89 d6             	mov    %rdx,%rsi
+  8028b6:	48 09 fe             	or     %rdi,%rsi
+  8028b9:	48 09 ce             	or     %rcx,%rsi
+  8028bc:	40 f6 c6 07          	test   $0x7,%sil
+  8028c0:	75 12                	jne    8028d4 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  8028c2:	48 83 ef 08          	sub    $0x8,%rdi
+  8028c6:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  8028ca:	48 c1 e9 03          	shr    $0x3,%rcx
+  8028ce:	fd                   	std
+  8028cf:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  8028d2:	fc                   	cld
+  8028d3:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  8028d4:	48 83 ef 01          	sub    $0x1,%rdi
+  8028d8:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  8028dc:	fd                   	std
+  8028dd:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  8028df:	eb f1                	jmp    8028d2 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  8028e1:	48 89 f2             	mov    %rsi,%rdx
+  8028e4:	48 09 c2             	or     %rax,%rdx
+  8028e7:	48 09 ca             	or     %rcx,%rdx
+  8028ea:	f6 c2 07             	test   $0x7,%dl
+  8028ed:	75 0c                	jne    8028fb <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  8028ef:	48 c1 e9 03          	shr    $0x3,%rcx
+  8028f3:	48 89 c7             	mov    %rax,%rdi
+  8028f6:	fc                   	cld
+  8028f7:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  8028fa:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  8028fb:	48 89 c7             	mov    %rax,%rdi
+  8028fe:	fc                   	cld
+  8028ff:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  802901:	c3                   	ret
+
+0000000000802902 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  802902:	55                   	push   %rbp
+  802903:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  802906:	48 b8 9b 28 80 00 00 	movabs $0x80289b,%rax
+  80290d:	00 00 00 
+  802910:	ff d0                	call   *%rax
+}
+  802912:	5d                   	pop    %rbp
+  802913:	c3                   	ret
+
+0000000000802914 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  802914:	55                   	push   %rbp
+  802915:	48 89 e5             	mov    %rsp,%rbp
+  802918:	41 57                	push   %r15
+  80291a:	41 56                	push   %r14
+  80291c:	41 55                	push   %r13
+  80291e:	41 54                	push   %r12
+  802920:	53                   	push   %rbx
+  802921:	48 83 ec 08          	sub    $0x8,%rsp
+  802925:	49 89 fe             	mov    %rdi,%r14
+  802928:	49 89 f7             	mov    %rsi,%r15
+  80292b:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  80292e:	48 89 f7             	mov    %rsi,%rdi
+  802931:	48 b8 63 26 80 00 00 	movabs $0x802663,%rax
+  802938:	00 00 00 
+  80293b:	ff d0                	call   *%rax
+  80293d:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  802940:	48 89 de             	mov    %rbx,%rsi
+  802943:	4c 89 f7             	mov    %r14,%rdi
+  802946:	48 b8 7e 26 80 00 00 	movabs $0x80267e,%rax
+  80294d:	00 00 00 
+  802950:	ff d0                	call   *%rax
+  802952:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  802955:	48 39 c3             	cmp    %rax,%rbx
+  802958:	74 36                	je     802990 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  80295a:	48 89 d8             	mov    %rbx,%rax
+  80295d:	4c 29 e8             	sub    %r13,%rax
+  802960:	49 39 c4             	cmp    %rax,%r12
+  802963:	73 31                	jae    802996 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  802965:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  80296a:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  80296e:	4c 89 fe             	mov    %r15,%rsi
+  802971:	48 b8 02 29 80 00 00 	movabs $0x802902,%rax
+  802978:	00 00 00 
+  80297b:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  80297d:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  802981:	48 83 c4 08          	add    $0x8,%rsp
+  802985:	5b                   	pop    %rbx
+  802986:	41 5c                	pop    %r12
+  802988:	41 5d                	pop    %r13
+  80298a:	41 5e                	pop    %r14
+  80298c:	41 5f                	pop    %r15
+  80298e:	5d                   	pop    %rbp
+  80298f:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  802990:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  802994:	eb eb                	jmp    802981 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  802996:	48 83 eb 01          	sub    $0x1,%rbx
+  80299a:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  80299e:	48 89 da             	mov    %rbx,%rdx
+  8029a1:	4c 89 fe             	mov    %r15,%rsi
+  8029a4:	48 b8 02 29 80 00 00 	movabs $0x802902,%rax
+  8029ab:	00 00 00 
+  8029ae:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  8029b0:	49 01 de             	add    %rbx,%r14
+  8029b3:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  8029b8:	eb c3                	jmp    80297d <strlcat+0x69>
+
+00000000008029ba <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  8029ba:	48 85 d2             	test   %rdx,%rdx
+  8029bd:	74 2d                	je     8029ec <memcmp+0x32>
+  8029bf:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  8029c4:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  8029c8:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  8029cd:	44 38 c1             	cmp    %r8b,%cl
+  8029d0:	75 0f                	jne    8029e1 <memcmp+0x27>
+    while (n-- > 0) {
+  8029d2:	48 83 c0 01          	add    $0x1,%rax
+  8029d6:	48 39 c2             	cmp    %rax,%rdx
+  8029d9:	75 e9                	jne    8029c4 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  8029db:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029e0:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  8029e1:	0f b6 c1             	movzbl %cl,%eax
+  8029e4:	45 0f b6 c0          	movzbl %r8b,%r8d
+  8029e8:	44 29 c0             	sub    %r8d,%eax
+  8029eb:	c3                   	ret
+    return 0;
+  8029ec:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8029f1:	c3                   	ret
+
+00000000008029f2 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  8029f2:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  8029f6:	48 39 c7             	cmp    %rax,%rdi
+  8029f9:	73 0f                	jae    802a0a <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  8029fb:	40 38 37             	cmp    %sil,(%rdi)
+  8029fe:	74 0e                	je     802a0e <memfind+0x1c>
+    for (; src < end; src++) {
+  802a00:	48 83 c7 01          	add    $0x1,%rdi
+  802a04:	48 39 f8             	cmp    %rdi,%rax
+  802a07:	75 f2                	jne    8029fb <memfind+0x9>
+  802a09:	c3                   	ret
+  802a0a:	48 89 f8             	mov    %rdi,%rax
+  802a0d:	c3                   	ret
+  802a0e:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  802a11:	c3                   	ret
+
+0000000000802a12 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  802a12:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  802a15:	0f b6 37             	movzbl (%rdi),%esi
+  802a18:	40 80 fe 20          	cmp    $0x20,%sil
+  802a1c:	74 06                	je     802a24 <strtol+0x12>
+  802a1e:	40 80 fe 09          	cmp    $0x9,%sil
+  802a22:	75 13                	jne    802a37 <strtol+0x25>
+  802a24:	48 83 c7 01          	add    $0x1,%rdi
+  802a28:	0f b6 37             	movzbl (%rdi),%esi
+  802a2b:	40 80 fe 20          	cmp    $0x20,%sil
+  802a2f:	74 f3                	je     802a24 <strtol+0x12>
+  802a31:	40 80 fe 09          	cmp    $0x9,%sil
+  802a35:	74 ed                	je     802a24 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  802a37:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  802a3a:	83 e0 fd             	and    $0xfffffffd,%eax
+  802a3d:	3c 01                	cmp    $0x1,%al
+  802a3f:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  802a43:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  802a49:	75 0f                	jne    802a5a <strtol+0x48>
+  802a4b:	80 3f 30             	cmpb   $0x30,(%rdi)
+  802a4e:	74 14                	je     802a64 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  802a50:	85 d2                	test   %edx,%edx
+  802a52:	b8 0a 00 00 00       	mov    $0xa,%eax
+  802a57:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  802a5a:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  802a5f:	4c 63 ca             	movslq %edx,%r9
+  802a62:	eb 36                	jmp    802a9a <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  802a64:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  802a68:	74 0f                	je     802a79 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  802a6a:	85 d2                	test   %edx,%edx
+  802a6c:	75 ec                	jne    802a5a <strtol+0x48>
+        s++;
+  802a6e:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  802a72:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  802a77:	eb e1                	jmp    802a5a <strtol+0x48>
+        s += 2;
+  802a79:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  802a7d:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  802a82:	eb d6                	jmp    802a5a <strtol+0x48>
+            dig -= '0';
+  802a84:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  802a87:	44 0f b6 c1          	movzbl %cl,%r8d
+  802a8b:	41 39 d0             	cmp    %edx,%r8d
+  802a8e:	7d 21                	jge    802ab1 <strtol+0x9f>
+        val = val * base + dig;
+  802a90:	49 0f af c1          	imul   %r9,%rax
+  802a94:	0f b6 c9             	movzbl %cl,%ecx
+  802a97:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  802a9a:	48 83 c7 01          	add    $0x1,%rdi
+  802a9e:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  802aa2:	80 f9 39             	cmp    $0x39,%cl
+  802aa5:	76 dd                	jbe    802a84 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  802aa7:	80 f9 7b             	cmp    $0x7b,%cl
+  802aaa:	77 05                	ja     802ab1 <strtol+0x9f>
+            dig -= 'a' - 10;
+  802aac:	83 e9 57             	sub    $0x57,%ecx
+  802aaf:	eb d6                	jmp    802a87 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  802ab1:	4d 85 d2             	test   %r10,%r10
+  802ab4:	74 03                	je     802ab9 <strtol+0xa7>
+  802ab6:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  802ab9:	48 89 c2             	mov    %rax,%rdx
+  802abc:	48 f7 da             	neg    %rdx
+  802abf:	40 80 fe 2d          	cmp    $0x2d,%sil
+  802ac3:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  802ac7:	c3                   	ret
+
+0000000000802ac8 <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  802ac8:	55                   	push   %rbp
+  802ac9:	48 89 e5             	mov    %rsp,%rbp
+  802acc:	41 55                	push   %r13
+  802ace:	41 54                	push   %r12
+  802ad0:	53                   	push   %rbx
+  802ad1:	48 83 ec 08          	sub    $0x8,%rsp
+  802ad5:	49 89 fc             	mov    %rdi,%r12
+  802ad8:	48 89 f7             	mov    %rsi,%rdi
+  802adb:	48 89 d3             	mov    %rdx,%rbx
+  802ade:	49 89 cd             	mov    %rcx,%r13
+    // LAB 9: Your code here:
+    int res = sys_ipc_recv(!pg ? (void*)MAX_USER_ADDRESS : pg, !size ? 0 : *size);
+  802ae1:	be 00 00 00 00       	mov    $0x0,%esi
+  802ae6:	48 85 d2             	test   %rdx,%rdx
+  802ae9:	74 03                	je     802aee <ipc_recv+0x26>
+  802aeb:	48 8b 32             	mov    (%rdx),%rsi
+  802aee:	48 85 ff             	test   %rdi,%rdi
+  802af1:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802af8:	00 00 00 
+  802afb:	48 0f 44 f8          	cmove  %rax,%rdi
+  802aff:	48 b8 6d 06 80 00 00 	movabs $0x80066d,%rax
+  802b06:	00 00 00 
+  802b09:	ff d0                	call   *%rax
+    if (res < 0) {
+  802b0b:	85 c0                	test   %eax,%eax
+  802b0d:	78 66                	js     802b75 <ipc_recv+0xad>
+        if (size) {
+            *size = 0;
+        }
+        return res;
+    }
+    if (from_env_store) {
+  802b0f:	4d 85 e4             	test   %r12,%r12
+  802b12:	74 14                	je     802b28 <ipc_recv+0x60>
+        *from_env_store = thisenv->env_ipc_from;
+  802b14:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802b1b:	00 00 00 
+  802b1e:	8b 80 ac 01 00 00    	mov    0x1ac(%rax),%eax
+  802b24:	41 89 04 24          	mov    %eax,(%r12)
+    }
+    if (perm_store) {
+  802b28:	4d 85 ed             	test   %r13,%r13
+  802b2b:	74 14                	je     802b41 <ipc_recv+0x79>
+        *perm_store = thisenv->env_ipc_perm;
+  802b2d:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802b34:	00 00 00 
+  802b37:	8b 80 b0 01 00 00    	mov    0x1b0(%rax),%eax
+  802b3d:	41 89 45 00          	mov    %eax,0x0(%r13)
+    }
+    if (size) {
+  802b41:	48 85 db             	test   %rbx,%rbx
+  802b44:	74 14                	je     802b5a <ipc_recv+0x92>
+        *size = thisenv->env_ipc_maxsz;
+  802b46:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802b4d:	00 00 00 
+  802b50:	48 8b 80 a0 01 00 00 	mov    0x1a0(%rax),%rax
+  802b57:	48 89 03             	mov    %rax,(%rbx)
+    }
+    return thisenv->env_ipc_value;
+  802b5a:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802b61:	00 00 00 
+  802b64:	8b 80 a8 01 00 00    	mov    0x1a8(%rax),%eax
+}
+  802b6a:	48 83 c4 08          	add    $0x8,%rsp
+  802b6e:	5b                   	pop    %rbx
+  802b6f:	41 5c                	pop    %r12
+  802b71:	41 5d                	pop    %r13
+  802b73:	5d                   	pop    %rbp
+  802b74:	c3                   	ret
+        if (from_env_store) {
+  802b75:	4d 85 e4             	test   %r12,%r12
+  802b78:	74 08                	je     802b82 <ipc_recv+0xba>
+            *from_env_store = 0;
+  802b7a:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  802b81:	00 
+        if (perm_store) {
+  802b82:	4d 85 ed             	test   %r13,%r13
+  802b85:	74 08                	je     802b8f <ipc_recv+0xc7>
+            *perm_store = 0;
+  802b87:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  802b8e:	00 
+        if (size) {
+  802b8f:	48 85 db             	test   %rbx,%rbx
+  802b92:	74 d6                	je     802b6a <ipc_recv+0xa2>
+            *size = 0;
+  802b94:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  802b9b:	eb cd                	jmp    802b6a <ipc_recv+0xa2>
+
+0000000000802b9d <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  802b9d:	55                   	push   %rbp
+  802b9e:	48 89 e5             	mov    %rsp,%rbp
+  802ba1:	41 57                	push   %r15
+  802ba3:	41 56                	push   %r14
+  802ba5:	41 55                	push   %r13
+  802ba7:	41 54                	push   %r12
+  802ba9:	53                   	push   %rbx
+  802baa:	48 83 ec 18          	sub    $0x18,%rsp
+  802bae:	41 89 fd             	mov    %edi,%r13d
+  802bb1:	89 75 cc             	mov    %esi,-0x34(%rbp)
+  802bb4:	49 89 cc             	mov    %rcx,%r12
+  802bb7:	44 89 45 c8          	mov    %r8d,-0x38(%rbp)
+    // LAB 9: Your code here:
+    int res = 0;
+    while ((res = sys_ipc_try_send(to_env, val, !pg ? (void*)MAX_USER_ADDRESS : pg, size, perm)) < 0) {
+  802bbb:	48 85 d2             	test   %rdx,%rdx
+  802bbe:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802bc5:	00 00 00 
+  802bc8:	48 0f 45 c2          	cmovne %rdx,%rax
+  802bcc:	48 89 c3             	mov    %rax,%rbx
+  802bcf:	49 be 41 06 80 00 00 	movabs $0x800641,%r14
+  802bd6:	00 00 00 
+        if (res != -E_IPC_NOT_RECV) {
+            panic("sys_ipc_try_send failed: %i", res);
+        }
+        sys_yield();
+  802bd9:	49 bf 0c 02 80 00 00 	movabs $0x80020c,%r15
+  802be0:	00 00 00 
+    while ((res = sys_ipc_try_send(to_env, val, !pg ? (void*)MAX_USER_ADDRESS : pg, size, perm)) < 0) {
+  802be3:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  802be6:	44 8b 45 c8          	mov    -0x38(%rbp),%r8d
+  802bea:	4c 89 e1             	mov    %r12,%rcx
+  802bed:	48 89 da             	mov    %rbx,%rdx
+  802bf0:	44 89 ef             	mov    %r13d,%edi
+  802bf3:	41 ff d6             	call   *%r14
+  802bf6:	85 c0                	test   %eax,%eax
+  802bf8:	79 37                	jns    802c31 <ipc_send+0x94>
+        if (res != -E_IPC_NOT_RECV) {
+  802bfa:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  802bfd:	75 05                	jne    802c04 <ipc_send+0x67>
+        sys_yield();
+  802bff:	41 ff d7             	call   *%r15
+  802c02:	eb df                	jmp    802be3 <ipc_send+0x46>
+            panic("sys_ipc_try_send failed: %i", res);
+  802c04:	89 c1                	mov    %eax,%ecx
+  802c06:	48 ba 4f 33 80 00 00 	movabs $0x80334f,%rdx
+  802c0d:	00 00 00 
+  802c10:	be 40 00 00 00       	mov    $0x40,%esi
+  802c15:	48 bf 6b 33 80 00 00 	movabs $0x80336b,%rdi
+  802c1c:	00 00 00 
+  802c1f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c24:	49 b8 2c 1c 80 00 00 	movabs $0x801c2c,%r8
+  802c2b:	00 00 00 
+  802c2e:	41 ff d0             	call   *%r8
+    }
+    return;
+}
+  802c31:	48 83 c4 18          	add    $0x18,%rsp
+  802c35:	5b                   	pop    %rbx
+  802c36:	41 5c                	pop    %r12
+  802c38:	41 5d                	pop    %r13
+  802c3a:	41 5e                	pop    %r14
+  802c3c:	41 5f                	pop    %r15
+  802c3e:	5d                   	pop    %rbp
+  802c3f:	c3                   	ret
+
+0000000000802c40 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  802c40:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  802c45:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  802c4c:	00 00 00 
+  802c4f:	48 69 d0 d0 01 00 00 	imul   $0x1d0,%rax,%rdx
+  802c56:	48 01 ca             	add    %rcx,%rdx
+  802c59:	8b 92 e8 00 00 00    	mov    0xe8(%rdx),%edx
+  802c5f:	39 fa                	cmp    %edi,%edx
+  802c61:	74 12                	je     802c75 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  802c63:	48 83 c0 01          	add    $0x1,%rax
+  802c67:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  802c6d:	75 e0                	jne    802c4f <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  802c6f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802c74:	c3                   	ret
+            return envs[i].env_id;
+  802c75:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+  802c7c:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  802c83:	00 00 00 
+  802c86:	48 01 d0             	add    %rdx,%rax
+  802c89:	8b 80 e0 00 00 00    	mov    0xe0(%rax),%eax
+  802c8f:	c3                   	ret
+
+0000000000802c90 <__rodata_start>:
+  802c90:	3c 75                	cmp    $0x75,%al
+  802c92:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802c93:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  802c97:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802c98:	3e 00 66 0f          	ds add %ah,0xf(%rsi)
+  802c9c:	1f                   	(bad)
+  802c9d:	44 00 00             	add    %r8b,(%rax)
+  802ca0:	73 79                	jae    802d1b <__rodata_start+0x8b>
+  802ca2:	73 63                	jae    802d07 <__rodata_start+0x77>
+  802ca4:	61                   	(bad)
+  802ca5:	6c                   	insb   (%dx),%es:(%rdi)
+  802ca6:	6c                   	insb   (%dx),%es:(%rdi)
+  802ca7:	20 25 7a 64 20 72    	and    %ah,0x7220647a(%rip)        # 72a09127 <__bss_end+0x72201127>
+  802cad:	65 74 75             	gs je  802d25 <__rodata_start+0x95>
+  802cb0:	72 6e                	jb     802d20 <__rodata_start+0x90>
+  802cb2:	65 64 20 25 7a 64 20 	gs and %ah,%fs:0x2820647a(%rip)        # 28a09134 <__bss_end+0x28201134>
+  802cb9:	28 
+  802cba:	3e 20 30             	ds and %dh,(%rax)
+  802cbd:	29 00                	sub    %eax,(%rax)
+  802cbf:	6c                   	insb   (%dx),%es:(%rdi)
+  802cc0:	69 62 2f 73 79 73 63 	imul   $0x63737973,0x2f(%rdx),%esp
+  802cc7:	61                   	(bad)
+  802cc8:	6c                   	insb   (%dx),%es:(%rdi)
+  802cc9:	6c                   	insb   (%dx),%es:(%rdi)
+  802cca:	2e 63 00             	cs movsxd (%rax),%eax
+  802ccd:	0f 1f 00             	nopl   (%rax)
+  802cd0:	5b                   	pop    %rbx
+  802cd1:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  802cd6:	20 75 6e             	and    %dh,0x6e(%rbp)
+  802cd9:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  802cdd:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802cde:	20 64 65 76          	and    %ah,0x76(%rbp,%riz,2)
+  802ce2:	69 63 65 20 74 79 70 	imul   $0x70797420,0x65(%rbx),%esp
+  802ce9:	65 20 25 64 0a 00 00 	and    %ah,%gs:0xa64(%rip)        # 803754 <error_string+0x4d4>
+  802cf0:	5b                   	pop    %rbx
+  802cf1:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  802cf6:	20 66 74             	and    %ah,0x74(%rsi)
+  802cf9:	72 75                	jb     802d70 <devtab+0x10>
+  802cfb:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802cfc:	63 61 74             	movsxd 0x74(%rcx),%esp
+  802cff:	65 20 25 64 20 2d 2d 	and    %ah,%gs:0x2d2d2064(%rip)        # 2dad4d6a <__bss_end+0x2d2ccd6a>
+  802d06:	20 62 61             	and    %ah,0x61(%rdx)
+  802d09:	64 20 6d 6f          	and    %ch,%fs:0x6f(%rbp)
+  802d0d:	64 65 0a 00          	fs or  %gs:(%rax),%al
+  802d11:	5b                   	pop    %rbx
+  802d12:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  802d17:	20 72 65             	and    %dh,0x65(%rdx)
+  802d1a:	61                   	(bad)
+  802d1b:	64 20 25 64 20 2d 2d 	and    %ah,%fs:0x2d2d2064(%rip)        # 2dad4d86 <__bss_end+0x2d2ccd86>
+  802d22:	20 62 61             	and    %ah,0x61(%rdx)
+  802d25:	64 20 6d 6f          	and    %ch,%fs:0x6f(%rbp)
+  802d29:	64 65 0a 00          	fs or  %gs:(%rax),%al
+  802d2d:	5b                   	pop    %rbx
+  802d2e:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  802d33:	20 77 72             	and    %dh,0x72(%rdi)
+  802d36:	69 74 65 20 25 64 20 	imul   $0x2d206425,0x20(%rbp,%riz,2),%esi
+  802d3d:	2d 
+  802d3e:	2d 20 62 61 64       	sub    $0x64616220,%eax
+  802d43:	20 6d 6f             	and    %ch,0x6f(%rbp)
+  802d46:	64 65 0a 00          	fs or  %gs:(%rax),%al
+  802d4a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  802d51:	00 00 00 
+  802d54:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  802d5b:	00 00 00 
+  802d5e:	66 90                	xchg   %ax,%ax
+
+0000000000802d60 <devtab>:
+  802d60:	20 40 80 00 00 00 00 00 60 40 80 00 00 00 00 00      @......`@......
+  802d70:	a0 40 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .@..............
+  802d80:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  802d90:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  802da0:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  802db0:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  802dc0:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  802dd0:	3d 20 32 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73 00     = 2.<cons>.cons.
+  802de0:	5b 25 30 38 78 5d 20 75 73 65 72 20 70 61 6e 69     [%08x] user pani
+  802df0:	63 20 69 6e 20 25 73 20 61 74 20 25 73 3a 25 64     c in %s at %s:%d
+  802e00:	3a 20 00 30 31 32 33 34 35 36 37 38 39 41 42 43     : .0123456789ABC
+  802e10:	44 45 46 00 30 31 32 33 34 35 36 37 38 39 61 62     DEF.0123456789ab
+  802e20:	63 64 65 66 00 28 6e 75 6c 6c 29 00 65 72 72 6f     cdef.(null).erro
+  802e30:	72 20 25 64 00 75 6e 73 70 65 63 69 66 69 65 64     r %d.unspecified
+  802e40:	20 65 72 72 6f 72 00 62 61 64 20 65 6e 76 69 72      error.bad envir
+  802e50:	6f 6e 6d 65 6e 74 00 69 6e 76 61 6c 69 64 20 70     onment.invalid p
+  802e60:	61 72 61 6d 65 74 65 72 00 6f 75 74 20 6f 66 20     arameter.out of 
+  802e70:	6d 65 6d 6f 72 79 00 6f 75 74 20 6f 66 20 65 6e     memory.out of en
+  802e80:	76 69 72 6f 6e 6d 65 6e 74 73 00 63 6f 72 72 75     vironments.corru
+  802e90:	70 74 65 64 20 64 65 62 75 67 20 69 6e 66 6f 00     pted debug info.
+  802ea0:	73 65 67 6d 65 6e 74 61 74 69 6f 6e 20 66 61 75     segmentation fau
+  802eb0:	6c 74 00 69 6e 76 61 6c 69 64 20 45 4c 46 20 69     lt.invalid ELF i
+  802ec0:	6d 61 67 65 00 6e 6f 20 73 75 63 68 20 73 79 73     mage.no such sys
+  802ed0:	74 65 6d 20 63 61 6c 6c 00 65 6e 74 72 79 20 6e     tem call.entry n
+  802ee0:	6f 74 20 66 6f 75 6e 64 00 65 6e 76 20 69 73 20     ot found.env is 
+  802ef0:	6e 6f 74 20 72 65 63 76 69 6e 67 00 75 6e 65 78     not recving.unex
+  802f00:	70 65 63 74 65 64 20 65 6e 64 20 6f 66 20 66 69     pected end of fi
+  802f10:	6c 65 00 6e 6f 20 66 72 65 65 20 73 70 61 63 65     le.no free space
+  802f20:	20 6f 6e 20 64 69 73 6b 00 74 6f 6f 20 6d 61 6e      on disk.too man
+  802f30:	79 20 66 69 6c 65 73 20 61 72 65 20 6f 70 65 6e     y files are open
+  802f40:	00 66 69 6c 65 20 6f 72 20 62 6c 6f 63 6b 20 6e     .file or block n
+  802f50:	6f 74 20 66 6f 75 6e 64 00 69 6e 76 61 6c 69 64     ot found.invalid
+  802f60:	20 70 61 74 68 00 66 69 6c 65 20 61 6c 72 65 61      path.file alrea
+  802f70:	64 79 20 65 78 69 73 74 73 00 6f 70 65 72 61 74     dy exists.operat
+  802f80:	69 6f 6e 20 6e 6f 74 20 73 75 70 70 6f 72 74 65     ion not supporte
+  802f90:	64 00 6f 70 65 72 61 74 69 6f 6e 20 69 6e 74 65     d.operation inte
+  802fa0:	72 72 75 70 74 65 64 00 6e 6f 74 20 65 6e 6f 75     rrupted.not enou
+  802fb0:	67 68 20 43 50 55 20 74 69 6d 65 00 0f 1f 40 00     gh CPU time...@.
+  802fc0:	69 1f 80 00 00 00 00 00 aa 25 80 00 00 00 00 00     i........%......
+  802fd0:	9a 25 80 00 00 00 00 00 aa 25 80 00 00 00 00 00     .%.......%......
+  802fe0:	aa 25 80 00 00 00 00 00 aa 25 80 00 00 00 00 00     .%.......%......
+  802ff0:	aa 25 80 00 00 00 00 00 88 1f 80 00 00 00 00 00     .%..............
+  803000:	aa 25 80 00 00 00 00 00 aa 25 80 00 00 00 00 00     .%.......%......
+  803010:	7c 1f 80 00 00 00 00 00 f6 1f 80 00 00 00 00 00     |...............
+  803020:	aa 25 80 00 00 00 00 00 7c 1f 80 00 00 00 00 00     .%......|.......
+  803030:	c2 1f 80 00 00 00 00 00 c2 1f 80 00 00 00 00 00     ................
+  803040:	c2 1f 80 00 00 00 00 00 c2 1f 80 00 00 00 00 00     ................
+  803050:	c2 1f 80 00 00 00 00 00 c2 1f 80 00 00 00 00 00     ................
+  803060:	c2 1f 80 00 00 00 00 00 c2 1f 80 00 00 00 00 00     ................
+  803070:	c2 1f 80 00 00 00 00 00 aa 25 80 00 00 00 00 00     .........%......
+  803080:	aa 25 80 00 00 00 00 00 aa 25 80 00 00 00 00 00     .%.......%......
+  803090:	aa 25 80 00 00 00 00 00 aa 25 80 00 00 00 00 00     .%.......%......
+  8030a0:	aa 25 80 00 00 00 00 00 aa 25 80 00 00 00 00 00     .%.......%......
+  8030b0:	aa 25 80 00 00 00 00 00 aa 25 80 00 00 00 00 00     .%.......%......
+  8030c0:	aa 25 80 00 00 00 00 00 aa 25 80 00 00 00 00 00     .%.......%......
+  8030d0:	aa 25 80 00 00 00 00 00 aa 25 80 00 00 00 00 00     .%.......%......
+  8030e0:	aa 25 80 00 00 00 00 00 aa 25 80 00 00 00 00 00     .%.......%......
+  8030f0:	aa 25 80 00 00 00 00 00 aa 25 80 00 00 00 00 00     .%.......%......
+  803100:	aa 25 80 00 00 00 00 00 aa 25 80 00 00 00 00 00     .%.......%......
+  803110:	aa 25 80 00 00 00 00 00 aa 25 80 00 00 00 00 00     .%.......%......
+  803120:	aa 25 80 00 00 00 00 00 aa 25 80 00 00 00 00 00     .%.......%......
+  803130:	aa 25 80 00 00 00 00 00 aa 25 80 00 00 00 00 00     .%.......%......
+  803140:	aa 25 80 00 00 00 00 00 aa 25 80 00 00 00 00 00     .%.......%......
+  803150:	aa 25 80 00 00 00 00 00 aa 25 80 00 00 00 00 00     .%.......%......
+  803160:	aa 25 80 00 00 00 00 00 cd 24 80 00 00 00 00 00     .%.......$......
+  803170:	aa 25 80 00 00 00 00 00 aa 25 80 00 00 00 00 00     .%.......%......
+  803180:	aa 25 80 00 00 00 00 00 aa 25 80 00 00 00 00 00     .%.......%......
+  803190:	aa 25 80 00 00 00 00 00 aa 25 80 00 00 00 00 00     .%.......%......
+  8031a0:	aa 25 80 00 00 00 00 00 aa 25 80 00 00 00 00 00     .%.......%......
+  8031b0:	aa 25 80 00 00 00 00 00 aa 25 80 00 00 00 00 00     .%.......%......
+  8031c0:	19 20 80 00 00 00 00 00 e8 21 80 00 00 00 00 00     . .......!......
+  8031d0:	aa 25 80 00 00 00 00 00 aa 25 80 00 00 00 00 00     .%.......%......
+  8031e0:	aa 25 80 00 00 00 00 00 aa 25 80 00 00 00 00 00     .%.......%......
+  8031f0:	48 20 80 00 00 00 00 00 aa 25 80 00 00 00 00 00     H .......%......
+  803200:	aa 25 80 00 00 00 00 00 0e 20 80 00 00 00 00 00     .%....... ......
+  803210:	aa 25 80 00 00 00 00 00 aa 25 80 00 00 00 00 00     .%.......%......
+  803220:	90 23 80 00 00 00 00 00 5a 24 80 00 00 00 00 00     .#......Z$......
+  803230:	aa 25 80 00 00 00 00 00 aa 25 80 00 00 00 00 00     .%.......%......
+  803240:	df 20 80 00 00 00 00 00 aa 25 80 00 00 00 00 00     . .......%......
+  803250:	bc 22 80 00 00 00 00 00 aa 25 80 00 00 00 00 00     .".......%......
+  803260:	aa 25 80 00 00 00 00 00 cd 24 80 00 00 00 00 00     .%.......$......
+  803270:	aa 25 80 00 00 00 00 00 72 1f 80 00 00 00 00 00     .%......r.......
+
+0000000000803280 <error_string>:
+	...
+  803288:	35 2e 80 00 00 00 00 00 47 2e 80 00 00 00 00 00     5.......G.......
+  803298:	57 2e 80 00 00 00 00 00 69 2e 80 00 00 00 00 00     W.......i.......
+  8032a8:	77 2e 80 00 00 00 00 00 8b 2e 80 00 00 00 00 00     w...............
+  8032b8:	a0 2e 80 00 00 00 00 00 b3 2e 80 00 00 00 00 00     ................
+  8032c8:	c5 2e 80 00 00 00 00 00 d9 2e 80 00 00 00 00 00     ................
+  8032d8:	e9 2e 80 00 00 00 00 00 fc 2e 80 00 00 00 00 00     ................
+  8032e8:	13 2f 80 00 00 00 00 00 29 2f 80 00 00 00 00 00     ./......)/......
+  8032f8:	41 2f 80 00 00 00 00 00 59 2f 80 00 00 00 00 00     A/......Y/......
+  803308:	66 2f 80 00 00 00 00 00 30 33 80 00 00 00 00 00     f/......03......
+  803318:	7a 2f 80 00 00 00 00 00 92 2f 80 00 00 00 00 00     z/......./......
+  803328:	a8 2f 80 00 00 00 00 00 66 69 6c 65 20 69 73 20     ./......file is 
+  803338:	6e 6f 74 20 61 20 76 61 6c 69 64 20 65 78 65 63     not a valid exec
+  803348:	75 74 61 62 6c 65 00 73 79 73 5f 69 70 63 5f 74     utable.sys_ipc_t
+  803358:	72 79 5f 73 65 6e 64 20 66 61 69 6c 65 64 3a 20     ry_send failed: 
+  803368:	25 69 00 6c 69 62 2f 69 70 63 2e 63 00 66 2e 0f     %i.lib/ipc.c.f..
+  803378:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803388:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803398:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8033a8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8033b8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8033c8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8033d8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8033e8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8033f8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803408:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803418:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803428:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803438:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803448:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803458:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803468:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803478:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803488:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803498:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8034a8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8034b8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8034c8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8034d8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8034e8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8034f8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803508:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803518:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803528:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803538:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803548:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803558:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803568:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803578:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803588:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803598:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8035a8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8035b8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8035c8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8035d8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8035e8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8035f8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803608:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803618:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803628:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803638:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803648:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803658:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803668:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803678:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803688:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803698:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8036a8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8036b8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8036c8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8036d8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8036e8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8036f8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803708:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803718:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803728:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803738:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803748:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803758:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803768:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803778:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803788:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803798:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8037a8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8037b8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8037c8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8037d8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8037e8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8037f8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803808:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803818:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803828:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803838:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803848:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803858:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803868:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803878:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803888:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803898:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8038a8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8038b8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8038c8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8038d8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8038e8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8038f8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803908:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803918:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803928:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803938:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803948:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803958:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803968:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803978:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803988:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803998:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8039a8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8039b8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8039c8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8039d8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8039e8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8039f8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803a08:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803a18:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803a28:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803a38:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803a48:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803a58:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803a68:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803a78:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803a88:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803a98:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803aa8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803ab8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803ac8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803ad8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803ae8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803af8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803b08:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803b18:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803b28:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803b38:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803b48:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803b58:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803b68:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803b78:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803b88:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803b98:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803ba8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803bb8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803bc8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803bd8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803be8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803bf8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803c08:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803c18:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803c28:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803c38:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803c48:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803c58:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803c68:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803c78:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803c88:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803c98:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803ca8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803cb8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803cc8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803cd8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803ce8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803cf8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803d08:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803d18:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803d28:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803d38:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803d48:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803d58:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803d68:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803d78:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803d88:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803d98:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803da8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803db8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803dc8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803dd8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803de8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803df8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803e08:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803e18:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803e28:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803e38:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803e48:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803e58:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803e68:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803e78:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803e88:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803e98:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803ea8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803eb8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803ec8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803ed8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803ee8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803ef8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803f08:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803f18:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803f28:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803f38:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803f48:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803f58:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803f68:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803f78:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803f88:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803f98:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803fa8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803fb8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803fc8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803fd8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803fe8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803ff8:	1f 84 00 00 00 00 00 90                             ........
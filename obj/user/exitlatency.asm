@@ -0,0 +1,6075 @@
+
+obj/user/exitlatency:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 ec 01 00 00       	call   80020f <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+#define REGION_SIZE_MB 1024
+/* Number of yields measured after child exits */
+#define EXIT_SAMPLES 10000
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 57                	push   %r15
+  80002b:	41 56                	push   %r14
+  80002d:	41 55                	push   %r13
+  80002f:	41 54                	push   %r12
+  800031:	53                   	push   %rbx
+  800032:	48 83 ec 08          	sub    $0x8,%rsp
+    size_t size = (argc > 1 ? strtol(argv[1], NULL, 0) : REGION_SIZE_MB) * 1024 * 1024;
+  800036:	41 bf 00 00 00 40    	mov    $0x40000000,%r15d
+  80003c:	83 ff 01             	cmp    $0x1,%edi
+  80003f:	0f 8f ab 00 00 00    	jg     8000f0 <umain+0xcb>
+    uint8_t *buf = (uint8_t *)REGION_BASE;
+
+    envid_t child = fork();
+  800045:	48 b8 3b 17 80 00 00 	movabs $0x80173b,%rax
+  80004c:	00 00 00 
+  80004f:	ff d0                	call   *%rax
+    if (child < 0) panic("fork: %i", child);
+  800051:	85 c0                	test   %eax,%eax
+  800053:	0f 88 bd 00 00 00    	js     800116 <umain+0xf1>
+
+    if (!child) {
+  800059:	0f 85 11 01 00 00    	jne    800170 <umain+0x14b>
+        int res = sys_alloc_region(CURENVID, buf, size, PROT_RW);
+  80005f:	b9 06 00 00 00       	mov    $0x6,%ecx
+  800064:	4c 89 fa             	mov    %r15,%rdx
+  800067:	48 be 00 00 00 00 01 	movabs $0x100000000,%rsi
+  80006e:	00 00 00 
+  800071:	bf 00 00 00 00       	mov    $0x0,%edi
+  800076:	48 b8 00 13 80 00 00 	movabs $0x801300,%rax
+  80007d:	00 00 00 
+  800080:	ff d0                	call   *%rax
+        if (res < 0) panic("sys_alloc_region: %i", res);
+  800082:	85 c0                	test   %eax,%eax
+  800084:	0f 88 b9 00 00 00    	js     800143 <umain+0x11e>
+        for (size_t i = 0; i < size; i += PAGE_SIZE)
+  80008a:	4d 85 ff             	test   %r15,%r15
+  80008d:	74 2b                	je     8000ba <umain+0x95>
+  80008f:	49 8d 57 ff          	lea    -0x1(%r15),%rdx
+  800093:	48 c1 ea 0c          	shr    $0xc,%rdx
+  800097:	48 81 c2 01 00 10 00 	add    $0x100001,%rdx
+  80009e:	48 c1 e2 0c          	shl    $0xc,%rdx
+  8000a2:	48 b8 00 00 00 00 01 	movabs $0x100000000,%rax
+  8000a9:	00 00 00 
+            buf[i] = 1;
+  8000ac:	c6 00 01             	movb   $0x1,(%rax)
+        for (size_t i = 0; i < size; i += PAGE_SIZE)
+  8000af:	48 05 00 10 00 00    	add    $0x1000,%rax
+  8000b5:	48 39 d0             	cmp    %rdx,%rax
+  8000b8:	75 f2                	jne    8000ac <umain+0x87>
+        ipc_send(thisenv->env_parent_id, 0, NULL, 0, 0);
+  8000ba:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  8000c1:	00 00 00 
+  8000c4:	8b b8 e4 00 00 00    	mov    0xe4(%rax),%edi
+  8000ca:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8000d0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8000d5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8000da:	be 00 00 00 00       	mov    $0x0,%esi
+  8000df:	48 b8 74 19 80 00 00 	movabs $0x801974,%rax
+  8000e6:	00 00 00 
+  8000e9:	ff d0                	call   *%rax
+        return;
+  8000eb:	e9 10 01 00 00       	jmp    800200 <umain+0x1db>
+    size_t size = (argc > 1 ? strtol(argv[1], NULL, 0) : REGION_SIZE_MB) * 1024 * 1024;
+  8000f0:	48 8b 7e 08          	mov    0x8(%rsi),%rdi
+  8000f4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8000f9:	be 00 00 00 00       	mov    $0x0,%esi
+  8000fe:	48 b8 c1 10 80 00 00 	movabs $0x8010c1,%rax
+  800105:	00 00 00 
+  800108:	ff d0                	call   *%rax
+  80010a:	48 c1 e0 14          	shl    $0x14,%rax
+  80010e:	49 89 c7             	mov    %rax,%r15
+  800111:	e9 2f ff ff ff       	jmp    800045 <umain+0x20>
+    if (child < 0) panic("fork: %i", child);
+  800116:	89 c1                	mov    %eax,%ecx
+  800118:	48 ba c0 2f 80 00 00 	movabs $0x802fc0,%rdx
+  80011f:	00 00 00 
+  800122:	be 17 00 00 00       	mov    $0x17,%esi
+  800127:	48 bf c9 2f 80 00 00 	movabs $0x802fc9,%rdi
+  80012e:	00 00 00 
+  800131:	b8 00 00 00 00       	mov    $0x0,%eax
+  800136:	49 b8 db 02 80 00 00 	movabs $0x8002db,%r8
+  80013d:	00 00 00 
+  800140:	41 ff d0             	call   *%r8
+        if (res < 0) panic("sys_alloc_region: %i", res);
+  800143:	89 c1                	mov    %eax,%ecx
+  800145:	48 ba dc 2f 80 00 00 	movabs $0x802fdc,%rdx
+  80014c:	00 00 00 
+  80014f:	be 1b 00 00 00       	mov    $0x1b,%esi
+  800154:	48 bf c9 2f 80 00 00 	movabs $0x802fc9,%rdi
+  80015b:	00 00 00 
+  80015e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800163:	49 b8 db 02 80 00 00 	movabs $0x8002db,%r8
+  80016a:	00 00 00 
+  80016d:	41 ff d0             	call   *%r8
+    }
+
+    ipc_recv(NULL, NULL, NULL, NULL);
+  800170:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800175:	ba 00 00 00 00       	mov    $0x0,%edx
+  80017a:	be 00 00 00 00       	mov    $0x0,%esi
+  80017f:	bf 00 00 00 00       	mov    $0x0,%edi
+  800184:	48 b8 9f 18 80 00 00 	movabs $0x80189f,%rax
+  80018b:	00 00 00 
+  80018e:	ff d0                	call   *%rax
+}
+
+static inline uint64_t __attribute__((always_inline))
+read_tsc(void) {
+    uint32_t lo, hi;
+    asm volatile("rdtsc"
+  800190:	0f 31                	rdtsc
+                 : "=a"(lo), "=d"(hi));
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  800192:	48 c1 e2 20          	shl    $0x20,%rdx
+  800196:	89 c0                	mov    %eax,%eax
+  800198:	48 09 c2             	or     %rax,%rdx
+  80019b:	48 89 d3             	mov    %rdx,%rbx
+  80019e:	41 bd 10 27 00 00    	mov    $0x2710,%r13d
+
+    uint64_t max = 0, prev = read_tsc();
+  8001a4:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+    for (size_t i = 0; i < EXIT_SAMPLES; i++) {
+        sys_yield();
+  8001aa:	49 be 71 12 80 00 00 	movabs $0x801271,%r14
+  8001b1:	00 00 00 
+  8001b4:	41 ff d6             	call   *%r14
+    asm volatile("rdtsc"
+  8001b7:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  8001b9:	48 89 d9             	mov    %rbx,%rcx
+  8001bc:	48 c1 e2 20          	shl    $0x20,%rdx
+  8001c0:	89 c0                	mov    %eax,%eax
+  8001c2:	48 89 d3             	mov    %rdx,%rbx
+  8001c5:	48 09 c3             	or     %rax,%rbx
+        uint64_t now = read_tsc();
+        max = MAX(max, now - prev);
+  8001c8:	48 89 d8             	mov    %rbx,%rax
+  8001cb:	48 29 c8             	sub    %rcx,%rax
+  8001ce:	49 39 c4             	cmp    %rax,%r12
+  8001d1:	4c 0f 42 e0          	cmovb  %rax,%r12
+    for (size_t i = 0; i < EXIT_SAMPLES; i++) {
+  8001d5:	49 83 ed 01          	sub    $0x1,%r13
+  8001d9:	75 d9                	jne    8001b4 <umain+0x18f>
+        prev = now;
+    }
+
+    cprintf("exitlatency: %lu MB child exited, longest scheduling gap %lu cycles\n",
+            (unsigned long)(size >> 20), (unsigned long)max);
+  8001db:	4c 89 fe             	mov    %r15,%rsi
+  8001de:	48 c1 ee 14          	shr    $0x14,%rsi
+    cprintf("exitlatency: %lu MB child exited, longest scheduling gap %lu cycles\n",
+  8001e2:	4c 89 e2             	mov    %r12,%rdx
+  8001e5:	48 bf f8 2f 80 00 00 	movabs $0x802ff8,%rdi
+  8001ec:	00 00 00 
+  8001ef:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001f4:	48 b9 2b 04 80 00 00 	movabs $0x80042b,%rcx
+  8001fb:	00 00 00 
+  8001fe:	ff d1                	call   *%rcx
+}
+  800200:	48 83 c4 08          	add    $0x8,%rsp
+  800204:	5b                   	pop    %rbx
+  800205:	41 5c                	pop    %r12
+  800207:	41 5d                	pop    %r13
+  800209:	41 5e                	pop    %r14
+  80020b:	41 5f                	pop    %r15
+  80020d:	5d                   	pop    %rbp
+  80020e:	c3                   	ret
+
+000000000080020f <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  80020f:	55                   	push   %rbp
+  800210:	48 89 e5             	mov    %rsp,%rbp
+  800213:	41 56                	push   %r14
+  800215:	41 55                	push   %r13
+  800217:	41 54                	push   %r12
+  800219:	53                   	push   %rbx
+  80021a:	41 89 fd             	mov    %edi,%r13d
+  80021d:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800220:	48 ba d8 40 80 00 00 	movabs $0x8040d8,%rdx
+  800227:	00 00 00 
+  80022a:	48 b8 d8 40 80 00 00 	movabs $0x8040d8,%rax
+  800231:	00 00 00 
+  800234:	48 39 c2             	cmp    %rax,%rdx
+  800237:	73 17                	jae    800250 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  800239:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  80023c:	49 89 c4             	mov    %rax,%r12
+  80023f:	48 83 c3 08          	add    $0x8,%rbx
+  800243:	b8 00 00 00 00       	mov    $0x0,%eax
+  800248:	ff 53 f8             	call   *-0x8(%rbx)
+  80024b:	4c 39 e3             	cmp    %r12,%rbx
+  80024e:	72 ef                	jb     80023f <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+    envid_t this_env_id = sys_getenvid();
+  800250:	48 b8 40 12 80 00 00 	movabs $0x801240,%rax
+  800257:	00 00 00 
+  80025a:	ff d0                	call   *%rax
+    thisenv = &((struct Env*)UENVS)[ENVX(this_env_id)];
+  80025c:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800261:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+  800268:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  80026f:	00 00 00 
+  800272:	48 01 d0             	add    %rdx,%rax
+  800275:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  80027c:	00 00 00 
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  80027f:	45 85 ed             	test   %r13d,%r13d
+  800282:	7e 0d                	jle    800291 <libmain+0x82>
+  800284:	49 8b 06             	mov    (%r14),%rax
+  800287:	48 a3 00 40 80 00 00 	movabs %rax,0x804000
+  80028e:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  800291:	4c 89 f6             	mov    %r14,%rsi
+  800294:	44 89 ef             	mov    %r13d,%edi
+  800297:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  80029e:	00 00 00 
+  8002a1:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8002a3:	48 b8 b8 02 80 00 00 	movabs $0x8002b8,%rax
+  8002aa:	00 00 00 
+  8002ad:	ff d0                	call   *%rax
+#endif
+}
+  8002af:	5b                   	pop    %rbx
+  8002b0:	41 5c                	pop    %r12
+  8002b2:	41 5d                	pop    %r13
+  8002b4:	41 5e                	pop    %r14
+  8002b6:	5d                   	pop    %rbp
+  8002b7:	c3                   	ret
+
+00000000008002b8 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8002b8:	55                   	push   %rbp
+  8002b9:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  8002bc:	48 b8 c0 1c 80 00 00 	movabs $0x801cc0,%rax
+  8002c3:	00 00 00 
+  8002c6:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  8002c8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8002cd:	48 b8 d5 11 80 00 00 	movabs $0x8011d5,%rax
+  8002d4:	00 00 00 
+  8002d7:	ff d0                	call   *%rax
+}
+  8002d9:	5d                   	pop    %rbp
+  8002da:	c3                   	ret
+
+00000000008002db <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  8002db:	55                   	push   %rbp
+  8002dc:	48 89 e5             	mov    %rsp,%rbp
+  8002df:	41 56                	push   %r14
+  8002e1:	41 55                	push   %r13
+  8002e3:	41 54                	push   %r12
+  8002e5:	53                   	push   %rbx
+  8002e6:	48 83 ec 50          	sub    $0x50,%rsp
+  8002ea:	49 89 fc             	mov    %rdi,%r12
+  8002ed:	41 89 f5             	mov    %esi,%r13d
+  8002f0:	48 89 d3             	mov    %rdx,%rbx
+  8002f3:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  8002f7:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  8002fb:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  8002ff:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  800306:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80030a:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  80030e:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  800312:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  800316:	48 b8 00 40 80 00 00 	movabs $0x804000,%rax
+  80031d:	00 00 00 
+  800320:	4c 8b 30             	mov    (%rax),%r14
+  800323:	48 b8 40 12 80 00 00 	movabs $0x801240,%rax
+  80032a:	00 00 00 
+  80032d:	ff d0                	call   *%rax
+  80032f:	89 c6                	mov    %eax,%esi
+  800331:	45 89 e8             	mov    %r13d,%r8d
+  800334:	4c 89 e1             	mov    %r12,%rcx
+  800337:	4c 89 f2             	mov    %r14,%rdx
+  80033a:	48 bf 48 30 80 00 00 	movabs $0x803048,%rdi
+  800341:	00 00 00 
+  800344:	b8 00 00 00 00       	mov    $0x0,%eax
+  800349:	49 bc 2b 04 80 00 00 	movabs $0x80042b,%r12
+  800350:	00 00 00 
+  800353:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  800356:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  80035a:	48 89 df             	mov    %rbx,%rdi
+  80035d:	48 b8 c7 03 80 00 00 	movabs $0x8003c7,%rax
+  800364:	00 00 00 
+  800367:	ff d0                	call   *%rax
+    cprintf("\n");
+  800369:	48 bf bb 36 80 00 00 	movabs $0x8036bb,%rdi
+  800370:	00 00 00 
+  800373:	b8 00 00 00 00       	mov    $0x0,%eax
+  800378:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  80037b:	cc                   	int3
+  80037c:	eb fd                	jmp    80037b <_panic+0xa0>
+
+000000000080037e <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  80037e:	55                   	push   %rbp
+  80037f:	48 89 e5             	mov    %rsp,%rbp
+  800382:	53                   	push   %rbx
+  800383:	48 83 ec 08          	sub    $0x8,%rsp
+  800387:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  80038a:	8b 06                	mov    (%rsi),%eax
+  80038c:	8d 50 01             	lea    0x1(%rax),%edx
+  80038f:	89 16                	mov    %edx,(%rsi)
+  800391:	48 98                	cltq
+  800393:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  800398:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  80039e:	74 0a                	je     8003aa <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  8003a0:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  8003a4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8003a8:	c9                   	leave
+  8003a9:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  8003aa:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  8003ae:	be ff 00 00 00       	mov    $0xff,%esi
+  8003b3:	48 b8 77 11 80 00 00 	movabs $0x801177,%rax
+  8003ba:	00 00 00 
+  8003bd:	ff d0                	call   *%rax
+        state->offset = 0;
+  8003bf:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  8003c5:	eb d9                	jmp    8003a0 <putch+0x22>
+
+00000000008003c7 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  8003c7:	55                   	push   %rbp
+  8003c8:	48 89 e5             	mov    %rsp,%rbp
+  8003cb:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  8003d2:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  8003d5:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  8003dc:	b9 21 00 00 00       	mov    $0x21,%ecx
+  8003e1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003e6:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  8003e9:	48 89 f1             	mov    %rsi,%rcx
+  8003ec:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  8003f3:	48 bf 7e 03 80 00 00 	movabs $0x80037e,%rdi
+  8003fa:	00 00 00 
+  8003fd:	48 b8 7b 05 80 00 00 	movabs $0x80057b,%rax
+  800404:	00 00 00 
+  800407:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  800409:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  800410:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  800417:	48 b8 77 11 80 00 00 	movabs $0x801177,%rax
+  80041e:	00 00 00 
+  800421:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  800423:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  800429:	c9                   	leave
+  80042a:	c3                   	ret
+
+000000000080042b <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  80042b:	55                   	push   %rbp
+  80042c:	48 89 e5             	mov    %rsp,%rbp
+  80042f:	48 83 ec 50          	sub    $0x50,%rsp
+  800433:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  800437:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  80043b:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80043f:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800443:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  800447:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  80044e:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800452:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800456:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80045a:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  80045e:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  800462:	48 b8 c7 03 80 00 00 	movabs $0x8003c7,%rax
+  800469:	00 00 00 
+  80046c:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  80046e:	c9                   	leave
+  80046f:	c3                   	ret
+
+0000000000800470 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  800470:	55                   	push   %rbp
+  800471:	48 89 e5             	mov    %rsp,%rbp
+  800474:	41 57                	push   %r15
+  800476:	41 56                	push   %r14
+  800478:	41 55                	push   %r13
+  80047a:	41 54                	push   %r12
+  80047c:	53                   	push   %rbx
+  80047d:	48 83 ec 18          	sub    $0x18,%rsp
+  800481:	49 89 fc             	mov    %rdi,%r12
+  800484:	49 89 f5             	mov    %rsi,%r13
+  800487:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  80048b:	8b 45 10             	mov    0x10(%rbp),%eax
+  80048e:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  800491:	41 89 cf             	mov    %ecx,%r15d
+  800494:	4c 39 fa             	cmp    %r15,%rdx
+  800497:	73 5b                	jae    8004f4 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  800499:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  80049d:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  8004a1:	85 db                	test   %ebx,%ebx
+  8004a3:	7e 0e                	jle    8004b3 <print_num+0x43>
+            putch(padc, put_arg);
+  8004a5:	4c 89 ee             	mov    %r13,%rsi
+  8004a8:	44 89 f7             	mov    %r14d,%edi
+  8004ab:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  8004ae:	83 eb 01             	sub    $0x1,%ebx
+  8004b1:	75 f2                	jne    8004a5 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  8004b3:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  8004b7:	48 b9 7c 30 80 00 00 	movabs $0x80307c,%rcx
+  8004be:	00 00 00 
+  8004c1:	48 b8 6b 30 80 00 00 	movabs $0x80306b,%rax
+  8004c8:	00 00 00 
+  8004cb:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  8004cf:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8004d3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8004d8:	49 f7 f7             	div    %r15
+  8004db:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  8004df:	4c 89 ee             	mov    %r13,%rsi
+  8004e2:	41 ff d4             	call   *%r12
+}
+  8004e5:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8004e9:	5b                   	pop    %rbx
+  8004ea:	41 5c                	pop    %r12
+  8004ec:	41 5d                	pop    %r13
+  8004ee:	41 5e                	pop    %r14
+  8004f0:	41 5f                	pop    %r15
+  8004f2:	5d                   	pop    %rbp
+  8004f3:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  8004f4:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8004f8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8004fd:	49 f7 f7             	div    %r15
+  800500:	48 83 ec 08          	sub    $0x8,%rsp
+  800504:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  800508:	52                   	push   %rdx
+  800509:	45 0f be c9          	movsbl %r9b,%r9d
+  80050d:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  800511:	48 89 c2             	mov    %rax,%rdx
+  800514:	48 b8 70 04 80 00 00 	movabs $0x800470,%rax
+  80051b:	00 00 00 
+  80051e:	ff d0                	call   *%rax
+  800520:	48 83 c4 10          	add    $0x10,%rsp
+  800524:	eb 8d                	jmp    8004b3 <print_num+0x43>
+
+0000000000800526 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  800526:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  80052a:	48 8b 06             	mov    (%rsi),%rax
+  80052d:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  800531:	73 0a                	jae    80053d <sprintputch+0x17>
+        *state->start++ = ch;
+  800533:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800537:	48 89 16             	mov    %rdx,(%rsi)
+  80053a:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  80053d:	c3                   	ret
+
+000000000080053e <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  80053e:	55                   	push   %rbp
+  80053f:	48 89 e5             	mov    %rsp,%rbp
+  800542:	48 83 ec 50          	sub    $0x50,%rsp
+  800546:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80054a:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80054e:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  800552:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800559:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80055d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800561:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800565:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  800569:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80056d:	48 b8 7b 05 80 00 00 	movabs $0x80057b,%rax
+  800574:	00 00 00 
+  800577:	ff d0                	call   *%rax
+}
+  800579:	c9                   	leave
+  80057a:	c3                   	ret
+
+000000000080057b <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  80057b:	55                   	push   %rbp
+  80057c:	48 89 e5             	mov    %rsp,%rbp
+  80057f:	41 57                	push   %r15
+  800581:	41 56                	push   %r14
+  800583:	41 55                	push   %r13
+  800585:	41 54                	push   %r12
+  800587:	53                   	push   %rbx
+  800588:	48 83 ec 38          	sub    $0x38,%rsp
+  80058c:	49 89 fe             	mov    %rdi,%r14
+  80058f:	49 89 f5             	mov    %rsi,%r13
+  800592:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  800595:	48 8b 01             	mov    (%rcx),%rax
+  800598:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  80059c:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  8005a0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8005a4:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  8005a8:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  8005ac:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  8005b0:	0f b6 3b             	movzbl (%rbx),%edi
+  8005b3:	40 80 ff 25          	cmp    $0x25,%dil
+  8005b7:	74 18                	je     8005d1 <vprintfmt+0x56>
+            if (!ch) return;
+  8005b9:	40 84 ff             	test   %dil,%dil
+  8005bc:	0f 84 b1 06 00 00    	je     800c73 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  8005c2:	40 0f b6 ff          	movzbl %dil,%edi
+  8005c6:	4c 89 ee             	mov    %r13,%rsi
+  8005c9:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  8005cc:	4c 89 e3             	mov    %r12,%rbx
+  8005cf:	eb db                	jmp    8005ac <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  8005d1:	be 00 00 00 00       	mov    $0x0,%esi
+  8005d6:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  8005da:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  8005df:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8005e5:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  8005ec:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8005f0:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  8005f5:	41 0f b6 04 24       	movzbl (%r12),%eax
+  8005fa:	88 45 a0             	mov    %al,-0x60(%rbp)
+  8005fd:	83 e8 23             	sub    $0x23,%eax
+  800600:	3c 57                	cmp    $0x57,%al
+  800602:	0f 87 51 06 00 00    	ja     800c59 <vprintfmt+0x6de>
+  800608:	0f b6 c0             	movzbl %al,%eax
+  80060b:	48 b9 40 32 80 00 00 	movabs $0x803240,%rcx
+  800612:	00 00 00 
+  800615:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  800618:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  80061b:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  80061f:	eb cf                	jmp    8005f0 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  800621:	49 89 dc             	mov    %rbx,%r12
+  800624:	be 01 00 00 00       	mov    $0x1,%esi
+  800629:	eb c5                	jmp    8005f0 <vprintfmt+0x75>
+            padc = ch;
+  80062b:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  80062f:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800632:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800635:	eb b9                	jmp    8005f0 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800637:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80063a:	83 f8 2f             	cmp    $0x2f,%eax
+  80063d:	77 24                	ja     800663 <vprintfmt+0xe8>
+  80063f:	89 c1                	mov    %eax,%ecx
+  800641:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  800645:	83 c0 08             	add    $0x8,%eax
+  800648:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80064b:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  80064e:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  800651:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800655:	79 99                	jns    8005f0 <vprintfmt+0x75>
+                width = precision;
+  800657:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  80065b:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800661:	eb 8d                	jmp    8005f0 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800663:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  800667:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  80066b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80066f:	eb da                	jmp    80064b <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  800671:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  800676:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  80067a:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  800680:	3c 39                	cmp    $0x39,%al
+  800682:	77 1c                	ja     8006a0 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  800684:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  800688:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  80068c:	0f b6 c0             	movzbl %al,%eax
+  80068f:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800694:	0f b6 03             	movzbl (%rbx),%eax
+  800697:	3c 39                	cmp    $0x39,%al
+  800699:	76 e9                	jbe    800684 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  80069b:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  80069e:	eb b1                	jmp    800651 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  8006a0:	49 89 dc             	mov    %rbx,%r12
+  8006a3:	eb ac                	jmp    800651 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  8006a5:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  8006a8:	85 c9                	test   %ecx,%ecx
+  8006aa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006af:	0f 49 c1             	cmovns %ecx,%eax
+  8006b2:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  8006b5:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8006b8:	e9 33 ff ff ff       	jmp    8005f0 <vprintfmt+0x75>
+            lflag++;
+  8006bd:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  8006c0:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8006c3:	e9 28 ff ff ff       	jmp    8005f0 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  8006c8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006cb:	83 f8 2f             	cmp    $0x2f,%eax
+  8006ce:	77 19                	ja     8006e9 <vprintfmt+0x16e>
+  8006d0:	89 c2                	mov    %eax,%edx
+  8006d2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8006d6:	83 c0 08             	add    $0x8,%eax
+  8006d9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8006dc:	8b 3a                	mov    (%rdx),%edi
+  8006de:	4c 89 ee             	mov    %r13,%rsi
+  8006e1:	41 ff d6             	call   *%r14
+            break;
+  8006e4:	e9 c3 fe ff ff       	jmp    8005ac <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  8006e9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8006ed:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006f1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006f5:	eb e5                	jmp    8006dc <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  8006f7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006fa:	83 f8 2f             	cmp    $0x2f,%eax
+  8006fd:	77 5a                	ja     800759 <vprintfmt+0x1de>
+  8006ff:	89 c2                	mov    %eax,%edx
+  800701:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800705:	83 c0 08             	add    $0x8,%eax
+  800708:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  80070b:	8b 02                	mov    (%rdx),%eax
+  80070d:	89 c1                	mov    %eax,%ecx
+  80070f:	f7 d9                	neg    %ecx
+  800711:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  800714:	83 f9 15             	cmp    $0x15,%ecx
+  800717:	7f 4e                	jg     800767 <vprintfmt+0x1ec>
+  800719:	48 63 c1             	movslq %ecx,%rax
+  80071c:	48 ba 00 35 80 00 00 	movabs $0x803500,%rdx
+  800723:	00 00 00 
+  800726:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80072a:	48 85 c0             	test   %rax,%rax
+  80072d:	74 38                	je     800767 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  80072f:	48 89 c1             	mov    %rax,%rcx
+  800732:	48 ba 19 37 80 00 00 	movabs $0x803719,%rdx
+  800739:	00 00 00 
+  80073c:	4c 89 ee             	mov    %r13,%rsi
+  80073f:	4c 89 f7             	mov    %r14,%rdi
+  800742:	b8 00 00 00 00       	mov    $0x0,%eax
+  800747:	49 b8 3e 05 80 00 00 	movabs $0x80053e,%r8
+  80074e:	00 00 00 
+  800751:	41 ff d0             	call   *%r8
+  800754:	e9 53 fe ff ff       	jmp    8005ac <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  800759:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80075d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800761:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800765:	eb a4                	jmp    80070b <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  800767:	48 ba 94 30 80 00 00 	movabs $0x803094,%rdx
+  80076e:	00 00 00 
+  800771:	4c 89 ee             	mov    %r13,%rsi
+  800774:	4c 89 f7             	mov    %r14,%rdi
+  800777:	b8 00 00 00 00       	mov    $0x0,%eax
+  80077c:	49 b8 3e 05 80 00 00 	movabs $0x80053e,%r8
+  800783:	00 00 00 
+  800786:	41 ff d0             	call   *%r8
+  800789:	e9 1e fe ff ff       	jmp    8005ac <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  80078e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800791:	83 f8 2f             	cmp    $0x2f,%eax
+  800794:	77 6c                	ja     800802 <vprintfmt+0x287>
+  800796:	89 c2                	mov    %eax,%edx
+  800798:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80079c:	83 c0 08             	add    $0x8,%eax
+  80079f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007a2:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  8007a5:	48 85 d2             	test   %rdx,%rdx
+  8007a8:	48 b8 8d 30 80 00 00 	movabs $0x80308d,%rax
+  8007af:	00 00 00 
+  8007b2:	48 0f 45 c2          	cmovne %rdx,%rax
+  8007b6:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  8007ba:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8007be:	7e 06                	jle    8007c6 <vprintfmt+0x24b>
+  8007c0:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  8007c4:	75 4a                	jne    800810 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8007c6:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8007ca:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8007ce:	0f b6 00             	movzbl (%rax),%eax
+  8007d1:	84 c0                	test   %al,%al
+  8007d3:	0f 85 9a 00 00 00    	jne    800873 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  8007d9:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8007dc:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  8007e0:	85 c0                	test   %eax,%eax
+  8007e2:	0f 8e c4 fd ff ff    	jle    8005ac <vprintfmt+0x31>
+  8007e8:	4c 89 ee             	mov    %r13,%rsi
+  8007eb:	bf 20 00 00 00       	mov    $0x20,%edi
+  8007f0:	41 ff d6             	call   *%r14
+  8007f3:	41 83 ec 01          	sub    $0x1,%r12d
+  8007f7:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  8007fb:	75 eb                	jne    8007e8 <vprintfmt+0x26d>
+  8007fd:	e9 aa fd ff ff       	jmp    8005ac <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800802:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800806:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80080a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80080e:	eb 92                	jmp    8007a2 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  800810:	49 63 f7             	movslq %r15d,%rsi
+  800813:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  800817:	48 b8 2d 0d 80 00 00 	movabs $0x800d2d,%rax
+  80081e:	00 00 00 
+  800821:	ff d0                	call   *%rax
+  800823:	48 89 c2             	mov    %rax,%rdx
+  800826:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800829:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  80082b:	8d 70 ff             	lea    -0x1(%rax),%esi
+  80082e:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  800831:	85 c0                	test   %eax,%eax
+  800833:	7e 91                	jle    8007c6 <vprintfmt+0x24b>
+  800835:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  80083a:	4c 89 ee             	mov    %r13,%rsi
+  80083d:	44 89 e7             	mov    %r12d,%edi
+  800840:	41 ff d6             	call   *%r14
+  800843:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800847:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80084a:	83 f8 ff             	cmp    $0xffffffff,%eax
+  80084d:	75 eb                	jne    80083a <vprintfmt+0x2bf>
+  80084f:	e9 72 ff ff ff       	jmp    8007c6 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800854:	0f b6 f8             	movzbl %al,%edi
+  800857:	4c 89 ee             	mov    %r13,%rsi
+  80085a:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  80085d:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800861:	49 83 c4 01          	add    $0x1,%r12
+  800865:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  80086b:	84 c0                	test   %al,%al
+  80086d:	0f 84 66 ff ff ff    	je     8007d9 <vprintfmt+0x25e>
+  800873:	45 85 ff             	test   %r15d,%r15d
+  800876:	78 0a                	js     800882 <vprintfmt+0x307>
+  800878:	41 83 ef 01          	sub    $0x1,%r15d
+  80087c:	0f 88 57 ff ff ff    	js     8007d9 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800882:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  800886:	74 cc                	je     800854 <vprintfmt+0x2d9>
+  800888:	8d 50 e0             	lea    -0x20(%rax),%edx
+  80088b:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800890:	80 fa 5e             	cmp    $0x5e,%dl
+  800893:	77 c2                	ja     800857 <vprintfmt+0x2dc>
+  800895:	eb bd                	jmp    800854 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  800897:	40 84 f6             	test   %sil,%sil
+  80089a:	75 26                	jne    8008c2 <vprintfmt+0x347>
+    switch (lflag) {
+  80089c:	85 d2                	test   %edx,%edx
+  80089e:	74 59                	je     8008f9 <vprintfmt+0x37e>
+  8008a0:	83 fa 01             	cmp    $0x1,%edx
+  8008a3:	74 7b                	je     800920 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  8008a5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008a8:	83 f8 2f             	cmp    $0x2f,%eax
+  8008ab:	0f 87 96 00 00 00    	ja     800947 <vprintfmt+0x3cc>
+  8008b1:	89 c2                	mov    %eax,%edx
+  8008b3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008b7:	83 c0 08             	add    $0x8,%eax
+  8008ba:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008bd:	4c 8b 22             	mov    (%rdx),%r12
+  8008c0:	eb 17                	jmp    8008d9 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  8008c2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008c5:	83 f8 2f             	cmp    $0x2f,%eax
+  8008c8:	77 21                	ja     8008eb <vprintfmt+0x370>
+  8008ca:	89 c2                	mov    %eax,%edx
+  8008cc:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008d0:	83 c0 08             	add    $0x8,%eax
+  8008d3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008d6:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  8008d9:	4d 85 e4             	test   %r12,%r12
+  8008dc:	78 7a                	js     800958 <vprintfmt+0x3dd>
+            num = i;
+  8008de:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  8008e1:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  8008e6:	e9 50 02 00 00       	jmp    800b3b <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8008eb:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008ef:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008f3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008f7:	eb dd                	jmp    8008d6 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  8008f9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008fc:	83 f8 2f             	cmp    $0x2f,%eax
+  8008ff:	77 11                	ja     800912 <vprintfmt+0x397>
+  800901:	89 c2                	mov    %eax,%edx
+  800903:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800907:	83 c0 08             	add    $0x8,%eax
+  80090a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80090d:	4c 63 22             	movslq (%rdx),%r12
+  800910:	eb c7                	jmp    8008d9 <vprintfmt+0x35e>
+  800912:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800916:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80091a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80091e:	eb ed                	jmp    80090d <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  800920:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800923:	83 f8 2f             	cmp    $0x2f,%eax
+  800926:	77 11                	ja     800939 <vprintfmt+0x3be>
+  800928:	89 c2                	mov    %eax,%edx
+  80092a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80092e:	83 c0 08             	add    $0x8,%eax
+  800931:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800934:	4c 8b 22             	mov    (%rdx),%r12
+  800937:	eb a0                	jmp    8008d9 <vprintfmt+0x35e>
+  800939:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80093d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800941:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800945:	eb ed                	jmp    800934 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  800947:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80094b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80094f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800953:	e9 65 ff ff ff       	jmp    8008bd <vprintfmt+0x342>
+                putch('-', put_arg);
+  800958:	4c 89 ee             	mov    %r13,%rsi
+  80095b:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800960:	41 ff d6             	call   *%r14
+                i = -i;
+  800963:	49 f7 dc             	neg    %r12
+  800966:	e9 73 ff ff ff       	jmp    8008de <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  80096b:	40 84 f6             	test   %sil,%sil
+  80096e:	75 32                	jne    8009a2 <vprintfmt+0x427>
+    switch (lflag) {
+  800970:	85 d2                	test   %edx,%edx
+  800972:	74 5d                	je     8009d1 <vprintfmt+0x456>
+  800974:	83 fa 01             	cmp    $0x1,%edx
+  800977:	0f 84 82 00 00 00    	je     8009ff <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  80097d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800980:	83 f8 2f             	cmp    $0x2f,%eax
+  800983:	0f 87 a5 00 00 00    	ja     800a2e <vprintfmt+0x4b3>
+  800989:	89 c2                	mov    %eax,%edx
+  80098b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80098f:	83 c0 08             	add    $0x8,%eax
+  800992:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800995:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800998:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  80099d:	e9 99 01 00 00       	jmp    800b3b <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8009a2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009a5:	83 f8 2f             	cmp    $0x2f,%eax
+  8009a8:	77 19                	ja     8009c3 <vprintfmt+0x448>
+  8009aa:	89 c2                	mov    %eax,%edx
+  8009ac:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009b0:	83 c0 08             	add    $0x8,%eax
+  8009b3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009b6:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8009b9:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8009be:	e9 78 01 00 00       	jmp    800b3b <vprintfmt+0x5c0>
+  8009c3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009c7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009cb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009cf:	eb e5                	jmp    8009b6 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  8009d1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009d4:	83 f8 2f             	cmp    $0x2f,%eax
+  8009d7:	77 18                	ja     8009f1 <vprintfmt+0x476>
+  8009d9:	89 c2                	mov    %eax,%edx
+  8009db:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009df:	83 c0 08             	add    $0x8,%eax
+  8009e2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009e5:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  8009e7:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  8009ec:	e9 4a 01 00 00       	jmp    800b3b <vprintfmt+0x5c0>
+  8009f1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009f5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009f9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009fd:	eb e6                	jmp    8009e5 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  8009ff:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a02:	83 f8 2f             	cmp    $0x2f,%eax
+  800a05:	77 19                	ja     800a20 <vprintfmt+0x4a5>
+  800a07:	89 c2                	mov    %eax,%edx
+  800a09:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a0d:	83 c0 08             	add    $0x8,%eax
+  800a10:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a13:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800a16:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  800a1b:	e9 1b 01 00 00       	jmp    800b3b <vprintfmt+0x5c0>
+  800a20:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a24:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a28:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a2c:	eb e5                	jmp    800a13 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  800a2e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a32:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a36:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a3a:	e9 56 ff ff ff       	jmp    800995 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  800a3f:	40 84 f6             	test   %sil,%sil
+  800a42:	75 2e                	jne    800a72 <vprintfmt+0x4f7>
+    switch (lflag) {
+  800a44:	85 d2                	test   %edx,%edx
+  800a46:	74 59                	je     800aa1 <vprintfmt+0x526>
+  800a48:	83 fa 01             	cmp    $0x1,%edx
+  800a4b:	74 7f                	je     800acc <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  800a4d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a50:	83 f8 2f             	cmp    $0x2f,%eax
+  800a53:	0f 87 9f 00 00 00    	ja     800af8 <vprintfmt+0x57d>
+  800a59:	89 c2                	mov    %eax,%edx
+  800a5b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a5f:	83 c0 08             	add    $0x8,%eax
+  800a62:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a65:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800a68:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  800a6d:	e9 c9 00 00 00       	jmp    800b3b <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800a72:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a75:	83 f8 2f             	cmp    $0x2f,%eax
+  800a78:	77 19                	ja     800a93 <vprintfmt+0x518>
+  800a7a:	89 c2                	mov    %eax,%edx
+  800a7c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a80:	83 c0 08             	add    $0x8,%eax
+  800a83:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a86:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800a89:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800a8e:	e9 a8 00 00 00       	jmp    800b3b <vprintfmt+0x5c0>
+  800a93:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a97:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a9b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a9f:	eb e5                	jmp    800a86 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  800aa1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800aa4:	83 f8 2f             	cmp    $0x2f,%eax
+  800aa7:	77 15                	ja     800abe <vprintfmt+0x543>
+  800aa9:	89 c2                	mov    %eax,%edx
+  800aab:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800aaf:	83 c0 08             	add    $0x8,%eax
+  800ab2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ab5:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  800ab7:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  800abc:	eb 7d                	jmp    800b3b <vprintfmt+0x5c0>
+  800abe:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ac2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ac6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800aca:	eb e9                	jmp    800ab5 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  800acc:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800acf:	83 f8 2f             	cmp    $0x2f,%eax
+  800ad2:	77 16                	ja     800aea <vprintfmt+0x56f>
+  800ad4:	89 c2                	mov    %eax,%edx
+  800ad6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ada:	83 c0 08             	add    $0x8,%eax
+  800add:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ae0:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800ae3:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  800ae8:	eb 51                	jmp    800b3b <vprintfmt+0x5c0>
+  800aea:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800aee:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800af2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800af6:	eb e8                	jmp    800ae0 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  800af8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800afc:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b00:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b04:	e9 5c ff ff ff       	jmp    800a65 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  800b09:	4c 89 ee             	mov    %r13,%rsi
+  800b0c:	bf 30 00 00 00       	mov    $0x30,%edi
+  800b11:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800b14:	4c 89 ee             	mov    %r13,%rsi
+  800b17:	bf 78 00 00 00       	mov    $0x78,%edi
+  800b1c:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800b1f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b22:	83 f8 2f             	cmp    $0x2f,%eax
+  800b25:	77 47                	ja     800b6e <vprintfmt+0x5f3>
+  800b27:	89 c2                	mov    %eax,%edx
+  800b29:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b2d:	83 c0 08             	add    $0x8,%eax
+  800b30:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b33:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800b36:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800b3b:	48 83 ec 08          	sub    $0x8,%rsp
+  800b3f:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800b43:	0f 94 c0             	sete   %al
+  800b46:	0f b6 c0             	movzbl %al,%eax
+  800b49:	50                   	push   %rax
+  800b4a:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800b4f:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800b53:	4c 89 ee             	mov    %r13,%rsi
+  800b56:	4c 89 f7             	mov    %r14,%rdi
+  800b59:	48 b8 70 04 80 00 00 	movabs $0x800470,%rax
+  800b60:	00 00 00 
+  800b63:	ff d0                	call   *%rax
+            break;
+  800b65:	48 83 c4 10          	add    $0x10,%rsp
+  800b69:	e9 3e fa ff ff       	jmp    8005ac <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800b6e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b72:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b76:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b7a:	eb b7                	jmp    800b33 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  800b7c:	40 84 f6             	test   %sil,%sil
+  800b7f:	75 2b                	jne    800bac <vprintfmt+0x631>
+    switch (lflag) {
+  800b81:	85 d2                	test   %edx,%edx
+  800b83:	74 56                	je     800bdb <vprintfmt+0x660>
+  800b85:	83 fa 01             	cmp    $0x1,%edx
+  800b88:	74 7f                	je     800c09 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800b8a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b8d:	83 f8 2f             	cmp    $0x2f,%eax
+  800b90:	0f 87 a2 00 00 00    	ja     800c38 <vprintfmt+0x6bd>
+  800b96:	89 c2                	mov    %eax,%edx
+  800b98:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b9c:	83 c0 08             	add    $0x8,%eax
+  800b9f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ba2:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800ba5:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800baa:	eb 8f                	jmp    800b3b <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800bac:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800baf:	83 f8 2f             	cmp    $0x2f,%eax
+  800bb2:	77 19                	ja     800bcd <vprintfmt+0x652>
+  800bb4:	89 c2                	mov    %eax,%edx
+  800bb6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800bba:	83 c0 08             	add    $0x8,%eax
+  800bbd:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800bc0:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800bc3:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800bc8:	e9 6e ff ff ff       	jmp    800b3b <vprintfmt+0x5c0>
+  800bcd:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bd1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bd5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bd9:	eb e5                	jmp    800bc0 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800bdb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bde:	83 f8 2f             	cmp    $0x2f,%eax
+  800be1:	77 18                	ja     800bfb <vprintfmt+0x680>
+  800be3:	89 c2                	mov    %eax,%edx
+  800be5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800be9:	83 c0 08             	add    $0x8,%eax
+  800bec:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800bef:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800bf1:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800bf6:	e9 40 ff ff ff       	jmp    800b3b <vprintfmt+0x5c0>
+  800bfb:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bff:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c03:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c07:	eb e6                	jmp    800bef <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800c09:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c0c:	83 f8 2f             	cmp    $0x2f,%eax
+  800c0f:	77 19                	ja     800c2a <vprintfmt+0x6af>
+  800c11:	89 c2                	mov    %eax,%edx
+  800c13:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c17:	83 c0 08             	add    $0x8,%eax
+  800c1a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c1d:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800c20:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800c25:	e9 11 ff ff ff       	jmp    800b3b <vprintfmt+0x5c0>
+  800c2a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c2e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c32:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c36:	eb e5                	jmp    800c1d <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800c38:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c3c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c40:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c44:	e9 59 ff ff ff       	jmp    800ba2 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800c49:	4c 89 ee             	mov    %r13,%rsi
+  800c4c:	bf 25 00 00 00       	mov    $0x25,%edi
+  800c51:	41 ff d6             	call   *%r14
+            break;
+  800c54:	e9 53 f9 ff ff       	jmp    8005ac <vprintfmt+0x31>
+            putch('%', put_arg);
+  800c59:	4c 89 ee             	mov    %r13,%rsi
+  800c5c:	bf 25 00 00 00       	mov    $0x25,%edi
+  800c61:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800c64:	48 83 eb 01          	sub    $0x1,%rbx
+  800c68:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800c6c:	75 f6                	jne    800c64 <vprintfmt+0x6e9>
+  800c6e:	e9 39 f9 ff ff       	jmp    8005ac <vprintfmt+0x31>
+}
+  800c73:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800c77:	5b                   	pop    %rbx
+  800c78:	41 5c                	pop    %r12
+  800c7a:	41 5d                	pop    %r13
+  800c7c:	41 5e                	pop    %r14
+  800c7e:	41 5f                	pop    %r15
+  800c80:	5d                   	pop    %rbp
+  800c81:	c3                   	ret
+
+0000000000800c82 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800c82:	55                   	push   %rbp
+  800c83:	48 89 e5             	mov    %rsp,%rbp
+  800c86:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800c8a:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800c8e:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800c93:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800c97:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800c9e:	48 85 ff             	test   %rdi,%rdi
+  800ca1:	74 2b                	je     800cce <vsnprintf+0x4c>
+  800ca3:	48 85 f6             	test   %rsi,%rsi
+  800ca6:	74 26                	je     800cce <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800ca8:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800cac:	48 bf 26 05 80 00 00 	movabs $0x800526,%rdi
+  800cb3:	00 00 00 
+  800cb6:	48 b8 7b 05 80 00 00 	movabs $0x80057b,%rax
+  800cbd:	00 00 00 
+  800cc0:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800cc2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800cc6:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800cc9:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800ccc:	c9                   	leave
+  800ccd:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800cce:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800cd3:	eb f7                	jmp    800ccc <vsnprintf+0x4a>
+
+0000000000800cd5 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800cd5:	55                   	push   %rbp
+  800cd6:	48 89 e5             	mov    %rsp,%rbp
+  800cd9:	48 83 ec 50          	sub    $0x50,%rsp
+  800cdd:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800ce1:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800ce5:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800ce9:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800cf0:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800cf4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800cf8:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800cfc:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800d00:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800d04:	48 b8 82 0c 80 00 00 	movabs $0x800c82,%rax
+  800d0b:	00 00 00 
+  800d0e:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800d10:	c9                   	leave
+  800d11:	c3                   	ret
+
+0000000000800d12 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800d12:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800d15:	74 10                	je     800d27 <strlen+0x15>
+    size_t n = 0;
+  800d17:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800d1c:	48 83 c0 01          	add    $0x1,%rax
+  800d20:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800d24:	75 f6                	jne    800d1c <strlen+0xa>
+  800d26:	c3                   	ret
+    size_t n = 0;
+  800d27:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800d2c:	c3                   	ret
+
+0000000000800d2d <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800d2d:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800d30:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800d35:	48 85 f6             	test   %rsi,%rsi
+  800d38:	74 11                	je     800d4b <strnlen+0x1e>
+  800d3a:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800d3e:	74 0c                	je     800d4c <strnlen+0x1f>
+  800d40:	48 83 c2 01          	add    $0x1,%rdx
+  800d44:	48 39 d0             	cmp    %rdx,%rax
+  800d47:	75 f1                	jne    800d3a <strnlen+0xd>
+  800d49:	eb 04                	jmp    800d4f <strnlen+0x22>
+  800d4b:	c3                   	ret
+  800d4c:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800d4f:	c3                   	ret
+
+0000000000800d50 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800d50:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800d53:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d58:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800d5c:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800d5f:	48 83 c2 01          	add    $0x1,%rdx
+  800d63:	84 c9                	test   %cl,%cl
+  800d65:	75 f1                	jne    800d58 <strcpy+0x8>
+        ;
+    return res;
+}
+  800d67:	c3                   	ret
+
+0000000000800d68 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800d68:	55                   	push   %rbp
+  800d69:	48 89 e5             	mov    %rsp,%rbp
+  800d6c:	41 54                	push   %r12
+  800d6e:	53                   	push   %rbx
+  800d6f:	48 89 fb             	mov    %rdi,%rbx
+  800d72:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800d75:	48 b8 12 0d 80 00 00 	movabs $0x800d12,%rax
+  800d7c:	00 00 00 
+  800d7f:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800d81:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800d85:	4c 89 e6             	mov    %r12,%rsi
+  800d88:	48 b8 50 0d 80 00 00 	movabs $0x800d50,%rax
+  800d8f:	00 00 00 
+  800d92:	ff d0                	call   *%rax
+    return dst;
+}
+  800d94:	48 89 d8             	mov    %rbx,%rax
+  800d97:	5b                   	pop    %rbx
+  800d98:	41 5c                	pop    %r12
+  800d9a:	5d                   	pop    %rbp
+  800d9b:	c3                   	ret
+
+0000000000800d9c <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800d9c:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800d9f:	48 85 d2             	test   %rdx,%rdx
+  800da2:	74 1f                	je     800dc3 <strncpy+0x27>
+  800da4:	48 01 fa             	add    %rdi,%rdx
+  800da7:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800daa:	48 83 c1 01          	add    $0x1,%rcx
+  800dae:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800db2:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800db6:	41 80 f8 01          	cmp    $0x1,%r8b
+  800dba:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800dbe:	48 39 ca             	cmp    %rcx,%rdx
+  800dc1:	75 e7                	jne    800daa <strncpy+0xe>
+    }
+    return ret;
+}
+  800dc3:	c3                   	ret
+
+0000000000800dc4 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800dc4:	48 89 f8             	mov    %rdi,%rax
+  800dc7:	48 85 d2             	test   %rdx,%rdx
+  800dca:	74 24                	je     800df0 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800dcc:	48 83 ea 01          	sub    $0x1,%rdx
+  800dd0:	74 1b                	je     800ded <strlcpy+0x29>
+  800dd2:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800dd6:	0f b6 16             	movzbl (%rsi),%edx
+  800dd9:	84 d2                	test   %dl,%dl
+  800ddb:	74 10                	je     800ded <strlcpy+0x29>
+            *dst++ = *src++;
+  800ddd:	48 83 c6 01          	add    $0x1,%rsi
+  800de1:	48 83 c0 01          	add    $0x1,%rax
+  800de5:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800de8:	48 39 c8             	cmp    %rcx,%rax
+  800deb:	75 e9                	jne    800dd6 <strlcpy+0x12>
+        *dst = '\0';
+  800ded:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800df0:	48 29 f8             	sub    %rdi,%rax
+}
+  800df3:	c3                   	ret
+
+0000000000800df4 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800df4:	0f b6 07             	movzbl (%rdi),%eax
+  800df7:	84 c0                	test   %al,%al
+  800df9:	74 13                	je     800e0e <strcmp+0x1a>
+  800dfb:	38 06                	cmp    %al,(%rsi)
+  800dfd:	75 0f                	jne    800e0e <strcmp+0x1a>
+  800dff:	48 83 c7 01          	add    $0x1,%rdi
+  800e03:	48 83 c6 01          	add    $0x1,%rsi
+  800e07:	0f b6 07             	movzbl (%rdi),%eax
+  800e0a:	84 c0                	test   %al,%al
+  800e0c:	75 ed                	jne    800dfb <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800e0e:	0f b6 c0             	movzbl %al,%eax
+  800e11:	0f b6 16             	movzbl (%rsi),%edx
+  800e14:	29 d0                	sub    %edx,%eax
+}
+  800e16:	c3                   	ret
+
+0000000000800e17 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800e17:	48 85 d2             	test   %rdx,%rdx
+  800e1a:	74 1f                	je     800e3b <strncmp+0x24>
+  800e1c:	0f b6 07             	movzbl (%rdi),%eax
+  800e1f:	84 c0                	test   %al,%al
+  800e21:	74 1e                	je     800e41 <strncmp+0x2a>
+  800e23:	3a 06                	cmp    (%rsi),%al
+  800e25:	75 1a                	jne    800e41 <strncmp+0x2a>
+  800e27:	48 83 c7 01          	add    $0x1,%rdi
+  800e2b:	48 83 c6 01          	add    $0x1,%rsi
+  800e2f:	48 83 ea 01          	sub    $0x1,%rdx
+  800e33:	75 e7                	jne    800e1c <strncmp+0x5>
+
+    if (!n) return 0;
+  800e35:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e3a:	c3                   	ret
+  800e3b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e40:	c3                   	ret
+  800e41:	48 85 d2             	test   %rdx,%rdx
+  800e44:	74 09                	je     800e4f <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800e46:	0f b6 07             	movzbl (%rdi),%eax
+  800e49:	0f b6 16             	movzbl (%rsi),%edx
+  800e4c:	29 d0                	sub    %edx,%eax
+  800e4e:	c3                   	ret
+    if (!n) return 0;
+  800e4f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800e54:	c3                   	ret
+
+0000000000800e55 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800e55:	0f b6 17             	movzbl (%rdi),%edx
+  800e58:	84 d2                	test   %dl,%dl
+  800e5a:	74 18                	je     800e74 <strchr+0x1f>
+        if (*str == c) {
+  800e5c:	0f be d2             	movsbl %dl,%edx
+  800e5f:	39 f2                	cmp    %esi,%edx
+  800e61:	74 17                	je     800e7a <strchr+0x25>
+    for (; *str; str++) {
+  800e63:	48 83 c7 01          	add    $0x1,%rdi
+  800e67:	0f b6 17             	movzbl (%rdi),%edx
+  800e6a:	84 d2                	test   %dl,%dl
+  800e6c:	75 ee                	jne    800e5c <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800e6e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e73:	c3                   	ret
+  800e74:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e79:	c3                   	ret
+  800e7a:	48 89 f8             	mov    %rdi,%rax
+}
+  800e7d:	c3                   	ret
+
+0000000000800e7e <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800e7e:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800e81:	0f b6 17             	movzbl (%rdi),%edx
+  800e84:	84 d2                	test   %dl,%dl
+  800e86:	74 13                	je     800e9b <strfind+0x1d>
+  800e88:	0f be d2             	movsbl %dl,%edx
+  800e8b:	39 f2                	cmp    %esi,%edx
+  800e8d:	74 0b                	je     800e9a <strfind+0x1c>
+  800e8f:	48 83 c0 01          	add    $0x1,%rax
+  800e93:	0f b6 10             	movzbl (%rax),%edx
+  800e96:	84 d2                	test   %dl,%dl
+  800e98:	75 ee                	jne    800e88 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800e9a:	c3                   	ret
+  800e9b:	c3                   	ret
+
+0000000000800e9c <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800e9c:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800e9f:	48 89 f8             	mov    %rdi,%rax
+  800ea2:	48 f7 d8             	neg    %rax
+  800ea5:	83 e0 07             	and    $0x7,%eax
+  800ea8:	49 89 d1             	mov    %rdx,%r9
+  800eab:	49 29 c1             	sub    %rax,%r9
+  800eae:	78 36                	js     800ee6 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800eb0:	40 0f b6 c6          	movzbl %sil,%eax
+  800eb4:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800ebb:	01 01 01 
+  800ebe:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800ec2:	40 f6 c7 07          	test   $0x7,%dil
+  800ec6:	75 38                	jne    800f00 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800ec8:	4c 89 c9             	mov    %r9,%rcx
+  800ecb:	48 c1 f9 03          	sar    $0x3,%rcx
+  800ecf:	74 0c                	je     800edd <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800ed1:	fc                   	cld
+  800ed2:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800ed5:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800ed9:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800edd:	4d 85 c9             	test   %r9,%r9
+  800ee0:	75 45                	jne    800f27 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800ee2:	4c 89 c0             	mov    %r8,%rax
+  800ee5:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800ee6:	48 85 d2             	test   %rdx,%rdx
+  800ee9:	74 f7                	je     800ee2 <memset+0x46>
+  800eeb:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800eee:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800ef1:	48 83 c0 01          	add    $0x1,%rax
+  800ef5:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  800ef9:	48 39 c2             	cmp    %rax,%rdx
+  800efc:	75 f3                	jne    800ef1 <memset+0x55>
+  800efe:	eb e2                	jmp    800ee2 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  800f00:	40 f6 c7 01          	test   $0x1,%dil
+  800f04:	74 06                	je     800f0c <memset+0x70>
+  800f06:	88 07                	mov    %al,(%rdi)
+  800f08:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800f0c:	40 f6 c7 02          	test   $0x2,%dil
+  800f10:	74 07                	je     800f19 <memset+0x7d>
+  800f12:	66 89 07             	mov    %ax,(%rdi)
+  800f15:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800f19:	40 f6 c7 04          	test   $0x4,%dil
+  800f1d:	74 a9                	je     800ec8 <memset+0x2c>
+  800f1f:	89 07                	mov    %eax,(%rdi)
+  800f21:	48 83 c7 04          	add    $0x4,%rdi
+  800f25:	eb a1                	jmp    800ec8 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800f27:	41 f6 c1 04          	test   $0x4,%r9b
+  800f2b:	74 06                	je     800f33 <memset+0x97>
+  800f2d:	89 07                	mov    %eax,(%rdi)
+  800f2f:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800f33:	41 f6 c1 02          	test   $0x2,%r9b
+  800f37:	74 07                	je     800f40 <memset+0xa4>
+  800f39:	66 89 07             	mov    %ax,(%rdi)
+  800f3c:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  800f40:	41 f6 c1 01          	test   $0x1,%r9b
+  800f44:	74 9c                	je     800ee2 <memset+0x46>
+  800f46:	88 07                	mov    %al,(%rdi)
+  800f48:	eb 98                	jmp    800ee2 <memset+0x46>
+
+0000000000800f4a <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  800f4a:	48 89 f8             	mov    %rdi,%rax
+  800f4d:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  800f50:	48 39 fe             	cmp    %rdi,%rsi
+  800f53:	73 3b                	jae    800f90 <memmove+0x46>
+  800f55:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  800f59:	48 39 d7             	cmp    %rdx,%rdi
+  800f5c:	73 32                	jae    800f90 <memmove+0x46>
+        s += n;
+        d += n;
+  800f5e:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800f62:	48 89 d6             	mov    %rdx,%rsi
+  800f65:	48 09 fe             	or     %rdi,%rsi
+  800f68:	48 09 ce             	or     %rcx,%rsi
+  800f6b:	40 f6 c6 07          	test   $0x7,%sil
+  800f6f:	75 12                	jne    800f83 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  800f71:	48 83 ef 08          	sub    $0x8,%rdi
+  800f75:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  800f79:	48 c1 e9 03          	shr    $0x3,%rcx
+  800f7d:	fd                   	std
+  800f7e:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  800f81:	fc                   	cld
+  800f82:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  800f83:	48 83 ef 01          	sub    $0x1,%rdi
+  800f87:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  800f8b:	fd                   	std
+  800f8c:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  800f8e:	eb f1                	jmp    800f81 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800f90:	48 89 f2             	mov    %rsi,%rdx
+  800f93:	48 09 c2             	or     %rax,%rdx
+  800f96:	48 09 ca             	or     %rcx,%rdx
+  800f99:	f6 c2 07             	test   $0x7,%dl
+  800f9c:	75 0c                	jne    800faa <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  800f9e:	48 c1 e9 03          	shr    $0x3,%rcx
+  800fa2:	48 89 c7             	mov    %rax,%rdi
+  800fa5:	fc                   	cld
+  800fa6:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  800fa9:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  800faa:	48 89 c7             	mov    %rax,%rdi
+  800fad:	fc                   	cld
+  800fae:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  800fb0:	c3                   	ret
+
+0000000000800fb1 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  800fb1:	55                   	push   %rbp
+  800fb2:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  800fb5:	48 b8 4a 0f 80 00 00 	movabs $0x800f4a,%rax
+  800fbc:	00 00 00 
+  800fbf:	ff d0                	call   *%rax
+}
+  800fc1:	5d                   	pop    %rbp
+  800fc2:	c3                   	ret
+
+0000000000800fc3 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  800fc3:	55                   	push   %rbp
+  800fc4:	48 89 e5             	mov    %rsp,%rbp
+  800fc7:	41 57                	push   %r15
+  800fc9:	41 56                	push   %r14
+  800fcb:	41 55                	push   %r13
+  800fcd:	41 54                	push   %r12
+  800fcf:	53                   	push   %rbx
+  800fd0:	48 83 ec 08          	sub    $0x8,%rsp
+  800fd4:	49 89 fe             	mov    %rdi,%r14
+  800fd7:	49 89 f7             	mov    %rsi,%r15
+  800fda:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  800fdd:	48 89 f7             	mov    %rsi,%rdi
+  800fe0:	48 b8 12 0d 80 00 00 	movabs $0x800d12,%rax
+  800fe7:	00 00 00 
+  800fea:	ff d0                	call   *%rax
+  800fec:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  800fef:	48 89 de             	mov    %rbx,%rsi
+  800ff2:	4c 89 f7             	mov    %r14,%rdi
+  800ff5:	48 b8 2d 0d 80 00 00 	movabs $0x800d2d,%rax
+  800ffc:	00 00 00 
+  800fff:	ff d0                	call   *%rax
+  801001:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  801004:	48 39 c3             	cmp    %rax,%rbx
+  801007:	74 36                	je     80103f <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  801009:	48 89 d8             	mov    %rbx,%rax
+  80100c:	4c 29 e8             	sub    %r13,%rax
+  80100f:	49 39 c4             	cmp    %rax,%r12
+  801012:	73 31                	jae    801045 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  801014:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  801019:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  80101d:	4c 89 fe             	mov    %r15,%rsi
+  801020:	48 b8 b1 0f 80 00 00 	movabs $0x800fb1,%rax
+  801027:	00 00 00 
+  80102a:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  80102c:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  801030:	48 83 c4 08          	add    $0x8,%rsp
+  801034:	5b                   	pop    %rbx
+  801035:	41 5c                	pop    %r12
+  801037:	41 5d                	pop    %r13
+  801039:	41 5e                	pop    %r14
+  80103b:	41 5f                	pop    %r15
+  80103d:	5d                   	pop    %rbp
+  80103e:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  80103f:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  801043:	eb eb                	jmp    801030 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  801045:	48 83 eb 01          	sub    $0x1,%rbx
+  801049:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  80104d:	48 89 da             	mov    %rbx,%rdx
+  801050:	4c 89 fe             	mov    %r15,%rsi
+  801053:	48 b8 b1 0f 80 00 00 	movabs $0x800fb1,%rax
+  80105a:	00 00 00 
+  80105d:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  80105f:	49 01 de             	add    %rbx,%r14
+  801062:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  801067:	eb c3                	jmp    80102c <strlcat+0x69>
+
+0000000000801069 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  801069:	48 85 d2             	test   %rdx,%rdx
+  80106c:	74 2d                	je     80109b <memcmp+0x32>
+  80106e:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  801073:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  801077:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  80107c:	44 38 c1             	cmp    %r8b,%cl
+  80107f:	75 0f                	jne    801090 <memcmp+0x27>
+    while (n-- > 0) {
+  801081:	48 83 c0 01          	add    $0x1,%rax
+  801085:	48 39 c2             	cmp    %rax,%rdx
+  801088:	75 e9                	jne    801073 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  80108a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80108f:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  801090:	0f b6 c1             	movzbl %cl,%eax
+  801093:	45 0f b6 c0          	movzbl %r8b,%r8d
+  801097:	44 29 c0             	sub    %r8d,%eax
+  80109a:	c3                   	ret
+    return 0;
+  80109b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8010a0:	c3                   	ret
+
+00000000008010a1 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  8010a1:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  8010a5:	48 39 c7             	cmp    %rax,%rdi
+  8010a8:	73 0f                	jae    8010b9 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  8010aa:	40 38 37             	cmp    %sil,(%rdi)
+  8010ad:	74 0e                	je     8010bd <memfind+0x1c>
+    for (; src < end; src++) {
+  8010af:	48 83 c7 01          	add    $0x1,%rdi
+  8010b3:	48 39 f8             	cmp    %rdi,%rax
+  8010b6:	75 f2                	jne    8010aa <memfind+0x9>
+  8010b8:	c3                   	ret
+  8010b9:	48 89 f8             	mov    %rdi,%rax
+  8010bc:	c3                   	ret
+  8010bd:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  8010c0:	c3                   	ret
+
+00000000008010c1 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  8010c1:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  8010c4:	0f b6 37             	movzbl (%rdi),%esi
+  8010c7:	40 80 fe 20          	cmp    $0x20,%sil
+  8010cb:	74 06                	je     8010d3 <strtol+0x12>
+  8010cd:	40 80 fe 09          	cmp    $0x9,%sil
+  8010d1:	75 13                	jne    8010e6 <strtol+0x25>
+  8010d3:	48 83 c7 01          	add    $0x1,%rdi
+  8010d7:	0f b6 37             	movzbl (%rdi),%esi
+  8010da:	40 80 fe 20          	cmp    $0x20,%sil
+  8010de:	74 f3                	je     8010d3 <strtol+0x12>
+  8010e0:	40 80 fe 09          	cmp    $0x9,%sil
+  8010e4:	74 ed                	je     8010d3 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  8010e6:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  8010e9:	83 e0 fd             	and    $0xfffffffd,%eax
+  8010ec:	3c 01                	cmp    $0x1,%al
+  8010ee:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8010f2:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  8010f8:	75 0f                	jne    801109 <strtol+0x48>
+  8010fa:	80 3f 30             	cmpb   $0x30,(%rdi)
+  8010fd:	74 14                	je     801113 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  8010ff:	85 d2                	test   %edx,%edx
+  801101:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801106:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  801109:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  80110e:	4c 63 ca             	movslq %edx,%r9
+  801111:	eb 36                	jmp    801149 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801113:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  801117:	74 0f                	je     801128 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  801119:	85 d2                	test   %edx,%edx
+  80111b:	75 ec                	jne    801109 <strtol+0x48>
+        s++;
+  80111d:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  801121:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  801126:	eb e1                	jmp    801109 <strtol+0x48>
+        s += 2;
+  801128:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  80112c:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  801131:	eb d6                	jmp    801109 <strtol+0x48>
+            dig -= '0';
+  801133:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  801136:	44 0f b6 c1          	movzbl %cl,%r8d
+  80113a:	41 39 d0             	cmp    %edx,%r8d
+  80113d:	7d 21                	jge    801160 <strtol+0x9f>
+        val = val * base + dig;
+  80113f:	49 0f af c1          	imul   %r9,%rax
+  801143:	0f b6 c9             	movzbl %cl,%ecx
+  801146:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  801149:	48 83 c7 01          	add    $0x1,%rdi
+  80114d:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  801151:	80 f9 39             	cmp    $0x39,%cl
+  801154:	76 dd                	jbe    801133 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  801156:	80 f9 7b             	cmp    $0x7b,%cl
+  801159:	77 05                	ja     801160 <strtol+0x9f>
+            dig -= 'a' - 10;
+  80115b:	83 e9 57             	sub    $0x57,%ecx
+  80115e:	eb d6                	jmp    801136 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  801160:	4d 85 d2             	test   %r10,%r10
+  801163:	74 03                	je     801168 <strtol+0xa7>
+  801165:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  801168:	48 89 c2             	mov    %rax,%rdx
+  80116b:	48 f7 da             	neg    %rdx
+  80116e:	40 80 fe 2d          	cmp    $0x2d,%sil
+  801172:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  801176:	c3                   	ret
+
+0000000000801177 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  801177:	55                   	push   %rbp
+  801178:	48 89 e5             	mov    %rsp,%rbp
+  80117b:	53                   	push   %rbx
+  80117c:	48 89 fa             	mov    %rdi,%rdx
+  80117f:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801182:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801187:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80118c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801191:	be 00 00 00 00       	mov    $0x0,%esi
+  801196:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80119c:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  80119e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8011a2:	c9                   	leave
+  8011a3:	c3                   	ret
+
+00000000008011a4 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  8011a4:	55                   	push   %rbp
+  8011a5:	48 89 e5             	mov    %rsp,%rbp
+  8011a8:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8011a9:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8011ae:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011b3:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8011b8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011bd:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8011c2:	be 00 00 00 00       	mov    $0x0,%esi
+  8011c7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8011cd:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  8011cf:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8011d3:	c9                   	leave
+  8011d4:	c3                   	ret
+
+00000000008011d5 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  8011d5:	55                   	push   %rbp
+  8011d6:	48 89 e5             	mov    %rsp,%rbp
+  8011d9:	53                   	push   %rbx
+  8011da:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  8011de:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8011e1:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8011e6:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8011eb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011f0:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8011f5:	be 00 00 00 00       	mov    $0x0,%esi
+  8011fa:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801200:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801202:	48 85 c0             	test   %rax,%rax
+  801205:	7f 06                	jg     80120d <sys_env_destroy+0x38>
+}
+  801207:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80120b:	c9                   	leave
+  80120c:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80120d:	49 89 c0             	mov    %rax,%r8
+  801210:	b9 03 00 00 00       	mov    $0x3,%ecx
+  801215:	48 ba d0 35 80 00 00 	movabs $0x8035d0,%rdx
+  80121c:	00 00 00 
+  80121f:	be 26 00 00 00       	mov    $0x26,%esi
+  801224:	48 bf ef 35 80 00 00 	movabs $0x8035ef,%rdi
+  80122b:	00 00 00 
+  80122e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801233:	49 b9 db 02 80 00 00 	movabs $0x8002db,%r9
+  80123a:	00 00 00 
+  80123d:	41 ff d1             	call   *%r9
+
+0000000000801240 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  801240:	55                   	push   %rbp
+  801241:	48 89 e5             	mov    %rsp,%rbp
+  801244:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801245:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80124a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80124f:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801254:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801259:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80125e:	be 00 00 00 00       	mov    $0x0,%esi
+  801263:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801269:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  80126b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80126f:	c9                   	leave
+  801270:	c3                   	ret
+
+0000000000801271 <sys_yield>:
+
+void
+sys_yield(void) {
+  801271:	55                   	push   %rbp
+  801272:	48 89 e5             	mov    %rsp,%rbp
+  801275:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801276:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80127b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801280:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801285:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80128a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80128f:	be 00 00 00 00       	mov    $0x0,%esi
+  801294:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80129a:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  80129c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012a0:	c9                   	leave
+  8012a1:	c3                   	ret
+
+00000000008012a2 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  8012a2:	55                   	push   %rbp
+  8012a3:	48 89 e5             	mov    %rsp,%rbp
+  8012a6:	53                   	push   %rbx
+  8012a7:	48 89 fa             	mov    %rdi,%rdx
+  8012aa:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8012ad:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8012b2:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  8012b9:	00 00 00 
+  8012bc:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012c1:	be 00 00 00 00       	mov    $0x0,%esi
+  8012c6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8012cc:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  8012ce:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012d2:	c9                   	leave
+  8012d3:	c3                   	ret
+
+00000000008012d4 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  8012d4:	55                   	push   %rbp
+  8012d5:	48 89 e5             	mov    %rsp,%rbp
+  8012d8:	53                   	push   %rbx
+  8012d9:	49 89 f8             	mov    %rdi,%r8
+  8012dc:	48 89 d3             	mov    %rdx,%rbx
+  8012df:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8012e2:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8012e7:	4c 89 c2             	mov    %r8,%rdx
+  8012ea:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012ed:	be 00 00 00 00       	mov    $0x0,%esi
+  8012f2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8012f8:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  8012fa:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012fe:	c9                   	leave
+  8012ff:	c3                   	ret
+
+0000000000801300 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  801300:	55                   	push   %rbp
+  801301:	48 89 e5             	mov    %rsp,%rbp
+  801304:	53                   	push   %rbx
+  801305:	48 83 ec 08          	sub    $0x8,%rsp
+  801309:	89 f8                	mov    %edi,%eax
+  80130b:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  80130e:	48 63 f9             	movslq %ecx,%rdi
+  801311:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801314:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801319:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80131c:	be 00 00 00 00       	mov    $0x0,%esi
+  801321:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801327:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801329:	48 85 c0             	test   %rax,%rax
+  80132c:	7f 06                	jg     801334 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  80132e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801332:	c9                   	leave
+  801333:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801334:	49 89 c0             	mov    %rax,%r8
+  801337:	b9 04 00 00 00       	mov    $0x4,%ecx
+  80133c:	48 ba d0 35 80 00 00 	movabs $0x8035d0,%rdx
+  801343:	00 00 00 
+  801346:	be 26 00 00 00       	mov    $0x26,%esi
+  80134b:	48 bf ef 35 80 00 00 	movabs $0x8035ef,%rdi
+  801352:	00 00 00 
+  801355:	b8 00 00 00 00       	mov    $0x0,%eax
+  80135a:	49 b9 db 02 80 00 00 	movabs $0x8002db,%r9
+  801361:	00 00 00 
+  801364:	41 ff d1             	call   *%r9
+
+0000000000801367 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801367:	55                   	push   %rbp
+  801368:	48 89 e5             	mov    %rsp,%rbp
+  80136b:	53                   	push   %rbx
+  80136c:	48 83 ec 08          	sub    $0x8,%rsp
+  801370:	89 f8                	mov    %edi,%eax
+  801372:	49 89 f2             	mov    %rsi,%r10
+  801375:	48 89 cf             	mov    %rcx,%rdi
+  801378:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  80137b:	48 63 da             	movslq %edx,%rbx
+  80137e:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801381:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801386:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801389:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  80138c:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80138e:	48 85 c0             	test   %rax,%rax
+  801391:	7f 06                	jg     801399 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  801393:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801397:	c9                   	leave
+  801398:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801399:	49 89 c0             	mov    %rax,%r8
+  80139c:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8013a1:	48 ba d0 35 80 00 00 	movabs $0x8035d0,%rdx
+  8013a8:	00 00 00 
+  8013ab:	be 26 00 00 00       	mov    $0x26,%esi
+  8013b0:	48 bf ef 35 80 00 00 	movabs $0x8035ef,%rdi
+  8013b7:	00 00 00 
+  8013ba:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013bf:	49 b9 db 02 80 00 00 	movabs $0x8002db,%r9
+  8013c6:	00 00 00 
+  8013c9:	41 ff d1             	call   *%r9
+
+00000000008013cc <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  8013cc:	55                   	push   %rbp
+  8013cd:	48 89 e5             	mov    %rsp,%rbp
+  8013d0:	53                   	push   %rbx
+  8013d1:	48 83 ec 08          	sub    $0x8,%rsp
+  8013d5:	48 89 f1             	mov    %rsi,%rcx
+  8013d8:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  8013db:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8013de:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8013e3:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013e8:	be 00 00 00 00       	mov    $0x0,%esi
+  8013ed:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013f3:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8013f5:	48 85 c0             	test   %rax,%rax
+  8013f8:	7f 06                	jg     801400 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  8013fa:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013fe:	c9                   	leave
+  8013ff:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801400:	49 89 c0             	mov    %rax,%r8
+  801403:	b9 06 00 00 00       	mov    $0x6,%ecx
+  801408:	48 ba d0 35 80 00 00 	movabs $0x8035d0,%rdx
+  80140f:	00 00 00 
+  801412:	be 26 00 00 00       	mov    $0x26,%esi
+  801417:	48 bf ef 35 80 00 00 	movabs $0x8035ef,%rdi
+  80141e:	00 00 00 
+  801421:	b8 00 00 00 00       	mov    $0x0,%eax
+  801426:	49 b9 db 02 80 00 00 	movabs $0x8002db,%r9
+  80142d:	00 00 00 
+  801430:	41 ff d1             	call   *%r9
+
+0000000000801433 <sys_region_batch>:
+
+int
+sys_region_batch(const struct RegionOp *ops, size_t count) {
+  801433:	55                   	push   %rbp
+  801434:	48 89 e5             	mov    %rsp,%rbp
+  801437:	53                   	push   %rbx
+  801438:	48 83 ec 08          	sub    $0x8,%rsp
+  80143c:	48 89 fa             	mov    %rdi,%rdx
+  80143f:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801442:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801447:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80144c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801451:	be 00 00 00 00       	mov    $0x0,%esi
+  801456:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80145c:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80145e:	48 85 c0             	test   %rax,%rax
+  801461:	7f 06                	jg     801469 <sys_region_batch+0x36>
+        else
+            platform_asan_unpoison(va, ops[i].size);
+    }
+#endif
+    return res;
+}
+  801463:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801467:	c9                   	leave
+  801468:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801469:	49 89 c0             	mov    %rax,%r8
+  80146c:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  801471:	48 ba d0 35 80 00 00 	movabs $0x8035d0,%rdx
+  801478:	00 00 00 
+  80147b:	be 26 00 00 00       	mov    $0x26,%esi
+  801480:	48 bf ef 35 80 00 00 	movabs $0x8035ef,%rdi
+  801487:	00 00 00 
+  80148a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80148f:	49 b9 db 02 80 00 00 	movabs $0x8002db,%r9
+  801496:	00 00 00 
+  801499:	41 ff d1             	call   *%r9
+
+000000000080149c <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  80149c:	55                   	push   %rbp
+  80149d:	48 89 e5             	mov    %rsp,%rbp
+  8014a0:	53                   	push   %rbx
+  8014a1:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  8014a5:	48 63 ce             	movslq %esi,%rcx
+  8014a8:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8014ab:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8014b0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014b5:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014ba:	be 00 00 00 00       	mov    $0x0,%esi
+  8014bf:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014c5:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8014c7:	48 85 c0             	test   %rax,%rax
+  8014ca:	7f 06                	jg     8014d2 <sys_env_set_status+0x36>
+}
+  8014cc:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014d0:	c9                   	leave
+  8014d1:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8014d2:	49 89 c0             	mov    %rax,%r8
+  8014d5:	b9 09 00 00 00       	mov    $0x9,%ecx
+  8014da:	48 ba d0 35 80 00 00 	movabs $0x8035d0,%rdx
+  8014e1:	00 00 00 
+  8014e4:	be 26 00 00 00       	mov    $0x26,%esi
+  8014e9:	48 bf ef 35 80 00 00 	movabs $0x8035ef,%rdi
+  8014f0:	00 00 00 
+  8014f3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014f8:	49 b9 db 02 80 00 00 	movabs $0x8002db,%r9
+  8014ff:	00 00 00 
+  801502:	41 ff d1             	call   *%r9
+
+0000000000801505 <sys_env_set_weight>:
+
+int
+sys_env_set_weight(envid_t envid, uint32_t weight) {
+  801505:	55                   	push   %rbp
+  801506:	48 89 e5             	mov    %rsp,%rbp
+  801509:	53                   	push   %rbx
+  80150a:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_weight, 1, envid, weight, 0, 0, 0, 0);
+  80150e:	89 f1                	mov    %esi,%ecx
+  801510:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801513:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801518:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80151d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801522:	be 00 00 00 00       	mov    $0x0,%esi
+  801527:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80152d:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80152f:	48 85 c0             	test   %rax,%rax
+  801532:	7f 06                	jg     80153a <sys_env_set_weight+0x35>
+}
+  801534:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801538:	c9                   	leave
+  801539:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80153a:	49 89 c0             	mov    %rax,%r8
+  80153d:	b9 10 00 00 00       	mov    $0x10,%ecx
+  801542:	48 ba d0 35 80 00 00 	movabs $0x8035d0,%rdx
+  801549:	00 00 00 
+  80154c:	be 26 00 00 00       	mov    $0x26,%esi
+  801551:	48 bf ef 35 80 00 00 	movabs $0x8035ef,%rdi
+  801558:	00 00 00 
+  80155b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801560:	49 b9 db 02 80 00 00 	movabs $0x8002db,%r9
+  801567:	00 00 00 
+  80156a:	41 ff d1             	call   *%r9
+
+000000000080156d <sys_env_set_rt>:
+
+int
+sys_env_set_rt(envid_t envid, uint64_t period, uint64_t budget, uint64_t deadline) {
+  80156d:	55                   	push   %rbp
+  80156e:	48 89 e5             	mov    %rsp,%rbp
+  801571:	53                   	push   %rbx
+  801572:	48 83 ec 08          	sub    $0x8,%rsp
+  801576:	89 f8                	mov    %edi,%eax
+  801578:	48 89 d3             	mov    %rdx,%rbx
+  80157b:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_env_set_rt, 1, envid, period, budget, deadline, 0, 0);
+  80157e:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801581:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801586:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801589:	be 00 00 00 00       	mov    $0x0,%esi
+  80158e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801594:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801596:	48 85 c0             	test   %rax,%rax
+  801599:	7f 06                	jg     8015a1 <sys_env_set_rt+0x34>
+}
+  80159b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80159f:	c9                   	leave
+  8015a0:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8015a1:	49 89 c0             	mov    %rax,%r8
+  8015a4:	b9 11 00 00 00       	mov    $0x11,%ecx
+  8015a9:	48 ba d0 35 80 00 00 	movabs $0x8035d0,%rdx
+  8015b0:	00 00 00 
+  8015b3:	be 26 00 00 00       	mov    $0x26,%esi
+  8015b8:	48 bf ef 35 80 00 00 	movabs $0x8035ef,%rdi
+  8015bf:	00 00 00 
+  8015c2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015c7:	49 b9 db 02 80 00 00 	movabs $0x8002db,%r9
+  8015ce:	00 00 00 
+  8015d1:	41 ff d1             	call   *%r9
+
+00000000008015d4 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  8015d4:	55                   	push   %rbp
+  8015d5:	48 89 e5             	mov    %rsp,%rbp
+  8015d8:	53                   	push   %rbx
+  8015d9:	48 83 ec 08          	sub    $0x8,%rsp
+  8015dd:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  8015e0:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8015e3:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8015e8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015ed:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015f2:	be 00 00 00 00       	mov    $0x0,%esi
+  8015f7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015fd:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8015ff:	48 85 c0             	test   %rax,%rax
+  801602:	7f 06                	jg     80160a <sys_env_set_trapframe+0x36>
+}
+  801604:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801608:	c9                   	leave
+  801609:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80160a:	49 89 c0             	mov    %rax,%r8
+  80160d:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  801612:	48 ba d0 35 80 00 00 	movabs $0x8035d0,%rdx
+  801619:	00 00 00 
+  80161c:	be 26 00 00 00       	mov    $0x26,%esi
+  801621:	48 bf ef 35 80 00 00 	movabs $0x8035ef,%rdi
+  801628:	00 00 00 
+  80162b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801630:	49 b9 db 02 80 00 00 	movabs $0x8002db,%r9
+  801637:	00 00 00 
+  80163a:	41 ff d1             	call   *%r9
+
+000000000080163d <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  80163d:	55                   	push   %rbp
+  80163e:	48 89 e5             	mov    %rsp,%rbp
+  801641:	53                   	push   %rbx
+  801642:	48 83 ec 08          	sub    $0x8,%rsp
+  801646:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  801649:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80164c:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801651:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801656:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80165b:	be 00 00 00 00       	mov    $0x0,%esi
+  801660:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801666:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801668:	48 85 c0             	test   %rax,%rax
+  80166b:	7f 06                	jg     801673 <sys_env_set_pgfault_upcall+0x36>
+}
+  80166d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801671:	c9                   	leave
+  801672:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801673:	49 89 c0             	mov    %rax,%r8
+  801676:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  80167b:	48 ba d0 35 80 00 00 	movabs $0x8035d0,%rdx
+  801682:	00 00 00 
+  801685:	be 26 00 00 00       	mov    $0x26,%esi
+  80168a:	48 bf ef 35 80 00 00 	movabs $0x8035ef,%rdi
+  801691:	00 00 00 
+  801694:	b8 00 00 00 00       	mov    $0x0,%eax
+  801699:	49 b9 db 02 80 00 00 	movabs $0x8002db,%r9
+  8016a0:	00 00 00 
+  8016a3:	41 ff d1             	call   *%r9
+
+00000000008016a6 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  8016a6:	55                   	push   %rbp
+  8016a7:	48 89 e5             	mov    %rsp,%rbp
+  8016aa:	53                   	push   %rbx
+  8016ab:	89 f8                	mov    %edi,%eax
+  8016ad:	49 89 f1             	mov    %rsi,%r9
+  8016b0:	48 89 d3             	mov    %rdx,%rbx
+  8016b3:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  8016b6:	49 63 f0             	movslq %r8d,%rsi
+  8016b9:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8016bc:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8016c1:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8016c4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8016ca:	cd 30                	int    $0x30
+}
+  8016cc:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8016d0:	c9                   	leave
+  8016d1:	c3                   	ret
+
+00000000008016d2 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  8016d2:	55                   	push   %rbp
+  8016d3:	48 89 e5             	mov    %rsp,%rbp
+  8016d6:	53                   	push   %rbx
+  8016d7:	48 83 ec 08          	sub    $0x8,%rsp
+  8016db:	48 89 fa             	mov    %rdi,%rdx
+  8016de:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8016e1:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8016e6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016eb:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8016f0:	be 00 00 00 00       	mov    $0x0,%esi
+  8016f5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8016fb:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8016fd:	48 85 c0             	test   %rax,%rax
+  801700:	7f 06                	jg     801708 <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801702:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801706:	c9                   	leave
+  801707:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801708:	49 89 c0             	mov    %rax,%r8
+  80170b:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  801710:	48 ba d0 35 80 00 00 	movabs $0x8035d0,%rdx
+  801717:	00 00 00 
+  80171a:	be 26 00 00 00       	mov    $0x26,%esi
+  80171f:	48 bf ef 35 80 00 00 	movabs $0x8035ef,%rdi
+  801726:	00 00 00 
+  801729:	b8 00 00 00 00       	mov    $0x0,%eax
+  80172e:	49 b9 db 02 80 00 00 	movabs $0x8002db,%r9
+  801735:	00 00 00 
+  801738:	41 ff d1             	call   *%r9
+
+000000000080173b <fork>:
+ * Hint:
+ *   Use sys_map_region, it can perform address space copying in one call
+ *   Remember to fix "thisenv" in the child process.
+ */
+envid_t
+fork(void) {
+  80173b:	55                   	push   %rbp
+  80173c:	48 89 e5             	mov    %rsp,%rbp
+  80173f:	41 55                	push   %r13
+  801741:	41 54                	push   %r12
+  801743:	53                   	push   %rbx
+  801744:	48 83 ec 08          	sub    $0x8,%rsp
+
+/* This must be inlined. Exercise for reader: why? */
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+    envid_t ret;
+    asm volatile("int %2"
+  801748:	b8 08 00 00 00       	mov    $0x8,%eax
+  80174d:	cd 30                	int    $0x30
+  80174f:	41 89 c5             	mov    %eax,%r13d
+    // LAB 9: Your code here
+
+    envid_t child_id = sys_exofork();
+    if (child_id < 0) {
+  801752:	85 c0                	test   %eax,%eax
+  801754:	0f 88 ae 00 00 00    	js     801808 <fork+0xcd>
+  80175a:	89 c3                	mov    %eax,%ebx
+        return child_id;
+    }
+    if (child_id == 0) {
+  80175c:	0f 84 b4 00 00 00    	je     801816 <fork+0xdb>
+        thisenv = &envs[ENVX(sys_getenvid())];
+        return 0;
+    }
+    int res = sys_map_region(0, NULL, child_id, NULL, MAX_USER_ADDRESS, PROT_ALL | PROT_LAZY | PROT_COMBINE);
+  801762:	41 b9 df 01 00 00    	mov    $0x1df,%r9d
+  801768:	49 b8 00 00 00 00 80 	movabs $0x8000000000,%r8
+  80176f:	00 00 00 
+  801772:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801777:	89 c2                	mov    %eax,%edx
+  801779:	be 00 00 00 00       	mov    $0x0,%esi
+  80177e:	bf 00 00 00 00       	mov    $0x0,%edi
+  801783:	48 b8 67 13 80 00 00 	movabs $0x801367,%rax
+  80178a:	00 00 00 
+  80178d:	ff d0                	call   *%rax
+  80178f:	41 89 c4             	mov    %eax,%r12d
+    if (res < 0) {
+  801792:	85 c0                	test   %eax,%eax
+  801794:	78 5d                	js     8017f3 <fork+0xb8>
+        goto error;
+    }
+    res = sys_env_set_pgfault_upcall(child_id, envs[ENVX(sys_getenvid())].env_pgfault_upcall);
+  801796:	48 b8 40 12 80 00 00 	movabs $0x801240,%rax
+  80179d:	00 00 00 
+  8017a0:	ff d0                	call   *%rax
+  8017a2:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8017a7:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+  8017ae:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8017b5:	00 00 00 
+  8017b8:	48 01 d0             	add    %rdx,%rax
+  8017bb:	48 8b b0 88 01 00 00 	mov    0x188(%rax),%rsi
+  8017c2:	44 89 ef             	mov    %r13d,%edi
+  8017c5:	48 b8 3d 16 80 00 00 	movabs $0x80163d,%rax
+  8017cc:	00 00 00 
+  8017cf:	ff d0                	call   *%rax
+  8017d1:	41 89 c4             	mov    %eax,%r12d
+    if (res < 0) {
+  8017d4:	85 c0                	test   %eax,%eax
+  8017d6:	78 1b                	js     8017f3 <fork+0xb8>
+        goto error;
+    }
+    res = sys_env_set_status(child_id, ENV_RUNNABLE);
+  8017d8:	be 02 00 00 00       	mov    $0x2,%esi
+  8017dd:	44 89 ef             	mov    %r13d,%edi
+  8017e0:	48 b8 9c 14 80 00 00 	movabs $0x80149c,%rax
+  8017e7:	00 00 00 
+  8017ea:	ff d0                	call   *%rax
+  8017ec:	41 89 c4             	mov    %eax,%r12d
+    if (res < 0) {
+  8017ef:	85 c0                	test   %eax,%eax
+  8017f1:	79 15                	jns    801808 <fork+0xcd>
+        goto error;
+    }
+    return child_id;
+error:
+    ;
+    int res2 = sys_env_destroy(child_id);
+  8017f3:	89 df                	mov    %ebx,%edi
+  8017f5:	48 b8 d5 11 80 00 00 	movabs $0x8011d5,%rax
+  8017fc:	00 00 00 
+  8017ff:	ff d0                	call   *%rax
+    if (res2 < 0) {
+  801801:	85 c0                	test   %eax,%eax
+  801803:	78 42                	js     801847 <fork+0x10c>
+        panic("Fork double fault");
+    }
+    return res;
+  801805:	45 89 e5             	mov    %r12d,%r13d
+}
+  801808:	44 89 e8             	mov    %r13d,%eax
+  80180b:	48 83 c4 08          	add    $0x8,%rsp
+  80180f:	5b                   	pop    %rbx
+  801810:	41 5c                	pop    %r12
+  801812:	41 5d                	pop    %r13
+  801814:	5d                   	pop    %rbp
+  801815:	c3                   	ret
+        thisenv = &envs[ENVX(sys_getenvid())];
+  801816:	48 b8 40 12 80 00 00 	movabs $0x801240,%rax
+  80181d:	00 00 00 
+  801820:	ff d0                	call   *%rax
+  801822:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801827:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+  80182e:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  801835:	00 00 00 
+  801838:	48 01 d0             	add    %rdx,%rax
+  80183b:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  801842:	00 00 00 
+        return 0;
+  801845:	eb c1                	jmp    801808 <fork+0xcd>
+        panic("Fork double fault");
+  801847:	48 ba fd 35 80 00 00 	movabs $0x8035fd,%rdx
+  80184e:	00 00 00 
+  801851:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801856:	48 bf 0f 36 80 00 00 	movabs $0x80360f,%rdi
+  80185d:	00 00 00 
+  801860:	b8 00 00 00 00       	mov    $0x0,%eax
+  801865:	48 b9 db 02 80 00 00 	movabs $0x8002db,%rcx
+  80186c:	00 00 00 
+  80186f:	ff d1                	call   *%rcx
+
+0000000000801871 <sfork>:
+
+envid_t
+sfork() {
+  801871:	55                   	push   %rbp
+  801872:	48 89 e5             	mov    %rsp,%rbp
+    panic("sfork() is not implemented");
+  801875:	48 ba 1a 36 80 00 00 	movabs $0x80361a,%rdx
+  80187c:	00 00 00 
+  80187f:	be 36 00 00 00       	mov    $0x36,%esi
+  801884:	48 bf 0f 36 80 00 00 	movabs $0x80360f,%rdi
+  80188b:	00 00 00 
+  80188e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801893:	48 b9 db 02 80 00 00 	movabs $0x8002db,%rcx
+  80189a:	00 00 00 
+  80189d:	ff d1                	call   *%rcx
+
+000000000080189f <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  80189f:	55                   	push   %rbp
+  8018a0:	48 89 e5             	mov    %rsp,%rbp
+  8018a3:	41 55                	push   %r13
+  8018a5:	41 54                	push   %r12
+  8018a7:	53                   	push   %rbx
+  8018a8:	48 83 ec 08          	sub    $0x8,%rsp
+  8018ac:	49 89 fc             	mov    %rdi,%r12
+  8018af:	48 89 f7             	mov    %rsi,%rdi
+  8018b2:	48 89 d3             	mov    %rdx,%rbx
+  8018b5:	49 89 cd             	mov    %rcx,%r13
+    // LAB 9: Your code here:
+    int res = sys_ipc_recv(!pg ? (void*)MAX_USER_ADDRESS : pg, !size ? 0 : *size);
+  8018b8:	be 00 00 00 00       	mov    $0x0,%esi
+  8018bd:	48 85 d2             	test   %rdx,%rdx
+  8018c0:	74 03                	je     8018c5 <ipc_recv+0x26>
+  8018c2:	48 8b 32             	mov    (%rdx),%rsi
+  8018c5:	48 85 ff             	test   %rdi,%rdi
+  8018c8:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8018cf:	00 00 00 
+  8018d2:	48 0f 44 f8          	cmove  %rax,%rdi
+  8018d6:	48 b8 d2 16 80 00 00 	movabs $0x8016d2,%rax
+  8018dd:	00 00 00 
+  8018e0:	ff d0                	call   *%rax
+    if (res < 0) {
+  8018e2:	85 c0                	test   %eax,%eax
+  8018e4:	78 66                	js     80194c <ipc_recv+0xad>
+        if (size) {
+            *size = 0;
+        }
+        return res;
+    }
+    if (from_env_store) {
+  8018e6:	4d 85 e4             	test   %r12,%r12
+  8018e9:	74 14                	je     8018ff <ipc_recv+0x60>
+        *from_env_store = thisenv->env_ipc_from;
+  8018eb:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  8018f2:	00 00 00 
+  8018f5:	8b 80 ac 01 00 00    	mov    0x1ac(%rax),%eax
+  8018fb:	41 89 04 24          	mov    %eax,(%r12)
+    }
+    if (perm_store) {
+  8018ff:	4d 85 ed             	test   %r13,%r13
+  801902:	74 14                	je     801918 <ipc_recv+0x79>
+        *perm_store = thisenv->env_ipc_perm;
+  801904:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  80190b:	00 00 00 
+  80190e:	8b 80 b0 01 00 00    	mov    0x1b0(%rax),%eax
+  801914:	41 89 45 00          	mov    %eax,0x0(%r13)
+    }
+    if (size) {
+  801918:	48 85 db             	test   %rbx,%rbx
+  80191b:	74 14                	je     801931 <ipc_recv+0x92>
+        *size = thisenv->env_ipc_maxsz;
+  80191d:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801924:	00 00 00 
+  801927:	48 8b 80 a0 01 00 00 	mov    0x1a0(%rax),%rax
+  80192e:	48 89 03             	mov    %rax,(%rbx)
+    }
+    return thisenv->env_ipc_value;
+  801931:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801938:	00 00 00 
+  80193b:	8b 80 a8 01 00 00    	mov    0x1a8(%rax),%eax
+}
+  801941:	48 83 c4 08          	add    $0x8,%rsp
+  801945:	5b                   	pop    %rbx
+  801946:	41 5c                	pop    %r12
+  801948:	41 5d                	pop    %r13
+  80194a:	5d                   	pop    %rbp
+  80194b:	c3                   	ret
+        if (from_env_store) {
+  80194c:	4d 85 e4             	test   %r12,%r12
+  80194f:	74 08                	je     801959 <ipc_recv+0xba>
+            *from_env_store = 0;
+  801951:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  801958:	00 
+        if (perm_store) {
+  801959:	4d 85 ed             	test   %r13,%r13
+  80195c:	74 08                	je     801966 <ipc_recv+0xc7>
+            *perm_store = 0;
+  80195e:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  801965:	00 
+        if (size) {
+  801966:	48 85 db             	test   %rbx,%rbx
+  801969:	74 d6                	je     801941 <ipc_recv+0xa2>
+            *size = 0;
+  80196b:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  801972:	eb cd                	jmp    801941 <ipc_recv+0xa2>
+
+0000000000801974 <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  801974:	55                   	push   %rbp
+  801975:	48 89 e5             	mov    %rsp,%rbp
+  801978:	41 57                	push   %r15
+  80197a:	41 56                	push   %r14
+  80197c:	41 55                	push   %r13
+  80197e:	41 54                	push   %r12
+  801980:	53                   	push   %rbx
+  801981:	48 83 ec 18          	sub    $0x18,%rsp
+  801985:	41 89 fd             	mov    %edi,%r13d
+  801988:	89 75 cc             	mov    %esi,-0x34(%rbp)
+  80198b:	49 89 cc             	mov    %rcx,%r12
+  80198e:	44 89 45 c8          	mov    %r8d,-0x38(%rbp)
+    // LAB 9: Your code here:
+    int res = 0;
+    while ((res = sys_ipc_try_send(to_env, val, !pg ? (void*)MAX_USER_ADDRESS : pg, size, perm)) < 0) {
+  801992:	48 85 d2             	test   %rdx,%rdx
+  801995:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80199c:	00 00 00 
+  80199f:	48 0f 45 c2          	cmovne %rdx,%rax
+  8019a3:	48 89 c3             	mov    %rax,%rbx
+  8019a6:	49 be a6 16 80 00 00 	movabs $0x8016a6,%r14
+  8019ad:	00 00 00 
+        if (res != -E_IPC_NOT_RECV) {
+            panic("sys_ipc_try_send failed: %i", res);
+        }
+        sys_yield();
+  8019b0:	49 bf 71 12 80 00 00 	movabs $0x801271,%r15
+  8019b7:	00 00 00 
+    while ((res = sys_ipc_try_send(to_env, val, !pg ? (void*)MAX_USER_ADDRESS : pg, size, perm)) < 0) {
+  8019ba:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  8019bd:	44 8b 45 c8          	mov    -0x38(%rbp),%r8d
+  8019c1:	4c 89 e1             	mov    %r12,%rcx
+  8019c4:	48 89 da             	mov    %rbx,%rdx
+  8019c7:	44 89 ef             	mov    %r13d,%edi
+  8019ca:	41 ff d6             	call   *%r14
+  8019cd:	85 c0                	test   %eax,%eax
+  8019cf:	79 37                	jns    801a08 <ipc_send+0x94>
+        if (res != -E_IPC_NOT_RECV) {
+  8019d1:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  8019d4:	75 05                	jne    8019db <ipc_send+0x67>
+        sys_yield();
+  8019d6:	41 ff d7             	call   *%r15
+  8019d9:	eb df                	jmp    8019ba <ipc_send+0x46>
+            panic("sys_ipc_try_send failed: %i", res);
+  8019db:	89 c1                	mov    %eax,%ecx
+  8019dd:	48 ba 35 36 80 00 00 	movabs $0x803635,%rdx
+  8019e4:	00 00 00 
+  8019e7:	be 40 00 00 00       	mov    $0x40,%esi
+  8019ec:	48 bf 51 36 80 00 00 	movabs $0x803651,%rdi
+  8019f3:	00 00 00 
+  8019f6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019fb:	49 b8 db 02 80 00 00 	movabs $0x8002db,%r8
+  801a02:	00 00 00 
+  801a05:	41 ff d0             	call   *%r8
+    }
+    return;
+}
+  801a08:	48 83 c4 18          	add    $0x18,%rsp
+  801a0c:	5b                   	pop    %rbx
+  801a0d:	41 5c                	pop    %r12
+  801a0f:	41 5d                	pop    %r13
+  801a11:	41 5e                	pop    %r14
+  801a13:	41 5f                	pop    %r15
+  801a15:	5d                   	pop    %rbp
+  801a16:	c3                   	ret
+
+0000000000801a17 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  801a17:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  801a1c:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  801a23:	00 00 00 
+  801a26:	48 69 d0 d0 01 00 00 	imul   $0x1d0,%rax,%rdx
+  801a2d:	48 01 ca             	add    %rcx,%rdx
+  801a30:	8b 92 e8 00 00 00    	mov    0xe8(%rdx),%edx
+  801a36:	39 fa                	cmp    %edi,%edx
+  801a38:	74 12                	je     801a4c <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  801a3a:	48 83 c0 01          	add    $0x1,%rax
+  801a3e:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  801a44:	75 e0                	jne    801a26 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  801a46:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801a4b:	c3                   	ret
+            return envs[i].env_id;
+  801a4c:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+  801a53:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  801a5a:	00 00 00 
+  801a5d:	48 01 d0             	add    %rdx,%rax
+  801a60:	8b 80 e0 00 00 00    	mov    0xe0(%rax),%eax
+  801a66:	c3                   	ret
+
+0000000000801a67 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801a67:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801a6e:	ff ff ff 
+  801a71:	48 01 f8             	add    %rdi,%rax
+  801a74:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  801a78:	c3                   	ret
+
+0000000000801a79 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801a79:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801a80:	ff ff ff 
+  801a83:	48 01 f8             	add    %rdi,%rax
+  801a86:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  801a8a:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  801a90:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  801a94:	c3                   	ret
+
+0000000000801a95 <fd_alloc_from>:
+}
+
+/* Like fd_alloc(), but only considers fds starting from fdnum,
+ * so that several fds can be found before their pages are allocated */
+int
+fd_alloc_from(int fdnum, struct Fd **fd_store) {
+  801a95:	55                   	push   %rbp
+  801a96:	48 89 e5             	mov    %rsp,%rbp
+  801a99:	41 57                	push   %r15
+  801a9b:	41 56                	push   %r14
+  801a9d:	41 55                	push   %r13
+  801a9f:	41 54                	push   %r12
+  801aa1:	53                   	push   %rbx
+  801aa2:	48 83 ec 08          	sub    $0x8,%rsp
+  801aa6:	49 89 f7             	mov    %rsi,%r15
+    for (int i = MAX(fdnum, 0); i < MAXFD; i++) {
+  801aa9:	85 ff                	test   %edi,%edi
+  801aab:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  801ab1:	44 0f 49 e7          	cmovns %edi,%r12d
+  801ab5:	83 ff 1f             	cmp    $0x1f,%edi
+  801ab8:	7f 37                	jg     801af1 <fd_alloc_from+0x5c>
+  801aba:	49 63 dc             	movslq %r12d,%rbx
+  801abd:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  801ac4:	48 c1 e3 0c          	shl    $0xc,%rbx
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  801ac8:	49 be 9e 2b 80 00 00 	movabs $0x802b9e,%r14
+  801acf:	00 00 00 
+        struct Fd *fd = INDEX2FD(i);
+  801ad2:	49 89 dd             	mov    %rbx,%r13
+        if (!(get_prot(fd) & PROT_R)) {
+  801ad5:	48 89 df             	mov    %rbx,%rdi
+  801ad8:	41 ff d6             	call   *%r14
+  801adb:	83 e0 04             	and    $0x4,%eax
+  801ade:	74 1c                	je     801afc <fd_alloc_from+0x67>
+    for (int i = MAX(fdnum, 0); i < MAXFD; i++) {
+  801ae0:	41 83 c4 01          	add    $0x1,%r12d
+  801ae4:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801aeb:	41 83 fc 1f          	cmp    $0x1f,%r12d
+  801aef:	7e e1                	jle    801ad2 <fd_alloc_from+0x3d>
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  801af1:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801af7:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  801afc:	4d 89 2f             	mov    %r13,(%r15)
+}
+  801aff:	48 83 c4 08          	add    $0x8,%rsp
+  801b03:	5b                   	pop    %rbx
+  801b04:	41 5c                	pop    %r12
+  801b06:	41 5d                	pop    %r13
+  801b08:	41 5e                	pop    %r14
+  801b0a:	41 5f                	pop    %r15
+  801b0c:	5d                   	pop    %rbp
+  801b0d:	c3                   	ret
+
+0000000000801b0e <fd_alloc>:
+fd_alloc(struct Fd **fd_store) {
+  801b0e:	55                   	push   %rbp
+  801b0f:	48 89 e5             	mov    %rsp,%rbp
+  801b12:	48 89 fe             	mov    %rdi,%rsi
+    return fd_alloc_from(0, fd_store);
+  801b15:	bf 00 00 00 00       	mov    $0x0,%edi
+  801b1a:	48 b8 95 1a 80 00 00 	movabs $0x801a95,%rax
+  801b21:	00 00 00 
+  801b24:	ff d0                	call   *%rax
+}
+  801b26:	5d                   	pop    %rbp
+  801b27:	c3                   	ret
+
+0000000000801b28 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  801b28:	83 ff 1f             	cmp    $0x1f,%edi
+  801b2b:	77 39                	ja     801b66 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  801b2d:	55                   	push   %rbp
+  801b2e:	48 89 e5             	mov    %rsp,%rbp
+  801b31:	41 54                	push   %r12
+  801b33:	53                   	push   %rbx
+  801b34:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  801b37:	48 63 df             	movslq %edi,%rbx
+  801b3a:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  801b41:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  801b45:	48 89 df             	mov    %rbx,%rdi
+  801b48:	48 b8 9e 2b 80 00 00 	movabs $0x802b9e,%rax
+  801b4f:	00 00 00 
+  801b52:	ff d0                	call   *%rax
+  801b54:	a8 04                	test   $0x4,%al
+  801b56:	74 14                	je     801b6c <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  801b58:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  801b5c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801b61:	5b                   	pop    %rbx
+  801b62:	41 5c                	pop    %r12
+  801b64:	5d                   	pop    %rbp
+  801b65:	c3                   	ret
+        return -E_INVAL;
+  801b66:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801b6b:	c3                   	ret
+        return -E_INVAL;
+  801b6c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801b71:	eb ee                	jmp    801b61 <fd_lookup+0x39>
+
+0000000000801b73 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  801b73:	55                   	push   %rbp
+  801b74:	48 89 e5             	mov    %rsp,%rbp
+  801b77:	41 54                	push   %r12
+  801b79:	53                   	push   %rbx
+  801b7a:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  801b7d:	48 b8 e0 36 80 00 00 	movabs $0x8036e0,%rax
+  801b84:	00 00 00 
+  801b87:	48 bb 20 40 80 00 00 	movabs $0x804020,%rbx
+  801b8e:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  801b91:	39 3b                	cmp    %edi,(%rbx)
+  801b93:	74 47                	je     801bdc <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  801b95:	48 83 c0 08          	add    $0x8,%rax
+  801b99:	48 8b 18             	mov    (%rax),%rbx
+  801b9c:	48 85 db             	test   %rbx,%rbx
+  801b9f:	75 f0                	jne    801b91 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801ba1:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801ba8:	00 00 00 
+  801bab:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+  801bb1:	89 fa                	mov    %edi,%edx
+  801bb3:	48 bf 60 36 80 00 00 	movabs $0x803660,%rdi
+  801bba:	00 00 00 
+  801bbd:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bc2:	48 b9 2b 04 80 00 00 	movabs $0x80042b,%rcx
+  801bc9:	00 00 00 
+  801bcc:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  801bce:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  801bd3:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  801bd7:	5b                   	pop    %rbx
+  801bd8:	41 5c                	pop    %r12
+  801bda:	5d                   	pop    %rbp
+  801bdb:	c3                   	ret
+            return 0;
+  801bdc:	b8 00 00 00 00       	mov    $0x0,%eax
+  801be1:	eb f0                	jmp    801bd3 <dev_lookup+0x60>
+
+0000000000801be3 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  801be3:	55                   	push   %rbp
+  801be4:	48 89 e5             	mov    %rsp,%rbp
+  801be7:	41 55                	push   %r13
+  801be9:	41 54                	push   %r12
+  801beb:	53                   	push   %rbx
+  801bec:	48 83 ec 18          	sub    $0x18,%rsp
+  801bf0:	48 89 fb             	mov    %rdi,%rbx
+  801bf3:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801bf6:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  801bfd:	ff ff ff 
+  801c00:	48 01 df             	add    %rbx,%rdi
+  801c03:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  801c07:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801c0b:	48 b8 28 1b 80 00 00 	movabs $0x801b28,%rax
+  801c12:	00 00 00 
+  801c15:	ff d0                	call   *%rax
+  801c17:	41 89 c5             	mov    %eax,%r13d
+  801c1a:	85 c0                	test   %eax,%eax
+  801c1c:	78 06                	js     801c24 <fd_close+0x41>
+  801c1e:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  801c22:	74 1a                	je     801c3e <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  801c24:	45 84 e4             	test   %r12b,%r12b
+  801c27:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c2c:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  801c30:	44 89 e8             	mov    %r13d,%eax
+  801c33:	48 83 c4 18          	add    $0x18,%rsp
+  801c37:	5b                   	pop    %rbx
+  801c38:	41 5c                	pop    %r12
+  801c3a:	41 5d                	pop    %r13
+  801c3c:	5d                   	pop    %rbp
+  801c3d:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801c3e:	8b 3b                	mov    (%rbx),%edi
+  801c40:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801c44:	48 b8 73 1b 80 00 00 	movabs $0x801b73,%rax
+  801c4b:	00 00 00 
+  801c4e:	ff d0                	call   *%rax
+  801c50:	41 89 c5             	mov    %eax,%r13d
+  801c53:	85 c0                	test   %eax,%eax
+  801c55:	78 1b                	js     801c72 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  801c57:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801c5b:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801c5f:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801c65:	48 85 c0             	test   %rax,%rax
+  801c68:	74 08                	je     801c72 <fd_close+0x8f>
+  801c6a:	48 89 df             	mov    %rbx,%rdi
+  801c6d:	ff d0                	call   *%rax
+  801c6f:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801c72:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801c77:	48 89 de             	mov    %rbx,%rsi
+  801c7a:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c7f:	48 b8 cc 13 80 00 00 	movabs $0x8013cc,%rax
+  801c86:	00 00 00 
+  801c89:	ff d0                	call   *%rax
+    return res;
+  801c8b:	eb a3                	jmp    801c30 <fd_close+0x4d>
+
+0000000000801c8d <close>:
+
+int
+close(int fdnum) {
+  801c8d:	55                   	push   %rbp
+  801c8e:	48 89 e5             	mov    %rsp,%rbp
+  801c91:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  801c95:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801c99:	48 b8 28 1b 80 00 00 	movabs $0x801b28,%rax
+  801ca0:	00 00 00 
+  801ca3:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801ca5:	85 c0                	test   %eax,%eax
+  801ca7:	78 15                	js     801cbe <close+0x31>
+
+    return fd_close(fd, 1);
+  801ca9:	be 01 00 00 00       	mov    $0x1,%esi
+  801cae:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801cb2:	48 b8 e3 1b 80 00 00 	movabs $0x801be3,%rax
+  801cb9:	00 00 00 
+  801cbc:	ff d0                	call   *%rax
+}
+  801cbe:	c9                   	leave
+  801cbf:	c3                   	ret
+
+0000000000801cc0 <close_all>:
+
+void
+close_all(void) {
+  801cc0:	55                   	push   %rbp
+  801cc1:	48 89 e5             	mov    %rsp,%rbp
+  801cc4:	41 54                	push   %r12
+  801cc6:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  801cc7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801ccc:	49 bc 8d 1c 80 00 00 	movabs $0x801c8d,%r12
+  801cd3:	00 00 00 
+  801cd6:	89 df                	mov    %ebx,%edi
+  801cd8:	41 ff d4             	call   *%r12
+  801cdb:	83 c3 01             	add    $0x1,%ebx
+  801cde:	83 fb 20             	cmp    $0x20,%ebx
+  801ce1:	75 f3                	jne    801cd6 <close_all+0x16>
+}
+  801ce3:	5b                   	pop    %rbx
+  801ce4:	41 5c                	pop    %r12
+  801ce6:	5d                   	pop    %rbp
+  801ce7:	c3                   	ret
+
+0000000000801ce8 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  801ce8:	55                   	push   %rbp
+  801ce9:	48 89 e5             	mov    %rsp,%rbp
+  801cec:	41 57                	push   %r15
+  801cee:	41 56                	push   %r14
+  801cf0:	41 55                	push   %r13
+  801cf2:	41 54                	push   %r12
+  801cf4:	53                   	push   %rbx
+  801cf5:	48 83 ec 18          	sub    $0x18,%rsp
+  801cf9:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  801cfc:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801d00:	48 b8 28 1b 80 00 00 	movabs $0x801b28,%rax
+  801d07:	00 00 00 
+  801d0a:	ff d0                	call   *%rax
+  801d0c:	89 c3                	mov    %eax,%ebx
+  801d0e:	85 c0                	test   %eax,%eax
+  801d10:	0f 88 b8 00 00 00    	js     801dce <dup+0xe6>
+    close(newfdnum);
+  801d16:	44 89 e7             	mov    %r12d,%edi
+  801d19:	48 b8 8d 1c 80 00 00 	movabs $0x801c8d,%rax
+  801d20:	00 00 00 
+  801d23:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  801d25:	4d 63 ec             	movslq %r12d,%r13
+  801d28:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  801d2f:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  801d33:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  801d37:	4c 89 ff             	mov    %r15,%rdi
+  801d3a:	49 be 79 1a 80 00 00 	movabs $0x801a79,%r14
+  801d41:	00 00 00 
+  801d44:	41 ff d6             	call   *%r14
+  801d47:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  801d4a:	4c 89 ef             	mov    %r13,%rdi
+  801d4d:	41 ff d6             	call   *%r14
+  801d50:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  801d53:	48 89 df             	mov    %rbx,%rdi
+  801d56:	48 b8 9e 2b 80 00 00 	movabs $0x802b9e,%rax
+  801d5d:	00 00 00 
+  801d60:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  801d62:	a8 04                	test   $0x4,%al
+  801d64:	74 2b                	je     801d91 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  801d66:	41 89 c1             	mov    %eax,%r9d
+  801d69:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801d6f:	4c 89 f1             	mov    %r14,%rcx
+  801d72:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d77:	48 89 de             	mov    %rbx,%rsi
+  801d7a:	bf 00 00 00 00       	mov    $0x0,%edi
+  801d7f:	48 b8 67 13 80 00 00 	movabs $0x801367,%rax
+  801d86:	00 00 00 
+  801d89:	ff d0                	call   *%rax
+  801d8b:	89 c3                	mov    %eax,%ebx
+  801d8d:	85 c0                	test   %eax,%eax
+  801d8f:	78 4e                	js     801ddf <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  801d91:	4c 89 ff             	mov    %r15,%rdi
+  801d94:	48 b8 9e 2b 80 00 00 	movabs $0x802b9e,%rax
+  801d9b:	00 00 00 
+  801d9e:	ff d0                	call   *%rax
+  801da0:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801da3:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801da9:	4c 89 e9             	mov    %r13,%rcx
+  801dac:	ba 00 00 00 00       	mov    $0x0,%edx
+  801db1:	4c 89 fe             	mov    %r15,%rsi
+  801db4:	bf 00 00 00 00       	mov    $0x0,%edi
+  801db9:	48 b8 67 13 80 00 00 	movabs $0x801367,%rax
+  801dc0:	00 00 00 
+  801dc3:	ff d0                	call   *%rax
+  801dc5:	89 c3                	mov    %eax,%ebx
+  801dc7:	85 c0                	test   %eax,%eax
+  801dc9:	78 14                	js     801ddf <dup+0xf7>
+
+    return newfdnum;
+  801dcb:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  801dce:	89 d8                	mov    %ebx,%eax
+  801dd0:	48 83 c4 18          	add    $0x18,%rsp
+  801dd4:	5b                   	pop    %rbx
+  801dd5:	41 5c                	pop    %r12
+  801dd7:	41 5d                	pop    %r13
+  801dd9:	41 5e                	pop    %r14
+  801ddb:	41 5f                	pop    %r15
+  801ddd:	5d                   	pop    %rbp
+  801dde:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  801ddf:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801de4:	4c 89 ee             	mov    %r13,%rsi
+  801de7:	bf 00 00 00 00       	mov    $0x0,%edi
+  801dec:	49 bc cc 13 80 00 00 	movabs $0x8013cc,%r12
+  801df3:	00 00 00 
+  801df6:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  801df9:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801dfe:	4c 89 f6             	mov    %r14,%rsi
+  801e01:	bf 00 00 00 00       	mov    $0x0,%edi
+  801e06:	41 ff d4             	call   *%r12
+    return res;
+  801e09:	eb c3                	jmp    801dce <dup+0xe6>
+
+0000000000801e0b <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  801e0b:	55                   	push   %rbp
+  801e0c:	48 89 e5             	mov    %rsp,%rbp
+  801e0f:	41 56                	push   %r14
+  801e11:	41 55                	push   %r13
+  801e13:	41 54                	push   %r12
+  801e15:	53                   	push   %rbx
+  801e16:	48 83 ec 10          	sub    $0x10,%rsp
+  801e1a:	89 fb                	mov    %edi,%ebx
+  801e1c:	49 89 f4             	mov    %rsi,%r12
+  801e1f:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801e22:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801e26:	48 b8 28 1b 80 00 00 	movabs $0x801b28,%rax
+  801e2d:	00 00 00 
+  801e30:	ff d0                	call   *%rax
+  801e32:	85 c0                	test   %eax,%eax
+  801e34:	78 4c                	js     801e82 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801e36:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801e3a:	41 8b 3e             	mov    (%r14),%edi
+  801e3d:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801e41:	48 b8 73 1b 80 00 00 	movabs $0x801b73,%rax
+  801e48:	00 00 00 
+  801e4b:	ff d0                	call   *%rax
+  801e4d:	85 c0                	test   %eax,%eax
+  801e4f:	78 35                	js     801e86 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801e51:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801e55:	83 e0 03             	and    $0x3,%eax
+  801e58:	83 f8 01             	cmp    $0x1,%eax
+  801e5b:	74 2d                	je     801e8a <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801e5d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801e61:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801e65:	48 85 c0             	test   %rax,%rax
+  801e68:	74 56                	je     801ec0 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  801e6a:	4c 89 ea             	mov    %r13,%rdx
+  801e6d:	4c 89 e6             	mov    %r12,%rsi
+  801e70:	4c 89 f7             	mov    %r14,%rdi
+  801e73:	ff d0                	call   *%rax
+}
+  801e75:	48 83 c4 10          	add    $0x10,%rsp
+  801e79:	5b                   	pop    %rbx
+  801e7a:	41 5c                	pop    %r12
+  801e7c:	41 5d                	pop    %r13
+  801e7e:	41 5e                	pop    %r14
+  801e80:	5d                   	pop    %rbp
+  801e81:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801e82:	48 98                	cltq
+  801e84:	eb ef                	jmp    801e75 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801e86:	48 98                	cltq
+  801e88:	eb eb                	jmp    801e75 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801e8a:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801e91:	00 00 00 
+  801e94:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+  801e9a:	89 da                	mov    %ebx,%edx
+  801e9c:	48 bf a1 36 80 00 00 	movabs $0x8036a1,%rdi
+  801ea3:	00 00 00 
+  801ea6:	b8 00 00 00 00       	mov    $0x0,%eax
+  801eab:	48 b9 2b 04 80 00 00 	movabs $0x80042b,%rcx
+  801eb2:	00 00 00 
+  801eb5:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801eb7:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801ebe:	eb b5                	jmp    801e75 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801ec0:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801ec7:	eb ac                	jmp    801e75 <read+0x6a>
+
+0000000000801ec9 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801ec9:	55                   	push   %rbp
+  801eca:	48 89 e5             	mov    %rsp,%rbp
+  801ecd:	41 57                	push   %r15
+  801ecf:	41 56                	push   %r14
+  801ed1:	41 55                	push   %r13
+  801ed3:	41 54                	push   %r12
+  801ed5:	53                   	push   %rbx
+  801ed6:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  801eda:	48 85 d2             	test   %rdx,%rdx
+  801edd:	74 54                	je     801f33 <readn+0x6a>
+  801edf:	41 89 fd             	mov    %edi,%r13d
+  801ee2:	49 89 f6             	mov    %rsi,%r14
+  801ee5:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  801ee8:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  801eed:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  801ef2:	49 bf 0b 1e 80 00 00 	movabs $0x801e0b,%r15
+  801ef9:	00 00 00 
+  801efc:	4c 89 e2             	mov    %r12,%rdx
+  801eff:	48 29 f2             	sub    %rsi,%rdx
+  801f02:	4c 01 f6             	add    %r14,%rsi
+  801f05:	44 89 ef             	mov    %r13d,%edi
+  801f08:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  801f0b:	85 c0                	test   %eax,%eax
+  801f0d:	78 20                	js     801f2f <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  801f0f:	01 c3                	add    %eax,%ebx
+  801f11:	85 c0                	test   %eax,%eax
+  801f13:	74 08                	je     801f1d <readn+0x54>
+  801f15:	48 63 f3             	movslq %ebx,%rsi
+  801f18:	4c 39 e6             	cmp    %r12,%rsi
+  801f1b:	72 df                	jb     801efc <readn+0x33>
+    }
+    return res;
+  801f1d:	48 63 c3             	movslq %ebx,%rax
+}
+  801f20:	48 83 c4 08          	add    $0x8,%rsp
+  801f24:	5b                   	pop    %rbx
+  801f25:	41 5c                	pop    %r12
+  801f27:	41 5d                	pop    %r13
+  801f29:	41 5e                	pop    %r14
+  801f2b:	41 5f                	pop    %r15
+  801f2d:	5d                   	pop    %rbp
+  801f2e:	c3                   	ret
+        if (inc < 0) return inc;
+  801f2f:	48 98                	cltq
+  801f31:	eb ed                	jmp    801f20 <readn+0x57>
+    int inc = 1, res = 0;
+  801f33:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801f38:	eb e3                	jmp    801f1d <readn+0x54>
+
+0000000000801f3a <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  801f3a:	55                   	push   %rbp
+  801f3b:	48 89 e5             	mov    %rsp,%rbp
+  801f3e:	41 56                	push   %r14
+  801f40:	41 55                	push   %r13
+  801f42:	41 54                	push   %r12
+  801f44:	53                   	push   %rbx
+  801f45:	48 83 ec 10          	sub    $0x10,%rsp
+  801f49:	89 fb                	mov    %edi,%ebx
+  801f4b:	49 89 f4             	mov    %rsi,%r12
+  801f4e:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801f51:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801f55:	48 b8 28 1b 80 00 00 	movabs $0x801b28,%rax
+  801f5c:	00 00 00 
+  801f5f:	ff d0                	call   *%rax
+  801f61:	85 c0                	test   %eax,%eax
+  801f63:	78 47                	js     801fac <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801f65:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801f69:	41 8b 3e             	mov    (%r14),%edi
+  801f6c:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801f70:	48 b8 73 1b 80 00 00 	movabs $0x801b73,%rax
+  801f77:	00 00 00 
+  801f7a:	ff d0                	call   *%rax
+  801f7c:	85 c0                	test   %eax,%eax
+  801f7e:	78 30                	js     801fb0 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801f80:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  801f85:	74 2d                	je     801fb4 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801f87:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801f8b:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801f8f:	48 85 c0             	test   %rax,%rax
+  801f92:	74 56                	je     801fea <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  801f94:	4c 89 ea             	mov    %r13,%rdx
+  801f97:	4c 89 e6             	mov    %r12,%rsi
+  801f9a:	4c 89 f7             	mov    %r14,%rdi
+  801f9d:	ff d0                	call   *%rax
+}
+  801f9f:	48 83 c4 10          	add    $0x10,%rsp
+  801fa3:	5b                   	pop    %rbx
+  801fa4:	41 5c                	pop    %r12
+  801fa6:	41 5d                	pop    %r13
+  801fa8:	41 5e                	pop    %r14
+  801faa:	5d                   	pop    %rbp
+  801fab:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801fac:	48 98                	cltq
+  801fae:	eb ef                	jmp    801f9f <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801fb0:	48 98                	cltq
+  801fb2:	eb eb                	jmp    801f9f <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801fb4:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801fbb:	00 00 00 
+  801fbe:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+  801fc4:	89 da                	mov    %ebx,%edx
+  801fc6:	48 bf bd 36 80 00 00 	movabs $0x8036bd,%rdi
+  801fcd:	00 00 00 
+  801fd0:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fd5:	48 b9 2b 04 80 00 00 	movabs $0x80042b,%rcx
+  801fdc:	00 00 00 
+  801fdf:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801fe1:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801fe8:	eb b5                	jmp    801f9f <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801fea:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801ff1:	eb ac                	jmp    801f9f <write+0x65>
+
+0000000000801ff3 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  801ff3:	55                   	push   %rbp
+  801ff4:	48 89 e5             	mov    %rsp,%rbp
+  801ff7:	53                   	push   %rbx
+  801ff8:	48 83 ec 18          	sub    $0x18,%rsp
+  801ffc:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801ffe:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802002:	48 b8 28 1b 80 00 00 	movabs $0x801b28,%rax
+  802009:	00 00 00 
+  80200c:	ff d0                	call   *%rax
+  80200e:	85 c0                	test   %eax,%eax
+  802010:	78 0c                	js     80201e <seek+0x2b>
+
+    fd->fd_offset = offset;
+  802012:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802016:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  802019:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80201e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802022:	c9                   	leave
+  802023:	c3                   	ret
+
+0000000000802024 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  802024:	55                   	push   %rbp
+  802025:	48 89 e5             	mov    %rsp,%rbp
+  802028:	41 55                	push   %r13
+  80202a:	41 54                	push   %r12
+  80202c:	53                   	push   %rbx
+  80202d:	48 83 ec 18          	sub    $0x18,%rsp
+  802031:	89 fb                	mov    %edi,%ebx
+  802033:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802036:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80203a:	48 b8 28 1b 80 00 00 	movabs $0x801b28,%rax
+  802041:	00 00 00 
+  802044:	ff d0                	call   *%rax
+  802046:	85 c0                	test   %eax,%eax
+  802048:	78 38                	js     802082 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80204a:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  80204e:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  802052:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802056:	48 b8 73 1b 80 00 00 	movabs $0x801b73,%rax
+  80205d:	00 00 00 
+  802060:	ff d0                	call   *%rax
+  802062:	85 c0                	test   %eax,%eax
+  802064:	78 1c                	js     802082 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802066:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  80206b:	74 20                	je     80208d <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  80206d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802071:	48 8b 40 30          	mov    0x30(%rax),%rax
+  802075:	48 85 c0             	test   %rax,%rax
+  802078:	74 47                	je     8020c1 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  80207a:	44 89 e6             	mov    %r12d,%esi
+  80207d:	4c 89 ef             	mov    %r13,%rdi
+  802080:	ff d0                	call   *%rax
+}
+  802082:	48 83 c4 18          	add    $0x18,%rsp
+  802086:	5b                   	pop    %rbx
+  802087:	41 5c                	pop    %r12
+  802089:	41 5d                	pop    %r13
+  80208b:	5d                   	pop    %rbp
+  80208c:	c3                   	ret
+                thisenv->env_id, fdnum);
+  80208d:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802094:	00 00 00 
+  802097:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  80209d:	89 da                	mov    %ebx,%edx
+  80209f:	48 bf 80 36 80 00 00 	movabs $0x803680,%rdi
+  8020a6:	00 00 00 
+  8020a9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020ae:	48 b9 2b 04 80 00 00 	movabs $0x80042b,%rcx
+  8020b5:	00 00 00 
+  8020b8:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8020ba:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8020bf:	eb c1                	jmp    802082 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  8020c1:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8020c6:	eb ba                	jmp    802082 <ftruncate+0x5e>
+
+00000000008020c8 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  8020c8:	55                   	push   %rbp
+  8020c9:	48 89 e5             	mov    %rsp,%rbp
+  8020cc:	41 54                	push   %r12
+  8020ce:	53                   	push   %rbx
+  8020cf:	48 83 ec 10          	sub    $0x10,%rsp
+  8020d3:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8020d6:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8020da:	48 b8 28 1b 80 00 00 	movabs $0x801b28,%rax
+  8020e1:	00 00 00 
+  8020e4:	ff d0                	call   *%rax
+  8020e6:	85 c0                	test   %eax,%eax
+  8020e8:	78 4e                	js     802138 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8020ea:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  8020ee:	41 8b 3c 24          	mov    (%r12),%edi
+  8020f2:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  8020f6:	48 b8 73 1b 80 00 00 	movabs $0x801b73,%rax
+  8020fd:	00 00 00 
+  802100:	ff d0                	call   *%rax
+  802102:	85 c0                	test   %eax,%eax
+  802104:	78 32                	js     802138 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  802106:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80210a:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  80210f:	74 30                	je     802141 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  802111:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  802114:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  80211b:	00 00 00 
+    stat->st_isdir = 0;
+  80211e:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  802125:	00 00 00 
+    stat->st_dev = dev;
+  802128:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  80212f:	48 89 de             	mov    %rbx,%rsi
+  802132:	4c 89 e7             	mov    %r12,%rdi
+  802135:	ff 50 28             	call   *0x28(%rax)
+}
+  802138:	48 83 c4 10          	add    $0x10,%rsp
+  80213c:	5b                   	pop    %rbx
+  80213d:	41 5c                	pop    %r12
+  80213f:	5d                   	pop    %rbp
+  802140:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  802141:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802146:	eb f0                	jmp    802138 <fstat+0x70>
+
+0000000000802148 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  802148:	55                   	push   %rbp
+  802149:	48 89 e5             	mov    %rsp,%rbp
+  80214c:	41 54                	push   %r12
+  80214e:	53                   	push   %rbx
+  80214f:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  802152:	be 00 00 00 00       	mov    $0x0,%esi
+  802157:	48 b8 2b 25 80 00 00 	movabs $0x80252b,%rax
+  80215e:	00 00 00 
+  802161:	ff d0                	call   *%rax
+  802163:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  802165:	85 c0                	test   %eax,%eax
+  802167:	78 25                	js     80218e <stat+0x46>
+
+    int res = fstat(fd, stat);
+  802169:	4c 89 e6             	mov    %r12,%rsi
+  80216c:	89 c7                	mov    %eax,%edi
+  80216e:	48 b8 c8 20 80 00 00 	movabs $0x8020c8,%rax
+  802175:	00 00 00 
+  802178:	ff d0                	call   *%rax
+  80217a:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  80217d:	89 df                	mov    %ebx,%edi
+  80217f:	48 b8 8d 1c 80 00 00 	movabs $0x801c8d,%rax
+  802186:	00 00 00 
+  802189:	ff d0                	call   *%rax
+
+    return res;
+  80218b:	44 89 e3             	mov    %r12d,%ebx
+}
+  80218e:	89 d8                	mov    %ebx,%eax
+  802190:	5b                   	pop    %rbx
+  802191:	41 5c                	pop    %r12
+  802193:	5d                   	pop    %rbp
+  802194:	c3                   	ret
+
+0000000000802195 <fsipc>:
+ * response may be written back to fsipcbuf.
+ * type: request code, passed as the simple integer IPC value.
+ * dstva: virtual address at which to receive reply page, 0 if none.
+ * Returns result from the file server. */
+static int
+fsipc(unsigned type, void *dstva) {
+  802195:	55                   	push   %rbp
+  802196:	48 89 e5             	mov    %rsp,%rbp
+  802199:	41 54                	push   %r12
+  80219b:	53                   	push   %rbx
+  80219c:	48 83 ec 10          	sub    $0x10,%rsp
+  8021a0:	41 89 fc             	mov    %edi,%r12d
+  8021a3:	48 89 f3             	mov    %rsi,%rbx
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8021a6:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  8021ad:	00 00 00 
+  8021b0:	83 38 00             	cmpl   $0x0,(%rax)
+  8021b3:	74 5e                	je     802213 <fsipc+0x7e>
+    if (debug) {
+        cprintf("[%08x] fsipc %d %08x\n",
+                thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+    }
+
+    ipc_send(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW);
+  8021b5:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8021bb:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8021c0:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  8021c7:	00 00 00 
+  8021ca:	44 89 e6             	mov    %r12d,%esi
+  8021cd:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  8021d4:	00 00 00 
+  8021d7:	8b 38                	mov    (%rax),%edi
+  8021d9:	48 b8 74 19 80 00 00 	movabs $0x801974,%rax
+  8021e0:	00 00 00 
+  8021e3:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  8021e5:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  8021ec:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  8021ed:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8021f2:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  8021f6:	48 89 de             	mov    %rbx,%rsi
+  8021f9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8021fe:	48 b8 9f 18 80 00 00 	movabs $0x80189f,%rax
+  802205:	00 00 00 
+  802208:	ff d0                	call   *%rax
+}
+  80220a:	48 83 c4 10          	add    $0x10,%rsp
+  80220e:	5b                   	pop    %rbx
+  80220f:	41 5c                	pop    %r12
+  802211:	5d                   	pop    %rbp
+  802212:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802213:	bf 03 00 00 00       	mov    $0x3,%edi
+  802218:	48 b8 17 1a 80 00 00 	movabs $0x801a17,%rax
+  80221f:	00 00 00 
+  802222:	ff d0                	call   *%rax
+  802224:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  80222b:	00 00 
+  80222d:	eb 86                	jmp    8021b5 <fsipc+0x20>
+
+000000000080222f <devfile_trunc>:
+    return 0;
+}
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  80222f:	55                   	push   %rbp
+  802230:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802233:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  80223a:	00 00 00 
+  80223d:	8b 57 0c             	mov    0xc(%rdi),%edx
+  802240:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  802242:	89 70 04             	mov    %esi,0x4(%rax)
+
+    return fsipc(FSREQ_SET_SIZE, NULL);
+  802245:	be 00 00 00 00       	mov    $0x0,%esi
+  80224a:	bf 02 00 00 00       	mov    $0x2,%edi
+  80224f:	48 b8 95 21 80 00 00 	movabs $0x802195,%rax
+  802256:	00 00 00 
+  802259:	ff d0                	call   *%rax
+}
+  80225b:	5d                   	pop    %rbp
+  80225c:	c3                   	ret
+
+000000000080225d <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  80225d:	55                   	push   %rbp
+  80225e:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  802261:	8b 47 0c             	mov    0xc(%rdi),%eax
+  802264:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  80226b:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  80226d:	be 00 00 00 00       	mov    $0x0,%esi
+  802272:	bf 06 00 00 00       	mov    $0x6,%edi
+  802277:	48 b8 95 21 80 00 00 	movabs $0x802195,%rax
+  80227e:	00 00 00 
+  802281:	ff d0                	call   *%rax
+}
+  802283:	5d                   	pop    %rbp
+  802284:	c3                   	ret
+
+0000000000802285 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  802285:	55                   	push   %rbp
+  802286:	48 89 e5             	mov    %rsp,%rbp
+  802289:	41 54                	push   %r12
+  80228b:	53                   	push   %rbx
+  80228c:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  80228f:	8b 47 0c             	mov    0xc(%rdi),%eax
+  802292:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  802299:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  80229b:	be 00 00 00 00       	mov    $0x0,%esi
+  8022a0:	bf 05 00 00 00       	mov    $0x5,%edi
+  8022a5:	48 b8 95 21 80 00 00 	movabs $0x802195,%rax
+  8022ac:	00 00 00 
+  8022af:	ff d0                	call   *%rax
+    if (res < 0) {
+  8022b1:	85 c0                	test   %eax,%eax
+  8022b3:	78 3d                	js     8022f2 <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8022b5:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  8022bc:	00 00 00 
+  8022bf:	4c 89 e6             	mov    %r12,%rsi
+  8022c2:	48 89 df             	mov    %rbx,%rdi
+  8022c5:	48 b8 50 0d 80 00 00 	movabs $0x800d50,%rax
+  8022cc:	00 00 00 
+  8022cf:	ff d0                	call   *%rax
+    st->st_size  = fsipcbuf.statRet.ret_size;
+  8022d1:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  8022d8:	00 
+  8022d9:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8022df:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  8022e6:	00 
+  8022e7:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  8022ed:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8022f2:	5b                   	pop    %rbx
+  8022f3:	41 5c                	pop    %r12
+  8022f5:	5d                   	pop    %rbp
+  8022f6:	c3                   	ret
+
+00000000008022f7 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  8022f7:	55                   	push   %rbp
+  8022f8:	48 89 e5             	mov    %rsp,%rbp
+  8022fb:	41 57                	push   %r15
+  8022fd:	41 56                	push   %r14
+  8022ff:	41 55                	push   %r13
+  802301:	41 54                	push   %r12
+  802303:	53                   	push   %rbx
+  802304:	48 83 ec 18          	sub    $0x18,%rsp
+  802308:	49 89 fe             	mov    %rdi,%r14
+  80230b:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+  80230f:	48 89 d3             	mov    %rdx,%rbx
+    while (n > sizeof(fsipcbuf.write.req_buf))
+  802312:	48 81 fa f0 0f 00 00 	cmp    $0xff0,%rdx
+  802319:	0f 86 e4 00 00 00    	jbe    802403 <devfile_write+0x10c>
+  80231f:	49 89 f4             	mov    %rsi,%r12
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802322:	49 bd 00 60 80 00 00 	movabs $0x806000,%r13
+  802329:	00 00 00 
+        memcpy(fsipcbuf.write.req_buf, buf, sizeof(fsipcbuf.write.req_buf));
+  80232c:	49 bf b1 0f 80 00 00 	movabs $0x800fb1,%r15
+  802333:	00 00 00 
+  802336:	eb 03                	jmp    80233b <devfile_write+0x44>
+        buf += sizeof(fsipcbuf.write.req_buf);
+  802338:	49 89 f4             	mov    %rsi,%r12
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  80233b:	41 8b 46 0c          	mov    0xc(%r14),%eax
+  80233f:	41 89 45 00          	mov    %eax,0x0(%r13)
+        fsipcbuf.write.req_n      = sizeof(fsipcbuf.write.req_buf);
+  802343:	49 c7 45 08 f0 0f 00 	movq   $0xff0,0x8(%r13)
+  80234a:	00 
+        memcpy(fsipcbuf.write.req_buf, buf, sizeof(fsipcbuf.write.req_buf));
+  80234b:	ba f0 0f 00 00       	mov    $0xff0,%edx
+  802350:	4c 89 e6             	mov    %r12,%rsi
+  802353:	48 bf 10 60 80 00 00 	movabs $0x806010,%rdi
+  80235a:	00 00 00 
+  80235d:	41 ff d7             	call   *%r15
+        ssize_t res = fsipc(FSREQ_WRITE, NULL);
+  802360:	be 00 00 00 00       	mov    $0x0,%esi
+  802365:	bf 04 00 00 00       	mov    $0x4,%edi
+  80236a:	48 b8 95 21 80 00 00 	movabs $0x802195,%rax
+  802371:	00 00 00 
+  802374:	ff d0                	call   *%rax
+  802376:	48 63 d0             	movslq %eax,%rdx
+        if (res < 0 || res < sizeof(fsipcbuf.write.req_buf))
+  802379:	3d ef 0f 00 00       	cmp    $0xfef,%eax
+  80237e:	7e 71                	jle    8023f1 <devfile_write+0xfa>
+        buf += sizeof(fsipcbuf.write.req_buf);
+  802380:	49 8d b4 24 f0 0f 00 	lea    0xff0(%r12),%rsi
+  802387:	00 
+        n -= sizeof(fsipcbuf.write.req_buf);
+  802388:	48 81 eb f0 0f 00 00 	sub    $0xff0,%rbx
+    while (n > sizeof(fsipcbuf.write.req_buf))
+  80238f:	48 81 fb f0 0f 00 00 	cmp    $0xff0,%rbx
+  802396:	77 a0                	ja     802338 <devfile_write+0x41>
+        written += sizeof(fsipcbuf.write.req_buf);
+  802398:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80239c:	49 29 c4             	sub    %rax,%r12
+  80239f:	4d 8d a4 24 f0 0f 00 	lea    0xff0(%r12),%r12
+  8023a6:	00 
+    fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8023a7:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  8023ae:	00 00 00 
+  8023b1:	41 8b 56 0c          	mov    0xc(%r14),%edx
+  8023b5:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.write.req_n      = n;
+  8023b7:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    memcpy(fsipcbuf.write.req_buf, buf, n);
+  8023bb:	48 89 da             	mov    %rbx,%rdx
+  8023be:	48 8d 78 10          	lea    0x10(%rax),%rdi
+  8023c2:	48 b8 b1 0f 80 00 00 	movabs $0x800fb1,%rax
+  8023c9:	00 00 00 
+  8023cc:	ff d0                	call   *%rax
+    ssize_t res = fsipc(FSREQ_WRITE, NULL);
+  8023ce:	be 00 00 00 00       	mov    $0x0,%esi
+  8023d3:	bf 04 00 00 00       	mov    $0x4,%edi
+  8023d8:	48 b8 95 21 80 00 00 	movabs $0x802195,%rax
+  8023df:	00 00 00 
+  8023e2:	ff d0                	call   *%rax
+  8023e4:	48 63 d0             	movslq %eax,%rdx
+    written += res;
+  8023e7:	49 01 d4             	add    %rdx,%r12
+  8023ea:	48 85 d2             	test   %rdx,%rdx
+  8023ed:	49 0f 49 d4          	cmovns %r12,%rdx
+}
+  8023f1:	48 89 d0             	mov    %rdx,%rax
+  8023f4:	48 83 c4 18          	add    $0x18,%rsp
+  8023f8:	5b                   	pop    %rbx
+  8023f9:	41 5c                	pop    %r12
+  8023fb:	41 5d                	pop    %r13
+  8023fd:	41 5e                	pop    %r14
+  8023ff:	41 5f                	pop    %r15
+  802401:	5d                   	pop    %rbp
+  802402:	c3                   	ret
+    while (n > sizeof(fsipcbuf.write.req_buf))
+  802403:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+    ssize_t written = 0;
+  802407:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80240d:	eb 98                	jmp    8023a7 <devfile_write+0xb0>
+
+000000000080240f <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  80240f:	55                   	push   %rbp
+  802410:	48 89 e5             	mov    %rsp,%rbp
+  802413:	41 57                	push   %r15
+  802415:	41 56                	push   %r14
+  802417:	41 55                	push   %r13
+  802419:	41 54                	push   %r12
+  80241b:	53                   	push   %rbx
+  80241c:	48 83 ec 18          	sub    $0x18,%rsp
+  802420:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  802424:	49 89 f6             	mov    %rsi,%r14
+  802427:	49 89 d4             	mov    %rdx,%r12
+    while (n > sizeof(fsipcbuf.readRet.ret_buf))
+  80242a:	48 81 fa 00 10 00 00 	cmp    $0x1000,%rdx
+  802431:	0f 86 ea 00 00 00    	jbe    802521 <devfile_read+0x112>
+    ssize_t readsz = 0;
+  802437:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  80243e:	00 
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  80243f:	49 bf 00 60 80 00 00 	movabs $0x806000,%r15
+  802446:	00 00 00 
+  802449:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80244d:	8b 40 0c             	mov    0xc(%rax),%eax
+  802450:	41 89 07             	mov    %eax,(%r15)
+        fsipcbuf.read.req_n = sizeof(fsipcbuf.readRet.ret_buf);
+  802453:	49 c7 47 08 00 10 00 	movq   $0x1000,0x8(%r15)
+  80245a:	00 
+        ssize_t res = fsipc(FSREQ_READ, NULL);
+  80245b:	be 00 00 00 00       	mov    $0x0,%esi
+  802460:	bf 03 00 00 00       	mov    $0x3,%edi
+  802465:	48 b8 95 21 80 00 00 	movabs $0x802195,%rax
+  80246c:	00 00 00 
+  80246f:	ff d0                	call   *%rax
+  802471:	4c 63 e8             	movslq %eax,%r13
+        if (res < 0)
+  802474:	4d 85 ed             	test   %r13,%r13
+  802477:	0f 88 92 00 00 00    	js     80250f <devfile_read+0x100>
+        memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  80247d:	4c 89 ea             	mov    %r13,%rdx
+  802480:	4c 89 fe             	mov    %r15,%rsi
+  802483:	4c 89 f7             	mov    %r14,%rdi
+  802486:	48 b8 b1 0f 80 00 00 	movabs $0x800fb1,%rax
+  80248d:	00 00 00 
+  802490:	ff d0                	call   *%rax
+        if (res < sizeof(fsipcbuf.readRet.ret_buf))
+  802492:	49 81 fd ff 0f 00 00 	cmp    $0xfff,%r13
+  802499:	76 6d                	jbe    802508 <devfile_read+0xf9>
+        readsz += res;
+  80249b:	4c 01 6d c0          	add    %r13,-0x40(%rbp)
+        buf += res;
+  80249f:	4d 01 ee             	add    %r13,%r14
+        n -= res;
+  8024a2:	4d 29 ec             	sub    %r13,%r12
+    while (n > sizeof(fsipcbuf.readRet.ret_buf))
+  8024a5:	49 81 fc 00 10 00 00 	cmp    $0x1000,%r12
+  8024ac:	77 9b                	ja     802449 <devfile_read+0x3a>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8024ae:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  8024b5:	00 00 00 
+  8024b8:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  8024bc:	8b 51 0c             	mov    0xc(%rcx),%edx
+  8024bf:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.read.req_n = n;
+  8024c1:	4c 89 60 08          	mov    %r12,0x8(%rax)
+    ssize_t res = fsipc(FSREQ_READ, NULL);
+  8024c5:	be 00 00 00 00       	mov    $0x0,%esi
+  8024ca:	bf 03 00 00 00       	mov    $0x3,%edi
+  8024cf:	48 b8 95 21 80 00 00 	movabs $0x802195,%rax
+  8024d6:	00 00 00 
+  8024d9:	ff d0                	call   *%rax
+  8024db:	4c 63 e8             	movslq %eax,%r13
+    if (res < 0)
+  8024de:	4d 85 ed             	test   %r13,%r13
+  8024e1:	78 2c                	js     80250f <devfile_read+0x100>
+    memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  8024e3:	4c 89 ea             	mov    %r13,%rdx
+  8024e6:	48 be 00 60 80 00 00 	movabs $0x806000,%rsi
+  8024ed:	00 00 00 
+  8024f0:	4c 89 f7             	mov    %r14,%rdi
+  8024f3:	48 b8 b1 0f 80 00 00 	movabs $0x800fb1,%rax
+  8024fa:	00 00 00 
+  8024fd:	ff d0                	call   *%rax
+    readsz += res;
+  8024ff:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802503:	49 01 c5             	add    %rax,%r13
+    return readsz;
+  802506:	eb 07                	jmp    80250f <devfile_read+0x100>
+            return readsz + res;
+  802508:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80250c:	49 01 c5             	add    %rax,%r13
+}
+  80250f:	4c 89 e8             	mov    %r13,%rax
+  802512:	48 83 c4 18          	add    $0x18,%rsp
+  802516:	5b                   	pop    %rbx
+  802517:	41 5c                	pop    %r12
+  802519:	41 5d                	pop    %r13
+  80251b:	41 5e                	pop    %r14
+  80251d:	41 5f                	pop    %r15
+  80251f:	5d                   	pop    %rbp
+  802520:	c3                   	ret
+    ssize_t readsz = 0;
+  802521:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  802528:	00 
+  802529:	eb 83                	jmp    8024ae <devfile_read+0x9f>
+
+000000000080252b <open>:
+open(const char *path, int mode) {
+  80252b:	55                   	push   %rbp
+  80252c:	48 89 e5             	mov    %rsp,%rbp
+  80252f:	41 55                	push   %r13
+  802531:	41 54                	push   %r12
+  802533:	53                   	push   %rbx
+  802534:	48 83 ec 18          	sub    $0x18,%rsp
+  802538:	49 89 fc             	mov    %rdi,%r12
+  80253b:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  80253e:	48 b8 12 0d 80 00 00 	movabs $0x800d12,%rax
+  802545:	00 00 00 
+  802548:	ff d0                	call   *%rax
+  80254a:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802550:	0f 87 8a 00 00 00    	ja     8025e0 <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802556:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  80255a:	48 b8 0e 1b 80 00 00 	movabs $0x801b0e,%rax
+  802561:	00 00 00 
+  802564:	ff d0                	call   *%rax
+  802566:	89 c3                	mov    %eax,%ebx
+  802568:	85 c0                	test   %eax,%eax
+  80256a:	78 50                	js     8025bc <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  80256c:	4c 89 e6             	mov    %r12,%rsi
+  80256f:	48 bb 00 60 80 00 00 	movabs $0x806000,%rbx
+  802576:	00 00 00 
+  802579:	48 89 df             	mov    %rbx,%rdi
+  80257c:	48 b8 50 0d 80 00 00 	movabs $0x800d50,%rax
+  802583:	00 00 00 
+  802586:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  802588:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  80258f:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802593:	bf 01 00 00 00       	mov    $0x1,%edi
+  802598:	48 b8 95 21 80 00 00 	movabs $0x802195,%rax
+  80259f:	00 00 00 
+  8025a2:	ff d0                	call   *%rax
+  8025a4:	89 c3                	mov    %eax,%ebx
+  8025a6:	85 c0                	test   %eax,%eax
+  8025a8:	78 1f                	js     8025c9 <open+0x9e>
+    return fd2num(fd);
+  8025aa:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8025ae:	48 b8 67 1a 80 00 00 	movabs $0x801a67,%rax
+  8025b5:	00 00 00 
+  8025b8:	ff d0                	call   *%rax
+  8025ba:	89 c3                	mov    %eax,%ebx
+}
+  8025bc:	89 d8                	mov    %ebx,%eax
+  8025be:	48 83 c4 18          	add    $0x18,%rsp
+  8025c2:	5b                   	pop    %rbx
+  8025c3:	41 5c                	pop    %r12
+  8025c5:	41 5d                	pop    %r13
+  8025c7:	5d                   	pop    %rbp
+  8025c8:	c3                   	ret
+        fd_close(fd, 0);
+  8025c9:	be 00 00 00 00       	mov    $0x0,%esi
+  8025ce:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8025d2:	48 b8 e3 1b 80 00 00 	movabs $0x801be3,%rax
+  8025d9:	00 00 00 
+  8025dc:	ff d0                	call   *%rax
+        return res;
+  8025de:	eb dc                	jmp    8025bc <open+0x91>
+        return -E_BAD_PATH;
+  8025e0:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  8025e5:	eb d5                	jmp    8025bc <open+0x91>
+
+00000000008025e7 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  8025e7:	55                   	push   %rbp
+  8025e8:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc(FSREQ_SYNC, NULL);
+  8025eb:	be 00 00 00 00       	mov    $0x0,%esi
+  8025f0:	bf 08 00 00 00       	mov    $0x8,%edi
+  8025f5:	48 b8 95 21 80 00 00 	movabs $0x802195,%rax
+  8025fc:	00 00 00 
+  8025ff:	ff d0                	call   *%rax
+}
+  802601:	5d                   	pop    %rbp
+  802602:	c3                   	ret
+
+0000000000802603 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  802603:	55                   	push   %rbp
+  802604:	48 89 e5             	mov    %rsp,%rbp
+  802607:	41 54                	push   %r12
+  802609:	53                   	push   %rbx
+  80260a:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80260d:	48 b8 79 1a 80 00 00 	movabs $0x801a79,%rax
+  802614:	00 00 00 
+  802617:	ff d0                	call   *%rax
+  802619:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  80261c:	48 be 00 37 80 00 00 	movabs $0x803700,%rsi
+  802623:	00 00 00 
+  802626:	48 89 df             	mov    %rbx,%rdi
+  802629:	48 b8 50 0d 80 00 00 	movabs $0x800d50,%rax
+  802630:	00 00 00 
+  802633:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  802635:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  80263a:	41 2b 04 24          	sub    (%r12),%eax
+  80263e:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  802644:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  80264b:	00 00 00 
+    stat->st_dev = &devpipe;
+  80264e:	48 b8 60 40 80 00 00 	movabs $0x804060,%rax
+  802655:	00 00 00 
+  802658:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  80265f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802664:	5b                   	pop    %rbx
+  802665:	41 5c                	pop    %r12
+  802667:	5d                   	pop    %rbp
+  802668:	c3                   	ret
+
+0000000000802669 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  802669:	55                   	push   %rbp
+  80266a:	48 89 e5             	mov    %rsp,%rbp
+  80266d:	41 54                	push   %r12
+  80266f:	53                   	push   %rbx
+  802670:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  802673:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802678:	48 89 fe             	mov    %rdi,%rsi
+  80267b:	bf 00 00 00 00       	mov    $0x0,%edi
+  802680:	49 bc cc 13 80 00 00 	movabs $0x8013cc,%r12
+  802687:	00 00 00 
+  80268a:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  80268d:	48 89 df             	mov    %rbx,%rdi
+  802690:	48 b8 79 1a 80 00 00 	movabs $0x801a79,%rax
+  802697:	00 00 00 
+  80269a:	ff d0                	call   *%rax
+  80269c:	48 89 c6             	mov    %rax,%rsi
+  80269f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8026a4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8026a9:	41 ff d4             	call   *%r12
+}
+  8026ac:	5b                   	pop    %rbx
+  8026ad:	41 5c                	pop    %r12
+  8026af:	5d                   	pop    %rbp
+  8026b0:	c3                   	ret
+
+00000000008026b1 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8026b1:	55                   	push   %rbp
+  8026b2:	48 89 e5             	mov    %rsp,%rbp
+  8026b5:	41 57                	push   %r15
+  8026b7:	41 56                	push   %r14
+  8026b9:	41 55                	push   %r13
+  8026bb:	41 54                	push   %r12
+  8026bd:	53                   	push   %rbx
+  8026be:	48 83 ec 18          	sub    $0x18,%rsp
+  8026c2:	49 89 fc             	mov    %rdi,%r12
+  8026c5:	49 89 f5             	mov    %rsi,%r13
+  8026c8:	49 89 d7             	mov    %rdx,%r15
+  8026cb:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8026cf:	48 b8 79 1a 80 00 00 	movabs $0x801a79,%rax
+  8026d6:	00 00 00 
+  8026d9:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  8026db:	4d 85 ff             	test   %r15,%r15
+  8026de:	0f 84 af 00 00 00    	je     802793 <devpipe_write+0xe2>
+  8026e4:	48 89 c3             	mov    %rax,%rbx
+  8026e7:	4c 89 f8             	mov    %r15,%rax
+  8026ea:	4d 89 ef             	mov    %r13,%r15
+  8026ed:	4c 01 e8             	add    %r13,%rax
+  8026f0:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8026f4:	49 bd d4 12 80 00 00 	movabs $0x8012d4,%r13
+  8026fb:	00 00 00 
+            sys_yield();
+  8026fe:	49 be 71 12 80 00 00 	movabs $0x801271,%r14
+  802705:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  802708:	8b 73 04             	mov    0x4(%rbx),%esi
+  80270b:	48 63 ce             	movslq %esi,%rcx
+  80270e:	48 63 03             	movslq (%rbx),%rax
+  802711:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  802717:	48 39 c1             	cmp    %rax,%rcx
+  80271a:	72 2e                	jb     80274a <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80271c:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802721:	48 89 da             	mov    %rbx,%rdx
+  802724:	be 00 10 00 00       	mov    $0x1000,%esi
+  802729:	4c 89 e7             	mov    %r12,%rdi
+  80272c:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  80272f:	85 c0                	test   %eax,%eax
+  802731:	74 66                	je     802799 <devpipe_write+0xe8>
+            sys_yield();
+  802733:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  802736:	8b 73 04             	mov    0x4(%rbx),%esi
+  802739:	48 63 ce             	movslq %esi,%rcx
+  80273c:	48 63 03             	movslq (%rbx),%rax
+  80273f:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  802745:	48 39 c1             	cmp    %rax,%rcx
+  802748:	73 d2                	jae    80271c <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  80274a:	41 0f b6 3f          	movzbl (%r15),%edi
+  80274e:	48 89 ca             	mov    %rcx,%rdx
+  802751:	48 c1 ea 03          	shr    $0x3,%rdx
+  802755:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  80275c:	08 10 20 
+  80275f:	48 f7 e2             	mul    %rdx
+  802762:	48 c1 ea 06          	shr    $0x6,%rdx
+  802766:	48 89 d0             	mov    %rdx,%rax
+  802769:	48 c1 e0 09          	shl    $0x9,%rax
+  80276d:	48 29 d0             	sub    %rdx,%rax
+  802770:	48 c1 e0 03          	shl    $0x3,%rax
+  802774:	48 29 c1             	sub    %rax,%rcx
+  802777:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  80277c:	83 c6 01             	add    $0x1,%esi
+  80277f:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  802782:	49 83 c7 01          	add    $0x1,%r15
+  802786:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80278a:	49 39 c7             	cmp    %rax,%r15
+  80278d:	0f 85 75 ff ff ff    	jne    802708 <devpipe_write+0x57>
+    return n;
+  802793:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802797:	eb 05                	jmp    80279e <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  802799:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80279e:	48 83 c4 18          	add    $0x18,%rsp
+  8027a2:	5b                   	pop    %rbx
+  8027a3:	41 5c                	pop    %r12
+  8027a5:	41 5d                	pop    %r13
+  8027a7:	41 5e                	pop    %r14
+  8027a9:	41 5f                	pop    %r15
+  8027ab:	5d                   	pop    %rbp
+  8027ac:	c3                   	ret
+
+00000000008027ad <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  8027ad:	55                   	push   %rbp
+  8027ae:	48 89 e5             	mov    %rsp,%rbp
+  8027b1:	41 57                	push   %r15
+  8027b3:	41 56                	push   %r14
+  8027b5:	41 55                	push   %r13
+  8027b7:	41 54                	push   %r12
+  8027b9:	53                   	push   %rbx
+  8027ba:	48 83 ec 18          	sub    $0x18,%rsp
+  8027be:	49 89 fc             	mov    %rdi,%r12
+  8027c1:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  8027c5:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8027c9:	48 b8 79 1a 80 00 00 	movabs $0x801a79,%rax
+  8027d0:	00 00 00 
+  8027d3:	ff d0                	call   *%rax
+  8027d5:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  8027d8:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8027de:	49 bd d4 12 80 00 00 	movabs $0x8012d4,%r13
+  8027e5:	00 00 00 
+            sys_yield();
+  8027e8:	49 be 71 12 80 00 00 	movabs $0x801271,%r14
+  8027ef:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  8027f2:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  8027f7:	74 7d                	je     802876 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  8027f9:	8b 03                	mov    (%rbx),%eax
+  8027fb:	3b 43 04             	cmp    0x4(%rbx),%eax
+  8027fe:	75 26                	jne    802826 <devpipe_read+0x79>
+            if (i > 0) return i;
+  802800:	4d 85 ff             	test   %r15,%r15
+  802803:	75 77                	jne    80287c <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802805:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80280a:	48 89 da             	mov    %rbx,%rdx
+  80280d:	be 00 10 00 00       	mov    $0x1000,%esi
+  802812:	4c 89 e7             	mov    %r12,%rdi
+  802815:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  802818:	85 c0                	test   %eax,%eax
+  80281a:	74 72                	je     80288e <devpipe_read+0xe1>
+            sys_yield();
+  80281c:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  80281f:	8b 03                	mov    (%rbx),%eax
+  802821:	3b 43 04             	cmp    0x4(%rbx),%eax
+  802824:	74 df                	je     802805 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802826:	48 63 c8             	movslq %eax,%rcx
+  802829:	48 89 ca             	mov    %rcx,%rdx
+  80282c:	48 c1 ea 03          	shr    $0x3,%rdx
+  802830:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  802837:	08 10 20 
+  80283a:	48 89 d0             	mov    %rdx,%rax
+  80283d:	48 f7 e6             	mul    %rsi
+  802840:	48 c1 ea 06          	shr    $0x6,%rdx
+  802844:	48 89 d0             	mov    %rdx,%rax
+  802847:	48 c1 e0 09          	shl    $0x9,%rax
+  80284b:	48 29 d0             	sub    %rdx,%rax
+  80284e:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  802855:	00 
+  802856:	48 89 c8             	mov    %rcx,%rax
+  802859:	48 29 d0             	sub    %rdx,%rax
+  80285c:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  802861:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  802865:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  802869:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  80286c:	49 83 c7 01          	add    $0x1,%r15
+  802870:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  802874:	75 83                	jne    8027f9 <devpipe_read+0x4c>
+    return n;
+  802876:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80287a:	eb 03                	jmp    80287f <devpipe_read+0xd2>
+            if (i > 0) return i;
+  80287c:	4c 89 f8             	mov    %r15,%rax
+}
+  80287f:	48 83 c4 18          	add    $0x18,%rsp
+  802883:	5b                   	pop    %rbx
+  802884:	41 5c                	pop    %r12
+  802886:	41 5d                	pop    %r13
+  802888:	41 5e                	pop    %r14
+  80288a:	41 5f                	pop    %r15
+  80288c:	5d                   	pop    %rbp
+  80288d:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  80288e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802893:	eb ea                	jmp    80287f <devpipe_read+0xd2>
+
+0000000000802895 <pipe>:
+pipe(int pfd[2]) {
+  802895:	55                   	push   %rbp
+  802896:	48 89 e5             	mov    %rsp,%rbp
+  802899:	41 55                	push   %r13
+  80289b:	41 54                	push   %r12
+  80289d:	53                   	push   %rbx
+  80289e:	48 81 ec b8 00 00 00 	sub    $0xb8,%rsp
+  8028a5:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8028a8:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  8028ac:	48 b8 0e 1b 80 00 00 	movabs $0x801b0e,%rax
+  8028b3:	00 00 00 
+  8028b6:	ff d0                	call   *%rax
+  8028b8:	89 c3                	mov    %eax,%ebx
+  8028ba:	85 c0                	test   %eax,%eax
+  8028bc:	0f 88 51 01 00 00    	js     802a13 <pipe+0x17e>
+        (res = fd_alloc_from(fd2num(fd0) + 1, &fd1)) < 0) goto err;
+  8028c2:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8028c6:	48 b8 67 1a 80 00 00 	movabs $0x801a67,%rax
+  8028cd:	00 00 00 
+  8028d0:	ff d0                	call   *%rax
+  8028d2:	8d 78 01             	lea    0x1(%rax),%edi
+  8028d5:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8028d9:	48 b8 95 1a 80 00 00 	movabs $0x801a95,%rax
+  8028e0:	00 00 00 
+  8028e3:	ff d0                	call   *%rax
+  8028e5:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8028e7:	85 c0                	test   %eax,%eax
+  8028e9:	0f 88 24 01 00 00    	js     802a13 <pipe+0x17e>
+    va = fd2data(fd0);
+  8028ef:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8028f3:	48 bb 79 1a 80 00 00 	movabs $0x801a79,%rbx
+  8028fa:	00 00 00 
+  8028fd:	ff d3                	call   *%rbx
+  8028ff:	49 89 c5             	mov    %rax,%r13
+    struct RegionOp ops[] = {
+  802902:	48 8d bd 30 ff ff ff 	lea    -0xd0(%rbp),%rdi
+  802909:	b9 14 00 00 00       	mov    $0x14,%ecx
+  80290e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802913:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+  802916:	c7 85 34 ff ff ff 46 	movl   $0x46,-0xcc(%rbp)
+  80291d:	00 00 00 
+  802920:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802924:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+  80292b:	48 c7 85 50 ff ff ff 	movq   $0x1000,-0xb0(%rbp)
+  802932:	00 10 00 00 
+  802936:	c7 85 5c ff ff ff 46 	movl   $0x46,-0xa4(%rbp)
+  80293d:	00 00 00 
+            {.type = REGION_ALLOC, .dstva = (uintptr_t)fd1, .size = PAGE_SIZE, .perm = PROT_RW | PROT_SHARE},
+  802940:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+    struct RegionOp ops[] = {
+  802944:	48 89 bd 70 ff ff ff 	mov    %rdi,-0x90(%rbp)
+  80294b:	48 c7 85 78 ff ff ff 	movq   $0x1000,-0x88(%rbp)
+  802952:	00 10 00 00 
+  802956:	c7 45 84 46 00 00 00 	movl   $0x46,-0x7c(%rbp)
+  80295d:	4c 89 6d 98          	mov    %r13,-0x68(%rbp)
+  802961:	48 c7 45 a0 00 10 00 	movq   $0x1000,-0x60(%rbp)
+  802968:	00 
+  802969:	c7 45 a8 01 00 00 00 	movl   $0x1,-0x58(%rbp)
+  802970:	c7 45 ac 46 00 00 00 	movl   $0x46,-0x54(%rbp)
+  802977:	4c 89 6d b8          	mov    %r13,-0x48(%rbp)
+            {.type = REGION_MAP, .srcva = (uintptr_t)va, .dstva = (uintptr_t)fd2data(fd1), .size = PAGE_SIZE, .perm = PROT_RW | PROT_SHARE},
+  80297b:	ff d3                	call   *%rbx
+    struct RegionOp ops[] = {
+  80297d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802981:	48 c7 45 c8 00 10 00 	movq   $0x1000,-0x38(%rbp)
+  802988:	00 
+    if ((res = sys_region_batch(ops, sizeof ops / sizeof *ops)) < 0) goto err1;
+  802989:	be 04 00 00 00       	mov    $0x4,%esi
+  80298e:	48 8d bd 30 ff ff ff 	lea    -0xd0(%rbp),%rdi
+  802995:	48 b8 33 14 80 00 00 	movabs $0x801433,%rax
+  80299c:	00 00 00 
+  80299f:	ff d0                	call   *%rax
+  8029a1:	89 c3                	mov    %eax,%ebx
+  8029a3:	85 c0                	test   %eax,%eax
+  8029a5:	0f 88 ad 00 00 00    	js     802a58 <pipe+0x1c3>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8029ab:	be 00 10 00 00       	mov    $0x1000,%esi
+  8029b0:	4c 89 ef             	mov    %r13,%rdi
+  8029b3:	48 b8 a2 12 80 00 00 	movabs $0x8012a2,%rax
+  8029ba:	00 00 00 
+  8029bd:	ff d0                	call   *%rax
+  8029bf:	83 f8 02             	cmp    $0x2,%eax
+  8029c2:	75 5f                	jne    802a23 <pipe+0x18e>
+    fd0->fd_dev_id = devpipe.dev_id;
+  8029c4:	a1 60 40 80 00 00 00 	movabs 0x804060,%eax
+  8029cb:	00 00 
+  8029cd:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8029d1:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  8029d3:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8029d7:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  8029de:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8029e2:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  8029e4:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8029e8:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  8029ef:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8029f3:	48 bb 67 1a 80 00 00 	movabs $0x801a67,%rbx
+  8029fa:	00 00 00 
+  8029fd:	ff d3                	call   *%rbx
+  8029ff:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  802a03:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  802a07:	ff d3                	call   *%rbx
+  802a09:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  802a0e:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  802a13:	89 d8                	mov    %ebx,%eax
+  802a15:	48 81 c4 b8 00 00 00 	add    $0xb8,%rsp
+  802a1c:	5b                   	pop    %rbx
+  802a1d:	41 5c                	pop    %r12
+  802a1f:	41 5d                	pop    %r13
+  802a21:	5d                   	pop    %rbp
+  802a22:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  802a23:	48 b9 30 37 80 00 00 	movabs $0x803730,%rcx
+  802a2a:	00 00 00 
+  802a2d:	48 ba 07 37 80 00 00 	movabs $0x803707,%rdx
+  802a34:	00 00 00 
+  802a37:	be 33 00 00 00       	mov    $0x33,%esi
+  802a3c:	48 bf 1c 37 80 00 00 	movabs $0x80371c,%rdi
+  802a43:	00 00 00 
+  802a46:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a4b:	49 b8 db 02 80 00 00 	movabs $0x8002db,%r8
+  802a52:	00 00 00 
+  802a55:	41 ff d0             	call   *%r8
+        ops[i].type = REGION_UNMAP;
+  802a58:	c7 85 30 ff ff ff 02 	movl   $0x2,-0xd0(%rbp)
+  802a5f:	00 00 00 
+  802a62:	c7 85 58 ff ff ff 02 	movl   $0x2,-0xa8(%rbp)
+  802a69:	00 00 00 
+  802a6c:	c7 45 80 02 00 00 00 	movl   $0x2,-0x80(%rbp)
+  802a73:	c7 45 a8 02 00 00 00 	movl   $0x2,-0x58(%rbp)
+    sys_region_batch(ops, sizeof ops / sizeof *ops);
+  802a7a:	be 04 00 00 00       	mov    $0x4,%esi
+  802a7f:	48 8d bd 30 ff ff ff 	lea    -0xd0(%rbp),%rdi
+  802a86:	48 b8 33 14 80 00 00 	movabs $0x801433,%rax
+  802a8d:	00 00 00 
+  802a90:	ff d0                	call   *%rax
+  802a92:	e9 7c ff ff ff       	jmp    802a13 <pipe+0x17e>
+
+0000000000802a97 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  802a97:	55                   	push   %rbp
+  802a98:	48 89 e5             	mov    %rsp,%rbp
+  802a9b:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  802a9f:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802aa3:	48 b8 28 1b 80 00 00 	movabs $0x801b28,%rax
+  802aaa:	00 00 00 
+  802aad:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802aaf:	85 c0                	test   %eax,%eax
+  802ab1:	78 35                	js     802ae8 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  802ab3:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802ab7:	48 b8 79 1a 80 00 00 	movabs $0x801a79,%rax
+  802abe:	00 00 00 
+  802ac1:	ff d0                	call   *%rax
+  802ac3:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802ac6:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802acb:	be 00 10 00 00       	mov    $0x1000,%esi
+  802ad0:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802ad4:	48 b8 d4 12 80 00 00 	movabs $0x8012d4,%rax
+  802adb:	00 00 00 
+  802ade:	ff d0                	call   *%rax
+  802ae0:	85 c0                	test   %eax,%eax
+  802ae2:	0f 94 c0             	sete   %al
+  802ae5:	0f b6 c0             	movzbl %al,%eax
+}
+  802ae8:	c9                   	leave
+  802ae9:	c3                   	ret
+
+0000000000802aea <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  802aea:	48 89 f8             	mov    %rdi,%rax
+  802aed:	48 c1 e8 27          	shr    $0x27,%rax
+  802af1:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  802af8:	01 00 00 
+  802afb:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802aff:	f6 c2 01             	test   $0x1,%dl
+  802b02:	74 6d                	je     802b71 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  802b04:	48 89 f8             	mov    %rdi,%rax
+  802b07:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802b0b:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802b12:	01 00 00 
+  802b15:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802b19:	f6 c2 01             	test   $0x1,%dl
+  802b1c:	74 62                	je     802b80 <get_uvpt_entry+0x96>
+  802b1e:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802b25:	01 00 00 
+  802b28:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802b2c:	f6 c2 80             	test   $0x80,%dl
+  802b2f:	75 4f                	jne    802b80 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  802b31:	48 89 f8             	mov    %rdi,%rax
+  802b34:	48 c1 e8 15          	shr    $0x15,%rax
+  802b38:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802b3f:	01 00 00 
+  802b42:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802b46:	f6 c2 01             	test   $0x1,%dl
+  802b49:	74 44                	je     802b8f <get_uvpt_entry+0xa5>
+  802b4b:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802b52:	01 00 00 
+  802b55:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802b59:	f6 c2 80             	test   $0x80,%dl
+  802b5c:	75 31                	jne    802b8f <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  802b5e:	48 c1 ef 0c          	shr    $0xc,%rdi
+  802b62:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802b69:	01 00 00 
+  802b6c:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  802b70:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  802b71:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  802b78:	01 00 00 
+  802b7b:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802b7f:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  802b80:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802b87:	01 00 00 
+  802b8a:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802b8e:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  802b8f:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802b96:	01 00 00 
+  802b99:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802b9d:	c3                   	ret
+
+0000000000802b9e <get_prot>:
+
+int
+get_prot(void *va) {
+  802b9e:	55                   	push   %rbp
+  802b9f:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  802ba2:	48 b8 ea 2a 80 00 00 	movabs $0x802aea,%rax
+  802ba9:	00 00 00 
+  802bac:	ff d0                	call   *%rax
+  802bae:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  802bb1:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  802bb6:	89 c1                	mov    %eax,%ecx
+  802bb8:	83 c9 04             	or     $0x4,%ecx
+  802bbb:	f6 c2 01             	test   $0x1,%dl
+  802bbe:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  802bc1:	89 c1                	mov    %eax,%ecx
+  802bc3:	83 c9 02             	or     $0x2,%ecx
+  802bc6:	f6 c2 02             	test   $0x2,%dl
+  802bc9:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  802bcc:	89 c1                	mov    %eax,%ecx
+  802bce:	83 c9 01             	or     $0x1,%ecx
+  802bd1:	48 85 d2             	test   %rdx,%rdx
+  802bd4:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  802bd7:	89 c1                	mov    %eax,%ecx
+  802bd9:	83 c9 40             	or     $0x40,%ecx
+  802bdc:	f6 c6 04             	test   $0x4,%dh
+  802bdf:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  802be2:	5d                   	pop    %rbp
+  802be3:	c3                   	ret
+
+0000000000802be4 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  802be4:	55                   	push   %rbp
+  802be5:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  802be8:	48 b8 ea 2a 80 00 00 	movabs $0x802aea,%rax
+  802bef:	00 00 00 
+  802bf2:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  802bf4:	48 c1 e8 06          	shr    $0x6,%rax
+  802bf8:	83 e0 01             	and    $0x1,%eax
+}
+  802bfb:	5d                   	pop    %rbp
+  802bfc:	c3                   	ret
+
+0000000000802bfd <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  802bfd:	55                   	push   %rbp
+  802bfe:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  802c01:	48 b8 ea 2a 80 00 00 	movabs $0x802aea,%rax
+  802c08:	00 00 00 
+  802c0b:	ff d0                	call   *%rax
+  802c0d:	83 e0 01             	and    $0x1,%eax
+}
+  802c10:	5d                   	pop    %rbp
+  802c11:	c3                   	ret
+
+0000000000802c12 <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  802c12:	55                   	push   %rbp
+  802c13:	48 89 e5             	mov    %rsp,%rbp
+  802c16:	41 57                	push   %r15
+  802c18:	41 56                	push   %r14
+  802c1a:	41 55                	push   %r13
+  802c1c:	41 54                	push   %r12
+  802c1e:	53                   	push   %rbx
+  802c1f:	48 83 ec 38          	sub    $0x38,%rsp
+  802c23:	49 89 f7             	mov    %rsi,%r15
+  802c26:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+                    }
+                    continue;
+                }
+                for (int ptei = 0; ptei < PT_ENTRY_COUNT; ptei++) {
+                    uintptr_t pte_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, pdei, ptei, 0);
+                    pte_t pte = uvpt[VPT(pte_addr)];
+  802c2c:	49 bd 00 00 00 00 00 	movabs $0x10000000000,%r13
+  802c33:	01 00 00 
+  802c36:	4d 89 e6             	mov    %r12,%r14
+  802c39:	49 89 fc             	mov    %rdi,%r12
+  802c3c:	e9 19 01 00 00       	jmp    802d5a <foreach_shared_region+0x148>
+  802c41:	48 89 5d b0          	mov    %rbx,-0x50(%rbp)
+  802c45:	4c 89 75 a8          	mov    %r14,-0x58(%rbp)
+  802c49:	eb 52                	jmp    802c9d <foreach_shared_region+0x8b>
+                for (int ptei = 0; ptei < PT_ENTRY_COUNT; ptei++) {
+  802c4b:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802c52:	48 81 fb 00 00 20 00 	cmp    $0x200000,%rbx
+  802c59:	74 2e                	je     802c89 <foreach_shared_region+0x77>
+                    uintptr_t pte_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, pdei, ptei, 0);
+  802c5b:	48 89 df             	mov    %rbx,%rdi
+  802c5e:	4c 09 f7             	or     %r14,%rdi
+                    pte_t pte = uvpt[VPT(pte_addr)];
+  802c61:	48 89 f8             	mov    %rdi,%rax
+  802c64:	48 c1 e8 0c          	shr    $0xc,%rax
+  802c68:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+                    if ((pte & PTE_P) && (pte & PTE_SHARE)) {
+  802c6d:	25 01 04 00 00       	and    $0x401,%eax
+  802c72:	48 3d 01 04 00 00    	cmp    $0x401,%rax
+  802c78:	75 d1                	jne    802c4b <foreach_shared_region+0x39>
+                        fun((void*)pte_addr, (void*)(pte_addr + PAGE_SIZE), arg);
+  802c7a:	48 8d b7 00 10 00 00 	lea    0x1000(%rdi),%rsi
+  802c81:	4c 89 fa             	mov    %r15,%rdx
+  802c84:	41 ff d4             	call   *%r12
+  802c87:	eb c2                	jmp    802c4b <foreach_shared_region+0x39>
+            for (int pdei = 0; pdei < PD_ENTRY_COUNT; pdei++) {
+  802c89:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  802c90:	00 
+  802c91:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802c95:	48 3d 00 00 00 40    	cmp    $0x40000000,%rax
+  802c9b:	74 46                	je     802ce3 <foreach_shared_region+0xd1>
+                uintptr_t pde_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, pdei, 0, 0);
+  802c9d:	4c 8b 75 c8          	mov    -0x38(%rbp),%r14
+  802ca1:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802ca5:	49 09 c6             	or     %rax,%r14
+                pde_t pde = uvpd[VPD(pde_addr)];
+  802ca8:	4c 89 f0             	mov    %r14,%rax
+  802cab:	48 c1 e8 15          	shr    $0x15,%rax
+  802caf:	48 b9 00 00 00 80 00 	movabs $0x10080000000,%rcx
+  802cb6:	01 00 00 
+  802cb9:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+                if (!(pde & PTE_P)) {
+  802cbd:	a8 01                	test   $0x1,%al
+  802cbf:	74 c8                	je     802c89 <foreach_shared_region+0x77>
+                if (pde & PTE_PS) {
+  802cc1:	48 89 c3             	mov    %rax,%rbx
+  802cc4:	81 e3 80 00 00 00    	and    $0x80,%ebx
+  802cca:	74 8f                	je     802c5b <foreach_shared_region+0x49>
+                    if (pde & PTE_SHARE) {
+  802ccc:	f6 c4 04             	test   $0x4,%ah
+  802ccf:	74 b8                	je     802c89 <foreach_shared_region+0x77>
+                        fun((void*)pde_addr, (void*)(pde_addr + 1024 * 1024 * 2), arg);
+  802cd1:	49 8d b6 00 00 20 00 	lea    0x200000(%r14),%rsi
+  802cd8:	4c 89 fa             	mov    %r15,%rdx
+  802cdb:	4c 89 f7             	mov    %r14,%rdi
+  802cde:	41 ff d4             	call   *%r12
+  802ce1:	eb a6                	jmp    802c89 <foreach_shared_region+0x77>
+  802ce3:	48 8b 5d b0          	mov    -0x50(%rbp),%rbx
+  802ce7:	4c 8b 75 a8          	mov    -0x58(%rbp),%r14
+        for (int pdpei = 0; pdpei < PDP_ENTRY_COUNT; pdpei++) {
+  802ceb:	48 81 c3 00 00 00 40 	add    $0x40000000,%rbx
+  802cf2:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802cf9:	00 00 00 
+  802cfc:	48 39 c3             	cmp    %rax,%rbx
+  802cff:	74 4c                	je     802d4d <foreach_shared_region+0x13b>
+            uintptr_t pdpe_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, 0, 0, 0);
+  802d01:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802d05:	48 09 d8             	or     %rbx,%rax
+  802d08:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+            pdpe_t pdpe = uvpdp[VPDP(pdpe_addr)];
+  802d0c:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802d10:	48 b9 00 00 40 80 00 	movabs $0x10080400000,%rcx
+  802d17:	01 00 00 
+  802d1a:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+            if (!(pdpe & PTE_P)) {
+  802d1e:	a8 01                	test   $0x1,%al
+  802d20:	74 c9                	je     802ceb <foreach_shared_region+0xd9>
+            if (pdpe & PTE_PS) {
+  802d22:	48 89 c1             	mov    %rax,%rcx
+  802d25:	81 e1 80 00 00 00    	and    $0x80,%ecx
+  802d2b:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  802d2f:	0f 84 0c ff ff ff    	je     802c41 <foreach_shared_region+0x2f>
+                if (pdpe & PTE_SHARE) {
+  802d35:	f6 c4 04             	test   $0x4,%ah
+  802d38:	74 b1                	je     802ceb <foreach_shared_region+0xd9>
+                    fun((void*)pdpe_addr, (void*)(pdpe_addr + 1024 * 1024 * 1024), arg); 
+  802d3a:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  802d3e:	48 8d b7 00 00 00 40 	lea    0x40000000(%rdi),%rsi
+  802d45:	4c 89 fa             	mov    %r15,%rdx
+  802d48:	41 ff d4             	call   *%r12
+  802d4b:	eb 9e                	jmp    802ceb <foreach_shared_region+0xd9>
+    for (int pml4ei = 0; pml4ei < PML4_ENTRY_COUNT; pml4ei++) {
+  802d4d:	49 83 c6 01          	add    $0x1,%r14
+  802d51:	49 81 fe 00 02 00 00 	cmp    $0x200,%r14
+  802d58:	74 24                	je     802d7e <foreach_shared_region+0x16c>
+        pml4e_t pml4e = uvpml4[VPML4(pml4_addr)];
+  802d5a:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  802d61:	01 00 00 
+  802d64:	4a 8b 04 f0          	mov    (%rax,%r14,8),%rax
+        if (!(pml4e & PTE_P)) {
+  802d68:	a8 01                	test   $0x1,%al
+  802d6a:	74 e1                	je     802d4d <foreach_shared_region+0x13b>
+  802d6c:	4c 89 f0             	mov    %r14,%rax
+  802d6f:	48 c1 e0 27          	shl    $0x27,%rax
+  802d73:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  802d77:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802d7c:	eb 83                	jmp    802d01 <foreach_shared_region+0xef>
+            }
+        }
+    }
+    
+    return 0;
+}
+  802d7e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d83:	48 83 c4 38          	add    $0x38,%rsp
+  802d87:	5b                   	pop    %rbx
+  802d88:	41 5c                	pop    %r12
+  802d8a:	41 5d                	pop    %r13
+  802d8c:	41 5e                	pop    %r14
+  802d8e:	41 5f                	pop    %r15
+  802d90:	5d                   	pop    %rbp
+  802d91:	c3                   	ret
+
+0000000000802d92 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  802d92:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d97:	c3                   	ret
+
+0000000000802d98 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  802d98:	55                   	push   %rbp
+  802d99:	48 89 e5             	mov    %rsp,%rbp
+  802d9c:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  802d9f:	48 be 54 37 80 00 00 	movabs $0x803754,%rsi
+  802da6:	00 00 00 
+  802da9:	48 b8 50 0d 80 00 00 	movabs $0x800d50,%rax
+  802db0:	00 00 00 
+  802db3:	ff d0                	call   *%rax
+    return 0;
+}
+  802db5:	b8 00 00 00 00       	mov    $0x0,%eax
+  802dba:	5d                   	pop    %rbp
+  802dbb:	c3                   	ret
+
+0000000000802dbc <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  802dbc:	55                   	push   %rbp
+  802dbd:	48 89 e5             	mov    %rsp,%rbp
+  802dc0:	41 57                	push   %r15
+  802dc2:	41 56                	push   %r14
+  802dc4:	41 55                	push   %r13
+  802dc6:	41 54                	push   %r12
+  802dc8:	53                   	push   %rbx
+  802dc9:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  802dd0:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  802dd7:	48 85 d2             	test   %rdx,%rdx
+  802dda:	74 7a                	je     802e56 <devcons_write+0x9a>
+  802ddc:	49 89 d6             	mov    %rdx,%r14
+  802ddf:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802de5:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  802dea:	49 bf 4a 0f 80 00 00 	movabs $0x800f4a,%r15
+  802df1:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  802df4:	4c 89 f3             	mov    %r14,%rbx
+  802df7:	48 29 f3             	sub    %rsi,%rbx
+  802dfa:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802dff:	48 39 c3             	cmp    %rax,%rbx
+  802e02:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  802e06:	4c 63 eb             	movslq %ebx,%r13
+  802e09:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  802e10:	48 01 c6             	add    %rax,%rsi
+  802e13:	4c 89 ea             	mov    %r13,%rdx
+  802e16:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802e1d:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  802e20:	4c 89 ee             	mov    %r13,%rsi
+  802e23:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802e2a:	48 b8 77 11 80 00 00 	movabs $0x801177,%rax
+  802e31:	00 00 00 
+  802e34:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  802e36:	41 01 dc             	add    %ebx,%r12d
+  802e39:	49 63 f4             	movslq %r12d,%rsi
+  802e3c:	4c 39 f6             	cmp    %r14,%rsi
+  802e3f:	72 b3                	jb     802df4 <devcons_write+0x38>
+    return res;
+  802e41:	49 63 c4             	movslq %r12d,%rax
+}
+  802e44:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  802e4b:	5b                   	pop    %rbx
+  802e4c:	41 5c                	pop    %r12
+  802e4e:	41 5d                	pop    %r13
+  802e50:	41 5e                	pop    %r14
+  802e52:	41 5f                	pop    %r15
+  802e54:	5d                   	pop    %rbp
+  802e55:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  802e56:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802e5c:	eb e3                	jmp    802e41 <devcons_write+0x85>
+
+0000000000802e5e <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  802e5e:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  802e61:	ba 00 00 00 00       	mov    $0x0,%edx
+  802e66:	48 85 c0             	test   %rax,%rax
+  802e69:	74 55                	je     802ec0 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  802e6b:	55                   	push   %rbp
+  802e6c:	48 89 e5             	mov    %rsp,%rbp
+  802e6f:	41 55                	push   %r13
+  802e71:	41 54                	push   %r12
+  802e73:	53                   	push   %rbx
+  802e74:	48 83 ec 08          	sub    $0x8,%rsp
+  802e78:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  802e7b:	48 bb a4 11 80 00 00 	movabs $0x8011a4,%rbx
+  802e82:	00 00 00 
+  802e85:	49 bc 71 12 80 00 00 	movabs $0x801271,%r12
+  802e8c:	00 00 00 
+  802e8f:	eb 03                	jmp    802e94 <devcons_read+0x36>
+  802e91:	41 ff d4             	call   *%r12
+  802e94:	ff d3                	call   *%rbx
+  802e96:	85 c0                	test   %eax,%eax
+  802e98:	74 f7                	je     802e91 <devcons_read+0x33>
+    if (c < 0) return c;
+  802e9a:	48 63 d0             	movslq %eax,%rdx
+  802e9d:	78 13                	js     802eb2 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  802e9f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802ea4:	83 f8 04             	cmp    $0x4,%eax
+  802ea7:	74 09                	je     802eb2 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  802ea9:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  802ead:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  802eb2:	48 89 d0             	mov    %rdx,%rax
+  802eb5:	48 83 c4 08          	add    $0x8,%rsp
+  802eb9:	5b                   	pop    %rbx
+  802eba:	41 5c                	pop    %r12
+  802ebc:	41 5d                	pop    %r13
+  802ebe:	5d                   	pop    %rbp
+  802ebf:	c3                   	ret
+  802ec0:	48 89 d0             	mov    %rdx,%rax
+  802ec3:	c3                   	ret
+
+0000000000802ec4 <cputchar>:
+cputchar(int ch) {
+  802ec4:	55                   	push   %rbp
+  802ec5:	48 89 e5             	mov    %rsp,%rbp
+  802ec8:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  802ecc:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  802ed0:	be 01 00 00 00       	mov    $0x1,%esi
+  802ed5:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  802ed9:	48 b8 77 11 80 00 00 	movabs $0x801177,%rax
+  802ee0:	00 00 00 
+  802ee3:	ff d0                	call   *%rax
+}
+  802ee5:	c9                   	leave
+  802ee6:	c3                   	ret
+
+0000000000802ee7 <getchar>:
+getchar(void) {
+  802ee7:	55                   	push   %rbp
+  802ee8:	48 89 e5             	mov    %rsp,%rbp
+  802eeb:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  802eef:	ba 01 00 00 00       	mov    $0x1,%edx
+  802ef4:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  802ef8:	bf 00 00 00 00       	mov    $0x0,%edi
+  802efd:	48 b8 0b 1e 80 00 00 	movabs $0x801e0b,%rax
+  802f04:	00 00 00 
+  802f07:	ff d0                	call   *%rax
+  802f09:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  802f0b:	85 c0                	test   %eax,%eax
+  802f0d:	78 06                	js     802f15 <getchar+0x2e>
+  802f0f:	74 08                	je     802f19 <getchar+0x32>
+  802f11:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  802f15:	89 d0                	mov    %edx,%eax
+  802f17:	c9                   	leave
+  802f18:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  802f19:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  802f1e:	eb f5                	jmp    802f15 <getchar+0x2e>
+
+0000000000802f20 <iscons>:
+iscons(int fdnum) {
+  802f20:	55                   	push   %rbp
+  802f21:	48 89 e5             	mov    %rsp,%rbp
+  802f24:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  802f28:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802f2c:	48 b8 28 1b 80 00 00 	movabs $0x801b28,%rax
+  802f33:	00 00 00 
+  802f36:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802f38:	85 c0                	test   %eax,%eax
+  802f3a:	78 18                	js     802f54 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  802f3c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802f40:	48 b8 a0 40 80 00 00 	movabs $0x8040a0,%rax
+  802f47:	00 00 00 
+  802f4a:	8b 00                	mov    (%rax),%eax
+  802f4c:	39 02                	cmp    %eax,(%rdx)
+  802f4e:	0f 94 c0             	sete   %al
+  802f51:	0f b6 c0             	movzbl %al,%eax
+}
+  802f54:	c9                   	leave
+  802f55:	c3                   	ret
+
+0000000000802f56 <opencons>:
+opencons(void) {
+  802f56:	55                   	push   %rbp
+  802f57:	48 89 e5             	mov    %rsp,%rbp
+  802f5a:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802f5e:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  802f62:	48 b8 0e 1b 80 00 00 	movabs $0x801b0e,%rax
+  802f69:	00 00 00 
+  802f6c:	ff d0                	call   *%rax
+  802f6e:	85 c0                	test   %eax,%eax
+  802f70:	78 49                	js     802fbb <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  802f72:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802f77:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802f7c:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  802f80:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f85:	48 b8 00 13 80 00 00 	movabs $0x801300,%rax
+  802f8c:	00 00 00 
+  802f8f:	ff d0                	call   *%rax
+  802f91:	85 c0                	test   %eax,%eax
+  802f93:	78 26                	js     802fbb <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  802f95:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802f99:	a1 a0 40 80 00 00 00 	movabs 0x8040a0,%eax
+  802fa0:	00 00 
+  802fa2:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  802fa4:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802fa8:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  802faf:	48 b8 67 1a 80 00 00 	movabs $0x801a67,%rax
+  802fb6:	00 00 00 
+  802fb9:	ff d0                	call   *%rax
+}
+  802fbb:	c9                   	leave
+  802fbc:	c3                   	ret
+  802fbd:	0f 1f 00             	nopl   (%rax)
+
+0000000000802fc0 <__rodata_start>:
+  802fc0:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  802fc2:	72 6b                	jb     80302f <__rodata_start+0x6f>
+  802fc4:	3a 20                	cmp    (%rax),%ah
+  802fc6:	25 69 00 75 73       	and    $0x73750069,%eax
+  802fcb:	65 72 2f             	gs jb  802ffd <__rodata_start+0x3d>
+  802fce:	65 78 69             	gs js  80303a <__rodata_start+0x7a>
+  802fd1:	74 6c                	je     80303f <__rodata_start+0x7f>
+  802fd3:	61                   	(bad)
+  802fd4:	74 65                	je     80303b <__rodata_start+0x7b>
+  802fd6:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802fd7:	63 79 2e             	movsxd 0x2e(%rcx),%edi
+  802fda:	63 00                	movsxd (%rax),%eax
+  802fdc:	73 79                	jae    803057 <__rodata_start+0x97>
+  802fde:	73 5f                	jae    80303f <__rodata_start+0x7f>
+  802fe0:	61                   	(bad)
+  802fe1:	6c                   	insb   (%dx),%es:(%rdi)
+  802fe2:	6c                   	insb   (%dx),%es:(%rdi)
+  802fe3:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802fe4:	63 5f 72             	movsxd 0x72(%rdi),%ebx
+  802fe7:	65 67 69 6f 6e 3a 20 	imul   $0x6925203a,%gs:0x6e(%edi),%ebp
+  802fee:	25 69 
+  802ff0:	00 0f                	add    %cl,(%rdi)
+  802ff2:	1f                   	(bad)
+  802ff3:	80 00 00             	addb   $0x0,(%rax)
+  802ff6:	00 00                	add    %al,(%rax)
+  802ff8:	65 78 69             	gs js  803064 <__rodata_start+0xa4>
+  802ffb:	74 6c                	je     803069 <__rodata_start+0xa9>
+  802ffd:	61                   	(bad)
+  802ffe:	74 65                	je     803065 <__rodata_start+0xa5>
+  803000:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803001:	63 79 3a             	movsxd 0x3a(%rcx),%edi
+  803004:	20 25 6c 75 20 4d    	and    %ah,0x4d20756c(%rip)        # 4da0a576 <__bss_end+0x4d202576>
+  80300a:	42 20 63 68          	rex.X and %spl,0x68(%rbx)
+  80300e:	69 6c 64 20 65 78 69 	imul   $0x74697865,0x20(%rsp,%riz,2),%ebp
+  803015:	74 
+  803016:	65 64 2c 20          	gs fs sub $0x20,%al
+  80301a:	6c                   	insb   (%dx),%es:(%rdi)
+  80301b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80301c:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80301d:	67 65 73 74          	addr32 gs jae 803095 <__rodata_start+0xd5>
+  803021:	20 73 63             	and    %dh,0x63(%rbx)
+  803024:	68 65 64 75 6c       	push   $0x6c756465
+  803029:	69 6e 67 20 67 61 70 	imul   $0x70616720,0x67(%rsi),%ebp
+  803030:	20 25 6c 75 20 63    	and    %ah,0x6320756c(%rip)        # 63a0a5a2 <__bss_end+0x632025a2>
+  803036:	79 63                	jns    80309b <__rodata_start+0xdb>
+  803038:	6c                   	insb   (%dx),%es:(%rdi)
+  803039:	65 73 0a             	gs jae 803046 <__rodata_start+0x86>
+  80303c:	00 3c 75 6e 6b 6e 6f 	add    %bh,0x6f6e6b6e(,%rsi,2)
+  803043:	77 6e                	ja     8030b3 <__rodata_start+0xf3>
+  803045:	3e 00 90 5b 25 30 38 	ds add %dl,0x3830255b(%rax)
+  80304c:	78 5d                	js     8030ab <__rodata_start+0xeb>
+  80304e:	20 75 73             	and    %dh,0x73(%rbp)
+  803051:	65 72 20             	gs jb  803074 <__rodata_start+0xb4>
+  803054:	70 61                	jo     8030b7 <__rodata_start+0xf7>
+  803056:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803057:	69 63 20 69 6e 20 25 	imul   $0x25206e69,0x20(%rbx),%esp
+  80305e:	73 20                	jae    803080 <__rodata_start+0xc0>
+  803060:	61                   	(bad)
+  803061:	74 20                	je     803083 <__rodata_start+0xc3>
+  803063:	25 73 3a 25 64       	and    $0x64253a73,%eax
+  803068:	3a 20                	cmp    (%rax),%ah
+  80306a:	00 30                	add    %dh,(%rax)
+  80306c:	31 32                	xor    %esi,(%rdx)
+  80306e:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  803075:	41                   	rex.B
+  803076:	42                   	rex.X
+  803077:	43                   	rex.XB
+  803078:	44                   	rex.R
+  803079:	45                   	rex.RB
+  80307a:	46 00 30             	rex.RX add %r14b,(%rax)
+  80307d:	31 32                	xor    %esi,(%rdx)
+  80307f:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  803086:	61                   	(bad)
+  803087:	62 63 64 65 66       	(bad)
+  80308c:	00 28                	add    %ch,(%rax)
+  80308e:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80308f:	75 6c                	jne    8030fd <__rodata_start+0x13d>
+  803091:	6c                   	insb   (%dx),%es:(%rdi)
+  803092:	29 00                	sub    %eax,(%rax)
+  803094:	65 72 72             	gs jb  803109 <__rodata_start+0x149>
+  803097:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803098:	72 20                	jb     8030ba <__rodata_start+0xfa>
+  80309a:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  80309f:	73 70                	jae    803111 <__rodata_start+0x151>
+  8030a1:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  8030a5:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  8030ac:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8030ad:	72 00                	jb     8030af <__rodata_start+0xef>
+  8030af:	62 61 64 20 65       	(bad)
+  8030b4:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8030b5:	76 69                	jbe    803120 <__rodata_start+0x160>
+  8030b7:	72 6f                	jb     803128 <__rodata_start+0x168>
+  8030b9:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8030ba:	6d                   	insl   (%dx),%es:(%rdi)
+  8030bb:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  8030bd:	74 00                	je     8030bf <__rodata_start+0xff>
+  8030bf:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  8030c6:	20 70 61             	and    %dh,0x61(%rax)
+  8030c9:	72 61                	jb     80312c <__rodata_start+0x16c>
+  8030cb:	6d                   	insl   (%dx),%es:(%rdi)
+  8030cc:	65 74 65             	gs je  803134 <__rodata_start+0x174>
+  8030cf:	72 00                	jb     8030d1 <__rodata_start+0x111>
+  8030d1:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8030d2:	75 74                	jne    803148 <__rodata_start+0x188>
+  8030d4:	20 6f 66             	and    %ch,0x66(%rdi)
+  8030d7:	20 6d 65             	and    %ch,0x65(%rbp)
+  8030da:	6d                   	insl   (%dx),%es:(%rdi)
+  8030db:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8030dc:	72 79                	jb     803157 <__rodata_start+0x197>
+  8030de:	00 6f 75             	add    %ch,0x75(%rdi)
+  8030e1:	74 20                	je     803103 <__rodata_start+0x143>
+  8030e3:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8030e4:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  8030e8:	76 69                	jbe    803153 <__rodata_start+0x193>
+  8030ea:	72 6f                	jb     80315b <__rodata_start+0x19b>
+  8030ec:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8030ed:	6d                   	insl   (%dx),%es:(%rdi)
+  8030ee:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  8030f0:	74 73                	je     803165 <__rodata_start+0x1a5>
+  8030f2:	00 63 6f             	add    %ah,0x6f(%rbx)
+  8030f5:	72 72                	jb     803169 <__rodata_start+0x1a9>
+  8030f7:	75 70                	jne    803169 <__rodata_start+0x1a9>
+  8030f9:	74 65                	je     803160 <__rodata_start+0x1a0>
+  8030fb:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  803100:	75 67                	jne    803169 <__rodata_start+0x1a9>
+  803102:	20 69 6e             	and    %ch,0x6e(%rcx)
+  803105:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  803107:	00 73 65             	add    %dh,0x65(%rbx)
+  80310a:	67 6d                	insl   (%dx),%es:(%edi)
+  80310c:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  80310e:	74 61                	je     803171 <__rodata_start+0x1b1>
+  803110:	74 69                	je     80317b <__rodata_start+0x1bb>
+  803112:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803113:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803114:	20 66 61             	and    %ah,0x61(%rsi)
+  803117:	75 6c                	jne    803185 <__rodata_start+0x1c5>
+  803119:	74 00                	je     80311b <__rodata_start+0x15b>
+  80311b:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  803122:	20 45 4c             	and    %al,0x4c(%rbp)
+  803125:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  803129:	61                   	(bad)
+  80312a:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  80312f:	20 73 75             	and    %dh,0x75(%rbx)
+  803132:	63 68 20             	movsxd 0x20(%rax),%ebp
+  803135:	73 79                	jae    8031b0 <__rodata_start+0x1f0>
+  803137:	73 74                	jae    8031ad <__rodata_start+0x1ed>
+  803139:	65 6d                	gs insl (%dx),%es:(%rdi)
+  80313b:	20 63 61             	and    %ah,0x61(%rbx)
+  80313e:	6c                   	insb   (%dx),%es:(%rdi)
+  80313f:	6c                   	insb   (%dx),%es:(%rdi)
+  803140:	00 65 6e             	add    %ah,0x6e(%rbp)
+  803143:	74 72                	je     8031b7 <__rodata_start+0x1f7>
+  803145:	79 20                	jns    803167 <__rodata_start+0x1a7>
+  803147:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803148:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803149:	74 20                	je     80316b <__rodata_start+0x1ab>
+  80314b:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  80314d:	75 6e                	jne    8031bd <__rodata_start+0x1fd>
+  80314f:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  803153:	76 20                	jbe    803175 <__rodata_start+0x1b5>
+  803155:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  80315c:	72 65                	jb     8031c3 <__rodata_start+0x203>
+  80315e:	63 76 69             	movsxd 0x69(%rsi),%esi
+  803161:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803162:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  803166:	65 78 70             	gs js  8031d9 <__rodata_start+0x219>
+  803169:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  80316e:	20 65 6e             	and    %ah,0x6e(%rbp)
+  803171:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  803175:	20 66 69             	and    %ah,0x69(%rsi)
+  803178:	6c                   	insb   (%dx),%es:(%rdi)
+  803179:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  80317d:	20 66 72             	and    %ah,0x72(%rsi)
+  803180:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  803185:	61                   	(bad)
+  803186:	63 65 20             	movsxd 0x20(%rbp),%esp
+  803189:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80318a:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80318b:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  80318f:	6b 00 74             	imul   $0x74,(%rax),%eax
+  803192:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803193:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803194:	20 6d 61             	and    %ch,0x61(%rbp)
+  803197:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803198:	79 20                	jns    8031ba <__rodata_start+0x1fa>
+  80319a:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  8031a1:	72 65                	jb     803208 <__rodata_start+0x248>
+  8031a3:	20 6f 70             	and    %ch,0x70(%rdi)
+  8031a6:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  8031a8:	00 66 69             	add    %ah,0x69(%rsi)
+  8031ab:	6c                   	insb   (%dx),%es:(%rdi)
+  8031ac:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  8031b0:	20 62 6c             	and    %ah,0x6c(%rdx)
+  8031b3:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8031b4:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  8031b7:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8031b8:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8031b9:	74 20                	je     8031db <__rodata_start+0x21b>
+  8031bb:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  8031bd:	75 6e                	jne    80322d <__rodata_start+0x26d>
+  8031bf:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  8031c3:	76 61                	jbe    803226 <__rodata_start+0x266>
+  8031c5:	6c                   	insb   (%dx),%es:(%rdi)
+  8031c6:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  8031cd:	00 
+  8031ce:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  8031d5:	72 65                	jb     80323c <__rodata_start+0x27c>
+  8031d7:	61                   	(bad)
+  8031d8:	64 79 20             	fs jns 8031fb <__rodata_start+0x23b>
+  8031db:	65 78 69             	gs js  803247 <__rodata_start+0x287>
+  8031de:	73 74                	jae    803254 <__rodata_start+0x294>
+  8031e0:	73 00                	jae    8031e2 <__rodata_start+0x222>
+  8031e2:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8031e3:	70 65                	jo     80324a <__rodata_start+0x28a>
+  8031e5:	72 61                	jb     803248 <__rodata_start+0x288>
+  8031e7:	74 69                	je     803252 <__rodata_start+0x292>
+  8031e9:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8031ea:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8031eb:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  8031ee:	74 20                	je     803210 <__rodata_start+0x250>
+  8031f0:	73 75                	jae    803267 <__rodata_start+0x2a7>
+  8031f2:	70 70                	jo     803264 <__rodata_start+0x2a4>
+  8031f4:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8031f5:	72 74                	jb     80326b <__rodata_start+0x2ab>
+  8031f7:	65 64 00 6f 70       	gs add %ch,%fs:0x70(%rdi)
+  8031fc:	65 72 61             	gs jb  803260 <__rodata_start+0x2a0>
+  8031ff:	74 69                	je     80326a <__rodata_start+0x2aa>
+  803201:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803202:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803203:	20 69 6e             	and    %ch,0x6e(%rcx)
+  803206:	74 65                	je     80326d <__rodata_start+0x2ad>
+  803208:	72 72                	jb     80327c <__rodata_start+0x2bc>
+  80320a:	75 70                	jne    80327c <__rodata_start+0x2bc>
+  80320c:	74 65                	je     803273 <__rodata_start+0x2b3>
+  80320e:	64 00 6e 6f          	add    %ch,%fs:0x6f(%rsi)
+  803212:	74 20                	je     803234 <__rodata_start+0x274>
+  803214:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803216:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803217:	75 67                	jne    803280 <__rodata_start+0x2c0>
+  803219:	68 20 43 50 55       	push   $0x55504320
+  80321e:	20 74 69 6d          	and    %dh,0x6d(%rcx,%rbp,2)
+  803222:	65 00 66 2e          	add    %ah,%gs:0x2e(%rsi)
+  803226:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+  80322d:	00 
+  80322e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  803235:	00 00 00 
+  803238:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+  80323f:	00 
+  803240:	18 06                	sbb    %al,(%rsi)
+  803242:	80 00 00             	addb   $0x0,(%rax)
+  803245:	00 00                	add    %al,(%rax)
+  803247:	00 59 0c             	add    %bl,0xc(%rcx)
+  80324a:	80 00 00             	addb   $0x0,(%rax)
+  80324d:	00 00                	add    %al,(%rax)
+  80324f:	00 49 0c             	add    %cl,0xc(%rcx)
+  803252:	80 00 00             	addb   $0x0,(%rax)
+  803255:	00 00                	add    %al,(%rax)
+  803257:	00 59 0c             	add    %bl,0xc(%rcx)
+  80325a:	80 00 00             	addb   $0x0,(%rax)
+  80325d:	00 00                	add    %al,(%rax)
+  80325f:	00 59 0c             	add    %bl,0xc(%rcx)
+  803262:	80 00 00             	addb   $0x0,(%rax)
+  803265:	00 00                	add    %al,(%rax)
+  803267:	00 59 0c             	add    %bl,0xc(%rcx)
+  80326a:	80 00 00             	addb   $0x0,(%rax)
+  80326d:	00 00                	add    %al,(%rax)
+  80326f:	00 59 0c             	add    %bl,0xc(%rcx)
+  803272:	80 00 00             	addb   $0x0,(%rax)
+  803275:	00 00                	add    %al,(%rax)
+  803277:	00 37                	add    %dh,(%rdi)
+  803279:	06                   	(bad)
+  80327a:	80 00 00             	addb   $0x0,(%rax)
+  80327d:	00 00                	add    %al,(%rax)
+  80327f:	00 59 0c             	add    %bl,0xc(%rcx)
+  803282:	80 00 00             	addb   $0x0,(%rax)
+  803285:	00 00                	add    %al,(%rax)
+  803287:	00 59 0c             	add    %bl,0xc(%rcx)
+  80328a:	80 00 00             	addb   $0x0,(%rax)
+  80328d:	00 00                	add    %al,(%rax)
+  80328f:	00 2b                	add    %ch,(%rbx)
+  803291:	06                   	(bad)
+  803292:	80 00 00             	addb   $0x0,(%rax)
+  803295:	00 00                	add    %al,(%rax)
+  803297:	00 a5 06 80 00 00    	add    %ah,0x8006(%rbp)
+  80329d:	00 00                	add    %al,(%rax)
+  80329f:	00 59 0c             	add    %bl,0xc(%rcx)
+  8032a2:	80 00 00             	addb   $0x0,(%rax)
+  8032a5:	00 00                	add    %al,(%rax)
+  8032a7:	00 2b                	add    %ch,(%rbx)
+  8032a9:	06                   	(bad)
+  8032aa:	80 00 00             	addb   $0x0,(%rax)
+  8032ad:	00 00                	add    %al,(%rax)
+  8032af:	00 71 06             	add    %dh,0x6(%rcx)
+  8032b2:	80 00 00             	addb   $0x0,(%rax)
+  8032b5:	00 00                	add    %al,(%rax)
+  8032b7:	00 71 06             	add    %dh,0x6(%rcx)
+  8032ba:	80 00 00             	addb   $0x0,(%rax)
+  8032bd:	00 00                	add    %al,(%rax)
+  8032bf:	00 71 06             	add    %dh,0x6(%rcx)
+  8032c2:	80 00 00             	addb   $0x0,(%rax)
+  8032c5:	00 00                	add    %al,(%rax)
+  8032c7:	00 71 06             	add    %dh,0x6(%rcx)
+  8032ca:	80 00 00             	addb   $0x0,(%rax)
+  8032cd:	00 00                	add    %al,(%rax)
+  8032cf:	00 71 06             	add    %dh,0x6(%rcx)
+  8032d2:	80 00 00             	addb   $0x0,(%rax)
+  8032d5:	00 00                	add    %al,(%rax)
+  8032d7:	00 71 06             	add    %dh,0x6(%rcx)
+  8032da:	80 00 00             	addb   $0x0,(%rax)
+  8032dd:	00 00                	add    %al,(%rax)
+  8032df:	00 71 06             	add    %dh,0x6(%rcx)
+  8032e2:	80 00 00             	addb   $0x0,(%rax)
+  8032e5:	00 00                	add    %al,(%rax)
+  8032e7:	00 71 06             	add    %dh,0x6(%rcx)
+  8032ea:	80 00 00             	addb   $0x0,(%rax)
+  8032ed:	00 00                	add    %al,(%rax)
+  8032ef:	00 71 06             	add    %dh,0x6(%rcx)
+  8032f2:	80 00 00             	addb   $0x0,(%rax)
+  8032f5:	00 00                	add    %al,(%rax)
+  8032f7:	00 59 0c             	add    %bl,0xc(%rcx)
+  8032fa:	80 00 00             	addb   $0x0,(%rax)
+  8032fd:	00 00                	add    %al,(%rax)
+  8032ff:	00 59 0c             	add    %bl,0xc(%rcx)
+  803302:	80 00 00             	addb   $0x0,(%rax)
+  803305:	00 00                	add    %al,(%rax)
+  803307:	00 59 0c             	add    %bl,0xc(%rcx)
+  80330a:	80 00 00             	addb   $0x0,(%rax)
+  80330d:	00 00                	add    %al,(%rax)
+  80330f:	00 59 0c             	add    %bl,0xc(%rcx)
+  803312:	80 00 00             	addb   $0x0,(%rax)
+  803315:	00 00                	add    %al,(%rax)
+  803317:	00 59 0c             	add    %bl,0xc(%rcx)
+  80331a:	80 00 00             	addb   $0x0,(%rax)
+  80331d:	00 00                	add    %al,(%rax)
+  80331f:	00 59 0c             	add    %bl,0xc(%rcx)
+  803322:	80 00 00             	addb   $0x0,(%rax)
+  803325:	00 00                	add    %al,(%rax)
+  803327:	00 59 0c             	add    %bl,0xc(%rcx)
+  80332a:	80 00 00             	addb   $0x0,(%rax)
+  80332d:	00 00                	add    %al,(%rax)
+  80332f:	00 59 0c             	add    %bl,0xc(%rcx)
+  803332:	80 00 00             	addb   $0x0,(%rax)
+  803335:	00 00                	add    %al,(%rax)
+  803337:	00 59 0c             	add    %bl,0xc(%rcx)
+  80333a:	80 00 00             	addb   $0x0,(%rax)
+  80333d:	00 00                	add    %al,(%rax)
+  80333f:	00 59 0c             	add    %bl,0xc(%rcx)
+  803342:	80 00 00             	addb   $0x0,(%rax)
+  803345:	00 00                	add    %al,(%rax)
+  803347:	00 59 0c             	add    %bl,0xc(%rcx)
+  80334a:	80 00 00             	addb   $0x0,(%rax)
+  80334d:	00 00                	add    %al,(%rax)
+  80334f:	00 59 0c             	add    %bl,0xc(%rcx)
+  803352:	80 00 00             	addb   $0x0,(%rax)
+  803355:	00 00                	add    %al,(%rax)
+  803357:	00 59 0c             	add    %bl,0xc(%rcx)
+  80335a:	80 00 00             	addb   $0x0,(%rax)
+  80335d:	00 00                	add    %al,(%rax)
+  80335f:	00 59 0c             	add    %bl,0xc(%rcx)
+  803362:	80 00 00             	addb   $0x0,(%rax)
+  803365:	00 00                	add    %al,(%rax)
+  803367:	00 59 0c             	add    %bl,0xc(%rcx)
+  80336a:	80 00 00             	addb   $0x0,(%rax)
+  80336d:	00 00                	add    %al,(%rax)
+  80336f:	00 59 0c             	add    %bl,0xc(%rcx)
+  803372:	80 00 00             	addb   $0x0,(%rax)
+  803375:	00 00                	add    %al,(%rax)
+  803377:	00 59 0c             	add    %bl,0xc(%rcx)
+  80337a:	80 00 00             	addb   $0x0,(%rax)
+  80337d:	00 00                	add    %al,(%rax)
+  80337f:	00 59 0c             	add    %bl,0xc(%rcx)
+  803382:	80 00 00             	addb   $0x0,(%rax)
+  803385:	00 00                	add    %al,(%rax)
+  803387:	00 59 0c             	add    %bl,0xc(%rcx)
+  80338a:	80 00 00             	addb   $0x0,(%rax)
+  80338d:	00 00                	add    %al,(%rax)
+  80338f:	00 59 0c             	add    %bl,0xc(%rcx)
+  803392:	80 00 00             	addb   $0x0,(%rax)
+  803395:	00 00                	add    %al,(%rax)
+  803397:	00 59 0c             	add    %bl,0xc(%rcx)
+  80339a:	80 00 00             	addb   $0x0,(%rax)
+  80339d:	00 00                	add    %al,(%rax)
+  80339f:	00 59 0c             	add    %bl,0xc(%rcx)
+  8033a2:	80 00 00             	addb   $0x0,(%rax)
+  8033a5:	00 00                	add    %al,(%rax)
+  8033a7:	00 59 0c             	add    %bl,0xc(%rcx)
+  8033aa:	80 00 00             	addb   $0x0,(%rax)
+  8033ad:	00 00                	add    %al,(%rax)
+  8033af:	00 59 0c             	add    %bl,0xc(%rcx)
+  8033b2:	80 00 00             	addb   $0x0,(%rax)
+  8033b5:	00 00                	add    %al,(%rax)
+  8033b7:	00 59 0c             	add    %bl,0xc(%rcx)
+  8033ba:	80 00 00             	addb   $0x0,(%rax)
+  8033bd:	00 00                	add    %al,(%rax)
+  8033bf:	00 59 0c             	add    %bl,0xc(%rcx)
+  8033c2:	80 00 00             	addb   $0x0,(%rax)
+  8033c5:	00 00                	add    %al,(%rax)
+  8033c7:	00 59 0c             	add    %bl,0xc(%rcx)
+  8033ca:	80 00 00             	addb   $0x0,(%rax)
+  8033cd:	00 00                	add    %al,(%rax)
+  8033cf:	00 59 0c             	add    %bl,0xc(%rcx)
+  8033d2:	80 00 00             	addb   $0x0,(%rax)
+  8033d5:	00 00                	add    %al,(%rax)
+  8033d7:	00 59 0c             	add    %bl,0xc(%rcx)
+  8033da:	80 00 00             	addb   $0x0,(%rax)
+  8033dd:	00 00                	add    %al,(%rax)
+  8033df:	00 59 0c             	add    %bl,0xc(%rcx)
+  8033e2:	80 00 00             	addb   $0x0,(%rax)
+  8033e5:	00 00                	add    %al,(%rax)
+  8033e7:	00 7c 0b 80          	add    %bh,-0x80(%rbx,%rcx,1)
+  8033eb:	00 00                	add    %al,(%rax)
+  8033ed:	00 00                	add    %al,(%rax)
+  8033ef:	00 59 0c             	add    %bl,0xc(%rcx)
+  8033f2:	80 00 00             	addb   $0x0,(%rax)
+  8033f5:	00 00                	add    %al,(%rax)
+  8033f7:	00 59 0c             	add    %bl,0xc(%rcx)
+  8033fa:	80 00 00             	addb   $0x0,(%rax)
+  8033fd:	00 00                	add    %al,(%rax)
+  8033ff:	00 59 0c             	add    %bl,0xc(%rcx)
+  803402:	80 00 00             	addb   $0x0,(%rax)
+  803405:	00 00                	add    %al,(%rax)
+  803407:	00 59 0c             	add    %bl,0xc(%rcx)
+  80340a:	80 00 00             	addb   $0x0,(%rax)
+  80340d:	00 00                	add    %al,(%rax)
+  80340f:	00 59 0c             	add    %bl,0xc(%rcx)
+  803412:	80 00 00             	addb   $0x0,(%rax)
+  803415:	00 00                	add    %al,(%rax)
+  803417:	00 59 0c             	add    %bl,0xc(%rcx)
+  80341a:	80 00 00             	addb   $0x0,(%rax)
+  80341d:	00 00                	add    %al,(%rax)
+  80341f:	00 59 0c             	add    %bl,0xc(%rcx)
+  803422:	80 00 00             	addb   $0x0,(%rax)
+  803425:	00 00                	add    %al,(%rax)
+  803427:	00 59 0c             	add    %bl,0xc(%rcx)
+  80342a:	80 00 00             	addb   $0x0,(%rax)
+  80342d:	00 00                	add    %al,(%rax)
+  80342f:	00 59 0c             	add    %bl,0xc(%rcx)
+  803432:	80 00 00             	addb   $0x0,(%rax)
+  803435:	00 00                	add    %al,(%rax)
+  803437:	00 59 0c             	add    %bl,0xc(%rcx)
+  80343a:	80 00 00             	addb   $0x0,(%rax)
+  80343d:	00 00                	add    %al,(%rax)
+  80343f:	00 c8                	add    %cl,%al
+  803441:	06                   	(bad)
+  803442:	80 00 00             	addb   $0x0,(%rax)
+  803445:	00 00                	add    %al,(%rax)
+  803447:	00 97 08 80 00 00    	add    %dl,0x8008(%rdi)
+  80344d:	00 00                	add    %al,(%rax)
+  80344f:	00 59 0c             	add    %bl,0xc(%rcx)
+  803452:	80 00 00             	addb   $0x0,(%rax)
+  803455:	00 00                	add    %al,(%rax)
+  803457:	00 59 0c             	add    %bl,0xc(%rcx)
+  80345a:	80 00 00             	addb   $0x0,(%rax)
+  80345d:	00 00                	add    %al,(%rax)
+  80345f:	00 59 0c             	add    %bl,0xc(%rcx)
+  803462:	80 00 00             	addb   $0x0,(%rax)
+  803465:	00 00                	add    %al,(%rax)
+  803467:	00 59 0c             	add    %bl,0xc(%rcx)
+  80346a:	80 00 00             	addb   $0x0,(%rax)
+  80346d:	00 00                	add    %al,(%rax)
+  80346f:	00 f7                	add    %dh,%bh
+  803471:	06                   	(bad)
+  803472:	80 00 00             	addb   $0x0,(%rax)
+  803475:	00 00                	add    %al,(%rax)
+  803477:	00 59 0c             	add    %bl,0xc(%rcx)
+  80347a:	80 00 00             	addb   $0x0,(%rax)
+  80347d:	00 00                	add    %al,(%rax)
+  80347f:	00 59 0c             	add    %bl,0xc(%rcx)
+  803482:	80 00 00             	addb   $0x0,(%rax)
+  803485:	00 00                	add    %al,(%rax)
+  803487:	00 bd 06 80 00 00    	add    %bh,0x8006(%rbp)
+  80348d:	00 00                	add    %al,(%rax)
+  80348f:	00 59 0c             	add    %bl,0xc(%rcx)
+  803492:	80 00 00             	addb   $0x0,(%rax)
+  803495:	00 00                	add    %al,(%rax)
+  803497:	00 59 0c             	add    %bl,0xc(%rcx)
+  80349a:	80 00 00             	addb   $0x0,(%rax)
+  80349d:	00 00                	add    %al,(%rax)
+  80349f:	00 3f                	add    %bh,(%rdi)
+  8034a1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8034a7:	00 09                	add    %cl,(%rcx)
+  8034a9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  8034af:	00 59 0c             	add    %bl,0xc(%rcx)
+  8034b2:	80 00 00             	addb   $0x0,(%rax)
+  8034b5:	00 00                	add    %al,(%rax)
+  8034b7:	00 59 0c             	add    %bl,0xc(%rcx)
+  8034ba:	80 00 00             	addb   $0x0,(%rax)
+  8034bd:	00 00                	add    %al,(%rax)
+  8034bf:	00 8e 07 80 00 00    	add    %cl,0x8007(%rsi)
+  8034c5:	00 00                	add    %al,(%rax)
+  8034c7:	00 59 0c             	add    %bl,0xc(%rcx)
+  8034ca:	80 00 00             	addb   $0x0,(%rax)
+  8034cd:	00 00                	add    %al,(%rax)
+  8034cf:	00 6b 09             	add    %ch,0x9(%rbx)
+  8034d2:	80 00 00             	addb   $0x0,(%rax)
+  8034d5:	00 00                	add    %al,(%rax)
+  8034d7:	00 59 0c             	add    %bl,0xc(%rcx)
+  8034da:	80 00 00             	addb   $0x0,(%rax)
+  8034dd:	00 00                	add    %al,(%rax)
+  8034df:	00 59 0c             	add    %bl,0xc(%rcx)
+  8034e2:	80 00 00             	addb   $0x0,(%rax)
+  8034e5:	00 00                	add    %al,(%rax)
+  8034e7:	00 7c 0b 80          	add    %bh,-0x80(%rbx,%rcx,1)
+  8034eb:	00 00                	add    %al,(%rax)
+  8034ed:	00 00                	add    %al,(%rax)
+  8034ef:	00 59 0c             	add    %bl,0xc(%rcx)
+  8034f2:	80 00 00             	addb   $0x0,(%rax)
+  8034f5:	00 00                	add    %al,(%rax)
+  8034f7:	00 21                	add    %ah,(%rcx)
+  8034f9:	06                   	(bad)
+  8034fa:	80 00 00             	addb   $0x0,(%rax)
+  8034fd:	00 00                	add    %al,(%rax)
+	...
+
+0000000000803500 <error_string>:
+	...
+  803508:	9d 30 80 00 00 00 00 00 af 30 80 00 00 00 00 00     .0.......0......
+  803518:	bf 30 80 00 00 00 00 00 d1 30 80 00 00 00 00 00     .0.......0......
+  803528:	df 30 80 00 00 00 00 00 f3 30 80 00 00 00 00 00     .0.......0......
+  803538:	08 31 80 00 00 00 00 00 1b 31 80 00 00 00 00 00     .1.......1......
+  803548:	2d 31 80 00 00 00 00 00 41 31 80 00 00 00 00 00     -1......A1......
+  803558:	51 31 80 00 00 00 00 00 64 31 80 00 00 00 00 00     Q1......d1......
+  803568:	7b 31 80 00 00 00 00 00 91 31 80 00 00 00 00 00     {1.......1......
+  803578:	a9 31 80 00 00 00 00 00 c1 31 80 00 00 00 00 00     .1.......1......
+  803588:	ce 31 80 00 00 00 00 00 b0 35 80 00 00 00 00 00     .1.......5......
+  803598:	e2 31 80 00 00 00 00 00 fa 31 80 00 00 00 00 00     .1.......1......
+  8035a8:	10 32 80 00 00 00 00 00 66 69 6c 65 20 69 73 20     .2......file is 
+  8035b8:	6e 6f 74 20 61 20 76 61 6c 69 64 20 65 78 65 63     not a valid exec
+  8035c8:	75 74 61 62 6c 65 00 90 73 79 73 63 61 6c 6c 20     utable..syscall 
+  8035d8:	25 7a 64 20 72 65 74 75 72 6e 65 64 20 25 7a 64     %zd returned %zd
+  8035e8:	20 28 3e 20 30 29 00 6c 69 62 2f 73 79 73 63 61      (> 0).lib/sysca
+  8035f8:	6c 6c 2e 63 00 46 6f 72 6b 20 64 6f 75 62 6c 65     ll.c.Fork double
+  803608:	20 66 61 75 6c 74 00 6c 69 62 2f 66 6f 72 6b 2e      fault.lib/fork.
+  803618:	63 00 73 66 6f 72 6b 28 29 20 69 73 20 6e 6f 74     c.sfork() is not
+  803628:	20 69 6d 70 6c 65 6d 65 6e 74 65 64 00 73 79 73      implemented.sys
+  803638:	5f 69 70 63 5f 74 72 79 5f 73 65 6e 64 20 66 61     _ipc_try_send fa
+  803648:	69 6c 65 64 3a 20 25 69 00 6c 69 62 2f 69 70 63     iled: %i.lib/ipc
+  803658:	2e 63 00 0f 1f 44 00 00 5b 25 30 38 78 5d 20 75     .c...D..[%08x] u
+  803668:	6e 6b 6e 6f 77 6e 20 64 65 76 69 63 65 20 74 79     nknown device ty
+  803678:	70 65 20 25 64 0a 00 00 5b 25 30 38 78 5d 20 66     pe %d...[%08x] f
+  803688:	74 72 75 6e 63 61 74 65 20 25 64 20 2d 2d 20 62     truncate %d -- b
+  803698:	61 64 20 6d 6f 64 65 0a 00 5b 25 30 38 78 5d 20     ad mode..[%08x] 
+  8036a8:	72 65 61 64 20 25 64 20 2d 2d 20 62 61 64 20 6d     read %d -- bad m
+  8036b8:	6f 64 65 0a 00 5b 25 30 38 78 5d 20 77 72 69 74     ode..[%08x] writ
+  8036c8:	65 20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65     e %d -- bad mode
+  8036d8:	0a 00 66 0f 1f 44 00 00                             ..f..D..
+
+00000000008036e0 <devtab>:
+  8036e0:	20 40 80 00 00 00 00 00 60 40 80 00 00 00 00 00      @......`@......
+  8036f0:	a0 40 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .@..............
+  803700:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  803710:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  803720:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  803730:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  803740:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  803750:	3d 20 32 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73 00     = 2.<cons>.cons.
+  803760:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803770:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803780:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803790:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8037a0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8037b0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8037c0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8037d0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8037e0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8037f0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803800:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803810:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803820:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803830:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803840:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803850:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803860:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803870:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803880:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803890:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8038a0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8038b0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8038c0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8038d0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8038e0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8038f0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803900:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803910:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803920:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803930:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803940:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803950:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803960:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803970:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803980:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803990:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8039a0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8039b0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8039c0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8039d0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8039e0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8039f0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803a00:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803a10:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803a20:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803a30:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803a40:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803a50:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803a60:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803a70:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803a80:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803a90:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803aa0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803ab0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803ac0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803ad0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803ae0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803af0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803b00:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803b10:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803b20:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803b30:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803b40:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803b50:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803b60:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803b70:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803b80:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803b90:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803ba0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803bb0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803bc0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803bd0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803be0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803bf0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803c00:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803c10:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803c20:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803c30:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803c40:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803c50:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803c60:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803c70:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803c80:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803c90:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803ca0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803cb0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803cc0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803cd0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803ce0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803cf0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803d00:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803d10:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803d20:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803d30:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803d40:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803d50:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803d60:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803d70:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803d80:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803d90:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803da0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803db0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803dc0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803dd0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803de0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803df0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803e00:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803e10:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803e20:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803e30:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803e40:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803e50:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803e60:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803e70:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803e80:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803e90:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803ea0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803eb0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803ec0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803ed0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803ee0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803ef0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803f00:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803f10:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803f20:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803f30:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803f40:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803f50:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803f60:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803f70:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803f80:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803f90:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803fa0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803fb0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803fc0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803fd0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803fe0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803ff0:	0f 1f 84 00 00 00 00 00 0f 1f 84 00 00 00 00 00     ................
@@ -0,0 +1,5756 @@
+
+obj/user/fairness:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 dc 00 00 00       	call   8000ff <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+ * (user/idle is env 0). */
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 56                	push   %r14
+  80002b:	41 55                	push   %r13
+  80002d:	41 54                	push   %r12
+  80002f:	53                   	push   %rbx
+  800030:	48 83 ec 10          	sub    $0x10,%rsp
+    envid_t who, id;
+
+    id = sys_getenvid();
+  800034:	48 b8 8d 10 80 00 00 	movabs $0x80108d,%rax
+  80003b:	00 00 00 
+  80003e:	ff d0                	call   *%rax
+  800040:	89 c3                	mov    %eax,%ebx
+
+    if (thisenv == &envs[1]) {
+  800042:	48 ba 00 50 80 00 00 	movabs $0x805000,%rdx
+  800049:	00 00 00 
+  80004c:	48 b8 d0 01 c0 1f 80 	movabs $0x801fc001d0,%rax
+  800053:	00 00 00 
+  800056:	48 39 02             	cmp    %rax,(%rdx)
+  800059:	74 5e                	je     8000b9 <umain+0x94>
+        while (1) {
+            ipc_recv(&who, NULL, NULL, NULL);
+            cprintf("%x recv from %x\n", id, who);
+        }
+    } else {
+        cprintf("%x loop sending to %x\n", id, envs[1].env_id);
+  80005b:	48 b8 b0 02 c0 1f 80 	movabs $0x801fc002b0,%rax
+  800062:	00 00 00 
+  800065:	8b 10                	mov    (%rax),%edx
+  800067:	89 de                	mov    %ebx,%esi
+  800069:	48 bf 61 2d 80 00 00 	movabs $0x802d61,%rdi
+  800070:	00 00 00 
+  800073:	b8 00 00 00 00       	mov    $0x0,%eax
+  800078:	48 b9 78 02 80 00 00 	movabs $0x800278,%rcx
+  80007f:	00 00 00 
+  800082:	ff d1                	call   *%rcx
+        while (1)
+            ipc_send(envs[1].env_id, 0, NULL, 0, 0);
+  800084:	49 bc 00 00 c0 1f 80 	movabs $0x801fc00000,%r12
+  80008b:	00 00 00 
+  80008e:	48 bb 5d 16 80 00 00 	movabs $0x80165d,%rbx
+  800095:	00 00 00 
+  800098:	41 8b bc 24 b0 02 00 	mov    0x2b0(%r12),%edi
+  80009f:	00 
+  8000a0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8000a6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8000ab:	ba 00 00 00 00       	mov    $0x0,%edx
+  8000b0:	be 00 00 00 00       	mov    $0x0,%esi
+  8000b5:	ff d3                	call   *%rbx
+        while (1)
+  8000b7:	eb df                	jmp    800098 <umain+0x73>
+            ipc_recv(&who, NULL, NULL, NULL);
+  8000b9:	49 be 88 15 80 00 00 	movabs $0x801588,%r14
+  8000c0:	00 00 00 
+            cprintf("%x recv from %x\n", id, who);
+  8000c3:	49 bd 50 2d 80 00 00 	movabs $0x802d50,%r13
+  8000ca:	00 00 00 
+  8000cd:	49 bc 78 02 80 00 00 	movabs $0x800278,%r12
+  8000d4:	00 00 00 
+            ipc_recv(&who, NULL, NULL, NULL);
+  8000d7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8000dc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8000e1:	be 00 00 00 00       	mov    $0x0,%esi
+  8000e6:	48 8d 7d dc          	lea    -0x24(%rbp),%rdi
+  8000ea:	41 ff d6             	call   *%r14
+            cprintf("%x recv from %x\n", id, who);
+  8000ed:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  8000f0:	89 de                	mov    %ebx,%esi
+  8000f2:	4c 89 ef             	mov    %r13,%rdi
+  8000f5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000fa:	41 ff d4             	call   *%r12
+        while (1) {
+  8000fd:	eb d8                	jmp    8000d7 <umain+0xb2>
+
+00000000008000ff <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  8000ff:	55                   	push   %rbp
+  800100:	48 89 e5             	mov    %rsp,%rbp
+  800103:	41 56                	push   %r14
+  800105:	41 55                	push   %r13
+  800107:	41 54                	push   %r12
+  800109:	53                   	push   %rbx
+  80010a:	41 89 fd             	mov    %edi,%r13d
+  80010d:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800110:	48 ba d8 40 80 00 00 	movabs $0x8040d8,%rdx
+  800117:	00 00 00 
+  80011a:	48 b8 d8 40 80 00 00 	movabs $0x8040d8,%rax
+  800121:	00 00 00 
+  800124:	48 39 c2             	cmp    %rax,%rdx
+  800127:	73 17                	jae    800140 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  800129:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  80012c:	49 89 c4             	mov    %rax,%r12
+  80012f:	48 83 c3 08          	add    $0x8,%rbx
+  800133:	b8 00 00 00 00       	mov    $0x0,%eax
+  800138:	ff 53 f8             	call   *-0x8(%rbx)
+  80013b:	4c 39 e3             	cmp    %r12,%rbx
+  80013e:	72 ef                	jb     80012f <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+    envid_t this_env_id = sys_getenvid();
+  800140:	48 b8 8d 10 80 00 00 	movabs $0x80108d,%rax
+  800147:	00 00 00 
+  80014a:	ff d0                	call   *%rax
+    thisenv = &((struct Env*)UENVS)[ENVX(this_env_id)];
+  80014c:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800151:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+  800158:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  80015f:	00 00 00 
+  800162:	48 01 d0             	add    %rdx,%rax
+  800165:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  80016c:	00 00 00 
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  80016f:	45 85 ed             	test   %r13d,%r13d
+  800172:	7e 0d                	jle    800181 <libmain+0x82>
+  800174:	49 8b 06             	mov    (%r14),%rax
+  800177:	48 a3 00 40 80 00 00 	movabs %rax,0x804000
+  80017e:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  800181:	4c 89 f6             	mov    %r14,%rsi
+  800184:	44 89 ef             	mov    %r13d,%edi
+  800187:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  80018e:	00 00 00 
+  800191:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  800193:	48 b8 a8 01 80 00 00 	movabs $0x8001a8,%rax
+  80019a:	00 00 00 
+  80019d:	ff d0                	call   *%rax
+#endif
+}
+  80019f:	5b                   	pop    %rbx
+  8001a0:	41 5c                	pop    %r12
+  8001a2:	41 5d                	pop    %r13
+  8001a4:	41 5e                	pop    %r14
+  8001a6:	5d                   	pop    %rbp
+  8001a7:	c3                   	ret
+
+00000000008001a8 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8001a8:	55                   	push   %rbp
+  8001a9:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  8001ac:	48 b8 a9 19 80 00 00 	movabs $0x8019a9,%rax
+  8001b3:	00 00 00 
+  8001b6:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  8001b8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8001bd:	48 b8 22 10 80 00 00 	movabs $0x801022,%rax
+  8001c4:	00 00 00 
+  8001c7:	ff d0                	call   *%rax
+}
+  8001c9:	5d                   	pop    %rbp
+  8001ca:	c3                   	ret
+
+00000000008001cb <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  8001cb:	55                   	push   %rbp
+  8001cc:	48 89 e5             	mov    %rsp,%rbp
+  8001cf:	53                   	push   %rbx
+  8001d0:	48 83 ec 08          	sub    $0x8,%rsp
+  8001d4:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  8001d7:	8b 06                	mov    (%rsi),%eax
+  8001d9:	8d 50 01             	lea    0x1(%rax),%edx
+  8001dc:	89 16                	mov    %edx,(%rsi)
+  8001de:	48 98                	cltq
+  8001e0:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  8001e5:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  8001eb:	74 0a                	je     8001f7 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  8001ed:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  8001f1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8001f5:	c9                   	leave
+  8001f6:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  8001f7:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  8001fb:	be ff 00 00 00       	mov    $0xff,%esi
+  800200:	48 b8 c4 0f 80 00 00 	movabs $0x800fc4,%rax
+  800207:	00 00 00 
+  80020a:	ff d0                	call   *%rax
+        state->offset = 0;
+  80020c:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  800212:	eb d9                	jmp    8001ed <putch+0x22>
+
+0000000000800214 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  800214:	55                   	push   %rbp
+  800215:	48 89 e5             	mov    %rsp,%rbp
+  800218:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  80021f:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  800222:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  800229:	b9 21 00 00 00       	mov    $0x21,%ecx
+  80022e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800233:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  800236:	48 89 f1             	mov    %rsi,%rcx
+  800239:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  800240:	48 bf cb 01 80 00 00 	movabs $0x8001cb,%rdi
+  800247:	00 00 00 
+  80024a:	48 b8 c8 03 80 00 00 	movabs $0x8003c8,%rax
+  800251:	00 00 00 
+  800254:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  800256:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  80025d:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  800264:	48 b8 c4 0f 80 00 00 	movabs $0x800fc4,%rax
+  80026b:	00 00 00 
+  80026e:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  800270:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  800276:	c9                   	leave
+  800277:	c3                   	ret
+
+0000000000800278 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  800278:	55                   	push   %rbp
+  800279:	48 89 e5             	mov    %rsp,%rbp
+  80027c:	48 83 ec 50          	sub    $0x50,%rsp
+  800280:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  800284:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  800288:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80028c:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800290:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  800294:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  80029b:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80029f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8002a3:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8002a7:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  8002ab:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  8002af:	48 b8 14 02 80 00 00 	movabs $0x800214,%rax
+  8002b6:	00 00 00 
+  8002b9:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  8002bb:	c9                   	leave
+  8002bc:	c3                   	ret
+
+00000000008002bd <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  8002bd:	55                   	push   %rbp
+  8002be:	48 89 e5             	mov    %rsp,%rbp
+  8002c1:	41 57                	push   %r15
+  8002c3:	41 56                	push   %r14
+  8002c5:	41 55                	push   %r13
+  8002c7:	41 54                	push   %r12
+  8002c9:	53                   	push   %rbx
+  8002ca:	48 83 ec 18          	sub    $0x18,%rsp
+  8002ce:	49 89 fc             	mov    %rdi,%r12
+  8002d1:	49 89 f5             	mov    %rsi,%r13
+  8002d4:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8002d8:	8b 45 10             	mov    0x10(%rbp),%eax
+  8002db:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  8002de:	41 89 cf             	mov    %ecx,%r15d
+  8002e1:	4c 39 fa             	cmp    %r15,%rdx
+  8002e4:	73 5b                	jae    800341 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  8002e6:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  8002ea:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  8002ee:	85 db                	test   %ebx,%ebx
+  8002f0:	7e 0e                	jle    800300 <print_num+0x43>
+            putch(padc, put_arg);
+  8002f2:	4c 89 ee             	mov    %r13,%rsi
+  8002f5:	44 89 f7             	mov    %r14d,%edi
+  8002f8:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  8002fb:	83 eb 01             	sub    $0x1,%ebx
+  8002fe:	75 f2                	jne    8002f2 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  800300:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  800304:	48 b9 93 2d 80 00 00 	movabs $0x802d93,%rcx
+  80030b:	00 00 00 
+  80030e:	48 b8 82 2d 80 00 00 	movabs $0x802d82,%rax
+  800315:	00 00 00 
+  800318:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  80031c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800320:	ba 00 00 00 00       	mov    $0x0,%edx
+  800325:	49 f7 f7             	div    %r15
+  800328:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  80032c:	4c 89 ee             	mov    %r13,%rsi
+  80032f:	41 ff d4             	call   *%r12
+}
+  800332:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800336:	5b                   	pop    %rbx
+  800337:	41 5c                	pop    %r12
+  800339:	41 5d                	pop    %r13
+  80033b:	41 5e                	pop    %r14
+  80033d:	41 5f                	pop    %r15
+  80033f:	5d                   	pop    %rbp
+  800340:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  800341:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800345:	ba 00 00 00 00       	mov    $0x0,%edx
+  80034a:	49 f7 f7             	div    %r15
+  80034d:	48 83 ec 08          	sub    $0x8,%rsp
+  800351:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  800355:	52                   	push   %rdx
+  800356:	45 0f be c9          	movsbl %r9b,%r9d
+  80035a:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  80035e:	48 89 c2             	mov    %rax,%rdx
+  800361:	48 b8 bd 02 80 00 00 	movabs $0x8002bd,%rax
+  800368:	00 00 00 
+  80036b:	ff d0                	call   *%rax
+  80036d:	48 83 c4 10          	add    $0x10,%rsp
+  800371:	eb 8d                	jmp    800300 <print_num+0x43>
+
+0000000000800373 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  800373:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  800377:	48 8b 06             	mov    (%rsi),%rax
+  80037a:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  80037e:	73 0a                	jae    80038a <sprintputch+0x17>
+        *state->start++ = ch;
+  800380:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800384:	48 89 16             	mov    %rdx,(%rsi)
+  800387:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  80038a:	c3                   	ret
+
+000000000080038b <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  80038b:	55                   	push   %rbp
+  80038c:	48 89 e5             	mov    %rsp,%rbp
+  80038f:	48 83 ec 50          	sub    $0x50,%rsp
+  800393:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800397:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80039b:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  80039f:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8003a6:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8003aa:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8003ae:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8003b2:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  8003b6:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8003ba:	48 b8 c8 03 80 00 00 	movabs $0x8003c8,%rax
+  8003c1:	00 00 00 
+  8003c4:	ff d0                	call   *%rax
+}
+  8003c6:	c9                   	leave
+  8003c7:	c3                   	ret
+
+00000000008003c8 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  8003c8:	55                   	push   %rbp
+  8003c9:	48 89 e5             	mov    %rsp,%rbp
+  8003cc:	41 57                	push   %r15
+  8003ce:	41 56                	push   %r14
+  8003d0:	41 55                	push   %r13
+  8003d2:	41 54                	push   %r12
+  8003d4:	53                   	push   %rbx
+  8003d5:	48 83 ec 38          	sub    $0x38,%rsp
+  8003d9:	49 89 fe             	mov    %rdi,%r14
+  8003dc:	49 89 f5             	mov    %rsi,%r13
+  8003df:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  8003e2:	48 8b 01             	mov    (%rcx),%rax
+  8003e5:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8003e9:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  8003ed:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8003f1:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  8003f5:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  8003f9:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  8003fd:	0f b6 3b             	movzbl (%rbx),%edi
+  800400:	40 80 ff 25          	cmp    $0x25,%dil
+  800404:	74 18                	je     80041e <vprintfmt+0x56>
+            if (!ch) return;
+  800406:	40 84 ff             	test   %dil,%dil
+  800409:	0f 84 b1 06 00 00    	je     800ac0 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  80040f:	40 0f b6 ff          	movzbl %dil,%edi
+  800413:	4c 89 ee             	mov    %r13,%rsi
+  800416:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  800419:	4c 89 e3             	mov    %r12,%rbx
+  80041c:	eb db                	jmp    8003f9 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  80041e:	be 00 00 00 00       	mov    $0x0,%esi
+  800423:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  800427:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  80042c:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800432:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  800439:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  80043d:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  800442:	41 0f b6 04 24       	movzbl (%r12),%eax
+  800447:	88 45 a0             	mov    %al,-0x60(%rbp)
+  80044a:	83 e8 23             	sub    $0x23,%eax
+  80044d:	3c 57                	cmp    $0x57,%al
+  80044f:	0f 87 51 06 00 00    	ja     800aa6 <vprintfmt+0x6de>
+  800455:	0f b6 c0             	movzbl %al,%eax
+  800458:	48 b9 40 2f 80 00 00 	movabs $0x802f40,%rcx
+  80045f:	00 00 00 
+  800462:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  800465:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  800468:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  80046c:	eb cf                	jmp    80043d <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  80046e:	49 89 dc             	mov    %rbx,%r12
+  800471:	be 01 00 00 00       	mov    $0x1,%esi
+  800476:	eb c5                	jmp    80043d <vprintfmt+0x75>
+            padc = ch;
+  800478:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  80047c:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  80047f:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800482:	eb b9                	jmp    80043d <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800484:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800487:	83 f8 2f             	cmp    $0x2f,%eax
+  80048a:	77 24                	ja     8004b0 <vprintfmt+0xe8>
+  80048c:	89 c1                	mov    %eax,%ecx
+  80048e:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  800492:	83 c0 08             	add    $0x8,%eax
+  800495:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800498:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  80049b:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  80049e:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8004a2:	79 99                	jns    80043d <vprintfmt+0x75>
+                width = precision;
+  8004a4:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  8004a8:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8004ae:	eb 8d                	jmp    80043d <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8004b0:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8004b4:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  8004b8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8004bc:	eb da                	jmp    800498 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  8004be:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  8004c3:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8004c7:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  8004cd:	3c 39                	cmp    $0x39,%al
+  8004cf:	77 1c                	ja     8004ed <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  8004d1:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  8004d5:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  8004d9:	0f b6 c0             	movzbl %al,%eax
+  8004dc:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8004e1:	0f b6 03             	movzbl (%rbx),%eax
+  8004e4:	3c 39                	cmp    $0x39,%al
+  8004e6:	76 e9                	jbe    8004d1 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  8004e8:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  8004eb:	eb b1                	jmp    80049e <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  8004ed:	49 89 dc             	mov    %rbx,%r12
+  8004f0:	eb ac                	jmp    80049e <vprintfmt+0xd6>
+            width = MAX(0, width);
+  8004f2:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  8004f5:	85 c9                	test   %ecx,%ecx
+  8004f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004fc:	0f 49 c1             	cmovns %ecx,%eax
+  8004ff:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  800502:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800505:	e9 33 ff ff ff       	jmp    80043d <vprintfmt+0x75>
+            lflag++;
+  80050a:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  80050d:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800510:	e9 28 ff ff ff       	jmp    80043d <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  800515:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800518:	83 f8 2f             	cmp    $0x2f,%eax
+  80051b:	77 19                	ja     800536 <vprintfmt+0x16e>
+  80051d:	89 c2                	mov    %eax,%edx
+  80051f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800523:	83 c0 08             	add    $0x8,%eax
+  800526:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800529:	8b 3a                	mov    (%rdx),%edi
+  80052b:	4c 89 ee             	mov    %r13,%rsi
+  80052e:	41 ff d6             	call   *%r14
+            break;
+  800531:	e9 c3 fe ff ff       	jmp    8003f9 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  800536:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80053a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80053e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800542:	eb e5                	jmp    800529 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  800544:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800547:	83 f8 2f             	cmp    $0x2f,%eax
+  80054a:	77 5a                	ja     8005a6 <vprintfmt+0x1de>
+  80054c:	89 c2                	mov    %eax,%edx
+  80054e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800552:	83 c0 08             	add    $0x8,%eax
+  800555:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  800558:	8b 02                	mov    (%rdx),%eax
+  80055a:	89 c1                	mov    %eax,%ecx
+  80055c:	f7 d9                	neg    %ecx
+  80055e:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  800561:	83 f9 15             	cmp    $0x15,%ecx
+  800564:	7f 4e                	jg     8005b4 <vprintfmt+0x1ec>
+  800566:	48 63 c1             	movslq %ecx,%rax
+  800569:	48 ba 00 32 80 00 00 	movabs $0x803200,%rdx
+  800570:	00 00 00 
+  800573:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  800577:	48 85 c0             	test   %rax,%rax
+  80057a:	74 38                	je     8005b4 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  80057c:	48 89 c1             	mov    %rax,%rcx
+  80057f:	48 ba f9 33 80 00 00 	movabs $0x8033f9,%rdx
+  800586:	00 00 00 
+  800589:	4c 89 ee             	mov    %r13,%rsi
+  80058c:	4c 89 f7             	mov    %r14,%rdi
+  80058f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800594:	49 b8 8b 03 80 00 00 	movabs $0x80038b,%r8
+  80059b:	00 00 00 
+  80059e:	41 ff d0             	call   *%r8
+  8005a1:	e9 53 fe ff ff       	jmp    8003f9 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  8005a6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8005aa:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8005ae:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8005b2:	eb a4                	jmp    800558 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  8005b4:	48 ba ab 2d 80 00 00 	movabs $0x802dab,%rdx
+  8005bb:	00 00 00 
+  8005be:	4c 89 ee             	mov    %r13,%rsi
+  8005c1:	4c 89 f7             	mov    %r14,%rdi
+  8005c4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005c9:	49 b8 8b 03 80 00 00 	movabs $0x80038b,%r8
+  8005d0:	00 00 00 
+  8005d3:	41 ff d0             	call   *%r8
+  8005d6:	e9 1e fe ff ff       	jmp    8003f9 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8005db:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8005de:	83 f8 2f             	cmp    $0x2f,%eax
+  8005e1:	77 6c                	ja     80064f <vprintfmt+0x287>
+  8005e3:	89 c2                	mov    %eax,%edx
+  8005e5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8005e9:	83 c0 08             	add    $0x8,%eax
+  8005ec:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8005ef:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  8005f2:	48 85 d2             	test   %rdx,%rdx
+  8005f5:	48 b8 a4 2d 80 00 00 	movabs $0x802da4,%rax
+  8005fc:	00 00 00 
+  8005ff:	48 0f 45 c2          	cmovne %rdx,%rax
+  800603:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  800607:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  80060b:	7e 06                	jle    800613 <vprintfmt+0x24b>
+  80060d:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  800611:	75 4a                	jne    80065d <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800613:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800617:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  80061b:	0f b6 00             	movzbl (%rax),%eax
+  80061e:	84 c0                	test   %al,%al
+  800620:	0f 85 9a 00 00 00    	jne    8006c0 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  800626:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800629:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  80062d:	85 c0                	test   %eax,%eax
+  80062f:	0f 8e c4 fd ff ff    	jle    8003f9 <vprintfmt+0x31>
+  800635:	4c 89 ee             	mov    %r13,%rsi
+  800638:	bf 20 00 00 00       	mov    $0x20,%edi
+  80063d:	41 ff d6             	call   *%r14
+  800640:	41 83 ec 01          	sub    $0x1,%r12d
+  800644:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  800648:	75 eb                	jne    800635 <vprintfmt+0x26d>
+  80064a:	e9 aa fd ff ff       	jmp    8003f9 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  80064f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800653:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800657:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80065b:	eb 92                	jmp    8005ef <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  80065d:	49 63 f7             	movslq %r15d,%rsi
+  800660:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  800664:	48 b8 7a 0b 80 00 00 	movabs $0x800b7a,%rax
+  80066b:	00 00 00 
+  80066e:	ff d0                	call   *%rax
+  800670:	48 89 c2             	mov    %rax,%rdx
+  800673:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800676:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  800678:	8d 70 ff             	lea    -0x1(%rax),%esi
+  80067b:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  80067e:	85 c0                	test   %eax,%eax
+  800680:	7e 91                	jle    800613 <vprintfmt+0x24b>
+  800682:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  800687:	4c 89 ee             	mov    %r13,%rsi
+  80068a:	44 89 e7             	mov    %r12d,%edi
+  80068d:	41 ff d6             	call   *%r14
+  800690:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800694:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800697:	83 f8 ff             	cmp    $0xffffffff,%eax
+  80069a:	75 eb                	jne    800687 <vprintfmt+0x2bf>
+  80069c:	e9 72 ff ff ff       	jmp    800613 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8006a1:	0f b6 f8             	movzbl %al,%edi
+  8006a4:	4c 89 ee             	mov    %r13,%rsi
+  8006a7:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8006aa:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8006ae:	49 83 c4 01          	add    $0x1,%r12
+  8006b2:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  8006b8:	84 c0                	test   %al,%al
+  8006ba:	0f 84 66 ff ff ff    	je     800626 <vprintfmt+0x25e>
+  8006c0:	45 85 ff             	test   %r15d,%r15d
+  8006c3:	78 0a                	js     8006cf <vprintfmt+0x307>
+  8006c5:	41 83 ef 01          	sub    $0x1,%r15d
+  8006c9:	0f 88 57 ff ff ff    	js     800626 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8006cf:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  8006d3:	74 cc                	je     8006a1 <vprintfmt+0x2d9>
+  8006d5:	8d 50 e0             	lea    -0x20(%rax),%edx
+  8006d8:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  8006dd:	80 fa 5e             	cmp    $0x5e,%dl
+  8006e0:	77 c2                	ja     8006a4 <vprintfmt+0x2dc>
+  8006e2:	eb bd                	jmp    8006a1 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  8006e4:	40 84 f6             	test   %sil,%sil
+  8006e7:	75 26                	jne    80070f <vprintfmt+0x347>
+    switch (lflag) {
+  8006e9:	85 d2                	test   %edx,%edx
+  8006eb:	74 59                	je     800746 <vprintfmt+0x37e>
+  8006ed:	83 fa 01             	cmp    $0x1,%edx
+  8006f0:	74 7b                	je     80076d <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  8006f2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006f5:	83 f8 2f             	cmp    $0x2f,%eax
+  8006f8:	0f 87 96 00 00 00    	ja     800794 <vprintfmt+0x3cc>
+  8006fe:	89 c2                	mov    %eax,%edx
+  800700:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800704:	83 c0 08             	add    $0x8,%eax
+  800707:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80070a:	4c 8b 22             	mov    (%rdx),%r12
+  80070d:	eb 17                	jmp    800726 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  80070f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800712:	83 f8 2f             	cmp    $0x2f,%eax
+  800715:	77 21                	ja     800738 <vprintfmt+0x370>
+  800717:	89 c2                	mov    %eax,%edx
+  800719:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80071d:	83 c0 08             	add    $0x8,%eax
+  800720:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800723:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  800726:	4d 85 e4             	test   %r12,%r12
+  800729:	78 7a                	js     8007a5 <vprintfmt+0x3dd>
+            num = i;
+  80072b:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  80072e:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  800733:	e9 50 02 00 00       	jmp    800988 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800738:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80073c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800740:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800744:	eb dd                	jmp    800723 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  800746:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800749:	83 f8 2f             	cmp    $0x2f,%eax
+  80074c:	77 11                	ja     80075f <vprintfmt+0x397>
+  80074e:	89 c2                	mov    %eax,%edx
+  800750:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800754:	83 c0 08             	add    $0x8,%eax
+  800757:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80075a:	4c 63 22             	movslq (%rdx),%r12
+  80075d:	eb c7                	jmp    800726 <vprintfmt+0x35e>
+  80075f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800763:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800767:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80076b:	eb ed                	jmp    80075a <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  80076d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800770:	83 f8 2f             	cmp    $0x2f,%eax
+  800773:	77 11                	ja     800786 <vprintfmt+0x3be>
+  800775:	89 c2                	mov    %eax,%edx
+  800777:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80077b:	83 c0 08             	add    $0x8,%eax
+  80077e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800781:	4c 8b 22             	mov    (%rdx),%r12
+  800784:	eb a0                	jmp    800726 <vprintfmt+0x35e>
+  800786:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80078a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80078e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800792:	eb ed                	jmp    800781 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  800794:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800798:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80079c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007a0:	e9 65 ff ff ff       	jmp    80070a <vprintfmt+0x342>
+                putch('-', put_arg);
+  8007a5:	4c 89 ee             	mov    %r13,%rsi
+  8007a8:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  8007ad:	41 ff d6             	call   *%r14
+                i = -i;
+  8007b0:	49 f7 dc             	neg    %r12
+  8007b3:	e9 73 ff ff ff       	jmp    80072b <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  8007b8:	40 84 f6             	test   %sil,%sil
+  8007bb:	75 32                	jne    8007ef <vprintfmt+0x427>
+    switch (lflag) {
+  8007bd:	85 d2                	test   %edx,%edx
+  8007bf:	74 5d                	je     80081e <vprintfmt+0x456>
+  8007c1:	83 fa 01             	cmp    $0x1,%edx
+  8007c4:	0f 84 82 00 00 00    	je     80084c <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  8007ca:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007cd:	83 f8 2f             	cmp    $0x2f,%eax
+  8007d0:	0f 87 a5 00 00 00    	ja     80087b <vprintfmt+0x4b3>
+  8007d6:	89 c2                	mov    %eax,%edx
+  8007d8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007dc:	83 c0 08             	add    $0x8,%eax
+  8007df:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007e2:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8007e5:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  8007ea:	e9 99 01 00 00       	jmp    800988 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8007ef:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007f2:	83 f8 2f             	cmp    $0x2f,%eax
+  8007f5:	77 19                	ja     800810 <vprintfmt+0x448>
+  8007f7:	89 c2                	mov    %eax,%edx
+  8007f9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007fd:	83 c0 08             	add    $0x8,%eax
+  800800:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800803:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800806:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  80080b:	e9 78 01 00 00       	jmp    800988 <vprintfmt+0x5c0>
+  800810:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800814:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800818:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80081c:	eb e5                	jmp    800803 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  80081e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800821:	83 f8 2f             	cmp    $0x2f,%eax
+  800824:	77 18                	ja     80083e <vprintfmt+0x476>
+  800826:	89 c2                	mov    %eax,%edx
+  800828:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80082c:	83 c0 08             	add    $0x8,%eax
+  80082f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800832:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800834:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  800839:	e9 4a 01 00 00       	jmp    800988 <vprintfmt+0x5c0>
+  80083e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800842:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800846:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80084a:	eb e6                	jmp    800832 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  80084c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80084f:	83 f8 2f             	cmp    $0x2f,%eax
+  800852:	77 19                	ja     80086d <vprintfmt+0x4a5>
+  800854:	89 c2                	mov    %eax,%edx
+  800856:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80085a:	83 c0 08             	add    $0x8,%eax
+  80085d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800860:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800863:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  800868:	e9 1b 01 00 00       	jmp    800988 <vprintfmt+0x5c0>
+  80086d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800871:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800875:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800879:	eb e5                	jmp    800860 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  80087b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80087f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800883:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800887:	e9 56 ff ff ff       	jmp    8007e2 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  80088c:	40 84 f6             	test   %sil,%sil
+  80088f:	75 2e                	jne    8008bf <vprintfmt+0x4f7>
+    switch (lflag) {
+  800891:	85 d2                	test   %edx,%edx
+  800893:	74 59                	je     8008ee <vprintfmt+0x526>
+  800895:	83 fa 01             	cmp    $0x1,%edx
+  800898:	74 7f                	je     800919 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  80089a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80089d:	83 f8 2f             	cmp    $0x2f,%eax
+  8008a0:	0f 87 9f 00 00 00    	ja     800945 <vprintfmt+0x57d>
+  8008a6:	89 c2                	mov    %eax,%edx
+  8008a8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008ac:	83 c0 08             	add    $0x8,%eax
+  8008af:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008b2:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8008b5:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  8008ba:	e9 c9 00 00 00       	jmp    800988 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8008bf:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008c2:	83 f8 2f             	cmp    $0x2f,%eax
+  8008c5:	77 19                	ja     8008e0 <vprintfmt+0x518>
+  8008c7:	89 c2                	mov    %eax,%edx
+  8008c9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008cd:	83 c0 08             	add    $0x8,%eax
+  8008d0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008d3:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8008d6:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8008db:	e9 a8 00 00 00       	jmp    800988 <vprintfmt+0x5c0>
+  8008e0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008e4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008e8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008ec:	eb e5                	jmp    8008d3 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  8008ee:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008f1:	83 f8 2f             	cmp    $0x2f,%eax
+  8008f4:	77 15                	ja     80090b <vprintfmt+0x543>
+  8008f6:	89 c2                	mov    %eax,%edx
+  8008f8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008fc:	83 c0 08             	add    $0x8,%eax
+  8008ff:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800902:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  800904:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  800909:	eb 7d                	jmp    800988 <vprintfmt+0x5c0>
+  80090b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80090f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800913:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800917:	eb e9                	jmp    800902 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  800919:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80091c:	83 f8 2f             	cmp    $0x2f,%eax
+  80091f:	77 16                	ja     800937 <vprintfmt+0x56f>
+  800921:	89 c2                	mov    %eax,%edx
+  800923:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800927:	83 c0 08             	add    $0x8,%eax
+  80092a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80092d:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800930:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  800935:	eb 51                	jmp    800988 <vprintfmt+0x5c0>
+  800937:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80093b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80093f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800943:	eb e8                	jmp    80092d <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  800945:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800949:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80094d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800951:	e9 5c ff ff ff       	jmp    8008b2 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  800956:	4c 89 ee             	mov    %r13,%rsi
+  800959:	bf 30 00 00 00       	mov    $0x30,%edi
+  80095e:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800961:	4c 89 ee             	mov    %r13,%rsi
+  800964:	bf 78 00 00 00       	mov    $0x78,%edi
+  800969:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  80096c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80096f:	83 f8 2f             	cmp    $0x2f,%eax
+  800972:	77 47                	ja     8009bb <vprintfmt+0x5f3>
+  800974:	89 c2                	mov    %eax,%edx
+  800976:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80097a:	83 c0 08             	add    $0x8,%eax
+  80097d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800980:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800983:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800988:	48 83 ec 08          	sub    $0x8,%rsp
+  80098c:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800990:	0f 94 c0             	sete   %al
+  800993:	0f b6 c0             	movzbl %al,%eax
+  800996:	50                   	push   %rax
+  800997:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  80099c:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  8009a0:	4c 89 ee             	mov    %r13,%rsi
+  8009a3:	4c 89 f7             	mov    %r14,%rdi
+  8009a6:	48 b8 bd 02 80 00 00 	movabs $0x8002bd,%rax
+  8009ad:	00 00 00 
+  8009b0:	ff d0                	call   *%rax
+            break;
+  8009b2:	48 83 c4 10          	add    $0x10,%rsp
+  8009b6:	e9 3e fa ff ff       	jmp    8003f9 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  8009bb:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009bf:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009c3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009c7:	eb b7                	jmp    800980 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  8009c9:	40 84 f6             	test   %sil,%sil
+  8009cc:	75 2b                	jne    8009f9 <vprintfmt+0x631>
+    switch (lflag) {
+  8009ce:	85 d2                	test   %edx,%edx
+  8009d0:	74 56                	je     800a28 <vprintfmt+0x660>
+  8009d2:	83 fa 01             	cmp    $0x1,%edx
+  8009d5:	74 7f                	je     800a56 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  8009d7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009da:	83 f8 2f             	cmp    $0x2f,%eax
+  8009dd:	0f 87 a2 00 00 00    	ja     800a85 <vprintfmt+0x6bd>
+  8009e3:	89 c2                	mov    %eax,%edx
+  8009e5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009e9:	83 c0 08             	add    $0x8,%eax
+  8009ec:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009ef:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8009f2:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  8009f7:	eb 8f                	jmp    800988 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8009f9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009fc:	83 f8 2f             	cmp    $0x2f,%eax
+  8009ff:	77 19                	ja     800a1a <vprintfmt+0x652>
+  800a01:	89 c2                	mov    %eax,%edx
+  800a03:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a07:	83 c0 08             	add    $0x8,%eax
+  800a0a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a0d:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800a10:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800a15:	e9 6e ff ff ff       	jmp    800988 <vprintfmt+0x5c0>
+  800a1a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a1e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a22:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a26:	eb e5                	jmp    800a0d <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800a28:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a2b:	83 f8 2f             	cmp    $0x2f,%eax
+  800a2e:	77 18                	ja     800a48 <vprintfmt+0x680>
+  800a30:	89 c2                	mov    %eax,%edx
+  800a32:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a36:	83 c0 08             	add    $0x8,%eax
+  800a39:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a3c:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800a3e:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800a43:	e9 40 ff ff ff       	jmp    800988 <vprintfmt+0x5c0>
+  800a48:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a4c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a50:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a54:	eb e6                	jmp    800a3c <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800a56:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a59:	83 f8 2f             	cmp    $0x2f,%eax
+  800a5c:	77 19                	ja     800a77 <vprintfmt+0x6af>
+  800a5e:	89 c2                	mov    %eax,%edx
+  800a60:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a64:	83 c0 08             	add    $0x8,%eax
+  800a67:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a6a:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800a6d:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800a72:	e9 11 ff ff ff       	jmp    800988 <vprintfmt+0x5c0>
+  800a77:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a7b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a7f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a83:	eb e5                	jmp    800a6a <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800a85:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a89:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a8d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a91:	e9 59 ff ff ff       	jmp    8009ef <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800a96:	4c 89 ee             	mov    %r13,%rsi
+  800a99:	bf 25 00 00 00       	mov    $0x25,%edi
+  800a9e:	41 ff d6             	call   *%r14
+            break;
+  800aa1:	e9 53 f9 ff ff       	jmp    8003f9 <vprintfmt+0x31>
+            putch('%', put_arg);
+  800aa6:	4c 89 ee             	mov    %r13,%rsi
+  800aa9:	bf 25 00 00 00       	mov    $0x25,%edi
+  800aae:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800ab1:	48 83 eb 01          	sub    $0x1,%rbx
+  800ab5:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800ab9:	75 f6                	jne    800ab1 <vprintfmt+0x6e9>
+  800abb:	e9 39 f9 ff ff       	jmp    8003f9 <vprintfmt+0x31>
+}
+  800ac0:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800ac4:	5b                   	pop    %rbx
+  800ac5:	41 5c                	pop    %r12
+  800ac7:	41 5d                	pop    %r13
+  800ac9:	41 5e                	pop    %r14
+  800acb:	41 5f                	pop    %r15
+  800acd:	5d                   	pop    %rbp
+  800ace:	c3                   	ret
+
+0000000000800acf <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800acf:	55                   	push   %rbp
+  800ad0:	48 89 e5             	mov    %rsp,%rbp
+  800ad3:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800ad7:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800adb:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800ae0:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800ae4:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800aeb:	48 85 ff             	test   %rdi,%rdi
+  800aee:	74 2b                	je     800b1b <vsnprintf+0x4c>
+  800af0:	48 85 f6             	test   %rsi,%rsi
+  800af3:	74 26                	je     800b1b <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800af5:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800af9:	48 bf 73 03 80 00 00 	movabs $0x800373,%rdi
+  800b00:	00 00 00 
+  800b03:	48 b8 c8 03 80 00 00 	movabs $0x8003c8,%rax
+  800b0a:	00 00 00 
+  800b0d:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800b0f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800b13:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800b16:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800b19:	c9                   	leave
+  800b1a:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800b1b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800b20:	eb f7                	jmp    800b19 <vsnprintf+0x4a>
+
+0000000000800b22 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800b22:	55                   	push   %rbp
+  800b23:	48 89 e5             	mov    %rsp,%rbp
+  800b26:	48 83 ec 50          	sub    $0x50,%rsp
+  800b2a:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800b2e:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800b32:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800b36:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800b3d:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800b41:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b45:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800b49:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800b4d:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800b51:	48 b8 cf 0a 80 00 00 	movabs $0x800acf,%rax
+  800b58:	00 00 00 
+  800b5b:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800b5d:	c9                   	leave
+  800b5e:	c3                   	ret
+
+0000000000800b5f <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800b5f:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800b62:	74 10                	je     800b74 <strlen+0x15>
+    size_t n = 0;
+  800b64:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800b69:	48 83 c0 01          	add    $0x1,%rax
+  800b6d:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800b71:	75 f6                	jne    800b69 <strlen+0xa>
+  800b73:	c3                   	ret
+    size_t n = 0;
+  800b74:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800b79:	c3                   	ret
+
+0000000000800b7a <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800b7a:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800b7d:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800b82:	48 85 f6             	test   %rsi,%rsi
+  800b85:	74 11                	je     800b98 <strnlen+0x1e>
+  800b87:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800b8b:	74 0c                	je     800b99 <strnlen+0x1f>
+  800b8d:	48 83 c2 01          	add    $0x1,%rdx
+  800b91:	48 39 d0             	cmp    %rdx,%rax
+  800b94:	75 f1                	jne    800b87 <strnlen+0xd>
+  800b96:	eb 04                	jmp    800b9c <strnlen+0x22>
+  800b98:	c3                   	ret
+  800b99:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800b9c:	c3                   	ret
+
+0000000000800b9d <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800b9d:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800ba0:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ba5:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800ba9:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800bac:	48 83 c2 01          	add    $0x1,%rdx
+  800bb0:	84 c9                	test   %cl,%cl
+  800bb2:	75 f1                	jne    800ba5 <strcpy+0x8>
+        ;
+    return res;
+}
+  800bb4:	c3                   	ret
+
+0000000000800bb5 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800bb5:	55                   	push   %rbp
+  800bb6:	48 89 e5             	mov    %rsp,%rbp
+  800bb9:	41 54                	push   %r12
+  800bbb:	53                   	push   %rbx
+  800bbc:	48 89 fb             	mov    %rdi,%rbx
+  800bbf:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800bc2:	48 b8 5f 0b 80 00 00 	movabs $0x800b5f,%rax
+  800bc9:	00 00 00 
+  800bcc:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800bce:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800bd2:	4c 89 e6             	mov    %r12,%rsi
+  800bd5:	48 b8 9d 0b 80 00 00 	movabs $0x800b9d,%rax
+  800bdc:	00 00 00 
+  800bdf:	ff d0                	call   *%rax
+    return dst;
+}
+  800be1:	48 89 d8             	mov    %rbx,%rax
+  800be4:	5b                   	pop    %rbx
+  800be5:	41 5c                	pop    %r12
+  800be7:	5d                   	pop    %rbp
+  800be8:	c3                   	ret
+
+0000000000800be9 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800be9:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800bec:	48 85 d2             	test   %rdx,%rdx
+  800bef:	74 1f                	je     800c10 <strncpy+0x27>
+  800bf1:	48 01 fa             	add    %rdi,%rdx
+  800bf4:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800bf7:	48 83 c1 01          	add    $0x1,%rcx
+  800bfb:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800bff:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800c03:	41 80 f8 01          	cmp    $0x1,%r8b
+  800c07:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800c0b:	48 39 ca             	cmp    %rcx,%rdx
+  800c0e:	75 e7                	jne    800bf7 <strncpy+0xe>
+    }
+    return ret;
+}
+  800c10:	c3                   	ret
+
+0000000000800c11 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800c11:	48 89 f8             	mov    %rdi,%rax
+  800c14:	48 85 d2             	test   %rdx,%rdx
+  800c17:	74 24                	je     800c3d <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800c19:	48 83 ea 01          	sub    $0x1,%rdx
+  800c1d:	74 1b                	je     800c3a <strlcpy+0x29>
+  800c1f:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800c23:	0f b6 16             	movzbl (%rsi),%edx
+  800c26:	84 d2                	test   %dl,%dl
+  800c28:	74 10                	je     800c3a <strlcpy+0x29>
+            *dst++ = *src++;
+  800c2a:	48 83 c6 01          	add    $0x1,%rsi
+  800c2e:	48 83 c0 01          	add    $0x1,%rax
+  800c32:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800c35:	48 39 c8             	cmp    %rcx,%rax
+  800c38:	75 e9                	jne    800c23 <strlcpy+0x12>
+        *dst = '\0';
+  800c3a:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800c3d:	48 29 f8             	sub    %rdi,%rax
+}
+  800c40:	c3                   	ret
+
+0000000000800c41 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800c41:	0f b6 07             	movzbl (%rdi),%eax
+  800c44:	84 c0                	test   %al,%al
+  800c46:	74 13                	je     800c5b <strcmp+0x1a>
+  800c48:	38 06                	cmp    %al,(%rsi)
+  800c4a:	75 0f                	jne    800c5b <strcmp+0x1a>
+  800c4c:	48 83 c7 01          	add    $0x1,%rdi
+  800c50:	48 83 c6 01          	add    $0x1,%rsi
+  800c54:	0f b6 07             	movzbl (%rdi),%eax
+  800c57:	84 c0                	test   %al,%al
+  800c59:	75 ed                	jne    800c48 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800c5b:	0f b6 c0             	movzbl %al,%eax
+  800c5e:	0f b6 16             	movzbl (%rsi),%edx
+  800c61:	29 d0                	sub    %edx,%eax
+}
+  800c63:	c3                   	ret
+
+0000000000800c64 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800c64:	48 85 d2             	test   %rdx,%rdx
+  800c67:	74 1f                	je     800c88 <strncmp+0x24>
+  800c69:	0f b6 07             	movzbl (%rdi),%eax
+  800c6c:	84 c0                	test   %al,%al
+  800c6e:	74 1e                	je     800c8e <strncmp+0x2a>
+  800c70:	3a 06                	cmp    (%rsi),%al
+  800c72:	75 1a                	jne    800c8e <strncmp+0x2a>
+  800c74:	48 83 c7 01          	add    $0x1,%rdi
+  800c78:	48 83 c6 01          	add    $0x1,%rsi
+  800c7c:	48 83 ea 01          	sub    $0x1,%rdx
+  800c80:	75 e7                	jne    800c69 <strncmp+0x5>
+
+    if (!n) return 0;
+  800c82:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c87:	c3                   	ret
+  800c88:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c8d:	c3                   	ret
+  800c8e:	48 85 d2             	test   %rdx,%rdx
+  800c91:	74 09                	je     800c9c <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800c93:	0f b6 07             	movzbl (%rdi),%eax
+  800c96:	0f b6 16             	movzbl (%rsi),%edx
+  800c99:	29 d0                	sub    %edx,%eax
+  800c9b:	c3                   	ret
+    if (!n) return 0;
+  800c9c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800ca1:	c3                   	ret
+
+0000000000800ca2 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800ca2:	0f b6 17             	movzbl (%rdi),%edx
+  800ca5:	84 d2                	test   %dl,%dl
+  800ca7:	74 18                	je     800cc1 <strchr+0x1f>
+        if (*str == c) {
+  800ca9:	0f be d2             	movsbl %dl,%edx
+  800cac:	39 f2                	cmp    %esi,%edx
+  800cae:	74 17                	je     800cc7 <strchr+0x25>
+    for (; *str; str++) {
+  800cb0:	48 83 c7 01          	add    $0x1,%rdi
+  800cb4:	0f b6 17             	movzbl (%rdi),%edx
+  800cb7:	84 d2                	test   %dl,%dl
+  800cb9:	75 ee                	jne    800ca9 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800cbb:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cc0:	c3                   	ret
+  800cc1:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cc6:	c3                   	ret
+  800cc7:	48 89 f8             	mov    %rdi,%rax
+}
+  800cca:	c3                   	ret
+
+0000000000800ccb <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800ccb:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800cce:	0f b6 17             	movzbl (%rdi),%edx
+  800cd1:	84 d2                	test   %dl,%dl
+  800cd3:	74 13                	je     800ce8 <strfind+0x1d>
+  800cd5:	0f be d2             	movsbl %dl,%edx
+  800cd8:	39 f2                	cmp    %esi,%edx
+  800cda:	74 0b                	je     800ce7 <strfind+0x1c>
+  800cdc:	48 83 c0 01          	add    $0x1,%rax
+  800ce0:	0f b6 10             	movzbl (%rax),%edx
+  800ce3:	84 d2                	test   %dl,%dl
+  800ce5:	75 ee                	jne    800cd5 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800ce7:	c3                   	ret
+  800ce8:	c3                   	ret
+
+0000000000800ce9 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800ce9:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800cec:	48 89 f8             	mov    %rdi,%rax
+  800cef:	48 f7 d8             	neg    %rax
+  800cf2:	83 e0 07             	and    $0x7,%eax
+  800cf5:	49 89 d1             	mov    %rdx,%r9
+  800cf8:	49 29 c1             	sub    %rax,%r9
+  800cfb:	78 36                	js     800d33 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800cfd:	40 0f b6 c6          	movzbl %sil,%eax
+  800d01:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800d08:	01 01 01 
+  800d0b:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800d0f:	40 f6 c7 07          	test   $0x7,%dil
+  800d13:	75 38                	jne    800d4d <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800d15:	4c 89 c9             	mov    %r9,%rcx
+  800d18:	48 c1 f9 03          	sar    $0x3,%rcx
+  800d1c:	74 0c                	je     800d2a <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800d1e:	fc                   	cld
+  800d1f:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800d22:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800d26:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800d2a:	4d 85 c9             	test   %r9,%r9
+  800d2d:	75 45                	jne    800d74 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800d2f:	4c 89 c0             	mov    %r8,%rax
+  800d32:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800d33:	48 85 d2             	test   %rdx,%rdx
+  800d36:	74 f7                	je     800d2f <memset+0x46>
+  800d38:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800d3b:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800d3e:	48 83 c0 01          	add    $0x1,%rax
+  800d42:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  800d46:	48 39 c2             	cmp    %rax,%rdx
+  800d49:	75 f3                	jne    800d3e <memset+0x55>
+  800d4b:	eb e2                	jmp    800d2f <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  800d4d:	40 f6 c7 01          	test   $0x1,%dil
+  800d51:	74 06                	je     800d59 <memset+0x70>
+  800d53:	88 07                	mov    %al,(%rdi)
+  800d55:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800d59:	40 f6 c7 02          	test   $0x2,%dil
+  800d5d:	74 07                	je     800d66 <memset+0x7d>
+  800d5f:	66 89 07             	mov    %ax,(%rdi)
+  800d62:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800d66:	40 f6 c7 04          	test   $0x4,%dil
+  800d6a:	74 a9                	je     800d15 <memset+0x2c>
+  800d6c:	89 07                	mov    %eax,(%rdi)
+  800d6e:	48 83 c7 04          	add    $0x4,%rdi
+  800d72:	eb a1                	jmp    800d15 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800d74:	41 f6 c1 04          	test   $0x4,%r9b
+  800d78:	74 06                	je     800d80 <memset+0x97>
+  800d7a:	89 07                	mov    %eax,(%rdi)
+  800d7c:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800d80:	41 f6 c1 02          	test   $0x2,%r9b
+  800d84:	74 07                	je     800d8d <memset+0xa4>
+  800d86:	66 89 07             	mov    %ax,(%rdi)
+  800d89:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  800d8d:	41 f6 c1 01          	test   $0x1,%r9b
+  800d91:	74 9c                	je     800d2f <memset+0x46>
+  800d93:	88 07                	mov    %al,(%rdi)
+  800d95:	eb 98                	jmp    800d2f <memset+0x46>
+
+0000000000800d97 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  800d97:	48 89 f8             	mov    %rdi,%rax
+  800d9a:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  800d9d:	48 39 fe             	cmp    %rdi,%rsi
+  800da0:	73 3b                	jae    800ddd <memmove+0x46>
+  800da2:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  800da6:	48 39 d7             	cmp    %rdx,%rdi
+  800da9:	73 32                	jae    800ddd <memmove+0x46>
+        s += n;
+        d += n;
+  800dab:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800daf:	48 89 d6             	mov    %rdx,%rsi
+  800db2:	48 09 fe             	or     %rdi,%rsi
+  800db5:	48 09 ce             	or     %rcx,%rsi
+  800db8:	40 f6 c6 07          	test   $0x7,%sil
+  800dbc:	75 12                	jne    800dd0 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  800dbe:	48 83 ef 08          	sub    $0x8,%rdi
+  800dc2:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  800dc6:	48 c1 e9 03          	shr    $0x3,%rcx
+  800dca:	fd                   	std
+  800dcb:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  800dce:	fc                   	cld
+  800dcf:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  800dd0:	48 83 ef 01          	sub    $0x1,%rdi
+  800dd4:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  800dd8:	fd                   	std
+  800dd9:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  800ddb:	eb f1                	jmp    800dce <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800ddd:	48 89 f2             	mov    %rsi,%rdx
+  800de0:	48 09 c2             	or     %rax,%rdx
+  800de3:	48 09 ca             	or     %rcx,%rdx
+  800de6:	f6 c2 07             	test   $0x7,%dl
+  800de9:	75 0c                	jne    800df7 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  800deb:	48 c1 e9 03          	shr    $0x3,%rcx
+  800def:	48 89 c7             	mov    %rax,%rdi
+  800df2:	fc                   	cld
+  800df3:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  800df6:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  800df7:	48 89 c7             	mov    %rax,%rdi
+  800dfa:	fc                   	cld
+  800dfb:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  800dfd:	c3                   	ret
+
+0000000000800dfe <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  800dfe:	55                   	push   %rbp
+  800dff:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  800e02:	48 b8 97 0d 80 00 00 	movabs $0x800d97,%rax
+  800e09:	00 00 00 
+  800e0c:	ff d0                	call   *%rax
+}
+  800e0e:	5d                   	pop    %rbp
+  800e0f:	c3                   	ret
+
+0000000000800e10 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  800e10:	55                   	push   %rbp
+  800e11:	48 89 e5             	mov    %rsp,%rbp
+  800e14:	41 57                	push   %r15
+  800e16:	41 56                	push   %r14
+  800e18:	41 55                	push   %r13
+  800e1a:	41 54                	push   %r12
+  800e1c:	53                   	push   %rbx
+  800e1d:	48 83 ec 08          	sub    $0x8,%rsp
+  800e21:	49 89 fe             	mov    %rdi,%r14
+  800e24:	49 89 f7             	mov    %rsi,%r15
+  800e27:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  800e2a:	48 89 f7             	mov    %rsi,%rdi
+  800e2d:	48 b8 5f 0b 80 00 00 	movabs $0x800b5f,%rax
+  800e34:	00 00 00 
+  800e37:	ff d0                	call   *%rax
+  800e39:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  800e3c:	48 89 de             	mov    %rbx,%rsi
+  800e3f:	4c 89 f7             	mov    %r14,%rdi
+  800e42:	48 b8 7a 0b 80 00 00 	movabs $0x800b7a,%rax
+  800e49:	00 00 00 
+  800e4c:	ff d0                	call   *%rax
+  800e4e:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  800e51:	48 39 c3             	cmp    %rax,%rbx
+  800e54:	74 36                	je     800e8c <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  800e56:	48 89 d8             	mov    %rbx,%rax
+  800e59:	4c 29 e8             	sub    %r13,%rax
+  800e5c:	49 39 c4             	cmp    %rax,%r12
+  800e5f:	73 31                	jae    800e92 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  800e61:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  800e66:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800e6a:	4c 89 fe             	mov    %r15,%rsi
+  800e6d:	48 b8 fe 0d 80 00 00 	movabs $0x800dfe,%rax
+  800e74:	00 00 00 
+  800e77:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  800e79:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  800e7d:	48 83 c4 08          	add    $0x8,%rsp
+  800e81:	5b                   	pop    %rbx
+  800e82:	41 5c                	pop    %r12
+  800e84:	41 5d                	pop    %r13
+  800e86:	41 5e                	pop    %r14
+  800e88:	41 5f                	pop    %r15
+  800e8a:	5d                   	pop    %rbp
+  800e8b:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  800e8c:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800e90:	eb eb                	jmp    800e7d <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  800e92:	48 83 eb 01          	sub    $0x1,%rbx
+  800e96:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800e9a:	48 89 da             	mov    %rbx,%rdx
+  800e9d:	4c 89 fe             	mov    %r15,%rsi
+  800ea0:	48 b8 fe 0d 80 00 00 	movabs $0x800dfe,%rax
+  800ea7:	00 00 00 
+  800eaa:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  800eac:	49 01 de             	add    %rbx,%r14
+  800eaf:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  800eb4:	eb c3                	jmp    800e79 <strlcat+0x69>
+
+0000000000800eb6 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  800eb6:	48 85 d2             	test   %rdx,%rdx
+  800eb9:	74 2d                	je     800ee8 <memcmp+0x32>
+  800ebb:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  800ec0:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800ec4:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  800ec9:	44 38 c1             	cmp    %r8b,%cl
+  800ecc:	75 0f                	jne    800edd <memcmp+0x27>
+    while (n-- > 0) {
+  800ece:	48 83 c0 01          	add    $0x1,%rax
+  800ed2:	48 39 c2             	cmp    %rax,%rdx
+  800ed5:	75 e9                	jne    800ec0 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  800ed7:	b8 00 00 00 00       	mov    $0x0,%eax
+  800edc:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  800edd:	0f b6 c1             	movzbl %cl,%eax
+  800ee0:	45 0f b6 c0          	movzbl %r8b,%r8d
+  800ee4:	44 29 c0             	sub    %r8d,%eax
+  800ee7:	c3                   	ret
+    return 0;
+  800ee8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800eed:	c3                   	ret
+
+0000000000800eee <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  800eee:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  800ef2:	48 39 c7             	cmp    %rax,%rdi
+  800ef5:	73 0f                	jae    800f06 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  800ef7:	40 38 37             	cmp    %sil,(%rdi)
+  800efa:	74 0e                	je     800f0a <memfind+0x1c>
+    for (; src < end; src++) {
+  800efc:	48 83 c7 01          	add    $0x1,%rdi
+  800f00:	48 39 f8             	cmp    %rdi,%rax
+  800f03:	75 f2                	jne    800ef7 <memfind+0x9>
+  800f05:	c3                   	ret
+  800f06:	48 89 f8             	mov    %rdi,%rax
+  800f09:	c3                   	ret
+  800f0a:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  800f0d:	c3                   	ret
+
+0000000000800f0e <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  800f0e:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  800f11:	0f b6 37             	movzbl (%rdi),%esi
+  800f14:	40 80 fe 20          	cmp    $0x20,%sil
+  800f18:	74 06                	je     800f20 <strtol+0x12>
+  800f1a:	40 80 fe 09          	cmp    $0x9,%sil
+  800f1e:	75 13                	jne    800f33 <strtol+0x25>
+  800f20:	48 83 c7 01          	add    $0x1,%rdi
+  800f24:	0f b6 37             	movzbl (%rdi),%esi
+  800f27:	40 80 fe 20          	cmp    $0x20,%sil
+  800f2b:	74 f3                	je     800f20 <strtol+0x12>
+  800f2d:	40 80 fe 09          	cmp    $0x9,%sil
+  800f31:	74 ed                	je     800f20 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  800f33:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  800f36:	83 e0 fd             	and    $0xfffffffd,%eax
+  800f39:	3c 01                	cmp    $0x1,%al
+  800f3b:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  800f3f:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  800f45:	75 0f                	jne    800f56 <strtol+0x48>
+  800f47:	80 3f 30             	cmpb   $0x30,(%rdi)
+  800f4a:	74 14                	je     800f60 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  800f4c:	85 d2                	test   %edx,%edx
+  800f4e:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800f53:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  800f56:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  800f5b:	4c 63 ca             	movslq %edx,%r9
+  800f5e:	eb 36                	jmp    800f96 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  800f60:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  800f64:	74 0f                	je     800f75 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  800f66:	85 d2                	test   %edx,%edx
+  800f68:	75 ec                	jne    800f56 <strtol+0x48>
+        s++;
+  800f6a:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  800f6e:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  800f73:	eb e1                	jmp    800f56 <strtol+0x48>
+        s += 2;
+  800f75:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  800f79:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  800f7e:	eb d6                	jmp    800f56 <strtol+0x48>
+            dig -= '0';
+  800f80:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  800f83:	44 0f b6 c1          	movzbl %cl,%r8d
+  800f87:	41 39 d0             	cmp    %edx,%r8d
+  800f8a:	7d 21                	jge    800fad <strtol+0x9f>
+        val = val * base + dig;
+  800f8c:	49 0f af c1          	imul   %r9,%rax
+  800f90:	0f b6 c9             	movzbl %cl,%ecx
+  800f93:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  800f96:	48 83 c7 01          	add    $0x1,%rdi
+  800f9a:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  800f9e:	80 f9 39             	cmp    $0x39,%cl
+  800fa1:	76 dd                	jbe    800f80 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  800fa3:	80 f9 7b             	cmp    $0x7b,%cl
+  800fa6:	77 05                	ja     800fad <strtol+0x9f>
+            dig -= 'a' - 10;
+  800fa8:	83 e9 57             	sub    $0x57,%ecx
+  800fab:	eb d6                	jmp    800f83 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  800fad:	4d 85 d2             	test   %r10,%r10
+  800fb0:	74 03                	je     800fb5 <strtol+0xa7>
+  800fb2:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  800fb5:	48 89 c2             	mov    %rax,%rdx
+  800fb8:	48 f7 da             	neg    %rdx
+  800fbb:	40 80 fe 2d          	cmp    $0x2d,%sil
+  800fbf:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  800fc3:	c3                   	ret
+
+0000000000800fc4 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  800fc4:	55                   	push   %rbp
+  800fc5:	48 89 e5             	mov    %rsp,%rbp
+  800fc8:	53                   	push   %rbx
+  800fc9:	48 89 fa             	mov    %rdi,%rdx
+  800fcc:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  800fcf:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800fd4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fd9:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800fde:	be 00 00 00 00       	mov    $0x0,%esi
+  800fe3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800fe9:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  800feb:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800fef:	c9                   	leave
+  800ff0:	c3                   	ret
+
+0000000000800ff1 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  800ff1:	55                   	push   %rbp
+  800ff2:	48 89 e5             	mov    %rsp,%rbp
+  800ff5:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  800ff6:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800ffb:	ba 00 00 00 00       	mov    $0x0,%edx
+  801000:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801005:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80100a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80100f:	be 00 00 00 00       	mov    $0x0,%esi
+  801014:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80101a:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  80101c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801020:	c9                   	leave
+  801021:	c3                   	ret
+
+0000000000801022 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  801022:	55                   	push   %rbp
+  801023:	48 89 e5             	mov    %rsp,%rbp
+  801026:	53                   	push   %rbx
+  801027:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  80102b:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80102e:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801033:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801038:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80103d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801042:	be 00 00 00 00       	mov    $0x0,%esi
+  801047:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80104d:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80104f:	48 85 c0             	test   %rax,%rax
+  801052:	7f 06                	jg     80105a <sys_env_destroy+0x38>
+}
+  801054:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801058:	c9                   	leave
+  801059:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80105a:	49 89 c0             	mov    %rax,%r8
+  80105d:	b9 03 00 00 00       	mov    $0x3,%ecx
+  801062:	48 ba d0 32 80 00 00 	movabs $0x8032d0,%rdx
+  801069:	00 00 00 
+  80106c:	be 26 00 00 00       	mov    $0x26,%esi
+  801071:	48 bf ef 32 80 00 00 	movabs $0x8032ef,%rdi
+  801078:	00 00 00 
+  80107b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801080:	49 b9 a6 2c 80 00 00 	movabs $0x802ca6,%r9
+  801087:	00 00 00 
+  80108a:	41 ff d1             	call   *%r9
+
+000000000080108d <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  80108d:	55                   	push   %rbp
+  80108e:	48 89 e5             	mov    %rsp,%rbp
+  801091:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801092:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801097:	ba 00 00 00 00       	mov    $0x0,%edx
+  80109c:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8010a1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010a6:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8010ab:	be 00 00 00 00       	mov    $0x0,%esi
+  8010b0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8010b6:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  8010b8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8010bc:	c9                   	leave
+  8010bd:	c3                   	ret
+
+00000000008010be <sys_yield>:
+
+void
+sys_yield(void) {
+  8010be:	55                   	push   %rbp
+  8010bf:	48 89 e5             	mov    %rsp,%rbp
+  8010c2:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8010c3:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8010c8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010cd:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8010d2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010d7:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8010dc:	be 00 00 00 00       	mov    $0x0,%esi
+  8010e1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8010e7:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  8010e9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8010ed:	c9                   	leave
+  8010ee:	c3                   	ret
+
+00000000008010ef <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  8010ef:	55                   	push   %rbp
+  8010f0:	48 89 e5             	mov    %rsp,%rbp
+  8010f3:	53                   	push   %rbx
+  8010f4:	48 89 fa             	mov    %rdi,%rdx
+  8010f7:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8010fa:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8010ff:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  801106:	00 00 00 
+  801109:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80110e:	be 00 00 00 00       	mov    $0x0,%esi
+  801113:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801119:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  80111b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80111f:	c9                   	leave
+  801120:	c3                   	ret
+
+0000000000801121 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  801121:	55                   	push   %rbp
+  801122:	48 89 e5             	mov    %rsp,%rbp
+  801125:	53                   	push   %rbx
+  801126:	49 89 f8             	mov    %rdi,%r8
+  801129:	48 89 d3             	mov    %rdx,%rbx
+  80112c:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80112f:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801134:	4c 89 c2             	mov    %r8,%rdx
+  801137:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80113a:	be 00 00 00 00       	mov    $0x0,%esi
+  80113f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801145:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  801147:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80114b:	c9                   	leave
+  80114c:	c3                   	ret
+
+000000000080114d <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  80114d:	55                   	push   %rbp
+  80114e:	48 89 e5             	mov    %rsp,%rbp
+  801151:	53                   	push   %rbx
+  801152:	48 83 ec 08          	sub    $0x8,%rsp
+  801156:	89 f8                	mov    %edi,%eax
+  801158:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  80115b:	48 63 f9             	movslq %ecx,%rdi
+  80115e:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801161:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801166:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801169:	be 00 00 00 00       	mov    $0x0,%esi
+  80116e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801174:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801176:	48 85 c0             	test   %rax,%rax
+  801179:	7f 06                	jg     801181 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  80117b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80117f:	c9                   	leave
+  801180:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801181:	49 89 c0             	mov    %rax,%r8
+  801184:	b9 04 00 00 00       	mov    $0x4,%ecx
+  801189:	48 ba d0 32 80 00 00 	movabs $0x8032d0,%rdx
+  801190:	00 00 00 
+  801193:	be 26 00 00 00       	mov    $0x26,%esi
+  801198:	48 bf ef 32 80 00 00 	movabs $0x8032ef,%rdi
+  80119f:	00 00 00 
+  8011a2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011a7:	49 b9 a6 2c 80 00 00 	movabs $0x802ca6,%r9
+  8011ae:	00 00 00 
+  8011b1:	41 ff d1             	call   *%r9
+
+00000000008011b4 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8011b4:	55                   	push   %rbp
+  8011b5:	48 89 e5             	mov    %rsp,%rbp
+  8011b8:	53                   	push   %rbx
+  8011b9:	48 83 ec 08          	sub    $0x8,%rsp
+  8011bd:	89 f8                	mov    %edi,%eax
+  8011bf:	49 89 f2             	mov    %rsi,%r10
+  8011c2:	48 89 cf             	mov    %rcx,%rdi
+  8011c5:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  8011c8:	48 63 da             	movslq %edx,%rbx
+  8011cb:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8011ce:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8011d3:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8011d6:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  8011d9:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8011db:	48 85 c0             	test   %rax,%rax
+  8011de:	7f 06                	jg     8011e6 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8011e0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8011e4:	c9                   	leave
+  8011e5:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8011e6:	49 89 c0             	mov    %rax,%r8
+  8011e9:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8011ee:	48 ba d0 32 80 00 00 	movabs $0x8032d0,%rdx
+  8011f5:	00 00 00 
+  8011f8:	be 26 00 00 00       	mov    $0x26,%esi
+  8011fd:	48 bf ef 32 80 00 00 	movabs $0x8032ef,%rdi
+  801204:	00 00 00 
+  801207:	b8 00 00 00 00       	mov    $0x0,%eax
+  80120c:	49 b9 a6 2c 80 00 00 	movabs $0x802ca6,%r9
+  801213:	00 00 00 
+  801216:	41 ff d1             	call   *%r9
+
+0000000000801219 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  801219:	55                   	push   %rbp
+  80121a:	48 89 e5             	mov    %rsp,%rbp
+  80121d:	53                   	push   %rbx
+  80121e:	48 83 ec 08          	sub    $0x8,%rsp
+  801222:	48 89 f1             	mov    %rsi,%rcx
+  801225:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  801228:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80122b:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801230:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801235:	be 00 00 00 00       	mov    $0x0,%esi
+  80123a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801240:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801242:	48 85 c0             	test   %rax,%rax
+  801245:	7f 06                	jg     80124d <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  801247:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80124b:	c9                   	leave
+  80124c:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80124d:	49 89 c0             	mov    %rax,%r8
+  801250:	b9 06 00 00 00       	mov    $0x6,%ecx
+  801255:	48 ba d0 32 80 00 00 	movabs $0x8032d0,%rdx
+  80125c:	00 00 00 
+  80125f:	be 26 00 00 00       	mov    $0x26,%esi
+  801264:	48 bf ef 32 80 00 00 	movabs $0x8032ef,%rdi
+  80126b:	00 00 00 
+  80126e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801273:	49 b9 a6 2c 80 00 00 	movabs $0x802ca6,%r9
+  80127a:	00 00 00 
+  80127d:	41 ff d1             	call   *%r9
+
+0000000000801280 <sys_region_batch>:
+
+int
+sys_region_batch(const struct RegionOp *ops, size_t count) {
+  801280:	55                   	push   %rbp
+  801281:	48 89 e5             	mov    %rsp,%rbp
+  801284:	53                   	push   %rbx
+  801285:	48 83 ec 08          	sub    $0x8,%rsp
+  801289:	48 89 fa             	mov    %rdi,%rdx
+  80128c:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80128f:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801294:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801299:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80129e:	be 00 00 00 00       	mov    $0x0,%esi
+  8012a3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8012a9:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8012ab:	48 85 c0             	test   %rax,%rax
+  8012ae:	7f 06                	jg     8012b6 <sys_region_batch+0x36>
+        else
+            platform_asan_unpoison(va, ops[i].size);
+    }
+#endif
+    return res;
+}
+  8012b0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012b4:	c9                   	leave
+  8012b5:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8012b6:	49 89 c0             	mov    %rax,%r8
+  8012b9:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  8012be:	48 ba d0 32 80 00 00 	movabs $0x8032d0,%rdx
+  8012c5:	00 00 00 
+  8012c8:	be 26 00 00 00       	mov    $0x26,%esi
+  8012cd:	48 bf ef 32 80 00 00 	movabs $0x8032ef,%rdi
+  8012d4:	00 00 00 
+  8012d7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012dc:	49 b9 a6 2c 80 00 00 	movabs $0x802ca6,%r9
+  8012e3:	00 00 00 
+  8012e6:	41 ff d1             	call   *%r9
+
+00000000008012e9 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  8012e9:	55                   	push   %rbp
+  8012ea:	48 89 e5             	mov    %rsp,%rbp
+  8012ed:	53                   	push   %rbx
+  8012ee:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  8012f2:	48 63 ce             	movslq %esi,%rcx
+  8012f5:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8012f8:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8012fd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801302:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801307:	be 00 00 00 00       	mov    $0x0,%esi
+  80130c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801312:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801314:	48 85 c0             	test   %rax,%rax
+  801317:	7f 06                	jg     80131f <sys_env_set_status+0x36>
+}
+  801319:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80131d:	c9                   	leave
+  80131e:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80131f:	49 89 c0             	mov    %rax,%r8
+  801322:	b9 09 00 00 00       	mov    $0x9,%ecx
+  801327:	48 ba d0 32 80 00 00 	movabs $0x8032d0,%rdx
+  80132e:	00 00 00 
+  801331:	be 26 00 00 00       	mov    $0x26,%esi
+  801336:	48 bf ef 32 80 00 00 	movabs $0x8032ef,%rdi
+  80133d:	00 00 00 
+  801340:	b8 00 00 00 00       	mov    $0x0,%eax
+  801345:	49 b9 a6 2c 80 00 00 	movabs $0x802ca6,%r9
+  80134c:	00 00 00 
+  80134f:	41 ff d1             	call   *%r9
+
+0000000000801352 <sys_env_set_weight>:
+
+int
+sys_env_set_weight(envid_t envid, uint32_t weight) {
+  801352:	55                   	push   %rbp
+  801353:	48 89 e5             	mov    %rsp,%rbp
+  801356:	53                   	push   %rbx
+  801357:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_weight, 1, envid, weight, 0, 0, 0, 0);
+  80135b:	89 f1                	mov    %esi,%ecx
+  80135d:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801360:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801365:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80136a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80136f:	be 00 00 00 00       	mov    $0x0,%esi
+  801374:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80137a:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80137c:	48 85 c0             	test   %rax,%rax
+  80137f:	7f 06                	jg     801387 <sys_env_set_weight+0x35>
+}
+  801381:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801385:	c9                   	leave
+  801386:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801387:	49 89 c0             	mov    %rax,%r8
+  80138a:	b9 10 00 00 00       	mov    $0x10,%ecx
+  80138f:	48 ba d0 32 80 00 00 	movabs $0x8032d0,%rdx
+  801396:	00 00 00 
+  801399:	be 26 00 00 00       	mov    $0x26,%esi
+  80139e:	48 bf ef 32 80 00 00 	movabs $0x8032ef,%rdi
+  8013a5:	00 00 00 
+  8013a8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013ad:	49 b9 a6 2c 80 00 00 	movabs $0x802ca6,%r9
+  8013b4:	00 00 00 
+  8013b7:	41 ff d1             	call   *%r9
+
+00000000008013ba <sys_env_set_rt>:
+
+int
+sys_env_set_rt(envid_t envid, uint64_t period, uint64_t budget, uint64_t deadline) {
+  8013ba:	55                   	push   %rbp
+  8013bb:	48 89 e5             	mov    %rsp,%rbp
+  8013be:	53                   	push   %rbx
+  8013bf:	48 83 ec 08          	sub    $0x8,%rsp
+  8013c3:	89 f8                	mov    %edi,%eax
+  8013c5:	48 89 d3             	mov    %rdx,%rbx
+  8013c8:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_env_set_rt, 1, envid, period, budget, deadline, 0, 0);
+  8013cb:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8013ce:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8013d3:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013d6:	be 00 00 00 00       	mov    $0x0,%esi
+  8013db:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013e1:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8013e3:	48 85 c0             	test   %rax,%rax
+  8013e6:	7f 06                	jg     8013ee <sys_env_set_rt+0x34>
+}
+  8013e8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013ec:	c9                   	leave
+  8013ed:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8013ee:	49 89 c0             	mov    %rax,%r8
+  8013f1:	b9 11 00 00 00       	mov    $0x11,%ecx
+  8013f6:	48 ba d0 32 80 00 00 	movabs $0x8032d0,%rdx
+  8013fd:	00 00 00 
+  801400:	be 26 00 00 00       	mov    $0x26,%esi
+  801405:	48 bf ef 32 80 00 00 	movabs $0x8032ef,%rdi
+  80140c:	00 00 00 
+  80140f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801414:	49 b9 a6 2c 80 00 00 	movabs $0x802ca6,%r9
+  80141b:	00 00 00 
+  80141e:	41 ff d1             	call   *%r9
+
+0000000000801421 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  801421:	55                   	push   %rbp
+  801422:	48 89 e5             	mov    %rsp,%rbp
+  801425:	53                   	push   %rbx
+  801426:	48 83 ec 08          	sub    $0x8,%rsp
+  80142a:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  80142d:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801430:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801435:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80143a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80143f:	be 00 00 00 00       	mov    $0x0,%esi
+  801444:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80144a:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80144c:	48 85 c0             	test   %rax,%rax
+  80144f:	7f 06                	jg     801457 <sys_env_set_trapframe+0x36>
+}
+  801451:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801455:	c9                   	leave
+  801456:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801457:	49 89 c0             	mov    %rax,%r8
+  80145a:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  80145f:	48 ba d0 32 80 00 00 	movabs $0x8032d0,%rdx
+  801466:	00 00 00 
+  801469:	be 26 00 00 00       	mov    $0x26,%esi
+  80146e:	48 bf ef 32 80 00 00 	movabs $0x8032ef,%rdi
+  801475:	00 00 00 
+  801478:	b8 00 00 00 00       	mov    $0x0,%eax
+  80147d:	49 b9 a6 2c 80 00 00 	movabs $0x802ca6,%r9
+  801484:	00 00 00 
+  801487:	41 ff d1             	call   *%r9
+
+000000000080148a <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  80148a:	55                   	push   %rbp
+  80148b:	48 89 e5             	mov    %rsp,%rbp
+  80148e:	53                   	push   %rbx
+  80148f:	48 83 ec 08          	sub    $0x8,%rsp
+  801493:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  801496:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801499:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80149e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014a3:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014a8:	be 00 00 00 00       	mov    $0x0,%esi
+  8014ad:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014b3:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8014b5:	48 85 c0             	test   %rax,%rax
+  8014b8:	7f 06                	jg     8014c0 <sys_env_set_pgfault_upcall+0x36>
+}
+  8014ba:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014be:	c9                   	leave
+  8014bf:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8014c0:	49 89 c0             	mov    %rax,%r8
+  8014c3:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  8014c8:	48 ba d0 32 80 00 00 	movabs $0x8032d0,%rdx
+  8014cf:	00 00 00 
+  8014d2:	be 26 00 00 00       	mov    $0x26,%esi
+  8014d7:	48 bf ef 32 80 00 00 	movabs $0x8032ef,%rdi
+  8014de:	00 00 00 
+  8014e1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014e6:	49 b9 a6 2c 80 00 00 	movabs $0x802ca6,%r9
+  8014ed:	00 00 00 
+  8014f0:	41 ff d1             	call   *%r9
+
+00000000008014f3 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  8014f3:	55                   	push   %rbp
+  8014f4:	48 89 e5             	mov    %rsp,%rbp
+  8014f7:	53                   	push   %rbx
+  8014f8:	89 f8                	mov    %edi,%eax
+  8014fa:	49 89 f1             	mov    %rsi,%r9
+  8014fd:	48 89 d3             	mov    %rdx,%rbx
+  801500:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  801503:	49 63 f0             	movslq %r8d,%rsi
+  801506:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801509:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80150e:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801511:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801517:	cd 30                	int    $0x30
+}
+  801519:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80151d:	c9                   	leave
+  80151e:	c3                   	ret
+
+000000000080151f <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  80151f:	55                   	push   %rbp
+  801520:	48 89 e5             	mov    %rsp,%rbp
+  801523:	53                   	push   %rbx
+  801524:	48 83 ec 08          	sub    $0x8,%rsp
+  801528:	48 89 fa             	mov    %rdi,%rdx
+  80152b:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80152e:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801533:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801538:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80153d:	be 00 00 00 00       	mov    $0x0,%esi
+  801542:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801548:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80154a:	48 85 c0             	test   %rax,%rax
+  80154d:	7f 06                	jg     801555 <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  80154f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801553:	c9                   	leave
+  801554:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801555:	49 89 c0             	mov    %rax,%r8
+  801558:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  80155d:	48 ba d0 32 80 00 00 	movabs $0x8032d0,%rdx
+  801564:	00 00 00 
+  801567:	be 26 00 00 00       	mov    $0x26,%esi
+  80156c:	48 bf ef 32 80 00 00 	movabs $0x8032ef,%rdi
+  801573:	00 00 00 
+  801576:	b8 00 00 00 00       	mov    $0x0,%eax
+  80157b:	49 b9 a6 2c 80 00 00 	movabs $0x802ca6,%r9
+  801582:	00 00 00 
+  801585:	41 ff d1             	call   *%r9
+
+0000000000801588 <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  801588:	55                   	push   %rbp
+  801589:	48 89 e5             	mov    %rsp,%rbp
+  80158c:	41 55                	push   %r13
+  80158e:	41 54                	push   %r12
+  801590:	53                   	push   %rbx
+  801591:	48 83 ec 08          	sub    $0x8,%rsp
+  801595:	49 89 fc             	mov    %rdi,%r12
+  801598:	48 89 f7             	mov    %rsi,%rdi
+  80159b:	48 89 d3             	mov    %rdx,%rbx
+  80159e:	49 89 cd             	mov    %rcx,%r13
+    // LAB 9: Your code here:
+    int res = sys_ipc_recv(!pg ? (void*)MAX_USER_ADDRESS : pg, !size ? 0 : *size);
+  8015a1:	be 00 00 00 00       	mov    $0x0,%esi
+  8015a6:	48 85 d2             	test   %rdx,%rdx
+  8015a9:	74 03                	je     8015ae <ipc_recv+0x26>
+  8015ab:	48 8b 32             	mov    (%rdx),%rsi
+  8015ae:	48 85 ff             	test   %rdi,%rdi
+  8015b1:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8015b8:	00 00 00 
+  8015bb:	48 0f 44 f8          	cmove  %rax,%rdi
+  8015bf:	48 b8 1f 15 80 00 00 	movabs $0x80151f,%rax
+  8015c6:	00 00 00 
+  8015c9:	ff d0                	call   *%rax
+    if (res < 0) {
+  8015cb:	85 c0                	test   %eax,%eax
+  8015cd:	78 66                	js     801635 <ipc_recv+0xad>
+        if (size) {
+            *size = 0;
+        }
+        return res;
+    }
+    if (from_env_store) {
+  8015cf:	4d 85 e4             	test   %r12,%r12
+  8015d2:	74 14                	je     8015e8 <ipc_recv+0x60>
+        *from_env_store = thisenv->env_ipc_from;
+  8015d4:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  8015db:	00 00 00 
+  8015de:	8b 80 ac 01 00 00    	mov    0x1ac(%rax),%eax
+  8015e4:	41 89 04 24          	mov    %eax,(%r12)
+    }
+    if (perm_store) {
+  8015e8:	4d 85 ed             	test   %r13,%r13
+  8015eb:	74 14                	je     801601 <ipc_recv+0x79>
+        *perm_store = thisenv->env_ipc_perm;
+  8015ed:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  8015f4:	00 00 00 
+  8015f7:	8b 80 b0 01 00 00    	mov    0x1b0(%rax),%eax
+  8015fd:	41 89 45 00          	mov    %eax,0x0(%r13)
+    }
+    if (size) {
+  801601:	48 85 db             	test   %rbx,%rbx
+  801604:	74 14                	je     80161a <ipc_recv+0x92>
+        *size = thisenv->env_ipc_maxsz;
+  801606:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  80160d:	00 00 00 
+  801610:	48 8b 80 a0 01 00 00 	mov    0x1a0(%rax),%rax
+  801617:	48 89 03             	mov    %rax,(%rbx)
+    }
+    return thisenv->env_ipc_value;
+  80161a:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801621:	00 00 00 
+  801624:	8b 80 a8 01 00 00    	mov    0x1a8(%rax),%eax
+}
+  80162a:	48 83 c4 08          	add    $0x8,%rsp
+  80162e:	5b                   	pop    %rbx
+  80162f:	41 5c                	pop    %r12
+  801631:	41 5d                	pop    %r13
+  801633:	5d                   	pop    %rbp
+  801634:	c3                   	ret
+        if (from_env_store) {
+  801635:	4d 85 e4             	test   %r12,%r12
+  801638:	74 08                	je     801642 <ipc_recv+0xba>
+            *from_env_store = 0;
+  80163a:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  801641:	00 
+        if (perm_store) {
+  801642:	4d 85 ed             	test   %r13,%r13
+  801645:	74 08                	je     80164f <ipc_recv+0xc7>
+            *perm_store = 0;
+  801647:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  80164e:	00 
+        if (size) {
+  80164f:	48 85 db             	test   %rbx,%rbx
+  801652:	74 d6                	je     80162a <ipc_recv+0xa2>
+            *size = 0;
+  801654:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  80165b:	eb cd                	jmp    80162a <ipc_recv+0xa2>
+
+000000000080165d <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  80165d:	55                   	push   %rbp
+  80165e:	48 89 e5             	mov    %rsp,%rbp
+  801661:	41 57                	push   %r15
+  801663:	41 56                	push   %r14
+  801665:	41 55                	push   %r13
+  801667:	41 54                	push   %r12
+  801669:	53                   	push   %rbx
+  80166a:	48 83 ec 18          	sub    $0x18,%rsp
+  80166e:	41 89 fd             	mov    %edi,%r13d
+  801671:	89 75 cc             	mov    %esi,-0x34(%rbp)
+  801674:	49 89 cc             	mov    %rcx,%r12
+  801677:	44 89 45 c8          	mov    %r8d,-0x38(%rbp)
+    // LAB 9: Your code here:
+    int res = 0;
+    while ((res = sys_ipc_try_send(to_env, val, !pg ? (void*)MAX_USER_ADDRESS : pg, size, perm)) < 0) {
+  80167b:	48 85 d2             	test   %rdx,%rdx
+  80167e:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  801685:	00 00 00 
+  801688:	48 0f 45 c2          	cmovne %rdx,%rax
+  80168c:	48 89 c3             	mov    %rax,%rbx
+  80168f:	49 be f3 14 80 00 00 	movabs $0x8014f3,%r14
+  801696:	00 00 00 
+        if (res != -E_IPC_NOT_RECV) {
+            panic("sys_ipc_try_send failed: %i", res);
+        }
+        sys_yield();
+  801699:	49 bf be 10 80 00 00 	movabs $0x8010be,%r15
+  8016a0:	00 00 00 
+    while ((res = sys_ipc_try_send(to_env, val, !pg ? (void*)MAX_USER_ADDRESS : pg, size, perm)) < 0) {
+  8016a3:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  8016a6:	44 8b 45 c8          	mov    -0x38(%rbp),%r8d
+  8016aa:	4c 89 e1             	mov    %r12,%rcx
+  8016ad:	48 89 da             	mov    %rbx,%rdx
+  8016b0:	44 89 ef             	mov    %r13d,%edi
+  8016b3:	41 ff d6             	call   *%r14
+  8016b6:	85 c0                	test   %eax,%eax
+  8016b8:	79 37                	jns    8016f1 <ipc_send+0x94>
+        if (res != -E_IPC_NOT_RECV) {
+  8016ba:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  8016bd:	75 05                	jne    8016c4 <ipc_send+0x67>
+        sys_yield();
+  8016bf:	41 ff d7             	call   *%r15
+  8016c2:	eb df                	jmp    8016a3 <ipc_send+0x46>
+            panic("sys_ipc_try_send failed: %i", res);
+  8016c4:	89 c1                	mov    %eax,%ecx
+  8016c6:	48 ba fd 32 80 00 00 	movabs $0x8032fd,%rdx
+  8016cd:	00 00 00 
+  8016d0:	be 40 00 00 00       	mov    $0x40,%esi
+  8016d5:	48 bf 19 33 80 00 00 	movabs $0x803319,%rdi
+  8016dc:	00 00 00 
+  8016df:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016e4:	49 b8 a6 2c 80 00 00 	movabs $0x802ca6,%r8
+  8016eb:	00 00 00 
+  8016ee:	41 ff d0             	call   *%r8
+    }
+    return;
+}
+  8016f1:	48 83 c4 18          	add    $0x18,%rsp
+  8016f5:	5b                   	pop    %rbx
+  8016f6:	41 5c                	pop    %r12
+  8016f8:	41 5d                	pop    %r13
+  8016fa:	41 5e                	pop    %r14
+  8016fc:	41 5f                	pop    %r15
+  8016fe:	5d                   	pop    %rbp
+  8016ff:	c3                   	ret
+
+0000000000801700 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  801700:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  801705:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  80170c:	00 00 00 
+  80170f:	48 69 d0 d0 01 00 00 	imul   $0x1d0,%rax,%rdx
+  801716:	48 01 ca             	add    %rcx,%rdx
+  801719:	8b 92 e8 00 00 00    	mov    0xe8(%rdx),%edx
+  80171f:	39 fa                	cmp    %edi,%edx
+  801721:	74 12                	je     801735 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  801723:	48 83 c0 01          	add    $0x1,%rax
+  801727:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  80172d:	75 e0                	jne    80170f <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  80172f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801734:	c3                   	ret
+            return envs[i].env_id;
+  801735:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+  80173c:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  801743:	00 00 00 
+  801746:	48 01 d0             	add    %rdx,%rax
+  801749:	8b 80 e0 00 00 00    	mov    0xe0(%rax),%eax
+  80174f:	c3                   	ret
+
+0000000000801750 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801750:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801757:	ff ff ff 
+  80175a:	48 01 f8             	add    %rdi,%rax
+  80175d:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  801761:	c3                   	ret
+
+0000000000801762 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801762:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801769:	ff ff ff 
+  80176c:	48 01 f8             	add    %rdi,%rax
+  80176f:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  801773:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  801779:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  80177d:	c3                   	ret
+
+000000000080177e <fd_alloc_from>:
+}
+
+/* Like fd_alloc(), but only considers fds starting from fdnum,
+ * so that several fds can be found before their pages are allocated */
+int
+fd_alloc_from(int fdnum, struct Fd **fd_store) {
+  80177e:	55                   	push   %rbp
+  80177f:	48 89 e5             	mov    %rsp,%rbp
+  801782:	41 57                	push   %r15
+  801784:	41 56                	push   %r14
+  801786:	41 55                	push   %r13
+  801788:	41 54                	push   %r12
+  80178a:	53                   	push   %rbx
+  80178b:	48 83 ec 08          	sub    $0x8,%rsp
+  80178f:	49 89 f7             	mov    %rsi,%r15
+    for (int i = MAX(fdnum, 0); i < MAXFD; i++) {
+  801792:	85 ff                	test   %edi,%edi
+  801794:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80179a:	44 0f 49 e7          	cmovns %edi,%r12d
+  80179e:	83 ff 1f             	cmp    $0x1f,%edi
+  8017a1:	7f 37                	jg     8017da <fd_alloc_from+0x5c>
+  8017a3:	49 63 dc             	movslq %r12d,%rbx
+  8017a6:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  8017ad:	48 c1 e3 0c          	shl    $0xc,%rbx
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  8017b1:	49 be 87 28 80 00 00 	movabs $0x802887,%r14
+  8017b8:	00 00 00 
+        struct Fd *fd = INDEX2FD(i);
+  8017bb:	49 89 dd             	mov    %rbx,%r13
+        if (!(get_prot(fd) & PROT_R)) {
+  8017be:	48 89 df             	mov    %rbx,%rdi
+  8017c1:	41 ff d6             	call   *%r14
+  8017c4:	83 e0 04             	and    $0x4,%eax
+  8017c7:	74 1c                	je     8017e5 <fd_alloc_from+0x67>
+    for (int i = MAX(fdnum, 0); i < MAXFD; i++) {
+  8017c9:	41 83 c4 01          	add    $0x1,%r12d
+  8017cd:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8017d4:	41 83 fc 1f          	cmp    $0x1f,%r12d
+  8017d8:	7e e1                	jle    8017bb <fd_alloc_from+0x3d>
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  8017da:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  8017e0:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  8017e5:	4d 89 2f             	mov    %r13,(%r15)
+}
+  8017e8:	48 83 c4 08          	add    $0x8,%rsp
+  8017ec:	5b                   	pop    %rbx
+  8017ed:	41 5c                	pop    %r12
+  8017ef:	41 5d                	pop    %r13
+  8017f1:	41 5e                	pop    %r14
+  8017f3:	41 5f                	pop    %r15
+  8017f5:	5d                   	pop    %rbp
+  8017f6:	c3                   	ret
+
+00000000008017f7 <fd_alloc>:
+fd_alloc(struct Fd **fd_store) {
+  8017f7:	55                   	push   %rbp
+  8017f8:	48 89 e5             	mov    %rsp,%rbp
+  8017fb:	48 89 fe             	mov    %rdi,%rsi
+    return fd_alloc_from(0, fd_store);
+  8017fe:	bf 00 00 00 00       	mov    $0x0,%edi
+  801803:	48 b8 7e 17 80 00 00 	movabs $0x80177e,%rax
+  80180a:	00 00 00 
+  80180d:	ff d0                	call   *%rax
+}
+  80180f:	5d                   	pop    %rbp
+  801810:	c3                   	ret
+
+0000000000801811 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  801811:	83 ff 1f             	cmp    $0x1f,%edi
+  801814:	77 39                	ja     80184f <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  801816:	55                   	push   %rbp
+  801817:	48 89 e5             	mov    %rsp,%rbp
+  80181a:	41 54                	push   %r12
+  80181c:	53                   	push   %rbx
+  80181d:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  801820:	48 63 df             	movslq %edi,%rbx
+  801823:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  80182a:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  80182e:	48 89 df             	mov    %rbx,%rdi
+  801831:	48 b8 87 28 80 00 00 	movabs $0x802887,%rax
+  801838:	00 00 00 
+  80183b:	ff d0                	call   *%rax
+  80183d:	a8 04                	test   $0x4,%al
+  80183f:	74 14                	je     801855 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  801841:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  801845:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80184a:	5b                   	pop    %rbx
+  80184b:	41 5c                	pop    %r12
+  80184d:	5d                   	pop    %rbp
+  80184e:	c3                   	ret
+        return -E_INVAL;
+  80184f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801854:	c3                   	ret
+        return -E_INVAL;
+  801855:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80185a:	eb ee                	jmp    80184a <fd_lookup+0x39>
+
+000000000080185c <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  80185c:	55                   	push   %rbp
+  80185d:	48 89 e5             	mov    %rsp,%rbp
+  801860:	41 54                	push   %r12
+  801862:	53                   	push   %rbx
+  801863:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  801866:	48 b8 c0 33 80 00 00 	movabs $0x8033c0,%rax
+  80186d:	00 00 00 
+  801870:	48 bb 20 40 80 00 00 	movabs $0x804020,%rbx
+  801877:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  80187a:	39 3b                	cmp    %edi,(%rbx)
+  80187c:	74 47                	je     8018c5 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  80187e:	48 83 c0 08          	add    $0x8,%rax
+  801882:	48 8b 18             	mov    (%rax),%rbx
+  801885:	48 85 db             	test   %rbx,%rbx
+  801888:	75 f0                	jne    80187a <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  80188a:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801891:	00 00 00 
+  801894:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+  80189a:	89 fa                	mov    %edi,%edx
+  80189c:	48 bf 28 33 80 00 00 	movabs $0x803328,%rdi
+  8018a3:	00 00 00 
+  8018a6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018ab:	48 b9 78 02 80 00 00 	movabs $0x800278,%rcx
+  8018b2:	00 00 00 
+  8018b5:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  8018b7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  8018bc:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  8018c0:	5b                   	pop    %rbx
+  8018c1:	41 5c                	pop    %r12
+  8018c3:	5d                   	pop    %rbp
+  8018c4:	c3                   	ret
+            return 0;
+  8018c5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018ca:	eb f0                	jmp    8018bc <dev_lookup+0x60>
+
+00000000008018cc <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  8018cc:	55                   	push   %rbp
+  8018cd:	48 89 e5             	mov    %rsp,%rbp
+  8018d0:	41 55                	push   %r13
+  8018d2:	41 54                	push   %r12
+  8018d4:	53                   	push   %rbx
+  8018d5:	48 83 ec 18          	sub    $0x18,%rsp
+  8018d9:	48 89 fb             	mov    %rdi,%rbx
+  8018dc:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8018df:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  8018e6:	ff ff ff 
+  8018e9:	48 01 df             	add    %rbx,%rdi
+  8018ec:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  8018f0:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8018f4:	48 b8 11 18 80 00 00 	movabs $0x801811,%rax
+  8018fb:	00 00 00 
+  8018fe:	ff d0                	call   *%rax
+  801900:	41 89 c5             	mov    %eax,%r13d
+  801903:	85 c0                	test   %eax,%eax
+  801905:	78 06                	js     80190d <fd_close+0x41>
+  801907:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  80190b:	74 1a                	je     801927 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  80190d:	45 84 e4             	test   %r12b,%r12b
+  801910:	b8 00 00 00 00       	mov    $0x0,%eax
+  801915:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  801919:	44 89 e8             	mov    %r13d,%eax
+  80191c:	48 83 c4 18          	add    $0x18,%rsp
+  801920:	5b                   	pop    %rbx
+  801921:	41 5c                	pop    %r12
+  801923:	41 5d                	pop    %r13
+  801925:	5d                   	pop    %rbp
+  801926:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801927:	8b 3b                	mov    (%rbx),%edi
+  801929:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80192d:	48 b8 5c 18 80 00 00 	movabs $0x80185c,%rax
+  801934:	00 00 00 
+  801937:	ff d0                	call   *%rax
+  801939:	41 89 c5             	mov    %eax,%r13d
+  80193c:	85 c0                	test   %eax,%eax
+  80193e:	78 1b                	js     80195b <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  801940:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801944:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801948:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  80194e:	48 85 c0             	test   %rax,%rax
+  801951:	74 08                	je     80195b <fd_close+0x8f>
+  801953:	48 89 df             	mov    %rbx,%rdi
+  801956:	ff d0                	call   *%rax
+  801958:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  80195b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801960:	48 89 de             	mov    %rbx,%rsi
+  801963:	bf 00 00 00 00       	mov    $0x0,%edi
+  801968:	48 b8 19 12 80 00 00 	movabs $0x801219,%rax
+  80196f:	00 00 00 
+  801972:	ff d0                	call   *%rax
+    return res;
+  801974:	eb a3                	jmp    801919 <fd_close+0x4d>
+
+0000000000801976 <close>:
+
+int
+close(int fdnum) {
+  801976:	55                   	push   %rbp
+  801977:	48 89 e5             	mov    %rsp,%rbp
+  80197a:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  80197e:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801982:	48 b8 11 18 80 00 00 	movabs $0x801811,%rax
+  801989:	00 00 00 
+  80198c:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80198e:	85 c0                	test   %eax,%eax
+  801990:	78 15                	js     8019a7 <close+0x31>
+
+    return fd_close(fd, 1);
+  801992:	be 01 00 00 00       	mov    $0x1,%esi
+  801997:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80199b:	48 b8 cc 18 80 00 00 	movabs $0x8018cc,%rax
+  8019a2:	00 00 00 
+  8019a5:	ff d0                	call   *%rax
+}
+  8019a7:	c9                   	leave
+  8019a8:	c3                   	ret
+
+00000000008019a9 <close_all>:
+
+void
+close_all(void) {
+  8019a9:	55                   	push   %rbp
+  8019aa:	48 89 e5             	mov    %rsp,%rbp
+  8019ad:	41 54                	push   %r12
+  8019af:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  8019b0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8019b5:	49 bc 76 19 80 00 00 	movabs $0x801976,%r12
+  8019bc:	00 00 00 
+  8019bf:	89 df                	mov    %ebx,%edi
+  8019c1:	41 ff d4             	call   *%r12
+  8019c4:	83 c3 01             	add    $0x1,%ebx
+  8019c7:	83 fb 20             	cmp    $0x20,%ebx
+  8019ca:	75 f3                	jne    8019bf <close_all+0x16>
+}
+  8019cc:	5b                   	pop    %rbx
+  8019cd:	41 5c                	pop    %r12
+  8019cf:	5d                   	pop    %rbp
+  8019d0:	c3                   	ret
+
+00000000008019d1 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  8019d1:	55                   	push   %rbp
+  8019d2:	48 89 e5             	mov    %rsp,%rbp
+  8019d5:	41 57                	push   %r15
+  8019d7:	41 56                	push   %r14
+  8019d9:	41 55                	push   %r13
+  8019db:	41 54                	push   %r12
+  8019dd:	53                   	push   %rbx
+  8019de:	48 83 ec 18          	sub    $0x18,%rsp
+  8019e2:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  8019e5:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  8019e9:	48 b8 11 18 80 00 00 	movabs $0x801811,%rax
+  8019f0:	00 00 00 
+  8019f3:	ff d0                	call   *%rax
+  8019f5:	89 c3                	mov    %eax,%ebx
+  8019f7:	85 c0                	test   %eax,%eax
+  8019f9:	0f 88 b8 00 00 00    	js     801ab7 <dup+0xe6>
+    close(newfdnum);
+  8019ff:	44 89 e7             	mov    %r12d,%edi
+  801a02:	48 b8 76 19 80 00 00 	movabs $0x801976,%rax
+  801a09:	00 00 00 
+  801a0c:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  801a0e:	4d 63 ec             	movslq %r12d,%r13
+  801a11:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  801a18:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  801a1c:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  801a20:	4c 89 ff             	mov    %r15,%rdi
+  801a23:	49 be 62 17 80 00 00 	movabs $0x801762,%r14
+  801a2a:	00 00 00 
+  801a2d:	41 ff d6             	call   *%r14
+  801a30:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  801a33:	4c 89 ef             	mov    %r13,%rdi
+  801a36:	41 ff d6             	call   *%r14
+  801a39:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  801a3c:	48 89 df             	mov    %rbx,%rdi
+  801a3f:	48 b8 87 28 80 00 00 	movabs $0x802887,%rax
+  801a46:	00 00 00 
+  801a49:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  801a4b:	a8 04                	test   $0x4,%al
+  801a4d:	74 2b                	je     801a7a <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  801a4f:	41 89 c1             	mov    %eax,%r9d
+  801a52:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801a58:	4c 89 f1             	mov    %r14,%rcx
+  801a5b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a60:	48 89 de             	mov    %rbx,%rsi
+  801a63:	bf 00 00 00 00       	mov    $0x0,%edi
+  801a68:	48 b8 b4 11 80 00 00 	movabs $0x8011b4,%rax
+  801a6f:	00 00 00 
+  801a72:	ff d0                	call   *%rax
+  801a74:	89 c3                	mov    %eax,%ebx
+  801a76:	85 c0                	test   %eax,%eax
+  801a78:	78 4e                	js     801ac8 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  801a7a:	4c 89 ff             	mov    %r15,%rdi
+  801a7d:	48 b8 87 28 80 00 00 	movabs $0x802887,%rax
+  801a84:	00 00 00 
+  801a87:	ff d0                	call   *%rax
+  801a89:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801a8c:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801a92:	4c 89 e9             	mov    %r13,%rcx
+  801a95:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a9a:	4c 89 fe             	mov    %r15,%rsi
+  801a9d:	bf 00 00 00 00       	mov    $0x0,%edi
+  801aa2:	48 b8 b4 11 80 00 00 	movabs $0x8011b4,%rax
+  801aa9:	00 00 00 
+  801aac:	ff d0                	call   *%rax
+  801aae:	89 c3                	mov    %eax,%ebx
+  801ab0:	85 c0                	test   %eax,%eax
+  801ab2:	78 14                	js     801ac8 <dup+0xf7>
+
+    return newfdnum;
+  801ab4:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  801ab7:	89 d8                	mov    %ebx,%eax
+  801ab9:	48 83 c4 18          	add    $0x18,%rsp
+  801abd:	5b                   	pop    %rbx
+  801abe:	41 5c                	pop    %r12
+  801ac0:	41 5d                	pop    %r13
+  801ac2:	41 5e                	pop    %r14
+  801ac4:	41 5f                	pop    %r15
+  801ac6:	5d                   	pop    %rbp
+  801ac7:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  801ac8:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801acd:	4c 89 ee             	mov    %r13,%rsi
+  801ad0:	bf 00 00 00 00       	mov    $0x0,%edi
+  801ad5:	49 bc 19 12 80 00 00 	movabs $0x801219,%r12
+  801adc:	00 00 00 
+  801adf:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  801ae2:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801ae7:	4c 89 f6             	mov    %r14,%rsi
+  801aea:	bf 00 00 00 00       	mov    $0x0,%edi
+  801aef:	41 ff d4             	call   *%r12
+    return res;
+  801af2:	eb c3                	jmp    801ab7 <dup+0xe6>
+
+0000000000801af4 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  801af4:	55                   	push   %rbp
+  801af5:	48 89 e5             	mov    %rsp,%rbp
+  801af8:	41 56                	push   %r14
+  801afa:	41 55                	push   %r13
+  801afc:	41 54                	push   %r12
+  801afe:	53                   	push   %rbx
+  801aff:	48 83 ec 10          	sub    $0x10,%rsp
+  801b03:	89 fb                	mov    %edi,%ebx
+  801b05:	49 89 f4             	mov    %rsi,%r12
+  801b08:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801b0b:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801b0f:	48 b8 11 18 80 00 00 	movabs $0x801811,%rax
+  801b16:	00 00 00 
+  801b19:	ff d0                	call   *%rax
+  801b1b:	85 c0                	test   %eax,%eax
+  801b1d:	78 4c                	js     801b6b <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801b1f:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801b23:	41 8b 3e             	mov    (%r14),%edi
+  801b26:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801b2a:	48 b8 5c 18 80 00 00 	movabs $0x80185c,%rax
+  801b31:	00 00 00 
+  801b34:	ff d0                	call   *%rax
+  801b36:	85 c0                	test   %eax,%eax
+  801b38:	78 35                	js     801b6f <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801b3a:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801b3e:	83 e0 03             	and    $0x3,%eax
+  801b41:	83 f8 01             	cmp    $0x1,%eax
+  801b44:	74 2d                	je     801b73 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801b46:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801b4a:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801b4e:	48 85 c0             	test   %rax,%rax
+  801b51:	74 56                	je     801ba9 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  801b53:	4c 89 ea             	mov    %r13,%rdx
+  801b56:	4c 89 e6             	mov    %r12,%rsi
+  801b59:	4c 89 f7             	mov    %r14,%rdi
+  801b5c:	ff d0                	call   *%rax
+}
+  801b5e:	48 83 c4 10          	add    $0x10,%rsp
+  801b62:	5b                   	pop    %rbx
+  801b63:	41 5c                	pop    %r12
+  801b65:	41 5d                	pop    %r13
+  801b67:	41 5e                	pop    %r14
+  801b69:	5d                   	pop    %rbp
+  801b6a:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801b6b:	48 98                	cltq
+  801b6d:	eb ef                	jmp    801b5e <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801b6f:	48 98                	cltq
+  801b71:	eb eb                	jmp    801b5e <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801b73:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801b7a:	00 00 00 
+  801b7d:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+  801b83:	89 da                	mov    %ebx,%edx
+  801b85:	48 bf 69 33 80 00 00 	movabs $0x803369,%rdi
+  801b8c:	00 00 00 
+  801b8f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b94:	48 b9 78 02 80 00 00 	movabs $0x800278,%rcx
+  801b9b:	00 00 00 
+  801b9e:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801ba0:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801ba7:	eb b5                	jmp    801b5e <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801ba9:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801bb0:	eb ac                	jmp    801b5e <read+0x6a>
+
+0000000000801bb2 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801bb2:	55                   	push   %rbp
+  801bb3:	48 89 e5             	mov    %rsp,%rbp
+  801bb6:	41 57                	push   %r15
+  801bb8:	41 56                	push   %r14
+  801bba:	41 55                	push   %r13
+  801bbc:	41 54                	push   %r12
+  801bbe:	53                   	push   %rbx
+  801bbf:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  801bc3:	48 85 d2             	test   %rdx,%rdx
+  801bc6:	74 54                	je     801c1c <readn+0x6a>
+  801bc8:	41 89 fd             	mov    %edi,%r13d
+  801bcb:	49 89 f6             	mov    %rsi,%r14
+  801bce:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  801bd1:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  801bd6:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  801bdb:	49 bf f4 1a 80 00 00 	movabs $0x801af4,%r15
+  801be2:	00 00 00 
+  801be5:	4c 89 e2             	mov    %r12,%rdx
+  801be8:	48 29 f2             	sub    %rsi,%rdx
+  801beb:	4c 01 f6             	add    %r14,%rsi
+  801bee:	44 89 ef             	mov    %r13d,%edi
+  801bf1:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  801bf4:	85 c0                	test   %eax,%eax
+  801bf6:	78 20                	js     801c18 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  801bf8:	01 c3                	add    %eax,%ebx
+  801bfa:	85 c0                	test   %eax,%eax
+  801bfc:	74 08                	je     801c06 <readn+0x54>
+  801bfe:	48 63 f3             	movslq %ebx,%rsi
+  801c01:	4c 39 e6             	cmp    %r12,%rsi
+  801c04:	72 df                	jb     801be5 <readn+0x33>
+    }
+    return res;
+  801c06:	48 63 c3             	movslq %ebx,%rax
+}
+  801c09:	48 83 c4 08          	add    $0x8,%rsp
+  801c0d:	5b                   	pop    %rbx
+  801c0e:	41 5c                	pop    %r12
+  801c10:	41 5d                	pop    %r13
+  801c12:	41 5e                	pop    %r14
+  801c14:	41 5f                	pop    %r15
+  801c16:	5d                   	pop    %rbp
+  801c17:	c3                   	ret
+        if (inc < 0) return inc;
+  801c18:	48 98                	cltq
+  801c1a:	eb ed                	jmp    801c09 <readn+0x57>
+    int inc = 1, res = 0;
+  801c1c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801c21:	eb e3                	jmp    801c06 <readn+0x54>
+
+0000000000801c23 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  801c23:	55                   	push   %rbp
+  801c24:	48 89 e5             	mov    %rsp,%rbp
+  801c27:	41 56                	push   %r14
+  801c29:	41 55                	push   %r13
+  801c2b:	41 54                	push   %r12
+  801c2d:	53                   	push   %rbx
+  801c2e:	48 83 ec 10          	sub    $0x10,%rsp
+  801c32:	89 fb                	mov    %edi,%ebx
+  801c34:	49 89 f4             	mov    %rsi,%r12
+  801c37:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801c3a:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801c3e:	48 b8 11 18 80 00 00 	movabs $0x801811,%rax
+  801c45:	00 00 00 
+  801c48:	ff d0                	call   *%rax
+  801c4a:	85 c0                	test   %eax,%eax
+  801c4c:	78 47                	js     801c95 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801c4e:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801c52:	41 8b 3e             	mov    (%r14),%edi
+  801c55:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801c59:	48 b8 5c 18 80 00 00 	movabs $0x80185c,%rax
+  801c60:	00 00 00 
+  801c63:	ff d0                	call   *%rax
+  801c65:	85 c0                	test   %eax,%eax
+  801c67:	78 30                	js     801c99 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801c69:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  801c6e:	74 2d                	je     801c9d <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801c70:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801c74:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801c78:	48 85 c0             	test   %rax,%rax
+  801c7b:	74 56                	je     801cd3 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  801c7d:	4c 89 ea             	mov    %r13,%rdx
+  801c80:	4c 89 e6             	mov    %r12,%rsi
+  801c83:	4c 89 f7             	mov    %r14,%rdi
+  801c86:	ff d0                	call   *%rax
+}
+  801c88:	48 83 c4 10          	add    $0x10,%rsp
+  801c8c:	5b                   	pop    %rbx
+  801c8d:	41 5c                	pop    %r12
+  801c8f:	41 5d                	pop    %r13
+  801c91:	41 5e                	pop    %r14
+  801c93:	5d                   	pop    %rbp
+  801c94:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801c95:	48 98                	cltq
+  801c97:	eb ef                	jmp    801c88 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801c99:	48 98                	cltq
+  801c9b:	eb eb                	jmp    801c88 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801c9d:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801ca4:	00 00 00 
+  801ca7:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+  801cad:	89 da                	mov    %ebx,%edx
+  801caf:	48 bf 85 33 80 00 00 	movabs $0x803385,%rdi
+  801cb6:	00 00 00 
+  801cb9:	b8 00 00 00 00       	mov    $0x0,%eax
+  801cbe:	48 b9 78 02 80 00 00 	movabs $0x800278,%rcx
+  801cc5:	00 00 00 
+  801cc8:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801cca:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801cd1:	eb b5                	jmp    801c88 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801cd3:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801cda:	eb ac                	jmp    801c88 <write+0x65>
+
+0000000000801cdc <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  801cdc:	55                   	push   %rbp
+  801cdd:	48 89 e5             	mov    %rsp,%rbp
+  801ce0:	53                   	push   %rbx
+  801ce1:	48 83 ec 18          	sub    $0x18,%rsp
+  801ce5:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801ce7:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801ceb:	48 b8 11 18 80 00 00 	movabs $0x801811,%rax
+  801cf2:	00 00 00 
+  801cf5:	ff d0                	call   *%rax
+  801cf7:	85 c0                	test   %eax,%eax
+  801cf9:	78 0c                	js     801d07 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  801cfb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801cff:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  801d02:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801d07:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801d0b:	c9                   	leave
+  801d0c:	c3                   	ret
+
+0000000000801d0d <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  801d0d:	55                   	push   %rbp
+  801d0e:	48 89 e5             	mov    %rsp,%rbp
+  801d11:	41 55                	push   %r13
+  801d13:	41 54                	push   %r12
+  801d15:	53                   	push   %rbx
+  801d16:	48 83 ec 18          	sub    $0x18,%rsp
+  801d1a:	89 fb                	mov    %edi,%ebx
+  801d1c:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801d1f:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801d23:	48 b8 11 18 80 00 00 	movabs $0x801811,%rax
+  801d2a:	00 00 00 
+  801d2d:	ff d0                	call   *%rax
+  801d2f:	85 c0                	test   %eax,%eax
+  801d31:	78 38                	js     801d6b <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801d33:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  801d37:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  801d3b:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801d3f:	48 b8 5c 18 80 00 00 	movabs $0x80185c,%rax
+  801d46:	00 00 00 
+  801d49:	ff d0                	call   *%rax
+  801d4b:	85 c0                	test   %eax,%eax
+  801d4d:	78 1c                	js     801d6b <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801d4f:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  801d54:	74 20                	je     801d76 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801d56:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801d5a:	48 8b 40 30          	mov    0x30(%rax),%rax
+  801d5e:	48 85 c0             	test   %rax,%rax
+  801d61:	74 47                	je     801daa <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  801d63:	44 89 e6             	mov    %r12d,%esi
+  801d66:	4c 89 ef             	mov    %r13,%rdi
+  801d69:	ff d0                	call   *%rax
+}
+  801d6b:	48 83 c4 18          	add    $0x18,%rsp
+  801d6f:	5b                   	pop    %rbx
+  801d70:	41 5c                	pop    %r12
+  801d72:	41 5d                	pop    %r13
+  801d74:	5d                   	pop    %rbp
+  801d75:	c3                   	ret
+                thisenv->env_id, fdnum);
+  801d76:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801d7d:	00 00 00 
+  801d80:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801d86:	89 da                	mov    %ebx,%edx
+  801d88:	48 bf 48 33 80 00 00 	movabs $0x803348,%rdi
+  801d8f:	00 00 00 
+  801d92:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d97:	48 b9 78 02 80 00 00 	movabs $0x800278,%rcx
+  801d9e:	00 00 00 
+  801da1:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801da3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801da8:	eb c1                	jmp    801d6b <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801daa:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801daf:	eb ba                	jmp    801d6b <ftruncate+0x5e>
+
+0000000000801db1 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  801db1:	55                   	push   %rbp
+  801db2:	48 89 e5             	mov    %rsp,%rbp
+  801db5:	41 54                	push   %r12
+  801db7:	53                   	push   %rbx
+  801db8:	48 83 ec 10          	sub    $0x10,%rsp
+  801dbc:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801dbf:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801dc3:	48 b8 11 18 80 00 00 	movabs $0x801811,%rax
+  801dca:	00 00 00 
+  801dcd:	ff d0                	call   *%rax
+  801dcf:	85 c0                	test   %eax,%eax
+  801dd1:	78 4e                	js     801e21 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801dd3:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801dd7:	41 8b 3c 24          	mov    (%r12),%edi
+  801ddb:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801ddf:	48 b8 5c 18 80 00 00 	movabs $0x80185c,%rax
+  801de6:	00 00 00 
+  801de9:	ff d0                	call   *%rax
+  801deb:	85 c0                	test   %eax,%eax
+  801ded:	78 32                	js     801e21 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801def:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801df3:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  801df8:	74 30                	je     801e2a <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  801dfa:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  801dfd:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  801e04:	00 00 00 
+    stat->st_isdir = 0;
+  801e07:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  801e0e:	00 00 00 
+    stat->st_dev = dev;
+  801e11:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  801e18:	48 89 de             	mov    %rbx,%rsi
+  801e1b:	4c 89 e7             	mov    %r12,%rdi
+  801e1e:	ff 50 28             	call   *0x28(%rax)
+}
+  801e21:	48 83 c4 10          	add    $0x10,%rsp
+  801e25:	5b                   	pop    %rbx
+  801e26:	41 5c                	pop    %r12
+  801e28:	5d                   	pop    %rbp
+  801e29:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801e2a:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801e2f:	eb f0                	jmp    801e21 <fstat+0x70>
+
+0000000000801e31 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  801e31:	55                   	push   %rbp
+  801e32:	48 89 e5             	mov    %rsp,%rbp
+  801e35:	41 54                	push   %r12
+  801e37:	53                   	push   %rbx
+  801e38:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  801e3b:	be 00 00 00 00       	mov    $0x0,%esi
+  801e40:	48 b8 14 22 80 00 00 	movabs $0x802214,%rax
+  801e47:	00 00 00 
+  801e4a:	ff d0                	call   *%rax
+  801e4c:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  801e4e:	85 c0                	test   %eax,%eax
+  801e50:	78 25                	js     801e77 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  801e52:	4c 89 e6             	mov    %r12,%rsi
+  801e55:	89 c7                	mov    %eax,%edi
+  801e57:	48 b8 b1 1d 80 00 00 	movabs $0x801db1,%rax
+  801e5e:	00 00 00 
+  801e61:	ff d0                	call   *%rax
+  801e63:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  801e66:	89 df                	mov    %ebx,%edi
+  801e68:	48 b8 76 19 80 00 00 	movabs $0x801976,%rax
+  801e6f:	00 00 00 
+  801e72:	ff d0                	call   *%rax
+
+    return res;
+  801e74:	44 89 e3             	mov    %r12d,%ebx
+}
+  801e77:	89 d8                	mov    %ebx,%eax
+  801e79:	5b                   	pop    %rbx
+  801e7a:	41 5c                	pop    %r12
+  801e7c:	5d                   	pop    %rbp
+  801e7d:	c3                   	ret
+
+0000000000801e7e <fsipc>:
+ * response may be written back to fsipcbuf.
+ * type: request code, passed as the simple integer IPC value.
+ * dstva: virtual address at which to receive reply page, 0 if none.
+ * Returns result from the file server. */
+static int
+fsipc(unsigned type, void *dstva) {
+  801e7e:	55                   	push   %rbp
+  801e7f:	48 89 e5             	mov    %rsp,%rbp
+  801e82:	41 54                	push   %r12
+  801e84:	53                   	push   %rbx
+  801e85:	48 83 ec 10          	sub    $0x10,%rsp
+  801e89:	41 89 fc             	mov    %edi,%r12d
+  801e8c:	48 89 f3             	mov    %rsi,%rbx
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  801e8f:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  801e96:	00 00 00 
+  801e99:	83 38 00             	cmpl   $0x0,(%rax)
+  801e9c:	74 5e                	je     801efc <fsipc+0x7e>
+    if (debug) {
+        cprintf("[%08x] fsipc %d %08x\n",
+                thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+    }
+
+    ipc_send(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW);
+  801e9e:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  801ea4:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  801ea9:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  801eb0:	00 00 00 
+  801eb3:	44 89 e6             	mov    %r12d,%esi
+  801eb6:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  801ebd:	00 00 00 
+  801ec0:	8b 38                	mov    (%rax),%edi
+  801ec2:	48 b8 5d 16 80 00 00 	movabs $0x80165d,%rax
+  801ec9:	00 00 00 
+  801ecc:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  801ece:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  801ed5:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  801ed6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801edb:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  801edf:	48 89 de             	mov    %rbx,%rsi
+  801ee2:	bf 00 00 00 00       	mov    $0x0,%edi
+  801ee7:	48 b8 88 15 80 00 00 	movabs $0x801588,%rax
+  801eee:	00 00 00 
+  801ef1:	ff d0                	call   *%rax
+}
+  801ef3:	48 83 c4 10          	add    $0x10,%rsp
+  801ef7:	5b                   	pop    %rbx
+  801ef8:	41 5c                	pop    %r12
+  801efa:	5d                   	pop    %rbp
+  801efb:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  801efc:	bf 03 00 00 00       	mov    $0x3,%edi
+  801f01:	48 b8 00 17 80 00 00 	movabs $0x801700,%rax
+  801f08:	00 00 00 
+  801f0b:	ff d0                	call   *%rax
+  801f0d:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  801f14:	00 00 
+  801f16:	eb 86                	jmp    801e9e <fsipc+0x20>
+
+0000000000801f18 <devfile_trunc>:
+    return 0;
+}
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  801f18:	55                   	push   %rbp
+  801f19:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801f1c:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  801f23:	00 00 00 
+  801f26:	8b 57 0c             	mov    0xc(%rdi),%edx
+  801f29:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  801f2b:	89 70 04             	mov    %esi,0x4(%rax)
+
+    return fsipc(FSREQ_SET_SIZE, NULL);
+  801f2e:	be 00 00 00 00       	mov    $0x0,%esi
+  801f33:	bf 02 00 00 00       	mov    $0x2,%edi
+  801f38:	48 b8 7e 1e 80 00 00 	movabs $0x801e7e,%rax
+  801f3f:	00 00 00 
+  801f42:	ff d0                	call   *%rax
+}
+  801f44:	5d                   	pop    %rbp
+  801f45:	c3                   	ret
+
+0000000000801f46 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  801f46:	55                   	push   %rbp
+  801f47:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801f4a:	8b 47 0c             	mov    0xc(%rdi),%eax
+  801f4d:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  801f54:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  801f56:	be 00 00 00 00       	mov    $0x0,%esi
+  801f5b:	bf 06 00 00 00       	mov    $0x6,%edi
+  801f60:	48 b8 7e 1e 80 00 00 	movabs $0x801e7e,%rax
+  801f67:	00 00 00 
+  801f6a:	ff d0                	call   *%rax
+}
+  801f6c:	5d                   	pop    %rbp
+  801f6d:	c3                   	ret
+
+0000000000801f6e <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  801f6e:	55                   	push   %rbp
+  801f6f:	48 89 e5             	mov    %rsp,%rbp
+  801f72:	41 54                	push   %r12
+  801f74:	53                   	push   %rbx
+  801f75:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801f78:	8b 47 0c             	mov    0xc(%rdi),%eax
+  801f7b:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  801f82:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  801f84:	be 00 00 00 00       	mov    $0x0,%esi
+  801f89:	bf 05 00 00 00       	mov    $0x5,%edi
+  801f8e:	48 b8 7e 1e 80 00 00 	movabs $0x801e7e,%rax
+  801f95:	00 00 00 
+  801f98:	ff d0                	call   *%rax
+    if (res < 0) {
+  801f9a:	85 c0                	test   %eax,%eax
+  801f9c:	78 3d                	js     801fdb <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801f9e:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  801fa5:	00 00 00 
+  801fa8:	4c 89 e6             	mov    %r12,%rsi
+  801fab:	48 89 df             	mov    %rbx,%rdi
+  801fae:	48 b8 9d 0b 80 00 00 	movabs $0x800b9d,%rax
+  801fb5:	00 00 00 
+  801fb8:	ff d0                	call   *%rax
+    st->st_size  = fsipcbuf.statRet.ret_size;
+  801fba:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  801fc1:	00 
+  801fc2:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801fc8:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  801fcf:	00 
+  801fd0:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  801fd6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801fdb:	5b                   	pop    %rbx
+  801fdc:	41 5c                	pop    %r12
+  801fde:	5d                   	pop    %rbp
+  801fdf:	c3                   	ret
+
+0000000000801fe0 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  801fe0:	55                   	push   %rbp
+  801fe1:	48 89 e5             	mov    %rsp,%rbp
+  801fe4:	41 57                	push   %r15
+  801fe6:	41 56                	push   %r14
+  801fe8:	41 55                	push   %r13
+  801fea:	41 54                	push   %r12
+  801fec:	53                   	push   %rbx
+  801fed:	48 83 ec 18          	sub    $0x18,%rsp
+  801ff1:	49 89 fe             	mov    %rdi,%r14
+  801ff4:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+  801ff8:	48 89 d3             	mov    %rdx,%rbx
+    while (n > sizeof(fsipcbuf.write.req_buf))
+  801ffb:	48 81 fa f0 0f 00 00 	cmp    $0xff0,%rdx
+  802002:	0f 86 e4 00 00 00    	jbe    8020ec <devfile_write+0x10c>
+  802008:	49 89 f4             	mov    %rsi,%r12
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  80200b:	49 bd 00 60 80 00 00 	movabs $0x806000,%r13
+  802012:	00 00 00 
+        memcpy(fsipcbuf.write.req_buf, buf, sizeof(fsipcbuf.write.req_buf));
+  802015:	49 bf fe 0d 80 00 00 	movabs $0x800dfe,%r15
+  80201c:	00 00 00 
+  80201f:	eb 03                	jmp    802024 <devfile_write+0x44>
+        buf += sizeof(fsipcbuf.write.req_buf);
+  802021:	49 89 f4             	mov    %rsi,%r12
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802024:	41 8b 46 0c          	mov    0xc(%r14),%eax
+  802028:	41 89 45 00          	mov    %eax,0x0(%r13)
+        fsipcbuf.write.req_n      = sizeof(fsipcbuf.write.req_buf);
+  80202c:	49 c7 45 08 f0 0f 00 	movq   $0xff0,0x8(%r13)
+  802033:	00 
+        memcpy(fsipcbuf.write.req_buf, buf, sizeof(fsipcbuf.write.req_buf));
+  802034:	ba f0 0f 00 00       	mov    $0xff0,%edx
+  802039:	4c 89 e6             	mov    %r12,%rsi
+  80203c:	48 bf 10 60 80 00 00 	movabs $0x806010,%rdi
+  802043:	00 00 00 
+  802046:	41 ff d7             	call   *%r15
+        ssize_t res = fsipc(FSREQ_WRITE, NULL);
+  802049:	be 00 00 00 00       	mov    $0x0,%esi
+  80204e:	bf 04 00 00 00       	mov    $0x4,%edi
+  802053:	48 b8 7e 1e 80 00 00 	movabs $0x801e7e,%rax
+  80205a:	00 00 00 
+  80205d:	ff d0                	call   *%rax
+  80205f:	48 63 d0             	movslq %eax,%rdx
+        if (res < 0 || res < sizeof(fsipcbuf.write.req_buf))
+  802062:	3d ef 0f 00 00       	cmp    $0xfef,%eax
+  802067:	7e 71                	jle    8020da <devfile_write+0xfa>
+        buf += sizeof(fsipcbuf.write.req_buf);
+  802069:	49 8d b4 24 f0 0f 00 	lea    0xff0(%r12),%rsi
+  802070:	00 
+        n -= sizeof(fsipcbuf.write.req_buf);
+  802071:	48 81 eb f0 0f 00 00 	sub    $0xff0,%rbx
+    while (n > sizeof(fsipcbuf.write.req_buf))
+  802078:	48 81 fb f0 0f 00 00 	cmp    $0xff0,%rbx
+  80207f:	77 a0                	ja     802021 <devfile_write+0x41>
+        written += sizeof(fsipcbuf.write.req_buf);
+  802081:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802085:	49 29 c4             	sub    %rax,%r12
+  802088:	4d 8d a4 24 f0 0f 00 	lea    0xff0(%r12),%r12
+  80208f:	00 
+    fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802090:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  802097:	00 00 00 
+  80209a:	41 8b 56 0c          	mov    0xc(%r14),%edx
+  80209e:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.write.req_n      = n;
+  8020a0:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    memcpy(fsipcbuf.write.req_buf, buf, n);
+  8020a4:	48 89 da             	mov    %rbx,%rdx
+  8020a7:	48 8d 78 10          	lea    0x10(%rax),%rdi
+  8020ab:	48 b8 fe 0d 80 00 00 	movabs $0x800dfe,%rax
+  8020b2:	00 00 00 
+  8020b5:	ff d0                	call   *%rax
+    ssize_t res = fsipc(FSREQ_WRITE, NULL);
+  8020b7:	be 00 00 00 00       	mov    $0x0,%esi
+  8020bc:	bf 04 00 00 00       	mov    $0x4,%edi
+  8020c1:	48 b8 7e 1e 80 00 00 	movabs $0x801e7e,%rax
+  8020c8:	00 00 00 
+  8020cb:	ff d0                	call   *%rax
+  8020cd:	48 63 d0             	movslq %eax,%rdx
+    written += res;
+  8020d0:	49 01 d4             	add    %rdx,%r12
+  8020d3:	48 85 d2             	test   %rdx,%rdx
+  8020d6:	49 0f 49 d4          	cmovns %r12,%rdx
+}
+  8020da:	48 89 d0             	mov    %rdx,%rax
+  8020dd:	48 83 c4 18          	add    $0x18,%rsp
+  8020e1:	5b                   	pop    %rbx
+  8020e2:	41 5c                	pop    %r12
+  8020e4:	41 5d                	pop    %r13
+  8020e6:	41 5e                	pop    %r14
+  8020e8:	41 5f                	pop    %r15
+  8020ea:	5d                   	pop    %rbp
+  8020eb:	c3                   	ret
+    while (n > sizeof(fsipcbuf.write.req_buf))
+  8020ec:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+    ssize_t written = 0;
+  8020f0:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8020f6:	eb 98                	jmp    802090 <devfile_write+0xb0>
+
+00000000008020f8 <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  8020f8:	55                   	push   %rbp
+  8020f9:	48 89 e5             	mov    %rsp,%rbp
+  8020fc:	41 57                	push   %r15
+  8020fe:	41 56                	push   %r14
+  802100:	41 55                	push   %r13
+  802102:	41 54                	push   %r12
+  802104:	53                   	push   %rbx
+  802105:	48 83 ec 18          	sub    $0x18,%rsp
+  802109:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  80210d:	49 89 f6             	mov    %rsi,%r14
+  802110:	49 89 d4             	mov    %rdx,%r12
+    while (n > sizeof(fsipcbuf.readRet.ret_buf))
+  802113:	48 81 fa 00 10 00 00 	cmp    $0x1000,%rdx
+  80211a:	0f 86 ea 00 00 00    	jbe    80220a <devfile_read+0x112>
+    ssize_t readsz = 0;
+  802120:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  802127:	00 
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802128:	49 bf 00 60 80 00 00 	movabs $0x806000,%r15
+  80212f:	00 00 00 
+  802132:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802136:	8b 40 0c             	mov    0xc(%rax),%eax
+  802139:	41 89 07             	mov    %eax,(%r15)
+        fsipcbuf.read.req_n = sizeof(fsipcbuf.readRet.ret_buf);
+  80213c:	49 c7 47 08 00 10 00 	movq   $0x1000,0x8(%r15)
+  802143:	00 
+        ssize_t res = fsipc(FSREQ_READ, NULL);
+  802144:	be 00 00 00 00       	mov    $0x0,%esi
+  802149:	bf 03 00 00 00       	mov    $0x3,%edi
+  80214e:	48 b8 7e 1e 80 00 00 	movabs $0x801e7e,%rax
+  802155:	00 00 00 
+  802158:	ff d0                	call   *%rax
+  80215a:	4c 63 e8             	movslq %eax,%r13
+        if (res < 0)
+  80215d:	4d 85 ed             	test   %r13,%r13
+  802160:	0f 88 92 00 00 00    	js     8021f8 <devfile_read+0x100>
+        memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  802166:	4c 89 ea             	mov    %r13,%rdx
+  802169:	4c 89 fe             	mov    %r15,%rsi
+  80216c:	4c 89 f7             	mov    %r14,%rdi
+  80216f:	48 b8 fe 0d 80 00 00 	movabs $0x800dfe,%rax
+  802176:	00 00 00 
+  802179:	ff d0                	call   *%rax
+        if (res < sizeof(fsipcbuf.readRet.ret_buf))
+  80217b:	49 81 fd ff 0f 00 00 	cmp    $0xfff,%r13
+  802182:	76 6d                	jbe    8021f1 <devfile_read+0xf9>
+        readsz += res;
+  802184:	4c 01 6d c0          	add    %r13,-0x40(%rbp)
+        buf += res;
+  802188:	4d 01 ee             	add    %r13,%r14
+        n -= res;
+  80218b:	4d 29 ec             	sub    %r13,%r12
+    while (n > sizeof(fsipcbuf.readRet.ret_buf))
+  80218e:	49 81 fc 00 10 00 00 	cmp    $0x1000,%r12
+  802195:	77 9b                	ja     802132 <devfile_read+0x3a>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802197:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  80219e:	00 00 00 
+  8021a1:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  8021a5:	8b 51 0c             	mov    0xc(%rcx),%edx
+  8021a8:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.read.req_n = n;
+  8021aa:	4c 89 60 08          	mov    %r12,0x8(%rax)
+    ssize_t res = fsipc(FSREQ_READ, NULL);
+  8021ae:	be 00 00 00 00       	mov    $0x0,%esi
+  8021b3:	bf 03 00 00 00       	mov    $0x3,%edi
+  8021b8:	48 b8 7e 1e 80 00 00 	movabs $0x801e7e,%rax
+  8021bf:	00 00 00 
+  8021c2:	ff d0                	call   *%rax
+  8021c4:	4c 63 e8             	movslq %eax,%r13
+    if (res < 0)
+  8021c7:	4d 85 ed             	test   %r13,%r13
+  8021ca:	78 2c                	js     8021f8 <devfile_read+0x100>
+    memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  8021cc:	4c 89 ea             	mov    %r13,%rdx
+  8021cf:	48 be 00 60 80 00 00 	movabs $0x806000,%rsi
+  8021d6:	00 00 00 
+  8021d9:	4c 89 f7             	mov    %r14,%rdi
+  8021dc:	48 b8 fe 0d 80 00 00 	movabs $0x800dfe,%rax
+  8021e3:	00 00 00 
+  8021e6:	ff d0                	call   *%rax
+    readsz += res;
+  8021e8:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8021ec:	49 01 c5             	add    %rax,%r13
+    return readsz;
+  8021ef:	eb 07                	jmp    8021f8 <devfile_read+0x100>
+            return readsz + res;
+  8021f1:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8021f5:	49 01 c5             	add    %rax,%r13
+}
+  8021f8:	4c 89 e8             	mov    %r13,%rax
+  8021fb:	48 83 c4 18          	add    $0x18,%rsp
+  8021ff:	5b                   	pop    %rbx
+  802200:	41 5c                	pop    %r12
+  802202:	41 5d                	pop    %r13
+  802204:	41 5e                	pop    %r14
+  802206:	41 5f                	pop    %r15
+  802208:	5d                   	pop    %rbp
+  802209:	c3                   	ret
+    ssize_t readsz = 0;
+  80220a:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  802211:	00 
+  802212:	eb 83                	jmp    802197 <devfile_read+0x9f>
+
+0000000000802214 <open>:
+open(const char *path, int mode) {
+  802214:	55                   	push   %rbp
+  802215:	48 89 e5             	mov    %rsp,%rbp
+  802218:	41 55                	push   %r13
+  80221a:	41 54                	push   %r12
+  80221c:	53                   	push   %rbx
+  80221d:	48 83 ec 18          	sub    $0x18,%rsp
+  802221:	49 89 fc             	mov    %rdi,%r12
+  802224:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  802227:	48 b8 5f 0b 80 00 00 	movabs $0x800b5f,%rax
+  80222e:	00 00 00 
+  802231:	ff d0                	call   *%rax
+  802233:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802239:	0f 87 8a 00 00 00    	ja     8022c9 <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  80223f:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802243:	48 b8 f7 17 80 00 00 	movabs $0x8017f7,%rax
+  80224a:	00 00 00 
+  80224d:	ff d0                	call   *%rax
+  80224f:	89 c3                	mov    %eax,%ebx
+  802251:	85 c0                	test   %eax,%eax
+  802253:	78 50                	js     8022a5 <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  802255:	4c 89 e6             	mov    %r12,%rsi
+  802258:	48 bb 00 60 80 00 00 	movabs $0x806000,%rbx
+  80225f:	00 00 00 
+  802262:	48 89 df             	mov    %rbx,%rdi
+  802265:	48 b8 9d 0b 80 00 00 	movabs $0x800b9d,%rax
+  80226c:	00 00 00 
+  80226f:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  802271:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  802278:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  80227c:	bf 01 00 00 00       	mov    $0x1,%edi
+  802281:	48 b8 7e 1e 80 00 00 	movabs $0x801e7e,%rax
+  802288:	00 00 00 
+  80228b:	ff d0                	call   *%rax
+  80228d:	89 c3                	mov    %eax,%ebx
+  80228f:	85 c0                	test   %eax,%eax
+  802291:	78 1f                	js     8022b2 <open+0x9e>
+    return fd2num(fd);
+  802293:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802297:	48 b8 50 17 80 00 00 	movabs $0x801750,%rax
+  80229e:	00 00 00 
+  8022a1:	ff d0                	call   *%rax
+  8022a3:	89 c3                	mov    %eax,%ebx
+}
+  8022a5:	89 d8                	mov    %ebx,%eax
+  8022a7:	48 83 c4 18          	add    $0x18,%rsp
+  8022ab:	5b                   	pop    %rbx
+  8022ac:	41 5c                	pop    %r12
+  8022ae:	41 5d                	pop    %r13
+  8022b0:	5d                   	pop    %rbp
+  8022b1:	c3                   	ret
+        fd_close(fd, 0);
+  8022b2:	be 00 00 00 00       	mov    $0x0,%esi
+  8022b7:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8022bb:	48 b8 cc 18 80 00 00 	movabs $0x8018cc,%rax
+  8022c2:	00 00 00 
+  8022c5:	ff d0                	call   *%rax
+        return res;
+  8022c7:	eb dc                	jmp    8022a5 <open+0x91>
+        return -E_BAD_PATH;
+  8022c9:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  8022ce:	eb d5                	jmp    8022a5 <open+0x91>
+
+00000000008022d0 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  8022d0:	55                   	push   %rbp
+  8022d1:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc(FSREQ_SYNC, NULL);
+  8022d4:	be 00 00 00 00       	mov    $0x0,%esi
+  8022d9:	bf 08 00 00 00       	mov    $0x8,%edi
+  8022de:	48 b8 7e 1e 80 00 00 	movabs $0x801e7e,%rax
+  8022e5:	00 00 00 
+  8022e8:	ff d0                	call   *%rax
+}
+  8022ea:	5d                   	pop    %rbp
+  8022eb:	c3                   	ret
+
+00000000008022ec <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  8022ec:	55                   	push   %rbp
+  8022ed:	48 89 e5             	mov    %rsp,%rbp
+  8022f0:	41 54                	push   %r12
+  8022f2:	53                   	push   %rbx
+  8022f3:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8022f6:	48 b8 62 17 80 00 00 	movabs $0x801762,%rax
+  8022fd:	00 00 00 
+  802300:	ff d0                	call   *%rax
+  802302:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  802305:	48 be e0 33 80 00 00 	movabs $0x8033e0,%rsi
+  80230c:	00 00 00 
+  80230f:	48 89 df             	mov    %rbx,%rdi
+  802312:	48 b8 9d 0b 80 00 00 	movabs $0x800b9d,%rax
+  802319:	00 00 00 
+  80231c:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  80231e:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  802323:	41 2b 04 24          	sub    (%r12),%eax
+  802327:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  80232d:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  802334:	00 00 00 
+    stat->st_dev = &devpipe;
+  802337:	48 b8 60 40 80 00 00 	movabs $0x804060,%rax
+  80233e:	00 00 00 
+  802341:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  802348:	b8 00 00 00 00       	mov    $0x0,%eax
+  80234d:	5b                   	pop    %rbx
+  80234e:	41 5c                	pop    %r12
+  802350:	5d                   	pop    %rbp
+  802351:	c3                   	ret
+
+0000000000802352 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  802352:	55                   	push   %rbp
+  802353:	48 89 e5             	mov    %rsp,%rbp
+  802356:	41 54                	push   %r12
+  802358:	53                   	push   %rbx
+  802359:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  80235c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802361:	48 89 fe             	mov    %rdi,%rsi
+  802364:	bf 00 00 00 00       	mov    $0x0,%edi
+  802369:	49 bc 19 12 80 00 00 	movabs $0x801219,%r12
+  802370:	00 00 00 
+  802373:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  802376:	48 89 df             	mov    %rbx,%rdi
+  802379:	48 b8 62 17 80 00 00 	movabs $0x801762,%rax
+  802380:	00 00 00 
+  802383:	ff d0                	call   *%rax
+  802385:	48 89 c6             	mov    %rax,%rsi
+  802388:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80238d:	bf 00 00 00 00       	mov    $0x0,%edi
+  802392:	41 ff d4             	call   *%r12
+}
+  802395:	5b                   	pop    %rbx
+  802396:	41 5c                	pop    %r12
+  802398:	5d                   	pop    %rbp
+  802399:	c3                   	ret
+
+000000000080239a <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  80239a:	55                   	push   %rbp
+  80239b:	48 89 e5             	mov    %rsp,%rbp
+  80239e:	41 57                	push   %r15
+  8023a0:	41 56                	push   %r14
+  8023a2:	41 55                	push   %r13
+  8023a4:	41 54                	push   %r12
+  8023a6:	53                   	push   %rbx
+  8023a7:	48 83 ec 18          	sub    $0x18,%rsp
+  8023ab:	49 89 fc             	mov    %rdi,%r12
+  8023ae:	49 89 f5             	mov    %rsi,%r13
+  8023b1:	49 89 d7             	mov    %rdx,%r15
+  8023b4:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8023b8:	48 b8 62 17 80 00 00 	movabs $0x801762,%rax
+  8023bf:	00 00 00 
+  8023c2:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  8023c4:	4d 85 ff             	test   %r15,%r15
+  8023c7:	0f 84 af 00 00 00    	je     80247c <devpipe_write+0xe2>
+  8023cd:	48 89 c3             	mov    %rax,%rbx
+  8023d0:	4c 89 f8             	mov    %r15,%rax
+  8023d3:	4d 89 ef             	mov    %r13,%r15
+  8023d6:	4c 01 e8             	add    %r13,%rax
+  8023d9:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8023dd:	49 bd 21 11 80 00 00 	movabs $0x801121,%r13
+  8023e4:	00 00 00 
+            sys_yield();
+  8023e7:	49 be be 10 80 00 00 	movabs $0x8010be,%r14
+  8023ee:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  8023f1:	8b 73 04             	mov    0x4(%rbx),%esi
+  8023f4:	48 63 ce             	movslq %esi,%rcx
+  8023f7:	48 63 03             	movslq (%rbx),%rax
+  8023fa:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  802400:	48 39 c1             	cmp    %rax,%rcx
+  802403:	72 2e                	jb     802433 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802405:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80240a:	48 89 da             	mov    %rbx,%rdx
+  80240d:	be 00 10 00 00       	mov    $0x1000,%esi
+  802412:	4c 89 e7             	mov    %r12,%rdi
+  802415:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  802418:	85 c0                	test   %eax,%eax
+  80241a:	74 66                	je     802482 <devpipe_write+0xe8>
+            sys_yield();
+  80241c:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  80241f:	8b 73 04             	mov    0x4(%rbx),%esi
+  802422:	48 63 ce             	movslq %esi,%rcx
+  802425:	48 63 03             	movslq (%rbx),%rax
+  802428:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  80242e:	48 39 c1             	cmp    %rax,%rcx
+  802431:	73 d2                	jae    802405 <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  802433:	41 0f b6 3f          	movzbl (%r15),%edi
+  802437:	48 89 ca             	mov    %rcx,%rdx
+  80243a:	48 c1 ea 03          	shr    $0x3,%rdx
+  80243e:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  802445:	08 10 20 
+  802448:	48 f7 e2             	mul    %rdx
+  80244b:	48 c1 ea 06          	shr    $0x6,%rdx
+  80244f:	48 89 d0             	mov    %rdx,%rax
+  802452:	48 c1 e0 09          	shl    $0x9,%rax
+  802456:	48 29 d0             	sub    %rdx,%rax
+  802459:	48 c1 e0 03          	shl    $0x3,%rax
+  80245d:	48 29 c1             	sub    %rax,%rcx
+  802460:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  802465:	83 c6 01             	add    $0x1,%esi
+  802468:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  80246b:	49 83 c7 01          	add    $0x1,%r15
+  80246f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802473:	49 39 c7             	cmp    %rax,%r15
+  802476:	0f 85 75 ff ff ff    	jne    8023f1 <devpipe_write+0x57>
+    return n;
+  80247c:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802480:	eb 05                	jmp    802487 <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  802482:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802487:	48 83 c4 18          	add    $0x18,%rsp
+  80248b:	5b                   	pop    %rbx
+  80248c:	41 5c                	pop    %r12
+  80248e:	41 5d                	pop    %r13
+  802490:	41 5e                	pop    %r14
+  802492:	41 5f                	pop    %r15
+  802494:	5d                   	pop    %rbp
+  802495:	c3                   	ret
+
+0000000000802496 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  802496:	55                   	push   %rbp
+  802497:	48 89 e5             	mov    %rsp,%rbp
+  80249a:	41 57                	push   %r15
+  80249c:	41 56                	push   %r14
+  80249e:	41 55                	push   %r13
+  8024a0:	41 54                	push   %r12
+  8024a2:	53                   	push   %rbx
+  8024a3:	48 83 ec 18          	sub    $0x18,%rsp
+  8024a7:	49 89 fc             	mov    %rdi,%r12
+  8024aa:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  8024ae:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8024b2:	48 b8 62 17 80 00 00 	movabs $0x801762,%rax
+  8024b9:	00 00 00 
+  8024bc:	ff d0                	call   *%rax
+  8024be:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  8024c1:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8024c7:	49 bd 21 11 80 00 00 	movabs $0x801121,%r13
+  8024ce:	00 00 00 
+            sys_yield();
+  8024d1:	49 be be 10 80 00 00 	movabs $0x8010be,%r14
+  8024d8:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  8024db:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  8024e0:	74 7d                	je     80255f <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  8024e2:	8b 03                	mov    (%rbx),%eax
+  8024e4:	3b 43 04             	cmp    0x4(%rbx),%eax
+  8024e7:	75 26                	jne    80250f <devpipe_read+0x79>
+            if (i > 0) return i;
+  8024e9:	4d 85 ff             	test   %r15,%r15
+  8024ec:	75 77                	jne    802565 <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8024ee:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8024f3:	48 89 da             	mov    %rbx,%rdx
+  8024f6:	be 00 10 00 00       	mov    $0x1000,%esi
+  8024fb:	4c 89 e7             	mov    %r12,%rdi
+  8024fe:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  802501:	85 c0                	test   %eax,%eax
+  802503:	74 72                	je     802577 <devpipe_read+0xe1>
+            sys_yield();
+  802505:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  802508:	8b 03                	mov    (%rbx),%eax
+  80250a:	3b 43 04             	cmp    0x4(%rbx),%eax
+  80250d:	74 df                	je     8024ee <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  80250f:	48 63 c8             	movslq %eax,%rcx
+  802512:	48 89 ca             	mov    %rcx,%rdx
+  802515:	48 c1 ea 03          	shr    $0x3,%rdx
+  802519:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  802520:	08 10 20 
+  802523:	48 89 d0             	mov    %rdx,%rax
+  802526:	48 f7 e6             	mul    %rsi
+  802529:	48 c1 ea 06          	shr    $0x6,%rdx
+  80252d:	48 89 d0             	mov    %rdx,%rax
+  802530:	48 c1 e0 09          	shl    $0x9,%rax
+  802534:	48 29 d0             	sub    %rdx,%rax
+  802537:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  80253e:	00 
+  80253f:	48 89 c8             	mov    %rcx,%rax
+  802542:	48 29 d0             	sub    %rdx,%rax
+  802545:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  80254a:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80254e:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  802552:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  802555:	49 83 c7 01          	add    $0x1,%r15
+  802559:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  80255d:	75 83                	jne    8024e2 <devpipe_read+0x4c>
+    return n;
+  80255f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802563:	eb 03                	jmp    802568 <devpipe_read+0xd2>
+            if (i > 0) return i;
+  802565:	4c 89 f8             	mov    %r15,%rax
+}
+  802568:	48 83 c4 18          	add    $0x18,%rsp
+  80256c:	5b                   	pop    %rbx
+  80256d:	41 5c                	pop    %r12
+  80256f:	41 5d                	pop    %r13
+  802571:	41 5e                	pop    %r14
+  802573:	41 5f                	pop    %r15
+  802575:	5d                   	pop    %rbp
+  802576:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  802577:	b8 00 00 00 00       	mov    $0x0,%eax
+  80257c:	eb ea                	jmp    802568 <devpipe_read+0xd2>
+
+000000000080257e <pipe>:
+pipe(int pfd[2]) {
+  80257e:	55                   	push   %rbp
+  80257f:	48 89 e5             	mov    %rsp,%rbp
+  802582:	41 55                	push   %r13
+  802584:	41 54                	push   %r12
+  802586:	53                   	push   %rbx
+  802587:	48 81 ec b8 00 00 00 	sub    $0xb8,%rsp
+  80258e:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  802591:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802595:	48 b8 f7 17 80 00 00 	movabs $0x8017f7,%rax
+  80259c:	00 00 00 
+  80259f:	ff d0                	call   *%rax
+  8025a1:	89 c3                	mov    %eax,%ebx
+  8025a3:	85 c0                	test   %eax,%eax
+  8025a5:	0f 88 51 01 00 00    	js     8026fc <pipe+0x17e>
+        (res = fd_alloc_from(fd2num(fd0) + 1, &fd1)) < 0) goto err;
+  8025ab:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8025af:	48 b8 50 17 80 00 00 	movabs $0x801750,%rax
+  8025b6:	00 00 00 
+  8025b9:	ff d0                	call   *%rax
+  8025bb:	8d 78 01             	lea    0x1(%rax),%edi
+  8025be:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8025c2:	48 b8 7e 17 80 00 00 	movabs $0x80177e,%rax
+  8025c9:	00 00 00 
+  8025cc:	ff d0                	call   *%rax
+  8025ce:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8025d0:	85 c0                	test   %eax,%eax
+  8025d2:	0f 88 24 01 00 00    	js     8026fc <pipe+0x17e>
+    va = fd2data(fd0);
+  8025d8:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8025dc:	48 bb 62 17 80 00 00 	movabs $0x801762,%rbx
+  8025e3:	00 00 00 
+  8025e6:	ff d3                	call   *%rbx
+  8025e8:	49 89 c5             	mov    %rax,%r13
+    struct RegionOp ops[] = {
+  8025eb:	48 8d bd 30 ff ff ff 	lea    -0xd0(%rbp),%rdi
+  8025f2:	b9 14 00 00 00       	mov    $0x14,%ecx
+  8025f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025fc:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+  8025ff:	c7 85 34 ff ff ff 46 	movl   $0x46,-0xcc(%rbp)
+  802606:	00 00 00 
+  802609:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80260d:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+  802614:	48 c7 85 50 ff ff ff 	movq   $0x1000,-0xb0(%rbp)
+  80261b:	00 10 00 00 
+  80261f:	c7 85 5c ff ff ff 46 	movl   $0x46,-0xa4(%rbp)
+  802626:	00 00 00 
+            {.type = REGION_ALLOC, .dstva = (uintptr_t)fd1, .size = PAGE_SIZE, .perm = PROT_RW | PROT_SHARE},
+  802629:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+    struct RegionOp ops[] = {
+  80262d:	48 89 bd 70 ff ff ff 	mov    %rdi,-0x90(%rbp)
+  802634:	48 c7 85 78 ff ff ff 	movq   $0x1000,-0x88(%rbp)
+  80263b:	00 10 00 00 
+  80263f:	c7 45 84 46 00 00 00 	movl   $0x46,-0x7c(%rbp)
+  802646:	4c 89 6d 98          	mov    %r13,-0x68(%rbp)
+  80264a:	48 c7 45 a0 00 10 00 	movq   $0x1000,-0x60(%rbp)
+  802651:	00 
+  802652:	c7 45 a8 01 00 00 00 	movl   $0x1,-0x58(%rbp)
+  802659:	c7 45 ac 46 00 00 00 	movl   $0x46,-0x54(%rbp)
+  802660:	4c 89 6d b8          	mov    %r13,-0x48(%rbp)
+            {.type = REGION_MAP, .srcva = (uintptr_t)va, .dstva = (uintptr_t)fd2data(fd1), .size = PAGE_SIZE, .perm = PROT_RW | PROT_SHARE},
+  802664:	ff d3                	call   *%rbx
+    struct RegionOp ops[] = {
+  802666:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80266a:	48 c7 45 c8 00 10 00 	movq   $0x1000,-0x38(%rbp)
+  802671:	00 
+    if ((res = sys_region_batch(ops, sizeof ops / sizeof *ops)) < 0) goto err1;
+  802672:	be 04 00 00 00       	mov    $0x4,%esi
+  802677:	48 8d bd 30 ff ff ff 	lea    -0xd0(%rbp),%rdi
+  80267e:	48 b8 80 12 80 00 00 	movabs $0x801280,%rax
+  802685:	00 00 00 
+  802688:	ff d0                	call   *%rax
+  80268a:	89 c3                	mov    %eax,%ebx
+  80268c:	85 c0                	test   %eax,%eax
+  80268e:	0f 88 ad 00 00 00    	js     802741 <pipe+0x1c3>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  802694:	be 00 10 00 00       	mov    $0x1000,%esi
+  802699:	4c 89 ef             	mov    %r13,%rdi
+  80269c:	48 b8 ef 10 80 00 00 	movabs $0x8010ef,%rax
+  8026a3:	00 00 00 
+  8026a6:	ff d0                	call   *%rax
+  8026a8:	83 f8 02             	cmp    $0x2,%eax
+  8026ab:	75 5f                	jne    80270c <pipe+0x18e>
+    fd0->fd_dev_id = devpipe.dev_id;
+  8026ad:	a1 60 40 80 00 00 00 	movabs 0x804060,%eax
+  8026b4:	00 00 
+  8026b6:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8026ba:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  8026bc:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8026c0:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  8026c7:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8026cb:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  8026cd:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8026d1:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  8026d8:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8026dc:	48 bb 50 17 80 00 00 	movabs $0x801750,%rbx
+  8026e3:	00 00 00 
+  8026e6:	ff d3                	call   *%rbx
+  8026e8:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  8026ec:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  8026f0:	ff d3                	call   *%rbx
+  8026f2:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  8026f7:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  8026fc:	89 d8                	mov    %ebx,%eax
+  8026fe:	48 81 c4 b8 00 00 00 	add    $0xb8,%rsp
+  802705:	5b                   	pop    %rbx
+  802706:	41 5c                	pop    %r12
+  802708:	41 5d                	pop    %r13
+  80270a:	5d                   	pop    %rbp
+  80270b:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  80270c:	48 b9 10 34 80 00 00 	movabs $0x803410,%rcx
+  802713:	00 00 00 
+  802716:	48 ba e7 33 80 00 00 	movabs $0x8033e7,%rdx
+  80271d:	00 00 00 
+  802720:	be 33 00 00 00       	mov    $0x33,%esi
+  802725:	48 bf fc 33 80 00 00 	movabs $0x8033fc,%rdi
+  80272c:	00 00 00 
+  80272f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802734:	49 b8 a6 2c 80 00 00 	movabs $0x802ca6,%r8
+  80273b:	00 00 00 
+  80273e:	41 ff d0             	call   *%r8
+        ops[i].type = REGION_UNMAP;
+  802741:	c7 85 30 ff ff ff 02 	movl   $0x2,-0xd0(%rbp)
+  802748:	00 00 00 
+  80274b:	c7 85 58 ff ff ff 02 	movl   $0x2,-0xa8(%rbp)
+  802752:	00 00 00 
+  802755:	c7 45 80 02 00 00 00 	movl   $0x2,-0x80(%rbp)
+  80275c:	c7 45 a8 02 00 00 00 	movl   $0x2,-0x58(%rbp)
+    sys_region_batch(ops, sizeof ops / sizeof *ops);
+  802763:	be 04 00 00 00       	mov    $0x4,%esi
+  802768:	48 8d bd 30 ff ff ff 	lea    -0xd0(%rbp),%rdi
+  80276f:	48 b8 80 12 80 00 00 	movabs $0x801280,%rax
+  802776:	00 00 00 
+  802779:	ff d0                	call   *%rax
+  80277b:	e9 7c ff ff ff       	jmp    8026fc <pipe+0x17e>
+
+0000000000802780 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  802780:	55                   	push   %rbp
+  802781:	48 89 e5             	mov    %rsp,%rbp
+  802784:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  802788:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80278c:	48 b8 11 18 80 00 00 	movabs $0x801811,%rax
+  802793:	00 00 00 
+  802796:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802798:	85 c0                	test   %eax,%eax
+  80279a:	78 35                	js     8027d1 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  80279c:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8027a0:	48 b8 62 17 80 00 00 	movabs $0x801762,%rax
+  8027a7:	00 00 00 
+  8027aa:	ff d0                	call   *%rax
+  8027ac:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8027af:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8027b4:	be 00 10 00 00       	mov    $0x1000,%esi
+  8027b9:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8027bd:	48 b8 21 11 80 00 00 	movabs $0x801121,%rax
+  8027c4:	00 00 00 
+  8027c7:	ff d0                	call   *%rax
+  8027c9:	85 c0                	test   %eax,%eax
+  8027cb:	0f 94 c0             	sete   %al
+  8027ce:	0f b6 c0             	movzbl %al,%eax
+}
+  8027d1:	c9                   	leave
+  8027d2:	c3                   	ret
+
+00000000008027d3 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8027d3:	48 89 f8             	mov    %rdi,%rax
+  8027d6:	48 c1 e8 27          	shr    $0x27,%rax
+  8027da:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  8027e1:	01 00 00 
+  8027e4:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8027e8:	f6 c2 01             	test   $0x1,%dl
+  8027eb:	74 6d                	je     80285a <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8027ed:	48 89 f8             	mov    %rdi,%rax
+  8027f0:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8027f4:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8027fb:	01 00 00 
+  8027fe:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802802:	f6 c2 01             	test   $0x1,%dl
+  802805:	74 62                	je     802869 <get_uvpt_entry+0x96>
+  802807:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  80280e:	01 00 00 
+  802811:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802815:	f6 c2 80             	test   $0x80,%dl
+  802818:	75 4f                	jne    802869 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  80281a:	48 89 f8             	mov    %rdi,%rax
+  80281d:	48 c1 e8 15          	shr    $0x15,%rax
+  802821:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802828:	01 00 00 
+  80282b:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80282f:	f6 c2 01             	test   $0x1,%dl
+  802832:	74 44                	je     802878 <get_uvpt_entry+0xa5>
+  802834:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  80283b:	01 00 00 
+  80283e:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802842:	f6 c2 80             	test   $0x80,%dl
+  802845:	75 31                	jne    802878 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  802847:	48 c1 ef 0c          	shr    $0xc,%rdi
+  80284b:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802852:	01 00 00 
+  802855:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  802859:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  80285a:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  802861:	01 00 00 
+  802864:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802868:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  802869:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802870:	01 00 00 
+  802873:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802877:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  802878:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  80287f:	01 00 00 
+  802882:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802886:	c3                   	ret
+
+0000000000802887 <get_prot>:
+
+int
+get_prot(void *va) {
+  802887:	55                   	push   %rbp
+  802888:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  80288b:	48 b8 d3 27 80 00 00 	movabs $0x8027d3,%rax
+  802892:	00 00 00 
+  802895:	ff d0                	call   *%rax
+  802897:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  80289a:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  80289f:	89 c1                	mov    %eax,%ecx
+  8028a1:	83 c9 04             	or     $0x4,%ecx
+  8028a4:	f6 c2 01             	test   $0x1,%dl
+  8028a7:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  8028aa:	89 c1                	mov    %eax,%ecx
+  8028ac:	83 c9 02             	or     $0x2,%ecx
+  8028af:	f6 c2 02             	test   $0x2,%dl
+  8028b2:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  8028b5:	89 c1                	mov    %eax,%ecx
+  8028b7:	83 c9 01             	or     $0x1,%ecx
+  8028ba:	48 85 d2             	test   %rdx,%rdx
+  8028bd:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  8028c0:	89 c1                	mov    %eax,%ecx
+  8028c2:	83 c9 40             	or     $0x40,%ecx
+  8028c5:	f6 c6 04             	test   $0x4,%dh
+  8028c8:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  8028cb:	5d                   	pop    %rbp
+  8028cc:	c3                   	ret
+
+00000000008028cd <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  8028cd:	55                   	push   %rbp
+  8028ce:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8028d1:	48 b8 d3 27 80 00 00 	movabs $0x8027d3,%rax
+  8028d8:	00 00 00 
+  8028db:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  8028dd:	48 c1 e8 06          	shr    $0x6,%rax
+  8028e1:	83 e0 01             	and    $0x1,%eax
+}
+  8028e4:	5d                   	pop    %rbp
+  8028e5:	c3                   	ret
+
+00000000008028e6 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  8028e6:	55                   	push   %rbp
+  8028e7:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  8028ea:	48 b8 d3 27 80 00 00 	movabs $0x8027d3,%rax
+  8028f1:	00 00 00 
+  8028f4:	ff d0                	call   *%rax
+  8028f6:	83 e0 01             	and    $0x1,%eax
+}
+  8028f9:	5d                   	pop    %rbp
+  8028fa:	c3                   	ret
+
+00000000008028fb <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  8028fb:	55                   	push   %rbp
+  8028fc:	48 89 e5             	mov    %rsp,%rbp
+  8028ff:	41 57                	push   %r15
+  802901:	41 56                	push   %r14
+  802903:	41 55                	push   %r13
+  802905:	41 54                	push   %r12
+  802907:	53                   	push   %rbx
+  802908:	48 83 ec 38          	sub    $0x38,%rsp
+  80290c:	49 89 f7             	mov    %rsi,%r15
+  80290f:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+                    }
+                    continue;
+                }
+                for (int ptei = 0; ptei < PT_ENTRY_COUNT; ptei++) {
+                    uintptr_t pte_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, pdei, ptei, 0);
+                    pte_t pte = uvpt[VPT(pte_addr)];
+  802915:	49 bd 00 00 00 00 00 	movabs $0x10000000000,%r13
+  80291c:	01 00 00 
+  80291f:	4d 89 e6             	mov    %r12,%r14
+  802922:	49 89 fc             	mov    %rdi,%r12
+  802925:	e9 19 01 00 00       	jmp    802a43 <foreach_shared_region+0x148>
+  80292a:	48 89 5d b0          	mov    %rbx,-0x50(%rbp)
+  80292e:	4c 89 75 a8          	mov    %r14,-0x58(%rbp)
+  802932:	eb 52                	jmp    802986 <foreach_shared_region+0x8b>
+                for (int ptei = 0; ptei < PT_ENTRY_COUNT; ptei++) {
+  802934:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  80293b:	48 81 fb 00 00 20 00 	cmp    $0x200000,%rbx
+  802942:	74 2e                	je     802972 <foreach_shared_region+0x77>
+                    uintptr_t pte_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, pdei, ptei, 0);
+  802944:	48 89 df             	mov    %rbx,%rdi
+  802947:	4c 09 f7             	or     %r14,%rdi
+                    pte_t pte = uvpt[VPT(pte_addr)];
+  80294a:	48 89 f8             	mov    %rdi,%rax
+  80294d:	48 c1 e8 0c          	shr    $0xc,%rax
+  802951:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+                    if ((pte & PTE_P) && (pte & PTE_SHARE)) {
+  802956:	25 01 04 00 00       	and    $0x401,%eax
+  80295b:	48 3d 01 04 00 00    	cmp    $0x401,%rax
+  802961:	75 d1                	jne    802934 <foreach_shared_region+0x39>
+                        fun((void*)pte_addr, (void*)(pte_addr + PAGE_SIZE), arg);
+  802963:	48 8d b7 00 10 00 00 	lea    0x1000(%rdi),%rsi
+  80296a:	4c 89 fa             	mov    %r15,%rdx
+  80296d:	41 ff d4             	call   *%r12
+  802970:	eb c2                	jmp    802934 <foreach_shared_region+0x39>
+            for (int pdei = 0; pdei < PD_ENTRY_COUNT; pdei++) {
+  802972:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  802979:	00 
+  80297a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80297e:	48 3d 00 00 00 40    	cmp    $0x40000000,%rax
+  802984:	74 46                	je     8029cc <foreach_shared_region+0xd1>
+                uintptr_t pde_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, pdei, 0, 0);
+  802986:	4c 8b 75 c8          	mov    -0x38(%rbp),%r14
+  80298a:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80298e:	49 09 c6             	or     %rax,%r14
+                pde_t pde = uvpd[VPD(pde_addr)];
+  802991:	4c 89 f0             	mov    %r14,%rax
+  802994:	48 c1 e8 15          	shr    $0x15,%rax
+  802998:	48 b9 00 00 00 80 00 	movabs $0x10080000000,%rcx
+  80299f:	01 00 00 
+  8029a2:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+                if (!(pde & PTE_P)) {
+  8029a6:	a8 01                	test   $0x1,%al
+  8029a8:	74 c8                	je     802972 <foreach_shared_region+0x77>
+                if (pde & PTE_PS) {
+  8029aa:	48 89 c3             	mov    %rax,%rbx
+  8029ad:	81 e3 80 00 00 00    	and    $0x80,%ebx
+  8029b3:	74 8f                	je     802944 <foreach_shared_region+0x49>
+                    if (pde & PTE_SHARE) {
+  8029b5:	f6 c4 04             	test   $0x4,%ah
+  8029b8:	74 b8                	je     802972 <foreach_shared_region+0x77>
+                        fun((void*)pde_addr, (void*)(pde_addr + 1024 * 1024 * 2), arg);
+  8029ba:	49 8d b6 00 00 20 00 	lea    0x200000(%r14),%rsi
+  8029c1:	4c 89 fa             	mov    %r15,%rdx
+  8029c4:	4c 89 f7             	mov    %r14,%rdi
+  8029c7:	41 ff d4             	call   *%r12
+  8029ca:	eb a6                	jmp    802972 <foreach_shared_region+0x77>
+  8029cc:	48 8b 5d b0          	mov    -0x50(%rbp),%rbx
+  8029d0:	4c 8b 75 a8          	mov    -0x58(%rbp),%r14
+        for (int pdpei = 0; pdpei < PDP_ENTRY_COUNT; pdpei++) {
+  8029d4:	48 81 c3 00 00 00 40 	add    $0x40000000,%rbx
+  8029db:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8029e2:	00 00 00 
+  8029e5:	48 39 c3             	cmp    %rax,%rbx
+  8029e8:	74 4c                	je     802a36 <foreach_shared_region+0x13b>
+            uintptr_t pdpe_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, 0, 0, 0);
+  8029ea:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  8029ee:	48 09 d8             	or     %rbx,%rax
+  8029f1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+            pdpe_t pdpe = uvpdp[VPDP(pdpe_addr)];
+  8029f5:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8029f9:	48 b9 00 00 40 80 00 	movabs $0x10080400000,%rcx
+  802a00:	01 00 00 
+  802a03:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+            if (!(pdpe & PTE_P)) {
+  802a07:	a8 01                	test   $0x1,%al
+  802a09:	74 c9                	je     8029d4 <foreach_shared_region+0xd9>
+            if (pdpe & PTE_PS) {
+  802a0b:	48 89 c1             	mov    %rax,%rcx
+  802a0e:	81 e1 80 00 00 00    	and    $0x80,%ecx
+  802a14:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  802a18:	0f 84 0c ff ff ff    	je     80292a <foreach_shared_region+0x2f>
+                if (pdpe & PTE_SHARE) {
+  802a1e:	f6 c4 04             	test   $0x4,%ah
+  802a21:	74 b1                	je     8029d4 <foreach_shared_region+0xd9>
+                    fun((void*)pdpe_addr, (void*)(pdpe_addr + 1024 * 1024 * 1024), arg); 
+  802a23:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  802a27:	48 8d b7 00 00 00 40 	lea    0x40000000(%rdi),%rsi
+  802a2e:	4c 89 fa             	mov    %r15,%rdx
+  802a31:	41 ff d4             	call   *%r12
+  802a34:	eb 9e                	jmp    8029d4 <foreach_shared_region+0xd9>
+    for (int pml4ei = 0; pml4ei < PML4_ENTRY_COUNT; pml4ei++) {
+  802a36:	49 83 c6 01          	add    $0x1,%r14
+  802a3a:	49 81 fe 00 02 00 00 	cmp    $0x200,%r14
+  802a41:	74 24                	je     802a67 <foreach_shared_region+0x16c>
+        pml4e_t pml4e = uvpml4[VPML4(pml4_addr)];
+  802a43:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  802a4a:	01 00 00 
+  802a4d:	4a 8b 04 f0          	mov    (%rax,%r14,8),%rax
+        if (!(pml4e & PTE_P)) {
+  802a51:	a8 01                	test   $0x1,%al
+  802a53:	74 e1                	je     802a36 <foreach_shared_region+0x13b>
+  802a55:	4c 89 f0             	mov    %r14,%rax
+  802a58:	48 c1 e0 27          	shl    $0x27,%rax
+  802a5c:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  802a60:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802a65:	eb 83                	jmp    8029ea <foreach_shared_region+0xef>
+            }
+        }
+    }
+    
+    return 0;
+}
+  802a67:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a6c:	48 83 c4 38          	add    $0x38,%rsp
+  802a70:	5b                   	pop    %rbx
+  802a71:	41 5c                	pop    %r12
+  802a73:	41 5d                	pop    %r13
+  802a75:	41 5e                	pop    %r14
+  802a77:	41 5f                	pop    %r15
+  802a79:	5d                   	pop    %rbp
+  802a7a:	c3                   	ret
+
+0000000000802a7b <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  802a7b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a80:	c3                   	ret
+
+0000000000802a81 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  802a81:	55                   	push   %rbp
+  802a82:	48 89 e5             	mov    %rsp,%rbp
+  802a85:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  802a88:	48 be 34 34 80 00 00 	movabs $0x803434,%rsi
+  802a8f:	00 00 00 
+  802a92:	48 b8 9d 0b 80 00 00 	movabs $0x800b9d,%rax
+  802a99:	00 00 00 
+  802a9c:	ff d0                	call   *%rax
+    return 0;
+}
+  802a9e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802aa3:	5d                   	pop    %rbp
+  802aa4:	c3                   	ret
+
+0000000000802aa5 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  802aa5:	55                   	push   %rbp
+  802aa6:	48 89 e5             	mov    %rsp,%rbp
+  802aa9:	41 57                	push   %r15
+  802aab:	41 56                	push   %r14
+  802aad:	41 55                	push   %r13
+  802aaf:	41 54                	push   %r12
+  802ab1:	53                   	push   %rbx
+  802ab2:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  802ab9:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  802ac0:	48 85 d2             	test   %rdx,%rdx
+  802ac3:	74 7a                	je     802b3f <devcons_write+0x9a>
+  802ac5:	49 89 d6             	mov    %rdx,%r14
+  802ac8:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802ace:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  802ad3:	49 bf 97 0d 80 00 00 	movabs $0x800d97,%r15
+  802ada:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  802add:	4c 89 f3             	mov    %r14,%rbx
+  802ae0:	48 29 f3             	sub    %rsi,%rbx
+  802ae3:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802ae8:	48 39 c3             	cmp    %rax,%rbx
+  802aeb:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  802aef:	4c 63 eb             	movslq %ebx,%r13
+  802af2:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  802af9:	48 01 c6             	add    %rax,%rsi
+  802afc:	4c 89 ea             	mov    %r13,%rdx
+  802aff:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802b06:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  802b09:	4c 89 ee             	mov    %r13,%rsi
+  802b0c:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802b13:	48 b8 c4 0f 80 00 00 	movabs $0x800fc4,%rax
+  802b1a:	00 00 00 
+  802b1d:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  802b1f:	41 01 dc             	add    %ebx,%r12d
+  802b22:	49 63 f4             	movslq %r12d,%rsi
+  802b25:	4c 39 f6             	cmp    %r14,%rsi
+  802b28:	72 b3                	jb     802add <devcons_write+0x38>
+    return res;
+  802b2a:	49 63 c4             	movslq %r12d,%rax
+}
+  802b2d:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  802b34:	5b                   	pop    %rbx
+  802b35:	41 5c                	pop    %r12
+  802b37:	41 5d                	pop    %r13
+  802b39:	41 5e                	pop    %r14
+  802b3b:	41 5f                	pop    %r15
+  802b3d:	5d                   	pop    %rbp
+  802b3e:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  802b3f:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802b45:	eb e3                	jmp    802b2a <devcons_write+0x85>
+
+0000000000802b47 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  802b47:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  802b4a:	ba 00 00 00 00       	mov    $0x0,%edx
+  802b4f:	48 85 c0             	test   %rax,%rax
+  802b52:	74 55                	je     802ba9 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  802b54:	55                   	push   %rbp
+  802b55:	48 89 e5             	mov    %rsp,%rbp
+  802b58:	41 55                	push   %r13
+  802b5a:	41 54                	push   %r12
+  802b5c:	53                   	push   %rbx
+  802b5d:	48 83 ec 08          	sub    $0x8,%rsp
+  802b61:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  802b64:	48 bb f1 0f 80 00 00 	movabs $0x800ff1,%rbx
+  802b6b:	00 00 00 
+  802b6e:	49 bc be 10 80 00 00 	movabs $0x8010be,%r12
+  802b75:	00 00 00 
+  802b78:	eb 03                	jmp    802b7d <devcons_read+0x36>
+  802b7a:	41 ff d4             	call   *%r12
+  802b7d:	ff d3                	call   *%rbx
+  802b7f:	85 c0                	test   %eax,%eax
+  802b81:	74 f7                	je     802b7a <devcons_read+0x33>
+    if (c < 0) return c;
+  802b83:	48 63 d0             	movslq %eax,%rdx
+  802b86:	78 13                	js     802b9b <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  802b88:	ba 00 00 00 00       	mov    $0x0,%edx
+  802b8d:	83 f8 04             	cmp    $0x4,%eax
+  802b90:	74 09                	je     802b9b <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  802b92:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  802b96:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  802b9b:	48 89 d0             	mov    %rdx,%rax
+  802b9e:	48 83 c4 08          	add    $0x8,%rsp
+  802ba2:	5b                   	pop    %rbx
+  802ba3:	41 5c                	pop    %r12
+  802ba5:	41 5d                	pop    %r13
+  802ba7:	5d                   	pop    %rbp
+  802ba8:	c3                   	ret
+  802ba9:	48 89 d0             	mov    %rdx,%rax
+  802bac:	c3                   	ret
+
+0000000000802bad <cputchar>:
+cputchar(int ch) {
+  802bad:	55                   	push   %rbp
+  802bae:	48 89 e5             	mov    %rsp,%rbp
+  802bb1:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  802bb5:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  802bb9:	be 01 00 00 00       	mov    $0x1,%esi
+  802bbe:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  802bc2:	48 b8 c4 0f 80 00 00 	movabs $0x800fc4,%rax
+  802bc9:	00 00 00 
+  802bcc:	ff d0                	call   *%rax
+}
+  802bce:	c9                   	leave
+  802bcf:	c3                   	ret
+
+0000000000802bd0 <getchar>:
+getchar(void) {
+  802bd0:	55                   	push   %rbp
+  802bd1:	48 89 e5             	mov    %rsp,%rbp
+  802bd4:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  802bd8:	ba 01 00 00 00       	mov    $0x1,%edx
+  802bdd:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  802be1:	bf 00 00 00 00       	mov    $0x0,%edi
+  802be6:	48 b8 f4 1a 80 00 00 	movabs $0x801af4,%rax
+  802bed:	00 00 00 
+  802bf0:	ff d0                	call   *%rax
+  802bf2:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  802bf4:	85 c0                	test   %eax,%eax
+  802bf6:	78 06                	js     802bfe <getchar+0x2e>
+  802bf8:	74 08                	je     802c02 <getchar+0x32>
+  802bfa:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  802bfe:	89 d0                	mov    %edx,%eax
+  802c00:	c9                   	leave
+  802c01:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  802c02:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  802c07:	eb f5                	jmp    802bfe <getchar+0x2e>
+
+0000000000802c09 <iscons>:
+iscons(int fdnum) {
+  802c09:	55                   	push   %rbp
+  802c0a:	48 89 e5             	mov    %rsp,%rbp
+  802c0d:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  802c11:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802c15:	48 b8 11 18 80 00 00 	movabs $0x801811,%rax
+  802c1c:	00 00 00 
+  802c1f:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802c21:	85 c0                	test   %eax,%eax
+  802c23:	78 18                	js     802c3d <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  802c25:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802c29:	48 b8 a0 40 80 00 00 	movabs $0x8040a0,%rax
+  802c30:	00 00 00 
+  802c33:	8b 00                	mov    (%rax),%eax
+  802c35:	39 02                	cmp    %eax,(%rdx)
+  802c37:	0f 94 c0             	sete   %al
+  802c3a:	0f b6 c0             	movzbl %al,%eax
+}
+  802c3d:	c9                   	leave
+  802c3e:	c3                   	ret
+
+0000000000802c3f <opencons>:
+opencons(void) {
+  802c3f:	55                   	push   %rbp
+  802c40:	48 89 e5             	mov    %rsp,%rbp
+  802c43:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802c47:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  802c4b:	48 b8 f7 17 80 00 00 	movabs $0x8017f7,%rax
+  802c52:	00 00 00 
+  802c55:	ff d0                	call   *%rax
+  802c57:	85 c0                	test   %eax,%eax
+  802c59:	78 49                	js     802ca4 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  802c5b:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802c60:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802c65:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  802c69:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c6e:	48 b8 4d 11 80 00 00 	movabs $0x80114d,%rax
+  802c75:	00 00 00 
+  802c78:	ff d0                	call   *%rax
+  802c7a:	85 c0                	test   %eax,%eax
+  802c7c:	78 26                	js     802ca4 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  802c7e:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802c82:	a1 a0 40 80 00 00 00 	movabs 0x8040a0,%eax
+  802c89:	00 00 
+  802c8b:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  802c8d:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802c91:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  802c98:	48 b8 50 17 80 00 00 	movabs $0x801750,%rax
+  802c9f:	00 00 00 
+  802ca2:	ff d0                	call   *%rax
+}
+  802ca4:	c9                   	leave
+  802ca5:	c3                   	ret
+
+0000000000802ca6 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  802ca6:	55                   	push   %rbp
+  802ca7:	48 89 e5             	mov    %rsp,%rbp
+  802caa:	41 56                	push   %r14
+  802cac:	41 55                	push   %r13
+  802cae:	41 54                	push   %r12
+  802cb0:	53                   	push   %rbx
+  802cb1:	48 83 ec 50          	sub    $0x50,%rsp
+  802cb5:	49 89 fc             	mov    %rdi,%r12
+  802cb8:	41 89 f5             	mov    %esi,%r13d
+  802cbb:	48 89 d3             	mov    %rdx,%rbx
+  802cbe:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  802cc2:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  802cc6:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  802cca:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  802cd1:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802cd5:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  802cd9:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  802cdd:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  802ce1:	48 b8 00 40 80 00 00 	movabs $0x804000,%rax
+  802ce8:	00 00 00 
+  802ceb:	4c 8b 30             	mov    (%rax),%r14
+  802cee:	48 b8 8d 10 80 00 00 	movabs $0x80108d,%rax
+  802cf5:	00 00 00 
+  802cf8:	ff d0                	call   *%rax
+  802cfa:	89 c6                	mov    %eax,%esi
+  802cfc:	45 89 e8             	mov    %r13d,%r8d
+  802cff:	4c 89 e1             	mov    %r12,%rcx
+  802d02:	4c 89 f2             	mov    %r14,%rdx
+  802d05:	48 bf 40 34 80 00 00 	movabs $0x803440,%rdi
+  802d0c:	00 00 00 
+  802d0f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d14:	49 bc 78 02 80 00 00 	movabs $0x800278,%r12
+  802d1b:	00 00 00 
+  802d1e:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  802d21:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  802d25:	48 89 df             	mov    %rbx,%rdi
+  802d28:	48 b8 14 02 80 00 00 	movabs $0x800214,%rax
+  802d2f:	00 00 00 
+  802d32:	ff d0                	call   *%rax
+    cprintf("\n");
+  802d34:	48 bf 83 33 80 00 00 	movabs $0x803383,%rdi
+  802d3b:	00 00 00 
+  802d3e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d43:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  802d46:	cc                   	int3
+  802d47:	eb fd                	jmp    802d46 <_panic+0xa0>
+  802d49:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000802d50 <__rodata_start>:
+  802d50:	25 78 20 72 65       	and    $0x65722078,%eax
+  802d55:	63 76 20             	movsxd 0x20(%rsi),%esi
+  802d58:	66 72 6f             	data16 jb 802dca <__rodata_start+0x7a>
+  802d5b:	6d                   	insl   (%dx),%es:(%rdi)
+  802d5c:	20 25 78 0a 00 25    	and    %ah,0x25000a78(%rip)        # 258037da <__bss_end+0x24ffb7da>
+  802d62:	78 20                	js     802d84 <__rodata_start+0x34>
+  802d64:	6c                   	insb   (%dx),%es:(%rdi)
+  802d65:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802d66:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802d67:	70 20                	jo     802d89 <__rodata_start+0x39>
+  802d69:	73 65                	jae    802dd0 <__rodata_start+0x80>
+  802d6b:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802d6c:	64 69 6e 67 20 74 6f 	imul   $0x206f7420,%fs:0x67(%rsi),%ebp
+  802d73:	20 
+  802d74:	25 78 0a 00 3c       	and    $0x3c000a78,%eax
+  802d79:	75 6e                	jne    802de9 <__rodata_start+0x99>
+  802d7b:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  802d7f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802d80:	3e 00 30             	ds add %dh,(%rax)
+  802d83:	31 32                	xor    %esi,(%rdx)
+  802d85:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  802d8c:	41                   	rex.B
+  802d8d:	42                   	rex.X
+  802d8e:	43                   	rex.XB
+  802d8f:	44                   	rex.R
+  802d90:	45                   	rex.RB
+  802d91:	46 00 30             	rex.RX add %r14b,(%rax)
+  802d94:	31 32                	xor    %esi,(%rdx)
+  802d96:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  802d9d:	61                   	(bad)
+  802d9e:	62 63 64 65 66       	(bad)
+  802da3:	00 28                	add    %ch,(%rax)
+  802da5:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802da6:	75 6c                	jne    802e14 <__rodata_start+0xc4>
+  802da8:	6c                   	insb   (%dx),%es:(%rdi)
+  802da9:	29 00                	sub    %eax,(%rax)
+  802dab:	65 72 72             	gs jb  802e20 <__rodata_start+0xd0>
+  802dae:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802daf:	72 20                	jb     802dd1 <__rodata_start+0x81>
+  802db1:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  802db6:	73 70                	jae    802e28 <__rodata_start+0xd8>
+  802db8:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  802dbc:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  802dc3:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802dc4:	72 00                	jb     802dc6 <__rodata_start+0x76>
+  802dc6:	62 61 64 20 65       	(bad)
+  802dcb:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802dcc:	76 69                	jbe    802e37 <__rodata_start+0xe7>
+  802dce:	72 6f                	jb     802e3f <__rodata_start+0xef>
+  802dd0:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802dd1:	6d                   	insl   (%dx),%es:(%rdi)
+  802dd2:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  802dd4:	74 00                	je     802dd6 <__rodata_start+0x86>
+  802dd6:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  802ddd:	20 70 61             	and    %dh,0x61(%rax)
+  802de0:	72 61                	jb     802e43 <__rodata_start+0xf3>
+  802de2:	6d                   	insl   (%dx),%es:(%rdi)
+  802de3:	65 74 65             	gs je  802e4b <__rodata_start+0xfb>
+  802de6:	72 00                	jb     802de8 <__rodata_start+0x98>
+  802de8:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802de9:	75 74                	jne    802e5f <__rodata_start+0x10f>
+  802deb:	20 6f 66             	and    %ch,0x66(%rdi)
+  802dee:	20 6d 65             	and    %ch,0x65(%rbp)
+  802df1:	6d                   	insl   (%dx),%es:(%rdi)
+  802df2:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802df3:	72 79                	jb     802e6e <__rodata_start+0x11e>
+  802df5:	00 6f 75             	add    %ch,0x75(%rdi)
+  802df8:	74 20                	je     802e1a <__rodata_start+0xca>
+  802dfa:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802dfb:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  802dff:	76 69                	jbe    802e6a <__rodata_start+0x11a>
+  802e01:	72 6f                	jb     802e72 <__rodata_start+0x122>
+  802e03:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802e04:	6d                   	insl   (%dx),%es:(%rdi)
+  802e05:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  802e07:	74 73                	je     802e7c <__rodata_start+0x12c>
+  802e09:	00 63 6f             	add    %ah,0x6f(%rbx)
+  802e0c:	72 72                	jb     802e80 <__rodata_start+0x130>
+  802e0e:	75 70                	jne    802e80 <__rodata_start+0x130>
+  802e10:	74 65                	je     802e77 <__rodata_start+0x127>
+  802e12:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  802e17:	75 67                	jne    802e80 <__rodata_start+0x130>
+  802e19:	20 69 6e             	and    %ch,0x6e(%rcx)
+  802e1c:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  802e1e:	00 73 65             	add    %dh,0x65(%rbx)
+  802e21:	67 6d                	insl   (%dx),%es:(%edi)
+  802e23:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  802e25:	74 61                	je     802e88 <__rodata_start+0x138>
+  802e27:	74 69                	je     802e92 <__rodata_start+0x142>
+  802e29:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802e2a:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802e2b:	20 66 61             	and    %ah,0x61(%rsi)
+  802e2e:	75 6c                	jne    802e9c <__rodata_start+0x14c>
+  802e30:	74 00                	je     802e32 <__rodata_start+0xe2>
+  802e32:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  802e39:	20 45 4c             	and    %al,0x4c(%rbp)
+  802e3c:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  802e40:	61                   	(bad)
+  802e41:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  802e46:	20 73 75             	and    %dh,0x75(%rbx)
+  802e49:	63 68 20             	movsxd 0x20(%rax),%ebp
+  802e4c:	73 79                	jae    802ec7 <__rodata_start+0x177>
+  802e4e:	73 74                	jae    802ec4 <__rodata_start+0x174>
+  802e50:	65 6d                	gs insl (%dx),%es:(%rdi)
+  802e52:	20 63 61             	and    %ah,0x61(%rbx)
+  802e55:	6c                   	insb   (%dx),%es:(%rdi)
+  802e56:	6c                   	insb   (%dx),%es:(%rdi)
+  802e57:	00 65 6e             	add    %ah,0x6e(%rbp)
+  802e5a:	74 72                	je     802ece <__rodata_start+0x17e>
+  802e5c:	79 20                	jns    802e7e <__rodata_start+0x12e>
+  802e5e:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802e5f:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802e60:	74 20                	je     802e82 <__rodata_start+0x132>
+  802e62:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  802e64:	75 6e                	jne    802ed4 <__rodata_start+0x184>
+  802e66:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  802e6a:	76 20                	jbe    802e8c <__rodata_start+0x13c>
+  802e6c:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  802e73:	72 65                	jb     802eda <__rodata_start+0x18a>
+  802e75:	63 76 69             	movsxd 0x69(%rsi),%esi
+  802e78:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802e79:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  802e7d:	65 78 70             	gs js  802ef0 <__rodata_start+0x1a0>
+  802e80:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  802e85:	20 65 6e             	and    %ah,0x6e(%rbp)
+  802e88:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  802e8c:	20 66 69             	and    %ah,0x69(%rsi)
+  802e8f:	6c                   	insb   (%dx),%es:(%rdi)
+  802e90:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  802e94:	20 66 72             	and    %ah,0x72(%rsi)
+  802e97:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  802e9c:	61                   	(bad)
+  802e9d:	63 65 20             	movsxd 0x20(%rbp),%esp
+  802ea0:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802ea1:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802ea2:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  802ea6:	6b 00 74             	imul   $0x74,(%rax),%eax
+  802ea9:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802eaa:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802eab:	20 6d 61             	and    %ch,0x61(%rbp)
+  802eae:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802eaf:	79 20                	jns    802ed1 <__rodata_start+0x181>
+  802eb1:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  802eb8:	72 65                	jb     802f1f <__rodata_start+0x1cf>
+  802eba:	20 6f 70             	and    %ch,0x70(%rdi)
+  802ebd:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  802ebf:	00 66 69             	add    %ah,0x69(%rsi)
+  802ec2:	6c                   	insb   (%dx),%es:(%rdi)
+  802ec3:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  802ec7:	20 62 6c             	and    %ah,0x6c(%rdx)
+  802eca:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802ecb:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  802ece:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802ecf:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802ed0:	74 20                	je     802ef2 <__rodata_start+0x1a2>
+  802ed2:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  802ed4:	75 6e                	jne    802f44 <__rodata_start+0x1f4>
+  802ed6:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  802eda:	76 61                	jbe    802f3d <__rodata_start+0x1ed>
+  802edc:	6c                   	insb   (%dx),%es:(%rdi)
+  802edd:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  802ee4:	00 
+  802ee5:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  802eec:	72 65                	jb     802f53 <__rodata_start+0x203>
+  802eee:	61                   	(bad)
+  802eef:	64 79 20             	fs jns 802f12 <__rodata_start+0x1c2>
+  802ef2:	65 78 69             	gs js  802f5e <__rodata_start+0x20e>
+  802ef5:	73 74                	jae    802f6b <__rodata_start+0x21b>
+  802ef7:	73 00                	jae    802ef9 <__rodata_start+0x1a9>
+  802ef9:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802efa:	70 65                	jo     802f61 <__rodata_start+0x211>
+  802efc:	72 61                	jb     802f5f <__rodata_start+0x20f>
+  802efe:	74 69                	je     802f69 <__rodata_start+0x219>
+  802f00:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802f01:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802f02:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  802f05:	74 20                	je     802f27 <__rodata_start+0x1d7>
+  802f07:	73 75                	jae    802f7e <__rodata_start+0x22e>
+  802f09:	70 70                	jo     802f7b <__rodata_start+0x22b>
+  802f0b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802f0c:	72 74                	jb     802f82 <__rodata_start+0x232>
+  802f0e:	65 64 00 6f 70       	gs add %ch,%fs:0x70(%rdi)
+  802f13:	65 72 61             	gs jb  802f77 <__rodata_start+0x227>
+  802f16:	74 69                	je     802f81 <__rodata_start+0x231>
+  802f18:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802f19:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802f1a:	20 69 6e             	and    %ch,0x6e(%rcx)
+  802f1d:	74 65                	je     802f84 <__rodata_start+0x234>
+  802f1f:	72 72                	jb     802f93 <__rodata_start+0x243>
+  802f21:	75 70                	jne    802f93 <__rodata_start+0x243>
+  802f23:	74 65                	je     802f8a <__rodata_start+0x23a>
+  802f25:	64 00 6e 6f          	add    %ch,%fs:0x6f(%rsi)
+  802f29:	74 20                	je     802f4b <__rodata_start+0x1fb>
+  802f2b:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  802f2d:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802f2e:	75 67                	jne    802f97 <__rodata_start+0x247>
+  802f30:	68 20 43 50 55       	push   $0x55504320
+  802f35:	20 74 69 6d          	and    %dh,0x6d(%rcx,%rbp,2)
+  802f39:	65 00 0f             	add    %cl,%gs:(%rdi)
+  802f3c:	1f                   	(bad)
+  802f3d:	44 00 00             	add    %r8b,(%rax)
+  802f40:	65 04 80             	gs add $0x80,%al
+  802f43:	00 00                	add    %al,(%rax)
+  802f45:	00 00                	add    %al,(%rax)
+  802f47:	00 a6 0a 80 00 00    	add    %ah,0x800a(%rsi)
+  802f4d:	00 00                	add    %al,(%rax)
+  802f4f:	00 96 0a 80 00 00    	add    %dl,0x800a(%rsi)
+  802f55:	00 00                	add    %al,(%rax)
+  802f57:	00 a6 0a 80 00 00    	add    %ah,0x800a(%rsi)
+  802f5d:	00 00                	add    %al,(%rax)
+  802f5f:	00 a6 0a 80 00 00    	add    %ah,0x800a(%rsi)
+  802f65:	00 00                	add    %al,(%rax)
+  802f67:	00 a6 0a 80 00 00    	add    %ah,0x800a(%rsi)
+  802f6d:	00 00                	add    %al,(%rax)
+  802f6f:	00 a6 0a 80 00 00    	add    %ah,0x800a(%rsi)
+  802f75:	00 00                	add    %al,(%rax)
+  802f77:	00 84 04 80 00 00 00 	add    %al,0x80(%rsp,%rax,1)
+  802f7e:	00 00                	add    %al,(%rax)
+  802f80:	a6                   	cmpsb  %es:(%rdi),%ds:(%rsi)
+  802f81:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  802f87:	00 a6 0a 80 00 00    	add    %ah,0x800a(%rsi)
+  802f8d:	00 00                	add    %al,(%rax)
+  802f8f:	00 78 04             	add    %bh,0x4(%rax)
+  802f92:	80 00 00             	addb   $0x0,(%rax)
+  802f95:	00 00                	add    %al,(%rax)
+  802f97:	00 f2                	add    %dh,%dl
+  802f99:	04 80                	add    $0x80,%al
+  802f9b:	00 00                	add    %al,(%rax)
+  802f9d:	00 00                	add    %al,(%rax)
+  802f9f:	00 a6 0a 80 00 00    	add    %ah,0x800a(%rsi)
+  802fa5:	00 00                	add    %al,(%rax)
+  802fa7:	00 78 04             	add    %bh,0x4(%rax)
+  802faa:	80 00 00             	addb   $0x0,(%rax)
+  802fad:	00 00                	add    %al,(%rax)
+  802faf:	00 be 04 80 00 00    	add    %bh,0x8004(%rsi)
+  802fb5:	00 00                	add    %al,(%rax)
+  802fb7:	00 be 04 80 00 00    	add    %bh,0x8004(%rsi)
+  802fbd:	00 00                	add    %al,(%rax)
+  802fbf:	00 be 04 80 00 00    	add    %bh,0x8004(%rsi)
+  802fc5:	00 00                	add    %al,(%rax)
+  802fc7:	00 be 04 80 00 00    	add    %bh,0x8004(%rsi)
+  802fcd:	00 00                	add    %al,(%rax)
+  802fcf:	00 be 04 80 00 00    	add    %bh,0x8004(%rsi)
+  802fd5:	00 00                	add    %al,(%rax)
+  802fd7:	00 be 04 80 00 00    	add    %bh,0x8004(%rsi)
+  802fdd:	00 00                	add    %al,(%rax)
+  802fdf:	00 be 04 80 00 00    	add    %bh,0x8004(%rsi)
+  802fe5:	00 00                	add    %al,(%rax)
+  802fe7:	00 be 04 80 00 00    	add    %bh,0x8004(%rsi)
+  802fed:	00 00                	add    %al,(%rax)
+  802fef:	00 be 04 80 00 00    	add    %bh,0x8004(%rsi)
+  802ff5:	00 00                	add    %al,(%rax)
+  802ff7:	00 a6 0a 80 00 00    	add    %ah,0x800a(%rsi)
+  802ffd:	00 00                	add    %al,(%rax)
+  802fff:	00 a6 0a 80 00 00    	add    %ah,0x800a(%rsi)
+  803005:	00 00                	add    %al,(%rax)
+  803007:	00 a6 0a 80 00 00    	add    %ah,0x800a(%rsi)
+  80300d:	00 00                	add    %al,(%rax)
+  80300f:	00 a6 0a 80 00 00    	add    %ah,0x800a(%rsi)
+  803015:	00 00                	add    %al,(%rax)
+  803017:	00 a6 0a 80 00 00    	add    %ah,0x800a(%rsi)
+  80301d:	00 00                	add    %al,(%rax)
+  80301f:	00 a6 0a 80 00 00    	add    %ah,0x800a(%rsi)
+  803025:	00 00                	add    %al,(%rax)
+  803027:	00 a6 0a 80 00 00    	add    %ah,0x800a(%rsi)
+  80302d:	00 00                	add    %al,(%rax)
+  80302f:	00 a6 0a 80 00 00    	add    %ah,0x800a(%rsi)
+  803035:	00 00                	add    %al,(%rax)
+  803037:	00 a6 0a 80 00 00    	add    %ah,0x800a(%rsi)
+  80303d:	00 00                	add    %al,(%rax)
+  80303f:	00 a6 0a 80 00 00    	add    %ah,0x800a(%rsi)
+  803045:	00 00                	add    %al,(%rax)
+  803047:	00 a6 0a 80 00 00    	add    %ah,0x800a(%rsi)
+  80304d:	00 00                	add    %al,(%rax)
+  80304f:	00 a6 0a 80 00 00    	add    %ah,0x800a(%rsi)
+  803055:	00 00                	add    %al,(%rax)
+  803057:	00 a6 0a 80 00 00    	add    %ah,0x800a(%rsi)
+  80305d:	00 00                	add    %al,(%rax)
+  80305f:	00 a6 0a 80 00 00    	add    %ah,0x800a(%rsi)
+  803065:	00 00                	add    %al,(%rax)
+  803067:	00 a6 0a 80 00 00    	add    %ah,0x800a(%rsi)
+  80306d:	00 00                	add    %al,(%rax)
+  80306f:	00 a6 0a 80 00 00    	add    %ah,0x800a(%rsi)
+  803075:	00 00                	add    %al,(%rax)
+  803077:	00 a6 0a 80 00 00    	add    %ah,0x800a(%rsi)
+  80307d:	00 00                	add    %al,(%rax)
+  80307f:	00 a6 0a 80 00 00    	add    %ah,0x800a(%rsi)
+  803085:	00 00                	add    %al,(%rax)
+  803087:	00 a6 0a 80 00 00    	add    %ah,0x800a(%rsi)
+  80308d:	00 00                	add    %al,(%rax)
+  80308f:	00 a6 0a 80 00 00    	add    %ah,0x800a(%rsi)
+  803095:	00 00                	add    %al,(%rax)
+  803097:	00 a6 0a 80 00 00    	add    %ah,0x800a(%rsi)
+  80309d:	00 00                	add    %al,(%rax)
+  80309f:	00 a6 0a 80 00 00    	add    %ah,0x800a(%rsi)
+  8030a5:	00 00                	add    %al,(%rax)
+  8030a7:	00 a6 0a 80 00 00    	add    %ah,0x800a(%rsi)
+  8030ad:	00 00                	add    %al,(%rax)
+  8030af:	00 a6 0a 80 00 00    	add    %ah,0x800a(%rsi)
+  8030b5:	00 00                	add    %al,(%rax)
+  8030b7:	00 a6 0a 80 00 00    	add    %ah,0x800a(%rsi)
+  8030bd:	00 00                	add    %al,(%rax)
+  8030bf:	00 a6 0a 80 00 00    	add    %ah,0x800a(%rsi)
+  8030c5:	00 00                	add    %al,(%rax)
+  8030c7:	00 a6 0a 80 00 00    	add    %ah,0x800a(%rsi)
+  8030cd:	00 00                	add    %al,(%rax)
+  8030cf:	00 a6 0a 80 00 00    	add    %ah,0x800a(%rsi)
+  8030d5:	00 00                	add    %al,(%rax)
+  8030d7:	00 a6 0a 80 00 00    	add    %ah,0x800a(%rsi)
+  8030dd:	00 00                	add    %al,(%rax)
+  8030df:	00 a6 0a 80 00 00    	add    %ah,0x800a(%rsi)
+  8030e5:	00 00                	add    %al,(%rax)
+  8030e7:	00 c9                	add    %cl,%cl
+  8030e9:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  8030ef:	00 a6 0a 80 00 00    	add    %ah,0x800a(%rsi)
+  8030f5:	00 00                	add    %al,(%rax)
+  8030f7:	00 a6 0a 80 00 00    	add    %ah,0x800a(%rsi)
+  8030fd:	00 00                	add    %al,(%rax)
+  8030ff:	00 a6 0a 80 00 00    	add    %ah,0x800a(%rsi)
+  803105:	00 00                	add    %al,(%rax)
+  803107:	00 a6 0a 80 00 00    	add    %ah,0x800a(%rsi)
+  80310d:	00 00                	add    %al,(%rax)
+  80310f:	00 a6 0a 80 00 00    	add    %ah,0x800a(%rsi)
+  803115:	00 00                	add    %al,(%rax)
+  803117:	00 a6 0a 80 00 00    	add    %ah,0x800a(%rsi)
+  80311d:	00 00                	add    %al,(%rax)
+  80311f:	00 a6 0a 80 00 00    	add    %ah,0x800a(%rsi)
+  803125:	00 00                	add    %al,(%rax)
+  803127:	00 a6 0a 80 00 00    	add    %ah,0x800a(%rsi)
+  80312d:	00 00                	add    %al,(%rax)
+  80312f:	00 a6 0a 80 00 00    	add    %ah,0x800a(%rsi)
+  803135:	00 00                	add    %al,(%rax)
+  803137:	00 a6 0a 80 00 00    	add    %ah,0x800a(%rsi)
+  80313d:	00 00                	add    %al,(%rax)
+  80313f:	00 15 05 80 00 00    	add    %dl,0x8005(%rip)        # 80b14a <__bss_end+0x314a>
+  803145:	00 00                	add    %al,(%rax)
+  803147:	00 e4                	add    %ah,%ah
+  803149:	06                   	(bad)
+  80314a:	80 00 00             	addb   $0x0,(%rax)
+  80314d:	00 00                	add    %al,(%rax)
+  80314f:	00 a6 0a 80 00 00    	add    %ah,0x800a(%rsi)
+  803155:	00 00                	add    %al,(%rax)
+  803157:	00 a6 0a 80 00 00    	add    %ah,0x800a(%rsi)
+  80315d:	00 00                	add    %al,(%rax)
+  80315f:	00 a6 0a 80 00 00    	add    %ah,0x800a(%rsi)
+  803165:	00 00                	add    %al,(%rax)
+  803167:	00 a6 0a 80 00 00    	add    %ah,0x800a(%rsi)
+  80316d:	00 00                	add    %al,(%rax)
+  80316f:	00 44 05 80          	add    %al,-0x80(%rbp,%rax,1)
+  803173:	00 00                	add    %al,(%rax)
+  803175:	00 00                	add    %al,(%rax)
+  803177:	00 a6 0a 80 00 00    	add    %ah,0x800a(%rsi)
+  80317d:	00 00                	add    %al,(%rax)
+  80317f:	00 a6 0a 80 00 00    	add    %ah,0x800a(%rsi)
+  803185:	00 00                	add    %al,(%rax)
+  803187:	00 0a                	add    %cl,(%rdx)
+  803189:	05 80 00 00 00       	add    $0x80,%eax
+  80318e:	00 00                	add    %al,(%rax)
+  803190:	a6                   	cmpsb  %es:(%rdi),%ds:(%rsi)
+  803191:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803197:	00 a6 0a 80 00 00    	add    %ah,0x800a(%rsi)
+  80319d:	00 00                	add    %al,(%rax)
+  80319f:	00 8c 08 80 00 00 00 	add    %cl,0x80(%rax,%rcx,1)
+  8031a6:	00 00                	add    %al,(%rax)
+  8031a8:	56                   	push   %rsi
+  8031a9:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  8031af:	00 a6 0a 80 00 00    	add    %ah,0x800a(%rsi)
+  8031b5:	00 00                	add    %al,(%rax)
+  8031b7:	00 a6 0a 80 00 00    	add    %ah,0x800a(%rsi)
+  8031bd:	00 00                	add    %al,(%rax)
+  8031bf:	00 db                	add    %bl,%bl
+  8031c1:	05 80 00 00 00       	add    $0x80,%eax
+  8031c6:	00 00                	add    %al,(%rax)
+  8031c8:	a6                   	cmpsb  %es:(%rdi),%ds:(%rsi)
+  8031c9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8031cf:	00 b8 07 80 00 00    	add    %bh,0x8007(%rax)
+  8031d5:	00 00                	add    %al,(%rax)
+  8031d7:	00 a6 0a 80 00 00    	add    %ah,0x800a(%rsi)
+  8031dd:	00 00                	add    %al,(%rax)
+  8031df:	00 a6 0a 80 00 00    	add    %ah,0x800a(%rsi)
+  8031e5:	00 00                	add    %al,(%rax)
+  8031e7:	00 c9                	add    %cl,%cl
+  8031e9:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  8031ef:	00 a6 0a 80 00 00    	add    %ah,0x800a(%rsi)
+  8031f5:	00 00                	add    %al,(%rax)
+  8031f7:	00 6e 04             	add    %ch,0x4(%rsi)
+  8031fa:	80 00 00             	addb   $0x0,(%rax)
+  8031fd:	00 00                	add    %al,(%rax)
+	...
+
+0000000000803200 <error_string>:
+	...
+  803208:	b4 2d 80 00 00 00 00 00 c6 2d 80 00 00 00 00 00     .-.......-......
+  803218:	d6 2d 80 00 00 00 00 00 e8 2d 80 00 00 00 00 00     .-.......-......
+  803228:	f6 2d 80 00 00 00 00 00 0a 2e 80 00 00 00 00 00     .-..............
+  803238:	1f 2e 80 00 00 00 00 00 32 2e 80 00 00 00 00 00     ........2.......
+  803248:	44 2e 80 00 00 00 00 00 58 2e 80 00 00 00 00 00     D.......X.......
+  803258:	68 2e 80 00 00 00 00 00 7b 2e 80 00 00 00 00 00     h.......{.......
+  803268:	92 2e 80 00 00 00 00 00 a8 2e 80 00 00 00 00 00     ................
+  803278:	c0 2e 80 00 00 00 00 00 d8 2e 80 00 00 00 00 00     ................
+  803288:	e5 2e 80 00 00 00 00 00 b0 32 80 00 00 00 00 00     .........2......
+  803298:	f9 2e 80 00 00 00 00 00 11 2f 80 00 00 00 00 00     ........./......
+  8032a8:	27 2f 80 00 00 00 00 00 66 69 6c 65 20 69 73 20     '/......file is 
+  8032b8:	6e 6f 74 20 61 20 76 61 6c 69 64 20 65 78 65 63     not a valid exec
+  8032c8:	75 74 61 62 6c 65 00 90 73 79 73 63 61 6c 6c 20     utable..syscall 
+  8032d8:	25 7a 64 20 72 65 74 75 72 6e 65 64 20 25 7a 64     %zd returned %zd
+  8032e8:	20 28 3e 20 30 29 00 6c 69 62 2f 73 79 73 63 61      (> 0).lib/sysca
+  8032f8:	6c 6c 2e 63 00 73 79 73 5f 69 70 63 5f 74 72 79     ll.c.sys_ipc_try
+  803308:	5f 73 65 6e 64 20 66 61 69 6c 65 64 3a 20 25 69     _send failed: %i
+  803318:	00 6c 69 62 2f 69 70 63 2e 63 00 0f 1f 44 00 00     .lib/ipc.c...D..
+  803328:	5b 25 30 38 78 5d 20 75 6e 6b 6e 6f 77 6e 20 64     [%08x] unknown d
+  803338:	65 76 69 63 65 20 74 79 70 65 20 25 64 0a 00 00     evice type %d...
+  803348:	5b 25 30 38 78 5d 20 66 74 72 75 6e 63 61 74 65     [%08x] ftruncate
+  803358:	20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65 0a      %d -- bad mode.
+  803368:	00 5b 25 30 38 78 5d 20 72 65 61 64 20 25 64 20     .[%08x] read %d 
+  803378:	2d 2d 20 62 61 64 20 6d 6f 64 65 0a 00 5b 25 30     -- bad mode..[%0
+  803388:	38 78 5d 20 77 72 69 74 65 20 25 64 20 2d 2d 20     8x] write %d -- 
+  803398:	62 61 64 20 6d 6f 64 65 0a 00 66 2e 0f 1f 84 00     bad mode..f.....
+  8033a8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8033b8:	0f 1f 84 00 00 00 00 00                             ........
+
+00000000008033c0 <devtab>:
+  8033c0:	20 40 80 00 00 00 00 00 60 40 80 00 00 00 00 00      @......`@......
+  8033d0:	a0 40 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .@..............
+  8033e0:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  8033f0:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  803400:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  803410:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  803420:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  803430:	3d 20 32 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73 00     = 2.<cons>.cons.
+  803440:	5b 25 30 38 78 5d 20 75 73 65 72 20 70 61 6e 69     [%08x] user pani
+  803450:	63 20 69 6e 20 25 73 20 61 74 20 25 73 3a 25 64     c in %s at %s:%d
+  803460:	3a 20 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     : .f.........f..
+  803470:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803480:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803490:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8034a0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8034b0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8034c0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8034d0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8034e0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8034f0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803500:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803510:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803520:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803530:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803540:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803550:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803560:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803570:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803580:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803590:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8035a0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8035b0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8035c0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8035d0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8035e0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8035f0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803600:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803610:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803620:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803630:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803640:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803650:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803660:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803670:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803680:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803690:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8036a0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8036b0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8036c0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8036d0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8036e0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8036f0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803700:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803710:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803720:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803730:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803740:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803750:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803760:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803770:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803780:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803790:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8037a0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8037b0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8037c0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8037d0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8037e0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8037f0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803800:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803810:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803820:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803830:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803840:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803850:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803860:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803870:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803880:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803890:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8038a0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8038b0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8038c0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8038d0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8038e0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8038f0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803900:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803910:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803920:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803930:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803940:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803950:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803960:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803970:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803980:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803990:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8039a0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8039b0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8039c0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8039d0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8039e0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8039f0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803a00:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803a10:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803a20:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803a30:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803a40:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803a50:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803a60:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803a70:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803a80:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803a90:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803aa0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803ab0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803ac0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803ad0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803ae0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803af0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803b00:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803b10:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803b20:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803b30:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803b40:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803b50:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803b60:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803b70:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803b80:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803b90:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803ba0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803bb0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803bc0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803bd0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803be0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803bf0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803c00:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803c10:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803c20:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803c30:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803c40:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803c50:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803c60:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803c70:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803c80:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803c90:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803ca0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803cb0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803cc0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803cd0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803ce0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803cf0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803d00:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803d10:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803d20:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803d30:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803d40:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803d50:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803d60:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803d70:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803d80:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803d90:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803da0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803db0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803dc0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803dd0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803de0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803df0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803e00:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803e10:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803e20:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803e30:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803e40:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803e50:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803e60:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803e70:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803e80:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803e90:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803ea0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803eb0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803ec0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803ed0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803ee0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803ef0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803f00:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803f10:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803f20:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803f30:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803f40:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803f50:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803f60:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803f70:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803f80:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803f90:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803fa0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803fb0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803fc0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803fd0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803fe0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803ff0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 0f 1f 00     ...f............
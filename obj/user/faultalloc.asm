@@ -0,0 +1,6166 @@
+
+obj/user/faultalloc:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 0c 01 00 00       	call   80012f <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <handler>:
+/* Test user-level fault handler -- alloc pages to fix faults */
+
+#include <inc/lib.h>
+
+bool
+handler(struct UTrapframe *utf) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	53                   	push   %rbx
+  80002a:	48 83 ec 08          	sub    $0x8,%rsp
+    int r;
+    void *addr = (void *)utf->utf_fault_va;
+  80002e:	48 8b 1f             	mov    (%rdi),%rbx
+
+    cprintf("fault %lx\n", (unsigned long)addr);
+  800031:	48 89 de             	mov    %rbx,%rsi
+  800034:	48 bf 58 30 80 00 00 	movabs $0x803058,%rdi
+  80003b:	00 00 00 
+  80003e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800043:	48 ba 4b 03 80 00 00 	movabs $0x80034b,%rdx
+  80004a:	00 00 00 
+  80004d:	ff d2                	call   *%rdx
+    if ((r = sys_alloc_region(0, ROUNDDOWN(addr, PAGE_SIZE),
+  80004f:	48 89 de             	mov    %rbx,%rsi
+  800052:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+  800059:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80005e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800063:	bf 00 00 00 00       	mov    $0x0,%edi
+  800068:	48 b8 20 12 80 00 00 	movabs $0x801220,%rax
+  80006f:	00 00 00 
+  800072:	ff d0                	call   *%rax
+  800074:	85 c0                	test   %eax,%eax
+  800076:	78 32                	js     8000aa <handler+0x85>
+                              PAGE_SIZE, PROT_RW)) < 0)
+        panic("allocating at %lx in page fault handler: %i", (unsigned long)addr, r);
+    snprintf((char *)addr, 100, "this string was faulted in at %lx", (unsigned long)addr);
+  800078:	48 89 d9             	mov    %rbx,%rcx
+  80007b:	48 ba b0 30 80 00 00 	movabs $0x8030b0,%rdx
+  800082:	00 00 00 
+  800085:	be 64 00 00 00       	mov    $0x64,%esi
+  80008a:	48 89 df             	mov    %rbx,%rdi
+  80008d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800092:	49 b8 f5 0b 80 00 00 	movabs $0x800bf5,%r8
+  800099:	00 00 00 
+  80009c:	41 ff d0             	call   *%r8
+    return 1;
+}
+  80009f:	b8 01 00 00 00       	mov    $0x1,%eax
+  8000a4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8000a8:	c9                   	leave
+  8000a9:	c3                   	ret
+        panic("allocating at %lx in page fault handler: %i", (unsigned long)addr, r);
+  8000aa:	41 89 c0             	mov    %eax,%r8d
+  8000ad:	48 89 d9             	mov    %rbx,%rcx
+  8000b0:	48 ba 80 30 80 00 00 	movabs $0x803080,%rdx
+  8000b7:	00 00 00 
+  8000ba:	be 0d 00 00 00       	mov    $0xd,%esi
+  8000bf:	48 bf 63 30 80 00 00 	movabs $0x803063,%rdi
+  8000c6:	00 00 00 
+  8000c9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000ce:	49 b9 fb 01 80 00 00 	movabs $0x8001fb,%r9
+  8000d5:	00 00 00 
+  8000d8:	41 ff d1             	call   *%r9
+
+00000000008000db <umain>:
+
+void
+umain(int argc, char **argv) {
+  8000db:	55                   	push   %rbp
+  8000dc:	48 89 e5             	mov    %rsp,%rbp
+  8000df:	41 54                	push   %r12
+  8000e1:	53                   	push   %rbx
+    add_pgfault_handler(handler);
+  8000e2:	48 bf 25 00 80 00 00 	movabs $0x800025,%rdi
+  8000e9:	00 00 00 
+  8000ec:	48 b8 e5 16 80 00 00 	movabs $0x8016e5,%rax
+  8000f3:	00 00 00 
+  8000f6:	ff d0                	call   *%rax
+    cprintf("%s\n", (char *)0xBeefDead);
+  8000f8:	be ad de ef be       	mov    $0xbeefdead,%esi
+  8000fd:	49 bc 75 30 80 00 00 	movabs $0x803075,%r12
+  800104:	00 00 00 
+  800107:	4c 89 e7             	mov    %r12,%rdi
+  80010a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80010f:	48 bb 4b 03 80 00 00 	movabs $0x80034b,%rbx
+  800116:	00 00 00 
+  800119:	ff d3                	call   *%rbx
+    cprintf("%s\n", (char *)0xCafeBffe);
+  80011b:	be fe bf fe ca       	mov    $0xcafebffe,%esi
+  800120:	4c 89 e7             	mov    %r12,%rdi
+  800123:	b8 00 00 00 00       	mov    $0x0,%eax
+  800128:	ff d3                	call   *%rbx
+}
+  80012a:	5b                   	pop    %rbx
+  80012b:	41 5c                	pop    %r12
+  80012d:	5d                   	pop    %rbp
+  80012e:	c3                   	ret
+
+000000000080012f <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  80012f:	55                   	push   %rbp
+  800130:	48 89 e5             	mov    %rsp,%rbp
+  800133:	41 56                	push   %r14
+  800135:	41 55                	push   %r13
+  800137:	41 54                	push   %r12
+  800139:	53                   	push   %rbx
+  80013a:	41 89 fd             	mov    %edi,%r13d
+  80013d:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800140:	48 ba d8 40 80 00 00 	movabs $0x8040d8,%rdx
+  800147:	00 00 00 
+  80014a:	48 b8 d8 40 80 00 00 	movabs $0x8040d8,%rax
+  800151:	00 00 00 
+  800154:	48 39 c2             	cmp    %rax,%rdx
+  800157:	73 17                	jae    800170 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  800159:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  80015c:	49 89 c4             	mov    %rax,%r12
+  80015f:	48 83 c3 08          	add    $0x8,%rbx
+  800163:	b8 00 00 00 00       	mov    $0x0,%eax
+  800168:	ff 53 f8             	call   *-0x8(%rbx)
+  80016b:	4c 39 e3             	cmp    %r12,%rbx
+  80016e:	72 ef                	jb     80015f <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+    envid_t this_env_id = sys_getenvid();
+  800170:	48 b8 60 11 80 00 00 	movabs $0x801160,%rax
+  800177:	00 00 00 
+  80017a:	ff d0                	call   *%rax
+    thisenv = &((struct Env*)UENVS)[ENVX(this_env_id)];
+  80017c:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800181:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+  800188:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  80018f:	00 00 00 
+  800192:	48 01 d0             	add    %rdx,%rax
+  800195:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  80019c:	00 00 00 
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  80019f:	45 85 ed             	test   %r13d,%r13d
+  8001a2:	7e 0d                	jle    8001b1 <libmain+0x82>
+  8001a4:	49 8b 06             	mov    (%r14),%rax
+  8001a7:	48 a3 00 40 80 00 00 	movabs %rax,0x804000
+  8001ae:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8001b1:	4c 89 f6             	mov    %r14,%rsi
+  8001b4:	44 89 ef             	mov    %r13d,%edi
+  8001b7:	48 b8 db 00 80 00 00 	movabs $0x8000db,%rax
+  8001be:	00 00 00 
+  8001c1:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8001c3:	48 b8 d8 01 80 00 00 	movabs $0x8001d8,%rax
+  8001ca:	00 00 00 
+  8001cd:	ff d0                	call   *%rax
+#endif
+}
+  8001cf:	5b                   	pop    %rbx
+  8001d0:	41 5c                	pop    %r12
+  8001d2:	41 5d                	pop    %r13
+  8001d4:	41 5e                	pop    %r14
+  8001d6:	5d                   	pop    %rbp
+  8001d7:	c3                   	ret
+
+00000000008001d8 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8001d8:	55                   	push   %rbp
+  8001d9:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  8001dc:	48 b8 93 1b 80 00 00 	movabs $0x801b93,%rax
+  8001e3:	00 00 00 
+  8001e6:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  8001e8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8001ed:	48 b8 f5 10 80 00 00 	movabs $0x8010f5,%rax
+  8001f4:	00 00 00 
+  8001f7:	ff d0                	call   *%rax
+}
+  8001f9:	5d                   	pop    %rbp
+  8001fa:	c3                   	ret
+
+00000000008001fb <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  8001fb:	55                   	push   %rbp
+  8001fc:	48 89 e5             	mov    %rsp,%rbp
+  8001ff:	41 56                	push   %r14
+  800201:	41 55                	push   %r13
+  800203:	41 54                	push   %r12
+  800205:	53                   	push   %rbx
+  800206:	48 83 ec 50          	sub    $0x50,%rsp
+  80020a:	49 89 fc             	mov    %rdi,%r12
+  80020d:	41 89 f5             	mov    %esi,%r13d
+  800210:	48 89 d3             	mov    %rdx,%rbx
+  800213:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  800217:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  80021b:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  80021f:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  800226:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80022a:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  80022e:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  800232:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  800236:	48 b8 00 40 80 00 00 	movabs $0x804000,%rax
+  80023d:	00 00 00 
+  800240:	4c 8b 30             	mov    (%rax),%r14
+  800243:	48 b8 60 11 80 00 00 	movabs $0x801160,%rax
+  80024a:	00 00 00 
+  80024d:	ff d0                	call   *%rax
+  80024f:	89 c6                	mov    %eax,%esi
+  800251:	45 89 e8             	mov    %r13d,%r8d
+  800254:	4c 89 e1             	mov    %r12,%rcx
+  800257:	4c 89 f2             	mov    %r14,%rdx
+  80025a:	48 bf e0 30 80 00 00 	movabs $0x8030e0,%rdi
+  800261:	00 00 00 
+  800264:	b8 00 00 00 00       	mov    $0x0,%eax
+  800269:	49 bc 4b 03 80 00 00 	movabs $0x80034b,%r12
+  800270:	00 00 00 
+  800273:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  800276:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  80027a:	48 89 df             	mov    %rbx,%rdi
+  80027d:	48 b8 e7 02 80 00 00 	movabs $0x8002e7,%rax
+  800284:	00 00 00 
+  800287:	ff d0                	call   *%rax
+    cprintf("\n");
+  800289:	48 bf 63 37 80 00 00 	movabs $0x803763,%rdi
+  800290:	00 00 00 
+  800293:	b8 00 00 00 00       	mov    $0x0,%eax
+  800298:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  80029b:	cc                   	int3
+  80029c:	eb fd                	jmp    80029b <_panic+0xa0>
+
+000000000080029e <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  80029e:	55                   	push   %rbp
+  80029f:	48 89 e5             	mov    %rsp,%rbp
+  8002a2:	53                   	push   %rbx
+  8002a3:	48 83 ec 08          	sub    $0x8,%rsp
+  8002a7:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  8002aa:	8b 06                	mov    (%rsi),%eax
+  8002ac:	8d 50 01             	lea    0x1(%rax),%edx
+  8002af:	89 16                	mov    %edx,(%rsi)
+  8002b1:	48 98                	cltq
+  8002b3:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  8002b8:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  8002be:	74 0a                	je     8002ca <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  8002c0:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  8002c4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8002c8:	c9                   	leave
+  8002c9:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  8002ca:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  8002ce:	be ff 00 00 00       	mov    $0xff,%esi
+  8002d3:	48 b8 97 10 80 00 00 	movabs $0x801097,%rax
+  8002da:	00 00 00 
+  8002dd:	ff d0                	call   *%rax
+        state->offset = 0;
+  8002df:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  8002e5:	eb d9                	jmp    8002c0 <putch+0x22>
+
+00000000008002e7 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  8002e7:	55                   	push   %rbp
+  8002e8:	48 89 e5             	mov    %rsp,%rbp
+  8002eb:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  8002f2:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  8002f5:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  8002fc:	b9 21 00 00 00       	mov    $0x21,%ecx
+  800301:	b8 00 00 00 00       	mov    $0x0,%eax
+  800306:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  800309:	48 89 f1             	mov    %rsi,%rcx
+  80030c:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  800313:	48 bf 9e 02 80 00 00 	movabs $0x80029e,%rdi
+  80031a:	00 00 00 
+  80031d:	48 b8 9b 04 80 00 00 	movabs $0x80049b,%rax
+  800324:	00 00 00 
+  800327:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  800329:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  800330:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  800337:	48 b8 97 10 80 00 00 	movabs $0x801097,%rax
+  80033e:	00 00 00 
+  800341:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  800343:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  800349:	c9                   	leave
+  80034a:	c3                   	ret
+
+000000000080034b <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  80034b:	55                   	push   %rbp
+  80034c:	48 89 e5             	mov    %rsp,%rbp
+  80034f:	48 83 ec 50          	sub    $0x50,%rsp
+  800353:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  800357:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  80035b:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80035f:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800363:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  800367:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  80036e:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800372:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800376:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80037a:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  80037e:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  800382:	48 b8 e7 02 80 00 00 	movabs $0x8002e7,%rax
+  800389:	00 00 00 
+  80038c:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  80038e:	c9                   	leave
+  80038f:	c3                   	ret
+
+0000000000800390 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  800390:	55                   	push   %rbp
+  800391:	48 89 e5             	mov    %rsp,%rbp
+  800394:	41 57                	push   %r15
+  800396:	41 56                	push   %r14
+  800398:	41 55                	push   %r13
+  80039a:	41 54                	push   %r12
+  80039c:	53                   	push   %rbx
+  80039d:	48 83 ec 18          	sub    $0x18,%rsp
+  8003a1:	49 89 fc             	mov    %rdi,%r12
+  8003a4:	49 89 f5             	mov    %rsi,%r13
+  8003a7:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8003ab:	8b 45 10             	mov    0x10(%rbp),%eax
+  8003ae:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  8003b1:	41 89 cf             	mov    %ecx,%r15d
+  8003b4:	4c 39 fa             	cmp    %r15,%rdx
+  8003b7:	73 5b                	jae    800414 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  8003b9:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  8003bd:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  8003c1:	85 db                	test   %ebx,%ebx
+  8003c3:	7e 0e                	jle    8003d3 <print_num+0x43>
+            putch(padc, put_arg);
+  8003c5:	4c 89 ee             	mov    %r13,%rsi
+  8003c8:	44 89 f7             	mov    %r14d,%edi
+  8003cb:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  8003ce:	83 eb 01             	sub    $0x1,%ebx
+  8003d1:	75 f2                	jne    8003c5 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  8003d3:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  8003d7:	48 b9 14 31 80 00 00 	movabs $0x803114,%rcx
+  8003de:	00 00 00 
+  8003e1:	48 b8 03 31 80 00 00 	movabs $0x803103,%rax
+  8003e8:	00 00 00 
+  8003eb:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  8003ef:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8003f3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8003f8:	49 f7 f7             	div    %r15
+  8003fb:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  8003ff:	4c 89 ee             	mov    %r13,%rsi
+  800402:	41 ff d4             	call   *%r12
+}
+  800405:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800409:	5b                   	pop    %rbx
+  80040a:	41 5c                	pop    %r12
+  80040c:	41 5d                	pop    %r13
+  80040e:	41 5e                	pop    %r14
+  800410:	41 5f                	pop    %r15
+  800412:	5d                   	pop    %rbp
+  800413:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  800414:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800418:	ba 00 00 00 00       	mov    $0x0,%edx
+  80041d:	49 f7 f7             	div    %r15
+  800420:	48 83 ec 08          	sub    $0x8,%rsp
+  800424:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  800428:	52                   	push   %rdx
+  800429:	45 0f be c9          	movsbl %r9b,%r9d
+  80042d:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  800431:	48 89 c2             	mov    %rax,%rdx
+  800434:	48 b8 90 03 80 00 00 	movabs $0x800390,%rax
+  80043b:	00 00 00 
+  80043e:	ff d0                	call   *%rax
+  800440:	48 83 c4 10          	add    $0x10,%rsp
+  800444:	eb 8d                	jmp    8003d3 <print_num+0x43>
+
+0000000000800446 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  800446:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  80044a:	48 8b 06             	mov    (%rsi),%rax
+  80044d:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  800451:	73 0a                	jae    80045d <sprintputch+0x17>
+        *state->start++ = ch;
+  800453:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800457:	48 89 16             	mov    %rdx,(%rsi)
+  80045a:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  80045d:	c3                   	ret
+
+000000000080045e <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  80045e:	55                   	push   %rbp
+  80045f:	48 89 e5             	mov    %rsp,%rbp
+  800462:	48 83 ec 50          	sub    $0x50,%rsp
+  800466:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80046a:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80046e:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  800472:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800479:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80047d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800481:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800485:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  800489:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80048d:	48 b8 9b 04 80 00 00 	movabs $0x80049b,%rax
+  800494:	00 00 00 
+  800497:	ff d0                	call   *%rax
+}
+  800499:	c9                   	leave
+  80049a:	c3                   	ret
+
+000000000080049b <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  80049b:	55                   	push   %rbp
+  80049c:	48 89 e5             	mov    %rsp,%rbp
+  80049f:	41 57                	push   %r15
+  8004a1:	41 56                	push   %r14
+  8004a3:	41 55                	push   %r13
+  8004a5:	41 54                	push   %r12
+  8004a7:	53                   	push   %rbx
+  8004a8:	48 83 ec 38          	sub    $0x38,%rsp
+  8004ac:	49 89 fe             	mov    %rdi,%r14
+  8004af:	49 89 f5             	mov    %rsi,%r13
+  8004b2:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  8004b5:	48 8b 01             	mov    (%rcx),%rax
+  8004b8:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8004bc:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  8004c0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8004c4:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  8004c8:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  8004cc:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  8004d0:	0f b6 3b             	movzbl (%rbx),%edi
+  8004d3:	40 80 ff 25          	cmp    $0x25,%dil
+  8004d7:	74 18                	je     8004f1 <vprintfmt+0x56>
+            if (!ch) return;
+  8004d9:	40 84 ff             	test   %dil,%dil
+  8004dc:	0f 84 b1 06 00 00    	je     800b93 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  8004e2:	40 0f b6 ff          	movzbl %dil,%edi
+  8004e6:	4c 89 ee             	mov    %r13,%rsi
+  8004e9:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  8004ec:	4c 89 e3             	mov    %r12,%rbx
+  8004ef:	eb db                	jmp    8004cc <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  8004f1:	be 00 00 00 00       	mov    $0x0,%esi
+  8004f6:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  8004fa:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  8004ff:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800505:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  80050c:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800510:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  800515:	41 0f b6 04 24       	movzbl (%r12),%eax
+  80051a:	88 45 a0             	mov    %al,-0x60(%rbp)
+  80051d:	83 e8 23             	sub    $0x23,%eax
+  800520:	3c 57                	cmp    $0x57,%al
+  800522:	0f 87 51 06 00 00    	ja     800b79 <vprintfmt+0x6de>
+  800528:	0f b6 c0             	movzbl %al,%eax
+  80052b:	48 b9 c0 32 80 00 00 	movabs $0x8032c0,%rcx
+  800532:	00 00 00 
+  800535:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  800538:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  80053b:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  80053f:	eb cf                	jmp    800510 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  800541:	49 89 dc             	mov    %rbx,%r12
+  800544:	be 01 00 00 00       	mov    $0x1,%esi
+  800549:	eb c5                	jmp    800510 <vprintfmt+0x75>
+            padc = ch;
+  80054b:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  80054f:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800552:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800555:	eb b9                	jmp    800510 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800557:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80055a:	83 f8 2f             	cmp    $0x2f,%eax
+  80055d:	77 24                	ja     800583 <vprintfmt+0xe8>
+  80055f:	89 c1                	mov    %eax,%ecx
+  800561:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  800565:	83 c0 08             	add    $0x8,%eax
+  800568:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80056b:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  80056e:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  800571:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800575:	79 99                	jns    800510 <vprintfmt+0x75>
+                width = precision;
+  800577:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  80057b:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800581:	eb 8d                	jmp    800510 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800583:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  800587:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  80058b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80058f:	eb da                	jmp    80056b <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  800591:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  800596:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  80059a:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  8005a0:	3c 39                	cmp    $0x39,%al
+  8005a2:	77 1c                	ja     8005c0 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  8005a4:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  8005a8:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  8005ac:	0f b6 c0             	movzbl %al,%eax
+  8005af:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8005b4:	0f b6 03             	movzbl (%rbx),%eax
+  8005b7:	3c 39                	cmp    $0x39,%al
+  8005b9:	76 e9                	jbe    8005a4 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  8005bb:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  8005be:	eb b1                	jmp    800571 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  8005c0:	49 89 dc             	mov    %rbx,%r12
+  8005c3:	eb ac                	jmp    800571 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  8005c5:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  8005c8:	85 c9                	test   %ecx,%ecx
+  8005ca:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005cf:	0f 49 c1             	cmovns %ecx,%eax
+  8005d2:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  8005d5:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8005d8:	e9 33 ff ff ff       	jmp    800510 <vprintfmt+0x75>
+            lflag++;
+  8005dd:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  8005e0:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8005e3:	e9 28 ff ff ff       	jmp    800510 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  8005e8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8005eb:	83 f8 2f             	cmp    $0x2f,%eax
+  8005ee:	77 19                	ja     800609 <vprintfmt+0x16e>
+  8005f0:	89 c2                	mov    %eax,%edx
+  8005f2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8005f6:	83 c0 08             	add    $0x8,%eax
+  8005f9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8005fc:	8b 3a                	mov    (%rdx),%edi
+  8005fe:	4c 89 ee             	mov    %r13,%rsi
+  800601:	41 ff d6             	call   *%r14
+            break;
+  800604:	e9 c3 fe ff ff       	jmp    8004cc <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  800609:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80060d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800611:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800615:	eb e5                	jmp    8005fc <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  800617:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80061a:	83 f8 2f             	cmp    $0x2f,%eax
+  80061d:	77 5a                	ja     800679 <vprintfmt+0x1de>
+  80061f:	89 c2                	mov    %eax,%edx
+  800621:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800625:	83 c0 08             	add    $0x8,%eax
+  800628:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  80062b:	8b 02                	mov    (%rdx),%eax
+  80062d:	89 c1                	mov    %eax,%ecx
+  80062f:	f7 d9                	neg    %ecx
+  800631:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  800634:	83 f9 15             	cmp    $0x15,%ecx
+  800637:	7f 4e                	jg     800687 <vprintfmt+0x1ec>
+  800639:	48 63 c1             	movslq %ecx,%rax
+  80063c:	48 ba 80 35 80 00 00 	movabs $0x803580,%rdx
+  800643:	00 00 00 
+  800646:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80064a:	48 85 c0             	test   %rax,%rax
+  80064d:	74 38                	je     800687 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  80064f:	48 89 c1             	mov    %rax,%rcx
+  800652:	48 ba 02 37 80 00 00 	movabs $0x803702,%rdx
+  800659:	00 00 00 
+  80065c:	4c 89 ee             	mov    %r13,%rsi
+  80065f:	4c 89 f7             	mov    %r14,%rdi
+  800662:	b8 00 00 00 00       	mov    $0x0,%eax
+  800667:	49 b8 5e 04 80 00 00 	movabs $0x80045e,%r8
+  80066e:	00 00 00 
+  800671:	41 ff d0             	call   *%r8
+  800674:	e9 53 fe ff ff       	jmp    8004cc <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  800679:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80067d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800681:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800685:	eb a4                	jmp    80062b <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  800687:	48 ba 2c 31 80 00 00 	movabs $0x80312c,%rdx
+  80068e:	00 00 00 
+  800691:	4c 89 ee             	mov    %r13,%rsi
+  800694:	4c 89 f7             	mov    %r14,%rdi
+  800697:	b8 00 00 00 00       	mov    $0x0,%eax
+  80069c:	49 b8 5e 04 80 00 00 	movabs $0x80045e,%r8
+  8006a3:	00 00 00 
+  8006a6:	41 ff d0             	call   *%r8
+  8006a9:	e9 1e fe ff ff       	jmp    8004cc <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8006ae:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006b1:	83 f8 2f             	cmp    $0x2f,%eax
+  8006b4:	77 6c                	ja     800722 <vprintfmt+0x287>
+  8006b6:	89 c2                	mov    %eax,%edx
+  8006b8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8006bc:	83 c0 08             	add    $0x8,%eax
+  8006bf:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8006c2:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  8006c5:	48 85 d2             	test   %rdx,%rdx
+  8006c8:	48 b8 25 31 80 00 00 	movabs $0x803125,%rax
+  8006cf:	00 00 00 
+  8006d2:	48 0f 45 c2          	cmovne %rdx,%rax
+  8006d6:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  8006da:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8006de:	7e 06                	jle    8006e6 <vprintfmt+0x24b>
+  8006e0:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  8006e4:	75 4a                	jne    800730 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8006e6:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8006ea:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8006ee:	0f b6 00             	movzbl (%rax),%eax
+  8006f1:	84 c0                	test   %al,%al
+  8006f3:	0f 85 9a 00 00 00    	jne    800793 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  8006f9:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8006fc:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  800700:	85 c0                	test   %eax,%eax
+  800702:	0f 8e c4 fd ff ff    	jle    8004cc <vprintfmt+0x31>
+  800708:	4c 89 ee             	mov    %r13,%rsi
+  80070b:	bf 20 00 00 00       	mov    $0x20,%edi
+  800710:	41 ff d6             	call   *%r14
+  800713:	41 83 ec 01          	sub    $0x1,%r12d
+  800717:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  80071b:	75 eb                	jne    800708 <vprintfmt+0x26d>
+  80071d:	e9 aa fd ff ff       	jmp    8004cc <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800722:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800726:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80072a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80072e:	eb 92                	jmp    8006c2 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  800730:	49 63 f7             	movslq %r15d,%rsi
+  800733:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  800737:	48 b8 4d 0c 80 00 00 	movabs $0x800c4d,%rax
+  80073e:	00 00 00 
+  800741:	ff d0                	call   *%rax
+  800743:	48 89 c2             	mov    %rax,%rdx
+  800746:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800749:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  80074b:	8d 70 ff             	lea    -0x1(%rax),%esi
+  80074e:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  800751:	85 c0                	test   %eax,%eax
+  800753:	7e 91                	jle    8006e6 <vprintfmt+0x24b>
+  800755:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  80075a:	4c 89 ee             	mov    %r13,%rsi
+  80075d:	44 89 e7             	mov    %r12d,%edi
+  800760:	41 ff d6             	call   *%r14
+  800763:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800767:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80076a:	83 f8 ff             	cmp    $0xffffffff,%eax
+  80076d:	75 eb                	jne    80075a <vprintfmt+0x2bf>
+  80076f:	e9 72 ff ff ff       	jmp    8006e6 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800774:	0f b6 f8             	movzbl %al,%edi
+  800777:	4c 89 ee             	mov    %r13,%rsi
+  80077a:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  80077d:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800781:	49 83 c4 01          	add    $0x1,%r12
+  800785:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  80078b:	84 c0                	test   %al,%al
+  80078d:	0f 84 66 ff ff ff    	je     8006f9 <vprintfmt+0x25e>
+  800793:	45 85 ff             	test   %r15d,%r15d
+  800796:	78 0a                	js     8007a2 <vprintfmt+0x307>
+  800798:	41 83 ef 01          	sub    $0x1,%r15d
+  80079c:	0f 88 57 ff ff ff    	js     8006f9 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8007a2:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  8007a6:	74 cc                	je     800774 <vprintfmt+0x2d9>
+  8007a8:	8d 50 e0             	lea    -0x20(%rax),%edx
+  8007ab:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  8007b0:	80 fa 5e             	cmp    $0x5e,%dl
+  8007b3:	77 c2                	ja     800777 <vprintfmt+0x2dc>
+  8007b5:	eb bd                	jmp    800774 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  8007b7:	40 84 f6             	test   %sil,%sil
+  8007ba:	75 26                	jne    8007e2 <vprintfmt+0x347>
+    switch (lflag) {
+  8007bc:	85 d2                	test   %edx,%edx
+  8007be:	74 59                	je     800819 <vprintfmt+0x37e>
+  8007c0:	83 fa 01             	cmp    $0x1,%edx
+  8007c3:	74 7b                	je     800840 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  8007c5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007c8:	83 f8 2f             	cmp    $0x2f,%eax
+  8007cb:	0f 87 96 00 00 00    	ja     800867 <vprintfmt+0x3cc>
+  8007d1:	89 c2                	mov    %eax,%edx
+  8007d3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007d7:	83 c0 08             	add    $0x8,%eax
+  8007da:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007dd:	4c 8b 22             	mov    (%rdx),%r12
+  8007e0:	eb 17                	jmp    8007f9 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  8007e2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007e5:	83 f8 2f             	cmp    $0x2f,%eax
+  8007e8:	77 21                	ja     80080b <vprintfmt+0x370>
+  8007ea:	89 c2                	mov    %eax,%edx
+  8007ec:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007f0:	83 c0 08             	add    $0x8,%eax
+  8007f3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007f6:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  8007f9:	4d 85 e4             	test   %r12,%r12
+  8007fc:	78 7a                	js     800878 <vprintfmt+0x3dd>
+            num = i;
+  8007fe:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  800801:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  800806:	e9 50 02 00 00       	jmp    800a5b <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  80080b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80080f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800813:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800817:	eb dd                	jmp    8007f6 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  800819:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80081c:	83 f8 2f             	cmp    $0x2f,%eax
+  80081f:	77 11                	ja     800832 <vprintfmt+0x397>
+  800821:	89 c2                	mov    %eax,%edx
+  800823:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800827:	83 c0 08             	add    $0x8,%eax
+  80082a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80082d:	4c 63 22             	movslq (%rdx),%r12
+  800830:	eb c7                	jmp    8007f9 <vprintfmt+0x35e>
+  800832:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800836:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80083a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80083e:	eb ed                	jmp    80082d <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  800840:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800843:	83 f8 2f             	cmp    $0x2f,%eax
+  800846:	77 11                	ja     800859 <vprintfmt+0x3be>
+  800848:	89 c2                	mov    %eax,%edx
+  80084a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80084e:	83 c0 08             	add    $0x8,%eax
+  800851:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800854:	4c 8b 22             	mov    (%rdx),%r12
+  800857:	eb a0                	jmp    8007f9 <vprintfmt+0x35e>
+  800859:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80085d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800861:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800865:	eb ed                	jmp    800854 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  800867:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80086b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80086f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800873:	e9 65 ff ff ff       	jmp    8007dd <vprintfmt+0x342>
+                putch('-', put_arg);
+  800878:	4c 89 ee             	mov    %r13,%rsi
+  80087b:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800880:	41 ff d6             	call   *%r14
+                i = -i;
+  800883:	49 f7 dc             	neg    %r12
+  800886:	e9 73 ff ff ff       	jmp    8007fe <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  80088b:	40 84 f6             	test   %sil,%sil
+  80088e:	75 32                	jne    8008c2 <vprintfmt+0x427>
+    switch (lflag) {
+  800890:	85 d2                	test   %edx,%edx
+  800892:	74 5d                	je     8008f1 <vprintfmt+0x456>
+  800894:	83 fa 01             	cmp    $0x1,%edx
+  800897:	0f 84 82 00 00 00    	je     80091f <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  80089d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008a0:	83 f8 2f             	cmp    $0x2f,%eax
+  8008a3:	0f 87 a5 00 00 00    	ja     80094e <vprintfmt+0x4b3>
+  8008a9:	89 c2                	mov    %eax,%edx
+  8008ab:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008af:	83 c0 08             	add    $0x8,%eax
+  8008b2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008b5:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8008b8:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  8008bd:	e9 99 01 00 00       	jmp    800a5b <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8008c2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008c5:	83 f8 2f             	cmp    $0x2f,%eax
+  8008c8:	77 19                	ja     8008e3 <vprintfmt+0x448>
+  8008ca:	89 c2                	mov    %eax,%edx
+  8008cc:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008d0:	83 c0 08             	add    $0x8,%eax
+  8008d3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008d6:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8008d9:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8008de:	e9 78 01 00 00       	jmp    800a5b <vprintfmt+0x5c0>
+  8008e3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008e7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008eb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008ef:	eb e5                	jmp    8008d6 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  8008f1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008f4:	83 f8 2f             	cmp    $0x2f,%eax
+  8008f7:	77 18                	ja     800911 <vprintfmt+0x476>
+  8008f9:	89 c2                	mov    %eax,%edx
+  8008fb:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008ff:	83 c0 08             	add    $0x8,%eax
+  800902:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800905:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800907:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  80090c:	e9 4a 01 00 00       	jmp    800a5b <vprintfmt+0x5c0>
+  800911:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800915:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800919:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80091d:	eb e6                	jmp    800905 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  80091f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800922:	83 f8 2f             	cmp    $0x2f,%eax
+  800925:	77 19                	ja     800940 <vprintfmt+0x4a5>
+  800927:	89 c2                	mov    %eax,%edx
+  800929:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80092d:	83 c0 08             	add    $0x8,%eax
+  800930:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800933:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800936:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  80093b:	e9 1b 01 00 00       	jmp    800a5b <vprintfmt+0x5c0>
+  800940:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800944:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800948:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80094c:	eb e5                	jmp    800933 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  80094e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800952:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800956:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80095a:	e9 56 ff ff ff       	jmp    8008b5 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  80095f:	40 84 f6             	test   %sil,%sil
+  800962:	75 2e                	jne    800992 <vprintfmt+0x4f7>
+    switch (lflag) {
+  800964:	85 d2                	test   %edx,%edx
+  800966:	74 59                	je     8009c1 <vprintfmt+0x526>
+  800968:	83 fa 01             	cmp    $0x1,%edx
+  80096b:	74 7f                	je     8009ec <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  80096d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800970:	83 f8 2f             	cmp    $0x2f,%eax
+  800973:	0f 87 9f 00 00 00    	ja     800a18 <vprintfmt+0x57d>
+  800979:	89 c2                	mov    %eax,%edx
+  80097b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80097f:	83 c0 08             	add    $0x8,%eax
+  800982:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800985:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800988:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  80098d:	e9 c9 00 00 00       	jmp    800a5b <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800992:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800995:	83 f8 2f             	cmp    $0x2f,%eax
+  800998:	77 19                	ja     8009b3 <vprintfmt+0x518>
+  80099a:	89 c2                	mov    %eax,%edx
+  80099c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009a0:	83 c0 08             	add    $0x8,%eax
+  8009a3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009a6:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8009a9:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8009ae:	e9 a8 00 00 00       	jmp    800a5b <vprintfmt+0x5c0>
+  8009b3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009b7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009bb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009bf:	eb e5                	jmp    8009a6 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  8009c1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009c4:	83 f8 2f             	cmp    $0x2f,%eax
+  8009c7:	77 15                	ja     8009de <vprintfmt+0x543>
+  8009c9:	89 c2                	mov    %eax,%edx
+  8009cb:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009cf:	83 c0 08             	add    $0x8,%eax
+  8009d2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009d5:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  8009d7:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  8009dc:	eb 7d                	jmp    800a5b <vprintfmt+0x5c0>
+  8009de:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009e2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009e6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009ea:	eb e9                	jmp    8009d5 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  8009ec:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009ef:	83 f8 2f             	cmp    $0x2f,%eax
+  8009f2:	77 16                	ja     800a0a <vprintfmt+0x56f>
+  8009f4:	89 c2                	mov    %eax,%edx
+  8009f6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009fa:	83 c0 08             	add    $0x8,%eax
+  8009fd:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a00:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800a03:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  800a08:	eb 51                	jmp    800a5b <vprintfmt+0x5c0>
+  800a0a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a0e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a12:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a16:	eb e8                	jmp    800a00 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  800a18:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a1c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a20:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a24:	e9 5c ff ff ff       	jmp    800985 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  800a29:	4c 89 ee             	mov    %r13,%rsi
+  800a2c:	bf 30 00 00 00       	mov    $0x30,%edi
+  800a31:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800a34:	4c 89 ee             	mov    %r13,%rsi
+  800a37:	bf 78 00 00 00       	mov    $0x78,%edi
+  800a3c:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800a3f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a42:	83 f8 2f             	cmp    $0x2f,%eax
+  800a45:	77 47                	ja     800a8e <vprintfmt+0x5f3>
+  800a47:	89 c2                	mov    %eax,%edx
+  800a49:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a4d:	83 c0 08             	add    $0x8,%eax
+  800a50:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a53:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800a56:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800a5b:	48 83 ec 08          	sub    $0x8,%rsp
+  800a5f:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800a63:	0f 94 c0             	sete   %al
+  800a66:	0f b6 c0             	movzbl %al,%eax
+  800a69:	50                   	push   %rax
+  800a6a:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800a6f:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800a73:	4c 89 ee             	mov    %r13,%rsi
+  800a76:	4c 89 f7             	mov    %r14,%rdi
+  800a79:	48 b8 90 03 80 00 00 	movabs $0x800390,%rax
+  800a80:	00 00 00 
+  800a83:	ff d0                	call   *%rax
+            break;
+  800a85:	48 83 c4 10          	add    $0x10,%rsp
+  800a89:	e9 3e fa ff ff       	jmp    8004cc <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800a8e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a92:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a96:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a9a:	eb b7                	jmp    800a53 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  800a9c:	40 84 f6             	test   %sil,%sil
+  800a9f:	75 2b                	jne    800acc <vprintfmt+0x631>
+    switch (lflag) {
+  800aa1:	85 d2                	test   %edx,%edx
+  800aa3:	74 56                	je     800afb <vprintfmt+0x660>
+  800aa5:	83 fa 01             	cmp    $0x1,%edx
+  800aa8:	74 7f                	je     800b29 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800aaa:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800aad:	83 f8 2f             	cmp    $0x2f,%eax
+  800ab0:	0f 87 a2 00 00 00    	ja     800b58 <vprintfmt+0x6bd>
+  800ab6:	89 c2                	mov    %eax,%edx
+  800ab8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800abc:	83 c0 08             	add    $0x8,%eax
+  800abf:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ac2:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800ac5:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800aca:	eb 8f                	jmp    800a5b <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800acc:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800acf:	83 f8 2f             	cmp    $0x2f,%eax
+  800ad2:	77 19                	ja     800aed <vprintfmt+0x652>
+  800ad4:	89 c2                	mov    %eax,%edx
+  800ad6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ada:	83 c0 08             	add    $0x8,%eax
+  800add:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ae0:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800ae3:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800ae8:	e9 6e ff ff ff       	jmp    800a5b <vprintfmt+0x5c0>
+  800aed:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800af1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800af5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800af9:	eb e5                	jmp    800ae0 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800afb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800afe:	83 f8 2f             	cmp    $0x2f,%eax
+  800b01:	77 18                	ja     800b1b <vprintfmt+0x680>
+  800b03:	89 c2                	mov    %eax,%edx
+  800b05:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b09:	83 c0 08             	add    $0x8,%eax
+  800b0c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b0f:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800b11:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800b16:	e9 40 ff ff ff       	jmp    800a5b <vprintfmt+0x5c0>
+  800b1b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b1f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b23:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b27:	eb e6                	jmp    800b0f <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800b29:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b2c:	83 f8 2f             	cmp    $0x2f,%eax
+  800b2f:	77 19                	ja     800b4a <vprintfmt+0x6af>
+  800b31:	89 c2                	mov    %eax,%edx
+  800b33:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b37:	83 c0 08             	add    $0x8,%eax
+  800b3a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b3d:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800b40:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800b45:	e9 11 ff ff ff       	jmp    800a5b <vprintfmt+0x5c0>
+  800b4a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b4e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b52:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b56:	eb e5                	jmp    800b3d <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800b58:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b5c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b60:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b64:	e9 59 ff ff ff       	jmp    800ac2 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800b69:	4c 89 ee             	mov    %r13,%rsi
+  800b6c:	bf 25 00 00 00       	mov    $0x25,%edi
+  800b71:	41 ff d6             	call   *%r14
+            break;
+  800b74:	e9 53 f9 ff ff       	jmp    8004cc <vprintfmt+0x31>
+            putch('%', put_arg);
+  800b79:	4c 89 ee             	mov    %r13,%rsi
+  800b7c:	bf 25 00 00 00       	mov    $0x25,%edi
+  800b81:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800b84:	48 83 eb 01          	sub    $0x1,%rbx
+  800b88:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800b8c:	75 f6                	jne    800b84 <vprintfmt+0x6e9>
+  800b8e:	e9 39 f9 ff ff       	jmp    8004cc <vprintfmt+0x31>
+}
+  800b93:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800b97:	5b                   	pop    %rbx
+  800b98:	41 5c                	pop    %r12
+  800b9a:	41 5d                	pop    %r13
+  800b9c:	41 5e                	pop    %r14
+  800b9e:	41 5f                	pop    %r15
+  800ba0:	5d                   	pop    %rbp
+  800ba1:	c3                   	ret
+
+0000000000800ba2 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800ba2:	55                   	push   %rbp
+  800ba3:	48 89 e5             	mov    %rsp,%rbp
+  800ba6:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800baa:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800bae:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800bb3:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800bb7:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800bbe:	48 85 ff             	test   %rdi,%rdi
+  800bc1:	74 2b                	je     800bee <vsnprintf+0x4c>
+  800bc3:	48 85 f6             	test   %rsi,%rsi
+  800bc6:	74 26                	je     800bee <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800bc8:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800bcc:	48 bf 46 04 80 00 00 	movabs $0x800446,%rdi
+  800bd3:	00 00 00 
+  800bd6:	48 b8 9b 04 80 00 00 	movabs $0x80049b,%rax
+  800bdd:	00 00 00 
+  800be0:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800be2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800be6:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800be9:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800bec:	c9                   	leave
+  800bed:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800bee:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800bf3:	eb f7                	jmp    800bec <vsnprintf+0x4a>
+
+0000000000800bf5 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800bf5:	55                   	push   %rbp
+  800bf6:	48 89 e5             	mov    %rsp,%rbp
+  800bf9:	48 83 ec 50          	sub    $0x50,%rsp
+  800bfd:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800c01:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800c05:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800c09:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800c10:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800c14:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c18:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800c1c:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800c20:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800c24:	48 b8 a2 0b 80 00 00 	movabs $0x800ba2,%rax
+  800c2b:	00 00 00 
+  800c2e:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800c30:	c9                   	leave
+  800c31:	c3                   	ret
+
+0000000000800c32 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800c32:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800c35:	74 10                	je     800c47 <strlen+0x15>
+    size_t n = 0;
+  800c37:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800c3c:	48 83 c0 01          	add    $0x1,%rax
+  800c40:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800c44:	75 f6                	jne    800c3c <strlen+0xa>
+  800c46:	c3                   	ret
+    size_t n = 0;
+  800c47:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800c4c:	c3                   	ret
+
+0000000000800c4d <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800c4d:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800c50:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800c55:	48 85 f6             	test   %rsi,%rsi
+  800c58:	74 11                	je     800c6b <strnlen+0x1e>
+  800c5a:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800c5e:	74 0c                	je     800c6c <strnlen+0x1f>
+  800c60:	48 83 c2 01          	add    $0x1,%rdx
+  800c64:	48 39 d0             	cmp    %rdx,%rax
+  800c67:	75 f1                	jne    800c5a <strnlen+0xd>
+  800c69:	eb 04                	jmp    800c6f <strnlen+0x22>
+  800c6b:	c3                   	ret
+  800c6c:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800c6f:	c3                   	ret
+
+0000000000800c70 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800c70:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800c73:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c78:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800c7c:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800c7f:	48 83 c2 01          	add    $0x1,%rdx
+  800c83:	84 c9                	test   %cl,%cl
+  800c85:	75 f1                	jne    800c78 <strcpy+0x8>
+        ;
+    return res;
+}
+  800c87:	c3                   	ret
+
+0000000000800c88 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800c88:	55                   	push   %rbp
+  800c89:	48 89 e5             	mov    %rsp,%rbp
+  800c8c:	41 54                	push   %r12
+  800c8e:	53                   	push   %rbx
+  800c8f:	48 89 fb             	mov    %rdi,%rbx
+  800c92:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800c95:	48 b8 32 0c 80 00 00 	movabs $0x800c32,%rax
+  800c9c:	00 00 00 
+  800c9f:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800ca1:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800ca5:	4c 89 e6             	mov    %r12,%rsi
+  800ca8:	48 b8 70 0c 80 00 00 	movabs $0x800c70,%rax
+  800caf:	00 00 00 
+  800cb2:	ff d0                	call   *%rax
+    return dst;
+}
+  800cb4:	48 89 d8             	mov    %rbx,%rax
+  800cb7:	5b                   	pop    %rbx
+  800cb8:	41 5c                	pop    %r12
+  800cba:	5d                   	pop    %rbp
+  800cbb:	c3                   	ret
+
+0000000000800cbc <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800cbc:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800cbf:	48 85 d2             	test   %rdx,%rdx
+  800cc2:	74 1f                	je     800ce3 <strncpy+0x27>
+  800cc4:	48 01 fa             	add    %rdi,%rdx
+  800cc7:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800cca:	48 83 c1 01          	add    $0x1,%rcx
+  800cce:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800cd2:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800cd6:	41 80 f8 01          	cmp    $0x1,%r8b
+  800cda:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800cde:	48 39 ca             	cmp    %rcx,%rdx
+  800ce1:	75 e7                	jne    800cca <strncpy+0xe>
+    }
+    return ret;
+}
+  800ce3:	c3                   	ret
+
+0000000000800ce4 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800ce4:	48 89 f8             	mov    %rdi,%rax
+  800ce7:	48 85 d2             	test   %rdx,%rdx
+  800cea:	74 24                	je     800d10 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800cec:	48 83 ea 01          	sub    $0x1,%rdx
+  800cf0:	74 1b                	je     800d0d <strlcpy+0x29>
+  800cf2:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800cf6:	0f b6 16             	movzbl (%rsi),%edx
+  800cf9:	84 d2                	test   %dl,%dl
+  800cfb:	74 10                	je     800d0d <strlcpy+0x29>
+            *dst++ = *src++;
+  800cfd:	48 83 c6 01          	add    $0x1,%rsi
+  800d01:	48 83 c0 01          	add    $0x1,%rax
+  800d05:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800d08:	48 39 c8             	cmp    %rcx,%rax
+  800d0b:	75 e9                	jne    800cf6 <strlcpy+0x12>
+        *dst = '\0';
+  800d0d:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800d10:	48 29 f8             	sub    %rdi,%rax
+}
+  800d13:	c3                   	ret
+
+0000000000800d14 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800d14:	0f b6 07             	movzbl (%rdi),%eax
+  800d17:	84 c0                	test   %al,%al
+  800d19:	74 13                	je     800d2e <strcmp+0x1a>
+  800d1b:	38 06                	cmp    %al,(%rsi)
+  800d1d:	75 0f                	jne    800d2e <strcmp+0x1a>
+  800d1f:	48 83 c7 01          	add    $0x1,%rdi
+  800d23:	48 83 c6 01          	add    $0x1,%rsi
+  800d27:	0f b6 07             	movzbl (%rdi),%eax
+  800d2a:	84 c0                	test   %al,%al
+  800d2c:	75 ed                	jne    800d1b <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800d2e:	0f b6 c0             	movzbl %al,%eax
+  800d31:	0f b6 16             	movzbl (%rsi),%edx
+  800d34:	29 d0                	sub    %edx,%eax
+}
+  800d36:	c3                   	ret
+
+0000000000800d37 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800d37:	48 85 d2             	test   %rdx,%rdx
+  800d3a:	74 1f                	je     800d5b <strncmp+0x24>
+  800d3c:	0f b6 07             	movzbl (%rdi),%eax
+  800d3f:	84 c0                	test   %al,%al
+  800d41:	74 1e                	je     800d61 <strncmp+0x2a>
+  800d43:	3a 06                	cmp    (%rsi),%al
+  800d45:	75 1a                	jne    800d61 <strncmp+0x2a>
+  800d47:	48 83 c7 01          	add    $0x1,%rdi
+  800d4b:	48 83 c6 01          	add    $0x1,%rsi
+  800d4f:	48 83 ea 01          	sub    $0x1,%rdx
+  800d53:	75 e7                	jne    800d3c <strncmp+0x5>
+
+    if (!n) return 0;
+  800d55:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d5a:	c3                   	ret
+  800d5b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d60:	c3                   	ret
+  800d61:	48 85 d2             	test   %rdx,%rdx
+  800d64:	74 09                	je     800d6f <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800d66:	0f b6 07             	movzbl (%rdi),%eax
+  800d69:	0f b6 16             	movzbl (%rsi),%edx
+  800d6c:	29 d0                	sub    %edx,%eax
+  800d6e:	c3                   	ret
+    if (!n) return 0;
+  800d6f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800d74:	c3                   	ret
+
+0000000000800d75 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800d75:	0f b6 17             	movzbl (%rdi),%edx
+  800d78:	84 d2                	test   %dl,%dl
+  800d7a:	74 18                	je     800d94 <strchr+0x1f>
+        if (*str == c) {
+  800d7c:	0f be d2             	movsbl %dl,%edx
+  800d7f:	39 f2                	cmp    %esi,%edx
+  800d81:	74 17                	je     800d9a <strchr+0x25>
+    for (; *str; str++) {
+  800d83:	48 83 c7 01          	add    $0x1,%rdi
+  800d87:	0f b6 17             	movzbl (%rdi),%edx
+  800d8a:	84 d2                	test   %dl,%dl
+  800d8c:	75 ee                	jne    800d7c <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800d8e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d93:	c3                   	ret
+  800d94:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d99:	c3                   	ret
+  800d9a:	48 89 f8             	mov    %rdi,%rax
+}
+  800d9d:	c3                   	ret
+
+0000000000800d9e <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800d9e:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800da1:	0f b6 17             	movzbl (%rdi),%edx
+  800da4:	84 d2                	test   %dl,%dl
+  800da6:	74 13                	je     800dbb <strfind+0x1d>
+  800da8:	0f be d2             	movsbl %dl,%edx
+  800dab:	39 f2                	cmp    %esi,%edx
+  800dad:	74 0b                	je     800dba <strfind+0x1c>
+  800daf:	48 83 c0 01          	add    $0x1,%rax
+  800db3:	0f b6 10             	movzbl (%rax),%edx
+  800db6:	84 d2                	test   %dl,%dl
+  800db8:	75 ee                	jne    800da8 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800dba:	c3                   	ret
+  800dbb:	c3                   	ret
+
+0000000000800dbc <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800dbc:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800dbf:	48 89 f8             	mov    %rdi,%rax
+  800dc2:	48 f7 d8             	neg    %rax
+  800dc5:	83 e0 07             	and    $0x7,%eax
+  800dc8:	49 89 d1             	mov    %rdx,%r9
+  800dcb:	49 29 c1             	sub    %rax,%r9
+  800dce:	78 36                	js     800e06 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800dd0:	40 0f b6 c6          	movzbl %sil,%eax
+  800dd4:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800ddb:	01 01 01 
+  800dde:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800de2:	40 f6 c7 07          	test   $0x7,%dil
+  800de6:	75 38                	jne    800e20 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800de8:	4c 89 c9             	mov    %r9,%rcx
+  800deb:	48 c1 f9 03          	sar    $0x3,%rcx
+  800def:	74 0c                	je     800dfd <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800df1:	fc                   	cld
+  800df2:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800df5:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800df9:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800dfd:	4d 85 c9             	test   %r9,%r9
+  800e00:	75 45                	jne    800e47 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800e02:	4c 89 c0             	mov    %r8,%rax
+  800e05:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800e06:	48 85 d2             	test   %rdx,%rdx
+  800e09:	74 f7                	je     800e02 <memset+0x46>
+  800e0b:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800e0e:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800e11:	48 83 c0 01          	add    $0x1,%rax
+  800e15:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  800e19:	48 39 c2             	cmp    %rax,%rdx
+  800e1c:	75 f3                	jne    800e11 <memset+0x55>
+  800e1e:	eb e2                	jmp    800e02 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  800e20:	40 f6 c7 01          	test   $0x1,%dil
+  800e24:	74 06                	je     800e2c <memset+0x70>
+  800e26:	88 07                	mov    %al,(%rdi)
+  800e28:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800e2c:	40 f6 c7 02          	test   $0x2,%dil
+  800e30:	74 07                	je     800e39 <memset+0x7d>
+  800e32:	66 89 07             	mov    %ax,(%rdi)
+  800e35:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800e39:	40 f6 c7 04          	test   $0x4,%dil
+  800e3d:	74 a9                	je     800de8 <memset+0x2c>
+  800e3f:	89 07                	mov    %eax,(%rdi)
+  800e41:	48 83 c7 04          	add    $0x4,%rdi
+  800e45:	eb a1                	jmp    800de8 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800e47:	41 f6 c1 04          	test   $0x4,%r9b
+  800e4b:	74 06                	je     800e53 <memset+0x97>
+  800e4d:	89 07                	mov    %eax,(%rdi)
+  800e4f:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800e53:	41 f6 c1 02          	test   $0x2,%r9b
+  800e57:	74 07                	je     800e60 <memset+0xa4>
+  800e59:	66 89 07             	mov    %ax,(%rdi)
+  800e5c:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  800e60:	41 f6 c1 01          	test   $0x1,%r9b
+  800e64:	74 9c                	je     800e02 <memset+0x46>
+  800e66:	88 07                	mov    %al,(%rdi)
+  800e68:	eb 98                	jmp    800e02 <memset+0x46>
+
+0000000000800e6a <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  800e6a:	48 89 f8             	mov    %rdi,%rax
+  800e6d:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  800e70:	48 39 fe             	cmp    %rdi,%rsi
+  800e73:	73 3b                	jae    800eb0 <memmove+0x46>
+  800e75:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  800e79:	48 39 d7             	cmp    %rdx,%rdi
+  800e7c:	73 32                	jae    800eb0 <memmove+0x46>
+        s += n;
+        d += n;
+  800e7e:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800e82:	48 89 d6             	mov    %rdx,%rsi
+  800e85:	48 09 fe             	or     %rdi,%rsi
+  800e88:	48 09 ce             	or     %rcx,%rsi
+  800e8b:	40 f6 c6 07          	test   $0x7,%sil
+  800e8f:	75 12                	jne    800ea3 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  800e91:	48 83 ef 08          	sub    $0x8,%rdi
+  800e95:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  800e99:	48 c1 e9 03          	shr    $0x3,%rcx
+  800e9d:	fd                   	std
+  800e9e:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  800ea1:	fc                   	cld
+  800ea2:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  800ea3:	48 83 ef 01          	sub    $0x1,%rdi
+  800ea7:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  800eab:	fd                   	std
+  800eac:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  800eae:	eb f1                	jmp    800ea1 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800eb0:	48 89 f2             	mov    %rsi,%rdx
+  800eb3:	48 09 c2             	or     %rax,%rdx
+  800eb6:	48 09 ca             	or     %rcx,%rdx
+  800eb9:	f6 c2 07             	test   $0x7,%dl
+  800ebc:	75 0c                	jne    800eca <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  800ebe:	48 c1 e9 03          	shr    $0x3,%rcx
+  800ec2:	48 89 c7             	mov    %rax,%rdi
+  800ec5:	fc                   	cld
+  800ec6:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  800ec9:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  800eca:	48 89 c7             	mov    %rax,%rdi
+  800ecd:	fc                   	cld
+  800ece:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  800ed0:	c3                   	ret
+
+0000000000800ed1 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  800ed1:	55                   	push   %rbp
+  800ed2:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  800ed5:	48 b8 6a 0e 80 00 00 	movabs $0x800e6a,%rax
+  800edc:	00 00 00 
+  800edf:	ff d0                	call   *%rax
+}
+  800ee1:	5d                   	pop    %rbp
+  800ee2:	c3                   	ret
+
+0000000000800ee3 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  800ee3:	55                   	push   %rbp
+  800ee4:	48 89 e5             	mov    %rsp,%rbp
+  800ee7:	41 57                	push   %r15
+  800ee9:	41 56                	push   %r14
+  800eeb:	41 55                	push   %r13
+  800eed:	41 54                	push   %r12
+  800eef:	53                   	push   %rbx
+  800ef0:	48 83 ec 08          	sub    $0x8,%rsp
+  800ef4:	49 89 fe             	mov    %rdi,%r14
+  800ef7:	49 89 f7             	mov    %rsi,%r15
+  800efa:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  800efd:	48 89 f7             	mov    %rsi,%rdi
+  800f00:	48 b8 32 0c 80 00 00 	movabs $0x800c32,%rax
+  800f07:	00 00 00 
+  800f0a:	ff d0                	call   *%rax
+  800f0c:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  800f0f:	48 89 de             	mov    %rbx,%rsi
+  800f12:	4c 89 f7             	mov    %r14,%rdi
+  800f15:	48 b8 4d 0c 80 00 00 	movabs $0x800c4d,%rax
+  800f1c:	00 00 00 
+  800f1f:	ff d0                	call   *%rax
+  800f21:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  800f24:	48 39 c3             	cmp    %rax,%rbx
+  800f27:	74 36                	je     800f5f <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  800f29:	48 89 d8             	mov    %rbx,%rax
+  800f2c:	4c 29 e8             	sub    %r13,%rax
+  800f2f:	49 39 c4             	cmp    %rax,%r12
+  800f32:	73 31                	jae    800f65 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  800f34:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  800f39:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800f3d:	4c 89 fe             	mov    %r15,%rsi
+  800f40:	48 b8 d1 0e 80 00 00 	movabs $0x800ed1,%rax
+  800f47:	00 00 00 
+  800f4a:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  800f4c:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  800f50:	48 83 c4 08          	add    $0x8,%rsp
+  800f54:	5b                   	pop    %rbx
+  800f55:	41 5c                	pop    %r12
+  800f57:	41 5d                	pop    %r13
+  800f59:	41 5e                	pop    %r14
+  800f5b:	41 5f                	pop    %r15
+  800f5d:	5d                   	pop    %rbp
+  800f5e:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  800f5f:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800f63:	eb eb                	jmp    800f50 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  800f65:	48 83 eb 01          	sub    $0x1,%rbx
+  800f69:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800f6d:	48 89 da             	mov    %rbx,%rdx
+  800f70:	4c 89 fe             	mov    %r15,%rsi
+  800f73:	48 b8 d1 0e 80 00 00 	movabs $0x800ed1,%rax
+  800f7a:	00 00 00 
+  800f7d:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  800f7f:	49 01 de             	add    %rbx,%r14
+  800f82:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  800f87:	eb c3                	jmp    800f4c <strlcat+0x69>
+
+0000000000800f89 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  800f89:	48 85 d2             	test   %rdx,%rdx
+  800f8c:	74 2d                	je     800fbb <memcmp+0x32>
+  800f8e:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  800f93:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800f97:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  800f9c:	44 38 c1             	cmp    %r8b,%cl
+  800f9f:	75 0f                	jne    800fb0 <memcmp+0x27>
+    while (n-- > 0) {
+  800fa1:	48 83 c0 01          	add    $0x1,%rax
+  800fa5:	48 39 c2             	cmp    %rax,%rdx
+  800fa8:	75 e9                	jne    800f93 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  800faa:	b8 00 00 00 00       	mov    $0x0,%eax
+  800faf:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  800fb0:	0f b6 c1             	movzbl %cl,%eax
+  800fb3:	45 0f b6 c0          	movzbl %r8b,%r8d
+  800fb7:	44 29 c0             	sub    %r8d,%eax
+  800fba:	c3                   	ret
+    return 0;
+  800fbb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800fc0:	c3                   	ret
+
+0000000000800fc1 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  800fc1:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  800fc5:	48 39 c7             	cmp    %rax,%rdi
+  800fc8:	73 0f                	jae    800fd9 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  800fca:	40 38 37             	cmp    %sil,(%rdi)
+  800fcd:	74 0e                	je     800fdd <memfind+0x1c>
+    for (; src < end; src++) {
+  800fcf:	48 83 c7 01          	add    $0x1,%rdi
+  800fd3:	48 39 f8             	cmp    %rdi,%rax
+  800fd6:	75 f2                	jne    800fca <memfind+0x9>
+  800fd8:	c3                   	ret
+  800fd9:	48 89 f8             	mov    %rdi,%rax
+  800fdc:	c3                   	ret
+  800fdd:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  800fe0:	c3                   	ret
+
+0000000000800fe1 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  800fe1:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  800fe4:	0f b6 37             	movzbl (%rdi),%esi
+  800fe7:	40 80 fe 20          	cmp    $0x20,%sil
+  800feb:	74 06                	je     800ff3 <strtol+0x12>
+  800fed:	40 80 fe 09          	cmp    $0x9,%sil
+  800ff1:	75 13                	jne    801006 <strtol+0x25>
+  800ff3:	48 83 c7 01          	add    $0x1,%rdi
+  800ff7:	0f b6 37             	movzbl (%rdi),%esi
+  800ffa:	40 80 fe 20          	cmp    $0x20,%sil
+  800ffe:	74 f3                	je     800ff3 <strtol+0x12>
+  801000:	40 80 fe 09          	cmp    $0x9,%sil
+  801004:	74 ed                	je     800ff3 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  801006:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  801009:	83 e0 fd             	and    $0xfffffffd,%eax
+  80100c:	3c 01                	cmp    $0x1,%al
+  80100e:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801012:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  801018:	75 0f                	jne    801029 <strtol+0x48>
+  80101a:	80 3f 30             	cmpb   $0x30,(%rdi)
+  80101d:	74 14                	je     801033 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  80101f:	85 d2                	test   %edx,%edx
+  801021:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801026:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  801029:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  80102e:	4c 63 ca             	movslq %edx,%r9
+  801031:	eb 36                	jmp    801069 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801033:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  801037:	74 0f                	je     801048 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  801039:	85 d2                	test   %edx,%edx
+  80103b:	75 ec                	jne    801029 <strtol+0x48>
+        s++;
+  80103d:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  801041:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  801046:	eb e1                	jmp    801029 <strtol+0x48>
+        s += 2;
+  801048:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  80104c:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  801051:	eb d6                	jmp    801029 <strtol+0x48>
+            dig -= '0';
+  801053:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  801056:	44 0f b6 c1          	movzbl %cl,%r8d
+  80105a:	41 39 d0             	cmp    %edx,%r8d
+  80105d:	7d 21                	jge    801080 <strtol+0x9f>
+        val = val * base + dig;
+  80105f:	49 0f af c1          	imul   %r9,%rax
+  801063:	0f b6 c9             	movzbl %cl,%ecx
+  801066:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  801069:	48 83 c7 01          	add    $0x1,%rdi
+  80106d:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  801071:	80 f9 39             	cmp    $0x39,%cl
+  801074:	76 dd                	jbe    801053 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  801076:	80 f9 7b             	cmp    $0x7b,%cl
+  801079:	77 05                	ja     801080 <strtol+0x9f>
+            dig -= 'a' - 10;
+  80107b:	83 e9 57             	sub    $0x57,%ecx
+  80107e:	eb d6                	jmp    801056 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  801080:	4d 85 d2             	test   %r10,%r10
+  801083:	74 03                	je     801088 <strtol+0xa7>
+  801085:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  801088:	48 89 c2             	mov    %rax,%rdx
+  80108b:	48 f7 da             	neg    %rdx
+  80108e:	40 80 fe 2d          	cmp    $0x2d,%sil
+  801092:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  801096:	c3                   	ret
+
+0000000000801097 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  801097:	55                   	push   %rbp
+  801098:	48 89 e5             	mov    %rsp,%rbp
+  80109b:	53                   	push   %rbx
+  80109c:	48 89 fa             	mov    %rdi,%rdx
+  80109f:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8010a2:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8010a7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010ac:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8010b1:	be 00 00 00 00       	mov    $0x0,%esi
+  8010b6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8010bc:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  8010be:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8010c2:	c9                   	leave
+  8010c3:	c3                   	ret
+
+00000000008010c4 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  8010c4:	55                   	push   %rbp
+  8010c5:	48 89 e5             	mov    %rsp,%rbp
+  8010c8:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8010c9:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8010ce:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010d3:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8010d8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010dd:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8010e2:	be 00 00 00 00       	mov    $0x0,%esi
+  8010e7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8010ed:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  8010ef:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8010f3:	c9                   	leave
+  8010f4:	c3                   	ret
+
+00000000008010f5 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  8010f5:	55                   	push   %rbp
+  8010f6:	48 89 e5             	mov    %rsp,%rbp
+  8010f9:	53                   	push   %rbx
+  8010fa:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  8010fe:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801101:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801106:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80110b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801110:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801115:	be 00 00 00 00       	mov    $0x0,%esi
+  80111a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801120:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801122:	48 85 c0             	test   %rax,%rax
+  801125:	7f 06                	jg     80112d <sys_env_destroy+0x38>
+}
+  801127:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80112b:	c9                   	leave
+  80112c:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80112d:	49 89 c0             	mov    %rax,%r8
+  801130:	b9 03 00 00 00       	mov    $0x3,%ecx
+  801135:	48 ba 50 36 80 00 00 	movabs $0x803650,%rdx
+  80113c:	00 00 00 
+  80113f:	be 26 00 00 00       	mov    $0x26,%esi
+  801144:	48 bf 6f 36 80 00 00 	movabs $0x80366f,%rdi
+  80114b:	00 00 00 
+  80114e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801153:	49 b9 fb 01 80 00 00 	movabs $0x8001fb,%r9
+  80115a:	00 00 00 
+  80115d:	41 ff d1             	call   *%r9
+
+0000000000801160 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  801160:	55                   	push   %rbp
+  801161:	48 89 e5             	mov    %rsp,%rbp
+  801164:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801165:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80116a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80116f:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801174:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801179:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80117e:	be 00 00 00 00       	mov    $0x0,%esi
+  801183:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801189:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  80118b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80118f:	c9                   	leave
+  801190:	c3                   	ret
+
+0000000000801191 <sys_yield>:
+
+void
+sys_yield(void) {
+  801191:	55                   	push   %rbp
+  801192:	48 89 e5             	mov    %rsp,%rbp
+  801195:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801196:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80119b:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011a0:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8011a5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011aa:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8011af:	be 00 00 00 00       	mov    $0x0,%esi
+  8011b4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8011ba:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  8011bc:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8011c0:	c9                   	leave
+  8011c1:	c3                   	ret
+
+00000000008011c2 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  8011c2:	55                   	push   %rbp
+  8011c3:	48 89 e5             	mov    %rsp,%rbp
+  8011c6:	53                   	push   %rbx
+  8011c7:	48 89 fa             	mov    %rdi,%rdx
+  8011ca:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8011cd:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8011d2:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  8011d9:	00 00 00 
+  8011dc:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8011e1:	be 00 00 00 00       	mov    $0x0,%esi
+  8011e6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8011ec:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  8011ee:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8011f2:	c9                   	leave
+  8011f3:	c3                   	ret
+
+00000000008011f4 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  8011f4:	55                   	push   %rbp
+  8011f5:	48 89 e5             	mov    %rsp,%rbp
+  8011f8:	53                   	push   %rbx
+  8011f9:	49 89 f8             	mov    %rdi,%r8
+  8011fc:	48 89 d3             	mov    %rdx,%rbx
+  8011ff:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801202:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801207:	4c 89 c2             	mov    %r8,%rdx
+  80120a:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80120d:	be 00 00 00 00       	mov    $0x0,%esi
+  801212:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801218:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  80121a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80121e:	c9                   	leave
+  80121f:	c3                   	ret
+
+0000000000801220 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  801220:	55                   	push   %rbp
+  801221:	48 89 e5             	mov    %rsp,%rbp
+  801224:	53                   	push   %rbx
+  801225:	48 83 ec 08          	sub    $0x8,%rsp
+  801229:	89 f8                	mov    %edi,%eax
+  80122b:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  80122e:	48 63 f9             	movslq %ecx,%rdi
+  801231:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801234:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801239:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80123c:	be 00 00 00 00       	mov    $0x0,%esi
+  801241:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801247:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801249:	48 85 c0             	test   %rax,%rax
+  80124c:	7f 06                	jg     801254 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  80124e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801252:	c9                   	leave
+  801253:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801254:	49 89 c0             	mov    %rax,%r8
+  801257:	b9 04 00 00 00       	mov    $0x4,%ecx
+  80125c:	48 ba 50 36 80 00 00 	movabs $0x803650,%rdx
+  801263:	00 00 00 
+  801266:	be 26 00 00 00       	mov    $0x26,%esi
+  80126b:	48 bf 6f 36 80 00 00 	movabs $0x80366f,%rdi
+  801272:	00 00 00 
+  801275:	b8 00 00 00 00       	mov    $0x0,%eax
+  80127a:	49 b9 fb 01 80 00 00 	movabs $0x8001fb,%r9
+  801281:	00 00 00 
+  801284:	41 ff d1             	call   *%r9
+
+0000000000801287 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801287:	55                   	push   %rbp
+  801288:	48 89 e5             	mov    %rsp,%rbp
+  80128b:	53                   	push   %rbx
+  80128c:	48 83 ec 08          	sub    $0x8,%rsp
+  801290:	89 f8                	mov    %edi,%eax
+  801292:	49 89 f2             	mov    %rsi,%r10
+  801295:	48 89 cf             	mov    %rcx,%rdi
+  801298:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  80129b:	48 63 da             	movslq %edx,%rbx
+  80129e:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8012a1:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8012a6:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012a9:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  8012ac:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8012ae:	48 85 c0             	test   %rax,%rax
+  8012b1:	7f 06                	jg     8012b9 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8012b3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012b7:	c9                   	leave
+  8012b8:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8012b9:	49 89 c0             	mov    %rax,%r8
+  8012bc:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8012c1:	48 ba 50 36 80 00 00 	movabs $0x803650,%rdx
+  8012c8:	00 00 00 
+  8012cb:	be 26 00 00 00       	mov    $0x26,%esi
+  8012d0:	48 bf 6f 36 80 00 00 	movabs $0x80366f,%rdi
+  8012d7:	00 00 00 
+  8012da:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012df:	49 b9 fb 01 80 00 00 	movabs $0x8001fb,%r9
+  8012e6:	00 00 00 
+  8012e9:	41 ff d1             	call   *%r9
+
+00000000008012ec <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  8012ec:	55                   	push   %rbp
+  8012ed:	48 89 e5             	mov    %rsp,%rbp
+  8012f0:	53                   	push   %rbx
+  8012f1:	48 83 ec 08          	sub    $0x8,%rsp
+  8012f5:	48 89 f1             	mov    %rsi,%rcx
+  8012f8:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  8012fb:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8012fe:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801303:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801308:	be 00 00 00 00       	mov    $0x0,%esi
+  80130d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801313:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801315:	48 85 c0             	test   %rax,%rax
+  801318:	7f 06                	jg     801320 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  80131a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80131e:	c9                   	leave
+  80131f:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801320:	49 89 c0             	mov    %rax,%r8
+  801323:	b9 06 00 00 00       	mov    $0x6,%ecx
+  801328:	48 ba 50 36 80 00 00 	movabs $0x803650,%rdx
+  80132f:	00 00 00 
+  801332:	be 26 00 00 00       	mov    $0x26,%esi
+  801337:	48 bf 6f 36 80 00 00 	movabs $0x80366f,%rdi
+  80133e:	00 00 00 
+  801341:	b8 00 00 00 00       	mov    $0x0,%eax
+  801346:	49 b9 fb 01 80 00 00 	movabs $0x8001fb,%r9
+  80134d:	00 00 00 
+  801350:	41 ff d1             	call   *%r9
+
+0000000000801353 <sys_region_batch>:
+
+int
+sys_region_batch(const struct RegionOp *ops, size_t count) {
+  801353:	55                   	push   %rbp
+  801354:	48 89 e5             	mov    %rsp,%rbp
+  801357:	53                   	push   %rbx
+  801358:	48 83 ec 08          	sub    $0x8,%rsp
+  80135c:	48 89 fa             	mov    %rdi,%rdx
+  80135f:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801362:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801367:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80136c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801371:	be 00 00 00 00       	mov    $0x0,%esi
+  801376:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80137c:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80137e:	48 85 c0             	test   %rax,%rax
+  801381:	7f 06                	jg     801389 <sys_region_batch+0x36>
+        else
+            platform_asan_unpoison(va, ops[i].size);
+    }
+#endif
+    return res;
+}
+  801383:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801387:	c9                   	leave
+  801388:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801389:	49 89 c0             	mov    %rax,%r8
+  80138c:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  801391:	48 ba 50 36 80 00 00 	movabs $0x803650,%rdx
+  801398:	00 00 00 
+  80139b:	be 26 00 00 00       	mov    $0x26,%esi
+  8013a0:	48 bf 6f 36 80 00 00 	movabs $0x80366f,%rdi
+  8013a7:	00 00 00 
+  8013aa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013af:	49 b9 fb 01 80 00 00 	movabs $0x8001fb,%r9
+  8013b6:	00 00 00 
+  8013b9:	41 ff d1             	call   *%r9
+
+00000000008013bc <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  8013bc:	55                   	push   %rbp
+  8013bd:	48 89 e5             	mov    %rsp,%rbp
+  8013c0:	53                   	push   %rbx
+  8013c1:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  8013c5:	48 63 ce             	movslq %esi,%rcx
+  8013c8:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8013cb:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8013d0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013d5:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013da:	be 00 00 00 00       	mov    $0x0,%esi
+  8013df:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013e5:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8013e7:	48 85 c0             	test   %rax,%rax
+  8013ea:	7f 06                	jg     8013f2 <sys_env_set_status+0x36>
+}
+  8013ec:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013f0:	c9                   	leave
+  8013f1:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8013f2:	49 89 c0             	mov    %rax,%r8
+  8013f5:	b9 09 00 00 00       	mov    $0x9,%ecx
+  8013fa:	48 ba 50 36 80 00 00 	movabs $0x803650,%rdx
+  801401:	00 00 00 
+  801404:	be 26 00 00 00       	mov    $0x26,%esi
+  801409:	48 bf 6f 36 80 00 00 	movabs $0x80366f,%rdi
+  801410:	00 00 00 
+  801413:	b8 00 00 00 00       	mov    $0x0,%eax
+  801418:	49 b9 fb 01 80 00 00 	movabs $0x8001fb,%r9
+  80141f:	00 00 00 
+  801422:	41 ff d1             	call   *%r9
+
+0000000000801425 <sys_env_set_weight>:
+
+int
+sys_env_set_weight(envid_t envid, uint32_t weight) {
+  801425:	55                   	push   %rbp
+  801426:	48 89 e5             	mov    %rsp,%rbp
+  801429:	53                   	push   %rbx
+  80142a:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_weight, 1, envid, weight, 0, 0, 0, 0);
+  80142e:	89 f1                	mov    %esi,%ecx
+  801430:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801433:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801438:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80143d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801442:	be 00 00 00 00       	mov    $0x0,%esi
+  801447:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80144d:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80144f:	48 85 c0             	test   %rax,%rax
+  801452:	7f 06                	jg     80145a <sys_env_set_weight+0x35>
+}
+  801454:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801458:	c9                   	leave
+  801459:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80145a:	49 89 c0             	mov    %rax,%r8
+  80145d:	b9 10 00 00 00       	mov    $0x10,%ecx
+  801462:	48 ba 50 36 80 00 00 	movabs $0x803650,%rdx
+  801469:	00 00 00 
+  80146c:	be 26 00 00 00       	mov    $0x26,%esi
+  801471:	48 bf 6f 36 80 00 00 	movabs $0x80366f,%rdi
+  801478:	00 00 00 
+  80147b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801480:	49 b9 fb 01 80 00 00 	movabs $0x8001fb,%r9
+  801487:	00 00 00 
+  80148a:	41 ff d1             	call   *%r9
+
+000000000080148d <sys_env_set_rt>:
+
+int
+sys_env_set_rt(envid_t envid, uint64_t period, uint64_t budget, uint64_t deadline) {
+  80148d:	55                   	push   %rbp
+  80148e:	48 89 e5             	mov    %rsp,%rbp
+  801491:	53                   	push   %rbx
+  801492:	48 83 ec 08          	sub    $0x8,%rsp
+  801496:	89 f8                	mov    %edi,%eax
+  801498:	48 89 d3             	mov    %rdx,%rbx
+  80149b:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_env_set_rt, 1, envid, period, budget, deadline, 0, 0);
+  80149e:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8014a1:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8014a6:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014a9:	be 00 00 00 00       	mov    $0x0,%esi
+  8014ae:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014b4:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8014b6:	48 85 c0             	test   %rax,%rax
+  8014b9:	7f 06                	jg     8014c1 <sys_env_set_rt+0x34>
+}
+  8014bb:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014bf:	c9                   	leave
+  8014c0:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8014c1:	49 89 c0             	mov    %rax,%r8
+  8014c4:	b9 11 00 00 00       	mov    $0x11,%ecx
+  8014c9:	48 ba 50 36 80 00 00 	movabs $0x803650,%rdx
+  8014d0:	00 00 00 
+  8014d3:	be 26 00 00 00       	mov    $0x26,%esi
+  8014d8:	48 bf 6f 36 80 00 00 	movabs $0x80366f,%rdi
+  8014df:	00 00 00 
+  8014e2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014e7:	49 b9 fb 01 80 00 00 	movabs $0x8001fb,%r9
+  8014ee:	00 00 00 
+  8014f1:	41 ff d1             	call   *%r9
+
+00000000008014f4 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  8014f4:	55                   	push   %rbp
+  8014f5:	48 89 e5             	mov    %rsp,%rbp
+  8014f8:	53                   	push   %rbx
+  8014f9:	48 83 ec 08          	sub    $0x8,%rsp
+  8014fd:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  801500:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801503:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801508:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80150d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801512:	be 00 00 00 00       	mov    $0x0,%esi
+  801517:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80151d:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80151f:	48 85 c0             	test   %rax,%rax
+  801522:	7f 06                	jg     80152a <sys_env_set_trapframe+0x36>
+}
+  801524:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801528:	c9                   	leave
+  801529:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80152a:	49 89 c0             	mov    %rax,%r8
+  80152d:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  801532:	48 ba 50 36 80 00 00 	movabs $0x803650,%rdx
+  801539:	00 00 00 
+  80153c:	be 26 00 00 00       	mov    $0x26,%esi
+  801541:	48 bf 6f 36 80 00 00 	movabs $0x80366f,%rdi
+  801548:	00 00 00 
+  80154b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801550:	49 b9 fb 01 80 00 00 	movabs $0x8001fb,%r9
+  801557:	00 00 00 
+  80155a:	41 ff d1             	call   *%r9
+
+000000000080155d <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  80155d:	55                   	push   %rbp
+  80155e:	48 89 e5             	mov    %rsp,%rbp
+  801561:	53                   	push   %rbx
+  801562:	48 83 ec 08          	sub    $0x8,%rsp
+  801566:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  801569:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80156c:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801571:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801576:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80157b:	be 00 00 00 00       	mov    $0x0,%esi
+  801580:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801586:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801588:	48 85 c0             	test   %rax,%rax
+  80158b:	7f 06                	jg     801593 <sys_env_set_pgfault_upcall+0x36>
+}
+  80158d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801591:	c9                   	leave
+  801592:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801593:	49 89 c0             	mov    %rax,%r8
+  801596:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  80159b:	48 ba 50 36 80 00 00 	movabs $0x803650,%rdx
+  8015a2:	00 00 00 
+  8015a5:	be 26 00 00 00       	mov    $0x26,%esi
+  8015aa:	48 bf 6f 36 80 00 00 	movabs $0x80366f,%rdi
+  8015b1:	00 00 00 
+  8015b4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015b9:	49 b9 fb 01 80 00 00 	movabs $0x8001fb,%r9
+  8015c0:	00 00 00 
+  8015c3:	41 ff d1             	call   *%r9
+
+00000000008015c6 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  8015c6:	55                   	push   %rbp
+  8015c7:	48 89 e5             	mov    %rsp,%rbp
+  8015ca:	53                   	push   %rbx
+  8015cb:	89 f8                	mov    %edi,%eax
+  8015cd:	49 89 f1             	mov    %rsi,%r9
+  8015d0:	48 89 d3             	mov    %rdx,%rbx
+  8015d3:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  8015d6:	49 63 f0             	movslq %r8d,%rsi
+  8015d9:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8015dc:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8015e1:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015e4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015ea:	cd 30                	int    $0x30
+}
+  8015ec:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015f0:	c9                   	leave
+  8015f1:	c3                   	ret
+
+00000000008015f2 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  8015f2:	55                   	push   %rbp
+  8015f3:	48 89 e5             	mov    %rsp,%rbp
+  8015f6:	53                   	push   %rbx
+  8015f7:	48 83 ec 08          	sub    $0x8,%rsp
+  8015fb:	48 89 fa             	mov    %rdi,%rdx
+  8015fe:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801601:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801606:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80160b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801610:	be 00 00 00 00       	mov    $0x0,%esi
+  801615:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80161b:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80161d:	48 85 c0             	test   %rax,%rax
+  801620:	7f 06                	jg     801628 <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801622:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801626:	c9                   	leave
+  801627:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801628:	49 89 c0             	mov    %rax,%r8
+  80162b:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  801630:	48 ba 50 36 80 00 00 	movabs $0x803650,%rdx
+  801637:	00 00 00 
+  80163a:	be 26 00 00 00       	mov    $0x26,%esi
+  80163f:	48 bf 6f 36 80 00 00 	movabs $0x80366f,%rdi
+  801646:	00 00 00 
+  801649:	b8 00 00 00 00       	mov    $0x0,%eax
+  80164e:	49 b9 fb 01 80 00 00 	movabs $0x8001fb,%r9
+  801655:	00 00 00 
+  801658:	41 ff d1             	call   *%r9
+
+000000000080165b <_handle_vectored_pagefault>:
+/* Vector size */
+static size_t _pfhandler_off = 0;
+static bool _pfhandler_inititiallized = 0;
+
+void
+_handle_vectored_pagefault(struct UTrapframe *utf) {
+  80165b:	55                   	push   %rbp
+  80165c:	48 89 e5             	mov    %rsp,%rbp
+  80165f:	41 56                	push   %r14
+  801661:	41 55                	push   %r13
+  801663:	41 54                	push   %r12
+  801665:	53                   	push   %rbx
+  801666:	49 89 fc             	mov    %rdi,%r12
+    /* This trying to handle pagefault until
+     * some handler returns 1, that indicates
+     * successfully handled exception */
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  801669:	48 b8 68 50 80 00 00 	movabs $0x805068,%rax
+  801670:	00 00 00 
+  801673:	48 83 38 00          	cmpq   $0x0,(%rax)
+  801677:	74 27                	je     8016a0 <_handle_vectored_pagefault+0x45>
+  801679:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (_pfhandler_vec[i](utf)) return;
+  80167e:	49 bd 20 50 80 00 00 	movabs $0x805020,%r13
+  801685:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  801688:	49 89 c6             	mov    %rax,%r14
+        if (_pfhandler_vec[i](utf)) return;
+  80168b:	4c 89 e7             	mov    %r12,%rdi
+  80168e:	41 ff 54 dd 00       	call   *0x0(%r13,%rbx,8)
+  801693:	84 c0                	test   %al,%al
+  801695:	75 45                	jne    8016dc <_handle_vectored_pagefault+0x81>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  801697:	48 83 c3 01          	add    $0x1,%rbx
+  80169b:	49 3b 1e             	cmp    (%r14),%rbx
+  80169e:	72 eb                	jb     80168b <_handle_vectored_pagefault+0x30>
+
+    /* Unhandled exceptions just cause panic */
+    panic("Userspace page fault rip=%08lX va=%08lX err=%x\n",
+  8016a0:	49 8b 8c 24 88 00 00 	mov    0x88(%r12),%rcx
+  8016a7:	00 
+  8016a8:	45 8b 4c 24 08       	mov    0x8(%r12),%r9d
+  8016ad:	4d 8b 04 24          	mov    (%r12),%r8
+  8016b1:	48 ba 80 36 80 00 00 	movabs $0x803680,%rdx
+  8016b8:	00 00 00 
+  8016bb:	be 1d 00 00 00       	mov    $0x1d,%esi
+  8016c0:	48 bf b0 36 80 00 00 	movabs $0x8036b0,%rdi
+  8016c7:	00 00 00 
+  8016ca:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016cf:	49 ba fb 01 80 00 00 	movabs $0x8001fb,%r10
+  8016d6:	00 00 00 
+  8016d9:	41 ff d2             	call   *%r10
+          utf->utf_rip, utf->utf_fault_va, (int)utf->utf_err);
+}
+  8016dc:	5b                   	pop    %rbx
+  8016dd:	41 5c                	pop    %r12
+  8016df:	41 5d                	pop    %r13
+  8016e1:	41 5e                	pop    %r14
+  8016e3:	5d                   	pop    %rbp
+  8016e4:	c3                   	ret
+
+00000000008016e5 <add_pgfault_handler>:
+ * The first time we register a handler, we need to
+ * allocate an exception stack (one page of memory with its top
+ * at USER_EXCEPTION_STACK_TOP), and tell the kernel to call the assembly-language
+ * _pgfault_upcall routine when a page fault occurs. */
+int
+add_pgfault_handler(pf_handler_t handler) {
+  8016e5:	55                   	push   %rbp
+  8016e6:	48 89 e5             	mov    %rsp,%rbp
+  8016e9:	53                   	push   %rbx
+  8016ea:	48 83 ec 08          	sub    $0x8,%rsp
+  8016ee:	48 89 fb             	mov    %rdi,%rbx
+    int res = 0;
+  8016f1:	be 00 00 00 00       	mov    $0x0,%esi
+    if (!_pfhandler_inititiallized) {
+  8016f6:	48 b8 60 50 80 00 00 	movabs $0x805060,%rax
+  8016fd:	00 00 00 
+  801700:	80 38 00             	cmpb   $0x0,(%rax)
+  801703:	74 68                	je     80176d <add_pgfault_handler+0x88>
+            goto end;
+        }
+        _pfhandler_inititiallized = 1;
+    }
+
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  801705:	48 b8 68 50 80 00 00 	movabs $0x805068,%rax
+  80170c:	00 00 00 
+  80170f:	48 8b 08             	mov    (%rax),%rcx
+  801712:	ba 00 00 00 00       	mov    $0x0,%edx
+        if (handler == _pfhandler_vec[i]) return 0;
+  801717:	48 b8 20 50 80 00 00 	movabs $0x805020,%rax
+  80171e:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  801721:	48 85 c9             	test   %rcx,%rcx
+  801724:	0f 84 e0 00 00 00    	je     80180a <add_pgfault_handler+0x125>
+        if (handler == _pfhandler_vec[i]) return 0;
+  80172a:	48 39 1c d0          	cmp    %rbx,(%rax,%rdx,8)
+  80172e:	0f 84 c9 00 00 00    	je     8017fd <add_pgfault_handler+0x118>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  801734:	48 83 c2 01          	add    $0x1,%rdx
+  801738:	48 39 ca             	cmp    %rcx,%rdx
+  80173b:	75 ed                	jne    80172a <add_pgfault_handler+0x45>
+
+    if (_pfhandler_off == MAX_PFHANDLER)
+  80173d:	48 83 f9 08          	cmp    $0x8,%rcx
+  801741:	0f 84 84 00 00 00    	je     8017cb <add_pgfault_handler+0xe6>
+        res = -E_INVAL;
+    else
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  801747:	48 8d 41 01          	lea    0x1(%rcx),%rax
+  80174b:	48 a3 68 50 80 00 00 	movabs %rax,0x805068
+  801752:	00 00 00 
+  801755:	48 b8 20 50 80 00 00 	movabs $0x805020,%rax
+  80175c:	00 00 00 
+  80175f:	48 89 1c c8          	mov    %rbx,(%rax,%rcx,8)
+
+end:
+    if (res < 0) {
+  801763:	85 f6                	test   %esi,%esi
+  801765:	0f 89 97 00 00 00    	jns    801802 <add_pgfault_handler+0x11d>
+  80176b:	eb 63                	jmp    8017d0 <add_pgfault_handler+0xeb>
+        res = sys_alloc_region(0, (void*)(USER_EXCEPTION_STACK_TOP - USER_EXCEPTION_STACK_SIZE),
+  80176d:	b9 06 00 10 00       	mov    $0x100006,%ecx
+  801772:	ba 00 80 00 00       	mov    $0x8000,%edx
+  801777:	48 be 00 80 ff ff 7f 	movabs $0x7fffff8000,%rsi
+  80177e:	00 00 00 
+  801781:	bf 00 00 00 00       	mov    $0x0,%edi
+  801786:	48 b8 20 12 80 00 00 	movabs $0x801220,%rax
+  80178d:	00 00 00 
+  801790:	ff d0                	call   *%rax
+  801792:	89 c6                	mov    %eax,%esi
+        if (res < 0) {
+  801794:	85 c0                	test   %eax,%eax
+  801796:	78 38                	js     8017d0 <add_pgfault_handler+0xeb>
+        res = sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  801798:	48 be e6 18 80 00 00 	movabs $0x8018e6,%rsi
+  80179f:	00 00 00 
+  8017a2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8017a7:	48 b8 5d 15 80 00 00 	movabs $0x80155d,%rax
+  8017ae:	00 00 00 
+  8017b1:	ff d0                	call   *%rax
+  8017b3:	89 c6                	mov    %eax,%esi
+        if (res < 0) {
+  8017b5:	85 c0                	test   %eax,%eax
+  8017b7:	78 17                	js     8017d0 <add_pgfault_handler+0xeb>
+        _pfhandler_inititiallized = 1;
+  8017b9:	48 b8 60 50 80 00 00 	movabs $0x805060,%rax
+  8017c0:	00 00 00 
+  8017c3:	c6 00 01             	movb   $0x1,(%rax)
+  8017c6:	e9 3a ff ff ff       	jmp    801705 <add_pgfault_handler+0x20>
+        res = -E_INVAL;
+  8017cb:	be fd ff ff ff       	mov    $0xfffffffd,%esi
+        panic("set_pgfault_handler: %i", res);
+  8017d0:	89 f1                	mov    %esi,%ecx
+  8017d2:	48 ba be 36 80 00 00 	movabs $0x8036be,%rdx
+  8017d9:	00 00 00 
+  8017dc:	be 43 00 00 00       	mov    $0x43,%esi
+  8017e1:	48 bf b0 36 80 00 00 	movabs $0x8036b0,%rdi
+  8017e8:	00 00 00 
+  8017eb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017f0:	49 b8 fb 01 80 00 00 	movabs $0x8001fb,%r8
+  8017f7:	00 00 00 
+  8017fa:	41 ff d0             	call   *%r8
+        if (handler == _pfhandler_vec[i]) return 0;
+  8017fd:	be 00 00 00 00       	mov    $0x0,%esi
+    }
+    return res;
+}
+  801802:	89 f0                	mov    %esi,%eax
+  801804:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801808:	c9                   	leave
+  801809:	c3                   	ret
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  80180a:	48 b8 68 50 80 00 00 	movabs $0x805068,%rax
+  801811:	00 00 00 
+  801814:	48 c7 00 01 00 00 00 	movq   $0x1,(%rax)
+  80181b:	48 89 d8             	mov    %rbx,%rax
+  80181e:	48 a3 20 50 80 00 00 	movabs %rax,0x805020
+  801825:	00 00 00 
+    if (res < 0) {
+  801828:	eb d8                	jmp    801802 <add_pgfault_handler+0x11d>
+
+000000000080182a <remove_pgfault_handler>:
+
+void
+remove_pgfault_handler(pf_handler_t handler) {
+  80182a:	55                   	push   %rbp
+  80182b:	48 89 e5             	mov    %rsp,%rbp
+    assert(_pfhandler_inititiallized);
+  80182e:	48 b8 60 50 80 00 00 	movabs $0x805060,%rax
+  801835:	00 00 00 
+  801838:	80 38 00             	cmpb   $0x0,(%rax)
+  80183b:	74 33                	je     801870 <remove_pgfault_handler+0x46>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  80183d:	48 a1 68 50 80 00 00 	movabs 0x805068,%rax
+  801844:	00 00 00 
+  801847:	b9 00 00 00 00       	mov    $0x0,%ecx
+        if (_pfhandler_vec[i] == handler) {
+  80184c:	48 ba 20 50 80 00 00 	movabs $0x805020,%rdx
+  801853:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  801856:	48 85 c0             	test   %rax,%rax
+  801859:	0f 84 85 00 00 00    	je     8018e4 <remove_pgfault_handler+0xba>
+        if (_pfhandler_vec[i] == handler) {
+  80185f:	48 39 3c ca          	cmp    %rdi,(%rdx,%rcx,8)
+  801863:	74 40                	je     8018a5 <remove_pgfault_handler+0x7b>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  801865:	48 83 c1 01          	add    $0x1,%rcx
+  801869:	48 39 c1             	cmp    %rax,%rcx
+  80186c:	75 f1                	jne    80185f <remove_pgfault_handler+0x35>
+  80186e:	eb 74                	jmp    8018e4 <remove_pgfault_handler+0xba>
+    assert(_pfhandler_inititiallized);
+  801870:	48 b9 d6 36 80 00 00 	movabs $0x8036d6,%rcx
+  801877:	00 00 00 
+  80187a:	48 ba f0 36 80 00 00 	movabs $0x8036f0,%rdx
+  801881:	00 00 00 
+  801884:	be 4a 00 00 00       	mov    $0x4a,%esi
+  801889:	48 bf b0 36 80 00 00 	movabs $0x8036b0,%rdi
+  801890:	00 00 00 
+  801893:	b8 00 00 00 00       	mov    $0x0,%eax
+  801898:	49 b8 fb 01 80 00 00 	movabs $0x8001fb,%r8
+  80189f:	00 00 00 
+  8018a2:	41 ff d0             	call   *%r8
+            memmove(_pfhandler_vec + i, _pfhandler_vec + i + 1, (_pfhandler_off - i - 1) * sizeof(*handler));
+  8018a5:	48 8d 34 cd 08 00 00 	lea    0x8(,%rcx,8),%rsi
+  8018ac:	00 
+  8018ad:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8018b1:	48 29 ca             	sub    %rcx,%rdx
+  8018b4:	48 b8 20 50 80 00 00 	movabs $0x805020,%rax
+  8018bb:	00 00 00 
+  8018be:	48 8d 0c 06          	lea    (%rsi,%rax,1),%rcx
+  8018c2:	48 8d 7c 30 f8       	lea    -0x8(%rax,%rsi,1),%rdi
+  8018c7:	48 89 ce             	mov    %rcx,%rsi
+  8018ca:	48 b8 6a 0e 80 00 00 	movabs $0x800e6a,%rax
+  8018d1:	00 00 00 
+  8018d4:	ff d0                	call   *%rax
+            _pfhandler_off--;
+  8018d6:	48 b8 68 50 80 00 00 	movabs $0x805068,%rax
+  8018dd:	00 00 00 
+  8018e0:	48 83 28 01          	subq   $0x1,(%rax)
+            return;
+        }
+    }
+}
+  8018e4:	5d                   	pop    %rbp
+  8018e5:	c3                   	ret
+
+00000000008018e6 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+    # Call the C page fault handler.
+    movq  %rsp,%rdi # passing the function argument in rdi
+  8018e6:	48 89 e7             	mov    %rsp,%rdi
+    movabs $_handle_vectored_pagefault, %rax
+  8018e9:	48 b8 5b 16 80 00 00 	movabs $0x80165b,%rax
+  8018f0:	00 00 00 
+    call *%rax
+  8018f3:	ff d0                	call   *%rax
+    # registers are available for intermediate calculations.  You
+    # may find that you have to rearrange your code in non-obvious
+    # ways as registers become unavailable as scratch space.
+
+    # LAB 9: Your code here
+    addq $16, %rsp
+  8018f5:	48 83 c4 10          	add    $0x10,%rsp
+	movq %rsp, %rax
+  8018f9:	48 89 e0             	mov    %rsp,%rax
+	movq 120(%rsp), %rbx
+  8018fc:	48 8b 5c 24 78       	mov    0x78(%rsp),%rbx
+	movq 136(%rsp), %rcx
+  801901:	48 8b 8c 24 88 00 00 	mov    0x88(%rsp),%rcx
+  801908:	00 
+	movq %rcx, %rsp
+  801909:	48 89 cc             	mov    %rcx,%rsp
+    pushq %rbx
+  80190c:	53                   	push   %rbx
+    movq %rax, %rsp
+  80190d:	48 89 c4             	mov    %rax,%rsp
+
+	subq $8, %rcx
+  801910:	48 83 e9 08          	sub    $0x8,%rcx
+	movq %rcx, 136(%rsp)
+  801914:	48 89 8c 24 88 00 00 	mov    %rcx,0x88(%rsp)
+  80191b:	00 
+
+    # Restore the trap-time registers.  After you do this, you
+    # can no longer modify any general-purpose registers (POPA).
+    # LAB 9: Your code here
+
+    pop %r15
+  80191c:	41 5f                	pop    %r15
+    pop %r14
+  80191e:	41 5e                	pop    %r14
+    pop %r13
+  801920:	41 5d                	pop    %r13
+    pop %r12
+  801922:	41 5c                	pop    %r12
+    pop %r11
+  801924:	41 5b                	pop    %r11
+    pop %r10
+  801926:	41 5a                	pop    %r10
+    pop %r9
+  801928:	41 59                	pop    %r9
+    pop %r8
+  80192a:	41 58                	pop    %r8
+    pop %rsi
+  80192c:	5e                   	pop    %rsi
+    pop %rdi
+  80192d:	5f                   	pop    %rdi
+    pop %rbp
+  80192e:	5d                   	pop    %rbp
+    pop %rdx
+  80192f:	5a                   	pop    %rdx
+    pop %rcx
+  801930:	59                   	pop    %rcx
+    pop %rbx
+  801931:	5b                   	pop    %rbx
+    pop %rax
+  801932:	58                   	pop    %rax
+    # Restore rflags from the stack.  After you do this, you can
+    # no longer use arithmetic operations or anything else that
+    # modifies rflags.
+    # LAB 9: Your code here
+
+    addq $8, %rsp
+  801933:	48 83 c4 08          	add    $0x8,%rsp
+    popfq
+  801937:	9d                   	popf
+
+    # Switch back to the adjusted trap-time stack.
+    # LAB 9: Your code here
+
+    pop %rsp
+  801938:	5c                   	pop    %rsp
+
+    # Return to re-execute the instruction that faulted.
+    ret
+  801939:	c3                   	ret
+
+000000000080193a <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80193a:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801941:	ff ff ff 
+  801944:	48 01 f8             	add    %rdi,%rax
+  801947:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  80194b:	c3                   	ret
+
+000000000080194c <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80194c:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801953:	ff ff ff 
+  801956:	48 01 f8             	add    %rdi,%rax
+  801959:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  80195d:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  801963:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  801967:	c3                   	ret
+
+0000000000801968 <fd_alloc_from>:
+}
+
+/* Like fd_alloc(), but only considers fds starting from fdnum,
+ * so that several fds can be found before their pages are allocated */
+int
+fd_alloc_from(int fdnum, struct Fd **fd_store) {
+  801968:	55                   	push   %rbp
+  801969:	48 89 e5             	mov    %rsp,%rbp
+  80196c:	41 57                	push   %r15
+  80196e:	41 56                	push   %r14
+  801970:	41 55                	push   %r13
+  801972:	41 54                	push   %r12
+  801974:	53                   	push   %rbx
+  801975:	48 83 ec 08          	sub    $0x8,%rsp
+  801979:	49 89 f7             	mov    %rsi,%r15
+    for (int i = MAX(fdnum, 0); i < MAXFD; i++) {
+  80197c:	85 ff                	test   %edi,%edi
+  80197e:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  801984:	44 0f 49 e7          	cmovns %edi,%r12d
+  801988:	83 ff 1f             	cmp    $0x1f,%edi
+  80198b:	7f 37                	jg     8019c4 <fd_alloc_from+0x5c>
+  80198d:	49 63 dc             	movslq %r12d,%rbx
+  801990:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  801997:	48 c1 e3 0c          	shl    $0xc,%rbx
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  80199b:	49 be 71 2a 80 00 00 	movabs $0x802a71,%r14
+  8019a2:	00 00 00 
+        struct Fd *fd = INDEX2FD(i);
+  8019a5:	49 89 dd             	mov    %rbx,%r13
+        if (!(get_prot(fd) & PROT_R)) {
+  8019a8:	48 89 df             	mov    %rbx,%rdi
+  8019ab:	41 ff d6             	call   *%r14
+  8019ae:	83 e0 04             	and    $0x4,%eax
+  8019b1:	74 1c                	je     8019cf <fd_alloc_from+0x67>
+    for (int i = MAX(fdnum, 0); i < MAXFD; i++) {
+  8019b3:	41 83 c4 01          	add    $0x1,%r12d
+  8019b7:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8019be:	41 83 fc 1f          	cmp    $0x1f,%r12d
+  8019c2:	7e e1                	jle    8019a5 <fd_alloc_from+0x3d>
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  8019c4:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  8019ca:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  8019cf:	4d 89 2f             	mov    %r13,(%r15)
+}
+  8019d2:	48 83 c4 08          	add    $0x8,%rsp
+  8019d6:	5b                   	pop    %rbx
+  8019d7:	41 5c                	pop    %r12
+  8019d9:	41 5d                	pop    %r13
+  8019db:	41 5e                	pop    %r14
+  8019dd:	41 5f                	pop    %r15
+  8019df:	5d                   	pop    %rbp
+  8019e0:	c3                   	ret
+
+00000000008019e1 <fd_alloc>:
+fd_alloc(struct Fd **fd_store) {
+  8019e1:	55                   	push   %rbp
+  8019e2:	48 89 e5             	mov    %rsp,%rbp
+  8019e5:	48 89 fe             	mov    %rdi,%rsi
+    return fd_alloc_from(0, fd_store);
+  8019e8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8019ed:	48 b8 68 19 80 00 00 	movabs $0x801968,%rax
+  8019f4:	00 00 00 
+  8019f7:	ff d0                	call   *%rax
+}
+  8019f9:	5d                   	pop    %rbp
+  8019fa:	c3                   	ret
+
+00000000008019fb <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  8019fb:	83 ff 1f             	cmp    $0x1f,%edi
+  8019fe:	77 39                	ja     801a39 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  801a00:	55                   	push   %rbp
+  801a01:	48 89 e5             	mov    %rsp,%rbp
+  801a04:	41 54                	push   %r12
+  801a06:	53                   	push   %rbx
+  801a07:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  801a0a:	48 63 df             	movslq %edi,%rbx
+  801a0d:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  801a14:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  801a18:	48 89 df             	mov    %rbx,%rdi
+  801a1b:	48 b8 71 2a 80 00 00 	movabs $0x802a71,%rax
+  801a22:	00 00 00 
+  801a25:	ff d0                	call   *%rax
+  801a27:	a8 04                	test   $0x4,%al
+  801a29:	74 14                	je     801a3f <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  801a2b:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  801a2f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801a34:	5b                   	pop    %rbx
+  801a35:	41 5c                	pop    %r12
+  801a37:	5d                   	pop    %rbp
+  801a38:	c3                   	ret
+        return -E_INVAL;
+  801a39:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801a3e:	c3                   	ret
+        return -E_INVAL;
+  801a3f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801a44:	eb ee                	jmp    801a34 <fd_lookup+0x39>
+
+0000000000801a46 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  801a46:	55                   	push   %rbp
+  801a47:	48 89 e5             	mov    %rsp,%rbp
+  801a4a:	41 54                	push   %r12
+  801a4c:	53                   	push   %rbx
+  801a4d:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  801a50:	48 b8 a0 37 80 00 00 	movabs $0x8037a0,%rax
+  801a57:	00 00 00 
+  801a5a:	48 bb 20 40 80 00 00 	movabs $0x804020,%rbx
+  801a61:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  801a64:	39 3b                	cmp    %edi,(%rbx)
+  801a66:	74 47                	je     801aaf <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  801a68:	48 83 c0 08          	add    $0x8,%rax
+  801a6c:	48 8b 18             	mov    (%rax),%rbx
+  801a6f:	48 85 db             	test   %rbx,%rbx
+  801a72:	75 f0                	jne    801a64 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801a74:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801a7b:	00 00 00 
+  801a7e:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+  801a84:	89 fa                	mov    %edi,%edx
+  801a86:	48 bf 08 37 80 00 00 	movabs $0x803708,%rdi
+  801a8d:	00 00 00 
+  801a90:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a95:	48 b9 4b 03 80 00 00 	movabs $0x80034b,%rcx
+  801a9c:	00 00 00 
+  801a9f:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  801aa1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  801aa6:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  801aaa:	5b                   	pop    %rbx
+  801aab:	41 5c                	pop    %r12
+  801aad:	5d                   	pop    %rbp
+  801aae:	c3                   	ret
+            return 0;
+  801aaf:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ab4:	eb f0                	jmp    801aa6 <dev_lookup+0x60>
+
+0000000000801ab6 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  801ab6:	55                   	push   %rbp
+  801ab7:	48 89 e5             	mov    %rsp,%rbp
+  801aba:	41 55                	push   %r13
+  801abc:	41 54                	push   %r12
+  801abe:	53                   	push   %rbx
+  801abf:	48 83 ec 18          	sub    $0x18,%rsp
+  801ac3:	48 89 fb             	mov    %rdi,%rbx
+  801ac6:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801ac9:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  801ad0:	ff ff ff 
+  801ad3:	48 01 df             	add    %rbx,%rdi
+  801ad6:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  801ada:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801ade:	48 b8 fb 19 80 00 00 	movabs $0x8019fb,%rax
+  801ae5:	00 00 00 
+  801ae8:	ff d0                	call   *%rax
+  801aea:	41 89 c5             	mov    %eax,%r13d
+  801aed:	85 c0                	test   %eax,%eax
+  801aef:	78 06                	js     801af7 <fd_close+0x41>
+  801af1:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  801af5:	74 1a                	je     801b11 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  801af7:	45 84 e4             	test   %r12b,%r12b
+  801afa:	b8 00 00 00 00       	mov    $0x0,%eax
+  801aff:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  801b03:	44 89 e8             	mov    %r13d,%eax
+  801b06:	48 83 c4 18          	add    $0x18,%rsp
+  801b0a:	5b                   	pop    %rbx
+  801b0b:	41 5c                	pop    %r12
+  801b0d:	41 5d                	pop    %r13
+  801b0f:	5d                   	pop    %rbp
+  801b10:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801b11:	8b 3b                	mov    (%rbx),%edi
+  801b13:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801b17:	48 b8 46 1a 80 00 00 	movabs $0x801a46,%rax
+  801b1e:	00 00 00 
+  801b21:	ff d0                	call   *%rax
+  801b23:	41 89 c5             	mov    %eax,%r13d
+  801b26:	85 c0                	test   %eax,%eax
+  801b28:	78 1b                	js     801b45 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  801b2a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801b2e:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801b32:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801b38:	48 85 c0             	test   %rax,%rax
+  801b3b:	74 08                	je     801b45 <fd_close+0x8f>
+  801b3d:	48 89 df             	mov    %rbx,%rdi
+  801b40:	ff d0                	call   *%rax
+  801b42:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801b45:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801b4a:	48 89 de             	mov    %rbx,%rsi
+  801b4d:	bf 00 00 00 00       	mov    $0x0,%edi
+  801b52:	48 b8 ec 12 80 00 00 	movabs $0x8012ec,%rax
+  801b59:	00 00 00 
+  801b5c:	ff d0                	call   *%rax
+    return res;
+  801b5e:	eb a3                	jmp    801b03 <fd_close+0x4d>
+
+0000000000801b60 <close>:
+
+int
+close(int fdnum) {
+  801b60:	55                   	push   %rbp
+  801b61:	48 89 e5             	mov    %rsp,%rbp
+  801b64:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  801b68:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801b6c:	48 b8 fb 19 80 00 00 	movabs $0x8019fb,%rax
+  801b73:	00 00 00 
+  801b76:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801b78:	85 c0                	test   %eax,%eax
+  801b7a:	78 15                	js     801b91 <close+0x31>
+
+    return fd_close(fd, 1);
+  801b7c:	be 01 00 00 00       	mov    $0x1,%esi
+  801b81:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801b85:	48 b8 b6 1a 80 00 00 	movabs $0x801ab6,%rax
+  801b8c:	00 00 00 
+  801b8f:	ff d0                	call   *%rax
+}
+  801b91:	c9                   	leave
+  801b92:	c3                   	ret
+
+0000000000801b93 <close_all>:
+
+void
+close_all(void) {
+  801b93:	55                   	push   %rbp
+  801b94:	48 89 e5             	mov    %rsp,%rbp
+  801b97:	41 54                	push   %r12
+  801b99:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  801b9a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b9f:	49 bc 60 1b 80 00 00 	movabs $0x801b60,%r12
+  801ba6:	00 00 00 
+  801ba9:	89 df                	mov    %ebx,%edi
+  801bab:	41 ff d4             	call   *%r12
+  801bae:	83 c3 01             	add    $0x1,%ebx
+  801bb1:	83 fb 20             	cmp    $0x20,%ebx
+  801bb4:	75 f3                	jne    801ba9 <close_all+0x16>
+}
+  801bb6:	5b                   	pop    %rbx
+  801bb7:	41 5c                	pop    %r12
+  801bb9:	5d                   	pop    %rbp
+  801bba:	c3                   	ret
+
+0000000000801bbb <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  801bbb:	55                   	push   %rbp
+  801bbc:	48 89 e5             	mov    %rsp,%rbp
+  801bbf:	41 57                	push   %r15
+  801bc1:	41 56                	push   %r14
+  801bc3:	41 55                	push   %r13
+  801bc5:	41 54                	push   %r12
+  801bc7:	53                   	push   %rbx
+  801bc8:	48 83 ec 18          	sub    $0x18,%rsp
+  801bcc:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  801bcf:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801bd3:	48 b8 fb 19 80 00 00 	movabs $0x8019fb,%rax
+  801bda:	00 00 00 
+  801bdd:	ff d0                	call   *%rax
+  801bdf:	89 c3                	mov    %eax,%ebx
+  801be1:	85 c0                	test   %eax,%eax
+  801be3:	0f 88 b8 00 00 00    	js     801ca1 <dup+0xe6>
+    close(newfdnum);
+  801be9:	44 89 e7             	mov    %r12d,%edi
+  801bec:	48 b8 60 1b 80 00 00 	movabs $0x801b60,%rax
+  801bf3:	00 00 00 
+  801bf6:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  801bf8:	4d 63 ec             	movslq %r12d,%r13
+  801bfb:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  801c02:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  801c06:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  801c0a:	4c 89 ff             	mov    %r15,%rdi
+  801c0d:	49 be 4c 19 80 00 00 	movabs $0x80194c,%r14
+  801c14:	00 00 00 
+  801c17:	41 ff d6             	call   *%r14
+  801c1a:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  801c1d:	4c 89 ef             	mov    %r13,%rdi
+  801c20:	41 ff d6             	call   *%r14
+  801c23:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  801c26:	48 89 df             	mov    %rbx,%rdi
+  801c29:	48 b8 71 2a 80 00 00 	movabs $0x802a71,%rax
+  801c30:	00 00 00 
+  801c33:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  801c35:	a8 04                	test   $0x4,%al
+  801c37:	74 2b                	je     801c64 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  801c39:	41 89 c1             	mov    %eax,%r9d
+  801c3c:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801c42:	4c 89 f1             	mov    %r14,%rcx
+  801c45:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c4a:	48 89 de             	mov    %rbx,%rsi
+  801c4d:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c52:	48 b8 87 12 80 00 00 	movabs $0x801287,%rax
+  801c59:	00 00 00 
+  801c5c:	ff d0                	call   *%rax
+  801c5e:	89 c3                	mov    %eax,%ebx
+  801c60:	85 c0                	test   %eax,%eax
+  801c62:	78 4e                	js     801cb2 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  801c64:	4c 89 ff             	mov    %r15,%rdi
+  801c67:	48 b8 71 2a 80 00 00 	movabs $0x802a71,%rax
+  801c6e:	00 00 00 
+  801c71:	ff d0                	call   *%rax
+  801c73:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801c76:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801c7c:	4c 89 e9             	mov    %r13,%rcx
+  801c7f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c84:	4c 89 fe             	mov    %r15,%rsi
+  801c87:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c8c:	48 b8 87 12 80 00 00 	movabs $0x801287,%rax
+  801c93:	00 00 00 
+  801c96:	ff d0                	call   *%rax
+  801c98:	89 c3                	mov    %eax,%ebx
+  801c9a:	85 c0                	test   %eax,%eax
+  801c9c:	78 14                	js     801cb2 <dup+0xf7>
+
+    return newfdnum;
+  801c9e:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  801ca1:	89 d8                	mov    %ebx,%eax
+  801ca3:	48 83 c4 18          	add    $0x18,%rsp
+  801ca7:	5b                   	pop    %rbx
+  801ca8:	41 5c                	pop    %r12
+  801caa:	41 5d                	pop    %r13
+  801cac:	41 5e                	pop    %r14
+  801cae:	41 5f                	pop    %r15
+  801cb0:	5d                   	pop    %rbp
+  801cb1:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  801cb2:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801cb7:	4c 89 ee             	mov    %r13,%rsi
+  801cba:	bf 00 00 00 00       	mov    $0x0,%edi
+  801cbf:	49 bc ec 12 80 00 00 	movabs $0x8012ec,%r12
+  801cc6:	00 00 00 
+  801cc9:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  801ccc:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801cd1:	4c 89 f6             	mov    %r14,%rsi
+  801cd4:	bf 00 00 00 00       	mov    $0x0,%edi
+  801cd9:	41 ff d4             	call   *%r12
+    return res;
+  801cdc:	eb c3                	jmp    801ca1 <dup+0xe6>
+
+0000000000801cde <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  801cde:	55                   	push   %rbp
+  801cdf:	48 89 e5             	mov    %rsp,%rbp
+  801ce2:	41 56                	push   %r14
+  801ce4:	41 55                	push   %r13
+  801ce6:	41 54                	push   %r12
+  801ce8:	53                   	push   %rbx
+  801ce9:	48 83 ec 10          	sub    $0x10,%rsp
+  801ced:	89 fb                	mov    %edi,%ebx
+  801cef:	49 89 f4             	mov    %rsi,%r12
+  801cf2:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801cf5:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801cf9:	48 b8 fb 19 80 00 00 	movabs $0x8019fb,%rax
+  801d00:	00 00 00 
+  801d03:	ff d0                	call   *%rax
+  801d05:	85 c0                	test   %eax,%eax
+  801d07:	78 4c                	js     801d55 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801d09:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801d0d:	41 8b 3e             	mov    (%r14),%edi
+  801d10:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801d14:	48 b8 46 1a 80 00 00 	movabs $0x801a46,%rax
+  801d1b:	00 00 00 
+  801d1e:	ff d0                	call   *%rax
+  801d20:	85 c0                	test   %eax,%eax
+  801d22:	78 35                	js     801d59 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801d24:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801d28:	83 e0 03             	and    $0x3,%eax
+  801d2b:	83 f8 01             	cmp    $0x1,%eax
+  801d2e:	74 2d                	je     801d5d <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801d30:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801d34:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801d38:	48 85 c0             	test   %rax,%rax
+  801d3b:	74 56                	je     801d93 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  801d3d:	4c 89 ea             	mov    %r13,%rdx
+  801d40:	4c 89 e6             	mov    %r12,%rsi
+  801d43:	4c 89 f7             	mov    %r14,%rdi
+  801d46:	ff d0                	call   *%rax
+}
+  801d48:	48 83 c4 10          	add    $0x10,%rsp
+  801d4c:	5b                   	pop    %rbx
+  801d4d:	41 5c                	pop    %r12
+  801d4f:	41 5d                	pop    %r13
+  801d51:	41 5e                	pop    %r14
+  801d53:	5d                   	pop    %rbp
+  801d54:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801d55:	48 98                	cltq
+  801d57:	eb ef                	jmp    801d48 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801d59:	48 98                	cltq
+  801d5b:	eb eb                	jmp    801d48 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801d5d:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801d64:	00 00 00 
+  801d67:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+  801d6d:	89 da                	mov    %ebx,%edx
+  801d6f:	48 bf 49 37 80 00 00 	movabs $0x803749,%rdi
+  801d76:	00 00 00 
+  801d79:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d7e:	48 b9 4b 03 80 00 00 	movabs $0x80034b,%rcx
+  801d85:	00 00 00 
+  801d88:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801d8a:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801d91:	eb b5                	jmp    801d48 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801d93:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801d9a:	eb ac                	jmp    801d48 <read+0x6a>
+
+0000000000801d9c <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801d9c:	55                   	push   %rbp
+  801d9d:	48 89 e5             	mov    %rsp,%rbp
+  801da0:	41 57                	push   %r15
+  801da2:	41 56                	push   %r14
+  801da4:	41 55                	push   %r13
+  801da6:	41 54                	push   %r12
+  801da8:	53                   	push   %rbx
+  801da9:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  801dad:	48 85 d2             	test   %rdx,%rdx
+  801db0:	74 54                	je     801e06 <readn+0x6a>
+  801db2:	41 89 fd             	mov    %edi,%r13d
+  801db5:	49 89 f6             	mov    %rsi,%r14
+  801db8:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  801dbb:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  801dc0:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  801dc5:	49 bf de 1c 80 00 00 	movabs $0x801cde,%r15
+  801dcc:	00 00 00 
+  801dcf:	4c 89 e2             	mov    %r12,%rdx
+  801dd2:	48 29 f2             	sub    %rsi,%rdx
+  801dd5:	4c 01 f6             	add    %r14,%rsi
+  801dd8:	44 89 ef             	mov    %r13d,%edi
+  801ddb:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  801dde:	85 c0                	test   %eax,%eax
+  801de0:	78 20                	js     801e02 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  801de2:	01 c3                	add    %eax,%ebx
+  801de4:	85 c0                	test   %eax,%eax
+  801de6:	74 08                	je     801df0 <readn+0x54>
+  801de8:	48 63 f3             	movslq %ebx,%rsi
+  801deb:	4c 39 e6             	cmp    %r12,%rsi
+  801dee:	72 df                	jb     801dcf <readn+0x33>
+    }
+    return res;
+  801df0:	48 63 c3             	movslq %ebx,%rax
+}
+  801df3:	48 83 c4 08          	add    $0x8,%rsp
+  801df7:	5b                   	pop    %rbx
+  801df8:	41 5c                	pop    %r12
+  801dfa:	41 5d                	pop    %r13
+  801dfc:	41 5e                	pop    %r14
+  801dfe:	41 5f                	pop    %r15
+  801e00:	5d                   	pop    %rbp
+  801e01:	c3                   	ret
+        if (inc < 0) return inc;
+  801e02:	48 98                	cltq
+  801e04:	eb ed                	jmp    801df3 <readn+0x57>
+    int inc = 1, res = 0;
+  801e06:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801e0b:	eb e3                	jmp    801df0 <readn+0x54>
+
+0000000000801e0d <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  801e0d:	55                   	push   %rbp
+  801e0e:	48 89 e5             	mov    %rsp,%rbp
+  801e11:	41 56                	push   %r14
+  801e13:	41 55                	push   %r13
+  801e15:	41 54                	push   %r12
+  801e17:	53                   	push   %rbx
+  801e18:	48 83 ec 10          	sub    $0x10,%rsp
+  801e1c:	89 fb                	mov    %edi,%ebx
+  801e1e:	49 89 f4             	mov    %rsi,%r12
+  801e21:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801e24:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801e28:	48 b8 fb 19 80 00 00 	movabs $0x8019fb,%rax
+  801e2f:	00 00 00 
+  801e32:	ff d0                	call   *%rax
+  801e34:	85 c0                	test   %eax,%eax
+  801e36:	78 47                	js     801e7f <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801e38:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801e3c:	41 8b 3e             	mov    (%r14),%edi
+  801e3f:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801e43:	48 b8 46 1a 80 00 00 	movabs $0x801a46,%rax
+  801e4a:	00 00 00 
+  801e4d:	ff d0                	call   *%rax
+  801e4f:	85 c0                	test   %eax,%eax
+  801e51:	78 30                	js     801e83 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801e53:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  801e58:	74 2d                	je     801e87 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801e5a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801e5e:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801e62:	48 85 c0             	test   %rax,%rax
+  801e65:	74 56                	je     801ebd <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  801e67:	4c 89 ea             	mov    %r13,%rdx
+  801e6a:	4c 89 e6             	mov    %r12,%rsi
+  801e6d:	4c 89 f7             	mov    %r14,%rdi
+  801e70:	ff d0                	call   *%rax
+}
+  801e72:	48 83 c4 10          	add    $0x10,%rsp
+  801e76:	5b                   	pop    %rbx
+  801e77:	41 5c                	pop    %r12
+  801e79:	41 5d                	pop    %r13
+  801e7b:	41 5e                	pop    %r14
+  801e7d:	5d                   	pop    %rbp
+  801e7e:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801e7f:	48 98                	cltq
+  801e81:	eb ef                	jmp    801e72 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801e83:	48 98                	cltq
+  801e85:	eb eb                	jmp    801e72 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801e87:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801e8e:	00 00 00 
+  801e91:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+  801e97:	89 da                	mov    %ebx,%edx
+  801e99:	48 bf 65 37 80 00 00 	movabs $0x803765,%rdi
+  801ea0:	00 00 00 
+  801ea3:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ea8:	48 b9 4b 03 80 00 00 	movabs $0x80034b,%rcx
+  801eaf:	00 00 00 
+  801eb2:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801eb4:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801ebb:	eb b5                	jmp    801e72 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801ebd:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801ec4:	eb ac                	jmp    801e72 <write+0x65>
+
+0000000000801ec6 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  801ec6:	55                   	push   %rbp
+  801ec7:	48 89 e5             	mov    %rsp,%rbp
+  801eca:	53                   	push   %rbx
+  801ecb:	48 83 ec 18          	sub    $0x18,%rsp
+  801ecf:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801ed1:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801ed5:	48 b8 fb 19 80 00 00 	movabs $0x8019fb,%rax
+  801edc:	00 00 00 
+  801edf:	ff d0                	call   *%rax
+  801ee1:	85 c0                	test   %eax,%eax
+  801ee3:	78 0c                	js     801ef1 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  801ee5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801ee9:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  801eec:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801ef1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801ef5:	c9                   	leave
+  801ef6:	c3                   	ret
+
+0000000000801ef7 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  801ef7:	55                   	push   %rbp
+  801ef8:	48 89 e5             	mov    %rsp,%rbp
+  801efb:	41 55                	push   %r13
+  801efd:	41 54                	push   %r12
+  801eff:	53                   	push   %rbx
+  801f00:	48 83 ec 18          	sub    $0x18,%rsp
+  801f04:	89 fb                	mov    %edi,%ebx
+  801f06:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801f09:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801f0d:	48 b8 fb 19 80 00 00 	movabs $0x8019fb,%rax
+  801f14:	00 00 00 
+  801f17:	ff d0                	call   *%rax
+  801f19:	85 c0                	test   %eax,%eax
+  801f1b:	78 38                	js     801f55 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801f1d:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  801f21:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  801f25:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801f29:	48 b8 46 1a 80 00 00 	movabs $0x801a46,%rax
+  801f30:	00 00 00 
+  801f33:	ff d0                	call   *%rax
+  801f35:	85 c0                	test   %eax,%eax
+  801f37:	78 1c                	js     801f55 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801f39:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  801f3e:	74 20                	je     801f60 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801f40:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801f44:	48 8b 40 30          	mov    0x30(%rax),%rax
+  801f48:	48 85 c0             	test   %rax,%rax
+  801f4b:	74 47                	je     801f94 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  801f4d:	44 89 e6             	mov    %r12d,%esi
+  801f50:	4c 89 ef             	mov    %r13,%rdi
+  801f53:	ff d0                	call   *%rax
+}
+  801f55:	48 83 c4 18          	add    $0x18,%rsp
+  801f59:	5b                   	pop    %rbx
+  801f5a:	41 5c                	pop    %r12
+  801f5c:	41 5d                	pop    %r13
+  801f5e:	5d                   	pop    %rbp
+  801f5f:	c3                   	ret
+                thisenv->env_id, fdnum);
+  801f60:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801f67:	00 00 00 
+  801f6a:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801f70:	89 da                	mov    %ebx,%edx
+  801f72:	48 bf 28 37 80 00 00 	movabs $0x803728,%rdi
+  801f79:	00 00 00 
+  801f7c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f81:	48 b9 4b 03 80 00 00 	movabs $0x80034b,%rcx
+  801f88:	00 00 00 
+  801f8b:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801f8d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801f92:	eb c1                	jmp    801f55 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801f94:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801f99:	eb ba                	jmp    801f55 <ftruncate+0x5e>
+
+0000000000801f9b <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  801f9b:	55                   	push   %rbp
+  801f9c:	48 89 e5             	mov    %rsp,%rbp
+  801f9f:	41 54                	push   %r12
+  801fa1:	53                   	push   %rbx
+  801fa2:	48 83 ec 10          	sub    $0x10,%rsp
+  801fa6:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801fa9:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801fad:	48 b8 fb 19 80 00 00 	movabs $0x8019fb,%rax
+  801fb4:	00 00 00 
+  801fb7:	ff d0                	call   *%rax
+  801fb9:	85 c0                	test   %eax,%eax
+  801fbb:	78 4e                	js     80200b <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801fbd:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801fc1:	41 8b 3c 24          	mov    (%r12),%edi
+  801fc5:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801fc9:	48 b8 46 1a 80 00 00 	movabs $0x801a46,%rax
+  801fd0:	00 00 00 
+  801fd3:	ff d0                	call   *%rax
+  801fd5:	85 c0                	test   %eax,%eax
+  801fd7:	78 32                	js     80200b <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801fd9:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801fdd:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  801fe2:	74 30                	je     802014 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  801fe4:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  801fe7:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  801fee:	00 00 00 
+    stat->st_isdir = 0;
+  801ff1:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  801ff8:	00 00 00 
+    stat->st_dev = dev;
+  801ffb:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  802002:	48 89 de             	mov    %rbx,%rsi
+  802005:	4c 89 e7             	mov    %r12,%rdi
+  802008:	ff 50 28             	call   *0x28(%rax)
+}
+  80200b:	48 83 c4 10          	add    $0x10,%rsp
+  80200f:	5b                   	pop    %rbx
+  802010:	41 5c                	pop    %r12
+  802012:	5d                   	pop    %rbp
+  802013:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  802014:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802019:	eb f0                	jmp    80200b <fstat+0x70>
+
+000000000080201b <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  80201b:	55                   	push   %rbp
+  80201c:	48 89 e5             	mov    %rsp,%rbp
+  80201f:	41 54                	push   %r12
+  802021:	53                   	push   %rbx
+  802022:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  802025:	be 00 00 00 00       	mov    $0x0,%esi
+  80202a:	48 b8 fe 23 80 00 00 	movabs $0x8023fe,%rax
+  802031:	00 00 00 
+  802034:	ff d0                	call   *%rax
+  802036:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  802038:	85 c0                	test   %eax,%eax
+  80203a:	78 25                	js     802061 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  80203c:	4c 89 e6             	mov    %r12,%rsi
+  80203f:	89 c7                	mov    %eax,%edi
+  802041:	48 b8 9b 1f 80 00 00 	movabs $0x801f9b,%rax
+  802048:	00 00 00 
+  80204b:	ff d0                	call   *%rax
+  80204d:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  802050:	89 df                	mov    %ebx,%edi
+  802052:	48 b8 60 1b 80 00 00 	movabs $0x801b60,%rax
+  802059:	00 00 00 
+  80205c:	ff d0                	call   *%rax
+
+    return res;
+  80205e:	44 89 e3             	mov    %r12d,%ebx
+}
+  802061:	89 d8                	mov    %ebx,%eax
+  802063:	5b                   	pop    %rbx
+  802064:	41 5c                	pop    %r12
+  802066:	5d                   	pop    %rbp
+  802067:	c3                   	ret
+
+0000000000802068 <fsipc>:
+ * response may be written back to fsipcbuf.
+ * type: request code, passed as the simple integer IPC value.
+ * dstva: virtual address at which to receive reply page, 0 if none.
+ * Returns result from the file server. */
+static int
+fsipc(unsigned type, void *dstva) {
+  802068:	55                   	push   %rbp
+  802069:	48 89 e5             	mov    %rsp,%rbp
+  80206c:	41 54                	push   %r12
+  80206e:	53                   	push   %rbx
+  80206f:	48 83 ec 10          	sub    $0x10,%rsp
+  802073:	41 89 fc             	mov    %edi,%r12d
+  802076:	48 89 f3             	mov    %rsi,%rbx
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802079:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  802080:	00 00 00 
+  802083:	83 38 00             	cmpl   $0x0,(%rax)
+  802086:	74 5e                	je     8020e6 <fsipc+0x7e>
+    if (debug) {
+        cprintf("[%08x] fsipc %d %08x\n",
+                thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+    }
+
+    ipc_send(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW);
+  802088:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  80208e:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802093:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  80209a:	00 00 00 
+  80209d:	44 89 e6             	mov    %r12d,%esi
+  8020a0:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  8020a7:	00 00 00 
+  8020aa:	8b 38                	mov    (%rax),%edi
+  8020ac:	48 b8 65 2f 80 00 00 	movabs $0x802f65,%rax
+  8020b3:	00 00 00 
+  8020b6:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  8020b8:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  8020bf:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  8020c0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8020c5:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  8020c9:	48 89 de             	mov    %rbx,%rsi
+  8020cc:	bf 00 00 00 00       	mov    $0x0,%edi
+  8020d1:	48 b8 90 2e 80 00 00 	movabs $0x802e90,%rax
+  8020d8:	00 00 00 
+  8020db:	ff d0                	call   *%rax
+}
+  8020dd:	48 83 c4 10          	add    $0x10,%rsp
+  8020e1:	5b                   	pop    %rbx
+  8020e2:	41 5c                	pop    %r12
+  8020e4:	5d                   	pop    %rbp
+  8020e5:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8020e6:	bf 03 00 00 00       	mov    $0x3,%edi
+  8020eb:	48 b8 08 30 80 00 00 	movabs $0x803008,%rax
+  8020f2:	00 00 00 
+  8020f5:	ff d0                	call   *%rax
+  8020f7:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  8020fe:	00 00 
+  802100:	eb 86                	jmp    802088 <fsipc+0x20>
+
+0000000000802102 <devfile_trunc>:
+    return 0;
+}
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  802102:	55                   	push   %rbp
+  802103:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802106:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  80210d:	00 00 00 
+  802110:	8b 57 0c             	mov    0xc(%rdi),%edx
+  802113:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  802115:	89 70 04             	mov    %esi,0x4(%rax)
+
+    return fsipc(FSREQ_SET_SIZE, NULL);
+  802118:	be 00 00 00 00       	mov    $0x0,%esi
+  80211d:	bf 02 00 00 00       	mov    $0x2,%edi
+  802122:	48 b8 68 20 80 00 00 	movabs $0x802068,%rax
+  802129:	00 00 00 
+  80212c:	ff d0                	call   *%rax
+}
+  80212e:	5d                   	pop    %rbp
+  80212f:	c3                   	ret
+
+0000000000802130 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  802130:	55                   	push   %rbp
+  802131:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  802134:	8b 47 0c             	mov    0xc(%rdi),%eax
+  802137:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  80213e:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  802140:	be 00 00 00 00       	mov    $0x0,%esi
+  802145:	bf 06 00 00 00       	mov    $0x6,%edi
+  80214a:	48 b8 68 20 80 00 00 	movabs $0x802068,%rax
+  802151:	00 00 00 
+  802154:	ff d0                	call   *%rax
+}
+  802156:	5d                   	pop    %rbp
+  802157:	c3                   	ret
+
+0000000000802158 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  802158:	55                   	push   %rbp
+  802159:	48 89 e5             	mov    %rsp,%rbp
+  80215c:	41 54                	push   %r12
+  80215e:	53                   	push   %rbx
+  80215f:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802162:	8b 47 0c             	mov    0xc(%rdi),%eax
+  802165:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  80216c:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  80216e:	be 00 00 00 00       	mov    $0x0,%esi
+  802173:	bf 05 00 00 00       	mov    $0x5,%edi
+  802178:	48 b8 68 20 80 00 00 	movabs $0x802068,%rax
+  80217f:	00 00 00 
+  802182:	ff d0                	call   *%rax
+    if (res < 0) {
+  802184:	85 c0                	test   %eax,%eax
+  802186:	78 3d                	js     8021c5 <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802188:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  80218f:	00 00 00 
+  802192:	4c 89 e6             	mov    %r12,%rsi
+  802195:	48 89 df             	mov    %rbx,%rdi
+  802198:	48 b8 70 0c 80 00 00 	movabs $0x800c70,%rax
+  80219f:	00 00 00 
+  8021a2:	ff d0                	call   *%rax
+    st->st_size  = fsipcbuf.statRet.ret_size;
+  8021a4:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  8021ab:	00 
+  8021ac:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8021b2:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  8021b9:	00 
+  8021ba:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  8021c0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8021c5:	5b                   	pop    %rbx
+  8021c6:	41 5c                	pop    %r12
+  8021c8:	5d                   	pop    %rbp
+  8021c9:	c3                   	ret
+
+00000000008021ca <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  8021ca:	55                   	push   %rbp
+  8021cb:	48 89 e5             	mov    %rsp,%rbp
+  8021ce:	41 57                	push   %r15
+  8021d0:	41 56                	push   %r14
+  8021d2:	41 55                	push   %r13
+  8021d4:	41 54                	push   %r12
+  8021d6:	53                   	push   %rbx
+  8021d7:	48 83 ec 18          	sub    $0x18,%rsp
+  8021db:	49 89 fe             	mov    %rdi,%r14
+  8021de:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+  8021e2:	48 89 d3             	mov    %rdx,%rbx
+    while (n > sizeof(fsipcbuf.write.req_buf))
+  8021e5:	48 81 fa f0 0f 00 00 	cmp    $0xff0,%rdx
+  8021ec:	0f 86 e4 00 00 00    	jbe    8022d6 <devfile_write+0x10c>
+  8021f2:	49 89 f4             	mov    %rsi,%r12
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8021f5:	49 bd 00 60 80 00 00 	movabs $0x806000,%r13
+  8021fc:	00 00 00 
+        memcpy(fsipcbuf.write.req_buf, buf, sizeof(fsipcbuf.write.req_buf));
+  8021ff:	49 bf d1 0e 80 00 00 	movabs $0x800ed1,%r15
+  802206:	00 00 00 
+  802209:	eb 03                	jmp    80220e <devfile_write+0x44>
+        buf += sizeof(fsipcbuf.write.req_buf);
+  80220b:	49 89 f4             	mov    %rsi,%r12
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  80220e:	41 8b 46 0c          	mov    0xc(%r14),%eax
+  802212:	41 89 45 00          	mov    %eax,0x0(%r13)
+        fsipcbuf.write.req_n      = sizeof(fsipcbuf.write.req_buf);
+  802216:	49 c7 45 08 f0 0f 00 	movq   $0xff0,0x8(%r13)
+  80221d:	00 
+        memcpy(fsipcbuf.write.req_buf, buf, sizeof(fsipcbuf.write.req_buf));
+  80221e:	ba f0 0f 00 00       	mov    $0xff0,%edx
+  802223:	4c 89 e6             	mov    %r12,%rsi
+  802226:	48 bf 10 60 80 00 00 	movabs $0x806010,%rdi
+  80222d:	00 00 00 
+  802230:	41 ff d7             	call   *%r15
+        ssize_t res = fsipc(FSREQ_WRITE, NULL);
+  802233:	be 00 00 00 00       	mov    $0x0,%esi
+  802238:	bf 04 00 00 00       	mov    $0x4,%edi
+  80223d:	48 b8 68 20 80 00 00 	movabs $0x802068,%rax
+  802244:	00 00 00 
+  802247:	ff d0                	call   *%rax
+  802249:	48 63 d0             	movslq %eax,%rdx
+        if (res < 0 || res < sizeof(fsipcbuf.write.req_buf))
+  80224c:	3d ef 0f 00 00       	cmp    $0xfef,%eax
+  802251:	7e 71                	jle    8022c4 <devfile_write+0xfa>
+        buf += sizeof(fsipcbuf.write.req_buf);
+  802253:	49 8d b4 24 f0 0f 00 	lea    0xff0(%r12),%rsi
+  80225a:	00 
+        n -= sizeof(fsipcbuf.write.req_buf);
+  80225b:	48 81 eb f0 0f 00 00 	sub    $0xff0,%rbx
+    while (n > sizeof(fsipcbuf.write.req_buf))
+  802262:	48 81 fb f0 0f 00 00 	cmp    $0xff0,%rbx
+  802269:	77 a0                	ja     80220b <devfile_write+0x41>
+        written += sizeof(fsipcbuf.write.req_buf);
+  80226b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80226f:	49 29 c4             	sub    %rax,%r12
+  802272:	4d 8d a4 24 f0 0f 00 	lea    0xff0(%r12),%r12
+  802279:	00 
+    fsipcbuf.write.req_fileid = fd->fd_file.id;
+  80227a:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  802281:	00 00 00 
+  802284:	41 8b 56 0c          	mov    0xc(%r14),%edx
+  802288:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.write.req_n      = n;
+  80228a:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    memcpy(fsipcbuf.write.req_buf, buf, n);
+  80228e:	48 89 da             	mov    %rbx,%rdx
+  802291:	48 8d 78 10          	lea    0x10(%rax),%rdi
+  802295:	48 b8 d1 0e 80 00 00 	movabs $0x800ed1,%rax
+  80229c:	00 00 00 
+  80229f:	ff d0                	call   *%rax
+    ssize_t res = fsipc(FSREQ_WRITE, NULL);
+  8022a1:	be 00 00 00 00       	mov    $0x0,%esi
+  8022a6:	bf 04 00 00 00       	mov    $0x4,%edi
+  8022ab:	48 b8 68 20 80 00 00 	movabs $0x802068,%rax
+  8022b2:	00 00 00 
+  8022b5:	ff d0                	call   *%rax
+  8022b7:	48 63 d0             	movslq %eax,%rdx
+    written += res;
+  8022ba:	49 01 d4             	add    %rdx,%r12
+  8022bd:	48 85 d2             	test   %rdx,%rdx
+  8022c0:	49 0f 49 d4          	cmovns %r12,%rdx
+}
+  8022c4:	48 89 d0             	mov    %rdx,%rax
+  8022c7:	48 83 c4 18          	add    $0x18,%rsp
+  8022cb:	5b                   	pop    %rbx
+  8022cc:	41 5c                	pop    %r12
+  8022ce:	41 5d                	pop    %r13
+  8022d0:	41 5e                	pop    %r14
+  8022d2:	41 5f                	pop    %r15
+  8022d4:	5d                   	pop    %rbp
+  8022d5:	c3                   	ret
+    while (n > sizeof(fsipcbuf.write.req_buf))
+  8022d6:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+    ssize_t written = 0;
+  8022da:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8022e0:	eb 98                	jmp    80227a <devfile_write+0xb0>
+
+00000000008022e2 <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  8022e2:	55                   	push   %rbp
+  8022e3:	48 89 e5             	mov    %rsp,%rbp
+  8022e6:	41 57                	push   %r15
+  8022e8:	41 56                	push   %r14
+  8022ea:	41 55                	push   %r13
+  8022ec:	41 54                	push   %r12
+  8022ee:	53                   	push   %rbx
+  8022ef:	48 83 ec 18          	sub    $0x18,%rsp
+  8022f3:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  8022f7:	49 89 f6             	mov    %rsi,%r14
+  8022fa:	49 89 d4             	mov    %rdx,%r12
+    while (n > sizeof(fsipcbuf.readRet.ret_buf))
+  8022fd:	48 81 fa 00 10 00 00 	cmp    $0x1000,%rdx
+  802304:	0f 86 ea 00 00 00    	jbe    8023f4 <devfile_read+0x112>
+    ssize_t readsz = 0;
+  80230a:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  802311:	00 
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802312:	49 bf 00 60 80 00 00 	movabs $0x806000,%r15
+  802319:	00 00 00 
+  80231c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802320:	8b 40 0c             	mov    0xc(%rax),%eax
+  802323:	41 89 07             	mov    %eax,(%r15)
+        fsipcbuf.read.req_n = sizeof(fsipcbuf.readRet.ret_buf);
+  802326:	49 c7 47 08 00 10 00 	movq   $0x1000,0x8(%r15)
+  80232d:	00 
+        ssize_t res = fsipc(FSREQ_READ, NULL);
+  80232e:	be 00 00 00 00       	mov    $0x0,%esi
+  802333:	bf 03 00 00 00       	mov    $0x3,%edi
+  802338:	48 b8 68 20 80 00 00 	movabs $0x802068,%rax
+  80233f:	00 00 00 
+  802342:	ff d0                	call   *%rax
+  802344:	4c 63 e8             	movslq %eax,%r13
+        if (res < 0)
+  802347:	4d 85 ed             	test   %r13,%r13
+  80234a:	0f 88 92 00 00 00    	js     8023e2 <devfile_read+0x100>
+        memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  802350:	4c 89 ea             	mov    %r13,%rdx
+  802353:	4c 89 fe             	mov    %r15,%rsi
+  802356:	4c 89 f7             	mov    %r14,%rdi
+  802359:	48 b8 d1 0e 80 00 00 	movabs $0x800ed1,%rax
+  802360:	00 00 00 
+  802363:	ff d0                	call   *%rax
+        if (res < sizeof(fsipcbuf.readRet.ret_buf))
+  802365:	49 81 fd ff 0f 00 00 	cmp    $0xfff,%r13
+  80236c:	76 6d                	jbe    8023db <devfile_read+0xf9>
+        readsz += res;
+  80236e:	4c 01 6d c0          	add    %r13,-0x40(%rbp)
+        buf += res;
+  802372:	4d 01 ee             	add    %r13,%r14
+        n -= res;
+  802375:	4d 29 ec             	sub    %r13,%r12
+    while (n > sizeof(fsipcbuf.readRet.ret_buf))
+  802378:	49 81 fc 00 10 00 00 	cmp    $0x1000,%r12
+  80237f:	77 9b                	ja     80231c <devfile_read+0x3a>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802381:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  802388:	00 00 00 
+  80238b:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  80238f:	8b 51 0c             	mov    0xc(%rcx),%edx
+  802392:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.read.req_n = n;
+  802394:	4c 89 60 08          	mov    %r12,0x8(%rax)
+    ssize_t res = fsipc(FSREQ_READ, NULL);
+  802398:	be 00 00 00 00       	mov    $0x0,%esi
+  80239d:	bf 03 00 00 00       	mov    $0x3,%edi
+  8023a2:	48 b8 68 20 80 00 00 	movabs $0x802068,%rax
+  8023a9:	00 00 00 
+  8023ac:	ff d0                	call   *%rax
+  8023ae:	4c 63 e8             	movslq %eax,%r13
+    if (res < 0)
+  8023b1:	4d 85 ed             	test   %r13,%r13
+  8023b4:	78 2c                	js     8023e2 <devfile_read+0x100>
+    memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  8023b6:	4c 89 ea             	mov    %r13,%rdx
+  8023b9:	48 be 00 60 80 00 00 	movabs $0x806000,%rsi
+  8023c0:	00 00 00 
+  8023c3:	4c 89 f7             	mov    %r14,%rdi
+  8023c6:	48 b8 d1 0e 80 00 00 	movabs $0x800ed1,%rax
+  8023cd:	00 00 00 
+  8023d0:	ff d0                	call   *%rax
+    readsz += res;
+  8023d2:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8023d6:	49 01 c5             	add    %rax,%r13
+    return readsz;
+  8023d9:	eb 07                	jmp    8023e2 <devfile_read+0x100>
+            return readsz + res;
+  8023db:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8023df:	49 01 c5             	add    %rax,%r13
+}
+  8023e2:	4c 89 e8             	mov    %r13,%rax
+  8023e5:	48 83 c4 18          	add    $0x18,%rsp
+  8023e9:	5b                   	pop    %rbx
+  8023ea:	41 5c                	pop    %r12
+  8023ec:	41 5d                	pop    %r13
+  8023ee:	41 5e                	pop    %r14
+  8023f0:	41 5f                	pop    %r15
+  8023f2:	5d                   	pop    %rbp
+  8023f3:	c3                   	ret
+    ssize_t readsz = 0;
+  8023f4:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  8023fb:	00 
+  8023fc:	eb 83                	jmp    802381 <devfile_read+0x9f>
+
+00000000008023fe <open>:
+open(const char *path, int mode) {
+  8023fe:	55                   	push   %rbp
+  8023ff:	48 89 e5             	mov    %rsp,%rbp
+  802402:	41 55                	push   %r13
+  802404:	41 54                	push   %r12
+  802406:	53                   	push   %rbx
+  802407:	48 83 ec 18          	sub    $0x18,%rsp
+  80240b:	49 89 fc             	mov    %rdi,%r12
+  80240e:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  802411:	48 b8 32 0c 80 00 00 	movabs $0x800c32,%rax
+  802418:	00 00 00 
+  80241b:	ff d0                	call   *%rax
+  80241d:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802423:	0f 87 8a 00 00 00    	ja     8024b3 <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802429:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  80242d:	48 b8 e1 19 80 00 00 	movabs $0x8019e1,%rax
+  802434:	00 00 00 
+  802437:	ff d0                	call   *%rax
+  802439:	89 c3                	mov    %eax,%ebx
+  80243b:	85 c0                	test   %eax,%eax
+  80243d:	78 50                	js     80248f <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  80243f:	4c 89 e6             	mov    %r12,%rsi
+  802442:	48 bb 00 60 80 00 00 	movabs $0x806000,%rbx
+  802449:	00 00 00 
+  80244c:	48 89 df             	mov    %rbx,%rdi
+  80244f:	48 b8 70 0c 80 00 00 	movabs $0x800c70,%rax
+  802456:	00 00 00 
+  802459:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  80245b:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  802462:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802466:	bf 01 00 00 00       	mov    $0x1,%edi
+  80246b:	48 b8 68 20 80 00 00 	movabs $0x802068,%rax
+  802472:	00 00 00 
+  802475:	ff d0                	call   *%rax
+  802477:	89 c3                	mov    %eax,%ebx
+  802479:	85 c0                	test   %eax,%eax
+  80247b:	78 1f                	js     80249c <open+0x9e>
+    return fd2num(fd);
+  80247d:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802481:	48 b8 3a 19 80 00 00 	movabs $0x80193a,%rax
+  802488:	00 00 00 
+  80248b:	ff d0                	call   *%rax
+  80248d:	89 c3                	mov    %eax,%ebx
+}
+  80248f:	89 d8                	mov    %ebx,%eax
+  802491:	48 83 c4 18          	add    $0x18,%rsp
+  802495:	5b                   	pop    %rbx
+  802496:	41 5c                	pop    %r12
+  802498:	41 5d                	pop    %r13
+  80249a:	5d                   	pop    %rbp
+  80249b:	c3                   	ret
+        fd_close(fd, 0);
+  80249c:	be 00 00 00 00       	mov    $0x0,%esi
+  8024a1:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8024a5:	48 b8 b6 1a 80 00 00 	movabs $0x801ab6,%rax
+  8024ac:	00 00 00 
+  8024af:	ff d0                	call   *%rax
+        return res;
+  8024b1:	eb dc                	jmp    80248f <open+0x91>
+        return -E_BAD_PATH;
+  8024b3:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  8024b8:	eb d5                	jmp    80248f <open+0x91>
+
+00000000008024ba <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  8024ba:	55                   	push   %rbp
+  8024bb:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc(FSREQ_SYNC, NULL);
+  8024be:	be 00 00 00 00       	mov    $0x0,%esi
+  8024c3:	bf 08 00 00 00       	mov    $0x8,%edi
+  8024c8:	48 b8 68 20 80 00 00 	movabs $0x802068,%rax
+  8024cf:	00 00 00 
+  8024d2:	ff d0                	call   *%rax
+}
+  8024d4:	5d                   	pop    %rbp
+  8024d5:	c3                   	ret
+
+00000000008024d6 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  8024d6:	55                   	push   %rbp
+  8024d7:	48 89 e5             	mov    %rsp,%rbp
+  8024da:	41 54                	push   %r12
+  8024dc:	53                   	push   %rbx
+  8024dd:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8024e0:	48 b8 4c 19 80 00 00 	movabs $0x80194c,%rax
+  8024e7:	00 00 00 
+  8024ea:	ff d0                	call   *%rax
+  8024ec:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  8024ef:	48 be c0 37 80 00 00 	movabs $0x8037c0,%rsi
+  8024f6:	00 00 00 
+  8024f9:	48 89 df             	mov    %rbx,%rdi
+  8024fc:	48 b8 70 0c 80 00 00 	movabs $0x800c70,%rax
+  802503:	00 00 00 
+  802506:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  802508:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  80250d:	41 2b 04 24          	sub    (%r12),%eax
+  802511:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  802517:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  80251e:	00 00 00 
+    stat->st_dev = &devpipe;
+  802521:	48 b8 60 40 80 00 00 	movabs $0x804060,%rax
+  802528:	00 00 00 
+  80252b:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  802532:	b8 00 00 00 00       	mov    $0x0,%eax
+  802537:	5b                   	pop    %rbx
+  802538:	41 5c                	pop    %r12
+  80253a:	5d                   	pop    %rbp
+  80253b:	c3                   	ret
+
+000000000080253c <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  80253c:	55                   	push   %rbp
+  80253d:	48 89 e5             	mov    %rsp,%rbp
+  802540:	41 54                	push   %r12
+  802542:	53                   	push   %rbx
+  802543:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  802546:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80254b:	48 89 fe             	mov    %rdi,%rsi
+  80254e:	bf 00 00 00 00       	mov    $0x0,%edi
+  802553:	49 bc ec 12 80 00 00 	movabs $0x8012ec,%r12
+  80255a:	00 00 00 
+  80255d:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  802560:	48 89 df             	mov    %rbx,%rdi
+  802563:	48 b8 4c 19 80 00 00 	movabs $0x80194c,%rax
+  80256a:	00 00 00 
+  80256d:	ff d0                	call   *%rax
+  80256f:	48 89 c6             	mov    %rax,%rsi
+  802572:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802577:	bf 00 00 00 00       	mov    $0x0,%edi
+  80257c:	41 ff d4             	call   *%r12
+}
+  80257f:	5b                   	pop    %rbx
+  802580:	41 5c                	pop    %r12
+  802582:	5d                   	pop    %rbp
+  802583:	c3                   	ret
+
+0000000000802584 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  802584:	55                   	push   %rbp
+  802585:	48 89 e5             	mov    %rsp,%rbp
+  802588:	41 57                	push   %r15
+  80258a:	41 56                	push   %r14
+  80258c:	41 55                	push   %r13
+  80258e:	41 54                	push   %r12
+  802590:	53                   	push   %rbx
+  802591:	48 83 ec 18          	sub    $0x18,%rsp
+  802595:	49 89 fc             	mov    %rdi,%r12
+  802598:	49 89 f5             	mov    %rsi,%r13
+  80259b:	49 89 d7             	mov    %rdx,%r15
+  80259e:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8025a2:	48 b8 4c 19 80 00 00 	movabs $0x80194c,%rax
+  8025a9:	00 00 00 
+  8025ac:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  8025ae:	4d 85 ff             	test   %r15,%r15
+  8025b1:	0f 84 af 00 00 00    	je     802666 <devpipe_write+0xe2>
+  8025b7:	48 89 c3             	mov    %rax,%rbx
+  8025ba:	4c 89 f8             	mov    %r15,%rax
+  8025bd:	4d 89 ef             	mov    %r13,%r15
+  8025c0:	4c 01 e8             	add    %r13,%rax
+  8025c3:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8025c7:	49 bd f4 11 80 00 00 	movabs $0x8011f4,%r13
+  8025ce:	00 00 00 
+            sys_yield();
+  8025d1:	49 be 91 11 80 00 00 	movabs $0x801191,%r14
+  8025d8:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  8025db:	8b 73 04             	mov    0x4(%rbx),%esi
+  8025de:	48 63 ce             	movslq %esi,%rcx
+  8025e1:	48 63 03             	movslq (%rbx),%rax
+  8025e4:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  8025ea:	48 39 c1             	cmp    %rax,%rcx
+  8025ed:	72 2e                	jb     80261d <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8025ef:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8025f4:	48 89 da             	mov    %rbx,%rdx
+  8025f7:	be 00 10 00 00       	mov    $0x1000,%esi
+  8025fc:	4c 89 e7             	mov    %r12,%rdi
+  8025ff:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  802602:	85 c0                	test   %eax,%eax
+  802604:	74 66                	je     80266c <devpipe_write+0xe8>
+            sys_yield();
+  802606:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  802609:	8b 73 04             	mov    0x4(%rbx),%esi
+  80260c:	48 63 ce             	movslq %esi,%rcx
+  80260f:	48 63 03             	movslq (%rbx),%rax
+  802612:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  802618:	48 39 c1             	cmp    %rax,%rcx
+  80261b:	73 d2                	jae    8025ef <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  80261d:	41 0f b6 3f          	movzbl (%r15),%edi
+  802621:	48 89 ca             	mov    %rcx,%rdx
+  802624:	48 c1 ea 03          	shr    $0x3,%rdx
+  802628:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  80262f:	08 10 20 
+  802632:	48 f7 e2             	mul    %rdx
+  802635:	48 c1 ea 06          	shr    $0x6,%rdx
+  802639:	48 89 d0             	mov    %rdx,%rax
+  80263c:	48 c1 e0 09          	shl    $0x9,%rax
+  802640:	48 29 d0             	sub    %rdx,%rax
+  802643:	48 c1 e0 03          	shl    $0x3,%rax
+  802647:	48 29 c1             	sub    %rax,%rcx
+  80264a:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  80264f:	83 c6 01             	add    $0x1,%esi
+  802652:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  802655:	49 83 c7 01          	add    $0x1,%r15
+  802659:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80265d:	49 39 c7             	cmp    %rax,%r15
+  802660:	0f 85 75 ff ff ff    	jne    8025db <devpipe_write+0x57>
+    return n;
+  802666:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80266a:	eb 05                	jmp    802671 <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  80266c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802671:	48 83 c4 18          	add    $0x18,%rsp
+  802675:	5b                   	pop    %rbx
+  802676:	41 5c                	pop    %r12
+  802678:	41 5d                	pop    %r13
+  80267a:	41 5e                	pop    %r14
+  80267c:	41 5f                	pop    %r15
+  80267e:	5d                   	pop    %rbp
+  80267f:	c3                   	ret
+
+0000000000802680 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  802680:	55                   	push   %rbp
+  802681:	48 89 e5             	mov    %rsp,%rbp
+  802684:	41 57                	push   %r15
+  802686:	41 56                	push   %r14
+  802688:	41 55                	push   %r13
+  80268a:	41 54                	push   %r12
+  80268c:	53                   	push   %rbx
+  80268d:	48 83 ec 18          	sub    $0x18,%rsp
+  802691:	49 89 fc             	mov    %rdi,%r12
+  802694:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  802698:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80269c:	48 b8 4c 19 80 00 00 	movabs $0x80194c,%rax
+  8026a3:	00 00 00 
+  8026a6:	ff d0                	call   *%rax
+  8026a8:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  8026ab:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8026b1:	49 bd f4 11 80 00 00 	movabs $0x8011f4,%r13
+  8026b8:	00 00 00 
+            sys_yield();
+  8026bb:	49 be 91 11 80 00 00 	movabs $0x801191,%r14
+  8026c2:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  8026c5:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  8026ca:	74 7d                	je     802749 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  8026cc:	8b 03                	mov    (%rbx),%eax
+  8026ce:	3b 43 04             	cmp    0x4(%rbx),%eax
+  8026d1:	75 26                	jne    8026f9 <devpipe_read+0x79>
+            if (i > 0) return i;
+  8026d3:	4d 85 ff             	test   %r15,%r15
+  8026d6:	75 77                	jne    80274f <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8026d8:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8026dd:	48 89 da             	mov    %rbx,%rdx
+  8026e0:	be 00 10 00 00       	mov    $0x1000,%esi
+  8026e5:	4c 89 e7             	mov    %r12,%rdi
+  8026e8:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  8026eb:	85 c0                	test   %eax,%eax
+  8026ed:	74 72                	je     802761 <devpipe_read+0xe1>
+            sys_yield();
+  8026ef:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  8026f2:	8b 03                	mov    (%rbx),%eax
+  8026f4:	3b 43 04             	cmp    0x4(%rbx),%eax
+  8026f7:	74 df                	je     8026d8 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  8026f9:	48 63 c8             	movslq %eax,%rcx
+  8026fc:	48 89 ca             	mov    %rcx,%rdx
+  8026ff:	48 c1 ea 03          	shr    $0x3,%rdx
+  802703:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  80270a:	08 10 20 
+  80270d:	48 89 d0             	mov    %rdx,%rax
+  802710:	48 f7 e6             	mul    %rsi
+  802713:	48 c1 ea 06          	shr    $0x6,%rdx
+  802717:	48 89 d0             	mov    %rdx,%rax
+  80271a:	48 c1 e0 09          	shl    $0x9,%rax
+  80271e:	48 29 d0             	sub    %rdx,%rax
+  802721:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  802728:	00 
+  802729:	48 89 c8             	mov    %rcx,%rax
+  80272c:	48 29 d0             	sub    %rdx,%rax
+  80272f:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  802734:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  802738:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  80273c:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  80273f:	49 83 c7 01          	add    $0x1,%r15
+  802743:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  802747:	75 83                	jne    8026cc <devpipe_read+0x4c>
+    return n;
+  802749:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80274d:	eb 03                	jmp    802752 <devpipe_read+0xd2>
+            if (i > 0) return i;
+  80274f:	4c 89 f8             	mov    %r15,%rax
+}
+  802752:	48 83 c4 18          	add    $0x18,%rsp
+  802756:	5b                   	pop    %rbx
+  802757:	41 5c                	pop    %r12
+  802759:	41 5d                	pop    %r13
+  80275b:	41 5e                	pop    %r14
+  80275d:	41 5f                	pop    %r15
+  80275f:	5d                   	pop    %rbp
+  802760:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  802761:	b8 00 00 00 00       	mov    $0x0,%eax
+  802766:	eb ea                	jmp    802752 <devpipe_read+0xd2>
+
+0000000000802768 <pipe>:
+pipe(int pfd[2]) {
+  802768:	55                   	push   %rbp
+  802769:	48 89 e5             	mov    %rsp,%rbp
+  80276c:	41 55                	push   %r13
+  80276e:	41 54                	push   %r12
+  802770:	53                   	push   %rbx
+  802771:	48 81 ec b8 00 00 00 	sub    $0xb8,%rsp
+  802778:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  80277b:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  80277f:	48 b8 e1 19 80 00 00 	movabs $0x8019e1,%rax
+  802786:	00 00 00 
+  802789:	ff d0                	call   *%rax
+  80278b:	89 c3                	mov    %eax,%ebx
+  80278d:	85 c0                	test   %eax,%eax
+  80278f:	0f 88 51 01 00 00    	js     8028e6 <pipe+0x17e>
+        (res = fd_alloc_from(fd2num(fd0) + 1, &fd1)) < 0) goto err;
+  802795:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802799:	48 b8 3a 19 80 00 00 	movabs $0x80193a,%rax
+  8027a0:	00 00 00 
+  8027a3:	ff d0                	call   *%rax
+  8027a5:	8d 78 01             	lea    0x1(%rax),%edi
+  8027a8:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8027ac:	48 b8 68 19 80 00 00 	movabs $0x801968,%rax
+  8027b3:	00 00 00 
+  8027b6:	ff d0                	call   *%rax
+  8027b8:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8027ba:	85 c0                	test   %eax,%eax
+  8027bc:	0f 88 24 01 00 00    	js     8028e6 <pipe+0x17e>
+    va = fd2data(fd0);
+  8027c2:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8027c6:	48 bb 4c 19 80 00 00 	movabs $0x80194c,%rbx
+  8027cd:	00 00 00 
+  8027d0:	ff d3                	call   *%rbx
+  8027d2:	49 89 c5             	mov    %rax,%r13
+    struct RegionOp ops[] = {
+  8027d5:	48 8d bd 30 ff ff ff 	lea    -0xd0(%rbp),%rdi
+  8027dc:	b9 14 00 00 00       	mov    $0x14,%ecx
+  8027e1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027e6:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+  8027e9:	c7 85 34 ff ff ff 46 	movl   $0x46,-0xcc(%rbp)
+  8027f0:	00 00 00 
+  8027f3:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8027f7:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+  8027fe:	48 c7 85 50 ff ff ff 	movq   $0x1000,-0xb0(%rbp)
+  802805:	00 10 00 00 
+  802809:	c7 85 5c ff ff ff 46 	movl   $0x46,-0xa4(%rbp)
+  802810:	00 00 00 
+            {.type = REGION_ALLOC, .dstva = (uintptr_t)fd1, .size = PAGE_SIZE, .perm = PROT_RW | PROT_SHARE},
+  802813:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+    struct RegionOp ops[] = {
+  802817:	48 89 bd 70 ff ff ff 	mov    %rdi,-0x90(%rbp)
+  80281e:	48 c7 85 78 ff ff ff 	movq   $0x1000,-0x88(%rbp)
+  802825:	00 10 00 00 
+  802829:	c7 45 84 46 00 00 00 	movl   $0x46,-0x7c(%rbp)
+  802830:	4c 89 6d 98          	mov    %r13,-0x68(%rbp)
+  802834:	48 c7 45 a0 00 10 00 	movq   $0x1000,-0x60(%rbp)
+  80283b:	00 
+  80283c:	c7 45 a8 01 00 00 00 	movl   $0x1,-0x58(%rbp)
+  802843:	c7 45 ac 46 00 00 00 	movl   $0x46,-0x54(%rbp)
+  80284a:	4c 89 6d b8          	mov    %r13,-0x48(%rbp)
+            {.type = REGION_MAP, .srcva = (uintptr_t)va, .dstva = (uintptr_t)fd2data(fd1), .size = PAGE_SIZE, .perm = PROT_RW | PROT_SHARE},
+  80284e:	ff d3                	call   *%rbx
+    struct RegionOp ops[] = {
+  802850:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802854:	48 c7 45 c8 00 10 00 	movq   $0x1000,-0x38(%rbp)
+  80285b:	00 
+    if ((res = sys_region_batch(ops, sizeof ops / sizeof *ops)) < 0) goto err1;
+  80285c:	be 04 00 00 00       	mov    $0x4,%esi
+  802861:	48 8d bd 30 ff ff ff 	lea    -0xd0(%rbp),%rdi
+  802868:	48 b8 53 13 80 00 00 	movabs $0x801353,%rax
+  80286f:	00 00 00 
+  802872:	ff d0                	call   *%rax
+  802874:	89 c3                	mov    %eax,%ebx
+  802876:	85 c0                	test   %eax,%eax
+  802878:	0f 88 ad 00 00 00    	js     80292b <pipe+0x1c3>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  80287e:	be 00 10 00 00       	mov    $0x1000,%esi
+  802883:	4c 89 ef             	mov    %r13,%rdi
+  802886:	48 b8 c2 11 80 00 00 	movabs $0x8011c2,%rax
+  80288d:	00 00 00 
+  802890:	ff d0                	call   *%rax
+  802892:	83 f8 02             	cmp    $0x2,%eax
+  802895:	75 5f                	jne    8028f6 <pipe+0x18e>
+    fd0->fd_dev_id = devpipe.dev_id;
+  802897:	a1 60 40 80 00 00 00 	movabs 0x804060,%eax
+  80289e:	00 00 
+  8028a0:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8028a4:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  8028a6:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8028aa:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  8028b1:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8028b5:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  8028b7:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8028bb:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  8028c2:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8028c6:	48 bb 3a 19 80 00 00 	movabs $0x80193a,%rbx
+  8028cd:	00 00 00 
+  8028d0:	ff d3                	call   *%rbx
+  8028d2:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  8028d6:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  8028da:	ff d3                	call   *%rbx
+  8028dc:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  8028e1:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  8028e6:	89 d8                	mov    %ebx,%eax
+  8028e8:	48 81 c4 b8 00 00 00 	add    $0xb8,%rsp
+  8028ef:	5b                   	pop    %rbx
+  8028f0:	41 5c                	pop    %r12
+  8028f2:	41 5d                	pop    %r13
+  8028f4:	5d                   	pop    %rbp
+  8028f5:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8028f6:	48 b9 d8 37 80 00 00 	movabs $0x8037d8,%rcx
+  8028fd:	00 00 00 
+  802900:	48 ba f0 36 80 00 00 	movabs $0x8036f0,%rdx
+  802907:	00 00 00 
+  80290a:	be 33 00 00 00       	mov    $0x33,%esi
+  80290f:	48 bf c7 37 80 00 00 	movabs $0x8037c7,%rdi
+  802916:	00 00 00 
+  802919:	b8 00 00 00 00       	mov    $0x0,%eax
+  80291e:	49 b8 fb 01 80 00 00 	movabs $0x8001fb,%r8
+  802925:	00 00 00 
+  802928:	41 ff d0             	call   *%r8
+        ops[i].type = REGION_UNMAP;
+  80292b:	c7 85 30 ff ff ff 02 	movl   $0x2,-0xd0(%rbp)
+  802932:	00 00 00 
+  802935:	c7 85 58 ff ff ff 02 	movl   $0x2,-0xa8(%rbp)
+  80293c:	00 00 00 
+  80293f:	c7 45 80 02 00 00 00 	movl   $0x2,-0x80(%rbp)
+  802946:	c7 45 a8 02 00 00 00 	movl   $0x2,-0x58(%rbp)
+    sys_region_batch(ops, sizeof ops / sizeof *ops);
+  80294d:	be 04 00 00 00       	mov    $0x4,%esi
+  802952:	48 8d bd 30 ff ff ff 	lea    -0xd0(%rbp),%rdi
+  802959:	48 b8 53 13 80 00 00 	movabs $0x801353,%rax
+  802960:	00 00 00 
+  802963:	ff d0                	call   *%rax
+  802965:	e9 7c ff ff ff       	jmp    8028e6 <pipe+0x17e>
+
+000000000080296a <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  80296a:	55                   	push   %rbp
+  80296b:	48 89 e5             	mov    %rsp,%rbp
+  80296e:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  802972:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802976:	48 b8 fb 19 80 00 00 	movabs $0x8019fb,%rax
+  80297d:	00 00 00 
+  802980:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802982:	85 c0                	test   %eax,%eax
+  802984:	78 35                	js     8029bb <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  802986:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80298a:	48 b8 4c 19 80 00 00 	movabs $0x80194c,%rax
+  802991:	00 00 00 
+  802994:	ff d0                	call   *%rax
+  802996:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802999:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80299e:	be 00 10 00 00       	mov    $0x1000,%esi
+  8029a3:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8029a7:	48 b8 f4 11 80 00 00 	movabs $0x8011f4,%rax
+  8029ae:	00 00 00 
+  8029b1:	ff d0                	call   *%rax
+  8029b3:	85 c0                	test   %eax,%eax
+  8029b5:	0f 94 c0             	sete   %al
+  8029b8:	0f b6 c0             	movzbl %al,%eax
+}
+  8029bb:	c9                   	leave
+  8029bc:	c3                   	ret
+
+00000000008029bd <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8029bd:	48 89 f8             	mov    %rdi,%rax
+  8029c0:	48 c1 e8 27          	shr    $0x27,%rax
+  8029c4:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  8029cb:	01 00 00 
+  8029ce:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8029d2:	f6 c2 01             	test   $0x1,%dl
+  8029d5:	74 6d                	je     802a44 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8029d7:	48 89 f8             	mov    %rdi,%rax
+  8029da:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8029de:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8029e5:	01 00 00 
+  8029e8:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8029ec:	f6 c2 01             	test   $0x1,%dl
+  8029ef:	74 62                	je     802a53 <get_uvpt_entry+0x96>
+  8029f1:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8029f8:	01 00 00 
+  8029fb:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8029ff:	f6 c2 80             	test   $0x80,%dl
+  802a02:	75 4f                	jne    802a53 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  802a04:	48 89 f8             	mov    %rdi,%rax
+  802a07:	48 c1 e8 15          	shr    $0x15,%rax
+  802a0b:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802a12:	01 00 00 
+  802a15:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802a19:	f6 c2 01             	test   $0x1,%dl
+  802a1c:	74 44                	je     802a62 <get_uvpt_entry+0xa5>
+  802a1e:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802a25:	01 00 00 
+  802a28:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802a2c:	f6 c2 80             	test   $0x80,%dl
+  802a2f:	75 31                	jne    802a62 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  802a31:	48 c1 ef 0c          	shr    $0xc,%rdi
+  802a35:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802a3c:	01 00 00 
+  802a3f:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  802a43:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  802a44:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  802a4b:	01 00 00 
+  802a4e:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802a52:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  802a53:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802a5a:	01 00 00 
+  802a5d:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802a61:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  802a62:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802a69:	01 00 00 
+  802a6c:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802a70:	c3                   	ret
+
+0000000000802a71 <get_prot>:
+
+int
+get_prot(void *va) {
+  802a71:	55                   	push   %rbp
+  802a72:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  802a75:	48 b8 bd 29 80 00 00 	movabs $0x8029bd,%rax
+  802a7c:	00 00 00 
+  802a7f:	ff d0                	call   *%rax
+  802a81:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  802a84:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  802a89:	89 c1                	mov    %eax,%ecx
+  802a8b:	83 c9 04             	or     $0x4,%ecx
+  802a8e:	f6 c2 01             	test   $0x1,%dl
+  802a91:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  802a94:	89 c1                	mov    %eax,%ecx
+  802a96:	83 c9 02             	or     $0x2,%ecx
+  802a99:	f6 c2 02             	test   $0x2,%dl
+  802a9c:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  802a9f:	89 c1                	mov    %eax,%ecx
+  802aa1:	83 c9 01             	or     $0x1,%ecx
+  802aa4:	48 85 d2             	test   %rdx,%rdx
+  802aa7:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  802aaa:	89 c1                	mov    %eax,%ecx
+  802aac:	83 c9 40             	or     $0x40,%ecx
+  802aaf:	f6 c6 04             	test   $0x4,%dh
+  802ab2:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  802ab5:	5d                   	pop    %rbp
+  802ab6:	c3                   	ret
+
+0000000000802ab7 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  802ab7:	55                   	push   %rbp
+  802ab8:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  802abb:	48 b8 bd 29 80 00 00 	movabs $0x8029bd,%rax
+  802ac2:	00 00 00 
+  802ac5:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  802ac7:	48 c1 e8 06          	shr    $0x6,%rax
+  802acb:	83 e0 01             	and    $0x1,%eax
+}
+  802ace:	5d                   	pop    %rbp
+  802acf:	c3                   	ret
+
+0000000000802ad0 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  802ad0:	55                   	push   %rbp
+  802ad1:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  802ad4:	48 b8 bd 29 80 00 00 	movabs $0x8029bd,%rax
+  802adb:	00 00 00 
+  802ade:	ff d0                	call   *%rax
+  802ae0:	83 e0 01             	and    $0x1,%eax
+}
+  802ae3:	5d                   	pop    %rbp
+  802ae4:	c3                   	ret
+
+0000000000802ae5 <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  802ae5:	55                   	push   %rbp
+  802ae6:	48 89 e5             	mov    %rsp,%rbp
+  802ae9:	41 57                	push   %r15
+  802aeb:	41 56                	push   %r14
+  802aed:	41 55                	push   %r13
+  802aef:	41 54                	push   %r12
+  802af1:	53                   	push   %rbx
+  802af2:	48 83 ec 38          	sub    $0x38,%rsp
+  802af6:	49 89 f7             	mov    %rsi,%r15
+  802af9:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+                    }
+                    continue;
+                }
+                for (int ptei = 0; ptei < PT_ENTRY_COUNT; ptei++) {
+                    uintptr_t pte_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, pdei, ptei, 0);
+                    pte_t pte = uvpt[VPT(pte_addr)];
+  802aff:	49 bd 00 00 00 00 00 	movabs $0x10000000000,%r13
+  802b06:	01 00 00 
+  802b09:	4d 89 e6             	mov    %r12,%r14
+  802b0c:	49 89 fc             	mov    %rdi,%r12
+  802b0f:	e9 19 01 00 00       	jmp    802c2d <foreach_shared_region+0x148>
+  802b14:	48 89 5d b0          	mov    %rbx,-0x50(%rbp)
+  802b18:	4c 89 75 a8          	mov    %r14,-0x58(%rbp)
+  802b1c:	eb 52                	jmp    802b70 <foreach_shared_region+0x8b>
+                for (int ptei = 0; ptei < PT_ENTRY_COUNT; ptei++) {
+  802b1e:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802b25:	48 81 fb 00 00 20 00 	cmp    $0x200000,%rbx
+  802b2c:	74 2e                	je     802b5c <foreach_shared_region+0x77>
+                    uintptr_t pte_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, pdei, ptei, 0);
+  802b2e:	48 89 df             	mov    %rbx,%rdi
+  802b31:	4c 09 f7             	or     %r14,%rdi
+                    pte_t pte = uvpt[VPT(pte_addr)];
+  802b34:	48 89 f8             	mov    %rdi,%rax
+  802b37:	48 c1 e8 0c          	shr    $0xc,%rax
+  802b3b:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+                    if ((pte & PTE_P) && (pte & PTE_SHARE)) {
+  802b40:	25 01 04 00 00       	and    $0x401,%eax
+  802b45:	48 3d 01 04 00 00    	cmp    $0x401,%rax
+  802b4b:	75 d1                	jne    802b1e <foreach_shared_region+0x39>
+                        fun((void*)pte_addr, (void*)(pte_addr + PAGE_SIZE), arg);
+  802b4d:	48 8d b7 00 10 00 00 	lea    0x1000(%rdi),%rsi
+  802b54:	4c 89 fa             	mov    %r15,%rdx
+  802b57:	41 ff d4             	call   *%r12
+  802b5a:	eb c2                	jmp    802b1e <foreach_shared_region+0x39>
+            for (int pdei = 0; pdei < PD_ENTRY_COUNT; pdei++) {
+  802b5c:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  802b63:	00 
+  802b64:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802b68:	48 3d 00 00 00 40    	cmp    $0x40000000,%rax
+  802b6e:	74 46                	je     802bb6 <foreach_shared_region+0xd1>
+                uintptr_t pde_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, pdei, 0, 0);
+  802b70:	4c 8b 75 c8          	mov    -0x38(%rbp),%r14
+  802b74:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802b78:	49 09 c6             	or     %rax,%r14
+                pde_t pde = uvpd[VPD(pde_addr)];
+  802b7b:	4c 89 f0             	mov    %r14,%rax
+  802b7e:	48 c1 e8 15          	shr    $0x15,%rax
+  802b82:	48 b9 00 00 00 80 00 	movabs $0x10080000000,%rcx
+  802b89:	01 00 00 
+  802b8c:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+                if (!(pde & PTE_P)) {
+  802b90:	a8 01                	test   $0x1,%al
+  802b92:	74 c8                	je     802b5c <foreach_shared_region+0x77>
+                if (pde & PTE_PS) {
+  802b94:	48 89 c3             	mov    %rax,%rbx
+  802b97:	81 e3 80 00 00 00    	and    $0x80,%ebx
+  802b9d:	74 8f                	je     802b2e <foreach_shared_region+0x49>
+                    if (pde & PTE_SHARE) {
+  802b9f:	f6 c4 04             	test   $0x4,%ah
+  802ba2:	74 b8                	je     802b5c <foreach_shared_region+0x77>
+                        fun((void*)pde_addr, (void*)(pde_addr + 1024 * 1024 * 2), arg);
+  802ba4:	49 8d b6 00 00 20 00 	lea    0x200000(%r14),%rsi
+  802bab:	4c 89 fa             	mov    %r15,%rdx
+  802bae:	4c 89 f7             	mov    %r14,%rdi
+  802bb1:	41 ff d4             	call   *%r12
+  802bb4:	eb a6                	jmp    802b5c <foreach_shared_region+0x77>
+  802bb6:	48 8b 5d b0          	mov    -0x50(%rbp),%rbx
+  802bba:	4c 8b 75 a8          	mov    -0x58(%rbp),%r14
+        for (int pdpei = 0; pdpei < PDP_ENTRY_COUNT; pdpei++) {
+  802bbe:	48 81 c3 00 00 00 40 	add    $0x40000000,%rbx
+  802bc5:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802bcc:	00 00 00 
+  802bcf:	48 39 c3             	cmp    %rax,%rbx
+  802bd2:	74 4c                	je     802c20 <foreach_shared_region+0x13b>
+            uintptr_t pdpe_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, 0, 0, 0);
+  802bd4:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802bd8:	48 09 d8             	or     %rbx,%rax
+  802bdb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+            pdpe_t pdpe = uvpdp[VPDP(pdpe_addr)];
+  802bdf:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802be3:	48 b9 00 00 40 80 00 	movabs $0x10080400000,%rcx
+  802bea:	01 00 00 
+  802bed:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+            if (!(pdpe & PTE_P)) {
+  802bf1:	a8 01                	test   $0x1,%al
+  802bf3:	74 c9                	je     802bbe <foreach_shared_region+0xd9>
+            if (pdpe & PTE_PS) {
+  802bf5:	48 89 c1             	mov    %rax,%rcx
+  802bf8:	81 e1 80 00 00 00    	and    $0x80,%ecx
+  802bfe:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  802c02:	0f 84 0c ff ff ff    	je     802b14 <foreach_shared_region+0x2f>
+                if (pdpe & PTE_SHARE) {
+  802c08:	f6 c4 04             	test   $0x4,%ah
+  802c0b:	74 b1                	je     802bbe <foreach_shared_region+0xd9>
+                    fun((void*)pdpe_addr, (void*)(pdpe_addr + 1024 * 1024 * 1024), arg); 
+  802c0d:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  802c11:	48 8d b7 00 00 00 40 	lea    0x40000000(%rdi),%rsi
+  802c18:	4c 89 fa             	mov    %r15,%rdx
+  802c1b:	41 ff d4             	call   *%r12
+  802c1e:	eb 9e                	jmp    802bbe <foreach_shared_region+0xd9>
+    for (int pml4ei = 0; pml4ei < PML4_ENTRY_COUNT; pml4ei++) {
+  802c20:	49 83 c6 01          	add    $0x1,%r14
+  802c24:	49 81 fe 00 02 00 00 	cmp    $0x200,%r14
+  802c2b:	74 24                	je     802c51 <foreach_shared_region+0x16c>
+        pml4e_t pml4e = uvpml4[VPML4(pml4_addr)];
+  802c2d:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  802c34:	01 00 00 
+  802c37:	4a 8b 04 f0          	mov    (%rax,%r14,8),%rax
+        if (!(pml4e & PTE_P)) {
+  802c3b:	a8 01                	test   $0x1,%al
+  802c3d:	74 e1                	je     802c20 <foreach_shared_region+0x13b>
+  802c3f:	4c 89 f0             	mov    %r14,%rax
+  802c42:	48 c1 e0 27          	shl    $0x27,%rax
+  802c46:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  802c4a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802c4f:	eb 83                	jmp    802bd4 <foreach_shared_region+0xef>
+            }
+        }
+    }
+    
+    return 0;
+}
+  802c51:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c56:	48 83 c4 38          	add    $0x38,%rsp
+  802c5a:	5b                   	pop    %rbx
+  802c5b:	41 5c                	pop    %r12
+  802c5d:	41 5d                	pop    %r13
+  802c5f:	41 5e                	pop    %r14
+  802c61:	41 5f                	pop    %r15
+  802c63:	5d                   	pop    %rbp
+  802c64:	c3                   	ret
+
+0000000000802c65 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  802c65:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c6a:	c3                   	ret
+
+0000000000802c6b <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  802c6b:	55                   	push   %rbp
+  802c6c:	48 89 e5             	mov    %rsp,%rbp
+  802c6f:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  802c72:	48 be fc 37 80 00 00 	movabs $0x8037fc,%rsi
+  802c79:	00 00 00 
+  802c7c:	48 b8 70 0c 80 00 00 	movabs $0x800c70,%rax
+  802c83:	00 00 00 
+  802c86:	ff d0                	call   *%rax
+    return 0;
+}
+  802c88:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c8d:	5d                   	pop    %rbp
+  802c8e:	c3                   	ret
+
+0000000000802c8f <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  802c8f:	55                   	push   %rbp
+  802c90:	48 89 e5             	mov    %rsp,%rbp
+  802c93:	41 57                	push   %r15
+  802c95:	41 56                	push   %r14
+  802c97:	41 55                	push   %r13
+  802c99:	41 54                	push   %r12
+  802c9b:	53                   	push   %rbx
+  802c9c:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  802ca3:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  802caa:	48 85 d2             	test   %rdx,%rdx
+  802cad:	74 7a                	je     802d29 <devcons_write+0x9a>
+  802caf:	49 89 d6             	mov    %rdx,%r14
+  802cb2:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802cb8:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  802cbd:	49 bf 6a 0e 80 00 00 	movabs $0x800e6a,%r15
+  802cc4:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  802cc7:	4c 89 f3             	mov    %r14,%rbx
+  802cca:	48 29 f3             	sub    %rsi,%rbx
+  802ccd:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802cd2:	48 39 c3             	cmp    %rax,%rbx
+  802cd5:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  802cd9:	4c 63 eb             	movslq %ebx,%r13
+  802cdc:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  802ce3:	48 01 c6             	add    %rax,%rsi
+  802ce6:	4c 89 ea             	mov    %r13,%rdx
+  802ce9:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802cf0:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  802cf3:	4c 89 ee             	mov    %r13,%rsi
+  802cf6:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802cfd:	48 b8 97 10 80 00 00 	movabs $0x801097,%rax
+  802d04:	00 00 00 
+  802d07:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  802d09:	41 01 dc             	add    %ebx,%r12d
+  802d0c:	49 63 f4             	movslq %r12d,%rsi
+  802d0f:	4c 39 f6             	cmp    %r14,%rsi
+  802d12:	72 b3                	jb     802cc7 <devcons_write+0x38>
+    return res;
+  802d14:	49 63 c4             	movslq %r12d,%rax
+}
+  802d17:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  802d1e:	5b                   	pop    %rbx
+  802d1f:	41 5c                	pop    %r12
+  802d21:	41 5d                	pop    %r13
+  802d23:	41 5e                	pop    %r14
+  802d25:	41 5f                	pop    %r15
+  802d27:	5d                   	pop    %rbp
+  802d28:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  802d29:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802d2f:	eb e3                	jmp    802d14 <devcons_write+0x85>
+
+0000000000802d31 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  802d31:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  802d34:	ba 00 00 00 00       	mov    $0x0,%edx
+  802d39:	48 85 c0             	test   %rax,%rax
+  802d3c:	74 55                	je     802d93 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  802d3e:	55                   	push   %rbp
+  802d3f:	48 89 e5             	mov    %rsp,%rbp
+  802d42:	41 55                	push   %r13
+  802d44:	41 54                	push   %r12
+  802d46:	53                   	push   %rbx
+  802d47:	48 83 ec 08          	sub    $0x8,%rsp
+  802d4b:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  802d4e:	48 bb c4 10 80 00 00 	movabs $0x8010c4,%rbx
+  802d55:	00 00 00 
+  802d58:	49 bc 91 11 80 00 00 	movabs $0x801191,%r12
+  802d5f:	00 00 00 
+  802d62:	eb 03                	jmp    802d67 <devcons_read+0x36>
+  802d64:	41 ff d4             	call   *%r12
+  802d67:	ff d3                	call   *%rbx
+  802d69:	85 c0                	test   %eax,%eax
+  802d6b:	74 f7                	je     802d64 <devcons_read+0x33>
+    if (c < 0) return c;
+  802d6d:	48 63 d0             	movslq %eax,%rdx
+  802d70:	78 13                	js     802d85 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  802d72:	ba 00 00 00 00       	mov    $0x0,%edx
+  802d77:	83 f8 04             	cmp    $0x4,%eax
+  802d7a:	74 09                	je     802d85 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  802d7c:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  802d80:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  802d85:	48 89 d0             	mov    %rdx,%rax
+  802d88:	48 83 c4 08          	add    $0x8,%rsp
+  802d8c:	5b                   	pop    %rbx
+  802d8d:	41 5c                	pop    %r12
+  802d8f:	41 5d                	pop    %r13
+  802d91:	5d                   	pop    %rbp
+  802d92:	c3                   	ret
+  802d93:	48 89 d0             	mov    %rdx,%rax
+  802d96:	c3                   	ret
+
+0000000000802d97 <cputchar>:
+cputchar(int ch) {
+  802d97:	55                   	push   %rbp
+  802d98:	48 89 e5             	mov    %rsp,%rbp
+  802d9b:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  802d9f:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  802da3:	be 01 00 00 00       	mov    $0x1,%esi
+  802da8:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  802dac:	48 b8 97 10 80 00 00 	movabs $0x801097,%rax
+  802db3:	00 00 00 
+  802db6:	ff d0                	call   *%rax
+}
+  802db8:	c9                   	leave
+  802db9:	c3                   	ret
+
+0000000000802dba <getchar>:
+getchar(void) {
+  802dba:	55                   	push   %rbp
+  802dbb:	48 89 e5             	mov    %rsp,%rbp
+  802dbe:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  802dc2:	ba 01 00 00 00       	mov    $0x1,%edx
+  802dc7:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  802dcb:	bf 00 00 00 00       	mov    $0x0,%edi
+  802dd0:	48 b8 de 1c 80 00 00 	movabs $0x801cde,%rax
+  802dd7:	00 00 00 
+  802dda:	ff d0                	call   *%rax
+  802ddc:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  802dde:	85 c0                	test   %eax,%eax
+  802de0:	78 06                	js     802de8 <getchar+0x2e>
+  802de2:	74 08                	je     802dec <getchar+0x32>
+  802de4:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  802de8:	89 d0                	mov    %edx,%eax
+  802dea:	c9                   	leave
+  802deb:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  802dec:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  802df1:	eb f5                	jmp    802de8 <getchar+0x2e>
+
+0000000000802df3 <iscons>:
+iscons(int fdnum) {
+  802df3:	55                   	push   %rbp
+  802df4:	48 89 e5             	mov    %rsp,%rbp
+  802df7:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  802dfb:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802dff:	48 b8 fb 19 80 00 00 	movabs $0x8019fb,%rax
+  802e06:	00 00 00 
+  802e09:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802e0b:	85 c0                	test   %eax,%eax
+  802e0d:	78 18                	js     802e27 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  802e0f:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802e13:	48 b8 a0 40 80 00 00 	movabs $0x8040a0,%rax
+  802e1a:	00 00 00 
+  802e1d:	8b 00                	mov    (%rax),%eax
+  802e1f:	39 02                	cmp    %eax,(%rdx)
+  802e21:	0f 94 c0             	sete   %al
+  802e24:	0f b6 c0             	movzbl %al,%eax
+}
+  802e27:	c9                   	leave
+  802e28:	c3                   	ret
+
+0000000000802e29 <opencons>:
+opencons(void) {
+  802e29:	55                   	push   %rbp
+  802e2a:	48 89 e5             	mov    %rsp,%rbp
+  802e2d:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802e31:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  802e35:	48 b8 e1 19 80 00 00 	movabs $0x8019e1,%rax
+  802e3c:	00 00 00 
+  802e3f:	ff d0                	call   *%rax
+  802e41:	85 c0                	test   %eax,%eax
+  802e43:	78 49                	js     802e8e <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  802e45:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802e4a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802e4f:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  802e53:	bf 00 00 00 00       	mov    $0x0,%edi
+  802e58:	48 b8 20 12 80 00 00 	movabs $0x801220,%rax
+  802e5f:	00 00 00 
+  802e62:	ff d0                	call   *%rax
+  802e64:	85 c0                	test   %eax,%eax
+  802e66:	78 26                	js     802e8e <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  802e68:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802e6c:	a1 a0 40 80 00 00 00 	movabs 0x8040a0,%eax
+  802e73:	00 00 
+  802e75:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  802e77:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802e7b:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  802e82:	48 b8 3a 19 80 00 00 	movabs $0x80193a,%rax
+  802e89:	00 00 00 
+  802e8c:	ff d0                	call   *%rax
+}
+  802e8e:	c9                   	leave
+  802e8f:	c3                   	ret
+
+0000000000802e90 <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  802e90:	55                   	push   %rbp
+  802e91:	48 89 e5             	mov    %rsp,%rbp
+  802e94:	41 55                	push   %r13
+  802e96:	41 54                	push   %r12
+  802e98:	53                   	push   %rbx
+  802e99:	48 83 ec 08          	sub    $0x8,%rsp
+  802e9d:	49 89 fc             	mov    %rdi,%r12
+  802ea0:	48 89 f7             	mov    %rsi,%rdi
+  802ea3:	48 89 d3             	mov    %rdx,%rbx
+  802ea6:	49 89 cd             	mov    %rcx,%r13
+    // LAB 9: Your code here:
+    int res = sys_ipc_recv(!pg ? (void*)MAX_USER_ADDRESS : pg, !size ? 0 : *size);
+  802ea9:	be 00 00 00 00       	mov    $0x0,%esi
+  802eae:	48 85 d2             	test   %rdx,%rdx
+  802eb1:	74 03                	je     802eb6 <ipc_recv+0x26>
+  802eb3:	48 8b 32             	mov    (%rdx),%rsi
+  802eb6:	48 85 ff             	test   %rdi,%rdi
+  802eb9:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802ec0:	00 00 00 
+  802ec3:	48 0f 44 f8          	cmove  %rax,%rdi
+  802ec7:	48 b8 f2 15 80 00 00 	movabs $0x8015f2,%rax
+  802ece:	00 00 00 
+  802ed1:	ff d0                	call   *%rax
+    if (res < 0) {
+  802ed3:	85 c0                	test   %eax,%eax
+  802ed5:	78 66                	js     802f3d <ipc_recv+0xad>
+        if (size) {
+            *size = 0;
+        }
+        return res;
+    }
+    if (from_env_store) {
+  802ed7:	4d 85 e4             	test   %r12,%r12
+  802eda:	74 14                	je     802ef0 <ipc_recv+0x60>
+        *from_env_store = thisenv->env_ipc_from;
+  802edc:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802ee3:	00 00 00 
+  802ee6:	8b 80 ac 01 00 00    	mov    0x1ac(%rax),%eax
+  802eec:	41 89 04 24          	mov    %eax,(%r12)
+    }
+    if (perm_store) {
+  802ef0:	4d 85 ed             	test   %r13,%r13
+  802ef3:	74 14                	je     802f09 <ipc_recv+0x79>
+        *perm_store = thisenv->env_ipc_perm;
+  802ef5:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802efc:	00 00 00 
+  802eff:	8b 80 b0 01 00 00    	mov    0x1b0(%rax),%eax
+  802f05:	41 89 45 00          	mov    %eax,0x0(%r13)
+    }
+    if (size) {
+  802f09:	48 85 db             	test   %rbx,%rbx
+  802f0c:	74 14                	je     802f22 <ipc_recv+0x92>
+        *size = thisenv->env_ipc_maxsz;
+  802f0e:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802f15:	00 00 00 
+  802f18:	48 8b 80 a0 01 00 00 	mov    0x1a0(%rax),%rax
+  802f1f:	48 89 03             	mov    %rax,(%rbx)
+    }
+    return thisenv->env_ipc_value;
+  802f22:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802f29:	00 00 00 
+  802f2c:	8b 80 a8 01 00 00    	mov    0x1a8(%rax),%eax
+}
+  802f32:	48 83 c4 08          	add    $0x8,%rsp
+  802f36:	5b                   	pop    %rbx
+  802f37:	41 5c                	pop    %r12
+  802f39:	41 5d                	pop    %r13
+  802f3b:	5d                   	pop    %rbp
+  802f3c:	c3                   	ret
+        if (from_env_store) {
+  802f3d:	4d 85 e4             	test   %r12,%r12
+  802f40:	74 08                	je     802f4a <ipc_recv+0xba>
+            *from_env_store = 0;
+  802f42:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  802f49:	00 
+        if (perm_store) {
+  802f4a:	4d 85 ed             	test   %r13,%r13
+  802f4d:	74 08                	je     802f57 <ipc_recv+0xc7>
+            *perm_store = 0;
+  802f4f:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  802f56:	00 
+        if (size) {
+  802f57:	48 85 db             	test   %rbx,%rbx
+  802f5a:	74 d6                	je     802f32 <ipc_recv+0xa2>
+            *size = 0;
+  802f5c:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  802f63:	eb cd                	jmp    802f32 <ipc_recv+0xa2>
+
+0000000000802f65 <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  802f65:	55                   	push   %rbp
+  802f66:	48 89 e5             	mov    %rsp,%rbp
+  802f69:	41 57                	push   %r15
+  802f6b:	41 56                	push   %r14
+  802f6d:	41 55                	push   %r13
+  802f6f:	41 54                	push   %r12
+  802f71:	53                   	push   %rbx
+  802f72:	48 83 ec 18          	sub    $0x18,%rsp
+  802f76:	41 89 fd             	mov    %edi,%r13d
+  802f79:	89 75 cc             	mov    %esi,-0x34(%rbp)
+  802f7c:	49 89 cc             	mov    %rcx,%r12
+  802f7f:	44 89 45 c8          	mov    %r8d,-0x38(%rbp)
+    // LAB 9: Your code here:
+    int res = 0;
+    while ((res = sys_ipc_try_send(to_env, val, !pg ? (void*)MAX_USER_ADDRESS : pg, size, perm)) < 0) {
+  802f83:	48 85 d2             	test   %rdx,%rdx
+  802f86:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802f8d:	00 00 00 
+  802f90:	48 0f 45 c2          	cmovne %rdx,%rax
+  802f94:	48 89 c3             	mov    %rax,%rbx
+  802f97:	49 be c6 15 80 00 00 	movabs $0x8015c6,%r14
+  802f9e:	00 00 00 
+        if (res != -E_IPC_NOT_RECV) {
+            panic("sys_ipc_try_send failed: %i", res);
+        }
+        sys_yield();
+  802fa1:	49 bf 91 11 80 00 00 	movabs $0x801191,%r15
+  802fa8:	00 00 00 
+    while ((res = sys_ipc_try_send(to_env, val, !pg ? (void*)MAX_USER_ADDRESS : pg, size, perm)) < 0) {
+  802fab:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  802fae:	44 8b 45 c8          	mov    -0x38(%rbp),%r8d
+  802fb2:	4c 89 e1             	mov    %r12,%rcx
+  802fb5:	48 89 da             	mov    %rbx,%rdx
+  802fb8:	44 89 ef             	mov    %r13d,%edi
+  802fbb:	41 ff d6             	call   *%r14
+  802fbe:	85 c0                	test   %eax,%eax
+  802fc0:	79 37                	jns    802ff9 <ipc_send+0x94>
+        if (res != -E_IPC_NOT_RECV) {
+  802fc2:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  802fc5:	75 05                	jne    802fcc <ipc_send+0x67>
+        sys_yield();
+  802fc7:	41 ff d7             	call   *%r15
+  802fca:	eb df                	jmp    802fab <ipc_send+0x46>
+            panic("sys_ipc_try_send failed: %i", res);
+  802fcc:	89 c1                	mov    %eax,%ecx
+  802fce:	48 ba 08 38 80 00 00 	movabs $0x803808,%rdx
+  802fd5:	00 00 00 
+  802fd8:	be 40 00 00 00       	mov    $0x40,%esi
+  802fdd:	48 bf 24 38 80 00 00 	movabs $0x803824,%rdi
+  802fe4:	00 00 00 
+  802fe7:	b8 00 00 00 00       	mov    $0x0,%eax
+  802fec:	49 b8 fb 01 80 00 00 	movabs $0x8001fb,%r8
+  802ff3:	00 00 00 
+  802ff6:	41 ff d0             	call   *%r8
+    }
+    return;
+}
+  802ff9:	48 83 c4 18          	add    $0x18,%rsp
+  802ffd:	5b                   	pop    %rbx
+  802ffe:	41 5c                	pop    %r12
+  803000:	41 5d                	pop    %r13
+  803002:	41 5e                	pop    %r14
+  803004:	41 5f                	pop    %r15
+  803006:	5d                   	pop    %rbp
+  803007:	c3                   	ret
+
+0000000000803008 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  803008:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  80300d:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  803014:	00 00 00 
+  803017:	48 69 d0 d0 01 00 00 	imul   $0x1d0,%rax,%rdx
+  80301e:	48 01 ca             	add    %rcx,%rdx
+  803021:	8b 92 e8 00 00 00    	mov    0xe8(%rdx),%edx
+  803027:	39 fa                	cmp    %edi,%edx
+  803029:	74 12                	je     80303d <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  80302b:	48 83 c0 01          	add    $0x1,%rax
+  80302f:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  803035:	75 e0                	jne    803017 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  803037:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80303c:	c3                   	ret
+            return envs[i].env_id;
+  80303d:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+  803044:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  80304b:	00 00 00 
+  80304e:	48 01 d0             	add    %rdx,%rax
+  803051:	8b 80 e0 00 00 00    	mov    0xe0(%rax),%eax
+  803057:	c3                   	ret
+
+0000000000803058 <__rodata_start>:
+  803058:	66 61                	data16 (bad)
+  80305a:	75 6c                	jne    8030c8 <__rodata_start+0x70>
+  80305c:	74 20                	je     80307e <__rodata_start+0x26>
+  80305e:	25 6c 78 0a 00       	and    $0xa786c,%eax
+  803063:	75 73                	jne    8030d8 <__rodata_start+0x80>
+  803065:	65 72 2f             	gs jb  803097 <__rodata_start+0x3f>
+  803068:	66 61                	data16 (bad)
+  80306a:	75 6c                	jne    8030d8 <__rodata_start+0x80>
+  80306c:	74 61                	je     8030cf <__rodata_start+0x77>
+  80306e:	6c                   	insb   (%dx),%es:(%rdi)
+  80306f:	6c                   	insb   (%dx),%es:(%rdi)
+  803070:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803071:	63 2e                	movsxd (%rsi),%ebp
+  803073:	63 00                	movsxd (%rax),%eax
+  803075:	25 73 0a 00 0f       	and    $0xf000a73,%eax
+  80307a:	1f                   	(bad)
+  80307b:	80 00 00             	addb   $0x0,(%rax)
+  80307e:	00 00                	add    %al,(%rax)
+  803080:	61                   	(bad)
+  803081:	6c                   	insb   (%dx),%es:(%rdi)
+  803082:	6c                   	insb   (%dx),%es:(%rdi)
+  803083:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803084:	63 61 74             	movsxd 0x74(%rcx),%esp
+  803087:	69 6e 67 20 61 74 20 	imul   $0x20746120,0x67(%rsi),%ebp
+  80308e:	25 6c 78 20 69       	and    $0x6920786c,%eax
+  803093:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803094:	20 70 61             	and    %dh,0x61(%rax)
+  803097:	67 65 20 66 61       	and    %ah,%gs:0x61(%esi)
+  80309c:	75 6c                	jne    80310a <__rodata_start+0xb2>
+  80309e:	74 20                	je     8030c0 <__rodata_start+0x68>
+  8030a0:	68 61 6e 64 6c       	push   $0x6c646e61
+  8030a5:	65 72 3a             	gs jb  8030e2 <__rodata_start+0x8a>
+  8030a8:	20 25 69 00 00 00    	and    %ah,0x69(%rip)        # 803117 <__rodata_start+0xbf>
+  8030ae:	00 00                	add    %al,(%rax)
+  8030b0:	74 68                	je     80311a <__rodata_start+0xc2>
+  8030b2:	69 73 20 73 74 72 69 	imul   $0x69727473,0x20(%rbx),%esi
+  8030b9:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8030ba:	67 20 77 61          	and    %dh,0x61(%edi)
+  8030be:	73 20                	jae    8030e0 <__rodata_start+0x88>
+  8030c0:	66 61                	data16 (bad)
+  8030c2:	75 6c                	jne    803130 <__rodata_start+0xd8>
+  8030c4:	74 65                	je     80312b <__rodata_start+0xd3>
+  8030c6:	64 20 69 6e          	and    %ch,%fs:0x6e(%rcx)
+  8030ca:	20 61 74             	and    %ah,0x74(%rcx)
+  8030cd:	20 25 6c 78 00 3c    	and    %ah,0x3c00786c(%rip)        # 3c80a93f <__bss_end+0x3c00293f>
+  8030d3:	75 6e                	jne    803143 <__rodata_start+0xeb>
+  8030d5:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  8030d9:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8030da:	3e 00 0f             	ds add %cl,(%rdi)
+  8030dd:	1f                   	(bad)
+  8030de:	40 00 5b 25          	rex add %bl,0x25(%rbx)
+  8030e2:	30 38                	xor    %bh,(%rax)
+  8030e4:	78 5d                	js     803143 <__rodata_start+0xeb>
+  8030e6:	20 75 73             	and    %dh,0x73(%rbp)
+  8030e9:	65 72 20             	gs jb  80310c <__rodata_start+0xb4>
+  8030ec:	70 61                	jo     80314f <__rodata_start+0xf7>
+  8030ee:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8030ef:	69 63 20 69 6e 20 25 	imul   $0x25206e69,0x20(%rbx),%esp
+  8030f6:	73 20                	jae    803118 <__rodata_start+0xc0>
+  8030f8:	61                   	(bad)
+  8030f9:	74 20                	je     80311b <__rodata_start+0xc3>
+  8030fb:	25 73 3a 25 64       	and    $0x64253a73,%eax
+  803100:	3a 20                	cmp    (%rax),%ah
+  803102:	00 30                	add    %dh,(%rax)
+  803104:	31 32                	xor    %esi,(%rdx)
+  803106:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  80310d:	41                   	rex.B
+  80310e:	42                   	rex.X
+  80310f:	43                   	rex.XB
+  803110:	44                   	rex.R
+  803111:	45                   	rex.RB
+  803112:	46 00 30             	rex.RX add %r14b,(%rax)
+  803115:	31 32                	xor    %esi,(%rdx)
+  803117:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  80311e:	61                   	(bad)
+  80311f:	62 63 64 65 66       	(bad)
+  803124:	00 28                	add    %ch,(%rax)
+  803126:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803127:	75 6c                	jne    803195 <__rodata_start+0x13d>
+  803129:	6c                   	insb   (%dx),%es:(%rdi)
+  80312a:	29 00                	sub    %eax,(%rax)
+  80312c:	65 72 72             	gs jb  8031a1 <__rodata_start+0x149>
+  80312f:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803130:	72 20                	jb     803152 <__rodata_start+0xfa>
+  803132:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  803137:	73 70                	jae    8031a9 <__rodata_start+0x151>
+  803139:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  80313d:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  803144:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803145:	72 00                	jb     803147 <__rodata_start+0xef>
+  803147:	62 61 64 20 65       	(bad)
+  80314c:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80314d:	76 69                	jbe    8031b8 <__rodata_start+0x160>
+  80314f:	72 6f                	jb     8031c0 <__rodata_start+0x168>
+  803151:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803152:	6d                   	insl   (%dx),%es:(%rdi)
+  803153:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803155:	74 00                	je     803157 <__rodata_start+0xff>
+  803157:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  80315e:	20 70 61             	and    %dh,0x61(%rax)
+  803161:	72 61                	jb     8031c4 <__rodata_start+0x16c>
+  803163:	6d                   	insl   (%dx),%es:(%rdi)
+  803164:	65 74 65             	gs je  8031cc <__rodata_start+0x174>
+  803167:	72 00                	jb     803169 <__rodata_start+0x111>
+  803169:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80316a:	75 74                	jne    8031e0 <__rodata_start+0x188>
+  80316c:	20 6f 66             	and    %ch,0x66(%rdi)
+  80316f:	20 6d 65             	and    %ch,0x65(%rbp)
+  803172:	6d                   	insl   (%dx),%es:(%rdi)
+  803173:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803174:	72 79                	jb     8031ef <__rodata_start+0x197>
+  803176:	00 6f 75             	add    %ch,0x75(%rdi)
+  803179:	74 20                	je     80319b <__rodata_start+0x143>
+  80317b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80317c:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  803180:	76 69                	jbe    8031eb <__rodata_start+0x193>
+  803182:	72 6f                	jb     8031f3 <__rodata_start+0x19b>
+  803184:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803185:	6d                   	insl   (%dx),%es:(%rdi)
+  803186:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803188:	74 73                	je     8031fd <__rodata_start+0x1a5>
+  80318a:	00 63 6f             	add    %ah,0x6f(%rbx)
+  80318d:	72 72                	jb     803201 <__rodata_start+0x1a9>
+  80318f:	75 70                	jne    803201 <__rodata_start+0x1a9>
+  803191:	74 65                	je     8031f8 <__rodata_start+0x1a0>
+  803193:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  803198:	75 67                	jne    803201 <__rodata_start+0x1a9>
+  80319a:	20 69 6e             	and    %ch,0x6e(%rcx)
+  80319d:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  80319f:	00 73 65             	add    %dh,0x65(%rbx)
+  8031a2:	67 6d                	insl   (%dx),%es:(%edi)
+  8031a4:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  8031a6:	74 61                	je     803209 <__rodata_start+0x1b1>
+  8031a8:	74 69                	je     803213 <__rodata_start+0x1bb>
+  8031aa:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8031ab:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8031ac:	20 66 61             	and    %ah,0x61(%rsi)
+  8031af:	75 6c                	jne    80321d <__rodata_start+0x1c5>
+  8031b1:	74 00                	je     8031b3 <__rodata_start+0x15b>
+  8031b3:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  8031ba:	20 45 4c             	and    %al,0x4c(%rbp)
+  8031bd:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  8031c1:	61                   	(bad)
+  8031c2:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  8031c7:	20 73 75             	and    %dh,0x75(%rbx)
+  8031ca:	63 68 20             	movsxd 0x20(%rax),%ebp
+  8031cd:	73 79                	jae    803248 <__rodata_start+0x1f0>
+  8031cf:	73 74                	jae    803245 <__rodata_start+0x1ed>
+  8031d1:	65 6d                	gs insl (%dx),%es:(%rdi)
+  8031d3:	20 63 61             	and    %ah,0x61(%rbx)
+  8031d6:	6c                   	insb   (%dx),%es:(%rdi)
+  8031d7:	6c                   	insb   (%dx),%es:(%rdi)
+  8031d8:	00 65 6e             	add    %ah,0x6e(%rbp)
+  8031db:	74 72                	je     80324f <__rodata_start+0x1f7>
+  8031dd:	79 20                	jns    8031ff <__rodata_start+0x1a7>
+  8031df:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8031e0:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8031e1:	74 20                	je     803203 <__rodata_start+0x1ab>
+  8031e3:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  8031e5:	75 6e                	jne    803255 <__rodata_start+0x1fd>
+  8031e7:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  8031eb:	76 20                	jbe    80320d <__rodata_start+0x1b5>
+  8031ed:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  8031f4:	72 65                	jb     80325b <__rodata_start+0x203>
+  8031f6:	63 76 69             	movsxd 0x69(%rsi),%esi
+  8031f9:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8031fa:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  8031fe:	65 78 70             	gs js  803271 <__rodata_start+0x219>
+  803201:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  803206:	20 65 6e             	and    %ah,0x6e(%rbp)
+  803209:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  80320d:	20 66 69             	and    %ah,0x69(%rsi)
+  803210:	6c                   	insb   (%dx),%es:(%rdi)
+  803211:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  803215:	20 66 72             	and    %ah,0x72(%rsi)
+  803218:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  80321d:	61                   	(bad)
+  80321e:	63 65 20             	movsxd 0x20(%rbp),%esp
+  803221:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803222:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803223:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  803227:	6b 00 74             	imul   $0x74,(%rax),%eax
+  80322a:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80322b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80322c:	20 6d 61             	and    %ch,0x61(%rbp)
+  80322f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803230:	79 20                	jns    803252 <__rodata_start+0x1fa>
+  803232:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  803239:	72 65                	jb     8032a0 <__rodata_start+0x248>
+  80323b:	20 6f 70             	and    %ch,0x70(%rdi)
+  80323e:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803240:	00 66 69             	add    %ah,0x69(%rsi)
+  803243:	6c                   	insb   (%dx),%es:(%rdi)
+  803244:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  803248:	20 62 6c             	and    %ah,0x6c(%rdx)
+  80324b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80324c:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  80324f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803250:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803251:	74 20                	je     803273 <__rodata_start+0x21b>
+  803253:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  803255:	75 6e                	jne    8032c5 <__rodata_start+0x26d>
+  803257:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  80325b:	76 61                	jbe    8032be <__rodata_start+0x266>
+  80325d:	6c                   	insb   (%dx),%es:(%rdi)
+  80325e:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  803265:	00 
+  803266:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  80326d:	72 65                	jb     8032d4 <__rodata_start+0x27c>
+  80326f:	61                   	(bad)
+  803270:	64 79 20             	fs jns 803293 <__rodata_start+0x23b>
+  803273:	65 78 69             	gs js  8032df <__rodata_start+0x287>
+  803276:	73 74                	jae    8032ec <__rodata_start+0x294>
+  803278:	73 00                	jae    80327a <__rodata_start+0x222>
+  80327a:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80327b:	70 65                	jo     8032e2 <__rodata_start+0x28a>
+  80327d:	72 61                	jb     8032e0 <__rodata_start+0x288>
+  80327f:	74 69                	je     8032ea <__rodata_start+0x292>
+  803281:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803282:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803283:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  803286:	74 20                	je     8032a8 <__rodata_start+0x250>
+  803288:	73 75                	jae    8032ff <__rodata_start+0x2a7>
+  80328a:	70 70                	jo     8032fc <__rodata_start+0x2a4>
+  80328c:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80328d:	72 74                	jb     803303 <__rodata_start+0x2ab>
+  80328f:	65 64 00 6f 70       	gs add %ch,%fs:0x70(%rdi)
+  803294:	65 72 61             	gs jb  8032f8 <__rodata_start+0x2a0>
+  803297:	74 69                	je     803302 <__rodata_start+0x2aa>
+  803299:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80329a:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80329b:	20 69 6e             	and    %ch,0x6e(%rcx)
+  80329e:	74 65                	je     803305 <__rodata_start+0x2ad>
+  8032a0:	72 72                	jb     803314 <__rodata_start+0x2bc>
+  8032a2:	75 70                	jne    803314 <__rodata_start+0x2bc>
+  8032a4:	74 65                	je     80330b <__rodata_start+0x2b3>
+  8032a6:	64 00 6e 6f          	add    %ch,%fs:0x6f(%rsi)
+  8032aa:	74 20                	je     8032cc <__rodata_start+0x274>
+  8032ac:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  8032ae:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8032af:	75 67                	jne    803318 <__rodata_start+0x2c0>
+  8032b1:	68 20 43 50 55       	push   $0x55504320
+  8032b6:	20 74 69 6d          	and    %dh,0x6d(%rcx,%rbp,2)
+  8032ba:	65 00 0f             	add    %cl,%gs:(%rdi)
+  8032bd:	1f                   	(bad)
+  8032be:	40 00 38             	add    %dil,(%rax)
+  8032c1:	05 80 00 00 00       	add    $0x80,%eax
+  8032c6:	00 00                	add    %al,(%rax)
+  8032c8:	79 0b                	jns    8032d5 <__rodata_start+0x27d>
+  8032ca:	80 00 00             	addb   $0x0,(%rax)
+  8032cd:	00 00                	add    %al,(%rax)
+  8032cf:	00 69 0b             	add    %ch,0xb(%rcx)
+  8032d2:	80 00 00             	addb   $0x0,(%rax)
+  8032d5:	00 00                	add    %al,(%rax)
+  8032d7:	00 79 0b             	add    %bh,0xb(%rcx)
+  8032da:	80 00 00             	addb   $0x0,(%rax)
+  8032dd:	00 00                	add    %al,(%rax)
+  8032df:	00 79 0b             	add    %bh,0xb(%rcx)
+  8032e2:	80 00 00             	addb   $0x0,(%rax)
+  8032e5:	00 00                	add    %al,(%rax)
+  8032e7:	00 79 0b             	add    %bh,0xb(%rcx)
+  8032ea:	80 00 00             	addb   $0x0,(%rax)
+  8032ed:	00 00                	add    %al,(%rax)
+  8032ef:	00 79 0b             	add    %bh,0xb(%rcx)
+  8032f2:	80 00 00             	addb   $0x0,(%rax)
+  8032f5:	00 00                	add    %al,(%rax)
+  8032f7:	00 57 05             	add    %dl,0x5(%rdi)
+  8032fa:	80 00 00             	addb   $0x0,(%rax)
+  8032fd:	00 00                	add    %al,(%rax)
+  8032ff:	00 79 0b             	add    %bh,0xb(%rcx)
+  803302:	80 00 00             	addb   $0x0,(%rax)
+  803305:	00 00                	add    %al,(%rax)
+  803307:	00 79 0b             	add    %bh,0xb(%rcx)
+  80330a:	80 00 00             	addb   $0x0,(%rax)
+  80330d:	00 00                	add    %al,(%rax)
+  80330f:	00 4b 05             	add    %cl,0x5(%rbx)
+  803312:	80 00 00             	addb   $0x0,(%rax)
+  803315:	00 00                	add    %al,(%rax)
+  803317:	00 c5                	add    %al,%ch
+  803319:	05 80 00 00 00       	add    $0x80,%eax
+  80331e:	00 00                	add    %al,(%rax)
+  803320:	79 0b                	jns    80332d <__rodata_start+0x2d5>
+  803322:	80 00 00             	addb   $0x0,(%rax)
+  803325:	00 00                	add    %al,(%rax)
+  803327:	00 4b 05             	add    %cl,0x5(%rbx)
+  80332a:	80 00 00             	addb   $0x0,(%rax)
+  80332d:	00 00                	add    %al,(%rax)
+  80332f:	00 91 05 80 00 00    	add    %dl,0x8005(%rcx)
+  803335:	00 00                	add    %al,(%rax)
+  803337:	00 91 05 80 00 00    	add    %dl,0x8005(%rcx)
+  80333d:	00 00                	add    %al,(%rax)
+  80333f:	00 91 05 80 00 00    	add    %dl,0x8005(%rcx)
+  803345:	00 00                	add    %al,(%rax)
+  803347:	00 91 05 80 00 00    	add    %dl,0x8005(%rcx)
+  80334d:	00 00                	add    %al,(%rax)
+  80334f:	00 91 05 80 00 00    	add    %dl,0x8005(%rcx)
+  803355:	00 00                	add    %al,(%rax)
+  803357:	00 91 05 80 00 00    	add    %dl,0x8005(%rcx)
+  80335d:	00 00                	add    %al,(%rax)
+  80335f:	00 91 05 80 00 00    	add    %dl,0x8005(%rcx)
+  803365:	00 00                	add    %al,(%rax)
+  803367:	00 91 05 80 00 00    	add    %dl,0x8005(%rcx)
+  80336d:	00 00                	add    %al,(%rax)
+  80336f:	00 91 05 80 00 00    	add    %dl,0x8005(%rcx)
+  803375:	00 00                	add    %al,(%rax)
+  803377:	00 79 0b             	add    %bh,0xb(%rcx)
+  80337a:	80 00 00             	addb   $0x0,(%rax)
+  80337d:	00 00                	add    %al,(%rax)
+  80337f:	00 79 0b             	add    %bh,0xb(%rcx)
+  803382:	80 00 00             	addb   $0x0,(%rax)
+  803385:	00 00                	add    %al,(%rax)
+  803387:	00 79 0b             	add    %bh,0xb(%rcx)
+  80338a:	80 00 00             	addb   $0x0,(%rax)
+  80338d:	00 00                	add    %al,(%rax)
+  80338f:	00 79 0b             	add    %bh,0xb(%rcx)
+  803392:	80 00 00             	addb   $0x0,(%rax)
+  803395:	00 00                	add    %al,(%rax)
+  803397:	00 79 0b             	add    %bh,0xb(%rcx)
+  80339a:	80 00 00             	addb   $0x0,(%rax)
+  80339d:	00 00                	add    %al,(%rax)
+  80339f:	00 79 0b             	add    %bh,0xb(%rcx)
+  8033a2:	80 00 00             	addb   $0x0,(%rax)
+  8033a5:	00 00                	add    %al,(%rax)
+  8033a7:	00 79 0b             	add    %bh,0xb(%rcx)
+  8033aa:	80 00 00             	addb   $0x0,(%rax)
+  8033ad:	00 00                	add    %al,(%rax)
+  8033af:	00 79 0b             	add    %bh,0xb(%rcx)
+  8033b2:	80 00 00             	addb   $0x0,(%rax)
+  8033b5:	00 00                	add    %al,(%rax)
+  8033b7:	00 79 0b             	add    %bh,0xb(%rcx)
+  8033ba:	80 00 00             	addb   $0x0,(%rax)
+  8033bd:	00 00                	add    %al,(%rax)
+  8033bf:	00 79 0b             	add    %bh,0xb(%rcx)
+  8033c2:	80 00 00             	addb   $0x0,(%rax)
+  8033c5:	00 00                	add    %al,(%rax)
+  8033c7:	00 79 0b             	add    %bh,0xb(%rcx)
+  8033ca:	80 00 00             	addb   $0x0,(%rax)
+  8033cd:	00 00                	add    %al,(%rax)
+  8033cf:	00 79 0b             	add    %bh,0xb(%rcx)
+  8033d2:	80 00 00             	addb   $0x0,(%rax)
+  8033d5:	00 00                	add    %al,(%rax)
+  8033d7:	00 79 0b             	add    %bh,0xb(%rcx)
+  8033da:	80 00 00             	addb   $0x0,(%rax)
+  8033dd:	00 00                	add    %al,(%rax)
+  8033df:	00 79 0b             	add    %bh,0xb(%rcx)
+  8033e2:	80 00 00             	addb   $0x0,(%rax)
+  8033e5:	00 00                	add    %al,(%rax)
+  8033e7:	00 79 0b             	add    %bh,0xb(%rcx)
+  8033ea:	80 00 00             	addb   $0x0,(%rax)
+  8033ed:	00 00                	add    %al,(%rax)
+  8033ef:	00 79 0b             	add    %bh,0xb(%rcx)
+  8033f2:	80 00 00             	addb   $0x0,(%rax)
+  8033f5:	00 00                	add    %al,(%rax)
+  8033f7:	00 79 0b             	add    %bh,0xb(%rcx)
+  8033fa:	80 00 00             	addb   $0x0,(%rax)
+  8033fd:	00 00                	add    %al,(%rax)
+  8033ff:	00 79 0b             	add    %bh,0xb(%rcx)
+  803402:	80 00 00             	addb   $0x0,(%rax)
+  803405:	00 00                	add    %al,(%rax)
+  803407:	00 79 0b             	add    %bh,0xb(%rcx)
+  80340a:	80 00 00             	addb   $0x0,(%rax)
+  80340d:	00 00                	add    %al,(%rax)
+  80340f:	00 79 0b             	add    %bh,0xb(%rcx)
+  803412:	80 00 00             	addb   $0x0,(%rax)
+  803415:	00 00                	add    %al,(%rax)
+  803417:	00 79 0b             	add    %bh,0xb(%rcx)
+  80341a:	80 00 00             	addb   $0x0,(%rax)
+  80341d:	00 00                	add    %al,(%rax)
+  80341f:	00 79 0b             	add    %bh,0xb(%rcx)
+  803422:	80 00 00             	addb   $0x0,(%rax)
+  803425:	00 00                	add    %al,(%rax)
+  803427:	00 79 0b             	add    %bh,0xb(%rcx)
+  80342a:	80 00 00             	addb   $0x0,(%rax)
+  80342d:	00 00                	add    %al,(%rax)
+  80342f:	00 79 0b             	add    %bh,0xb(%rcx)
+  803432:	80 00 00             	addb   $0x0,(%rax)
+  803435:	00 00                	add    %al,(%rax)
+  803437:	00 79 0b             	add    %bh,0xb(%rcx)
+  80343a:	80 00 00             	addb   $0x0,(%rax)
+  80343d:	00 00                	add    %al,(%rax)
+  80343f:	00 79 0b             	add    %bh,0xb(%rcx)
+  803442:	80 00 00             	addb   $0x0,(%rax)
+  803445:	00 00                	add    %al,(%rax)
+  803447:	00 79 0b             	add    %bh,0xb(%rcx)
+  80344a:	80 00 00             	addb   $0x0,(%rax)
+  80344d:	00 00                	add    %al,(%rax)
+  80344f:	00 79 0b             	add    %bh,0xb(%rcx)
+  803452:	80 00 00             	addb   $0x0,(%rax)
+  803455:	00 00                	add    %al,(%rax)
+  803457:	00 79 0b             	add    %bh,0xb(%rcx)
+  80345a:	80 00 00             	addb   $0x0,(%rax)
+  80345d:	00 00                	add    %al,(%rax)
+  80345f:	00 79 0b             	add    %bh,0xb(%rcx)
+  803462:	80 00 00             	addb   $0x0,(%rax)
+  803465:	00 00                	add    %al,(%rax)
+  803467:	00 9c 0a 80 00 00 00 	add    %bl,0x80(%rdx,%rcx,1)
+  80346e:	00 00                	add    %al,(%rax)
+  803470:	79 0b                	jns    80347d <__rodata_start+0x425>
+  803472:	80 00 00             	addb   $0x0,(%rax)
+  803475:	00 00                	add    %al,(%rax)
+  803477:	00 79 0b             	add    %bh,0xb(%rcx)
+  80347a:	80 00 00             	addb   $0x0,(%rax)
+  80347d:	00 00                	add    %al,(%rax)
+  80347f:	00 79 0b             	add    %bh,0xb(%rcx)
+  803482:	80 00 00             	addb   $0x0,(%rax)
+  803485:	00 00                	add    %al,(%rax)
+  803487:	00 79 0b             	add    %bh,0xb(%rcx)
+  80348a:	80 00 00             	addb   $0x0,(%rax)
+  80348d:	00 00                	add    %al,(%rax)
+  80348f:	00 79 0b             	add    %bh,0xb(%rcx)
+  803492:	80 00 00             	addb   $0x0,(%rax)
+  803495:	00 00                	add    %al,(%rax)
+  803497:	00 79 0b             	add    %bh,0xb(%rcx)
+  80349a:	80 00 00             	addb   $0x0,(%rax)
+  80349d:	00 00                	add    %al,(%rax)
+  80349f:	00 79 0b             	add    %bh,0xb(%rcx)
+  8034a2:	80 00 00             	addb   $0x0,(%rax)
+  8034a5:	00 00                	add    %al,(%rax)
+  8034a7:	00 79 0b             	add    %bh,0xb(%rcx)
+  8034aa:	80 00 00             	addb   $0x0,(%rax)
+  8034ad:	00 00                	add    %al,(%rax)
+  8034af:	00 79 0b             	add    %bh,0xb(%rcx)
+  8034b2:	80 00 00             	addb   $0x0,(%rax)
+  8034b5:	00 00                	add    %al,(%rax)
+  8034b7:	00 79 0b             	add    %bh,0xb(%rcx)
+  8034ba:	80 00 00             	addb   $0x0,(%rax)
+  8034bd:	00 00                	add    %al,(%rax)
+  8034bf:	00 e8                	add    %ch,%al
+  8034c1:	05 80 00 00 00       	add    $0x80,%eax
+  8034c6:	00 00                	add    %al,(%rax)
+  8034c8:	b7 07                	mov    $0x7,%bh
+  8034ca:	80 00 00             	addb   $0x0,(%rax)
+  8034cd:	00 00                	add    %al,(%rax)
+  8034cf:	00 79 0b             	add    %bh,0xb(%rcx)
+  8034d2:	80 00 00             	addb   $0x0,(%rax)
+  8034d5:	00 00                	add    %al,(%rax)
+  8034d7:	00 79 0b             	add    %bh,0xb(%rcx)
+  8034da:	80 00 00             	addb   $0x0,(%rax)
+  8034dd:	00 00                	add    %al,(%rax)
+  8034df:	00 79 0b             	add    %bh,0xb(%rcx)
+  8034e2:	80 00 00             	addb   $0x0,(%rax)
+  8034e5:	00 00                	add    %al,(%rax)
+  8034e7:	00 79 0b             	add    %bh,0xb(%rcx)
+  8034ea:	80 00 00             	addb   $0x0,(%rax)
+  8034ed:	00 00                	add    %al,(%rax)
+  8034ef:	00 17                	add    %dl,(%rdi)
+  8034f1:	06                   	(bad)
+  8034f2:	80 00 00             	addb   $0x0,(%rax)
+  8034f5:	00 00                	add    %al,(%rax)
+  8034f7:	00 79 0b             	add    %bh,0xb(%rcx)
+  8034fa:	80 00 00             	addb   $0x0,(%rax)
+  8034fd:	00 00                	add    %al,(%rax)
+  8034ff:	00 79 0b             	add    %bh,0xb(%rcx)
+  803502:	80 00 00             	addb   $0x0,(%rax)
+  803505:	00 00                	add    %al,(%rax)
+  803507:	00 dd                	add    %bl,%ch
+  803509:	05 80 00 00 00       	add    $0x80,%eax
+  80350e:	00 00                	add    %al,(%rax)
+  803510:	79 0b                	jns    80351d <__rodata_start+0x4c5>
+  803512:	80 00 00             	addb   $0x0,(%rax)
+  803515:	00 00                	add    %al,(%rax)
+  803517:	00 79 0b             	add    %bh,0xb(%rcx)
+  80351a:	80 00 00             	addb   $0x0,(%rax)
+  80351d:	00 00                	add    %al,(%rax)
+  80351f:	00 5f 09             	add    %bl,0x9(%rdi)
+  803522:	80 00 00             	addb   $0x0,(%rax)
+  803525:	00 00                	add    %al,(%rax)
+  803527:	00 29                	add    %ch,(%rcx)
+  803529:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80352f:	00 79 0b             	add    %bh,0xb(%rcx)
+  803532:	80 00 00             	addb   $0x0,(%rax)
+  803535:	00 00                	add    %al,(%rax)
+  803537:	00 79 0b             	add    %bh,0xb(%rcx)
+  80353a:	80 00 00             	addb   $0x0,(%rax)
+  80353d:	00 00                	add    %al,(%rax)
+  80353f:	00 ae 06 80 00 00    	add    %ch,0x8006(%rsi)
+  803545:	00 00                	add    %al,(%rax)
+  803547:	00 79 0b             	add    %bh,0xb(%rcx)
+  80354a:	80 00 00             	addb   $0x0,(%rax)
+  80354d:	00 00                	add    %al,(%rax)
+  80354f:	00 8b 08 80 00 00    	add    %cl,0x8008(%rbx)
+  803555:	00 00                	add    %al,(%rax)
+  803557:	00 79 0b             	add    %bh,0xb(%rcx)
+  80355a:	80 00 00             	addb   $0x0,(%rax)
+  80355d:	00 00                	add    %al,(%rax)
+  80355f:	00 79 0b             	add    %bh,0xb(%rcx)
+  803562:	80 00 00             	addb   $0x0,(%rax)
+  803565:	00 00                	add    %al,(%rax)
+  803567:	00 9c 0a 80 00 00 00 	add    %bl,0x80(%rdx,%rcx,1)
+  80356e:	00 00                	add    %al,(%rax)
+  803570:	79 0b                	jns    80357d <__rodata_start+0x525>
+  803572:	80 00 00             	addb   $0x0,(%rax)
+  803575:	00 00                	add    %al,(%rax)
+  803577:	00 41 05             	add    %al,0x5(%rcx)
+  80357a:	80 00 00             	addb   $0x0,(%rax)
+  80357d:	00 00                	add    %al,(%rax)
+	...
+
+0000000000803580 <error_string>:
+	...
+  803588:	35 31 80 00 00 00 00 00 47 31 80 00 00 00 00 00     51......G1......
+  803598:	57 31 80 00 00 00 00 00 69 31 80 00 00 00 00 00     W1......i1......
+  8035a8:	77 31 80 00 00 00 00 00 8b 31 80 00 00 00 00 00     w1.......1......
+  8035b8:	a0 31 80 00 00 00 00 00 b3 31 80 00 00 00 00 00     .1.......1......
+  8035c8:	c5 31 80 00 00 00 00 00 d9 31 80 00 00 00 00 00     .1.......1......
+  8035d8:	e9 31 80 00 00 00 00 00 fc 31 80 00 00 00 00 00     .1.......1......
+  8035e8:	13 32 80 00 00 00 00 00 29 32 80 00 00 00 00 00     .2......)2......
+  8035f8:	41 32 80 00 00 00 00 00 59 32 80 00 00 00 00 00     A2......Y2......
+  803608:	66 32 80 00 00 00 00 00 30 36 80 00 00 00 00 00     f2......06......
+  803618:	7a 32 80 00 00 00 00 00 92 32 80 00 00 00 00 00     z2.......2......
+  803628:	a8 32 80 00 00 00 00 00 66 69 6c 65 20 69 73 20     .2......file is 
+  803638:	6e 6f 74 20 61 20 76 61 6c 69 64 20 65 78 65 63     not a valid exec
+  803648:	75 74 61 62 6c 65 00 90 73 79 73 63 61 6c 6c 20     utable..syscall 
+  803658:	25 7a 64 20 72 65 74 75 72 6e 65 64 20 25 7a 64     %zd returned %zd
+  803668:	20 28 3e 20 30 29 00 6c 69 62 2f 73 79 73 63 61      (> 0).lib/sysca
+  803678:	6c 6c 2e 63 00 0f 1f 00 55 73 65 72 73 70 61 63     ll.c....Userspac
+  803688:	65 20 70 61 67 65 20 66 61 75 6c 74 20 72 69 70     e page fault rip
+  803698:	3d 25 30 38 6c 58 20 76 61 3d 25 30 38 6c 58 20     =%08lX va=%08lX 
+  8036a8:	65 72 72 3d 25 78 0a 00 6c 69 62 2f 70 67 66 61     err=%x..lib/pgfa
+  8036b8:	75 6c 74 2e 63 00 73 65 74 5f 70 67 66 61 75 6c     ult.c.set_pgfaul
+  8036c8:	74 5f 68 61 6e 64 6c 65 72 3a 20 25 69 00 5f 70     t_handler: %i._p
+  8036d8:	66 68 61 6e 64 6c 65 72 5f 69 6e 69 74 69 74 69     fhandler_inititi
+  8036e8:	61 6c 6c 69 7a 65 64 00 61 73 73 65 72 74 69 6f     allized.assertio
+  8036f8:	6e 20 66 61 69 6c 65 64 3a 20 25 73 00 0f 1f 00     n failed: %s....
+  803708:	5b 25 30 38 78 5d 20 75 6e 6b 6e 6f 77 6e 20 64     [%08x] unknown d
+  803718:	65 76 69 63 65 20 74 79 70 65 20 25 64 0a 00 00     evice type %d...
+  803728:	5b 25 30 38 78 5d 20 66 74 72 75 6e 63 61 74 65     [%08x] ftruncate
+  803738:	20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65 0a      %d -- bad mode.
+  803748:	00 5b 25 30 38 78 5d 20 72 65 61 64 20 25 64 20     .[%08x] read %d 
+  803758:	2d 2d 20 62 61 64 20 6d 6f 64 65 0a 00 5b 25 30     -- bad mode..[%0
+  803768:	38 78 5d 20 77 72 69 74 65 20 25 64 20 2d 2d 20     8x] write %d -- 
+  803778:	62 61 64 20 6d 6f 64 65 0a 00 66 2e 0f 1f 84 00     bad mode..f.....
+  803788:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803798:	0f 1f 84 00 00 00 00 00                             ........
+
+00000000008037a0 <devtab>:
+  8037a0:	20 40 80 00 00 00 00 00 60 40 80 00 00 00 00 00      @......`@......
+  8037b0:	a0 40 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .@..............
+  8037c0:	3c 70 69 70 65 3e 00 6c 69 62 2f 70 69 70 65 2e     <pipe>.lib/pipe.
+  8037d0:	63 00 70 69 70 65 00 90 73 79 73 5f 72 65 67 69     c.pipe..sys_regi
+  8037e0:	6f 6e 5f 72 65 66 73 28 76 61 2c 20 50 41 47 45     on_refs(va, PAGE
+  8037f0:	5f 53 49 5a 45 29 20 3d 3d 20 32 00 3c 63 6f 6e     _SIZE) == 2.<con
+  803800:	73 3e 00 63 6f 6e 73 00 73 79 73 5f 69 70 63 5f     s>.cons.sys_ipc_
+  803810:	74 72 79 5f 73 65 6e 64 20 66 61 69 6c 65 64 3a     try_send failed:
+  803820:	20 25 69 00 6c 69 62 2f 69 70 63 2e 63 00 66 2e      %i.lib/ipc.c.f.
+  803830:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803840:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803850:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803860:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803870:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803880:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803890:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8038a0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8038b0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8038c0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8038d0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8038e0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8038f0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803900:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803910:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803920:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803930:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803940:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803950:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803960:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803970:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803980:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803990:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8039a0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8039b0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8039c0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8039d0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8039e0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8039f0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803a00:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803a10:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803a20:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803a30:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803a40:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803a50:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803a60:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803a70:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803a80:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803a90:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803aa0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803ab0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803ac0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803ad0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803ae0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803af0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803b00:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803b10:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803b20:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803b30:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803b40:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803b50:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803b60:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803b70:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803b80:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803b90:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803ba0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803bb0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803bc0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803bd0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803be0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803bf0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803c00:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803c10:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803c20:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803c30:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803c40:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803c50:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803c60:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803c70:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803c80:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803c90:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803ca0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803cb0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803cc0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803cd0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803ce0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803cf0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803d00:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803d10:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803d20:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803d30:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803d40:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803d50:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803d60:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803d70:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803d80:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803d90:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803da0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803db0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803dc0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803dd0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803de0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803df0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803e00:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803e10:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803e20:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803e30:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803e40:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803e50:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803e60:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803e70:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803e80:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803e90:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803ea0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803eb0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803ec0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803ed0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803ee0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803ef0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803f00:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803f10:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803f20:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803f30:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803f40:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803f50:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803f60:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803f70:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803f80:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803f90:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803fa0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803fb0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803fc0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803fd0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803fe0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803ff0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 90     ....f.........f.
@@ -0,0 +1,6156 @@
+
+obj/user/faultallocbad:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 ea 00 00 00       	call   80010d <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <handler>:
+ * doesn't work because we sys_cputs instead of cprintf (exercise: why?) */
+
+#include <inc/lib.h>
+
+bool
+handler(struct UTrapframe *utf) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	53                   	push   %rbx
+  80002a:	48 83 ec 08          	sub    $0x8,%rsp
+    int r;
+    void *addr = (void *)utf->utf_fault_va;
+  80002e:	48 8b 1f             	mov    (%rdi),%rbx
+
+    cprintf("fault %lx\n", (unsigned long)addr);
+  800031:	48 89 de             	mov    %rbx,%rsi
+  800034:	48 bf 38 30 80 00 00 	movabs $0x803038,%rdi
+  80003b:	00 00 00 
+  80003e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800043:	48 ba 29 03 80 00 00 	movabs $0x800329,%rdx
+  80004a:	00 00 00 
+  80004d:	ff d2                	call   *%rdx
+    if ((r = sys_alloc_region(0, ROUNDDOWN(addr, PAGE_SIZE),
+  80004f:	48 89 de             	mov    %rbx,%rsi
+  800052:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+  800059:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80005e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800063:	bf 00 00 00 00       	mov    $0x0,%edi
+  800068:	48 b8 fe 11 80 00 00 	movabs $0x8011fe,%rax
+  80006f:	00 00 00 
+  800072:	ff d0                	call   *%rax
+  800074:	85 c0                	test   %eax,%eax
+  800076:	78 32                	js     8000aa <handler+0x85>
+                              PAGE_SIZE, PROT_RW)) < 0)
+        panic("allocating at %lx in page fault handler: %i", (unsigned long)addr, r);
+    snprintf((char *)addr, 100, "this string was faulted in at %lx", (unsigned long)addr);
+  800078:	48 89 d9             	mov    %rbx,%rcx
+  80007b:	48 ba 88 30 80 00 00 	movabs $0x803088,%rdx
+  800082:	00 00 00 
+  800085:	be 64 00 00 00       	mov    $0x64,%esi
+  80008a:	48 89 df             	mov    %rbx,%rdi
+  80008d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800092:	49 b8 d3 0b 80 00 00 	movabs $0x800bd3,%r8
+  800099:	00 00 00 
+  80009c:	41 ff d0             	call   *%r8
+    return 1;
+}
+  80009f:	b8 01 00 00 00       	mov    $0x1,%eax
+  8000a4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8000a8:	c9                   	leave
+  8000a9:	c3                   	ret
+        panic("allocating at %lx in page fault handler: %i", (unsigned long)addr, r);
+  8000aa:	41 89 c0             	mov    %eax,%r8d
+  8000ad:	48 89 d9             	mov    %rbx,%rcx
+  8000b0:	48 ba 58 30 80 00 00 	movabs $0x803058,%rdx
+  8000b7:	00 00 00 
+  8000ba:	be 0e 00 00 00       	mov    $0xe,%esi
+  8000bf:	48 bf 43 30 80 00 00 	movabs $0x803043,%rdi
+  8000c6:	00 00 00 
+  8000c9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000ce:	49 b9 d9 01 80 00 00 	movabs $0x8001d9,%r9
+  8000d5:	00 00 00 
+  8000d8:	41 ff d1             	call   *%r9
+
+00000000008000db <umain>:
+
+void
+umain(int argc, char **argv) {
+  8000db:	55                   	push   %rbp
+  8000dc:	48 89 e5             	mov    %rsp,%rbp
+    add_pgfault_handler(handler);
+  8000df:	48 bf 25 00 80 00 00 	movabs $0x800025,%rdi
+  8000e6:	00 00 00 
+  8000e9:	48 b8 c3 16 80 00 00 	movabs $0x8016c3,%rax
+  8000f0:	00 00 00 
+  8000f3:	ff d0                	call   *%rax
+    sys_cputs((char *)0xDEADBEEF, 4);
+  8000f5:	be 04 00 00 00       	mov    $0x4,%esi
+  8000fa:	bf ef be ad de       	mov    $0xdeadbeef,%edi
+  8000ff:	48 b8 75 10 80 00 00 	movabs $0x801075,%rax
+  800106:	00 00 00 
+  800109:	ff d0                	call   *%rax
+}
+  80010b:	5d                   	pop    %rbp
+  80010c:	c3                   	ret
+
+000000000080010d <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  80010d:	55                   	push   %rbp
+  80010e:	48 89 e5             	mov    %rsp,%rbp
+  800111:	41 56                	push   %r14
+  800113:	41 55                	push   %r13
+  800115:	41 54                	push   %r12
+  800117:	53                   	push   %rbx
+  800118:	41 89 fd             	mov    %edi,%r13d
+  80011b:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  80011e:	48 ba d8 40 80 00 00 	movabs $0x8040d8,%rdx
+  800125:	00 00 00 
+  800128:	48 b8 d8 40 80 00 00 	movabs $0x8040d8,%rax
+  80012f:	00 00 00 
+  800132:	48 39 c2             	cmp    %rax,%rdx
+  800135:	73 17                	jae    80014e <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  800137:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  80013a:	49 89 c4             	mov    %rax,%r12
+  80013d:	48 83 c3 08          	add    $0x8,%rbx
+  800141:	b8 00 00 00 00       	mov    $0x0,%eax
+  800146:	ff 53 f8             	call   *-0x8(%rbx)
+  800149:	4c 39 e3             	cmp    %r12,%rbx
+  80014c:	72 ef                	jb     80013d <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+    envid_t this_env_id = sys_getenvid();
+  80014e:	48 b8 3e 11 80 00 00 	movabs $0x80113e,%rax
+  800155:	00 00 00 
+  800158:	ff d0                	call   *%rax
+    thisenv = &((struct Env*)UENVS)[ENVX(this_env_id)];
+  80015a:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80015f:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+  800166:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  80016d:	00 00 00 
+  800170:	48 01 d0             	add    %rdx,%rax
+  800173:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  80017a:	00 00 00 
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  80017d:	45 85 ed             	test   %r13d,%r13d
+  800180:	7e 0d                	jle    80018f <libmain+0x82>
+  800182:	49 8b 06             	mov    (%r14),%rax
+  800185:	48 a3 00 40 80 00 00 	movabs %rax,0x804000
+  80018c:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  80018f:	4c 89 f6             	mov    %r14,%rsi
+  800192:	44 89 ef             	mov    %r13d,%edi
+  800195:	48 b8 db 00 80 00 00 	movabs $0x8000db,%rax
+  80019c:	00 00 00 
+  80019f:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8001a1:	48 b8 b6 01 80 00 00 	movabs $0x8001b6,%rax
+  8001a8:	00 00 00 
+  8001ab:	ff d0                	call   *%rax
+#endif
+}
+  8001ad:	5b                   	pop    %rbx
+  8001ae:	41 5c                	pop    %r12
+  8001b0:	41 5d                	pop    %r13
+  8001b2:	41 5e                	pop    %r14
+  8001b4:	5d                   	pop    %rbp
+  8001b5:	c3                   	ret
+
+00000000008001b6 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8001b6:	55                   	push   %rbp
+  8001b7:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  8001ba:	48 b8 71 1b 80 00 00 	movabs $0x801b71,%rax
+  8001c1:	00 00 00 
+  8001c4:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  8001c6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8001cb:	48 b8 d3 10 80 00 00 	movabs $0x8010d3,%rax
+  8001d2:	00 00 00 
+  8001d5:	ff d0                	call   *%rax
+}
+  8001d7:	5d                   	pop    %rbp
+  8001d8:	c3                   	ret
+
+00000000008001d9 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  8001d9:	55                   	push   %rbp
+  8001da:	48 89 e5             	mov    %rsp,%rbp
+  8001dd:	41 56                	push   %r14
+  8001df:	41 55                	push   %r13
+  8001e1:	41 54                	push   %r12
+  8001e3:	53                   	push   %rbx
+  8001e4:	48 83 ec 50          	sub    $0x50,%rsp
+  8001e8:	49 89 fc             	mov    %rdi,%r12
+  8001eb:	41 89 f5             	mov    %esi,%r13d
+  8001ee:	48 89 d3             	mov    %rdx,%rbx
+  8001f1:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  8001f5:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  8001f9:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  8001fd:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  800204:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800208:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  80020c:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  800210:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  800214:	48 b8 00 40 80 00 00 	movabs $0x804000,%rax
+  80021b:	00 00 00 
+  80021e:	4c 8b 30             	mov    (%rax),%r14
+  800221:	48 b8 3e 11 80 00 00 	movabs $0x80113e,%rax
+  800228:	00 00 00 
+  80022b:	ff d0                	call   *%rax
+  80022d:	89 c6                	mov    %eax,%esi
+  80022f:	45 89 e8             	mov    %r13d,%r8d
+  800232:	4c 89 e1             	mov    %r12,%rcx
+  800235:	4c 89 f2             	mov    %r14,%rdx
+  800238:	48 bf b8 30 80 00 00 	movabs $0x8030b8,%rdi
+  80023f:	00 00 00 
+  800242:	b8 00 00 00 00       	mov    $0x0,%eax
+  800247:	49 bc 29 03 80 00 00 	movabs $0x800329,%r12
+  80024e:	00 00 00 
+  800251:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  800254:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  800258:	48 89 df             	mov    %rbx,%rdi
+  80025b:	48 b8 c5 02 80 00 00 	movabs $0x8002c5,%rax
+  800262:	00 00 00 
+  800265:	ff d0                	call   *%rax
+    cprintf("\n");
+  800267:	48 bf 43 37 80 00 00 	movabs $0x803743,%rdi
+  80026e:	00 00 00 
+  800271:	b8 00 00 00 00       	mov    $0x0,%eax
+  800276:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  800279:	cc                   	int3
+  80027a:	eb fd                	jmp    800279 <_panic+0xa0>
+
+000000000080027c <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  80027c:	55                   	push   %rbp
+  80027d:	48 89 e5             	mov    %rsp,%rbp
+  800280:	53                   	push   %rbx
+  800281:	48 83 ec 08          	sub    $0x8,%rsp
+  800285:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  800288:	8b 06                	mov    (%rsi),%eax
+  80028a:	8d 50 01             	lea    0x1(%rax),%edx
+  80028d:	89 16                	mov    %edx,(%rsi)
+  80028f:	48 98                	cltq
+  800291:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  800296:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  80029c:	74 0a                	je     8002a8 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  80029e:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  8002a2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8002a6:	c9                   	leave
+  8002a7:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  8002a8:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  8002ac:	be ff 00 00 00       	mov    $0xff,%esi
+  8002b1:	48 b8 75 10 80 00 00 	movabs $0x801075,%rax
+  8002b8:	00 00 00 
+  8002bb:	ff d0                	call   *%rax
+        state->offset = 0;
+  8002bd:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  8002c3:	eb d9                	jmp    80029e <putch+0x22>
+
+00000000008002c5 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  8002c5:	55                   	push   %rbp
+  8002c6:	48 89 e5             	mov    %rsp,%rbp
+  8002c9:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  8002d0:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  8002d3:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  8002da:	b9 21 00 00 00       	mov    $0x21,%ecx
+  8002df:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002e4:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  8002e7:	48 89 f1             	mov    %rsi,%rcx
+  8002ea:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  8002f1:	48 bf 7c 02 80 00 00 	movabs $0x80027c,%rdi
+  8002f8:	00 00 00 
+  8002fb:	48 b8 79 04 80 00 00 	movabs $0x800479,%rax
+  800302:	00 00 00 
+  800305:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  800307:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  80030e:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  800315:	48 b8 75 10 80 00 00 	movabs $0x801075,%rax
+  80031c:	00 00 00 
+  80031f:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  800321:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  800327:	c9                   	leave
+  800328:	c3                   	ret
+
+0000000000800329 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  800329:	55                   	push   %rbp
+  80032a:	48 89 e5             	mov    %rsp,%rbp
+  80032d:	48 83 ec 50          	sub    $0x50,%rsp
+  800331:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  800335:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  800339:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80033d:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800341:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  800345:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  80034c:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800350:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800354:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800358:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  80035c:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  800360:	48 b8 c5 02 80 00 00 	movabs $0x8002c5,%rax
+  800367:	00 00 00 
+  80036a:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  80036c:	c9                   	leave
+  80036d:	c3                   	ret
+
+000000000080036e <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  80036e:	55                   	push   %rbp
+  80036f:	48 89 e5             	mov    %rsp,%rbp
+  800372:	41 57                	push   %r15
+  800374:	41 56                	push   %r14
+  800376:	41 55                	push   %r13
+  800378:	41 54                	push   %r12
+  80037a:	53                   	push   %rbx
+  80037b:	48 83 ec 18          	sub    $0x18,%rsp
+  80037f:	49 89 fc             	mov    %rdi,%r12
+  800382:	49 89 f5             	mov    %rsi,%r13
+  800385:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800389:	8b 45 10             	mov    0x10(%rbp),%eax
+  80038c:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  80038f:	41 89 cf             	mov    %ecx,%r15d
+  800392:	4c 39 fa             	cmp    %r15,%rdx
+  800395:	73 5b                	jae    8003f2 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  800397:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  80039b:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  80039f:	85 db                	test   %ebx,%ebx
+  8003a1:	7e 0e                	jle    8003b1 <print_num+0x43>
+            putch(padc, put_arg);
+  8003a3:	4c 89 ee             	mov    %r13,%rsi
+  8003a6:	44 89 f7             	mov    %r14d,%edi
+  8003a9:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  8003ac:	83 eb 01             	sub    $0x1,%ebx
+  8003af:	75 f2                	jne    8003a3 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  8003b1:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  8003b5:	48 b9 ec 30 80 00 00 	movabs $0x8030ec,%rcx
+  8003bc:	00 00 00 
+  8003bf:	48 b8 db 30 80 00 00 	movabs $0x8030db,%rax
+  8003c6:	00 00 00 
+  8003c9:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  8003cd:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8003d1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8003d6:	49 f7 f7             	div    %r15
+  8003d9:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  8003dd:	4c 89 ee             	mov    %r13,%rsi
+  8003e0:	41 ff d4             	call   *%r12
+}
+  8003e3:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8003e7:	5b                   	pop    %rbx
+  8003e8:	41 5c                	pop    %r12
+  8003ea:	41 5d                	pop    %r13
+  8003ec:	41 5e                	pop    %r14
+  8003ee:	41 5f                	pop    %r15
+  8003f0:	5d                   	pop    %rbp
+  8003f1:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  8003f2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8003f6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8003fb:	49 f7 f7             	div    %r15
+  8003fe:	48 83 ec 08          	sub    $0x8,%rsp
+  800402:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  800406:	52                   	push   %rdx
+  800407:	45 0f be c9          	movsbl %r9b,%r9d
+  80040b:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  80040f:	48 89 c2             	mov    %rax,%rdx
+  800412:	48 b8 6e 03 80 00 00 	movabs $0x80036e,%rax
+  800419:	00 00 00 
+  80041c:	ff d0                	call   *%rax
+  80041e:	48 83 c4 10          	add    $0x10,%rsp
+  800422:	eb 8d                	jmp    8003b1 <print_num+0x43>
+
+0000000000800424 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  800424:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  800428:	48 8b 06             	mov    (%rsi),%rax
+  80042b:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  80042f:	73 0a                	jae    80043b <sprintputch+0x17>
+        *state->start++ = ch;
+  800431:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800435:	48 89 16             	mov    %rdx,(%rsi)
+  800438:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  80043b:	c3                   	ret
+
+000000000080043c <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  80043c:	55                   	push   %rbp
+  80043d:	48 89 e5             	mov    %rsp,%rbp
+  800440:	48 83 ec 50          	sub    $0x50,%rsp
+  800444:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800448:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80044c:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  800450:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800457:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80045b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80045f:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800463:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  800467:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80046b:	48 b8 79 04 80 00 00 	movabs $0x800479,%rax
+  800472:	00 00 00 
+  800475:	ff d0                	call   *%rax
+}
+  800477:	c9                   	leave
+  800478:	c3                   	ret
+
+0000000000800479 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  800479:	55                   	push   %rbp
+  80047a:	48 89 e5             	mov    %rsp,%rbp
+  80047d:	41 57                	push   %r15
+  80047f:	41 56                	push   %r14
+  800481:	41 55                	push   %r13
+  800483:	41 54                	push   %r12
+  800485:	53                   	push   %rbx
+  800486:	48 83 ec 38          	sub    $0x38,%rsp
+  80048a:	49 89 fe             	mov    %rdi,%r14
+  80048d:	49 89 f5             	mov    %rsi,%r13
+  800490:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  800493:	48 8b 01             	mov    (%rcx),%rax
+  800496:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  80049a:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  80049e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8004a2:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  8004a6:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  8004aa:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  8004ae:	0f b6 3b             	movzbl (%rbx),%edi
+  8004b1:	40 80 ff 25          	cmp    $0x25,%dil
+  8004b5:	74 18                	je     8004cf <vprintfmt+0x56>
+            if (!ch) return;
+  8004b7:	40 84 ff             	test   %dil,%dil
+  8004ba:	0f 84 b1 06 00 00    	je     800b71 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  8004c0:	40 0f b6 ff          	movzbl %dil,%edi
+  8004c4:	4c 89 ee             	mov    %r13,%rsi
+  8004c7:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  8004ca:	4c 89 e3             	mov    %r12,%rbx
+  8004cd:	eb db                	jmp    8004aa <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  8004cf:	be 00 00 00 00       	mov    $0x0,%esi
+  8004d4:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  8004d8:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  8004dd:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8004e3:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  8004ea:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8004ee:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  8004f3:	41 0f b6 04 24       	movzbl (%r12),%eax
+  8004f8:	88 45 a0             	mov    %al,-0x60(%rbp)
+  8004fb:	83 e8 23             	sub    $0x23,%eax
+  8004fe:	3c 57                	cmp    $0x57,%al
+  800500:	0f 87 51 06 00 00    	ja     800b57 <vprintfmt+0x6de>
+  800506:	0f b6 c0             	movzbl %al,%eax
+  800509:	48 b9 a0 32 80 00 00 	movabs $0x8032a0,%rcx
+  800510:	00 00 00 
+  800513:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  800516:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  800519:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  80051d:	eb cf                	jmp    8004ee <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  80051f:	49 89 dc             	mov    %rbx,%r12
+  800522:	be 01 00 00 00       	mov    $0x1,%esi
+  800527:	eb c5                	jmp    8004ee <vprintfmt+0x75>
+            padc = ch;
+  800529:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  80052d:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800530:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800533:	eb b9                	jmp    8004ee <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800535:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800538:	83 f8 2f             	cmp    $0x2f,%eax
+  80053b:	77 24                	ja     800561 <vprintfmt+0xe8>
+  80053d:	89 c1                	mov    %eax,%ecx
+  80053f:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  800543:	83 c0 08             	add    $0x8,%eax
+  800546:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800549:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  80054c:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  80054f:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800553:	79 99                	jns    8004ee <vprintfmt+0x75>
+                width = precision;
+  800555:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  800559:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  80055f:	eb 8d                	jmp    8004ee <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800561:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  800565:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  800569:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80056d:	eb da                	jmp    800549 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  80056f:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  800574:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800578:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  80057e:	3c 39                	cmp    $0x39,%al
+  800580:	77 1c                	ja     80059e <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  800582:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  800586:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  80058a:	0f b6 c0             	movzbl %al,%eax
+  80058d:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800592:	0f b6 03             	movzbl (%rbx),%eax
+  800595:	3c 39                	cmp    $0x39,%al
+  800597:	76 e9                	jbe    800582 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  800599:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  80059c:	eb b1                	jmp    80054f <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  80059e:	49 89 dc             	mov    %rbx,%r12
+  8005a1:	eb ac                	jmp    80054f <vprintfmt+0xd6>
+            width = MAX(0, width);
+  8005a3:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  8005a6:	85 c9                	test   %ecx,%ecx
+  8005a8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005ad:	0f 49 c1             	cmovns %ecx,%eax
+  8005b0:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  8005b3:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8005b6:	e9 33 ff ff ff       	jmp    8004ee <vprintfmt+0x75>
+            lflag++;
+  8005bb:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  8005be:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8005c1:	e9 28 ff ff ff       	jmp    8004ee <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  8005c6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8005c9:	83 f8 2f             	cmp    $0x2f,%eax
+  8005cc:	77 19                	ja     8005e7 <vprintfmt+0x16e>
+  8005ce:	89 c2                	mov    %eax,%edx
+  8005d0:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8005d4:	83 c0 08             	add    $0x8,%eax
+  8005d7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8005da:	8b 3a                	mov    (%rdx),%edi
+  8005dc:	4c 89 ee             	mov    %r13,%rsi
+  8005df:	41 ff d6             	call   *%r14
+            break;
+  8005e2:	e9 c3 fe ff ff       	jmp    8004aa <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  8005e7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8005eb:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8005ef:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8005f3:	eb e5                	jmp    8005da <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  8005f5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8005f8:	83 f8 2f             	cmp    $0x2f,%eax
+  8005fb:	77 5a                	ja     800657 <vprintfmt+0x1de>
+  8005fd:	89 c2                	mov    %eax,%edx
+  8005ff:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800603:	83 c0 08             	add    $0x8,%eax
+  800606:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  800609:	8b 02                	mov    (%rdx),%eax
+  80060b:	89 c1                	mov    %eax,%ecx
+  80060d:	f7 d9                	neg    %ecx
+  80060f:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  800612:	83 f9 15             	cmp    $0x15,%ecx
+  800615:	7f 4e                	jg     800665 <vprintfmt+0x1ec>
+  800617:	48 63 c1             	movslq %ecx,%rax
+  80061a:	48 ba 60 35 80 00 00 	movabs $0x803560,%rdx
+  800621:	00 00 00 
+  800624:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  800628:	48 85 c0             	test   %rax,%rax
+  80062b:	74 38                	je     800665 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  80062d:	48 89 c1             	mov    %rax,%rcx
+  800630:	48 ba e2 36 80 00 00 	movabs $0x8036e2,%rdx
+  800637:	00 00 00 
+  80063a:	4c 89 ee             	mov    %r13,%rsi
+  80063d:	4c 89 f7             	mov    %r14,%rdi
+  800640:	b8 00 00 00 00       	mov    $0x0,%eax
+  800645:	49 b8 3c 04 80 00 00 	movabs $0x80043c,%r8
+  80064c:	00 00 00 
+  80064f:	41 ff d0             	call   *%r8
+  800652:	e9 53 fe ff ff       	jmp    8004aa <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  800657:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80065b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80065f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800663:	eb a4                	jmp    800609 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  800665:	48 ba 04 31 80 00 00 	movabs $0x803104,%rdx
+  80066c:	00 00 00 
+  80066f:	4c 89 ee             	mov    %r13,%rsi
+  800672:	4c 89 f7             	mov    %r14,%rdi
+  800675:	b8 00 00 00 00       	mov    $0x0,%eax
+  80067a:	49 b8 3c 04 80 00 00 	movabs $0x80043c,%r8
+  800681:	00 00 00 
+  800684:	41 ff d0             	call   *%r8
+  800687:	e9 1e fe ff ff       	jmp    8004aa <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  80068c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80068f:	83 f8 2f             	cmp    $0x2f,%eax
+  800692:	77 6c                	ja     800700 <vprintfmt+0x287>
+  800694:	89 c2                	mov    %eax,%edx
+  800696:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80069a:	83 c0 08             	add    $0x8,%eax
+  80069d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8006a0:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  8006a3:	48 85 d2             	test   %rdx,%rdx
+  8006a6:	48 b8 fd 30 80 00 00 	movabs $0x8030fd,%rax
+  8006ad:	00 00 00 
+  8006b0:	48 0f 45 c2          	cmovne %rdx,%rax
+  8006b4:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  8006b8:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8006bc:	7e 06                	jle    8006c4 <vprintfmt+0x24b>
+  8006be:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  8006c2:	75 4a                	jne    80070e <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8006c4:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8006c8:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8006cc:	0f b6 00             	movzbl (%rax),%eax
+  8006cf:	84 c0                	test   %al,%al
+  8006d1:	0f 85 9a 00 00 00    	jne    800771 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  8006d7:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8006da:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  8006de:	85 c0                	test   %eax,%eax
+  8006e0:	0f 8e c4 fd ff ff    	jle    8004aa <vprintfmt+0x31>
+  8006e6:	4c 89 ee             	mov    %r13,%rsi
+  8006e9:	bf 20 00 00 00       	mov    $0x20,%edi
+  8006ee:	41 ff d6             	call   *%r14
+  8006f1:	41 83 ec 01          	sub    $0x1,%r12d
+  8006f5:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  8006f9:	75 eb                	jne    8006e6 <vprintfmt+0x26d>
+  8006fb:	e9 aa fd ff ff       	jmp    8004aa <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800700:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800704:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800708:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80070c:	eb 92                	jmp    8006a0 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  80070e:	49 63 f7             	movslq %r15d,%rsi
+  800711:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  800715:	48 b8 2b 0c 80 00 00 	movabs $0x800c2b,%rax
+  80071c:	00 00 00 
+  80071f:	ff d0                	call   *%rax
+  800721:	48 89 c2             	mov    %rax,%rdx
+  800724:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800727:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  800729:	8d 70 ff             	lea    -0x1(%rax),%esi
+  80072c:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  80072f:	85 c0                	test   %eax,%eax
+  800731:	7e 91                	jle    8006c4 <vprintfmt+0x24b>
+  800733:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  800738:	4c 89 ee             	mov    %r13,%rsi
+  80073b:	44 89 e7             	mov    %r12d,%edi
+  80073e:	41 ff d6             	call   *%r14
+  800741:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800745:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800748:	83 f8 ff             	cmp    $0xffffffff,%eax
+  80074b:	75 eb                	jne    800738 <vprintfmt+0x2bf>
+  80074d:	e9 72 ff ff ff       	jmp    8006c4 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800752:	0f b6 f8             	movzbl %al,%edi
+  800755:	4c 89 ee             	mov    %r13,%rsi
+  800758:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  80075b:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  80075f:	49 83 c4 01          	add    $0x1,%r12
+  800763:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  800769:	84 c0                	test   %al,%al
+  80076b:	0f 84 66 ff ff ff    	je     8006d7 <vprintfmt+0x25e>
+  800771:	45 85 ff             	test   %r15d,%r15d
+  800774:	78 0a                	js     800780 <vprintfmt+0x307>
+  800776:	41 83 ef 01          	sub    $0x1,%r15d
+  80077a:	0f 88 57 ff ff ff    	js     8006d7 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800780:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  800784:	74 cc                	je     800752 <vprintfmt+0x2d9>
+  800786:	8d 50 e0             	lea    -0x20(%rax),%edx
+  800789:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  80078e:	80 fa 5e             	cmp    $0x5e,%dl
+  800791:	77 c2                	ja     800755 <vprintfmt+0x2dc>
+  800793:	eb bd                	jmp    800752 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  800795:	40 84 f6             	test   %sil,%sil
+  800798:	75 26                	jne    8007c0 <vprintfmt+0x347>
+    switch (lflag) {
+  80079a:	85 d2                	test   %edx,%edx
+  80079c:	74 59                	je     8007f7 <vprintfmt+0x37e>
+  80079e:	83 fa 01             	cmp    $0x1,%edx
+  8007a1:	74 7b                	je     80081e <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  8007a3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007a6:	83 f8 2f             	cmp    $0x2f,%eax
+  8007a9:	0f 87 96 00 00 00    	ja     800845 <vprintfmt+0x3cc>
+  8007af:	89 c2                	mov    %eax,%edx
+  8007b1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007b5:	83 c0 08             	add    $0x8,%eax
+  8007b8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007bb:	4c 8b 22             	mov    (%rdx),%r12
+  8007be:	eb 17                	jmp    8007d7 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  8007c0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007c3:	83 f8 2f             	cmp    $0x2f,%eax
+  8007c6:	77 21                	ja     8007e9 <vprintfmt+0x370>
+  8007c8:	89 c2                	mov    %eax,%edx
+  8007ca:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007ce:	83 c0 08             	add    $0x8,%eax
+  8007d1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007d4:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  8007d7:	4d 85 e4             	test   %r12,%r12
+  8007da:	78 7a                	js     800856 <vprintfmt+0x3dd>
+            num = i;
+  8007dc:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  8007df:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  8007e4:	e9 50 02 00 00       	jmp    800a39 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8007e9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007ed:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007f1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007f5:	eb dd                	jmp    8007d4 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  8007f7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007fa:	83 f8 2f             	cmp    $0x2f,%eax
+  8007fd:	77 11                	ja     800810 <vprintfmt+0x397>
+  8007ff:	89 c2                	mov    %eax,%edx
+  800801:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800805:	83 c0 08             	add    $0x8,%eax
+  800808:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80080b:	4c 63 22             	movslq (%rdx),%r12
+  80080e:	eb c7                	jmp    8007d7 <vprintfmt+0x35e>
+  800810:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800814:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800818:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80081c:	eb ed                	jmp    80080b <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  80081e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800821:	83 f8 2f             	cmp    $0x2f,%eax
+  800824:	77 11                	ja     800837 <vprintfmt+0x3be>
+  800826:	89 c2                	mov    %eax,%edx
+  800828:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80082c:	83 c0 08             	add    $0x8,%eax
+  80082f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800832:	4c 8b 22             	mov    (%rdx),%r12
+  800835:	eb a0                	jmp    8007d7 <vprintfmt+0x35e>
+  800837:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80083b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80083f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800843:	eb ed                	jmp    800832 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  800845:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800849:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80084d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800851:	e9 65 ff ff ff       	jmp    8007bb <vprintfmt+0x342>
+                putch('-', put_arg);
+  800856:	4c 89 ee             	mov    %r13,%rsi
+  800859:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  80085e:	41 ff d6             	call   *%r14
+                i = -i;
+  800861:	49 f7 dc             	neg    %r12
+  800864:	e9 73 ff ff ff       	jmp    8007dc <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  800869:	40 84 f6             	test   %sil,%sil
+  80086c:	75 32                	jne    8008a0 <vprintfmt+0x427>
+    switch (lflag) {
+  80086e:	85 d2                	test   %edx,%edx
+  800870:	74 5d                	je     8008cf <vprintfmt+0x456>
+  800872:	83 fa 01             	cmp    $0x1,%edx
+  800875:	0f 84 82 00 00 00    	je     8008fd <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  80087b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80087e:	83 f8 2f             	cmp    $0x2f,%eax
+  800881:	0f 87 a5 00 00 00    	ja     80092c <vprintfmt+0x4b3>
+  800887:	89 c2                	mov    %eax,%edx
+  800889:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80088d:	83 c0 08             	add    $0x8,%eax
+  800890:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800893:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800896:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  80089b:	e9 99 01 00 00       	jmp    800a39 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8008a0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008a3:	83 f8 2f             	cmp    $0x2f,%eax
+  8008a6:	77 19                	ja     8008c1 <vprintfmt+0x448>
+  8008a8:	89 c2                	mov    %eax,%edx
+  8008aa:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008ae:	83 c0 08             	add    $0x8,%eax
+  8008b1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008b4:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8008b7:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8008bc:	e9 78 01 00 00       	jmp    800a39 <vprintfmt+0x5c0>
+  8008c1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008c5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008c9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008cd:	eb e5                	jmp    8008b4 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  8008cf:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008d2:	83 f8 2f             	cmp    $0x2f,%eax
+  8008d5:	77 18                	ja     8008ef <vprintfmt+0x476>
+  8008d7:	89 c2                	mov    %eax,%edx
+  8008d9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008dd:	83 c0 08             	add    $0x8,%eax
+  8008e0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008e3:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  8008e5:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  8008ea:	e9 4a 01 00 00       	jmp    800a39 <vprintfmt+0x5c0>
+  8008ef:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008f3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008f7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008fb:	eb e6                	jmp    8008e3 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  8008fd:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800900:	83 f8 2f             	cmp    $0x2f,%eax
+  800903:	77 19                	ja     80091e <vprintfmt+0x4a5>
+  800905:	89 c2                	mov    %eax,%edx
+  800907:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80090b:	83 c0 08             	add    $0x8,%eax
+  80090e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800911:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800914:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  800919:	e9 1b 01 00 00       	jmp    800a39 <vprintfmt+0x5c0>
+  80091e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800922:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800926:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80092a:	eb e5                	jmp    800911 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  80092c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800930:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800934:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800938:	e9 56 ff ff ff       	jmp    800893 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  80093d:	40 84 f6             	test   %sil,%sil
+  800940:	75 2e                	jne    800970 <vprintfmt+0x4f7>
+    switch (lflag) {
+  800942:	85 d2                	test   %edx,%edx
+  800944:	74 59                	je     80099f <vprintfmt+0x526>
+  800946:	83 fa 01             	cmp    $0x1,%edx
+  800949:	74 7f                	je     8009ca <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  80094b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80094e:	83 f8 2f             	cmp    $0x2f,%eax
+  800951:	0f 87 9f 00 00 00    	ja     8009f6 <vprintfmt+0x57d>
+  800957:	89 c2                	mov    %eax,%edx
+  800959:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80095d:	83 c0 08             	add    $0x8,%eax
+  800960:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800963:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800966:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  80096b:	e9 c9 00 00 00       	jmp    800a39 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800970:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800973:	83 f8 2f             	cmp    $0x2f,%eax
+  800976:	77 19                	ja     800991 <vprintfmt+0x518>
+  800978:	89 c2                	mov    %eax,%edx
+  80097a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80097e:	83 c0 08             	add    $0x8,%eax
+  800981:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800984:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800987:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  80098c:	e9 a8 00 00 00       	jmp    800a39 <vprintfmt+0x5c0>
+  800991:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800995:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800999:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80099d:	eb e5                	jmp    800984 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  80099f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009a2:	83 f8 2f             	cmp    $0x2f,%eax
+  8009a5:	77 15                	ja     8009bc <vprintfmt+0x543>
+  8009a7:	89 c2                	mov    %eax,%edx
+  8009a9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009ad:	83 c0 08             	add    $0x8,%eax
+  8009b0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009b3:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  8009b5:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  8009ba:	eb 7d                	jmp    800a39 <vprintfmt+0x5c0>
+  8009bc:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009c0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009c4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009c8:	eb e9                	jmp    8009b3 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  8009ca:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009cd:	83 f8 2f             	cmp    $0x2f,%eax
+  8009d0:	77 16                	ja     8009e8 <vprintfmt+0x56f>
+  8009d2:	89 c2                	mov    %eax,%edx
+  8009d4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009d8:	83 c0 08             	add    $0x8,%eax
+  8009db:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009de:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8009e1:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  8009e6:	eb 51                	jmp    800a39 <vprintfmt+0x5c0>
+  8009e8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009ec:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009f0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009f4:	eb e8                	jmp    8009de <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  8009f6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009fa:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009fe:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a02:	e9 5c ff ff ff       	jmp    800963 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  800a07:	4c 89 ee             	mov    %r13,%rsi
+  800a0a:	bf 30 00 00 00       	mov    $0x30,%edi
+  800a0f:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800a12:	4c 89 ee             	mov    %r13,%rsi
+  800a15:	bf 78 00 00 00       	mov    $0x78,%edi
+  800a1a:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800a1d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a20:	83 f8 2f             	cmp    $0x2f,%eax
+  800a23:	77 47                	ja     800a6c <vprintfmt+0x5f3>
+  800a25:	89 c2                	mov    %eax,%edx
+  800a27:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a2b:	83 c0 08             	add    $0x8,%eax
+  800a2e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a31:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800a34:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800a39:	48 83 ec 08          	sub    $0x8,%rsp
+  800a3d:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800a41:	0f 94 c0             	sete   %al
+  800a44:	0f b6 c0             	movzbl %al,%eax
+  800a47:	50                   	push   %rax
+  800a48:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800a4d:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800a51:	4c 89 ee             	mov    %r13,%rsi
+  800a54:	4c 89 f7             	mov    %r14,%rdi
+  800a57:	48 b8 6e 03 80 00 00 	movabs $0x80036e,%rax
+  800a5e:	00 00 00 
+  800a61:	ff d0                	call   *%rax
+            break;
+  800a63:	48 83 c4 10          	add    $0x10,%rsp
+  800a67:	e9 3e fa ff ff       	jmp    8004aa <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800a6c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a70:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a74:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a78:	eb b7                	jmp    800a31 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  800a7a:	40 84 f6             	test   %sil,%sil
+  800a7d:	75 2b                	jne    800aaa <vprintfmt+0x631>
+    switch (lflag) {
+  800a7f:	85 d2                	test   %edx,%edx
+  800a81:	74 56                	je     800ad9 <vprintfmt+0x660>
+  800a83:	83 fa 01             	cmp    $0x1,%edx
+  800a86:	74 7f                	je     800b07 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800a88:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a8b:	83 f8 2f             	cmp    $0x2f,%eax
+  800a8e:	0f 87 a2 00 00 00    	ja     800b36 <vprintfmt+0x6bd>
+  800a94:	89 c2                	mov    %eax,%edx
+  800a96:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a9a:	83 c0 08             	add    $0x8,%eax
+  800a9d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800aa0:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800aa3:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800aa8:	eb 8f                	jmp    800a39 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800aaa:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800aad:	83 f8 2f             	cmp    $0x2f,%eax
+  800ab0:	77 19                	ja     800acb <vprintfmt+0x652>
+  800ab2:	89 c2                	mov    %eax,%edx
+  800ab4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ab8:	83 c0 08             	add    $0x8,%eax
+  800abb:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800abe:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800ac1:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800ac6:	e9 6e ff ff ff       	jmp    800a39 <vprintfmt+0x5c0>
+  800acb:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800acf:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ad3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ad7:	eb e5                	jmp    800abe <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800ad9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800adc:	83 f8 2f             	cmp    $0x2f,%eax
+  800adf:	77 18                	ja     800af9 <vprintfmt+0x680>
+  800ae1:	89 c2                	mov    %eax,%edx
+  800ae3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ae7:	83 c0 08             	add    $0x8,%eax
+  800aea:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800aed:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800aef:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800af4:	e9 40 ff ff ff       	jmp    800a39 <vprintfmt+0x5c0>
+  800af9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800afd:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b01:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b05:	eb e6                	jmp    800aed <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800b07:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b0a:	83 f8 2f             	cmp    $0x2f,%eax
+  800b0d:	77 19                	ja     800b28 <vprintfmt+0x6af>
+  800b0f:	89 c2                	mov    %eax,%edx
+  800b11:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b15:	83 c0 08             	add    $0x8,%eax
+  800b18:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b1b:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800b1e:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800b23:	e9 11 ff ff ff       	jmp    800a39 <vprintfmt+0x5c0>
+  800b28:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b2c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b30:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b34:	eb e5                	jmp    800b1b <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800b36:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b3a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b3e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b42:	e9 59 ff ff ff       	jmp    800aa0 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800b47:	4c 89 ee             	mov    %r13,%rsi
+  800b4a:	bf 25 00 00 00       	mov    $0x25,%edi
+  800b4f:	41 ff d6             	call   *%r14
+            break;
+  800b52:	e9 53 f9 ff ff       	jmp    8004aa <vprintfmt+0x31>
+            putch('%', put_arg);
+  800b57:	4c 89 ee             	mov    %r13,%rsi
+  800b5a:	bf 25 00 00 00       	mov    $0x25,%edi
+  800b5f:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800b62:	48 83 eb 01          	sub    $0x1,%rbx
+  800b66:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800b6a:	75 f6                	jne    800b62 <vprintfmt+0x6e9>
+  800b6c:	e9 39 f9 ff ff       	jmp    8004aa <vprintfmt+0x31>
+}
+  800b71:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800b75:	5b                   	pop    %rbx
+  800b76:	41 5c                	pop    %r12
+  800b78:	41 5d                	pop    %r13
+  800b7a:	41 5e                	pop    %r14
+  800b7c:	41 5f                	pop    %r15
+  800b7e:	5d                   	pop    %rbp
+  800b7f:	c3                   	ret
+
+0000000000800b80 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800b80:	55                   	push   %rbp
+  800b81:	48 89 e5             	mov    %rsp,%rbp
+  800b84:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800b88:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800b8c:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800b91:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800b95:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800b9c:	48 85 ff             	test   %rdi,%rdi
+  800b9f:	74 2b                	je     800bcc <vsnprintf+0x4c>
+  800ba1:	48 85 f6             	test   %rsi,%rsi
+  800ba4:	74 26                	je     800bcc <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800ba6:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800baa:	48 bf 24 04 80 00 00 	movabs $0x800424,%rdi
+  800bb1:	00 00 00 
+  800bb4:	48 b8 79 04 80 00 00 	movabs $0x800479,%rax
+  800bbb:	00 00 00 
+  800bbe:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800bc0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800bc4:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800bc7:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800bca:	c9                   	leave
+  800bcb:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800bcc:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800bd1:	eb f7                	jmp    800bca <vsnprintf+0x4a>
+
+0000000000800bd3 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800bd3:	55                   	push   %rbp
+  800bd4:	48 89 e5             	mov    %rsp,%rbp
+  800bd7:	48 83 ec 50          	sub    $0x50,%rsp
+  800bdb:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800bdf:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800be3:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800be7:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800bee:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800bf2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bf6:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800bfa:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800bfe:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800c02:	48 b8 80 0b 80 00 00 	movabs $0x800b80,%rax
+  800c09:	00 00 00 
+  800c0c:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800c0e:	c9                   	leave
+  800c0f:	c3                   	ret
+
+0000000000800c10 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800c10:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800c13:	74 10                	je     800c25 <strlen+0x15>
+    size_t n = 0;
+  800c15:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800c1a:	48 83 c0 01          	add    $0x1,%rax
+  800c1e:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800c22:	75 f6                	jne    800c1a <strlen+0xa>
+  800c24:	c3                   	ret
+    size_t n = 0;
+  800c25:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800c2a:	c3                   	ret
+
+0000000000800c2b <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800c2b:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800c2e:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800c33:	48 85 f6             	test   %rsi,%rsi
+  800c36:	74 11                	je     800c49 <strnlen+0x1e>
+  800c38:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800c3c:	74 0c                	je     800c4a <strnlen+0x1f>
+  800c3e:	48 83 c2 01          	add    $0x1,%rdx
+  800c42:	48 39 d0             	cmp    %rdx,%rax
+  800c45:	75 f1                	jne    800c38 <strnlen+0xd>
+  800c47:	eb 04                	jmp    800c4d <strnlen+0x22>
+  800c49:	c3                   	ret
+  800c4a:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800c4d:	c3                   	ret
+
+0000000000800c4e <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800c4e:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800c51:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c56:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800c5a:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800c5d:	48 83 c2 01          	add    $0x1,%rdx
+  800c61:	84 c9                	test   %cl,%cl
+  800c63:	75 f1                	jne    800c56 <strcpy+0x8>
+        ;
+    return res;
+}
+  800c65:	c3                   	ret
+
+0000000000800c66 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800c66:	55                   	push   %rbp
+  800c67:	48 89 e5             	mov    %rsp,%rbp
+  800c6a:	41 54                	push   %r12
+  800c6c:	53                   	push   %rbx
+  800c6d:	48 89 fb             	mov    %rdi,%rbx
+  800c70:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800c73:	48 b8 10 0c 80 00 00 	movabs $0x800c10,%rax
+  800c7a:	00 00 00 
+  800c7d:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800c7f:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800c83:	4c 89 e6             	mov    %r12,%rsi
+  800c86:	48 b8 4e 0c 80 00 00 	movabs $0x800c4e,%rax
+  800c8d:	00 00 00 
+  800c90:	ff d0                	call   *%rax
+    return dst;
+}
+  800c92:	48 89 d8             	mov    %rbx,%rax
+  800c95:	5b                   	pop    %rbx
+  800c96:	41 5c                	pop    %r12
+  800c98:	5d                   	pop    %rbp
+  800c99:	c3                   	ret
+
+0000000000800c9a <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800c9a:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800c9d:	48 85 d2             	test   %rdx,%rdx
+  800ca0:	74 1f                	je     800cc1 <strncpy+0x27>
+  800ca2:	48 01 fa             	add    %rdi,%rdx
+  800ca5:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800ca8:	48 83 c1 01          	add    $0x1,%rcx
+  800cac:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800cb0:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800cb4:	41 80 f8 01          	cmp    $0x1,%r8b
+  800cb8:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800cbc:	48 39 ca             	cmp    %rcx,%rdx
+  800cbf:	75 e7                	jne    800ca8 <strncpy+0xe>
+    }
+    return ret;
+}
+  800cc1:	c3                   	ret
+
+0000000000800cc2 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800cc2:	48 89 f8             	mov    %rdi,%rax
+  800cc5:	48 85 d2             	test   %rdx,%rdx
+  800cc8:	74 24                	je     800cee <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800cca:	48 83 ea 01          	sub    $0x1,%rdx
+  800cce:	74 1b                	je     800ceb <strlcpy+0x29>
+  800cd0:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800cd4:	0f b6 16             	movzbl (%rsi),%edx
+  800cd7:	84 d2                	test   %dl,%dl
+  800cd9:	74 10                	je     800ceb <strlcpy+0x29>
+            *dst++ = *src++;
+  800cdb:	48 83 c6 01          	add    $0x1,%rsi
+  800cdf:	48 83 c0 01          	add    $0x1,%rax
+  800ce3:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800ce6:	48 39 c8             	cmp    %rcx,%rax
+  800ce9:	75 e9                	jne    800cd4 <strlcpy+0x12>
+        *dst = '\0';
+  800ceb:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800cee:	48 29 f8             	sub    %rdi,%rax
+}
+  800cf1:	c3                   	ret
+
+0000000000800cf2 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800cf2:	0f b6 07             	movzbl (%rdi),%eax
+  800cf5:	84 c0                	test   %al,%al
+  800cf7:	74 13                	je     800d0c <strcmp+0x1a>
+  800cf9:	38 06                	cmp    %al,(%rsi)
+  800cfb:	75 0f                	jne    800d0c <strcmp+0x1a>
+  800cfd:	48 83 c7 01          	add    $0x1,%rdi
+  800d01:	48 83 c6 01          	add    $0x1,%rsi
+  800d05:	0f b6 07             	movzbl (%rdi),%eax
+  800d08:	84 c0                	test   %al,%al
+  800d0a:	75 ed                	jne    800cf9 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800d0c:	0f b6 c0             	movzbl %al,%eax
+  800d0f:	0f b6 16             	movzbl (%rsi),%edx
+  800d12:	29 d0                	sub    %edx,%eax
+}
+  800d14:	c3                   	ret
+
+0000000000800d15 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800d15:	48 85 d2             	test   %rdx,%rdx
+  800d18:	74 1f                	je     800d39 <strncmp+0x24>
+  800d1a:	0f b6 07             	movzbl (%rdi),%eax
+  800d1d:	84 c0                	test   %al,%al
+  800d1f:	74 1e                	je     800d3f <strncmp+0x2a>
+  800d21:	3a 06                	cmp    (%rsi),%al
+  800d23:	75 1a                	jne    800d3f <strncmp+0x2a>
+  800d25:	48 83 c7 01          	add    $0x1,%rdi
+  800d29:	48 83 c6 01          	add    $0x1,%rsi
+  800d2d:	48 83 ea 01          	sub    $0x1,%rdx
+  800d31:	75 e7                	jne    800d1a <strncmp+0x5>
+
+    if (!n) return 0;
+  800d33:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d38:	c3                   	ret
+  800d39:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d3e:	c3                   	ret
+  800d3f:	48 85 d2             	test   %rdx,%rdx
+  800d42:	74 09                	je     800d4d <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800d44:	0f b6 07             	movzbl (%rdi),%eax
+  800d47:	0f b6 16             	movzbl (%rsi),%edx
+  800d4a:	29 d0                	sub    %edx,%eax
+  800d4c:	c3                   	ret
+    if (!n) return 0;
+  800d4d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800d52:	c3                   	ret
+
+0000000000800d53 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800d53:	0f b6 17             	movzbl (%rdi),%edx
+  800d56:	84 d2                	test   %dl,%dl
+  800d58:	74 18                	je     800d72 <strchr+0x1f>
+        if (*str == c) {
+  800d5a:	0f be d2             	movsbl %dl,%edx
+  800d5d:	39 f2                	cmp    %esi,%edx
+  800d5f:	74 17                	je     800d78 <strchr+0x25>
+    for (; *str; str++) {
+  800d61:	48 83 c7 01          	add    $0x1,%rdi
+  800d65:	0f b6 17             	movzbl (%rdi),%edx
+  800d68:	84 d2                	test   %dl,%dl
+  800d6a:	75 ee                	jne    800d5a <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800d6c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d71:	c3                   	ret
+  800d72:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d77:	c3                   	ret
+  800d78:	48 89 f8             	mov    %rdi,%rax
+}
+  800d7b:	c3                   	ret
+
+0000000000800d7c <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800d7c:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800d7f:	0f b6 17             	movzbl (%rdi),%edx
+  800d82:	84 d2                	test   %dl,%dl
+  800d84:	74 13                	je     800d99 <strfind+0x1d>
+  800d86:	0f be d2             	movsbl %dl,%edx
+  800d89:	39 f2                	cmp    %esi,%edx
+  800d8b:	74 0b                	je     800d98 <strfind+0x1c>
+  800d8d:	48 83 c0 01          	add    $0x1,%rax
+  800d91:	0f b6 10             	movzbl (%rax),%edx
+  800d94:	84 d2                	test   %dl,%dl
+  800d96:	75 ee                	jne    800d86 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800d98:	c3                   	ret
+  800d99:	c3                   	ret
+
+0000000000800d9a <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800d9a:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800d9d:	48 89 f8             	mov    %rdi,%rax
+  800da0:	48 f7 d8             	neg    %rax
+  800da3:	83 e0 07             	and    $0x7,%eax
+  800da6:	49 89 d1             	mov    %rdx,%r9
+  800da9:	49 29 c1             	sub    %rax,%r9
+  800dac:	78 36                	js     800de4 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800dae:	40 0f b6 c6          	movzbl %sil,%eax
+  800db2:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800db9:	01 01 01 
+  800dbc:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800dc0:	40 f6 c7 07          	test   $0x7,%dil
+  800dc4:	75 38                	jne    800dfe <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800dc6:	4c 89 c9             	mov    %r9,%rcx
+  800dc9:	48 c1 f9 03          	sar    $0x3,%rcx
+  800dcd:	74 0c                	je     800ddb <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800dcf:	fc                   	cld
+  800dd0:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800dd3:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800dd7:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800ddb:	4d 85 c9             	test   %r9,%r9
+  800dde:	75 45                	jne    800e25 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800de0:	4c 89 c0             	mov    %r8,%rax
+  800de3:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800de4:	48 85 d2             	test   %rdx,%rdx
+  800de7:	74 f7                	je     800de0 <memset+0x46>
+  800de9:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800dec:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800def:	48 83 c0 01          	add    $0x1,%rax
+  800df3:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  800df7:	48 39 c2             	cmp    %rax,%rdx
+  800dfa:	75 f3                	jne    800def <memset+0x55>
+  800dfc:	eb e2                	jmp    800de0 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  800dfe:	40 f6 c7 01          	test   $0x1,%dil
+  800e02:	74 06                	je     800e0a <memset+0x70>
+  800e04:	88 07                	mov    %al,(%rdi)
+  800e06:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800e0a:	40 f6 c7 02          	test   $0x2,%dil
+  800e0e:	74 07                	je     800e17 <memset+0x7d>
+  800e10:	66 89 07             	mov    %ax,(%rdi)
+  800e13:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800e17:	40 f6 c7 04          	test   $0x4,%dil
+  800e1b:	74 a9                	je     800dc6 <memset+0x2c>
+  800e1d:	89 07                	mov    %eax,(%rdi)
+  800e1f:	48 83 c7 04          	add    $0x4,%rdi
+  800e23:	eb a1                	jmp    800dc6 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800e25:	41 f6 c1 04          	test   $0x4,%r9b
+  800e29:	74 06                	je     800e31 <memset+0x97>
+  800e2b:	89 07                	mov    %eax,(%rdi)
+  800e2d:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800e31:	41 f6 c1 02          	test   $0x2,%r9b
+  800e35:	74 07                	je     800e3e <memset+0xa4>
+  800e37:	66 89 07             	mov    %ax,(%rdi)
+  800e3a:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  800e3e:	41 f6 c1 01          	test   $0x1,%r9b
+  800e42:	74 9c                	je     800de0 <memset+0x46>
+  800e44:	88 07                	mov    %al,(%rdi)
+  800e46:	eb 98                	jmp    800de0 <memset+0x46>
+
+0000000000800e48 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  800e48:	48 89 f8             	mov    %rdi,%rax
+  800e4b:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  800e4e:	48 39 fe             	cmp    %rdi,%rsi
+  800e51:	73 3b                	jae    800e8e <memmove+0x46>
+  800e53:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  800e57:	48 39 d7             	cmp    %rdx,%rdi
+  800e5a:	73 32                	jae    800e8e <memmove+0x46>
+        s += n;
+        d += n;
+  800e5c:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800e60:	48 89 d6             	mov    %rdx,%rsi
+  800e63:	48 09 fe             	or     %rdi,%rsi
+  800e66:	48 09 ce             	or     %rcx,%rsi
+  800e69:	40 f6 c6 07          	test   $0x7,%sil
+  800e6d:	75 12                	jne    800e81 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  800e6f:	48 83 ef 08          	sub    $0x8,%rdi
+  800e73:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  800e77:	48 c1 e9 03          	shr    $0x3,%rcx
+  800e7b:	fd                   	std
+  800e7c:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  800e7f:	fc                   	cld
+  800e80:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  800e81:	48 83 ef 01          	sub    $0x1,%rdi
+  800e85:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  800e89:	fd                   	std
+  800e8a:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  800e8c:	eb f1                	jmp    800e7f <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800e8e:	48 89 f2             	mov    %rsi,%rdx
+  800e91:	48 09 c2             	or     %rax,%rdx
+  800e94:	48 09 ca             	or     %rcx,%rdx
+  800e97:	f6 c2 07             	test   $0x7,%dl
+  800e9a:	75 0c                	jne    800ea8 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  800e9c:	48 c1 e9 03          	shr    $0x3,%rcx
+  800ea0:	48 89 c7             	mov    %rax,%rdi
+  800ea3:	fc                   	cld
+  800ea4:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  800ea7:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  800ea8:	48 89 c7             	mov    %rax,%rdi
+  800eab:	fc                   	cld
+  800eac:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  800eae:	c3                   	ret
+
+0000000000800eaf <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  800eaf:	55                   	push   %rbp
+  800eb0:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  800eb3:	48 b8 48 0e 80 00 00 	movabs $0x800e48,%rax
+  800eba:	00 00 00 
+  800ebd:	ff d0                	call   *%rax
+}
+  800ebf:	5d                   	pop    %rbp
+  800ec0:	c3                   	ret
+
+0000000000800ec1 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  800ec1:	55                   	push   %rbp
+  800ec2:	48 89 e5             	mov    %rsp,%rbp
+  800ec5:	41 57                	push   %r15
+  800ec7:	41 56                	push   %r14
+  800ec9:	41 55                	push   %r13
+  800ecb:	41 54                	push   %r12
+  800ecd:	53                   	push   %rbx
+  800ece:	48 83 ec 08          	sub    $0x8,%rsp
+  800ed2:	49 89 fe             	mov    %rdi,%r14
+  800ed5:	49 89 f7             	mov    %rsi,%r15
+  800ed8:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  800edb:	48 89 f7             	mov    %rsi,%rdi
+  800ede:	48 b8 10 0c 80 00 00 	movabs $0x800c10,%rax
+  800ee5:	00 00 00 
+  800ee8:	ff d0                	call   *%rax
+  800eea:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  800eed:	48 89 de             	mov    %rbx,%rsi
+  800ef0:	4c 89 f7             	mov    %r14,%rdi
+  800ef3:	48 b8 2b 0c 80 00 00 	movabs $0x800c2b,%rax
+  800efa:	00 00 00 
+  800efd:	ff d0                	call   *%rax
+  800eff:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  800f02:	48 39 c3             	cmp    %rax,%rbx
+  800f05:	74 36                	je     800f3d <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  800f07:	48 89 d8             	mov    %rbx,%rax
+  800f0a:	4c 29 e8             	sub    %r13,%rax
+  800f0d:	49 39 c4             	cmp    %rax,%r12
+  800f10:	73 31                	jae    800f43 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  800f12:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  800f17:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800f1b:	4c 89 fe             	mov    %r15,%rsi
+  800f1e:	48 b8 af 0e 80 00 00 	movabs $0x800eaf,%rax
+  800f25:	00 00 00 
+  800f28:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  800f2a:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  800f2e:	48 83 c4 08          	add    $0x8,%rsp
+  800f32:	5b                   	pop    %rbx
+  800f33:	41 5c                	pop    %r12
+  800f35:	41 5d                	pop    %r13
+  800f37:	41 5e                	pop    %r14
+  800f39:	41 5f                	pop    %r15
+  800f3b:	5d                   	pop    %rbp
+  800f3c:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  800f3d:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800f41:	eb eb                	jmp    800f2e <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  800f43:	48 83 eb 01          	sub    $0x1,%rbx
+  800f47:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800f4b:	48 89 da             	mov    %rbx,%rdx
+  800f4e:	4c 89 fe             	mov    %r15,%rsi
+  800f51:	48 b8 af 0e 80 00 00 	movabs $0x800eaf,%rax
+  800f58:	00 00 00 
+  800f5b:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  800f5d:	49 01 de             	add    %rbx,%r14
+  800f60:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  800f65:	eb c3                	jmp    800f2a <strlcat+0x69>
+
+0000000000800f67 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  800f67:	48 85 d2             	test   %rdx,%rdx
+  800f6a:	74 2d                	je     800f99 <memcmp+0x32>
+  800f6c:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  800f71:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800f75:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  800f7a:	44 38 c1             	cmp    %r8b,%cl
+  800f7d:	75 0f                	jne    800f8e <memcmp+0x27>
+    while (n-- > 0) {
+  800f7f:	48 83 c0 01          	add    $0x1,%rax
+  800f83:	48 39 c2             	cmp    %rax,%rdx
+  800f86:	75 e9                	jne    800f71 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  800f88:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f8d:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  800f8e:	0f b6 c1             	movzbl %cl,%eax
+  800f91:	45 0f b6 c0          	movzbl %r8b,%r8d
+  800f95:	44 29 c0             	sub    %r8d,%eax
+  800f98:	c3                   	ret
+    return 0;
+  800f99:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800f9e:	c3                   	ret
+
+0000000000800f9f <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  800f9f:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  800fa3:	48 39 c7             	cmp    %rax,%rdi
+  800fa6:	73 0f                	jae    800fb7 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  800fa8:	40 38 37             	cmp    %sil,(%rdi)
+  800fab:	74 0e                	je     800fbb <memfind+0x1c>
+    for (; src < end; src++) {
+  800fad:	48 83 c7 01          	add    $0x1,%rdi
+  800fb1:	48 39 f8             	cmp    %rdi,%rax
+  800fb4:	75 f2                	jne    800fa8 <memfind+0x9>
+  800fb6:	c3                   	ret
+  800fb7:	48 89 f8             	mov    %rdi,%rax
+  800fba:	c3                   	ret
+  800fbb:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  800fbe:	c3                   	ret
+
+0000000000800fbf <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  800fbf:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  800fc2:	0f b6 37             	movzbl (%rdi),%esi
+  800fc5:	40 80 fe 20          	cmp    $0x20,%sil
+  800fc9:	74 06                	je     800fd1 <strtol+0x12>
+  800fcb:	40 80 fe 09          	cmp    $0x9,%sil
+  800fcf:	75 13                	jne    800fe4 <strtol+0x25>
+  800fd1:	48 83 c7 01          	add    $0x1,%rdi
+  800fd5:	0f b6 37             	movzbl (%rdi),%esi
+  800fd8:	40 80 fe 20          	cmp    $0x20,%sil
+  800fdc:	74 f3                	je     800fd1 <strtol+0x12>
+  800fde:	40 80 fe 09          	cmp    $0x9,%sil
+  800fe2:	74 ed                	je     800fd1 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  800fe4:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  800fe7:	83 e0 fd             	and    $0xfffffffd,%eax
+  800fea:	3c 01                	cmp    $0x1,%al
+  800fec:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  800ff0:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  800ff6:	75 0f                	jne    801007 <strtol+0x48>
+  800ff8:	80 3f 30             	cmpb   $0x30,(%rdi)
+  800ffb:	74 14                	je     801011 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  800ffd:	85 d2                	test   %edx,%edx
+  800fff:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801004:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  801007:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  80100c:	4c 63 ca             	movslq %edx,%r9
+  80100f:	eb 36                	jmp    801047 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801011:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  801015:	74 0f                	je     801026 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  801017:	85 d2                	test   %edx,%edx
+  801019:	75 ec                	jne    801007 <strtol+0x48>
+        s++;
+  80101b:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  80101f:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  801024:	eb e1                	jmp    801007 <strtol+0x48>
+        s += 2;
+  801026:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  80102a:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  80102f:	eb d6                	jmp    801007 <strtol+0x48>
+            dig -= '0';
+  801031:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  801034:	44 0f b6 c1          	movzbl %cl,%r8d
+  801038:	41 39 d0             	cmp    %edx,%r8d
+  80103b:	7d 21                	jge    80105e <strtol+0x9f>
+        val = val * base + dig;
+  80103d:	49 0f af c1          	imul   %r9,%rax
+  801041:	0f b6 c9             	movzbl %cl,%ecx
+  801044:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  801047:	48 83 c7 01          	add    $0x1,%rdi
+  80104b:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  80104f:	80 f9 39             	cmp    $0x39,%cl
+  801052:	76 dd                	jbe    801031 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  801054:	80 f9 7b             	cmp    $0x7b,%cl
+  801057:	77 05                	ja     80105e <strtol+0x9f>
+            dig -= 'a' - 10;
+  801059:	83 e9 57             	sub    $0x57,%ecx
+  80105c:	eb d6                	jmp    801034 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  80105e:	4d 85 d2             	test   %r10,%r10
+  801061:	74 03                	je     801066 <strtol+0xa7>
+  801063:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  801066:	48 89 c2             	mov    %rax,%rdx
+  801069:	48 f7 da             	neg    %rdx
+  80106c:	40 80 fe 2d          	cmp    $0x2d,%sil
+  801070:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  801074:	c3                   	ret
+
+0000000000801075 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  801075:	55                   	push   %rbp
+  801076:	48 89 e5             	mov    %rsp,%rbp
+  801079:	53                   	push   %rbx
+  80107a:	48 89 fa             	mov    %rdi,%rdx
+  80107d:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801080:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801085:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80108a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80108f:	be 00 00 00 00       	mov    $0x0,%esi
+  801094:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80109a:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  80109c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8010a0:	c9                   	leave
+  8010a1:	c3                   	ret
+
+00000000008010a2 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  8010a2:	55                   	push   %rbp
+  8010a3:	48 89 e5             	mov    %rsp,%rbp
+  8010a6:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8010a7:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8010ac:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010b1:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8010b6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010bb:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8010c0:	be 00 00 00 00       	mov    $0x0,%esi
+  8010c5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8010cb:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  8010cd:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8010d1:	c9                   	leave
+  8010d2:	c3                   	ret
+
+00000000008010d3 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  8010d3:	55                   	push   %rbp
+  8010d4:	48 89 e5             	mov    %rsp,%rbp
+  8010d7:	53                   	push   %rbx
+  8010d8:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  8010dc:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8010df:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8010e4:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8010e9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010ee:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8010f3:	be 00 00 00 00       	mov    $0x0,%esi
+  8010f8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8010fe:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801100:	48 85 c0             	test   %rax,%rax
+  801103:	7f 06                	jg     80110b <sys_env_destroy+0x38>
+}
+  801105:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801109:	c9                   	leave
+  80110a:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80110b:	49 89 c0             	mov    %rax,%r8
+  80110e:	b9 03 00 00 00       	mov    $0x3,%ecx
+  801113:	48 ba 30 36 80 00 00 	movabs $0x803630,%rdx
+  80111a:	00 00 00 
+  80111d:	be 26 00 00 00       	mov    $0x26,%esi
+  801122:	48 bf 4f 36 80 00 00 	movabs $0x80364f,%rdi
+  801129:	00 00 00 
+  80112c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801131:	49 b9 d9 01 80 00 00 	movabs $0x8001d9,%r9
+  801138:	00 00 00 
+  80113b:	41 ff d1             	call   *%r9
+
+000000000080113e <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  80113e:	55                   	push   %rbp
+  80113f:	48 89 e5             	mov    %rsp,%rbp
+  801142:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801143:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801148:	ba 00 00 00 00       	mov    $0x0,%edx
+  80114d:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801152:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801157:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80115c:	be 00 00 00 00       	mov    $0x0,%esi
+  801161:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801167:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  801169:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80116d:	c9                   	leave
+  80116e:	c3                   	ret
+
+000000000080116f <sys_yield>:
+
+void
+sys_yield(void) {
+  80116f:	55                   	push   %rbp
+  801170:	48 89 e5             	mov    %rsp,%rbp
+  801173:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801174:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801179:	ba 00 00 00 00       	mov    $0x0,%edx
+  80117e:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801183:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801188:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80118d:	be 00 00 00 00       	mov    $0x0,%esi
+  801192:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801198:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  80119a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80119e:	c9                   	leave
+  80119f:	c3                   	ret
+
+00000000008011a0 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  8011a0:	55                   	push   %rbp
+  8011a1:	48 89 e5             	mov    %rsp,%rbp
+  8011a4:	53                   	push   %rbx
+  8011a5:	48 89 fa             	mov    %rdi,%rdx
+  8011a8:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8011ab:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8011b0:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  8011b7:	00 00 00 
+  8011ba:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8011bf:	be 00 00 00 00       	mov    $0x0,%esi
+  8011c4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8011ca:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  8011cc:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8011d0:	c9                   	leave
+  8011d1:	c3                   	ret
+
+00000000008011d2 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  8011d2:	55                   	push   %rbp
+  8011d3:	48 89 e5             	mov    %rsp,%rbp
+  8011d6:	53                   	push   %rbx
+  8011d7:	49 89 f8             	mov    %rdi,%r8
+  8011da:	48 89 d3             	mov    %rdx,%rbx
+  8011dd:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8011e0:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8011e5:	4c 89 c2             	mov    %r8,%rdx
+  8011e8:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8011eb:	be 00 00 00 00       	mov    $0x0,%esi
+  8011f0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8011f6:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  8011f8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8011fc:	c9                   	leave
+  8011fd:	c3                   	ret
+
+00000000008011fe <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  8011fe:	55                   	push   %rbp
+  8011ff:	48 89 e5             	mov    %rsp,%rbp
+  801202:	53                   	push   %rbx
+  801203:	48 83 ec 08          	sub    $0x8,%rsp
+  801207:	89 f8                	mov    %edi,%eax
+  801209:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  80120c:	48 63 f9             	movslq %ecx,%rdi
+  80120f:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801212:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801217:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80121a:	be 00 00 00 00       	mov    $0x0,%esi
+  80121f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801225:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801227:	48 85 c0             	test   %rax,%rax
+  80122a:	7f 06                	jg     801232 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  80122c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801230:	c9                   	leave
+  801231:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801232:	49 89 c0             	mov    %rax,%r8
+  801235:	b9 04 00 00 00       	mov    $0x4,%ecx
+  80123a:	48 ba 30 36 80 00 00 	movabs $0x803630,%rdx
+  801241:	00 00 00 
+  801244:	be 26 00 00 00       	mov    $0x26,%esi
+  801249:	48 bf 4f 36 80 00 00 	movabs $0x80364f,%rdi
+  801250:	00 00 00 
+  801253:	b8 00 00 00 00       	mov    $0x0,%eax
+  801258:	49 b9 d9 01 80 00 00 	movabs $0x8001d9,%r9
+  80125f:	00 00 00 
+  801262:	41 ff d1             	call   *%r9
+
+0000000000801265 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801265:	55                   	push   %rbp
+  801266:	48 89 e5             	mov    %rsp,%rbp
+  801269:	53                   	push   %rbx
+  80126a:	48 83 ec 08          	sub    $0x8,%rsp
+  80126e:	89 f8                	mov    %edi,%eax
+  801270:	49 89 f2             	mov    %rsi,%r10
+  801273:	48 89 cf             	mov    %rcx,%rdi
+  801276:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  801279:	48 63 da             	movslq %edx,%rbx
+  80127c:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80127f:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801284:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801287:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  80128a:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80128c:	48 85 c0             	test   %rax,%rax
+  80128f:	7f 06                	jg     801297 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  801291:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801295:	c9                   	leave
+  801296:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801297:	49 89 c0             	mov    %rax,%r8
+  80129a:	b9 05 00 00 00       	mov    $0x5,%ecx
+  80129f:	48 ba 30 36 80 00 00 	movabs $0x803630,%rdx
+  8012a6:	00 00 00 
+  8012a9:	be 26 00 00 00       	mov    $0x26,%esi
+  8012ae:	48 bf 4f 36 80 00 00 	movabs $0x80364f,%rdi
+  8012b5:	00 00 00 
+  8012b8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012bd:	49 b9 d9 01 80 00 00 	movabs $0x8001d9,%r9
+  8012c4:	00 00 00 
+  8012c7:	41 ff d1             	call   *%r9
+
+00000000008012ca <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  8012ca:	55                   	push   %rbp
+  8012cb:	48 89 e5             	mov    %rsp,%rbp
+  8012ce:	53                   	push   %rbx
+  8012cf:	48 83 ec 08          	sub    $0x8,%rsp
+  8012d3:	48 89 f1             	mov    %rsi,%rcx
+  8012d6:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  8012d9:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8012dc:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8012e1:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012e6:	be 00 00 00 00       	mov    $0x0,%esi
+  8012eb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8012f1:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8012f3:	48 85 c0             	test   %rax,%rax
+  8012f6:	7f 06                	jg     8012fe <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  8012f8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012fc:	c9                   	leave
+  8012fd:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8012fe:	49 89 c0             	mov    %rax,%r8
+  801301:	b9 06 00 00 00       	mov    $0x6,%ecx
+  801306:	48 ba 30 36 80 00 00 	movabs $0x803630,%rdx
+  80130d:	00 00 00 
+  801310:	be 26 00 00 00       	mov    $0x26,%esi
+  801315:	48 bf 4f 36 80 00 00 	movabs $0x80364f,%rdi
+  80131c:	00 00 00 
+  80131f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801324:	49 b9 d9 01 80 00 00 	movabs $0x8001d9,%r9
+  80132b:	00 00 00 
+  80132e:	41 ff d1             	call   *%r9
+
+0000000000801331 <sys_region_batch>:
+
+int
+sys_region_batch(const struct RegionOp *ops, size_t count) {
+  801331:	55                   	push   %rbp
+  801332:	48 89 e5             	mov    %rsp,%rbp
+  801335:	53                   	push   %rbx
+  801336:	48 83 ec 08          	sub    $0x8,%rsp
+  80133a:	48 89 fa             	mov    %rdi,%rdx
+  80133d:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801340:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801345:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80134a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80134f:	be 00 00 00 00       	mov    $0x0,%esi
+  801354:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80135a:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80135c:	48 85 c0             	test   %rax,%rax
+  80135f:	7f 06                	jg     801367 <sys_region_batch+0x36>
+        else
+            platform_asan_unpoison(va, ops[i].size);
+    }
+#endif
+    return res;
+}
+  801361:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801365:	c9                   	leave
+  801366:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801367:	49 89 c0             	mov    %rax,%r8
+  80136a:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  80136f:	48 ba 30 36 80 00 00 	movabs $0x803630,%rdx
+  801376:	00 00 00 
+  801379:	be 26 00 00 00       	mov    $0x26,%esi
+  80137e:	48 bf 4f 36 80 00 00 	movabs $0x80364f,%rdi
+  801385:	00 00 00 
+  801388:	b8 00 00 00 00       	mov    $0x0,%eax
+  80138d:	49 b9 d9 01 80 00 00 	movabs $0x8001d9,%r9
+  801394:	00 00 00 
+  801397:	41 ff d1             	call   *%r9
+
+000000000080139a <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  80139a:	55                   	push   %rbp
+  80139b:	48 89 e5             	mov    %rsp,%rbp
+  80139e:	53                   	push   %rbx
+  80139f:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  8013a3:	48 63 ce             	movslq %esi,%rcx
+  8013a6:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8013a9:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8013ae:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013b3:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013b8:	be 00 00 00 00       	mov    $0x0,%esi
+  8013bd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013c3:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8013c5:	48 85 c0             	test   %rax,%rax
+  8013c8:	7f 06                	jg     8013d0 <sys_env_set_status+0x36>
+}
+  8013ca:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013ce:	c9                   	leave
+  8013cf:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8013d0:	49 89 c0             	mov    %rax,%r8
+  8013d3:	b9 09 00 00 00       	mov    $0x9,%ecx
+  8013d8:	48 ba 30 36 80 00 00 	movabs $0x803630,%rdx
+  8013df:	00 00 00 
+  8013e2:	be 26 00 00 00       	mov    $0x26,%esi
+  8013e7:	48 bf 4f 36 80 00 00 	movabs $0x80364f,%rdi
+  8013ee:	00 00 00 
+  8013f1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013f6:	49 b9 d9 01 80 00 00 	movabs $0x8001d9,%r9
+  8013fd:	00 00 00 
+  801400:	41 ff d1             	call   *%r9
+
+0000000000801403 <sys_env_set_weight>:
+
+int
+sys_env_set_weight(envid_t envid, uint32_t weight) {
+  801403:	55                   	push   %rbp
+  801404:	48 89 e5             	mov    %rsp,%rbp
+  801407:	53                   	push   %rbx
+  801408:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_weight, 1, envid, weight, 0, 0, 0, 0);
+  80140c:	89 f1                	mov    %esi,%ecx
+  80140e:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801411:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801416:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80141b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801420:	be 00 00 00 00       	mov    $0x0,%esi
+  801425:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80142b:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80142d:	48 85 c0             	test   %rax,%rax
+  801430:	7f 06                	jg     801438 <sys_env_set_weight+0x35>
+}
+  801432:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801436:	c9                   	leave
+  801437:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801438:	49 89 c0             	mov    %rax,%r8
+  80143b:	b9 10 00 00 00       	mov    $0x10,%ecx
+  801440:	48 ba 30 36 80 00 00 	movabs $0x803630,%rdx
+  801447:	00 00 00 
+  80144a:	be 26 00 00 00       	mov    $0x26,%esi
+  80144f:	48 bf 4f 36 80 00 00 	movabs $0x80364f,%rdi
+  801456:	00 00 00 
+  801459:	b8 00 00 00 00       	mov    $0x0,%eax
+  80145e:	49 b9 d9 01 80 00 00 	movabs $0x8001d9,%r9
+  801465:	00 00 00 
+  801468:	41 ff d1             	call   *%r9
+
+000000000080146b <sys_env_set_rt>:
+
+int
+sys_env_set_rt(envid_t envid, uint64_t period, uint64_t budget, uint64_t deadline) {
+  80146b:	55                   	push   %rbp
+  80146c:	48 89 e5             	mov    %rsp,%rbp
+  80146f:	53                   	push   %rbx
+  801470:	48 83 ec 08          	sub    $0x8,%rsp
+  801474:	89 f8                	mov    %edi,%eax
+  801476:	48 89 d3             	mov    %rdx,%rbx
+  801479:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_env_set_rt, 1, envid, period, budget, deadline, 0, 0);
+  80147c:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80147f:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801484:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801487:	be 00 00 00 00       	mov    $0x0,%esi
+  80148c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801492:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801494:	48 85 c0             	test   %rax,%rax
+  801497:	7f 06                	jg     80149f <sys_env_set_rt+0x34>
+}
+  801499:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80149d:	c9                   	leave
+  80149e:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80149f:	49 89 c0             	mov    %rax,%r8
+  8014a2:	b9 11 00 00 00       	mov    $0x11,%ecx
+  8014a7:	48 ba 30 36 80 00 00 	movabs $0x803630,%rdx
+  8014ae:	00 00 00 
+  8014b1:	be 26 00 00 00       	mov    $0x26,%esi
+  8014b6:	48 bf 4f 36 80 00 00 	movabs $0x80364f,%rdi
+  8014bd:	00 00 00 
+  8014c0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014c5:	49 b9 d9 01 80 00 00 	movabs $0x8001d9,%r9
+  8014cc:	00 00 00 
+  8014cf:	41 ff d1             	call   *%r9
+
+00000000008014d2 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  8014d2:	55                   	push   %rbp
+  8014d3:	48 89 e5             	mov    %rsp,%rbp
+  8014d6:	53                   	push   %rbx
+  8014d7:	48 83 ec 08          	sub    $0x8,%rsp
+  8014db:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  8014de:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8014e1:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8014e6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014eb:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014f0:	be 00 00 00 00       	mov    $0x0,%esi
+  8014f5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014fb:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8014fd:	48 85 c0             	test   %rax,%rax
+  801500:	7f 06                	jg     801508 <sys_env_set_trapframe+0x36>
+}
+  801502:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801506:	c9                   	leave
+  801507:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801508:	49 89 c0             	mov    %rax,%r8
+  80150b:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  801510:	48 ba 30 36 80 00 00 	movabs $0x803630,%rdx
+  801517:	00 00 00 
+  80151a:	be 26 00 00 00       	mov    $0x26,%esi
+  80151f:	48 bf 4f 36 80 00 00 	movabs $0x80364f,%rdi
+  801526:	00 00 00 
+  801529:	b8 00 00 00 00       	mov    $0x0,%eax
+  80152e:	49 b9 d9 01 80 00 00 	movabs $0x8001d9,%r9
+  801535:	00 00 00 
+  801538:	41 ff d1             	call   *%r9
+
+000000000080153b <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  80153b:	55                   	push   %rbp
+  80153c:	48 89 e5             	mov    %rsp,%rbp
+  80153f:	53                   	push   %rbx
+  801540:	48 83 ec 08          	sub    $0x8,%rsp
+  801544:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  801547:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80154a:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80154f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801554:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801559:	be 00 00 00 00       	mov    $0x0,%esi
+  80155e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801564:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801566:	48 85 c0             	test   %rax,%rax
+  801569:	7f 06                	jg     801571 <sys_env_set_pgfault_upcall+0x36>
+}
+  80156b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80156f:	c9                   	leave
+  801570:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801571:	49 89 c0             	mov    %rax,%r8
+  801574:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  801579:	48 ba 30 36 80 00 00 	movabs $0x803630,%rdx
+  801580:	00 00 00 
+  801583:	be 26 00 00 00       	mov    $0x26,%esi
+  801588:	48 bf 4f 36 80 00 00 	movabs $0x80364f,%rdi
+  80158f:	00 00 00 
+  801592:	b8 00 00 00 00       	mov    $0x0,%eax
+  801597:	49 b9 d9 01 80 00 00 	movabs $0x8001d9,%r9
+  80159e:	00 00 00 
+  8015a1:	41 ff d1             	call   *%r9
+
+00000000008015a4 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  8015a4:	55                   	push   %rbp
+  8015a5:	48 89 e5             	mov    %rsp,%rbp
+  8015a8:	53                   	push   %rbx
+  8015a9:	89 f8                	mov    %edi,%eax
+  8015ab:	49 89 f1             	mov    %rsi,%r9
+  8015ae:	48 89 d3             	mov    %rdx,%rbx
+  8015b1:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  8015b4:	49 63 f0             	movslq %r8d,%rsi
+  8015b7:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8015ba:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8015bf:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015c2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015c8:	cd 30                	int    $0x30
+}
+  8015ca:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015ce:	c9                   	leave
+  8015cf:	c3                   	ret
+
+00000000008015d0 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  8015d0:	55                   	push   %rbp
+  8015d1:	48 89 e5             	mov    %rsp,%rbp
+  8015d4:	53                   	push   %rbx
+  8015d5:	48 83 ec 08          	sub    $0x8,%rsp
+  8015d9:	48 89 fa             	mov    %rdi,%rdx
+  8015dc:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8015df:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8015e4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015e9:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015ee:	be 00 00 00 00       	mov    $0x0,%esi
+  8015f3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015f9:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8015fb:	48 85 c0             	test   %rax,%rax
+  8015fe:	7f 06                	jg     801606 <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801600:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801604:	c9                   	leave
+  801605:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801606:	49 89 c0             	mov    %rax,%r8
+  801609:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  80160e:	48 ba 30 36 80 00 00 	movabs $0x803630,%rdx
+  801615:	00 00 00 
+  801618:	be 26 00 00 00       	mov    $0x26,%esi
+  80161d:	48 bf 4f 36 80 00 00 	movabs $0x80364f,%rdi
+  801624:	00 00 00 
+  801627:	b8 00 00 00 00       	mov    $0x0,%eax
+  80162c:	49 b9 d9 01 80 00 00 	movabs $0x8001d9,%r9
+  801633:	00 00 00 
+  801636:	41 ff d1             	call   *%r9
+
+0000000000801639 <_handle_vectored_pagefault>:
+/* Vector size */
+static size_t _pfhandler_off = 0;
+static bool _pfhandler_inititiallized = 0;
+
+void
+_handle_vectored_pagefault(struct UTrapframe *utf) {
+  801639:	55                   	push   %rbp
+  80163a:	48 89 e5             	mov    %rsp,%rbp
+  80163d:	41 56                	push   %r14
+  80163f:	41 55                	push   %r13
+  801641:	41 54                	push   %r12
+  801643:	53                   	push   %rbx
+  801644:	49 89 fc             	mov    %rdi,%r12
+    /* This trying to handle pagefault until
+     * some handler returns 1, that indicates
+     * successfully handled exception */
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  801647:	48 b8 68 50 80 00 00 	movabs $0x805068,%rax
+  80164e:	00 00 00 
+  801651:	48 83 38 00          	cmpq   $0x0,(%rax)
+  801655:	74 27                	je     80167e <_handle_vectored_pagefault+0x45>
+  801657:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (_pfhandler_vec[i](utf)) return;
+  80165c:	49 bd 20 50 80 00 00 	movabs $0x805020,%r13
+  801663:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  801666:	49 89 c6             	mov    %rax,%r14
+        if (_pfhandler_vec[i](utf)) return;
+  801669:	4c 89 e7             	mov    %r12,%rdi
+  80166c:	41 ff 54 dd 00       	call   *0x0(%r13,%rbx,8)
+  801671:	84 c0                	test   %al,%al
+  801673:	75 45                	jne    8016ba <_handle_vectored_pagefault+0x81>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  801675:	48 83 c3 01          	add    $0x1,%rbx
+  801679:	49 3b 1e             	cmp    (%r14),%rbx
+  80167c:	72 eb                	jb     801669 <_handle_vectored_pagefault+0x30>
+
+    /* Unhandled exceptions just cause panic */
+    panic("Userspace page fault rip=%08lX va=%08lX err=%x\n",
+  80167e:	49 8b 8c 24 88 00 00 	mov    0x88(%r12),%rcx
+  801685:	00 
+  801686:	45 8b 4c 24 08       	mov    0x8(%r12),%r9d
+  80168b:	4d 8b 04 24          	mov    (%r12),%r8
+  80168f:	48 ba 60 36 80 00 00 	movabs $0x803660,%rdx
+  801696:	00 00 00 
+  801699:	be 1d 00 00 00       	mov    $0x1d,%esi
+  80169e:	48 bf 90 36 80 00 00 	movabs $0x803690,%rdi
+  8016a5:	00 00 00 
+  8016a8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016ad:	49 ba d9 01 80 00 00 	movabs $0x8001d9,%r10
+  8016b4:	00 00 00 
+  8016b7:	41 ff d2             	call   *%r10
+          utf->utf_rip, utf->utf_fault_va, (int)utf->utf_err);
+}
+  8016ba:	5b                   	pop    %rbx
+  8016bb:	41 5c                	pop    %r12
+  8016bd:	41 5d                	pop    %r13
+  8016bf:	41 5e                	pop    %r14
+  8016c1:	5d                   	pop    %rbp
+  8016c2:	c3                   	ret
+
+00000000008016c3 <add_pgfault_handler>:
+ * The first time we register a handler, we need to
+ * allocate an exception stack (one page of memory with its top
+ * at USER_EXCEPTION_STACK_TOP), and tell the kernel to call the assembly-language
+ * _pgfault_upcall routine when a page fault occurs. */
+int
+add_pgfault_handler(pf_handler_t handler) {
+  8016c3:	55                   	push   %rbp
+  8016c4:	48 89 e5             	mov    %rsp,%rbp
+  8016c7:	53                   	push   %rbx
+  8016c8:	48 83 ec 08          	sub    $0x8,%rsp
+  8016cc:	48 89 fb             	mov    %rdi,%rbx
+    int res = 0;
+  8016cf:	be 00 00 00 00       	mov    $0x0,%esi
+    if (!_pfhandler_inititiallized) {
+  8016d4:	48 b8 60 50 80 00 00 	movabs $0x805060,%rax
+  8016db:	00 00 00 
+  8016de:	80 38 00             	cmpb   $0x0,(%rax)
+  8016e1:	74 68                	je     80174b <add_pgfault_handler+0x88>
+            goto end;
+        }
+        _pfhandler_inititiallized = 1;
+    }
+
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8016e3:	48 b8 68 50 80 00 00 	movabs $0x805068,%rax
+  8016ea:	00 00 00 
+  8016ed:	48 8b 08             	mov    (%rax),%rcx
+  8016f0:	ba 00 00 00 00       	mov    $0x0,%edx
+        if (handler == _pfhandler_vec[i]) return 0;
+  8016f5:	48 b8 20 50 80 00 00 	movabs $0x805020,%rax
+  8016fc:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8016ff:	48 85 c9             	test   %rcx,%rcx
+  801702:	0f 84 e0 00 00 00    	je     8017e8 <add_pgfault_handler+0x125>
+        if (handler == _pfhandler_vec[i]) return 0;
+  801708:	48 39 1c d0          	cmp    %rbx,(%rax,%rdx,8)
+  80170c:	0f 84 c9 00 00 00    	je     8017db <add_pgfault_handler+0x118>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  801712:	48 83 c2 01          	add    $0x1,%rdx
+  801716:	48 39 ca             	cmp    %rcx,%rdx
+  801719:	75 ed                	jne    801708 <add_pgfault_handler+0x45>
+
+    if (_pfhandler_off == MAX_PFHANDLER)
+  80171b:	48 83 f9 08          	cmp    $0x8,%rcx
+  80171f:	0f 84 84 00 00 00    	je     8017a9 <add_pgfault_handler+0xe6>
+        res = -E_INVAL;
+    else
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  801725:	48 8d 41 01          	lea    0x1(%rcx),%rax
+  801729:	48 a3 68 50 80 00 00 	movabs %rax,0x805068
+  801730:	00 00 00 
+  801733:	48 b8 20 50 80 00 00 	movabs $0x805020,%rax
+  80173a:	00 00 00 
+  80173d:	48 89 1c c8          	mov    %rbx,(%rax,%rcx,8)
+
+end:
+    if (res < 0) {
+  801741:	85 f6                	test   %esi,%esi
+  801743:	0f 89 97 00 00 00    	jns    8017e0 <add_pgfault_handler+0x11d>
+  801749:	eb 63                	jmp    8017ae <add_pgfault_handler+0xeb>
+        res = sys_alloc_region(0, (void*)(USER_EXCEPTION_STACK_TOP - USER_EXCEPTION_STACK_SIZE),
+  80174b:	b9 06 00 10 00       	mov    $0x100006,%ecx
+  801750:	ba 00 80 00 00       	mov    $0x8000,%edx
+  801755:	48 be 00 80 ff ff 7f 	movabs $0x7fffff8000,%rsi
+  80175c:	00 00 00 
+  80175f:	bf 00 00 00 00       	mov    $0x0,%edi
+  801764:	48 b8 fe 11 80 00 00 	movabs $0x8011fe,%rax
+  80176b:	00 00 00 
+  80176e:	ff d0                	call   *%rax
+  801770:	89 c6                	mov    %eax,%esi
+        if (res < 0) {
+  801772:	85 c0                	test   %eax,%eax
+  801774:	78 38                	js     8017ae <add_pgfault_handler+0xeb>
+        res = sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  801776:	48 be c4 18 80 00 00 	movabs $0x8018c4,%rsi
+  80177d:	00 00 00 
+  801780:	bf 00 00 00 00       	mov    $0x0,%edi
+  801785:	48 b8 3b 15 80 00 00 	movabs $0x80153b,%rax
+  80178c:	00 00 00 
+  80178f:	ff d0                	call   *%rax
+  801791:	89 c6                	mov    %eax,%esi
+        if (res < 0) {
+  801793:	85 c0                	test   %eax,%eax
+  801795:	78 17                	js     8017ae <add_pgfault_handler+0xeb>
+        _pfhandler_inititiallized = 1;
+  801797:	48 b8 60 50 80 00 00 	movabs $0x805060,%rax
+  80179e:	00 00 00 
+  8017a1:	c6 00 01             	movb   $0x1,(%rax)
+  8017a4:	e9 3a ff ff ff       	jmp    8016e3 <add_pgfault_handler+0x20>
+        res = -E_INVAL;
+  8017a9:	be fd ff ff ff       	mov    $0xfffffffd,%esi
+        panic("set_pgfault_handler: %i", res);
+  8017ae:	89 f1                	mov    %esi,%ecx
+  8017b0:	48 ba 9e 36 80 00 00 	movabs $0x80369e,%rdx
+  8017b7:	00 00 00 
+  8017ba:	be 43 00 00 00       	mov    $0x43,%esi
+  8017bf:	48 bf 90 36 80 00 00 	movabs $0x803690,%rdi
+  8017c6:	00 00 00 
+  8017c9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017ce:	49 b8 d9 01 80 00 00 	movabs $0x8001d9,%r8
+  8017d5:	00 00 00 
+  8017d8:	41 ff d0             	call   *%r8
+        if (handler == _pfhandler_vec[i]) return 0;
+  8017db:	be 00 00 00 00       	mov    $0x0,%esi
+    }
+    return res;
+}
+  8017e0:	89 f0                	mov    %esi,%eax
+  8017e2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8017e6:	c9                   	leave
+  8017e7:	c3                   	ret
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  8017e8:	48 b8 68 50 80 00 00 	movabs $0x805068,%rax
+  8017ef:	00 00 00 
+  8017f2:	48 c7 00 01 00 00 00 	movq   $0x1,(%rax)
+  8017f9:	48 89 d8             	mov    %rbx,%rax
+  8017fc:	48 a3 20 50 80 00 00 	movabs %rax,0x805020
+  801803:	00 00 00 
+    if (res < 0) {
+  801806:	eb d8                	jmp    8017e0 <add_pgfault_handler+0x11d>
+
+0000000000801808 <remove_pgfault_handler>:
+
+void
+remove_pgfault_handler(pf_handler_t handler) {
+  801808:	55                   	push   %rbp
+  801809:	48 89 e5             	mov    %rsp,%rbp
+    assert(_pfhandler_inititiallized);
+  80180c:	48 b8 60 50 80 00 00 	movabs $0x805060,%rax
+  801813:	00 00 00 
+  801816:	80 38 00             	cmpb   $0x0,(%rax)
+  801819:	74 33                	je     80184e <remove_pgfault_handler+0x46>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  80181b:	48 a1 68 50 80 00 00 	movabs 0x805068,%rax
+  801822:	00 00 00 
+  801825:	b9 00 00 00 00       	mov    $0x0,%ecx
+        if (_pfhandler_vec[i] == handler) {
+  80182a:	48 ba 20 50 80 00 00 	movabs $0x805020,%rdx
+  801831:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  801834:	48 85 c0             	test   %rax,%rax
+  801837:	0f 84 85 00 00 00    	je     8018c2 <remove_pgfault_handler+0xba>
+        if (_pfhandler_vec[i] == handler) {
+  80183d:	48 39 3c ca          	cmp    %rdi,(%rdx,%rcx,8)
+  801841:	74 40                	je     801883 <remove_pgfault_handler+0x7b>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  801843:	48 83 c1 01          	add    $0x1,%rcx
+  801847:	48 39 c1             	cmp    %rax,%rcx
+  80184a:	75 f1                	jne    80183d <remove_pgfault_handler+0x35>
+  80184c:	eb 74                	jmp    8018c2 <remove_pgfault_handler+0xba>
+    assert(_pfhandler_inititiallized);
+  80184e:	48 b9 b6 36 80 00 00 	movabs $0x8036b6,%rcx
+  801855:	00 00 00 
+  801858:	48 ba d0 36 80 00 00 	movabs $0x8036d0,%rdx
+  80185f:	00 00 00 
+  801862:	be 4a 00 00 00       	mov    $0x4a,%esi
+  801867:	48 bf 90 36 80 00 00 	movabs $0x803690,%rdi
+  80186e:	00 00 00 
+  801871:	b8 00 00 00 00       	mov    $0x0,%eax
+  801876:	49 b8 d9 01 80 00 00 	movabs $0x8001d9,%r8
+  80187d:	00 00 00 
+  801880:	41 ff d0             	call   *%r8
+            memmove(_pfhandler_vec + i, _pfhandler_vec + i + 1, (_pfhandler_off - i - 1) * sizeof(*handler));
+  801883:	48 8d 34 cd 08 00 00 	lea    0x8(,%rcx,8),%rsi
+  80188a:	00 
+  80188b:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  80188f:	48 29 ca             	sub    %rcx,%rdx
+  801892:	48 b8 20 50 80 00 00 	movabs $0x805020,%rax
+  801899:	00 00 00 
+  80189c:	48 8d 0c 06          	lea    (%rsi,%rax,1),%rcx
+  8018a0:	48 8d 7c 30 f8       	lea    -0x8(%rax,%rsi,1),%rdi
+  8018a5:	48 89 ce             	mov    %rcx,%rsi
+  8018a8:	48 b8 48 0e 80 00 00 	movabs $0x800e48,%rax
+  8018af:	00 00 00 
+  8018b2:	ff d0                	call   *%rax
+            _pfhandler_off--;
+  8018b4:	48 b8 68 50 80 00 00 	movabs $0x805068,%rax
+  8018bb:	00 00 00 
+  8018be:	48 83 28 01          	subq   $0x1,(%rax)
+            return;
+        }
+    }
+}
+  8018c2:	5d                   	pop    %rbp
+  8018c3:	c3                   	ret
+
+00000000008018c4 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+    # Call the C page fault handler.
+    movq  %rsp,%rdi # passing the function argument in rdi
+  8018c4:	48 89 e7             	mov    %rsp,%rdi
+    movabs $_handle_vectored_pagefault, %rax
+  8018c7:	48 b8 39 16 80 00 00 	movabs $0x801639,%rax
+  8018ce:	00 00 00 
+    call *%rax
+  8018d1:	ff d0                	call   *%rax
+    # registers are available for intermediate calculations.  You
+    # may find that you have to rearrange your code in non-obvious
+    # ways as registers become unavailable as scratch space.
+
+    # LAB 9: Your code here
+    addq $16, %rsp
+  8018d3:	48 83 c4 10          	add    $0x10,%rsp
+	movq %rsp, %rax
+  8018d7:	48 89 e0             	mov    %rsp,%rax
+	movq 120(%rsp), %rbx
+  8018da:	48 8b 5c 24 78       	mov    0x78(%rsp),%rbx
+	movq 136(%rsp), %rcx
+  8018df:	48 8b 8c 24 88 00 00 	mov    0x88(%rsp),%rcx
+  8018e6:	00 
+	movq %rcx, %rsp
+  8018e7:	48 89 cc             	mov    %rcx,%rsp
+    pushq %rbx
+  8018ea:	53                   	push   %rbx
+    movq %rax, %rsp
+  8018eb:	48 89 c4             	mov    %rax,%rsp
+
+	subq $8, %rcx
+  8018ee:	48 83 e9 08          	sub    $0x8,%rcx
+	movq %rcx, 136(%rsp)
+  8018f2:	48 89 8c 24 88 00 00 	mov    %rcx,0x88(%rsp)
+  8018f9:	00 
+
+    # Restore the trap-time registers.  After you do this, you
+    # can no longer modify any general-purpose registers (POPA).
+    # LAB 9: Your code here
+
+    pop %r15
+  8018fa:	41 5f                	pop    %r15
+    pop %r14
+  8018fc:	41 5e                	pop    %r14
+    pop %r13
+  8018fe:	41 5d                	pop    %r13
+    pop %r12
+  801900:	41 5c                	pop    %r12
+    pop %r11
+  801902:	41 5b                	pop    %r11
+    pop %r10
+  801904:	41 5a                	pop    %r10
+    pop %r9
+  801906:	41 59                	pop    %r9
+    pop %r8
+  801908:	41 58                	pop    %r8
+    pop %rsi
+  80190a:	5e                   	pop    %rsi
+    pop %rdi
+  80190b:	5f                   	pop    %rdi
+    pop %rbp
+  80190c:	5d                   	pop    %rbp
+    pop %rdx
+  80190d:	5a                   	pop    %rdx
+    pop %rcx
+  80190e:	59                   	pop    %rcx
+    pop %rbx
+  80190f:	5b                   	pop    %rbx
+    pop %rax
+  801910:	58                   	pop    %rax
+    # Restore rflags from the stack.  After you do this, you can
+    # no longer use arithmetic operations or anything else that
+    # modifies rflags.
+    # LAB 9: Your code here
+
+    addq $8, %rsp
+  801911:	48 83 c4 08          	add    $0x8,%rsp
+    popfq
+  801915:	9d                   	popf
+
+    # Switch back to the adjusted trap-time stack.
+    # LAB 9: Your code here
+
+    pop %rsp
+  801916:	5c                   	pop    %rsp
+
+    # Return to re-execute the instruction that faulted.
+    ret
+  801917:	c3                   	ret
+
+0000000000801918 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801918:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  80191f:	ff ff ff 
+  801922:	48 01 f8             	add    %rdi,%rax
+  801925:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  801929:	c3                   	ret
+
+000000000080192a <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80192a:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801931:	ff ff ff 
+  801934:	48 01 f8             	add    %rdi,%rax
+  801937:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  80193b:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  801941:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  801945:	c3                   	ret
+
+0000000000801946 <fd_alloc_from>:
+}
+
+/* Like fd_alloc(), but only considers fds starting from fdnum,
+ * so that several fds can be found before their pages are allocated */
+int
+fd_alloc_from(int fdnum, struct Fd **fd_store) {
+  801946:	55                   	push   %rbp
+  801947:	48 89 e5             	mov    %rsp,%rbp
+  80194a:	41 57                	push   %r15
+  80194c:	41 56                	push   %r14
+  80194e:	41 55                	push   %r13
+  801950:	41 54                	push   %r12
+  801952:	53                   	push   %rbx
+  801953:	48 83 ec 08          	sub    $0x8,%rsp
+  801957:	49 89 f7             	mov    %rsi,%r15
+    for (int i = MAX(fdnum, 0); i < MAXFD; i++) {
+  80195a:	85 ff                	test   %edi,%edi
+  80195c:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  801962:	44 0f 49 e7          	cmovns %edi,%r12d
+  801966:	83 ff 1f             	cmp    $0x1f,%edi
+  801969:	7f 37                	jg     8019a2 <fd_alloc_from+0x5c>
+  80196b:	49 63 dc             	movslq %r12d,%rbx
+  80196e:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  801975:	48 c1 e3 0c          	shl    $0xc,%rbx
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  801979:	49 be 4f 2a 80 00 00 	movabs $0x802a4f,%r14
+  801980:	00 00 00 
+        struct Fd *fd = INDEX2FD(i);
+  801983:	49 89 dd             	mov    %rbx,%r13
+        if (!(get_prot(fd) & PROT_R)) {
+  801986:	48 89 df             	mov    %rbx,%rdi
+  801989:	41 ff d6             	call   *%r14
+  80198c:	83 e0 04             	and    $0x4,%eax
+  80198f:	74 1c                	je     8019ad <fd_alloc_from+0x67>
+    for (int i = MAX(fdnum, 0); i < MAXFD; i++) {
+  801991:	41 83 c4 01          	add    $0x1,%r12d
+  801995:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  80199c:	41 83 fc 1f          	cmp    $0x1f,%r12d
+  8019a0:	7e e1                	jle    801983 <fd_alloc_from+0x3d>
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  8019a2:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  8019a8:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  8019ad:	4d 89 2f             	mov    %r13,(%r15)
+}
+  8019b0:	48 83 c4 08          	add    $0x8,%rsp
+  8019b4:	5b                   	pop    %rbx
+  8019b5:	41 5c                	pop    %r12
+  8019b7:	41 5d                	pop    %r13
+  8019b9:	41 5e                	pop    %r14
+  8019bb:	41 5f                	pop    %r15
+  8019bd:	5d                   	pop    %rbp
+  8019be:	c3                   	ret
+
+00000000008019bf <fd_alloc>:
+fd_alloc(struct Fd **fd_store) {
+  8019bf:	55                   	push   %rbp
+  8019c0:	48 89 e5             	mov    %rsp,%rbp
+  8019c3:	48 89 fe             	mov    %rdi,%rsi
+    return fd_alloc_from(0, fd_store);
+  8019c6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8019cb:	48 b8 46 19 80 00 00 	movabs $0x801946,%rax
+  8019d2:	00 00 00 
+  8019d5:	ff d0                	call   *%rax
+}
+  8019d7:	5d                   	pop    %rbp
+  8019d8:	c3                   	ret
+
+00000000008019d9 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  8019d9:	83 ff 1f             	cmp    $0x1f,%edi
+  8019dc:	77 39                	ja     801a17 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  8019de:	55                   	push   %rbp
+  8019df:	48 89 e5             	mov    %rsp,%rbp
+  8019e2:	41 54                	push   %r12
+  8019e4:	53                   	push   %rbx
+  8019e5:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  8019e8:	48 63 df             	movslq %edi,%rbx
+  8019eb:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  8019f2:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  8019f6:	48 89 df             	mov    %rbx,%rdi
+  8019f9:	48 b8 4f 2a 80 00 00 	movabs $0x802a4f,%rax
+  801a00:	00 00 00 
+  801a03:	ff d0                	call   *%rax
+  801a05:	a8 04                	test   $0x4,%al
+  801a07:	74 14                	je     801a1d <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  801a09:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  801a0d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801a12:	5b                   	pop    %rbx
+  801a13:	41 5c                	pop    %r12
+  801a15:	5d                   	pop    %rbp
+  801a16:	c3                   	ret
+        return -E_INVAL;
+  801a17:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801a1c:	c3                   	ret
+        return -E_INVAL;
+  801a1d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801a22:	eb ee                	jmp    801a12 <fd_lookup+0x39>
+
+0000000000801a24 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  801a24:	55                   	push   %rbp
+  801a25:	48 89 e5             	mov    %rsp,%rbp
+  801a28:	41 54                	push   %r12
+  801a2a:	53                   	push   %rbx
+  801a2b:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  801a2e:	48 b8 80 37 80 00 00 	movabs $0x803780,%rax
+  801a35:	00 00 00 
+  801a38:	48 bb 20 40 80 00 00 	movabs $0x804020,%rbx
+  801a3f:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  801a42:	39 3b                	cmp    %edi,(%rbx)
+  801a44:	74 47                	je     801a8d <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  801a46:	48 83 c0 08          	add    $0x8,%rax
+  801a4a:	48 8b 18             	mov    (%rax),%rbx
+  801a4d:	48 85 db             	test   %rbx,%rbx
+  801a50:	75 f0                	jne    801a42 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801a52:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801a59:	00 00 00 
+  801a5c:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+  801a62:	89 fa                	mov    %edi,%edx
+  801a64:	48 bf e8 36 80 00 00 	movabs $0x8036e8,%rdi
+  801a6b:	00 00 00 
+  801a6e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a73:	48 b9 29 03 80 00 00 	movabs $0x800329,%rcx
+  801a7a:	00 00 00 
+  801a7d:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  801a7f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  801a84:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  801a88:	5b                   	pop    %rbx
+  801a89:	41 5c                	pop    %r12
+  801a8b:	5d                   	pop    %rbp
+  801a8c:	c3                   	ret
+            return 0;
+  801a8d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a92:	eb f0                	jmp    801a84 <dev_lookup+0x60>
+
+0000000000801a94 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  801a94:	55                   	push   %rbp
+  801a95:	48 89 e5             	mov    %rsp,%rbp
+  801a98:	41 55                	push   %r13
+  801a9a:	41 54                	push   %r12
+  801a9c:	53                   	push   %rbx
+  801a9d:	48 83 ec 18          	sub    $0x18,%rsp
+  801aa1:	48 89 fb             	mov    %rdi,%rbx
+  801aa4:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801aa7:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  801aae:	ff ff ff 
+  801ab1:	48 01 df             	add    %rbx,%rdi
+  801ab4:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  801ab8:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801abc:	48 b8 d9 19 80 00 00 	movabs $0x8019d9,%rax
+  801ac3:	00 00 00 
+  801ac6:	ff d0                	call   *%rax
+  801ac8:	41 89 c5             	mov    %eax,%r13d
+  801acb:	85 c0                	test   %eax,%eax
+  801acd:	78 06                	js     801ad5 <fd_close+0x41>
+  801acf:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  801ad3:	74 1a                	je     801aef <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  801ad5:	45 84 e4             	test   %r12b,%r12b
+  801ad8:	b8 00 00 00 00       	mov    $0x0,%eax
+  801add:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  801ae1:	44 89 e8             	mov    %r13d,%eax
+  801ae4:	48 83 c4 18          	add    $0x18,%rsp
+  801ae8:	5b                   	pop    %rbx
+  801ae9:	41 5c                	pop    %r12
+  801aeb:	41 5d                	pop    %r13
+  801aed:	5d                   	pop    %rbp
+  801aee:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801aef:	8b 3b                	mov    (%rbx),%edi
+  801af1:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801af5:	48 b8 24 1a 80 00 00 	movabs $0x801a24,%rax
+  801afc:	00 00 00 
+  801aff:	ff d0                	call   *%rax
+  801b01:	41 89 c5             	mov    %eax,%r13d
+  801b04:	85 c0                	test   %eax,%eax
+  801b06:	78 1b                	js     801b23 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  801b08:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801b0c:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801b10:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801b16:	48 85 c0             	test   %rax,%rax
+  801b19:	74 08                	je     801b23 <fd_close+0x8f>
+  801b1b:	48 89 df             	mov    %rbx,%rdi
+  801b1e:	ff d0                	call   *%rax
+  801b20:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801b23:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801b28:	48 89 de             	mov    %rbx,%rsi
+  801b2b:	bf 00 00 00 00       	mov    $0x0,%edi
+  801b30:	48 b8 ca 12 80 00 00 	movabs $0x8012ca,%rax
+  801b37:	00 00 00 
+  801b3a:	ff d0                	call   *%rax
+    return res;
+  801b3c:	eb a3                	jmp    801ae1 <fd_close+0x4d>
+
+0000000000801b3e <close>:
+
+int
+close(int fdnum) {
+  801b3e:	55                   	push   %rbp
+  801b3f:	48 89 e5             	mov    %rsp,%rbp
+  801b42:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  801b46:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801b4a:	48 b8 d9 19 80 00 00 	movabs $0x8019d9,%rax
+  801b51:	00 00 00 
+  801b54:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801b56:	85 c0                	test   %eax,%eax
+  801b58:	78 15                	js     801b6f <close+0x31>
+
+    return fd_close(fd, 1);
+  801b5a:	be 01 00 00 00       	mov    $0x1,%esi
+  801b5f:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801b63:	48 b8 94 1a 80 00 00 	movabs $0x801a94,%rax
+  801b6a:	00 00 00 
+  801b6d:	ff d0                	call   *%rax
+}
+  801b6f:	c9                   	leave
+  801b70:	c3                   	ret
+
+0000000000801b71 <close_all>:
+
+void
+close_all(void) {
+  801b71:	55                   	push   %rbp
+  801b72:	48 89 e5             	mov    %rsp,%rbp
+  801b75:	41 54                	push   %r12
+  801b77:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  801b78:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b7d:	49 bc 3e 1b 80 00 00 	movabs $0x801b3e,%r12
+  801b84:	00 00 00 
+  801b87:	89 df                	mov    %ebx,%edi
+  801b89:	41 ff d4             	call   *%r12
+  801b8c:	83 c3 01             	add    $0x1,%ebx
+  801b8f:	83 fb 20             	cmp    $0x20,%ebx
+  801b92:	75 f3                	jne    801b87 <close_all+0x16>
+}
+  801b94:	5b                   	pop    %rbx
+  801b95:	41 5c                	pop    %r12
+  801b97:	5d                   	pop    %rbp
+  801b98:	c3                   	ret
+
+0000000000801b99 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  801b99:	55                   	push   %rbp
+  801b9a:	48 89 e5             	mov    %rsp,%rbp
+  801b9d:	41 57                	push   %r15
+  801b9f:	41 56                	push   %r14
+  801ba1:	41 55                	push   %r13
+  801ba3:	41 54                	push   %r12
+  801ba5:	53                   	push   %rbx
+  801ba6:	48 83 ec 18          	sub    $0x18,%rsp
+  801baa:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  801bad:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801bb1:	48 b8 d9 19 80 00 00 	movabs $0x8019d9,%rax
+  801bb8:	00 00 00 
+  801bbb:	ff d0                	call   *%rax
+  801bbd:	89 c3                	mov    %eax,%ebx
+  801bbf:	85 c0                	test   %eax,%eax
+  801bc1:	0f 88 b8 00 00 00    	js     801c7f <dup+0xe6>
+    close(newfdnum);
+  801bc7:	44 89 e7             	mov    %r12d,%edi
+  801bca:	48 b8 3e 1b 80 00 00 	movabs $0x801b3e,%rax
+  801bd1:	00 00 00 
+  801bd4:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  801bd6:	4d 63 ec             	movslq %r12d,%r13
+  801bd9:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  801be0:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  801be4:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  801be8:	4c 89 ff             	mov    %r15,%rdi
+  801beb:	49 be 2a 19 80 00 00 	movabs $0x80192a,%r14
+  801bf2:	00 00 00 
+  801bf5:	41 ff d6             	call   *%r14
+  801bf8:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  801bfb:	4c 89 ef             	mov    %r13,%rdi
+  801bfe:	41 ff d6             	call   *%r14
+  801c01:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  801c04:	48 89 df             	mov    %rbx,%rdi
+  801c07:	48 b8 4f 2a 80 00 00 	movabs $0x802a4f,%rax
+  801c0e:	00 00 00 
+  801c11:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  801c13:	a8 04                	test   $0x4,%al
+  801c15:	74 2b                	je     801c42 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  801c17:	41 89 c1             	mov    %eax,%r9d
+  801c1a:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801c20:	4c 89 f1             	mov    %r14,%rcx
+  801c23:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c28:	48 89 de             	mov    %rbx,%rsi
+  801c2b:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c30:	48 b8 65 12 80 00 00 	movabs $0x801265,%rax
+  801c37:	00 00 00 
+  801c3a:	ff d0                	call   *%rax
+  801c3c:	89 c3                	mov    %eax,%ebx
+  801c3e:	85 c0                	test   %eax,%eax
+  801c40:	78 4e                	js     801c90 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  801c42:	4c 89 ff             	mov    %r15,%rdi
+  801c45:	48 b8 4f 2a 80 00 00 	movabs $0x802a4f,%rax
+  801c4c:	00 00 00 
+  801c4f:	ff d0                	call   *%rax
+  801c51:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801c54:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801c5a:	4c 89 e9             	mov    %r13,%rcx
+  801c5d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c62:	4c 89 fe             	mov    %r15,%rsi
+  801c65:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c6a:	48 b8 65 12 80 00 00 	movabs $0x801265,%rax
+  801c71:	00 00 00 
+  801c74:	ff d0                	call   *%rax
+  801c76:	89 c3                	mov    %eax,%ebx
+  801c78:	85 c0                	test   %eax,%eax
+  801c7a:	78 14                	js     801c90 <dup+0xf7>
+
+    return newfdnum;
+  801c7c:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  801c7f:	89 d8                	mov    %ebx,%eax
+  801c81:	48 83 c4 18          	add    $0x18,%rsp
+  801c85:	5b                   	pop    %rbx
+  801c86:	41 5c                	pop    %r12
+  801c88:	41 5d                	pop    %r13
+  801c8a:	41 5e                	pop    %r14
+  801c8c:	41 5f                	pop    %r15
+  801c8e:	5d                   	pop    %rbp
+  801c8f:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  801c90:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801c95:	4c 89 ee             	mov    %r13,%rsi
+  801c98:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c9d:	49 bc ca 12 80 00 00 	movabs $0x8012ca,%r12
+  801ca4:	00 00 00 
+  801ca7:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  801caa:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801caf:	4c 89 f6             	mov    %r14,%rsi
+  801cb2:	bf 00 00 00 00       	mov    $0x0,%edi
+  801cb7:	41 ff d4             	call   *%r12
+    return res;
+  801cba:	eb c3                	jmp    801c7f <dup+0xe6>
+
+0000000000801cbc <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  801cbc:	55                   	push   %rbp
+  801cbd:	48 89 e5             	mov    %rsp,%rbp
+  801cc0:	41 56                	push   %r14
+  801cc2:	41 55                	push   %r13
+  801cc4:	41 54                	push   %r12
+  801cc6:	53                   	push   %rbx
+  801cc7:	48 83 ec 10          	sub    $0x10,%rsp
+  801ccb:	89 fb                	mov    %edi,%ebx
+  801ccd:	49 89 f4             	mov    %rsi,%r12
+  801cd0:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801cd3:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801cd7:	48 b8 d9 19 80 00 00 	movabs $0x8019d9,%rax
+  801cde:	00 00 00 
+  801ce1:	ff d0                	call   *%rax
+  801ce3:	85 c0                	test   %eax,%eax
+  801ce5:	78 4c                	js     801d33 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801ce7:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801ceb:	41 8b 3e             	mov    (%r14),%edi
+  801cee:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801cf2:	48 b8 24 1a 80 00 00 	movabs $0x801a24,%rax
+  801cf9:	00 00 00 
+  801cfc:	ff d0                	call   *%rax
+  801cfe:	85 c0                	test   %eax,%eax
+  801d00:	78 35                	js     801d37 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801d02:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801d06:	83 e0 03             	and    $0x3,%eax
+  801d09:	83 f8 01             	cmp    $0x1,%eax
+  801d0c:	74 2d                	je     801d3b <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801d0e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801d12:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801d16:	48 85 c0             	test   %rax,%rax
+  801d19:	74 56                	je     801d71 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  801d1b:	4c 89 ea             	mov    %r13,%rdx
+  801d1e:	4c 89 e6             	mov    %r12,%rsi
+  801d21:	4c 89 f7             	mov    %r14,%rdi
+  801d24:	ff d0                	call   *%rax
+}
+  801d26:	48 83 c4 10          	add    $0x10,%rsp
+  801d2a:	5b                   	pop    %rbx
+  801d2b:	41 5c                	pop    %r12
+  801d2d:	41 5d                	pop    %r13
+  801d2f:	41 5e                	pop    %r14
+  801d31:	5d                   	pop    %rbp
+  801d32:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801d33:	48 98                	cltq
+  801d35:	eb ef                	jmp    801d26 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801d37:	48 98                	cltq
+  801d39:	eb eb                	jmp    801d26 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801d3b:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801d42:	00 00 00 
+  801d45:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+  801d4b:	89 da                	mov    %ebx,%edx
+  801d4d:	48 bf 29 37 80 00 00 	movabs $0x803729,%rdi
+  801d54:	00 00 00 
+  801d57:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d5c:	48 b9 29 03 80 00 00 	movabs $0x800329,%rcx
+  801d63:	00 00 00 
+  801d66:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801d68:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801d6f:	eb b5                	jmp    801d26 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801d71:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801d78:	eb ac                	jmp    801d26 <read+0x6a>
+
+0000000000801d7a <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801d7a:	55                   	push   %rbp
+  801d7b:	48 89 e5             	mov    %rsp,%rbp
+  801d7e:	41 57                	push   %r15
+  801d80:	41 56                	push   %r14
+  801d82:	41 55                	push   %r13
+  801d84:	41 54                	push   %r12
+  801d86:	53                   	push   %rbx
+  801d87:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  801d8b:	48 85 d2             	test   %rdx,%rdx
+  801d8e:	74 54                	je     801de4 <readn+0x6a>
+  801d90:	41 89 fd             	mov    %edi,%r13d
+  801d93:	49 89 f6             	mov    %rsi,%r14
+  801d96:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  801d99:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  801d9e:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  801da3:	49 bf bc 1c 80 00 00 	movabs $0x801cbc,%r15
+  801daa:	00 00 00 
+  801dad:	4c 89 e2             	mov    %r12,%rdx
+  801db0:	48 29 f2             	sub    %rsi,%rdx
+  801db3:	4c 01 f6             	add    %r14,%rsi
+  801db6:	44 89 ef             	mov    %r13d,%edi
+  801db9:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  801dbc:	85 c0                	test   %eax,%eax
+  801dbe:	78 20                	js     801de0 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  801dc0:	01 c3                	add    %eax,%ebx
+  801dc2:	85 c0                	test   %eax,%eax
+  801dc4:	74 08                	je     801dce <readn+0x54>
+  801dc6:	48 63 f3             	movslq %ebx,%rsi
+  801dc9:	4c 39 e6             	cmp    %r12,%rsi
+  801dcc:	72 df                	jb     801dad <readn+0x33>
+    }
+    return res;
+  801dce:	48 63 c3             	movslq %ebx,%rax
+}
+  801dd1:	48 83 c4 08          	add    $0x8,%rsp
+  801dd5:	5b                   	pop    %rbx
+  801dd6:	41 5c                	pop    %r12
+  801dd8:	41 5d                	pop    %r13
+  801dda:	41 5e                	pop    %r14
+  801ddc:	41 5f                	pop    %r15
+  801dde:	5d                   	pop    %rbp
+  801ddf:	c3                   	ret
+        if (inc < 0) return inc;
+  801de0:	48 98                	cltq
+  801de2:	eb ed                	jmp    801dd1 <readn+0x57>
+    int inc = 1, res = 0;
+  801de4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801de9:	eb e3                	jmp    801dce <readn+0x54>
+
+0000000000801deb <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  801deb:	55                   	push   %rbp
+  801dec:	48 89 e5             	mov    %rsp,%rbp
+  801def:	41 56                	push   %r14
+  801df1:	41 55                	push   %r13
+  801df3:	41 54                	push   %r12
+  801df5:	53                   	push   %rbx
+  801df6:	48 83 ec 10          	sub    $0x10,%rsp
+  801dfa:	89 fb                	mov    %edi,%ebx
+  801dfc:	49 89 f4             	mov    %rsi,%r12
+  801dff:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801e02:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801e06:	48 b8 d9 19 80 00 00 	movabs $0x8019d9,%rax
+  801e0d:	00 00 00 
+  801e10:	ff d0                	call   *%rax
+  801e12:	85 c0                	test   %eax,%eax
+  801e14:	78 47                	js     801e5d <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801e16:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801e1a:	41 8b 3e             	mov    (%r14),%edi
+  801e1d:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801e21:	48 b8 24 1a 80 00 00 	movabs $0x801a24,%rax
+  801e28:	00 00 00 
+  801e2b:	ff d0                	call   *%rax
+  801e2d:	85 c0                	test   %eax,%eax
+  801e2f:	78 30                	js     801e61 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801e31:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  801e36:	74 2d                	je     801e65 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801e38:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801e3c:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801e40:	48 85 c0             	test   %rax,%rax
+  801e43:	74 56                	je     801e9b <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  801e45:	4c 89 ea             	mov    %r13,%rdx
+  801e48:	4c 89 e6             	mov    %r12,%rsi
+  801e4b:	4c 89 f7             	mov    %r14,%rdi
+  801e4e:	ff d0                	call   *%rax
+}
+  801e50:	48 83 c4 10          	add    $0x10,%rsp
+  801e54:	5b                   	pop    %rbx
+  801e55:	41 5c                	pop    %r12
+  801e57:	41 5d                	pop    %r13
+  801e59:	41 5e                	pop    %r14
+  801e5b:	5d                   	pop    %rbp
+  801e5c:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801e5d:	48 98                	cltq
+  801e5f:	eb ef                	jmp    801e50 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801e61:	48 98                	cltq
+  801e63:	eb eb                	jmp    801e50 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801e65:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801e6c:	00 00 00 
+  801e6f:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+  801e75:	89 da                	mov    %ebx,%edx
+  801e77:	48 bf 45 37 80 00 00 	movabs $0x803745,%rdi
+  801e7e:	00 00 00 
+  801e81:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e86:	48 b9 29 03 80 00 00 	movabs $0x800329,%rcx
+  801e8d:	00 00 00 
+  801e90:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801e92:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801e99:	eb b5                	jmp    801e50 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801e9b:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801ea2:	eb ac                	jmp    801e50 <write+0x65>
+
+0000000000801ea4 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  801ea4:	55                   	push   %rbp
+  801ea5:	48 89 e5             	mov    %rsp,%rbp
+  801ea8:	53                   	push   %rbx
+  801ea9:	48 83 ec 18          	sub    $0x18,%rsp
+  801ead:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801eaf:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801eb3:	48 b8 d9 19 80 00 00 	movabs $0x8019d9,%rax
+  801eba:	00 00 00 
+  801ebd:	ff d0                	call   *%rax
+  801ebf:	85 c0                	test   %eax,%eax
+  801ec1:	78 0c                	js     801ecf <seek+0x2b>
+
+    fd->fd_offset = offset;
+  801ec3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801ec7:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  801eca:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801ecf:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801ed3:	c9                   	leave
+  801ed4:	c3                   	ret
+
+0000000000801ed5 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  801ed5:	55                   	push   %rbp
+  801ed6:	48 89 e5             	mov    %rsp,%rbp
+  801ed9:	41 55                	push   %r13
+  801edb:	41 54                	push   %r12
+  801edd:	53                   	push   %rbx
+  801ede:	48 83 ec 18          	sub    $0x18,%rsp
+  801ee2:	89 fb                	mov    %edi,%ebx
+  801ee4:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801ee7:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801eeb:	48 b8 d9 19 80 00 00 	movabs $0x8019d9,%rax
+  801ef2:	00 00 00 
+  801ef5:	ff d0                	call   *%rax
+  801ef7:	85 c0                	test   %eax,%eax
+  801ef9:	78 38                	js     801f33 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801efb:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  801eff:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  801f03:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801f07:	48 b8 24 1a 80 00 00 	movabs $0x801a24,%rax
+  801f0e:	00 00 00 
+  801f11:	ff d0                	call   *%rax
+  801f13:	85 c0                	test   %eax,%eax
+  801f15:	78 1c                	js     801f33 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801f17:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  801f1c:	74 20                	je     801f3e <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801f1e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801f22:	48 8b 40 30          	mov    0x30(%rax),%rax
+  801f26:	48 85 c0             	test   %rax,%rax
+  801f29:	74 47                	je     801f72 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  801f2b:	44 89 e6             	mov    %r12d,%esi
+  801f2e:	4c 89 ef             	mov    %r13,%rdi
+  801f31:	ff d0                	call   *%rax
+}
+  801f33:	48 83 c4 18          	add    $0x18,%rsp
+  801f37:	5b                   	pop    %rbx
+  801f38:	41 5c                	pop    %r12
+  801f3a:	41 5d                	pop    %r13
+  801f3c:	5d                   	pop    %rbp
+  801f3d:	c3                   	ret
+                thisenv->env_id, fdnum);
+  801f3e:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801f45:	00 00 00 
+  801f48:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801f4e:	89 da                	mov    %ebx,%edx
+  801f50:	48 bf 08 37 80 00 00 	movabs $0x803708,%rdi
+  801f57:	00 00 00 
+  801f5a:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f5f:	48 b9 29 03 80 00 00 	movabs $0x800329,%rcx
+  801f66:	00 00 00 
+  801f69:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801f6b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801f70:	eb c1                	jmp    801f33 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801f72:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801f77:	eb ba                	jmp    801f33 <ftruncate+0x5e>
+
+0000000000801f79 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  801f79:	55                   	push   %rbp
+  801f7a:	48 89 e5             	mov    %rsp,%rbp
+  801f7d:	41 54                	push   %r12
+  801f7f:	53                   	push   %rbx
+  801f80:	48 83 ec 10          	sub    $0x10,%rsp
+  801f84:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801f87:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801f8b:	48 b8 d9 19 80 00 00 	movabs $0x8019d9,%rax
+  801f92:	00 00 00 
+  801f95:	ff d0                	call   *%rax
+  801f97:	85 c0                	test   %eax,%eax
+  801f99:	78 4e                	js     801fe9 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801f9b:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801f9f:	41 8b 3c 24          	mov    (%r12),%edi
+  801fa3:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801fa7:	48 b8 24 1a 80 00 00 	movabs $0x801a24,%rax
+  801fae:	00 00 00 
+  801fb1:	ff d0                	call   *%rax
+  801fb3:	85 c0                	test   %eax,%eax
+  801fb5:	78 32                	js     801fe9 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801fb7:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801fbb:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  801fc0:	74 30                	je     801ff2 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  801fc2:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  801fc5:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  801fcc:	00 00 00 
+    stat->st_isdir = 0;
+  801fcf:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  801fd6:	00 00 00 
+    stat->st_dev = dev;
+  801fd9:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  801fe0:	48 89 de             	mov    %rbx,%rsi
+  801fe3:	4c 89 e7             	mov    %r12,%rdi
+  801fe6:	ff 50 28             	call   *0x28(%rax)
+}
+  801fe9:	48 83 c4 10          	add    $0x10,%rsp
+  801fed:	5b                   	pop    %rbx
+  801fee:	41 5c                	pop    %r12
+  801ff0:	5d                   	pop    %rbp
+  801ff1:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801ff2:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801ff7:	eb f0                	jmp    801fe9 <fstat+0x70>
+
+0000000000801ff9 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  801ff9:	55                   	push   %rbp
+  801ffa:	48 89 e5             	mov    %rsp,%rbp
+  801ffd:	41 54                	push   %r12
+  801fff:	53                   	push   %rbx
+  802000:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  802003:	be 00 00 00 00       	mov    $0x0,%esi
+  802008:	48 b8 dc 23 80 00 00 	movabs $0x8023dc,%rax
+  80200f:	00 00 00 
+  802012:	ff d0                	call   *%rax
+  802014:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  802016:	85 c0                	test   %eax,%eax
+  802018:	78 25                	js     80203f <stat+0x46>
+
+    int res = fstat(fd, stat);
+  80201a:	4c 89 e6             	mov    %r12,%rsi
+  80201d:	89 c7                	mov    %eax,%edi
+  80201f:	48 b8 79 1f 80 00 00 	movabs $0x801f79,%rax
+  802026:	00 00 00 
+  802029:	ff d0                	call   *%rax
+  80202b:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  80202e:	89 df                	mov    %ebx,%edi
+  802030:	48 b8 3e 1b 80 00 00 	movabs $0x801b3e,%rax
+  802037:	00 00 00 
+  80203a:	ff d0                	call   *%rax
+
+    return res;
+  80203c:	44 89 e3             	mov    %r12d,%ebx
+}
+  80203f:	89 d8                	mov    %ebx,%eax
+  802041:	5b                   	pop    %rbx
+  802042:	41 5c                	pop    %r12
+  802044:	5d                   	pop    %rbp
+  802045:	c3                   	ret
+
+0000000000802046 <fsipc>:
+ * response may be written back to fsipcbuf.
+ * type: request code, passed as the simple integer IPC value.
+ * dstva: virtual address at which to receive reply page, 0 if none.
+ * Returns result from the file server. */
+static int
+fsipc(unsigned type, void *dstva) {
+  802046:	55                   	push   %rbp
+  802047:	48 89 e5             	mov    %rsp,%rbp
+  80204a:	41 54                	push   %r12
+  80204c:	53                   	push   %rbx
+  80204d:	48 83 ec 10          	sub    $0x10,%rsp
+  802051:	41 89 fc             	mov    %edi,%r12d
+  802054:	48 89 f3             	mov    %rsi,%rbx
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802057:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  80205e:	00 00 00 
+  802061:	83 38 00             	cmpl   $0x0,(%rax)
+  802064:	74 5e                	je     8020c4 <fsipc+0x7e>
+    if (debug) {
+        cprintf("[%08x] fsipc %d %08x\n",
+                thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+    }
+
+    ipc_send(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW);
+  802066:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  80206c:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802071:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  802078:	00 00 00 
+  80207b:	44 89 e6             	mov    %r12d,%esi
+  80207e:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  802085:	00 00 00 
+  802088:	8b 38                	mov    (%rax),%edi
+  80208a:	48 b8 43 2f 80 00 00 	movabs $0x802f43,%rax
+  802091:	00 00 00 
+  802094:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  802096:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  80209d:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  80209e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8020a3:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  8020a7:	48 89 de             	mov    %rbx,%rsi
+  8020aa:	bf 00 00 00 00       	mov    $0x0,%edi
+  8020af:	48 b8 6e 2e 80 00 00 	movabs $0x802e6e,%rax
+  8020b6:	00 00 00 
+  8020b9:	ff d0                	call   *%rax
+}
+  8020bb:	48 83 c4 10          	add    $0x10,%rsp
+  8020bf:	5b                   	pop    %rbx
+  8020c0:	41 5c                	pop    %r12
+  8020c2:	5d                   	pop    %rbp
+  8020c3:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8020c4:	bf 03 00 00 00       	mov    $0x3,%edi
+  8020c9:	48 b8 e6 2f 80 00 00 	movabs $0x802fe6,%rax
+  8020d0:	00 00 00 
+  8020d3:	ff d0                	call   *%rax
+  8020d5:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  8020dc:	00 00 
+  8020de:	eb 86                	jmp    802066 <fsipc+0x20>
+
+00000000008020e0 <devfile_trunc>:
+    return 0;
+}
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  8020e0:	55                   	push   %rbp
+  8020e1:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  8020e4:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  8020eb:	00 00 00 
+  8020ee:	8b 57 0c             	mov    0xc(%rdi),%edx
+  8020f1:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  8020f3:	89 70 04             	mov    %esi,0x4(%rax)
+
+    return fsipc(FSREQ_SET_SIZE, NULL);
+  8020f6:	be 00 00 00 00       	mov    $0x0,%esi
+  8020fb:	bf 02 00 00 00       	mov    $0x2,%edi
+  802100:	48 b8 46 20 80 00 00 	movabs $0x802046,%rax
+  802107:	00 00 00 
+  80210a:	ff d0                	call   *%rax
+}
+  80210c:	5d                   	pop    %rbp
+  80210d:	c3                   	ret
+
+000000000080210e <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  80210e:	55                   	push   %rbp
+  80210f:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  802112:	8b 47 0c             	mov    0xc(%rdi),%eax
+  802115:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  80211c:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  80211e:	be 00 00 00 00       	mov    $0x0,%esi
+  802123:	bf 06 00 00 00       	mov    $0x6,%edi
+  802128:	48 b8 46 20 80 00 00 	movabs $0x802046,%rax
+  80212f:	00 00 00 
+  802132:	ff d0                	call   *%rax
+}
+  802134:	5d                   	pop    %rbp
+  802135:	c3                   	ret
+
+0000000000802136 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  802136:	55                   	push   %rbp
+  802137:	48 89 e5             	mov    %rsp,%rbp
+  80213a:	41 54                	push   %r12
+  80213c:	53                   	push   %rbx
+  80213d:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802140:	8b 47 0c             	mov    0xc(%rdi),%eax
+  802143:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  80214a:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  80214c:	be 00 00 00 00       	mov    $0x0,%esi
+  802151:	bf 05 00 00 00       	mov    $0x5,%edi
+  802156:	48 b8 46 20 80 00 00 	movabs $0x802046,%rax
+  80215d:	00 00 00 
+  802160:	ff d0                	call   *%rax
+    if (res < 0) {
+  802162:	85 c0                	test   %eax,%eax
+  802164:	78 3d                	js     8021a3 <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802166:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  80216d:	00 00 00 
+  802170:	4c 89 e6             	mov    %r12,%rsi
+  802173:	48 89 df             	mov    %rbx,%rdi
+  802176:	48 b8 4e 0c 80 00 00 	movabs $0x800c4e,%rax
+  80217d:	00 00 00 
+  802180:	ff d0                	call   *%rax
+    st->st_size  = fsipcbuf.statRet.ret_size;
+  802182:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  802189:	00 
+  80218a:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802190:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  802197:	00 
+  802198:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  80219e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8021a3:	5b                   	pop    %rbx
+  8021a4:	41 5c                	pop    %r12
+  8021a6:	5d                   	pop    %rbp
+  8021a7:	c3                   	ret
+
+00000000008021a8 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  8021a8:	55                   	push   %rbp
+  8021a9:	48 89 e5             	mov    %rsp,%rbp
+  8021ac:	41 57                	push   %r15
+  8021ae:	41 56                	push   %r14
+  8021b0:	41 55                	push   %r13
+  8021b2:	41 54                	push   %r12
+  8021b4:	53                   	push   %rbx
+  8021b5:	48 83 ec 18          	sub    $0x18,%rsp
+  8021b9:	49 89 fe             	mov    %rdi,%r14
+  8021bc:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+  8021c0:	48 89 d3             	mov    %rdx,%rbx
+    while (n > sizeof(fsipcbuf.write.req_buf))
+  8021c3:	48 81 fa f0 0f 00 00 	cmp    $0xff0,%rdx
+  8021ca:	0f 86 e4 00 00 00    	jbe    8022b4 <devfile_write+0x10c>
+  8021d0:	49 89 f4             	mov    %rsi,%r12
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8021d3:	49 bd 00 60 80 00 00 	movabs $0x806000,%r13
+  8021da:	00 00 00 
+        memcpy(fsipcbuf.write.req_buf, buf, sizeof(fsipcbuf.write.req_buf));
+  8021dd:	49 bf af 0e 80 00 00 	movabs $0x800eaf,%r15
+  8021e4:	00 00 00 
+  8021e7:	eb 03                	jmp    8021ec <devfile_write+0x44>
+        buf += sizeof(fsipcbuf.write.req_buf);
+  8021e9:	49 89 f4             	mov    %rsi,%r12
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8021ec:	41 8b 46 0c          	mov    0xc(%r14),%eax
+  8021f0:	41 89 45 00          	mov    %eax,0x0(%r13)
+        fsipcbuf.write.req_n      = sizeof(fsipcbuf.write.req_buf);
+  8021f4:	49 c7 45 08 f0 0f 00 	movq   $0xff0,0x8(%r13)
+  8021fb:	00 
+        memcpy(fsipcbuf.write.req_buf, buf, sizeof(fsipcbuf.write.req_buf));
+  8021fc:	ba f0 0f 00 00       	mov    $0xff0,%edx
+  802201:	4c 89 e6             	mov    %r12,%rsi
+  802204:	48 bf 10 60 80 00 00 	movabs $0x806010,%rdi
+  80220b:	00 00 00 
+  80220e:	41 ff d7             	call   *%r15
+        ssize_t res = fsipc(FSREQ_WRITE, NULL);
+  802211:	be 00 00 00 00       	mov    $0x0,%esi
+  802216:	bf 04 00 00 00       	mov    $0x4,%edi
+  80221b:	48 b8 46 20 80 00 00 	movabs $0x802046,%rax
+  802222:	00 00 00 
+  802225:	ff d0                	call   *%rax
+  802227:	48 63 d0             	movslq %eax,%rdx
+        if (res < 0 || res < sizeof(fsipcbuf.write.req_buf))
+  80222a:	3d ef 0f 00 00       	cmp    $0xfef,%eax
+  80222f:	7e 71                	jle    8022a2 <devfile_write+0xfa>
+        buf += sizeof(fsipcbuf.write.req_buf);
+  802231:	49 8d b4 24 f0 0f 00 	lea    0xff0(%r12),%rsi
+  802238:	00 
+        n -= sizeof(fsipcbuf.write.req_buf);
+  802239:	48 81 eb f0 0f 00 00 	sub    $0xff0,%rbx
+    while (n > sizeof(fsipcbuf.write.req_buf))
+  802240:	48 81 fb f0 0f 00 00 	cmp    $0xff0,%rbx
+  802247:	77 a0                	ja     8021e9 <devfile_write+0x41>
+        written += sizeof(fsipcbuf.write.req_buf);
+  802249:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80224d:	49 29 c4             	sub    %rax,%r12
+  802250:	4d 8d a4 24 f0 0f 00 	lea    0xff0(%r12),%r12
+  802257:	00 
+    fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802258:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  80225f:	00 00 00 
+  802262:	41 8b 56 0c          	mov    0xc(%r14),%edx
+  802266:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.write.req_n      = n;
+  802268:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    memcpy(fsipcbuf.write.req_buf, buf, n);
+  80226c:	48 89 da             	mov    %rbx,%rdx
+  80226f:	48 8d 78 10          	lea    0x10(%rax),%rdi
+  802273:	48 b8 af 0e 80 00 00 	movabs $0x800eaf,%rax
+  80227a:	00 00 00 
+  80227d:	ff d0                	call   *%rax
+    ssize_t res = fsipc(FSREQ_WRITE, NULL);
+  80227f:	be 00 00 00 00       	mov    $0x0,%esi
+  802284:	bf 04 00 00 00       	mov    $0x4,%edi
+  802289:	48 b8 46 20 80 00 00 	movabs $0x802046,%rax
+  802290:	00 00 00 
+  802293:	ff d0                	call   *%rax
+  802295:	48 63 d0             	movslq %eax,%rdx
+    written += res;
+  802298:	49 01 d4             	add    %rdx,%r12
+  80229b:	48 85 d2             	test   %rdx,%rdx
+  80229e:	49 0f 49 d4          	cmovns %r12,%rdx
+}
+  8022a2:	48 89 d0             	mov    %rdx,%rax
+  8022a5:	48 83 c4 18          	add    $0x18,%rsp
+  8022a9:	5b                   	pop    %rbx
+  8022aa:	41 5c                	pop    %r12
+  8022ac:	41 5d                	pop    %r13
+  8022ae:	41 5e                	pop    %r14
+  8022b0:	41 5f                	pop    %r15
+  8022b2:	5d                   	pop    %rbp
+  8022b3:	c3                   	ret
+    while (n > sizeof(fsipcbuf.write.req_buf))
+  8022b4:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+    ssize_t written = 0;
+  8022b8:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8022be:	eb 98                	jmp    802258 <devfile_write+0xb0>
+
+00000000008022c0 <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  8022c0:	55                   	push   %rbp
+  8022c1:	48 89 e5             	mov    %rsp,%rbp
+  8022c4:	41 57                	push   %r15
+  8022c6:	41 56                	push   %r14
+  8022c8:	41 55                	push   %r13
+  8022ca:	41 54                	push   %r12
+  8022cc:	53                   	push   %rbx
+  8022cd:	48 83 ec 18          	sub    $0x18,%rsp
+  8022d1:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  8022d5:	49 89 f6             	mov    %rsi,%r14
+  8022d8:	49 89 d4             	mov    %rdx,%r12
+    while (n > sizeof(fsipcbuf.readRet.ret_buf))
+  8022db:	48 81 fa 00 10 00 00 	cmp    $0x1000,%rdx
+  8022e2:	0f 86 ea 00 00 00    	jbe    8023d2 <devfile_read+0x112>
+    ssize_t readsz = 0;
+  8022e8:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  8022ef:	00 
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8022f0:	49 bf 00 60 80 00 00 	movabs $0x806000,%r15
+  8022f7:	00 00 00 
+  8022fa:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8022fe:	8b 40 0c             	mov    0xc(%rax),%eax
+  802301:	41 89 07             	mov    %eax,(%r15)
+        fsipcbuf.read.req_n = sizeof(fsipcbuf.readRet.ret_buf);
+  802304:	49 c7 47 08 00 10 00 	movq   $0x1000,0x8(%r15)
+  80230b:	00 
+        ssize_t res = fsipc(FSREQ_READ, NULL);
+  80230c:	be 00 00 00 00       	mov    $0x0,%esi
+  802311:	bf 03 00 00 00       	mov    $0x3,%edi
+  802316:	48 b8 46 20 80 00 00 	movabs $0x802046,%rax
+  80231d:	00 00 00 
+  802320:	ff d0                	call   *%rax
+  802322:	4c 63 e8             	movslq %eax,%r13
+        if (res < 0)
+  802325:	4d 85 ed             	test   %r13,%r13
+  802328:	0f 88 92 00 00 00    	js     8023c0 <devfile_read+0x100>
+        memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  80232e:	4c 89 ea             	mov    %r13,%rdx
+  802331:	4c 89 fe             	mov    %r15,%rsi
+  802334:	4c 89 f7             	mov    %r14,%rdi
+  802337:	48 b8 af 0e 80 00 00 	movabs $0x800eaf,%rax
+  80233e:	00 00 00 
+  802341:	ff d0                	call   *%rax
+        if (res < sizeof(fsipcbuf.readRet.ret_buf))
+  802343:	49 81 fd ff 0f 00 00 	cmp    $0xfff,%r13
+  80234a:	76 6d                	jbe    8023b9 <devfile_read+0xf9>
+        readsz += res;
+  80234c:	4c 01 6d c0          	add    %r13,-0x40(%rbp)
+        buf += res;
+  802350:	4d 01 ee             	add    %r13,%r14
+        n -= res;
+  802353:	4d 29 ec             	sub    %r13,%r12
+    while (n > sizeof(fsipcbuf.readRet.ret_buf))
+  802356:	49 81 fc 00 10 00 00 	cmp    $0x1000,%r12
+  80235d:	77 9b                	ja     8022fa <devfile_read+0x3a>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  80235f:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  802366:	00 00 00 
+  802369:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  80236d:	8b 51 0c             	mov    0xc(%rcx),%edx
+  802370:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.read.req_n = n;
+  802372:	4c 89 60 08          	mov    %r12,0x8(%rax)
+    ssize_t res = fsipc(FSREQ_READ, NULL);
+  802376:	be 00 00 00 00       	mov    $0x0,%esi
+  80237b:	bf 03 00 00 00       	mov    $0x3,%edi
+  802380:	48 b8 46 20 80 00 00 	movabs $0x802046,%rax
+  802387:	00 00 00 
+  80238a:	ff d0                	call   *%rax
+  80238c:	4c 63 e8             	movslq %eax,%r13
+    if (res < 0)
+  80238f:	4d 85 ed             	test   %r13,%r13
+  802392:	78 2c                	js     8023c0 <devfile_read+0x100>
+    memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  802394:	4c 89 ea             	mov    %r13,%rdx
+  802397:	48 be 00 60 80 00 00 	movabs $0x806000,%rsi
+  80239e:	00 00 00 
+  8023a1:	4c 89 f7             	mov    %r14,%rdi
+  8023a4:	48 b8 af 0e 80 00 00 	movabs $0x800eaf,%rax
+  8023ab:	00 00 00 
+  8023ae:	ff d0                	call   *%rax
+    readsz += res;
+  8023b0:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8023b4:	49 01 c5             	add    %rax,%r13
+    return readsz;
+  8023b7:	eb 07                	jmp    8023c0 <devfile_read+0x100>
+            return readsz + res;
+  8023b9:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8023bd:	49 01 c5             	add    %rax,%r13
+}
+  8023c0:	4c 89 e8             	mov    %r13,%rax
+  8023c3:	48 83 c4 18          	add    $0x18,%rsp
+  8023c7:	5b                   	pop    %rbx
+  8023c8:	41 5c                	pop    %r12
+  8023ca:	41 5d                	pop    %r13
+  8023cc:	41 5e                	pop    %r14
+  8023ce:	41 5f                	pop    %r15
+  8023d0:	5d                   	pop    %rbp
+  8023d1:	c3                   	ret
+    ssize_t readsz = 0;
+  8023d2:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  8023d9:	00 
+  8023da:	eb 83                	jmp    80235f <devfile_read+0x9f>
+
+00000000008023dc <open>:
+open(const char *path, int mode) {
+  8023dc:	55                   	push   %rbp
+  8023dd:	48 89 e5             	mov    %rsp,%rbp
+  8023e0:	41 55                	push   %r13
+  8023e2:	41 54                	push   %r12
+  8023e4:	53                   	push   %rbx
+  8023e5:	48 83 ec 18          	sub    $0x18,%rsp
+  8023e9:	49 89 fc             	mov    %rdi,%r12
+  8023ec:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  8023ef:	48 b8 10 0c 80 00 00 	movabs $0x800c10,%rax
+  8023f6:	00 00 00 
+  8023f9:	ff d0                	call   *%rax
+  8023fb:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802401:	0f 87 8a 00 00 00    	ja     802491 <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802407:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  80240b:	48 b8 bf 19 80 00 00 	movabs $0x8019bf,%rax
+  802412:	00 00 00 
+  802415:	ff d0                	call   *%rax
+  802417:	89 c3                	mov    %eax,%ebx
+  802419:	85 c0                	test   %eax,%eax
+  80241b:	78 50                	js     80246d <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  80241d:	4c 89 e6             	mov    %r12,%rsi
+  802420:	48 bb 00 60 80 00 00 	movabs $0x806000,%rbx
+  802427:	00 00 00 
+  80242a:	48 89 df             	mov    %rbx,%rdi
+  80242d:	48 b8 4e 0c 80 00 00 	movabs $0x800c4e,%rax
+  802434:	00 00 00 
+  802437:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  802439:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  802440:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802444:	bf 01 00 00 00       	mov    $0x1,%edi
+  802449:	48 b8 46 20 80 00 00 	movabs $0x802046,%rax
+  802450:	00 00 00 
+  802453:	ff d0                	call   *%rax
+  802455:	89 c3                	mov    %eax,%ebx
+  802457:	85 c0                	test   %eax,%eax
+  802459:	78 1f                	js     80247a <open+0x9e>
+    return fd2num(fd);
+  80245b:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80245f:	48 b8 18 19 80 00 00 	movabs $0x801918,%rax
+  802466:	00 00 00 
+  802469:	ff d0                	call   *%rax
+  80246b:	89 c3                	mov    %eax,%ebx
+}
+  80246d:	89 d8                	mov    %ebx,%eax
+  80246f:	48 83 c4 18          	add    $0x18,%rsp
+  802473:	5b                   	pop    %rbx
+  802474:	41 5c                	pop    %r12
+  802476:	41 5d                	pop    %r13
+  802478:	5d                   	pop    %rbp
+  802479:	c3                   	ret
+        fd_close(fd, 0);
+  80247a:	be 00 00 00 00       	mov    $0x0,%esi
+  80247f:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802483:	48 b8 94 1a 80 00 00 	movabs $0x801a94,%rax
+  80248a:	00 00 00 
+  80248d:	ff d0                	call   *%rax
+        return res;
+  80248f:	eb dc                	jmp    80246d <open+0x91>
+        return -E_BAD_PATH;
+  802491:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  802496:	eb d5                	jmp    80246d <open+0x91>
+
+0000000000802498 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  802498:	55                   	push   %rbp
+  802499:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc(FSREQ_SYNC, NULL);
+  80249c:	be 00 00 00 00       	mov    $0x0,%esi
+  8024a1:	bf 08 00 00 00       	mov    $0x8,%edi
+  8024a6:	48 b8 46 20 80 00 00 	movabs $0x802046,%rax
+  8024ad:	00 00 00 
+  8024b0:	ff d0                	call   *%rax
+}
+  8024b2:	5d                   	pop    %rbp
+  8024b3:	c3                   	ret
+
+00000000008024b4 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  8024b4:	55                   	push   %rbp
+  8024b5:	48 89 e5             	mov    %rsp,%rbp
+  8024b8:	41 54                	push   %r12
+  8024ba:	53                   	push   %rbx
+  8024bb:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8024be:	48 b8 2a 19 80 00 00 	movabs $0x80192a,%rax
+  8024c5:	00 00 00 
+  8024c8:	ff d0                	call   *%rax
+  8024ca:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  8024cd:	48 be a0 37 80 00 00 	movabs $0x8037a0,%rsi
+  8024d4:	00 00 00 
+  8024d7:	48 89 df             	mov    %rbx,%rdi
+  8024da:	48 b8 4e 0c 80 00 00 	movabs $0x800c4e,%rax
+  8024e1:	00 00 00 
+  8024e4:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  8024e6:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  8024eb:	41 2b 04 24          	sub    (%r12),%eax
+  8024ef:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  8024f5:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8024fc:	00 00 00 
+    stat->st_dev = &devpipe;
+  8024ff:	48 b8 60 40 80 00 00 	movabs $0x804060,%rax
+  802506:	00 00 00 
+  802509:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  802510:	b8 00 00 00 00       	mov    $0x0,%eax
+  802515:	5b                   	pop    %rbx
+  802516:	41 5c                	pop    %r12
+  802518:	5d                   	pop    %rbp
+  802519:	c3                   	ret
+
+000000000080251a <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  80251a:	55                   	push   %rbp
+  80251b:	48 89 e5             	mov    %rsp,%rbp
+  80251e:	41 54                	push   %r12
+  802520:	53                   	push   %rbx
+  802521:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  802524:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802529:	48 89 fe             	mov    %rdi,%rsi
+  80252c:	bf 00 00 00 00       	mov    $0x0,%edi
+  802531:	49 bc ca 12 80 00 00 	movabs $0x8012ca,%r12
+  802538:	00 00 00 
+  80253b:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  80253e:	48 89 df             	mov    %rbx,%rdi
+  802541:	48 b8 2a 19 80 00 00 	movabs $0x80192a,%rax
+  802548:	00 00 00 
+  80254b:	ff d0                	call   *%rax
+  80254d:	48 89 c6             	mov    %rax,%rsi
+  802550:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802555:	bf 00 00 00 00       	mov    $0x0,%edi
+  80255a:	41 ff d4             	call   *%r12
+}
+  80255d:	5b                   	pop    %rbx
+  80255e:	41 5c                	pop    %r12
+  802560:	5d                   	pop    %rbp
+  802561:	c3                   	ret
+
+0000000000802562 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  802562:	55                   	push   %rbp
+  802563:	48 89 e5             	mov    %rsp,%rbp
+  802566:	41 57                	push   %r15
+  802568:	41 56                	push   %r14
+  80256a:	41 55                	push   %r13
+  80256c:	41 54                	push   %r12
+  80256e:	53                   	push   %rbx
+  80256f:	48 83 ec 18          	sub    $0x18,%rsp
+  802573:	49 89 fc             	mov    %rdi,%r12
+  802576:	49 89 f5             	mov    %rsi,%r13
+  802579:	49 89 d7             	mov    %rdx,%r15
+  80257c:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802580:	48 b8 2a 19 80 00 00 	movabs $0x80192a,%rax
+  802587:	00 00 00 
+  80258a:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  80258c:	4d 85 ff             	test   %r15,%r15
+  80258f:	0f 84 af 00 00 00    	je     802644 <devpipe_write+0xe2>
+  802595:	48 89 c3             	mov    %rax,%rbx
+  802598:	4c 89 f8             	mov    %r15,%rax
+  80259b:	4d 89 ef             	mov    %r13,%r15
+  80259e:	4c 01 e8             	add    %r13,%rax
+  8025a1:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8025a5:	49 bd d2 11 80 00 00 	movabs $0x8011d2,%r13
+  8025ac:	00 00 00 
+            sys_yield();
+  8025af:	49 be 6f 11 80 00 00 	movabs $0x80116f,%r14
+  8025b6:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  8025b9:	8b 73 04             	mov    0x4(%rbx),%esi
+  8025bc:	48 63 ce             	movslq %esi,%rcx
+  8025bf:	48 63 03             	movslq (%rbx),%rax
+  8025c2:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  8025c8:	48 39 c1             	cmp    %rax,%rcx
+  8025cb:	72 2e                	jb     8025fb <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8025cd:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8025d2:	48 89 da             	mov    %rbx,%rdx
+  8025d5:	be 00 10 00 00       	mov    $0x1000,%esi
+  8025da:	4c 89 e7             	mov    %r12,%rdi
+  8025dd:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  8025e0:	85 c0                	test   %eax,%eax
+  8025e2:	74 66                	je     80264a <devpipe_write+0xe8>
+            sys_yield();
+  8025e4:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  8025e7:	8b 73 04             	mov    0x4(%rbx),%esi
+  8025ea:	48 63 ce             	movslq %esi,%rcx
+  8025ed:	48 63 03             	movslq (%rbx),%rax
+  8025f0:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  8025f6:	48 39 c1             	cmp    %rax,%rcx
+  8025f9:	73 d2                	jae    8025cd <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8025fb:	41 0f b6 3f          	movzbl (%r15),%edi
+  8025ff:	48 89 ca             	mov    %rcx,%rdx
+  802602:	48 c1 ea 03          	shr    $0x3,%rdx
+  802606:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  80260d:	08 10 20 
+  802610:	48 f7 e2             	mul    %rdx
+  802613:	48 c1 ea 06          	shr    $0x6,%rdx
+  802617:	48 89 d0             	mov    %rdx,%rax
+  80261a:	48 c1 e0 09          	shl    $0x9,%rax
+  80261e:	48 29 d0             	sub    %rdx,%rax
+  802621:	48 c1 e0 03          	shl    $0x3,%rax
+  802625:	48 29 c1             	sub    %rax,%rcx
+  802628:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  80262d:	83 c6 01             	add    $0x1,%esi
+  802630:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  802633:	49 83 c7 01          	add    $0x1,%r15
+  802637:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80263b:	49 39 c7             	cmp    %rax,%r15
+  80263e:	0f 85 75 ff ff ff    	jne    8025b9 <devpipe_write+0x57>
+    return n;
+  802644:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802648:	eb 05                	jmp    80264f <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  80264a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80264f:	48 83 c4 18          	add    $0x18,%rsp
+  802653:	5b                   	pop    %rbx
+  802654:	41 5c                	pop    %r12
+  802656:	41 5d                	pop    %r13
+  802658:	41 5e                	pop    %r14
+  80265a:	41 5f                	pop    %r15
+  80265c:	5d                   	pop    %rbp
+  80265d:	c3                   	ret
+
+000000000080265e <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  80265e:	55                   	push   %rbp
+  80265f:	48 89 e5             	mov    %rsp,%rbp
+  802662:	41 57                	push   %r15
+  802664:	41 56                	push   %r14
+  802666:	41 55                	push   %r13
+  802668:	41 54                	push   %r12
+  80266a:	53                   	push   %rbx
+  80266b:	48 83 ec 18          	sub    $0x18,%rsp
+  80266f:	49 89 fc             	mov    %rdi,%r12
+  802672:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  802676:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80267a:	48 b8 2a 19 80 00 00 	movabs $0x80192a,%rax
+  802681:	00 00 00 
+  802684:	ff d0                	call   *%rax
+  802686:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  802689:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80268f:	49 bd d2 11 80 00 00 	movabs $0x8011d2,%r13
+  802696:	00 00 00 
+            sys_yield();
+  802699:	49 be 6f 11 80 00 00 	movabs $0x80116f,%r14
+  8026a0:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  8026a3:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  8026a8:	74 7d                	je     802727 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  8026aa:	8b 03                	mov    (%rbx),%eax
+  8026ac:	3b 43 04             	cmp    0x4(%rbx),%eax
+  8026af:	75 26                	jne    8026d7 <devpipe_read+0x79>
+            if (i > 0) return i;
+  8026b1:	4d 85 ff             	test   %r15,%r15
+  8026b4:	75 77                	jne    80272d <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8026b6:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8026bb:	48 89 da             	mov    %rbx,%rdx
+  8026be:	be 00 10 00 00       	mov    $0x1000,%esi
+  8026c3:	4c 89 e7             	mov    %r12,%rdi
+  8026c6:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  8026c9:	85 c0                	test   %eax,%eax
+  8026cb:	74 72                	je     80273f <devpipe_read+0xe1>
+            sys_yield();
+  8026cd:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  8026d0:	8b 03                	mov    (%rbx),%eax
+  8026d2:	3b 43 04             	cmp    0x4(%rbx),%eax
+  8026d5:	74 df                	je     8026b6 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  8026d7:	48 63 c8             	movslq %eax,%rcx
+  8026da:	48 89 ca             	mov    %rcx,%rdx
+  8026dd:	48 c1 ea 03          	shr    $0x3,%rdx
+  8026e1:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  8026e8:	08 10 20 
+  8026eb:	48 89 d0             	mov    %rdx,%rax
+  8026ee:	48 f7 e6             	mul    %rsi
+  8026f1:	48 c1 ea 06          	shr    $0x6,%rdx
+  8026f5:	48 89 d0             	mov    %rdx,%rax
+  8026f8:	48 c1 e0 09          	shl    $0x9,%rax
+  8026fc:	48 29 d0             	sub    %rdx,%rax
+  8026ff:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  802706:	00 
+  802707:	48 89 c8             	mov    %rcx,%rax
+  80270a:	48 29 d0             	sub    %rdx,%rax
+  80270d:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  802712:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  802716:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  80271a:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  80271d:	49 83 c7 01          	add    $0x1,%r15
+  802721:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  802725:	75 83                	jne    8026aa <devpipe_read+0x4c>
+    return n;
+  802727:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80272b:	eb 03                	jmp    802730 <devpipe_read+0xd2>
+            if (i > 0) return i;
+  80272d:	4c 89 f8             	mov    %r15,%rax
+}
+  802730:	48 83 c4 18          	add    $0x18,%rsp
+  802734:	5b                   	pop    %rbx
+  802735:	41 5c                	pop    %r12
+  802737:	41 5d                	pop    %r13
+  802739:	41 5e                	pop    %r14
+  80273b:	41 5f                	pop    %r15
+  80273d:	5d                   	pop    %rbp
+  80273e:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  80273f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802744:	eb ea                	jmp    802730 <devpipe_read+0xd2>
+
+0000000000802746 <pipe>:
+pipe(int pfd[2]) {
+  802746:	55                   	push   %rbp
+  802747:	48 89 e5             	mov    %rsp,%rbp
+  80274a:	41 55                	push   %r13
+  80274c:	41 54                	push   %r12
+  80274e:	53                   	push   %rbx
+  80274f:	48 81 ec b8 00 00 00 	sub    $0xb8,%rsp
+  802756:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  802759:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  80275d:	48 b8 bf 19 80 00 00 	movabs $0x8019bf,%rax
+  802764:	00 00 00 
+  802767:	ff d0                	call   *%rax
+  802769:	89 c3                	mov    %eax,%ebx
+  80276b:	85 c0                	test   %eax,%eax
+  80276d:	0f 88 51 01 00 00    	js     8028c4 <pipe+0x17e>
+        (res = fd_alloc_from(fd2num(fd0) + 1, &fd1)) < 0) goto err;
+  802773:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802777:	48 b8 18 19 80 00 00 	movabs $0x801918,%rax
+  80277e:	00 00 00 
+  802781:	ff d0                	call   *%rax
+  802783:	8d 78 01             	lea    0x1(%rax),%edi
+  802786:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80278a:	48 b8 46 19 80 00 00 	movabs $0x801946,%rax
+  802791:	00 00 00 
+  802794:	ff d0                	call   *%rax
+  802796:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  802798:	85 c0                	test   %eax,%eax
+  80279a:	0f 88 24 01 00 00    	js     8028c4 <pipe+0x17e>
+    va = fd2data(fd0);
+  8027a0:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8027a4:	48 bb 2a 19 80 00 00 	movabs $0x80192a,%rbx
+  8027ab:	00 00 00 
+  8027ae:	ff d3                	call   *%rbx
+  8027b0:	49 89 c5             	mov    %rax,%r13
+    struct RegionOp ops[] = {
+  8027b3:	48 8d bd 30 ff ff ff 	lea    -0xd0(%rbp),%rdi
+  8027ba:	b9 14 00 00 00       	mov    $0x14,%ecx
+  8027bf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027c4:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+  8027c7:	c7 85 34 ff ff ff 46 	movl   $0x46,-0xcc(%rbp)
+  8027ce:	00 00 00 
+  8027d1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8027d5:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+  8027dc:	48 c7 85 50 ff ff ff 	movq   $0x1000,-0xb0(%rbp)
+  8027e3:	00 10 00 00 
+  8027e7:	c7 85 5c ff ff ff 46 	movl   $0x46,-0xa4(%rbp)
+  8027ee:	00 00 00 
+            {.type = REGION_ALLOC, .dstva = (uintptr_t)fd1, .size = PAGE_SIZE, .perm = PROT_RW | PROT_SHARE},
+  8027f1:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+    struct RegionOp ops[] = {
+  8027f5:	48 89 bd 70 ff ff ff 	mov    %rdi,-0x90(%rbp)
+  8027fc:	48 c7 85 78 ff ff ff 	movq   $0x1000,-0x88(%rbp)
+  802803:	00 10 00 00 
+  802807:	c7 45 84 46 00 00 00 	movl   $0x46,-0x7c(%rbp)
+  80280e:	4c 89 6d 98          	mov    %r13,-0x68(%rbp)
+  802812:	48 c7 45 a0 00 10 00 	movq   $0x1000,-0x60(%rbp)
+  802819:	00 
+  80281a:	c7 45 a8 01 00 00 00 	movl   $0x1,-0x58(%rbp)
+  802821:	c7 45 ac 46 00 00 00 	movl   $0x46,-0x54(%rbp)
+  802828:	4c 89 6d b8          	mov    %r13,-0x48(%rbp)
+            {.type = REGION_MAP, .srcva = (uintptr_t)va, .dstva = (uintptr_t)fd2data(fd1), .size = PAGE_SIZE, .perm = PROT_RW | PROT_SHARE},
+  80282c:	ff d3                	call   *%rbx
+    struct RegionOp ops[] = {
+  80282e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802832:	48 c7 45 c8 00 10 00 	movq   $0x1000,-0x38(%rbp)
+  802839:	00 
+    if ((res = sys_region_batch(ops, sizeof ops / sizeof *ops)) < 0) goto err1;
+  80283a:	be 04 00 00 00       	mov    $0x4,%esi
+  80283f:	48 8d bd 30 ff ff ff 	lea    -0xd0(%rbp),%rdi
+  802846:	48 b8 31 13 80 00 00 	movabs $0x801331,%rax
+  80284d:	00 00 00 
+  802850:	ff d0                	call   *%rax
+  802852:	89 c3                	mov    %eax,%ebx
+  802854:	85 c0                	test   %eax,%eax
+  802856:	0f 88 ad 00 00 00    	js     802909 <pipe+0x1c3>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  80285c:	be 00 10 00 00       	mov    $0x1000,%esi
+  802861:	4c 89 ef             	mov    %r13,%rdi
+  802864:	48 b8 a0 11 80 00 00 	movabs $0x8011a0,%rax
+  80286b:	00 00 00 
+  80286e:	ff d0                	call   *%rax
+  802870:	83 f8 02             	cmp    $0x2,%eax
+  802873:	75 5f                	jne    8028d4 <pipe+0x18e>
+    fd0->fd_dev_id = devpipe.dev_id;
+  802875:	a1 60 40 80 00 00 00 	movabs 0x804060,%eax
+  80287c:	00 00 
+  80287e:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802882:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  802884:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802888:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  80288f:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  802893:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  802895:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802899:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  8028a0:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8028a4:	48 bb 18 19 80 00 00 	movabs $0x801918,%rbx
+  8028ab:	00 00 00 
+  8028ae:	ff d3                	call   *%rbx
+  8028b0:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  8028b4:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  8028b8:	ff d3                	call   *%rbx
+  8028ba:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  8028bf:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  8028c4:	89 d8                	mov    %ebx,%eax
+  8028c6:	48 81 c4 b8 00 00 00 	add    $0xb8,%rsp
+  8028cd:	5b                   	pop    %rbx
+  8028ce:	41 5c                	pop    %r12
+  8028d0:	41 5d                	pop    %r13
+  8028d2:	5d                   	pop    %rbp
+  8028d3:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8028d4:	48 b9 b8 37 80 00 00 	movabs $0x8037b8,%rcx
+  8028db:	00 00 00 
+  8028de:	48 ba d0 36 80 00 00 	movabs $0x8036d0,%rdx
+  8028e5:	00 00 00 
+  8028e8:	be 33 00 00 00       	mov    $0x33,%esi
+  8028ed:	48 bf a7 37 80 00 00 	movabs $0x8037a7,%rdi
+  8028f4:	00 00 00 
+  8028f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028fc:	49 b8 d9 01 80 00 00 	movabs $0x8001d9,%r8
+  802903:	00 00 00 
+  802906:	41 ff d0             	call   *%r8
+        ops[i].type = REGION_UNMAP;
+  802909:	c7 85 30 ff ff ff 02 	movl   $0x2,-0xd0(%rbp)
+  802910:	00 00 00 
+  802913:	c7 85 58 ff ff ff 02 	movl   $0x2,-0xa8(%rbp)
+  80291a:	00 00 00 
+  80291d:	c7 45 80 02 00 00 00 	movl   $0x2,-0x80(%rbp)
+  802924:	c7 45 a8 02 00 00 00 	movl   $0x2,-0x58(%rbp)
+    sys_region_batch(ops, sizeof ops / sizeof *ops);
+  80292b:	be 04 00 00 00       	mov    $0x4,%esi
+  802930:	48 8d bd 30 ff ff ff 	lea    -0xd0(%rbp),%rdi
+  802937:	48 b8 31 13 80 00 00 	movabs $0x801331,%rax
+  80293e:	00 00 00 
+  802941:	ff d0                	call   *%rax
+  802943:	e9 7c ff ff ff       	jmp    8028c4 <pipe+0x17e>
+
+0000000000802948 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  802948:	55                   	push   %rbp
+  802949:	48 89 e5             	mov    %rsp,%rbp
+  80294c:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  802950:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802954:	48 b8 d9 19 80 00 00 	movabs $0x8019d9,%rax
+  80295b:	00 00 00 
+  80295e:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802960:	85 c0                	test   %eax,%eax
+  802962:	78 35                	js     802999 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  802964:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802968:	48 b8 2a 19 80 00 00 	movabs $0x80192a,%rax
+  80296f:	00 00 00 
+  802972:	ff d0                	call   *%rax
+  802974:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802977:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80297c:	be 00 10 00 00       	mov    $0x1000,%esi
+  802981:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802985:	48 b8 d2 11 80 00 00 	movabs $0x8011d2,%rax
+  80298c:	00 00 00 
+  80298f:	ff d0                	call   *%rax
+  802991:	85 c0                	test   %eax,%eax
+  802993:	0f 94 c0             	sete   %al
+  802996:	0f b6 c0             	movzbl %al,%eax
+}
+  802999:	c9                   	leave
+  80299a:	c3                   	ret
+
+000000000080299b <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  80299b:	48 89 f8             	mov    %rdi,%rax
+  80299e:	48 c1 e8 27          	shr    $0x27,%rax
+  8029a2:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  8029a9:	01 00 00 
+  8029ac:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8029b0:	f6 c2 01             	test   $0x1,%dl
+  8029b3:	74 6d                	je     802a22 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8029b5:	48 89 f8             	mov    %rdi,%rax
+  8029b8:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8029bc:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8029c3:	01 00 00 
+  8029c6:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8029ca:	f6 c2 01             	test   $0x1,%dl
+  8029cd:	74 62                	je     802a31 <get_uvpt_entry+0x96>
+  8029cf:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8029d6:	01 00 00 
+  8029d9:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8029dd:	f6 c2 80             	test   $0x80,%dl
+  8029e0:	75 4f                	jne    802a31 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8029e2:	48 89 f8             	mov    %rdi,%rax
+  8029e5:	48 c1 e8 15          	shr    $0x15,%rax
+  8029e9:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8029f0:	01 00 00 
+  8029f3:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8029f7:	f6 c2 01             	test   $0x1,%dl
+  8029fa:	74 44                	je     802a40 <get_uvpt_entry+0xa5>
+  8029fc:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802a03:	01 00 00 
+  802a06:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802a0a:	f6 c2 80             	test   $0x80,%dl
+  802a0d:	75 31                	jne    802a40 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  802a0f:	48 c1 ef 0c          	shr    $0xc,%rdi
+  802a13:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802a1a:	01 00 00 
+  802a1d:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  802a21:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  802a22:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  802a29:	01 00 00 
+  802a2c:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802a30:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  802a31:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802a38:	01 00 00 
+  802a3b:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802a3f:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  802a40:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802a47:	01 00 00 
+  802a4a:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802a4e:	c3                   	ret
+
+0000000000802a4f <get_prot>:
+
+int
+get_prot(void *va) {
+  802a4f:	55                   	push   %rbp
+  802a50:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  802a53:	48 b8 9b 29 80 00 00 	movabs $0x80299b,%rax
+  802a5a:	00 00 00 
+  802a5d:	ff d0                	call   *%rax
+  802a5f:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  802a62:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  802a67:	89 c1                	mov    %eax,%ecx
+  802a69:	83 c9 04             	or     $0x4,%ecx
+  802a6c:	f6 c2 01             	test   $0x1,%dl
+  802a6f:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  802a72:	89 c1                	mov    %eax,%ecx
+  802a74:	83 c9 02             	or     $0x2,%ecx
+  802a77:	f6 c2 02             	test   $0x2,%dl
+  802a7a:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  802a7d:	89 c1                	mov    %eax,%ecx
+  802a7f:	83 c9 01             	or     $0x1,%ecx
+  802a82:	48 85 d2             	test   %rdx,%rdx
+  802a85:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  802a88:	89 c1                	mov    %eax,%ecx
+  802a8a:	83 c9 40             	or     $0x40,%ecx
+  802a8d:	f6 c6 04             	test   $0x4,%dh
+  802a90:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  802a93:	5d                   	pop    %rbp
+  802a94:	c3                   	ret
+
+0000000000802a95 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  802a95:	55                   	push   %rbp
+  802a96:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  802a99:	48 b8 9b 29 80 00 00 	movabs $0x80299b,%rax
+  802aa0:	00 00 00 
+  802aa3:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  802aa5:	48 c1 e8 06          	shr    $0x6,%rax
+  802aa9:	83 e0 01             	and    $0x1,%eax
+}
+  802aac:	5d                   	pop    %rbp
+  802aad:	c3                   	ret
+
+0000000000802aae <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  802aae:	55                   	push   %rbp
+  802aaf:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  802ab2:	48 b8 9b 29 80 00 00 	movabs $0x80299b,%rax
+  802ab9:	00 00 00 
+  802abc:	ff d0                	call   *%rax
+  802abe:	83 e0 01             	and    $0x1,%eax
+}
+  802ac1:	5d                   	pop    %rbp
+  802ac2:	c3                   	ret
+
+0000000000802ac3 <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  802ac3:	55                   	push   %rbp
+  802ac4:	48 89 e5             	mov    %rsp,%rbp
+  802ac7:	41 57                	push   %r15
+  802ac9:	41 56                	push   %r14
+  802acb:	41 55                	push   %r13
+  802acd:	41 54                	push   %r12
+  802acf:	53                   	push   %rbx
+  802ad0:	48 83 ec 38          	sub    $0x38,%rsp
+  802ad4:	49 89 f7             	mov    %rsi,%r15
+  802ad7:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+                    }
+                    continue;
+                }
+                for (int ptei = 0; ptei < PT_ENTRY_COUNT; ptei++) {
+                    uintptr_t pte_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, pdei, ptei, 0);
+                    pte_t pte = uvpt[VPT(pte_addr)];
+  802add:	49 bd 00 00 00 00 00 	movabs $0x10000000000,%r13
+  802ae4:	01 00 00 
+  802ae7:	4d 89 e6             	mov    %r12,%r14
+  802aea:	49 89 fc             	mov    %rdi,%r12
+  802aed:	e9 19 01 00 00       	jmp    802c0b <foreach_shared_region+0x148>
+  802af2:	48 89 5d b0          	mov    %rbx,-0x50(%rbp)
+  802af6:	4c 89 75 a8          	mov    %r14,-0x58(%rbp)
+  802afa:	eb 52                	jmp    802b4e <foreach_shared_region+0x8b>
+                for (int ptei = 0; ptei < PT_ENTRY_COUNT; ptei++) {
+  802afc:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802b03:	48 81 fb 00 00 20 00 	cmp    $0x200000,%rbx
+  802b0a:	74 2e                	je     802b3a <foreach_shared_region+0x77>
+                    uintptr_t pte_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, pdei, ptei, 0);
+  802b0c:	48 89 df             	mov    %rbx,%rdi
+  802b0f:	4c 09 f7             	or     %r14,%rdi
+                    pte_t pte = uvpt[VPT(pte_addr)];
+  802b12:	48 89 f8             	mov    %rdi,%rax
+  802b15:	48 c1 e8 0c          	shr    $0xc,%rax
+  802b19:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+                    if ((pte & PTE_P) && (pte & PTE_SHARE)) {
+  802b1e:	25 01 04 00 00       	and    $0x401,%eax
+  802b23:	48 3d 01 04 00 00    	cmp    $0x401,%rax
+  802b29:	75 d1                	jne    802afc <foreach_shared_region+0x39>
+                        fun((void*)pte_addr, (void*)(pte_addr + PAGE_SIZE), arg);
+  802b2b:	48 8d b7 00 10 00 00 	lea    0x1000(%rdi),%rsi
+  802b32:	4c 89 fa             	mov    %r15,%rdx
+  802b35:	41 ff d4             	call   *%r12
+  802b38:	eb c2                	jmp    802afc <foreach_shared_region+0x39>
+            for (int pdei = 0; pdei < PD_ENTRY_COUNT; pdei++) {
+  802b3a:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  802b41:	00 
+  802b42:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802b46:	48 3d 00 00 00 40    	cmp    $0x40000000,%rax
+  802b4c:	74 46                	je     802b94 <foreach_shared_region+0xd1>
+                uintptr_t pde_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, pdei, 0, 0);
+  802b4e:	4c 8b 75 c8          	mov    -0x38(%rbp),%r14
+  802b52:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802b56:	49 09 c6             	or     %rax,%r14
+                pde_t pde = uvpd[VPD(pde_addr)];
+  802b59:	4c 89 f0             	mov    %r14,%rax
+  802b5c:	48 c1 e8 15          	shr    $0x15,%rax
+  802b60:	48 b9 00 00 00 80 00 	movabs $0x10080000000,%rcx
+  802b67:	01 00 00 
+  802b6a:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+                if (!(pde & PTE_P)) {
+  802b6e:	a8 01                	test   $0x1,%al
+  802b70:	74 c8                	je     802b3a <foreach_shared_region+0x77>
+                if (pde & PTE_PS) {
+  802b72:	48 89 c3             	mov    %rax,%rbx
+  802b75:	81 e3 80 00 00 00    	and    $0x80,%ebx
+  802b7b:	74 8f                	je     802b0c <foreach_shared_region+0x49>
+                    if (pde & PTE_SHARE) {
+  802b7d:	f6 c4 04             	test   $0x4,%ah
+  802b80:	74 b8                	je     802b3a <foreach_shared_region+0x77>
+                        fun((void*)pde_addr, (void*)(pde_addr + 1024 * 1024 * 2), arg);
+  802b82:	49 8d b6 00 00 20 00 	lea    0x200000(%r14),%rsi
+  802b89:	4c 89 fa             	mov    %r15,%rdx
+  802b8c:	4c 89 f7             	mov    %r14,%rdi
+  802b8f:	41 ff d4             	call   *%r12
+  802b92:	eb a6                	jmp    802b3a <foreach_shared_region+0x77>
+  802b94:	48 8b 5d b0          	mov    -0x50(%rbp),%rbx
+  802b98:	4c 8b 75 a8          	mov    -0x58(%rbp),%r14
+        for (int pdpei = 0; pdpei < PDP_ENTRY_COUNT; pdpei++) {
+  802b9c:	48 81 c3 00 00 00 40 	add    $0x40000000,%rbx
+  802ba3:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802baa:	00 00 00 
+  802bad:	48 39 c3             	cmp    %rax,%rbx
+  802bb0:	74 4c                	je     802bfe <foreach_shared_region+0x13b>
+            uintptr_t pdpe_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, 0, 0, 0);
+  802bb2:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802bb6:	48 09 d8             	or     %rbx,%rax
+  802bb9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+            pdpe_t pdpe = uvpdp[VPDP(pdpe_addr)];
+  802bbd:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802bc1:	48 b9 00 00 40 80 00 	movabs $0x10080400000,%rcx
+  802bc8:	01 00 00 
+  802bcb:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+            if (!(pdpe & PTE_P)) {
+  802bcf:	a8 01                	test   $0x1,%al
+  802bd1:	74 c9                	je     802b9c <foreach_shared_region+0xd9>
+            if (pdpe & PTE_PS) {
+  802bd3:	48 89 c1             	mov    %rax,%rcx
+  802bd6:	81 e1 80 00 00 00    	and    $0x80,%ecx
+  802bdc:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  802be0:	0f 84 0c ff ff ff    	je     802af2 <foreach_shared_region+0x2f>
+                if (pdpe & PTE_SHARE) {
+  802be6:	f6 c4 04             	test   $0x4,%ah
+  802be9:	74 b1                	je     802b9c <foreach_shared_region+0xd9>
+                    fun((void*)pdpe_addr, (void*)(pdpe_addr + 1024 * 1024 * 1024), arg); 
+  802beb:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  802bef:	48 8d b7 00 00 00 40 	lea    0x40000000(%rdi),%rsi
+  802bf6:	4c 89 fa             	mov    %r15,%rdx
+  802bf9:	41 ff d4             	call   *%r12
+  802bfc:	eb 9e                	jmp    802b9c <foreach_shared_region+0xd9>
+    for (int pml4ei = 0; pml4ei < PML4_ENTRY_COUNT; pml4ei++) {
+  802bfe:	49 83 c6 01          	add    $0x1,%r14
+  802c02:	49 81 fe 00 02 00 00 	cmp    $0x200,%r14
+  802c09:	74 24                	je     802c2f <foreach_shared_region+0x16c>
+        pml4e_t pml4e = uvpml4[VPML4(pml4_addr)];
+  802c0b:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  802c12:	01 00 00 
+  802c15:	4a 8b 04 f0          	mov    (%rax,%r14,8),%rax
+        if (!(pml4e & PTE_P)) {
+  802c19:	a8 01                	test   $0x1,%al
+  802c1b:	74 e1                	je     802bfe <foreach_shared_region+0x13b>
+  802c1d:	4c 89 f0             	mov    %r14,%rax
+  802c20:	48 c1 e0 27          	shl    $0x27,%rax
+  802c24:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  802c28:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802c2d:	eb 83                	jmp    802bb2 <foreach_shared_region+0xef>
+            }
+        }
+    }
+    
+    return 0;
+}
+  802c2f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c34:	48 83 c4 38          	add    $0x38,%rsp
+  802c38:	5b                   	pop    %rbx
+  802c39:	41 5c                	pop    %r12
+  802c3b:	41 5d                	pop    %r13
+  802c3d:	41 5e                	pop    %r14
+  802c3f:	41 5f                	pop    %r15
+  802c41:	5d                   	pop    %rbp
+  802c42:	c3                   	ret
+
+0000000000802c43 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  802c43:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c48:	c3                   	ret
+
+0000000000802c49 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  802c49:	55                   	push   %rbp
+  802c4a:	48 89 e5             	mov    %rsp,%rbp
+  802c4d:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  802c50:	48 be dc 37 80 00 00 	movabs $0x8037dc,%rsi
+  802c57:	00 00 00 
+  802c5a:	48 b8 4e 0c 80 00 00 	movabs $0x800c4e,%rax
+  802c61:	00 00 00 
+  802c64:	ff d0                	call   *%rax
+    return 0;
+}
+  802c66:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c6b:	5d                   	pop    %rbp
+  802c6c:	c3                   	ret
+
+0000000000802c6d <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  802c6d:	55                   	push   %rbp
+  802c6e:	48 89 e5             	mov    %rsp,%rbp
+  802c71:	41 57                	push   %r15
+  802c73:	41 56                	push   %r14
+  802c75:	41 55                	push   %r13
+  802c77:	41 54                	push   %r12
+  802c79:	53                   	push   %rbx
+  802c7a:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  802c81:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  802c88:	48 85 d2             	test   %rdx,%rdx
+  802c8b:	74 7a                	je     802d07 <devcons_write+0x9a>
+  802c8d:	49 89 d6             	mov    %rdx,%r14
+  802c90:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802c96:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  802c9b:	49 bf 48 0e 80 00 00 	movabs $0x800e48,%r15
+  802ca2:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  802ca5:	4c 89 f3             	mov    %r14,%rbx
+  802ca8:	48 29 f3             	sub    %rsi,%rbx
+  802cab:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802cb0:	48 39 c3             	cmp    %rax,%rbx
+  802cb3:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  802cb7:	4c 63 eb             	movslq %ebx,%r13
+  802cba:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  802cc1:	48 01 c6             	add    %rax,%rsi
+  802cc4:	4c 89 ea             	mov    %r13,%rdx
+  802cc7:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802cce:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  802cd1:	4c 89 ee             	mov    %r13,%rsi
+  802cd4:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802cdb:	48 b8 75 10 80 00 00 	movabs $0x801075,%rax
+  802ce2:	00 00 00 
+  802ce5:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  802ce7:	41 01 dc             	add    %ebx,%r12d
+  802cea:	49 63 f4             	movslq %r12d,%rsi
+  802ced:	4c 39 f6             	cmp    %r14,%rsi
+  802cf0:	72 b3                	jb     802ca5 <devcons_write+0x38>
+    return res;
+  802cf2:	49 63 c4             	movslq %r12d,%rax
+}
+  802cf5:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  802cfc:	5b                   	pop    %rbx
+  802cfd:	41 5c                	pop    %r12
+  802cff:	41 5d                	pop    %r13
+  802d01:	41 5e                	pop    %r14
+  802d03:	41 5f                	pop    %r15
+  802d05:	5d                   	pop    %rbp
+  802d06:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  802d07:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802d0d:	eb e3                	jmp    802cf2 <devcons_write+0x85>
+
+0000000000802d0f <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  802d0f:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  802d12:	ba 00 00 00 00       	mov    $0x0,%edx
+  802d17:	48 85 c0             	test   %rax,%rax
+  802d1a:	74 55                	je     802d71 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  802d1c:	55                   	push   %rbp
+  802d1d:	48 89 e5             	mov    %rsp,%rbp
+  802d20:	41 55                	push   %r13
+  802d22:	41 54                	push   %r12
+  802d24:	53                   	push   %rbx
+  802d25:	48 83 ec 08          	sub    $0x8,%rsp
+  802d29:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  802d2c:	48 bb a2 10 80 00 00 	movabs $0x8010a2,%rbx
+  802d33:	00 00 00 
+  802d36:	49 bc 6f 11 80 00 00 	movabs $0x80116f,%r12
+  802d3d:	00 00 00 
+  802d40:	eb 03                	jmp    802d45 <devcons_read+0x36>
+  802d42:	41 ff d4             	call   *%r12
+  802d45:	ff d3                	call   *%rbx
+  802d47:	85 c0                	test   %eax,%eax
+  802d49:	74 f7                	je     802d42 <devcons_read+0x33>
+    if (c < 0) return c;
+  802d4b:	48 63 d0             	movslq %eax,%rdx
+  802d4e:	78 13                	js     802d63 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  802d50:	ba 00 00 00 00       	mov    $0x0,%edx
+  802d55:	83 f8 04             	cmp    $0x4,%eax
+  802d58:	74 09                	je     802d63 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  802d5a:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  802d5e:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  802d63:	48 89 d0             	mov    %rdx,%rax
+  802d66:	48 83 c4 08          	add    $0x8,%rsp
+  802d6a:	5b                   	pop    %rbx
+  802d6b:	41 5c                	pop    %r12
+  802d6d:	41 5d                	pop    %r13
+  802d6f:	5d                   	pop    %rbp
+  802d70:	c3                   	ret
+  802d71:	48 89 d0             	mov    %rdx,%rax
+  802d74:	c3                   	ret
+
+0000000000802d75 <cputchar>:
+cputchar(int ch) {
+  802d75:	55                   	push   %rbp
+  802d76:	48 89 e5             	mov    %rsp,%rbp
+  802d79:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  802d7d:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  802d81:	be 01 00 00 00       	mov    $0x1,%esi
+  802d86:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  802d8a:	48 b8 75 10 80 00 00 	movabs $0x801075,%rax
+  802d91:	00 00 00 
+  802d94:	ff d0                	call   *%rax
+}
+  802d96:	c9                   	leave
+  802d97:	c3                   	ret
+
+0000000000802d98 <getchar>:
+getchar(void) {
+  802d98:	55                   	push   %rbp
+  802d99:	48 89 e5             	mov    %rsp,%rbp
+  802d9c:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  802da0:	ba 01 00 00 00       	mov    $0x1,%edx
+  802da5:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  802da9:	bf 00 00 00 00       	mov    $0x0,%edi
+  802dae:	48 b8 bc 1c 80 00 00 	movabs $0x801cbc,%rax
+  802db5:	00 00 00 
+  802db8:	ff d0                	call   *%rax
+  802dba:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  802dbc:	85 c0                	test   %eax,%eax
+  802dbe:	78 06                	js     802dc6 <getchar+0x2e>
+  802dc0:	74 08                	je     802dca <getchar+0x32>
+  802dc2:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  802dc6:	89 d0                	mov    %edx,%eax
+  802dc8:	c9                   	leave
+  802dc9:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  802dca:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  802dcf:	eb f5                	jmp    802dc6 <getchar+0x2e>
+
+0000000000802dd1 <iscons>:
+iscons(int fdnum) {
+  802dd1:	55                   	push   %rbp
+  802dd2:	48 89 e5             	mov    %rsp,%rbp
+  802dd5:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  802dd9:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802ddd:	48 b8 d9 19 80 00 00 	movabs $0x8019d9,%rax
+  802de4:	00 00 00 
+  802de7:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802de9:	85 c0                	test   %eax,%eax
+  802deb:	78 18                	js     802e05 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  802ded:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802df1:	48 b8 a0 40 80 00 00 	movabs $0x8040a0,%rax
+  802df8:	00 00 00 
+  802dfb:	8b 00                	mov    (%rax),%eax
+  802dfd:	39 02                	cmp    %eax,(%rdx)
+  802dff:	0f 94 c0             	sete   %al
+  802e02:	0f b6 c0             	movzbl %al,%eax
+}
+  802e05:	c9                   	leave
+  802e06:	c3                   	ret
+
+0000000000802e07 <opencons>:
+opencons(void) {
+  802e07:	55                   	push   %rbp
+  802e08:	48 89 e5             	mov    %rsp,%rbp
+  802e0b:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802e0f:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  802e13:	48 b8 bf 19 80 00 00 	movabs $0x8019bf,%rax
+  802e1a:	00 00 00 
+  802e1d:	ff d0                	call   *%rax
+  802e1f:	85 c0                	test   %eax,%eax
+  802e21:	78 49                	js     802e6c <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  802e23:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802e28:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802e2d:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  802e31:	bf 00 00 00 00       	mov    $0x0,%edi
+  802e36:	48 b8 fe 11 80 00 00 	movabs $0x8011fe,%rax
+  802e3d:	00 00 00 
+  802e40:	ff d0                	call   *%rax
+  802e42:	85 c0                	test   %eax,%eax
+  802e44:	78 26                	js     802e6c <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  802e46:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802e4a:	a1 a0 40 80 00 00 00 	movabs 0x8040a0,%eax
+  802e51:	00 00 
+  802e53:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  802e55:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802e59:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  802e60:	48 b8 18 19 80 00 00 	movabs $0x801918,%rax
+  802e67:	00 00 00 
+  802e6a:	ff d0                	call   *%rax
+}
+  802e6c:	c9                   	leave
+  802e6d:	c3                   	ret
+
+0000000000802e6e <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  802e6e:	55                   	push   %rbp
+  802e6f:	48 89 e5             	mov    %rsp,%rbp
+  802e72:	41 55                	push   %r13
+  802e74:	41 54                	push   %r12
+  802e76:	53                   	push   %rbx
+  802e77:	48 83 ec 08          	sub    $0x8,%rsp
+  802e7b:	49 89 fc             	mov    %rdi,%r12
+  802e7e:	48 89 f7             	mov    %rsi,%rdi
+  802e81:	48 89 d3             	mov    %rdx,%rbx
+  802e84:	49 89 cd             	mov    %rcx,%r13
+    // LAB 9: Your code here:
+    int res = sys_ipc_recv(!pg ? (void*)MAX_USER_ADDRESS : pg, !size ? 0 : *size);
+  802e87:	be 00 00 00 00       	mov    $0x0,%esi
+  802e8c:	48 85 d2             	test   %rdx,%rdx
+  802e8f:	74 03                	je     802e94 <ipc_recv+0x26>
+  802e91:	48 8b 32             	mov    (%rdx),%rsi
+  802e94:	48 85 ff             	test   %rdi,%rdi
+  802e97:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802e9e:	00 00 00 
+  802ea1:	48 0f 44 f8          	cmove  %rax,%rdi
+  802ea5:	48 b8 d0 15 80 00 00 	movabs $0x8015d0,%rax
+  802eac:	00 00 00 
+  802eaf:	ff d0                	call   *%rax
+    if (res < 0) {
+  802eb1:	85 c0                	test   %eax,%eax
+  802eb3:	78 66                	js     802f1b <ipc_recv+0xad>
+        if (size) {
+            *size = 0;
+        }
+        return res;
+    }
+    if (from_env_store) {
+  802eb5:	4d 85 e4             	test   %r12,%r12
+  802eb8:	74 14                	je     802ece <ipc_recv+0x60>
+        *from_env_store = thisenv->env_ipc_from;
+  802eba:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802ec1:	00 00 00 
+  802ec4:	8b 80 ac 01 00 00    	mov    0x1ac(%rax),%eax
+  802eca:	41 89 04 24          	mov    %eax,(%r12)
+    }
+    if (perm_store) {
+  802ece:	4d 85 ed             	test   %r13,%r13
+  802ed1:	74 14                	je     802ee7 <ipc_recv+0x79>
+        *perm_store = thisenv->env_ipc_perm;
+  802ed3:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802eda:	00 00 00 
+  802edd:	8b 80 b0 01 00 00    	mov    0x1b0(%rax),%eax
+  802ee3:	41 89 45 00          	mov    %eax,0x0(%r13)
+    }
+    if (size) {
+  802ee7:	48 85 db             	test   %rbx,%rbx
+  802eea:	74 14                	je     802f00 <ipc_recv+0x92>
+        *size = thisenv->env_ipc_maxsz;
+  802eec:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802ef3:	00 00 00 
+  802ef6:	48 8b 80 a0 01 00 00 	mov    0x1a0(%rax),%rax
+  802efd:	48 89 03             	mov    %rax,(%rbx)
+    }
+    return thisenv->env_ipc_value;
+  802f00:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802f07:	00 00 00 
+  802f0a:	8b 80 a8 01 00 00    	mov    0x1a8(%rax),%eax
+}
+  802f10:	48 83 c4 08          	add    $0x8,%rsp
+  802f14:	5b                   	pop    %rbx
+  802f15:	41 5c                	pop    %r12
+  802f17:	41 5d                	pop    %r13
+  802f19:	5d                   	pop    %rbp
+  802f1a:	c3                   	ret
+        if (from_env_store) {
+  802f1b:	4d 85 e4             	test   %r12,%r12
+  802f1e:	74 08                	je     802f28 <ipc_recv+0xba>
+            *from_env_store = 0;
+  802f20:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  802f27:	00 
+        if (perm_store) {
+  802f28:	4d 85 ed             	test   %r13,%r13
+  802f2b:	74 08                	je     802f35 <ipc_recv+0xc7>
+            *perm_store = 0;
+  802f2d:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  802f34:	00 
+        if (size) {
+  802f35:	48 85 db             	test   %rbx,%rbx
+  802f38:	74 d6                	je     802f10 <ipc_recv+0xa2>
+            *size = 0;
+  802f3a:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  802f41:	eb cd                	jmp    802f10 <ipc_recv+0xa2>
+
+0000000000802f43 <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  802f43:	55                   	push   %rbp
+  802f44:	48 89 e5             	mov    %rsp,%rbp
+  802f47:	41 57                	push   %r15
+  802f49:	41 56                	push   %r14
+  802f4b:	41 55                	push   %r13
+  802f4d:	41 54                	push   %r12
+  802f4f:	53                   	push   %rbx
+  802f50:	48 83 ec 18          	sub    $0x18,%rsp
+  802f54:	41 89 fd             	mov    %edi,%r13d
+  802f57:	89 75 cc             	mov    %esi,-0x34(%rbp)
+  802f5a:	49 89 cc             	mov    %rcx,%r12
+  802f5d:	44 89 45 c8          	mov    %r8d,-0x38(%rbp)
+    // LAB 9: Your code here:
+    int res = 0;
+    while ((res = sys_ipc_try_send(to_env, val, !pg ? (void*)MAX_USER_ADDRESS : pg, size, perm)) < 0) {
+  802f61:	48 85 d2             	test   %rdx,%rdx
+  802f64:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802f6b:	00 00 00 
+  802f6e:	48 0f 45 c2          	cmovne %rdx,%rax
+  802f72:	48 89 c3             	mov    %rax,%rbx
+  802f75:	49 be a4 15 80 00 00 	movabs $0x8015a4,%r14
+  802f7c:	00 00 00 
+        if (res != -E_IPC_NOT_RECV) {
+            panic("sys_ipc_try_send failed: %i", res);
+        }
+        sys_yield();
+  802f7f:	49 bf 6f 11 80 00 00 	movabs $0x80116f,%r15
+  802f86:	00 00 00 
+    while ((res = sys_ipc_try_send(to_env, val, !pg ? (void*)MAX_USER_ADDRESS : pg, size, perm)) < 0) {
+  802f89:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  802f8c:	44 8b 45 c8          	mov    -0x38(%rbp),%r8d
+  802f90:	4c 89 e1             	mov    %r12,%rcx
+  802f93:	48 89 da             	mov    %rbx,%rdx
+  802f96:	44 89 ef             	mov    %r13d,%edi
+  802f99:	41 ff d6             	call   *%r14
+  802f9c:	85 c0                	test   %eax,%eax
+  802f9e:	79 37                	jns    802fd7 <ipc_send+0x94>
+        if (res != -E_IPC_NOT_RECV) {
+  802fa0:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  802fa3:	75 05                	jne    802faa <ipc_send+0x67>
+        sys_yield();
+  802fa5:	41 ff d7             	call   *%r15
+  802fa8:	eb df                	jmp    802f89 <ipc_send+0x46>
+            panic("sys_ipc_try_send failed: %i", res);
+  802faa:	89 c1                	mov    %eax,%ecx
+  802fac:	48 ba e8 37 80 00 00 	movabs $0x8037e8,%rdx
+  802fb3:	00 00 00 
+  802fb6:	be 40 00 00 00       	mov    $0x40,%esi
+  802fbb:	48 bf 04 38 80 00 00 	movabs $0x803804,%rdi
+  802fc2:	00 00 00 
+  802fc5:	b8 00 00 00 00       	mov    $0x0,%eax
+  802fca:	49 b8 d9 01 80 00 00 	movabs $0x8001d9,%r8
+  802fd1:	00 00 00 
+  802fd4:	41 ff d0             	call   *%r8
+    }
+    return;
+}
+  802fd7:	48 83 c4 18          	add    $0x18,%rsp
+  802fdb:	5b                   	pop    %rbx
+  802fdc:	41 5c                	pop    %r12
+  802fde:	41 5d                	pop    %r13
+  802fe0:	41 5e                	pop    %r14
+  802fe2:	41 5f                	pop    %r15
+  802fe4:	5d                   	pop    %rbp
+  802fe5:	c3                   	ret
+
+0000000000802fe6 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  802fe6:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  802feb:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  802ff2:	00 00 00 
+  802ff5:	48 69 d0 d0 01 00 00 	imul   $0x1d0,%rax,%rdx
+  802ffc:	48 01 ca             	add    %rcx,%rdx
+  802fff:	8b 92 e8 00 00 00    	mov    0xe8(%rdx),%edx
+  803005:	39 fa                	cmp    %edi,%edx
+  803007:	74 12                	je     80301b <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  803009:	48 83 c0 01          	add    $0x1,%rax
+  80300d:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  803013:	75 e0                	jne    802ff5 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  803015:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80301a:	c3                   	ret
+            return envs[i].env_id;
+  80301b:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+  803022:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  803029:	00 00 00 
+  80302c:	48 01 d0             	add    %rdx,%rax
+  80302f:	8b 80 e0 00 00 00    	mov    0xe0(%rax),%eax
+  803035:	c3                   	ret
+  803036:	66 90                	xchg   %ax,%ax
+
+0000000000803038 <__rodata_start>:
+  803038:	66 61                	data16 (bad)
+  80303a:	75 6c                	jne    8030a8 <__rodata_start+0x70>
+  80303c:	74 20                	je     80305e <__rodata_start+0x26>
+  80303e:	25 6c 78 0a 00       	and    $0xa786c,%eax
+  803043:	75 73                	jne    8030b8 <__rodata_start+0x80>
+  803045:	65 72 2f             	gs jb  803077 <__rodata_start+0x3f>
+  803048:	66 61                	data16 (bad)
+  80304a:	75 6c                	jne    8030b8 <__rodata_start+0x80>
+  80304c:	74 61                	je     8030af <__rodata_start+0x77>
+  80304e:	6c                   	insb   (%dx),%es:(%rdi)
+  80304f:	6c                   	insb   (%dx),%es:(%rdi)
+  803050:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803051:	63 62 61             	movsxd 0x61(%rdx),%esp
+  803054:	64 2e 63 00          	fs movsxd %fs:(%rax),%eax
+  803058:	61                   	(bad)
+  803059:	6c                   	insb   (%dx),%es:(%rdi)
+  80305a:	6c                   	insb   (%dx),%es:(%rdi)
+  80305b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80305c:	63 61 74             	movsxd 0x74(%rcx),%esp
+  80305f:	69 6e 67 20 61 74 20 	imul   $0x20746120,0x67(%rsi),%ebp
+  803066:	25 6c 78 20 69       	and    $0x6920786c,%eax
+  80306b:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80306c:	20 70 61             	and    %dh,0x61(%rax)
+  80306f:	67 65 20 66 61       	and    %ah,%gs:0x61(%esi)
+  803074:	75 6c                	jne    8030e2 <__rodata_start+0xaa>
+  803076:	74 20                	je     803098 <__rodata_start+0x60>
+  803078:	68 61 6e 64 6c       	push   $0x6c646e61
+  80307d:	65 72 3a             	gs jb  8030ba <__rodata_start+0x82>
+  803080:	20 25 69 00 00 00    	and    %ah,0x69(%rip)        # 8030ef <__rodata_start+0xb7>
+  803086:	00 00                	add    %al,(%rax)
+  803088:	74 68                	je     8030f2 <__rodata_start+0xba>
+  80308a:	69 73 20 73 74 72 69 	imul   $0x69727473,0x20(%rbx),%esi
+  803091:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803092:	67 20 77 61          	and    %dh,0x61(%edi)
+  803096:	73 20                	jae    8030b8 <__rodata_start+0x80>
+  803098:	66 61                	data16 (bad)
+  80309a:	75 6c                	jne    803108 <__rodata_start+0xd0>
+  80309c:	74 65                	je     803103 <__rodata_start+0xcb>
+  80309e:	64 20 69 6e          	and    %ch,%fs:0x6e(%rcx)
+  8030a2:	20 61 74             	and    %ah,0x74(%rcx)
+  8030a5:	20 25 6c 78 00 3c    	and    %ah,0x3c00786c(%rip)        # 3c80a917 <__bss_end+0x3c002917>
+  8030ab:	75 6e                	jne    80311b <__rodata_start+0xe3>
+  8030ad:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  8030b1:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8030b2:	3e 00 0f             	ds add %cl,(%rdi)
+  8030b5:	1f                   	(bad)
+  8030b6:	40 00 5b 25          	rex add %bl,0x25(%rbx)
+  8030ba:	30 38                	xor    %bh,(%rax)
+  8030bc:	78 5d                	js     80311b <__rodata_start+0xe3>
+  8030be:	20 75 73             	and    %dh,0x73(%rbp)
+  8030c1:	65 72 20             	gs jb  8030e4 <__rodata_start+0xac>
+  8030c4:	70 61                	jo     803127 <__rodata_start+0xef>
+  8030c6:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8030c7:	69 63 20 69 6e 20 25 	imul   $0x25206e69,0x20(%rbx),%esp
+  8030ce:	73 20                	jae    8030f0 <__rodata_start+0xb8>
+  8030d0:	61                   	(bad)
+  8030d1:	74 20                	je     8030f3 <__rodata_start+0xbb>
+  8030d3:	25 73 3a 25 64       	and    $0x64253a73,%eax
+  8030d8:	3a 20                	cmp    (%rax),%ah
+  8030da:	00 30                	add    %dh,(%rax)
+  8030dc:	31 32                	xor    %esi,(%rdx)
+  8030de:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  8030e5:	41                   	rex.B
+  8030e6:	42                   	rex.X
+  8030e7:	43                   	rex.XB
+  8030e8:	44                   	rex.R
+  8030e9:	45                   	rex.RB
+  8030ea:	46 00 30             	rex.RX add %r14b,(%rax)
+  8030ed:	31 32                	xor    %esi,(%rdx)
+  8030ef:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  8030f6:	61                   	(bad)
+  8030f7:	62 63 64 65 66       	(bad)
+  8030fc:	00 28                	add    %ch,(%rax)
+  8030fe:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8030ff:	75 6c                	jne    80316d <__rodata_start+0x135>
+  803101:	6c                   	insb   (%dx),%es:(%rdi)
+  803102:	29 00                	sub    %eax,(%rax)
+  803104:	65 72 72             	gs jb  803179 <__rodata_start+0x141>
+  803107:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803108:	72 20                	jb     80312a <__rodata_start+0xf2>
+  80310a:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  80310f:	73 70                	jae    803181 <__rodata_start+0x149>
+  803111:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  803115:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  80311c:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80311d:	72 00                	jb     80311f <__rodata_start+0xe7>
+  80311f:	62 61 64 20 65       	(bad)
+  803124:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803125:	76 69                	jbe    803190 <__rodata_start+0x158>
+  803127:	72 6f                	jb     803198 <__rodata_start+0x160>
+  803129:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80312a:	6d                   	insl   (%dx),%es:(%rdi)
+  80312b:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  80312d:	74 00                	je     80312f <__rodata_start+0xf7>
+  80312f:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  803136:	20 70 61             	and    %dh,0x61(%rax)
+  803139:	72 61                	jb     80319c <__rodata_start+0x164>
+  80313b:	6d                   	insl   (%dx),%es:(%rdi)
+  80313c:	65 74 65             	gs je  8031a4 <__rodata_start+0x16c>
+  80313f:	72 00                	jb     803141 <__rodata_start+0x109>
+  803141:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803142:	75 74                	jne    8031b8 <__rodata_start+0x180>
+  803144:	20 6f 66             	and    %ch,0x66(%rdi)
+  803147:	20 6d 65             	and    %ch,0x65(%rbp)
+  80314a:	6d                   	insl   (%dx),%es:(%rdi)
+  80314b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80314c:	72 79                	jb     8031c7 <__rodata_start+0x18f>
+  80314e:	00 6f 75             	add    %ch,0x75(%rdi)
+  803151:	74 20                	je     803173 <__rodata_start+0x13b>
+  803153:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803154:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  803158:	76 69                	jbe    8031c3 <__rodata_start+0x18b>
+  80315a:	72 6f                	jb     8031cb <__rodata_start+0x193>
+  80315c:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80315d:	6d                   	insl   (%dx),%es:(%rdi)
+  80315e:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803160:	74 73                	je     8031d5 <__rodata_start+0x19d>
+  803162:	00 63 6f             	add    %ah,0x6f(%rbx)
+  803165:	72 72                	jb     8031d9 <__rodata_start+0x1a1>
+  803167:	75 70                	jne    8031d9 <__rodata_start+0x1a1>
+  803169:	74 65                	je     8031d0 <__rodata_start+0x198>
+  80316b:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  803170:	75 67                	jne    8031d9 <__rodata_start+0x1a1>
+  803172:	20 69 6e             	and    %ch,0x6e(%rcx)
+  803175:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  803177:	00 73 65             	add    %dh,0x65(%rbx)
+  80317a:	67 6d                	insl   (%dx),%es:(%edi)
+  80317c:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  80317e:	74 61                	je     8031e1 <__rodata_start+0x1a9>
+  803180:	74 69                	je     8031eb <__rodata_start+0x1b3>
+  803182:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803183:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803184:	20 66 61             	and    %ah,0x61(%rsi)
+  803187:	75 6c                	jne    8031f5 <__rodata_start+0x1bd>
+  803189:	74 00                	je     80318b <__rodata_start+0x153>
+  80318b:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  803192:	20 45 4c             	and    %al,0x4c(%rbp)
+  803195:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  803199:	61                   	(bad)
+  80319a:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  80319f:	20 73 75             	and    %dh,0x75(%rbx)
+  8031a2:	63 68 20             	movsxd 0x20(%rax),%ebp
+  8031a5:	73 79                	jae    803220 <__rodata_start+0x1e8>
+  8031a7:	73 74                	jae    80321d <__rodata_start+0x1e5>
+  8031a9:	65 6d                	gs insl (%dx),%es:(%rdi)
+  8031ab:	20 63 61             	and    %ah,0x61(%rbx)
+  8031ae:	6c                   	insb   (%dx),%es:(%rdi)
+  8031af:	6c                   	insb   (%dx),%es:(%rdi)
+  8031b0:	00 65 6e             	add    %ah,0x6e(%rbp)
+  8031b3:	74 72                	je     803227 <__rodata_start+0x1ef>
+  8031b5:	79 20                	jns    8031d7 <__rodata_start+0x19f>
+  8031b7:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8031b8:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8031b9:	74 20                	je     8031db <__rodata_start+0x1a3>
+  8031bb:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  8031bd:	75 6e                	jne    80322d <__rodata_start+0x1f5>
+  8031bf:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  8031c3:	76 20                	jbe    8031e5 <__rodata_start+0x1ad>
+  8031c5:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  8031cc:	72 65                	jb     803233 <__rodata_start+0x1fb>
+  8031ce:	63 76 69             	movsxd 0x69(%rsi),%esi
+  8031d1:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8031d2:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  8031d6:	65 78 70             	gs js  803249 <__rodata_start+0x211>
+  8031d9:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  8031de:	20 65 6e             	and    %ah,0x6e(%rbp)
+  8031e1:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  8031e5:	20 66 69             	and    %ah,0x69(%rsi)
+  8031e8:	6c                   	insb   (%dx),%es:(%rdi)
+  8031e9:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  8031ed:	20 66 72             	and    %ah,0x72(%rsi)
+  8031f0:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  8031f5:	61                   	(bad)
+  8031f6:	63 65 20             	movsxd 0x20(%rbp),%esp
+  8031f9:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8031fa:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8031fb:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  8031ff:	6b 00 74             	imul   $0x74,(%rax),%eax
+  803202:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803203:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803204:	20 6d 61             	and    %ch,0x61(%rbp)
+  803207:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803208:	79 20                	jns    80322a <__rodata_start+0x1f2>
+  80320a:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  803211:	72 65                	jb     803278 <__rodata_start+0x240>
+  803213:	20 6f 70             	and    %ch,0x70(%rdi)
+  803216:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803218:	00 66 69             	add    %ah,0x69(%rsi)
+  80321b:	6c                   	insb   (%dx),%es:(%rdi)
+  80321c:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  803220:	20 62 6c             	and    %ah,0x6c(%rdx)
+  803223:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803224:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  803227:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803228:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803229:	74 20                	je     80324b <__rodata_start+0x213>
+  80322b:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  80322d:	75 6e                	jne    80329d <__rodata_start+0x265>
+  80322f:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  803233:	76 61                	jbe    803296 <__rodata_start+0x25e>
+  803235:	6c                   	insb   (%dx),%es:(%rdi)
+  803236:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  80323d:	00 
+  80323e:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  803245:	72 65                	jb     8032ac <__rodata_start+0x274>
+  803247:	61                   	(bad)
+  803248:	64 79 20             	fs jns 80326b <__rodata_start+0x233>
+  80324b:	65 78 69             	gs js  8032b7 <__rodata_start+0x27f>
+  80324e:	73 74                	jae    8032c4 <__rodata_start+0x28c>
+  803250:	73 00                	jae    803252 <__rodata_start+0x21a>
+  803252:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803253:	70 65                	jo     8032ba <__rodata_start+0x282>
+  803255:	72 61                	jb     8032b8 <__rodata_start+0x280>
+  803257:	74 69                	je     8032c2 <__rodata_start+0x28a>
+  803259:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80325a:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80325b:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  80325e:	74 20                	je     803280 <__rodata_start+0x248>
+  803260:	73 75                	jae    8032d7 <__rodata_start+0x29f>
+  803262:	70 70                	jo     8032d4 <__rodata_start+0x29c>
+  803264:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803265:	72 74                	jb     8032db <__rodata_start+0x2a3>
+  803267:	65 64 00 6f 70       	gs add %ch,%fs:0x70(%rdi)
+  80326c:	65 72 61             	gs jb  8032d0 <__rodata_start+0x298>
+  80326f:	74 69                	je     8032da <__rodata_start+0x2a2>
+  803271:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803272:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803273:	20 69 6e             	and    %ch,0x6e(%rcx)
+  803276:	74 65                	je     8032dd <__rodata_start+0x2a5>
+  803278:	72 72                	jb     8032ec <__rodata_start+0x2b4>
+  80327a:	75 70                	jne    8032ec <__rodata_start+0x2b4>
+  80327c:	74 65                	je     8032e3 <__rodata_start+0x2ab>
+  80327e:	64 00 6e 6f          	add    %ch,%fs:0x6f(%rsi)
+  803282:	74 20                	je     8032a4 <__rodata_start+0x26c>
+  803284:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803286:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803287:	75 67                	jne    8032f0 <__rodata_start+0x2b8>
+  803289:	68 20 43 50 55       	push   $0x55504320
+  80328e:	20 74 69 6d          	and    %dh,0x6d(%rcx,%rbp,2)
+  803292:	65 00 66 2e          	add    %ah,%gs:0x2e(%rsi)
+  803296:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+  80329d:	00 
+  80329e:	66 90                	xchg   %ax,%ax
+  8032a0:	16                   	(bad)
+  8032a1:	05 80 00 00 00       	add    $0x80,%eax
+  8032a6:	00 00                	add    %al,(%rax)
+  8032a8:	57                   	push   %rdi
+  8032a9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  8032af:	00 47 0b             	add    %al,0xb(%rdi)
+  8032b2:	80 00 00             	addb   $0x0,(%rax)
+  8032b5:	00 00                	add    %al,(%rax)
+  8032b7:	00 57 0b             	add    %dl,0xb(%rdi)
+  8032ba:	80 00 00             	addb   $0x0,(%rax)
+  8032bd:	00 00                	add    %al,(%rax)
+  8032bf:	00 57 0b             	add    %dl,0xb(%rdi)
+  8032c2:	80 00 00             	addb   $0x0,(%rax)
+  8032c5:	00 00                	add    %al,(%rax)
+  8032c7:	00 57 0b             	add    %dl,0xb(%rdi)
+  8032ca:	80 00 00             	addb   $0x0,(%rax)
+  8032cd:	00 00                	add    %al,(%rax)
+  8032cf:	00 57 0b             	add    %dl,0xb(%rdi)
+  8032d2:	80 00 00             	addb   $0x0,(%rax)
+  8032d5:	00 00                	add    %al,(%rax)
+  8032d7:	00 35 05 80 00 00    	add    %dh,0x8005(%rip)        # 80b2e2 <__bss_end+0x32e2>
+  8032dd:	00 00                	add    %al,(%rax)
+  8032df:	00 57 0b             	add    %dl,0xb(%rdi)
+  8032e2:	80 00 00             	addb   $0x0,(%rax)
+  8032e5:	00 00                	add    %al,(%rax)
+  8032e7:	00 57 0b             	add    %dl,0xb(%rdi)
+  8032ea:	80 00 00             	addb   $0x0,(%rax)
+  8032ed:	00 00                	add    %al,(%rax)
+  8032ef:	00 29                	add    %ch,(%rcx)
+  8032f1:	05 80 00 00 00       	add    $0x80,%eax
+  8032f6:	00 00                	add    %al,(%rax)
+  8032f8:	a3 05 80 00 00 00 00 	movabs %eax,0x5700000000008005
+  8032ff:	00 57 
+  803301:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803307:	00 29                	add    %ch,(%rcx)
+  803309:	05 80 00 00 00       	add    $0x80,%eax
+  80330e:	00 00                	add    %al,(%rax)
+  803310:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803311:	05 80 00 00 00       	add    $0x80,%eax
+  803316:	00 00                	add    %al,(%rax)
+  803318:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803319:	05 80 00 00 00       	add    $0x80,%eax
+  80331e:	00 00                	add    %al,(%rax)
+  803320:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803321:	05 80 00 00 00       	add    $0x80,%eax
+  803326:	00 00                	add    %al,(%rax)
+  803328:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803329:	05 80 00 00 00       	add    $0x80,%eax
+  80332e:	00 00                	add    %al,(%rax)
+  803330:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803331:	05 80 00 00 00       	add    $0x80,%eax
+  803336:	00 00                	add    %al,(%rax)
+  803338:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803339:	05 80 00 00 00       	add    $0x80,%eax
+  80333e:	00 00                	add    %al,(%rax)
+  803340:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803341:	05 80 00 00 00       	add    $0x80,%eax
+  803346:	00 00                	add    %al,(%rax)
+  803348:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803349:	05 80 00 00 00       	add    $0x80,%eax
+  80334e:	00 00                	add    %al,(%rax)
+  803350:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803351:	05 80 00 00 00       	add    $0x80,%eax
+  803356:	00 00                	add    %al,(%rax)
+  803358:	57                   	push   %rdi
+  803359:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  80335f:	00 57 0b             	add    %dl,0xb(%rdi)
+  803362:	80 00 00             	addb   $0x0,(%rax)
+  803365:	00 00                	add    %al,(%rax)
+  803367:	00 57 0b             	add    %dl,0xb(%rdi)
+  80336a:	80 00 00             	addb   $0x0,(%rax)
+  80336d:	00 00                	add    %al,(%rax)
+  80336f:	00 57 0b             	add    %dl,0xb(%rdi)
+  803372:	80 00 00             	addb   $0x0,(%rax)
+  803375:	00 00                	add    %al,(%rax)
+  803377:	00 57 0b             	add    %dl,0xb(%rdi)
+  80337a:	80 00 00             	addb   $0x0,(%rax)
+  80337d:	00 00                	add    %al,(%rax)
+  80337f:	00 57 0b             	add    %dl,0xb(%rdi)
+  803382:	80 00 00             	addb   $0x0,(%rax)
+  803385:	00 00                	add    %al,(%rax)
+  803387:	00 57 0b             	add    %dl,0xb(%rdi)
+  80338a:	80 00 00             	addb   $0x0,(%rax)
+  80338d:	00 00                	add    %al,(%rax)
+  80338f:	00 57 0b             	add    %dl,0xb(%rdi)
+  803392:	80 00 00             	addb   $0x0,(%rax)
+  803395:	00 00                	add    %al,(%rax)
+  803397:	00 57 0b             	add    %dl,0xb(%rdi)
+  80339a:	80 00 00             	addb   $0x0,(%rax)
+  80339d:	00 00                	add    %al,(%rax)
+  80339f:	00 57 0b             	add    %dl,0xb(%rdi)
+  8033a2:	80 00 00             	addb   $0x0,(%rax)
+  8033a5:	00 00                	add    %al,(%rax)
+  8033a7:	00 57 0b             	add    %dl,0xb(%rdi)
+  8033aa:	80 00 00             	addb   $0x0,(%rax)
+  8033ad:	00 00                	add    %al,(%rax)
+  8033af:	00 57 0b             	add    %dl,0xb(%rdi)
+  8033b2:	80 00 00             	addb   $0x0,(%rax)
+  8033b5:	00 00                	add    %al,(%rax)
+  8033b7:	00 57 0b             	add    %dl,0xb(%rdi)
+  8033ba:	80 00 00             	addb   $0x0,(%rax)
+  8033bd:	00 00                	add    %al,(%rax)
+  8033bf:	00 57 0b             	add    %dl,0xb(%rdi)
+  8033c2:	80 00 00             	addb   $0x0,(%rax)
+  8033c5:	00 00                	add    %al,(%rax)
+  8033c7:	00 57 0b             	add    %dl,0xb(%rdi)
+  8033ca:	80 00 00             	addb   $0x0,(%rax)
+  8033cd:	00 00                	add    %al,(%rax)
+  8033cf:	00 57 0b             	add    %dl,0xb(%rdi)
+  8033d2:	80 00 00             	addb   $0x0,(%rax)
+  8033d5:	00 00                	add    %al,(%rax)
+  8033d7:	00 57 0b             	add    %dl,0xb(%rdi)
+  8033da:	80 00 00             	addb   $0x0,(%rax)
+  8033dd:	00 00                	add    %al,(%rax)
+  8033df:	00 57 0b             	add    %dl,0xb(%rdi)
+  8033e2:	80 00 00             	addb   $0x0,(%rax)
+  8033e5:	00 00                	add    %al,(%rax)
+  8033e7:	00 57 0b             	add    %dl,0xb(%rdi)
+  8033ea:	80 00 00             	addb   $0x0,(%rax)
+  8033ed:	00 00                	add    %al,(%rax)
+  8033ef:	00 57 0b             	add    %dl,0xb(%rdi)
+  8033f2:	80 00 00             	addb   $0x0,(%rax)
+  8033f5:	00 00                	add    %al,(%rax)
+  8033f7:	00 57 0b             	add    %dl,0xb(%rdi)
+  8033fa:	80 00 00             	addb   $0x0,(%rax)
+  8033fd:	00 00                	add    %al,(%rax)
+  8033ff:	00 57 0b             	add    %dl,0xb(%rdi)
+  803402:	80 00 00             	addb   $0x0,(%rax)
+  803405:	00 00                	add    %al,(%rax)
+  803407:	00 57 0b             	add    %dl,0xb(%rdi)
+  80340a:	80 00 00             	addb   $0x0,(%rax)
+  80340d:	00 00                	add    %al,(%rax)
+  80340f:	00 57 0b             	add    %dl,0xb(%rdi)
+  803412:	80 00 00             	addb   $0x0,(%rax)
+  803415:	00 00                	add    %al,(%rax)
+  803417:	00 57 0b             	add    %dl,0xb(%rdi)
+  80341a:	80 00 00             	addb   $0x0,(%rax)
+  80341d:	00 00                	add    %al,(%rax)
+  80341f:	00 57 0b             	add    %dl,0xb(%rdi)
+  803422:	80 00 00             	addb   $0x0,(%rax)
+  803425:	00 00                	add    %al,(%rax)
+  803427:	00 57 0b             	add    %dl,0xb(%rdi)
+  80342a:	80 00 00             	addb   $0x0,(%rax)
+  80342d:	00 00                	add    %al,(%rax)
+  80342f:	00 57 0b             	add    %dl,0xb(%rdi)
+  803432:	80 00 00             	addb   $0x0,(%rax)
+  803435:	00 00                	add    %al,(%rax)
+  803437:	00 57 0b             	add    %dl,0xb(%rdi)
+  80343a:	80 00 00             	addb   $0x0,(%rax)
+  80343d:	00 00                	add    %al,(%rax)
+  80343f:	00 57 0b             	add    %dl,0xb(%rdi)
+  803442:	80 00 00             	addb   $0x0,(%rax)
+  803445:	00 00                	add    %al,(%rax)
+  803447:	00 7a 0a             	add    %bh,0xa(%rdx)
+  80344a:	80 00 00             	addb   $0x0,(%rax)
+  80344d:	00 00                	add    %al,(%rax)
+  80344f:	00 57 0b             	add    %dl,0xb(%rdi)
+  803452:	80 00 00             	addb   $0x0,(%rax)
+  803455:	00 00                	add    %al,(%rax)
+  803457:	00 57 0b             	add    %dl,0xb(%rdi)
+  80345a:	80 00 00             	addb   $0x0,(%rax)
+  80345d:	00 00                	add    %al,(%rax)
+  80345f:	00 57 0b             	add    %dl,0xb(%rdi)
+  803462:	80 00 00             	addb   $0x0,(%rax)
+  803465:	00 00                	add    %al,(%rax)
+  803467:	00 57 0b             	add    %dl,0xb(%rdi)
+  80346a:	80 00 00             	addb   $0x0,(%rax)
+  80346d:	00 00                	add    %al,(%rax)
+  80346f:	00 57 0b             	add    %dl,0xb(%rdi)
+  803472:	80 00 00             	addb   $0x0,(%rax)
+  803475:	00 00                	add    %al,(%rax)
+  803477:	00 57 0b             	add    %dl,0xb(%rdi)
+  80347a:	80 00 00             	addb   $0x0,(%rax)
+  80347d:	00 00                	add    %al,(%rax)
+  80347f:	00 57 0b             	add    %dl,0xb(%rdi)
+  803482:	80 00 00             	addb   $0x0,(%rax)
+  803485:	00 00                	add    %al,(%rax)
+  803487:	00 57 0b             	add    %dl,0xb(%rdi)
+  80348a:	80 00 00             	addb   $0x0,(%rax)
+  80348d:	00 00                	add    %al,(%rax)
+  80348f:	00 57 0b             	add    %dl,0xb(%rdi)
+  803492:	80 00 00             	addb   $0x0,(%rax)
+  803495:	00 00                	add    %al,(%rax)
+  803497:	00 57 0b             	add    %dl,0xb(%rdi)
+  80349a:	80 00 00             	addb   $0x0,(%rax)
+  80349d:	00 00                	add    %al,(%rax)
+  80349f:	00 c6                	add    %al,%dh
+  8034a1:	05 80 00 00 00       	add    $0x80,%eax
+  8034a6:	00 00                	add    %al,(%rax)
+  8034a8:	95                   	xchg   %eax,%ebp
+  8034a9:	07                   	(bad)
+  8034aa:	80 00 00             	addb   $0x0,(%rax)
+  8034ad:	00 00                	add    %al,(%rax)
+  8034af:	00 57 0b             	add    %dl,0xb(%rdi)
+  8034b2:	80 00 00             	addb   $0x0,(%rax)
+  8034b5:	00 00                	add    %al,(%rax)
+  8034b7:	00 57 0b             	add    %dl,0xb(%rdi)
+  8034ba:	80 00 00             	addb   $0x0,(%rax)
+  8034bd:	00 00                	add    %al,(%rax)
+  8034bf:	00 57 0b             	add    %dl,0xb(%rdi)
+  8034c2:	80 00 00             	addb   $0x0,(%rax)
+  8034c5:	00 00                	add    %al,(%rax)
+  8034c7:	00 57 0b             	add    %dl,0xb(%rdi)
+  8034ca:	80 00 00             	addb   $0x0,(%rax)
+  8034cd:	00 00                	add    %al,(%rax)
+  8034cf:	00 f5                	add    %dh,%ch
+  8034d1:	05 80 00 00 00       	add    $0x80,%eax
+  8034d6:	00 00                	add    %al,(%rax)
+  8034d8:	57                   	push   %rdi
+  8034d9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  8034df:	00 57 0b             	add    %dl,0xb(%rdi)
+  8034e2:	80 00 00             	addb   $0x0,(%rax)
+  8034e5:	00 00                	add    %al,(%rax)
+  8034e7:	00 bb 05 80 00 00    	add    %bh,0x8005(%rbx)
+  8034ed:	00 00                	add    %al,(%rax)
+  8034ef:	00 57 0b             	add    %dl,0xb(%rdi)
+  8034f2:	80 00 00             	addb   $0x0,(%rax)
+  8034f5:	00 00                	add    %al,(%rax)
+  8034f7:	00 57 0b             	add    %dl,0xb(%rdi)
+  8034fa:	80 00 00             	addb   $0x0,(%rax)
+  8034fd:	00 00                	add    %al,(%rax)
+  8034ff:	00 3d 09 80 00 00    	add    %bh,0x8009(%rip)        # 80b50e <__bss_end+0x350e>
+  803505:	00 00                	add    %al,(%rax)
+  803507:	00 07                	add    %al,(%rdi)
+  803509:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80350f:	00 57 0b             	add    %dl,0xb(%rdi)
+  803512:	80 00 00             	addb   $0x0,(%rax)
+  803515:	00 00                	add    %al,(%rax)
+  803517:	00 57 0b             	add    %dl,0xb(%rdi)
+  80351a:	80 00 00             	addb   $0x0,(%rax)
+  80351d:	00 00                	add    %al,(%rax)
+  80351f:	00 8c 06 80 00 00 00 	add    %cl,0x80(%rsi,%rax,1)
+  803526:	00 00                	add    %al,(%rax)
+  803528:	57                   	push   %rdi
+  803529:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  80352f:	00 69 08             	add    %ch,0x8(%rcx)
+  803532:	80 00 00             	addb   $0x0,(%rax)
+  803535:	00 00                	add    %al,(%rax)
+  803537:	00 57 0b             	add    %dl,0xb(%rdi)
+  80353a:	80 00 00             	addb   $0x0,(%rax)
+  80353d:	00 00                	add    %al,(%rax)
+  80353f:	00 57 0b             	add    %dl,0xb(%rdi)
+  803542:	80 00 00             	addb   $0x0,(%rax)
+  803545:	00 00                	add    %al,(%rax)
+  803547:	00 7a 0a             	add    %bh,0xa(%rdx)
+  80354a:	80 00 00             	addb   $0x0,(%rax)
+  80354d:	00 00                	add    %al,(%rax)
+  80354f:	00 57 0b             	add    %dl,0xb(%rdi)
+  803552:	80 00 00             	addb   $0x0,(%rax)
+  803555:	00 00                	add    %al,(%rax)
+  803557:	00 1f                	add    %bl,(%rdi)
+  803559:	05 80 00 00 00       	add    $0x80,%eax
+	...
+
+0000000000803560 <error_string>:
+	...
+  803568:	0d 31 80 00 00 00 00 00 1f 31 80 00 00 00 00 00     .1.......1......
+  803578:	2f 31 80 00 00 00 00 00 41 31 80 00 00 00 00 00     /1......A1......
+  803588:	4f 31 80 00 00 00 00 00 63 31 80 00 00 00 00 00     O1......c1......
+  803598:	78 31 80 00 00 00 00 00 8b 31 80 00 00 00 00 00     x1.......1......
+  8035a8:	9d 31 80 00 00 00 00 00 b1 31 80 00 00 00 00 00     .1.......1......
+  8035b8:	c1 31 80 00 00 00 00 00 d4 31 80 00 00 00 00 00     .1.......1......
+  8035c8:	eb 31 80 00 00 00 00 00 01 32 80 00 00 00 00 00     .1.......2......
+  8035d8:	19 32 80 00 00 00 00 00 31 32 80 00 00 00 00 00     .2......12......
+  8035e8:	3e 32 80 00 00 00 00 00 10 36 80 00 00 00 00 00     >2.......6......
+  8035f8:	52 32 80 00 00 00 00 00 6a 32 80 00 00 00 00 00     R2......j2......
+  803608:	80 32 80 00 00 00 00 00 66 69 6c 65 20 69 73 20     .2......file is 
+  803618:	6e 6f 74 20 61 20 76 61 6c 69 64 20 65 78 65 63     not a valid exec
+  803628:	75 74 61 62 6c 65 00 90 73 79 73 63 61 6c 6c 20     utable..syscall 
+  803638:	25 7a 64 20 72 65 74 75 72 6e 65 64 20 25 7a 64     %zd returned %zd
+  803648:	20 28 3e 20 30 29 00 6c 69 62 2f 73 79 73 63 61      (> 0).lib/sysca
+  803658:	6c 6c 2e 63 00 0f 1f 00 55 73 65 72 73 70 61 63     ll.c....Userspac
+  803668:	65 20 70 61 67 65 20 66 61 75 6c 74 20 72 69 70     e page fault rip
+  803678:	3d 25 30 38 6c 58 20 76 61 3d 25 30 38 6c 58 20     =%08lX va=%08lX 
+  803688:	65 72 72 3d 25 78 0a 00 6c 69 62 2f 70 67 66 61     err=%x..lib/pgfa
+  803698:	75 6c 74 2e 63 00 73 65 74 5f 70 67 66 61 75 6c     ult.c.set_pgfaul
+  8036a8:	74 5f 68 61 6e 64 6c 65 72 3a 20 25 69 00 5f 70     t_handler: %i._p
+  8036b8:	66 68 61 6e 64 6c 65 72 5f 69 6e 69 74 69 74 69     fhandler_inititi
+  8036c8:	61 6c 6c 69 7a 65 64 00 61 73 73 65 72 74 69 6f     allized.assertio
+  8036d8:	6e 20 66 61 69 6c 65 64 3a 20 25 73 00 0f 1f 00     n failed: %s....
+  8036e8:	5b 25 30 38 78 5d 20 75 6e 6b 6e 6f 77 6e 20 64     [%08x] unknown d
+  8036f8:	65 76 69 63 65 20 74 79 70 65 20 25 64 0a 00 00     evice type %d...
+  803708:	5b 25 30 38 78 5d 20 66 74 72 75 6e 63 61 74 65     [%08x] ftruncate
+  803718:	20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65 0a      %d -- bad mode.
+  803728:	00 5b 25 30 38 78 5d 20 72 65 61 64 20 25 64 20     .[%08x] read %d 
+  803738:	2d 2d 20 62 61 64 20 6d 6f 64 65 0a 00 5b 25 30     -- bad mode..[%0
+  803748:	38 78 5d 20 77 72 69 74 65 20 25 64 20 2d 2d 20     8x] write %d -- 
+  803758:	62 61 64 20 6d 6f 64 65 0a 00 66 2e 0f 1f 84 00     bad mode..f.....
+  803768:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803778:	0f 1f 84 00 00 00 00 00                             ........
+
+0000000000803780 <devtab>:
+  803780:	20 40 80 00 00 00 00 00 60 40 80 00 00 00 00 00      @......`@......
+  803790:	a0 40 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .@..............
+  8037a0:	3c 70 69 70 65 3e 00 6c 69 62 2f 70 69 70 65 2e     <pipe>.lib/pipe.
+  8037b0:	63 00 70 69 70 65 00 90 73 79 73 5f 72 65 67 69     c.pipe..sys_regi
+  8037c0:	6f 6e 5f 72 65 66 73 28 76 61 2c 20 50 41 47 45     on_refs(va, PAGE
+  8037d0:	5f 53 49 5a 45 29 20 3d 3d 20 32 00 3c 63 6f 6e     _SIZE) == 2.<con
+  8037e0:	73 3e 00 63 6f 6e 73 00 73 79 73 5f 69 70 63 5f     s>.cons.sys_ipc_
+  8037f0:	74 72 79 5f 73 65 6e 64 20 66 61 69 6c 65 64 3a     try_send failed:
+  803800:	20 25 69 00 6c 69 62 2f 69 70 63 2e 63 00 66 2e      %i.lib/ipc.c.f.
+  803810:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803820:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803830:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803840:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803850:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803860:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803870:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803880:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803890:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8038a0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8038b0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8038c0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8038d0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8038e0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8038f0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803900:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803910:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803920:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803930:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803940:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803950:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803960:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803970:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803980:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803990:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8039a0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8039b0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8039c0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8039d0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8039e0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8039f0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803a00:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803a10:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803a20:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803a30:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803a40:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803a50:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803a60:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803a70:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803a80:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803a90:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803aa0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803ab0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803ac0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803ad0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803ae0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803af0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803b00:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803b10:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803b20:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803b30:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803b40:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803b50:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803b60:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803b70:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803b80:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803b90:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803ba0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803bb0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803bc0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803bd0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803be0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803bf0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803c00:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803c10:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803c20:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803c30:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803c40:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803c50:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803c60:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803c70:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803c80:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803c90:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803ca0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803cb0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803cc0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803cd0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803ce0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803cf0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803d00:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803d10:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803d20:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803d30:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803d40:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803d50:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803d60:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803d70:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803d80:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803d90:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803da0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803db0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803dc0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803dd0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803de0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803df0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803e00:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803e10:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803e20:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803e30:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803e40:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803e50:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803e60:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803e70:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803e80:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803e90:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803ea0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803eb0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803ec0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803ed0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803ee0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803ef0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803f00:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803f10:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803f20:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803f30:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803f40:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803f50:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803f60:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803f70:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803f80:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803f90:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803fa0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803fb0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803fc0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803fd0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803fe0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803ff0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 0f 1f 40 00     ..f...........@.
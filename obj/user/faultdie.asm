@@ -0,0 +1,6097 @@
+
+obj/user/faultdie:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 72 00 00 00       	call   800095 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <handler>:
+/* Test user-level fault handler -- just exit when we fault */
+
+#include <inc/lib.h>
+
+bool
+handler(struct UTrapframe *utf) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+    void *addr = (void *)utf->utf_fault_va;
+    uint64_t err = utf->utf_err;
+    cprintf("i faulted at va %lx, err %x\n",
+  800029:	8b 57 08             	mov    0x8(%rdi),%edx
+  80002c:	83 e2 07             	and    $0x7,%edx
+  80002f:	48 8b 37             	mov    (%rdi),%rsi
+  800032:	48 bf c0 2f 80 00 00 	movabs $0x802fc0,%rdi
+  800039:	00 00 00 
+  80003c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800041:	48 b9 0e 02 80 00 00 	movabs $0x80020e,%rcx
+  800048:	00 00 00 
+  80004b:	ff d1                	call   *%rcx
+            (unsigned long)addr, (unsigned)(err & 7));
+    sys_env_destroy(sys_getenvid());
+  80004d:	48 b8 23 10 80 00 00 	movabs $0x801023,%rax
+  800054:	00 00 00 
+  800057:	ff d0                	call   *%rax
+  800059:	89 c7                	mov    %eax,%edi
+  80005b:	48 b8 b8 0f 80 00 00 	movabs $0x800fb8,%rax
+  800062:	00 00 00 
+  800065:	ff d0                	call   *%rax
+    return 1;
+}
+  800067:	b8 01 00 00 00       	mov    $0x1,%eax
+  80006c:	5d                   	pop    %rbp
+  80006d:	c3                   	ret
+
+000000000080006e <umain>:
+
+void
+umain(int argc, char **argv) {
+  80006e:	55                   	push   %rbp
+  80006f:	48 89 e5             	mov    %rsp,%rbp
+    add_pgfault_handler(handler);
+  800072:	48 bf 25 00 80 00 00 	movabs $0x800025,%rdi
+  800079:	00 00 00 
+  80007c:	48 b8 a8 15 80 00 00 	movabs $0x8015a8,%rax
+  800083:	00 00 00 
+  800086:	ff d0                	call   *%rax
+    *(volatile int *)0xDEADBEEF = 0;
+  800088:	b8 ef be ad de       	mov    $0xdeadbeef,%eax
+  80008d:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+}
+  800093:	5d                   	pop    %rbp
+  800094:	c3                   	ret
+
+0000000000800095 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800095:	55                   	push   %rbp
+  800096:	48 89 e5             	mov    %rsp,%rbp
+  800099:	41 56                	push   %r14
+  80009b:	41 55                	push   %r13
+  80009d:	41 54                	push   %r12
+  80009f:	53                   	push   %rbx
+  8000a0:	41 89 fd             	mov    %edi,%r13d
+  8000a3:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  8000a6:	48 ba d8 40 80 00 00 	movabs $0x8040d8,%rdx
+  8000ad:	00 00 00 
+  8000b0:	48 b8 d8 40 80 00 00 	movabs $0x8040d8,%rax
+  8000b7:	00 00 00 
+  8000ba:	48 39 c2             	cmp    %rax,%rdx
+  8000bd:	73 17                	jae    8000d6 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  8000bf:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  8000c2:	49 89 c4             	mov    %rax,%r12
+  8000c5:	48 83 c3 08          	add    $0x8,%rbx
+  8000c9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000ce:	ff 53 f8             	call   *-0x8(%rbx)
+  8000d1:	4c 39 e3             	cmp    %r12,%rbx
+  8000d4:	72 ef                	jb     8000c5 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+    envid_t this_env_id = sys_getenvid();
+  8000d6:	48 b8 23 10 80 00 00 	movabs $0x801023,%rax
+  8000dd:	00 00 00 
+  8000e0:	ff d0                	call   *%rax
+    thisenv = &((struct Env*)UENVS)[ENVX(this_env_id)];
+  8000e2:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8000e7:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+  8000ee:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8000f5:	00 00 00 
+  8000f8:	48 01 d0             	add    %rdx,%rax
+  8000fb:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  800102:	00 00 00 
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  800105:	45 85 ed             	test   %r13d,%r13d
+  800108:	7e 0d                	jle    800117 <libmain+0x82>
+  80010a:	49 8b 06             	mov    (%r14),%rax
+  80010d:	48 a3 00 40 80 00 00 	movabs %rax,0x804000
+  800114:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  800117:	4c 89 f6             	mov    %r14,%rsi
+  80011a:	44 89 ef             	mov    %r13d,%edi
+  80011d:	48 b8 6e 00 80 00 00 	movabs $0x80006e,%rax
+  800124:	00 00 00 
+  800127:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  800129:	48 b8 3e 01 80 00 00 	movabs $0x80013e,%rax
+  800130:	00 00 00 
+  800133:	ff d0                	call   *%rax
+#endif
+}
+  800135:	5b                   	pop    %rbx
+  800136:	41 5c                	pop    %r12
+  800138:	41 5d                	pop    %r13
+  80013a:	41 5e                	pop    %r14
+  80013c:	5d                   	pop    %rbp
+  80013d:	c3                   	ret
+
+000000000080013e <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  80013e:	55                   	push   %rbp
+  80013f:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  800142:	48 b8 56 1a 80 00 00 	movabs $0x801a56,%rax
+  800149:	00 00 00 
+  80014c:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  80014e:	bf 00 00 00 00       	mov    $0x0,%edi
+  800153:	48 b8 b8 0f 80 00 00 	movabs $0x800fb8,%rax
+  80015a:	00 00 00 
+  80015d:	ff d0                	call   *%rax
+}
+  80015f:	5d                   	pop    %rbp
+  800160:	c3                   	ret
+
+0000000000800161 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  800161:	55                   	push   %rbp
+  800162:	48 89 e5             	mov    %rsp,%rbp
+  800165:	53                   	push   %rbx
+  800166:	48 83 ec 08          	sub    $0x8,%rsp
+  80016a:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  80016d:	8b 06                	mov    (%rsi),%eax
+  80016f:	8d 50 01             	lea    0x1(%rax),%edx
+  800172:	89 16                	mov    %edx,(%rsi)
+  800174:	48 98                	cltq
+  800176:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  80017b:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  800181:	74 0a                	je     80018d <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  800183:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  800187:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80018b:	c9                   	leave
+  80018c:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  80018d:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  800191:	be ff 00 00 00       	mov    $0xff,%esi
+  800196:	48 b8 5a 0f 80 00 00 	movabs $0x800f5a,%rax
+  80019d:	00 00 00 
+  8001a0:	ff d0                	call   *%rax
+        state->offset = 0;
+  8001a2:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  8001a8:	eb d9                	jmp    800183 <putch+0x22>
+
+00000000008001aa <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  8001aa:	55                   	push   %rbp
+  8001ab:	48 89 e5             	mov    %rsp,%rbp
+  8001ae:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  8001b5:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  8001b8:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  8001bf:	b9 21 00 00 00       	mov    $0x21,%ecx
+  8001c4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001c9:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  8001cc:	48 89 f1             	mov    %rsi,%rcx
+  8001cf:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  8001d6:	48 bf 61 01 80 00 00 	movabs $0x800161,%rdi
+  8001dd:	00 00 00 
+  8001e0:	48 b8 5e 03 80 00 00 	movabs $0x80035e,%rax
+  8001e7:	00 00 00 
+  8001ea:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  8001ec:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  8001f3:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  8001fa:	48 b8 5a 0f 80 00 00 	movabs $0x800f5a,%rax
+  800201:	00 00 00 
+  800204:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  800206:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  80020c:	c9                   	leave
+  80020d:	c3                   	ret
+
+000000000080020e <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  80020e:	55                   	push   %rbp
+  80020f:	48 89 e5             	mov    %rsp,%rbp
+  800212:	48 83 ec 50          	sub    $0x50,%rsp
+  800216:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  80021a:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  80021e:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800222:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800226:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  80022a:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  800231:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800235:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800239:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80023d:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  800241:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  800245:	48 b8 aa 01 80 00 00 	movabs $0x8001aa,%rax
+  80024c:	00 00 00 
+  80024f:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  800251:	c9                   	leave
+  800252:	c3                   	ret
+
+0000000000800253 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  800253:	55                   	push   %rbp
+  800254:	48 89 e5             	mov    %rsp,%rbp
+  800257:	41 57                	push   %r15
+  800259:	41 56                	push   %r14
+  80025b:	41 55                	push   %r13
+  80025d:	41 54                	push   %r12
+  80025f:	53                   	push   %rbx
+  800260:	48 83 ec 18          	sub    $0x18,%rsp
+  800264:	49 89 fc             	mov    %rdi,%r12
+  800267:	49 89 f5             	mov    %rsi,%r13
+  80026a:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  80026e:	8b 45 10             	mov    0x10(%rbp),%eax
+  800271:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  800274:	41 89 cf             	mov    %ecx,%r15d
+  800277:	4c 39 fa             	cmp    %r15,%rdx
+  80027a:	73 5b                	jae    8002d7 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  80027c:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  800280:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  800284:	85 db                	test   %ebx,%ebx
+  800286:	7e 0e                	jle    800296 <print_num+0x43>
+            putch(padc, put_arg);
+  800288:	4c 89 ee             	mov    %r13,%rsi
+  80028b:	44 89 f7             	mov    %r14d,%edi
+  80028e:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  800291:	83 eb 01             	sub    $0x1,%ebx
+  800294:	75 f2                	jne    800288 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  800296:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  80029a:	48 b9 f8 2f 80 00 00 	movabs $0x802ff8,%rcx
+  8002a1:	00 00 00 
+  8002a4:	48 b8 e7 2f 80 00 00 	movabs $0x802fe7,%rax
+  8002ab:	00 00 00 
+  8002ae:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  8002b2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8002b6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8002bb:	49 f7 f7             	div    %r15
+  8002be:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  8002c2:	4c 89 ee             	mov    %r13,%rsi
+  8002c5:	41 ff d4             	call   *%r12
+}
+  8002c8:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8002cc:	5b                   	pop    %rbx
+  8002cd:	41 5c                	pop    %r12
+  8002cf:	41 5d                	pop    %r13
+  8002d1:	41 5e                	pop    %r14
+  8002d3:	41 5f                	pop    %r15
+  8002d5:	5d                   	pop    %rbp
+  8002d6:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  8002d7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8002db:	ba 00 00 00 00       	mov    $0x0,%edx
+  8002e0:	49 f7 f7             	div    %r15
+  8002e3:	48 83 ec 08          	sub    $0x8,%rsp
+  8002e7:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  8002eb:	52                   	push   %rdx
+  8002ec:	45 0f be c9          	movsbl %r9b,%r9d
+  8002f0:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  8002f4:	48 89 c2             	mov    %rax,%rdx
+  8002f7:	48 b8 53 02 80 00 00 	movabs $0x800253,%rax
+  8002fe:	00 00 00 
+  800301:	ff d0                	call   *%rax
+  800303:	48 83 c4 10          	add    $0x10,%rsp
+  800307:	eb 8d                	jmp    800296 <print_num+0x43>
+
+0000000000800309 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  800309:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  80030d:	48 8b 06             	mov    (%rsi),%rax
+  800310:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  800314:	73 0a                	jae    800320 <sprintputch+0x17>
+        *state->start++ = ch;
+  800316:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80031a:	48 89 16             	mov    %rdx,(%rsi)
+  80031d:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  800320:	c3                   	ret
+
+0000000000800321 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  800321:	55                   	push   %rbp
+  800322:	48 89 e5             	mov    %rsp,%rbp
+  800325:	48 83 ec 50          	sub    $0x50,%rsp
+  800329:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80032d:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800331:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  800335:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  80033c:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800340:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800344:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800348:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  80034c:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800350:	48 b8 5e 03 80 00 00 	movabs $0x80035e,%rax
+  800357:	00 00 00 
+  80035a:	ff d0                	call   *%rax
+}
+  80035c:	c9                   	leave
+  80035d:	c3                   	ret
+
+000000000080035e <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  80035e:	55                   	push   %rbp
+  80035f:	48 89 e5             	mov    %rsp,%rbp
+  800362:	41 57                	push   %r15
+  800364:	41 56                	push   %r14
+  800366:	41 55                	push   %r13
+  800368:	41 54                	push   %r12
+  80036a:	53                   	push   %rbx
+  80036b:	48 83 ec 38          	sub    $0x38,%rsp
+  80036f:	49 89 fe             	mov    %rdi,%r14
+  800372:	49 89 f5             	mov    %rsi,%r13
+  800375:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  800378:	48 8b 01             	mov    (%rcx),%rax
+  80037b:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  80037f:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800383:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800387:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  80038b:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  80038f:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  800393:	0f b6 3b             	movzbl (%rbx),%edi
+  800396:	40 80 ff 25          	cmp    $0x25,%dil
+  80039a:	74 18                	je     8003b4 <vprintfmt+0x56>
+            if (!ch) return;
+  80039c:	40 84 ff             	test   %dil,%dil
+  80039f:	0f 84 b1 06 00 00    	je     800a56 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  8003a5:	40 0f b6 ff          	movzbl %dil,%edi
+  8003a9:	4c 89 ee             	mov    %r13,%rsi
+  8003ac:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  8003af:	4c 89 e3             	mov    %r12,%rbx
+  8003b2:	eb db                	jmp    80038f <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  8003b4:	be 00 00 00 00       	mov    $0x0,%esi
+  8003b9:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  8003bd:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  8003c2:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8003c8:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  8003cf:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8003d3:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  8003d8:	41 0f b6 04 24       	movzbl (%r12),%eax
+  8003dd:	88 45 a0             	mov    %al,-0x60(%rbp)
+  8003e0:	83 e8 23             	sub    $0x23,%eax
+  8003e3:	3c 57                	cmp    $0x57,%al
+  8003e5:	0f 87 51 06 00 00    	ja     800a3c <vprintfmt+0x6de>
+  8003eb:	0f b6 c0             	movzbl %al,%eax
+  8003ee:	48 b9 a0 31 80 00 00 	movabs $0x8031a0,%rcx
+  8003f5:	00 00 00 
+  8003f8:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  8003fb:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  8003fe:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  800402:	eb cf                	jmp    8003d3 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  800404:	49 89 dc             	mov    %rbx,%r12
+  800407:	be 01 00 00 00       	mov    $0x1,%esi
+  80040c:	eb c5                	jmp    8003d3 <vprintfmt+0x75>
+            padc = ch;
+  80040e:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  800412:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800415:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800418:	eb b9                	jmp    8003d3 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  80041a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80041d:	83 f8 2f             	cmp    $0x2f,%eax
+  800420:	77 24                	ja     800446 <vprintfmt+0xe8>
+  800422:	89 c1                	mov    %eax,%ecx
+  800424:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  800428:	83 c0 08             	add    $0x8,%eax
+  80042b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80042e:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  800431:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  800434:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800438:	79 99                	jns    8003d3 <vprintfmt+0x75>
+                width = precision;
+  80043a:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  80043e:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800444:	eb 8d                	jmp    8003d3 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800446:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80044a:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  80044e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800452:	eb da                	jmp    80042e <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  800454:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  800459:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  80045d:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  800463:	3c 39                	cmp    $0x39,%al
+  800465:	77 1c                	ja     800483 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  800467:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  80046b:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  80046f:	0f b6 c0             	movzbl %al,%eax
+  800472:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800477:	0f b6 03             	movzbl (%rbx),%eax
+  80047a:	3c 39                	cmp    $0x39,%al
+  80047c:	76 e9                	jbe    800467 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  80047e:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  800481:	eb b1                	jmp    800434 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  800483:	49 89 dc             	mov    %rbx,%r12
+  800486:	eb ac                	jmp    800434 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  800488:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  80048b:	85 c9                	test   %ecx,%ecx
+  80048d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800492:	0f 49 c1             	cmovns %ecx,%eax
+  800495:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  800498:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80049b:	e9 33 ff ff ff       	jmp    8003d3 <vprintfmt+0x75>
+            lflag++;
+  8004a0:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  8004a3:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8004a6:	e9 28 ff ff ff       	jmp    8003d3 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  8004ab:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8004ae:	83 f8 2f             	cmp    $0x2f,%eax
+  8004b1:	77 19                	ja     8004cc <vprintfmt+0x16e>
+  8004b3:	89 c2                	mov    %eax,%edx
+  8004b5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8004b9:	83 c0 08             	add    $0x8,%eax
+  8004bc:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8004bf:	8b 3a                	mov    (%rdx),%edi
+  8004c1:	4c 89 ee             	mov    %r13,%rsi
+  8004c4:	41 ff d6             	call   *%r14
+            break;
+  8004c7:	e9 c3 fe ff ff       	jmp    80038f <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  8004cc:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8004d0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8004d4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8004d8:	eb e5                	jmp    8004bf <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  8004da:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8004dd:	83 f8 2f             	cmp    $0x2f,%eax
+  8004e0:	77 5a                	ja     80053c <vprintfmt+0x1de>
+  8004e2:	89 c2                	mov    %eax,%edx
+  8004e4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8004e8:	83 c0 08             	add    $0x8,%eax
+  8004eb:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  8004ee:	8b 02                	mov    (%rdx),%eax
+  8004f0:	89 c1                	mov    %eax,%ecx
+  8004f2:	f7 d9                	neg    %ecx
+  8004f4:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  8004f7:	83 f9 15             	cmp    $0x15,%ecx
+  8004fa:	7f 4e                	jg     80054a <vprintfmt+0x1ec>
+  8004fc:	48 63 c1             	movslq %ecx,%rax
+  8004ff:	48 ba 60 34 80 00 00 	movabs $0x803460,%rdx
+  800506:	00 00 00 
+  800509:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80050d:	48 85 c0             	test   %rax,%rax
+  800510:	74 38                	je     80054a <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  800512:	48 89 c1             	mov    %rax,%rcx
+  800515:	48 ba e2 35 80 00 00 	movabs $0x8035e2,%rdx
+  80051c:	00 00 00 
+  80051f:	4c 89 ee             	mov    %r13,%rsi
+  800522:	4c 89 f7             	mov    %r14,%rdi
+  800525:	b8 00 00 00 00       	mov    $0x0,%eax
+  80052a:	49 b8 21 03 80 00 00 	movabs $0x800321,%r8
+  800531:	00 00 00 
+  800534:	41 ff d0             	call   *%r8
+  800537:	e9 53 fe ff ff       	jmp    80038f <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  80053c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800540:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800544:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800548:	eb a4                	jmp    8004ee <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  80054a:	48 ba 10 30 80 00 00 	movabs $0x803010,%rdx
+  800551:	00 00 00 
+  800554:	4c 89 ee             	mov    %r13,%rsi
+  800557:	4c 89 f7             	mov    %r14,%rdi
+  80055a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80055f:	49 b8 21 03 80 00 00 	movabs $0x800321,%r8
+  800566:	00 00 00 
+  800569:	41 ff d0             	call   *%r8
+  80056c:	e9 1e fe ff ff       	jmp    80038f <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800571:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800574:	83 f8 2f             	cmp    $0x2f,%eax
+  800577:	77 6c                	ja     8005e5 <vprintfmt+0x287>
+  800579:	89 c2                	mov    %eax,%edx
+  80057b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80057f:	83 c0 08             	add    $0x8,%eax
+  800582:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800585:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  800588:	48 85 d2             	test   %rdx,%rdx
+  80058b:	48 b8 09 30 80 00 00 	movabs $0x803009,%rax
+  800592:	00 00 00 
+  800595:	48 0f 45 c2          	cmovne %rdx,%rax
+  800599:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  80059d:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8005a1:	7e 06                	jle    8005a9 <vprintfmt+0x24b>
+  8005a3:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  8005a7:	75 4a                	jne    8005f3 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8005a9:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8005ad:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8005b1:	0f b6 00             	movzbl (%rax),%eax
+  8005b4:	84 c0                	test   %al,%al
+  8005b6:	0f 85 9a 00 00 00    	jne    800656 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  8005bc:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8005bf:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  8005c3:	85 c0                	test   %eax,%eax
+  8005c5:	0f 8e c4 fd ff ff    	jle    80038f <vprintfmt+0x31>
+  8005cb:	4c 89 ee             	mov    %r13,%rsi
+  8005ce:	bf 20 00 00 00       	mov    $0x20,%edi
+  8005d3:	41 ff d6             	call   *%r14
+  8005d6:	41 83 ec 01          	sub    $0x1,%r12d
+  8005da:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  8005de:	75 eb                	jne    8005cb <vprintfmt+0x26d>
+  8005e0:	e9 aa fd ff ff       	jmp    80038f <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8005e5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8005e9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8005ed:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8005f1:	eb 92                	jmp    800585 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  8005f3:	49 63 f7             	movslq %r15d,%rsi
+  8005f6:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  8005fa:	48 b8 10 0b 80 00 00 	movabs $0x800b10,%rax
+  800601:	00 00 00 
+  800604:	ff d0                	call   *%rax
+  800606:	48 89 c2             	mov    %rax,%rdx
+  800609:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80060c:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  80060e:	8d 70 ff             	lea    -0x1(%rax),%esi
+  800611:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  800614:	85 c0                	test   %eax,%eax
+  800616:	7e 91                	jle    8005a9 <vprintfmt+0x24b>
+  800618:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  80061d:	4c 89 ee             	mov    %r13,%rsi
+  800620:	44 89 e7             	mov    %r12d,%edi
+  800623:	41 ff d6             	call   *%r14
+  800626:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  80062a:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80062d:	83 f8 ff             	cmp    $0xffffffff,%eax
+  800630:	75 eb                	jne    80061d <vprintfmt+0x2bf>
+  800632:	e9 72 ff ff ff       	jmp    8005a9 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800637:	0f b6 f8             	movzbl %al,%edi
+  80063a:	4c 89 ee             	mov    %r13,%rsi
+  80063d:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800640:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800644:	49 83 c4 01          	add    $0x1,%r12
+  800648:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  80064e:	84 c0                	test   %al,%al
+  800650:	0f 84 66 ff ff ff    	je     8005bc <vprintfmt+0x25e>
+  800656:	45 85 ff             	test   %r15d,%r15d
+  800659:	78 0a                	js     800665 <vprintfmt+0x307>
+  80065b:	41 83 ef 01          	sub    $0x1,%r15d
+  80065f:	0f 88 57 ff ff ff    	js     8005bc <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800665:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  800669:	74 cc                	je     800637 <vprintfmt+0x2d9>
+  80066b:	8d 50 e0             	lea    -0x20(%rax),%edx
+  80066e:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800673:	80 fa 5e             	cmp    $0x5e,%dl
+  800676:	77 c2                	ja     80063a <vprintfmt+0x2dc>
+  800678:	eb bd                	jmp    800637 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  80067a:	40 84 f6             	test   %sil,%sil
+  80067d:	75 26                	jne    8006a5 <vprintfmt+0x347>
+    switch (lflag) {
+  80067f:	85 d2                	test   %edx,%edx
+  800681:	74 59                	je     8006dc <vprintfmt+0x37e>
+  800683:	83 fa 01             	cmp    $0x1,%edx
+  800686:	74 7b                	je     800703 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  800688:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80068b:	83 f8 2f             	cmp    $0x2f,%eax
+  80068e:	0f 87 96 00 00 00    	ja     80072a <vprintfmt+0x3cc>
+  800694:	89 c2                	mov    %eax,%edx
+  800696:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80069a:	83 c0 08             	add    $0x8,%eax
+  80069d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8006a0:	4c 8b 22             	mov    (%rdx),%r12
+  8006a3:	eb 17                	jmp    8006bc <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  8006a5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006a8:	83 f8 2f             	cmp    $0x2f,%eax
+  8006ab:	77 21                	ja     8006ce <vprintfmt+0x370>
+  8006ad:	89 c2                	mov    %eax,%edx
+  8006af:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8006b3:	83 c0 08             	add    $0x8,%eax
+  8006b6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8006b9:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  8006bc:	4d 85 e4             	test   %r12,%r12
+  8006bf:	78 7a                	js     80073b <vprintfmt+0x3dd>
+            num = i;
+  8006c1:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  8006c4:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  8006c9:	e9 50 02 00 00       	jmp    80091e <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8006ce:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8006d2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006d6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006da:	eb dd                	jmp    8006b9 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  8006dc:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006df:	83 f8 2f             	cmp    $0x2f,%eax
+  8006e2:	77 11                	ja     8006f5 <vprintfmt+0x397>
+  8006e4:	89 c2                	mov    %eax,%edx
+  8006e6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8006ea:	83 c0 08             	add    $0x8,%eax
+  8006ed:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8006f0:	4c 63 22             	movslq (%rdx),%r12
+  8006f3:	eb c7                	jmp    8006bc <vprintfmt+0x35e>
+  8006f5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8006f9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006fd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800701:	eb ed                	jmp    8006f0 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  800703:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800706:	83 f8 2f             	cmp    $0x2f,%eax
+  800709:	77 11                	ja     80071c <vprintfmt+0x3be>
+  80070b:	89 c2                	mov    %eax,%edx
+  80070d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800711:	83 c0 08             	add    $0x8,%eax
+  800714:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800717:	4c 8b 22             	mov    (%rdx),%r12
+  80071a:	eb a0                	jmp    8006bc <vprintfmt+0x35e>
+  80071c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800720:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800724:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800728:	eb ed                	jmp    800717 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  80072a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80072e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800732:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800736:	e9 65 ff ff ff       	jmp    8006a0 <vprintfmt+0x342>
+                putch('-', put_arg);
+  80073b:	4c 89 ee             	mov    %r13,%rsi
+  80073e:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800743:	41 ff d6             	call   *%r14
+                i = -i;
+  800746:	49 f7 dc             	neg    %r12
+  800749:	e9 73 ff ff ff       	jmp    8006c1 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  80074e:	40 84 f6             	test   %sil,%sil
+  800751:	75 32                	jne    800785 <vprintfmt+0x427>
+    switch (lflag) {
+  800753:	85 d2                	test   %edx,%edx
+  800755:	74 5d                	je     8007b4 <vprintfmt+0x456>
+  800757:	83 fa 01             	cmp    $0x1,%edx
+  80075a:	0f 84 82 00 00 00    	je     8007e2 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  800760:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800763:	83 f8 2f             	cmp    $0x2f,%eax
+  800766:	0f 87 a5 00 00 00    	ja     800811 <vprintfmt+0x4b3>
+  80076c:	89 c2                	mov    %eax,%edx
+  80076e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800772:	83 c0 08             	add    $0x8,%eax
+  800775:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800778:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  80077b:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  800780:	e9 99 01 00 00       	jmp    80091e <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800785:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800788:	83 f8 2f             	cmp    $0x2f,%eax
+  80078b:	77 19                	ja     8007a6 <vprintfmt+0x448>
+  80078d:	89 c2                	mov    %eax,%edx
+  80078f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800793:	83 c0 08             	add    $0x8,%eax
+  800796:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800799:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  80079c:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8007a1:	e9 78 01 00 00       	jmp    80091e <vprintfmt+0x5c0>
+  8007a6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007aa:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007ae:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007b2:	eb e5                	jmp    800799 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  8007b4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007b7:	83 f8 2f             	cmp    $0x2f,%eax
+  8007ba:	77 18                	ja     8007d4 <vprintfmt+0x476>
+  8007bc:	89 c2                	mov    %eax,%edx
+  8007be:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007c2:	83 c0 08             	add    $0x8,%eax
+  8007c5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007c8:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  8007ca:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  8007cf:	e9 4a 01 00 00       	jmp    80091e <vprintfmt+0x5c0>
+  8007d4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007d8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007dc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007e0:	eb e6                	jmp    8007c8 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  8007e2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007e5:	83 f8 2f             	cmp    $0x2f,%eax
+  8007e8:	77 19                	ja     800803 <vprintfmt+0x4a5>
+  8007ea:	89 c2                	mov    %eax,%edx
+  8007ec:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007f0:	83 c0 08             	add    $0x8,%eax
+  8007f3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007f6:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8007f9:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  8007fe:	e9 1b 01 00 00       	jmp    80091e <vprintfmt+0x5c0>
+  800803:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800807:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80080b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80080f:	eb e5                	jmp    8007f6 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  800811:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800815:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800819:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80081d:	e9 56 ff ff ff       	jmp    800778 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  800822:	40 84 f6             	test   %sil,%sil
+  800825:	75 2e                	jne    800855 <vprintfmt+0x4f7>
+    switch (lflag) {
+  800827:	85 d2                	test   %edx,%edx
+  800829:	74 59                	je     800884 <vprintfmt+0x526>
+  80082b:	83 fa 01             	cmp    $0x1,%edx
+  80082e:	74 7f                	je     8008af <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  800830:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800833:	83 f8 2f             	cmp    $0x2f,%eax
+  800836:	0f 87 9f 00 00 00    	ja     8008db <vprintfmt+0x57d>
+  80083c:	89 c2                	mov    %eax,%edx
+  80083e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800842:	83 c0 08             	add    $0x8,%eax
+  800845:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800848:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  80084b:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  800850:	e9 c9 00 00 00       	jmp    80091e <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800855:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800858:	83 f8 2f             	cmp    $0x2f,%eax
+  80085b:	77 19                	ja     800876 <vprintfmt+0x518>
+  80085d:	89 c2                	mov    %eax,%edx
+  80085f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800863:	83 c0 08             	add    $0x8,%eax
+  800866:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800869:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  80086c:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800871:	e9 a8 00 00 00       	jmp    80091e <vprintfmt+0x5c0>
+  800876:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80087a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80087e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800882:	eb e5                	jmp    800869 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  800884:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800887:	83 f8 2f             	cmp    $0x2f,%eax
+  80088a:	77 15                	ja     8008a1 <vprintfmt+0x543>
+  80088c:	89 c2                	mov    %eax,%edx
+  80088e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800892:	83 c0 08             	add    $0x8,%eax
+  800895:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800898:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  80089a:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  80089f:	eb 7d                	jmp    80091e <vprintfmt+0x5c0>
+  8008a1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008a5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008a9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008ad:	eb e9                	jmp    800898 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  8008af:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008b2:	83 f8 2f             	cmp    $0x2f,%eax
+  8008b5:	77 16                	ja     8008cd <vprintfmt+0x56f>
+  8008b7:	89 c2                	mov    %eax,%edx
+  8008b9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008bd:	83 c0 08             	add    $0x8,%eax
+  8008c0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008c3:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8008c6:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  8008cb:	eb 51                	jmp    80091e <vprintfmt+0x5c0>
+  8008cd:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008d1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008d5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008d9:	eb e8                	jmp    8008c3 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  8008db:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008df:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008e3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008e7:	e9 5c ff ff ff       	jmp    800848 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  8008ec:	4c 89 ee             	mov    %r13,%rsi
+  8008ef:	bf 30 00 00 00       	mov    $0x30,%edi
+  8008f4:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  8008f7:	4c 89 ee             	mov    %r13,%rsi
+  8008fa:	bf 78 00 00 00       	mov    $0x78,%edi
+  8008ff:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800902:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800905:	83 f8 2f             	cmp    $0x2f,%eax
+  800908:	77 47                	ja     800951 <vprintfmt+0x5f3>
+  80090a:	89 c2                	mov    %eax,%edx
+  80090c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800910:	83 c0 08             	add    $0x8,%eax
+  800913:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800916:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800919:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  80091e:	48 83 ec 08          	sub    $0x8,%rsp
+  800922:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800926:	0f 94 c0             	sete   %al
+  800929:	0f b6 c0             	movzbl %al,%eax
+  80092c:	50                   	push   %rax
+  80092d:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800932:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800936:	4c 89 ee             	mov    %r13,%rsi
+  800939:	4c 89 f7             	mov    %r14,%rdi
+  80093c:	48 b8 53 02 80 00 00 	movabs $0x800253,%rax
+  800943:	00 00 00 
+  800946:	ff d0                	call   *%rax
+            break;
+  800948:	48 83 c4 10          	add    $0x10,%rsp
+  80094c:	e9 3e fa ff ff       	jmp    80038f <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800951:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800955:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800959:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80095d:	eb b7                	jmp    800916 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  80095f:	40 84 f6             	test   %sil,%sil
+  800962:	75 2b                	jne    80098f <vprintfmt+0x631>
+    switch (lflag) {
+  800964:	85 d2                	test   %edx,%edx
+  800966:	74 56                	je     8009be <vprintfmt+0x660>
+  800968:	83 fa 01             	cmp    $0x1,%edx
+  80096b:	74 7f                	je     8009ec <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  80096d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800970:	83 f8 2f             	cmp    $0x2f,%eax
+  800973:	0f 87 a2 00 00 00    	ja     800a1b <vprintfmt+0x6bd>
+  800979:	89 c2                	mov    %eax,%edx
+  80097b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80097f:	83 c0 08             	add    $0x8,%eax
+  800982:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800985:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800988:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  80098d:	eb 8f                	jmp    80091e <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  80098f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800992:	83 f8 2f             	cmp    $0x2f,%eax
+  800995:	77 19                	ja     8009b0 <vprintfmt+0x652>
+  800997:	89 c2                	mov    %eax,%edx
+  800999:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80099d:	83 c0 08             	add    $0x8,%eax
+  8009a0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009a3:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8009a6:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8009ab:	e9 6e ff ff ff       	jmp    80091e <vprintfmt+0x5c0>
+  8009b0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009b4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009b8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009bc:	eb e5                	jmp    8009a3 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  8009be:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009c1:	83 f8 2f             	cmp    $0x2f,%eax
+  8009c4:	77 18                	ja     8009de <vprintfmt+0x680>
+  8009c6:	89 c2                	mov    %eax,%edx
+  8009c8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009cc:	83 c0 08             	add    $0x8,%eax
+  8009cf:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009d2:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  8009d4:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  8009d9:	e9 40 ff ff ff       	jmp    80091e <vprintfmt+0x5c0>
+  8009de:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009e2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009e6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009ea:	eb e6                	jmp    8009d2 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  8009ec:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009ef:	83 f8 2f             	cmp    $0x2f,%eax
+  8009f2:	77 19                	ja     800a0d <vprintfmt+0x6af>
+  8009f4:	89 c2                	mov    %eax,%edx
+  8009f6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009fa:	83 c0 08             	add    $0x8,%eax
+  8009fd:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a00:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800a03:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800a08:	e9 11 ff ff ff       	jmp    80091e <vprintfmt+0x5c0>
+  800a0d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a11:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a15:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a19:	eb e5                	jmp    800a00 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800a1b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a1f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a23:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a27:	e9 59 ff ff ff       	jmp    800985 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800a2c:	4c 89 ee             	mov    %r13,%rsi
+  800a2f:	bf 25 00 00 00       	mov    $0x25,%edi
+  800a34:	41 ff d6             	call   *%r14
+            break;
+  800a37:	e9 53 f9 ff ff       	jmp    80038f <vprintfmt+0x31>
+            putch('%', put_arg);
+  800a3c:	4c 89 ee             	mov    %r13,%rsi
+  800a3f:	bf 25 00 00 00       	mov    $0x25,%edi
+  800a44:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800a47:	48 83 eb 01          	sub    $0x1,%rbx
+  800a4b:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800a4f:	75 f6                	jne    800a47 <vprintfmt+0x6e9>
+  800a51:	e9 39 f9 ff ff       	jmp    80038f <vprintfmt+0x31>
+}
+  800a56:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800a5a:	5b                   	pop    %rbx
+  800a5b:	41 5c                	pop    %r12
+  800a5d:	41 5d                	pop    %r13
+  800a5f:	41 5e                	pop    %r14
+  800a61:	41 5f                	pop    %r15
+  800a63:	5d                   	pop    %rbp
+  800a64:	c3                   	ret
+
+0000000000800a65 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800a65:	55                   	push   %rbp
+  800a66:	48 89 e5             	mov    %rsp,%rbp
+  800a69:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800a6d:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800a71:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800a76:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800a7a:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800a81:	48 85 ff             	test   %rdi,%rdi
+  800a84:	74 2b                	je     800ab1 <vsnprintf+0x4c>
+  800a86:	48 85 f6             	test   %rsi,%rsi
+  800a89:	74 26                	je     800ab1 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800a8b:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800a8f:	48 bf 09 03 80 00 00 	movabs $0x800309,%rdi
+  800a96:	00 00 00 
+  800a99:	48 b8 5e 03 80 00 00 	movabs $0x80035e,%rax
+  800aa0:	00 00 00 
+  800aa3:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800aa5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800aa9:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800aac:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800aaf:	c9                   	leave
+  800ab0:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800ab1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800ab6:	eb f7                	jmp    800aaf <vsnprintf+0x4a>
+
+0000000000800ab8 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800ab8:	55                   	push   %rbp
+  800ab9:	48 89 e5             	mov    %rsp,%rbp
+  800abc:	48 83 ec 50          	sub    $0x50,%rsp
+  800ac0:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800ac4:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800ac8:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800acc:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800ad3:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800ad7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800adb:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800adf:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800ae3:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800ae7:	48 b8 65 0a 80 00 00 	movabs $0x800a65,%rax
+  800aee:	00 00 00 
+  800af1:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800af3:	c9                   	leave
+  800af4:	c3                   	ret
+
+0000000000800af5 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800af5:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800af8:	74 10                	je     800b0a <strlen+0x15>
+    size_t n = 0;
+  800afa:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800aff:	48 83 c0 01          	add    $0x1,%rax
+  800b03:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800b07:	75 f6                	jne    800aff <strlen+0xa>
+  800b09:	c3                   	ret
+    size_t n = 0;
+  800b0a:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800b0f:	c3                   	ret
+
+0000000000800b10 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800b10:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800b13:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800b18:	48 85 f6             	test   %rsi,%rsi
+  800b1b:	74 11                	je     800b2e <strnlen+0x1e>
+  800b1d:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800b21:	74 0c                	je     800b2f <strnlen+0x1f>
+  800b23:	48 83 c2 01          	add    $0x1,%rdx
+  800b27:	48 39 d0             	cmp    %rdx,%rax
+  800b2a:	75 f1                	jne    800b1d <strnlen+0xd>
+  800b2c:	eb 04                	jmp    800b32 <strnlen+0x22>
+  800b2e:	c3                   	ret
+  800b2f:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800b32:	c3                   	ret
+
+0000000000800b33 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800b33:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800b36:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b3b:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800b3f:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800b42:	48 83 c2 01          	add    $0x1,%rdx
+  800b46:	84 c9                	test   %cl,%cl
+  800b48:	75 f1                	jne    800b3b <strcpy+0x8>
+        ;
+    return res;
+}
+  800b4a:	c3                   	ret
+
+0000000000800b4b <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800b4b:	55                   	push   %rbp
+  800b4c:	48 89 e5             	mov    %rsp,%rbp
+  800b4f:	41 54                	push   %r12
+  800b51:	53                   	push   %rbx
+  800b52:	48 89 fb             	mov    %rdi,%rbx
+  800b55:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800b58:	48 b8 f5 0a 80 00 00 	movabs $0x800af5,%rax
+  800b5f:	00 00 00 
+  800b62:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800b64:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800b68:	4c 89 e6             	mov    %r12,%rsi
+  800b6b:	48 b8 33 0b 80 00 00 	movabs $0x800b33,%rax
+  800b72:	00 00 00 
+  800b75:	ff d0                	call   *%rax
+    return dst;
+}
+  800b77:	48 89 d8             	mov    %rbx,%rax
+  800b7a:	5b                   	pop    %rbx
+  800b7b:	41 5c                	pop    %r12
+  800b7d:	5d                   	pop    %rbp
+  800b7e:	c3                   	ret
+
+0000000000800b7f <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800b7f:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800b82:	48 85 d2             	test   %rdx,%rdx
+  800b85:	74 1f                	je     800ba6 <strncpy+0x27>
+  800b87:	48 01 fa             	add    %rdi,%rdx
+  800b8a:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800b8d:	48 83 c1 01          	add    $0x1,%rcx
+  800b91:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800b95:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800b99:	41 80 f8 01          	cmp    $0x1,%r8b
+  800b9d:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800ba1:	48 39 ca             	cmp    %rcx,%rdx
+  800ba4:	75 e7                	jne    800b8d <strncpy+0xe>
+    }
+    return ret;
+}
+  800ba6:	c3                   	ret
+
+0000000000800ba7 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800ba7:	48 89 f8             	mov    %rdi,%rax
+  800baa:	48 85 d2             	test   %rdx,%rdx
+  800bad:	74 24                	je     800bd3 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800baf:	48 83 ea 01          	sub    $0x1,%rdx
+  800bb3:	74 1b                	je     800bd0 <strlcpy+0x29>
+  800bb5:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800bb9:	0f b6 16             	movzbl (%rsi),%edx
+  800bbc:	84 d2                	test   %dl,%dl
+  800bbe:	74 10                	je     800bd0 <strlcpy+0x29>
+            *dst++ = *src++;
+  800bc0:	48 83 c6 01          	add    $0x1,%rsi
+  800bc4:	48 83 c0 01          	add    $0x1,%rax
+  800bc8:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800bcb:	48 39 c8             	cmp    %rcx,%rax
+  800bce:	75 e9                	jne    800bb9 <strlcpy+0x12>
+        *dst = '\0';
+  800bd0:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800bd3:	48 29 f8             	sub    %rdi,%rax
+}
+  800bd6:	c3                   	ret
+
+0000000000800bd7 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800bd7:	0f b6 07             	movzbl (%rdi),%eax
+  800bda:	84 c0                	test   %al,%al
+  800bdc:	74 13                	je     800bf1 <strcmp+0x1a>
+  800bde:	38 06                	cmp    %al,(%rsi)
+  800be0:	75 0f                	jne    800bf1 <strcmp+0x1a>
+  800be2:	48 83 c7 01          	add    $0x1,%rdi
+  800be6:	48 83 c6 01          	add    $0x1,%rsi
+  800bea:	0f b6 07             	movzbl (%rdi),%eax
+  800bed:	84 c0                	test   %al,%al
+  800bef:	75 ed                	jne    800bde <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800bf1:	0f b6 c0             	movzbl %al,%eax
+  800bf4:	0f b6 16             	movzbl (%rsi),%edx
+  800bf7:	29 d0                	sub    %edx,%eax
+}
+  800bf9:	c3                   	ret
+
+0000000000800bfa <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800bfa:	48 85 d2             	test   %rdx,%rdx
+  800bfd:	74 1f                	je     800c1e <strncmp+0x24>
+  800bff:	0f b6 07             	movzbl (%rdi),%eax
+  800c02:	84 c0                	test   %al,%al
+  800c04:	74 1e                	je     800c24 <strncmp+0x2a>
+  800c06:	3a 06                	cmp    (%rsi),%al
+  800c08:	75 1a                	jne    800c24 <strncmp+0x2a>
+  800c0a:	48 83 c7 01          	add    $0x1,%rdi
+  800c0e:	48 83 c6 01          	add    $0x1,%rsi
+  800c12:	48 83 ea 01          	sub    $0x1,%rdx
+  800c16:	75 e7                	jne    800bff <strncmp+0x5>
+
+    if (!n) return 0;
+  800c18:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c1d:	c3                   	ret
+  800c1e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c23:	c3                   	ret
+  800c24:	48 85 d2             	test   %rdx,%rdx
+  800c27:	74 09                	je     800c32 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800c29:	0f b6 07             	movzbl (%rdi),%eax
+  800c2c:	0f b6 16             	movzbl (%rsi),%edx
+  800c2f:	29 d0                	sub    %edx,%eax
+  800c31:	c3                   	ret
+    if (!n) return 0;
+  800c32:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800c37:	c3                   	ret
+
+0000000000800c38 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800c38:	0f b6 17             	movzbl (%rdi),%edx
+  800c3b:	84 d2                	test   %dl,%dl
+  800c3d:	74 18                	je     800c57 <strchr+0x1f>
+        if (*str == c) {
+  800c3f:	0f be d2             	movsbl %dl,%edx
+  800c42:	39 f2                	cmp    %esi,%edx
+  800c44:	74 17                	je     800c5d <strchr+0x25>
+    for (; *str; str++) {
+  800c46:	48 83 c7 01          	add    $0x1,%rdi
+  800c4a:	0f b6 17             	movzbl (%rdi),%edx
+  800c4d:	84 d2                	test   %dl,%dl
+  800c4f:	75 ee                	jne    800c3f <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800c51:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c56:	c3                   	ret
+  800c57:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c5c:	c3                   	ret
+  800c5d:	48 89 f8             	mov    %rdi,%rax
+}
+  800c60:	c3                   	ret
+
+0000000000800c61 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800c61:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800c64:	0f b6 17             	movzbl (%rdi),%edx
+  800c67:	84 d2                	test   %dl,%dl
+  800c69:	74 13                	je     800c7e <strfind+0x1d>
+  800c6b:	0f be d2             	movsbl %dl,%edx
+  800c6e:	39 f2                	cmp    %esi,%edx
+  800c70:	74 0b                	je     800c7d <strfind+0x1c>
+  800c72:	48 83 c0 01          	add    $0x1,%rax
+  800c76:	0f b6 10             	movzbl (%rax),%edx
+  800c79:	84 d2                	test   %dl,%dl
+  800c7b:	75 ee                	jne    800c6b <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800c7d:	c3                   	ret
+  800c7e:	c3                   	ret
+
+0000000000800c7f <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800c7f:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800c82:	48 89 f8             	mov    %rdi,%rax
+  800c85:	48 f7 d8             	neg    %rax
+  800c88:	83 e0 07             	and    $0x7,%eax
+  800c8b:	49 89 d1             	mov    %rdx,%r9
+  800c8e:	49 29 c1             	sub    %rax,%r9
+  800c91:	78 36                	js     800cc9 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800c93:	40 0f b6 c6          	movzbl %sil,%eax
+  800c97:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800c9e:	01 01 01 
+  800ca1:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800ca5:	40 f6 c7 07          	test   $0x7,%dil
+  800ca9:	75 38                	jne    800ce3 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800cab:	4c 89 c9             	mov    %r9,%rcx
+  800cae:	48 c1 f9 03          	sar    $0x3,%rcx
+  800cb2:	74 0c                	je     800cc0 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800cb4:	fc                   	cld
+  800cb5:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800cb8:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800cbc:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800cc0:	4d 85 c9             	test   %r9,%r9
+  800cc3:	75 45                	jne    800d0a <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800cc5:	4c 89 c0             	mov    %r8,%rax
+  800cc8:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800cc9:	48 85 d2             	test   %rdx,%rdx
+  800ccc:	74 f7                	je     800cc5 <memset+0x46>
+  800cce:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800cd1:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800cd4:	48 83 c0 01          	add    $0x1,%rax
+  800cd8:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  800cdc:	48 39 c2             	cmp    %rax,%rdx
+  800cdf:	75 f3                	jne    800cd4 <memset+0x55>
+  800ce1:	eb e2                	jmp    800cc5 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  800ce3:	40 f6 c7 01          	test   $0x1,%dil
+  800ce7:	74 06                	je     800cef <memset+0x70>
+  800ce9:	88 07                	mov    %al,(%rdi)
+  800ceb:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800cef:	40 f6 c7 02          	test   $0x2,%dil
+  800cf3:	74 07                	je     800cfc <memset+0x7d>
+  800cf5:	66 89 07             	mov    %ax,(%rdi)
+  800cf8:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800cfc:	40 f6 c7 04          	test   $0x4,%dil
+  800d00:	74 a9                	je     800cab <memset+0x2c>
+  800d02:	89 07                	mov    %eax,(%rdi)
+  800d04:	48 83 c7 04          	add    $0x4,%rdi
+  800d08:	eb a1                	jmp    800cab <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800d0a:	41 f6 c1 04          	test   $0x4,%r9b
+  800d0e:	74 06                	je     800d16 <memset+0x97>
+  800d10:	89 07                	mov    %eax,(%rdi)
+  800d12:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800d16:	41 f6 c1 02          	test   $0x2,%r9b
+  800d1a:	74 07                	je     800d23 <memset+0xa4>
+  800d1c:	66 89 07             	mov    %ax,(%rdi)
+  800d1f:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  800d23:	41 f6 c1 01          	test   $0x1,%r9b
+  800d27:	74 9c                	je     800cc5 <memset+0x46>
+  800d29:	88 07                	mov    %al,(%rdi)
+  800d2b:	eb 98                	jmp    800cc5 <memset+0x46>
+
+0000000000800d2d <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  800d2d:	48 89 f8             	mov    %rdi,%rax
+  800d30:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  800d33:	48 39 fe             	cmp    %rdi,%rsi
+  800d36:	73 3b                	jae    800d73 <memmove+0x46>
+  800d38:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  800d3c:	48 39 d7             	cmp    %rdx,%rdi
+  800d3f:	73 32                	jae    800d73 <memmove+0x46>
+        s += n;
+        d += n;
+  800d41:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800d45:	48 89 d6             	mov    %rdx,%rsi
+  800d48:	48 09 fe             	or     %rdi,%rsi
+  800d4b:	48 09 ce             	or     %rcx,%rsi
+  800d4e:	40 f6 c6 07          	test   $0x7,%sil
+  800d52:	75 12                	jne    800d66 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  800d54:	48 83 ef 08          	sub    $0x8,%rdi
+  800d58:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  800d5c:	48 c1 e9 03          	shr    $0x3,%rcx
+  800d60:	fd                   	std
+  800d61:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  800d64:	fc                   	cld
+  800d65:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  800d66:	48 83 ef 01          	sub    $0x1,%rdi
+  800d6a:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  800d6e:	fd                   	std
+  800d6f:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  800d71:	eb f1                	jmp    800d64 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800d73:	48 89 f2             	mov    %rsi,%rdx
+  800d76:	48 09 c2             	or     %rax,%rdx
+  800d79:	48 09 ca             	or     %rcx,%rdx
+  800d7c:	f6 c2 07             	test   $0x7,%dl
+  800d7f:	75 0c                	jne    800d8d <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  800d81:	48 c1 e9 03          	shr    $0x3,%rcx
+  800d85:	48 89 c7             	mov    %rax,%rdi
+  800d88:	fc                   	cld
+  800d89:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  800d8c:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  800d8d:	48 89 c7             	mov    %rax,%rdi
+  800d90:	fc                   	cld
+  800d91:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  800d93:	c3                   	ret
+
+0000000000800d94 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  800d94:	55                   	push   %rbp
+  800d95:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  800d98:	48 b8 2d 0d 80 00 00 	movabs $0x800d2d,%rax
+  800d9f:	00 00 00 
+  800da2:	ff d0                	call   *%rax
+}
+  800da4:	5d                   	pop    %rbp
+  800da5:	c3                   	ret
+
+0000000000800da6 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  800da6:	55                   	push   %rbp
+  800da7:	48 89 e5             	mov    %rsp,%rbp
+  800daa:	41 57                	push   %r15
+  800dac:	41 56                	push   %r14
+  800dae:	41 55                	push   %r13
+  800db0:	41 54                	push   %r12
+  800db2:	53                   	push   %rbx
+  800db3:	48 83 ec 08          	sub    $0x8,%rsp
+  800db7:	49 89 fe             	mov    %rdi,%r14
+  800dba:	49 89 f7             	mov    %rsi,%r15
+  800dbd:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  800dc0:	48 89 f7             	mov    %rsi,%rdi
+  800dc3:	48 b8 f5 0a 80 00 00 	movabs $0x800af5,%rax
+  800dca:	00 00 00 
+  800dcd:	ff d0                	call   *%rax
+  800dcf:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  800dd2:	48 89 de             	mov    %rbx,%rsi
+  800dd5:	4c 89 f7             	mov    %r14,%rdi
+  800dd8:	48 b8 10 0b 80 00 00 	movabs $0x800b10,%rax
+  800ddf:	00 00 00 
+  800de2:	ff d0                	call   *%rax
+  800de4:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  800de7:	48 39 c3             	cmp    %rax,%rbx
+  800dea:	74 36                	je     800e22 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  800dec:	48 89 d8             	mov    %rbx,%rax
+  800def:	4c 29 e8             	sub    %r13,%rax
+  800df2:	49 39 c4             	cmp    %rax,%r12
+  800df5:	73 31                	jae    800e28 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  800df7:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  800dfc:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800e00:	4c 89 fe             	mov    %r15,%rsi
+  800e03:	48 b8 94 0d 80 00 00 	movabs $0x800d94,%rax
+  800e0a:	00 00 00 
+  800e0d:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  800e0f:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  800e13:	48 83 c4 08          	add    $0x8,%rsp
+  800e17:	5b                   	pop    %rbx
+  800e18:	41 5c                	pop    %r12
+  800e1a:	41 5d                	pop    %r13
+  800e1c:	41 5e                	pop    %r14
+  800e1e:	41 5f                	pop    %r15
+  800e20:	5d                   	pop    %rbp
+  800e21:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  800e22:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800e26:	eb eb                	jmp    800e13 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  800e28:	48 83 eb 01          	sub    $0x1,%rbx
+  800e2c:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800e30:	48 89 da             	mov    %rbx,%rdx
+  800e33:	4c 89 fe             	mov    %r15,%rsi
+  800e36:	48 b8 94 0d 80 00 00 	movabs $0x800d94,%rax
+  800e3d:	00 00 00 
+  800e40:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  800e42:	49 01 de             	add    %rbx,%r14
+  800e45:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  800e4a:	eb c3                	jmp    800e0f <strlcat+0x69>
+
+0000000000800e4c <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  800e4c:	48 85 d2             	test   %rdx,%rdx
+  800e4f:	74 2d                	je     800e7e <memcmp+0x32>
+  800e51:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  800e56:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800e5a:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  800e5f:	44 38 c1             	cmp    %r8b,%cl
+  800e62:	75 0f                	jne    800e73 <memcmp+0x27>
+    while (n-- > 0) {
+  800e64:	48 83 c0 01          	add    $0x1,%rax
+  800e68:	48 39 c2             	cmp    %rax,%rdx
+  800e6b:	75 e9                	jne    800e56 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  800e6d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e72:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  800e73:	0f b6 c1             	movzbl %cl,%eax
+  800e76:	45 0f b6 c0          	movzbl %r8b,%r8d
+  800e7a:	44 29 c0             	sub    %r8d,%eax
+  800e7d:	c3                   	ret
+    return 0;
+  800e7e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800e83:	c3                   	ret
+
+0000000000800e84 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  800e84:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  800e88:	48 39 c7             	cmp    %rax,%rdi
+  800e8b:	73 0f                	jae    800e9c <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  800e8d:	40 38 37             	cmp    %sil,(%rdi)
+  800e90:	74 0e                	je     800ea0 <memfind+0x1c>
+    for (; src < end; src++) {
+  800e92:	48 83 c7 01          	add    $0x1,%rdi
+  800e96:	48 39 f8             	cmp    %rdi,%rax
+  800e99:	75 f2                	jne    800e8d <memfind+0x9>
+  800e9b:	c3                   	ret
+  800e9c:	48 89 f8             	mov    %rdi,%rax
+  800e9f:	c3                   	ret
+  800ea0:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  800ea3:	c3                   	ret
+
+0000000000800ea4 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  800ea4:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  800ea7:	0f b6 37             	movzbl (%rdi),%esi
+  800eaa:	40 80 fe 20          	cmp    $0x20,%sil
+  800eae:	74 06                	je     800eb6 <strtol+0x12>
+  800eb0:	40 80 fe 09          	cmp    $0x9,%sil
+  800eb4:	75 13                	jne    800ec9 <strtol+0x25>
+  800eb6:	48 83 c7 01          	add    $0x1,%rdi
+  800eba:	0f b6 37             	movzbl (%rdi),%esi
+  800ebd:	40 80 fe 20          	cmp    $0x20,%sil
+  800ec1:	74 f3                	je     800eb6 <strtol+0x12>
+  800ec3:	40 80 fe 09          	cmp    $0x9,%sil
+  800ec7:	74 ed                	je     800eb6 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  800ec9:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  800ecc:	83 e0 fd             	and    $0xfffffffd,%eax
+  800ecf:	3c 01                	cmp    $0x1,%al
+  800ed1:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  800ed5:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  800edb:	75 0f                	jne    800eec <strtol+0x48>
+  800edd:	80 3f 30             	cmpb   $0x30,(%rdi)
+  800ee0:	74 14                	je     800ef6 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  800ee2:	85 d2                	test   %edx,%edx
+  800ee4:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800ee9:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  800eec:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  800ef1:	4c 63 ca             	movslq %edx,%r9
+  800ef4:	eb 36                	jmp    800f2c <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  800ef6:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  800efa:	74 0f                	je     800f0b <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  800efc:	85 d2                	test   %edx,%edx
+  800efe:	75 ec                	jne    800eec <strtol+0x48>
+        s++;
+  800f00:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  800f04:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  800f09:	eb e1                	jmp    800eec <strtol+0x48>
+        s += 2;
+  800f0b:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  800f0f:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  800f14:	eb d6                	jmp    800eec <strtol+0x48>
+            dig -= '0';
+  800f16:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  800f19:	44 0f b6 c1          	movzbl %cl,%r8d
+  800f1d:	41 39 d0             	cmp    %edx,%r8d
+  800f20:	7d 21                	jge    800f43 <strtol+0x9f>
+        val = val * base + dig;
+  800f22:	49 0f af c1          	imul   %r9,%rax
+  800f26:	0f b6 c9             	movzbl %cl,%ecx
+  800f29:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  800f2c:	48 83 c7 01          	add    $0x1,%rdi
+  800f30:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  800f34:	80 f9 39             	cmp    $0x39,%cl
+  800f37:	76 dd                	jbe    800f16 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  800f39:	80 f9 7b             	cmp    $0x7b,%cl
+  800f3c:	77 05                	ja     800f43 <strtol+0x9f>
+            dig -= 'a' - 10;
+  800f3e:	83 e9 57             	sub    $0x57,%ecx
+  800f41:	eb d6                	jmp    800f19 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  800f43:	4d 85 d2             	test   %r10,%r10
+  800f46:	74 03                	je     800f4b <strtol+0xa7>
+  800f48:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  800f4b:	48 89 c2             	mov    %rax,%rdx
+  800f4e:	48 f7 da             	neg    %rdx
+  800f51:	40 80 fe 2d          	cmp    $0x2d,%sil
+  800f55:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  800f59:	c3                   	ret
+
+0000000000800f5a <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  800f5a:	55                   	push   %rbp
+  800f5b:	48 89 e5             	mov    %rsp,%rbp
+  800f5e:	53                   	push   %rbx
+  800f5f:	48 89 fa             	mov    %rdi,%rdx
+  800f62:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  800f65:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800f6a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f6f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800f74:	be 00 00 00 00       	mov    $0x0,%esi
+  800f79:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800f7f:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  800f81:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800f85:	c9                   	leave
+  800f86:	c3                   	ret
+
+0000000000800f87 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  800f87:	55                   	push   %rbp
+  800f88:	48 89 e5             	mov    %rsp,%rbp
+  800f8b:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  800f8c:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800f91:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f96:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800f9b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fa0:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800fa5:	be 00 00 00 00       	mov    $0x0,%esi
+  800faa:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800fb0:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  800fb2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800fb6:	c9                   	leave
+  800fb7:	c3                   	ret
+
+0000000000800fb8 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  800fb8:	55                   	push   %rbp
+  800fb9:	48 89 e5             	mov    %rsp,%rbp
+  800fbc:	53                   	push   %rbx
+  800fbd:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  800fc1:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800fc4:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800fc9:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800fce:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fd3:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800fd8:	be 00 00 00 00       	mov    $0x0,%esi
+  800fdd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800fe3:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800fe5:	48 85 c0             	test   %rax,%rax
+  800fe8:	7f 06                	jg     800ff0 <sys_env_destroy+0x38>
+}
+  800fea:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800fee:	c9                   	leave
+  800fef:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800ff0:	49 89 c0             	mov    %rax,%r8
+  800ff3:	b9 03 00 00 00       	mov    $0x3,%ecx
+  800ff8:	48 ba 30 35 80 00 00 	movabs $0x803530,%rdx
+  800fff:	00 00 00 
+  801002:	be 26 00 00 00       	mov    $0x26,%esi
+  801007:	48 bf 4f 35 80 00 00 	movabs $0x80354f,%rdi
+  80100e:	00 00 00 
+  801011:	b8 00 00 00 00       	mov    $0x0,%eax
+  801016:	49 b9 53 2d 80 00 00 	movabs $0x802d53,%r9
+  80101d:	00 00 00 
+  801020:	41 ff d1             	call   *%r9
+
+0000000000801023 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  801023:	55                   	push   %rbp
+  801024:	48 89 e5             	mov    %rsp,%rbp
+  801027:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801028:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80102d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801032:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801037:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80103c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801041:	be 00 00 00 00       	mov    $0x0,%esi
+  801046:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80104c:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  80104e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801052:	c9                   	leave
+  801053:	c3                   	ret
+
+0000000000801054 <sys_yield>:
+
+void
+sys_yield(void) {
+  801054:	55                   	push   %rbp
+  801055:	48 89 e5             	mov    %rsp,%rbp
+  801058:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801059:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80105e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801063:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801068:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80106d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801072:	be 00 00 00 00       	mov    $0x0,%esi
+  801077:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80107d:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  80107f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801083:	c9                   	leave
+  801084:	c3                   	ret
+
+0000000000801085 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  801085:	55                   	push   %rbp
+  801086:	48 89 e5             	mov    %rsp,%rbp
+  801089:	53                   	push   %rbx
+  80108a:	48 89 fa             	mov    %rdi,%rdx
+  80108d:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801090:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801095:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  80109c:	00 00 00 
+  80109f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8010a4:	be 00 00 00 00       	mov    $0x0,%esi
+  8010a9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8010af:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  8010b1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8010b5:	c9                   	leave
+  8010b6:	c3                   	ret
+
+00000000008010b7 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  8010b7:	55                   	push   %rbp
+  8010b8:	48 89 e5             	mov    %rsp,%rbp
+  8010bb:	53                   	push   %rbx
+  8010bc:	49 89 f8             	mov    %rdi,%r8
+  8010bf:	48 89 d3             	mov    %rdx,%rbx
+  8010c2:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8010c5:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8010ca:	4c 89 c2             	mov    %r8,%rdx
+  8010cd:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8010d0:	be 00 00 00 00       	mov    $0x0,%esi
+  8010d5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8010db:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  8010dd:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8010e1:	c9                   	leave
+  8010e2:	c3                   	ret
+
+00000000008010e3 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  8010e3:	55                   	push   %rbp
+  8010e4:	48 89 e5             	mov    %rsp,%rbp
+  8010e7:	53                   	push   %rbx
+  8010e8:	48 83 ec 08          	sub    $0x8,%rsp
+  8010ec:	89 f8                	mov    %edi,%eax
+  8010ee:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  8010f1:	48 63 f9             	movslq %ecx,%rdi
+  8010f4:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8010f7:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8010fc:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8010ff:	be 00 00 00 00       	mov    $0x0,%esi
+  801104:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80110a:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80110c:	48 85 c0             	test   %rax,%rax
+  80110f:	7f 06                	jg     801117 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  801111:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801115:	c9                   	leave
+  801116:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801117:	49 89 c0             	mov    %rax,%r8
+  80111a:	b9 04 00 00 00       	mov    $0x4,%ecx
+  80111f:	48 ba 30 35 80 00 00 	movabs $0x803530,%rdx
+  801126:	00 00 00 
+  801129:	be 26 00 00 00       	mov    $0x26,%esi
+  80112e:	48 bf 4f 35 80 00 00 	movabs $0x80354f,%rdi
+  801135:	00 00 00 
+  801138:	b8 00 00 00 00       	mov    $0x0,%eax
+  80113d:	49 b9 53 2d 80 00 00 	movabs $0x802d53,%r9
+  801144:	00 00 00 
+  801147:	41 ff d1             	call   *%r9
+
+000000000080114a <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  80114a:	55                   	push   %rbp
+  80114b:	48 89 e5             	mov    %rsp,%rbp
+  80114e:	53                   	push   %rbx
+  80114f:	48 83 ec 08          	sub    $0x8,%rsp
+  801153:	89 f8                	mov    %edi,%eax
+  801155:	49 89 f2             	mov    %rsi,%r10
+  801158:	48 89 cf             	mov    %rcx,%rdi
+  80115b:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  80115e:	48 63 da             	movslq %edx,%rbx
+  801161:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801164:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801169:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80116c:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  80116f:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801171:	48 85 c0             	test   %rax,%rax
+  801174:	7f 06                	jg     80117c <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  801176:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80117a:	c9                   	leave
+  80117b:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80117c:	49 89 c0             	mov    %rax,%r8
+  80117f:	b9 05 00 00 00       	mov    $0x5,%ecx
+  801184:	48 ba 30 35 80 00 00 	movabs $0x803530,%rdx
+  80118b:	00 00 00 
+  80118e:	be 26 00 00 00       	mov    $0x26,%esi
+  801193:	48 bf 4f 35 80 00 00 	movabs $0x80354f,%rdi
+  80119a:	00 00 00 
+  80119d:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011a2:	49 b9 53 2d 80 00 00 	movabs $0x802d53,%r9
+  8011a9:	00 00 00 
+  8011ac:	41 ff d1             	call   *%r9
+
+00000000008011af <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  8011af:	55                   	push   %rbp
+  8011b0:	48 89 e5             	mov    %rsp,%rbp
+  8011b3:	53                   	push   %rbx
+  8011b4:	48 83 ec 08          	sub    $0x8,%rsp
+  8011b8:	48 89 f1             	mov    %rsi,%rcx
+  8011bb:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  8011be:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8011c1:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8011c6:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8011cb:	be 00 00 00 00       	mov    $0x0,%esi
+  8011d0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8011d6:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8011d8:	48 85 c0             	test   %rax,%rax
+  8011db:	7f 06                	jg     8011e3 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  8011dd:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8011e1:	c9                   	leave
+  8011e2:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8011e3:	49 89 c0             	mov    %rax,%r8
+  8011e6:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8011eb:	48 ba 30 35 80 00 00 	movabs $0x803530,%rdx
+  8011f2:	00 00 00 
+  8011f5:	be 26 00 00 00       	mov    $0x26,%esi
+  8011fa:	48 bf 4f 35 80 00 00 	movabs $0x80354f,%rdi
+  801201:	00 00 00 
+  801204:	b8 00 00 00 00       	mov    $0x0,%eax
+  801209:	49 b9 53 2d 80 00 00 	movabs $0x802d53,%r9
+  801210:	00 00 00 
+  801213:	41 ff d1             	call   *%r9
+
+0000000000801216 <sys_region_batch>:
+
+int
+sys_region_batch(const struct RegionOp *ops, size_t count) {
+  801216:	55                   	push   %rbp
+  801217:	48 89 e5             	mov    %rsp,%rbp
+  80121a:	53                   	push   %rbx
+  80121b:	48 83 ec 08          	sub    $0x8,%rsp
+  80121f:	48 89 fa             	mov    %rdi,%rdx
+  801222:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801225:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80122a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80122f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801234:	be 00 00 00 00       	mov    $0x0,%esi
+  801239:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80123f:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801241:	48 85 c0             	test   %rax,%rax
+  801244:	7f 06                	jg     80124c <sys_region_batch+0x36>
+        else
+            platform_asan_unpoison(va, ops[i].size);
+    }
+#endif
+    return res;
+}
+  801246:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80124a:	c9                   	leave
+  80124b:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80124c:	49 89 c0             	mov    %rax,%r8
+  80124f:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  801254:	48 ba 30 35 80 00 00 	movabs $0x803530,%rdx
+  80125b:	00 00 00 
+  80125e:	be 26 00 00 00       	mov    $0x26,%esi
+  801263:	48 bf 4f 35 80 00 00 	movabs $0x80354f,%rdi
+  80126a:	00 00 00 
+  80126d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801272:	49 b9 53 2d 80 00 00 	movabs $0x802d53,%r9
+  801279:	00 00 00 
+  80127c:	41 ff d1             	call   *%r9
+
+000000000080127f <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  80127f:	55                   	push   %rbp
+  801280:	48 89 e5             	mov    %rsp,%rbp
+  801283:	53                   	push   %rbx
+  801284:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  801288:	48 63 ce             	movslq %esi,%rcx
+  80128b:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80128e:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801293:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801298:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80129d:	be 00 00 00 00       	mov    $0x0,%esi
+  8012a2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8012a8:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8012aa:	48 85 c0             	test   %rax,%rax
+  8012ad:	7f 06                	jg     8012b5 <sys_env_set_status+0x36>
+}
+  8012af:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012b3:	c9                   	leave
+  8012b4:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8012b5:	49 89 c0             	mov    %rax,%r8
+  8012b8:	b9 09 00 00 00       	mov    $0x9,%ecx
+  8012bd:	48 ba 30 35 80 00 00 	movabs $0x803530,%rdx
+  8012c4:	00 00 00 
+  8012c7:	be 26 00 00 00       	mov    $0x26,%esi
+  8012cc:	48 bf 4f 35 80 00 00 	movabs $0x80354f,%rdi
+  8012d3:	00 00 00 
+  8012d6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012db:	49 b9 53 2d 80 00 00 	movabs $0x802d53,%r9
+  8012e2:	00 00 00 
+  8012e5:	41 ff d1             	call   *%r9
+
+00000000008012e8 <sys_env_set_weight>:
+
+int
+sys_env_set_weight(envid_t envid, uint32_t weight) {
+  8012e8:	55                   	push   %rbp
+  8012e9:	48 89 e5             	mov    %rsp,%rbp
+  8012ec:	53                   	push   %rbx
+  8012ed:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_weight, 1, envid, weight, 0, 0, 0, 0);
+  8012f1:	89 f1                	mov    %esi,%ecx
+  8012f3:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8012f6:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8012fb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801300:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801305:	be 00 00 00 00       	mov    $0x0,%esi
+  80130a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801310:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801312:	48 85 c0             	test   %rax,%rax
+  801315:	7f 06                	jg     80131d <sys_env_set_weight+0x35>
+}
+  801317:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80131b:	c9                   	leave
+  80131c:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80131d:	49 89 c0             	mov    %rax,%r8
+  801320:	b9 10 00 00 00       	mov    $0x10,%ecx
+  801325:	48 ba 30 35 80 00 00 	movabs $0x803530,%rdx
+  80132c:	00 00 00 
+  80132f:	be 26 00 00 00       	mov    $0x26,%esi
+  801334:	48 bf 4f 35 80 00 00 	movabs $0x80354f,%rdi
+  80133b:	00 00 00 
+  80133e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801343:	49 b9 53 2d 80 00 00 	movabs $0x802d53,%r9
+  80134a:	00 00 00 
+  80134d:	41 ff d1             	call   *%r9
+
+0000000000801350 <sys_env_set_rt>:
+
+int
+sys_env_set_rt(envid_t envid, uint64_t period, uint64_t budget, uint64_t deadline) {
+  801350:	55                   	push   %rbp
+  801351:	48 89 e5             	mov    %rsp,%rbp
+  801354:	53                   	push   %rbx
+  801355:	48 83 ec 08          	sub    $0x8,%rsp
+  801359:	89 f8                	mov    %edi,%eax
+  80135b:	48 89 d3             	mov    %rdx,%rbx
+  80135e:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_env_set_rt, 1, envid, period, budget, deadline, 0, 0);
+  801361:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801364:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801369:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80136c:	be 00 00 00 00       	mov    $0x0,%esi
+  801371:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801377:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801379:	48 85 c0             	test   %rax,%rax
+  80137c:	7f 06                	jg     801384 <sys_env_set_rt+0x34>
+}
+  80137e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801382:	c9                   	leave
+  801383:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801384:	49 89 c0             	mov    %rax,%r8
+  801387:	b9 11 00 00 00       	mov    $0x11,%ecx
+  80138c:	48 ba 30 35 80 00 00 	movabs $0x803530,%rdx
+  801393:	00 00 00 
+  801396:	be 26 00 00 00       	mov    $0x26,%esi
+  80139b:	48 bf 4f 35 80 00 00 	movabs $0x80354f,%rdi
+  8013a2:	00 00 00 
+  8013a5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013aa:	49 b9 53 2d 80 00 00 	movabs $0x802d53,%r9
+  8013b1:	00 00 00 
+  8013b4:	41 ff d1             	call   *%r9
+
+00000000008013b7 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  8013b7:	55                   	push   %rbp
+  8013b8:	48 89 e5             	mov    %rsp,%rbp
+  8013bb:	53                   	push   %rbx
+  8013bc:	48 83 ec 08          	sub    $0x8,%rsp
+  8013c0:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  8013c3:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8013c6:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8013cb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013d0:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013d5:	be 00 00 00 00       	mov    $0x0,%esi
+  8013da:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013e0:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8013e2:	48 85 c0             	test   %rax,%rax
+  8013e5:	7f 06                	jg     8013ed <sys_env_set_trapframe+0x36>
+}
+  8013e7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013eb:	c9                   	leave
+  8013ec:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8013ed:	49 89 c0             	mov    %rax,%r8
+  8013f0:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  8013f5:	48 ba 30 35 80 00 00 	movabs $0x803530,%rdx
+  8013fc:	00 00 00 
+  8013ff:	be 26 00 00 00       	mov    $0x26,%esi
+  801404:	48 bf 4f 35 80 00 00 	movabs $0x80354f,%rdi
+  80140b:	00 00 00 
+  80140e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801413:	49 b9 53 2d 80 00 00 	movabs $0x802d53,%r9
+  80141a:	00 00 00 
+  80141d:	41 ff d1             	call   *%r9
+
+0000000000801420 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  801420:	55                   	push   %rbp
+  801421:	48 89 e5             	mov    %rsp,%rbp
+  801424:	53                   	push   %rbx
+  801425:	48 83 ec 08          	sub    $0x8,%rsp
+  801429:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  80142c:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80142f:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801434:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801439:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80143e:	be 00 00 00 00       	mov    $0x0,%esi
+  801443:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801449:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80144b:	48 85 c0             	test   %rax,%rax
+  80144e:	7f 06                	jg     801456 <sys_env_set_pgfault_upcall+0x36>
+}
+  801450:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801454:	c9                   	leave
+  801455:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801456:	49 89 c0             	mov    %rax,%r8
+  801459:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  80145e:	48 ba 30 35 80 00 00 	movabs $0x803530,%rdx
+  801465:	00 00 00 
+  801468:	be 26 00 00 00       	mov    $0x26,%esi
+  80146d:	48 bf 4f 35 80 00 00 	movabs $0x80354f,%rdi
+  801474:	00 00 00 
+  801477:	b8 00 00 00 00       	mov    $0x0,%eax
+  80147c:	49 b9 53 2d 80 00 00 	movabs $0x802d53,%r9
+  801483:	00 00 00 
+  801486:	41 ff d1             	call   *%r9
+
+0000000000801489 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  801489:	55                   	push   %rbp
+  80148a:	48 89 e5             	mov    %rsp,%rbp
+  80148d:	53                   	push   %rbx
+  80148e:	89 f8                	mov    %edi,%eax
+  801490:	49 89 f1             	mov    %rsi,%r9
+  801493:	48 89 d3             	mov    %rdx,%rbx
+  801496:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  801499:	49 63 f0             	movslq %r8d,%rsi
+  80149c:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80149f:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8014a4:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014a7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014ad:	cd 30                	int    $0x30
+}
+  8014af:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014b3:	c9                   	leave
+  8014b4:	c3                   	ret
+
+00000000008014b5 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  8014b5:	55                   	push   %rbp
+  8014b6:	48 89 e5             	mov    %rsp,%rbp
+  8014b9:	53                   	push   %rbx
+  8014ba:	48 83 ec 08          	sub    $0x8,%rsp
+  8014be:	48 89 fa             	mov    %rdi,%rdx
+  8014c1:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8014c4:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8014c9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014ce:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014d3:	be 00 00 00 00       	mov    $0x0,%esi
+  8014d8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014de:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8014e0:	48 85 c0             	test   %rax,%rax
+  8014e3:	7f 06                	jg     8014eb <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8014e5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014e9:	c9                   	leave
+  8014ea:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8014eb:	49 89 c0             	mov    %rax,%r8
+  8014ee:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  8014f3:	48 ba 30 35 80 00 00 	movabs $0x803530,%rdx
+  8014fa:	00 00 00 
+  8014fd:	be 26 00 00 00       	mov    $0x26,%esi
+  801502:	48 bf 4f 35 80 00 00 	movabs $0x80354f,%rdi
+  801509:	00 00 00 
+  80150c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801511:	49 b9 53 2d 80 00 00 	movabs $0x802d53,%r9
+  801518:	00 00 00 
+  80151b:	41 ff d1             	call   *%r9
+
+000000000080151e <_handle_vectored_pagefault>:
+/* Vector size */
+static size_t _pfhandler_off = 0;
+static bool _pfhandler_inititiallized = 0;
+
+void
+_handle_vectored_pagefault(struct UTrapframe *utf) {
+  80151e:	55                   	push   %rbp
+  80151f:	48 89 e5             	mov    %rsp,%rbp
+  801522:	41 56                	push   %r14
+  801524:	41 55                	push   %r13
+  801526:	41 54                	push   %r12
+  801528:	53                   	push   %rbx
+  801529:	49 89 fc             	mov    %rdi,%r12
+    /* This trying to handle pagefault until
+     * some handler returns 1, that indicates
+     * successfully handled exception */
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80152c:	48 b8 68 50 80 00 00 	movabs $0x805068,%rax
+  801533:	00 00 00 
+  801536:	48 83 38 00          	cmpq   $0x0,(%rax)
+  80153a:	74 27                	je     801563 <_handle_vectored_pagefault+0x45>
+  80153c:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (_pfhandler_vec[i](utf)) return;
+  801541:	49 bd 20 50 80 00 00 	movabs $0x805020,%r13
+  801548:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80154b:	49 89 c6             	mov    %rax,%r14
+        if (_pfhandler_vec[i](utf)) return;
+  80154e:	4c 89 e7             	mov    %r12,%rdi
+  801551:	41 ff 54 dd 00       	call   *0x0(%r13,%rbx,8)
+  801556:	84 c0                	test   %al,%al
+  801558:	75 45                	jne    80159f <_handle_vectored_pagefault+0x81>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80155a:	48 83 c3 01          	add    $0x1,%rbx
+  80155e:	49 3b 1e             	cmp    (%r14),%rbx
+  801561:	72 eb                	jb     80154e <_handle_vectored_pagefault+0x30>
+
+    /* Unhandled exceptions just cause panic */
+    panic("Userspace page fault rip=%08lX va=%08lX err=%x\n",
+  801563:	49 8b 8c 24 88 00 00 	mov    0x88(%r12),%rcx
+  80156a:	00 
+  80156b:	45 8b 4c 24 08       	mov    0x8(%r12),%r9d
+  801570:	4d 8b 04 24          	mov    (%r12),%r8
+  801574:	48 ba 60 35 80 00 00 	movabs $0x803560,%rdx
+  80157b:	00 00 00 
+  80157e:	be 1d 00 00 00       	mov    $0x1d,%esi
+  801583:	48 bf 90 35 80 00 00 	movabs $0x803590,%rdi
+  80158a:	00 00 00 
+  80158d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801592:	49 ba 53 2d 80 00 00 	movabs $0x802d53,%r10
+  801599:	00 00 00 
+  80159c:	41 ff d2             	call   *%r10
+          utf->utf_rip, utf->utf_fault_va, (int)utf->utf_err);
+}
+  80159f:	5b                   	pop    %rbx
+  8015a0:	41 5c                	pop    %r12
+  8015a2:	41 5d                	pop    %r13
+  8015a4:	41 5e                	pop    %r14
+  8015a6:	5d                   	pop    %rbp
+  8015a7:	c3                   	ret
+
+00000000008015a8 <add_pgfault_handler>:
+ * The first time we register a handler, we need to
+ * allocate an exception stack (one page of memory with its top
+ * at USER_EXCEPTION_STACK_TOP), and tell the kernel to call the assembly-language
+ * _pgfault_upcall routine when a page fault occurs. */
+int
+add_pgfault_handler(pf_handler_t handler) {
+  8015a8:	55                   	push   %rbp
+  8015a9:	48 89 e5             	mov    %rsp,%rbp
+  8015ac:	53                   	push   %rbx
+  8015ad:	48 83 ec 08          	sub    $0x8,%rsp
+  8015b1:	48 89 fb             	mov    %rdi,%rbx
+    int res = 0;
+  8015b4:	be 00 00 00 00       	mov    $0x0,%esi
+    if (!_pfhandler_inititiallized) {
+  8015b9:	48 b8 60 50 80 00 00 	movabs $0x805060,%rax
+  8015c0:	00 00 00 
+  8015c3:	80 38 00             	cmpb   $0x0,(%rax)
+  8015c6:	74 68                	je     801630 <add_pgfault_handler+0x88>
+            goto end;
+        }
+        _pfhandler_inititiallized = 1;
+    }
+
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8015c8:	48 b8 68 50 80 00 00 	movabs $0x805068,%rax
+  8015cf:	00 00 00 
+  8015d2:	48 8b 08             	mov    (%rax),%rcx
+  8015d5:	ba 00 00 00 00       	mov    $0x0,%edx
+        if (handler == _pfhandler_vec[i]) return 0;
+  8015da:	48 b8 20 50 80 00 00 	movabs $0x805020,%rax
+  8015e1:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8015e4:	48 85 c9             	test   %rcx,%rcx
+  8015e7:	0f 84 e0 00 00 00    	je     8016cd <add_pgfault_handler+0x125>
+        if (handler == _pfhandler_vec[i]) return 0;
+  8015ed:	48 39 1c d0          	cmp    %rbx,(%rax,%rdx,8)
+  8015f1:	0f 84 c9 00 00 00    	je     8016c0 <add_pgfault_handler+0x118>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8015f7:	48 83 c2 01          	add    $0x1,%rdx
+  8015fb:	48 39 ca             	cmp    %rcx,%rdx
+  8015fe:	75 ed                	jne    8015ed <add_pgfault_handler+0x45>
+
+    if (_pfhandler_off == MAX_PFHANDLER)
+  801600:	48 83 f9 08          	cmp    $0x8,%rcx
+  801604:	0f 84 84 00 00 00    	je     80168e <add_pgfault_handler+0xe6>
+        res = -E_INVAL;
+    else
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  80160a:	48 8d 41 01          	lea    0x1(%rcx),%rax
+  80160e:	48 a3 68 50 80 00 00 	movabs %rax,0x805068
+  801615:	00 00 00 
+  801618:	48 b8 20 50 80 00 00 	movabs $0x805020,%rax
+  80161f:	00 00 00 
+  801622:	48 89 1c c8          	mov    %rbx,(%rax,%rcx,8)
+
+end:
+    if (res < 0) {
+  801626:	85 f6                	test   %esi,%esi
+  801628:	0f 89 97 00 00 00    	jns    8016c5 <add_pgfault_handler+0x11d>
+  80162e:	eb 63                	jmp    801693 <add_pgfault_handler+0xeb>
+        res = sys_alloc_region(0, (void*)(USER_EXCEPTION_STACK_TOP - USER_EXCEPTION_STACK_SIZE),
+  801630:	b9 06 00 10 00       	mov    $0x100006,%ecx
+  801635:	ba 00 80 00 00       	mov    $0x8000,%edx
+  80163a:	48 be 00 80 ff ff 7f 	movabs $0x7fffff8000,%rsi
+  801641:	00 00 00 
+  801644:	bf 00 00 00 00       	mov    $0x0,%edi
+  801649:	48 b8 e3 10 80 00 00 	movabs $0x8010e3,%rax
+  801650:	00 00 00 
+  801653:	ff d0                	call   *%rax
+  801655:	89 c6                	mov    %eax,%esi
+        if (res < 0) {
+  801657:	85 c0                	test   %eax,%eax
+  801659:	78 38                	js     801693 <add_pgfault_handler+0xeb>
+        res = sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  80165b:	48 be a9 17 80 00 00 	movabs $0x8017a9,%rsi
+  801662:	00 00 00 
+  801665:	bf 00 00 00 00       	mov    $0x0,%edi
+  80166a:	48 b8 20 14 80 00 00 	movabs $0x801420,%rax
+  801671:	00 00 00 
+  801674:	ff d0                	call   *%rax
+  801676:	89 c6                	mov    %eax,%esi
+        if (res < 0) {
+  801678:	85 c0                	test   %eax,%eax
+  80167a:	78 17                	js     801693 <add_pgfault_handler+0xeb>
+        _pfhandler_inititiallized = 1;
+  80167c:	48 b8 60 50 80 00 00 	movabs $0x805060,%rax
+  801683:	00 00 00 
+  801686:	c6 00 01             	movb   $0x1,(%rax)
+  801689:	e9 3a ff ff ff       	jmp    8015c8 <add_pgfault_handler+0x20>
+        res = -E_INVAL;
+  80168e:	be fd ff ff ff       	mov    $0xfffffffd,%esi
+        panic("set_pgfault_handler: %i", res);
+  801693:	89 f1                	mov    %esi,%ecx
+  801695:	48 ba 9e 35 80 00 00 	movabs $0x80359e,%rdx
+  80169c:	00 00 00 
+  80169f:	be 43 00 00 00       	mov    $0x43,%esi
+  8016a4:	48 bf 90 35 80 00 00 	movabs $0x803590,%rdi
+  8016ab:	00 00 00 
+  8016ae:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016b3:	49 b8 53 2d 80 00 00 	movabs $0x802d53,%r8
+  8016ba:	00 00 00 
+  8016bd:	41 ff d0             	call   *%r8
+        if (handler == _pfhandler_vec[i]) return 0;
+  8016c0:	be 00 00 00 00       	mov    $0x0,%esi
+    }
+    return res;
+}
+  8016c5:	89 f0                	mov    %esi,%eax
+  8016c7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8016cb:	c9                   	leave
+  8016cc:	c3                   	ret
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  8016cd:	48 b8 68 50 80 00 00 	movabs $0x805068,%rax
+  8016d4:	00 00 00 
+  8016d7:	48 c7 00 01 00 00 00 	movq   $0x1,(%rax)
+  8016de:	48 89 d8             	mov    %rbx,%rax
+  8016e1:	48 a3 20 50 80 00 00 	movabs %rax,0x805020
+  8016e8:	00 00 00 
+    if (res < 0) {
+  8016eb:	eb d8                	jmp    8016c5 <add_pgfault_handler+0x11d>
+
+00000000008016ed <remove_pgfault_handler>:
+
+void
+remove_pgfault_handler(pf_handler_t handler) {
+  8016ed:	55                   	push   %rbp
+  8016ee:	48 89 e5             	mov    %rsp,%rbp
+    assert(_pfhandler_inititiallized);
+  8016f1:	48 b8 60 50 80 00 00 	movabs $0x805060,%rax
+  8016f8:	00 00 00 
+  8016fb:	80 38 00             	cmpb   $0x0,(%rax)
+  8016fe:	74 33                	je     801733 <remove_pgfault_handler+0x46>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  801700:	48 a1 68 50 80 00 00 	movabs 0x805068,%rax
+  801707:	00 00 00 
+  80170a:	b9 00 00 00 00       	mov    $0x0,%ecx
+        if (_pfhandler_vec[i] == handler) {
+  80170f:	48 ba 20 50 80 00 00 	movabs $0x805020,%rdx
+  801716:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  801719:	48 85 c0             	test   %rax,%rax
+  80171c:	0f 84 85 00 00 00    	je     8017a7 <remove_pgfault_handler+0xba>
+        if (_pfhandler_vec[i] == handler) {
+  801722:	48 39 3c ca          	cmp    %rdi,(%rdx,%rcx,8)
+  801726:	74 40                	je     801768 <remove_pgfault_handler+0x7b>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  801728:	48 83 c1 01          	add    $0x1,%rcx
+  80172c:	48 39 c1             	cmp    %rax,%rcx
+  80172f:	75 f1                	jne    801722 <remove_pgfault_handler+0x35>
+  801731:	eb 74                	jmp    8017a7 <remove_pgfault_handler+0xba>
+    assert(_pfhandler_inititiallized);
+  801733:	48 b9 b6 35 80 00 00 	movabs $0x8035b6,%rcx
+  80173a:	00 00 00 
+  80173d:	48 ba d0 35 80 00 00 	movabs $0x8035d0,%rdx
+  801744:	00 00 00 
+  801747:	be 4a 00 00 00       	mov    $0x4a,%esi
+  80174c:	48 bf 90 35 80 00 00 	movabs $0x803590,%rdi
+  801753:	00 00 00 
+  801756:	b8 00 00 00 00       	mov    $0x0,%eax
+  80175b:	49 b8 53 2d 80 00 00 	movabs $0x802d53,%r8
+  801762:	00 00 00 
+  801765:	41 ff d0             	call   *%r8
+            memmove(_pfhandler_vec + i, _pfhandler_vec + i + 1, (_pfhandler_off - i - 1) * sizeof(*handler));
+  801768:	48 8d 34 cd 08 00 00 	lea    0x8(,%rcx,8),%rsi
+  80176f:	00 
+  801770:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801774:	48 29 ca             	sub    %rcx,%rdx
+  801777:	48 b8 20 50 80 00 00 	movabs $0x805020,%rax
+  80177e:	00 00 00 
+  801781:	48 8d 0c 06          	lea    (%rsi,%rax,1),%rcx
+  801785:	48 8d 7c 30 f8       	lea    -0x8(%rax,%rsi,1),%rdi
+  80178a:	48 89 ce             	mov    %rcx,%rsi
+  80178d:	48 b8 2d 0d 80 00 00 	movabs $0x800d2d,%rax
+  801794:	00 00 00 
+  801797:	ff d0                	call   *%rax
+            _pfhandler_off--;
+  801799:	48 b8 68 50 80 00 00 	movabs $0x805068,%rax
+  8017a0:	00 00 00 
+  8017a3:	48 83 28 01          	subq   $0x1,(%rax)
+            return;
+        }
+    }
+}
+  8017a7:	5d                   	pop    %rbp
+  8017a8:	c3                   	ret
+
+00000000008017a9 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+    # Call the C page fault handler.
+    movq  %rsp,%rdi # passing the function argument in rdi
+  8017a9:	48 89 e7             	mov    %rsp,%rdi
+    movabs $_handle_vectored_pagefault, %rax
+  8017ac:	48 b8 1e 15 80 00 00 	movabs $0x80151e,%rax
+  8017b3:	00 00 00 
+    call *%rax
+  8017b6:	ff d0                	call   *%rax
+    # registers are available for intermediate calculations.  You
+    # may find that you have to rearrange your code in non-obvious
+    # ways as registers become unavailable as scratch space.
+
+    # LAB 9: Your code here
+    addq $16, %rsp
+  8017b8:	48 83 c4 10          	add    $0x10,%rsp
+	movq %rsp, %rax
+  8017bc:	48 89 e0             	mov    %rsp,%rax
+	movq 120(%rsp), %rbx
+  8017bf:	48 8b 5c 24 78       	mov    0x78(%rsp),%rbx
+	movq 136(%rsp), %rcx
+  8017c4:	48 8b 8c 24 88 00 00 	mov    0x88(%rsp),%rcx
+  8017cb:	00 
+	movq %rcx, %rsp
+  8017cc:	48 89 cc             	mov    %rcx,%rsp
+    pushq %rbx
+  8017cf:	53                   	push   %rbx
+    movq %rax, %rsp
+  8017d0:	48 89 c4             	mov    %rax,%rsp
+
+	subq $8, %rcx
+  8017d3:	48 83 e9 08          	sub    $0x8,%rcx
+	movq %rcx, 136(%rsp)
+  8017d7:	48 89 8c 24 88 00 00 	mov    %rcx,0x88(%rsp)
+  8017de:	00 
+
+    # Restore the trap-time registers.  After you do this, you
+    # can no longer modify any general-purpose registers (POPA).
+    # LAB 9: Your code here
+
+    pop %r15
+  8017df:	41 5f                	pop    %r15
+    pop %r14
+  8017e1:	41 5e                	pop    %r14
+    pop %r13
+  8017e3:	41 5d                	pop    %r13
+    pop %r12
+  8017e5:	41 5c                	pop    %r12
+    pop %r11
+  8017e7:	41 5b                	pop    %r11
+    pop %r10
+  8017e9:	41 5a                	pop    %r10
+    pop %r9
+  8017eb:	41 59                	pop    %r9
+    pop %r8
+  8017ed:	41 58                	pop    %r8
+    pop %rsi
+  8017ef:	5e                   	pop    %rsi
+    pop %rdi
+  8017f0:	5f                   	pop    %rdi
+    pop %rbp
+  8017f1:	5d                   	pop    %rbp
+    pop %rdx
+  8017f2:	5a                   	pop    %rdx
+    pop %rcx
+  8017f3:	59                   	pop    %rcx
+    pop %rbx
+  8017f4:	5b                   	pop    %rbx
+    pop %rax
+  8017f5:	58                   	pop    %rax
+    # Restore rflags from the stack.  After you do this, you can
+    # no longer use arithmetic operations or anything else that
+    # modifies rflags.
+    # LAB 9: Your code here
+
+    addq $8, %rsp
+  8017f6:	48 83 c4 08          	add    $0x8,%rsp
+    popfq
+  8017fa:	9d                   	popf
+
+    # Switch back to the adjusted trap-time stack.
+    # LAB 9: Your code here
+
+    pop %rsp
+  8017fb:	5c                   	pop    %rsp
+
+    # Return to re-execute the instruction that faulted.
+    ret
+  8017fc:	c3                   	ret
+
+00000000008017fd <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8017fd:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801804:	ff ff ff 
+  801807:	48 01 f8             	add    %rdi,%rax
+  80180a:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  80180e:	c3                   	ret
+
+000000000080180f <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80180f:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801816:	ff ff ff 
+  801819:	48 01 f8             	add    %rdi,%rax
+  80181c:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  801820:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  801826:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  80182a:	c3                   	ret
+
+000000000080182b <fd_alloc_from>:
+}
+
+/* Like fd_alloc(), but only considers fds starting from fdnum,
+ * so that several fds can be found before their pages are allocated */
+int
+fd_alloc_from(int fdnum, struct Fd **fd_store) {
+  80182b:	55                   	push   %rbp
+  80182c:	48 89 e5             	mov    %rsp,%rbp
+  80182f:	41 57                	push   %r15
+  801831:	41 56                	push   %r14
+  801833:	41 55                	push   %r13
+  801835:	41 54                	push   %r12
+  801837:	53                   	push   %rbx
+  801838:	48 83 ec 08          	sub    $0x8,%rsp
+  80183c:	49 89 f7             	mov    %rsi,%r15
+    for (int i = MAX(fdnum, 0); i < MAXFD; i++) {
+  80183f:	85 ff                	test   %edi,%edi
+  801841:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  801847:	44 0f 49 e7          	cmovns %edi,%r12d
+  80184b:	83 ff 1f             	cmp    $0x1f,%edi
+  80184e:	7f 37                	jg     801887 <fd_alloc_from+0x5c>
+  801850:	49 63 dc             	movslq %r12d,%rbx
+  801853:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  80185a:	48 c1 e3 0c          	shl    $0xc,%rbx
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  80185e:	49 be 34 29 80 00 00 	movabs $0x802934,%r14
+  801865:	00 00 00 
+        struct Fd *fd = INDEX2FD(i);
+  801868:	49 89 dd             	mov    %rbx,%r13
+        if (!(get_prot(fd) & PROT_R)) {
+  80186b:	48 89 df             	mov    %rbx,%rdi
+  80186e:	41 ff d6             	call   *%r14
+  801871:	83 e0 04             	and    $0x4,%eax
+  801874:	74 1c                	je     801892 <fd_alloc_from+0x67>
+    for (int i = MAX(fdnum, 0); i < MAXFD; i++) {
+  801876:	41 83 c4 01          	add    $0x1,%r12d
+  80187a:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801881:	41 83 fc 1f          	cmp    $0x1f,%r12d
+  801885:	7e e1                	jle    801868 <fd_alloc_from+0x3d>
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  801887:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  80188d:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  801892:	4d 89 2f             	mov    %r13,(%r15)
+}
+  801895:	48 83 c4 08          	add    $0x8,%rsp
+  801899:	5b                   	pop    %rbx
+  80189a:	41 5c                	pop    %r12
+  80189c:	41 5d                	pop    %r13
+  80189e:	41 5e                	pop    %r14
+  8018a0:	41 5f                	pop    %r15
+  8018a2:	5d                   	pop    %rbp
+  8018a3:	c3                   	ret
+
+00000000008018a4 <fd_alloc>:
+fd_alloc(struct Fd **fd_store) {
+  8018a4:	55                   	push   %rbp
+  8018a5:	48 89 e5             	mov    %rsp,%rbp
+  8018a8:	48 89 fe             	mov    %rdi,%rsi
+    return fd_alloc_from(0, fd_store);
+  8018ab:	bf 00 00 00 00       	mov    $0x0,%edi
+  8018b0:	48 b8 2b 18 80 00 00 	movabs $0x80182b,%rax
+  8018b7:	00 00 00 
+  8018ba:	ff d0                	call   *%rax
+}
+  8018bc:	5d                   	pop    %rbp
+  8018bd:	c3                   	ret
+
+00000000008018be <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  8018be:	83 ff 1f             	cmp    $0x1f,%edi
+  8018c1:	77 39                	ja     8018fc <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  8018c3:	55                   	push   %rbp
+  8018c4:	48 89 e5             	mov    %rsp,%rbp
+  8018c7:	41 54                	push   %r12
+  8018c9:	53                   	push   %rbx
+  8018ca:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  8018cd:	48 63 df             	movslq %edi,%rbx
+  8018d0:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  8018d7:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  8018db:	48 89 df             	mov    %rbx,%rdi
+  8018de:	48 b8 34 29 80 00 00 	movabs $0x802934,%rax
+  8018e5:	00 00 00 
+  8018e8:	ff d0                	call   *%rax
+  8018ea:	a8 04                	test   $0x4,%al
+  8018ec:	74 14                	je     801902 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  8018ee:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  8018f2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8018f7:	5b                   	pop    %rbx
+  8018f8:	41 5c                	pop    %r12
+  8018fa:	5d                   	pop    %rbp
+  8018fb:	c3                   	ret
+        return -E_INVAL;
+  8018fc:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801901:	c3                   	ret
+        return -E_INVAL;
+  801902:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801907:	eb ee                	jmp    8018f7 <fd_lookup+0x39>
+
+0000000000801909 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  801909:	55                   	push   %rbp
+  80190a:	48 89 e5             	mov    %rsp,%rbp
+  80190d:	41 54                	push   %r12
+  80190f:	53                   	push   %rbx
+  801910:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  801913:	48 b8 80 36 80 00 00 	movabs $0x803680,%rax
+  80191a:	00 00 00 
+  80191d:	48 bb 20 40 80 00 00 	movabs $0x804020,%rbx
+  801924:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  801927:	39 3b                	cmp    %edi,(%rbx)
+  801929:	74 47                	je     801972 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  80192b:	48 83 c0 08          	add    $0x8,%rax
+  80192f:	48 8b 18             	mov    (%rax),%rbx
+  801932:	48 85 db             	test   %rbx,%rbx
+  801935:	75 f0                	jne    801927 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801937:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  80193e:	00 00 00 
+  801941:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+  801947:	89 fa                	mov    %edi,%edx
+  801949:	48 bf e8 35 80 00 00 	movabs $0x8035e8,%rdi
+  801950:	00 00 00 
+  801953:	b8 00 00 00 00       	mov    $0x0,%eax
+  801958:	48 b9 0e 02 80 00 00 	movabs $0x80020e,%rcx
+  80195f:	00 00 00 
+  801962:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  801964:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  801969:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  80196d:	5b                   	pop    %rbx
+  80196e:	41 5c                	pop    %r12
+  801970:	5d                   	pop    %rbp
+  801971:	c3                   	ret
+            return 0;
+  801972:	b8 00 00 00 00       	mov    $0x0,%eax
+  801977:	eb f0                	jmp    801969 <dev_lookup+0x60>
+
+0000000000801979 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  801979:	55                   	push   %rbp
+  80197a:	48 89 e5             	mov    %rsp,%rbp
+  80197d:	41 55                	push   %r13
+  80197f:	41 54                	push   %r12
+  801981:	53                   	push   %rbx
+  801982:	48 83 ec 18          	sub    $0x18,%rsp
+  801986:	48 89 fb             	mov    %rdi,%rbx
+  801989:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80198c:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  801993:	ff ff ff 
+  801996:	48 01 df             	add    %rbx,%rdi
+  801999:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  80199d:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8019a1:	48 b8 be 18 80 00 00 	movabs $0x8018be,%rax
+  8019a8:	00 00 00 
+  8019ab:	ff d0                	call   *%rax
+  8019ad:	41 89 c5             	mov    %eax,%r13d
+  8019b0:	85 c0                	test   %eax,%eax
+  8019b2:	78 06                	js     8019ba <fd_close+0x41>
+  8019b4:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  8019b8:	74 1a                	je     8019d4 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  8019ba:	45 84 e4             	test   %r12b,%r12b
+  8019bd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019c2:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  8019c6:	44 89 e8             	mov    %r13d,%eax
+  8019c9:	48 83 c4 18          	add    $0x18,%rsp
+  8019cd:	5b                   	pop    %rbx
+  8019ce:	41 5c                	pop    %r12
+  8019d0:	41 5d                	pop    %r13
+  8019d2:	5d                   	pop    %rbp
+  8019d3:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8019d4:	8b 3b                	mov    (%rbx),%edi
+  8019d6:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8019da:	48 b8 09 19 80 00 00 	movabs $0x801909,%rax
+  8019e1:	00 00 00 
+  8019e4:	ff d0                	call   *%rax
+  8019e6:	41 89 c5             	mov    %eax,%r13d
+  8019e9:	85 c0                	test   %eax,%eax
+  8019eb:	78 1b                	js     801a08 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  8019ed:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8019f1:	48 8b 40 20          	mov    0x20(%rax),%rax
+  8019f5:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  8019fb:	48 85 c0             	test   %rax,%rax
+  8019fe:	74 08                	je     801a08 <fd_close+0x8f>
+  801a00:	48 89 df             	mov    %rbx,%rdi
+  801a03:	ff d0                	call   *%rax
+  801a05:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801a08:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801a0d:	48 89 de             	mov    %rbx,%rsi
+  801a10:	bf 00 00 00 00       	mov    $0x0,%edi
+  801a15:	48 b8 af 11 80 00 00 	movabs $0x8011af,%rax
+  801a1c:	00 00 00 
+  801a1f:	ff d0                	call   *%rax
+    return res;
+  801a21:	eb a3                	jmp    8019c6 <fd_close+0x4d>
+
+0000000000801a23 <close>:
+
+int
+close(int fdnum) {
+  801a23:	55                   	push   %rbp
+  801a24:	48 89 e5             	mov    %rsp,%rbp
+  801a27:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  801a2b:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801a2f:	48 b8 be 18 80 00 00 	movabs $0x8018be,%rax
+  801a36:	00 00 00 
+  801a39:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801a3b:	85 c0                	test   %eax,%eax
+  801a3d:	78 15                	js     801a54 <close+0x31>
+
+    return fd_close(fd, 1);
+  801a3f:	be 01 00 00 00       	mov    $0x1,%esi
+  801a44:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801a48:	48 b8 79 19 80 00 00 	movabs $0x801979,%rax
+  801a4f:	00 00 00 
+  801a52:	ff d0                	call   *%rax
+}
+  801a54:	c9                   	leave
+  801a55:	c3                   	ret
+
+0000000000801a56 <close_all>:
+
+void
+close_all(void) {
+  801a56:	55                   	push   %rbp
+  801a57:	48 89 e5             	mov    %rsp,%rbp
+  801a5a:	41 54                	push   %r12
+  801a5c:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  801a5d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a62:	49 bc 23 1a 80 00 00 	movabs $0x801a23,%r12
+  801a69:	00 00 00 
+  801a6c:	89 df                	mov    %ebx,%edi
+  801a6e:	41 ff d4             	call   *%r12
+  801a71:	83 c3 01             	add    $0x1,%ebx
+  801a74:	83 fb 20             	cmp    $0x20,%ebx
+  801a77:	75 f3                	jne    801a6c <close_all+0x16>
+}
+  801a79:	5b                   	pop    %rbx
+  801a7a:	41 5c                	pop    %r12
+  801a7c:	5d                   	pop    %rbp
+  801a7d:	c3                   	ret
+
+0000000000801a7e <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  801a7e:	55                   	push   %rbp
+  801a7f:	48 89 e5             	mov    %rsp,%rbp
+  801a82:	41 57                	push   %r15
+  801a84:	41 56                	push   %r14
+  801a86:	41 55                	push   %r13
+  801a88:	41 54                	push   %r12
+  801a8a:	53                   	push   %rbx
+  801a8b:	48 83 ec 18          	sub    $0x18,%rsp
+  801a8f:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  801a92:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801a96:	48 b8 be 18 80 00 00 	movabs $0x8018be,%rax
+  801a9d:	00 00 00 
+  801aa0:	ff d0                	call   *%rax
+  801aa2:	89 c3                	mov    %eax,%ebx
+  801aa4:	85 c0                	test   %eax,%eax
+  801aa6:	0f 88 b8 00 00 00    	js     801b64 <dup+0xe6>
+    close(newfdnum);
+  801aac:	44 89 e7             	mov    %r12d,%edi
+  801aaf:	48 b8 23 1a 80 00 00 	movabs $0x801a23,%rax
+  801ab6:	00 00 00 
+  801ab9:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  801abb:	4d 63 ec             	movslq %r12d,%r13
+  801abe:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  801ac5:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  801ac9:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  801acd:	4c 89 ff             	mov    %r15,%rdi
+  801ad0:	49 be 0f 18 80 00 00 	movabs $0x80180f,%r14
+  801ad7:	00 00 00 
+  801ada:	41 ff d6             	call   *%r14
+  801add:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  801ae0:	4c 89 ef             	mov    %r13,%rdi
+  801ae3:	41 ff d6             	call   *%r14
+  801ae6:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  801ae9:	48 89 df             	mov    %rbx,%rdi
+  801aec:	48 b8 34 29 80 00 00 	movabs $0x802934,%rax
+  801af3:	00 00 00 
+  801af6:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  801af8:	a8 04                	test   $0x4,%al
+  801afa:	74 2b                	je     801b27 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  801afc:	41 89 c1             	mov    %eax,%r9d
+  801aff:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801b05:	4c 89 f1             	mov    %r14,%rcx
+  801b08:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b0d:	48 89 de             	mov    %rbx,%rsi
+  801b10:	bf 00 00 00 00       	mov    $0x0,%edi
+  801b15:	48 b8 4a 11 80 00 00 	movabs $0x80114a,%rax
+  801b1c:	00 00 00 
+  801b1f:	ff d0                	call   *%rax
+  801b21:	89 c3                	mov    %eax,%ebx
+  801b23:	85 c0                	test   %eax,%eax
+  801b25:	78 4e                	js     801b75 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  801b27:	4c 89 ff             	mov    %r15,%rdi
+  801b2a:	48 b8 34 29 80 00 00 	movabs $0x802934,%rax
+  801b31:	00 00 00 
+  801b34:	ff d0                	call   *%rax
+  801b36:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801b39:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801b3f:	4c 89 e9             	mov    %r13,%rcx
+  801b42:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b47:	4c 89 fe             	mov    %r15,%rsi
+  801b4a:	bf 00 00 00 00       	mov    $0x0,%edi
+  801b4f:	48 b8 4a 11 80 00 00 	movabs $0x80114a,%rax
+  801b56:	00 00 00 
+  801b59:	ff d0                	call   *%rax
+  801b5b:	89 c3                	mov    %eax,%ebx
+  801b5d:	85 c0                	test   %eax,%eax
+  801b5f:	78 14                	js     801b75 <dup+0xf7>
+
+    return newfdnum;
+  801b61:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  801b64:	89 d8                	mov    %ebx,%eax
+  801b66:	48 83 c4 18          	add    $0x18,%rsp
+  801b6a:	5b                   	pop    %rbx
+  801b6b:	41 5c                	pop    %r12
+  801b6d:	41 5d                	pop    %r13
+  801b6f:	41 5e                	pop    %r14
+  801b71:	41 5f                	pop    %r15
+  801b73:	5d                   	pop    %rbp
+  801b74:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  801b75:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801b7a:	4c 89 ee             	mov    %r13,%rsi
+  801b7d:	bf 00 00 00 00       	mov    $0x0,%edi
+  801b82:	49 bc af 11 80 00 00 	movabs $0x8011af,%r12
+  801b89:	00 00 00 
+  801b8c:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  801b8f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801b94:	4c 89 f6             	mov    %r14,%rsi
+  801b97:	bf 00 00 00 00       	mov    $0x0,%edi
+  801b9c:	41 ff d4             	call   *%r12
+    return res;
+  801b9f:	eb c3                	jmp    801b64 <dup+0xe6>
+
+0000000000801ba1 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  801ba1:	55                   	push   %rbp
+  801ba2:	48 89 e5             	mov    %rsp,%rbp
+  801ba5:	41 56                	push   %r14
+  801ba7:	41 55                	push   %r13
+  801ba9:	41 54                	push   %r12
+  801bab:	53                   	push   %rbx
+  801bac:	48 83 ec 10          	sub    $0x10,%rsp
+  801bb0:	89 fb                	mov    %edi,%ebx
+  801bb2:	49 89 f4             	mov    %rsi,%r12
+  801bb5:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801bb8:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801bbc:	48 b8 be 18 80 00 00 	movabs $0x8018be,%rax
+  801bc3:	00 00 00 
+  801bc6:	ff d0                	call   *%rax
+  801bc8:	85 c0                	test   %eax,%eax
+  801bca:	78 4c                	js     801c18 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801bcc:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801bd0:	41 8b 3e             	mov    (%r14),%edi
+  801bd3:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801bd7:	48 b8 09 19 80 00 00 	movabs $0x801909,%rax
+  801bde:	00 00 00 
+  801be1:	ff d0                	call   *%rax
+  801be3:	85 c0                	test   %eax,%eax
+  801be5:	78 35                	js     801c1c <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801be7:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801beb:	83 e0 03             	and    $0x3,%eax
+  801bee:	83 f8 01             	cmp    $0x1,%eax
+  801bf1:	74 2d                	je     801c20 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801bf3:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801bf7:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801bfb:	48 85 c0             	test   %rax,%rax
+  801bfe:	74 56                	je     801c56 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  801c00:	4c 89 ea             	mov    %r13,%rdx
+  801c03:	4c 89 e6             	mov    %r12,%rsi
+  801c06:	4c 89 f7             	mov    %r14,%rdi
+  801c09:	ff d0                	call   *%rax
+}
+  801c0b:	48 83 c4 10          	add    $0x10,%rsp
+  801c0f:	5b                   	pop    %rbx
+  801c10:	41 5c                	pop    %r12
+  801c12:	41 5d                	pop    %r13
+  801c14:	41 5e                	pop    %r14
+  801c16:	5d                   	pop    %rbp
+  801c17:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801c18:	48 98                	cltq
+  801c1a:	eb ef                	jmp    801c0b <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801c1c:	48 98                	cltq
+  801c1e:	eb eb                	jmp    801c0b <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801c20:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801c27:	00 00 00 
+  801c2a:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+  801c30:	89 da                	mov    %ebx,%edx
+  801c32:	48 bf 29 36 80 00 00 	movabs $0x803629,%rdi
+  801c39:	00 00 00 
+  801c3c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c41:	48 b9 0e 02 80 00 00 	movabs $0x80020e,%rcx
+  801c48:	00 00 00 
+  801c4b:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801c4d:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801c54:	eb b5                	jmp    801c0b <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801c56:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801c5d:	eb ac                	jmp    801c0b <read+0x6a>
+
+0000000000801c5f <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801c5f:	55                   	push   %rbp
+  801c60:	48 89 e5             	mov    %rsp,%rbp
+  801c63:	41 57                	push   %r15
+  801c65:	41 56                	push   %r14
+  801c67:	41 55                	push   %r13
+  801c69:	41 54                	push   %r12
+  801c6b:	53                   	push   %rbx
+  801c6c:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  801c70:	48 85 d2             	test   %rdx,%rdx
+  801c73:	74 54                	je     801cc9 <readn+0x6a>
+  801c75:	41 89 fd             	mov    %edi,%r13d
+  801c78:	49 89 f6             	mov    %rsi,%r14
+  801c7b:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  801c7e:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  801c83:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  801c88:	49 bf a1 1b 80 00 00 	movabs $0x801ba1,%r15
+  801c8f:	00 00 00 
+  801c92:	4c 89 e2             	mov    %r12,%rdx
+  801c95:	48 29 f2             	sub    %rsi,%rdx
+  801c98:	4c 01 f6             	add    %r14,%rsi
+  801c9b:	44 89 ef             	mov    %r13d,%edi
+  801c9e:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  801ca1:	85 c0                	test   %eax,%eax
+  801ca3:	78 20                	js     801cc5 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  801ca5:	01 c3                	add    %eax,%ebx
+  801ca7:	85 c0                	test   %eax,%eax
+  801ca9:	74 08                	je     801cb3 <readn+0x54>
+  801cab:	48 63 f3             	movslq %ebx,%rsi
+  801cae:	4c 39 e6             	cmp    %r12,%rsi
+  801cb1:	72 df                	jb     801c92 <readn+0x33>
+    }
+    return res;
+  801cb3:	48 63 c3             	movslq %ebx,%rax
+}
+  801cb6:	48 83 c4 08          	add    $0x8,%rsp
+  801cba:	5b                   	pop    %rbx
+  801cbb:	41 5c                	pop    %r12
+  801cbd:	41 5d                	pop    %r13
+  801cbf:	41 5e                	pop    %r14
+  801cc1:	41 5f                	pop    %r15
+  801cc3:	5d                   	pop    %rbp
+  801cc4:	c3                   	ret
+        if (inc < 0) return inc;
+  801cc5:	48 98                	cltq
+  801cc7:	eb ed                	jmp    801cb6 <readn+0x57>
+    int inc = 1, res = 0;
+  801cc9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801cce:	eb e3                	jmp    801cb3 <readn+0x54>
+
+0000000000801cd0 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  801cd0:	55                   	push   %rbp
+  801cd1:	48 89 e5             	mov    %rsp,%rbp
+  801cd4:	41 56                	push   %r14
+  801cd6:	41 55                	push   %r13
+  801cd8:	41 54                	push   %r12
+  801cda:	53                   	push   %rbx
+  801cdb:	48 83 ec 10          	sub    $0x10,%rsp
+  801cdf:	89 fb                	mov    %edi,%ebx
+  801ce1:	49 89 f4             	mov    %rsi,%r12
+  801ce4:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801ce7:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801ceb:	48 b8 be 18 80 00 00 	movabs $0x8018be,%rax
+  801cf2:	00 00 00 
+  801cf5:	ff d0                	call   *%rax
+  801cf7:	85 c0                	test   %eax,%eax
+  801cf9:	78 47                	js     801d42 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801cfb:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801cff:	41 8b 3e             	mov    (%r14),%edi
+  801d02:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801d06:	48 b8 09 19 80 00 00 	movabs $0x801909,%rax
+  801d0d:	00 00 00 
+  801d10:	ff d0                	call   *%rax
+  801d12:	85 c0                	test   %eax,%eax
+  801d14:	78 30                	js     801d46 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801d16:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  801d1b:	74 2d                	je     801d4a <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801d1d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801d21:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801d25:	48 85 c0             	test   %rax,%rax
+  801d28:	74 56                	je     801d80 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  801d2a:	4c 89 ea             	mov    %r13,%rdx
+  801d2d:	4c 89 e6             	mov    %r12,%rsi
+  801d30:	4c 89 f7             	mov    %r14,%rdi
+  801d33:	ff d0                	call   *%rax
+}
+  801d35:	48 83 c4 10          	add    $0x10,%rsp
+  801d39:	5b                   	pop    %rbx
+  801d3a:	41 5c                	pop    %r12
+  801d3c:	41 5d                	pop    %r13
+  801d3e:	41 5e                	pop    %r14
+  801d40:	5d                   	pop    %rbp
+  801d41:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801d42:	48 98                	cltq
+  801d44:	eb ef                	jmp    801d35 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801d46:	48 98                	cltq
+  801d48:	eb eb                	jmp    801d35 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801d4a:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801d51:	00 00 00 
+  801d54:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+  801d5a:	89 da                	mov    %ebx,%edx
+  801d5c:	48 bf 45 36 80 00 00 	movabs $0x803645,%rdi
+  801d63:	00 00 00 
+  801d66:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d6b:	48 b9 0e 02 80 00 00 	movabs $0x80020e,%rcx
+  801d72:	00 00 00 
+  801d75:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801d77:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801d7e:	eb b5                	jmp    801d35 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801d80:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801d87:	eb ac                	jmp    801d35 <write+0x65>
+
+0000000000801d89 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  801d89:	55                   	push   %rbp
+  801d8a:	48 89 e5             	mov    %rsp,%rbp
+  801d8d:	53                   	push   %rbx
+  801d8e:	48 83 ec 18          	sub    $0x18,%rsp
+  801d92:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801d94:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801d98:	48 b8 be 18 80 00 00 	movabs $0x8018be,%rax
+  801d9f:	00 00 00 
+  801da2:	ff d0                	call   *%rax
+  801da4:	85 c0                	test   %eax,%eax
+  801da6:	78 0c                	js     801db4 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  801da8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801dac:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  801daf:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801db4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801db8:	c9                   	leave
+  801db9:	c3                   	ret
+
+0000000000801dba <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  801dba:	55                   	push   %rbp
+  801dbb:	48 89 e5             	mov    %rsp,%rbp
+  801dbe:	41 55                	push   %r13
+  801dc0:	41 54                	push   %r12
+  801dc2:	53                   	push   %rbx
+  801dc3:	48 83 ec 18          	sub    $0x18,%rsp
+  801dc7:	89 fb                	mov    %edi,%ebx
+  801dc9:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801dcc:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801dd0:	48 b8 be 18 80 00 00 	movabs $0x8018be,%rax
+  801dd7:	00 00 00 
+  801dda:	ff d0                	call   *%rax
+  801ddc:	85 c0                	test   %eax,%eax
+  801dde:	78 38                	js     801e18 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801de0:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  801de4:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  801de8:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801dec:	48 b8 09 19 80 00 00 	movabs $0x801909,%rax
+  801df3:	00 00 00 
+  801df6:	ff d0                	call   *%rax
+  801df8:	85 c0                	test   %eax,%eax
+  801dfa:	78 1c                	js     801e18 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801dfc:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  801e01:	74 20                	je     801e23 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801e03:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801e07:	48 8b 40 30          	mov    0x30(%rax),%rax
+  801e0b:	48 85 c0             	test   %rax,%rax
+  801e0e:	74 47                	je     801e57 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  801e10:	44 89 e6             	mov    %r12d,%esi
+  801e13:	4c 89 ef             	mov    %r13,%rdi
+  801e16:	ff d0                	call   *%rax
+}
+  801e18:	48 83 c4 18          	add    $0x18,%rsp
+  801e1c:	5b                   	pop    %rbx
+  801e1d:	41 5c                	pop    %r12
+  801e1f:	41 5d                	pop    %r13
+  801e21:	5d                   	pop    %rbp
+  801e22:	c3                   	ret
+                thisenv->env_id, fdnum);
+  801e23:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801e2a:	00 00 00 
+  801e2d:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801e33:	89 da                	mov    %ebx,%edx
+  801e35:	48 bf 08 36 80 00 00 	movabs $0x803608,%rdi
+  801e3c:	00 00 00 
+  801e3f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e44:	48 b9 0e 02 80 00 00 	movabs $0x80020e,%rcx
+  801e4b:	00 00 00 
+  801e4e:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801e50:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801e55:	eb c1                	jmp    801e18 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801e57:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801e5c:	eb ba                	jmp    801e18 <ftruncate+0x5e>
+
+0000000000801e5e <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  801e5e:	55                   	push   %rbp
+  801e5f:	48 89 e5             	mov    %rsp,%rbp
+  801e62:	41 54                	push   %r12
+  801e64:	53                   	push   %rbx
+  801e65:	48 83 ec 10          	sub    $0x10,%rsp
+  801e69:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801e6c:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801e70:	48 b8 be 18 80 00 00 	movabs $0x8018be,%rax
+  801e77:	00 00 00 
+  801e7a:	ff d0                	call   *%rax
+  801e7c:	85 c0                	test   %eax,%eax
+  801e7e:	78 4e                	js     801ece <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801e80:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801e84:	41 8b 3c 24          	mov    (%r12),%edi
+  801e88:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801e8c:	48 b8 09 19 80 00 00 	movabs $0x801909,%rax
+  801e93:	00 00 00 
+  801e96:	ff d0                	call   *%rax
+  801e98:	85 c0                	test   %eax,%eax
+  801e9a:	78 32                	js     801ece <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801e9c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801ea0:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  801ea5:	74 30                	je     801ed7 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  801ea7:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  801eaa:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  801eb1:	00 00 00 
+    stat->st_isdir = 0;
+  801eb4:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  801ebb:	00 00 00 
+    stat->st_dev = dev;
+  801ebe:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  801ec5:	48 89 de             	mov    %rbx,%rsi
+  801ec8:	4c 89 e7             	mov    %r12,%rdi
+  801ecb:	ff 50 28             	call   *0x28(%rax)
+}
+  801ece:	48 83 c4 10          	add    $0x10,%rsp
+  801ed2:	5b                   	pop    %rbx
+  801ed3:	41 5c                	pop    %r12
+  801ed5:	5d                   	pop    %rbp
+  801ed6:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801ed7:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801edc:	eb f0                	jmp    801ece <fstat+0x70>
+
+0000000000801ede <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  801ede:	55                   	push   %rbp
+  801edf:	48 89 e5             	mov    %rsp,%rbp
+  801ee2:	41 54                	push   %r12
+  801ee4:	53                   	push   %rbx
+  801ee5:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  801ee8:	be 00 00 00 00       	mov    $0x0,%esi
+  801eed:	48 b8 c1 22 80 00 00 	movabs $0x8022c1,%rax
+  801ef4:	00 00 00 
+  801ef7:	ff d0                	call   *%rax
+  801ef9:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  801efb:	85 c0                	test   %eax,%eax
+  801efd:	78 25                	js     801f24 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  801eff:	4c 89 e6             	mov    %r12,%rsi
+  801f02:	89 c7                	mov    %eax,%edi
+  801f04:	48 b8 5e 1e 80 00 00 	movabs $0x801e5e,%rax
+  801f0b:	00 00 00 
+  801f0e:	ff d0                	call   *%rax
+  801f10:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  801f13:	89 df                	mov    %ebx,%edi
+  801f15:	48 b8 23 1a 80 00 00 	movabs $0x801a23,%rax
+  801f1c:	00 00 00 
+  801f1f:	ff d0                	call   *%rax
+
+    return res;
+  801f21:	44 89 e3             	mov    %r12d,%ebx
+}
+  801f24:	89 d8                	mov    %ebx,%eax
+  801f26:	5b                   	pop    %rbx
+  801f27:	41 5c                	pop    %r12
+  801f29:	5d                   	pop    %rbp
+  801f2a:	c3                   	ret
+
+0000000000801f2b <fsipc>:
+ * response may be written back to fsipcbuf.
+ * type: request code, passed as the simple integer IPC value.
+ * dstva: virtual address at which to receive reply page, 0 if none.
+ * Returns result from the file server. */
+static int
+fsipc(unsigned type, void *dstva) {
+  801f2b:	55                   	push   %rbp
+  801f2c:	48 89 e5             	mov    %rsp,%rbp
+  801f2f:	41 54                	push   %r12
+  801f31:	53                   	push   %rbx
+  801f32:	48 83 ec 10          	sub    $0x10,%rsp
+  801f36:	41 89 fc             	mov    %edi,%r12d
+  801f39:	48 89 f3             	mov    %rsi,%rbx
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  801f3c:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  801f43:	00 00 00 
+  801f46:	83 38 00             	cmpl   $0x0,(%rax)
+  801f49:	74 5e                	je     801fa9 <fsipc+0x7e>
+    if (debug) {
+        cprintf("[%08x] fsipc %d %08x\n",
+                thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+    }
+
+    ipc_send(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW);
+  801f4b:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  801f51:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  801f56:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  801f5d:	00 00 00 
+  801f60:	44 89 e6             	mov    %r12d,%esi
+  801f63:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  801f6a:	00 00 00 
+  801f6d:	8b 38                	mov    (%rax),%edi
+  801f6f:	48 b8 cb 2e 80 00 00 	movabs $0x802ecb,%rax
+  801f76:	00 00 00 
+  801f79:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  801f7b:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  801f82:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  801f83:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801f88:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  801f8c:	48 89 de             	mov    %rbx,%rsi
+  801f8f:	bf 00 00 00 00       	mov    $0x0,%edi
+  801f94:	48 b8 f6 2d 80 00 00 	movabs $0x802df6,%rax
+  801f9b:	00 00 00 
+  801f9e:	ff d0                	call   *%rax
+}
+  801fa0:	48 83 c4 10          	add    $0x10,%rsp
+  801fa4:	5b                   	pop    %rbx
+  801fa5:	41 5c                	pop    %r12
+  801fa7:	5d                   	pop    %rbp
+  801fa8:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  801fa9:	bf 03 00 00 00       	mov    $0x3,%edi
+  801fae:	48 b8 6e 2f 80 00 00 	movabs $0x802f6e,%rax
+  801fb5:	00 00 00 
+  801fb8:	ff d0                	call   *%rax
+  801fba:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  801fc1:	00 00 
+  801fc3:	eb 86                	jmp    801f4b <fsipc+0x20>
+
+0000000000801fc5 <devfile_trunc>:
+    return 0;
+}
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  801fc5:	55                   	push   %rbp
+  801fc6:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801fc9:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  801fd0:	00 00 00 
+  801fd3:	8b 57 0c             	mov    0xc(%rdi),%edx
+  801fd6:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  801fd8:	89 70 04             	mov    %esi,0x4(%rax)
+
+    return fsipc(FSREQ_SET_SIZE, NULL);
+  801fdb:	be 00 00 00 00       	mov    $0x0,%esi
+  801fe0:	bf 02 00 00 00       	mov    $0x2,%edi
+  801fe5:	48 b8 2b 1f 80 00 00 	movabs $0x801f2b,%rax
+  801fec:	00 00 00 
+  801fef:	ff d0                	call   *%rax
+}
+  801ff1:	5d                   	pop    %rbp
+  801ff2:	c3                   	ret
+
+0000000000801ff3 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  801ff3:	55                   	push   %rbp
+  801ff4:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801ff7:	8b 47 0c             	mov    0xc(%rdi),%eax
+  801ffa:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  802001:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  802003:	be 00 00 00 00       	mov    $0x0,%esi
+  802008:	bf 06 00 00 00       	mov    $0x6,%edi
+  80200d:	48 b8 2b 1f 80 00 00 	movabs $0x801f2b,%rax
+  802014:	00 00 00 
+  802017:	ff d0                	call   *%rax
+}
+  802019:	5d                   	pop    %rbp
+  80201a:	c3                   	ret
+
+000000000080201b <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  80201b:	55                   	push   %rbp
+  80201c:	48 89 e5             	mov    %rsp,%rbp
+  80201f:	41 54                	push   %r12
+  802021:	53                   	push   %rbx
+  802022:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802025:	8b 47 0c             	mov    0xc(%rdi),%eax
+  802028:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  80202f:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  802031:	be 00 00 00 00       	mov    $0x0,%esi
+  802036:	bf 05 00 00 00       	mov    $0x5,%edi
+  80203b:	48 b8 2b 1f 80 00 00 	movabs $0x801f2b,%rax
+  802042:	00 00 00 
+  802045:	ff d0                	call   *%rax
+    if (res < 0) {
+  802047:	85 c0                	test   %eax,%eax
+  802049:	78 3d                	js     802088 <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  80204b:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  802052:	00 00 00 
+  802055:	4c 89 e6             	mov    %r12,%rsi
+  802058:	48 89 df             	mov    %rbx,%rdi
+  80205b:	48 b8 33 0b 80 00 00 	movabs $0x800b33,%rax
+  802062:	00 00 00 
+  802065:	ff d0                	call   *%rax
+    st->st_size  = fsipcbuf.statRet.ret_size;
+  802067:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  80206e:	00 
+  80206f:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802075:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  80207c:	00 
+  80207d:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  802083:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802088:	5b                   	pop    %rbx
+  802089:	41 5c                	pop    %r12
+  80208b:	5d                   	pop    %rbp
+  80208c:	c3                   	ret
+
+000000000080208d <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  80208d:	55                   	push   %rbp
+  80208e:	48 89 e5             	mov    %rsp,%rbp
+  802091:	41 57                	push   %r15
+  802093:	41 56                	push   %r14
+  802095:	41 55                	push   %r13
+  802097:	41 54                	push   %r12
+  802099:	53                   	push   %rbx
+  80209a:	48 83 ec 18          	sub    $0x18,%rsp
+  80209e:	49 89 fe             	mov    %rdi,%r14
+  8020a1:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+  8020a5:	48 89 d3             	mov    %rdx,%rbx
+    while (n > sizeof(fsipcbuf.write.req_buf))
+  8020a8:	48 81 fa f0 0f 00 00 	cmp    $0xff0,%rdx
+  8020af:	0f 86 e4 00 00 00    	jbe    802199 <devfile_write+0x10c>
+  8020b5:	49 89 f4             	mov    %rsi,%r12
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8020b8:	49 bd 00 60 80 00 00 	movabs $0x806000,%r13
+  8020bf:	00 00 00 
+        memcpy(fsipcbuf.write.req_buf, buf, sizeof(fsipcbuf.write.req_buf));
+  8020c2:	49 bf 94 0d 80 00 00 	movabs $0x800d94,%r15
+  8020c9:	00 00 00 
+  8020cc:	eb 03                	jmp    8020d1 <devfile_write+0x44>
+        buf += sizeof(fsipcbuf.write.req_buf);
+  8020ce:	49 89 f4             	mov    %rsi,%r12
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8020d1:	41 8b 46 0c          	mov    0xc(%r14),%eax
+  8020d5:	41 89 45 00          	mov    %eax,0x0(%r13)
+        fsipcbuf.write.req_n      = sizeof(fsipcbuf.write.req_buf);
+  8020d9:	49 c7 45 08 f0 0f 00 	movq   $0xff0,0x8(%r13)
+  8020e0:	00 
+        memcpy(fsipcbuf.write.req_buf, buf, sizeof(fsipcbuf.write.req_buf));
+  8020e1:	ba f0 0f 00 00       	mov    $0xff0,%edx
+  8020e6:	4c 89 e6             	mov    %r12,%rsi
+  8020e9:	48 bf 10 60 80 00 00 	movabs $0x806010,%rdi
+  8020f0:	00 00 00 
+  8020f3:	41 ff d7             	call   *%r15
+        ssize_t res = fsipc(FSREQ_WRITE, NULL);
+  8020f6:	be 00 00 00 00       	mov    $0x0,%esi
+  8020fb:	bf 04 00 00 00       	mov    $0x4,%edi
+  802100:	48 b8 2b 1f 80 00 00 	movabs $0x801f2b,%rax
+  802107:	00 00 00 
+  80210a:	ff d0                	call   *%rax
+  80210c:	48 63 d0             	movslq %eax,%rdx
+        if (res < 0 || res < sizeof(fsipcbuf.write.req_buf))
+  80210f:	3d ef 0f 00 00       	cmp    $0xfef,%eax
+  802114:	7e 71                	jle    802187 <devfile_write+0xfa>
+        buf += sizeof(fsipcbuf.write.req_buf);
+  802116:	49 8d b4 24 f0 0f 00 	lea    0xff0(%r12),%rsi
+  80211d:	00 
+        n -= sizeof(fsipcbuf.write.req_buf);
+  80211e:	48 81 eb f0 0f 00 00 	sub    $0xff0,%rbx
+    while (n > sizeof(fsipcbuf.write.req_buf))
+  802125:	48 81 fb f0 0f 00 00 	cmp    $0xff0,%rbx
+  80212c:	77 a0                	ja     8020ce <devfile_write+0x41>
+        written += sizeof(fsipcbuf.write.req_buf);
+  80212e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802132:	49 29 c4             	sub    %rax,%r12
+  802135:	4d 8d a4 24 f0 0f 00 	lea    0xff0(%r12),%r12
+  80213c:	00 
+    fsipcbuf.write.req_fileid = fd->fd_file.id;
+  80213d:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  802144:	00 00 00 
+  802147:	41 8b 56 0c          	mov    0xc(%r14),%edx
+  80214b:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.write.req_n      = n;
+  80214d:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    memcpy(fsipcbuf.write.req_buf, buf, n);
+  802151:	48 89 da             	mov    %rbx,%rdx
+  802154:	48 8d 78 10          	lea    0x10(%rax),%rdi
+  802158:	48 b8 94 0d 80 00 00 	movabs $0x800d94,%rax
+  80215f:	00 00 00 
+  802162:	ff d0                	call   *%rax
+    ssize_t res = fsipc(FSREQ_WRITE, NULL);
+  802164:	be 00 00 00 00       	mov    $0x0,%esi
+  802169:	bf 04 00 00 00       	mov    $0x4,%edi
+  80216e:	48 b8 2b 1f 80 00 00 	movabs $0x801f2b,%rax
+  802175:	00 00 00 
+  802178:	ff d0                	call   *%rax
+  80217a:	48 63 d0             	movslq %eax,%rdx
+    written += res;
+  80217d:	49 01 d4             	add    %rdx,%r12
+  802180:	48 85 d2             	test   %rdx,%rdx
+  802183:	49 0f 49 d4          	cmovns %r12,%rdx
+}
+  802187:	48 89 d0             	mov    %rdx,%rax
+  80218a:	48 83 c4 18          	add    $0x18,%rsp
+  80218e:	5b                   	pop    %rbx
+  80218f:	41 5c                	pop    %r12
+  802191:	41 5d                	pop    %r13
+  802193:	41 5e                	pop    %r14
+  802195:	41 5f                	pop    %r15
+  802197:	5d                   	pop    %rbp
+  802198:	c3                   	ret
+    while (n > sizeof(fsipcbuf.write.req_buf))
+  802199:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+    ssize_t written = 0;
+  80219d:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8021a3:	eb 98                	jmp    80213d <devfile_write+0xb0>
+
+00000000008021a5 <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  8021a5:	55                   	push   %rbp
+  8021a6:	48 89 e5             	mov    %rsp,%rbp
+  8021a9:	41 57                	push   %r15
+  8021ab:	41 56                	push   %r14
+  8021ad:	41 55                	push   %r13
+  8021af:	41 54                	push   %r12
+  8021b1:	53                   	push   %rbx
+  8021b2:	48 83 ec 18          	sub    $0x18,%rsp
+  8021b6:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  8021ba:	49 89 f6             	mov    %rsi,%r14
+  8021bd:	49 89 d4             	mov    %rdx,%r12
+    while (n > sizeof(fsipcbuf.readRet.ret_buf))
+  8021c0:	48 81 fa 00 10 00 00 	cmp    $0x1000,%rdx
+  8021c7:	0f 86 ea 00 00 00    	jbe    8022b7 <devfile_read+0x112>
+    ssize_t readsz = 0;
+  8021cd:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  8021d4:	00 
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8021d5:	49 bf 00 60 80 00 00 	movabs $0x806000,%r15
+  8021dc:	00 00 00 
+  8021df:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8021e3:	8b 40 0c             	mov    0xc(%rax),%eax
+  8021e6:	41 89 07             	mov    %eax,(%r15)
+        fsipcbuf.read.req_n = sizeof(fsipcbuf.readRet.ret_buf);
+  8021e9:	49 c7 47 08 00 10 00 	movq   $0x1000,0x8(%r15)
+  8021f0:	00 
+        ssize_t res = fsipc(FSREQ_READ, NULL);
+  8021f1:	be 00 00 00 00       	mov    $0x0,%esi
+  8021f6:	bf 03 00 00 00       	mov    $0x3,%edi
+  8021fb:	48 b8 2b 1f 80 00 00 	movabs $0x801f2b,%rax
+  802202:	00 00 00 
+  802205:	ff d0                	call   *%rax
+  802207:	4c 63 e8             	movslq %eax,%r13
+        if (res < 0)
+  80220a:	4d 85 ed             	test   %r13,%r13
+  80220d:	0f 88 92 00 00 00    	js     8022a5 <devfile_read+0x100>
+        memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  802213:	4c 89 ea             	mov    %r13,%rdx
+  802216:	4c 89 fe             	mov    %r15,%rsi
+  802219:	4c 89 f7             	mov    %r14,%rdi
+  80221c:	48 b8 94 0d 80 00 00 	movabs $0x800d94,%rax
+  802223:	00 00 00 
+  802226:	ff d0                	call   *%rax
+        if (res < sizeof(fsipcbuf.readRet.ret_buf))
+  802228:	49 81 fd ff 0f 00 00 	cmp    $0xfff,%r13
+  80222f:	76 6d                	jbe    80229e <devfile_read+0xf9>
+        readsz += res;
+  802231:	4c 01 6d c0          	add    %r13,-0x40(%rbp)
+        buf += res;
+  802235:	4d 01 ee             	add    %r13,%r14
+        n -= res;
+  802238:	4d 29 ec             	sub    %r13,%r12
+    while (n > sizeof(fsipcbuf.readRet.ret_buf))
+  80223b:	49 81 fc 00 10 00 00 	cmp    $0x1000,%r12
+  802242:	77 9b                	ja     8021df <devfile_read+0x3a>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802244:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  80224b:	00 00 00 
+  80224e:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  802252:	8b 51 0c             	mov    0xc(%rcx),%edx
+  802255:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.read.req_n = n;
+  802257:	4c 89 60 08          	mov    %r12,0x8(%rax)
+    ssize_t res = fsipc(FSREQ_READ, NULL);
+  80225b:	be 00 00 00 00       	mov    $0x0,%esi
+  802260:	bf 03 00 00 00       	mov    $0x3,%edi
+  802265:	48 b8 2b 1f 80 00 00 	movabs $0x801f2b,%rax
+  80226c:	00 00 00 
+  80226f:	ff d0                	call   *%rax
+  802271:	4c 63 e8             	movslq %eax,%r13
+    if (res < 0)
+  802274:	4d 85 ed             	test   %r13,%r13
+  802277:	78 2c                	js     8022a5 <devfile_read+0x100>
+    memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  802279:	4c 89 ea             	mov    %r13,%rdx
+  80227c:	48 be 00 60 80 00 00 	movabs $0x806000,%rsi
+  802283:	00 00 00 
+  802286:	4c 89 f7             	mov    %r14,%rdi
+  802289:	48 b8 94 0d 80 00 00 	movabs $0x800d94,%rax
+  802290:	00 00 00 
+  802293:	ff d0                	call   *%rax
+    readsz += res;
+  802295:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802299:	49 01 c5             	add    %rax,%r13
+    return readsz;
+  80229c:	eb 07                	jmp    8022a5 <devfile_read+0x100>
+            return readsz + res;
+  80229e:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8022a2:	49 01 c5             	add    %rax,%r13
+}
+  8022a5:	4c 89 e8             	mov    %r13,%rax
+  8022a8:	48 83 c4 18          	add    $0x18,%rsp
+  8022ac:	5b                   	pop    %rbx
+  8022ad:	41 5c                	pop    %r12
+  8022af:	41 5d                	pop    %r13
+  8022b1:	41 5e                	pop    %r14
+  8022b3:	41 5f                	pop    %r15
+  8022b5:	5d                   	pop    %rbp
+  8022b6:	c3                   	ret
+    ssize_t readsz = 0;
+  8022b7:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  8022be:	00 
+  8022bf:	eb 83                	jmp    802244 <devfile_read+0x9f>
+
+00000000008022c1 <open>:
+open(const char *path, int mode) {
+  8022c1:	55                   	push   %rbp
+  8022c2:	48 89 e5             	mov    %rsp,%rbp
+  8022c5:	41 55                	push   %r13
+  8022c7:	41 54                	push   %r12
+  8022c9:	53                   	push   %rbx
+  8022ca:	48 83 ec 18          	sub    $0x18,%rsp
+  8022ce:	49 89 fc             	mov    %rdi,%r12
+  8022d1:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  8022d4:	48 b8 f5 0a 80 00 00 	movabs $0x800af5,%rax
+  8022db:	00 00 00 
+  8022de:	ff d0                	call   *%rax
+  8022e0:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  8022e6:	0f 87 8a 00 00 00    	ja     802376 <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8022ec:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  8022f0:	48 b8 a4 18 80 00 00 	movabs $0x8018a4,%rax
+  8022f7:	00 00 00 
+  8022fa:	ff d0                	call   *%rax
+  8022fc:	89 c3                	mov    %eax,%ebx
+  8022fe:	85 c0                	test   %eax,%eax
+  802300:	78 50                	js     802352 <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  802302:	4c 89 e6             	mov    %r12,%rsi
+  802305:	48 bb 00 60 80 00 00 	movabs $0x806000,%rbx
+  80230c:	00 00 00 
+  80230f:	48 89 df             	mov    %rbx,%rdi
+  802312:	48 b8 33 0b 80 00 00 	movabs $0x800b33,%rax
+  802319:	00 00 00 
+  80231c:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  80231e:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  802325:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802329:	bf 01 00 00 00       	mov    $0x1,%edi
+  80232e:	48 b8 2b 1f 80 00 00 	movabs $0x801f2b,%rax
+  802335:	00 00 00 
+  802338:	ff d0                	call   *%rax
+  80233a:	89 c3                	mov    %eax,%ebx
+  80233c:	85 c0                	test   %eax,%eax
+  80233e:	78 1f                	js     80235f <open+0x9e>
+    return fd2num(fd);
+  802340:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802344:	48 b8 fd 17 80 00 00 	movabs $0x8017fd,%rax
+  80234b:	00 00 00 
+  80234e:	ff d0                	call   *%rax
+  802350:	89 c3                	mov    %eax,%ebx
+}
+  802352:	89 d8                	mov    %ebx,%eax
+  802354:	48 83 c4 18          	add    $0x18,%rsp
+  802358:	5b                   	pop    %rbx
+  802359:	41 5c                	pop    %r12
+  80235b:	41 5d                	pop    %r13
+  80235d:	5d                   	pop    %rbp
+  80235e:	c3                   	ret
+        fd_close(fd, 0);
+  80235f:	be 00 00 00 00       	mov    $0x0,%esi
+  802364:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802368:	48 b8 79 19 80 00 00 	movabs $0x801979,%rax
+  80236f:	00 00 00 
+  802372:	ff d0                	call   *%rax
+        return res;
+  802374:	eb dc                	jmp    802352 <open+0x91>
+        return -E_BAD_PATH;
+  802376:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  80237b:	eb d5                	jmp    802352 <open+0x91>
+
+000000000080237d <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  80237d:	55                   	push   %rbp
+  80237e:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc(FSREQ_SYNC, NULL);
+  802381:	be 00 00 00 00       	mov    $0x0,%esi
+  802386:	bf 08 00 00 00       	mov    $0x8,%edi
+  80238b:	48 b8 2b 1f 80 00 00 	movabs $0x801f2b,%rax
+  802392:	00 00 00 
+  802395:	ff d0                	call   *%rax
+}
+  802397:	5d                   	pop    %rbp
+  802398:	c3                   	ret
+
+0000000000802399 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  802399:	55                   	push   %rbp
+  80239a:	48 89 e5             	mov    %rsp,%rbp
+  80239d:	41 54                	push   %r12
+  80239f:	53                   	push   %rbx
+  8023a0:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8023a3:	48 b8 0f 18 80 00 00 	movabs $0x80180f,%rax
+  8023aa:	00 00 00 
+  8023ad:	ff d0                	call   *%rax
+  8023af:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  8023b2:	48 be a0 36 80 00 00 	movabs $0x8036a0,%rsi
+  8023b9:	00 00 00 
+  8023bc:	48 89 df             	mov    %rbx,%rdi
+  8023bf:	48 b8 33 0b 80 00 00 	movabs $0x800b33,%rax
+  8023c6:	00 00 00 
+  8023c9:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  8023cb:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  8023d0:	41 2b 04 24          	sub    (%r12),%eax
+  8023d4:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  8023da:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8023e1:	00 00 00 
+    stat->st_dev = &devpipe;
+  8023e4:	48 b8 60 40 80 00 00 	movabs $0x804060,%rax
+  8023eb:	00 00 00 
+  8023ee:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  8023f5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023fa:	5b                   	pop    %rbx
+  8023fb:	41 5c                	pop    %r12
+  8023fd:	5d                   	pop    %rbp
+  8023fe:	c3                   	ret
+
+00000000008023ff <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  8023ff:	55                   	push   %rbp
+  802400:	48 89 e5             	mov    %rsp,%rbp
+  802403:	41 54                	push   %r12
+  802405:	53                   	push   %rbx
+  802406:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  802409:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80240e:	48 89 fe             	mov    %rdi,%rsi
+  802411:	bf 00 00 00 00       	mov    $0x0,%edi
+  802416:	49 bc af 11 80 00 00 	movabs $0x8011af,%r12
+  80241d:	00 00 00 
+  802420:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  802423:	48 89 df             	mov    %rbx,%rdi
+  802426:	48 b8 0f 18 80 00 00 	movabs $0x80180f,%rax
+  80242d:	00 00 00 
+  802430:	ff d0                	call   *%rax
+  802432:	48 89 c6             	mov    %rax,%rsi
+  802435:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80243a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80243f:	41 ff d4             	call   *%r12
+}
+  802442:	5b                   	pop    %rbx
+  802443:	41 5c                	pop    %r12
+  802445:	5d                   	pop    %rbp
+  802446:	c3                   	ret
+
+0000000000802447 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  802447:	55                   	push   %rbp
+  802448:	48 89 e5             	mov    %rsp,%rbp
+  80244b:	41 57                	push   %r15
+  80244d:	41 56                	push   %r14
+  80244f:	41 55                	push   %r13
+  802451:	41 54                	push   %r12
+  802453:	53                   	push   %rbx
+  802454:	48 83 ec 18          	sub    $0x18,%rsp
+  802458:	49 89 fc             	mov    %rdi,%r12
+  80245b:	49 89 f5             	mov    %rsi,%r13
+  80245e:	49 89 d7             	mov    %rdx,%r15
+  802461:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802465:	48 b8 0f 18 80 00 00 	movabs $0x80180f,%rax
+  80246c:	00 00 00 
+  80246f:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  802471:	4d 85 ff             	test   %r15,%r15
+  802474:	0f 84 af 00 00 00    	je     802529 <devpipe_write+0xe2>
+  80247a:	48 89 c3             	mov    %rax,%rbx
+  80247d:	4c 89 f8             	mov    %r15,%rax
+  802480:	4d 89 ef             	mov    %r13,%r15
+  802483:	4c 01 e8             	add    %r13,%rax
+  802486:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80248a:	49 bd b7 10 80 00 00 	movabs $0x8010b7,%r13
+  802491:	00 00 00 
+            sys_yield();
+  802494:	49 be 54 10 80 00 00 	movabs $0x801054,%r14
+  80249b:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  80249e:	8b 73 04             	mov    0x4(%rbx),%esi
+  8024a1:	48 63 ce             	movslq %esi,%rcx
+  8024a4:	48 63 03             	movslq (%rbx),%rax
+  8024a7:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  8024ad:	48 39 c1             	cmp    %rax,%rcx
+  8024b0:	72 2e                	jb     8024e0 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8024b2:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8024b7:	48 89 da             	mov    %rbx,%rdx
+  8024ba:	be 00 10 00 00       	mov    $0x1000,%esi
+  8024bf:	4c 89 e7             	mov    %r12,%rdi
+  8024c2:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  8024c5:	85 c0                	test   %eax,%eax
+  8024c7:	74 66                	je     80252f <devpipe_write+0xe8>
+            sys_yield();
+  8024c9:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  8024cc:	8b 73 04             	mov    0x4(%rbx),%esi
+  8024cf:	48 63 ce             	movslq %esi,%rcx
+  8024d2:	48 63 03             	movslq (%rbx),%rax
+  8024d5:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  8024db:	48 39 c1             	cmp    %rax,%rcx
+  8024de:	73 d2                	jae    8024b2 <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8024e0:	41 0f b6 3f          	movzbl (%r15),%edi
+  8024e4:	48 89 ca             	mov    %rcx,%rdx
+  8024e7:	48 c1 ea 03          	shr    $0x3,%rdx
+  8024eb:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  8024f2:	08 10 20 
+  8024f5:	48 f7 e2             	mul    %rdx
+  8024f8:	48 c1 ea 06          	shr    $0x6,%rdx
+  8024fc:	48 89 d0             	mov    %rdx,%rax
+  8024ff:	48 c1 e0 09          	shl    $0x9,%rax
+  802503:	48 29 d0             	sub    %rdx,%rax
+  802506:	48 c1 e0 03          	shl    $0x3,%rax
+  80250a:	48 29 c1             	sub    %rax,%rcx
+  80250d:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  802512:	83 c6 01             	add    $0x1,%esi
+  802515:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  802518:	49 83 c7 01          	add    $0x1,%r15
+  80251c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802520:	49 39 c7             	cmp    %rax,%r15
+  802523:	0f 85 75 ff ff ff    	jne    80249e <devpipe_write+0x57>
+    return n;
+  802529:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80252d:	eb 05                	jmp    802534 <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  80252f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802534:	48 83 c4 18          	add    $0x18,%rsp
+  802538:	5b                   	pop    %rbx
+  802539:	41 5c                	pop    %r12
+  80253b:	41 5d                	pop    %r13
+  80253d:	41 5e                	pop    %r14
+  80253f:	41 5f                	pop    %r15
+  802541:	5d                   	pop    %rbp
+  802542:	c3                   	ret
+
+0000000000802543 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  802543:	55                   	push   %rbp
+  802544:	48 89 e5             	mov    %rsp,%rbp
+  802547:	41 57                	push   %r15
+  802549:	41 56                	push   %r14
+  80254b:	41 55                	push   %r13
+  80254d:	41 54                	push   %r12
+  80254f:	53                   	push   %rbx
+  802550:	48 83 ec 18          	sub    $0x18,%rsp
+  802554:	49 89 fc             	mov    %rdi,%r12
+  802557:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  80255b:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80255f:	48 b8 0f 18 80 00 00 	movabs $0x80180f,%rax
+  802566:	00 00 00 
+  802569:	ff d0                	call   *%rax
+  80256b:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  80256e:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802574:	49 bd b7 10 80 00 00 	movabs $0x8010b7,%r13
+  80257b:	00 00 00 
+            sys_yield();
+  80257e:	49 be 54 10 80 00 00 	movabs $0x801054,%r14
+  802585:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  802588:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  80258d:	74 7d                	je     80260c <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  80258f:	8b 03                	mov    (%rbx),%eax
+  802591:	3b 43 04             	cmp    0x4(%rbx),%eax
+  802594:	75 26                	jne    8025bc <devpipe_read+0x79>
+            if (i > 0) return i;
+  802596:	4d 85 ff             	test   %r15,%r15
+  802599:	75 77                	jne    802612 <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80259b:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8025a0:	48 89 da             	mov    %rbx,%rdx
+  8025a3:	be 00 10 00 00       	mov    $0x1000,%esi
+  8025a8:	4c 89 e7             	mov    %r12,%rdi
+  8025ab:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  8025ae:	85 c0                	test   %eax,%eax
+  8025b0:	74 72                	je     802624 <devpipe_read+0xe1>
+            sys_yield();
+  8025b2:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  8025b5:	8b 03                	mov    (%rbx),%eax
+  8025b7:	3b 43 04             	cmp    0x4(%rbx),%eax
+  8025ba:	74 df                	je     80259b <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  8025bc:	48 63 c8             	movslq %eax,%rcx
+  8025bf:	48 89 ca             	mov    %rcx,%rdx
+  8025c2:	48 c1 ea 03          	shr    $0x3,%rdx
+  8025c6:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  8025cd:	08 10 20 
+  8025d0:	48 89 d0             	mov    %rdx,%rax
+  8025d3:	48 f7 e6             	mul    %rsi
+  8025d6:	48 c1 ea 06          	shr    $0x6,%rdx
+  8025da:	48 89 d0             	mov    %rdx,%rax
+  8025dd:	48 c1 e0 09          	shl    $0x9,%rax
+  8025e1:	48 29 d0             	sub    %rdx,%rax
+  8025e4:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  8025eb:	00 
+  8025ec:	48 89 c8             	mov    %rcx,%rax
+  8025ef:	48 29 d0             	sub    %rdx,%rax
+  8025f2:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  8025f7:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8025fb:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  8025ff:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  802602:	49 83 c7 01          	add    $0x1,%r15
+  802606:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  80260a:	75 83                	jne    80258f <devpipe_read+0x4c>
+    return n;
+  80260c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802610:	eb 03                	jmp    802615 <devpipe_read+0xd2>
+            if (i > 0) return i;
+  802612:	4c 89 f8             	mov    %r15,%rax
+}
+  802615:	48 83 c4 18          	add    $0x18,%rsp
+  802619:	5b                   	pop    %rbx
+  80261a:	41 5c                	pop    %r12
+  80261c:	41 5d                	pop    %r13
+  80261e:	41 5e                	pop    %r14
+  802620:	41 5f                	pop    %r15
+  802622:	5d                   	pop    %rbp
+  802623:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  802624:	b8 00 00 00 00       	mov    $0x0,%eax
+  802629:	eb ea                	jmp    802615 <devpipe_read+0xd2>
+
+000000000080262b <pipe>:
+pipe(int pfd[2]) {
+  80262b:	55                   	push   %rbp
+  80262c:	48 89 e5             	mov    %rsp,%rbp
+  80262f:	41 55                	push   %r13
+  802631:	41 54                	push   %r12
+  802633:	53                   	push   %rbx
+  802634:	48 81 ec b8 00 00 00 	sub    $0xb8,%rsp
+  80263b:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  80263e:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802642:	48 b8 a4 18 80 00 00 	movabs $0x8018a4,%rax
+  802649:	00 00 00 
+  80264c:	ff d0                	call   *%rax
+  80264e:	89 c3                	mov    %eax,%ebx
+  802650:	85 c0                	test   %eax,%eax
+  802652:	0f 88 51 01 00 00    	js     8027a9 <pipe+0x17e>
+        (res = fd_alloc_from(fd2num(fd0) + 1, &fd1)) < 0) goto err;
+  802658:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80265c:	48 b8 fd 17 80 00 00 	movabs $0x8017fd,%rax
+  802663:	00 00 00 
+  802666:	ff d0                	call   *%rax
+  802668:	8d 78 01             	lea    0x1(%rax),%edi
+  80266b:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80266f:	48 b8 2b 18 80 00 00 	movabs $0x80182b,%rax
+  802676:	00 00 00 
+  802679:	ff d0                	call   *%rax
+  80267b:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  80267d:	85 c0                	test   %eax,%eax
+  80267f:	0f 88 24 01 00 00    	js     8027a9 <pipe+0x17e>
+    va = fd2data(fd0);
+  802685:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802689:	48 bb 0f 18 80 00 00 	movabs $0x80180f,%rbx
+  802690:	00 00 00 
+  802693:	ff d3                	call   *%rbx
+  802695:	49 89 c5             	mov    %rax,%r13
+    struct RegionOp ops[] = {
+  802698:	48 8d bd 30 ff ff ff 	lea    -0xd0(%rbp),%rdi
+  80269f:	b9 14 00 00 00       	mov    $0x14,%ecx
+  8026a4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8026a9:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+  8026ac:	c7 85 34 ff ff ff 46 	movl   $0x46,-0xcc(%rbp)
+  8026b3:	00 00 00 
+  8026b6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8026ba:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+  8026c1:	48 c7 85 50 ff ff ff 	movq   $0x1000,-0xb0(%rbp)
+  8026c8:	00 10 00 00 
+  8026cc:	c7 85 5c ff ff ff 46 	movl   $0x46,-0xa4(%rbp)
+  8026d3:	00 00 00 
+            {.type = REGION_ALLOC, .dstva = (uintptr_t)fd1, .size = PAGE_SIZE, .perm = PROT_RW | PROT_SHARE},
+  8026d6:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+    struct RegionOp ops[] = {
+  8026da:	48 89 bd 70 ff ff ff 	mov    %rdi,-0x90(%rbp)
+  8026e1:	48 c7 85 78 ff ff ff 	movq   $0x1000,-0x88(%rbp)
+  8026e8:	00 10 00 00 
+  8026ec:	c7 45 84 46 00 00 00 	movl   $0x46,-0x7c(%rbp)
+  8026f3:	4c 89 6d 98          	mov    %r13,-0x68(%rbp)
+  8026f7:	48 c7 45 a0 00 10 00 	movq   $0x1000,-0x60(%rbp)
+  8026fe:	00 
+  8026ff:	c7 45 a8 01 00 00 00 	movl   $0x1,-0x58(%rbp)
+  802706:	c7 45 ac 46 00 00 00 	movl   $0x46,-0x54(%rbp)
+  80270d:	4c 89 6d b8          	mov    %r13,-0x48(%rbp)
+            {.type = REGION_MAP, .srcva = (uintptr_t)va, .dstva = (uintptr_t)fd2data(fd1), .size = PAGE_SIZE, .perm = PROT_RW | PROT_SHARE},
+  802711:	ff d3                	call   *%rbx
+    struct RegionOp ops[] = {
+  802713:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802717:	48 c7 45 c8 00 10 00 	movq   $0x1000,-0x38(%rbp)
+  80271e:	00 
+    if ((res = sys_region_batch(ops, sizeof ops / sizeof *ops)) < 0) goto err1;
+  80271f:	be 04 00 00 00       	mov    $0x4,%esi
+  802724:	48 8d bd 30 ff ff ff 	lea    -0xd0(%rbp),%rdi
+  80272b:	48 b8 16 12 80 00 00 	movabs $0x801216,%rax
+  802732:	00 00 00 
+  802735:	ff d0                	call   *%rax
+  802737:	89 c3                	mov    %eax,%ebx
+  802739:	85 c0                	test   %eax,%eax
+  80273b:	0f 88 ad 00 00 00    	js     8027ee <pipe+0x1c3>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  802741:	be 00 10 00 00       	mov    $0x1000,%esi
+  802746:	4c 89 ef             	mov    %r13,%rdi
+  802749:	48 b8 85 10 80 00 00 	movabs $0x801085,%rax
+  802750:	00 00 00 
+  802753:	ff d0                	call   *%rax
+  802755:	83 f8 02             	cmp    $0x2,%eax
+  802758:	75 5f                	jne    8027b9 <pipe+0x18e>
+    fd0->fd_dev_id = devpipe.dev_id;
+  80275a:	a1 60 40 80 00 00 00 	movabs 0x804060,%eax
+  802761:	00 00 
+  802763:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802767:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  802769:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80276d:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  802774:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  802778:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  80277a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80277e:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  802785:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802789:	48 bb fd 17 80 00 00 	movabs $0x8017fd,%rbx
+  802790:	00 00 00 
+  802793:	ff d3                	call   *%rbx
+  802795:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  802799:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  80279d:	ff d3                	call   *%rbx
+  80279f:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  8027a4:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  8027a9:	89 d8                	mov    %ebx,%eax
+  8027ab:	48 81 c4 b8 00 00 00 	add    $0xb8,%rsp
+  8027b2:	5b                   	pop    %rbx
+  8027b3:	41 5c                	pop    %r12
+  8027b5:	41 5d                	pop    %r13
+  8027b7:	5d                   	pop    %rbp
+  8027b8:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8027b9:	48 b9 b8 36 80 00 00 	movabs $0x8036b8,%rcx
+  8027c0:	00 00 00 
+  8027c3:	48 ba d0 35 80 00 00 	movabs $0x8035d0,%rdx
+  8027ca:	00 00 00 
+  8027cd:	be 33 00 00 00       	mov    $0x33,%esi
+  8027d2:	48 bf a7 36 80 00 00 	movabs $0x8036a7,%rdi
+  8027d9:	00 00 00 
+  8027dc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027e1:	49 b8 53 2d 80 00 00 	movabs $0x802d53,%r8
+  8027e8:	00 00 00 
+  8027eb:	41 ff d0             	call   *%r8
+        ops[i].type = REGION_UNMAP;
+  8027ee:	c7 85 30 ff ff ff 02 	movl   $0x2,-0xd0(%rbp)
+  8027f5:	00 00 00 
+  8027f8:	c7 85 58 ff ff ff 02 	movl   $0x2,-0xa8(%rbp)
+  8027ff:	00 00 00 
+  802802:	c7 45 80 02 00 00 00 	movl   $0x2,-0x80(%rbp)
+  802809:	c7 45 a8 02 00 00 00 	movl   $0x2,-0x58(%rbp)
+    sys_region_batch(ops, sizeof ops / sizeof *ops);
+  802810:	be 04 00 00 00       	mov    $0x4,%esi
+  802815:	48 8d bd 30 ff ff ff 	lea    -0xd0(%rbp),%rdi
+  80281c:	48 b8 16 12 80 00 00 	movabs $0x801216,%rax
+  802823:	00 00 00 
+  802826:	ff d0                	call   *%rax
+  802828:	e9 7c ff ff ff       	jmp    8027a9 <pipe+0x17e>
+
+000000000080282d <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  80282d:	55                   	push   %rbp
+  80282e:	48 89 e5             	mov    %rsp,%rbp
+  802831:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  802835:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802839:	48 b8 be 18 80 00 00 	movabs $0x8018be,%rax
+  802840:	00 00 00 
+  802843:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802845:	85 c0                	test   %eax,%eax
+  802847:	78 35                	js     80287e <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  802849:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80284d:	48 b8 0f 18 80 00 00 	movabs $0x80180f,%rax
+  802854:	00 00 00 
+  802857:	ff d0                	call   *%rax
+  802859:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80285c:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802861:	be 00 10 00 00       	mov    $0x1000,%esi
+  802866:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80286a:	48 b8 b7 10 80 00 00 	movabs $0x8010b7,%rax
+  802871:	00 00 00 
+  802874:	ff d0                	call   *%rax
+  802876:	85 c0                	test   %eax,%eax
+  802878:	0f 94 c0             	sete   %al
+  80287b:	0f b6 c0             	movzbl %al,%eax
+}
+  80287e:	c9                   	leave
+  80287f:	c3                   	ret
+
+0000000000802880 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  802880:	48 89 f8             	mov    %rdi,%rax
+  802883:	48 c1 e8 27          	shr    $0x27,%rax
+  802887:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  80288e:	01 00 00 
+  802891:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802895:	f6 c2 01             	test   $0x1,%dl
+  802898:	74 6d                	je     802907 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  80289a:	48 89 f8             	mov    %rdi,%rax
+  80289d:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8028a1:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8028a8:	01 00 00 
+  8028ab:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8028af:	f6 c2 01             	test   $0x1,%dl
+  8028b2:	74 62                	je     802916 <get_uvpt_entry+0x96>
+  8028b4:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8028bb:	01 00 00 
+  8028be:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8028c2:	f6 c2 80             	test   $0x80,%dl
+  8028c5:	75 4f                	jne    802916 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8028c7:	48 89 f8             	mov    %rdi,%rax
+  8028ca:	48 c1 e8 15          	shr    $0x15,%rax
+  8028ce:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8028d5:	01 00 00 
+  8028d8:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8028dc:	f6 c2 01             	test   $0x1,%dl
+  8028df:	74 44                	je     802925 <get_uvpt_entry+0xa5>
+  8028e1:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8028e8:	01 00 00 
+  8028eb:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8028ef:	f6 c2 80             	test   $0x80,%dl
+  8028f2:	75 31                	jne    802925 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  8028f4:	48 c1 ef 0c          	shr    $0xc,%rdi
+  8028f8:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8028ff:	01 00 00 
+  802902:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  802906:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  802907:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  80290e:	01 00 00 
+  802911:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802915:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  802916:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  80291d:	01 00 00 
+  802920:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802924:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  802925:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  80292c:	01 00 00 
+  80292f:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802933:	c3                   	ret
+
+0000000000802934 <get_prot>:
+
+int
+get_prot(void *va) {
+  802934:	55                   	push   %rbp
+  802935:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  802938:	48 b8 80 28 80 00 00 	movabs $0x802880,%rax
+  80293f:	00 00 00 
+  802942:	ff d0                	call   *%rax
+  802944:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  802947:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  80294c:	89 c1                	mov    %eax,%ecx
+  80294e:	83 c9 04             	or     $0x4,%ecx
+  802951:	f6 c2 01             	test   $0x1,%dl
+  802954:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  802957:	89 c1                	mov    %eax,%ecx
+  802959:	83 c9 02             	or     $0x2,%ecx
+  80295c:	f6 c2 02             	test   $0x2,%dl
+  80295f:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  802962:	89 c1                	mov    %eax,%ecx
+  802964:	83 c9 01             	or     $0x1,%ecx
+  802967:	48 85 d2             	test   %rdx,%rdx
+  80296a:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  80296d:	89 c1                	mov    %eax,%ecx
+  80296f:	83 c9 40             	or     $0x40,%ecx
+  802972:	f6 c6 04             	test   $0x4,%dh
+  802975:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  802978:	5d                   	pop    %rbp
+  802979:	c3                   	ret
+
+000000000080297a <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  80297a:	55                   	push   %rbp
+  80297b:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  80297e:	48 b8 80 28 80 00 00 	movabs $0x802880,%rax
+  802985:	00 00 00 
+  802988:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  80298a:	48 c1 e8 06          	shr    $0x6,%rax
+  80298e:	83 e0 01             	and    $0x1,%eax
+}
+  802991:	5d                   	pop    %rbp
+  802992:	c3                   	ret
+
+0000000000802993 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  802993:	55                   	push   %rbp
+  802994:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  802997:	48 b8 80 28 80 00 00 	movabs $0x802880,%rax
+  80299e:	00 00 00 
+  8029a1:	ff d0                	call   *%rax
+  8029a3:	83 e0 01             	and    $0x1,%eax
+}
+  8029a6:	5d                   	pop    %rbp
+  8029a7:	c3                   	ret
+
+00000000008029a8 <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  8029a8:	55                   	push   %rbp
+  8029a9:	48 89 e5             	mov    %rsp,%rbp
+  8029ac:	41 57                	push   %r15
+  8029ae:	41 56                	push   %r14
+  8029b0:	41 55                	push   %r13
+  8029b2:	41 54                	push   %r12
+  8029b4:	53                   	push   %rbx
+  8029b5:	48 83 ec 38          	sub    $0x38,%rsp
+  8029b9:	49 89 f7             	mov    %rsi,%r15
+  8029bc:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+                    }
+                    continue;
+                }
+                for (int ptei = 0; ptei < PT_ENTRY_COUNT; ptei++) {
+                    uintptr_t pte_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, pdei, ptei, 0);
+                    pte_t pte = uvpt[VPT(pte_addr)];
+  8029c2:	49 bd 00 00 00 00 00 	movabs $0x10000000000,%r13
+  8029c9:	01 00 00 
+  8029cc:	4d 89 e6             	mov    %r12,%r14
+  8029cf:	49 89 fc             	mov    %rdi,%r12
+  8029d2:	e9 19 01 00 00       	jmp    802af0 <foreach_shared_region+0x148>
+  8029d7:	48 89 5d b0          	mov    %rbx,-0x50(%rbp)
+  8029db:	4c 89 75 a8          	mov    %r14,-0x58(%rbp)
+  8029df:	eb 52                	jmp    802a33 <foreach_shared_region+0x8b>
+                for (int ptei = 0; ptei < PT_ENTRY_COUNT; ptei++) {
+  8029e1:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8029e8:	48 81 fb 00 00 20 00 	cmp    $0x200000,%rbx
+  8029ef:	74 2e                	je     802a1f <foreach_shared_region+0x77>
+                    uintptr_t pte_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, pdei, ptei, 0);
+  8029f1:	48 89 df             	mov    %rbx,%rdi
+  8029f4:	4c 09 f7             	or     %r14,%rdi
+                    pte_t pte = uvpt[VPT(pte_addr)];
+  8029f7:	48 89 f8             	mov    %rdi,%rax
+  8029fa:	48 c1 e8 0c          	shr    $0xc,%rax
+  8029fe:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+                    if ((pte & PTE_P) && (pte & PTE_SHARE)) {
+  802a03:	25 01 04 00 00       	and    $0x401,%eax
+  802a08:	48 3d 01 04 00 00    	cmp    $0x401,%rax
+  802a0e:	75 d1                	jne    8029e1 <foreach_shared_region+0x39>
+                        fun((void*)pte_addr, (void*)(pte_addr + PAGE_SIZE), arg);
+  802a10:	48 8d b7 00 10 00 00 	lea    0x1000(%rdi),%rsi
+  802a17:	4c 89 fa             	mov    %r15,%rdx
+  802a1a:	41 ff d4             	call   *%r12
+  802a1d:	eb c2                	jmp    8029e1 <foreach_shared_region+0x39>
+            for (int pdei = 0; pdei < PD_ENTRY_COUNT; pdei++) {
+  802a1f:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  802a26:	00 
+  802a27:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802a2b:	48 3d 00 00 00 40    	cmp    $0x40000000,%rax
+  802a31:	74 46                	je     802a79 <foreach_shared_region+0xd1>
+                uintptr_t pde_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, pdei, 0, 0);
+  802a33:	4c 8b 75 c8          	mov    -0x38(%rbp),%r14
+  802a37:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802a3b:	49 09 c6             	or     %rax,%r14
+                pde_t pde = uvpd[VPD(pde_addr)];
+  802a3e:	4c 89 f0             	mov    %r14,%rax
+  802a41:	48 c1 e8 15          	shr    $0x15,%rax
+  802a45:	48 b9 00 00 00 80 00 	movabs $0x10080000000,%rcx
+  802a4c:	01 00 00 
+  802a4f:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+                if (!(pde & PTE_P)) {
+  802a53:	a8 01                	test   $0x1,%al
+  802a55:	74 c8                	je     802a1f <foreach_shared_region+0x77>
+                if (pde & PTE_PS) {
+  802a57:	48 89 c3             	mov    %rax,%rbx
+  802a5a:	81 e3 80 00 00 00    	and    $0x80,%ebx
+  802a60:	74 8f                	je     8029f1 <foreach_shared_region+0x49>
+                    if (pde & PTE_SHARE) {
+  802a62:	f6 c4 04             	test   $0x4,%ah
+  802a65:	74 b8                	je     802a1f <foreach_shared_region+0x77>
+                        fun((void*)pde_addr, (void*)(pde_addr + 1024 * 1024 * 2), arg);
+  802a67:	49 8d b6 00 00 20 00 	lea    0x200000(%r14),%rsi
+  802a6e:	4c 89 fa             	mov    %r15,%rdx
+  802a71:	4c 89 f7             	mov    %r14,%rdi
+  802a74:	41 ff d4             	call   *%r12
+  802a77:	eb a6                	jmp    802a1f <foreach_shared_region+0x77>
+  802a79:	48 8b 5d b0          	mov    -0x50(%rbp),%rbx
+  802a7d:	4c 8b 75 a8          	mov    -0x58(%rbp),%r14
+        for (int pdpei = 0; pdpei < PDP_ENTRY_COUNT; pdpei++) {
+  802a81:	48 81 c3 00 00 00 40 	add    $0x40000000,%rbx
+  802a88:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802a8f:	00 00 00 
+  802a92:	48 39 c3             	cmp    %rax,%rbx
+  802a95:	74 4c                	je     802ae3 <foreach_shared_region+0x13b>
+            uintptr_t pdpe_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, 0, 0, 0);
+  802a97:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802a9b:	48 09 d8             	or     %rbx,%rax
+  802a9e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+            pdpe_t pdpe = uvpdp[VPDP(pdpe_addr)];
+  802aa2:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802aa6:	48 b9 00 00 40 80 00 	movabs $0x10080400000,%rcx
+  802aad:	01 00 00 
+  802ab0:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+            if (!(pdpe & PTE_P)) {
+  802ab4:	a8 01                	test   $0x1,%al
+  802ab6:	74 c9                	je     802a81 <foreach_shared_region+0xd9>
+            if (pdpe & PTE_PS) {
+  802ab8:	48 89 c1             	mov    %rax,%rcx
+  802abb:	81 e1 80 00 00 00    	and    $0x80,%ecx
+  802ac1:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  802ac5:	0f 84 0c ff ff ff    	je     8029d7 <foreach_shared_region+0x2f>
+                if (pdpe & PTE_SHARE) {
+  802acb:	f6 c4 04             	test   $0x4,%ah
+  802ace:	74 b1                	je     802a81 <foreach_shared_region+0xd9>
+                    fun((void*)pdpe_addr, (void*)(pdpe_addr + 1024 * 1024 * 1024), arg); 
+  802ad0:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  802ad4:	48 8d b7 00 00 00 40 	lea    0x40000000(%rdi),%rsi
+  802adb:	4c 89 fa             	mov    %r15,%rdx
+  802ade:	41 ff d4             	call   *%r12
+  802ae1:	eb 9e                	jmp    802a81 <foreach_shared_region+0xd9>
+    for (int pml4ei = 0; pml4ei < PML4_ENTRY_COUNT; pml4ei++) {
+  802ae3:	49 83 c6 01          	add    $0x1,%r14
+  802ae7:	49 81 fe 00 02 00 00 	cmp    $0x200,%r14
+  802aee:	74 24                	je     802b14 <foreach_shared_region+0x16c>
+        pml4e_t pml4e = uvpml4[VPML4(pml4_addr)];
+  802af0:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  802af7:	01 00 00 
+  802afa:	4a 8b 04 f0          	mov    (%rax,%r14,8),%rax
+        if (!(pml4e & PTE_P)) {
+  802afe:	a8 01                	test   $0x1,%al
+  802b00:	74 e1                	je     802ae3 <foreach_shared_region+0x13b>
+  802b02:	4c 89 f0             	mov    %r14,%rax
+  802b05:	48 c1 e0 27          	shl    $0x27,%rax
+  802b09:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  802b0d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802b12:	eb 83                	jmp    802a97 <foreach_shared_region+0xef>
+            }
+        }
+    }
+    
+    return 0;
+}
+  802b14:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b19:	48 83 c4 38          	add    $0x38,%rsp
+  802b1d:	5b                   	pop    %rbx
+  802b1e:	41 5c                	pop    %r12
+  802b20:	41 5d                	pop    %r13
+  802b22:	41 5e                	pop    %r14
+  802b24:	41 5f                	pop    %r15
+  802b26:	5d                   	pop    %rbp
+  802b27:	c3                   	ret
+
+0000000000802b28 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  802b28:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b2d:	c3                   	ret
+
+0000000000802b2e <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  802b2e:	55                   	push   %rbp
+  802b2f:	48 89 e5             	mov    %rsp,%rbp
+  802b32:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  802b35:	48 be dc 36 80 00 00 	movabs $0x8036dc,%rsi
+  802b3c:	00 00 00 
+  802b3f:	48 b8 33 0b 80 00 00 	movabs $0x800b33,%rax
+  802b46:	00 00 00 
+  802b49:	ff d0                	call   *%rax
+    return 0;
+}
+  802b4b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b50:	5d                   	pop    %rbp
+  802b51:	c3                   	ret
+
+0000000000802b52 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  802b52:	55                   	push   %rbp
+  802b53:	48 89 e5             	mov    %rsp,%rbp
+  802b56:	41 57                	push   %r15
+  802b58:	41 56                	push   %r14
+  802b5a:	41 55                	push   %r13
+  802b5c:	41 54                	push   %r12
+  802b5e:	53                   	push   %rbx
+  802b5f:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  802b66:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  802b6d:	48 85 d2             	test   %rdx,%rdx
+  802b70:	74 7a                	je     802bec <devcons_write+0x9a>
+  802b72:	49 89 d6             	mov    %rdx,%r14
+  802b75:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802b7b:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  802b80:	49 bf 2d 0d 80 00 00 	movabs $0x800d2d,%r15
+  802b87:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  802b8a:	4c 89 f3             	mov    %r14,%rbx
+  802b8d:	48 29 f3             	sub    %rsi,%rbx
+  802b90:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802b95:	48 39 c3             	cmp    %rax,%rbx
+  802b98:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  802b9c:	4c 63 eb             	movslq %ebx,%r13
+  802b9f:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  802ba6:	48 01 c6             	add    %rax,%rsi
+  802ba9:	4c 89 ea             	mov    %r13,%rdx
+  802bac:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802bb3:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  802bb6:	4c 89 ee             	mov    %r13,%rsi
+  802bb9:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802bc0:	48 b8 5a 0f 80 00 00 	movabs $0x800f5a,%rax
+  802bc7:	00 00 00 
+  802bca:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  802bcc:	41 01 dc             	add    %ebx,%r12d
+  802bcf:	49 63 f4             	movslq %r12d,%rsi
+  802bd2:	4c 39 f6             	cmp    %r14,%rsi
+  802bd5:	72 b3                	jb     802b8a <devcons_write+0x38>
+    return res;
+  802bd7:	49 63 c4             	movslq %r12d,%rax
+}
+  802bda:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  802be1:	5b                   	pop    %rbx
+  802be2:	41 5c                	pop    %r12
+  802be4:	41 5d                	pop    %r13
+  802be6:	41 5e                	pop    %r14
+  802be8:	41 5f                	pop    %r15
+  802bea:	5d                   	pop    %rbp
+  802beb:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  802bec:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802bf2:	eb e3                	jmp    802bd7 <devcons_write+0x85>
+
+0000000000802bf4 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  802bf4:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  802bf7:	ba 00 00 00 00       	mov    $0x0,%edx
+  802bfc:	48 85 c0             	test   %rax,%rax
+  802bff:	74 55                	je     802c56 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  802c01:	55                   	push   %rbp
+  802c02:	48 89 e5             	mov    %rsp,%rbp
+  802c05:	41 55                	push   %r13
+  802c07:	41 54                	push   %r12
+  802c09:	53                   	push   %rbx
+  802c0a:	48 83 ec 08          	sub    $0x8,%rsp
+  802c0e:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  802c11:	48 bb 87 0f 80 00 00 	movabs $0x800f87,%rbx
+  802c18:	00 00 00 
+  802c1b:	49 bc 54 10 80 00 00 	movabs $0x801054,%r12
+  802c22:	00 00 00 
+  802c25:	eb 03                	jmp    802c2a <devcons_read+0x36>
+  802c27:	41 ff d4             	call   *%r12
+  802c2a:	ff d3                	call   *%rbx
+  802c2c:	85 c0                	test   %eax,%eax
+  802c2e:	74 f7                	je     802c27 <devcons_read+0x33>
+    if (c < 0) return c;
+  802c30:	48 63 d0             	movslq %eax,%rdx
+  802c33:	78 13                	js     802c48 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  802c35:	ba 00 00 00 00       	mov    $0x0,%edx
+  802c3a:	83 f8 04             	cmp    $0x4,%eax
+  802c3d:	74 09                	je     802c48 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  802c3f:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  802c43:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  802c48:	48 89 d0             	mov    %rdx,%rax
+  802c4b:	48 83 c4 08          	add    $0x8,%rsp
+  802c4f:	5b                   	pop    %rbx
+  802c50:	41 5c                	pop    %r12
+  802c52:	41 5d                	pop    %r13
+  802c54:	5d                   	pop    %rbp
+  802c55:	c3                   	ret
+  802c56:	48 89 d0             	mov    %rdx,%rax
+  802c59:	c3                   	ret
+
+0000000000802c5a <cputchar>:
+cputchar(int ch) {
+  802c5a:	55                   	push   %rbp
+  802c5b:	48 89 e5             	mov    %rsp,%rbp
+  802c5e:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  802c62:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  802c66:	be 01 00 00 00       	mov    $0x1,%esi
+  802c6b:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  802c6f:	48 b8 5a 0f 80 00 00 	movabs $0x800f5a,%rax
+  802c76:	00 00 00 
+  802c79:	ff d0                	call   *%rax
+}
+  802c7b:	c9                   	leave
+  802c7c:	c3                   	ret
+
+0000000000802c7d <getchar>:
+getchar(void) {
+  802c7d:	55                   	push   %rbp
+  802c7e:	48 89 e5             	mov    %rsp,%rbp
+  802c81:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  802c85:	ba 01 00 00 00       	mov    $0x1,%edx
+  802c8a:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  802c8e:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c93:	48 b8 a1 1b 80 00 00 	movabs $0x801ba1,%rax
+  802c9a:	00 00 00 
+  802c9d:	ff d0                	call   *%rax
+  802c9f:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  802ca1:	85 c0                	test   %eax,%eax
+  802ca3:	78 06                	js     802cab <getchar+0x2e>
+  802ca5:	74 08                	je     802caf <getchar+0x32>
+  802ca7:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  802cab:	89 d0                	mov    %edx,%eax
+  802cad:	c9                   	leave
+  802cae:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  802caf:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  802cb4:	eb f5                	jmp    802cab <getchar+0x2e>
+
+0000000000802cb6 <iscons>:
+iscons(int fdnum) {
+  802cb6:	55                   	push   %rbp
+  802cb7:	48 89 e5             	mov    %rsp,%rbp
+  802cba:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  802cbe:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802cc2:	48 b8 be 18 80 00 00 	movabs $0x8018be,%rax
+  802cc9:	00 00 00 
+  802ccc:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802cce:	85 c0                	test   %eax,%eax
+  802cd0:	78 18                	js     802cea <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  802cd2:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802cd6:	48 b8 a0 40 80 00 00 	movabs $0x8040a0,%rax
+  802cdd:	00 00 00 
+  802ce0:	8b 00                	mov    (%rax),%eax
+  802ce2:	39 02                	cmp    %eax,(%rdx)
+  802ce4:	0f 94 c0             	sete   %al
+  802ce7:	0f b6 c0             	movzbl %al,%eax
+}
+  802cea:	c9                   	leave
+  802ceb:	c3                   	ret
+
+0000000000802cec <opencons>:
+opencons(void) {
+  802cec:	55                   	push   %rbp
+  802ced:	48 89 e5             	mov    %rsp,%rbp
+  802cf0:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802cf4:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  802cf8:	48 b8 a4 18 80 00 00 	movabs $0x8018a4,%rax
+  802cff:	00 00 00 
+  802d02:	ff d0                	call   *%rax
+  802d04:	85 c0                	test   %eax,%eax
+  802d06:	78 49                	js     802d51 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  802d08:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802d0d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802d12:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  802d16:	bf 00 00 00 00       	mov    $0x0,%edi
+  802d1b:	48 b8 e3 10 80 00 00 	movabs $0x8010e3,%rax
+  802d22:	00 00 00 
+  802d25:	ff d0                	call   *%rax
+  802d27:	85 c0                	test   %eax,%eax
+  802d29:	78 26                	js     802d51 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  802d2b:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802d2f:	a1 a0 40 80 00 00 00 	movabs 0x8040a0,%eax
+  802d36:	00 00 
+  802d38:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  802d3a:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802d3e:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  802d45:	48 b8 fd 17 80 00 00 	movabs $0x8017fd,%rax
+  802d4c:	00 00 00 
+  802d4f:	ff d0                	call   *%rax
+}
+  802d51:	c9                   	leave
+  802d52:	c3                   	ret
+
+0000000000802d53 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  802d53:	55                   	push   %rbp
+  802d54:	48 89 e5             	mov    %rsp,%rbp
+  802d57:	41 56                	push   %r14
+  802d59:	41 55                	push   %r13
+  802d5b:	41 54                	push   %r12
+  802d5d:	53                   	push   %rbx
+  802d5e:	48 83 ec 50          	sub    $0x50,%rsp
+  802d62:	49 89 fc             	mov    %rdi,%r12
+  802d65:	41 89 f5             	mov    %esi,%r13d
+  802d68:	48 89 d3             	mov    %rdx,%rbx
+  802d6b:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  802d6f:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  802d73:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  802d77:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  802d7e:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802d82:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  802d86:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  802d8a:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  802d8e:	48 b8 00 40 80 00 00 	movabs $0x804000,%rax
+  802d95:	00 00 00 
+  802d98:	4c 8b 30             	mov    (%rax),%r14
+  802d9b:	48 b8 23 10 80 00 00 	movabs $0x801023,%rax
+  802da2:	00 00 00 
+  802da5:	ff d0                	call   *%rax
+  802da7:	89 c6                	mov    %eax,%esi
+  802da9:	45 89 e8             	mov    %r13d,%r8d
+  802dac:	4c 89 e1             	mov    %r12,%rcx
+  802daf:	4c 89 f2             	mov    %r14,%rdx
+  802db2:	48 bf e8 36 80 00 00 	movabs $0x8036e8,%rdi
+  802db9:	00 00 00 
+  802dbc:	b8 00 00 00 00       	mov    $0x0,%eax
+  802dc1:	49 bc 0e 02 80 00 00 	movabs $0x80020e,%r12
+  802dc8:	00 00 00 
+  802dcb:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  802dce:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  802dd2:	48 89 df             	mov    %rbx,%rdi
+  802dd5:	48 b8 aa 01 80 00 00 	movabs $0x8001aa,%rax
+  802ddc:	00 00 00 
+  802ddf:	ff d0                	call   *%rax
+    cprintf("\n");
+  802de1:	48 bf 43 36 80 00 00 	movabs $0x803643,%rdi
+  802de8:	00 00 00 
+  802deb:	b8 00 00 00 00       	mov    $0x0,%eax
+  802df0:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  802df3:	cc                   	int3
+  802df4:	eb fd                	jmp    802df3 <_panic+0xa0>
+
+0000000000802df6 <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  802df6:	55                   	push   %rbp
+  802df7:	48 89 e5             	mov    %rsp,%rbp
+  802dfa:	41 55                	push   %r13
+  802dfc:	41 54                	push   %r12
+  802dfe:	53                   	push   %rbx
+  802dff:	48 83 ec 08          	sub    $0x8,%rsp
+  802e03:	49 89 fc             	mov    %rdi,%r12
+  802e06:	48 89 f7             	mov    %rsi,%rdi
+  802e09:	48 89 d3             	mov    %rdx,%rbx
+  802e0c:	49 89 cd             	mov    %rcx,%r13
+    // LAB 9: Your code here:
+    int res = sys_ipc_recv(!pg ? (void*)MAX_USER_ADDRESS : pg, !size ? 0 : *size);
+  802e0f:	be 00 00 00 00       	mov    $0x0,%esi
+  802e14:	48 85 d2             	test   %rdx,%rdx
+  802e17:	74 03                	je     802e1c <ipc_recv+0x26>
+  802e19:	48 8b 32             	mov    (%rdx),%rsi
+  802e1c:	48 85 ff             	test   %rdi,%rdi
+  802e1f:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802e26:	00 00 00 
+  802e29:	48 0f 44 f8          	cmove  %rax,%rdi
+  802e2d:	48 b8 b5 14 80 00 00 	movabs $0x8014b5,%rax
+  802e34:	00 00 00 
+  802e37:	ff d0                	call   *%rax
+    if (res < 0) {
+  802e39:	85 c0                	test   %eax,%eax
+  802e3b:	78 66                	js     802ea3 <ipc_recv+0xad>
+        if (size) {
+            *size = 0;
+        }
+        return res;
+    }
+    if (from_env_store) {
+  802e3d:	4d 85 e4             	test   %r12,%r12
+  802e40:	74 14                	je     802e56 <ipc_recv+0x60>
+        *from_env_store = thisenv->env_ipc_from;
+  802e42:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802e49:	00 00 00 
+  802e4c:	8b 80 ac 01 00 00    	mov    0x1ac(%rax),%eax
+  802e52:	41 89 04 24          	mov    %eax,(%r12)
+    }
+    if (perm_store) {
+  802e56:	4d 85 ed             	test   %r13,%r13
+  802e59:	74 14                	je     802e6f <ipc_recv+0x79>
+        *perm_store = thisenv->env_ipc_perm;
+  802e5b:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802e62:	00 00 00 
+  802e65:	8b 80 b0 01 00 00    	mov    0x1b0(%rax),%eax
+  802e6b:	41 89 45 00          	mov    %eax,0x0(%r13)
+    }
+    if (size) {
+  802e6f:	48 85 db             	test   %rbx,%rbx
+  802e72:	74 14                	je     802e88 <ipc_recv+0x92>
+        *size = thisenv->env_ipc_maxsz;
+  802e74:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802e7b:	00 00 00 
+  802e7e:	48 8b 80 a0 01 00 00 	mov    0x1a0(%rax),%rax
+  802e85:	48 89 03             	mov    %rax,(%rbx)
+    }
+    return thisenv->env_ipc_value;
+  802e88:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802e8f:	00 00 00 
+  802e92:	8b 80 a8 01 00 00    	mov    0x1a8(%rax),%eax
+}
+  802e98:	48 83 c4 08          	add    $0x8,%rsp
+  802e9c:	5b                   	pop    %rbx
+  802e9d:	41 5c                	pop    %r12
+  802e9f:	41 5d                	pop    %r13
+  802ea1:	5d                   	pop    %rbp
+  802ea2:	c3                   	ret
+        if (from_env_store) {
+  802ea3:	4d 85 e4             	test   %r12,%r12
+  802ea6:	74 08                	je     802eb0 <ipc_recv+0xba>
+            *from_env_store = 0;
+  802ea8:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  802eaf:	00 
+        if (perm_store) {
+  802eb0:	4d 85 ed             	test   %r13,%r13
+  802eb3:	74 08                	je     802ebd <ipc_recv+0xc7>
+            *perm_store = 0;
+  802eb5:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  802ebc:	00 
+        if (size) {
+  802ebd:	48 85 db             	test   %rbx,%rbx
+  802ec0:	74 d6                	je     802e98 <ipc_recv+0xa2>
+            *size = 0;
+  802ec2:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  802ec9:	eb cd                	jmp    802e98 <ipc_recv+0xa2>
+
+0000000000802ecb <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  802ecb:	55                   	push   %rbp
+  802ecc:	48 89 e5             	mov    %rsp,%rbp
+  802ecf:	41 57                	push   %r15
+  802ed1:	41 56                	push   %r14
+  802ed3:	41 55                	push   %r13
+  802ed5:	41 54                	push   %r12
+  802ed7:	53                   	push   %rbx
+  802ed8:	48 83 ec 18          	sub    $0x18,%rsp
+  802edc:	41 89 fd             	mov    %edi,%r13d
+  802edf:	89 75 cc             	mov    %esi,-0x34(%rbp)
+  802ee2:	49 89 cc             	mov    %rcx,%r12
+  802ee5:	44 89 45 c8          	mov    %r8d,-0x38(%rbp)
+    // LAB 9: Your code here:
+    int res = 0;
+    while ((res = sys_ipc_try_send(to_env, val, !pg ? (void*)MAX_USER_ADDRESS : pg, size, perm)) < 0) {
+  802ee9:	48 85 d2             	test   %rdx,%rdx
+  802eec:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802ef3:	00 00 00 
+  802ef6:	48 0f 45 c2          	cmovne %rdx,%rax
+  802efa:	48 89 c3             	mov    %rax,%rbx
+  802efd:	49 be 89 14 80 00 00 	movabs $0x801489,%r14
+  802f04:	00 00 00 
+        if (res != -E_IPC_NOT_RECV) {
+            panic("sys_ipc_try_send failed: %i", res);
+        }
+        sys_yield();
+  802f07:	49 bf 54 10 80 00 00 	movabs $0x801054,%r15
+  802f0e:	00 00 00 
+    while ((res = sys_ipc_try_send(to_env, val, !pg ? (void*)MAX_USER_ADDRESS : pg, size, perm)) < 0) {
+  802f11:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  802f14:	44 8b 45 c8          	mov    -0x38(%rbp),%r8d
+  802f18:	4c 89 e1             	mov    %r12,%rcx
+  802f1b:	48 89 da             	mov    %rbx,%rdx
+  802f1e:	44 89 ef             	mov    %r13d,%edi
+  802f21:	41 ff d6             	call   *%r14
+  802f24:	85 c0                	test   %eax,%eax
+  802f26:	79 37                	jns    802f5f <ipc_send+0x94>
+        if (res != -E_IPC_NOT_RECV) {
+  802f28:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  802f2b:	75 05                	jne    802f32 <ipc_send+0x67>
+        sys_yield();
+  802f2d:	41 ff d7             	call   *%r15
+  802f30:	eb df                	jmp    802f11 <ipc_send+0x46>
+            panic("sys_ipc_try_send failed: %i", res);
+  802f32:	89 c1                	mov    %eax,%ecx
+  802f34:	48 ba 0b 37 80 00 00 	movabs $0x80370b,%rdx
+  802f3b:	00 00 00 
+  802f3e:	be 40 00 00 00       	mov    $0x40,%esi
+  802f43:	48 bf 27 37 80 00 00 	movabs $0x803727,%rdi
+  802f4a:	00 00 00 
+  802f4d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f52:	49 b8 53 2d 80 00 00 	movabs $0x802d53,%r8
+  802f59:	00 00 00 
+  802f5c:	41 ff d0             	call   *%r8
+    }
+    return;
+}
+  802f5f:	48 83 c4 18          	add    $0x18,%rsp
+  802f63:	5b                   	pop    %rbx
+  802f64:	41 5c                	pop    %r12
+  802f66:	41 5d                	pop    %r13
+  802f68:	41 5e                	pop    %r14
+  802f6a:	41 5f                	pop    %r15
+  802f6c:	5d                   	pop    %rbp
+  802f6d:	c3                   	ret
+
+0000000000802f6e <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  802f6e:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  802f73:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  802f7a:	00 00 00 
+  802f7d:	48 69 d0 d0 01 00 00 	imul   $0x1d0,%rax,%rdx
+  802f84:	48 01 ca             	add    %rcx,%rdx
+  802f87:	8b 92 e8 00 00 00    	mov    0xe8(%rdx),%edx
+  802f8d:	39 fa                	cmp    %edi,%edx
+  802f8f:	74 12                	je     802fa3 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  802f91:	48 83 c0 01          	add    $0x1,%rax
+  802f95:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  802f9b:	75 e0                	jne    802f7d <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  802f9d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802fa2:	c3                   	ret
+            return envs[i].env_id;
+  802fa3:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+  802faa:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  802fb1:	00 00 00 
+  802fb4:	48 01 d0             	add    %rdx,%rax
+  802fb7:	8b 80 e0 00 00 00    	mov    0xe0(%rax),%eax
+  802fbd:	c3                   	ret
+  802fbe:	66 90                	xchg   %ax,%ax
+
+0000000000802fc0 <__rodata_start>:
+  802fc0:	69 20 66 61 75 6c    	imul   $0x6c756166,(%rax),%esp
+  802fc6:	74 65                	je     80302d <__rodata_start+0x6d>
+  802fc8:	64 20 61 74          	and    %ah,%fs:0x74(%rcx)
+  802fcc:	20 76 61             	and    %dh,0x61(%rsi)
+  802fcf:	20 25 6c 78 2c 20    	and    %ah,0x202c786c(%rip)        # 20aca841 <__bss_end+0x202c2841>
+  802fd5:	65 72 72             	gs jb  80304a <__rodata_start+0x8a>
+  802fd8:	20 25 78 0a 00 3c    	and    %ah,0x3c000a78(%rip)        # 3c803a56 <__bss_end+0x3bffba56>
+  802fde:	75 6e                	jne    80304e <__rodata_start+0x8e>
+  802fe0:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  802fe4:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802fe5:	3e 00 30             	ds add %dh,(%rax)
+  802fe8:	31 32                	xor    %esi,(%rdx)
+  802fea:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  802ff1:	41                   	rex.B
+  802ff2:	42                   	rex.X
+  802ff3:	43                   	rex.XB
+  802ff4:	44                   	rex.R
+  802ff5:	45                   	rex.RB
+  802ff6:	46 00 30             	rex.RX add %r14b,(%rax)
+  802ff9:	31 32                	xor    %esi,(%rdx)
+  802ffb:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  803002:	61                   	(bad)
+  803003:	62 63 64 65 66       	(bad)
+  803008:	00 28                	add    %ch,(%rax)
+  80300a:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80300b:	75 6c                	jne    803079 <__rodata_start+0xb9>
+  80300d:	6c                   	insb   (%dx),%es:(%rdi)
+  80300e:	29 00                	sub    %eax,(%rax)
+  803010:	65 72 72             	gs jb  803085 <__rodata_start+0xc5>
+  803013:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803014:	72 20                	jb     803036 <__rodata_start+0x76>
+  803016:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  80301b:	73 70                	jae    80308d <__rodata_start+0xcd>
+  80301d:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  803021:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  803028:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803029:	72 00                	jb     80302b <__rodata_start+0x6b>
+  80302b:	62 61 64 20 65       	(bad)
+  803030:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803031:	76 69                	jbe    80309c <__rodata_start+0xdc>
+  803033:	72 6f                	jb     8030a4 <__rodata_start+0xe4>
+  803035:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803036:	6d                   	insl   (%dx),%es:(%rdi)
+  803037:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803039:	74 00                	je     80303b <__rodata_start+0x7b>
+  80303b:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  803042:	20 70 61             	and    %dh,0x61(%rax)
+  803045:	72 61                	jb     8030a8 <__rodata_start+0xe8>
+  803047:	6d                   	insl   (%dx),%es:(%rdi)
+  803048:	65 74 65             	gs je  8030b0 <__rodata_start+0xf0>
+  80304b:	72 00                	jb     80304d <__rodata_start+0x8d>
+  80304d:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80304e:	75 74                	jne    8030c4 <__rodata_start+0x104>
+  803050:	20 6f 66             	and    %ch,0x66(%rdi)
+  803053:	20 6d 65             	and    %ch,0x65(%rbp)
+  803056:	6d                   	insl   (%dx),%es:(%rdi)
+  803057:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803058:	72 79                	jb     8030d3 <__rodata_start+0x113>
+  80305a:	00 6f 75             	add    %ch,0x75(%rdi)
+  80305d:	74 20                	je     80307f <__rodata_start+0xbf>
+  80305f:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803060:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  803064:	76 69                	jbe    8030cf <__rodata_start+0x10f>
+  803066:	72 6f                	jb     8030d7 <__rodata_start+0x117>
+  803068:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803069:	6d                   	insl   (%dx),%es:(%rdi)
+  80306a:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  80306c:	74 73                	je     8030e1 <__rodata_start+0x121>
+  80306e:	00 63 6f             	add    %ah,0x6f(%rbx)
+  803071:	72 72                	jb     8030e5 <__rodata_start+0x125>
+  803073:	75 70                	jne    8030e5 <__rodata_start+0x125>
+  803075:	74 65                	je     8030dc <__rodata_start+0x11c>
+  803077:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  80307c:	75 67                	jne    8030e5 <__rodata_start+0x125>
+  80307e:	20 69 6e             	and    %ch,0x6e(%rcx)
+  803081:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  803083:	00 73 65             	add    %dh,0x65(%rbx)
+  803086:	67 6d                	insl   (%dx),%es:(%edi)
+  803088:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  80308a:	74 61                	je     8030ed <__rodata_start+0x12d>
+  80308c:	74 69                	je     8030f7 <__rodata_start+0x137>
+  80308e:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80308f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803090:	20 66 61             	and    %ah,0x61(%rsi)
+  803093:	75 6c                	jne    803101 <__rodata_start+0x141>
+  803095:	74 00                	je     803097 <__rodata_start+0xd7>
+  803097:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  80309e:	20 45 4c             	and    %al,0x4c(%rbp)
+  8030a1:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  8030a5:	61                   	(bad)
+  8030a6:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  8030ab:	20 73 75             	and    %dh,0x75(%rbx)
+  8030ae:	63 68 20             	movsxd 0x20(%rax),%ebp
+  8030b1:	73 79                	jae    80312c <__rodata_start+0x16c>
+  8030b3:	73 74                	jae    803129 <__rodata_start+0x169>
+  8030b5:	65 6d                	gs insl (%dx),%es:(%rdi)
+  8030b7:	20 63 61             	and    %ah,0x61(%rbx)
+  8030ba:	6c                   	insb   (%dx),%es:(%rdi)
+  8030bb:	6c                   	insb   (%dx),%es:(%rdi)
+  8030bc:	00 65 6e             	add    %ah,0x6e(%rbp)
+  8030bf:	74 72                	je     803133 <__rodata_start+0x173>
+  8030c1:	79 20                	jns    8030e3 <__rodata_start+0x123>
+  8030c3:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8030c4:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8030c5:	74 20                	je     8030e7 <__rodata_start+0x127>
+  8030c7:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  8030c9:	75 6e                	jne    803139 <__rodata_start+0x179>
+  8030cb:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  8030cf:	76 20                	jbe    8030f1 <__rodata_start+0x131>
+  8030d1:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  8030d8:	72 65                	jb     80313f <__rodata_start+0x17f>
+  8030da:	63 76 69             	movsxd 0x69(%rsi),%esi
+  8030dd:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8030de:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  8030e2:	65 78 70             	gs js  803155 <__rodata_start+0x195>
+  8030e5:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  8030ea:	20 65 6e             	and    %ah,0x6e(%rbp)
+  8030ed:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  8030f1:	20 66 69             	and    %ah,0x69(%rsi)
+  8030f4:	6c                   	insb   (%dx),%es:(%rdi)
+  8030f5:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  8030f9:	20 66 72             	and    %ah,0x72(%rsi)
+  8030fc:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  803101:	61                   	(bad)
+  803102:	63 65 20             	movsxd 0x20(%rbp),%esp
+  803105:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803106:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803107:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  80310b:	6b 00 74             	imul   $0x74,(%rax),%eax
+  80310e:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80310f:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803110:	20 6d 61             	and    %ch,0x61(%rbp)
+  803113:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803114:	79 20                	jns    803136 <__rodata_start+0x176>
+  803116:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  80311d:	72 65                	jb     803184 <__rodata_start+0x1c4>
+  80311f:	20 6f 70             	and    %ch,0x70(%rdi)
+  803122:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803124:	00 66 69             	add    %ah,0x69(%rsi)
+  803127:	6c                   	insb   (%dx),%es:(%rdi)
+  803128:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  80312c:	20 62 6c             	and    %ah,0x6c(%rdx)
+  80312f:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803130:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  803133:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803134:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803135:	74 20                	je     803157 <__rodata_start+0x197>
+  803137:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  803139:	75 6e                	jne    8031a9 <__rodata_start+0x1e9>
+  80313b:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  80313f:	76 61                	jbe    8031a2 <__rodata_start+0x1e2>
+  803141:	6c                   	insb   (%dx),%es:(%rdi)
+  803142:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  803149:	00 
+  80314a:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  803151:	72 65                	jb     8031b8 <__rodata_start+0x1f8>
+  803153:	61                   	(bad)
+  803154:	64 79 20             	fs jns 803177 <__rodata_start+0x1b7>
+  803157:	65 78 69             	gs js  8031c3 <__rodata_start+0x203>
+  80315a:	73 74                	jae    8031d0 <__rodata_start+0x210>
+  80315c:	73 00                	jae    80315e <__rodata_start+0x19e>
+  80315e:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80315f:	70 65                	jo     8031c6 <__rodata_start+0x206>
+  803161:	72 61                	jb     8031c4 <__rodata_start+0x204>
+  803163:	74 69                	je     8031ce <__rodata_start+0x20e>
+  803165:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803166:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803167:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  80316a:	74 20                	je     80318c <__rodata_start+0x1cc>
+  80316c:	73 75                	jae    8031e3 <__rodata_start+0x223>
+  80316e:	70 70                	jo     8031e0 <__rodata_start+0x220>
+  803170:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803171:	72 74                	jb     8031e7 <__rodata_start+0x227>
+  803173:	65 64 00 6f 70       	gs add %ch,%fs:0x70(%rdi)
+  803178:	65 72 61             	gs jb  8031dc <__rodata_start+0x21c>
+  80317b:	74 69                	je     8031e6 <__rodata_start+0x226>
+  80317d:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80317e:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80317f:	20 69 6e             	and    %ch,0x6e(%rcx)
+  803182:	74 65                	je     8031e9 <__rodata_start+0x229>
+  803184:	72 72                	jb     8031f8 <__rodata_start+0x238>
+  803186:	75 70                	jne    8031f8 <__rodata_start+0x238>
+  803188:	74 65                	je     8031ef <__rodata_start+0x22f>
+  80318a:	64 00 6e 6f          	add    %ch,%fs:0x6f(%rsi)
+  80318e:	74 20                	je     8031b0 <__rodata_start+0x1f0>
+  803190:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803192:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803193:	75 67                	jne    8031fc <__rodata_start+0x23c>
+  803195:	68 20 43 50 55       	push   $0x55504320
+  80319a:	20 74 69 6d          	and    %dh,0x6d(%rcx,%rbp,2)
+  80319e:	65 00 fb             	gs add %bh,%bl
+  8031a1:	03 80 00 00 00 00    	add    0x0(%rax),%eax
+  8031a7:	00 3c 0a             	add    %bh,(%rdx,%rcx,1)
+  8031aa:	80 00 00             	addb   $0x0,(%rax)
+  8031ad:	00 00                	add    %al,(%rax)
+  8031af:	00 2c 0a             	add    %ch,(%rdx,%rcx,1)
+  8031b2:	80 00 00             	addb   $0x0,(%rax)
+  8031b5:	00 00                	add    %al,(%rax)
+  8031b7:	00 3c 0a             	add    %bh,(%rdx,%rcx,1)
+  8031ba:	80 00 00             	addb   $0x0,(%rax)
+  8031bd:	00 00                	add    %al,(%rax)
+  8031bf:	00 3c 0a             	add    %bh,(%rdx,%rcx,1)
+  8031c2:	80 00 00             	addb   $0x0,(%rax)
+  8031c5:	00 00                	add    %al,(%rax)
+  8031c7:	00 3c 0a             	add    %bh,(%rdx,%rcx,1)
+  8031ca:	80 00 00             	addb   $0x0,(%rax)
+  8031cd:	00 00                	add    %al,(%rax)
+  8031cf:	00 3c 0a             	add    %bh,(%rdx,%rcx,1)
+  8031d2:	80 00 00             	addb   $0x0,(%rax)
+  8031d5:	00 00                	add    %al,(%rax)
+  8031d7:	00 1a                	add    %bl,(%rdx)
+  8031d9:	04 80                	add    $0x80,%al
+  8031db:	00 00                	add    %al,(%rax)
+  8031dd:	00 00                	add    %al,(%rax)
+  8031df:	00 3c 0a             	add    %bh,(%rdx,%rcx,1)
+  8031e2:	80 00 00             	addb   $0x0,(%rax)
+  8031e5:	00 00                	add    %al,(%rax)
+  8031e7:	00 3c 0a             	add    %bh,(%rdx,%rcx,1)
+  8031ea:	80 00 00             	addb   $0x0,(%rax)
+  8031ed:	00 00                	add    %al,(%rax)
+  8031ef:	00 0e                	add    %cl,(%rsi)
+  8031f1:	04 80                	add    $0x80,%al
+  8031f3:	00 00                	add    %al,(%rax)
+  8031f5:	00 00                	add    %al,(%rax)
+  8031f7:	00 88 04 80 00 00    	add    %cl,0x8004(%rax)
+  8031fd:	00 00                	add    %al,(%rax)
+  8031ff:	00 3c 0a             	add    %bh,(%rdx,%rcx,1)
+  803202:	80 00 00             	addb   $0x0,(%rax)
+  803205:	00 00                	add    %al,(%rax)
+  803207:	00 0e                	add    %cl,(%rsi)
+  803209:	04 80                	add    $0x80,%al
+  80320b:	00 00                	add    %al,(%rax)
+  80320d:	00 00                	add    %al,(%rax)
+  80320f:	00 54 04 80          	add    %dl,-0x80(%rsp,%rax,1)
+  803213:	00 00                	add    %al,(%rax)
+  803215:	00 00                	add    %al,(%rax)
+  803217:	00 54 04 80          	add    %dl,-0x80(%rsp,%rax,1)
+  80321b:	00 00                	add    %al,(%rax)
+  80321d:	00 00                	add    %al,(%rax)
+  80321f:	00 54 04 80          	add    %dl,-0x80(%rsp,%rax,1)
+  803223:	00 00                	add    %al,(%rax)
+  803225:	00 00                	add    %al,(%rax)
+  803227:	00 54 04 80          	add    %dl,-0x80(%rsp,%rax,1)
+  80322b:	00 00                	add    %al,(%rax)
+  80322d:	00 00                	add    %al,(%rax)
+  80322f:	00 54 04 80          	add    %dl,-0x80(%rsp,%rax,1)
+  803233:	00 00                	add    %al,(%rax)
+  803235:	00 00                	add    %al,(%rax)
+  803237:	00 54 04 80          	add    %dl,-0x80(%rsp,%rax,1)
+  80323b:	00 00                	add    %al,(%rax)
+  80323d:	00 00                	add    %al,(%rax)
+  80323f:	00 54 04 80          	add    %dl,-0x80(%rsp,%rax,1)
+  803243:	00 00                	add    %al,(%rax)
+  803245:	00 00                	add    %al,(%rax)
+  803247:	00 54 04 80          	add    %dl,-0x80(%rsp,%rax,1)
+  80324b:	00 00                	add    %al,(%rax)
+  80324d:	00 00                	add    %al,(%rax)
+  80324f:	00 54 04 80          	add    %dl,-0x80(%rsp,%rax,1)
+  803253:	00 00                	add    %al,(%rax)
+  803255:	00 00                	add    %al,(%rax)
+  803257:	00 3c 0a             	add    %bh,(%rdx,%rcx,1)
+  80325a:	80 00 00             	addb   $0x0,(%rax)
+  80325d:	00 00                	add    %al,(%rax)
+  80325f:	00 3c 0a             	add    %bh,(%rdx,%rcx,1)
+  803262:	80 00 00             	addb   $0x0,(%rax)
+  803265:	00 00                	add    %al,(%rax)
+  803267:	00 3c 0a             	add    %bh,(%rdx,%rcx,1)
+  80326a:	80 00 00             	addb   $0x0,(%rax)
+  80326d:	00 00                	add    %al,(%rax)
+  80326f:	00 3c 0a             	add    %bh,(%rdx,%rcx,1)
+  803272:	80 00 00             	addb   $0x0,(%rax)
+  803275:	00 00                	add    %al,(%rax)
+  803277:	00 3c 0a             	add    %bh,(%rdx,%rcx,1)
+  80327a:	80 00 00             	addb   $0x0,(%rax)
+  80327d:	00 00                	add    %al,(%rax)
+  80327f:	00 3c 0a             	add    %bh,(%rdx,%rcx,1)
+  803282:	80 00 00             	addb   $0x0,(%rax)
+  803285:	00 00                	add    %al,(%rax)
+  803287:	00 3c 0a             	add    %bh,(%rdx,%rcx,1)
+  80328a:	80 00 00             	addb   $0x0,(%rax)
+  80328d:	00 00                	add    %al,(%rax)
+  80328f:	00 3c 0a             	add    %bh,(%rdx,%rcx,1)
+  803292:	80 00 00             	addb   $0x0,(%rax)
+  803295:	00 00                	add    %al,(%rax)
+  803297:	00 3c 0a             	add    %bh,(%rdx,%rcx,1)
+  80329a:	80 00 00             	addb   $0x0,(%rax)
+  80329d:	00 00                	add    %al,(%rax)
+  80329f:	00 3c 0a             	add    %bh,(%rdx,%rcx,1)
+  8032a2:	80 00 00             	addb   $0x0,(%rax)
+  8032a5:	00 00                	add    %al,(%rax)
+  8032a7:	00 3c 0a             	add    %bh,(%rdx,%rcx,1)
+  8032aa:	80 00 00             	addb   $0x0,(%rax)
+  8032ad:	00 00                	add    %al,(%rax)
+  8032af:	00 3c 0a             	add    %bh,(%rdx,%rcx,1)
+  8032b2:	80 00 00             	addb   $0x0,(%rax)
+  8032b5:	00 00                	add    %al,(%rax)
+  8032b7:	00 3c 0a             	add    %bh,(%rdx,%rcx,1)
+  8032ba:	80 00 00             	addb   $0x0,(%rax)
+  8032bd:	00 00                	add    %al,(%rax)
+  8032bf:	00 3c 0a             	add    %bh,(%rdx,%rcx,1)
+  8032c2:	80 00 00             	addb   $0x0,(%rax)
+  8032c5:	00 00                	add    %al,(%rax)
+  8032c7:	00 3c 0a             	add    %bh,(%rdx,%rcx,1)
+  8032ca:	80 00 00             	addb   $0x0,(%rax)
+  8032cd:	00 00                	add    %al,(%rax)
+  8032cf:	00 3c 0a             	add    %bh,(%rdx,%rcx,1)
+  8032d2:	80 00 00             	addb   $0x0,(%rax)
+  8032d5:	00 00                	add    %al,(%rax)
+  8032d7:	00 3c 0a             	add    %bh,(%rdx,%rcx,1)
+  8032da:	80 00 00             	addb   $0x0,(%rax)
+  8032dd:	00 00                	add    %al,(%rax)
+  8032df:	00 3c 0a             	add    %bh,(%rdx,%rcx,1)
+  8032e2:	80 00 00             	addb   $0x0,(%rax)
+  8032e5:	00 00                	add    %al,(%rax)
+  8032e7:	00 3c 0a             	add    %bh,(%rdx,%rcx,1)
+  8032ea:	80 00 00             	addb   $0x0,(%rax)
+  8032ed:	00 00                	add    %al,(%rax)
+  8032ef:	00 3c 0a             	add    %bh,(%rdx,%rcx,1)
+  8032f2:	80 00 00             	addb   $0x0,(%rax)
+  8032f5:	00 00                	add    %al,(%rax)
+  8032f7:	00 3c 0a             	add    %bh,(%rdx,%rcx,1)
+  8032fa:	80 00 00             	addb   $0x0,(%rax)
+  8032fd:	00 00                	add    %al,(%rax)
+  8032ff:	00 3c 0a             	add    %bh,(%rdx,%rcx,1)
+  803302:	80 00 00             	addb   $0x0,(%rax)
+  803305:	00 00                	add    %al,(%rax)
+  803307:	00 3c 0a             	add    %bh,(%rdx,%rcx,1)
+  80330a:	80 00 00             	addb   $0x0,(%rax)
+  80330d:	00 00                	add    %al,(%rax)
+  80330f:	00 3c 0a             	add    %bh,(%rdx,%rcx,1)
+  803312:	80 00 00             	addb   $0x0,(%rax)
+  803315:	00 00                	add    %al,(%rax)
+  803317:	00 3c 0a             	add    %bh,(%rdx,%rcx,1)
+  80331a:	80 00 00             	addb   $0x0,(%rax)
+  80331d:	00 00                	add    %al,(%rax)
+  80331f:	00 3c 0a             	add    %bh,(%rdx,%rcx,1)
+  803322:	80 00 00             	addb   $0x0,(%rax)
+  803325:	00 00                	add    %al,(%rax)
+  803327:	00 3c 0a             	add    %bh,(%rdx,%rcx,1)
+  80332a:	80 00 00             	addb   $0x0,(%rax)
+  80332d:	00 00                	add    %al,(%rax)
+  80332f:	00 3c 0a             	add    %bh,(%rdx,%rcx,1)
+  803332:	80 00 00             	addb   $0x0,(%rax)
+  803335:	00 00                	add    %al,(%rax)
+  803337:	00 3c 0a             	add    %bh,(%rdx,%rcx,1)
+  80333a:	80 00 00             	addb   $0x0,(%rax)
+  80333d:	00 00                	add    %al,(%rax)
+  80333f:	00 3c 0a             	add    %bh,(%rdx,%rcx,1)
+  803342:	80 00 00             	addb   $0x0,(%rax)
+  803345:	00 00                	add    %al,(%rax)
+  803347:	00 5f 09             	add    %bl,0x9(%rdi)
+  80334a:	80 00 00             	addb   $0x0,(%rax)
+  80334d:	00 00                	add    %al,(%rax)
+  80334f:	00 3c 0a             	add    %bh,(%rdx,%rcx,1)
+  803352:	80 00 00             	addb   $0x0,(%rax)
+  803355:	00 00                	add    %al,(%rax)
+  803357:	00 3c 0a             	add    %bh,(%rdx,%rcx,1)
+  80335a:	80 00 00             	addb   $0x0,(%rax)
+  80335d:	00 00                	add    %al,(%rax)
+  80335f:	00 3c 0a             	add    %bh,(%rdx,%rcx,1)
+  803362:	80 00 00             	addb   $0x0,(%rax)
+  803365:	00 00                	add    %al,(%rax)
+  803367:	00 3c 0a             	add    %bh,(%rdx,%rcx,1)
+  80336a:	80 00 00             	addb   $0x0,(%rax)
+  80336d:	00 00                	add    %al,(%rax)
+  80336f:	00 3c 0a             	add    %bh,(%rdx,%rcx,1)
+  803372:	80 00 00             	addb   $0x0,(%rax)
+  803375:	00 00                	add    %al,(%rax)
+  803377:	00 3c 0a             	add    %bh,(%rdx,%rcx,1)
+  80337a:	80 00 00             	addb   $0x0,(%rax)
+  80337d:	00 00                	add    %al,(%rax)
+  80337f:	00 3c 0a             	add    %bh,(%rdx,%rcx,1)
+  803382:	80 00 00             	addb   $0x0,(%rax)
+  803385:	00 00                	add    %al,(%rax)
+  803387:	00 3c 0a             	add    %bh,(%rdx,%rcx,1)
+  80338a:	80 00 00             	addb   $0x0,(%rax)
+  80338d:	00 00                	add    %al,(%rax)
+  80338f:	00 3c 0a             	add    %bh,(%rdx,%rcx,1)
+  803392:	80 00 00             	addb   $0x0,(%rax)
+  803395:	00 00                	add    %al,(%rax)
+  803397:	00 3c 0a             	add    %bh,(%rdx,%rcx,1)
+  80339a:	80 00 00             	addb   $0x0,(%rax)
+  80339d:	00 00                	add    %al,(%rax)
+  80339f:	00 ab 04 80 00 00    	add    %ch,0x8004(%rbx)
+  8033a5:	00 00                	add    %al,(%rax)
+  8033a7:	00 7a 06             	add    %bh,0x6(%rdx)
+  8033aa:	80 00 00             	addb   $0x0,(%rax)
+  8033ad:	00 00                	add    %al,(%rax)
+  8033af:	00 3c 0a             	add    %bh,(%rdx,%rcx,1)
+  8033b2:	80 00 00             	addb   $0x0,(%rax)
+  8033b5:	00 00                	add    %al,(%rax)
+  8033b7:	00 3c 0a             	add    %bh,(%rdx,%rcx,1)
+  8033ba:	80 00 00             	addb   $0x0,(%rax)
+  8033bd:	00 00                	add    %al,(%rax)
+  8033bf:	00 3c 0a             	add    %bh,(%rdx,%rcx,1)
+  8033c2:	80 00 00             	addb   $0x0,(%rax)
+  8033c5:	00 00                	add    %al,(%rax)
+  8033c7:	00 3c 0a             	add    %bh,(%rdx,%rcx,1)
+  8033ca:	80 00 00             	addb   $0x0,(%rax)
+  8033cd:	00 00                	add    %al,(%rax)
+  8033cf:	00 da                	add    %bl,%dl
+  8033d1:	04 80                	add    $0x80,%al
+  8033d3:	00 00                	add    %al,(%rax)
+  8033d5:	00 00                	add    %al,(%rax)
+  8033d7:	00 3c 0a             	add    %bh,(%rdx,%rcx,1)
+  8033da:	80 00 00             	addb   $0x0,(%rax)
+  8033dd:	00 00                	add    %al,(%rax)
+  8033df:	00 3c 0a             	add    %bh,(%rdx,%rcx,1)
+  8033e2:	80 00 00             	addb   $0x0,(%rax)
+  8033e5:	00 00                	add    %al,(%rax)
+  8033e7:	00 a0 04 80 00 00    	add    %ah,0x8004(%rax)
+  8033ed:	00 00                	add    %al,(%rax)
+  8033ef:	00 3c 0a             	add    %bh,(%rdx,%rcx,1)
+  8033f2:	80 00 00             	addb   $0x0,(%rax)
+  8033f5:	00 00                	add    %al,(%rax)
+  8033f7:	00 3c 0a             	add    %bh,(%rdx,%rcx,1)
+  8033fa:	80 00 00             	addb   $0x0,(%rax)
+  8033fd:	00 00                	add    %al,(%rax)
+  8033ff:	00 22                	add    %ah,(%rdx)
+  803401:	08 80 00 00 00 00    	or     %al,0x0(%rax)
+  803407:	00 ec                	add    %ch,%ah
+  803409:	08 80 00 00 00 00    	or     %al,0x0(%rax)
+  80340f:	00 3c 0a             	add    %bh,(%rdx,%rcx,1)
+  803412:	80 00 00             	addb   $0x0,(%rax)
+  803415:	00 00                	add    %al,(%rax)
+  803417:	00 3c 0a             	add    %bh,(%rdx,%rcx,1)
+  80341a:	80 00 00             	addb   $0x0,(%rax)
+  80341d:	00 00                	add    %al,(%rax)
+  80341f:	00 71 05             	add    %dh,0x5(%rcx)
+  803422:	80 00 00             	addb   $0x0,(%rax)
+  803425:	00 00                	add    %al,(%rax)
+  803427:	00 3c 0a             	add    %bh,(%rdx,%rcx,1)
+  80342a:	80 00 00             	addb   $0x0,(%rax)
+  80342d:	00 00                	add    %al,(%rax)
+  80342f:	00 4e 07             	add    %cl,0x7(%rsi)
+  803432:	80 00 00             	addb   $0x0,(%rax)
+  803435:	00 00                	add    %al,(%rax)
+  803437:	00 3c 0a             	add    %bh,(%rdx,%rcx,1)
+  80343a:	80 00 00             	addb   $0x0,(%rax)
+  80343d:	00 00                	add    %al,(%rax)
+  80343f:	00 3c 0a             	add    %bh,(%rdx,%rcx,1)
+  803442:	80 00 00             	addb   $0x0,(%rax)
+  803445:	00 00                	add    %al,(%rax)
+  803447:	00 5f 09             	add    %bl,0x9(%rdi)
+  80344a:	80 00 00             	addb   $0x0,(%rax)
+  80344d:	00 00                	add    %al,(%rax)
+  80344f:	00 3c 0a             	add    %bh,(%rdx,%rcx,1)
+  803452:	80 00 00             	addb   $0x0,(%rax)
+  803455:	00 00                	add    %al,(%rax)
+  803457:	00 04 04             	add    %al,(%rsp,%rax,1)
+  80345a:	80 00 00             	addb   $0x0,(%rax)
+  80345d:	00 00                	add    %al,(%rax)
+	...
+
+0000000000803460 <error_string>:
+	...
+  803468:	19 30 80 00 00 00 00 00 2b 30 80 00 00 00 00 00     .0......+0......
+  803478:	3b 30 80 00 00 00 00 00 4d 30 80 00 00 00 00 00     ;0......M0......
+  803488:	5b 30 80 00 00 00 00 00 6f 30 80 00 00 00 00 00     [0......o0......
+  803498:	84 30 80 00 00 00 00 00 97 30 80 00 00 00 00 00     .0.......0......
+  8034a8:	a9 30 80 00 00 00 00 00 bd 30 80 00 00 00 00 00     .0.......0......
+  8034b8:	cd 30 80 00 00 00 00 00 e0 30 80 00 00 00 00 00     .0.......0......
+  8034c8:	f7 30 80 00 00 00 00 00 0d 31 80 00 00 00 00 00     .0.......1......
+  8034d8:	25 31 80 00 00 00 00 00 3d 31 80 00 00 00 00 00     %1......=1......
+  8034e8:	4a 31 80 00 00 00 00 00 10 35 80 00 00 00 00 00     J1.......5......
+  8034f8:	5e 31 80 00 00 00 00 00 76 31 80 00 00 00 00 00     ^1......v1......
+  803508:	8c 31 80 00 00 00 00 00 66 69 6c 65 20 69 73 20     .1......file is 
+  803518:	6e 6f 74 20 61 20 76 61 6c 69 64 20 65 78 65 63     not a valid exec
+  803528:	75 74 61 62 6c 65 00 90 73 79 73 63 61 6c 6c 20     utable..syscall 
+  803538:	25 7a 64 20 72 65 74 75 72 6e 65 64 20 25 7a 64     %zd returned %zd
+  803548:	20 28 3e 20 30 29 00 6c 69 62 2f 73 79 73 63 61      (> 0).lib/sysca
+  803558:	6c 6c 2e 63 00 0f 1f 00 55 73 65 72 73 70 61 63     ll.c....Userspac
+  803568:	65 20 70 61 67 65 20 66 61 75 6c 74 20 72 69 70     e page fault rip
+  803578:	3d 25 30 38 6c 58 20 76 61 3d 25 30 38 6c 58 20     =%08lX va=%08lX 
+  803588:	65 72 72 3d 25 78 0a 00 6c 69 62 2f 70 67 66 61     err=%x..lib/pgfa
+  803598:	75 6c 74 2e 63 00 73 65 74 5f 70 67 66 61 75 6c     ult.c.set_pgfaul
+  8035a8:	74 5f 68 61 6e 64 6c 65 72 3a 20 25 69 00 5f 70     t_handler: %i._p
+  8035b8:	66 68 61 6e 64 6c 65 72 5f 69 6e 69 74 69 74 69     fhandler_inititi
+  8035c8:	61 6c 6c 69 7a 65 64 00 61 73 73 65 72 74 69 6f     allized.assertio
+  8035d8:	6e 20 66 61 69 6c 65 64 3a 20 25 73 00 0f 1f 00     n failed: %s....
+  8035e8:	5b 25 30 38 78 5d 20 75 6e 6b 6e 6f 77 6e 20 64     [%08x] unknown d
+  8035f8:	65 76 69 63 65 20 74 79 70 65 20 25 64 0a 00 00     evice type %d...
+  803608:	5b 25 30 38 78 5d 20 66 74 72 75 6e 63 61 74 65     [%08x] ftruncate
+  803618:	20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65 0a      %d -- bad mode.
+  803628:	00 5b 25 30 38 78 5d 20 72 65 61 64 20 25 64 20     .[%08x] read %d 
+  803638:	2d 2d 20 62 61 64 20 6d 6f 64 65 0a 00 5b 25 30     -- bad mode..[%0
+  803648:	38 78 5d 20 77 72 69 74 65 20 25 64 20 2d 2d 20     8x] write %d -- 
+  803658:	62 61 64 20 6d 6f 64 65 0a 00 66 2e 0f 1f 84 00     bad mode..f.....
+  803668:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803678:	0f 1f 84 00 00 00 00 00                             ........
+
+0000000000803680 <devtab>:
+  803680:	20 40 80 00 00 00 00 00 60 40 80 00 00 00 00 00      @......`@......
+  803690:	a0 40 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .@..............
+  8036a0:	3c 70 69 70 65 3e 00 6c 69 62 2f 70 69 70 65 2e     <pipe>.lib/pipe.
+  8036b0:	63 00 70 69 70 65 00 90 73 79 73 5f 72 65 67 69     c.pipe..sys_regi
+  8036c0:	6f 6e 5f 72 65 66 73 28 76 61 2c 20 50 41 47 45     on_refs(va, PAGE
+  8036d0:	5f 53 49 5a 45 29 20 3d 3d 20 32 00 3c 63 6f 6e     _SIZE) == 2.<con
+  8036e0:	73 3e 00 63 6f 6e 73 00 5b 25 30 38 78 5d 20 75     s>.cons.[%08x] u
+  8036f0:	73 65 72 20 70 61 6e 69 63 20 69 6e 20 25 73 20     ser panic in %s 
+  803700:	61 74 20 25 73 3a 25 64 3a 20 00 73 79 73 5f 69     at %s:%d: .sys_i
+  803710:	70 63 5f 74 72 79 5f 73 65 6e 64 20 66 61 69 6c     pc_try_send fail
+  803720:	65 64 3a 20 25 69 00 6c 69 62 2f 69 70 63 2e 63     ed: %i.lib/ipc.c
+  803730:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803740:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803750:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803760:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803770:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803780:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803790:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8037a0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8037b0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8037c0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8037d0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8037e0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8037f0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803800:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803810:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803820:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803830:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803840:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803850:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803860:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803870:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803880:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803890:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8038a0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8038b0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8038c0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8038d0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8038e0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8038f0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803900:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803910:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803920:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803930:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803940:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803950:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803960:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803970:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803980:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803990:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8039a0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8039b0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8039c0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8039d0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8039e0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8039f0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803a00:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803a10:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803a20:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803a30:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803a40:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803a50:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803a60:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803a70:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803a80:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803a90:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803aa0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803ab0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803ac0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803ad0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803ae0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803af0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803b00:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803b10:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803b20:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803b30:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803b40:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803b50:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803b60:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803b70:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803b80:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803b90:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803ba0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803bb0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803bc0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803bd0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803be0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803bf0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803c00:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803c10:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803c20:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803c30:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803c40:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803c50:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803c60:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803c70:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803c80:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803c90:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803ca0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803cb0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803cc0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803cd0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803ce0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803cf0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803d00:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803d10:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803d20:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803d30:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803d40:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803d50:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803d60:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803d70:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803d80:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803d90:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803da0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803db0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803dc0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803dd0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803de0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803df0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803e00:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803e10:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803e20:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803e30:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803e40:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803e50:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803e60:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803e70:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803e80:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803e90:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803ea0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803eb0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803ec0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803ed0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803ee0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803ef0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803f00:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803f10:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803f20:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803f30:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803f40:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803f50:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803f60:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803f70:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803f80:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803f90:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803fa0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803fb0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803fc0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803fd0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803fe0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803ff0:	00 66 2e 0f 1f 84 00 00 00 00 00 0f 1f 44 00 00     .f...........D..
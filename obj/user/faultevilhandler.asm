@@ -0,0 +1,5450 @@
+
+obj/user/faultevilhandler:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 4e 00 00 00       	call   800071 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+/* Test evil pointer for user-level fault handler */
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+#ifndef __clang_analyzer__
+    sys_alloc_region(0, (void *)(USER_EXCEPTION_STACK_TOP - PAGE_SIZE), PAGE_SIZE, PROT_RW);
+  800029:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80002e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800033:	48 be 00 f0 ff ff 7f 	movabs $0x7ffffff000,%rsi
+  80003a:	00 00 00 
+  80003d:	bf 00 00 00 00       	mov    $0x0,%edi
+  800042:	48 b8 c6 02 80 00 00 	movabs $0x8002c6,%rax
+  800049:	00 00 00 
+  80004c:	ff d0                	call   *%rax
+    sys_env_set_pgfault_upcall(0, (void *)0xF0100020);
+  80004e:	be 20 00 10 f0       	mov    $0xf0100020,%esi
+  800053:	bf 00 00 00 00       	mov    $0x0,%edi
+  800058:	48 b8 03 06 80 00 00 	movabs $0x800603,%rax
+  80005f:	00 00 00 
+  800062:	ff d0                	call   *%rax
+    *(volatile int *)0 = 0;
+  800064:	c7 04 25 00 00 00 00 	movl   $0x0,0x0
+  80006b:	00 00 00 00 
+#endif
+}
+  80006f:	5d                   	pop    %rbp
+  800070:	c3                   	ret
+
+0000000000800071 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800071:	55                   	push   %rbp
+  800072:	48 89 e5             	mov    %rsp,%rbp
+  800075:	41 56                	push   %r14
+  800077:	41 55                	push   %r13
+  800079:	41 54                	push   %r12
+  80007b:	53                   	push   %rbx
+  80007c:	41 89 fd             	mov    %edi,%r13d
+  80007f:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800082:	48 ba d8 40 80 00 00 	movabs $0x8040d8,%rdx
+  800089:	00 00 00 
+  80008c:	48 b8 d8 40 80 00 00 	movabs $0x8040d8,%rax
+  800093:	00 00 00 
+  800096:	48 39 c2             	cmp    %rax,%rdx
+  800099:	73 17                	jae    8000b2 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  80009b:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  80009e:	49 89 c4             	mov    %rax,%r12
+  8000a1:	48 83 c3 08          	add    $0x8,%rbx
+  8000a5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000aa:	ff 53 f8             	call   *-0x8(%rbx)
+  8000ad:	4c 39 e3             	cmp    %r12,%rbx
+  8000b0:	72 ef                	jb     8000a1 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+    envid_t this_env_id = sys_getenvid();
+  8000b2:	48 b8 06 02 80 00 00 	movabs $0x800206,%rax
+  8000b9:	00 00 00 
+  8000bc:	ff d0                	call   *%rax
+    thisenv = &((struct Env*)UENVS)[ENVX(this_env_id)];
+  8000be:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8000c3:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+  8000ca:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8000d1:	00 00 00 
+  8000d4:	48 01 d0             	add    %rdx,%rax
+  8000d7:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  8000de:	00 00 00 
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8000e1:	45 85 ed             	test   %r13d,%r13d
+  8000e4:	7e 0d                	jle    8000f3 <libmain+0x82>
+  8000e6:	49 8b 06             	mov    (%r14),%rax
+  8000e9:	48 a3 00 40 80 00 00 	movabs %rax,0x804000
+  8000f0:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8000f3:	4c 89 f6             	mov    %r14,%rsi
+  8000f6:	44 89 ef             	mov    %r13d,%edi
+  8000f9:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  800100:	00 00 00 
+  800103:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  800105:	48 b8 1a 01 80 00 00 	movabs $0x80011a,%rax
+  80010c:	00 00 00 
+  80010f:	ff d0                	call   *%rax
+#endif
+}
+  800111:	5b                   	pop    %rbx
+  800112:	41 5c                	pop    %r12
+  800114:	41 5d                	pop    %r13
+  800116:	41 5e                	pop    %r14
+  800118:	5d                   	pop    %rbp
+  800119:	c3                   	ret
+
+000000000080011a <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  80011a:	55                   	push   %rbp
+  80011b:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  80011e:	48 b8 5a 09 80 00 00 	movabs $0x80095a,%rax
+  800125:	00 00 00 
+  800128:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  80012a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80012f:	48 b8 9b 01 80 00 00 	movabs $0x80019b,%rax
+  800136:	00 00 00 
+  800139:	ff d0                	call   *%rax
+}
+  80013b:	5d                   	pop    %rbp
+  80013c:	c3                   	ret
+
+000000000080013d <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  80013d:	55                   	push   %rbp
+  80013e:	48 89 e5             	mov    %rsp,%rbp
+  800141:	53                   	push   %rbx
+  800142:	48 89 fa             	mov    %rdi,%rdx
+  800145:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  800148:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80014d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800152:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800157:	be 00 00 00 00       	mov    $0x0,%esi
+  80015c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800162:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  800164:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800168:	c9                   	leave
+  800169:	c3                   	ret
+
+000000000080016a <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  80016a:	55                   	push   %rbp
+  80016b:	48 89 e5             	mov    %rsp,%rbp
+  80016e:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80016f:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800174:	ba 00 00 00 00       	mov    $0x0,%edx
+  800179:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80017e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800183:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800188:	be 00 00 00 00       	mov    $0x0,%esi
+  80018d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800193:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  800195:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800199:	c9                   	leave
+  80019a:	c3                   	ret
+
+000000000080019b <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  80019b:	55                   	push   %rbp
+  80019c:	48 89 e5             	mov    %rsp,%rbp
+  80019f:	53                   	push   %rbx
+  8001a0:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  8001a4:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8001a7:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8001ac:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8001b1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8001b6:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8001bb:	be 00 00 00 00       	mov    $0x0,%esi
+  8001c0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8001c6:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8001c8:	48 85 c0             	test   %rax,%rax
+  8001cb:	7f 06                	jg     8001d3 <sys_env_destroy+0x38>
+}
+  8001cd:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8001d1:	c9                   	leave
+  8001d2:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8001d3:	49 89 c0             	mov    %rax,%r8
+  8001d6:	b9 03 00 00 00       	mov    $0x3,%ecx
+  8001db:	48 ba d0 2c 80 00 00 	movabs $0x802cd0,%rdx
+  8001e2:	00 00 00 
+  8001e5:	be 26 00 00 00       	mov    $0x26,%esi
+  8001ea:	48 bf ef 2c 80 00 00 	movabs $0x802cef,%rdi
+  8001f1:	00 00 00 
+  8001f4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001f9:	49 b9 57 1c 80 00 00 	movabs $0x801c57,%r9
+  800200:	00 00 00 
+  800203:	41 ff d1             	call   *%r9
+
+0000000000800206 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  800206:	55                   	push   %rbp
+  800207:	48 89 e5             	mov    %rsp,%rbp
+  80020a:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80020b:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800210:	ba 00 00 00 00       	mov    $0x0,%edx
+  800215:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80021a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80021f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800224:	be 00 00 00 00       	mov    $0x0,%esi
+  800229:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80022f:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  800231:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800235:	c9                   	leave
+  800236:	c3                   	ret
+
+0000000000800237 <sys_yield>:
+
+void
+sys_yield(void) {
+  800237:	55                   	push   %rbp
+  800238:	48 89 e5             	mov    %rsp,%rbp
+  80023b:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80023c:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800241:	ba 00 00 00 00       	mov    $0x0,%edx
+  800246:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80024b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800250:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800255:	be 00 00 00 00       	mov    $0x0,%esi
+  80025a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800260:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  800262:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800266:	c9                   	leave
+  800267:	c3                   	ret
+
+0000000000800268 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  800268:	55                   	push   %rbp
+  800269:	48 89 e5             	mov    %rsp,%rbp
+  80026c:	53                   	push   %rbx
+  80026d:	48 89 fa             	mov    %rdi,%rdx
+  800270:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  800273:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800278:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  80027f:	00 00 00 
+  800282:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800287:	be 00 00 00 00       	mov    $0x0,%esi
+  80028c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800292:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  800294:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800298:	c9                   	leave
+  800299:	c3                   	ret
+
+000000000080029a <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  80029a:	55                   	push   %rbp
+  80029b:	48 89 e5             	mov    %rsp,%rbp
+  80029e:	53                   	push   %rbx
+  80029f:	49 89 f8             	mov    %rdi,%r8
+  8002a2:	48 89 d3             	mov    %rdx,%rbx
+  8002a5:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8002a8:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8002ad:	4c 89 c2             	mov    %r8,%rdx
+  8002b0:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8002b3:	be 00 00 00 00       	mov    $0x0,%esi
+  8002b8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8002be:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  8002c0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8002c4:	c9                   	leave
+  8002c5:	c3                   	ret
+
+00000000008002c6 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  8002c6:	55                   	push   %rbp
+  8002c7:	48 89 e5             	mov    %rsp,%rbp
+  8002ca:	53                   	push   %rbx
+  8002cb:	48 83 ec 08          	sub    $0x8,%rsp
+  8002cf:	89 f8                	mov    %edi,%eax
+  8002d1:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  8002d4:	48 63 f9             	movslq %ecx,%rdi
+  8002d7:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8002da:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8002df:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8002e2:	be 00 00 00 00       	mov    $0x0,%esi
+  8002e7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8002ed:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8002ef:	48 85 c0             	test   %rax,%rax
+  8002f2:	7f 06                	jg     8002fa <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  8002f4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8002f8:	c9                   	leave
+  8002f9:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8002fa:	49 89 c0             	mov    %rax,%r8
+  8002fd:	b9 04 00 00 00       	mov    $0x4,%ecx
+  800302:	48 ba d0 2c 80 00 00 	movabs $0x802cd0,%rdx
+  800309:	00 00 00 
+  80030c:	be 26 00 00 00       	mov    $0x26,%esi
+  800311:	48 bf ef 2c 80 00 00 	movabs $0x802cef,%rdi
+  800318:	00 00 00 
+  80031b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800320:	49 b9 57 1c 80 00 00 	movabs $0x801c57,%r9
+  800327:	00 00 00 
+  80032a:	41 ff d1             	call   *%r9
+
+000000000080032d <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  80032d:	55                   	push   %rbp
+  80032e:	48 89 e5             	mov    %rsp,%rbp
+  800331:	53                   	push   %rbx
+  800332:	48 83 ec 08          	sub    $0x8,%rsp
+  800336:	89 f8                	mov    %edi,%eax
+  800338:	49 89 f2             	mov    %rsi,%r10
+  80033b:	48 89 cf             	mov    %rcx,%rdi
+  80033e:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  800341:	48 63 da             	movslq %edx,%rbx
+  800344:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800347:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80034c:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80034f:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  800352:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800354:	48 85 c0             	test   %rax,%rax
+  800357:	7f 06                	jg     80035f <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  800359:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80035d:	c9                   	leave
+  80035e:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80035f:	49 89 c0             	mov    %rax,%r8
+  800362:	b9 05 00 00 00       	mov    $0x5,%ecx
+  800367:	48 ba d0 2c 80 00 00 	movabs $0x802cd0,%rdx
+  80036e:	00 00 00 
+  800371:	be 26 00 00 00       	mov    $0x26,%esi
+  800376:	48 bf ef 2c 80 00 00 	movabs $0x802cef,%rdi
+  80037d:	00 00 00 
+  800380:	b8 00 00 00 00       	mov    $0x0,%eax
+  800385:	49 b9 57 1c 80 00 00 	movabs $0x801c57,%r9
+  80038c:	00 00 00 
+  80038f:	41 ff d1             	call   *%r9
+
+0000000000800392 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  800392:	55                   	push   %rbp
+  800393:	48 89 e5             	mov    %rsp,%rbp
+  800396:	53                   	push   %rbx
+  800397:	48 83 ec 08          	sub    $0x8,%rsp
+  80039b:	48 89 f1             	mov    %rsi,%rcx
+  80039e:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  8003a1:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8003a4:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8003a9:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8003ae:	be 00 00 00 00       	mov    $0x0,%esi
+  8003b3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8003b9:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8003bb:	48 85 c0             	test   %rax,%rax
+  8003be:	7f 06                	jg     8003c6 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  8003c0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8003c4:	c9                   	leave
+  8003c5:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8003c6:	49 89 c0             	mov    %rax,%r8
+  8003c9:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8003ce:	48 ba d0 2c 80 00 00 	movabs $0x802cd0,%rdx
+  8003d5:	00 00 00 
+  8003d8:	be 26 00 00 00       	mov    $0x26,%esi
+  8003dd:	48 bf ef 2c 80 00 00 	movabs $0x802cef,%rdi
+  8003e4:	00 00 00 
+  8003e7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003ec:	49 b9 57 1c 80 00 00 	movabs $0x801c57,%r9
+  8003f3:	00 00 00 
+  8003f6:	41 ff d1             	call   *%r9
+
+00000000008003f9 <sys_region_batch>:
+
+int
+sys_region_batch(const struct RegionOp *ops, size_t count) {
+  8003f9:	55                   	push   %rbp
+  8003fa:	48 89 e5             	mov    %rsp,%rbp
+  8003fd:	53                   	push   %rbx
+  8003fe:	48 83 ec 08          	sub    $0x8,%rsp
+  800402:	48 89 fa             	mov    %rdi,%rdx
+  800405:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  800408:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80040d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800412:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800417:	be 00 00 00 00       	mov    $0x0,%esi
+  80041c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800422:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800424:	48 85 c0             	test   %rax,%rax
+  800427:	7f 06                	jg     80042f <sys_region_batch+0x36>
+        else
+            platform_asan_unpoison(va, ops[i].size);
+    }
+#endif
+    return res;
+}
+  800429:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80042d:	c9                   	leave
+  80042e:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80042f:	49 89 c0             	mov    %rax,%r8
+  800432:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  800437:	48 ba d0 2c 80 00 00 	movabs $0x802cd0,%rdx
+  80043e:	00 00 00 
+  800441:	be 26 00 00 00       	mov    $0x26,%esi
+  800446:	48 bf ef 2c 80 00 00 	movabs $0x802cef,%rdi
+  80044d:	00 00 00 
+  800450:	b8 00 00 00 00       	mov    $0x0,%eax
+  800455:	49 b9 57 1c 80 00 00 	movabs $0x801c57,%r9
+  80045c:	00 00 00 
+  80045f:	41 ff d1             	call   *%r9
+
+0000000000800462 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  800462:	55                   	push   %rbp
+  800463:	48 89 e5             	mov    %rsp,%rbp
+  800466:	53                   	push   %rbx
+  800467:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  80046b:	48 63 ce             	movslq %esi,%rcx
+  80046e:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800471:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800476:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80047b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800480:	be 00 00 00 00       	mov    $0x0,%esi
+  800485:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80048b:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80048d:	48 85 c0             	test   %rax,%rax
+  800490:	7f 06                	jg     800498 <sys_env_set_status+0x36>
+}
+  800492:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800496:	c9                   	leave
+  800497:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800498:	49 89 c0             	mov    %rax,%r8
+  80049b:	b9 09 00 00 00       	mov    $0x9,%ecx
+  8004a0:	48 ba d0 2c 80 00 00 	movabs $0x802cd0,%rdx
+  8004a7:	00 00 00 
+  8004aa:	be 26 00 00 00       	mov    $0x26,%esi
+  8004af:	48 bf ef 2c 80 00 00 	movabs $0x802cef,%rdi
+  8004b6:	00 00 00 
+  8004b9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004be:	49 b9 57 1c 80 00 00 	movabs $0x801c57,%r9
+  8004c5:	00 00 00 
+  8004c8:	41 ff d1             	call   *%r9
+
+00000000008004cb <sys_env_set_weight>:
+
+int
+sys_env_set_weight(envid_t envid, uint32_t weight) {
+  8004cb:	55                   	push   %rbp
+  8004cc:	48 89 e5             	mov    %rsp,%rbp
+  8004cf:	53                   	push   %rbx
+  8004d0:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_weight, 1, envid, weight, 0, 0, 0, 0);
+  8004d4:	89 f1                	mov    %esi,%ecx
+  8004d6:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8004d9:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8004de:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8004e3:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8004e8:	be 00 00 00 00       	mov    $0x0,%esi
+  8004ed:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8004f3:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8004f5:	48 85 c0             	test   %rax,%rax
+  8004f8:	7f 06                	jg     800500 <sys_env_set_weight+0x35>
+}
+  8004fa:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8004fe:	c9                   	leave
+  8004ff:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800500:	49 89 c0             	mov    %rax,%r8
+  800503:	b9 10 00 00 00       	mov    $0x10,%ecx
+  800508:	48 ba d0 2c 80 00 00 	movabs $0x802cd0,%rdx
+  80050f:	00 00 00 
+  800512:	be 26 00 00 00       	mov    $0x26,%esi
+  800517:	48 bf ef 2c 80 00 00 	movabs $0x802cef,%rdi
+  80051e:	00 00 00 
+  800521:	b8 00 00 00 00       	mov    $0x0,%eax
+  800526:	49 b9 57 1c 80 00 00 	movabs $0x801c57,%r9
+  80052d:	00 00 00 
+  800530:	41 ff d1             	call   *%r9
+
+0000000000800533 <sys_env_set_rt>:
+
+int
+sys_env_set_rt(envid_t envid, uint64_t period, uint64_t budget, uint64_t deadline) {
+  800533:	55                   	push   %rbp
+  800534:	48 89 e5             	mov    %rsp,%rbp
+  800537:	53                   	push   %rbx
+  800538:	48 83 ec 08          	sub    $0x8,%rsp
+  80053c:	89 f8                	mov    %edi,%eax
+  80053e:	48 89 d3             	mov    %rdx,%rbx
+  800541:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_env_set_rt, 1, envid, period, budget, deadline, 0, 0);
+  800544:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800547:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80054c:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80054f:	be 00 00 00 00       	mov    $0x0,%esi
+  800554:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80055a:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80055c:	48 85 c0             	test   %rax,%rax
+  80055f:	7f 06                	jg     800567 <sys_env_set_rt+0x34>
+}
+  800561:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800565:	c9                   	leave
+  800566:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800567:	49 89 c0             	mov    %rax,%r8
+  80056a:	b9 11 00 00 00       	mov    $0x11,%ecx
+  80056f:	48 ba d0 2c 80 00 00 	movabs $0x802cd0,%rdx
+  800576:	00 00 00 
+  800579:	be 26 00 00 00       	mov    $0x26,%esi
+  80057e:	48 bf ef 2c 80 00 00 	movabs $0x802cef,%rdi
+  800585:	00 00 00 
+  800588:	b8 00 00 00 00       	mov    $0x0,%eax
+  80058d:	49 b9 57 1c 80 00 00 	movabs $0x801c57,%r9
+  800594:	00 00 00 
+  800597:	41 ff d1             	call   *%r9
+
+000000000080059a <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  80059a:	55                   	push   %rbp
+  80059b:	48 89 e5             	mov    %rsp,%rbp
+  80059e:	53                   	push   %rbx
+  80059f:	48 83 ec 08          	sub    $0x8,%rsp
+  8005a3:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  8005a6:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8005a9:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8005ae:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8005b3:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8005b8:	be 00 00 00 00       	mov    $0x0,%esi
+  8005bd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8005c3:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8005c5:	48 85 c0             	test   %rax,%rax
+  8005c8:	7f 06                	jg     8005d0 <sys_env_set_trapframe+0x36>
+}
+  8005ca:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8005ce:	c9                   	leave
+  8005cf:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8005d0:	49 89 c0             	mov    %rax,%r8
+  8005d3:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  8005d8:	48 ba d0 2c 80 00 00 	movabs $0x802cd0,%rdx
+  8005df:	00 00 00 
+  8005e2:	be 26 00 00 00       	mov    $0x26,%esi
+  8005e7:	48 bf ef 2c 80 00 00 	movabs $0x802cef,%rdi
+  8005ee:	00 00 00 
+  8005f1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005f6:	49 b9 57 1c 80 00 00 	movabs $0x801c57,%r9
+  8005fd:	00 00 00 
+  800600:	41 ff d1             	call   *%r9
+
+0000000000800603 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  800603:	55                   	push   %rbp
+  800604:	48 89 e5             	mov    %rsp,%rbp
+  800607:	53                   	push   %rbx
+  800608:	48 83 ec 08          	sub    $0x8,%rsp
+  80060c:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  80060f:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800612:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800617:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80061c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800621:	be 00 00 00 00       	mov    $0x0,%esi
+  800626:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80062c:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80062e:	48 85 c0             	test   %rax,%rax
+  800631:	7f 06                	jg     800639 <sys_env_set_pgfault_upcall+0x36>
+}
+  800633:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800637:	c9                   	leave
+  800638:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800639:	49 89 c0             	mov    %rax,%r8
+  80063c:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  800641:	48 ba d0 2c 80 00 00 	movabs $0x802cd0,%rdx
+  800648:	00 00 00 
+  80064b:	be 26 00 00 00       	mov    $0x26,%esi
+  800650:	48 bf ef 2c 80 00 00 	movabs $0x802cef,%rdi
+  800657:	00 00 00 
+  80065a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80065f:	49 b9 57 1c 80 00 00 	movabs $0x801c57,%r9
+  800666:	00 00 00 
+  800669:	41 ff d1             	call   *%r9
+
+000000000080066c <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  80066c:	55                   	push   %rbp
+  80066d:	48 89 e5             	mov    %rsp,%rbp
+  800670:	53                   	push   %rbx
+  800671:	89 f8                	mov    %edi,%eax
+  800673:	49 89 f1             	mov    %rsi,%r9
+  800676:	48 89 d3             	mov    %rdx,%rbx
+  800679:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  80067c:	49 63 f0             	movslq %r8d,%rsi
+  80067f:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800682:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800687:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80068a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800690:	cd 30                	int    $0x30
+}
+  800692:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800696:	c9                   	leave
+  800697:	c3                   	ret
+
+0000000000800698 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  800698:	55                   	push   %rbp
+  800699:	48 89 e5             	mov    %rsp,%rbp
+  80069c:	53                   	push   %rbx
+  80069d:	48 83 ec 08          	sub    $0x8,%rsp
+  8006a1:	48 89 fa             	mov    %rdi,%rdx
+  8006a4:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8006a7:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8006ac:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8006b1:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8006b6:	be 00 00 00 00       	mov    $0x0,%esi
+  8006bb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8006c1:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8006c3:	48 85 c0             	test   %rax,%rax
+  8006c6:	7f 06                	jg     8006ce <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8006c8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8006cc:	c9                   	leave
+  8006cd:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8006ce:	49 89 c0             	mov    %rax,%r8
+  8006d1:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  8006d6:	48 ba d0 2c 80 00 00 	movabs $0x802cd0,%rdx
+  8006dd:	00 00 00 
+  8006e0:	be 26 00 00 00       	mov    $0x26,%esi
+  8006e5:	48 bf ef 2c 80 00 00 	movabs $0x802cef,%rdi
+  8006ec:	00 00 00 
+  8006ef:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006f4:	49 b9 57 1c 80 00 00 	movabs $0x801c57,%r9
+  8006fb:	00 00 00 
+  8006fe:	41 ff d1             	call   *%r9
+
+0000000000800701 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  800701:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  800708:	ff ff ff 
+  80070b:	48 01 f8             	add    %rdi,%rax
+  80070e:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  800712:	c3                   	ret
+
+0000000000800713 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  800713:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  80071a:	ff ff ff 
+  80071d:	48 01 f8             	add    %rdi,%rax
+  800720:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  800724:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  80072a:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  80072e:	c3                   	ret
+
+000000000080072f <fd_alloc_from>:
+}
+
+/* Like fd_alloc(), but only considers fds starting from fdnum,
+ * so that several fds can be found before their pages are allocated */
+int
+fd_alloc_from(int fdnum, struct Fd **fd_store) {
+  80072f:	55                   	push   %rbp
+  800730:	48 89 e5             	mov    %rsp,%rbp
+  800733:	41 57                	push   %r15
+  800735:	41 56                	push   %r14
+  800737:	41 55                	push   %r13
+  800739:	41 54                	push   %r12
+  80073b:	53                   	push   %rbx
+  80073c:	48 83 ec 08          	sub    $0x8,%rsp
+  800740:	49 89 f7             	mov    %rsi,%r15
+    for (int i = MAX(fdnum, 0); i < MAXFD; i++) {
+  800743:	85 ff                	test   %edi,%edi
+  800745:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80074b:	44 0f 49 e7          	cmovns %edi,%r12d
+  80074f:	83 ff 1f             	cmp    $0x1f,%edi
+  800752:	7f 37                	jg     80078b <fd_alloc_from+0x5c>
+  800754:	49 63 dc             	movslq %r12d,%rbx
+  800757:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  80075e:	48 c1 e3 0c          	shl    $0xc,%rbx
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  800762:	49 be 38 18 80 00 00 	movabs $0x801838,%r14
+  800769:	00 00 00 
+        struct Fd *fd = INDEX2FD(i);
+  80076c:	49 89 dd             	mov    %rbx,%r13
+        if (!(get_prot(fd) & PROT_R)) {
+  80076f:	48 89 df             	mov    %rbx,%rdi
+  800772:	41 ff d6             	call   *%r14
+  800775:	83 e0 04             	and    $0x4,%eax
+  800778:	74 1c                	je     800796 <fd_alloc_from+0x67>
+    for (int i = MAX(fdnum, 0); i < MAXFD; i++) {
+  80077a:	41 83 c4 01          	add    $0x1,%r12d
+  80077e:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  800785:	41 83 fc 1f          	cmp    $0x1f,%r12d
+  800789:	7e e1                	jle    80076c <fd_alloc_from+0x3d>
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  80078b:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  800791:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  800796:	4d 89 2f             	mov    %r13,(%r15)
+}
+  800799:	48 83 c4 08          	add    $0x8,%rsp
+  80079d:	5b                   	pop    %rbx
+  80079e:	41 5c                	pop    %r12
+  8007a0:	41 5d                	pop    %r13
+  8007a2:	41 5e                	pop    %r14
+  8007a4:	41 5f                	pop    %r15
+  8007a6:	5d                   	pop    %rbp
+  8007a7:	c3                   	ret
+
+00000000008007a8 <fd_alloc>:
+fd_alloc(struct Fd **fd_store) {
+  8007a8:	55                   	push   %rbp
+  8007a9:	48 89 e5             	mov    %rsp,%rbp
+  8007ac:	48 89 fe             	mov    %rdi,%rsi
+    return fd_alloc_from(0, fd_store);
+  8007af:	bf 00 00 00 00       	mov    $0x0,%edi
+  8007b4:	48 b8 2f 07 80 00 00 	movabs $0x80072f,%rax
+  8007bb:	00 00 00 
+  8007be:	ff d0                	call   *%rax
+}
+  8007c0:	5d                   	pop    %rbp
+  8007c1:	c3                   	ret
+
+00000000008007c2 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  8007c2:	83 ff 1f             	cmp    $0x1f,%edi
+  8007c5:	77 39                	ja     800800 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  8007c7:	55                   	push   %rbp
+  8007c8:	48 89 e5             	mov    %rsp,%rbp
+  8007cb:	41 54                	push   %r12
+  8007cd:	53                   	push   %rbx
+  8007ce:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  8007d1:	48 63 df             	movslq %edi,%rbx
+  8007d4:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  8007db:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  8007df:	48 89 df             	mov    %rbx,%rdi
+  8007e2:	48 b8 38 18 80 00 00 	movabs $0x801838,%rax
+  8007e9:	00 00 00 
+  8007ec:	ff d0                	call   *%rax
+  8007ee:	a8 04                	test   $0x4,%al
+  8007f0:	74 14                	je     800806 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  8007f2:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  8007f6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8007fb:	5b                   	pop    %rbx
+  8007fc:	41 5c                	pop    %r12
+  8007fe:	5d                   	pop    %rbp
+  8007ff:	c3                   	ret
+        return -E_INVAL;
+  800800:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  800805:	c3                   	ret
+        return -E_INVAL;
+  800806:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80080b:	eb ee                	jmp    8007fb <fd_lookup+0x39>
+
+000000000080080d <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  80080d:	55                   	push   %rbp
+  80080e:	48 89 e5             	mov    %rsp,%rbp
+  800811:	41 54                	push   %r12
+  800813:	53                   	push   %rbx
+  800814:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  800817:	48 b8 80 2d 80 00 00 	movabs $0x802d80,%rax
+  80081e:	00 00 00 
+  800821:	48 bb 20 40 80 00 00 	movabs $0x804020,%rbx
+  800828:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  80082b:	39 3b                	cmp    %edi,(%rbx)
+  80082d:	74 47                	je     800876 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  80082f:	48 83 c0 08          	add    $0x8,%rax
+  800833:	48 8b 18             	mov    (%rax),%rbx
+  800836:	48 85 db             	test   %rbx,%rbx
+  800839:	75 f0                	jne    80082b <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  80083b:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  800842:	00 00 00 
+  800845:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+  80084b:	89 fa                	mov    %edi,%edx
+  80084d:	48 bf 00 2d 80 00 00 	movabs $0x802d00,%rdi
+  800854:	00 00 00 
+  800857:	b8 00 00 00 00       	mov    $0x0,%eax
+  80085c:	48 b9 a7 1d 80 00 00 	movabs $0x801da7,%rcx
+  800863:	00 00 00 
+  800866:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  800868:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  80086d:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  800871:	5b                   	pop    %rbx
+  800872:	41 5c                	pop    %r12
+  800874:	5d                   	pop    %rbp
+  800875:	c3                   	ret
+            return 0;
+  800876:	b8 00 00 00 00       	mov    $0x0,%eax
+  80087b:	eb f0                	jmp    80086d <dev_lookup+0x60>
+
+000000000080087d <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  80087d:	55                   	push   %rbp
+  80087e:	48 89 e5             	mov    %rsp,%rbp
+  800881:	41 55                	push   %r13
+  800883:	41 54                	push   %r12
+  800885:	53                   	push   %rbx
+  800886:	48 83 ec 18          	sub    $0x18,%rsp
+  80088a:	48 89 fb             	mov    %rdi,%rbx
+  80088d:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  800890:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  800897:	ff ff ff 
+  80089a:	48 01 df             	add    %rbx,%rdi
+  80089d:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  8008a1:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8008a5:	48 b8 c2 07 80 00 00 	movabs $0x8007c2,%rax
+  8008ac:	00 00 00 
+  8008af:	ff d0                	call   *%rax
+  8008b1:	41 89 c5             	mov    %eax,%r13d
+  8008b4:	85 c0                	test   %eax,%eax
+  8008b6:	78 06                	js     8008be <fd_close+0x41>
+  8008b8:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  8008bc:	74 1a                	je     8008d8 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  8008be:	45 84 e4             	test   %r12b,%r12b
+  8008c1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008c6:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  8008ca:	44 89 e8             	mov    %r13d,%eax
+  8008cd:	48 83 c4 18          	add    $0x18,%rsp
+  8008d1:	5b                   	pop    %rbx
+  8008d2:	41 5c                	pop    %r12
+  8008d4:	41 5d                	pop    %r13
+  8008d6:	5d                   	pop    %rbp
+  8008d7:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8008d8:	8b 3b                	mov    (%rbx),%edi
+  8008da:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8008de:	48 b8 0d 08 80 00 00 	movabs $0x80080d,%rax
+  8008e5:	00 00 00 
+  8008e8:	ff d0                	call   *%rax
+  8008ea:	41 89 c5             	mov    %eax,%r13d
+  8008ed:	85 c0                	test   %eax,%eax
+  8008ef:	78 1b                	js     80090c <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  8008f1:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8008f5:	48 8b 40 20          	mov    0x20(%rax),%rax
+  8008f9:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  8008ff:	48 85 c0             	test   %rax,%rax
+  800902:	74 08                	je     80090c <fd_close+0x8f>
+  800904:	48 89 df             	mov    %rbx,%rdi
+  800907:	ff d0                	call   *%rax
+  800909:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  80090c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800911:	48 89 de             	mov    %rbx,%rsi
+  800914:	bf 00 00 00 00       	mov    $0x0,%edi
+  800919:	48 b8 92 03 80 00 00 	movabs $0x800392,%rax
+  800920:	00 00 00 
+  800923:	ff d0                	call   *%rax
+    return res;
+  800925:	eb a3                	jmp    8008ca <fd_close+0x4d>
+
+0000000000800927 <close>:
+
+int
+close(int fdnum) {
+  800927:	55                   	push   %rbp
+  800928:	48 89 e5             	mov    %rsp,%rbp
+  80092b:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  80092f:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  800933:	48 b8 c2 07 80 00 00 	movabs $0x8007c2,%rax
+  80093a:	00 00 00 
+  80093d:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80093f:	85 c0                	test   %eax,%eax
+  800941:	78 15                	js     800958 <close+0x31>
+
+    return fd_close(fd, 1);
+  800943:	be 01 00 00 00       	mov    $0x1,%esi
+  800948:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80094c:	48 b8 7d 08 80 00 00 	movabs $0x80087d,%rax
+  800953:	00 00 00 
+  800956:	ff d0                	call   *%rax
+}
+  800958:	c9                   	leave
+  800959:	c3                   	ret
+
+000000000080095a <close_all>:
+
+void
+close_all(void) {
+  80095a:	55                   	push   %rbp
+  80095b:	48 89 e5             	mov    %rsp,%rbp
+  80095e:	41 54                	push   %r12
+  800960:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  800961:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800966:	49 bc 27 09 80 00 00 	movabs $0x800927,%r12
+  80096d:	00 00 00 
+  800970:	89 df                	mov    %ebx,%edi
+  800972:	41 ff d4             	call   *%r12
+  800975:	83 c3 01             	add    $0x1,%ebx
+  800978:	83 fb 20             	cmp    $0x20,%ebx
+  80097b:	75 f3                	jne    800970 <close_all+0x16>
+}
+  80097d:	5b                   	pop    %rbx
+  80097e:	41 5c                	pop    %r12
+  800980:	5d                   	pop    %rbp
+  800981:	c3                   	ret
+
+0000000000800982 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  800982:	55                   	push   %rbp
+  800983:	48 89 e5             	mov    %rsp,%rbp
+  800986:	41 57                	push   %r15
+  800988:	41 56                	push   %r14
+  80098a:	41 55                	push   %r13
+  80098c:	41 54                	push   %r12
+  80098e:	53                   	push   %rbx
+  80098f:	48 83 ec 18          	sub    $0x18,%rsp
+  800993:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  800996:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  80099a:	48 b8 c2 07 80 00 00 	movabs $0x8007c2,%rax
+  8009a1:	00 00 00 
+  8009a4:	ff d0                	call   *%rax
+  8009a6:	89 c3                	mov    %eax,%ebx
+  8009a8:	85 c0                	test   %eax,%eax
+  8009aa:	0f 88 b8 00 00 00    	js     800a68 <dup+0xe6>
+    close(newfdnum);
+  8009b0:	44 89 e7             	mov    %r12d,%edi
+  8009b3:	48 b8 27 09 80 00 00 	movabs $0x800927,%rax
+  8009ba:	00 00 00 
+  8009bd:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  8009bf:	4d 63 ec             	movslq %r12d,%r13
+  8009c2:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  8009c9:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  8009cd:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  8009d1:	4c 89 ff             	mov    %r15,%rdi
+  8009d4:	49 be 13 07 80 00 00 	movabs $0x800713,%r14
+  8009db:	00 00 00 
+  8009de:	41 ff d6             	call   *%r14
+  8009e1:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  8009e4:	4c 89 ef             	mov    %r13,%rdi
+  8009e7:	41 ff d6             	call   *%r14
+  8009ea:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  8009ed:	48 89 df             	mov    %rbx,%rdi
+  8009f0:	48 b8 38 18 80 00 00 	movabs $0x801838,%rax
+  8009f7:	00 00 00 
+  8009fa:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  8009fc:	a8 04                	test   $0x4,%al
+  8009fe:	74 2b                	je     800a2b <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  800a00:	41 89 c1             	mov    %eax,%r9d
+  800a03:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  800a09:	4c 89 f1             	mov    %r14,%rcx
+  800a0c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800a11:	48 89 de             	mov    %rbx,%rsi
+  800a14:	bf 00 00 00 00       	mov    $0x0,%edi
+  800a19:	48 b8 2d 03 80 00 00 	movabs $0x80032d,%rax
+  800a20:	00 00 00 
+  800a23:	ff d0                	call   *%rax
+  800a25:	89 c3                	mov    %eax,%ebx
+  800a27:	85 c0                	test   %eax,%eax
+  800a29:	78 4e                	js     800a79 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  800a2b:	4c 89 ff             	mov    %r15,%rdi
+  800a2e:	48 b8 38 18 80 00 00 	movabs $0x801838,%rax
+  800a35:	00 00 00 
+  800a38:	ff d0                	call   *%rax
+  800a3a:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  800a3d:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  800a43:	4c 89 e9             	mov    %r13,%rcx
+  800a46:	ba 00 00 00 00       	mov    $0x0,%edx
+  800a4b:	4c 89 fe             	mov    %r15,%rsi
+  800a4e:	bf 00 00 00 00       	mov    $0x0,%edi
+  800a53:	48 b8 2d 03 80 00 00 	movabs $0x80032d,%rax
+  800a5a:	00 00 00 
+  800a5d:	ff d0                	call   *%rax
+  800a5f:	89 c3                	mov    %eax,%ebx
+  800a61:	85 c0                	test   %eax,%eax
+  800a63:	78 14                	js     800a79 <dup+0xf7>
+
+    return newfdnum;
+  800a65:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  800a68:	89 d8                	mov    %ebx,%eax
+  800a6a:	48 83 c4 18          	add    $0x18,%rsp
+  800a6e:	5b                   	pop    %rbx
+  800a6f:	41 5c                	pop    %r12
+  800a71:	41 5d                	pop    %r13
+  800a73:	41 5e                	pop    %r14
+  800a75:	41 5f                	pop    %r15
+  800a77:	5d                   	pop    %rbp
+  800a78:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  800a79:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800a7e:	4c 89 ee             	mov    %r13,%rsi
+  800a81:	bf 00 00 00 00       	mov    $0x0,%edi
+  800a86:	49 bc 92 03 80 00 00 	movabs $0x800392,%r12
+  800a8d:	00 00 00 
+  800a90:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  800a93:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800a98:	4c 89 f6             	mov    %r14,%rsi
+  800a9b:	bf 00 00 00 00       	mov    $0x0,%edi
+  800aa0:	41 ff d4             	call   *%r12
+    return res;
+  800aa3:	eb c3                	jmp    800a68 <dup+0xe6>
+
+0000000000800aa5 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  800aa5:	55                   	push   %rbp
+  800aa6:	48 89 e5             	mov    %rsp,%rbp
+  800aa9:	41 56                	push   %r14
+  800aab:	41 55                	push   %r13
+  800aad:	41 54                	push   %r12
+  800aaf:	53                   	push   %rbx
+  800ab0:	48 83 ec 10          	sub    $0x10,%rsp
+  800ab4:	89 fb                	mov    %edi,%ebx
+  800ab6:	49 89 f4             	mov    %rsi,%r12
+  800ab9:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800abc:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800ac0:	48 b8 c2 07 80 00 00 	movabs $0x8007c2,%rax
+  800ac7:	00 00 00 
+  800aca:	ff d0                	call   *%rax
+  800acc:	85 c0                	test   %eax,%eax
+  800ace:	78 4c                	js     800b1c <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800ad0:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  800ad4:	41 8b 3e             	mov    (%r14),%edi
+  800ad7:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800adb:	48 b8 0d 08 80 00 00 	movabs $0x80080d,%rax
+  800ae2:	00 00 00 
+  800ae5:	ff d0                	call   *%rax
+  800ae7:	85 c0                	test   %eax,%eax
+  800ae9:	78 35                	js     800b20 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  800aeb:	41 8b 46 08          	mov    0x8(%r14),%eax
+  800aef:	83 e0 03             	and    $0x3,%eax
+  800af2:	83 f8 01             	cmp    $0x1,%eax
+  800af5:	74 2d                	je     800b24 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  800af7:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800afb:	48 8b 40 10          	mov    0x10(%rax),%rax
+  800aff:	48 85 c0             	test   %rax,%rax
+  800b02:	74 56                	je     800b5a <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  800b04:	4c 89 ea             	mov    %r13,%rdx
+  800b07:	4c 89 e6             	mov    %r12,%rsi
+  800b0a:	4c 89 f7             	mov    %r14,%rdi
+  800b0d:	ff d0                	call   *%rax
+}
+  800b0f:	48 83 c4 10          	add    $0x10,%rsp
+  800b13:	5b                   	pop    %rbx
+  800b14:	41 5c                	pop    %r12
+  800b16:	41 5d                	pop    %r13
+  800b18:	41 5e                	pop    %r14
+  800b1a:	5d                   	pop    %rbp
+  800b1b:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800b1c:	48 98                	cltq
+  800b1e:	eb ef                	jmp    800b0f <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800b20:	48 98                	cltq
+  800b22:	eb eb                	jmp    800b0f <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  800b24:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  800b2b:	00 00 00 
+  800b2e:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+  800b34:	89 da                	mov    %ebx,%edx
+  800b36:	48 bf 41 2d 80 00 00 	movabs $0x802d41,%rdi
+  800b3d:	00 00 00 
+  800b40:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b45:	48 b9 a7 1d 80 00 00 	movabs $0x801da7,%rcx
+  800b4c:	00 00 00 
+  800b4f:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  800b51:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  800b58:	eb b5                	jmp    800b0f <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  800b5a:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  800b61:	eb ac                	jmp    800b0f <read+0x6a>
+
+0000000000800b63 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  800b63:	55                   	push   %rbp
+  800b64:	48 89 e5             	mov    %rsp,%rbp
+  800b67:	41 57                	push   %r15
+  800b69:	41 56                	push   %r14
+  800b6b:	41 55                	push   %r13
+  800b6d:	41 54                	push   %r12
+  800b6f:	53                   	push   %rbx
+  800b70:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  800b74:	48 85 d2             	test   %rdx,%rdx
+  800b77:	74 54                	je     800bcd <readn+0x6a>
+  800b79:	41 89 fd             	mov    %edi,%r13d
+  800b7c:	49 89 f6             	mov    %rsi,%r14
+  800b7f:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  800b82:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  800b87:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  800b8c:	49 bf a5 0a 80 00 00 	movabs $0x800aa5,%r15
+  800b93:	00 00 00 
+  800b96:	4c 89 e2             	mov    %r12,%rdx
+  800b99:	48 29 f2             	sub    %rsi,%rdx
+  800b9c:	4c 01 f6             	add    %r14,%rsi
+  800b9f:	44 89 ef             	mov    %r13d,%edi
+  800ba2:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  800ba5:	85 c0                	test   %eax,%eax
+  800ba7:	78 20                	js     800bc9 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  800ba9:	01 c3                	add    %eax,%ebx
+  800bab:	85 c0                	test   %eax,%eax
+  800bad:	74 08                	je     800bb7 <readn+0x54>
+  800baf:	48 63 f3             	movslq %ebx,%rsi
+  800bb2:	4c 39 e6             	cmp    %r12,%rsi
+  800bb5:	72 df                	jb     800b96 <readn+0x33>
+    }
+    return res;
+  800bb7:	48 63 c3             	movslq %ebx,%rax
+}
+  800bba:	48 83 c4 08          	add    $0x8,%rsp
+  800bbe:	5b                   	pop    %rbx
+  800bbf:	41 5c                	pop    %r12
+  800bc1:	41 5d                	pop    %r13
+  800bc3:	41 5e                	pop    %r14
+  800bc5:	41 5f                	pop    %r15
+  800bc7:	5d                   	pop    %rbp
+  800bc8:	c3                   	ret
+        if (inc < 0) return inc;
+  800bc9:	48 98                	cltq
+  800bcb:	eb ed                	jmp    800bba <readn+0x57>
+    int inc = 1, res = 0;
+  800bcd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800bd2:	eb e3                	jmp    800bb7 <readn+0x54>
+
+0000000000800bd4 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  800bd4:	55                   	push   %rbp
+  800bd5:	48 89 e5             	mov    %rsp,%rbp
+  800bd8:	41 56                	push   %r14
+  800bda:	41 55                	push   %r13
+  800bdc:	41 54                	push   %r12
+  800bde:	53                   	push   %rbx
+  800bdf:	48 83 ec 10          	sub    $0x10,%rsp
+  800be3:	89 fb                	mov    %edi,%ebx
+  800be5:	49 89 f4             	mov    %rsi,%r12
+  800be8:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800beb:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800bef:	48 b8 c2 07 80 00 00 	movabs $0x8007c2,%rax
+  800bf6:	00 00 00 
+  800bf9:	ff d0                	call   *%rax
+  800bfb:	85 c0                	test   %eax,%eax
+  800bfd:	78 47                	js     800c46 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800bff:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  800c03:	41 8b 3e             	mov    (%r14),%edi
+  800c06:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800c0a:	48 b8 0d 08 80 00 00 	movabs $0x80080d,%rax
+  800c11:	00 00 00 
+  800c14:	ff d0                	call   *%rax
+  800c16:	85 c0                	test   %eax,%eax
+  800c18:	78 30                	js     800c4a <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800c1a:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  800c1f:	74 2d                	je     800c4e <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  800c21:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800c25:	48 8b 40 18          	mov    0x18(%rax),%rax
+  800c29:	48 85 c0             	test   %rax,%rax
+  800c2c:	74 56                	je     800c84 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  800c2e:	4c 89 ea             	mov    %r13,%rdx
+  800c31:	4c 89 e6             	mov    %r12,%rsi
+  800c34:	4c 89 f7             	mov    %r14,%rdi
+  800c37:	ff d0                	call   *%rax
+}
+  800c39:	48 83 c4 10          	add    $0x10,%rsp
+  800c3d:	5b                   	pop    %rbx
+  800c3e:	41 5c                	pop    %r12
+  800c40:	41 5d                	pop    %r13
+  800c42:	41 5e                	pop    %r14
+  800c44:	5d                   	pop    %rbp
+  800c45:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800c46:	48 98                	cltq
+  800c48:	eb ef                	jmp    800c39 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800c4a:	48 98                	cltq
+  800c4c:	eb eb                	jmp    800c39 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  800c4e:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  800c55:	00 00 00 
+  800c58:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+  800c5e:	89 da                	mov    %ebx,%edx
+  800c60:	48 bf 5d 2d 80 00 00 	movabs $0x802d5d,%rdi
+  800c67:	00 00 00 
+  800c6a:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c6f:	48 b9 a7 1d 80 00 00 	movabs $0x801da7,%rcx
+  800c76:	00 00 00 
+  800c79:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  800c7b:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  800c82:	eb b5                	jmp    800c39 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  800c84:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  800c8b:	eb ac                	jmp    800c39 <write+0x65>
+
+0000000000800c8d <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  800c8d:	55                   	push   %rbp
+  800c8e:	48 89 e5             	mov    %rsp,%rbp
+  800c91:	53                   	push   %rbx
+  800c92:	48 83 ec 18          	sub    $0x18,%rsp
+  800c96:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800c98:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800c9c:	48 b8 c2 07 80 00 00 	movabs $0x8007c2,%rax
+  800ca3:	00 00 00 
+  800ca6:	ff d0                	call   *%rax
+  800ca8:	85 c0                	test   %eax,%eax
+  800caa:	78 0c                	js     800cb8 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  800cac:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800cb0:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  800cb3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800cb8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800cbc:	c9                   	leave
+  800cbd:	c3                   	ret
+
+0000000000800cbe <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  800cbe:	55                   	push   %rbp
+  800cbf:	48 89 e5             	mov    %rsp,%rbp
+  800cc2:	41 55                	push   %r13
+  800cc4:	41 54                	push   %r12
+  800cc6:	53                   	push   %rbx
+  800cc7:	48 83 ec 18          	sub    $0x18,%rsp
+  800ccb:	89 fb                	mov    %edi,%ebx
+  800ccd:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800cd0:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800cd4:	48 b8 c2 07 80 00 00 	movabs $0x8007c2,%rax
+  800cdb:	00 00 00 
+  800cde:	ff d0                	call   *%rax
+  800ce0:	85 c0                	test   %eax,%eax
+  800ce2:	78 38                	js     800d1c <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800ce4:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  800ce8:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  800cec:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800cf0:	48 b8 0d 08 80 00 00 	movabs $0x80080d,%rax
+  800cf7:	00 00 00 
+  800cfa:	ff d0                	call   *%rax
+  800cfc:	85 c0                	test   %eax,%eax
+  800cfe:	78 1c                	js     800d1c <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800d00:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  800d05:	74 20                	je     800d27 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  800d07:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800d0b:	48 8b 40 30          	mov    0x30(%rax),%rax
+  800d0f:	48 85 c0             	test   %rax,%rax
+  800d12:	74 47                	je     800d5b <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  800d14:	44 89 e6             	mov    %r12d,%esi
+  800d17:	4c 89 ef             	mov    %r13,%rdi
+  800d1a:	ff d0                	call   *%rax
+}
+  800d1c:	48 83 c4 18          	add    $0x18,%rsp
+  800d20:	5b                   	pop    %rbx
+  800d21:	41 5c                	pop    %r12
+  800d23:	41 5d                	pop    %r13
+  800d25:	5d                   	pop    %rbp
+  800d26:	c3                   	ret
+                thisenv->env_id, fdnum);
+  800d27:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  800d2e:	00 00 00 
+  800d31:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  800d37:	89 da                	mov    %ebx,%edx
+  800d39:	48 bf 20 2d 80 00 00 	movabs $0x802d20,%rdi
+  800d40:	00 00 00 
+  800d43:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d48:	48 b9 a7 1d 80 00 00 	movabs $0x801da7,%rcx
+  800d4f:	00 00 00 
+  800d52:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  800d54:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800d59:	eb c1                	jmp    800d1c <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  800d5b:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  800d60:	eb ba                	jmp    800d1c <ftruncate+0x5e>
+
+0000000000800d62 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  800d62:	55                   	push   %rbp
+  800d63:	48 89 e5             	mov    %rsp,%rbp
+  800d66:	41 54                	push   %r12
+  800d68:	53                   	push   %rbx
+  800d69:	48 83 ec 10          	sub    $0x10,%rsp
+  800d6d:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800d70:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800d74:	48 b8 c2 07 80 00 00 	movabs $0x8007c2,%rax
+  800d7b:	00 00 00 
+  800d7e:	ff d0                	call   *%rax
+  800d80:	85 c0                	test   %eax,%eax
+  800d82:	78 4e                	js     800dd2 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800d84:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  800d88:	41 8b 3c 24          	mov    (%r12),%edi
+  800d8c:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  800d90:	48 b8 0d 08 80 00 00 	movabs $0x80080d,%rax
+  800d97:	00 00 00 
+  800d9a:	ff d0                	call   *%rax
+  800d9c:	85 c0                	test   %eax,%eax
+  800d9e:	78 32                	js     800dd2 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  800da0:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800da4:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  800da9:	74 30                	je     800ddb <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  800dab:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  800dae:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  800db5:	00 00 00 
+    stat->st_isdir = 0;
+  800db8:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  800dbf:	00 00 00 
+    stat->st_dev = dev;
+  800dc2:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  800dc9:	48 89 de             	mov    %rbx,%rsi
+  800dcc:	4c 89 e7             	mov    %r12,%rdi
+  800dcf:	ff 50 28             	call   *0x28(%rax)
+}
+  800dd2:	48 83 c4 10          	add    $0x10,%rsp
+  800dd6:	5b                   	pop    %rbx
+  800dd7:	41 5c                	pop    %r12
+  800dd9:	5d                   	pop    %rbp
+  800dda:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  800ddb:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  800de0:	eb f0                	jmp    800dd2 <fstat+0x70>
+
+0000000000800de2 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  800de2:	55                   	push   %rbp
+  800de3:	48 89 e5             	mov    %rsp,%rbp
+  800de6:	41 54                	push   %r12
+  800de8:	53                   	push   %rbx
+  800de9:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  800dec:	be 00 00 00 00       	mov    $0x0,%esi
+  800df1:	48 b8 c5 11 80 00 00 	movabs $0x8011c5,%rax
+  800df8:	00 00 00 
+  800dfb:	ff d0                	call   *%rax
+  800dfd:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  800dff:	85 c0                	test   %eax,%eax
+  800e01:	78 25                	js     800e28 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  800e03:	4c 89 e6             	mov    %r12,%rsi
+  800e06:	89 c7                	mov    %eax,%edi
+  800e08:	48 b8 62 0d 80 00 00 	movabs $0x800d62,%rax
+  800e0f:	00 00 00 
+  800e12:	ff d0                	call   *%rax
+  800e14:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  800e17:	89 df                	mov    %ebx,%edi
+  800e19:	48 b8 27 09 80 00 00 	movabs $0x800927,%rax
+  800e20:	00 00 00 
+  800e23:	ff d0                	call   *%rax
+
+    return res;
+  800e25:	44 89 e3             	mov    %r12d,%ebx
+}
+  800e28:	89 d8                	mov    %ebx,%eax
+  800e2a:	5b                   	pop    %rbx
+  800e2b:	41 5c                	pop    %r12
+  800e2d:	5d                   	pop    %rbp
+  800e2e:	c3                   	ret
+
+0000000000800e2f <fsipc>:
+ * response may be written back to fsipcbuf.
+ * type: request code, passed as the simple integer IPC value.
+ * dstva: virtual address at which to receive reply page, 0 if none.
+ * Returns result from the file server. */
+static int
+fsipc(unsigned type, void *dstva) {
+  800e2f:	55                   	push   %rbp
+  800e30:	48 89 e5             	mov    %rsp,%rbp
+  800e33:	41 54                	push   %r12
+  800e35:	53                   	push   %rbx
+  800e36:	48 83 ec 10          	sub    $0x10,%rsp
+  800e3a:	41 89 fc             	mov    %edi,%r12d
+  800e3d:	48 89 f3             	mov    %rsi,%rbx
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  800e40:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  800e47:	00 00 00 
+  800e4a:	83 38 00             	cmpl   $0x0,(%rax)
+  800e4d:	74 5e                	je     800ead <fsipc+0x7e>
+    if (debug) {
+        cprintf("[%08x] fsipc %d %08x\n",
+                thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+    }
+
+    ipc_send(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW);
+  800e4f:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  800e55:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  800e5a:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  800e61:	00 00 00 
+  800e64:	44 89 e6             	mov    %r12d,%esi
+  800e67:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  800e6e:	00 00 00 
+  800e71:	8b 38                	mov    (%rax),%edi
+  800e73:	48 b8 c8 2b 80 00 00 	movabs $0x802bc8,%rax
+  800e7a:	00 00 00 
+  800e7d:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  800e7f:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  800e86:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  800e87:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e8c:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  800e90:	48 89 de             	mov    %rbx,%rsi
+  800e93:	bf 00 00 00 00       	mov    $0x0,%edi
+  800e98:	48 b8 f3 2a 80 00 00 	movabs $0x802af3,%rax
+  800e9f:	00 00 00 
+  800ea2:	ff d0                	call   *%rax
+}
+  800ea4:	48 83 c4 10          	add    $0x10,%rsp
+  800ea8:	5b                   	pop    %rbx
+  800ea9:	41 5c                	pop    %r12
+  800eab:	5d                   	pop    %rbp
+  800eac:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  800ead:	bf 03 00 00 00       	mov    $0x3,%edi
+  800eb2:	48 b8 6b 2c 80 00 00 	movabs $0x802c6b,%rax
+  800eb9:	00 00 00 
+  800ebc:	ff d0                	call   *%rax
+  800ebe:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  800ec5:	00 00 
+  800ec7:	eb 86                	jmp    800e4f <fsipc+0x20>
+
+0000000000800ec9 <devfile_trunc>:
+    return 0;
+}
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  800ec9:	55                   	push   %rbp
+  800eca:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  800ecd:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  800ed4:	00 00 00 
+  800ed7:	8b 57 0c             	mov    0xc(%rdi),%edx
+  800eda:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  800edc:	89 70 04             	mov    %esi,0x4(%rax)
+
+    return fsipc(FSREQ_SET_SIZE, NULL);
+  800edf:	be 00 00 00 00       	mov    $0x0,%esi
+  800ee4:	bf 02 00 00 00       	mov    $0x2,%edi
+  800ee9:	48 b8 2f 0e 80 00 00 	movabs $0x800e2f,%rax
+  800ef0:	00 00 00 
+  800ef3:	ff d0                	call   *%rax
+}
+  800ef5:	5d                   	pop    %rbp
+  800ef6:	c3                   	ret
+
+0000000000800ef7 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  800ef7:	55                   	push   %rbp
+  800ef8:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  800efb:	8b 47 0c             	mov    0xc(%rdi),%eax
+  800efe:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  800f05:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  800f07:	be 00 00 00 00       	mov    $0x0,%esi
+  800f0c:	bf 06 00 00 00       	mov    $0x6,%edi
+  800f11:	48 b8 2f 0e 80 00 00 	movabs $0x800e2f,%rax
+  800f18:	00 00 00 
+  800f1b:	ff d0                	call   *%rax
+}
+  800f1d:	5d                   	pop    %rbp
+  800f1e:	c3                   	ret
+
+0000000000800f1f <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  800f1f:	55                   	push   %rbp
+  800f20:	48 89 e5             	mov    %rsp,%rbp
+  800f23:	41 54                	push   %r12
+  800f25:	53                   	push   %rbx
+  800f26:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  800f29:	8b 47 0c             	mov    0xc(%rdi),%eax
+  800f2c:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  800f33:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  800f35:	be 00 00 00 00       	mov    $0x0,%esi
+  800f3a:	bf 05 00 00 00       	mov    $0x5,%edi
+  800f3f:	48 b8 2f 0e 80 00 00 	movabs $0x800e2f,%rax
+  800f46:	00 00 00 
+  800f49:	ff d0                	call   *%rax
+    if (res < 0) {
+  800f4b:	85 c0                	test   %eax,%eax
+  800f4d:	78 3d                	js     800f8c <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  800f4f:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  800f56:	00 00 00 
+  800f59:	4c 89 e6             	mov    %r12,%rsi
+  800f5c:	48 89 df             	mov    %rbx,%rdi
+  800f5f:	48 b8 cc 26 80 00 00 	movabs $0x8026cc,%rax
+  800f66:	00 00 00 
+  800f69:	ff d0                	call   *%rax
+    st->st_size  = fsipcbuf.statRet.ret_size;
+  800f6b:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  800f72:	00 
+  800f73:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  800f79:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  800f80:	00 
+  800f81:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  800f87:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800f8c:	5b                   	pop    %rbx
+  800f8d:	41 5c                	pop    %r12
+  800f8f:	5d                   	pop    %rbp
+  800f90:	c3                   	ret
+
+0000000000800f91 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  800f91:	55                   	push   %rbp
+  800f92:	48 89 e5             	mov    %rsp,%rbp
+  800f95:	41 57                	push   %r15
+  800f97:	41 56                	push   %r14
+  800f99:	41 55                	push   %r13
+  800f9b:	41 54                	push   %r12
+  800f9d:	53                   	push   %rbx
+  800f9e:	48 83 ec 18          	sub    $0x18,%rsp
+  800fa2:	49 89 fe             	mov    %rdi,%r14
+  800fa5:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+  800fa9:	48 89 d3             	mov    %rdx,%rbx
+    while (n > sizeof(fsipcbuf.write.req_buf))
+  800fac:	48 81 fa f0 0f 00 00 	cmp    $0xff0,%rdx
+  800fb3:	0f 86 e4 00 00 00    	jbe    80109d <devfile_write+0x10c>
+  800fb9:	49 89 f4             	mov    %rsi,%r12
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  800fbc:	49 bd 00 60 80 00 00 	movabs $0x806000,%r13
+  800fc3:	00 00 00 
+        memcpy(fsipcbuf.write.req_buf, buf, sizeof(fsipcbuf.write.req_buf));
+  800fc6:	49 bf 2d 29 80 00 00 	movabs $0x80292d,%r15
+  800fcd:	00 00 00 
+  800fd0:	eb 03                	jmp    800fd5 <devfile_write+0x44>
+        buf += sizeof(fsipcbuf.write.req_buf);
+  800fd2:	49 89 f4             	mov    %rsi,%r12
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  800fd5:	41 8b 46 0c          	mov    0xc(%r14),%eax
+  800fd9:	41 89 45 00          	mov    %eax,0x0(%r13)
+        fsipcbuf.write.req_n      = sizeof(fsipcbuf.write.req_buf);
+  800fdd:	49 c7 45 08 f0 0f 00 	movq   $0xff0,0x8(%r13)
+  800fe4:	00 
+        memcpy(fsipcbuf.write.req_buf, buf, sizeof(fsipcbuf.write.req_buf));
+  800fe5:	ba f0 0f 00 00       	mov    $0xff0,%edx
+  800fea:	4c 89 e6             	mov    %r12,%rsi
+  800fed:	48 bf 10 60 80 00 00 	movabs $0x806010,%rdi
+  800ff4:	00 00 00 
+  800ff7:	41 ff d7             	call   *%r15
+        ssize_t res = fsipc(FSREQ_WRITE, NULL);
+  800ffa:	be 00 00 00 00       	mov    $0x0,%esi
+  800fff:	bf 04 00 00 00       	mov    $0x4,%edi
+  801004:	48 b8 2f 0e 80 00 00 	movabs $0x800e2f,%rax
+  80100b:	00 00 00 
+  80100e:	ff d0                	call   *%rax
+  801010:	48 63 d0             	movslq %eax,%rdx
+        if (res < 0 || res < sizeof(fsipcbuf.write.req_buf))
+  801013:	3d ef 0f 00 00       	cmp    $0xfef,%eax
+  801018:	7e 71                	jle    80108b <devfile_write+0xfa>
+        buf += sizeof(fsipcbuf.write.req_buf);
+  80101a:	49 8d b4 24 f0 0f 00 	lea    0xff0(%r12),%rsi
+  801021:	00 
+        n -= sizeof(fsipcbuf.write.req_buf);
+  801022:	48 81 eb f0 0f 00 00 	sub    $0xff0,%rbx
+    while (n > sizeof(fsipcbuf.write.req_buf))
+  801029:	48 81 fb f0 0f 00 00 	cmp    $0xff0,%rbx
+  801030:	77 a0                	ja     800fd2 <devfile_write+0x41>
+        written += sizeof(fsipcbuf.write.req_buf);
+  801032:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801036:	49 29 c4             	sub    %rax,%r12
+  801039:	4d 8d a4 24 f0 0f 00 	lea    0xff0(%r12),%r12
+  801040:	00 
+    fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801041:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  801048:	00 00 00 
+  80104b:	41 8b 56 0c          	mov    0xc(%r14),%edx
+  80104f:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.write.req_n      = n;
+  801051:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    memcpy(fsipcbuf.write.req_buf, buf, n);
+  801055:	48 89 da             	mov    %rbx,%rdx
+  801058:	48 8d 78 10          	lea    0x10(%rax),%rdi
+  80105c:	48 b8 2d 29 80 00 00 	movabs $0x80292d,%rax
+  801063:	00 00 00 
+  801066:	ff d0                	call   *%rax
+    ssize_t res = fsipc(FSREQ_WRITE, NULL);
+  801068:	be 00 00 00 00       	mov    $0x0,%esi
+  80106d:	bf 04 00 00 00       	mov    $0x4,%edi
+  801072:	48 b8 2f 0e 80 00 00 	movabs $0x800e2f,%rax
+  801079:	00 00 00 
+  80107c:	ff d0                	call   *%rax
+  80107e:	48 63 d0             	movslq %eax,%rdx
+    written += res;
+  801081:	49 01 d4             	add    %rdx,%r12
+  801084:	48 85 d2             	test   %rdx,%rdx
+  801087:	49 0f 49 d4          	cmovns %r12,%rdx
+}
+  80108b:	48 89 d0             	mov    %rdx,%rax
+  80108e:	48 83 c4 18          	add    $0x18,%rsp
+  801092:	5b                   	pop    %rbx
+  801093:	41 5c                	pop    %r12
+  801095:	41 5d                	pop    %r13
+  801097:	41 5e                	pop    %r14
+  801099:	41 5f                	pop    %r15
+  80109b:	5d                   	pop    %rbp
+  80109c:	c3                   	ret
+    while (n > sizeof(fsipcbuf.write.req_buf))
+  80109d:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+    ssize_t written = 0;
+  8010a1:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8010a7:	eb 98                	jmp    801041 <devfile_write+0xb0>
+
+00000000008010a9 <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  8010a9:	55                   	push   %rbp
+  8010aa:	48 89 e5             	mov    %rsp,%rbp
+  8010ad:	41 57                	push   %r15
+  8010af:	41 56                	push   %r14
+  8010b1:	41 55                	push   %r13
+  8010b3:	41 54                	push   %r12
+  8010b5:	53                   	push   %rbx
+  8010b6:	48 83 ec 18          	sub    $0x18,%rsp
+  8010ba:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  8010be:	49 89 f6             	mov    %rsi,%r14
+  8010c1:	49 89 d4             	mov    %rdx,%r12
+    while (n > sizeof(fsipcbuf.readRet.ret_buf))
+  8010c4:	48 81 fa 00 10 00 00 	cmp    $0x1000,%rdx
+  8010cb:	0f 86 ea 00 00 00    	jbe    8011bb <devfile_read+0x112>
+    ssize_t readsz = 0;
+  8010d1:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  8010d8:	00 
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8010d9:	49 bf 00 60 80 00 00 	movabs $0x806000,%r15
+  8010e0:	00 00 00 
+  8010e3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8010e7:	8b 40 0c             	mov    0xc(%rax),%eax
+  8010ea:	41 89 07             	mov    %eax,(%r15)
+        fsipcbuf.read.req_n = sizeof(fsipcbuf.readRet.ret_buf);
+  8010ed:	49 c7 47 08 00 10 00 	movq   $0x1000,0x8(%r15)
+  8010f4:	00 
+        ssize_t res = fsipc(FSREQ_READ, NULL);
+  8010f5:	be 00 00 00 00       	mov    $0x0,%esi
+  8010fa:	bf 03 00 00 00       	mov    $0x3,%edi
+  8010ff:	48 b8 2f 0e 80 00 00 	movabs $0x800e2f,%rax
+  801106:	00 00 00 
+  801109:	ff d0                	call   *%rax
+  80110b:	4c 63 e8             	movslq %eax,%r13
+        if (res < 0)
+  80110e:	4d 85 ed             	test   %r13,%r13
+  801111:	0f 88 92 00 00 00    	js     8011a9 <devfile_read+0x100>
+        memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  801117:	4c 89 ea             	mov    %r13,%rdx
+  80111a:	4c 89 fe             	mov    %r15,%rsi
+  80111d:	4c 89 f7             	mov    %r14,%rdi
+  801120:	48 b8 2d 29 80 00 00 	movabs $0x80292d,%rax
+  801127:	00 00 00 
+  80112a:	ff d0                	call   *%rax
+        if (res < sizeof(fsipcbuf.readRet.ret_buf))
+  80112c:	49 81 fd ff 0f 00 00 	cmp    $0xfff,%r13
+  801133:	76 6d                	jbe    8011a2 <devfile_read+0xf9>
+        readsz += res;
+  801135:	4c 01 6d c0          	add    %r13,-0x40(%rbp)
+        buf += res;
+  801139:	4d 01 ee             	add    %r13,%r14
+        n -= res;
+  80113c:	4d 29 ec             	sub    %r13,%r12
+    while (n > sizeof(fsipcbuf.readRet.ret_buf))
+  80113f:	49 81 fc 00 10 00 00 	cmp    $0x1000,%r12
+  801146:	77 9b                	ja     8010e3 <devfile_read+0x3a>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801148:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  80114f:	00 00 00 
+  801152:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  801156:	8b 51 0c             	mov    0xc(%rcx),%edx
+  801159:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.read.req_n = n;
+  80115b:	4c 89 60 08          	mov    %r12,0x8(%rax)
+    ssize_t res = fsipc(FSREQ_READ, NULL);
+  80115f:	be 00 00 00 00       	mov    $0x0,%esi
+  801164:	bf 03 00 00 00       	mov    $0x3,%edi
+  801169:	48 b8 2f 0e 80 00 00 	movabs $0x800e2f,%rax
+  801170:	00 00 00 
+  801173:	ff d0                	call   *%rax
+  801175:	4c 63 e8             	movslq %eax,%r13
+    if (res < 0)
+  801178:	4d 85 ed             	test   %r13,%r13
+  80117b:	78 2c                	js     8011a9 <devfile_read+0x100>
+    memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  80117d:	4c 89 ea             	mov    %r13,%rdx
+  801180:	48 be 00 60 80 00 00 	movabs $0x806000,%rsi
+  801187:	00 00 00 
+  80118a:	4c 89 f7             	mov    %r14,%rdi
+  80118d:	48 b8 2d 29 80 00 00 	movabs $0x80292d,%rax
+  801194:	00 00 00 
+  801197:	ff d0                	call   *%rax
+    readsz += res;
+  801199:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80119d:	49 01 c5             	add    %rax,%r13
+    return readsz;
+  8011a0:	eb 07                	jmp    8011a9 <devfile_read+0x100>
+            return readsz + res;
+  8011a2:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8011a6:	49 01 c5             	add    %rax,%r13
+}
+  8011a9:	4c 89 e8             	mov    %r13,%rax
+  8011ac:	48 83 c4 18          	add    $0x18,%rsp
+  8011b0:	5b                   	pop    %rbx
+  8011b1:	41 5c                	pop    %r12
+  8011b3:	41 5d                	pop    %r13
+  8011b5:	41 5e                	pop    %r14
+  8011b7:	41 5f                	pop    %r15
+  8011b9:	5d                   	pop    %rbp
+  8011ba:	c3                   	ret
+    ssize_t readsz = 0;
+  8011bb:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  8011c2:	00 
+  8011c3:	eb 83                	jmp    801148 <devfile_read+0x9f>
+
+00000000008011c5 <open>:
+open(const char *path, int mode) {
+  8011c5:	55                   	push   %rbp
+  8011c6:	48 89 e5             	mov    %rsp,%rbp
+  8011c9:	41 55                	push   %r13
+  8011cb:	41 54                	push   %r12
+  8011cd:	53                   	push   %rbx
+  8011ce:	48 83 ec 18          	sub    $0x18,%rsp
+  8011d2:	49 89 fc             	mov    %rdi,%r12
+  8011d5:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  8011d8:	48 b8 8e 26 80 00 00 	movabs $0x80268e,%rax
+  8011df:	00 00 00 
+  8011e2:	ff d0                	call   *%rax
+  8011e4:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  8011ea:	0f 87 8a 00 00 00    	ja     80127a <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8011f0:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  8011f4:	48 b8 a8 07 80 00 00 	movabs $0x8007a8,%rax
+  8011fb:	00 00 00 
+  8011fe:	ff d0                	call   *%rax
+  801200:	89 c3                	mov    %eax,%ebx
+  801202:	85 c0                	test   %eax,%eax
+  801204:	78 50                	js     801256 <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  801206:	4c 89 e6             	mov    %r12,%rsi
+  801209:	48 bb 00 60 80 00 00 	movabs $0x806000,%rbx
+  801210:	00 00 00 
+  801213:	48 89 df             	mov    %rbx,%rdi
+  801216:	48 b8 cc 26 80 00 00 	movabs $0x8026cc,%rax
+  80121d:	00 00 00 
+  801220:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  801222:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801229:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  80122d:	bf 01 00 00 00       	mov    $0x1,%edi
+  801232:	48 b8 2f 0e 80 00 00 	movabs $0x800e2f,%rax
+  801239:	00 00 00 
+  80123c:	ff d0                	call   *%rax
+  80123e:	89 c3                	mov    %eax,%ebx
+  801240:	85 c0                	test   %eax,%eax
+  801242:	78 1f                	js     801263 <open+0x9e>
+    return fd2num(fd);
+  801244:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  801248:	48 b8 01 07 80 00 00 	movabs $0x800701,%rax
+  80124f:	00 00 00 
+  801252:	ff d0                	call   *%rax
+  801254:	89 c3                	mov    %eax,%ebx
+}
+  801256:	89 d8                	mov    %ebx,%eax
+  801258:	48 83 c4 18          	add    $0x18,%rsp
+  80125c:	5b                   	pop    %rbx
+  80125d:	41 5c                	pop    %r12
+  80125f:	41 5d                	pop    %r13
+  801261:	5d                   	pop    %rbp
+  801262:	c3                   	ret
+        fd_close(fd, 0);
+  801263:	be 00 00 00 00       	mov    $0x0,%esi
+  801268:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80126c:	48 b8 7d 08 80 00 00 	movabs $0x80087d,%rax
+  801273:	00 00 00 
+  801276:	ff d0                	call   *%rax
+        return res;
+  801278:	eb dc                	jmp    801256 <open+0x91>
+        return -E_BAD_PATH;
+  80127a:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  80127f:	eb d5                	jmp    801256 <open+0x91>
+
+0000000000801281 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  801281:	55                   	push   %rbp
+  801282:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc(FSREQ_SYNC, NULL);
+  801285:	be 00 00 00 00       	mov    $0x0,%esi
+  80128a:	bf 08 00 00 00       	mov    $0x8,%edi
+  80128f:	48 b8 2f 0e 80 00 00 	movabs $0x800e2f,%rax
+  801296:	00 00 00 
+  801299:	ff d0                	call   *%rax
+}
+  80129b:	5d                   	pop    %rbp
+  80129c:	c3                   	ret
+
+000000000080129d <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  80129d:	55                   	push   %rbp
+  80129e:	48 89 e5             	mov    %rsp,%rbp
+  8012a1:	41 54                	push   %r12
+  8012a3:	53                   	push   %rbx
+  8012a4:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8012a7:	48 b8 13 07 80 00 00 	movabs $0x800713,%rax
+  8012ae:	00 00 00 
+  8012b1:	ff d0                	call   *%rax
+  8012b3:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  8012b6:	48 be a0 2d 80 00 00 	movabs $0x802da0,%rsi
+  8012bd:	00 00 00 
+  8012c0:	48 89 df             	mov    %rbx,%rdi
+  8012c3:	48 b8 cc 26 80 00 00 	movabs $0x8026cc,%rax
+  8012ca:	00 00 00 
+  8012cd:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  8012cf:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  8012d4:	41 2b 04 24          	sub    (%r12),%eax
+  8012d8:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  8012de:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8012e5:	00 00 00 
+    stat->st_dev = &devpipe;
+  8012e8:	48 b8 60 40 80 00 00 	movabs $0x804060,%rax
+  8012ef:	00 00 00 
+  8012f2:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  8012f9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012fe:	5b                   	pop    %rbx
+  8012ff:	41 5c                	pop    %r12
+  801301:	5d                   	pop    %rbp
+  801302:	c3                   	ret
+
+0000000000801303 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  801303:	55                   	push   %rbp
+  801304:	48 89 e5             	mov    %rsp,%rbp
+  801307:	41 54                	push   %r12
+  801309:	53                   	push   %rbx
+  80130a:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  80130d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801312:	48 89 fe             	mov    %rdi,%rsi
+  801315:	bf 00 00 00 00       	mov    $0x0,%edi
+  80131a:	49 bc 92 03 80 00 00 	movabs $0x800392,%r12
+  801321:	00 00 00 
+  801324:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  801327:	48 89 df             	mov    %rbx,%rdi
+  80132a:	48 b8 13 07 80 00 00 	movabs $0x800713,%rax
+  801331:	00 00 00 
+  801334:	ff d0                	call   *%rax
+  801336:	48 89 c6             	mov    %rax,%rsi
+  801339:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80133e:	bf 00 00 00 00       	mov    $0x0,%edi
+  801343:	41 ff d4             	call   *%r12
+}
+  801346:	5b                   	pop    %rbx
+  801347:	41 5c                	pop    %r12
+  801349:	5d                   	pop    %rbp
+  80134a:	c3                   	ret
+
+000000000080134b <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  80134b:	55                   	push   %rbp
+  80134c:	48 89 e5             	mov    %rsp,%rbp
+  80134f:	41 57                	push   %r15
+  801351:	41 56                	push   %r14
+  801353:	41 55                	push   %r13
+  801355:	41 54                	push   %r12
+  801357:	53                   	push   %rbx
+  801358:	48 83 ec 18          	sub    $0x18,%rsp
+  80135c:	49 89 fc             	mov    %rdi,%r12
+  80135f:	49 89 f5             	mov    %rsi,%r13
+  801362:	49 89 d7             	mov    %rdx,%r15
+  801365:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  801369:	48 b8 13 07 80 00 00 	movabs $0x800713,%rax
+  801370:	00 00 00 
+  801373:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  801375:	4d 85 ff             	test   %r15,%r15
+  801378:	0f 84 af 00 00 00    	je     80142d <devpipe_write+0xe2>
+  80137e:	48 89 c3             	mov    %rax,%rbx
+  801381:	4c 89 f8             	mov    %r15,%rax
+  801384:	4d 89 ef             	mov    %r13,%r15
+  801387:	4c 01 e8             	add    %r13,%rax
+  80138a:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80138e:	49 bd 9a 02 80 00 00 	movabs $0x80029a,%r13
+  801395:	00 00 00 
+            sys_yield();
+  801398:	49 be 37 02 80 00 00 	movabs $0x800237,%r14
+  80139f:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  8013a2:	8b 73 04             	mov    0x4(%rbx),%esi
+  8013a5:	48 63 ce             	movslq %esi,%rcx
+  8013a8:	48 63 03             	movslq (%rbx),%rax
+  8013ab:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  8013b1:	48 39 c1             	cmp    %rax,%rcx
+  8013b4:	72 2e                	jb     8013e4 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8013b6:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8013bb:	48 89 da             	mov    %rbx,%rdx
+  8013be:	be 00 10 00 00       	mov    $0x1000,%esi
+  8013c3:	4c 89 e7             	mov    %r12,%rdi
+  8013c6:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  8013c9:	85 c0                	test   %eax,%eax
+  8013cb:	74 66                	je     801433 <devpipe_write+0xe8>
+            sys_yield();
+  8013cd:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  8013d0:	8b 73 04             	mov    0x4(%rbx),%esi
+  8013d3:	48 63 ce             	movslq %esi,%rcx
+  8013d6:	48 63 03             	movslq (%rbx),%rax
+  8013d9:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  8013df:	48 39 c1             	cmp    %rax,%rcx
+  8013e2:	73 d2                	jae    8013b6 <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8013e4:	41 0f b6 3f          	movzbl (%r15),%edi
+  8013e8:	48 89 ca             	mov    %rcx,%rdx
+  8013eb:	48 c1 ea 03          	shr    $0x3,%rdx
+  8013ef:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  8013f6:	08 10 20 
+  8013f9:	48 f7 e2             	mul    %rdx
+  8013fc:	48 c1 ea 06          	shr    $0x6,%rdx
+  801400:	48 89 d0             	mov    %rdx,%rax
+  801403:	48 c1 e0 09          	shl    $0x9,%rax
+  801407:	48 29 d0             	sub    %rdx,%rax
+  80140a:	48 c1 e0 03          	shl    $0x3,%rax
+  80140e:	48 29 c1             	sub    %rax,%rcx
+  801411:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  801416:	83 c6 01             	add    $0x1,%esi
+  801419:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  80141c:	49 83 c7 01          	add    $0x1,%r15
+  801420:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801424:	49 39 c7             	cmp    %rax,%r15
+  801427:	0f 85 75 ff ff ff    	jne    8013a2 <devpipe_write+0x57>
+    return n;
+  80142d:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  801431:	eb 05                	jmp    801438 <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  801433:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801438:	48 83 c4 18          	add    $0x18,%rsp
+  80143c:	5b                   	pop    %rbx
+  80143d:	41 5c                	pop    %r12
+  80143f:	41 5d                	pop    %r13
+  801441:	41 5e                	pop    %r14
+  801443:	41 5f                	pop    %r15
+  801445:	5d                   	pop    %rbp
+  801446:	c3                   	ret
+
+0000000000801447 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  801447:	55                   	push   %rbp
+  801448:	48 89 e5             	mov    %rsp,%rbp
+  80144b:	41 57                	push   %r15
+  80144d:	41 56                	push   %r14
+  80144f:	41 55                	push   %r13
+  801451:	41 54                	push   %r12
+  801453:	53                   	push   %rbx
+  801454:	48 83 ec 18          	sub    $0x18,%rsp
+  801458:	49 89 fc             	mov    %rdi,%r12
+  80145b:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  80145f:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  801463:	48 b8 13 07 80 00 00 	movabs $0x800713,%rax
+  80146a:	00 00 00 
+  80146d:	ff d0                	call   *%rax
+  80146f:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  801472:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  801478:	49 bd 9a 02 80 00 00 	movabs $0x80029a,%r13
+  80147f:	00 00 00 
+            sys_yield();
+  801482:	49 be 37 02 80 00 00 	movabs $0x800237,%r14
+  801489:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  80148c:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  801491:	74 7d                	je     801510 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  801493:	8b 03                	mov    (%rbx),%eax
+  801495:	3b 43 04             	cmp    0x4(%rbx),%eax
+  801498:	75 26                	jne    8014c0 <devpipe_read+0x79>
+            if (i > 0) return i;
+  80149a:	4d 85 ff             	test   %r15,%r15
+  80149d:	75 77                	jne    801516 <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80149f:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8014a4:	48 89 da             	mov    %rbx,%rdx
+  8014a7:	be 00 10 00 00       	mov    $0x1000,%esi
+  8014ac:	4c 89 e7             	mov    %r12,%rdi
+  8014af:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  8014b2:	85 c0                	test   %eax,%eax
+  8014b4:	74 72                	je     801528 <devpipe_read+0xe1>
+            sys_yield();
+  8014b6:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  8014b9:	8b 03                	mov    (%rbx),%eax
+  8014bb:	3b 43 04             	cmp    0x4(%rbx),%eax
+  8014be:	74 df                	je     80149f <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  8014c0:	48 63 c8             	movslq %eax,%rcx
+  8014c3:	48 89 ca             	mov    %rcx,%rdx
+  8014c6:	48 c1 ea 03          	shr    $0x3,%rdx
+  8014ca:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  8014d1:	08 10 20 
+  8014d4:	48 89 d0             	mov    %rdx,%rax
+  8014d7:	48 f7 e6             	mul    %rsi
+  8014da:	48 c1 ea 06          	shr    $0x6,%rdx
+  8014de:	48 89 d0             	mov    %rdx,%rax
+  8014e1:	48 c1 e0 09          	shl    $0x9,%rax
+  8014e5:	48 29 d0             	sub    %rdx,%rax
+  8014e8:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  8014ef:	00 
+  8014f0:	48 89 c8             	mov    %rcx,%rax
+  8014f3:	48 29 d0             	sub    %rdx,%rax
+  8014f6:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  8014fb:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8014ff:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  801503:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  801506:	49 83 c7 01          	add    $0x1,%r15
+  80150a:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  80150e:	75 83                	jne    801493 <devpipe_read+0x4c>
+    return n;
+  801510:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801514:	eb 03                	jmp    801519 <devpipe_read+0xd2>
+            if (i > 0) return i;
+  801516:	4c 89 f8             	mov    %r15,%rax
+}
+  801519:	48 83 c4 18          	add    $0x18,%rsp
+  80151d:	5b                   	pop    %rbx
+  80151e:	41 5c                	pop    %r12
+  801520:	41 5d                	pop    %r13
+  801522:	41 5e                	pop    %r14
+  801524:	41 5f                	pop    %r15
+  801526:	5d                   	pop    %rbp
+  801527:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  801528:	b8 00 00 00 00       	mov    $0x0,%eax
+  80152d:	eb ea                	jmp    801519 <devpipe_read+0xd2>
+
+000000000080152f <pipe>:
+pipe(int pfd[2]) {
+  80152f:	55                   	push   %rbp
+  801530:	48 89 e5             	mov    %rsp,%rbp
+  801533:	41 55                	push   %r13
+  801535:	41 54                	push   %r12
+  801537:	53                   	push   %rbx
+  801538:	48 81 ec b8 00 00 00 	sub    $0xb8,%rsp
+  80153f:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  801542:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  801546:	48 b8 a8 07 80 00 00 	movabs $0x8007a8,%rax
+  80154d:	00 00 00 
+  801550:	ff d0                	call   *%rax
+  801552:	89 c3                	mov    %eax,%ebx
+  801554:	85 c0                	test   %eax,%eax
+  801556:	0f 88 51 01 00 00    	js     8016ad <pipe+0x17e>
+        (res = fd_alloc_from(fd2num(fd0) + 1, &fd1)) < 0) goto err;
+  80155c:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  801560:	48 b8 01 07 80 00 00 	movabs $0x800701,%rax
+  801567:	00 00 00 
+  80156a:	ff d0                	call   *%rax
+  80156c:	8d 78 01             	lea    0x1(%rax),%edi
+  80156f:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801573:	48 b8 2f 07 80 00 00 	movabs $0x80072f,%rax
+  80157a:	00 00 00 
+  80157d:	ff d0                	call   *%rax
+  80157f:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  801581:	85 c0                	test   %eax,%eax
+  801583:	0f 88 24 01 00 00    	js     8016ad <pipe+0x17e>
+    va = fd2data(fd0);
+  801589:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80158d:	48 bb 13 07 80 00 00 	movabs $0x800713,%rbx
+  801594:	00 00 00 
+  801597:	ff d3                	call   *%rbx
+  801599:	49 89 c5             	mov    %rax,%r13
+    struct RegionOp ops[] = {
+  80159c:	48 8d bd 30 ff ff ff 	lea    -0xd0(%rbp),%rdi
+  8015a3:	b9 14 00 00 00       	mov    $0x14,%ecx
+  8015a8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015ad:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+  8015b0:	c7 85 34 ff ff ff 46 	movl   $0x46,-0xcc(%rbp)
+  8015b7:	00 00 00 
+  8015ba:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8015be:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+  8015c5:	48 c7 85 50 ff ff ff 	movq   $0x1000,-0xb0(%rbp)
+  8015cc:	00 10 00 00 
+  8015d0:	c7 85 5c ff ff ff 46 	movl   $0x46,-0xa4(%rbp)
+  8015d7:	00 00 00 
+            {.type = REGION_ALLOC, .dstva = (uintptr_t)fd1, .size = PAGE_SIZE, .perm = PROT_RW | PROT_SHARE},
+  8015da:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+    struct RegionOp ops[] = {
+  8015de:	48 89 bd 70 ff ff ff 	mov    %rdi,-0x90(%rbp)
+  8015e5:	48 c7 85 78 ff ff ff 	movq   $0x1000,-0x88(%rbp)
+  8015ec:	00 10 00 00 
+  8015f0:	c7 45 84 46 00 00 00 	movl   $0x46,-0x7c(%rbp)
+  8015f7:	4c 89 6d 98          	mov    %r13,-0x68(%rbp)
+  8015fb:	48 c7 45 a0 00 10 00 	movq   $0x1000,-0x60(%rbp)
+  801602:	00 
+  801603:	c7 45 a8 01 00 00 00 	movl   $0x1,-0x58(%rbp)
+  80160a:	c7 45 ac 46 00 00 00 	movl   $0x46,-0x54(%rbp)
+  801611:	4c 89 6d b8          	mov    %r13,-0x48(%rbp)
+            {.type = REGION_MAP, .srcva = (uintptr_t)va, .dstva = (uintptr_t)fd2data(fd1), .size = PAGE_SIZE, .perm = PROT_RW | PROT_SHARE},
+  801615:	ff d3                	call   *%rbx
+    struct RegionOp ops[] = {
+  801617:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80161b:	48 c7 45 c8 00 10 00 	movq   $0x1000,-0x38(%rbp)
+  801622:	00 
+    if ((res = sys_region_batch(ops, sizeof ops / sizeof *ops)) < 0) goto err1;
+  801623:	be 04 00 00 00       	mov    $0x4,%esi
+  801628:	48 8d bd 30 ff ff ff 	lea    -0xd0(%rbp),%rdi
+  80162f:	48 b8 f9 03 80 00 00 	movabs $0x8003f9,%rax
+  801636:	00 00 00 
+  801639:	ff d0                	call   *%rax
+  80163b:	89 c3                	mov    %eax,%ebx
+  80163d:	85 c0                	test   %eax,%eax
+  80163f:	0f 88 ad 00 00 00    	js     8016f2 <pipe+0x1c3>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  801645:	be 00 10 00 00       	mov    $0x1000,%esi
+  80164a:	4c 89 ef             	mov    %r13,%rdi
+  80164d:	48 b8 68 02 80 00 00 	movabs $0x800268,%rax
+  801654:	00 00 00 
+  801657:	ff d0                	call   *%rax
+  801659:	83 f8 02             	cmp    $0x2,%eax
+  80165c:	75 5f                	jne    8016bd <pipe+0x18e>
+    fd0->fd_dev_id = devpipe.dev_id;
+  80165e:	a1 60 40 80 00 00 00 	movabs 0x804060,%eax
+  801665:	00 00 
+  801667:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80166b:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  80166d:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801671:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  801678:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  80167c:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  80167e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801682:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  801689:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80168d:	48 bb 01 07 80 00 00 	movabs $0x800701,%rbx
+  801694:	00 00 00 
+  801697:	ff d3                	call   *%rbx
+  801699:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  80169d:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  8016a1:	ff d3                	call   *%rbx
+  8016a3:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  8016a8:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  8016ad:	89 d8                	mov    %ebx,%eax
+  8016af:	48 81 c4 b8 00 00 00 	add    $0xb8,%rsp
+  8016b6:	5b                   	pop    %rbx
+  8016b7:	41 5c                	pop    %r12
+  8016b9:	41 5d                	pop    %r13
+  8016bb:	5d                   	pop    %rbp
+  8016bc:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8016bd:	48 b9 d0 2d 80 00 00 	movabs $0x802dd0,%rcx
+  8016c4:	00 00 00 
+  8016c7:	48 ba a7 2d 80 00 00 	movabs $0x802da7,%rdx
+  8016ce:	00 00 00 
+  8016d1:	be 33 00 00 00       	mov    $0x33,%esi
+  8016d6:	48 bf bc 2d 80 00 00 	movabs $0x802dbc,%rdi
+  8016dd:	00 00 00 
+  8016e0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016e5:	49 b8 57 1c 80 00 00 	movabs $0x801c57,%r8
+  8016ec:	00 00 00 
+  8016ef:	41 ff d0             	call   *%r8
+        ops[i].type = REGION_UNMAP;
+  8016f2:	c7 85 30 ff ff ff 02 	movl   $0x2,-0xd0(%rbp)
+  8016f9:	00 00 00 
+  8016fc:	c7 85 58 ff ff ff 02 	movl   $0x2,-0xa8(%rbp)
+  801703:	00 00 00 
+  801706:	c7 45 80 02 00 00 00 	movl   $0x2,-0x80(%rbp)
+  80170d:	c7 45 a8 02 00 00 00 	movl   $0x2,-0x58(%rbp)
+    sys_region_batch(ops, sizeof ops / sizeof *ops);
+  801714:	be 04 00 00 00       	mov    $0x4,%esi
+  801719:	48 8d bd 30 ff ff ff 	lea    -0xd0(%rbp),%rdi
+  801720:	48 b8 f9 03 80 00 00 	movabs $0x8003f9,%rax
+  801727:	00 00 00 
+  80172a:	ff d0                	call   *%rax
+  80172c:	e9 7c ff ff ff       	jmp    8016ad <pipe+0x17e>
+
+0000000000801731 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  801731:	55                   	push   %rbp
+  801732:	48 89 e5             	mov    %rsp,%rbp
+  801735:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  801739:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80173d:	48 b8 c2 07 80 00 00 	movabs $0x8007c2,%rax
+  801744:	00 00 00 
+  801747:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801749:	85 c0                	test   %eax,%eax
+  80174b:	78 35                	js     801782 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  80174d:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801751:	48 b8 13 07 80 00 00 	movabs $0x800713,%rax
+  801758:	00 00 00 
+  80175b:	ff d0                	call   *%rax
+  80175d:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  801760:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  801765:	be 00 10 00 00       	mov    $0x1000,%esi
+  80176a:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80176e:	48 b8 9a 02 80 00 00 	movabs $0x80029a,%rax
+  801775:	00 00 00 
+  801778:	ff d0                	call   *%rax
+  80177a:	85 c0                	test   %eax,%eax
+  80177c:	0f 94 c0             	sete   %al
+  80177f:	0f b6 c0             	movzbl %al,%eax
+}
+  801782:	c9                   	leave
+  801783:	c3                   	ret
+
+0000000000801784 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  801784:	48 89 f8             	mov    %rdi,%rax
+  801787:	48 c1 e8 27          	shr    $0x27,%rax
+  80178b:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  801792:	01 00 00 
+  801795:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  801799:	f6 c2 01             	test   $0x1,%dl
+  80179c:	74 6d                	je     80180b <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  80179e:	48 89 f8             	mov    %rdi,%rax
+  8017a1:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8017a5:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8017ac:	01 00 00 
+  8017af:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8017b3:	f6 c2 01             	test   $0x1,%dl
+  8017b6:	74 62                	je     80181a <get_uvpt_entry+0x96>
+  8017b8:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8017bf:	01 00 00 
+  8017c2:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8017c6:	f6 c2 80             	test   $0x80,%dl
+  8017c9:	75 4f                	jne    80181a <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8017cb:	48 89 f8             	mov    %rdi,%rax
+  8017ce:	48 c1 e8 15          	shr    $0x15,%rax
+  8017d2:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8017d9:	01 00 00 
+  8017dc:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8017e0:	f6 c2 01             	test   $0x1,%dl
+  8017e3:	74 44                	je     801829 <get_uvpt_entry+0xa5>
+  8017e5:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8017ec:	01 00 00 
+  8017ef:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8017f3:	f6 c2 80             	test   $0x80,%dl
+  8017f6:	75 31                	jne    801829 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  8017f8:	48 c1 ef 0c          	shr    $0xc,%rdi
+  8017fc:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  801803:	01 00 00 
+  801806:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  80180a:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  80180b:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  801812:	01 00 00 
+  801815:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  801819:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  80181a:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  801821:	01 00 00 
+  801824:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  801828:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  801829:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  801830:	01 00 00 
+  801833:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  801837:	c3                   	ret
+
+0000000000801838 <get_prot>:
+
+int
+get_prot(void *va) {
+  801838:	55                   	push   %rbp
+  801839:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  80183c:	48 b8 84 17 80 00 00 	movabs $0x801784,%rax
+  801843:	00 00 00 
+  801846:	ff d0                	call   *%rax
+  801848:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  80184b:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  801850:	89 c1                	mov    %eax,%ecx
+  801852:	83 c9 04             	or     $0x4,%ecx
+  801855:	f6 c2 01             	test   $0x1,%dl
+  801858:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  80185b:	89 c1                	mov    %eax,%ecx
+  80185d:	83 c9 02             	or     $0x2,%ecx
+  801860:	f6 c2 02             	test   $0x2,%dl
+  801863:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  801866:	89 c1                	mov    %eax,%ecx
+  801868:	83 c9 01             	or     $0x1,%ecx
+  80186b:	48 85 d2             	test   %rdx,%rdx
+  80186e:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  801871:	89 c1                	mov    %eax,%ecx
+  801873:	83 c9 40             	or     $0x40,%ecx
+  801876:	f6 c6 04             	test   $0x4,%dh
+  801879:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  80187c:	5d                   	pop    %rbp
+  80187d:	c3                   	ret
+
+000000000080187e <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  80187e:	55                   	push   %rbp
+  80187f:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  801882:	48 b8 84 17 80 00 00 	movabs $0x801784,%rax
+  801889:	00 00 00 
+  80188c:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  80188e:	48 c1 e8 06          	shr    $0x6,%rax
+  801892:	83 e0 01             	and    $0x1,%eax
+}
+  801895:	5d                   	pop    %rbp
+  801896:	c3                   	ret
+
+0000000000801897 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  801897:	55                   	push   %rbp
+  801898:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  80189b:	48 b8 84 17 80 00 00 	movabs $0x801784,%rax
+  8018a2:	00 00 00 
+  8018a5:	ff d0                	call   *%rax
+  8018a7:	83 e0 01             	and    $0x1,%eax
+}
+  8018aa:	5d                   	pop    %rbp
+  8018ab:	c3                   	ret
+
+00000000008018ac <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  8018ac:	55                   	push   %rbp
+  8018ad:	48 89 e5             	mov    %rsp,%rbp
+  8018b0:	41 57                	push   %r15
+  8018b2:	41 56                	push   %r14
+  8018b4:	41 55                	push   %r13
+  8018b6:	41 54                	push   %r12
+  8018b8:	53                   	push   %rbx
+  8018b9:	48 83 ec 38          	sub    $0x38,%rsp
+  8018bd:	49 89 f7             	mov    %rsi,%r15
+  8018c0:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+                    }
+                    continue;
+                }
+                for (int ptei = 0; ptei < PT_ENTRY_COUNT; ptei++) {
+                    uintptr_t pte_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, pdei, ptei, 0);
+                    pte_t pte = uvpt[VPT(pte_addr)];
+  8018c6:	49 bd 00 00 00 00 00 	movabs $0x10000000000,%r13
+  8018cd:	01 00 00 
+  8018d0:	4d 89 e6             	mov    %r12,%r14
+  8018d3:	49 89 fc             	mov    %rdi,%r12
+  8018d6:	e9 19 01 00 00       	jmp    8019f4 <foreach_shared_region+0x148>
+  8018db:	48 89 5d b0          	mov    %rbx,-0x50(%rbp)
+  8018df:	4c 89 75 a8          	mov    %r14,-0x58(%rbp)
+  8018e3:	eb 52                	jmp    801937 <foreach_shared_region+0x8b>
+                for (int ptei = 0; ptei < PT_ENTRY_COUNT; ptei++) {
+  8018e5:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8018ec:	48 81 fb 00 00 20 00 	cmp    $0x200000,%rbx
+  8018f3:	74 2e                	je     801923 <foreach_shared_region+0x77>
+                    uintptr_t pte_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, pdei, ptei, 0);
+  8018f5:	48 89 df             	mov    %rbx,%rdi
+  8018f8:	4c 09 f7             	or     %r14,%rdi
+                    pte_t pte = uvpt[VPT(pte_addr)];
+  8018fb:	48 89 f8             	mov    %rdi,%rax
+  8018fe:	48 c1 e8 0c          	shr    $0xc,%rax
+  801902:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+                    if ((pte & PTE_P) && (pte & PTE_SHARE)) {
+  801907:	25 01 04 00 00       	and    $0x401,%eax
+  80190c:	48 3d 01 04 00 00    	cmp    $0x401,%rax
+  801912:	75 d1                	jne    8018e5 <foreach_shared_region+0x39>
+                        fun((void*)pte_addr, (void*)(pte_addr + PAGE_SIZE), arg);
+  801914:	48 8d b7 00 10 00 00 	lea    0x1000(%rdi),%rsi
+  80191b:	4c 89 fa             	mov    %r15,%rdx
+  80191e:	41 ff d4             	call   *%r12
+  801921:	eb c2                	jmp    8018e5 <foreach_shared_region+0x39>
+            for (int pdei = 0; pdei < PD_ENTRY_COUNT; pdei++) {
+  801923:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  80192a:	00 
+  80192b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80192f:	48 3d 00 00 00 40    	cmp    $0x40000000,%rax
+  801935:	74 46                	je     80197d <foreach_shared_region+0xd1>
+                uintptr_t pde_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, pdei, 0, 0);
+  801937:	4c 8b 75 c8          	mov    -0x38(%rbp),%r14
+  80193b:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80193f:	49 09 c6             	or     %rax,%r14
+                pde_t pde = uvpd[VPD(pde_addr)];
+  801942:	4c 89 f0             	mov    %r14,%rax
+  801945:	48 c1 e8 15          	shr    $0x15,%rax
+  801949:	48 b9 00 00 00 80 00 	movabs $0x10080000000,%rcx
+  801950:	01 00 00 
+  801953:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+                if (!(pde & PTE_P)) {
+  801957:	a8 01                	test   $0x1,%al
+  801959:	74 c8                	je     801923 <foreach_shared_region+0x77>
+                if (pde & PTE_PS) {
+  80195b:	48 89 c3             	mov    %rax,%rbx
+  80195e:	81 e3 80 00 00 00    	and    $0x80,%ebx
+  801964:	74 8f                	je     8018f5 <foreach_shared_region+0x49>
+                    if (pde & PTE_SHARE) {
+  801966:	f6 c4 04             	test   $0x4,%ah
+  801969:	74 b8                	je     801923 <foreach_shared_region+0x77>
+                        fun((void*)pde_addr, (void*)(pde_addr + 1024 * 1024 * 2), arg);
+  80196b:	49 8d b6 00 00 20 00 	lea    0x200000(%r14),%rsi
+  801972:	4c 89 fa             	mov    %r15,%rdx
+  801975:	4c 89 f7             	mov    %r14,%rdi
+  801978:	41 ff d4             	call   *%r12
+  80197b:	eb a6                	jmp    801923 <foreach_shared_region+0x77>
+  80197d:	48 8b 5d b0          	mov    -0x50(%rbp),%rbx
+  801981:	4c 8b 75 a8          	mov    -0x58(%rbp),%r14
+        for (int pdpei = 0; pdpei < PDP_ENTRY_COUNT; pdpei++) {
+  801985:	48 81 c3 00 00 00 40 	add    $0x40000000,%rbx
+  80198c:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  801993:	00 00 00 
+  801996:	48 39 c3             	cmp    %rax,%rbx
+  801999:	74 4c                	je     8019e7 <foreach_shared_region+0x13b>
+            uintptr_t pdpe_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, 0, 0, 0);
+  80199b:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  80199f:	48 09 d8             	or     %rbx,%rax
+  8019a2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+            pdpe_t pdpe = uvpdp[VPDP(pdpe_addr)];
+  8019a6:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8019aa:	48 b9 00 00 40 80 00 	movabs $0x10080400000,%rcx
+  8019b1:	01 00 00 
+  8019b4:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+            if (!(pdpe & PTE_P)) {
+  8019b8:	a8 01                	test   $0x1,%al
+  8019ba:	74 c9                	je     801985 <foreach_shared_region+0xd9>
+            if (pdpe & PTE_PS) {
+  8019bc:	48 89 c1             	mov    %rax,%rcx
+  8019bf:	81 e1 80 00 00 00    	and    $0x80,%ecx
+  8019c5:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  8019c9:	0f 84 0c ff ff ff    	je     8018db <foreach_shared_region+0x2f>
+                if (pdpe & PTE_SHARE) {
+  8019cf:	f6 c4 04             	test   $0x4,%ah
+  8019d2:	74 b1                	je     801985 <foreach_shared_region+0xd9>
+                    fun((void*)pdpe_addr, (void*)(pdpe_addr + 1024 * 1024 * 1024), arg); 
+  8019d4:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  8019d8:	48 8d b7 00 00 00 40 	lea    0x40000000(%rdi),%rsi
+  8019df:	4c 89 fa             	mov    %r15,%rdx
+  8019e2:	41 ff d4             	call   *%r12
+  8019e5:	eb 9e                	jmp    801985 <foreach_shared_region+0xd9>
+    for (int pml4ei = 0; pml4ei < PML4_ENTRY_COUNT; pml4ei++) {
+  8019e7:	49 83 c6 01          	add    $0x1,%r14
+  8019eb:	49 81 fe 00 02 00 00 	cmp    $0x200,%r14
+  8019f2:	74 24                	je     801a18 <foreach_shared_region+0x16c>
+        pml4e_t pml4e = uvpml4[VPML4(pml4_addr)];
+  8019f4:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  8019fb:	01 00 00 
+  8019fe:	4a 8b 04 f0          	mov    (%rax,%r14,8),%rax
+        if (!(pml4e & PTE_P)) {
+  801a02:	a8 01                	test   $0x1,%al
+  801a04:	74 e1                	je     8019e7 <foreach_shared_region+0x13b>
+  801a06:	4c 89 f0             	mov    %r14,%rax
+  801a09:	48 c1 e0 27          	shl    $0x27,%rax
+  801a0d:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  801a11:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a16:	eb 83                	jmp    80199b <foreach_shared_region+0xef>
+            }
+        }
+    }
+    
+    return 0;
+}
+  801a18:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a1d:	48 83 c4 38          	add    $0x38,%rsp
+  801a21:	5b                   	pop    %rbx
+  801a22:	41 5c                	pop    %r12
+  801a24:	41 5d                	pop    %r13
+  801a26:	41 5e                	pop    %r14
+  801a28:	41 5f                	pop    %r15
+  801a2a:	5d                   	pop    %rbp
+  801a2b:	c3                   	ret
+
+0000000000801a2c <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  801a2c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a31:	c3                   	ret
+
+0000000000801a32 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  801a32:	55                   	push   %rbp
+  801a33:	48 89 e5             	mov    %rsp,%rbp
+  801a36:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  801a39:	48 be f4 2d 80 00 00 	movabs $0x802df4,%rsi
+  801a40:	00 00 00 
+  801a43:	48 b8 cc 26 80 00 00 	movabs $0x8026cc,%rax
+  801a4a:	00 00 00 
+  801a4d:	ff d0                	call   *%rax
+    return 0;
+}
+  801a4f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a54:	5d                   	pop    %rbp
+  801a55:	c3                   	ret
+
+0000000000801a56 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  801a56:	55                   	push   %rbp
+  801a57:	48 89 e5             	mov    %rsp,%rbp
+  801a5a:	41 57                	push   %r15
+  801a5c:	41 56                	push   %r14
+  801a5e:	41 55                	push   %r13
+  801a60:	41 54                	push   %r12
+  801a62:	53                   	push   %rbx
+  801a63:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  801a6a:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  801a71:	48 85 d2             	test   %rdx,%rdx
+  801a74:	74 7a                	je     801af0 <devcons_write+0x9a>
+  801a76:	49 89 d6             	mov    %rdx,%r14
+  801a79:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  801a7f:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  801a84:	49 bf c6 28 80 00 00 	movabs $0x8028c6,%r15
+  801a8b:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  801a8e:	4c 89 f3             	mov    %r14,%rbx
+  801a91:	48 29 f3             	sub    %rsi,%rbx
+  801a94:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  801a99:	48 39 c3             	cmp    %rax,%rbx
+  801a9c:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  801aa0:	4c 63 eb             	movslq %ebx,%r13
+  801aa3:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  801aaa:	48 01 c6             	add    %rax,%rsi
+  801aad:	4c 89 ea             	mov    %r13,%rdx
+  801ab0:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  801ab7:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  801aba:	4c 89 ee             	mov    %r13,%rsi
+  801abd:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  801ac4:	48 b8 3d 01 80 00 00 	movabs $0x80013d,%rax
+  801acb:	00 00 00 
+  801ace:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  801ad0:	41 01 dc             	add    %ebx,%r12d
+  801ad3:	49 63 f4             	movslq %r12d,%rsi
+  801ad6:	4c 39 f6             	cmp    %r14,%rsi
+  801ad9:	72 b3                	jb     801a8e <devcons_write+0x38>
+    return res;
+  801adb:	49 63 c4             	movslq %r12d,%rax
+}
+  801ade:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  801ae5:	5b                   	pop    %rbx
+  801ae6:	41 5c                	pop    %r12
+  801ae8:	41 5d                	pop    %r13
+  801aea:	41 5e                	pop    %r14
+  801aec:	41 5f                	pop    %r15
+  801aee:	5d                   	pop    %rbp
+  801aef:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  801af0:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  801af6:	eb e3                	jmp    801adb <devcons_write+0x85>
+
+0000000000801af8 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  801af8:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  801afb:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b00:	48 85 c0             	test   %rax,%rax
+  801b03:	74 55                	je     801b5a <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  801b05:	55                   	push   %rbp
+  801b06:	48 89 e5             	mov    %rsp,%rbp
+  801b09:	41 55                	push   %r13
+  801b0b:	41 54                	push   %r12
+  801b0d:	53                   	push   %rbx
+  801b0e:	48 83 ec 08          	sub    $0x8,%rsp
+  801b12:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  801b15:	48 bb 6a 01 80 00 00 	movabs $0x80016a,%rbx
+  801b1c:	00 00 00 
+  801b1f:	49 bc 37 02 80 00 00 	movabs $0x800237,%r12
+  801b26:	00 00 00 
+  801b29:	eb 03                	jmp    801b2e <devcons_read+0x36>
+  801b2b:	41 ff d4             	call   *%r12
+  801b2e:	ff d3                	call   *%rbx
+  801b30:	85 c0                	test   %eax,%eax
+  801b32:	74 f7                	je     801b2b <devcons_read+0x33>
+    if (c < 0) return c;
+  801b34:	48 63 d0             	movslq %eax,%rdx
+  801b37:	78 13                	js     801b4c <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  801b39:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b3e:	83 f8 04             	cmp    $0x4,%eax
+  801b41:	74 09                	je     801b4c <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  801b43:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  801b47:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  801b4c:	48 89 d0             	mov    %rdx,%rax
+  801b4f:	48 83 c4 08          	add    $0x8,%rsp
+  801b53:	5b                   	pop    %rbx
+  801b54:	41 5c                	pop    %r12
+  801b56:	41 5d                	pop    %r13
+  801b58:	5d                   	pop    %rbp
+  801b59:	c3                   	ret
+  801b5a:	48 89 d0             	mov    %rdx,%rax
+  801b5d:	c3                   	ret
+
+0000000000801b5e <cputchar>:
+cputchar(int ch) {
+  801b5e:	55                   	push   %rbp
+  801b5f:	48 89 e5             	mov    %rsp,%rbp
+  801b62:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  801b66:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  801b6a:	be 01 00 00 00       	mov    $0x1,%esi
+  801b6f:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  801b73:	48 b8 3d 01 80 00 00 	movabs $0x80013d,%rax
+  801b7a:	00 00 00 
+  801b7d:	ff d0                	call   *%rax
+}
+  801b7f:	c9                   	leave
+  801b80:	c3                   	ret
+
+0000000000801b81 <getchar>:
+getchar(void) {
+  801b81:	55                   	push   %rbp
+  801b82:	48 89 e5             	mov    %rsp,%rbp
+  801b85:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  801b89:	ba 01 00 00 00       	mov    $0x1,%edx
+  801b8e:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  801b92:	bf 00 00 00 00       	mov    $0x0,%edi
+  801b97:	48 b8 a5 0a 80 00 00 	movabs $0x800aa5,%rax
+  801b9e:	00 00 00 
+  801ba1:	ff d0                	call   *%rax
+  801ba3:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  801ba5:	85 c0                	test   %eax,%eax
+  801ba7:	78 06                	js     801baf <getchar+0x2e>
+  801ba9:	74 08                	je     801bb3 <getchar+0x32>
+  801bab:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  801baf:	89 d0                	mov    %edx,%eax
+  801bb1:	c9                   	leave
+  801bb2:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  801bb3:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  801bb8:	eb f5                	jmp    801baf <getchar+0x2e>
+
+0000000000801bba <iscons>:
+iscons(int fdnum) {
+  801bba:	55                   	push   %rbp
+  801bbb:	48 89 e5             	mov    %rsp,%rbp
+  801bbe:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  801bc2:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801bc6:	48 b8 c2 07 80 00 00 	movabs $0x8007c2,%rax
+  801bcd:	00 00 00 
+  801bd0:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801bd2:	85 c0                	test   %eax,%eax
+  801bd4:	78 18                	js     801bee <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  801bd6:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801bda:	48 b8 a0 40 80 00 00 	movabs $0x8040a0,%rax
+  801be1:	00 00 00 
+  801be4:	8b 00                	mov    (%rax),%eax
+  801be6:	39 02                	cmp    %eax,(%rdx)
+  801be8:	0f 94 c0             	sete   %al
+  801beb:	0f b6 c0             	movzbl %al,%eax
+}
+  801bee:	c9                   	leave
+  801bef:	c3                   	ret
+
+0000000000801bf0 <opencons>:
+opencons(void) {
+  801bf0:	55                   	push   %rbp
+  801bf1:	48 89 e5             	mov    %rsp,%rbp
+  801bf4:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  801bf8:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  801bfc:	48 b8 a8 07 80 00 00 	movabs $0x8007a8,%rax
+  801c03:	00 00 00 
+  801c06:	ff d0                	call   *%rax
+  801c08:	85 c0                	test   %eax,%eax
+  801c0a:	78 49                	js     801c55 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  801c0c:	b9 46 00 00 00       	mov    $0x46,%ecx
+  801c11:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801c16:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  801c1a:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c1f:	48 b8 c6 02 80 00 00 	movabs $0x8002c6,%rax
+  801c26:	00 00 00 
+  801c29:	ff d0                	call   *%rax
+  801c2b:	85 c0                	test   %eax,%eax
+  801c2d:	78 26                	js     801c55 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  801c2f:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801c33:	a1 a0 40 80 00 00 00 	movabs 0x8040a0,%eax
+  801c3a:	00 00 
+  801c3c:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  801c3e:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801c42:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  801c49:	48 b8 01 07 80 00 00 	movabs $0x800701,%rax
+  801c50:	00 00 00 
+  801c53:	ff d0                	call   *%rax
+}
+  801c55:	c9                   	leave
+  801c56:	c3                   	ret
+
+0000000000801c57 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  801c57:	55                   	push   %rbp
+  801c58:	48 89 e5             	mov    %rsp,%rbp
+  801c5b:	41 56                	push   %r14
+  801c5d:	41 55                	push   %r13
+  801c5f:	41 54                	push   %r12
+  801c61:	53                   	push   %rbx
+  801c62:	48 83 ec 50          	sub    $0x50,%rsp
+  801c66:	49 89 fc             	mov    %rdi,%r12
+  801c69:	41 89 f5             	mov    %esi,%r13d
+  801c6c:	48 89 d3             	mov    %rdx,%rbx
+  801c6f:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  801c73:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  801c77:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  801c7b:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  801c82:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801c86:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  801c8a:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  801c8e:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  801c92:	48 b8 00 40 80 00 00 	movabs $0x804000,%rax
+  801c99:	00 00 00 
+  801c9c:	4c 8b 30             	mov    (%rax),%r14
+  801c9f:	48 b8 06 02 80 00 00 	movabs $0x800206,%rax
+  801ca6:	00 00 00 
+  801ca9:	ff d0                	call   *%rax
+  801cab:	89 c6                	mov    %eax,%esi
+  801cad:	45 89 e8             	mov    %r13d,%r8d
+  801cb0:	4c 89 e1             	mov    %r12,%rcx
+  801cb3:	4c 89 f2             	mov    %r14,%rdx
+  801cb6:	48 bf 00 2e 80 00 00 	movabs $0x802e00,%rdi
+  801cbd:	00 00 00 
+  801cc0:	b8 00 00 00 00       	mov    $0x0,%eax
+  801cc5:	49 bc a7 1d 80 00 00 	movabs $0x801da7,%r12
+  801ccc:	00 00 00 
+  801ccf:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  801cd2:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  801cd6:	48 89 df             	mov    %rbx,%rdi
+  801cd9:	48 b8 43 1d 80 00 00 	movabs $0x801d43,%rax
+  801ce0:	00 00 00 
+  801ce3:	ff d0                	call   *%rax
+    cprintf("\n");
+  801ce5:	48 bf 5b 2d 80 00 00 	movabs $0x802d5b,%rdi
+  801cec:	00 00 00 
+  801cef:	b8 00 00 00 00       	mov    $0x0,%eax
+  801cf4:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  801cf7:	cc                   	int3
+  801cf8:	eb fd                	jmp    801cf7 <_panic+0xa0>
+
+0000000000801cfa <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  801cfa:	55                   	push   %rbp
+  801cfb:	48 89 e5             	mov    %rsp,%rbp
+  801cfe:	53                   	push   %rbx
+  801cff:	48 83 ec 08          	sub    $0x8,%rsp
+  801d03:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  801d06:	8b 06                	mov    (%rsi),%eax
+  801d08:	8d 50 01             	lea    0x1(%rax),%edx
+  801d0b:	89 16                	mov    %edx,(%rsi)
+  801d0d:	48 98                	cltq
+  801d0f:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  801d14:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  801d1a:	74 0a                	je     801d26 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  801d1c:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  801d20:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801d24:	c9                   	leave
+  801d25:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  801d26:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  801d2a:	be ff 00 00 00       	mov    $0xff,%esi
+  801d2f:	48 b8 3d 01 80 00 00 	movabs $0x80013d,%rax
+  801d36:	00 00 00 
+  801d39:	ff d0                	call   *%rax
+        state->offset = 0;
+  801d3b:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  801d41:	eb d9                	jmp    801d1c <putch+0x22>
+
+0000000000801d43 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  801d43:	55                   	push   %rbp
+  801d44:	48 89 e5             	mov    %rsp,%rbp
+  801d47:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  801d4e:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  801d51:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  801d58:	b9 21 00 00 00       	mov    $0x21,%ecx
+  801d5d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d62:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  801d65:	48 89 f1             	mov    %rsi,%rcx
+  801d68:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  801d6f:	48 bf fa 1c 80 00 00 	movabs $0x801cfa,%rdi
+  801d76:	00 00 00 
+  801d79:	48 b8 f7 1e 80 00 00 	movabs $0x801ef7,%rax
+  801d80:	00 00 00 
+  801d83:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  801d85:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  801d8c:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  801d93:	48 b8 3d 01 80 00 00 	movabs $0x80013d,%rax
+  801d9a:	00 00 00 
+  801d9d:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  801d9f:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  801da5:	c9                   	leave
+  801da6:	c3                   	ret
+
+0000000000801da7 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  801da7:	55                   	push   %rbp
+  801da8:	48 89 e5             	mov    %rsp,%rbp
+  801dab:	48 83 ec 50          	sub    $0x50,%rsp
+  801daf:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  801db3:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  801db7:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801dbb:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  801dbf:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  801dc3:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  801dca:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801dce:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801dd2:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  801dd6:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  801dda:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  801dde:	48 b8 43 1d 80 00 00 	movabs $0x801d43,%rax
+  801de5:	00 00 00 
+  801de8:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  801dea:	c9                   	leave
+  801deb:	c3                   	ret
+
+0000000000801dec <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  801dec:	55                   	push   %rbp
+  801ded:	48 89 e5             	mov    %rsp,%rbp
+  801df0:	41 57                	push   %r15
+  801df2:	41 56                	push   %r14
+  801df4:	41 55                	push   %r13
+  801df6:	41 54                	push   %r12
+  801df8:	53                   	push   %rbx
+  801df9:	48 83 ec 18          	sub    $0x18,%rsp
+  801dfd:	49 89 fc             	mov    %rdi,%r12
+  801e00:	49 89 f5             	mov    %rsi,%r13
+  801e03:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801e07:	8b 45 10             	mov    0x10(%rbp),%eax
+  801e0a:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  801e0d:	41 89 cf             	mov    %ecx,%r15d
+  801e10:	4c 39 fa             	cmp    %r15,%rdx
+  801e13:	73 5b                	jae    801e70 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  801e15:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  801e19:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  801e1d:	85 db                	test   %ebx,%ebx
+  801e1f:	7e 0e                	jle    801e2f <print_num+0x43>
+            putch(padc, put_arg);
+  801e21:	4c 89 ee             	mov    %r13,%rsi
+  801e24:	44 89 f7             	mov    %r14d,%edi
+  801e27:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  801e2a:	83 eb 01             	sub    $0x1,%ebx
+  801e2d:	75 f2                	jne    801e21 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  801e2f:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  801e33:	48 b9 34 2e 80 00 00 	movabs $0x802e34,%rcx
+  801e3a:	00 00 00 
+  801e3d:	48 b8 23 2e 80 00 00 	movabs $0x802e23,%rax
+  801e44:	00 00 00 
+  801e47:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  801e4b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801e4f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e54:	49 f7 f7             	div    %r15
+  801e57:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  801e5b:	4c 89 ee             	mov    %r13,%rsi
+  801e5e:	41 ff d4             	call   *%r12
+}
+  801e61:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  801e65:	5b                   	pop    %rbx
+  801e66:	41 5c                	pop    %r12
+  801e68:	41 5d                	pop    %r13
+  801e6a:	41 5e                	pop    %r14
+  801e6c:	41 5f                	pop    %r15
+  801e6e:	5d                   	pop    %rbp
+  801e6f:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  801e70:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801e74:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e79:	49 f7 f7             	div    %r15
+  801e7c:	48 83 ec 08          	sub    $0x8,%rsp
+  801e80:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  801e84:	52                   	push   %rdx
+  801e85:	45 0f be c9          	movsbl %r9b,%r9d
+  801e89:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  801e8d:	48 89 c2             	mov    %rax,%rdx
+  801e90:	48 b8 ec 1d 80 00 00 	movabs $0x801dec,%rax
+  801e97:	00 00 00 
+  801e9a:	ff d0                	call   *%rax
+  801e9c:	48 83 c4 10          	add    $0x10,%rsp
+  801ea0:	eb 8d                	jmp    801e2f <print_num+0x43>
+
+0000000000801ea2 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  801ea2:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  801ea6:	48 8b 06             	mov    (%rsi),%rax
+  801ea9:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  801ead:	73 0a                	jae    801eb9 <sprintputch+0x17>
+        *state->start++ = ch;
+  801eaf:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801eb3:	48 89 16             	mov    %rdx,(%rsi)
+  801eb6:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  801eb9:	c3                   	ret
+
+0000000000801eba <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  801eba:	55                   	push   %rbp
+  801ebb:	48 89 e5             	mov    %rsp,%rbp
+  801ebe:	48 83 ec 50          	sub    $0x50,%rsp
+  801ec2:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801ec6:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  801eca:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  801ece:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  801ed5:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801ed9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801edd:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  801ee1:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  801ee5:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  801ee9:	48 b8 f7 1e 80 00 00 	movabs $0x801ef7,%rax
+  801ef0:	00 00 00 
+  801ef3:	ff d0                	call   *%rax
+}
+  801ef5:	c9                   	leave
+  801ef6:	c3                   	ret
+
+0000000000801ef7 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  801ef7:	55                   	push   %rbp
+  801ef8:	48 89 e5             	mov    %rsp,%rbp
+  801efb:	41 57                	push   %r15
+  801efd:	41 56                	push   %r14
+  801eff:	41 55                	push   %r13
+  801f01:	41 54                	push   %r12
+  801f03:	53                   	push   %rbx
+  801f04:	48 83 ec 38          	sub    $0x38,%rsp
+  801f08:	49 89 fe             	mov    %rdi,%r14
+  801f0b:	49 89 f5             	mov    %rsi,%r13
+  801f0e:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  801f11:	48 8b 01             	mov    (%rcx),%rax
+  801f14:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  801f18:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  801f1c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801f20:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  801f24:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  801f28:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  801f2c:	0f b6 3b             	movzbl (%rbx),%edi
+  801f2f:	40 80 ff 25          	cmp    $0x25,%dil
+  801f33:	74 18                	je     801f4d <vprintfmt+0x56>
+            if (!ch) return;
+  801f35:	40 84 ff             	test   %dil,%dil
+  801f38:	0f 84 b1 06 00 00    	je     8025ef <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  801f3e:	40 0f b6 ff          	movzbl %dil,%edi
+  801f42:	4c 89 ee             	mov    %r13,%rsi
+  801f45:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  801f48:	4c 89 e3             	mov    %r12,%rbx
+  801f4b:	eb db                	jmp    801f28 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  801f4d:	be 00 00 00 00       	mov    $0x0,%esi
+  801f52:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  801f56:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  801f5b:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  801f61:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  801f68:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  801f6c:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  801f71:	41 0f b6 04 24       	movzbl (%r12),%eax
+  801f76:	88 45 a0             	mov    %al,-0x60(%rbp)
+  801f79:	83 e8 23             	sub    $0x23,%eax
+  801f7c:	3c 57                	cmp    $0x57,%al
+  801f7e:	0f 87 51 06 00 00    	ja     8025d5 <vprintfmt+0x6de>
+  801f84:	0f b6 c0             	movzbl %al,%eax
+  801f87:	48 b9 e0 2f 80 00 00 	movabs $0x802fe0,%rcx
+  801f8e:	00 00 00 
+  801f91:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  801f94:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  801f97:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  801f9b:	eb cf                	jmp    801f6c <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  801f9d:	49 89 dc             	mov    %rbx,%r12
+  801fa0:	be 01 00 00 00       	mov    $0x1,%esi
+  801fa5:	eb c5                	jmp    801f6c <vprintfmt+0x75>
+            padc = ch;
+  801fa7:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  801fab:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  801fae:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801fb1:	eb b9                	jmp    801f6c <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  801fb3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801fb6:	83 f8 2f             	cmp    $0x2f,%eax
+  801fb9:	77 24                	ja     801fdf <vprintfmt+0xe8>
+  801fbb:	89 c1                	mov    %eax,%ecx
+  801fbd:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  801fc1:	83 c0 08             	add    $0x8,%eax
+  801fc4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801fc7:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  801fca:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  801fcd:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  801fd1:	79 99                	jns    801f6c <vprintfmt+0x75>
+                width = precision;
+  801fd3:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  801fd7:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  801fdd:	eb 8d                	jmp    801f6c <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  801fdf:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  801fe3:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  801fe7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801feb:	eb da                	jmp    801fc7 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  801fed:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  801ff2:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  801ff6:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  801ffc:	3c 39                	cmp    $0x39,%al
+  801ffe:	77 1c                	ja     80201c <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  802000:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  802004:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  802008:	0f b6 c0             	movzbl %al,%eax
+  80200b:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  802010:	0f b6 03             	movzbl (%rbx),%eax
+  802013:	3c 39                	cmp    $0x39,%al
+  802015:	76 e9                	jbe    802000 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  802017:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  80201a:	eb b1                	jmp    801fcd <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  80201c:	49 89 dc             	mov    %rbx,%r12
+  80201f:	eb ac                	jmp    801fcd <vprintfmt+0xd6>
+            width = MAX(0, width);
+  802021:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  802024:	85 c9                	test   %ecx,%ecx
+  802026:	b8 00 00 00 00       	mov    $0x0,%eax
+  80202b:	0f 49 c1             	cmovns %ecx,%eax
+  80202e:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  802031:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  802034:	e9 33 ff ff ff       	jmp    801f6c <vprintfmt+0x75>
+            lflag++;
+  802039:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  80203c:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80203f:	e9 28 ff ff ff       	jmp    801f6c <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  802044:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802047:	83 f8 2f             	cmp    $0x2f,%eax
+  80204a:	77 19                	ja     802065 <vprintfmt+0x16e>
+  80204c:	89 c2                	mov    %eax,%edx
+  80204e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802052:	83 c0 08             	add    $0x8,%eax
+  802055:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802058:	8b 3a                	mov    (%rdx),%edi
+  80205a:	4c 89 ee             	mov    %r13,%rsi
+  80205d:	41 ff d6             	call   *%r14
+            break;
+  802060:	e9 c3 fe ff ff       	jmp    801f28 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  802065:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802069:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80206d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802071:	eb e5                	jmp    802058 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  802073:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802076:	83 f8 2f             	cmp    $0x2f,%eax
+  802079:	77 5a                	ja     8020d5 <vprintfmt+0x1de>
+  80207b:	89 c2                	mov    %eax,%edx
+  80207d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802081:	83 c0 08             	add    $0x8,%eax
+  802084:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  802087:	8b 02                	mov    (%rdx),%eax
+  802089:	89 c1                	mov    %eax,%ecx
+  80208b:	f7 d9                	neg    %ecx
+  80208d:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  802090:	83 f9 15             	cmp    $0x15,%ecx
+  802093:	7f 4e                	jg     8020e3 <vprintfmt+0x1ec>
+  802095:	48 63 c1             	movslq %ecx,%rax
+  802098:	48 ba a0 32 80 00 00 	movabs $0x8032a0,%rdx
+  80209f:	00 00 00 
+  8020a2:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8020a6:	48 85 c0             	test   %rax,%rax
+  8020a9:	74 38                	je     8020e3 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  8020ab:	48 89 c1             	mov    %rax,%rcx
+  8020ae:	48 ba b9 2d 80 00 00 	movabs $0x802db9,%rdx
+  8020b5:	00 00 00 
+  8020b8:	4c 89 ee             	mov    %r13,%rsi
+  8020bb:	4c 89 f7             	mov    %r14,%rdi
+  8020be:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020c3:	49 b8 ba 1e 80 00 00 	movabs $0x801eba,%r8
+  8020ca:	00 00 00 
+  8020cd:	41 ff d0             	call   *%r8
+  8020d0:	e9 53 fe ff ff       	jmp    801f28 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  8020d5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8020d9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8020dd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8020e1:	eb a4                	jmp    802087 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  8020e3:	48 ba 4c 2e 80 00 00 	movabs $0x802e4c,%rdx
+  8020ea:	00 00 00 
+  8020ed:	4c 89 ee             	mov    %r13,%rsi
+  8020f0:	4c 89 f7             	mov    %r14,%rdi
+  8020f3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020f8:	49 b8 ba 1e 80 00 00 	movabs $0x801eba,%r8
+  8020ff:	00 00 00 
+  802102:	41 ff d0             	call   *%r8
+  802105:	e9 1e fe ff ff       	jmp    801f28 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  80210a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80210d:	83 f8 2f             	cmp    $0x2f,%eax
+  802110:	77 6c                	ja     80217e <vprintfmt+0x287>
+  802112:	89 c2                	mov    %eax,%edx
+  802114:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802118:	83 c0 08             	add    $0x8,%eax
+  80211b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80211e:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  802121:	48 85 d2             	test   %rdx,%rdx
+  802124:	48 b8 45 2e 80 00 00 	movabs $0x802e45,%rax
+  80212b:	00 00 00 
+  80212e:	48 0f 45 c2          	cmovne %rdx,%rax
+  802132:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  802136:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  80213a:	7e 06                	jle    802142 <vprintfmt+0x24b>
+  80213c:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  802140:	75 4a                	jne    80218c <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  802142:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  802146:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  80214a:	0f b6 00             	movzbl (%rax),%eax
+  80214d:	84 c0                	test   %al,%al
+  80214f:	0f 85 9a 00 00 00    	jne    8021ef <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  802155:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  802158:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  80215c:	85 c0                	test   %eax,%eax
+  80215e:	0f 8e c4 fd ff ff    	jle    801f28 <vprintfmt+0x31>
+  802164:	4c 89 ee             	mov    %r13,%rsi
+  802167:	bf 20 00 00 00       	mov    $0x20,%edi
+  80216c:	41 ff d6             	call   *%r14
+  80216f:	41 83 ec 01          	sub    $0x1,%r12d
+  802173:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  802177:	75 eb                	jne    802164 <vprintfmt+0x26d>
+  802179:	e9 aa fd ff ff       	jmp    801f28 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  80217e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802182:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802186:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80218a:	eb 92                	jmp    80211e <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  80218c:	49 63 f7             	movslq %r15d,%rsi
+  80218f:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  802193:	48 b8 a9 26 80 00 00 	movabs $0x8026a9,%rax
+  80219a:	00 00 00 
+  80219d:	ff d0                	call   *%rax
+  80219f:	48 89 c2             	mov    %rax,%rdx
+  8021a2:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8021a5:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  8021a7:	8d 70 ff             	lea    -0x1(%rax),%esi
+  8021aa:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  8021ad:	85 c0                	test   %eax,%eax
+  8021af:	7e 91                	jle    802142 <vprintfmt+0x24b>
+  8021b1:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  8021b6:	4c 89 ee             	mov    %r13,%rsi
+  8021b9:	44 89 e7             	mov    %r12d,%edi
+  8021bc:	41 ff d6             	call   *%r14
+  8021bf:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8021c3:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8021c6:	83 f8 ff             	cmp    $0xffffffff,%eax
+  8021c9:	75 eb                	jne    8021b6 <vprintfmt+0x2bf>
+  8021cb:	e9 72 ff ff ff       	jmp    802142 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8021d0:	0f b6 f8             	movzbl %al,%edi
+  8021d3:	4c 89 ee             	mov    %r13,%rsi
+  8021d6:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8021d9:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8021dd:	49 83 c4 01          	add    $0x1,%r12
+  8021e1:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  8021e7:	84 c0                	test   %al,%al
+  8021e9:	0f 84 66 ff ff ff    	je     802155 <vprintfmt+0x25e>
+  8021ef:	45 85 ff             	test   %r15d,%r15d
+  8021f2:	78 0a                	js     8021fe <vprintfmt+0x307>
+  8021f4:	41 83 ef 01          	sub    $0x1,%r15d
+  8021f8:	0f 88 57 ff ff ff    	js     802155 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8021fe:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  802202:	74 cc                	je     8021d0 <vprintfmt+0x2d9>
+  802204:	8d 50 e0             	lea    -0x20(%rax),%edx
+  802207:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  80220c:	80 fa 5e             	cmp    $0x5e,%dl
+  80220f:	77 c2                	ja     8021d3 <vprintfmt+0x2dc>
+  802211:	eb bd                	jmp    8021d0 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  802213:	40 84 f6             	test   %sil,%sil
+  802216:	75 26                	jne    80223e <vprintfmt+0x347>
+    switch (lflag) {
+  802218:	85 d2                	test   %edx,%edx
+  80221a:	74 59                	je     802275 <vprintfmt+0x37e>
+  80221c:	83 fa 01             	cmp    $0x1,%edx
+  80221f:	74 7b                	je     80229c <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  802221:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802224:	83 f8 2f             	cmp    $0x2f,%eax
+  802227:	0f 87 96 00 00 00    	ja     8022c3 <vprintfmt+0x3cc>
+  80222d:	89 c2                	mov    %eax,%edx
+  80222f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802233:	83 c0 08             	add    $0x8,%eax
+  802236:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802239:	4c 8b 22             	mov    (%rdx),%r12
+  80223c:	eb 17                	jmp    802255 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  80223e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802241:	83 f8 2f             	cmp    $0x2f,%eax
+  802244:	77 21                	ja     802267 <vprintfmt+0x370>
+  802246:	89 c2                	mov    %eax,%edx
+  802248:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80224c:	83 c0 08             	add    $0x8,%eax
+  80224f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802252:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  802255:	4d 85 e4             	test   %r12,%r12
+  802258:	78 7a                	js     8022d4 <vprintfmt+0x3dd>
+            num = i;
+  80225a:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  80225d:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  802262:	e9 50 02 00 00       	jmp    8024b7 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  802267:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80226b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80226f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802273:	eb dd                	jmp    802252 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  802275:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802278:	83 f8 2f             	cmp    $0x2f,%eax
+  80227b:	77 11                	ja     80228e <vprintfmt+0x397>
+  80227d:	89 c2                	mov    %eax,%edx
+  80227f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802283:	83 c0 08             	add    $0x8,%eax
+  802286:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802289:	4c 63 22             	movslq (%rdx),%r12
+  80228c:	eb c7                	jmp    802255 <vprintfmt+0x35e>
+  80228e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802292:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802296:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80229a:	eb ed                	jmp    802289 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  80229c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80229f:	83 f8 2f             	cmp    $0x2f,%eax
+  8022a2:	77 11                	ja     8022b5 <vprintfmt+0x3be>
+  8022a4:	89 c2                	mov    %eax,%edx
+  8022a6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8022aa:	83 c0 08             	add    $0x8,%eax
+  8022ad:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8022b0:	4c 8b 22             	mov    (%rdx),%r12
+  8022b3:	eb a0                	jmp    802255 <vprintfmt+0x35e>
+  8022b5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8022b9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8022bd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8022c1:	eb ed                	jmp    8022b0 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  8022c3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8022c7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8022cb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8022cf:	e9 65 ff ff ff       	jmp    802239 <vprintfmt+0x342>
+                putch('-', put_arg);
+  8022d4:	4c 89 ee             	mov    %r13,%rsi
+  8022d7:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  8022dc:	41 ff d6             	call   *%r14
+                i = -i;
+  8022df:	49 f7 dc             	neg    %r12
+  8022e2:	e9 73 ff ff ff       	jmp    80225a <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  8022e7:	40 84 f6             	test   %sil,%sil
+  8022ea:	75 32                	jne    80231e <vprintfmt+0x427>
+    switch (lflag) {
+  8022ec:	85 d2                	test   %edx,%edx
+  8022ee:	74 5d                	je     80234d <vprintfmt+0x456>
+  8022f0:	83 fa 01             	cmp    $0x1,%edx
+  8022f3:	0f 84 82 00 00 00    	je     80237b <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  8022f9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8022fc:	83 f8 2f             	cmp    $0x2f,%eax
+  8022ff:	0f 87 a5 00 00 00    	ja     8023aa <vprintfmt+0x4b3>
+  802305:	89 c2                	mov    %eax,%edx
+  802307:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80230b:	83 c0 08             	add    $0x8,%eax
+  80230e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802311:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  802314:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  802319:	e9 99 01 00 00       	jmp    8024b7 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  80231e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802321:	83 f8 2f             	cmp    $0x2f,%eax
+  802324:	77 19                	ja     80233f <vprintfmt+0x448>
+  802326:	89 c2                	mov    %eax,%edx
+  802328:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80232c:	83 c0 08             	add    $0x8,%eax
+  80232f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802332:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  802335:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  80233a:	e9 78 01 00 00       	jmp    8024b7 <vprintfmt+0x5c0>
+  80233f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802343:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802347:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80234b:	eb e5                	jmp    802332 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  80234d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802350:	83 f8 2f             	cmp    $0x2f,%eax
+  802353:	77 18                	ja     80236d <vprintfmt+0x476>
+  802355:	89 c2                	mov    %eax,%edx
+  802357:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80235b:	83 c0 08             	add    $0x8,%eax
+  80235e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802361:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  802363:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  802368:	e9 4a 01 00 00       	jmp    8024b7 <vprintfmt+0x5c0>
+  80236d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802371:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802375:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802379:	eb e6                	jmp    802361 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  80237b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80237e:	83 f8 2f             	cmp    $0x2f,%eax
+  802381:	77 19                	ja     80239c <vprintfmt+0x4a5>
+  802383:	89 c2                	mov    %eax,%edx
+  802385:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802389:	83 c0 08             	add    $0x8,%eax
+  80238c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80238f:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  802392:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  802397:	e9 1b 01 00 00       	jmp    8024b7 <vprintfmt+0x5c0>
+  80239c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8023a0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8023a4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8023a8:	eb e5                	jmp    80238f <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  8023aa:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8023ae:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8023b2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8023b6:	e9 56 ff ff ff       	jmp    802311 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  8023bb:	40 84 f6             	test   %sil,%sil
+  8023be:	75 2e                	jne    8023ee <vprintfmt+0x4f7>
+    switch (lflag) {
+  8023c0:	85 d2                	test   %edx,%edx
+  8023c2:	74 59                	je     80241d <vprintfmt+0x526>
+  8023c4:	83 fa 01             	cmp    $0x1,%edx
+  8023c7:	74 7f                	je     802448 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  8023c9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8023cc:	83 f8 2f             	cmp    $0x2f,%eax
+  8023cf:	0f 87 9f 00 00 00    	ja     802474 <vprintfmt+0x57d>
+  8023d5:	89 c2                	mov    %eax,%edx
+  8023d7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8023db:	83 c0 08             	add    $0x8,%eax
+  8023de:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8023e1:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8023e4:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  8023e9:	e9 c9 00 00 00       	jmp    8024b7 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8023ee:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8023f1:	83 f8 2f             	cmp    $0x2f,%eax
+  8023f4:	77 19                	ja     80240f <vprintfmt+0x518>
+  8023f6:	89 c2                	mov    %eax,%edx
+  8023f8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8023fc:	83 c0 08             	add    $0x8,%eax
+  8023ff:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802402:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  802405:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  80240a:	e9 a8 00 00 00       	jmp    8024b7 <vprintfmt+0x5c0>
+  80240f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802413:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802417:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80241b:	eb e5                	jmp    802402 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  80241d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802420:	83 f8 2f             	cmp    $0x2f,%eax
+  802423:	77 15                	ja     80243a <vprintfmt+0x543>
+  802425:	89 c2                	mov    %eax,%edx
+  802427:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80242b:	83 c0 08             	add    $0x8,%eax
+  80242e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802431:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  802433:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  802438:	eb 7d                	jmp    8024b7 <vprintfmt+0x5c0>
+  80243a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80243e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802442:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802446:	eb e9                	jmp    802431 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  802448:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80244b:	83 f8 2f             	cmp    $0x2f,%eax
+  80244e:	77 16                	ja     802466 <vprintfmt+0x56f>
+  802450:	89 c2                	mov    %eax,%edx
+  802452:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802456:	83 c0 08             	add    $0x8,%eax
+  802459:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80245c:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  80245f:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  802464:	eb 51                	jmp    8024b7 <vprintfmt+0x5c0>
+  802466:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80246a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80246e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802472:	eb e8                	jmp    80245c <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  802474:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802478:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80247c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802480:	e9 5c ff ff ff       	jmp    8023e1 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  802485:	4c 89 ee             	mov    %r13,%rsi
+  802488:	bf 30 00 00 00       	mov    $0x30,%edi
+  80248d:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  802490:	4c 89 ee             	mov    %r13,%rsi
+  802493:	bf 78 00 00 00       	mov    $0x78,%edi
+  802498:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  80249b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80249e:	83 f8 2f             	cmp    $0x2f,%eax
+  8024a1:	77 47                	ja     8024ea <vprintfmt+0x5f3>
+  8024a3:	89 c2                	mov    %eax,%edx
+  8024a5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8024a9:	83 c0 08             	add    $0x8,%eax
+  8024ac:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8024af:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8024b2:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  8024b7:	48 83 ec 08          	sub    $0x8,%rsp
+  8024bb:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  8024bf:	0f 94 c0             	sete   %al
+  8024c2:	0f b6 c0             	movzbl %al,%eax
+  8024c5:	50                   	push   %rax
+  8024c6:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  8024cb:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  8024cf:	4c 89 ee             	mov    %r13,%rsi
+  8024d2:	4c 89 f7             	mov    %r14,%rdi
+  8024d5:	48 b8 ec 1d 80 00 00 	movabs $0x801dec,%rax
+  8024dc:	00 00 00 
+  8024df:	ff d0                	call   *%rax
+            break;
+  8024e1:	48 83 c4 10          	add    $0x10,%rsp
+  8024e5:	e9 3e fa ff ff       	jmp    801f28 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  8024ea:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8024ee:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8024f2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8024f6:	eb b7                	jmp    8024af <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  8024f8:	40 84 f6             	test   %sil,%sil
+  8024fb:	75 2b                	jne    802528 <vprintfmt+0x631>
+    switch (lflag) {
+  8024fd:	85 d2                	test   %edx,%edx
+  8024ff:	74 56                	je     802557 <vprintfmt+0x660>
+  802501:	83 fa 01             	cmp    $0x1,%edx
+  802504:	74 7f                	je     802585 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  802506:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802509:	83 f8 2f             	cmp    $0x2f,%eax
+  80250c:	0f 87 a2 00 00 00    	ja     8025b4 <vprintfmt+0x6bd>
+  802512:	89 c2                	mov    %eax,%edx
+  802514:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802518:	83 c0 08             	add    $0x8,%eax
+  80251b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80251e:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  802521:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  802526:	eb 8f                	jmp    8024b7 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  802528:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80252b:	83 f8 2f             	cmp    $0x2f,%eax
+  80252e:	77 19                	ja     802549 <vprintfmt+0x652>
+  802530:	89 c2                	mov    %eax,%edx
+  802532:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802536:	83 c0 08             	add    $0x8,%eax
+  802539:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80253c:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  80253f:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  802544:	e9 6e ff ff ff       	jmp    8024b7 <vprintfmt+0x5c0>
+  802549:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80254d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802551:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802555:	eb e5                	jmp    80253c <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  802557:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80255a:	83 f8 2f             	cmp    $0x2f,%eax
+  80255d:	77 18                	ja     802577 <vprintfmt+0x680>
+  80255f:	89 c2                	mov    %eax,%edx
+  802561:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802565:	83 c0 08             	add    $0x8,%eax
+  802568:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80256b:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  80256d:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  802572:	e9 40 ff ff ff       	jmp    8024b7 <vprintfmt+0x5c0>
+  802577:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80257b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80257f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802583:	eb e6                	jmp    80256b <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  802585:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802588:	83 f8 2f             	cmp    $0x2f,%eax
+  80258b:	77 19                	ja     8025a6 <vprintfmt+0x6af>
+  80258d:	89 c2                	mov    %eax,%edx
+  80258f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802593:	83 c0 08             	add    $0x8,%eax
+  802596:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802599:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  80259c:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  8025a1:	e9 11 ff ff ff       	jmp    8024b7 <vprintfmt+0x5c0>
+  8025a6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8025aa:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8025ae:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8025b2:	eb e5                	jmp    802599 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  8025b4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8025b8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8025bc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8025c0:	e9 59 ff ff ff       	jmp    80251e <vprintfmt+0x627>
+            putch(ch, put_arg);
+  8025c5:	4c 89 ee             	mov    %r13,%rsi
+  8025c8:	bf 25 00 00 00       	mov    $0x25,%edi
+  8025cd:	41 ff d6             	call   *%r14
+            break;
+  8025d0:	e9 53 f9 ff ff       	jmp    801f28 <vprintfmt+0x31>
+            putch('%', put_arg);
+  8025d5:	4c 89 ee             	mov    %r13,%rsi
+  8025d8:	bf 25 00 00 00       	mov    $0x25,%edi
+  8025dd:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  8025e0:	48 83 eb 01          	sub    $0x1,%rbx
+  8025e4:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  8025e8:	75 f6                	jne    8025e0 <vprintfmt+0x6e9>
+  8025ea:	e9 39 f9 ff ff       	jmp    801f28 <vprintfmt+0x31>
+}
+  8025ef:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8025f3:	5b                   	pop    %rbx
+  8025f4:	41 5c                	pop    %r12
+  8025f6:	41 5d                	pop    %r13
+  8025f8:	41 5e                	pop    %r14
+  8025fa:	41 5f                	pop    %r15
+  8025fc:	5d                   	pop    %rbp
+  8025fd:	c3                   	ret
+
+00000000008025fe <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  8025fe:	55                   	push   %rbp
+  8025ff:	48 89 e5             	mov    %rsp,%rbp
+  802602:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  802606:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80260a:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  80260f:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  802613:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  80261a:	48 85 ff             	test   %rdi,%rdi
+  80261d:	74 2b                	je     80264a <vsnprintf+0x4c>
+  80261f:	48 85 f6             	test   %rsi,%rsi
+  802622:	74 26                	je     80264a <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  802624:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802628:	48 bf a2 1e 80 00 00 	movabs $0x801ea2,%rdi
+  80262f:	00 00 00 
+  802632:	48 b8 f7 1e 80 00 00 	movabs $0x801ef7,%rax
+  802639:	00 00 00 
+  80263c:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  80263e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802642:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  802645:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  802648:	c9                   	leave
+  802649:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  80264a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80264f:	eb f7                	jmp    802648 <vsnprintf+0x4a>
+
+0000000000802651 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  802651:	55                   	push   %rbp
+  802652:	48 89 e5             	mov    %rsp,%rbp
+  802655:	48 83 ec 50          	sub    $0x50,%rsp
+  802659:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80265d:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  802661:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  802665:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  80266c:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802670:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802674:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  802678:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  80267c:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  802680:	48 b8 fe 25 80 00 00 	movabs $0x8025fe,%rax
+  802687:	00 00 00 
+  80268a:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  80268c:	c9                   	leave
+  80268d:	c3                   	ret
+
+000000000080268e <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  80268e:	80 3f 00             	cmpb   $0x0,(%rdi)
+  802691:	74 10                	je     8026a3 <strlen+0x15>
+    size_t n = 0;
+  802693:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  802698:	48 83 c0 01          	add    $0x1,%rax
+  80269c:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  8026a0:	75 f6                	jne    802698 <strlen+0xa>
+  8026a2:	c3                   	ret
+    size_t n = 0;
+  8026a3:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  8026a8:	c3                   	ret
+
+00000000008026a9 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  8026a9:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  8026ac:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  8026b1:	48 85 f6             	test   %rsi,%rsi
+  8026b4:	74 11                	je     8026c7 <strnlen+0x1e>
+  8026b6:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  8026ba:	74 0c                	je     8026c8 <strnlen+0x1f>
+  8026bc:	48 83 c2 01          	add    $0x1,%rdx
+  8026c0:	48 39 d0             	cmp    %rdx,%rax
+  8026c3:	75 f1                	jne    8026b6 <strnlen+0xd>
+  8026c5:	eb 04                	jmp    8026cb <strnlen+0x22>
+  8026c7:	c3                   	ret
+  8026c8:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  8026cb:	c3                   	ret
+
+00000000008026cc <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  8026cc:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  8026cf:	ba 00 00 00 00       	mov    $0x0,%edx
+  8026d4:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  8026d8:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  8026db:	48 83 c2 01          	add    $0x1,%rdx
+  8026df:	84 c9                	test   %cl,%cl
+  8026e1:	75 f1                	jne    8026d4 <strcpy+0x8>
+        ;
+    return res;
+}
+  8026e3:	c3                   	ret
+
+00000000008026e4 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  8026e4:	55                   	push   %rbp
+  8026e5:	48 89 e5             	mov    %rsp,%rbp
+  8026e8:	41 54                	push   %r12
+  8026ea:	53                   	push   %rbx
+  8026eb:	48 89 fb             	mov    %rdi,%rbx
+  8026ee:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  8026f1:	48 b8 8e 26 80 00 00 	movabs $0x80268e,%rax
+  8026f8:	00 00 00 
+  8026fb:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  8026fd:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  802701:	4c 89 e6             	mov    %r12,%rsi
+  802704:	48 b8 cc 26 80 00 00 	movabs $0x8026cc,%rax
+  80270b:	00 00 00 
+  80270e:	ff d0                	call   *%rax
+    return dst;
+}
+  802710:	48 89 d8             	mov    %rbx,%rax
+  802713:	5b                   	pop    %rbx
+  802714:	41 5c                	pop    %r12
+  802716:	5d                   	pop    %rbp
+  802717:	c3                   	ret
+
+0000000000802718 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  802718:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  80271b:	48 85 d2             	test   %rdx,%rdx
+  80271e:	74 1f                	je     80273f <strncpy+0x27>
+  802720:	48 01 fa             	add    %rdi,%rdx
+  802723:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  802726:	48 83 c1 01          	add    $0x1,%rcx
+  80272a:	44 0f b6 06          	movzbl (%rsi),%r8d
+  80272e:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  802732:	41 80 f8 01          	cmp    $0x1,%r8b
+  802736:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  80273a:	48 39 ca             	cmp    %rcx,%rdx
+  80273d:	75 e7                	jne    802726 <strncpy+0xe>
+    }
+    return ret;
+}
+  80273f:	c3                   	ret
+
+0000000000802740 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  802740:	48 89 f8             	mov    %rdi,%rax
+  802743:	48 85 d2             	test   %rdx,%rdx
+  802746:	74 24                	je     80276c <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  802748:	48 83 ea 01          	sub    $0x1,%rdx
+  80274c:	74 1b                	je     802769 <strlcpy+0x29>
+  80274e:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  802752:	0f b6 16             	movzbl (%rsi),%edx
+  802755:	84 d2                	test   %dl,%dl
+  802757:	74 10                	je     802769 <strlcpy+0x29>
+            *dst++ = *src++;
+  802759:	48 83 c6 01          	add    $0x1,%rsi
+  80275d:	48 83 c0 01          	add    $0x1,%rax
+  802761:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  802764:	48 39 c8             	cmp    %rcx,%rax
+  802767:	75 e9                	jne    802752 <strlcpy+0x12>
+        *dst = '\0';
+  802769:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  80276c:	48 29 f8             	sub    %rdi,%rax
+}
+  80276f:	c3                   	ret
+
+0000000000802770 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  802770:	0f b6 07             	movzbl (%rdi),%eax
+  802773:	84 c0                	test   %al,%al
+  802775:	74 13                	je     80278a <strcmp+0x1a>
+  802777:	38 06                	cmp    %al,(%rsi)
+  802779:	75 0f                	jne    80278a <strcmp+0x1a>
+  80277b:	48 83 c7 01          	add    $0x1,%rdi
+  80277f:	48 83 c6 01          	add    $0x1,%rsi
+  802783:	0f b6 07             	movzbl (%rdi),%eax
+  802786:	84 c0                	test   %al,%al
+  802788:	75 ed                	jne    802777 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  80278a:	0f b6 c0             	movzbl %al,%eax
+  80278d:	0f b6 16             	movzbl (%rsi),%edx
+  802790:	29 d0                	sub    %edx,%eax
+}
+  802792:	c3                   	ret
+
+0000000000802793 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  802793:	48 85 d2             	test   %rdx,%rdx
+  802796:	74 1f                	je     8027b7 <strncmp+0x24>
+  802798:	0f b6 07             	movzbl (%rdi),%eax
+  80279b:	84 c0                	test   %al,%al
+  80279d:	74 1e                	je     8027bd <strncmp+0x2a>
+  80279f:	3a 06                	cmp    (%rsi),%al
+  8027a1:	75 1a                	jne    8027bd <strncmp+0x2a>
+  8027a3:	48 83 c7 01          	add    $0x1,%rdi
+  8027a7:	48 83 c6 01          	add    $0x1,%rsi
+  8027ab:	48 83 ea 01          	sub    $0x1,%rdx
+  8027af:	75 e7                	jne    802798 <strncmp+0x5>
+
+    if (!n) return 0;
+  8027b1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027b6:	c3                   	ret
+  8027b7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027bc:	c3                   	ret
+  8027bd:	48 85 d2             	test   %rdx,%rdx
+  8027c0:	74 09                	je     8027cb <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  8027c2:	0f b6 07             	movzbl (%rdi),%eax
+  8027c5:	0f b6 16             	movzbl (%rsi),%edx
+  8027c8:	29 d0                	sub    %edx,%eax
+  8027ca:	c3                   	ret
+    if (!n) return 0;
+  8027cb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8027d0:	c3                   	ret
+
+00000000008027d1 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  8027d1:	0f b6 17             	movzbl (%rdi),%edx
+  8027d4:	84 d2                	test   %dl,%dl
+  8027d6:	74 18                	je     8027f0 <strchr+0x1f>
+        if (*str == c) {
+  8027d8:	0f be d2             	movsbl %dl,%edx
+  8027db:	39 f2                	cmp    %esi,%edx
+  8027dd:	74 17                	je     8027f6 <strchr+0x25>
+    for (; *str; str++) {
+  8027df:	48 83 c7 01          	add    $0x1,%rdi
+  8027e3:	0f b6 17             	movzbl (%rdi),%edx
+  8027e6:	84 d2                	test   %dl,%dl
+  8027e8:	75 ee                	jne    8027d8 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  8027ea:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027ef:	c3                   	ret
+  8027f0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027f5:	c3                   	ret
+  8027f6:	48 89 f8             	mov    %rdi,%rax
+}
+  8027f9:	c3                   	ret
+
+00000000008027fa <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  8027fa:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  8027fd:	0f b6 17             	movzbl (%rdi),%edx
+  802800:	84 d2                	test   %dl,%dl
+  802802:	74 13                	je     802817 <strfind+0x1d>
+  802804:	0f be d2             	movsbl %dl,%edx
+  802807:	39 f2                	cmp    %esi,%edx
+  802809:	74 0b                	je     802816 <strfind+0x1c>
+  80280b:	48 83 c0 01          	add    $0x1,%rax
+  80280f:	0f b6 10             	movzbl (%rax),%edx
+  802812:	84 d2                	test   %dl,%dl
+  802814:	75 ee                	jne    802804 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  802816:	c3                   	ret
+  802817:	c3                   	ret
+
+0000000000802818 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  802818:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  80281b:	48 89 f8             	mov    %rdi,%rax
+  80281e:	48 f7 d8             	neg    %rax
+  802821:	83 e0 07             	and    $0x7,%eax
+  802824:	49 89 d1             	mov    %rdx,%r9
+  802827:	49 29 c1             	sub    %rax,%r9
+  80282a:	78 36                	js     802862 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  80282c:	40 0f b6 c6          	movzbl %sil,%eax
+  802830:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  802837:	01 01 01 
+  80283a:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  80283e:	40 f6 c7 07          	test   $0x7,%dil
+  802842:	75 38                	jne    80287c <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  802844:	4c 89 c9             	mov    %r9,%rcx
+  802847:	48 c1 f9 03          	sar    $0x3,%rcx
+  80284b:	74 0c                	je     802859 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  80284d:	fc                   	cld
+  80284e:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  802851:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  802855:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  802859:	4d 85 c9             	test   %r9,%r9
+  80285c:	75 45                	jne    8028a3 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  80285e:	4c 89 c0             	mov    %r8,%rax
+  802861:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  802862:	48 85 d2             	test   %rdx,%rdx
+  802865:	74 f7                	je     80285e <memset+0x46>
+  802867:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  80286a:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  80286d:	48 83 c0 01          	add    $0x1,%rax
+  802871:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  802875:	48 39 c2             	cmp    %rax,%rdx
+  802878:	75 f3                	jne    80286d <memset+0x55>
+  80287a:	eb e2                	jmp    80285e <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  80287c:	40 f6 c7 01          	test   $0x1,%dil
+  802880:	74 06                	je     802888 <memset+0x70>
+  802882:	88 07                	mov    %al,(%rdi)
+  802884:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  802888:	40 f6 c7 02          	test   $0x2,%dil
+  80288c:	74 07                	je     802895 <memset+0x7d>
+  80288e:	66 89 07             	mov    %ax,(%rdi)
+  802891:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  802895:	40 f6 c7 04          	test   $0x4,%dil
+  802899:	74 a9                	je     802844 <memset+0x2c>
+  80289b:	89 07                	mov    %eax,(%rdi)
+  80289d:	48 83 c7 04          	add    $0x4,%rdi
+  8028a1:	eb a1                	jmp    802844 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  8028a3:	41 f6 c1 04          	test   $0x4,%r9b
+  8028a7:	74 06                	je     8028af <memset+0x97>
+  8028a9:	89 07                	mov    %eax,(%rdi)
+  8028ab:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  8028af:	41 f6 c1 02          	test   $0x2,%r9b
+  8028b3:	74 07                	je     8028bc <memset+0xa4>
+  8028b5:	66 89 07             	mov    %ax,(%rdi)
+  8028b8:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  8028bc:	41 f6 c1 01          	test   $0x1,%r9b
+  8028c0:	74 9c                	je     80285e <memset+0x46>
+  8028c2:	88 07                	mov    %al,(%rdi)
+  8028c4:	eb 98                	jmp    80285e <memset+0x46>
+
+00000000008028c6 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  8028c6:	48 89 f8             	mov    %rdi,%rax
+  8028c9:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  8028cc:	48 39 fe             	cmp    %rdi,%rsi
+  8028cf:	73 3b                	jae    80290c <memmove+0x46>
+  8028d1:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  8028d5:	48 39 d7             	cmp    %rdx,%rdi
+  8028d8:	73 32                	jae    80290c <memmove+0x46>
+        s += n;
+        d += n;
+  8028da:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  8028de:	48 89 d6             	mov    %rdx,%rsi
+  8028e1:	48 09 fe             	or     %rdi,%rsi
+  8028e4:	48 09 ce             	or     %rcx,%rsi
+  8028e7:	40 f6 c6 07          	test   $0x7,%sil
+  8028eb:	75 12                	jne    8028ff <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  8028ed:	48 83 ef 08          	sub    $0x8,%rdi
+  8028f1:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  8028f5:	48 c1 e9 03          	shr    $0x3,%rcx
+  8028f9:	fd                   	std
+  8028fa:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  8028fd:	fc                   	cld
+  8028fe:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  8028ff:	48 83 ef 01          	sub    $0x1,%rdi
+  802903:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  802907:	fd                   	std
+  802908:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  80290a:	eb f1                	jmp    8028fd <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  80290c:	48 89 f2             	mov    %rsi,%rdx
+  80290f:	48 09 c2             	or     %rax,%rdx
+  802912:	48 09 ca             	or     %rcx,%rdx
+  802915:	f6 c2 07             	test   $0x7,%dl
+  802918:	75 0c                	jne    802926 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  80291a:	48 c1 e9 03          	shr    $0x3,%rcx
+  80291e:	48 89 c7             	mov    %rax,%rdi
+  802921:	fc                   	cld
+  802922:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  802925:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  802926:	48 89 c7             	mov    %rax,%rdi
+  802929:	fc                   	cld
+  80292a:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  80292c:	c3                   	ret
+
+000000000080292d <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  80292d:	55                   	push   %rbp
+  80292e:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  802931:	48 b8 c6 28 80 00 00 	movabs $0x8028c6,%rax
+  802938:	00 00 00 
+  80293b:	ff d0                	call   *%rax
+}
+  80293d:	5d                   	pop    %rbp
+  80293e:	c3                   	ret
+
+000000000080293f <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  80293f:	55                   	push   %rbp
+  802940:	48 89 e5             	mov    %rsp,%rbp
+  802943:	41 57                	push   %r15
+  802945:	41 56                	push   %r14
+  802947:	41 55                	push   %r13
+  802949:	41 54                	push   %r12
+  80294b:	53                   	push   %rbx
+  80294c:	48 83 ec 08          	sub    $0x8,%rsp
+  802950:	49 89 fe             	mov    %rdi,%r14
+  802953:	49 89 f7             	mov    %rsi,%r15
+  802956:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  802959:	48 89 f7             	mov    %rsi,%rdi
+  80295c:	48 b8 8e 26 80 00 00 	movabs $0x80268e,%rax
+  802963:	00 00 00 
+  802966:	ff d0                	call   *%rax
+  802968:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  80296b:	48 89 de             	mov    %rbx,%rsi
+  80296e:	4c 89 f7             	mov    %r14,%rdi
+  802971:	48 b8 a9 26 80 00 00 	movabs $0x8026a9,%rax
+  802978:	00 00 00 
+  80297b:	ff d0                	call   *%rax
+  80297d:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  802980:	48 39 c3             	cmp    %rax,%rbx
+  802983:	74 36                	je     8029bb <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  802985:	48 89 d8             	mov    %rbx,%rax
+  802988:	4c 29 e8             	sub    %r13,%rax
+  80298b:	49 39 c4             	cmp    %rax,%r12
+  80298e:	73 31                	jae    8029c1 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  802990:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  802995:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  802999:	4c 89 fe             	mov    %r15,%rsi
+  80299c:	48 b8 2d 29 80 00 00 	movabs $0x80292d,%rax
+  8029a3:	00 00 00 
+  8029a6:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  8029a8:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  8029ac:	48 83 c4 08          	add    $0x8,%rsp
+  8029b0:	5b                   	pop    %rbx
+  8029b1:	41 5c                	pop    %r12
+  8029b3:	41 5d                	pop    %r13
+  8029b5:	41 5e                	pop    %r14
+  8029b7:	41 5f                	pop    %r15
+  8029b9:	5d                   	pop    %rbp
+  8029ba:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  8029bb:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  8029bf:	eb eb                	jmp    8029ac <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  8029c1:	48 83 eb 01          	sub    $0x1,%rbx
+  8029c5:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8029c9:	48 89 da             	mov    %rbx,%rdx
+  8029cc:	4c 89 fe             	mov    %r15,%rsi
+  8029cf:	48 b8 2d 29 80 00 00 	movabs $0x80292d,%rax
+  8029d6:	00 00 00 
+  8029d9:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  8029db:	49 01 de             	add    %rbx,%r14
+  8029de:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  8029e3:	eb c3                	jmp    8029a8 <strlcat+0x69>
+
+00000000008029e5 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  8029e5:	48 85 d2             	test   %rdx,%rdx
+  8029e8:	74 2d                	je     802a17 <memcmp+0x32>
+  8029ea:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  8029ef:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  8029f3:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  8029f8:	44 38 c1             	cmp    %r8b,%cl
+  8029fb:	75 0f                	jne    802a0c <memcmp+0x27>
+    while (n-- > 0) {
+  8029fd:	48 83 c0 01          	add    $0x1,%rax
+  802a01:	48 39 c2             	cmp    %rax,%rdx
+  802a04:	75 e9                	jne    8029ef <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  802a06:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a0b:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  802a0c:	0f b6 c1             	movzbl %cl,%eax
+  802a0f:	45 0f b6 c0          	movzbl %r8b,%r8d
+  802a13:	44 29 c0             	sub    %r8d,%eax
+  802a16:	c3                   	ret
+    return 0;
+  802a17:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802a1c:	c3                   	ret
+
+0000000000802a1d <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  802a1d:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  802a21:	48 39 c7             	cmp    %rax,%rdi
+  802a24:	73 0f                	jae    802a35 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  802a26:	40 38 37             	cmp    %sil,(%rdi)
+  802a29:	74 0e                	je     802a39 <memfind+0x1c>
+    for (; src < end; src++) {
+  802a2b:	48 83 c7 01          	add    $0x1,%rdi
+  802a2f:	48 39 f8             	cmp    %rdi,%rax
+  802a32:	75 f2                	jne    802a26 <memfind+0x9>
+  802a34:	c3                   	ret
+  802a35:	48 89 f8             	mov    %rdi,%rax
+  802a38:	c3                   	ret
+  802a39:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  802a3c:	c3                   	ret
+
+0000000000802a3d <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  802a3d:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  802a40:	0f b6 37             	movzbl (%rdi),%esi
+  802a43:	40 80 fe 20          	cmp    $0x20,%sil
+  802a47:	74 06                	je     802a4f <strtol+0x12>
+  802a49:	40 80 fe 09          	cmp    $0x9,%sil
+  802a4d:	75 13                	jne    802a62 <strtol+0x25>
+  802a4f:	48 83 c7 01          	add    $0x1,%rdi
+  802a53:	0f b6 37             	movzbl (%rdi),%esi
+  802a56:	40 80 fe 20          	cmp    $0x20,%sil
+  802a5a:	74 f3                	je     802a4f <strtol+0x12>
+  802a5c:	40 80 fe 09          	cmp    $0x9,%sil
+  802a60:	74 ed                	je     802a4f <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  802a62:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  802a65:	83 e0 fd             	and    $0xfffffffd,%eax
+  802a68:	3c 01                	cmp    $0x1,%al
+  802a6a:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  802a6e:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  802a74:	75 0f                	jne    802a85 <strtol+0x48>
+  802a76:	80 3f 30             	cmpb   $0x30,(%rdi)
+  802a79:	74 14                	je     802a8f <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  802a7b:	85 d2                	test   %edx,%edx
+  802a7d:	b8 0a 00 00 00       	mov    $0xa,%eax
+  802a82:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  802a85:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  802a8a:	4c 63 ca             	movslq %edx,%r9
+  802a8d:	eb 36                	jmp    802ac5 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  802a8f:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  802a93:	74 0f                	je     802aa4 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  802a95:	85 d2                	test   %edx,%edx
+  802a97:	75 ec                	jne    802a85 <strtol+0x48>
+        s++;
+  802a99:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  802a9d:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  802aa2:	eb e1                	jmp    802a85 <strtol+0x48>
+        s += 2;
+  802aa4:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  802aa8:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  802aad:	eb d6                	jmp    802a85 <strtol+0x48>
+            dig -= '0';
+  802aaf:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  802ab2:	44 0f b6 c1          	movzbl %cl,%r8d
+  802ab6:	41 39 d0             	cmp    %edx,%r8d
+  802ab9:	7d 21                	jge    802adc <strtol+0x9f>
+        val = val * base + dig;
+  802abb:	49 0f af c1          	imul   %r9,%rax
+  802abf:	0f b6 c9             	movzbl %cl,%ecx
+  802ac2:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  802ac5:	48 83 c7 01          	add    $0x1,%rdi
+  802ac9:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  802acd:	80 f9 39             	cmp    $0x39,%cl
+  802ad0:	76 dd                	jbe    802aaf <strtol+0x72>
+        else if (dig - 'a' < 27)
+  802ad2:	80 f9 7b             	cmp    $0x7b,%cl
+  802ad5:	77 05                	ja     802adc <strtol+0x9f>
+            dig -= 'a' - 10;
+  802ad7:	83 e9 57             	sub    $0x57,%ecx
+  802ada:	eb d6                	jmp    802ab2 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  802adc:	4d 85 d2             	test   %r10,%r10
+  802adf:	74 03                	je     802ae4 <strtol+0xa7>
+  802ae1:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  802ae4:	48 89 c2             	mov    %rax,%rdx
+  802ae7:	48 f7 da             	neg    %rdx
+  802aea:	40 80 fe 2d          	cmp    $0x2d,%sil
+  802aee:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  802af2:	c3                   	ret
+
+0000000000802af3 <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  802af3:	55                   	push   %rbp
+  802af4:	48 89 e5             	mov    %rsp,%rbp
+  802af7:	41 55                	push   %r13
+  802af9:	41 54                	push   %r12
+  802afb:	53                   	push   %rbx
+  802afc:	48 83 ec 08          	sub    $0x8,%rsp
+  802b00:	49 89 fc             	mov    %rdi,%r12
+  802b03:	48 89 f7             	mov    %rsi,%rdi
+  802b06:	48 89 d3             	mov    %rdx,%rbx
+  802b09:	49 89 cd             	mov    %rcx,%r13
+    // LAB 9: Your code here:
+    int res = sys_ipc_recv(!pg ? (void*)MAX_USER_ADDRESS : pg, !size ? 0 : *size);
+  802b0c:	be 00 00 00 00       	mov    $0x0,%esi
+  802b11:	48 85 d2             	test   %rdx,%rdx
+  802b14:	74 03                	je     802b19 <ipc_recv+0x26>
+  802b16:	48 8b 32             	mov    (%rdx),%rsi
+  802b19:	48 85 ff             	test   %rdi,%rdi
+  802b1c:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802b23:	00 00 00 
+  802b26:	48 0f 44 f8          	cmove  %rax,%rdi
+  802b2a:	48 b8 98 06 80 00 00 	movabs $0x800698,%rax
+  802b31:	00 00 00 
+  802b34:	ff d0                	call   *%rax
+    if (res < 0) {
+  802b36:	85 c0                	test   %eax,%eax
+  802b38:	78 66                	js     802ba0 <ipc_recv+0xad>
+        if (size) {
+            *size = 0;
+        }
+        return res;
+    }
+    if (from_env_store) {
+  802b3a:	4d 85 e4             	test   %r12,%r12
+  802b3d:	74 14                	je     802b53 <ipc_recv+0x60>
+        *from_env_store = thisenv->env_ipc_from;
+  802b3f:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802b46:	00 00 00 
+  802b49:	8b 80 ac 01 00 00    	mov    0x1ac(%rax),%eax
+  802b4f:	41 89 04 24          	mov    %eax,(%r12)
+    }
+    if (perm_store) {
+  802b53:	4d 85 ed             	test   %r13,%r13
+  802b56:	74 14                	je     802b6c <ipc_recv+0x79>
+        *perm_store = thisenv->env_ipc_perm;
+  802b58:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802b5f:	00 00 00 
+  802b62:	8b 80 b0 01 00 00    	mov    0x1b0(%rax),%eax
+  802b68:	41 89 45 00          	mov    %eax,0x0(%r13)
+    }
+    if (size) {
+  802b6c:	48 85 db             	test   %rbx,%rbx
+  802b6f:	74 14                	je     802b85 <ipc_recv+0x92>
+        *size = thisenv->env_ipc_maxsz;
+  802b71:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802b78:	00 00 00 
+  802b7b:	48 8b 80 a0 01 00 00 	mov    0x1a0(%rax),%rax
+  802b82:	48 89 03             	mov    %rax,(%rbx)
+    }
+    return thisenv->env_ipc_value;
+  802b85:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802b8c:	00 00 00 
+  802b8f:	8b 80 a8 01 00 00    	mov    0x1a8(%rax),%eax
+}
+  802b95:	48 83 c4 08          	add    $0x8,%rsp
+  802b99:	5b                   	pop    %rbx
+  802b9a:	41 5c                	pop    %r12
+  802b9c:	41 5d                	pop    %r13
+  802b9e:	5d                   	pop    %rbp
+  802b9f:	c3                   	ret
+        if (from_env_store) {
+  802ba0:	4d 85 e4             	test   %r12,%r12
+  802ba3:	74 08                	je     802bad <ipc_recv+0xba>
+            *from_env_store = 0;
+  802ba5:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  802bac:	00 
+        if (perm_store) {
+  802bad:	4d 85 ed             	test   %r13,%r13
+  802bb0:	74 08                	je     802bba <ipc_recv+0xc7>
+            *perm_store = 0;
+  802bb2:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  802bb9:	00 
+        if (size) {
+  802bba:	48 85 db             	test   %rbx,%rbx
+  802bbd:	74 d6                	je     802b95 <ipc_recv+0xa2>
+            *size = 0;
+  802bbf:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  802bc6:	eb cd                	jmp    802b95 <ipc_recv+0xa2>
+
+0000000000802bc8 <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  802bc8:	55                   	push   %rbp
+  802bc9:	48 89 e5             	mov    %rsp,%rbp
+  802bcc:	41 57                	push   %r15
+  802bce:	41 56                	push   %r14
+  802bd0:	41 55                	push   %r13
+  802bd2:	41 54                	push   %r12
+  802bd4:	53                   	push   %rbx
+  802bd5:	48 83 ec 18          	sub    $0x18,%rsp
+  802bd9:	41 89 fd             	mov    %edi,%r13d
+  802bdc:	89 75 cc             	mov    %esi,-0x34(%rbp)
+  802bdf:	49 89 cc             	mov    %rcx,%r12
+  802be2:	44 89 45 c8          	mov    %r8d,-0x38(%rbp)
+    // LAB 9: Your code here:
+    int res = 0;
+    while ((res = sys_ipc_try_send(to_env, val, !pg ? (void*)MAX_USER_ADDRESS : pg, size, perm)) < 0) {
+  802be6:	48 85 d2             	test   %rdx,%rdx
+  802be9:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802bf0:	00 00 00 
+  802bf3:	48 0f 45 c2          	cmovne %rdx,%rax
+  802bf7:	48 89 c3             	mov    %rax,%rbx
+  802bfa:	49 be 6c 06 80 00 00 	movabs $0x80066c,%r14
+  802c01:	00 00 00 
+        if (res != -E_IPC_NOT_RECV) {
+            panic("sys_ipc_try_send failed: %i", res);
+        }
+        sys_yield();
+  802c04:	49 bf 37 02 80 00 00 	movabs $0x800237,%r15
+  802c0b:	00 00 00 
+    while ((res = sys_ipc_try_send(to_env, val, !pg ? (void*)MAX_USER_ADDRESS : pg, size, perm)) < 0) {
+  802c0e:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  802c11:	44 8b 45 c8          	mov    -0x38(%rbp),%r8d
+  802c15:	4c 89 e1             	mov    %r12,%rcx
+  802c18:	48 89 da             	mov    %rbx,%rdx
+  802c1b:	44 89 ef             	mov    %r13d,%edi
+  802c1e:	41 ff d6             	call   *%r14
+  802c21:	85 c0                	test   %eax,%eax
+  802c23:	79 37                	jns    802c5c <ipc_send+0x94>
+        if (res != -E_IPC_NOT_RECV) {
+  802c25:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  802c28:	75 05                	jne    802c2f <ipc_send+0x67>
+        sys_yield();
+  802c2a:	41 ff d7             	call   *%r15
+  802c2d:	eb df                	jmp    802c0e <ipc_send+0x46>
+            panic("sys_ipc_try_send failed: %i", res);
+  802c2f:	89 c1                	mov    %eax,%ecx
+  802c31:	48 ba 6f 33 80 00 00 	movabs $0x80336f,%rdx
+  802c38:	00 00 00 
+  802c3b:	be 40 00 00 00       	mov    $0x40,%esi
+  802c40:	48 bf 8b 33 80 00 00 	movabs $0x80338b,%rdi
+  802c47:	00 00 00 
+  802c4a:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c4f:	49 b8 57 1c 80 00 00 	movabs $0x801c57,%r8
+  802c56:	00 00 00 
+  802c59:	41 ff d0             	call   *%r8
+    }
+    return;
+}
+  802c5c:	48 83 c4 18          	add    $0x18,%rsp
+  802c60:	5b                   	pop    %rbx
+  802c61:	41 5c                	pop    %r12
+  802c63:	41 5d                	pop    %r13
+  802c65:	41 5e                	pop    %r14
+  802c67:	41 5f                	pop    %r15
+  802c69:	5d                   	pop    %rbp
+  802c6a:	c3                   	ret
+
+0000000000802c6b <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  802c6b:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  802c70:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  802c77:	00 00 00 
+  802c7a:	48 69 d0 d0 01 00 00 	imul   $0x1d0,%rax,%rdx
+  802c81:	48 01 ca             	add    %rcx,%rdx
+  802c84:	8b 92 e8 00 00 00    	mov    0xe8(%rdx),%edx
+  802c8a:	39 fa                	cmp    %edi,%edx
+  802c8c:	74 12                	je     802ca0 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  802c8e:	48 83 c0 01          	add    $0x1,%rax
+  802c92:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  802c98:	75 e0                	jne    802c7a <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  802c9a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802c9f:	c3                   	ret
+            return envs[i].env_id;
+  802ca0:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+  802ca7:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  802cae:	00 00 00 
+  802cb1:	48 01 d0             	add    %rdx,%rax
+  802cb4:	8b 80 e0 00 00 00    	mov    0xe0(%rax),%eax
+  802cba:	c3                   	ret
+  802cbb:	0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+
+0000000000802cc0 <__rodata_start>:
+  802cc0:	3c 75                	cmp    $0x75,%al
+  802cc2:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802cc3:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  802cc7:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802cc8:	3e 00 66 0f          	ds add %ah,0xf(%rsi)
+  802ccc:	1f                   	(bad)
+  802ccd:	44 00 00             	add    %r8b,(%rax)
+  802cd0:	73 79                	jae    802d4b <__rodata_start+0x8b>
+  802cd2:	73 63                	jae    802d37 <__rodata_start+0x77>
+  802cd4:	61                   	(bad)
+  802cd5:	6c                   	insb   (%dx),%es:(%rdi)
+  802cd6:	6c                   	insb   (%dx),%es:(%rdi)
+  802cd7:	20 25 7a 64 20 72    	and    %ah,0x7220647a(%rip)        # 72a09157 <__bss_end+0x72201157>
+  802cdd:	65 74 75             	gs je  802d55 <__rodata_start+0x95>
+  802ce0:	72 6e                	jb     802d50 <__rodata_start+0x90>
+  802ce2:	65 64 20 25 7a 64 20 	gs and %ah,%fs:0x2820647a(%rip)        # 28a09164 <__bss_end+0x28201164>
+  802ce9:	28 
+  802cea:	3e 20 30             	ds and %dh,(%rax)
+  802ced:	29 00                	sub    %eax,(%rax)
+  802cef:	6c                   	insb   (%dx),%es:(%rdi)
+  802cf0:	69 62 2f 73 79 73 63 	imul   $0x63737973,0x2f(%rdx),%esp
+  802cf7:	61                   	(bad)
+  802cf8:	6c                   	insb   (%dx),%es:(%rdi)
+  802cf9:	6c                   	insb   (%dx),%es:(%rdi)
+  802cfa:	2e 63 00             	cs movsxd (%rax),%eax
+  802cfd:	0f 1f 00             	nopl   (%rax)
+  802d00:	5b                   	pop    %rbx
+  802d01:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  802d06:	20 75 6e             	and    %dh,0x6e(%rbp)
+  802d09:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  802d0d:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802d0e:	20 64 65 76          	and    %ah,0x76(%rbp,%riz,2)
+  802d12:	69 63 65 20 74 79 70 	imul   $0x70797420,0x65(%rbx),%esp
+  802d19:	65 20 25 64 0a 00 00 	and    %ah,%gs:0xa64(%rip)        # 803784 <error_string+0x4e4>
+  802d20:	5b                   	pop    %rbx
+  802d21:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  802d26:	20 66 74             	and    %ah,0x74(%rsi)
+  802d29:	72 75                	jb     802da0 <devtab+0x20>
+  802d2b:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802d2c:	63 61 74             	movsxd 0x74(%rcx),%esp
+  802d2f:	65 20 25 64 20 2d 2d 	and    %ah,%gs:0x2d2d2064(%rip)        # 2dad4d9a <__bss_end+0x2d2ccd9a>
+  802d36:	20 62 61             	and    %ah,0x61(%rdx)
+  802d39:	64 20 6d 6f          	and    %ch,%fs:0x6f(%rbp)
+  802d3d:	64 65 0a 00          	fs or  %gs:(%rax),%al
+  802d41:	5b                   	pop    %rbx
+  802d42:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  802d47:	20 72 65             	and    %dh,0x65(%rdx)
+  802d4a:	61                   	(bad)
+  802d4b:	64 20 25 64 20 2d 2d 	and    %ah,%fs:0x2d2d2064(%rip)        # 2dad4db6 <__bss_end+0x2d2ccdb6>
+  802d52:	20 62 61             	and    %ah,0x61(%rdx)
+  802d55:	64 20 6d 6f          	and    %ch,%fs:0x6f(%rbp)
+  802d59:	64 65 0a 00          	fs or  %gs:(%rax),%al
+  802d5d:	5b                   	pop    %rbx
+  802d5e:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  802d63:	20 77 72             	and    %dh,0x72(%rdi)
+  802d66:	69 74 65 20 25 64 20 	imul   $0x2d206425,0x20(%rbp,%riz,2),%esi
+  802d6d:	2d 
+  802d6e:	2d 20 62 61 64       	sub    $0x64616220,%eax
+  802d73:	20 6d 6f             	and    %ch,0x6f(%rbp)
+  802d76:	64 65 0a 00          	fs or  %gs:(%rax),%al
+  802d7a:	66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+
+0000000000802d80 <devtab>:
+  802d80:	20 40 80 00 00 00 00 00 60 40 80 00 00 00 00 00      @......`@......
+  802d90:	a0 40 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .@..............
+  802da0:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  802db0:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  802dc0:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  802dd0:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  802de0:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  802df0:	3d 20 32 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73 00     = 2.<cons>.cons.
+  802e00:	5b 25 30 38 78 5d 20 75 73 65 72 20 70 61 6e 69     [%08x] user pani
+  802e10:	63 20 69 6e 20 25 73 20 61 74 20 25 73 3a 25 64     c in %s at %s:%d
+  802e20:	3a 20 00 30 31 32 33 34 35 36 37 38 39 41 42 43     : .0123456789ABC
+  802e30:	44 45 46 00 30 31 32 33 34 35 36 37 38 39 61 62     DEF.0123456789ab
+  802e40:	63 64 65 66 00 28 6e 75 6c 6c 29 00 65 72 72 6f     cdef.(null).erro
+  802e50:	72 20 25 64 00 75 6e 73 70 65 63 69 66 69 65 64     r %d.unspecified
+  802e60:	20 65 72 72 6f 72 00 62 61 64 20 65 6e 76 69 72      error.bad envir
+  802e70:	6f 6e 6d 65 6e 74 00 69 6e 76 61 6c 69 64 20 70     onment.invalid p
+  802e80:	61 72 61 6d 65 74 65 72 00 6f 75 74 20 6f 66 20     arameter.out of 
+  802e90:	6d 65 6d 6f 72 79 00 6f 75 74 20 6f 66 20 65 6e     memory.out of en
+  802ea0:	76 69 72 6f 6e 6d 65 6e 74 73 00 63 6f 72 72 75     vironments.corru
+  802eb0:	70 74 65 64 20 64 65 62 75 67 20 69 6e 66 6f 00     pted debug info.
+  802ec0:	73 65 67 6d 65 6e 74 61 74 69 6f 6e 20 66 61 75     segmentation fau
+  802ed0:	6c 74 00 69 6e 76 61 6c 69 64 20 45 4c 46 20 69     lt.invalid ELF i
+  802ee0:	6d 61 67 65 00 6e 6f 20 73 75 63 68 20 73 79 73     mage.no such sys
+  802ef0:	74 65 6d 20 63 61 6c 6c 00 65 6e 74 72 79 20 6e     tem call.entry n
+  802f00:	6f 74 20 66 6f 75 6e 64 00 65 6e 76 20 69 73 20     ot found.env is 
+  802f10:	6e 6f 74 20 72 65 63 76 69 6e 67 00 75 6e 65 78     not recving.unex
+  802f20:	70 65 63 74 65 64 20 65 6e 64 20 6f 66 20 66 69     pected end of fi
+  802f30:	6c 65 00 6e 6f 20 66 72 65 65 20 73 70 61 63 65     le.no free space
+  802f40:	20 6f 6e 20 64 69 73 6b 00 74 6f 6f 20 6d 61 6e      on disk.too man
+  802f50:	79 20 66 69 6c 65 73 20 61 72 65 20 6f 70 65 6e     y files are open
+  802f60:	00 66 69 6c 65 20 6f 72 20 62 6c 6f 63 6b 20 6e     .file or block n
+  802f70:	6f 74 20 66 6f 75 6e 64 00 69 6e 76 61 6c 69 64     ot found.invalid
+  802f80:	20 70 61 74 68 00 66 69 6c 65 20 61 6c 72 65 61      path.file alrea
+  802f90:	64 79 20 65 78 69 73 74 73 00 6f 70 65 72 61 74     dy exists.operat
+  802fa0:	69 6f 6e 20 6e 6f 74 20 73 75 70 70 6f 72 74 65     ion not supporte
+  802fb0:	64 00 6f 70 65 72 61 74 69 6f 6e 20 69 6e 74 65     d.operation inte
+  802fc0:	72 72 75 70 74 65 64 00 6e 6f 74 20 65 6e 6f 75     rrupted.not enou
+  802fd0:	67 68 20 43 50 55 20 74 69 6d 65 00 0f 1f 40 00     gh CPU time...@.
+  802fe0:	94 1f 80 00 00 00 00 00 d5 25 80 00 00 00 00 00     .........%......
+  802ff0:	c5 25 80 00 00 00 00 00 d5 25 80 00 00 00 00 00     .%.......%......
+  803000:	d5 25 80 00 00 00 00 00 d5 25 80 00 00 00 00 00     .%.......%......
+  803010:	d5 25 80 00 00 00 00 00 b3 1f 80 00 00 00 00 00     .%..............
+  803020:	d5 25 80 00 00 00 00 00 d5 25 80 00 00 00 00 00     .%.......%......
+  803030:	a7 1f 80 00 00 00 00 00 21 20 80 00 00 00 00 00     ........! ......
+  803040:	d5 25 80 00 00 00 00 00 a7 1f 80 00 00 00 00 00     .%..............
+  803050:	ed 1f 80 00 00 00 00 00 ed 1f 80 00 00 00 00 00     ................
+  803060:	ed 1f 80 00 00 00 00 00 ed 1f 80 00 00 00 00 00     ................
+  803070:	ed 1f 80 00 00 00 00 00 ed 1f 80 00 00 00 00 00     ................
+  803080:	ed 1f 80 00 00 00 00 00 ed 1f 80 00 00 00 00 00     ................
+  803090:	ed 1f 80 00 00 00 00 00 d5 25 80 00 00 00 00 00     .........%......
+  8030a0:	d5 25 80 00 00 00 00 00 d5 25 80 00 00 00 00 00     .%.......%......
+  8030b0:	d5 25 80 00 00 00 00 00 d5 25 80 00 00 00 00 00     .%.......%......
+  8030c0:	d5 25 80 00 00 00 00 00 d5 25 80 00 00 00 00 00     .%.......%......
+  8030d0:	d5 25 80 00 00 00 00 00 d5 25 80 00 00 00 00 00     .%.......%......
+  8030e0:	d5 25 80 00 00 00 00 00 d5 25 80 00 00 00 00 00     .%.......%......
+  8030f0:	d5 25 80 00 00 00 00 00 d5 25 80 00 00 00 00 00     .%.......%......
+  803100:	d5 25 80 00 00 00 00 00 d5 25 80 00 00 00 00 00     .%.......%......
+  803110:	d5 25 80 00 00 00 00 00 d5 25 80 00 00 00 00 00     .%.......%......
+  803120:	d5 25 80 00 00 00 00 00 d5 25 80 00 00 00 00 00     .%.......%......
+  803130:	d5 25 80 00 00 00 00 00 d5 25 80 00 00 00 00 00     .%.......%......
+  803140:	d5 25 80 00 00 00 00 00 d5 25 80 00 00 00 00 00     .%.......%......
+  803150:	d5 25 80 00 00 00 00 00 d5 25 80 00 00 00 00 00     .%.......%......
+  803160:	d5 25 80 00 00 00 00 00 d5 25 80 00 00 00 00 00     .%.......%......
+  803170:	d5 25 80 00 00 00 00 00 d5 25 80 00 00 00 00 00     .%.......%......
+  803180:	d5 25 80 00 00 00 00 00 f8 24 80 00 00 00 00 00     .%.......$......
+  803190:	d5 25 80 00 00 00 00 00 d5 25 80 00 00 00 00 00     .%.......%......
+  8031a0:	d5 25 80 00 00 00 00 00 d5 25 80 00 00 00 00 00     .%.......%......
+  8031b0:	d5 25 80 00 00 00 00 00 d5 25 80 00 00 00 00 00     .%.......%......
+  8031c0:	d5 25 80 00 00 00 00 00 d5 25 80 00 00 00 00 00     .%.......%......
+  8031d0:	d5 25 80 00 00 00 00 00 d5 25 80 00 00 00 00 00     .%.......%......
+  8031e0:	44 20 80 00 00 00 00 00 13 22 80 00 00 00 00 00     D ......."......
+  8031f0:	d5 25 80 00 00 00 00 00 d5 25 80 00 00 00 00 00     .%.......%......
+  803200:	d5 25 80 00 00 00 00 00 d5 25 80 00 00 00 00 00     .%.......%......
+  803210:	73 20 80 00 00 00 00 00 d5 25 80 00 00 00 00 00     s .......%......
+  803220:	d5 25 80 00 00 00 00 00 39 20 80 00 00 00 00 00     .%......9 ......
+  803230:	d5 25 80 00 00 00 00 00 d5 25 80 00 00 00 00 00     .%.......%......
+  803240:	bb 23 80 00 00 00 00 00 85 24 80 00 00 00 00 00     .#.......$......
+  803250:	d5 25 80 00 00 00 00 00 d5 25 80 00 00 00 00 00     .%.......%......
+  803260:	0a 21 80 00 00 00 00 00 d5 25 80 00 00 00 00 00     .!.......%......
+  803270:	e7 22 80 00 00 00 00 00 d5 25 80 00 00 00 00 00     .".......%......
+  803280:	d5 25 80 00 00 00 00 00 f8 24 80 00 00 00 00 00     .%.......$......
+  803290:	d5 25 80 00 00 00 00 00 9d 1f 80 00 00 00 00 00     .%..............
+
+00000000008032a0 <error_string>:
+	...
+  8032a8:	55 2e 80 00 00 00 00 00 67 2e 80 00 00 00 00 00     U.......g.......
+  8032b8:	77 2e 80 00 00 00 00 00 89 2e 80 00 00 00 00 00     w...............
+  8032c8:	97 2e 80 00 00 00 00 00 ab 2e 80 00 00 00 00 00     ................
+  8032d8:	c0 2e 80 00 00 00 00 00 d3 2e 80 00 00 00 00 00     ................
+  8032e8:	e5 2e 80 00 00 00 00 00 f9 2e 80 00 00 00 00 00     ................
+  8032f8:	09 2f 80 00 00 00 00 00 1c 2f 80 00 00 00 00 00     ./......./......
+  803308:	33 2f 80 00 00 00 00 00 49 2f 80 00 00 00 00 00     3/......I/......
+  803318:	61 2f 80 00 00 00 00 00 79 2f 80 00 00 00 00 00     a/......y/......
+  803328:	86 2f 80 00 00 00 00 00 50 33 80 00 00 00 00 00     ./......P3......
+  803338:	9a 2f 80 00 00 00 00 00 b2 2f 80 00 00 00 00 00     ./......./......
+  803348:	c8 2f 80 00 00 00 00 00 66 69 6c 65 20 69 73 20     ./......file is 
+  803358:	6e 6f 74 20 61 20 76 61 6c 69 64 20 65 78 65 63     not a valid exec
+  803368:	75 74 61 62 6c 65 00 73 79 73 5f 69 70 63 5f 74     utable.sys_ipc_t
+  803378:	72 79 5f 73 65 6e 64 20 66 61 69 6c 65 64 3a 20     ry_send failed: 
+  803388:	25 69 00 6c 69 62 2f 69 70 63 2e 63 00 66 2e 0f     %i.lib/ipc.c.f..
+  803398:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8033a8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8033b8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8033c8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8033d8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8033e8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8033f8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803408:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803418:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803428:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803438:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803448:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803458:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803468:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803478:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803488:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803498:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8034a8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8034b8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8034c8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8034d8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8034e8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8034f8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803508:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803518:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803528:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803538:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803548:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803558:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803568:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803578:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803588:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803598:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8035a8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8035b8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8035c8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8035d8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8035e8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8035f8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803608:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803618:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803628:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803638:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803648:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803658:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803668:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803678:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803688:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803698:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8036a8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8036b8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8036c8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8036d8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8036e8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8036f8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803708:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803718:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803728:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803738:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803748:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803758:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803768:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803778:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803788:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803798:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8037a8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8037b8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8037c8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8037d8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8037e8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8037f8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803808:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803818:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803828:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803838:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803848:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803858:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803868:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803878:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803888:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803898:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8038a8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8038b8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8038c8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8038d8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8038e8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8038f8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803908:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803918:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803928:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803938:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803948:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803958:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803968:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803978:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803988:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803998:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8039a8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8039b8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8039c8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8039d8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8039e8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8039f8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803a08:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803a18:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803a28:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803a38:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803a48:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803a58:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803a68:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803a78:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803a88:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803a98:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803aa8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803ab8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803ac8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803ad8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803ae8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803af8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803b08:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803b18:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803b28:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803b38:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803b48:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803b58:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803b68:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803b78:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803b88:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803b98:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803ba8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803bb8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803bc8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803bd8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803be8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803bf8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803c08:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803c18:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803c28:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803c38:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803c48:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803c58:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803c68:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803c78:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803c88:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803c98:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803ca8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803cb8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803cc8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803cd8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803ce8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803cf8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803d08:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803d18:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803d28:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803d38:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803d48:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803d58:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803d68:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803d78:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803d88:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803d98:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803da8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803db8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803dc8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803dd8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803de8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803df8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803e08:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803e18:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803e28:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803e38:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803e48:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803e58:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803e68:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803e78:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803e88:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803e98:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803ea8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803eb8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803ec8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803ed8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803ee8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803ef8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803f08:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803f18:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803f28:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803f38:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803f48:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803f58:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803f68:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803f78:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803f88:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803f98:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803fa8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803fb8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803fc8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803fd8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803fe8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803ff8:	0f 1f 84 00 00 00 00 00                             ........
@@ -0,0 +1,5741 @@
+
+obj/user/faultnostack:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 2e 00 00 00       	call   800051 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+#include <inc/lib.h>
+
+void _pgfault_upcall();
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+#ifndef __clang_analyzer__
+    sys_env_set_pgfault_upcall(0, (void *)_pgfault_upcall);
+  800029:	48 be e1 06 80 00 00 	movabs $0x8006e1,%rsi
+  800030:	00 00 00 
+  800033:	bf 00 00 00 00       	mov    $0x0,%edi
+  800038:	48 b8 e3 05 80 00 00 	movabs $0x8005e3,%rax
+  80003f:	00 00 00 
+  800042:	ff d0                	call   *%rax
+    *(volatile int *)0 = 0;
+  800044:	c7 04 25 00 00 00 00 	movl   $0x0,0x0
+  80004b:	00 00 00 00 
+#endif
+}
+  80004f:	5d                   	pop    %rbp
+  800050:	c3                   	ret
+
+0000000000800051 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800051:	55                   	push   %rbp
+  800052:	48 89 e5             	mov    %rsp,%rbp
+  800055:	41 56                	push   %r14
+  800057:	41 55                	push   %r13
+  800059:	41 54                	push   %r12
+  80005b:	53                   	push   %rbx
+  80005c:	41 89 fd             	mov    %edi,%r13d
+  80005f:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800062:	48 ba d8 40 80 00 00 	movabs $0x8040d8,%rdx
+  800069:	00 00 00 
+  80006c:	48 b8 d8 40 80 00 00 	movabs $0x8040d8,%rax
+  800073:	00 00 00 
+  800076:	48 39 c2             	cmp    %rax,%rdx
+  800079:	73 17                	jae    800092 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  80007b:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  80007e:	49 89 c4             	mov    %rax,%r12
+  800081:	48 83 c3 08          	add    $0x8,%rbx
+  800085:	b8 00 00 00 00       	mov    $0x0,%eax
+  80008a:	ff 53 f8             	call   *-0x8(%rbx)
+  80008d:	4c 39 e3             	cmp    %r12,%rbx
+  800090:	72 ef                	jb     800081 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+    envid_t this_env_id = sys_getenvid();
+  800092:	48 b8 e6 01 80 00 00 	movabs $0x8001e6,%rax
+  800099:	00 00 00 
+  80009c:	ff d0                	call   *%rax
+    thisenv = &((struct Env*)UENVS)[ENVX(this_env_id)];
+  80009e:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8000a3:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+  8000aa:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8000b1:	00 00 00 
+  8000b4:	48 01 d0             	add    %rdx,%rax
+  8000b7:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  8000be:	00 00 00 
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8000c1:	45 85 ed             	test   %r13d,%r13d
+  8000c4:	7e 0d                	jle    8000d3 <libmain+0x82>
+  8000c6:	49 8b 06             	mov    (%r14),%rax
+  8000c9:	48 a3 00 40 80 00 00 	movabs %rax,0x804000
+  8000d0:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8000d3:	4c 89 f6             	mov    %r14,%rsi
+  8000d6:	44 89 ef             	mov    %r13d,%edi
+  8000d9:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8000e0:	00 00 00 
+  8000e3:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8000e5:	48 b8 fa 00 80 00 00 	movabs $0x8000fa,%rax
+  8000ec:	00 00 00 
+  8000ef:	ff d0                	call   *%rax
+#endif
+}
+  8000f1:	5b                   	pop    %rbx
+  8000f2:	41 5c                	pop    %r12
+  8000f4:	41 5d                	pop    %r13
+  8000f6:	41 5e                	pop    %r14
+  8000f8:	5d                   	pop    %rbp
+  8000f9:	c3                   	ret
+
+00000000008000fa <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8000fa:	55                   	push   %rbp
+  8000fb:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  8000fe:	48 b8 8e 09 80 00 00 	movabs $0x80098e,%rax
+  800105:	00 00 00 
+  800108:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  80010a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80010f:	48 b8 7b 01 80 00 00 	movabs $0x80017b,%rax
+  800116:	00 00 00 
+  800119:	ff d0                	call   *%rax
+}
+  80011b:	5d                   	pop    %rbp
+  80011c:	c3                   	ret
+
+000000000080011d <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  80011d:	55                   	push   %rbp
+  80011e:	48 89 e5             	mov    %rsp,%rbp
+  800121:	53                   	push   %rbx
+  800122:	48 89 fa             	mov    %rdi,%rdx
+  800125:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  800128:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80012d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800132:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800137:	be 00 00 00 00       	mov    $0x0,%esi
+  80013c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800142:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  800144:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800148:	c9                   	leave
+  800149:	c3                   	ret
+
+000000000080014a <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  80014a:	55                   	push   %rbp
+  80014b:	48 89 e5             	mov    %rsp,%rbp
+  80014e:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80014f:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800154:	ba 00 00 00 00       	mov    $0x0,%edx
+  800159:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80015e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800163:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800168:	be 00 00 00 00       	mov    $0x0,%esi
+  80016d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800173:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  800175:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800179:	c9                   	leave
+  80017a:	c3                   	ret
+
+000000000080017b <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  80017b:	55                   	push   %rbp
+  80017c:	48 89 e5             	mov    %rsp,%rbp
+  80017f:	53                   	push   %rbx
+  800180:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  800184:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800187:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80018c:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800191:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800196:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80019b:	be 00 00 00 00       	mov    $0x0,%esi
+  8001a0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8001a6:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8001a8:	48 85 c0             	test   %rax,%rax
+  8001ab:	7f 06                	jg     8001b3 <sys_env_destroy+0x38>
+}
+  8001ad:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8001b1:	c9                   	leave
+  8001b2:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8001b3:	49 89 c0             	mov    %rax,%r8
+  8001b6:	b9 03 00 00 00       	mov    $0x3,%ecx
+  8001bb:	48 ba 90 2f 80 00 00 	movabs $0x802f90,%rdx
+  8001c2:	00 00 00 
+  8001c5:	be 26 00 00 00       	mov    $0x26,%esi
+  8001ca:	48 bf af 2f 80 00 00 	movabs $0x802faf,%rdi
+  8001d1:	00 00 00 
+  8001d4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001d9:	49 b9 8b 1c 80 00 00 	movabs $0x801c8b,%r9
+  8001e0:	00 00 00 
+  8001e3:	41 ff d1             	call   *%r9
+
+00000000008001e6 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  8001e6:	55                   	push   %rbp
+  8001e7:	48 89 e5             	mov    %rsp,%rbp
+  8001ea:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8001eb:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8001f0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8001f5:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8001fa:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8001ff:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800204:	be 00 00 00 00       	mov    $0x0,%esi
+  800209:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80020f:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  800211:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800215:	c9                   	leave
+  800216:	c3                   	ret
+
+0000000000800217 <sys_yield>:
+
+void
+sys_yield(void) {
+  800217:	55                   	push   %rbp
+  800218:	48 89 e5             	mov    %rsp,%rbp
+  80021b:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80021c:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800221:	ba 00 00 00 00       	mov    $0x0,%edx
+  800226:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80022b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800230:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800235:	be 00 00 00 00       	mov    $0x0,%esi
+  80023a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800240:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  800242:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800246:	c9                   	leave
+  800247:	c3                   	ret
+
+0000000000800248 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  800248:	55                   	push   %rbp
+  800249:	48 89 e5             	mov    %rsp,%rbp
+  80024c:	53                   	push   %rbx
+  80024d:	48 89 fa             	mov    %rdi,%rdx
+  800250:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  800253:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800258:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  80025f:	00 00 00 
+  800262:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800267:	be 00 00 00 00       	mov    $0x0,%esi
+  80026c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800272:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  800274:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800278:	c9                   	leave
+  800279:	c3                   	ret
+
+000000000080027a <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  80027a:	55                   	push   %rbp
+  80027b:	48 89 e5             	mov    %rsp,%rbp
+  80027e:	53                   	push   %rbx
+  80027f:	49 89 f8             	mov    %rdi,%r8
+  800282:	48 89 d3             	mov    %rdx,%rbx
+  800285:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  800288:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80028d:	4c 89 c2             	mov    %r8,%rdx
+  800290:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800293:	be 00 00 00 00       	mov    $0x0,%esi
+  800298:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80029e:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  8002a0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8002a4:	c9                   	leave
+  8002a5:	c3                   	ret
+
+00000000008002a6 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  8002a6:	55                   	push   %rbp
+  8002a7:	48 89 e5             	mov    %rsp,%rbp
+  8002aa:	53                   	push   %rbx
+  8002ab:	48 83 ec 08          	sub    $0x8,%rsp
+  8002af:	89 f8                	mov    %edi,%eax
+  8002b1:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  8002b4:	48 63 f9             	movslq %ecx,%rdi
+  8002b7:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8002ba:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8002bf:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8002c2:	be 00 00 00 00       	mov    $0x0,%esi
+  8002c7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8002cd:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8002cf:	48 85 c0             	test   %rax,%rax
+  8002d2:	7f 06                	jg     8002da <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  8002d4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8002d8:	c9                   	leave
+  8002d9:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8002da:	49 89 c0             	mov    %rax,%r8
+  8002dd:	b9 04 00 00 00       	mov    $0x4,%ecx
+  8002e2:	48 ba 90 2f 80 00 00 	movabs $0x802f90,%rdx
+  8002e9:	00 00 00 
+  8002ec:	be 26 00 00 00       	mov    $0x26,%esi
+  8002f1:	48 bf af 2f 80 00 00 	movabs $0x802faf,%rdi
+  8002f8:	00 00 00 
+  8002fb:	b8 00 00 00 00       	mov    $0x0,%eax
+  800300:	49 b9 8b 1c 80 00 00 	movabs $0x801c8b,%r9
+  800307:	00 00 00 
+  80030a:	41 ff d1             	call   *%r9
+
+000000000080030d <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  80030d:	55                   	push   %rbp
+  80030e:	48 89 e5             	mov    %rsp,%rbp
+  800311:	53                   	push   %rbx
+  800312:	48 83 ec 08          	sub    $0x8,%rsp
+  800316:	89 f8                	mov    %edi,%eax
+  800318:	49 89 f2             	mov    %rsi,%r10
+  80031b:	48 89 cf             	mov    %rcx,%rdi
+  80031e:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  800321:	48 63 da             	movslq %edx,%rbx
+  800324:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800327:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80032c:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80032f:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  800332:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800334:	48 85 c0             	test   %rax,%rax
+  800337:	7f 06                	jg     80033f <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  800339:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80033d:	c9                   	leave
+  80033e:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80033f:	49 89 c0             	mov    %rax,%r8
+  800342:	b9 05 00 00 00       	mov    $0x5,%ecx
+  800347:	48 ba 90 2f 80 00 00 	movabs $0x802f90,%rdx
+  80034e:	00 00 00 
+  800351:	be 26 00 00 00       	mov    $0x26,%esi
+  800356:	48 bf af 2f 80 00 00 	movabs $0x802faf,%rdi
+  80035d:	00 00 00 
+  800360:	b8 00 00 00 00       	mov    $0x0,%eax
+  800365:	49 b9 8b 1c 80 00 00 	movabs $0x801c8b,%r9
+  80036c:	00 00 00 
+  80036f:	41 ff d1             	call   *%r9
+
+0000000000800372 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  800372:	55                   	push   %rbp
+  800373:	48 89 e5             	mov    %rsp,%rbp
+  800376:	53                   	push   %rbx
+  800377:	48 83 ec 08          	sub    $0x8,%rsp
+  80037b:	48 89 f1             	mov    %rsi,%rcx
+  80037e:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  800381:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800384:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800389:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80038e:	be 00 00 00 00       	mov    $0x0,%esi
+  800393:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800399:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80039b:	48 85 c0             	test   %rax,%rax
+  80039e:	7f 06                	jg     8003a6 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  8003a0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8003a4:	c9                   	leave
+  8003a5:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8003a6:	49 89 c0             	mov    %rax,%r8
+  8003a9:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8003ae:	48 ba 90 2f 80 00 00 	movabs $0x802f90,%rdx
+  8003b5:	00 00 00 
+  8003b8:	be 26 00 00 00       	mov    $0x26,%esi
+  8003bd:	48 bf af 2f 80 00 00 	movabs $0x802faf,%rdi
+  8003c4:	00 00 00 
+  8003c7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003cc:	49 b9 8b 1c 80 00 00 	movabs $0x801c8b,%r9
+  8003d3:	00 00 00 
+  8003d6:	41 ff d1             	call   *%r9
+
+00000000008003d9 <sys_region_batch>:
+
+int
+sys_region_batch(const struct RegionOp *ops, size_t count) {
+  8003d9:	55                   	push   %rbp
+  8003da:	48 89 e5             	mov    %rsp,%rbp
+  8003dd:	53                   	push   %rbx
+  8003de:	48 83 ec 08          	sub    $0x8,%rsp
+  8003e2:	48 89 fa             	mov    %rdi,%rdx
+  8003e5:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8003e8:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8003ed:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8003f2:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8003f7:	be 00 00 00 00       	mov    $0x0,%esi
+  8003fc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800402:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800404:	48 85 c0             	test   %rax,%rax
+  800407:	7f 06                	jg     80040f <sys_region_batch+0x36>
+        else
+            platform_asan_unpoison(va, ops[i].size);
+    }
+#endif
+    return res;
+}
+  800409:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80040d:	c9                   	leave
+  80040e:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80040f:	49 89 c0             	mov    %rax,%r8
+  800412:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  800417:	48 ba 90 2f 80 00 00 	movabs $0x802f90,%rdx
+  80041e:	00 00 00 
+  800421:	be 26 00 00 00       	mov    $0x26,%esi
+  800426:	48 bf af 2f 80 00 00 	movabs $0x802faf,%rdi
+  80042d:	00 00 00 
+  800430:	b8 00 00 00 00       	mov    $0x0,%eax
+  800435:	49 b9 8b 1c 80 00 00 	movabs $0x801c8b,%r9
+  80043c:	00 00 00 
+  80043f:	41 ff d1             	call   *%r9
+
+0000000000800442 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  800442:	55                   	push   %rbp
+  800443:	48 89 e5             	mov    %rsp,%rbp
+  800446:	53                   	push   %rbx
+  800447:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  80044b:	48 63 ce             	movslq %esi,%rcx
+  80044e:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800451:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800456:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80045b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800460:	be 00 00 00 00       	mov    $0x0,%esi
+  800465:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80046b:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80046d:	48 85 c0             	test   %rax,%rax
+  800470:	7f 06                	jg     800478 <sys_env_set_status+0x36>
+}
+  800472:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800476:	c9                   	leave
+  800477:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800478:	49 89 c0             	mov    %rax,%r8
+  80047b:	b9 09 00 00 00       	mov    $0x9,%ecx
+  800480:	48 ba 90 2f 80 00 00 	movabs $0x802f90,%rdx
+  800487:	00 00 00 
+  80048a:	be 26 00 00 00       	mov    $0x26,%esi
+  80048f:	48 bf af 2f 80 00 00 	movabs $0x802faf,%rdi
+  800496:	00 00 00 
+  800499:	b8 00 00 00 00       	mov    $0x0,%eax
+  80049e:	49 b9 8b 1c 80 00 00 	movabs $0x801c8b,%r9
+  8004a5:	00 00 00 
+  8004a8:	41 ff d1             	call   *%r9
+
+00000000008004ab <sys_env_set_weight>:
+
+int
+sys_env_set_weight(envid_t envid, uint32_t weight) {
+  8004ab:	55                   	push   %rbp
+  8004ac:	48 89 e5             	mov    %rsp,%rbp
+  8004af:	53                   	push   %rbx
+  8004b0:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_weight, 1, envid, weight, 0, 0, 0, 0);
+  8004b4:	89 f1                	mov    %esi,%ecx
+  8004b6:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8004b9:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8004be:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8004c3:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8004c8:	be 00 00 00 00       	mov    $0x0,%esi
+  8004cd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8004d3:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8004d5:	48 85 c0             	test   %rax,%rax
+  8004d8:	7f 06                	jg     8004e0 <sys_env_set_weight+0x35>
+}
+  8004da:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8004de:	c9                   	leave
+  8004df:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8004e0:	49 89 c0             	mov    %rax,%r8
+  8004e3:	b9 10 00 00 00       	mov    $0x10,%ecx
+  8004e8:	48 ba 90 2f 80 00 00 	movabs $0x802f90,%rdx
+  8004ef:	00 00 00 
+  8004f2:	be 26 00 00 00       	mov    $0x26,%esi
+  8004f7:	48 bf af 2f 80 00 00 	movabs $0x802faf,%rdi
+  8004fe:	00 00 00 
+  800501:	b8 00 00 00 00       	mov    $0x0,%eax
+  800506:	49 b9 8b 1c 80 00 00 	movabs $0x801c8b,%r9
+  80050d:	00 00 00 
+  800510:	41 ff d1             	call   *%r9
+
+0000000000800513 <sys_env_set_rt>:
+
+int
+sys_env_set_rt(envid_t envid, uint64_t period, uint64_t budget, uint64_t deadline) {
+  800513:	55                   	push   %rbp
+  800514:	48 89 e5             	mov    %rsp,%rbp
+  800517:	53                   	push   %rbx
+  800518:	48 83 ec 08          	sub    $0x8,%rsp
+  80051c:	89 f8                	mov    %edi,%eax
+  80051e:	48 89 d3             	mov    %rdx,%rbx
+  800521:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_env_set_rt, 1, envid, period, budget, deadline, 0, 0);
+  800524:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800527:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80052c:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80052f:	be 00 00 00 00       	mov    $0x0,%esi
+  800534:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80053a:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80053c:	48 85 c0             	test   %rax,%rax
+  80053f:	7f 06                	jg     800547 <sys_env_set_rt+0x34>
+}
+  800541:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800545:	c9                   	leave
+  800546:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800547:	49 89 c0             	mov    %rax,%r8
+  80054a:	b9 11 00 00 00       	mov    $0x11,%ecx
+  80054f:	48 ba 90 2f 80 00 00 	movabs $0x802f90,%rdx
+  800556:	00 00 00 
+  800559:	be 26 00 00 00       	mov    $0x26,%esi
+  80055e:	48 bf af 2f 80 00 00 	movabs $0x802faf,%rdi
+  800565:	00 00 00 
+  800568:	b8 00 00 00 00       	mov    $0x0,%eax
+  80056d:	49 b9 8b 1c 80 00 00 	movabs $0x801c8b,%r9
+  800574:	00 00 00 
+  800577:	41 ff d1             	call   *%r9
+
+000000000080057a <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  80057a:	55                   	push   %rbp
+  80057b:	48 89 e5             	mov    %rsp,%rbp
+  80057e:	53                   	push   %rbx
+  80057f:	48 83 ec 08          	sub    $0x8,%rsp
+  800583:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  800586:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800589:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80058e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800593:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800598:	be 00 00 00 00       	mov    $0x0,%esi
+  80059d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8005a3:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8005a5:	48 85 c0             	test   %rax,%rax
+  8005a8:	7f 06                	jg     8005b0 <sys_env_set_trapframe+0x36>
+}
+  8005aa:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8005ae:	c9                   	leave
+  8005af:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8005b0:	49 89 c0             	mov    %rax,%r8
+  8005b3:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  8005b8:	48 ba 90 2f 80 00 00 	movabs $0x802f90,%rdx
+  8005bf:	00 00 00 
+  8005c2:	be 26 00 00 00       	mov    $0x26,%esi
+  8005c7:	48 bf af 2f 80 00 00 	movabs $0x802faf,%rdi
+  8005ce:	00 00 00 
+  8005d1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005d6:	49 b9 8b 1c 80 00 00 	movabs $0x801c8b,%r9
+  8005dd:	00 00 00 
+  8005e0:	41 ff d1             	call   *%r9
+
+00000000008005e3 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  8005e3:	55                   	push   %rbp
+  8005e4:	48 89 e5             	mov    %rsp,%rbp
+  8005e7:	53                   	push   %rbx
+  8005e8:	48 83 ec 08          	sub    $0x8,%rsp
+  8005ec:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  8005ef:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8005f2:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8005f7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8005fc:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800601:	be 00 00 00 00       	mov    $0x0,%esi
+  800606:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80060c:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80060e:	48 85 c0             	test   %rax,%rax
+  800611:	7f 06                	jg     800619 <sys_env_set_pgfault_upcall+0x36>
+}
+  800613:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800617:	c9                   	leave
+  800618:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800619:	49 89 c0             	mov    %rax,%r8
+  80061c:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  800621:	48 ba 90 2f 80 00 00 	movabs $0x802f90,%rdx
+  800628:	00 00 00 
+  80062b:	be 26 00 00 00       	mov    $0x26,%esi
+  800630:	48 bf af 2f 80 00 00 	movabs $0x802faf,%rdi
+  800637:	00 00 00 
+  80063a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80063f:	49 b9 8b 1c 80 00 00 	movabs $0x801c8b,%r9
+  800646:	00 00 00 
+  800649:	41 ff d1             	call   *%r9
+
+000000000080064c <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  80064c:	55                   	push   %rbp
+  80064d:	48 89 e5             	mov    %rsp,%rbp
+  800650:	53                   	push   %rbx
+  800651:	89 f8                	mov    %edi,%eax
+  800653:	49 89 f1             	mov    %rsi,%r9
+  800656:	48 89 d3             	mov    %rdx,%rbx
+  800659:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  80065c:	49 63 f0             	movslq %r8d,%rsi
+  80065f:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800662:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800667:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80066a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800670:	cd 30                	int    $0x30
+}
+  800672:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800676:	c9                   	leave
+  800677:	c3                   	ret
+
+0000000000800678 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  800678:	55                   	push   %rbp
+  800679:	48 89 e5             	mov    %rsp,%rbp
+  80067c:	53                   	push   %rbx
+  80067d:	48 83 ec 08          	sub    $0x8,%rsp
+  800681:	48 89 fa             	mov    %rdi,%rdx
+  800684:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  800687:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80068c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800691:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800696:	be 00 00 00 00       	mov    $0x0,%esi
+  80069b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8006a1:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8006a3:	48 85 c0             	test   %rax,%rax
+  8006a6:	7f 06                	jg     8006ae <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8006a8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8006ac:	c9                   	leave
+  8006ad:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8006ae:	49 89 c0             	mov    %rax,%r8
+  8006b1:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  8006b6:	48 ba 90 2f 80 00 00 	movabs $0x802f90,%rdx
+  8006bd:	00 00 00 
+  8006c0:	be 26 00 00 00       	mov    $0x26,%esi
+  8006c5:	48 bf af 2f 80 00 00 	movabs $0x802faf,%rdi
+  8006cc:	00 00 00 
+  8006cf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006d4:	49 b9 8b 1c 80 00 00 	movabs $0x801c8b,%r9
+  8006db:	00 00 00 
+  8006de:	41 ff d1             	call   *%r9
+
+00000000008006e1 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+    # Call the C page fault handler.
+    movq  %rsp,%rdi # passing the function argument in rdi
+  8006e1:	48 89 e7             	mov    %rsp,%rdi
+    movabs $_handle_vectored_pagefault, %rax
+  8006e4:	48 b8 27 2b 80 00 00 	movabs $0x802b27,%rax
+  8006eb:	00 00 00 
+    call *%rax
+  8006ee:	ff d0                	call   *%rax
+    # registers are available for intermediate calculations.  You
+    # may find that you have to rearrange your code in non-obvious
+    # ways as registers become unavailable as scratch space.
+
+    # LAB 9: Your code here
+    addq $16, %rsp
+  8006f0:	48 83 c4 10          	add    $0x10,%rsp
+	movq %rsp, %rax
+  8006f4:	48 89 e0             	mov    %rsp,%rax
+	movq 120(%rsp), %rbx
+  8006f7:	48 8b 5c 24 78       	mov    0x78(%rsp),%rbx
+	movq 136(%rsp), %rcx
+  8006fc:	48 8b 8c 24 88 00 00 	mov    0x88(%rsp),%rcx
+  800703:	00 
+	movq %rcx, %rsp
+  800704:	48 89 cc             	mov    %rcx,%rsp
+    pushq %rbx
+  800707:	53                   	push   %rbx
+    movq %rax, %rsp
+  800708:	48 89 c4             	mov    %rax,%rsp
+
+	subq $8, %rcx
+  80070b:	48 83 e9 08          	sub    $0x8,%rcx
+	movq %rcx, 136(%rsp)
+  80070f:	48 89 8c 24 88 00 00 	mov    %rcx,0x88(%rsp)
+  800716:	00 
+
+    # Restore the trap-time registers.  After you do this, you
+    # can no longer modify any general-purpose registers (POPA).
+    # LAB 9: Your code here
+
+    pop %r15
+  800717:	41 5f                	pop    %r15
+    pop %r14
+  800719:	41 5e                	pop    %r14
+    pop %r13
+  80071b:	41 5d                	pop    %r13
+    pop %r12
+  80071d:	41 5c                	pop    %r12
+    pop %r11
+  80071f:	41 5b                	pop    %r11
+    pop %r10
+  800721:	41 5a                	pop    %r10
+    pop %r9
+  800723:	41 59                	pop    %r9
+    pop %r8
+  800725:	41 58                	pop    %r8
+    pop %rsi
+  800727:	5e                   	pop    %rsi
+    pop %rdi
+  800728:	5f                   	pop    %rdi
+    pop %rbp
+  800729:	5d                   	pop    %rbp
+    pop %rdx
+  80072a:	5a                   	pop    %rdx
+    pop %rcx
+  80072b:	59                   	pop    %rcx
+    pop %rbx
+  80072c:	5b                   	pop    %rbx
+    pop %rax
+  80072d:	58                   	pop    %rax
+    # Restore rflags from the stack.  After you do this, you can
+    # no longer use arithmetic operations or anything else that
+    # modifies rflags.
+    # LAB 9: Your code here
+
+    addq $8, %rsp
+  80072e:	48 83 c4 08          	add    $0x8,%rsp
+    popfq
+  800732:	9d                   	popf
+
+    # Switch back to the adjusted trap-time stack.
+    # LAB 9: Your code here
+
+    pop %rsp
+  800733:	5c                   	pop    %rsp
+
+    # Return to re-execute the instruction that faulted.
+    ret
+  800734:	c3                   	ret
+
+0000000000800735 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  800735:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  80073c:	ff ff ff 
+  80073f:	48 01 f8             	add    %rdi,%rax
+  800742:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  800746:	c3                   	ret
+
+0000000000800747 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  800747:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  80074e:	ff ff ff 
+  800751:	48 01 f8             	add    %rdi,%rax
+  800754:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  800758:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  80075e:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  800762:	c3                   	ret
+
+0000000000800763 <fd_alloc_from>:
+}
+
+/* Like fd_alloc(), but only considers fds starting from fdnum,
+ * so that several fds can be found before their pages are allocated */
+int
+fd_alloc_from(int fdnum, struct Fd **fd_store) {
+  800763:	55                   	push   %rbp
+  800764:	48 89 e5             	mov    %rsp,%rbp
+  800767:	41 57                	push   %r15
+  800769:	41 56                	push   %r14
+  80076b:	41 55                	push   %r13
+  80076d:	41 54                	push   %r12
+  80076f:	53                   	push   %rbx
+  800770:	48 83 ec 08          	sub    $0x8,%rsp
+  800774:	49 89 f7             	mov    %rsi,%r15
+    for (int i = MAX(fdnum, 0); i < MAXFD; i++) {
+  800777:	85 ff                	test   %edi,%edi
+  800779:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80077f:	44 0f 49 e7          	cmovns %edi,%r12d
+  800783:	83 ff 1f             	cmp    $0x1f,%edi
+  800786:	7f 37                	jg     8007bf <fd_alloc_from+0x5c>
+  800788:	49 63 dc             	movslq %r12d,%rbx
+  80078b:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  800792:	48 c1 e3 0c          	shl    $0xc,%rbx
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  800796:	49 be 6c 18 80 00 00 	movabs $0x80186c,%r14
+  80079d:	00 00 00 
+        struct Fd *fd = INDEX2FD(i);
+  8007a0:	49 89 dd             	mov    %rbx,%r13
+        if (!(get_prot(fd) & PROT_R)) {
+  8007a3:	48 89 df             	mov    %rbx,%rdi
+  8007a6:	41 ff d6             	call   *%r14
+  8007a9:	83 e0 04             	and    $0x4,%eax
+  8007ac:	74 1c                	je     8007ca <fd_alloc_from+0x67>
+    for (int i = MAX(fdnum, 0); i < MAXFD; i++) {
+  8007ae:	41 83 c4 01          	add    $0x1,%r12d
+  8007b2:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8007b9:	41 83 fc 1f          	cmp    $0x1f,%r12d
+  8007bd:	7e e1                	jle    8007a0 <fd_alloc_from+0x3d>
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  8007bf:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  8007c5:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  8007ca:	4d 89 2f             	mov    %r13,(%r15)
+}
+  8007cd:	48 83 c4 08          	add    $0x8,%rsp
+  8007d1:	5b                   	pop    %rbx
+  8007d2:	41 5c                	pop    %r12
+  8007d4:	41 5d                	pop    %r13
+  8007d6:	41 5e                	pop    %r14
+  8007d8:	41 5f                	pop    %r15
+  8007da:	5d                   	pop    %rbp
+  8007db:	c3                   	ret
+
+00000000008007dc <fd_alloc>:
+fd_alloc(struct Fd **fd_store) {
+  8007dc:	55                   	push   %rbp
+  8007dd:	48 89 e5             	mov    %rsp,%rbp
+  8007e0:	48 89 fe             	mov    %rdi,%rsi
+    return fd_alloc_from(0, fd_store);
+  8007e3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8007e8:	48 b8 63 07 80 00 00 	movabs $0x800763,%rax
+  8007ef:	00 00 00 
+  8007f2:	ff d0                	call   *%rax
+}
+  8007f4:	5d                   	pop    %rbp
+  8007f5:	c3                   	ret
+
+00000000008007f6 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  8007f6:	83 ff 1f             	cmp    $0x1f,%edi
+  8007f9:	77 39                	ja     800834 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  8007fb:	55                   	push   %rbp
+  8007fc:	48 89 e5             	mov    %rsp,%rbp
+  8007ff:	41 54                	push   %r12
+  800801:	53                   	push   %rbx
+  800802:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  800805:	48 63 df             	movslq %edi,%rbx
+  800808:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  80080f:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  800813:	48 89 df             	mov    %rbx,%rdi
+  800816:	48 b8 6c 18 80 00 00 	movabs $0x80186c,%rax
+  80081d:	00 00 00 
+  800820:	ff d0                	call   *%rax
+  800822:	a8 04                	test   $0x4,%al
+  800824:	74 14                	je     80083a <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  800826:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  80082a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80082f:	5b                   	pop    %rbx
+  800830:	41 5c                	pop    %r12
+  800832:	5d                   	pop    %rbp
+  800833:	c3                   	ret
+        return -E_INVAL;
+  800834:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  800839:	c3                   	ret
+        return -E_INVAL;
+  80083a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80083f:	eb ee                	jmp    80082f <fd_lookup+0x39>
+
+0000000000800841 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  800841:	55                   	push   %rbp
+  800842:	48 89 e5             	mov    %rsp,%rbp
+  800845:	41 54                	push   %r12
+  800847:	53                   	push   %rbx
+  800848:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  80084b:	48 b8 40 30 80 00 00 	movabs $0x803040,%rax
+  800852:	00 00 00 
+  800855:	48 bb 20 40 80 00 00 	movabs $0x804020,%rbx
+  80085c:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  80085f:	39 3b                	cmp    %edi,(%rbx)
+  800861:	74 47                	je     8008aa <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  800863:	48 83 c0 08          	add    $0x8,%rax
+  800867:	48 8b 18             	mov    (%rax),%rbx
+  80086a:	48 85 db             	test   %rbx,%rbx
+  80086d:	75 f0                	jne    80085f <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  80086f:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  800876:	00 00 00 
+  800879:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+  80087f:	89 fa                	mov    %edi,%edx
+  800881:	48 bf c0 2f 80 00 00 	movabs $0x802fc0,%rdi
+  800888:	00 00 00 
+  80088b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800890:	48 b9 db 1d 80 00 00 	movabs $0x801ddb,%rcx
+  800897:	00 00 00 
+  80089a:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  80089c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  8008a1:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  8008a5:	5b                   	pop    %rbx
+  8008a6:	41 5c                	pop    %r12
+  8008a8:	5d                   	pop    %rbp
+  8008a9:	c3                   	ret
+            return 0;
+  8008aa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008af:	eb f0                	jmp    8008a1 <dev_lookup+0x60>
+
+00000000008008b1 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  8008b1:	55                   	push   %rbp
+  8008b2:	48 89 e5             	mov    %rsp,%rbp
+  8008b5:	41 55                	push   %r13
+  8008b7:	41 54                	push   %r12
+  8008b9:	53                   	push   %rbx
+  8008ba:	48 83 ec 18          	sub    $0x18,%rsp
+  8008be:	48 89 fb             	mov    %rdi,%rbx
+  8008c1:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8008c4:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  8008cb:	ff ff ff 
+  8008ce:	48 01 df             	add    %rbx,%rdi
+  8008d1:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  8008d5:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8008d9:	48 b8 f6 07 80 00 00 	movabs $0x8007f6,%rax
+  8008e0:	00 00 00 
+  8008e3:	ff d0                	call   *%rax
+  8008e5:	41 89 c5             	mov    %eax,%r13d
+  8008e8:	85 c0                	test   %eax,%eax
+  8008ea:	78 06                	js     8008f2 <fd_close+0x41>
+  8008ec:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  8008f0:	74 1a                	je     80090c <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  8008f2:	45 84 e4             	test   %r12b,%r12b
+  8008f5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008fa:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  8008fe:	44 89 e8             	mov    %r13d,%eax
+  800901:	48 83 c4 18          	add    $0x18,%rsp
+  800905:	5b                   	pop    %rbx
+  800906:	41 5c                	pop    %r12
+  800908:	41 5d                	pop    %r13
+  80090a:	5d                   	pop    %rbp
+  80090b:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  80090c:	8b 3b                	mov    (%rbx),%edi
+  80090e:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800912:	48 b8 41 08 80 00 00 	movabs $0x800841,%rax
+  800919:	00 00 00 
+  80091c:	ff d0                	call   *%rax
+  80091e:	41 89 c5             	mov    %eax,%r13d
+  800921:	85 c0                	test   %eax,%eax
+  800923:	78 1b                	js     800940 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  800925:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800929:	48 8b 40 20          	mov    0x20(%rax),%rax
+  80092d:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  800933:	48 85 c0             	test   %rax,%rax
+  800936:	74 08                	je     800940 <fd_close+0x8f>
+  800938:	48 89 df             	mov    %rbx,%rdi
+  80093b:	ff d0                	call   *%rax
+  80093d:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  800940:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800945:	48 89 de             	mov    %rbx,%rsi
+  800948:	bf 00 00 00 00       	mov    $0x0,%edi
+  80094d:	48 b8 72 03 80 00 00 	movabs $0x800372,%rax
+  800954:	00 00 00 
+  800957:	ff d0                	call   *%rax
+    return res;
+  800959:	eb a3                	jmp    8008fe <fd_close+0x4d>
+
+000000000080095b <close>:
+
+int
+close(int fdnum) {
+  80095b:	55                   	push   %rbp
+  80095c:	48 89 e5             	mov    %rsp,%rbp
+  80095f:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  800963:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  800967:	48 b8 f6 07 80 00 00 	movabs $0x8007f6,%rax
+  80096e:	00 00 00 
+  800971:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  800973:	85 c0                	test   %eax,%eax
+  800975:	78 15                	js     80098c <close+0x31>
+
+    return fd_close(fd, 1);
+  800977:	be 01 00 00 00       	mov    $0x1,%esi
+  80097c:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  800980:	48 b8 b1 08 80 00 00 	movabs $0x8008b1,%rax
+  800987:	00 00 00 
+  80098a:	ff d0                	call   *%rax
+}
+  80098c:	c9                   	leave
+  80098d:	c3                   	ret
+
+000000000080098e <close_all>:
+
+void
+close_all(void) {
+  80098e:	55                   	push   %rbp
+  80098f:	48 89 e5             	mov    %rsp,%rbp
+  800992:	41 54                	push   %r12
+  800994:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  800995:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80099a:	49 bc 5b 09 80 00 00 	movabs $0x80095b,%r12
+  8009a1:	00 00 00 
+  8009a4:	89 df                	mov    %ebx,%edi
+  8009a6:	41 ff d4             	call   *%r12
+  8009a9:	83 c3 01             	add    $0x1,%ebx
+  8009ac:	83 fb 20             	cmp    $0x20,%ebx
+  8009af:	75 f3                	jne    8009a4 <close_all+0x16>
+}
+  8009b1:	5b                   	pop    %rbx
+  8009b2:	41 5c                	pop    %r12
+  8009b4:	5d                   	pop    %rbp
+  8009b5:	c3                   	ret
+
+00000000008009b6 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  8009b6:	55                   	push   %rbp
+  8009b7:	48 89 e5             	mov    %rsp,%rbp
+  8009ba:	41 57                	push   %r15
+  8009bc:	41 56                	push   %r14
+  8009be:	41 55                	push   %r13
+  8009c0:	41 54                	push   %r12
+  8009c2:	53                   	push   %rbx
+  8009c3:	48 83 ec 18          	sub    $0x18,%rsp
+  8009c7:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  8009ca:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  8009ce:	48 b8 f6 07 80 00 00 	movabs $0x8007f6,%rax
+  8009d5:	00 00 00 
+  8009d8:	ff d0                	call   *%rax
+  8009da:	89 c3                	mov    %eax,%ebx
+  8009dc:	85 c0                	test   %eax,%eax
+  8009de:	0f 88 b8 00 00 00    	js     800a9c <dup+0xe6>
+    close(newfdnum);
+  8009e4:	44 89 e7             	mov    %r12d,%edi
+  8009e7:	48 b8 5b 09 80 00 00 	movabs $0x80095b,%rax
+  8009ee:	00 00 00 
+  8009f1:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  8009f3:	4d 63 ec             	movslq %r12d,%r13
+  8009f6:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  8009fd:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  800a01:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  800a05:	4c 89 ff             	mov    %r15,%rdi
+  800a08:	49 be 47 07 80 00 00 	movabs $0x800747,%r14
+  800a0f:	00 00 00 
+  800a12:	41 ff d6             	call   *%r14
+  800a15:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  800a18:	4c 89 ef             	mov    %r13,%rdi
+  800a1b:	41 ff d6             	call   *%r14
+  800a1e:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  800a21:	48 89 df             	mov    %rbx,%rdi
+  800a24:	48 b8 6c 18 80 00 00 	movabs $0x80186c,%rax
+  800a2b:	00 00 00 
+  800a2e:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  800a30:	a8 04                	test   $0x4,%al
+  800a32:	74 2b                	je     800a5f <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  800a34:	41 89 c1             	mov    %eax,%r9d
+  800a37:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  800a3d:	4c 89 f1             	mov    %r14,%rcx
+  800a40:	ba 00 00 00 00       	mov    $0x0,%edx
+  800a45:	48 89 de             	mov    %rbx,%rsi
+  800a48:	bf 00 00 00 00       	mov    $0x0,%edi
+  800a4d:	48 b8 0d 03 80 00 00 	movabs $0x80030d,%rax
+  800a54:	00 00 00 
+  800a57:	ff d0                	call   *%rax
+  800a59:	89 c3                	mov    %eax,%ebx
+  800a5b:	85 c0                	test   %eax,%eax
+  800a5d:	78 4e                	js     800aad <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  800a5f:	4c 89 ff             	mov    %r15,%rdi
+  800a62:	48 b8 6c 18 80 00 00 	movabs $0x80186c,%rax
+  800a69:	00 00 00 
+  800a6c:	ff d0                	call   *%rax
+  800a6e:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  800a71:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  800a77:	4c 89 e9             	mov    %r13,%rcx
+  800a7a:	ba 00 00 00 00       	mov    $0x0,%edx
+  800a7f:	4c 89 fe             	mov    %r15,%rsi
+  800a82:	bf 00 00 00 00       	mov    $0x0,%edi
+  800a87:	48 b8 0d 03 80 00 00 	movabs $0x80030d,%rax
+  800a8e:	00 00 00 
+  800a91:	ff d0                	call   *%rax
+  800a93:	89 c3                	mov    %eax,%ebx
+  800a95:	85 c0                	test   %eax,%eax
+  800a97:	78 14                	js     800aad <dup+0xf7>
+
+    return newfdnum;
+  800a99:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  800a9c:	89 d8                	mov    %ebx,%eax
+  800a9e:	48 83 c4 18          	add    $0x18,%rsp
+  800aa2:	5b                   	pop    %rbx
+  800aa3:	41 5c                	pop    %r12
+  800aa5:	41 5d                	pop    %r13
+  800aa7:	41 5e                	pop    %r14
+  800aa9:	41 5f                	pop    %r15
+  800aab:	5d                   	pop    %rbp
+  800aac:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  800aad:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800ab2:	4c 89 ee             	mov    %r13,%rsi
+  800ab5:	bf 00 00 00 00       	mov    $0x0,%edi
+  800aba:	49 bc 72 03 80 00 00 	movabs $0x800372,%r12
+  800ac1:	00 00 00 
+  800ac4:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  800ac7:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800acc:	4c 89 f6             	mov    %r14,%rsi
+  800acf:	bf 00 00 00 00       	mov    $0x0,%edi
+  800ad4:	41 ff d4             	call   *%r12
+    return res;
+  800ad7:	eb c3                	jmp    800a9c <dup+0xe6>
+
+0000000000800ad9 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  800ad9:	55                   	push   %rbp
+  800ada:	48 89 e5             	mov    %rsp,%rbp
+  800add:	41 56                	push   %r14
+  800adf:	41 55                	push   %r13
+  800ae1:	41 54                	push   %r12
+  800ae3:	53                   	push   %rbx
+  800ae4:	48 83 ec 10          	sub    $0x10,%rsp
+  800ae8:	89 fb                	mov    %edi,%ebx
+  800aea:	49 89 f4             	mov    %rsi,%r12
+  800aed:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800af0:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800af4:	48 b8 f6 07 80 00 00 	movabs $0x8007f6,%rax
+  800afb:	00 00 00 
+  800afe:	ff d0                	call   *%rax
+  800b00:	85 c0                	test   %eax,%eax
+  800b02:	78 4c                	js     800b50 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800b04:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  800b08:	41 8b 3e             	mov    (%r14),%edi
+  800b0b:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800b0f:	48 b8 41 08 80 00 00 	movabs $0x800841,%rax
+  800b16:	00 00 00 
+  800b19:	ff d0                	call   *%rax
+  800b1b:	85 c0                	test   %eax,%eax
+  800b1d:	78 35                	js     800b54 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  800b1f:	41 8b 46 08          	mov    0x8(%r14),%eax
+  800b23:	83 e0 03             	and    $0x3,%eax
+  800b26:	83 f8 01             	cmp    $0x1,%eax
+  800b29:	74 2d                	je     800b58 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  800b2b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800b2f:	48 8b 40 10          	mov    0x10(%rax),%rax
+  800b33:	48 85 c0             	test   %rax,%rax
+  800b36:	74 56                	je     800b8e <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  800b38:	4c 89 ea             	mov    %r13,%rdx
+  800b3b:	4c 89 e6             	mov    %r12,%rsi
+  800b3e:	4c 89 f7             	mov    %r14,%rdi
+  800b41:	ff d0                	call   *%rax
+}
+  800b43:	48 83 c4 10          	add    $0x10,%rsp
+  800b47:	5b                   	pop    %rbx
+  800b48:	41 5c                	pop    %r12
+  800b4a:	41 5d                	pop    %r13
+  800b4c:	41 5e                	pop    %r14
+  800b4e:	5d                   	pop    %rbp
+  800b4f:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800b50:	48 98                	cltq
+  800b52:	eb ef                	jmp    800b43 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800b54:	48 98                	cltq
+  800b56:	eb eb                	jmp    800b43 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  800b58:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  800b5f:	00 00 00 
+  800b62:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+  800b68:	89 da                	mov    %ebx,%edx
+  800b6a:	48 bf 01 30 80 00 00 	movabs $0x803001,%rdi
+  800b71:	00 00 00 
+  800b74:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b79:	48 b9 db 1d 80 00 00 	movabs $0x801ddb,%rcx
+  800b80:	00 00 00 
+  800b83:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  800b85:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  800b8c:	eb b5                	jmp    800b43 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  800b8e:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  800b95:	eb ac                	jmp    800b43 <read+0x6a>
+
+0000000000800b97 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  800b97:	55                   	push   %rbp
+  800b98:	48 89 e5             	mov    %rsp,%rbp
+  800b9b:	41 57                	push   %r15
+  800b9d:	41 56                	push   %r14
+  800b9f:	41 55                	push   %r13
+  800ba1:	41 54                	push   %r12
+  800ba3:	53                   	push   %rbx
+  800ba4:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  800ba8:	48 85 d2             	test   %rdx,%rdx
+  800bab:	74 54                	je     800c01 <readn+0x6a>
+  800bad:	41 89 fd             	mov    %edi,%r13d
+  800bb0:	49 89 f6             	mov    %rsi,%r14
+  800bb3:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  800bb6:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  800bbb:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  800bc0:	49 bf d9 0a 80 00 00 	movabs $0x800ad9,%r15
+  800bc7:	00 00 00 
+  800bca:	4c 89 e2             	mov    %r12,%rdx
+  800bcd:	48 29 f2             	sub    %rsi,%rdx
+  800bd0:	4c 01 f6             	add    %r14,%rsi
+  800bd3:	44 89 ef             	mov    %r13d,%edi
+  800bd6:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  800bd9:	85 c0                	test   %eax,%eax
+  800bdb:	78 20                	js     800bfd <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  800bdd:	01 c3                	add    %eax,%ebx
+  800bdf:	85 c0                	test   %eax,%eax
+  800be1:	74 08                	je     800beb <readn+0x54>
+  800be3:	48 63 f3             	movslq %ebx,%rsi
+  800be6:	4c 39 e6             	cmp    %r12,%rsi
+  800be9:	72 df                	jb     800bca <readn+0x33>
+    }
+    return res;
+  800beb:	48 63 c3             	movslq %ebx,%rax
+}
+  800bee:	48 83 c4 08          	add    $0x8,%rsp
+  800bf2:	5b                   	pop    %rbx
+  800bf3:	41 5c                	pop    %r12
+  800bf5:	41 5d                	pop    %r13
+  800bf7:	41 5e                	pop    %r14
+  800bf9:	41 5f                	pop    %r15
+  800bfb:	5d                   	pop    %rbp
+  800bfc:	c3                   	ret
+        if (inc < 0) return inc;
+  800bfd:	48 98                	cltq
+  800bff:	eb ed                	jmp    800bee <readn+0x57>
+    int inc = 1, res = 0;
+  800c01:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800c06:	eb e3                	jmp    800beb <readn+0x54>
+
+0000000000800c08 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  800c08:	55                   	push   %rbp
+  800c09:	48 89 e5             	mov    %rsp,%rbp
+  800c0c:	41 56                	push   %r14
+  800c0e:	41 55                	push   %r13
+  800c10:	41 54                	push   %r12
+  800c12:	53                   	push   %rbx
+  800c13:	48 83 ec 10          	sub    $0x10,%rsp
+  800c17:	89 fb                	mov    %edi,%ebx
+  800c19:	49 89 f4             	mov    %rsi,%r12
+  800c1c:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800c1f:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800c23:	48 b8 f6 07 80 00 00 	movabs $0x8007f6,%rax
+  800c2a:	00 00 00 
+  800c2d:	ff d0                	call   *%rax
+  800c2f:	85 c0                	test   %eax,%eax
+  800c31:	78 47                	js     800c7a <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800c33:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  800c37:	41 8b 3e             	mov    (%r14),%edi
+  800c3a:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800c3e:	48 b8 41 08 80 00 00 	movabs $0x800841,%rax
+  800c45:	00 00 00 
+  800c48:	ff d0                	call   *%rax
+  800c4a:	85 c0                	test   %eax,%eax
+  800c4c:	78 30                	js     800c7e <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800c4e:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  800c53:	74 2d                	je     800c82 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  800c55:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800c59:	48 8b 40 18          	mov    0x18(%rax),%rax
+  800c5d:	48 85 c0             	test   %rax,%rax
+  800c60:	74 56                	je     800cb8 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  800c62:	4c 89 ea             	mov    %r13,%rdx
+  800c65:	4c 89 e6             	mov    %r12,%rsi
+  800c68:	4c 89 f7             	mov    %r14,%rdi
+  800c6b:	ff d0                	call   *%rax
+}
+  800c6d:	48 83 c4 10          	add    $0x10,%rsp
+  800c71:	5b                   	pop    %rbx
+  800c72:	41 5c                	pop    %r12
+  800c74:	41 5d                	pop    %r13
+  800c76:	41 5e                	pop    %r14
+  800c78:	5d                   	pop    %rbp
+  800c79:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800c7a:	48 98                	cltq
+  800c7c:	eb ef                	jmp    800c6d <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800c7e:	48 98                	cltq
+  800c80:	eb eb                	jmp    800c6d <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  800c82:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  800c89:	00 00 00 
+  800c8c:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+  800c92:	89 da                	mov    %ebx,%edx
+  800c94:	48 bf 1d 30 80 00 00 	movabs $0x80301d,%rdi
+  800c9b:	00 00 00 
+  800c9e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ca3:	48 b9 db 1d 80 00 00 	movabs $0x801ddb,%rcx
+  800caa:	00 00 00 
+  800cad:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  800caf:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  800cb6:	eb b5                	jmp    800c6d <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  800cb8:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  800cbf:	eb ac                	jmp    800c6d <write+0x65>
+
+0000000000800cc1 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  800cc1:	55                   	push   %rbp
+  800cc2:	48 89 e5             	mov    %rsp,%rbp
+  800cc5:	53                   	push   %rbx
+  800cc6:	48 83 ec 18          	sub    $0x18,%rsp
+  800cca:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800ccc:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800cd0:	48 b8 f6 07 80 00 00 	movabs $0x8007f6,%rax
+  800cd7:	00 00 00 
+  800cda:	ff d0                	call   *%rax
+  800cdc:	85 c0                	test   %eax,%eax
+  800cde:	78 0c                	js     800cec <seek+0x2b>
+
+    fd->fd_offset = offset;
+  800ce0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800ce4:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  800ce7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800cec:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800cf0:	c9                   	leave
+  800cf1:	c3                   	ret
+
+0000000000800cf2 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  800cf2:	55                   	push   %rbp
+  800cf3:	48 89 e5             	mov    %rsp,%rbp
+  800cf6:	41 55                	push   %r13
+  800cf8:	41 54                	push   %r12
+  800cfa:	53                   	push   %rbx
+  800cfb:	48 83 ec 18          	sub    $0x18,%rsp
+  800cff:	89 fb                	mov    %edi,%ebx
+  800d01:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800d04:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800d08:	48 b8 f6 07 80 00 00 	movabs $0x8007f6,%rax
+  800d0f:	00 00 00 
+  800d12:	ff d0                	call   *%rax
+  800d14:	85 c0                	test   %eax,%eax
+  800d16:	78 38                	js     800d50 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800d18:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  800d1c:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  800d20:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800d24:	48 b8 41 08 80 00 00 	movabs $0x800841,%rax
+  800d2b:	00 00 00 
+  800d2e:	ff d0                	call   *%rax
+  800d30:	85 c0                	test   %eax,%eax
+  800d32:	78 1c                	js     800d50 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800d34:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  800d39:	74 20                	je     800d5b <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  800d3b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800d3f:	48 8b 40 30          	mov    0x30(%rax),%rax
+  800d43:	48 85 c0             	test   %rax,%rax
+  800d46:	74 47                	je     800d8f <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  800d48:	44 89 e6             	mov    %r12d,%esi
+  800d4b:	4c 89 ef             	mov    %r13,%rdi
+  800d4e:	ff d0                	call   *%rax
+}
+  800d50:	48 83 c4 18          	add    $0x18,%rsp
+  800d54:	5b                   	pop    %rbx
+  800d55:	41 5c                	pop    %r12
+  800d57:	41 5d                	pop    %r13
+  800d59:	5d                   	pop    %rbp
+  800d5a:	c3                   	ret
+                thisenv->env_id, fdnum);
+  800d5b:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  800d62:	00 00 00 
+  800d65:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  800d6b:	89 da                	mov    %ebx,%edx
+  800d6d:	48 bf e0 2f 80 00 00 	movabs $0x802fe0,%rdi
+  800d74:	00 00 00 
+  800d77:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d7c:	48 b9 db 1d 80 00 00 	movabs $0x801ddb,%rcx
+  800d83:	00 00 00 
+  800d86:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  800d88:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800d8d:	eb c1                	jmp    800d50 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  800d8f:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  800d94:	eb ba                	jmp    800d50 <ftruncate+0x5e>
+
+0000000000800d96 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  800d96:	55                   	push   %rbp
+  800d97:	48 89 e5             	mov    %rsp,%rbp
+  800d9a:	41 54                	push   %r12
+  800d9c:	53                   	push   %rbx
+  800d9d:	48 83 ec 10          	sub    $0x10,%rsp
+  800da1:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800da4:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800da8:	48 b8 f6 07 80 00 00 	movabs $0x8007f6,%rax
+  800daf:	00 00 00 
+  800db2:	ff d0                	call   *%rax
+  800db4:	85 c0                	test   %eax,%eax
+  800db6:	78 4e                	js     800e06 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800db8:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  800dbc:	41 8b 3c 24          	mov    (%r12),%edi
+  800dc0:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  800dc4:	48 b8 41 08 80 00 00 	movabs $0x800841,%rax
+  800dcb:	00 00 00 
+  800dce:	ff d0                	call   *%rax
+  800dd0:	85 c0                	test   %eax,%eax
+  800dd2:	78 32                	js     800e06 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  800dd4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800dd8:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  800ddd:	74 30                	je     800e0f <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  800ddf:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  800de2:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  800de9:	00 00 00 
+    stat->st_isdir = 0;
+  800dec:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  800df3:	00 00 00 
+    stat->st_dev = dev;
+  800df6:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  800dfd:	48 89 de             	mov    %rbx,%rsi
+  800e00:	4c 89 e7             	mov    %r12,%rdi
+  800e03:	ff 50 28             	call   *0x28(%rax)
+}
+  800e06:	48 83 c4 10          	add    $0x10,%rsp
+  800e0a:	5b                   	pop    %rbx
+  800e0b:	41 5c                	pop    %r12
+  800e0d:	5d                   	pop    %rbp
+  800e0e:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  800e0f:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  800e14:	eb f0                	jmp    800e06 <fstat+0x70>
+
+0000000000800e16 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  800e16:	55                   	push   %rbp
+  800e17:	48 89 e5             	mov    %rsp,%rbp
+  800e1a:	41 54                	push   %r12
+  800e1c:	53                   	push   %rbx
+  800e1d:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  800e20:	be 00 00 00 00       	mov    $0x0,%esi
+  800e25:	48 b8 f9 11 80 00 00 	movabs $0x8011f9,%rax
+  800e2c:	00 00 00 
+  800e2f:	ff d0                	call   *%rax
+  800e31:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  800e33:	85 c0                	test   %eax,%eax
+  800e35:	78 25                	js     800e5c <stat+0x46>
+
+    int res = fstat(fd, stat);
+  800e37:	4c 89 e6             	mov    %r12,%rsi
+  800e3a:	89 c7                	mov    %eax,%edi
+  800e3c:	48 b8 96 0d 80 00 00 	movabs $0x800d96,%rax
+  800e43:	00 00 00 
+  800e46:	ff d0                	call   *%rax
+  800e48:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  800e4b:	89 df                	mov    %ebx,%edi
+  800e4d:	48 b8 5b 09 80 00 00 	movabs $0x80095b,%rax
+  800e54:	00 00 00 
+  800e57:	ff d0                	call   *%rax
+
+    return res;
+  800e59:	44 89 e3             	mov    %r12d,%ebx
+}
+  800e5c:	89 d8                	mov    %ebx,%eax
+  800e5e:	5b                   	pop    %rbx
+  800e5f:	41 5c                	pop    %r12
+  800e61:	5d                   	pop    %rbp
+  800e62:	c3                   	ret
+
+0000000000800e63 <fsipc>:
+ * response may be written back to fsipcbuf.
+ * type: request code, passed as the simple integer IPC value.
+ * dstva: virtual address at which to receive reply page, 0 if none.
+ * Returns result from the file server. */
+static int
+fsipc(unsigned type, void *dstva) {
+  800e63:	55                   	push   %rbp
+  800e64:	48 89 e5             	mov    %rsp,%rbp
+  800e67:	41 54                	push   %r12
+  800e69:	53                   	push   %rbx
+  800e6a:	48 83 ec 10          	sub    $0x10,%rsp
+  800e6e:	41 89 fc             	mov    %edi,%r12d
+  800e71:	48 89 f3             	mov    %rsi,%rbx
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  800e74:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  800e7b:	00 00 00 
+  800e7e:	83 38 00             	cmpl   $0x0,(%rax)
+  800e81:	74 5e                	je     800ee1 <fsipc+0x7e>
+    if (debug) {
+        cprintf("[%08x] fsipc %d %08x\n",
+                thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+    }
+
+    ipc_send(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW);
+  800e83:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  800e89:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  800e8e:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  800e95:	00 00 00 
+  800e98:	44 89 e6             	mov    %r12d,%esi
+  800e9b:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  800ea2:	00 00 00 
+  800ea5:	8b 38                	mov    (%rax),%edi
+  800ea7:	48 b8 87 2e 80 00 00 	movabs $0x802e87,%rax
+  800eae:	00 00 00 
+  800eb1:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  800eb3:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  800eba:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  800ebb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ec0:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  800ec4:	48 89 de             	mov    %rbx,%rsi
+  800ec7:	bf 00 00 00 00       	mov    $0x0,%edi
+  800ecc:	48 b8 b2 2d 80 00 00 	movabs $0x802db2,%rax
+  800ed3:	00 00 00 
+  800ed6:	ff d0                	call   *%rax
+}
+  800ed8:	48 83 c4 10          	add    $0x10,%rsp
+  800edc:	5b                   	pop    %rbx
+  800edd:	41 5c                	pop    %r12
+  800edf:	5d                   	pop    %rbp
+  800ee0:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  800ee1:	bf 03 00 00 00       	mov    $0x3,%edi
+  800ee6:	48 b8 2a 2f 80 00 00 	movabs $0x802f2a,%rax
+  800eed:	00 00 00 
+  800ef0:	ff d0                	call   *%rax
+  800ef2:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  800ef9:	00 00 
+  800efb:	eb 86                	jmp    800e83 <fsipc+0x20>
+
+0000000000800efd <devfile_trunc>:
+    return 0;
+}
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  800efd:	55                   	push   %rbp
+  800efe:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  800f01:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  800f08:	00 00 00 
+  800f0b:	8b 57 0c             	mov    0xc(%rdi),%edx
+  800f0e:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  800f10:	89 70 04             	mov    %esi,0x4(%rax)
+
+    return fsipc(FSREQ_SET_SIZE, NULL);
+  800f13:	be 00 00 00 00       	mov    $0x0,%esi
+  800f18:	bf 02 00 00 00       	mov    $0x2,%edi
+  800f1d:	48 b8 63 0e 80 00 00 	movabs $0x800e63,%rax
+  800f24:	00 00 00 
+  800f27:	ff d0                	call   *%rax
+}
+  800f29:	5d                   	pop    %rbp
+  800f2a:	c3                   	ret
+
+0000000000800f2b <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  800f2b:	55                   	push   %rbp
+  800f2c:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  800f2f:	8b 47 0c             	mov    0xc(%rdi),%eax
+  800f32:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  800f39:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  800f3b:	be 00 00 00 00       	mov    $0x0,%esi
+  800f40:	bf 06 00 00 00       	mov    $0x6,%edi
+  800f45:	48 b8 63 0e 80 00 00 	movabs $0x800e63,%rax
+  800f4c:	00 00 00 
+  800f4f:	ff d0                	call   *%rax
+}
+  800f51:	5d                   	pop    %rbp
+  800f52:	c3                   	ret
+
+0000000000800f53 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  800f53:	55                   	push   %rbp
+  800f54:	48 89 e5             	mov    %rsp,%rbp
+  800f57:	41 54                	push   %r12
+  800f59:	53                   	push   %rbx
+  800f5a:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  800f5d:	8b 47 0c             	mov    0xc(%rdi),%eax
+  800f60:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  800f67:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  800f69:	be 00 00 00 00       	mov    $0x0,%esi
+  800f6e:	bf 05 00 00 00       	mov    $0x5,%edi
+  800f73:	48 b8 63 0e 80 00 00 	movabs $0x800e63,%rax
+  800f7a:	00 00 00 
+  800f7d:	ff d0                	call   *%rax
+    if (res < 0) {
+  800f7f:	85 c0                	test   %eax,%eax
+  800f81:	78 3d                	js     800fc0 <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  800f83:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  800f8a:	00 00 00 
+  800f8d:	4c 89 e6             	mov    %r12,%rsi
+  800f90:	48 89 df             	mov    %rbx,%rdi
+  800f93:	48 b8 00 27 80 00 00 	movabs $0x802700,%rax
+  800f9a:	00 00 00 
+  800f9d:	ff d0                	call   *%rax
+    st->st_size  = fsipcbuf.statRet.ret_size;
+  800f9f:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  800fa6:	00 
+  800fa7:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  800fad:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  800fb4:	00 
+  800fb5:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  800fbb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800fc0:	5b                   	pop    %rbx
+  800fc1:	41 5c                	pop    %r12
+  800fc3:	5d                   	pop    %rbp
+  800fc4:	c3                   	ret
+
+0000000000800fc5 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  800fc5:	55                   	push   %rbp
+  800fc6:	48 89 e5             	mov    %rsp,%rbp
+  800fc9:	41 57                	push   %r15
+  800fcb:	41 56                	push   %r14
+  800fcd:	41 55                	push   %r13
+  800fcf:	41 54                	push   %r12
+  800fd1:	53                   	push   %rbx
+  800fd2:	48 83 ec 18          	sub    $0x18,%rsp
+  800fd6:	49 89 fe             	mov    %rdi,%r14
+  800fd9:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+  800fdd:	48 89 d3             	mov    %rdx,%rbx
+    while (n > sizeof(fsipcbuf.write.req_buf))
+  800fe0:	48 81 fa f0 0f 00 00 	cmp    $0xff0,%rdx
+  800fe7:	0f 86 e4 00 00 00    	jbe    8010d1 <devfile_write+0x10c>
+  800fed:	49 89 f4             	mov    %rsi,%r12
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  800ff0:	49 bd 00 60 80 00 00 	movabs $0x806000,%r13
+  800ff7:	00 00 00 
+        memcpy(fsipcbuf.write.req_buf, buf, sizeof(fsipcbuf.write.req_buf));
+  800ffa:	49 bf 61 29 80 00 00 	movabs $0x802961,%r15
+  801001:	00 00 00 
+  801004:	eb 03                	jmp    801009 <devfile_write+0x44>
+        buf += sizeof(fsipcbuf.write.req_buf);
+  801006:	49 89 f4             	mov    %rsi,%r12
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801009:	41 8b 46 0c          	mov    0xc(%r14),%eax
+  80100d:	41 89 45 00          	mov    %eax,0x0(%r13)
+        fsipcbuf.write.req_n      = sizeof(fsipcbuf.write.req_buf);
+  801011:	49 c7 45 08 f0 0f 00 	movq   $0xff0,0x8(%r13)
+  801018:	00 
+        memcpy(fsipcbuf.write.req_buf, buf, sizeof(fsipcbuf.write.req_buf));
+  801019:	ba f0 0f 00 00       	mov    $0xff0,%edx
+  80101e:	4c 89 e6             	mov    %r12,%rsi
+  801021:	48 bf 10 60 80 00 00 	movabs $0x806010,%rdi
+  801028:	00 00 00 
+  80102b:	41 ff d7             	call   *%r15
+        ssize_t res = fsipc(FSREQ_WRITE, NULL);
+  80102e:	be 00 00 00 00       	mov    $0x0,%esi
+  801033:	bf 04 00 00 00       	mov    $0x4,%edi
+  801038:	48 b8 63 0e 80 00 00 	movabs $0x800e63,%rax
+  80103f:	00 00 00 
+  801042:	ff d0                	call   *%rax
+  801044:	48 63 d0             	movslq %eax,%rdx
+        if (res < 0 || res < sizeof(fsipcbuf.write.req_buf))
+  801047:	3d ef 0f 00 00       	cmp    $0xfef,%eax
+  80104c:	7e 71                	jle    8010bf <devfile_write+0xfa>
+        buf += sizeof(fsipcbuf.write.req_buf);
+  80104e:	49 8d b4 24 f0 0f 00 	lea    0xff0(%r12),%rsi
+  801055:	00 
+        n -= sizeof(fsipcbuf.write.req_buf);
+  801056:	48 81 eb f0 0f 00 00 	sub    $0xff0,%rbx
+    while (n > sizeof(fsipcbuf.write.req_buf))
+  80105d:	48 81 fb f0 0f 00 00 	cmp    $0xff0,%rbx
+  801064:	77 a0                	ja     801006 <devfile_write+0x41>
+        written += sizeof(fsipcbuf.write.req_buf);
+  801066:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80106a:	49 29 c4             	sub    %rax,%r12
+  80106d:	4d 8d a4 24 f0 0f 00 	lea    0xff0(%r12),%r12
+  801074:	00 
+    fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801075:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  80107c:	00 00 00 
+  80107f:	41 8b 56 0c          	mov    0xc(%r14),%edx
+  801083:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.write.req_n      = n;
+  801085:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    memcpy(fsipcbuf.write.req_buf, buf, n);
+  801089:	48 89 da             	mov    %rbx,%rdx
+  80108c:	48 8d 78 10          	lea    0x10(%rax),%rdi
+  801090:	48 b8 61 29 80 00 00 	movabs $0x802961,%rax
+  801097:	00 00 00 
+  80109a:	ff d0                	call   *%rax
+    ssize_t res = fsipc(FSREQ_WRITE, NULL);
+  80109c:	be 00 00 00 00       	mov    $0x0,%esi
+  8010a1:	bf 04 00 00 00       	mov    $0x4,%edi
+  8010a6:	48 b8 63 0e 80 00 00 	movabs $0x800e63,%rax
+  8010ad:	00 00 00 
+  8010b0:	ff d0                	call   *%rax
+  8010b2:	48 63 d0             	movslq %eax,%rdx
+    written += res;
+  8010b5:	49 01 d4             	add    %rdx,%r12
+  8010b8:	48 85 d2             	test   %rdx,%rdx
+  8010bb:	49 0f 49 d4          	cmovns %r12,%rdx
+}
+  8010bf:	48 89 d0             	mov    %rdx,%rax
+  8010c2:	48 83 c4 18          	add    $0x18,%rsp
+  8010c6:	5b                   	pop    %rbx
+  8010c7:	41 5c                	pop    %r12
+  8010c9:	41 5d                	pop    %r13
+  8010cb:	41 5e                	pop    %r14
+  8010cd:	41 5f                	pop    %r15
+  8010cf:	5d                   	pop    %rbp
+  8010d0:	c3                   	ret
+    while (n > sizeof(fsipcbuf.write.req_buf))
+  8010d1:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+    ssize_t written = 0;
+  8010d5:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8010db:	eb 98                	jmp    801075 <devfile_write+0xb0>
+
+00000000008010dd <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  8010dd:	55                   	push   %rbp
+  8010de:	48 89 e5             	mov    %rsp,%rbp
+  8010e1:	41 57                	push   %r15
+  8010e3:	41 56                	push   %r14
+  8010e5:	41 55                	push   %r13
+  8010e7:	41 54                	push   %r12
+  8010e9:	53                   	push   %rbx
+  8010ea:	48 83 ec 18          	sub    $0x18,%rsp
+  8010ee:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  8010f2:	49 89 f6             	mov    %rsi,%r14
+  8010f5:	49 89 d4             	mov    %rdx,%r12
+    while (n > sizeof(fsipcbuf.readRet.ret_buf))
+  8010f8:	48 81 fa 00 10 00 00 	cmp    $0x1000,%rdx
+  8010ff:	0f 86 ea 00 00 00    	jbe    8011ef <devfile_read+0x112>
+    ssize_t readsz = 0;
+  801105:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  80110c:	00 
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  80110d:	49 bf 00 60 80 00 00 	movabs $0x806000,%r15
+  801114:	00 00 00 
+  801117:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80111b:	8b 40 0c             	mov    0xc(%rax),%eax
+  80111e:	41 89 07             	mov    %eax,(%r15)
+        fsipcbuf.read.req_n = sizeof(fsipcbuf.readRet.ret_buf);
+  801121:	49 c7 47 08 00 10 00 	movq   $0x1000,0x8(%r15)
+  801128:	00 
+        ssize_t res = fsipc(FSREQ_READ, NULL);
+  801129:	be 00 00 00 00       	mov    $0x0,%esi
+  80112e:	bf 03 00 00 00       	mov    $0x3,%edi
+  801133:	48 b8 63 0e 80 00 00 	movabs $0x800e63,%rax
+  80113a:	00 00 00 
+  80113d:	ff d0                	call   *%rax
+  80113f:	4c 63 e8             	movslq %eax,%r13
+        if (res < 0)
+  801142:	4d 85 ed             	test   %r13,%r13
+  801145:	0f 88 92 00 00 00    	js     8011dd <devfile_read+0x100>
+        memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  80114b:	4c 89 ea             	mov    %r13,%rdx
+  80114e:	4c 89 fe             	mov    %r15,%rsi
+  801151:	4c 89 f7             	mov    %r14,%rdi
+  801154:	48 b8 61 29 80 00 00 	movabs $0x802961,%rax
+  80115b:	00 00 00 
+  80115e:	ff d0                	call   *%rax
+        if (res < sizeof(fsipcbuf.readRet.ret_buf))
+  801160:	49 81 fd ff 0f 00 00 	cmp    $0xfff,%r13
+  801167:	76 6d                	jbe    8011d6 <devfile_read+0xf9>
+        readsz += res;
+  801169:	4c 01 6d c0          	add    %r13,-0x40(%rbp)
+        buf += res;
+  80116d:	4d 01 ee             	add    %r13,%r14
+        n -= res;
+  801170:	4d 29 ec             	sub    %r13,%r12
+    while (n > sizeof(fsipcbuf.readRet.ret_buf))
+  801173:	49 81 fc 00 10 00 00 	cmp    $0x1000,%r12
+  80117a:	77 9b                	ja     801117 <devfile_read+0x3a>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  80117c:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  801183:	00 00 00 
+  801186:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  80118a:	8b 51 0c             	mov    0xc(%rcx),%edx
+  80118d:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.read.req_n = n;
+  80118f:	4c 89 60 08          	mov    %r12,0x8(%rax)
+    ssize_t res = fsipc(FSREQ_READ, NULL);
+  801193:	be 00 00 00 00       	mov    $0x0,%esi
+  801198:	bf 03 00 00 00       	mov    $0x3,%edi
+  80119d:	48 b8 63 0e 80 00 00 	movabs $0x800e63,%rax
+  8011a4:	00 00 00 
+  8011a7:	ff d0                	call   *%rax
+  8011a9:	4c 63 e8             	movslq %eax,%r13
+    if (res < 0)
+  8011ac:	4d 85 ed             	test   %r13,%r13
+  8011af:	78 2c                	js     8011dd <devfile_read+0x100>
+    memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  8011b1:	4c 89 ea             	mov    %r13,%rdx
+  8011b4:	48 be 00 60 80 00 00 	movabs $0x806000,%rsi
+  8011bb:	00 00 00 
+  8011be:	4c 89 f7             	mov    %r14,%rdi
+  8011c1:	48 b8 61 29 80 00 00 	movabs $0x802961,%rax
+  8011c8:	00 00 00 
+  8011cb:	ff d0                	call   *%rax
+    readsz += res;
+  8011cd:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8011d1:	49 01 c5             	add    %rax,%r13
+    return readsz;
+  8011d4:	eb 07                	jmp    8011dd <devfile_read+0x100>
+            return readsz + res;
+  8011d6:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8011da:	49 01 c5             	add    %rax,%r13
+}
+  8011dd:	4c 89 e8             	mov    %r13,%rax
+  8011e0:	48 83 c4 18          	add    $0x18,%rsp
+  8011e4:	5b                   	pop    %rbx
+  8011e5:	41 5c                	pop    %r12
+  8011e7:	41 5d                	pop    %r13
+  8011e9:	41 5e                	pop    %r14
+  8011eb:	41 5f                	pop    %r15
+  8011ed:	5d                   	pop    %rbp
+  8011ee:	c3                   	ret
+    ssize_t readsz = 0;
+  8011ef:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  8011f6:	00 
+  8011f7:	eb 83                	jmp    80117c <devfile_read+0x9f>
+
+00000000008011f9 <open>:
+open(const char *path, int mode) {
+  8011f9:	55                   	push   %rbp
+  8011fa:	48 89 e5             	mov    %rsp,%rbp
+  8011fd:	41 55                	push   %r13
+  8011ff:	41 54                	push   %r12
+  801201:	53                   	push   %rbx
+  801202:	48 83 ec 18          	sub    $0x18,%rsp
+  801206:	49 89 fc             	mov    %rdi,%r12
+  801209:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  80120c:	48 b8 c2 26 80 00 00 	movabs $0x8026c2,%rax
+  801213:	00 00 00 
+  801216:	ff d0                	call   *%rax
+  801218:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  80121e:	0f 87 8a 00 00 00    	ja     8012ae <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  801224:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  801228:	48 b8 dc 07 80 00 00 	movabs $0x8007dc,%rax
+  80122f:	00 00 00 
+  801232:	ff d0                	call   *%rax
+  801234:	89 c3                	mov    %eax,%ebx
+  801236:	85 c0                	test   %eax,%eax
+  801238:	78 50                	js     80128a <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  80123a:	4c 89 e6             	mov    %r12,%rsi
+  80123d:	48 bb 00 60 80 00 00 	movabs $0x806000,%rbx
+  801244:	00 00 00 
+  801247:	48 89 df             	mov    %rbx,%rdi
+  80124a:	48 b8 00 27 80 00 00 	movabs $0x802700,%rax
+  801251:	00 00 00 
+  801254:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  801256:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  80125d:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  801261:	bf 01 00 00 00       	mov    $0x1,%edi
+  801266:	48 b8 63 0e 80 00 00 	movabs $0x800e63,%rax
+  80126d:	00 00 00 
+  801270:	ff d0                	call   *%rax
+  801272:	89 c3                	mov    %eax,%ebx
+  801274:	85 c0                	test   %eax,%eax
+  801276:	78 1f                	js     801297 <open+0x9e>
+    return fd2num(fd);
+  801278:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80127c:	48 b8 35 07 80 00 00 	movabs $0x800735,%rax
+  801283:	00 00 00 
+  801286:	ff d0                	call   *%rax
+  801288:	89 c3                	mov    %eax,%ebx
+}
+  80128a:	89 d8                	mov    %ebx,%eax
+  80128c:	48 83 c4 18          	add    $0x18,%rsp
+  801290:	5b                   	pop    %rbx
+  801291:	41 5c                	pop    %r12
+  801293:	41 5d                	pop    %r13
+  801295:	5d                   	pop    %rbp
+  801296:	c3                   	ret
+        fd_close(fd, 0);
+  801297:	be 00 00 00 00       	mov    $0x0,%esi
+  80129c:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8012a0:	48 b8 b1 08 80 00 00 	movabs $0x8008b1,%rax
+  8012a7:	00 00 00 
+  8012aa:	ff d0                	call   *%rax
+        return res;
+  8012ac:	eb dc                	jmp    80128a <open+0x91>
+        return -E_BAD_PATH;
+  8012ae:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  8012b3:	eb d5                	jmp    80128a <open+0x91>
+
+00000000008012b5 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  8012b5:	55                   	push   %rbp
+  8012b6:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc(FSREQ_SYNC, NULL);
+  8012b9:	be 00 00 00 00       	mov    $0x0,%esi
+  8012be:	bf 08 00 00 00       	mov    $0x8,%edi
+  8012c3:	48 b8 63 0e 80 00 00 	movabs $0x800e63,%rax
+  8012ca:	00 00 00 
+  8012cd:	ff d0                	call   *%rax
+}
+  8012cf:	5d                   	pop    %rbp
+  8012d0:	c3                   	ret
+
+00000000008012d1 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  8012d1:	55                   	push   %rbp
+  8012d2:	48 89 e5             	mov    %rsp,%rbp
+  8012d5:	41 54                	push   %r12
+  8012d7:	53                   	push   %rbx
+  8012d8:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8012db:	48 b8 47 07 80 00 00 	movabs $0x800747,%rax
+  8012e2:	00 00 00 
+  8012e5:	ff d0                	call   *%rax
+  8012e7:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  8012ea:	48 be 60 30 80 00 00 	movabs $0x803060,%rsi
+  8012f1:	00 00 00 
+  8012f4:	48 89 df             	mov    %rbx,%rdi
+  8012f7:	48 b8 00 27 80 00 00 	movabs $0x802700,%rax
+  8012fe:	00 00 00 
+  801301:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  801303:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  801308:	41 2b 04 24          	sub    (%r12),%eax
+  80130c:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  801312:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  801319:	00 00 00 
+    stat->st_dev = &devpipe;
+  80131c:	48 b8 60 40 80 00 00 	movabs $0x804060,%rax
+  801323:	00 00 00 
+  801326:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  80132d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801332:	5b                   	pop    %rbx
+  801333:	41 5c                	pop    %r12
+  801335:	5d                   	pop    %rbp
+  801336:	c3                   	ret
+
+0000000000801337 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  801337:	55                   	push   %rbp
+  801338:	48 89 e5             	mov    %rsp,%rbp
+  80133b:	41 54                	push   %r12
+  80133d:	53                   	push   %rbx
+  80133e:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801341:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801346:	48 89 fe             	mov    %rdi,%rsi
+  801349:	bf 00 00 00 00       	mov    $0x0,%edi
+  80134e:	49 bc 72 03 80 00 00 	movabs $0x800372,%r12
+  801355:	00 00 00 
+  801358:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  80135b:	48 89 df             	mov    %rbx,%rdi
+  80135e:	48 b8 47 07 80 00 00 	movabs $0x800747,%rax
+  801365:	00 00 00 
+  801368:	ff d0                	call   *%rax
+  80136a:	48 89 c6             	mov    %rax,%rsi
+  80136d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801372:	bf 00 00 00 00       	mov    $0x0,%edi
+  801377:	41 ff d4             	call   *%r12
+}
+  80137a:	5b                   	pop    %rbx
+  80137b:	41 5c                	pop    %r12
+  80137d:	5d                   	pop    %rbp
+  80137e:	c3                   	ret
+
+000000000080137f <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  80137f:	55                   	push   %rbp
+  801380:	48 89 e5             	mov    %rsp,%rbp
+  801383:	41 57                	push   %r15
+  801385:	41 56                	push   %r14
+  801387:	41 55                	push   %r13
+  801389:	41 54                	push   %r12
+  80138b:	53                   	push   %rbx
+  80138c:	48 83 ec 18          	sub    $0x18,%rsp
+  801390:	49 89 fc             	mov    %rdi,%r12
+  801393:	49 89 f5             	mov    %rsi,%r13
+  801396:	49 89 d7             	mov    %rdx,%r15
+  801399:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80139d:	48 b8 47 07 80 00 00 	movabs $0x800747,%rax
+  8013a4:	00 00 00 
+  8013a7:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  8013a9:	4d 85 ff             	test   %r15,%r15
+  8013ac:	0f 84 af 00 00 00    	je     801461 <devpipe_write+0xe2>
+  8013b2:	48 89 c3             	mov    %rax,%rbx
+  8013b5:	4c 89 f8             	mov    %r15,%rax
+  8013b8:	4d 89 ef             	mov    %r13,%r15
+  8013bb:	4c 01 e8             	add    %r13,%rax
+  8013be:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8013c2:	49 bd 7a 02 80 00 00 	movabs $0x80027a,%r13
+  8013c9:	00 00 00 
+            sys_yield();
+  8013cc:	49 be 17 02 80 00 00 	movabs $0x800217,%r14
+  8013d3:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  8013d6:	8b 73 04             	mov    0x4(%rbx),%esi
+  8013d9:	48 63 ce             	movslq %esi,%rcx
+  8013dc:	48 63 03             	movslq (%rbx),%rax
+  8013df:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  8013e5:	48 39 c1             	cmp    %rax,%rcx
+  8013e8:	72 2e                	jb     801418 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8013ea:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8013ef:	48 89 da             	mov    %rbx,%rdx
+  8013f2:	be 00 10 00 00       	mov    $0x1000,%esi
+  8013f7:	4c 89 e7             	mov    %r12,%rdi
+  8013fa:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  8013fd:	85 c0                	test   %eax,%eax
+  8013ff:	74 66                	je     801467 <devpipe_write+0xe8>
+            sys_yield();
+  801401:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  801404:	8b 73 04             	mov    0x4(%rbx),%esi
+  801407:	48 63 ce             	movslq %esi,%rcx
+  80140a:	48 63 03             	movslq (%rbx),%rax
+  80140d:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  801413:	48 39 c1             	cmp    %rax,%rcx
+  801416:	73 d2                	jae    8013ea <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  801418:	41 0f b6 3f          	movzbl (%r15),%edi
+  80141c:	48 89 ca             	mov    %rcx,%rdx
+  80141f:	48 c1 ea 03          	shr    $0x3,%rdx
+  801423:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  80142a:	08 10 20 
+  80142d:	48 f7 e2             	mul    %rdx
+  801430:	48 c1 ea 06          	shr    $0x6,%rdx
+  801434:	48 89 d0             	mov    %rdx,%rax
+  801437:	48 c1 e0 09          	shl    $0x9,%rax
+  80143b:	48 29 d0             	sub    %rdx,%rax
+  80143e:	48 c1 e0 03          	shl    $0x3,%rax
+  801442:	48 29 c1             	sub    %rax,%rcx
+  801445:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  80144a:	83 c6 01             	add    $0x1,%esi
+  80144d:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  801450:	49 83 c7 01          	add    $0x1,%r15
+  801454:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801458:	49 39 c7             	cmp    %rax,%r15
+  80145b:	0f 85 75 ff ff ff    	jne    8013d6 <devpipe_write+0x57>
+    return n;
+  801461:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  801465:	eb 05                	jmp    80146c <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  801467:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80146c:	48 83 c4 18          	add    $0x18,%rsp
+  801470:	5b                   	pop    %rbx
+  801471:	41 5c                	pop    %r12
+  801473:	41 5d                	pop    %r13
+  801475:	41 5e                	pop    %r14
+  801477:	41 5f                	pop    %r15
+  801479:	5d                   	pop    %rbp
+  80147a:	c3                   	ret
+
+000000000080147b <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  80147b:	55                   	push   %rbp
+  80147c:	48 89 e5             	mov    %rsp,%rbp
+  80147f:	41 57                	push   %r15
+  801481:	41 56                	push   %r14
+  801483:	41 55                	push   %r13
+  801485:	41 54                	push   %r12
+  801487:	53                   	push   %rbx
+  801488:	48 83 ec 18          	sub    $0x18,%rsp
+  80148c:	49 89 fc             	mov    %rdi,%r12
+  80148f:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  801493:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  801497:	48 b8 47 07 80 00 00 	movabs $0x800747,%rax
+  80149e:	00 00 00 
+  8014a1:	ff d0                	call   *%rax
+  8014a3:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  8014a6:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8014ac:	49 bd 7a 02 80 00 00 	movabs $0x80027a,%r13
+  8014b3:	00 00 00 
+            sys_yield();
+  8014b6:	49 be 17 02 80 00 00 	movabs $0x800217,%r14
+  8014bd:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  8014c0:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  8014c5:	74 7d                	je     801544 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  8014c7:	8b 03                	mov    (%rbx),%eax
+  8014c9:	3b 43 04             	cmp    0x4(%rbx),%eax
+  8014cc:	75 26                	jne    8014f4 <devpipe_read+0x79>
+            if (i > 0) return i;
+  8014ce:	4d 85 ff             	test   %r15,%r15
+  8014d1:	75 77                	jne    80154a <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8014d3:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8014d8:	48 89 da             	mov    %rbx,%rdx
+  8014db:	be 00 10 00 00       	mov    $0x1000,%esi
+  8014e0:	4c 89 e7             	mov    %r12,%rdi
+  8014e3:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  8014e6:	85 c0                	test   %eax,%eax
+  8014e8:	74 72                	je     80155c <devpipe_read+0xe1>
+            sys_yield();
+  8014ea:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  8014ed:	8b 03                	mov    (%rbx),%eax
+  8014ef:	3b 43 04             	cmp    0x4(%rbx),%eax
+  8014f2:	74 df                	je     8014d3 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  8014f4:	48 63 c8             	movslq %eax,%rcx
+  8014f7:	48 89 ca             	mov    %rcx,%rdx
+  8014fa:	48 c1 ea 03          	shr    $0x3,%rdx
+  8014fe:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  801505:	08 10 20 
+  801508:	48 89 d0             	mov    %rdx,%rax
+  80150b:	48 f7 e6             	mul    %rsi
+  80150e:	48 c1 ea 06          	shr    $0x6,%rdx
+  801512:	48 89 d0             	mov    %rdx,%rax
+  801515:	48 c1 e0 09          	shl    $0x9,%rax
+  801519:	48 29 d0             	sub    %rdx,%rax
+  80151c:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  801523:	00 
+  801524:	48 89 c8             	mov    %rcx,%rax
+  801527:	48 29 d0             	sub    %rdx,%rax
+  80152a:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  80152f:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  801533:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  801537:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  80153a:	49 83 c7 01          	add    $0x1,%r15
+  80153e:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  801542:	75 83                	jne    8014c7 <devpipe_read+0x4c>
+    return n;
+  801544:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801548:	eb 03                	jmp    80154d <devpipe_read+0xd2>
+            if (i > 0) return i;
+  80154a:	4c 89 f8             	mov    %r15,%rax
+}
+  80154d:	48 83 c4 18          	add    $0x18,%rsp
+  801551:	5b                   	pop    %rbx
+  801552:	41 5c                	pop    %r12
+  801554:	41 5d                	pop    %r13
+  801556:	41 5e                	pop    %r14
+  801558:	41 5f                	pop    %r15
+  80155a:	5d                   	pop    %rbp
+  80155b:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  80155c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801561:	eb ea                	jmp    80154d <devpipe_read+0xd2>
+
+0000000000801563 <pipe>:
+pipe(int pfd[2]) {
+  801563:	55                   	push   %rbp
+  801564:	48 89 e5             	mov    %rsp,%rbp
+  801567:	41 55                	push   %r13
+  801569:	41 54                	push   %r12
+  80156b:	53                   	push   %rbx
+  80156c:	48 81 ec b8 00 00 00 	sub    $0xb8,%rsp
+  801573:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  801576:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  80157a:	48 b8 dc 07 80 00 00 	movabs $0x8007dc,%rax
+  801581:	00 00 00 
+  801584:	ff d0                	call   *%rax
+  801586:	89 c3                	mov    %eax,%ebx
+  801588:	85 c0                	test   %eax,%eax
+  80158a:	0f 88 51 01 00 00    	js     8016e1 <pipe+0x17e>
+        (res = fd_alloc_from(fd2num(fd0) + 1, &fd1)) < 0) goto err;
+  801590:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  801594:	48 b8 35 07 80 00 00 	movabs $0x800735,%rax
+  80159b:	00 00 00 
+  80159e:	ff d0                	call   *%rax
+  8015a0:	8d 78 01             	lea    0x1(%rax),%edi
+  8015a3:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8015a7:	48 b8 63 07 80 00 00 	movabs $0x800763,%rax
+  8015ae:	00 00 00 
+  8015b1:	ff d0                	call   *%rax
+  8015b3:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8015b5:	85 c0                	test   %eax,%eax
+  8015b7:	0f 88 24 01 00 00    	js     8016e1 <pipe+0x17e>
+    va = fd2data(fd0);
+  8015bd:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8015c1:	48 bb 47 07 80 00 00 	movabs $0x800747,%rbx
+  8015c8:	00 00 00 
+  8015cb:	ff d3                	call   *%rbx
+  8015cd:	49 89 c5             	mov    %rax,%r13
+    struct RegionOp ops[] = {
+  8015d0:	48 8d bd 30 ff ff ff 	lea    -0xd0(%rbp),%rdi
+  8015d7:	b9 14 00 00 00       	mov    $0x14,%ecx
+  8015dc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015e1:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+  8015e4:	c7 85 34 ff ff ff 46 	movl   $0x46,-0xcc(%rbp)
+  8015eb:	00 00 00 
+  8015ee:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8015f2:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+  8015f9:	48 c7 85 50 ff ff ff 	movq   $0x1000,-0xb0(%rbp)
+  801600:	00 10 00 00 
+  801604:	c7 85 5c ff ff ff 46 	movl   $0x46,-0xa4(%rbp)
+  80160b:	00 00 00 
+            {.type = REGION_ALLOC, .dstva = (uintptr_t)fd1, .size = PAGE_SIZE, .perm = PROT_RW | PROT_SHARE},
+  80160e:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+    struct RegionOp ops[] = {
+  801612:	48 89 bd 70 ff ff ff 	mov    %rdi,-0x90(%rbp)
+  801619:	48 c7 85 78 ff ff ff 	movq   $0x1000,-0x88(%rbp)
+  801620:	00 10 00 00 
+  801624:	c7 45 84 46 00 00 00 	movl   $0x46,-0x7c(%rbp)
+  80162b:	4c 89 6d 98          	mov    %r13,-0x68(%rbp)
+  80162f:	48 c7 45 a0 00 10 00 	movq   $0x1000,-0x60(%rbp)
+  801636:	00 
+  801637:	c7 45 a8 01 00 00 00 	movl   $0x1,-0x58(%rbp)
+  80163e:	c7 45 ac 46 00 00 00 	movl   $0x46,-0x54(%rbp)
+  801645:	4c 89 6d b8          	mov    %r13,-0x48(%rbp)
+            {.type = REGION_MAP, .srcva = (uintptr_t)va, .dstva = (uintptr_t)fd2data(fd1), .size = PAGE_SIZE, .perm = PROT_RW | PROT_SHARE},
+  801649:	ff d3                	call   *%rbx
+    struct RegionOp ops[] = {
+  80164b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80164f:	48 c7 45 c8 00 10 00 	movq   $0x1000,-0x38(%rbp)
+  801656:	00 
+    if ((res = sys_region_batch(ops, sizeof ops / sizeof *ops)) < 0) goto err1;
+  801657:	be 04 00 00 00       	mov    $0x4,%esi
+  80165c:	48 8d bd 30 ff ff ff 	lea    -0xd0(%rbp),%rdi
+  801663:	48 b8 d9 03 80 00 00 	movabs $0x8003d9,%rax
+  80166a:	00 00 00 
+  80166d:	ff d0                	call   *%rax
+  80166f:	89 c3                	mov    %eax,%ebx
+  801671:	85 c0                	test   %eax,%eax
+  801673:	0f 88 ad 00 00 00    	js     801726 <pipe+0x1c3>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  801679:	be 00 10 00 00       	mov    $0x1000,%esi
+  80167e:	4c 89 ef             	mov    %r13,%rdi
+  801681:	48 b8 48 02 80 00 00 	movabs $0x800248,%rax
+  801688:	00 00 00 
+  80168b:	ff d0                	call   *%rax
+  80168d:	83 f8 02             	cmp    $0x2,%eax
+  801690:	75 5f                	jne    8016f1 <pipe+0x18e>
+    fd0->fd_dev_id = devpipe.dev_id;
+  801692:	a1 60 40 80 00 00 00 	movabs 0x804060,%eax
+  801699:	00 00 
+  80169b:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80169f:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  8016a1:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8016a5:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  8016ac:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8016b0:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  8016b2:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8016b6:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  8016bd:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8016c1:	48 bb 35 07 80 00 00 	movabs $0x800735,%rbx
+  8016c8:	00 00 00 
+  8016cb:	ff d3                	call   *%rbx
+  8016cd:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  8016d1:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  8016d5:	ff d3                	call   *%rbx
+  8016d7:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  8016dc:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  8016e1:	89 d8                	mov    %ebx,%eax
+  8016e3:	48 81 c4 b8 00 00 00 	add    $0xb8,%rsp
+  8016ea:	5b                   	pop    %rbx
+  8016eb:	41 5c                	pop    %r12
+  8016ed:	41 5d                	pop    %r13
+  8016ef:	5d                   	pop    %rbp
+  8016f0:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8016f1:	48 b9 90 30 80 00 00 	movabs $0x803090,%rcx
+  8016f8:	00 00 00 
+  8016fb:	48 ba 67 30 80 00 00 	movabs $0x803067,%rdx
+  801702:	00 00 00 
+  801705:	be 33 00 00 00       	mov    $0x33,%esi
+  80170a:	48 bf 7c 30 80 00 00 	movabs $0x80307c,%rdi
+  801711:	00 00 00 
+  801714:	b8 00 00 00 00       	mov    $0x0,%eax
+  801719:	49 b8 8b 1c 80 00 00 	movabs $0x801c8b,%r8
+  801720:	00 00 00 
+  801723:	41 ff d0             	call   *%r8
+        ops[i].type = REGION_UNMAP;
+  801726:	c7 85 30 ff ff ff 02 	movl   $0x2,-0xd0(%rbp)
+  80172d:	00 00 00 
+  801730:	c7 85 58 ff ff ff 02 	movl   $0x2,-0xa8(%rbp)
+  801737:	00 00 00 
+  80173a:	c7 45 80 02 00 00 00 	movl   $0x2,-0x80(%rbp)
+  801741:	c7 45 a8 02 00 00 00 	movl   $0x2,-0x58(%rbp)
+    sys_region_batch(ops, sizeof ops / sizeof *ops);
+  801748:	be 04 00 00 00       	mov    $0x4,%esi
+  80174d:	48 8d bd 30 ff ff ff 	lea    -0xd0(%rbp),%rdi
+  801754:	48 b8 d9 03 80 00 00 	movabs $0x8003d9,%rax
+  80175b:	00 00 00 
+  80175e:	ff d0                	call   *%rax
+  801760:	e9 7c ff ff ff       	jmp    8016e1 <pipe+0x17e>
+
+0000000000801765 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  801765:	55                   	push   %rbp
+  801766:	48 89 e5             	mov    %rsp,%rbp
+  801769:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  80176d:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801771:	48 b8 f6 07 80 00 00 	movabs $0x8007f6,%rax
+  801778:	00 00 00 
+  80177b:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80177d:	85 c0                	test   %eax,%eax
+  80177f:	78 35                	js     8017b6 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  801781:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801785:	48 b8 47 07 80 00 00 	movabs $0x800747,%rax
+  80178c:	00 00 00 
+  80178f:	ff d0                	call   *%rax
+  801791:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  801794:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  801799:	be 00 10 00 00       	mov    $0x1000,%esi
+  80179e:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8017a2:	48 b8 7a 02 80 00 00 	movabs $0x80027a,%rax
+  8017a9:	00 00 00 
+  8017ac:	ff d0                	call   *%rax
+  8017ae:	85 c0                	test   %eax,%eax
+  8017b0:	0f 94 c0             	sete   %al
+  8017b3:	0f b6 c0             	movzbl %al,%eax
+}
+  8017b6:	c9                   	leave
+  8017b7:	c3                   	ret
+
+00000000008017b8 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8017b8:	48 89 f8             	mov    %rdi,%rax
+  8017bb:	48 c1 e8 27          	shr    $0x27,%rax
+  8017bf:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  8017c6:	01 00 00 
+  8017c9:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8017cd:	f6 c2 01             	test   $0x1,%dl
+  8017d0:	74 6d                	je     80183f <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8017d2:	48 89 f8             	mov    %rdi,%rax
+  8017d5:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8017d9:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8017e0:	01 00 00 
+  8017e3:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8017e7:	f6 c2 01             	test   $0x1,%dl
+  8017ea:	74 62                	je     80184e <get_uvpt_entry+0x96>
+  8017ec:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8017f3:	01 00 00 
+  8017f6:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8017fa:	f6 c2 80             	test   $0x80,%dl
+  8017fd:	75 4f                	jne    80184e <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8017ff:	48 89 f8             	mov    %rdi,%rax
+  801802:	48 c1 e8 15          	shr    $0x15,%rax
+  801806:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  80180d:	01 00 00 
+  801810:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  801814:	f6 c2 01             	test   $0x1,%dl
+  801817:	74 44                	je     80185d <get_uvpt_entry+0xa5>
+  801819:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  801820:	01 00 00 
+  801823:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  801827:	f6 c2 80             	test   $0x80,%dl
+  80182a:	75 31                	jne    80185d <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  80182c:	48 c1 ef 0c          	shr    $0xc,%rdi
+  801830:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  801837:	01 00 00 
+  80183a:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  80183e:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  80183f:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  801846:	01 00 00 
+  801849:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80184d:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  80184e:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  801855:	01 00 00 
+  801858:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80185c:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  80185d:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  801864:	01 00 00 
+  801867:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80186b:	c3                   	ret
+
+000000000080186c <get_prot>:
+
+int
+get_prot(void *va) {
+  80186c:	55                   	push   %rbp
+  80186d:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  801870:	48 b8 b8 17 80 00 00 	movabs $0x8017b8,%rax
+  801877:	00 00 00 
+  80187a:	ff d0                	call   *%rax
+  80187c:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  80187f:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  801884:	89 c1                	mov    %eax,%ecx
+  801886:	83 c9 04             	or     $0x4,%ecx
+  801889:	f6 c2 01             	test   $0x1,%dl
+  80188c:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  80188f:	89 c1                	mov    %eax,%ecx
+  801891:	83 c9 02             	or     $0x2,%ecx
+  801894:	f6 c2 02             	test   $0x2,%dl
+  801897:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  80189a:	89 c1                	mov    %eax,%ecx
+  80189c:	83 c9 01             	or     $0x1,%ecx
+  80189f:	48 85 d2             	test   %rdx,%rdx
+  8018a2:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  8018a5:	89 c1                	mov    %eax,%ecx
+  8018a7:	83 c9 40             	or     $0x40,%ecx
+  8018aa:	f6 c6 04             	test   $0x4,%dh
+  8018ad:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  8018b0:	5d                   	pop    %rbp
+  8018b1:	c3                   	ret
+
+00000000008018b2 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  8018b2:	55                   	push   %rbp
+  8018b3:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8018b6:	48 b8 b8 17 80 00 00 	movabs $0x8017b8,%rax
+  8018bd:	00 00 00 
+  8018c0:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  8018c2:	48 c1 e8 06          	shr    $0x6,%rax
+  8018c6:	83 e0 01             	and    $0x1,%eax
+}
+  8018c9:	5d                   	pop    %rbp
+  8018ca:	c3                   	ret
+
+00000000008018cb <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  8018cb:	55                   	push   %rbp
+  8018cc:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  8018cf:	48 b8 b8 17 80 00 00 	movabs $0x8017b8,%rax
+  8018d6:	00 00 00 
+  8018d9:	ff d0                	call   *%rax
+  8018db:	83 e0 01             	and    $0x1,%eax
+}
+  8018de:	5d                   	pop    %rbp
+  8018df:	c3                   	ret
+
+00000000008018e0 <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  8018e0:	55                   	push   %rbp
+  8018e1:	48 89 e5             	mov    %rsp,%rbp
+  8018e4:	41 57                	push   %r15
+  8018e6:	41 56                	push   %r14
+  8018e8:	41 55                	push   %r13
+  8018ea:	41 54                	push   %r12
+  8018ec:	53                   	push   %rbx
+  8018ed:	48 83 ec 38          	sub    $0x38,%rsp
+  8018f1:	49 89 f7             	mov    %rsi,%r15
+  8018f4:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+                    }
+                    continue;
+                }
+                for (int ptei = 0; ptei < PT_ENTRY_COUNT; ptei++) {
+                    uintptr_t pte_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, pdei, ptei, 0);
+                    pte_t pte = uvpt[VPT(pte_addr)];
+  8018fa:	49 bd 00 00 00 00 00 	movabs $0x10000000000,%r13
+  801901:	01 00 00 
+  801904:	4d 89 e6             	mov    %r12,%r14
+  801907:	49 89 fc             	mov    %rdi,%r12
+  80190a:	e9 19 01 00 00       	jmp    801a28 <foreach_shared_region+0x148>
+  80190f:	48 89 5d b0          	mov    %rbx,-0x50(%rbp)
+  801913:	4c 89 75 a8          	mov    %r14,-0x58(%rbp)
+  801917:	eb 52                	jmp    80196b <foreach_shared_region+0x8b>
+                for (int ptei = 0; ptei < PT_ENTRY_COUNT; ptei++) {
+  801919:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801920:	48 81 fb 00 00 20 00 	cmp    $0x200000,%rbx
+  801927:	74 2e                	je     801957 <foreach_shared_region+0x77>
+                    uintptr_t pte_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, pdei, ptei, 0);
+  801929:	48 89 df             	mov    %rbx,%rdi
+  80192c:	4c 09 f7             	or     %r14,%rdi
+                    pte_t pte = uvpt[VPT(pte_addr)];
+  80192f:	48 89 f8             	mov    %rdi,%rax
+  801932:	48 c1 e8 0c          	shr    $0xc,%rax
+  801936:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+                    if ((pte & PTE_P) && (pte & PTE_SHARE)) {
+  80193b:	25 01 04 00 00       	and    $0x401,%eax
+  801940:	48 3d 01 04 00 00    	cmp    $0x401,%rax
+  801946:	75 d1                	jne    801919 <foreach_shared_region+0x39>
+                        fun((void*)pte_addr, (void*)(pte_addr + PAGE_SIZE), arg);
+  801948:	48 8d b7 00 10 00 00 	lea    0x1000(%rdi),%rsi
+  80194f:	4c 89 fa             	mov    %r15,%rdx
+  801952:	41 ff d4             	call   *%r12
+  801955:	eb c2                	jmp    801919 <foreach_shared_region+0x39>
+            for (int pdei = 0; pdei < PD_ENTRY_COUNT; pdei++) {
+  801957:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  80195e:	00 
+  80195f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801963:	48 3d 00 00 00 40    	cmp    $0x40000000,%rax
+  801969:	74 46                	je     8019b1 <foreach_shared_region+0xd1>
+                uintptr_t pde_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, pdei, 0, 0);
+  80196b:	4c 8b 75 c8          	mov    -0x38(%rbp),%r14
+  80196f:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  801973:	49 09 c6             	or     %rax,%r14
+                pde_t pde = uvpd[VPD(pde_addr)];
+  801976:	4c 89 f0             	mov    %r14,%rax
+  801979:	48 c1 e8 15          	shr    $0x15,%rax
+  80197d:	48 b9 00 00 00 80 00 	movabs $0x10080000000,%rcx
+  801984:	01 00 00 
+  801987:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+                if (!(pde & PTE_P)) {
+  80198b:	a8 01                	test   $0x1,%al
+  80198d:	74 c8                	je     801957 <foreach_shared_region+0x77>
+                if (pde & PTE_PS) {
+  80198f:	48 89 c3             	mov    %rax,%rbx
+  801992:	81 e3 80 00 00 00    	and    $0x80,%ebx
+  801998:	74 8f                	je     801929 <foreach_shared_region+0x49>
+                    if (pde & PTE_SHARE) {
+  80199a:	f6 c4 04             	test   $0x4,%ah
+  80199d:	74 b8                	je     801957 <foreach_shared_region+0x77>
+                        fun((void*)pde_addr, (void*)(pde_addr + 1024 * 1024 * 2), arg);
+  80199f:	49 8d b6 00 00 20 00 	lea    0x200000(%r14),%rsi
+  8019a6:	4c 89 fa             	mov    %r15,%rdx
+  8019a9:	4c 89 f7             	mov    %r14,%rdi
+  8019ac:	41 ff d4             	call   *%r12
+  8019af:	eb a6                	jmp    801957 <foreach_shared_region+0x77>
+  8019b1:	48 8b 5d b0          	mov    -0x50(%rbp),%rbx
+  8019b5:	4c 8b 75 a8          	mov    -0x58(%rbp),%r14
+        for (int pdpei = 0; pdpei < PDP_ENTRY_COUNT; pdpei++) {
+  8019b9:	48 81 c3 00 00 00 40 	add    $0x40000000,%rbx
+  8019c0:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8019c7:	00 00 00 
+  8019ca:	48 39 c3             	cmp    %rax,%rbx
+  8019cd:	74 4c                	je     801a1b <foreach_shared_region+0x13b>
+            uintptr_t pdpe_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, 0, 0, 0);
+  8019cf:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  8019d3:	48 09 d8             	or     %rbx,%rax
+  8019d6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+            pdpe_t pdpe = uvpdp[VPDP(pdpe_addr)];
+  8019da:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8019de:	48 b9 00 00 40 80 00 	movabs $0x10080400000,%rcx
+  8019e5:	01 00 00 
+  8019e8:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+            if (!(pdpe & PTE_P)) {
+  8019ec:	a8 01                	test   $0x1,%al
+  8019ee:	74 c9                	je     8019b9 <foreach_shared_region+0xd9>
+            if (pdpe & PTE_PS) {
+  8019f0:	48 89 c1             	mov    %rax,%rcx
+  8019f3:	81 e1 80 00 00 00    	and    $0x80,%ecx
+  8019f9:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  8019fd:	0f 84 0c ff ff ff    	je     80190f <foreach_shared_region+0x2f>
+                if (pdpe & PTE_SHARE) {
+  801a03:	f6 c4 04             	test   $0x4,%ah
+  801a06:	74 b1                	je     8019b9 <foreach_shared_region+0xd9>
+                    fun((void*)pdpe_addr, (void*)(pdpe_addr + 1024 * 1024 * 1024), arg); 
+  801a08:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  801a0c:	48 8d b7 00 00 00 40 	lea    0x40000000(%rdi),%rsi
+  801a13:	4c 89 fa             	mov    %r15,%rdx
+  801a16:	41 ff d4             	call   *%r12
+  801a19:	eb 9e                	jmp    8019b9 <foreach_shared_region+0xd9>
+    for (int pml4ei = 0; pml4ei < PML4_ENTRY_COUNT; pml4ei++) {
+  801a1b:	49 83 c6 01          	add    $0x1,%r14
+  801a1f:	49 81 fe 00 02 00 00 	cmp    $0x200,%r14
+  801a26:	74 24                	je     801a4c <foreach_shared_region+0x16c>
+        pml4e_t pml4e = uvpml4[VPML4(pml4_addr)];
+  801a28:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  801a2f:	01 00 00 
+  801a32:	4a 8b 04 f0          	mov    (%rax,%r14,8),%rax
+        if (!(pml4e & PTE_P)) {
+  801a36:	a8 01                	test   $0x1,%al
+  801a38:	74 e1                	je     801a1b <foreach_shared_region+0x13b>
+  801a3a:	4c 89 f0             	mov    %r14,%rax
+  801a3d:	48 c1 e0 27          	shl    $0x27,%rax
+  801a41:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  801a45:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a4a:	eb 83                	jmp    8019cf <foreach_shared_region+0xef>
+            }
+        }
+    }
+    
+    return 0;
+}
+  801a4c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a51:	48 83 c4 38          	add    $0x38,%rsp
+  801a55:	5b                   	pop    %rbx
+  801a56:	41 5c                	pop    %r12
+  801a58:	41 5d                	pop    %r13
+  801a5a:	41 5e                	pop    %r14
+  801a5c:	41 5f                	pop    %r15
+  801a5e:	5d                   	pop    %rbp
+  801a5f:	c3                   	ret
+
+0000000000801a60 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  801a60:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a65:	c3                   	ret
+
+0000000000801a66 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  801a66:	55                   	push   %rbp
+  801a67:	48 89 e5             	mov    %rsp,%rbp
+  801a6a:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  801a6d:	48 be b4 30 80 00 00 	movabs $0x8030b4,%rsi
+  801a74:	00 00 00 
+  801a77:	48 b8 00 27 80 00 00 	movabs $0x802700,%rax
+  801a7e:	00 00 00 
+  801a81:	ff d0                	call   *%rax
+    return 0;
+}
+  801a83:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a88:	5d                   	pop    %rbp
+  801a89:	c3                   	ret
+
+0000000000801a8a <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  801a8a:	55                   	push   %rbp
+  801a8b:	48 89 e5             	mov    %rsp,%rbp
+  801a8e:	41 57                	push   %r15
+  801a90:	41 56                	push   %r14
+  801a92:	41 55                	push   %r13
+  801a94:	41 54                	push   %r12
+  801a96:	53                   	push   %rbx
+  801a97:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  801a9e:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  801aa5:	48 85 d2             	test   %rdx,%rdx
+  801aa8:	74 7a                	je     801b24 <devcons_write+0x9a>
+  801aaa:	49 89 d6             	mov    %rdx,%r14
+  801aad:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  801ab3:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  801ab8:	49 bf fa 28 80 00 00 	movabs $0x8028fa,%r15
+  801abf:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  801ac2:	4c 89 f3             	mov    %r14,%rbx
+  801ac5:	48 29 f3             	sub    %rsi,%rbx
+  801ac8:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  801acd:	48 39 c3             	cmp    %rax,%rbx
+  801ad0:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  801ad4:	4c 63 eb             	movslq %ebx,%r13
+  801ad7:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  801ade:	48 01 c6             	add    %rax,%rsi
+  801ae1:	4c 89 ea             	mov    %r13,%rdx
+  801ae4:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  801aeb:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  801aee:	4c 89 ee             	mov    %r13,%rsi
+  801af1:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  801af8:	48 b8 1d 01 80 00 00 	movabs $0x80011d,%rax
+  801aff:	00 00 00 
+  801b02:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  801b04:	41 01 dc             	add    %ebx,%r12d
+  801b07:	49 63 f4             	movslq %r12d,%rsi
+  801b0a:	4c 39 f6             	cmp    %r14,%rsi
+  801b0d:	72 b3                	jb     801ac2 <devcons_write+0x38>
+    return res;
+  801b0f:	49 63 c4             	movslq %r12d,%rax
+}
+  801b12:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  801b19:	5b                   	pop    %rbx
+  801b1a:	41 5c                	pop    %r12
+  801b1c:	41 5d                	pop    %r13
+  801b1e:	41 5e                	pop    %r14
+  801b20:	41 5f                	pop    %r15
+  801b22:	5d                   	pop    %rbp
+  801b23:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  801b24:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  801b2a:	eb e3                	jmp    801b0f <devcons_write+0x85>
+
+0000000000801b2c <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  801b2c:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  801b2f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b34:	48 85 c0             	test   %rax,%rax
+  801b37:	74 55                	je     801b8e <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  801b39:	55                   	push   %rbp
+  801b3a:	48 89 e5             	mov    %rsp,%rbp
+  801b3d:	41 55                	push   %r13
+  801b3f:	41 54                	push   %r12
+  801b41:	53                   	push   %rbx
+  801b42:	48 83 ec 08          	sub    $0x8,%rsp
+  801b46:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  801b49:	48 bb 4a 01 80 00 00 	movabs $0x80014a,%rbx
+  801b50:	00 00 00 
+  801b53:	49 bc 17 02 80 00 00 	movabs $0x800217,%r12
+  801b5a:	00 00 00 
+  801b5d:	eb 03                	jmp    801b62 <devcons_read+0x36>
+  801b5f:	41 ff d4             	call   *%r12
+  801b62:	ff d3                	call   *%rbx
+  801b64:	85 c0                	test   %eax,%eax
+  801b66:	74 f7                	je     801b5f <devcons_read+0x33>
+    if (c < 0) return c;
+  801b68:	48 63 d0             	movslq %eax,%rdx
+  801b6b:	78 13                	js     801b80 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  801b6d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b72:	83 f8 04             	cmp    $0x4,%eax
+  801b75:	74 09                	je     801b80 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  801b77:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  801b7b:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  801b80:	48 89 d0             	mov    %rdx,%rax
+  801b83:	48 83 c4 08          	add    $0x8,%rsp
+  801b87:	5b                   	pop    %rbx
+  801b88:	41 5c                	pop    %r12
+  801b8a:	41 5d                	pop    %r13
+  801b8c:	5d                   	pop    %rbp
+  801b8d:	c3                   	ret
+  801b8e:	48 89 d0             	mov    %rdx,%rax
+  801b91:	c3                   	ret
+
+0000000000801b92 <cputchar>:
+cputchar(int ch) {
+  801b92:	55                   	push   %rbp
+  801b93:	48 89 e5             	mov    %rsp,%rbp
+  801b96:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  801b9a:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  801b9e:	be 01 00 00 00       	mov    $0x1,%esi
+  801ba3:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  801ba7:	48 b8 1d 01 80 00 00 	movabs $0x80011d,%rax
+  801bae:	00 00 00 
+  801bb1:	ff d0                	call   *%rax
+}
+  801bb3:	c9                   	leave
+  801bb4:	c3                   	ret
+
+0000000000801bb5 <getchar>:
+getchar(void) {
+  801bb5:	55                   	push   %rbp
+  801bb6:	48 89 e5             	mov    %rsp,%rbp
+  801bb9:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  801bbd:	ba 01 00 00 00       	mov    $0x1,%edx
+  801bc2:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  801bc6:	bf 00 00 00 00       	mov    $0x0,%edi
+  801bcb:	48 b8 d9 0a 80 00 00 	movabs $0x800ad9,%rax
+  801bd2:	00 00 00 
+  801bd5:	ff d0                	call   *%rax
+  801bd7:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  801bd9:	85 c0                	test   %eax,%eax
+  801bdb:	78 06                	js     801be3 <getchar+0x2e>
+  801bdd:	74 08                	je     801be7 <getchar+0x32>
+  801bdf:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  801be3:	89 d0                	mov    %edx,%eax
+  801be5:	c9                   	leave
+  801be6:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  801be7:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  801bec:	eb f5                	jmp    801be3 <getchar+0x2e>
+
+0000000000801bee <iscons>:
+iscons(int fdnum) {
+  801bee:	55                   	push   %rbp
+  801bef:	48 89 e5             	mov    %rsp,%rbp
+  801bf2:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  801bf6:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801bfa:	48 b8 f6 07 80 00 00 	movabs $0x8007f6,%rax
+  801c01:	00 00 00 
+  801c04:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801c06:	85 c0                	test   %eax,%eax
+  801c08:	78 18                	js     801c22 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  801c0a:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801c0e:	48 b8 a0 40 80 00 00 	movabs $0x8040a0,%rax
+  801c15:	00 00 00 
+  801c18:	8b 00                	mov    (%rax),%eax
+  801c1a:	39 02                	cmp    %eax,(%rdx)
+  801c1c:	0f 94 c0             	sete   %al
+  801c1f:	0f b6 c0             	movzbl %al,%eax
+}
+  801c22:	c9                   	leave
+  801c23:	c3                   	ret
+
+0000000000801c24 <opencons>:
+opencons(void) {
+  801c24:	55                   	push   %rbp
+  801c25:	48 89 e5             	mov    %rsp,%rbp
+  801c28:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  801c2c:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  801c30:	48 b8 dc 07 80 00 00 	movabs $0x8007dc,%rax
+  801c37:	00 00 00 
+  801c3a:	ff d0                	call   *%rax
+  801c3c:	85 c0                	test   %eax,%eax
+  801c3e:	78 49                	js     801c89 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  801c40:	b9 46 00 00 00       	mov    $0x46,%ecx
+  801c45:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801c4a:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  801c4e:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c53:	48 b8 a6 02 80 00 00 	movabs $0x8002a6,%rax
+  801c5a:	00 00 00 
+  801c5d:	ff d0                	call   *%rax
+  801c5f:	85 c0                	test   %eax,%eax
+  801c61:	78 26                	js     801c89 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  801c63:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801c67:	a1 a0 40 80 00 00 00 	movabs 0x8040a0,%eax
+  801c6e:	00 00 
+  801c70:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  801c72:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801c76:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  801c7d:	48 b8 35 07 80 00 00 	movabs $0x800735,%rax
+  801c84:	00 00 00 
+  801c87:	ff d0                	call   *%rax
+}
+  801c89:	c9                   	leave
+  801c8a:	c3                   	ret
+
+0000000000801c8b <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  801c8b:	55                   	push   %rbp
+  801c8c:	48 89 e5             	mov    %rsp,%rbp
+  801c8f:	41 56                	push   %r14
+  801c91:	41 55                	push   %r13
+  801c93:	41 54                	push   %r12
+  801c95:	53                   	push   %rbx
+  801c96:	48 83 ec 50          	sub    $0x50,%rsp
+  801c9a:	49 89 fc             	mov    %rdi,%r12
+  801c9d:	41 89 f5             	mov    %esi,%r13d
+  801ca0:	48 89 d3             	mov    %rdx,%rbx
+  801ca3:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  801ca7:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  801cab:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  801caf:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  801cb6:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801cba:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  801cbe:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  801cc2:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  801cc6:	48 b8 00 40 80 00 00 	movabs $0x804000,%rax
+  801ccd:	00 00 00 
+  801cd0:	4c 8b 30             	mov    (%rax),%r14
+  801cd3:	48 b8 e6 01 80 00 00 	movabs $0x8001e6,%rax
+  801cda:	00 00 00 
+  801cdd:	ff d0                	call   *%rax
+  801cdf:	89 c6                	mov    %eax,%esi
+  801ce1:	45 89 e8             	mov    %r13d,%r8d
+  801ce4:	4c 89 e1             	mov    %r12,%rcx
+  801ce7:	4c 89 f2             	mov    %r14,%rdx
+  801cea:	48 bf c0 30 80 00 00 	movabs $0x8030c0,%rdi
+  801cf1:	00 00 00 
+  801cf4:	b8 00 00 00 00       	mov    $0x0,%eax
+  801cf9:	49 bc db 1d 80 00 00 	movabs $0x801ddb,%r12
+  801d00:	00 00 00 
+  801d03:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  801d06:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  801d0a:	48 89 df             	mov    %rbx,%rdi
+  801d0d:	48 b8 77 1d 80 00 00 	movabs $0x801d77,%rax
+  801d14:	00 00 00 
+  801d17:	ff d0                	call   *%rax
+    cprintf("\n");
+  801d19:	48 bf 1b 30 80 00 00 	movabs $0x80301b,%rdi
+  801d20:	00 00 00 
+  801d23:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d28:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  801d2b:	cc                   	int3
+  801d2c:	eb fd                	jmp    801d2b <_panic+0xa0>
+
+0000000000801d2e <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  801d2e:	55                   	push   %rbp
+  801d2f:	48 89 e5             	mov    %rsp,%rbp
+  801d32:	53                   	push   %rbx
+  801d33:	48 83 ec 08          	sub    $0x8,%rsp
+  801d37:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  801d3a:	8b 06                	mov    (%rsi),%eax
+  801d3c:	8d 50 01             	lea    0x1(%rax),%edx
+  801d3f:	89 16                	mov    %edx,(%rsi)
+  801d41:	48 98                	cltq
+  801d43:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  801d48:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  801d4e:	74 0a                	je     801d5a <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  801d50:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  801d54:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801d58:	c9                   	leave
+  801d59:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  801d5a:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  801d5e:	be ff 00 00 00       	mov    $0xff,%esi
+  801d63:	48 b8 1d 01 80 00 00 	movabs $0x80011d,%rax
+  801d6a:	00 00 00 
+  801d6d:	ff d0                	call   *%rax
+        state->offset = 0;
+  801d6f:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  801d75:	eb d9                	jmp    801d50 <putch+0x22>
+
+0000000000801d77 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  801d77:	55                   	push   %rbp
+  801d78:	48 89 e5             	mov    %rsp,%rbp
+  801d7b:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  801d82:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  801d85:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  801d8c:	b9 21 00 00 00       	mov    $0x21,%ecx
+  801d91:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d96:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  801d99:	48 89 f1             	mov    %rsi,%rcx
+  801d9c:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  801da3:	48 bf 2e 1d 80 00 00 	movabs $0x801d2e,%rdi
+  801daa:	00 00 00 
+  801dad:	48 b8 2b 1f 80 00 00 	movabs $0x801f2b,%rax
+  801db4:	00 00 00 
+  801db7:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  801db9:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  801dc0:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  801dc7:	48 b8 1d 01 80 00 00 	movabs $0x80011d,%rax
+  801dce:	00 00 00 
+  801dd1:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  801dd3:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  801dd9:	c9                   	leave
+  801dda:	c3                   	ret
+
+0000000000801ddb <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  801ddb:	55                   	push   %rbp
+  801ddc:	48 89 e5             	mov    %rsp,%rbp
+  801ddf:	48 83 ec 50          	sub    $0x50,%rsp
+  801de3:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  801de7:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  801deb:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801def:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  801df3:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  801df7:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  801dfe:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801e02:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801e06:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  801e0a:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  801e0e:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  801e12:	48 b8 77 1d 80 00 00 	movabs $0x801d77,%rax
+  801e19:	00 00 00 
+  801e1c:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  801e1e:	c9                   	leave
+  801e1f:	c3                   	ret
+
+0000000000801e20 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  801e20:	55                   	push   %rbp
+  801e21:	48 89 e5             	mov    %rsp,%rbp
+  801e24:	41 57                	push   %r15
+  801e26:	41 56                	push   %r14
+  801e28:	41 55                	push   %r13
+  801e2a:	41 54                	push   %r12
+  801e2c:	53                   	push   %rbx
+  801e2d:	48 83 ec 18          	sub    $0x18,%rsp
+  801e31:	49 89 fc             	mov    %rdi,%r12
+  801e34:	49 89 f5             	mov    %rsi,%r13
+  801e37:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801e3b:	8b 45 10             	mov    0x10(%rbp),%eax
+  801e3e:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  801e41:	41 89 cf             	mov    %ecx,%r15d
+  801e44:	4c 39 fa             	cmp    %r15,%rdx
+  801e47:	73 5b                	jae    801ea4 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  801e49:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  801e4d:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  801e51:	85 db                	test   %ebx,%ebx
+  801e53:	7e 0e                	jle    801e63 <print_num+0x43>
+            putch(padc, put_arg);
+  801e55:	4c 89 ee             	mov    %r13,%rsi
+  801e58:	44 89 f7             	mov    %r14d,%edi
+  801e5b:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  801e5e:	83 eb 01             	sub    $0x1,%ebx
+  801e61:	75 f2                	jne    801e55 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  801e63:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  801e67:	48 b9 f4 30 80 00 00 	movabs $0x8030f4,%rcx
+  801e6e:	00 00 00 
+  801e71:	48 b8 e3 30 80 00 00 	movabs $0x8030e3,%rax
+  801e78:	00 00 00 
+  801e7b:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  801e7f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801e83:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e88:	49 f7 f7             	div    %r15
+  801e8b:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  801e8f:	4c 89 ee             	mov    %r13,%rsi
+  801e92:	41 ff d4             	call   *%r12
+}
+  801e95:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  801e99:	5b                   	pop    %rbx
+  801e9a:	41 5c                	pop    %r12
+  801e9c:	41 5d                	pop    %r13
+  801e9e:	41 5e                	pop    %r14
+  801ea0:	41 5f                	pop    %r15
+  801ea2:	5d                   	pop    %rbp
+  801ea3:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  801ea4:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801ea8:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ead:	49 f7 f7             	div    %r15
+  801eb0:	48 83 ec 08          	sub    $0x8,%rsp
+  801eb4:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  801eb8:	52                   	push   %rdx
+  801eb9:	45 0f be c9          	movsbl %r9b,%r9d
+  801ebd:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  801ec1:	48 89 c2             	mov    %rax,%rdx
+  801ec4:	48 b8 20 1e 80 00 00 	movabs $0x801e20,%rax
+  801ecb:	00 00 00 
+  801ece:	ff d0                	call   *%rax
+  801ed0:	48 83 c4 10          	add    $0x10,%rsp
+  801ed4:	eb 8d                	jmp    801e63 <print_num+0x43>
+
+0000000000801ed6 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  801ed6:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  801eda:	48 8b 06             	mov    (%rsi),%rax
+  801edd:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  801ee1:	73 0a                	jae    801eed <sprintputch+0x17>
+        *state->start++ = ch;
+  801ee3:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801ee7:	48 89 16             	mov    %rdx,(%rsi)
+  801eea:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  801eed:	c3                   	ret
+
+0000000000801eee <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  801eee:	55                   	push   %rbp
+  801eef:	48 89 e5             	mov    %rsp,%rbp
+  801ef2:	48 83 ec 50          	sub    $0x50,%rsp
+  801ef6:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801efa:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  801efe:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  801f02:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  801f09:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801f0d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801f11:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  801f15:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  801f19:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  801f1d:	48 b8 2b 1f 80 00 00 	movabs $0x801f2b,%rax
+  801f24:	00 00 00 
+  801f27:	ff d0                	call   *%rax
+}
+  801f29:	c9                   	leave
+  801f2a:	c3                   	ret
+
+0000000000801f2b <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  801f2b:	55                   	push   %rbp
+  801f2c:	48 89 e5             	mov    %rsp,%rbp
+  801f2f:	41 57                	push   %r15
+  801f31:	41 56                	push   %r14
+  801f33:	41 55                	push   %r13
+  801f35:	41 54                	push   %r12
+  801f37:	53                   	push   %rbx
+  801f38:	48 83 ec 38          	sub    $0x38,%rsp
+  801f3c:	49 89 fe             	mov    %rdi,%r14
+  801f3f:	49 89 f5             	mov    %rsi,%r13
+  801f42:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  801f45:	48 8b 01             	mov    (%rcx),%rax
+  801f48:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  801f4c:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  801f50:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801f54:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  801f58:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  801f5c:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  801f60:	0f b6 3b             	movzbl (%rbx),%edi
+  801f63:	40 80 ff 25          	cmp    $0x25,%dil
+  801f67:	74 18                	je     801f81 <vprintfmt+0x56>
+            if (!ch) return;
+  801f69:	40 84 ff             	test   %dil,%dil
+  801f6c:	0f 84 b1 06 00 00    	je     802623 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  801f72:	40 0f b6 ff          	movzbl %dil,%edi
+  801f76:	4c 89 ee             	mov    %r13,%rsi
+  801f79:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  801f7c:	4c 89 e3             	mov    %r12,%rbx
+  801f7f:	eb db                	jmp    801f5c <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  801f81:	be 00 00 00 00       	mov    $0x0,%esi
+  801f86:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  801f8a:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  801f8f:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  801f95:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  801f9c:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  801fa0:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  801fa5:	41 0f b6 04 24       	movzbl (%r12),%eax
+  801faa:	88 45 a0             	mov    %al,-0x60(%rbp)
+  801fad:	83 e8 23             	sub    $0x23,%eax
+  801fb0:	3c 57                	cmp    $0x57,%al
+  801fb2:	0f 87 51 06 00 00    	ja     802609 <vprintfmt+0x6de>
+  801fb8:	0f b6 c0             	movzbl %al,%eax
+  801fbb:	48 b9 a0 32 80 00 00 	movabs $0x8032a0,%rcx
+  801fc2:	00 00 00 
+  801fc5:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  801fc8:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  801fcb:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  801fcf:	eb cf                	jmp    801fa0 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  801fd1:	49 89 dc             	mov    %rbx,%r12
+  801fd4:	be 01 00 00 00       	mov    $0x1,%esi
+  801fd9:	eb c5                	jmp    801fa0 <vprintfmt+0x75>
+            padc = ch;
+  801fdb:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  801fdf:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  801fe2:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801fe5:	eb b9                	jmp    801fa0 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  801fe7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801fea:	83 f8 2f             	cmp    $0x2f,%eax
+  801fed:	77 24                	ja     802013 <vprintfmt+0xe8>
+  801fef:	89 c1                	mov    %eax,%ecx
+  801ff1:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  801ff5:	83 c0 08             	add    $0x8,%eax
+  801ff8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801ffb:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  801ffe:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  802001:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  802005:	79 99                	jns    801fa0 <vprintfmt+0x75>
+                width = precision;
+  802007:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  80200b:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  802011:	eb 8d                	jmp    801fa0 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  802013:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  802017:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  80201b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80201f:	eb da                	jmp    801ffb <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  802021:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  802026:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  80202a:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  802030:	3c 39                	cmp    $0x39,%al
+  802032:	77 1c                	ja     802050 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  802034:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  802038:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  80203c:	0f b6 c0             	movzbl %al,%eax
+  80203f:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  802044:	0f b6 03             	movzbl (%rbx),%eax
+  802047:	3c 39                	cmp    $0x39,%al
+  802049:	76 e9                	jbe    802034 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  80204b:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  80204e:	eb b1                	jmp    802001 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  802050:	49 89 dc             	mov    %rbx,%r12
+  802053:	eb ac                	jmp    802001 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  802055:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  802058:	85 c9                	test   %ecx,%ecx
+  80205a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80205f:	0f 49 c1             	cmovns %ecx,%eax
+  802062:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  802065:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  802068:	e9 33 ff ff ff       	jmp    801fa0 <vprintfmt+0x75>
+            lflag++;
+  80206d:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  802070:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  802073:	e9 28 ff ff ff       	jmp    801fa0 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  802078:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80207b:	83 f8 2f             	cmp    $0x2f,%eax
+  80207e:	77 19                	ja     802099 <vprintfmt+0x16e>
+  802080:	89 c2                	mov    %eax,%edx
+  802082:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802086:	83 c0 08             	add    $0x8,%eax
+  802089:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80208c:	8b 3a                	mov    (%rdx),%edi
+  80208e:	4c 89 ee             	mov    %r13,%rsi
+  802091:	41 ff d6             	call   *%r14
+            break;
+  802094:	e9 c3 fe ff ff       	jmp    801f5c <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  802099:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80209d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8020a1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8020a5:	eb e5                	jmp    80208c <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  8020a7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8020aa:	83 f8 2f             	cmp    $0x2f,%eax
+  8020ad:	77 5a                	ja     802109 <vprintfmt+0x1de>
+  8020af:	89 c2                	mov    %eax,%edx
+  8020b1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8020b5:	83 c0 08             	add    $0x8,%eax
+  8020b8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  8020bb:	8b 02                	mov    (%rdx),%eax
+  8020bd:	89 c1                	mov    %eax,%ecx
+  8020bf:	f7 d9                	neg    %ecx
+  8020c1:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  8020c4:	83 f9 15             	cmp    $0x15,%ecx
+  8020c7:	7f 4e                	jg     802117 <vprintfmt+0x1ec>
+  8020c9:	48 63 c1             	movslq %ecx,%rax
+  8020cc:	48 ba 60 35 80 00 00 	movabs $0x803560,%rdx
+  8020d3:	00 00 00 
+  8020d6:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8020da:	48 85 c0             	test   %rax,%rax
+  8020dd:	74 38                	je     802117 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  8020df:	48 89 c1             	mov    %rax,%rcx
+  8020e2:	48 ba 79 30 80 00 00 	movabs $0x803079,%rdx
+  8020e9:	00 00 00 
+  8020ec:	4c 89 ee             	mov    %r13,%rsi
+  8020ef:	4c 89 f7             	mov    %r14,%rdi
+  8020f2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020f7:	49 b8 ee 1e 80 00 00 	movabs $0x801eee,%r8
+  8020fe:	00 00 00 
+  802101:	41 ff d0             	call   *%r8
+  802104:	e9 53 fe ff ff       	jmp    801f5c <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  802109:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80210d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802111:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802115:	eb a4                	jmp    8020bb <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  802117:	48 ba 0c 31 80 00 00 	movabs $0x80310c,%rdx
+  80211e:	00 00 00 
+  802121:	4c 89 ee             	mov    %r13,%rsi
+  802124:	4c 89 f7             	mov    %r14,%rdi
+  802127:	b8 00 00 00 00       	mov    $0x0,%eax
+  80212c:	49 b8 ee 1e 80 00 00 	movabs $0x801eee,%r8
+  802133:	00 00 00 
+  802136:	41 ff d0             	call   *%r8
+  802139:	e9 1e fe ff ff       	jmp    801f5c <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  80213e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802141:	83 f8 2f             	cmp    $0x2f,%eax
+  802144:	77 6c                	ja     8021b2 <vprintfmt+0x287>
+  802146:	89 c2                	mov    %eax,%edx
+  802148:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80214c:	83 c0 08             	add    $0x8,%eax
+  80214f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802152:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  802155:	48 85 d2             	test   %rdx,%rdx
+  802158:	48 b8 05 31 80 00 00 	movabs $0x803105,%rax
+  80215f:	00 00 00 
+  802162:	48 0f 45 c2          	cmovne %rdx,%rax
+  802166:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  80216a:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  80216e:	7e 06                	jle    802176 <vprintfmt+0x24b>
+  802170:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  802174:	75 4a                	jne    8021c0 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  802176:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  80217a:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  80217e:	0f b6 00             	movzbl (%rax),%eax
+  802181:	84 c0                	test   %al,%al
+  802183:	0f 85 9a 00 00 00    	jne    802223 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  802189:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80218c:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  802190:	85 c0                	test   %eax,%eax
+  802192:	0f 8e c4 fd ff ff    	jle    801f5c <vprintfmt+0x31>
+  802198:	4c 89 ee             	mov    %r13,%rsi
+  80219b:	bf 20 00 00 00       	mov    $0x20,%edi
+  8021a0:	41 ff d6             	call   *%r14
+  8021a3:	41 83 ec 01          	sub    $0x1,%r12d
+  8021a7:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  8021ab:	75 eb                	jne    802198 <vprintfmt+0x26d>
+  8021ad:	e9 aa fd ff ff       	jmp    801f5c <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8021b2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8021b6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8021ba:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8021be:	eb 92                	jmp    802152 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  8021c0:	49 63 f7             	movslq %r15d,%rsi
+  8021c3:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  8021c7:	48 b8 dd 26 80 00 00 	movabs $0x8026dd,%rax
+  8021ce:	00 00 00 
+  8021d1:	ff d0                	call   *%rax
+  8021d3:	48 89 c2             	mov    %rax,%rdx
+  8021d6:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8021d9:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  8021db:	8d 70 ff             	lea    -0x1(%rax),%esi
+  8021de:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  8021e1:	85 c0                	test   %eax,%eax
+  8021e3:	7e 91                	jle    802176 <vprintfmt+0x24b>
+  8021e5:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  8021ea:	4c 89 ee             	mov    %r13,%rsi
+  8021ed:	44 89 e7             	mov    %r12d,%edi
+  8021f0:	41 ff d6             	call   *%r14
+  8021f3:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8021f7:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8021fa:	83 f8 ff             	cmp    $0xffffffff,%eax
+  8021fd:	75 eb                	jne    8021ea <vprintfmt+0x2bf>
+  8021ff:	e9 72 ff ff ff       	jmp    802176 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  802204:	0f b6 f8             	movzbl %al,%edi
+  802207:	4c 89 ee             	mov    %r13,%rsi
+  80220a:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  80220d:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  802211:	49 83 c4 01          	add    $0x1,%r12
+  802215:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  80221b:	84 c0                	test   %al,%al
+  80221d:	0f 84 66 ff ff ff    	je     802189 <vprintfmt+0x25e>
+  802223:	45 85 ff             	test   %r15d,%r15d
+  802226:	78 0a                	js     802232 <vprintfmt+0x307>
+  802228:	41 83 ef 01          	sub    $0x1,%r15d
+  80222c:	0f 88 57 ff ff ff    	js     802189 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  802232:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  802236:	74 cc                	je     802204 <vprintfmt+0x2d9>
+  802238:	8d 50 e0             	lea    -0x20(%rax),%edx
+  80223b:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  802240:	80 fa 5e             	cmp    $0x5e,%dl
+  802243:	77 c2                	ja     802207 <vprintfmt+0x2dc>
+  802245:	eb bd                	jmp    802204 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  802247:	40 84 f6             	test   %sil,%sil
+  80224a:	75 26                	jne    802272 <vprintfmt+0x347>
+    switch (lflag) {
+  80224c:	85 d2                	test   %edx,%edx
+  80224e:	74 59                	je     8022a9 <vprintfmt+0x37e>
+  802250:	83 fa 01             	cmp    $0x1,%edx
+  802253:	74 7b                	je     8022d0 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  802255:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802258:	83 f8 2f             	cmp    $0x2f,%eax
+  80225b:	0f 87 96 00 00 00    	ja     8022f7 <vprintfmt+0x3cc>
+  802261:	89 c2                	mov    %eax,%edx
+  802263:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802267:	83 c0 08             	add    $0x8,%eax
+  80226a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80226d:	4c 8b 22             	mov    (%rdx),%r12
+  802270:	eb 17                	jmp    802289 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  802272:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802275:	83 f8 2f             	cmp    $0x2f,%eax
+  802278:	77 21                	ja     80229b <vprintfmt+0x370>
+  80227a:	89 c2                	mov    %eax,%edx
+  80227c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802280:	83 c0 08             	add    $0x8,%eax
+  802283:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802286:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  802289:	4d 85 e4             	test   %r12,%r12
+  80228c:	78 7a                	js     802308 <vprintfmt+0x3dd>
+            num = i;
+  80228e:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  802291:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  802296:	e9 50 02 00 00       	jmp    8024eb <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  80229b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80229f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8022a3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8022a7:	eb dd                	jmp    802286 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  8022a9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8022ac:	83 f8 2f             	cmp    $0x2f,%eax
+  8022af:	77 11                	ja     8022c2 <vprintfmt+0x397>
+  8022b1:	89 c2                	mov    %eax,%edx
+  8022b3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8022b7:	83 c0 08             	add    $0x8,%eax
+  8022ba:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8022bd:	4c 63 22             	movslq (%rdx),%r12
+  8022c0:	eb c7                	jmp    802289 <vprintfmt+0x35e>
+  8022c2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8022c6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8022ca:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8022ce:	eb ed                	jmp    8022bd <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  8022d0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8022d3:	83 f8 2f             	cmp    $0x2f,%eax
+  8022d6:	77 11                	ja     8022e9 <vprintfmt+0x3be>
+  8022d8:	89 c2                	mov    %eax,%edx
+  8022da:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8022de:	83 c0 08             	add    $0x8,%eax
+  8022e1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8022e4:	4c 8b 22             	mov    (%rdx),%r12
+  8022e7:	eb a0                	jmp    802289 <vprintfmt+0x35e>
+  8022e9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8022ed:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8022f1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8022f5:	eb ed                	jmp    8022e4 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  8022f7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8022fb:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8022ff:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802303:	e9 65 ff ff ff       	jmp    80226d <vprintfmt+0x342>
+                putch('-', put_arg);
+  802308:	4c 89 ee             	mov    %r13,%rsi
+  80230b:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  802310:	41 ff d6             	call   *%r14
+                i = -i;
+  802313:	49 f7 dc             	neg    %r12
+  802316:	e9 73 ff ff ff       	jmp    80228e <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  80231b:	40 84 f6             	test   %sil,%sil
+  80231e:	75 32                	jne    802352 <vprintfmt+0x427>
+    switch (lflag) {
+  802320:	85 d2                	test   %edx,%edx
+  802322:	74 5d                	je     802381 <vprintfmt+0x456>
+  802324:	83 fa 01             	cmp    $0x1,%edx
+  802327:	0f 84 82 00 00 00    	je     8023af <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  80232d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802330:	83 f8 2f             	cmp    $0x2f,%eax
+  802333:	0f 87 a5 00 00 00    	ja     8023de <vprintfmt+0x4b3>
+  802339:	89 c2                	mov    %eax,%edx
+  80233b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80233f:	83 c0 08             	add    $0x8,%eax
+  802342:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802345:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  802348:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  80234d:	e9 99 01 00 00       	jmp    8024eb <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  802352:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802355:	83 f8 2f             	cmp    $0x2f,%eax
+  802358:	77 19                	ja     802373 <vprintfmt+0x448>
+  80235a:	89 c2                	mov    %eax,%edx
+  80235c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802360:	83 c0 08             	add    $0x8,%eax
+  802363:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802366:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  802369:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  80236e:	e9 78 01 00 00       	jmp    8024eb <vprintfmt+0x5c0>
+  802373:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802377:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80237b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80237f:	eb e5                	jmp    802366 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  802381:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802384:	83 f8 2f             	cmp    $0x2f,%eax
+  802387:	77 18                	ja     8023a1 <vprintfmt+0x476>
+  802389:	89 c2                	mov    %eax,%edx
+  80238b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80238f:	83 c0 08             	add    $0x8,%eax
+  802392:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802395:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  802397:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  80239c:	e9 4a 01 00 00       	jmp    8024eb <vprintfmt+0x5c0>
+  8023a1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8023a5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8023a9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8023ad:	eb e6                	jmp    802395 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  8023af:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8023b2:	83 f8 2f             	cmp    $0x2f,%eax
+  8023b5:	77 19                	ja     8023d0 <vprintfmt+0x4a5>
+  8023b7:	89 c2                	mov    %eax,%edx
+  8023b9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8023bd:	83 c0 08             	add    $0x8,%eax
+  8023c0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8023c3:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8023c6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  8023cb:	e9 1b 01 00 00       	jmp    8024eb <vprintfmt+0x5c0>
+  8023d0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8023d4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8023d8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8023dc:	eb e5                	jmp    8023c3 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  8023de:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8023e2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8023e6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8023ea:	e9 56 ff ff ff       	jmp    802345 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  8023ef:	40 84 f6             	test   %sil,%sil
+  8023f2:	75 2e                	jne    802422 <vprintfmt+0x4f7>
+    switch (lflag) {
+  8023f4:	85 d2                	test   %edx,%edx
+  8023f6:	74 59                	je     802451 <vprintfmt+0x526>
+  8023f8:	83 fa 01             	cmp    $0x1,%edx
+  8023fb:	74 7f                	je     80247c <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  8023fd:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802400:	83 f8 2f             	cmp    $0x2f,%eax
+  802403:	0f 87 9f 00 00 00    	ja     8024a8 <vprintfmt+0x57d>
+  802409:	89 c2                	mov    %eax,%edx
+  80240b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80240f:	83 c0 08             	add    $0x8,%eax
+  802412:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802415:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  802418:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  80241d:	e9 c9 00 00 00       	jmp    8024eb <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  802422:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802425:	83 f8 2f             	cmp    $0x2f,%eax
+  802428:	77 19                	ja     802443 <vprintfmt+0x518>
+  80242a:	89 c2                	mov    %eax,%edx
+  80242c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802430:	83 c0 08             	add    $0x8,%eax
+  802433:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802436:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  802439:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  80243e:	e9 a8 00 00 00       	jmp    8024eb <vprintfmt+0x5c0>
+  802443:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802447:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80244b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80244f:	eb e5                	jmp    802436 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  802451:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802454:	83 f8 2f             	cmp    $0x2f,%eax
+  802457:	77 15                	ja     80246e <vprintfmt+0x543>
+  802459:	89 c2                	mov    %eax,%edx
+  80245b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80245f:	83 c0 08             	add    $0x8,%eax
+  802462:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802465:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  802467:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  80246c:	eb 7d                	jmp    8024eb <vprintfmt+0x5c0>
+  80246e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802472:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802476:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80247a:	eb e9                	jmp    802465 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  80247c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80247f:	83 f8 2f             	cmp    $0x2f,%eax
+  802482:	77 16                	ja     80249a <vprintfmt+0x56f>
+  802484:	89 c2                	mov    %eax,%edx
+  802486:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80248a:	83 c0 08             	add    $0x8,%eax
+  80248d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802490:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  802493:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  802498:	eb 51                	jmp    8024eb <vprintfmt+0x5c0>
+  80249a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80249e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8024a2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8024a6:	eb e8                	jmp    802490 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  8024a8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8024ac:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8024b0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8024b4:	e9 5c ff ff ff       	jmp    802415 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  8024b9:	4c 89 ee             	mov    %r13,%rsi
+  8024bc:	bf 30 00 00 00       	mov    $0x30,%edi
+  8024c1:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  8024c4:	4c 89 ee             	mov    %r13,%rsi
+  8024c7:	bf 78 00 00 00       	mov    $0x78,%edi
+  8024cc:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  8024cf:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8024d2:	83 f8 2f             	cmp    $0x2f,%eax
+  8024d5:	77 47                	ja     80251e <vprintfmt+0x5f3>
+  8024d7:	89 c2                	mov    %eax,%edx
+  8024d9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8024dd:	83 c0 08             	add    $0x8,%eax
+  8024e0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8024e3:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8024e6:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  8024eb:	48 83 ec 08          	sub    $0x8,%rsp
+  8024ef:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  8024f3:	0f 94 c0             	sete   %al
+  8024f6:	0f b6 c0             	movzbl %al,%eax
+  8024f9:	50                   	push   %rax
+  8024fa:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  8024ff:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  802503:	4c 89 ee             	mov    %r13,%rsi
+  802506:	4c 89 f7             	mov    %r14,%rdi
+  802509:	48 b8 20 1e 80 00 00 	movabs $0x801e20,%rax
+  802510:	00 00 00 
+  802513:	ff d0                	call   *%rax
+            break;
+  802515:	48 83 c4 10          	add    $0x10,%rsp
+  802519:	e9 3e fa ff ff       	jmp    801f5c <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  80251e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802522:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802526:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80252a:	eb b7                	jmp    8024e3 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  80252c:	40 84 f6             	test   %sil,%sil
+  80252f:	75 2b                	jne    80255c <vprintfmt+0x631>
+    switch (lflag) {
+  802531:	85 d2                	test   %edx,%edx
+  802533:	74 56                	je     80258b <vprintfmt+0x660>
+  802535:	83 fa 01             	cmp    $0x1,%edx
+  802538:	74 7f                	je     8025b9 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  80253a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80253d:	83 f8 2f             	cmp    $0x2f,%eax
+  802540:	0f 87 a2 00 00 00    	ja     8025e8 <vprintfmt+0x6bd>
+  802546:	89 c2                	mov    %eax,%edx
+  802548:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80254c:	83 c0 08             	add    $0x8,%eax
+  80254f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802552:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  802555:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  80255a:	eb 8f                	jmp    8024eb <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  80255c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80255f:	83 f8 2f             	cmp    $0x2f,%eax
+  802562:	77 19                	ja     80257d <vprintfmt+0x652>
+  802564:	89 c2                	mov    %eax,%edx
+  802566:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80256a:	83 c0 08             	add    $0x8,%eax
+  80256d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802570:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  802573:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  802578:	e9 6e ff ff ff       	jmp    8024eb <vprintfmt+0x5c0>
+  80257d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802581:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802585:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802589:	eb e5                	jmp    802570 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  80258b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80258e:	83 f8 2f             	cmp    $0x2f,%eax
+  802591:	77 18                	ja     8025ab <vprintfmt+0x680>
+  802593:	89 c2                	mov    %eax,%edx
+  802595:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802599:	83 c0 08             	add    $0x8,%eax
+  80259c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80259f:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  8025a1:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  8025a6:	e9 40 ff ff ff       	jmp    8024eb <vprintfmt+0x5c0>
+  8025ab:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8025af:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8025b3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8025b7:	eb e6                	jmp    80259f <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  8025b9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8025bc:	83 f8 2f             	cmp    $0x2f,%eax
+  8025bf:	77 19                	ja     8025da <vprintfmt+0x6af>
+  8025c1:	89 c2                	mov    %eax,%edx
+  8025c3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8025c7:	83 c0 08             	add    $0x8,%eax
+  8025ca:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8025cd:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8025d0:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  8025d5:	e9 11 ff ff ff       	jmp    8024eb <vprintfmt+0x5c0>
+  8025da:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8025de:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8025e2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8025e6:	eb e5                	jmp    8025cd <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  8025e8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8025ec:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8025f0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8025f4:	e9 59 ff ff ff       	jmp    802552 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  8025f9:	4c 89 ee             	mov    %r13,%rsi
+  8025fc:	bf 25 00 00 00       	mov    $0x25,%edi
+  802601:	41 ff d6             	call   *%r14
+            break;
+  802604:	e9 53 f9 ff ff       	jmp    801f5c <vprintfmt+0x31>
+            putch('%', put_arg);
+  802609:	4c 89 ee             	mov    %r13,%rsi
+  80260c:	bf 25 00 00 00       	mov    $0x25,%edi
+  802611:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  802614:	48 83 eb 01          	sub    $0x1,%rbx
+  802618:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  80261c:	75 f6                	jne    802614 <vprintfmt+0x6e9>
+  80261e:	e9 39 f9 ff ff       	jmp    801f5c <vprintfmt+0x31>
+}
+  802623:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  802627:	5b                   	pop    %rbx
+  802628:	41 5c                	pop    %r12
+  80262a:	41 5d                	pop    %r13
+  80262c:	41 5e                	pop    %r14
+  80262e:	41 5f                	pop    %r15
+  802630:	5d                   	pop    %rbp
+  802631:	c3                   	ret
+
+0000000000802632 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  802632:	55                   	push   %rbp
+  802633:	48 89 e5             	mov    %rsp,%rbp
+  802636:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  80263a:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80263e:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  802643:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  802647:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  80264e:	48 85 ff             	test   %rdi,%rdi
+  802651:	74 2b                	je     80267e <vsnprintf+0x4c>
+  802653:	48 85 f6             	test   %rsi,%rsi
+  802656:	74 26                	je     80267e <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  802658:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80265c:	48 bf d6 1e 80 00 00 	movabs $0x801ed6,%rdi
+  802663:	00 00 00 
+  802666:	48 b8 2b 1f 80 00 00 	movabs $0x801f2b,%rax
+  80266d:	00 00 00 
+  802670:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  802672:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802676:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  802679:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  80267c:	c9                   	leave
+  80267d:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  80267e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802683:	eb f7                	jmp    80267c <vsnprintf+0x4a>
+
+0000000000802685 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  802685:	55                   	push   %rbp
+  802686:	48 89 e5             	mov    %rsp,%rbp
+  802689:	48 83 ec 50          	sub    $0x50,%rsp
+  80268d:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  802691:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  802695:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  802699:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8026a0:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8026a4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8026a8:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8026ac:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  8026b0:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8026b4:	48 b8 32 26 80 00 00 	movabs $0x802632,%rax
+  8026bb:	00 00 00 
+  8026be:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  8026c0:	c9                   	leave
+  8026c1:	c3                   	ret
+
+00000000008026c2 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  8026c2:	80 3f 00             	cmpb   $0x0,(%rdi)
+  8026c5:	74 10                	je     8026d7 <strlen+0x15>
+    size_t n = 0;
+  8026c7:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  8026cc:	48 83 c0 01          	add    $0x1,%rax
+  8026d0:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  8026d4:	75 f6                	jne    8026cc <strlen+0xa>
+  8026d6:	c3                   	ret
+    size_t n = 0;
+  8026d7:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  8026dc:	c3                   	ret
+
+00000000008026dd <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  8026dd:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  8026e0:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  8026e5:	48 85 f6             	test   %rsi,%rsi
+  8026e8:	74 11                	je     8026fb <strnlen+0x1e>
+  8026ea:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  8026ee:	74 0c                	je     8026fc <strnlen+0x1f>
+  8026f0:	48 83 c2 01          	add    $0x1,%rdx
+  8026f4:	48 39 d0             	cmp    %rdx,%rax
+  8026f7:	75 f1                	jne    8026ea <strnlen+0xd>
+  8026f9:	eb 04                	jmp    8026ff <strnlen+0x22>
+  8026fb:	c3                   	ret
+  8026fc:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  8026ff:	c3                   	ret
+
+0000000000802700 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  802700:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  802703:	ba 00 00 00 00       	mov    $0x0,%edx
+  802708:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  80270c:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  80270f:	48 83 c2 01          	add    $0x1,%rdx
+  802713:	84 c9                	test   %cl,%cl
+  802715:	75 f1                	jne    802708 <strcpy+0x8>
+        ;
+    return res;
+}
+  802717:	c3                   	ret
+
+0000000000802718 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  802718:	55                   	push   %rbp
+  802719:	48 89 e5             	mov    %rsp,%rbp
+  80271c:	41 54                	push   %r12
+  80271e:	53                   	push   %rbx
+  80271f:	48 89 fb             	mov    %rdi,%rbx
+  802722:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  802725:	48 b8 c2 26 80 00 00 	movabs $0x8026c2,%rax
+  80272c:	00 00 00 
+  80272f:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  802731:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  802735:	4c 89 e6             	mov    %r12,%rsi
+  802738:	48 b8 00 27 80 00 00 	movabs $0x802700,%rax
+  80273f:	00 00 00 
+  802742:	ff d0                	call   *%rax
+    return dst;
+}
+  802744:	48 89 d8             	mov    %rbx,%rax
+  802747:	5b                   	pop    %rbx
+  802748:	41 5c                	pop    %r12
+  80274a:	5d                   	pop    %rbp
+  80274b:	c3                   	ret
+
+000000000080274c <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  80274c:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  80274f:	48 85 d2             	test   %rdx,%rdx
+  802752:	74 1f                	je     802773 <strncpy+0x27>
+  802754:	48 01 fa             	add    %rdi,%rdx
+  802757:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  80275a:	48 83 c1 01          	add    $0x1,%rcx
+  80275e:	44 0f b6 06          	movzbl (%rsi),%r8d
+  802762:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  802766:	41 80 f8 01          	cmp    $0x1,%r8b
+  80276a:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  80276e:	48 39 ca             	cmp    %rcx,%rdx
+  802771:	75 e7                	jne    80275a <strncpy+0xe>
+    }
+    return ret;
+}
+  802773:	c3                   	ret
+
+0000000000802774 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  802774:	48 89 f8             	mov    %rdi,%rax
+  802777:	48 85 d2             	test   %rdx,%rdx
+  80277a:	74 24                	je     8027a0 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  80277c:	48 83 ea 01          	sub    $0x1,%rdx
+  802780:	74 1b                	je     80279d <strlcpy+0x29>
+  802782:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  802786:	0f b6 16             	movzbl (%rsi),%edx
+  802789:	84 d2                	test   %dl,%dl
+  80278b:	74 10                	je     80279d <strlcpy+0x29>
+            *dst++ = *src++;
+  80278d:	48 83 c6 01          	add    $0x1,%rsi
+  802791:	48 83 c0 01          	add    $0x1,%rax
+  802795:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  802798:	48 39 c8             	cmp    %rcx,%rax
+  80279b:	75 e9                	jne    802786 <strlcpy+0x12>
+        *dst = '\0';
+  80279d:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  8027a0:	48 29 f8             	sub    %rdi,%rax
+}
+  8027a3:	c3                   	ret
+
+00000000008027a4 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  8027a4:	0f b6 07             	movzbl (%rdi),%eax
+  8027a7:	84 c0                	test   %al,%al
+  8027a9:	74 13                	je     8027be <strcmp+0x1a>
+  8027ab:	38 06                	cmp    %al,(%rsi)
+  8027ad:	75 0f                	jne    8027be <strcmp+0x1a>
+  8027af:	48 83 c7 01          	add    $0x1,%rdi
+  8027b3:	48 83 c6 01          	add    $0x1,%rsi
+  8027b7:	0f b6 07             	movzbl (%rdi),%eax
+  8027ba:	84 c0                	test   %al,%al
+  8027bc:	75 ed                	jne    8027ab <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  8027be:	0f b6 c0             	movzbl %al,%eax
+  8027c1:	0f b6 16             	movzbl (%rsi),%edx
+  8027c4:	29 d0                	sub    %edx,%eax
+}
+  8027c6:	c3                   	ret
+
+00000000008027c7 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  8027c7:	48 85 d2             	test   %rdx,%rdx
+  8027ca:	74 1f                	je     8027eb <strncmp+0x24>
+  8027cc:	0f b6 07             	movzbl (%rdi),%eax
+  8027cf:	84 c0                	test   %al,%al
+  8027d1:	74 1e                	je     8027f1 <strncmp+0x2a>
+  8027d3:	3a 06                	cmp    (%rsi),%al
+  8027d5:	75 1a                	jne    8027f1 <strncmp+0x2a>
+  8027d7:	48 83 c7 01          	add    $0x1,%rdi
+  8027db:	48 83 c6 01          	add    $0x1,%rsi
+  8027df:	48 83 ea 01          	sub    $0x1,%rdx
+  8027e3:	75 e7                	jne    8027cc <strncmp+0x5>
+
+    if (!n) return 0;
+  8027e5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027ea:	c3                   	ret
+  8027eb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027f0:	c3                   	ret
+  8027f1:	48 85 d2             	test   %rdx,%rdx
+  8027f4:	74 09                	je     8027ff <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  8027f6:	0f b6 07             	movzbl (%rdi),%eax
+  8027f9:	0f b6 16             	movzbl (%rsi),%edx
+  8027fc:	29 d0                	sub    %edx,%eax
+  8027fe:	c3                   	ret
+    if (!n) return 0;
+  8027ff:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802804:	c3                   	ret
+
+0000000000802805 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  802805:	0f b6 17             	movzbl (%rdi),%edx
+  802808:	84 d2                	test   %dl,%dl
+  80280a:	74 18                	je     802824 <strchr+0x1f>
+        if (*str == c) {
+  80280c:	0f be d2             	movsbl %dl,%edx
+  80280f:	39 f2                	cmp    %esi,%edx
+  802811:	74 17                	je     80282a <strchr+0x25>
+    for (; *str; str++) {
+  802813:	48 83 c7 01          	add    $0x1,%rdi
+  802817:	0f b6 17             	movzbl (%rdi),%edx
+  80281a:	84 d2                	test   %dl,%dl
+  80281c:	75 ee                	jne    80280c <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  80281e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802823:	c3                   	ret
+  802824:	b8 00 00 00 00       	mov    $0x0,%eax
+  802829:	c3                   	ret
+  80282a:	48 89 f8             	mov    %rdi,%rax
+}
+  80282d:	c3                   	ret
+
+000000000080282e <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  80282e:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  802831:	0f b6 17             	movzbl (%rdi),%edx
+  802834:	84 d2                	test   %dl,%dl
+  802836:	74 13                	je     80284b <strfind+0x1d>
+  802838:	0f be d2             	movsbl %dl,%edx
+  80283b:	39 f2                	cmp    %esi,%edx
+  80283d:	74 0b                	je     80284a <strfind+0x1c>
+  80283f:	48 83 c0 01          	add    $0x1,%rax
+  802843:	0f b6 10             	movzbl (%rax),%edx
+  802846:	84 d2                	test   %dl,%dl
+  802848:	75 ee                	jne    802838 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  80284a:	c3                   	ret
+  80284b:	c3                   	ret
+
+000000000080284c <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  80284c:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  80284f:	48 89 f8             	mov    %rdi,%rax
+  802852:	48 f7 d8             	neg    %rax
+  802855:	83 e0 07             	and    $0x7,%eax
+  802858:	49 89 d1             	mov    %rdx,%r9
+  80285b:	49 29 c1             	sub    %rax,%r9
+  80285e:	78 36                	js     802896 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  802860:	40 0f b6 c6          	movzbl %sil,%eax
+  802864:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  80286b:	01 01 01 
+  80286e:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  802872:	40 f6 c7 07          	test   $0x7,%dil
+  802876:	75 38                	jne    8028b0 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  802878:	4c 89 c9             	mov    %r9,%rcx
+  80287b:	48 c1 f9 03          	sar    $0x3,%rcx
+  80287f:	74 0c                	je     80288d <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  802881:	fc                   	cld
+  802882:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  802885:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  802889:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  80288d:	4d 85 c9             	test   %r9,%r9
+  802890:	75 45                	jne    8028d7 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  802892:	4c 89 c0             	mov    %r8,%rax
+  802895:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  802896:	48 85 d2             	test   %rdx,%rdx
+  802899:	74 f7                	je     802892 <memset+0x46>
+  80289b:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  80289e:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  8028a1:	48 83 c0 01          	add    $0x1,%rax
+  8028a5:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  8028a9:	48 39 c2             	cmp    %rax,%rdx
+  8028ac:	75 f3                	jne    8028a1 <memset+0x55>
+  8028ae:	eb e2                	jmp    802892 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  8028b0:	40 f6 c7 01          	test   $0x1,%dil
+  8028b4:	74 06                	je     8028bc <memset+0x70>
+  8028b6:	88 07                	mov    %al,(%rdi)
+  8028b8:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  8028bc:	40 f6 c7 02          	test   $0x2,%dil
+  8028c0:	74 07                	je     8028c9 <memset+0x7d>
+  8028c2:	66 89 07             	mov    %ax,(%rdi)
+  8028c5:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  8028c9:	40 f6 c7 04          	test   $0x4,%dil
+  8028cd:	74 a9                	je     802878 <memset+0x2c>
+  8028cf:	89 07                	mov    %eax,(%rdi)
+  8028d1:	48 83 c7 04          	add    $0x4,%rdi
+  8028d5:	eb a1                	jmp    802878 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  8028d7:	41 f6 c1 04          	test   $0x4,%r9b
+  8028db:	74 06                	je     8028e3 <memset+0x97>
+  8028dd:	89 07                	mov    %eax,(%rdi)
+  8028df:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  8028e3:	41 f6 c1 02          	test   $0x2,%r9b
+  8028e7:	74 07                	je     8028f0 <memset+0xa4>
+  8028e9:	66 89 07             	mov    %ax,(%rdi)
+  8028ec:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  8028f0:	41 f6 c1 01          	test   $0x1,%r9b
+  8028f4:	74 9c                	je     802892 <memset+0x46>
+  8028f6:	88 07                	mov    %al,(%rdi)
+  8028f8:	eb 98                	jmp    802892 <memset+0x46>
+
+00000000008028fa <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  8028fa:	48 89 f8             	mov    %rdi,%rax
+  8028fd:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  802900:	48 39 fe             	cmp    %rdi,%rsi
+  802903:	73 3b                	jae    802940 <memmove+0x46>
+  802905:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  802909:	48 39 d7             	cmp    %rdx,%rdi
+  80290c:	73 32                	jae    802940 <memmove+0x46>
+        s += n;
+        d += n;
+  80290e:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  802912:	48 89 d6             	mov    %rdx,%rsi
+  802915:	48 09 fe             	or     %rdi,%rsi
+  802918:	48 09 ce             	or     %rcx,%rsi
+  80291b:	40 f6 c6 07          	test   $0x7,%sil
+  80291f:	75 12                	jne    802933 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  802921:	48 83 ef 08          	sub    $0x8,%rdi
+  802925:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  802929:	48 c1 e9 03          	shr    $0x3,%rcx
+  80292d:	fd                   	std
+  80292e:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  802931:	fc                   	cld
+  802932:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  802933:	48 83 ef 01          	sub    $0x1,%rdi
+  802937:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  80293b:	fd                   	std
+  80293c:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  80293e:	eb f1                	jmp    802931 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  802940:	48 89 f2             	mov    %rsi,%rdx
+  802943:	48 09 c2             	or     %rax,%rdx
+  802946:	48 09 ca             	or     %rcx,%rdx
+  802949:	f6 c2 07             	test   $0x7,%dl
+  80294c:	75 0c                	jne    80295a <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  80294e:	48 c1 e9 03          	shr    $0x3,%rcx
+  802952:	48 89 c7             	mov    %rax,%rdi
+  802955:	fc                   	cld
+  802956:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  802959:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  80295a:	48 89 c7             	mov    %rax,%rdi
+  80295d:	fc                   	cld
+  80295e:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  802960:	c3                   	ret
+
+0000000000802961 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  802961:	55                   	push   %rbp
+  802962:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  802965:	48 b8 fa 28 80 00 00 	movabs $0x8028fa,%rax
+  80296c:	00 00 00 
+  80296f:	ff d0                	call   *%rax
+}
+  802971:	5d                   	pop    %rbp
+  802972:	c3                   	ret
+
+0000000000802973 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  802973:	55                   	push   %rbp
+  802974:	48 89 e5             	mov    %rsp,%rbp
+  802977:	41 57                	push   %r15
+  802979:	41 56                	push   %r14
+  80297b:	41 55                	push   %r13
+  80297d:	41 54                	push   %r12
+  80297f:	53                   	push   %rbx
+  802980:	48 83 ec 08          	sub    $0x8,%rsp
+  802984:	49 89 fe             	mov    %rdi,%r14
+  802987:	49 89 f7             	mov    %rsi,%r15
+  80298a:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  80298d:	48 89 f7             	mov    %rsi,%rdi
+  802990:	48 b8 c2 26 80 00 00 	movabs $0x8026c2,%rax
+  802997:	00 00 00 
+  80299a:	ff d0                	call   *%rax
+  80299c:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  80299f:	48 89 de             	mov    %rbx,%rsi
+  8029a2:	4c 89 f7             	mov    %r14,%rdi
+  8029a5:	48 b8 dd 26 80 00 00 	movabs $0x8026dd,%rax
+  8029ac:	00 00 00 
+  8029af:	ff d0                	call   *%rax
+  8029b1:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  8029b4:	48 39 c3             	cmp    %rax,%rbx
+  8029b7:	74 36                	je     8029ef <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  8029b9:	48 89 d8             	mov    %rbx,%rax
+  8029bc:	4c 29 e8             	sub    %r13,%rax
+  8029bf:	49 39 c4             	cmp    %rax,%r12
+  8029c2:	73 31                	jae    8029f5 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  8029c4:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  8029c9:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8029cd:	4c 89 fe             	mov    %r15,%rsi
+  8029d0:	48 b8 61 29 80 00 00 	movabs $0x802961,%rax
+  8029d7:	00 00 00 
+  8029da:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  8029dc:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  8029e0:	48 83 c4 08          	add    $0x8,%rsp
+  8029e4:	5b                   	pop    %rbx
+  8029e5:	41 5c                	pop    %r12
+  8029e7:	41 5d                	pop    %r13
+  8029e9:	41 5e                	pop    %r14
+  8029eb:	41 5f                	pop    %r15
+  8029ed:	5d                   	pop    %rbp
+  8029ee:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  8029ef:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  8029f3:	eb eb                	jmp    8029e0 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  8029f5:	48 83 eb 01          	sub    $0x1,%rbx
+  8029f9:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8029fd:	48 89 da             	mov    %rbx,%rdx
+  802a00:	4c 89 fe             	mov    %r15,%rsi
+  802a03:	48 b8 61 29 80 00 00 	movabs $0x802961,%rax
+  802a0a:	00 00 00 
+  802a0d:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  802a0f:	49 01 de             	add    %rbx,%r14
+  802a12:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  802a17:	eb c3                	jmp    8029dc <strlcat+0x69>
+
+0000000000802a19 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  802a19:	48 85 d2             	test   %rdx,%rdx
+  802a1c:	74 2d                	je     802a4b <memcmp+0x32>
+  802a1e:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  802a23:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  802a27:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  802a2c:	44 38 c1             	cmp    %r8b,%cl
+  802a2f:	75 0f                	jne    802a40 <memcmp+0x27>
+    while (n-- > 0) {
+  802a31:	48 83 c0 01          	add    $0x1,%rax
+  802a35:	48 39 c2             	cmp    %rax,%rdx
+  802a38:	75 e9                	jne    802a23 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  802a3a:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a3f:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  802a40:	0f b6 c1             	movzbl %cl,%eax
+  802a43:	45 0f b6 c0          	movzbl %r8b,%r8d
+  802a47:	44 29 c0             	sub    %r8d,%eax
+  802a4a:	c3                   	ret
+    return 0;
+  802a4b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802a50:	c3                   	ret
+
+0000000000802a51 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  802a51:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  802a55:	48 39 c7             	cmp    %rax,%rdi
+  802a58:	73 0f                	jae    802a69 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  802a5a:	40 38 37             	cmp    %sil,(%rdi)
+  802a5d:	74 0e                	je     802a6d <memfind+0x1c>
+    for (; src < end; src++) {
+  802a5f:	48 83 c7 01          	add    $0x1,%rdi
+  802a63:	48 39 f8             	cmp    %rdi,%rax
+  802a66:	75 f2                	jne    802a5a <memfind+0x9>
+  802a68:	c3                   	ret
+  802a69:	48 89 f8             	mov    %rdi,%rax
+  802a6c:	c3                   	ret
+  802a6d:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  802a70:	c3                   	ret
+
+0000000000802a71 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  802a71:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  802a74:	0f b6 37             	movzbl (%rdi),%esi
+  802a77:	40 80 fe 20          	cmp    $0x20,%sil
+  802a7b:	74 06                	je     802a83 <strtol+0x12>
+  802a7d:	40 80 fe 09          	cmp    $0x9,%sil
+  802a81:	75 13                	jne    802a96 <strtol+0x25>
+  802a83:	48 83 c7 01          	add    $0x1,%rdi
+  802a87:	0f b6 37             	movzbl (%rdi),%esi
+  802a8a:	40 80 fe 20          	cmp    $0x20,%sil
+  802a8e:	74 f3                	je     802a83 <strtol+0x12>
+  802a90:	40 80 fe 09          	cmp    $0x9,%sil
+  802a94:	74 ed                	je     802a83 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  802a96:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  802a99:	83 e0 fd             	and    $0xfffffffd,%eax
+  802a9c:	3c 01                	cmp    $0x1,%al
+  802a9e:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  802aa2:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  802aa8:	75 0f                	jne    802ab9 <strtol+0x48>
+  802aaa:	80 3f 30             	cmpb   $0x30,(%rdi)
+  802aad:	74 14                	je     802ac3 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  802aaf:	85 d2                	test   %edx,%edx
+  802ab1:	b8 0a 00 00 00       	mov    $0xa,%eax
+  802ab6:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  802ab9:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  802abe:	4c 63 ca             	movslq %edx,%r9
+  802ac1:	eb 36                	jmp    802af9 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  802ac3:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  802ac7:	74 0f                	je     802ad8 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  802ac9:	85 d2                	test   %edx,%edx
+  802acb:	75 ec                	jne    802ab9 <strtol+0x48>
+        s++;
+  802acd:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  802ad1:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  802ad6:	eb e1                	jmp    802ab9 <strtol+0x48>
+        s += 2;
+  802ad8:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  802adc:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  802ae1:	eb d6                	jmp    802ab9 <strtol+0x48>
+            dig -= '0';
+  802ae3:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  802ae6:	44 0f b6 c1          	movzbl %cl,%r8d
+  802aea:	41 39 d0             	cmp    %edx,%r8d
+  802aed:	7d 21                	jge    802b10 <strtol+0x9f>
+        val = val * base + dig;
+  802aef:	49 0f af c1          	imul   %r9,%rax
+  802af3:	0f b6 c9             	movzbl %cl,%ecx
+  802af6:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  802af9:	48 83 c7 01          	add    $0x1,%rdi
+  802afd:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  802b01:	80 f9 39             	cmp    $0x39,%cl
+  802b04:	76 dd                	jbe    802ae3 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  802b06:	80 f9 7b             	cmp    $0x7b,%cl
+  802b09:	77 05                	ja     802b10 <strtol+0x9f>
+            dig -= 'a' - 10;
+  802b0b:	83 e9 57             	sub    $0x57,%ecx
+  802b0e:	eb d6                	jmp    802ae6 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  802b10:	4d 85 d2             	test   %r10,%r10
+  802b13:	74 03                	je     802b18 <strtol+0xa7>
+  802b15:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  802b18:	48 89 c2             	mov    %rax,%rdx
+  802b1b:	48 f7 da             	neg    %rdx
+  802b1e:	40 80 fe 2d          	cmp    $0x2d,%sil
+  802b22:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  802b26:	c3                   	ret
+
+0000000000802b27 <_handle_vectored_pagefault>:
+/* Vector size */
+static size_t _pfhandler_off = 0;
+static bool _pfhandler_inititiallized = 0;
+
+void
+_handle_vectored_pagefault(struct UTrapframe *utf) {
+  802b27:	55                   	push   %rbp
+  802b28:	48 89 e5             	mov    %rsp,%rbp
+  802b2b:	41 56                	push   %r14
+  802b2d:	41 55                	push   %r13
+  802b2f:	41 54                	push   %r12
+  802b31:	53                   	push   %rbx
+  802b32:	49 89 fc             	mov    %rdi,%r12
+    /* This trying to handle pagefault until
+     * some handler returns 1, that indicates
+     * successfully handled exception */
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  802b35:	48 b8 68 70 80 00 00 	movabs $0x807068,%rax
+  802b3c:	00 00 00 
+  802b3f:	48 83 38 00          	cmpq   $0x0,(%rax)
+  802b43:	74 27                	je     802b6c <_handle_vectored_pagefault+0x45>
+  802b45:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (_pfhandler_vec[i](utf)) return;
+  802b4a:	49 bd 20 70 80 00 00 	movabs $0x807020,%r13
+  802b51:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  802b54:	49 89 c6             	mov    %rax,%r14
+        if (_pfhandler_vec[i](utf)) return;
+  802b57:	4c 89 e7             	mov    %r12,%rdi
+  802b5a:	41 ff 54 dd 00       	call   *0x0(%r13,%rbx,8)
+  802b5f:	84 c0                	test   %al,%al
+  802b61:	75 45                	jne    802ba8 <_handle_vectored_pagefault+0x81>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  802b63:	48 83 c3 01          	add    $0x1,%rbx
+  802b67:	49 3b 1e             	cmp    (%r14),%rbx
+  802b6a:	72 eb                	jb     802b57 <_handle_vectored_pagefault+0x30>
+
+    /* Unhandled exceptions just cause panic */
+    panic("Userspace page fault rip=%08lX va=%08lX err=%x\n",
+  802b6c:	49 8b 8c 24 88 00 00 	mov    0x88(%r12),%rcx
+  802b73:	00 
+  802b74:	45 8b 4c 24 08       	mov    0x8(%r12),%r9d
+  802b79:	4d 8b 04 24          	mov    (%r12),%r8
+  802b7d:	48 ba 30 36 80 00 00 	movabs $0x803630,%rdx
+  802b84:	00 00 00 
+  802b87:	be 1d 00 00 00       	mov    $0x1d,%esi
+  802b8c:	48 bf 60 36 80 00 00 	movabs $0x803660,%rdi
+  802b93:	00 00 00 
+  802b96:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b9b:	49 ba 8b 1c 80 00 00 	movabs $0x801c8b,%r10
+  802ba2:	00 00 00 
+  802ba5:	41 ff d2             	call   *%r10
+          utf->utf_rip, utf->utf_fault_va, (int)utf->utf_err);
+}
+  802ba8:	5b                   	pop    %rbx
+  802ba9:	41 5c                	pop    %r12
+  802bab:	41 5d                	pop    %r13
+  802bad:	41 5e                	pop    %r14
+  802baf:	5d                   	pop    %rbp
+  802bb0:	c3                   	ret
+
+0000000000802bb1 <add_pgfault_handler>:
+ * The first time we register a handler, we need to
+ * allocate an exception stack (one page of memory with its top
+ * at USER_EXCEPTION_STACK_TOP), and tell the kernel to call the assembly-language
+ * _pgfault_upcall routine when a page fault occurs. */
+int
+add_pgfault_handler(pf_handler_t handler) {
+  802bb1:	55                   	push   %rbp
+  802bb2:	48 89 e5             	mov    %rsp,%rbp
+  802bb5:	53                   	push   %rbx
+  802bb6:	48 83 ec 08          	sub    $0x8,%rsp
+  802bba:	48 89 fb             	mov    %rdi,%rbx
+    int res = 0;
+  802bbd:	be 00 00 00 00       	mov    $0x0,%esi
+    if (!_pfhandler_inititiallized) {
+  802bc2:	48 b8 60 70 80 00 00 	movabs $0x807060,%rax
+  802bc9:	00 00 00 
+  802bcc:	80 38 00             	cmpb   $0x0,(%rax)
+  802bcf:	74 68                	je     802c39 <add_pgfault_handler+0x88>
+            goto end;
+        }
+        _pfhandler_inititiallized = 1;
+    }
+
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  802bd1:	48 b8 68 70 80 00 00 	movabs $0x807068,%rax
+  802bd8:	00 00 00 
+  802bdb:	48 8b 08             	mov    (%rax),%rcx
+  802bde:	ba 00 00 00 00       	mov    $0x0,%edx
+        if (handler == _pfhandler_vec[i]) return 0;
+  802be3:	48 b8 20 70 80 00 00 	movabs $0x807020,%rax
+  802bea:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  802bed:	48 85 c9             	test   %rcx,%rcx
+  802bf0:	0f 84 e0 00 00 00    	je     802cd6 <add_pgfault_handler+0x125>
+        if (handler == _pfhandler_vec[i]) return 0;
+  802bf6:	48 39 1c d0          	cmp    %rbx,(%rax,%rdx,8)
+  802bfa:	0f 84 c9 00 00 00    	je     802cc9 <add_pgfault_handler+0x118>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  802c00:	48 83 c2 01          	add    $0x1,%rdx
+  802c04:	48 39 ca             	cmp    %rcx,%rdx
+  802c07:	75 ed                	jne    802bf6 <add_pgfault_handler+0x45>
+
+    if (_pfhandler_off == MAX_PFHANDLER)
+  802c09:	48 83 f9 08          	cmp    $0x8,%rcx
+  802c0d:	0f 84 84 00 00 00    	je     802c97 <add_pgfault_handler+0xe6>
+        res = -E_INVAL;
+    else
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  802c13:	48 8d 41 01          	lea    0x1(%rcx),%rax
+  802c17:	48 a3 68 70 80 00 00 	movabs %rax,0x807068
+  802c1e:	00 00 00 
+  802c21:	48 b8 20 70 80 00 00 	movabs $0x807020,%rax
+  802c28:	00 00 00 
+  802c2b:	48 89 1c c8          	mov    %rbx,(%rax,%rcx,8)
+
+end:
+    if (res < 0) {
+  802c2f:	85 f6                	test   %esi,%esi
+  802c31:	0f 89 97 00 00 00    	jns    802cce <add_pgfault_handler+0x11d>
+  802c37:	eb 63                	jmp    802c9c <add_pgfault_handler+0xeb>
+        res = sys_alloc_region(0, (void*)(USER_EXCEPTION_STACK_TOP - USER_EXCEPTION_STACK_SIZE),
+  802c39:	b9 06 00 10 00       	mov    $0x100006,%ecx
+  802c3e:	ba 00 80 00 00       	mov    $0x8000,%edx
+  802c43:	48 be 00 80 ff ff 7f 	movabs $0x7fffff8000,%rsi
+  802c4a:	00 00 00 
+  802c4d:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c52:	48 b8 a6 02 80 00 00 	movabs $0x8002a6,%rax
+  802c59:	00 00 00 
+  802c5c:	ff d0                	call   *%rax
+  802c5e:	89 c6                	mov    %eax,%esi
+        if (res < 0) {
+  802c60:	85 c0                	test   %eax,%eax
+  802c62:	78 38                	js     802c9c <add_pgfault_handler+0xeb>
+        res = sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  802c64:	48 be e1 06 80 00 00 	movabs $0x8006e1,%rsi
+  802c6b:	00 00 00 
+  802c6e:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c73:	48 b8 e3 05 80 00 00 	movabs $0x8005e3,%rax
+  802c7a:	00 00 00 
+  802c7d:	ff d0                	call   *%rax
+  802c7f:	89 c6                	mov    %eax,%esi
+        if (res < 0) {
+  802c81:	85 c0                	test   %eax,%eax
+  802c83:	78 17                	js     802c9c <add_pgfault_handler+0xeb>
+        _pfhandler_inititiallized = 1;
+  802c85:	48 b8 60 70 80 00 00 	movabs $0x807060,%rax
+  802c8c:	00 00 00 
+  802c8f:	c6 00 01             	movb   $0x1,(%rax)
+  802c92:	e9 3a ff ff ff       	jmp    802bd1 <add_pgfault_handler+0x20>
+        res = -E_INVAL;
+  802c97:	be fd ff ff ff       	mov    $0xfffffffd,%esi
+        panic("set_pgfault_handler: %i", res);
+  802c9c:	89 f1                	mov    %esi,%ecx
+  802c9e:	48 ba 6e 36 80 00 00 	movabs $0x80366e,%rdx
+  802ca5:	00 00 00 
+  802ca8:	be 43 00 00 00       	mov    $0x43,%esi
+  802cad:	48 bf 60 36 80 00 00 	movabs $0x803660,%rdi
+  802cb4:	00 00 00 
+  802cb7:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cbc:	49 b8 8b 1c 80 00 00 	movabs $0x801c8b,%r8
+  802cc3:	00 00 00 
+  802cc6:	41 ff d0             	call   *%r8
+        if (handler == _pfhandler_vec[i]) return 0;
+  802cc9:	be 00 00 00 00       	mov    $0x0,%esi
+    }
+    return res;
+}
+  802cce:	89 f0                	mov    %esi,%eax
+  802cd0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802cd4:	c9                   	leave
+  802cd5:	c3                   	ret
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  802cd6:	48 b8 68 70 80 00 00 	movabs $0x807068,%rax
+  802cdd:	00 00 00 
+  802ce0:	48 c7 00 01 00 00 00 	movq   $0x1,(%rax)
+  802ce7:	48 89 d8             	mov    %rbx,%rax
+  802cea:	48 a3 20 70 80 00 00 	movabs %rax,0x807020
+  802cf1:	00 00 00 
+    if (res < 0) {
+  802cf4:	eb d8                	jmp    802cce <add_pgfault_handler+0x11d>
+
+0000000000802cf6 <remove_pgfault_handler>:
+
+void
+remove_pgfault_handler(pf_handler_t handler) {
+  802cf6:	55                   	push   %rbp
+  802cf7:	48 89 e5             	mov    %rsp,%rbp
+    assert(_pfhandler_inititiallized);
+  802cfa:	48 b8 60 70 80 00 00 	movabs $0x807060,%rax
+  802d01:	00 00 00 
+  802d04:	80 38 00             	cmpb   $0x0,(%rax)
+  802d07:	74 33                	je     802d3c <remove_pgfault_handler+0x46>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  802d09:	48 a1 68 70 80 00 00 	movabs 0x807068,%rax
+  802d10:	00 00 00 
+  802d13:	b9 00 00 00 00       	mov    $0x0,%ecx
+        if (_pfhandler_vec[i] == handler) {
+  802d18:	48 ba 20 70 80 00 00 	movabs $0x807020,%rdx
+  802d1f:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  802d22:	48 85 c0             	test   %rax,%rax
+  802d25:	0f 84 85 00 00 00    	je     802db0 <remove_pgfault_handler+0xba>
+        if (_pfhandler_vec[i] == handler) {
+  802d2b:	48 39 3c ca          	cmp    %rdi,(%rdx,%rcx,8)
+  802d2f:	74 40                	je     802d71 <remove_pgfault_handler+0x7b>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  802d31:	48 83 c1 01          	add    $0x1,%rcx
+  802d35:	48 39 c1             	cmp    %rax,%rcx
+  802d38:	75 f1                	jne    802d2b <remove_pgfault_handler+0x35>
+  802d3a:	eb 74                	jmp    802db0 <remove_pgfault_handler+0xba>
+    assert(_pfhandler_inititiallized);
+  802d3c:	48 b9 86 36 80 00 00 	movabs $0x803686,%rcx
+  802d43:	00 00 00 
+  802d46:	48 ba 67 30 80 00 00 	movabs $0x803067,%rdx
+  802d4d:	00 00 00 
+  802d50:	be 4a 00 00 00       	mov    $0x4a,%esi
+  802d55:	48 bf 60 36 80 00 00 	movabs $0x803660,%rdi
+  802d5c:	00 00 00 
+  802d5f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d64:	49 b8 8b 1c 80 00 00 	movabs $0x801c8b,%r8
+  802d6b:	00 00 00 
+  802d6e:	41 ff d0             	call   *%r8
+            memmove(_pfhandler_vec + i, _pfhandler_vec + i + 1, (_pfhandler_off - i - 1) * sizeof(*handler));
+  802d71:	48 8d 34 cd 08 00 00 	lea    0x8(,%rcx,8),%rsi
+  802d78:	00 
+  802d79:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  802d7d:	48 29 ca             	sub    %rcx,%rdx
+  802d80:	48 b8 20 70 80 00 00 	movabs $0x807020,%rax
+  802d87:	00 00 00 
+  802d8a:	48 8d 0c 06          	lea    (%rsi,%rax,1),%rcx
+  802d8e:	48 8d 7c 30 f8       	lea    -0x8(%rax,%rsi,1),%rdi
+  802d93:	48 89 ce             	mov    %rcx,%rsi
+  802d96:	48 b8 fa 28 80 00 00 	movabs $0x8028fa,%rax
+  802d9d:	00 00 00 
+  802da0:	ff d0                	call   *%rax
+            _pfhandler_off--;
+  802da2:	48 b8 68 70 80 00 00 	movabs $0x807068,%rax
+  802da9:	00 00 00 
+  802dac:	48 83 28 01          	subq   $0x1,(%rax)
+            return;
+        }
+    }
+}
+  802db0:	5d                   	pop    %rbp
+  802db1:	c3                   	ret
+
+0000000000802db2 <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  802db2:	55                   	push   %rbp
+  802db3:	48 89 e5             	mov    %rsp,%rbp
+  802db6:	41 55                	push   %r13
+  802db8:	41 54                	push   %r12
+  802dba:	53                   	push   %rbx
+  802dbb:	48 83 ec 08          	sub    $0x8,%rsp
+  802dbf:	49 89 fc             	mov    %rdi,%r12
+  802dc2:	48 89 f7             	mov    %rsi,%rdi
+  802dc5:	48 89 d3             	mov    %rdx,%rbx
+  802dc8:	49 89 cd             	mov    %rcx,%r13
+    // LAB 9: Your code here:
+    int res = sys_ipc_recv(!pg ? (void*)MAX_USER_ADDRESS : pg, !size ? 0 : *size);
+  802dcb:	be 00 00 00 00       	mov    $0x0,%esi
+  802dd0:	48 85 d2             	test   %rdx,%rdx
+  802dd3:	74 03                	je     802dd8 <ipc_recv+0x26>
+  802dd5:	48 8b 32             	mov    (%rdx),%rsi
+  802dd8:	48 85 ff             	test   %rdi,%rdi
+  802ddb:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802de2:	00 00 00 
+  802de5:	48 0f 44 f8          	cmove  %rax,%rdi
+  802de9:	48 b8 78 06 80 00 00 	movabs $0x800678,%rax
+  802df0:	00 00 00 
+  802df3:	ff d0                	call   *%rax
+    if (res < 0) {
+  802df5:	85 c0                	test   %eax,%eax
+  802df7:	78 66                	js     802e5f <ipc_recv+0xad>
+        if (size) {
+            *size = 0;
+        }
+        return res;
+    }
+    if (from_env_store) {
+  802df9:	4d 85 e4             	test   %r12,%r12
+  802dfc:	74 14                	je     802e12 <ipc_recv+0x60>
+        *from_env_store = thisenv->env_ipc_from;
+  802dfe:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802e05:	00 00 00 
+  802e08:	8b 80 ac 01 00 00    	mov    0x1ac(%rax),%eax
+  802e0e:	41 89 04 24          	mov    %eax,(%r12)
+    }
+    if (perm_store) {
+  802e12:	4d 85 ed             	test   %r13,%r13
+  802e15:	74 14                	je     802e2b <ipc_recv+0x79>
+        *perm_store = thisenv->env_ipc_perm;
+  802e17:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802e1e:	00 00 00 
+  802e21:	8b 80 b0 01 00 00    	mov    0x1b0(%rax),%eax
+  802e27:	41 89 45 00          	mov    %eax,0x0(%r13)
+    }
+    if (size) {
+  802e2b:	48 85 db             	test   %rbx,%rbx
+  802e2e:	74 14                	je     802e44 <ipc_recv+0x92>
+        *size = thisenv->env_ipc_maxsz;
+  802e30:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802e37:	00 00 00 
+  802e3a:	48 8b 80 a0 01 00 00 	mov    0x1a0(%rax),%rax
+  802e41:	48 89 03             	mov    %rax,(%rbx)
+    }
+    return thisenv->env_ipc_value;
+  802e44:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802e4b:	00 00 00 
+  802e4e:	8b 80 a8 01 00 00    	mov    0x1a8(%rax),%eax
+}
+  802e54:	48 83 c4 08          	add    $0x8,%rsp
+  802e58:	5b                   	pop    %rbx
+  802e59:	41 5c                	pop    %r12
+  802e5b:	41 5d                	pop    %r13
+  802e5d:	5d                   	pop    %rbp
+  802e5e:	c3                   	ret
+        if (from_env_store) {
+  802e5f:	4d 85 e4             	test   %r12,%r12
+  802e62:	74 08                	je     802e6c <ipc_recv+0xba>
+            *from_env_store = 0;
+  802e64:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  802e6b:	00 
+        if (perm_store) {
+  802e6c:	4d 85 ed             	test   %r13,%r13
+  802e6f:	74 08                	je     802e79 <ipc_recv+0xc7>
+            *perm_store = 0;
+  802e71:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  802e78:	00 
+        if (size) {
+  802e79:	48 85 db             	test   %rbx,%rbx
+  802e7c:	74 d6                	je     802e54 <ipc_recv+0xa2>
+            *size = 0;
+  802e7e:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  802e85:	eb cd                	jmp    802e54 <ipc_recv+0xa2>
+
+0000000000802e87 <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  802e87:	55                   	push   %rbp
+  802e88:	48 89 e5             	mov    %rsp,%rbp
+  802e8b:	41 57                	push   %r15
+  802e8d:	41 56                	push   %r14
+  802e8f:	41 55                	push   %r13
+  802e91:	41 54                	push   %r12
+  802e93:	53                   	push   %rbx
+  802e94:	48 83 ec 18          	sub    $0x18,%rsp
+  802e98:	41 89 fd             	mov    %edi,%r13d
+  802e9b:	89 75 cc             	mov    %esi,-0x34(%rbp)
+  802e9e:	49 89 cc             	mov    %rcx,%r12
+  802ea1:	44 89 45 c8          	mov    %r8d,-0x38(%rbp)
+    // LAB 9: Your code here:
+    int res = 0;
+    while ((res = sys_ipc_try_send(to_env, val, !pg ? (void*)MAX_USER_ADDRESS : pg, size, perm)) < 0) {
+  802ea5:	48 85 d2             	test   %rdx,%rdx
+  802ea8:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802eaf:	00 00 00 
+  802eb2:	48 0f 45 c2          	cmovne %rdx,%rax
+  802eb6:	48 89 c3             	mov    %rax,%rbx
+  802eb9:	49 be 4c 06 80 00 00 	movabs $0x80064c,%r14
+  802ec0:	00 00 00 
+        if (res != -E_IPC_NOT_RECV) {
+            panic("sys_ipc_try_send failed: %i", res);
+        }
+        sys_yield();
+  802ec3:	49 bf 17 02 80 00 00 	movabs $0x800217,%r15
+  802eca:	00 00 00 
+    while ((res = sys_ipc_try_send(to_env, val, !pg ? (void*)MAX_USER_ADDRESS : pg, size, perm)) < 0) {
+  802ecd:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  802ed0:	44 8b 45 c8          	mov    -0x38(%rbp),%r8d
+  802ed4:	4c 89 e1             	mov    %r12,%rcx
+  802ed7:	48 89 da             	mov    %rbx,%rdx
+  802eda:	44 89 ef             	mov    %r13d,%edi
+  802edd:	41 ff d6             	call   *%r14
+  802ee0:	85 c0                	test   %eax,%eax
+  802ee2:	79 37                	jns    802f1b <ipc_send+0x94>
+        if (res != -E_IPC_NOT_RECV) {
+  802ee4:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  802ee7:	75 05                	jne    802eee <ipc_send+0x67>
+        sys_yield();
+  802ee9:	41 ff d7             	call   *%r15
+  802eec:	eb df                	jmp    802ecd <ipc_send+0x46>
+            panic("sys_ipc_try_send failed: %i", res);
+  802eee:	89 c1                	mov    %eax,%ecx
+  802ef0:	48 ba a0 36 80 00 00 	movabs $0x8036a0,%rdx
+  802ef7:	00 00 00 
+  802efa:	be 40 00 00 00       	mov    $0x40,%esi
+  802eff:	48 bf bc 36 80 00 00 	movabs $0x8036bc,%rdi
+  802f06:	00 00 00 
+  802f09:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f0e:	49 b8 8b 1c 80 00 00 	movabs $0x801c8b,%r8
+  802f15:	00 00 00 
+  802f18:	41 ff d0             	call   *%r8
+    }
+    return;
+}
+  802f1b:	48 83 c4 18          	add    $0x18,%rsp
+  802f1f:	5b                   	pop    %rbx
+  802f20:	41 5c                	pop    %r12
+  802f22:	41 5d                	pop    %r13
+  802f24:	41 5e                	pop    %r14
+  802f26:	41 5f                	pop    %r15
+  802f28:	5d                   	pop    %rbp
+  802f29:	c3                   	ret
+
+0000000000802f2a <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  802f2a:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  802f2f:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  802f36:	00 00 00 
+  802f39:	48 69 d0 d0 01 00 00 	imul   $0x1d0,%rax,%rdx
+  802f40:	48 01 ca             	add    %rcx,%rdx
+  802f43:	8b 92 e8 00 00 00    	mov    0xe8(%rdx),%edx
+  802f49:	39 fa                	cmp    %edi,%edx
+  802f4b:	74 12                	je     802f5f <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  802f4d:	48 83 c0 01          	add    $0x1,%rax
+  802f51:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  802f57:	75 e0                	jne    802f39 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  802f59:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802f5e:	c3                   	ret
+            return envs[i].env_id;
+  802f5f:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+  802f66:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  802f6d:	00 00 00 
+  802f70:	48 01 d0             	add    %rdx,%rax
+  802f73:	8b 80 e0 00 00 00    	mov    0xe0(%rax),%eax
+  802f79:	c3                   	ret
+  802f7a:	66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+
+0000000000802f80 <__rodata_start>:
+  802f80:	3c 75                	cmp    $0x75,%al
+  802f82:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802f83:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  802f87:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802f88:	3e 00 66 0f          	ds add %ah,0xf(%rsi)
+  802f8c:	1f                   	(bad)
+  802f8d:	44 00 00             	add    %r8b,(%rax)
+  802f90:	73 79                	jae    80300b <__rodata_start+0x8b>
+  802f92:	73 63                	jae    802ff7 <__rodata_start+0x77>
+  802f94:	61                   	(bad)
+  802f95:	6c                   	insb   (%dx),%es:(%rdi)
+  802f96:	6c                   	insb   (%dx),%es:(%rdi)
+  802f97:	20 25 7a 64 20 72    	and    %ah,0x7220647a(%rip)        # 72a09417 <__bss_end+0x72201417>
+  802f9d:	65 74 75             	gs je  803015 <__rodata_start+0x95>
+  802fa0:	72 6e                	jb     803010 <__rodata_start+0x90>
+  802fa2:	65 64 20 25 7a 64 20 	gs and %ah,%fs:0x2820647a(%rip)        # 28a09424 <__bss_end+0x28201424>
+  802fa9:	28 
+  802faa:	3e 20 30             	ds and %dh,(%rax)
+  802fad:	29 00                	sub    %eax,(%rax)
+  802faf:	6c                   	insb   (%dx),%es:(%rdi)
+  802fb0:	69 62 2f 73 79 73 63 	imul   $0x63737973,0x2f(%rdx),%esp
+  802fb7:	61                   	(bad)
+  802fb8:	6c                   	insb   (%dx),%es:(%rdi)
+  802fb9:	6c                   	insb   (%dx),%es:(%rdi)
+  802fba:	2e 63 00             	cs movsxd (%rax),%eax
+  802fbd:	0f 1f 00             	nopl   (%rax)
+  802fc0:	5b                   	pop    %rbx
+  802fc1:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  802fc6:	20 75 6e             	and    %dh,0x6e(%rbp)
+  802fc9:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  802fcd:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802fce:	20 64 65 76          	and    %ah,0x76(%rbp,%riz,2)
+  802fd2:	69 63 65 20 74 79 70 	imul   $0x70797420,0x65(%rbx),%esp
+  802fd9:	65 20 25 64 0a 00 00 	and    %ah,%gs:0xa64(%rip)        # 803a44 <error_string+0x4e4>
+  802fe0:	5b                   	pop    %rbx
+  802fe1:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  802fe6:	20 66 74             	and    %ah,0x74(%rsi)
+  802fe9:	72 75                	jb     803060 <devtab+0x20>
+  802feb:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802fec:	63 61 74             	movsxd 0x74(%rcx),%esp
+  802fef:	65 20 25 64 20 2d 2d 	and    %ah,%gs:0x2d2d2064(%rip)        # 2dad505a <__bss_end+0x2d2cd05a>
+  802ff6:	20 62 61             	and    %ah,0x61(%rdx)
+  802ff9:	64 20 6d 6f          	and    %ch,%fs:0x6f(%rbp)
+  802ffd:	64 65 0a 00          	fs or  %gs:(%rax),%al
+  803001:	5b                   	pop    %rbx
+  803002:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  803007:	20 72 65             	and    %dh,0x65(%rdx)
+  80300a:	61                   	(bad)
+  80300b:	64 20 25 64 20 2d 2d 	and    %ah,%fs:0x2d2d2064(%rip)        # 2dad5076 <__bss_end+0x2d2cd076>
+  803012:	20 62 61             	and    %ah,0x61(%rdx)
+  803015:	64 20 6d 6f          	and    %ch,%fs:0x6f(%rbp)
+  803019:	64 65 0a 00          	fs or  %gs:(%rax),%al
+  80301d:	5b                   	pop    %rbx
+  80301e:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  803023:	20 77 72             	and    %dh,0x72(%rdi)
+  803026:	69 74 65 20 25 64 20 	imul   $0x2d206425,0x20(%rbp,%riz,2),%esi
+  80302d:	2d 
+  80302e:	2d 20 62 61 64       	sub    $0x64616220,%eax
+  803033:	20 6d 6f             	and    %ch,0x6f(%rbp)
+  803036:	64 65 0a 00          	fs or  %gs:(%rax),%al
+  80303a:	66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+
+0000000000803040 <devtab>:
+  803040:	20 40 80 00 00 00 00 00 60 40 80 00 00 00 00 00      @......`@......
+  803050:	a0 40 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .@..............
+  803060:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  803070:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  803080:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  803090:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  8030a0:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  8030b0:	3d 20 32 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73 00     = 2.<cons>.cons.
+  8030c0:	5b 25 30 38 78 5d 20 75 73 65 72 20 70 61 6e 69     [%08x] user pani
+  8030d0:	63 20 69 6e 20 25 73 20 61 74 20 25 73 3a 25 64     c in %s at %s:%d
+  8030e0:	3a 20 00 30 31 32 33 34 35 36 37 38 39 41 42 43     : .0123456789ABC
+  8030f0:	44 45 46 00 30 31 32 33 34 35 36 37 38 39 61 62     DEF.0123456789ab
+  803100:	63 64 65 66 00 28 6e 75 6c 6c 29 00 65 72 72 6f     cdef.(null).erro
+  803110:	72 20 25 64 00 75 6e 73 70 65 63 69 66 69 65 64     r %d.unspecified
+  803120:	20 65 72 72 6f 72 00 62 61 64 20 65 6e 76 69 72      error.bad envir
+  803130:	6f 6e 6d 65 6e 74 00 69 6e 76 61 6c 69 64 20 70     onment.invalid p
+  803140:	61 72 61 6d 65 74 65 72 00 6f 75 74 20 6f 66 20     arameter.out of 
+  803150:	6d 65 6d 6f 72 79 00 6f 75 74 20 6f 66 20 65 6e     memory.out of en
+  803160:	76 69 72 6f 6e 6d 65 6e 74 73 00 63 6f 72 72 75     vironments.corru
+  803170:	70 74 65 64 20 64 65 62 75 67 20 69 6e 66 6f 00     pted debug info.
+  803180:	73 65 67 6d 65 6e 74 61 74 69 6f 6e 20 66 61 75     segmentation fau
+  803190:	6c 74 00 69 6e 76 61 6c 69 64 20 45 4c 46 20 69     lt.invalid ELF i
+  8031a0:	6d 61 67 65 00 6e 6f 20 73 75 63 68 20 73 79 73     mage.no such sys
+  8031b0:	74 65 6d 20 63 61 6c 6c 00 65 6e 74 72 79 20 6e     tem call.entry n
+  8031c0:	6f 74 20 66 6f 75 6e 64 00 65 6e 76 20 69 73 20     ot found.env is 
+  8031d0:	6e 6f 74 20 72 65 63 76 69 6e 67 00 75 6e 65 78     not recving.unex
+  8031e0:	70 65 63 74 65 64 20 65 6e 64 20 6f 66 20 66 69     pected end of fi
+  8031f0:	6c 65 00 6e 6f 20 66 72 65 65 20 73 70 61 63 65     le.no free space
+  803200:	20 6f 6e 20 64 69 73 6b 00 74 6f 6f 20 6d 61 6e      on disk.too man
+  803210:	79 20 66 69 6c 65 73 20 61 72 65 20 6f 70 65 6e     y files are open
+  803220:	00 66 69 6c 65 20 6f 72 20 62 6c 6f 63 6b 20 6e     .file or block n
+  803230:	6f 74 20 66 6f 75 6e 64 00 69 6e 76 61 6c 69 64     ot found.invalid
+  803240:	20 70 61 74 68 00 66 69 6c 65 20 61 6c 72 65 61      path.file alrea
+  803250:	64 79 20 65 78 69 73 74 73 00 6f 70 65 72 61 74     dy exists.operat
+  803260:	69 6f 6e 20 6e 6f 74 20 73 75 70 70 6f 72 74 65     ion not supporte
+  803270:	64 00 6f 70 65 72 61 74 69 6f 6e 20 69 6e 74 65     d.operation inte
+  803280:	72 72 75 70 74 65 64 00 6e 6f 74 20 65 6e 6f 75     rrupted.not enou
+  803290:	67 68 20 43 50 55 20 74 69 6d 65 00 0f 1f 40 00     gh CPU time...@.
+  8032a0:	c8 1f 80 00 00 00 00 00 09 26 80 00 00 00 00 00     .........&......
+  8032b0:	f9 25 80 00 00 00 00 00 09 26 80 00 00 00 00 00     .%.......&......
+  8032c0:	09 26 80 00 00 00 00 00 09 26 80 00 00 00 00 00     .&.......&......
+  8032d0:	09 26 80 00 00 00 00 00 e7 1f 80 00 00 00 00 00     .&..............
+  8032e0:	09 26 80 00 00 00 00 00 09 26 80 00 00 00 00 00     .&.......&......
+  8032f0:	db 1f 80 00 00 00 00 00 55 20 80 00 00 00 00 00     ........U ......
+  803300:	09 26 80 00 00 00 00 00 db 1f 80 00 00 00 00 00     .&..............
+  803310:	21 20 80 00 00 00 00 00 21 20 80 00 00 00 00 00     ! ......! ......
+  803320:	21 20 80 00 00 00 00 00 21 20 80 00 00 00 00 00     ! ......! ......
+  803330:	21 20 80 00 00 00 00 00 21 20 80 00 00 00 00 00     ! ......! ......
+  803340:	21 20 80 00 00 00 00 00 21 20 80 00 00 00 00 00     ! ......! ......
+  803350:	21 20 80 00 00 00 00 00 09 26 80 00 00 00 00 00     ! .......&......
+  803360:	09 26 80 00 00 00 00 00 09 26 80 00 00 00 00 00     .&.......&......
+  803370:	09 26 80 00 00 00 00 00 09 26 80 00 00 00 00 00     .&.......&......
+  803380:	09 26 80 00 00 00 00 00 09 26 80 00 00 00 00 00     .&.......&......
+  803390:	09 26 80 00 00 00 00 00 09 26 80 00 00 00 00 00     .&.......&......
+  8033a0:	09 26 80 00 00 00 00 00 09 26 80 00 00 00 00 00     .&.......&......
+  8033b0:	09 26 80 00 00 00 00 00 09 26 80 00 00 00 00 00     .&.......&......
+  8033c0:	09 26 80 00 00 00 00 00 09 26 80 00 00 00 00 00     .&.......&......
+  8033d0:	09 26 80 00 00 00 00 00 09 26 80 00 00 00 00 00     .&.......&......
+  8033e0:	09 26 80 00 00 00 00 00 09 26 80 00 00 00 00 00     .&.......&......
+  8033f0:	09 26 80 00 00 00 00 00 09 26 80 00 00 00 00 00     .&.......&......
+  803400:	09 26 80 00 00 00 00 00 09 26 80 00 00 00 00 00     .&.......&......
+  803410:	09 26 80 00 00 00 00 00 09 26 80 00 00 00 00 00     .&.......&......
+  803420:	09 26 80 00 00 00 00 00 09 26 80 00 00 00 00 00     .&.......&......
+  803430:	09 26 80 00 00 00 00 00 09 26 80 00 00 00 00 00     .&.......&......
+  803440:	09 26 80 00 00 00 00 00 2c 25 80 00 00 00 00 00     .&......,%......
+  803450:	09 26 80 00 00 00 00 00 09 26 80 00 00 00 00 00     .&.......&......
+  803460:	09 26 80 00 00 00 00 00 09 26 80 00 00 00 00 00     .&.......&......
+  803470:	09 26 80 00 00 00 00 00 09 26 80 00 00 00 00 00     .&.......&......
+  803480:	09 26 80 00 00 00 00 00 09 26 80 00 00 00 00 00     .&.......&......
+  803490:	09 26 80 00 00 00 00 00 09 26 80 00 00 00 00 00     .&.......&......
+  8034a0:	78 20 80 00 00 00 00 00 47 22 80 00 00 00 00 00     x ......G"......
+  8034b0:	09 26 80 00 00 00 00 00 09 26 80 00 00 00 00 00     .&.......&......
+  8034c0:	09 26 80 00 00 00 00 00 09 26 80 00 00 00 00 00     .&.......&......
+  8034d0:	a7 20 80 00 00 00 00 00 09 26 80 00 00 00 00 00     . .......&......
+  8034e0:	09 26 80 00 00 00 00 00 6d 20 80 00 00 00 00 00     .&......m ......
+  8034f0:	09 26 80 00 00 00 00 00 09 26 80 00 00 00 00 00     .&.......&......
+  803500:	ef 23 80 00 00 00 00 00 b9 24 80 00 00 00 00 00     .#.......$......
+  803510:	09 26 80 00 00 00 00 00 09 26 80 00 00 00 00 00     .&.......&......
+  803520:	3e 21 80 00 00 00 00 00 09 26 80 00 00 00 00 00     >!.......&......
+  803530:	1b 23 80 00 00 00 00 00 09 26 80 00 00 00 00 00     .#.......&......
+  803540:	09 26 80 00 00 00 00 00 2c 25 80 00 00 00 00 00     .&......,%......
+  803550:	09 26 80 00 00 00 00 00 d1 1f 80 00 00 00 00 00     .&..............
+
+0000000000803560 <error_string>:
+	...
+  803568:	15 31 80 00 00 00 00 00 27 31 80 00 00 00 00 00     .1......'1......
+  803578:	37 31 80 00 00 00 00 00 49 31 80 00 00 00 00 00     71......I1......
+  803588:	57 31 80 00 00 00 00 00 6b 31 80 00 00 00 00 00     W1......k1......
+  803598:	80 31 80 00 00 00 00 00 93 31 80 00 00 00 00 00     .1.......1......
+  8035a8:	a5 31 80 00 00 00 00 00 b9 31 80 00 00 00 00 00     .1.......1......
+  8035b8:	c9 31 80 00 00 00 00 00 dc 31 80 00 00 00 00 00     .1.......1......
+  8035c8:	f3 31 80 00 00 00 00 00 09 32 80 00 00 00 00 00     .1.......2......
+  8035d8:	21 32 80 00 00 00 00 00 39 32 80 00 00 00 00 00     !2......92......
+  8035e8:	46 32 80 00 00 00 00 00 10 36 80 00 00 00 00 00     F2.......6......
+  8035f8:	5a 32 80 00 00 00 00 00 72 32 80 00 00 00 00 00     Z2......r2......
+  803608:	88 32 80 00 00 00 00 00 66 69 6c 65 20 69 73 20     .2......file is 
+  803618:	6e 6f 74 20 61 20 76 61 6c 69 64 20 65 78 65 63     not a valid exec
+  803628:	75 74 61 62 6c 65 00 90 55 73 65 72 73 70 61 63     utable..Userspac
+  803638:	65 20 70 61 67 65 20 66 61 75 6c 74 20 72 69 70     e page fault rip
+  803648:	3d 25 30 38 6c 58 20 76 61 3d 25 30 38 6c 58 20     =%08lX va=%08lX 
+  803658:	65 72 72 3d 25 78 0a 00 6c 69 62 2f 70 67 66 61     err=%x..lib/pgfa
+  803668:	75 6c 74 2e 63 00 73 65 74 5f 70 67 66 61 75 6c     ult.c.set_pgfaul
+  803678:	74 5f 68 61 6e 64 6c 65 72 3a 20 25 69 00 5f 70     t_handler: %i._p
+  803688:	66 68 61 6e 64 6c 65 72 5f 69 6e 69 74 69 74 69     fhandler_inititi
+  803698:	61 6c 6c 69 7a 65 64 00 73 79 73 5f 69 70 63 5f     allized.sys_ipc_
+  8036a8:	74 72 79 5f 73 65 6e 64 20 66 61 69 6c 65 64 3a     try_send failed:
+  8036b8:	20 25 69 00 6c 69 62 2f 69 70 63 2e 63 00 66 2e      %i.lib/ipc.c.f.
+  8036c8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8036d8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8036e8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8036f8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803708:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803718:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803728:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803738:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803748:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803758:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803768:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803778:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803788:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803798:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8037a8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8037b8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8037c8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8037d8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8037e8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8037f8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803808:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803818:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803828:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803838:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803848:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803858:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803868:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803878:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803888:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803898:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8038a8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8038b8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8038c8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8038d8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8038e8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8038f8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803908:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803918:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803928:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803938:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803948:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803958:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803968:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803978:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803988:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803998:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8039a8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8039b8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8039c8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8039d8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8039e8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8039f8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803a08:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803a18:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803a28:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803a38:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803a48:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803a58:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803a68:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803a78:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803a88:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803a98:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803aa8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803ab8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803ac8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803ad8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803ae8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803af8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803b08:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803b18:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803b28:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803b38:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803b48:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803b58:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803b68:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803b78:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803b88:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803b98:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803ba8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803bb8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803bc8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803bd8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803be8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803bf8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803c08:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803c18:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803c28:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803c38:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803c48:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803c58:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803c68:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803c78:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803c88:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803c98:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803ca8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803cb8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803cc8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803cd8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803ce8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803cf8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803d08:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803d18:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803d28:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803d38:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803d48:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803d58:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803d68:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803d78:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803d88:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803d98:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803da8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803db8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803dc8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803dd8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803de8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803df8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803e08:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803e18:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803e28:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803e38:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803e48:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803e58:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803e68:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803e78:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803e88:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803e98:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803ea8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803eb8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803ec8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803ed8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803ee8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803ef8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803f08:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803f18:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803f28:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803f38:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803f48:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803f58:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803f68:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803f78:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803f88:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803f98:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803fa8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803fb8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803fc8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803fd8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803fe8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803ff8:	84 00 00 00 00 00 66 90                             ......f.
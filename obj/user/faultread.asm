@@ -0,0 +1,5713 @@
+
+obj/user/faultread:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 2a 00 00 00       	call   80004d <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+/* Buggy program - faults with a read from location zero */
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+#ifndef __clang_analyzer__
+    cprintf("I read %08x from location 0!\n", *(volatile unsigned *)0);
+  800029:	8b 34 25 00 00 00 00 	mov    0x0,%esi
+  800030:	48 bf 98 2c 80 00 00 	movabs $0x802c98,%rdi
+  800037:	00 00 00 
+  80003a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80003f:	48 ba c6 01 80 00 00 	movabs $0x8001c6,%rdx
+  800046:	00 00 00 
+  800049:	ff d2                	call   *%rdx
+#endif
+}
+  80004b:	5d                   	pop    %rbp
+  80004c:	c3                   	ret
+
+000000000080004d <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  80004d:	55                   	push   %rbp
+  80004e:	48 89 e5             	mov    %rsp,%rbp
+  800051:	41 56                	push   %r14
+  800053:	41 55                	push   %r13
+  800055:	41 54                	push   %r12
+  800057:	53                   	push   %rbx
+  800058:	41 89 fd             	mov    %edi,%r13d
+  80005b:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  80005e:	48 ba d8 40 80 00 00 	movabs $0x8040d8,%rdx
+  800065:	00 00 00 
+  800068:	48 b8 d8 40 80 00 00 	movabs $0x8040d8,%rax
+  80006f:	00 00 00 
+  800072:	48 39 c2             	cmp    %rax,%rdx
+  800075:	73 17                	jae    80008e <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  800077:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  80007a:	49 89 c4             	mov    %rax,%r12
+  80007d:	48 83 c3 08          	add    $0x8,%rbx
+  800081:	b8 00 00 00 00       	mov    $0x0,%eax
+  800086:	ff 53 f8             	call   *-0x8(%rbx)
+  800089:	4c 39 e3             	cmp    %r12,%rbx
+  80008c:	72 ef                	jb     80007d <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+    envid_t this_env_id = sys_getenvid();
+  80008e:	48 b8 db 0f 80 00 00 	movabs $0x800fdb,%rax
+  800095:	00 00 00 
+  800098:	ff d0                	call   *%rax
+    thisenv = &((struct Env*)UENVS)[ENVX(this_env_id)];
+  80009a:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80009f:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+  8000a6:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8000ad:	00 00 00 
+  8000b0:	48 01 d0             	add    %rdx,%rax
+  8000b3:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  8000ba:	00 00 00 
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8000bd:	45 85 ed             	test   %r13d,%r13d
+  8000c0:	7e 0d                	jle    8000cf <libmain+0x82>
+  8000c2:	49 8b 06             	mov    (%r14),%rax
+  8000c5:	48 a3 00 40 80 00 00 	movabs %rax,0x804000
+  8000cc:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8000cf:	4c 89 f6             	mov    %r14,%rsi
+  8000d2:	44 89 ef             	mov    %r13d,%edi
+  8000d5:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8000dc:	00 00 00 
+  8000df:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8000e1:	48 b8 f6 00 80 00 00 	movabs $0x8000f6,%rax
+  8000e8:	00 00 00 
+  8000eb:	ff d0                	call   *%rax
+#endif
+}
+  8000ed:	5b                   	pop    %rbx
+  8000ee:	41 5c                	pop    %r12
+  8000f0:	41 5d                	pop    %r13
+  8000f2:	41 5e                	pop    %r14
+  8000f4:	5d                   	pop    %rbp
+  8000f5:	c3                   	ret
+
+00000000008000f6 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8000f6:	55                   	push   %rbp
+  8000f7:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  8000fa:	48 b8 2f 17 80 00 00 	movabs $0x80172f,%rax
+  800101:	00 00 00 
+  800104:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  800106:	bf 00 00 00 00       	mov    $0x0,%edi
+  80010b:	48 b8 70 0f 80 00 00 	movabs $0x800f70,%rax
+  800112:	00 00 00 
+  800115:	ff d0                	call   *%rax
+}
+  800117:	5d                   	pop    %rbp
+  800118:	c3                   	ret
+
+0000000000800119 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  800119:	55                   	push   %rbp
+  80011a:	48 89 e5             	mov    %rsp,%rbp
+  80011d:	53                   	push   %rbx
+  80011e:	48 83 ec 08          	sub    $0x8,%rsp
+  800122:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  800125:	8b 06                	mov    (%rsi),%eax
+  800127:	8d 50 01             	lea    0x1(%rax),%edx
+  80012a:	89 16                	mov    %edx,(%rsi)
+  80012c:	48 98                	cltq
+  80012e:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  800133:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  800139:	74 0a                	je     800145 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  80013b:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  80013f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800143:	c9                   	leave
+  800144:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  800145:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  800149:	be ff 00 00 00       	mov    $0xff,%esi
+  80014e:	48 b8 12 0f 80 00 00 	movabs $0x800f12,%rax
+  800155:	00 00 00 
+  800158:	ff d0                	call   *%rax
+        state->offset = 0;
+  80015a:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  800160:	eb d9                	jmp    80013b <putch+0x22>
+
+0000000000800162 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  800162:	55                   	push   %rbp
+  800163:	48 89 e5             	mov    %rsp,%rbp
+  800166:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  80016d:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  800170:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  800177:	b9 21 00 00 00       	mov    $0x21,%ecx
+  80017c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800181:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  800184:	48 89 f1             	mov    %rsi,%rcx
+  800187:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  80018e:	48 bf 19 01 80 00 00 	movabs $0x800119,%rdi
+  800195:	00 00 00 
+  800198:	48 b8 16 03 80 00 00 	movabs $0x800316,%rax
+  80019f:	00 00 00 
+  8001a2:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  8001a4:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  8001ab:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  8001b2:	48 b8 12 0f 80 00 00 	movabs $0x800f12,%rax
+  8001b9:	00 00 00 
+  8001bc:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  8001be:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  8001c4:	c9                   	leave
+  8001c5:	c3                   	ret
+
+00000000008001c6 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  8001c6:	55                   	push   %rbp
+  8001c7:	48 89 e5             	mov    %rsp,%rbp
+  8001ca:	48 83 ec 50          	sub    $0x50,%rsp
+  8001ce:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8001d2:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8001d6:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8001da:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8001de:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  8001e2:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  8001e9:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8001ed:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8001f1:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8001f5:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  8001f9:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  8001fd:	48 b8 62 01 80 00 00 	movabs $0x800162,%rax
+  800204:	00 00 00 
+  800207:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  800209:	c9                   	leave
+  80020a:	c3                   	ret
+
+000000000080020b <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  80020b:	55                   	push   %rbp
+  80020c:	48 89 e5             	mov    %rsp,%rbp
+  80020f:	41 57                	push   %r15
+  800211:	41 56                	push   %r14
+  800213:	41 55                	push   %r13
+  800215:	41 54                	push   %r12
+  800217:	53                   	push   %rbx
+  800218:	48 83 ec 18          	sub    $0x18,%rsp
+  80021c:	49 89 fc             	mov    %rdi,%r12
+  80021f:	49 89 f5             	mov    %rsi,%r13
+  800222:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800226:	8b 45 10             	mov    0x10(%rbp),%eax
+  800229:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  80022c:	41 89 cf             	mov    %ecx,%r15d
+  80022f:	4c 39 fa             	cmp    %r15,%rdx
+  800232:	73 5b                	jae    80028f <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  800234:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  800238:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  80023c:	85 db                	test   %ebx,%ebx
+  80023e:	7e 0e                	jle    80024e <print_num+0x43>
+            putch(padc, put_arg);
+  800240:	4c 89 ee             	mov    %r13,%rsi
+  800243:	44 89 f7             	mov    %r14d,%edi
+  800246:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  800249:	83 eb 01             	sub    $0x1,%ebx
+  80024c:	75 f2                	jne    800240 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  80024e:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  800252:	48 b9 d1 2c 80 00 00 	movabs $0x802cd1,%rcx
+  800259:	00 00 00 
+  80025c:	48 b8 c0 2c 80 00 00 	movabs $0x802cc0,%rax
+  800263:	00 00 00 
+  800266:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  80026a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80026e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800273:	49 f7 f7             	div    %r15
+  800276:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  80027a:	4c 89 ee             	mov    %r13,%rsi
+  80027d:	41 ff d4             	call   *%r12
+}
+  800280:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800284:	5b                   	pop    %rbx
+  800285:	41 5c                	pop    %r12
+  800287:	41 5d                	pop    %r13
+  800289:	41 5e                	pop    %r14
+  80028b:	41 5f                	pop    %r15
+  80028d:	5d                   	pop    %rbp
+  80028e:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  80028f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800293:	ba 00 00 00 00       	mov    $0x0,%edx
+  800298:	49 f7 f7             	div    %r15
+  80029b:	48 83 ec 08          	sub    $0x8,%rsp
+  80029f:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  8002a3:	52                   	push   %rdx
+  8002a4:	45 0f be c9          	movsbl %r9b,%r9d
+  8002a8:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  8002ac:	48 89 c2             	mov    %rax,%rdx
+  8002af:	48 b8 0b 02 80 00 00 	movabs $0x80020b,%rax
+  8002b6:	00 00 00 
+  8002b9:	ff d0                	call   *%rax
+  8002bb:	48 83 c4 10          	add    $0x10,%rsp
+  8002bf:	eb 8d                	jmp    80024e <print_num+0x43>
+
+00000000008002c1 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  8002c1:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  8002c5:	48 8b 06             	mov    (%rsi),%rax
+  8002c8:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  8002cc:	73 0a                	jae    8002d8 <sprintputch+0x17>
+        *state->start++ = ch;
+  8002ce:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8002d2:	48 89 16             	mov    %rdx,(%rsi)
+  8002d5:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  8002d8:	c3                   	ret
+
+00000000008002d9 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  8002d9:	55                   	push   %rbp
+  8002da:	48 89 e5             	mov    %rsp,%rbp
+  8002dd:	48 83 ec 50          	sub    $0x50,%rsp
+  8002e1:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8002e5:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8002e9:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  8002ed:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8002f4:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8002f8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8002fc:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800300:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  800304:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800308:	48 b8 16 03 80 00 00 	movabs $0x800316,%rax
+  80030f:	00 00 00 
+  800312:	ff d0                	call   *%rax
+}
+  800314:	c9                   	leave
+  800315:	c3                   	ret
+
+0000000000800316 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  800316:	55                   	push   %rbp
+  800317:	48 89 e5             	mov    %rsp,%rbp
+  80031a:	41 57                	push   %r15
+  80031c:	41 56                	push   %r14
+  80031e:	41 55                	push   %r13
+  800320:	41 54                	push   %r12
+  800322:	53                   	push   %rbx
+  800323:	48 83 ec 38          	sub    $0x38,%rsp
+  800327:	49 89 fe             	mov    %rdi,%r14
+  80032a:	49 89 f5             	mov    %rsi,%r13
+  80032d:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  800330:	48 8b 01             	mov    (%rcx),%rax
+  800333:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  800337:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  80033b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80033f:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  800343:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  800347:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  80034b:	0f b6 3b             	movzbl (%rbx),%edi
+  80034e:	40 80 ff 25          	cmp    $0x25,%dil
+  800352:	74 18                	je     80036c <vprintfmt+0x56>
+            if (!ch) return;
+  800354:	40 84 ff             	test   %dil,%dil
+  800357:	0f 84 b1 06 00 00    	je     800a0e <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  80035d:	40 0f b6 ff          	movzbl %dil,%edi
+  800361:	4c 89 ee             	mov    %r13,%rsi
+  800364:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  800367:	4c 89 e3             	mov    %r12,%rbx
+  80036a:	eb db                	jmp    800347 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  80036c:	be 00 00 00 00       	mov    $0x0,%esi
+  800371:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  800375:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  80037a:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800380:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  800387:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  80038b:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  800390:	41 0f b6 04 24       	movzbl (%r12),%eax
+  800395:	88 45 a0             	mov    %al,-0x60(%rbp)
+  800398:	83 e8 23             	sub    $0x23,%eax
+  80039b:	3c 57                	cmp    $0x57,%al
+  80039d:	0f 87 51 06 00 00    	ja     8009f4 <vprintfmt+0x6de>
+  8003a3:	0f b6 c0             	movzbl %al,%eax
+  8003a6:	48 b9 80 2e 80 00 00 	movabs $0x802e80,%rcx
+  8003ad:	00 00 00 
+  8003b0:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  8003b3:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  8003b6:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  8003ba:	eb cf                	jmp    80038b <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  8003bc:	49 89 dc             	mov    %rbx,%r12
+  8003bf:	be 01 00 00 00       	mov    $0x1,%esi
+  8003c4:	eb c5                	jmp    80038b <vprintfmt+0x75>
+            padc = ch;
+  8003c6:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  8003ca:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8003cd:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8003d0:	eb b9                	jmp    80038b <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8003d2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8003d5:	83 f8 2f             	cmp    $0x2f,%eax
+  8003d8:	77 24                	ja     8003fe <vprintfmt+0xe8>
+  8003da:	89 c1                	mov    %eax,%ecx
+  8003dc:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  8003e0:	83 c0 08             	add    $0x8,%eax
+  8003e3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8003e6:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  8003e9:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  8003ec:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8003f0:	79 99                	jns    80038b <vprintfmt+0x75>
+                width = precision;
+  8003f2:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  8003f6:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8003fc:	eb 8d                	jmp    80038b <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8003fe:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  800402:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  800406:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80040a:	eb da                	jmp    8003e6 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  80040c:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  800411:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800415:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  80041b:	3c 39                	cmp    $0x39,%al
+  80041d:	77 1c                	ja     80043b <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  80041f:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  800423:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  800427:	0f b6 c0             	movzbl %al,%eax
+  80042a:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  80042f:	0f b6 03             	movzbl (%rbx),%eax
+  800432:	3c 39                	cmp    $0x39,%al
+  800434:	76 e9                	jbe    80041f <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  800436:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  800439:	eb b1                	jmp    8003ec <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  80043b:	49 89 dc             	mov    %rbx,%r12
+  80043e:	eb ac                	jmp    8003ec <vprintfmt+0xd6>
+            width = MAX(0, width);
+  800440:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  800443:	85 c9                	test   %ecx,%ecx
+  800445:	b8 00 00 00 00       	mov    $0x0,%eax
+  80044a:	0f 49 c1             	cmovns %ecx,%eax
+  80044d:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  800450:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800453:	e9 33 ff ff ff       	jmp    80038b <vprintfmt+0x75>
+            lflag++;
+  800458:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  80045b:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80045e:	e9 28 ff ff ff       	jmp    80038b <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  800463:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800466:	83 f8 2f             	cmp    $0x2f,%eax
+  800469:	77 19                	ja     800484 <vprintfmt+0x16e>
+  80046b:	89 c2                	mov    %eax,%edx
+  80046d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800471:	83 c0 08             	add    $0x8,%eax
+  800474:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800477:	8b 3a                	mov    (%rdx),%edi
+  800479:	4c 89 ee             	mov    %r13,%rsi
+  80047c:	41 ff d6             	call   *%r14
+            break;
+  80047f:	e9 c3 fe ff ff       	jmp    800347 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  800484:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800488:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80048c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800490:	eb e5                	jmp    800477 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  800492:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800495:	83 f8 2f             	cmp    $0x2f,%eax
+  800498:	77 5a                	ja     8004f4 <vprintfmt+0x1de>
+  80049a:	89 c2                	mov    %eax,%edx
+  80049c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8004a0:	83 c0 08             	add    $0x8,%eax
+  8004a3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  8004a6:	8b 02                	mov    (%rdx),%eax
+  8004a8:	89 c1                	mov    %eax,%ecx
+  8004aa:	f7 d9                	neg    %ecx
+  8004ac:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  8004af:	83 f9 15             	cmp    $0x15,%ecx
+  8004b2:	7f 4e                	jg     800502 <vprintfmt+0x1ec>
+  8004b4:	48 63 c1             	movslq %ecx,%rax
+  8004b7:	48 ba 40 31 80 00 00 	movabs $0x803140,%rdx
+  8004be:	00 00 00 
+  8004c1:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8004c5:	48 85 c0             	test   %rax,%rax
+  8004c8:	74 38                	je     800502 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  8004ca:	48 89 c1             	mov    %rax,%rcx
+  8004cd:	48 ba f9 32 80 00 00 	movabs $0x8032f9,%rdx
+  8004d4:	00 00 00 
+  8004d7:	4c 89 ee             	mov    %r13,%rsi
+  8004da:	4c 89 f7             	mov    %r14,%rdi
+  8004dd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004e2:	49 b8 d9 02 80 00 00 	movabs $0x8002d9,%r8
+  8004e9:	00 00 00 
+  8004ec:	41 ff d0             	call   *%r8
+  8004ef:	e9 53 fe ff ff       	jmp    800347 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  8004f4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8004f8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8004fc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800500:	eb a4                	jmp    8004a6 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  800502:	48 ba e9 2c 80 00 00 	movabs $0x802ce9,%rdx
+  800509:	00 00 00 
+  80050c:	4c 89 ee             	mov    %r13,%rsi
+  80050f:	4c 89 f7             	mov    %r14,%rdi
+  800512:	b8 00 00 00 00       	mov    $0x0,%eax
+  800517:	49 b8 d9 02 80 00 00 	movabs $0x8002d9,%r8
+  80051e:	00 00 00 
+  800521:	41 ff d0             	call   *%r8
+  800524:	e9 1e fe ff ff       	jmp    800347 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800529:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80052c:	83 f8 2f             	cmp    $0x2f,%eax
+  80052f:	77 6c                	ja     80059d <vprintfmt+0x287>
+  800531:	89 c2                	mov    %eax,%edx
+  800533:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800537:	83 c0 08             	add    $0x8,%eax
+  80053a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80053d:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  800540:	48 85 d2             	test   %rdx,%rdx
+  800543:	48 b8 e2 2c 80 00 00 	movabs $0x802ce2,%rax
+  80054a:	00 00 00 
+  80054d:	48 0f 45 c2          	cmovne %rdx,%rax
+  800551:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  800555:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800559:	7e 06                	jle    800561 <vprintfmt+0x24b>
+  80055b:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  80055f:	75 4a                	jne    8005ab <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800561:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800565:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  800569:	0f b6 00             	movzbl (%rax),%eax
+  80056c:	84 c0                	test   %al,%al
+  80056e:	0f 85 9a 00 00 00    	jne    80060e <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  800574:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800577:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  80057b:	85 c0                	test   %eax,%eax
+  80057d:	0f 8e c4 fd ff ff    	jle    800347 <vprintfmt+0x31>
+  800583:	4c 89 ee             	mov    %r13,%rsi
+  800586:	bf 20 00 00 00       	mov    $0x20,%edi
+  80058b:	41 ff d6             	call   *%r14
+  80058e:	41 83 ec 01          	sub    $0x1,%r12d
+  800592:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  800596:	75 eb                	jne    800583 <vprintfmt+0x26d>
+  800598:	e9 aa fd ff ff       	jmp    800347 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  80059d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8005a1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8005a5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8005a9:	eb 92                	jmp    80053d <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  8005ab:	49 63 f7             	movslq %r15d,%rsi
+  8005ae:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  8005b2:	48 b8 c8 0a 80 00 00 	movabs $0x800ac8,%rax
+  8005b9:	00 00 00 
+  8005bc:	ff d0                	call   *%rax
+  8005be:	48 89 c2             	mov    %rax,%rdx
+  8005c1:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8005c4:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  8005c6:	8d 70 ff             	lea    -0x1(%rax),%esi
+  8005c9:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  8005cc:	85 c0                	test   %eax,%eax
+  8005ce:	7e 91                	jle    800561 <vprintfmt+0x24b>
+  8005d0:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  8005d5:	4c 89 ee             	mov    %r13,%rsi
+  8005d8:	44 89 e7             	mov    %r12d,%edi
+  8005db:	41 ff d6             	call   *%r14
+  8005de:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8005e2:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8005e5:	83 f8 ff             	cmp    $0xffffffff,%eax
+  8005e8:	75 eb                	jne    8005d5 <vprintfmt+0x2bf>
+  8005ea:	e9 72 ff ff ff       	jmp    800561 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8005ef:	0f b6 f8             	movzbl %al,%edi
+  8005f2:	4c 89 ee             	mov    %r13,%rsi
+  8005f5:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8005f8:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8005fc:	49 83 c4 01          	add    $0x1,%r12
+  800600:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  800606:	84 c0                	test   %al,%al
+  800608:	0f 84 66 ff ff ff    	je     800574 <vprintfmt+0x25e>
+  80060e:	45 85 ff             	test   %r15d,%r15d
+  800611:	78 0a                	js     80061d <vprintfmt+0x307>
+  800613:	41 83 ef 01          	sub    $0x1,%r15d
+  800617:	0f 88 57 ff ff ff    	js     800574 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  80061d:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  800621:	74 cc                	je     8005ef <vprintfmt+0x2d9>
+  800623:	8d 50 e0             	lea    -0x20(%rax),%edx
+  800626:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  80062b:	80 fa 5e             	cmp    $0x5e,%dl
+  80062e:	77 c2                	ja     8005f2 <vprintfmt+0x2dc>
+  800630:	eb bd                	jmp    8005ef <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  800632:	40 84 f6             	test   %sil,%sil
+  800635:	75 26                	jne    80065d <vprintfmt+0x347>
+    switch (lflag) {
+  800637:	85 d2                	test   %edx,%edx
+  800639:	74 59                	je     800694 <vprintfmt+0x37e>
+  80063b:	83 fa 01             	cmp    $0x1,%edx
+  80063e:	74 7b                	je     8006bb <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  800640:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800643:	83 f8 2f             	cmp    $0x2f,%eax
+  800646:	0f 87 96 00 00 00    	ja     8006e2 <vprintfmt+0x3cc>
+  80064c:	89 c2                	mov    %eax,%edx
+  80064e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800652:	83 c0 08             	add    $0x8,%eax
+  800655:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800658:	4c 8b 22             	mov    (%rdx),%r12
+  80065b:	eb 17                	jmp    800674 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  80065d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800660:	83 f8 2f             	cmp    $0x2f,%eax
+  800663:	77 21                	ja     800686 <vprintfmt+0x370>
+  800665:	89 c2                	mov    %eax,%edx
+  800667:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80066b:	83 c0 08             	add    $0x8,%eax
+  80066e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800671:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  800674:	4d 85 e4             	test   %r12,%r12
+  800677:	78 7a                	js     8006f3 <vprintfmt+0x3dd>
+            num = i;
+  800679:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  80067c:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  800681:	e9 50 02 00 00       	jmp    8008d6 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800686:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80068a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80068e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800692:	eb dd                	jmp    800671 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  800694:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800697:	83 f8 2f             	cmp    $0x2f,%eax
+  80069a:	77 11                	ja     8006ad <vprintfmt+0x397>
+  80069c:	89 c2                	mov    %eax,%edx
+  80069e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8006a2:	83 c0 08             	add    $0x8,%eax
+  8006a5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8006a8:	4c 63 22             	movslq (%rdx),%r12
+  8006ab:	eb c7                	jmp    800674 <vprintfmt+0x35e>
+  8006ad:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8006b1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006b5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006b9:	eb ed                	jmp    8006a8 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  8006bb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006be:	83 f8 2f             	cmp    $0x2f,%eax
+  8006c1:	77 11                	ja     8006d4 <vprintfmt+0x3be>
+  8006c3:	89 c2                	mov    %eax,%edx
+  8006c5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8006c9:	83 c0 08             	add    $0x8,%eax
+  8006cc:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8006cf:	4c 8b 22             	mov    (%rdx),%r12
+  8006d2:	eb a0                	jmp    800674 <vprintfmt+0x35e>
+  8006d4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8006d8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006dc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006e0:	eb ed                	jmp    8006cf <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  8006e2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8006e6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006ea:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006ee:	e9 65 ff ff ff       	jmp    800658 <vprintfmt+0x342>
+                putch('-', put_arg);
+  8006f3:	4c 89 ee             	mov    %r13,%rsi
+  8006f6:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  8006fb:	41 ff d6             	call   *%r14
+                i = -i;
+  8006fe:	49 f7 dc             	neg    %r12
+  800701:	e9 73 ff ff ff       	jmp    800679 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  800706:	40 84 f6             	test   %sil,%sil
+  800709:	75 32                	jne    80073d <vprintfmt+0x427>
+    switch (lflag) {
+  80070b:	85 d2                	test   %edx,%edx
+  80070d:	74 5d                	je     80076c <vprintfmt+0x456>
+  80070f:	83 fa 01             	cmp    $0x1,%edx
+  800712:	0f 84 82 00 00 00    	je     80079a <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  800718:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80071b:	83 f8 2f             	cmp    $0x2f,%eax
+  80071e:	0f 87 a5 00 00 00    	ja     8007c9 <vprintfmt+0x4b3>
+  800724:	89 c2                	mov    %eax,%edx
+  800726:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80072a:	83 c0 08             	add    $0x8,%eax
+  80072d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800730:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800733:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  800738:	e9 99 01 00 00       	jmp    8008d6 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  80073d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800740:	83 f8 2f             	cmp    $0x2f,%eax
+  800743:	77 19                	ja     80075e <vprintfmt+0x448>
+  800745:	89 c2                	mov    %eax,%edx
+  800747:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80074b:	83 c0 08             	add    $0x8,%eax
+  80074e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800751:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800754:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800759:	e9 78 01 00 00       	jmp    8008d6 <vprintfmt+0x5c0>
+  80075e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800762:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800766:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80076a:	eb e5                	jmp    800751 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  80076c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80076f:	83 f8 2f             	cmp    $0x2f,%eax
+  800772:	77 18                	ja     80078c <vprintfmt+0x476>
+  800774:	89 c2                	mov    %eax,%edx
+  800776:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80077a:	83 c0 08             	add    $0x8,%eax
+  80077d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800780:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800782:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  800787:	e9 4a 01 00 00       	jmp    8008d6 <vprintfmt+0x5c0>
+  80078c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800790:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800794:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800798:	eb e6                	jmp    800780 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  80079a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80079d:	83 f8 2f             	cmp    $0x2f,%eax
+  8007a0:	77 19                	ja     8007bb <vprintfmt+0x4a5>
+  8007a2:	89 c2                	mov    %eax,%edx
+  8007a4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007a8:	83 c0 08             	add    $0x8,%eax
+  8007ab:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007ae:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8007b1:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  8007b6:	e9 1b 01 00 00       	jmp    8008d6 <vprintfmt+0x5c0>
+  8007bb:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007bf:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007c3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007c7:	eb e5                	jmp    8007ae <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  8007c9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007cd:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007d1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007d5:	e9 56 ff ff ff       	jmp    800730 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  8007da:	40 84 f6             	test   %sil,%sil
+  8007dd:	75 2e                	jne    80080d <vprintfmt+0x4f7>
+    switch (lflag) {
+  8007df:	85 d2                	test   %edx,%edx
+  8007e1:	74 59                	je     80083c <vprintfmt+0x526>
+  8007e3:	83 fa 01             	cmp    $0x1,%edx
+  8007e6:	74 7f                	je     800867 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  8007e8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007eb:	83 f8 2f             	cmp    $0x2f,%eax
+  8007ee:	0f 87 9f 00 00 00    	ja     800893 <vprintfmt+0x57d>
+  8007f4:	89 c2                	mov    %eax,%edx
+  8007f6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007fa:	83 c0 08             	add    $0x8,%eax
+  8007fd:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800800:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800803:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  800808:	e9 c9 00 00 00       	jmp    8008d6 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  80080d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800810:	83 f8 2f             	cmp    $0x2f,%eax
+  800813:	77 19                	ja     80082e <vprintfmt+0x518>
+  800815:	89 c2                	mov    %eax,%edx
+  800817:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80081b:	83 c0 08             	add    $0x8,%eax
+  80081e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800821:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800824:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800829:	e9 a8 00 00 00       	jmp    8008d6 <vprintfmt+0x5c0>
+  80082e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800832:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800836:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80083a:	eb e5                	jmp    800821 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  80083c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80083f:	83 f8 2f             	cmp    $0x2f,%eax
+  800842:	77 15                	ja     800859 <vprintfmt+0x543>
+  800844:	89 c2                	mov    %eax,%edx
+  800846:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80084a:	83 c0 08             	add    $0x8,%eax
+  80084d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800850:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  800852:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  800857:	eb 7d                	jmp    8008d6 <vprintfmt+0x5c0>
+  800859:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80085d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800861:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800865:	eb e9                	jmp    800850 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  800867:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80086a:	83 f8 2f             	cmp    $0x2f,%eax
+  80086d:	77 16                	ja     800885 <vprintfmt+0x56f>
+  80086f:	89 c2                	mov    %eax,%edx
+  800871:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800875:	83 c0 08             	add    $0x8,%eax
+  800878:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80087b:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  80087e:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  800883:	eb 51                	jmp    8008d6 <vprintfmt+0x5c0>
+  800885:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800889:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80088d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800891:	eb e8                	jmp    80087b <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  800893:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800897:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80089b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80089f:	e9 5c ff ff ff       	jmp    800800 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  8008a4:	4c 89 ee             	mov    %r13,%rsi
+  8008a7:	bf 30 00 00 00       	mov    $0x30,%edi
+  8008ac:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  8008af:	4c 89 ee             	mov    %r13,%rsi
+  8008b2:	bf 78 00 00 00       	mov    $0x78,%edi
+  8008b7:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  8008ba:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008bd:	83 f8 2f             	cmp    $0x2f,%eax
+  8008c0:	77 47                	ja     800909 <vprintfmt+0x5f3>
+  8008c2:	89 c2                	mov    %eax,%edx
+  8008c4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008c8:	83 c0 08             	add    $0x8,%eax
+  8008cb:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008ce:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8008d1:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  8008d6:	48 83 ec 08          	sub    $0x8,%rsp
+  8008da:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  8008de:	0f 94 c0             	sete   %al
+  8008e1:	0f b6 c0             	movzbl %al,%eax
+  8008e4:	50                   	push   %rax
+  8008e5:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  8008ea:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  8008ee:	4c 89 ee             	mov    %r13,%rsi
+  8008f1:	4c 89 f7             	mov    %r14,%rdi
+  8008f4:	48 b8 0b 02 80 00 00 	movabs $0x80020b,%rax
+  8008fb:	00 00 00 
+  8008fe:	ff d0                	call   *%rax
+            break;
+  800900:	48 83 c4 10          	add    $0x10,%rsp
+  800904:	e9 3e fa ff ff       	jmp    800347 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800909:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80090d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800911:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800915:	eb b7                	jmp    8008ce <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  800917:	40 84 f6             	test   %sil,%sil
+  80091a:	75 2b                	jne    800947 <vprintfmt+0x631>
+    switch (lflag) {
+  80091c:	85 d2                	test   %edx,%edx
+  80091e:	74 56                	je     800976 <vprintfmt+0x660>
+  800920:	83 fa 01             	cmp    $0x1,%edx
+  800923:	74 7f                	je     8009a4 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800925:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800928:	83 f8 2f             	cmp    $0x2f,%eax
+  80092b:	0f 87 a2 00 00 00    	ja     8009d3 <vprintfmt+0x6bd>
+  800931:	89 c2                	mov    %eax,%edx
+  800933:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800937:	83 c0 08             	add    $0x8,%eax
+  80093a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80093d:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800940:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800945:	eb 8f                	jmp    8008d6 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800947:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80094a:	83 f8 2f             	cmp    $0x2f,%eax
+  80094d:	77 19                	ja     800968 <vprintfmt+0x652>
+  80094f:	89 c2                	mov    %eax,%edx
+  800951:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800955:	83 c0 08             	add    $0x8,%eax
+  800958:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80095b:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  80095e:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800963:	e9 6e ff ff ff       	jmp    8008d6 <vprintfmt+0x5c0>
+  800968:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80096c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800970:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800974:	eb e5                	jmp    80095b <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800976:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800979:	83 f8 2f             	cmp    $0x2f,%eax
+  80097c:	77 18                	ja     800996 <vprintfmt+0x680>
+  80097e:	89 c2                	mov    %eax,%edx
+  800980:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800984:	83 c0 08             	add    $0x8,%eax
+  800987:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80098a:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  80098c:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800991:	e9 40 ff ff ff       	jmp    8008d6 <vprintfmt+0x5c0>
+  800996:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80099a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80099e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009a2:	eb e6                	jmp    80098a <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  8009a4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009a7:	83 f8 2f             	cmp    $0x2f,%eax
+  8009aa:	77 19                	ja     8009c5 <vprintfmt+0x6af>
+  8009ac:	89 c2                	mov    %eax,%edx
+  8009ae:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009b2:	83 c0 08             	add    $0x8,%eax
+  8009b5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009b8:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8009bb:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  8009c0:	e9 11 ff ff ff       	jmp    8008d6 <vprintfmt+0x5c0>
+  8009c5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009c9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009cd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009d1:	eb e5                	jmp    8009b8 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  8009d3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009d7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009db:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009df:	e9 59 ff ff ff       	jmp    80093d <vprintfmt+0x627>
+            putch(ch, put_arg);
+  8009e4:	4c 89 ee             	mov    %r13,%rsi
+  8009e7:	bf 25 00 00 00       	mov    $0x25,%edi
+  8009ec:	41 ff d6             	call   *%r14
+            break;
+  8009ef:	e9 53 f9 ff ff       	jmp    800347 <vprintfmt+0x31>
+            putch('%', put_arg);
+  8009f4:	4c 89 ee             	mov    %r13,%rsi
+  8009f7:	bf 25 00 00 00       	mov    $0x25,%edi
+  8009fc:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  8009ff:	48 83 eb 01          	sub    $0x1,%rbx
+  800a03:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800a07:	75 f6                	jne    8009ff <vprintfmt+0x6e9>
+  800a09:	e9 39 f9 ff ff       	jmp    800347 <vprintfmt+0x31>
+}
+  800a0e:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800a12:	5b                   	pop    %rbx
+  800a13:	41 5c                	pop    %r12
+  800a15:	41 5d                	pop    %r13
+  800a17:	41 5e                	pop    %r14
+  800a19:	41 5f                	pop    %r15
+  800a1b:	5d                   	pop    %rbp
+  800a1c:	c3                   	ret
+
+0000000000800a1d <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800a1d:	55                   	push   %rbp
+  800a1e:	48 89 e5             	mov    %rsp,%rbp
+  800a21:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800a25:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800a29:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800a2e:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800a32:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800a39:	48 85 ff             	test   %rdi,%rdi
+  800a3c:	74 2b                	je     800a69 <vsnprintf+0x4c>
+  800a3e:	48 85 f6             	test   %rsi,%rsi
+  800a41:	74 26                	je     800a69 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800a43:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800a47:	48 bf c1 02 80 00 00 	movabs $0x8002c1,%rdi
+  800a4e:	00 00 00 
+  800a51:	48 b8 16 03 80 00 00 	movabs $0x800316,%rax
+  800a58:	00 00 00 
+  800a5b:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800a5d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800a61:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800a64:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800a67:	c9                   	leave
+  800a68:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800a69:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800a6e:	eb f7                	jmp    800a67 <vsnprintf+0x4a>
+
+0000000000800a70 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800a70:	55                   	push   %rbp
+  800a71:	48 89 e5             	mov    %rsp,%rbp
+  800a74:	48 83 ec 50          	sub    $0x50,%rsp
+  800a78:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800a7c:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800a80:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800a84:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800a8b:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800a8f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a93:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800a97:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800a9b:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800a9f:	48 b8 1d 0a 80 00 00 	movabs $0x800a1d,%rax
+  800aa6:	00 00 00 
+  800aa9:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800aab:	c9                   	leave
+  800aac:	c3                   	ret
+
+0000000000800aad <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800aad:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800ab0:	74 10                	je     800ac2 <strlen+0x15>
+    size_t n = 0;
+  800ab2:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800ab7:	48 83 c0 01          	add    $0x1,%rax
+  800abb:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800abf:	75 f6                	jne    800ab7 <strlen+0xa>
+  800ac1:	c3                   	ret
+    size_t n = 0;
+  800ac2:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800ac7:	c3                   	ret
+
+0000000000800ac8 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800ac8:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800acb:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800ad0:	48 85 f6             	test   %rsi,%rsi
+  800ad3:	74 11                	je     800ae6 <strnlen+0x1e>
+  800ad5:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800ad9:	74 0c                	je     800ae7 <strnlen+0x1f>
+  800adb:	48 83 c2 01          	add    $0x1,%rdx
+  800adf:	48 39 d0             	cmp    %rdx,%rax
+  800ae2:	75 f1                	jne    800ad5 <strnlen+0xd>
+  800ae4:	eb 04                	jmp    800aea <strnlen+0x22>
+  800ae6:	c3                   	ret
+  800ae7:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800aea:	c3                   	ret
+
+0000000000800aeb <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800aeb:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800aee:	ba 00 00 00 00       	mov    $0x0,%edx
+  800af3:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800af7:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800afa:	48 83 c2 01          	add    $0x1,%rdx
+  800afe:	84 c9                	test   %cl,%cl
+  800b00:	75 f1                	jne    800af3 <strcpy+0x8>
+        ;
+    return res;
+}
+  800b02:	c3                   	ret
+
+0000000000800b03 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800b03:	55                   	push   %rbp
+  800b04:	48 89 e5             	mov    %rsp,%rbp
+  800b07:	41 54                	push   %r12
+  800b09:	53                   	push   %rbx
+  800b0a:	48 89 fb             	mov    %rdi,%rbx
+  800b0d:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800b10:	48 b8 ad 0a 80 00 00 	movabs $0x800aad,%rax
+  800b17:	00 00 00 
+  800b1a:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800b1c:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800b20:	4c 89 e6             	mov    %r12,%rsi
+  800b23:	48 b8 eb 0a 80 00 00 	movabs $0x800aeb,%rax
+  800b2a:	00 00 00 
+  800b2d:	ff d0                	call   *%rax
+    return dst;
+}
+  800b2f:	48 89 d8             	mov    %rbx,%rax
+  800b32:	5b                   	pop    %rbx
+  800b33:	41 5c                	pop    %r12
+  800b35:	5d                   	pop    %rbp
+  800b36:	c3                   	ret
+
+0000000000800b37 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800b37:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800b3a:	48 85 d2             	test   %rdx,%rdx
+  800b3d:	74 1f                	je     800b5e <strncpy+0x27>
+  800b3f:	48 01 fa             	add    %rdi,%rdx
+  800b42:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800b45:	48 83 c1 01          	add    $0x1,%rcx
+  800b49:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800b4d:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800b51:	41 80 f8 01          	cmp    $0x1,%r8b
+  800b55:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800b59:	48 39 ca             	cmp    %rcx,%rdx
+  800b5c:	75 e7                	jne    800b45 <strncpy+0xe>
+    }
+    return ret;
+}
+  800b5e:	c3                   	ret
+
+0000000000800b5f <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800b5f:	48 89 f8             	mov    %rdi,%rax
+  800b62:	48 85 d2             	test   %rdx,%rdx
+  800b65:	74 24                	je     800b8b <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800b67:	48 83 ea 01          	sub    $0x1,%rdx
+  800b6b:	74 1b                	je     800b88 <strlcpy+0x29>
+  800b6d:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800b71:	0f b6 16             	movzbl (%rsi),%edx
+  800b74:	84 d2                	test   %dl,%dl
+  800b76:	74 10                	je     800b88 <strlcpy+0x29>
+            *dst++ = *src++;
+  800b78:	48 83 c6 01          	add    $0x1,%rsi
+  800b7c:	48 83 c0 01          	add    $0x1,%rax
+  800b80:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800b83:	48 39 c8             	cmp    %rcx,%rax
+  800b86:	75 e9                	jne    800b71 <strlcpy+0x12>
+        *dst = '\0';
+  800b88:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800b8b:	48 29 f8             	sub    %rdi,%rax
+}
+  800b8e:	c3                   	ret
+
+0000000000800b8f <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800b8f:	0f b6 07             	movzbl (%rdi),%eax
+  800b92:	84 c0                	test   %al,%al
+  800b94:	74 13                	je     800ba9 <strcmp+0x1a>
+  800b96:	38 06                	cmp    %al,(%rsi)
+  800b98:	75 0f                	jne    800ba9 <strcmp+0x1a>
+  800b9a:	48 83 c7 01          	add    $0x1,%rdi
+  800b9e:	48 83 c6 01          	add    $0x1,%rsi
+  800ba2:	0f b6 07             	movzbl (%rdi),%eax
+  800ba5:	84 c0                	test   %al,%al
+  800ba7:	75 ed                	jne    800b96 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800ba9:	0f b6 c0             	movzbl %al,%eax
+  800bac:	0f b6 16             	movzbl (%rsi),%edx
+  800baf:	29 d0                	sub    %edx,%eax
+}
+  800bb1:	c3                   	ret
+
+0000000000800bb2 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800bb2:	48 85 d2             	test   %rdx,%rdx
+  800bb5:	74 1f                	je     800bd6 <strncmp+0x24>
+  800bb7:	0f b6 07             	movzbl (%rdi),%eax
+  800bba:	84 c0                	test   %al,%al
+  800bbc:	74 1e                	je     800bdc <strncmp+0x2a>
+  800bbe:	3a 06                	cmp    (%rsi),%al
+  800bc0:	75 1a                	jne    800bdc <strncmp+0x2a>
+  800bc2:	48 83 c7 01          	add    $0x1,%rdi
+  800bc6:	48 83 c6 01          	add    $0x1,%rsi
+  800bca:	48 83 ea 01          	sub    $0x1,%rdx
+  800bce:	75 e7                	jne    800bb7 <strncmp+0x5>
+
+    if (!n) return 0;
+  800bd0:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bd5:	c3                   	ret
+  800bd6:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bdb:	c3                   	ret
+  800bdc:	48 85 d2             	test   %rdx,%rdx
+  800bdf:	74 09                	je     800bea <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800be1:	0f b6 07             	movzbl (%rdi),%eax
+  800be4:	0f b6 16             	movzbl (%rsi),%edx
+  800be7:	29 d0                	sub    %edx,%eax
+  800be9:	c3                   	ret
+    if (!n) return 0;
+  800bea:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800bef:	c3                   	ret
+
+0000000000800bf0 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800bf0:	0f b6 17             	movzbl (%rdi),%edx
+  800bf3:	84 d2                	test   %dl,%dl
+  800bf5:	74 18                	je     800c0f <strchr+0x1f>
+        if (*str == c) {
+  800bf7:	0f be d2             	movsbl %dl,%edx
+  800bfa:	39 f2                	cmp    %esi,%edx
+  800bfc:	74 17                	je     800c15 <strchr+0x25>
+    for (; *str; str++) {
+  800bfe:	48 83 c7 01          	add    $0x1,%rdi
+  800c02:	0f b6 17             	movzbl (%rdi),%edx
+  800c05:	84 d2                	test   %dl,%dl
+  800c07:	75 ee                	jne    800bf7 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800c09:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c0e:	c3                   	ret
+  800c0f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c14:	c3                   	ret
+  800c15:	48 89 f8             	mov    %rdi,%rax
+}
+  800c18:	c3                   	ret
+
+0000000000800c19 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800c19:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800c1c:	0f b6 17             	movzbl (%rdi),%edx
+  800c1f:	84 d2                	test   %dl,%dl
+  800c21:	74 13                	je     800c36 <strfind+0x1d>
+  800c23:	0f be d2             	movsbl %dl,%edx
+  800c26:	39 f2                	cmp    %esi,%edx
+  800c28:	74 0b                	je     800c35 <strfind+0x1c>
+  800c2a:	48 83 c0 01          	add    $0x1,%rax
+  800c2e:	0f b6 10             	movzbl (%rax),%edx
+  800c31:	84 d2                	test   %dl,%dl
+  800c33:	75 ee                	jne    800c23 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800c35:	c3                   	ret
+  800c36:	c3                   	ret
+
+0000000000800c37 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800c37:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800c3a:	48 89 f8             	mov    %rdi,%rax
+  800c3d:	48 f7 d8             	neg    %rax
+  800c40:	83 e0 07             	and    $0x7,%eax
+  800c43:	49 89 d1             	mov    %rdx,%r9
+  800c46:	49 29 c1             	sub    %rax,%r9
+  800c49:	78 36                	js     800c81 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800c4b:	40 0f b6 c6          	movzbl %sil,%eax
+  800c4f:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800c56:	01 01 01 
+  800c59:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800c5d:	40 f6 c7 07          	test   $0x7,%dil
+  800c61:	75 38                	jne    800c9b <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800c63:	4c 89 c9             	mov    %r9,%rcx
+  800c66:	48 c1 f9 03          	sar    $0x3,%rcx
+  800c6a:	74 0c                	je     800c78 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800c6c:	fc                   	cld
+  800c6d:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800c70:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800c74:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800c78:	4d 85 c9             	test   %r9,%r9
+  800c7b:	75 45                	jne    800cc2 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800c7d:	4c 89 c0             	mov    %r8,%rax
+  800c80:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800c81:	48 85 d2             	test   %rdx,%rdx
+  800c84:	74 f7                	je     800c7d <memset+0x46>
+  800c86:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800c89:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800c8c:	48 83 c0 01          	add    $0x1,%rax
+  800c90:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  800c94:	48 39 c2             	cmp    %rax,%rdx
+  800c97:	75 f3                	jne    800c8c <memset+0x55>
+  800c99:	eb e2                	jmp    800c7d <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  800c9b:	40 f6 c7 01          	test   $0x1,%dil
+  800c9f:	74 06                	je     800ca7 <memset+0x70>
+  800ca1:	88 07                	mov    %al,(%rdi)
+  800ca3:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800ca7:	40 f6 c7 02          	test   $0x2,%dil
+  800cab:	74 07                	je     800cb4 <memset+0x7d>
+  800cad:	66 89 07             	mov    %ax,(%rdi)
+  800cb0:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800cb4:	40 f6 c7 04          	test   $0x4,%dil
+  800cb8:	74 a9                	je     800c63 <memset+0x2c>
+  800cba:	89 07                	mov    %eax,(%rdi)
+  800cbc:	48 83 c7 04          	add    $0x4,%rdi
+  800cc0:	eb a1                	jmp    800c63 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800cc2:	41 f6 c1 04          	test   $0x4,%r9b
+  800cc6:	74 06                	je     800cce <memset+0x97>
+  800cc8:	89 07                	mov    %eax,(%rdi)
+  800cca:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800cce:	41 f6 c1 02          	test   $0x2,%r9b
+  800cd2:	74 07                	je     800cdb <memset+0xa4>
+  800cd4:	66 89 07             	mov    %ax,(%rdi)
+  800cd7:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  800cdb:	41 f6 c1 01          	test   $0x1,%r9b
+  800cdf:	74 9c                	je     800c7d <memset+0x46>
+  800ce1:	88 07                	mov    %al,(%rdi)
+  800ce3:	eb 98                	jmp    800c7d <memset+0x46>
+
+0000000000800ce5 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  800ce5:	48 89 f8             	mov    %rdi,%rax
+  800ce8:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  800ceb:	48 39 fe             	cmp    %rdi,%rsi
+  800cee:	73 3b                	jae    800d2b <memmove+0x46>
+  800cf0:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  800cf4:	48 39 d7             	cmp    %rdx,%rdi
+  800cf7:	73 32                	jae    800d2b <memmove+0x46>
+        s += n;
+        d += n;
+  800cf9:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800cfd:	48 89 d6             	mov    %rdx,%rsi
+  800d00:	48 09 fe             	or     %rdi,%rsi
+  800d03:	48 09 ce             	or     %rcx,%rsi
+  800d06:	40 f6 c6 07          	test   $0x7,%sil
+  800d0a:	75 12                	jne    800d1e <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  800d0c:	48 83 ef 08          	sub    $0x8,%rdi
+  800d10:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  800d14:	48 c1 e9 03          	shr    $0x3,%rcx
+  800d18:	fd                   	std
+  800d19:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  800d1c:	fc                   	cld
+  800d1d:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  800d1e:	48 83 ef 01          	sub    $0x1,%rdi
+  800d22:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  800d26:	fd                   	std
+  800d27:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  800d29:	eb f1                	jmp    800d1c <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800d2b:	48 89 f2             	mov    %rsi,%rdx
+  800d2e:	48 09 c2             	or     %rax,%rdx
+  800d31:	48 09 ca             	or     %rcx,%rdx
+  800d34:	f6 c2 07             	test   $0x7,%dl
+  800d37:	75 0c                	jne    800d45 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  800d39:	48 c1 e9 03          	shr    $0x3,%rcx
+  800d3d:	48 89 c7             	mov    %rax,%rdi
+  800d40:	fc                   	cld
+  800d41:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  800d44:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  800d45:	48 89 c7             	mov    %rax,%rdi
+  800d48:	fc                   	cld
+  800d49:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  800d4b:	c3                   	ret
+
+0000000000800d4c <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  800d4c:	55                   	push   %rbp
+  800d4d:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  800d50:	48 b8 e5 0c 80 00 00 	movabs $0x800ce5,%rax
+  800d57:	00 00 00 
+  800d5a:	ff d0                	call   *%rax
+}
+  800d5c:	5d                   	pop    %rbp
+  800d5d:	c3                   	ret
+
+0000000000800d5e <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  800d5e:	55                   	push   %rbp
+  800d5f:	48 89 e5             	mov    %rsp,%rbp
+  800d62:	41 57                	push   %r15
+  800d64:	41 56                	push   %r14
+  800d66:	41 55                	push   %r13
+  800d68:	41 54                	push   %r12
+  800d6a:	53                   	push   %rbx
+  800d6b:	48 83 ec 08          	sub    $0x8,%rsp
+  800d6f:	49 89 fe             	mov    %rdi,%r14
+  800d72:	49 89 f7             	mov    %rsi,%r15
+  800d75:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  800d78:	48 89 f7             	mov    %rsi,%rdi
+  800d7b:	48 b8 ad 0a 80 00 00 	movabs $0x800aad,%rax
+  800d82:	00 00 00 
+  800d85:	ff d0                	call   *%rax
+  800d87:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  800d8a:	48 89 de             	mov    %rbx,%rsi
+  800d8d:	4c 89 f7             	mov    %r14,%rdi
+  800d90:	48 b8 c8 0a 80 00 00 	movabs $0x800ac8,%rax
+  800d97:	00 00 00 
+  800d9a:	ff d0                	call   *%rax
+  800d9c:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  800d9f:	48 39 c3             	cmp    %rax,%rbx
+  800da2:	74 36                	je     800dda <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  800da4:	48 89 d8             	mov    %rbx,%rax
+  800da7:	4c 29 e8             	sub    %r13,%rax
+  800daa:	49 39 c4             	cmp    %rax,%r12
+  800dad:	73 31                	jae    800de0 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  800daf:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  800db4:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800db8:	4c 89 fe             	mov    %r15,%rsi
+  800dbb:	48 b8 4c 0d 80 00 00 	movabs $0x800d4c,%rax
+  800dc2:	00 00 00 
+  800dc5:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  800dc7:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  800dcb:	48 83 c4 08          	add    $0x8,%rsp
+  800dcf:	5b                   	pop    %rbx
+  800dd0:	41 5c                	pop    %r12
+  800dd2:	41 5d                	pop    %r13
+  800dd4:	41 5e                	pop    %r14
+  800dd6:	41 5f                	pop    %r15
+  800dd8:	5d                   	pop    %rbp
+  800dd9:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  800dda:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800dde:	eb eb                	jmp    800dcb <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  800de0:	48 83 eb 01          	sub    $0x1,%rbx
+  800de4:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800de8:	48 89 da             	mov    %rbx,%rdx
+  800deb:	4c 89 fe             	mov    %r15,%rsi
+  800dee:	48 b8 4c 0d 80 00 00 	movabs $0x800d4c,%rax
+  800df5:	00 00 00 
+  800df8:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  800dfa:	49 01 de             	add    %rbx,%r14
+  800dfd:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  800e02:	eb c3                	jmp    800dc7 <strlcat+0x69>
+
+0000000000800e04 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  800e04:	48 85 d2             	test   %rdx,%rdx
+  800e07:	74 2d                	je     800e36 <memcmp+0x32>
+  800e09:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  800e0e:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800e12:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  800e17:	44 38 c1             	cmp    %r8b,%cl
+  800e1a:	75 0f                	jne    800e2b <memcmp+0x27>
+    while (n-- > 0) {
+  800e1c:	48 83 c0 01          	add    $0x1,%rax
+  800e20:	48 39 c2             	cmp    %rax,%rdx
+  800e23:	75 e9                	jne    800e0e <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  800e25:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e2a:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  800e2b:	0f b6 c1             	movzbl %cl,%eax
+  800e2e:	45 0f b6 c0          	movzbl %r8b,%r8d
+  800e32:	44 29 c0             	sub    %r8d,%eax
+  800e35:	c3                   	ret
+    return 0;
+  800e36:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800e3b:	c3                   	ret
+
+0000000000800e3c <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  800e3c:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  800e40:	48 39 c7             	cmp    %rax,%rdi
+  800e43:	73 0f                	jae    800e54 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  800e45:	40 38 37             	cmp    %sil,(%rdi)
+  800e48:	74 0e                	je     800e58 <memfind+0x1c>
+    for (; src < end; src++) {
+  800e4a:	48 83 c7 01          	add    $0x1,%rdi
+  800e4e:	48 39 f8             	cmp    %rdi,%rax
+  800e51:	75 f2                	jne    800e45 <memfind+0x9>
+  800e53:	c3                   	ret
+  800e54:	48 89 f8             	mov    %rdi,%rax
+  800e57:	c3                   	ret
+  800e58:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  800e5b:	c3                   	ret
+
+0000000000800e5c <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  800e5c:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  800e5f:	0f b6 37             	movzbl (%rdi),%esi
+  800e62:	40 80 fe 20          	cmp    $0x20,%sil
+  800e66:	74 06                	je     800e6e <strtol+0x12>
+  800e68:	40 80 fe 09          	cmp    $0x9,%sil
+  800e6c:	75 13                	jne    800e81 <strtol+0x25>
+  800e6e:	48 83 c7 01          	add    $0x1,%rdi
+  800e72:	0f b6 37             	movzbl (%rdi),%esi
+  800e75:	40 80 fe 20          	cmp    $0x20,%sil
+  800e79:	74 f3                	je     800e6e <strtol+0x12>
+  800e7b:	40 80 fe 09          	cmp    $0x9,%sil
+  800e7f:	74 ed                	je     800e6e <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  800e81:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  800e84:	83 e0 fd             	and    $0xfffffffd,%eax
+  800e87:	3c 01                	cmp    $0x1,%al
+  800e89:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  800e8d:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  800e93:	75 0f                	jne    800ea4 <strtol+0x48>
+  800e95:	80 3f 30             	cmpb   $0x30,(%rdi)
+  800e98:	74 14                	je     800eae <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  800e9a:	85 d2                	test   %edx,%edx
+  800e9c:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800ea1:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  800ea4:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  800ea9:	4c 63 ca             	movslq %edx,%r9
+  800eac:	eb 36                	jmp    800ee4 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  800eae:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  800eb2:	74 0f                	je     800ec3 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  800eb4:	85 d2                	test   %edx,%edx
+  800eb6:	75 ec                	jne    800ea4 <strtol+0x48>
+        s++;
+  800eb8:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  800ebc:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  800ec1:	eb e1                	jmp    800ea4 <strtol+0x48>
+        s += 2;
+  800ec3:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  800ec7:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  800ecc:	eb d6                	jmp    800ea4 <strtol+0x48>
+            dig -= '0';
+  800ece:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  800ed1:	44 0f b6 c1          	movzbl %cl,%r8d
+  800ed5:	41 39 d0             	cmp    %edx,%r8d
+  800ed8:	7d 21                	jge    800efb <strtol+0x9f>
+        val = val * base + dig;
+  800eda:	49 0f af c1          	imul   %r9,%rax
+  800ede:	0f b6 c9             	movzbl %cl,%ecx
+  800ee1:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  800ee4:	48 83 c7 01          	add    $0x1,%rdi
+  800ee8:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  800eec:	80 f9 39             	cmp    $0x39,%cl
+  800eef:	76 dd                	jbe    800ece <strtol+0x72>
+        else if (dig - 'a' < 27)
+  800ef1:	80 f9 7b             	cmp    $0x7b,%cl
+  800ef4:	77 05                	ja     800efb <strtol+0x9f>
+            dig -= 'a' - 10;
+  800ef6:	83 e9 57             	sub    $0x57,%ecx
+  800ef9:	eb d6                	jmp    800ed1 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  800efb:	4d 85 d2             	test   %r10,%r10
+  800efe:	74 03                	je     800f03 <strtol+0xa7>
+  800f00:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  800f03:	48 89 c2             	mov    %rax,%rdx
+  800f06:	48 f7 da             	neg    %rdx
+  800f09:	40 80 fe 2d          	cmp    $0x2d,%sil
+  800f0d:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  800f11:	c3                   	ret
+
+0000000000800f12 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  800f12:	55                   	push   %rbp
+  800f13:	48 89 e5             	mov    %rsp,%rbp
+  800f16:	53                   	push   %rbx
+  800f17:	48 89 fa             	mov    %rdi,%rdx
+  800f1a:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  800f1d:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800f22:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f27:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800f2c:	be 00 00 00 00       	mov    $0x0,%esi
+  800f31:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800f37:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  800f39:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800f3d:	c9                   	leave
+  800f3e:	c3                   	ret
+
+0000000000800f3f <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  800f3f:	55                   	push   %rbp
+  800f40:	48 89 e5             	mov    %rsp,%rbp
+  800f43:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  800f44:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800f49:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f4e:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800f53:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f58:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800f5d:	be 00 00 00 00       	mov    $0x0,%esi
+  800f62:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800f68:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  800f6a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800f6e:	c9                   	leave
+  800f6f:	c3                   	ret
+
+0000000000800f70 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  800f70:	55                   	push   %rbp
+  800f71:	48 89 e5             	mov    %rsp,%rbp
+  800f74:	53                   	push   %rbx
+  800f75:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  800f79:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800f7c:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800f81:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800f86:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f8b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800f90:	be 00 00 00 00       	mov    $0x0,%esi
+  800f95:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800f9b:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800f9d:	48 85 c0             	test   %rax,%rax
+  800fa0:	7f 06                	jg     800fa8 <sys_env_destroy+0x38>
+}
+  800fa2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800fa6:	c9                   	leave
+  800fa7:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800fa8:	49 89 c0             	mov    %rax,%r8
+  800fab:	b9 03 00 00 00       	mov    $0x3,%ecx
+  800fb0:	48 ba 10 32 80 00 00 	movabs $0x803210,%rdx
+  800fb7:	00 00 00 
+  800fba:	be 26 00 00 00       	mov    $0x26,%esi
+  800fbf:	48 bf 2f 32 80 00 00 	movabs $0x80322f,%rdi
+  800fc6:	00 00 00 
+  800fc9:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fce:	49 b9 2c 2a 80 00 00 	movabs $0x802a2c,%r9
+  800fd5:	00 00 00 
+  800fd8:	41 ff d1             	call   *%r9
+
+0000000000800fdb <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  800fdb:	55                   	push   %rbp
+  800fdc:	48 89 e5             	mov    %rsp,%rbp
+  800fdf:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  800fe0:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800fe5:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fea:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800fef:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ff4:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800ff9:	be 00 00 00 00       	mov    $0x0,%esi
+  800ffe:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801004:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  801006:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80100a:	c9                   	leave
+  80100b:	c3                   	ret
+
+000000000080100c <sys_yield>:
+
+void
+sys_yield(void) {
+  80100c:	55                   	push   %rbp
+  80100d:	48 89 e5             	mov    %rsp,%rbp
+  801010:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801011:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801016:	ba 00 00 00 00       	mov    $0x0,%edx
+  80101b:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801020:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801025:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80102a:	be 00 00 00 00       	mov    $0x0,%esi
+  80102f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801035:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  801037:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80103b:	c9                   	leave
+  80103c:	c3                   	ret
+
+000000000080103d <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  80103d:	55                   	push   %rbp
+  80103e:	48 89 e5             	mov    %rsp,%rbp
+  801041:	53                   	push   %rbx
+  801042:	48 89 fa             	mov    %rdi,%rdx
+  801045:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801048:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80104d:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  801054:	00 00 00 
+  801057:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80105c:	be 00 00 00 00       	mov    $0x0,%esi
+  801061:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801067:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  801069:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80106d:	c9                   	leave
+  80106e:	c3                   	ret
+
+000000000080106f <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  80106f:	55                   	push   %rbp
+  801070:	48 89 e5             	mov    %rsp,%rbp
+  801073:	53                   	push   %rbx
+  801074:	49 89 f8             	mov    %rdi,%r8
+  801077:	48 89 d3             	mov    %rdx,%rbx
+  80107a:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80107d:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801082:	4c 89 c2             	mov    %r8,%rdx
+  801085:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801088:	be 00 00 00 00       	mov    $0x0,%esi
+  80108d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801093:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  801095:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801099:	c9                   	leave
+  80109a:	c3                   	ret
+
+000000000080109b <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  80109b:	55                   	push   %rbp
+  80109c:	48 89 e5             	mov    %rsp,%rbp
+  80109f:	53                   	push   %rbx
+  8010a0:	48 83 ec 08          	sub    $0x8,%rsp
+  8010a4:	89 f8                	mov    %edi,%eax
+  8010a6:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  8010a9:	48 63 f9             	movslq %ecx,%rdi
+  8010ac:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8010af:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8010b4:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8010b7:	be 00 00 00 00       	mov    $0x0,%esi
+  8010bc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8010c2:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8010c4:	48 85 c0             	test   %rax,%rax
+  8010c7:	7f 06                	jg     8010cf <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  8010c9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8010cd:	c9                   	leave
+  8010ce:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8010cf:	49 89 c0             	mov    %rax,%r8
+  8010d2:	b9 04 00 00 00       	mov    $0x4,%ecx
+  8010d7:	48 ba 10 32 80 00 00 	movabs $0x803210,%rdx
+  8010de:	00 00 00 
+  8010e1:	be 26 00 00 00       	mov    $0x26,%esi
+  8010e6:	48 bf 2f 32 80 00 00 	movabs $0x80322f,%rdi
+  8010ed:	00 00 00 
+  8010f0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010f5:	49 b9 2c 2a 80 00 00 	movabs $0x802a2c,%r9
+  8010fc:	00 00 00 
+  8010ff:	41 ff d1             	call   *%r9
+
+0000000000801102 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801102:	55                   	push   %rbp
+  801103:	48 89 e5             	mov    %rsp,%rbp
+  801106:	53                   	push   %rbx
+  801107:	48 83 ec 08          	sub    $0x8,%rsp
+  80110b:	89 f8                	mov    %edi,%eax
+  80110d:	49 89 f2             	mov    %rsi,%r10
+  801110:	48 89 cf             	mov    %rcx,%rdi
+  801113:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  801116:	48 63 da             	movslq %edx,%rbx
+  801119:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80111c:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801121:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801124:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  801127:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801129:	48 85 c0             	test   %rax,%rax
+  80112c:	7f 06                	jg     801134 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  80112e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801132:	c9                   	leave
+  801133:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801134:	49 89 c0             	mov    %rax,%r8
+  801137:	b9 05 00 00 00       	mov    $0x5,%ecx
+  80113c:	48 ba 10 32 80 00 00 	movabs $0x803210,%rdx
+  801143:	00 00 00 
+  801146:	be 26 00 00 00       	mov    $0x26,%esi
+  80114b:	48 bf 2f 32 80 00 00 	movabs $0x80322f,%rdi
+  801152:	00 00 00 
+  801155:	b8 00 00 00 00       	mov    $0x0,%eax
+  80115a:	49 b9 2c 2a 80 00 00 	movabs $0x802a2c,%r9
+  801161:	00 00 00 
+  801164:	41 ff d1             	call   *%r9
+
+0000000000801167 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  801167:	55                   	push   %rbp
+  801168:	48 89 e5             	mov    %rsp,%rbp
+  80116b:	53                   	push   %rbx
+  80116c:	48 83 ec 08          	sub    $0x8,%rsp
+  801170:	48 89 f1             	mov    %rsi,%rcx
+  801173:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  801176:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801179:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80117e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801183:	be 00 00 00 00       	mov    $0x0,%esi
+  801188:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80118e:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801190:	48 85 c0             	test   %rax,%rax
+  801193:	7f 06                	jg     80119b <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  801195:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801199:	c9                   	leave
+  80119a:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80119b:	49 89 c0             	mov    %rax,%r8
+  80119e:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8011a3:	48 ba 10 32 80 00 00 	movabs $0x803210,%rdx
+  8011aa:	00 00 00 
+  8011ad:	be 26 00 00 00       	mov    $0x26,%esi
+  8011b2:	48 bf 2f 32 80 00 00 	movabs $0x80322f,%rdi
+  8011b9:	00 00 00 
+  8011bc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011c1:	49 b9 2c 2a 80 00 00 	movabs $0x802a2c,%r9
+  8011c8:	00 00 00 
+  8011cb:	41 ff d1             	call   *%r9
+
+00000000008011ce <sys_region_batch>:
+
+int
+sys_region_batch(const struct RegionOp *ops, size_t count) {
+  8011ce:	55                   	push   %rbp
+  8011cf:	48 89 e5             	mov    %rsp,%rbp
+  8011d2:	53                   	push   %rbx
+  8011d3:	48 83 ec 08          	sub    $0x8,%rsp
+  8011d7:	48 89 fa             	mov    %rdi,%rdx
+  8011da:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8011dd:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8011e2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011e7:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8011ec:	be 00 00 00 00       	mov    $0x0,%esi
+  8011f1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8011f7:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8011f9:	48 85 c0             	test   %rax,%rax
+  8011fc:	7f 06                	jg     801204 <sys_region_batch+0x36>
+        else
+            platform_asan_unpoison(va, ops[i].size);
+    }
+#endif
+    return res;
+}
+  8011fe:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801202:	c9                   	leave
+  801203:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801204:	49 89 c0             	mov    %rax,%r8
+  801207:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  80120c:	48 ba 10 32 80 00 00 	movabs $0x803210,%rdx
+  801213:	00 00 00 
+  801216:	be 26 00 00 00       	mov    $0x26,%esi
+  80121b:	48 bf 2f 32 80 00 00 	movabs $0x80322f,%rdi
+  801222:	00 00 00 
+  801225:	b8 00 00 00 00       	mov    $0x0,%eax
+  80122a:	49 b9 2c 2a 80 00 00 	movabs $0x802a2c,%r9
+  801231:	00 00 00 
+  801234:	41 ff d1             	call   *%r9
+
+0000000000801237 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  801237:	55                   	push   %rbp
+  801238:	48 89 e5             	mov    %rsp,%rbp
+  80123b:	53                   	push   %rbx
+  80123c:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  801240:	48 63 ce             	movslq %esi,%rcx
+  801243:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801246:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80124b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801250:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801255:	be 00 00 00 00       	mov    $0x0,%esi
+  80125a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801260:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801262:	48 85 c0             	test   %rax,%rax
+  801265:	7f 06                	jg     80126d <sys_env_set_status+0x36>
+}
+  801267:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80126b:	c9                   	leave
+  80126c:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80126d:	49 89 c0             	mov    %rax,%r8
+  801270:	b9 09 00 00 00       	mov    $0x9,%ecx
+  801275:	48 ba 10 32 80 00 00 	movabs $0x803210,%rdx
+  80127c:	00 00 00 
+  80127f:	be 26 00 00 00       	mov    $0x26,%esi
+  801284:	48 bf 2f 32 80 00 00 	movabs $0x80322f,%rdi
+  80128b:	00 00 00 
+  80128e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801293:	49 b9 2c 2a 80 00 00 	movabs $0x802a2c,%r9
+  80129a:	00 00 00 
+  80129d:	41 ff d1             	call   *%r9
+
+00000000008012a0 <sys_env_set_weight>:
+
+int
+sys_env_set_weight(envid_t envid, uint32_t weight) {
+  8012a0:	55                   	push   %rbp
+  8012a1:	48 89 e5             	mov    %rsp,%rbp
+  8012a4:	53                   	push   %rbx
+  8012a5:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_weight, 1, envid, weight, 0, 0, 0, 0);
+  8012a9:	89 f1                	mov    %esi,%ecx
+  8012ab:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8012ae:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8012b3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012b8:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012bd:	be 00 00 00 00       	mov    $0x0,%esi
+  8012c2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8012c8:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8012ca:	48 85 c0             	test   %rax,%rax
+  8012cd:	7f 06                	jg     8012d5 <sys_env_set_weight+0x35>
+}
+  8012cf:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012d3:	c9                   	leave
+  8012d4:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8012d5:	49 89 c0             	mov    %rax,%r8
+  8012d8:	b9 10 00 00 00       	mov    $0x10,%ecx
+  8012dd:	48 ba 10 32 80 00 00 	movabs $0x803210,%rdx
+  8012e4:	00 00 00 
+  8012e7:	be 26 00 00 00       	mov    $0x26,%esi
+  8012ec:	48 bf 2f 32 80 00 00 	movabs $0x80322f,%rdi
+  8012f3:	00 00 00 
+  8012f6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012fb:	49 b9 2c 2a 80 00 00 	movabs $0x802a2c,%r9
+  801302:	00 00 00 
+  801305:	41 ff d1             	call   *%r9
+
+0000000000801308 <sys_env_set_rt>:
+
+int
+sys_env_set_rt(envid_t envid, uint64_t period, uint64_t budget, uint64_t deadline) {
+  801308:	55                   	push   %rbp
+  801309:	48 89 e5             	mov    %rsp,%rbp
+  80130c:	53                   	push   %rbx
+  80130d:	48 83 ec 08          	sub    $0x8,%rsp
+  801311:	89 f8                	mov    %edi,%eax
+  801313:	48 89 d3             	mov    %rdx,%rbx
+  801316:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_env_set_rt, 1, envid, period, budget, deadline, 0, 0);
+  801319:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80131c:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801321:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801324:	be 00 00 00 00       	mov    $0x0,%esi
+  801329:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80132f:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801331:	48 85 c0             	test   %rax,%rax
+  801334:	7f 06                	jg     80133c <sys_env_set_rt+0x34>
+}
+  801336:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80133a:	c9                   	leave
+  80133b:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80133c:	49 89 c0             	mov    %rax,%r8
+  80133f:	b9 11 00 00 00       	mov    $0x11,%ecx
+  801344:	48 ba 10 32 80 00 00 	movabs $0x803210,%rdx
+  80134b:	00 00 00 
+  80134e:	be 26 00 00 00       	mov    $0x26,%esi
+  801353:	48 bf 2f 32 80 00 00 	movabs $0x80322f,%rdi
+  80135a:	00 00 00 
+  80135d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801362:	49 b9 2c 2a 80 00 00 	movabs $0x802a2c,%r9
+  801369:	00 00 00 
+  80136c:	41 ff d1             	call   *%r9
+
+000000000080136f <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  80136f:	55                   	push   %rbp
+  801370:	48 89 e5             	mov    %rsp,%rbp
+  801373:	53                   	push   %rbx
+  801374:	48 83 ec 08          	sub    $0x8,%rsp
+  801378:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  80137b:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80137e:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801383:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801388:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80138d:	be 00 00 00 00       	mov    $0x0,%esi
+  801392:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801398:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80139a:	48 85 c0             	test   %rax,%rax
+  80139d:	7f 06                	jg     8013a5 <sys_env_set_trapframe+0x36>
+}
+  80139f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013a3:	c9                   	leave
+  8013a4:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8013a5:	49 89 c0             	mov    %rax,%r8
+  8013a8:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  8013ad:	48 ba 10 32 80 00 00 	movabs $0x803210,%rdx
+  8013b4:	00 00 00 
+  8013b7:	be 26 00 00 00       	mov    $0x26,%esi
+  8013bc:	48 bf 2f 32 80 00 00 	movabs $0x80322f,%rdi
+  8013c3:	00 00 00 
+  8013c6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013cb:	49 b9 2c 2a 80 00 00 	movabs $0x802a2c,%r9
+  8013d2:	00 00 00 
+  8013d5:	41 ff d1             	call   *%r9
+
+00000000008013d8 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  8013d8:	55                   	push   %rbp
+  8013d9:	48 89 e5             	mov    %rsp,%rbp
+  8013dc:	53                   	push   %rbx
+  8013dd:	48 83 ec 08          	sub    $0x8,%rsp
+  8013e1:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  8013e4:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8013e7:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8013ec:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013f1:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013f6:	be 00 00 00 00       	mov    $0x0,%esi
+  8013fb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801401:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801403:	48 85 c0             	test   %rax,%rax
+  801406:	7f 06                	jg     80140e <sys_env_set_pgfault_upcall+0x36>
+}
+  801408:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80140c:	c9                   	leave
+  80140d:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80140e:	49 89 c0             	mov    %rax,%r8
+  801411:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  801416:	48 ba 10 32 80 00 00 	movabs $0x803210,%rdx
+  80141d:	00 00 00 
+  801420:	be 26 00 00 00       	mov    $0x26,%esi
+  801425:	48 bf 2f 32 80 00 00 	movabs $0x80322f,%rdi
+  80142c:	00 00 00 
+  80142f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801434:	49 b9 2c 2a 80 00 00 	movabs $0x802a2c,%r9
+  80143b:	00 00 00 
+  80143e:	41 ff d1             	call   *%r9
+
+0000000000801441 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  801441:	55                   	push   %rbp
+  801442:	48 89 e5             	mov    %rsp,%rbp
+  801445:	53                   	push   %rbx
+  801446:	89 f8                	mov    %edi,%eax
+  801448:	49 89 f1             	mov    %rsi,%r9
+  80144b:	48 89 d3             	mov    %rdx,%rbx
+  80144e:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  801451:	49 63 f0             	movslq %r8d,%rsi
+  801454:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801457:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80145c:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80145f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801465:	cd 30                	int    $0x30
+}
+  801467:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80146b:	c9                   	leave
+  80146c:	c3                   	ret
+
+000000000080146d <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  80146d:	55                   	push   %rbp
+  80146e:	48 89 e5             	mov    %rsp,%rbp
+  801471:	53                   	push   %rbx
+  801472:	48 83 ec 08          	sub    $0x8,%rsp
+  801476:	48 89 fa             	mov    %rdi,%rdx
+  801479:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80147c:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801481:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801486:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80148b:	be 00 00 00 00       	mov    $0x0,%esi
+  801490:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801496:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801498:	48 85 c0             	test   %rax,%rax
+  80149b:	7f 06                	jg     8014a3 <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  80149d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014a1:	c9                   	leave
+  8014a2:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8014a3:	49 89 c0             	mov    %rax,%r8
+  8014a6:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  8014ab:	48 ba 10 32 80 00 00 	movabs $0x803210,%rdx
+  8014b2:	00 00 00 
+  8014b5:	be 26 00 00 00       	mov    $0x26,%esi
+  8014ba:	48 bf 2f 32 80 00 00 	movabs $0x80322f,%rdi
+  8014c1:	00 00 00 
+  8014c4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014c9:	49 b9 2c 2a 80 00 00 	movabs $0x802a2c,%r9
+  8014d0:	00 00 00 
+  8014d3:	41 ff d1             	call   *%r9
+
+00000000008014d6 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8014d6:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8014dd:	ff ff ff 
+  8014e0:	48 01 f8             	add    %rdi,%rax
+  8014e3:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  8014e7:	c3                   	ret
+
+00000000008014e8 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8014e8:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8014ef:	ff ff ff 
+  8014f2:	48 01 f8             	add    %rdi,%rax
+  8014f5:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  8014f9:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  8014ff:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  801503:	c3                   	ret
+
+0000000000801504 <fd_alloc_from>:
+}
+
+/* Like fd_alloc(), but only considers fds starting from fdnum,
+ * so that several fds can be found before their pages are allocated */
+int
+fd_alloc_from(int fdnum, struct Fd **fd_store) {
+  801504:	55                   	push   %rbp
+  801505:	48 89 e5             	mov    %rsp,%rbp
+  801508:	41 57                	push   %r15
+  80150a:	41 56                	push   %r14
+  80150c:	41 55                	push   %r13
+  80150e:	41 54                	push   %r12
+  801510:	53                   	push   %rbx
+  801511:	48 83 ec 08          	sub    $0x8,%rsp
+  801515:	49 89 f7             	mov    %rsi,%r15
+    for (int i = MAX(fdnum, 0); i < MAXFD; i++) {
+  801518:	85 ff                	test   %edi,%edi
+  80151a:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  801520:	44 0f 49 e7          	cmovns %edi,%r12d
+  801524:	83 ff 1f             	cmp    $0x1f,%edi
+  801527:	7f 37                	jg     801560 <fd_alloc_from+0x5c>
+  801529:	49 63 dc             	movslq %r12d,%rbx
+  80152c:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  801533:	48 c1 e3 0c          	shl    $0xc,%rbx
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  801537:	49 be 0d 26 80 00 00 	movabs $0x80260d,%r14
+  80153e:	00 00 00 
+        struct Fd *fd = INDEX2FD(i);
+  801541:	49 89 dd             	mov    %rbx,%r13
+        if (!(get_prot(fd) & PROT_R)) {
+  801544:	48 89 df             	mov    %rbx,%rdi
+  801547:	41 ff d6             	call   *%r14
+  80154a:	83 e0 04             	and    $0x4,%eax
+  80154d:	74 1c                	je     80156b <fd_alloc_from+0x67>
+    for (int i = MAX(fdnum, 0); i < MAXFD; i++) {
+  80154f:	41 83 c4 01          	add    $0x1,%r12d
+  801553:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  80155a:	41 83 fc 1f          	cmp    $0x1f,%r12d
+  80155e:	7e e1                	jle    801541 <fd_alloc_from+0x3d>
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  801560:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801566:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  80156b:	4d 89 2f             	mov    %r13,(%r15)
+}
+  80156e:	48 83 c4 08          	add    $0x8,%rsp
+  801572:	5b                   	pop    %rbx
+  801573:	41 5c                	pop    %r12
+  801575:	41 5d                	pop    %r13
+  801577:	41 5e                	pop    %r14
+  801579:	41 5f                	pop    %r15
+  80157b:	5d                   	pop    %rbp
+  80157c:	c3                   	ret
+
+000000000080157d <fd_alloc>:
+fd_alloc(struct Fd **fd_store) {
+  80157d:	55                   	push   %rbp
+  80157e:	48 89 e5             	mov    %rsp,%rbp
+  801581:	48 89 fe             	mov    %rdi,%rsi
+    return fd_alloc_from(0, fd_store);
+  801584:	bf 00 00 00 00       	mov    $0x0,%edi
+  801589:	48 b8 04 15 80 00 00 	movabs $0x801504,%rax
+  801590:	00 00 00 
+  801593:	ff d0                	call   *%rax
+}
+  801595:	5d                   	pop    %rbp
+  801596:	c3                   	ret
+
+0000000000801597 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  801597:	83 ff 1f             	cmp    $0x1f,%edi
+  80159a:	77 39                	ja     8015d5 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  80159c:	55                   	push   %rbp
+  80159d:	48 89 e5             	mov    %rsp,%rbp
+  8015a0:	41 54                	push   %r12
+  8015a2:	53                   	push   %rbx
+  8015a3:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  8015a6:	48 63 df             	movslq %edi,%rbx
+  8015a9:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  8015b0:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  8015b4:	48 89 df             	mov    %rbx,%rdi
+  8015b7:	48 b8 0d 26 80 00 00 	movabs $0x80260d,%rax
+  8015be:	00 00 00 
+  8015c1:	ff d0                	call   *%rax
+  8015c3:	a8 04                	test   $0x4,%al
+  8015c5:	74 14                	je     8015db <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  8015c7:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  8015cb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8015d0:	5b                   	pop    %rbx
+  8015d1:	41 5c                	pop    %r12
+  8015d3:	5d                   	pop    %rbp
+  8015d4:	c3                   	ret
+        return -E_INVAL;
+  8015d5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8015da:	c3                   	ret
+        return -E_INVAL;
+  8015db:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8015e0:	eb ee                	jmp    8015d0 <fd_lookup+0x39>
+
+00000000008015e2 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  8015e2:	55                   	push   %rbp
+  8015e3:	48 89 e5             	mov    %rsp,%rbp
+  8015e6:	41 54                	push   %r12
+  8015e8:	53                   	push   %rbx
+  8015e9:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  8015ec:	48 b8 c0 32 80 00 00 	movabs $0x8032c0,%rax
+  8015f3:	00 00 00 
+  8015f6:	48 bb 20 40 80 00 00 	movabs $0x804020,%rbx
+  8015fd:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  801600:	39 3b                	cmp    %edi,(%rbx)
+  801602:	74 47                	je     80164b <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  801604:	48 83 c0 08          	add    $0x8,%rax
+  801608:	48 8b 18             	mov    (%rax),%rbx
+  80160b:	48 85 db             	test   %rbx,%rbx
+  80160e:	75 f0                	jne    801600 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801610:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801617:	00 00 00 
+  80161a:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+  801620:	89 fa                	mov    %edi,%edx
+  801622:	48 bf 40 32 80 00 00 	movabs $0x803240,%rdi
+  801629:	00 00 00 
+  80162c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801631:	48 b9 c6 01 80 00 00 	movabs $0x8001c6,%rcx
+  801638:	00 00 00 
+  80163b:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  80163d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  801642:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  801646:	5b                   	pop    %rbx
+  801647:	41 5c                	pop    %r12
+  801649:	5d                   	pop    %rbp
+  80164a:	c3                   	ret
+            return 0;
+  80164b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801650:	eb f0                	jmp    801642 <dev_lookup+0x60>
+
+0000000000801652 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  801652:	55                   	push   %rbp
+  801653:	48 89 e5             	mov    %rsp,%rbp
+  801656:	41 55                	push   %r13
+  801658:	41 54                	push   %r12
+  80165a:	53                   	push   %rbx
+  80165b:	48 83 ec 18          	sub    $0x18,%rsp
+  80165f:	48 89 fb             	mov    %rdi,%rbx
+  801662:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801665:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  80166c:	ff ff ff 
+  80166f:	48 01 df             	add    %rbx,%rdi
+  801672:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  801676:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80167a:	48 b8 97 15 80 00 00 	movabs $0x801597,%rax
+  801681:	00 00 00 
+  801684:	ff d0                	call   *%rax
+  801686:	41 89 c5             	mov    %eax,%r13d
+  801689:	85 c0                	test   %eax,%eax
+  80168b:	78 06                	js     801693 <fd_close+0x41>
+  80168d:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  801691:	74 1a                	je     8016ad <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  801693:	45 84 e4             	test   %r12b,%r12b
+  801696:	b8 00 00 00 00       	mov    $0x0,%eax
+  80169b:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  80169f:	44 89 e8             	mov    %r13d,%eax
+  8016a2:	48 83 c4 18          	add    $0x18,%rsp
+  8016a6:	5b                   	pop    %rbx
+  8016a7:	41 5c                	pop    %r12
+  8016a9:	41 5d                	pop    %r13
+  8016ab:	5d                   	pop    %rbp
+  8016ac:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8016ad:	8b 3b                	mov    (%rbx),%edi
+  8016af:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8016b3:	48 b8 e2 15 80 00 00 	movabs $0x8015e2,%rax
+  8016ba:	00 00 00 
+  8016bd:	ff d0                	call   *%rax
+  8016bf:	41 89 c5             	mov    %eax,%r13d
+  8016c2:	85 c0                	test   %eax,%eax
+  8016c4:	78 1b                	js     8016e1 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  8016c6:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8016ca:	48 8b 40 20          	mov    0x20(%rax),%rax
+  8016ce:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  8016d4:	48 85 c0             	test   %rax,%rax
+  8016d7:	74 08                	je     8016e1 <fd_close+0x8f>
+  8016d9:	48 89 df             	mov    %rbx,%rdi
+  8016dc:	ff d0                	call   *%rax
+  8016de:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8016e1:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8016e6:	48 89 de             	mov    %rbx,%rsi
+  8016e9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8016ee:	48 b8 67 11 80 00 00 	movabs $0x801167,%rax
+  8016f5:	00 00 00 
+  8016f8:	ff d0                	call   *%rax
+    return res;
+  8016fa:	eb a3                	jmp    80169f <fd_close+0x4d>
+
+00000000008016fc <close>:
+
+int
+close(int fdnum) {
+  8016fc:	55                   	push   %rbp
+  8016fd:	48 89 e5             	mov    %rsp,%rbp
+  801700:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  801704:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801708:	48 b8 97 15 80 00 00 	movabs $0x801597,%rax
+  80170f:	00 00 00 
+  801712:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801714:	85 c0                	test   %eax,%eax
+  801716:	78 15                	js     80172d <close+0x31>
+
+    return fd_close(fd, 1);
+  801718:	be 01 00 00 00       	mov    $0x1,%esi
+  80171d:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801721:	48 b8 52 16 80 00 00 	movabs $0x801652,%rax
+  801728:	00 00 00 
+  80172b:	ff d0                	call   *%rax
+}
+  80172d:	c9                   	leave
+  80172e:	c3                   	ret
+
+000000000080172f <close_all>:
+
+void
+close_all(void) {
+  80172f:	55                   	push   %rbp
+  801730:	48 89 e5             	mov    %rsp,%rbp
+  801733:	41 54                	push   %r12
+  801735:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  801736:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80173b:	49 bc fc 16 80 00 00 	movabs $0x8016fc,%r12
+  801742:	00 00 00 
+  801745:	89 df                	mov    %ebx,%edi
+  801747:	41 ff d4             	call   *%r12
+  80174a:	83 c3 01             	add    $0x1,%ebx
+  80174d:	83 fb 20             	cmp    $0x20,%ebx
+  801750:	75 f3                	jne    801745 <close_all+0x16>
+}
+  801752:	5b                   	pop    %rbx
+  801753:	41 5c                	pop    %r12
+  801755:	5d                   	pop    %rbp
+  801756:	c3                   	ret
+
+0000000000801757 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  801757:	55                   	push   %rbp
+  801758:	48 89 e5             	mov    %rsp,%rbp
+  80175b:	41 57                	push   %r15
+  80175d:	41 56                	push   %r14
+  80175f:	41 55                	push   %r13
+  801761:	41 54                	push   %r12
+  801763:	53                   	push   %rbx
+  801764:	48 83 ec 18          	sub    $0x18,%rsp
+  801768:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  80176b:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  80176f:	48 b8 97 15 80 00 00 	movabs $0x801597,%rax
+  801776:	00 00 00 
+  801779:	ff d0                	call   *%rax
+  80177b:	89 c3                	mov    %eax,%ebx
+  80177d:	85 c0                	test   %eax,%eax
+  80177f:	0f 88 b8 00 00 00    	js     80183d <dup+0xe6>
+    close(newfdnum);
+  801785:	44 89 e7             	mov    %r12d,%edi
+  801788:	48 b8 fc 16 80 00 00 	movabs $0x8016fc,%rax
+  80178f:	00 00 00 
+  801792:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  801794:	4d 63 ec             	movslq %r12d,%r13
+  801797:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  80179e:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  8017a2:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  8017a6:	4c 89 ff             	mov    %r15,%rdi
+  8017a9:	49 be e8 14 80 00 00 	movabs $0x8014e8,%r14
+  8017b0:	00 00 00 
+  8017b3:	41 ff d6             	call   *%r14
+  8017b6:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  8017b9:	4c 89 ef             	mov    %r13,%rdi
+  8017bc:	41 ff d6             	call   *%r14
+  8017bf:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  8017c2:	48 89 df             	mov    %rbx,%rdi
+  8017c5:	48 b8 0d 26 80 00 00 	movabs $0x80260d,%rax
+  8017cc:	00 00 00 
+  8017cf:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  8017d1:	a8 04                	test   $0x4,%al
+  8017d3:	74 2b                	je     801800 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  8017d5:	41 89 c1             	mov    %eax,%r9d
+  8017d8:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8017de:	4c 89 f1             	mov    %r14,%rcx
+  8017e1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8017e6:	48 89 de             	mov    %rbx,%rsi
+  8017e9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8017ee:	48 b8 02 11 80 00 00 	movabs $0x801102,%rax
+  8017f5:	00 00 00 
+  8017f8:	ff d0                	call   *%rax
+  8017fa:	89 c3                	mov    %eax,%ebx
+  8017fc:	85 c0                	test   %eax,%eax
+  8017fe:	78 4e                	js     80184e <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  801800:	4c 89 ff             	mov    %r15,%rdi
+  801803:	48 b8 0d 26 80 00 00 	movabs $0x80260d,%rax
+  80180a:	00 00 00 
+  80180d:	ff d0                	call   *%rax
+  80180f:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801812:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801818:	4c 89 e9             	mov    %r13,%rcx
+  80181b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801820:	4c 89 fe             	mov    %r15,%rsi
+  801823:	bf 00 00 00 00       	mov    $0x0,%edi
+  801828:	48 b8 02 11 80 00 00 	movabs $0x801102,%rax
+  80182f:	00 00 00 
+  801832:	ff d0                	call   *%rax
+  801834:	89 c3                	mov    %eax,%ebx
+  801836:	85 c0                	test   %eax,%eax
+  801838:	78 14                	js     80184e <dup+0xf7>
+
+    return newfdnum;
+  80183a:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  80183d:	89 d8                	mov    %ebx,%eax
+  80183f:	48 83 c4 18          	add    $0x18,%rsp
+  801843:	5b                   	pop    %rbx
+  801844:	41 5c                	pop    %r12
+  801846:	41 5d                	pop    %r13
+  801848:	41 5e                	pop    %r14
+  80184a:	41 5f                	pop    %r15
+  80184c:	5d                   	pop    %rbp
+  80184d:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  80184e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801853:	4c 89 ee             	mov    %r13,%rsi
+  801856:	bf 00 00 00 00       	mov    $0x0,%edi
+  80185b:	49 bc 67 11 80 00 00 	movabs $0x801167,%r12
+  801862:	00 00 00 
+  801865:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  801868:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80186d:	4c 89 f6             	mov    %r14,%rsi
+  801870:	bf 00 00 00 00       	mov    $0x0,%edi
+  801875:	41 ff d4             	call   *%r12
+    return res;
+  801878:	eb c3                	jmp    80183d <dup+0xe6>
+
+000000000080187a <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  80187a:	55                   	push   %rbp
+  80187b:	48 89 e5             	mov    %rsp,%rbp
+  80187e:	41 56                	push   %r14
+  801880:	41 55                	push   %r13
+  801882:	41 54                	push   %r12
+  801884:	53                   	push   %rbx
+  801885:	48 83 ec 10          	sub    $0x10,%rsp
+  801889:	89 fb                	mov    %edi,%ebx
+  80188b:	49 89 f4             	mov    %rsi,%r12
+  80188e:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801891:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801895:	48 b8 97 15 80 00 00 	movabs $0x801597,%rax
+  80189c:	00 00 00 
+  80189f:	ff d0                	call   *%rax
+  8018a1:	85 c0                	test   %eax,%eax
+  8018a3:	78 4c                	js     8018f1 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8018a5:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  8018a9:	41 8b 3e             	mov    (%r14),%edi
+  8018ac:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8018b0:	48 b8 e2 15 80 00 00 	movabs $0x8015e2,%rax
+  8018b7:	00 00 00 
+  8018ba:	ff d0                	call   *%rax
+  8018bc:	85 c0                	test   %eax,%eax
+  8018be:	78 35                	js     8018f5 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8018c0:	41 8b 46 08          	mov    0x8(%r14),%eax
+  8018c4:	83 e0 03             	and    $0x3,%eax
+  8018c7:	83 f8 01             	cmp    $0x1,%eax
+  8018ca:	74 2d                	je     8018f9 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  8018cc:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8018d0:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8018d4:	48 85 c0             	test   %rax,%rax
+  8018d7:	74 56                	je     80192f <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  8018d9:	4c 89 ea             	mov    %r13,%rdx
+  8018dc:	4c 89 e6             	mov    %r12,%rsi
+  8018df:	4c 89 f7             	mov    %r14,%rdi
+  8018e2:	ff d0                	call   *%rax
+}
+  8018e4:	48 83 c4 10          	add    $0x10,%rsp
+  8018e8:	5b                   	pop    %rbx
+  8018e9:	41 5c                	pop    %r12
+  8018eb:	41 5d                	pop    %r13
+  8018ed:	41 5e                	pop    %r14
+  8018ef:	5d                   	pop    %rbp
+  8018f0:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8018f1:	48 98                	cltq
+  8018f3:	eb ef                	jmp    8018e4 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8018f5:	48 98                	cltq
+  8018f7:	eb eb                	jmp    8018e4 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8018f9:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801900:	00 00 00 
+  801903:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+  801909:	89 da                	mov    %ebx,%edx
+  80190b:	48 bf 81 32 80 00 00 	movabs $0x803281,%rdi
+  801912:	00 00 00 
+  801915:	b8 00 00 00 00       	mov    $0x0,%eax
+  80191a:	48 b9 c6 01 80 00 00 	movabs $0x8001c6,%rcx
+  801921:	00 00 00 
+  801924:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801926:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80192d:	eb b5                	jmp    8018e4 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  80192f:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801936:	eb ac                	jmp    8018e4 <read+0x6a>
+
+0000000000801938 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801938:	55                   	push   %rbp
+  801939:	48 89 e5             	mov    %rsp,%rbp
+  80193c:	41 57                	push   %r15
+  80193e:	41 56                	push   %r14
+  801940:	41 55                	push   %r13
+  801942:	41 54                	push   %r12
+  801944:	53                   	push   %rbx
+  801945:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  801949:	48 85 d2             	test   %rdx,%rdx
+  80194c:	74 54                	je     8019a2 <readn+0x6a>
+  80194e:	41 89 fd             	mov    %edi,%r13d
+  801951:	49 89 f6             	mov    %rsi,%r14
+  801954:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  801957:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  80195c:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  801961:	49 bf 7a 18 80 00 00 	movabs $0x80187a,%r15
+  801968:	00 00 00 
+  80196b:	4c 89 e2             	mov    %r12,%rdx
+  80196e:	48 29 f2             	sub    %rsi,%rdx
+  801971:	4c 01 f6             	add    %r14,%rsi
+  801974:	44 89 ef             	mov    %r13d,%edi
+  801977:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  80197a:	85 c0                	test   %eax,%eax
+  80197c:	78 20                	js     80199e <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  80197e:	01 c3                	add    %eax,%ebx
+  801980:	85 c0                	test   %eax,%eax
+  801982:	74 08                	je     80198c <readn+0x54>
+  801984:	48 63 f3             	movslq %ebx,%rsi
+  801987:	4c 39 e6             	cmp    %r12,%rsi
+  80198a:	72 df                	jb     80196b <readn+0x33>
+    }
+    return res;
+  80198c:	48 63 c3             	movslq %ebx,%rax
+}
+  80198f:	48 83 c4 08          	add    $0x8,%rsp
+  801993:	5b                   	pop    %rbx
+  801994:	41 5c                	pop    %r12
+  801996:	41 5d                	pop    %r13
+  801998:	41 5e                	pop    %r14
+  80199a:	41 5f                	pop    %r15
+  80199c:	5d                   	pop    %rbp
+  80199d:	c3                   	ret
+        if (inc < 0) return inc;
+  80199e:	48 98                	cltq
+  8019a0:	eb ed                	jmp    80198f <readn+0x57>
+    int inc = 1, res = 0;
+  8019a2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8019a7:	eb e3                	jmp    80198c <readn+0x54>
+
+00000000008019a9 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  8019a9:	55                   	push   %rbp
+  8019aa:	48 89 e5             	mov    %rsp,%rbp
+  8019ad:	41 56                	push   %r14
+  8019af:	41 55                	push   %r13
+  8019b1:	41 54                	push   %r12
+  8019b3:	53                   	push   %rbx
+  8019b4:	48 83 ec 10          	sub    $0x10,%rsp
+  8019b8:	89 fb                	mov    %edi,%ebx
+  8019ba:	49 89 f4             	mov    %rsi,%r12
+  8019bd:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8019c0:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8019c4:	48 b8 97 15 80 00 00 	movabs $0x801597,%rax
+  8019cb:	00 00 00 
+  8019ce:	ff d0                	call   *%rax
+  8019d0:	85 c0                	test   %eax,%eax
+  8019d2:	78 47                	js     801a1b <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8019d4:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  8019d8:	41 8b 3e             	mov    (%r14),%edi
+  8019db:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8019df:	48 b8 e2 15 80 00 00 	movabs $0x8015e2,%rax
+  8019e6:	00 00 00 
+  8019e9:	ff d0                	call   *%rax
+  8019eb:	85 c0                	test   %eax,%eax
+  8019ed:	78 30                	js     801a1f <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8019ef:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  8019f4:	74 2d                	je     801a23 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  8019f6:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8019fa:	48 8b 40 18          	mov    0x18(%rax),%rax
+  8019fe:	48 85 c0             	test   %rax,%rax
+  801a01:	74 56                	je     801a59 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  801a03:	4c 89 ea             	mov    %r13,%rdx
+  801a06:	4c 89 e6             	mov    %r12,%rsi
+  801a09:	4c 89 f7             	mov    %r14,%rdi
+  801a0c:	ff d0                	call   *%rax
+}
+  801a0e:	48 83 c4 10          	add    $0x10,%rsp
+  801a12:	5b                   	pop    %rbx
+  801a13:	41 5c                	pop    %r12
+  801a15:	41 5d                	pop    %r13
+  801a17:	41 5e                	pop    %r14
+  801a19:	5d                   	pop    %rbp
+  801a1a:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801a1b:	48 98                	cltq
+  801a1d:	eb ef                	jmp    801a0e <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801a1f:	48 98                	cltq
+  801a21:	eb eb                	jmp    801a0e <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801a23:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801a2a:	00 00 00 
+  801a2d:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+  801a33:	89 da                	mov    %ebx,%edx
+  801a35:	48 bf 9d 32 80 00 00 	movabs $0x80329d,%rdi
+  801a3c:	00 00 00 
+  801a3f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a44:	48 b9 c6 01 80 00 00 	movabs $0x8001c6,%rcx
+  801a4b:	00 00 00 
+  801a4e:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801a50:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801a57:	eb b5                	jmp    801a0e <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801a59:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801a60:	eb ac                	jmp    801a0e <write+0x65>
+
+0000000000801a62 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  801a62:	55                   	push   %rbp
+  801a63:	48 89 e5             	mov    %rsp,%rbp
+  801a66:	53                   	push   %rbx
+  801a67:	48 83 ec 18          	sub    $0x18,%rsp
+  801a6b:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801a6d:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801a71:	48 b8 97 15 80 00 00 	movabs $0x801597,%rax
+  801a78:	00 00 00 
+  801a7b:	ff d0                	call   *%rax
+  801a7d:	85 c0                	test   %eax,%eax
+  801a7f:	78 0c                	js     801a8d <seek+0x2b>
+
+    fd->fd_offset = offset;
+  801a81:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801a85:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  801a88:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801a8d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801a91:	c9                   	leave
+  801a92:	c3                   	ret
+
+0000000000801a93 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  801a93:	55                   	push   %rbp
+  801a94:	48 89 e5             	mov    %rsp,%rbp
+  801a97:	41 55                	push   %r13
+  801a99:	41 54                	push   %r12
+  801a9b:	53                   	push   %rbx
+  801a9c:	48 83 ec 18          	sub    $0x18,%rsp
+  801aa0:	89 fb                	mov    %edi,%ebx
+  801aa2:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801aa5:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801aa9:	48 b8 97 15 80 00 00 	movabs $0x801597,%rax
+  801ab0:	00 00 00 
+  801ab3:	ff d0                	call   *%rax
+  801ab5:	85 c0                	test   %eax,%eax
+  801ab7:	78 38                	js     801af1 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801ab9:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  801abd:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  801ac1:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801ac5:	48 b8 e2 15 80 00 00 	movabs $0x8015e2,%rax
+  801acc:	00 00 00 
+  801acf:	ff d0                	call   *%rax
+  801ad1:	85 c0                	test   %eax,%eax
+  801ad3:	78 1c                	js     801af1 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801ad5:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  801ada:	74 20                	je     801afc <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801adc:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801ae0:	48 8b 40 30          	mov    0x30(%rax),%rax
+  801ae4:	48 85 c0             	test   %rax,%rax
+  801ae7:	74 47                	je     801b30 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  801ae9:	44 89 e6             	mov    %r12d,%esi
+  801aec:	4c 89 ef             	mov    %r13,%rdi
+  801aef:	ff d0                	call   *%rax
+}
+  801af1:	48 83 c4 18          	add    $0x18,%rsp
+  801af5:	5b                   	pop    %rbx
+  801af6:	41 5c                	pop    %r12
+  801af8:	41 5d                	pop    %r13
+  801afa:	5d                   	pop    %rbp
+  801afb:	c3                   	ret
+                thisenv->env_id, fdnum);
+  801afc:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801b03:	00 00 00 
+  801b06:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801b0c:	89 da                	mov    %ebx,%edx
+  801b0e:	48 bf 60 32 80 00 00 	movabs $0x803260,%rdi
+  801b15:	00 00 00 
+  801b18:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b1d:	48 b9 c6 01 80 00 00 	movabs $0x8001c6,%rcx
+  801b24:	00 00 00 
+  801b27:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801b29:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801b2e:	eb c1                	jmp    801af1 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801b30:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801b35:	eb ba                	jmp    801af1 <ftruncate+0x5e>
+
+0000000000801b37 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  801b37:	55                   	push   %rbp
+  801b38:	48 89 e5             	mov    %rsp,%rbp
+  801b3b:	41 54                	push   %r12
+  801b3d:	53                   	push   %rbx
+  801b3e:	48 83 ec 10          	sub    $0x10,%rsp
+  801b42:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801b45:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801b49:	48 b8 97 15 80 00 00 	movabs $0x801597,%rax
+  801b50:	00 00 00 
+  801b53:	ff d0                	call   *%rax
+  801b55:	85 c0                	test   %eax,%eax
+  801b57:	78 4e                	js     801ba7 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801b59:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801b5d:	41 8b 3c 24          	mov    (%r12),%edi
+  801b61:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801b65:	48 b8 e2 15 80 00 00 	movabs $0x8015e2,%rax
+  801b6c:	00 00 00 
+  801b6f:	ff d0                	call   *%rax
+  801b71:	85 c0                	test   %eax,%eax
+  801b73:	78 32                	js     801ba7 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801b75:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801b79:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  801b7e:	74 30                	je     801bb0 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  801b80:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  801b83:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  801b8a:	00 00 00 
+    stat->st_isdir = 0;
+  801b8d:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  801b94:	00 00 00 
+    stat->st_dev = dev;
+  801b97:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  801b9e:	48 89 de             	mov    %rbx,%rsi
+  801ba1:	4c 89 e7             	mov    %r12,%rdi
+  801ba4:	ff 50 28             	call   *0x28(%rax)
+}
+  801ba7:	48 83 c4 10          	add    $0x10,%rsp
+  801bab:	5b                   	pop    %rbx
+  801bac:	41 5c                	pop    %r12
+  801bae:	5d                   	pop    %rbp
+  801baf:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801bb0:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801bb5:	eb f0                	jmp    801ba7 <fstat+0x70>
+
+0000000000801bb7 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  801bb7:	55                   	push   %rbp
+  801bb8:	48 89 e5             	mov    %rsp,%rbp
+  801bbb:	41 54                	push   %r12
+  801bbd:	53                   	push   %rbx
+  801bbe:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  801bc1:	be 00 00 00 00       	mov    $0x0,%esi
+  801bc6:	48 b8 9a 1f 80 00 00 	movabs $0x801f9a,%rax
+  801bcd:	00 00 00 
+  801bd0:	ff d0                	call   *%rax
+  801bd2:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  801bd4:	85 c0                	test   %eax,%eax
+  801bd6:	78 25                	js     801bfd <stat+0x46>
+
+    int res = fstat(fd, stat);
+  801bd8:	4c 89 e6             	mov    %r12,%rsi
+  801bdb:	89 c7                	mov    %eax,%edi
+  801bdd:	48 b8 37 1b 80 00 00 	movabs $0x801b37,%rax
+  801be4:	00 00 00 
+  801be7:	ff d0                	call   *%rax
+  801be9:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  801bec:	89 df                	mov    %ebx,%edi
+  801bee:	48 b8 fc 16 80 00 00 	movabs $0x8016fc,%rax
+  801bf5:	00 00 00 
+  801bf8:	ff d0                	call   *%rax
+
+    return res;
+  801bfa:	44 89 e3             	mov    %r12d,%ebx
+}
+  801bfd:	89 d8                	mov    %ebx,%eax
+  801bff:	5b                   	pop    %rbx
+  801c00:	41 5c                	pop    %r12
+  801c02:	5d                   	pop    %rbp
+  801c03:	c3                   	ret
+
+0000000000801c04 <fsipc>:
+ * response may be written back to fsipcbuf.
+ * type: request code, passed as the simple integer IPC value.
+ * dstva: virtual address at which to receive reply page, 0 if none.
+ * Returns result from the file server. */
+static int
+fsipc(unsigned type, void *dstva) {
+  801c04:	55                   	push   %rbp
+  801c05:	48 89 e5             	mov    %rsp,%rbp
+  801c08:	41 54                	push   %r12
+  801c0a:	53                   	push   %rbx
+  801c0b:	48 83 ec 10          	sub    $0x10,%rsp
+  801c0f:	41 89 fc             	mov    %edi,%r12d
+  801c12:	48 89 f3             	mov    %rsi,%rbx
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  801c15:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  801c1c:	00 00 00 
+  801c1f:	83 38 00             	cmpl   $0x0,(%rax)
+  801c22:	74 5e                	je     801c82 <fsipc+0x7e>
+    if (debug) {
+        cprintf("[%08x] fsipc %d %08x\n",
+                thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+    }
+
+    ipc_send(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW);
+  801c24:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  801c2a:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  801c2f:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  801c36:	00 00 00 
+  801c39:	44 89 e6             	mov    %r12d,%esi
+  801c3c:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  801c43:	00 00 00 
+  801c46:	8b 38                	mov    (%rax),%edi
+  801c48:	48 b8 a4 2b 80 00 00 	movabs $0x802ba4,%rax
+  801c4f:	00 00 00 
+  801c52:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  801c54:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  801c5b:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  801c5c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801c61:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  801c65:	48 89 de             	mov    %rbx,%rsi
+  801c68:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c6d:	48 b8 cf 2a 80 00 00 	movabs $0x802acf,%rax
+  801c74:	00 00 00 
+  801c77:	ff d0                	call   *%rax
+}
+  801c79:	48 83 c4 10          	add    $0x10,%rsp
+  801c7d:	5b                   	pop    %rbx
+  801c7e:	41 5c                	pop    %r12
+  801c80:	5d                   	pop    %rbp
+  801c81:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  801c82:	bf 03 00 00 00       	mov    $0x3,%edi
+  801c87:	48 b8 47 2c 80 00 00 	movabs $0x802c47,%rax
+  801c8e:	00 00 00 
+  801c91:	ff d0                	call   *%rax
+  801c93:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  801c9a:	00 00 
+  801c9c:	eb 86                	jmp    801c24 <fsipc+0x20>
+
+0000000000801c9e <devfile_trunc>:
+    return 0;
+}
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  801c9e:	55                   	push   %rbp
+  801c9f:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801ca2:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  801ca9:	00 00 00 
+  801cac:	8b 57 0c             	mov    0xc(%rdi),%edx
+  801caf:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  801cb1:	89 70 04             	mov    %esi,0x4(%rax)
+
+    return fsipc(FSREQ_SET_SIZE, NULL);
+  801cb4:	be 00 00 00 00       	mov    $0x0,%esi
+  801cb9:	bf 02 00 00 00       	mov    $0x2,%edi
+  801cbe:	48 b8 04 1c 80 00 00 	movabs $0x801c04,%rax
+  801cc5:	00 00 00 
+  801cc8:	ff d0                	call   *%rax
+}
+  801cca:	5d                   	pop    %rbp
+  801ccb:	c3                   	ret
+
+0000000000801ccc <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  801ccc:	55                   	push   %rbp
+  801ccd:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801cd0:	8b 47 0c             	mov    0xc(%rdi),%eax
+  801cd3:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  801cda:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  801cdc:	be 00 00 00 00       	mov    $0x0,%esi
+  801ce1:	bf 06 00 00 00       	mov    $0x6,%edi
+  801ce6:	48 b8 04 1c 80 00 00 	movabs $0x801c04,%rax
+  801ced:	00 00 00 
+  801cf0:	ff d0                	call   *%rax
+}
+  801cf2:	5d                   	pop    %rbp
+  801cf3:	c3                   	ret
+
+0000000000801cf4 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  801cf4:	55                   	push   %rbp
+  801cf5:	48 89 e5             	mov    %rsp,%rbp
+  801cf8:	41 54                	push   %r12
+  801cfa:	53                   	push   %rbx
+  801cfb:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801cfe:	8b 47 0c             	mov    0xc(%rdi),%eax
+  801d01:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  801d08:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  801d0a:	be 00 00 00 00       	mov    $0x0,%esi
+  801d0f:	bf 05 00 00 00       	mov    $0x5,%edi
+  801d14:	48 b8 04 1c 80 00 00 	movabs $0x801c04,%rax
+  801d1b:	00 00 00 
+  801d1e:	ff d0                	call   *%rax
+    if (res < 0) {
+  801d20:	85 c0                	test   %eax,%eax
+  801d22:	78 3d                	js     801d61 <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801d24:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  801d2b:	00 00 00 
+  801d2e:	4c 89 e6             	mov    %r12,%rsi
+  801d31:	48 89 df             	mov    %rbx,%rdi
+  801d34:	48 b8 eb 0a 80 00 00 	movabs $0x800aeb,%rax
+  801d3b:	00 00 00 
+  801d3e:	ff d0                	call   *%rax
+    st->st_size  = fsipcbuf.statRet.ret_size;
+  801d40:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  801d47:	00 
+  801d48:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801d4e:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  801d55:	00 
+  801d56:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  801d5c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801d61:	5b                   	pop    %rbx
+  801d62:	41 5c                	pop    %r12
+  801d64:	5d                   	pop    %rbp
+  801d65:	c3                   	ret
+
+0000000000801d66 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  801d66:	55                   	push   %rbp
+  801d67:	48 89 e5             	mov    %rsp,%rbp
+  801d6a:	41 57                	push   %r15
+  801d6c:	41 56                	push   %r14
+  801d6e:	41 55                	push   %r13
+  801d70:	41 54                	push   %r12
+  801d72:	53                   	push   %rbx
+  801d73:	48 83 ec 18          	sub    $0x18,%rsp
+  801d77:	49 89 fe             	mov    %rdi,%r14
+  801d7a:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+  801d7e:	48 89 d3             	mov    %rdx,%rbx
+    while (n > sizeof(fsipcbuf.write.req_buf))
+  801d81:	48 81 fa f0 0f 00 00 	cmp    $0xff0,%rdx
+  801d88:	0f 86 e4 00 00 00    	jbe    801e72 <devfile_write+0x10c>
+  801d8e:	49 89 f4             	mov    %rsi,%r12
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801d91:	49 bd 00 60 80 00 00 	movabs $0x806000,%r13
+  801d98:	00 00 00 
+        memcpy(fsipcbuf.write.req_buf, buf, sizeof(fsipcbuf.write.req_buf));
+  801d9b:	49 bf 4c 0d 80 00 00 	movabs $0x800d4c,%r15
+  801da2:	00 00 00 
+  801da5:	eb 03                	jmp    801daa <devfile_write+0x44>
+        buf += sizeof(fsipcbuf.write.req_buf);
+  801da7:	49 89 f4             	mov    %rsi,%r12
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801daa:	41 8b 46 0c          	mov    0xc(%r14),%eax
+  801dae:	41 89 45 00          	mov    %eax,0x0(%r13)
+        fsipcbuf.write.req_n      = sizeof(fsipcbuf.write.req_buf);
+  801db2:	49 c7 45 08 f0 0f 00 	movq   $0xff0,0x8(%r13)
+  801db9:	00 
+        memcpy(fsipcbuf.write.req_buf, buf, sizeof(fsipcbuf.write.req_buf));
+  801dba:	ba f0 0f 00 00       	mov    $0xff0,%edx
+  801dbf:	4c 89 e6             	mov    %r12,%rsi
+  801dc2:	48 bf 10 60 80 00 00 	movabs $0x806010,%rdi
+  801dc9:	00 00 00 
+  801dcc:	41 ff d7             	call   *%r15
+        ssize_t res = fsipc(FSREQ_WRITE, NULL);
+  801dcf:	be 00 00 00 00       	mov    $0x0,%esi
+  801dd4:	bf 04 00 00 00       	mov    $0x4,%edi
+  801dd9:	48 b8 04 1c 80 00 00 	movabs $0x801c04,%rax
+  801de0:	00 00 00 
+  801de3:	ff d0                	call   *%rax
+  801de5:	48 63 d0             	movslq %eax,%rdx
+        if (res < 0 || res < sizeof(fsipcbuf.write.req_buf))
+  801de8:	3d ef 0f 00 00       	cmp    $0xfef,%eax
+  801ded:	7e 71                	jle    801e60 <devfile_write+0xfa>
+        buf += sizeof(fsipcbuf.write.req_buf);
+  801def:	49 8d b4 24 f0 0f 00 	lea    0xff0(%r12),%rsi
+  801df6:	00 
+        n -= sizeof(fsipcbuf.write.req_buf);
+  801df7:	48 81 eb f0 0f 00 00 	sub    $0xff0,%rbx
+    while (n > sizeof(fsipcbuf.write.req_buf))
+  801dfe:	48 81 fb f0 0f 00 00 	cmp    $0xff0,%rbx
+  801e05:	77 a0                	ja     801da7 <devfile_write+0x41>
+        written += sizeof(fsipcbuf.write.req_buf);
+  801e07:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801e0b:	49 29 c4             	sub    %rax,%r12
+  801e0e:	4d 8d a4 24 f0 0f 00 	lea    0xff0(%r12),%r12
+  801e15:	00 
+    fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801e16:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  801e1d:	00 00 00 
+  801e20:	41 8b 56 0c          	mov    0xc(%r14),%edx
+  801e24:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.write.req_n      = n;
+  801e26:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    memcpy(fsipcbuf.write.req_buf, buf, n);
+  801e2a:	48 89 da             	mov    %rbx,%rdx
+  801e2d:	48 8d 78 10          	lea    0x10(%rax),%rdi
+  801e31:	48 b8 4c 0d 80 00 00 	movabs $0x800d4c,%rax
+  801e38:	00 00 00 
+  801e3b:	ff d0                	call   *%rax
+    ssize_t res = fsipc(FSREQ_WRITE, NULL);
+  801e3d:	be 00 00 00 00       	mov    $0x0,%esi
+  801e42:	bf 04 00 00 00       	mov    $0x4,%edi
+  801e47:	48 b8 04 1c 80 00 00 	movabs $0x801c04,%rax
+  801e4e:	00 00 00 
+  801e51:	ff d0                	call   *%rax
+  801e53:	48 63 d0             	movslq %eax,%rdx
+    written += res;
+  801e56:	49 01 d4             	add    %rdx,%r12
+  801e59:	48 85 d2             	test   %rdx,%rdx
+  801e5c:	49 0f 49 d4          	cmovns %r12,%rdx
+}
+  801e60:	48 89 d0             	mov    %rdx,%rax
+  801e63:	48 83 c4 18          	add    $0x18,%rsp
+  801e67:	5b                   	pop    %rbx
+  801e68:	41 5c                	pop    %r12
+  801e6a:	41 5d                	pop    %r13
+  801e6c:	41 5e                	pop    %r14
+  801e6e:	41 5f                	pop    %r15
+  801e70:	5d                   	pop    %rbp
+  801e71:	c3                   	ret
+    while (n > sizeof(fsipcbuf.write.req_buf))
+  801e72:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+    ssize_t written = 0;
+  801e76:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  801e7c:	eb 98                	jmp    801e16 <devfile_write+0xb0>
+
+0000000000801e7e <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  801e7e:	55                   	push   %rbp
+  801e7f:	48 89 e5             	mov    %rsp,%rbp
+  801e82:	41 57                	push   %r15
+  801e84:	41 56                	push   %r14
+  801e86:	41 55                	push   %r13
+  801e88:	41 54                	push   %r12
+  801e8a:	53                   	push   %rbx
+  801e8b:	48 83 ec 18          	sub    $0x18,%rsp
+  801e8f:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  801e93:	49 89 f6             	mov    %rsi,%r14
+  801e96:	49 89 d4             	mov    %rdx,%r12
+    while (n > sizeof(fsipcbuf.readRet.ret_buf))
+  801e99:	48 81 fa 00 10 00 00 	cmp    $0x1000,%rdx
+  801ea0:	0f 86 ea 00 00 00    	jbe    801f90 <devfile_read+0x112>
+    ssize_t readsz = 0;
+  801ea6:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  801ead:	00 
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801eae:	49 bf 00 60 80 00 00 	movabs $0x806000,%r15
+  801eb5:	00 00 00 
+  801eb8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801ebc:	8b 40 0c             	mov    0xc(%rax),%eax
+  801ebf:	41 89 07             	mov    %eax,(%r15)
+        fsipcbuf.read.req_n = sizeof(fsipcbuf.readRet.ret_buf);
+  801ec2:	49 c7 47 08 00 10 00 	movq   $0x1000,0x8(%r15)
+  801ec9:	00 
+        ssize_t res = fsipc(FSREQ_READ, NULL);
+  801eca:	be 00 00 00 00       	mov    $0x0,%esi
+  801ecf:	bf 03 00 00 00       	mov    $0x3,%edi
+  801ed4:	48 b8 04 1c 80 00 00 	movabs $0x801c04,%rax
+  801edb:	00 00 00 
+  801ede:	ff d0                	call   *%rax
+  801ee0:	4c 63 e8             	movslq %eax,%r13
+        if (res < 0)
+  801ee3:	4d 85 ed             	test   %r13,%r13
+  801ee6:	0f 88 92 00 00 00    	js     801f7e <devfile_read+0x100>
+        memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  801eec:	4c 89 ea             	mov    %r13,%rdx
+  801eef:	4c 89 fe             	mov    %r15,%rsi
+  801ef2:	4c 89 f7             	mov    %r14,%rdi
+  801ef5:	48 b8 4c 0d 80 00 00 	movabs $0x800d4c,%rax
+  801efc:	00 00 00 
+  801eff:	ff d0                	call   *%rax
+        if (res < sizeof(fsipcbuf.readRet.ret_buf))
+  801f01:	49 81 fd ff 0f 00 00 	cmp    $0xfff,%r13
+  801f08:	76 6d                	jbe    801f77 <devfile_read+0xf9>
+        readsz += res;
+  801f0a:	4c 01 6d c0          	add    %r13,-0x40(%rbp)
+        buf += res;
+  801f0e:	4d 01 ee             	add    %r13,%r14
+        n -= res;
+  801f11:	4d 29 ec             	sub    %r13,%r12
+    while (n > sizeof(fsipcbuf.readRet.ret_buf))
+  801f14:	49 81 fc 00 10 00 00 	cmp    $0x1000,%r12
+  801f1b:	77 9b                	ja     801eb8 <devfile_read+0x3a>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801f1d:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  801f24:	00 00 00 
+  801f27:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  801f2b:	8b 51 0c             	mov    0xc(%rcx),%edx
+  801f2e:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.read.req_n = n;
+  801f30:	4c 89 60 08          	mov    %r12,0x8(%rax)
+    ssize_t res = fsipc(FSREQ_READ, NULL);
+  801f34:	be 00 00 00 00       	mov    $0x0,%esi
+  801f39:	bf 03 00 00 00       	mov    $0x3,%edi
+  801f3e:	48 b8 04 1c 80 00 00 	movabs $0x801c04,%rax
+  801f45:	00 00 00 
+  801f48:	ff d0                	call   *%rax
+  801f4a:	4c 63 e8             	movslq %eax,%r13
+    if (res < 0)
+  801f4d:	4d 85 ed             	test   %r13,%r13
+  801f50:	78 2c                	js     801f7e <devfile_read+0x100>
+    memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  801f52:	4c 89 ea             	mov    %r13,%rdx
+  801f55:	48 be 00 60 80 00 00 	movabs $0x806000,%rsi
+  801f5c:	00 00 00 
+  801f5f:	4c 89 f7             	mov    %r14,%rdi
+  801f62:	48 b8 4c 0d 80 00 00 	movabs $0x800d4c,%rax
+  801f69:	00 00 00 
+  801f6c:	ff d0                	call   *%rax
+    readsz += res;
+  801f6e:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  801f72:	49 01 c5             	add    %rax,%r13
+    return readsz;
+  801f75:	eb 07                	jmp    801f7e <devfile_read+0x100>
+            return readsz + res;
+  801f77:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  801f7b:	49 01 c5             	add    %rax,%r13
+}
+  801f7e:	4c 89 e8             	mov    %r13,%rax
+  801f81:	48 83 c4 18          	add    $0x18,%rsp
+  801f85:	5b                   	pop    %rbx
+  801f86:	41 5c                	pop    %r12
+  801f88:	41 5d                	pop    %r13
+  801f8a:	41 5e                	pop    %r14
+  801f8c:	41 5f                	pop    %r15
+  801f8e:	5d                   	pop    %rbp
+  801f8f:	c3                   	ret
+    ssize_t readsz = 0;
+  801f90:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  801f97:	00 
+  801f98:	eb 83                	jmp    801f1d <devfile_read+0x9f>
+
+0000000000801f9a <open>:
+open(const char *path, int mode) {
+  801f9a:	55                   	push   %rbp
+  801f9b:	48 89 e5             	mov    %rsp,%rbp
+  801f9e:	41 55                	push   %r13
+  801fa0:	41 54                	push   %r12
+  801fa2:	53                   	push   %rbx
+  801fa3:	48 83 ec 18          	sub    $0x18,%rsp
+  801fa7:	49 89 fc             	mov    %rdi,%r12
+  801faa:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  801fad:	48 b8 ad 0a 80 00 00 	movabs $0x800aad,%rax
+  801fb4:	00 00 00 
+  801fb7:	ff d0                	call   *%rax
+  801fb9:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  801fbf:	0f 87 8a 00 00 00    	ja     80204f <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  801fc5:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  801fc9:	48 b8 7d 15 80 00 00 	movabs $0x80157d,%rax
+  801fd0:	00 00 00 
+  801fd3:	ff d0                	call   *%rax
+  801fd5:	89 c3                	mov    %eax,%ebx
+  801fd7:	85 c0                	test   %eax,%eax
+  801fd9:	78 50                	js     80202b <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  801fdb:	4c 89 e6             	mov    %r12,%rsi
+  801fde:	48 bb 00 60 80 00 00 	movabs $0x806000,%rbx
+  801fe5:	00 00 00 
+  801fe8:	48 89 df             	mov    %rbx,%rdi
+  801feb:	48 b8 eb 0a 80 00 00 	movabs $0x800aeb,%rax
+  801ff2:	00 00 00 
+  801ff5:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  801ff7:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801ffe:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802002:	bf 01 00 00 00       	mov    $0x1,%edi
+  802007:	48 b8 04 1c 80 00 00 	movabs $0x801c04,%rax
+  80200e:	00 00 00 
+  802011:	ff d0                	call   *%rax
+  802013:	89 c3                	mov    %eax,%ebx
+  802015:	85 c0                	test   %eax,%eax
+  802017:	78 1f                	js     802038 <open+0x9e>
+    return fd2num(fd);
+  802019:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80201d:	48 b8 d6 14 80 00 00 	movabs $0x8014d6,%rax
+  802024:	00 00 00 
+  802027:	ff d0                	call   *%rax
+  802029:	89 c3                	mov    %eax,%ebx
+}
+  80202b:	89 d8                	mov    %ebx,%eax
+  80202d:	48 83 c4 18          	add    $0x18,%rsp
+  802031:	5b                   	pop    %rbx
+  802032:	41 5c                	pop    %r12
+  802034:	41 5d                	pop    %r13
+  802036:	5d                   	pop    %rbp
+  802037:	c3                   	ret
+        fd_close(fd, 0);
+  802038:	be 00 00 00 00       	mov    $0x0,%esi
+  80203d:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802041:	48 b8 52 16 80 00 00 	movabs $0x801652,%rax
+  802048:	00 00 00 
+  80204b:	ff d0                	call   *%rax
+        return res;
+  80204d:	eb dc                	jmp    80202b <open+0x91>
+        return -E_BAD_PATH;
+  80204f:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  802054:	eb d5                	jmp    80202b <open+0x91>
+
+0000000000802056 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  802056:	55                   	push   %rbp
+  802057:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc(FSREQ_SYNC, NULL);
+  80205a:	be 00 00 00 00       	mov    $0x0,%esi
+  80205f:	bf 08 00 00 00       	mov    $0x8,%edi
+  802064:	48 b8 04 1c 80 00 00 	movabs $0x801c04,%rax
+  80206b:	00 00 00 
+  80206e:	ff d0                	call   *%rax
+}
+  802070:	5d                   	pop    %rbp
+  802071:	c3                   	ret
+
+0000000000802072 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  802072:	55                   	push   %rbp
+  802073:	48 89 e5             	mov    %rsp,%rbp
+  802076:	41 54                	push   %r12
+  802078:	53                   	push   %rbx
+  802079:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80207c:	48 b8 e8 14 80 00 00 	movabs $0x8014e8,%rax
+  802083:	00 00 00 
+  802086:	ff d0                	call   *%rax
+  802088:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  80208b:	48 be e0 32 80 00 00 	movabs $0x8032e0,%rsi
+  802092:	00 00 00 
+  802095:	48 89 df             	mov    %rbx,%rdi
+  802098:	48 b8 eb 0a 80 00 00 	movabs $0x800aeb,%rax
+  80209f:	00 00 00 
+  8020a2:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  8020a4:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  8020a9:	41 2b 04 24          	sub    (%r12),%eax
+  8020ad:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  8020b3:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8020ba:	00 00 00 
+    stat->st_dev = &devpipe;
+  8020bd:	48 b8 60 40 80 00 00 	movabs $0x804060,%rax
+  8020c4:	00 00 00 
+  8020c7:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  8020ce:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020d3:	5b                   	pop    %rbx
+  8020d4:	41 5c                	pop    %r12
+  8020d6:	5d                   	pop    %rbp
+  8020d7:	c3                   	ret
+
+00000000008020d8 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  8020d8:	55                   	push   %rbp
+  8020d9:	48 89 e5             	mov    %rsp,%rbp
+  8020dc:	41 54                	push   %r12
+  8020de:	53                   	push   %rbx
+  8020df:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8020e2:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8020e7:	48 89 fe             	mov    %rdi,%rsi
+  8020ea:	bf 00 00 00 00       	mov    $0x0,%edi
+  8020ef:	49 bc 67 11 80 00 00 	movabs $0x801167,%r12
+  8020f6:	00 00 00 
+  8020f9:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  8020fc:	48 89 df             	mov    %rbx,%rdi
+  8020ff:	48 b8 e8 14 80 00 00 	movabs $0x8014e8,%rax
+  802106:	00 00 00 
+  802109:	ff d0                	call   *%rax
+  80210b:	48 89 c6             	mov    %rax,%rsi
+  80210e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802113:	bf 00 00 00 00       	mov    $0x0,%edi
+  802118:	41 ff d4             	call   *%r12
+}
+  80211b:	5b                   	pop    %rbx
+  80211c:	41 5c                	pop    %r12
+  80211e:	5d                   	pop    %rbp
+  80211f:	c3                   	ret
+
+0000000000802120 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  802120:	55                   	push   %rbp
+  802121:	48 89 e5             	mov    %rsp,%rbp
+  802124:	41 57                	push   %r15
+  802126:	41 56                	push   %r14
+  802128:	41 55                	push   %r13
+  80212a:	41 54                	push   %r12
+  80212c:	53                   	push   %rbx
+  80212d:	48 83 ec 18          	sub    $0x18,%rsp
+  802131:	49 89 fc             	mov    %rdi,%r12
+  802134:	49 89 f5             	mov    %rsi,%r13
+  802137:	49 89 d7             	mov    %rdx,%r15
+  80213a:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80213e:	48 b8 e8 14 80 00 00 	movabs $0x8014e8,%rax
+  802145:	00 00 00 
+  802148:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  80214a:	4d 85 ff             	test   %r15,%r15
+  80214d:	0f 84 af 00 00 00    	je     802202 <devpipe_write+0xe2>
+  802153:	48 89 c3             	mov    %rax,%rbx
+  802156:	4c 89 f8             	mov    %r15,%rax
+  802159:	4d 89 ef             	mov    %r13,%r15
+  80215c:	4c 01 e8             	add    %r13,%rax
+  80215f:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802163:	49 bd 6f 10 80 00 00 	movabs $0x80106f,%r13
+  80216a:	00 00 00 
+            sys_yield();
+  80216d:	49 be 0c 10 80 00 00 	movabs $0x80100c,%r14
+  802174:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  802177:	8b 73 04             	mov    0x4(%rbx),%esi
+  80217a:	48 63 ce             	movslq %esi,%rcx
+  80217d:	48 63 03             	movslq (%rbx),%rax
+  802180:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  802186:	48 39 c1             	cmp    %rax,%rcx
+  802189:	72 2e                	jb     8021b9 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80218b:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802190:	48 89 da             	mov    %rbx,%rdx
+  802193:	be 00 10 00 00       	mov    $0x1000,%esi
+  802198:	4c 89 e7             	mov    %r12,%rdi
+  80219b:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  80219e:	85 c0                	test   %eax,%eax
+  8021a0:	74 66                	je     802208 <devpipe_write+0xe8>
+            sys_yield();
+  8021a2:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  8021a5:	8b 73 04             	mov    0x4(%rbx),%esi
+  8021a8:	48 63 ce             	movslq %esi,%rcx
+  8021ab:	48 63 03             	movslq (%rbx),%rax
+  8021ae:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  8021b4:	48 39 c1             	cmp    %rax,%rcx
+  8021b7:	73 d2                	jae    80218b <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8021b9:	41 0f b6 3f          	movzbl (%r15),%edi
+  8021bd:	48 89 ca             	mov    %rcx,%rdx
+  8021c0:	48 c1 ea 03          	shr    $0x3,%rdx
+  8021c4:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  8021cb:	08 10 20 
+  8021ce:	48 f7 e2             	mul    %rdx
+  8021d1:	48 c1 ea 06          	shr    $0x6,%rdx
+  8021d5:	48 89 d0             	mov    %rdx,%rax
+  8021d8:	48 c1 e0 09          	shl    $0x9,%rax
+  8021dc:	48 29 d0             	sub    %rdx,%rax
+  8021df:	48 c1 e0 03          	shl    $0x3,%rax
+  8021e3:	48 29 c1             	sub    %rax,%rcx
+  8021e6:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  8021eb:	83 c6 01             	add    $0x1,%esi
+  8021ee:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8021f1:	49 83 c7 01          	add    $0x1,%r15
+  8021f5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8021f9:	49 39 c7             	cmp    %rax,%r15
+  8021fc:	0f 85 75 ff ff ff    	jne    802177 <devpipe_write+0x57>
+    return n;
+  802202:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802206:	eb 05                	jmp    80220d <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  802208:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80220d:	48 83 c4 18          	add    $0x18,%rsp
+  802211:	5b                   	pop    %rbx
+  802212:	41 5c                	pop    %r12
+  802214:	41 5d                	pop    %r13
+  802216:	41 5e                	pop    %r14
+  802218:	41 5f                	pop    %r15
+  80221a:	5d                   	pop    %rbp
+  80221b:	c3                   	ret
+
+000000000080221c <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  80221c:	55                   	push   %rbp
+  80221d:	48 89 e5             	mov    %rsp,%rbp
+  802220:	41 57                	push   %r15
+  802222:	41 56                	push   %r14
+  802224:	41 55                	push   %r13
+  802226:	41 54                	push   %r12
+  802228:	53                   	push   %rbx
+  802229:	48 83 ec 18          	sub    $0x18,%rsp
+  80222d:	49 89 fc             	mov    %rdi,%r12
+  802230:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  802234:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802238:	48 b8 e8 14 80 00 00 	movabs $0x8014e8,%rax
+  80223f:	00 00 00 
+  802242:	ff d0                	call   *%rax
+  802244:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  802247:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80224d:	49 bd 6f 10 80 00 00 	movabs $0x80106f,%r13
+  802254:	00 00 00 
+            sys_yield();
+  802257:	49 be 0c 10 80 00 00 	movabs $0x80100c,%r14
+  80225e:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  802261:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  802266:	74 7d                	je     8022e5 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  802268:	8b 03                	mov    (%rbx),%eax
+  80226a:	3b 43 04             	cmp    0x4(%rbx),%eax
+  80226d:	75 26                	jne    802295 <devpipe_read+0x79>
+            if (i > 0) return i;
+  80226f:	4d 85 ff             	test   %r15,%r15
+  802272:	75 77                	jne    8022eb <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802274:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802279:	48 89 da             	mov    %rbx,%rdx
+  80227c:	be 00 10 00 00       	mov    $0x1000,%esi
+  802281:	4c 89 e7             	mov    %r12,%rdi
+  802284:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  802287:	85 c0                	test   %eax,%eax
+  802289:	74 72                	je     8022fd <devpipe_read+0xe1>
+            sys_yield();
+  80228b:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  80228e:	8b 03                	mov    (%rbx),%eax
+  802290:	3b 43 04             	cmp    0x4(%rbx),%eax
+  802293:	74 df                	je     802274 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802295:	48 63 c8             	movslq %eax,%rcx
+  802298:	48 89 ca             	mov    %rcx,%rdx
+  80229b:	48 c1 ea 03          	shr    $0x3,%rdx
+  80229f:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  8022a6:	08 10 20 
+  8022a9:	48 89 d0             	mov    %rdx,%rax
+  8022ac:	48 f7 e6             	mul    %rsi
+  8022af:	48 c1 ea 06          	shr    $0x6,%rdx
+  8022b3:	48 89 d0             	mov    %rdx,%rax
+  8022b6:	48 c1 e0 09          	shl    $0x9,%rax
+  8022ba:	48 29 d0             	sub    %rdx,%rax
+  8022bd:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  8022c4:	00 
+  8022c5:	48 89 c8             	mov    %rcx,%rax
+  8022c8:	48 29 d0             	sub    %rdx,%rax
+  8022cb:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  8022d0:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8022d4:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  8022d8:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8022db:	49 83 c7 01          	add    $0x1,%r15
+  8022df:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  8022e3:	75 83                	jne    802268 <devpipe_read+0x4c>
+    return n;
+  8022e5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8022e9:	eb 03                	jmp    8022ee <devpipe_read+0xd2>
+            if (i > 0) return i;
+  8022eb:	4c 89 f8             	mov    %r15,%rax
+}
+  8022ee:	48 83 c4 18          	add    $0x18,%rsp
+  8022f2:	5b                   	pop    %rbx
+  8022f3:	41 5c                	pop    %r12
+  8022f5:	41 5d                	pop    %r13
+  8022f7:	41 5e                	pop    %r14
+  8022f9:	41 5f                	pop    %r15
+  8022fb:	5d                   	pop    %rbp
+  8022fc:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  8022fd:	b8 00 00 00 00       	mov    $0x0,%eax
+  802302:	eb ea                	jmp    8022ee <devpipe_read+0xd2>
+
+0000000000802304 <pipe>:
+pipe(int pfd[2]) {
+  802304:	55                   	push   %rbp
+  802305:	48 89 e5             	mov    %rsp,%rbp
+  802308:	41 55                	push   %r13
+  80230a:	41 54                	push   %r12
+  80230c:	53                   	push   %rbx
+  80230d:	48 81 ec b8 00 00 00 	sub    $0xb8,%rsp
+  802314:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  802317:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  80231b:	48 b8 7d 15 80 00 00 	movabs $0x80157d,%rax
+  802322:	00 00 00 
+  802325:	ff d0                	call   *%rax
+  802327:	89 c3                	mov    %eax,%ebx
+  802329:	85 c0                	test   %eax,%eax
+  80232b:	0f 88 51 01 00 00    	js     802482 <pipe+0x17e>
+        (res = fd_alloc_from(fd2num(fd0) + 1, &fd1)) < 0) goto err;
+  802331:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802335:	48 b8 d6 14 80 00 00 	movabs $0x8014d6,%rax
+  80233c:	00 00 00 
+  80233f:	ff d0                	call   *%rax
+  802341:	8d 78 01             	lea    0x1(%rax),%edi
+  802344:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802348:	48 b8 04 15 80 00 00 	movabs $0x801504,%rax
+  80234f:	00 00 00 
+  802352:	ff d0                	call   *%rax
+  802354:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  802356:	85 c0                	test   %eax,%eax
+  802358:	0f 88 24 01 00 00    	js     802482 <pipe+0x17e>
+    va = fd2data(fd0);
+  80235e:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802362:	48 bb e8 14 80 00 00 	movabs $0x8014e8,%rbx
+  802369:	00 00 00 
+  80236c:	ff d3                	call   *%rbx
+  80236e:	49 89 c5             	mov    %rax,%r13
+    struct RegionOp ops[] = {
+  802371:	48 8d bd 30 ff ff ff 	lea    -0xd0(%rbp),%rdi
+  802378:	b9 14 00 00 00       	mov    $0x14,%ecx
+  80237d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802382:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+  802385:	c7 85 34 ff ff ff 46 	movl   $0x46,-0xcc(%rbp)
+  80238c:	00 00 00 
+  80238f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802393:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+  80239a:	48 c7 85 50 ff ff ff 	movq   $0x1000,-0xb0(%rbp)
+  8023a1:	00 10 00 00 
+  8023a5:	c7 85 5c ff ff ff 46 	movl   $0x46,-0xa4(%rbp)
+  8023ac:	00 00 00 
+            {.type = REGION_ALLOC, .dstva = (uintptr_t)fd1, .size = PAGE_SIZE, .perm = PROT_RW | PROT_SHARE},
+  8023af:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+    struct RegionOp ops[] = {
+  8023b3:	48 89 bd 70 ff ff ff 	mov    %rdi,-0x90(%rbp)
+  8023ba:	48 c7 85 78 ff ff ff 	movq   $0x1000,-0x88(%rbp)
+  8023c1:	00 10 00 00 
+  8023c5:	c7 45 84 46 00 00 00 	movl   $0x46,-0x7c(%rbp)
+  8023cc:	4c 89 6d 98          	mov    %r13,-0x68(%rbp)
+  8023d0:	48 c7 45 a0 00 10 00 	movq   $0x1000,-0x60(%rbp)
+  8023d7:	00 
+  8023d8:	c7 45 a8 01 00 00 00 	movl   $0x1,-0x58(%rbp)
+  8023df:	c7 45 ac 46 00 00 00 	movl   $0x46,-0x54(%rbp)
+  8023e6:	4c 89 6d b8          	mov    %r13,-0x48(%rbp)
+            {.type = REGION_MAP, .srcva = (uintptr_t)va, .dstva = (uintptr_t)fd2data(fd1), .size = PAGE_SIZE, .perm = PROT_RW | PROT_SHARE},
+  8023ea:	ff d3                	call   *%rbx
+    struct RegionOp ops[] = {
+  8023ec:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8023f0:	48 c7 45 c8 00 10 00 	movq   $0x1000,-0x38(%rbp)
+  8023f7:	00 
+    if ((res = sys_region_batch(ops, sizeof ops / sizeof *ops)) < 0) goto err1;
+  8023f8:	be 04 00 00 00       	mov    $0x4,%esi
+  8023fd:	48 8d bd 30 ff ff ff 	lea    -0xd0(%rbp),%rdi
+  802404:	48 b8 ce 11 80 00 00 	movabs $0x8011ce,%rax
+  80240b:	00 00 00 
+  80240e:	ff d0                	call   *%rax
+  802410:	89 c3                	mov    %eax,%ebx
+  802412:	85 c0                	test   %eax,%eax
+  802414:	0f 88 ad 00 00 00    	js     8024c7 <pipe+0x1c3>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  80241a:	be 00 10 00 00       	mov    $0x1000,%esi
+  80241f:	4c 89 ef             	mov    %r13,%rdi
+  802422:	48 b8 3d 10 80 00 00 	movabs $0x80103d,%rax
+  802429:	00 00 00 
+  80242c:	ff d0                	call   *%rax
+  80242e:	83 f8 02             	cmp    $0x2,%eax
+  802431:	75 5f                	jne    802492 <pipe+0x18e>
+    fd0->fd_dev_id = devpipe.dev_id;
+  802433:	a1 60 40 80 00 00 00 	movabs 0x804060,%eax
+  80243a:	00 00 
+  80243c:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802440:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  802442:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802446:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  80244d:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  802451:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  802453:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802457:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  80245e:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802462:	48 bb d6 14 80 00 00 	movabs $0x8014d6,%rbx
+  802469:	00 00 00 
+  80246c:	ff d3                	call   *%rbx
+  80246e:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  802472:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  802476:	ff d3                	call   *%rbx
+  802478:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  80247d:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  802482:	89 d8                	mov    %ebx,%eax
+  802484:	48 81 c4 b8 00 00 00 	add    $0xb8,%rsp
+  80248b:	5b                   	pop    %rbx
+  80248c:	41 5c                	pop    %r12
+  80248e:	41 5d                	pop    %r13
+  802490:	5d                   	pop    %rbp
+  802491:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  802492:	48 b9 10 33 80 00 00 	movabs $0x803310,%rcx
+  802499:	00 00 00 
+  80249c:	48 ba e7 32 80 00 00 	movabs $0x8032e7,%rdx
+  8024a3:	00 00 00 
+  8024a6:	be 33 00 00 00       	mov    $0x33,%esi
+  8024ab:	48 bf fc 32 80 00 00 	movabs $0x8032fc,%rdi
+  8024b2:	00 00 00 
+  8024b5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024ba:	49 b8 2c 2a 80 00 00 	movabs $0x802a2c,%r8
+  8024c1:	00 00 00 
+  8024c4:	41 ff d0             	call   *%r8
+        ops[i].type = REGION_UNMAP;
+  8024c7:	c7 85 30 ff ff ff 02 	movl   $0x2,-0xd0(%rbp)
+  8024ce:	00 00 00 
+  8024d1:	c7 85 58 ff ff ff 02 	movl   $0x2,-0xa8(%rbp)
+  8024d8:	00 00 00 
+  8024db:	c7 45 80 02 00 00 00 	movl   $0x2,-0x80(%rbp)
+  8024e2:	c7 45 a8 02 00 00 00 	movl   $0x2,-0x58(%rbp)
+    sys_region_batch(ops, sizeof ops / sizeof *ops);
+  8024e9:	be 04 00 00 00       	mov    $0x4,%esi
+  8024ee:	48 8d bd 30 ff ff ff 	lea    -0xd0(%rbp),%rdi
+  8024f5:	48 b8 ce 11 80 00 00 	movabs $0x8011ce,%rax
+  8024fc:	00 00 00 
+  8024ff:	ff d0                	call   *%rax
+  802501:	e9 7c ff ff ff       	jmp    802482 <pipe+0x17e>
+
+0000000000802506 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  802506:	55                   	push   %rbp
+  802507:	48 89 e5             	mov    %rsp,%rbp
+  80250a:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  80250e:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802512:	48 b8 97 15 80 00 00 	movabs $0x801597,%rax
+  802519:	00 00 00 
+  80251c:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80251e:	85 c0                	test   %eax,%eax
+  802520:	78 35                	js     802557 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  802522:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802526:	48 b8 e8 14 80 00 00 	movabs $0x8014e8,%rax
+  80252d:	00 00 00 
+  802530:	ff d0                	call   *%rax
+  802532:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802535:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80253a:	be 00 10 00 00       	mov    $0x1000,%esi
+  80253f:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802543:	48 b8 6f 10 80 00 00 	movabs $0x80106f,%rax
+  80254a:	00 00 00 
+  80254d:	ff d0                	call   *%rax
+  80254f:	85 c0                	test   %eax,%eax
+  802551:	0f 94 c0             	sete   %al
+  802554:	0f b6 c0             	movzbl %al,%eax
+}
+  802557:	c9                   	leave
+  802558:	c3                   	ret
+
+0000000000802559 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  802559:	48 89 f8             	mov    %rdi,%rax
+  80255c:	48 c1 e8 27          	shr    $0x27,%rax
+  802560:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  802567:	01 00 00 
+  80256a:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80256e:	f6 c2 01             	test   $0x1,%dl
+  802571:	74 6d                	je     8025e0 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  802573:	48 89 f8             	mov    %rdi,%rax
+  802576:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80257a:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802581:	01 00 00 
+  802584:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802588:	f6 c2 01             	test   $0x1,%dl
+  80258b:	74 62                	je     8025ef <get_uvpt_entry+0x96>
+  80258d:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802594:	01 00 00 
+  802597:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80259b:	f6 c2 80             	test   $0x80,%dl
+  80259e:	75 4f                	jne    8025ef <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8025a0:	48 89 f8             	mov    %rdi,%rax
+  8025a3:	48 c1 e8 15          	shr    $0x15,%rax
+  8025a7:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8025ae:	01 00 00 
+  8025b1:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8025b5:	f6 c2 01             	test   $0x1,%dl
+  8025b8:	74 44                	je     8025fe <get_uvpt_entry+0xa5>
+  8025ba:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8025c1:	01 00 00 
+  8025c4:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8025c8:	f6 c2 80             	test   $0x80,%dl
+  8025cb:	75 31                	jne    8025fe <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  8025cd:	48 c1 ef 0c          	shr    $0xc,%rdi
+  8025d1:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8025d8:	01 00 00 
+  8025db:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  8025df:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8025e0:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  8025e7:	01 00 00 
+  8025ea:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8025ee:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8025ef:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8025f6:	01 00 00 
+  8025f9:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8025fd:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8025fe:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802605:	01 00 00 
+  802608:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80260c:	c3                   	ret
+
+000000000080260d <get_prot>:
+
+int
+get_prot(void *va) {
+  80260d:	55                   	push   %rbp
+  80260e:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  802611:	48 b8 59 25 80 00 00 	movabs $0x802559,%rax
+  802618:	00 00 00 
+  80261b:	ff d0                	call   *%rax
+  80261d:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  802620:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  802625:	89 c1                	mov    %eax,%ecx
+  802627:	83 c9 04             	or     $0x4,%ecx
+  80262a:	f6 c2 01             	test   $0x1,%dl
+  80262d:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  802630:	89 c1                	mov    %eax,%ecx
+  802632:	83 c9 02             	or     $0x2,%ecx
+  802635:	f6 c2 02             	test   $0x2,%dl
+  802638:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  80263b:	89 c1                	mov    %eax,%ecx
+  80263d:	83 c9 01             	or     $0x1,%ecx
+  802640:	48 85 d2             	test   %rdx,%rdx
+  802643:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  802646:	89 c1                	mov    %eax,%ecx
+  802648:	83 c9 40             	or     $0x40,%ecx
+  80264b:	f6 c6 04             	test   $0x4,%dh
+  80264e:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  802651:	5d                   	pop    %rbp
+  802652:	c3                   	ret
+
+0000000000802653 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  802653:	55                   	push   %rbp
+  802654:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  802657:	48 b8 59 25 80 00 00 	movabs $0x802559,%rax
+  80265e:	00 00 00 
+  802661:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  802663:	48 c1 e8 06          	shr    $0x6,%rax
+  802667:	83 e0 01             	and    $0x1,%eax
+}
+  80266a:	5d                   	pop    %rbp
+  80266b:	c3                   	ret
+
+000000000080266c <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  80266c:	55                   	push   %rbp
+  80266d:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  802670:	48 b8 59 25 80 00 00 	movabs $0x802559,%rax
+  802677:	00 00 00 
+  80267a:	ff d0                	call   *%rax
+  80267c:	83 e0 01             	and    $0x1,%eax
+}
+  80267f:	5d                   	pop    %rbp
+  802680:	c3                   	ret
+
+0000000000802681 <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  802681:	55                   	push   %rbp
+  802682:	48 89 e5             	mov    %rsp,%rbp
+  802685:	41 57                	push   %r15
+  802687:	41 56                	push   %r14
+  802689:	41 55                	push   %r13
+  80268b:	41 54                	push   %r12
+  80268d:	53                   	push   %rbx
+  80268e:	48 83 ec 38          	sub    $0x38,%rsp
+  802692:	49 89 f7             	mov    %rsi,%r15
+  802695:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+                    }
+                    continue;
+                }
+                for (int ptei = 0; ptei < PT_ENTRY_COUNT; ptei++) {
+                    uintptr_t pte_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, pdei, ptei, 0);
+                    pte_t pte = uvpt[VPT(pte_addr)];
+  80269b:	49 bd 00 00 00 00 00 	movabs $0x10000000000,%r13
+  8026a2:	01 00 00 
+  8026a5:	4d 89 e6             	mov    %r12,%r14
+  8026a8:	49 89 fc             	mov    %rdi,%r12
+  8026ab:	e9 19 01 00 00       	jmp    8027c9 <foreach_shared_region+0x148>
+  8026b0:	48 89 5d b0          	mov    %rbx,-0x50(%rbp)
+  8026b4:	4c 89 75 a8          	mov    %r14,-0x58(%rbp)
+  8026b8:	eb 52                	jmp    80270c <foreach_shared_region+0x8b>
+                for (int ptei = 0; ptei < PT_ENTRY_COUNT; ptei++) {
+  8026ba:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8026c1:	48 81 fb 00 00 20 00 	cmp    $0x200000,%rbx
+  8026c8:	74 2e                	je     8026f8 <foreach_shared_region+0x77>
+                    uintptr_t pte_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, pdei, ptei, 0);
+  8026ca:	48 89 df             	mov    %rbx,%rdi
+  8026cd:	4c 09 f7             	or     %r14,%rdi
+                    pte_t pte = uvpt[VPT(pte_addr)];
+  8026d0:	48 89 f8             	mov    %rdi,%rax
+  8026d3:	48 c1 e8 0c          	shr    $0xc,%rax
+  8026d7:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+                    if ((pte & PTE_P) && (pte & PTE_SHARE)) {
+  8026dc:	25 01 04 00 00       	and    $0x401,%eax
+  8026e1:	48 3d 01 04 00 00    	cmp    $0x401,%rax
+  8026e7:	75 d1                	jne    8026ba <foreach_shared_region+0x39>
+                        fun((void*)pte_addr, (void*)(pte_addr + PAGE_SIZE), arg);
+  8026e9:	48 8d b7 00 10 00 00 	lea    0x1000(%rdi),%rsi
+  8026f0:	4c 89 fa             	mov    %r15,%rdx
+  8026f3:	41 ff d4             	call   *%r12
+  8026f6:	eb c2                	jmp    8026ba <foreach_shared_region+0x39>
+            for (int pdei = 0; pdei < PD_ENTRY_COUNT; pdei++) {
+  8026f8:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  8026ff:	00 
+  802700:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802704:	48 3d 00 00 00 40    	cmp    $0x40000000,%rax
+  80270a:	74 46                	je     802752 <foreach_shared_region+0xd1>
+                uintptr_t pde_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, pdei, 0, 0);
+  80270c:	4c 8b 75 c8          	mov    -0x38(%rbp),%r14
+  802710:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802714:	49 09 c6             	or     %rax,%r14
+                pde_t pde = uvpd[VPD(pde_addr)];
+  802717:	4c 89 f0             	mov    %r14,%rax
+  80271a:	48 c1 e8 15          	shr    $0x15,%rax
+  80271e:	48 b9 00 00 00 80 00 	movabs $0x10080000000,%rcx
+  802725:	01 00 00 
+  802728:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+                if (!(pde & PTE_P)) {
+  80272c:	a8 01                	test   $0x1,%al
+  80272e:	74 c8                	je     8026f8 <foreach_shared_region+0x77>
+                if (pde & PTE_PS) {
+  802730:	48 89 c3             	mov    %rax,%rbx
+  802733:	81 e3 80 00 00 00    	and    $0x80,%ebx
+  802739:	74 8f                	je     8026ca <foreach_shared_region+0x49>
+                    if (pde & PTE_SHARE) {
+  80273b:	f6 c4 04             	test   $0x4,%ah
+  80273e:	74 b8                	je     8026f8 <foreach_shared_region+0x77>
+                        fun((void*)pde_addr, (void*)(pde_addr + 1024 * 1024 * 2), arg);
+  802740:	49 8d b6 00 00 20 00 	lea    0x200000(%r14),%rsi
+  802747:	4c 89 fa             	mov    %r15,%rdx
+  80274a:	4c 89 f7             	mov    %r14,%rdi
+  80274d:	41 ff d4             	call   *%r12
+  802750:	eb a6                	jmp    8026f8 <foreach_shared_region+0x77>
+  802752:	48 8b 5d b0          	mov    -0x50(%rbp),%rbx
+  802756:	4c 8b 75 a8          	mov    -0x58(%rbp),%r14
+        for (int pdpei = 0; pdpei < PDP_ENTRY_COUNT; pdpei++) {
+  80275a:	48 81 c3 00 00 00 40 	add    $0x40000000,%rbx
+  802761:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802768:	00 00 00 
+  80276b:	48 39 c3             	cmp    %rax,%rbx
+  80276e:	74 4c                	je     8027bc <foreach_shared_region+0x13b>
+            uintptr_t pdpe_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, 0, 0, 0);
+  802770:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802774:	48 09 d8             	or     %rbx,%rax
+  802777:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+            pdpe_t pdpe = uvpdp[VPDP(pdpe_addr)];
+  80277b:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80277f:	48 b9 00 00 40 80 00 	movabs $0x10080400000,%rcx
+  802786:	01 00 00 
+  802789:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+            if (!(pdpe & PTE_P)) {
+  80278d:	a8 01                	test   $0x1,%al
+  80278f:	74 c9                	je     80275a <foreach_shared_region+0xd9>
+            if (pdpe & PTE_PS) {
+  802791:	48 89 c1             	mov    %rax,%rcx
+  802794:	81 e1 80 00 00 00    	and    $0x80,%ecx
+  80279a:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  80279e:	0f 84 0c ff ff ff    	je     8026b0 <foreach_shared_region+0x2f>
+                if (pdpe & PTE_SHARE) {
+  8027a4:	f6 c4 04             	test   $0x4,%ah
+  8027a7:	74 b1                	je     80275a <foreach_shared_region+0xd9>
+                    fun((void*)pdpe_addr, (void*)(pdpe_addr + 1024 * 1024 * 1024), arg); 
+  8027a9:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  8027ad:	48 8d b7 00 00 00 40 	lea    0x40000000(%rdi),%rsi
+  8027b4:	4c 89 fa             	mov    %r15,%rdx
+  8027b7:	41 ff d4             	call   *%r12
+  8027ba:	eb 9e                	jmp    80275a <foreach_shared_region+0xd9>
+    for (int pml4ei = 0; pml4ei < PML4_ENTRY_COUNT; pml4ei++) {
+  8027bc:	49 83 c6 01          	add    $0x1,%r14
+  8027c0:	49 81 fe 00 02 00 00 	cmp    $0x200,%r14
+  8027c7:	74 24                	je     8027ed <foreach_shared_region+0x16c>
+        pml4e_t pml4e = uvpml4[VPML4(pml4_addr)];
+  8027c9:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  8027d0:	01 00 00 
+  8027d3:	4a 8b 04 f0          	mov    (%rax,%r14,8),%rax
+        if (!(pml4e & PTE_P)) {
+  8027d7:	a8 01                	test   $0x1,%al
+  8027d9:	74 e1                	je     8027bc <foreach_shared_region+0x13b>
+  8027db:	4c 89 f0             	mov    %r14,%rax
+  8027de:	48 c1 e0 27          	shl    $0x27,%rax
+  8027e2:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8027e6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8027eb:	eb 83                	jmp    802770 <foreach_shared_region+0xef>
+            }
+        }
+    }
+    
+    return 0;
+}
+  8027ed:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027f2:	48 83 c4 38          	add    $0x38,%rsp
+  8027f6:	5b                   	pop    %rbx
+  8027f7:	41 5c                	pop    %r12
+  8027f9:	41 5d                	pop    %r13
+  8027fb:	41 5e                	pop    %r14
+  8027fd:	41 5f                	pop    %r15
+  8027ff:	5d                   	pop    %rbp
+  802800:	c3                   	ret
+
+0000000000802801 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  802801:	b8 00 00 00 00       	mov    $0x0,%eax
+  802806:	c3                   	ret
+
+0000000000802807 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  802807:	55                   	push   %rbp
+  802808:	48 89 e5             	mov    %rsp,%rbp
+  80280b:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  80280e:	48 be 34 33 80 00 00 	movabs $0x803334,%rsi
+  802815:	00 00 00 
+  802818:	48 b8 eb 0a 80 00 00 	movabs $0x800aeb,%rax
+  80281f:	00 00 00 
+  802822:	ff d0                	call   *%rax
+    return 0;
+}
+  802824:	b8 00 00 00 00       	mov    $0x0,%eax
+  802829:	5d                   	pop    %rbp
+  80282a:	c3                   	ret
+
+000000000080282b <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  80282b:	55                   	push   %rbp
+  80282c:	48 89 e5             	mov    %rsp,%rbp
+  80282f:	41 57                	push   %r15
+  802831:	41 56                	push   %r14
+  802833:	41 55                	push   %r13
+  802835:	41 54                	push   %r12
+  802837:	53                   	push   %rbx
+  802838:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  80283f:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  802846:	48 85 d2             	test   %rdx,%rdx
+  802849:	74 7a                	je     8028c5 <devcons_write+0x9a>
+  80284b:	49 89 d6             	mov    %rdx,%r14
+  80284e:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802854:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  802859:	49 bf e5 0c 80 00 00 	movabs $0x800ce5,%r15
+  802860:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  802863:	4c 89 f3             	mov    %r14,%rbx
+  802866:	48 29 f3             	sub    %rsi,%rbx
+  802869:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  80286e:	48 39 c3             	cmp    %rax,%rbx
+  802871:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  802875:	4c 63 eb             	movslq %ebx,%r13
+  802878:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  80287f:	48 01 c6             	add    %rax,%rsi
+  802882:	4c 89 ea             	mov    %r13,%rdx
+  802885:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  80288c:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  80288f:	4c 89 ee             	mov    %r13,%rsi
+  802892:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802899:	48 b8 12 0f 80 00 00 	movabs $0x800f12,%rax
+  8028a0:	00 00 00 
+  8028a3:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  8028a5:	41 01 dc             	add    %ebx,%r12d
+  8028a8:	49 63 f4             	movslq %r12d,%rsi
+  8028ab:	4c 39 f6             	cmp    %r14,%rsi
+  8028ae:	72 b3                	jb     802863 <devcons_write+0x38>
+    return res;
+  8028b0:	49 63 c4             	movslq %r12d,%rax
+}
+  8028b3:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  8028ba:	5b                   	pop    %rbx
+  8028bb:	41 5c                	pop    %r12
+  8028bd:	41 5d                	pop    %r13
+  8028bf:	41 5e                	pop    %r14
+  8028c1:	41 5f                	pop    %r15
+  8028c3:	5d                   	pop    %rbp
+  8028c4:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  8028c5:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8028cb:	eb e3                	jmp    8028b0 <devcons_write+0x85>
+
+00000000008028cd <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8028cd:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  8028d0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8028d5:	48 85 c0             	test   %rax,%rax
+  8028d8:	74 55                	je     80292f <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8028da:	55                   	push   %rbp
+  8028db:	48 89 e5             	mov    %rsp,%rbp
+  8028de:	41 55                	push   %r13
+  8028e0:	41 54                	push   %r12
+  8028e2:	53                   	push   %rbx
+  8028e3:	48 83 ec 08          	sub    $0x8,%rsp
+  8028e7:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  8028ea:	48 bb 3f 0f 80 00 00 	movabs $0x800f3f,%rbx
+  8028f1:	00 00 00 
+  8028f4:	49 bc 0c 10 80 00 00 	movabs $0x80100c,%r12
+  8028fb:	00 00 00 
+  8028fe:	eb 03                	jmp    802903 <devcons_read+0x36>
+  802900:	41 ff d4             	call   *%r12
+  802903:	ff d3                	call   *%rbx
+  802905:	85 c0                	test   %eax,%eax
+  802907:	74 f7                	je     802900 <devcons_read+0x33>
+    if (c < 0) return c;
+  802909:	48 63 d0             	movslq %eax,%rdx
+  80290c:	78 13                	js     802921 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  80290e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802913:	83 f8 04             	cmp    $0x4,%eax
+  802916:	74 09                	je     802921 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  802918:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  80291c:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  802921:	48 89 d0             	mov    %rdx,%rax
+  802924:	48 83 c4 08          	add    $0x8,%rsp
+  802928:	5b                   	pop    %rbx
+  802929:	41 5c                	pop    %r12
+  80292b:	41 5d                	pop    %r13
+  80292d:	5d                   	pop    %rbp
+  80292e:	c3                   	ret
+  80292f:	48 89 d0             	mov    %rdx,%rax
+  802932:	c3                   	ret
+
+0000000000802933 <cputchar>:
+cputchar(int ch) {
+  802933:	55                   	push   %rbp
+  802934:	48 89 e5             	mov    %rsp,%rbp
+  802937:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  80293b:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  80293f:	be 01 00 00 00       	mov    $0x1,%esi
+  802944:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  802948:	48 b8 12 0f 80 00 00 	movabs $0x800f12,%rax
+  80294f:	00 00 00 
+  802952:	ff d0                	call   *%rax
+}
+  802954:	c9                   	leave
+  802955:	c3                   	ret
+
+0000000000802956 <getchar>:
+getchar(void) {
+  802956:	55                   	push   %rbp
+  802957:	48 89 e5             	mov    %rsp,%rbp
+  80295a:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  80295e:	ba 01 00 00 00       	mov    $0x1,%edx
+  802963:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  802967:	bf 00 00 00 00       	mov    $0x0,%edi
+  80296c:	48 b8 7a 18 80 00 00 	movabs $0x80187a,%rax
+  802973:	00 00 00 
+  802976:	ff d0                	call   *%rax
+  802978:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  80297a:	85 c0                	test   %eax,%eax
+  80297c:	78 06                	js     802984 <getchar+0x2e>
+  80297e:	74 08                	je     802988 <getchar+0x32>
+  802980:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  802984:	89 d0                	mov    %edx,%eax
+  802986:	c9                   	leave
+  802987:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  802988:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  80298d:	eb f5                	jmp    802984 <getchar+0x2e>
+
+000000000080298f <iscons>:
+iscons(int fdnum) {
+  80298f:	55                   	push   %rbp
+  802990:	48 89 e5             	mov    %rsp,%rbp
+  802993:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  802997:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80299b:	48 b8 97 15 80 00 00 	movabs $0x801597,%rax
+  8029a2:	00 00 00 
+  8029a5:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8029a7:	85 c0                	test   %eax,%eax
+  8029a9:	78 18                	js     8029c3 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  8029ab:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8029af:	48 b8 a0 40 80 00 00 	movabs $0x8040a0,%rax
+  8029b6:	00 00 00 
+  8029b9:	8b 00                	mov    (%rax),%eax
+  8029bb:	39 02                	cmp    %eax,(%rdx)
+  8029bd:	0f 94 c0             	sete   %al
+  8029c0:	0f b6 c0             	movzbl %al,%eax
+}
+  8029c3:	c9                   	leave
+  8029c4:	c3                   	ret
+
+00000000008029c5 <opencons>:
+opencons(void) {
+  8029c5:	55                   	push   %rbp
+  8029c6:	48 89 e5             	mov    %rsp,%rbp
+  8029c9:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8029cd:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  8029d1:	48 b8 7d 15 80 00 00 	movabs $0x80157d,%rax
+  8029d8:	00 00 00 
+  8029db:	ff d0                	call   *%rax
+  8029dd:	85 c0                	test   %eax,%eax
+  8029df:	78 49                	js     802a2a <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  8029e1:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8029e6:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8029eb:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  8029ef:	bf 00 00 00 00       	mov    $0x0,%edi
+  8029f4:	48 b8 9b 10 80 00 00 	movabs $0x80109b,%rax
+  8029fb:	00 00 00 
+  8029fe:	ff d0                	call   *%rax
+  802a00:	85 c0                	test   %eax,%eax
+  802a02:	78 26                	js     802a2a <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  802a04:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802a08:	a1 a0 40 80 00 00 00 	movabs 0x8040a0,%eax
+  802a0f:	00 00 
+  802a11:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  802a13:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802a17:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  802a1e:	48 b8 d6 14 80 00 00 	movabs $0x8014d6,%rax
+  802a25:	00 00 00 
+  802a28:	ff d0                	call   *%rax
+}
+  802a2a:	c9                   	leave
+  802a2b:	c3                   	ret
+
+0000000000802a2c <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  802a2c:	55                   	push   %rbp
+  802a2d:	48 89 e5             	mov    %rsp,%rbp
+  802a30:	41 56                	push   %r14
+  802a32:	41 55                	push   %r13
+  802a34:	41 54                	push   %r12
+  802a36:	53                   	push   %rbx
+  802a37:	48 83 ec 50          	sub    $0x50,%rsp
+  802a3b:	49 89 fc             	mov    %rdi,%r12
+  802a3e:	41 89 f5             	mov    %esi,%r13d
+  802a41:	48 89 d3             	mov    %rdx,%rbx
+  802a44:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  802a48:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  802a4c:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  802a50:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  802a57:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802a5b:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  802a5f:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  802a63:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  802a67:	48 b8 00 40 80 00 00 	movabs $0x804000,%rax
+  802a6e:	00 00 00 
+  802a71:	4c 8b 30             	mov    (%rax),%r14
+  802a74:	48 b8 db 0f 80 00 00 	movabs $0x800fdb,%rax
+  802a7b:	00 00 00 
+  802a7e:	ff d0                	call   *%rax
+  802a80:	89 c6                	mov    %eax,%esi
+  802a82:	45 89 e8             	mov    %r13d,%r8d
+  802a85:	4c 89 e1             	mov    %r12,%rcx
+  802a88:	4c 89 f2             	mov    %r14,%rdx
+  802a8b:	48 bf 40 33 80 00 00 	movabs $0x803340,%rdi
+  802a92:	00 00 00 
+  802a95:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a9a:	49 bc c6 01 80 00 00 	movabs $0x8001c6,%r12
+  802aa1:	00 00 00 
+  802aa4:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  802aa7:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  802aab:	48 89 df             	mov    %rbx,%rdi
+  802aae:	48 b8 62 01 80 00 00 	movabs $0x800162,%rax
+  802ab5:	00 00 00 
+  802ab8:	ff d0                	call   *%rax
+    cprintf("\n");
+  802aba:	48 bf b4 2c 80 00 00 	movabs $0x802cb4,%rdi
+  802ac1:	00 00 00 
+  802ac4:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ac9:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  802acc:	cc                   	int3
+  802acd:	eb fd                	jmp    802acc <_panic+0xa0>
+
+0000000000802acf <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  802acf:	55                   	push   %rbp
+  802ad0:	48 89 e5             	mov    %rsp,%rbp
+  802ad3:	41 55                	push   %r13
+  802ad5:	41 54                	push   %r12
+  802ad7:	53                   	push   %rbx
+  802ad8:	48 83 ec 08          	sub    $0x8,%rsp
+  802adc:	49 89 fc             	mov    %rdi,%r12
+  802adf:	48 89 f7             	mov    %rsi,%rdi
+  802ae2:	48 89 d3             	mov    %rdx,%rbx
+  802ae5:	49 89 cd             	mov    %rcx,%r13
+    // LAB 9: Your code here:
+    int res = sys_ipc_recv(!pg ? (void*)MAX_USER_ADDRESS : pg, !size ? 0 : *size);
+  802ae8:	be 00 00 00 00       	mov    $0x0,%esi
+  802aed:	48 85 d2             	test   %rdx,%rdx
+  802af0:	74 03                	je     802af5 <ipc_recv+0x26>
+  802af2:	48 8b 32             	mov    (%rdx),%rsi
+  802af5:	48 85 ff             	test   %rdi,%rdi
+  802af8:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802aff:	00 00 00 
+  802b02:	48 0f 44 f8          	cmove  %rax,%rdi
+  802b06:	48 b8 6d 14 80 00 00 	movabs $0x80146d,%rax
+  802b0d:	00 00 00 
+  802b10:	ff d0                	call   *%rax
+    if (res < 0) {
+  802b12:	85 c0                	test   %eax,%eax
+  802b14:	78 66                	js     802b7c <ipc_recv+0xad>
+        if (size) {
+            *size = 0;
+        }
+        return res;
+    }
+    if (from_env_store) {
+  802b16:	4d 85 e4             	test   %r12,%r12
+  802b19:	74 14                	je     802b2f <ipc_recv+0x60>
+        *from_env_store = thisenv->env_ipc_from;
+  802b1b:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802b22:	00 00 00 
+  802b25:	8b 80 ac 01 00 00    	mov    0x1ac(%rax),%eax
+  802b2b:	41 89 04 24          	mov    %eax,(%r12)
+    }
+    if (perm_store) {
+  802b2f:	4d 85 ed             	test   %r13,%r13
+  802b32:	74 14                	je     802b48 <ipc_recv+0x79>
+        *perm_store = thisenv->env_ipc_perm;
+  802b34:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802b3b:	00 00 00 
+  802b3e:	8b 80 b0 01 00 00    	mov    0x1b0(%rax),%eax
+  802b44:	41 89 45 00          	mov    %eax,0x0(%r13)
+    }
+    if (size) {
+  802b48:	48 85 db             	test   %rbx,%rbx
+  802b4b:	74 14                	je     802b61 <ipc_recv+0x92>
+        *size = thisenv->env_ipc_maxsz;
+  802b4d:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802b54:	00 00 00 
+  802b57:	48 8b 80 a0 01 00 00 	mov    0x1a0(%rax),%rax
+  802b5e:	48 89 03             	mov    %rax,(%rbx)
+    }
+    return thisenv->env_ipc_value;
+  802b61:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802b68:	00 00 00 
+  802b6b:	8b 80 a8 01 00 00    	mov    0x1a8(%rax),%eax
+}
+  802b71:	48 83 c4 08          	add    $0x8,%rsp
+  802b75:	5b                   	pop    %rbx
+  802b76:	41 5c                	pop    %r12
+  802b78:	41 5d                	pop    %r13
+  802b7a:	5d                   	pop    %rbp
+  802b7b:	c3                   	ret
+        if (from_env_store) {
+  802b7c:	4d 85 e4             	test   %r12,%r12
+  802b7f:	74 08                	je     802b89 <ipc_recv+0xba>
+            *from_env_store = 0;
+  802b81:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  802b88:	00 
+        if (perm_store) {
+  802b89:	4d 85 ed             	test   %r13,%r13
+  802b8c:	74 08                	je     802b96 <ipc_recv+0xc7>
+            *perm_store = 0;
+  802b8e:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  802b95:	00 
+        if (size) {
+  802b96:	48 85 db             	test   %rbx,%rbx
+  802b99:	74 d6                	je     802b71 <ipc_recv+0xa2>
+            *size = 0;
+  802b9b:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  802ba2:	eb cd                	jmp    802b71 <ipc_recv+0xa2>
+
+0000000000802ba4 <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  802ba4:	55                   	push   %rbp
+  802ba5:	48 89 e5             	mov    %rsp,%rbp
+  802ba8:	41 57                	push   %r15
+  802baa:	41 56                	push   %r14
+  802bac:	41 55                	push   %r13
+  802bae:	41 54                	push   %r12
+  802bb0:	53                   	push   %rbx
+  802bb1:	48 83 ec 18          	sub    $0x18,%rsp
+  802bb5:	41 89 fd             	mov    %edi,%r13d
+  802bb8:	89 75 cc             	mov    %esi,-0x34(%rbp)
+  802bbb:	49 89 cc             	mov    %rcx,%r12
+  802bbe:	44 89 45 c8          	mov    %r8d,-0x38(%rbp)
+    // LAB 9: Your code here:
+    int res = 0;
+    while ((res = sys_ipc_try_send(to_env, val, !pg ? (void*)MAX_USER_ADDRESS : pg, size, perm)) < 0) {
+  802bc2:	48 85 d2             	test   %rdx,%rdx
+  802bc5:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802bcc:	00 00 00 
+  802bcf:	48 0f 45 c2          	cmovne %rdx,%rax
+  802bd3:	48 89 c3             	mov    %rax,%rbx
+  802bd6:	49 be 41 14 80 00 00 	movabs $0x801441,%r14
+  802bdd:	00 00 00 
+        if (res != -E_IPC_NOT_RECV) {
+            panic("sys_ipc_try_send failed: %i", res);
+        }
+        sys_yield();
+  802be0:	49 bf 0c 10 80 00 00 	movabs $0x80100c,%r15
+  802be7:	00 00 00 
+    while ((res = sys_ipc_try_send(to_env, val, !pg ? (void*)MAX_USER_ADDRESS : pg, size, perm)) < 0) {
+  802bea:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  802bed:	44 8b 45 c8          	mov    -0x38(%rbp),%r8d
+  802bf1:	4c 89 e1             	mov    %r12,%rcx
+  802bf4:	48 89 da             	mov    %rbx,%rdx
+  802bf7:	44 89 ef             	mov    %r13d,%edi
+  802bfa:	41 ff d6             	call   *%r14
+  802bfd:	85 c0                	test   %eax,%eax
+  802bff:	79 37                	jns    802c38 <ipc_send+0x94>
+        if (res != -E_IPC_NOT_RECV) {
+  802c01:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  802c04:	75 05                	jne    802c0b <ipc_send+0x67>
+        sys_yield();
+  802c06:	41 ff d7             	call   *%r15
+  802c09:	eb df                	jmp    802bea <ipc_send+0x46>
+            panic("sys_ipc_try_send failed: %i", res);
+  802c0b:	89 c1                	mov    %eax,%ecx
+  802c0d:	48 ba 63 33 80 00 00 	movabs $0x803363,%rdx
+  802c14:	00 00 00 
+  802c17:	be 40 00 00 00       	mov    $0x40,%esi
+  802c1c:	48 bf 7f 33 80 00 00 	movabs $0x80337f,%rdi
+  802c23:	00 00 00 
+  802c26:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c2b:	49 b8 2c 2a 80 00 00 	movabs $0x802a2c,%r8
+  802c32:	00 00 00 
+  802c35:	41 ff d0             	call   *%r8
+    }
+    return;
+}
+  802c38:	48 83 c4 18          	add    $0x18,%rsp
+  802c3c:	5b                   	pop    %rbx
+  802c3d:	41 5c                	pop    %r12
+  802c3f:	41 5d                	pop    %r13
+  802c41:	41 5e                	pop    %r14
+  802c43:	41 5f                	pop    %r15
+  802c45:	5d                   	pop    %rbp
+  802c46:	c3                   	ret
+
+0000000000802c47 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  802c47:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  802c4c:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  802c53:	00 00 00 
+  802c56:	48 69 d0 d0 01 00 00 	imul   $0x1d0,%rax,%rdx
+  802c5d:	48 01 ca             	add    %rcx,%rdx
+  802c60:	8b 92 e8 00 00 00    	mov    0xe8(%rdx),%edx
+  802c66:	39 fa                	cmp    %edi,%edx
+  802c68:	74 12                	je     802c7c <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  802c6a:	48 83 c0 01          	add    $0x1,%rax
+  802c6e:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  802c74:	75 e0                	jne    802c56 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  802c76:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802c7b:	c3                   	ret
+            return envs[i].env_id;
+  802c7c:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+  802c83:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  802c8a:	00 00 00 
+  802c8d:	48 01 d0             	add    %rdx,%rax
+  802c90:	8b 80 e0 00 00 00    	mov    0xe0(%rax),%eax
+  802c96:	c3                   	ret
+  802c97:	90                   	nop
+
+0000000000802c98 <__rodata_start>:
+  802c98:	49 20 72 65          	rex.WB and %sil,0x65(%r10)
+  802c9c:	61                   	(bad)
+  802c9d:	64 20 25 30 38 78 20 	and    %ah,%fs:0x20783830(%rip)        # 20f864d4 <__bss_end+0x2077e4d4>
+  802ca4:	66 72 6f             	data16 jb 802d16 <__rodata_start+0x7e>
+  802ca7:	6d                   	insl   (%dx),%es:(%rdi)
+  802ca8:	20 6c 6f 63          	and    %ch,0x63(%rdi,%rbp,2)
+  802cac:	61                   	(bad)
+  802cad:	74 69                	je     802d18 <__rodata_start+0x80>
+  802caf:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802cb0:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802cb1:	20 30                	and    %dh,(%rax)
+  802cb3:	21 0a                	and    %ecx,(%rdx)
+  802cb5:	00 3c 75 6e 6b 6e 6f 	add    %bh,0x6f6e6b6e(,%rsi,2)
+  802cbc:	77 6e                	ja     802d2c <__rodata_start+0x94>
+  802cbe:	3e 00 30             	ds add %dh,(%rax)
+  802cc1:	31 32                	xor    %esi,(%rdx)
+  802cc3:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  802cca:	41                   	rex.B
+  802ccb:	42                   	rex.X
+  802ccc:	43                   	rex.XB
+  802ccd:	44                   	rex.R
+  802cce:	45                   	rex.RB
+  802ccf:	46 00 30             	rex.RX add %r14b,(%rax)
+  802cd2:	31 32                	xor    %esi,(%rdx)
+  802cd4:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  802cdb:	61                   	(bad)
+  802cdc:	62 63 64 65 66       	(bad)
+  802ce1:	00 28                	add    %ch,(%rax)
+  802ce3:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802ce4:	75 6c                	jne    802d52 <__rodata_start+0xba>
+  802ce6:	6c                   	insb   (%dx),%es:(%rdi)
+  802ce7:	29 00                	sub    %eax,(%rax)
+  802ce9:	65 72 72             	gs jb  802d5e <__rodata_start+0xc6>
+  802cec:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802ced:	72 20                	jb     802d0f <__rodata_start+0x77>
+  802cef:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  802cf4:	73 70                	jae    802d66 <__rodata_start+0xce>
+  802cf6:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  802cfa:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  802d01:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802d02:	72 00                	jb     802d04 <__rodata_start+0x6c>
+  802d04:	62 61 64 20 65       	(bad)
+  802d09:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802d0a:	76 69                	jbe    802d75 <__rodata_start+0xdd>
+  802d0c:	72 6f                	jb     802d7d <__rodata_start+0xe5>
+  802d0e:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802d0f:	6d                   	insl   (%dx),%es:(%rdi)
+  802d10:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  802d12:	74 00                	je     802d14 <__rodata_start+0x7c>
+  802d14:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  802d1b:	20 70 61             	and    %dh,0x61(%rax)
+  802d1e:	72 61                	jb     802d81 <__rodata_start+0xe9>
+  802d20:	6d                   	insl   (%dx),%es:(%rdi)
+  802d21:	65 74 65             	gs je  802d89 <__rodata_start+0xf1>
+  802d24:	72 00                	jb     802d26 <__rodata_start+0x8e>
+  802d26:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802d27:	75 74                	jne    802d9d <__rodata_start+0x105>
+  802d29:	20 6f 66             	and    %ch,0x66(%rdi)
+  802d2c:	20 6d 65             	and    %ch,0x65(%rbp)
+  802d2f:	6d                   	insl   (%dx),%es:(%rdi)
+  802d30:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802d31:	72 79                	jb     802dac <__rodata_start+0x114>
+  802d33:	00 6f 75             	add    %ch,0x75(%rdi)
+  802d36:	74 20                	je     802d58 <__rodata_start+0xc0>
+  802d38:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802d39:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  802d3d:	76 69                	jbe    802da8 <__rodata_start+0x110>
+  802d3f:	72 6f                	jb     802db0 <__rodata_start+0x118>
+  802d41:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802d42:	6d                   	insl   (%dx),%es:(%rdi)
+  802d43:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  802d45:	74 73                	je     802dba <__rodata_start+0x122>
+  802d47:	00 63 6f             	add    %ah,0x6f(%rbx)
+  802d4a:	72 72                	jb     802dbe <__rodata_start+0x126>
+  802d4c:	75 70                	jne    802dbe <__rodata_start+0x126>
+  802d4e:	74 65                	je     802db5 <__rodata_start+0x11d>
+  802d50:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  802d55:	75 67                	jne    802dbe <__rodata_start+0x126>
+  802d57:	20 69 6e             	and    %ch,0x6e(%rcx)
+  802d5a:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  802d5c:	00 73 65             	add    %dh,0x65(%rbx)
+  802d5f:	67 6d                	insl   (%dx),%es:(%edi)
+  802d61:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  802d63:	74 61                	je     802dc6 <__rodata_start+0x12e>
+  802d65:	74 69                	je     802dd0 <__rodata_start+0x138>
+  802d67:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802d68:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802d69:	20 66 61             	and    %ah,0x61(%rsi)
+  802d6c:	75 6c                	jne    802dda <__rodata_start+0x142>
+  802d6e:	74 00                	je     802d70 <__rodata_start+0xd8>
+  802d70:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  802d77:	20 45 4c             	and    %al,0x4c(%rbp)
+  802d7a:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  802d7e:	61                   	(bad)
+  802d7f:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  802d84:	20 73 75             	and    %dh,0x75(%rbx)
+  802d87:	63 68 20             	movsxd 0x20(%rax),%ebp
+  802d8a:	73 79                	jae    802e05 <__rodata_start+0x16d>
+  802d8c:	73 74                	jae    802e02 <__rodata_start+0x16a>
+  802d8e:	65 6d                	gs insl (%dx),%es:(%rdi)
+  802d90:	20 63 61             	and    %ah,0x61(%rbx)
+  802d93:	6c                   	insb   (%dx),%es:(%rdi)
+  802d94:	6c                   	insb   (%dx),%es:(%rdi)
+  802d95:	00 65 6e             	add    %ah,0x6e(%rbp)
+  802d98:	74 72                	je     802e0c <__rodata_start+0x174>
+  802d9a:	79 20                	jns    802dbc <__rodata_start+0x124>
+  802d9c:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802d9d:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802d9e:	74 20                	je     802dc0 <__rodata_start+0x128>
+  802da0:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  802da2:	75 6e                	jne    802e12 <__rodata_start+0x17a>
+  802da4:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  802da8:	76 20                	jbe    802dca <__rodata_start+0x132>
+  802daa:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  802db1:	72 65                	jb     802e18 <__rodata_start+0x180>
+  802db3:	63 76 69             	movsxd 0x69(%rsi),%esi
+  802db6:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802db7:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  802dbb:	65 78 70             	gs js  802e2e <__rodata_start+0x196>
+  802dbe:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  802dc3:	20 65 6e             	and    %ah,0x6e(%rbp)
+  802dc6:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  802dca:	20 66 69             	and    %ah,0x69(%rsi)
+  802dcd:	6c                   	insb   (%dx),%es:(%rdi)
+  802dce:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  802dd2:	20 66 72             	and    %ah,0x72(%rsi)
+  802dd5:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  802dda:	61                   	(bad)
+  802ddb:	63 65 20             	movsxd 0x20(%rbp),%esp
+  802dde:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802ddf:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802de0:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  802de4:	6b 00 74             	imul   $0x74,(%rax),%eax
+  802de7:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802de8:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802de9:	20 6d 61             	and    %ch,0x61(%rbp)
+  802dec:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802ded:	79 20                	jns    802e0f <__rodata_start+0x177>
+  802def:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  802df6:	72 65                	jb     802e5d <__rodata_start+0x1c5>
+  802df8:	20 6f 70             	and    %ch,0x70(%rdi)
+  802dfb:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  802dfd:	00 66 69             	add    %ah,0x69(%rsi)
+  802e00:	6c                   	insb   (%dx),%es:(%rdi)
+  802e01:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  802e05:	20 62 6c             	and    %ah,0x6c(%rdx)
+  802e08:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802e09:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  802e0c:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802e0d:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802e0e:	74 20                	je     802e30 <__rodata_start+0x198>
+  802e10:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  802e12:	75 6e                	jne    802e82 <__rodata_start+0x1ea>
+  802e14:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  802e18:	76 61                	jbe    802e7b <__rodata_start+0x1e3>
+  802e1a:	6c                   	insb   (%dx),%es:(%rdi)
+  802e1b:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  802e22:	00 
+  802e23:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  802e2a:	72 65                	jb     802e91 <__rodata_start+0x1f9>
+  802e2c:	61                   	(bad)
+  802e2d:	64 79 20             	fs jns 802e50 <__rodata_start+0x1b8>
+  802e30:	65 78 69             	gs js  802e9c <__rodata_start+0x204>
+  802e33:	73 74                	jae    802ea9 <__rodata_start+0x211>
+  802e35:	73 00                	jae    802e37 <__rodata_start+0x19f>
+  802e37:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802e38:	70 65                	jo     802e9f <__rodata_start+0x207>
+  802e3a:	72 61                	jb     802e9d <__rodata_start+0x205>
+  802e3c:	74 69                	je     802ea7 <__rodata_start+0x20f>
+  802e3e:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802e3f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802e40:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  802e43:	74 20                	je     802e65 <__rodata_start+0x1cd>
+  802e45:	73 75                	jae    802ebc <__rodata_start+0x224>
+  802e47:	70 70                	jo     802eb9 <__rodata_start+0x221>
+  802e49:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802e4a:	72 74                	jb     802ec0 <__rodata_start+0x228>
+  802e4c:	65 64 00 6f 70       	gs add %ch,%fs:0x70(%rdi)
+  802e51:	65 72 61             	gs jb  802eb5 <__rodata_start+0x21d>
+  802e54:	74 69                	je     802ebf <__rodata_start+0x227>
+  802e56:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802e57:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802e58:	20 69 6e             	and    %ch,0x6e(%rcx)
+  802e5b:	74 65                	je     802ec2 <__rodata_start+0x22a>
+  802e5d:	72 72                	jb     802ed1 <__rodata_start+0x239>
+  802e5f:	75 70                	jne    802ed1 <__rodata_start+0x239>
+  802e61:	74 65                	je     802ec8 <__rodata_start+0x230>
+  802e63:	64 00 6e 6f          	add    %ch,%fs:0x6f(%rsi)
+  802e67:	74 20                	je     802e89 <__rodata_start+0x1f1>
+  802e69:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  802e6b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802e6c:	75 67                	jne    802ed5 <__rodata_start+0x23d>
+  802e6e:	68 20 43 50 55       	push   $0x55504320
+  802e73:	20 74 69 6d          	and    %dh,0x6d(%rcx,%rbp,2)
+  802e77:	65 00 0f             	add    %cl,%gs:(%rdi)
+  802e7a:	1f                   	(bad)
+  802e7b:	80 00 00             	addb   $0x0,(%rax)
+  802e7e:	00 00                	add    %al,(%rax)
+  802e80:	b3 03                	mov    $0x3,%bl
+  802e82:	80 00 00             	addb   $0x0,(%rax)
+  802e85:	00 00                	add    %al,(%rax)
+  802e87:	00 f4                	add    %dh,%ah
+  802e89:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802e8f:	00 e4                	add    %ah,%ah
+  802e91:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802e97:	00 f4                	add    %dh,%ah
+  802e99:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802e9f:	00 f4                	add    %dh,%ah
+  802ea1:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802ea7:	00 f4                	add    %dh,%ah
+  802ea9:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802eaf:	00 f4                	add    %dh,%ah
+  802eb1:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802eb7:	00 d2                	add    %dl,%dl
+  802eb9:	03 80 00 00 00 00    	add    0x0(%rax),%eax
+  802ebf:	00 f4                	add    %dh,%ah
+  802ec1:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802ec7:	00 f4                	add    %dh,%ah
+  802ec9:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802ecf:	00 c6                	add    %al,%dh
+  802ed1:	03 80 00 00 00 00    	add    0x0(%rax),%eax
+  802ed7:	00 40 04             	add    %al,0x4(%rax)
+  802eda:	80 00 00             	addb   $0x0,(%rax)
+  802edd:	00 00                	add    %al,(%rax)
+  802edf:	00 f4                	add    %dh,%ah
+  802ee1:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802ee7:	00 c6                	add    %al,%dh
+  802ee9:	03 80 00 00 00 00    	add    0x0(%rax),%eax
+  802eef:	00 0c 04             	add    %cl,(%rsp,%rax,1)
+  802ef2:	80 00 00             	addb   $0x0,(%rax)
+  802ef5:	00 00                	add    %al,(%rax)
+  802ef7:	00 0c 04             	add    %cl,(%rsp,%rax,1)
+  802efa:	80 00 00             	addb   $0x0,(%rax)
+  802efd:	00 00                	add    %al,(%rax)
+  802eff:	00 0c 04             	add    %cl,(%rsp,%rax,1)
+  802f02:	80 00 00             	addb   $0x0,(%rax)
+  802f05:	00 00                	add    %al,(%rax)
+  802f07:	00 0c 04             	add    %cl,(%rsp,%rax,1)
+  802f0a:	80 00 00             	addb   $0x0,(%rax)
+  802f0d:	00 00                	add    %al,(%rax)
+  802f0f:	00 0c 04             	add    %cl,(%rsp,%rax,1)
+  802f12:	80 00 00             	addb   $0x0,(%rax)
+  802f15:	00 00                	add    %al,(%rax)
+  802f17:	00 0c 04             	add    %cl,(%rsp,%rax,1)
+  802f1a:	80 00 00             	addb   $0x0,(%rax)
+  802f1d:	00 00                	add    %al,(%rax)
+  802f1f:	00 0c 04             	add    %cl,(%rsp,%rax,1)
+  802f22:	80 00 00             	addb   $0x0,(%rax)
+  802f25:	00 00                	add    %al,(%rax)
+  802f27:	00 0c 04             	add    %cl,(%rsp,%rax,1)
+  802f2a:	80 00 00             	addb   $0x0,(%rax)
+  802f2d:	00 00                	add    %al,(%rax)
+  802f2f:	00 0c 04             	add    %cl,(%rsp,%rax,1)
+  802f32:	80 00 00             	addb   $0x0,(%rax)
+  802f35:	00 00                	add    %al,(%rax)
+  802f37:	00 f4                	add    %dh,%ah
+  802f39:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802f3f:	00 f4                	add    %dh,%ah
+  802f41:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802f47:	00 f4                	add    %dh,%ah
+  802f49:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802f4f:	00 f4                	add    %dh,%ah
+  802f51:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802f57:	00 f4                	add    %dh,%ah
+  802f59:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802f5f:	00 f4                	add    %dh,%ah
+  802f61:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802f67:	00 f4                	add    %dh,%ah
+  802f69:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802f6f:	00 f4                	add    %dh,%ah
+  802f71:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802f77:	00 f4                	add    %dh,%ah
+  802f79:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802f7f:	00 f4                	add    %dh,%ah
+  802f81:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802f87:	00 f4                	add    %dh,%ah
+  802f89:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802f8f:	00 f4                	add    %dh,%ah
+  802f91:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802f97:	00 f4                	add    %dh,%ah
+  802f99:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802f9f:	00 f4                	add    %dh,%ah
+  802fa1:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802fa7:	00 f4                	add    %dh,%ah
+  802fa9:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802faf:	00 f4                	add    %dh,%ah
+  802fb1:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802fb7:	00 f4                	add    %dh,%ah
+  802fb9:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802fbf:	00 f4                	add    %dh,%ah
+  802fc1:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802fc7:	00 f4                	add    %dh,%ah
+  802fc9:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802fcf:	00 f4                	add    %dh,%ah
+  802fd1:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802fd7:	00 f4                	add    %dh,%ah
+  802fd9:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802fdf:	00 f4                	add    %dh,%ah
+  802fe1:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802fe7:	00 f4                	add    %dh,%ah
+  802fe9:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802fef:	00 f4                	add    %dh,%ah
+  802ff1:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802ff7:	00 f4                	add    %dh,%ah
+  802ff9:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802fff:	00 f4                	add    %dh,%ah
+  803001:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803007:	00 f4                	add    %dh,%ah
+  803009:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  80300f:	00 f4                	add    %dh,%ah
+  803011:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803017:	00 f4                	add    %dh,%ah
+  803019:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  80301f:	00 f4                	add    %dh,%ah
+  803021:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803027:	00 17                	add    %dl,(%rdi)
+  803029:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  80302f:	00 f4                	add    %dh,%ah
+  803031:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803037:	00 f4                	add    %dh,%ah
+  803039:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  80303f:	00 f4                	add    %dh,%ah
+  803041:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803047:	00 f4                	add    %dh,%ah
+  803049:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  80304f:	00 f4                	add    %dh,%ah
+  803051:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803057:	00 f4                	add    %dh,%ah
+  803059:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  80305f:	00 f4                	add    %dh,%ah
+  803061:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803067:	00 f4                	add    %dh,%ah
+  803069:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  80306f:	00 f4                	add    %dh,%ah
+  803071:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803077:	00 f4                	add    %dh,%ah
+  803079:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  80307f:	00 63 04             	add    %ah,0x4(%rbx)
+  803082:	80 00 00             	addb   $0x0,(%rax)
+  803085:	00 00                	add    %al,(%rax)
+  803087:	00 32                	add    %dh,(%rdx)
+  803089:	06                   	(bad)
+  80308a:	80 00 00             	addb   $0x0,(%rax)
+  80308d:	00 00                	add    %al,(%rax)
+  80308f:	00 f4                	add    %dh,%ah
+  803091:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803097:	00 f4                	add    %dh,%ah
+  803099:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  80309f:	00 f4                	add    %dh,%ah
+  8030a1:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  8030a7:	00 f4                	add    %dh,%ah
+  8030a9:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  8030af:	00 92 04 80 00 00    	add    %dl,0x8004(%rdx)
+  8030b5:	00 00                	add    %al,(%rax)
+  8030b7:	00 f4                	add    %dh,%ah
+  8030b9:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  8030bf:	00 f4                	add    %dh,%ah
+  8030c1:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  8030c7:	00 58 04             	add    %bl,0x4(%rax)
+  8030ca:	80 00 00             	addb   $0x0,(%rax)
+  8030cd:	00 00                	add    %al,(%rax)
+  8030cf:	00 f4                	add    %dh,%ah
+  8030d1:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  8030d7:	00 f4                	add    %dh,%ah
+  8030d9:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  8030df:	00 da                	add    %bl,%dl
+  8030e1:	07                   	(bad)
+  8030e2:	80 00 00             	addb   $0x0,(%rax)
+  8030e5:	00 00                	add    %al,(%rax)
+  8030e7:	00 a4 08 80 00 00 00 	add    %ah,0x80(%rax,%rcx,1)
+  8030ee:	00 00                	add    %al,(%rax)
+  8030f0:	f4                   	hlt
+  8030f1:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  8030f7:	00 f4                	add    %dh,%ah
+  8030f9:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  8030ff:	00 29                	add    %ch,(%rcx)
+  803101:	05 80 00 00 00       	add    $0x80,%eax
+  803106:	00 00                	add    %al,(%rax)
+  803108:	f4                   	hlt
+  803109:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  80310f:	00 06                	add    %al,(%rsi)
+  803111:	07                   	(bad)
+  803112:	80 00 00             	addb   $0x0,(%rax)
+  803115:	00 00                	add    %al,(%rax)
+  803117:	00 f4                	add    %dh,%ah
+  803119:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  80311f:	00 f4                	add    %dh,%ah
+  803121:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803127:	00 17                	add    %dl,(%rdi)
+  803129:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  80312f:	00 f4                	add    %dh,%ah
+  803131:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803137:	00 bc 03 80 00 00 00 	add    %bh,0x80(%rbx,%rax,1)
+	...
+
+0000000000803140 <error_string>:
+	...
+  803148:	f2 2c 80 00 00 00 00 00 04 2d 80 00 00 00 00 00     .,.......-......
+  803158:	14 2d 80 00 00 00 00 00 26 2d 80 00 00 00 00 00     .-......&-......
+  803168:	34 2d 80 00 00 00 00 00 48 2d 80 00 00 00 00 00     4-......H-......
+  803178:	5d 2d 80 00 00 00 00 00 70 2d 80 00 00 00 00 00     ]-......p-......
+  803188:	82 2d 80 00 00 00 00 00 96 2d 80 00 00 00 00 00     .-.......-......
+  803198:	a6 2d 80 00 00 00 00 00 b9 2d 80 00 00 00 00 00     .-.......-......
+  8031a8:	d0 2d 80 00 00 00 00 00 e6 2d 80 00 00 00 00 00     .-.......-......
+  8031b8:	fe 2d 80 00 00 00 00 00 16 2e 80 00 00 00 00 00     .-..............
+  8031c8:	23 2e 80 00 00 00 00 00 f0 31 80 00 00 00 00 00     #........1......
+  8031d8:	37 2e 80 00 00 00 00 00 4f 2e 80 00 00 00 00 00     7.......O.......
+  8031e8:	65 2e 80 00 00 00 00 00 66 69 6c 65 20 69 73 20     e.......file is 
+  8031f8:	6e 6f 74 20 61 20 76 61 6c 69 64 20 65 78 65 63     not a valid exec
+  803208:	75 74 61 62 6c 65 00 90 73 79 73 63 61 6c 6c 20     utable..syscall 
+  803218:	25 7a 64 20 72 65 74 75 72 6e 65 64 20 25 7a 64     %zd returned %zd
+  803228:	20 28 3e 20 30 29 00 6c 69 62 2f 73 79 73 63 61      (> 0).lib/sysca
+  803238:	6c 6c 2e 63 00 0f 1f 00 5b 25 30 38 78 5d 20 75     ll.c....[%08x] u
+  803248:	6e 6b 6e 6f 77 6e 20 64 65 76 69 63 65 20 74 79     nknown device ty
+  803258:	70 65 20 25 64 0a 00 00 5b 25 30 38 78 5d 20 66     pe %d...[%08x] f
+  803268:	74 72 75 6e 63 61 74 65 20 25 64 20 2d 2d 20 62     truncate %d -- b
+  803278:	61 64 20 6d 6f 64 65 0a 00 5b 25 30 38 78 5d 20     ad mode..[%08x] 
+  803288:	72 65 61 64 20 25 64 20 2d 2d 20 62 61 64 20 6d     read %d -- bad m
+  803298:	6f 64 65 0a 00 5b 25 30 38 78 5d 20 77 72 69 74     ode..[%08x] writ
+  8032a8:	65 20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65     e %d -- bad mode
+  8032b8:	0a 00 66 0f 1f 44 00 00                             ..f..D..
+
+00000000008032c0 <devtab>:
+  8032c0:	20 40 80 00 00 00 00 00 60 40 80 00 00 00 00 00      @......`@......
+  8032d0:	a0 40 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .@..............
+  8032e0:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  8032f0:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  803300:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  803310:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  803320:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  803330:	3d 20 32 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73 00     = 2.<cons>.cons.
+  803340:	5b 25 30 38 78 5d 20 75 73 65 72 20 70 61 6e 69     [%08x] user pani
+  803350:	63 20 69 6e 20 25 73 20 61 74 20 25 73 3a 25 64     c in %s at %s:%d
+  803360:	3a 20 00 73 79 73 5f 69 70 63 5f 74 72 79 5f 73     : .sys_ipc_try_s
+  803370:	65 6e 64 20 66 61 69 6c 65 64 3a 20 25 69 00 6c     end failed: %i.l
+  803380:	69 62 2f 69 70 63 2e 63 00 66 2e 0f 1f 84 00 00     ib/ipc.c.f......
+  803390:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8033a0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8033b0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8033c0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8033d0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8033e0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8033f0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803400:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803410:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803420:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803430:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803440:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803450:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803460:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803470:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803480:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803490:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8034a0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8034b0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8034c0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8034d0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8034e0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8034f0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803500:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803510:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803520:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803530:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803540:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803550:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803560:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803570:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803580:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803590:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8035a0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8035b0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8035c0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8035d0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8035e0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8035f0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803600:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803610:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803620:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803630:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803640:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803650:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803660:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803670:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803680:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803690:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8036a0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8036b0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8036c0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8036d0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8036e0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8036f0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803700:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803710:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803720:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803730:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803740:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803750:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803760:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803770:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803780:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803790:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8037a0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8037b0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8037c0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8037d0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8037e0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8037f0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803800:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803810:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803820:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803830:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803840:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803850:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803860:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803870:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803880:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803890:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8038a0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8038b0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8038c0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8038d0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8038e0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8038f0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803900:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803910:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803920:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803930:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803940:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803950:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803960:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803970:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803980:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803990:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8039a0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8039b0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8039c0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8039d0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8039e0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8039f0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803a00:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803a10:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803a20:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803a30:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803a40:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803a50:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803a60:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803a70:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803a80:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803a90:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803aa0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803ab0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803ac0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803ad0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803ae0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803af0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803b00:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803b10:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803b20:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803b30:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803b40:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803b50:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803b60:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803b70:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803b80:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803b90:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803ba0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803bb0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803bc0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803bd0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803be0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803bf0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803c00:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803c10:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803c20:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803c30:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803c40:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803c50:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803c60:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803c70:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803c80:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803c90:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803ca0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803cb0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803cc0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803cd0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803ce0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803cf0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803d00:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803d10:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803d20:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803d30:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803d40:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803d50:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803d60:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803d70:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803d80:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803d90:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803da0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803db0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803dc0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803dd0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803de0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803df0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803e00:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803e10:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803e20:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803e30:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803e40:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803e50:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803e60:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803e70:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803e80:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803e90:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803ea0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803eb0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803ec0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803ed0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803ee0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803ef0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803f00:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803f10:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803f20:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803f30:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803f40:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803f50:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803f60:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803f70:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803f80:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803f90:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803fa0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803fb0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803fc0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803fd0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803fe0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803ff0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 90     .....f..........
@@ -0,0 +1,5728 @@
+
+obj/user/faultreadkernel:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 2f 00 00 00       	call   800052 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+/* Buggy program - faults with a read from kernel space */
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+    cprintf("I read %08x from location 0x8040000000!\n", *(unsigned *)0x8040000000);
+  800029:	48 b8 00 00 00 40 80 	movabs $0x8040000000,%rax
+  800030:	00 00 00 
+  800033:	8b 30                	mov    (%rax),%esi
+  800035:	48 bf a0 2c 80 00 00 	movabs $0x802ca0,%rdi
+  80003c:	00 00 00 
+  80003f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800044:	48 ba cb 01 80 00 00 	movabs $0x8001cb,%rdx
+  80004b:	00 00 00 
+  80004e:	ff d2                	call   *%rdx
+}
+  800050:	5d                   	pop    %rbp
+  800051:	c3                   	ret
+
+0000000000800052 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800052:	55                   	push   %rbp
+  800053:	48 89 e5             	mov    %rsp,%rbp
+  800056:	41 56                	push   %r14
+  800058:	41 55                	push   %r13
+  80005a:	41 54                	push   %r12
+  80005c:	53                   	push   %rbx
+  80005d:	41 89 fd             	mov    %edi,%r13d
+  800060:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800063:	48 ba d8 40 80 00 00 	movabs $0x8040d8,%rdx
+  80006a:	00 00 00 
+  80006d:	48 b8 d8 40 80 00 00 	movabs $0x8040d8,%rax
+  800074:	00 00 00 
+  800077:	48 39 c2             	cmp    %rax,%rdx
+  80007a:	73 17                	jae    800093 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  80007c:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  80007f:	49 89 c4             	mov    %rax,%r12
+  800082:	48 83 c3 08          	add    $0x8,%rbx
+  800086:	b8 00 00 00 00       	mov    $0x0,%eax
+  80008b:	ff 53 f8             	call   *-0x8(%rbx)
+  80008e:	4c 39 e3             	cmp    %r12,%rbx
+  800091:	72 ef                	jb     800082 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+    envid_t this_env_id = sys_getenvid();
+  800093:	48 b8 e0 0f 80 00 00 	movabs $0x800fe0,%rax
+  80009a:	00 00 00 
+  80009d:	ff d0                	call   *%rax
+    thisenv = &((struct Env*)UENVS)[ENVX(this_env_id)];
+  80009f:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8000a4:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+  8000ab:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8000b2:	00 00 00 
+  8000b5:	48 01 d0             	add    %rdx,%rax
+  8000b8:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  8000bf:	00 00 00 
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8000c2:	45 85 ed             	test   %r13d,%r13d
+  8000c5:	7e 0d                	jle    8000d4 <libmain+0x82>
+  8000c7:	49 8b 06             	mov    (%r14),%rax
+  8000ca:	48 a3 00 40 80 00 00 	movabs %rax,0x804000
+  8000d1:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8000d4:	4c 89 f6             	mov    %r14,%rsi
+  8000d7:	44 89 ef             	mov    %r13d,%edi
+  8000da:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8000e1:	00 00 00 
+  8000e4:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8000e6:	48 b8 fb 00 80 00 00 	movabs $0x8000fb,%rax
+  8000ed:	00 00 00 
+  8000f0:	ff d0                	call   *%rax
+#endif
+}
+  8000f2:	5b                   	pop    %rbx
+  8000f3:	41 5c                	pop    %r12
+  8000f5:	41 5d                	pop    %r13
+  8000f7:	41 5e                	pop    %r14
+  8000f9:	5d                   	pop    %rbp
+  8000fa:	c3                   	ret
+
+00000000008000fb <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8000fb:	55                   	push   %rbp
+  8000fc:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  8000ff:	48 b8 34 17 80 00 00 	movabs $0x801734,%rax
+  800106:	00 00 00 
+  800109:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  80010b:	bf 00 00 00 00       	mov    $0x0,%edi
+  800110:	48 b8 75 0f 80 00 00 	movabs $0x800f75,%rax
+  800117:	00 00 00 
+  80011a:	ff d0                	call   *%rax
+}
+  80011c:	5d                   	pop    %rbp
+  80011d:	c3                   	ret
+
+000000000080011e <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  80011e:	55                   	push   %rbp
+  80011f:	48 89 e5             	mov    %rsp,%rbp
+  800122:	53                   	push   %rbx
+  800123:	48 83 ec 08          	sub    $0x8,%rsp
+  800127:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  80012a:	8b 06                	mov    (%rsi),%eax
+  80012c:	8d 50 01             	lea    0x1(%rax),%edx
+  80012f:	89 16                	mov    %edx,(%rsi)
+  800131:	48 98                	cltq
+  800133:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  800138:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  80013e:	74 0a                	je     80014a <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  800140:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  800144:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800148:	c9                   	leave
+  800149:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  80014a:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  80014e:	be ff 00 00 00       	mov    $0xff,%esi
+  800153:	48 b8 17 0f 80 00 00 	movabs $0x800f17,%rax
+  80015a:	00 00 00 
+  80015d:	ff d0                	call   *%rax
+        state->offset = 0;
+  80015f:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  800165:	eb d9                	jmp    800140 <putch+0x22>
+
+0000000000800167 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  800167:	55                   	push   %rbp
+  800168:	48 89 e5             	mov    %rsp,%rbp
+  80016b:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  800172:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  800175:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  80017c:	b9 21 00 00 00       	mov    $0x21,%ecx
+  800181:	b8 00 00 00 00       	mov    $0x0,%eax
+  800186:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  800189:	48 89 f1             	mov    %rsi,%rcx
+  80018c:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  800193:	48 bf 1e 01 80 00 00 	movabs $0x80011e,%rdi
+  80019a:	00 00 00 
+  80019d:	48 b8 1b 03 80 00 00 	movabs $0x80031b,%rax
+  8001a4:	00 00 00 
+  8001a7:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  8001a9:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  8001b0:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  8001b7:	48 b8 17 0f 80 00 00 	movabs $0x800f17,%rax
+  8001be:	00 00 00 
+  8001c1:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  8001c3:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  8001c9:	c9                   	leave
+  8001ca:	c3                   	ret
+
+00000000008001cb <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  8001cb:	55                   	push   %rbp
+  8001cc:	48 89 e5             	mov    %rsp,%rbp
+  8001cf:	48 83 ec 50          	sub    $0x50,%rsp
+  8001d3:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8001d7:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8001db:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8001df:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8001e3:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  8001e7:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  8001ee:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8001f2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8001f6:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8001fa:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  8001fe:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  800202:	48 b8 67 01 80 00 00 	movabs $0x800167,%rax
+  800209:	00 00 00 
+  80020c:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  80020e:	c9                   	leave
+  80020f:	c3                   	ret
+
+0000000000800210 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  800210:	55                   	push   %rbp
+  800211:	48 89 e5             	mov    %rsp,%rbp
+  800214:	41 57                	push   %r15
+  800216:	41 56                	push   %r14
+  800218:	41 55                	push   %r13
+  80021a:	41 54                	push   %r12
+  80021c:	53                   	push   %rbx
+  80021d:	48 83 ec 18          	sub    $0x18,%rsp
+  800221:	49 89 fc             	mov    %rdi,%r12
+  800224:	49 89 f5             	mov    %rsi,%r13
+  800227:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  80022b:	8b 45 10             	mov    0x10(%rbp),%eax
+  80022e:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  800231:	41 89 cf             	mov    %ecx,%r15d
+  800234:	4c 39 fa             	cmp    %r15,%rdx
+  800237:	73 5b                	jae    800294 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  800239:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  80023d:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  800241:	85 db                	test   %ebx,%ebx
+  800243:	7e 0e                	jle    800253 <print_num+0x43>
+            putch(padc, put_arg);
+  800245:	4c 89 ee             	mov    %r13,%rsi
+  800248:	44 89 f7             	mov    %r14d,%edi
+  80024b:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  80024e:	83 eb 01             	sub    $0x1,%ebx
+  800251:	75 f2                	jne    800245 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  800253:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  800257:	48 b9 e4 2c 80 00 00 	movabs $0x802ce4,%rcx
+  80025e:	00 00 00 
+  800261:	48 b8 d3 2c 80 00 00 	movabs $0x802cd3,%rax
+  800268:	00 00 00 
+  80026b:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  80026f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800273:	ba 00 00 00 00       	mov    $0x0,%edx
+  800278:	49 f7 f7             	div    %r15
+  80027b:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  80027f:	4c 89 ee             	mov    %r13,%rsi
+  800282:	41 ff d4             	call   *%r12
+}
+  800285:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800289:	5b                   	pop    %rbx
+  80028a:	41 5c                	pop    %r12
+  80028c:	41 5d                	pop    %r13
+  80028e:	41 5e                	pop    %r14
+  800290:	41 5f                	pop    %r15
+  800292:	5d                   	pop    %rbp
+  800293:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  800294:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800298:	ba 00 00 00 00       	mov    $0x0,%edx
+  80029d:	49 f7 f7             	div    %r15
+  8002a0:	48 83 ec 08          	sub    $0x8,%rsp
+  8002a4:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  8002a8:	52                   	push   %rdx
+  8002a9:	45 0f be c9          	movsbl %r9b,%r9d
+  8002ad:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  8002b1:	48 89 c2             	mov    %rax,%rdx
+  8002b4:	48 b8 10 02 80 00 00 	movabs $0x800210,%rax
+  8002bb:	00 00 00 
+  8002be:	ff d0                	call   *%rax
+  8002c0:	48 83 c4 10          	add    $0x10,%rsp
+  8002c4:	eb 8d                	jmp    800253 <print_num+0x43>
+
+00000000008002c6 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  8002c6:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  8002ca:	48 8b 06             	mov    (%rsi),%rax
+  8002cd:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  8002d1:	73 0a                	jae    8002dd <sprintputch+0x17>
+        *state->start++ = ch;
+  8002d3:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8002d7:	48 89 16             	mov    %rdx,(%rsi)
+  8002da:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  8002dd:	c3                   	ret
+
+00000000008002de <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  8002de:	55                   	push   %rbp
+  8002df:	48 89 e5             	mov    %rsp,%rbp
+  8002e2:	48 83 ec 50          	sub    $0x50,%rsp
+  8002e6:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8002ea:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8002ee:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  8002f2:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8002f9:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8002fd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800301:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800305:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  800309:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80030d:	48 b8 1b 03 80 00 00 	movabs $0x80031b,%rax
+  800314:	00 00 00 
+  800317:	ff d0                	call   *%rax
+}
+  800319:	c9                   	leave
+  80031a:	c3                   	ret
+
+000000000080031b <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  80031b:	55                   	push   %rbp
+  80031c:	48 89 e5             	mov    %rsp,%rbp
+  80031f:	41 57                	push   %r15
+  800321:	41 56                	push   %r14
+  800323:	41 55                	push   %r13
+  800325:	41 54                	push   %r12
+  800327:	53                   	push   %rbx
+  800328:	48 83 ec 38          	sub    $0x38,%rsp
+  80032c:	49 89 fe             	mov    %rdi,%r14
+  80032f:	49 89 f5             	mov    %rsi,%r13
+  800332:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  800335:	48 8b 01             	mov    (%rcx),%rax
+  800338:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  80033c:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800340:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800344:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  800348:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  80034c:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  800350:	0f b6 3b             	movzbl (%rbx),%edi
+  800353:	40 80 ff 25          	cmp    $0x25,%dil
+  800357:	74 18                	je     800371 <vprintfmt+0x56>
+            if (!ch) return;
+  800359:	40 84 ff             	test   %dil,%dil
+  80035c:	0f 84 b1 06 00 00    	je     800a13 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  800362:	40 0f b6 ff          	movzbl %dil,%edi
+  800366:	4c 89 ee             	mov    %r13,%rsi
+  800369:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  80036c:	4c 89 e3             	mov    %r12,%rbx
+  80036f:	eb db                	jmp    80034c <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  800371:	be 00 00 00 00       	mov    $0x0,%esi
+  800376:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  80037a:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  80037f:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800385:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  80038c:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800390:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  800395:	41 0f b6 04 24       	movzbl (%r12),%eax
+  80039a:	88 45 a0             	mov    %al,-0x60(%rbp)
+  80039d:	83 e8 23             	sub    $0x23,%eax
+  8003a0:	3c 57                	cmp    $0x57,%al
+  8003a2:	0f 87 51 06 00 00    	ja     8009f9 <vprintfmt+0x6de>
+  8003a8:	0f b6 c0             	movzbl %al,%eax
+  8003ab:	48 b9 a0 2e 80 00 00 	movabs $0x802ea0,%rcx
+  8003b2:	00 00 00 
+  8003b5:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  8003b8:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  8003bb:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  8003bf:	eb cf                	jmp    800390 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  8003c1:	49 89 dc             	mov    %rbx,%r12
+  8003c4:	be 01 00 00 00       	mov    $0x1,%esi
+  8003c9:	eb c5                	jmp    800390 <vprintfmt+0x75>
+            padc = ch;
+  8003cb:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  8003cf:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8003d2:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8003d5:	eb b9                	jmp    800390 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8003d7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8003da:	83 f8 2f             	cmp    $0x2f,%eax
+  8003dd:	77 24                	ja     800403 <vprintfmt+0xe8>
+  8003df:	89 c1                	mov    %eax,%ecx
+  8003e1:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  8003e5:	83 c0 08             	add    $0x8,%eax
+  8003e8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8003eb:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  8003ee:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  8003f1:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8003f5:	79 99                	jns    800390 <vprintfmt+0x75>
+                width = precision;
+  8003f7:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  8003fb:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800401:	eb 8d                	jmp    800390 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800403:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  800407:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  80040b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80040f:	eb da                	jmp    8003eb <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  800411:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  800416:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  80041a:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  800420:	3c 39                	cmp    $0x39,%al
+  800422:	77 1c                	ja     800440 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  800424:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  800428:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  80042c:	0f b6 c0             	movzbl %al,%eax
+  80042f:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800434:	0f b6 03             	movzbl (%rbx),%eax
+  800437:	3c 39                	cmp    $0x39,%al
+  800439:	76 e9                	jbe    800424 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  80043b:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  80043e:	eb b1                	jmp    8003f1 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  800440:	49 89 dc             	mov    %rbx,%r12
+  800443:	eb ac                	jmp    8003f1 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  800445:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  800448:	85 c9                	test   %ecx,%ecx
+  80044a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80044f:	0f 49 c1             	cmovns %ecx,%eax
+  800452:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  800455:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800458:	e9 33 ff ff ff       	jmp    800390 <vprintfmt+0x75>
+            lflag++;
+  80045d:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  800460:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800463:	e9 28 ff ff ff       	jmp    800390 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  800468:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80046b:	83 f8 2f             	cmp    $0x2f,%eax
+  80046e:	77 19                	ja     800489 <vprintfmt+0x16e>
+  800470:	89 c2                	mov    %eax,%edx
+  800472:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800476:	83 c0 08             	add    $0x8,%eax
+  800479:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80047c:	8b 3a                	mov    (%rdx),%edi
+  80047e:	4c 89 ee             	mov    %r13,%rsi
+  800481:	41 ff d6             	call   *%r14
+            break;
+  800484:	e9 c3 fe ff ff       	jmp    80034c <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  800489:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80048d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800491:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800495:	eb e5                	jmp    80047c <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  800497:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80049a:	83 f8 2f             	cmp    $0x2f,%eax
+  80049d:	77 5a                	ja     8004f9 <vprintfmt+0x1de>
+  80049f:	89 c2                	mov    %eax,%edx
+  8004a1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8004a5:	83 c0 08             	add    $0x8,%eax
+  8004a8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  8004ab:	8b 02                	mov    (%rdx),%eax
+  8004ad:	89 c1                	mov    %eax,%ecx
+  8004af:	f7 d9                	neg    %ecx
+  8004b1:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  8004b4:	83 f9 15             	cmp    $0x15,%ecx
+  8004b7:	7f 4e                	jg     800507 <vprintfmt+0x1ec>
+  8004b9:	48 63 c1             	movslq %ecx,%rax
+  8004bc:	48 ba 60 31 80 00 00 	movabs $0x803160,%rdx
+  8004c3:	00 00 00 
+  8004c6:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8004ca:	48 85 c0             	test   %rax,%rax
+  8004cd:	74 38                	je     800507 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  8004cf:	48 89 c1             	mov    %rax,%rcx
+  8004d2:	48 ba 19 33 80 00 00 	movabs $0x803319,%rdx
+  8004d9:	00 00 00 
+  8004dc:	4c 89 ee             	mov    %r13,%rsi
+  8004df:	4c 89 f7             	mov    %r14,%rdi
+  8004e2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004e7:	49 b8 de 02 80 00 00 	movabs $0x8002de,%r8
+  8004ee:	00 00 00 
+  8004f1:	41 ff d0             	call   *%r8
+  8004f4:	e9 53 fe ff ff       	jmp    80034c <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  8004f9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8004fd:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800501:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800505:	eb a4                	jmp    8004ab <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  800507:	48 ba fc 2c 80 00 00 	movabs $0x802cfc,%rdx
+  80050e:	00 00 00 
+  800511:	4c 89 ee             	mov    %r13,%rsi
+  800514:	4c 89 f7             	mov    %r14,%rdi
+  800517:	b8 00 00 00 00       	mov    $0x0,%eax
+  80051c:	49 b8 de 02 80 00 00 	movabs $0x8002de,%r8
+  800523:	00 00 00 
+  800526:	41 ff d0             	call   *%r8
+  800529:	e9 1e fe ff ff       	jmp    80034c <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  80052e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800531:	83 f8 2f             	cmp    $0x2f,%eax
+  800534:	77 6c                	ja     8005a2 <vprintfmt+0x287>
+  800536:	89 c2                	mov    %eax,%edx
+  800538:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80053c:	83 c0 08             	add    $0x8,%eax
+  80053f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800542:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  800545:	48 85 d2             	test   %rdx,%rdx
+  800548:	48 b8 f5 2c 80 00 00 	movabs $0x802cf5,%rax
+  80054f:	00 00 00 
+  800552:	48 0f 45 c2          	cmovne %rdx,%rax
+  800556:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  80055a:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  80055e:	7e 06                	jle    800566 <vprintfmt+0x24b>
+  800560:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  800564:	75 4a                	jne    8005b0 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800566:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  80056a:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  80056e:	0f b6 00             	movzbl (%rax),%eax
+  800571:	84 c0                	test   %al,%al
+  800573:	0f 85 9a 00 00 00    	jne    800613 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  800579:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80057c:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  800580:	85 c0                	test   %eax,%eax
+  800582:	0f 8e c4 fd ff ff    	jle    80034c <vprintfmt+0x31>
+  800588:	4c 89 ee             	mov    %r13,%rsi
+  80058b:	bf 20 00 00 00       	mov    $0x20,%edi
+  800590:	41 ff d6             	call   *%r14
+  800593:	41 83 ec 01          	sub    $0x1,%r12d
+  800597:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  80059b:	75 eb                	jne    800588 <vprintfmt+0x26d>
+  80059d:	e9 aa fd ff ff       	jmp    80034c <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8005a2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8005a6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8005aa:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8005ae:	eb 92                	jmp    800542 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  8005b0:	49 63 f7             	movslq %r15d,%rsi
+  8005b3:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  8005b7:	48 b8 cd 0a 80 00 00 	movabs $0x800acd,%rax
+  8005be:	00 00 00 
+  8005c1:	ff d0                	call   *%rax
+  8005c3:	48 89 c2             	mov    %rax,%rdx
+  8005c6:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8005c9:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  8005cb:	8d 70 ff             	lea    -0x1(%rax),%esi
+  8005ce:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  8005d1:	85 c0                	test   %eax,%eax
+  8005d3:	7e 91                	jle    800566 <vprintfmt+0x24b>
+  8005d5:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  8005da:	4c 89 ee             	mov    %r13,%rsi
+  8005dd:	44 89 e7             	mov    %r12d,%edi
+  8005e0:	41 ff d6             	call   *%r14
+  8005e3:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8005e7:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8005ea:	83 f8 ff             	cmp    $0xffffffff,%eax
+  8005ed:	75 eb                	jne    8005da <vprintfmt+0x2bf>
+  8005ef:	e9 72 ff ff ff       	jmp    800566 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8005f4:	0f b6 f8             	movzbl %al,%edi
+  8005f7:	4c 89 ee             	mov    %r13,%rsi
+  8005fa:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8005fd:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800601:	49 83 c4 01          	add    $0x1,%r12
+  800605:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  80060b:	84 c0                	test   %al,%al
+  80060d:	0f 84 66 ff ff ff    	je     800579 <vprintfmt+0x25e>
+  800613:	45 85 ff             	test   %r15d,%r15d
+  800616:	78 0a                	js     800622 <vprintfmt+0x307>
+  800618:	41 83 ef 01          	sub    $0x1,%r15d
+  80061c:	0f 88 57 ff ff ff    	js     800579 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800622:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  800626:	74 cc                	je     8005f4 <vprintfmt+0x2d9>
+  800628:	8d 50 e0             	lea    -0x20(%rax),%edx
+  80062b:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800630:	80 fa 5e             	cmp    $0x5e,%dl
+  800633:	77 c2                	ja     8005f7 <vprintfmt+0x2dc>
+  800635:	eb bd                	jmp    8005f4 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  800637:	40 84 f6             	test   %sil,%sil
+  80063a:	75 26                	jne    800662 <vprintfmt+0x347>
+    switch (lflag) {
+  80063c:	85 d2                	test   %edx,%edx
+  80063e:	74 59                	je     800699 <vprintfmt+0x37e>
+  800640:	83 fa 01             	cmp    $0x1,%edx
+  800643:	74 7b                	je     8006c0 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  800645:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800648:	83 f8 2f             	cmp    $0x2f,%eax
+  80064b:	0f 87 96 00 00 00    	ja     8006e7 <vprintfmt+0x3cc>
+  800651:	89 c2                	mov    %eax,%edx
+  800653:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800657:	83 c0 08             	add    $0x8,%eax
+  80065a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80065d:	4c 8b 22             	mov    (%rdx),%r12
+  800660:	eb 17                	jmp    800679 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  800662:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800665:	83 f8 2f             	cmp    $0x2f,%eax
+  800668:	77 21                	ja     80068b <vprintfmt+0x370>
+  80066a:	89 c2                	mov    %eax,%edx
+  80066c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800670:	83 c0 08             	add    $0x8,%eax
+  800673:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800676:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  800679:	4d 85 e4             	test   %r12,%r12
+  80067c:	78 7a                	js     8006f8 <vprintfmt+0x3dd>
+            num = i;
+  80067e:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  800681:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  800686:	e9 50 02 00 00       	jmp    8008db <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  80068b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80068f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800693:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800697:	eb dd                	jmp    800676 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  800699:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80069c:	83 f8 2f             	cmp    $0x2f,%eax
+  80069f:	77 11                	ja     8006b2 <vprintfmt+0x397>
+  8006a1:	89 c2                	mov    %eax,%edx
+  8006a3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8006a7:	83 c0 08             	add    $0x8,%eax
+  8006aa:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8006ad:	4c 63 22             	movslq (%rdx),%r12
+  8006b0:	eb c7                	jmp    800679 <vprintfmt+0x35e>
+  8006b2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8006b6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006ba:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006be:	eb ed                	jmp    8006ad <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  8006c0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006c3:	83 f8 2f             	cmp    $0x2f,%eax
+  8006c6:	77 11                	ja     8006d9 <vprintfmt+0x3be>
+  8006c8:	89 c2                	mov    %eax,%edx
+  8006ca:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8006ce:	83 c0 08             	add    $0x8,%eax
+  8006d1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8006d4:	4c 8b 22             	mov    (%rdx),%r12
+  8006d7:	eb a0                	jmp    800679 <vprintfmt+0x35e>
+  8006d9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8006dd:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006e1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006e5:	eb ed                	jmp    8006d4 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  8006e7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8006eb:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006ef:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006f3:	e9 65 ff ff ff       	jmp    80065d <vprintfmt+0x342>
+                putch('-', put_arg);
+  8006f8:	4c 89 ee             	mov    %r13,%rsi
+  8006fb:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800700:	41 ff d6             	call   *%r14
+                i = -i;
+  800703:	49 f7 dc             	neg    %r12
+  800706:	e9 73 ff ff ff       	jmp    80067e <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  80070b:	40 84 f6             	test   %sil,%sil
+  80070e:	75 32                	jne    800742 <vprintfmt+0x427>
+    switch (lflag) {
+  800710:	85 d2                	test   %edx,%edx
+  800712:	74 5d                	je     800771 <vprintfmt+0x456>
+  800714:	83 fa 01             	cmp    $0x1,%edx
+  800717:	0f 84 82 00 00 00    	je     80079f <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  80071d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800720:	83 f8 2f             	cmp    $0x2f,%eax
+  800723:	0f 87 a5 00 00 00    	ja     8007ce <vprintfmt+0x4b3>
+  800729:	89 c2                	mov    %eax,%edx
+  80072b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80072f:	83 c0 08             	add    $0x8,%eax
+  800732:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800735:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800738:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  80073d:	e9 99 01 00 00       	jmp    8008db <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800742:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800745:	83 f8 2f             	cmp    $0x2f,%eax
+  800748:	77 19                	ja     800763 <vprintfmt+0x448>
+  80074a:	89 c2                	mov    %eax,%edx
+  80074c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800750:	83 c0 08             	add    $0x8,%eax
+  800753:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800756:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800759:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  80075e:	e9 78 01 00 00       	jmp    8008db <vprintfmt+0x5c0>
+  800763:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800767:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80076b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80076f:	eb e5                	jmp    800756 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  800771:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800774:	83 f8 2f             	cmp    $0x2f,%eax
+  800777:	77 18                	ja     800791 <vprintfmt+0x476>
+  800779:	89 c2                	mov    %eax,%edx
+  80077b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80077f:	83 c0 08             	add    $0x8,%eax
+  800782:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800785:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800787:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  80078c:	e9 4a 01 00 00       	jmp    8008db <vprintfmt+0x5c0>
+  800791:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800795:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800799:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80079d:	eb e6                	jmp    800785 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  80079f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007a2:	83 f8 2f             	cmp    $0x2f,%eax
+  8007a5:	77 19                	ja     8007c0 <vprintfmt+0x4a5>
+  8007a7:	89 c2                	mov    %eax,%edx
+  8007a9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007ad:	83 c0 08             	add    $0x8,%eax
+  8007b0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007b3:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8007b6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  8007bb:	e9 1b 01 00 00       	jmp    8008db <vprintfmt+0x5c0>
+  8007c0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007c4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007c8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007cc:	eb e5                	jmp    8007b3 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  8007ce:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007d2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007d6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007da:	e9 56 ff ff ff       	jmp    800735 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  8007df:	40 84 f6             	test   %sil,%sil
+  8007e2:	75 2e                	jne    800812 <vprintfmt+0x4f7>
+    switch (lflag) {
+  8007e4:	85 d2                	test   %edx,%edx
+  8007e6:	74 59                	je     800841 <vprintfmt+0x526>
+  8007e8:	83 fa 01             	cmp    $0x1,%edx
+  8007eb:	74 7f                	je     80086c <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  8007ed:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007f0:	83 f8 2f             	cmp    $0x2f,%eax
+  8007f3:	0f 87 9f 00 00 00    	ja     800898 <vprintfmt+0x57d>
+  8007f9:	89 c2                	mov    %eax,%edx
+  8007fb:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007ff:	83 c0 08             	add    $0x8,%eax
+  800802:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800805:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800808:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  80080d:	e9 c9 00 00 00       	jmp    8008db <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800812:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800815:	83 f8 2f             	cmp    $0x2f,%eax
+  800818:	77 19                	ja     800833 <vprintfmt+0x518>
+  80081a:	89 c2                	mov    %eax,%edx
+  80081c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800820:	83 c0 08             	add    $0x8,%eax
+  800823:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800826:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800829:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  80082e:	e9 a8 00 00 00       	jmp    8008db <vprintfmt+0x5c0>
+  800833:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800837:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80083b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80083f:	eb e5                	jmp    800826 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  800841:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800844:	83 f8 2f             	cmp    $0x2f,%eax
+  800847:	77 15                	ja     80085e <vprintfmt+0x543>
+  800849:	89 c2                	mov    %eax,%edx
+  80084b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80084f:	83 c0 08             	add    $0x8,%eax
+  800852:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800855:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  800857:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  80085c:	eb 7d                	jmp    8008db <vprintfmt+0x5c0>
+  80085e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800862:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800866:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80086a:	eb e9                	jmp    800855 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  80086c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80086f:	83 f8 2f             	cmp    $0x2f,%eax
+  800872:	77 16                	ja     80088a <vprintfmt+0x56f>
+  800874:	89 c2                	mov    %eax,%edx
+  800876:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80087a:	83 c0 08             	add    $0x8,%eax
+  80087d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800880:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800883:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  800888:	eb 51                	jmp    8008db <vprintfmt+0x5c0>
+  80088a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80088e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800892:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800896:	eb e8                	jmp    800880 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  800898:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80089c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008a0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008a4:	e9 5c ff ff ff       	jmp    800805 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  8008a9:	4c 89 ee             	mov    %r13,%rsi
+  8008ac:	bf 30 00 00 00       	mov    $0x30,%edi
+  8008b1:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  8008b4:	4c 89 ee             	mov    %r13,%rsi
+  8008b7:	bf 78 00 00 00       	mov    $0x78,%edi
+  8008bc:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  8008bf:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008c2:	83 f8 2f             	cmp    $0x2f,%eax
+  8008c5:	77 47                	ja     80090e <vprintfmt+0x5f3>
+  8008c7:	89 c2                	mov    %eax,%edx
+  8008c9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008cd:	83 c0 08             	add    $0x8,%eax
+  8008d0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008d3:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8008d6:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  8008db:	48 83 ec 08          	sub    $0x8,%rsp
+  8008df:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  8008e3:	0f 94 c0             	sete   %al
+  8008e6:	0f b6 c0             	movzbl %al,%eax
+  8008e9:	50                   	push   %rax
+  8008ea:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  8008ef:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  8008f3:	4c 89 ee             	mov    %r13,%rsi
+  8008f6:	4c 89 f7             	mov    %r14,%rdi
+  8008f9:	48 b8 10 02 80 00 00 	movabs $0x800210,%rax
+  800900:	00 00 00 
+  800903:	ff d0                	call   *%rax
+            break;
+  800905:	48 83 c4 10          	add    $0x10,%rsp
+  800909:	e9 3e fa ff ff       	jmp    80034c <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  80090e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800912:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800916:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80091a:	eb b7                	jmp    8008d3 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  80091c:	40 84 f6             	test   %sil,%sil
+  80091f:	75 2b                	jne    80094c <vprintfmt+0x631>
+    switch (lflag) {
+  800921:	85 d2                	test   %edx,%edx
+  800923:	74 56                	je     80097b <vprintfmt+0x660>
+  800925:	83 fa 01             	cmp    $0x1,%edx
+  800928:	74 7f                	je     8009a9 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  80092a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80092d:	83 f8 2f             	cmp    $0x2f,%eax
+  800930:	0f 87 a2 00 00 00    	ja     8009d8 <vprintfmt+0x6bd>
+  800936:	89 c2                	mov    %eax,%edx
+  800938:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80093c:	83 c0 08             	add    $0x8,%eax
+  80093f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800942:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800945:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  80094a:	eb 8f                	jmp    8008db <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  80094c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80094f:	83 f8 2f             	cmp    $0x2f,%eax
+  800952:	77 19                	ja     80096d <vprintfmt+0x652>
+  800954:	89 c2                	mov    %eax,%edx
+  800956:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80095a:	83 c0 08             	add    $0x8,%eax
+  80095d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800960:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800963:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800968:	e9 6e ff ff ff       	jmp    8008db <vprintfmt+0x5c0>
+  80096d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800971:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800975:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800979:	eb e5                	jmp    800960 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  80097b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80097e:	83 f8 2f             	cmp    $0x2f,%eax
+  800981:	77 18                	ja     80099b <vprintfmt+0x680>
+  800983:	89 c2                	mov    %eax,%edx
+  800985:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800989:	83 c0 08             	add    $0x8,%eax
+  80098c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80098f:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800991:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800996:	e9 40 ff ff ff       	jmp    8008db <vprintfmt+0x5c0>
+  80099b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80099f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009a3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009a7:	eb e6                	jmp    80098f <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  8009a9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009ac:	83 f8 2f             	cmp    $0x2f,%eax
+  8009af:	77 19                	ja     8009ca <vprintfmt+0x6af>
+  8009b1:	89 c2                	mov    %eax,%edx
+  8009b3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009b7:	83 c0 08             	add    $0x8,%eax
+  8009ba:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009bd:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8009c0:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  8009c5:	e9 11 ff ff ff       	jmp    8008db <vprintfmt+0x5c0>
+  8009ca:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009ce:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009d2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009d6:	eb e5                	jmp    8009bd <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  8009d8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009dc:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009e0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009e4:	e9 59 ff ff ff       	jmp    800942 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  8009e9:	4c 89 ee             	mov    %r13,%rsi
+  8009ec:	bf 25 00 00 00       	mov    $0x25,%edi
+  8009f1:	41 ff d6             	call   *%r14
+            break;
+  8009f4:	e9 53 f9 ff ff       	jmp    80034c <vprintfmt+0x31>
+            putch('%', put_arg);
+  8009f9:	4c 89 ee             	mov    %r13,%rsi
+  8009fc:	bf 25 00 00 00       	mov    $0x25,%edi
+  800a01:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800a04:	48 83 eb 01          	sub    $0x1,%rbx
+  800a08:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800a0c:	75 f6                	jne    800a04 <vprintfmt+0x6e9>
+  800a0e:	e9 39 f9 ff ff       	jmp    80034c <vprintfmt+0x31>
+}
+  800a13:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800a17:	5b                   	pop    %rbx
+  800a18:	41 5c                	pop    %r12
+  800a1a:	41 5d                	pop    %r13
+  800a1c:	41 5e                	pop    %r14
+  800a1e:	41 5f                	pop    %r15
+  800a20:	5d                   	pop    %rbp
+  800a21:	c3                   	ret
+
+0000000000800a22 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800a22:	55                   	push   %rbp
+  800a23:	48 89 e5             	mov    %rsp,%rbp
+  800a26:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800a2a:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800a2e:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800a33:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800a37:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800a3e:	48 85 ff             	test   %rdi,%rdi
+  800a41:	74 2b                	je     800a6e <vsnprintf+0x4c>
+  800a43:	48 85 f6             	test   %rsi,%rsi
+  800a46:	74 26                	je     800a6e <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800a48:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800a4c:	48 bf c6 02 80 00 00 	movabs $0x8002c6,%rdi
+  800a53:	00 00 00 
+  800a56:	48 b8 1b 03 80 00 00 	movabs $0x80031b,%rax
+  800a5d:	00 00 00 
+  800a60:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800a62:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800a66:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800a69:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800a6c:	c9                   	leave
+  800a6d:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800a6e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800a73:	eb f7                	jmp    800a6c <vsnprintf+0x4a>
+
+0000000000800a75 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800a75:	55                   	push   %rbp
+  800a76:	48 89 e5             	mov    %rsp,%rbp
+  800a79:	48 83 ec 50          	sub    $0x50,%rsp
+  800a7d:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800a81:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800a85:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800a89:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800a90:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800a94:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a98:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800a9c:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800aa0:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800aa4:	48 b8 22 0a 80 00 00 	movabs $0x800a22,%rax
+  800aab:	00 00 00 
+  800aae:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800ab0:	c9                   	leave
+  800ab1:	c3                   	ret
+
+0000000000800ab2 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800ab2:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800ab5:	74 10                	je     800ac7 <strlen+0x15>
+    size_t n = 0;
+  800ab7:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800abc:	48 83 c0 01          	add    $0x1,%rax
+  800ac0:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800ac4:	75 f6                	jne    800abc <strlen+0xa>
+  800ac6:	c3                   	ret
+    size_t n = 0;
+  800ac7:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800acc:	c3                   	ret
+
+0000000000800acd <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800acd:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800ad0:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800ad5:	48 85 f6             	test   %rsi,%rsi
+  800ad8:	74 11                	je     800aeb <strnlen+0x1e>
+  800ada:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800ade:	74 0c                	je     800aec <strnlen+0x1f>
+  800ae0:	48 83 c2 01          	add    $0x1,%rdx
+  800ae4:	48 39 d0             	cmp    %rdx,%rax
+  800ae7:	75 f1                	jne    800ada <strnlen+0xd>
+  800ae9:	eb 04                	jmp    800aef <strnlen+0x22>
+  800aeb:	c3                   	ret
+  800aec:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800aef:	c3                   	ret
+
+0000000000800af0 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800af0:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800af3:	ba 00 00 00 00       	mov    $0x0,%edx
+  800af8:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800afc:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800aff:	48 83 c2 01          	add    $0x1,%rdx
+  800b03:	84 c9                	test   %cl,%cl
+  800b05:	75 f1                	jne    800af8 <strcpy+0x8>
+        ;
+    return res;
+}
+  800b07:	c3                   	ret
+
+0000000000800b08 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800b08:	55                   	push   %rbp
+  800b09:	48 89 e5             	mov    %rsp,%rbp
+  800b0c:	41 54                	push   %r12
+  800b0e:	53                   	push   %rbx
+  800b0f:	48 89 fb             	mov    %rdi,%rbx
+  800b12:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800b15:	48 b8 b2 0a 80 00 00 	movabs $0x800ab2,%rax
+  800b1c:	00 00 00 
+  800b1f:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800b21:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800b25:	4c 89 e6             	mov    %r12,%rsi
+  800b28:	48 b8 f0 0a 80 00 00 	movabs $0x800af0,%rax
+  800b2f:	00 00 00 
+  800b32:	ff d0                	call   *%rax
+    return dst;
+}
+  800b34:	48 89 d8             	mov    %rbx,%rax
+  800b37:	5b                   	pop    %rbx
+  800b38:	41 5c                	pop    %r12
+  800b3a:	5d                   	pop    %rbp
+  800b3b:	c3                   	ret
+
+0000000000800b3c <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800b3c:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800b3f:	48 85 d2             	test   %rdx,%rdx
+  800b42:	74 1f                	je     800b63 <strncpy+0x27>
+  800b44:	48 01 fa             	add    %rdi,%rdx
+  800b47:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800b4a:	48 83 c1 01          	add    $0x1,%rcx
+  800b4e:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800b52:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800b56:	41 80 f8 01          	cmp    $0x1,%r8b
+  800b5a:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800b5e:	48 39 ca             	cmp    %rcx,%rdx
+  800b61:	75 e7                	jne    800b4a <strncpy+0xe>
+    }
+    return ret;
+}
+  800b63:	c3                   	ret
+
+0000000000800b64 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800b64:	48 89 f8             	mov    %rdi,%rax
+  800b67:	48 85 d2             	test   %rdx,%rdx
+  800b6a:	74 24                	je     800b90 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800b6c:	48 83 ea 01          	sub    $0x1,%rdx
+  800b70:	74 1b                	je     800b8d <strlcpy+0x29>
+  800b72:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800b76:	0f b6 16             	movzbl (%rsi),%edx
+  800b79:	84 d2                	test   %dl,%dl
+  800b7b:	74 10                	je     800b8d <strlcpy+0x29>
+            *dst++ = *src++;
+  800b7d:	48 83 c6 01          	add    $0x1,%rsi
+  800b81:	48 83 c0 01          	add    $0x1,%rax
+  800b85:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800b88:	48 39 c8             	cmp    %rcx,%rax
+  800b8b:	75 e9                	jne    800b76 <strlcpy+0x12>
+        *dst = '\0';
+  800b8d:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800b90:	48 29 f8             	sub    %rdi,%rax
+}
+  800b93:	c3                   	ret
+
+0000000000800b94 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800b94:	0f b6 07             	movzbl (%rdi),%eax
+  800b97:	84 c0                	test   %al,%al
+  800b99:	74 13                	je     800bae <strcmp+0x1a>
+  800b9b:	38 06                	cmp    %al,(%rsi)
+  800b9d:	75 0f                	jne    800bae <strcmp+0x1a>
+  800b9f:	48 83 c7 01          	add    $0x1,%rdi
+  800ba3:	48 83 c6 01          	add    $0x1,%rsi
+  800ba7:	0f b6 07             	movzbl (%rdi),%eax
+  800baa:	84 c0                	test   %al,%al
+  800bac:	75 ed                	jne    800b9b <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800bae:	0f b6 c0             	movzbl %al,%eax
+  800bb1:	0f b6 16             	movzbl (%rsi),%edx
+  800bb4:	29 d0                	sub    %edx,%eax
+}
+  800bb6:	c3                   	ret
+
+0000000000800bb7 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800bb7:	48 85 d2             	test   %rdx,%rdx
+  800bba:	74 1f                	je     800bdb <strncmp+0x24>
+  800bbc:	0f b6 07             	movzbl (%rdi),%eax
+  800bbf:	84 c0                	test   %al,%al
+  800bc1:	74 1e                	je     800be1 <strncmp+0x2a>
+  800bc3:	3a 06                	cmp    (%rsi),%al
+  800bc5:	75 1a                	jne    800be1 <strncmp+0x2a>
+  800bc7:	48 83 c7 01          	add    $0x1,%rdi
+  800bcb:	48 83 c6 01          	add    $0x1,%rsi
+  800bcf:	48 83 ea 01          	sub    $0x1,%rdx
+  800bd3:	75 e7                	jne    800bbc <strncmp+0x5>
+
+    if (!n) return 0;
+  800bd5:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bda:	c3                   	ret
+  800bdb:	b8 00 00 00 00       	mov    $0x0,%eax
+  800be0:	c3                   	ret
+  800be1:	48 85 d2             	test   %rdx,%rdx
+  800be4:	74 09                	je     800bef <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800be6:	0f b6 07             	movzbl (%rdi),%eax
+  800be9:	0f b6 16             	movzbl (%rsi),%edx
+  800bec:	29 d0                	sub    %edx,%eax
+  800bee:	c3                   	ret
+    if (!n) return 0;
+  800bef:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800bf4:	c3                   	ret
+
+0000000000800bf5 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800bf5:	0f b6 17             	movzbl (%rdi),%edx
+  800bf8:	84 d2                	test   %dl,%dl
+  800bfa:	74 18                	je     800c14 <strchr+0x1f>
+        if (*str == c) {
+  800bfc:	0f be d2             	movsbl %dl,%edx
+  800bff:	39 f2                	cmp    %esi,%edx
+  800c01:	74 17                	je     800c1a <strchr+0x25>
+    for (; *str; str++) {
+  800c03:	48 83 c7 01          	add    $0x1,%rdi
+  800c07:	0f b6 17             	movzbl (%rdi),%edx
+  800c0a:	84 d2                	test   %dl,%dl
+  800c0c:	75 ee                	jne    800bfc <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800c0e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c13:	c3                   	ret
+  800c14:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c19:	c3                   	ret
+  800c1a:	48 89 f8             	mov    %rdi,%rax
+}
+  800c1d:	c3                   	ret
+
+0000000000800c1e <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800c1e:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800c21:	0f b6 17             	movzbl (%rdi),%edx
+  800c24:	84 d2                	test   %dl,%dl
+  800c26:	74 13                	je     800c3b <strfind+0x1d>
+  800c28:	0f be d2             	movsbl %dl,%edx
+  800c2b:	39 f2                	cmp    %esi,%edx
+  800c2d:	74 0b                	je     800c3a <strfind+0x1c>
+  800c2f:	48 83 c0 01          	add    $0x1,%rax
+  800c33:	0f b6 10             	movzbl (%rax),%edx
+  800c36:	84 d2                	test   %dl,%dl
+  800c38:	75 ee                	jne    800c28 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800c3a:	c3                   	ret
+  800c3b:	c3                   	ret
+
+0000000000800c3c <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800c3c:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800c3f:	48 89 f8             	mov    %rdi,%rax
+  800c42:	48 f7 d8             	neg    %rax
+  800c45:	83 e0 07             	and    $0x7,%eax
+  800c48:	49 89 d1             	mov    %rdx,%r9
+  800c4b:	49 29 c1             	sub    %rax,%r9
+  800c4e:	78 36                	js     800c86 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800c50:	40 0f b6 c6          	movzbl %sil,%eax
+  800c54:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800c5b:	01 01 01 
+  800c5e:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800c62:	40 f6 c7 07          	test   $0x7,%dil
+  800c66:	75 38                	jne    800ca0 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800c68:	4c 89 c9             	mov    %r9,%rcx
+  800c6b:	48 c1 f9 03          	sar    $0x3,%rcx
+  800c6f:	74 0c                	je     800c7d <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800c71:	fc                   	cld
+  800c72:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800c75:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800c79:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800c7d:	4d 85 c9             	test   %r9,%r9
+  800c80:	75 45                	jne    800cc7 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800c82:	4c 89 c0             	mov    %r8,%rax
+  800c85:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800c86:	48 85 d2             	test   %rdx,%rdx
+  800c89:	74 f7                	je     800c82 <memset+0x46>
+  800c8b:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800c8e:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800c91:	48 83 c0 01          	add    $0x1,%rax
+  800c95:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  800c99:	48 39 c2             	cmp    %rax,%rdx
+  800c9c:	75 f3                	jne    800c91 <memset+0x55>
+  800c9e:	eb e2                	jmp    800c82 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  800ca0:	40 f6 c7 01          	test   $0x1,%dil
+  800ca4:	74 06                	je     800cac <memset+0x70>
+  800ca6:	88 07                	mov    %al,(%rdi)
+  800ca8:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800cac:	40 f6 c7 02          	test   $0x2,%dil
+  800cb0:	74 07                	je     800cb9 <memset+0x7d>
+  800cb2:	66 89 07             	mov    %ax,(%rdi)
+  800cb5:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800cb9:	40 f6 c7 04          	test   $0x4,%dil
+  800cbd:	74 a9                	je     800c68 <memset+0x2c>
+  800cbf:	89 07                	mov    %eax,(%rdi)
+  800cc1:	48 83 c7 04          	add    $0x4,%rdi
+  800cc5:	eb a1                	jmp    800c68 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800cc7:	41 f6 c1 04          	test   $0x4,%r9b
+  800ccb:	74 06                	je     800cd3 <memset+0x97>
+  800ccd:	89 07                	mov    %eax,(%rdi)
+  800ccf:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800cd3:	41 f6 c1 02          	test   $0x2,%r9b
+  800cd7:	74 07                	je     800ce0 <memset+0xa4>
+  800cd9:	66 89 07             	mov    %ax,(%rdi)
+  800cdc:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  800ce0:	41 f6 c1 01          	test   $0x1,%r9b
+  800ce4:	74 9c                	je     800c82 <memset+0x46>
+  800ce6:	88 07                	mov    %al,(%rdi)
+  800ce8:	eb 98                	jmp    800c82 <memset+0x46>
+
+0000000000800cea <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  800cea:	48 89 f8             	mov    %rdi,%rax
+  800ced:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  800cf0:	48 39 fe             	cmp    %rdi,%rsi
+  800cf3:	73 3b                	jae    800d30 <memmove+0x46>
+  800cf5:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  800cf9:	48 39 d7             	cmp    %rdx,%rdi
+  800cfc:	73 32                	jae    800d30 <memmove+0x46>
+        s += n;
+        d += n;
+  800cfe:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800d02:	48 89 d6             	mov    %rdx,%rsi
+  800d05:	48 09 fe             	or     %rdi,%rsi
+  800d08:	48 09 ce             	or     %rcx,%rsi
+  800d0b:	40 f6 c6 07          	test   $0x7,%sil
+  800d0f:	75 12                	jne    800d23 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  800d11:	48 83 ef 08          	sub    $0x8,%rdi
+  800d15:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  800d19:	48 c1 e9 03          	shr    $0x3,%rcx
+  800d1d:	fd                   	std
+  800d1e:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  800d21:	fc                   	cld
+  800d22:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  800d23:	48 83 ef 01          	sub    $0x1,%rdi
+  800d27:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  800d2b:	fd                   	std
+  800d2c:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  800d2e:	eb f1                	jmp    800d21 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800d30:	48 89 f2             	mov    %rsi,%rdx
+  800d33:	48 09 c2             	or     %rax,%rdx
+  800d36:	48 09 ca             	or     %rcx,%rdx
+  800d39:	f6 c2 07             	test   $0x7,%dl
+  800d3c:	75 0c                	jne    800d4a <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  800d3e:	48 c1 e9 03          	shr    $0x3,%rcx
+  800d42:	48 89 c7             	mov    %rax,%rdi
+  800d45:	fc                   	cld
+  800d46:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  800d49:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  800d4a:	48 89 c7             	mov    %rax,%rdi
+  800d4d:	fc                   	cld
+  800d4e:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  800d50:	c3                   	ret
+
+0000000000800d51 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  800d51:	55                   	push   %rbp
+  800d52:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  800d55:	48 b8 ea 0c 80 00 00 	movabs $0x800cea,%rax
+  800d5c:	00 00 00 
+  800d5f:	ff d0                	call   *%rax
+}
+  800d61:	5d                   	pop    %rbp
+  800d62:	c3                   	ret
+
+0000000000800d63 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  800d63:	55                   	push   %rbp
+  800d64:	48 89 e5             	mov    %rsp,%rbp
+  800d67:	41 57                	push   %r15
+  800d69:	41 56                	push   %r14
+  800d6b:	41 55                	push   %r13
+  800d6d:	41 54                	push   %r12
+  800d6f:	53                   	push   %rbx
+  800d70:	48 83 ec 08          	sub    $0x8,%rsp
+  800d74:	49 89 fe             	mov    %rdi,%r14
+  800d77:	49 89 f7             	mov    %rsi,%r15
+  800d7a:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  800d7d:	48 89 f7             	mov    %rsi,%rdi
+  800d80:	48 b8 b2 0a 80 00 00 	movabs $0x800ab2,%rax
+  800d87:	00 00 00 
+  800d8a:	ff d0                	call   *%rax
+  800d8c:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  800d8f:	48 89 de             	mov    %rbx,%rsi
+  800d92:	4c 89 f7             	mov    %r14,%rdi
+  800d95:	48 b8 cd 0a 80 00 00 	movabs $0x800acd,%rax
+  800d9c:	00 00 00 
+  800d9f:	ff d0                	call   *%rax
+  800da1:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  800da4:	48 39 c3             	cmp    %rax,%rbx
+  800da7:	74 36                	je     800ddf <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  800da9:	48 89 d8             	mov    %rbx,%rax
+  800dac:	4c 29 e8             	sub    %r13,%rax
+  800daf:	49 39 c4             	cmp    %rax,%r12
+  800db2:	73 31                	jae    800de5 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  800db4:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  800db9:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800dbd:	4c 89 fe             	mov    %r15,%rsi
+  800dc0:	48 b8 51 0d 80 00 00 	movabs $0x800d51,%rax
+  800dc7:	00 00 00 
+  800dca:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  800dcc:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  800dd0:	48 83 c4 08          	add    $0x8,%rsp
+  800dd4:	5b                   	pop    %rbx
+  800dd5:	41 5c                	pop    %r12
+  800dd7:	41 5d                	pop    %r13
+  800dd9:	41 5e                	pop    %r14
+  800ddb:	41 5f                	pop    %r15
+  800ddd:	5d                   	pop    %rbp
+  800dde:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  800ddf:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800de3:	eb eb                	jmp    800dd0 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  800de5:	48 83 eb 01          	sub    $0x1,%rbx
+  800de9:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800ded:	48 89 da             	mov    %rbx,%rdx
+  800df0:	4c 89 fe             	mov    %r15,%rsi
+  800df3:	48 b8 51 0d 80 00 00 	movabs $0x800d51,%rax
+  800dfa:	00 00 00 
+  800dfd:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  800dff:	49 01 de             	add    %rbx,%r14
+  800e02:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  800e07:	eb c3                	jmp    800dcc <strlcat+0x69>
+
+0000000000800e09 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  800e09:	48 85 d2             	test   %rdx,%rdx
+  800e0c:	74 2d                	je     800e3b <memcmp+0x32>
+  800e0e:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  800e13:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800e17:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  800e1c:	44 38 c1             	cmp    %r8b,%cl
+  800e1f:	75 0f                	jne    800e30 <memcmp+0x27>
+    while (n-- > 0) {
+  800e21:	48 83 c0 01          	add    $0x1,%rax
+  800e25:	48 39 c2             	cmp    %rax,%rdx
+  800e28:	75 e9                	jne    800e13 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  800e2a:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e2f:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  800e30:	0f b6 c1             	movzbl %cl,%eax
+  800e33:	45 0f b6 c0          	movzbl %r8b,%r8d
+  800e37:	44 29 c0             	sub    %r8d,%eax
+  800e3a:	c3                   	ret
+    return 0;
+  800e3b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800e40:	c3                   	ret
+
+0000000000800e41 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  800e41:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  800e45:	48 39 c7             	cmp    %rax,%rdi
+  800e48:	73 0f                	jae    800e59 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  800e4a:	40 38 37             	cmp    %sil,(%rdi)
+  800e4d:	74 0e                	je     800e5d <memfind+0x1c>
+    for (; src < end; src++) {
+  800e4f:	48 83 c7 01          	add    $0x1,%rdi
+  800e53:	48 39 f8             	cmp    %rdi,%rax
+  800e56:	75 f2                	jne    800e4a <memfind+0x9>
+  800e58:	c3                   	ret
+  800e59:	48 89 f8             	mov    %rdi,%rax
+  800e5c:	c3                   	ret
+  800e5d:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  800e60:	c3                   	ret
+
+0000000000800e61 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  800e61:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  800e64:	0f b6 37             	movzbl (%rdi),%esi
+  800e67:	40 80 fe 20          	cmp    $0x20,%sil
+  800e6b:	74 06                	je     800e73 <strtol+0x12>
+  800e6d:	40 80 fe 09          	cmp    $0x9,%sil
+  800e71:	75 13                	jne    800e86 <strtol+0x25>
+  800e73:	48 83 c7 01          	add    $0x1,%rdi
+  800e77:	0f b6 37             	movzbl (%rdi),%esi
+  800e7a:	40 80 fe 20          	cmp    $0x20,%sil
+  800e7e:	74 f3                	je     800e73 <strtol+0x12>
+  800e80:	40 80 fe 09          	cmp    $0x9,%sil
+  800e84:	74 ed                	je     800e73 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  800e86:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  800e89:	83 e0 fd             	and    $0xfffffffd,%eax
+  800e8c:	3c 01                	cmp    $0x1,%al
+  800e8e:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  800e92:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  800e98:	75 0f                	jne    800ea9 <strtol+0x48>
+  800e9a:	80 3f 30             	cmpb   $0x30,(%rdi)
+  800e9d:	74 14                	je     800eb3 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  800e9f:	85 d2                	test   %edx,%edx
+  800ea1:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800ea6:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  800ea9:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  800eae:	4c 63 ca             	movslq %edx,%r9
+  800eb1:	eb 36                	jmp    800ee9 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  800eb3:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  800eb7:	74 0f                	je     800ec8 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  800eb9:	85 d2                	test   %edx,%edx
+  800ebb:	75 ec                	jne    800ea9 <strtol+0x48>
+        s++;
+  800ebd:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  800ec1:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  800ec6:	eb e1                	jmp    800ea9 <strtol+0x48>
+        s += 2;
+  800ec8:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  800ecc:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  800ed1:	eb d6                	jmp    800ea9 <strtol+0x48>
+            dig -= '0';
+  800ed3:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  800ed6:	44 0f b6 c1          	movzbl %cl,%r8d
+  800eda:	41 39 d0             	cmp    %edx,%r8d
+  800edd:	7d 21                	jge    800f00 <strtol+0x9f>
+        val = val * base + dig;
+  800edf:	49 0f af c1          	imul   %r9,%rax
+  800ee3:	0f b6 c9             	movzbl %cl,%ecx
+  800ee6:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  800ee9:	48 83 c7 01          	add    $0x1,%rdi
+  800eed:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  800ef1:	80 f9 39             	cmp    $0x39,%cl
+  800ef4:	76 dd                	jbe    800ed3 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  800ef6:	80 f9 7b             	cmp    $0x7b,%cl
+  800ef9:	77 05                	ja     800f00 <strtol+0x9f>
+            dig -= 'a' - 10;
+  800efb:	83 e9 57             	sub    $0x57,%ecx
+  800efe:	eb d6                	jmp    800ed6 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  800f00:	4d 85 d2             	test   %r10,%r10
+  800f03:	74 03                	je     800f08 <strtol+0xa7>
+  800f05:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  800f08:	48 89 c2             	mov    %rax,%rdx
+  800f0b:	48 f7 da             	neg    %rdx
+  800f0e:	40 80 fe 2d          	cmp    $0x2d,%sil
+  800f12:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  800f16:	c3                   	ret
+
+0000000000800f17 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  800f17:	55                   	push   %rbp
+  800f18:	48 89 e5             	mov    %rsp,%rbp
+  800f1b:	53                   	push   %rbx
+  800f1c:	48 89 fa             	mov    %rdi,%rdx
+  800f1f:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  800f22:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800f27:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f2c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800f31:	be 00 00 00 00       	mov    $0x0,%esi
+  800f36:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800f3c:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  800f3e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800f42:	c9                   	leave
+  800f43:	c3                   	ret
+
+0000000000800f44 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  800f44:	55                   	push   %rbp
+  800f45:	48 89 e5             	mov    %rsp,%rbp
+  800f48:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  800f49:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800f4e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f53:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800f58:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f5d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800f62:	be 00 00 00 00       	mov    $0x0,%esi
+  800f67:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800f6d:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  800f6f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800f73:	c9                   	leave
+  800f74:	c3                   	ret
+
+0000000000800f75 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  800f75:	55                   	push   %rbp
+  800f76:	48 89 e5             	mov    %rsp,%rbp
+  800f79:	53                   	push   %rbx
+  800f7a:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  800f7e:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800f81:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800f86:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800f8b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f90:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800f95:	be 00 00 00 00       	mov    $0x0,%esi
+  800f9a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800fa0:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800fa2:	48 85 c0             	test   %rax,%rax
+  800fa5:	7f 06                	jg     800fad <sys_env_destroy+0x38>
+}
+  800fa7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800fab:	c9                   	leave
+  800fac:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800fad:	49 89 c0             	mov    %rax,%r8
+  800fb0:	b9 03 00 00 00       	mov    $0x3,%ecx
+  800fb5:	48 ba 30 32 80 00 00 	movabs $0x803230,%rdx
+  800fbc:	00 00 00 
+  800fbf:	be 26 00 00 00       	mov    $0x26,%esi
+  800fc4:	48 bf 4f 32 80 00 00 	movabs $0x80324f,%rdi
+  800fcb:	00 00 00 
+  800fce:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fd3:	49 b9 31 2a 80 00 00 	movabs $0x802a31,%r9
+  800fda:	00 00 00 
+  800fdd:	41 ff d1             	call   *%r9
+
+0000000000800fe0 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  800fe0:	55                   	push   %rbp
+  800fe1:	48 89 e5             	mov    %rsp,%rbp
+  800fe4:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  800fe5:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800fea:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fef:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800ff4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ff9:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800ffe:	be 00 00 00 00       	mov    $0x0,%esi
+  801003:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801009:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  80100b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80100f:	c9                   	leave
+  801010:	c3                   	ret
+
+0000000000801011 <sys_yield>:
+
+void
+sys_yield(void) {
+  801011:	55                   	push   %rbp
+  801012:	48 89 e5             	mov    %rsp,%rbp
+  801015:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801016:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80101b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801020:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801025:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80102a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80102f:	be 00 00 00 00       	mov    $0x0,%esi
+  801034:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80103a:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  80103c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801040:	c9                   	leave
+  801041:	c3                   	ret
+
+0000000000801042 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  801042:	55                   	push   %rbp
+  801043:	48 89 e5             	mov    %rsp,%rbp
+  801046:	53                   	push   %rbx
+  801047:	48 89 fa             	mov    %rdi,%rdx
+  80104a:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80104d:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801052:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  801059:	00 00 00 
+  80105c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801061:	be 00 00 00 00       	mov    $0x0,%esi
+  801066:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80106c:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  80106e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801072:	c9                   	leave
+  801073:	c3                   	ret
+
+0000000000801074 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  801074:	55                   	push   %rbp
+  801075:	48 89 e5             	mov    %rsp,%rbp
+  801078:	53                   	push   %rbx
+  801079:	49 89 f8             	mov    %rdi,%r8
+  80107c:	48 89 d3             	mov    %rdx,%rbx
+  80107f:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801082:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801087:	4c 89 c2             	mov    %r8,%rdx
+  80108a:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80108d:	be 00 00 00 00       	mov    $0x0,%esi
+  801092:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801098:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  80109a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80109e:	c9                   	leave
+  80109f:	c3                   	ret
+
+00000000008010a0 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  8010a0:	55                   	push   %rbp
+  8010a1:	48 89 e5             	mov    %rsp,%rbp
+  8010a4:	53                   	push   %rbx
+  8010a5:	48 83 ec 08          	sub    $0x8,%rsp
+  8010a9:	89 f8                	mov    %edi,%eax
+  8010ab:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  8010ae:	48 63 f9             	movslq %ecx,%rdi
+  8010b1:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8010b4:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8010b9:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8010bc:	be 00 00 00 00       	mov    $0x0,%esi
+  8010c1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8010c7:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8010c9:	48 85 c0             	test   %rax,%rax
+  8010cc:	7f 06                	jg     8010d4 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  8010ce:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8010d2:	c9                   	leave
+  8010d3:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8010d4:	49 89 c0             	mov    %rax,%r8
+  8010d7:	b9 04 00 00 00       	mov    $0x4,%ecx
+  8010dc:	48 ba 30 32 80 00 00 	movabs $0x803230,%rdx
+  8010e3:	00 00 00 
+  8010e6:	be 26 00 00 00       	mov    $0x26,%esi
+  8010eb:	48 bf 4f 32 80 00 00 	movabs $0x80324f,%rdi
+  8010f2:	00 00 00 
+  8010f5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010fa:	49 b9 31 2a 80 00 00 	movabs $0x802a31,%r9
+  801101:	00 00 00 
+  801104:	41 ff d1             	call   *%r9
+
+0000000000801107 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801107:	55                   	push   %rbp
+  801108:	48 89 e5             	mov    %rsp,%rbp
+  80110b:	53                   	push   %rbx
+  80110c:	48 83 ec 08          	sub    $0x8,%rsp
+  801110:	89 f8                	mov    %edi,%eax
+  801112:	49 89 f2             	mov    %rsi,%r10
+  801115:	48 89 cf             	mov    %rcx,%rdi
+  801118:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  80111b:	48 63 da             	movslq %edx,%rbx
+  80111e:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801121:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801126:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801129:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  80112c:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80112e:	48 85 c0             	test   %rax,%rax
+  801131:	7f 06                	jg     801139 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  801133:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801137:	c9                   	leave
+  801138:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801139:	49 89 c0             	mov    %rax,%r8
+  80113c:	b9 05 00 00 00       	mov    $0x5,%ecx
+  801141:	48 ba 30 32 80 00 00 	movabs $0x803230,%rdx
+  801148:	00 00 00 
+  80114b:	be 26 00 00 00       	mov    $0x26,%esi
+  801150:	48 bf 4f 32 80 00 00 	movabs $0x80324f,%rdi
+  801157:	00 00 00 
+  80115a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80115f:	49 b9 31 2a 80 00 00 	movabs $0x802a31,%r9
+  801166:	00 00 00 
+  801169:	41 ff d1             	call   *%r9
+
+000000000080116c <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  80116c:	55                   	push   %rbp
+  80116d:	48 89 e5             	mov    %rsp,%rbp
+  801170:	53                   	push   %rbx
+  801171:	48 83 ec 08          	sub    $0x8,%rsp
+  801175:	48 89 f1             	mov    %rsi,%rcx
+  801178:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  80117b:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80117e:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801183:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801188:	be 00 00 00 00       	mov    $0x0,%esi
+  80118d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801193:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801195:	48 85 c0             	test   %rax,%rax
+  801198:	7f 06                	jg     8011a0 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  80119a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80119e:	c9                   	leave
+  80119f:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8011a0:	49 89 c0             	mov    %rax,%r8
+  8011a3:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8011a8:	48 ba 30 32 80 00 00 	movabs $0x803230,%rdx
+  8011af:	00 00 00 
+  8011b2:	be 26 00 00 00       	mov    $0x26,%esi
+  8011b7:	48 bf 4f 32 80 00 00 	movabs $0x80324f,%rdi
+  8011be:	00 00 00 
+  8011c1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011c6:	49 b9 31 2a 80 00 00 	movabs $0x802a31,%r9
+  8011cd:	00 00 00 
+  8011d0:	41 ff d1             	call   *%r9
+
+00000000008011d3 <sys_region_batch>:
+
+int
+sys_region_batch(const struct RegionOp *ops, size_t count) {
+  8011d3:	55                   	push   %rbp
+  8011d4:	48 89 e5             	mov    %rsp,%rbp
+  8011d7:	53                   	push   %rbx
+  8011d8:	48 83 ec 08          	sub    $0x8,%rsp
+  8011dc:	48 89 fa             	mov    %rdi,%rdx
+  8011df:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8011e2:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8011e7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011ec:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8011f1:	be 00 00 00 00       	mov    $0x0,%esi
+  8011f6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8011fc:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8011fe:	48 85 c0             	test   %rax,%rax
+  801201:	7f 06                	jg     801209 <sys_region_batch+0x36>
+        else
+            platform_asan_unpoison(va, ops[i].size);
+    }
+#endif
+    return res;
+}
+  801203:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801207:	c9                   	leave
+  801208:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801209:	49 89 c0             	mov    %rax,%r8
+  80120c:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  801211:	48 ba 30 32 80 00 00 	movabs $0x803230,%rdx
+  801218:	00 00 00 
+  80121b:	be 26 00 00 00       	mov    $0x26,%esi
+  801220:	48 bf 4f 32 80 00 00 	movabs $0x80324f,%rdi
+  801227:	00 00 00 
+  80122a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80122f:	49 b9 31 2a 80 00 00 	movabs $0x802a31,%r9
+  801236:	00 00 00 
+  801239:	41 ff d1             	call   *%r9
+
+000000000080123c <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  80123c:	55                   	push   %rbp
+  80123d:	48 89 e5             	mov    %rsp,%rbp
+  801240:	53                   	push   %rbx
+  801241:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  801245:	48 63 ce             	movslq %esi,%rcx
+  801248:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80124b:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801250:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801255:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80125a:	be 00 00 00 00       	mov    $0x0,%esi
+  80125f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801265:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801267:	48 85 c0             	test   %rax,%rax
+  80126a:	7f 06                	jg     801272 <sys_env_set_status+0x36>
+}
+  80126c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801270:	c9                   	leave
+  801271:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801272:	49 89 c0             	mov    %rax,%r8
+  801275:	b9 09 00 00 00       	mov    $0x9,%ecx
+  80127a:	48 ba 30 32 80 00 00 	movabs $0x803230,%rdx
+  801281:	00 00 00 
+  801284:	be 26 00 00 00       	mov    $0x26,%esi
+  801289:	48 bf 4f 32 80 00 00 	movabs $0x80324f,%rdi
+  801290:	00 00 00 
+  801293:	b8 00 00 00 00       	mov    $0x0,%eax
+  801298:	49 b9 31 2a 80 00 00 	movabs $0x802a31,%r9
+  80129f:	00 00 00 
+  8012a2:	41 ff d1             	call   *%r9
+
+00000000008012a5 <sys_env_set_weight>:
+
+int
+sys_env_set_weight(envid_t envid, uint32_t weight) {
+  8012a5:	55                   	push   %rbp
+  8012a6:	48 89 e5             	mov    %rsp,%rbp
+  8012a9:	53                   	push   %rbx
+  8012aa:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_weight, 1, envid, weight, 0, 0, 0, 0);
+  8012ae:	89 f1                	mov    %esi,%ecx
+  8012b0:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8012b3:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8012b8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012bd:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012c2:	be 00 00 00 00       	mov    $0x0,%esi
+  8012c7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8012cd:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8012cf:	48 85 c0             	test   %rax,%rax
+  8012d2:	7f 06                	jg     8012da <sys_env_set_weight+0x35>
+}
+  8012d4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012d8:	c9                   	leave
+  8012d9:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8012da:	49 89 c0             	mov    %rax,%r8
+  8012dd:	b9 10 00 00 00       	mov    $0x10,%ecx
+  8012e2:	48 ba 30 32 80 00 00 	movabs $0x803230,%rdx
+  8012e9:	00 00 00 
+  8012ec:	be 26 00 00 00       	mov    $0x26,%esi
+  8012f1:	48 bf 4f 32 80 00 00 	movabs $0x80324f,%rdi
+  8012f8:	00 00 00 
+  8012fb:	b8 00 00 00 00       	mov    $0x0,%eax
+  801300:	49 b9 31 2a 80 00 00 	movabs $0x802a31,%r9
+  801307:	00 00 00 
+  80130a:	41 ff d1             	call   *%r9
+
+000000000080130d <sys_env_set_rt>:
+
+int
+sys_env_set_rt(envid_t envid, uint64_t period, uint64_t budget, uint64_t deadline) {
+  80130d:	55                   	push   %rbp
+  80130e:	48 89 e5             	mov    %rsp,%rbp
+  801311:	53                   	push   %rbx
+  801312:	48 83 ec 08          	sub    $0x8,%rsp
+  801316:	89 f8                	mov    %edi,%eax
+  801318:	48 89 d3             	mov    %rdx,%rbx
+  80131b:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_env_set_rt, 1, envid, period, budget, deadline, 0, 0);
+  80131e:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801321:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801326:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801329:	be 00 00 00 00       	mov    $0x0,%esi
+  80132e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801334:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801336:	48 85 c0             	test   %rax,%rax
+  801339:	7f 06                	jg     801341 <sys_env_set_rt+0x34>
+}
+  80133b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80133f:	c9                   	leave
+  801340:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801341:	49 89 c0             	mov    %rax,%r8
+  801344:	b9 11 00 00 00       	mov    $0x11,%ecx
+  801349:	48 ba 30 32 80 00 00 	movabs $0x803230,%rdx
+  801350:	00 00 00 
+  801353:	be 26 00 00 00       	mov    $0x26,%esi
+  801358:	48 bf 4f 32 80 00 00 	movabs $0x80324f,%rdi
+  80135f:	00 00 00 
+  801362:	b8 00 00 00 00       	mov    $0x0,%eax
+  801367:	49 b9 31 2a 80 00 00 	movabs $0x802a31,%r9
+  80136e:	00 00 00 
+  801371:	41 ff d1             	call   *%r9
+
+0000000000801374 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  801374:	55                   	push   %rbp
+  801375:	48 89 e5             	mov    %rsp,%rbp
+  801378:	53                   	push   %rbx
+  801379:	48 83 ec 08          	sub    $0x8,%rsp
+  80137d:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  801380:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801383:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801388:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80138d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801392:	be 00 00 00 00       	mov    $0x0,%esi
+  801397:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80139d:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80139f:	48 85 c0             	test   %rax,%rax
+  8013a2:	7f 06                	jg     8013aa <sys_env_set_trapframe+0x36>
+}
+  8013a4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013a8:	c9                   	leave
+  8013a9:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8013aa:	49 89 c0             	mov    %rax,%r8
+  8013ad:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  8013b2:	48 ba 30 32 80 00 00 	movabs $0x803230,%rdx
+  8013b9:	00 00 00 
+  8013bc:	be 26 00 00 00       	mov    $0x26,%esi
+  8013c1:	48 bf 4f 32 80 00 00 	movabs $0x80324f,%rdi
+  8013c8:	00 00 00 
+  8013cb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013d0:	49 b9 31 2a 80 00 00 	movabs $0x802a31,%r9
+  8013d7:	00 00 00 
+  8013da:	41 ff d1             	call   *%r9
+
+00000000008013dd <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  8013dd:	55                   	push   %rbp
+  8013de:	48 89 e5             	mov    %rsp,%rbp
+  8013e1:	53                   	push   %rbx
+  8013e2:	48 83 ec 08          	sub    $0x8,%rsp
+  8013e6:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  8013e9:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8013ec:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8013f1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013f6:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013fb:	be 00 00 00 00       	mov    $0x0,%esi
+  801400:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801406:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801408:	48 85 c0             	test   %rax,%rax
+  80140b:	7f 06                	jg     801413 <sys_env_set_pgfault_upcall+0x36>
+}
+  80140d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801411:	c9                   	leave
+  801412:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801413:	49 89 c0             	mov    %rax,%r8
+  801416:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  80141b:	48 ba 30 32 80 00 00 	movabs $0x803230,%rdx
+  801422:	00 00 00 
+  801425:	be 26 00 00 00       	mov    $0x26,%esi
+  80142a:	48 bf 4f 32 80 00 00 	movabs $0x80324f,%rdi
+  801431:	00 00 00 
+  801434:	b8 00 00 00 00       	mov    $0x0,%eax
+  801439:	49 b9 31 2a 80 00 00 	movabs $0x802a31,%r9
+  801440:	00 00 00 
+  801443:	41 ff d1             	call   *%r9
+
+0000000000801446 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  801446:	55                   	push   %rbp
+  801447:	48 89 e5             	mov    %rsp,%rbp
+  80144a:	53                   	push   %rbx
+  80144b:	89 f8                	mov    %edi,%eax
+  80144d:	49 89 f1             	mov    %rsi,%r9
+  801450:	48 89 d3             	mov    %rdx,%rbx
+  801453:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  801456:	49 63 f0             	movslq %r8d,%rsi
+  801459:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80145c:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801461:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801464:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80146a:	cd 30                	int    $0x30
+}
+  80146c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801470:	c9                   	leave
+  801471:	c3                   	ret
+
+0000000000801472 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  801472:	55                   	push   %rbp
+  801473:	48 89 e5             	mov    %rsp,%rbp
+  801476:	53                   	push   %rbx
+  801477:	48 83 ec 08          	sub    $0x8,%rsp
+  80147b:	48 89 fa             	mov    %rdi,%rdx
+  80147e:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801481:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801486:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80148b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801490:	be 00 00 00 00       	mov    $0x0,%esi
+  801495:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80149b:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80149d:	48 85 c0             	test   %rax,%rax
+  8014a0:	7f 06                	jg     8014a8 <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8014a2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014a6:	c9                   	leave
+  8014a7:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8014a8:	49 89 c0             	mov    %rax,%r8
+  8014ab:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  8014b0:	48 ba 30 32 80 00 00 	movabs $0x803230,%rdx
+  8014b7:	00 00 00 
+  8014ba:	be 26 00 00 00       	mov    $0x26,%esi
+  8014bf:	48 bf 4f 32 80 00 00 	movabs $0x80324f,%rdi
+  8014c6:	00 00 00 
+  8014c9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014ce:	49 b9 31 2a 80 00 00 	movabs $0x802a31,%r9
+  8014d5:	00 00 00 
+  8014d8:	41 ff d1             	call   *%r9
+
+00000000008014db <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8014db:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8014e2:	ff ff ff 
+  8014e5:	48 01 f8             	add    %rdi,%rax
+  8014e8:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  8014ec:	c3                   	ret
+
+00000000008014ed <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8014ed:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8014f4:	ff ff ff 
+  8014f7:	48 01 f8             	add    %rdi,%rax
+  8014fa:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  8014fe:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  801504:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  801508:	c3                   	ret
+
+0000000000801509 <fd_alloc_from>:
+}
+
+/* Like fd_alloc(), but only considers fds starting from fdnum,
+ * so that several fds can be found before their pages are allocated */
+int
+fd_alloc_from(int fdnum, struct Fd **fd_store) {
+  801509:	55                   	push   %rbp
+  80150a:	48 89 e5             	mov    %rsp,%rbp
+  80150d:	41 57                	push   %r15
+  80150f:	41 56                	push   %r14
+  801511:	41 55                	push   %r13
+  801513:	41 54                	push   %r12
+  801515:	53                   	push   %rbx
+  801516:	48 83 ec 08          	sub    $0x8,%rsp
+  80151a:	49 89 f7             	mov    %rsi,%r15
+    for (int i = MAX(fdnum, 0); i < MAXFD; i++) {
+  80151d:	85 ff                	test   %edi,%edi
+  80151f:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  801525:	44 0f 49 e7          	cmovns %edi,%r12d
+  801529:	83 ff 1f             	cmp    $0x1f,%edi
+  80152c:	7f 37                	jg     801565 <fd_alloc_from+0x5c>
+  80152e:	49 63 dc             	movslq %r12d,%rbx
+  801531:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  801538:	48 c1 e3 0c          	shl    $0xc,%rbx
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  80153c:	49 be 12 26 80 00 00 	movabs $0x802612,%r14
+  801543:	00 00 00 
+        struct Fd *fd = INDEX2FD(i);
+  801546:	49 89 dd             	mov    %rbx,%r13
+        if (!(get_prot(fd) & PROT_R)) {
+  801549:	48 89 df             	mov    %rbx,%rdi
+  80154c:	41 ff d6             	call   *%r14
+  80154f:	83 e0 04             	and    $0x4,%eax
+  801552:	74 1c                	je     801570 <fd_alloc_from+0x67>
+    for (int i = MAX(fdnum, 0); i < MAXFD; i++) {
+  801554:	41 83 c4 01          	add    $0x1,%r12d
+  801558:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  80155f:	41 83 fc 1f          	cmp    $0x1f,%r12d
+  801563:	7e e1                	jle    801546 <fd_alloc_from+0x3d>
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  801565:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  80156b:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  801570:	4d 89 2f             	mov    %r13,(%r15)
+}
+  801573:	48 83 c4 08          	add    $0x8,%rsp
+  801577:	5b                   	pop    %rbx
+  801578:	41 5c                	pop    %r12
+  80157a:	41 5d                	pop    %r13
+  80157c:	41 5e                	pop    %r14
+  80157e:	41 5f                	pop    %r15
+  801580:	5d                   	pop    %rbp
+  801581:	c3                   	ret
+
+0000000000801582 <fd_alloc>:
+fd_alloc(struct Fd **fd_store) {
+  801582:	55                   	push   %rbp
+  801583:	48 89 e5             	mov    %rsp,%rbp
+  801586:	48 89 fe             	mov    %rdi,%rsi
+    return fd_alloc_from(0, fd_store);
+  801589:	bf 00 00 00 00       	mov    $0x0,%edi
+  80158e:	48 b8 09 15 80 00 00 	movabs $0x801509,%rax
+  801595:	00 00 00 
+  801598:	ff d0                	call   *%rax
+}
+  80159a:	5d                   	pop    %rbp
+  80159b:	c3                   	ret
+
+000000000080159c <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  80159c:	83 ff 1f             	cmp    $0x1f,%edi
+  80159f:	77 39                	ja     8015da <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  8015a1:	55                   	push   %rbp
+  8015a2:	48 89 e5             	mov    %rsp,%rbp
+  8015a5:	41 54                	push   %r12
+  8015a7:	53                   	push   %rbx
+  8015a8:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  8015ab:	48 63 df             	movslq %edi,%rbx
+  8015ae:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  8015b5:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  8015b9:	48 89 df             	mov    %rbx,%rdi
+  8015bc:	48 b8 12 26 80 00 00 	movabs $0x802612,%rax
+  8015c3:	00 00 00 
+  8015c6:	ff d0                	call   *%rax
+  8015c8:	a8 04                	test   $0x4,%al
+  8015ca:	74 14                	je     8015e0 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  8015cc:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  8015d0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8015d5:	5b                   	pop    %rbx
+  8015d6:	41 5c                	pop    %r12
+  8015d8:	5d                   	pop    %rbp
+  8015d9:	c3                   	ret
+        return -E_INVAL;
+  8015da:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8015df:	c3                   	ret
+        return -E_INVAL;
+  8015e0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8015e5:	eb ee                	jmp    8015d5 <fd_lookup+0x39>
+
+00000000008015e7 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  8015e7:	55                   	push   %rbp
+  8015e8:	48 89 e5             	mov    %rsp,%rbp
+  8015eb:	41 54                	push   %r12
+  8015ed:	53                   	push   %rbx
+  8015ee:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  8015f1:	48 b8 e0 32 80 00 00 	movabs $0x8032e0,%rax
+  8015f8:	00 00 00 
+  8015fb:	48 bb 20 40 80 00 00 	movabs $0x804020,%rbx
+  801602:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  801605:	39 3b                	cmp    %edi,(%rbx)
+  801607:	74 47                	je     801650 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  801609:	48 83 c0 08          	add    $0x8,%rax
+  80160d:	48 8b 18             	mov    (%rax),%rbx
+  801610:	48 85 db             	test   %rbx,%rbx
+  801613:	75 f0                	jne    801605 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801615:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  80161c:	00 00 00 
+  80161f:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+  801625:	89 fa                	mov    %edi,%edx
+  801627:	48 bf 60 32 80 00 00 	movabs $0x803260,%rdi
+  80162e:	00 00 00 
+  801631:	b8 00 00 00 00       	mov    $0x0,%eax
+  801636:	48 b9 cb 01 80 00 00 	movabs $0x8001cb,%rcx
+  80163d:	00 00 00 
+  801640:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  801642:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  801647:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  80164b:	5b                   	pop    %rbx
+  80164c:	41 5c                	pop    %r12
+  80164e:	5d                   	pop    %rbp
+  80164f:	c3                   	ret
+            return 0;
+  801650:	b8 00 00 00 00       	mov    $0x0,%eax
+  801655:	eb f0                	jmp    801647 <dev_lookup+0x60>
+
+0000000000801657 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  801657:	55                   	push   %rbp
+  801658:	48 89 e5             	mov    %rsp,%rbp
+  80165b:	41 55                	push   %r13
+  80165d:	41 54                	push   %r12
+  80165f:	53                   	push   %rbx
+  801660:	48 83 ec 18          	sub    $0x18,%rsp
+  801664:	48 89 fb             	mov    %rdi,%rbx
+  801667:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80166a:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  801671:	ff ff ff 
+  801674:	48 01 df             	add    %rbx,%rdi
+  801677:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  80167b:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80167f:	48 b8 9c 15 80 00 00 	movabs $0x80159c,%rax
+  801686:	00 00 00 
+  801689:	ff d0                	call   *%rax
+  80168b:	41 89 c5             	mov    %eax,%r13d
+  80168e:	85 c0                	test   %eax,%eax
+  801690:	78 06                	js     801698 <fd_close+0x41>
+  801692:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  801696:	74 1a                	je     8016b2 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  801698:	45 84 e4             	test   %r12b,%r12b
+  80169b:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016a0:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  8016a4:	44 89 e8             	mov    %r13d,%eax
+  8016a7:	48 83 c4 18          	add    $0x18,%rsp
+  8016ab:	5b                   	pop    %rbx
+  8016ac:	41 5c                	pop    %r12
+  8016ae:	41 5d                	pop    %r13
+  8016b0:	5d                   	pop    %rbp
+  8016b1:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8016b2:	8b 3b                	mov    (%rbx),%edi
+  8016b4:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8016b8:	48 b8 e7 15 80 00 00 	movabs $0x8015e7,%rax
+  8016bf:	00 00 00 
+  8016c2:	ff d0                	call   *%rax
+  8016c4:	41 89 c5             	mov    %eax,%r13d
+  8016c7:	85 c0                	test   %eax,%eax
+  8016c9:	78 1b                	js     8016e6 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  8016cb:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8016cf:	48 8b 40 20          	mov    0x20(%rax),%rax
+  8016d3:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  8016d9:	48 85 c0             	test   %rax,%rax
+  8016dc:	74 08                	je     8016e6 <fd_close+0x8f>
+  8016de:	48 89 df             	mov    %rbx,%rdi
+  8016e1:	ff d0                	call   *%rax
+  8016e3:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8016e6:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8016eb:	48 89 de             	mov    %rbx,%rsi
+  8016ee:	bf 00 00 00 00       	mov    $0x0,%edi
+  8016f3:	48 b8 6c 11 80 00 00 	movabs $0x80116c,%rax
+  8016fa:	00 00 00 
+  8016fd:	ff d0                	call   *%rax
+    return res;
+  8016ff:	eb a3                	jmp    8016a4 <fd_close+0x4d>
+
+0000000000801701 <close>:
+
+int
+close(int fdnum) {
+  801701:	55                   	push   %rbp
+  801702:	48 89 e5             	mov    %rsp,%rbp
+  801705:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  801709:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80170d:	48 b8 9c 15 80 00 00 	movabs $0x80159c,%rax
+  801714:	00 00 00 
+  801717:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801719:	85 c0                	test   %eax,%eax
+  80171b:	78 15                	js     801732 <close+0x31>
+
+    return fd_close(fd, 1);
+  80171d:	be 01 00 00 00       	mov    $0x1,%esi
+  801722:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801726:	48 b8 57 16 80 00 00 	movabs $0x801657,%rax
+  80172d:	00 00 00 
+  801730:	ff d0                	call   *%rax
+}
+  801732:	c9                   	leave
+  801733:	c3                   	ret
+
+0000000000801734 <close_all>:
+
+void
+close_all(void) {
+  801734:	55                   	push   %rbp
+  801735:	48 89 e5             	mov    %rsp,%rbp
+  801738:	41 54                	push   %r12
+  80173a:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  80173b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801740:	49 bc 01 17 80 00 00 	movabs $0x801701,%r12
+  801747:	00 00 00 
+  80174a:	89 df                	mov    %ebx,%edi
+  80174c:	41 ff d4             	call   *%r12
+  80174f:	83 c3 01             	add    $0x1,%ebx
+  801752:	83 fb 20             	cmp    $0x20,%ebx
+  801755:	75 f3                	jne    80174a <close_all+0x16>
+}
+  801757:	5b                   	pop    %rbx
+  801758:	41 5c                	pop    %r12
+  80175a:	5d                   	pop    %rbp
+  80175b:	c3                   	ret
+
+000000000080175c <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  80175c:	55                   	push   %rbp
+  80175d:	48 89 e5             	mov    %rsp,%rbp
+  801760:	41 57                	push   %r15
+  801762:	41 56                	push   %r14
+  801764:	41 55                	push   %r13
+  801766:	41 54                	push   %r12
+  801768:	53                   	push   %rbx
+  801769:	48 83 ec 18          	sub    $0x18,%rsp
+  80176d:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  801770:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801774:	48 b8 9c 15 80 00 00 	movabs $0x80159c,%rax
+  80177b:	00 00 00 
+  80177e:	ff d0                	call   *%rax
+  801780:	89 c3                	mov    %eax,%ebx
+  801782:	85 c0                	test   %eax,%eax
+  801784:	0f 88 b8 00 00 00    	js     801842 <dup+0xe6>
+    close(newfdnum);
+  80178a:	44 89 e7             	mov    %r12d,%edi
+  80178d:	48 b8 01 17 80 00 00 	movabs $0x801701,%rax
+  801794:	00 00 00 
+  801797:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  801799:	4d 63 ec             	movslq %r12d,%r13
+  80179c:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  8017a3:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  8017a7:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  8017ab:	4c 89 ff             	mov    %r15,%rdi
+  8017ae:	49 be ed 14 80 00 00 	movabs $0x8014ed,%r14
+  8017b5:	00 00 00 
+  8017b8:	41 ff d6             	call   *%r14
+  8017bb:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  8017be:	4c 89 ef             	mov    %r13,%rdi
+  8017c1:	41 ff d6             	call   *%r14
+  8017c4:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  8017c7:	48 89 df             	mov    %rbx,%rdi
+  8017ca:	48 b8 12 26 80 00 00 	movabs $0x802612,%rax
+  8017d1:	00 00 00 
+  8017d4:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  8017d6:	a8 04                	test   $0x4,%al
+  8017d8:	74 2b                	je     801805 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  8017da:	41 89 c1             	mov    %eax,%r9d
+  8017dd:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8017e3:	4c 89 f1             	mov    %r14,%rcx
+  8017e6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8017eb:	48 89 de             	mov    %rbx,%rsi
+  8017ee:	bf 00 00 00 00       	mov    $0x0,%edi
+  8017f3:	48 b8 07 11 80 00 00 	movabs $0x801107,%rax
+  8017fa:	00 00 00 
+  8017fd:	ff d0                	call   *%rax
+  8017ff:	89 c3                	mov    %eax,%ebx
+  801801:	85 c0                	test   %eax,%eax
+  801803:	78 4e                	js     801853 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  801805:	4c 89 ff             	mov    %r15,%rdi
+  801808:	48 b8 12 26 80 00 00 	movabs $0x802612,%rax
+  80180f:	00 00 00 
+  801812:	ff d0                	call   *%rax
+  801814:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801817:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  80181d:	4c 89 e9             	mov    %r13,%rcx
+  801820:	ba 00 00 00 00       	mov    $0x0,%edx
+  801825:	4c 89 fe             	mov    %r15,%rsi
+  801828:	bf 00 00 00 00       	mov    $0x0,%edi
+  80182d:	48 b8 07 11 80 00 00 	movabs $0x801107,%rax
+  801834:	00 00 00 
+  801837:	ff d0                	call   *%rax
+  801839:	89 c3                	mov    %eax,%ebx
+  80183b:	85 c0                	test   %eax,%eax
+  80183d:	78 14                	js     801853 <dup+0xf7>
+
+    return newfdnum;
+  80183f:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  801842:	89 d8                	mov    %ebx,%eax
+  801844:	48 83 c4 18          	add    $0x18,%rsp
+  801848:	5b                   	pop    %rbx
+  801849:	41 5c                	pop    %r12
+  80184b:	41 5d                	pop    %r13
+  80184d:	41 5e                	pop    %r14
+  80184f:	41 5f                	pop    %r15
+  801851:	5d                   	pop    %rbp
+  801852:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  801853:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801858:	4c 89 ee             	mov    %r13,%rsi
+  80185b:	bf 00 00 00 00       	mov    $0x0,%edi
+  801860:	49 bc 6c 11 80 00 00 	movabs $0x80116c,%r12
+  801867:	00 00 00 
+  80186a:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  80186d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801872:	4c 89 f6             	mov    %r14,%rsi
+  801875:	bf 00 00 00 00       	mov    $0x0,%edi
+  80187a:	41 ff d4             	call   *%r12
+    return res;
+  80187d:	eb c3                	jmp    801842 <dup+0xe6>
+
+000000000080187f <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  80187f:	55                   	push   %rbp
+  801880:	48 89 e5             	mov    %rsp,%rbp
+  801883:	41 56                	push   %r14
+  801885:	41 55                	push   %r13
+  801887:	41 54                	push   %r12
+  801889:	53                   	push   %rbx
+  80188a:	48 83 ec 10          	sub    $0x10,%rsp
+  80188e:	89 fb                	mov    %edi,%ebx
+  801890:	49 89 f4             	mov    %rsi,%r12
+  801893:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801896:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80189a:	48 b8 9c 15 80 00 00 	movabs $0x80159c,%rax
+  8018a1:	00 00 00 
+  8018a4:	ff d0                	call   *%rax
+  8018a6:	85 c0                	test   %eax,%eax
+  8018a8:	78 4c                	js     8018f6 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8018aa:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  8018ae:	41 8b 3e             	mov    (%r14),%edi
+  8018b1:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8018b5:	48 b8 e7 15 80 00 00 	movabs $0x8015e7,%rax
+  8018bc:	00 00 00 
+  8018bf:	ff d0                	call   *%rax
+  8018c1:	85 c0                	test   %eax,%eax
+  8018c3:	78 35                	js     8018fa <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8018c5:	41 8b 46 08          	mov    0x8(%r14),%eax
+  8018c9:	83 e0 03             	and    $0x3,%eax
+  8018cc:	83 f8 01             	cmp    $0x1,%eax
+  8018cf:	74 2d                	je     8018fe <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  8018d1:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8018d5:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8018d9:	48 85 c0             	test   %rax,%rax
+  8018dc:	74 56                	je     801934 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  8018de:	4c 89 ea             	mov    %r13,%rdx
+  8018e1:	4c 89 e6             	mov    %r12,%rsi
+  8018e4:	4c 89 f7             	mov    %r14,%rdi
+  8018e7:	ff d0                	call   *%rax
+}
+  8018e9:	48 83 c4 10          	add    $0x10,%rsp
+  8018ed:	5b                   	pop    %rbx
+  8018ee:	41 5c                	pop    %r12
+  8018f0:	41 5d                	pop    %r13
+  8018f2:	41 5e                	pop    %r14
+  8018f4:	5d                   	pop    %rbp
+  8018f5:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8018f6:	48 98                	cltq
+  8018f8:	eb ef                	jmp    8018e9 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8018fa:	48 98                	cltq
+  8018fc:	eb eb                	jmp    8018e9 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8018fe:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801905:	00 00 00 
+  801908:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+  80190e:	89 da                	mov    %ebx,%edx
+  801910:	48 bf a1 32 80 00 00 	movabs $0x8032a1,%rdi
+  801917:	00 00 00 
+  80191a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80191f:	48 b9 cb 01 80 00 00 	movabs $0x8001cb,%rcx
+  801926:	00 00 00 
+  801929:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  80192b:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801932:	eb b5                	jmp    8018e9 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801934:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  80193b:	eb ac                	jmp    8018e9 <read+0x6a>
+
+000000000080193d <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  80193d:	55                   	push   %rbp
+  80193e:	48 89 e5             	mov    %rsp,%rbp
+  801941:	41 57                	push   %r15
+  801943:	41 56                	push   %r14
+  801945:	41 55                	push   %r13
+  801947:	41 54                	push   %r12
+  801949:	53                   	push   %rbx
+  80194a:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  80194e:	48 85 d2             	test   %rdx,%rdx
+  801951:	74 54                	je     8019a7 <readn+0x6a>
+  801953:	41 89 fd             	mov    %edi,%r13d
+  801956:	49 89 f6             	mov    %rsi,%r14
+  801959:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  80195c:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  801961:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  801966:	49 bf 7f 18 80 00 00 	movabs $0x80187f,%r15
+  80196d:	00 00 00 
+  801970:	4c 89 e2             	mov    %r12,%rdx
+  801973:	48 29 f2             	sub    %rsi,%rdx
+  801976:	4c 01 f6             	add    %r14,%rsi
+  801979:	44 89 ef             	mov    %r13d,%edi
+  80197c:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  80197f:	85 c0                	test   %eax,%eax
+  801981:	78 20                	js     8019a3 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  801983:	01 c3                	add    %eax,%ebx
+  801985:	85 c0                	test   %eax,%eax
+  801987:	74 08                	je     801991 <readn+0x54>
+  801989:	48 63 f3             	movslq %ebx,%rsi
+  80198c:	4c 39 e6             	cmp    %r12,%rsi
+  80198f:	72 df                	jb     801970 <readn+0x33>
+    }
+    return res;
+  801991:	48 63 c3             	movslq %ebx,%rax
+}
+  801994:	48 83 c4 08          	add    $0x8,%rsp
+  801998:	5b                   	pop    %rbx
+  801999:	41 5c                	pop    %r12
+  80199b:	41 5d                	pop    %r13
+  80199d:	41 5e                	pop    %r14
+  80199f:	41 5f                	pop    %r15
+  8019a1:	5d                   	pop    %rbp
+  8019a2:	c3                   	ret
+        if (inc < 0) return inc;
+  8019a3:	48 98                	cltq
+  8019a5:	eb ed                	jmp    801994 <readn+0x57>
+    int inc = 1, res = 0;
+  8019a7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8019ac:	eb e3                	jmp    801991 <readn+0x54>
+
+00000000008019ae <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  8019ae:	55                   	push   %rbp
+  8019af:	48 89 e5             	mov    %rsp,%rbp
+  8019b2:	41 56                	push   %r14
+  8019b4:	41 55                	push   %r13
+  8019b6:	41 54                	push   %r12
+  8019b8:	53                   	push   %rbx
+  8019b9:	48 83 ec 10          	sub    $0x10,%rsp
+  8019bd:	89 fb                	mov    %edi,%ebx
+  8019bf:	49 89 f4             	mov    %rsi,%r12
+  8019c2:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8019c5:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8019c9:	48 b8 9c 15 80 00 00 	movabs $0x80159c,%rax
+  8019d0:	00 00 00 
+  8019d3:	ff d0                	call   *%rax
+  8019d5:	85 c0                	test   %eax,%eax
+  8019d7:	78 47                	js     801a20 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8019d9:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  8019dd:	41 8b 3e             	mov    (%r14),%edi
+  8019e0:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8019e4:	48 b8 e7 15 80 00 00 	movabs $0x8015e7,%rax
+  8019eb:	00 00 00 
+  8019ee:	ff d0                	call   *%rax
+  8019f0:	85 c0                	test   %eax,%eax
+  8019f2:	78 30                	js     801a24 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8019f4:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  8019f9:	74 2d                	je     801a28 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  8019fb:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8019ff:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801a03:	48 85 c0             	test   %rax,%rax
+  801a06:	74 56                	je     801a5e <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  801a08:	4c 89 ea             	mov    %r13,%rdx
+  801a0b:	4c 89 e6             	mov    %r12,%rsi
+  801a0e:	4c 89 f7             	mov    %r14,%rdi
+  801a11:	ff d0                	call   *%rax
+}
+  801a13:	48 83 c4 10          	add    $0x10,%rsp
+  801a17:	5b                   	pop    %rbx
+  801a18:	41 5c                	pop    %r12
+  801a1a:	41 5d                	pop    %r13
+  801a1c:	41 5e                	pop    %r14
+  801a1e:	5d                   	pop    %rbp
+  801a1f:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801a20:	48 98                	cltq
+  801a22:	eb ef                	jmp    801a13 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801a24:	48 98                	cltq
+  801a26:	eb eb                	jmp    801a13 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801a28:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801a2f:	00 00 00 
+  801a32:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+  801a38:	89 da                	mov    %ebx,%edx
+  801a3a:	48 bf bd 32 80 00 00 	movabs $0x8032bd,%rdi
+  801a41:	00 00 00 
+  801a44:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a49:	48 b9 cb 01 80 00 00 	movabs $0x8001cb,%rcx
+  801a50:	00 00 00 
+  801a53:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801a55:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801a5c:	eb b5                	jmp    801a13 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801a5e:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801a65:	eb ac                	jmp    801a13 <write+0x65>
+
+0000000000801a67 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  801a67:	55                   	push   %rbp
+  801a68:	48 89 e5             	mov    %rsp,%rbp
+  801a6b:	53                   	push   %rbx
+  801a6c:	48 83 ec 18          	sub    $0x18,%rsp
+  801a70:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801a72:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801a76:	48 b8 9c 15 80 00 00 	movabs $0x80159c,%rax
+  801a7d:	00 00 00 
+  801a80:	ff d0                	call   *%rax
+  801a82:	85 c0                	test   %eax,%eax
+  801a84:	78 0c                	js     801a92 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  801a86:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801a8a:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  801a8d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801a92:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801a96:	c9                   	leave
+  801a97:	c3                   	ret
+
+0000000000801a98 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  801a98:	55                   	push   %rbp
+  801a99:	48 89 e5             	mov    %rsp,%rbp
+  801a9c:	41 55                	push   %r13
+  801a9e:	41 54                	push   %r12
+  801aa0:	53                   	push   %rbx
+  801aa1:	48 83 ec 18          	sub    $0x18,%rsp
+  801aa5:	89 fb                	mov    %edi,%ebx
+  801aa7:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801aaa:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801aae:	48 b8 9c 15 80 00 00 	movabs $0x80159c,%rax
+  801ab5:	00 00 00 
+  801ab8:	ff d0                	call   *%rax
+  801aba:	85 c0                	test   %eax,%eax
+  801abc:	78 38                	js     801af6 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801abe:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  801ac2:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  801ac6:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801aca:	48 b8 e7 15 80 00 00 	movabs $0x8015e7,%rax
+  801ad1:	00 00 00 
+  801ad4:	ff d0                	call   *%rax
+  801ad6:	85 c0                	test   %eax,%eax
+  801ad8:	78 1c                	js     801af6 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801ada:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  801adf:	74 20                	je     801b01 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801ae1:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801ae5:	48 8b 40 30          	mov    0x30(%rax),%rax
+  801ae9:	48 85 c0             	test   %rax,%rax
+  801aec:	74 47                	je     801b35 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  801aee:	44 89 e6             	mov    %r12d,%esi
+  801af1:	4c 89 ef             	mov    %r13,%rdi
+  801af4:	ff d0                	call   *%rax
+}
+  801af6:	48 83 c4 18          	add    $0x18,%rsp
+  801afa:	5b                   	pop    %rbx
+  801afb:	41 5c                	pop    %r12
+  801afd:	41 5d                	pop    %r13
+  801aff:	5d                   	pop    %rbp
+  801b00:	c3                   	ret
+                thisenv->env_id, fdnum);
+  801b01:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801b08:	00 00 00 
+  801b0b:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801b11:	89 da                	mov    %ebx,%edx
+  801b13:	48 bf 80 32 80 00 00 	movabs $0x803280,%rdi
+  801b1a:	00 00 00 
+  801b1d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b22:	48 b9 cb 01 80 00 00 	movabs $0x8001cb,%rcx
+  801b29:	00 00 00 
+  801b2c:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801b2e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801b33:	eb c1                	jmp    801af6 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801b35:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801b3a:	eb ba                	jmp    801af6 <ftruncate+0x5e>
+
+0000000000801b3c <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  801b3c:	55                   	push   %rbp
+  801b3d:	48 89 e5             	mov    %rsp,%rbp
+  801b40:	41 54                	push   %r12
+  801b42:	53                   	push   %rbx
+  801b43:	48 83 ec 10          	sub    $0x10,%rsp
+  801b47:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801b4a:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801b4e:	48 b8 9c 15 80 00 00 	movabs $0x80159c,%rax
+  801b55:	00 00 00 
+  801b58:	ff d0                	call   *%rax
+  801b5a:	85 c0                	test   %eax,%eax
+  801b5c:	78 4e                	js     801bac <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801b5e:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801b62:	41 8b 3c 24          	mov    (%r12),%edi
+  801b66:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801b6a:	48 b8 e7 15 80 00 00 	movabs $0x8015e7,%rax
+  801b71:	00 00 00 
+  801b74:	ff d0                	call   *%rax
+  801b76:	85 c0                	test   %eax,%eax
+  801b78:	78 32                	js     801bac <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801b7a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801b7e:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  801b83:	74 30                	je     801bb5 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  801b85:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  801b88:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  801b8f:	00 00 00 
+    stat->st_isdir = 0;
+  801b92:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  801b99:	00 00 00 
+    stat->st_dev = dev;
+  801b9c:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  801ba3:	48 89 de             	mov    %rbx,%rsi
+  801ba6:	4c 89 e7             	mov    %r12,%rdi
+  801ba9:	ff 50 28             	call   *0x28(%rax)
+}
+  801bac:	48 83 c4 10          	add    $0x10,%rsp
+  801bb0:	5b                   	pop    %rbx
+  801bb1:	41 5c                	pop    %r12
+  801bb3:	5d                   	pop    %rbp
+  801bb4:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801bb5:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801bba:	eb f0                	jmp    801bac <fstat+0x70>
+
+0000000000801bbc <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  801bbc:	55                   	push   %rbp
+  801bbd:	48 89 e5             	mov    %rsp,%rbp
+  801bc0:	41 54                	push   %r12
+  801bc2:	53                   	push   %rbx
+  801bc3:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  801bc6:	be 00 00 00 00       	mov    $0x0,%esi
+  801bcb:	48 b8 9f 1f 80 00 00 	movabs $0x801f9f,%rax
+  801bd2:	00 00 00 
+  801bd5:	ff d0                	call   *%rax
+  801bd7:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  801bd9:	85 c0                	test   %eax,%eax
+  801bdb:	78 25                	js     801c02 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  801bdd:	4c 89 e6             	mov    %r12,%rsi
+  801be0:	89 c7                	mov    %eax,%edi
+  801be2:	48 b8 3c 1b 80 00 00 	movabs $0x801b3c,%rax
+  801be9:	00 00 00 
+  801bec:	ff d0                	call   *%rax
+  801bee:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  801bf1:	89 df                	mov    %ebx,%edi
+  801bf3:	48 b8 01 17 80 00 00 	movabs $0x801701,%rax
+  801bfa:	00 00 00 
+  801bfd:	ff d0                	call   *%rax
+
+    return res;
+  801bff:	44 89 e3             	mov    %r12d,%ebx
+}
+  801c02:	89 d8                	mov    %ebx,%eax
+  801c04:	5b                   	pop    %rbx
+  801c05:	41 5c                	pop    %r12
+  801c07:	5d                   	pop    %rbp
+  801c08:	c3                   	ret
+
+0000000000801c09 <fsipc>:
+ * response may be written back to fsipcbuf.
+ * type: request code, passed as the simple integer IPC value.
+ * dstva: virtual address at which to receive reply page, 0 if none.
+ * Returns result from the file server. */
+static int
+fsipc(unsigned type, void *dstva) {
+  801c09:	55                   	push   %rbp
+  801c0a:	48 89 e5             	mov    %rsp,%rbp
+  801c0d:	41 54                	push   %r12
+  801c0f:	53                   	push   %rbx
+  801c10:	48 83 ec 10          	sub    $0x10,%rsp
+  801c14:	41 89 fc             	mov    %edi,%r12d
+  801c17:	48 89 f3             	mov    %rsi,%rbx
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  801c1a:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  801c21:	00 00 00 
+  801c24:	83 38 00             	cmpl   $0x0,(%rax)
+  801c27:	74 5e                	je     801c87 <fsipc+0x7e>
+    if (debug) {
+        cprintf("[%08x] fsipc %d %08x\n",
+                thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+    }
+
+    ipc_send(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW);
+  801c29:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  801c2f:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  801c34:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  801c3b:	00 00 00 
+  801c3e:	44 89 e6             	mov    %r12d,%esi
+  801c41:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  801c48:	00 00 00 
+  801c4b:	8b 38                	mov    (%rax),%edi
+  801c4d:	48 b8 a9 2b 80 00 00 	movabs $0x802ba9,%rax
+  801c54:	00 00 00 
+  801c57:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  801c59:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  801c60:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  801c61:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801c66:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  801c6a:	48 89 de             	mov    %rbx,%rsi
+  801c6d:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c72:	48 b8 d4 2a 80 00 00 	movabs $0x802ad4,%rax
+  801c79:	00 00 00 
+  801c7c:	ff d0                	call   *%rax
+}
+  801c7e:	48 83 c4 10          	add    $0x10,%rsp
+  801c82:	5b                   	pop    %rbx
+  801c83:	41 5c                	pop    %r12
+  801c85:	5d                   	pop    %rbp
+  801c86:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  801c87:	bf 03 00 00 00       	mov    $0x3,%edi
+  801c8c:	48 b8 4c 2c 80 00 00 	movabs $0x802c4c,%rax
+  801c93:	00 00 00 
+  801c96:	ff d0                	call   *%rax
+  801c98:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  801c9f:	00 00 
+  801ca1:	eb 86                	jmp    801c29 <fsipc+0x20>
+
+0000000000801ca3 <devfile_trunc>:
+    return 0;
+}
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  801ca3:	55                   	push   %rbp
+  801ca4:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801ca7:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  801cae:	00 00 00 
+  801cb1:	8b 57 0c             	mov    0xc(%rdi),%edx
+  801cb4:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  801cb6:	89 70 04             	mov    %esi,0x4(%rax)
+
+    return fsipc(FSREQ_SET_SIZE, NULL);
+  801cb9:	be 00 00 00 00       	mov    $0x0,%esi
+  801cbe:	bf 02 00 00 00       	mov    $0x2,%edi
+  801cc3:	48 b8 09 1c 80 00 00 	movabs $0x801c09,%rax
+  801cca:	00 00 00 
+  801ccd:	ff d0                	call   *%rax
+}
+  801ccf:	5d                   	pop    %rbp
+  801cd0:	c3                   	ret
+
+0000000000801cd1 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  801cd1:	55                   	push   %rbp
+  801cd2:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801cd5:	8b 47 0c             	mov    0xc(%rdi),%eax
+  801cd8:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  801cdf:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  801ce1:	be 00 00 00 00       	mov    $0x0,%esi
+  801ce6:	bf 06 00 00 00       	mov    $0x6,%edi
+  801ceb:	48 b8 09 1c 80 00 00 	movabs $0x801c09,%rax
+  801cf2:	00 00 00 
+  801cf5:	ff d0                	call   *%rax
+}
+  801cf7:	5d                   	pop    %rbp
+  801cf8:	c3                   	ret
+
+0000000000801cf9 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  801cf9:	55                   	push   %rbp
+  801cfa:	48 89 e5             	mov    %rsp,%rbp
+  801cfd:	41 54                	push   %r12
+  801cff:	53                   	push   %rbx
+  801d00:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801d03:	8b 47 0c             	mov    0xc(%rdi),%eax
+  801d06:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  801d0d:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  801d0f:	be 00 00 00 00       	mov    $0x0,%esi
+  801d14:	bf 05 00 00 00       	mov    $0x5,%edi
+  801d19:	48 b8 09 1c 80 00 00 	movabs $0x801c09,%rax
+  801d20:	00 00 00 
+  801d23:	ff d0                	call   *%rax
+    if (res < 0) {
+  801d25:	85 c0                	test   %eax,%eax
+  801d27:	78 3d                	js     801d66 <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801d29:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  801d30:	00 00 00 
+  801d33:	4c 89 e6             	mov    %r12,%rsi
+  801d36:	48 89 df             	mov    %rbx,%rdi
+  801d39:	48 b8 f0 0a 80 00 00 	movabs $0x800af0,%rax
+  801d40:	00 00 00 
+  801d43:	ff d0                	call   *%rax
+    st->st_size  = fsipcbuf.statRet.ret_size;
+  801d45:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  801d4c:	00 
+  801d4d:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801d53:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  801d5a:	00 
+  801d5b:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  801d61:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801d66:	5b                   	pop    %rbx
+  801d67:	41 5c                	pop    %r12
+  801d69:	5d                   	pop    %rbp
+  801d6a:	c3                   	ret
+
+0000000000801d6b <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  801d6b:	55                   	push   %rbp
+  801d6c:	48 89 e5             	mov    %rsp,%rbp
+  801d6f:	41 57                	push   %r15
+  801d71:	41 56                	push   %r14
+  801d73:	41 55                	push   %r13
+  801d75:	41 54                	push   %r12
+  801d77:	53                   	push   %rbx
+  801d78:	48 83 ec 18          	sub    $0x18,%rsp
+  801d7c:	49 89 fe             	mov    %rdi,%r14
+  801d7f:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+  801d83:	48 89 d3             	mov    %rdx,%rbx
+    while (n > sizeof(fsipcbuf.write.req_buf))
+  801d86:	48 81 fa f0 0f 00 00 	cmp    $0xff0,%rdx
+  801d8d:	0f 86 e4 00 00 00    	jbe    801e77 <devfile_write+0x10c>
+  801d93:	49 89 f4             	mov    %rsi,%r12
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801d96:	49 bd 00 60 80 00 00 	movabs $0x806000,%r13
+  801d9d:	00 00 00 
+        memcpy(fsipcbuf.write.req_buf, buf, sizeof(fsipcbuf.write.req_buf));
+  801da0:	49 bf 51 0d 80 00 00 	movabs $0x800d51,%r15
+  801da7:	00 00 00 
+  801daa:	eb 03                	jmp    801daf <devfile_write+0x44>
+        buf += sizeof(fsipcbuf.write.req_buf);
+  801dac:	49 89 f4             	mov    %rsi,%r12
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801daf:	41 8b 46 0c          	mov    0xc(%r14),%eax
+  801db3:	41 89 45 00          	mov    %eax,0x0(%r13)
+        fsipcbuf.write.req_n      = sizeof(fsipcbuf.write.req_buf);
+  801db7:	49 c7 45 08 f0 0f 00 	movq   $0xff0,0x8(%r13)
+  801dbe:	00 
+        memcpy(fsipcbuf.write.req_buf, buf, sizeof(fsipcbuf.write.req_buf));
+  801dbf:	ba f0 0f 00 00       	mov    $0xff0,%edx
+  801dc4:	4c 89 e6             	mov    %r12,%rsi
+  801dc7:	48 bf 10 60 80 00 00 	movabs $0x806010,%rdi
+  801dce:	00 00 00 
+  801dd1:	41 ff d7             	call   *%r15
+        ssize_t res = fsipc(FSREQ_WRITE, NULL);
+  801dd4:	be 00 00 00 00       	mov    $0x0,%esi
+  801dd9:	bf 04 00 00 00       	mov    $0x4,%edi
+  801dde:	48 b8 09 1c 80 00 00 	movabs $0x801c09,%rax
+  801de5:	00 00 00 
+  801de8:	ff d0                	call   *%rax
+  801dea:	48 63 d0             	movslq %eax,%rdx
+        if (res < 0 || res < sizeof(fsipcbuf.write.req_buf))
+  801ded:	3d ef 0f 00 00       	cmp    $0xfef,%eax
+  801df2:	7e 71                	jle    801e65 <devfile_write+0xfa>
+        buf += sizeof(fsipcbuf.write.req_buf);
+  801df4:	49 8d b4 24 f0 0f 00 	lea    0xff0(%r12),%rsi
+  801dfb:	00 
+        n -= sizeof(fsipcbuf.write.req_buf);
+  801dfc:	48 81 eb f0 0f 00 00 	sub    $0xff0,%rbx
+    while (n > sizeof(fsipcbuf.write.req_buf))
+  801e03:	48 81 fb f0 0f 00 00 	cmp    $0xff0,%rbx
+  801e0a:	77 a0                	ja     801dac <devfile_write+0x41>
+        written += sizeof(fsipcbuf.write.req_buf);
+  801e0c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801e10:	49 29 c4             	sub    %rax,%r12
+  801e13:	4d 8d a4 24 f0 0f 00 	lea    0xff0(%r12),%r12
+  801e1a:	00 
+    fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801e1b:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  801e22:	00 00 00 
+  801e25:	41 8b 56 0c          	mov    0xc(%r14),%edx
+  801e29:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.write.req_n      = n;
+  801e2b:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    memcpy(fsipcbuf.write.req_buf, buf, n);
+  801e2f:	48 89 da             	mov    %rbx,%rdx
+  801e32:	48 8d 78 10          	lea    0x10(%rax),%rdi
+  801e36:	48 b8 51 0d 80 00 00 	movabs $0x800d51,%rax
+  801e3d:	00 00 00 
+  801e40:	ff d0                	call   *%rax
+    ssize_t res = fsipc(FSREQ_WRITE, NULL);
+  801e42:	be 00 00 00 00       	mov    $0x0,%esi
+  801e47:	bf 04 00 00 00       	mov    $0x4,%edi
+  801e4c:	48 b8 09 1c 80 00 00 	movabs $0x801c09,%rax
+  801e53:	00 00 00 
+  801e56:	ff d0                	call   *%rax
+  801e58:	48 63 d0             	movslq %eax,%rdx
+    written += res;
+  801e5b:	49 01 d4             	add    %rdx,%r12
+  801e5e:	48 85 d2             	test   %rdx,%rdx
+  801e61:	49 0f 49 d4          	cmovns %r12,%rdx
+}
+  801e65:	48 89 d0             	mov    %rdx,%rax
+  801e68:	48 83 c4 18          	add    $0x18,%rsp
+  801e6c:	5b                   	pop    %rbx
+  801e6d:	41 5c                	pop    %r12
+  801e6f:	41 5d                	pop    %r13
+  801e71:	41 5e                	pop    %r14
+  801e73:	41 5f                	pop    %r15
+  801e75:	5d                   	pop    %rbp
+  801e76:	c3                   	ret
+    while (n > sizeof(fsipcbuf.write.req_buf))
+  801e77:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+    ssize_t written = 0;
+  801e7b:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  801e81:	eb 98                	jmp    801e1b <devfile_write+0xb0>
+
+0000000000801e83 <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  801e83:	55                   	push   %rbp
+  801e84:	48 89 e5             	mov    %rsp,%rbp
+  801e87:	41 57                	push   %r15
+  801e89:	41 56                	push   %r14
+  801e8b:	41 55                	push   %r13
+  801e8d:	41 54                	push   %r12
+  801e8f:	53                   	push   %rbx
+  801e90:	48 83 ec 18          	sub    $0x18,%rsp
+  801e94:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  801e98:	49 89 f6             	mov    %rsi,%r14
+  801e9b:	49 89 d4             	mov    %rdx,%r12
+    while (n > sizeof(fsipcbuf.readRet.ret_buf))
+  801e9e:	48 81 fa 00 10 00 00 	cmp    $0x1000,%rdx
+  801ea5:	0f 86 ea 00 00 00    	jbe    801f95 <devfile_read+0x112>
+    ssize_t readsz = 0;
+  801eab:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  801eb2:	00 
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801eb3:	49 bf 00 60 80 00 00 	movabs $0x806000,%r15
+  801eba:	00 00 00 
+  801ebd:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801ec1:	8b 40 0c             	mov    0xc(%rax),%eax
+  801ec4:	41 89 07             	mov    %eax,(%r15)
+        fsipcbuf.read.req_n = sizeof(fsipcbuf.readRet.ret_buf);
+  801ec7:	49 c7 47 08 00 10 00 	movq   $0x1000,0x8(%r15)
+  801ece:	00 
+        ssize_t res = fsipc(FSREQ_READ, NULL);
+  801ecf:	be 00 00 00 00       	mov    $0x0,%esi
+  801ed4:	bf 03 00 00 00       	mov    $0x3,%edi
+  801ed9:	48 b8 09 1c 80 00 00 	movabs $0x801c09,%rax
+  801ee0:	00 00 00 
+  801ee3:	ff d0                	call   *%rax
+  801ee5:	4c 63 e8             	movslq %eax,%r13
+        if (res < 0)
+  801ee8:	4d 85 ed             	test   %r13,%r13
+  801eeb:	0f 88 92 00 00 00    	js     801f83 <devfile_read+0x100>
+        memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  801ef1:	4c 89 ea             	mov    %r13,%rdx
+  801ef4:	4c 89 fe             	mov    %r15,%rsi
+  801ef7:	4c 89 f7             	mov    %r14,%rdi
+  801efa:	48 b8 51 0d 80 00 00 	movabs $0x800d51,%rax
+  801f01:	00 00 00 
+  801f04:	ff d0                	call   *%rax
+        if (res < sizeof(fsipcbuf.readRet.ret_buf))
+  801f06:	49 81 fd ff 0f 00 00 	cmp    $0xfff,%r13
+  801f0d:	76 6d                	jbe    801f7c <devfile_read+0xf9>
+        readsz += res;
+  801f0f:	4c 01 6d c0          	add    %r13,-0x40(%rbp)
+        buf += res;
+  801f13:	4d 01 ee             	add    %r13,%r14
+        n -= res;
+  801f16:	4d 29 ec             	sub    %r13,%r12
+    while (n > sizeof(fsipcbuf.readRet.ret_buf))
+  801f19:	49 81 fc 00 10 00 00 	cmp    $0x1000,%r12
+  801f20:	77 9b                	ja     801ebd <devfile_read+0x3a>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801f22:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  801f29:	00 00 00 
+  801f2c:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  801f30:	8b 51 0c             	mov    0xc(%rcx),%edx
+  801f33:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.read.req_n = n;
+  801f35:	4c 89 60 08          	mov    %r12,0x8(%rax)
+    ssize_t res = fsipc(FSREQ_READ, NULL);
+  801f39:	be 00 00 00 00       	mov    $0x0,%esi
+  801f3e:	bf 03 00 00 00       	mov    $0x3,%edi
+  801f43:	48 b8 09 1c 80 00 00 	movabs $0x801c09,%rax
+  801f4a:	00 00 00 
+  801f4d:	ff d0                	call   *%rax
+  801f4f:	4c 63 e8             	movslq %eax,%r13
+    if (res < 0)
+  801f52:	4d 85 ed             	test   %r13,%r13
+  801f55:	78 2c                	js     801f83 <devfile_read+0x100>
+    memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  801f57:	4c 89 ea             	mov    %r13,%rdx
+  801f5a:	48 be 00 60 80 00 00 	movabs $0x806000,%rsi
+  801f61:	00 00 00 
+  801f64:	4c 89 f7             	mov    %r14,%rdi
+  801f67:	48 b8 51 0d 80 00 00 	movabs $0x800d51,%rax
+  801f6e:	00 00 00 
+  801f71:	ff d0                	call   *%rax
+    readsz += res;
+  801f73:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  801f77:	49 01 c5             	add    %rax,%r13
+    return readsz;
+  801f7a:	eb 07                	jmp    801f83 <devfile_read+0x100>
+            return readsz + res;
+  801f7c:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  801f80:	49 01 c5             	add    %rax,%r13
+}
+  801f83:	4c 89 e8             	mov    %r13,%rax
+  801f86:	48 83 c4 18          	add    $0x18,%rsp
+  801f8a:	5b                   	pop    %rbx
+  801f8b:	41 5c                	pop    %r12
+  801f8d:	41 5d                	pop    %r13
+  801f8f:	41 5e                	pop    %r14
+  801f91:	41 5f                	pop    %r15
+  801f93:	5d                   	pop    %rbp
+  801f94:	c3                   	ret
+    ssize_t readsz = 0;
+  801f95:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  801f9c:	00 
+  801f9d:	eb 83                	jmp    801f22 <devfile_read+0x9f>
+
+0000000000801f9f <open>:
+open(const char *path, int mode) {
+  801f9f:	55                   	push   %rbp
+  801fa0:	48 89 e5             	mov    %rsp,%rbp
+  801fa3:	41 55                	push   %r13
+  801fa5:	41 54                	push   %r12
+  801fa7:	53                   	push   %rbx
+  801fa8:	48 83 ec 18          	sub    $0x18,%rsp
+  801fac:	49 89 fc             	mov    %rdi,%r12
+  801faf:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  801fb2:	48 b8 b2 0a 80 00 00 	movabs $0x800ab2,%rax
+  801fb9:	00 00 00 
+  801fbc:	ff d0                	call   *%rax
+  801fbe:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  801fc4:	0f 87 8a 00 00 00    	ja     802054 <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  801fca:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  801fce:	48 b8 82 15 80 00 00 	movabs $0x801582,%rax
+  801fd5:	00 00 00 
+  801fd8:	ff d0                	call   *%rax
+  801fda:	89 c3                	mov    %eax,%ebx
+  801fdc:	85 c0                	test   %eax,%eax
+  801fde:	78 50                	js     802030 <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  801fe0:	4c 89 e6             	mov    %r12,%rsi
+  801fe3:	48 bb 00 60 80 00 00 	movabs $0x806000,%rbx
+  801fea:	00 00 00 
+  801fed:	48 89 df             	mov    %rbx,%rdi
+  801ff0:	48 b8 f0 0a 80 00 00 	movabs $0x800af0,%rax
+  801ff7:	00 00 00 
+  801ffa:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  801ffc:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  802003:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802007:	bf 01 00 00 00       	mov    $0x1,%edi
+  80200c:	48 b8 09 1c 80 00 00 	movabs $0x801c09,%rax
+  802013:	00 00 00 
+  802016:	ff d0                	call   *%rax
+  802018:	89 c3                	mov    %eax,%ebx
+  80201a:	85 c0                	test   %eax,%eax
+  80201c:	78 1f                	js     80203d <open+0x9e>
+    return fd2num(fd);
+  80201e:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802022:	48 b8 db 14 80 00 00 	movabs $0x8014db,%rax
+  802029:	00 00 00 
+  80202c:	ff d0                	call   *%rax
+  80202e:	89 c3                	mov    %eax,%ebx
+}
+  802030:	89 d8                	mov    %ebx,%eax
+  802032:	48 83 c4 18          	add    $0x18,%rsp
+  802036:	5b                   	pop    %rbx
+  802037:	41 5c                	pop    %r12
+  802039:	41 5d                	pop    %r13
+  80203b:	5d                   	pop    %rbp
+  80203c:	c3                   	ret
+        fd_close(fd, 0);
+  80203d:	be 00 00 00 00       	mov    $0x0,%esi
+  802042:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802046:	48 b8 57 16 80 00 00 	movabs $0x801657,%rax
+  80204d:	00 00 00 
+  802050:	ff d0                	call   *%rax
+        return res;
+  802052:	eb dc                	jmp    802030 <open+0x91>
+        return -E_BAD_PATH;
+  802054:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  802059:	eb d5                	jmp    802030 <open+0x91>
+
+000000000080205b <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  80205b:	55                   	push   %rbp
+  80205c:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc(FSREQ_SYNC, NULL);
+  80205f:	be 00 00 00 00       	mov    $0x0,%esi
+  802064:	bf 08 00 00 00       	mov    $0x8,%edi
+  802069:	48 b8 09 1c 80 00 00 	movabs $0x801c09,%rax
+  802070:	00 00 00 
+  802073:	ff d0                	call   *%rax
+}
+  802075:	5d                   	pop    %rbp
+  802076:	c3                   	ret
+
+0000000000802077 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  802077:	55                   	push   %rbp
+  802078:	48 89 e5             	mov    %rsp,%rbp
+  80207b:	41 54                	push   %r12
+  80207d:	53                   	push   %rbx
+  80207e:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802081:	48 b8 ed 14 80 00 00 	movabs $0x8014ed,%rax
+  802088:	00 00 00 
+  80208b:	ff d0                	call   *%rax
+  80208d:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  802090:	48 be 00 33 80 00 00 	movabs $0x803300,%rsi
+  802097:	00 00 00 
+  80209a:	48 89 df             	mov    %rbx,%rdi
+  80209d:	48 b8 f0 0a 80 00 00 	movabs $0x800af0,%rax
+  8020a4:	00 00 00 
+  8020a7:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  8020a9:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  8020ae:	41 2b 04 24          	sub    (%r12),%eax
+  8020b2:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  8020b8:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8020bf:	00 00 00 
+    stat->st_dev = &devpipe;
+  8020c2:	48 b8 60 40 80 00 00 	movabs $0x804060,%rax
+  8020c9:	00 00 00 
+  8020cc:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  8020d3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020d8:	5b                   	pop    %rbx
+  8020d9:	41 5c                	pop    %r12
+  8020db:	5d                   	pop    %rbp
+  8020dc:	c3                   	ret
+
+00000000008020dd <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  8020dd:	55                   	push   %rbp
+  8020de:	48 89 e5             	mov    %rsp,%rbp
+  8020e1:	41 54                	push   %r12
+  8020e3:	53                   	push   %rbx
+  8020e4:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8020e7:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8020ec:	48 89 fe             	mov    %rdi,%rsi
+  8020ef:	bf 00 00 00 00       	mov    $0x0,%edi
+  8020f4:	49 bc 6c 11 80 00 00 	movabs $0x80116c,%r12
+  8020fb:	00 00 00 
+  8020fe:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  802101:	48 89 df             	mov    %rbx,%rdi
+  802104:	48 b8 ed 14 80 00 00 	movabs $0x8014ed,%rax
+  80210b:	00 00 00 
+  80210e:	ff d0                	call   *%rax
+  802110:	48 89 c6             	mov    %rax,%rsi
+  802113:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802118:	bf 00 00 00 00       	mov    $0x0,%edi
+  80211d:	41 ff d4             	call   *%r12
+}
+  802120:	5b                   	pop    %rbx
+  802121:	41 5c                	pop    %r12
+  802123:	5d                   	pop    %rbp
+  802124:	c3                   	ret
+
+0000000000802125 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  802125:	55                   	push   %rbp
+  802126:	48 89 e5             	mov    %rsp,%rbp
+  802129:	41 57                	push   %r15
+  80212b:	41 56                	push   %r14
+  80212d:	41 55                	push   %r13
+  80212f:	41 54                	push   %r12
+  802131:	53                   	push   %rbx
+  802132:	48 83 ec 18          	sub    $0x18,%rsp
+  802136:	49 89 fc             	mov    %rdi,%r12
+  802139:	49 89 f5             	mov    %rsi,%r13
+  80213c:	49 89 d7             	mov    %rdx,%r15
+  80213f:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802143:	48 b8 ed 14 80 00 00 	movabs $0x8014ed,%rax
+  80214a:	00 00 00 
+  80214d:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  80214f:	4d 85 ff             	test   %r15,%r15
+  802152:	0f 84 af 00 00 00    	je     802207 <devpipe_write+0xe2>
+  802158:	48 89 c3             	mov    %rax,%rbx
+  80215b:	4c 89 f8             	mov    %r15,%rax
+  80215e:	4d 89 ef             	mov    %r13,%r15
+  802161:	4c 01 e8             	add    %r13,%rax
+  802164:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802168:	49 bd 74 10 80 00 00 	movabs $0x801074,%r13
+  80216f:	00 00 00 
+            sys_yield();
+  802172:	49 be 11 10 80 00 00 	movabs $0x801011,%r14
+  802179:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  80217c:	8b 73 04             	mov    0x4(%rbx),%esi
+  80217f:	48 63 ce             	movslq %esi,%rcx
+  802182:	48 63 03             	movslq (%rbx),%rax
+  802185:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  80218b:	48 39 c1             	cmp    %rax,%rcx
+  80218e:	72 2e                	jb     8021be <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802190:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802195:	48 89 da             	mov    %rbx,%rdx
+  802198:	be 00 10 00 00       	mov    $0x1000,%esi
+  80219d:	4c 89 e7             	mov    %r12,%rdi
+  8021a0:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  8021a3:	85 c0                	test   %eax,%eax
+  8021a5:	74 66                	je     80220d <devpipe_write+0xe8>
+            sys_yield();
+  8021a7:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  8021aa:	8b 73 04             	mov    0x4(%rbx),%esi
+  8021ad:	48 63 ce             	movslq %esi,%rcx
+  8021b0:	48 63 03             	movslq (%rbx),%rax
+  8021b3:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  8021b9:	48 39 c1             	cmp    %rax,%rcx
+  8021bc:	73 d2                	jae    802190 <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8021be:	41 0f b6 3f          	movzbl (%r15),%edi
+  8021c2:	48 89 ca             	mov    %rcx,%rdx
+  8021c5:	48 c1 ea 03          	shr    $0x3,%rdx
+  8021c9:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  8021d0:	08 10 20 
+  8021d3:	48 f7 e2             	mul    %rdx
+  8021d6:	48 c1 ea 06          	shr    $0x6,%rdx
+  8021da:	48 89 d0             	mov    %rdx,%rax
+  8021dd:	48 c1 e0 09          	shl    $0x9,%rax
+  8021e1:	48 29 d0             	sub    %rdx,%rax
+  8021e4:	48 c1 e0 03          	shl    $0x3,%rax
+  8021e8:	48 29 c1             	sub    %rax,%rcx
+  8021eb:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  8021f0:	83 c6 01             	add    $0x1,%esi
+  8021f3:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8021f6:	49 83 c7 01          	add    $0x1,%r15
+  8021fa:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8021fe:	49 39 c7             	cmp    %rax,%r15
+  802201:	0f 85 75 ff ff ff    	jne    80217c <devpipe_write+0x57>
+    return n;
+  802207:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80220b:	eb 05                	jmp    802212 <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  80220d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802212:	48 83 c4 18          	add    $0x18,%rsp
+  802216:	5b                   	pop    %rbx
+  802217:	41 5c                	pop    %r12
+  802219:	41 5d                	pop    %r13
+  80221b:	41 5e                	pop    %r14
+  80221d:	41 5f                	pop    %r15
+  80221f:	5d                   	pop    %rbp
+  802220:	c3                   	ret
+
+0000000000802221 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  802221:	55                   	push   %rbp
+  802222:	48 89 e5             	mov    %rsp,%rbp
+  802225:	41 57                	push   %r15
+  802227:	41 56                	push   %r14
+  802229:	41 55                	push   %r13
+  80222b:	41 54                	push   %r12
+  80222d:	53                   	push   %rbx
+  80222e:	48 83 ec 18          	sub    $0x18,%rsp
+  802232:	49 89 fc             	mov    %rdi,%r12
+  802235:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  802239:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80223d:	48 b8 ed 14 80 00 00 	movabs $0x8014ed,%rax
+  802244:	00 00 00 
+  802247:	ff d0                	call   *%rax
+  802249:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  80224c:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802252:	49 bd 74 10 80 00 00 	movabs $0x801074,%r13
+  802259:	00 00 00 
+            sys_yield();
+  80225c:	49 be 11 10 80 00 00 	movabs $0x801011,%r14
+  802263:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  802266:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  80226b:	74 7d                	je     8022ea <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  80226d:	8b 03                	mov    (%rbx),%eax
+  80226f:	3b 43 04             	cmp    0x4(%rbx),%eax
+  802272:	75 26                	jne    80229a <devpipe_read+0x79>
+            if (i > 0) return i;
+  802274:	4d 85 ff             	test   %r15,%r15
+  802277:	75 77                	jne    8022f0 <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802279:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80227e:	48 89 da             	mov    %rbx,%rdx
+  802281:	be 00 10 00 00       	mov    $0x1000,%esi
+  802286:	4c 89 e7             	mov    %r12,%rdi
+  802289:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  80228c:	85 c0                	test   %eax,%eax
+  80228e:	74 72                	je     802302 <devpipe_read+0xe1>
+            sys_yield();
+  802290:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  802293:	8b 03                	mov    (%rbx),%eax
+  802295:	3b 43 04             	cmp    0x4(%rbx),%eax
+  802298:	74 df                	je     802279 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  80229a:	48 63 c8             	movslq %eax,%rcx
+  80229d:	48 89 ca             	mov    %rcx,%rdx
+  8022a0:	48 c1 ea 03          	shr    $0x3,%rdx
+  8022a4:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  8022ab:	08 10 20 
+  8022ae:	48 89 d0             	mov    %rdx,%rax
+  8022b1:	48 f7 e6             	mul    %rsi
+  8022b4:	48 c1 ea 06          	shr    $0x6,%rdx
+  8022b8:	48 89 d0             	mov    %rdx,%rax
+  8022bb:	48 c1 e0 09          	shl    $0x9,%rax
+  8022bf:	48 29 d0             	sub    %rdx,%rax
+  8022c2:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  8022c9:	00 
+  8022ca:	48 89 c8             	mov    %rcx,%rax
+  8022cd:	48 29 d0             	sub    %rdx,%rax
+  8022d0:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  8022d5:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8022d9:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  8022dd:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8022e0:	49 83 c7 01          	add    $0x1,%r15
+  8022e4:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  8022e8:	75 83                	jne    80226d <devpipe_read+0x4c>
+    return n;
+  8022ea:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8022ee:	eb 03                	jmp    8022f3 <devpipe_read+0xd2>
+            if (i > 0) return i;
+  8022f0:	4c 89 f8             	mov    %r15,%rax
+}
+  8022f3:	48 83 c4 18          	add    $0x18,%rsp
+  8022f7:	5b                   	pop    %rbx
+  8022f8:	41 5c                	pop    %r12
+  8022fa:	41 5d                	pop    %r13
+  8022fc:	41 5e                	pop    %r14
+  8022fe:	41 5f                	pop    %r15
+  802300:	5d                   	pop    %rbp
+  802301:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  802302:	b8 00 00 00 00       	mov    $0x0,%eax
+  802307:	eb ea                	jmp    8022f3 <devpipe_read+0xd2>
+
+0000000000802309 <pipe>:
+pipe(int pfd[2]) {
+  802309:	55                   	push   %rbp
+  80230a:	48 89 e5             	mov    %rsp,%rbp
+  80230d:	41 55                	push   %r13
+  80230f:	41 54                	push   %r12
+  802311:	53                   	push   %rbx
+  802312:	48 81 ec b8 00 00 00 	sub    $0xb8,%rsp
+  802319:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  80231c:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802320:	48 b8 82 15 80 00 00 	movabs $0x801582,%rax
+  802327:	00 00 00 
+  80232a:	ff d0                	call   *%rax
+  80232c:	89 c3                	mov    %eax,%ebx
+  80232e:	85 c0                	test   %eax,%eax
+  802330:	0f 88 51 01 00 00    	js     802487 <pipe+0x17e>
+        (res = fd_alloc_from(fd2num(fd0) + 1, &fd1)) < 0) goto err;
+  802336:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80233a:	48 b8 db 14 80 00 00 	movabs $0x8014db,%rax
+  802341:	00 00 00 
+  802344:	ff d0                	call   *%rax
+  802346:	8d 78 01             	lea    0x1(%rax),%edi
+  802349:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80234d:	48 b8 09 15 80 00 00 	movabs $0x801509,%rax
+  802354:	00 00 00 
+  802357:	ff d0                	call   *%rax
+  802359:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  80235b:	85 c0                	test   %eax,%eax
+  80235d:	0f 88 24 01 00 00    	js     802487 <pipe+0x17e>
+    va = fd2data(fd0);
+  802363:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802367:	48 bb ed 14 80 00 00 	movabs $0x8014ed,%rbx
+  80236e:	00 00 00 
+  802371:	ff d3                	call   *%rbx
+  802373:	49 89 c5             	mov    %rax,%r13
+    struct RegionOp ops[] = {
+  802376:	48 8d bd 30 ff ff ff 	lea    -0xd0(%rbp),%rdi
+  80237d:	b9 14 00 00 00       	mov    $0x14,%ecx
+  802382:	b8 00 00 00 00       	mov    $0x0,%eax
+  802387:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+  80238a:	c7 85 34 ff ff ff 46 	movl   $0x46,-0xcc(%rbp)
+  802391:	00 00 00 
+  802394:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802398:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+  80239f:	48 c7 85 50 ff ff ff 	movq   $0x1000,-0xb0(%rbp)
+  8023a6:	00 10 00 00 
+  8023aa:	c7 85 5c ff ff ff 46 	movl   $0x46,-0xa4(%rbp)
+  8023b1:	00 00 00 
+            {.type = REGION_ALLOC, .dstva = (uintptr_t)fd1, .size = PAGE_SIZE, .perm = PROT_RW | PROT_SHARE},
+  8023b4:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+    struct RegionOp ops[] = {
+  8023b8:	48 89 bd 70 ff ff ff 	mov    %rdi,-0x90(%rbp)
+  8023bf:	48 c7 85 78 ff ff ff 	movq   $0x1000,-0x88(%rbp)
+  8023c6:	00 10 00 00 
+  8023ca:	c7 45 84 46 00 00 00 	movl   $0x46,-0x7c(%rbp)
+  8023d1:	4c 89 6d 98          	mov    %r13,-0x68(%rbp)
+  8023d5:	48 c7 45 a0 00 10 00 	movq   $0x1000,-0x60(%rbp)
+  8023dc:	00 
+  8023dd:	c7 45 a8 01 00 00 00 	movl   $0x1,-0x58(%rbp)
+  8023e4:	c7 45 ac 46 00 00 00 	movl   $0x46,-0x54(%rbp)
+  8023eb:	4c 89 6d b8          	mov    %r13,-0x48(%rbp)
+            {.type = REGION_MAP, .srcva = (uintptr_t)va, .dstva = (uintptr_t)fd2data(fd1), .size = PAGE_SIZE, .perm = PROT_RW | PROT_SHARE},
+  8023ef:	ff d3                	call   *%rbx
+    struct RegionOp ops[] = {
+  8023f1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8023f5:	48 c7 45 c8 00 10 00 	movq   $0x1000,-0x38(%rbp)
+  8023fc:	00 
+    if ((res = sys_region_batch(ops, sizeof ops / sizeof *ops)) < 0) goto err1;
+  8023fd:	be 04 00 00 00       	mov    $0x4,%esi
+  802402:	48 8d bd 30 ff ff ff 	lea    -0xd0(%rbp),%rdi
+  802409:	48 b8 d3 11 80 00 00 	movabs $0x8011d3,%rax
+  802410:	00 00 00 
+  802413:	ff d0                	call   *%rax
+  802415:	89 c3                	mov    %eax,%ebx
+  802417:	85 c0                	test   %eax,%eax
+  802419:	0f 88 ad 00 00 00    	js     8024cc <pipe+0x1c3>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  80241f:	be 00 10 00 00       	mov    $0x1000,%esi
+  802424:	4c 89 ef             	mov    %r13,%rdi
+  802427:	48 b8 42 10 80 00 00 	movabs $0x801042,%rax
+  80242e:	00 00 00 
+  802431:	ff d0                	call   *%rax
+  802433:	83 f8 02             	cmp    $0x2,%eax
+  802436:	75 5f                	jne    802497 <pipe+0x18e>
+    fd0->fd_dev_id = devpipe.dev_id;
+  802438:	a1 60 40 80 00 00 00 	movabs 0x804060,%eax
+  80243f:	00 00 
+  802441:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802445:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  802447:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80244b:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  802452:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  802456:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  802458:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80245c:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  802463:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802467:	48 bb db 14 80 00 00 	movabs $0x8014db,%rbx
+  80246e:	00 00 00 
+  802471:	ff d3                	call   *%rbx
+  802473:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  802477:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  80247b:	ff d3                	call   *%rbx
+  80247d:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  802482:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  802487:	89 d8                	mov    %ebx,%eax
+  802489:	48 81 c4 b8 00 00 00 	add    $0xb8,%rsp
+  802490:	5b                   	pop    %rbx
+  802491:	41 5c                	pop    %r12
+  802493:	41 5d                	pop    %r13
+  802495:	5d                   	pop    %rbp
+  802496:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  802497:	48 b9 30 33 80 00 00 	movabs $0x803330,%rcx
+  80249e:	00 00 00 
+  8024a1:	48 ba 07 33 80 00 00 	movabs $0x803307,%rdx
+  8024a8:	00 00 00 
+  8024ab:	be 33 00 00 00       	mov    $0x33,%esi
+  8024b0:	48 bf 1c 33 80 00 00 	movabs $0x80331c,%rdi
+  8024b7:	00 00 00 
+  8024ba:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024bf:	49 b8 31 2a 80 00 00 	movabs $0x802a31,%r8
+  8024c6:	00 00 00 
+  8024c9:	41 ff d0             	call   *%r8
+        ops[i].type = REGION_UNMAP;
+  8024cc:	c7 85 30 ff ff ff 02 	movl   $0x2,-0xd0(%rbp)
+  8024d3:	00 00 00 
+  8024d6:	c7 85 58 ff ff ff 02 	movl   $0x2,-0xa8(%rbp)
+  8024dd:	00 00 00 
+  8024e0:	c7 45 80 02 00 00 00 	movl   $0x2,-0x80(%rbp)
+  8024e7:	c7 45 a8 02 00 00 00 	movl   $0x2,-0x58(%rbp)
+    sys_region_batch(ops, sizeof ops / sizeof *ops);
+  8024ee:	be 04 00 00 00       	mov    $0x4,%esi
+  8024f3:	48 8d bd 30 ff ff ff 	lea    -0xd0(%rbp),%rdi
+  8024fa:	48 b8 d3 11 80 00 00 	movabs $0x8011d3,%rax
+  802501:	00 00 00 
+  802504:	ff d0                	call   *%rax
+  802506:	e9 7c ff ff ff       	jmp    802487 <pipe+0x17e>
+
+000000000080250b <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  80250b:	55                   	push   %rbp
+  80250c:	48 89 e5             	mov    %rsp,%rbp
+  80250f:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  802513:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802517:	48 b8 9c 15 80 00 00 	movabs $0x80159c,%rax
+  80251e:	00 00 00 
+  802521:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802523:	85 c0                	test   %eax,%eax
+  802525:	78 35                	js     80255c <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  802527:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80252b:	48 b8 ed 14 80 00 00 	movabs $0x8014ed,%rax
+  802532:	00 00 00 
+  802535:	ff d0                	call   *%rax
+  802537:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80253a:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80253f:	be 00 10 00 00       	mov    $0x1000,%esi
+  802544:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802548:	48 b8 74 10 80 00 00 	movabs $0x801074,%rax
+  80254f:	00 00 00 
+  802552:	ff d0                	call   *%rax
+  802554:	85 c0                	test   %eax,%eax
+  802556:	0f 94 c0             	sete   %al
+  802559:	0f b6 c0             	movzbl %al,%eax
+}
+  80255c:	c9                   	leave
+  80255d:	c3                   	ret
+
+000000000080255e <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  80255e:	48 89 f8             	mov    %rdi,%rax
+  802561:	48 c1 e8 27          	shr    $0x27,%rax
+  802565:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  80256c:	01 00 00 
+  80256f:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802573:	f6 c2 01             	test   $0x1,%dl
+  802576:	74 6d                	je     8025e5 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  802578:	48 89 f8             	mov    %rdi,%rax
+  80257b:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80257f:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802586:	01 00 00 
+  802589:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80258d:	f6 c2 01             	test   $0x1,%dl
+  802590:	74 62                	je     8025f4 <get_uvpt_entry+0x96>
+  802592:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802599:	01 00 00 
+  80259c:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8025a0:	f6 c2 80             	test   $0x80,%dl
+  8025a3:	75 4f                	jne    8025f4 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8025a5:	48 89 f8             	mov    %rdi,%rax
+  8025a8:	48 c1 e8 15          	shr    $0x15,%rax
+  8025ac:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8025b3:	01 00 00 
+  8025b6:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8025ba:	f6 c2 01             	test   $0x1,%dl
+  8025bd:	74 44                	je     802603 <get_uvpt_entry+0xa5>
+  8025bf:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8025c6:	01 00 00 
+  8025c9:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8025cd:	f6 c2 80             	test   $0x80,%dl
+  8025d0:	75 31                	jne    802603 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  8025d2:	48 c1 ef 0c          	shr    $0xc,%rdi
+  8025d6:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8025dd:	01 00 00 
+  8025e0:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  8025e4:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8025e5:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  8025ec:	01 00 00 
+  8025ef:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8025f3:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8025f4:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8025fb:	01 00 00 
+  8025fe:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802602:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  802603:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  80260a:	01 00 00 
+  80260d:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802611:	c3                   	ret
+
+0000000000802612 <get_prot>:
+
+int
+get_prot(void *va) {
+  802612:	55                   	push   %rbp
+  802613:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  802616:	48 b8 5e 25 80 00 00 	movabs $0x80255e,%rax
+  80261d:	00 00 00 
+  802620:	ff d0                	call   *%rax
+  802622:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  802625:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  80262a:	89 c1                	mov    %eax,%ecx
+  80262c:	83 c9 04             	or     $0x4,%ecx
+  80262f:	f6 c2 01             	test   $0x1,%dl
+  802632:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  802635:	89 c1                	mov    %eax,%ecx
+  802637:	83 c9 02             	or     $0x2,%ecx
+  80263a:	f6 c2 02             	test   $0x2,%dl
+  80263d:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  802640:	89 c1                	mov    %eax,%ecx
+  802642:	83 c9 01             	or     $0x1,%ecx
+  802645:	48 85 d2             	test   %rdx,%rdx
+  802648:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  80264b:	89 c1                	mov    %eax,%ecx
+  80264d:	83 c9 40             	or     $0x40,%ecx
+  802650:	f6 c6 04             	test   $0x4,%dh
+  802653:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  802656:	5d                   	pop    %rbp
+  802657:	c3                   	ret
+
+0000000000802658 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  802658:	55                   	push   %rbp
+  802659:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  80265c:	48 b8 5e 25 80 00 00 	movabs $0x80255e,%rax
+  802663:	00 00 00 
+  802666:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  802668:	48 c1 e8 06          	shr    $0x6,%rax
+  80266c:	83 e0 01             	and    $0x1,%eax
+}
+  80266f:	5d                   	pop    %rbp
+  802670:	c3                   	ret
+
+0000000000802671 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  802671:	55                   	push   %rbp
+  802672:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  802675:	48 b8 5e 25 80 00 00 	movabs $0x80255e,%rax
+  80267c:	00 00 00 
+  80267f:	ff d0                	call   *%rax
+  802681:	83 e0 01             	and    $0x1,%eax
+}
+  802684:	5d                   	pop    %rbp
+  802685:	c3                   	ret
+
+0000000000802686 <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  802686:	55                   	push   %rbp
+  802687:	48 89 e5             	mov    %rsp,%rbp
+  80268a:	41 57                	push   %r15
+  80268c:	41 56                	push   %r14
+  80268e:	41 55                	push   %r13
+  802690:	41 54                	push   %r12
+  802692:	53                   	push   %rbx
+  802693:	48 83 ec 38          	sub    $0x38,%rsp
+  802697:	49 89 f7             	mov    %rsi,%r15
+  80269a:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+                    }
+                    continue;
+                }
+                for (int ptei = 0; ptei < PT_ENTRY_COUNT; ptei++) {
+                    uintptr_t pte_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, pdei, ptei, 0);
+                    pte_t pte = uvpt[VPT(pte_addr)];
+  8026a0:	49 bd 00 00 00 00 00 	movabs $0x10000000000,%r13
+  8026a7:	01 00 00 
+  8026aa:	4d 89 e6             	mov    %r12,%r14
+  8026ad:	49 89 fc             	mov    %rdi,%r12
+  8026b0:	e9 19 01 00 00       	jmp    8027ce <foreach_shared_region+0x148>
+  8026b5:	48 89 5d b0          	mov    %rbx,-0x50(%rbp)
+  8026b9:	4c 89 75 a8          	mov    %r14,-0x58(%rbp)
+  8026bd:	eb 52                	jmp    802711 <foreach_shared_region+0x8b>
+                for (int ptei = 0; ptei < PT_ENTRY_COUNT; ptei++) {
+  8026bf:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8026c6:	48 81 fb 00 00 20 00 	cmp    $0x200000,%rbx
+  8026cd:	74 2e                	je     8026fd <foreach_shared_region+0x77>
+                    uintptr_t pte_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, pdei, ptei, 0);
+  8026cf:	48 89 df             	mov    %rbx,%rdi
+  8026d2:	4c 09 f7             	or     %r14,%rdi
+                    pte_t pte = uvpt[VPT(pte_addr)];
+  8026d5:	48 89 f8             	mov    %rdi,%rax
+  8026d8:	48 c1 e8 0c          	shr    $0xc,%rax
+  8026dc:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+                    if ((pte & PTE_P) && (pte & PTE_SHARE)) {
+  8026e1:	25 01 04 00 00       	and    $0x401,%eax
+  8026e6:	48 3d 01 04 00 00    	cmp    $0x401,%rax
+  8026ec:	75 d1                	jne    8026bf <foreach_shared_region+0x39>
+                        fun((void*)pte_addr, (void*)(pte_addr + PAGE_SIZE), arg);
+  8026ee:	48 8d b7 00 10 00 00 	lea    0x1000(%rdi),%rsi
+  8026f5:	4c 89 fa             	mov    %r15,%rdx
+  8026f8:	41 ff d4             	call   *%r12
+  8026fb:	eb c2                	jmp    8026bf <foreach_shared_region+0x39>
+            for (int pdei = 0; pdei < PD_ENTRY_COUNT; pdei++) {
+  8026fd:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  802704:	00 
+  802705:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802709:	48 3d 00 00 00 40    	cmp    $0x40000000,%rax
+  80270f:	74 46                	je     802757 <foreach_shared_region+0xd1>
+                uintptr_t pde_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, pdei, 0, 0);
+  802711:	4c 8b 75 c8          	mov    -0x38(%rbp),%r14
+  802715:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802719:	49 09 c6             	or     %rax,%r14
+                pde_t pde = uvpd[VPD(pde_addr)];
+  80271c:	4c 89 f0             	mov    %r14,%rax
+  80271f:	48 c1 e8 15          	shr    $0x15,%rax
+  802723:	48 b9 00 00 00 80 00 	movabs $0x10080000000,%rcx
+  80272a:	01 00 00 
+  80272d:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+                if (!(pde & PTE_P)) {
+  802731:	a8 01                	test   $0x1,%al
+  802733:	74 c8                	je     8026fd <foreach_shared_region+0x77>
+                if (pde & PTE_PS) {
+  802735:	48 89 c3             	mov    %rax,%rbx
+  802738:	81 e3 80 00 00 00    	and    $0x80,%ebx
+  80273e:	74 8f                	je     8026cf <foreach_shared_region+0x49>
+                    if (pde & PTE_SHARE) {
+  802740:	f6 c4 04             	test   $0x4,%ah
+  802743:	74 b8                	je     8026fd <foreach_shared_region+0x77>
+                        fun((void*)pde_addr, (void*)(pde_addr + 1024 * 1024 * 2), arg);
+  802745:	49 8d b6 00 00 20 00 	lea    0x200000(%r14),%rsi
+  80274c:	4c 89 fa             	mov    %r15,%rdx
+  80274f:	4c 89 f7             	mov    %r14,%rdi
+  802752:	41 ff d4             	call   *%r12
+  802755:	eb a6                	jmp    8026fd <foreach_shared_region+0x77>
+  802757:	48 8b 5d b0          	mov    -0x50(%rbp),%rbx
+  80275b:	4c 8b 75 a8          	mov    -0x58(%rbp),%r14
+        for (int pdpei = 0; pdpei < PDP_ENTRY_COUNT; pdpei++) {
+  80275f:	48 81 c3 00 00 00 40 	add    $0x40000000,%rbx
+  802766:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80276d:	00 00 00 
+  802770:	48 39 c3             	cmp    %rax,%rbx
+  802773:	74 4c                	je     8027c1 <foreach_shared_region+0x13b>
+            uintptr_t pdpe_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, 0, 0, 0);
+  802775:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802779:	48 09 d8             	or     %rbx,%rax
+  80277c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+            pdpe_t pdpe = uvpdp[VPDP(pdpe_addr)];
+  802780:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802784:	48 b9 00 00 40 80 00 	movabs $0x10080400000,%rcx
+  80278b:	01 00 00 
+  80278e:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+            if (!(pdpe & PTE_P)) {
+  802792:	a8 01                	test   $0x1,%al
+  802794:	74 c9                	je     80275f <foreach_shared_region+0xd9>
+            if (pdpe & PTE_PS) {
+  802796:	48 89 c1             	mov    %rax,%rcx
+  802799:	81 e1 80 00 00 00    	and    $0x80,%ecx
+  80279f:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  8027a3:	0f 84 0c ff ff ff    	je     8026b5 <foreach_shared_region+0x2f>
+                if (pdpe & PTE_SHARE) {
+  8027a9:	f6 c4 04             	test   $0x4,%ah
+  8027ac:	74 b1                	je     80275f <foreach_shared_region+0xd9>
+                    fun((void*)pdpe_addr, (void*)(pdpe_addr + 1024 * 1024 * 1024), arg); 
+  8027ae:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  8027b2:	48 8d b7 00 00 00 40 	lea    0x40000000(%rdi),%rsi
+  8027b9:	4c 89 fa             	mov    %r15,%rdx
+  8027bc:	41 ff d4             	call   *%r12
+  8027bf:	eb 9e                	jmp    80275f <foreach_shared_region+0xd9>
+    for (int pml4ei = 0; pml4ei < PML4_ENTRY_COUNT; pml4ei++) {
+  8027c1:	49 83 c6 01          	add    $0x1,%r14
+  8027c5:	49 81 fe 00 02 00 00 	cmp    $0x200,%r14
+  8027cc:	74 24                	je     8027f2 <foreach_shared_region+0x16c>
+        pml4e_t pml4e = uvpml4[VPML4(pml4_addr)];
+  8027ce:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  8027d5:	01 00 00 
+  8027d8:	4a 8b 04 f0          	mov    (%rax,%r14,8),%rax
+        if (!(pml4e & PTE_P)) {
+  8027dc:	a8 01                	test   $0x1,%al
+  8027de:	74 e1                	je     8027c1 <foreach_shared_region+0x13b>
+  8027e0:	4c 89 f0             	mov    %r14,%rax
+  8027e3:	48 c1 e0 27          	shl    $0x27,%rax
+  8027e7:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8027eb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8027f0:	eb 83                	jmp    802775 <foreach_shared_region+0xef>
+            }
+        }
+    }
+    
+    return 0;
+}
+  8027f2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027f7:	48 83 c4 38          	add    $0x38,%rsp
+  8027fb:	5b                   	pop    %rbx
+  8027fc:	41 5c                	pop    %r12
+  8027fe:	41 5d                	pop    %r13
+  802800:	41 5e                	pop    %r14
+  802802:	41 5f                	pop    %r15
+  802804:	5d                   	pop    %rbp
+  802805:	c3                   	ret
+
+0000000000802806 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  802806:	b8 00 00 00 00       	mov    $0x0,%eax
+  80280b:	c3                   	ret
+
+000000000080280c <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  80280c:	55                   	push   %rbp
+  80280d:	48 89 e5             	mov    %rsp,%rbp
+  802810:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  802813:	48 be 54 33 80 00 00 	movabs $0x803354,%rsi
+  80281a:	00 00 00 
+  80281d:	48 b8 f0 0a 80 00 00 	movabs $0x800af0,%rax
+  802824:	00 00 00 
+  802827:	ff d0                	call   *%rax
+    return 0;
+}
+  802829:	b8 00 00 00 00       	mov    $0x0,%eax
+  80282e:	5d                   	pop    %rbp
+  80282f:	c3                   	ret
+
+0000000000802830 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  802830:	55                   	push   %rbp
+  802831:	48 89 e5             	mov    %rsp,%rbp
+  802834:	41 57                	push   %r15
+  802836:	41 56                	push   %r14
+  802838:	41 55                	push   %r13
+  80283a:	41 54                	push   %r12
+  80283c:	53                   	push   %rbx
+  80283d:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  802844:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  80284b:	48 85 d2             	test   %rdx,%rdx
+  80284e:	74 7a                	je     8028ca <devcons_write+0x9a>
+  802850:	49 89 d6             	mov    %rdx,%r14
+  802853:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802859:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  80285e:	49 bf ea 0c 80 00 00 	movabs $0x800cea,%r15
+  802865:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  802868:	4c 89 f3             	mov    %r14,%rbx
+  80286b:	48 29 f3             	sub    %rsi,%rbx
+  80286e:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802873:	48 39 c3             	cmp    %rax,%rbx
+  802876:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  80287a:	4c 63 eb             	movslq %ebx,%r13
+  80287d:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  802884:	48 01 c6             	add    %rax,%rsi
+  802887:	4c 89 ea             	mov    %r13,%rdx
+  80288a:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802891:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  802894:	4c 89 ee             	mov    %r13,%rsi
+  802897:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  80289e:	48 b8 17 0f 80 00 00 	movabs $0x800f17,%rax
+  8028a5:	00 00 00 
+  8028a8:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  8028aa:	41 01 dc             	add    %ebx,%r12d
+  8028ad:	49 63 f4             	movslq %r12d,%rsi
+  8028b0:	4c 39 f6             	cmp    %r14,%rsi
+  8028b3:	72 b3                	jb     802868 <devcons_write+0x38>
+    return res;
+  8028b5:	49 63 c4             	movslq %r12d,%rax
+}
+  8028b8:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  8028bf:	5b                   	pop    %rbx
+  8028c0:	41 5c                	pop    %r12
+  8028c2:	41 5d                	pop    %r13
+  8028c4:	41 5e                	pop    %r14
+  8028c6:	41 5f                	pop    %r15
+  8028c8:	5d                   	pop    %rbp
+  8028c9:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  8028ca:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8028d0:	eb e3                	jmp    8028b5 <devcons_write+0x85>
+
+00000000008028d2 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8028d2:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  8028d5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8028da:	48 85 c0             	test   %rax,%rax
+  8028dd:	74 55                	je     802934 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8028df:	55                   	push   %rbp
+  8028e0:	48 89 e5             	mov    %rsp,%rbp
+  8028e3:	41 55                	push   %r13
+  8028e5:	41 54                	push   %r12
+  8028e7:	53                   	push   %rbx
+  8028e8:	48 83 ec 08          	sub    $0x8,%rsp
+  8028ec:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  8028ef:	48 bb 44 0f 80 00 00 	movabs $0x800f44,%rbx
+  8028f6:	00 00 00 
+  8028f9:	49 bc 11 10 80 00 00 	movabs $0x801011,%r12
+  802900:	00 00 00 
+  802903:	eb 03                	jmp    802908 <devcons_read+0x36>
+  802905:	41 ff d4             	call   *%r12
+  802908:	ff d3                	call   *%rbx
+  80290a:	85 c0                	test   %eax,%eax
+  80290c:	74 f7                	je     802905 <devcons_read+0x33>
+    if (c < 0) return c;
+  80290e:	48 63 d0             	movslq %eax,%rdx
+  802911:	78 13                	js     802926 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  802913:	ba 00 00 00 00       	mov    $0x0,%edx
+  802918:	83 f8 04             	cmp    $0x4,%eax
+  80291b:	74 09                	je     802926 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  80291d:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  802921:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  802926:	48 89 d0             	mov    %rdx,%rax
+  802929:	48 83 c4 08          	add    $0x8,%rsp
+  80292d:	5b                   	pop    %rbx
+  80292e:	41 5c                	pop    %r12
+  802930:	41 5d                	pop    %r13
+  802932:	5d                   	pop    %rbp
+  802933:	c3                   	ret
+  802934:	48 89 d0             	mov    %rdx,%rax
+  802937:	c3                   	ret
+
+0000000000802938 <cputchar>:
+cputchar(int ch) {
+  802938:	55                   	push   %rbp
+  802939:	48 89 e5             	mov    %rsp,%rbp
+  80293c:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  802940:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  802944:	be 01 00 00 00       	mov    $0x1,%esi
+  802949:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  80294d:	48 b8 17 0f 80 00 00 	movabs $0x800f17,%rax
+  802954:	00 00 00 
+  802957:	ff d0                	call   *%rax
+}
+  802959:	c9                   	leave
+  80295a:	c3                   	ret
+
+000000000080295b <getchar>:
+getchar(void) {
+  80295b:	55                   	push   %rbp
+  80295c:	48 89 e5             	mov    %rsp,%rbp
+  80295f:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  802963:	ba 01 00 00 00       	mov    $0x1,%edx
+  802968:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  80296c:	bf 00 00 00 00       	mov    $0x0,%edi
+  802971:	48 b8 7f 18 80 00 00 	movabs $0x80187f,%rax
+  802978:	00 00 00 
+  80297b:	ff d0                	call   *%rax
+  80297d:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  80297f:	85 c0                	test   %eax,%eax
+  802981:	78 06                	js     802989 <getchar+0x2e>
+  802983:	74 08                	je     80298d <getchar+0x32>
+  802985:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  802989:	89 d0                	mov    %edx,%eax
+  80298b:	c9                   	leave
+  80298c:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  80298d:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  802992:	eb f5                	jmp    802989 <getchar+0x2e>
+
+0000000000802994 <iscons>:
+iscons(int fdnum) {
+  802994:	55                   	push   %rbp
+  802995:	48 89 e5             	mov    %rsp,%rbp
+  802998:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  80299c:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8029a0:	48 b8 9c 15 80 00 00 	movabs $0x80159c,%rax
+  8029a7:	00 00 00 
+  8029aa:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8029ac:	85 c0                	test   %eax,%eax
+  8029ae:	78 18                	js     8029c8 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  8029b0:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8029b4:	48 b8 a0 40 80 00 00 	movabs $0x8040a0,%rax
+  8029bb:	00 00 00 
+  8029be:	8b 00                	mov    (%rax),%eax
+  8029c0:	39 02                	cmp    %eax,(%rdx)
+  8029c2:	0f 94 c0             	sete   %al
+  8029c5:	0f b6 c0             	movzbl %al,%eax
+}
+  8029c8:	c9                   	leave
+  8029c9:	c3                   	ret
+
+00000000008029ca <opencons>:
+opencons(void) {
+  8029ca:	55                   	push   %rbp
+  8029cb:	48 89 e5             	mov    %rsp,%rbp
+  8029ce:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8029d2:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  8029d6:	48 b8 82 15 80 00 00 	movabs $0x801582,%rax
+  8029dd:	00 00 00 
+  8029e0:	ff d0                	call   *%rax
+  8029e2:	85 c0                	test   %eax,%eax
+  8029e4:	78 49                	js     802a2f <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  8029e6:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8029eb:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8029f0:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  8029f4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8029f9:	48 b8 a0 10 80 00 00 	movabs $0x8010a0,%rax
+  802a00:	00 00 00 
+  802a03:	ff d0                	call   *%rax
+  802a05:	85 c0                	test   %eax,%eax
+  802a07:	78 26                	js     802a2f <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  802a09:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802a0d:	a1 a0 40 80 00 00 00 	movabs 0x8040a0,%eax
+  802a14:	00 00 
+  802a16:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  802a18:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802a1c:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  802a23:	48 b8 db 14 80 00 00 	movabs $0x8014db,%rax
+  802a2a:	00 00 00 
+  802a2d:	ff d0                	call   *%rax
+}
+  802a2f:	c9                   	leave
+  802a30:	c3                   	ret
+
+0000000000802a31 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  802a31:	55                   	push   %rbp
+  802a32:	48 89 e5             	mov    %rsp,%rbp
+  802a35:	41 56                	push   %r14
+  802a37:	41 55                	push   %r13
+  802a39:	41 54                	push   %r12
+  802a3b:	53                   	push   %rbx
+  802a3c:	48 83 ec 50          	sub    $0x50,%rsp
+  802a40:	49 89 fc             	mov    %rdi,%r12
+  802a43:	41 89 f5             	mov    %esi,%r13d
+  802a46:	48 89 d3             	mov    %rdx,%rbx
+  802a49:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  802a4d:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  802a51:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  802a55:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  802a5c:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802a60:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  802a64:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  802a68:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  802a6c:	48 b8 00 40 80 00 00 	movabs $0x804000,%rax
+  802a73:	00 00 00 
+  802a76:	4c 8b 30             	mov    (%rax),%r14
+  802a79:	48 b8 e0 0f 80 00 00 	movabs $0x800fe0,%rax
+  802a80:	00 00 00 
+  802a83:	ff d0                	call   *%rax
+  802a85:	89 c6                	mov    %eax,%esi
+  802a87:	45 89 e8             	mov    %r13d,%r8d
+  802a8a:	4c 89 e1             	mov    %r12,%rcx
+  802a8d:	4c 89 f2             	mov    %r14,%rdx
+  802a90:	48 bf 60 33 80 00 00 	movabs $0x803360,%rdi
+  802a97:	00 00 00 
+  802a9a:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a9f:	49 bc cb 01 80 00 00 	movabs $0x8001cb,%r12
+  802aa6:	00 00 00 
+  802aa9:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  802aac:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  802ab0:	48 89 df             	mov    %rbx,%rdi
+  802ab3:	48 b8 67 01 80 00 00 	movabs $0x800167,%rax
+  802aba:	00 00 00 
+  802abd:	ff d0                	call   *%rax
+    cprintf("\n");
+  802abf:	48 bf bb 32 80 00 00 	movabs $0x8032bb,%rdi
+  802ac6:	00 00 00 
+  802ac9:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ace:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  802ad1:	cc                   	int3
+  802ad2:	eb fd                	jmp    802ad1 <_panic+0xa0>
+
+0000000000802ad4 <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  802ad4:	55                   	push   %rbp
+  802ad5:	48 89 e5             	mov    %rsp,%rbp
+  802ad8:	41 55                	push   %r13
+  802ada:	41 54                	push   %r12
+  802adc:	53                   	push   %rbx
+  802add:	48 83 ec 08          	sub    $0x8,%rsp
+  802ae1:	49 89 fc             	mov    %rdi,%r12
+  802ae4:	48 89 f7             	mov    %rsi,%rdi
+  802ae7:	48 89 d3             	mov    %rdx,%rbx
+  802aea:	49 89 cd             	mov    %rcx,%r13
+    // LAB 9: Your code here:
+    int res = sys_ipc_recv(!pg ? (void*)MAX_USER_ADDRESS : pg, !size ? 0 : *size);
+  802aed:	be 00 00 00 00       	mov    $0x0,%esi
+  802af2:	48 85 d2             	test   %rdx,%rdx
+  802af5:	74 03                	je     802afa <ipc_recv+0x26>
+  802af7:	48 8b 32             	mov    (%rdx),%rsi
+  802afa:	48 85 ff             	test   %rdi,%rdi
+  802afd:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802b04:	00 00 00 
+  802b07:	48 0f 44 f8          	cmove  %rax,%rdi
+  802b0b:	48 b8 72 14 80 00 00 	movabs $0x801472,%rax
+  802b12:	00 00 00 
+  802b15:	ff d0                	call   *%rax
+    if (res < 0) {
+  802b17:	85 c0                	test   %eax,%eax
+  802b19:	78 66                	js     802b81 <ipc_recv+0xad>
+        if (size) {
+            *size = 0;
+        }
+        return res;
+    }
+    if (from_env_store) {
+  802b1b:	4d 85 e4             	test   %r12,%r12
+  802b1e:	74 14                	je     802b34 <ipc_recv+0x60>
+        *from_env_store = thisenv->env_ipc_from;
+  802b20:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802b27:	00 00 00 
+  802b2a:	8b 80 ac 01 00 00    	mov    0x1ac(%rax),%eax
+  802b30:	41 89 04 24          	mov    %eax,(%r12)
+    }
+    if (perm_store) {
+  802b34:	4d 85 ed             	test   %r13,%r13
+  802b37:	74 14                	je     802b4d <ipc_recv+0x79>
+        *perm_store = thisenv->env_ipc_perm;
+  802b39:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802b40:	00 00 00 
+  802b43:	8b 80 b0 01 00 00    	mov    0x1b0(%rax),%eax
+  802b49:	41 89 45 00          	mov    %eax,0x0(%r13)
+    }
+    if (size) {
+  802b4d:	48 85 db             	test   %rbx,%rbx
+  802b50:	74 14                	je     802b66 <ipc_recv+0x92>
+        *size = thisenv->env_ipc_maxsz;
+  802b52:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802b59:	00 00 00 
+  802b5c:	48 8b 80 a0 01 00 00 	mov    0x1a0(%rax),%rax
+  802b63:	48 89 03             	mov    %rax,(%rbx)
+    }
+    return thisenv->env_ipc_value;
+  802b66:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802b6d:	00 00 00 
+  802b70:	8b 80 a8 01 00 00    	mov    0x1a8(%rax),%eax
+}
+  802b76:	48 83 c4 08          	add    $0x8,%rsp
+  802b7a:	5b                   	pop    %rbx
+  802b7b:	41 5c                	pop    %r12
+  802b7d:	41 5d                	pop    %r13
+  802b7f:	5d                   	pop    %rbp
+  802b80:	c3                   	ret
+        if (from_env_store) {
+  802b81:	4d 85 e4             	test   %r12,%r12
+  802b84:	74 08                	je     802b8e <ipc_recv+0xba>
+            *from_env_store = 0;
+  802b86:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  802b8d:	00 
+        if (perm_store) {
+  802b8e:	4d 85 ed             	test   %r13,%r13
+  802b91:	74 08                	je     802b9b <ipc_recv+0xc7>
+            *perm_store = 0;
+  802b93:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  802b9a:	00 
+        if (size) {
+  802b9b:	48 85 db             	test   %rbx,%rbx
+  802b9e:	74 d6                	je     802b76 <ipc_recv+0xa2>
+            *size = 0;
+  802ba0:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  802ba7:	eb cd                	jmp    802b76 <ipc_recv+0xa2>
+
+0000000000802ba9 <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  802ba9:	55                   	push   %rbp
+  802baa:	48 89 e5             	mov    %rsp,%rbp
+  802bad:	41 57                	push   %r15
+  802baf:	41 56                	push   %r14
+  802bb1:	41 55                	push   %r13
+  802bb3:	41 54                	push   %r12
+  802bb5:	53                   	push   %rbx
+  802bb6:	48 83 ec 18          	sub    $0x18,%rsp
+  802bba:	41 89 fd             	mov    %edi,%r13d
+  802bbd:	89 75 cc             	mov    %esi,-0x34(%rbp)
+  802bc0:	49 89 cc             	mov    %rcx,%r12
+  802bc3:	44 89 45 c8          	mov    %r8d,-0x38(%rbp)
+    // LAB 9: Your code here:
+    int res = 0;
+    while ((res = sys_ipc_try_send(to_env, val, !pg ? (void*)MAX_USER_ADDRESS : pg, size, perm)) < 0) {
+  802bc7:	48 85 d2             	test   %rdx,%rdx
+  802bca:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802bd1:	00 00 00 
+  802bd4:	48 0f 45 c2          	cmovne %rdx,%rax
+  802bd8:	48 89 c3             	mov    %rax,%rbx
+  802bdb:	49 be 46 14 80 00 00 	movabs $0x801446,%r14
+  802be2:	00 00 00 
+        if (res != -E_IPC_NOT_RECV) {
+            panic("sys_ipc_try_send failed: %i", res);
+        }
+        sys_yield();
+  802be5:	49 bf 11 10 80 00 00 	movabs $0x801011,%r15
+  802bec:	00 00 00 
+    while ((res = sys_ipc_try_send(to_env, val, !pg ? (void*)MAX_USER_ADDRESS : pg, size, perm)) < 0) {
+  802bef:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  802bf2:	44 8b 45 c8          	mov    -0x38(%rbp),%r8d
+  802bf6:	4c 89 e1             	mov    %r12,%rcx
+  802bf9:	48 89 da             	mov    %rbx,%rdx
+  802bfc:	44 89 ef             	mov    %r13d,%edi
+  802bff:	41 ff d6             	call   *%r14
+  802c02:	85 c0                	test   %eax,%eax
+  802c04:	79 37                	jns    802c3d <ipc_send+0x94>
+        if (res != -E_IPC_NOT_RECV) {
+  802c06:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  802c09:	75 05                	jne    802c10 <ipc_send+0x67>
+        sys_yield();
+  802c0b:	41 ff d7             	call   *%r15
+  802c0e:	eb df                	jmp    802bef <ipc_send+0x46>
+            panic("sys_ipc_try_send failed: %i", res);
+  802c10:	89 c1                	mov    %eax,%ecx
+  802c12:	48 ba 83 33 80 00 00 	movabs $0x803383,%rdx
+  802c19:	00 00 00 
+  802c1c:	be 40 00 00 00       	mov    $0x40,%esi
+  802c21:	48 bf 9f 33 80 00 00 	movabs $0x80339f,%rdi
+  802c28:	00 00 00 
+  802c2b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c30:	49 b8 31 2a 80 00 00 	movabs $0x802a31,%r8
+  802c37:	00 00 00 
+  802c3a:	41 ff d0             	call   *%r8
+    }
+    return;
+}
+  802c3d:	48 83 c4 18          	add    $0x18,%rsp
+  802c41:	5b                   	pop    %rbx
+  802c42:	41 5c                	pop    %r12
+  802c44:	41 5d                	pop    %r13
+  802c46:	41 5e                	pop    %r14
+  802c48:	41 5f                	pop    %r15
+  802c4a:	5d                   	pop    %rbp
+  802c4b:	c3                   	ret
+
+0000000000802c4c <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  802c4c:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  802c51:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  802c58:	00 00 00 
+  802c5b:	48 69 d0 d0 01 00 00 	imul   $0x1d0,%rax,%rdx
+  802c62:	48 01 ca             	add    %rcx,%rdx
+  802c65:	8b 92 e8 00 00 00    	mov    0xe8(%rdx),%edx
+  802c6b:	39 fa                	cmp    %edi,%edx
+  802c6d:	74 12                	je     802c81 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  802c6f:	48 83 c0 01          	add    $0x1,%rax
+  802c73:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  802c79:	75 e0                	jne    802c5b <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  802c7b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802c80:	c3                   	ret
+            return envs[i].env_id;
+  802c81:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+  802c88:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  802c8f:	00 00 00 
+  802c92:	48 01 d0             	add    %rdx,%rax
+  802c95:	8b 80 e0 00 00 00    	mov    0xe0(%rax),%eax
+  802c9b:	c3                   	ret
+  802c9c:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000802ca0 <__rodata_start>:
+  802ca0:	49 20 72 65          	rex.WB and %sil,0x65(%r10)
+  802ca4:	61                   	(bad)
+  802ca5:	64 20 25 30 38 78 20 	and    %ah,%fs:0x20783830(%rip)        # 20f864dc <__bss_end+0x2077e4dc>
+  802cac:	66 72 6f             	data16 jb 802d1e <__rodata_start+0x7e>
+  802caf:	6d                   	insl   (%dx),%es:(%rdi)
+  802cb0:	20 6c 6f 63          	and    %ch,0x63(%rdi,%rbp,2)
+  802cb4:	61                   	(bad)
+  802cb5:	74 69                	je     802d20 <__rodata_start+0x80>
+  802cb7:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802cb8:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802cb9:	20 30                	and    %dh,(%rax)
+  802cbb:	78 38                	js     802cf5 <__rodata_start+0x55>
+  802cbd:	30 34 30             	xor    %dh,(%rax,%rsi,1)
+  802cc0:	30 30                	xor    %dh,(%rax)
+  802cc2:	30 30                	xor    %dh,(%rax)
+  802cc4:	30 30                	xor    %dh,(%rax)
+  802cc6:	21 0a                	and    %ecx,(%rdx)
+  802cc8:	00 3c 75 6e 6b 6e 6f 	add    %bh,0x6f6e6b6e(,%rsi,2)
+  802ccf:	77 6e                	ja     802d3f <__rodata_start+0x9f>
+  802cd1:	3e 00 30             	ds add %dh,(%rax)
+  802cd4:	31 32                	xor    %esi,(%rdx)
+  802cd6:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  802cdd:	41                   	rex.B
+  802cde:	42                   	rex.X
+  802cdf:	43                   	rex.XB
+  802ce0:	44                   	rex.R
+  802ce1:	45                   	rex.RB
+  802ce2:	46 00 30             	rex.RX add %r14b,(%rax)
+  802ce5:	31 32                	xor    %esi,(%rdx)
+  802ce7:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  802cee:	61                   	(bad)
+  802cef:	62 63 64 65 66       	(bad)
+  802cf4:	00 28                	add    %ch,(%rax)
+  802cf6:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802cf7:	75 6c                	jne    802d65 <__rodata_start+0xc5>
+  802cf9:	6c                   	insb   (%dx),%es:(%rdi)
+  802cfa:	29 00                	sub    %eax,(%rax)
+  802cfc:	65 72 72             	gs jb  802d71 <__rodata_start+0xd1>
+  802cff:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802d00:	72 20                	jb     802d22 <__rodata_start+0x82>
+  802d02:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  802d07:	73 70                	jae    802d79 <__rodata_start+0xd9>
+  802d09:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  802d0d:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  802d14:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802d15:	72 00                	jb     802d17 <__rodata_start+0x77>
+  802d17:	62 61 64 20 65       	(bad)
+  802d1c:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802d1d:	76 69                	jbe    802d88 <__rodata_start+0xe8>
+  802d1f:	72 6f                	jb     802d90 <__rodata_start+0xf0>
+  802d21:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802d22:	6d                   	insl   (%dx),%es:(%rdi)
+  802d23:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  802d25:	74 00                	je     802d27 <__rodata_start+0x87>
+  802d27:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  802d2e:	20 70 61             	and    %dh,0x61(%rax)
+  802d31:	72 61                	jb     802d94 <__rodata_start+0xf4>
+  802d33:	6d                   	insl   (%dx),%es:(%rdi)
+  802d34:	65 74 65             	gs je  802d9c <__rodata_start+0xfc>
+  802d37:	72 00                	jb     802d39 <__rodata_start+0x99>
+  802d39:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802d3a:	75 74                	jne    802db0 <__rodata_start+0x110>
+  802d3c:	20 6f 66             	and    %ch,0x66(%rdi)
+  802d3f:	20 6d 65             	and    %ch,0x65(%rbp)
+  802d42:	6d                   	insl   (%dx),%es:(%rdi)
+  802d43:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802d44:	72 79                	jb     802dbf <__rodata_start+0x11f>
+  802d46:	00 6f 75             	add    %ch,0x75(%rdi)
+  802d49:	74 20                	je     802d6b <__rodata_start+0xcb>
+  802d4b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802d4c:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  802d50:	76 69                	jbe    802dbb <__rodata_start+0x11b>
+  802d52:	72 6f                	jb     802dc3 <__rodata_start+0x123>
+  802d54:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802d55:	6d                   	insl   (%dx),%es:(%rdi)
+  802d56:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  802d58:	74 73                	je     802dcd <__rodata_start+0x12d>
+  802d5a:	00 63 6f             	add    %ah,0x6f(%rbx)
+  802d5d:	72 72                	jb     802dd1 <__rodata_start+0x131>
+  802d5f:	75 70                	jne    802dd1 <__rodata_start+0x131>
+  802d61:	74 65                	je     802dc8 <__rodata_start+0x128>
+  802d63:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  802d68:	75 67                	jne    802dd1 <__rodata_start+0x131>
+  802d6a:	20 69 6e             	and    %ch,0x6e(%rcx)
+  802d6d:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  802d6f:	00 73 65             	add    %dh,0x65(%rbx)
+  802d72:	67 6d                	insl   (%dx),%es:(%edi)
+  802d74:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  802d76:	74 61                	je     802dd9 <__rodata_start+0x139>
+  802d78:	74 69                	je     802de3 <__rodata_start+0x143>
+  802d7a:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802d7b:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802d7c:	20 66 61             	and    %ah,0x61(%rsi)
+  802d7f:	75 6c                	jne    802ded <__rodata_start+0x14d>
+  802d81:	74 00                	je     802d83 <__rodata_start+0xe3>
+  802d83:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  802d8a:	20 45 4c             	and    %al,0x4c(%rbp)
+  802d8d:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  802d91:	61                   	(bad)
+  802d92:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  802d97:	20 73 75             	and    %dh,0x75(%rbx)
+  802d9a:	63 68 20             	movsxd 0x20(%rax),%ebp
+  802d9d:	73 79                	jae    802e18 <__rodata_start+0x178>
+  802d9f:	73 74                	jae    802e15 <__rodata_start+0x175>
+  802da1:	65 6d                	gs insl (%dx),%es:(%rdi)
+  802da3:	20 63 61             	and    %ah,0x61(%rbx)
+  802da6:	6c                   	insb   (%dx),%es:(%rdi)
+  802da7:	6c                   	insb   (%dx),%es:(%rdi)
+  802da8:	00 65 6e             	add    %ah,0x6e(%rbp)
+  802dab:	74 72                	je     802e1f <__rodata_start+0x17f>
+  802dad:	79 20                	jns    802dcf <__rodata_start+0x12f>
+  802daf:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802db0:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802db1:	74 20                	je     802dd3 <__rodata_start+0x133>
+  802db3:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  802db5:	75 6e                	jne    802e25 <__rodata_start+0x185>
+  802db7:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  802dbb:	76 20                	jbe    802ddd <__rodata_start+0x13d>
+  802dbd:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  802dc4:	72 65                	jb     802e2b <__rodata_start+0x18b>
+  802dc6:	63 76 69             	movsxd 0x69(%rsi),%esi
+  802dc9:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802dca:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  802dce:	65 78 70             	gs js  802e41 <__rodata_start+0x1a1>
+  802dd1:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  802dd6:	20 65 6e             	and    %ah,0x6e(%rbp)
+  802dd9:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  802ddd:	20 66 69             	and    %ah,0x69(%rsi)
+  802de0:	6c                   	insb   (%dx),%es:(%rdi)
+  802de1:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  802de5:	20 66 72             	and    %ah,0x72(%rsi)
+  802de8:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  802ded:	61                   	(bad)
+  802dee:	63 65 20             	movsxd 0x20(%rbp),%esp
+  802df1:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802df2:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802df3:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  802df7:	6b 00 74             	imul   $0x74,(%rax),%eax
+  802dfa:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802dfb:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802dfc:	20 6d 61             	and    %ch,0x61(%rbp)
+  802dff:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802e00:	79 20                	jns    802e22 <__rodata_start+0x182>
+  802e02:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  802e09:	72 65                	jb     802e70 <__rodata_start+0x1d0>
+  802e0b:	20 6f 70             	and    %ch,0x70(%rdi)
+  802e0e:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  802e10:	00 66 69             	add    %ah,0x69(%rsi)
+  802e13:	6c                   	insb   (%dx),%es:(%rdi)
+  802e14:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  802e18:	20 62 6c             	and    %ah,0x6c(%rdx)
+  802e1b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802e1c:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  802e1f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802e20:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802e21:	74 20                	je     802e43 <__rodata_start+0x1a3>
+  802e23:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  802e25:	75 6e                	jne    802e95 <__rodata_start+0x1f5>
+  802e27:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  802e2b:	76 61                	jbe    802e8e <__rodata_start+0x1ee>
+  802e2d:	6c                   	insb   (%dx),%es:(%rdi)
+  802e2e:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  802e35:	00 
+  802e36:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  802e3d:	72 65                	jb     802ea4 <__rodata_start+0x204>
+  802e3f:	61                   	(bad)
+  802e40:	64 79 20             	fs jns 802e63 <__rodata_start+0x1c3>
+  802e43:	65 78 69             	gs js  802eaf <__rodata_start+0x20f>
+  802e46:	73 74                	jae    802ebc <__rodata_start+0x21c>
+  802e48:	73 00                	jae    802e4a <__rodata_start+0x1aa>
+  802e4a:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802e4b:	70 65                	jo     802eb2 <__rodata_start+0x212>
+  802e4d:	72 61                	jb     802eb0 <__rodata_start+0x210>
+  802e4f:	74 69                	je     802eba <__rodata_start+0x21a>
+  802e51:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802e52:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802e53:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  802e56:	74 20                	je     802e78 <__rodata_start+0x1d8>
+  802e58:	73 75                	jae    802ecf <__rodata_start+0x22f>
+  802e5a:	70 70                	jo     802ecc <__rodata_start+0x22c>
+  802e5c:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802e5d:	72 74                	jb     802ed3 <__rodata_start+0x233>
+  802e5f:	65 64 00 6f 70       	gs add %ch,%fs:0x70(%rdi)
+  802e64:	65 72 61             	gs jb  802ec8 <__rodata_start+0x228>
+  802e67:	74 69                	je     802ed2 <__rodata_start+0x232>
+  802e69:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802e6a:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802e6b:	20 69 6e             	and    %ch,0x6e(%rcx)
+  802e6e:	74 65                	je     802ed5 <__rodata_start+0x235>
+  802e70:	72 72                	jb     802ee4 <__rodata_start+0x244>
+  802e72:	75 70                	jne    802ee4 <__rodata_start+0x244>
+  802e74:	74 65                	je     802edb <__rodata_start+0x23b>
+  802e76:	64 00 6e 6f          	add    %ch,%fs:0x6f(%rsi)
+  802e7a:	74 20                	je     802e9c <__rodata_start+0x1fc>
+  802e7c:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  802e7e:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802e7f:	75 67                	jne    802ee8 <__rodata_start+0x248>
+  802e81:	68 20 43 50 55       	push   $0x55504320
+  802e86:	20 74 69 6d          	and    %dh,0x6d(%rcx,%rbp,2)
+  802e8a:	65 00 66 2e          	add    %ah,%gs:0x2e(%rsi)
+  802e8e:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+  802e95:	00 
+  802e96:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  802e9d:	00 00 00 
+  802ea0:	b8 03 80 00 00       	mov    $0x8003,%eax
+  802ea5:	00 00                	add    %al,(%rax)
+  802ea7:	00 f9                	add    %bh,%cl
+  802ea9:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802eaf:	00 e9                	add    %ch,%cl
+  802eb1:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802eb7:	00 f9                	add    %bh,%cl
+  802eb9:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802ebf:	00 f9                	add    %bh,%cl
+  802ec1:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802ec7:	00 f9                	add    %bh,%cl
+  802ec9:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802ecf:	00 f9                	add    %bh,%cl
+  802ed1:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802ed7:	00 d7                	add    %dl,%bh
+  802ed9:	03 80 00 00 00 00    	add    0x0(%rax),%eax
+  802edf:	00 f9                	add    %bh,%cl
+  802ee1:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802ee7:	00 f9                	add    %bh,%cl
+  802ee9:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802eef:	00 cb                	add    %cl,%bl
+  802ef1:	03 80 00 00 00 00    	add    0x0(%rax),%eax
+  802ef7:	00 45 04             	add    %al,0x4(%rbp)
+  802efa:	80 00 00             	addb   $0x0,(%rax)
+  802efd:	00 00                	add    %al,(%rax)
+  802eff:	00 f9                	add    %bh,%cl
+  802f01:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802f07:	00 cb                	add    %cl,%bl
+  802f09:	03 80 00 00 00 00    	add    0x0(%rax),%eax
+  802f0f:	00 11                	add    %dl,(%rcx)
+  802f11:	04 80                	add    $0x80,%al
+  802f13:	00 00                	add    %al,(%rax)
+  802f15:	00 00                	add    %al,(%rax)
+  802f17:	00 11                	add    %dl,(%rcx)
+  802f19:	04 80                	add    $0x80,%al
+  802f1b:	00 00                	add    %al,(%rax)
+  802f1d:	00 00                	add    %al,(%rax)
+  802f1f:	00 11                	add    %dl,(%rcx)
+  802f21:	04 80                	add    $0x80,%al
+  802f23:	00 00                	add    %al,(%rax)
+  802f25:	00 00                	add    %al,(%rax)
+  802f27:	00 11                	add    %dl,(%rcx)
+  802f29:	04 80                	add    $0x80,%al
+  802f2b:	00 00                	add    %al,(%rax)
+  802f2d:	00 00                	add    %al,(%rax)
+  802f2f:	00 11                	add    %dl,(%rcx)
+  802f31:	04 80                	add    $0x80,%al
+  802f33:	00 00                	add    %al,(%rax)
+  802f35:	00 00                	add    %al,(%rax)
+  802f37:	00 11                	add    %dl,(%rcx)
+  802f39:	04 80                	add    $0x80,%al
+  802f3b:	00 00                	add    %al,(%rax)
+  802f3d:	00 00                	add    %al,(%rax)
+  802f3f:	00 11                	add    %dl,(%rcx)
+  802f41:	04 80                	add    $0x80,%al
+  802f43:	00 00                	add    %al,(%rax)
+  802f45:	00 00                	add    %al,(%rax)
+  802f47:	00 11                	add    %dl,(%rcx)
+  802f49:	04 80                	add    $0x80,%al
+  802f4b:	00 00                	add    %al,(%rax)
+  802f4d:	00 00                	add    %al,(%rax)
+  802f4f:	00 11                	add    %dl,(%rcx)
+  802f51:	04 80                	add    $0x80,%al
+  802f53:	00 00                	add    %al,(%rax)
+  802f55:	00 00                	add    %al,(%rax)
+  802f57:	00 f9                	add    %bh,%cl
+  802f59:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802f5f:	00 f9                	add    %bh,%cl
+  802f61:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802f67:	00 f9                	add    %bh,%cl
+  802f69:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802f6f:	00 f9                	add    %bh,%cl
+  802f71:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802f77:	00 f9                	add    %bh,%cl
+  802f79:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802f7f:	00 f9                	add    %bh,%cl
+  802f81:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802f87:	00 f9                	add    %bh,%cl
+  802f89:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802f8f:	00 f9                	add    %bh,%cl
+  802f91:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802f97:	00 f9                	add    %bh,%cl
+  802f99:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802f9f:	00 f9                	add    %bh,%cl
+  802fa1:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802fa7:	00 f9                	add    %bh,%cl
+  802fa9:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802faf:	00 f9                	add    %bh,%cl
+  802fb1:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802fb7:	00 f9                	add    %bh,%cl
+  802fb9:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802fbf:	00 f9                	add    %bh,%cl
+  802fc1:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802fc7:	00 f9                	add    %bh,%cl
+  802fc9:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802fcf:	00 f9                	add    %bh,%cl
+  802fd1:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802fd7:	00 f9                	add    %bh,%cl
+  802fd9:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802fdf:	00 f9                	add    %bh,%cl
+  802fe1:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802fe7:	00 f9                	add    %bh,%cl
+  802fe9:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802fef:	00 f9                	add    %bh,%cl
+  802ff1:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802ff7:	00 f9                	add    %bh,%cl
+  802ff9:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802fff:	00 f9                	add    %bh,%cl
+  803001:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803007:	00 f9                	add    %bh,%cl
+  803009:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  80300f:	00 f9                	add    %bh,%cl
+  803011:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803017:	00 f9                	add    %bh,%cl
+  803019:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  80301f:	00 f9                	add    %bh,%cl
+  803021:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803027:	00 f9                	add    %bh,%cl
+  803029:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  80302f:	00 f9                	add    %bh,%cl
+  803031:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803037:	00 f9                	add    %bh,%cl
+  803039:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  80303f:	00 f9                	add    %bh,%cl
+  803041:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803047:	00 1c 09             	add    %bl,(%rcx,%rcx,1)
+  80304a:	80 00 00             	addb   $0x0,(%rax)
+  80304d:	00 00                	add    %al,(%rax)
+  80304f:	00 f9                	add    %bh,%cl
+  803051:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803057:	00 f9                	add    %bh,%cl
+  803059:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  80305f:	00 f9                	add    %bh,%cl
+  803061:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803067:	00 f9                	add    %bh,%cl
+  803069:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  80306f:	00 f9                	add    %bh,%cl
+  803071:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803077:	00 f9                	add    %bh,%cl
+  803079:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  80307f:	00 f9                	add    %bh,%cl
+  803081:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803087:	00 f9                	add    %bh,%cl
+  803089:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  80308f:	00 f9                	add    %bh,%cl
+  803091:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803097:	00 f9                	add    %bh,%cl
+  803099:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  80309f:	00 68 04             	add    %ch,0x4(%rax)
+  8030a2:	80 00 00             	addb   $0x0,(%rax)
+  8030a5:	00 00                	add    %al,(%rax)
+  8030a7:	00 37                	add    %dh,(%rdi)
+  8030a9:	06                   	(bad)
+  8030aa:	80 00 00             	addb   $0x0,(%rax)
+  8030ad:	00 00                	add    %al,(%rax)
+  8030af:	00 f9                	add    %bh,%cl
+  8030b1:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  8030b7:	00 f9                	add    %bh,%cl
+  8030b9:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  8030bf:	00 f9                	add    %bh,%cl
+  8030c1:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  8030c7:	00 f9                	add    %bh,%cl
+  8030c9:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  8030cf:	00 97 04 80 00 00    	add    %dl,0x8004(%rdi)
+  8030d5:	00 00                	add    %al,(%rax)
+  8030d7:	00 f9                	add    %bh,%cl
+  8030d9:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  8030df:	00 f9                	add    %bh,%cl
+  8030e1:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  8030e7:	00 5d 04             	add    %bl,0x4(%rbp)
+  8030ea:	80 00 00             	addb   $0x0,(%rax)
+  8030ed:	00 00                	add    %al,(%rax)
+  8030ef:	00 f9                	add    %bh,%cl
+  8030f1:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  8030f7:	00 f9                	add    %bh,%cl
+  8030f9:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  8030ff:	00 df                	add    %bl,%bh
+  803101:	07                   	(bad)
+  803102:	80 00 00             	addb   $0x0,(%rax)
+  803105:	00 00                	add    %al,(%rax)
+  803107:	00 a9 08 80 00 00    	add    %ch,0x8008(%rcx)
+  80310d:	00 00                	add    %al,(%rax)
+  80310f:	00 f9                	add    %bh,%cl
+  803111:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803117:	00 f9                	add    %bh,%cl
+  803119:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  80311f:	00 2e                	add    %ch,(%rsi)
+  803121:	05 80 00 00 00       	add    $0x80,%eax
+  803126:	00 00                	add    %al,(%rax)
+  803128:	f9                   	stc
+  803129:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  80312f:	00 0b                	add    %cl,(%rbx)
+  803131:	07                   	(bad)
+  803132:	80 00 00             	addb   $0x0,(%rax)
+  803135:	00 00                	add    %al,(%rax)
+  803137:	00 f9                	add    %bh,%cl
+  803139:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  80313f:	00 f9                	add    %bh,%cl
+  803141:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803147:	00 1c 09             	add    %bl,(%rcx,%rcx,1)
+  80314a:	80 00 00             	addb   $0x0,(%rax)
+  80314d:	00 00                	add    %al,(%rax)
+  80314f:	00 f9                	add    %bh,%cl
+  803151:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803157:	00 c1                	add    %al,%cl
+  803159:	03 80 00 00 00 00    	add    0x0(%rax),%eax
+	...
+
+0000000000803160 <error_string>:
+	...
+  803168:	05 2d 80 00 00 00 00 00 17 2d 80 00 00 00 00 00     .-.......-......
+  803178:	27 2d 80 00 00 00 00 00 39 2d 80 00 00 00 00 00     '-......9-......
+  803188:	47 2d 80 00 00 00 00 00 5b 2d 80 00 00 00 00 00     G-......[-......
+  803198:	70 2d 80 00 00 00 00 00 83 2d 80 00 00 00 00 00     p-.......-......
+  8031a8:	95 2d 80 00 00 00 00 00 a9 2d 80 00 00 00 00 00     .-.......-......
+  8031b8:	b9 2d 80 00 00 00 00 00 cc 2d 80 00 00 00 00 00     .-.......-......
+  8031c8:	e3 2d 80 00 00 00 00 00 f9 2d 80 00 00 00 00 00     .-.......-......
+  8031d8:	11 2e 80 00 00 00 00 00 29 2e 80 00 00 00 00 00     ........).......
+  8031e8:	36 2e 80 00 00 00 00 00 10 32 80 00 00 00 00 00     6........2......
+  8031f8:	4a 2e 80 00 00 00 00 00 62 2e 80 00 00 00 00 00     J.......b.......
+  803208:	78 2e 80 00 00 00 00 00 66 69 6c 65 20 69 73 20     x.......file is 
+  803218:	6e 6f 74 20 61 20 76 61 6c 69 64 20 65 78 65 63     not a valid exec
+  803228:	75 74 61 62 6c 65 00 90 73 79 73 63 61 6c 6c 20     utable..syscall 
+  803238:	25 7a 64 20 72 65 74 75 72 6e 65 64 20 25 7a 64     %zd returned %zd
+  803248:	20 28 3e 20 30 29 00 6c 69 62 2f 73 79 73 63 61      (> 0).lib/sysca
+  803258:	6c 6c 2e 63 00 0f 1f 00 5b 25 30 38 78 5d 20 75     ll.c....[%08x] u
+  803268:	6e 6b 6e 6f 77 6e 20 64 65 76 69 63 65 20 74 79     nknown device ty
+  803278:	70 65 20 25 64 0a 00 00 5b 25 30 38 78 5d 20 66     pe %d...[%08x] f
+  803288:	74 72 75 6e 63 61 74 65 20 25 64 20 2d 2d 20 62     truncate %d -- b
+  803298:	61 64 20 6d 6f 64 65 0a 00 5b 25 30 38 78 5d 20     ad mode..[%08x] 
+  8032a8:	72 65 61 64 20 25 64 20 2d 2d 20 62 61 64 20 6d     read %d -- bad m
+  8032b8:	6f 64 65 0a 00 5b 25 30 38 78 5d 20 77 72 69 74     ode..[%08x] writ
+  8032c8:	65 20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65     e %d -- bad mode
+  8032d8:	0a 00 66 0f 1f 44 00 00                             ..f..D..
+
+00000000008032e0 <devtab>:
+  8032e0:	20 40 80 00 00 00 00 00 60 40 80 00 00 00 00 00      @......`@......
+  8032f0:	a0 40 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .@..............
+  803300:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  803310:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  803320:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  803330:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  803340:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  803350:	3d 20 32 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73 00     = 2.<cons>.cons.
+  803360:	5b 25 30 38 78 5d 20 75 73 65 72 20 70 61 6e 69     [%08x] user pani
+  803370:	63 20 69 6e 20 25 73 20 61 74 20 25 73 3a 25 64     c in %s at %s:%d
+  803380:	3a 20 00 73 79 73 5f 69 70 63 5f 74 72 79 5f 73     : .sys_ipc_try_s
+  803390:	65 6e 64 20 66 61 69 6c 65 64 3a 20 25 69 00 6c     end failed: %i.l
+  8033a0:	69 62 2f 69 70 63 2e 63 00 66 2e 0f 1f 84 00 00     ib/ipc.c.f......
+  8033b0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8033c0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8033d0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8033e0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8033f0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803400:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803410:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803420:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803430:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803440:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803450:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803460:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803470:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803480:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803490:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8034a0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8034b0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8034c0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8034d0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8034e0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8034f0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803500:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803510:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803520:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803530:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803540:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803550:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803560:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803570:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803580:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803590:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8035a0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8035b0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8035c0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8035d0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8035e0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8035f0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803600:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803610:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803620:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803630:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803640:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803650:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803660:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803670:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803680:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803690:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8036a0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8036b0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8036c0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8036d0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8036e0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8036f0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803700:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803710:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803720:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803730:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803740:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803750:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803760:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803770:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803780:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803790:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8037a0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8037b0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8037c0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8037d0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8037e0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8037f0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803800:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803810:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803820:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803830:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803840:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803850:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803860:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803870:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803880:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803890:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8038a0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8038b0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8038c0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8038d0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8038e0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8038f0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803900:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803910:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803920:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803930:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803940:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803950:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803960:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803970:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803980:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803990:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8039a0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8039b0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8039c0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8039d0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8039e0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8039f0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803a00:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803a10:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803a20:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803a30:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803a40:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803a50:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803a60:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803a70:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803a80:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803a90:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803aa0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803ab0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803ac0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803ad0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803ae0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803af0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803b00:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803b10:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803b20:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803b30:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803b40:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803b50:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803b60:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803b70:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803b80:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803b90:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803ba0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803bb0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803bc0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803bd0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803be0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803bf0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803c00:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803c10:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803c20:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803c30:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803c40:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803c50:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803c60:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803c70:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803c80:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803c90:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803ca0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803cb0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803cc0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803cd0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803ce0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803cf0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803d00:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803d10:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803d20:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803d30:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803d40:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803d50:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803d60:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803d70:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803d80:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803d90:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803da0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803db0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803dc0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803dd0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803de0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803df0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803e00:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803e10:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803e20:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803e30:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803e40:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803e50:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803e60:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803e70:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803e80:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803e90:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803ea0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803eb0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803ec0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803ed0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803ee0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803ef0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803f00:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803f10:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803f20:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803f30:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803f40:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803f50:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803f60:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803f70:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803f80:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803f90:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803fa0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803fb0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803fc0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803fd0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803fe0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803ff0:	1f 84 00 00 00 00 00 66 0f 1f 84 00 00 00 00 00     .......f........
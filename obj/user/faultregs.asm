@@ -0,0 +1,7106 @@
+
+obj/user/faultregs:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 ba 0c 00 00       	call   800cdd <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <check_regs>:
+
+static struct regs before, during, after;
+
+static void
+check_regs(struct regs *a, const char *an, struct regs *b, const char *bn,
+           const char *testname) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 57                	push   %r15
+  80002b:	41 56                	push   %r14
+  80002d:	41 55                	push   %r13
+  80002f:	41 54                	push   %r12
+  800031:	53                   	push   %rbx
+  800032:	48 83 ec 08          	sub    $0x8,%rsp
+  800036:	49 89 fc             	mov    %rdi,%r12
+  800039:	48 89 d3             	mov    %rdx,%rbx
+  80003c:	4d 89 c6             	mov    %r8,%r14
+    int mismatch = 0;
+
+    cprintf("%-6s %-8s %-8s\n", "", an, bn);
+  80003f:	48 89 f2             	mov    %rsi,%rdx
+  800042:	48 be 3b 3c 80 00 00 	movabs $0x803c3b,%rsi
+  800049:	00 00 00 
+  80004c:	48 bf 08 3c 80 00 00 	movabs $0x803c08,%rdi
+  800053:	00 00 00 
+  800056:	b8 00 00 00 00       	mov    $0x0,%eax
+  80005b:	49 bd f9 0e 80 00 00 	movabs $0x800ef9,%r13
+  800062:	00 00 00 
+  800065:	41 ff d5             	call   *%r13
+            cprintf("MISMATCH\n");                                                             \
+            mismatch = 1;                                                                      \
+        }                                                                                      \
+    } while (0)
+
+    CHECK(r14, regs.reg_r14);
+  800068:	48 8b 4b 08          	mov    0x8(%rbx),%rcx
+  80006c:	49 8b 54 24 08       	mov    0x8(%r12),%rdx
+  800071:	48 be 18 3c 80 00 00 	movabs $0x803c18,%rsi
+  800078:	00 00 00 
+  80007b:	48 bf 1c 3c 80 00 00 	movabs $0x803c1c,%rdi
+  800082:	00 00 00 
+  800085:	b8 00 00 00 00       	mov    $0x0,%eax
+  80008a:	41 ff d5             	call   *%r13
+  80008d:	48 8b 43 08          	mov    0x8(%rbx),%rax
+  800091:	49 39 44 24 08       	cmp    %rax,0x8(%r12)
+  800096:	0f 84 48 06 00 00    	je     8006e4 <check_regs+0x6bf>
+  80009c:	48 bf 32 3c 80 00 00 	movabs $0x803c32,%rdi
+  8000a3:	00 00 00 
+  8000a6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000ab:	48 ba f9 0e 80 00 00 	movabs $0x800ef9,%rdx
+  8000b2:	00 00 00 
+  8000b5:	ff d2                	call   *%rdx
+  8000b7:	41 bd 01 00 00 00    	mov    $0x1,%r13d
+    CHECK(r13, regs.reg_r13);
+  8000bd:	48 8b 4b 10          	mov    0x10(%rbx),%rcx
+  8000c1:	49 8b 54 24 10       	mov    0x10(%r12),%rdx
+  8000c6:	48 be 3c 3c 80 00 00 	movabs $0x803c3c,%rsi
+  8000cd:	00 00 00 
+  8000d0:	48 bf 1c 3c 80 00 00 	movabs $0x803c1c,%rdi
+  8000d7:	00 00 00 
+  8000da:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000df:	49 b8 f9 0e 80 00 00 	movabs $0x800ef9,%r8
+  8000e6:	00 00 00 
+  8000e9:	41 ff d0             	call   *%r8
+  8000ec:	48 8b 43 10          	mov    0x10(%rbx),%rax
+  8000f0:	49 39 44 24 10       	cmp    %rax,0x10(%r12)
+  8000f5:	0f 84 06 06 00 00    	je     800701 <check_regs+0x6dc>
+  8000fb:	48 bf 32 3c 80 00 00 	movabs $0x803c32,%rdi
+  800102:	00 00 00 
+  800105:	b8 00 00 00 00       	mov    $0x0,%eax
+  80010a:	48 ba f9 0e 80 00 00 	movabs $0x800ef9,%rdx
+  800111:	00 00 00 
+  800114:	ff d2                	call   *%rdx
+  800116:	41 bd 01 00 00 00    	mov    $0x1,%r13d
+    CHECK(r12, regs.reg_r12);
+  80011c:	48 8b 4b 18          	mov    0x18(%rbx),%rcx
+  800120:	49 8b 54 24 18       	mov    0x18(%r12),%rdx
+  800125:	48 be 40 3c 80 00 00 	movabs $0x803c40,%rsi
+  80012c:	00 00 00 
+  80012f:	48 bf 1c 3c 80 00 00 	movabs $0x803c1c,%rdi
+  800136:	00 00 00 
+  800139:	b8 00 00 00 00       	mov    $0x0,%eax
+  80013e:	49 b8 f9 0e 80 00 00 	movabs $0x800ef9,%r8
+  800145:	00 00 00 
+  800148:	41 ff d0             	call   *%r8
+  80014b:	48 8b 43 18          	mov    0x18(%rbx),%rax
+  80014f:	49 39 44 24 18       	cmp    %rax,0x18(%r12)
+  800154:	0f 84 c7 05 00 00    	je     800721 <check_regs+0x6fc>
+  80015a:	48 bf 32 3c 80 00 00 	movabs $0x803c32,%rdi
+  800161:	00 00 00 
+  800164:	b8 00 00 00 00       	mov    $0x0,%eax
+  800169:	48 ba f9 0e 80 00 00 	movabs $0x800ef9,%rdx
+  800170:	00 00 00 
+  800173:	ff d2                	call   *%rdx
+  800175:	41 bd 01 00 00 00    	mov    $0x1,%r13d
+    CHECK(r11, regs.reg_r11);
+  80017b:	48 8b 4b 20          	mov    0x20(%rbx),%rcx
+  80017f:	49 8b 54 24 20       	mov    0x20(%r12),%rdx
+  800184:	48 be 44 3c 80 00 00 	movabs $0x803c44,%rsi
+  80018b:	00 00 00 
+  80018e:	48 bf 1c 3c 80 00 00 	movabs $0x803c1c,%rdi
+  800195:	00 00 00 
+  800198:	b8 00 00 00 00       	mov    $0x0,%eax
+  80019d:	49 b8 f9 0e 80 00 00 	movabs $0x800ef9,%r8
+  8001a4:	00 00 00 
+  8001a7:	41 ff d0             	call   *%r8
+  8001aa:	48 8b 43 20          	mov    0x20(%rbx),%rax
+  8001ae:	49 39 44 24 20       	cmp    %rax,0x20(%r12)
+  8001b3:	0f 84 88 05 00 00    	je     800741 <check_regs+0x71c>
+  8001b9:	48 bf 32 3c 80 00 00 	movabs $0x803c32,%rdi
+  8001c0:	00 00 00 
+  8001c3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001c8:	48 ba f9 0e 80 00 00 	movabs $0x800ef9,%rdx
+  8001cf:	00 00 00 
+  8001d2:	ff d2                	call   *%rdx
+  8001d4:	41 bd 01 00 00 00    	mov    $0x1,%r13d
+    CHECK(r10, regs.reg_r10);
+  8001da:	48 8b 4b 28          	mov    0x28(%rbx),%rcx
+  8001de:	49 8b 54 24 28       	mov    0x28(%r12),%rdx
+  8001e3:	48 be 48 3c 80 00 00 	movabs $0x803c48,%rsi
+  8001ea:	00 00 00 
+  8001ed:	48 bf 1c 3c 80 00 00 	movabs $0x803c1c,%rdi
+  8001f4:	00 00 00 
+  8001f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001fc:	49 b8 f9 0e 80 00 00 	movabs $0x800ef9,%r8
+  800203:	00 00 00 
+  800206:	41 ff d0             	call   *%r8
+  800209:	48 8b 43 28          	mov    0x28(%rbx),%rax
+  80020d:	49 39 44 24 28       	cmp    %rax,0x28(%r12)
+  800212:	0f 84 49 05 00 00    	je     800761 <check_regs+0x73c>
+  800218:	48 bf 32 3c 80 00 00 	movabs $0x803c32,%rdi
+  80021f:	00 00 00 
+  800222:	b8 00 00 00 00       	mov    $0x0,%eax
+  800227:	48 ba f9 0e 80 00 00 	movabs $0x800ef9,%rdx
+  80022e:	00 00 00 
+  800231:	ff d2                	call   *%rdx
+  800233:	41 bd 01 00 00 00    	mov    $0x1,%r13d
+    CHECK(rsi, regs.reg_rsi);
+  800239:	48 8b 4b 40          	mov    0x40(%rbx),%rcx
+  80023d:	49 8b 54 24 40       	mov    0x40(%r12),%rdx
+  800242:	48 be 4c 3c 80 00 00 	movabs $0x803c4c,%rsi
+  800249:	00 00 00 
+  80024c:	48 bf 1c 3c 80 00 00 	movabs $0x803c1c,%rdi
+  800253:	00 00 00 
+  800256:	b8 00 00 00 00       	mov    $0x0,%eax
+  80025b:	49 b8 f9 0e 80 00 00 	movabs $0x800ef9,%r8
+  800262:	00 00 00 
+  800265:	41 ff d0             	call   *%r8
+  800268:	48 8b 43 40          	mov    0x40(%rbx),%rax
+  80026c:	49 39 44 24 40       	cmp    %rax,0x40(%r12)
+  800271:	0f 84 0a 05 00 00    	je     800781 <check_regs+0x75c>
+  800277:	48 bf 32 3c 80 00 00 	movabs $0x803c32,%rdi
+  80027e:	00 00 00 
+  800281:	b8 00 00 00 00       	mov    $0x0,%eax
+  800286:	48 ba f9 0e 80 00 00 	movabs $0x800ef9,%rdx
+  80028d:	00 00 00 
+  800290:	ff d2                	call   *%rdx
+  800292:	41 bd 01 00 00 00    	mov    $0x1,%r13d
+    CHECK(rdi, regs.reg_rdi);
+  800298:	48 8b 4b 48          	mov    0x48(%rbx),%rcx
+  80029c:	49 8b 54 24 48       	mov    0x48(%r12),%rdx
+  8002a1:	48 be 50 3c 80 00 00 	movabs $0x803c50,%rsi
+  8002a8:	00 00 00 
+  8002ab:	48 bf 1c 3c 80 00 00 	movabs $0x803c1c,%rdi
+  8002b2:	00 00 00 
+  8002b5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002ba:	49 b8 f9 0e 80 00 00 	movabs $0x800ef9,%r8
+  8002c1:	00 00 00 
+  8002c4:	41 ff d0             	call   *%r8
+  8002c7:	48 8b 43 48          	mov    0x48(%rbx),%rax
+  8002cb:	49 39 44 24 48       	cmp    %rax,0x48(%r12)
+  8002d0:	0f 84 cb 04 00 00    	je     8007a1 <check_regs+0x77c>
+  8002d6:	48 bf 32 3c 80 00 00 	movabs $0x803c32,%rdi
+  8002dd:	00 00 00 
+  8002e0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002e5:	48 ba f9 0e 80 00 00 	movabs $0x800ef9,%rdx
+  8002ec:	00 00 00 
+  8002ef:	ff d2                	call   *%rdx
+  8002f1:	41 bd 01 00 00 00    	mov    $0x1,%r13d
+    CHECK(rdi, regs.reg_rdi);
+  8002f7:	48 8b 4b 48          	mov    0x48(%rbx),%rcx
+  8002fb:	49 8b 54 24 48       	mov    0x48(%r12),%rdx
+  800300:	48 be 50 3c 80 00 00 	movabs $0x803c50,%rsi
+  800307:	00 00 00 
+  80030a:	48 bf 1c 3c 80 00 00 	movabs $0x803c1c,%rdi
+  800311:	00 00 00 
+  800314:	b8 00 00 00 00       	mov    $0x0,%eax
+  800319:	49 b8 f9 0e 80 00 00 	movabs $0x800ef9,%r8
+  800320:	00 00 00 
+  800323:	41 ff d0             	call   *%r8
+  800326:	48 8b 43 48          	mov    0x48(%rbx),%rax
+  80032a:	49 39 44 24 48       	cmp    %rax,0x48(%r12)
+  80032f:	0f 84 8c 04 00 00    	je     8007c1 <check_regs+0x79c>
+  800335:	48 bf 32 3c 80 00 00 	movabs $0x803c32,%rdi
+  80033c:	00 00 00 
+  80033f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800344:	48 ba f9 0e 80 00 00 	movabs $0x800ef9,%rdx
+  80034b:	00 00 00 
+  80034e:	ff d2                	call   *%rdx
+  800350:	41 bd 01 00 00 00    	mov    $0x1,%r13d
+    CHECK(rsi, regs.reg_rsi);
+  800356:	48 8b 4b 40          	mov    0x40(%rbx),%rcx
+  80035a:	49 8b 54 24 40       	mov    0x40(%r12),%rdx
+  80035f:	48 be 4c 3c 80 00 00 	movabs $0x803c4c,%rsi
+  800366:	00 00 00 
+  800369:	48 bf 1c 3c 80 00 00 	movabs $0x803c1c,%rdi
+  800370:	00 00 00 
+  800373:	b8 00 00 00 00       	mov    $0x0,%eax
+  800378:	49 b8 f9 0e 80 00 00 	movabs $0x800ef9,%r8
+  80037f:	00 00 00 
+  800382:	41 ff d0             	call   *%r8
+  800385:	48 8b 43 40          	mov    0x40(%rbx),%rax
+  800389:	49 39 44 24 40       	cmp    %rax,0x40(%r12)
+  80038e:	0f 84 4d 04 00 00    	je     8007e1 <check_regs+0x7bc>
+  800394:	48 bf 32 3c 80 00 00 	movabs $0x803c32,%rdi
+  80039b:	00 00 00 
+  80039e:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003a3:	48 ba f9 0e 80 00 00 	movabs $0x800ef9,%rdx
+  8003aa:	00 00 00 
+  8003ad:	ff d2                	call   *%rdx
+  8003af:	41 bd 01 00 00 00    	mov    $0x1,%r13d
+    CHECK(rbp, regs.reg_rbp);
+  8003b5:	48 8b 4b 50          	mov    0x50(%rbx),%rcx
+  8003b9:	49 8b 54 24 50       	mov    0x50(%r12),%rdx
+  8003be:	48 be 54 3c 80 00 00 	movabs $0x803c54,%rsi
+  8003c5:	00 00 00 
+  8003c8:	48 bf 1c 3c 80 00 00 	movabs $0x803c1c,%rdi
+  8003cf:	00 00 00 
+  8003d2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003d7:	49 b8 f9 0e 80 00 00 	movabs $0x800ef9,%r8
+  8003de:	00 00 00 
+  8003e1:	41 ff d0             	call   *%r8
+  8003e4:	48 8b 43 50          	mov    0x50(%rbx),%rax
+  8003e8:	49 39 44 24 50       	cmp    %rax,0x50(%r12)
+  8003ed:	0f 84 0e 04 00 00    	je     800801 <check_regs+0x7dc>
+  8003f3:	48 bf 32 3c 80 00 00 	movabs $0x803c32,%rdi
+  8003fa:	00 00 00 
+  8003fd:	b8 00 00 00 00       	mov    $0x0,%eax
+  800402:	48 ba f9 0e 80 00 00 	movabs $0x800ef9,%rdx
+  800409:	00 00 00 
+  80040c:	ff d2                	call   *%rdx
+  80040e:	41 bd 01 00 00 00    	mov    $0x1,%r13d
+    CHECK(rbx, regs.reg_rbx);
+  800414:	48 8b 4b 68          	mov    0x68(%rbx),%rcx
+  800418:	49 8b 54 24 68       	mov    0x68(%r12),%rdx
+  80041d:	48 be 58 3c 80 00 00 	movabs $0x803c58,%rsi
+  800424:	00 00 00 
+  800427:	48 bf 1c 3c 80 00 00 	movabs $0x803c1c,%rdi
+  80042e:	00 00 00 
+  800431:	b8 00 00 00 00       	mov    $0x0,%eax
+  800436:	49 b8 f9 0e 80 00 00 	movabs $0x800ef9,%r8
+  80043d:	00 00 00 
+  800440:	41 ff d0             	call   *%r8
+  800443:	48 8b 43 68          	mov    0x68(%rbx),%rax
+  800447:	49 39 44 24 68       	cmp    %rax,0x68(%r12)
+  80044c:	0f 84 cf 03 00 00    	je     800821 <check_regs+0x7fc>
+  800452:	48 bf 32 3c 80 00 00 	movabs $0x803c32,%rdi
+  800459:	00 00 00 
+  80045c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800461:	48 ba f9 0e 80 00 00 	movabs $0x800ef9,%rdx
+  800468:	00 00 00 
+  80046b:	ff d2                	call   *%rdx
+  80046d:	41 bd 01 00 00 00    	mov    $0x1,%r13d
+    CHECK(rdx, regs.reg_rdx);
+  800473:	48 8b 4b 58          	mov    0x58(%rbx),%rcx
+  800477:	49 8b 54 24 58       	mov    0x58(%r12),%rdx
+  80047c:	48 be 5c 3c 80 00 00 	movabs $0x803c5c,%rsi
+  800483:	00 00 00 
+  800486:	48 bf 1c 3c 80 00 00 	movabs $0x803c1c,%rdi
+  80048d:	00 00 00 
+  800490:	b8 00 00 00 00       	mov    $0x0,%eax
+  800495:	49 b8 f9 0e 80 00 00 	movabs $0x800ef9,%r8
+  80049c:	00 00 00 
+  80049f:	41 ff d0             	call   *%r8
+  8004a2:	48 8b 43 58          	mov    0x58(%rbx),%rax
+  8004a6:	49 39 44 24 58       	cmp    %rax,0x58(%r12)
+  8004ab:	0f 84 90 03 00 00    	je     800841 <check_regs+0x81c>
+  8004b1:	48 bf 32 3c 80 00 00 	movabs $0x803c32,%rdi
+  8004b8:	00 00 00 
+  8004bb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004c0:	48 ba f9 0e 80 00 00 	movabs $0x800ef9,%rdx
+  8004c7:	00 00 00 
+  8004ca:	ff d2                	call   *%rdx
+  8004cc:	41 bd 01 00 00 00    	mov    $0x1,%r13d
+    CHECK(rcx, regs.reg_rcx);
+  8004d2:	48 8b 4b 60          	mov    0x60(%rbx),%rcx
+  8004d6:	49 8b 54 24 60       	mov    0x60(%r12),%rdx
+  8004db:	48 be 60 3c 80 00 00 	movabs $0x803c60,%rsi
+  8004e2:	00 00 00 
+  8004e5:	48 bf 1c 3c 80 00 00 	movabs $0x803c1c,%rdi
+  8004ec:	00 00 00 
+  8004ef:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004f4:	49 b8 f9 0e 80 00 00 	movabs $0x800ef9,%r8
+  8004fb:	00 00 00 
+  8004fe:	41 ff d0             	call   *%r8
+  800501:	48 8b 43 60          	mov    0x60(%rbx),%rax
+  800505:	49 39 44 24 60       	cmp    %rax,0x60(%r12)
+  80050a:	0f 84 51 03 00 00    	je     800861 <check_regs+0x83c>
+  800510:	48 bf 32 3c 80 00 00 	movabs $0x803c32,%rdi
+  800517:	00 00 00 
+  80051a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80051f:	48 ba f9 0e 80 00 00 	movabs $0x800ef9,%rdx
+  800526:	00 00 00 
+  800529:	ff d2                	call   *%rdx
+  80052b:	41 bd 01 00 00 00    	mov    $0x1,%r13d
+    CHECK(rax, regs.reg_rax);
+  800531:	48 8b 4b 70          	mov    0x70(%rbx),%rcx
+  800535:	49 8b 54 24 70       	mov    0x70(%r12),%rdx
+  80053a:	48 be 64 3c 80 00 00 	movabs $0x803c64,%rsi
+  800541:	00 00 00 
+  800544:	48 bf 1c 3c 80 00 00 	movabs $0x803c1c,%rdi
+  80054b:	00 00 00 
+  80054e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800553:	49 b8 f9 0e 80 00 00 	movabs $0x800ef9,%r8
+  80055a:	00 00 00 
+  80055d:	41 ff d0             	call   *%r8
+  800560:	48 8b 43 70          	mov    0x70(%rbx),%rax
+  800564:	49 39 44 24 70       	cmp    %rax,0x70(%r12)
+  800569:	0f 84 12 03 00 00    	je     800881 <check_regs+0x85c>
+  80056f:	48 bf 32 3c 80 00 00 	movabs $0x803c32,%rdi
+  800576:	00 00 00 
+  800579:	b8 00 00 00 00       	mov    $0x0,%eax
+  80057e:	48 ba f9 0e 80 00 00 	movabs $0x800ef9,%rdx
+  800585:	00 00 00 
+  800588:	ff d2                	call   *%rdx
+  80058a:	41 bd 01 00 00 00    	mov    $0x1,%r13d
+    CHECK(rip, rip);
+  800590:	48 8b 4b 78          	mov    0x78(%rbx),%rcx
+  800594:	49 8b 54 24 78       	mov    0x78(%r12),%rdx
+  800599:	48 be 68 3c 80 00 00 	movabs $0x803c68,%rsi
+  8005a0:	00 00 00 
+  8005a3:	48 bf 1c 3c 80 00 00 	movabs $0x803c1c,%rdi
+  8005aa:	00 00 00 
+  8005ad:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005b2:	49 b8 f9 0e 80 00 00 	movabs $0x800ef9,%r8
+  8005b9:	00 00 00 
+  8005bc:	41 ff d0             	call   *%r8
+  8005bf:	48 8b 43 78          	mov    0x78(%rbx),%rax
+  8005c3:	49 39 44 24 78       	cmp    %rax,0x78(%r12)
+  8005c8:	0f 84 d3 02 00 00    	je     8008a1 <check_regs+0x87c>
+  8005ce:	48 bf 32 3c 80 00 00 	movabs $0x803c32,%rdi
+  8005d5:	00 00 00 
+  8005d8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005dd:	48 ba f9 0e 80 00 00 	movabs $0x800ef9,%rdx
+  8005e4:	00 00 00 
+  8005e7:	ff d2                	call   *%rdx
+  8005e9:	41 bd 01 00 00 00    	mov    $0x1,%r13d
+    CHECK(rflags, rflags);
+  8005ef:	48 8b 8b 80 00 00 00 	mov    0x80(%rbx),%rcx
+  8005f6:	49 8b 94 24 80 00 00 	mov    0x80(%r12),%rdx
+  8005fd:	00 
+  8005fe:	48 be 6c 3c 80 00 00 	movabs $0x803c6c,%rsi
+  800605:	00 00 00 
+  800608:	48 bf 1c 3c 80 00 00 	movabs $0x803c1c,%rdi
+  80060f:	00 00 00 
+  800612:	b8 00 00 00 00       	mov    $0x0,%eax
+  800617:	49 b8 f9 0e 80 00 00 	movabs $0x800ef9,%r8
+  80061e:	00 00 00 
+  800621:	41 ff d0             	call   *%r8
+  800624:	48 8b 83 80 00 00 00 	mov    0x80(%rbx),%rax
+  80062b:	49 39 84 24 80 00 00 	cmp    %rax,0x80(%r12)
+  800632:	00 
+  800633:	0f 84 88 02 00 00    	je     8008c1 <check_regs+0x89c>
+  800639:	48 bf 32 3c 80 00 00 	movabs $0x803c32,%rdi
+  800640:	00 00 00 
+  800643:	b8 00 00 00 00       	mov    $0x0,%eax
+  800648:	49 bd f9 0e 80 00 00 	movabs $0x800ef9,%r13
+  80064f:	00 00 00 
+  800652:	41 ff d5             	call   *%r13
+    CHECK(rsp, rsp);
+  800655:	48 8b 8b 88 00 00 00 	mov    0x88(%rbx),%rcx
+  80065c:	49 8b 94 24 88 00 00 	mov    0x88(%r12),%rdx
+  800663:	00 
+  800664:	48 be 73 3c 80 00 00 	movabs $0x803c73,%rsi
+  80066b:	00 00 00 
+  80066e:	48 bf 1c 3c 80 00 00 	movabs $0x803c1c,%rdi
+  800675:	00 00 00 
+  800678:	b8 00 00 00 00       	mov    $0x0,%eax
+  80067d:	41 ff d5             	call   *%r13
+  800680:	48 8b 83 88 00 00 00 	mov    0x88(%rbx),%rax
+  800687:	49 39 84 24 88 00 00 	cmp    %rax,0x88(%r12)
+  80068e:	00 
+  80068f:	0f 84 ea 02 00 00    	je     80097f <check_regs+0x95a>
+  800695:	48 bf 32 3c 80 00 00 	movabs $0x803c32,%rdi
+  80069c:	00 00 00 
+  80069f:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006a4:	48 bb f9 0e 80 00 00 	movabs $0x800ef9,%rbx
+  8006ab:	00 00 00 
+  8006ae:	ff d3                	call   *%rbx
+
+#undef CHECK
+
+    cprintf("Registers %s ", testname);
+  8006b0:	4c 89 f6             	mov    %r14,%rsi
+  8006b3:	48 bf 77 3c 80 00 00 	movabs $0x803c77,%rdi
+  8006ba:	00 00 00 
+  8006bd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006c2:	ff d3                	call   *%rbx
+    if (!mismatch)
+        cprintf("OK\n");
+    else
+        cprintf("MISMATCH\n");
+  8006c4:	48 bf 32 3c 80 00 00 	movabs $0x803c32,%rdi
+  8006cb:	00 00 00 
+  8006ce:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006d3:	48 ba f9 0e 80 00 00 	movabs $0x800ef9,%rdx
+  8006da:	00 00 00 
+  8006dd:	ff d2                	call   *%rdx
+}
+  8006df:	e9 8c 02 00 00       	jmp    800970 <check_regs+0x94b>
+    CHECK(r14, regs.reg_r14);
+  8006e4:	48 bf 2e 3c 80 00 00 	movabs $0x803c2e,%rdi
+  8006eb:	00 00 00 
+  8006ee:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006f3:	41 ff d5             	call   *%r13
+    int mismatch = 0;
+  8006f6:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  8006fc:	e9 bc f9 ff ff       	jmp    8000bd <check_regs+0x98>
+    CHECK(r13, regs.reg_r13);
+  800701:	48 bf 2e 3c 80 00 00 	movabs $0x803c2e,%rdi
+  800708:	00 00 00 
+  80070b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800710:	48 ba f9 0e 80 00 00 	movabs $0x800ef9,%rdx
+  800717:	00 00 00 
+  80071a:	ff d2                	call   *%rdx
+  80071c:	e9 fb f9 ff ff       	jmp    80011c <check_regs+0xf7>
+    CHECK(r12, regs.reg_r12);
+  800721:	48 bf 2e 3c 80 00 00 	movabs $0x803c2e,%rdi
+  800728:	00 00 00 
+  80072b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800730:	48 ba f9 0e 80 00 00 	movabs $0x800ef9,%rdx
+  800737:	00 00 00 
+  80073a:	ff d2                	call   *%rdx
+  80073c:	e9 3a fa ff ff       	jmp    80017b <check_regs+0x156>
+    CHECK(r11, regs.reg_r11);
+  800741:	48 bf 2e 3c 80 00 00 	movabs $0x803c2e,%rdi
+  800748:	00 00 00 
+  80074b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800750:	48 ba f9 0e 80 00 00 	movabs $0x800ef9,%rdx
+  800757:	00 00 00 
+  80075a:	ff d2                	call   *%rdx
+  80075c:	e9 79 fa ff ff       	jmp    8001da <check_regs+0x1b5>
+    CHECK(r10, regs.reg_r10);
+  800761:	48 bf 2e 3c 80 00 00 	movabs $0x803c2e,%rdi
+  800768:	00 00 00 
+  80076b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800770:	48 ba f9 0e 80 00 00 	movabs $0x800ef9,%rdx
+  800777:	00 00 00 
+  80077a:	ff d2                	call   *%rdx
+  80077c:	e9 b8 fa ff ff       	jmp    800239 <check_regs+0x214>
+    CHECK(rsi, regs.reg_rsi);
+  800781:	48 bf 2e 3c 80 00 00 	movabs $0x803c2e,%rdi
+  800788:	00 00 00 
+  80078b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800790:	48 ba f9 0e 80 00 00 	movabs $0x800ef9,%rdx
+  800797:	00 00 00 
+  80079a:	ff d2                	call   *%rdx
+  80079c:	e9 f7 fa ff ff       	jmp    800298 <check_regs+0x273>
+    CHECK(rdi, regs.reg_rdi);
+  8007a1:	48 bf 2e 3c 80 00 00 	movabs $0x803c2e,%rdi
+  8007a8:	00 00 00 
+  8007ab:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007b0:	48 ba f9 0e 80 00 00 	movabs $0x800ef9,%rdx
+  8007b7:	00 00 00 
+  8007ba:	ff d2                	call   *%rdx
+  8007bc:	e9 36 fb ff ff       	jmp    8002f7 <check_regs+0x2d2>
+    CHECK(rdi, regs.reg_rdi);
+  8007c1:	48 bf 2e 3c 80 00 00 	movabs $0x803c2e,%rdi
+  8007c8:	00 00 00 
+  8007cb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007d0:	48 ba f9 0e 80 00 00 	movabs $0x800ef9,%rdx
+  8007d7:	00 00 00 
+  8007da:	ff d2                	call   *%rdx
+  8007dc:	e9 75 fb ff ff       	jmp    800356 <check_regs+0x331>
+    CHECK(rsi, regs.reg_rsi);
+  8007e1:	48 bf 2e 3c 80 00 00 	movabs $0x803c2e,%rdi
+  8007e8:	00 00 00 
+  8007eb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007f0:	48 ba f9 0e 80 00 00 	movabs $0x800ef9,%rdx
+  8007f7:	00 00 00 
+  8007fa:	ff d2                	call   *%rdx
+  8007fc:	e9 b4 fb ff ff       	jmp    8003b5 <check_regs+0x390>
+    CHECK(rbp, regs.reg_rbp);
+  800801:	48 bf 2e 3c 80 00 00 	movabs $0x803c2e,%rdi
+  800808:	00 00 00 
+  80080b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800810:	48 ba f9 0e 80 00 00 	movabs $0x800ef9,%rdx
+  800817:	00 00 00 
+  80081a:	ff d2                	call   *%rdx
+  80081c:	e9 f3 fb ff ff       	jmp    800414 <check_regs+0x3ef>
+    CHECK(rbx, regs.reg_rbx);
+  800821:	48 bf 2e 3c 80 00 00 	movabs $0x803c2e,%rdi
+  800828:	00 00 00 
+  80082b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800830:	48 ba f9 0e 80 00 00 	movabs $0x800ef9,%rdx
+  800837:	00 00 00 
+  80083a:	ff d2                	call   *%rdx
+  80083c:	e9 32 fc ff ff       	jmp    800473 <check_regs+0x44e>
+    CHECK(rdx, regs.reg_rdx);
+  800841:	48 bf 2e 3c 80 00 00 	movabs $0x803c2e,%rdi
+  800848:	00 00 00 
+  80084b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800850:	48 ba f9 0e 80 00 00 	movabs $0x800ef9,%rdx
+  800857:	00 00 00 
+  80085a:	ff d2                	call   *%rdx
+  80085c:	e9 71 fc ff ff       	jmp    8004d2 <check_regs+0x4ad>
+    CHECK(rcx, regs.reg_rcx);
+  800861:	48 bf 2e 3c 80 00 00 	movabs $0x803c2e,%rdi
+  800868:	00 00 00 
+  80086b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800870:	48 ba f9 0e 80 00 00 	movabs $0x800ef9,%rdx
+  800877:	00 00 00 
+  80087a:	ff d2                	call   *%rdx
+  80087c:	e9 b0 fc ff ff       	jmp    800531 <check_regs+0x50c>
+    CHECK(rax, regs.reg_rax);
+  800881:	48 bf 2e 3c 80 00 00 	movabs $0x803c2e,%rdi
+  800888:	00 00 00 
+  80088b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800890:	48 ba f9 0e 80 00 00 	movabs $0x800ef9,%rdx
+  800897:	00 00 00 
+  80089a:	ff d2                	call   *%rdx
+  80089c:	e9 ef fc ff ff       	jmp    800590 <check_regs+0x56b>
+    CHECK(rip, rip);
+  8008a1:	48 bf 2e 3c 80 00 00 	movabs $0x803c2e,%rdi
+  8008a8:	00 00 00 
+  8008ab:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008b0:	48 ba f9 0e 80 00 00 	movabs $0x800ef9,%rdx
+  8008b7:	00 00 00 
+  8008ba:	ff d2                	call   *%rdx
+  8008bc:	e9 2e fd ff ff       	jmp    8005ef <check_regs+0x5ca>
+    CHECK(rflags, rflags);
+  8008c1:	48 bf 2e 3c 80 00 00 	movabs $0x803c2e,%rdi
+  8008c8:	00 00 00 
+  8008cb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008d0:	49 bf f9 0e 80 00 00 	movabs $0x800ef9,%r15
+  8008d7:	00 00 00 
+  8008da:	41 ff d7             	call   *%r15
+    CHECK(rsp, rsp);
+  8008dd:	48 8b 8b 88 00 00 00 	mov    0x88(%rbx),%rcx
+  8008e4:	49 8b 94 24 88 00 00 	mov    0x88(%r12),%rdx
+  8008eb:	00 
+  8008ec:	48 be 73 3c 80 00 00 	movabs $0x803c73,%rsi
+  8008f3:	00 00 00 
+  8008f6:	48 bf 1c 3c 80 00 00 	movabs $0x803c1c,%rdi
+  8008fd:	00 00 00 
+  800900:	b8 00 00 00 00       	mov    $0x0,%eax
+  800905:	41 ff d7             	call   *%r15
+  800908:	48 8b 83 88 00 00 00 	mov    0x88(%rbx),%rax
+  80090f:	49 39 84 24 88 00 00 	cmp    %rax,0x88(%r12)
+  800916:	00 
+  800917:	0f 85 78 fd ff ff    	jne    800695 <check_regs+0x670>
+  80091d:	48 bf 2e 3c 80 00 00 	movabs $0x803c2e,%rdi
+  800924:	00 00 00 
+  800927:	b8 00 00 00 00       	mov    $0x0,%eax
+  80092c:	48 bb f9 0e 80 00 00 	movabs $0x800ef9,%rbx
+  800933:	00 00 00 
+  800936:	ff d3                	call   *%rbx
+    cprintf("Registers %s ", testname);
+  800938:	4c 89 f6             	mov    %r14,%rsi
+  80093b:	48 bf 77 3c 80 00 00 	movabs $0x803c77,%rdi
+  800942:	00 00 00 
+  800945:	b8 00 00 00 00       	mov    $0x0,%eax
+  80094a:	ff d3                	call   *%rbx
+    if (!mismatch)
+  80094c:	45 85 ed             	test   %r13d,%r13d
+  80094f:	0f 85 6f fd ff ff    	jne    8006c4 <check_regs+0x69f>
+        cprintf("OK\n");
+  800955:	48 bf 2e 3c 80 00 00 	movabs $0x803c2e,%rdi
+  80095c:	00 00 00 
+  80095f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800964:	48 ba f9 0e 80 00 00 	movabs $0x800ef9,%rdx
+  80096b:	00 00 00 
+  80096e:	ff d2                	call   *%rdx
+}
+  800970:	48 83 c4 08          	add    $0x8,%rsp
+  800974:	5b                   	pop    %rbx
+  800975:	41 5c                	pop    %r12
+  800977:	41 5d                	pop    %r13
+  800979:	41 5e                	pop    %r14
+  80097b:	41 5f                	pop    %r15
+  80097d:	5d                   	pop    %rbp
+  80097e:	c3                   	ret
+    CHECK(rsp, rsp);
+  80097f:	48 bf 2e 3c 80 00 00 	movabs $0x803c2e,%rdi
+  800986:	00 00 00 
+  800989:	b8 00 00 00 00       	mov    $0x0,%eax
+  80098e:	48 bb f9 0e 80 00 00 	movabs $0x800ef9,%rbx
+  800995:	00 00 00 
+  800998:	ff d3                	call   *%rbx
+    cprintf("Registers %s ", testname);
+  80099a:	4c 89 f6             	mov    %r14,%rsi
+  80099d:	48 bf 77 3c 80 00 00 	movabs $0x803c77,%rdi
+  8009a4:	00 00 00 
+  8009a7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009ac:	ff d3                	call   *%rbx
+    if (!mismatch)
+  8009ae:	e9 11 fd ff ff       	jmp    8006c4 <check_regs+0x69f>
+
+00000000008009b3 <pgfault>:
+
+static bool
+pgfault(struct UTrapframe *utf) {
+  8009b3:	55                   	push   %rbp
+  8009b4:	48 89 e5             	mov    %rsp,%rbp
+    int r;
+
+    if (utf->utf_fault_va != (uint64_t)UTEMP)
+  8009b7:	48 8b 0f             	mov    (%rdi),%rcx
+  8009ba:	48 81 f9 00 00 40 00 	cmp    $0x400000,%rcx
+  8009c1:	0f 85 13 01 00 00    	jne    800ada <pgfault+0x127>
+        panic("pgfault expected at UTEMP, got 0x%08lx (rip %08lx)",
+              (unsigned long)utf->utf_fault_va, (unsigned long)utf->utf_rip);
+
+    /* Check registers in UTrapframe */
+    during.regs = utf->utf_regs;
+  8009c7:	48 be a0 60 80 00 00 	movabs $0x8060a0,%rsi
+  8009ce:	00 00 00 
+  8009d1:	48 8b 57 10          	mov    0x10(%rdi),%rdx
+  8009d5:	48 89 16             	mov    %rdx,(%rsi)
+  8009d8:	48 8b 57 18          	mov    0x18(%rdi),%rdx
+  8009dc:	48 89 56 08          	mov    %rdx,0x8(%rsi)
+  8009e0:	48 8b 57 20          	mov    0x20(%rdi),%rdx
+  8009e4:	48 89 56 10          	mov    %rdx,0x10(%rsi)
+  8009e8:	48 8b 57 28          	mov    0x28(%rdi),%rdx
+  8009ec:	48 89 56 18          	mov    %rdx,0x18(%rsi)
+  8009f0:	48 8b 57 30          	mov    0x30(%rdi),%rdx
+  8009f4:	48 89 56 20          	mov    %rdx,0x20(%rsi)
+  8009f8:	48 8b 57 38          	mov    0x38(%rdi),%rdx
+  8009fc:	48 89 56 28          	mov    %rdx,0x28(%rsi)
+  800a00:	48 8b 57 40          	mov    0x40(%rdi),%rdx
+  800a04:	48 89 56 30          	mov    %rdx,0x30(%rsi)
+  800a08:	48 8b 57 48          	mov    0x48(%rdi),%rdx
+  800a0c:	48 89 56 38          	mov    %rdx,0x38(%rsi)
+  800a10:	48 8b 57 50          	mov    0x50(%rdi),%rdx
+  800a14:	48 89 56 40          	mov    %rdx,0x40(%rsi)
+  800a18:	48 8b 57 58          	mov    0x58(%rdi),%rdx
+  800a1c:	48 89 56 48          	mov    %rdx,0x48(%rsi)
+  800a20:	48 8b 57 60          	mov    0x60(%rdi),%rdx
+  800a24:	48 89 56 50          	mov    %rdx,0x50(%rsi)
+  800a28:	48 8b 57 68          	mov    0x68(%rdi),%rdx
+  800a2c:	48 89 56 58          	mov    %rdx,0x58(%rsi)
+  800a30:	48 8b 57 70          	mov    0x70(%rdi),%rdx
+  800a34:	48 89 56 60          	mov    %rdx,0x60(%rsi)
+  800a38:	48 8b 57 78          	mov    0x78(%rdi),%rdx
+  800a3c:	48 89 56 68          	mov    %rdx,0x68(%rsi)
+  800a40:	48 8b 97 80 00 00 00 	mov    0x80(%rdi),%rdx
+  800a47:	48 89 56 70          	mov    %rdx,0x70(%rsi)
+    during.rip = utf->utf_rip;
+  800a4b:	48 8b 97 88 00 00 00 	mov    0x88(%rdi),%rdx
+  800a52:	48 89 56 78          	mov    %rdx,0x78(%rsi)
+    during.rflags = utf->utf_rflags & 0xfff;
+  800a56:	48 8b 97 90 00 00 00 	mov    0x90(%rdi),%rdx
+  800a5d:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  800a63:	48 89 96 80 00 00 00 	mov    %rdx,0x80(%rsi)
+    during.rsp = utf->utf_rsp;
+  800a6a:	48 8b 87 98 00 00 00 	mov    0x98(%rdi),%rax
+  800a71:	48 89 86 88 00 00 00 	mov    %rax,0x88(%rsi)
+    check_regs(&before, "before", &during, "during", "in UTrapframe");
+  800a78:	49 b8 96 3c 80 00 00 	movabs $0x803c96,%r8
+  800a7f:	00 00 00 
+  800a82:	48 b9 a4 3c 80 00 00 	movabs $0x803ca4,%rcx
+  800a89:	00 00 00 
+  800a8c:	48 89 f2             	mov    %rsi,%rdx
+  800a8f:	48 be ab 3c 80 00 00 	movabs $0x803cab,%rsi
+  800a96:	00 00 00 
+  800a99:	48 bf 40 61 80 00 00 	movabs $0x806140,%rdi
+  800aa0:	00 00 00 
+  800aa3:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  800aaa:	00 00 00 
+  800aad:	ff d0                	call   *%rax
+    ;
+
+    /* Map UTEMP so the write succeeds */
+    if ((r = sys_alloc_region(0, UTEMP, PAGE_SIZE, PROT_RW)) < 0)
+  800aaf:	b9 06 00 00 00       	mov    $0x6,%ecx
+  800ab4:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800ab9:	be 00 00 40 00       	mov    $0x400000,%esi
+  800abe:	bf 00 00 00 00       	mov    $0x0,%edi
+  800ac3:	48 b8 ce 1d 80 00 00 	movabs $0x801dce,%rax
+  800aca:	00 00 00 
+  800acd:	ff d0                	call   *%rax
+  800acf:	85 c0                	test   %eax,%eax
+  800ad1:	78 39                	js     800b0c <pgfault+0x159>
+        panic("sys_page_alloc: %i", r);
+    return 1;
+}
+  800ad3:	b8 01 00 00 00       	mov    $0x1,%eax
+  800ad8:	5d                   	pop    %rbp
+  800ad9:	c3                   	ret
+        panic("pgfault expected at UTEMP, got 0x%08lx (rip %08lx)",
+  800ada:	4c 8b 87 88 00 00 00 	mov    0x88(%rdi),%r8
+  800ae1:	48 ba e0 3c 80 00 00 	movabs $0x803ce0,%rdx
+  800ae8:	00 00 00 
+  800aeb:	be 62 00 00 00       	mov    $0x62,%esi
+  800af0:	48 bf 85 3c 80 00 00 	movabs $0x803c85,%rdi
+  800af7:	00 00 00 
+  800afa:	b8 00 00 00 00       	mov    $0x0,%eax
+  800aff:	49 b9 a9 0d 80 00 00 	movabs $0x800da9,%r9
+  800b06:	00 00 00 
+  800b09:	41 ff d1             	call   *%r9
+        panic("sys_page_alloc: %i", r);
+  800b0c:	89 c1                	mov    %eax,%ecx
+  800b0e:	48 ba b2 3c 80 00 00 	movabs $0x803cb2,%rdx
+  800b15:	00 00 00 
+  800b18:	be 6f 00 00 00       	mov    $0x6f,%esi
+  800b1d:	48 bf 85 3c 80 00 00 	movabs $0x803c85,%rdi
+  800b24:	00 00 00 
+  800b27:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b2c:	49 b8 a9 0d 80 00 00 	movabs $0x800da9,%r8
+  800b33:	00 00 00 
+  800b36:	41 ff d0             	call   *%r8
+
+0000000000800b39 <umain>:
+
+void
+umain(int argc, char **argv) {
+  800b39:	55                   	push   %rbp
+  800b3a:	48 89 e5             	mov    %rsp,%rbp
+    add_pgfault_handler(pgfault);
+  800b3d:	48 bf b3 09 80 00 00 	movabs $0x8009b3,%rdi
+  800b44:	00 00 00 
+  800b47:	48 b8 93 22 80 00 00 	movabs $0x802293,%rax
+  800b4e:	00 00 00 
+  800b51:	ff d0                	call   *%rax
+
+    __asm __volatile(
+  800b53:	48 b8 40 61 80 00 00 	movabs $0x806140,%rax
+  800b5a:	00 00 00 
+  800b5d:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  800b64:	00 00 00 
+  800b67:	50                   	push   %rax
+  800b68:	52                   	push   %rdx
+  800b69:	50                   	push   %rax
+  800b6a:	9c                   	pushf
+  800b6b:	58                   	pop    %rax
+  800b6c:	48 0d d4 08 00 00    	or     $0x8d4,%rax
+  800b72:	50                   	push   %rax
+  800b73:	9d                   	popf
+  800b74:	4c 8b 7c 24 10       	mov    0x10(%rsp),%r15
+  800b79:	49 89 87 80 00 00 00 	mov    %rax,0x80(%r15)
+  800b80:	48 8d 04 25 cc 0b 80 	lea    0x800bcc,%rax
+  800b87:	00 
+  800b88:	49 89 47 78          	mov    %rax,0x78(%r15)
+  800b8c:	58                   	pop    %rax
+  800b8d:	4d 89 77 08          	mov    %r14,0x8(%r15)
+  800b91:	4d 89 6f 10          	mov    %r13,0x10(%r15)
+  800b95:	4d 89 67 18          	mov    %r12,0x18(%r15)
+  800b99:	4d 89 5f 20          	mov    %r11,0x20(%r15)
+  800b9d:	4d 89 57 28          	mov    %r10,0x28(%r15)
+  800ba1:	4d 89 4f 30          	mov    %r9,0x30(%r15)
+  800ba5:	4d 89 47 38          	mov    %r8,0x38(%r15)
+  800ba9:	49 89 77 40          	mov    %rsi,0x40(%r15)
+  800bad:	49 89 7f 48          	mov    %rdi,0x48(%r15)
+  800bb1:	49 89 6f 50          	mov    %rbp,0x50(%r15)
+  800bb5:	49 89 57 58          	mov    %rdx,0x58(%r15)
+  800bb9:	49 89 4f 60          	mov    %rcx,0x60(%r15)
+  800bbd:	49 89 5f 68          	mov    %rbx,0x68(%r15)
+  800bc1:	49 89 47 70          	mov    %rax,0x70(%r15)
+  800bc5:	49 89 a7 88 00 00 00 	mov    %rsp,0x88(%r15)
+  800bcc:	c7 04 25 00 00 40 00 	movl   $0x2a,0x400000
+  800bd3:	2a 00 00 00 
+  800bd7:	4c 8b 3c 24          	mov    (%rsp),%r15
+  800bdb:	4d 89 77 08          	mov    %r14,0x8(%r15)
+  800bdf:	4d 89 6f 10          	mov    %r13,0x10(%r15)
+  800be3:	4d 89 67 18          	mov    %r12,0x18(%r15)
+  800be7:	4d 89 5f 20          	mov    %r11,0x20(%r15)
+  800beb:	4d 89 57 28          	mov    %r10,0x28(%r15)
+  800bef:	4d 89 4f 30          	mov    %r9,0x30(%r15)
+  800bf3:	4d 89 47 38          	mov    %r8,0x38(%r15)
+  800bf7:	49 89 77 40          	mov    %rsi,0x40(%r15)
+  800bfb:	49 89 7f 48          	mov    %rdi,0x48(%r15)
+  800bff:	49 89 6f 50          	mov    %rbp,0x50(%r15)
+  800c03:	49 89 57 58          	mov    %rdx,0x58(%r15)
+  800c07:	49 89 4f 60          	mov    %rcx,0x60(%r15)
+  800c0b:	49 89 5f 68          	mov    %rbx,0x68(%r15)
+  800c0f:	49 89 47 70          	mov    %rax,0x70(%r15)
+  800c13:	49 89 a7 88 00 00 00 	mov    %rsp,0x88(%r15)
+  800c1a:	4c 8b 7c 24 08       	mov    0x8(%rsp),%r15
+  800c1f:	4d 8b 77 08          	mov    0x8(%r15),%r14
+  800c23:	4d 8b 6f 10          	mov    0x10(%r15),%r13
+  800c27:	4d 8b 67 18          	mov    0x18(%r15),%r12
+  800c2b:	4d 8b 5f 20          	mov    0x20(%r15),%r11
+  800c2f:	4d 8b 57 28          	mov    0x28(%r15),%r10
+  800c33:	4d 8b 4f 30          	mov    0x30(%r15),%r9
+  800c37:	4d 8b 47 38          	mov    0x38(%r15),%r8
+  800c3b:	49 8b 77 40          	mov    0x40(%r15),%rsi
+  800c3f:	49 8b 7f 48          	mov    0x48(%r15),%rdi
+  800c43:	49 8b 6f 50          	mov    0x50(%r15),%rbp
+  800c47:	49 8b 57 58          	mov    0x58(%r15),%rdx
+  800c4b:	49 8b 4f 60          	mov    0x60(%r15),%rcx
+  800c4f:	49 8b 5f 68          	mov    0x68(%r15),%rbx
+  800c53:	49 8b 47 70          	mov    0x70(%r15),%rax
+  800c57:	49 8b a7 88 00 00 00 	mov    0x88(%r15),%rsp
+  800c5e:	50                   	push   %rax
+  800c5f:	9c                   	pushf
+  800c60:	58                   	pop    %rax
+  800c61:	4c 8b 7c 24 08       	mov    0x8(%rsp),%r15
+  800c66:	49 89 87 80 00 00 00 	mov    %rax,0x80(%r15)
+  800c6d:	58                   	pop    %rax
+            : "memory", "cc");
+
+    /* Check UTEMP to roughly determine that EIP was restored
+     * correctly (of course, we probably wouldn't get this far if
+     * it weren't) */
+    if (*(int *)UTEMP != 42)
+  800c6e:	83 3c 25 00 00 40 00 	cmpl   $0x2a,0x400000
+  800c75:	2a 
+  800c76:	75 48                	jne    800cc0 <umain+0x187>
+        cprintf("RIP after page-fault MISMATCH\n");
+    after.rip = before.rip;
+  800c78:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  800c7f:	00 00 00 
+  800c82:	48 bf 40 61 80 00 00 	movabs $0x806140,%rdi
+  800c89:	00 00 00 
+  800c8c:	48 8b 47 78          	mov    0x78(%rdi),%rax
+  800c90:	48 89 42 78          	mov    %rax,0x78(%rdx)
+
+    check_regs(&before, "before", &after, "after", "after page-fault");
+  800c94:	49 b8 c5 3c 80 00 00 	movabs $0x803cc5,%r8
+  800c9b:	00 00 00 
+  800c9e:	48 b9 d6 3c 80 00 00 	movabs $0x803cd6,%rcx
+  800ca5:	00 00 00 
+  800ca8:	48 be ab 3c 80 00 00 	movabs $0x803cab,%rsi
+  800caf:	00 00 00 
+  800cb2:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  800cb9:	00 00 00 
+  800cbc:	ff d0                	call   *%rax
+}
+  800cbe:	5d                   	pop    %rbp
+  800cbf:	c3                   	ret
+        cprintf("RIP after page-fault MISMATCH\n");
+  800cc0:	48 bf 18 3d 80 00 00 	movabs $0x803d18,%rdi
+  800cc7:	00 00 00 
+  800cca:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ccf:	48 ba f9 0e 80 00 00 	movabs $0x800ef9,%rdx
+  800cd6:	00 00 00 
+  800cd9:	ff d2                	call   *%rdx
+  800cdb:	eb 9b                	jmp    800c78 <umain+0x13f>
+
+0000000000800cdd <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800cdd:	55                   	push   %rbp
+  800cde:	48 89 e5             	mov    %rsp,%rbp
+  800ce1:	41 56                	push   %r14
+  800ce3:	41 55                	push   %r13
+  800ce5:	41 54                	push   %r12
+  800ce7:	53                   	push   %rbx
+  800ce8:	41 89 fd             	mov    %edi,%r13d
+  800ceb:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800cee:	48 ba d8 50 80 00 00 	movabs $0x8050d8,%rdx
+  800cf5:	00 00 00 
+  800cf8:	48 b8 d8 50 80 00 00 	movabs $0x8050d8,%rax
+  800cff:	00 00 00 
+  800d02:	48 39 c2             	cmp    %rax,%rdx
+  800d05:	73 17                	jae    800d1e <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  800d07:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  800d0a:	49 89 c4             	mov    %rax,%r12
+  800d0d:	48 83 c3 08          	add    $0x8,%rbx
+  800d11:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d16:	ff 53 f8             	call   *-0x8(%rbx)
+  800d19:	4c 39 e3             	cmp    %r12,%rbx
+  800d1c:	72 ef                	jb     800d0d <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+    envid_t this_env_id = sys_getenvid();
+  800d1e:	48 b8 0e 1d 80 00 00 	movabs $0x801d0e,%rax
+  800d25:	00 00 00 
+  800d28:	ff d0                	call   *%rax
+    thisenv = &((struct Env*)UENVS)[ENVX(this_env_id)];
+  800d2a:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800d2f:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+  800d36:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  800d3d:	00 00 00 
+  800d40:	48 01 d0             	add    %rdx,%rax
+  800d43:	48 a3 d0 61 80 00 00 	movabs %rax,0x8061d0
+  800d4a:	00 00 00 
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  800d4d:	45 85 ed             	test   %r13d,%r13d
+  800d50:	7e 0d                	jle    800d5f <libmain+0x82>
+  800d52:	49 8b 06             	mov    (%r14),%rax
+  800d55:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  800d5c:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  800d5f:	4c 89 f6             	mov    %r14,%rsi
+  800d62:	44 89 ef             	mov    %r13d,%edi
+  800d65:	48 b8 39 0b 80 00 00 	movabs $0x800b39,%rax
+  800d6c:	00 00 00 
+  800d6f:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  800d71:	48 b8 86 0d 80 00 00 	movabs $0x800d86,%rax
+  800d78:	00 00 00 
+  800d7b:	ff d0                	call   *%rax
+#endif
+}
+  800d7d:	5b                   	pop    %rbx
+  800d7e:	41 5c                	pop    %r12
+  800d80:	41 5d                	pop    %r13
+  800d82:	41 5e                	pop    %r14
+  800d84:	5d                   	pop    %rbp
+  800d85:	c3                   	ret
+
+0000000000800d86 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  800d86:	55                   	push   %rbp
+  800d87:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  800d8a:	48 b8 41 27 80 00 00 	movabs $0x802741,%rax
+  800d91:	00 00 00 
+  800d94:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  800d96:	bf 00 00 00 00       	mov    $0x0,%edi
+  800d9b:	48 b8 a3 1c 80 00 00 	movabs $0x801ca3,%rax
+  800da2:	00 00 00 
+  800da5:	ff d0                	call   *%rax
+}
+  800da7:	5d                   	pop    %rbp
+  800da8:	c3                   	ret
+
+0000000000800da9 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  800da9:	55                   	push   %rbp
+  800daa:	48 89 e5             	mov    %rsp,%rbp
+  800dad:	41 56                	push   %r14
+  800daf:	41 55                	push   %r13
+  800db1:	41 54                	push   %r12
+  800db3:	53                   	push   %rbx
+  800db4:	48 83 ec 50          	sub    $0x50,%rsp
+  800db8:	49 89 fc             	mov    %rdi,%r12
+  800dbb:	41 89 f5             	mov    %esi,%r13d
+  800dbe:	48 89 d3             	mov    %rdx,%rbx
+  800dc1:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  800dc5:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  800dc9:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800dcd:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  800dd4:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800dd8:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  800ddc:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  800de0:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  800de4:	48 b8 00 50 80 00 00 	movabs $0x805000,%rax
+  800deb:	00 00 00 
+  800dee:	4c 8b 30             	mov    (%rax),%r14
+  800df1:	48 b8 0e 1d 80 00 00 	movabs $0x801d0e,%rax
+  800df8:	00 00 00 
+  800dfb:	ff d0                	call   *%rax
+  800dfd:	89 c6                	mov    %eax,%esi
+  800dff:	45 89 e8             	mov    %r13d,%r8d
+  800e02:	4c 89 e1             	mov    %r12,%rcx
+  800e05:	4c 89 f2             	mov    %r14,%rdx
+  800e08:	48 bf 48 3d 80 00 00 	movabs $0x803d48,%rdi
+  800e0f:	00 00 00 
+  800e12:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e17:	49 bc f9 0e 80 00 00 	movabs $0x800ef9,%r12
+  800e1e:	00 00 00 
+  800e21:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  800e24:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  800e28:	48 89 df             	mov    %rbx,%rdi
+  800e2b:	48 b8 95 0e 80 00 00 	movabs $0x800e95,%rax
+  800e32:	00 00 00 
+  800e35:	ff d0                	call   *%rax
+    cprintf("\n");
+  800e37:	48 bf 3a 3c 80 00 00 	movabs $0x803c3a,%rdi
+  800e3e:	00 00 00 
+  800e41:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e46:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  800e49:	cc                   	int3
+  800e4a:	eb fd                	jmp    800e49 <_panic+0xa0>
+
+0000000000800e4c <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  800e4c:	55                   	push   %rbp
+  800e4d:	48 89 e5             	mov    %rsp,%rbp
+  800e50:	53                   	push   %rbx
+  800e51:	48 83 ec 08          	sub    $0x8,%rsp
+  800e55:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  800e58:	8b 06                	mov    (%rsi),%eax
+  800e5a:	8d 50 01             	lea    0x1(%rax),%edx
+  800e5d:	89 16                	mov    %edx,(%rsi)
+  800e5f:	48 98                	cltq
+  800e61:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  800e66:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  800e6c:	74 0a                	je     800e78 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  800e6e:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  800e72:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800e76:	c9                   	leave
+  800e77:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  800e78:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  800e7c:	be ff 00 00 00       	mov    $0xff,%esi
+  800e81:	48 b8 45 1c 80 00 00 	movabs $0x801c45,%rax
+  800e88:	00 00 00 
+  800e8b:	ff d0                	call   *%rax
+        state->offset = 0;
+  800e8d:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  800e93:	eb d9                	jmp    800e6e <putch+0x22>
+
+0000000000800e95 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  800e95:	55                   	push   %rbp
+  800e96:	48 89 e5             	mov    %rsp,%rbp
+  800e99:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  800ea0:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  800ea3:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  800eaa:	b9 21 00 00 00       	mov    $0x21,%ecx
+  800eaf:	b8 00 00 00 00       	mov    $0x0,%eax
+  800eb4:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  800eb7:	48 89 f1             	mov    %rsi,%rcx
+  800eba:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  800ec1:	48 bf 4c 0e 80 00 00 	movabs $0x800e4c,%rdi
+  800ec8:	00 00 00 
+  800ecb:	48 b8 49 10 80 00 00 	movabs $0x801049,%rax
+  800ed2:	00 00 00 
+  800ed5:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  800ed7:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  800ede:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  800ee5:	48 b8 45 1c 80 00 00 	movabs $0x801c45,%rax
+  800eec:	00 00 00 
+  800eef:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  800ef1:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  800ef7:	c9                   	leave
+  800ef8:	c3                   	ret
+
+0000000000800ef9 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  800ef9:	55                   	push   %rbp
+  800efa:	48 89 e5             	mov    %rsp,%rbp
+  800efd:	48 83 ec 50          	sub    $0x50,%rsp
+  800f01:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  800f05:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  800f09:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800f0d:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800f11:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  800f15:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  800f1c:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800f20:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800f24:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800f28:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  800f2c:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  800f30:	48 b8 95 0e 80 00 00 	movabs $0x800e95,%rax
+  800f37:	00 00 00 
+  800f3a:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  800f3c:	c9                   	leave
+  800f3d:	c3                   	ret
+
+0000000000800f3e <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  800f3e:	55                   	push   %rbp
+  800f3f:	48 89 e5             	mov    %rsp,%rbp
+  800f42:	41 57                	push   %r15
+  800f44:	41 56                	push   %r14
+  800f46:	41 55                	push   %r13
+  800f48:	41 54                	push   %r12
+  800f4a:	53                   	push   %rbx
+  800f4b:	48 83 ec 18          	sub    $0x18,%rsp
+  800f4f:	49 89 fc             	mov    %rdi,%r12
+  800f52:	49 89 f5             	mov    %rsi,%r13
+  800f55:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800f59:	8b 45 10             	mov    0x10(%rbp),%eax
+  800f5c:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  800f5f:	41 89 cf             	mov    %ecx,%r15d
+  800f62:	4c 39 fa             	cmp    %r15,%rdx
+  800f65:	73 5b                	jae    800fc2 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  800f67:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  800f6b:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  800f6f:	85 db                	test   %ebx,%ebx
+  800f71:	7e 0e                	jle    800f81 <print_num+0x43>
+            putch(padc, put_arg);
+  800f73:	4c 89 ee             	mov    %r13,%rsi
+  800f76:	44 89 f7             	mov    %r14d,%edi
+  800f79:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  800f7c:	83 eb 01             	sub    $0x1,%ebx
+  800f7f:	75 f2                	jne    800f73 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  800f81:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  800f85:	48 b9 7c 3d 80 00 00 	movabs $0x803d7c,%rcx
+  800f8c:	00 00 00 
+  800f8f:	48 b8 6b 3d 80 00 00 	movabs $0x803d6b,%rax
+  800f96:	00 00 00 
+  800f99:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  800f9d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800fa1:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fa6:	49 f7 f7             	div    %r15
+  800fa9:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  800fad:	4c 89 ee             	mov    %r13,%rsi
+  800fb0:	41 ff d4             	call   *%r12
+}
+  800fb3:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800fb7:	5b                   	pop    %rbx
+  800fb8:	41 5c                	pop    %r12
+  800fba:	41 5d                	pop    %r13
+  800fbc:	41 5e                	pop    %r14
+  800fbe:	41 5f                	pop    %r15
+  800fc0:	5d                   	pop    %rbp
+  800fc1:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  800fc2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800fc6:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fcb:	49 f7 f7             	div    %r15
+  800fce:	48 83 ec 08          	sub    $0x8,%rsp
+  800fd2:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  800fd6:	52                   	push   %rdx
+  800fd7:	45 0f be c9          	movsbl %r9b,%r9d
+  800fdb:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  800fdf:	48 89 c2             	mov    %rax,%rdx
+  800fe2:	48 b8 3e 0f 80 00 00 	movabs $0x800f3e,%rax
+  800fe9:	00 00 00 
+  800fec:	ff d0                	call   *%rax
+  800fee:	48 83 c4 10          	add    $0x10,%rsp
+  800ff2:	eb 8d                	jmp    800f81 <print_num+0x43>
+
+0000000000800ff4 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  800ff4:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  800ff8:	48 8b 06             	mov    (%rsi),%rax
+  800ffb:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  800fff:	73 0a                	jae    80100b <sprintputch+0x17>
+        *state->start++ = ch;
+  801001:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801005:	48 89 16             	mov    %rdx,(%rsi)
+  801008:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  80100b:	c3                   	ret
+
+000000000080100c <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  80100c:	55                   	push   %rbp
+  80100d:	48 89 e5             	mov    %rsp,%rbp
+  801010:	48 83 ec 50          	sub    $0x50,%rsp
+  801014:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801018:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80101c:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  801020:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  801027:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80102b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80102f:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  801033:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  801037:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80103b:	48 b8 49 10 80 00 00 	movabs $0x801049,%rax
+  801042:	00 00 00 
+  801045:	ff d0                	call   *%rax
+}
+  801047:	c9                   	leave
+  801048:	c3                   	ret
+
+0000000000801049 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  801049:	55                   	push   %rbp
+  80104a:	48 89 e5             	mov    %rsp,%rbp
+  80104d:	41 57                	push   %r15
+  80104f:	41 56                	push   %r14
+  801051:	41 55                	push   %r13
+  801053:	41 54                	push   %r12
+  801055:	53                   	push   %rbx
+  801056:	48 83 ec 38          	sub    $0x38,%rsp
+  80105a:	49 89 fe             	mov    %rdi,%r14
+  80105d:	49 89 f5             	mov    %rsi,%r13
+  801060:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  801063:	48 8b 01             	mov    (%rcx),%rax
+  801066:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  80106a:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  80106e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801072:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  801076:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  80107a:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  80107e:	0f b6 3b             	movzbl (%rbx),%edi
+  801081:	40 80 ff 25          	cmp    $0x25,%dil
+  801085:	74 18                	je     80109f <vprintfmt+0x56>
+            if (!ch) return;
+  801087:	40 84 ff             	test   %dil,%dil
+  80108a:	0f 84 b1 06 00 00    	je     801741 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  801090:	40 0f b6 ff          	movzbl %dil,%edi
+  801094:	4c 89 ee             	mov    %r13,%rsi
+  801097:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  80109a:	4c 89 e3             	mov    %r12,%rbx
+  80109d:	eb db                	jmp    80107a <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  80109f:	be 00 00 00 00       	mov    $0x0,%esi
+  8010a4:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  8010a8:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  8010ad:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8010b3:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  8010ba:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8010be:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  8010c3:	41 0f b6 04 24       	movzbl (%r12),%eax
+  8010c8:	88 45 a0             	mov    %al,-0x60(%rbp)
+  8010cb:	83 e8 23             	sub    $0x23,%eax
+  8010ce:	3c 57                	cmp    $0x57,%al
+  8010d0:	0f 87 51 06 00 00    	ja     801727 <vprintfmt+0x6de>
+  8010d6:	0f b6 c0             	movzbl %al,%eax
+  8010d9:	48 b9 40 3f 80 00 00 	movabs $0x803f40,%rcx
+  8010e0:	00 00 00 
+  8010e3:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  8010e6:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  8010e9:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  8010ed:	eb cf                	jmp    8010be <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  8010ef:	49 89 dc             	mov    %rbx,%r12
+  8010f2:	be 01 00 00 00       	mov    $0x1,%esi
+  8010f7:	eb c5                	jmp    8010be <vprintfmt+0x75>
+            padc = ch;
+  8010f9:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  8010fd:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  801100:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801103:	eb b9                	jmp    8010be <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  801105:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801108:	83 f8 2f             	cmp    $0x2f,%eax
+  80110b:	77 24                	ja     801131 <vprintfmt+0xe8>
+  80110d:	89 c1                	mov    %eax,%ecx
+  80110f:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  801113:	83 c0 08             	add    $0x8,%eax
+  801116:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801119:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  80111c:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  80111f:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  801123:	79 99                	jns    8010be <vprintfmt+0x75>
+                width = precision;
+  801125:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  801129:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  80112f:	eb 8d                	jmp    8010be <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  801131:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  801135:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  801139:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80113d:	eb da                	jmp    801119 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  80113f:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  801144:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  801148:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  80114e:	3c 39                	cmp    $0x39,%al
+  801150:	77 1c                	ja     80116e <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  801152:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  801156:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  80115a:	0f b6 c0             	movzbl %al,%eax
+  80115d:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  801162:	0f b6 03             	movzbl (%rbx),%eax
+  801165:	3c 39                	cmp    $0x39,%al
+  801167:	76 e9                	jbe    801152 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  801169:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  80116c:	eb b1                	jmp    80111f <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  80116e:	49 89 dc             	mov    %rbx,%r12
+  801171:	eb ac                	jmp    80111f <vprintfmt+0xd6>
+            width = MAX(0, width);
+  801173:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  801176:	85 c9                	test   %ecx,%ecx
+  801178:	b8 00 00 00 00       	mov    $0x0,%eax
+  80117d:	0f 49 c1             	cmovns %ecx,%eax
+  801180:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  801183:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801186:	e9 33 ff ff ff       	jmp    8010be <vprintfmt+0x75>
+            lflag++;
+  80118b:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  80118e:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801191:	e9 28 ff ff ff       	jmp    8010be <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  801196:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801199:	83 f8 2f             	cmp    $0x2f,%eax
+  80119c:	77 19                	ja     8011b7 <vprintfmt+0x16e>
+  80119e:	89 c2                	mov    %eax,%edx
+  8011a0:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8011a4:	83 c0 08             	add    $0x8,%eax
+  8011a7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8011aa:	8b 3a                	mov    (%rdx),%edi
+  8011ac:	4c 89 ee             	mov    %r13,%rsi
+  8011af:	41 ff d6             	call   *%r14
+            break;
+  8011b2:	e9 c3 fe ff ff       	jmp    80107a <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  8011b7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8011bb:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8011bf:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8011c3:	eb e5                	jmp    8011aa <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  8011c5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8011c8:	83 f8 2f             	cmp    $0x2f,%eax
+  8011cb:	77 5a                	ja     801227 <vprintfmt+0x1de>
+  8011cd:	89 c2                	mov    %eax,%edx
+  8011cf:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8011d3:	83 c0 08             	add    $0x8,%eax
+  8011d6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  8011d9:	8b 02                	mov    (%rdx),%eax
+  8011db:	89 c1                	mov    %eax,%ecx
+  8011dd:	f7 d9                	neg    %ecx
+  8011df:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  8011e2:	83 f9 15             	cmp    $0x15,%ecx
+  8011e5:	7f 4e                	jg     801235 <vprintfmt+0x1ec>
+  8011e7:	48 63 c1             	movslq %ecx,%rax
+  8011ea:	48 ba 00 42 80 00 00 	movabs $0x804200,%rdx
+  8011f1:	00 00 00 
+  8011f4:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8011f8:	48 85 c0             	test   %rax,%rax
+  8011fb:	74 38                	je     801235 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  8011fd:	48 89 c1             	mov    %rax,%rcx
+  801200:	48 ba 82 43 80 00 00 	movabs $0x804382,%rdx
+  801207:	00 00 00 
+  80120a:	4c 89 ee             	mov    %r13,%rsi
+  80120d:	4c 89 f7             	mov    %r14,%rdi
+  801210:	b8 00 00 00 00       	mov    $0x0,%eax
+  801215:	49 b8 0c 10 80 00 00 	movabs $0x80100c,%r8
+  80121c:	00 00 00 
+  80121f:	41 ff d0             	call   *%r8
+  801222:	e9 53 fe ff ff       	jmp    80107a <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  801227:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80122b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80122f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801233:	eb a4                	jmp    8011d9 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  801235:	48 ba 94 3d 80 00 00 	movabs $0x803d94,%rdx
+  80123c:	00 00 00 
+  80123f:	4c 89 ee             	mov    %r13,%rsi
+  801242:	4c 89 f7             	mov    %r14,%rdi
+  801245:	b8 00 00 00 00       	mov    $0x0,%eax
+  80124a:	49 b8 0c 10 80 00 00 	movabs $0x80100c,%r8
+  801251:	00 00 00 
+  801254:	41 ff d0             	call   *%r8
+  801257:	e9 1e fe ff ff       	jmp    80107a <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  80125c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80125f:	83 f8 2f             	cmp    $0x2f,%eax
+  801262:	77 6c                	ja     8012d0 <vprintfmt+0x287>
+  801264:	89 c2                	mov    %eax,%edx
+  801266:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80126a:	83 c0 08             	add    $0x8,%eax
+  80126d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801270:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  801273:	48 85 d2             	test   %rdx,%rdx
+  801276:	48 b8 8d 3d 80 00 00 	movabs $0x803d8d,%rax
+  80127d:	00 00 00 
+  801280:	48 0f 45 c2          	cmovne %rdx,%rax
+  801284:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  801288:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  80128c:	7e 06                	jle    801294 <vprintfmt+0x24b>
+  80128e:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  801292:	75 4a                	jne    8012de <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  801294:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  801298:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  80129c:	0f b6 00             	movzbl (%rax),%eax
+  80129f:	84 c0                	test   %al,%al
+  8012a1:	0f 85 9a 00 00 00    	jne    801341 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  8012a7:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8012aa:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  8012ae:	85 c0                	test   %eax,%eax
+  8012b0:	0f 8e c4 fd ff ff    	jle    80107a <vprintfmt+0x31>
+  8012b6:	4c 89 ee             	mov    %r13,%rsi
+  8012b9:	bf 20 00 00 00       	mov    $0x20,%edi
+  8012be:	41 ff d6             	call   *%r14
+  8012c1:	41 83 ec 01          	sub    $0x1,%r12d
+  8012c5:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  8012c9:	75 eb                	jne    8012b6 <vprintfmt+0x26d>
+  8012cb:	e9 aa fd ff ff       	jmp    80107a <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8012d0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8012d4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8012d8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8012dc:	eb 92                	jmp    801270 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  8012de:	49 63 f7             	movslq %r15d,%rsi
+  8012e1:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  8012e5:	48 b8 fb 17 80 00 00 	movabs $0x8017fb,%rax
+  8012ec:	00 00 00 
+  8012ef:	ff d0                	call   *%rax
+  8012f1:	48 89 c2             	mov    %rax,%rdx
+  8012f4:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8012f7:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  8012f9:	8d 70 ff             	lea    -0x1(%rax),%esi
+  8012fc:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  8012ff:	85 c0                	test   %eax,%eax
+  801301:	7e 91                	jle    801294 <vprintfmt+0x24b>
+  801303:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  801308:	4c 89 ee             	mov    %r13,%rsi
+  80130b:	44 89 e7             	mov    %r12d,%edi
+  80130e:	41 ff d6             	call   *%r14
+  801311:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  801315:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801318:	83 f8 ff             	cmp    $0xffffffff,%eax
+  80131b:	75 eb                	jne    801308 <vprintfmt+0x2bf>
+  80131d:	e9 72 ff ff ff       	jmp    801294 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  801322:	0f b6 f8             	movzbl %al,%edi
+  801325:	4c 89 ee             	mov    %r13,%rsi
+  801328:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  80132b:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  80132f:	49 83 c4 01          	add    $0x1,%r12
+  801333:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  801339:	84 c0                	test   %al,%al
+  80133b:	0f 84 66 ff ff ff    	je     8012a7 <vprintfmt+0x25e>
+  801341:	45 85 ff             	test   %r15d,%r15d
+  801344:	78 0a                	js     801350 <vprintfmt+0x307>
+  801346:	41 83 ef 01          	sub    $0x1,%r15d
+  80134a:	0f 88 57 ff ff ff    	js     8012a7 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  801350:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  801354:	74 cc                	je     801322 <vprintfmt+0x2d9>
+  801356:	8d 50 e0             	lea    -0x20(%rax),%edx
+  801359:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  80135e:	80 fa 5e             	cmp    $0x5e,%dl
+  801361:	77 c2                	ja     801325 <vprintfmt+0x2dc>
+  801363:	eb bd                	jmp    801322 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  801365:	40 84 f6             	test   %sil,%sil
+  801368:	75 26                	jne    801390 <vprintfmt+0x347>
+    switch (lflag) {
+  80136a:	85 d2                	test   %edx,%edx
+  80136c:	74 59                	je     8013c7 <vprintfmt+0x37e>
+  80136e:	83 fa 01             	cmp    $0x1,%edx
+  801371:	74 7b                	je     8013ee <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  801373:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801376:	83 f8 2f             	cmp    $0x2f,%eax
+  801379:	0f 87 96 00 00 00    	ja     801415 <vprintfmt+0x3cc>
+  80137f:	89 c2                	mov    %eax,%edx
+  801381:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801385:	83 c0 08             	add    $0x8,%eax
+  801388:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80138b:	4c 8b 22             	mov    (%rdx),%r12
+  80138e:	eb 17                	jmp    8013a7 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  801390:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801393:	83 f8 2f             	cmp    $0x2f,%eax
+  801396:	77 21                	ja     8013b9 <vprintfmt+0x370>
+  801398:	89 c2                	mov    %eax,%edx
+  80139a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80139e:	83 c0 08             	add    $0x8,%eax
+  8013a1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8013a4:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  8013a7:	4d 85 e4             	test   %r12,%r12
+  8013aa:	78 7a                	js     801426 <vprintfmt+0x3dd>
+            num = i;
+  8013ac:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  8013af:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  8013b4:	e9 50 02 00 00       	jmp    801609 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8013b9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8013bd:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8013c1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8013c5:	eb dd                	jmp    8013a4 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  8013c7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8013ca:	83 f8 2f             	cmp    $0x2f,%eax
+  8013cd:	77 11                	ja     8013e0 <vprintfmt+0x397>
+  8013cf:	89 c2                	mov    %eax,%edx
+  8013d1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8013d5:	83 c0 08             	add    $0x8,%eax
+  8013d8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8013db:	4c 63 22             	movslq (%rdx),%r12
+  8013de:	eb c7                	jmp    8013a7 <vprintfmt+0x35e>
+  8013e0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8013e4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8013e8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8013ec:	eb ed                	jmp    8013db <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  8013ee:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8013f1:	83 f8 2f             	cmp    $0x2f,%eax
+  8013f4:	77 11                	ja     801407 <vprintfmt+0x3be>
+  8013f6:	89 c2                	mov    %eax,%edx
+  8013f8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8013fc:	83 c0 08             	add    $0x8,%eax
+  8013ff:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801402:	4c 8b 22             	mov    (%rdx),%r12
+  801405:	eb a0                	jmp    8013a7 <vprintfmt+0x35e>
+  801407:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80140b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80140f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801413:	eb ed                	jmp    801402 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  801415:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801419:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80141d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801421:	e9 65 ff ff ff       	jmp    80138b <vprintfmt+0x342>
+                putch('-', put_arg);
+  801426:	4c 89 ee             	mov    %r13,%rsi
+  801429:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  80142e:	41 ff d6             	call   *%r14
+                i = -i;
+  801431:	49 f7 dc             	neg    %r12
+  801434:	e9 73 ff ff ff       	jmp    8013ac <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  801439:	40 84 f6             	test   %sil,%sil
+  80143c:	75 32                	jne    801470 <vprintfmt+0x427>
+    switch (lflag) {
+  80143e:	85 d2                	test   %edx,%edx
+  801440:	74 5d                	je     80149f <vprintfmt+0x456>
+  801442:	83 fa 01             	cmp    $0x1,%edx
+  801445:	0f 84 82 00 00 00    	je     8014cd <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  80144b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80144e:	83 f8 2f             	cmp    $0x2f,%eax
+  801451:	0f 87 a5 00 00 00    	ja     8014fc <vprintfmt+0x4b3>
+  801457:	89 c2                	mov    %eax,%edx
+  801459:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80145d:	83 c0 08             	add    $0x8,%eax
+  801460:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801463:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  801466:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  80146b:	e9 99 01 00 00       	jmp    801609 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  801470:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801473:	83 f8 2f             	cmp    $0x2f,%eax
+  801476:	77 19                	ja     801491 <vprintfmt+0x448>
+  801478:	89 c2                	mov    %eax,%edx
+  80147a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80147e:	83 c0 08             	add    $0x8,%eax
+  801481:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801484:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  801487:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  80148c:	e9 78 01 00 00       	jmp    801609 <vprintfmt+0x5c0>
+  801491:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801495:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801499:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80149d:	eb e5                	jmp    801484 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  80149f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8014a2:	83 f8 2f             	cmp    $0x2f,%eax
+  8014a5:	77 18                	ja     8014bf <vprintfmt+0x476>
+  8014a7:	89 c2                	mov    %eax,%edx
+  8014a9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8014ad:	83 c0 08             	add    $0x8,%eax
+  8014b0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8014b3:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  8014b5:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  8014ba:	e9 4a 01 00 00       	jmp    801609 <vprintfmt+0x5c0>
+  8014bf:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8014c3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8014c7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8014cb:	eb e6                	jmp    8014b3 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  8014cd:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8014d0:	83 f8 2f             	cmp    $0x2f,%eax
+  8014d3:	77 19                	ja     8014ee <vprintfmt+0x4a5>
+  8014d5:	89 c2                	mov    %eax,%edx
+  8014d7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8014db:	83 c0 08             	add    $0x8,%eax
+  8014de:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8014e1:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8014e4:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  8014e9:	e9 1b 01 00 00       	jmp    801609 <vprintfmt+0x5c0>
+  8014ee:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8014f2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8014f6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8014fa:	eb e5                	jmp    8014e1 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  8014fc:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801500:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801504:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801508:	e9 56 ff ff ff       	jmp    801463 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  80150d:	40 84 f6             	test   %sil,%sil
+  801510:	75 2e                	jne    801540 <vprintfmt+0x4f7>
+    switch (lflag) {
+  801512:	85 d2                	test   %edx,%edx
+  801514:	74 59                	je     80156f <vprintfmt+0x526>
+  801516:	83 fa 01             	cmp    $0x1,%edx
+  801519:	74 7f                	je     80159a <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  80151b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80151e:	83 f8 2f             	cmp    $0x2f,%eax
+  801521:	0f 87 9f 00 00 00    	ja     8015c6 <vprintfmt+0x57d>
+  801527:	89 c2                	mov    %eax,%edx
+  801529:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80152d:	83 c0 08             	add    $0x8,%eax
+  801530:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801533:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  801536:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  80153b:	e9 c9 00 00 00       	jmp    801609 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  801540:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801543:	83 f8 2f             	cmp    $0x2f,%eax
+  801546:	77 19                	ja     801561 <vprintfmt+0x518>
+  801548:	89 c2                	mov    %eax,%edx
+  80154a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80154e:	83 c0 08             	add    $0x8,%eax
+  801551:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801554:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  801557:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  80155c:	e9 a8 00 00 00       	jmp    801609 <vprintfmt+0x5c0>
+  801561:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801565:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801569:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80156d:	eb e5                	jmp    801554 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  80156f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801572:	83 f8 2f             	cmp    $0x2f,%eax
+  801575:	77 15                	ja     80158c <vprintfmt+0x543>
+  801577:	89 c2                	mov    %eax,%edx
+  801579:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80157d:	83 c0 08             	add    $0x8,%eax
+  801580:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801583:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  801585:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  80158a:	eb 7d                	jmp    801609 <vprintfmt+0x5c0>
+  80158c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801590:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801594:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801598:	eb e9                	jmp    801583 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  80159a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80159d:	83 f8 2f             	cmp    $0x2f,%eax
+  8015a0:	77 16                	ja     8015b8 <vprintfmt+0x56f>
+  8015a2:	89 c2                	mov    %eax,%edx
+  8015a4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8015a8:	83 c0 08             	add    $0x8,%eax
+  8015ab:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8015ae:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8015b1:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  8015b6:	eb 51                	jmp    801609 <vprintfmt+0x5c0>
+  8015b8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8015bc:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8015c0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8015c4:	eb e8                	jmp    8015ae <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  8015c6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8015ca:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8015ce:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8015d2:	e9 5c ff ff ff       	jmp    801533 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  8015d7:	4c 89 ee             	mov    %r13,%rsi
+  8015da:	bf 30 00 00 00       	mov    $0x30,%edi
+  8015df:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  8015e2:	4c 89 ee             	mov    %r13,%rsi
+  8015e5:	bf 78 00 00 00       	mov    $0x78,%edi
+  8015ea:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  8015ed:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8015f0:	83 f8 2f             	cmp    $0x2f,%eax
+  8015f3:	77 47                	ja     80163c <vprintfmt+0x5f3>
+  8015f5:	89 c2                	mov    %eax,%edx
+  8015f7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8015fb:	83 c0 08             	add    $0x8,%eax
+  8015fe:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801601:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  801604:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  801609:	48 83 ec 08          	sub    $0x8,%rsp
+  80160d:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  801611:	0f 94 c0             	sete   %al
+  801614:	0f b6 c0             	movzbl %al,%eax
+  801617:	50                   	push   %rax
+  801618:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  80161d:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  801621:	4c 89 ee             	mov    %r13,%rsi
+  801624:	4c 89 f7             	mov    %r14,%rdi
+  801627:	48 b8 3e 0f 80 00 00 	movabs $0x800f3e,%rax
+  80162e:	00 00 00 
+  801631:	ff d0                	call   *%rax
+            break;
+  801633:	48 83 c4 10          	add    $0x10,%rsp
+  801637:	e9 3e fa ff ff       	jmp    80107a <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  80163c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801640:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801644:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801648:	eb b7                	jmp    801601 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  80164a:	40 84 f6             	test   %sil,%sil
+  80164d:	75 2b                	jne    80167a <vprintfmt+0x631>
+    switch (lflag) {
+  80164f:	85 d2                	test   %edx,%edx
+  801651:	74 56                	je     8016a9 <vprintfmt+0x660>
+  801653:	83 fa 01             	cmp    $0x1,%edx
+  801656:	74 7f                	je     8016d7 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  801658:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80165b:	83 f8 2f             	cmp    $0x2f,%eax
+  80165e:	0f 87 a2 00 00 00    	ja     801706 <vprintfmt+0x6bd>
+  801664:	89 c2                	mov    %eax,%edx
+  801666:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80166a:	83 c0 08             	add    $0x8,%eax
+  80166d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801670:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  801673:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  801678:	eb 8f                	jmp    801609 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  80167a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80167d:	83 f8 2f             	cmp    $0x2f,%eax
+  801680:	77 19                	ja     80169b <vprintfmt+0x652>
+  801682:	89 c2                	mov    %eax,%edx
+  801684:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801688:	83 c0 08             	add    $0x8,%eax
+  80168b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80168e:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  801691:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  801696:	e9 6e ff ff ff       	jmp    801609 <vprintfmt+0x5c0>
+  80169b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80169f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8016a3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8016a7:	eb e5                	jmp    80168e <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  8016a9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8016ac:	83 f8 2f             	cmp    $0x2f,%eax
+  8016af:	77 18                	ja     8016c9 <vprintfmt+0x680>
+  8016b1:	89 c2                	mov    %eax,%edx
+  8016b3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8016b7:	83 c0 08             	add    $0x8,%eax
+  8016ba:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8016bd:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  8016bf:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  8016c4:	e9 40 ff ff ff       	jmp    801609 <vprintfmt+0x5c0>
+  8016c9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8016cd:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8016d1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8016d5:	eb e6                	jmp    8016bd <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  8016d7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8016da:	83 f8 2f             	cmp    $0x2f,%eax
+  8016dd:	77 19                	ja     8016f8 <vprintfmt+0x6af>
+  8016df:	89 c2                	mov    %eax,%edx
+  8016e1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8016e5:	83 c0 08             	add    $0x8,%eax
+  8016e8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8016eb:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8016ee:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  8016f3:	e9 11 ff ff ff       	jmp    801609 <vprintfmt+0x5c0>
+  8016f8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8016fc:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801700:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801704:	eb e5                	jmp    8016eb <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  801706:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80170a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80170e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801712:	e9 59 ff ff ff       	jmp    801670 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  801717:	4c 89 ee             	mov    %r13,%rsi
+  80171a:	bf 25 00 00 00       	mov    $0x25,%edi
+  80171f:	41 ff d6             	call   *%r14
+            break;
+  801722:	e9 53 f9 ff ff       	jmp    80107a <vprintfmt+0x31>
+            putch('%', put_arg);
+  801727:	4c 89 ee             	mov    %r13,%rsi
+  80172a:	bf 25 00 00 00       	mov    $0x25,%edi
+  80172f:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  801732:	48 83 eb 01          	sub    $0x1,%rbx
+  801736:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  80173a:	75 f6                	jne    801732 <vprintfmt+0x6e9>
+  80173c:	e9 39 f9 ff ff       	jmp    80107a <vprintfmt+0x31>
+}
+  801741:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  801745:	5b                   	pop    %rbx
+  801746:	41 5c                	pop    %r12
+  801748:	41 5d                	pop    %r13
+  80174a:	41 5e                	pop    %r14
+  80174c:	41 5f                	pop    %r15
+  80174e:	5d                   	pop    %rbp
+  80174f:	c3                   	ret
+
+0000000000801750 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  801750:	55                   	push   %rbp
+  801751:	48 89 e5             	mov    %rsp,%rbp
+  801754:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  801758:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80175c:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  801761:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  801765:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  80176c:	48 85 ff             	test   %rdi,%rdi
+  80176f:	74 2b                	je     80179c <vsnprintf+0x4c>
+  801771:	48 85 f6             	test   %rsi,%rsi
+  801774:	74 26                	je     80179c <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  801776:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80177a:	48 bf f4 0f 80 00 00 	movabs $0x800ff4,%rdi
+  801781:	00 00 00 
+  801784:	48 b8 49 10 80 00 00 	movabs $0x801049,%rax
+  80178b:	00 00 00 
+  80178e:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  801790:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801794:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  801797:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  80179a:	c9                   	leave
+  80179b:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  80179c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8017a1:	eb f7                	jmp    80179a <vsnprintf+0x4a>
+
+00000000008017a3 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  8017a3:	55                   	push   %rbp
+  8017a4:	48 89 e5             	mov    %rsp,%rbp
+  8017a7:	48 83 ec 50          	sub    $0x50,%rsp
+  8017ab:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8017af:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8017b3:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  8017b7:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8017be:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8017c2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8017c6:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8017ca:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  8017ce:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8017d2:	48 b8 50 17 80 00 00 	movabs $0x801750,%rax
+  8017d9:	00 00 00 
+  8017dc:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  8017de:	c9                   	leave
+  8017df:	c3                   	ret
+
+00000000008017e0 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  8017e0:	80 3f 00             	cmpb   $0x0,(%rdi)
+  8017e3:	74 10                	je     8017f5 <strlen+0x15>
+    size_t n = 0;
+  8017e5:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  8017ea:	48 83 c0 01          	add    $0x1,%rax
+  8017ee:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  8017f2:	75 f6                	jne    8017ea <strlen+0xa>
+  8017f4:	c3                   	ret
+    size_t n = 0;
+  8017f5:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  8017fa:	c3                   	ret
+
+00000000008017fb <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  8017fb:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  8017fe:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  801803:	48 85 f6             	test   %rsi,%rsi
+  801806:	74 11                	je     801819 <strnlen+0x1e>
+  801808:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  80180c:	74 0c                	je     80181a <strnlen+0x1f>
+  80180e:	48 83 c2 01          	add    $0x1,%rdx
+  801812:	48 39 d0             	cmp    %rdx,%rax
+  801815:	75 f1                	jne    801808 <strnlen+0xd>
+  801817:	eb 04                	jmp    80181d <strnlen+0x22>
+  801819:	c3                   	ret
+  80181a:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  80181d:	c3                   	ret
+
+000000000080181e <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  80181e:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  801821:	ba 00 00 00 00       	mov    $0x0,%edx
+  801826:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  80182a:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  80182d:	48 83 c2 01          	add    $0x1,%rdx
+  801831:	84 c9                	test   %cl,%cl
+  801833:	75 f1                	jne    801826 <strcpy+0x8>
+        ;
+    return res;
+}
+  801835:	c3                   	ret
+
+0000000000801836 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  801836:	55                   	push   %rbp
+  801837:	48 89 e5             	mov    %rsp,%rbp
+  80183a:	41 54                	push   %r12
+  80183c:	53                   	push   %rbx
+  80183d:	48 89 fb             	mov    %rdi,%rbx
+  801840:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  801843:	48 b8 e0 17 80 00 00 	movabs $0x8017e0,%rax
+  80184a:	00 00 00 
+  80184d:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  80184f:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  801853:	4c 89 e6             	mov    %r12,%rsi
+  801856:	48 b8 1e 18 80 00 00 	movabs $0x80181e,%rax
+  80185d:	00 00 00 
+  801860:	ff d0                	call   *%rax
+    return dst;
+}
+  801862:	48 89 d8             	mov    %rbx,%rax
+  801865:	5b                   	pop    %rbx
+  801866:	41 5c                	pop    %r12
+  801868:	5d                   	pop    %rbp
+  801869:	c3                   	ret
+
+000000000080186a <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  80186a:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  80186d:	48 85 d2             	test   %rdx,%rdx
+  801870:	74 1f                	je     801891 <strncpy+0x27>
+  801872:	48 01 fa             	add    %rdi,%rdx
+  801875:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  801878:	48 83 c1 01          	add    $0x1,%rcx
+  80187c:	44 0f b6 06          	movzbl (%rsi),%r8d
+  801880:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  801884:	41 80 f8 01          	cmp    $0x1,%r8b
+  801888:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  80188c:	48 39 ca             	cmp    %rcx,%rdx
+  80188f:	75 e7                	jne    801878 <strncpy+0xe>
+    }
+    return ret;
+}
+  801891:	c3                   	ret
+
+0000000000801892 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  801892:	48 89 f8             	mov    %rdi,%rax
+  801895:	48 85 d2             	test   %rdx,%rdx
+  801898:	74 24                	je     8018be <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  80189a:	48 83 ea 01          	sub    $0x1,%rdx
+  80189e:	74 1b                	je     8018bb <strlcpy+0x29>
+  8018a0:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  8018a4:	0f b6 16             	movzbl (%rsi),%edx
+  8018a7:	84 d2                	test   %dl,%dl
+  8018a9:	74 10                	je     8018bb <strlcpy+0x29>
+            *dst++ = *src++;
+  8018ab:	48 83 c6 01          	add    $0x1,%rsi
+  8018af:	48 83 c0 01          	add    $0x1,%rax
+  8018b3:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  8018b6:	48 39 c8             	cmp    %rcx,%rax
+  8018b9:	75 e9                	jne    8018a4 <strlcpy+0x12>
+        *dst = '\0';
+  8018bb:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  8018be:	48 29 f8             	sub    %rdi,%rax
+}
+  8018c1:	c3                   	ret
+
+00000000008018c2 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  8018c2:	0f b6 07             	movzbl (%rdi),%eax
+  8018c5:	84 c0                	test   %al,%al
+  8018c7:	74 13                	je     8018dc <strcmp+0x1a>
+  8018c9:	38 06                	cmp    %al,(%rsi)
+  8018cb:	75 0f                	jne    8018dc <strcmp+0x1a>
+  8018cd:	48 83 c7 01          	add    $0x1,%rdi
+  8018d1:	48 83 c6 01          	add    $0x1,%rsi
+  8018d5:	0f b6 07             	movzbl (%rdi),%eax
+  8018d8:	84 c0                	test   %al,%al
+  8018da:	75 ed                	jne    8018c9 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  8018dc:	0f b6 c0             	movzbl %al,%eax
+  8018df:	0f b6 16             	movzbl (%rsi),%edx
+  8018e2:	29 d0                	sub    %edx,%eax
+}
+  8018e4:	c3                   	ret
+
+00000000008018e5 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  8018e5:	48 85 d2             	test   %rdx,%rdx
+  8018e8:	74 1f                	je     801909 <strncmp+0x24>
+  8018ea:	0f b6 07             	movzbl (%rdi),%eax
+  8018ed:	84 c0                	test   %al,%al
+  8018ef:	74 1e                	je     80190f <strncmp+0x2a>
+  8018f1:	3a 06                	cmp    (%rsi),%al
+  8018f3:	75 1a                	jne    80190f <strncmp+0x2a>
+  8018f5:	48 83 c7 01          	add    $0x1,%rdi
+  8018f9:	48 83 c6 01          	add    $0x1,%rsi
+  8018fd:	48 83 ea 01          	sub    $0x1,%rdx
+  801901:	75 e7                	jne    8018ea <strncmp+0x5>
+
+    if (!n) return 0;
+  801903:	b8 00 00 00 00       	mov    $0x0,%eax
+  801908:	c3                   	ret
+  801909:	b8 00 00 00 00       	mov    $0x0,%eax
+  80190e:	c3                   	ret
+  80190f:	48 85 d2             	test   %rdx,%rdx
+  801912:	74 09                	je     80191d <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  801914:	0f b6 07             	movzbl (%rdi),%eax
+  801917:	0f b6 16             	movzbl (%rsi),%edx
+  80191a:	29 d0                	sub    %edx,%eax
+  80191c:	c3                   	ret
+    if (!n) return 0;
+  80191d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801922:	c3                   	ret
+
+0000000000801923 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  801923:	0f b6 17             	movzbl (%rdi),%edx
+  801926:	84 d2                	test   %dl,%dl
+  801928:	74 18                	je     801942 <strchr+0x1f>
+        if (*str == c) {
+  80192a:	0f be d2             	movsbl %dl,%edx
+  80192d:	39 f2                	cmp    %esi,%edx
+  80192f:	74 17                	je     801948 <strchr+0x25>
+    for (; *str; str++) {
+  801931:	48 83 c7 01          	add    $0x1,%rdi
+  801935:	0f b6 17             	movzbl (%rdi),%edx
+  801938:	84 d2                	test   %dl,%dl
+  80193a:	75 ee                	jne    80192a <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  80193c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801941:	c3                   	ret
+  801942:	b8 00 00 00 00       	mov    $0x0,%eax
+  801947:	c3                   	ret
+  801948:	48 89 f8             	mov    %rdi,%rax
+}
+  80194b:	c3                   	ret
+
+000000000080194c <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  80194c:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  80194f:	0f b6 17             	movzbl (%rdi),%edx
+  801952:	84 d2                	test   %dl,%dl
+  801954:	74 13                	je     801969 <strfind+0x1d>
+  801956:	0f be d2             	movsbl %dl,%edx
+  801959:	39 f2                	cmp    %esi,%edx
+  80195b:	74 0b                	je     801968 <strfind+0x1c>
+  80195d:	48 83 c0 01          	add    $0x1,%rax
+  801961:	0f b6 10             	movzbl (%rax),%edx
+  801964:	84 d2                	test   %dl,%dl
+  801966:	75 ee                	jne    801956 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  801968:	c3                   	ret
+  801969:	c3                   	ret
+
+000000000080196a <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  80196a:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  80196d:	48 89 f8             	mov    %rdi,%rax
+  801970:	48 f7 d8             	neg    %rax
+  801973:	83 e0 07             	and    $0x7,%eax
+  801976:	49 89 d1             	mov    %rdx,%r9
+  801979:	49 29 c1             	sub    %rax,%r9
+  80197c:	78 36                	js     8019b4 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  80197e:	40 0f b6 c6          	movzbl %sil,%eax
+  801982:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  801989:	01 01 01 
+  80198c:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  801990:	40 f6 c7 07          	test   $0x7,%dil
+  801994:	75 38                	jne    8019ce <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  801996:	4c 89 c9             	mov    %r9,%rcx
+  801999:	48 c1 f9 03          	sar    $0x3,%rcx
+  80199d:	74 0c                	je     8019ab <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  80199f:	fc                   	cld
+  8019a0:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  8019a3:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  8019a7:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  8019ab:	4d 85 c9             	test   %r9,%r9
+  8019ae:	75 45                	jne    8019f5 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  8019b0:	4c 89 c0             	mov    %r8,%rax
+  8019b3:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  8019b4:	48 85 d2             	test   %rdx,%rdx
+  8019b7:	74 f7                	je     8019b0 <memset+0x46>
+  8019b9:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  8019bc:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  8019bf:	48 83 c0 01          	add    $0x1,%rax
+  8019c3:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  8019c7:	48 39 c2             	cmp    %rax,%rdx
+  8019ca:	75 f3                	jne    8019bf <memset+0x55>
+  8019cc:	eb e2                	jmp    8019b0 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  8019ce:	40 f6 c7 01          	test   $0x1,%dil
+  8019d2:	74 06                	je     8019da <memset+0x70>
+  8019d4:	88 07                	mov    %al,(%rdi)
+  8019d6:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  8019da:	40 f6 c7 02          	test   $0x2,%dil
+  8019de:	74 07                	je     8019e7 <memset+0x7d>
+  8019e0:	66 89 07             	mov    %ax,(%rdi)
+  8019e3:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  8019e7:	40 f6 c7 04          	test   $0x4,%dil
+  8019eb:	74 a9                	je     801996 <memset+0x2c>
+  8019ed:	89 07                	mov    %eax,(%rdi)
+  8019ef:	48 83 c7 04          	add    $0x4,%rdi
+  8019f3:	eb a1                	jmp    801996 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  8019f5:	41 f6 c1 04          	test   $0x4,%r9b
+  8019f9:	74 06                	je     801a01 <memset+0x97>
+  8019fb:	89 07                	mov    %eax,(%rdi)
+  8019fd:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  801a01:	41 f6 c1 02          	test   $0x2,%r9b
+  801a05:	74 07                	je     801a0e <memset+0xa4>
+  801a07:	66 89 07             	mov    %ax,(%rdi)
+  801a0a:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  801a0e:	41 f6 c1 01          	test   $0x1,%r9b
+  801a12:	74 9c                	je     8019b0 <memset+0x46>
+  801a14:	88 07                	mov    %al,(%rdi)
+  801a16:	eb 98                	jmp    8019b0 <memset+0x46>
+
+0000000000801a18 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  801a18:	48 89 f8             	mov    %rdi,%rax
+  801a1b:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  801a1e:	48 39 fe             	cmp    %rdi,%rsi
+  801a21:	73 3b                	jae    801a5e <memmove+0x46>
+  801a23:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  801a27:	48 39 d7             	cmp    %rdx,%rdi
+  801a2a:	73 32                	jae    801a5e <memmove+0x46>
+        s += n;
+        d += n;
+  801a2c:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  801a30:	48 89 d6             	mov    %rdx,%rsi
+  801a33:	48 09 fe             	or     %rdi,%rsi
+  801a36:	48 09 ce             	or     %rcx,%rsi
+  801a39:	40 f6 c6 07          	test   $0x7,%sil
+  801a3d:	75 12                	jne    801a51 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  801a3f:	48 83 ef 08          	sub    $0x8,%rdi
+  801a43:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  801a47:	48 c1 e9 03          	shr    $0x3,%rcx
+  801a4b:	fd                   	std
+  801a4c:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  801a4f:	fc                   	cld
+  801a50:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  801a51:	48 83 ef 01          	sub    $0x1,%rdi
+  801a55:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  801a59:	fd                   	std
+  801a5a:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  801a5c:	eb f1                	jmp    801a4f <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  801a5e:	48 89 f2             	mov    %rsi,%rdx
+  801a61:	48 09 c2             	or     %rax,%rdx
+  801a64:	48 09 ca             	or     %rcx,%rdx
+  801a67:	f6 c2 07             	test   $0x7,%dl
+  801a6a:	75 0c                	jne    801a78 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  801a6c:	48 c1 e9 03          	shr    $0x3,%rcx
+  801a70:	48 89 c7             	mov    %rax,%rdi
+  801a73:	fc                   	cld
+  801a74:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  801a77:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  801a78:	48 89 c7             	mov    %rax,%rdi
+  801a7b:	fc                   	cld
+  801a7c:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  801a7e:	c3                   	ret
+
+0000000000801a7f <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  801a7f:	55                   	push   %rbp
+  801a80:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  801a83:	48 b8 18 1a 80 00 00 	movabs $0x801a18,%rax
+  801a8a:	00 00 00 
+  801a8d:	ff d0                	call   *%rax
+}
+  801a8f:	5d                   	pop    %rbp
+  801a90:	c3                   	ret
+
+0000000000801a91 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  801a91:	55                   	push   %rbp
+  801a92:	48 89 e5             	mov    %rsp,%rbp
+  801a95:	41 57                	push   %r15
+  801a97:	41 56                	push   %r14
+  801a99:	41 55                	push   %r13
+  801a9b:	41 54                	push   %r12
+  801a9d:	53                   	push   %rbx
+  801a9e:	48 83 ec 08          	sub    $0x8,%rsp
+  801aa2:	49 89 fe             	mov    %rdi,%r14
+  801aa5:	49 89 f7             	mov    %rsi,%r15
+  801aa8:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  801aab:	48 89 f7             	mov    %rsi,%rdi
+  801aae:	48 b8 e0 17 80 00 00 	movabs $0x8017e0,%rax
+  801ab5:	00 00 00 
+  801ab8:	ff d0                	call   *%rax
+  801aba:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  801abd:	48 89 de             	mov    %rbx,%rsi
+  801ac0:	4c 89 f7             	mov    %r14,%rdi
+  801ac3:	48 b8 fb 17 80 00 00 	movabs $0x8017fb,%rax
+  801aca:	00 00 00 
+  801acd:	ff d0                	call   *%rax
+  801acf:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  801ad2:	48 39 c3             	cmp    %rax,%rbx
+  801ad5:	74 36                	je     801b0d <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  801ad7:	48 89 d8             	mov    %rbx,%rax
+  801ada:	4c 29 e8             	sub    %r13,%rax
+  801add:	49 39 c4             	cmp    %rax,%r12
+  801ae0:	73 31                	jae    801b13 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  801ae2:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  801ae7:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  801aeb:	4c 89 fe             	mov    %r15,%rsi
+  801aee:	48 b8 7f 1a 80 00 00 	movabs $0x801a7f,%rax
+  801af5:	00 00 00 
+  801af8:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  801afa:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  801afe:	48 83 c4 08          	add    $0x8,%rsp
+  801b02:	5b                   	pop    %rbx
+  801b03:	41 5c                	pop    %r12
+  801b05:	41 5d                	pop    %r13
+  801b07:	41 5e                	pop    %r14
+  801b09:	41 5f                	pop    %r15
+  801b0b:	5d                   	pop    %rbp
+  801b0c:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  801b0d:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  801b11:	eb eb                	jmp    801afe <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  801b13:	48 83 eb 01          	sub    $0x1,%rbx
+  801b17:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  801b1b:	48 89 da             	mov    %rbx,%rdx
+  801b1e:	4c 89 fe             	mov    %r15,%rsi
+  801b21:	48 b8 7f 1a 80 00 00 	movabs $0x801a7f,%rax
+  801b28:	00 00 00 
+  801b2b:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  801b2d:	49 01 de             	add    %rbx,%r14
+  801b30:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  801b35:	eb c3                	jmp    801afa <strlcat+0x69>
+
+0000000000801b37 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  801b37:	48 85 d2             	test   %rdx,%rdx
+  801b3a:	74 2d                	je     801b69 <memcmp+0x32>
+  801b3c:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  801b41:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  801b45:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  801b4a:	44 38 c1             	cmp    %r8b,%cl
+  801b4d:	75 0f                	jne    801b5e <memcmp+0x27>
+    while (n-- > 0) {
+  801b4f:	48 83 c0 01          	add    $0x1,%rax
+  801b53:	48 39 c2             	cmp    %rax,%rdx
+  801b56:	75 e9                	jne    801b41 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  801b58:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b5d:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  801b5e:	0f b6 c1             	movzbl %cl,%eax
+  801b61:	45 0f b6 c0          	movzbl %r8b,%r8d
+  801b65:	44 29 c0             	sub    %r8d,%eax
+  801b68:	c3                   	ret
+    return 0;
+  801b69:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801b6e:	c3                   	ret
+
+0000000000801b6f <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  801b6f:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  801b73:	48 39 c7             	cmp    %rax,%rdi
+  801b76:	73 0f                	jae    801b87 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  801b78:	40 38 37             	cmp    %sil,(%rdi)
+  801b7b:	74 0e                	je     801b8b <memfind+0x1c>
+    for (; src < end; src++) {
+  801b7d:	48 83 c7 01          	add    $0x1,%rdi
+  801b81:	48 39 f8             	cmp    %rdi,%rax
+  801b84:	75 f2                	jne    801b78 <memfind+0x9>
+  801b86:	c3                   	ret
+  801b87:	48 89 f8             	mov    %rdi,%rax
+  801b8a:	c3                   	ret
+  801b8b:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  801b8e:	c3                   	ret
+
+0000000000801b8f <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  801b8f:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  801b92:	0f b6 37             	movzbl (%rdi),%esi
+  801b95:	40 80 fe 20          	cmp    $0x20,%sil
+  801b99:	74 06                	je     801ba1 <strtol+0x12>
+  801b9b:	40 80 fe 09          	cmp    $0x9,%sil
+  801b9f:	75 13                	jne    801bb4 <strtol+0x25>
+  801ba1:	48 83 c7 01          	add    $0x1,%rdi
+  801ba5:	0f b6 37             	movzbl (%rdi),%esi
+  801ba8:	40 80 fe 20          	cmp    $0x20,%sil
+  801bac:	74 f3                	je     801ba1 <strtol+0x12>
+  801bae:	40 80 fe 09          	cmp    $0x9,%sil
+  801bb2:	74 ed                	je     801ba1 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  801bb4:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  801bb7:	83 e0 fd             	and    $0xfffffffd,%eax
+  801bba:	3c 01                	cmp    $0x1,%al
+  801bbc:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801bc0:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  801bc6:	75 0f                	jne    801bd7 <strtol+0x48>
+  801bc8:	80 3f 30             	cmpb   $0x30,(%rdi)
+  801bcb:	74 14                	je     801be1 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  801bcd:	85 d2                	test   %edx,%edx
+  801bcf:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801bd4:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  801bd7:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  801bdc:	4c 63 ca             	movslq %edx,%r9
+  801bdf:	eb 36                	jmp    801c17 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801be1:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  801be5:	74 0f                	je     801bf6 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  801be7:	85 d2                	test   %edx,%edx
+  801be9:	75 ec                	jne    801bd7 <strtol+0x48>
+        s++;
+  801beb:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  801bef:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  801bf4:	eb e1                	jmp    801bd7 <strtol+0x48>
+        s += 2;
+  801bf6:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  801bfa:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  801bff:	eb d6                	jmp    801bd7 <strtol+0x48>
+            dig -= '0';
+  801c01:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  801c04:	44 0f b6 c1          	movzbl %cl,%r8d
+  801c08:	41 39 d0             	cmp    %edx,%r8d
+  801c0b:	7d 21                	jge    801c2e <strtol+0x9f>
+        val = val * base + dig;
+  801c0d:	49 0f af c1          	imul   %r9,%rax
+  801c11:	0f b6 c9             	movzbl %cl,%ecx
+  801c14:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  801c17:	48 83 c7 01          	add    $0x1,%rdi
+  801c1b:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  801c1f:	80 f9 39             	cmp    $0x39,%cl
+  801c22:	76 dd                	jbe    801c01 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  801c24:	80 f9 7b             	cmp    $0x7b,%cl
+  801c27:	77 05                	ja     801c2e <strtol+0x9f>
+            dig -= 'a' - 10;
+  801c29:	83 e9 57             	sub    $0x57,%ecx
+  801c2c:	eb d6                	jmp    801c04 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  801c2e:	4d 85 d2             	test   %r10,%r10
+  801c31:	74 03                	je     801c36 <strtol+0xa7>
+  801c33:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  801c36:	48 89 c2             	mov    %rax,%rdx
+  801c39:	48 f7 da             	neg    %rdx
+  801c3c:	40 80 fe 2d          	cmp    $0x2d,%sil
+  801c40:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  801c44:	c3                   	ret
+
+0000000000801c45 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  801c45:	55                   	push   %rbp
+  801c46:	48 89 e5             	mov    %rsp,%rbp
+  801c49:	53                   	push   %rbx
+  801c4a:	48 89 fa             	mov    %rdi,%rdx
+  801c4d:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801c50:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801c55:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801c5a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801c5f:	be 00 00 00 00       	mov    $0x0,%esi
+  801c64:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801c6a:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  801c6c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801c70:	c9                   	leave
+  801c71:	c3                   	ret
+
+0000000000801c72 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  801c72:	55                   	push   %rbp
+  801c73:	48 89 e5             	mov    %rsp,%rbp
+  801c76:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801c77:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801c7c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c81:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801c86:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801c8b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801c90:	be 00 00 00 00       	mov    $0x0,%esi
+  801c95:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801c9b:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  801c9d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801ca1:	c9                   	leave
+  801ca2:	c3                   	ret
+
+0000000000801ca3 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  801ca3:	55                   	push   %rbp
+  801ca4:	48 89 e5             	mov    %rsp,%rbp
+  801ca7:	53                   	push   %rbx
+  801ca8:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  801cac:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801caf:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801cb4:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801cb9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801cbe:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801cc3:	be 00 00 00 00       	mov    $0x0,%esi
+  801cc8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801cce:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801cd0:	48 85 c0             	test   %rax,%rax
+  801cd3:	7f 06                	jg     801cdb <sys_env_destroy+0x38>
+}
+  801cd5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801cd9:	c9                   	leave
+  801cda:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801cdb:	49 89 c0             	mov    %rax,%r8
+  801cde:	b9 03 00 00 00       	mov    $0x3,%ecx
+  801ce3:	48 ba d0 42 80 00 00 	movabs $0x8042d0,%rdx
+  801cea:	00 00 00 
+  801ced:	be 26 00 00 00       	mov    $0x26,%esi
+  801cf2:	48 bf ef 42 80 00 00 	movabs $0x8042ef,%rdi
+  801cf9:	00 00 00 
+  801cfc:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d01:	49 b9 a9 0d 80 00 00 	movabs $0x800da9,%r9
+  801d08:	00 00 00 
+  801d0b:	41 ff d1             	call   *%r9
+
+0000000000801d0e <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  801d0e:	55                   	push   %rbp
+  801d0f:	48 89 e5             	mov    %rsp,%rbp
+  801d12:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801d13:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801d18:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d1d:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801d22:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801d27:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801d2c:	be 00 00 00 00       	mov    $0x0,%esi
+  801d31:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801d37:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  801d39:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801d3d:	c9                   	leave
+  801d3e:	c3                   	ret
+
+0000000000801d3f <sys_yield>:
+
+void
+sys_yield(void) {
+  801d3f:	55                   	push   %rbp
+  801d40:	48 89 e5             	mov    %rsp,%rbp
+  801d43:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801d44:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801d49:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d4e:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801d53:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801d58:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801d5d:	be 00 00 00 00       	mov    $0x0,%esi
+  801d62:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801d68:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  801d6a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801d6e:	c9                   	leave
+  801d6f:	c3                   	ret
+
+0000000000801d70 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  801d70:	55                   	push   %rbp
+  801d71:	48 89 e5             	mov    %rsp,%rbp
+  801d74:	53                   	push   %rbx
+  801d75:	48 89 fa             	mov    %rdi,%rdx
+  801d78:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801d7b:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801d80:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  801d87:	00 00 00 
+  801d8a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801d8f:	be 00 00 00 00       	mov    $0x0,%esi
+  801d94:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801d9a:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  801d9c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801da0:	c9                   	leave
+  801da1:	c3                   	ret
+
+0000000000801da2 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  801da2:	55                   	push   %rbp
+  801da3:	48 89 e5             	mov    %rsp,%rbp
+  801da6:	53                   	push   %rbx
+  801da7:	49 89 f8             	mov    %rdi,%r8
+  801daa:	48 89 d3             	mov    %rdx,%rbx
+  801dad:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801db0:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801db5:	4c 89 c2             	mov    %r8,%rdx
+  801db8:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801dbb:	be 00 00 00 00       	mov    $0x0,%esi
+  801dc0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801dc6:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  801dc8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801dcc:	c9                   	leave
+  801dcd:	c3                   	ret
+
+0000000000801dce <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  801dce:	55                   	push   %rbp
+  801dcf:	48 89 e5             	mov    %rsp,%rbp
+  801dd2:	53                   	push   %rbx
+  801dd3:	48 83 ec 08          	sub    $0x8,%rsp
+  801dd7:	89 f8                	mov    %edi,%eax
+  801dd9:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  801ddc:	48 63 f9             	movslq %ecx,%rdi
+  801ddf:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801de2:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801de7:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801dea:	be 00 00 00 00       	mov    $0x0,%esi
+  801def:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801df5:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801df7:	48 85 c0             	test   %rax,%rax
+  801dfa:	7f 06                	jg     801e02 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  801dfc:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801e00:	c9                   	leave
+  801e01:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801e02:	49 89 c0             	mov    %rax,%r8
+  801e05:	b9 04 00 00 00       	mov    $0x4,%ecx
+  801e0a:	48 ba d0 42 80 00 00 	movabs $0x8042d0,%rdx
+  801e11:	00 00 00 
+  801e14:	be 26 00 00 00       	mov    $0x26,%esi
+  801e19:	48 bf ef 42 80 00 00 	movabs $0x8042ef,%rdi
+  801e20:	00 00 00 
+  801e23:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e28:	49 b9 a9 0d 80 00 00 	movabs $0x800da9,%r9
+  801e2f:	00 00 00 
+  801e32:	41 ff d1             	call   *%r9
+
+0000000000801e35 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801e35:	55                   	push   %rbp
+  801e36:	48 89 e5             	mov    %rsp,%rbp
+  801e39:	53                   	push   %rbx
+  801e3a:	48 83 ec 08          	sub    $0x8,%rsp
+  801e3e:	89 f8                	mov    %edi,%eax
+  801e40:	49 89 f2             	mov    %rsi,%r10
+  801e43:	48 89 cf             	mov    %rcx,%rdi
+  801e46:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  801e49:	48 63 da             	movslq %edx,%rbx
+  801e4c:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801e4f:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801e54:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801e57:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  801e5a:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801e5c:	48 85 c0             	test   %rax,%rax
+  801e5f:	7f 06                	jg     801e67 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  801e61:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801e65:	c9                   	leave
+  801e66:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801e67:	49 89 c0             	mov    %rax,%r8
+  801e6a:	b9 05 00 00 00       	mov    $0x5,%ecx
+  801e6f:	48 ba d0 42 80 00 00 	movabs $0x8042d0,%rdx
+  801e76:	00 00 00 
+  801e79:	be 26 00 00 00       	mov    $0x26,%esi
+  801e7e:	48 bf ef 42 80 00 00 	movabs $0x8042ef,%rdi
+  801e85:	00 00 00 
+  801e88:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e8d:	49 b9 a9 0d 80 00 00 	movabs $0x800da9,%r9
+  801e94:	00 00 00 
+  801e97:	41 ff d1             	call   *%r9
+
+0000000000801e9a <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  801e9a:	55                   	push   %rbp
+  801e9b:	48 89 e5             	mov    %rsp,%rbp
+  801e9e:	53                   	push   %rbx
+  801e9f:	48 83 ec 08          	sub    $0x8,%rsp
+  801ea3:	48 89 f1             	mov    %rsi,%rcx
+  801ea6:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  801ea9:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801eac:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801eb1:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801eb6:	be 00 00 00 00       	mov    $0x0,%esi
+  801ebb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801ec1:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801ec3:	48 85 c0             	test   %rax,%rax
+  801ec6:	7f 06                	jg     801ece <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  801ec8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801ecc:	c9                   	leave
+  801ecd:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801ece:	49 89 c0             	mov    %rax,%r8
+  801ed1:	b9 06 00 00 00       	mov    $0x6,%ecx
+  801ed6:	48 ba d0 42 80 00 00 	movabs $0x8042d0,%rdx
+  801edd:	00 00 00 
+  801ee0:	be 26 00 00 00       	mov    $0x26,%esi
+  801ee5:	48 bf ef 42 80 00 00 	movabs $0x8042ef,%rdi
+  801eec:	00 00 00 
+  801eef:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ef4:	49 b9 a9 0d 80 00 00 	movabs $0x800da9,%r9
+  801efb:	00 00 00 
+  801efe:	41 ff d1             	call   *%r9
+
+0000000000801f01 <sys_region_batch>:
+
+int
+sys_region_batch(const struct RegionOp *ops, size_t count) {
+  801f01:	55                   	push   %rbp
+  801f02:	48 89 e5             	mov    %rsp,%rbp
+  801f05:	53                   	push   %rbx
+  801f06:	48 83 ec 08          	sub    $0x8,%rsp
+  801f0a:	48 89 fa             	mov    %rdi,%rdx
+  801f0d:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801f10:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801f15:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801f1a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801f1f:	be 00 00 00 00       	mov    $0x0,%esi
+  801f24:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801f2a:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801f2c:	48 85 c0             	test   %rax,%rax
+  801f2f:	7f 06                	jg     801f37 <sys_region_batch+0x36>
+        else
+            platform_asan_unpoison(va, ops[i].size);
+    }
+#endif
+    return res;
+}
+  801f31:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801f35:	c9                   	leave
+  801f36:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801f37:	49 89 c0             	mov    %rax,%r8
+  801f3a:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  801f3f:	48 ba d0 42 80 00 00 	movabs $0x8042d0,%rdx
+  801f46:	00 00 00 
+  801f49:	be 26 00 00 00       	mov    $0x26,%esi
+  801f4e:	48 bf ef 42 80 00 00 	movabs $0x8042ef,%rdi
+  801f55:	00 00 00 
+  801f58:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f5d:	49 b9 a9 0d 80 00 00 	movabs $0x800da9,%r9
+  801f64:	00 00 00 
+  801f67:	41 ff d1             	call   *%r9
+
+0000000000801f6a <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  801f6a:	55                   	push   %rbp
+  801f6b:	48 89 e5             	mov    %rsp,%rbp
+  801f6e:	53                   	push   %rbx
+  801f6f:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  801f73:	48 63 ce             	movslq %esi,%rcx
+  801f76:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801f79:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801f7e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801f83:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801f88:	be 00 00 00 00       	mov    $0x0,%esi
+  801f8d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801f93:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801f95:	48 85 c0             	test   %rax,%rax
+  801f98:	7f 06                	jg     801fa0 <sys_env_set_status+0x36>
+}
+  801f9a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801f9e:	c9                   	leave
+  801f9f:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801fa0:	49 89 c0             	mov    %rax,%r8
+  801fa3:	b9 09 00 00 00       	mov    $0x9,%ecx
+  801fa8:	48 ba d0 42 80 00 00 	movabs $0x8042d0,%rdx
+  801faf:	00 00 00 
+  801fb2:	be 26 00 00 00       	mov    $0x26,%esi
+  801fb7:	48 bf ef 42 80 00 00 	movabs $0x8042ef,%rdi
+  801fbe:	00 00 00 
+  801fc1:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fc6:	49 b9 a9 0d 80 00 00 	movabs $0x800da9,%r9
+  801fcd:	00 00 00 
+  801fd0:	41 ff d1             	call   *%r9
+
+0000000000801fd3 <sys_env_set_weight>:
+
+int
+sys_env_set_weight(envid_t envid, uint32_t weight) {
+  801fd3:	55                   	push   %rbp
+  801fd4:	48 89 e5             	mov    %rsp,%rbp
+  801fd7:	53                   	push   %rbx
+  801fd8:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_weight, 1, envid, weight, 0, 0, 0, 0);
+  801fdc:	89 f1                	mov    %esi,%ecx
+  801fde:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801fe1:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801fe6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801feb:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801ff0:	be 00 00 00 00       	mov    $0x0,%esi
+  801ff5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801ffb:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801ffd:	48 85 c0             	test   %rax,%rax
+  802000:	7f 06                	jg     802008 <sys_env_set_weight+0x35>
+}
+  802002:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802006:	c9                   	leave
+  802007:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802008:	49 89 c0             	mov    %rax,%r8
+  80200b:	b9 10 00 00 00       	mov    $0x10,%ecx
+  802010:	48 ba d0 42 80 00 00 	movabs $0x8042d0,%rdx
+  802017:	00 00 00 
+  80201a:	be 26 00 00 00       	mov    $0x26,%esi
+  80201f:	48 bf ef 42 80 00 00 	movabs $0x8042ef,%rdi
+  802026:	00 00 00 
+  802029:	b8 00 00 00 00       	mov    $0x0,%eax
+  80202e:	49 b9 a9 0d 80 00 00 	movabs $0x800da9,%r9
+  802035:	00 00 00 
+  802038:	41 ff d1             	call   *%r9
+
+000000000080203b <sys_env_set_rt>:
+
+int
+sys_env_set_rt(envid_t envid, uint64_t period, uint64_t budget, uint64_t deadline) {
+  80203b:	55                   	push   %rbp
+  80203c:	48 89 e5             	mov    %rsp,%rbp
+  80203f:	53                   	push   %rbx
+  802040:	48 83 ec 08          	sub    $0x8,%rsp
+  802044:	89 f8                	mov    %edi,%eax
+  802046:	48 89 d3             	mov    %rdx,%rbx
+  802049:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_env_set_rt, 1, envid, period, budget, deadline, 0, 0);
+  80204c:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80204f:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802054:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  802057:	be 00 00 00 00       	mov    $0x0,%esi
+  80205c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  802062:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802064:	48 85 c0             	test   %rax,%rax
+  802067:	7f 06                	jg     80206f <sys_env_set_rt+0x34>
+}
+  802069:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80206d:	c9                   	leave
+  80206e:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80206f:	49 89 c0             	mov    %rax,%r8
+  802072:	b9 11 00 00 00       	mov    $0x11,%ecx
+  802077:	48 ba d0 42 80 00 00 	movabs $0x8042d0,%rdx
+  80207e:	00 00 00 
+  802081:	be 26 00 00 00       	mov    $0x26,%esi
+  802086:	48 bf ef 42 80 00 00 	movabs $0x8042ef,%rdi
+  80208d:	00 00 00 
+  802090:	b8 00 00 00 00       	mov    $0x0,%eax
+  802095:	49 b9 a9 0d 80 00 00 	movabs $0x800da9,%r9
+  80209c:	00 00 00 
+  80209f:	41 ff d1             	call   *%r9
+
+00000000008020a2 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  8020a2:	55                   	push   %rbp
+  8020a3:	48 89 e5             	mov    %rsp,%rbp
+  8020a6:	53                   	push   %rbx
+  8020a7:	48 83 ec 08          	sub    $0x8,%rsp
+  8020ab:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  8020ae:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8020b1:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8020b6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8020bb:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8020c0:	be 00 00 00 00       	mov    $0x0,%esi
+  8020c5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8020cb:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8020cd:	48 85 c0             	test   %rax,%rax
+  8020d0:	7f 06                	jg     8020d8 <sys_env_set_trapframe+0x36>
+}
+  8020d2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8020d6:	c9                   	leave
+  8020d7:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8020d8:	49 89 c0             	mov    %rax,%r8
+  8020db:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  8020e0:	48 ba d0 42 80 00 00 	movabs $0x8042d0,%rdx
+  8020e7:	00 00 00 
+  8020ea:	be 26 00 00 00       	mov    $0x26,%esi
+  8020ef:	48 bf ef 42 80 00 00 	movabs $0x8042ef,%rdi
+  8020f6:	00 00 00 
+  8020f9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020fe:	49 b9 a9 0d 80 00 00 	movabs $0x800da9,%r9
+  802105:	00 00 00 
+  802108:	41 ff d1             	call   *%r9
+
+000000000080210b <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  80210b:	55                   	push   %rbp
+  80210c:	48 89 e5             	mov    %rsp,%rbp
+  80210f:	53                   	push   %rbx
+  802110:	48 83 ec 08          	sub    $0x8,%rsp
+  802114:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  802117:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80211a:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80211f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802124:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  802129:	be 00 00 00 00       	mov    $0x0,%esi
+  80212e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  802134:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802136:	48 85 c0             	test   %rax,%rax
+  802139:	7f 06                	jg     802141 <sys_env_set_pgfault_upcall+0x36>
+}
+  80213b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80213f:	c9                   	leave
+  802140:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802141:	49 89 c0             	mov    %rax,%r8
+  802144:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  802149:	48 ba d0 42 80 00 00 	movabs $0x8042d0,%rdx
+  802150:	00 00 00 
+  802153:	be 26 00 00 00       	mov    $0x26,%esi
+  802158:	48 bf ef 42 80 00 00 	movabs $0x8042ef,%rdi
+  80215f:	00 00 00 
+  802162:	b8 00 00 00 00       	mov    $0x0,%eax
+  802167:	49 b9 a9 0d 80 00 00 	movabs $0x800da9,%r9
+  80216e:	00 00 00 
+  802171:	41 ff d1             	call   *%r9
+
+0000000000802174 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  802174:	55                   	push   %rbp
+  802175:	48 89 e5             	mov    %rsp,%rbp
+  802178:	53                   	push   %rbx
+  802179:	89 f8                	mov    %edi,%eax
+  80217b:	49 89 f1             	mov    %rsi,%r9
+  80217e:	48 89 d3             	mov    %rdx,%rbx
+  802181:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  802184:	49 63 f0             	movslq %r8d,%rsi
+  802187:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80218a:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80218f:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  802192:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  802198:	cd 30                	int    $0x30
+}
+  80219a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80219e:	c9                   	leave
+  80219f:	c3                   	ret
+
+00000000008021a0 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  8021a0:	55                   	push   %rbp
+  8021a1:	48 89 e5             	mov    %rsp,%rbp
+  8021a4:	53                   	push   %rbx
+  8021a5:	48 83 ec 08          	sub    $0x8,%rsp
+  8021a9:	48 89 fa             	mov    %rdi,%rdx
+  8021ac:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8021af:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8021b4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8021b9:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8021be:	be 00 00 00 00       	mov    $0x0,%esi
+  8021c3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8021c9:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8021cb:	48 85 c0             	test   %rax,%rax
+  8021ce:	7f 06                	jg     8021d6 <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8021d0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8021d4:	c9                   	leave
+  8021d5:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8021d6:	49 89 c0             	mov    %rax,%r8
+  8021d9:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  8021de:	48 ba d0 42 80 00 00 	movabs $0x8042d0,%rdx
+  8021e5:	00 00 00 
+  8021e8:	be 26 00 00 00       	mov    $0x26,%esi
+  8021ed:	48 bf ef 42 80 00 00 	movabs $0x8042ef,%rdi
+  8021f4:	00 00 00 
+  8021f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021fc:	49 b9 a9 0d 80 00 00 	movabs $0x800da9,%r9
+  802203:	00 00 00 
+  802206:	41 ff d1             	call   *%r9
+
+0000000000802209 <_handle_vectored_pagefault>:
+/* Vector size */
+static size_t _pfhandler_off = 0;
+static bool _pfhandler_inititiallized = 0;
+
+void
+_handle_vectored_pagefault(struct UTrapframe *utf) {
+  802209:	55                   	push   %rbp
+  80220a:	48 89 e5             	mov    %rsp,%rbp
+  80220d:	41 56                	push   %r14
+  80220f:	41 55                	push   %r13
+  802211:	41 54                	push   %r12
+  802213:	53                   	push   %rbx
+  802214:	49 89 fc             	mov    %rdi,%r12
+    /* This trying to handle pagefault until
+     * some handler returns 1, that indicates
+     * successfully handled exception */
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  802217:	48 b8 28 62 80 00 00 	movabs $0x806228,%rax
+  80221e:	00 00 00 
+  802221:	48 83 38 00          	cmpq   $0x0,(%rax)
+  802225:	74 27                	je     80224e <_handle_vectored_pagefault+0x45>
+  802227:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (_pfhandler_vec[i](utf)) return;
+  80222c:	49 bd e0 61 80 00 00 	movabs $0x8061e0,%r13
+  802233:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  802236:	49 89 c6             	mov    %rax,%r14
+        if (_pfhandler_vec[i](utf)) return;
+  802239:	4c 89 e7             	mov    %r12,%rdi
+  80223c:	41 ff 54 dd 00       	call   *0x0(%r13,%rbx,8)
+  802241:	84 c0                	test   %al,%al
+  802243:	75 45                	jne    80228a <_handle_vectored_pagefault+0x81>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  802245:	48 83 c3 01          	add    $0x1,%rbx
+  802249:	49 3b 1e             	cmp    (%r14),%rbx
+  80224c:	72 eb                	jb     802239 <_handle_vectored_pagefault+0x30>
+
+    /* Unhandled exceptions just cause panic */
+    panic("Userspace page fault rip=%08lX va=%08lX err=%x\n",
+  80224e:	49 8b 8c 24 88 00 00 	mov    0x88(%r12),%rcx
+  802255:	00 
+  802256:	45 8b 4c 24 08       	mov    0x8(%r12),%r9d
+  80225b:	4d 8b 04 24          	mov    (%r12),%r8
+  80225f:	48 ba 00 43 80 00 00 	movabs $0x804300,%rdx
+  802266:	00 00 00 
+  802269:	be 1d 00 00 00       	mov    $0x1d,%esi
+  80226e:	48 bf 30 43 80 00 00 	movabs $0x804330,%rdi
+  802275:	00 00 00 
+  802278:	b8 00 00 00 00       	mov    $0x0,%eax
+  80227d:	49 ba a9 0d 80 00 00 	movabs $0x800da9,%r10
+  802284:	00 00 00 
+  802287:	41 ff d2             	call   *%r10
+          utf->utf_rip, utf->utf_fault_va, (int)utf->utf_err);
+}
+  80228a:	5b                   	pop    %rbx
+  80228b:	41 5c                	pop    %r12
+  80228d:	41 5d                	pop    %r13
+  80228f:	41 5e                	pop    %r14
+  802291:	5d                   	pop    %rbp
+  802292:	c3                   	ret
+
+0000000000802293 <add_pgfault_handler>:
+ * The first time we register a handler, we need to
+ * allocate an exception stack (one page of memory with its top
+ * at USER_EXCEPTION_STACK_TOP), and tell the kernel to call the assembly-language
+ * _pgfault_upcall routine when a page fault occurs. */
+int
+add_pgfault_handler(pf_handler_t handler) {
+  802293:	55                   	push   %rbp
+  802294:	48 89 e5             	mov    %rsp,%rbp
+  802297:	53                   	push   %rbx
+  802298:	48 83 ec 08          	sub    $0x8,%rsp
+  80229c:	48 89 fb             	mov    %rdi,%rbx
+    int res = 0;
+  80229f:	be 00 00 00 00       	mov    $0x0,%esi
+    if (!_pfhandler_inititiallized) {
+  8022a4:	48 b8 20 62 80 00 00 	movabs $0x806220,%rax
+  8022ab:	00 00 00 
+  8022ae:	80 38 00             	cmpb   $0x0,(%rax)
+  8022b1:	74 68                	je     80231b <add_pgfault_handler+0x88>
+            goto end;
+        }
+        _pfhandler_inititiallized = 1;
+    }
+
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8022b3:	48 b8 28 62 80 00 00 	movabs $0x806228,%rax
+  8022ba:	00 00 00 
+  8022bd:	48 8b 08             	mov    (%rax),%rcx
+  8022c0:	ba 00 00 00 00       	mov    $0x0,%edx
+        if (handler == _pfhandler_vec[i]) return 0;
+  8022c5:	48 b8 e0 61 80 00 00 	movabs $0x8061e0,%rax
+  8022cc:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8022cf:	48 85 c9             	test   %rcx,%rcx
+  8022d2:	0f 84 e0 00 00 00    	je     8023b8 <add_pgfault_handler+0x125>
+        if (handler == _pfhandler_vec[i]) return 0;
+  8022d8:	48 39 1c d0          	cmp    %rbx,(%rax,%rdx,8)
+  8022dc:	0f 84 c9 00 00 00    	je     8023ab <add_pgfault_handler+0x118>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8022e2:	48 83 c2 01          	add    $0x1,%rdx
+  8022e6:	48 39 ca             	cmp    %rcx,%rdx
+  8022e9:	75 ed                	jne    8022d8 <add_pgfault_handler+0x45>
+
+    if (_pfhandler_off == MAX_PFHANDLER)
+  8022eb:	48 83 f9 08          	cmp    $0x8,%rcx
+  8022ef:	0f 84 84 00 00 00    	je     802379 <add_pgfault_handler+0xe6>
+        res = -E_INVAL;
+    else
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  8022f5:	48 8d 41 01          	lea    0x1(%rcx),%rax
+  8022f9:	48 a3 28 62 80 00 00 	movabs %rax,0x806228
+  802300:	00 00 00 
+  802303:	48 b8 e0 61 80 00 00 	movabs $0x8061e0,%rax
+  80230a:	00 00 00 
+  80230d:	48 89 1c c8          	mov    %rbx,(%rax,%rcx,8)
+
+end:
+    if (res < 0) {
+  802311:	85 f6                	test   %esi,%esi
+  802313:	0f 89 97 00 00 00    	jns    8023b0 <add_pgfault_handler+0x11d>
+  802319:	eb 63                	jmp    80237e <add_pgfault_handler+0xeb>
+        res = sys_alloc_region(0, (void*)(USER_EXCEPTION_STACK_TOP - USER_EXCEPTION_STACK_SIZE),
+  80231b:	b9 06 00 10 00       	mov    $0x100006,%ecx
+  802320:	ba 00 80 00 00       	mov    $0x8000,%edx
+  802325:	48 be 00 80 ff ff 7f 	movabs $0x7fffff8000,%rsi
+  80232c:	00 00 00 
+  80232f:	bf 00 00 00 00       	mov    $0x0,%edi
+  802334:	48 b8 ce 1d 80 00 00 	movabs $0x801dce,%rax
+  80233b:	00 00 00 
+  80233e:	ff d0                	call   *%rax
+  802340:	89 c6                	mov    %eax,%esi
+        if (res < 0) {
+  802342:	85 c0                	test   %eax,%eax
+  802344:	78 38                	js     80237e <add_pgfault_handler+0xeb>
+        res = sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  802346:	48 be 94 24 80 00 00 	movabs $0x802494,%rsi
+  80234d:	00 00 00 
+  802350:	bf 00 00 00 00       	mov    $0x0,%edi
+  802355:	48 b8 0b 21 80 00 00 	movabs $0x80210b,%rax
+  80235c:	00 00 00 
+  80235f:	ff d0                	call   *%rax
+  802361:	89 c6                	mov    %eax,%esi
+        if (res < 0) {
+  802363:	85 c0                	test   %eax,%eax
+  802365:	78 17                	js     80237e <add_pgfault_handler+0xeb>
+        _pfhandler_inititiallized = 1;
+  802367:	48 b8 20 62 80 00 00 	movabs $0x806220,%rax
+  80236e:	00 00 00 
+  802371:	c6 00 01             	movb   $0x1,(%rax)
+  802374:	e9 3a ff ff ff       	jmp    8022b3 <add_pgfault_handler+0x20>
+        res = -E_INVAL;
+  802379:	be fd ff ff ff       	mov    $0xfffffffd,%esi
+        panic("set_pgfault_handler: %i", res);
+  80237e:	89 f1                	mov    %esi,%ecx
+  802380:	48 ba 3e 43 80 00 00 	movabs $0x80433e,%rdx
+  802387:	00 00 00 
+  80238a:	be 43 00 00 00       	mov    $0x43,%esi
+  80238f:	48 bf 30 43 80 00 00 	movabs $0x804330,%rdi
+  802396:	00 00 00 
+  802399:	b8 00 00 00 00       	mov    $0x0,%eax
+  80239e:	49 b8 a9 0d 80 00 00 	movabs $0x800da9,%r8
+  8023a5:	00 00 00 
+  8023a8:	41 ff d0             	call   *%r8
+        if (handler == _pfhandler_vec[i]) return 0;
+  8023ab:	be 00 00 00 00       	mov    $0x0,%esi
+    }
+    return res;
+}
+  8023b0:	89 f0                	mov    %esi,%eax
+  8023b2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8023b6:	c9                   	leave
+  8023b7:	c3                   	ret
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  8023b8:	48 b8 28 62 80 00 00 	movabs $0x806228,%rax
+  8023bf:	00 00 00 
+  8023c2:	48 c7 00 01 00 00 00 	movq   $0x1,(%rax)
+  8023c9:	48 89 d8             	mov    %rbx,%rax
+  8023cc:	48 a3 e0 61 80 00 00 	movabs %rax,0x8061e0
+  8023d3:	00 00 00 
+    if (res < 0) {
+  8023d6:	eb d8                	jmp    8023b0 <add_pgfault_handler+0x11d>
+
+00000000008023d8 <remove_pgfault_handler>:
+
+void
+remove_pgfault_handler(pf_handler_t handler) {
+  8023d8:	55                   	push   %rbp
+  8023d9:	48 89 e5             	mov    %rsp,%rbp
+    assert(_pfhandler_inititiallized);
+  8023dc:	48 b8 20 62 80 00 00 	movabs $0x806220,%rax
+  8023e3:	00 00 00 
+  8023e6:	80 38 00             	cmpb   $0x0,(%rax)
+  8023e9:	74 33                	je     80241e <remove_pgfault_handler+0x46>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  8023eb:	48 a1 28 62 80 00 00 	movabs 0x806228,%rax
+  8023f2:	00 00 00 
+  8023f5:	b9 00 00 00 00       	mov    $0x0,%ecx
+        if (_pfhandler_vec[i] == handler) {
+  8023fa:	48 ba e0 61 80 00 00 	movabs $0x8061e0,%rdx
+  802401:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  802404:	48 85 c0             	test   %rax,%rax
+  802407:	0f 84 85 00 00 00    	je     802492 <remove_pgfault_handler+0xba>
+        if (_pfhandler_vec[i] == handler) {
+  80240d:	48 39 3c ca          	cmp    %rdi,(%rdx,%rcx,8)
+  802411:	74 40                	je     802453 <remove_pgfault_handler+0x7b>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  802413:	48 83 c1 01          	add    $0x1,%rcx
+  802417:	48 39 c1             	cmp    %rax,%rcx
+  80241a:	75 f1                	jne    80240d <remove_pgfault_handler+0x35>
+  80241c:	eb 74                	jmp    802492 <remove_pgfault_handler+0xba>
+    assert(_pfhandler_inititiallized);
+  80241e:	48 b9 56 43 80 00 00 	movabs $0x804356,%rcx
+  802425:	00 00 00 
+  802428:	48 ba 70 43 80 00 00 	movabs $0x804370,%rdx
+  80242f:	00 00 00 
+  802432:	be 4a 00 00 00       	mov    $0x4a,%esi
+  802437:	48 bf 30 43 80 00 00 	movabs $0x804330,%rdi
+  80243e:	00 00 00 
+  802441:	b8 00 00 00 00       	mov    $0x0,%eax
+  802446:	49 b8 a9 0d 80 00 00 	movabs $0x800da9,%r8
+  80244d:	00 00 00 
+  802450:	41 ff d0             	call   *%r8
+            memmove(_pfhandler_vec + i, _pfhandler_vec + i + 1, (_pfhandler_off - i - 1) * sizeof(*handler));
+  802453:	48 8d 34 cd 08 00 00 	lea    0x8(,%rcx,8),%rsi
+  80245a:	00 
+  80245b:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  80245f:	48 29 ca             	sub    %rcx,%rdx
+  802462:	48 b8 e0 61 80 00 00 	movabs $0x8061e0,%rax
+  802469:	00 00 00 
+  80246c:	48 8d 0c 06          	lea    (%rsi,%rax,1),%rcx
+  802470:	48 8d 7c 30 f8       	lea    -0x8(%rax,%rsi,1),%rdi
+  802475:	48 89 ce             	mov    %rcx,%rsi
+  802478:	48 b8 18 1a 80 00 00 	movabs $0x801a18,%rax
+  80247f:	00 00 00 
+  802482:	ff d0                	call   *%rax
+            _pfhandler_off--;
+  802484:	48 b8 28 62 80 00 00 	movabs $0x806228,%rax
+  80248b:	00 00 00 
+  80248e:	48 83 28 01          	subq   $0x1,(%rax)
+            return;
+        }
+    }
+}
+  802492:	5d                   	pop    %rbp
+  802493:	c3                   	ret
+
+0000000000802494 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+    # Call the C page fault handler.
+    movq  %rsp,%rdi # passing the function argument in rdi
+  802494:	48 89 e7             	mov    %rsp,%rdi
+    movabs $_handle_vectored_pagefault, %rax
+  802497:	48 b8 09 22 80 00 00 	movabs $0x802209,%rax
+  80249e:	00 00 00 
+    call *%rax
+  8024a1:	ff d0                	call   *%rax
+    # registers are available for intermediate calculations.  You
+    # may find that you have to rearrange your code in non-obvious
+    # ways as registers become unavailable as scratch space.
+
+    # LAB 9: Your code here
+    addq $16, %rsp
+  8024a3:	48 83 c4 10          	add    $0x10,%rsp
+	movq %rsp, %rax
+  8024a7:	48 89 e0             	mov    %rsp,%rax
+	movq 120(%rsp), %rbx
+  8024aa:	48 8b 5c 24 78       	mov    0x78(%rsp),%rbx
+	movq 136(%rsp), %rcx
+  8024af:	48 8b 8c 24 88 00 00 	mov    0x88(%rsp),%rcx
+  8024b6:	00 
+	movq %rcx, %rsp
+  8024b7:	48 89 cc             	mov    %rcx,%rsp
+    pushq %rbx
+  8024ba:	53                   	push   %rbx
+    movq %rax, %rsp
+  8024bb:	48 89 c4             	mov    %rax,%rsp
+
+	subq $8, %rcx
+  8024be:	48 83 e9 08          	sub    $0x8,%rcx
+	movq %rcx, 136(%rsp)
+  8024c2:	48 89 8c 24 88 00 00 	mov    %rcx,0x88(%rsp)
+  8024c9:	00 
+
+    # Restore the trap-time registers.  After you do this, you
+    # can no longer modify any general-purpose registers (POPA).
+    # LAB 9: Your code here
+
+    pop %r15
+  8024ca:	41 5f                	pop    %r15
+    pop %r14
+  8024cc:	41 5e                	pop    %r14
+    pop %r13
+  8024ce:	41 5d                	pop    %r13
+    pop %r12
+  8024d0:	41 5c                	pop    %r12
+    pop %r11
+  8024d2:	41 5b                	pop    %r11
+    pop %r10
+  8024d4:	41 5a                	pop    %r10
+    pop %r9
+  8024d6:	41 59                	pop    %r9
+    pop %r8
+  8024d8:	41 58                	pop    %r8
+    pop %rsi
+  8024da:	5e                   	pop    %rsi
+    pop %rdi
+  8024db:	5f                   	pop    %rdi
+    pop %rbp
+  8024dc:	5d                   	pop    %rbp
+    pop %rdx
+  8024dd:	5a                   	pop    %rdx
+    pop %rcx
+  8024de:	59                   	pop    %rcx
+    pop %rbx
+  8024df:	5b                   	pop    %rbx
+    pop %rax
+  8024e0:	58                   	pop    %rax
+    # Restore rflags from the stack.  After you do this, you can
+    # no longer use arithmetic operations or anything else that
+    # modifies rflags.
+    # LAB 9: Your code here
+
+    addq $8, %rsp
+  8024e1:	48 83 c4 08          	add    $0x8,%rsp
+    popfq
+  8024e5:	9d                   	popf
+
+    # Switch back to the adjusted trap-time stack.
+    # LAB 9: Your code here
+
+    pop %rsp
+  8024e6:	5c                   	pop    %rsp
+
+    # Return to re-execute the instruction that faulted.
+    ret
+  8024e7:	c3                   	ret
+
+00000000008024e8 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8024e8:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8024ef:	ff ff ff 
+  8024f2:	48 01 f8             	add    %rdi,%rax
+  8024f5:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  8024f9:	c3                   	ret
+
+00000000008024fa <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8024fa:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  802501:	ff ff ff 
+  802504:	48 01 f8             	add    %rdi,%rax
+  802507:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  80250b:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  802511:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  802515:	c3                   	ret
+
+0000000000802516 <fd_alloc_from>:
+}
+
+/* Like fd_alloc(), but only considers fds starting from fdnum,
+ * so that several fds can be found before their pages are allocated */
+int
+fd_alloc_from(int fdnum, struct Fd **fd_store) {
+  802516:	55                   	push   %rbp
+  802517:	48 89 e5             	mov    %rsp,%rbp
+  80251a:	41 57                	push   %r15
+  80251c:	41 56                	push   %r14
+  80251e:	41 55                	push   %r13
+  802520:	41 54                	push   %r12
+  802522:	53                   	push   %rbx
+  802523:	48 83 ec 08          	sub    $0x8,%rsp
+  802527:	49 89 f7             	mov    %rsi,%r15
+    for (int i = MAX(fdnum, 0); i < MAXFD; i++) {
+  80252a:	85 ff                	test   %edi,%edi
+  80252c:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802532:	44 0f 49 e7          	cmovns %edi,%r12d
+  802536:	83 ff 1f             	cmp    $0x1f,%edi
+  802539:	7f 37                	jg     802572 <fd_alloc_from+0x5c>
+  80253b:	49 63 dc             	movslq %r12d,%rbx
+  80253e:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  802545:	48 c1 e3 0c          	shl    $0xc,%rbx
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  802549:	49 be 1f 36 80 00 00 	movabs $0x80361f,%r14
+  802550:	00 00 00 
+        struct Fd *fd = INDEX2FD(i);
+  802553:	49 89 dd             	mov    %rbx,%r13
+        if (!(get_prot(fd) & PROT_R)) {
+  802556:	48 89 df             	mov    %rbx,%rdi
+  802559:	41 ff d6             	call   *%r14
+  80255c:	83 e0 04             	and    $0x4,%eax
+  80255f:	74 1c                	je     80257d <fd_alloc_from+0x67>
+    for (int i = MAX(fdnum, 0); i < MAXFD; i++) {
+  802561:	41 83 c4 01          	add    $0x1,%r12d
+  802565:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  80256c:	41 83 fc 1f          	cmp    $0x1f,%r12d
+  802570:	7e e1                	jle    802553 <fd_alloc_from+0x3d>
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  802572:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  802578:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  80257d:	4d 89 2f             	mov    %r13,(%r15)
+}
+  802580:	48 83 c4 08          	add    $0x8,%rsp
+  802584:	5b                   	pop    %rbx
+  802585:	41 5c                	pop    %r12
+  802587:	41 5d                	pop    %r13
+  802589:	41 5e                	pop    %r14
+  80258b:	41 5f                	pop    %r15
+  80258d:	5d                   	pop    %rbp
+  80258e:	c3                   	ret
+
+000000000080258f <fd_alloc>:
+fd_alloc(struct Fd **fd_store) {
+  80258f:	55                   	push   %rbp
+  802590:	48 89 e5             	mov    %rsp,%rbp
+  802593:	48 89 fe             	mov    %rdi,%rsi
+    return fd_alloc_from(0, fd_store);
+  802596:	bf 00 00 00 00       	mov    $0x0,%edi
+  80259b:	48 b8 16 25 80 00 00 	movabs $0x802516,%rax
+  8025a2:	00 00 00 
+  8025a5:	ff d0                	call   *%rax
+}
+  8025a7:	5d                   	pop    %rbp
+  8025a8:	c3                   	ret
+
+00000000008025a9 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  8025a9:	83 ff 1f             	cmp    $0x1f,%edi
+  8025ac:	77 39                	ja     8025e7 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  8025ae:	55                   	push   %rbp
+  8025af:	48 89 e5             	mov    %rsp,%rbp
+  8025b2:	41 54                	push   %r12
+  8025b4:	53                   	push   %rbx
+  8025b5:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  8025b8:	48 63 df             	movslq %edi,%rbx
+  8025bb:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  8025c2:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  8025c6:	48 89 df             	mov    %rbx,%rdi
+  8025c9:	48 b8 1f 36 80 00 00 	movabs $0x80361f,%rax
+  8025d0:	00 00 00 
+  8025d3:	ff d0                	call   *%rax
+  8025d5:	a8 04                	test   $0x4,%al
+  8025d7:	74 14                	je     8025ed <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  8025d9:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  8025dd:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8025e2:	5b                   	pop    %rbx
+  8025e3:	41 5c                	pop    %r12
+  8025e5:	5d                   	pop    %rbp
+  8025e6:	c3                   	ret
+        return -E_INVAL;
+  8025e7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8025ec:	c3                   	ret
+        return -E_INVAL;
+  8025ed:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8025f2:	eb ee                	jmp    8025e2 <fd_lookup+0x39>
+
+00000000008025f4 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  8025f4:	55                   	push   %rbp
+  8025f5:	48 89 e5             	mov    %rsp,%rbp
+  8025f8:	41 54                	push   %r12
+  8025fa:	53                   	push   %rbx
+  8025fb:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  8025fe:	48 b8 20 44 80 00 00 	movabs $0x804420,%rax
+  802605:	00 00 00 
+  802608:	48 bb 20 50 80 00 00 	movabs $0x805020,%rbx
+  80260f:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  802612:	39 3b                	cmp    %edi,(%rbx)
+  802614:	74 47                	je     80265d <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  802616:	48 83 c0 08          	add    $0x8,%rax
+  80261a:	48 8b 18             	mov    (%rax),%rbx
+  80261d:	48 85 db             	test   %rbx,%rbx
+  802620:	75 f0                	jne    802612 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  802622:	48 a1 d0 61 80 00 00 	movabs 0x8061d0,%rax
+  802629:	00 00 00 
+  80262c:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+  802632:	89 fa                	mov    %edi,%edx
+  802634:	48 bf 88 43 80 00 00 	movabs $0x804388,%rdi
+  80263b:	00 00 00 
+  80263e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802643:	48 b9 f9 0e 80 00 00 	movabs $0x800ef9,%rcx
+  80264a:	00 00 00 
+  80264d:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  80264f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  802654:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  802658:	5b                   	pop    %rbx
+  802659:	41 5c                	pop    %r12
+  80265b:	5d                   	pop    %rbp
+  80265c:	c3                   	ret
+            return 0;
+  80265d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802662:	eb f0                	jmp    802654 <dev_lookup+0x60>
+
+0000000000802664 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  802664:	55                   	push   %rbp
+  802665:	48 89 e5             	mov    %rsp,%rbp
+  802668:	41 55                	push   %r13
+  80266a:	41 54                	push   %r12
+  80266c:	53                   	push   %rbx
+  80266d:	48 83 ec 18          	sub    $0x18,%rsp
+  802671:	48 89 fb             	mov    %rdi,%rbx
+  802674:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  802677:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  80267e:	ff ff ff 
+  802681:	48 01 df             	add    %rbx,%rdi
+  802684:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  802688:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80268c:	48 b8 a9 25 80 00 00 	movabs $0x8025a9,%rax
+  802693:	00 00 00 
+  802696:	ff d0                	call   *%rax
+  802698:	41 89 c5             	mov    %eax,%r13d
+  80269b:	85 c0                	test   %eax,%eax
+  80269d:	78 06                	js     8026a5 <fd_close+0x41>
+  80269f:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  8026a3:	74 1a                	je     8026bf <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  8026a5:	45 84 e4             	test   %r12b,%r12b
+  8026a8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8026ad:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  8026b1:	44 89 e8             	mov    %r13d,%eax
+  8026b4:	48 83 c4 18          	add    $0x18,%rsp
+  8026b8:	5b                   	pop    %rbx
+  8026b9:	41 5c                	pop    %r12
+  8026bb:	41 5d                	pop    %r13
+  8026bd:	5d                   	pop    %rbp
+  8026be:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8026bf:	8b 3b                	mov    (%rbx),%edi
+  8026c1:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8026c5:	48 b8 f4 25 80 00 00 	movabs $0x8025f4,%rax
+  8026cc:	00 00 00 
+  8026cf:	ff d0                	call   *%rax
+  8026d1:	41 89 c5             	mov    %eax,%r13d
+  8026d4:	85 c0                	test   %eax,%eax
+  8026d6:	78 1b                	js     8026f3 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  8026d8:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8026dc:	48 8b 40 20          	mov    0x20(%rax),%rax
+  8026e0:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  8026e6:	48 85 c0             	test   %rax,%rax
+  8026e9:	74 08                	je     8026f3 <fd_close+0x8f>
+  8026eb:	48 89 df             	mov    %rbx,%rdi
+  8026ee:	ff d0                	call   *%rax
+  8026f0:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8026f3:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8026f8:	48 89 de             	mov    %rbx,%rsi
+  8026fb:	bf 00 00 00 00       	mov    $0x0,%edi
+  802700:	48 b8 9a 1e 80 00 00 	movabs $0x801e9a,%rax
+  802707:	00 00 00 
+  80270a:	ff d0                	call   *%rax
+    return res;
+  80270c:	eb a3                	jmp    8026b1 <fd_close+0x4d>
+
+000000000080270e <close>:
+
+int
+close(int fdnum) {
+  80270e:	55                   	push   %rbp
+  80270f:	48 89 e5             	mov    %rsp,%rbp
+  802712:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  802716:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80271a:	48 b8 a9 25 80 00 00 	movabs $0x8025a9,%rax
+  802721:	00 00 00 
+  802724:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802726:	85 c0                	test   %eax,%eax
+  802728:	78 15                	js     80273f <close+0x31>
+
+    return fd_close(fd, 1);
+  80272a:	be 01 00 00 00       	mov    $0x1,%esi
+  80272f:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802733:	48 b8 64 26 80 00 00 	movabs $0x802664,%rax
+  80273a:	00 00 00 
+  80273d:	ff d0                	call   *%rax
+}
+  80273f:	c9                   	leave
+  802740:	c3                   	ret
+
+0000000000802741 <close_all>:
+
+void
+close_all(void) {
+  802741:	55                   	push   %rbp
+  802742:	48 89 e5             	mov    %rsp,%rbp
+  802745:	41 54                	push   %r12
+  802747:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  802748:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80274d:	49 bc 0e 27 80 00 00 	movabs $0x80270e,%r12
+  802754:	00 00 00 
+  802757:	89 df                	mov    %ebx,%edi
+  802759:	41 ff d4             	call   *%r12
+  80275c:	83 c3 01             	add    $0x1,%ebx
+  80275f:	83 fb 20             	cmp    $0x20,%ebx
+  802762:	75 f3                	jne    802757 <close_all+0x16>
+}
+  802764:	5b                   	pop    %rbx
+  802765:	41 5c                	pop    %r12
+  802767:	5d                   	pop    %rbp
+  802768:	c3                   	ret
+
+0000000000802769 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  802769:	55                   	push   %rbp
+  80276a:	48 89 e5             	mov    %rsp,%rbp
+  80276d:	41 57                	push   %r15
+  80276f:	41 56                	push   %r14
+  802771:	41 55                	push   %r13
+  802773:	41 54                	push   %r12
+  802775:	53                   	push   %rbx
+  802776:	48 83 ec 18          	sub    $0x18,%rsp
+  80277a:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  80277d:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  802781:	48 b8 a9 25 80 00 00 	movabs $0x8025a9,%rax
+  802788:	00 00 00 
+  80278b:	ff d0                	call   *%rax
+  80278d:	89 c3                	mov    %eax,%ebx
+  80278f:	85 c0                	test   %eax,%eax
+  802791:	0f 88 b8 00 00 00    	js     80284f <dup+0xe6>
+    close(newfdnum);
+  802797:	44 89 e7             	mov    %r12d,%edi
+  80279a:	48 b8 0e 27 80 00 00 	movabs $0x80270e,%rax
+  8027a1:	00 00 00 
+  8027a4:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  8027a6:	4d 63 ec             	movslq %r12d,%r13
+  8027a9:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  8027b0:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  8027b4:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  8027b8:	4c 89 ff             	mov    %r15,%rdi
+  8027bb:	49 be fa 24 80 00 00 	movabs $0x8024fa,%r14
+  8027c2:	00 00 00 
+  8027c5:	41 ff d6             	call   *%r14
+  8027c8:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  8027cb:	4c 89 ef             	mov    %r13,%rdi
+  8027ce:	41 ff d6             	call   *%r14
+  8027d1:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  8027d4:	48 89 df             	mov    %rbx,%rdi
+  8027d7:	48 b8 1f 36 80 00 00 	movabs $0x80361f,%rax
+  8027de:	00 00 00 
+  8027e1:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  8027e3:	a8 04                	test   $0x4,%al
+  8027e5:	74 2b                	je     802812 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  8027e7:	41 89 c1             	mov    %eax,%r9d
+  8027ea:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8027f0:	4c 89 f1             	mov    %r14,%rcx
+  8027f3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8027f8:	48 89 de             	mov    %rbx,%rsi
+  8027fb:	bf 00 00 00 00       	mov    $0x0,%edi
+  802800:	48 b8 35 1e 80 00 00 	movabs $0x801e35,%rax
+  802807:	00 00 00 
+  80280a:	ff d0                	call   *%rax
+  80280c:	89 c3                	mov    %eax,%ebx
+  80280e:	85 c0                	test   %eax,%eax
+  802810:	78 4e                	js     802860 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  802812:	4c 89 ff             	mov    %r15,%rdi
+  802815:	48 b8 1f 36 80 00 00 	movabs $0x80361f,%rax
+  80281c:	00 00 00 
+  80281f:	ff d0                	call   *%rax
+  802821:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  802824:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  80282a:	4c 89 e9             	mov    %r13,%rcx
+  80282d:	ba 00 00 00 00       	mov    $0x0,%edx
+  802832:	4c 89 fe             	mov    %r15,%rsi
+  802835:	bf 00 00 00 00       	mov    $0x0,%edi
+  80283a:	48 b8 35 1e 80 00 00 	movabs $0x801e35,%rax
+  802841:	00 00 00 
+  802844:	ff d0                	call   *%rax
+  802846:	89 c3                	mov    %eax,%ebx
+  802848:	85 c0                	test   %eax,%eax
+  80284a:	78 14                	js     802860 <dup+0xf7>
+
+    return newfdnum;
+  80284c:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  80284f:	89 d8                	mov    %ebx,%eax
+  802851:	48 83 c4 18          	add    $0x18,%rsp
+  802855:	5b                   	pop    %rbx
+  802856:	41 5c                	pop    %r12
+  802858:	41 5d                	pop    %r13
+  80285a:	41 5e                	pop    %r14
+  80285c:	41 5f                	pop    %r15
+  80285e:	5d                   	pop    %rbp
+  80285f:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  802860:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802865:	4c 89 ee             	mov    %r13,%rsi
+  802868:	bf 00 00 00 00       	mov    $0x0,%edi
+  80286d:	49 bc 9a 1e 80 00 00 	movabs $0x801e9a,%r12
+  802874:	00 00 00 
+  802877:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  80287a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80287f:	4c 89 f6             	mov    %r14,%rsi
+  802882:	bf 00 00 00 00       	mov    $0x0,%edi
+  802887:	41 ff d4             	call   *%r12
+    return res;
+  80288a:	eb c3                	jmp    80284f <dup+0xe6>
+
+000000000080288c <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  80288c:	55                   	push   %rbp
+  80288d:	48 89 e5             	mov    %rsp,%rbp
+  802890:	41 56                	push   %r14
+  802892:	41 55                	push   %r13
+  802894:	41 54                	push   %r12
+  802896:	53                   	push   %rbx
+  802897:	48 83 ec 10          	sub    $0x10,%rsp
+  80289b:	89 fb                	mov    %edi,%ebx
+  80289d:	49 89 f4             	mov    %rsi,%r12
+  8028a0:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8028a3:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8028a7:	48 b8 a9 25 80 00 00 	movabs $0x8025a9,%rax
+  8028ae:	00 00 00 
+  8028b1:	ff d0                	call   *%rax
+  8028b3:	85 c0                	test   %eax,%eax
+  8028b5:	78 4c                	js     802903 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8028b7:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  8028bb:	41 8b 3e             	mov    (%r14),%edi
+  8028be:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8028c2:	48 b8 f4 25 80 00 00 	movabs $0x8025f4,%rax
+  8028c9:	00 00 00 
+  8028cc:	ff d0                	call   *%rax
+  8028ce:	85 c0                	test   %eax,%eax
+  8028d0:	78 35                	js     802907 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8028d2:	41 8b 46 08          	mov    0x8(%r14),%eax
+  8028d6:	83 e0 03             	and    $0x3,%eax
+  8028d9:	83 f8 01             	cmp    $0x1,%eax
+  8028dc:	74 2d                	je     80290b <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  8028de:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8028e2:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8028e6:	48 85 c0             	test   %rax,%rax
+  8028e9:	74 56                	je     802941 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  8028eb:	4c 89 ea             	mov    %r13,%rdx
+  8028ee:	4c 89 e6             	mov    %r12,%rsi
+  8028f1:	4c 89 f7             	mov    %r14,%rdi
+  8028f4:	ff d0                	call   *%rax
+}
+  8028f6:	48 83 c4 10          	add    $0x10,%rsp
+  8028fa:	5b                   	pop    %rbx
+  8028fb:	41 5c                	pop    %r12
+  8028fd:	41 5d                	pop    %r13
+  8028ff:	41 5e                	pop    %r14
+  802901:	5d                   	pop    %rbp
+  802902:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802903:	48 98                	cltq
+  802905:	eb ef                	jmp    8028f6 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802907:	48 98                	cltq
+  802909:	eb eb                	jmp    8028f6 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  80290b:	48 a1 d0 61 80 00 00 	movabs 0x8061d0,%rax
+  802912:	00 00 00 
+  802915:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+  80291b:	89 da                	mov    %ebx,%edx
+  80291d:	48 bf c9 43 80 00 00 	movabs $0x8043c9,%rdi
+  802924:	00 00 00 
+  802927:	b8 00 00 00 00       	mov    $0x0,%eax
+  80292c:	48 b9 f9 0e 80 00 00 	movabs $0x800ef9,%rcx
+  802933:	00 00 00 
+  802936:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  802938:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80293f:	eb b5                	jmp    8028f6 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  802941:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  802948:	eb ac                	jmp    8028f6 <read+0x6a>
+
+000000000080294a <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  80294a:	55                   	push   %rbp
+  80294b:	48 89 e5             	mov    %rsp,%rbp
+  80294e:	41 57                	push   %r15
+  802950:	41 56                	push   %r14
+  802952:	41 55                	push   %r13
+  802954:	41 54                	push   %r12
+  802956:	53                   	push   %rbx
+  802957:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  80295b:	48 85 d2             	test   %rdx,%rdx
+  80295e:	74 54                	je     8029b4 <readn+0x6a>
+  802960:	41 89 fd             	mov    %edi,%r13d
+  802963:	49 89 f6             	mov    %rsi,%r14
+  802966:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  802969:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  80296e:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  802973:	49 bf 8c 28 80 00 00 	movabs $0x80288c,%r15
+  80297a:	00 00 00 
+  80297d:	4c 89 e2             	mov    %r12,%rdx
+  802980:	48 29 f2             	sub    %rsi,%rdx
+  802983:	4c 01 f6             	add    %r14,%rsi
+  802986:	44 89 ef             	mov    %r13d,%edi
+  802989:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  80298c:	85 c0                	test   %eax,%eax
+  80298e:	78 20                	js     8029b0 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  802990:	01 c3                	add    %eax,%ebx
+  802992:	85 c0                	test   %eax,%eax
+  802994:	74 08                	je     80299e <readn+0x54>
+  802996:	48 63 f3             	movslq %ebx,%rsi
+  802999:	4c 39 e6             	cmp    %r12,%rsi
+  80299c:	72 df                	jb     80297d <readn+0x33>
+    }
+    return res;
+  80299e:	48 63 c3             	movslq %ebx,%rax
+}
+  8029a1:	48 83 c4 08          	add    $0x8,%rsp
+  8029a5:	5b                   	pop    %rbx
+  8029a6:	41 5c                	pop    %r12
+  8029a8:	41 5d                	pop    %r13
+  8029aa:	41 5e                	pop    %r14
+  8029ac:	41 5f                	pop    %r15
+  8029ae:	5d                   	pop    %rbp
+  8029af:	c3                   	ret
+        if (inc < 0) return inc;
+  8029b0:	48 98                	cltq
+  8029b2:	eb ed                	jmp    8029a1 <readn+0x57>
+    int inc = 1, res = 0;
+  8029b4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8029b9:	eb e3                	jmp    80299e <readn+0x54>
+
+00000000008029bb <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  8029bb:	55                   	push   %rbp
+  8029bc:	48 89 e5             	mov    %rsp,%rbp
+  8029bf:	41 56                	push   %r14
+  8029c1:	41 55                	push   %r13
+  8029c3:	41 54                	push   %r12
+  8029c5:	53                   	push   %rbx
+  8029c6:	48 83 ec 10          	sub    $0x10,%rsp
+  8029ca:	89 fb                	mov    %edi,%ebx
+  8029cc:	49 89 f4             	mov    %rsi,%r12
+  8029cf:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8029d2:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8029d6:	48 b8 a9 25 80 00 00 	movabs $0x8025a9,%rax
+  8029dd:	00 00 00 
+  8029e0:	ff d0                	call   *%rax
+  8029e2:	85 c0                	test   %eax,%eax
+  8029e4:	78 47                	js     802a2d <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8029e6:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  8029ea:	41 8b 3e             	mov    (%r14),%edi
+  8029ed:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8029f1:	48 b8 f4 25 80 00 00 	movabs $0x8025f4,%rax
+  8029f8:	00 00 00 
+  8029fb:	ff d0                	call   *%rax
+  8029fd:	85 c0                	test   %eax,%eax
+  8029ff:	78 30                	js     802a31 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802a01:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  802a06:	74 2d                	je     802a35 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  802a08:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802a0c:	48 8b 40 18          	mov    0x18(%rax),%rax
+  802a10:	48 85 c0             	test   %rax,%rax
+  802a13:	74 56                	je     802a6b <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  802a15:	4c 89 ea             	mov    %r13,%rdx
+  802a18:	4c 89 e6             	mov    %r12,%rsi
+  802a1b:	4c 89 f7             	mov    %r14,%rdi
+  802a1e:	ff d0                	call   *%rax
+}
+  802a20:	48 83 c4 10          	add    $0x10,%rsp
+  802a24:	5b                   	pop    %rbx
+  802a25:	41 5c                	pop    %r12
+  802a27:	41 5d                	pop    %r13
+  802a29:	41 5e                	pop    %r14
+  802a2b:	5d                   	pop    %rbp
+  802a2c:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802a2d:	48 98                	cltq
+  802a2f:	eb ef                	jmp    802a20 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802a31:	48 98                	cltq
+  802a33:	eb eb                	jmp    802a20 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  802a35:	48 a1 d0 61 80 00 00 	movabs 0x8061d0,%rax
+  802a3c:	00 00 00 
+  802a3f:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+  802a45:	89 da                	mov    %ebx,%edx
+  802a47:	48 bf e5 43 80 00 00 	movabs $0x8043e5,%rdi
+  802a4e:	00 00 00 
+  802a51:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a56:	48 b9 f9 0e 80 00 00 	movabs $0x800ef9,%rcx
+  802a5d:	00 00 00 
+  802a60:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  802a62:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802a69:	eb b5                	jmp    802a20 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  802a6b:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  802a72:	eb ac                	jmp    802a20 <write+0x65>
+
+0000000000802a74 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  802a74:	55                   	push   %rbp
+  802a75:	48 89 e5             	mov    %rsp,%rbp
+  802a78:	53                   	push   %rbx
+  802a79:	48 83 ec 18          	sub    $0x18,%rsp
+  802a7d:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802a7f:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802a83:	48 b8 a9 25 80 00 00 	movabs $0x8025a9,%rax
+  802a8a:	00 00 00 
+  802a8d:	ff d0                	call   *%rax
+  802a8f:	85 c0                	test   %eax,%eax
+  802a91:	78 0c                	js     802a9f <seek+0x2b>
+
+    fd->fd_offset = offset;
+  802a93:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802a97:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  802a9a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802a9f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802aa3:	c9                   	leave
+  802aa4:	c3                   	ret
+
+0000000000802aa5 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  802aa5:	55                   	push   %rbp
+  802aa6:	48 89 e5             	mov    %rsp,%rbp
+  802aa9:	41 55                	push   %r13
+  802aab:	41 54                	push   %r12
+  802aad:	53                   	push   %rbx
+  802aae:	48 83 ec 18          	sub    $0x18,%rsp
+  802ab2:	89 fb                	mov    %edi,%ebx
+  802ab4:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802ab7:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802abb:	48 b8 a9 25 80 00 00 	movabs $0x8025a9,%rax
+  802ac2:	00 00 00 
+  802ac5:	ff d0                	call   *%rax
+  802ac7:	85 c0                	test   %eax,%eax
+  802ac9:	78 38                	js     802b03 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802acb:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  802acf:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  802ad3:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802ad7:	48 b8 f4 25 80 00 00 	movabs $0x8025f4,%rax
+  802ade:	00 00 00 
+  802ae1:	ff d0                	call   *%rax
+  802ae3:	85 c0                	test   %eax,%eax
+  802ae5:	78 1c                	js     802b03 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802ae7:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  802aec:	74 20                	je     802b0e <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  802aee:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802af2:	48 8b 40 30          	mov    0x30(%rax),%rax
+  802af6:	48 85 c0             	test   %rax,%rax
+  802af9:	74 47                	je     802b42 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  802afb:	44 89 e6             	mov    %r12d,%esi
+  802afe:	4c 89 ef             	mov    %r13,%rdi
+  802b01:	ff d0                	call   *%rax
+}
+  802b03:	48 83 c4 18          	add    $0x18,%rsp
+  802b07:	5b                   	pop    %rbx
+  802b08:	41 5c                	pop    %r12
+  802b0a:	41 5d                	pop    %r13
+  802b0c:	5d                   	pop    %rbp
+  802b0d:	c3                   	ret
+                thisenv->env_id, fdnum);
+  802b0e:	48 a1 d0 61 80 00 00 	movabs 0x8061d0,%rax
+  802b15:	00 00 00 
+  802b18:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  802b1e:	89 da                	mov    %ebx,%edx
+  802b20:	48 bf a8 43 80 00 00 	movabs $0x8043a8,%rdi
+  802b27:	00 00 00 
+  802b2a:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b2f:	48 b9 f9 0e 80 00 00 	movabs $0x800ef9,%rcx
+  802b36:	00 00 00 
+  802b39:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  802b3b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802b40:	eb c1                	jmp    802b03 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  802b42:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802b47:	eb ba                	jmp    802b03 <ftruncate+0x5e>
+
+0000000000802b49 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  802b49:	55                   	push   %rbp
+  802b4a:	48 89 e5             	mov    %rsp,%rbp
+  802b4d:	41 54                	push   %r12
+  802b4f:	53                   	push   %rbx
+  802b50:	48 83 ec 10          	sub    $0x10,%rsp
+  802b54:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802b57:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802b5b:	48 b8 a9 25 80 00 00 	movabs $0x8025a9,%rax
+  802b62:	00 00 00 
+  802b65:	ff d0                	call   *%rax
+  802b67:	85 c0                	test   %eax,%eax
+  802b69:	78 4e                	js     802bb9 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802b6b:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  802b6f:	41 8b 3c 24          	mov    (%r12),%edi
+  802b73:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  802b77:	48 b8 f4 25 80 00 00 	movabs $0x8025f4,%rax
+  802b7e:	00 00 00 
+  802b81:	ff d0                	call   *%rax
+  802b83:	85 c0                	test   %eax,%eax
+  802b85:	78 32                	js     802bb9 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  802b87:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802b8b:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  802b90:	74 30                	je     802bc2 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  802b92:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  802b95:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  802b9c:	00 00 00 
+    stat->st_isdir = 0;
+  802b9f:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  802ba6:	00 00 00 
+    stat->st_dev = dev;
+  802ba9:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  802bb0:	48 89 de             	mov    %rbx,%rsi
+  802bb3:	4c 89 e7             	mov    %r12,%rdi
+  802bb6:	ff 50 28             	call   *0x28(%rax)
+}
+  802bb9:	48 83 c4 10          	add    $0x10,%rsp
+  802bbd:	5b                   	pop    %rbx
+  802bbe:	41 5c                	pop    %r12
+  802bc0:	5d                   	pop    %rbp
+  802bc1:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  802bc2:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802bc7:	eb f0                	jmp    802bb9 <fstat+0x70>
+
+0000000000802bc9 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  802bc9:	55                   	push   %rbp
+  802bca:	48 89 e5             	mov    %rsp,%rbp
+  802bcd:	41 54                	push   %r12
+  802bcf:	53                   	push   %rbx
+  802bd0:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  802bd3:	be 00 00 00 00       	mov    $0x0,%esi
+  802bd8:	48 b8 ac 2f 80 00 00 	movabs $0x802fac,%rax
+  802bdf:	00 00 00 
+  802be2:	ff d0                	call   *%rax
+  802be4:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  802be6:	85 c0                	test   %eax,%eax
+  802be8:	78 25                	js     802c0f <stat+0x46>
+
+    int res = fstat(fd, stat);
+  802bea:	4c 89 e6             	mov    %r12,%rsi
+  802bed:	89 c7                	mov    %eax,%edi
+  802bef:	48 b8 49 2b 80 00 00 	movabs $0x802b49,%rax
+  802bf6:	00 00 00 
+  802bf9:	ff d0                	call   *%rax
+  802bfb:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  802bfe:	89 df                	mov    %ebx,%edi
+  802c00:	48 b8 0e 27 80 00 00 	movabs $0x80270e,%rax
+  802c07:	00 00 00 
+  802c0a:	ff d0                	call   *%rax
+
+    return res;
+  802c0c:	44 89 e3             	mov    %r12d,%ebx
+}
+  802c0f:	89 d8                	mov    %ebx,%eax
+  802c11:	5b                   	pop    %rbx
+  802c12:	41 5c                	pop    %r12
+  802c14:	5d                   	pop    %rbp
+  802c15:	c3                   	ret
+
+0000000000802c16 <fsipc>:
+ * response may be written back to fsipcbuf.
+ * type: request code, passed as the simple integer IPC value.
+ * dstva: virtual address at which to receive reply page, 0 if none.
+ * Returns result from the file server. */
+static int
+fsipc(unsigned type, void *dstva) {
+  802c16:	55                   	push   %rbp
+  802c17:	48 89 e5             	mov    %rsp,%rbp
+  802c1a:	41 54                	push   %r12
+  802c1c:	53                   	push   %rbx
+  802c1d:	48 83 ec 10          	sub    $0x10,%rsp
+  802c21:	41 89 fc             	mov    %edi,%r12d
+  802c24:	48 89 f3             	mov    %rsi,%rbx
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802c27:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  802c2e:	00 00 00 
+  802c31:	83 38 00             	cmpl   $0x0,(%rax)
+  802c34:	74 5e                	je     802c94 <fsipc+0x7e>
+    if (debug) {
+        cprintf("[%08x] fsipc %d %08x\n",
+                thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+    }
+
+    ipc_send(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW);
+  802c36:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802c3c:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802c41:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  802c48:	00 00 00 
+  802c4b:	44 89 e6             	mov    %r12d,%esi
+  802c4e:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  802c55:	00 00 00 
+  802c58:	8b 38                	mov    (%rax),%edi
+  802c5a:	48 b8 13 3b 80 00 00 	movabs $0x803b13,%rax
+  802c61:	00 00 00 
+  802c64:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  802c66:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  802c6d:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  802c6e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802c73:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  802c77:	48 89 de             	mov    %rbx,%rsi
+  802c7a:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c7f:	48 b8 3e 3a 80 00 00 	movabs $0x803a3e,%rax
+  802c86:	00 00 00 
+  802c89:	ff d0                	call   *%rax
+}
+  802c8b:	48 83 c4 10          	add    $0x10,%rsp
+  802c8f:	5b                   	pop    %rbx
+  802c90:	41 5c                	pop    %r12
+  802c92:	5d                   	pop    %rbp
+  802c93:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802c94:	bf 03 00 00 00       	mov    $0x3,%edi
+  802c99:	48 b8 b6 3b 80 00 00 	movabs $0x803bb6,%rax
+  802ca0:	00 00 00 
+  802ca3:	ff d0                	call   *%rax
+  802ca5:	a3 00 80 80 00 00 00 	movabs %eax,0x808000
+  802cac:	00 00 
+  802cae:	eb 86                	jmp    802c36 <fsipc+0x20>
+
+0000000000802cb0 <devfile_trunc>:
+    return 0;
+}
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  802cb0:	55                   	push   %rbp
+  802cb1:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802cb4:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  802cbb:	00 00 00 
+  802cbe:	8b 57 0c             	mov    0xc(%rdi),%edx
+  802cc1:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  802cc3:	89 70 04             	mov    %esi,0x4(%rax)
+
+    return fsipc(FSREQ_SET_SIZE, NULL);
+  802cc6:	be 00 00 00 00       	mov    $0x0,%esi
+  802ccb:	bf 02 00 00 00       	mov    $0x2,%edi
+  802cd0:	48 b8 16 2c 80 00 00 	movabs $0x802c16,%rax
+  802cd7:	00 00 00 
+  802cda:	ff d0                	call   *%rax
+}
+  802cdc:	5d                   	pop    %rbp
+  802cdd:	c3                   	ret
+
+0000000000802cde <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  802cde:	55                   	push   %rbp
+  802cdf:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  802ce2:	8b 47 0c             	mov    0xc(%rdi),%eax
+  802ce5:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  802cec:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  802cee:	be 00 00 00 00       	mov    $0x0,%esi
+  802cf3:	bf 06 00 00 00       	mov    $0x6,%edi
+  802cf8:	48 b8 16 2c 80 00 00 	movabs $0x802c16,%rax
+  802cff:	00 00 00 
+  802d02:	ff d0                	call   *%rax
+}
+  802d04:	5d                   	pop    %rbp
+  802d05:	c3                   	ret
+
+0000000000802d06 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  802d06:	55                   	push   %rbp
+  802d07:	48 89 e5             	mov    %rsp,%rbp
+  802d0a:	41 54                	push   %r12
+  802d0c:	53                   	push   %rbx
+  802d0d:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802d10:	8b 47 0c             	mov    0xc(%rdi),%eax
+  802d13:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  802d1a:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  802d1c:	be 00 00 00 00       	mov    $0x0,%esi
+  802d21:	bf 05 00 00 00       	mov    $0x5,%edi
+  802d26:	48 b8 16 2c 80 00 00 	movabs $0x802c16,%rax
+  802d2d:	00 00 00 
+  802d30:	ff d0                	call   *%rax
+    if (res < 0) {
+  802d32:	85 c0                	test   %eax,%eax
+  802d34:	78 3d                	js     802d73 <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802d36:	49 bc 00 70 80 00 00 	movabs $0x807000,%r12
+  802d3d:	00 00 00 
+  802d40:	4c 89 e6             	mov    %r12,%rsi
+  802d43:	48 89 df             	mov    %rbx,%rdi
+  802d46:	48 b8 1e 18 80 00 00 	movabs $0x80181e,%rax
+  802d4d:	00 00 00 
+  802d50:	ff d0                	call   *%rax
+    st->st_size  = fsipcbuf.statRet.ret_size;
+  802d52:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  802d59:	00 
+  802d5a:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802d60:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  802d67:	00 
+  802d68:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  802d6e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802d73:	5b                   	pop    %rbx
+  802d74:	41 5c                	pop    %r12
+  802d76:	5d                   	pop    %rbp
+  802d77:	c3                   	ret
+
+0000000000802d78 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  802d78:	55                   	push   %rbp
+  802d79:	48 89 e5             	mov    %rsp,%rbp
+  802d7c:	41 57                	push   %r15
+  802d7e:	41 56                	push   %r14
+  802d80:	41 55                	push   %r13
+  802d82:	41 54                	push   %r12
+  802d84:	53                   	push   %rbx
+  802d85:	48 83 ec 18          	sub    $0x18,%rsp
+  802d89:	49 89 fe             	mov    %rdi,%r14
+  802d8c:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+  802d90:	48 89 d3             	mov    %rdx,%rbx
+    while (n > sizeof(fsipcbuf.write.req_buf))
+  802d93:	48 81 fa f0 0f 00 00 	cmp    $0xff0,%rdx
+  802d9a:	0f 86 e4 00 00 00    	jbe    802e84 <devfile_write+0x10c>
+  802da0:	49 89 f4             	mov    %rsi,%r12
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802da3:	49 bd 00 70 80 00 00 	movabs $0x807000,%r13
+  802daa:	00 00 00 
+        memcpy(fsipcbuf.write.req_buf, buf, sizeof(fsipcbuf.write.req_buf));
+  802dad:	49 bf 7f 1a 80 00 00 	movabs $0x801a7f,%r15
+  802db4:	00 00 00 
+  802db7:	eb 03                	jmp    802dbc <devfile_write+0x44>
+        buf += sizeof(fsipcbuf.write.req_buf);
+  802db9:	49 89 f4             	mov    %rsi,%r12
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802dbc:	41 8b 46 0c          	mov    0xc(%r14),%eax
+  802dc0:	41 89 45 00          	mov    %eax,0x0(%r13)
+        fsipcbuf.write.req_n      = sizeof(fsipcbuf.write.req_buf);
+  802dc4:	49 c7 45 08 f0 0f 00 	movq   $0xff0,0x8(%r13)
+  802dcb:	00 
+        memcpy(fsipcbuf.write.req_buf, buf, sizeof(fsipcbuf.write.req_buf));
+  802dcc:	ba f0 0f 00 00       	mov    $0xff0,%edx
+  802dd1:	4c 89 e6             	mov    %r12,%rsi
+  802dd4:	48 bf 10 70 80 00 00 	movabs $0x807010,%rdi
+  802ddb:	00 00 00 
+  802dde:	41 ff d7             	call   *%r15
+        ssize_t res = fsipc(FSREQ_WRITE, NULL);
+  802de1:	be 00 00 00 00       	mov    $0x0,%esi
+  802de6:	bf 04 00 00 00       	mov    $0x4,%edi
+  802deb:	48 b8 16 2c 80 00 00 	movabs $0x802c16,%rax
+  802df2:	00 00 00 
+  802df5:	ff d0                	call   *%rax
+  802df7:	48 63 d0             	movslq %eax,%rdx
+        if (res < 0 || res < sizeof(fsipcbuf.write.req_buf))
+  802dfa:	3d ef 0f 00 00       	cmp    $0xfef,%eax
+  802dff:	7e 71                	jle    802e72 <devfile_write+0xfa>
+        buf += sizeof(fsipcbuf.write.req_buf);
+  802e01:	49 8d b4 24 f0 0f 00 	lea    0xff0(%r12),%rsi
+  802e08:	00 
+        n -= sizeof(fsipcbuf.write.req_buf);
+  802e09:	48 81 eb f0 0f 00 00 	sub    $0xff0,%rbx
+    while (n > sizeof(fsipcbuf.write.req_buf))
+  802e10:	48 81 fb f0 0f 00 00 	cmp    $0xff0,%rbx
+  802e17:	77 a0                	ja     802db9 <devfile_write+0x41>
+        written += sizeof(fsipcbuf.write.req_buf);
+  802e19:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802e1d:	49 29 c4             	sub    %rax,%r12
+  802e20:	4d 8d a4 24 f0 0f 00 	lea    0xff0(%r12),%r12
+  802e27:	00 
+    fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802e28:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  802e2f:	00 00 00 
+  802e32:	41 8b 56 0c          	mov    0xc(%r14),%edx
+  802e36:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.write.req_n      = n;
+  802e38:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    memcpy(fsipcbuf.write.req_buf, buf, n);
+  802e3c:	48 89 da             	mov    %rbx,%rdx
+  802e3f:	48 8d 78 10          	lea    0x10(%rax),%rdi
+  802e43:	48 b8 7f 1a 80 00 00 	movabs $0x801a7f,%rax
+  802e4a:	00 00 00 
+  802e4d:	ff d0                	call   *%rax
+    ssize_t res = fsipc(FSREQ_WRITE, NULL);
+  802e4f:	be 00 00 00 00       	mov    $0x0,%esi
+  802e54:	bf 04 00 00 00       	mov    $0x4,%edi
+  802e59:	48 b8 16 2c 80 00 00 	movabs $0x802c16,%rax
+  802e60:	00 00 00 
+  802e63:	ff d0                	call   *%rax
+  802e65:	48 63 d0             	movslq %eax,%rdx
+    written += res;
+  802e68:	49 01 d4             	add    %rdx,%r12
+  802e6b:	48 85 d2             	test   %rdx,%rdx
+  802e6e:	49 0f 49 d4          	cmovns %r12,%rdx
+}
+  802e72:	48 89 d0             	mov    %rdx,%rax
+  802e75:	48 83 c4 18          	add    $0x18,%rsp
+  802e79:	5b                   	pop    %rbx
+  802e7a:	41 5c                	pop    %r12
+  802e7c:	41 5d                	pop    %r13
+  802e7e:	41 5e                	pop    %r14
+  802e80:	41 5f                	pop    %r15
+  802e82:	5d                   	pop    %rbp
+  802e83:	c3                   	ret
+    while (n > sizeof(fsipcbuf.write.req_buf))
+  802e84:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+    ssize_t written = 0;
+  802e88:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802e8e:	eb 98                	jmp    802e28 <devfile_write+0xb0>
+
+0000000000802e90 <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  802e90:	55                   	push   %rbp
+  802e91:	48 89 e5             	mov    %rsp,%rbp
+  802e94:	41 57                	push   %r15
+  802e96:	41 56                	push   %r14
+  802e98:	41 55                	push   %r13
+  802e9a:	41 54                	push   %r12
+  802e9c:	53                   	push   %rbx
+  802e9d:	48 83 ec 18          	sub    $0x18,%rsp
+  802ea1:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  802ea5:	49 89 f6             	mov    %rsi,%r14
+  802ea8:	49 89 d4             	mov    %rdx,%r12
+    while (n > sizeof(fsipcbuf.readRet.ret_buf))
+  802eab:	48 81 fa 00 10 00 00 	cmp    $0x1000,%rdx
+  802eb2:	0f 86 ea 00 00 00    	jbe    802fa2 <devfile_read+0x112>
+    ssize_t readsz = 0;
+  802eb8:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  802ebf:	00 
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802ec0:	49 bf 00 70 80 00 00 	movabs $0x807000,%r15
+  802ec7:	00 00 00 
+  802eca:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802ece:	8b 40 0c             	mov    0xc(%rax),%eax
+  802ed1:	41 89 07             	mov    %eax,(%r15)
+        fsipcbuf.read.req_n = sizeof(fsipcbuf.readRet.ret_buf);
+  802ed4:	49 c7 47 08 00 10 00 	movq   $0x1000,0x8(%r15)
+  802edb:	00 
+        ssize_t res = fsipc(FSREQ_READ, NULL);
+  802edc:	be 00 00 00 00       	mov    $0x0,%esi
+  802ee1:	bf 03 00 00 00       	mov    $0x3,%edi
+  802ee6:	48 b8 16 2c 80 00 00 	movabs $0x802c16,%rax
+  802eed:	00 00 00 
+  802ef0:	ff d0                	call   *%rax
+  802ef2:	4c 63 e8             	movslq %eax,%r13
+        if (res < 0)
+  802ef5:	4d 85 ed             	test   %r13,%r13
+  802ef8:	0f 88 92 00 00 00    	js     802f90 <devfile_read+0x100>
+        memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  802efe:	4c 89 ea             	mov    %r13,%rdx
+  802f01:	4c 89 fe             	mov    %r15,%rsi
+  802f04:	4c 89 f7             	mov    %r14,%rdi
+  802f07:	48 b8 7f 1a 80 00 00 	movabs $0x801a7f,%rax
+  802f0e:	00 00 00 
+  802f11:	ff d0                	call   *%rax
+        if (res < sizeof(fsipcbuf.readRet.ret_buf))
+  802f13:	49 81 fd ff 0f 00 00 	cmp    $0xfff,%r13
+  802f1a:	76 6d                	jbe    802f89 <devfile_read+0xf9>
+        readsz += res;
+  802f1c:	4c 01 6d c0          	add    %r13,-0x40(%rbp)
+        buf += res;
+  802f20:	4d 01 ee             	add    %r13,%r14
+        n -= res;
+  802f23:	4d 29 ec             	sub    %r13,%r12
+    while (n > sizeof(fsipcbuf.readRet.ret_buf))
+  802f26:	49 81 fc 00 10 00 00 	cmp    $0x1000,%r12
+  802f2d:	77 9b                	ja     802eca <devfile_read+0x3a>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802f2f:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  802f36:	00 00 00 
+  802f39:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  802f3d:	8b 51 0c             	mov    0xc(%rcx),%edx
+  802f40:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.read.req_n = n;
+  802f42:	4c 89 60 08          	mov    %r12,0x8(%rax)
+    ssize_t res = fsipc(FSREQ_READ, NULL);
+  802f46:	be 00 00 00 00       	mov    $0x0,%esi
+  802f4b:	bf 03 00 00 00       	mov    $0x3,%edi
+  802f50:	48 b8 16 2c 80 00 00 	movabs $0x802c16,%rax
+  802f57:	00 00 00 
+  802f5a:	ff d0                	call   *%rax
+  802f5c:	4c 63 e8             	movslq %eax,%r13
+    if (res < 0)
+  802f5f:	4d 85 ed             	test   %r13,%r13
+  802f62:	78 2c                	js     802f90 <devfile_read+0x100>
+    memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  802f64:	4c 89 ea             	mov    %r13,%rdx
+  802f67:	48 be 00 70 80 00 00 	movabs $0x807000,%rsi
+  802f6e:	00 00 00 
+  802f71:	4c 89 f7             	mov    %r14,%rdi
+  802f74:	48 b8 7f 1a 80 00 00 	movabs $0x801a7f,%rax
+  802f7b:	00 00 00 
+  802f7e:	ff d0                	call   *%rax
+    readsz += res;
+  802f80:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802f84:	49 01 c5             	add    %rax,%r13
+    return readsz;
+  802f87:	eb 07                	jmp    802f90 <devfile_read+0x100>
+            return readsz + res;
+  802f89:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802f8d:	49 01 c5             	add    %rax,%r13
+}
+  802f90:	4c 89 e8             	mov    %r13,%rax
+  802f93:	48 83 c4 18          	add    $0x18,%rsp
+  802f97:	5b                   	pop    %rbx
+  802f98:	41 5c                	pop    %r12
+  802f9a:	41 5d                	pop    %r13
+  802f9c:	41 5e                	pop    %r14
+  802f9e:	41 5f                	pop    %r15
+  802fa0:	5d                   	pop    %rbp
+  802fa1:	c3                   	ret
+    ssize_t readsz = 0;
+  802fa2:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  802fa9:	00 
+  802faa:	eb 83                	jmp    802f2f <devfile_read+0x9f>
+
+0000000000802fac <open>:
+open(const char *path, int mode) {
+  802fac:	55                   	push   %rbp
+  802fad:	48 89 e5             	mov    %rsp,%rbp
+  802fb0:	41 55                	push   %r13
+  802fb2:	41 54                	push   %r12
+  802fb4:	53                   	push   %rbx
+  802fb5:	48 83 ec 18          	sub    $0x18,%rsp
+  802fb9:	49 89 fc             	mov    %rdi,%r12
+  802fbc:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  802fbf:	48 b8 e0 17 80 00 00 	movabs $0x8017e0,%rax
+  802fc6:	00 00 00 
+  802fc9:	ff d0                	call   *%rax
+  802fcb:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802fd1:	0f 87 8a 00 00 00    	ja     803061 <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802fd7:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802fdb:	48 b8 8f 25 80 00 00 	movabs $0x80258f,%rax
+  802fe2:	00 00 00 
+  802fe5:	ff d0                	call   *%rax
+  802fe7:	89 c3                	mov    %eax,%ebx
+  802fe9:	85 c0                	test   %eax,%eax
+  802feb:	78 50                	js     80303d <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  802fed:	4c 89 e6             	mov    %r12,%rsi
+  802ff0:	48 bb 00 70 80 00 00 	movabs $0x807000,%rbx
+  802ff7:	00 00 00 
+  802ffa:	48 89 df             	mov    %rbx,%rdi
+  802ffd:	48 b8 1e 18 80 00 00 	movabs $0x80181e,%rax
+  803004:	00 00 00 
+  803007:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  803009:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  803010:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803014:	bf 01 00 00 00       	mov    $0x1,%edi
+  803019:	48 b8 16 2c 80 00 00 	movabs $0x802c16,%rax
+  803020:	00 00 00 
+  803023:	ff d0                	call   *%rax
+  803025:	89 c3                	mov    %eax,%ebx
+  803027:	85 c0                	test   %eax,%eax
+  803029:	78 1f                	js     80304a <open+0x9e>
+    return fd2num(fd);
+  80302b:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80302f:	48 b8 e8 24 80 00 00 	movabs $0x8024e8,%rax
+  803036:	00 00 00 
+  803039:	ff d0                	call   *%rax
+  80303b:	89 c3                	mov    %eax,%ebx
+}
+  80303d:	89 d8                	mov    %ebx,%eax
+  80303f:	48 83 c4 18          	add    $0x18,%rsp
+  803043:	5b                   	pop    %rbx
+  803044:	41 5c                	pop    %r12
+  803046:	41 5d                	pop    %r13
+  803048:	5d                   	pop    %rbp
+  803049:	c3                   	ret
+        fd_close(fd, 0);
+  80304a:	be 00 00 00 00       	mov    $0x0,%esi
+  80304f:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803053:	48 b8 64 26 80 00 00 	movabs $0x802664,%rax
+  80305a:	00 00 00 
+  80305d:	ff d0                	call   *%rax
+        return res;
+  80305f:	eb dc                	jmp    80303d <open+0x91>
+        return -E_BAD_PATH;
+  803061:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  803066:	eb d5                	jmp    80303d <open+0x91>
+
+0000000000803068 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  803068:	55                   	push   %rbp
+  803069:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc(FSREQ_SYNC, NULL);
+  80306c:	be 00 00 00 00       	mov    $0x0,%esi
+  803071:	bf 08 00 00 00       	mov    $0x8,%edi
+  803076:	48 b8 16 2c 80 00 00 	movabs $0x802c16,%rax
+  80307d:	00 00 00 
+  803080:	ff d0                	call   *%rax
+}
+  803082:	5d                   	pop    %rbp
+  803083:	c3                   	ret
+
+0000000000803084 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  803084:	55                   	push   %rbp
+  803085:	48 89 e5             	mov    %rsp,%rbp
+  803088:	41 54                	push   %r12
+  80308a:	53                   	push   %rbx
+  80308b:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80308e:	48 b8 fa 24 80 00 00 	movabs $0x8024fa,%rax
+  803095:	00 00 00 
+  803098:	ff d0                	call   *%rax
+  80309a:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  80309d:	48 be 40 44 80 00 00 	movabs $0x804440,%rsi
+  8030a4:	00 00 00 
+  8030a7:	48 89 df             	mov    %rbx,%rdi
+  8030aa:	48 b8 1e 18 80 00 00 	movabs $0x80181e,%rax
+  8030b1:	00 00 00 
+  8030b4:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  8030b6:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  8030bb:	41 2b 04 24          	sub    (%r12),%eax
+  8030bf:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  8030c5:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8030cc:	00 00 00 
+    stat->st_dev = &devpipe;
+  8030cf:	48 b8 60 50 80 00 00 	movabs $0x805060,%rax
+  8030d6:	00 00 00 
+  8030d9:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  8030e0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8030e5:	5b                   	pop    %rbx
+  8030e6:	41 5c                	pop    %r12
+  8030e8:	5d                   	pop    %rbp
+  8030e9:	c3                   	ret
+
+00000000008030ea <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  8030ea:	55                   	push   %rbp
+  8030eb:	48 89 e5             	mov    %rsp,%rbp
+  8030ee:	41 54                	push   %r12
+  8030f0:	53                   	push   %rbx
+  8030f1:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8030f4:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8030f9:	48 89 fe             	mov    %rdi,%rsi
+  8030fc:	bf 00 00 00 00       	mov    $0x0,%edi
+  803101:	49 bc 9a 1e 80 00 00 	movabs $0x801e9a,%r12
+  803108:	00 00 00 
+  80310b:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  80310e:	48 89 df             	mov    %rbx,%rdi
+  803111:	48 b8 fa 24 80 00 00 	movabs $0x8024fa,%rax
+  803118:	00 00 00 
+  80311b:	ff d0                	call   *%rax
+  80311d:	48 89 c6             	mov    %rax,%rsi
+  803120:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803125:	bf 00 00 00 00       	mov    $0x0,%edi
+  80312a:	41 ff d4             	call   *%r12
+}
+  80312d:	5b                   	pop    %rbx
+  80312e:	41 5c                	pop    %r12
+  803130:	5d                   	pop    %rbp
+  803131:	c3                   	ret
+
+0000000000803132 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  803132:	55                   	push   %rbp
+  803133:	48 89 e5             	mov    %rsp,%rbp
+  803136:	41 57                	push   %r15
+  803138:	41 56                	push   %r14
+  80313a:	41 55                	push   %r13
+  80313c:	41 54                	push   %r12
+  80313e:	53                   	push   %rbx
+  80313f:	48 83 ec 18          	sub    $0x18,%rsp
+  803143:	49 89 fc             	mov    %rdi,%r12
+  803146:	49 89 f5             	mov    %rsi,%r13
+  803149:	49 89 d7             	mov    %rdx,%r15
+  80314c:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803150:	48 b8 fa 24 80 00 00 	movabs $0x8024fa,%rax
+  803157:	00 00 00 
+  80315a:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  80315c:	4d 85 ff             	test   %r15,%r15
+  80315f:	0f 84 af 00 00 00    	je     803214 <devpipe_write+0xe2>
+  803165:	48 89 c3             	mov    %rax,%rbx
+  803168:	4c 89 f8             	mov    %r15,%rax
+  80316b:	4d 89 ef             	mov    %r13,%r15
+  80316e:	4c 01 e8             	add    %r13,%rax
+  803171:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803175:	49 bd a2 1d 80 00 00 	movabs $0x801da2,%r13
+  80317c:	00 00 00 
+            sys_yield();
+  80317f:	49 be 3f 1d 80 00 00 	movabs $0x801d3f,%r14
+  803186:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  803189:	8b 73 04             	mov    0x4(%rbx),%esi
+  80318c:	48 63 ce             	movslq %esi,%rcx
+  80318f:	48 63 03             	movslq (%rbx),%rax
+  803192:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  803198:	48 39 c1             	cmp    %rax,%rcx
+  80319b:	72 2e                	jb     8031cb <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80319d:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8031a2:	48 89 da             	mov    %rbx,%rdx
+  8031a5:	be 00 10 00 00       	mov    $0x1000,%esi
+  8031aa:	4c 89 e7             	mov    %r12,%rdi
+  8031ad:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  8031b0:	85 c0                	test   %eax,%eax
+  8031b2:	74 66                	je     80321a <devpipe_write+0xe8>
+            sys_yield();
+  8031b4:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  8031b7:	8b 73 04             	mov    0x4(%rbx),%esi
+  8031ba:	48 63 ce             	movslq %esi,%rcx
+  8031bd:	48 63 03             	movslq (%rbx),%rax
+  8031c0:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  8031c6:	48 39 c1             	cmp    %rax,%rcx
+  8031c9:	73 d2                	jae    80319d <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8031cb:	41 0f b6 3f          	movzbl (%r15),%edi
+  8031cf:	48 89 ca             	mov    %rcx,%rdx
+  8031d2:	48 c1 ea 03          	shr    $0x3,%rdx
+  8031d6:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  8031dd:	08 10 20 
+  8031e0:	48 f7 e2             	mul    %rdx
+  8031e3:	48 c1 ea 06          	shr    $0x6,%rdx
+  8031e7:	48 89 d0             	mov    %rdx,%rax
+  8031ea:	48 c1 e0 09          	shl    $0x9,%rax
+  8031ee:	48 29 d0             	sub    %rdx,%rax
+  8031f1:	48 c1 e0 03          	shl    $0x3,%rax
+  8031f5:	48 29 c1             	sub    %rax,%rcx
+  8031f8:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  8031fd:	83 c6 01             	add    $0x1,%esi
+  803200:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803203:	49 83 c7 01          	add    $0x1,%r15
+  803207:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80320b:	49 39 c7             	cmp    %rax,%r15
+  80320e:	0f 85 75 ff ff ff    	jne    803189 <devpipe_write+0x57>
+    return n;
+  803214:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803218:	eb 05                	jmp    80321f <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  80321a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80321f:	48 83 c4 18          	add    $0x18,%rsp
+  803223:	5b                   	pop    %rbx
+  803224:	41 5c                	pop    %r12
+  803226:	41 5d                	pop    %r13
+  803228:	41 5e                	pop    %r14
+  80322a:	41 5f                	pop    %r15
+  80322c:	5d                   	pop    %rbp
+  80322d:	c3                   	ret
+
+000000000080322e <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  80322e:	55                   	push   %rbp
+  80322f:	48 89 e5             	mov    %rsp,%rbp
+  803232:	41 57                	push   %r15
+  803234:	41 56                	push   %r14
+  803236:	41 55                	push   %r13
+  803238:	41 54                	push   %r12
+  80323a:	53                   	push   %rbx
+  80323b:	48 83 ec 18          	sub    $0x18,%rsp
+  80323f:	49 89 fc             	mov    %rdi,%r12
+  803242:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  803246:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80324a:	48 b8 fa 24 80 00 00 	movabs $0x8024fa,%rax
+  803251:	00 00 00 
+  803254:	ff d0                	call   *%rax
+  803256:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  803259:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80325f:	49 bd a2 1d 80 00 00 	movabs $0x801da2,%r13
+  803266:	00 00 00 
+            sys_yield();
+  803269:	49 be 3f 1d 80 00 00 	movabs $0x801d3f,%r14
+  803270:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  803273:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  803278:	74 7d                	je     8032f7 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  80327a:	8b 03                	mov    (%rbx),%eax
+  80327c:	3b 43 04             	cmp    0x4(%rbx),%eax
+  80327f:	75 26                	jne    8032a7 <devpipe_read+0x79>
+            if (i > 0) return i;
+  803281:	4d 85 ff             	test   %r15,%r15
+  803284:	75 77                	jne    8032fd <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803286:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80328b:	48 89 da             	mov    %rbx,%rdx
+  80328e:	be 00 10 00 00       	mov    $0x1000,%esi
+  803293:	4c 89 e7             	mov    %r12,%rdi
+  803296:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  803299:	85 c0                	test   %eax,%eax
+  80329b:	74 72                	je     80330f <devpipe_read+0xe1>
+            sys_yield();
+  80329d:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  8032a0:	8b 03                	mov    (%rbx),%eax
+  8032a2:	3b 43 04             	cmp    0x4(%rbx),%eax
+  8032a5:	74 df                	je     803286 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  8032a7:	48 63 c8             	movslq %eax,%rcx
+  8032aa:	48 89 ca             	mov    %rcx,%rdx
+  8032ad:	48 c1 ea 03          	shr    $0x3,%rdx
+  8032b1:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  8032b8:	08 10 20 
+  8032bb:	48 89 d0             	mov    %rdx,%rax
+  8032be:	48 f7 e6             	mul    %rsi
+  8032c1:	48 c1 ea 06          	shr    $0x6,%rdx
+  8032c5:	48 89 d0             	mov    %rdx,%rax
+  8032c8:	48 c1 e0 09          	shl    $0x9,%rax
+  8032cc:	48 29 d0             	sub    %rdx,%rax
+  8032cf:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  8032d6:	00 
+  8032d7:	48 89 c8             	mov    %rcx,%rax
+  8032da:	48 29 d0             	sub    %rdx,%rax
+  8032dd:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  8032e2:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8032e6:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  8032ea:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8032ed:	49 83 c7 01          	add    $0x1,%r15
+  8032f1:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  8032f5:	75 83                	jne    80327a <devpipe_read+0x4c>
+    return n;
+  8032f7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8032fb:	eb 03                	jmp    803300 <devpipe_read+0xd2>
+            if (i > 0) return i;
+  8032fd:	4c 89 f8             	mov    %r15,%rax
+}
+  803300:	48 83 c4 18          	add    $0x18,%rsp
+  803304:	5b                   	pop    %rbx
+  803305:	41 5c                	pop    %r12
+  803307:	41 5d                	pop    %r13
+  803309:	41 5e                	pop    %r14
+  80330b:	41 5f                	pop    %r15
+  80330d:	5d                   	pop    %rbp
+  80330e:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  80330f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803314:	eb ea                	jmp    803300 <devpipe_read+0xd2>
+
+0000000000803316 <pipe>:
+pipe(int pfd[2]) {
+  803316:	55                   	push   %rbp
+  803317:	48 89 e5             	mov    %rsp,%rbp
+  80331a:	41 55                	push   %r13
+  80331c:	41 54                	push   %r12
+  80331e:	53                   	push   %rbx
+  80331f:	48 81 ec b8 00 00 00 	sub    $0xb8,%rsp
+  803326:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803329:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  80332d:	48 b8 8f 25 80 00 00 	movabs $0x80258f,%rax
+  803334:	00 00 00 
+  803337:	ff d0                	call   *%rax
+  803339:	89 c3                	mov    %eax,%ebx
+  80333b:	85 c0                	test   %eax,%eax
+  80333d:	0f 88 51 01 00 00    	js     803494 <pipe+0x17e>
+        (res = fd_alloc_from(fd2num(fd0) + 1, &fd1)) < 0) goto err;
+  803343:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803347:	48 b8 e8 24 80 00 00 	movabs $0x8024e8,%rax
+  80334e:	00 00 00 
+  803351:	ff d0                	call   *%rax
+  803353:	8d 78 01             	lea    0x1(%rax),%edi
+  803356:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80335a:	48 b8 16 25 80 00 00 	movabs $0x802516,%rax
+  803361:	00 00 00 
+  803364:	ff d0                	call   *%rax
+  803366:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803368:	85 c0                	test   %eax,%eax
+  80336a:	0f 88 24 01 00 00    	js     803494 <pipe+0x17e>
+    va = fd2data(fd0);
+  803370:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803374:	48 bb fa 24 80 00 00 	movabs $0x8024fa,%rbx
+  80337b:	00 00 00 
+  80337e:	ff d3                	call   *%rbx
+  803380:	49 89 c5             	mov    %rax,%r13
+    struct RegionOp ops[] = {
+  803383:	48 8d bd 30 ff ff ff 	lea    -0xd0(%rbp),%rdi
+  80338a:	b9 14 00 00 00       	mov    $0x14,%ecx
+  80338f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803394:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+  803397:	c7 85 34 ff ff ff 46 	movl   $0x46,-0xcc(%rbp)
+  80339e:	00 00 00 
+  8033a1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8033a5:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+  8033ac:	48 c7 85 50 ff ff ff 	movq   $0x1000,-0xb0(%rbp)
+  8033b3:	00 10 00 00 
+  8033b7:	c7 85 5c ff ff ff 46 	movl   $0x46,-0xa4(%rbp)
+  8033be:	00 00 00 
+            {.type = REGION_ALLOC, .dstva = (uintptr_t)fd1, .size = PAGE_SIZE, .perm = PROT_RW | PROT_SHARE},
+  8033c1:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+    struct RegionOp ops[] = {
+  8033c5:	48 89 bd 70 ff ff ff 	mov    %rdi,-0x90(%rbp)
+  8033cc:	48 c7 85 78 ff ff ff 	movq   $0x1000,-0x88(%rbp)
+  8033d3:	00 10 00 00 
+  8033d7:	c7 45 84 46 00 00 00 	movl   $0x46,-0x7c(%rbp)
+  8033de:	4c 89 6d 98          	mov    %r13,-0x68(%rbp)
+  8033e2:	48 c7 45 a0 00 10 00 	movq   $0x1000,-0x60(%rbp)
+  8033e9:	00 
+  8033ea:	c7 45 a8 01 00 00 00 	movl   $0x1,-0x58(%rbp)
+  8033f1:	c7 45 ac 46 00 00 00 	movl   $0x46,-0x54(%rbp)
+  8033f8:	4c 89 6d b8          	mov    %r13,-0x48(%rbp)
+            {.type = REGION_MAP, .srcva = (uintptr_t)va, .dstva = (uintptr_t)fd2data(fd1), .size = PAGE_SIZE, .perm = PROT_RW | PROT_SHARE},
+  8033fc:	ff d3                	call   *%rbx
+    struct RegionOp ops[] = {
+  8033fe:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803402:	48 c7 45 c8 00 10 00 	movq   $0x1000,-0x38(%rbp)
+  803409:	00 
+    if ((res = sys_region_batch(ops, sizeof ops / sizeof *ops)) < 0) goto err1;
+  80340a:	be 04 00 00 00       	mov    $0x4,%esi
+  80340f:	48 8d bd 30 ff ff ff 	lea    -0xd0(%rbp),%rdi
+  803416:	48 b8 01 1f 80 00 00 	movabs $0x801f01,%rax
+  80341d:	00 00 00 
+  803420:	ff d0                	call   *%rax
+  803422:	89 c3                	mov    %eax,%ebx
+  803424:	85 c0                	test   %eax,%eax
+  803426:	0f 88 ad 00 00 00    	js     8034d9 <pipe+0x1c3>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  80342c:	be 00 10 00 00       	mov    $0x1000,%esi
+  803431:	4c 89 ef             	mov    %r13,%rdi
+  803434:	48 b8 70 1d 80 00 00 	movabs $0x801d70,%rax
+  80343b:	00 00 00 
+  80343e:	ff d0                	call   *%rax
+  803440:	83 f8 02             	cmp    $0x2,%eax
+  803443:	75 5f                	jne    8034a4 <pipe+0x18e>
+    fd0->fd_dev_id = devpipe.dev_id;
+  803445:	a1 60 50 80 00 00 00 	movabs 0x805060,%eax
+  80344c:	00 00 
+  80344e:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803452:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  803454:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803458:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  80345f:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  803463:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  803465:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803469:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  803470:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803474:	48 bb e8 24 80 00 00 	movabs $0x8024e8,%rbx
+  80347b:	00 00 00 
+  80347e:	ff d3                	call   *%rbx
+  803480:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  803484:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  803488:	ff d3                	call   *%rbx
+  80348a:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  80348f:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  803494:	89 d8                	mov    %ebx,%eax
+  803496:	48 81 c4 b8 00 00 00 	add    $0xb8,%rsp
+  80349d:	5b                   	pop    %rbx
+  80349e:	41 5c                	pop    %r12
+  8034a0:	41 5d                	pop    %r13
+  8034a2:	5d                   	pop    %rbp
+  8034a3:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8034a4:	48 b9 58 44 80 00 00 	movabs $0x804458,%rcx
+  8034ab:	00 00 00 
+  8034ae:	48 ba 70 43 80 00 00 	movabs $0x804370,%rdx
+  8034b5:	00 00 00 
+  8034b8:	be 33 00 00 00       	mov    $0x33,%esi
+  8034bd:	48 bf 47 44 80 00 00 	movabs $0x804447,%rdi
+  8034c4:	00 00 00 
+  8034c7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8034cc:	49 b8 a9 0d 80 00 00 	movabs $0x800da9,%r8
+  8034d3:	00 00 00 
+  8034d6:	41 ff d0             	call   *%r8
+        ops[i].type = REGION_UNMAP;
+  8034d9:	c7 85 30 ff ff ff 02 	movl   $0x2,-0xd0(%rbp)
+  8034e0:	00 00 00 
+  8034e3:	c7 85 58 ff ff ff 02 	movl   $0x2,-0xa8(%rbp)
+  8034ea:	00 00 00 
+  8034ed:	c7 45 80 02 00 00 00 	movl   $0x2,-0x80(%rbp)
+  8034f4:	c7 45 a8 02 00 00 00 	movl   $0x2,-0x58(%rbp)
+    sys_region_batch(ops, sizeof ops / sizeof *ops);
+  8034fb:	be 04 00 00 00       	mov    $0x4,%esi
+  803500:	48 8d bd 30 ff ff ff 	lea    -0xd0(%rbp),%rdi
+  803507:	48 b8 01 1f 80 00 00 	movabs $0x801f01,%rax
+  80350e:	00 00 00 
+  803511:	ff d0                	call   *%rax
+  803513:	e9 7c ff ff ff       	jmp    803494 <pipe+0x17e>
+
+0000000000803518 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  803518:	55                   	push   %rbp
+  803519:	48 89 e5             	mov    %rsp,%rbp
+  80351c:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803520:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803524:	48 b8 a9 25 80 00 00 	movabs $0x8025a9,%rax
+  80352b:	00 00 00 
+  80352e:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803530:	85 c0                	test   %eax,%eax
+  803532:	78 35                	js     803569 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  803534:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803538:	48 b8 fa 24 80 00 00 	movabs $0x8024fa,%rax
+  80353f:	00 00 00 
+  803542:	ff d0                	call   *%rax
+  803544:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803547:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80354c:	be 00 10 00 00       	mov    $0x1000,%esi
+  803551:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803555:	48 b8 a2 1d 80 00 00 	movabs $0x801da2,%rax
+  80355c:	00 00 00 
+  80355f:	ff d0                	call   *%rax
+  803561:	85 c0                	test   %eax,%eax
+  803563:	0f 94 c0             	sete   %al
+  803566:	0f b6 c0             	movzbl %al,%eax
+}
+  803569:	c9                   	leave
+  80356a:	c3                   	ret
+
+000000000080356b <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  80356b:	48 89 f8             	mov    %rdi,%rax
+  80356e:	48 c1 e8 27          	shr    $0x27,%rax
+  803572:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  803579:	01 00 00 
+  80357c:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803580:	f6 c2 01             	test   $0x1,%dl
+  803583:	74 6d                	je     8035f2 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803585:	48 89 f8             	mov    %rdi,%rax
+  803588:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80358c:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  803593:	01 00 00 
+  803596:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80359a:	f6 c2 01             	test   $0x1,%dl
+  80359d:	74 62                	je     803601 <get_uvpt_entry+0x96>
+  80359f:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8035a6:	01 00 00 
+  8035a9:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8035ad:	f6 c2 80             	test   $0x80,%dl
+  8035b0:	75 4f                	jne    803601 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8035b2:	48 89 f8             	mov    %rdi,%rax
+  8035b5:	48 c1 e8 15          	shr    $0x15,%rax
+  8035b9:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8035c0:	01 00 00 
+  8035c3:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8035c7:	f6 c2 01             	test   $0x1,%dl
+  8035ca:	74 44                	je     803610 <get_uvpt_entry+0xa5>
+  8035cc:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8035d3:	01 00 00 
+  8035d6:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8035da:	f6 c2 80             	test   $0x80,%dl
+  8035dd:	75 31                	jne    803610 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  8035df:	48 c1 ef 0c          	shr    $0xc,%rdi
+  8035e3:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8035ea:	01 00 00 
+  8035ed:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  8035f1:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8035f2:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  8035f9:	01 00 00 
+  8035fc:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803600:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803601:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  803608:	01 00 00 
+  80360b:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80360f:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803610:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  803617:	01 00 00 
+  80361a:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80361e:	c3                   	ret
+
+000000000080361f <get_prot>:
+
+int
+get_prot(void *va) {
+  80361f:	55                   	push   %rbp
+  803620:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803623:	48 b8 6b 35 80 00 00 	movabs $0x80356b,%rax
+  80362a:	00 00 00 
+  80362d:	ff d0                	call   *%rax
+  80362f:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  803632:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  803637:	89 c1                	mov    %eax,%ecx
+  803639:	83 c9 04             	or     $0x4,%ecx
+  80363c:	f6 c2 01             	test   $0x1,%dl
+  80363f:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  803642:	89 c1                	mov    %eax,%ecx
+  803644:	83 c9 02             	or     $0x2,%ecx
+  803647:	f6 c2 02             	test   $0x2,%dl
+  80364a:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  80364d:	89 c1                	mov    %eax,%ecx
+  80364f:	83 c9 01             	or     $0x1,%ecx
+  803652:	48 85 d2             	test   %rdx,%rdx
+  803655:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  803658:	89 c1                	mov    %eax,%ecx
+  80365a:	83 c9 40             	or     $0x40,%ecx
+  80365d:	f6 c6 04             	test   $0x4,%dh
+  803660:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  803663:	5d                   	pop    %rbp
+  803664:	c3                   	ret
+
+0000000000803665 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  803665:	55                   	push   %rbp
+  803666:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803669:	48 b8 6b 35 80 00 00 	movabs $0x80356b,%rax
+  803670:	00 00 00 
+  803673:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  803675:	48 c1 e8 06          	shr    $0x6,%rax
+  803679:	83 e0 01             	and    $0x1,%eax
+}
+  80367c:	5d                   	pop    %rbp
+  80367d:	c3                   	ret
+
+000000000080367e <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  80367e:	55                   	push   %rbp
+  80367f:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  803682:	48 b8 6b 35 80 00 00 	movabs $0x80356b,%rax
+  803689:	00 00 00 
+  80368c:	ff d0                	call   *%rax
+  80368e:	83 e0 01             	and    $0x1,%eax
+}
+  803691:	5d                   	pop    %rbp
+  803692:	c3                   	ret
+
+0000000000803693 <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  803693:	55                   	push   %rbp
+  803694:	48 89 e5             	mov    %rsp,%rbp
+  803697:	41 57                	push   %r15
+  803699:	41 56                	push   %r14
+  80369b:	41 55                	push   %r13
+  80369d:	41 54                	push   %r12
+  80369f:	53                   	push   %rbx
+  8036a0:	48 83 ec 38          	sub    $0x38,%rsp
+  8036a4:	49 89 f7             	mov    %rsi,%r15
+  8036a7:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+                    }
+                    continue;
+                }
+                for (int ptei = 0; ptei < PT_ENTRY_COUNT; ptei++) {
+                    uintptr_t pte_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, pdei, ptei, 0);
+                    pte_t pte = uvpt[VPT(pte_addr)];
+  8036ad:	49 bd 00 00 00 00 00 	movabs $0x10000000000,%r13
+  8036b4:	01 00 00 
+  8036b7:	4d 89 e6             	mov    %r12,%r14
+  8036ba:	49 89 fc             	mov    %rdi,%r12
+  8036bd:	e9 19 01 00 00       	jmp    8037db <foreach_shared_region+0x148>
+  8036c2:	48 89 5d b0          	mov    %rbx,-0x50(%rbp)
+  8036c6:	4c 89 75 a8          	mov    %r14,-0x58(%rbp)
+  8036ca:	eb 52                	jmp    80371e <foreach_shared_region+0x8b>
+                for (int ptei = 0; ptei < PT_ENTRY_COUNT; ptei++) {
+  8036cc:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8036d3:	48 81 fb 00 00 20 00 	cmp    $0x200000,%rbx
+  8036da:	74 2e                	je     80370a <foreach_shared_region+0x77>
+                    uintptr_t pte_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, pdei, ptei, 0);
+  8036dc:	48 89 df             	mov    %rbx,%rdi
+  8036df:	4c 09 f7             	or     %r14,%rdi
+                    pte_t pte = uvpt[VPT(pte_addr)];
+  8036e2:	48 89 f8             	mov    %rdi,%rax
+  8036e5:	48 c1 e8 0c          	shr    $0xc,%rax
+  8036e9:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+                    if ((pte & PTE_P) && (pte & PTE_SHARE)) {
+  8036ee:	25 01 04 00 00       	and    $0x401,%eax
+  8036f3:	48 3d 01 04 00 00    	cmp    $0x401,%rax
+  8036f9:	75 d1                	jne    8036cc <foreach_shared_region+0x39>
+                        fun((void*)pte_addr, (void*)(pte_addr + PAGE_SIZE), arg);
+  8036fb:	48 8d b7 00 10 00 00 	lea    0x1000(%rdi),%rsi
+  803702:	4c 89 fa             	mov    %r15,%rdx
+  803705:	41 ff d4             	call   *%r12
+  803708:	eb c2                	jmp    8036cc <foreach_shared_region+0x39>
+            for (int pdei = 0; pdei < PD_ENTRY_COUNT; pdei++) {
+  80370a:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  803711:	00 
+  803712:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803716:	48 3d 00 00 00 40    	cmp    $0x40000000,%rax
+  80371c:	74 46                	je     803764 <foreach_shared_region+0xd1>
+                uintptr_t pde_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, pdei, 0, 0);
+  80371e:	4c 8b 75 c8          	mov    -0x38(%rbp),%r14
+  803722:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803726:	49 09 c6             	or     %rax,%r14
+                pde_t pde = uvpd[VPD(pde_addr)];
+  803729:	4c 89 f0             	mov    %r14,%rax
+  80372c:	48 c1 e8 15          	shr    $0x15,%rax
+  803730:	48 b9 00 00 00 80 00 	movabs $0x10080000000,%rcx
+  803737:	01 00 00 
+  80373a:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+                if (!(pde & PTE_P)) {
+  80373e:	a8 01                	test   $0x1,%al
+  803740:	74 c8                	je     80370a <foreach_shared_region+0x77>
+                if (pde & PTE_PS) {
+  803742:	48 89 c3             	mov    %rax,%rbx
+  803745:	81 e3 80 00 00 00    	and    $0x80,%ebx
+  80374b:	74 8f                	je     8036dc <foreach_shared_region+0x49>
+                    if (pde & PTE_SHARE) {
+  80374d:	f6 c4 04             	test   $0x4,%ah
+  803750:	74 b8                	je     80370a <foreach_shared_region+0x77>
+                        fun((void*)pde_addr, (void*)(pde_addr + 1024 * 1024 * 2), arg);
+  803752:	49 8d b6 00 00 20 00 	lea    0x200000(%r14),%rsi
+  803759:	4c 89 fa             	mov    %r15,%rdx
+  80375c:	4c 89 f7             	mov    %r14,%rdi
+  80375f:	41 ff d4             	call   *%r12
+  803762:	eb a6                	jmp    80370a <foreach_shared_region+0x77>
+  803764:	48 8b 5d b0          	mov    -0x50(%rbp),%rbx
+  803768:	4c 8b 75 a8          	mov    -0x58(%rbp),%r14
+        for (int pdpei = 0; pdpei < PDP_ENTRY_COUNT; pdpei++) {
+  80376c:	48 81 c3 00 00 00 40 	add    $0x40000000,%rbx
+  803773:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80377a:	00 00 00 
+  80377d:	48 39 c3             	cmp    %rax,%rbx
+  803780:	74 4c                	je     8037ce <foreach_shared_region+0x13b>
+            uintptr_t pdpe_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, 0, 0, 0);
+  803782:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  803786:	48 09 d8             	or     %rbx,%rax
+  803789:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+            pdpe_t pdpe = uvpdp[VPDP(pdpe_addr)];
+  80378d:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803791:	48 b9 00 00 40 80 00 	movabs $0x10080400000,%rcx
+  803798:	01 00 00 
+  80379b:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+            if (!(pdpe & PTE_P)) {
+  80379f:	a8 01                	test   $0x1,%al
+  8037a1:	74 c9                	je     80376c <foreach_shared_region+0xd9>
+            if (pdpe & PTE_PS) {
+  8037a3:	48 89 c1             	mov    %rax,%rcx
+  8037a6:	81 e1 80 00 00 00    	and    $0x80,%ecx
+  8037ac:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  8037b0:	0f 84 0c ff ff ff    	je     8036c2 <foreach_shared_region+0x2f>
+                if (pdpe & PTE_SHARE) {
+  8037b6:	f6 c4 04             	test   $0x4,%ah
+  8037b9:	74 b1                	je     80376c <foreach_shared_region+0xd9>
+                    fun((void*)pdpe_addr, (void*)(pdpe_addr + 1024 * 1024 * 1024), arg); 
+  8037bb:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  8037bf:	48 8d b7 00 00 00 40 	lea    0x40000000(%rdi),%rsi
+  8037c6:	4c 89 fa             	mov    %r15,%rdx
+  8037c9:	41 ff d4             	call   *%r12
+  8037cc:	eb 9e                	jmp    80376c <foreach_shared_region+0xd9>
+    for (int pml4ei = 0; pml4ei < PML4_ENTRY_COUNT; pml4ei++) {
+  8037ce:	49 83 c6 01          	add    $0x1,%r14
+  8037d2:	49 81 fe 00 02 00 00 	cmp    $0x200,%r14
+  8037d9:	74 24                	je     8037ff <foreach_shared_region+0x16c>
+        pml4e_t pml4e = uvpml4[VPML4(pml4_addr)];
+  8037db:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  8037e2:	01 00 00 
+  8037e5:	4a 8b 04 f0          	mov    (%rax,%r14,8),%rax
+        if (!(pml4e & PTE_P)) {
+  8037e9:	a8 01                	test   $0x1,%al
+  8037eb:	74 e1                	je     8037ce <foreach_shared_region+0x13b>
+  8037ed:	4c 89 f0             	mov    %r14,%rax
+  8037f0:	48 c1 e0 27          	shl    $0x27,%rax
+  8037f4:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8037f8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8037fd:	eb 83                	jmp    803782 <foreach_shared_region+0xef>
+            }
+        }
+    }
+    
+    return 0;
+}
+  8037ff:	b8 00 00 00 00       	mov    $0x0,%eax
+  803804:	48 83 c4 38          	add    $0x38,%rsp
+  803808:	5b                   	pop    %rbx
+  803809:	41 5c                	pop    %r12
+  80380b:	41 5d                	pop    %r13
+  80380d:	41 5e                	pop    %r14
+  80380f:	41 5f                	pop    %r15
+  803811:	5d                   	pop    %rbp
+  803812:	c3                   	ret
+
+0000000000803813 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  803813:	b8 00 00 00 00       	mov    $0x0,%eax
+  803818:	c3                   	ret
+
+0000000000803819 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  803819:	55                   	push   %rbp
+  80381a:	48 89 e5             	mov    %rsp,%rbp
+  80381d:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  803820:	48 be 7c 44 80 00 00 	movabs $0x80447c,%rsi
+  803827:	00 00 00 
+  80382a:	48 b8 1e 18 80 00 00 	movabs $0x80181e,%rax
+  803831:	00 00 00 
+  803834:	ff d0                	call   *%rax
+    return 0;
+}
+  803836:	b8 00 00 00 00       	mov    $0x0,%eax
+  80383b:	5d                   	pop    %rbp
+  80383c:	c3                   	ret
+
+000000000080383d <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  80383d:	55                   	push   %rbp
+  80383e:	48 89 e5             	mov    %rsp,%rbp
+  803841:	41 57                	push   %r15
+  803843:	41 56                	push   %r14
+  803845:	41 55                	push   %r13
+  803847:	41 54                	push   %r12
+  803849:	53                   	push   %rbx
+  80384a:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  803851:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  803858:	48 85 d2             	test   %rdx,%rdx
+  80385b:	74 7a                	je     8038d7 <devcons_write+0x9a>
+  80385d:	49 89 d6             	mov    %rdx,%r14
+  803860:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  803866:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  80386b:	49 bf 18 1a 80 00 00 	movabs $0x801a18,%r15
+  803872:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  803875:	4c 89 f3             	mov    %r14,%rbx
+  803878:	48 29 f3             	sub    %rsi,%rbx
+  80387b:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  803880:	48 39 c3             	cmp    %rax,%rbx
+  803883:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  803887:	4c 63 eb             	movslq %ebx,%r13
+  80388a:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  803891:	48 01 c6             	add    %rax,%rsi
+  803894:	4c 89 ea             	mov    %r13,%rdx
+  803897:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  80389e:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  8038a1:	4c 89 ee             	mov    %r13,%rsi
+  8038a4:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  8038ab:	48 b8 45 1c 80 00 00 	movabs $0x801c45,%rax
+  8038b2:	00 00 00 
+  8038b5:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  8038b7:	41 01 dc             	add    %ebx,%r12d
+  8038ba:	49 63 f4             	movslq %r12d,%rsi
+  8038bd:	4c 39 f6             	cmp    %r14,%rsi
+  8038c0:	72 b3                	jb     803875 <devcons_write+0x38>
+    return res;
+  8038c2:	49 63 c4             	movslq %r12d,%rax
+}
+  8038c5:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  8038cc:	5b                   	pop    %rbx
+  8038cd:	41 5c                	pop    %r12
+  8038cf:	41 5d                	pop    %r13
+  8038d1:	41 5e                	pop    %r14
+  8038d3:	41 5f                	pop    %r15
+  8038d5:	5d                   	pop    %rbp
+  8038d6:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  8038d7:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8038dd:	eb e3                	jmp    8038c2 <devcons_write+0x85>
+
+00000000008038df <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8038df:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  8038e2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8038e7:	48 85 c0             	test   %rax,%rax
+  8038ea:	74 55                	je     803941 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8038ec:	55                   	push   %rbp
+  8038ed:	48 89 e5             	mov    %rsp,%rbp
+  8038f0:	41 55                	push   %r13
+  8038f2:	41 54                	push   %r12
+  8038f4:	53                   	push   %rbx
+  8038f5:	48 83 ec 08          	sub    $0x8,%rsp
+  8038f9:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  8038fc:	48 bb 72 1c 80 00 00 	movabs $0x801c72,%rbx
+  803903:	00 00 00 
+  803906:	49 bc 3f 1d 80 00 00 	movabs $0x801d3f,%r12
+  80390d:	00 00 00 
+  803910:	eb 03                	jmp    803915 <devcons_read+0x36>
+  803912:	41 ff d4             	call   *%r12
+  803915:	ff d3                	call   *%rbx
+  803917:	85 c0                	test   %eax,%eax
+  803919:	74 f7                	je     803912 <devcons_read+0x33>
+    if (c < 0) return c;
+  80391b:	48 63 d0             	movslq %eax,%rdx
+  80391e:	78 13                	js     803933 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  803920:	ba 00 00 00 00       	mov    $0x0,%edx
+  803925:	83 f8 04             	cmp    $0x4,%eax
+  803928:	74 09                	je     803933 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  80392a:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  80392e:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  803933:	48 89 d0             	mov    %rdx,%rax
+  803936:	48 83 c4 08          	add    $0x8,%rsp
+  80393a:	5b                   	pop    %rbx
+  80393b:	41 5c                	pop    %r12
+  80393d:	41 5d                	pop    %r13
+  80393f:	5d                   	pop    %rbp
+  803940:	c3                   	ret
+  803941:	48 89 d0             	mov    %rdx,%rax
+  803944:	c3                   	ret
+
+0000000000803945 <cputchar>:
+cputchar(int ch) {
+  803945:	55                   	push   %rbp
+  803946:	48 89 e5             	mov    %rsp,%rbp
+  803949:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  80394d:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  803951:	be 01 00 00 00       	mov    $0x1,%esi
+  803956:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  80395a:	48 b8 45 1c 80 00 00 	movabs $0x801c45,%rax
+  803961:	00 00 00 
+  803964:	ff d0                	call   *%rax
+}
+  803966:	c9                   	leave
+  803967:	c3                   	ret
+
+0000000000803968 <getchar>:
+getchar(void) {
+  803968:	55                   	push   %rbp
+  803969:	48 89 e5             	mov    %rsp,%rbp
+  80396c:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  803970:	ba 01 00 00 00       	mov    $0x1,%edx
+  803975:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  803979:	bf 00 00 00 00       	mov    $0x0,%edi
+  80397e:	48 b8 8c 28 80 00 00 	movabs $0x80288c,%rax
+  803985:	00 00 00 
+  803988:	ff d0                	call   *%rax
+  80398a:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  80398c:	85 c0                	test   %eax,%eax
+  80398e:	78 06                	js     803996 <getchar+0x2e>
+  803990:	74 08                	je     80399a <getchar+0x32>
+  803992:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  803996:	89 d0                	mov    %edx,%eax
+  803998:	c9                   	leave
+  803999:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  80399a:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  80399f:	eb f5                	jmp    803996 <getchar+0x2e>
+
+00000000008039a1 <iscons>:
+iscons(int fdnum) {
+  8039a1:	55                   	push   %rbp
+  8039a2:	48 89 e5             	mov    %rsp,%rbp
+  8039a5:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8039a9:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8039ad:	48 b8 a9 25 80 00 00 	movabs $0x8025a9,%rax
+  8039b4:	00 00 00 
+  8039b7:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8039b9:	85 c0                	test   %eax,%eax
+  8039bb:	78 18                	js     8039d5 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  8039bd:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8039c1:	48 b8 a0 50 80 00 00 	movabs $0x8050a0,%rax
+  8039c8:	00 00 00 
+  8039cb:	8b 00                	mov    (%rax),%eax
+  8039cd:	39 02                	cmp    %eax,(%rdx)
+  8039cf:	0f 94 c0             	sete   %al
+  8039d2:	0f b6 c0             	movzbl %al,%eax
+}
+  8039d5:	c9                   	leave
+  8039d6:	c3                   	ret
+
+00000000008039d7 <opencons>:
+opencons(void) {
+  8039d7:	55                   	push   %rbp
+  8039d8:	48 89 e5             	mov    %rsp,%rbp
+  8039db:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8039df:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  8039e3:	48 b8 8f 25 80 00 00 	movabs $0x80258f,%rax
+  8039ea:	00 00 00 
+  8039ed:	ff d0                	call   *%rax
+  8039ef:	85 c0                	test   %eax,%eax
+  8039f1:	78 49                	js     803a3c <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  8039f3:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8039f8:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8039fd:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  803a01:	bf 00 00 00 00       	mov    $0x0,%edi
+  803a06:	48 b8 ce 1d 80 00 00 	movabs $0x801dce,%rax
+  803a0d:	00 00 00 
+  803a10:	ff d0                	call   *%rax
+  803a12:	85 c0                	test   %eax,%eax
+  803a14:	78 26                	js     803a3c <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  803a16:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803a1a:	a1 a0 50 80 00 00 00 	movabs 0x8050a0,%eax
+  803a21:	00 00 
+  803a23:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  803a25:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803a29:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  803a30:	48 b8 e8 24 80 00 00 	movabs $0x8024e8,%rax
+  803a37:	00 00 00 
+  803a3a:	ff d0                	call   *%rax
+}
+  803a3c:	c9                   	leave
+  803a3d:	c3                   	ret
+
+0000000000803a3e <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  803a3e:	55                   	push   %rbp
+  803a3f:	48 89 e5             	mov    %rsp,%rbp
+  803a42:	41 55                	push   %r13
+  803a44:	41 54                	push   %r12
+  803a46:	53                   	push   %rbx
+  803a47:	48 83 ec 08          	sub    $0x8,%rsp
+  803a4b:	49 89 fc             	mov    %rdi,%r12
+  803a4e:	48 89 f7             	mov    %rsi,%rdi
+  803a51:	48 89 d3             	mov    %rdx,%rbx
+  803a54:	49 89 cd             	mov    %rcx,%r13
+    // LAB 9: Your code here:
+    int res = sys_ipc_recv(!pg ? (void*)MAX_USER_ADDRESS : pg, !size ? 0 : *size);
+  803a57:	be 00 00 00 00       	mov    $0x0,%esi
+  803a5c:	48 85 d2             	test   %rdx,%rdx
+  803a5f:	74 03                	je     803a64 <ipc_recv+0x26>
+  803a61:	48 8b 32             	mov    (%rdx),%rsi
+  803a64:	48 85 ff             	test   %rdi,%rdi
+  803a67:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803a6e:	00 00 00 
+  803a71:	48 0f 44 f8          	cmove  %rax,%rdi
+  803a75:	48 b8 a0 21 80 00 00 	movabs $0x8021a0,%rax
+  803a7c:	00 00 00 
+  803a7f:	ff d0                	call   *%rax
+    if (res < 0) {
+  803a81:	85 c0                	test   %eax,%eax
+  803a83:	78 66                	js     803aeb <ipc_recv+0xad>
+        if (size) {
+            *size = 0;
+        }
+        return res;
+    }
+    if (from_env_store) {
+  803a85:	4d 85 e4             	test   %r12,%r12
+  803a88:	74 14                	je     803a9e <ipc_recv+0x60>
+        *from_env_store = thisenv->env_ipc_from;
+  803a8a:	48 a1 d0 61 80 00 00 	movabs 0x8061d0,%rax
+  803a91:	00 00 00 
+  803a94:	8b 80 ac 01 00 00    	mov    0x1ac(%rax),%eax
+  803a9a:	41 89 04 24          	mov    %eax,(%r12)
+    }
+    if (perm_store) {
+  803a9e:	4d 85 ed             	test   %r13,%r13
+  803aa1:	74 14                	je     803ab7 <ipc_recv+0x79>
+        *perm_store = thisenv->env_ipc_perm;
+  803aa3:	48 a1 d0 61 80 00 00 	movabs 0x8061d0,%rax
+  803aaa:	00 00 00 
+  803aad:	8b 80 b0 01 00 00    	mov    0x1b0(%rax),%eax
+  803ab3:	41 89 45 00          	mov    %eax,0x0(%r13)
+    }
+    if (size) {
+  803ab7:	48 85 db             	test   %rbx,%rbx
+  803aba:	74 14                	je     803ad0 <ipc_recv+0x92>
+        *size = thisenv->env_ipc_maxsz;
+  803abc:	48 a1 d0 61 80 00 00 	movabs 0x8061d0,%rax
+  803ac3:	00 00 00 
+  803ac6:	48 8b 80 a0 01 00 00 	mov    0x1a0(%rax),%rax
+  803acd:	48 89 03             	mov    %rax,(%rbx)
+    }
+    return thisenv->env_ipc_value;
+  803ad0:	48 a1 d0 61 80 00 00 	movabs 0x8061d0,%rax
+  803ad7:	00 00 00 
+  803ada:	8b 80 a8 01 00 00    	mov    0x1a8(%rax),%eax
+}
+  803ae0:	48 83 c4 08          	add    $0x8,%rsp
+  803ae4:	5b                   	pop    %rbx
+  803ae5:	41 5c                	pop    %r12
+  803ae7:	41 5d                	pop    %r13
+  803ae9:	5d                   	pop    %rbp
+  803aea:	c3                   	ret
+        if (from_env_store) {
+  803aeb:	4d 85 e4             	test   %r12,%r12
+  803aee:	74 08                	je     803af8 <ipc_recv+0xba>
+            *from_env_store = 0;
+  803af0:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  803af7:	00 
+        if (perm_store) {
+  803af8:	4d 85 ed             	test   %r13,%r13
+  803afb:	74 08                	je     803b05 <ipc_recv+0xc7>
+            *perm_store = 0;
+  803afd:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  803b04:	00 
+        if (size) {
+  803b05:	48 85 db             	test   %rbx,%rbx
+  803b08:	74 d6                	je     803ae0 <ipc_recv+0xa2>
+            *size = 0;
+  803b0a:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  803b11:	eb cd                	jmp    803ae0 <ipc_recv+0xa2>
+
+0000000000803b13 <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  803b13:	55                   	push   %rbp
+  803b14:	48 89 e5             	mov    %rsp,%rbp
+  803b17:	41 57                	push   %r15
+  803b19:	41 56                	push   %r14
+  803b1b:	41 55                	push   %r13
+  803b1d:	41 54                	push   %r12
+  803b1f:	53                   	push   %rbx
+  803b20:	48 83 ec 18          	sub    $0x18,%rsp
+  803b24:	41 89 fd             	mov    %edi,%r13d
+  803b27:	89 75 cc             	mov    %esi,-0x34(%rbp)
+  803b2a:	49 89 cc             	mov    %rcx,%r12
+  803b2d:	44 89 45 c8          	mov    %r8d,-0x38(%rbp)
+    // LAB 9: Your code here:
+    int res = 0;
+    while ((res = sys_ipc_try_send(to_env, val, !pg ? (void*)MAX_USER_ADDRESS : pg, size, perm)) < 0) {
+  803b31:	48 85 d2             	test   %rdx,%rdx
+  803b34:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803b3b:	00 00 00 
+  803b3e:	48 0f 45 c2          	cmovne %rdx,%rax
+  803b42:	48 89 c3             	mov    %rax,%rbx
+  803b45:	49 be 74 21 80 00 00 	movabs $0x802174,%r14
+  803b4c:	00 00 00 
+        if (res != -E_IPC_NOT_RECV) {
+            panic("sys_ipc_try_send failed: %i", res);
+        }
+        sys_yield();
+  803b4f:	49 bf 3f 1d 80 00 00 	movabs $0x801d3f,%r15
+  803b56:	00 00 00 
+    while ((res = sys_ipc_try_send(to_env, val, !pg ? (void*)MAX_USER_ADDRESS : pg, size, perm)) < 0) {
+  803b59:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  803b5c:	44 8b 45 c8          	mov    -0x38(%rbp),%r8d
+  803b60:	4c 89 e1             	mov    %r12,%rcx
+  803b63:	48 89 da             	mov    %rbx,%rdx
+  803b66:	44 89 ef             	mov    %r13d,%edi
+  803b69:	41 ff d6             	call   *%r14
+  803b6c:	85 c0                	test   %eax,%eax
+  803b6e:	79 37                	jns    803ba7 <ipc_send+0x94>
+        if (res != -E_IPC_NOT_RECV) {
+  803b70:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  803b73:	75 05                	jne    803b7a <ipc_send+0x67>
+        sys_yield();
+  803b75:	41 ff d7             	call   *%r15
+  803b78:	eb df                	jmp    803b59 <ipc_send+0x46>
+            panic("sys_ipc_try_send failed: %i", res);
+  803b7a:	89 c1                	mov    %eax,%ecx
+  803b7c:	48 ba 88 44 80 00 00 	movabs $0x804488,%rdx
+  803b83:	00 00 00 
+  803b86:	be 40 00 00 00       	mov    $0x40,%esi
+  803b8b:	48 bf a4 44 80 00 00 	movabs $0x8044a4,%rdi
+  803b92:	00 00 00 
+  803b95:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b9a:	49 b8 a9 0d 80 00 00 	movabs $0x800da9,%r8
+  803ba1:	00 00 00 
+  803ba4:	41 ff d0             	call   *%r8
+    }
+    return;
+}
+  803ba7:	48 83 c4 18          	add    $0x18,%rsp
+  803bab:	5b                   	pop    %rbx
+  803bac:	41 5c                	pop    %r12
+  803bae:	41 5d                	pop    %r13
+  803bb0:	41 5e                	pop    %r14
+  803bb2:	41 5f                	pop    %r15
+  803bb4:	5d                   	pop    %rbp
+  803bb5:	c3                   	ret
+
+0000000000803bb6 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  803bb6:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  803bbb:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  803bc2:	00 00 00 
+  803bc5:	48 69 d0 d0 01 00 00 	imul   $0x1d0,%rax,%rdx
+  803bcc:	48 01 ca             	add    %rcx,%rdx
+  803bcf:	8b 92 e8 00 00 00    	mov    0xe8(%rdx),%edx
+  803bd5:	39 fa                	cmp    %edi,%edx
+  803bd7:	74 12                	je     803beb <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  803bd9:	48 83 c0 01          	add    $0x1,%rax
+  803bdd:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  803be3:	75 e0                	jne    803bc5 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  803be5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803bea:	c3                   	ret
+            return envs[i].env_id;
+  803beb:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+  803bf2:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  803bf9:	00 00 00 
+  803bfc:	48 01 d0             	add    %rdx,%rax
+  803bff:	8b 80 e0 00 00 00    	mov    0xe0(%rax),%eax
+  803c05:	c3                   	ret
+  803c06:	66 90                	xchg   %ax,%ax
+
+0000000000803c08 <__rodata_start>:
+  803c08:	25 2d 36 73 20       	and    $0x2073362d,%eax
+  803c0d:	25 2d 38 73 20       	and    $0x2073382d,%eax
+  803c12:	25 2d 38 73 0a       	and    $0xa73382d,%eax
+  803c17:	00 72 31             	add    %dh,0x31(%rdx)
+  803c1a:	34 00                	xor    $0x0,%al
+  803c1c:	25 2d 36 73 20       	and    $0x2073362d,%eax
+  803c21:	25 30 38 6c 78       	and    $0x786c3830,%eax
+  803c26:	20 25 30 38 6c 78    	and    %ah,0x786c3830(%rip)        # 78ec745c <__bss_end+0x786be45c>
+  803c2c:	20 00                	and    %al,(%rax)
+  803c2e:	4f                   	rex.WRXB
+  803c2f:	4b 0a 00             	rex.WXB or (%r8),%al
+  803c32:	4d                   	rex.WRB
+  803c33:	49 53                	rex.WB push %r11
+  803c35:	4d                   	rex.WRB
+  803c36:	41 54                	push   %r12
+  803c38:	43                   	rex.XB
+  803c39:	48 0a 00             	rex.W or (%rax),%al
+  803c3c:	72 31                	jb     803c6f <__rodata_start+0x67>
+  803c3e:	33 00                	xor    (%rax),%eax
+  803c40:	72 31                	jb     803c73 <__rodata_start+0x6b>
+  803c42:	32 00                	xor    (%rax),%al
+  803c44:	72 31                	jb     803c77 <__rodata_start+0x6f>
+  803c46:	31 00                	xor    %eax,(%rax)
+  803c48:	72 31                	jb     803c7b <__rodata_start+0x73>
+  803c4a:	30 00                	xor    %al,(%rax)
+  803c4c:	72 73                	jb     803cc1 <__rodata_start+0xb9>
+  803c4e:	69 00 72 64 69 00    	imul   $0x696472,(%rax),%eax
+  803c54:	72 62                	jb     803cb8 <__rodata_start+0xb0>
+  803c56:	70 00                	jo     803c58 <__rodata_start+0x50>
+  803c58:	72 62                	jb     803cbc <__rodata_start+0xb4>
+  803c5a:	78 00                	js     803c5c <__rodata_start+0x54>
+  803c5c:	72 64                	jb     803cc2 <__rodata_start+0xba>
+  803c5e:	78 00                	js     803c60 <__rodata_start+0x58>
+  803c60:	72 63                	jb     803cc5 <__rodata_start+0xbd>
+  803c62:	78 00                	js     803c64 <__rodata_start+0x5c>
+  803c64:	72 61                	jb     803cc7 <__rodata_start+0xbf>
+  803c66:	78 00                	js     803c68 <__rodata_start+0x60>
+  803c68:	72 69                	jb     803cd3 <__rodata_start+0xcb>
+  803c6a:	70 00                	jo     803c6c <__rodata_start+0x64>
+  803c6c:	72 66                	jb     803cd4 <__rodata_start+0xcc>
+  803c6e:	6c                   	insb   (%dx),%es:(%rdi)
+  803c6f:	61                   	(bad)
+  803c70:	67 73 00             	addr32 jae 803c73 <__rodata_start+0x6b>
+  803c73:	72 73                	jb     803ce8 <__rodata_start+0xe0>
+  803c75:	70 00                	jo     803c77 <__rodata_start+0x6f>
+  803c77:	52                   	push   %rdx
+  803c78:	65 67 69 73 74 65 72 	imul   $0x20737265,%gs:0x74(%ebx),%esi
+  803c7f:	73 20 
+  803c81:	25 73 20 00 75       	and    $0x75002073,%eax
+  803c86:	73 65                	jae    803ced <__rodata_start+0xe5>
+  803c88:	72 2f                	jb     803cb9 <__rodata_start+0xb1>
+  803c8a:	66 61                	data16 (bad)
+  803c8c:	75 6c                	jne    803cfa <__rodata_start+0xf2>
+  803c8e:	74 72                	je     803d02 <__rodata_start+0xfa>
+  803c90:	65 67 73 2e          	gs addr32 jae 803cc2 <__rodata_start+0xba>
+  803c94:	63 00                	movsxd (%rax),%eax
+  803c96:	69 6e 20 55 54 72 61 	imul   $0x61725455,0x20(%rsi),%ebp
+  803c9d:	70 66                	jo     803d05 <__rodata_start+0xfd>
+  803c9f:	72 61                	jb     803d02 <__rodata_start+0xfa>
+  803ca1:	6d                   	insl   (%dx),%es:(%rdi)
+  803ca2:	65 00 64 75 72       	add    %ah,%gs:0x72(%rbp,%rsi,2)
+  803ca7:	69 6e 67 00 62 65 66 	imul   $0x66656200,0x67(%rsi),%ebp
+  803cae:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803caf:	72 65                	jb     803d16 <__rodata_start+0x10e>
+  803cb1:	00 73 79             	add    %dh,0x79(%rbx)
+  803cb4:	73 5f                	jae    803d15 <__rodata_start+0x10d>
+  803cb6:	70 61                	jo     803d19 <__rodata_start+0x111>
+  803cb8:	67 65 5f             	addr32 gs pop %rdi
+  803cbb:	61                   	(bad)
+  803cbc:	6c                   	insb   (%dx),%es:(%rdi)
+  803cbd:	6c                   	insb   (%dx),%es:(%rdi)
+  803cbe:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803cbf:	63 3a                	movsxd (%rdx),%edi
+  803cc1:	20 25 69 00 61 66    	and    %ah,0x66610069(%rip)        # 66e13d30 <__bss_end+0x6660ad30>
+  803cc7:	74 65                	je     803d2e <__rodata_start+0x126>
+  803cc9:	72 20                	jb     803ceb <__rodata_start+0xe3>
+  803ccb:	70 61                	jo     803d2e <__rodata_start+0x126>
+  803ccd:	67 65 2d 66 61 75 6c 	addr32 gs sub $0x6c756166,%eax
+  803cd4:	74 00                	je     803cd6 <__rodata_start+0xce>
+  803cd6:	61                   	(bad)
+  803cd7:	66 74 65             	data16 je 803d3f <__rodata_start+0x137>
+  803cda:	72 00                	jb     803cdc <__rodata_start+0xd4>
+  803cdc:	0f 1f 40 00          	nopl   0x0(%rax)
+  803ce0:	70 67                	jo     803d49 <__rodata_start+0x141>
+  803ce2:	66 61                	data16 (bad)
+  803ce4:	75 6c                	jne    803d52 <__rodata_start+0x14a>
+  803ce6:	74 20                	je     803d08 <__rodata_start+0x100>
+  803ce8:	65 78 70             	gs js  803d5b <__rodata_start+0x153>
+  803ceb:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  803cf0:	20 61 74             	and    %ah,0x74(%rcx)
+  803cf3:	20 55 54             	and    %dl,0x54(%rbp)
+  803cf6:	45                   	rex.RB
+  803cf7:	4d 50                	rex.WRB push %r8
+  803cf9:	2c 20                	sub    $0x20,%al
+  803cfb:	67 6f                	outsl  %ds:(%esi),(%dx)
+  803cfd:	74 20                	je     803d1f <__rodata_start+0x117>
+  803cff:	30 78 25             	xor    %bh,0x25(%rax)
+  803d02:	30 38                	xor    %bh,(%rax)
+  803d04:	6c                   	insb   (%dx),%es:(%rdi)
+  803d05:	78 20                	js     803d27 <__rodata_start+0x11f>
+  803d07:	28 72 69             	sub    %dh,0x69(%rdx)
+  803d0a:	70 20                	jo     803d2c <__rodata_start+0x124>
+  803d0c:	25 30 38 6c 78       	and    $0x786c3830,%eax
+  803d11:	29 00                	sub    %eax,(%rax)
+  803d13:	00 00                	add    %al,(%rax)
+  803d15:	00 00                	add    %al,(%rax)
+  803d17:	00 52 49             	add    %dl,0x49(%rdx)
+  803d1a:	50                   	push   %rax
+  803d1b:	20 61 66             	and    %ah,0x66(%rcx)
+  803d1e:	74 65                	je     803d85 <__rodata_start+0x17d>
+  803d20:	72 20                	jb     803d42 <__rodata_start+0x13a>
+  803d22:	70 61                	jo     803d85 <__rodata_start+0x17d>
+  803d24:	67 65 2d 66 61 75 6c 	addr32 gs sub $0x6c756166,%eax
+  803d2b:	74 20                	je     803d4d <__rodata_start+0x145>
+  803d2d:	4d                   	rex.WRB
+  803d2e:	49 53                	rex.WB push %r11
+  803d30:	4d                   	rex.WRB
+  803d31:	41 54                	push   %r12
+  803d33:	43                   	rex.XB
+  803d34:	48 0a 00             	rex.W or (%rax),%al
+  803d37:	3c 75                	cmp    $0x75,%al
+  803d39:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803d3a:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  803d3e:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803d3f:	3e 00 0f             	ds add %cl,(%rdi)
+  803d42:	1f                   	(bad)
+  803d43:	80 00 00             	addb   $0x0,(%rax)
+  803d46:	00 00                	add    %al,(%rax)
+  803d48:	5b                   	pop    %rbx
+  803d49:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  803d4e:	20 75 73             	and    %dh,0x73(%rbp)
+  803d51:	65 72 20             	gs jb  803d74 <__rodata_start+0x16c>
+  803d54:	70 61                	jo     803db7 <__rodata_start+0x1af>
+  803d56:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803d57:	69 63 20 69 6e 20 25 	imul   $0x25206e69,0x20(%rbx),%esp
+  803d5e:	73 20                	jae    803d80 <__rodata_start+0x178>
+  803d60:	61                   	(bad)
+  803d61:	74 20                	je     803d83 <__rodata_start+0x17b>
+  803d63:	25 73 3a 25 64       	and    $0x64253a73,%eax
+  803d68:	3a 20                	cmp    (%rax),%ah
+  803d6a:	00 30                	add    %dh,(%rax)
+  803d6c:	31 32                	xor    %esi,(%rdx)
+  803d6e:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  803d75:	41                   	rex.B
+  803d76:	42                   	rex.X
+  803d77:	43                   	rex.XB
+  803d78:	44                   	rex.R
+  803d79:	45                   	rex.RB
+  803d7a:	46 00 30             	rex.RX add %r14b,(%rax)
+  803d7d:	31 32                	xor    %esi,(%rdx)
+  803d7f:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  803d86:	61                   	(bad)
+  803d87:	62 63 64 65 66       	(bad)
+  803d8c:	00 28                	add    %ch,(%rax)
+  803d8e:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803d8f:	75 6c                	jne    803dfd <__rodata_start+0x1f5>
+  803d91:	6c                   	insb   (%dx),%es:(%rdi)
+  803d92:	29 00                	sub    %eax,(%rax)
+  803d94:	65 72 72             	gs jb  803e09 <__rodata_start+0x201>
+  803d97:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803d98:	72 20                	jb     803dba <__rodata_start+0x1b2>
+  803d9a:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  803d9f:	73 70                	jae    803e11 <__rodata_start+0x209>
+  803da1:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  803da5:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  803dac:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803dad:	72 00                	jb     803daf <__rodata_start+0x1a7>
+  803daf:	62 61 64 20 65       	(bad)
+  803db4:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803db5:	76 69                	jbe    803e20 <__rodata_start+0x218>
+  803db7:	72 6f                	jb     803e28 <__rodata_start+0x220>
+  803db9:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803dba:	6d                   	insl   (%dx),%es:(%rdi)
+  803dbb:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803dbd:	74 00                	je     803dbf <__rodata_start+0x1b7>
+  803dbf:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  803dc6:	20 70 61             	and    %dh,0x61(%rax)
+  803dc9:	72 61                	jb     803e2c <__rodata_start+0x224>
+  803dcb:	6d                   	insl   (%dx),%es:(%rdi)
+  803dcc:	65 74 65             	gs je  803e34 <__rodata_start+0x22c>
+  803dcf:	72 00                	jb     803dd1 <__rodata_start+0x1c9>
+  803dd1:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803dd2:	75 74                	jne    803e48 <__rodata_start+0x240>
+  803dd4:	20 6f 66             	and    %ch,0x66(%rdi)
+  803dd7:	20 6d 65             	and    %ch,0x65(%rbp)
+  803dda:	6d                   	insl   (%dx),%es:(%rdi)
+  803ddb:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803ddc:	72 79                	jb     803e57 <__rodata_start+0x24f>
+  803dde:	00 6f 75             	add    %ch,0x75(%rdi)
+  803de1:	74 20                	je     803e03 <__rodata_start+0x1fb>
+  803de3:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803de4:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  803de8:	76 69                	jbe    803e53 <__rodata_start+0x24b>
+  803dea:	72 6f                	jb     803e5b <__rodata_start+0x253>
+  803dec:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803ded:	6d                   	insl   (%dx),%es:(%rdi)
+  803dee:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803df0:	74 73                	je     803e65 <__rodata_start+0x25d>
+  803df2:	00 63 6f             	add    %ah,0x6f(%rbx)
+  803df5:	72 72                	jb     803e69 <__rodata_start+0x261>
+  803df7:	75 70                	jne    803e69 <__rodata_start+0x261>
+  803df9:	74 65                	je     803e60 <__rodata_start+0x258>
+  803dfb:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  803e00:	75 67                	jne    803e69 <__rodata_start+0x261>
+  803e02:	20 69 6e             	and    %ch,0x6e(%rcx)
+  803e05:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  803e07:	00 73 65             	add    %dh,0x65(%rbx)
+  803e0a:	67 6d                	insl   (%dx),%es:(%edi)
+  803e0c:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803e0e:	74 61                	je     803e71 <__rodata_start+0x269>
+  803e10:	74 69                	je     803e7b <__rodata_start+0x273>
+  803e12:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803e13:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803e14:	20 66 61             	and    %ah,0x61(%rsi)
+  803e17:	75 6c                	jne    803e85 <__rodata_start+0x27d>
+  803e19:	74 00                	je     803e1b <__rodata_start+0x213>
+  803e1b:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  803e22:	20 45 4c             	and    %al,0x4c(%rbp)
+  803e25:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  803e29:	61                   	(bad)
+  803e2a:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  803e2f:	20 73 75             	and    %dh,0x75(%rbx)
+  803e32:	63 68 20             	movsxd 0x20(%rax),%ebp
+  803e35:	73 79                	jae    803eb0 <__rodata_start+0x2a8>
+  803e37:	73 74                	jae    803ead <__rodata_start+0x2a5>
+  803e39:	65 6d                	gs insl (%dx),%es:(%rdi)
+  803e3b:	20 63 61             	and    %ah,0x61(%rbx)
+  803e3e:	6c                   	insb   (%dx),%es:(%rdi)
+  803e3f:	6c                   	insb   (%dx),%es:(%rdi)
+  803e40:	00 65 6e             	add    %ah,0x6e(%rbp)
+  803e43:	74 72                	je     803eb7 <__rodata_start+0x2af>
+  803e45:	79 20                	jns    803e67 <__rodata_start+0x25f>
+  803e47:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803e48:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803e49:	74 20                	je     803e6b <__rodata_start+0x263>
+  803e4b:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  803e4d:	75 6e                	jne    803ebd <__rodata_start+0x2b5>
+  803e4f:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  803e53:	76 20                	jbe    803e75 <__rodata_start+0x26d>
+  803e55:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  803e5c:	72 65                	jb     803ec3 <__rodata_start+0x2bb>
+  803e5e:	63 76 69             	movsxd 0x69(%rsi),%esi
+  803e61:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803e62:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  803e66:	65 78 70             	gs js  803ed9 <__rodata_start+0x2d1>
+  803e69:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  803e6e:	20 65 6e             	and    %ah,0x6e(%rbp)
+  803e71:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  803e75:	20 66 69             	and    %ah,0x69(%rsi)
+  803e78:	6c                   	insb   (%dx),%es:(%rdi)
+  803e79:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  803e7d:	20 66 72             	and    %ah,0x72(%rsi)
+  803e80:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  803e85:	61                   	(bad)
+  803e86:	63 65 20             	movsxd 0x20(%rbp),%esp
+  803e89:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803e8a:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803e8b:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  803e8f:	6b 00 74             	imul   $0x74,(%rax),%eax
+  803e92:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803e93:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803e94:	20 6d 61             	and    %ch,0x61(%rbp)
+  803e97:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803e98:	79 20                	jns    803eba <__rodata_start+0x2b2>
+  803e9a:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  803ea1:	72 65                	jb     803f08 <__rodata_start+0x300>
+  803ea3:	20 6f 70             	and    %ch,0x70(%rdi)
+  803ea6:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803ea8:	00 66 69             	add    %ah,0x69(%rsi)
+  803eab:	6c                   	insb   (%dx),%es:(%rdi)
+  803eac:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  803eb0:	20 62 6c             	and    %ah,0x6c(%rdx)
+  803eb3:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803eb4:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  803eb7:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803eb8:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803eb9:	74 20                	je     803edb <__rodata_start+0x2d3>
+  803ebb:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  803ebd:	75 6e                	jne    803f2d <__rodata_start+0x325>
+  803ebf:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  803ec3:	76 61                	jbe    803f26 <__rodata_start+0x31e>
+  803ec5:	6c                   	insb   (%dx),%es:(%rdi)
+  803ec6:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  803ecd:	00 
+  803ece:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  803ed5:	72 65                	jb     803f3c <__rodata_start+0x334>
+  803ed7:	61                   	(bad)
+  803ed8:	64 79 20             	fs jns 803efb <__rodata_start+0x2f3>
+  803edb:	65 78 69             	gs js  803f47 <__rodata_start+0x33f>
+  803ede:	73 74                	jae    803f54 <__rodata_start+0x34c>
+  803ee0:	73 00                	jae    803ee2 <__rodata_start+0x2da>
+  803ee2:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803ee3:	70 65                	jo     803f4a <__rodata_start+0x342>
+  803ee5:	72 61                	jb     803f48 <__rodata_start+0x340>
+  803ee7:	74 69                	je     803f52 <__rodata_start+0x34a>
+  803ee9:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803eea:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803eeb:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  803eee:	74 20                	je     803f10 <__rodata_start+0x308>
+  803ef0:	73 75                	jae    803f67 <__rodata_start+0x35f>
+  803ef2:	70 70                	jo     803f64 <__rodata_start+0x35c>
+  803ef4:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803ef5:	72 74                	jb     803f6b <__rodata_start+0x363>
+  803ef7:	65 64 00 6f 70       	gs add %ch,%fs:0x70(%rdi)
+  803efc:	65 72 61             	gs jb  803f60 <__rodata_start+0x358>
+  803eff:	74 69                	je     803f6a <__rodata_start+0x362>
+  803f01:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803f02:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803f03:	20 69 6e             	and    %ch,0x6e(%rcx)
+  803f06:	74 65                	je     803f6d <__rodata_start+0x365>
+  803f08:	72 72                	jb     803f7c <__rodata_start+0x374>
+  803f0a:	75 70                	jne    803f7c <__rodata_start+0x374>
+  803f0c:	74 65                	je     803f73 <__rodata_start+0x36b>
+  803f0e:	64 00 6e 6f          	add    %ch,%fs:0x6f(%rsi)
+  803f12:	74 20                	je     803f34 <__rodata_start+0x32c>
+  803f14:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803f16:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803f17:	75 67                	jne    803f80 <__rodata_start+0x378>
+  803f19:	68 20 43 50 55       	push   $0x55504320
+  803f1e:	20 74 69 6d          	and    %dh,0x6d(%rcx,%rbp,2)
+  803f22:	65 00 66 2e          	add    %ah,%gs:0x2e(%rsi)
+  803f26:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+  803f2d:	00 
+  803f2e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  803f35:	00 00 00 
+  803f38:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+  803f3f:	00 
+  803f40:	e6 10                	out    %al,$0x10
+  803f42:	80 00 00             	addb   $0x0,(%rax)
+  803f45:	00 00                	add    %al,(%rax)
+  803f47:	00 27                	add    %ah,(%rdi)
+  803f49:	17                   	(bad)
+  803f4a:	80 00 00             	addb   $0x0,(%rax)
+  803f4d:	00 00                	add    %al,(%rax)
+  803f4f:	00 17                	add    %dl,(%rdi)
+  803f51:	17                   	(bad)
+  803f52:	80 00 00             	addb   $0x0,(%rax)
+  803f55:	00 00                	add    %al,(%rax)
+  803f57:	00 27                	add    %ah,(%rdi)
+  803f59:	17                   	(bad)
+  803f5a:	80 00 00             	addb   $0x0,(%rax)
+  803f5d:	00 00                	add    %al,(%rax)
+  803f5f:	00 27                	add    %ah,(%rdi)
+  803f61:	17                   	(bad)
+  803f62:	80 00 00             	addb   $0x0,(%rax)
+  803f65:	00 00                	add    %al,(%rax)
+  803f67:	00 27                	add    %ah,(%rdi)
+  803f69:	17                   	(bad)
+  803f6a:	80 00 00             	addb   $0x0,(%rax)
+  803f6d:	00 00                	add    %al,(%rax)
+  803f6f:	00 27                	add    %ah,(%rdi)
+  803f71:	17                   	(bad)
+  803f72:	80 00 00             	addb   $0x0,(%rax)
+  803f75:	00 00                	add    %al,(%rax)
+  803f77:	00 05 11 80 00 00    	add    %al,0x8011(%rip)        # 80bf8e <__bss_end+0x2f8e>
+  803f7d:	00 00                	add    %al,(%rax)
+  803f7f:	00 27                	add    %ah,(%rdi)
+  803f81:	17                   	(bad)
+  803f82:	80 00 00             	addb   $0x0,(%rax)
+  803f85:	00 00                	add    %al,(%rax)
+  803f87:	00 27                	add    %ah,(%rdi)
+  803f89:	17                   	(bad)
+  803f8a:	80 00 00             	addb   $0x0,(%rax)
+  803f8d:	00 00                	add    %al,(%rax)
+  803f8f:	00 f9                	add    %bh,%cl
+  803f91:	10 80 00 00 00 00    	adc    %al,0x0(%rax)
+  803f97:	00 73 11             	add    %dh,0x11(%rbx)
+  803f9a:	80 00 00             	addb   $0x0,(%rax)
+  803f9d:	00 00                	add    %al,(%rax)
+  803f9f:	00 27                	add    %ah,(%rdi)
+  803fa1:	17                   	(bad)
+  803fa2:	80 00 00             	addb   $0x0,(%rax)
+  803fa5:	00 00                	add    %al,(%rax)
+  803fa7:	00 f9                	add    %bh,%cl
+  803fa9:	10 80 00 00 00 00    	adc    %al,0x0(%rax)
+  803faf:	00 3f                	add    %bh,(%rdi)
+  803fb1:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  803fb7:	00 3f                	add    %bh,(%rdi)
+  803fb9:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  803fbf:	00 3f                	add    %bh,(%rdi)
+  803fc1:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  803fc7:	00 3f                	add    %bh,(%rdi)
+  803fc9:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  803fcf:	00 3f                	add    %bh,(%rdi)
+  803fd1:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  803fd7:	00 3f                	add    %bh,(%rdi)
+  803fd9:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  803fdf:	00 3f                	add    %bh,(%rdi)
+  803fe1:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  803fe7:	00 3f                	add    %bh,(%rdi)
+  803fe9:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  803fef:	00 3f                	add    %bh,(%rdi)
+  803ff1:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  803ff7:	00 27                	add    %ah,(%rdi)
+  803ff9:	17                   	(bad)
+  803ffa:	80 00 00             	addb   $0x0,(%rax)
+  803ffd:	00 00                	add    %al,(%rax)
+  803fff:	00 27                	add    %ah,(%rdi)
+  804001:	17                   	(bad)
+  804002:	80 00 00             	addb   $0x0,(%rax)
+  804005:	00 00                	add    %al,(%rax)
+  804007:	00 27                	add    %ah,(%rdi)
+  804009:	17                   	(bad)
+  80400a:	80 00 00             	addb   $0x0,(%rax)
+  80400d:	00 00                	add    %al,(%rax)
+  80400f:	00 27                	add    %ah,(%rdi)
+  804011:	17                   	(bad)
+  804012:	80 00 00             	addb   $0x0,(%rax)
+  804015:	00 00                	add    %al,(%rax)
+  804017:	00 27                	add    %ah,(%rdi)
+  804019:	17                   	(bad)
+  80401a:	80 00 00             	addb   $0x0,(%rax)
+  80401d:	00 00                	add    %al,(%rax)
+  80401f:	00 27                	add    %ah,(%rdi)
+  804021:	17                   	(bad)
+  804022:	80 00 00             	addb   $0x0,(%rax)
+  804025:	00 00                	add    %al,(%rax)
+  804027:	00 27                	add    %ah,(%rdi)
+  804029:	17                   	(bad)
+  80402a:	80 00 00             	addb   $0x0,(%rax)
+  80402d:	00 00                	add    %al,(%rax)
+  80402f:	00 27                	add    %ah,(%rdi)
+  804031:	17                   	(bad)
+  804032:	80 00 00             	addb   $0x0,(%rax)
+  804035:	00 00                	add    %al,(%rax)
+  804037:	00 27                	add    %ah,(%rdi)
+  804039:	17                   	(bad)
+  80403a:	80 00 00             	addb   $0x0,(%rax)
+  80403d:	00 00                	add    %al,(%rax)
+  80403f:	00 27                	add    %ah,(%rdi)
+  804041:	17                   	(bad)
+  804042:	80 00 00             	addb   $0x0,(%rax)
+  804045:	00 00                	add    %al,(%rax)
+  804047:	00 27                	add    %ah,(%rdi)
+  804049:	17                   	(bad)
+  80404a:	80 00 00             	addb   $0x0,(%rax)
+  80404d:	00 00                	add    %al,(%rax)
+  80404f:	00 27                	add    %ah,(%rdi)
+  804051:	17                   	(bad)
+  804052:	80 00 00             	addb   $0x0,(%rax)
+  804055:	00 00                	add    %al,(%rax)
+  804057:	00 27                	add    %ah,(%rdi)
+  804059:	17                   	(bad)
+  80405a:	80 00 00             	addb   $0x0,(%rax)
+  80405d:	00 00                	add    %al,(%rax)
+  80405f:	00 27                	add    %ah,(%rdi)
+  804061:	17                   	(bad)
+  804062:	80 00 00             	addb   $0x0,(%rax)
+  804065:	00 00                	add    %al,(%rax)
+  804067:	00 27                	add    %ah,(%rdi)
+  804069:	17                   	(bad)
+  80406a:	80 00 00             	addb   $0x0,(%rax)
+  80406d:	00 00                	add    %al,(%rax)
+  80406f:	00 27                	add    %ah,(%rdi)
+  804071:	17                   	(bad)
+  804072:	80 00 00             	addb   $0x0,(%rax)
+  804075:	00 00                	add    %al,(%rax)
+  804077:	00 27                	add    %ah,(%rdi)
+  804079:	17                   	(bad)
+  80407a:	80 00 00             	addb   $0x0,(%rax)
+  80407d:	00 00                	add    %al,(%rax)
+  80407f:	00 27                	add    %ah,(%rdi)
+  804081:	17                   	(bad)
+  804082:	80 00 00             	addb   $0x0,(%rax)
+  804085:	00 00                	add    %al,(%rax)
+  804087:	00 27                	add    %ah,(%rdi)
+  804089:	17                   	(bad)
+  80408a:	80 00 00             	addb   $0x0,(%rax)
+  80408d:	00 00                	add    %al,(%rax)
+  80408f:	00 27                	add    %ah,(%rdi)
+  804091:	17                   	(bad)
+  804092:	80 00 00             	addb   $0x0,(%rax)
+  804095:	00 00                	add    %al,(%rax)
+  804097:	00 27                	add    %ah,(%rdi)
+  804099:	17                   	(bad)
+  80409a:	80 00 00             	addb   $0x0,(%rax)
+  80409d:	00 00                	add    %al,(%rax)
+  80409f:	00 27                	add    %ah,(%rdi)
+  8040a1:	17                   	(bad)
+  8040a2:	80 00 00             	addb   $0x0,(%rax)
+  8040a5:	00 00                	add    %al,(%rax)
+  8040a7:	00 27                	add    %ah,(%rdi)
+  8040a9:	17                   	(bad)
+  8040aa:	80 00 00             	addb   $0x0,(%rax)
+  8040ad:	00 00                	add    %al,(%rax)
+  8040af:	00 27                	add    %ah,(%rdi)
+  8040b1:	17                   	(bad)
+  8040b2:	80 00 00             	addb   $0x0,(%rax)
+  8040b5:	00 00                	add    %al,(%rax)
+  8040b7:	00 27                	add    %ah,(%rdi)
+  8040b9:	17                   	(bad)
+  8040ba:	80 00 00             	addb   $0x0,(%rax)
+  8040bd:	00 00                	add    %al,(%rax)
+  8040bf:	00 27                	add    %ah,(%rdi)
+  8040c1:	17                   	(bad)
+  8040c2:	80 00 00             	addb   $0x0,(%rax)
+  8040c5:	00 00                	add    %al,(%rax)
+  8040c7:	00 27                	add    %ah,(%rdi)
+  8040c9:	17                   	(bad)
+  8040ca:	80 00 00             	addb   $0x0,(%rax)
+  8040cd:	00 00                	add    %al,(%rax)
+  8040cf:	00 27                	add    %ah,(%rdi)
+  8040d1:	17                   	(bad)
+  8040d2:	80 00 00             	addb   $0x0,(%rax)
+  8040d5:	00 00                	add    %al,(%rax)
+  8040d7:	00 27                	add    %ah,(%rdi)
+  8040d9:	17                   	(bad)
+  8040da:	80 00 00             	addb   $0x0,(%rax)
+  8040dd:	00 00                	add    %al,(%rax)
+  8040df:	00 27                	add    %ah,(%rdi)
+  8040e1:	17                   	(bad)
+  8040e2:	80 00 00             	addb   $0x0,(%rax)
+  8040e5:	00 00                	add    %al,(%rax)
+  8040e7:	00 4a 16             	add    %cl,0x16(%rdx)
+  8040ea:	80 00 00             	addb   $0x0,(%rax)
+  8040ed:	00 00                	add    %al,(%rax)
+  8040ef:	00 27                	add    %ah,(%rdi)
+  8040f1:	17                   	(bad)
+  8040f2:	80 00 00             	addb   $0x0,(%rax)
+  8040f5:	00 00                	add    %al,(%rax)
+  8040f7:	00 27                	add    %ah,(%rdi)
+  8040f9:	17                   	(bad)
+  8040fa:	80 00 00             	addb   $0x0,(%rax)
+  8040fd:	00 00                	add    %al,(%rax)
+  8040ff:	00 27                	add    %ah,(%rdi)
+  804101:	17                   	(bad)
+  804102:	80 00 00             	addb   $0x0,(%rax)
+  804105:	00 00                	add    %al,(%rax)
+  804107:	00 27                	add    %ah,(%rdi)
+  804109:	17                   	(bad)
+  80410a:	80 00 00             	addb   $0x0,(%rax)
+  80410d:	00 00                	add    %al,(%rax)
+  80410f:	00 27                	add    %ah,(%rdi)
+  804111:	17                   	(bad)
+  804112:	80 00 00             	addb   $0x0,(%rax)
+  804115:	00 00                	add    %al,(%rax)
+  804117:	00 27                	add    %ah,(%rdi)
+  804119:	17                   	(bad)
+  80411a:	80 00 00             	addb   $0x0,(%rax)
+  80411d:	00 00                	add    %al,(%rax)
+  80411f:	00 27                	add    %ah,(%rdi)
+  804121:	17                   	(bad)
+  804122:	80 00 00             	addb   $0x0,(%rax)
+  804125:	00 00                	add    %al,(%rax)
+  804127:	00 27                	add    %ah,(%rdi)
+  804129:	17                   	(bad)
+  80412a:	80 00 00             	addb   $0x0,(%rax)
+  80412d:	00 00                	add    %al,(%rax)
+  80412f:	00 27                	add    %ah,(%rdi)
+  804131:	17                   	(bad)
+  804132:	80 00 00             	addb   $0x0,(%rax)
+  804135:	00 00                	add    %al,(%rax)
+  804137:	00 27                	add    %ah,(%rdi)
+  804139:	17                   	(bad)
+  80413a:	80 00 00             	addb   $0x0,(%rax)
+  80413d:	00 00                	add    %al,(%rax)
+  80413f:	00 96 11 80 00 00    	add    %dl,0x8011(%rsi)
+  804145:	00 00                	add    %al,(%rax)
+  804147:	00 65 13             	add    %ah,0x13(%rbp)
+  80414a:	80 00 00             	addb   $0x0,(%rax)
+  80414d:	00 00                	add    %al,(%rax)
+  80414f:	00 27                	add    %ah,(%rdi)
+  804151:	17                   	(bad)
+  804152:	80 00 00             	addb   $0x0,(%rax)
+  804155:	00 00                	add    %al,(%rax)
+  804157:	00 27                	add    %ah,(%rdi)
+  804159:	17                   	(bad)
+  80415a:	80 00 00             	addb   $0x0,(%rax)
+  80415d:	00 00                	add    %al,(%rax)
+  80415f:	00 27                	add    %ah,(%rdi)
+  804161:	17                   	(bad)
+  804162:	80 00 00             	addb   $0x0,(%rax)
+  804165:	00 00                	add    %al,(%rax)
+  804167:	00 27                	add    %ah,(%rdi)
+  804169:	17                   	(bad)
+  80416a:	80 00 00             	addb   $0x0,(%rax)
+  80416d:	00 00                	add    %al,(%rax)
+  80416f:	00 c5                	add    %al,%ch
+  804171:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  804177:	00 27                	add    %ah,(%rdi)
+  804179:	17                   	(bad)
+  80417a:	80 00 00             	addb   $0x0,(%rax)
+  80417d:	00 00                	add    %al,(%rax)
+  80417f:	00 27                	add    %ah,(%rdi)
+  804181:	17                   	(bad)
+  804182:	80 00 00             	addb   $0x0,(%rax)
+  804185:	00 00                	add    %al,(%rax)
+  804187:	00 8b 11 80 00 00    	add    %cl,0x8011(%rbx)
+  80418d:	00 00                	add    %al,(%rax)
+  80418f:	00 27                	add    %ah,(%rdi)
+  804191:	17                   	(bad)
+  804192:	80 00 00             	addb   $0x0,(%rax)
+  804195:	00 00                	add    %al,(%rax)
+  804197:	00 27                	add    %ah,(%rdi)
+  804199:	17                   	(bad)
+  80419a:	80 00 00             	addb   $0x0,(%rax)
+  80419d:	00 00                	add    %al,(%rax)
+  80419f:	00 0d 15 80 00 00    	add    %cl,0x8015(%rip)        # 80c1ba <__bss_end+0x31ba>
+  8041a5:	00 00                	add    %al,(%rax)
+  8041a7:	00 d7                	add    %dl,%bh
+  8041a9:	15 80 00 00 00       	adc    $0x80,%eax
+  8041ae:	00 00                	add    %al,(%rax)
+  8041b0:	27                   	(bad)
+  8041b1:	17                   	(bad)
+  8041b2:	80 00 00             	addb   $0x0,(%rax)
+  8041b5:	00 00                	add    %al,(%rax)
+  8041b7:	00 27                	add    %ah,(%rdi)
+  8041b9:	17                   	(bad)
+  8041ba:	80 00 00             	addb   $0x0,(%rax)
+  8041bd:	00 00                	add    %al,(%rax)
+  8041bf:	00 5c 12 80          	add    %bl,-0x80(%rdx,%rdx,1)
+  8041c3:	00 00                	add    %al,(%rax)
+  8041c5:	00 00                	add    %al,(%rax)
+  8041c7:	00 27                	add    %ah,(%rdi)
+  8041c9:	17                   	(bad)
+  8041ca:	80 00 00             	addb   $0x0,(%rax)
+  8041cd:	00 00                	add    %al,(%rax)
+  8041cf:	00 39                	add    %bh,(%rcx)
+  8041d1:	14 80                	adc    $0x80,%al
+  8041d3:	00 00                	add    %al,(%rax)
+  8041d5:	00 00                	add    %al,(%rax)
+  8041d7:	00 27                	add    %ah,(%rdi)
+  8041d9:	17                   	(bad)
+  8041da:	80 00 00             	addb   $0x0,(%rax)
+  8041dd:	00 00                	add    %al,(%rax)
+  8041df:	00 27                	add    %ah,(%rdi)
+  8041e1:	17                   	(bad)
+  8041e2:	80 00 00             	addb   $0x0,(%rax)
+  8041e5:	00 00                	add    %al,(%rax)
+  8041e7:	00 4a 16             	add    %cl,0x16(%rdx)
+  8041ea:	80 00 00             	addb   $0x0,(%rax)
+  8041ed:	00 00                	add    %al,(%rax)
+  8041ef:	00 27                	add    %ah,(%rdi)
+  8041f1:	17                   	(bad)
+  8041f2:	80 00 00             	addb   $0x0,(%rax)
+  8041f5:	00 00                	add    %al,(%rax)
+  8041f7:	00 ef                	add    %ch,%bh
+  8041f9:	10 80 00 00 00 00    	adc    %al,0x0(%rax)
+	...
+
+0000000000804200 <error_string>:
+	...
+  804208:	9d 3d 80 00 00 00 00 00 af 3d 80 00 00 00 00 00     .=.......=......
+  804218:	bf 3d 80 00 00 00 00 00 d1 3d 80 00 00 00 00 00     .=.......=......
+  804228:	df 3d 80 00 00 00 00 00 f3 3d 80 00 00 00 00 00     .=.......=......
+  804238:	08 3e 80 00 00 00 00 00 1b 3e 80 00 00 00 00 00     .>.......>......
+  804248:	2d 3e 80 00 00 00 00 00 41 3e 80 00 00 00 00 00     ->......A>......
+  804258:	51 3e 80 00 00 00 00 00 64 3e 80 00 00 00 00 00     Q>......d>......
+  804268:	7b 3e 80 00 00 00 00 00 91 3e 80 00 00 00 00 00     {>.......>......
+  804278:	a9 3e 80 00 00 00 00 00 c1 3e 80 00 00 00 00 00     .>.......>......
+  804288:	ce 3e 80 00 00 00 00 00 b0 42 80 00 00 00 00 00     .>.......B......
+  804298:	e2 3e 80 00 00 00 00 00 fa 3e 80 00 00 00 00 00     .>.......>......
+  8042a8:	10 3f 80 00 00 00 00 00 66 69 6c 65 20 69 73 20     .?......file is 
+  8042b8:	6e 6f 74 20 61 20 76 61 6c 69 64 20 65 78 65 63     not a valid exec
+  8042c8:	75 74 61 62 6c 65 00 90 73 79 73 63 61 6c 6c 20     utable..syscall 
+  8042d8:	25 7a 64 20 72 65 74 75 72 6e 65 64 20 25 7a 64     %zd returned %zd
+  8042e8:	20 28 3e 20 30 29 00 6c 69 62 2f 73 79 73 63 61      (> 0).lib/sysca
+  8042f8:	6c 6c 2e 63 00 0f 1f 00 55 73 65 72 73 70 61 63     ll.c....Userspac
+  804308:	65 20 70 61 67 65 20 66 61 75 6c 74 20 72 69 70     e page fault rip
+  804318:	3d 25 30 38 6c 58 20 76 61 3d 25 30 38 6c 58 20     =%08lX va=%08lX 
+  804328:	65 72 72 3d 25 78 0a 00 6c 69 62 2f 70 67 66 61     err=%x..lib/pgfa
+  804338:	75 6c 74 2e 63 00 73 65 74 5f 70 67 66 61 75 6c     ult.c.set_pgfaul
+  804348:	74 5f 68 61 6e 64 6c 65 72 3a 20 25 69 00 5f 70     t_handler: %i._p
+  804358:	66 68 61 6e 64 6c 65 72 5f 69 6e 69 74 69 74 69     fhandler_inititi
+  804368:	61 6c 6c 69 7a 65 64 00 61 73 73 65 72 74 69 6f     allized.assertio
+  804378:	6e 20 66 61 69 6c 65 64 3a 20 25 73 00 0f 1f 00     n failed: %s....
+  804388:	5b 25 30 38 78 5d 20 75 6e 6b 6e 6f 77 6e 20 64     [%08x] unknown d
+  804398:	65 76 69 63 65 20 74 79 70 65 20 25 64 0a 00 00     evice type %d...
+  8043a8:	5b 25 30 38 78 5d 20 66 74 72 75 6e 63 61 74 65     [%08x] ftruncate
+  8043b8:	20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65 0a      %d -- bad mode.
+  8043c8:	00 5b 25 30 38 78 5d 20 72 65 61 64 20 25 64 20     .[%08x] read %d 
+  8043d8:	2d 2d 20 62 61 64 20 6d 6f 64 65 0a 00 5b 25 30     -- bad mode..[%0
+  8043e8:	38 78 5d 20 77 72 69 74 65 20 25 64 20 2d 2d 20     8x] write %d -- 
+  8043f8:	62 61 64 20 6d 6f 64 65 0a 00 66 2e 0f 1f 84 00     bad mode..f.....
+  804408:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804418:	0f 1f 84 00 00 00 00 00                             ........
+
+0000000000804420 <devtab>:
+  804420:	20 50 80 00 00 00 00 00 60 50 80 00 00 00 00 00      P......`P......
+  804430:	a0 50 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .P..............
+  804440:	3c 70 69 70 65 3e 00 6c 69 62 2f 70 69 70 65 2e     <pipe>.lib/pipe.
+  804450:	63 00 70 69 70 65 00 90 73 79 73 5f 72 65 67 69     c.pipe..sys_regi
+  804460:	6f 6e 5f 72 65 66 73 28 76 61 2c 20 50 41 47 45     on_refs(va, PAGE
+  804470:	5f 53 49 5a 45 29 20 3d 3d 20 32 00 3c 63 6f 6e     _SIZE) == 2.<con
+  804480:	73 3e 00 63 6f 6e 73 00 73 79 73 5f 69 70 63 5f     s>.cons.sys_ipc_
+  804490:	74 72 79 5f 73 65 6e 64 20 66 61 69 6c 65 64 3a     try_send failed:
+  8044a0:	20 25 69 00 6c 69 62 2f 69 70 63 2e 63 00 66 2e      %i.lib/ipc.c.f.
+  8044b0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8044c0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8044d0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8044e0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8044f0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804500:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804510:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804520:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804530:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804540:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804550:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804560:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804570:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804580:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804590:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8045a0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8045b0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8045c0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8045d0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8045e0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8045f0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804600:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804610:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804620:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804630:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804640:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804650:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804660:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804670:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804680:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804690:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8046a0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8046b0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8046c0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8046d0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8046e0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8046f0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804700:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804710:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804720:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804730:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804740:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804750:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804760:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804770:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804780:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804790:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8047a0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8047b0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8047c0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8047d0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8047e0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8047f0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804800:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804810:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804820:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804830:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804840:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804850:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804860:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804870:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804880:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804890:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8048a0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8048b0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8048c0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8048d0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8048e0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8048f0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804900:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804910:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804920:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804930:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804940:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804950:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804960:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804970:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804980:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804990:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8049a0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8049b0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8049c0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8049d0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8049e0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8049f0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804a00:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804a10:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804a20:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804a30:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804a40:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804a50:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804a60:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804a70:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804a80:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804a90:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804aa0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804ab0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804ac0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804ad0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804ae0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804af0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804b00:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804b10:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804b20:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804b30:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804b40:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804b50:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804b60:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804b70:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804b80:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804b90:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804ba0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804bb0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804bc0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804bd0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804be0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804bf0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804c00:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804c10:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804c20:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804c30:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804c40:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804c50:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804c60:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804c70:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804c80:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804c90:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804ca0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804cb0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804cc0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804cd0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804ce0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804cf0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804d00:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804d10:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804d20:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804d30:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804d40:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804d50:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804d60:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804d70:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804d80:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804d90:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804da0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804db0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804dc0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804dd0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804de0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804df0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804e00:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804e10:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804e20:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804e30:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804e40:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804e50:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804e60:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804e70:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804e80:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804e90:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804ea0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804eb0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804ec0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804ed0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804ee0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804ef0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804f00:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804f10:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804f20:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804f30:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804f40:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804f50:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804f60:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804f70:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804f80:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804f90:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804fa0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804fb0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804fc0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804fd0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804fe0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804ff0:	0f 1f 84 00 00 00 00 00 0f 1f 84 00 00 00 00 00     ................
@@ -0,0 +1,5840 @@
+
+obj/user/faultsweep:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 5d 01 00 00       	call   800180 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+
+#define SWEEP_BASE    0x100000000ULL
+#define SWEEP_SIZE_MB 256
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 54                	push   %r12
+  80002b:	53                   	push   %rbx
+    size_t size_mb = argc > 1 ? strtol(argv[1], NULL, 0) : SWEEP_SIZE_MB;
+  80002c:	bb 00 01 00 00       	mov    $0x100,%ebx
+  800031:	83 ff 01             	cmp    $0x1,%edi
+  800034:	0f 8f f7 00 00 00    	jg     800131 <umain+0x10c>
+    size_t size = size_mb * 1024 * 1024;
+  80003a:	49 89 dc             	mov    %rbx,%r12
+  80003d:	49 c1 e4 14          	shl    $0x14,%r12
+    uint8_t *buf = (uint8_t *)SWEEP_BASE;
+
+    int res = sys_alloc_region(CURENVID, buf, size, PROT_RW | ALLOC_ZERO);
+  800041:	b9 06 00 10 00       	mov    $0x100006,%ecx
+  800046:	4c 89 e2             	mov    %r12,%rdx
+  800049:	48 be 00 00 00 00 01 	movabs $0x100000000,%rsi
+  800050:	00 00 00 
+  800053:	bf 00 00 00 00       	mov    $0x0,%edi
+  800058:	48 b8 71 12 80 00 00 	movabs $0x801271,%rax
+  80005f:	00 00 00 
+  800062:	ff d0                	call   *%rax
+    if (res < 0) panic("sys_alloc_region: %i", res);
+  800064:	85 c0                	test   %eax,%eax
+  800066:	0f 88 e7 00 00 00    	js     800153 <umain+0x12e>
+
+    uint32_t faults = thisenv->env_pgfaults;
+  80006c:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  800073:	00 00 00 
+  800076:	8b b0 f4 00 00 00    	mov    0xf4(%rax),%esi
+}
+
+static inline uint64_t __attribute__((always_inline))
+read_tsc(void) {
+    uint32_t lo, hi;
+    asm volatile("rdtsc"
+  80007c:	0f 31                	rdtsc
+                 : "=a"(lo), "=d"(hi));
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  80007e:	48 c1 e2 20          	shl    $0x20,%rdx
+  800082:	89 c0                	mov    %eax,%eax
+  800084:	48 89 d7             	mov    %rdx,%rdi
+  800087:	48 09 c7             	or     %rax,%rdi
+    uint64_t start = read_tsc();
+    for (size_t i = 0; i < size; i += PAGE_SIZE)
+  80008a:	4d 85 e4             	test   %r12,%r12
+  80008d:	74 2c                	je     8000bb <umain+0x96>
+  80008f:	49 8d 4c 24 ff       	lea    -0x1(%r12),%rcx
+  800094:	48 c1 e9 0c          	shr    $0xc,%rcx
+  800098:	48 81 c1 01 00 10 00 	add    $0x100001,%rcx
+  80009f:	48 c1 e1 0c          	shl    $0xc,%rcx
+  8000a3:	48 b8 00 00 00 00 01 	movabs $0x100000000,%rax
+  8000aa:	00 00 00 
+        buf[i] = 1;
+  8000ad:	c6 00 01             	movb   $0x1,(%rax)
+    for (size_t i = 0; i < size; i += PAGE_SIZE)
+  8000b0:	48 05 00 10 00 00    	add    $0x1000,%rax
+  8000b6:	48 39 c8             	cmp    %rcx,%rax
+  8000b9:	75 f2                	jne    8000ad <umain+0x88>
+    asm volatile("rdtsc"
+  8000bb:	0f 31                	rdtsc
+  8000bd:	41 89 c0             	mov    %eax,%r8d
+    uint64_t cycles = read_tsc() - start;
+    faults = thisenv->env_pgfaults - faults;
+  8000c0:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  8000c7:	00 00 00 
+  8000ca:	8b 88 f4 00 00 00    	mov    0xf4(%rax),%ecx
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  8000d0:	48 89 d0             	mov    %rdx,%rax
+  8000d3:	48 c1 e0 20          	shl    $0x20,%rax
+  8000d7:	45 89 c0             	mov    %r8d,%r8d
+  8000da:	4c 09 c0             	or     %r8,%rax
+    uint64_t cycles = read_tsc() - start;
+  8000dd:	48 29 f8             	sub    %rdi,%rax
+
+    cprintf("faultsweep: %lu MB, %u faults, %lu cycles per MB\n",
+  8000e0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8000e5:	48 f7 f3             	div    %rbx
+    faults = thisenv->env_pgfaults - faults;
+  8000e8:	89 ca                	mov    %ecx,%edx
+  8000ea:	29 f2                	sub    %esi,%edx
+    cprintf("faultsweep: %lu MB, %u faults, %lu cycles per MB\n",
+  8000ec:	48 89 c1             	mov    %rax,%rcx
+  8000ef:	48 89 de             	mov    %rbx,%rsi
+  8000f2:	48 bf f8 2d 80 00 00 	movabs $0x802df8,%rdi
+  8000f9:	00 00 00 
+  8000fc:	b8 00 00 00 00       	mov    $0x0,%eax
+  800101:	49 b8 9c 03 80 00 00 	movabs $0x80039c,%r8
+  800108:	00 00 00 
+  80010b:	41 ff d0             	call   *%r8
+            (unsigned long)size_mb, faults, (unsigned long)(cycles / size_mb));
+
+    sys_unmap_region(CURENVID, buf, size);
+  80010e:	4c 89 e2             	mov    %r12,%rdx
+  800111:	48 be 00 00 00 00 01 	movabs $0x100000000,%rsi
+  800118:	00 00 00 
+  80011b:	bf 00 00 00 00       	mov    $0x0,%edi
+  800120:	48 b8 3d 13 80 00 00 	movabs $0x80133d,%rax
+  800127:	00 00 00 
+  80012a:	ff d0                	call   *%rax
+}
+  80012c:	5b                   	pop    %rbx
+  80012d:	41 5c                	pop    %r12
+  80012f:	5d                   	pop    %rbp
+  800130:	c3                   	ret
+    size_t size_mb = argc > 1 ? strtol(argv[1], NULL, 0) : SWEEP_SIZE_MB;
+  800131:	48 8b 7e 08          	mov    0x8(%rsi),%rdi
+  800135:	ba 00 00 00 00       	mov    $0x0,%edx
+  80013a:	be 00 00 00 00       	mov    $0x0,%esi
+  80013f:	48 b8 32 10 80 00 00 	movabs $0x801032,%rax
+  800146:	00 00 00 
+  800149:	ff d0                	call   *%rax
+  80014b:	48 89 c3             	mov    %rax,%rbx
+  80014e:	e9 e7 fe ff ff       	jmp    80003a <umain+0x15>
+    if (res < 0) panic("sys_alloc_region: %i", res);
+  800153:	89 c1                	mov    %eax,%ecx
+  800155:	48 ba d0 2d 80 00 00 	movabs $0x802dd0,%rdx
+  80015c:	00 00 00 
+  80015f:	be 14 00 00 00       	mov    $0x14,%esi
+  800164:	48 bf e5 2d 80 00 00 	movabs $0x802de5,%rdi
+  80016b:	00 00 00 
+  80016e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800173:	49 b8 4c 02 80 00 00 	movabs $0x80024c,%r8
+  80017a:	00 00 00 
+  80017d:	41 ff d0             	call   *%r8
+
+0000000000800180 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800180:	55                   	push   %rbp
+  800181:	48 89 e5             	mov    %rsp,%rbp
+  800184:	41 56                	push   %r14
+  800186:	41 55                	push   %r13
+  800188:	41 54                	push   %r12
+  80018a:	53                   	push   %rbx
+  80018b:	41 89 fd             	mov    %edi,%r13d
+  80018e:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800191:	48 ba d8 40 80 00 00 	movabs $0x8040d8,%rdx
+  800198:	00 00 00 
+  80019b:	48 b8 d8 40 80 00 00 	movabs $0x8040d8,%rax
+  8001a2:	00 00 00 
+  8001a5:	48 39 c2             	cmp    %rax,%rdx
+  8001a8:	73 17                	jae    8001c1 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  8001aa:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  8001ad:	49 89 c4             	mov    %rax,%r12
+  8001b0:	48 83 c3 08          	add    $0x8,%rbx
+  8001b4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001b9:	ff 53 f8             	call   *-0x8(%rbx)
+  8001bc:	4c 39 e3             	cmp    %r12,%rbx
+  8001bf:	72 ef                	jb     8001b0 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+    envid_t this_env_id = sys_getenvid();
+  8001c1:	48 b8 b1 11 80 00 00 	movabs $0x8011b1,%rax
+  8001c8:	00 00 00 
+  8001cb:	ff d0                	call   *%rax
+    thisenv = &((struct Env*)UENVS)[ENVX(this_env_id)];
+  8001cd:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8001d2:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+  8001d9:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8001e0:	00 00 00 
+  8001e3:	48 01 d0             	add    %rdx,%rax
+  8001e6:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  8001ed:	00 00 00 
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8001f0:	45 85 ed             	test   %r13d,%r13d
+  8001f3:	7e 0d                	jle    800202 <libmain+0x82>
+  8001f5:	49 8b 06             	mov    (%r14),%rax
+  8001f8:	48 a3 00 40 80 00 00 	movabs %rax,0x804000
+  8001ff:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  800202:	4c 89 f6             	mov    %r14,%rsi
+  800205:	44 89 ef             	mov    %r13d,%edi
+  800208:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  80020f:	00 00 00 
+  800212:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  800214:	48 b8 29 02 80 00 00 	movabs $0x800229,%rax
+  80021b:	00 00 00 
+  80021e:	ff d0                	call   *%rax
+#endif
+}
+  800220:	5b                   	pop    %rbx
+  800221:	41 5c                	pop    %r12
+  800223:	41 5d                	pop    %r13
+  800225:	41 5e                	pop    %r14
+  800227:	5d                   	pop    %rbp
+  800228:	c3                   	ret
+
+0000000000800229 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  800229:	55                   	push   %rbp
+  80022a:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  80022d:	48 b8 05 19 80 00 00 	movabs $0x801905,%rax
+  800234:	00 00 00 
+  800237:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  800239:	bf 00 00 00 00       	mov    $0x0,%edi
+  80023e:	48 b8 46 11 80 00 00 	movabs $0x801146,%rax
+  800245:	00 00 00 
+  800248:	ff d0                	call   *%rax
+}
+  80024a:	5d                   	pop    %rbp
+  80024b:	c3                   	ret
+
+000000000080024c <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  80024c:	55                   	push   %rbp
+  80024d:	48 89 e5             	mov    %rsp,%rbp
+  800250:	41 56                	push   %r14
+  800252:	41 55                	push   %r13
+  800254:	41 54                	push   %r12
+  800256:	53                   	push   %rbx
+  800257:	48 83 ec 50          	sub    $0x50,%rsp
+  80025b:	49 89 fc             	mov    %rdi,%r12
+  80025e:	41 89 f5             	mov    %esi,%r13d
+  800261:	48 89 d3             	mov    %rdx,%rbx
+  800264:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  800268:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  80026c:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800270:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  800277:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80027b:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  80027f:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  800283:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  800287:	48 b8 00 40 80 00 00 	movabs $0x804000,%rax
+  80028e:	00 00 00 
+  800291:	4c 8b 30             	mov    (%rax),%r14
+  800294:	48 b8 b1 11 80 00 00 	movabs $0x8011b1,%rax
+  80029b:	00 00 00 
+  80029e:	ff d0                	call   *%rax
+  8002a0:	89 c6                	mov    %eax,%esi
+  8002a2:	45 89 e8             	mov    %r13d,%r8d
+  8002a5:	4c 89 e1             	mov    %r12,%rcx
+  8002a8:	4c 89 f2             	mov    %r14,%rdx
+  8002ab:	48 bf 38 2e 80 00 00 	movabs $0x802e38,%rdi
+  8002b2:	00 00 00 
+  8002b5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002ba:	49 bc 9c 03 80 00 00 	movabs $0x80039c,%r12
+  8002c1:	00 00 00 
+  8002c4:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  8002c7:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  8002cb:	48 89 df             	mov    %rbx,%rdi
+  8002ce:	48 b8 38 03 80 00 00 	movabs $0x800338,%rax
+  8002d5:	00 00 00 
+  8002d8:	ff d0                	call   *%rax
+    cprintf("\n");
+  8002da:	48 bf 3b 34 80 00 00 	movabs $0x80343b,%rdi
+  8002e1:	00 00 00 
+  8002e4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002e9:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  8002ec:	cc                   	int3
+  8002ed:	eb fd                	jmp    8002ec <_panic+0xa0>
+
+00000000008002ef <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  8002ef:	55                   	push   %rbp
+  8002f0:	48 89 e5             	mov    %rsp,%rbp
+  8002f3:	53                   	push   %rbx
+  8002f4:	48 83 ec 08          	sub    $0x8,%rsp
+  8002f8:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  8002fb:	8b 06                	mov    (%rsi),%eax
+  8002fd:	8d 50 01             	lea    0x1(%rax),%edx
+  800300:	89 16                	mov    %edx,(%rsi)
+  800302:	48 98                	cltq
+  800304:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  800309:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  80030f:	74 0a                	je     80031b <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  800311:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  800315:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800319:	c9                   	leave
+  80031a:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  80031b:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  80031f:	be ff 00 00 00       	mov    $0xff,%esi
+  800324:	48 b8 e8 10 80 00 00 	movabs $0x8010e8,%rax
+  80032b:	00 00 00 
+  80032e:	ff d0                	call   *%rax
+        state->offset = 0;
+  800330:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  800336:	eb d9                	jmp    800311 <putch+0x22>
+
+0000000000800338 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  800338:	55                   	push   %rbp
+  800339:	48 89 e5             	mov    %rsp,%rbp
+  80033c:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  800343:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  800346:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  80034d:	b9 21 00 00 00       	mov    $0x21,%ecx
+  800352:	b8 00 00 00 00       	mov    $0x0,%eax
+  800357:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  80035a:	48 89 f1             	mov    %rsi,%rcx
+  80035d:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  800364:	48 bf ef 02 80 00 00 	movabs $0x8002ef,%rdi
+  80036b:	00 00 00 
+  80036e:	48 b8 ec 04 80 00 00 	movabs $0x8004ec,%rax
+  800375:	00 00 00 
+  800378:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  80037a:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  800381:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  800388:	48 b8 e8 10 80 00 00 	movabs $0x8010e8,%rax
+  80038f:	00 00 00 
+  800392:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  800394:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  80039a:	c9                   	leave
+  80039b:	c3                   	ret
+
+000000000080039c <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  80039c:	55                   	push   %rbp
+  80039d:	48 89 e5             	mov    %rsp,%rbp
+  8003a0:	48 83 ec 50          	sub    $0x50,%rsp
+  8003a4:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8003a8:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8003ac:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8003b0:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8003b4:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  8003b8:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  8003bf:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8003c3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8003c7:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8003cb:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  8003cf:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  8003d3:	48 b8 38 03 80 00 00 	movabs $0x800338,%rax
+  8003da:	00 00 00 
+  8003dd:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  8003df:	c9                   	leave
+  8003e0:	c3                   	ret
+
+00000000008003e1 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  8003e1:	55                   	push   %rbp
+  8003e2:	48 89 e5             	mov    %rsp,%rbp
+  8003e5:	41 57                	push   %r15
+  8003e7:	41 56                	push   %r14
+  8003e9:	41 55                	push   %r13
+  8003eb:	41 54                	push   %r12
+  8003ed:	53                   	push   %rbx
+  8003ee:	48 83 ec 18          	sub    $0x18,%rsp
+  8003f2:	49 89 fc             	mov    %rdi,%r12
+  8003f5:	49 89 f5             	mov    %rsi,%r13
+  8003f8:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8003fc:	8b 45 10             	mov    0x10(%rbp),%eax
+  8003ff:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  800402:	41 89 cf             	mov    %ecx,%r15d
+  800405:	4c 39 fa             	cmp    %r15,%rdx
+  800408:	73 5b                	jae    800465 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  80040a:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  80040e:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  800412:	85 db                	test   %ebx,%ebx
+  800414:	7e 0e                	jle    800424 <print_num+0x43>
+            putch(padc, put_arg);
+  800416:	4c 89 ee             	mov    %r13,%rsi
+  800419:	44 89 f7             	mov    %r14d,%edi
+  80041c:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  80041f:	83 eb 01             	sub    $0x1,%ebx
+  800422:	75 f2                	jne    800416 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  800424:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  800428:	48 b9 6c 2e 80 00 00 	movabs $0x802e6c,%rcx
+  80042f:	00 00 00 
+  800432:	48 b8 5b 2e 80 00 00 	movabs $0x802e5b,%rax
+  800439:	00 00 00 
+  80043c:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  800440:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800444:	ba 00 00 00 00       	mov    $0x0,%edx
+  800449:	49 f7 f7             	div    %r15
+  80044c:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  800450:	4c 89 ee             	mov    %r13,%rsi
+  800453:	41 ff d4             	call   *%r12
+}
+  800456:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  80045a:	5b                   	pop    %rbx
+  80045b:	41 5c                	pop    %r12
+  80045d:	41 5d                	pop    %r13
+  80045f:	41 5e                	pop    %r14
+  800461:	41 5f                	pop    %r15
+  800463:	5d                   	pop    %rbp
+  800464:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  800465:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800469:	ba 00 00 00 00       	mov    $0x0,%edx
+  80046e:	49 f7 f7             	div    %r15
+  800471:	48 83 ec 08          	sub    $0x8,%rsp
+  800475:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  800479:	52                   	push   %rdx
+  80047a:	45 0f be c9          	movsbl %r9b,%r9d
+  80047e:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  800482:	48 89 c2             	mov    %rax,%rdx
+  800485:	48 b8 e1 03 80 00 00 	movabs $0x8003e1,%rax
+  80048c:	00 00 00 
+  80048f:	ff d0                	call   *%rax
+  800491:	48 83 c4 10          	add    $0x10,%rsp
+  800495:	eb 8d                	jmp    800424 <print_num+0x43>
+
+0000000000800497 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  800497:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  80049b:	48 8b 06             	mov    (%rsi),%rax
+  80049e:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  8004a2:	73 0a                	jae    8004ae <sprintputch+0x17>
+        *state->start++ = ch;
+  8004a4:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8004a8:	48 89 16             	mov    %rdx,(%rsi)
+  8004ab:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  8004ae:	c3                   	ret
+
+00000000008004af <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  8004af:	55                   	push   %rbp
+  8004b0:	48 89 e5             	mov    %rsp,%rbp
+  8004b3:	48 83 ec 50          	sub    $0x50,%rsp
+  8004b7:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8004bb:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8004bf:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  8004c3:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8004ca:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8004ce:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8004d2:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8004d6:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  8004da:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8004de:	48 b8 ec 04 80 00 00 	movabs $0x8004ec,%rax
+  8004e5:	00 00 00 
+  8004e8:	ff d0                	call   *%rax
+}
+  8004ea:	c9                   	leave
+  8004eb:	c3                   	ret
+
+00000000008004ec <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  8004ec:	55                   	push   %rbp
+  8004ed:	48 89 e5             	mov    %rsp,%rbp
+  8004f0:	41 57                	push   %r15
+  8004f2:	41 56                	push   %r14
+  8004f4:	41 55                	push   %r13
+  8004f6:	41 54                	push   %r12
+  8004f8:	53                   	push   %rbx
+  8004f9:	48 83 ec 38          	sub    $0x38,%rsp
+  8004fd:	49 89 fe             	mov    %rdi,%r14
+  800500:	49 89 f5             	mov    %rsi,%r13
+  800503:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  800506:	48 8b 01             	mov    (%rcx),%rax
+  800509:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  80050d:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800511:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800515:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  800519:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  80051d:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  800521:	0f b6 3b             	movzbl (%rbx),%edi
+  800524:	40 80 ff 25          	cmp    $0x25,%dil
+  800528:	74 18                	je     800542 <vprintfmt+0x56>
+            if (!ch) return;
+  80052a:	40 84 ff             	test   %dil,%dil
+  80052d:	0f 84 b1 06 00 00    	je     800be4 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  800533:	40 0f b6 ff          	movzbl %dil,%edi
+  800537:	4c 89 ee             	mov    %r13,%rsi
+  80053a:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  80053d:	4c 89 e3             	mov    %r12,%rbx
+  800540:	eb db                	jmp    80051d <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  800542:	be 00 00 00 00       	mov    $0x0,%esi
+  800547:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  80054b:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  800550:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800556:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  80055d:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800561:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  800566:	41 0f b6 04 24       	movzbl (%r12),%eax
+  80056b:	88 45 a0             	mov    %al,-0x60(%rbp)
+  80056e:	83 e8 23             	sub    $0x23,%eax
+  800571:	3c 57                	cmp    $0x57,%al
+  800573:	0f 87 51 06 00 00    	ja     800bca <vprintfmt+0x6de>
+  800579:	0f b6 c0             	movzbl %al,%eax
+  80057c:	48 b9 20 30 80 00 00 	movabs $0x803020,%rcx
+  800583:	00 00 00 
+  800586:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  800589:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  80058c:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  800590:	eb cf                	jmp    800561 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  800592:	49 89 dc             	mov    %rbx,%r12
+  800595:	be 01 00 00 00       	mov    $0x1,%esi
+  80059a:	eb c5                	jmp    800561 <vprintfmt+0x75>
+            padc = ch;
+  80059c:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  8005a0:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8005a3:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8005a6:	eb b9                	jmp    800561 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8005a8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8005ab:	83 f8 2f             	cmp    $0x2f,%eax
+  8005ae:	77 24                	ja     8005d4 <vprintfmt+0xe8>
+  8005b0:	89 c1                	mov    %eax,%ecx
+  8005b2:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  8005b6:	83 c0 08             	add    $0x8,%eax
+  8005b9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8005bc:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  8005bf:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  8005c2:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8005c6:	79 99                	jns    800561 <vprintfmt+0x75>
+                width = precision;
+  8005c8:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  8005cc:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8005d2:	eb 8d                	jmp    800561 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8005d4:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8005d8:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  8005dc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8005e0:	eb da                	jmp    8005bc <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  8005e2:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  8005e7:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8005eb:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  8005f1:	3c 39                	cmp    $0x39,%al
+  8005f3:	77 1c                	ja     800611 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  8005f5:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  8005f9:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  8005fd:	0f b6 c0             	movzbl %al,%eax
+  800600:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800605:	0f b6 03             	movzbl (%rbx),%eax
+  800608:	3c 39                	cmp    $0x39,%al
+  80060a:	76 e9                	jbe    8005f5 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  80060c:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  80060f:	eb b1                	jmp    8005c2 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  800611:	49 89 dc             	mov    %rbx,%r12
+  800614:	eb ac                	jmp    8005c2 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  800616:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  800619:	85 c9                	test   %ecx,%ecx
+  80061b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800620:	0f 49 c1             	cmovns %ecx,%eax
+  800623:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  800626:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800629:	e9 33 ff ff ff       	jmp    800561 <vprintfmt+0x75>
+            lflag++;
+  80062e:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  800631:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800634:	e9 28 ff ff ff       	jmp    800561 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  800639:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80063c:	83 f8 2f             	cmp    $0x2f,%eax
+  80063f:	77 19                	ja     80065a <vprintfmt+0x16e>
+  800641:	89 c2                	mov    %eax,%edx
+  800643:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800647:	83 c0 08             	add    $0x8,%eax
+  80064a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80064d:	8b 3a                	mov    (%rdx),%edi
+  80064f:	4c 89 ee             	mov    %r13,%rsi
+  800652:	41 ff d6             	call   *%r14
+            break;
+  800655:	e9 c3 fe ff ff       	jmp    80051d <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  80065a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80065e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800662:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800666:	eb e5                	jmp    80064d <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  800668:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80066b:	83 f8 2f             	cmp    $0x2f,%eax
+  80066e:	77 5a                	ja     8006ca <vprintfmt+0x1de>
+  800670:	89 c2                	mov    %eax,%edx
+  800672:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800676:	83 c0 08             	add    $0x8,%eax
+  800679:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  80067c:	8b 02                	mov    (%rdx),%eax
+  80067e:	89 c1                	mov    %eax,%ecx
+  800680:	f7 d9                	neg    %ecx
+  800682:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  800685:	83 f9 15             	cmp    $0x15,%ecx
+  800688:	7f 4e                	jg     8006d8 <vprintfmt+0x1ec>
+  80068a:	48 63 c1             	movslq %ecx,%rax
+  80068d:	48 ba e0 32 80 00 00 	movabs $0x8032e0,%rdx
+  800694:	00 00 00 
+  800697:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80069b:	48 85 c0             	test   %rax,%rax
+  80069e:	74 38                	je     8006d8 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  8006a0:	48 89 c1             	mov    %rax,%rcx
+  8006a3:	48 ba 99 34 80 00 00 	movabs $0x803499,%rdx
+  8006aa:	00 00 00 
+  8006ad:	4c 89 ee             	mov    %r13,%rsi
+  8006b0:	4c 89 f7             	mov    %r14,%rdi
+  8006b3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006b8:	49 b8 af 04 80 00 00 	movabs $0x8004af,%r8
+  8006bf:	00 00 00 
+  8006c2:	41 ff d0             	call   *%r8
+  8006c5:	e9 53 fe ff ff       	jmp    80051d <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  8006ca:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8006ce:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006d2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006d6:	eb a4                	jmp    80067c <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  8006d8:	48 ba 84 2e 80 00 00 	movabs $0x802e84,%rdx
+  8006df:	00 00 00 
+  8006e2:	4c 89 ee             	mov    %r13,%rsi
+  8006e5:	4c 89 f7             	mov    %r14,%rdi
+  8006e8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006ed:	49 b8 af 04 80 00 00 	movabs $0x8004af,%r8
+  8006f4:	00 00 00 
+  8006f7:	41 ff d0             	call   *%r8
+  8006fa:	e9 1e fe ff ff       	jmp    80051d <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8006ff:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800702:	83 f8 2f             	cmp    $0x2f,%eax
+  800705:	77 6c                	ja     800773 <vprintfmt+0x287>
+  800707:	89 c2                	mov    %eax,%edx
+  800709:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80070d:	83 c0 08             	add    $0x8,%eax
+  800710:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800713:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  800716:	48 85 d2             	test   %rdx,%rdx
+  800719:	48 b8 7d 2e 80 00 00 	movabs $0x802e7d,%rax
+  800720:	00 00 00 
+  800723:	48 0f 45 c2          	cmovne %rdx,%rax
+  800727:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  80072b:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  80072f:	7e 06                	jle    800737 <vprintfmt+0x24b>
+  800731:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  800735:	75 4a                	jne    800781 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800737:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  80073b:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  80073f:	0f b6 00             	movzbl (%rax),%eax
+  800742:	84 c0                	test   %al,%al
+  800744:	0f 85 9a 00 00 00    	jne    8007e4 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  80074a:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80074d:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  800751:	85 c0                	test   %eax,%eax
+  800753:	0f 8e c4 fd ff ff    	jle    80051d <vprintfmt+0x31>
+  800759:	4c 89 ee             	mov    %r13,%rsi
+  80075c:	bf 20 00 00 00       	mov    $0x20,%edi
+  800761:	41 ff d6             	call   *%r14
+  800764:	41 83 ec 01          	sub    $0x1,%r12d
+  800768:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  80076c:	75 eb                	jne    800759 <vprintfmt+0x26d>
+  80076e:	e9 aa fd ff ff       	jmp    80051d <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800773:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800777:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80077b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80077f:	eb 92                	jmp    800713 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  800781:	49 63 f7             	movslq %r15d,%rsi
+  800784:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  800788:	48 b8 9e 0c 80 00 00 	movabs $0x800c9e,%rax
+  80078f:	00 00 00 
+  800792:	ff d0                	call   *%rax
+  800794:	48 89 c2             	mov    %rax,%rdx
+  800797:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80079a:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  80079c:	8d 70 ff             	lea    -0x1(%rax),%esi
+  80079f:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  8007a2:	85 c0                	test   %eax,%eax
+  8007a4:	7e 91                	jle    800737 <vprintfmt+0x24b>
+  8007a6:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  8007ab:	4c 89 ee             	mov    %r13,%rsi
+  8007ae:	44 89 e7             	mov    %r12d,%edi
+  8007b1:	41 ff d6             	call   *%r14
+  8007b4:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8007b8:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8007bb:	83 f8 ff             	cmp    $0xffffffff,%eax
+  8007be:	75 eb                	jne    8007ab <vprintfmt+0x2bf>
+  8007c0:	e9 72 ff ff ff       	jmp    800737 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8007c5:	0f b6 f8             	movzbl %al,%edi
+  8007c8:	4c 89 ee             	mov    %r13,%rsi
+  8007cb:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8007ce:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8007d2:	49 83 c4 01          	add    $0x1,%r12
+  8007d6:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  8007dc:	84 c0                	test   %al,%al
+  8007de:	0f 84 66 ff ff ff    	je     80074a <vprintfmt+0x25e>
+  8007e4:	45 85 ff             	test   %r15d,%r15d
+  8007e7:	78 0a                	js     8007f3 <vprintfmt+0x307>
+  8007e9:	41 83 ef 01          	sub    $0x1,%r15d
+  8007ed:	0f 88 57 ff ff ff    	js     80074a <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8007f3:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  8007f7:	74 cc                	je     8007c5 <vprintfmt+0x2d9>
+  8007f9:	8d 50 e0             	lea    -0x20(%rax),%edx
+  8007fc:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800801:	80 fa 5e             	cmp    $0x5e,%dl
+  800804:	77 c2                	ja     8007c8 <vprintfmt+0x2dc>
+  800806:	eb bd                	jmp    8007c5 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  800808:	40 84 f6             	test   %sil,%sil
+  80080b:	75 26                	jne    800833 <vprintfmt+0x347>
+    switch (lflag) {
+  80080d:	85 d2                	test   %edx,%edx
+  80080f:	74 59                	je     80086a <vprintfmt+0x37e>
+  800811:	83 fa 01             	cmp    $0x1,%edx
+  800814:	74 7b                	je     800891 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  800816:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800819:	83 f8 2f             	cmp    $0x2f,%eax
+  80081c:	0f 87 96 00 00 00    	ja     8008b8 <vprintfmt+0x3cc>
+  800822:	89 c2                	mov    %eax,%edx
+  800824:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800828:	83 c0 08             	add    $0x8,%eax
+  80082b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80082e:	4c 8b 22             	mov    (%rdx),%r12
+  800831:	eb 17                	jmp    80084a <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  800833:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800836:	83 f8 2f             	cmp    $0x2f,%eax
+  800839:	77 21                	ja     80085c <vprintfmt+0x370>
+  80083b:	89 c2                	mov    %eax,%edx
+  80083d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800841:	83 c0 08             	add    $0x8,%eax
+  800844:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800847:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  80084a:	4d 85 e4             	test   %r12,%r12
+  80084d:	78 7a                	js     8008c9 <vprintfmt+0x3dd>
+            num = i;
+  80084f:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  800852:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  800857:	e9 50 02 00 00       	jmp    800aac <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  80085c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800860:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800864:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800868:	eb dd                	jmp    800847 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  80086a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80086d:	83 f8 2f             	cmp    $0x2f,%eax
+  800870:	77 11                	ja     800883 <vprintfmt+0x397>
+  800872:	89 c2                	mov    %eax,%edx
+  800874:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800878:	83 c0 08             	add    $0x8,%eax
+  80087b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80087e:	4c 63 22             	movslq (%rdx),%r12
+  800881:	eb c7                	jmp    80084a <vprintfmt+0x35e>
+  800883:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800887:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80088b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80088f:	eb ed                	jmp    80087e <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  800891:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800894:	83 f8 2f             	cmp    $0x2f,%eax
+  800897:	77 11                	ja     8008aa <vprintfmt+0x3be>
+  800899:	89 c2                	mov    %eax,%edx
+  80089b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80089f:	83 c0 08             	add    $0x8,%eax
+  8008a2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008a5:	4c 8b 22             	mov    (%rdx),%r12
+  8008a8:	eb a0                	jmp    80084a <vprintfmt+0x35e>
+  8008aa:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008ae:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008b2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008b6:	eb ed                	jmp    8008a5 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  8008b8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008bc:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008c0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008c4:	e9 65 ff ff ff       	jmp    80082e <vprintfmt+0x342>
+                putch('-', put_arg);
+  8008c9:	4c 89 ee             	mov    %r13,%rsi
+  8008cc:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  8008d1:	41 ff d6             	call   *%r14
+                i = -i;
+  8008d4:	49 f7 dc             	neg    %r12
+  8008d7:	e9 73 ff ff ff       	jmp    80084f <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  8008dc:	40 84 f6             	test   %sil,%sil
+  8008df:	75 32                	jne    800913 <vprintfmt+0x427>
+    switch (lflag) {
+  8008e1:	85 d2                	test   %edx,%edx
+  8008e3:	74 5d                	je     800942 <vprintfmt+0x456>
+  8008e5:	83 fa 01             	cmp    $0x1,%edx
+  8008e8:	0f 84 82 00 00 00    	je     800970 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  8008ee:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008f1:	83 f8 2f             	cmp    $0x2f,%eax
+  8008f4:	0f 87 a5 00 00 00    	ja     80099f <vprintfmt+0x4b3>
+  8008fa:	89 c2                	mov    %eax,%edx
+  8008fc:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800900:	83 c0 08             	add    $0x8,%eax
+  800903:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800906:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800909:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  80090e:	e9 99 01 00 00       	jmp    800aac <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800913:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800916:	83 f8 2f             	cmp    $0x2f,%eax
+  800919:	77 19                	ja     800934 <vprintfmt+0x448>
+  80091b:	89 c2                	mov    %eax,%edx
+  80091d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800921:	83 c0 08             	add    $0x8,%eax
+  800924:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800927:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  80092a:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  80092f:	e9 78 01 00 00       	jmp    800aac <vprintfmt+0x5c0>
+  800934:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800938:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80093c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800940:	eb e5                	jmp    800927 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  800942:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800945:	83 f8 2f             	cmp    $0x2f,%eax
+  800948:	77 18                	ja     800962 <vprintfmt+0x476>
+  80094a:	89 c2                	mov    %eax,%edx
+  80094c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800950:	83 c0 08             	add    $0x8,%eax
+  800953:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800956:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800958:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  80095d:	e9 4a 01 00 00       	jmp    800aac <vprintfmt+0x5c0>
+  800962:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800966:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80096a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80096e:	eb e6                	jmp    800956 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  800970:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800973:	83 f8 2f             	cmp    $0x2f,%eax
+  800976:	77 19                	ja     800991 <vprintfmt+0x4a5>
+  800978:	89 c2                	mov    %eax,%edx
+  80097a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80097e:	83 c0 08             	add    $0x8,%eax
+  800981:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800984:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800987:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  80098c:	e9 1b 01 00 00       	jmp    800aac <vprintfmt+0x5c0>
+  800991:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800995:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800999:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80099d:	eb e5                	jmp    800984 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  80099f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009a3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009a7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009ab:	e9 56 ff ff ff       	jmp    800906 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  8009b0:	40 84 f6             	test   %sil,%sil
+  8009b3:	75 2e                	jne    8009e3 <vprintfmt+0x4f7>
+    switch (lflag) {
+  8009b5:	85 d2                	test   %edx,%edx
+  8009b7:	74 59                	je     800a12 <vprintfmt+0x526>
+  8009b9:	83 fa 01             	cmp    $0x1,%edx
+  8009bc:	74 7f                	je     800a3d <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  8009be:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009c1:	83 f8 2f             	cmp    $0x2f,%eax
+  8009c4:	0f 87 9f 00 00 00    	ja     800a69 <vprintfmt+0x57d>
+  8009ca:	89 c2                	mov    %eax,%edx
+  8009cc:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009d0:	83 c0 08             	add    $0x8,%eax
+  8009d3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009d6:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8009d9:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  8009de:	e9 c9 00 00 00       	jmp    800aac <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8009e3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009e6:	83 f8 2f             	cmp    $0x2f,%eax
+  8009e9:	77 19                	ja     800a04 <vprintfmt+0x518>
+  8009eb:	89 c2                	mov    %eax,%edx
+  8009ed:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009f1:	83 c0 08             	add    $0x8,%eax
+  8009f4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009f7:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8009fa:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8009ff:	e9 a8 00 00 00       	jmp    800aac <vprintfmt+0x5c0>
+  800a04:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a08:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a0c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a10:	eb e5                	jmp    8009f7 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  800a12:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a15:	83 f8 2f             	cmp    $0x2f,%eax
+  800a18:	77 15                	ja     800a2f <vprintfmt+0x543>
+  800a1a:	89 c2                	mov    %eax,%edx
+  800a1c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a20:	83 c0 08             	add    $0x8,%eax
+  800a23:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a26:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  800a28:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  800a2d:	eb 7d                	jmp    800aac <vprintfmt+0x5c0>
+  800a2f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a33:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a37:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a3b:	eb e9                	jmp    800a26 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  800a3d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a40:	83 f8 2f             	cmp    $0x2f,%eax
+  800a43:	77 16                	ja     800a5b <vprintfmt+0x56f>
+  800a45:	89 c2                	mov    %eax,%edx
+  800a47:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a4b:	83 c0 08             	add    $0x8,%eax
+  800a4e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a51:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800a54:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  800a59:	eb 51                	jmp    800aac <vprintfmt+0x5c0>
+  800a5b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a5f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a63:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a67:	eb e8                	jmp    800a51 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  800a69:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a6d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a71:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a75:	e9 5c ff ff ff       	jmp    8009d6 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  800a7a:	4c 89 ee             	mov    %r13,%rsi
+  800a7d:	bf 30 00 00 00       	mov    $0x30,%edi
+  800a82:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800a85:	4c 89 ee             	mov    %r13,%rsi
+  800a88:	bf 78 00 00 00       	mov    $0x78,%edi
+  800a8d:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800a90:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a93:	83 f8 2f             	cmp    $0x2f,%eax
+  800a96:	77 47                	ja     800adf <vprintfmt+0x5f3>
+  800a98:	89 c2                	mov    %eax,%edx
+  800a9a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a9e:	83 c0 08             	add    $0x8,%eax
+  800aa1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800aa4:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800aa7:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800aac:	48 83 ec 08          	sub    $0x8,%rsp
+  800ab0:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800ab4:	0f 94 c0             	sete   %al
+  800ab7:	0f b6 c0             	movzbl %al,%eax
+  800aba:	50                   	push   %rax
+  800abb:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800ac0:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800ac4:	4c 89 ee             	mov    %r13,%rsi
+  800ac7:	4c 89 f7             	mov    %r14,%rdi
+  800aca:	48 b8 e1 03 80 00 00 	movabs $0x8003e1,%rax
+  800ad1:	00 00 00 
+  800ad4:	ff d0                	call   *%rax
+            break;
+  800ad6:	48 83 c4 10          	add    $0x10,%rsp
+  800ada:	e9 3e fa ff ff       	jmp    80051d <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800adf:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ae3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ae7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800aeb:	eb b7                	jmp    800aa4 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  800aed:	40 84 f6             	test   %sil,%sil
+  800af0:	75 2b                	jne    800b1d <vprintfmt+0x631>
+    switch (lflag) {
+  800af2:	85 d2                	test   %edx,%edx
+  800af4:	74 56                	je     800b4c <vprintfmt+0x660>
+  800af6:	83 fa 01             	cmp    $0x1,%edx
+  800af9:	74 7f                	je     800b7a <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800afb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800afe:	83 f8 2f             	cmp    $0x2f,%eax
+  800b01:	0f 87 a2 00 00 00    	ja     800ba9 <vprintfmt+0x6bd>
+  800b07:	89 c2                	mov    %eax,%edx
+  800b09:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b0d:	83 c0 08             	add    $0x8,%eax
+  800b10:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b13:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800b16:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800b1b:	eb 8f                	jmp    800aac <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800b1d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b20:	83 f8 2f             	cmp    $0x2f,%eax
+  800b23:	77 19                	ja     800b3e <vprintfmt+0x652>
+  800b25:	89 c2                	mov    %eax,%edx
+  800b27:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b2b:	83 c0 08             	add    $0x8,%eax
+  800b2e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b31:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800b34:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800b39:	e9 6e ff ff ff       	jmp    800aac <vprintfmt+0x5c0>
+  800b3e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b42:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b46:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b4a:	eb e5                	jmp    800b31 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800b4c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b4f:	83 f8 2f             	cmp    $0x2f,%eax
+  800b52:	77 18                	ja     800b6c <vprintfmt+0x680>
+  800b54:	89 c2                	mov    %eax,%edx
+  800b56:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b5a:	83 c0 08             	add    $0x8,%eax
+  800b5d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b60:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800b62:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800b67:	e9 40 ff ff ff       	jmp    800aac <vprintfmt+0x5c0>
+  800b6c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b70:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b74:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b78:	eb e6                	jmp    800b60 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800b7a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b7d:	83 f8 2f             	cmp    $0x2f,%eax
+  800b80:	77 19                	ja     800b9b <vprintfmt+0x6af>
+  800b82:	89 c2                	mov    %eax,%edx
+  800b84:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b88:	83 c0 08             	add    $0x8,%eax
+  800b8b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b8e:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800b91:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800b96:	e9 11 ff ff ff       	jmp    800aac <vprintfmt+0x5c0>
+  800b9b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b9f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ba3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ba7:	eb e5                	jmp    800b8e <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800ba9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bad:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bb1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bb5:	e9 59 ff ff ff       	jmp    800b13 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800bba:	4c 89 ee             	mov    %r13,%rsi
+  800bbd:	bf 25 00 00 00       	mov    $0x25,%edi
+  800bc2:	41 ff d6             	call   *%r14
+            break;
+  800bc5:	e9 53 f9 ff ff       	jmp    80051d <vprintfmt+0x31>
+            putch('%', put_arg);
+  800bca:	4c 89 ee             	mov    %r13,%rsi
+  800bcd:	bf 25 00 00 00       	mov    $0x25,%edi
+  800bd2:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800bd5:	48 83 eb 01          	sub    $0x1,%rbx
+  800bd9:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800bdd:	75 f6                	jne    800bd5 <vprintfmt+0x6e9>
+  800bdf:	e9 39 f9 ff ff       	jmp    80051d <vprintfmt+0x31>
+}
+  800be4:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800be8:	5b                   	pop    %rbx
+  800be9:	41 5c                	pop    %r12
+  800beb:	41 5d                	pop    %r13
+  800bed:	41 5e                	pop    %r14
+  800bef:	41 5f                	pop    %r15
+  800bf1:	5d                   	pop    %rbp
+  800bf2:	c3                   	ret
+
+0000000000800bf3 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800bf3:	55                   	push   %rbp
+  800bf4:	48 89 e5             	mov    %rsp,%rbp
+  800bf7:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800bfb:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800bff:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800c04:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800c08:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800c0f:	48 85 ff             	test   %rdi,%rdi
+  800c12:	74 2b                	je     800c3f <vsnprintf+0x4c>
+  800c14:	48 85 f6             	test   %rsi,%rsi
+  800c17:	74 26                	je     800c3f <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800c19:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800c1d:	48 bf 97 04 80 00 00 	movabs $0x800497,%rdi
+  800c24:	00 00 00 
+  800c27:	48 b8 ec 04 80 00 00 	movabs $0x8004ec,%rax
+  800c2e:	00 00 00 
+  800c31:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800c33:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800c37:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800c3a:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800c3d:	c9                   	leave
+  800c3e:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800c3f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800c44:	eb f7                	jmp    800c3d <vsnprintf+0x4a>
+
+0000000000800c46 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800c46:	55                   	push   %rbp
+  800c47:	48 89 e5             	mov    %rsp,%rbp
+  800c4a:	48 83 ec 50          	sub    $0x50,%rsp
+  800c4e:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800c52:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800c56:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800c5a:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800c61:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800c65:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c69:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800c6d:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800c71:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800c75:	48 b8 f3 0b 80 00 00 	movabs $0x800bf3,%rax
+  800c7c:	00 00 00 
+  800c7f:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800c81:	c9                   	leave
+  800c82:	c3                   	ret
+
+0000000000800c83 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800c83:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800c86:	74 10                	je     800c98 <strlen+0x15>
+    size_t n = 0;
+  800c88:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800c8d:	48 83 c0 01          	add    $0x1,%rax
+  800c91:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800c95:	75 f6                	jne    800c8d <strlen+0xa>
+  800c97:	c3                   	ret
+    size_t n = 0;
+  800c98:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800c9d:	c3                   	ret
+
+0000000000800c9e <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800c9e:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800ca1:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800ca6:	48 85 f6             	test   %rsi,%rsi
+  800ca9:	74 11                	je     800cbc <strnlen+0x1e>
+  800cab:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800caf:	74 0c                	je     800cbd <strnlen+0x1f>
+  800cb1:	48 83 c2 01          	add    $0x1,%rdx
+  800cb5:	48 39 d0             	cmp    %rdx,%rax
+  800cb8:	75 f1                	jne    800cab <strnlen+0xd>
+  800cba:	eb 04                	jmp    800cc0 <strnlen+0x22>
+  800cbc:	c3                   	ret
+  800cbd:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800cc0:	c3                   	ret
+
+0000000000800cc1 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800cc1:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800cc4:	ba 00 00 00 00       	mov    $0x0,%edx
+  800cc9:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800ccd:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800cd0:	48 83 c2 01          	add    $0x1,%rdx
+  800cd4:	84 c9                	test   %cl,%cl
+  800cd6:	75 f1                	jne    800cc9 <strcpy+0x8>
+        ;
+    return res;
+}
+  800cd8:	c3                   	ret
+
+0000000000800cd9 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800cd9:	55                   	push   %rbp
+  800cda:	48 89 e5             	mov    %rsp,%rbp
+  800cdd:	41 54                	push   %r12
+  800cdf:	53                   	push   %rbx
+  800ce0:	48 89 fb             	mov    %rdi,%rbx
+  800ce3:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800ce6:	48 b8 83 0c 80 00 00 	movabs $0x800c83,%rax
+  800ced:	00 00 00 
+  800cf0:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800cf2:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800cf6:	4c 89 e6             	mov    %r12,%rsi
+  800cf9:	48 b8 c1 0c 80 00 00 	movabs $0x800cc1,%rax
+  800d00:	00 00 00 
+  800d03:	ff d0                	call   *%rax
+    return dst;
+}
+  800d05:	48 89 d8             	mov    %rbx,%rax
+  800d08:	5b                   	pop    %rbx
+  800d09:	41 5c                	pop    %r12
+  800d0b:	5d                   	pop    %rbp
+  800d0c:	c3                   	ret
+
+0000000000800d0d <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800d0d:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800d10:	48 85 d2             	test   %rdx,%rdx
+  800d13:	74 1f                	je     800d34 <strncpy+0x27>
+  800d15:	48 01 fa             	add    %rdi,%rdx
+  800d18:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800d1b:	48 83 c1 01          	add    $0x1,%rcx
+  800d1f:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800d23:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800d27:	41 80 f8 01          	cmp    $0x1,%r8b
+  800d2b:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800d2f:	48 39 ca             	cmp    %rcx,%rdx
+  800d32:	75 e7                	jne    800d1b <strncpy+0xe>
+    }
+    return ret;
+}
+  800d34:	c3                   	ret
+
+0000000000800d35 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800d35:	48 89 f8             	mov    %rdi,%rax
+  800d38:	48 85 d2             	test   %rdx,%rdx
+  800d3b:	74 24                	je     800d61 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800d3d:	48 83 ea 01          	sub    $0x1,%rdx
+  800d41:	74 1b                	je     800d5e <strlcpy+0x29>
+  800d43:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800d47:	0f b6 16             	movzbl (%rsi),%edx
+  800d4a:	84 d2                	test   %dl,%dl
+  800d4c:	74 10                	je     800d5e <strlcpy+0x29>
+            *dst++ = *src++;
+  800d4e:	48 83 c6 01          	add    $0x1,%rsi
+  800d52:	48 83 c0 01          	add    $0x1,%rax
+  800d56:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800d59:	48 39 c8             	cmp    %rcx,%rax
+  800d5c:	75 e9                	jne    800d47 <strlcpy+0x12>
+        *dst = '\0';
+  800d5e:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800d61:	48 29 f8             	sub    %rdi,%rax
+}
+  800d64:	c3                   	ret
+
+0000000000800d65 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800d65:	0f b6 07             	movzbl (%rdi),%eax
+  800d68:	84 c0                	test   %al,%al
+  800d6a:	74 13                	je     800d7f <strcmp+0x1a>
+  800d6c:	38 06                	cmp    %al,(%rsi)
+  800d6e:	75 0f                	jne    800d7f <strcmp+0x1a>
+  800d70:	48 83 c7 01          	add    $0x1,%rdi
+  800d74:	48 83 c6 01          	add    $0x1,%rsi
+  800d78:	0f b6 07             	movzbl (%rdi),%eax
+  800d7b:	84 c0                	test   %al,%al
+  800d7d:	75 ed                	jne    800d6c <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800d7f:	0f b6 c0             	movzbl %al,%eax
+  800d82:	0f b6 16             	movzbl (%rsi),%edx
+  800d85:	29 d0                	sub    %edx,%eax
+}
+  800d87:	c3                   	ret
+
+0000000000800d88 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800d88:	48 85 d2             	test   %rdx,%rdx
+  800d8b:	74 1f                	je     800dac <strncmp+0x24>
+  800d8d:	0f b6 07             	movzbl (%rdi),%eax
+  800d90:	84 c0                	test   %al,%al
+  800d92:	74 1e                	je     800db2 <strncmp+0x2a>
+  800d94:	3a 06                	cmp    (%rsi),%al
+  800d96:	75 1a                	jne    800db2 <strncmp+0x2a>
+  800d98:	48 83 c7 01          	add    $0x1,%rdi
+  800d9c:	48 83 c6 01          	add    $0x1,%rsi
+  800da0:	48 83 ea 01          	sub    $0x1,%rdx
+  800da4:	75 e7                	jne    800d8d <strncmp+0x5>
+
+    if (!n) return 0;
+  800da6:	b8 00 00 00 00       	mov    $0x0,%eax
+  800dab:	c3                   	ret
+  800dac:	b8 00 00 00 00       	mov    $0x0,%eax
+  800db1:	c3                   	ret
+  800db2:	48 85 d2             	test   %rdx,%rdx
+  800db5:	74 09                	je     800dc0 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800db7:	0f b6 07             	movzbl (%rdi),%eax
+  800dba:	0f b6 16             	movzbl (%rsi),%edx
+  800dbd:	29 d0                	sub    %edx,%eax
+  800dbf:	c3                   	ret
+    if (!n) return 0;
+  800dc0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800dc5:	c3                   	ret
+
+0000000000800dc6 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800dc6:	0f b6 17             	movzbl (%rdi),%edx
+  800dc9:	84 d2                	test   %dl,%dl
+  800dcb:	74 18                	je     800de5 <strchr+0x1f>
+        if (*str == c) {
+  800dcd:	0f be d2             	movsbl %dl,%edx
+  800dd0:	39 f2                	cmp    %esi,%edx
+  800dd2:	74 17                	je     800deb <strchr+0x25>
+    for (; *str; str++) {
+  800dd4:	48 83 c7 01          	add    $0x1,%rdi
+  800dd8:	0f b6 17             	movzbl (%rdi),%edx
+  800ddb:	84 d2                	test   %dl,%dl
+  800ddd:	75 ee                	jne    800dcd <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800ddf:	b8 00 00 00 00       	mov    $0x0,%eax
+  800de4:	c3                   	ret
+  800de5:	b8 00 00 00 00       	mov    $0x0,%eax
+  800dea:	c3                   	ret
+  800deb:	48 89 f8             	mov    %rdi,%rax
+}
+  800dee:	c3                   	ret
+
+0000000000800def <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800def:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800df2:	0f b6 17             	movzbl (%rdi),%edx
+  800df5:	84 d2                	test   %dl,%dl
+  800df7:	74 13                	je     800e0c <strfind+0x1d>
+  800df9:	0f be d2             	movsbl %dl,%edx
+  800dfc:	39 f2                	cmp    %esi,%edx
+  800dfe:	74 0b                	je     800e0b <strfind+0x1c>
+  800e00:	48 83 c0 01          	add    $0x1,%rax
+  800e04:	0f b6 10             	movzbl (%rax),%edx
+  800e07:	84 d2                	test   %dl,%dl
+  800e09:	75 ee                	jne    800df9 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800e0b:	c3                   	ret
+  800e0c:	c3                   	ret
+
+0000000000800e0d <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800e0d:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800e10:	48 89 f8             	mov    %rdi,%rax
+  800e13:	48 f7 d8             	neg    %rax
+  800e16:	83 e0 07             	and    $0x7,%eax
+  800e19:	49 89 d1             	mov    %rdx,%r9
+  800e1c:	49 29 c1             	sub    %rax,%r9
+  800e1f:	78 36                	js     800e57 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800e21:	40 0f b6 c6          	movzbl %sil,%eax
+  800e25:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800e2c:	01 01 01 
+  800e2f:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800e33:	40 f6 c7 07          	test   $0x7,%dil
+  800e37:	75 38                	jne    800e71 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800e39:	4c 89 c9             	mov    %r9,%rcx
+  800e3c:	48 c1 f9 03          	sar    $0x3,%rcx
+  800e40:	74 0c                	je     800e4e <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800e42:	fc                   	cld
+  800e43:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800e46:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800e4a:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800e4e:	4d 85 c9             	test   %r9,%r9
+  800e51:	75 45                	jne    800e98 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800e53:	4c 89 c0             	mov    %r8,%rax
+  800e56:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800e57:	48 85 d2             	test   %rdx,%rdx
+  800e5a:	74 f7                	je     800e53 <memset+0x46>
+  800e5c:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800e5f:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800e62:	48 83 c0 01          	add    $0x1,%rax
+  800e66:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  800e6a:	48 39 c2             	cmp    %rax,%rdx
+  800e6d:	75 f3                	jne    800e62 <memset+0x55>
+  800e6f:	eb e2                	jmp    800e53 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  800e71:	40 f6 c7 01          	test   $0x1,%dil
+  800e75:	74 06                	je     800e7d <memset+0x70>
+  800e77:	88 07                	mov    %al,(%rdi)
+  800e79:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800e7d:	40 f6 c7 02          	test   $0x2,%dil
+  800e81:	74 07                	je     800e8a <memset+0x7d>
+  800e83:	66 89 07             	mov    %ax,(%rdi)
+  800e86:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800e8a:	40 f6 c7 04          	test   $0x4,%dil
+  800e8e:	74 a9                	je     800e39 <memset+0x2c>
+  800e90:	89 07                	mov    %eax,(%rdi)
+  800e92:	48 83 c7 04          	add    $0x4,%rdi
+  800e96:	eb a1                	jmp    800e39 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800e98:	41 f6 c1 04          	test   $0x4,%r9b
+  800e9c:	74 06                	je     800ea4 <memset+0x97>
+  800e9e:	89 07                	mov    %eax,(%rdi)
+  800ea0:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800ea4:	41 f6 c1 02          	test   $0x2,%r9b
+  800ea8:	74 07                	je     800eb1 <memset+0xa4>
+  800eaa:	66 89 07             	mov    %ax,(%rdi)
+  800ead:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  800eb1:	41 f6 c1 01          	test   $0x1,%r9b
+  800eb5:	74 9c                	je     800e53 <memset+0x46>
+  800eb7:	88 07                	mov    %al,(%rdi)
+  800eb9:	eb 98                	jmp    800e53 <memset+0x46>
+
+0000000000800ebb <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  800ebb:	48 89 f8             	mov    %rdi,%rax
+  800ebe:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  800ec1:	48 39 fe             	cmp    %rdi,%rsi
+  800ec4:	73 3b                	jae    800f01 <memmove+0x46>
+  800ec6:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  800eca:	48 39 d7             	cmp    %rdx,%rdi
+  800ecd:	73 32                	jae    800f01 <memmove+0x46>
+        s += n;
+        d += n;
+  800ecf:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800ed3:	48 89 d6             	mov    %rdx,%rsi
+  800ed6:	48 09 fe             	or     %rdi,%rsi
+  800ed9:	48 09 ce             	or     %rcx,%rsi
+  800edc:	40 f6 c6 07          	test   $0x7,%sil
+  800ee0:	75 12                	jne    800ef4 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  800ee2:	48 83 ef 08          	sub    $0x8,%rdi
+  800ee6:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  800eea:	48 c1 e9 03          	shr    $0x3,%rcx
+  800eee:	fd                   	std
+  800eef:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  800ef2:	fc                   	cld
+  800ef3:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  800ef4:	48 83 ef 01          	sub    $0x1,%rdi
+  800ef8:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  800efc:	fd                   	std
+  800efd:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  800eff:	eb f1                	jmp    800ef2 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800f01:	48 89 f2             	mov    %rsi,%rdx
+  800f04:	48 09 c2             	or     %rax,%rdx
+  800f07:	48 09 ca             	or     %rcx,%rdx
+  800f0a:	f6 c2 07             	test   $0x7,%dl
+  800f0d:	75 0c                	jne    800f1b <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  800f0f:	48 c1 e9 03          	shr    $0x3,%rcx
+  800f13:	48 89 c7             	mov    %rax,%rdi
+  800f16:	fc                   	cld
+  800f17:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  800f1a:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  800f1b:	48 89 c7             	mov    %rax,%rdi
+  800f1e:	fc                   	cld
+  800f1f:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  800f21:	c3                   	ret
+
+0000000000800f22 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  800f22:	55                   	push   %rbp
+  800f23:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  800f26:	48 b8 bb 0e 80 00 00 	movabs $0x800ebb,%rax
+  800f2d:	00 00 00 
+  800f30:	ff d0                	call   *%rax
+}
+  800f32:	5d                   	pop    %rbp
+  800f33:	c3                   	ret
+
+0000000000800f34 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  800f34:	55                   	push   %rbp
+  800f35:	48 89 e5             	mov    %rsp,%rbp
+  800f38:	41 57                	push   %r15
+  800f3a:	41 56                	push   %r14
+  800f3c:	41 55                	push   %r13
+  800f3e:	41 54                	push   %r12
+  800f40:	53                   	push   %rbx
+  800f41:	48 83 ec 08          	sub    $0x8,%rsp
+  800f45:	49 89 fe             	mov    %rdi,%r14
+  800f48:	49 89 f7             	mov    %rsi,%r15
+  800f4b:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  800f4e:	48 89 f7             	mov    %rsi,%rdi
+  800f51:	48 b8 83 0c 80 00 00 	movabs $0x800c83,%rax
+  800f58:	00 00 00 
+  800f5b:	ff d0                	call   *%rax
+  800f5d:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  800f60:	48 89 de             	mov    %rbx,%rsi
+  800f63:	4c 89 f7             	mov    %r14,%rdi
+  800f66:	48 b8 9e 0c 80 00 00 	movabs $0x800c9e,%rax
+  800f6d:	00 00 00 
+  800f70:	ff d0                	call   *%rax
+  800f72:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  800f75:	48 39 c3             	cmp    %rax,%rbx
+  800f78:	74 36                	je     800fb0 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  800f7a:	48 89 d8             	mov    %rbx,%rax
+  800f7d:	4c 29 e8             	sub    %r13,%rax
+  800f80:	49 39 c4             	cmp    %rax,%r12
+  800f83:	73 31                	jae    800fb6 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  800f85:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  800f8a:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800f8e:	4c 89 fe             	mov    %r15,%rsi
+  800f91:	48 b8 22 0f 80 00 00 	movabs $0x800f22,%rax
+  800f98:	00 00 00 
+  800f9b:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  800f9d:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  800fa1:	48 83 c4 08          	add    $0x8,%rsp
+  800fa5:	5b                   	pop    %rbx
+  800fa6:	41 5c                	pop    %r12
+  800fa8:	41 5d                	pop    %r13
+  800faa:	41 5e                	pop    %r14
+  800fac:	41 5f                	pop    %r15
+  800fae:	5d                   	pop    %rbp
+  800faf:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  800fb0:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800fb4:	eb eb                	jmp    800fa1 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  800fb6:	48 83 eb 01          	sub    $0x1,%rbx
+  800fba:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800fbe:	48 89 da             	mov    %rbx,%rdx
+  800fc1:	4c 89 fe             	mov    %r15,%rsi
+  800fc4:	48 b8 22 0f 80 00 00 	movabs $0x800f22,%rax
+  800fcb:	00 00 00 
+  800fce:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  800fd0:	49 01 de             	add    %rbx,%r14
+  800fd3:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  800fd8:	eb c3                	jmp    800f9d <strlcat+0x69>
+
+0000000000800fda <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  800fda:	48 85 d2             	test   %rdx,%rdx
+  800fdd:	74 2d                	je     80100c <memcmp+0x32>
+  800fdf:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  800fe4:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800fe8:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  800fed:	44 38 c1             	cmp    %r8b,%cl
+  800ff0:	75 0f                	jne    801001 <memcmp+0x27>
+    while (n-- > 0) {
+  800ff2:	48 83 c0 01          	add    $0x1,%rax
+  800ff6:	48 39 c2             	cmp    %rax,%rdx
+  800ff9:	75 e9                	jne    800fe4 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  800ffb:	b8 00 00 00 00       	mov    $0x0,%eax
+  801000:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  801001:	0f b6 c1             	movzbl %cl,%eax
+  801004:	45 0f b6 c0          	movzbl %r8b,%r8d
+  801008:	44 29 c0             	sub    %r8d,%eax
+  80100b:	c3                   	ret
+    return 0;
+  80100c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801011:	c3                   	ret
+
+0000000000801012 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  801012:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  801016:	48 39 c7             	cmp    %rax,%rdi
+  801019:	73 0f                	jae    80102a <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  80101b:	40 38 37             	cmp    %sil,(%rdi)
+  80101e:	74 0e                	je     80102e <memfind+0x1c>
+    for (; src < end; src++) {
+  801020:	48 83 c7 01          	add    $0x1,%rdi
+  801024:	48 39 f8             	cmp    %rdi,%rax
+  801027:	75 f2                	jne    80101b <memfind+0x9>
+  801029:	c3                   	ret
+  80102a:	48 89 f8             	mov    %rdi,%rax
+  80102d:	c3                   	ret
+  80102e:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  801031:	c3                   	ret
+
+0000000000801032 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  801032:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  801035:	0f b6 37             	movzbl (%rdi),%esi
+  801038:	40 80 fe 20          	cmp    $0x20,%sil
+  80103c:	74 06                	je     801044 <strtol+0x12>
+  80103e:	40 80 fe 09          	cmp    $0x9,%sil
+  801042:	75 13                	jne    801057 <strtol+0x25>
+  801044:	48 83 c7 01          	add    $0x1,%rdi
+  801048:	0f b6 37             	movzbl (%rdi),%esi
+  80104b:	40 80 fe 20          	cmp    $0x20,%sil
+  80104f:	74 f3                	je     801044 <strtol+0x12>
+  801051:	40 80 fe 09          	cmp    $0x9,%sil
+  801055:	74 ed                	je     801044 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  801057:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  80105a:	83 e0 fd             	and    $0xfffffffd,%eax
+  80105d:	3c 01                	cmp    $0x1,%al
+  80105f:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801063:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  801069:	75 0f                	jne    80107a <strtol+0x48>
+  80106b:	80 3f 30             	cmpb   $0x30,(%rdi)
+  80106e:	74 14                	je     801084 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  801070:	85 d2                	test   %edx,%edx
+  801072:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801077:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  80107a:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  80107f:	4c 63 ca             	movslq %edx,%r9
+  801082:	eb 36                	jmp    8010ba <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801084:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  801088:	74 0f                	je     801099 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  80108a:	85 d2                	test   %edx,%edx
+  80108c:	75 ec                	jne    80107a <strtol+0x48>
+        s++;
+  80108e:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  801092:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  801097:	eb e1                	jmp    80107a <strtol+0x48>
+        s += 2;
+  801099:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  80109d:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  8010a2:	eb d6                	jmp    80107a <strtol+0x48>
+            dig -= '0';
+  8010a4:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  8010a7:	44 0f b6 c1          	movzbl %cl,%r8d
+  8010ab:	41 39 d0             	cmp    %edx,%r8d
+  8010ae:	7d 21                	jge    8010d1 <strtol+0x9f>
+        val = val * base + dig;
+  8010b0:	49 0f af c1          	imul   %r9,%rax
+  8010b4:	0f b6 c9             	movzbl %cl,%ecx
+  8010b7:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  8010ba:	48 83 c7 01          	add    $0x1,%rdi
+  8010be:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  8010c2:	80 f9 39             	cmp    $0x39,%cl
+  8010c5:	76 dd                	jbe    8010a4 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  8010c7:	80 f9 7b             	cmp    $0x7b,%cl
+  8010ca:	77 05                	ja     8010d1 <strtol+0x9f>
+            dig -= 'a' - 10;
+  8010cc:	83 e9 57             	sub    $0x57,%ecx
+  8010cf:	eb d6                	jmp    8010a7 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  8010d1:	4d 85 d2             	test   %r10,%r10
+  8010d4:	74 03                	je     8010d9 <strtol+0xa7>
+  8010d6:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  8010d9:	48 89 c2             	mov    %rax,%rdx
+  8010dc:	48 f7 da             	neg    %rdx
+  8010df:	40 80 fe 2d          	cmp    $0x2d,%sil
+  8010e3:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  8010e7:	c3                   	ret
+
+00000000008010e8 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  8010e8:	55                   	push   %rbp
+  8010e9:	48 89 e5             	mov    %rsp,%rbp
+  8010ec:	53                   	push   %rbx
+  8010ed:	48 89 fa             	mov    %rdi,%rdx
+  8010f0:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8010f3:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8010f8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010fd:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801102:	be 00 00 00 00       	mov    $0x0,%esi
+  801107:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80110d:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  80110f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801113:	c9                   	leave
+  801114:	c3                   	ret
+
+0000000000801115 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  801115:	55                   	push   %rbp
+  801116:	48 89 e5             	mov    %rsp,%rbp
+  801119:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80111a:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80111f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801124:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801129:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80112e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801133:	be 00 00 00 00       	mov    $0x0,%esi
+  801138:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80113e:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  801140:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801144:	c9                   	leave
+  801145:	c3                   	ret
+
+0000000000801146 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  801146:	55                   	push   %rbp
+  801147:	48 89 e5             	mov    %rsp,%rbp
+  80114a:	53                   	push   %rbx
+  80114b:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  80114f:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801152:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801157:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80115c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801161:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801166:	be 00 00 00 00       	mov    $0x0,%esi
+  80116b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801171:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801173:	48 85 c0             	test   %rax,%rax
+  801176:	7f 06                	jg     80117e <sys_env_destroy+0x38>
+}
+  801178:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80117c:	c9                   	leave
+  80117d:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80117e:	49 89 c0             	mov    %rax,%r8
+  801181:	b9 03 00 00 00       	mov    $0x3,%ecx
+  801186:	48 ba b0 33 80 00 00 	movabs $0x8033b0,%rdx
+  80118d:	00 00 00 
+  801190:	be 26 00 00 00       	mov    $0x26,%esi
+  801195:	48 bf cf 33 80 00 00 	movabs $0x8033cf,%rdi
+  80119c:	00 00 00 
+  80119f:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011a4:	49 b9 4c 02 80 00 00 	movabs $0x80024c,%r9
+  8011ab:	00 00 00 
+  8011ae:	41 ff d1             	call   *%r9
+
+00000000008011b1 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  8011b1:	55                   	push   %rbp
+  8011b2:	48 89 e5             	mov    %rsp,%rbp
+  8011b5:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8011b6:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8011bb:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011c0:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8011c5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011ca:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8011cf:	be 00 00 00 00       	mov    $0x0,%esi
+  8011d4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8011da:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  8011dc:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8011e0:	c9                   	leave
+  8011e1:	c3                   	ret
+
+00000000008011e2 <sys_yield>:
+
+void
+sys_yield(void) {
+  8011e2:	55                   	push   %rbp
+  8011e3:	48 89 e5             	mov    %rsp,%rbp
+  8011e6:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8011e7:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8011ec:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011f1:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8011f6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011fb:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801200:	be 00 00 00 00       	mov    $0x0,%esi
+  801205:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80120b:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  80120d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801211:	c9                   	leave
+  801212:	c3                   	ret
+
+0000000000801213 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  801213:	55                   	push   %rbp
+  801214:	48 89 e5             	mov    %rsp,%rbp
+  801217:	53                   	push   %rbx
+  801218:	48 89 fa             	mov    %rdi,%rdx
+  80121b:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80121e:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801223:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  80122a:	00 00 00 
+  80122d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801232:	be 00 00 00 00       	mov    $0x0,%esi
+  801237:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80123d:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  80123f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801243:	c9                   	leave
+  801244:	c3                   	ret
+
+0000000000801245 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  801245:	55                   	push   %rbp
+  801246:	48 89 e5             	mov    %rsp,%rbp
+  801249:	53                   	push   %rbx
+  80124a:	49 89 f8             	mov    %rdi,%r8
+  80124d:	48 89 d3             	mov    %rdx,%rbx
+  801250:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801253:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801258:	4c 89 c2             	mov    %r8,%rdx
+  80125b:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80125e:	be 00 00 00 00       	mov    $0x0,%esi
+  801263:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801269:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  80126b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80126f:	c9                   	leave
+  801270:	c3                   	ret
+
+0000000000801271 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  801271:	55                   	push   %rbp
+  801272:	48 89 e5             	mov    %rsp,%rbp
+  801275:	53                   	push   %rbx
+  801276:	48 83 ec 08          	sub    $0x8,%rsp
+  80127a:	89 f8                	mov    %edi,%eax
+  80127c:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  80127f:	48 63 f9             	movslq %ecx,%rdi
+  801282:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801285:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80128a:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80128d:	be 00 00 00 00       	mov    $0x0,%esi
+  801292:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801298:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80129a:	48 85 c0             	test   %rax,%rax
+  80129d:	7f 06                	jg     8012a5 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  80129f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012a3:	c9                   	leave
+  8012a4:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8012a5:	49 89 c0             	mov    %rax,%r8
+  8012a8:	b9 04 00 00 00       	mov    $0x4,%ecx
+  8012ad:	48 ba b0 33 80 00 00 	movabs $0x8033b0,%rdx
+  8012b4:	00 00 00 
+  8012b7:	be 26 00 00 00       	mov    $0x26,%esi
+  8012bc:	48 bf cf 33 80 00 00 	movabs $0x8033cf,%rdi
+  8012c3:	00 00 00 
+  8012c6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012cb:	49 b9 4c 02 80 00 00 	movabs $0x80024c,%r9
+  8012d2:	00 00 00 
+  8012d5:	41 ff d1             	call   *%r9
+
+00000000008012d8 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8012d8:	55                   	push   %rbp
+  8012d9:	48 89 e5             	mov    %rsp,%rbp
+  8012dc:	53                   	push   %rbx
+  8012dd:	48 83 ec 08          	sub    $0x8,%rsp
+  8012e1:	89 f8                	mov    %edi,%eax
+  8012e3:	49 89 f2             	mov    %rsi,%r10
+  8012e6:	48 89 cf             	mov    %rcx,%rdi
+  8012e9:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  8012ec:	48 63 da             	movslq %edx,%rbx
+  8012ef:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8012f2:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8012f7:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012fa:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  8012fd:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8012ff:	48 85 c0             	test   %rax,%rax
+  801302:	7f 06                	jg     80130a <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  801304:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801308:	c9                   	leave
+  801309:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80130a:	49 89 c0             	mov    %rax,%r8
+  80130d:	b9 05 00 00 00       	mov    $0x5,%ecx
+  801312:	48 ba b0 33 80 00 00 	movabs $0x8033b0,%rdx
+  801319:	00 00 00 
+  80131c:	be 26 00 00 00       	mov    $0x26,%esi
+  801321:	48 bf cf 33 80 00 00 	movabs $0x8033cf,%rdi
+  801328:	00 00 00 
+  80132b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801330:	49 b9 4c 02 80 00 00 	movabs $0x80024c,%r9
+  801337:	00 00 00 
+  80133a:	41 ff d1             	call   *%r9
+
+000000000080133d <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  80133d:	55                   	push   %rbp
+  80133e:	48 89 e5             	mov    %rsp,%rbp
+  801341:	53                   	push   %rbx
+  801342:	48 83 ec 08          	sub    $0x8,%rsp
+  801346:	48 89 f1             	mov    %rsi,%rcx
+  801349:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  80134c:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80134f:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801354:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801359:	be 00 00 00 00       	mov    $0x0,%esi
+  80135e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801364:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801366:	48 85 c0             	test   %rax,%rax
+  801369:	7f 06                	jg     801371 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  80136b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80136f:	c9                   	leave
+  801370:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801371:	49 89 c0             	mov    %rax,%r8
+  801374:	b9 06 00 00 00       	mov    $0x6,%ecx
+  801379:	48 ba b0 33 80 00 00 	movabs $0x8033b0,%rdx
+  801380:	00 00 00 
+  801383:	be 26 00 00 00       	mov    $0x26,%esi
+  801388:	48 bf cf 33 80 00 00 	movabs $0x8033cf,%rdi
+  80138f:	00 00 00 
+  801392:	b8 00 00 00 00       	mov    $0x0,%eax
+  801397:	49 b9 4c 02 80 00 00 	movabs $0x80024c,%r9
+  80139e:	00 00 00 
+  8013a1:	41 ff d1             	call   *%r9
+
+00000000008013a4 <sys_region_batch>:
+
+int
+sys_region_batch(const struct RegionOp *ops, size_t count) {
+  8013a4:	55                   	push   %rbp
+  8013a5:	48 89 e5             	mov    %rsp,%rbp
+  8013a8:	53                   	push   %rbx
+  8013a9:	48 83 ec 08          	sub    $0x8,%rsp
+  8013ad:	48 89 fa             	mov    %rdi,%rdx
+  8013b0:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8013b3:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8013b8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013bd:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013c2:	be 00 00 00 00       	mov    $0x0,%esi
+  8013c7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013cd:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8013cf:	48 85 c0             	test   %rax,%rax
+  8013d2:	7f 06                	jg     8013da <sys_region_batch+0x36>
+        else
+            platform_asan_unpoison(va, ops[i].size);
+    }
+#endif
+    return res;
+}
+  8013d4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013d8:	c9                   	leave
+  8013d9:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8013da:	49 89 c0             	mov    %rax,%r8
+  8013dd:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  8013e2:	48 ba b0 33 80 00 00 	movabs $0x8033b0,%rdx
+  8013e9:	00 00 00 
+  8013ec:	be 26 00 00 00       	mov    $0x26,%esi
+  8013f1:	48 bf cf 33 80 00 00 	movabs $0x8033cf,%rdi
+  8013f8:	00 00 00 
+  8013fb:	b8 00 00 00 00       	mov    $0x0,%eax
+  801400:	49 b9 4c 02 80 00 00 	movabs $0x80024c,%r9
+  801407:	00 00 00 
+  80140a:	41 ff d1             	call   *%r9
+
+000000000080140d <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  80140d:	55                   	push   %rbp
+  80140e:	48 89 e5             	mov    %rsp,%rbp
+  801411:	53                   	push   %rbx
+  801412:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  801416:	48 63 ce             	movslq %esi,%rcx
+  801419:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80141c:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801421:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801426:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80142b:	be 00 00 00 00       	mov    $0x0,%esi
+  801430:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801436:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801438:	48 85 c0             	test   %rax,%rax
+  80143b:	7f 06                	jg     801443 <sys_env_set_status+0x36>
+}
+  80143d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801441:	c9                   	leave
+  801442:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801443:	49 89 c0             	mov    %rax,%r8
+  801446:	b9 09 00 00 00       	mov    $0x9,%ecx
+  80144b:	48 ba b0 33 80 00 00 	movabs $0x8033b0,%rdx
+  801452:	00 00 00 
+  801455:	be 26 00 00 00       	mov    $0x26,%esi
+  80145a:	48 bf cf 33 80 00 00 	movabs $0x8033cf,%rdi
+  801461:	00 00 00 
+  801464:	b8 00 00 00 00       	mov    $0x0,%eax
+  801469:	49 b9 4c 02 80 00 00 	movabs $0x80024c,%r9
+  801470:	00 00 00 
+  801473:	41 ff d1             	call   *%r9
+
+0000000000801476 <sys_env_set_weight>:
+
+int
+sys_env_set_weight(envid_t envid, uint32_t weight) {
+  801476:	55                   	push   %rbp
+  801477:	48 89 e5             	mov    %rsp,%rbp
+  80147a:	53                   	push   %rbx
+  80147b:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_weight, 1, envid, weight, 0, 0, 0, 0);
+  80147f:	89 f1                	mov    %esi,%ecx
+  801481:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801484:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801489:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80148e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801493:	be 00 00 00 00       	mov    $0x0,%esi
+  801498:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80149e:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8014a0:	48 85 c0             	test   %rax,%rax
+  8014a3:	7f 06                	jg     8014ab <sys_env_set_weight+0x35>
+}
+  8014a5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014a9:	c9                   	leave
+  8014aa:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8014ab:	49 89 c0             	mov    %rax,%r8
+  8014ae:	b9 10 00 00 00       	mov    $0x10,%ecx
+  8014b3:	48 ba b0 33 80 00 00 	movabs $0x8033b0,%rdx
+  8014ba:	00 00 00 
+  8014bd:	be 26 00 00 00       	mov    $0x26,%esi
+  8014c2:	48 bf cf 33 80 00 00 	movabs $0x8033cf,%rdi
+  8014c9:	00 00 00 
+  8014cc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014d1:	49 b9 4c 02 80 00 00 	movabs $0x80024c,%r9
+  8014d8:	00 00 00 
+  8014db:	41 ff d1             	call   *%r9
+
+00000000008014de <sys_env_set_rt>:
+
+int
+sys_env_set_rt(envid_t envid, uint64_t period, uint64_t budget, uint64_t deadline) {
+  8014de:	55                   	push   %rbp
+  8014df:	48 89 e5             	mov    %rsp,%rbp
+  8014e2:	53                   	push   %rbx
+  8014e3:	48 83 ec 08          	sub    $0x8,%rsp
+  8014e7:	89 f8                	mov    %edi,%eax
+  8014e9:	48 89 d3             	mov    %rdx,%rbx
+  8014ec:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_env_set_rt, 1, envid, period, budget, deadline, 0, 0);
+  8014ef:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8014f2:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8014f7:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014fa:	be 00 00 00 00       	mov    $0x0,%esi
+  8014ff:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801505:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801507:	48 85 c0             	test   %rax,%rax
+  80150a:	7f 06                	jg     801512 <sys_env_set_rt+0x34>
+}
+  80150c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801510:	c9                   	leave
+  801511:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801512:	49 89 c0             	mov    %rax,%r8
+  801515:	b9 11 00 00 00       	mov    $0x11,%ecx
+  80151a:	48 ba b0 33 80 00 00 	movabs $0x8033b0,%rdx
+  801521:	00 00 00 
+  801524:	be 26 00 00 00       	mov    $0x26,%esi
+  801529:	48 bf cf 33 80 00 00 	movabs $0x8033cf,%rdi
+  801530:	00 00 00 
+  801533:	b8 00 00 00 00       	mov    $0x0,%eax
+  801538:	49 b9 4c 02 80 00 00 	movabs $0x80024c,%r9
+  80153f:	00 00 00 
+  801542:	41 ff d1             	call   *%r9
+
+0000000000801545 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  801545:	55                   	push   %rbp
+  801546:	48 89 e5             	mov    %rsp,%rbp
+  801549:	53                   	push   %rbx
+  80154a:	48 83 ec 08          	sub    $0x8,%rsp
+  80154e:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  801551:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801554:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801559:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80155e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801563:	be 00 00 00 00       	mov    $0x0,%esi
+  801568:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80156e:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801570:	48 85 c0             	test   %rax,%rax
+  801573:	7f 06                	jg     80157b <sys_env_set_trapframe+0x36>
+}
+  801575:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801579:	c9                   	leave
+  80157a:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80157b:	49 89 c0             	mov    %rax,%r8
+  80157e:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  801583:	48 ba b0 33 80 00 00 	movabs $0x8033b0,%rdx
+  80158a:	00 00 00 
+  80158d:	be 26 00 00 00       	mov    $0x26,%esi
+  801592:	48 bf cf 33 80 00 00 	movabs $0x8033cf,%rdi
+  801599:	00 00 00 
+  80159c:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015a1:	49 b9 4c 02 80 00 00 	movabs $0x80024c,%r9
+  8015a8:	00 00 00 
+  8015ab:	41 ff d1             	call   *%r9
+
+00000000008015ae <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  8015ae:	55                   	push   %rbp
+  8015af:	48 89 e5             	mov    %rsp,%rbp
+  8015b2:	53                   	push   %rbx
+  8015b3:	48 83 ec 08          	sub    $0x8,%rsp
+  8015b7:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  8015ba:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8015bd:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8015c2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015c7:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015cc:	be 00 00 00 00       	mov    $0x0,%esi
+  8015d1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015d7:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8015d9:	48 85 c0             	test   %rax,%rax
+  8015dc:	7f 06                	jg     8015e4 <sys_env_set_pgfault_upcall+0x36>
+}
+  8015de:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015e2:	c9                   	leave
+  8015e3:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8015e4:	49 89 c0             	mov    %rax,%r8
+  8015e7:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  8015ec:	48 ba b0 33 80 00 00 	movabs $0x8033b0,%rdx
+  8015f3:	00 00 00 
+  8015f6:	be 26 00 00 00       	mov    $0x26,%esi
+  8015fb:	48 bf cf 33 80 00 00 	movabs $0x8033cf,%rdi
+  801602:	00 00 00 
+  801605:	b8 00 00 00 00       	mov    $0x0,%eax
+  80160a:	49 b9 4c 02 80 00 00 	movabs $0x80024c,%r9
+  801611:	00 00 00 
+  801614:	41 ff d1             	call   *%r9
+
+0000000000801617 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  801617:	55                   	push   %rbp
+  801618:	48 89 e5             	mov    %rsp,%rbp
+  80161b:	53                   	push   %rbx
+  80161c:	89 f8                	mov    %edi,%eax
+  80161e:	49 89 f1             	mov    %rsi,%r9
+  801621:	48 89 d3             	mov    %rdx,%rbx
+  801624:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  801627:	49 63 f0             	movslq %r8d,%rsi
+  80162a:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80162d:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801632:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801635:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80163b:	cd 30                	int    $0x30
+}
+  80163d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801641:	c9                   	leave
+  801642:	c3                   	ret
+
+0000000000801643 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  801643:	55                   	push   %rbp
+  801644:	48 89 e5             	mov    %rsp,%rbp
+  801647:	53                   	push   %rbx
+  801648:	48 83 ec 08          	sub    $0x8,%rsp
+  80164c:	48 89 fa             	mov    %rdi,%rdx
+  80164f:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801652:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801657:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80165c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801661:	be 00 00 00 00       	mov    $0x0,%esi
+  801666:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80166c:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80166e:	48 85 c0             	test   %rax,%rax
+  801671:	7f 06                	jg     801679 <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801673:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801677:	c9                   	leave
+  801678:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801679:	49 89 c0             	mov    %rax,%r8
+  80167c:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  801681:	48 ba b0 33 80 00 00 	movabs $0x8033b0,%rdx
+  801688:	00 00 00 
+  80168b:	be 26 00 00 00       	mov    $0x26,%esi
+  801690:	48 bf cf 33 80 00 00 	movabs $0x8033cf,%rdi
+  801697:	00 00 00 
+  80169a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80169f:	49 b9 4c 02 80 00 00 	movabs $0x80024c,%r9
+  8016a6:	00 00 00 
+  8016a9:	41 ff d1             	call   *%r9
+
+00000000008016ac <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8016ac:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8016b3:	ff ff ff 
+  8016b6:	48 01 f8             	add    %rdi,%rax
+  8016b9:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  8016bd:	c3                   	ret
+
+00000000008016be <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8016be:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8016c5:	ff ff ff 
+  8016c8:	48 01 f8             	add    %rdi,%rax
+  8016cb:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  8016cf:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  8016d5:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  8016d9:	c3                   	ret
+
+00000000008016da <fd_alloc_from>:
+}
+
+/* Like fd_alloc(), but only considers fds starting from fdnum,
+ * so that several fds can be found before their pages are allocated */
+int
+fd_alloc_from(int fdnum, struct Fd **fd_store) {
+  8016da:	55                   	push   %rbp
+  8016db:	48 89 e5             	mov    %rsp,%rbp
+  8016de:	41 57                	push   %r15
+  8016e0:	41 56                	push   %r14
+  8016e2:	41 55                	push   %r13
+  8016e4:	41 54                	push   %r12
+  8016e6:	53                   	push   %rbx
+  8016e7:	48 83 ec 08          	sub    $0x8,%rsp
+  8016eb:	49 89 f7             	mov    %rsi,%r15
+    for (int i = MAX(fdnum, 0); i < MAXFD; i++) {
+  8016ee:	85 ff                	test   %edi,%edi
+  8016f0:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8016f6:	44 0f 49 e7          	cmovns %edi,%r12d
+  8016fa:	83 ff 1f             	cmp    $0x1f,%edi
+  8016fd:	7f 37                	jg     801736 <fd_alloc_from+0x5c>
+  8016ff:	49 63 dc             	movslq %r12d,%rbx
+  801702:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  801709:	48 c1 e3 0c          	shl    $0xc,%rbx
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  80170d:	49 be e3 27 80 00 00 	movabs $0x8027e3,%r14
+  801714:	00 00 00 
+        struct Fd *fd = INDEX2FD(i);
+  801717:	49 89 dd             	mov    %rbx,%r13
+        if (!(get_prot(fd) & PROT_R)) {
+  80171a:	48 89 df             	mov    %rbx,%rdi
+  80171d:	41 ff d6             	call   *%r14
+  801720:	83 e0 04             	and    $0x4,%eax
+  801723:	74 1c                	je     801741 <fd_alloc_from+0x67>
+    for (int i = MAX(fdnum, 0); i < MAXFD; i++) {
+  801725:	41 83 c4 01          	add    $0x1,%r12d
+  801729:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801730:	41 83 fc 1f          	cmp    $0x1f,%r12d
+  801734:	7e e1                	jle    801717 <fd_alloc_from+0x3d>
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  801736:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  80173c:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  801741:	4d 89 2f             	mov    %r13,(%r15)
+}
+  801744:	48 83 c4 08          	add    $0x8,%rsp
+  801748:	5b                   	pop    %rbx
+  801749:	41 5c                	pop    %r12
+  80174b:	41 5d                	pop    %r13
+  80174d:	41 5e                	pop    %r14
+  80174f:	41 5f                	pop    %r15
+  801751:	5d                   	pop    %rbp
+  801752:	c3                   	ret
+
+0000000000801753 <fd_alloc>:
+fd_alloc(struct Fd **fd_store) {
+  801753:	55                   	push   %rbp
+  801754:	48 89 e5             	mov    %rsp,%rbp
+  801757:	48 89 fe             	mov    %rdi,%rsi
+    return fd_alloc_from(0, fd_store);
+  80175a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80175f:	48 b8 da 16 80 00 00 	movabs $0x8016da,%rax
+  801766:	00 00 00 
+  801769:	ff d0                	call   *%rax
+}
+  80176b:	5d                   	pop    %rbp
+  80176c:	c3                   	ret
+
+000000000080176d <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  80176d:	83 ff 1f             	cmp    $0x1f,%edi
+  801770:	77 39                	ja     8017ab <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  801772:	55                   	push   %rbp
+  801773:	48 89 e5             	mov    %rsp,%rbp
+  801776:	41 54                	push   %r12
+  801778:	53                   	push   %rbx
+  801779:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  80177c:	48 63 df             	movslq %edi,%rbx
+  80177f:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  801786:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  80178a:	48 89 df             	mov    %rbx,%rdi
+  80178d:	48 b8 e3 27 80 00 00 	movabs $0x8027e3,%rax
+  801794:	00 00 00 
+  801797:	ff d0                	call   *%rax
+  801799:	a8 04                	test   $0x4,%al
+  80179b:	74 14                	je     8017b1 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  80179d:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  8017a1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8017a6:	5b                   	pop    %rbx
+  8017a7:	41 5c                	pop    %r12
+  8017a9:	5d                   	pop    %rbp
+  8017aa:	c3                   	ret
+        return -E_INVAL;
+  8017ab:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8017b0:	c3                   	ret
+        return -E_INVAL;
+  8017b1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8017b6:	eb ee                	jmp    8017a6 <fd_lookup+0x39>
+
+00000000008017b8 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  8017b8:	55                   	push   %rbp
+  8017b9:	48 89 e5             	mov    %rsp,%rbp
+  8017bc:	41 54                	push   %r12
+  8017be:	53                   	push   %rbx
+  8017bf:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  8017c2:	48 b8 60 34 80 00 00 	movabs $0x803460,%rax
+  8017c9:	00 00 00 
+  8017cc:	48 bb 20 40 80 00 00 	movabs $0x804020,%rbx
+  8017d3:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  8017d6:	39 3b                	cmp    %edi,(%rbx)
+  8017d8:	74 47                	je     801821 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  8017da:	48 83 c0 08          	add    $0x8,%rax
+  8017de:	48 8b 18             	mov    (%rax),%rbx
+  8017e1:	48 85 db             	test   %rbx,%rbx
+  8017e4:	75 f0                	jne    8017d6 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8017e6:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  8017ed:	00 00 00 
+  8017f0:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+  8017f6:	89 fa                	mov    %edi,%edx
+  8017f8:	48 bf e0 33 80 00 00 	movabs $0x8033e0,%rdi
+  8017ff:	00 00 00 
+  801802:	b8 00 00 00 00       	mov    $0x0,%eax
+  801807:	48 b9 9c 03 80 00 00 	movabs $0x80039c,%rcx
+  80180e:	00 00 00 
+  801811:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  801813:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  801818:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  80181c:	5b                   	pop    %rbx
+  80181d:	41 5c                	pop    %r12
+  80181f:	5d                   	pop    %rbp
+  801820:	c3                   	ret
+            return 0;
+  801821:	b8 00 00 00 00       	mov    $0x0,%eax
+  801826:	eb f0                	jmp    801818 <dev_lookup+0x60>
+
+0000000000801828 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  801828:	55                   	push   %rbp
+  801829:	48 89 e5             	mov    %rsp,%rbp
+  80182c:	41 55                	push   %r13
+  80182e:	41 54                	push   %r12
+  801830:	53                   	push   %rbx
+  801831:	48 83 ec 18          	sub    $0x18,%rsp
+  801835:	48 89 fb             	mov    %rdi,%rbx
+  801838:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80183b:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  801842:	ff ff ff 
+  801845:	48 01 df             	add    %rbx,%rdi
+  801848:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  80184c:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801850:	48 b8 6d 17 80 00 00 	movabs $0x80176d,%rax
+  801857:	00 00 00 
+  80185a:	ff d0                	call   *%rax
+  80185c:	41 89 c5             	mov    %eax,%r13d
+  80185f:	85 c0                	test   %eax,%eax
+  801861:	78 06                	js     801869 <fd_close+0x41>
+  801863:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  801867:	74 1a                	je     801883 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  801869:	45 84 e4             	test   %r12b,%r12b
+  80186c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801871:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  801875:	44 89 e8             	mov    %r13d,%eax
+  801878:	48 83 c4 18          	add    $0x18,%rsp
+  80187c:	5b                   	pop    %rbx
+  80187d:	41 5c                	pop    %r12
+  80187f:	41 5d                	pop    %r13
+  801881:	5d                   	pop    %rbp
+  801882:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801883:	8b 3b                	mov    (%rbx),%edi
+  801885:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801889:	48 b8 b8 17 80 00 00 	movabs $0x8017b8,%rax
+  801890:	00 00 00 
+  801893:	ff d0                	call   *%rax
+  801895:	41 89 c5             	mov    %eax,%r13d
+  801898:	85 c0                	test   %eax,%eax
+  80189a:	78 1b                	js     8018b7 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  80189c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8018a0:	48 8b 40 20          	mov    0x20(%rax),%rax
+  8018a4:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  8018aa:	48 85 c0             	test   %rax,%rax
+  8018ad:	74 08                	je     8018b7 <fd_close+0x8f>
+  8018af:	48 89 df             	mov    %rbx,%rdi
+  8018b2:	ff d0                	call   *%rax
+  8018b4:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8018b7:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8018bc:	48 89 de             	mov    %rbx,%rsi
+  8018bf:	bf 00 00 00 00       	mov    $0x0,%edi
+  8018c4:	48 b8 3d 13 80 00 00 	movabs $0x80133d,%rax
+  8018cb:	00 00 00 
+  8018ce:	ff d0                	call   *%rax
+    return res;
+  8018d0:	eb a3                	jmp    801875 <fd_close+0x4d>
+
+00000000008018d2 <close>:
+
+int
+close(int fdnum) {
+  8018d2:	55                   	push   %rbp
+  8018d3:	48 89 e5             	mov    %rsp,%rbp
+  8018d6:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  8018da:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8018de:	48 b8 6d 17 80 00 00 	movabs $0x80176d,%rax
+  8018e5:	00 00 00 
+  8018e8:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8018ea:	85 c0                	test   %eax,%eax
+  8018ec:	78 15                	js     801903 <close+0x31>
+
+    return fd_close(fd, 1);
+  8018ee:	be 01 00 00 00       	mov    $0x1,%esi
+  8018f3:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8018f7:	48 b8 28 18 80 00 00 	movabs $0x801828,%rax
+  8018fe:	00 00 00 
+  801901:	ff d0                	call   *%rax
+}
+  801903:	c9                   	leave
+  801904:	c3                   	ret
+
+0000000000801905 <close_all>:
+
+void
+close_all(void) {
+  801905:	55                   	push   %rbp
+  801906:	48 89 e5             	mov    %rsp,%rbp
+  801909:	41 54                	push   %r12
+  80190b:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  80190c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801911:	49 bc d2 18 80 00 00 	movabs $0x8018d2,%r12
+  801918:	00 00 00 
+  80191b:	89 df                	mov    %ebx,%edi
+  80191d:	41 ff d4             	call   *%r12
+  801920:	83 c3 01             	add    $0x1,%ebx
+  801923:	83 fb 20             	cmp    $0x20,%ebx
+  801926:	75 f3                	jne    80191b <close_all+0x16>
+}
+  801928:	5b                   	pop    %rbx
+  801929:	41 5c                	pop    %r12
+  80192b:	5d                   	pop    %rbp
+  80192c:	c3                   	ret
+
+000000000080192d <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  80192d:	55                   	push   %rbp
+  80192e:	48 89 e5             	mov    %rsp,%rbp
+  801931:	41 57                	push   %r15
+  801933:	41 56                	push   %r14
+  801935:	41 55                	push   %r13
+  801937:	41 54                	push   %r12
+  801939:	53                   	push   %rbx
+  80193a:	48 83 ec 18          	sub    $0x18,%rsp
+  80193e:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  801941:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801945:	48 b8 6d 17 80 00 00 	movabs $0x80176d,%rax
+  80194c:	00 00 00 
+  80194f:	ff d0                	call   *%rax
+  801951:	89 c3                	mov    %eax,%ebx
+  801953:	85 c0                	test   %eax,%eax
+  801955:	0f 88 b8 00 00 00    	js     801a13 <dup+0xe6>
+    close(newfdnum);
+  80195b:	44 89 e7             	mov    %r12d,%edi
+  80195e:	48 b8 d2 18 80 00 00 	movabs $0x8018d2,%rax
+  801965:	00 00 00 
+  801968:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  80196a:	4d 63 ec             	movslq %r12d,%r13
+  80196d:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  801974:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  801978:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  80197c:	4c 89 ff             	mov    %r15,%rdi
+  80197f:	49 be be 16 80 00 00 	movabs $0x8016be,%r14
+  801986:	00 00 00 
+  801989:	41 ff d6             	call   *%r14
+  80198c:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  80198f:	4c 89 ef             	mov    %r13,%rdi
+  801992:	41 ff d6             	call   *%r14
+  801995:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  801998:	48 89 df             	mov    %rbx,%rdi
+  80199b:	48 b8 e3 27 80 00 00 	movabs $0x8027e3,%rax
+  8019a2:	00 00 00 
+  8019a5:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  8019a7:	a8 04                	test   $0x4,%al
+  8019a9:	74 2b                	je     8019d6 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  8019ab:	41 89 c1             	mov    %eax,%r9d
+  8019ae:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8019b4:	4c 89 f1             	mov    %r14,%rcx
+  8019b7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8019bc:	48 89 de             	mov    %rbx,%rsi
+  8019bf:	bf 00 00 00 00       	mov    $0x0,%edi
+  8019c4:	48 b8 d8 12 80 00 00 	movabs $0x8012d8,%rax
+  8019cb:	00 00 00 
+  8019ce:	ff d0                	call   *%rax
+  8019d0:	89 c3                	mov    %eax,%ebx
+  8019d2:	85 c0                	test   %eax,%eax
+  8019d4:	78 4e                	js     801a24 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  8019d6:	4c 89 ff             	mov    %r15,%rdi
+  8019d9:	48 b8 e3 27 80 00 00 	movabs $0x8027e3,%rax
+  8019e0:	00 00 00 
+  8019e3:	ff d0                	call   *%rax
+  8019e5:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  8019e8:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8019ee:	4c 89 e9             	mov    %r13,%rcx
+  8019f1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8019f6:	4c 89 fe             	mov    %r15,%rsi
+  8019f9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8019fe:	48 b8 d8 12 80 00 00 	movabs $0x8012d8,%rax
+  801a05:	00 00 00 
+  801a08:	ff d0                	call   *%rax
+  801a0a:	89 c3                	mov    %eax,%ebx
+  801a0c:	85 c0                	test   %eax,%eax
+  801a0e:	78 14                	js     801a24 <dup+0xf7>
+
+    return newfdnum;
+  801a10:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  801a13:	89 d8                	mov    %ebx,%eax
+  801a15:	48 83 c4 18          	add    $0x18,%rsp
+  801a19:	5b                   	pop    %rbx
+  801a1a:	41 5c                	pop    %r12
+  801a1c:	41 5d                	pop    %r13
+  801a1e:	41 5e                	pop    %r14
+  801a20:	41 5f                	pop    %r15
+  801a22:	5d                   	pop    %rbp
+  801a23:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  801a24:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801a29:	4c 89 ee             	mov    %r13,%rsi
+  801a2c:	bf 00 00 00 00       	mov    $0x0,%edi
+  801a31:	49 bc 3d 13 80 00 00 	movabs $0x80133d,%r12
+  801a38:	00 00 00 
+  801a3b:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  801a3e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801a43:	4c 89 f6             	mov    %r14,%rsi
+  801a46:	bf 00 00 00 00       	mov    $0x0,%edi
+  801a4b:	41 ff d4             	call   *%r12
+    return res;
+  801a4e:	eb c3                	jmp    801a13 <dup+0xe6>
+
+0000000000801a50 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  801a50:	55                   	push   %rbp
+  801a51:	48 89 e5             	mov    %rsp,%rbp
+  801a54:	41 56                	push   %r14
+  801a56:	41 55                	push   %r13
+  801a58:	41 54                	push   %r12
+  801a5a:	53                   	push   %rbx
+  801a5b:	48 83 ec 10          	sub    $0x10,%rsp
+  801a5f:	89 fb                	mov    %edi,%ebx
+  801a61:	49 89 f4             	mov    %rsi,%r12
+  801a64:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801a67:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801a6b:	48 b8 6d 17 80 00 00 	movabs $0x80176d,%rax
+  801a72:	00 00 00 
+  801a75:	ff d0                	call   *%rax
+  801a77:	85 c0                	test   %eax,%eax
+  801a79:	78 4c                	js     801ac7 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801a7b:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801a7f:	41 8b 3e             	mov    (%r14),%edi
+  801a82:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801a86:	48 b8 b8 17 80 00 00 	movabs $0x8017b8,%rax
+  801a8d:	00 00 00 
+  801a90:	ff d0                	call   *%rax
+  801a92:	85 c0                	test   %eax,%eax
+  801a94:	78 35                	js     801acb <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801a96:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801a9a:	83 e0 03             	and    $0x3,%eax
+  801a9d:	83 f8 01             	cmp    $0x1,%eax
+  801aa0:	74 2d                	je     801acf <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801aa2:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801aa6:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801aaa:	48 85 c0             	test   %rax,%rax
+  801aad:	74 56                	je     801b05 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  801aaf:	4c 89 ea             	mov    %r13,%rdx
+  801ab2:	4c 89 e6             	mov    %r12,%rsi
+  801ab5:	4c 89 f7             	mov    %r14,%rdi
+  801ab8:	ff d0                	call   *%rax
+}
+  801aba:	48 83 c4 10          	add    $0x10,%rsp
+  801abe:	5b                   	pop    %rbx
+  801abf:	41 5c                	pop    %r12
+  801ac1:	41 5d                	pop    %r13
+  801ac3:	41 5e                	pop    %r14
+  801ac5:	5d                   	pop    %rbp
+  801ac6:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801ac7:	48 98                	cltq
+  801ac9:	eb ef                	jmp    801aba <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801acb:	48 98                	cltq
+  801acd:	eb eb                	jmp    801aba <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801acf:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801ad6:	00 00 00 
+  801ad9:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+  801adf:	89 da                	mov    %ebx,%edx
+  801ae1:	48 bf 21 34 80 00 00 	movabs $0x803421,%rdi
+  801ae8:	00 00 00 
+  801aeb:	b8 00 00 00 00       	mov    $0x0,%eax
+  801af0:	48 b9 9c 03 80 00 00 	movabs $0x80039c,%rcx
+  801af7:	00 00 00 
+  801afa:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801afc:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801b03:	eb b5                	jmp    801aba <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801b05:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801b0c:	eb ac                	jmp    801aba <read+0x6a>
+
+0000000000801b0e <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801b0e:	55                   	push   %rbp
+  801b0f:	48 89 e5             	mov    %rsp,%rbp
+  801b12:	41 57                	push   %r15
+  801b14:	41 56                	push   %r14
+  801b16:	41 55                	push   %r13
+  801b18:	41 54                	push   %r12
+  801b1a:	53                   	push   %rbx
+  801b1b:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  801b1f:	48 85 d2             	test   %rdx,%rdx
+  801b22:	74 54                	je     801b78 <readn+0x6a>
+  801b24:	41 89 fd             	mov    %edi,%r13d
+  801b27:	49 89 f6             	mov    %rsi,%r14
+  801b2a:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  801b2d:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  801b32:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  801b37:	49 bf 50 1a 80 00 00 	movabs $0x801a50,%r15
+  801b3e:	00 00 00 
+  801b41:	4c 89 e2             	mov    %r12,%rdx
+  801b44:	48 29 f2             	sub    %rsi,%rdx
+  801b47:	4c 01 f6             	add    %r14,%rsi
+  801b4a:	44 89 ef             	mov    %r13d,%edi
+  801b4d:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  801b50:	85 c0                	test   %eax,%eax
+  801b52:	78 20                	js     801b74 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  801b54:	01 c3                	add    %eax,%ebx
+  801b56:	85 c0                	test   %eax,%eax
+  801b58:	74 08                	je     801b62 <readn+0x54>
+  801b5a:	48 63 f3             	movslq %ebx,%rsi
+  801b5d:	4c 39 e6             	cmp    %r12,%rsi
+  801b60:	72 df                	jb     801b41 <readn+0x33>
+    }
+    return res;
+  801b62:	48 63 c3             	movslq %ebx,%rax
+}
+  801b65:	48 83 c4 08          	add    $0x8,%rsp
+  801b69:	5b                   	pop    %rbx
+  801b6a:	41 5c                	pop    %r12
+  801b6c:	41 5d                	pop    %r13
+  801b6e:	41 5e                	pop    %r14
+  801b70:	41 5f                	pop    %r15
+  801b72:	5d                   	pop    %rbp
+  801b73:	c3                   	ret
+        if (inc < 0) return inc;
+  801b74:	48 98                	cltq
+  801b76:	eb ed                	jmp    801b65 <readn+0x57>
+    int inc = 1, res = 0;
+  801b78:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b7d:	eb e3                	jmp    801b62 <readn+0x54>
+
+0000000000801b7f <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  801b7f:	55                   	push   %rbp
+  801b80:	48 89 e5             	mov    %rsp,%rbp
+  801b83:	41 56                	push   %r14
+  801b85:	41 55                	push   %r13
+  801b87:	41 54                	push   %r12
+  801b89:	53                   	push   %rbx
+  801b8a:	48 83 ec 10          	sub    $0x10,%rsp
+  801b8e:	89 fb                	mov    %edi,%ebx
+  801b90:	49 89 f4             	mov    %rsi,%r12
+  801b93:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801b96:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801b9a:	48 b8 6d 17 80 00 00 	movabs $0x80176d,%rax
+  801ba1:	00 00 00 
+  801ba4:	ff d0                	call   *%rax
+  801ba6:	85 c0                	test   %eax,%eax
+  801ba8:	78 47                	js     801bf1 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801baa:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801bae:	41 8b 3e             	mov    (%r14),%edi
+  801bb1:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801bb5:	48 b8 b8 17 80 00 00 	movabs $0x8017b8,%rax
+  801bbc:	00 00 00 
+  801bbf:	ff d0                	call   *%rax
+  801bc1:	85 c0                	test   %eax,%eax
+  801bc3:	78 30                	js     801bf5 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801bc5:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  801bca:	74 2d                	je     801bf9 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801bcc:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801bd0:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801bd4:	48 85 c0             	test   %rax,%rax
+  801bd7:	74 56                	je     801c2f <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  801bd9:	4c 89 ea             	mov    %r13,%rdx
+  801bdc:	4c 89 e6             	mov    %r12,%rsi
+  801bdf:	4c 89 f7             	mov    %r14,%rdi
+  801be2:	ff d0                	call   *%rax
+}
+  801be4:	48 83 c4 10          	add    $0x10,%rsp
+  801be8:	5b                   	pop    %rbx
+  801be9:	41 5c                	pop    %r12
+  801beb:	41 5d                	pop    %r13
+  801bed:	41 5e                	pop    %r14
+  801bef:	5d                   	pop    %rbp
+  801bf0:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801bf1:	48 98                	cltq
+  801bf3:	eb ef                	jmp    801be4 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801bf5:	48 98                	cltq
+  801bf7:	eb eb                	jmp    801be4 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801bf9:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801c00:	00 00 00 
+  801c03:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+  801c09:	89 da                	mov    %ebx,%edx
+  801c0b:	48 bf 3d 34 80 00 00 	movabs $0x80343d,%rdi
+  801c12:	00 00 00 
+  801c15:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c1a:	48 b9 9c 03 80 00 00 	movabs $0x80039c,%rcx
+  801c21:	00 00 00 
+  801c24:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801c26:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801c2d:	eb b5                	jmp    801be4 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801c2f:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801c36:	eb ac                	jmp    801be4 <write+0x65>
+
+0000000000801c38 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  801c38:	55                   	push   %rbp
+  801c39:	48 89 e5             	mov    %rsp,%rbp
+  801c3c:	53                   	push   %rbx
+  801c3d:	48 83 ec 18          	sub    $0x18,%rsp
+  801c41:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801c43:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801c47:	48 b8 6d 17 80 00 00 	movabs $0x80176d,%rax
+  801c4e:	00 00 00 
+  801c51:	ff d0                	call   *%rax
+  801c53:	85 c0                	test   %eax,%eax
+  801c55:	78 0c                	js     801c63 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  801c57:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801c5b:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  801c5e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801c63:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801c67:	c9                   	leave
+  801c68:	c3                   	ret
+
+0000000000801c69 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  801c69:	55                   	push   %rbp
+  801c6a:	48 89 e5             	mov    %rsp,%rbp
+  801c6d:	41 55                	push   %r13
+  801c6f:	41 54                	push   %r12
+  801c71:	53                   	push   %rbx
+  801c72:	48 83 ec 18          	sub    $0x18,%rsp
+  801c76:	89 fb                	mov    %edi,%ebx
+  801c78:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801c7b:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801c7f:	48 b8 6d 17 80 00 00 	movabs $0x80176d,%rax
+  801c86:	00 00 00 
+  801c89:	ff d0                	call   *%rax
+  801c8b:	85 c0                	test   %eax,%eax
+  801c8d:	78 38                	js     801cc7 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801c8f:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  801c93:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  801c97:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801c9b:	48 b8 b8 17 80 00 00 	movabs $0x8017b8,%rax
+  801ca2:	00 00 00 
+  801ca5:	ff d0                	call   *%rax
+  801ca7:	85 c0                	test   %eax,%eax
+  801ca9:	78 1c                	js     801cc7 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801cab:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  801cb0:	74 20                	je     801cd2 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801cb2:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801cb6:	48 8b 40 30          	mov    0x30(%rax),%rax
+  801cba:	48 85 c0             	test   %rax,%rax
+  801cbd:	74 47                	je     801d06 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  801cbf:	44 89 e6             	mov    %r12d,%esi
+  801cc2:	4c 89 ef             	mov    %r13,%rdi
+  801cc5:	ff d0                	call   *%rax
+}
+  801cc7:	48 83 c4 18          	add    $0x18,%rsp
+  801ccb:	5b                   	pop    %rbx
+  801ccc:	41 5c                	pop    %r12
+  801cce:	41 5d                	pop    %r13
+  801cd0:	5d                   	pop    %rbp
+  801cd1:	c3                   	ret
+                thisenv->env_id, fdnum);
+  801cd2:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801cd9:	00 00 00 
+  801cdc:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801ce2:	89 da                	mov    %ebx,%edx
+  801ce4:	48 bf 00 34 80 00 00 	movabs $0x803400,%rdi
+  801ceb:	00 00 00 
+  801cee:	b8 00 00 00 00       	mov    $0x0,%eax
+  801cf3:	48 b9 9c 03 80 00 00 	movabs $0x80039c,%rcx
+  801cfa:	00 00 00 
+  801cfd:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801cff:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801d04:	eb c1                	jmp    801cc7 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801d06:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801d0b:	eb ba                	jmp    801cc7 <ftruncate+0x5e>
+
+0000000000801d0d <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  801d0d:	55                   	push   %rbp
+  801d0e:	48 89 e5             	mov    %rsp,%rbp
+  801d11:	41 54                	push   %r12
+  801d13:	53                   	push   %rbx
+  801d14:	48 83 ec 10          	sub    $0x10,%rsp
+  801d18:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801d1b:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801d1f:	48 b8 6d 17 80 00 00 	movabs $0x80176d,%rax
+  801d26:	00 00 00 
+  801d29:	ff d0                	call   *%rax
+  801d2b:	85 c0                	test   %eax,%eax
+  801d2d:	78 4e                	js     801d7d <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801d2f:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801d33:	41 8b 3c 24          	mov    (%r12),%edi
+  801d37:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801d3b:	48 b8 b8 17 80 00 00 	movabs $0x8017b8,%rax
+  801d42:	00 00 00 
+  801d45:	ff d0                	call   *%rax
+  801d47:	85 c0                	test   %eax,%eax
+  801d49:	78 32                	js     801d7d <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801d4b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801d4f:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  801d54:	74 30                	je     801d86 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  801d56:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  801d59:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  801d60:	00 00 00 
+    stat->st_isdir = 0;
+  801d63:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  801d6a:	00 00 00 
+    stat->st_dev = dev;
+  801d6d:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  801d74:	48 89 de             	mov    %rbx,%rsi
+  801d77:	4c 89 e7             	mov    %r12,%rdi
+  801d7a:	ff 50 28             	call   *0x28(%rax)
+}
+  801d7d:	48 83 c4 10          	add    $0x10,%rsp
+  801d81:	5b                   	pop    %rbx
+  801d82:	41 5c                	pop    %r12
+  801d84:	5d                   	pop    %rbp
+  801d85:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801d86:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801d8b:	eb f0                	jmp    801d7d <fstat+0x70>
+
+0000000000801d8d <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  801d8d:	55                   	push   %rbp
+  801d8e:	48 89 e5             	mov    %rsp,%rbp
+  801d91:	41 54                	push   %r12
+  801d93:	53                   	push   %rbx
+  801d94:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  801d97:	be 00 00 00 00       	mov    $0x0,%esi
+  801d9c:	48 b8 70 21 80 00 00 	movabs $0x802170,%rax
+  801da3:	00 00 00 
+  801da6:	ff d0                	call   *%rax
+  801da8:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  801daa:	85 c0                	test   %eax,%eax
+  801dac:	78 25                	js     801dd3 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  801dae:	4c 89 e6             	mov    %r12,%rsi
+  801db1:	89 c7                	mov    %eax,%edi
+  801db3:	48 b8 0d 1d 80 00 00 	movabs $0x801d0d,%rax
+  801dba:	00 00 00 
+  801dbd:	ff d0                	call   *%rax
+  801dbf:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  801dc2:	89 df                	mov    %ebx,%edi
+  801dc4:	48 b8 d2 18 80 00 00 	movabs $0x8018d2,%rax
+  801dcb:	00 00 00 
+  801dce:	ff d0                	call   *%rax
+
+    return res;
+  801dd0:	44 89 e3             	mov    %r12d,%ebx
+}
+  801dd3:	89 d8                	mov    %ebx,%eax
+  801dd5:	5b                   	pop    %rbx
+  801dd6:	41 5c                	pop    %r12
+  801dd8:	5d                   	pop    %rbp
+  801dd9:	c3                   	ret
+
+0000000000801dda <fsipc>:
+ * response may be written back to fsipcbuf.
+ * type: request code, passed as the simple integer IPC value.
+ * dstva: virtual address at which to receive reply page, 0 if none.
+ * Returns result from the file server. */
+static int
+fsipc(unsigned type, void *dstva) {
+  801dda:	55                   	push   %rbp
+  801ddb:	48 89 e5             	mov    %rsp,%rbp
+  801dde:	41 54                	push   %r12
+  801de0:	53                   	push   %rbx
+  801de1:	48 83 ec 10          	sub    $0x10,%rsp
+  801de5:	41 89 fc             	mov    %edi,%r12d
+  801de8:	48 89 f3             	mov    %rsi,%rbx
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  801deb:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  801df2:	00 00 00 
+  801df5:	83 38 00             	cmpl   $0x0,(%rax)
+  801df8:	74 5e                	je     801e58 <fsipc+0x7e>
+    if (debug) {
+        cprintf("[%08x] fsipc %d %08x\n",
+                thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+    }
+
+    ipc_send(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW);
+  801dfa:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  801e00:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  801e05:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  801e0c:	00 00 00 
+  801e0f:	44 89 e6             	mov    %r12d,%esi
+  801e12:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  801e19:	00 00 00 
+  801e1c:	8b 38                	mov    (%rax),%edi
+  801e1e:	48 b8 d7 2c 80 00 00 	movabs $0x802cd7,%rax
+  801e25:	00 00 00 
+  801e28:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  801e2a:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  801e31:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  801e32:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801e37:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  801e3b:	48 89 de             	mov    %rbx,%rsi
+  801e3e:	bf 00 00 00 00       	mov    $0x0,%edi
+  801e43:	48 b8 02 2c 80 00 00 	movabs $0x802c02,%rax
+  801e4a:	00 00 00 
+  801e4d:	ff d0                	call   *%rax
+}
+  801e4f:	48 83 c4 10          	add    $0x10,%rsp
+  801e53:	5b                   	pop    %rbx
+  801e54:	41 5c                	pop    %r12
+  801e56:	5d                   	pop    %rbp
+  801e57:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  801e58:	bf 03 00 00 00       	mov    $0x3,%edi
+  801e5d:	48 b8 7a 2d 80 00 00 	movabs $0x802d7a,%rax
+  801e64:	00 00 00 
+  801e67:	ff d0                	call   *%rax
+  801e69:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  801e70:	00 00 
+  801e72:	eb 86                	jmp    801dfa <fsipc+0x20>
+
+0000000000801e74 <devfile_trunc>:
+    return 0;
+}
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  801e74:	55                   	push   %rbp
+  801e75:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801e78:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  801e7f:	00 00 00 
+  801e82:	8b 57 0c             	mov    0xc(%rdi),%edx
+  801e85:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  801e87:	89 70 04             	mov    %esi,0x4(%rax)
+
+    return fsipc(FSREQ_SET_SIZE, NULL);
+  801e8a:	be 00 00 00 00       	mov    $0x0,%esi
+  801e8f:	bf 02 00 00 00       	mov    $0x2,%edi
+  801e94:	48 b8 da 1d 80 00 00 	movabs $0x801dda,%rax
+  801e9b:	00 00 00 
+  801e9e:	ff d0                	call   *%rax
+}
+  801ea0:	5d                   	pop    %rbp
+  801ea1:	c3                   	ret
+
+0000000000801ea2 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  801ea2:	55                   	push   %rbp
+  801ea3:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801ea6:	8b 47 0c             	mov    0xc(%rdi),%eax
+  801ea9:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  801eb0:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  801eb2:	be 00 00 00 00       	mov    $0x0,%esi
+  801eb7:	bf 06 00 00 00       	mov    $0x6,%edi
+  801ebc:	48 b8 da 1d 80 00 00 	movabs $0x801dda,%rax
+  801ec3:	00 00 00 
+  801ec6:	ff d0                	call   *%rax
+}
+  801ec8:	5d                   	pop    %rbp
+  801ec9:	c3                   	ret
+
+0000000000801eca <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  801eca:	55                   	push   %rbp
+  801ecb:	48 89 e5             	mov    %rsp,%rbp
+  801ece:	41 54                	push   %r12
+  801ed0:	53                   	push   %rbx
+  801ed1:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801ed4:	8b 47 0c             	mov    0xc(%rdi),%eax
+  801ed7:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  801ede:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  801ee0:	be 00 00 00 00       	mov    $0x0,%esi
+  801ee5:	bf 05 00 00 00       	mov    $0x5,%edi
+  801eea:	48 b8 da 1d 80 00 00 	movabs $0x801dda,%rax
+  801ef1:	00 00 00 
+  801ef4:	ff d0                	call   *%rax
+    if (res < 0) {
+  801ef6:	85 c0                	test   %eax,%eax
+  801ef8:	78 3d                	js     801f37 <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801efa:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  801f01:	00 00 00 
+  801f04:	4c 89 e6             	mov    %r12,%rsi
+  801f07:	48 89 df             	mov    %rbx,%rdi
+  801f0a:	48 b8 c1 0c 80 00 00 	movabs $0x800cc1,%rax
+  801f11:	00 00 00 
+  801f14:	ff d0                	call   *%rax
+    st->st_size  = fsipcbuf.statRet.ret_size;
+  801f16:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  801f1d:	00 
+  801f1e:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801f24:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  801f2b:	00 
+  801f2c:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  801f32:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801f37:	5b                   	pop    %rbx
+  801f38:	41 5c                	pop    %r12
+  801f3a:	5d                   	pop    %rbp
+  801f3b:	c3                   	ret
+
+0000000000801f3c <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  801f3c:	55                   	push   %rbp
+  801f3d:	48 89 e5             	mov    %rsp,%rbp
+  801f40:	41 57                	push   %r15
+  801f42:	41 56                	push   %r14
+  801f44:	41 55                	push   %r13
+  801f46:	41 54                	push   %r12
+  801f48:	53                   	push   %rbx
+  801f49:	48 83 ec 18          	sub    $0x18,%rsp
+  801f4d:	49 89 fe             	mov    %rdi,%r14
+  801f50:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+  801f54:	48 89 d3             	mov    %rdx,%rbx
+    while (n > sizeof(fsipcbuf.write.req_buf))
+  801f57:	48 81 fa f0 0f 00 00 	cmp    $0xff0,%rdx
+  801f5e:	0f 86 e4 00 00 00    	jbe    802048 <devfile_write+0x10c>
+  801f64:	49 89 f4             	mov    %rsi,%r12
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801f67:	49 bd 00 60 80 00 00 	movabs $0x806000,%r13
+  801f6e:	00 00 00 
+        memcpy(fsipcbuf.write.req_buf, buf, sizeof(fsipcbuf.write.req_buf));
+  801f71:	49 bf 22 0f 80 00 00 	movabs $0x800f22,%r15
+  801f78:	00 00 00 
+  801f7b:	eb 03                	jmp    801f80 <devfile_write+0x44>
+        buf += sizeof(fsipcbuf.write.req_buf);
+  801f7d:	49 89 f4             	mov    %rsi,%r12
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801f80:	41 8b 46 0c          	mov    0xc(%r14),%eax
+  801f84:	41 89 45 00          	mov    %eax,0x0(%r13)
+        fsipcbuf.write.req_n      = sizeof(fsipcbuf.write.req_buf);
+  801f88:	49 c7 45 08 f0 0f 00 	movq   $0xff0,0x8(%r13)
+  801f8f:	00 
+        memcpy(fsipcbuf.write.req_buf, buf, sizeof(fsipcbuf.write.req_buf));
+  801f90:	ba f0 0f 00 00       	mov    $0xff0,%edx
+  801f95:	4c 89 e6             	mov    %r12,%rsi
+  801f98:	48 bf 10 60 80 00 00 	movabs $0x806010,%rdi
+  801f9f:	00 00 00 
+  801fa2:	41 ff d7             	call   *%r15
+        ssize_t res = fsipc(FSREQ_WRITE, NULL);
+  801fa5:	be 00 00 00 00       	mov    $0x0,%esi
+  801faa:	bf 04 00 00 00       	mov    $0x4,%edi
+  801faf:	48 b8 da 1d 80 00 00 	movabs $0x801dda,%rax
+  801fb6:	00 00 00 
+  801fb9:	ff d0                	call   *%rax
+  801fbb:	48 63 d0             	movslq %eax,%rdx
+        if (res < 0 || res < sizeof(fsipcbuf.write.req_buf))
+  801fbe:	3d ef 0f 00 00       	cmp    $0xfef,%eax
+  801fc3:	7e 71                	jle    802036 <devfile_write+0xfa>
+        buf += sizeof(fsipcbuf.write.req_buf);
+  801fc5:	49 8d b4 24 f0 0f 00 	lea    0xff0(%r12),%rsi
+  801fcc:	00 
+        n -= sizeof(fsipcbuf.write.req_buf);
+  801fcd:	48 81 eb f0 0f 00 00 	sub    $0xff0,%rbx
+    while (n > sizeof(fsipcbuf.write.req_buf))
+  801fd4:	48 81 fb f0 0f 00 00 	cmp    $0xff0,%rbx
+  801fdb:	77 a0                	ja     801f7d <devfile_write+0x41>
+        written += sizeof(fsipcbuf.write.req_buf);
+  801fdd:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801fe1:	49 29 c4             	sub    %rax,%r12
+  801fe4:	4d 8d a4 24 f0 0f 00 	lea    0xff0(%r12),%r12
+  801feb:	00 
+    fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801fec:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  801ff3:	00 00 00 
+  801ff6:	41 8b 56 0c          	mov    0xc(%r14),%edx
+  801ffa:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.write.req_n      = n;
+  801ffc:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    memcpy(fsipcbuf.write.req_buf, buf, n);
+  802000:	48 89 da             	mov    %rbx,%rdx
+  802003:	48 8d 78 10          	lea    0x10(%rax),%rdi
+  802007:	48 b8 22 0f 80 00 00 	movabs $0x800f22,%rax
+  80200e:	00 00 00 
+  802011:	ff d0                	call   *%rax
+    ssize_t res = fsipc(FSREQ_WRITE, NULL);
+  802013:	be 00 00 00 00       	mov    $0x0,%esi
+  802018:	bf 04 00 00 00       	mov    $0x4,%edi
+  80201d:	48 b8 da 1d 80 00 00 	movabs $0x801dda,%rax
+  802024:	00 00 00 
+  802027:	ff d0                	call   *%rax
+  802029:	48 63 d0             	movslq %eax,%rdx
+    written += res;
+  80202c:	49 01 d4             	add    %rdx,%r12
+  80202f:	48 85 d2             	test   %rdx,%rdx
+  802032:	49 0f 49 d4          	cmovns %r12,%rdx
+}
+  802036:	48 89 d0             	mov    %rdx,%rax
+  802039:	48 83 c4 18          	add    $0x18,%rsp
+  80203d:	5b                   	pop    %rbx
+  80203e:	41 5c                	pop    %r12
+  802040:	41 5d                	pop    %r13
+  802042:	41 5e                	pop    %r14
+  802044:	41 5f                	pop    %r15
+  802046:	5d                   	pop    %rbp
+  802047:	c3                   	ret
+    while (n > sizeof(fsipcbuf.write.req_buf))
+  802048:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+    ssize_t written = 0;
+  80204c:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802052:	eb 98                	jmp    801fec <devfile_write+0xb0>
+
+0000000000802054 <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  802054:	55                   	push   %rbp
+  802055:	48 89 e5             	mov    %rsp,%rbp
+  802058:	41 57                	push   %r15
+  80205a:	41 56                	push   %r14
+  80205c:	41 55                	push   %r13
+  80205e:	41 54                	push   %r12
+  802060:	53                   	push   %rbx
+  802061:	48 83 ec 18          	sub    $0x18,%rsp
+  802065:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  802069:	49 89 f6             	mov    %rsi,%r14
+  80206c:	49 89 d4             	mov    %rdx,%r12
+    while (n > sizeof(fsipcbuf.readRet.ret_buf))
+  80206f:	48 81 fa 00 10 00 00 	cmp    $0x1000,%rdx
+  802076:	0f 86 ea 00 00 00    	jbe    802166 <devfile_read+0x112>
+    ssize_t readsz = 0;
+  80207c:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  802083:	00 
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802084:	49 bf 00 60 80 00 00 	movabs $0x806000,%r15
+  80208b:	00 00 00 
+  80208e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802092:	8b 40 0c             	mov    0xc(%rax),%eax
+  802095:	41 89 07             	mov    %eax,(%r15)
+        fsipcbuf.read.req_n = sizeof(fsipcbuf.readRet.ret_buf);
+  802098:	49 c7 47 08 00 10 00 	movq   $0x1000,0x8(%r15)
+  80209f:	00 
+        ssize_t res = fsipc(FSREQ_READ, NULL);
+  8020a0:	be 00 00 00 00       	mov    $0x0,%esi
+  8020a5:	bf 03 00 00 00       	mov    $0x3,%edi
+  8020aa:	48 b8 da 1d 80 00 00 	movabs $0x801dda,%rax
+  8020b1:	00 00 00 
+  8020b4:	ff d0                	call   *%rax
+  8020b6:	4c 63 e8             	movslq %eax,%r13
+        if (res < 0)
+  8020b9:	4d 85 ed             	test   %r13,%r13
+  8020bc:	0f 88 92 00 00 00    	js     802154 <devfile_read+0x100>
+        memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  8020c2:	4c 89 ea             	mov    %r13,%rdx
+  8020c5:	4c 89 fe             	mov    %r15,%rsi
+  8020c8:	4c 89 f7             	mov    %r14,%rdi
+  8020cb:	48 b8 22 0f 80 00 00 	movabs $0x800f22,%rax
+  8020d2:	00 00 00 
+  8020d5:	ff d0                	call   *%rax
+        if (res < sizeof(fsipcbuf.readRet.ret_buf))
+  8020d7:	49 81 fd ff 0f 00 00 	cmp    $0xfff,%r13
+  8020de:	76 6d                	jbe    80214d <devfile_read+0xf9>
+        readsz += res;
+  8020e0:	4c 01 6d c0          	add    %r13,-0x40(%rbp)
+        buf += res;
+  8020e4:	4d 01 ee             	add    %r13,%r14
+        n -= res;
+  8020e7:	4d 29 ec             	sub    %r13,%r12
+    while (n > sizeof(fsipcbuf.readRet.ret_buf))
+  8020ea:	49 81 fc 00 10 00 00 	cmp    $0x1000,%r12
+  8020f1:	77 9b                	ja     80208e <devfile_read+0x3a>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8020f3:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  8020fa:	00 00 00 
+  8020fd:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  802101:	8b 51 0c             	mov    0xc(%rcx),%edx
+  802104:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.read.req_n = n;
+  802106:	4c 89 60 08          	mov    %r12,0x8(%rax)
+    ssize_t res = fsipc(FSREQ_READ, NULL);
+  80210a:	be 00 00 00 00       	mov    $0x0,%esi
+  80210f:	bf 03 00 00 00       	mov    $0x3,%edi
+  802114:	48 b8 da 1d 80 00 00 	movabs $0x801dda,%rax
+  80211b:	00 00 00 
+  80211e:	ff d0                	call   *%rax
+  802120:	4c 63 e8             	movslq %eax,%r13
+    if (res < 0)
+  802123:	4d 85 ed             	test   %r13,%r13
+  802126:	78 2c                	js     802154 <devfile_read+0x100>
+    memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  802128:	4c 89 ea             	mov    %r13,%rdx
+  80212b:	48 be 00 60 80 00 00 	movabs $0x806000,%rsi
+  802132:	00 00 00 
+  802135:	4c 89 f7             	mov    %r14,%rdi
+  802138:	48 b8 22 0f 80 00 00 	movabs $0x800f22,%rax
+  80213f:	00 00 00 
+  802142:	ff d0                	call   *%rax
+    readsz += res;
+  802144:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802148:	49 01 c5             	add    %rax,%r13
+    return readsz;
+  80214b:	eb 07                	jmp    802154 <devfile_read+0x100>
+            return readsz + res;
+  80214d:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802151:	49 01 c5             	add    %rax,%r13
+}
+  802154:	4c 89 e8             	mov    %r13,%rax
+  802157:	48 83 c4 18          	add    $0x18,%rsp
+  80215b:	5b                   	pop    %rbx
+  80215c:	41 5c                	pop    %r12
+  80215e:	41 5d                	pop    %r13
+  802160:	41 5e                	pop    %r14
+  802162:	41 5f                	pop    %r15
+  802164:	5d                   	pop    %rbp
+  802165:	c3                   	ret
+    ssize_t readsz = 0;
+  802166:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  80216d:	00 
+  80216e:	eb 83                	jmp    8020f3 <devfile_read+0x9f>
+
+0000000000802170 <open>:
+open(const char *path, int mode) {
+  802170:	55                   	push   %rbp
+  802171:	48 89 e5             	mov    %rsp,%rbp
+  802174:	41 55                	push   %r13
+  802176:	41 54                	push   %r12
+  802178:	53                   	push   %rbx
+  802179:	48 83 ec 18          	sub    $0x18,%rsp
+  80217d:	49 89 fc             	mov    %rdi,%r12
+  802180:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  802183:	48 b8 83 0c 80 00 00 	movabs $0x800c83,%rax
+  80218a:	00 00 00 
+  80218d:	ff d0                	call   *%rax
+  80218f:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802195:	0f 87 8a 00 00 00    	ja     802225 <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  80219b:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  80219f:	48 b8 53 17 80 00 00 	movabs $0x801753,%rax
+  8021a6:	00 00 00 
+  8021a9:	ff d0                	call   *%rax
+  8021ab:	89 c3                	mov    %eax,%ebx
+  8021ad:	85 c0                	test   %eax,%eax
+  8021af:	78 50                	js     802201 <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  8021b1:	4c 89 e6             	mov    %r12,%rsi
+  8021b4:	48 bb 00 60 80 00 00 	movabs $0x806000,%rbx
+  8021bb:	00 00 00 
+  8021be:	48 89 df             	mov    %rbx,%rdi
+  8021c1:	48 b8 c1 0c 80 00 00 	movabs $0x800cc1,%rax
+  8021c8:	00 00 00 
+  8021cb:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  8021cd:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  8021d4:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8021d8:	bf 01 00 00 00       	mov    $0x1,%edi
+  8021dd:	48 b8 da 1d 80 00 00 	movabs $0x801dda,%rax
+  8021e4:	00 00 00 
+  8021e7:	ff d0                	call   *%rax
+  8021e9:	89 c3                	mov    %eax,%ebx
+  8021eb:	85 c0                	test   %eax,%eax
+  8021ed:	78 1f                	js     80220e <open+0x9e>
+    return fd2num(fd);
+  8021ef:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8021f3:	48 b8 ac 16 80 00 00 	movabs $0x8016ac,%rax
+  8021fa:	00 00 00 
+  8021fd:	ff d0                	call   *%rax
+  8021ff:	89 c3                	mov    %eax,%ebx
+}
+  802201:	89 d8                	mov    %ebx,%eax
+  802203:	48 83 c4 18          	add    $0x18,%rsp
+  802207:	5b                   	pop    %rbx
+  802208:	41 5c                	pop    %r12
+  80220a:	41 5d                	pop    %r13
+  80220c:	5d                   	pop    %rbp
+  80220d:	c3                   	ret
+        fd_close(fd, 0);
+  80220e:	be 00 00 00 00       	mov    $0x0,%esi
+  802213:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802217:	48 b8 28 18 80 00 00 	movabs $0x801828,%rax
+  80221e:	00 00 00 
+  802221:	ff d0                	call   *%rax
+        return res;
+  802223:	eb dc                	jmp    802201 <open+0x91>
+        return -E_BAD_PATH;
+  802225:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  80222a:	eb d5                	jmp    802201 <open+0x91>
+
+000000000080222c <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  80222c:	55                   	push   %rbp
+  80222d:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc(FSREQ_SYNC, NULL);
+  802230:	be 00 00 00 00       	mov    $0x0,%esi
+  802235:	bf 08 00 00 00       	mov    $0x8,%edi
+  80223a:	48 b8 da 1d 80 00 00 	movabs $0x801dda,%rax
+  802241:	00 00 00 
+  802244:	ff d0                	call   *%rax
+}
+  802246:	5d                   	pop    %rbp
+  802247:	c3                   	ret
+
+0000000000802248 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  802248:	55                   	push   %rbp
+  802249:	48 89 e5             	mov    %rsp,%rbp
+  80224c:	41 54                	push   %r12
+  80224e:	53                   	push   %rbx
+  80224f:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802252:	48 b8 be 16 80 00 00 	movabs $0x8016be,%rax
+  802259:	00 00 00 
+  80225c:	ff d0                	call   *%rax
+  80225e:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  802261:	48 be 80 34 80 00 00 	movabs $0x803480,%rsi
+  802268:	00 00 00 
+  80226b:	48 89 df             	mov    %rbx,%rdi
+  80226e:	48 b8 c1 0c 80 00 00 	movabs $0x800cc1,%rax
+  802275:	00 00 00 
+  802278:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  80227a:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  80227f:	41 2b 04 24          	sub    (%r12),%eax
+  802283:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  802289:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  802290:	00 00 00 
+    stat->st_dev = &devpipe;
+  802293:	48 b8 60 40 80 00 00 	movabs $0x804060,%rax
+  80229a:	00 00 00 
+  80229d:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  8022a4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022a9:	5b                   	pop    %rbx
+  8022aa:	41 5c                	pop    %r12
+  8022ac:	5d                   	pop    %rbp
+  8022ad:	c3                   	ret
+
+00000000008022ae <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  8022ae:	55                   	push   %rbp
+  8022af:	48 89 e5             	mov    %rsp,%rbp
+  8022b2:	41 54                	push   %r12
+  8022b4:	53                   	push   %rbx
+  8022b5:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8022b8:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8022bd:	48 89 fe             	mov    %rdi,%rsi
+  8022c0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8022c5:	49 bc 3d 13 80 00 00 	movabs $0x80133d,%r12
+  8022cc:	00 00 00 
+  8022cf:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  8022d2:	48 89 df             	mov    %rbx,%rdi
+  8022d5:	48 b8 be 16 80 00 00 	movabs $0x8016be,%rax
+  8022dc:	00 00 00 
+  8022df:	ff d0                	call   *%rax
+  8022e1:	48 89 c6             	mov    %rax,%rsi
+  8022e4:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8022e9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8022ee:	41 ff d4             	call   *%r12
+}
+  8022f1:	5b                   	pop    %rbx
+  8022f2:	41 5c                	pop    %r12
+  8022f4:	5d                   	pop    %rbp
+  8022f5:	c3                   	ret
+
+00000000008022f6 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8022f6:	55                   	push   %rbp
+  8022f7:	48 89 e5             	mov    %rsp,%rbp
+  8022fa:	41 57                	push   %r15
+  8022fc:	41 56                	push   %r14
+  8022fe:	41 55                	push   %r13
+  802300:	41 54                	push   %r12
+  802302:	53                   	push   %rbx
+  802303:	48 83 ec 18          	sub    $0x18,%rsp
+  802307:	49 89 fc             	mov    %rdi,%r12
+  80230a:	49 89 f5             	mov    %rsi,%r13
+  80230d:	49 89 d7             	mov    %rdx,%r15
+  802310:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802314:	48 b8 be 16 80 00 00 	movabs $0x8016be,%rax
+  80231b:	00 00 00 
+  80231e:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  802320:	4d 85 ff             	test   %r15,%r15
+  802323:	0f 84 af 00 00 00    	je     8023d8 <devpipe_write+0xe2>
+  802329:	48 89 c3             	mov    %rax,%rbx
+  80232c:	4c 89 f8             	mov    %r15,%rax
+  80232f:	4d 89 ef             	mov    %r13,%r15
+  802332:	4c 01 e8             	add    %r13,%rax
+  802335:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802339:	49 bd 45 12 80 00 00 	movabs $0x801245,%r13
+  802340:	00 00 00 
+            sys_yield();
+  802343:	49 be e2 11 80 00 00 	movabs $0x8011e2,%r14
+  80234a:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  80234d:	8b 73 04             	mov    0x4(%rbx),%esi
+  802350:	48 63 ce             	movslq %esi,%rcx
+  802353:	48 63 03             	movslq (%rbx),%rax
+  802356:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  80235c:	48 39 c1             	cmp    %rax,%rcx
+  80235f:	72 2e                	jb     80238f <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802361:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802366:	48 89 da             	mov    %rbx,%rdx
+  802369:	be 00 10 00 00       	mov    $0x1000,%esi
+  80236e:	4c 89 e7             	mov    %r12,%rdi
+  802371:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  802374:	85 c0                	test   %eax,%eax
+  802376:	74 66                	je     8023de <devpipe_write+0xe8>
+            sys_yield();
+  802378:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  80237b:	8b 73 04             	mov    0x4(%rbx),%esi
+  80237e:	48 63 ce             	movslq %esi,%rcx
+  802381:	48 63 03             	movslq (%rbx),%rax
+  802384:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  80238a:	48 39 c1             	cmp    %rax,%rcx
+  80238d:	73 d2                	jae    802361 <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  80238f:	41 0f b6 3f          	movzbl (%r15),%edi
+  802393:	48 89 ca             	mov    %rcx,%rdx
+  802396:	48 c1 ea 03          	shr    $0x3,%rdx
+  80239a:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  8023a1:	08 10 20 
+  8023a4:	48 f7 e2             	mul    %rdx
+  8023a7:	48 c1 ea 06          	shr    $0x6,%rdx
+  8023ab:	48 89 d0             	mov    %rdx,%rax
+  8023ae:	48 c1 e0 09          	shl    $0x9,%rax
+  8023b2:	48 29 d0             	sub    %rdx,%rax
+  8023b5:	48 c1 e0 03          	shl    $0x3,%rax
+  8023b9:	48 29 c1             	sub    %rax,%rcx
+  8023bc:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  8023c1:	83 c6 01             	add    $0x1,%esi
+  8023c4:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8023c7:	49 83 c7 01          	add    $0x1,%r15
+  8023cb:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8023cf:	49 39 c7             	cmp    %rax,%r15
+  8023d2:	0f 85 75 ff ff ff    	jne    80234d <devpipe_write+0x57>
+    return n;
+  8023d8:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8023dc:	eb 05                	jmp    8023e3 <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  8023de:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8023e3:	48 83 c4 18          	add    $0x18,%rsp
+  8023e7:	5b                   	pop    %rbx
+  8023e8:	41 5c                	pop    %r12
+  8023ea:	41 5d                	pop    %r13
+  8023ec:	41 5e                	pop    %r14
+  8023ee:	41 5f                	pop    %r15
+  8023f0:	5d                   	pop    %rbp
+  8023f1:	c3                   	ret
+
+00000000008023f2 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  8023f2:	55                   	push   %rbp
+  8023f3:	48 89 e5             	mov    %rsp,%rbp
+  8023f6:	41 57                	push   %r15
+  8023f8:	41 56                	push   %r14
+  8023fa:	41 55                	push   %r13
+  8023fc:	41 54                	push   %r12
+  8023fe:	53                   	push   %rbx
+  8023ff:	48 83 ec 18          	sub    $0x18,%rsp
+  802403:	49 89 fc             	mov    %rdi,%r12
+  802406:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  80240a:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80240e:	48 b8 be 16 80 00 00 	movabs $0x8016be,%rax
+  802415:	00 00 00 
+  802418:	ff d0                	call   *%rax
+  80241a:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  80241d:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802423:	49 bd 45 12 80 00 00 	movabs $0x801245,%r13
+  80242a:	00 00 00 
+            sys_yield();
+  80242d:	49 be e2 11 80 00 00 	movabs $0x8011e2,%r14
+  802434:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  802437:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  80243c:	74 7d                	je     8024bb <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  80243e:	8b 03                	mov    (%rbx),%eax
+  802440:	3b 43 04             	cmp    0x4(%rbx),%eax
+  802443:	75 26                	jne    80246b <devpipe_read+0x79>
+            if (i > 0) return i;
+  802445:	4d 85 ff             	test   %r15,%r15
+  802448:	75 77                	jne    8024c1 <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80244a:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80244f:	48 89 da             	mov    %rbx,%rdx
+  802452:	be 00 10 00 00       	mov    $0x1000,%esi
+  802457:	4c 89 e7             	mov    %r12,%rdi
+  80245a:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  80245d:	85 c0                	test   %eax,%eax
+  80245f:	74 72                	je     8024d3 <devpipe_read+0xe1>
+            sys_yield();
+  802461:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  802464:	8b 03                	mov    (%rbx),%eax
+  802466:	3b 43 04             	cmp    0x4(%rbx),%eax
+  802469:	74 df                	je     80244a <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  80246b:	48 63 c8             	movslq %eax,%rcx
+  80246e:	48 89 ca             	mov    %rcx,%rdx
+  802471:	48 c1 ea 03          	shr    $0x3,%rdx
+  802475:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  80247c:	08 10 20 
+  80247f:	48 89 d0             	mov    %rdx,%rax
+  802482:	48 f7 e6             	mul    %rsi
+  802485:	48 c1 ea 06          	shr    $0x6,%rdx
+  802489:	48 89 d0             	mov    %rdx,%rax
+  80248c:	48 c1 e0 09          	shl    $0x9,%rax
+  802490:	48 29 d0             	sub    %rdx,%rax
+  802493:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  80249a:	00 
+  80249b:	48 89 c8             	mov    %rcx,%rax
+  80249e:	48 29 d0             	sub    %rdx,%rax
+  8024a1:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  8024a6:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8024aa:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  8024ae:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8024b1:	49 83 c7 01          	add    $0x1,%r15
+  8024b5:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  8024b9:	75 83                	jne    80243e <devpipe_read+0x4c>
+    return n;
+  8024bb:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8024bf:	eb 03                	jmp    8024c4 <devpipe_read+0xd2>
+            if (i > 0) return i;
+  8024c1:	4c 89 f8             	mov    %r15,%rax
+}
+  8024c4:	48 83 c4 18          	add    $0x18,%rsp
+  8024c8:	5b                   	pop    %rbx
+  8024c9:	41 5c                	pop    %r12
+  8024cb:	41 5d                	pop    %r13
+  8024cd:	41 5e                	pop    %r14
+  8024cf:	41 5f                	pop    %r15
+  8024d1:	5d                   	pop    %rbp
+  8024d2:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  8024d3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024d8:	eb ea                	jmp    8024c4 <devpipe_read+0xd2>
+
+00000000008024da <pipe>:
+pipe(int pfd[2]) {
+  8024da:	55                   	push   %rbp
+  8024db:	48 89 e5             	mov    %rsp,%rbp
+  8024de:	41 55                	push   %r13
+  8024e0:	41 54                	push   %r12
+  8024e2:	53                   	push   %rbx
+  8024e3:	48 81 ec b8 00 00 00 	sub    $0xb8,%rsp
+  8024ea:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8024ed:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  8024f1:	48 b8 53 17 80 00 00 	movabs $0x801753,%rax
+  8024f8:	00 00 00 
+  8024fb:	ff d0                	call   *%rax
+  8024fd:	89 c3                	mov    %eax,%ebx
+  8024ff:	85 c0                	test   %eax,%eax
+  802501:	0f 88 51 01 00 00    	js     802658 <pipe+0x17e>
+        (res = fd_alloc_from(fd2num(fd0) + 1, &fd1)) < 0) goto err;
+  802507:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80250b:	48 b8 ac 16 80 00 00 	movabs $0x8016ac,%rax
+  802512:	00 00 00 
+  802515:	ff d0                	call   *%rax
+  802517:	8d 78 01             	lea    0x1(%rax),%edi
+  80251a:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80251e:	48 b8 da 16 80 00 00 	movabs $0x8016da,%rax
+  802525:	00 00 00 
+  802528:	ff d0                	call   *%rax
+  80252a:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  80252c:	85 c0                	test   %eax,%eax
+  80252e:	0f 88 24 01 00 00    	js     802658 <pipe+0x17e>
+    va = fd2data(fd0);
+  802534:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802538:	48 bb be 16 80 00 00 	movabs $0x8016be,%rbx
+  80253f:	00 00 00 
+  802542:	ff d3                	call   *%rbx
+  802544:	49 89 c5             	mov    %rax,%r13
+    struct RegionOp ops[] = {
+  802547:	48 8d bd 30 ff ff ff 	lea    -0xd0(%rbp),%rdi
+  80254e:	b9 14 00 00 00       	mov    $0x14,%ecx
+  802553:	b8 00 00 00 00       	mov    $0x0,%eax
+  802558:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+  80255b:	c7 85 34 ff ff ff 46 	movl   $0x46,-0xcc(%rbp)
+  802562:	00 00 00 
+  802565:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802569:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+  802570:	48 c7 85 50 ff ff ff 	movq   $0x1000,-0xb0(%rbp)
+  802577:	00 10 00 00 
+  80257b:	c7 85 5c ff ff ff 46 	movl   $0x46,-0xa4(%rbp)
+  802582:	00 00 00 
+            {.type = REGION_ALLOC, .dstva = (uintptr_t)fd1, .size = PAGE_SIZE, .perm = PROT_RW | PROT_SHARE},
+  802585:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+    struct RegionOp ops[] = {
+  802589:	48 89 bd 70 ff ff ff 	mov    %rdi,-0x90(%rbp)
+  802590:	48 c7 85 78 ff ff ff 	movq   $0x1000,-0x88(%rbp)
+  802597:	00 10 00 00 
+  80259b:	c7 45 84 46 00 00 00 	movl   $0x46,-0x7c(%rbp)
+  8025a2:	4c 89 6d 98          	mov    %r13,-0x68(%rbp)
+  8025a6:	48 c7 45 a0 00 10 00 	movq   $0x1000,-0x60(%rbp)
+  8025ad:	00 
+  8025ae:	c7 45 a8 01 00 00 00 	movl   $0x1,-0x58(%rbp)
+  8025b5:	c7 45 ac 46 00 00 00 	movl   $0x46,-0x54(%rbp)
+  8025bc:	4c 89 6d b8          	mov    %r13,-0x48(%rbp)
+            {.type = REGION_MAP, .srcva = (uintptr_t)va, .dstva = (uintptr_t)fd2data(fd1), .size = PAGE_SIZE, .perm = PROT_RW | PROT_SHARE},
+  8025c0:	ff d3                	call   *%rbx
+    struct RegionOp ops[] = {
+  8025c2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8025c6:	48 c7 45 c8 00 10 00 	movq   $0x1000,-0x38(%rbp)
+  8025cd:	00 
+    if ((res = sys_region_batch(ops, sizeof ops / sizeof *ops)) < 0) goto err1;
+  8025ce:	be 04 00 00 00       	mov    $0x4,%esi
+  8025d3:	48 8d bd 30 ff ff ff 	lea    -0xd0(%rbp),%rdi
+  8025da:	48 b8 a4 13 80 00 00 	movabs $0x8013a4,%rax
+  8025e1:	00 00 00 
+  8025e4:	ff d0                	call   *%rax
+  8025e6:	89 c3                	mov    %eax,%ebx
+  8025e8:	85 c0                	test   %eax,%eax
+  8025ea:	0f 88 ad 00 00 00    	js     80269d <pipe+0x1c3>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8025f0:	be 00 10 00 00       	mov    $0x1000,%esi
+  8025f5:	4c 89 ef             	mov    %r13,%rdi
+  8025f8:	48 b8 13 12 80 00 00 	movabs $0x801213,%rax
+  8025ff:	00 00 00 
+  802602:	ff d0                	call   *%rax
+  802604:	83 f8 02             	cmp    $0x2,%eax
+  802607:	75 5f                	jne    802668 <pipe+0x18e>
+    fd0->fd_dev_id = devpipe.dev_id;
+  802609:	a1 60 40 80 00 00 00 	movabs 0x804060,%eax
+  802610:	00 00 
+  802612:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802616:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  802618:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80261c:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  802623:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  802627:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  802629:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80262d:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  802634:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802638:	48 bb ac 16 80 00 00 	movabs $0x8016ac,%rbx
+  80263f:	00 00 00 
+  802642:	ff d3                	call   *%rbx
+  802644:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  802648:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  80264c:	ff d3                	call   *%rbx
+  80264e:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  802653:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  802658:	89 d8                	mov    %ebx,%eax
+  80265a:	48 81 c4 b8 00 00 00 	add    $0xb8,%rsp
+  802661:	5b                   	pop    %rbx
+  802662:	41 5c                	pop    %r12
+  802664:	41 5d                	pop    %r13
+  802666:	5d                   	pop    %rbp
+  802667:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  802668:	48 b9 b0 34 80 00 00 	movabs $0x8034b0,%rcx
+  80266f:	00 00 00 
+  802672:	48 ba 87 34 80 00 00 	movabs $0x803487,%rdx
+  802679:	00 00 00 
+  80267c:	be 33 00 00 00       	mov    $0x33,%esi
+  802681:	48 bf 9c 34 80 00 00 	movabs $0x80349c,%rdi
+  802688:	00 00 00 
+  80268b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802690:	49 b8 4c 02 80 00 00 	movabs $0x80024c,%r8
+  802697:	00 00 00 
+  80269a:	41 ff d0             	call   *%r8
+        ops[i].type = REGION_UNMAP;
+  80269d:	c7 85 30 ff ff ff 02 	movl   $0x2,-0xd0(%rbp)
+  8026a4:	00 00 00 
+  8026a7:	c7 85 58 ff ff ff 02 	movl   $0x2,-0xa8(%rbp)
+  8026ae:	00 00 00 
+  8026b1:	c7 45 80 02 00 00 00 	movl   $0x2,-0x80(%rbp)
+  8026b8:	c7 45 a8 02 00 00 00 	movl   $0x2,-0x58(%rbp)
+    sys_region_batch(ops, sizeof ops / sizeof *ops);
+  8026bf:	be 04 00 00 00       	mov    $0x4,%esi
+  8026c4:	48 8d bd 30 ff ff ff 	lea    -0xd0(%rbp),%rdi
+  8026cb:	48 b8 a4 13 80 00 00 	movabs $0x8013a4,%rax
+  8026d2:	00 00 00 
+  8026d5:	ff d0                	call   *%rax
+  8026d7:	e9 7c ff ff ff       	jmp    802658 <pipe+0x17e>
+
+00000000008026dc <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  8026dc:	55                   	push   %rbp
+  8026dd:	48 89 e5             	mov    %rsp,%rbp
+  8026e0:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8026e4:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8026e8:	48 b8 6d 17 80 00 00 	movabs $0x80176d,%rax
+  8026ef:	00 00 00 
+  8026f2:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8026f4:	85 c0                	test   %eax,%eax
+  8026f6:	78 35                	js     80272d <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  8026f8:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8026fc:	48 b8 be 16 80 00 00 	movabs $0x8016be,%rax
+  802703:	00 00 00 
+  802706:	ff d0                	call   *%rax
+  802708:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80270b:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802710:	be 00 10 00 00       	mov    $0x1000,%esi
+  802715:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802719:	48 b8 45 12 80 00 00 	movabs $0x801245,%rax
+  802720:	00 00 00 
+  802723:	ff d0                	call   *%rax
+  802725:	85 c0                	test   %eax,%eax
+  802727:	0f 94 c0             	sete   %al
+  80272a:	0f b6 c0             	movzbl %al,%eax
+}
+  80272d:	c9                   	leave
+  80272e:	c3                   	ret
+
+000000000080272f <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  80272f:	48 89 f8             	mov    %rdi,%rax
+  802732:	48 c1 e8 27          	shr    $0x27,%rax
+  802736:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  80273d:	01 00 00 
+  802740:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802744:	f6 c2 01             	test   $0x1,%dl
+  802747:	74 6d                	je     8027b6 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  802749:	48 89 f8             	mov    %rdi,%rax
+  80274c:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802750:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802757:	01 00 00 
+  80275a:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80275e:	f6 c2 01             	test   $0x1,%dl
+  802761:	74 62                	je     8027c5 <get_uvpt_entry+0x96>
+  802763:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  80276a:	01 00 00 
+  80276d:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802771:	f6 c2 80             	test   $0x80,%dl
+  802774:	75 4f                	jne    8027c5 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  802776:	48 89 f8             	mov    %rdi,%rax
+  802779:	48 c1 e8 15          	shr    $0x15,%rax
+  80277d:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802784:	01 00 00 
+  802787:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80278b:	f6 c2 01             	test   $0x1,%dl
+  80278e:	74 44                	je     8027d4 <get_uvpt_entry+0xa5>
+  802790:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802797:	01 00 00 
+  80279a:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80279e:	f6 c2 80             	test   $0x80,%dl
+  8027a1:	75 31                	jne    8027d4 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  8027a3:	48 c1 ef 0c          	shr    $0xc,%rdi
+  8027a7:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8027ae:	01 00 00 
+  8027b1:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  8027b5:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8027b6:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  8027bd:	01 00 00 
+  8027c0:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8027c4:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8027c5:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8027cc:	01 00 00 
+  8027cf:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8027d3:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8027d4:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8027db:	01 00 00 
+  8027de:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8027e2:	c3                   	ret
+
+00000000008027e3 <get_prot>:
+
+int
+get_prot(void *va) {
+  8027e3:	55                   	push   %rbp
+  8027e4:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8027e7:	48 b8 2f 27 80 00 00 	movabs $0x80272f,%rax
+  8027ee:	00 00 00 
+  8027f1:	ff d0                	call   *%rax
+  8027f3:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  8027f6:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  8027fb:	89 c1                	mov    %eax,%ecx
+  8027fd:	83 c9 04             	or     $0x4,%ecx
+  802800:	f6 c2 01             	test   $0x1,%dl
+  802803:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  802806:	89 c1                	mov    %eax,%ecx
+  802808:	83 c9 02             	or     $0x2,%ecx
+  80280b:	f6 c2 02             	test   $0x2,%dl
+  80280e:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  802811:	89 c1                	mov    %eax,%ecx
+  802813:	83 c9 01             	or     $0x1,%ecx
+  802816:	48 85 d2             	test   %rdx,%rdx
+  802819:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  80281c:	89 c1                	mov    %eax,%ecx
+  80281e:	83 c9 40             	or     $0x40,%ecx
+  802821:	f6 c6 04             	test   $0x4,%dh
+  802824:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  802827:	5d                   	pop    %rbp
+  802828:	c3                   	ret
+
+0000000000802829 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  802829:	55                   	push   %rbp
+  80282a:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  80282d:	48 b8 2f 27 80 00 00 	movabs $0x80272f,%rax
+  802834:	00 00 00 
+  802837:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  802839:	48 c1 e8 06          	shr    $0x6,%rax
+  80283d:	83 e0 01             	and    $0x1,%eax
+}
+  802840:	5d                   	pop    %rbp
+  802841:	c3                   	ret
+
+0000000000802842 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  802842:	55                   	push   %rbp
+  802843:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  802846:	48 b8 2f 27 80 00 00 	movabs $0x80272f,%rax
+  80284d:	00 00 00 
+  802850:	ff d0                	call   *%rax
+  802852:	83 e0 01             	and    $0x1,%eax
+}
+  802855:	5d                   	pop    %rbp
+  802856:	c3                   	ret
+
+0000000000802857 <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  802857:	55                   	push   %rbp
+  802858:	48 89 e5             	mov    %rsp,%rbp
+  80285b:	41 57                	push   %r15
+  80285d:	41 56                	push   %r14
+  80285f:	41 55                	push   %r13
+  802861:	41 54                	push   %r12
+  802863:	53                   	push   %rbx
+  802864:	48 83 ec 38          	sub    $0x38,%rsp
+  802868:	49 89 f7             	mov    %rsi,%r15
+  80286b:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+                    }
+                    continue;
+                }
+                for (int ptei = 0; ptei < PT_ENTRY_COUNT; ptei++) {
+                    uintptr_t pte_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, pdei, ptei, 0);
+                    pte_t pte = uvpt[VPT(pte_addr)];
+  802871:	49 bd 00 00 00 00 00 	movabs $0x10000000000,%r13
+  802878:	01 00 00 
+  80287b:	4d 89 e6             	mov    %r12,%r14
+  80287e:	49 89 fc             	mov    %rdi,%r12
+  802881:	e9 19 01 00 00       	jmp    80299f <foreach_shared_region+0x148>
+  802886:	48 89 5d b0          	mov    %rbx,-0x50(%rbp)
+  80288a:	4c 89 75 a8          	mov    %r14,-0x58(%rbp)
+  80288e:	eb 52                	jmp    8028e2 <foreach_shared_region+0x8b>
+                for (int ptei = 0; ptei < PT_ENTRY_COUNT; ptei++) {
+  802890:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802897:	48 81 fb 00 00 20 00 	cmp    $0x200000,%rbx
+  80289e:	74 2e                	je     8028ce <foreach_shared_region+0x77>
+                    uintptr_t pte_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, pdei, ptei, 0);
+  8028a0:	48 89 df             	mov    %rbx,%rdi
+  8028a3:	4c 09 f7             	or     %r14,%rdi
+                    pte_t pte = uvpt[VPT(pte_addr)];
+  8028a6:	48 89 f8             	mov    %rdi,%rax
+  8028a9:	48 c1 e8 0c          	shr    $0xc,%rax
+  8028ad:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+                    if ((pte & PTE_P) && (pte & PTE_SHARE)) {
+  8028b2:	25 01 04 00 00       	and    $0x401,%eax
+  8028b7:	48 3d 01 04 00 00    	cmp    $0x401,%rax
+  8028bd:	75 d1                	jne    802890 <foreach_shared_region+0x39>
+                        fun((void*)pte_addr, (void*)(pte_addr + PAGE_SIZE), arg);
+  8028bf:	48 8d b7 00 10 00 00 	lea    0x1000(%rdi),%rsi
+  8028c6:	4c 89 fa             	mov    %r15,%rdx
+  8028c9:	41 ff d4             	call   *%r12
+  8028cc:	eb c2                	jmp    802890 <foreach_shared_region+0x39>
+            for (int pdei = 0; pdei < PD_ENTRY_COUNT; pdei++) {
+  8028ce:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  8028d5:	00 
+  8028d6:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8028da:	48 3d 00 00 00 40    	cmp    $0x40000000,%rax
+  8028e0:	74 46                	je     802928 <foreach_shared_region+0xd1>
+                uintptr_t pde_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, pdei, 0, 0);
+  8028e2:	4c 8b 75 c8          	mov    -0x38(%rbp),%r14
+  8028e6:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8028ea:	49 09 c6             	or     %rax,%r14
+                pde_t pde = uvpd[VPD(pde_addr)];
+  8028ed:	4c 89 f0             	mov    %r14,%rax
+  8028f0:	48 c1 e8 15          	shr    $0x15,%rax
+  8028f4:	48 b9 00 00 00 80 00 	movabs $0x10080000000,%rcx
+  8028fb:	01 00 00 
+  8028fe:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+                if (!(pde & PTE_P)) {
+  802902:	a8 01                	test   $0x1,%al
+  802904:	74 c8                	je     8028ce <foreach_shared_region+0x77>
+                if (pde & PTE_PS) {
+  802906:	48 89 c3             	mov    %rax,%rbx
+  802909:	81 e3 80 00 00 00    	and    $0x80,%ebx
+  80290f:	74 8f                	je     8028a0 <foreach_shared_region+0x49>
+                    if (pde & PTE_SHARE) {
+  802911:	f6 c4 04             	test   $0x4,%ah
+  802914:	74 b8                	je     8028ce <foreach_shared_region+0x77>
+                        fun((void*)pde_addr, (void*)(pde_addr + 1024 * 1024 * 2), arg);
+  802916:	49 8d b6 00 00 20 00 	lea    0x200000(%r14),%rsi
+  80291d:	4c 89 fa             	mov    %r15,%rdx
+  802920:	4c 89 f7             	mov    %r14,%rdi
+  802923:	41 ff d4             	call   *%r12
+  802926:	eb a6                	jmp    8028ce <foreach_shared_region+0x77>
+  802928:	48 8b 5d b0          	mov    -0x50(%rbp),%rbx
+  80292c:	4c 8b 75 a8          	mov    -0x58(%rbp),%r14
+        for (int pdpei = 0; pdpei < PDP_ENTRY_COUNT; pdpei++) {
+  802930:	48 81 c3 00 00 00 40 	add    $0x40000000,%rbx
+  802937:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80293e:	00 00 00 
+  802941:	48 39 c3             	cmp    %rax,%rbx
+  802944:	74 4c                	je     802992 <foreach_shared_region+0x13b>
+            uintptr_t pdpe_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, 0, 0, 0);
+  802946:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  80294a:	48 09 d8             	or     %rbx,%rax
+  80294d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+            pdpe_t pdpe = uvpdp[VPDP(pdpe_addr)];
+  802951:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802955:	48 b9 00 00 40 80 00 	movabs $0x10080400000,%rcx
+  80295c:	01 00 00 
+  80295f:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+            if (!(pdpe & PTE_P)) {
+  802963:	a8 01                	test   $0x1,%al
+  802965:	74 c9                	je     802930 <foreach_shared_region+0xd9>
+            if (pdpe & PTE_PS) {
+  802967:	48 89 c1             	mov    %rax,%rcx
+  80296a:	81 e1 80 00 00 00    	and    $0x80,%ecx
+  802970:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  802974:	0f 84 0c ff ff ff    	je     802886 <foreach_shared_region+0x2f>
+                if (pdpe & PTE_SHARE) {
+  80297a:	f6 c4 04             	test   $0x4,%ah
+  80297d:	74 b1                	je     802930 <foreach_shared_region+0xd9>
+                    fun((void*)pdpe_addr, (void*)(pdpe_addr + 1024 * 1024 * 1024), arg); 
+  80297f:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  802983:	48 8d b7 00 00 00 40 	lea    0x40000000(%rdi),%rsi
+  80298a:	4c 89 fa             	mov    %r15,%rdx
+  80298d:	41 ff d4             	call   *%r12
+  802990:	eb 9e                	jmp    802930 <foreach_shared_region+0xd9>
+    for (int pml4ei = 0; pml4ei < PML4_ENTRY_COUNT; pml4ei++) {
+  802992:	49 83 c6 01          	add    $0x1,%r14
+  802996:	49 81 fe 00 02 00 00 	cmp    $0x200,%r14
+  80299d:	74 24                	je     8029c3 <foreach_shared_region+0x16c>
+        pml4e_t pml4e = uvpml4[VPML4(pml4_addr)];
+  80299f:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  8029a6:	01 00 00 
+  8029a9:	4a 8b 04 f0          	mov    (%rax,%r14,8),%rax
+        if (!(pml4e & PTE_P)) {
+  8029ad:	a8 01                	test   $0x1,%al
+  8029af:	74 e1                	je     802992 <foreach_shared_region+0x13b>
+  8029b1:	4c 89 f0             	mov    %r14,%rax
+  8029b4:	48 c1 e0 27          	shl    $0x27,%rax
+  8029b8:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8029bc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8029c1:	eb 83                	jmp    802946 <foreach_shared_region+0xef>
+            }
+        }
+    }
+    
+    return 0;
+}
+  8029c3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029c8:	48 83 c4 38          	add    $0x38,%rsp
+  8029cc:	5b                   	pop    %rbx
+  8029cd:	41 5c                	pop    %r12
+  8029cf:	41 5d                	pop    %r13
+  8029d1:	41 5e                	pop    %r14
+  8029d3:	41 5f                	pop    %r15
+  8029d5:	5d                   	pop    %rbp
+  8029d6:	c3                   	ret
+
+00000000008029d7 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  8029d7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029dc:	c3                   	ret
+
+00000000008029dd <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  8029dd:	55                   	push   %rbp
+  8029de:	48 89 e5             	mov    %rsp,%rbp
+  8029e1:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  8029e4:	48 be d4 34 80 00 00 	movabs $0x8034d4,%rsi
+  8029eb:	00 00 00 
+  8029ee:	48 b8 c1 0c 80 00 00 	movabs $0x800cc1,%rax
+  8029f5:	00 00 00 
+  8029f8:	ff d0                	call   *%rax
+    return 0;
+}
+  8029fa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029ff:	5d                   	pop    %rbp
+  802a00:	c3                   	ret
+
+0000000000802a01 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  802a01:	55                   	push   %rbp
+  802a02:	48 89 e5             	mov    %rsp,%rbp
+  802a05:	41 57                	push   %r15
+  802a07:	41 56                	push   %r14
+  802a09:	41 55                	push   %r13
+  802a0b:	41 54                	push   %r12
+  802a0d:	53                   	push   %rbx
+  802a0e:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  802a15:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  802a1c:	48 85 d2             	test   %rdx,%rdx
+  802a1f:	74 7a                	je     802a9b <devcons_write+0x9a>
+  802a21:	49 89 d6             	mov    %rdx,%r14
+  802a24:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802a2a:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  802a2f:	49 bf bb 0e 80 00 00 	movabs $0x800ebb,%r15
+  802a36:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  802a39:	4c 89 f3             	mov    %r14,%rbx
+  802a3c:	48 29 f3             	sub    %rsi,%rbx
+  802a3f:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802a44:	48 39 c3             	cmp    %rax,%rbx
+  802a47:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  802a4b:	4c 63 eb             	movslq %ebx,%r13
+  802a4e:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  802a55:	48 01 c6             	add    %rax,%rsi
+  802a58:	4c 89 ea             	mov    %r13,%rdx
+  802a5b:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802a62:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  802a65:	4c 89 ee             	mov    %r13,%rsi
+  802a68:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802a6f:	48 b8 e8 10 80 00 00 	movabs $0x8010e8,%rax
+  802a76:	00 00 00 
+  802a79:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  802a7b:	41 01 dc             	add    %ebx,%r12d
+  802a7e:	49 63 f4             	movslq %r12d,%rsi
+  802a81:	4c 39 f6             	cmp    %r14,%rsi
+  802a84:	72 b3                	jb     802a39 <devcons_write+0x38>
+    return res;
+  802a86:	49 63 c4             	movslq %r12d,%rax
+}
+  802a89:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  802a90:	5b                   	pop    %rbx
+  802a91:	41 5c                	pop    %r12
+  802a93:	41 5d                	pop    %r13
+  802a95:	41 5e                	pop    %r14
+  802a97:	41 5f                	pop    %r15
+  802a99:	5d                   	pop    %rbp
+  802a9a:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  802a9b:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802aa1:	eb e3                	jmp    802a86 <devcons_write+0x85>
+
+0000000000802aa3 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  802aa3:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  802aa6:	ba 00 00 00 00       	mov    $0x0,%edx
+  802aab:	48 85 c0             	test   %rax,%rax
+  802aae:	74 55                	je     802b05 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  802ab0:	55                   	push   %rbp
+  802ab1:	48 89 e5             	mov    %rsp,%rbp
+  802ab4:	41 55                	push   %r13
+  802ab6:	41 54                	push   %r12
+  802ab8:	53                   	push   %rbx
+  802ab9:	48 83 ec 08          	sub    $0x8,%rsp
+  802abd:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  802ac0:	48 bb 15 11 80 00 00 	movabs $0x801115,%rbx
+  802ac7:	00 00 00 
+  802aca:	49 bc e2 11 80 00 00 	movabs $0x8011e2,%r12
+  802ad1:	00 00 00 
+  802ad4:	eb 03                	jmp    802ad9 <devcons_read+0x36>
+  802ad6:	41 ff d4             	call   *%r12
+  802ad9:	ff d3                	call   *%rbx
+  802adb:	85 c0                	test   %eax,%eax
+  802add:	74 f7                	je     802ad6 <devcons_read+0x33>
+    if (c < 0) return c;
+  802adf:	48 63 d0             	movslq %eax,%rdx
+  802ae2:	78 13                	js     802af7 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  802ae4:	ba 00 00 00 00       	mov    $0x0,%edx
+  802ae9:	83 f8 04             	cmp    $0x4,%eax
+  802aec:	74 09                	je     802af7 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  802aee:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  802af2:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  802af7:	48 89 d0             	mov    %rdx,%rax
+  802afa:	48 83 c4 08          	add    $0x8,%rsp
+  802afe:	5b                   	pop    %rbx
+  802aff:	41 5c                	pop    %r12
+  802b01:	41 5d                	pop    %r13
+  802b03:	5d                   	pop    %rbp
+  802b04:	c3                   	ret
+  802b05:	48 89 d0             	mov    %rdx,%rax
+  802b08:	c3                   	ret
+
+0000000000802b09 <cputchar>:
+cputchar(int ch) {
+  802b09:	55                   	push   %rbp
+  802b0a:	48 89 e5             	mov    %rsp,%rbp
+  802b0d:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  802b11:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  802b15:	be 01 00 00 00       	mov    $0x1,%esi
+  802b1a:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  802b1e:	48 b8 e8 10 80 00 00 	movabs $0x8010e8,%rax
+  802b25:	00 00 00 
+  802b28:	ff d0                	call   *%rax
+}
+  802b2a:	c9                   	leave
+  802b2b:	c3                   	ret
+
+0000000000802b2c <getchar>:
+getchar(void) {
+  802b2c:	55                   	push   %rbp
+  802b2d:	48 89 e5             	mov    %rsp,%rbp
+  802b30:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  802b34:	ba 01 00 00 00       	mov    $0x1,%edx
+  802b39:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  802b3d:	bf 00 00 00 00       	mov    $0x0,%edi
+  802b42:	48 b8 50 1a 80 00 00 	movabs $0x801a50,%rax
+  802b49:	00 00 00 
+  802b4c:	ff d0                	call   *%rax
+  802b4e:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  802b50:	85 c0                	test   %eax,%eax
+  802b52:	78 06                	js     802b5a <getchar+0x2e>
+  802b54:	74 08                	je     802b5e <getchar+0x32>
+  802b56:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  802b5a:	89 d0                	mov    %edx,%eax
+  802b5c:	c9                   	leave
+  802b5d:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  802b5e:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  802b63:	eb f5                	jmp    802b5a <getchar+0x2e>
+
+0000000000802b65 <iscons>:
+iscons(int fdnum) {
+  802b65:	55                   	push   %rbp
+  802b66:	48 89 e5             	mov    %rsp,%rbp
+  802b69:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  802b6d:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802b71:	48 b8 6d 17 80 00 00 	movabs $0x80176d,%rax
+  802b78:	00 00 00 
+  802b7b:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802b7d:	85 c0                	test   %eax,%eax
+  802b7f:	78 18                	js     802b99 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  802b81:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802b85:	48 b8 a0 40 80 00 00 	movabs $0x8040a0,%rax
+  802b8c:	00 00 00 
+  802b8f:	8b 00                	mov    (%rax),%eax
+  802b91:	39 02                	cmp    %eax,(%rdx)
+  802b93:	0f 94 c0             	sete   %al
+  802b96:	0f b6 c0             	movzbl %al,%eax
+}
+  802b99:	c9                   	leave
+  802b9a:	c3                   	ret
+
+0000000000802b9b <opencons>:
+opencons(void) {
+  802b9b:	55                   	push   %rbp
+  802b9c:	48 89 e5             	mov    %rsp,%rbp
+  802b9f:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802ba3:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  802ba7:	48 b8 53 17 80 00 00 	movabs $0x801753,%rax
+  802bae:	00 00 00 
+  802bb1:	ff d0                	call   *%rax
+  802bb3:	85 c0                	test   %eax,%eax
+  802bb5:	78 49                	js     802c00 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  802bb7:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802bbc:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802bc1:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  802bc5:	bf 00 00 00 00       	mov    $0x0,%edi
+  802bca:	48 b8 71 12 80 00 00 	movabs $0x801271,%rax
+  802bd1:	00 00 00 
+  802bd4:	ff d0                	call   *%rax
+  802bd6:	85 c0                	test   %eax,%eax
+  802bd8:	78 26                	js     802c00 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  802bda:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802bde:	a1 a0 40 80 00 00 00 	movabs 0x8040a0,%eax
+  802be5:	00 00 
+  802be7:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  802be9:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802bed:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  802bf4:	48 b8 ac 16 80 00 00 	movabs $0x8016ac,%rax
+  802bfb:	00 00 00 
+  802bfe:	ff d0                	call   *%rax
+}
+  802c00:	c9                   	leave
+  802c01:	c3                   	ret
+
+0000000000802c02 <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  802c02:	55                   	push   %rbp
+  802c03:	48 89 e5             	mov    %rsp,%rbp
+  802c06:	41 55                	push   %r13
+  802c08:	41 54                	push   %r12
+  802c0a:	53                   	push   %rbx
+  802c0b:	48 83 ec 08          	sub    $0x8,%rsp
+  802c0f:	49 89 fc             	mov    %rdi,%r12
+  802c12:	48 89 f7             	mov    %rsi,%rdi
+  802c15:	48 89 d3             	mov    %rdx,%rbx
+  802c18:	49 89 cd             	mov    %rcx,%r13
+    // LAB 9: Your code here:
+    int res = sys_ipc_recv(!pg ? (void*)MAX_USER_ADDRESS : pg, !size ? 0 : *size);
+  802c1b:	be 00 00 00 00       	mov    $0x0,%esi
+  802c20:	48 85 d2             	test   %rdx,%rdx
+  802c23:	74 03                	je     802c28 <ipc_recv+0x26>
+  802c25:	48 8b 32             	mov    (%rdx),%rsi
+  802c28:	48 85 ff             	test   %rdi,%rdi
+  802c2b:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802c32:	00 00 00 
+  802c35:	48 0f 44 f8          	cmove  %rax,%rdi
+  802c39:	48 b8 43 16 80 00 00 	movabs $0x801643,%rax
+  802c40:	00 00 00 
+  802c43:	ff d0                	call   *%rax
+    if (res < 0) {
+  802c45:	85 c0                	test   %eax,%eax
+  802c47:	78 66                	js     802caf <ipc_recv+0xad>
+        if (size) {
+            *size = 0;
+        }
+        return res;
+    }
+    if (from_env_store) {
+  802c49:	4d 85 e4             	test   %r12,%r12
+  802c4c:	74 14                	je     802c62 <ipc_recv+0x60>
+        *from_env_store = thisenv->env_ipc_from;
+  802c4e:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802c55:	00 00 00 
+  802c58:	8b 80 ac 01 00 00    	mov    0x1ac(%rax),%eax
+  802c5e:	41 89 04 24          	mov    %eax,(%r12)
+    }
+    if (perm_store) {
+  802c62:	4d 85 ed             	test   %r13,%r13
+  802c65:	74 14                	je     802c7b <ipc_recv+0x79>
+        *perm_store = thisenv->env_ipc_perm;
+  802c67:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802c6e:	00 00 00 
+  802c71:	8b 80 b0 01 00 00    	mov    0x1b0(%rax),%eax
+  802c77:	41 89 45 00          	mov    %eax,0x0(%r13)
+    }
+    if (size) {
+  802c7b:	48 85 db             	test   %rbx,%rbx
+  802c7e:	74 14                	je     802c94 <ipc_recv+0x92>
+        *size = thisenv->env_ipc_maxsz;
+  802c80:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802c87:	00 00 00 
+  802c8a:	48 8b 80 a0 01 00 00 	mov    0x1a0(%rax),%rax
+  802c91:	48 89 03             	mov    %rax,(%rbx)
+    }
+    return thisenv->env_ipc_value;
+  802c94:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802c9b:	00 00 00 
+  802c9e:	8b 80 a8 01 00 00    	mov    0x1a8(%rax),%eax
+}
+  802ca4:	48 83 c4 08          	add    $0x8,%rsp
+  802ca8:	5b                   	pop    %rbx
+  802ca9:	41 5c                	pop    %r12
+  802cab:	41 5d                	pop    %r13
+  802cad:	5d                   	pop    %rbp
+  802cae:	c3                   	ret
+        if (from_env_store) {
+  802caf:	4d 85 e4             	test   %r12,%r12
+  802cb2:	74 08                	je     802cbc <ipc_recv+0xba>
+            *from_env_store = 0;
+  802cb4:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  802cbb:	00 
+        if (perm_store) {
+  802cbc:	4d 85 ed             	test   %r13,%r13
+  802cbf:	74 08                	je     802cc9 <ipc_recv+0xc7>
+            *perm_store = 0;
+  802cc1:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  802cc8:	00 
+        if (size) {
+  802cc9:	48 85 db             	test   %rbx,%rbx
+  802ccc:	74 d6                	je     802ca4 <ipc_recv+0xa2>
+            *size = 0;
+  802cce:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  802cd5:	eb cd                	jmp    802ca4 <ipc_recv+0xa2>
+
+0000000000802cd7 <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  802cd7:	55                   	push   %rbp
+  802cd8:	48 89 e5             	mov    %rsp,%rbp
+  802cdb:	41 57                	push   %r15
+  802cdd:	41 56                	push   %r14
+  802cdf:	41 55                	push   %r13
+  802ce1:	41 54                	push   %r12
+  802ce3:	53                   	push   %rbx
+  802ce4:	48 83 ec 18          	sub    $0x18,%rsp
+  802ce8:	41 89 fd             	mov    %edi,%r13d
+  802ceb:	89 75 cc             	mov    %esi,-0x34(%rbp)
+  802cee:	49 89 cc             	mov    %rcx,%r12
+  802cf1:	44 89 45 c8          	mov    %r8d,-0x38(%rbp)
+    // LAB 9: Your code here:
+    int res = 0;
+    while ((res = sys_ipc_try_send(to_env, val, !pg ? (void*)MAX_USER_ADDRESS : pg, size, perm)) < 0) {
+  802cf5:	48 85 d2             	test   %rdx,%rdx
+  802cf8:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802cff:	00 00 00 
+  802d02:	48 0f 45 c2          	cmovne %rdx,%rax
+  802d06:	48 89 c3             	mov    %rax,%rbx
+  802d09:	49 be 17 16 80 00 00 	movabs $0x801617,%r14
+  802d10:	00 00 00 
+        if (res != -E_IPC_NOT_RECV) {
+            panic("sys_ipc_try_send failed: %i", res);
+        }
+        sys_yield();
+  802d13:	49 bf e2 11 80 00 00 	movabs $0x8011e2,%r15
+  802d1a:	00 00 00 
+    while ((res = sys_ipc_try_send(to_env, val, !pg ? (void*)MAX_USER_ADDRESS : pg, size, perm)) < 0) {
+  802d1d:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  802d20:	44 8b 45 c8          	mov    -0x38(%rbp),%r8d
+  802d24:	4c 89 e1             	mov    %r12,%rcx
+  802d27:	48 89 da             	mov    %rbx,%rdx
+  802d2a:	44 89 ef             	mov    %r13d,%edi
+  802d2d:	41 ff d6             	call   *%r14
+  802d30:	85 c0                	test   %eax,%eax
+  802d32:	79 37                	jns    802d6b <ipc_send+0x94>
+        if (res != -E_IPC_NOT_RECV) {
+  802d34:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  802d37:	75 05                	jne    802d3e <ipc_send+0x67>
+        sys_yield();
+  802d39:	41 ff d7             	call   *%r15
+  802d3c:	eb df                	jmp    802d1d <ipc_send+0x46>
+            panic("sys_ipc_try_send failed: %i", res);
+  802d3e:	89 c1                	mov    %eax,%ecx
+  802d40:	48 ba e0 34 80 00 00 	movabs $0x8034e0,%rdx
+  802d47:	00 00 00 
+  802d4a:	be 40 00 00 00       	mov    $0x40,%esi
+  802d4f:	48 bf fc 34 80 00 00 	movabs $0x8034fc,%rdi
+  802d56:	00 00 00 
+  802d59:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d5e:	49 b8 4c 02 80 00 00 	movabs $0x80024c,%r8
+  802d65:	00 00 00 
+  802d68:	41 ff d0             	call   *%r8
+    }
+    return;
+}
+  802d6b:	48 83 c4 18          	add    $0x18,%rsp
+  802d6f:	5b                   	pop    %rbx
+  802d70:	41 5c                	pop    %r12
+  802d72:	41 5d                	pop    %r13
+  802d74:	41 5e                	pop    %r14
+  802d76:	41 5f                	pop    %r15
+  802d78:	5d                   	pop    %rbp
+  802d79:	c3                   	ret
+
+0000000000802d7a <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  802d7a:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  802d7f:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  802d86:	00 00 00 
+  802d89:	48 69 d0 d0 01 00 00 	imul   $0x1d0,%rax,%rdx
+  802d90:	48 01 ca             	add    %rcx,%rdx
+  802d93:	8b 92 e8 00 00 00    	mov    0xe8(%rdx),%edx
+  802d99:	39 fa                	cmp    %edi,%edx
+  802d9b:	74 12                	je     802daf <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  802d9d:	48 83 c0 01          	add    $0x1,%rax
+  802da1:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  802da7:	75 e0                	jne    802d89 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  802da9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802dae:	c3                   	ret
+            return envs[i].env_id;
+  802daf:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+  802db6:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  802dbd:	00 00 00 
+  802dc0:	48 01 d0             	add    %rdx,%rax
+  802dc3:	8b 80 e0 00 00 00    	mov    0xe0(%rax),%eax
+  802dc9:	c3                   	ret
+  802dca:	66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+
+0000000000802dd0 <__rodata_start>:
+  802dd0:	73 79                	jae    802e4b <__rodata_start+0x7b>
+  802dd2:	73 5f                	jae    802e33 <__rodata_start+0x63>
+  802dd4:	61                   	(bad)
+  802dd5:	6c                   	insb   (%dx),%es:(%rdi)
+  802dd6:	6c                   	insb   (%dx),%es:(%rdi)
+  802dd7:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802dd8:	63 5f 72             	movsxd 0x72(%rdi),%ebx
+  802ddb:	65 67 69 6f 6e 3a 20 	imul   $0x6925203a,%gs:0x6e(%edi),%ebp
+  802de2:	25 69 
+  802de4:	00 75 73             	add    %dh,0x73(%rbp)
+  802de7:	65 72 2f             	gs jb  802e19 <__rodata_start+0x49>
+  802dea:	66 61                	data16 (bad)
+  802dec:	75 6c                	jne    802e5a <__rodata_start+0x8a>
+  802dee:	74 73                	je     802e63 <__rodata_start+0x93>
+  802df0:	77 65                	ja     802e57 <__rodata_start+0x87>
+  802df2:	65 70 2e             	gs jo  802e23 <__rodata_start+0x53>
+  802df5:	63 00                	movsxd (%rax),%eax
+  802df7:	90                   	nop
+  802df8:	66 61                	data16 (bad)
+  802dfa:	75 6c                	jne    802e68 <__rodata_start+0x98>
+  802dfc:	74 73                	je     802e71 <__rodata_start+0xa1>
+  802dfe:	77 65                	ja     802e65 <__rodata_start+0x95>
+  802e00:	65 70 3a             	gs jo  802e3d <__rodata_start+0x6d>
+  802e03:	20 25 6c 75 20 4d    	and    %ah,0x4d20756c(%rip)        # 4da0a375 <__bss_end+0x4d202375>
+  802e09:	42 2c 20             	rex.X sub $0x20,%al
+  802e0c:	25 75 20 66 61       	and    $0x61662075,%eax
+  802e11:	75 6c                	jne    802e7f <__rodata_start+0xaf>
+  802e13:	74 73                	je     802e88 <__rodata_start+0xb8>
+  802e15:	2c 20                	sub    $0x20,%al
+  802e17:	25 6c 75 20 63       	and    $0x6320756c,%eax
+  802e1c:	79 63                	jns    802e81 <__rodata_start+0xb1>
+  802e1e:	6c                   	insb   (%dx),%es:(%rdi)
+  802e1f:	65 73 20             	gs jae 802e42 <__rodata_start+0x72>
+  802e22:	70 65                	jo     802e89 <__rodata_start+0xb9>
+  802e24:	72 20                	jb     802e46 <__rodata_start+0x76>
+  802e26:	4d                   	rex.WRB
+  802e27:	42 0a 00             	rex.X or (%rax),%al
+  802e2a:	3c 75                	cmp    $0x75,%al
+  802e2c:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802e2d:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  802e31:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802e32:	3e 00 0f             	ds add %cl,(%rdi)
+  802e35:	1f                   	(bad)
+  802e36:	40 00 5b 25          	rex add %bl,0x25(%rbx)
+  802e3a:	30 38                	xor    %bh,(%rax)
+  802e3c:	78 5d                	js     802e9b <__rodata_start+0xcb>
+  802e3e:	20 75 73             	and    %dh,0x73(%rbp)
+  802e41:	65 72 20             	gs jb  802e64 <__rodata_start+0x94>
+  802e44:	70 61                	jo     802ea7 <__rodata_start+0xd7>
+  802e46:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802e47:	69 63 20 69 6e 20 25 	imul   $0x25206e69,0x20(%rbx),%esp
+  802e4e:	73 20                	jae    802e70 <__rodata_start+0xa0>
+  802e50:	61                   	(bad)
+  802e51:	74 20                	je     802e73 <__rodata_start+0xa3>
+  802e53:	25 73 3a 25 64       	and    $0x64253a73,%eax
+  802e58:	3a 20                	cmp    (%rax),%ah
+  802e5a:	00 30                	add    %dh,(%rax)
+  802e5c:	31 32                	xor    %esi,(%rdx)
+  802e5e:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  802e65:	41                   	rex.B
+  802e66:	42                   	rex.X
+  802e67:	43                   	rex.XB
+  802e68:	44                   	rex.R
+  802e69:	45                   	rex.RB
+  802e6a:	46 00 30             	rex.RX add %r14b,(%rax)
+  802e6d:	31 32                	xor    %esi,(%rdx)
+  802e6f:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  802e76:	61                   	(bad)
+  802e77:	62 63 64 65 66       	(bad)
+  802e7c:	00 28                	add    %ch,(%rax)
+  802e7e:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802e7f:	75 6c                	jne    802eed <__rodata_start+0x11d>
+  802e81:	6c                   	insb   (%dx),%es:(%rdi)
+  802e82:	29 00                	sub    %eax,(%rax)
+  802e84:	65 72 72             	gs jb  802ef9 <__rodata_start+0x129>
+  802e87:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802e88:	72 20                	jb     802eaa <__rodata_start+0xda>
+  802e8a:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  802e8f:	73 70                	jae    802f01 <__rodata_start+0x131>
+  802e91:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  802e95:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  802e9c:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802e9d:	72 00                	jb     802e9f <__rodata_start+0xcf>
+  802e9f:	62 61 64 20 65       	(bad)
+  802ea4:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802ea5:	76 69                	jbe    802f10 <__rodata_start+0x140>
+  802ea7:	72 6f                	jb     802f18 <__rodata_start+0x148>
+  802ea9:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802eaa:	6d                   	insl   (%dx),%es:(%rdi)
+  802eab:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  802ead:	74 00                	je     802eaf <__rodata_start+0xdf>
+  802eaf:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  802eb6:	20 70 61             	and    %dh,0x61(%rax)
+  802eb9:	72 61                	jb     802f1c <__rodata_start+0x14c>
+  802ebb:	6d                   	insl   (%dx),%es:(%rdi)
+  802ebc:	65 74 65             	gs je  802f24 <__rodata_start+0x154>
+  802ebf:	72 00                	jb     802ec1 <__rodata_start+0xf1>
+  802ec1:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802ec2:	75 74                	jne    802f38 <__rodata_start+0x168>
+  802ec4:	20 6f 66             	and    %ch,0x66(%rdi)
+  802ec7:	20 6d 65             	and    %ch,0x65(%rbp)
+  802eca:	6d                   	insl   (%dx),%es:(%rdi)
+  802ecb:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802ecc:	72 79                	jb     802f47 <__rodata_start+0x177>
+  802ece:	00 6f 75             	add    %ch,0x75(%rdi)
+  802ed1:	74 20                	je     802ef3 <__rodata_start+0x123>
+  802ed3:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802ed4:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  802ed8:	76 69                	jbe    802f43 <__rodata_start+0x173>
+  802eda:	72 6f                	jb     802f4b <__rodata_start+0x17b>
+  802edc:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802edd:	6d                   	insl   (%dx),%es:(%rdi)
+  802ede:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  802ee0:	74 73                	je     802f55 <__rodata_start+0x185>
+  802ee2:	00 63 6f             	add    %ah,0x6f(%rbx)
+  802ee5:	72 72                	jb     802f59 <__rodata_start+0x189>
+  802ee7:	75 70                	jne    802f59 <__rodata_start+0x189>
+  802ee9:	74 65                	je     802f50 <__rodata_start+0x180>
+  802eeb:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  802ef0:	75 67                	jne    802f59 <__rodata_start+0x189>
+  802ef2:	20 69 6e             	and    %ch,0x6e(%rcx)
+  802ef5:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  802ef7:	00 73 65             	add    %dh,0x65(%rbx)
+  802efa:	67 6d                	insl   (%dx),%es:(%edi)
+  802efc:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  802efe:	74 61                	je     802f61 <__rodata_start+0x191>
+  802f00:	74 69                	je     802f6b <__rodata_start+0x19b>
+  802f02:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802f03:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802f04:	20 66 61             	and    %ah,0x61(%rsi)
+  802f07:	75 6c                	jne    802f75 <__rodata_start+0x1a5>
+  802f09:	74 00                	je     802f0b <__rodata_start+0x13b>
+  802f0b:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  802f12:	20 45 4c             	and    %al,0x4c(%rbp)
+  802f15:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  802f19:	61                   	(bad)
+  802f1a:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  802f1f:	20 73 75             	and    %dh,0x75(%rbx)
+  802f22:	63 68 20             	movsxd 0x20(%rax),%ebp
+  802f25:	73 79                	jae    802fa0 <__rodata_start+0x1d0>
+  802f27:	73 74                	jae    802f9d <__rodata_start+0x1cd>
+  802f29:	65 6d                	gs insl (%dx),%es:(%rdi)
+  802f2b:	20 63 61             	and    %ah,0x61(%rbx)
+  802f2e:	6c                   	insb   (%dx),%es:(%rdi)
+  802f2f:	6c                   	insb   (%dx),%es:(%rdi)
+  802f30:	00 65 6e             	add    %ah,0x6e(%rbp)
+  802f33:	74 72                	je     802fa7 <__rodata_start+0x1d7>
+  802f35:	79 20                	jns    802f57 <__rodata_start+0x187>
+  802f37:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802f38:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802f39:	74 20                	je     802f5b <__rodata_start+0x18b>
+  802f3b:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  802f3d:	75 6e                	jne    802fad <__rodata_start+0x1dd>
+  802f3f:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  802f43:	76 20                	jbe    802f65 <__rodata_start+0x195>
+  802f45:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  802f4c:	72 65                	jb     802fb3 <__rodata_start+0x1e3>
+  802f4e:	63 76 69             	movsxd 0x69(%rsi),%esi
+  802f51:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802f52:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  802f56:	65 78 70             	gs js  802fc9 <__rodata_start+0x1f9>
+  802f59:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  802f5e:	20 65 6e             	and    %ah,0x6e(%rbp)
+  802f61:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  802f65:	20 66 69             	and    %ah,0x69(%rsi)
+  802f68:	6c                   	insb   (%dx),%es:(%rdi)
+  802f69:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  802f6d:	20 66 72             	and    %ah,0x72(%rsi)
+  802f70:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  802f75:	61                   	(bad)
+  802f76:	63 65 20             	movsxd 0x20(%rbp),%esp
+  802f79:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802f7a:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802f7b:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  802f7f:	6b 00 74             	imul   $0x74,(%rax),%eax
+  802f82:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802f83:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802f84:	20 6d 61             	and    %ch,0x61(%rbp)
+  802f87:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802f88:	79 20                	jns    802faa <__rodata_start+0x1da>
+  802f8a:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  802f91:	72 65                	jb     802ff8 <__rodata_start+0x228>
+  802f93:	20 6f 70             	and    %ch,0x70(%rdi)
+  802f96:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  802f98:	00 66 69             	add    %ah,0x69(%rsi)
+  802f9b:	6c                   	insb   (%dx),%es:(%rdi)
+  802f9c:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  802fa0:	20 62 6c             	and    %ah,0x6c(%rdx)
+  802fa3:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802fa4:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  802fa7:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802fa8:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802fa9:	74 20                	je     802fcb <__rodata_start+0x1fb>
+  802fab:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  802fad:	75 6e                	jne    80301d <__rodata_start+0x24d>
+  802faf:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  802fb3:	76 61                	jbe    803016 <__rodata_start+0x246>
+  802fb5:	6c                   	insb   (%dx),%es:(%rdi)
+  802fb6:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  802fbd:	00 
+  802fbe:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  802fc5:	72 65                	jb     80302c <__rodata_start+0x25c>
+  802fc7:	61                   	(bad)
+  802fc8:	64 79 20             	fs jns 802feb <__rodata_start+0x21b>
+  802fcb:	65 78 69             	gs js  803037 <__rodata_start+0x267>
+  802fce:	73 74                	jae    803044 <__rodata_start+0x274>
+  802fd0:	73 00                	jae    802fd2 <__rodata_start+0x202>
+  802fd2:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802fd3:	70 65                	jo     80303a <__rodata_start+0x26a>
+  802fd5:	72 61                	jb     803038 <__rodata_start+0x268>
+  802fd7:	74 69                	je     803042 <__rodata_start+0x272>
+  802fd9:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802fda:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802fdb:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  802fde:	74 20                	je     803000 <__rodata_start+0x230>
+  802fe0:	73 75                	jae    803057 <__rodata_start+0x287>
+  802fe2:	70 70                	jo     803054 <__rodata_start+0x284>
+  802fe4:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802fe5:	72 74                	jb     80305b <__rodata_start+0x28b>
+  802fe7:	65 64 00 6f 70       	gs add %ch,%fs:0x70(%rdi)
+  802fec:	65 72 61             	gs jb  803050 <__rodata_start+0x280>
+  802fef:	74 69                	je     80305a <__rodata_start+0x28a>
+  802ff1:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802ff2:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802ff3:	20 69 6e             	and    %ch,0x6e(%rcx)
+  802ff6:	74 65                	je     80305d <__rodata_start+0x28d>
+  802ff8:	72 72                	jb     80306c <__rodata_start+0x29c>
+  802ffa:	75 70                	jne    80306c <__rodata_start+0x29c>
+  802ffc:	74 65                	je     803063 <__rodata_start+0x293>
+  802ffe:	64 00 6e 6f          	add    %ch,%fs:0x6f(%rsi)
+  803002:	74 20                	je     803024 <__rodata_start+0x254>
+  803004:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803006:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803007:	75 67                	jne    803070 <__rodata_start+0x2a0>
+  803009:	68 20 43 50 55       	push   $0x55504320
+  80300e:	20 74 69 6d          	and    %dh,0x6d(%rcx,%rbp,2)
+  803012:	65 00 66 2e          	add    %ah,%gs:0x2e(%rsi)
+  803016:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+  80301d:	00 
+  80301e:	66 90                	xchg   %ax,%ax
+  803020:	89 05 80 00 00 00    	mov    %eax,0x80(%rip)        # 8030a6 <__rodata_start+0x2d6>
+  803026:	00 00                	add    %al,(%rax)
+  803028:	ca 0b 80             	lret   $0x800b
+  80302b:	00 00                	add    %al,(%rax)
+  80302d:	00 00                	add    %al,(%rax)
+  80302f:	00 ba 0b 80 00 00    	add    %bh,0x800b(%rdx)
+  803035:	00 00                	add    %al,(%rax)
+  803037:	00 ca                	add    %cl,%dl
+  803039:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  80303f:	00 ca                	add    %cl,%dl
+  803041:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803047:	00 ca                	add    %cl,%dl
+  803049:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  80304f:	00 ca                	add    %cl,%dl
+  803051:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803057:	00 a8 05 80 00 00    	add    %ch,0x8005(%rax)
+  80305d:	00 00                	add    %al,(%rax)
+  80305f:	00 ca                	add    %cl,%dl
+  803061:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803067:	00 ca                	add    %cl,%dl
+  803069:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  80306f:	00 9c 05 80 00 00 00 	add    %bl,0x80(%rbp,%rax,1)
+  803076:	00 00                	add    %al,(%rax)
+  803078:	16                   	(bad)
+  803079:	06                   	(bad)
+  80307a:	80 00 00             	addb   $0x0,(%rax)
+  80307d:	00 00                	add    %al,(%rax)
+  80307f:	00 ca                	add    %cl,%dl
+  803081:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803087:	00 9c 05 80 00 00 00 	add    %bl,0x80(%rbp,%rax,1)
+  80308e:	00 00                	add    %al,(%rax)
+  803090:	e2 05                	loop   803097 <__rodata_start+0x2c7>
+  803092:	80 00 00             	addb   $0x0,(%rax)
+  803095:	00 00                	add    %al,(%rax)
+  803097:	00 e2                	add    %ah,%dl
+  803099:	05 80 00 00 00       	add    $0x80,%eax
+  80309e:	00 00                	add    %al,(%rax)
+  8030a0:	e2 05                	loop   8030a7 <__rodata_start+0x2d7>
+  8030a2:	80 00 00             	addb   $0x0,(%rax)
+  8030a5:	00 00                	add    %al,(%rax)
+  8030a7:	00 e2                	add    %ah,%dl
+  8030a9:	05 80 00 00 00       	add    $0x80,%eax
+  8030ae:	00 00                	add    %al,(%rax)
+  8030b0:	e2 05                	loop   8030b7 <__rodata_start+0x2e7>
+  8030b2:	80 00 00             	addb   $0x0,(%rax)
+  8030b5:	00 00                	add    %al,(%rax)
+  8030b7:	00 e2                	add    %ah,%dl
+  8030b9:	05 80 00 00 00       	add    $0x80,%eax
+  8030be:	00 00                	add    %al,(%rax)
+  8030c0:	e2 05                	loop   8030c7 <__rodata_start+0x2f7>
+  8030c2:	80 00 00             	addb   $0x0,(%rax)
+  8030c5:	00 00                	add    %al,(%rax)
+  8030c7:	00 e2                	add    %ah,%dl
+  8030c9:	05 80 00 00 00       	add    $0x80,%eax
+  8030ce:	00 00                	add    %al,(%rax)
+  8030d0:	e2 05                	loop   8030d7 <__rodata_start+0x307>
+  8030d2:	80 00 00             	addb   $0x0,(%rax)
+  8030d5:	00 00                	add    %al,(%rax)
+  8030d7:	00 ca                	add    %cl,%dl
+  8030d9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  8030df:	00 ca                	add    %cl,%dl
+  8030e1:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  8030e7:	00 ca                	add    %cl,%dl
+  8030e9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  8030ef:	00 ca                	add    %cl,%dl
+  8030f1:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  8030f7:	00 ca                	add    %cl,%dl
+  8030f9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  8030ff:	00 ca                	add    %cl,%dl
+  803101:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803107:	00 ca                	add    %cl,%dl
+  803109:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  80310f:	00 ca                	add    %cl,%dl
+  803111:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803117:	00 ca                	add    %cl,%dl
+  803119:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  80311f:	00 ca                	add    %cl,%dl
+  803121:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803127:	00 ca                	add    %cl,%dl
+  803129:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  80312f:	00 ca                	add    %cl,%dl
+  803131:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803137:	00 ca                	add    %cl,%dl
+  803139:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  80313f:	00 ca                	add    %cl,%dl
+  803141:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803147:	00 ca                	add    %cl,%dl
+  803149:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  80314f:	00 ca                	add    %cl,%dl
+  803151:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803157:	00 ca                	add    %cl,%dl
+  803159:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  80315f:	00 ca                	add    %cl,%dl
+  803161:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803167:	00 ca                	add    %cl,%dl
+  803169:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  80316f:	00 ca                	add    %cl,%dl
+  803171:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803177:	00 ca                	add    %cl,%dl
+  803179:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  80317f:	00 ca                	add    %cl,%dl
+  803181:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803187:	00 ca                	add    %cl,%dl
+  803189:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  80318f:	00 ca                	add    %cl,%dl
+  803191:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803197:	00 ca                	add    %cl,%dl
+  803199:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  80319f:	00 ca                	add    %cl,%dl
+  8031a1:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  8031a7:	00 ca                	add    %cl,%dl
+  8031a9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  8031af:	00 ca                	add    %cl,%dl
+  8031b1:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  8031b7:	00 ca                	add    %cl,%dl
+  8031b9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  8031bf:	00 ca                	add    %cl,%dl
+  8031c1:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  8031c7:	00 ed                	add    %ch,%ch
+  8031c9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8031cf:	00 ca                	add    %cl,%dl
+  8031d1:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  8031d7:	00 ca                	add    %cl,%dl
+  8031d9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  8031df:	00 ca                	add    %cl,%dl
+  8031e1:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  8031e7:	00 ca                	add    %cl,%dl
+  8031e9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  8031ef:	00 ca                	add    %cl,%dl
+  8031f1:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  8031f7:	00 ca                	add    %cl,%dl
+  8031f9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  8031ff:	00 ca                	add    %cl,%dl
+  803201:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803207:	00 ca                	add    %cl,%dl
+  803209:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  80320f:	00 ca                	add    %cl,%dl
+  803211:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803217:	00 ca                	add    %cl,%dl
+  803219:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  80321f:	00 39                	add    %bh,(%rcx)
+  803221:	06                   	(bad)
+  803222:	80 00 00             	addb   $0x0,(%rax)
+  803225:	00 00                	add    %al,(%rax)
+  803227:	00 08                	add    %cl,(%rax)
+  803229:	08 80 00 00 00 00    	or     %al,0x0(%rax)
+  80322f:	00 ca                	add    %cl,%dl
+  803231:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803237:	00 ca                	add    %cl,%dl
+  803239:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  80323f:	00 ca                	add    %cl,%dl
+  803241:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803247:	00 ca                	add    %cl,%dl
+  803249:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  80324f:	00 68 06             	add    %ch,0x6(%rax)
+  803252:	80 00 00             	addb   $0x0,(%rax)
+  803255:	00 00                	add    %al,(%rax)
+  803257:	00 ca                	add    %cl,%dl
+  803259:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  80325f:	00 ca                	add    %cl,%dl
+  803261:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803267:	00 2e                	add    %ch,(%rsi)
+  803269:	06                   	(bad)
+  80326a:	80 00 00             	addb   $0x0,(%rax)
+  80326d:	00 00                	add    %al,(%rax)
+  80326f:	00 ca                	add    %cl,%dl
+  803271:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803277:	00 ca                	add    %cl,%dl
+  803279:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  80327f:	00 b0 09 80 00 00    	add    %dh,0x8009(%rax)
+  803285:	00 00                	add    %al,(%rax)
+  803287:	00 7a 0a             	add    %bh,0xa(%rdx)
+  80328a:	80 00 00             	addb   $0x0,(%rax)
+  80328d:	00 00                	add    %al,(%rax)
+  80328f:	00 ca                	add    %cl,%dl
+  803291:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803297:	00 ca                	add    %cl,%dl
+  803299:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  80329f:	00 ff                	add    %bh,%bh
+  8032a1:	06                   	(bad)
+  8032a2:	80 00 00             	addb   $0x0,(%rax)
+  8032a5:	00 00                	add    %al,(%rax)
+  8032a7:	00 ca                	add    %cl,%dl
+  8032a9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  8032af:	00 dc                	add    %bl,%ah
+  8032b1:	08 80 00 00 00 00    	or     %al,0x0(%rax)
+  8032b7:	00 ca                	add    %cl,%dl
+  8032b9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  8032bf:	00 ca                	add    %cl,%dl
+  8032c1:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  8032c7:	00 ed                	add    %ch,%ch
+  8032c9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8032cf:	00 ca                	add    %cl,%dl
+  8032d1:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  8032d7:	00 92 05 80 00 00    	add    %dl,0x8005(%rdx)
+  8032dd:	00 00                	add    %al,(%rax)
+	...
+
+00000000008032e0 <error_string>:
+	...
+  8032e8:	8d 2e 80 00 00 00 00 00 9f 2e 80 00 00 00 00 00     ................
+  8032f8:	af 2e 80 00 00 00 00 00 c1 2e 80 00 00 00 00 00     ................
+  803308:	cf 2e 80 00 00 00 00 00 e3 2e 80 00 00 00 00 00     ................
+  803318:	f8 2e 80 00 00 00 00 00 0b 2f 80 00 00 00 00 00     ........./......
+  803328:	1d 2f 80 00 00 00 00 00 31 2f 80 00 00 00 00 00     ./......1/......
+  803338:	41 2f 80 00 00 00 00 00 54 2f 80 00 00 00 00 00     A/......T/......
+  803348:	6b 2f 80 00 00 00 00 00 81 2f 80 00 00 00 00 00     k/......./......
+  803358:	99 2f 80 00 00 00 00 00 b1 2f 80 00 00 00 00 00     ./......./......
+  803368:	be 2f 80 00 00 00 00 00 90 33 80 00 00 00 00 00     ./.......3......
+  803378:	d2 2f 80 00 00 00 00 00 ea 2f 80 00 00 00 00 00     ./......./......
+  803388:	00 30 80 00 00 00 00 00 66 69 6c 65 20 69 73 20     .0......file is 
+  803398:	6e 6f 74 20 61 20 76 61 6c 69 64 20 65 78 65 63     not a valid exec
+  8033a8:	75 74 61 62 6c 65 00 90 73 79 73 63 61 6c 6c 20     utable..syscall 
+  8033b8:	25 7a 64 20 72 65 74 75 72 6e 65 64 20 25 7a 64     %zd returned %zd
+  8033c8:	20 28 3e 20 30 29 00 6c 69 62 2f 73 79 73 63 61      (> 0).lib/sysca
+  8033d8:	6c 6c 2e 63 00 0f 1f 00 5b 25 30 38 78 5d 20 75     ll.c....[%08x] u
+  8033e8:	6e 6b 6e 6f 77 6e 20 64 65 76 69 63 65 20 74 79     nknown device ty
+  8033f8:	70 65 20 25 64 0a 00 00 5b 25 30 38 78 5d 20 66     pe %d...[%08x] f
+  803408:	74 72 75 6e 63 61 74 65 20 25 64 20 2d 2d 20 62     truncate %d -- b
+  803418:	61 64 20 6d 6f 64 65 0a 00 5b 25 30 38 78 5d 20     ad mode..[%08x] 
+  803428:	72 65 61 64 20 25 64 20 2d 2d 20 62 61 64 20 6d     read %d -- bad m
+  803438:	6f 64 65 0a 00 5b 25 30 38 78 5d 20 77 72 69 74     ode..[%08x] writ
+  803448:	65 20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65     e %d -- bad mode
+  803458:	0a 00 66 0f 1f 44 00 00                             ..f..D..
+
+0000000000803460 <devtab>:
+  803460:	20 40 80 00 00 00 00 00 60 40 80 00 00 00 00 00      @......`@......
+  803470:	a0 40 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .@..............
+  803480:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  803490:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  8034a0:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  8034b0:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  8034c0:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  8034d0:	3d 20 32 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73 00     = 2.<cons>.cons.
+  8034e0:	73 79 73 5f 69 70 63 5f 74 72 79 5f 73 65 6e 64     sys_ipc_try_send
+  8034f0:	20 66 61 69 6c 65 64 3a 20 25 69 00 6c 69 62 2f      failed: %i.lib/
+  803500:	69 70 63 2e 63 00 66 2e 0f 1f 84 00 00 00 00 00     ipc.c.f.........
+  803510:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803520:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803530:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803540:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803550:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803560:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803570:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803580:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803590:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8035a0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8035b0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8035c0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8035d0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8035e0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8035f0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803600:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803610:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803620:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803630:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803640:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803650:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803660:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803670:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803680:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803690:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8036a0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8036b0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8036c0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8036d0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8036e0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8036f0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803700:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803710:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803720:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803730:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803740:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803750:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803760:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803770:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803780:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803790:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8037a0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8037b0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8037c0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8037d0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8037e0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8037f0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803800:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803810:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803820:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803830:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803840:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803850:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803860:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803870:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803880:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803890:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8038a0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8038b0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8038c0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8038d0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8038e0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8038f0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803900:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803910:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803920:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803930:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803940:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803950:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803960:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803970:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803980:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803990:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8039a0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8039b0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8039c0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8039d0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8039e0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8039f0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803a00:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803a10:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803a20:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803a30:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803a40:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803a50:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803a60:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803a70:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803a80:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803a90:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803aa0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803ab0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803ac0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803ad0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803ae0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803af0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803b00:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803b10:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803b20:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803b30:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803b40:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803b50:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803b60:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803b70:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803b80:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803b90:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803ba0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803bb0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803bc0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803bd0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803be0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803bf0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803c00:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803c10:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803c20:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803c30:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803c40:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803c50:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803c60:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803c70:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803c80:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803c90:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803ca0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803cb0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803cc0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803cd0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803ce0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803cf0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803d00:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803d10:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803d20:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803d30:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803d40:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803d50:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803d60:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803d70:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803d80:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803d90:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803da0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803db0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803dc0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803dd0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803de0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803df0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803e00:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803e10:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803e20:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803e30:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803e40:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803e50:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803e60:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803e70:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803e80:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803e90:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803ea0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803eb0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803ec0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803ed0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803ee0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803ef0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803f00:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803f10:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803f20:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803f30:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803f40:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803f50:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803f60:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803f70:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803f80:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803f90:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803fa0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803fb0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803fc0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803fd0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803fe0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803ff0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
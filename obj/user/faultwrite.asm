@@ -0,0 +1,5434 @@
+
+obj/user/faultwrite:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 0e 00 00 00       	call   800031 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+#ifndef __clang_analyzer__
+    *(volatile unsigned *)0 = 0;
+  800025:	c7 04 25 00 00 00 00 	movl   $0x0,0x0
+  80002c:	00 00 00 00 
+#endif
+}
+  800030:	c3                   	ret
+
+0000000000800031 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800031:	55                   	push   %rbp
+  800032:	48 89 e5             	mov    %rsp,%rbp
+  800035:	41 56                	push   %r14
+  800037:	41 55                	push   %r13
+  800039:	41 54                	push   %r12
+  80003b:	53                   	push   %rbx
+  80003c:	41 89 fd             	mov    %edi,%r13d
+  80003f:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800042:	48 ba d8 40 80 00 00 	movabs $0x8040d8,%rdx
+  800049:	00 00 00 
+  80004c:	48 b8 d8 40 80 00 00 	movabs $0x8040d8,%rax
+  800053:	00 00 00 
+  800056:	48 39 c2             	cmp    %rax,%rdx
+  800059:	73 17                	jae    800072 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  80005b:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  80005e:	49 89 c4             	mov    %rax,%r12
+  800061:	48 83 c3 08          	add    $0x8,%rbx
+  800065:	b8 00 00 00 00       	mov    $0x0,%eax
+  80006a:	ff 53 f8             	call   *-0x8(%rbx)
+  80006d:	4c 39 e3             	cmp    %r12,%rbx
+  800070:	72 ef                	jb     800061 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+    envid_t this_env_id = sys_getenvid();
+  800072:	48 b8 c6 01 80 00 00 	movabs $0x8001c6,%rax
+  800079:	00 00 00 
+  80007c:	ff d0                	call   *%rax
+    thisenv = &((struct Env*)UENVS)[ENVX(this_env_id)];
+  80007e:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800083:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+  80008a:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  800091:	00 00 00 
+  800094:	48 01 d0             	add    %rdx,%rax
+  800097:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  80009e:	00 00 00 
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8000a1:	45 85 ed             	test   %r13d,%r13d
+  8000a4:	7e 0d                	jle    8000b3 <libmain+0x82>
+  8000a6:	49 8b 06             	mov    (%r14),%rax
+  8000a9:	48 a3 00 40 80 00 00 	movabs %rax,0x804000
+  8000b0:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8000b3:	4c 89 f6             	mov    %r14,%rsi
+  8000b6:	44 89 ef             	mov    %r13d,%edi
+  8000b9:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8000c0:	00 00 00 
+  8000c3:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8000c5:	48 b8 da 00 80 00 00 	movabs $0x8000da,%rax
+  8000cc:	00 00 00 
+  8000cf:	ff d0                	call   *%rax
+#endif
+}
+  8000d1:	5b                   	pop    %rbx
+  8000d2:	41 5c                	pop    %r12
+  8000d4:	41 5d                	pop    %r13
+  8000d6:	41 5e                	pop    %r14
+  8000d8:	5d                   	pop    %rbp
+  8000d9:	c3                   	ret
+
+00000000008000da <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8000da:	55                   	push   %rbp
+  8000db:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  8000de:	48 b8 1a 09 80 00 00 	movabs $0x80091a,%rax
+  8000e5:	00 00 00 
+  8000e8:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  8000ea:	bf 00 00 00 00       	mov    $0x0,%edi
+  8000ef:	48 b8 5b 01 80 00 00 	movabs $0x80015b,%rax
+  8000f6:	00 00 00 
+  8000f9:	ff d0                	call   *%rax
+}
+  8000fb:	5d                   	pop    %rbp
+  8000fc:	c3                   	ret
+
+00000000008000fd <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  8000fd:	55                   	push   %rbp
+  8000fe:	48 89 e5             	mov    %rsp,%rbp
+  800101:	53                   	push   %rbx
+  800102:	48 89 fa             	mov    %rdi,%rdx
+  800105:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  800108:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80010d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800112:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800117:	be 00 00 00 00       	mov    $0x0,%esi
+  80011c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800122:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  800124:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800128:	c9                   	leave
+  800129:	c3                   	ret
+
+000000000080012a <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  80012a:	55                   	push   %rbp
+  80012b:	48 89 e5             	mov    %rsp,%rbp
+  80012e:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80012f:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800134:	ba 00 00 00 00       	mov    $0x0,%edx
+  800139:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80013e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800143:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800148:	be 00 00 00 00       	mov    $0x0,%esi
+  80014d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800153:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  800155:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800159:	c9                   	leave
+  80015a:	c3                   	ret
+
+000000000080015b <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  80015b:	55                   	push   %rbp
+  80015c:	48 89 e5             	mov    %rsp,%rbp
+  80015f:	53                   	push   %rbx
+  800160:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  800164:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800167:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80016c:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800171:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800176:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80017b:	be 00 00 00 00       	mov    $0x0,%esi
+  800180:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800186:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800188:	48 85 c0             	test   %rax,%rax
+  80018b:	7f 06                	jg     800193 <sys_env_destroy+0x38>
+}
+  80018d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800191:	c9                   	leave
+  800192:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800193:	49 89 c0             	mov    %rax,%r8
+  800196:	b9 03 00 00 00       	mov    $0x3,%ecx
+  80019b:	48 ba 90 2c 80 00 00 	movabs $0x802c90,%rdx
+  8001a2:	00 00 00 
+  8001a5:	be 26 00 00 00       	mov    $0x26,%esi
+  8001aa:	48 bf af 2c 80 00 00 	movabs $0x802caf,%rdi
+  8001b1:	00 00 00 
+  8001b4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001b9:	49 b9 17 1c 80 00 00 	movabs $0x801c17,%r9
+  8001c0:	00 00 00 
+  8001c3:	41 ff d1             	call   *%r9
+
+00000000008001c6 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  8001c6:	55                   	push   %rbp
+  8001c7:	48 89 e5             	mov    %rsp,%rbp
+  8001ca:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8001cb:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8001d0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8001d5:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8001da:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8001df:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8001e4:	be 00 00 00 00       	mov    $0x0,%esi
+  8001e9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8001ef:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  8001f1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8001f5:	c9                   	leave
+  8001f6:	c3                   	ret
+
+00000000008001f7 <sys_yield>:
+
+void
+sys_yield(void) {
+  8001f7:	55                   	push   %rbp
+  8001f8:	48 89 e5             	mov    %rsp,%rbp
+  8001fb:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8001fc:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800201:	ba 00 00 00 00       	mov    $0x0,%edx
+  800206:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80020b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800210:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800215:	be 00 00 00 00       	mov    $0x0,%esi
+  80021a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800220:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  800222:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800226:	c9                   	leave
+  800227:	c3                   	ret
+
+0000000000800228 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  800228:	55                   	push   %rbp
+  800229:	48 89 e5             	mov    %rsp,%rbp
+  80022c:	53                   	push   %rbx
+  80022d:	48 89 fa             	mov    %rdi,%rdx
+  800230:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  800233:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800238:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  80023f:	00 00 00 
+  800242:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800247:	be 00 00 00 00       	mov    $0x0,%esi
+  80024c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800252:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  800254:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800258:	c9                   	leave
+  800259:	c3                   	ret
+
+000000000080025a <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  80025a:	55                   	push   %rbp
+  80025b:	48 89 e5             	mov    %rsp,%rbp
+  80025e:	53                   	push   %rbx
+  80025f:	49 89 f8             	mov    %rdi,%r8
+  800262:	48 89 d3             	mov    %rdx,%rbx
+  800265:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  800268:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80026d:	4c 89 c2             	mov    %r8,%rdx
+  800270:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800273:	be 00 00 00 00       	mov    $0x0,%esi
+  800278:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80027e:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  800280:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800284:	c9                   	leave
+  800285:	c3                   	ret
+
+0000000000800286 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  800286:	55                   	push   %rbp
+  800287:	48 89 e5             	mov    %rsp,%rbp
+  80028a:	53                   	push   %rbx
+  80028b:	48 83 ec 08          	sub    $0x8,%rsp
+  80028f:	89 f8                	mov    %edi,%eax
+  800291:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  800294:	48 63 f9             	movslq %ecx,%rdi
+  800297:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80029a:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80029f:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8002a2:	be 00 00 00 00       	mov    $0x0,%esi
+  8002a7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8002ad:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8002af:	48 85 c0             	test   %rax,%rax
+  8002b2:	7f 06                	jg     8002ba <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  8002b4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8002b8:	c9                   	leave
+  8002b9:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8002ba:	49 89 c0             	mov    %rax,%r8
+  8002bd:	b9 04 00 00 00       	mov    $0x4,%ecx
+  8002c2:	48 ba 90 2c 80 00 00 	movabs $0x802c90,%rdx
+  8002c9:	00 00 00 
+  8002cc:	be 26 00 00 00       	mov    $0x26,%esi
+  8002d1:	48 bf af 2c 80 00 00 	movabs $0x802caf,%rdi
+  8002d8:	00 00 00 
+  8002db:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002e0:	49 b9 17 1c 80 00 00 	movabs $0x801c17,%r9
+  8002e7:	00 00 00 
+  8002ea:	41 ff d1             	call   *%r9
+
+00000000008002ed <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8002ed:	55                   	push   %rbp
+  8002ee:	48 89 e5             	mov    %rsp,%rbp
+  8002f1:	53                   	push   %rbx
+  8002f2:	48 83 ec 08          	sub    $0x8,%rsp
+  8002f6:	89 f8                	mov    %edi,%eax
+  8002f8:	49 89 f2             	mov    %rsi,%r10
+  8002fb:	48 89 cf             	mov    %rcx,%rdi
+  8002fe:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  800301:	48 63 da             	movslq %edx,%rbx
+  800304:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800307:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80030c:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80030f:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  800312:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800314:	48 85 c0             	test   %rax,%rax
+  800317:	7f 06                	jg     80031f <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  800319:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80031d:	c9                   	leave
+  80031e:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80031f:	49 89 c0             	mov    %rax,%r8
+  800322:	b9 05 00 00 00       	mov    $0x5,%ecx
+  800327:	48 ba 90 2c 80 00 00 	movabs $0x802c90,%rdx
+  80032e:	00 00 00 
+  800331:	be 26 00 00 00       	mov    $0x26,%esi
+  800336:	48 bf af 2c 80 00 00 	movabs $0x802caf,%rdi
+  80033d:	00 00 00 
+  800340:	b8 00 00 00 00       	mov    $0x0,%eax
+  800345:	49 b9 17 1c 80 00 00 	movabs $0x801c17,%r9
+  80034c:	00 00 00 
+  80034f:	41 ff d1             	call   *%r9
+
+0000000000800352 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  800352:	55                   	push   %rbp
+  800353:	48 89 e5             	mov    %rsp,%rbp
+  800356:	53                   	push   %rbx
+  800357:	48 83 ec 08          	sub    $0x8,%rsp
+  80035b:	48 89 f1             	mov    %rsi,%rcx
+  80035e:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  800361:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800364:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800369:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80036e:	be 00 00 00 00       	mov    $0x0,%esi
+  800373:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800379:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80037b:	48 85 c0             	test   %rax,%rax
+  80037e:	7f 06                	jg     800386 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  800380:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800384:	c9                   	leave
+  800385:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800386:	49 89 c0             	mov    %rax,%r8
+  800389:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80038e:	48 ba 90 2c 80 00 00 	movabs $0x802c90,%rdx
+  800395:	00 00 00 
+  800398:	be 26 00 00 00       	mov    $0x26,%esi
+  80039d:	48 bf af 2c 80 00 00 	movabs $0x802caf,%rdi
+  8003a4:	00 00 00 
+  8003a7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003ac:	49 b9 17 1c 80 00 00 	movabs $0x801c17,%r9
+  8003b3:	00 00 00 
+  8003b6:	41 ff d1             	call   *%r9
+
+00000000008003b9 <sys_region_batch>:
+
+int
+sys_region_batch(const struct RegionOp *ops, size_t count) {
+  8003b9:	55                   	push   %rbp
+  8003ba:	48 89 e5             	mov    %rsp,%rbp
+  8003bd:	53                   	push   %rbx
+  8003be:	48 83 ec 08          	sub    $0x8,%rsp
+  8003c2:	48 89 fa             	mov    %rdi,%rdx
+  8003c5:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8003c8:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8003cd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8003d2:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8003d7:	be 00 00 00 00       	mov    $0x0,%esi
+  8003dc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8003e2:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8003e4:	48 85 c0             	test   %rax,%rax
+  8003e7:	7f 06                	jg     8003ef <sys_region_batch+0x36>
+        else
+            platform_asan_unpoison(va, ops[i].size);
+    }
+#endif
+    return res;
+}
+  8003e9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8003ed:	c9                   	leave
+  8003ee:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8003ef:	49 89 c0             	mov    %rax,%r8
+  8003f2:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  8003f7:	48 ba 90 2c 80 00 00 	movabs $0x802c90,%rdx
+  8003fe:	00 00 00 
+  800401:	be 26 00 00 00       	mov    $0x26,%esi
+  800406:	48 bf af 2c 80 00 00 	movabs $0x802caf,%rdi
+  80040d:	00 00 00 
+  800410:	b8 00 00 00 00       	mov    $0x0,%eax
+  800415:	49 b9 17 1c 80 00 00 	movabs $0x801c17,%r9
+  80041c:	00 00 00 
+  80041f:	41 ff d1             	call   *%r9
+
+0000000000800422 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  800422:	55                   	push   %rbp
+  800423:	48 89 e5             	mov    %rsp,%rbp
+  800426:	53                   	push   %rbx
+  800427:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  80042b:	48 63 ce             	movslq %esi,%rcx
+  80042e:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800431:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800436:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80043b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800440:	be 00 00 00 00       	mov    $0x0,%esi
+  800445:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80044b:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80044d:	48 85 c0             	test   %rax,%rax
+  800450:	7f 06                	jg     800458 <sys_env_set_status+0x36>
+}
+  800452:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800456:	c9                   	leave
+  800457:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800458:	49 89 c0             	mov    %rax,%r8
+  80045b:	b9 09 00 00 00       	mov    $0x9,%ecx
+  800460:	48 ba 90 2c 80 00 00 	movabs $0x802c90,%rdx
+  800467:	00 00 00 
+  80046a:	be 26 00 00 00       	mov    $0x26,%esi
+  80046f:	48 bf af 2c 80 00 00 	movabs $0x802caf,%rdi
+  800476:	00 00 00 
+  800479:	b8 00 00 00 00       	mov    $0x0,%eax
+  80047e:	49 b9 17 1c 80 00 00 	movabs $0x801c17,%r9
+  800485:	00 00 00 
+  800488:	41 ff d1             	call   *%r9
+
+000000000080048b <sys_env_set_weight>:
+
+int
+sys_env_set_weight(envid_t envid, uint32_t weight) {
+  80048b:	55                   	push   %rbp
+  80048c:	48 89 e5             	mov    %rsp,%rbp
+  80048f:	53                   	push   %rbx
+  800490:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_weight, 1, envid, weight, 0, 0, 0, 0);
+  800494:	89 f1                	mov    %esi,%ecx
+  800496:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800499:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80049e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8004a3:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8004a8:	be 00 00 00 00       	mov    $0x0,%esi
+  8004ad:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8004b3:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8004b5:	48 85 c0             	test   %rax,%rax
+  8004b8:	7f 06                	jg     8004c0 <sys_env_set_weight+0x35>
+}
+  8004ba:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8004be:	c9                   	leave
+  8004bf:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8004c0:	49 89 c0             	mov    %rax,%r8
+  8004c3:	b9 10 00 00 00       	mov    $0x10,%ecx
+  8004c8:	48 ba 90 2c 80 00 00 	movabs $0x802c90,%rdx
+  8004cf:	00 00 00 
+  8004d2:	be 26 00 00 00       	mov    $0x26,%esi
+  8004d7:	48 bf af 2c 80 00 00 	movabs $0x802caf,%rdi
+  8004de:	00 00 00 
+  8004e1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004e6:	49 b9 17 1c 80 00 00 	movabs $0x801c17,%r9
+  8004ed:	00 00 00 
+  8004f0:	41 ff d1             	call   *%r9
+
+00000000008004f3 <sys_env_set_rt>:
+
+int
+sys_env_set_rt(envid_t envid, uint64_t period, uint64_t budget, uint64_t deadline) {
+  8004f3:	55                   	push   %rbp
+  8004f4:	48 89 e5             	mov    %rsp,%rbp
+  8004f7:	53                   	push   %rbx
+  8004f8:	48 83 ec 08          	sub    $0x8,%rsp
+  8004fc:	89 f8                	mov    %edi,%eax
+  8004fe:	48 89 d3             	mov    %rdx,%rbx
+  800501:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_env_set_rt, 1, envid, period, budget, deadline, 0, 0);
+  800504:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800507:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80050c:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80050f:	be 00 00 00 00       	mov    $0x0,%esi
+  800514:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80051a:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80051c:	48 85 c0             	test   %rax,%rax
+  80051f:	7f 06                	jg     800527 <sys_env_set_rt+0x34>
+}
+  800521:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800525:	c9                   	leave
+  800526:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800527:	49 89 c0             	mov    %rax,%r8
+  80052a:	b9 11 00 00 00       	mov    $0x11,%ecx
+  80052f:	48 ba 90 2c 80 00 00 	movabs $0x802c90,%rdx
+  800536:	00 00 00 
+  800539:	be 26 00 00 00       	mov    $0x26,%esi
+  80053e:	48 bf af 2c 80 00 00 	movabs $0x802caf,%rdi
+  800545:	00 00 00 
+  800548:	b8 00 00 00 00       	mov    $0x0,%eax
+  80054d:	49 b9 17 1c 80 00 00 	movabs $0x801c17,%r9
+  800554:	00 00 00 
+  800557:	41 ff d1             	call   *%r9
+
+000000000080055a <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  80055a:	55                   	push   %rbp
+  80055b:	48 89 e5             	mov    %rsp,%rbp
+  80055e:	53                   	push   %rbx
+  80055f:	48 83 ec 08          	sub    $0x8,%rsp
+  800563:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  800566:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800569:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80056e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800573:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800578:	be 00 00 00 00       	mov    $0x0,%esi
+  80057d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800583:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800585:	48 85 c0             	test   %rax,%rax
+  800588:	7f 06                	jg     800590 <sys_env_set_trapframe+0x36>
+}
+  80058a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80058e:	c9                   	leave
+  80058f:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800590:	49 89 c0             	mov    %rax,%r8
+  800593:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  800598:	48 ba 90 2c 80 00 00 	movabs $0x802c90,%rdx
+  80059f:	00 00 00 
+  8005a2:	be 26 00 00 00       	mov    $0x26,%esi
+  8005a7:	48 bf af 2c 80 00 00 	movabs $0x802caf,%rdi
+  8005ae:	00 00 00 
+  8005b1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005b6:	49 b9 17 1c 80 00 00 	movabs $0x801c17,%r9
+  8005bd:	00 00 00 
+  8005c0:	41 ff d1             	call   *%r9
+
+00000000008005c3 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  8005c3:	55                   	push   %rbp
+  8005c4:	48 89 e5             	mov    %rsp,%rbp
+  8005c7:	53                   	push   %rbx
+  8005c8:	48 83 ec 08          	sub    $0x8,%rsp
+  8005cc:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  8005cf:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8005d2:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8005d7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8005dc:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8005e1:	be 00 00 00 00       	mov    $0x0,%esi
+  8005e6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8005ec:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8005ee:	48 85 c0             	test   %rax,%rax
+  8005f1:	7f 06                	jg     8005f9 <sys_env_set_pgfault_upcall+0x36>
+}
+  8005f3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8005f7:	c9                   	leave
+  8005f8:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8005f9:	49 89 c0             	mov    %rax,%r8
+  8005fc:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  800601:	48 ba 90 2c 80 00 00 	movabs $0x802c90,%rdx
+  800608:	00 00 00 
+  80060b:	be 26 00 00 00       	mov    $0x26,%esi
+  800610:	48 bf af 2c 80 00 00 	movabs $0x802caf,%rdi
+  800617:	00 00 00 
+  80061a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80061f:	49 b9 17 1c 80 00 00 	movabs $0x801c17,%r9
+  800626:	00 00 00 
+  800629:	41 ff d1             	call   *%r9
+
+000000000080062c <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  80062c:	55                   	push   %rbp
+  80062d:	48 89 e5             	mov    %rsp,%rbp
+  800630:	53                   	push   %rbx
+  800631:	89 f8                	mov    %edi,%eax
+  800633:	49 89 f1             	mov    %rsi,%r9
+  800636:	48 89 d3             	mov    %rdx,%rbx
+  800639:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  80063c:	49 63 f0             	movslq %r8d,%rsi
+  80063f:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800642:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800647:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80064a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800650:	cd 30                	int    $0x30
+}
+  800652:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800656:	c9                   	leave
+  800657:	c3                   	ret
+
+0000000000800658 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  800658:	55                   	push   %rbp
+  800659:	48 89 e5             	mov    %rsp,%rbp
+  80065c:	53                   	push   %rbx
+  80065d:	48 83 ec 08          	sub    $0x8,%rsp
+  800661:	48 89 fa             	mov    %rdi,%rdx
+  800664:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  800667:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80066c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800671:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800676:	be 00 00 00 00       	mov    $0x0,%esi
+  80067b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800681:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800683:	48 85 c0             	test   %rax,%rax
+  800686:	7f 06                	jg     80068e <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  800688:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80068c:	c9                   	leave
+  80068d:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80068e:	49 89 c0             	mov    %rax,%r8
+  800691:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  800696:	48 ba 90 2c 80 00 00 	movabs $0x802c90,%rdx
+  80069d:	00 00 00 
+  8006a0:	be 26 00 00 00       	mov    $0x26,%esi
+  8006a5:	48 bf af 2c 80 00 00 	movabs $0x802caf,%rdi
+  8006ac:	00 00 00 
+  8006af:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006b4:	49 b9 17 1c 80 00 00 	movabs $0x801c17,%r9
+  8006bb:	00 00 00 
+  8006be:	41 ff d1             	call   *%r9
+
+00000000008006c1 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8006c1:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8006c8:	ff ff ff 
+  8006cb:	48 01 f8             	add    %rdi,%rax
+  8006ce:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  8006d2:	c3                   	ret
+
+00000000008006d3 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8006d3:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8006da:	ff ff ff 
+  8006dd:	48 01 f8             	add    %rdi,%rax
+  8006e0:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  8006e4:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  8006ea:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  8006ee:	c3                   	ret
+
+00000000008006ef <fd_alloc_from>:
+}
+
+/* Like fd_alloc(), but only considers fds starting from fdnum,
+ * so that several fds can be found before their pages are allocated */
+int
+fd_alloc_from(int fdnum, struct Fd **fd_store) {
+  8006ef:	55                   	push   %rbp
+  8006f0:	48 89 e5             	mov    %rsp,%rbp
+  8006f3:	41 57                	push   %r15
+  8006f5:	41 56                	push   %r14
+  8006f7:	41 55                	push   %r13
+  8006f9:	41 54                	push   %r12
+  8006fb:	53                   	push   %rbx
+  8006fc:	48 83 ec 08          	sub    $0x8,%rsp
+  800700:	49 89 f7             	mov    %rsi,%r15
+    for (int i = MAX(fdnum, 0); i < MAXFD; i++) {
+  800703:	85 ff                	test   %edi,%edi
+  800705:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80070b:	44 0f 49 e7          	cmovns %edi,%r12d
+  80070f:	83 ff 1f             	cmp    $0x1f,%edi
+  800712:	7f 37                	jg     80074b <fd_alloc_from+0x5c>
+  800714:	49 63 dc             	movslq %r12d,%rbx
+  800717:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  80071e:	48 c1 e3 0c          	shl    $0xc,%rbx
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  800722:	49 be f8 17 80 00 00 	movabs $0x8017f8,%r14
+  800729:	00 00 00 
+        struct Fd *fd = INDEX2FD(i);
+  80072c:	49 89 dd             	mov    %rbx,%r13
+        if (!(get_prot(fd) & PROT_R)) {
+  80072f:	48 89 df             	mov    %rbx,%rdi
+  800732:	41 ff d6             	call   *%r14
+  800735:	83 e0 04             	and    $0x4,%eax
+  800738:	74 1c                	je     800756 <fd_alloc_from+0x67>
+    for (int i = MAX(fdnum, 0); i < MAXFD; i++) {
+  80073a:	41 83 c4 01          	add    $0x1,%r12d
+  80073e:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  800745:	41 83 fc 1f          	cmp    $0x1f,%r12d
+  800749:	7e e1                	jle    80072c <fd_alloc_from+0x3d>
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  80074b:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  800751:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  800756:	4d 89 2f             	mov    %r13,(%r15)
+}
+  800759:	48 83 c4 08          	add    $0x8,%rsp
+  80075d:	5b                   	pop    %rbx
+  80075e:	41 5c                	pop    %r12
+  800760:	41 5d                	pop    %r13
+  800762:	41 5e                	pop    %r14
+  800764:	41 5f                	pop    %r15
+  800766:	5d                   	pop    %rbp
+  800767:	c3                   	ret
+
+0000000000800768 <fd_alloc>:
+fd_alloc(struct Fd **fd_store) {
+  800768:	55                   	push   %rbp
+  800769:	48 89 e5             	mov    %rsp,%rbp
+  80076c:	48 89 fe             	mov    %rdi,%rsi
+    return fd_alloc_from(0, fd_store);
+  80076f:	bf 00 00 00 00       	mov    $0x0,%edi
+  800774:	48 b8 ef 06 80 00 00 	movabs $0x8006ef,%rax
+  80077b:	00 00 00 
+  80077e:	ff d0                	call   *%rax
+}
+  800780:	5d                   	pop    %rbp
+  800781:	c3                   	ret
+
+0000000000800782 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  800782:	83 ff 1f             	cmp    $0x1f,%edi
+  800785:	77 39                	ja     8007c0 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  800787:	55                   	push   %rbp
+  800788:	48 89 e5             	mov    %rsp,%rbp
+  80078b:	41 54                	push   %r12
+  80078d:	53                   	push   %rbx
+  80078e:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  800791:	48 63 df             	movslq %edi,%rbx
+  800794:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  80079b:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  80079f:	48 89 df             	mov    %rbx,%rdi
+  8007a2:	48 b8 f8 17 80 00 00 	movabs $0x8017f8,%rax
+  8007a9:	00 00 00 
+  8007ac:	ff d0                	call   *%rax
+  8007ae:	a8 04                	test   $0x4,%al
+  8007b0:	74 14                	je     8007c6 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  8007b2:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  8007b6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8007bb:	5b                   	pop    %rbx
+  8007bc:	41 5c                	pop    %r12
+  8007be:	5d                   	pop    %rbp
+  8007bf:	c3                   	ret
+        return -E_INVAL;
+  8007c0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8007c5:	c3                   	ret
+        return -E_INVAL;
+  8007c6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8007cb:	eb ee                	jmp    8007bb <fd_lookup+0x39>
+
+00000000008007cd <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  8007cd:	55                   	push   %rbp
+  8007ce:	48 89 e5             	mov    %rsp,%rbp
+  8007d1:	41 54                	push   %r12
+  8007d3:	53                   	push   %rbx
+  8007d4:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  8007d7:	48 b8 40 2d 80 00 00 	movabs $0x802d40,%rax
+  8007de:	00 00 00 
+  8007e1:	48 bb 20 40 80 00 00 	movabs $0x804020,%rbx
+  8007e8:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  8007eb:	39 3b                	cmp    %edi,(%rbx)
+  8007ed:	74 47                	je     800836 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  8007ef:	48 83 c0 08          	add    $0x8,%rax
+  8007f3:	48 8b 18             	mov    (%rax),%rbx
+  8007f6:	48 85 db             	test   %rbx,%rbx
+  8007f9:	75 f0                	jne    8007eb <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8007fb:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  800802:	00 00 00 
+  800805:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+  80080b:	89 fa                	mov    %edi,%edx
+  80080d:	48 bf c0 2c 80 00 00 	movabs $0x802cc0,%rdi
+  800814:	00 00 00 
+  800817:	b8 00 00 00 00       	mov    $0x0,%eax
+  80081c:	48 b9 67 1d 80 00 00 	movabs $0x801d67,%rcx
+  800823:	00 00 00 
+  800826:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  800828:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  80082d:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  800831:	5b                   	pop    %rbx
+  800832:	41 5c                	pop    %r12
+  800834:	5d                   	pop    %rbp
+  800835:	c3                   	ret
+            return 0;
+  800836:	b8 00 00 00 00       	mov    $0x0,%eax
+  80083b:	eb f0                	jmp    80082d <dev_lookup+0x60>
+
+000000000080083d <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  80083d:	55                   	push   %rbp
+  80083e:	48 89 e5             	mov    %rsp,%rbp
+  800841:	41 55                	push   %r13
+  800843:	41 54                	push   %r12
+  800845:	53                   	push   %rbx
+  800846:	48 83 ec 18          	sub    $0x18,%rsp
+  80084a:	48 89 fb             	mov    %rdi,%rbx
+  80084d:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  800850:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  800857:	ff ff ff 
+  80085a:	48 01 df             	add    %rbx,%rdi
+  80085d:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  800861:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800865:	48 b8 82 07 80 00 00 	movabs $0x800782,%rax
+  80086c:	00 00 00 
+  80086f:	ff d0                	call   *%rax
+  800871:	41 89 c5             	mov    %eax,%r13d
+  800874:	85 c0                	test   %eax,%eax
+  800876:	78 06                	js     80087e <fd_close+0x41>
+  800878:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  80087c:	74 1a                	je     800898 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  80087e:	45 84 e4             	test   %r12b,%r12b
+  800881:	b8 00 00 00 00       	mov    $0x0,%eax
+  800886:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  80088a:	44 89 e8             	mov    %r13d,%eax
+  80088d:	48 83 c4 18          	add    $0x18,%rsp
+  800891:	5b                   	pop    %rbx
+  800892:	41 5c                	pop    %r12
+  800894:	41 5d                	pop    %r13
+  800896:	5d                   	pop    %rbp
+  800897:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  800898:	8b 3b                	mov    (%rbx),%edi
+  80089a:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80089e:	48 b8 cd 07 80 00 00 	movabs $0x8007cd,%rax
+  8008a5:	00 00 00 
+  8008a8:	ff d0                	call   *%rax
+  8008aa:	41 89 c5             	mov    %eax,%r13d
+  8008ad:	85 c0                	test   %eax,%eax
+  8008af:	78 1b                	js     8008cc <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  8008b1:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8008b5:	48 8b 40 20          	mov    0x20(%rax),%rax
+  8008b9:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  8008bf:	48 85 c0             	test   %rax,%rax
+  8008c2:	74 08                	je     8008cc <fd_close+0x8f>
+  8008c4:	48 89 df             	mov    %rbx,%rdi
+  8008c7:	ff d0                	call   *%rax
+  8008c9:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8008cc:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8008d1:	48 89 de             	mov    %rbx,%rsi
+  8008d4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8008d9:	48 b8 52 03 80 00 00 	movabs $0x800352,%rax
+  8008e0:	00 00 00 
+  8008e3:	ff d0                	call   *%rax
+    return res;
+  8008e5:	eb a3                	jmp    80088a <fd_close+0x4d>
+
+00000000008008e7 <close>:
+
+int
+close(int fdnum) {
+  8008e7:	55                   	push   %rbp
+  8008e8:	48 89 e5             	mov    %rsp,%rbp
+  8008eb:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  8008ef:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8008f3:	48 b8 82 07 80 00 00 	movabs $0x800782,%rax
+  8008fa:	00 00 00 
+  8008fd:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8008ff:	85 c0                	test   %eax,%eax
+  800901:	78 15                	js     800918 <close+0x31>
+
+    return fd_close(fd, 1);
+  800903:	be 01 00 00 00       	mov    $0x1,%esi
+  800908:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80090c:	48 b8 3d 08 80 00 00 	movabs $0x80083d,%rax
+  800913:	00 00 00 
+  800916:	ff d0                	call   *%rax
+}
+  800918:	c9                   	leave
+  800919:	c3                   	ret
+
+000000000080091a <close_all>:
+
+void
+close_all(void) {
+  80091a:	55                   	push   %rbp
+  80091b:	48 89 e5             	mov    %rsp,%rbp
+  80091e:	41 54                	push   %r12
+  800920:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  800921:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800926:	49 bc e7 08 80 00 00 	movabs $0x8008e7,%r12
+  80092d:	00 00 00 
+  800930:	89 df                	mov    %ebx,%edi
+  800932:	41 ff d4             	call   *%r12
+  800935:	83 c3 01             	add    $0x1,%ebx
+  800938:	83 fb 20             	cmp    $0x20,%ebx
+  80093b:	75 f3                	jne    800930 <close_all+0x16>
+}
+  80093d:	5b                   	pop    %rbx
+  80093e:	41 5c                	pop    %r12
+  800940:	5d                   	pop    %rbp
+  800941:	c3                   	ret
+
+0000000000800942 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  800942:	55                   	push   %rbp
+  800943:	48 89 e5             	mov    %rsp,%rbp
+  800946:	41 57                	push   %r15
+  800948:	41 56                	push   %r14
+  80094a:	41 55                	push   %r13
+  80094c:	41 54                	push   %r12
+  80094e:	53                   	push   %rbx
+  80094f:	48 83 ec 18          	sub    $0x18,%rsp
+  800953:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  800956:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  80095a:	48 b8 82 07 80 00 00 	movabs $0x800782,%rax
+  800961:	00 00 00 
+  800964:	ff d0                	call   *%rax
+  800966:	89 c3                	mov    %eax,%ebx
+  800968:	85 c0                	test   %eax,%eax
+  80096a:	0f 88 b8 00 00 00    	js     800a28 <dup+0xe6>
+    close(newfdnum);
+  800970:	44 89 e7             	mov    %r12d,%edi
+  800973:	48 b8 e7 08 80 00 00 	movabs $0x8008e7,%rax
+  80097a:	00 00 00 
+  80097d:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  80097f:	4d 63 ec             	movslq %r12d,%r13
+  800982:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  800989:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  80098d:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  800991:	4c 89 ff             	mov    %r15,%rdi
+  800994:	49 be d3 06 80 00 00 	movabs $0x8006d3,%r14
+  80099b:	00 00 00 
+  80099e:	41 ff d6             	call   *%r14
+  8009a1:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  8009a4:	4c 89 ef             	mov    %r13,%rdi
+  8009a7:	41 ff d6             	call   *%r14
+  8009aa:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  8009ad:	48 89 df             	mov    %rbx,%rdi
+  8009b0:	48 b8 f8 17 80 00 00 	movabs $0x8017f8,%rax
+  8009b7:	00 00 00 
+  8009ba:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  8009bc:	a8 04                	test   $0x4,%al
+  8009be:	74 2b                	je     8009eb <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  8009c0:	41 89 c1             	mov    %eax,%r9d
+  8009c3:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8009c9:	4c 89 f1             	mov    %r14,%rcx
+  8009cc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8009d1:	48 89 de             	mov    %rbx,%rsi
+  8009d4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8009d9:	48 b8 ed 02 80 00 00 	movabs $0x8002ed,%rax
+  8009e0:	00 00 00 
+  8009e3:	ff d0                	call   *%rax
+  8009e5:	89 c3                	mov    %eax,%ebx
+  8009e7:	85 c0                	test   %eax,%eax
+  8009e9:	78 4e                	js     800a39 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  8009eb:	4c 89 ff             	mov    %r15,%rdi
+  8009ee:	48 b8 f8 17 80 00 00 	movabs $0x8017f8,%rax
+  8009f5:	00 00 00 
+  8009f8:	ff d0                	call   *%rax
+  8009fa:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  8009fd:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  800a03:	4c 89 e9             	mov    %r13,%rcx
+  800a06:	ba 00 00 00 00       	mov    $0x0,%edx
+  800a0b:	4c 89 fe             	mov    %r15,%rsi
+  800a0e:	bf 00 00 00 00       	mov    $0x0,%edi
+  800a13:	48 b8 ed 02 80 00 00 	movabs $0x8002ed,%rax
+  800a1a:	00 00 00 
+  800a1d:	ff d0                	call   *%rax
+  800a1f:	89 c3                	mov    %eax,%ebx
+  800a21:	85 c0                	test   %eax,%eax
+  800a23:	78 14                	js     800a39 <dup+0xf7>
+
+    return newfdnum;
+  800a25:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  800a28:	89 d8                	mov    %ebx,%eax
+  800a2a:	48 83 c4 18          	add    $0x18,%rsp
+  800a2e:	5b                   	pop    %rbx
+  800a2f:	41 5c                	pop    %r12
+  800a31:	41 5d                	pop    %r13
+  800a33:	41 5e                	pop    %r14
+  800a35:	41 5f                	pop    %r15
+  800a37:	5d                   	pop    %rbp
+  800a38:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  800a39:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800a3e:	4c 89 ee             	mov    %r13,%rsi
+  800a41:	bf 00 00 00 00       	mov    $0x0,%edi
+  800a46:	49 bc 52 03 80 00 00 	movabs $0x800352,%r12
+  800a4d:	00 00 00 
+  800a50:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  800a53:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800a58:	4c 89 f6             	mov    %r14,%rsi
+  800a5b:	bf 00 00 00 00       	mov    $0x0,%edi
+  800a60:	41 ff d4             	call   *%r12
+    return res;
+  800a63:	eb c3                	jmp    800a28 <dup+0xe6>
+
+0000000000800a65 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  800a65:	55                   	push   %rbp
+  800a66:	48 89 e5             	mov    %rsp,%rbp
+  800a69:	41 56                	push   %r14
+  800a6b:	41 55                	push   %r13
+  800a6d:	41 54                	push   %r12
+  800a6f:	53                   	push   %rbx
+  800a70:	48 83 ec 10          	sub    $0x10,%rsp
+  800a74:	89 fb                	mov    %edi,%ebx
+  800a76:	49 89 f4             	mov    %rsi,%r12
+  800a79:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800a7c:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800a80:	48 b8 82 07 80 00 00 	movabs $0x800782,%rax
+  800a87:	00 00 00 
+  800a8a:	ff d0                	call   *%rax
+  800a8c:	85 c0                	test   %eax,%eax
+  800a8e:	78 4c                	js     800adc <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800a90:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  800a94:	41 8b 3e             	mov    (%r14),%edi
+  800a97:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800a9b:	48 b8 cd 07 80 00 00 	movabs $0x8007cd,%rax
+  800aa2:	00 00 00 
+  800aa5:	ff d0                	call   *%rax
+  800aa7:	85 c0                	test   %eax,%eax
+  800aa9:	78 35                	js     800ae0 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  800aab:	41 8b 46 08          	mov    0x8(%r14),%eax
+  800aaf:	83 e0 03             	and    $0x3,%eax
+  800ab2:	83 f8 01             	cmp    $0x1,%eax
+  800ab5:	74 2d                	je     800ae4 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  800ab7:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800abb:	48 8b 40 10          	mov    0x10(%rax),%rax
+  800abf:	48 85 c0             	test   %rax,%rax
+  800ac2:	74 56                	je     800b1a <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  800ac4:	4c 89 ea             	mov    %r13,%rdx
+  800ac7:	4c 89 e6             	mov    %r12,%rsi
+  800aca:	4c 89 f7             	mov    %r14,%rdi
+  800acd:	ff d0                	call   *%rax
+}
+  800acf:	48 83 c4 10          	add    $0x10,%rsp
+  800ad3:	5b                   	pop    %rbx
+  800ad4:	41 5c                	pop    %r12
+  800ad6:	41 5d                	pop    %r13
+  800ad8:	41 5e                	pop    %r14
+  800ada:	5d                   	pop    %rbp
+  800adb:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800adc:	48 98                	cltq
+  800ade:	eb ef                	jmp    800acf <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800ae0:	48 98                	cltq
+  800ae2:	eb eb                	jmp    800acf <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  800ae4:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  800aeb:	00 00 00 
+  800aee:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+  800af4:	89 da                	mov    %ebx,%edx
+  800af6:	48 bf 01 2d 80 00 00 	movabs $0x802d01,%rdi
+  800afd:	00 00 00 
+  800b00:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b05:	48 b9 67 1d 80 00 00 	movabs $0x801d67,%rcx
+  800b0c:	00 00 00 
+  800b0f:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  800b11:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  800b18:	eb b5                	jmp    800acf <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  800b1a:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  800b21:	eb ac                	jmp    800acf <read+0x6a>
+
+0000000000800b23 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  800b23:	55                   	push   %rbp
+  800b24:	48 89 e5             	mov    %rsp,%rbp
+  800b27:	41 57                	push   %r15
+  800b29:	41 56                	push   %r14
+  800b2b:	41 55                	push   %r13
+  800b2d:	41 54                	push   %r12
+  800b2f:	53                   	push   %rbx
+  800b30:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  800b34:	48 85 d2             	test   %rdx,%rdx
+  800b37:	74 54                	je     800b8d <readn+0x6a>
+  800b39:	41 89 fd             	mov    %edi,%r13d
+  800b3c:	49 89 f6             	mov    %rsi,%r14
+  800b3f:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  800b42:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  800b47:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  800b4c:	49 bf 65 0a 80 00 00 	movabs $0x800a65,%r15
+  800b53:	00 00 00 
+  800b56:	4c 89 e2             	mov    %r12,%rdx
+  800b59:	48 29 f2             	sub    %rsi,%rdx
+  800b5c:	4c 01 f6             	add    %r14,%rsi
+  800b5f:	44 89 ef             	mov    %r13d,%edi
+  800b62:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  800b65:	85 c0                	test   %eax,%eax
+  800b67:	78 20                	js     800b89 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  800b69:	01 c3                	add    %eax,%ebx
+  800b6b:	85 c0                	test   %eax,%eax
+  800b6d:	74 08                	je     800b77 <readn+0x54>
+  800b6f:	48 63 f3             	movslq %ebx,%rsi
+  800b72:	4c 39 e6             	cmp    %r12,%rsi
+  800b75:	72 df                	jb     800b56 <readn+0x33>
+    }
+    return res;
+  800b77:	48 63 c3             	movslq %ebx,%rax
+}
+  800b7a:	48 83 c4 08          	add    $0x8,%rsp
+  800b7e:	5b                   	pop    %rbx
+  800b7f:	41 5c                	pop    %r12
+  800b81:	41 5d                	pop    %r13
+  800b83:	41 5e                	pop    %r14
+  800b85:	41 5f                	pop    %r15
+  800b87:	5d                   	pop    %rbp
+  800b88:	c3                   	ret
+        if (inc < 0) return inc;
+  800b89:	48 98                	cltq
+  800b8b:	eb ed                	jmp    800b7a <readn+0x57>
+    int inc = 1, res = 0;
+  800b8d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800b92:	eb e3                	jmp    800b77 <readn+0x54>
+
+0000000000800b94 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  800b94:	55                   	push   %rbp
+  800b95:	48 89 e5             	mov    %rsp,%rbp
+  800b98:	41 56                	push   %r14
+  800b9a:	41 55                	push   %r13
+  800b9c:	41 54                	push   %r12
+  800b9e:	53                   	push   %rbx
+  800b9f:	48 83 ec 10          	sub    $0x10,%rsp
+  800ba3:	89 fb                	mov    %edi,%ebx
+  800ba5:	49 89 f4             	mov    %rsi,%r12
+  800ba8:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800bab:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800baf:	48 b8 82 07 80 00 00 	movabs $0x800782,%rax
+  800bb6:	00 00 00 
+  800bb9:	ff d0                	call   *%rax
+  800bbb:	85 c0                	test   %eax,%eax
+  800bbd:	78 47                	js     800c06 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800bbf:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  800bc3:	41 8b 3e             	mov    (%r14),%edi
+  800bc6:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800bca:	48 b8 cd 07 80 00 00 	movabs $0x8007cd,%rax
+  800bd1:	00 00 00 
+  800bd4:	ff d0                	call   *%rax
+  800bd6:	85 c0                	test   %eax,%eax
+  800bd8:	78 30                	js     800c0a <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800bda:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  800bdf:	74 2d                	je     800c0e <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  800be1:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800be5:	48 8b 40 18          	mov    0x18(%rax),%rax
+  800be9:	48 85 c0             	test   %rax,%rax
+  800bec:	74 56                	je     800c44 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  800bee:	4c 89 ea             	mov    %r13,%rdx
+  800bf1:	4c 89 e6             	mov    %r12,%rsi
+  800bf4:	4c 89 f7             	mov    %r14,%rdi
+  800bf7:	ff d0                	call   *%rax
+}
+  800bf9:	48 83 c4 10          	add    $0x10,%rsp
+  800bfd:	5b                   	pop    %rbx
+  800bfe:	41 5c                	pop    %r12
+  800c00:	41 5d                	pop    %r13
+  800c02:	41 5e                	pop    %r14
+  800c04:	5d                   	pop    %rbp
+  800c05:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800c06:	48 98                	cltq
+  800c08:	eb ef                	jmp    800bf9 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800c0a:	48 98                	cltq
+  800c0c:	eb eb                	jmp    800bf9 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  800c0e:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  800c15:	00 00 00 
+  800c18:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+  800c1e:	89 da                	mov    %ebx,%edx
+  800c20:	48 bf 1d 2d 80 00 00 	movabs $0x802d1d,%rdi
+  800c27:	00 00 00 
+  800c2a:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c2f:	48 b9 67 1d 80 00 00 	movabs $0x801d67,%rcx
+  800c36:	00 00 00 
+  800c39:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  800c3b:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  800c42:	eb b5                	jmp    800bf9 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  800c44:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  800c4b:	eb ac                	jmp    800bf9 <write+0x65>
+
+0000000000800c4d <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  800c4d:	55                   	push   %rbp
+  800c4e:	48 89 e5             	mov    %rsp,%rbp
+  800c51:	53                   	push   %rbx
+  800c52:	48 83 ec 18          	sub    $0x18,%rsp
+  800c56:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800c58:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800c5c:	48 b8 82 07 80 00 00 	movabs $0x800782,%rax
+  800c63:	00 00 00 
+  800c66:	ff d0                	call   *%rax
+  800c68:	85 c0                	test   %eax,%eax
+  800c6a:	78 0c                	js     800c78 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  800c6c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800c70:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  800c73:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800c78:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800c7c:	c9                   	leave
+  800c7d:	c3                   	ret
+
+0000000000800c7e <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  800c7e:	55                   	push   %rbp
+  800c7f:	48 89 e5             	mov    %rsp,%rbp
+  800c82:	41 55                	push   %r13
+  800c84:	41 54                	push   %r12
+  800c86:	53                   	push   %rbx
+  800c87:	48 83 ec 18          	sub    $0x18,%rsp
+  800c8b:	89 fb                	mov    %edi,%ebx
+  800c8d:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800c90:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800c94:	48 b8 82 07 80 00 00 	movabs $0x800782,%rax
+  800c9b:	00 00 00 
+  800c9e:	ff d0                	call   *%rax
+  800ca0:	85 c0                	test   %eax,%eax
+  800ca2:	78 38                	js     800cdc <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800ca4:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  800ca8:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  800cac:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800cb0:	48 b8 cd 07 80 00 00 	movabs $0x8007cd,%rax
+  800cb7:	00 00 00 
+  800cba:	ff d0                	call   *%rax
+  800cbc:	85 c0                	test   %eax,%eax
+  800cbe:	78 1c                	js     800cdc <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800cc0:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  800cc5:	74 20                	je     800ce7 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  800cc7:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800ccb:	48 8b 40 30          	mov    0x30(%rax),%rax
+  800ccf:	48 85 c0             	test   %rax,%rax
+  800cd2:	74 47                	je     800d1b <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  800cd4:	44 89 e6             	mov    %r12d,%esi
+  800cd7:	4c 89 ef             	mov    %r13,%rdi
+  800cda:	ff d0                	call   *%rax
+}
+  800cdc:	48 83 c4 18          	add    $0x18,%rsp
+  800ce0:	5b                   	pop    %rbx
+  800ce1:	41 5c                	pop    %r12
+  800ce3:	41 5d                	pop    %r13
+  800ce5:	5d                   	pop    %rbp
+  800ce6:	c3                   	ret
+                thisenv->env_id, fdnum);
+  800ce7:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  800cee:	00 00 00 
+  800cf1:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  800cf7:	89 da                	mov    %ebx,%edx
+  800cf9:	48 bf e0 2c 80 00 00 	movabs $0x802ce0,%rdi
+  800d00:	00 00 00 
+  800d03:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d08:	48 b9 67 1d 80 00 00 	movabs $0x801d67,%rcx
+  800d0f:	00 00 00 
+  800d12:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  800d14:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800d19:	eb c1                	jmp    800cdc <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  800d1b:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  800d20:	eb ba                	jmp    800cdc <ftruncate+0x5e>
+
+0000000000800d22 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  800d22:	55                   	push   %rbp
+  800d23:	48 89 e5             	mov    %rsp,%rbp
+  800d26:	41 54                	push   %r12
+  800d28:	53                   	push   %rbx
+  800d29:	48 83 ec 10          	sub    $0x10,%rsp
+  800d2d:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800d30:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800d34:	48 b8 82 07 80 00 00 	movabs $0x800782,%rax
+  800d3b:	00 00 00 
+  800d3e:	ff d0                	call   *%rax
+  800d40:	85 c0                	test   %eax,%eax
+  800d42:	78 4e                	js     800d92 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800d44:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  800d48:	41 8b 3c 24          	mov    (%r12),%edi
+  800d4c:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  800d50:	48 b8 cd 07 80 00 00 	movabs $0x8007cd,%rax
+  800d57:	00 00 00 
+  800d5a:	ff d0                	call   *%rax
+  800d5c:	85 c0                	test   %eax,%eax
+  800d5e:	78 32                	js     800d92 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  800d60:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800d64:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  800d69:	74 30                	je     800d9b <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  800d6b:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  800d6e:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  800d75:	00 00 00 
+    stat->st_isdir = 0;
+  800d78:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  800d7f:	00 00 00 
+    stat->st_dev = dev;
+  800d82:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  800d89:	48 89 de             	mov    %rbx,%rsi
+  800d8c:	4c 89 e7             	mov    %r12,%rdi
+  800d8f:	ff 50 28             	call   *0x28(%rax)
+}
+  800d92:	48 83 c4 10          	add    $0x10,%rsp
+  800d96:	5b                   	pop    %rbx
+  800d97:	41 5c                	pop    %r12
+  800d99:	5d                   	pop    %rbp
+  800d9a:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  800d9b:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  800da0:	eb f0                	jmp    800d92 <fstat+0x70>
+
+0000000000800da2 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  800da2:	55                   	push   %rbp
+  800da3:	48 89 e5             	mov    %rsp,%rbp
+  800da6:	41 54                	push   %r12
+  800da8:	53                   	push   %rbx
+  800da9:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  800dac:	be 00 00 00 00       	mov    $0x0,%esi
+  800db1:	48 b8 85 11 80 00 00 	movabs $0x801185,%rax
+  800db8:	00 00 00 
+  800dbb:	ff d0                	call   *%rax
+  800dbd:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  800dbf:	85 c0                	test   %eax,%eax
+  800dc1:	78 25                	js     800de8 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  800dc3:	4c 89 e6             	mov    %r12,%rsi
+  800dc6:	89 c7                	mov    %eax,%edi
+  800dc8:	48 b8 22 0d 80 00 00 	movabs $0x800d22,%rax
+  800dcf:	00 00 00 
+  800dd2:	ff d0                	call   *%rax
+  800dd4:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  800dd7:	89 df                	mov    %ebx,%edi
+  800dd9:	48 b8 e7 08 80 00 00 	movabs $0x8008e7,%rax
+  800de0:	00 00 00 
+  800de3:	ff d0                	call   *%rax
+
+    return res;
+  800de5:	44 89 e3             	mov    %r12d,%ebx
+}
+  800de8:	89 d8                	mov    %ebx,%eax
+  800dea:	5b                   	pop    %rbx
+  800deb:	41 5c                	pop    %r12
+  800ded:	5d                   	pop    %rbp
+  800dee:	c3                   	ret
+
+0000000000800def <fsipc>:
+ * response may be written back to fsipcbuf.
+ * type: request code, passed as the simple integer IPC value.
+ * dstva: virtual address at which to receive reply page, 0 if none.
+ * Returns result from the file server. */
+static int
+fsipc(unsigned type, void *dstva) {
+  800def:	55                   	push   %rbp
+  800df0:	48 89 e5             	mov    %rsp,%rbp
+  800df3:	41 54                	push   %r12
+  800df5:	53                   	push   %rbx
+  800df6:	48 83 ec 10          	sub    $0x10,%rsp
+  800dfa:	41 89 fc             	mov    %edi,%r12d
+  800dfd:	48 89 f3             	mov    %rsi,%rbx
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  800e00:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  800e07:	00 00 00 
+  800e0a:	83 38 00             	cmpl   $0x0,(%rax)
+  800e0d:	74 5e                	je     800e6d <fsipc+0x7e>
+    if (debug) {
+        cprintf("[%08x] fsipc %d %08x\n",
+                thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+    }
+
+    ipc_send(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW);
+  800e0f:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  800e15:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  800e1a:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  800e21:	00 00 00 
+  800e24:	44 89 e6             	mov    %r12d,%esi
+  800e27:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  800e2e:	00 00 00 
+  800e31:	8b 38                	mov    (%rax),%edi
+  800e33:	48 b8 88 2b 80 00 00 	movabs $0x802b88,%rax
+  800e3a:	00 00 00 
+  800e3d:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  800e3f:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  800e46:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  800e47:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e4c:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  800e50:	48 89 de             	mov    %rbx,%rsi
+  800e53:	bf 00 00 00 00       	mov    $0x0,%edi
+  800e58:	48 b8 b3 2a 80 00 00 	movabs $0x802ab3,%rax
+  800e5f:	00 00 00 
+  800e62:	ff d0                	call   *%rax
+}
+  800e64:	48 83 c4 10          	add    $0x10,%rsp
+  800e68:	5b                   	pop    %rbx
+  800e69:	41 5c                	pop    %r12
+  800e6b:	5d                   	pop    %rbp
+  800e6c:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  800e6d:	bf 03 00 00 00       	mov    $0x3,%edi
+  800e72:	48 b8 2b 2c 80 00 00 	movabs $0x802c2b,%rax
+  800e79:	00 00 00 
+  800e7c:	ff d0                	call   *%rax
+  800e7e:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  800e85:	00 00 
+  800e87:	eb 86                	jmp    800e0f <fsipc+0x20>
+
+0000000000800e89 <devfile_trunc>:
+    return 0;
+}
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  800e89:	55                   	push   %rbp
+  800e8a:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  800e8d:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  800e94:	00 00 00 
+  800e97:	8b 57 0c             	mov    0xc(%rdi),%edx
+  800e9a:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  800e9c:	89 70 04             	mov    %esi,0x4(%rax)
+
+    return fsipc(FSREQ_SET_SIZE, NULL);
+  800e9f:	be 00 00 00 00       	mov    $0x0,%esi
+  800ea4:	bf 02 00 00 00       	mov    $0x2,%edi
+  800ea9:	48 b8 ef 0d 80 00 00 	movabs $0x800def,%rax
+  800eb0:	00 00 00 
+  800eb3:	ff d0                	call   *%rax
+}
+  800eb5:	5d                   	pop    %rbp
+  800eb6:	c3                   	ret
+
+0000000000800eb7 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  800eb7:	55                   	push   %rbp
+  800eb8:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  800ebb:	8b 47 0c             	mov    0xc(%rdi),%eax
+  800ebe:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  800ec5:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  800ec7:	be 00 00 00 00       	mov    $0x0,%esi
+  800ecc:	bf 06 00 00 00       	mov    $0x6,%edi
+  800ed1:	48 b8 ef 0d 80 00 00 	movabs $0x800def,%rax
+  800ed8:	00 00 00 
+  800edb:	ff d0                	call   *%rax
+}
+  800edd:	5d                   	pop    %rbp
+  800ede:	c3                   	ret
+
+0000000000800edf <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  800edf:	55                   	push   %rbp
+  800ee0:	48 89 e5             	mov    %rsp,%rbp
+  800ee3:	41 54                	push   %r12
+  800ee5:	53                   	push   %rbx
+  800ee6:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  800ee9:	8b 47 0c             	mov    0xc(%rdi),%eax
+  800eec:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  800ef3:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  800ef5:	be 00 00 00 00       	mov    $0x0,%esi
+  800efa:	bf 05 00 00 00       	mov    $0x5,%edi
+  800eff:	48 b8 ef 0d 80 00 00 	movabs $0x800def,%rax
+  800f06:	00 00 00 
+  800f09:	ff d0                	call   *%rax
+    if (res < 0) {
+  800f0b:	85 c0                	test   %eax,%eax
+  800f0d:	78 3d                	js     800f4c <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  800f0f:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  800f16:	00 00 00 
+  800f19:	4c 89 e6             	mov    %r12,%rsi
+  800f1c:	48 89 df             	mov    %rbx,%rdi
+  800f1f:	48 b8 8c 26 80 00 00 	movabs $0x80268c,%rax
+  800f26:	00 00 00 
+  800f29:	ff d0                	call   *%rax
+    st->st_size  = fsipcbuf.statRet.ret_size;
+  800f2b:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  800f32:	00 
+  800f33:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  800f39:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  800f40:	00 
+  800f41:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  800f47:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800f4c:	5b                   	pop    %rbx
+  800f4d:	41 5c                	pop    %r12
+  800f4f:	5d                   	pop    %rbp
+  800f50:	c3                   	ret
+
+0000000000800f51 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  800f51:	55                   	push   %rbp
+  800f52:	48 89 e5             	mov    %rsp,%rbp
+  800f55:	41 57                	push   %r15
+  800f57:	41 56                	push   %r14
+  800f59:	41 55                	push   %r13
+  800f5b:	41 54                	push   %r12
+  800f5d:	53                   	push   %rbx
+  800f5e:	48 83 ec 18          	sub    $0x18,%rsp
+  800f62:	49 89 fe             	mov    %rdi,%r14
+  800f65:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+  800f69:	48 89 d3             	mov    %rdx,%rbx
+    while (n > sizeof(fsipcbuf.write.req_buf))
+  800f6c:	48 81 fa f0 0f 00 00 	cmp    $0xff0,%rdx
+  800f73:	0f 86 e4 00 00 00    	jbe    80105d <devfile_write+0x10c>
+  800f79:	49 89 f4             	mov    %rsi,%r12
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  800f7c:	49 bd 00 60 80 00 00 	movabs $0x806000,%r13
+  800f83:	00 00 00 
+        memcpy(fsipcbuf.write.req_buf, buf, sizeof(fsipcbuf.write.req_buf));
+  800f86:	49 bf ed 28 80 00 00 	movabs $0x8028ed,%r15
+  800f8d:	00 00 00 
+  800f90:	eb 03                	jmp    800f95 <devfile_write+0x44>
+        buf += sizeof(fsipcbuf.write.req_buf);
+  800f92:	49 89 f4             	mov    %rsi,%r12
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  800f95:	41 8b 46 0c          	mov    0xc(%r14),%eax
+  800f99:	41 89 45 00          	mov    %eax,0x0(%r13)
+        fsipcbuf.write.req_n      = sizeof(fsipcbuf.write.req_buf);
+  800f9d:	49 c7 45 08 f0 0f 00 	movq   $0xff0,0x8(%r13)
+  800fa4:	00 
+        memcpy(fsipcbuf.write.req_buf, buf, sizeof(fsipcbuf.write.req_buf));
+  800fa5:	ba f0 0f 00 00       	mov    $0xff0,%edx
+  800faa:	4c 89 e6             	mov    %r12,%rsi
+  800fad:	48 bf 10 60 80 00 00 	movabs $0x806010,%rdi
+  800fb4:	00 00 00 
+  800fb7:	41 ff d7             	call   *%r15
+        ssize_t res = fsipc(FSREQ_WRITE, NULL);
+  800fba:	be 00 00 00 00       	mov    $0x0,%esi
+  800fbf:	bf 04 00 00 00       	mov    $0x4,%edi
+  800fc4:	48 b8 ef 0d 80 00 00 	movabs $0x800def,%rax
+  800fcb:	00 00 00 
+  800fce:	ff d0                	call   *%rax
+  800fd0:	48 63 d0             	movslq %eax,%rdx
+        if (res < 0 || res < sizeof(fsipcbuf.write.req_buf))
+  800fd3:	3d ef 0f 00 00       	cmp    $0xfef,%eax
+  800fd8:	7e 71                	jle    80104b <devfile_write+0xfa>
+        buf += sizeof(fsipcbuf.write.req_buf);
+  800fda:	49 8d b4 24 f0 0f 00 	lea    0xff0(%r12),%rsi
+  800fe1:	00 
+        n -= sizeof(fsipcbuf.write.req_buf);
+  800fe2:	48 81 eb f0 0f 00 00 	sub    $0xff0,%rbx
+    while (n > sizeof(fsipcbuf.write.req_buf))
+  800fe9:	48 81 fb f0 0f 00 00 	cmp    $0xff0,%rbx
+  800ff0:	77 a0                	ja     800f92 <devfile_write+0x41>
+        written += sizeof(fsipcbuf.write.req_buf);
+  800ff2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800ff6:	49 29 c4             	sub    %rax,%r12
+  800ff9:	4d 8d a4 24 f0 0f 00 	lea    0xff0(%r12),%r12
+  801000:	00 
+    fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801001:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  801008:	00 00 00 
+  80100b:	41 8b 56 0c          	mov    0xc(%r14),%edx
+  80100f:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.write.req_n      = n;
+  801011:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    memcpy(fsipcbuf.write.req_buf, buf, n);
+  801015:	48 89 da             	mov    %rbx,%rdx
+  801018:	48 8d 78 10          	lea    0x10(%rax),%rdi
+  80101c:	48 b8 ed 28 80 00 00 	movabs $0x8028ed,%rax
+  801023:	00 00 00 
+  801026:	ff d0                	call   *%rax
+    ssize_t res = fsipc(FSREQ_WRITE, NULL);
+  801028:	be 00 00 00 00       	mov    $0x0,%esi
+  80102d:	bf 04 00 00 00       	mov    $0x4,%edi
+  801032:	48 b8 ef 0d 80 00 00 	movabs $0x800def,%rax
+  801039:	00 00 00 
+  80103c:	ff d0                	call   *%rax
+  80103e:	48 63 d0             	movslq %eax,%rdx
+    written += res;
+  801041:	49 01 d4             	add    %rdx,%r12
+  801044:	48 85 d2             	test   %rdx,%rdx
+  801047:	49 0f 49 d4          	cmovns %r12,%rdx
+}
+  80104b:	48 89 d0             	mov    %rdx,%rax
+  80104e:	48 83 c4 18          	add    $0x18,%rsp
+  801052:	5b                   	pop    %rbx
+  801053:	41 5c                	pop    %r12
+  801055:	41 5d                	pop    %r13
+  801057:	41 5e                	pop    %r14
+  801059:	41 5f                	pop    %r15
+  80105b:	5d                   	pop    %rbp
+  80105c:	c3                   	ret
+    while (n > sizeof(fsipcbuf.write.req_buf))
+  80105d:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+    ssize_t written = 0;
+  801061:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  801067:	eb 98                	jmp    801001 <devfile_write+0xb0>
+
+0000000000801069 <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  801069:	55                   	push   %rbp
+  80106a:	48 89 e5             	mov    %rsp,%rbp
+  80106d:	41 57                	push   %r15
+  80106f:	41 56                	push   %r14
+  801071:	41 55                	push   %r13
+  801073:	41 54                	push   %r12
+  801075:	53                   	push   %rbx
+  801076:	48 83 ec 18          	sub    $0x18,%rsp
+  80107a:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  80107e:	49 89 f6             	mov    %rsi,%r14
+  801081:	49 89 d4             	mov    %rdx,%r12
+    while (n > sizeof(fsipcbuf.readRet.ret_buf))
+  801084:	48 81 fa 00 10 00 00 	cmp    $0x1000,%rdx
+  80108b:	0f 86 ea 00 00 00    	jbe    80117b <devfile_read+0x112>
+    ssize_t readsz = 0;
+  801091:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  801098:	00 
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801099:	49 bf 00 60 80 00 00 	movabs $0x806000,%r15
+  8010a0:	00 00 00 
+  8010a3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8010a7:	8b 40 0c             	mov    0xc(%rax),%eax
+  8010aa:	41 89 07             	mov    %eax,(%r15)
+        fsipcbuf.read.req_n = sizeof(fsipcbuf.readRet.ret_buf);
+  8010ad:	49 c7 47 08 00 10 00 	movq   $0x1000,0x8(%r15)
+  8010b4:	00 
+        ssize_t res = fsipc(FSREQ_READ, NULL);
+  8010b5:	be 00 00 00 00       	mov    $0x0,%esi
+  8010ba:	bf 03 00 00 00       	mov    $0x3,%edi
+  8010bf:	48 b8 ef 0d 80 00 00 	movabs $0x800def,%rax
+  8010c6:	00 00 00 
+  8010c9:	ff d0                	call   *%rax
+  8010cb:	4c 63 e8             	movslq %eax,%r13
+        if (res < 0)
+  8010ce:	4d 85 ed             	test   %r13,%r13
+  8010d1:	0f 88 92 00 00 00    	js     801169 <devfile_read+0x100>
+        memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  8010d7:	4c 89 ea             	mov    %r13,%rdx
+  8010da:	4c 89 fe             	mov    %r15,%rsi
+  8010dd:	4c 89 f7             	mov    %r14,%rdi
+  8010e0:	48 b8 ed 28 80 00 00 	movabs $0x8028ed,%rax
+  8010e7:	00 00 00 
+  8010ea:	ff d0                	call   *%rax
+        if (res < sizeof(fsipcbuf.readRet.ret_buf))
+  8010ec:	49 81 fd ff 0f 00 00 	cmp    $0xfff,%r13
+  8010f3:	76 6d                	jbe    801162 <devfile_read+0xf9>
+        readsz += res;
+  8010f5:	4c 01 6d c0          	add    %r13,-0x40(%rbp)
+        buf += res;
+  8010f9:	4d 01 ee             	add    %r13,%r14
+        n -= res;
+  8010fc:	4d 29 ec             	sub    %r13,%r12
+    while (n > sizeof(fsipcbuf.readRet.ret_buf))
+  8010ff:	49 81 fc 00 10 00 00 	cmp    $0x1000,%r12
+  801106:	77 9b                	ja     8010a3 <devfile_read+0x3a>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801108:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  80110f:	00 00 00 
+  801112:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  801116:	8b 51 0c             	mov    0xc(%rcx),%edx
+  801119:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.read.req_n = n;
+  80111b:	4c 89 60 08          	mov    %r12,0x8(%rax)
+    ssize_t res = fsipc(FSREQ_READ, NULL);
+  80111f:	be 00 00 00 00       	mov    $0x0,%esi
+  801124:	bf 03 00 00 00       	mov    $0x3,%edi
+  801129:	48 b8 ef 0d 80 00 00 	movabs $0x800def,%rax
+  801130:	00 00 00 
+  801133:	ff d0                	call   *%rax
+  801135:	4c 63 e8             	movslq %eax,%r13
+    if (res < 0)
+  801138:	4d 85 ed             	test   %r13,%r13
+  80113b:	78 2c                	js     801169 <devfile_read+0x100>
+    memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  80113d:	4c 89 ea             	mov    %r13,%rdx
+  801140:	48 be 00 60 80 00 00 	movabs $0x806000,%rsi
+  801147:	00 00 00 
+  80114a:	4c 89 f7             	mov    %r14,%rdi
+  80114d:	48 b8 ed 28 80 00 00 	movabs $0x8028ed,%rax
+  801154:	00 00 00 
+  801157:	ff d0                	call   *%rax
+    readsz += res;
+  801159:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80115d:	49 01 c5             	add    %rax,%r13
+    return readsz;
+  801160:	eb 07                	jmp    801169 <devfile_read+0x100>
+            return readsz + res;
+  801162:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  801166:	49 01 c5             	add    %rax,%r13
+}
+  801169:	4c 89 e8             	mov    %r13,%rax
+  80116c:	48 83 c4 18          	add    $0x18,%rsp
+  801170:	5b                   	pop    %rbx
+  801171:	41 5c                	pop    %r12
+  801173:	41 5d                	pop    %r13
+  801175:	41 5e                	pop    %r14
+  801177:	41 5f                	pop    %r15
+  801179:	5d                   	pop    %rbp
+  80117a:	c3                   	ret
+    ssize_t readsz = 0;
+  80117b:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  801182:	00 
+  801183:	eb 83                	jmp    801108 <devfile_read+0x9f>
+
+0000000000801185 <open>:
+open(const char *path, int mode) {
+  801185:	55                   	push   %rbp
+  801186:	48 89 e5             	mov    %rsp,%rbp
+  801189:	41 55                	push   %r13
+  80118b:	41 54                	push   %r12
+  80118d:	53                   	push   %rbx
+  80118e:	48 83 ec 18          	sub    $0x18,%rsp
+  801192:	49 89 fc             	mov    %rdi,%r12
+  801195:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  801198:	48 b8 4e 26 80 00 00 	movabs $0x80264e,%rax
+  80119f:	00 00 00 
+  8011a2:	ff d0                	call   *%rax
+  8011a4:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  8011aa:	0f 87 8a 00 00 00    	ja     80123a <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8011b0:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  8011b4:	48 b8 68 07 80 00 00 	movabs $0x800768,%rax
+  8011bb:	00 00 00 
+  8011be:	ff d0                	call   *%rax
+  8011c0:	89 c3                	mov    %eax,%ebx
+  8011c2:	85 c0                	test   %eax,%eax
+  8011c4:	78 50                	js     801216 <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  8011c6:	4c 89 e6             	mov    %r12,%rsi
+  8011c9:	48 bb 00 60 80 00 00 	movabs $0x806000,%rbx
+  8011d0:	00 00 00 
+  8011d3:	48 89 df             	mov    %rbx,%rdi
+  8011d6:	48 b8 8c 26 80 00 00 	movabs $0x80268c,%rax
+  8011dd:	00 00 00 
+  8011e0:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  8011e2:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  8011e9:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8011ed:	bf 01 00 00 00       	mov    $0x1,%edi
+  8011f2:	48 b8 ef 0d 80 00 00 	movabs $0x800def,%rax
+  8011f9:	00 00 00 
+  8011fc:	ff d0                	call   *%rax
+  8011fe:	89 c3                	mov    %eax,%ebx
+  801200:	85 c0                	test   %eax,%eax
+  801202:	78 1f                	js     801223 <open+0x9e>
+    return fd2num(fd);
+  801204:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  801208:	48 b8 c1 06 80 00 00 	movabs $0x8006c1,%rax
+  80120f:	00 00 00 
+  801212:	ff d0                	call   *%rax
+  801214:	89 c3                	mov    %eax,%ebx
+}
+  801216:	89 d8                	mov    %ebx,%eax
+  801218:	48 83 c4 18          	add    $0x18,%rsp
+  80121c:	5b                   	pop    %rbx
+  80121d:	41 5c                	pop    %r12
+  80121f:	41 5d                	pop    %r13
+  801221:	5d                   	pop    %rbp
+  801222:	c3                   	ret
+        fd_close(fd, 0);
+  801223:	be 00 00 00 00       	mov    $0x0,%esi
+  801228:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80122c:	48 b8 3d 08 80 00 00 	movabs $0x80083d,%rax
+  801233:	00 00 00 
+  801236:	ff d0                	call   *%rax
+        return res;
+  801238:	eb dc                	jmp    801216 <open+0x91>
+        return -E_BAD_PATH;
+  80123a:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  80123f:	eb d5                	jmp    801216 <open+0x91>
+
+0000000000801241 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  801241:	55                   	push   %rbp
+  801242:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc(FSREQ_SYNC, NULL);
+  801245:	be 00 00 00 00       	mov    $0x0,%esi
+  80124a:	bf 08 00 00 00       	mov    $0x8,%edi
+  80124f:	48 b8 ef 0d 80 00 00 	movabs $0x800def,%rax
+  801256:	00 00 00 
+  801259:	ff d0                	call   *%rax
+}
+  80125b:	5d                   	pop    %rbp
+  80125c:	c3                   	ret
+
+000000000080125d <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  80125d:	55                   	push   %rbp
+  80125e:	48 89 e5             	mov    %rsp,%rbp
+  801261:	41 54                	push   %r12
+  801263:	53                   	push   %rbx
+  801264:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  801267:	48 b8 d3 06 80 00 00 	movabs $0x8006d3,%rax
+  80126e:	00 00 00 
+  801271:	ff d0                	call   *%rax
+  801273:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  801276:	48 be 60 2d 80 00 00 	movabs $0x802d60,%rsi
+  80127d:	00 00 00 
+  801280:	48 89 df             	mov    %rbx,%rdi
+  801283:	48 b8 8c 26 80 00 00 	movabs $0x80268c,%rax
+  80128a:	00 00 00 
+  80128d:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  80128f:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  801294:	41 2b 04 24          	sub    (%r12),%eax
+  801298:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  80129e:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8012a5:	00 00 00 
+    stat->st_dev = &devpipe;
+  8012a8:	48 b8 60 40 80 00 00 	movabs $0x804060,%rax
+  8012af:	00 00 00 
+  8012b2:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  8012b9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012be:	5b                   	pop    %rbx
+  8012bf:	41 5c                	pop    %r12
+  8012c1:	5d                   	pop    %rbp
+  8012c2:	c3                   	ret
+
+00000000008012c3 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  8012c3:	55                   	push   %rbp
+  8012c4:	48 89 e5             	mov    %rsp,%rbp
+  8012c7:	41 54                	push   %r12
+  8012c9:	53                   	push   %rbx
+  8012ca:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8012cd:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8012d2:	48 89 fe             	mov    %rdi,%rsi
+  8012d5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8012da:	49 bc 52 03 80 00 00 	movabs $0x800352,%r12
+  8012e1:	00 00 00 
+  8012e4:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  8012e7:	48 89 df             	mov    %rbx,%rdi
+  8012ea:	48 b8 d3 06 80 00 00 	movabs $0x8006d3,%rax
+  8012f1:	00 00 00 
+  8012f4:	ff d0                	call   *%rax
+  8012f6:	48 89 c6             	mov    %rax,%rsi
+  8012f9:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8012fe:	bf 00 00 00 00       	mov    $0x0,%edi
+  801303:	41 ff d4             	call   *%r12
+}
+  801306:	5b                   	pop    %rbx
+  801307:	41 5c                	pop    %r12
+  801309:	5d                   	pop    %rbp
+  80130a:	c3                   	ret
+
+000000000080130b <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  80130b:	55                   	push   %rbp
+  80130c:	48 89 e5             	mov    %rsp,%rbp
+  80130f:	41 57                	push   %r15
+  801311:	41 56                	push   %r14
+  801313:	41 55                	push   %r13
+  801315:	41 54                	push   %r12
+  801317:	53                   	push   %rbx
+  801318:	48 83 ec 18          	sub    $0x18,%rsp
+  80131c:	49 89 fc             	mov    %rdi,%r12
+  80131f:	49 89 f5             	mov    %rsi,%r13
+  801322:	49 89 d7             	mov    %rdx,%r15
+  801325:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  801329:	48 b8 d3 06 80 00 00 	movabs $0x8006d3,%rax
+  801330:	00 00 00 
+  801333:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  801335:	4d 85 ff             	test   %r15,%r15
+  801338:	0f 84 af 00 00 00    	je     8013ed <devpipe_write+0xe2>
+  80133e:	48 89 c3             	mov    %rax,%rbx
+  801341:	4c 89 f8             	mov    %r15,%rax
+  801344:	4d 89 ef             	mov    %r13,%r15
+  801347:	4c 01 e8             	add    %r13,%rax
+  80134a:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80134e:	49 bd 5a 02 80 00 00 	movabs $0x80025a,%r13
+  801355:	00 00 00 
+            sys_yield();
+  801358:	49 be f7 01 80 00 00 	movabs $0x8001f7,%r14
+  80135f:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  801362:	8b 73 04             	mov    0x4(%rbx),%esi
+  801365:	48 63 ce             	movslq %esi,%rcx
+  801368:	48 63 03             	movslq (%rbx),%rax
+  80136b:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  801371:	48 39 c1             	cmp    %rax,%rcx
+  801374:	72 2e                	jb     8013a4 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  801376:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80137b:	48 89 da             	mov    %rbx,%rdx
+  80137e:	be 00 10 00 00       	mov    $0x1000,%esi
+  801383:	4c 89 e7             	mov    %r12,%rdi
+  801386:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  801389:	85 c0                	test   %eax,%eax
+  80138b:	74 66                	je     8013f3 <devpipe_write+0xe8>
+            sys_yield();
+  80138d:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  801390:	8b 73 04             	mov    0x4(%rbx),%esi
+  801393:	48 63 ce             	movslq %esi,%rcx
+  801396:	48 63 03             	movslq (%rbx),%rax
+  801399:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  80139f:	48 39 c1             	cmp    %rax,%rcx
+  8013a2:	73 d2                	jae    801376 <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8013a4:	41 0f b6 3f          	movzbl (%r15),%edi
+  8013a8:	48 89 ca             	mov    %rcx,%rdx
+  8013ab:	48 c1 ea 03          	shr    $0x3,%rdx
+  8013af:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  8013b6:	08 10 20 
+  8013b9:	48 f7 e2             	mul    %rdx
+  8013bc:	48 c1 ea 06          	shr    $0x6,%rdx
+  8013c0:	48 89 d0             	mov    %rdx,%rax
+  8013c3:	48 c1 e0 09          	shl    $0x9,%rax
+  8013c7:	48 29 d0             	sub    %rdx,%rax
+  8013ca:	48 c1 e0 03          	shl    $0x3,%rax
+  8013ce:	48 29 c1             	sub    %rax,%rcx
+  8013d1:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  8013d6:	83 c6 01             	add    $0x1,%esi
+  8013d9:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8013dc:	49 83 c7 01          	add    $0x1,%r15
+  8013e0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8013e4:	49 39 c7             	cmp    %rax,%r15
+  8013e7:	0f 85 75 ff ff ff    	jne    801362 <devpipe_write+0x57>
+    return n;
+  8013ed:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8013f1:	eb 05                	jmp    8013f8 <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  8013f3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8013f8:	48 83 c4 18          	add    $0x18,%rsp
+  8013fc:	5b                   	pop    %rbx
+  8013fd:	41 5c                	pop    %r12
+  8013ff:	41 5d                	pop    %r13
+  801401:	41 5e                	pop    %r14
+  801403:	41 5f                	pop    %r15
+  801405:	5d                   	pop    %rbp
+  801406:	c3                   	ret
+
+0000000000801407 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  801407:	55                   	push   %rbp
+  801408:	48 89 e5             	mov    %rsp,%rbp
+  80140b:	41 57                	push   %r15
+  80140d:	41 56                	push   %r14
+  80140f:	41 55                	push   %r13
+  801411:	41 54                	push   %r12
+  801413:	53                   	push   %rbx
+  801414:	48 83 ec 18          	sub    $0x18,%rsp
+  801418:	49 89 fc             	mov    %rdi,%r12
+  80141b:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  80141f:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  801423:	48 b8 d3 06 80 00 00 	movabs $0x8006d3,%rax
+  80142a:	00 00 00 
+  80142d:	ff d0                	call   *%rax
+  80142f:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  801432:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  801438:	49 bd 5a 02 80 00 00 	movabs $0x80025a,%r13
+  80143f:	00 00 00 
+            sys_yield();
+  801442:	49 be f7 01 80 00 00 	movabs $0x8001f7,%r14
+  801449:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  80144c:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  801451:	74 7d                	je     8014d0 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  801453:	8b 03                	mov    (%rbx),%eax
+  801455:	3b 43 04             	cmp    0x4(%rbx),%eax
+  801458:	75 26                	jne    801480 <devpipe_read+0x79>
+            if (i > 0) return i;
+  80145a:	4d 85 ff             	test   %r15,%r15
+  80145d:	75 77                	jne    8014d6 <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80145f:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  801464:	48 89 da             	mov    %rbx,%rdx
+  801467:	be 00 10 00 00       	mov    $0x1000,%esi
+  80146c:	4c 89 e7             	mov    %r12,%rdi
+  80146f:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  801472:	85 c0                	test   %eax,%eax
+  801474:	74 72                	je     8014e8 <devpipe_read+0xe1>
+            sys_yield();
+  801476:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  801479:	8b 03                	mov    (%rbx),%eax
+  80147b:	3b 43 04             	cmp    0x4(%rbx),%eax
+  80147e:	74 df                	je     80145f <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  801480:	48 63 c8             	movslq %eax,%rcx
+  801483:	48 89 ca             	mov    %rcx,%rdx
+  801486:	48 c1 ea 03          	shr    $0x3,%rdx
+  80148a:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  801491:	08 10 20 
+  801494:	48 89 d0             	mov    %rdx,%rax
+  801497:	48 f7 e6             	mul    %rsi
+  80149a:	48 c1 ea 06          	shr    $0x6,%rdx
+  80149e:	48 89 d0             	mov    %rdx,%rax
+  8014a1:	48 c1 e0 09          	shl    $0x9,%rax
+  8014a5:	48 29 d0             	sub    %rdx,%rax
+  8014a8:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  8014af:	00 
+  8014b0:	48 89 c8             	mov    %rcx,%rax
+  8014b3:	48 29 d0             	sub    %rdx,%rax
+  8014b6:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  8014bb:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8014bf:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  8014c3:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8014c6:	49 83 c7 01          	add    $0x1,%r15
+  8014ca:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  8014ce:	75 83                	jne    801453 <devpipe_read+0x4c>
+    return n;
+  8014d0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8014d4:	eb 03                	jmp    8014d9 <devpipe_read+0xd2>
+            if (i > 0) return i;
+  8014d6:	4c 89 f8             	mov    %r15,%rax
+}
+  8014d9:	48 83 c4 18          	add    $0x18,%rsp
+  8014dd:	5b                   	pop    %rbx
+  8014de:	41 5c                	pop    %r12
+  8014e0:	41 5d                	pop    %r13
+  8014e2:	41 5e                	pop    %r14
+  8014e4:	41 5f                	pop    %r15
+  8014e6:	5d                   	pop    %rbp
+  8014e7:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  8014e8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014ed:	eb ea                	jmp    8014d9 <devpipe_read+0xd2>
+
+00000000008014ef <pipe>:
+pipe(int pfd[2]) {
+  8014ef:	55                   	push   %rbp
+  8014f0:	48 89 e5             	mov    %rsp,%rbp
+  8014f3:	41 55                	push   %r13
+  8014f5:	41 54                	push   %r12
+  8014f7:	53                   	push   %rbx
+  8014f8:	48 81 ec b8 00 00 00 	sub    $0xb8,%rsp
+  8014ff:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  801502:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  801506:	48 b8 68 07 80 00 00 	movabs $0x800768,%rax
+  80150d:	00 00 00 
+  801510:	ff d0                	call   *%rax
+  801512:	89 c3                	mov    %eax,%ebx
+  801514:	85 c0                	test   %eax,%eax
+  801516:	0f 88 51 01 00 00    	js     80166d <pipe+0x17e>
+        (res = fd_alloc_from(fd2num(fd0) + 1, &fd1)) < 0) goto err;
+  80151c:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  801520:	48 b8 c1 06 80 00 00 	movabs $0x8006c1,%rax
+  801527:	00 00 00 
+  80152a:	ff d0                	call   *%rax
+  80152c:	8d 78 01             	lea    0x1(%rax),%edi
+  80152f:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801533:	48 b8 ef 06 80 00 00 	movabs $0x8006ef,%rax
+  80153a:	00 00 00 
+  80153d:	ff d0                	call   *%rax
+  80153f:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  801541:	85 c0                	test   %eax,%eax
+  801543:	0f 88 24 01 00 00    	js     80166d <pipe+0x17e>
+    va = fd2data(fd0);
+  801549:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80154d:	48 bb d3 06 80 00 00 	movabs $0x8006d3,%rbx
+  801554:	00 00 00 
+  801557:	ff d3                	call   *%rbx
+  801559:	49 89 c5             	mov    %rax,%r13
+    struct RegionOp ops[] = {
+  80155c:	48 8d bd 30 ff ff ff 	lea    -0xd0(%rbp),%rdi
+  801563:	b9 14 00 00 00       	mov    $0x14,%ecx
+  801568:	b8 00 00 00 00       	mov    $0x0,%eax
+  80156d:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+  801570:	c7 85 34 ff ff ff 46 	movl   $0x46,-0xcc(%rbp)
+  801577:	00 00 00 
+  80157a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80157e:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+  801585:	48 c7 85 50 ff ff ff 	movq   $0x1000,-0xb0(%rbp)
+  80158c:	00 10 00 00 
+  801590:	c7 85 5c ff ff ff 46 	movl   $0x46,-0xa4(%rbp)
+  801597:	00 00 00 
+            {.type = REGION_ALLOC, .dstva = (uintptr_t)fd1, .size = PAGE_SIZE, .perm = PROT_RW | PROT_SHARE},
+  80159a:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+    struct RegionOp ops[] = {
+  80159e:	48 89 bd 70 ff ff ff 	mov    %rdi,-0x90(%rbp)
+  8015a5:	48 c7 85 78 ff ff ff 	movq   $0x1000,-0x88(%rbp)
+  8015ac:	00 10 00 00 
+  8015b0:	c7 45 84 46 00 00 00 	movl   $0x46,-0x7c(%rbp)
+  8015b7:	4c 89 6d 98          	mov    %r13,-0x68(%rbp)
+  8015bb:	48 c7 45 a0 00 10 00 	movq   $0x1000,-0x60(%rbp)
+  8015c2:	00 
+  8015c3:	c7 45 a8 01 00 00 00 	movl   $0x1,-0x58(%rbp)
+  8015ca:	c7 45 ac 46 00 00 00 	movl   $0x46,-0x54(%rbp)
+  8015d1:	4c 89 6d b8          	mov    %r13,-0x48(%rbp)
+            {.type = REGION_MAP, .srcva = (uintptr_t)va, .dstva = (uintptr_t)fd2data(fd1), .size = PAGE_SIZE, .perm = PROT_RW | PROT_SHARE},
+  8015d5:	ff d3                	call   *%rbx
+    struct RegionOp ops[] = {
+  8015d7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8015db:	48 c7 45 c8 00 10 00 	movq   $0x1000,-0x38(%rbp)
+  8015e2:	00 
+    if ((res = sys_region_batch(ops, sizeof ops / sizeof *ops)) < 0) goto err1;
+  8015e3:	be 04 00 00 00       	mov    $0x4,%esi
+  8015e8:	48 8d bd 30 ff ff ff 	lea    -0xd0(%rbp),%rdi
+  8015ef:	48 b8 b9 03 80 00 00 	movabs $0x8003b9,%rax
+  8015f6:	00 00 00 
+  8015f9:	ff d0                	call   *%rax
+  8015fb:	89 c3                	mov    %eax,%ebx
+  8015fd:	85 c0                	test   %eax,%eax
+  8015ff:	0f 88 ad 00 00 00    	js     8016b2 <pipe+0x1c3>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  801605:	be 00 10 00 00       	mov    $0x1000,%esi
+  80160a:	4c 89 ef             	mov    %r13,%rdi
+  80160d:	48 b8 28 02 80 00 00 	movabs $0x800228,%rax
+  801614:	00 00 00 
+  801617:	ff d0                	call   *%rax
+  801619:	83 f8 02             	cmp    $0x2,%eax
+  80161c:	75 5f                	jne    80167d <pipe+0x18e>
+    fd0->fd_dev_id = devpipe.dev_id;
+  80161e:	a1 60 40 80 00 00 00 	movabs 0x804060,%eax
+  801625:	00 00 
+  801627:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80162b:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  80162d:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801631:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  801638:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  80163c:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  80163e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801642:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  801649:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80164d:	48 bb c1 06 80 00 00 	movabs $0x8006c1,%rbx
+  801654:	00 00 00 
+  801657:	ff d3                	call   *%rbx
+  801659:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  80165d:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  801661:	ff d3                	call   *%rbx
+  801663:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  801668:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  80166d:	89 d8                	mov    %ebx,%eax
+  80166f:	48 81 c4 b8 00 00 00 	add    $0xb8,%rsp
+  801676:	5b                   	pop    %rbx
+  801677:	41 5c                	pop    %r12
+  801679:	41 5d                	pop    %r13
+  80167b:	5d                   	pop    %rbp
+  80167c:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  80167d:	48 b9 90 2d 80 00 00 	movabs $0x802d90,%rcx
+  801684:	00 00 00 
+  801687:	48 ba 67 2d 80 00 00 	movabs $0x802d67,%rdx
+  80168e:	00 00 00 
+  801691:	be 33 00 00 00       	mov    $0x33,%esi
+  801696:	48 bf 7c 2d 80 00 00 	movabs $0x802d7c,%rdi
+  80169d:	00 00 00 
+  8016a0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016a5:	49 b8 17 1c 80 00 00 	movabs $0x801c17,%r8
+  8016ac:	00 00 00 
+  8016af:	41 ff d0             	call   *%r8
+        ops[i].type = REGION_UNMAP;
+  8016b2:	c7 85 30 ff ff ff 02 	movl   $0x2,-0xd0(%rbp)
+  8016b9:	00 00 00 
+  8016bc:	c7 85 58 ff ff ff 02 	movl   $0x2,-0xa8(%rbp)
+  8016c3:	00 00 00 
+  8016c6:	c7 45 80 02 00 00 00 	movl   $0x2,-0x80(%rbp)
+  8016cd:	c7 45 a8 02 00 00 00 	movl   $0x2,-0x58(%rbp)
+    sys_region_batch(ops, sizeof ops / sizeof *ops);
+  8016d4:	be 04 00 00 00       	mov    $0x4,%esi
+  8016d9:	48 8d bd 30 ff ff ff 	lea    -0xd0(%rbp),%rdi
+  8016e0:	48 b8 b9 03 80 00 00 	movabs $0x8003b9,%rax
+  8016e7:	00 00 00 
+  8016ea:	ff d0                	call   *%rax
+  8016ec:	e9 7c ff ff ff       	jmp    80166d <pipe+0x17e>
+
+00000000008016f1 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  8016f1:	55                   	push   %rbp
+  8016f2:	48 89 e5             	mov    %rsp,%rbp
+  8016f5:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8016f9:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8016fd:	48 b8 82 07 80 00 00 	movabs $0x800782,%rax
+  801704:	00 00 00 
+  801707:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801709:	85 c0                	test   %eax,%eax
+  80170b:	78 35                	js     801742 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  80170d:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801711:	48 b8 d3 06 80 00 00 	movabs $0x8006d3,%rax
+  801718:	00 00 00 
+  80171b:	ff d0                	call   *%rax
+  80171d:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  801720:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  801725:	be 00 10 00 00       	mov    $0x1000,%esi
+  80172a:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80172e:	48 b8 5a 02 80 00 00 	movabs $0x80025a,%rax
+  801735:	00 00 00 
+  801738:	ff d0                	call   *%rax
+  80173a:	85 c0                	test   %eax,%eax
+  80173c:	0f 94 c0             	sete   %al
+  80173f:	0f b6 c0             	movzbl %al,%eax
+}
+  801742:	c9                   	leave
+  801743:	c3                   	ret
+
+0000000000801744 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  801744:	48 89 f8             	mov    %rdi,%rax
+  801747:	48 c1 e8 27          	shr    $0x27,%rax
+  80174b:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  801752:	01 00 00 
+  801755:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  801759:	f6 c2 01             	test   $0x1,%dl
+  80175c:	74 6d                	je     8017cb <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  80175e:	48 89 f8             	mov    %rdi,%rax
+  801761:	48 c1 e8 1e          	shr    $0x1e,%rax
+  801765:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  80176c:	01 00 00 
+  80176f:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  801773:	f6 c2 01             	test   $0x1,%dl
+  801776:	74 62                	je     8017da <get_uvpt_entry+0x96>
+  801778:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  80177f:	01 00 00 
+  801782:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  801786:	f6 c2 80             	test   $0x80,%dl
+  801789:	75 4f                	jne    8017da <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  80178b:	48 89 f8             	mov    %rdi,%rax
+  80178e:	48 c1 e8 15          	shr    $0x15,%rax
+  801792:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  801799:	01 00 00 
+  80179c:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8017a0:	f6 c2 01             	test   $0x1,%dl
+  8017a3:	74 44                	je     8017e9 <get_uvpt_entry+0xa5>
+  8017a5:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8017ac:	01 00 00 
+  8017af:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8017b3:	f6 c2 80             	test   $0x80,%dl
+  8017b6:	75 31                	jne    8017e9 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  8017b8:	48 c1 ef 0c          	shr    $0xc,%rdi
+  8017bc:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8017c3:	01 00 00 
+  8017c6:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  8017ca:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8017cb:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  8017d2:	01 00 00 
+  8017d5:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8017d9:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8017da:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8017e1:	01 00 00 
+  8017e4:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8017e8:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8017e9:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8017f0:	01 00 00 
+  8017f3:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8017f7:	c3                   	ret
+
+00000000008017f8 <get_prot>:
+
+int
+get_prot(void *va) {
+  8017f8:	55                   	push   %rbp
+  8017f9:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8017fc:	48 b8 44 17 80 00 00 	movabs $0x801744,%rax
+  801803:	00 00 00 
+  801806:	ff d0                	call   *%rax
+  801808:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  80180b:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  801810:	89 c1                	mov    %eax,%ecx
+  801812:	83 c9 04             	or     $0x4,%ecx
+  801815:	f6 c2 01             	test   $0x1,%dl
+  801818:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  80181b:	89 c1                	mov    %eax,%ecx
+  80181d:	83 c9 02             	or     $0x2,%ecx
+  801820:	f6 c2 02             	test   $0x2,%dl
+  801823:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  801826:	89 c1                	mov    %eax,%ecx
+  801828:	83 c9 01             	or     $0x1,%ecx
+  80182b:	48 85 d2             	test   %rdx,%rdx
+  80182e:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  801831:	89 c1                	mov    %eax,%ecx
+  801833:	83 c9 40             	or     $0x40,%ecx
+  801836:	f6 c6 04             	test   $0x4,%dh
+  801839:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  80183c:	5d                   	pop    %rbp
+  80183d:	c3                   	ret
+
+000000000080183e <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  80183e:	55                   	push   %rbp
+  80183f:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  801842:	48 b8 44 17 80 00 00 	movabs $0x801744,%rax
+  801849:	00 00 00 
+  80184c:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  80184e:	48 c1 e8 06          	shr    $0x6,%rax
+  801852:	83 e0 01             	and    $0x1,%eax
+}
+  801855:	5d                   	pop    %rbp
+  801856:	c3                   	ret
+
+0000000000801857 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  801857:	55                   	push   %rbp
+  801858:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  80185b:	48 b8 44 17 80 00 00 	movabs $0x801744,%rax
+  801862:	00 00 00 
+  801865:	ff d0                	call   *%rax
+  801867:	83 e0 01             	and    $0x1,%eax
+}
+  80186a:	5d                   	pop    %rbp
+  80186b:	c3                   	ret
+
+000000000080186c <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  80186c:	55                   	push   %rbp
+  80186d:	48 89 e5             	mov    %rsp,%rbp
+  801870:	41 57                	push   %r15
+  801872:	41 56                	push   %r14
+  801874:	41 55                	push   %r13
+  801876:	41 54                	push   %r12
+  801878:	53                   	push   %rbx
+  801879:	48 83 ec 38          	sub    $0x38,%rsp
+  80187d:	49 89 f7             	mov    %rsi,%r15
+  801880:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+                    }
+                    continue;
+                }
+                for (int ptei = 0; ptei < PT_ENTRY_COUNT; ptei++) {
+                    uintptr_t pte_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, pdei, ptei, 0);
+                    pte_t pte = uvpt[VPT(pte_addr)];
+  801886:	49 bd 00 00 00 00 00 	movabs $0x10000000000,%r13
+  80188d:	01 00 00 
+  801890:	4d 89 e6             	mov    %r12,%r14
+  801893:	49 89 fc             	mov    %rdi,%r12
+  801896:	e9 19 01 00 00       	jmp    8019b4 <foreach_shared_region+0x148>
+  80189b:	48 89 5d b0          	mov    %rbx,-0x50(%rbp)
+  80189f:	4c 89 75 a8          	mov    %r14,-0x58(%rbp)
+  8018a3:	eb 52                	jmp    8018f7 <foreach_shared_region+0x8b>
+                for (int ptei = 0; ptei < PT_ENTRY_COUNT; ptei++) {
+  8018a5:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8018ac:	48 81 fb 00 00 20 00 	cmp    $0x200000,%rbx
+  8018b3:	74 2e                	je     8018e3 <foreach_shared_region+0x77>
+                    uintptr_t pte_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, pdei, ptei, 0);
+  8018b5:	48 89 df             	mov    %rbx,%rdi
+  8018b8:	4c 09 f7             	or     %r14,%rdi
+                    pte_t pte = uvpt[VPT(pte_addr)];
+  8018bb:	48 89 f8             	mov    %rdi,%rax
+  8018be:	48 c1 e8 0c          	shr    $0xc,%rax
+  8018c2:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+                    if ((pte & PTE_P) && (pte & PTE_SHARE)) {
+  8018c7:	25 01 04 00 00       	and    $0x401,%eax
+  8018cc:	48 3d 01 04 00 00    	cmp    $0x401,%rax
+  8018d2:	75 d1                	jne    8018a5 <foreach_shared_region+0x39>
+                        fun((void*)pte_addr, (void*)(pte_addr + PAGE_SIZE), arg);
+  8018d4:	48 8d b7 00 10 00 00 	lea    0x1000(%rdi),%rsi
+  8018db:	4c 89 fa             	mov    %r15,%rdx
+  8018de:	41 ff d4             	call   *%r12
+  8018e1:	eb c2                	jmp    8018a5 <foreach_shared_region+0x39>
+            for (int pdei = 0; pdei < PD_ENTRY_COUNT; pdei++) {
+  8018e3:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  8018ea:	00 
+  8018eb:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8018ef:	48 3d 00 00 00 40    	cmp    $0x40000000,%rax
+  8018f5:	74 46                	je     80193d <foreach_shared_region+0xd1>
+                uintptr_t pde_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, pdei, 0, 0);
+  8018f7:	4c 8b 75 c8          	mov    -0x38(%rbp),%r14
+  8018fb:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8018ff:	49 09 c6             	or     %rax,%r14
+                pde_t pde = uvpd[VPD(pde_addr)];
+  801902:	4c 89 f0             	mov    %r14,%rax
+  801905:	48 c1 e8 15          	shr    $0x15,%rax
+  801909:	48 b9 00 00 00 80 00 	movabs $0x10080000000,%rcx
+  801910:	01 00 00 
+  801913:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+                if (!(pde & PTE_P)) {
+  801917:	a8 01                	test   $0x1,%al
+  801919:	74 c8                	je     8018e3 <foreach_shared_region+0x77>
+                if (pde & PTE_PS) {
+  80191b:	48 89 c3             	mov    %rax,%rbx
+  80191e:	81 e3 80 00 00 00    	and    $0x80,%ebx
+  801924:	74 8f                	je     8018b5 <foreach_shared_region+0x49>
+                    if (pde & PTE_SHARE) {
+  801926:	f6 c4 04             	test   $0x4,%ah
+  801929:	74 b8                	je     8018e3 <foreach_shared_region+0x77>
+                        fun((void*)pde_addr, (void*)(pde_addr + 1024 * 1024 * 2), arg);
+  80192b:	49 8d b6 00 00 20 00 	lea    0x200000(%r14),%rsi
+  801932:	4c 89 fa             	mov    %r15,%rdx
+  801935:	4c 89 f7             	mov    %r14,%rdi
+  801938:	41 ff d4             	call   *%r12
+  80193b:	eb a6                	jmp    8018e3 <foreach_shared_region+0x77>
+  80193d:	48 8b 5d b0          	mov    -0x50(%rbp),%rbx
+  801941:	4c 8b 75 a8          	mov    -0x58(%rbp),%r14
+        for (int pdpei = 0; pdpei < PDP_ENTRY_COUNT; pdpei++) {
+  801945:	48 81 c3 00 00 00 40 	add    $0x40000000,%rbx
+  80194c:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  801953:	00 00 00 
+  801956:	48 39 c3             	cmp    %rax,%rbx
+  801959:	74 4c                	je     8019a7 <foreach_shared_region+0x13b>
+            uintptr_t pdpe_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, 0, 0, 0);
+  80195b:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  80195f:	48 09 d8             	or     %rbx,%rax
+  801962:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+            pdpe_t pdpe = uvpdp[VPDP(pdpe_addr)];
+  801966:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80196a:	48 b9 00 00 40 80 00 	movabs $0x10080400000,%rcx
+  801971:	01 00 00 
+  801974:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+            if (!(pdpe & PTE_P)) {
+  801978:	a8 01                	test   $0x1,%al
+  80197a:	74 c9                	je     801945 <foreach_shared_region+0xd9>
+            if (pdpe & PTE_PS) {
+  80197c:	48 89 c1             	mov    %rax,%rcx
+  80197f:	81 e1 80 00 00 00    	and    $0x80,%ecx
+  801985:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  801989:	0f 84 0c ff ff ff    	je     80189b <foreach_shared_region+0x2f>
+                if (pdpe & PTE_SHARE) {
+  80198f:	f6 c4 04             	test   $0x4,%ah
+  801992:	74 b1                	je     801945 <foreach_shared_region+0xd9>
+                    fun((void*)pdpe_addr, (void*)(pdpe_addr + 1024 * 1024 * 1024), arg); 
+  801994:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  801998:	48 8d b7 00 00 00 40 	lea    0x40000000(%rdi),%rsi
+  80199f:	4c 89 fa             	mov    %r15,%rdx
+  8019a2:	41 ff d4             	call   *%r12
+  8019a5:	eb 9e                	jmp    801945 <foreach_shared_region+0xd9>
+    for (int pml4ei = 0; pml4ei < PML4_ENTRY_COUNT; pml4ei++) {
+  8019a7:	49 83 c6 01          	add    $0x1,%r14
+  8019ab:	49 81 fe 00 02 00 00 	cmp    $0x200,%r14
+  8019b2:	74 24                	je     8019d8 <foreach_shared_region+0x16c>
+        pml4e_t pml4e = uvpml4[VPML4(pml4_addr)];
+  8019b4:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  8019bb:	01 00 00 
+  8019be:	4a 8b 04 f0          	mov    (%rax,%r14,8),%rax
+        if (!(pml4e & PTE_P)) {
+  8019c2:	a8 01                	test   $0x1,%al
+  8019c4:	74 e1                	je     8019a7 <foreach_shared_region+0x13b>
+  8019c6:	4c 89 f0             	mov    %r14,%rax
+  8019c9:	48 c1 e0 27          	shl    $0x27,%rax
+  8019cd:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8019d1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8019d6:	eb 83                	jmp    80195b <foreach_shared_region+0xef>
+            }
+        }
+    }
+    
+    return 0;
+}
+  8019d8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019dd:	48 83 c4 38          	add    $0x38,%rsp
+  8019e1:	5b                   	pop    %rbx
+  8019e2:	41 5c                	pop    %r12
+  8019e4:	41 5d                	pop    %r13
+  8019e6:	41 5e                	pop    %r14
+  8019e8:	41 5f                	pop    %r15
+  8019ea:	5d                   	pop    %rbp
+  8019eb:	c3                   	ret
+
+00000000008019ec <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  8019ec:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019f1:	c3                   	ret
+
+00000000008019f2 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  8019f2:	55                   	push   %rbp
+  8019f3:	48 89 e5             	mov    %rsp,%rbp
+  8019f6:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  8019f9:	48 be b4 2d 80 00 00 	movabs $0x802db4,%rsi
+  801a00:	00 00 00 
+  801a03:	48 b8 8c 26 80 00 00 	movabs $0x80268c,%rax
+  801a0a:	00 00 00 
+  801a0d:	ff d0                	call   *%rax
+    return 0;
+}
+  801a0f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a14:	5d                   	pop    %rbp
+  801a15:	c3                   	ret
+
+0000000000801a16 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  801a16:	55                   	push   %rbp
+  801a17:	48 89 e5             	mov    %rsp,%rbp
+  801a1a:	41 57                	push   %r15
+  801a1c:	41 56                	push   %r14
+  801a1e:	41 55                	push   %r13
+  801a20:	41 54                	push   %r12
+  801a22:	53                   	push   %rbx
+  801a23:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  801a2a:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  801a31:	48 85 d2             	test   %rdx,%rdx
+  801a34:	74 7a                	je     801ab0 <devcons_write+0x9a>
+  801a36:	49 89 d6             	mov    %rdx,%r14
+  801a39:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  801a3f:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  801a44:	49 bf 86 28 80 00 00 	movabs $0x802886,%r15
+  801a4b:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  801a4e:	4c 89 f3             	mov    %r14,%rbx
+  801a51:	48 29 f3             	sub    %rsi,%rbx
+  801a54:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  801a59:	48 39 c3             	cmp    %rax,%rbx
+  801a5c:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  801a60:	4c 63 eb             	movslq %ebx,%r13
+  801a63:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  801a6a:	48 01 c6             	add    %rax,%rsi
+  801a6d:	4c 89 ea             	mov    %r13,%rdx
+  801a70:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  801a77:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  801a7a:	4c 89 ee             	mov    %r13,%rsi
+  801a7d:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  801a84:	48 b8 fd 00 80 00 00 	movabs $0x8000fd,%rax
+  801a8b:	00 00 00 
+  801a8e:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  801a90:	41 01 dc             	add    %ebx,%r12d
+  801a93:	49 63 f4             	movslq %r12d,%rsi
+  801a96:	4c 39 f6             	cmp    %r14,%rsi
+  801a99:	72 b3                	jb     801a4e <devcons_write+0x38>
+    return res;
+  801a9b:	49 63 c4             	movslq %r12d,%rax
+}
+  801a9e:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  801aa5:	5b                   	pop    %rbx
+  801aa6:	41 5c                	pop    %r12
+  801aa8:	41 5d                	pop    %r13
+  801aaa:	41 5e                	pop    %r14
+  801aac:	41 5f                	pop    %r15
+  801aae:	5d                   	pop    %rbp
+  801aaf:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  801ab0:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  801ab6:	eb e3                	jmp    801a9b <devcons_write+0x85>
+
+0000000000801ab8 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  801ab8:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  801abb:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ac0:	48 85 c0             	test   %rax,%rax
+  801ac3:	74 55                	je     801b1a <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  801ac5:	55                   	push   %rbp
+  801ac6:	48 89 e5             	mov    %rsp,%rbp
+  801ac9:	41 55                	push   %r13
+  801acb:	41 54                	push   %r12
+  801acd:	53                   	push   %rbx
+  801ace:	48 83 ec 08          	sub    $0x8,%rsp
+  801ad2:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  801ad5:	48 bb 2a 01 80 00 00 	movabs $0x80012a,%rbx
+  801adc:	00 00 00 
+  801adf:	49 bc f7 01 80 00 00 	movabs $0x8001f7,%r12
+  801ae6:	00 00 00 
+  801ae9:	eb 03                	jmp    801aee <devcons_read+0x36>
+  801aeb:	41 ff d4             	call   *%r12
+  801aee:	ff d3                	call   *%rbx
+  801af0:	85 c0                	test   %eax,%eax
+  801af2:	74 f7                	je     801aeb <devcons_read+0x33>
+    if (c < 0) return c;
+  801af4:	48 63 d0             	movslq %eax,%rdx
+  801af7:	78 13                	js     801b0c <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  801af9:	ba 00 00 00 00       	mov    $0x0,%edx
+  801afe:	83 f8 04             	cmp    $0x4,%eax
+  801b01:	74 09                	je     801b0c <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  801b03:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  801b07:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  801b0c:	48 89 d0             	mov    %rdx,%rax
+  801b0f:	48 83 c4 08          	add    $0x8,%rsp
+  801b13:	5b                   	pop    %rbx
+  801b14:	41 5c                	pop    %r12
+  801b16:	41 5d                	pop    %r13
+  801b18:	5d                   	pop    %rbp
+  801b19:	c3                   	ret
+  801b1a:	48 89 d0             	mov    %rdx,%rax
+  801b1d:	c3                   	ret
+
+0000000000801b1e <cputchar>:
+cputchar(int ch) {
+  801b1e:	55                   	push   %rbp
+  801b1f:	48 89 e5             	mov    %rsp,%rbp
+  801b22:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  801b26:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  801b2a:	be 01 00 00 00       	mov    $0x1,%esi
+  801b2f:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  801b33:	48 b8 fd 00 80 00 00 	movabs $0x8000fd,%rax
+  801b3a:	00 00 00 
+  801b3d:	ff d0                	call   *%rax
+}
+  801b3f:	c9                   	leave
+  801b40:	c3                   	ret
+
+0000000000801b41 <getchar>:
+getchar(void) {
+  801b41:	55                   	push   %rbp
+  801b42:	48 89 e5             	mov    %rsp,%rbp
+  801b45:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  801b49:	ba 01 00 00 00       	mov    $0x1,%edx
+  801b4e:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  801b52:	bf 00 00 00 00       	mov    $0x0,%edi
+  801b57:	48 b8 65 0a 80 00 00 	movabs $0x800a65,%rax
+  801b5e:	00 00 00 
+  801b61:	ff d0                	call   *%rax
+  801b63:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  801b65:	85 c0                	test   %eax,%eax
+  801b67:	78 06                	js     801b6f <getchar+0x2e>
+  801b69:	74 08                	je     801b73 <getchar+0x32>
+  801b6b:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  801b6f:	89 d0                	mov    %edx,%eax
+  801b71:	c9                   	leave
+  801b72:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  801b73:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  801b78:	eb f5                	jmp    801b6f <getchar+0x2e>
+
+0000000000801b7a <iscons>:
+iscons(int fdnum) {
+  801b7a:	55                   	push   %rbp
+  801b7b:	48 89 e5             	mov    %rsp,%rbp
+  801b7e:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  801b82:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801b86:	48 b8 82 07 80 00 00 	movabs $0x800782,%rax
+  801b8d:	00 00 00 
+  801b90:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801b92:	85 c0                	test   %eax,%eax
+  801b94:	78 18                	js     801bae <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  801b96:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801b9a:	48 b8 a0 40 80 00 00 	movabs $0x8040a0,%rax
+  801ba1:	00 00 00 
+  801ba4:	8b 00                	mov    (%rax),%eax
+  801ba6:	39 02                	cmp    %eax,(%rdx)
+  801ba8:	0f 94 c0             	sete   %al
+  801bab:	0f b6 c0             	movzbl %al,%eax
+}
+  801bae:	c9                   	leave
+  801baf:	c3                   	ret
+
+0000000000801bb0 <opencons>:
+opencons(void) {
+  801bb0:	55                   	push   %rbp
+  801bb1:	48 89 e5             	mov    %rsp,%rbp
+  801bb4:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  801bb8:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  801bbc:	48 b8 68 07 80 00 00 	movabs $0x800768,%rax
+  801bc3:	00 00 00 
+  801bc6:	ff d0                	call   *%rax
+  801bc8:	85 c0                	test   %eax,%eax
+  801bca:	78 49                	js     801c15 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  801bcc:	b9 46 00 00 00       	mov    $0x46,%ecx
+  801bd1:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801bd6:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  801bda:	bf 00 00 00 00       	mov    $0x0,%edi
+  801bdf:	48 b8 86 02 80 00 00 	movabs $0x800286,%rax
+  801be6:	00 00 00 
+  801be9:	ff d0                	call   *%rax
+  801beb:	85 c0                	test   %eax,%eax
+  801bed:	78 26                	js     801c15 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  801bef:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801bf3:	a1 a0 40 80 00 00 00 	movabs 0x8040a0,%eax
+  801bfa:	00 00 
+  801bfc:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  801bfe:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801c02:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  801c09:	48 b8 c1 06 80 00 00 	movabs $0x8006c1,%rax
+  801c10:	00 00 00 
+  801c13:	ff d0                	call   *%rax
+}
+  801c15:	c9                   	leave
+  801c16:	c3                   	ret
+
+0000000000801c17 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  801c17:	55                   	push   %rbp
+  801c18:	48 89 e5             	mov    %rsp,%rbp
+  801c1b:	41 56                	push   %r14
+  801c1d:	41 55                	push   %r13
+  801c1f:	41 54                	push   %r12
+  801c21:	53                   	push   %rbx
+  801c22:	48 83 ec 50          	sub    $0x50,%rsp
+  801c26:	49 89 fc             	mov    %rdi,%r12
+  801c29:	41 89 f5             	mov    %esi,%r13d
+  801c2c:	48 89 d3             	mov    %rdx,%rbx
+  801c2f:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  801c33:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  801c37:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  801c3b:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  801c42:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801c46:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  801c4a:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  801c4e:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  801c52:	48 b8 00 40 80 00 00 	movabs $0x804000,%rax
+  801c59:	00 00 00 
+  801c5c:	4c 8b 30             	mov    (%rax),%r14
+  801c5f:	48 b8 c6 01 80 00 00 	movabs $0x8001c6,%rax
+  801c66:	00 00 00 
+  801c69:	ff d0                	call   *%rax
+  801c6b:	89 c6                	mov    %eax,%esi
+  801c6d:	45 89 e8             	mov    %r13d,%r8d
+  801c70:	4c 89 e1             	mov    %r12,%rcx
+  801c73:	4c 89 f2             	mov    %r14,%rdx
+  801c76:	48 bf c0 2d 80 00 00 	movabs $0x802dc0,%rdi
+  801c7d:	00 00 00 
+  801c80:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c85:	49 bc 67 1d 80 00 00 	movabs $0x801d67,%r12
+  801c8c:	00 00 00 
+  801c8f:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  801c92:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  801c96:	48 89 df             	mov    %rbx,%rdi
+  801c99:	48 b8 03 1d 80 00 00 	movabs $0x801d03,%rax
+  801ca0:	00 00 00 
+  801ca3:	ff d0                	call   *%rax
+    cprintf("\n");
+  801ca5:	48 bf 1b 2d 80 00 00 	movabs $0x802d1b,%rdi
+  801cac:	00 00 00 
+  801caf:	b8 00 00 00 00       	mov    $0x0,%eax
+  801cb4:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  801cb7:	cc                   	int3
+  801cb8:	eb fd                	jmp    801cb7 <_panic+0xa0>
+
+0000000000801cba <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  801cba:	55                   	push   %rbp
+  801cbb:	48 89 e5             	mov    %rsp,%rbp
+  801cbe:	53                   	push   %rbx
+  801cbf:	48 83 ec 08          	sub    $0x8,%rsp
+  801cc3:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  801cc6:	8b 06                	mov    (%rsi),%eax
+  801cc8:	8d 50 01             	lea    0x1(%rax),%edx
+  801ccb:	89 16                	mov    %edx,(%rsi)
+  801ccd:	48 98                	cltq
+  801ccf:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  801cd4:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  801cda:	74 0a                	je     801ce6 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  801cdc:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  801ce0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801ce4:	c9                   	leave
+  801ce5:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  801ce6:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  801cea:	be ff 00 00 00       	mov    $0xff,%esi
+  801cef:	48 b8 fd 00 80 00 00 	movabs $0x8000fd,%rax
+  801cf6:	00 00 00 
+  801cf9:	ff d0                	call   *%rax
+        state->offset = 0;
+  801cfb:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  801d01:	eb d9                	jmp    801cdc <putch+0x22>
+
+0000000000801d03 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  801d03:	55                   	push   %rbp
+  801d04:	48 89 e5             	mov    %rsp,%rbp
+  801d07:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  801d0e:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  801d11:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  801d18:	b9 21 00 00 00       	mov    $0x21,%ecx
+  801d1d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d22:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  801d25:	48 89 f1             	mov    %rsi,%rcx
+  801d28:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  801d2f:	48 bf ba 1c 80 00 00 	movabs $0x801cba,%rdi
+  801d36:	00 00 00 
+  801d39:	48 b8 b7 1e 80 00 00 	movabs $0x801eb7,%rax
+  801d40:	00 00 00 
+  801d43:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  801d45:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  801d4c:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  801d53:	48 b8 fd 00 80 00 00 	movabs $0x8000fd,%rax
+  801d5a:	00 00 00 
+  801d5d:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  801d5f:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  801d65:	c9                   	leave
+  801d66:	c3                   	ret
+
+0000000000801d67 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  801d67:	55                   	push   %rbp
+  801d68:	48 89 e5             	mov    %rsp,%rbp
+  801d6b:	48 83 ec 50          	sub    $0x50,%rsp
+  801d6f:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  801d73:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  801d77:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801d7b:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  801d7f:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  801d83:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  801d8a:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801d8e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801d92:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  801d96:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  801d9a:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  801d9e:	48 b8 03 1d 80 00 00 	movabs $0x801d03,%rax
+  801da5:	00 00 00 
+  801da8:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  801daa:	c9                   	leave
+  801dab:	c3                   	ret
+
+0000000000801dac <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  801dac:	55                   	push   %rbp
+  801dad:	48 89 e5             	mov    %rsp,%rbp
+  801db0:	41 57                	push   %r15
+  801db2:	41 56                	push   %r14
+  801db4:	41 55                	push   %r13
+  801db6:	41 54                	push   %r12
+  801db8:	53                   	push   %rbx
+  801db9:	48 83 ec 18          	sub    $0x18,%rsp
+  801dbd:	49 89 fc             	mov    %rdi,%r12
+  801dc0:	49 89 f5             	mov    %rsi,%r13
+  801dc3:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801dc7:	8b 45 10             	mov    0x10(%rbp),%eax
+  801dca:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  801dcd:	41 89 cf             	mov    %ecx,%r15d
+  801dd0:	4c 39 fa             	cmp    %r15,%rdx
+  801dd3:	73 5b                	jae    801e30 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  801dd5:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  801dd9:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  801ddd:	85 db                	test   %ebx,%ebx
+  801ddf:	7e 0e                	jle    801def <print_num+0x43>
+            putch(padc, put_arg);
+  801de1:	4c 89 ee             	mov    %r13,%rsi
+  801de4:	44 89 f7             	mov    %r14d,%edi
+  801de7:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  801dea:	83 eb 01             	sub    $0x1,%ebx
+  801ded:	75 f2                	jne    801de1 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  801def:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  801df3:	48 b9 f4 2d 80 00 00 	movabs $0x802df4,%rcx
+  801dfa:	00 00 00 
+  801dfd:	48 b8 e3 2d 80 00 00 	movabs $0x802de3,%rax
+  801e04:	00 00 00 
+  801e07:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  801e0b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801e0f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e14:	49 f7 f7             	div    %r15
+  801e17:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  801e1b:	4c 89 ee             	mov    %r13,%rsi
+  801e1e:	41 ff d4             	call   *%r12
+}
+  801e21:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  801e25:	5b                   	pop    %rbx
+  801e26:	41 5c                	pop    %r12
+  801e28:	41 5d                	pop    %r13
+  801e2a:	41 5e                	pop    %r14
+  801e2c:	41 5f                	pop    %r15
+  801e2e:	5d                   	pop    %rbp
+  801e2f:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  801e30:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801e34:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e39:	49 f7 f7             	div    %r15
+  801e3c:	48 83 ec 08          	sub    $0x8,%rsp
+  801e40:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  801e44:	52                   	push   %rdx
+  801e45:	45 0f be c9          	movsbl %r9b,%r9d
+  801e49:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  801e4d:	48 89 c2             	mov    %rax,%rdx
+  801e50:	48 b8 ac 1d 80 00 00 	movabs $0x801dac,%rax
+  801e57:	00 00 00 
+  801e5a:	ff d0                	call   *%rax
+  801e5c:	48 83 c4 10          	add    $0x10,%rsp
+  801e60:	eb 8d                	jmp    801def <print_num+0x43>
+
+0000000000801e62 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  801e62:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  801e66:	48 8b 06             	mov    (%rsi),%rax
+  801e69:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  801e6d:	73 0a                	jae    801e79 <sprintputch+0x17>
+        *state->start++ = ch;
+  801e6f:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801e73:	48 89 16             	mov    %rdx,(%rsi)
+  801e76:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  801e79:	c3                   	ret
+
+0000000000801e7a <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  801e7a:	55                   	push   %rbp
+  801e7b:	48 89 e5             	mov    %rsp,%rbp
+  801e7e:	48 83 ec 50          	sub    $0x50,%rsp
+  801e82:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801e86:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  801e8a:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  801e8e:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  801e95:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801e99:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801e9d:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  801ea1:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  801ea5:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  801ea9:	48 b8 b7 1e 80 00 00 	movabs $0x801eb7,%rax
+  801eb0:	00 00 00 
+  801eb3:	ff d0                	call   *%rax
+}
+  801eb5:	c9                   	leave
+  801eb6:	c3                   	ret
+
+0000000000801eb7 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  801eb7:	55                   	push   %rbp
+  801eb8:	48 89 e5             	mov    %rsp,%rbp
+  801ebb:	41 57                	push   %r15
+  801ebd:	41 56                	push   %r14
+  801ebf:	41 55                	push   %r13
+  801ec1:	41 54                	push   %r12
+  801ec3:	53                   	push   %rbx
+  801ec4:	48 83 ec 38          	sub    $0x38,%rsp
+  801ec8:	49 89 fe             	mov    %rdi,%r14
+  801ecb:	49 89 f5             	mov    %rsi,%r13
+  801ece:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  801ed1:	48 8b 01             	mov    (%rcx),%rax
+  801ed4:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  801ed8:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  801edc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801ee0:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  801ee4:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  801ee8:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  801eec:	0f b6 3b             	movzbl (%rbx),%edi
+  801eef:	40 80 ff 25          	cmp    $0x25,%dil
+  801ef3:	74 18                	je     801f0d <vprintfmt+0x56>
+            if (!ch) return;
+  801ef5:	40 84 ff             	test   %dil,%dil
+  801ef8:	0f 84 b1 06 00 00    	je     8025af <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  801efe:	40 0f b6 ff          	movzbl %dil,%edi
+  801f02:	4c 89 ee             	mov    %r13,%rsi
+  801f05:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  801f08:	4c 89 e3             	mov    %r12,%rbx
+  801f0b:	eb db                	jmp    801ee8 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  801f0d:	be 00 00 00 00       	mov    $0x0,%esi
+  801f12:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  801f16:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  801f1b:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  801f21:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  801f28:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  801f2c:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  801f31:	41 0f b6 04 24       	movzbl (%r12),%eax
+  801f36:	88 45 a0             	mov    %al,-0x60(%rbp)
+  801f39:	83 e8 23             	sub    $0x23,%eax
+  801f3c:	3c 57                	cmp    $0x57,%al
+  801f3e:	0f 87 51 06 00 00    	ja     802595 <vprintfmt+0x6de>
+  801f44:	0f b6 c0             	movzbl %al,%eax
+  801f47:	48 b9 a0 2f 80 00 00 	movabs $0x802fa0,%rcx
+  801f4e:	00 00 00 
+  801f51:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  801f54:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  801f57:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  801f5b:	eb cf                	jmp    801f2c <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  801f5d:	49 89 dc             	mov    %rbx,%r12
+  801f60:	be 01 00 00 00       	mov    $0x1,%esi
+  801f65:	eb c5                	jmp    801f2c <vprintfmt+0x75>
+            padc = ch;
+  801f67:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  801f6b:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  801f6e:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801f71:	eb b9                	jmp    801f2c <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  801f73:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801f76:	83 f8 2f             	cmp    $0x2f,%eax
+  801f79:	77 24                	ja     801f9f <vprintfmt+0xe8>
+  801f7b:	89 c1                	mov    %eax,%ecx
+  801f7d:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  801f81:	83 c0 08             	add    $0x8,%eax
+  801f84:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801f87:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  801f8a:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  801f8d:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  801f91:	79 99                	jns    801f2c <vprintfmt+0x75>
+                width = precision;
+  801f93:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  801f97:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  801f9d:	eb 8d                	jmp    801f2c <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  801f9f:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  801fa3:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  801fa7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801fab:	eb da                	jmp    801f87 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  801fad:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  801fb2:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  801fb6:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  801fbc:	3c 39                	cmp    $0x39,%al
+  801fbe:	77 1c                	ja     801fdc <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  801fc0:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  801fc4:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  801fc8:	0f b6 c0             	movzbl %al,%eax
+  801fcb:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  801fd0:	0f b6 03             	movzbl (%rbx),%eax
+  801fd3:	3c 39                	cmp    $0x39,%al
+  801fd5:	76 e9                	jbe    801fc0 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  801fd7:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  801fda:	eb b1                	jmp    801f8d <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  801fdc:	49 89 dc             	mov    %rbx,%r12
+  801fdf:	eb ac                	jmp    801f8d <vprintfmt+0xd6>
+            width = MAX(0, width);
+  801fe1:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  801fe4:	85 c9                	test   %ecx,%ecx
+  801fe6:	b8 00 00 00 00       	mov    $0x0,%eax
+  801feb:	0f 49 c1             	cmovns %ecx,%eax
+  801fee:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  801ff1:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801ff4:	e9 33 ff ff ff       	jmp    801f2c <vprintfmt+0x75>
+            lflag++;
+  801ff9:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  801ffc:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801fff:	e9 28 ff ff ff       	jmp    801f2c <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  802004:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802007:	83 f8 2f             	cmp    $0x2f,%eax
+  80200a:	77 19                	ja     802025 <vprintfmt+0x16e>
+  80200c:	89 c2                	mov    %eax,%edx
+  80200e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802012:	83 c0 08             	add    $0x8,%eax
+  802015:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802018:	8b 3a                	mov    (%rdx),%edi
+  80201a:	4c 89 ee             	mov    %r13,%rsi
+  80201d:	41 ff d6             	call   *%r14
+            break;
+  802020:	e9 c3 fe ff ff       	jmp    801ee8 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  802025:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802029:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80202d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802031:	eb e5                	jmp    802018 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  802033:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802036:	83 f8 2f             	cmp    $0x2f,%eax
+  802039:	77 5a                	ja     802095 <vprintfmt+0x1de>
+  80203b:	89 c2                	mov    %eax,%edx
+  80203d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802041:	83 c0 08             	add    $0x8,%eax
+  802044:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  802047:	8b 02                	mov    (%rdx),%eax
+  802049:	89 c1                	mov    %eax,%ecx
+  80204b:	f7 d9                	neg    %ecx
+  80204d:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  802050:	83 f9 15             	cmp    $0x15,%ecx
+  802053:	7f 4e                	jg     8020a3 <vprintfmt+0x1ec>
+  802055:	48 63 c1             	movslq %ecx,%rax
+  802058:	48 ba 60 32 80 00 00 	movabs $0x803260,%rdx
+  80205f:	00 00 00 
+  802062:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802066:	48 85 c0             	test   %rax,%rax
+  802069:	74 38                	je     8020a3 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  80206b:	48 89 c1             	mov    %rax,%rcx
+  80206e:	48 ba 79 2d 80 00 00 	movabs $0x802d79,%rdx
+  802075:	00 00 00 
+  802078:	4c 89 ee             	mov    %r13,%rsi
+  80207b:	4c 89 f7             	mov    %r14,%rdi
+  80207e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802083:	49 b8 7a 1e 80 00 00 	movabs $0x801e7a,%r8
+  80208a:	00 00 00 
+  80208d:	41 ff d0             	call   *%r8
+  802090:	e9 53 fe ff ff       	jmp    801ee8 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  802095:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802099:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80209d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8020a1:	eb a4                	jmp    802047 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  8020a3:	48 ba 0c 2e 80 00 00 	movabs $0x802e0c,%rdx
+  8020aa:	00 00 00 
+  8020ad:	4c 89 ee             	mov    %r13,%rsi
+  8020b0:	4c 89 f7             	mov    %r14,%rdi
+  8020b3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020b8:	49 b8 7a 1e 80 00 00 	movabs $0x801e7a,%r8
+  8020bf:	00 00 00 
+  8020c2:	41 ff d0             	call   *%r8
+  8020c5:	e9 1e fe ff ff       	jmp    801ee8 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8020ca:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8020cd:	83 f8 2f             	cmp    $0x2f,%eax
+  8020d0:	77 6c                	ja     80213e <vprintfmt+0x287>
+  8020d2:	89 c2                	mov    %eax,%edx
+  8020d4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8020d8:	83 c0 08             	add    $0x8,%eax
+  8020db:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8020de:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  8020e1:	48 85 d2             	test   %rdx,%rdx
+  8020e4:	48 b8 05 2e 80 00 00 	movabs $0x802e05,%rax
+  8020eb:	00 00 00 
+  8020ee:	48 0f 45 c2          	cmovne %rdx,%rax
+  8020f2:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  8020f6:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8020fa:	7e 06                	jle    802102 <vprintfmt+0x24b>
+  8020fc:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  802100:	75 4a                	jne    80214c <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  802102:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  802106:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  80210a:	0f b6 00             	movzbl (%rax),%eax
+  80210d:	84 c0                	test   %al,%al
+  80210f:	0f 85 9a 00 00 00    	jne    8021af <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  802115:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  802118:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  80211c:	85 c0                	test   %eax,%eax
+  80211e:	0f 8e c4 fd ff ff    	jle    801ee8 <vprintfmt+0x31>
+  802124:	4c 89 ee             	mov    %r13,%rsi
+  802127:	bf 20 00 00 00       	mov    $0x20,%edi
+  80212c:	41 ff d6             	call   *%r14
+  80212f:	41 83 ec 01          	sub    $0x1,%r12d
+  802133:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  802137:	75 eb                	jne    802124 <vprintfmt+0x26d>
+  802139:	e9 aa fd ff ff       	jmp    801ee8 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  80213e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802142:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802146:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80214a:	eb 92                	jmp    8020de <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  80214c:	49 63 f7             	movslq %r15d,%rsi
+  80214f:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  802153:	48 b8 69 26 80 00 00 	movabs $0x802669,%rax
+  80215a:	00 00 00 
+  80215d:	ff d0                	call   *%rax
+  80215f:	48 89 c2             	mov    %rax,%rdx
+  802162:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  802165:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  802167:	8d 70 ff             	lea    -0x1(%rax),%esi
+  80216a:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  80216d:	85 c0                	test   %eax,%eax
+  80216f:	7e 91                	jle    802102 <vprintfmt+0x24b>
+  802171:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  802176:	4c 89 ee             	mov    %r13,%rsi
+  802179:	44 89 e7             	mov    %r12d,%edi
+  80217c:	41 ff d6             	call   *%r14
+  80217f:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  802183:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  802186:	83 f8 ff             	cmp    $0xffffffff,%eax
+  802189:	75 eb                	jne    802176 <vprintfmt+0x2bf>
+  80218b:	e9 72 ff ff ff       	jmp    802102 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  802190:	0f b6 f8             	movzbl %al,%edi
+  802193:	4c 89 ee             	mov    %r13,%rsi
+  802196:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  802199:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  80219d:	49 83 c4 01          	add    $0x1,%r12
+  8021a1:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  8021a7:	84 c0                	test   %al,%al
+  8021a9:	0f 84 66 ff ff ff    	je     802115 <vprintfmt+0x25e>
+  8021af:	45 85 ff             	test   %r15d,%r15d
+  8021b2:	78 0a                	js     8021be <vprintfmt+0x307>
+  8021b4:	41 83 ef 01          	sub    $0x1,%r15d
+  8021b8:	0f 88 57 ff ff ff    	js     802115 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8021be:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  8021c2:	74 cc                	je     802190 <vprintfmt+0x2d9>
+  8021c4:	8d 50 e0             	lea    -0x20(%rax),%edx
+  8021c7:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  8021cc:	80 fa 5e             	cmp    $0x5e,%dl
+  8021cf:	77 c2                	ja     802193 <vprintfmt+0x2dc>
+  8021d1:	eb bd                	jmp    802190 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  8021d3:	40 84 f6             	test   %sil,%sil
+  8021d6:	75 26                	jne    8021fe <vprintfmt+0x347>
+    switch (lflag) {
+  8021d8:	85 d2                	test   %edx,%edx
+  8021da:	74 59                	je     802235 <vprintfmt+0x37e>
+  8021dc:	83 fa 01             	cmp    $0x1,%edx
+  8021df:	74 7b                	je     80225c <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  8021e1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8021e4:	83 f8 2f             	cmp    $0x2f,%eax
+  8021e7:	0f 87 96 00 00 00    	ja     802283 <vprintfmt+0x3cc>
+  8021ed:	89 c2                	mov    %eax,%edx
+  8021ef:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8021f3:	83 c0 08             	add    $0x8,%eax
+  8021f6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8021f9:	4c 8b 22             	mov    (%rdx),%r12
+  8021fc:	eb 17                	jmp    802215 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  8021fe:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802201:	83 f8 2f             	cmp    $0x2f,%eax
+  802204:	77 21                	ja     802227 <vprintfmt+0x370>
+  802206:	89 c2                	mov    %eax,%edx
+  802208:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80220c:	83 c0 08             	add    $0x8,%eax
+  80220f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802212:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  802215:	4d 85 e4             	test   %r12,%r12
+  802218:	78 7a                	js     802294 <vprintfmt+0x3dd>
+            num = i;
+  80221a:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  80221d:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  802222:	e9 50 02 00 00       	jmp    802477 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  802227:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80222b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80222f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802233:	eb dd                	jmp    802212 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  802235:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802238:	83 f8 2f             	cmp    $0x2f,%eax
+  80223b:	77 11                	ja     80224e <vprintfmt+0x397>
+  80223d:	89 c2                	mov    %eax,%edx
+  80223f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802243:	83 c0 08             	add    $0x8,%eax
+  802246:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802249:	4c 63 22             	movslq (%rdx),%r12
+  80224c:	eb c7                	jmp    802215 <vprintfmt+0x35e>
+  80224e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802252:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802256:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80225a:	eb ed                	jmp    802249 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  80225c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80225f:	83 f8 2f             	cmp    $0x2f,%eax
+  802262:	77 11                	ja     802275 <vprintfmt+0x3be>
+  802264:	89 c2                	mov    %eax,%edx
+  802266:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80226a:	83 c0 08             	add    $0x8,%eax
+  80226d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802270:	4c 8b 22             	mov    (%rdx),%r12
+  802273:	eb a0                	jmp    802215 <vprintfmt+0x35e>
+  802275:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802279:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80227d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802281:	eb ed                	jmp    802270 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  802283:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802287:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80228b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80228f:	e9 65 ff ff ff       	jmp    8021f9 <vprintfmt+0x342>
+                putch('-', put_arg);
+  802294:	4c 89 ee             	mov    %r13,%rsi
+  802297:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  80229c:	41 ff d6             	call   *%r14
+                i = -i;
+  80229f:	49 f7 dc             	neg    %r12
+  8022a2:	e9 73 ff ff ff       	jmp    80221a <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  8022a7:	40 84 f6             	test   %sil,%sil
+  8022aa:	75 32                	jne    8022de <vprintfmt+0x427>
+    switch (lflag) {
+  8022ac:	85 d2                	test   %edx,%edx
+  8022ae:	74 5d                	je     80230d <vprintfmt+0x456>
+  8022b0:	83 fa 01             	cmp    $0x1,%edx
+  8022b3:	0f 84 82 00 00 00    	je     80233b <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  8022b9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8022bc:	83 f8 2f             	cmp    $0x2f,%eax
+  8022bf:	0f 87 a5 00 00 00    	ja     80236a <vprintfmt+0x4b3>
+  8022c5:	89 c2                	mov    %eax,%edx
+  8022c7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8022cb:	83 c0 08             	add    $0x8,%eax
+  8022ce:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8022d1:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8022d4:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  8022d9:	e9 99 01 00 00       	jmp    802477 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8022de:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8022e1:	83 f8 2f             	cmp    $0x2f,%eax
+  8022e4:	77 19                	ja     8022ff <vprintfmt+0x448>
+  8022e6:	89 c2                	mov    %eax,%edx
+  8022e8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8022ec:	83 c0 08             	add    $0x8,%eax
+  8022ef:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8022f2:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8022f5:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8022fa:	e9 78 01 00 00       	jmp    802477 <vprintfmt+0x5c0>
+  8022ff:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802303:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802307:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80230b:	eb e5                	jmp    8022f2 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  80230d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802310:	83 f8 2f             	cmp    $0x2f,%eax
+  802313:	77 18                	ja     80232d <vprintfmt+0x476>
+  802315:	89 c2                	mov    %eax,%edx
+  802317:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80231b:	83 c0 08             	add    $0x8,%eax
+  80231e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802321:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  802323:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  802328:	e9 4a 01 00 00       	jmp    802477 <vprintfmt+0x5c0>
+  80232d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802331:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802335:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802339:	eb e6                	jmp    802321 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  80233b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80233e:	83 f8 2f             	cmp    $0x2f,%eax
+  802341:	77 19                	ja     80235c <vprintfmt+0x4a5>
+  802343:	89 c2                	mov    %eax,%edx
+  802345:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802349:	83 c0 08             	add    $0x8,%eax
+  80234c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80234f:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  802352:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  802357:	e9 1b 01 00 00       	jmp    802477 <vprintfmt+0x5c0>
+  80235c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802360:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802364:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802368:	eb e5                	jmp    80234f <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  80236a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80236e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802372:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802376:	e9 56 ff ff ff       	jmp    8022d1 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  80237b:	40 84 f6             	test   %sil,%sil
+  80237e:	75 2e                	jne    8023ae <vprintfmt+0x4f7>
+    switch (lflag) {
+  802380:	85 d2                	test   %edx,%edx
+  802382:	74 59                	je     8023dd <vprintfmt+0x526>
+  802384:	83 fa 01             	cmp    $0x1,%edx
+  802387:	74 7f                	je     802408 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  802389:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80238c:	83 f8 2f             	cmp    $0x2f,%eax
+  80238f:	0f 87 9f 00 00 00    	ja     802434 <vprintfmt+0x57d>
+  802395:	89 c2                	mov    %eax,%edx
+  802397:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80239b:	83 c0 08             	add    $0x8,%eax
+  80239e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8023a1:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8023a4:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  8023a9:	e9 c9 00 00 00       	jmp    802477 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8023ae:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8023b1:	83 f8 2f             	cmp    $0x2f,%eax
+  8023b4:	77 19                	ja     8023cf <vprintfmt+0x518>
+  8023b6:	89 c2                	mov    %eax,%edx
+  8023b8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8023bc:	83 c0 08             	add    $0x8,%eax
+  8023bf:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8023c2:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8023c5:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8023ca:	e9 a8 00 00 00       	jmp    802477 <vprintfmt+0x5c0>
+  8023cf:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8023d3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8023d7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8023db:	eb e5                	jmp    8023c2 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  8023dd:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8023e0:	83 f8 2f             	cmp    $0x2f,%eax
+  8023e3:	77 15                	ja     8023fa <vprintfmt+0x543>
+  8023e5:	89 c2                	mov    %eax,%edx
+  8023e7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8023eb:	83 c0 08             	add    $0x8,%eax
+  8023ee:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8023f1:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  8023f3:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  8023f8:	eb 7d                	jmp    802477 <vprintfmt+0x5c0>
+  8023fa:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8023fe:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802402:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802406:	eb e9                	jmp    8023f1 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  802408:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80240b:	83 f8 2f             	cmp    $0x2f,%eax
+  80240e:	77 16                	ja     802426 <vprintfmt+0x56f>
+  802410:	89 c2                	mov    %eax,%edx
+  802412:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802416:	83 c0 08             	add    $0x8,%eax
+  802419:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80241c:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  80241f:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  802424:	eb 51                	jmp    802477 <vprintfmt+0x5c0>
+  802426:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80242a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80242e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802432:	eb e8                	jmp    80241c <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  802434:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802438:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80243c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802440:	e9 5c ff ff ff       	jmp    8023a1 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  802445:	4c 89 ee             	mov    %r13,%rsi
+  802448:	bf 30 00 00 00       	mov    $0x30,%edi
+  80244d:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  802450:	4c 89 ee             	mov    %r13,%rsi
+  802453:	bf 78 00 00 00       	mov    $0x78,%edi
+  802458:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  80245b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80245e:	83 f8 2f             	cmp    $0x2f,%eax
+  802461:	77 47                	ja     8024aa <vprintfmt+0x5f3>
+  802463:	89 c2                	mov    %eax,%edx
+  802465:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802469:	83 c0 08             	add    $0x8,%eax
+  80246c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80246f:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  802472:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  802477:	48 83 ec 08          	sub    $0x8,%rsp
+  80247b:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  80247f:	0f 94 c0             	sete   %al
+  802482:	0f b6 c0             	movzbl %al,%eax
+  802485:	50                   	push   %rax
+  802486:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  80248b:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  80248f:	4c 89 ee             	mov    %r13,%rsi
+  802492:	4c 89 f7             	mov    %r14,%rdi
+  802495:	48 b8 ac 1d 80 00 00 	movabs $0x801dac,%rax
+  80249c:	00 00 00 
+  80249f:	ff d0                	call   *%rax
+            break;
+  8024a1:	48 83 c4 10          	add    $0x10,%rsp
+  8024a5:	e9 3e fa ff ff       	jmp    801ee8 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  8024aa:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8024ae:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8024b2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8024b6:	eb b7                	jmp    80246f <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  8024b8:	40 84 f6             	test   %sil,%sil
+  8024bb:	75 2b                	jne    8024e8 <vprintfmt+0x631>
+    switch (lflag) {
+  8024bd:	85 d2                	test   %edx,%edx
+  8024bf:	74 56                	je     802517 <vprintfmt+0x660>
+  8024c1:	83 fa 01             	cmp    $0x1,%edx
+  8024c4:	74 7f                	je     802545 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  8024c6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8024c9:	83 f8 2f             	cmp    $0x2f,%eax
+  8024cc:	0f 87 a2 00 00 00    	ja     802574 <vprintfmt+0x6bd>
+  8024d2:	89 c2                	mov    %eax,%edx
+  8024d4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8024d8:	83 c0 08             	add    $0x8,%eax
+  8024db:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8024de:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8024e1:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  8024e6:	eb 8f                	jmp    802477 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8024e8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8024eb:	83 f8 2f             	cmp    $0x2f,%eax
+  8024ee:	77 19                	ja     802509 <vprintfmt+0x652>
+  8024f0:	89 c2                	mov    %eax,%edx
+  8024f2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8024f6:	83 c0 08             	add    $0x8,%eax
+  8024f9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8024fc:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8024ff:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  802504:	e9 6e ff ff ff       	jmp    802477 <vprintfmt+0x5c0>
+  802509:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80250d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802511:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802515:	eb e5                	jmp    8024fc <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  802517:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80251a:	83 f8 2f             	cmp    $0x2f,%eax
+  80251d:	77 18                	ja     802537 <vprintfmt+0x680>
+  80251f:	89 c2                	mov    %eax,%edx
+  802521:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802525:	83 c0 08             	add    $0x8,%eax
+  802528:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80252b:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  80252d:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  802532:	e9 40 ff ff ff       	jmp    802477 <vprintfmt+0x5c0>
+  802537:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80253b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80253f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802543:	eb e6                	jmp    80252b <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  802545:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802548:	83 f8 2f             	cmp    $0x2f,%eax
+  80254b:	77 19                	ja     802566 <vprintfmt+0x6af>
+  80254d:	89 c2                	mov    %eax,%edx
+  80254f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802553:	83 c0 08             	add    $0x8,%eax
+  802556:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802559:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  80255c:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  802561:	e9 11 ff ff ff       	jmp    802477 <vprintfmt+0x5c0>
+  802566:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80256a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80256e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802572:	eb e5                	jmp    802559 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  802574:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802578:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80257c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802580:	e9 59 ff ff ff       	jmp    8024de <vprintfmt+0x627>
+            putch(ch, put_arg);
+  802585:	4c 89 ee             	mov    %r13,%rsi
+  802588:	bf 25 00 00 00       	mov    $0x25,%edi
+  80258d:	41 ff d6             	call   *%r14
+            break;
+  802590:	e9 53 f9 ff ff       	jmp    801ee8 <vprintfmt+0x31>
+            putch('%', put_arg);
+  802595:	4c 89 ee             	mov    %r13,%rsi
+  802598:	bf 25 00 00 00       	mov    $0x25,%edi
+  80259d:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  8025a0:	48 83 eb 01          	sub    $0x1,%rbx
+  8025a4:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  8025a8:	75 f6                	jne    8025a0 <vprintfmt+0x6e9>
+  8025aa:	e9 39 f9 ff ff       	jmp    801ee8 <vprintfmt+0x31>
+}
+  8025af:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8025b3:	5b                   	pop    %rbx
+  8025b4:	41 5c                	pop    %r12
+  8025b6:	41 5d                	pop    %r13
+  8025b8:	41 5e                	pop    %r14
+  8025ba:	41 5f                	pop    %r15
+  8025bc:	5d                   	pop    %rbp
+  8025bd:	c3                   	ret
+
+00000000008025be <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  8025be:	55                   	push   %rbp
+  8025bf:	48 89 e5             	mov    %rsp,%rbp
+  8025c2:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  8025c6:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8025ca:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  8025cf:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  8025d3:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  8025da:	48 85 ff             	test   %rdi,%rdi
+  8025dd:	74 2b                	je     80260a <vsnprintf+0x4c>
+  8025df:	48 85 f6             	test   %rsi,%rsi
+  8025e2:	74 26                	je     80260a <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  8025e4:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8025e8:	48 bf 62 1e 80 00 00 	movabs $0x801e62,%rdi
+  8025ef:	00 00 00 
+  8025f2:	48 b8 b7 1e 80 00 00 	movabs $0x801eb7,%rax
+  8025f9:	00 00 00 
+  8025fc:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  8025fe:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802602:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  802605:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  802608:	c9                   	leave
+  802609:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  80260a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80260f:	eb f7                	jmp    802608 <vsnprintf+0x4a>
+
+0000000000802611 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  802611:	55                   	push   %rbp
+  802612:	48 89 e5             	mov    %rsp,%rbp
+  802615:	48 83 ec 50          	sub    $0x50,%rsp
+  802619:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80261d:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  802621:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  802625:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  80262c:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802630:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802634:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  802638:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  80263c:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  802640:	48 b8 be 25 80 00 00 	movabs $0x8025be,%rax
+  802647:	00 00 00 
+  80264a:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  80264c:	c9                   	leave
+  80264d:	c3                   	ret
+
+000000000080264e <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  80264e:	80 3f 00             	cmpb   $0x0,(%rdi)
+  802651:	74 10                	je     802663 <strlen+0x15>
+    size_t n = 0;
+  802653:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  802658:	48 83 c0 01          	add    $0x1,%rax
+  80265c:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  802660:	75 f6                	jne    802658 <strlen+0xa>
+  802662:	c3                   	ret
+    size_t n = 0;
+  802663:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  802668:	c3                   	ret
+
+0000000000802669 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  802669:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  80266c:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  802671:	48 85 f6             	test   %rsi,%rsi
+  802674:	74 11                	je     802687 <strnlen+0x1e>
+  802676:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  80267a:	74 0c                	je     802688 <strnlen+0x1f>
+  80267c:	48 83 c2 01          	add    $0x1,%rdx
+  802680:	48 39 d0             	cmp    %rdx,%rax
+  802683:	75 f1                	jne    802676 <strnlen+0xd>
+  802685:	eb 04                	jmp    80268b <strnlen+0x22>
+  802687:	c3                   	ret
+  802688:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  80268b:	c3                   	ret
+
+000000000080268c <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  80268c:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  80268f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802694:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  802698:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  80269b:	48 83 c2 01          	add    $0x1,%rdx
+  80269f:	84 c9                	test   %cl,%cl
+  8026a1:	75 f1                	jne    802694 <strcpy+0x8>
+        ;
+    return res;
+}
+  8026a3:	c3                   	ret
+
+00000000008026a4 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  8026a4:	55                   	push   %rbp
+  8026a5:	48 89 e5             	mov    %rsp,%rbp
+  8026a8:	41 54                	push   %r12
+  8026aa:	53                   	push   %rbx
+  8026ab:	48 89 fb             	mov    %rdi,%rbx
+  8026ae:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  8026b1:	48 b8 4e 26 80 00 00 	movabs $0x80264e,%rax
+  8026b8:	00 00 00 
+  8026bb:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  8026bd:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  8026c1:	4c 89 e6             	mov    %r12,%rsi
+  8026c4:	48 b8 8c 26 80 00 00 	movabs $0x80268c,%rax
+  8026cb:	00 00 00 
+  8026ce:	ff d0                	call   *%rax
+    return dst;
+}
+  8026d0:	48 89 d8             	mov    %rbx,%rax
+  8026d3:	5b                   	pop    %rbx
+  8026d4:	41 5c                	pop    %r12
+  8026d6:	5d                   	pop    %rbp
+  8026d7:	c3                   	ret
+
+00000000008026d8 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8026d8:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  8026db:	48 85 d2             	test   %rdx,%rdx
+  8026de:	74 1f                	je     8026ff <strncpy+0x27>
+  8026e0:	48 01 fa             	add    %rdi,%rdx
+  8026e3:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  8026e6:	48 83 c1 01          	add    $0x1,%rcx
+  8026ea:	44 0f b6 06          	movzbl (%rsi),%r8d
+  8026ee:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  8026f2:	41 80 f8 01          	cmp    $0x1,%r8b
+  8026f6:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  8026fa:	48 39 ca             	cmp    %rcx,%rdx
+  8026fd:	75 e7                	jne    8026e6 <strncpy+0xe>
+    }
+    return ret;
+}
+  8026ff:	c3                   	ret
+
+0000000000802700 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  802700:	48 89 f8             	mov    %rdi,%rax
+  802703:	48 85 d2             	test   %rdx,%rdx
+  802706:	74 24                	je     80272c <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  802708:	48 83 ea 01          	sub    $0x1,%rdx
+  80270c:	74 1b                	je     802729 <strlcpy+0x29>
+  80270e:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  802712:	0f b6 16             	movzbl (%rsi),%edx
+  802715:	84 d2                	test   %dl,%dl
+  802717:	74 10                	je     802729 <strlcpy+0x29>
+            *dst++ = *src++;
+  802719:	48 83 c6 01          	add    $0x1,%rsi
+  80271d:	48 83 c0 01          	add    $0x1,%rax
+  802721:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  802724:	48 39 c8             	cmp    %rcx,%rax
+  802727:	75 e9                	jne    802712 <strlcpy+0x12>
+        *dst = '\0';
+  802729:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  80272c:	48 29 f8             	sub    %rdi,%rax
+}
+  80272f:	c3                   	ret
+
+0000000000802730 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  802730:	0f b6 07             	movzbl (%rdi),%eax
+  802733:	84 c0                	test   %al,%al
+  802735:	74 13                	je     80274a <strcmp+0x1a>
+  802737:	38 06                	cmp    %al,(%rsi)
+  802739:	75 0f                	jne    80274a <strcmp+0x1a>
+  80273b:	48 83 c7 01          	add    $0x1,%rdi
+  80273f:	48 83 c6 01          	add    $0x1,%rsi
+  802743:	0f b6 07             	movzbl (%rdi),%eax
+  802746:	84 c0                	test   %al,%al
+  802748:	75 ed                	jne    802737 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  80274a:	0f b6 c0             	movzbl %al,%eax
+  80274d:	0f b6 16             	movzbl (%rsi),%edx
+  802750:	29 d0                	sub    %edx,%eax
+}
+  802752:	c3                   	ret
+
+0000000000802753 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  802753:	48 85 d2             	test   %rdx,%rdx
+  802756:	74 1f                	je     802777 <strncmp+0x24>
+  802758:	0f b6 07             	movzbl (%rdi),%eax
+  80275b:	84 c0                	test   %al,%al
+  80275d:	74 1e                	je     80277d <strncmp+0x2a>
+  80275f:	3a 06                	cmp    (%rsi),%al
+  802761:	75 1a                	jne    80277d <strncmp+0x2a>
+  802763:	48 83 c7 01          	add    $0x1,%rdi
+  802767:	48 83 c6 01          	add    $0x1,%rsi
+  80276b:	48 83 ea 01          	sub    $0x1,%rdx
+  80276f:	75 e7                	jne    802758 <strncmp+0x5>
+
+    if (!n) return 0;
+  802771:	b8 00 00 00 00       	mov    $0x0,%eax
+  802776:	c3                   	ret
+  802777:	b8 00 00 00 00       	mov    $0x0,%eax
+  80277c:	c3                   	ret
+  80277d:	48 85 d2             	test   %rdx,%rdx
+  802780:	74 09                	je     80278b <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  802782:	0f b6 07             	movzbl (%rdi),%eax
+  802785:	0f b6 16             	movzbl (%rsi),%edx
+  802788:	29 d0                	sub    %edx,%eax
+  80278a:	c3                   	ret
+    if (!n) return 0;
+  80278b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802790:	c3                   	ret
+
+0000000000802791 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  802791:	0f b6 17             	movzbl (%rdi),%edx
+  802794:	84 d2                	test   %dl,%dl
+  802796:	74 18                	je     8027b0 <strchr+0x1f>
+        if (*str == c) {
+  802798:	0f be d2             	movsbl %dl,%edx
+  80279b:	39 f2                	cmp    %esi,%edx
+  80279d:	74 17                	je     8027b6 <strchr+0x25>
+    for (; *str; str++) {
+  80279f:	48 83 c7 01          	add    $0x1,%rdi
+  8027a3:	0f b6 17             	movzbl (%rdi),%edx
+  8027a6:	84 d2                	test   %dl,%dl
+  8027a8:	75 ee                	jne    802798 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  8027aa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027af:	c3                   	ret
+  8027b0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027b5:	c3                   	ret
+  8027b6:	48 89 f8             	mov    %rdi,%rax
+}
+  8027b9:	c3                   	ret
+
+00000000008027ba <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  8027ba:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  8027bd:	0f b6 17             	movzbl (%rdi),%edx
+  8027c0:	84 d2                	test   %dl,%dl
+  8027c2:	74 13                	je     8027d7 <strfind+0x1d>
+  8027c4:	0f be d2             	movsbl %dl,%edx
+  8027c7:	39 f2                	cmp    %esi,%edx
+  8027c9:	74 0b                	je     8027d6 <strfind+0x1c>
+  8027cb:	48 83 c0 01          	add    $0x1,%rax
+  8027cf:	0f b6 10             	movzbl (%rax),%edx
+  8027d2:	84 d2                	test   %dl,%dl
+  8027d4:	75 ee                	jne    8027c4 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  8027d6:	c3                   	ret
+  8027d7:	c3                   	ret
+
+00000000008027d8 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  8027d8:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  8027db:	48 89 f8             	mov    %rdi,%rax
+  8027de:	48 f7 d8             	neg    %rax
+  8027e1:	83 e0 07             	and    $0x7,%eax
+  8027e4:	49 89 d1             	mov    %rdx,%r9
+  8027e7:	49 29 c1             	sub    %rax,%r9
+  8027ea:	78 36                	js     802822 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  8027ec:	40 0f b6 c6          	movzbl %sil,%eax
+  8027f0:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  8027f7:	01 01 01 
+  8027fa:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  8027fe:	40 f6 c7 07          	test   $0x7,%dil
+  802802:	75 38                	jne    80283c <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  802804:	4c 89 c9             	mov    %r9,%rcx
+  802807:	48 c1 f9 03          	sar    $0x3,%rcx
+  80280b:	74 0c                	je     802819 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  80280d:	fc                   	cld
+  80280e:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  802811:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  802815:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  802819:	4d 85 c9             	test   %r9,%r9
+  80281c:	75 45                	jne    802863 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  80281e:	4c 89 c0             	mov    %r8,%rax
+  802821:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  802822:	48 85 d2             	test   %rdx,%rdx
+  802825:	74 f7                	je     80281e <memset+0x46>
+  802827:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  80282a:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  80282d:	48 83 c0 01          	add    $0x1,%rax
+  802831:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  802835:	48 39 c2             	cmp    %rax,%rdx
+  802838:	75 f3                	jne    80282d <memset+0x55>
+  80283a:	eb e2                	jmp    80281e <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  80283c:	40 f6 c7 01          	test   $0x1,%dil
+  802840:	74 06                	je     802848 <memset+0x70>
+  802842:	88 07                	mov    %al,(%rdi)
+  802844:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  802848:	40 f6 c7 02          	test   $0x2,%dil
+  80284c:	74 07                	je     802855 <memset+0x7d>
+  80284e:	66 89 07             	mov    %ax,(%rdi)
+  802851:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  802855:	40 f6 c7 04          	test   $0x4,%dil
+  802859:	74 a9                	je     802804 <memset+0x2c>
+  80285b:	89 07                	mov    %eax,(%rdi)
+  80285d:	48 83 c7 04          	add    $0x4,%rdi
+  802861:	eb a1                	jmp    802804 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  802863:	41 f6 c1 04          	test   $0x4,%r9b
+  802867:	74 06                	je     80286f <memset+0x97>
+  802869:	89 07                	mov    %eax,(%rdi)
+  80286b:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  80286f:	41 f6 c1 02          	test   $0x2,%r9b
+  802873:	74 07                	je     80287c <memset+0xa4>
+  802875:	66 89 07             	mov    %ax,(%rdi)
+  802878:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  80287c:	41 f6 c1 01          	test   $0x1,%r9b
+  802880:	74 9c                	je     80281e <memset+0x46>
+  802882:	88 07                	mov    %al,(%rdi)
+  802884:	eb 98                	jmp    80281e <memset+0x46>
+
+0000000000802886 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  802886:	48 89 f8             	mov    %rdi,%rax
+  802889:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  80288c:	48 39 fe             	cmp    %rdi,%rsi
+  80288f:	73 3b                	jae    8028cc <memmove+0x46>
+  802891:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  802895:	48 39 d7             	cmp    %rdx,%rdi
+  802898:	73 32                	jae    8028cc <memmove+0x46>
+        s += n;
+        d += n;
+  80289a:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  80289e:	48 89 d6             	mov    %rdx,%rsi
+  8028a1:	48 09 fe             	or     %rdi,%rsi
+  8028a4:	48 09 ce             	or     %rcx,%rsi
+  8028a7:	40 f6 c6 07          	test   $0x7,%sil
+  8028ab:	75 12                	jne    8028bf <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  8028ad:	48 83 ef 08          	sub    $0x8,%rdi
+  8028b1:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  8028b5:	48 c1 e9 03          	shr    $0x3,%rcx
+  8028b9:	fd                   	std
+  8028ba:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  8028bd:	fc                   	cld
+  8028be:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  8028bf:	48 83 ef 01          	sub    $0x1,%rdi
+  8028c3:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  8028c7:	fd                   	std
+  8028c8:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  8028ca:	eb f1                	jmp    8028bd <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  8028cc:	48 89 f2             	mov    %rsi,%rdx
+  8028cf:	48 09 c2             	or     %rax,%rdx
+  8028d2:	48 09 ca             	or     %rcx,%rdx
+  8028d5:	f6 c2 07             	test   $0x7,%dl
+  8028d8:	75 0c                	jne    8028e6 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  8028da:	48 c1 e9 03          	shr    $0x3,%rcx
+  8028de:	48 89 c7             	mov    %rax,%rdi
+  8028e1:	fc                   	cld
+  8028e2:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  8028e5:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  8028e6:	48 89 c7             	mov    %rax,%rdi
+  8028e9:	fc                   	cld
+  8028ea:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  8028ec:	c3                   	ret
+
+00000000008028ed <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  8028ed:	55                   	push   %rbp
+  8028ee:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  8028f1:	48 b8 86 28 80 00 00 	movabs $0x802886,%rax
+  8028f8:	00 00 00 
+  8028fb:	ff d0                	call   *%rax
+}
+  8028fd:	5d                   	pop    %rbp
+  8028fe:	c3                   	ret
+
+00000000008028ff <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  8028ff:	55                   	push   %rbp
+  802900:	48 89 e5             	mov    %rsp,%rbp
+  802903:	41 57                	push   %r15
+  802905:	41 56                	push   %r14
+  802907:	41 55                	push   %r13
+  802909:	41 54                	push   %r12
+  80290b:	53                   	push   %rbx
+  80290c:	48 83 ec 08          	sub    $0x8,%rsp
+  802910:	49 89 fe             	mov    %rdi,%r14
+  802913:	49 89 f7             	mov    %rsi,%r15
+  802916:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  802919:	48 89 f7             	mov    %rsi,%rdi
+  80291c:	48 b8 4e 26 80 00 00 	movabs $0x80264e,%rax
+  802923:	00 00 00 
+  802926:	ff d0                	call   *%rax
+  802928:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  80292b:	48 89 de             	mov    %rbx,%rsi
+  80292e:	4c 89 f7             	mov    %r14,%rdi
+  802931:	48 b8 69 26 80 00 00 	movabs $0x802669,%rax
+  802938:	00 00 00 
+  80293b:	ff d0                	call   *%rax
+  80293d:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  802940:	48 39 c3             	cmp    %rax,%rbx
+  802943:	74 36                	je     80297b <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  802945:	48 89 d8             	mov    %rbx,%rax
+  802948:	4c 29 e8             	sub    %r13,%rax
+  80294b:	49 39 c4             	cmp    %rax,%r12
+  80294e:	73 31                	jae    802981 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  802950:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  802955:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  802959:	4c 89 fe             	mov    %r15,%rsi
+  80295c:	48 b8 ed 28 80 00 00 	movabs $0x8028ed,%rax
+  802963:	00 00 00 
+  802966:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  802968:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  80296c:	48 83 c4 08          	add    $0x8,%rsp
+  802970:	5b                   	pop    %rbx
+  802971:	41 5c                	pop    %r12
+  802973:	41 5d                	pop    %r13
+  802975:	41 5e                	pop    %r14
+  802977:	41 5f                	pop    %r15
+  802979:	5d                   	pop    %rbp
+  80297a:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  80297b:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  80297f:	eb eb                	jmp    80296c <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  802981:	48 83 eb 01          	sub    $0x1,%rbx
+  802985:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  802989:	48 89 da             	mov    %rbx,%rdx
+  80298c:	4c 89 fe             	mov    %r15,%rsi
+  80298f:	48 b8 ed 28 80 00 00 	movabs $0x8028ed,%rax
+  802996:	00 00 00 
+  802999:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  80299b:	49 01 de             	add    %rbx,%r14
+  80299e:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  8029a3:	eb c3                	jmp    802968 <strlcat+0x69>
+
+00000000008029a5 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  8029a5:	48 85 d2             	test   %rdx,%rdx
+  8029a8:	74 2d                	je     8029d7 <memcmp+0x32>
+  8029aa:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  8029af:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  8029b3:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  8029b8:	44 38 c1             	cmp    %r8b,%cl
+  8029bb:	75 0f                	jne    8029cc <memcmp+0x27>
+    while (n-- > 0) {
+  8029bd:	48 83 c0 01          	add    $0x1,%rax
+  8029c1:	48 39 c2             	cmp    %rax,%rdx
+  8029c4:	75 e9                	jne    8029af <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  8029c6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029cb:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  8029cc:	0f b6 c1             	movzbl %cl,%eax
+  8029cf:	45 0f b6 c0          	movzbl %r8b,%r8d
+  8029d3:	44 29 c0             	sub    %r8d,%eax
+  8029d6:	c3                   	ret
+    return 0;
+  8029d7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8029dc:	c3                   	ret
+
+00000000008029dd <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  8029dd:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  8029e1:	48 39 c7             	cmp    %rax,%rdi
+  8029e4:	73 0f                	jae    8029f5 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  8029e6:	40 38 37             	cmp    %sil,(%rdi)
+  8029e9:	74 0e                	je     8029f9 <memfind+0x1c>
+    for (; src < end; src++) {
+  8029eb:	48 83 c7 01          	add    $0x1,%rdi
+  8029ef:	48 39 f8             	cmp    %rdi,%rax
+  8029f2:	75 f2                	jne    8029e6 <memfind+0x9>
+  8029f4:	c3                   	ret
+  8029f5:	48 89 f8             	mov    %rdi,%rax
+  8029f8:	c3                   	ret
+  8029f9:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  8029fc:	c3                   	ret
+
+00000000008029fd <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  8029fd:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  802a00:	0f b6 37             	movzbl (%rdi),%esi
+  802a03:	40 80 fe 20          	cmp    $0x20,%sil
+  802a07:	74 06                	je     802a0f <strtol+0x12>
+  802a09:	40 80 fe 09          	cmp    $0x9,%sil
+  802a0d:	75 13                	jne    802a22 <strtol+0x25>
+  802a0f:	48 83 c7 01          	add    $0x1,%rdi
+  802a13:	0f b6 37             	movzbl (%rdi),%esi
+  802a16:	40 80 fe 20          	cmp    $0x20,%sil
+  802a1a:	74 f3                	je     802a0f <strtol+0x12>
+  802a1c:	40 80 fe 09          	cmp    $0x9,%sil
+  802a20:	74 ed                	je     802a0f <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  802a22:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  802a25:	83 e0 fd             	and    $0xfffffffd,%eax
+  802a28:	3c 01                	cmp    $0x1,%al
+  802a2a:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  802a2e:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  802a34:	75 0f                	jne    802a45 <strtol+0x48>
+  802a36:	80 3f 30             	cmpb   $0x30,(%rdi)
+  802a39:	74 14                	je     802a4f <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  802a3b:	85 d2                	test   %edx,%edx
+  802a3d:	b8 0a 00 00 00       	mov    $0xa,%eax
+  802a42:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  802a45:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  802a4a:	4c 63 ca             	movslq %edx,%r9
+  802a4d:	eb 36                	jmp    802a85 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  802a4f:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  802a53:	74 0f                	je     802a64 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  802a55:	85 d2                	test   %edx,%edx
+  802a57:	75 ec                	jne    802a45 <strtol+0x48>
+        s++;
+  802a59:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  802a5d:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  802a62:	eb e1                	jmp    802a45 <strtol+0x48>
+        s += 2;
+  802a64:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  802a68:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  802a6d:	eb d6                	jmp    802a45 <strtol+0x48>
+            dig -= '0';
+  802a6f:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  802a72:	44 0f b6 c1          	movzbl %cl,%r8d
+  802a76:	41 39 d0             	cmp    %edx,%r8d
+  802a79:	7d 21                	jge    802a9c <strtol+0x9f>
+        val = val * base + dig;
+  802a7b:	49 0f af c1          	imul   %r9,%rax
+  802a7f:	0f b6 c9             	movzbl %cl,%ecx
+  802a82:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  802a85:	48 83 c7 01          	add    $0x1,%rdi
+  802a89:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  802a8d:	80 f9 39             	cmp    $0x39,%cl
+  802a90:	76 dd                	jbe    802a6f <strtol+0x72>
+        else if (dig - 'a' < 27)
+  802a92:	80 f9 7b             	cmp    $0x7b,%cl
+  802a95:	77 05                	ja     802a9c <strtol+0x9f>
+            dig -= 'a' - 10;
+  802a97:	83 e9 57             	sub    $0x57,%ecx
+  802a9a:	eb d6                	jmp    802a72 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  802a9c:	4d 85 d2             	test   %r10,%r10
+  802a9f:	74 03                	je     802aa4 <strtol+0xa7>
+  802aa1:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  802aa4:	48 89 c2             	mov    %rax,%rdx
+  802aa7:	48 f7 da             	neg    %rdx
+  802aaa:	40 80 fe 2d          	cmp    $0x2d,%sil
+  802aae:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  802ab2:	c3                   	ret
+
+0000000000802ab3 <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  802ab3:	55                   	push   %rbp
+  802ab4:	48 89 e5             	mov    %rsp,%rbp
+  802ab7:	41 55                	push   %r13
+  802ab9:	41 54                	push   %r12
+  802abb:	53                   	push   %rbx
+  802abc:	48 83 ec 08          	sub    $0x8,%rsp
+  802ac0:	49 89 fc             	mov    %rdi,%r12
+  802ac3:	48 89 f7             	mov    %rsi,%rdi
+  802ac6:	48 89 d3             	mov    %rdx,%rbx
+  802ac9:	49 89 cd             	mov    %rcx,%r13
+    // LAB 9: Your code here:
+    int res = sys_ipc_recv(!pg ? (void*)MAX_USER_ADDRESS : pg, !size ? 0 : *size);
+  802acc:	be 00 00 00 00       	mov    $0x0,%esi
+  802ad1:	48 85 d2             	test   %rdx,%rdx
+  802ad4:	74 03                	je     802ad9 <ipc_recv+0x26>
+  802ad6:	48 8b 32             	mov    (%rdx),%rsi
+  802ad9:	48 85 ff             	test   %rdi,%rdi
+  802adc:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802ae3:	00 00 00 
+  802ae6:	48 0f 44 f8          	cmove  %rax,%rdi
+  802aea:	48 b8 58 06 80 00 00 	movabs $0x800658,%rax
+  802af1:	00 00 00 
+  802af4:	ff d0                	call   *%rax
+    if (res < 0) {
+  802af6:	85 c0                	test   %eax,%eax
+  802af8:	78 66                	js     802b60 <ipc_recv+0xad>
+        if (size) {
+            *size = 0;
+        }
+        return res;
+    }
+    if (from_env_store) {
+  802afa:	4d 85 e4             	test   %r12,%r12
+  802afd:	74 14                	je     802b13 <ipc_recv+0x60>
+        *from_env_store = thisenv->env_ipc_from;
+  802aff:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802b06:	00 00 00 
+  802b09:	8b 80 ac 01 00 00    	mov    0x1ac(%rax),%eax
+  802b0f:	41 89 04 24          	mov    %eax,(%r12)
+    }
+    if (perm_store) {
+  802b13:	4d 85 ed             	test   %r13,%r13
+  802b16:	74 14                	je     802b2c <ipc_recv+0x79>
+        *perm_store = thisenv->env_ipc_perm;
+  802b18:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802b1f:	00 00 00 
+  802b22:	8b 80 b0 01 00 00    	mov    0x1b0(%rax),%eax
+  802b28:	41 89 45 00          	mov    %eax,0x0(%r13)
+    }
+    if (size) {
+  802b2c:	48 85 db             	test   %rbx,%rbx
+  802b2f:	74 14                	je     802b45 <ipc_recv+0x92>
+        *size = thisenv->env_ipc_maxsz;
+  802b31:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802b38:	00 00 00 
+  802b3b:	48 8b 80 a0 01 00 00 	mov    0x1a0(%rax),%rax
+  802b42:	48 89 03             	mov    %rax,(%rbx)
+    }
+    return thisenv->env_ipc_value;
+  802b45:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802b4c:	00 00 00 
+  802b4f:	8b 80 a8 01 00 00    	mov    0x1a8(%rax),%eax
+}
+  802b55:	48 83 c4 08          	add    $0x8,%rsp
+  802b59:	5b                   	pop    %rbx
+  802b5a:	41 5c                	pop    %r12
+  802b5c:	41 5d                	pop    %r13
+  802b5e:	5d                   	pop    %rbp
+  802b5f:	c3                   	ret
+        if (from_env_store) {
+  802b60:	4d 85 e4             	test   %r12,%r12
+  802b63:	74 08                	je     802b6d <ipc_recv+0xba>
+            *from_env_store = 0;
+  802b65:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  802b6c:	00 
+        if (perm_store) {
+  802b6d:	4d 85 ed             	test   %r13,%r13
+  802b70:	74 08                	je     802b7a <ipc_recv+0xc7>
+            *perm_store = 0;
+  802b72:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  802b79:	00 
+        if (size) {
+  802b7a:	48 85 db             	test   %rbx,%rbx
+  802b7d:	74 d6                	je     802b55 <ipc_recv+0xa2>
+            *size = 0;
+  802b7f:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  802b86:	eb cd                	jmp    802b55 <ipc_recv+0xa2>
+
+0000000000802b88 <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  802b88:	55                   	push   %rbp
+  802b89:	48 89 e5             	mov    %rsp,%rbp
+  802b8c:	41 57                	push   %r15
+  802b8e:	41 56                	push   %r14
+  802b90:	41 55                	push   %r13
+  802b92:	41 54                	push   %r12
+  802b94:	53                   	push   %rbx
+  802b95:	48 83 ec 18          	sub    $0x18,%rsp
+  802b99:	41 89 fd             	mov    %edi,%r13d
+  802b9c:	89 75 cc             	mov    %esi,-0x34(%rbp)
+  802b9f:	49 89 cc             	mov    %rcx,%r12
+  802ba2:	44 89 45 c8          	mov    %r8d,-0x38(%rbp)
+    // LAB 9: Your code here:
+    int res = 0;
+    while ((res = sys_ipc_try_send(to_env, val, !pg ? (void*)MAX_USER_ADDRESS : pg, size, perm)) < 0) {
+  802ba6:	48 85 d2             	test   %rdx,%rdx
+  802ba9:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802bb0:	00 00 00 
+  802bb3:	48 0f 45 c2          	cmovne %rdx,%rax
+  802bb7:	48 89 c3             	mov    %rax,%rbx
+  802bba:	49 be 2c 06 80 00 00 	movabs $0x80062c,%r14
+  802bc1:	00 00 00 
+        if (res != -E_IPC_NOT_RECV) {
+            panic("sys_ipc_try_send failed: %i", res);
+        }
+        sys_yield();
+  802bc4:	49 bf f7 01 80 00 00 	movabs $0x8001f7,%r15
+  802bcb:	00 00 00 
+    while ((res = sys_ipc_try_send(to_env, val, !pg ? (void*)MAX_USER_ADDRESS : pg, size, perm)) < 0) {
+  802bce:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  802bd1:	44 8b 45 c8          	mov    -0x38(%rbp),%r8d
+  802bd5:	4c 89 e1             	mov    %r12,%rcx
+  802bd8:	48 89 da             	mov    %rbx,%rdx
+  802bdb:	44 89 ef             	mov    %r13d,%edi
+  802bde:	41 ff d6             	call   *%r14
+  802be1:	85 c0                	test   %eax,%eax
+  802be3:	79 37                	jns    802c1c <ipc_send+0x94>
+        if (res != -E_IPC_NOT_RECV) {
+  802be5:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  802be8:	75 05                	jne    802bef <ipc_send+0x67>
+        sys_yield();
+  802bea:	41 ff d7             	call   *%r15
+  802bed:	eb df                	jmp    802bce <ipc_send+0x46>
+            panic("sys_ipc_try_send failed: %i", res);
+  802bef:	89 c1                	mov    %eax,%ecx
+  802bf1:	48 ba 2f 33 80 00 00 	movabs $0x80332f,%rdx
+  802bf8:	00 00 00 
+  802bfb:	be 40 00 00 00       	mov    $0x40,%esi
+  802c00:	48 bf 4b 33 80 00 00 	movabs $0x80334b,%rdi
+  802c07:	00 00 00 
+  802c0a:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c0f:	49 b8 17 1c 80 00 00 	movabs $0x801c17,%r8
+  802c16:	00 00 00 
+  802c19:	41 ff d0             	call   *%r8
+    }
+    return;
+}
+  802c1c:	48 83 c4 18          	add    $0x18,%rsp
+  802c20:	5b                   	pop    %rbx
+  802c21:	41 5c                	pop    %r12
+  802c23:	41 5d                	pop    %r13
+  802c25:	41 5e                	pop    %r14
+  802c27:	41 5f                	pop    %r15
+  802c29:	5d                   	pop    %rbp
+  802c2a:	c3                   	ret
+
+0000000000802c2b <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  802c2b:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  802c30:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  802c37:	00 00 00 
+  802c3a:	48 69 d0 d0 01 00 00 	imul   $0x1d0,%rax,%rdx
+  802c41:	48 01 ca             	add    %rcx,%rdx
+  802c44:	8b 92 e8 00 00 00    	mov    0xe8(%rdx),%edx
+  802c4a:	39 fa                	cmp    %edi,%edx
+  802c4c:	74 12                	je     802c60 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  802c4e:	48 83 c0 01          	add    $0x1,%rax
+  802c52:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  802c58:	75 e0                	jne    802c3a <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  802c5a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802c5f:	c3                   	ret
+            return envs[i].env_id;
+  802c60:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+  802c67:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  802c6e:	00 00 00 
+  802c71:	48 01 d0             	add    %rdx,%rax
+  802c74:	8b 80 e0 00 00 00    	mov    0xe0(%rax),%eax
+  802c7a:	c3                   	ret
+  802c7b:	0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+
+0000000000802c80 <__rodata_start>:
+  802c80:	3c 75                	cmp    $0x75,%al
+  802c82:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802c83:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  802c87:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802c88:	3e 00 66 0f          	ds add %ah,0xf(%rsi)
+  802c8c:	1f                   	(bad)
+  802c8d:	44 00 00             	add    %r8b,(%rax)
+  802c90:	73 79                	jae    802d0b <__rodata_start+0x8b>
+  802c92:	73 63                	jae    802cf7 <__rodata_start+0x77>
+  802c94:	61                   	(bad)
+  802c95:	6c                   	insb   (%dx),%es:(%rdi)
+  802c96:	6c                   	insb   (%dx),%es:(%rdi)
+  802c97:	20 25 7a 64 20 72    	and    %ah,0x7220647a(%rip)        # 72a09117 <__bss_end+0x72201117>
+  802c9d:	65 74 75             	gs je  802d15 <__rodata_start+0x95>
+  802ca0:	72 6e                	jb     802d10 <__rodata_start+0x90>
+  802ca2:	65 64 20 25 7a 64 20 	gs and %ah,%fs:0x2820647a(%rip)        # 28a09124 <__bss_end+0x28201124>
+  802ca9:	28 
+  802caa:	3e 20 30             	ds and %dh,(%rax)
+  802cad:	29 00                	sub    %eax,(%rax)
+  802caf:	6c                   	insb   (%dx),%es:(%rdi)
+  802cb0:	69 62 2f 73 79 73 63 	imul   $0x63737973,0x2f(%rdx),%esp
+  802cb7:	61                   	(bad)
+  802cb8:	6c                   	insb   (%dx),%es:(%rdi)
+  802cb9:	6c                   	insb   (%dx),%es:(%rdi)
+  802cba:	2e 63 00             	cs movsxd (%rax),%eax
+  802cbd:	0f 1f 00             	nopl   (%rax)
+  802cc0:	5b                   	pop    %rbx
+  802cc1:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  802cc6:	20 75 6e             	and    %dh,0x6e(%rbp)
+  802cc9:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  802ccd:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802cce:	20 64 65 76          	and    %ah,0x76(%rbp,%riz,2)
+  802cd2:	69 63 65 20 74 79 70 	imul   $0x70797420,0x65(%rbx),%esp
+  802cd9:	65 20 25 64 0a 00 00 	and    %ah,%gs:0xa64(%rip)        # 803744 <error_string+0x4e4>
+  802ce0:	5b                   	pop    %rbx
+  802ce1:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  802ce6:	20 66 74             	and    %ah,0x74(%rsi)
+  802ce9:	72 75                	jb     802d60 <devtab+0x20>
+  802ceb:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802cec:	63 61 74             	movsxd 0x74(%rcx),%esp
+  802cef:	65 20 25 64 20 2d 2d 	and    %ah,%gs:0x2d2d2064(%rip)        # 2dad4d5a <__bss_end+0x2d2ccd5a>
+  802cf6:	20 62 61             	and    %ah,0x61(%rdx)
+  802cf9:	64 20 6d 6f          	and    %ch,%fs:0x6f(%rbp)
+  802cfd:	64 65 0a 00          	fs or  %gs:(%rax),%al
+  802d01:	5b                   	pop    %rbx
+  802d02:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  802d07:	20 72 65             	and    %dh,0x65(%rdx)
+  802d0a:	61                   	(bad)
+  802d0b:	64 20 25 64 20 2d 2d 	and    %ah,%fs:0x2d2d2064(%rip)        # 2dad4d76 <__bss_end+0x2d2ccd76>
+  802d12:	20 62 61             	and    %ah,0x61(%rdx)
+  802d15:	64 20 6d 6f          	and    %ch,%fs:0x6f(%rbp)
+  802d19:	64 65 0a 00          	fs or  %gs:(%rax),%al
+  802d1d:	5b                   	pop    %rbx
+  802d1e:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  802d23:	20 77 72             	and    %dh,0x72(%rdi)
+  802d26:	69 74 65 20 25 64 20 	imul   $0x2d206425,0x20(%rbp,%riz,2),%esi
+  802d2d:	2d 
+  802d2e:	2d 20 62 61 64       	sub    $0x64616220,%eax
+  802d33:	20 6d 6f             	and    %ch,0x6f(%rbp)
+  802d36:	64 65 0a 00          	fs or  %gs:(%rax),%al
+  802d3a:	66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+
+0000000000802d40 <devtab>:
+  802d40:	20 40 80 00 00 00 00 00 60 40 80 00 00 00 00 00      @......`@......
+  802d50:	a0 40 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .@..............
+  802d60:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  802d70:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  802d80:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  802d90:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  802da0:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  802db0:	3d 20 32 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73 00     = 2.<cons>.cons.
+  802dc0:	5b 25 30 38 78 5d 20 75 73 65 72 20 70 61 6e 69     [%08x] user pani
+  802dd0:	63 20 69 6e 20 25 73 20 61 74 20 25 73 3a 25 64     c in %s at %s:%d
+  802de0:	3a 20 00 30 31 32 33 34 35 36 37 38 39 41 42 43     : .0123456789ABC
+  802df0:	44 45 46 00 30 31 32 33 34 35 36 37 38 39 61 62     DEF.0123456789ab
+  802e00:	63 64 65 66 00 28 6e 75 6c 6c 29 00 65 72 72 6f     cdef.(null).erro
+  802e10:	72 20 25 64 00 75 6e 73 70 65 63 69 66 69 65 64     r %d.unspecified
+  802e20:	20 65 72 72 6f 72 00 62 61 64 20 65 6e 76 69 72      error.bad envir
+  802e30:	6f 6e 6d 65 6e 74 00 69 6e 76 61 6c 69 64 20 70     onment.invalid p
+  802e40:	61 72 61 6d 65 74 65 72 00 6f 75 74 20 6f 66 20     arameter.out of 
+  802e50:	6d 65 6d 6f 72 79 00 6f 75 74 20 6f 66 20 65 6e     memory.out of en
+  802e60:	76 69 72 6f 6e 6d 65 6e 74 73 00 63 6f 72 72 75     vironments.corru
+  802e70:	70 74 65 64 20 64 65 62 75 67 20 69 6e 66 6f 00     pted debug info.
+  802e80:	73 65 67 6d 65 6e 74 61 74 69 6f 6e 20 66 61 75     segmentation fau
+  802e90:	6c 74 00 69 6e 76 61 6c 69 64 20 45 4c 46 20 69     lt.invalid ELF i
+  802ea0:	6d 61 67 65 00 6e 6f 20 73 75 63 68 20 73 79 73     mage.no such sys
+  802eb0:	74 65 6d 20 63 61 6c 6c 00 65 6e 74 72 79 20 6e     tem call.entry n
+  802ec0:	6f 74 20 66 6f 75 6e 64 00 65 6e 76 20 69 73 20     ot found.env is 
+  802ed0:	6e 6f 74 20 72 65 63 76 69 6e 67 00 75 6e 65 78     not recving.unex
+  802ee0:	70 65 63 74 65 64 20 65 6e 64 20 6f 66 20 66 69     pected end of fi
+  802ef0:	6c 65 00 6e 6f 20 66 72 65 65 20 73 70 61 63 65     le.no free space
+  802f00:	20 6f 6e 20 64 69 73 6b 00 74 6f 6f 20 6d 61 6e      on disk.too man
+  802f10:	79 20 66 69 6c 65 73 20 61 72 65 20 6f 70 65 6e     y files are open
+  802f20:	00 66 69 6c 65 20 6f 72 20 62 6c 6f 63 6b 20 6e     .file or block n
+  802f30:	6f 74 20 66 6f 75 6e 64 00 69 6e 76 61 6c 69 64     ot found.invalid
+  802f40:	20 70 61 74 68 00 66 69 6c 65 20 61 6c 72 65 61      path.file alrea
+  802f50:	64 79 20 65 78 69 73 74 73 00 6f 70 65 72 61 74     dy exists.operat
+  802f60:	69 6f 6e 20 6e 6f 74 20 73 75 70 70 6f 72 74 65     ion not supporte
+  802f70:	64 00 6f 70 65 72 61 74 69 6f 6e 20 69 6e 74 65     d.operation inte
+  802f80:	72 72 75 70 74 65 64 00 6e 6f 74 20 65 6e 6f 75     rrupted.not enou
+  802f90:	67 68 20 43 50 55 20 74 69 6d 65 00 0f 1f 40 00     gh CPU time...@.
+  802fa0:	54 1f 80 00 00 00 00 00 95 25 80 00 00 00 00 00     T........%......
+  802fb0:	85 25 80 00 00 00 00 00 95 25 80 00 00 00 00 00     .%.......%......
+  802fc0:	95 25 80 00 00 00 00 00 95 25 80 00 00 00 00 00     .%.......%......
+  802fd0:	95 25 80 00 00 00 00 00 73 1f 80 00 00 00 00 00     .%......s.......
+  802fe0:	95 25 80 00 00 00 00 00 95 25 80 00 00 00 00 00     .%.......%......
+  802ff0:	67 1f 80 00 00 00 00 00 e1 1f 80 00 00 00 00 00     g...............
+  803000:	95 25 80 00 00 00 00 00 67 1f 80 00 00 00 00 00     .%......g.......
+  803010:	ad 1f 80 00 00 00 00 00 ad 1f 80 00 00 00 00 00     ................
+  803020:	ad 1f 80 00 00 00 00 00 ad 1f 80 00 00 00 00 00     ................
+  803030:	ad 1f 80 00 00 00 00 00 ad 1f 80 00 00 00 00 00     ................
+  803040:	ad 1f 80 00 00 00 00 00 ad 1f 80 00 00 00 00 00     ................
+  803050:	ad 1f 80 00 00 00 00 00 95 25 80 00 00 00 00 00     .........%......
+  803060:	95 25 80 00 00 00 00 00 95 25 80 00 00 00 00 00     .%.......%......
+  803070:	95 25 80 00 00 00 00 00 95 25 80 00 00 00 00 00     .%.......%......
+  803080:	95 25 80 00 00 00 00 00 95 25 80 00 00 00 00 00     .%.......%......
+  803090:	95 25 80 00 00 00 00 00 95 25 80 00 00 00 00 00     .%.......%......
+  8030a0:	95 25 80 00 00 00 00 00 95 25 80 00 00 00 00 00     .%.......%......
+  8030b0:	95 25 80 00 00 00 00 00 95 25 80 00 00 00 00 00     .%.......%......
+  8030c0:	95 25 80 00 00 00 00 00 95 25 80 00 00 00 00 00     .%.......%......
+  8030d0:	95 25 80 00 00 00 00 00 95 25 80 00 00 00 00 00     .%.......%......
+  8030e0:	95 25 80 00 00 00 00 00 95 25 80 00 00 00 00 00     .%.......%......
+  8030f0:	95 25 80 00 00 00 00 00 95 25 80 00 00 00 00 00     .%.......%......
+  803100:	95 25 80 00 00 00 00 00 95 25 80 00 00 00 00 00     .%.......%......
+  803110:	95 25 80 00 00 00 00 00 95 25 80 00 00 00 00 00     .%.......%......
+  803120:	95 25 80 00 00 00 00 00 95 25 80 00 00 00 00 00     .%.......%......
+  803130:	95 25 80 00 00 00 00 00 95 25 80 00 00 00 00 00     .%.......%......
+  803140:	95 25 80 00 00 00 00 00 b8 24 80 00 00 00 00 00     .%.......$......
+  803150:	95 25 80 00 00 00 00 00 95 25 80 00 00 00 00 00     .%.......%......
+  803160:	95 25 80 00 00 00 00 00 95 25 80 00 00 00 00 00     .%.......%......
+  803170:	95 25 80 00 00 00 00 00 95 25 80 00 00 00 00 00     .%.......%......
+  803180:	95 25 80 00 00 00 00 00 95 25 80 00 00 00 00 00     .%.......%......
+  803190:	95 25 80 00 00 00 00 00 95 25 80 00 00 00 00 00     .%.......%......
+  8031a0:	04 20 80 00 00 00 00 00 d3 21 80 00 00 00 00 00     . .......!......
+  8031b0:	95 25 80 00 00 00 00 00 95 25 80 00 00 00 00 00     .%.......%......
+  8031c0:	95 25 80 00 00 00 00 00 95 25 80 00 00 00 00 00     .%.......%......
+  8031d0:	33 20 80 00 00 00 00 00 95 25 80 00 00 00 00 00     3 .......%......
+  8031e0:	95 25 80 00 00 00 00 00 f9 1f 80 00 00 00 00 00     .%..............
+  8031f0:	95 25 80 00 00 00 00 00 95 25 80 00 00 00 00 00     .%.......%......
+  803200:	7b 23 80 00 00 00 00 00 45 24 80 00 00 00 00 00     {#......E$......
+  803210:	95 25 80 00 00 00 00 00 95 25 80 00 00 00 00 00     .%.......%......
+  803220:	ca 20 80 00 00 00 00 00 95 25 80 00 00 00 00 00     . .......%......
+  803230:	a7 22 80 00 00 00 00 00 95 25 80 00 00 00 00 00     .".......%......
+  803240:	95 25 80 00 00 00 00 00 b8 24 80 00 00 00 00 00     .%.......$......
+  803250:	95 25 80 00 00 00 00 00 5d 1f 80 00 00 00 00 00     .%......].......
+
+0000000000803260 <error_string>:
+	...
+  803268:	15 2e 80 00 00 00 00 00 27 2e 80 00 00 00 00 00     ........'.......
+  803278:	37 2e 80 00 00 00 00 00 49 2e 80 00 00 00 00 00     7.......I.......
+  803288:	57 2e 80 00 00 00 00 00 6b 2e 80 00 00 00 00 00     W.......k.......
+  803298:	80 2e 80 00 00 00 00 00 93 2e 80 00 00 00 00 00     ................
+  8032a8:	a5 2e 80 00 00 00 00 00 b9 2e 80 00 00 00 00 00     ................
+  8032b8:	c9 2e 80 00 00 00 00 00 dc 2e 80 00 00 00 00 00     ................
+  8032c8:	f3 2e 80 00 00 00 00 00 09 2f 80 00 00 00 00 00     ........./......
+  8032d8:	21 2f 80 00 00 00 00 00 39 2f 80 00 00 00 00 00     !/......9/......
+  8032e8:	46 2f 80 00 00 00 00 00 10 33 80 00 00 00 00 00     F/.......3......
+  8032f8:	5a 2f 80 00 00 00 00 00 72 2f 80 00 00 00 00 00     Z/......r/......
+  803308:	88 2f 80 00 00 00 00 00 66 69 6c 65 20 69 73 20     ./......file is 
+  803318:	6e 6f 74 20 61 20 76 61 6c 69 64 20 65 78 65 63     not a valid exec
+  803328:	75 74 61 62 6c 65 00 73 79 73 5f 69 70 63 5f 74     utable.sys_ipc_t
+  803338:	72 79 5f 73 65 6e 64 20 66 61 69 6c 65 64 3a 20     ry_send failed: 
+  803348:	25 69 00 6c 69 62 2f 69 70 63 2e 63 00 66 2e 0f     %i.lib/ipc.c.f..
+  803358:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803368:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803378:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803388:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803398:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8033a8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8033b8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8033c8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8033d8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8033e8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8033f8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803408:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803418:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803428:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803438:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803448:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803458:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803468:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803478:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803488:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803498:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8034a8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8034b8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8034c8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8034d8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8034e8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8034f8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803508:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803518:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803528:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803538:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803548:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803558:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803568:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803578:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803588:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803598:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8035a8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8035b8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8035c8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8035d8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8035e8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8035f8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803608:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803618:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803628:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803638:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803648:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803658:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803668:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803678:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803688:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803698:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8036a8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8036b8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8036c8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8036d8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8036e8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8036f8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803708:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803718:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803728:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803738:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803748:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803758:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803768:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803778:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803788:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803798:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8037a8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8037b8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8037c8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8037d8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8037e8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8037f8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803808:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803818:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803828:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803838:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803848:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803858:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803868:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803878:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803888:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803898:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8038a8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8038b8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8038c8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8038d8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8038e8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8038f8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803908:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803918:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803928:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803938:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803948:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803958:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803968:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803978:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803988:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803998:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8039a8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8039b8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8039c8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8039d8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8039e8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8039f8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803a08:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803a18:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803a28:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803a38:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803a48:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803a58:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803a68:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803a78:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803a88:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803a98:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803aa8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803ab8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803ac8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803ad8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803ae8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803af8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803b08:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803b18:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803b28:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803b38:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803b48:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803b58:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803b68:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803b78:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803b88:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803b98:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803ba8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803bb8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803bc8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803bd8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803be8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803bf8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803c08:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803c18:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803c28:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803c38:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803c48:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803c58:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803c68:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803c78:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803c88:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803c98:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803ca8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803cb8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803cc8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803cd8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803ce8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803cf8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803d08:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803d18:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803d28:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803d38:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803d48:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803d58:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803d68:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803d78:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803d88:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803d98:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803da8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803db8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803dc8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803dd8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803de8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803df8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803e08:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803e18:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803e28:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803e38:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803e48:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803e58:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803e68:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803e78:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803e88:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803e98:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803ea8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803eb8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803ec8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803ed8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803ee8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803ef8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803f08:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803f18:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803f28:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803f38:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803f48:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803f58:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803f68:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803f78:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803f88:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803f98:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803fa8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803fb8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803fc8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803fd8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803fe8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803ff8:	00 00 00 00 00 0f 1f 00                             ........
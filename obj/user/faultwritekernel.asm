@@ -0,0 +1,5433 @@
+
+obj/user/faultwritekernel:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 13 00 00 00       	call   800036 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+    *(volatile unsigned *)0x8040000000 = 0;
+  800025:	48 b8 00 00 00 40 80 	movabs $0x8040000000,%rax
+  80002c:	00 00 00 
+  80002f:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+}
+  800035:	c3                   	ret
+
+0000000000800036 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800036:	55                   	push   %rbp
+  800037:	48 89 e5             	mov    %rsp,%rbp
+  80003a:	41 56                	push   %r14
+  80003c:	41 55                	push   %r13
+  80003e:	41 54                	push   %r12
+  800040:	53                   	push   %rbx
+  800041:	41 89 fd             	mov    %edi,%r13d
+  800044:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800047:	48 ba d8 40 80 00 00 	movabs $0x8040d8,%rdx
+  80004e:	00 00 00 
+  800051:	48 b8 d8 40 80 00 00 	movabs $0x8040d8,%rax
+  800058:	00 00 00 
+  80005b:	48 39 c2             	cmp    %rax,%rdx
+  80005e:	73 17                	jae    800077 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  800060:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  800063:	49 89 c4             	mov    %rax,%r12
+  800066:	48 83 c3 08          	add    $0x8,%rbx
+  80006a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80006f:	ff 53 f8             	call   *-0x8(%rbx)
+  800072:	4c 39 e3             	cmp    %r12,%rbx
+  800075:	72 ef                	jb     800066 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+    envid_t this_env_id = sys_getenvid();
+  800077:	48 b8 cb 01 80 00 00 	movabs $0x8001cb,%rax
+  80007e:	00 00 00 
+  800081:	ff d0                	call   *%rax
+    thisenv = &((struct Env*)UENVS)[ENVX(this_env_id)];
+  800083:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800088:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+  80008f:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  800096:	00 00 00 
+  800099:	48 01 d0             	add    %rdx,%rax
+  80009c:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  8000a3:	00 00 00 
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8000a6:	45 85 ed             	test   %r13d,%r13d
+  8000a9:	7e 0d                	jle    8000b8 <libmain+0x82>
+  8000ab:	49 8b 06             	mov    (%r14),%rax
+  8000ae:	48 a3 00 40 80 00 00 	movabs %rax,0x804000
+  8000b5:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8000b8:	4c 89 f6             	mov    %r14,%rsi
+  8000bb:	44 89 ef             	mov    %r13d,%edi
+  8000be:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8000c5:	00 00 00 
+  8000c8:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8000ca:	48 b8 df 00 80 00 00 	movabs $0x8000df,%rax
+  8000d1:	00 00 00 
+  8000d4:	ff d0                	call   *%rax
+#endif
+}
+  8000d6:	5b                   	pop    %rbx
+  8000d7:	41 5c                	pop    %r12
+  8000d9:	41 5d                	pop    %r13
+  8000db:	41 5e                	pop    %r14
+  8000dd:	5d                   	pop    %rbp
+  8000de:	c3                   	ret
+
+00000000008000df <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8000df:	55                   	push   %rbp
+  8000e0:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  8000e3:	48 b8 1f 09 80 00 00 	movabs $0x80091f,%rax
+  8000ea:	00 00 00 
+  8000ed:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  8000ef:	bf 00 00 00 00       	mov    $0x0,%edi
+  8000f4:	48 b8 60 01 80 00 00 	movabs $0x800160,%rax
+  8000fb:	00 00 00 
+  8000fe:	ff d0                	call   *%rax
+}
+  800100:	5d                   	pop    %rbp
+  800101:	c3                   	ret
+
+0000000000800102 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  800102:	55                   	push   %rbp
+  800103:	48 89 e5             	mov    %rsp,%rbp
+  800106:	53                   	push   %rbx
+  800107:	48 89 fa             	mov    %rdi,%rdx
+  80010a:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80010d:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800112:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800117:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80011c:	be 00 00 00 00       	mov    $0x0,%esi
+  800121:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800127:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  800129:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80012d:	c9                   	leave
+  80012e:	c3                   	ret
+
+000000000080012f <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  80012f:	55                   	push   %rbp
+  800130:	48 89 e5             	mov    %rsp,%rbp
+  800133:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  800134:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800139:	ba 00 00 00 00       	mov    $0x0,%edx
+  80013e:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800143:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800148:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80014d:	be 00 00 00 00       	mov    $0x0,%esi
+  800152:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800158:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  80015a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80015e:	c9                   	leave
+  80015f:	c3                   	ret
+
+0000000000800160 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  800160:	55                   	push   %rbp
+  800161:	48 89 e5             	mov    %rsp,%rbp
+  800164:	53                   	push   %rbx
+  800165:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  800169:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80016c:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800171:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800176:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80017b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800180:	be 00 00 00 00       	mov    $0x0,%esi
+  800185:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80018b:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80018d:	48 85 c0             	test   %rax,%rax
+  800190:	7f 06                	jg     800198 <sys_env_destroy+0x38>
+}
+  800192:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800196:	c9                   	leave
+  800197:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800198:	49 89 c0             	mov    %rax,%r8
+  80019b:	b9 03 00 00 00       	mov    $0x3,%ecx
+  8001a0:	48 ba 90 2c 80 00 00 	movabs $0x802c90,%rdx
+  8001a7:	00 00 00 
+  8001aa:	be 26 00 00 00       	mov    $0x26,%esi
+  8001af:	48 bf af 2c 80 00 00 	movabs $0x802caf,%rdi
+  8001b6:	00 00 00 
+  8001b9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001be:	49 b9 1c 1c 80 00 00 	movabs $0x801c1c,%r9
+  8001c5:	00 00 00 
+  8001c8:	41 ff d1             	call   *%r9
+
+00000000008001cb <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  8001cb:	55                   	push   %rbp
+  8001cc:	48 89 e5             	mov    %rsp,%rbp
+  8001cf:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8001d0:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8001d5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8001da:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8001df:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8001e4:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8001e9:	be 00 00 00 00       	mov    $0x0,%esi
+  8001ee:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8001f4:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  8001f6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8001fa:	c9                   	leave
+  8001fb:	c3                   	ret
+
+00000000008001fc <sys_yield>:
+
+void
+sys_yield(void) {
+  8001fc:	55                   	push   %rbp
+  8001fd:	48 89 e5             	mov    %rsp,%rbp
+  800200:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  800201:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800206:	ba 00 00 00 00       	mov    $0x0,%edx
+  80020b:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800210:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800215:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80021a:	be 00 00 00 00       	mov    $0x0,%esi
+  80021f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800225:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  800227:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80022b:	c9                   	leave
+  80022c:	c3                   	ret
+
+000000000080022d <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  80022d:	55                   	push   %rbp
+  80022e:	48 89 e5             	mov    %rsp,%rbp
+  800231:	53                   	push   %rbx
+  800232:	48 89 fa             	mov    %rdi,%rdx
+  800235:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  800238:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80023d:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  800244:	00 00 00 
+  800247:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80024c:	be 00 00 00 00       	mov    $0x0,%esi
+  800251:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800257:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  800259:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80025d:	c9                   	leave
+  80025e:	c3                   	ret
+
+000000000080025f <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  80025f:	55                   	push   %rbp
+  800260:	48 89 e5             	mov    %rsp,%rbp
+  800263:	53                   	push   %rbx
+  800264:	49 89 f8             	mov    %rdi,%r8
+  800267:	48 89 d3             	mov    %rdx,%rbx
+  80026a:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80026d:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800272:	4c 89 c2             	mov    %r8,%rdx
+  800275:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800278:	be 00 00 00 00       	mov    $0x0,%esi
+  80027d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800283:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  800285:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800289:	c9                   	leave
+  80028a:	c3                   	ret
+
+000000000080028b <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  80028b:	55                   	push   %rbp
+  80028c:	48 89 e5             	mov    %rsp,%rbp
+  80028f:	53                   	push   %rbx
+  800290:	48 83 ec 08          	sub    $0x8,%rsp
+  800294:	89 f8                	mov    %edi,%eax
+  800296:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  800299:	48 63 f9             	movslq %ecx,%rdi
+  80029c:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80029f:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8002a4:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8002a7:	be 00 00 00 00       	mov    $0x0,%esi
+  8002ac:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8002b2:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8002b4:	48 85 c0             	test   %rax,%rax
+  8002b7:	7f 06                	jg     8002bf <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  8002b9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8002bd:	c9                   	leave
+  8002be:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8002bf:	49 89 c0             	mov    %rax,%r8
+  8002c2:	b9 04 00 00 00       	mov    $0x4,%ecx
+  8002c7:	48 ba 90 2c 80 00 00 	movabs $0x802c90,%rdx
+  8002ce:	00 00 00 
+  8002d1:	be 26 00 00 00       	mov    $0x26,%esi
+  8002d6:	48 bf af 2c 80 00 00 	movabs $0x802caf,%rdi
+  8002dd:	00 00 00 
+  8002e0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002e5:	49 b9 1c 1c 80 00 00 	movabs $0x801c1c,%r9
+  8002ec:	00 00 00 
+  8002ef:	41 ff d1             	call   *%r9
+
+00000000008002f2 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8002f2:	55                   	push   %rbp
+  8002f3:	48 89 e5             	mov    %rsp,%rbp
+  8002f6:	53                   	push   %rbx
+  8002f7:	48 83 ec 08          	sub    $0x8,%rsp
+  8002fb:	89 f8                	mov    %edi,%eax
+  8002fd:	49 89 f2             	mov    %rsi,%r10
+  800300:	48 89 cf             	mov    %rcx,%rdi
+  800303:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  800306:	48 63 da             	movslq %edx,%rbx
+  800309:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80030c:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800311:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800314:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  800317:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800319:	48 85 c0             	test   %rax,%rax
+  80031c:	7f 06                	jg     800324 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  80031e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800322:	c9                   	leave
+  800323:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800324:	49 89 c0             	mov    %rax,%r8
+  800327:	b9 05 00 00 00       	mov    $0x5,%ecx
+  80032c:	48 ba 90 2c 80 00 00 	movabs $0x802c90,%rdx
+  800333:	00 00 00 
+  800336:	be 26 00 00 00       	mov    $0x26,%esi
+  80033b:	48 bf af 2c 80 00 00 	movabs $0x802caf,%rdi
+  800342:	00 00 00 
+  800345:	b8 00 00 00 00       	mov    $0x0,%eax
+  80034a:	49 b9 1c 1c 80 00 00 	movabs $0x801c1c,%r9
+  800351:	00 00 00 
+  800354:	41 ff d1             	call   *%r9
+
+0000000000800357 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  800357:	55                   	push   %rbp
+  800358:	48 89 e5             	mov    %rsp,%rbp
+  80035b:	53                   	push   %rbx
+  80035c:	48 83 ec 08          	sub    $0x8,%rsp
+  800360:	48 89 f1             	mov    %rsi,%rcx
+  800363:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  800366:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800369:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80036e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800373:	be 00 00 00 00       	mov    $0x0,%esi
+  800378:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80037e:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800380:	48 85 c0             	test   %rax,%rax
+  800383:	7f 06                	jg     80038b <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  800385:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800389:	c9                   	leave
+  80038a:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80038b:	49 89 c0             	mov    %rax,%r8
+  80038e:	b9 06 00 00 00       	mov    $0x6,%ecx
+  800393:	48 ba 90 2c 80 00 00 	movabs $0x802c90,%rdx
+  80039a:	00 00 00 
+  80039d:	be 26 00 00 00       	mov    $0x26,%esi
+  8003a2:	48 bf af 2c 80 00 00 	movabs $0x802caf,%rdi
+  8003a9:	00 00 00 
+  8003ac:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003b1:	49 b9 1c 1c 80 00 00 	movabs $0x801c1c,%r9
+  8003b8:	00 00 00 
+  8003bb:	41 ff d1             	call   *%r9
+
+00000000008003be <sys_region_batch>:
+
+int
+sys_region_batch(const struct RegionOp *ops, size_t count) {
+  8003be:	55                   	push   %rbp
+  8003bf:	48 89 e5             	mov    %rsp,%rbp
+  8003c2:	53                   	push   %rbx
+  8003c3:	48 83 ec 08          	sub    $0x8,%rsp
+  8003c7:	48 89 fa             	mov    %rdi,%rdx
+  8003ca:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8003cd:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8003d2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8003d7:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8003dc:	be 00 00 00 00       	mov    $0x0,%esi
+  8003e1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8003e7:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8003e9:	48 85 c0             	test   %rax,%rax
+  8003ec:	7f 06                	jg     8003f4 <sys_region_batch+0x36>
+        else
+            platform_asan_unpoison(va, ops[i].size);
+    }
+#endif
+    return res;
+}
+  8003ee:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8003f2:	c9                   	leave
+  8003f3:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8003f4:	49 89 c0             	mov    %rax,%r8
+  8003f7:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  8003fc:	48 ba 90 2c 80 00 00 	movabs $0x802c90,%rdx
+  800403:	00 00 00 
+  800406:	be 26 00 00 00       	mov    $0x26,%esi
+  80040b:	48 bf af 2c 80 00 00 	movabs $0x802caf,%rdi
+  800412:	00 00 00 
+  800415:	b8 00 00 00 00       	mov    $0x0,%eax
+  80041a:	49 b9 1c 1c 80 00 00 	movabs $0x801c1c,%r9
+  800421:	00 00 00 
+  800424:	41 ff d1             	call   *%r9
+
+0000000000800427 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  800427:	55                   	push   %rbp
+  800428:	48 89 e5             	mov    %rsp,%rbp
+  80042b:	53                   	push   %rbx
+  80042c:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  800430:	48 63 ce             	movslq %esi,%rcx
+  800433:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800436:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80043b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800440:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800445:	be 00 00 00 00       	mov    $0x0,%esi
+  80044a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800450:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800452:	48 85 c0             	test   %rax,%rax
+  800455:	7f 06                	jg     80045d <sys_env_set_status+0x36>
+}
+  800457:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80045b:	c9                   	leave
+  80045c:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80045d:	49 89 c0             	mov    %rax,%r8
+  800460:	b9 09 00 00 00       	mov    $0x9,%ecx
+  800465:	48 ba 90 2c 80 00 00 	movabs $0x802c90,%rdx
+  80046c:	00 00 00 
+  80046f:	be 26 00 00 00       	mov    $0x26,%esi
+  800474:	48 bf af 2c 80 00 00 	movabs $0x802caf,%rdi
+  80047b:	00 00 00 
+  80047e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800483:	49 b9 1c 1c 80 00 00 	movabs $0x801c1c,%r9
+  80048a:	00 00 00 
+  80048d:	41 ff d1             	call   *%r9
+
+0000000000800490 <sys_env_set_weight>:
+
+int
+sys_env_set_weight(envid_t envid, uint32_t weight) {
+  800490:	55                   	push   %rbp
+  800491:	48 89 e5             	mov    %rsp,%rbp
+  800494:	53                   	push   %rbx
+  800495:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_weight, 1, envid, weight, 0, 0, 0, 0);
+  800499:	89 f1                	mov    %esi,%ecx
+  80049b:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80049e:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8004a3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8004a8:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8004ad:	be 00 00 00 00       	mov    $0x0,%esi
+  8004b2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8004b8:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8004ba:	48 85 c0             	test   %rax,%rax
+  8004bd:	7f 06                	jg     8004c5 <sys_env_set_weight+0x35>
+}
+  8004bf:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8004c3:	c9                   	leave
+  8004c4:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8004c5:	49 89 c0             	mov    %rax,%r8
+  8004c8:	b9 10 00 00 00       	mov    $0x10,%ecx
+  8004cd:	48 ba 90 2c 80 00 00 	movabs $0x802c90,%rdx
+  8004d4:	00 00 00 
+  8004d7:	be 26 00 00 00       	mov    $0x26,%esi
+  8004dc:	48 bf af 2c 80 00 00 	movabs $0x802caf,%rdi
+  8004e3:	00 00 00 
+  8004e6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004eb:	49 b9 1c 1c 80 00 00 	movabs $0x801c1c,%r9
+  8004f2:	00 00 00 
+  8004f5:	41 ff d1             	call   *%r9
+
+00000000008004f8 <sys_env_set_rt>:
+
+int
+sys_env_set_rt(envid_t envid, uint64_t period, uint64_t budget, uint64_t deadline) {
+  8004f8:	55                   	push   %rbp
+  8004f9:	48 89 e5             	mov    %rsp,%rbp
+  8004fc:	53                   	push   %rbx
+  8004fd:	48 83 ec 08          	sub    $0x8,%rsp
+  800501:	89 f8                	mov    %edi,%eax
+  800503:	48 89 d3             	mov    %rdx,%rbx
+  800506:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_env_set_rt, 1, envid, period, budget, deadline, 0, 0);
+  800509:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80050c:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800511:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800514:	be 00 00 00 00       	mov    $0x0,%esi
+  800519:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80051f:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800521:	48 85 c0             	test   %rax,%rax
+  800524:	7f 06                	jg     80052c <sys_env_set_rt+0x34>
+}
+  800526:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80052a:	c9                   	leave
+  80052b:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80052c:	49 89 c0             	mov    %rax,%r8
+  80052f:	b9 11 00 00 00       	mov    $0x11,%ecx
+  800534:	48 ba 90 2c 80 00 00 	movabs $0x802c90,%rdx
+  80053b:	00 00 00 
+  80053e:	be 26 00 00 00       	mov    $0x26,%esi
+  800543:	48 bf af 2c 80 00 00 	movabs $0x802caf,%rdi
+  80054a:	00 00 00 
+  80054d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800552:	49 b9 1c 1c 80 00 00 	movabs $0x801c1c,%r9
+  800559:	00 00 00 
+  80055c:	41 ff d1             	call   *%r9
+
+000000000080055f <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  80055f:	55                   	push   %rbp
+  800560:	48 89 e5             	mov    %rsp,%rbp
+  800563:	53                   	push   %rbx
+  800564:	48 83 ec 08          	sub    $0x8,%rsp
+  800568:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  80056b:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80056e:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800573:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800578:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80057d:	be 00 00 00 00       	mov    $0x0,%esi
+  800582:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800588:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80058a:	48 85 c0             	test   %rax,%rax
+  80058d:	7f 06                	jg     800595 <sys_env_set_trapframe+0x36>
+}
+  80058f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800593:	c9                   	leave
+  800594:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800595:	49 89 c0             	mov    %rax,%r8
+  800598:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  80059d:	48 ba 90 2c 80 00 00 	movabs $0x802c90,%rdx
+  8005a4:	00 00 00 
+  8005a7:	be 26 00 00 00       	mov    $0x26,%esi
+  8005ac:	48 bf af 2c 80 00 00 	movabs $0x802caf,%rdi
+  8005b3:	00 00 00 
+  8005b6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005bb:	49 b9 1c 1c 80 00 00 	movabs $0x801c1c,%r9
+  8005c2:	00 00 00 
+  8005c5:	41 ff d1             	call   *%r9
+
+00000000008005c8 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  8005c8:	55                   	push   %rbp
+  8005c9:	48 89 e5             	mov    %rsp,%rbp
+  8005cc:	53                   	push   %rbx
+  8005cd:	48 83 ec 08          	sub    $0x8,%rsp
+  8005d1:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  8005d4:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8005d7:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8005dc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8005e1:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8005e6:	be 00 00 00 00       	mov    $0x0,%esi
+  8005eb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8005f1:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8005f3:	48 85 c0             	test   %rax,%rax
+  8005f6:	7f 06                	jg     8005fe <sys_env_set_pgfault_upcall+0x36>
+}
+  8005f8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8005fc:	c9                   	leave
+  8005fd:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8005fe:	49 89 c0             	mov    %rax,%r8
+  800601:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  800606:	48 ba 90 2c 80 00 00 	movabs $0x802c90,%rdx
+  80060d:	00 00 00 
+  800610:	be 26 00 00 00       	mov    $0x26,%esi
+  800615:	48 bf af 2c 80 00 00 	movabs $0x802caf,%rdi
+  80061c:	00 00 00 
+  80061f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800624:	49 b9 1c 1c 80 00 00 	movabs $0x801c1c,%r9
+  80062b:	00 00 00 
+  80062e:	41 ff d1             	call   *%r9
+
+0000000000800631 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  800631:	55                   	push   %rbp
+  800632:	48 89 e5             	mov    %rsp,%rbp
+  800635:	53                   	push   %rbx
+  800636:	89 f8                	mov    %edi,%eax
+  800638:	49 89 f1             	mov    %rsi,%r9
+  80063b:	48 89 d3             	mov    %rdx,%rbx
+  80063e:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  800641:	49 63 f0             	movslq %r8d,%rsi
+  800644:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800647:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80064c:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80064f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800655:	cd 30                	int    $0x30
+}
+  800657:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80065b:	c9                   	leave
+  80065c:	c3                   	ret
+
+000000000080065d <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  80065d:	55                   	push   %rbp
+  80065e:	48 89 e5             	mov    %rsp,%rbp
+  800661:	53                   	push   %rbx
+  800662:	48 83 ec 08          	sub    $0x8,%rsp
+  800666:	48 89 fa             	mov    %rdi,%rdx
+  800669:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80066c:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800671:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800676:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80067b:	be 00 00 00 00       	mov    $0x0,%esi
+  800680:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800686:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800688:	48 85 c0             	test   %rax,%rax
+  80068b:	7f 06                	jg     800693 <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  80068d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800691:	c9                   	leave
+  800692:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800693:	49 89 c0             	mov    %rax,%r8
+  800696:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  80069b:	48 ba 90 2c 80 00 00 	movabs $0x802c90,%rdx
+  8006a2:	00 00 00 
+  8006a5:	be 26 00 00 00       	mov    $0x26,%esi
+  8006aa:	48 bf af 2c 80 00 00 	movabs $0x802caf,%rdi
+  8006b1:	00 00 00 
+  8006b4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006b9:	49 b9 1c 1c 80 00 00 	movabs $0x801c1c,%r9
+  8006c0:	00 00 00 
+  8006c3:	41 ff d1             	call   *%r9
+
+00000000008006c6 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8006c6:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8006cd:	ff ff ff 
+  8006d0:	48 01 f8             	add    %rdi,%rax
+  8006d3:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  8006d7:	c3                   	ret
+
+00000000008006d8 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8006d8:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8006df:	ff ff ff 
+  8006e2:	48 01 f8             	add    %rdi,%rax
+  8006e5:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  8006e9:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  8006ef:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  8006f3:	c3                   	ret
+
+00000000008006f4 <fd_alloc_from>:
+}
+
+/* Like fd_alloc(), but only considers fds starting from fdnum,
+ * so that several fds can be found before their pages are allocated */
+int
+fd_alloc_from(int fdnum, struct Fd **fd_store) {
+  8006f4:	55                   	push   %rbp
+  8006f5:	48 89 e5             	mov    %rsp,%rbp
+  8006f8:	41 57                	push   %r15
+  8006fa:	41 56                	push   %r14
+  8006fc:	41 55                	push   %r13
+  8006fe:	41 54                	push   %r12
+  800700:	53                   	push   %rbx
+  800701:	48 83 ec 08          	sub    $0x8,%rsp
+  800705:	49 89 f7             	mov    %rsi,%r15
+    for (int i = MAX(fdnum, 0); i < MAXFD; i++) {
+  800708:	85 ff                	test   %edi,%edi
+  80070a:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  800710:	44 0f 49 e7          	cmovns %edi,%r12d
+  800714:	83 ff 1f             	cmp    $0x1f,%edi
+  800717:	7f 37                	jg     800750 <fd_alloc_from+0x5c>
+  800719:	49 63 dc             	movslq %r12d,%rbx
+  80071c:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  800723:	48 c1 e3 0c          	shl    $0xc,%rbx
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  800727:	49 be fd 17 80 00 00 	movabs $0x8017fd,%r14
+  80072e:	00 00 00 
+        struct Fd *fd = INDEX2FD(i);
+  800731:	49 89 dd             	mov    %rbx,%r13
+        if (!(get_prot(fd) & PROT_R)) {
+  800734:	48 89 df             	mov    %rbx,%rdi
+  800737:	41 ff d6             	call   *%r14
+  80073a:	83 e0 04             	and    $0x4,%eax
+  80073d:	74 1c                	je     80075b <fd_alloc_from+0x67>
+    for (int i = MAX(fdnum, 0); i < MAXFD; i++) {
+  80073f:	41 83 c4 01          	add    $0x1,%r12d
+  800743:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  80074a:	41 83 fc 1f          	cmp    $0x1f,%r12d
+  80074e:	7e e1                	jle    800731 <fd_alloc_from+0x3d>
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  800750:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  800756:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  80075b:	4d 89 2f             	mov    %r13,(%r15)
+}
+  80075e:	48 83 c4 08          	add    $0x8,%rsp
+  800762:	5b                   	pop    %rbx
+  800763:	41 5c                	pop    %r12
+  800765:	41 5d                	pop    %r13
+  800767:	41 5e                	pop    %r14
+  800769:	41 5f                	pop    %r15
+  80076b:	5d                   	pop    %rbp
+  80076c:	c3                   	ret
+
+000000000080076d <fd_alloc>:
+fd_alloc(struct Fd **fd_store) {
+  80076d:	55                   	push   %rbp
+  80076e:	48 89 e5             	mov    %rsp,%rbp
+  800771:	48 89 fe             	mov    %rdi,%rsi
+    return fd_alloc_from(0, fd_store);
+  800774:	bf 00 00 00 00       	mov    $0x0,%edi
+  800779:	48 b8 f4 06 80 00 00 	movabs $0x8006f4,%rax
+  800780:	00 00 00 
+  800783:	ff d0                	call   *%rax
+}
+  800785:	5d                   	pop    %rbp
+  800786:	c3                   	ret
+
+0000000000800787 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  800787:	83 ff 1f             	cmp    $0x1f,%edi
+  80078a:	77 39                	ja     8007c5 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  80078c:	55                   	push   %rbp
+  80078d:	48 89 e5             	mov    %rsp,%rbp
+  800790:	41 54                	push   %r12
+  800792:	53                   	push   %rbx
+  800793:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  800796:	48 63 df             	movslq %edi,%rbx
+  800799:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  8007a0:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  8007a4:	48 89 df             	mov    %rbx,%rdi
+  8007a7:	48 b8 fd 17 80 00 00 	movabs $0x8017fd,%rax
+  8007ae:	00 00 00 
+  8007b1:	ff d0                	call   *%rax
+  8007b3:	a8 04                	test   $0x4,%al
+  8007b5:	74 14                	je     8007cb <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  8007b7:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  8007bb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8007c0:	5b                   	pop    %rbx
+  8007c1:	41 5c                	pop    %r12
+  8007c3:	5d                   	pop    %rbp
+  8007c4:	c3                   	ret
+        return -E_INVAL;
+  8007c5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8007ca:	c3                   	ret
+        return -E_INVAL;
+  8007cb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8007d0:	eb ee                	jmp    8007c0 <fd_lookup+0x39>
+
+00000000008007d2 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  8007d2:	55                   	push   %rbp
+  8007d3:	48 89 e5             	mov    %rsp,%rbp
+  8007d6:	41 54                	push   %r12
+  8007d8:	53                   	push   %rbx
+  8007d9:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  8007dc:	48 b8 40 2d 80 00 00 	movabs $0x802d40,%rax
+  8007e3:	00 00 00 
+  8007e6:	48 bb 20 40 80 00 00 	movabs $0x804020,%rbx
+  8007ed:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  8007f0:	39 3b                	cmp    %edi,(%rbx)
+  8007f2:	74 47                	je     80083b <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  8007f4:	48 83 c0 08          	add    $0x8,%rax
+  8007f8:	48 8b 18             	mov    (%rax),%rbx
+  8007fb:	48 85 db             	test   %rbx,%rbx
+  8007fe:	75 f0                	jne    8007f0 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  800800:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  800807:	00 00 00 
+  80080a:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+  800810:	89 fa                	mov    %edi,%edx
+  800812:	48 bf c0 2c 80 00 00 	movabs $0x802cc0,%rdi
+  800819:	00 00 00 
+  80081c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800821:	48 b9 6c 1d 80 00 00 	movabs $0x801d6c,%rcx
+  800828:	00 00 00 
+  80082b:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  80082d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  800832:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  800836:	5b                   	pop    %rbx
+  800837:	41 5c                	pop    %r12
+  800839:	5d                   	pop    %rbp
+  80083a:	c3                   	ret
+            return 0;
+  80083b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800840:	eb f0                	jmp    800832 <dev_lookup+0x60>
+
+0000000000800842 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  800842:	55                   	push   %rbp
+  800843:	48 89 e5             	mov    %rsp,%rbp
+  800846:	41 55                	push   %r13
+  800848:	41 54                	push   %r12
+  80084a:	53                   	push   %rbx
+  80084b:	48 83 ec 18          	sub    $0x18,%rsp
+  80084f:	48 89 fb             	mov    %rdi,%rbx
+  800852:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  800855:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  80085c:	ff ff ff 
+  80085f:	48 01 df             	add    %rbx,%rdi
+  800862:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  800866:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80086a:	48 b8 87 07 80 00 00 	movabs $0x800787,%rax
+  800871:	00 00 00 
+  800874:	ff d0                	call   *%rax
+  800876:	41 89 c5             	mov    %eax,%r13d
+  800879:	85 c0                	test   %eax,%eax
+  80087b:	78 06                	js     800883 <fd_close+0x41>
+  80087d:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  800881:	74 1a                	je     80089d <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  800883:	45 84 e4             	test   %r12b,%r12b
+  800886:	b8 00 00 00 00       	mov    $0x0,%eax
+  80088b:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  80088f:	44 89 e8             	mov    %r13d,%eax
+  800892:	48 83 c4 18          	add    $0x18,%rsp
+  800896:	5b                   	pop    %rbx
+  800897:	41 5c                	pop    %r12
+  800899:	41 5d                	pop    %r13
+  80089b:	5d                   	pop    %rbp
+  80089c:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  80089d:	8b 3b                	mov    (%rbx),%edi
+  80089f:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8008a3:	48 b8 d2 07 80 00 00 	movabs $0x8007d2,%rax
+  8008aa:	00 00 00 
+  8008ad:	ff d0                	call   *%rax
+  8008af:	41 89 c5             	mov    %eax,%r13d
+  8008b2:	85 c0                	test   %eax,%eax
+  8008b4:	78 1b                	js     8008d1 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  8008b6:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8008ba:	48 8b 40 20          	mov    0x20(%rax),%rax
+  8008be:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  8008c4:	48 85 c0             	test   %rax,%rax
+  8008c7:	74 08                	je     8008d1 <fd_close+0x8f>
+  8008c9:	48 89 df             	mov    %rbx,%rdi
+  8008cc:	ff d0                	call   *%rax
+  8008ce:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8008d1:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8008d6:	48 89 de             	mov    %rbx,%rsi
+  8008d9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8008de:	48 b8 57 03 80 00 00 	movabs $0x800357,%rax
+  8008e5:	00 00 00 
+  8008e8:	ff d0                	call   *%rax
+    return res;
+  8008ea:	eb a3                	jmp    80088f <fd_close+0x4d>
+
+00000000008008ec <close>:
+
+int
+close(int fdnum) {
+  8008ec:	55                   	push   %rbp
+  8008ed:	48 89 e5             	mov    %rsp,%rbp
+  8008f0:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  8008f4:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8008f8:	48 b8 87 07 80 00 00 	movabs $0x800787,%rax
+  8008ff:	00 00 00 
+  800902:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  800904:	85 c0                	test   %eax,%eax
+  800906:	78 15                	js     80091d <close+0x31>
+
+    return fd_close(fd, 1);
+  800908:	be 01 00 00 00       	mov    $0x1,%esi
+  80090d:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  800911:	48 b8 42 08 80 00 00 	movabs $0x800842,%rax
+  800918:	00 00 00 
+  80091b:	ff d0                	call   *%rax
+}
+  80091d:	c9                   	leave
+  80091e:	c3                   	ret
+
+000000000080091f <close_all>:
+
+void
+close_all(void) {
+  80091f:	55                   	push   %rbp
+  800920:	48 89 e5             	mov    %rsp,%rbp
+  800923:	41 54                	push   %r12
+  800925:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  800926:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80092b:	49 bc ec 08 80 00 00 	movabs $0x8008ec,%r12
+  800932:	00 00 00 
+  800935:	89 df                	mov    %ebx,%edi
+  800937:	41 ff d4             	call   *%r12
+  80093a:	83 c3 01             	add    $0x1,%ebx
+  80093d:	83 fb 20             	cmp    $0x20,%ebx
+  800940:	75 f3                	jne    800935 <close_all+0x16>
+}
+  800942:	5b                   	pop    %rbx
+  800943:	41 5c                	pop    %r12
+  800945:	5d                   	pop    %rbp
+  800946:	c3                   	ret
+
+0000000000800947 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  800947:	55                   	push   %rbp
+  800948:	48 89 e5             	mov    %rsp,%rbp
+  80094b:	41 57                	push   %r15
+  80094d:	41 56                	push   %r14
+  80094f:	41 55                	push   %r13
+  800951:	41 54                	push   %r12
+  800953:	53                   	push   %rbx
+  800954:	48 83 ec 18          	sub    $0x18,%rsp
+  800958:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  80095b:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  80095f:	48 b8 87 07 80 00 00 	movabs $0x800787,%rax
+  800966:	00 00 00 
+  800969:	ff d0                	call   *%rax
+  80096b:	89 c3                	mov    %eax,%ebx
+  80096d:	85 c0                	test   %eax,%eax
+  80096f:	0f 88 b8 00 00 00    	js     800a2d <dup+0xe6>
+    close(newfdnum);
+  800975:	44 89 e7             	mov    %r12d,%edi
+  800978:	48 b8 ec 08 80 00 00 	movabs $0x8008ec,%rax
+  80097f:	00 00 00 
+  800982:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  800984:	4d 63 ec             	movslq %r12d,%r13
+  800987:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  80098e:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  800992:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  800996:	4c 89 ff             	mov    %r15,%rdi
+  800999:	49 be d8 06 80 00 00 	movabs $0x8006d8,%r14
+  8009a0:	00 00 00 
+  8009a3:	41 ff d6             	call   *%r14
+  8009a6:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  8009a9:	4c 89 ef             	mov    %r13,%rdi
+  8009ac:	41 ff d6             	call   *%r14
+  8009af:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  8009b2:	48 89 df             	mov    %rbx,%rdi
+  8009b5:	48 b8 fd 17 80 00 00 	movabs $0x8017fd,%rax
+  8009bc:	00 00 00 
+  8009bf:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  8009c1:	a8 04                	test   $0x4,%al
+  8009c3:	74 2b                	je     8009f0 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  8009c5:	41 89 c1             	mov    %eax,%r9d
+  8009c8:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8009ce:	4c 89 f1             	mov    %r14,%rcx
+  8009d1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8009d6:	48 89 de             	mov    %rbx,%rsi
+  8009d9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8009de:	48 b8 f2 02 80 00 00 	movabs $0x8002f2,%rax
+  8009e5:	00 00 00 
+  8009e8:	ff d0                	call   *%rax
+  8009ea:	89 c3                	mov    %eax,%ebx
+  8009ec:	85 c0                	test   %eax,%eax
+  8009ee:	78 4e                	js     800a3e <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  8009f0:	4c 89 ff             	mov    %r15,%rdi
+  8009f3:	48 b8 fd 17 80 00 00 	movabs $0x8017fd,%rax
+  8009fa:	00 00 00 
+  8009fd:	ff d0                	call   *%rax
+  8009ff:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  800a02:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  800a08:	4c 89 e9             	mov    %r13,%rcx
+  800a0b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800a10:	4c 89 fe             	mov    %r15,%rsi
+  800a13:	bf 00 00 00 00       	mov    $0x0,%edi
+  800a18:	48 b8 f2 02 80 00 00 	movabs $0x8002f2,%rax
+  800a1f:	00 00 00 
+  800a22:	ff d0                	call   *%rax
+  800a24:	89 c3                	mov    %eax,%ebx
+  800a26:	85 c0                	test   %eax,%eax
+  800a28:	78 14                	js     800a3e <dup+0xf7>
+
+    return newfdnum;
+  800a2a:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  800a2d:	89 d8                	mov    %ebx,%eax
+  800a2f:	48 83 c4 18          	add    $0x18,%rsp
+  800a33:	5b                   	pop    %rbx
+  800a34:	41 5c                	pop    %r12
+  800a36:	41 5d                	pop    %r13
+  800a38:	41 5e                	pop    %r14
+  800a3a:	41 5f                	pop    %r15
+  800a3c:	5d                   	pop    %rbp
+  800a3d:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  800a3e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800a43:	4c 89 ee             	mov    %r13,%rsi
+  800a46:	bf 00 00 00 00       	mov    $0x0,%edi
+  800a4b:	49 bc 57 03 80 00 00 	movabs $0x800357,%r12
+  800a52:	00 00 00 
+  800a55:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  800a58:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800a5d:	4c 89 f6             	mov    %r14,%rsi
+  800a60:	bf 00 00 00 00       	mov    $0x0,%edi
+  800a65:	41 ff d4             	call   *%r12
+    return res;
+  800a68:	eb c3                	jmp    800a2d <dup+0xe6>
+
+0000000000800a6a <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  800a6a:	55                   	push   %rbp
+  800a6b:	48 89 e5             	mov    %rsp,%rbp
+  800a6e:	41 56                	push   %r14
+  800a70:	41 55                	push   %r13
+  800a72:	41 54                	push   %r12
+  800a74:	53                   	push   %rbx
+  800a75:	48 83 ec 10          	sub    $0x10,%rsp
+  800a79:	89 fb                	mov    %edi,%ebx
+  800a7b:	49 89 f4             	mov    %rsi,%r12
+  800a7e:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800a81:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800a85:	48 b8 87 07 80 00 00 	movabs $0x800787,%rax
+  800a8c:	00 00 00 
+  800a8f:	ff d0                	call   *%rax
+  800a91:	85 c0                	test   %eax,%eax
+  800a93:	78 4c                	js     800ae1 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800a95:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  800a99:	41 8b 3e             	mov    (%r14),%edi
+  800a9c:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800aa0:	48 b8 d2 07 80 00 00 	movabs $0x8007d2,%rax
+  800aa7:	00 00 00 
+  800aaa:	ff d0                	call   *%rax
+  800aac:	85 c0                	test   %eax,%eax
+  800aae:	78 35                	js     800ae5 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  800ab0:	41 8b 46 08          	mov    0x8(%r14),%eax
+  800ab4:	83 e0 03             	and    $0x3,%eax
+  800ab7:	83 f8 01             	cmp    $0x1,%eax
+  800aba:	74 2d                	je     800ae9 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  800abc:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800ac0:	48 8b 40 10          	mov    0x10(%rax),%rax
+  800ac4:	48 85 c0             	test   %rax,%rax
+  800ac7:	74 56                	je     800b1f <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  800ac9:	4c 89 ea             	mov    %r13,%rdx
+  800acc:	4c 89 e6             	mov    %r12,%rsi
+  800acf:	4c 89 f7             	mov    %r14,%rdi
+  800ad2:	ff d0                	call   *%rax
+}
+  800ad4:	48 83 c4 10          	add    $0x10,%rsp
+  800ad8:	5b                   	pop    %rbx
+  800ad9:	41 5c                	pop    %r12
+  800adb:	41 5d                	pop    %r13
+  800add:	41 5e                	pop    %r14
+  800adf:	5d                   	pop    %rbp
+  800ae0:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800ae1:	48 98                	cltq
+  800ae3:	eb ef                	jmp    800ad4 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800ae5:	48 98                	cltq
+  800ae7:	eb eb                	jmp    800ad4 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  800ae9:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  800af0:	00 00 00 
+  800af3:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+  800af9:	89 da                	mov    %ebx,%edx
+  800afb:	48 bf 01 2d 80 00 00 	movabs $0x802d01,%rdi
+  800b02:	00 00 00 
+  800b05:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b0a:	48 b9 6c 1d 80 00 00 	movabs $0x801d6c,%rcx
+  800b11:	00 00 00 
+  800b14:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  800b16:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  800b1d:	eb b5                	jmp    800ad4 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  800b1f:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  800b26:	eb ac                	jmp    800ad4 <read+0x6a>
+
+0000000000800b28 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  800b28:	55                   	push   %rbp
+  800b29:	48 89 e5             	mov    %rsp,%rbp
+  800b2c:	41 57                	push   %r15
+  800b2e:	41 56                	push   %r14
+  800b30:	41 55                	push   %r13
+  800b32:	41 54                	push   %r12
+  800b34:	53                   	push   %rbx
+  800b35:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  800b39:	48 85 d2             	test   %rdx,%rdx
+  800b3c:	74 54                	je     800b92 <readn+0x6a>
+  800b3e:	41 89 fd             	mov    %edi,%r13d
+  800b41:	49 89 f6             	mov    %rsi,%r14
+  800b44:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  800b47:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  800b4c:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  800b51:	49 bf 6a 0a 80 00 00 	movabs $0x800a6a,%r15
+  800b58:	00 00 00 
+  800b5b:	4c 89 e2             	mov    %r12,%rdx
+  800b5e:	48 29 f2             	sub    %rsi,%rdx
+  800b61:	4c 01 f6             	add    %r14,%rsi
+  800b64:	44 89 ef             	mov    %r13d,%edi
+  800b67:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  800b6a:	85 c0                	test   %eax,%eax
+  800b6c:	78 20                	js     800b8e <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  800b6e:	01 c3                	add    %eax,%ebx
+  800b70:	85 c0                	test   %eax,%eax
+  800b72:	74 08                	je     800b7c <readn+0x54>
+  800b74:	48 63 f3             	movslq %ebx,%rsi
+  800b77:	4c 39 e6             	cmp    %r12,%rsi
+  800b7a:	72 df                	jb     800b5b <readn+0x33>
+    }
+    return res;
+  800b7c:	48 63 c3             	movslq %ebx,%rax
+}
+  800b7f:	48 83 c4 08          	add    $0x8,%rsp
+  800b83:	5b                   	pop    %rbx
+  800b84:	41 5c                	pop    %r12
+  800b86:	41 5d                	pop    %r13
+  800b88:	41 5e                	pop    %r14
+  800b8a:	41 5f                	pop    %r15
+  800b8c:	5d                   	pop    %rbp
+  800b8d:	c3                   	ret
+        if (inc < 0) return inc;
+  800b8e:	48 98                	cltq
+  800b90:	eb ed                	jmp    800b7f <readn+0x57>
+    int inc = 1, res = 0;
+  800b92:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800b97:	eb e3                	jmp    800b7c <readn+0x54>
+
+0000000000800b99 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  800b99:	55                   	push   %rbp
+  800b9a:	48 89 e5             	mov    %rsp,%rbp
+  800b9d:	41 56                	push   %r14
+  800b9f:	41 55                	push   %r13
+  800ba1:	41 54                	push   %r12
+  800ba3:	53                   	push   %rbx
+  800ba4:	48 83 ec 10          	sub    $0x10,%rsp
+  800ba8:	89 fb                	mov    %edi,%ebx
+  800baa:	49 89 f4             	mov    %rsi,%r12
+  800bad:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800bb0:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800bb4:	48 b8 87 07 80 00 00 	movabs $0x800787,%rax
+  800bbb:	00 00 00 
+  800bbe:	ff d0                	call   *%rax
+  800bc0:	85 c0                	test   %eax,%eax
+  800bc2:	78 47                	js     800c0b <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800bc4:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  800bc8:	41 8b 3e             	mov    (%r14),%edi
+  800bcb:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800bcf:	48 b8 d2 07 80 00 00 	movabs $0x8007d2,%rax
+  800bd6:	00 00 00 
+  800bd9:	ff d0                	call   *%rax
+  800bdb:	85 c0                	test   %eax,%eax
+  800bdd:	78 30                	js     800c0f <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800bdf:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  800be4:	74 2d                	je     800c13 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  800be6:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800bea:	48 8b 40 18          	mov    0x18(%rax),%rax
+  800bee:	48 85 c0             	test   %rax,%rax
+  800bf1:	74 56                	je     800c49 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  800bf3:	4c 89 ea             	mov    %r13,%rdx
+  800bf6:	4c 89 e6             	mov    %r12,%rsi
+  800bf9:	4c 89 f7             	mov    %r14,%rdi
+  800bfc:	ff d0                	call   *%rax
+}
+  800bfe:	48 83 c4 10          	add    $0x10,%rsp
+  800c02:	5b                   	pop    %rbx
+  800c03:	41 5c                	pop    %r12
+  800c05:	41 5d                	pop    %r13
+  800c07:	41 5e                	pop    %r14
+  800c09:	5d                   	pop    %rbp
+  800c0a:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800c0b:	48 98                	cltq
+  800c0d:	eb ef                	jmp    800bfe <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800c0f:	48 98                	cltq
+  800c11:	eb eb                	jmp    800bfe <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  800c13:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  800c1a:	00 00 00 
+  800c1d:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+  800c23:	89 da                	mov    %ebx,%edx
+  800c25:	48 bf 1d 2d 80 00 00 	movabs $0x802d1d,%rdi
+  800c2c:	00 00 00 
+  800c2f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c34:	48 b9 6c 1d 80 00 00 	movabs $0x801d6c,%rcx
+  800c3b:	00 00 00 
+  800c3e:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  800c40:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  800c47:	eb b5                	jmp    800bfe <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  800c49:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  800c50:	eb ac                	jmp    800bfe <write+0x65>
+
+0000000000800c52 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  800c52:	55                   	push   %rbp
+  800c53:	48 89 e5             	mov    %rsp,%rbp
+  800c56:	53                   	push   %rbx
+  800c57:	48 83 ec 18          	sub    $0x18,%rsp
+  800c5b:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800c5d:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800c61:	48 b8 87 07 80 00 00 	movabs $0x800787,%rax
+  800c68:	00 00 00 
+  800c6b:	ff d0                	call   *%rax
+  800c6d:	85 c0                	test   %eax,%eax
+  800c6f:	78 0c                	js     800c7d <seek+0x2b>
+
+    fd->fd_offset = offset;
+  800c71:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800c75:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  800c78:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800c7d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800c81:	c9                   	leave
+  800c82:	c3                   	ret
+
+0000000000800c83 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  800c83:	55                   	push   %rbp
+  800c84:	48 89 e5             	mov    %rsp,%rbp
+  800c87:	41 55                	push   %r13
+  800c89:	41 54                	push   %r12
+  800c8b:	53                   	push   %rbx
+  800c8c:	48 83 ec 18          	sub    $0x18,%rsp
+  800c90:	89 fb                	mov    %edi,%ebx
+  800c92:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800c95:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800c99:	48 b8 87 07 80 00 00 	movabs $0x800787,%rax
+  800ca0:	00 00 00 
+  800ca3:	ff d0                	call   *%rax
+  800ca5:	85 c0                	test   %eax,%eax
+  800ca7:	78 38                	js     800ce1 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800ca9:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  800cad:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  800cb1:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800cb5:	48 b8 d2 07 80 00 00 	movabs $0x8007d2,%rax
+  800cbc:	00 00 00 
+  800cbf:	ff d0                	call   *%rax
+  800cc1:	85 c0                	test   %eax,%eax
+  800cc3:	78 1c                	js     800ce1 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800cc5:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  800cca:	74 20                	je     800cec <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  800ccc:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800cd0:	48 8b 40 30          	mov    0x30(%rax),%rax
+  800cd4:	48 85 c0             	test   %rax,%rax
+  800cd7:	74 47                	je     800d20 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  800cd9:	44 89 e6             	mov    %r12d,%esi
+  800cdc:	4c 89 ef             	mov    %r13,%rdi
+  800cdf:	ff d0                	call   *%rax
+}
+  800ce1:	48 83 c4 18          	add    $0x18,%rsp
+  800ce5:	5b                   	pop    %rbx
+  800ce6:	41 5c                	pop    %r12
+  800ce8:	41 5d                	pop    %r13
+  800cea:	5d                   	pop    %rbp
+  800ceb:	c3                   	ret
+                thisenv->env_id, fdnum);
+  800cec:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  800cf3:	00 00 00 
+  800cf6:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  800cfc:	89 da                	mov    %ebx,%edx
+  800cfe:	48 bf e0 2c 80 00 00 	movabs $0x802ce0,%rdi
+  800d05:	00 00 00 
+  800d08:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d0d:	48 b9 6c 1d 80 00 00 	movabs $0x801d6c,%rcx
+  800d14:	00 00 00 
+  800d17:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  800d19:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800d1e:	eb c1                	jmp    800ce1 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  800d20:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  800d25:	eb ba                	jmp    800ce1 <ftruncate+0x5e>
+
+0000000000800d27 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  800d27:	55                   	push   %rbp
+  800d28:	48 89 e5             	mov    %rsp,%rbp
+  800d2b:	41 54                	push   %r12
+  800d2d:	53                   	push   %rbx
+  800d2e:	48 83 ec 10          	sub    $0x10,%rsp
+  800d32:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800d35:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800d39:	48 b8 87 07 80 00 00 	movabs $0x800787,%rax
+  800d40:	00 00 00 
+  800d43:	ff d0                	call   *%rax
+  800d45:	85 c0                	test   %eax,%eax
+  800d47:	78 4e                	js     800d97 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800d49:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  800d4d:	41 8b 3c 24          	mov    (%r12),%edi
+  800d51:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  800d55:	48 b8 d2 07 80 00 00 	movabs $0x8007d2,%rax
+  800d5c:	00 00 00 
+  800d5f:	ff d0                	call   *%rax
+  800d61:	85 c0                	test   %eax,%eax
+  800d63:	78 32                	js     800d97 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  800d65:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800d69:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  800d6e:	74 30                	je     800da0 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  800d70:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  800d73:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  800d7a:	00 00 00 
+    stat->st_isdir = 0;
+  800d7d:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  800d84:	00 00 00 
+    stat->st_dev = dev;
+  800d87:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  800d8e:	48 89 de             	mov    %rbx,%rsi
+  800d91:	4c 89 e7             	mov    %r12,%rdi
+  800d94:	ff 50 28             	call   *0x28(%rax)
+}
+  800d97:	48 83 c4 10          	add    $0x10,%rsp
+  800d9b:	5b                   	pop    %rbx
+  800d9c:	41 5c                	pop    %r12
+  800d9e:	5d                   	pop    %rbp
+  800d9f:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  800da0:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  800da5:	eb f0                	jmp    800d97 <fstat+0x70>
+
+0000000000800da7 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  800da7:	55                   	push   %rbp
+  800da8:	48 89 e5             	mov    %rsp,%rbp
+  800dab:	41 54                	push   %r12
+  800dad:	53                   	push   %rbx
+  800dae:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  800db1:	be 00 00 00 00       	mov    $0x0,%esi
+  800db6:	48 b8 8a 11 80 00 00 	movabs $0x80118a,%rax
+  800dbd:	00 00 00 
+  800dc0:	ff d0                	call   *%rax
+  800dc2:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  800dc4:	85 c0                	test   %eax,%eax
+  800dc6:	78 25                	js     800ded <stat+0x46>
+
+    int res = fstat(fd, stat);
+  800dc8:	4c 89 e6             	mov    %r12,%rsi
+  800dcb:	89 c7                	mov    %eax,%edi
+  800dcd:	48 b8 27 0d 80 00 00 	movabs $0x800d27,%rax
+  800dd4:	00 00 00 
+  800dd7:	ff d0                	call   *%rax
+  800dd9:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  800ddc:	89 df                	mov    %ebx,%edi
+  800dde:	48 b8 ec 08 80 00 00 	movabs $0x8008ec,%rax
+  800de5:	00 00 00 
+  800de8:	ff d0                	call   *%rax
+
+    return res;
+  800dea:	44 89 e3             	mov    %r12d,%ebx
+}
+  800ded:	89 d8                	mov    %ebx,%eax
+  800def:	5b                   	pop    %rbx
+  800df0:	41 5c                	pop    %r12
+  800df2:	5d                   	pop    %rbp
+  800df3:	c3                   	ret
+
+0000000000800df4 <fsipc>:
+ * response may be written back to fsipcbuf.
+ * type: request code, passed as the simple integer IPC value.
+ * dstva: virtual address at which to receive reply page, 0 if none.
+ * Returns result from the file server. */
+static int
+fsipc(unsigned type, void *dstva) {
+  800df4:	55                   	push   %rbp
+  800df5:	48 89 e5             	mov    %rsp,%rbp
+  800df8:	41 54                	push   %r12
+  800dfa:	53                   	push   %rbx
+  800dfb:	48 83 ec 10          	sub    $0x10,%rsp
+  800dff:	41 89 fc             	mov    %edi,%r12d
+  800e02:	48 89 f3             	mov    %rsi,%rbx
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  800e05:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  800e0c:	00 00 00 
+  800e0f:	83 38 00             	cmpl   $0x0,(%rax)
+  800e12:	74 5e                	je     800e72 <fsipc+0x7e>
+    if (debug) {
+        cprintf("[%08x] fsipc %d %08x\n",
+                thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+    }
+
+    ipc_send(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW);
+  800e14:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  800e1a:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  800e1f:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  800e26:	00 00 00 
+  800e29:	44 89 e6             	mov    %r12d,%esi
+  800e2c:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  800e33:	00 00 00 
+  800e36:	8b 38                	mov    (%rax),%edi
+  800e38:	48 b8 8d 2b 80 00 00 	movabs $0x802b8d,%rax
+  800e3f:	00 00 00 
+  800e42:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  800e44:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  800e4b:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  800e4c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e51:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  800e55:	48 89 de             	mov    %rbx,%rsi
+  800e58:	bf 00 00 00 00       	mov    $0x0,%edi
+  800e5d:	48 b8 b8 2a 80 00 00 	movabs $0x802ab8,%rax
+  800e64:	00 00 00 
+  800e67:	ff d0                	call   *%rax
+}
+  800e69:	48 83 c4 10          	add    $0x10,%rsp
+  800e6d:	5b                   	pop    %rbx
+  800e6e:	41 5c                	pop    %r12
+  800e70:	5d                   	pop    %rbp
+  800e71:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  800e72:	bf 03 00 00 00       	mov    $0x3,%edi
+  800e77:	48 b8 30 2c 80 00 00 	movabs $0x802c30,%rax
+  800e7e:	00 00 00 
+  800e81:	ff d0                	call   *%rax
+  800e83:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  800e8a:	00 00 
+  800e8c:	eb 86                	jmp    800e14 <fsipc+0x20>
+
+0000000000800e8e <devfile_trunc>:
+    return 0;
+}
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  800e8e:	55                   	push   %rbp
+  800e8f:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  800e92:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  800e99:	00 00 00 
+  800e9c:	8b 57 0c             	mov    0xc(%rdi),%edx
+  800e9f:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  800ea1:	89 70 04             	mov    %esi,0x4(%rax)
+
+    return fsipc(FSREQ_SET_SIZE, NULL);
+  800ea4:	be 00 00 00 00       	mov    $0x0,%esi
+  800ea9:	bf 02 00 00 00       	mov    $0x2,%edi
+  800eae:	48 b8 f4 0d 80 00 00 	movabs $0x800df4,%rax
+  800eb5:	00 00 00 
+  800eb8:	ff d0                	call   *%rax
+}
+  800eba:	5d                   	pop    %rbp
+  800ebb:	c3                   	ret
+
+0000000000800ebc <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  800ebc:	55                   	push   %rbp
+  800ebd:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  800ec0:	8b 47 0c             	mov    0xc(%rdi),%eax
+  800ec3:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  800eca:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  800ecc:	be 00 00 00 00       	mov    $0x0,%esi
+  800ed1:	bf 06 00 00 00       	mov    $0x6,%edi
+  800ed6:	48 b8 f4 0d 80 00 00 	movabs $0x800df4,%rax
+  800edd:	00 00 00 
+  800ee0:	ff d0                	call   *%rax
+}
+  800ee2:	5d                   	pop    %rbp
+  800ee3:	c3                   	ret
+
+0000000000800ee4 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  800ee4:	55                   	push   %rbp
+  800ee5:	48 89 e5             	mov    %rsp,%rbp
+  800ee8:	41 54                	push   %r12
+  800eea:	53                   	push   %rbx
+  800eeb:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  800eee:	8b 47 0c             	mov    0xc(%rdi),%eax
+  800ef1:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  800ef8:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  800efa:	be 00 00 00 00       	mov    $0x0,%esi
+  800eff:	bf 05 00 00 00       	mov    $0x5,%edi
+  800f04:	48 b8 f4 0d 80 00 00 	movabs $0x800df4,%rax
+  800f0b:	00 00 00 
+  800f0e:	ff d0                	call   *%rax
+    if (res < 0) {
+  800f10:	85 c0                	test   %eax,%eax
+  800f12:	78 3d                	js     800f51 <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  800f14:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  800f1b:	00 00 00 
+  800f1e:	4c 89 e6             	mov    %r12,%rsi
+  800f21:	48 89 df             	mov    %rbx,%rdi
+  800f24:	48 b8 91 26 80 00 00 	movabs $0x802691,%rax
+  800f2b:	00 00 00 
+  800f2e:	ff d0                	call   *%rax
+    st->st_size  = fsipcbuf.statRet.ret_size;
+  800f30:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  800f37:	00 
+  800f38:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  800f3e:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  800f45:	00 
+  800f46:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  800f4c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800f51:	5b                   	pop    %rbx
+  800f52:	41 5c                	pop    %r12
+  800f54:	5d                   	pop    %rbp
+  800f55:	c3                   	ret
+
+0000000000800f56 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  800f56:	55                   	push   %rbp
+  800f57:	48 89 e5             	mov    %rsp,%rbp
+  800f5a:	41 57                	push   %r15
+  800f5c:	41 56                	push   %r14
+  800f5e:	41 55                	push   %r13
+  800f60:	41 54                	push   %r12
+  800f62:	53                   	push   %rbx
+  800f63:	48 83 ec 18          	sub    $0x18,%rsp
+  800f67:	49 89 fe             	mov    %rdi,%r14
+  800f6a:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+  800f6e:	48 89 d3             	mov    %rdx,%rbx
+    while (n > sizeof(fsipcbuf.write.req_buf))
+  800f71:	48 81 fa f0 0f 00 00 	cmp    $0xff0,%rdx
+  800f78:	0f 86 e4 00 00 00    	jbe    801062 <devfile_write+0x10c>
+  800f7e:	49 89 f4             	mov    %rsi,%r12
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  800f81:	49 bd 00 60 80 00 00 	movabs $0x806000,%r13
+  800f88:	00 00 00 
+        memcpy(fsipcbuf.write.req_buf, buf, sizeof(fsipcbuf.write.req_buf));
+  800f8b:	49 bf f2 28 80 00 00 	movabs $0x8028f2,%r15
+  800f92:	00 00 00 
+  800f95:	eb 03                	jmp    800f9a <devfile_write+0x44>
+        buf += sizeof(fsipcbuf.write.req_buf);
+  800f97:	49 89 f4             	mov    %rsi,%r12
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  800f9a:	41 8b 46 0c          	mov    0xc(%r14),%eax
+  800f9e:	41 89 45 00          	mov    %eax,0x0(%r13)
+        fsipcbuf.write.req_n      = sizeof(fsipcbuf.write.req_buf);
+  800fa2:	49 c7 45 08 f0 0f 00 	movq   $0xff0,0x8(%r13)
+  800fa9:	00 
+        memcpy(fsipcbuf.write.req_buf, buf, sizeof(fsipcbuf.write.req_buf));
+  800faa:	ba f0 0f 00 00       	mov    $0xff0,%edx
+  800faf:	4c 89 e6             	mov    %r12,%rsi
+  800fb2:	48 bf 10 60 80 00 00 	movabs $0x806010,%rdi
+  800fb9:	00 00 00 
+  800fbc:	41 ff d7             	call   *%r15
+        ssize_t res = fsipc(FSREQ_WRITE, NULL);
+  800fbf:	be 00 00 00 00       	mov    $0x0,%esi
+  800fc4:	bf 04 00 00 00       	mov    $0x4,%edi
+  800fc9:	48 b8 f4 0d 80 00 00 	movabs $0x800df4,%rax
+  800fd0:	00 00 00 
+  800fd3:	ff d0                	call   *%rax
+  800fd5:	48 63 d0             	movslq %eax,%rdx
+        if (res < 0 || res < sizeof(fsipcbuf.write.req_buf))
+  800fd8:	3d ef 0f 00 00       	cmp    $0xfef,%eax
+  800fdd:	7e 71                	jle    801050 <devfile_write+0xfa>
+        buf += sizeof(fsipcbuf.write.req_buf);
+  800fdf:	49 8d b4 24 f0 0f 00 	lea    0xff0(%r12),%rsi
+  800fe6:	00 
+        n -= sizeof(fsipcbuf.write.req_buf);
+  800fe7:	48 81 eb f0 0f 00 00 	sub    $0xff0,%rbx
+    while (n > sizeof(fsipcbuf.write.req_buf))
+  800fee:	48 81 fb f0 0f 00 00 	cmp    $0xff0,%rbx
+  800ff5:	77 a0                	ja     800f97 <devfile_write+0x41>
+        written += sizeof(fsipcbuf.write.req_buf);
+  800ff7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800ffb:	49 29 c4             	sub    %rax,%r12
+  800ffe:	4d 8d a4 24 f0 0f 00 	lea    0xff0(%r12),%r12
+  801005:	00 
+    fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801006:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  80100d:	00 00 00 
+  801010:	41 8b 56 0c          	mov    0xc(%r14),%edx
+  801014:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.write.req_n      = n;
+  801016:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    memcpy(fsipcbuf.write.req_buf, buf, n);
+  80101a:	48 89 da             	mov    %rbx,%rdx
+  80101d:	48 8d 78 10          	lea    0x10(%rax),%rdi
+  801021:	48 b8 f2 28 80 00 00 	movabs $0x8028f2,%rax
+  801028:	00 00 00 
+  80102b:	ff d0                	call   *%rax
+    ssize_t res = fsipc(FSREQ_WRITE, NULL);
+  80102d:	be 00 00 00 00       	mov    $0x0,%esi
+  801032:	bf 04 00 00 00       	mov    $0x4,%edi
+  801037:	48 b8 f4 0d 80 00 00 	movabs $0x800df4,%rax
+  80103e:	00 00 00 
+  801041:	ff d0                	call   *%rax
+  801043:	48 63 d0             	movslq %eax,%rdx
+    written += res;
+  801046:	49 01 d4             	add    %rdx,%r12
+  801049:	48 85 d2             	test   %rdx,%rdx
+  80104c:	49 0f 49 d4          	cmovns %r12,%rdx
+}
+  801050:	48 89 d0             	mov    %rdx,%rax
+  801053:	48 83 c4 18          	add    $0x18,%rsp
+  801057:	5b                   	pop    %rbx
+  801058:	41 5c                	pop    %r12
+  80105a:	41 5d                	pop    %r13
+  80105c:	41 5e                	pop    %r14
+  80105e:	41 5f                	pop    %r15
+  801060:	5d                   	pop    %rbp
+  801061:	c3                   	ret
+    while (n > sizeof(fsipcbuf.write.req_buf))
+  801062:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+    ssize_t written = 0;
+  801066:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80106c:	eb 98                	jmp    801006 <devfile_write+0xb0>
+
+000000000080106e <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  80106e:	55                   	push   %rbp
+  80106f:	48 89 e5             	mov    %rsp,%rbp
+  801072:	41 57                	push   %r15
+  801074:	41 56                	push   %r14
+  801076:	41 55                	push   %r13
+  801078:	41 54                	push   %r12
+  80107a:	53                   	push   %rbx
+  80107b:	48 83 ec 18          	sub    $0x18,%rsp
+  80107f:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  801083:	49 89 f6             	mov    %rsi,%r14
+  801086:	49 89 d4             	mov    %rdx,%r12
+    while (n > sizeof(fsipcbuf.readRet.ret_buf))
+  801089:	48 81 fa 00 10 00 00 	cmp    $0x1000,%rdx
+  801090:	0f 86 ea 00 00 00    	jbe    801180 <devfile_read+0x112>
+    ssize_t readsz = 0;
+  801096:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  80109d:	00 
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  80109e:	49 bf 00 60 80 00 00 	movabs $0x806000,%r15
+  8010a5:	00 00 00 
+  8010a8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8010ac:	8b 40 0c             	mov    0xc(%rax),%eax
+  8010af:	41 89 07             	mov    %eax,(%r15)
+        fsipcbuf.read.req_n = sizeof(fsipcbuf.readRet.ret_buf);
+  8010b2:	49 c7 47 08 00 10 00 	movq   $0x1000,0x8(%r15)
+  8010b9:	00 
+        ssize_t res = fsipc(FSREQ_READ, NULL);
+  8010ba:	be 00 00 00 00       	mov    $0x0,%esi
+  8010bf:	bf 03 00 00 00       	mov    $0x3,%edi
+  8010c4:	48 b8 f4 0d 80 00 00 	movabs $0x800df4,%rax
+  8010cb:	00 00 00 
+  8010ce:	ff d0                	call   *%rax
+  8010d0:	4c 63 e8             	movslq %eax,%r13
+        if (res < 0)
+  8010d3:	4d 85 ed             	test   %r13,%r13
+  8010d6:	0f 88 92 00 00 00    	js     80116e <devfile_read+0x100>
+        memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  8010dc:	4c 89 ea             	mov    %r13,%rdx
+  8010df:	4c 89 fe             	mov    %r15,%rsi
+  8010e2:	4c 89 f7             	mov    %r14,%rdi
+  8010e5:	48 b8 f2 28 80 00 00 	movabs $0x8028f2,%rax
+  8010ec:	00 00 00 
+  8010ef:	ff d0                	call   *%rax
+        if (res < sizeof(fsipcbuf.readRet.ret_buf))
+  8010f1:	49 81 fd ff 0f 00 00 	cmp    $0xfff,%r13
+  8010f8:	76 6d                	jbe    801167 <devfile_read+0xf9>
+        readsz += res;
+  8010fa:	4c 01 6d c0          	add    %r13,-0x40(%rbp)
+        buf += res;
+  8010fe:	4d 01 ee             	add    %r13,%r14
+        n -= res;
+  801101:	4d 29 ec             	sub    %r13,%r12
+    while (n > sizeof(fsipcbuf.readRet.ret_buf))
+  801104:	49 81 fc 00 10 00 00 	cmp    $0x1000,%r12
+  80110b:	77 9b                	ja     8010a8 <devfile_read+0x3a>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  80110d:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  801114:	00 00 00 
+  801117:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  80111b:	8b 51 0c             	mov    0xc(%rcx),%edx
+  80111e:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.read.req_n = n;
+  801120:	4c 89 60 08          	mov    %r12,0x8(%rax)
+    ssize_t res = fsipc(FSREQ_READ, NULL);
+  801124:	be 00 00 00 00       	mov    $0x0,%esi
+  801129:	bf 03 00 00 00       	mov    $0x3,%edi
+  80112e:	48 b8 f4 0d 80 00 00 	movabs $0x800df4,%rax
+  801135:	00 00 00 
+  801138:	ff d0                	call   *%rax
+  80113a:	4c 63 e8             	movslq %eax,%r13
+    if (res < 0)
+  80113d:	4d 85 ed             	test   %r13,%r13
+  801140:	78 2c                	js     80116e <devfile_read+0x100>
+    memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  801142:	4c 89 ea             	mov    %r13,%rdx
+  801145:	48 be 00 60 80 00 00 	movabs $0x806000,%rsi
+  80114c:	00 00 00 
+  80114f:	4c 89 f7             	mov    %r14,%rdi
+  801152:	48 b8 f2 28 80 00 00 	movabs $0x8028f2,%rax
+  801159:	00 00 00 
+  80115c:	ff d0                	call   *%rax
+    readsz += res;
+  80115e:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  801162:	49 01 c5             	add    %rax,%r13
+    return readsz;
+  801165:	eb 07                	jmp    80116e <devfile_read+0x100>
+            return readsz + res;
+  801167:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80116b:	49 01 c5             	add    %rax,%r13
+}
+  80116e:	4c 89 e8             	mov    %r13,%rax
+  801171:	48 83 c4 18          	add    $0x18,%rsp
+  801175:	5b                   	pop    %rbx
+  801176:	41 5c                	pop    %r12
+  801178:	41 5d                	pop    %r13
+  80117a:	41 5e                	pop    %r14
+  80117c:	41 5f                	pop    %r15
+  80117e:	5d                   	pop    %rbp
+  80117f:	c3                   	ret
+    ssize_t readsz = 0;
+  801180:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  801187:	00 
+  801188:	eb 83                	jmp    80110d <devfile_read+0x9f>
+
+000000000080118a <open>:
+open(const char *path, int mode) {
+  80118a:	55                   	push   %rbp
+  80118b:	48 89 e5             	mov    %rsp,%rbp
+  80118e:	41 55                	push   %r13
+  801190:	41 54                	push   %r12
+  801192:	53                   	push   %rbx
+  801193:	48 83 ec 18          	sub    $0x18,%rsp
+  801197:	49 89 fc             	mov    %rdi,%r12
+  80119a:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  80119d:	48 b8 53 26 80 00 00 	movabs $0x802653,%rax
+  8011a4:	00 00 00 
+  8011a7:	ff d0                	call   *%rax
+  8011a9:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  8011af:	0f 87 8a 00 00 00    	ja     80123f <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8011b5:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  8011b9:	48 b8 6d 07 80 00 00 	movabs $0x80076d,%rax
+  8011c0:	00 00 00 
+  8011c3:	ff d0                	call   *%rax
+  8011c5:	89 c3                	mov    %eax,%ebx
+  8011c7:	85 c0                	test   %eax,%eax
+  8011c9:	78 50                	js     80121b <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  8011cb:	4c 89 e6             	mov    %r12,%rsi
+  8011ce:	48 bb 00 60 80 00 00 	movabs $0x806000,%rbx
+  8011d5:	00 00 00 
+  8011d8:	48 89 df             	mov    %rbx,%rdi
+  8011db:	48 b8 91 26 80 00 00 	movabs $0x802691,%rax
+  8011e2:	00 00 00 
+  8011e5:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  8011e7:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  8011ee:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8011f2:	bf 01 00 00 00       	mov    $0x1,%edi
+  8011f7:	48 b8 f4 0d 80 00 00 	movabs $0x800df4,%rax
+  8011fe:	00 00 00 
+  801201:	ff d0                	call   *%rax
+  801203:	89 c3                	mov    %eax,%ebx
+  801205:	85 c0                	test   %eax,%eax
+  801207:	78 1f                	js     801228 <open+0x9e>
+    return fd2num(fd);
+  801209:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80120d:	48 b8 c6 06 80 00 00 	movabs $0x8006c6,%rax
+  801214:	00 00 00 
+  801217:	ff d0                	call   *%rax
+  801219:	89 c3                	mov    %eax,%ebx
+}
+  80121b:	89 d8                	mov    %ebx,%eax
+  80121d:	48 83 c4 18          	add    $0x18,%rsp
+  801221:	5b                   	pop    %rbx
+  801222:	41 5c                	pop    %r12
+  801224:	41 5d                	pop    %r13
+  801226:	5d                   	pop    %rbp
+  801227:	c3                   	ret
+        fd_close(fd, 0);
+  801228:	be 00 00 00 00       	mov    $0x0,%esi
+  80122d:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  801231:	48 b8 42 08 80 00 00 	movabs $0x800842,%rax
+  801238:	00 00 00 
+  80123b:	ff d0                	call   *%rax
+        return res;
+  80123d:	eb dc                	jmp    80121b <open+0x91>
+        return -E_BAD_PATH;
+  80123f:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  801244:	eb d5                	jmp    80121b <open+0x91>
+
+0000000000801246 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  801246:	55                   	push   %rbp
+  801247:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc(FSREQ_SYNC, NULL);
+  80124a:	be 00 00 00 00       	mov    $0x0,%esi
+  80124f:	bf 08 00 00 00       	mov    $0x8,%edi
+  801254:	48 b8 f4 0d 80 00 00 	movabs $0x800df4,%rax
+  80125b:	00 00 00 
+  80125e:	ff d0                	call   *%rax
+}
+  801260:	5d                   	pop    %rbp
+  801261:	c3                   	ret
+
+0000000000801262 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  801262:	55                   	push   %rbp
+  801263:	48 89 e5             	mov    %rsp,%rbp
+  801266:	41 54                	push   %r12
+  801268:	53                   	push   %rbx
+  801269:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80126c:	48 b8 d8 06 80 00 00 	movabs $0x8006d8,%rax
+  801273:	00 00 00 
+  801276:	ff d0                	call   *%rax
+  801278:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  80127b:	48 be 60 2d 80 00 00 	movabs $0x802d60,%rsi
+  801282:	00 00 00 
+  801285:	48 89 df             	mov    %rbx,%rdi
+  801288:	48 b8 91 26 80 00 00 	movabs $0x802691,%rax
+  80128f:	00 00 00 
+  801292:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  801294:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  801299:	41 2b 04 24          	sub    (%r12),%eax
+  80129d:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  8012a3:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8012aa:	00 00 00 
+    stat->st_dev = &devpipe;
+  8012ad:	48 b8 60 40 80 00 00 	movabs $0x804060,%rax
+  8012b4:	00 00 00 
+  8012b7:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  8012be:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012c3:	5b                   	pop    %rbx
+  8012c4:	41 5c                	pop    %r12
+  8012c6:	5d                   	pop    %rbp
+  8012c7:	c3                   	ret
+
+00000000008012c8 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  8012c8:	55                   	push   %rbp
+  8012c9:	48 89 e5             	mov    %rsp,%rbp
+  8012cc:	41 54                	push   %r12
+  8012ce:	53                   	push   %rbx
+  8012cf:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8012d2:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8012d7:	48 89 fe             	mov    %rdi,%rsi
+  8012da:	bf 00 00 00 00       	mov    $0x0,%edi
+  8012df:	49 bc 57 03 80 00 00 	movabs $0x800357,%r12
+  8012e6:	00 00 00 
+  8012e9:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  8012ec:	48 89 df             	mov    %rbx,%rdi
+  8012ef:	48 b8 d8 06 80 00 00 	movabs $0x8006d8,%rax
+  8012f6:	00 00 00 
+  8012f9:	ff d0                	call   *%rax
+  8012fb:	48 89 c6             	mov    %rax,%rsi
+  8012fe:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801303:	bf 00 00 00 00       	mov    $0x0,%edi
+  801308:	41 ff d4             	call   *%r12
+}
+  80130b:	5b                   	pop    %rbx
+  80130c:	41 5c                	pop    %r12
+  80130e:	5d                   	pop    %rbp
+  80130f:	c3                   	ret
+
+0000000000801310 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  801310:	55                   	push   %rbp
+  801311:	48 89 e5             	mov    %rsp,%rbp
+  801314:	41 57                	push   %r15
+  801316:	41 56                	push   %r14
+  801318:	41 55                	push   %r13
+  80131a:	41 54                	push   %r12
+  80131c:	53                   	push   %rbx
+  80131d:	48 83 ec 18          	sub    $0x18,%rsp
+  801321:	49 89 fc             	mov    %rdi,%r12
+  801324:	49 89 f5             	mov    %rsi,%r13
+  801327:	49 89 d7             	mov    %rdx,%r15
+  80132a:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80132e:	48 b8 d8 06 80 00 00 	movabs $0x8006d8,%rax
+  801335:	00 00 00 
+  801338:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  80133a:	4d 85 ff             	test   %r15,%r15
+  80133d:	0f 84 af 00 00 00    	je     8013f2 <devpipe_write+0xe2>
+  801343:	48 89 c3             	mov    %rax,%rbx
+  801346:	4c 89 f8             	mov    %r15,%rax
+  801349:	4d 89 ef             	mov    %r13,%r15
+  80134c:	4c 01 e8             	add    %r13,%rax
+  80134f:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  801353:	49 bd 5f 02 80 00 00 	movabs $0x80025f,%r13
+  80135a:	00 00 00 
+            sys_yield();
+  80135d:	49 be fc 01 80 00 00 	movabs $0x8001fc,%r14
+  801364:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  801367:	8b 73 04             	mov    0x4(%rbx),%esi
+  80136a:	48 63 ce             	movslq %esi,%rcx
+  80136d:	48 63 03             	movslq (%rbx),%rax
+  801370:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  801376:	48 39 c1             	cmp    %rax,%rcx
+  801379:	72 2e                	jb     8013a9 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80137b:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  801380:	48 89 da             	mov    %rbx,%rdx
+  801383:	be 00 10 00 00       	mov    $0x1000,%esi
+  801388:	4c 89 e7             	mov    %r12,%rdi
+  80138b:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  80138e:	85 c0                	test   %eax,%eax
+  801390:	74 66                	je     8013f8 <devpipe_write+0xe8>
+            sys_yield();
+  801392:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  801395:	8b 73 04             	mov    0x4(%rbx),%esi
+  801398:	48 63 ce             	movslq %esi,%rcx
+  80139b:	48 63 03             	movslq (%rbx),%rax
+  80139e:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  8013a4:	48 39 c1             	cmp    %rax,%rcx
+  8013a7:	73 d2                	jae    80137b <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8013a9:	41 0f b6 3f          	movzbl (%r15),%edi
+  8013ad:	48 89 ca             	mov    %rcx,%rdx
+  8013b0:	48 c1 ea 03          	shr    $0x3,%rdx
+  8013b4:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  8013bb:	08 10 20 
+  8013be:	48 f7 e2             	mul    %rdx
+  8013c1:	48 c1 ea 06          	shr    $0x6,%rdx
+  8013c5:	48 89 d0             	mov    %rdx,%rax
+  8013c8:	48 c1 e0 09          	shl    $0x9,%rax
+  8013cc:	48 29 d0             	sub    %rdx,%rax
+  8013cf:	48 c1 e0 03          	shl    $0x3,%rax
+  8013d3:	48 29 c1             	sub    %rax,%rcx
+  8013d6:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  8013db:	83 c6 01             	add    $0x1,%esi
+  8013de:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8013e1:	49 83 c7 01          	add    $0x1,%r15
+  8013e5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8013e9:	49 39 c7             	cmp    %rax,%r15
+  8013ec:	0f 85 75 ff ff ff    	jne    801367 <devpipe_write+0x57>
+    return n;
+  8013f2:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8013f6:	eb 05                	jmp    8013fd <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  8013f8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8013fd:	48 83 c4 18          	add    $0x18,%rsp
+  801401:	5b                   	pop    %rbx
+  801402:	41 5c                	pop    %r12
+  801404:	41 5d                	pop    %r13
+  801406:	41 5e                	pop    %r14
+  801408:	41 5f                	pop    %r15
+  80140a:	5d                   	pop    %rbp
+  80140b:	c3                   	ret
+
+000000000080140c <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  80140c:	55                   	push   %rbp
+  80140d:	48 89 e5             	mov    %rsp,%rbp
+  801410:	41 57                	push   %r15
+  801412:	41 56                	push   %r14
+  801414:	41 55                	push   %r13
+  801416:	41 54                	push   %r12
+  801418:	53                   	push   %rbx
+  801419:	48 83 ec 18          	sub    $0x18,%rsp
+  80141d:	49 89 fc             	mov    %rdi,%r12
+  801420:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  801424:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  801428:	48 b8 d8 06 80 00 00 	movabs $0x8006d8,%rax
+  80142f:	00 00 00 
+  801432:	ff d0                	call   *%rax
+  801434:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  801437:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80143d:	49 bd 5f 02 80 00 00 	movabs $0x80025f,%r13
+  801444:	00 00 00 
+            sys_yield();
+  801447:	49 be fc 01 80 00 00 	movabs $0x8001fc,%r14
+  80144e:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  801451:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  801456:	74 7d                	je     8014d5 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  801458:	8b 03                	mov    (%rbx),%eax
+  80145a:	3b 43 04             	cmp    0x4(%rbx),%eax
+  80145d:	75 26                	jne    801485 <devpipe_read+0x79>
+            if (i > 0) return i;
+  80145f:	4d 85 ff             	test   %r15,%r15
+  801462:	75 77                	jne    8014db <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  801464:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  801469:	48 89 da             	mov    %rbx,%rdx
+  80146c:	be 00 10 00 00       	mov    $0x1000,%esi
+  801471:	4c 89 e7             	mov    %r12,%rdi
+  801474:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  801477:	85 c0                	test   %eax,%eax
+  801479:	74 72                	je     8014ed <devpipe_read+0xe1>
+            sys_yield();
+  80147b:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  80147e:	8b 03                	mov    (%rbx),%eax
+  801480:	3b 43 04             	cmp    0x4(%rbx),%eax
+  801483:	74 df                	je     801464 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  801485:	48 63 c8             	movslq %eax,%rcx
+  801488:	48 89 ca             	mov    %rcx,%rdx
+  80148b:	48 c1 ea 03          	shr    $0x3,%rdx
+  80148f:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  801496:	08 10 20 
+  801499:	48 89 d0             	mov    %rdx,%rax
+  80149c:	48 f7 e6             	mul    %rsi
+  80149f:	48 c1 ea 06          	shr    $0x6,%rdx
+  8014a3:	48 89 d0             	mov    %rdx,%rax
+  8014a6:	48 c1 e0 09          	shl    $0x9,%rax
+  8014aa:	48 29 d0             	sub    %rdx,%rax
+  8014ad:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  8014b4:	00 
+  8014b5:	48 89 c8             	mov    %rcx,%rax
+  8014b8:	48 29 d0             	sub    %rdx,%rax
+  8014bb:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  8014c0:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8014c4:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  8014c8:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8014cb:	49 83 c7 01          	add    $0x1,%r15
+  8014cf:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  8014d3:	75 83                	jne    801458 <devpipe_read+0x4c>
+    return n;
+  8014d5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8014d9:	eb 03                	jmp    8014de <devpipe_read+0xd2>
+            if (i > 0) return i;
+  8014db:	4c 89 f8             	mov    %r15,%rax
+}
+  8014de:	48 83 c4 18          	add    $0x18,%rsp
+  8014e2:	5b                   	pop    %rbx
+  8014e3:	41 5c                	pop    %r12
+  8014e5:	41 5d                	pop    %r13
+  8014e7:	41 5e                	pop    %r14
+  8014e9:	41 5f                	pop    %r15
+  8014eb:	5d                   	pop    %rbp
+  8014ec:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  8014ed:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014f2:	eb ea                	jmp    8014de <devpipe_read+0xd2>
+
+00000000008014f4 <pipe>:
+pipe(int pfd[2]) {
+  8014f4:	55                   	push   %rbp
+  8014f5:	48 89 e5             	mov    %rsp,%rbp
+  8014f8:	41 55                	push   %r13
+  8014fa:	41 54                	push   %r12
+  8014fc:	53                   	push   %rbx
+  8014fd:	48 81 ec b8 00 00 00 	sub    $0xb8,%rsp
+  801504:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  801507:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  80150b:	48 b8 6d 07 80 00 00 	movabs $0x80076d,%rax
+  801512:	00 00 00 
+  801515:	ff d0                	call   *%rax
+  801517:	89 c3                	mov    %eax,%ebx
+  801519:	85 c0                	test   %eax,%eax
+  80151b:	0f 88 51 01 00 00    	js     801672 <pipe+0x17e>
+        (res = fd_alloc_from(fd2num(fd0) + 1, &fd1)) < 0) goto err;
+  801521:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  801525:	48 b8 c6 06 80 00 00 	movabs $0x8006c6,%rax
+  80152c:	00 00 00 
+  80152f:	ff d0                	call   *%rax
+  801531:	8d 78 01             	lea    0x1(%rax),%edi
+  801534:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801538:	48 b8 f4 06 80 00 00 	movabs $0x8006f4,%rax
+  80153f:	00 00 00 
+  801542:	ff d0                	call   *%rax
+  801544:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  801546:	85 c0                	test   %eax,%eax
+  801548:	0f 88 24 01 00 00    	js     801672 <pipe+0x17e>
+    va = fd2data(fd0);
+  80154e:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  801552:	48 bb d8 06 80 00 00 	movabs $0x8006d8,%rbx
+  801559:	00 00 00 
+  80155c:	ff d3                	call   *%rbx
+  80155e:	49 89 c5             	mov    %rax,%r13
+    struct RegionOp ops[] = {
+  801561:	48 8d bd 30 ff ff ff 	lea    -0xd0(%rbp),%rdi
+  801568:	b9 14 00 00 00       	mov    $0x14,%ecx
+  80156d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801572:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+  801575:	c7 85 34 ff ff ff 46 	movl   $0x46,-0xcc(%rbp)
+  80157c:	00 00 00 
+  80157f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801583:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+  80158a:	48 c7 85 50 ff ff ff 	movq   $0x1000,-0xb0(%rbp)
+  801591:	00 10 00 00 
+  801595:	c7 85 5c ff ff ff 46 	movl   $0x46,-0xa4(%rbp)
+  80159c:	00 00 00 
+            {.type = REGION_ALLOC, .dstva = (uintptr_t)fd1, .size = PAGE_SIZE, .perm = PROT_RW | PROT_SHARE},
+  80159f:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+    struct RegionOp ops[] = {
+  8015a3:	48 89 bd 70 ff ff ff 	mov    %rdi,-0x90(%rbp)
+  8015aa:	48 c7 85 78 ff ff ff 	movq   $0x1000,-0x88(%rbp)
+  8015b1:	00 10 00 00 
+  8015b5:	c7 45 84 46 00 00 00 	movl   $0x46,-0x7c(%rbp)
+  8015bc:	4c 89 6d 98          	mov    %r13,-0x68(%rbp)
+  8015c0:	48 c7 45 a0 00 10 00 	movq   $0x1000,-0x60(%rbp)
+  8015c7:	00 
+  8015c8:	c7 45 a8 01 00 00 00 	movl   $0x1,-0x58(%rbp)
+  8015cf:	c7 45 ac 46 00 00 00 	movl   $0x46,-0x54(%rbp)
+  8015d6:	4c 89 6d b8          	mov    %r13,-0x48(%rbp)
+            {.type = REGION_MAP, .srcva = (uintptr_t)va, .dstva = (uintptr_t)fd2data(fd1), .size = PAGE_SIZE, .perm = PROT_RW | PROT_SHARE},
+  8015da:	ff d3                	call   *%rbx
+    struct RegionOp ops[] = {
+  8015dc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8015e0:	48 c7 45 c8 00 10 00 	movq   $0x1000,-0x38(%rbp)
+  8015e7:	00 
+    if ((res = sys_region_batch(ops, sizeof ops / sizeof *ops)) < 0) goto err1;
+  8015e8:	be 04 00 00 00       	mov    $0x4,%esi
+  8015ed:	48 8d bd 30 ff ff ff 	lea    -0xd0(%rbp),%rdi
+  8015f4:	48 b8 be 03 80 00 00 	movabs $0x8003be,%rax
+  8015fb:	00 00 00 
+  8015fe:	ff d0                	call   *%rax
+  801600:	89 c3                	mov    %eax,%ebx
+  801602:	85 c0                	test   %eax,%eax
+  801604:	0f 88 ad 00 00 00    	js     8016b7 <pipe+0x1c3>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  80160a:	be 00 10 00 00       	mov    $0x1000,%esi
+  80160f:	4c 89 ef             	mov    %r13,%rdi
+  801612:	48 b8 2d 02 80 00 00 	movabs $0x80022d,%rax
+  801619:	00 00 00 
+  80161c:	ff d0                	call   *%rax
+  80161e:	83 f8 02             	cmp    $0x2,%eax
+  801621:	75 5f                	jne    801682 <pipe+0x18e>
+    fd0->fd_dev_id = devpipe.dev_id;
+  801623:	a1 60 40 80 00 00 00 	movabs 0x804060,%eax
+  80162a:	00 00 
+  80162c:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801630:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  801632:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801636:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  80163d:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  801641:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  801643:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801647:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  80164e:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  801652:	48 bb c6 06 80 00 00 	movabs $0x8006c6,%rbx
+  801659:	00 00 00 
+  80165c:	ff d3                	call   *%rbx
+  80165e:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  801662:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  801666:	ff d3                	call   *%rbx
+  801668:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  80166d:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  801672:	89 d8                	mov    %ebx,%eax
+  801674:	48 81 c4 b8 00 00 00 	add    $0xb8,%rsp
+  80167b:	5b                   	pop    %rbx
+  80167c:	41 5c                	pop    %r12
+  80167e:	41 5d                	pop    %r13
+  801680:	5d                   	pop    %rbp
+  801681:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  801682:	48 b9 90 2d 80 00 00 	movabs $0x802d90,%rcx
+  801689:	00 00 00 
+  80168c:	48 ba 67 2d 80 00 00 	movabs $0x802d67,%rdx
+  801693:	00 00 00 
+  801696:	be 33 00 00 00       	mov    $0x33,%esi
+  80169b:	48 bf 7c 2d 80 00 00 	movabs $0x802d7c,%rdi
+  8016a2:	00 00 00 
+  8016a5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016aa:	49 b8 1c 1c 80 00 00 	movabs $0x801c1c,%r8
+  8016b1:	00 00 00 
+  8016b4:	41 ff d0             	call   *%r8
+        ops[i].type = REGION_UNMAP;
+  8016b7:	c7 85 30 ff ff ff 02 	movl   $0x2,-0xd0(%rbp)
+  8016be:	00 00 00 
+  8016c1:	c7 85 58 ff ff ff 02 	movl   $0x2,-0xa8(%rbp)
+  8016c8:	00 00 00 
+  8016cb:	c7 45 80 02 00 00 00 	movl   $0x2,-0x80(%rbp)
+  8016d2:	c7 45 a8 02 00 00 00 	movl   $0x2,-0x58(%rbp)
+    sys_region_batch(ops, sizeof ops / sizeof *ops);
+  8016d9:	be 04 00 00 00       	mov    $0x4,%esi
+  8016de:	48 8d bd 30 ff ff ff 	lea    -0xd0(%rbp),%rdi
+  8016e5:	48 b8 be 03 80 00 00 	movabs $0x8003be,%rax
+  8016ec:	00 00 00 
+  8016ef:	ff d0                	call   *%rax
+  8016f1:	e9 7c ff ff ff       	jmp    801672 <pipe+0x17e>
+
+00000000008016f6 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  8016f6:	55                   	push   %rbp
+  8016f7:	48 89 e5             	mov    %rsp,%rbp
+  8016fa:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8016fe:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801702:	48 b8 87 07 80 00 00 	movabs $0x800787,%rax
+  801709:	00 00 00 
+  80170c:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80170e:	85 c0                	test   %eax,%eax
+  801710:	78 35                	js     801747 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  801712:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801716:	48 b8 d8 06 80 00 00 	movabs $0x8006d8,%rax
+  80171d:	00 00 00 
+  801720:	ff d0                	call   *%rax
+  801722:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  801725:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80172a:	be 00 10 00 00       	mov    $0x1000,%esi
+  80172f:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801733:	48 b8 5f 02 80 00 00 	movabs $0x80025f,%rax
+  80173a:	00 00 00 
+  80173d:	ff d0                	call   *%rax
+  80173f:	85 c0                	test   %eax,%eax
+  801741:	0f 94 c0             	sete   %al
+  801744:	0f b6 c0             	movzbl %al,%eax
+}
+  801747:	c9                   	leave
+  801748:	c3                   	ret
+
+0000000000801749 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  801749:	48 89 f8             	mov    %rdi,%rax
+  80174c:	48 c1 e8 27          	shr    $0x27,%rax
+  801750:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  801757:	01 00 00 
+  80175a:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80175e:	f6 c2 01             	test   $0x1,%dl
+  801761:	74 6d                	je     8017d0 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  801763:	48 89 f8             	mov    %rdi,%rax
+  801766:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80176a:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  801771:	01 00 00 
+  801774:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  801778:	f6 c2 01             	test   $0x1,%dl
+  80177b:	74 62                	je     8017df <get_uvpt_entry+0x96>
+  80177d:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  801784:	01 00 00 
+  801787:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80178b:	f6 c2 80             	test   $0x80,%dl
+  80178e:	75 4f                	jne    8017df <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  801790:	48 89 f8             	mov    %rdi,%rax
+  801793:	48 c1 e8 15          	shr    $0x15,%rax
+  801797:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  80179e:	01 00 00 
+  8017a1:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8017a5:	f6 c2 01             	test   $0x1,%dl
+  8017a8:	74 44                	je     8017ee <get_uvpt_entry+0xa5>
+  8017aa:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8017b1:	01 00 00 
+  8017b4:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8017b8:	f6 c2 80             	test   $0x80,%dl
+  8017bb:	75 31                	jne    8017ee <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  8017bd:	48 c1 ef 0c          	shr    $0xc,%rdi
+  8017c1:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8017c8:	01 00 00 
+  8017cb:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  8017cf:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8017d0:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  8017d7:	01 00 00 
+  8017da:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8017de:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8017df:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8017e6:	01 00 00 
+  8017e9:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8017ed:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8017ee:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8017f5:	01 00 00 
+  8017f8:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8017fc:	c3                   	ret
+
+00000000008017fd <get_prot>:
+
+int
+get_prot(void *va) {
+  8017fd:	55                   	push   %rbp
+  8017fe:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  801801:	48 b8 49 17 80 00 00 	movabs $0x801749,%rax
+  801808:	00 00 00 
+  80180b:	ff d0                	call   *%rax
+  80180d:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  801810:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  801815:	89 c1                	mov    %eax,%ecx
+  801817:	83 c9 04             	or     $0x4,%ecx
+  80181a:	f6 c2 01             	test   $0x1,%dl
+  80181d:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  801820:	89 c1                	mov    %eax,%ecx
+  801822:	83 c9 02             	or     $0x2,%ecx
+  801825:	f6 c2 02             	test   $0x2,%dl
+  801828:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  80182b:	89 c1                	mov    %eax,%ecx
+  80182d:	83 c9 01             	or     $0x1,%ecx
+  801830:	48 85 d2             	test   %rdx,%rdx
+  801833:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  801836:	89 c1                	mov    %eax,%ecx
+  801838:	83 c9 40             	or     $0x40,%ecx
+  80183b:	f6 c6 04             	test   $0x4,%dh
+  80183e:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  801841:	5d                   	pop    %rbp
+  801842:	c3                   	ret
+
+0000000000801843 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  801843:	55                   	push   %rbp
+  801844:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  801847:	48 b8 49 17 80 00 00 	movabs $0x801749,%rax
+  80184e:	00 00 00 
+  801851:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  801853:	48 c1 e8 06          	shr    $0x6,%rax
+  801857:	83 e0 01             	and    $0x1,%eax
+}
+  80185a:	5d                   	pop    %rbp
+  80185b:	c3                   	ret
+
+000000000080185c <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  80185c:	55                   	push   %rbp
+  80185d:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  801860:	48 b8 49 17 80 00 00 	movabs $0x801749,%rax
+  801867:	00 00 00 
+  80186a:	ff d0                	call   *%rax
+  80186c:	83 e0 01             	and    $0x1,%eax
+}
+  80186f:	5d                   	pop    %rbp
+  801870:	c3                   	ret
+
+0000000000801871 <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  801871:	55                   	push   %rbp
+  801872:	48 89 e5             	mov    %rsp,%rbp
+  801875:	41 57                	push   %r15
+  801877:	41 56                	push   %r14
+  801879:	41 55                	push   %r13
+  80187b:	41 54                	push   %r12
+  80187d:	53                   	push   %rbx
+  80187e:	48 83 ec 38          	sub    $0x38,%rsp
+  801882:	49 89 f7             	mov    %rsi,%r15
+  801885:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+                    }
+                    continue;
+                }
+                for (int ptei = 0; ptei < PT_ENTRY_COUNT; ptei++) {
+                    uintptr_t pte_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, pdei, ptei, 0);
+                    pte_t pte = uvpt[VPT(pte_addr)];
+  80188b:	49 bd 00 00 00 00 00 	movabs $0x10000000000,%r13
+  801892:	01 00 00 
+  801895:	4d 89 e6             	mov    %r12,%r14
+  801898:	49 89 fc             	mov    %rdi,%r12
+  80189b:	e9 19 01 00 00       	jmp    8019b9 <foreach_shared_region+0x148>
+  8018a0:	48 89 5d b0          	mov    %rbx,-0x50(%rbp)
+  8018a4:	4c 89 75 a8          	mov    %r14,-0x58(%rbp)
+  8018a8:	eb 52                	jmp    8018fc <foreach_shared_region+0x8b>
+                for (int ptei = 0; ptei < PT_ENTRY_COUNT; ptei++) {
+  8018aa:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8018b1:	48 81 fb 00 00 20 00 	cmp    $0x200000,%rbx
+  8018b8:	74 2e                	je     8018e8 <foreach_shared_region+0x77>
+                    uintptr_t pte_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, pdei, ptei, 0);
+  8018ba:	48 89 df             	mov    %rbx,%rdi
+  8018bd:	4c 09 f7             	or     %r14,%rdi
+                    pte_t pte = uvpt[VPT(pte_addr)];
+  8018c0:	48 89 f8             	mov    %rdi,%rax
+  8018c3:	48 c1 e8 0c          	shr    $0xc,%rax
+  8018c7:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+                    if ((pte & PTE_P) && (pte & PTE_SHARE)) {
+  8018cc:	25 01 04 00 00       	and    $0x401,%eax
+  8018d1:	48 3d 01 04 00 00    	cmp    $0x401,%rax
+  8018d7:	75 d1                	jne    8018aa <foreach_shared_region+0x39>
+                        fun((void*)pte_addr, (void*)(pte_addr + PAGE_SIZE), arg);
+  8018d9:	48 8d b7 00 10 00 00 	lea    0x1000(%rdi),%rsi
+  8018e0:	4c 89 fa             	mov    %r15,%rdx
+  8018e3:	41 ff d4             	call   *%r12
+  8018e6:	eb c2                	jmp    8018aa <foreach_shared_region+0x39>
+            for (int pdei = 0; pdei < PD_ENTRY_COUNT; pdei++) {
+  8018e8:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  8018ef:	00 
+  8018f0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8018f4:	48 3d 00 00 00 40    	cmp    $0x40000000,%rax
+  8018fa:	74 46                	je     801942 <foreach_shared_region+0xd1>
+                uintptr_t pde_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, pdei, 0, 0);
+  8018fc:	4c 8b 75 c8          	mov    -0x38(%rbp),%r14
+  801900:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  801904:	49 09 c6             	or     %rax,%r14
+                pde_t pde = uvpd[VPD(pde_addr)];
+  801907:	4c 89 f0             	mov    %r14,%rax
+  80190a:	48 c1 e8 15          	shr    $0x15,%rax
+  80190e:	48 b9 00 00 00 80 00 	movabs $0x10080000000,%rcx
+  801915:	01 00 00 
+  801918:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+                if (!(pde & PTE_P)) {
+  80191c:	a8 01                	test   $0x1,%al
+  80191e:	74 c8                	je     8018e8 <foreach_shared_region+0x77>
+                if (pde & PTE_PS) {
+  801920:	48 89 c3             	mov    %rax,%rbx
+  801923:	81 e3 80 00 00 00    	and    $0x80,%ebx
+  801929:	74 8f                	je     8018ba <foreach_shared_region+0x49>
+                    if (pde & PTE_SHARE) {
+  80192b:	f6 c4 04             	test   $0x4,%ah
+  80192e:	74 b8                	je     8018e8 <foreach_shared_region+0x77>
+                        fun((void*)pde_addr, (void*)(pde_addr + 1024 * 1024 * 2), arg);
+  801930:	49 8d b6 00 00 20 00 	lea    0x200000(%r14),%rsi
+  801937:	4c 89 fa             	mov    %r15,%rdx
+  80193a:	4c 89 f7             	mov    %r14,%rdi
+  80193d:	41 ff d4             	call   *%r12
+  801940:	eb a6                	jmp    8018e8 <foreach_shared_region+0x77>
+  801942:	48 8b 5d b0          	mov    -0x50(%rbp),%rbx
+  801946:	4c 8b 75 a8          	mov    -0x58(%rbp),%r14
+        for (int pdpei = 0; pdpei < PDP_ENTRY_COUNT; pdpei++) {
+  80194a:	48 81 c3 00 00 00 40 	add    $0x40000000,%rbx
+  801951:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  801958:	00 00 00 
+  80195b:	48 39 c3             	cmp    %rax,%rbx
+  80195e:	74 4c                	je     8019ac <foreach_shared_region+0x13b>
+            uintptr_t pdpe_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, 0, 0, 0);
+  801960:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  801964:	48 09 d8             	or     %rbx,%rax
+  801967:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+            pdpe_t pdpe = uvpdp[VPDP(pdpe_addr)];
+  80196b:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80196f:	48 b9 00 00 40 80 00 	movabs $0x10080400000,%rcx
+  801976:	01 00 00 
+  801979:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+            if (!(pdpe & PTE_P)) {
+  80197d:	a8 01                	test   $0x1,%al
+  80197f:	74 c9                	je     80194a <foreach_shared_region+0xd9>
+            if (pdpe & PTE_PS) {
+  801981:	48 89 c1             	mov    %rax,%rcx
+  801984:	81 e1 80 00 00 00    	and    $0x80,%ecx
+  80198a:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  80198e:	0f 84 0c ff ff ff    	je     8018a0 <foreach_shared_region+0x2f>
+                if (pdpe & PTE_SHARE) {
+  801994:	f6 c4 04             	test   $0x4,%ah
+  801997:	74 b1                	je     80194a <foreach_shared_region+0xd9>
+                    fun((void*)pdpe_addr, (void*)(pdpe_addr + 1024 * 1024 * 1024), arg); 
+  801999:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  80199d:	48 8d b7 00 00 00 40 	lea    0x40000000(%rdi),%rsi
+  8019a4:	4c 89 fa             	mov    %r15,%rdx
+  8019a7:	41 ff d4             	call   *%r12
+  8019aa:	eb 9e                	jmp    80194a <foreach_shared_region+0xd9>
+    for (int pml4ei = 0; pml4ei < PML4_ENTRY_COUNT; pml4ei++) {
+  8019ac:	49 83 c6 01          	add    $0x1,%r14
+  8019b0:	49 81 fe 00 02 00 00 	cmp    $0x200,%r14
+  8019b7:	74 24                	je     8019dd <foreach_shared_region+0x16c>
+        pml4e_t pml4e = uvpml4[VPML4(pml4_addr)];
+  8019b9:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  8019c0:	01 00 00 
+  8019c3:	4a 8b 04 f0          	mov    (%rax,%r14,8),%rax
+        if (!(pml4e & PTE_P)) {
+  8019c7:	a8 01                	test   $0x1,%al
+  8019c9:	74 e1                	je     8019ac <foreach_shared_region+0x13b>
+  8019cb:	4c 89 f0             	mov    %r14,%rax
+  8019ce:	48 c1 e0 27          	shl    $0x27,%rax
+  8019d2:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8019d6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8019db:	eb 83                	jmp    801960 <foreach_shared_region+0xef>
+            }
+        }
+    }
+    
+    return 0;
+}
+  8019dd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019e2:	48 83 c4 38          	add    $0x38,%rsp
+  8019e6:	5b                   	pop    %rbx
+  8019e7:	41 5c                	pop    %r12
+  8019e9:	41 5d                	pop    %r13
+  8019eb:	41 5e                	pop    %r14
+  8019ed:	41 5f                	pop    %r15
+  8019ef:	5d                   	pop    %rbp
+  8019f0:	c3                   	ret
+
+00000000008019f1 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  8019f1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019f6:	c3                   	ret
+
+00000000008019f7 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  8019f7:	55                   	push   %rbp
+  8019f8:	48 89 e5             	mov    %rsp,%rbp
+  8019fb:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  8019fe:	48 be b4 2d 80 00 00 	movabs $0x802db4,%rsi
+  801a05:	00 00 00 
+  801a08:	48 b8 91 26 80 00 00 	movabs $0x802691,%rax
+  801a0f:	00 00 00 
+  801a12:	ff d0                	call   *%rax
+    return 0;
+}
+  801a14:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a19:	5d                   	pop    %rbp
+  801a1a:	c3                   	ret
+
+0000000000801a1b <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  801a1b:	55                   	push   %rbp
+  801a1c:	48 89 e5             	mov    %rsp,%rbp
+  801a1f:	41 57                	push   %r15
+  801a21:	41 56                	push   %r14
+  801a23:	41 55                	push   %r13
+  801a25:	41 54                	push   %r12
+  801a27:	53                   	push   %rbx
+  801a28:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  801a2f:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  801a36:	48 85 d2             	test   %rdx,%rdx
+  801a39:	74 7a                	je     801ab5 <devcons_write+0x9a>
+  801a3b:	49 89 d6             	mov    %rdx,%r14
+  801a3e:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  801a44:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  801a49:	49 bf 8b 28 80 00 00 	movabs $0x80288b,%r15
+  801a50:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  801a53:	4c 89 f3             	mov    %r14,%rbx
+  801a56:	48 29 f3             	sub    %rsi,%rbx
+  801a59:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  801a5e:	48 39 c3             	cmp    %rax,%rbx
+  801a61:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  801a65:	4c 63 eb             	movslq %ebx,%r13
+  801a68:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  801a6f:	48 01 c6             	add    %rax,%rsi
+  801a72:	4c 89 ea             	mov    %r13,%rdx
+  801a75:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  801a7c:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  801a7f:	4c 89 ee             	mov    %r13,%rsi
+  801a82:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  801a89:	48 b8 02 01 80 00 00 	movabs $0x800102,%rax
+  801a90:	00 00 00 
+  801a93:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  801a95:	41 01 dc             	add    %ebx,%r12d
+  801a98:	49 63 f4             	movslq %r12d,%rsi
+  801a9b:	4c 39 f6             	cmp    %r14,%rsi
+  801a9e:	72 b3                	jb     801a53 <devcons_write+0x38>
+    return res;
+  801aa0:	49 63 c4             	movslq %r12d,%rax
+}
+  801aa3:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  801aaa:	5b                   	pop    %rbx
+  801aab:	41 5c                	pop    %r12
+  801aad:	41 5d                	pop    %r13
+  801aaf:	41 5e                	pop    %r14
+  801ab1:	41 5f                	pop    %r15
+  801ab3:	5d                   	pop    %rbp
+  801ab4:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  801ab5:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  801abb:	eb e3                	jmp    801aa0 <devcons_write+0x85>
+
+0000000000801abd <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  801abd:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  801ac0:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ac5:	48 85 c0             	test   %rax,%rax
+  801ac8:	74 55                	je     801b1f <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  801aca:	55                   	push   %rbp
+  801acb:	48 89 e5             	mov    %rsp,%rbp
+  801ace:	41 55                	push   %r13
+  801ad0:	41 54                	push   %r12
+  801ad2:	53                   	push   %rbx
+  801ad3:	48 83 ec 08          	sub    $0x8,%rsp
+  801ad7:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  801ada:	48 bb 2f 01 80 00 00 	movabs $0x80012f,%rbx
+  801ae1:	00 00 00 
+  801ae4:	49 bc fc 01 80 00 00 	movabs $0x8001fc,%r12
+  801aeb:	00 00 00 
+  801aee:	eb 03                	jmp    801af3 <devcons_read+0x36>
+  801af0:	41 ff d4             	call   *%r12
+  801af3:	ff d3                	call   *%rbx
+  801af5:	85 c0                	test   %eax,%eax
+  801af7:	74 f7                	je     801af0 <devcons_read+0x33>
+    if (c < 0) return c;
+  801af9:	48 63 d0             	movslq %eax,%rdx
+  801afc:	78 13                	js     801b11 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  801afe:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b03:	83 f8 04             	cmp    $0x4,%eax
+  801b06:	74 09                	je     801b11 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  801b08:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  801b0c:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  801b11:	48 89 d0             	mov    %rdx,%rax
+  801b14:	48 83 c4 08          	add    $0x8,%rsp
+  801b18:	5b                   	pop    %rbx
+  801b19:	41 5c                	pop    %r12
+  801b1b:	41 5d                	pop    %r13
+  801b1d:	5d                   	pop    %rbp
+  801b1e:	c3                   	ret
+  801b1f:	48 89 d0             	mov    %rdx,%rax
+  801b22:	c3                   	ret
+
+0000000000801b23 <cputchar>:
+cputchar(int ch) {
+  801b23:	55                   	push   %rbp
+  801b24:	48 89 e5             	mov    %rsp,%rbp
+  801b27:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  801b2b:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  801b2f:	be 01 00 00 00       	mov    $0x1,%esi
+  801b34:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  801b38:	48 b8 02 01 80 00 00 	movabs $0x800102,%rax
+  801b3f:	00 00 00 
+  801b42:	ff d0                	call   *%rax
+}
+  801b44:	c9                   	leave
+  801b45:	c3                   	ret
+
+0000000000801b46 <getchar>:
+getchar(void) {
+  801b46:	55                   	push   %rbp
+  801b47:	48 89 e5             	mov    %rsp,%rbp
+  801b4a:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  801b4e:	ba 01 00 00 00       	mov    $0x1,%edx
+  801b53:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  801b57:	bf 00 00 00 00       	mov    $0x0,%edi
+  801b5c:	48 b8 6a 0a 80 00 00 	movabs $0x800a6a,%rax
+  801b63:	00 00 00 
+  801b66:	ff d0                	call   *%rax
+  801b68:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  801b6a:	85 c0                	test   %eax,%eax
+  801b6c:	78 06                	js     801b74 <getchar+0x2e>
+  801b6e:	74 08                	je     801b78 <getchar+0x32>
+  801b70:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  801b74:	89 d0                	mov    %edx,%eax
+  801b76:	c9                   	leave
+  801b77:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  801b78:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  801b7d:	eb f5                	jmp    801b74 <getchar+0x2e>
+
+0000000000801b7f <iscons>:
+iscons(int fdnum) {
+  801b7f:	55                   	push   %rbp
+  801b80:	48 89 e5             	mov    %rsp,%rbp
+  801b83:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  801b87:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801b8b:	48 b8 87 07 80 00 00 	movabs $0x800787,%rax
+  801b92:	00 00 00 
+  801b95:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801b97:	85 c0                	test   %eax,%eax
+  801b99:	78 18                	js     801bb3 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  801b9b:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801b9f:	48 b8 a0 40 80 00 00 	movabs $0x8040a0,%rax
+  801ba6:	00 00 00 
+  801ba9:	8b 00                	mov    (%rax),%eax
+  801bab:	39 02                	cmp    %eax,(%rdx)
+  801bad:	0f 94 c0             	sete   %al
+  801bb0:	0f b6 c0             	movzbl %al,%eax
+}
+  801bb3:	c9                   	leave
+  801bb4:	c3                   	ret
+
+0000000000801bb5 <opencons>:
+opencons(void) {
+  801bb5:	55                   	push   %rbp
+  801bb6:	48 89 e5             	mov    %rsp,%rbp
+  801bb9:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  801bbd:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  801bc1:	48 b8 6d 07 80 00 00 	movabs $0x80076d,%rax
+  801bc8:	00 00 00 
+  801bcb:	ff d0                	call   *%rax
+  801bcd:	85 c0                	test   %eax,%eax
+  801bcf:	78 49                	js     801c1a <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  801bd1:	b9 46 00 00 00       	mov    $0x46,%ecx
+  801bd6:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801bdb:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  801bdf:	bf 00 00 00 00       	mov    $0x0,%edi
+  801be4:	48 b8 8b 02 80 00 00 	movabs $0x80028b,%rax
+  801beb:	00 00 00 
+  801bee:	ff d0                	call   *%rax
+  801bf0:	85 c0                	test   %eax,%eax
+  801bf2:	78 26                	js     801c1a <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  801bf4:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801bf8:	a1 a0 40 80 00 00 00 	movabs 0x8040a0,%eax
+  801bff:	00 00 
+  801c01:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  801c03:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801c07:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  801c0e:	48 b8 c6 06 80 00 00 	movabs $0x8006c6,%rax
+  801c15:	00 00 00 
+  801c18:	ff d0                	call   *%rax
+}
+  801c1a:	c9                   	leave
+  801c1b:	c3                   	ret
+
+0000000000801c1c <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  801c1c:	55                   	push   %rbp
+  801c1d:	48 89 e5             	mov    %rsp,%rbp
+  801c20:	41 56                	push   %r14
+  801c22:	41 55                	push   %r13
+  801c24:	41 54                	push   %r12
+  801c26:	53                   	push   %rbx
+  801c27:	48 83 ec 50          	sub    $0x50,%rsp
+  801c2b:	49 89 fc             	mov    %rdi,%r12
+  801c2e:	41 89 f5             	mov    %esi,%r13d
+  801c31:	48 89 d3             	mov    %rdx,%rbx
+  801c34:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  801c38:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  801c3c:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  801c40:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  801c47:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801c4b:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  801c4f:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  801c53:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  801c57:	48 b8 00 40 80 00 00 	movabs $0x804000,%rax
+  801c5e:	00 00 00 
+  801c61:	4c 8b 30             	mov    (%rax),%r14
+  801c64:	48 b8 cb 01 80 00 00 	movabs $0x8001cb,%rax
+  801c6b:	00 00 00 
+  801c6e:	ff d0                	call   *%rax
+  801c70:	89 c6                	mov    %eax,%esi
+  801c72:	45 89 e8             	mov    %r13d,%r8d
+  801c75:	4c 89 e1             	mov    %r12,%rcx
+  801c78:	4c 89 f2             	mov    %r14,%rdx
+  801c7b:	48 bf c0 2d 80 00 00 	movabs $0x802dc0,%rdi
+  801c82:	00 00 00 
+  801c85:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c8a:	49 bc 6c 1d 80 00 00 	movabs $0x801d6c,%r12
+  801c91:	00 00 00 
+  801c94:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  801c97:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  801c9b:	48 89 df             	mov    %rbx,%rdi
+  801c9e:	48 b8 08 1d 80 00 00 	movabs $0x801d08,%rax
+  801ca5:	00 00 00 
+  801ca8:	ff d0                	call   *%rax
+    cprintf("\n");
+  801caa:	48 bf 1b 2d 80 00 00 	movabs $0x802d1b,%rdi
+  801cb1:	00 00 00 
+  801cb4:	b8 00 00 00 00       	mov    $0x0,%eax
+  801cb9:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  801cbc:	cc                   	int3
+  801cbd:	eb fd                	jmp    801cbc <_panic+0xa0>
+
+0000000000801cbf <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  801cbf:	55                   	push   %rbp
+  801cc0:	48 89 e5             	mov    %rsp,%rbp
+  801cc3:	53                   	push   %rbx
+  801cc4:	48 83 ec 08          	sub    $0x8,%rsp
+  801cc8:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  801ccb:	8b 06                	mov    (%rsi),%eax
+  801ccd:	8d 50 01             	lea    0x1(%rax),%edx
+  801cd0:	89 16                	mov    %edx,(%rsi)
+  801cd2:	48 98                	cltq
+  801cd4:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  801cd9:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  801cdf:	74 0a                	je     801ceb <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  801ce1:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  801ce5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801ce9:	c9                   	leave
+  801cea:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  801ceb:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  801cef:	be ff 00 00 00       	mov    $0xff,%esi
+  801cf4:	48 b8 02 01 80 00 00 	movabs $0x800102,%rax
+  801cfb:	00 00 00 
+  801cfe:	ff d0                	call   *%rax
+        state->offset = 0;
+  801d00:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  801d06:	eb d9                	jmp    801ce1 <putch+0x22>
+
+0000000000801d08 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  801d08:	55                   	push   %rbp
+  801d09:	48 89 e5             	mov    %rsp,%rbp
+  801d0c:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  801d13:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  801d16:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  801d1d:	b9 21 00 00 00       	mov    $0x21,%ecx
+  801d22:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d27:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  801d2a:	48 89 f1             	mov    %rsi,%rcx
+  801d2d:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  801d34:	48 bf bf 1c 80 00 00 	movabs $0x801cbf,%rdi
+  801d3b:	00 00 00 
+  801d3e:	48 b8 bc 1e 80 00 00 	movabs $0x801ebc,%rax
+  801d45:	00 00 00 
+  801d48:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  801d4a:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  801d51:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  801d58:	48 b8 02 01 80 00 00 	movabs $0x800102,%rax
+  801d5f:	00 00 00 
+  801d62:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  801d64:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  801d6a:	c9                   	leave
+  801d6b:	c3                   	ret
+
+0000000000801d6c <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  801d6c:	55                   	push   %rbp
+  801d6d:	48 89 e5             	mov    %rsp,%rbp
+  801d70:	48 83 ec 50          	sub    $0x50,%rsp
+  801d74:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  801d78:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  801d7c:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801d80:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  801d84:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  801d88:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  801d8f:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801d93:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801d97:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  801d9b:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  801d9f:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  801da3:	48 b8 08 1d 80 00 00 	movabs $0x801d08,%rax
+  801daa:	00 00 00 
+  801dad:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  801daf:	c9                   	leave
+  801db0:	c3                   	ret
+
+0000000000801db1 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  801db1:	55                   	push   %rbp
+  801db2:	48 89 e5             	mov    %rsp,%rbp
+  801db5:	41 57                	push   %r15
+  801db7:	41 56                	push   %r14
+  801db9:	41 55                	push   %r13
+  801dbb:	41 54                	push   %r12
+  801dbd:	53                   	push   %rbx
+  801dbe:	48 83 ec 18          	sub    $0x18,%rsp
+  801dc2:	49 89 fc             	mov    %rdi,%r12
+  801dc5:	49 89 f5             	mov    %rsi,%r13
+  801dc8:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801dcc:	8b 45 10             	mov    0x10(%rbp),%eax
+  801dcf:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  801dd2:	41 89 cf             	mov    %ecx,%r15d
+  801dd5:	4c 39 fa             	cmp    %r15,%rdx
+  801dd8:	73 5b                	jae    801e35 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  801dda:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  801dde:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  801de2:	85 db                	test   %ebx,%ebx
+  801de4:	7e 0e                	jle    801df4 <print_num+0x43>
+            putch(padc, put_arg);
+  801de6:	4c 89 ee             	mov    %r13,%rsi
+  801de9:	44 89 f7             	mov    %r14d,%edi
+  801dec:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  801def:	83 eb 01             	sub    $0x1,%ebx
+  801df2:	75 f2                	jne    801de6 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  801df4:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  801df8:	48 b9 f4 2d 80 00 00 	movabs $0x802df4,%rcx
+  801dff:	00 00 00 
+  801e02:	48 b8 e3 2d 80 00 00 	movabs $0x802de3,%rax
+  801e09:	00 00 00 
+  801e0c:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  801e10:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801e14:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e19:	49 f7 f7             	div    %r15
+  801e1c:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  801e20:	4c 89 ee             	mov    %r13,%rsi
+  801e23:	41 ff d4             	call   *%r12
+}
+  801e26:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  801e2a:	5b                   	pop    %rbx
+  801e2b:	41 5c                	pop    %r12
+  801e2d:	41 5d                	pop    %r13
+  801e2f:	41 5e                	pop    %r14
+  801e31:	41 5f                	pop    %r15
+  801e33:	5d                   	pop    %rbp
+  801e34:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  801e35:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801e39:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e3e:	49 f7 f7             	div    %r15
+  801e41:	48 83 ec 08          	sub    $0x8,%rsp
+  801e45:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  801e49:	52                   	push   %rdx
+  801e4a:	45 0f be c9          	movsbl %r9b,%r9d
+  801e4e:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  801e52:	48 89 c2             	mov    %rax,%rdx
+  801e55:	48 b8 b1 1d 80 00 00 	movabs $0x801db1,%rax
+  801e5c:	00 00 00 
+  801e5f:	ff d0                	call   *%rax
+  801e61:	48 83 c4 10          	add    $0x10,%rsp
+  801e65:	eb 8d                	jmp    801df4 <print_num+0x43>
+
+0000000000801e67 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  801e67:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  801e6b:	48 8b 06             	mov    (%rsi),%rax
+  801e6e:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  801e72:	73 0a                	jae    801e7e <sprintputch+0x17>
+        *state->start++ = ch;
+  801e74:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801e78:	48 89 16             	mov    %rdx,(%rsi)
+  801e7b:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  801e7e:	c3                   	ret
+
+0000000000801e7f <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  801e7f:	55                   	push   %rbp
+  801e80:	48 89 e5             	mov    %rsp,%rbp
+  801e83:	48 83 ec 50          	sub    $0x50,%rsp
+  801e87:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801e8b:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  801e8f:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  801e93:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  801e9a:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801e9e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801ea2:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  801ea6:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  801eaa:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  801eae:	48 b8 bc 1e 80 00 00 	movabs $0x801ebc,%rax
+  801eb5:	00 00 00 
+  801eb8:	ff d0                	call   *%rax
+}
+  801eba:	c9                   	leave
+  801ebb:	c3                   	ret
+
+0000000000801ebc <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  801ebc:	55                   	push   %rbp
+  801ebd:	48 89 e5             	mov    %rsp,%rbp
+  801ec0:	41 57                	push   %r15
+  801ec2:	41 56                	push   %r14
+  801ec4:	41 55                	push   %r13
+  801ec6:	41 54                	push   %r12
+  801ec8:	53                   	push   %rbx
+  801ec9:	48 83 ec 38          	sub    $0x38,%rsp
+  801ecd:	49 89 fe             	mov    %rdi,%r14
+  801ed0:	49 89 f5             	mov    %rsi,%r13
+  801ed3:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  801ed6:	48 8b 01             	mov    (%rcx),%rax
+  801ed9:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  801edd:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  801ee1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801ee5:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  801ee9:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  801eed:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  801ef1:	0f b6 3b             	movzbl (%rbx),%edi
+  801ef4:	40 80 ff 25          	cmp    $0x25,%dil
+  801ef8:	74 18                	je     801f12 <vprintfmt+0x56>
+            if (!ch) return;
+  801efa:	40 84 ff             	test   %dil,%dil
+  801efd:	0f 84 b1 06 00 00    	je     8025b4 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  801f03:	40 0f b6 ff          	movzbl %dil,%edi
+  801f07:	4c 89 ee             	mov    %r13,%rsi
+  801f0a:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  801f0d:	4c 89 e3             	mov    %r12,%rbx
+  801f10:	eb db                	jmp    801eed <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  801f12:	be 00 00 00 00       	mov    $0x0,%esi
+  801f17:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  801f1b:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  801f20:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  801f26:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  801f2d:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  801f31:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  801f36:	41 0f b6 04 24       	movzbl (%r12),%eax
+  801f3b:	88 45 a0             	mov    %al,-0x60(%rbp)
+  801f3e:	83 e8 23             	sub    $0x23,%eax
+  801f41:	3c 57                	cmp    $0x57,%al
+  801f43:	0f 87 51 06 00 00    	ja     80259a <vprintfmt+0x6de>
+  801f49:	0f b6 c0             	movzbl %al,%eax
+  801f4c:	48 b9 a0 2f 80 00 00 	movabs $0x802fa0,%rcx
+  801f53:	00 00 00 
+  801f56:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  801f59:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  801f5c:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  801f60:	eb cf                	jmp    801f31 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  801f62:	49 89 dc             	mov    %rbx,%r12
+  801f65:	be 01 00 00 00       	mov    $0x1,%esi
+  801f6a:	eb c5                	jmp    801f31 <vprintfmt+0x75>
+            padc = ch;
+  801f6c:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  801f70:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  801f73:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801f76:	eb b9                	jmp    801f31 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  801f78:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801f7b:	83 f8 2f             	cmp    $0x2f,%eax
+  801f7e:	77 24                	ja     801fa4 <vprintfmt+0xe8>
+  801f80:	89 c1                	mov    %eax,%ecx
+  801f82:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  801f86:	83 c0 08             	add    $0x8,%eax
+  801f89:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801f8c:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  801f8f:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  801f92:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  801f96:	79 99                	jns    801f31 <vprintfmt+0x75>
+                width = precision;
+  801f98:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  801f9c:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  801fa2:	eb 8d                	jmp    801f31 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  801fa4:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  801fa8:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  801fac:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801fb0:	eb da                	jmp    801f8c <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  801fb2:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  801fb7:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  801fbb:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  801fc1:	3c 39                	cmp    $0x39,%al
+  801fc3:	77 1c                	ja     801fe1 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  801fc5:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  801fc9:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  801fcd:	0f b6 c0             	movzbl %al,%eax
+  801fd0:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  801fd5:	0f b6 03             	movzbl (%rbx),%eax
+  801fd8:	3c 39                	cmp    $0x39,%al
+  801fda:	76 e9                	jbe    801fc5 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  801fdc:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  801fdf:	eb b1                	jmp    801f92 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  801fe1:	49 89 dc             	mov    %rbx,%r12
+  801fe4:	eb ac                	jmp    801f92 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  801fe6:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  801fe9:	85 c9                	test   %ecx,%ecx
+  801feb:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ff0:	0f 49 c1             	cmovns %ecx,%eax
+  801ff3:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  801ff6:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801ff9:	e9 33 ff ff ff       	jmp    801f31 <vprintfmt+0x75>
+            lflag++;
+  801ffe:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  802001:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  802004:	e9 28 ff ff ff       	jmp    801f31 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  802009:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80200c:	83 f8 2f             	cmp    $0x2f,%eax
+  80200f:	77 19                	ja     80202a <vprintfmt+0x16e>
+  802011:	89 c2                	mov    %eax,%edx
+  802013:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802017:	83 c0 08             	add    $0x8,%eax
+  80201a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80201d:	8b 3a                	mov    (%rdx),%edi
+  80201f:	4c 89 ee             	mov    %r13,%rsi
+  802022:	41 ff d6             	call   *%r14
+            break;
+  802025:	e9 c3 fe ff ff       	jmp    801eed <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  80202a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80202e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802032:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802036:	eb e5                	jmp    80201d <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  802038:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80203b:	83 f8 2f             	cmp    $0x2f,%eax
+  80203e:	77 5a                	ja     80209a <vprintfmt+0x1de>
+  802040:	89 c2                	mov    %eax,%edx
+  802042:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802046:	83 c0 08             	add    $0x8,%eax
+  802049:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  80204c:	8b 02                	mov    (%rdx),%eax
+  80204e:	89 c1                	mov    %eax,%ecx
+  802050:	f7 d9                	neg    %ecx
+  802052:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  802055:	83 f9 15             	cmp    $0x15,%ecx
+  802058:	7f 4e                	jg     8020a8 <vprintfmt+0x1ec>
+  80205a:	48 63 c1             	movslq %ecx,%rax
+  80205d:	48 ba 60 32 80 00 00 	movabs $0x803260,%rdx
+  802064:	00 00 00 
+  802067:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80206b:	48 85 c0             	test   %rax,%rax
+  80206e:	74 38                	je     8020a8 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  802070:	48 89 c1             	mov    %rax,%rcx
+  802073:	48 ba 79 2d 80 00 00 	movabs $0x802d79,%rdx
+  80207a:	00 00 00 
+  80207d:	4c 89 ee             	mov    %r13,%rsi
+  802080:	4c 89 f7             	mov    %r14,%rdi
+  802083:	b8 00 00 00 00       	mov    $0x0,%eax
+  802088:	49 b8 7f 1e 80 00 00 	movabs $0x801e7f,%r8
+  80208f:	00 00 00 
+  802092:	41 ff d0             	call   *%r8
+  802095:	e9 53 fe ff ff       	jmp    801eed <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  80209a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80209e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8020a2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8020a6:	eb a4                	jmp    80204c <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  8020a8:	48 ba 0c 2e 80 00 00 	movabs $0x802e0c,%rdx
+  8020af:	00 00 00 
+  8020b2:	4c 89 ee             	mov    %r13,%rsi
+  8020b5:	4c 89 f7             	mov    %r14,%rdi
+  8020b8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020bd:	49 b8 7f 1e 80 00 00 	movabs $0x801e7f,%r8
+  8020c4:	00 00 00 
+  8020c7:	41 ff d0             	call   *%r8
+  8020ca:	e9 1e fe ff ff       	jmp    801eed <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8020cf:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8020d2:	83 f8 2f             	cmp    $0x2f,%eax
+  8020d5:	77 6c                	ja     802143 <vprintfmt+0x287>
+  8020d7:	89 c2                	mov    %eax,%edx
+  8020d9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8020dd:	83 c0 08             	add    $0x8,%eax
+  8020e0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8020e3:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  8020e6:	48 85 d2             	test   %rdx,%rdx
+  8020e9:	48 b8 05 2e 80 00 00 	movabs $0x802e05,%rax
+  8020f0:	00 00 00 
+  8020f3:	48 0f 45 c2          	cmovne %rdx,%rax
+  8020f7:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  8020fb:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8020ff:	7e 06                	jle    802107 <vprintfmt+0x24b>
+  802101:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  802105:	75 4a                	jne    802151 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  802107:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  80210b:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  80210f:	0f b6 00             	movzbl (%rax),%eax
+  802112:	84 c0                	test   %al,%al
+  802114:	0f 85 9a 00 00 00    	jne    8021b4 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  80211a:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80211d:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  802121:	85 c0                	test   %eax,%eax
+  802123:	0f 8e c4 fd ff ff    	jle    801eed <vprintfmt+0x31>
+  802129:	4c 89 ee             	mov    %r13,%rsi
+  80212c:	bf 20 00 00 00       	mov    $0x20,%edi
+  802131:	41 ff d6             	call   *%r14
+  802134:	41 83 ec 01          	sub    $0x1,%r12d
+  802138:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  80213c:	75 eb                	jne    802129 <vprintfmt+0x26d>
+  80213e:	e9 aa fd ff ff       	jmp    801eed <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  802143:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802147:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80214b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80214f:	eb 92                	jmp    8020e3 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  802151:	49 63 f7             	movslq %r15d,%rsi
+  802154:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  802158:	48 b8 6e 26 80 00 00 	movabs $0x80266e,%rax
+  80215f:	00 00 00 
+  802162:	ff d0                	call   *%rax
+  802164:	48 89 c2             	mov    %rax,%rdx
+  802167:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80216a:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  80216c:	8d 70 ff             	lea    -0x1(%rax),%esi
+  80216f:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  802172:	85 c0                	test   %eax,%eax
+  802174:	7e 91                	jle    802107 <vprintfmt+0x24b>
+  802176:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  80217b:	4c 89 ee             	mov    %r13,%rsi
+  80217e:	44 89 e7             	mov    %r12d,%edi
+  802181:	41 ff d6             	call   *%r14
+  802184:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  802188:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80218b:	83 f8 ff             	cmp    $0xffffffff,%eax
+  80218e:	75 eb                	jne    80217b <vprintfmt+0x2bf>
+  802190:	e9 72 ff ff ff       	jmp    802107 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  802195:	0f b6 f8             	movzbl %al,%edi
+  802198:	4c 89 ee             	mov    %r13,%rsi
+  80219b:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  80219e:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8021a2:	49 83 c4 01          	add    $0x1,%r12
+  8021a6:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  8021ac:	84 c0                	test   %al,%al
+  8021ae:	0f 84 66 ff ff ff    	je     80211a <vprintfmt+0x25e>
+  8021b4:	45 85 ff             	test   %r15d,%r15d
+  8021b7:	78 0a                	js     8021c3 <vprintfmt+0x307>
+  8021b9:	41 83 ef 01          	sub    $0x1,%r15d
+  8021bd:	0f 88 57 ff ff ff    	js     80211a <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8021c3:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  8021c7:	74 cc                	je     802195 <vprintfmt+0x2d9>
+  8021c9:	8d 50 e0             	lea    -0x20(%rax),%edx
+  8021cc:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  8021d1:	80 fa 5e             	cmp    $0x5e,%dl
+  8021d4:	77 c2                	ja     802198 <vprintfmt+0x2dc>
+  8021d6:	eb bd                	jmp    802195 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  8021d8:	40 84 f6             	test   %sil,%sil
+  8021db:	75 26                	jne    802203 <vprintfmt+0x347>
+    switch (lflag) {
+  8021dd:	85 d2                	test   %edx,%edx
+  8021df:	74 59                	je     80223a <vprintfmt+0x37e>
+  8021e1:	83 fa 01             	cmp    $0x1,%edx
+  8021e4:	74 7b                	je     802261 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  8021e6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8021e9:	83 f8 2f             	cmp    $0x2f,%eax
+  8021ec:	0f 87 96 00 00 00    	ja     802288 <vprintfmt+0x3cc>
+  8021f2:	89 c2                	mov    %eax,%edx
+  8021f4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8021f8:	83 c0 08             	add    $0x8,%eax
+  8021fb:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8021fe:	4c 8b 22             	mov    (%rdx),%r12
+  802201:	eb 17                	jmp    80221a <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  802203:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802206:	83 f8 2f             	cmp    $0x2f,%eax
+  802209:	77 21                	ja     80222c <vprintfmt+0x370>
+  80220b:	89 c2                	mov    %eax,%edx
+  80220d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802211:	83 c0 08             	add    $0x8,%eax
+  802214:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802217:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  80221a:	4d 85 e4             	test   %r12,%r12
+  80221d:	78 7a                	js     802299 <vprintfmt+0x3dd>
+            num = i;
+  80221f:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  802222:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  802227:	e9 50 02 00 00       	jmp    80247c <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  80222c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802230:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802234:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802238:	eb dd                	jmp    802217 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  80223a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80223d:	83 f8 2f             	cmp    $0x2f,%eax
+  802240:	77 11                	ja     802253 <vprintfmt+0x397>
+  802242:	89 c2                	mov    %eax,%edx
+  802244:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802248:	83 c0 08             	add    $0x8,%eax
+  80224b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80224e:	4c 63 22             	movslq (%rdx),%r12
+  802251:	eb c7                	jmp    80221a <vprintfmt+0x35e>
+  802253:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802257:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80225b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80225f:	eb ed                	jmp    80224e <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  802261:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802264:	83 f8 2f             	cmp    $0x2f,%eax
+  802267:	77 11                	ja     80227a <vprintfmt+0x3be>
+  802269:	89 c2                	mov    %eax,%edx
+  80226b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80226f:	83 c0 08             	add    $0x8,%eax
+  802272:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802275:	4c 8b 22             	mov    (%rdx),%r12
+  802278:	eb a0                	jmp    80221a <vprintfmt+0x35e>
+  80227a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80227e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802282:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802286:	eb ed                	jmp    802275 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  802288:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80228c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802290:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802294:	e9 65 ff ff ff       	jmp    8021fe <vprintfmt+0x342>
+                putch('-', put_arg);
+  802299:	4c 89 ee             	mov    %r13,%rsi
+  80229c:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  8022a1:	41 ff d6             	call   *%r14
+                i = -i;
+  8022a4:	49 f7 dc             	neg    %r12
+  8022a7:	e9 73 ff ff ff       	jmp    80221f <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  8022ac:	40 84 f6             	test   %sil,%sil
+  8022af:	75 32                	jne    8022e3 <vprintfmt+0x427>
+    switch (lflag) {
+  8022b1:	85 d2                	test   %edx,%edx
+  8022b3:	74 5d                	je     802312 <vprintfmt+0x456>
+  8022b5:	83 fa 01             	cmp    $0x1,%edx
+  8022b8:	0f 84 82 00 00 00    	je     802340 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  8022be:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8022c1:	83 f8 2f             	cmp    $0x2f,%eax
+  8022c4:	0f 87 a5 00 00 00    	ja     80236f <vprintfmt+0x4b3>
+  8022ca:	89 c2                	mov    %eax,%edx
+  8022cc:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8022d0:	83 c0 08             	add    $0x8,%eax
+  8022d3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8022d6:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8022d9:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  8022de:	e9 99 01 00 00       	jmp    80247c <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8022e3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8022e6:	83 f8 2f             	cmp    $0x2f,%eax
+  8022e9:	77 19                	ja     802304 <vprintfmt+0x448>
+  8022eb:	89 c2                	mov    %eax,%edx
+  8022ed:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8022f1:	83 c0 08             	add    $0x8,%eax
+  8022f4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8022f7:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8022fa:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8022ff:	e9 78 01 00 00       	jmp    80247c <vprintfmt+0x5c0>
+  802304:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802308:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80230c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802310:	eb e5                	jmp    8022f7 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  802312:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802315:	83 f8 2f             	cmp    $0x2f,%eax
+  802318:	77 18                	ja     802332 <vprintfmt+0x476>
+  80231a:	89 c2                	mov    %eax,%edx
+  80231c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802320:	83 c0 08             	add    $0x8,%eax
+  802323:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802326:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  802328:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  80232d:	e9 4a 01 00 00       	jmp    80247c <vprintfmt+0x5c0>
+  802332:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802336:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80233a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80233e:	eb e6                	jmp    802326 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  802340:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802343:	83 f8 2f             	cmp    $0x2f,%eax
+  802346:	77 19                	ja     802361 <vprintfmt+0x4a5>
+  802348:	89 c2                	mov    %eax,%edx
+  80234a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80234e:	83 c0 08             	add    $0x8,%eax
+  802351:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802354:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  802357:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  80235c:	e9 1b 01 00 00       	jmp    80247c <vprintfmt+0x5c0>
+  802361:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802365:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802369:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80236d:	eb e5                	jmp    802354 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  80236f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802373:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802377:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80237b:	e9 56 ff ff ff       	jmp    8022d6 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  802380:	40 84 f6             	test   %sil,%sil
+  802383:	75 2e                	jne    8023b3 <vprintfmt+0x4f7>
+    switch (lflag) {
+  802385:	85 d2                	test   %edx,%edx
+  802387:	74 59                	je     8023e2 <vprintfmt+0x526>
+  802389:	83 fa 01             	cmp    $0x1,%edx
+  80238c:	74 7f                	je     80240d <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  80238e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802391:	83 f8 2f             	cmp    $0x2f,%eax
+  802394:	0f 87 9f 00 00 00    	ja     802439 <vprintfmt+0x57d>
+  80239a:	89 c2                	mov    %eax,%edx
+  80239c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8023a0:	83 c0 08             	add    $0x8,%eax
+  8023a3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8023a6:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8023a9:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  8023ae:	e9 c9 00 00 00       	jmp    80247c <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8023b3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8023b6:	83 f8 2f             	cmp    $0x2f,%eax
+  8023b9:	77 19                	ja     8023d4 <vprintfmt+0x518>
+  8023bb:	89 c2                	mov    %eax,%edx
+  8023bd:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8023c1:	83 c0 08             	add    $0x8,%eax
+  8023c4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8023c7:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8023ca:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8023cf:	e9 a8 00 00 00       	jmp    80247c <vprintfmt+0x5c0>
+  8023d4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8023d8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8023dc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8023e0:	eb e5                	jmp    8023c7 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  8023e2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8023e5:	83 f8 2f             	cmp    $0x2f,%eax
+  8023e8:	77 15                	ja     8023ff <vprintfmt+0x543>
+  8023ea:	89 c2                	mov    %eax,%edx
+  8023ec:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8023f0:	83 c0 08             	add    $0x8,%eax
+  8023f3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8023f6:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  8023f8:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  8023fd:	eb 7d                	jmp    80247c <vprintfmt+0x5c0>
+  8023ff:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802403:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802407:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80240b:	eb e9                	jmp    8023f6 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  80240d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802410:	83 f8 2f             	cmp    $0x2f,%eax
+  802413:	77 16                	ja     80242b <vprintfmt+0x56f>
+  802415:	89 c2                	mov    %eax,%edx
+  802417:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80241b:	83 c0 08             	add    $0x8,%eax
+  80241e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802421:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  802424:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  802429:	eb 51                	jmp    80247c <vprintfmt+0x5c0>
+  80242b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80242f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802433:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802437:	eb e8                	jmp    802421 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  802439:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80243d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802441:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802445:	e9 5c ff ff ff       	jmp    8023a6 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  80244a:	4c 89 ee             	mov    %r13,%rsi
+  80244d:	bf 30 00 00 00       	mov    $0x30,%edi
+  802452:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  802455:	4c 89 ee             	mov    %r13,%rsi
+  802458:	bf 78 00 00 00       	mov    $0x78,%edi
+  80245d:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  802460:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802463:	83 f8 2f             	cmp    $0x2f,%eax
+  802466:	77 47                	ja     8024af <vprintfmt+0x5f3>
+  802468:	89 c2                	mov    %eax,%edx
+  80246a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80246e:	83 c0 08             	add    $0x8,%eax
+  802471:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802474:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  802477:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  80247c:	48 83 ec 08          	sub    $0x8,%rsp
+  802480:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  802484:	0f 94 c0             	sete   %al
+  802487:	0f b6 c0             	movzbl %al,%eax
+  80248a:	50                   	push   %rax
+  80248b:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  802490:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  802494:	4c 89 ee             	mov    %r13,%rsi
+  802497:	4c 89 f7             	mov    %r14,%rdi
+  80249a:	48 b8 b1 1d 80 00 00 	movabs $0x801db1,%rax
+  8024a1:	00 00 00 
+  8024a4:	ff d0                	call   *%rax
+            break;
+  8024a6:	48 83 c4 10          	add    $0x10,%rsp
+  8024aa:	e9 3e fa ff ff       	jmp    801eed <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  8024af:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8024b3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8024b7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8024bb:	eb b7                	jmp    802474 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  8024bd:	40 84 f6             	test   %sil,%sil
+  8024c0:	75 2b                	jne    8024ed <vprintfmt+0x631>
+    switch (lflag) {
+  8024c2:	85 d2                	test   %edx,%edx
+  8024c4:	74 56                	je     80251c <vprintfmt+0x660>
+  8024c6:	83 fa 01             	cmp    $0x1,%edx
+  8024c9:	74 7f                	je     80254a <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  8024cb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8024ce:	83 f8 2f             	cmp    $0x2f,%eax
+  8024d1:	0f 87 a2 00 00 00    	ja     802579 <vprintfmt+0x6bd>
+  8024d7:	89 c2                	mov    %eax,%edx
+  8024d9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8024dd:	83 c0 08             	add    $0x8,%eax
+  8024e0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8024e3:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8024e6:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  8024eb:	eb 8f                	jmp    80247c <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8024ed:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8024f0:	83 f8 2f             	cmp    $0x2f,%eax
+  8024f3:	77 19                	ja     80250e <vprintfmt+0x652>
+  8024f5:	89 c2                	mov    %eax,%edx
+  8024f7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8024fb:	83 c0 08             	add    $0x8,%eax
+  8024fe:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802501:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  802504:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  802509:	e9 6e ff ff ff       	jmp    80247c <vprintfmt+0x5c0>
+  80250e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802512:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802516:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80251a:	eb e5                	jmp    802501 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  80251c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80251f:	83 f8 2f             	cmp    $0x2f,%eax
+  802522:	77 18                	ja     80253c <vprintfmt+0x680>
+  802524:	89 c2                	mov    %eax,%edx
+  802526:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80252a:	83 c0 08             	add    $0x8,%eax
+  80252d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802530:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  802532:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  802537:	e9 40 ff ff ff       	jmp    80247c <vprintfmt+0x5c0>
+  80253c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802540:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802544:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802548:	eb e6                	jmp    802530 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  80254a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80254d:	83 f8 2f             	cmp    $0x2f,%eax
+  802550:	77 19                	ja     80256b <vprintfmt+0x6af>
+  802552:	89 c2                	mov    %eax,%edx
+  802554:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802558:	83 c0 08             	add    $0x8,%eax
+  80255b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80255e:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  802561:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  802566:	e9 11 ff ff ff       	jmp    80247c <vprintfmt+0x5c0>
+  80256b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80256f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802573:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802577:	eb e5                	jmp    80255e <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  802579:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80257d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802581:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802585:	e9 59 ff ff ff       	jmp    8024e3 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  80258a:	4c 89 ee             	mov    %r13,%rsi
+  80258d:	bf 25 00 00 00       	mov    $0x25,%edi
+  802592:	41 ff d6             	call   *%r14
+            break;
+  802595:	e9 53 f9 ff ff       	jmp    801eed <vprintfmt+0x31>
+            putch('%', put_arg);
+  80259a:	4c 89 ee             	mov    %r13,%rsi
+  80259d:	bf 25 00 00 00       	mov    $0x25,%edi
+  8025a2:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  8025a5:	48 83 eb 01          	sub    $0x1,%rbx
+  8025a9:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  8025ad:	75 f6                	jne    8025a5 <vprintfmt+0x6e9>
+  8025af:	e9 39 f9 ff ff       	jmp    801eed <vprintfmt+0x31>
+}
+  8025b4:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8025b8:	5b                   	pop    %rbx
+  8025b9:	41 5c                	pop    %r12
+  8025bb:	41 5d                	pop    %r13
+  8025bd:	41 5e                	pop    %r14
+  8025bf:	41 5f                	pop    %r15
+  8025c1:	5d                   	pop    %rbp
+  8025c2:	c3                   	ret
+
+00000000008025c3 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  8025c3:	55                   	push   %rbp
+  8025c4:	48 89 e5             	mov    %rsp,%rbp
+  8025c7:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  8025cb:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8025cf:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  8025d4:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  8025d8:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  8025df:	48 85 ff             	test   %rdi,%rdi
+  8025e2:	74 2b                	je     80260f <vsnprintf+0x4c>
+  8025e4:	48 85 f6             	test   %rsi,%rsi
+  8025e7:	74 26                	je     80260f <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  8025e9:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8025ed:	48 bf 67 1e 80 00 00 	movabs $0x801e67,%rdi
+  8025f4:	00 00 00 
+  8025f7:	48 b8 bc 1e 80 00 00 	movabs $0x801ebc,%rax
+  8025fe:	00 00 00 
+  802601:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  802603:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802607:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  80260a:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  80260d:	c9                   	leave
+  80260e:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  80260f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802614:	eb f7                	jmp    80260d <vsnprintf+0x4a>
+
+0000000000802616 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  802616:	55                   	push   %rbp
+  802617:	48 89 e5             	mov    %rsp,%rbp
+  80261a:	48 83 ec 50          	sub    $0x50,%rsp
+  80261e:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  802622:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  802626:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  80262a:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  802631:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802635:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802639:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80263d:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  802641:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  802645:	48 b8 c3 25 80 00 00 	movabs $0x8025c3,%rax
+  80264c:	00 00 00 
+  80264f:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  802651:	c9                   	leave
+  802652:	c3                   	ret
+
+0000000000802653 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  802653:	80 3f 00             	cmpb   $0x0,(%rdi)
+  802656:	74 10                	je     802668 <strlen+0x15>
+    size_t n = 0;
+  802658:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  80265d:	48 83 c0 01          	add    $0x1,%rax
+  802661:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  802665:	75 f6                	jne    80265d <strlen+0xa>
+  802667:	c3                   	ret
+    size_t n = 0;
+  802668:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  80266d:	c3                   	ret
+
+000000000080266e <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  80266e:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  802671:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  802676:	48 85 f6             	test   %rsi,%rsi
+  802679:	74 11                	je     80268c <strnlen+0x1e>
+  80267b:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  80267f:	74 0c                	je     80268d <strnlen+0x1f>
+  802681:	48 83 c2 01          	add    $0x1,%rdx
+  802685:	48 39 d0             	cmp    %rdx,%rax
+  802688:	75 f1                	jne    80267b <strnlen+0xd>
+  80268a:	eb 04                	jmp    802690 <strnlen+0x22>
+  80268c:	c3                   	ret
+  80268d:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  802690:	c3                   	ret
+
+0000000000802691 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  802691:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  802694:	ba 00 00 00 00       	mov    $0x0,%edx
+  802699:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  80269d:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  8026a0:	48 83 c2 01          	add    $0x1,%rdx
+  8026a4:	84 c9                	test   %cl,%cl
+  8026a6:	75 f1                	jne    802699 <strcpy+0x8>
+        ;
+    return res;
+}
+  8026a8:	c3                   	ret
+
+00000000008026a9 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  8026a9:	55                   	push   %rbp
+  8026aa:	48 89 e5             	mov    %rsp,%rbp
+  8026ad:	41 54                	push   %r12
+  8026af:	53                   	push   %rbx
+  8026b0:	48 89 fb             	mov    %rdi,%rbx
+  8026b3:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  8026b6:	48 b8 53 26 80 00 00 	movabs $0x802653,%rax
+  8026bd:	00 00 00 
+  8026c0:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  8026c2:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  8026c6:	4c 89 e6             	mov    %r12,%rsi
+  8026c9:	48 b8 91 26 80 00 00 	movabs $0x802691,%rax
+  8026d0:	00 00 00 
+  8026d3:	ff d0                	call   *%rax
+    return dst;
+}
+  8026d5:	48 89 d8             	mov    %rbx,%rax
+  8026d8:	5b                   	pop    %rbx
+  8026d9:	41 5c                	pop    %r12
+  8026db:	5d                   	pop    %rbp
+  8026dc:	c3                   	ret
+
+00000000008026dd <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8026dd:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  8026e0:	48 85 d2             	test   %rdx,%rdx
+  8026e3:	74 1f                	je     802704 <strncpy+0x27>
+  8026e5:	48 01 fa             	add    %rdi,%rdx
+  8026e8:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  8026eb:	48 83 c1 01          	add    $0x1,%rcx
+  8026ef:	44 0f b6 06          	movzbl (%rsi),%r8d
+  8026f3:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  8026f7:	41 80 f8 01          	cmp    $0x1,%r8b
+  8026fb:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  8026ff:	48 39 ca             	cmp    %rcx,%rdx
+  802702:	75 e7                	jne    8026eb <strncpy+0xe>
+    }
+    return ret;
+}
+  802704:	c3                   	ret
+
+0000000000802705 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  802705:	48 89 f8             	mov    %rdi,%rax
+  802708:	48 85 d2             	test   %rdx,%rdx
+  80270b:	74 24                	je     802731 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  80270d:	48 83 ea 01          	sub    $0x1,%rdx
+  802711:	74 1b                	je     80272e <strlcpy+0x29>
+  802713:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  802717:	0f b6 16             	movzbl (%rsi),%edx
+  80271a:	84 d2                	test   %dl,%dl
+  80271c:	74 10                	je     80272e <strlcpy+0x29>
+            *dst++ = *src++;
+  80271e:	48 83 c6 01          	add    $0x1,%rsi
+  802722:	48 83 c0 01          	add    $0x1,%rax
+  802726:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  802729:	48 39 c8             	cmp    %rcx,%rax
+  80272c:	75 e9                	jne    802717 <strlcpy+0x12>
+        *dst = '\0';
+  80272e:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  802731:	48 29 f8             	sub    %rdi,%rax
+}
+  802734:	c3                   	ret
+
+0000000000802735 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  802735:	0f b6 07             	movzbl (%rdi),%eax
+  802738:	84 c0                	test   %al,%al
+  80273a:	74 13                	je     80274f <strcmp+0x1a>
+  80273c:	38 06                	cmp    %al,(%rsi)
+  80273e:	75 0f                	jne    80274f <strcmp+0x1a>
+  802740:	48 83 c7 01          	add    $0x1,%rdi
+  802744:	48 83 c6 01          	add    $0x1,%rsi
+  802748:	0f b6 07             	movzbl (%rdi),%eax
+  80274b:	84 c0                	test   %al,%al
+  80274d:	75 ed                	jne    80273c <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  80274f:	0f b6 c0             	movzbl %al,%eax
+  802752:	0f b6 16             	movzbl (%rsi),%edx
+  802755:	29 d0                	sub    %edx,%eax
+}
+  802757:	c3                   	ret
+
+0000000000802758 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  802758:	48 85 d2             	test   %rdx,%rdx
+  80275b:	74 1f                	je     80277c <strncmp+0x24>
+  80275d:	0f b6 07             	movzbl (%rdi),%eax
+  802760:	84 c0                	test   %al,%al
+  802762:	74 1e                	je     802782 <strncmp+0x2a>
+  802764:	3a 06                	cmp    (%rsi),%al
+  802766:	75 1a                	jne    802782 <strncmp+0x2a>
+  802768:	48 83 c7 01          	add    $0x1,%rdi
+  80276c:	48 83 c6 01          	add    $0x1,%rsi
+  802770:	48 83 ea 01          	sub    $0x1,%rdx
+  802774:	75 e7                	jne    80275d <strncmp+0x5>
+
+    if (!n) return 0;
+  802776:	b8 00 00 00 00       	mov    $0x0,%eax
+  80277b:	c3                   	ret
+  80277c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802781:	c3                   	ret
+  802782:	48 85 d2             	test   %rdx,%rdx
+  802785:	74 09                	je     802790 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  802787:	0f b6 07             	movzbl (%rdi),%eax
+  80278a:	0f b6 16             	movzbl (%rsi),%edx
+  80278d:	29 d0                	sub    %edx,%eax
+  80278f:	c3                   	ret
+    if (!n) return 0;
+  802790:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802795:	c3                   	ret
+
+0000000000802796 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  802796:	0f b6 17             	movzbl (%rdi),%edx
+  802799:	84 d2                	test   %dl,%dl
+  80279b:	74 18                	je     8027b5 <strchr+0x1f>
+        if (*str == c) {
+  80279d:	0f be d2             	movsbl %dl,%edx
+  8027a0:	39 f2                	cmp    %esi,%edx
+  8027a2:	74 17                	je     8027bb <strchr+0x25>
+    for (; *str; str++) {
+  8027a4:	48 83 c7 01          	add    $0x1,%rdi
+  8027a8:	0f b6 17             	movzbl (%rdi),%edx
+  8027ab:	84 d2                	test   %dl,%dl
+  8027ad:	75 ee                	jne    80279d <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  8027af:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027b4:	c3                   	ret
+  8027b5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027ba:	c3                   	ret
+  8027bb:	48 89 f8             	mov    %rdi,%rax
+}
+  8027be:	c3                   	ret
+
+00000000008027bf <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  8027bf:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  8027c2:	0f b6 17             	movzbl (%rdi),%edx
+  8027c5:	84 d2                	test   %dl,%dl
+  8027c7:	74 13                	je     8027dc <strfind+0x1d>
+  8027c9:	0f be d2             	movsbl %dl,%edx
+  8027cc:	39 f2                	cmp    %esi,%edx
+  8027ce:	74 0b                	je     8027db <strfind+0x1c>
+  8027d0:	48 83 c0 01          	add    $0x1,%rax
+  8027d4:	0f b6 10             	movzbl (%rax),%edx
+  8027d7:	84 d2                	test   %dl,%dl
+  8027d9:	75 ee                	jne    8027c9 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  8027db:	c3                   	ret
+  8027dc:	c3                   	ret
+
+00000000008027dd <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  8027dd:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  8027e0:	48 89 f8             	mov    %rdi,%rax
+  8027e3:	48 f7 d8             	neg    %rax
+  8027e6:	83 e0 07             	and    $0x7,%eax
+  8027e9:	49 89 d1             	mov    %rdx,%r9
+  8027ec:	49 29 c1             	sub    %rax,%r9
+  8027ef:	78 36                	js     802827 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  8027f1:	40 0f b6 c6          	movzbl %sil,%eax
+  8027f5:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  8027fc:	01 01 01 
+  8027ff:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  802803:	40 f6 c7 07          	test   $0x7,%dil
+  802807:	75 38                	jne    802841 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  802809:	4c 89 c9             	mov    %r9,%rcx
+  80280c:	48 c1 f9 03          	sar    $0x3,%rcx
+  802810:	74 0c                	je     80281e <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  802812:	fc                   	cld
+  802813:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  802816:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  80281a:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  80281e:	4d 85 c9             	test   %r9,%r9
+  802821:	75 45                	jne    802868 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  802823:	4c 89 c0             	mov    %r8,%rax
+  802826:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  802827:	48 85 d2             	test   %rdx,%rdx
+  80282a:	74 f7                	je     802823 <memset+0x46>
+  80282c:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  80282f:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  802832:	48 83 c0 01          	add    $0x1,%rax
+  802836:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  80283a:	48 39 c2             	cmp    %rax,%rdx
+  80283d:	75 f3                	jne    802832 <memset+0x55>
+  80283f:	eb e2                	jmp    802823 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  802841:	40 f6 c7 01          	test   $0x1,%dil
+  802845:	74 06                	je     80284d <memset+0x70>
+  802847:	88 07                	mov    %al,(%rdi)
+  802849:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  80284d:	40 f6 c7 02          	test   $0x2,%dil
+  802851:	74 07                	je     80285a <memset+0x7d>
+  802853:	66 89 07             	mov    %ax,(%rdi)
+  802856:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  80285a:	40 f6 c7 04          	test   $0x4,%dil
+  80285e:	74 a9                	je     802809 <memset+0x2c>
+  802860:	89 07                	mov    %eax,(%rdi)
+  802862:	48 83 c7 04          	add    $0x4,%rdi
+  802866:	eb a1                	jmp    802809 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  802868:	41 f6 c1 04          	test   $0x4,%r9b
+  80286c:	74 06                	je     802874 <memset+0x97>
+  80286e:	89 07                	mov    %eax,(%rdi)
+  802870:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  802874:	41 f6 c1 02          	test   $0x2,%r9b
+  802878:	74 07                	je     802881 <memset+0xa4>
+  80287a:	66 89 07             	mov    %ax,(%rdi)
+  80287d:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  802881:	41 f6 c1 01          	test   $0x1,%r9b
+  802885:	74 9c                	je     802823 <memset+0x46>
+  802887:	88 07                	mov    %al,(%rdi)
+  802889:	eb 98                	jmp    802823 <memset+0x46>
+
+000000000080288b <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  80288b:	48 89 f8             	mov    %rdi,%rax
+  80288e:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  802891:	48 39 fe             	cmp    %rdi,%rsi
+  802894:	73 3b                	jae    8028d1 <memmove+0x46>
+  802896:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  80289a:	48 39 d7             	cmp    %rdx,%rdi
+  80289d:	73 32                	jae    8028d1 <memmove+0x46>
+        s += n;
+        d += n;
+  80289f:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  8028a3:	48 89 d6             	mov    %rdx,%rsi
+  8028a6:	48 09 fe             	or     %rdi,%rsi
+  8028a9:	48 09 ce             	or     %rcx,%rsi
+  8028ac:	40 f6 c6 07          	test   $0x7,%sil
+  8028b0:	75 12                	jne    8028c4 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  8028b2:	48 83 ef 08          	sub    $0x8,%rdi
+  8028b6:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  8028ba:	48 c1 e9 03          	shr    $0x3,%rcx
+  8028be:	fd                   	std
+  8028bf:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  8028c2:	fc                   	cld
+  8028c3:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  8028c4:	48 83 ef 01          	sub    $0x1,%rdi
+  8028c8:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  8028cc:	fd                   	std
+  8028cd:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  8028cf:	eb f1                	jmp    8028c2 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  8028d1:	48 89 f2             	mov    %rsi,%rdx
+  8028d4:	48 09 c2             	or     %rax,%rdx
+  8028d7:	48 09 ca             	or     %rcx,%rdx
+  8028da:	f6 c2 07             	test   $0x7,%dl
+  8028dd:	75 0c                	jne    8028eb <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  8028df:	48 c1 e9 03          	shr    $0x3,%rcx
+  8028e3:	48 89 c7             	mov    %rax,%rdi
+  8028e6:	fc                   	cld
+  8028e7:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  8028ea:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  8028eb:	48 89 c7             	mov    %rax,%rdi
+  8028ee:	fc                   	cld
+  8028ef:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  8028f1:	c3                   	ret
+
+00000000008028f2 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  8028f2:	55                   	push   %rbp
+  8028f3:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  8028f6:	48 b8 8b 28 80 00 00 	movabs $0x80288b,%rax
+  8028fd:	00 00 00 
+  802900:	ff d0                	call   *%rax
+}
+  802902:	5d                   	pop    %rbp
+  802903:	c3                   	ret
+
+0000000000802904 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  802904:	55                   	push   %rbp
+  802905:	48 89 e5             	mov    %rsp,%rbp
+  802908:	41 57                	push   %r15
+  80290a:	41 56                	push   %r14
+  80290c:	41 55                	push   %r13
+  80290e:	41 54                	push   %r12
+  802910:	53                   	push   %rbx
+  802911:	48 83 ec 08          	sub    $0x8,%rsp
+  802915:	49 89 fe             	mov    %rdi,%r14
+  802918:	49 89 f7             	mov    %rsi,%r15
+  80291b:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  80291e:	48 89 f7             	mov    %rsi,%rdi
+  802921:	48 b8 53 26 80 00 00 	movabs $0x802653,%rax
+  802928:	00 00 00 
+  80292b:	ff d0                	call   *%rax
+  80292d:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  802930:	48 89 de             	mov    %rbx,%rsi
+  802933:	4c 89 f7             	mov    %r14,%rdi
+  802936:	48 b8 6e 26 80 00 00 	movabs $0x80266e,%rax
+  80293d:	00 00 00 
+  802940:	ff d0                	call   *%rax
+  802942:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  802945:	48 39 c3             	cmp    %rax,%rbx
+  802948:	74 36                	je     802980 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  80294a:	48 89 d8             	mov    %rbx,%rax
+  80294d:	4c 29 e8             	sub    %r13,%rax
+  802950:	49 39 c4             	cmp    %rax,%r12
+  802953:	73 31                	jae    802986 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  802955:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  80295a:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  80295e:	4c 89 fe             	mov    %r15,%rsi
+  802961:	48 b8 f2 28 80 00 00 	movabs $0x8028f2,%rax
+  802968:	00 00 00 
+  80296b:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  80296d:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  802971:	48 83 c4 08          	add    $0x8,%rsp
+  802975:	5b                   	pop    %rbx
+  802976:	41 5c                	pop    %r12
+  802978:	41 5d                	pop    %r13
+  80297a:	41 5e                	pop    %r14
+  80297c:	41 5f                	pop    %r15
+  80297e:	5d                   	pop    %rbp
+  80297f:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  802980:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  802984:	eb eb                	jmp    802971 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  802986:	48 83 eb 01          	sub    $0x1,%rbx
+  80298a:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  80298e:	48 89 da             	mov    %rbx,%rdx
+  802991:	4c 89 fe             	mov    %r15,%rsi
+  802994:	48 b8 f2 28 80 00 00 	movabs $0x8028f2,%rax
+  80299b:	00 00 00 
+  80299e:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  8029a0:	49 01 de             	add    %rbx,%r14
+  8029a3:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  8029a8:	eb c3                	jmp    80296d <strlcat+0x69>
+
+00000000008029aa <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  8029aa:	48 85 d2             	test   %rdx,%rdx
+  8029ad:	74 2d                	je     8029dc <memcmp+0x32>
+  8029af:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  8029b4:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  8029b8:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  8029bd:	44 38 c1             	cmp    %r8b,%cl
+  8029c0:	75 0f                	jne    8029d1 <memcmp+0x27>
+    while (n-- > 0) {
+  8029c2:	48 83 c0 01          	add    $0x1,%rax
+  8029c6:	48 39 c2             	cmp    %rax,%rdx
+  8029c9:	75 e9                	jne    8029b4 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  8029cb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029d0:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  8029d1:	0f b6 c1             	movzbl %cl,%eax
+  8029d4:	45 0f b6 c0          	movzbl %r8b,%r8d
+  8029d8:	44 29 c0             	sub    %r8d,%eax
+  8029db:	c3                   	ret
+    return 0;
+  8029dc:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8029e1:	c3                   	ret
+
+00000000008029e2 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  8029e2:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  8029e6:	48 39 c7             	cmp    %rax,%rdi
+  8029e9:	73 0f                	jae    8029fa <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  8029eb:	40 38 37             	cmp    %sil,(%rdi)
+  8029ee:	74 0e                	je     8029fe <memfind+0x1c>
+    for (; src < end; src++) {
+  8029f0:	48 83 c7 01          	add    $0x1,%rdi
+  8029f4:	48 39 f8             	cmp    %rdi,%rax
+  8029f7:	75 f2                	jne    8029eb <memfind+0x9>
+  8029f9:	c3                   	ret
+  8029fa:	48 89 f8             	mov    %rdi,%rax
+  8029fd:	c3                   	ret
+  8029fe:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  802a01:	c3                   	ret
+
+0000000000802a02 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  802a02:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  802a05:	0f b6 37             	movzbl (%rdi),%esi
+  802a08:	40 80 fe 20          	cmp    $0x20,%sil
+  802a0c:	74 06                	je     802a14 <strtol+0x12>
+  802a0e:	40 80 fe 09          	cmp    $0x9,%sil
+  802a12:	75 13                	jne    802a27 <strtol+0x25>
+  802a14:	48 83 c7 01          	add    $0x1,%rdi
+  802a18:	0f b6 37             	movzbl (%rdi),%esi
+  802a1b:	40 80 fe 20          	cmp    $0x20,%sil
+  802a1f:	74 f3                	je     802a14 <strtol+0x12>
+  802a21:	40 80 fe 09          	cmp    $0x9,%sil
+  802a25:	74 ed                	je     802a14 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  802a27:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  802a2a:	83 e0 fd             	and    $0xfffffffd,%eax
+  802a2d:	3c 01                	cmp    $0x1,%al
+  802a2f:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  802a33:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  802a39:	75 0f                	jne    802a4a <strtol+0x48>
+  802a3b:	80 3f 30             	cmpb   $0x30,(%rdi)
+  802a3e:	74 14                	je     802a54 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  802a40:	85 d2                	test   %edx,%edx
+  802a42:	b8 0a 00 00 00       	mov    $0xa,%eax
+  802a47:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  802a4a:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  802a4f:	4c 63 ca             	movslq %edx,%r9
+  802a52:	eb 36                	jmp    802a8a <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  802a54:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  802a58:	74 0f                	je     802a69 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  802a5a:	85 d2                	test   %edx,%edx
+  802a5c:	75 ec                	jne    802a4a <strtol+0x48>
+        s++;
+  802a5e:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  802a62:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  802a67:	eb e1                	jmp    802a4a <strtol+0x48>
+        s += 2;
+  802a69:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  802a6d:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  802a72:	eb d6                	jmp    802a4a <strtol+0x48>
+            dig -= '0';
+  802a74:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  802a77:	44 0f b6 c1          	movzbl %cl,%r8d
+  802a7b:	41 39 d0             	cmp    %edx,%r8d
+  802a7e:	7d 21                	jge    802aa1 <strtol+0x9f>
+        val = val * base + dig;
+  802a80:	49 0f af c1          	imul   %r9,%rax
+  802a84:	0f b6 c9             	movzbl %cl,%ecx
+  802a87:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  802a8a:	48 83 c7 01          	add    $0x1,%rdi
+  802a8e:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  802a92:	80 f9 39             	cmp    $0x39,%cl
+  802a95:	76 dd                	jbe    802a74 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  802a97:	80 f9 7b             	cmp    $0x7b,%cl
+  802a9a:	77 05                	ja     802aa1 <strtol+0x9f>
+            dig -= 'a' - 10;
+  802a9c:	83 e9 57             	sub    $0x57,%ecx
+  802a9f:	eb d6                	jmp    802a77 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  802aa1:	4d 85 d2             	test   %r10,%r10
+  802aa4:	74 03                	je     802aa9 <strtol+0xa7>
+  802aa6:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  802aa9:	48 89 c2             	mov    %rax,%rdx
+  802aac:	48 f7 da             	neg    %rdx
+  802aaf:	40 80 fe 2d          	cmp    $0x2d,%sil
+  802ab3:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  802ab7:	c3                   	ret
+
+0000000000802ab8 <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  802ab8:	55                   	push   %rbp
+  802ab9:	48 89 e5             	mov    %rsp,%rbp
+  802abc:	41 55                	push   %r13
+  802abe:	41 54                	push   %r12
+  802ac0:	53                   	push   %rbx
+  802ac1:	48 83 ec 08          	sub    $0x8,%rsp
+  802ac5:	49 89 fc             	mov    %rdi,%r12
+  802ac8:	48 89 f7             	mov    %rsi,%rdi
+  802acb:	48 89 d3             	mov    %rdx,%rbx
+  802ace:	49 89 cd             	mov    %rcx,%r13
+    // LAB 9: Your code here:
+    int res = sys_ipc_recv(!pg ? (void*)MAX_USER_ADDRESS : pg, !size ? 0 : *size);
+  802ad1:	be 00 00 00 00       	mov    $0x0,%esi
+  802ad6:	48 85 d2             	test   %rdx,%rdx
+  802ad9:	74 03                	je     802ade <ipc_recv+0x26>
+  802adb:	48 8b 32             	mov    (%rdx),%rsi
+  802ade:	48 85 ff             	test   %rdi,%rdi
+  802ae1:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802ae8:	00 00 00 
+  802aeb:	48 0f 44 f8          	cmove  %rax,%rdi
+  802aef:	48 b8 5d 06 80 00 00 	movabs $0x80065d,%rax
+  802af6:	00 00 00 
+  802af9:	ff d0                	call   *%rax
+    if (res < 0) {
+  802afb:	85 c0                	test   %eax,%eax
+  802afd:	78 66                	js     802b65 <ipc_recv+0xad>
+        if (size) {
+            *size = 0;
+        }
+        return res;
+    }
+    if (from_env_store) {
+  802aff:	4d 85 e4             	test   %r12,%r12
+  802b02:	74 14                	je     802b18 <ipc_recv+0x60>
+        *from_env_store = thisenv->env_ipc_from;
+  802b04:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802b0b:	00 00 00 
+  802b0e:	8b 80 ac 01 00 00    	mov    0x1ac(%rax),%eax
+  802b14:	41 89 04 24          	mov    %eax,(%r12)
+    }
+    if (perm_store) {
+  802b18:	4d 85 ed             	test   %r13,%r13
+  802b1b:	74 14                	je     802b31 <ipc_recv+0x79>
+        *perm_store = thisenv->env_ipc_perm;
+  802b1d:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802b24:	00 00 00 
+  802b27:	8b 80 b0 01 00 00    	mov    0x1b0(%rax),%eax
+  802b2d:	41 89 45 00          	mov    %eax,0x0(%r13)
+    }
+    if (size) {
+  802b31:	48 85 db             	test   %rbx,%rbx
+  802b34:	74 14                	je     802b4a <ipc_recv+0x92>
+        *size = thisenv->env_ipc_maxsz;
+  802b36:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802b3d:	00 00 00 
+  802b40:	48 8b 80 a0 01 00 00 	mov    0x1a0(%rax),%rax
+  802b47:	48 89 03             	mov    %rax,(%rbx)
+    }
+    return thisenv->env_ipc_value;
+  802b4a:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802b51:	00 00 00 
+  802b54:	8b 80 a8 01 00 00    	mov    0x1a8(%rax),%eax
+}
+  802b5a:	48 83 c4 08          	add    $0x8,%rsp
+  802b5e:	5b                   	pop    %rbx
+  802b5f:	41 5c                	pop    %r12
+  802b61:	41 5d                	pop    %r13
+  802b63:	5d                   	pop    %rbp
+  802b64:	c3                   	ret
+        if (from_env_store) {
+  802b65:	4d 85 e4             	test   %r12,%r12
+  802b68:	74 08                	je     802b72 <ipc_recv+0xba>
+            *from_env_store = 0;
+  802b6a:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  802b71:	00 
+        if (perm_store) {
+  802b72:	4d 85 ed             	test   %r13,%r13
+  802b75:	74 08                	je     802b7f <ipc_recv+0xc7>
+            *perm_store = 0;
+  802b77:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  802b7e:	00 
+        if (size) {
+  802b7f:	48 85 db             	test   %rbx,%rbx
+  802b82:	74 d6                	je     802b5a <ipc_recv+0xa2>
+            *size = 0;
+  802b84:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  802b8b:	eb cd                	jmp    802b5a <ipc_recv+0xa2>
+
+0000000000802b8d <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  802b8d:	55                   	push   %rbp
+  802b8e:	48 89 e5             	mov    %rsp,%rbp
+  802b91:	41 57                	push   %r15
+  802b93:	41 56                	push   %r14
+  802b95:	41 55                	push   %r13
+  802b97:	41 54                	push   %r12
+  802b99:	53                   	push   %rbx
+  802b9a:	48 83 ec 18          	sub    $0x18,%rsp
+  802b9e:	41 89 fd             	mov    %edi,%r13d
+  802ba1:	89 75 cc             	mov    %esi,-0x34(%rbp)
+  802ba4:	49 89 cc             	mov    %rcx,%r12
+  802ba7:	44 89 45 c8          	mov    %r8d,-0x38(%rbp)
+    // LAB 9: Your code here:
+    int res = 0;
+    while ((res = sys_ipc_try_send(to_env, val, !pg ? (void*)MAX_USER_ADDRESS : pg, size, perm)) < 0) {
+  802bab:	48 85 d2             	test   %rdx,%rdx
+  802bae:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802bb5:	00 00 00 
+  802bb8:	48 0f 45 c2          	cmovne %rdx,%rax
+  802bbc:	48 89 c3             	mov    %rax,%rbx
+  802bbf:	49 be 31 06 80 00 00 	movabs $0x800631,%r14
+  802bc6:	00 00 00 
+        if (res != -E_IPC_NOT_RECV) {
+            panic("sys_ipc_try_send failed: %i", res);
+        }
+        sys_yield();
+  802bc9:	49 bf fc 01 80 00 00 	movabs $0x8001fc,%r15
+  802bd0:	00 00 00 
+    while ((res = sys_ipc_try_send(to_env, val, !pg ? (void*)MAX_USER_ADDRESS : pg, size, perm)) < 0) {
+  802bd3:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  802bd6:	44 8b 45 c8          	mov    -0x38(%rbp),%r8d
+  802bda:	4c 89 e1             	mov    %r12,%rcx
+  802bdd:	48 89 da             	mov    %rbx,%rdx
+  802be0:	44 89 ef             	mov    %r13d,%edi
+  802be3:	41 ff d6             	call   *%r14
+  802be6:	85 c0                	test   %eax,%eax
+  802be8:	79 37                	jns    802c21 <ipc_send+0x94>
+        if (res != -E_IPC_NOT_RECV) {
+  802bea:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  802bed:	75 05                	jne    802bf4 <ipc_send+0x67>
+        sys_yield();
+  802bef:	41 ff d7             	call   *%r15
+  802bf2:	eb df                	jmp    802bd3 <ipc_send+0x46>
+            panic("sys_ipc_try_send failed: %i", res);
+  802bf4:	89 c1                	mov    %eax,%ecx
+  802bf6:	48 ba 2f 33 80 00 00 	movabs $0x80332f,%rdx
+  802bfd:	00 00 00 
+  802c00:	be 40 00 00 00       	mov    $0x40,%esi
+  802c05:	48 bf 4b 33 80 00 00 	movabs $0x80334b,%rdi
+  802c0c:	00 00 00 
+  802c0f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c14:	49 b8 1c 1c 80 00 00 	movabs $0x801c1c,%r8
+  802c1b:	00 00 00 
+  802c1e:	41 ff d0             	call   *%r8
+    }
+    return;
+}
+  802c21:	48 83 c4 18          	add    $0x18,%rsp
+  802c25:	5b                   	pop    %rbx
+  802c26:	41 5c                	pop    %r12
+  802c28:	41 5d                	pop    %r13
+  802c2a:	41 5e                	pop    %r14
+  802c2c:	41 5f                	pop    %r15
+  802c2e:	5d                   	pop    %rbp
+  802c2f:	c3                   	ret
+
+0000000000802c30 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  802c30:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  802c35:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  802c3c:	00 00 00 
+  802c3f:	48 69 d0 d0 01 00 00 	imul   $0x1d0,%rax,%rdx
+  802c46:	48 01 ca             	add    %rcx,%rdx
+  802c49:	8b 92 e8 00 00 00    	mov    0xe8(%rdx),%edx
+  802c4f:	39 fa                	cmp    %edi,%edx
+  802c51:	74 12                	je     802c65 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  802c53:	48 83 c0 01          	add    $0x1,%rax
+  802c57:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  802c5d:	75 e0                	jne    802c3f <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  802c5f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802c64:	c3                   	ret
+            return envs[i].env_id;
+  802c65:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+  802c6c:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  802c73:	00 00 00 
+  802c76:	48 01 d0             	add    %rdx,%rax
+  802c79:	8b 80 e0 00 00 00    	mov    0xe0(%rax),%eax
+  802c7f:	c3                   	ret
+
+0000000000802c80 <__rodata_start>:
+  802c80:	3c 75                	cmp    $0x75,%al
+  802c82:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802c83:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  802c87:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802c88:	3e 00 66 0f          	ds add %ah,0xf(%rsi)
+  802c8c:	1f                   	(bad)
+  802c8d:	44 00 00             	add    %r8b,(%rax)
+  802c90:	73 79                	jae    802d0b <__rodata_start+0x8b>
+  802c92:	73 63                	jae    802cf7 <__rodata_start+0x77>
+  802c94:	61                   	(bad)
+  802c95:	6c                   	insb   (%dx),%es:(%rdi)
+  802c96:	6c                   	insb   (%dx),%es:(%rdi)
+  802c97:	20 25 7a 64 20 72    	and    %ah,0x7220647a(%rip)        # 72a09117 <__bss_end+0x72201117>
+  802c9d:	65 74 75             	gs je  802d15 <__rodata_start+0x95>
+  802ca0:	72 6e                	jb     802d10 <__rodata_start+0x90>
+  802ca2:	65 64 20 25 7a 64 20 	gs and %ah,%fs:0x2820647a(%rip)        # 28a09124 <__bss_end+0x28201124>
+  802ca9:	28 
+  802caa:	3e 20 30             	ds and %dh,(%rax)
+  802cad:	29 00                	sub    %eax,(%rax)
+  802caf:	6c                   	insb   (%dx),%es:(%rdi)
+  802cb0:	69 62 2f 73 79 73 63 	imul   $0x63737973,0x2f(%rdx),%esp
+  802cb7:	61                   	(bad)
+  802cb8:	6c                   	insb   (%dx),%es:(%rdi)
+  802cb9:	6c                   	insb   (%dx),%es:(%rdi)
+  802cba:	2e 63 00             	cs movsxd (%rax),%eax
+  802cbd:	0f 1f 00             	nopl   (%rax)
+  802cc0:	5b                   	pop    %rbx
+  802cc1:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  802cc6:	20 75 6e             	and    %dh,0x6e(%rbp)
+  802cc9:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  802ccd:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802cce:	20 64 65 76          	and    %ah,0x76(%rbp,%riz,2)
+  802cd2:	69 63 65 20 74 79 70 	imul   $0x70797420,0x65(%rbx),%esp
+  802cd9:	65 20 25 64 0a 00 00 	and    %ah,%gs:0xa64(%rip)        # 803744 <error_string+0x4e4>
+  802ce0:	5b                   	pop    %rbx
+  802ce1:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  802ce6:	20 66 74             	and    %ah,0x74(%rsi)
+  802ce9:	72 75                	jb     802d60 <devtab+0x20>
+  802ceb:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802cec:	63 61 74             	movsxd 0x74(%rcx),%esp
+  802cef:	65 20 25 64 20 2d 2d 	and    %ah,%gs:0x2d2d2064(%rip)        # 2dad4d5a <__bss_end+0x2d2ccd5a>
+  802cf6:	20 62 61             	and    %ah,0x61(%rdx)
+  802cf9:	64 20 6d 6f          	and    %ch,%fs:0x6f(%rbp)
+  802cfd:	64 65 0a 00          	fs or  %gs:(%rax),%al
+  802d01:	5b                   	pop    %rbx
+  802d02:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  802d07:	20 72 65             	and    %dh,0x65(%rdx)
+  802d0a:	61                   	(bad)
+  802d0b:	64 20 25 64 20 2d 2d 	and    %ah,%fs:0x2d2d2064(%rip)        # 2dad4d76 <__bss_end+0x2d2ccd76>
+  802d12:	20 62 61             	and    %ah,0x61(%rdx)
+  802d15:	64 20 6d 6f          	and    %ch,%fs:0x6f(%rbp)
+  802d19:	64 65 0a 00          	fs or  %gs:(%rax),%al
+  802d1d:	5b                   	pop    %rbx
+  802d1e:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  802d23:	20 77 72             	and    %dh,0x72(%rdi)
+  802d26:	69 74 65 20 25 64 20 	imul   $0x2d206425,0x20(%rbp,%riz,2),%esi
+  802d2d:	2d 
+  802d2e:	2d 20 62 61 64       	sub    $0x64616220,%eax
+  802d33:	20 6d 6f             	and    %ch,0x6f(%rbp)
+  802d36:	64 65 0a 00          	fs or  %gs:(%rax),%al
+  802d3a:	66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+
+0000000000802d40 <devtab>:
+  802d40:	20 40 80 00 00 00 00 00 60 40 80 00 00 00 00 00      @......`@......
+  802d50:	a0 40 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .@..............
+  802d60:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  802d70:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  802d80:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  802d90:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  802da0:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  802db0:	3d 20 32 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73 00     = 2.<cons>.cons.
+  802dc0:	5b 25 30 38 78 5d 20 75 73 65 72 20 70 61 6e 69     [%08x] user pani
+  802dd0:	63 20 69 6e 20 25 73 20 61 74 20 25 73 3a 25 64     c in %s at %s:%d
+  802de0:	3a 20 00 30 31 32 33 34 35 36 37 38 39 41 42 43     : .0123456789ABC
+  802df0:	44 45 46 00 30 31 32 33 34 35 36 37 38 39 61 62     DEF.0123456789ab
+  802e00:	63 64 65 66 00 28 6e 75 6c 6c 29 00 65 72 72 6f     cdef.(null).erro
+  802e10:	72 20 25 64 00 75 6e 73 70 65 63 69 66 69 65 64     r %d.unspecified
+  802e20:	20 65 72 72 6f 72 00 62 61 64 20 65 6e 76 69 72      error.bad envir
+  802e30:	6f 6e 6d 65 6e 74 00 69 6e 76 61 6c 69 64 20 70     onment.invalid p
+  802e40:	61 72 61 6d 65 74 65 72 00 6f 75 74 20 6f 66 20     arameter.out of 
+  802e50:	6d 65 6d 6f 72 79 00 6f 75 74 20 6f 66 20 65 6e     memory.out of en
+  802e60:	76 69 72 6f 6e 6d 65 6e 74 73 00 63 6f 72 72 75     vironments.corru
+  802e70:	70 74 65 64 20 64 65 62 75 67 20 69 6e 66 6f 00     pted debug info.
+  802e80:	73 65 67 6d 65 6e 74 61 74 69 6f 6e 20 66 61 75     segmentation fau
+  802e90:	6c 74 00 69 6e 76 61 6c 69 64 20 45 4c 46 20 69     lt.invalid ELF i
+  802ea0:	6d 61 67 65 00 6e 6f 20 73 75 63 68 20 73 79 73     mage.no such sys
+  802eb0:	74 65 6d 20 63 61 6c 6c 00 65 6e 74 72 79 20 6e     tem call.entry n
+  802ec0:	6f 74 20 66 6f 75 6e 64 00 65 6e 76 20 69 73 20     ot found.env is 
+  802ed0:	6e 6f 74 20 72 65 63 76 69 6e 67 00 75 6e 65 78     not recving.unex
+  802ee0:	70 65 63 74 65 64 20 65 6e 64 20 6f 66 20 66 69     pected end of fi
+  802ef0:	6c 65 00 6e 6f 20 66 72 65 65 20 73 70 61 63 65     le.no free space
+  802f00:	20 6f 6e 20 64 69 73 6b 00 74 6f 6f 20 6d 61 6e      on disk.too man
+  802f10:	79 20 66 69 6c 65 73 20 61 72 65 20 6f 70 65 6e     y files are open
+  802f20:	00 66 69 6c 65 20 6f 72 20 62 6c 6f 63 6b 20 6e     .file or block n
+  802f30:	6f 74 20 66 6f 75 6e 64 00 69 6e 76 61 6c 69 64     ot found.invalid
+  802f40:	20 70 61 74 68 00 66 69 6c 65 20 61 6c 72 65 61      path.file alrea
+  802f50:	64 79 20 65 78 69 73 74 73 00 6f 70 65 72 61 74     dy exists.operat
+  802f60:	69 6f 6e 20 6e 6f 74 20 73 75 70 70 6f 72 74 65     ion not supporte
+  802f70:	64 00 6f 70 65 72 61 74 69 6f 6e 20 69 6e 74 65     d.operation inte
+  802f80:	72 72 75 70 74 65 64 00 6e 6f 74 20 65 6e 6f 75     rrupted.not enou
+  802f90:	67 68 20 43 50 55 20 74 69 6d 65 00 0f 1f 40 00     gh CPU time...@.
+  802fa0:	59 1f 80 00 00 00 00 00 9a 25 80 00 00 00 00 00     Y........%......
+  802fb0:	8a 25 80 00 00 00 00 00 9a 25 80 00 00 00 00 00     .%.......%......
+  802fc0:	9a 25 80 00 00 00 00 00 9a 25 80 00 00 00 00 00     .%.......%......
+  802fd0:	9a 25 80 00 00 00 00 00 78 1f 80 00 00 00 00 00     .%......x.......
+  802fe0:	9a 25 80 00 00 00 00 00 9a 25 80 00 00 00 00 00     .%.......%......
+  802ff0:	6c 1f 80 00 00 00 00 00 e6 1f 80 00 00 00 00 00     l...............
+  803000:	9a 25 80 00 00 00 00 00 6c 1f 80 00 00 00 00 00     .%......l.......
+  803010:	b2 1f 80 00 00 00 00 00 b2 1f 80 00 00 00 00 00     ................
+  803020:	b2 1f 80 00 00 00 00 00 b2 1f 80 00 00 00 00 00     ................
+  803030:	b2 1f 80 00 00 00 00 00 b2 1f 80 00 00 00 00 00     ................
+  803040:	b2 1f 80 00 00 00 00 00 b2 1f 80 00 00 00 00 00     ................
+  803050:	b2 1f 80 00 00 00 00 00 9a 25 80 00 00 00 00 00     .........%......
+  803060:	9a 25 80 00 00 00 00 00 9a 25 80 00 00 00 00 00     .%.......%......
+  803070:	9a 25 80 00 00 00 00 00 9a 25 80 00 00 00 00 00     .%.......%......
+  803080:	9a 25 80 00 00 00 00 00 9a 25 80 00 00 00 00 00     .%.......%......
+  803090:	9a 25 80 00 00 00 00 00 9a 25 80 00 00 00 00 00     .%.......%......
+  8030a0:	9a 25 80 00 00 00 00 00 9a 25 80 00 00 00 00 00     .%.......%......
+  8030b0:	9a 25 80 00 00 00 00 00 9a 25 80 00 00 00 00 00     .%.......%......
+  8030c0:	9a 25 80 00 00 00 00 00 9a 25 80 00 00 00 00 00     .%.......%......
+  8030d0:	9a 25 80 00 00 00 00 00 9a 25 80 00 00 00 00 00     .%.......%......
+  8030e0:	9a 25 80 00 00 00 00 00 9a 25 80 00 00 00 00 00     .%.......%......
+  8030f0:	9a 25 80 00 00 00 00 00 9a 25 80 00 00 00 00 00     .%.......%......
+  803100:	9a 25 80 00 00 00 00 00 9a 25 80 00 00 00 00 00     .%.......%......
+  803110:	9a 25 80 00 00 00 00 00 9a 25 80 00 00 00 00 00     .%.......%......
+  803120:	9a 25 80 00 00 00 00 00 9a 25 80 00 00 00 00 00     .%.......%......
+  803130:	9a 25 80 00 00 00 00 00 9a 25 80 00 00 00 00 00     .%.......%......
+  803140:	9a 25 80 00 00 00 00 00 bd 24 80 00 00 00 00 00     .%.......$......
+  803150:	9a 25 80 00 00 00 00 00 9a 25 80 00 00 00 00 00     .%.......%......
+  803160:	9a 25 80 00 00 00 00 00 9a 25 80 00 00 00 00 00     .%.......%......
+  803170:	9a 25 80 00 00 00 00 00 9a 25 80 00 00 00 00 00     .%.......%......
+  803180:	9a 25 80 00 00 00 00 00 9a 25 80 00 00 00 00 00     .%.......%......
+  803190:	9a 25 80 00 00 00 00 00 9a 25 80 00 00 00 00 00     .%.......%......
+  8031a0:	09 20 80 00 00 00 00 00 d8 21 80 00 00 00 00 00     . .......!......
+  8031b0:	9a 25 80 00 00 00 00 00 9a 25 80 00 00 00 00 00     .%.......%......
+  8031c0:	9a 25 80 00 00 00 00 00 9a 25 80 00 00 00 00 00     .%.......%......
+  8031d0:	38 20 80 00 00 00 00 00 9a 25 80 00 00 00 00 00     8 .......%......
+  8031e0:	9a 25 80 00 00 00 00 00 fe 1f 80 00 00 00 00 00     .%..............
+  8031f0:	9a 25 80 00 00 00 00 00 9a 25 80 00 00 00 00 00     .%.......%......
+  803200:	80 23 80 00 00 00 00 00 4a 24 80 00 00 00 00 00     .#......J$......
+  803210:	9a 25 80 00 00 00 00 00 9a 25 80 00 00 00 00 00     .%.......%......
+  803220:	cf 20 80 00 00 00 00 00 9a 25 80 00 00 00 00 00     . .......%......
+  803230:	ac 22 80 00 00 00 00 00 9a 25 80 00 00 00 00 00     .".......%......
+  803240:	9a 25 80 00 00 00 00 00 bd 24 80 00 00 00 00 00     .%.......$......
+  803250:	9a 25 80 00 00 00 00 00 62 1f 80 00 00 00 00 00     .%......b.......
+
+0000000000803260 <error_string>:
+	...
+  803268:	15 2e 80 00 00 00 00 00 27 2e 80 00 00 00 00 00     ........'.......
+  803278:	37 2e 80 00 00 00 00 00 49 2e 80 00 00 00 00 00     7.......I.......
+  803288:	57 2e 80 00 00 00 00 00 6b 2e 80 00 00 00 00 00     W.......k.......
+  803298:	80 2e 80 00 00 00 00 00 93 2e 80 00 00 00 00 00     ................
+  8032a8:	a5 2e 80 00 00 00 00 00 b9 2e 80 00 00 00 00 00     ................
+  8032b8:	c9 2e 80 00 00 00 00 00 dc 2e 80 00 00 00 00 00     ................
+  8032c8:	f3 2e 80 00 00 00 00 00 09 2f 80 00 00 00 00 00     ........./......
+  8032d8:	21 2f 80 00 00 00 00 00 39 2f 80 00 00 00 00 00     !/......9/......
+  8032e8:	46 2f 80 00 00 00 00 00 10 33 80 00 00 00 00 00     F/.......3......
+  8032f8:	5a 2f 80 00 00 00 00 00 72 2f 80 00 00 00 00 00     Z/......r/......
+  803308:	88 2f 80 00 00 00 00 00 66 69 6c 65 20 69 73 20     ./......file is 
+  803318:	6e 6f 74 20 61 20 76 61 6c 69 64 20 65 78 65 63     not a valid exec
+  803328:	75 74 61 62 6c 65 00 73 79 73 5f 69 70 63 5f 74     utable.sys_ipc_t
+  803338:	72 79 5f 73 65 6e 64 20 66 61 69 6c 65 64 3a 20     ry_send failed: 
+  803348:	25 69 00 6c 69 62 2f 69 70 63 2e 63 00 66 2e 0f     %i.lib/ipc.c.f..
+  803358:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803368:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803378:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803388:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803398:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8033a8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8033b8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8033c8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8033d8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8033e8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8033f8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803408:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803418:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803428:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803438:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803448:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803458:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803468:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803478:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803488:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803498:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8034a8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8034b8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8034c8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8034d8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8034e8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8034f8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803508:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803518:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803528:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803538:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803548:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803558:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803568:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803578:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803588:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803598:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8035a8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8035b8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8035c8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8035d8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8035e8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8035f8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803608:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803618:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803628:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803638:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803648:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803658:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803668:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803678:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803688:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803698:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8036a8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8036b8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8036c8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8036d8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8036e8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8036f8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803708:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803718:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803728:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803738:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803748:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803758:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803768:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803778:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803788:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803798:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8037a8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8037b8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8037c8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8037d8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8037e8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8037f8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803808:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803818:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803828:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803838:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803848:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803858:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803868:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803878:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803888:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803898:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8038a8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8038b8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8038c8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8038d8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8038e8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8038f8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803908:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803918:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803928:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803938:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803948:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803958:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803968:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803978:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803988:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803998:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8039a8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8039b8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8039c8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8039d8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8039e8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8039f8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803a08:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803a18:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803a28:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803a38:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803a48:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803a58:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803a68:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803a78:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803a88:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803a98:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803aa8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803ab8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803ac8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803ad8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803ae8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803af8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803b08:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803b18:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803b28:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803b38:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803b48:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803b58:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803b68:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803b78:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803b88:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803b98:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803ba8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803bb8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803bc8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803bd8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803be8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803bf8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803c08:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803c18:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803c28:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803c38:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803c48:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803c58:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803c68:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803c78:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803c88:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803c98:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803ca8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803cb8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803cc8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803cd8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803ce8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803cf8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803d08:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803d18:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803d28:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803d38:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803d48:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803d58:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803d68:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803d78:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803d88:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803d98:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803da8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803db8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803dc8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803dd8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803de8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803df8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803e08:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803e18:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803e28:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803e38:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803e48:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803e58:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803e68:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803e78:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803e88:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803e98:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803ea8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803eb8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803ec8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803ed8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803ee8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803ef8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803f08:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803f18:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803f28:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803f38:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803f48:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803f58:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803f68:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803f78:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803f88:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803f98:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803fa8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803fb8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803fc8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803fd8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803fe8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803ff8:	00 00 00 00 00 0f 1f 00                             ........
@@ -0,0 +1,6135 @@
+
+obj/user/forkexit:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 52 02 00 00       	call   800275 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+#include <inc/x86.h>
+
+#define FORKEXIT_ITERATIONS 256
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 57                	push   %r15
+  80002b:	41 56                	push   %r14
+  80002d:	41 55                	push   %r13
+  80002f:	41 54                	push   %r12
+  800031:	53                   	push   %rbx
+  800032:	48 83 ec 28          	sub    $0x28,%rsp
+    size_t iterations = argc > 1 ? strtol(argv[1], NULL, 0) : FORKEXIT_ITERATIONS;
+  800036:	48 c7 45 c8 00 01 00 	movq   $0x100,-0x38(%rbp)
+  80003d:	00 
+  80003e:	83 ff 01             	cmp    $0x1,%edi
+  800041:	7f 35                	jg     800078 <umain+0x53>
+}
+
+static inline uint64_t __attribute__((always_inline))
+read_tsc(void) {
+    uint32_t lo, hi;
+    asm volatile("rdtsc"
+  800043:	0f 31                	rdtsc
+                 : "=a"(lo), "=d"(hi));
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  800045:	48 c1 e2 20          	shl    $0x20,%rdx
+  800049:	89 c0                	mov    %eax,%eax
+  80004b:	48 09 c2             	or     %rax,%rdx
+  80004e:	49 89 d4             	mov    %rdx,%r12
+
+/* This must be inlined. Exercise for reader: why? */
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+    envid_t ret;
+    asm volatile("int %2"
+  800051:	b8 08 00 00 00       	mov    $0x8,%eax
+  800056:	cd 30                	int    $0x30
+  800058:	41 89 c5             	mov    %eax,%r13d
+    uint64_t alloc_cycles = 0, free_cycles = 0, fork_cycles = 0;
+
+    for (size_t i = 0; i < iterations; i++) {
+        uint64_t start = read_tsc();
+        envid_t child = sys_exofork();
+        if (child < 0) panic("sys_exofork: %i", child);
+  80005b:	85 c0                	test   %eax,%eax
+  80005d:	78 45                	js     8000a4 <umain+0x7f>
+    for (size_t i = 0; i < iterations; i++) {
+  80005f:	41 be 00 00 00 00    	mov    $0x0,%r14d
+    uint64_t alloc_cycles = 0, free_cycles = 0, fork_cycles = 0;
+  800065:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+  80006b:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  800072:	00 
+  800073:	e9 c3 00 00 00       	jmp    80013b <umain+0x116>
+    size_t iterations = argc > 1 ? strtol(argv[1], NULL, 0) : FORKEXIT_ITERATIONS;
+  800078:	48 8b 7e 08          	mov    0x8(%rsi),%rdi
+  80007c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800081:	be 00 00 00 00       	mov    $0x0,%esi
+  800086:	48 b8 27 11 80 00 00 	movabs $0x801127,%rax
+  80008d:	00 00 00 
+  800090:	ff d0                	call   *%rax
+    if (!iterations) iterations = 1;
+  800092:	48 85 c0             	test   %rax,%rax
+  800095:	ba 01 00 00 00       	mov    $0x1,%edx
+  80009a:	48 0f 45 d0          	cmovne %rax,%rdx
+  80009e:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8000a2:	eb 9f                	jmp    800043 <umain+0x1e>
+        if (child < 0) panic("sys_exofork: %i", child);
+  8000a4:	44 89 e9             	mov    %r13d,%ecx
+  8000a7:	48 ba e0 30 80 00 00 	movabs $0x8030e0,%rdx
+  8000ae:	00 00 00 
+  8000b1:	be 15 00 00 00       	mov    $0x15,%esi
+  8000b6:	48 bf f0 30 80 00 00 	movabs $0x8030f0,%rdi
+  8000bd:	00 00 00 
+  8000c0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000c5:	49 b8 41 03 80 00 00 	movabs $0x800341,%r8
+  8000cc:	00 00 00 
+  8000cf:	41 ff d0             	call   *%r8
+    asm volatile("rdtsc"
+  8000d2:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  8000d4:	48 c1 e2 20          	shl    $0x20,%rdx
+  8000d8:	89 c0                	mov    %eax,%eax
+  8000da:	48 89 d3             	mov    %rdx,%rbx
+  8000dd:	48 09 c3             	or     %rax,%rbx
+        /* Child is never made runnable */
+        if (!child) exit();
+        uint64_t mid = read_tsc();
+        int res = sys_env_destroy(child);
+  8000e0:	44 89 ef             	mov    %r13d,%edi
+  8000e3:	48 b8 3b 12 80 00 00 	movabs $0x80123b,%rax
+  8000ea:	00 00 00 
+  8000ed:	ff d0                	call   *%rax
+        if (res < 0) panic("sys_env_destroy: %i", res);
+  8000ef:	85 c0                	test   %eax,%eax
+  8000f1:	78 5b                	js     80014e <umain+0x129>
+        alloc_cycles += mid - start;
+  8000f3:	48 89 d8             	mov    %rbx,%rax
+  8000f6:	4c 29 e0             	sub    %r12,%rax
+  8000f9:	48 01 45 c0          	add    %rax,-0x40(%rbp)
+    asm volatile("rdtsc"
+  8000fd:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  8000ff:	48 c1 e2 20          	shl    $0x20,%rdx
+  800103:	89 c0                	mov    %eax,%eax
+  800105:	48 09 c2             	or     %rax,%rdx
+        free_cycles += read_tsc() - mid;
+  800108:	48 29 da             	sub    %rbx,%rdx
+  80010b:	49 01 d7             	add    %rdx,%r15
+    for (size_t i = 0; i < iterations; i++) {
+  80010e:	49 8d 5e 01          	lea    0x1(%r14),%rbx
+  800112:	48 39 5d c8          	cmp    %rbx,-0x38(%rbp)
+  800116:	74 63                	je     80017b <umain+0x156>
+    asm volatile("rdtsc"
+  800118:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  80011a:	48 c1 e2 20          	shl    $0x20,%rdx
+  80011e:	89 c0                	mov    %eax,%eax
+  800120:	48 09 c2             	or     %rax,%rdx
+  800123:	49 89 d4             	mov    %rdx,%r12
+  800126:	b8 08 00 00 00       	mov    $0x8,%eax
+  80012b:	cd 30                	int    $0x30
+  80012d:	41 89 c5             	mov    %eax,%r13d
+        if (child < 0) panic("sys_exofork: %i", child);
+  800130:	85 c0                	test   %eax,%eax
+  800132:	0f 88 6c ff ff ff    	js     8000a4 <umain+0x7f>
+    for (size_t i = 0; i < iterations; i++) {
+  800138:	49 89 de             	mov    %rbx,%r14
+        if (!child) exit();
+  80013b:	45 85 ed             	test   %r13d,%r13d
+  80013e:	75 92                	jne    8000d2 <umain+0xad>
+  800140:	48 b8 1e 03 80 00 00 	movabs $0x80031e,%rax
+  800147:	00 00 00 
+  80014a:	ff d0                	call   *%rax
+  80014c:	eb 84                	jmp    8000d2 <umain+0xad>
+        if (res < 0) panic("sys_env_destroy: %i", res);
+  80014e:	89 c1                	mov    %eax,%ecx
+  800150:	48 ba 00 31 80 00 00 	movabs $0x803100,%rdx
+  800157:	00 00 00 
+  80015a:	be 1a 00 00 00       	mov    $0x1a,%esi
+  80015f:	48 bf f0 30 80 00 00 	movabs $0x8030f0,%rdi
+  800166:	00 00 00 
+  800169:	b8 00 00 00 00       	mov    $0x0,%eax
+  80016e:	49 b8 41 03 80 00 00 	movabs $0x800341,%r8
+  800175:	00 00 00 
+  800178:	41 ff d0             	call   *%r8
+    }
+
+    for (size_t i = 0; i < iterations; i++) {
+  80017b:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+    uint64_t alloc_cycles = 0, free_cycles = 0, fork_cycles = 0;
+  800181:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  800188:	00 
+  800189:	eb 5e                	jmp    8001e9 <umain+0x1c4>
+        uint64_t start = read_tsc();
+        envid_t child = fork();
+        if (child < 0) panic("fork: %i", child);
+  80018b:	89 c1                	mov    %eax,%ecx
+  80018d:	48 ba e7 30 80 00 00 	movabs $0x8030e7,%rdx
+  800194:	00 00 00 
+  800197:	be 22 00 00 00       	mov    $0x22,%esi
+  80019c:	48 bf f0 30 80 00 00 	movabs $0x8030f0,%rdi
+  8001a3:	00 00 00 
+  8001a6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001ab:	49 b8 41 03 80 00 00 	movabs $0x800341,%r8
+  8001b2:	00 00 00 
+  8001b5:	41 ff d0             	call   *%r8
+        if (!child) exit();
+        wait(child);
+  8001b8:	44 89 e7             	mov    %r12d,%edi
+  8001bb:	48 b8 88 29 80 00 00 	movabs $0x802988,%rax
+  8001c2:	00 00 00 
+  8001c5:	ff d0                	call   *%rax
+    asm volatile("rdtsc"
+  8001c7:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  8001c9:	48 c1 e2 20          	shl    $0x20,%rdx
+  8001cd:	89 c0                	mov    %eax,%eax
+  8001cf:	48 09 c2             	or     %rax,%rdx
+        fork_cycles += read_tsc() - start;
+  8001d2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8001d6:	48 29 c2             	sub    %rax,%rdx
+  8001d9:	48 01 55 b8          	add    %rdx,-0x48(%rbp)
+    for (size_t i = 0; i < iterations; i++) {
+  8001dd:	49 8d 45 01          	lea    0x1(%r13),%rax
+  8001e1:	4d 39 ee             	cmp    %r13,%r14
+  8001e4:	74 35                	je     80021b <umain+0x1f6>
+  8001e6:	49 89 c5             	mov    %rax,%r13
+    asm volatile("rdtsc"
+  8001e9:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  8001eb:	48 c1 e2 20          	shl    $0x20,%rdx
+  8001ef:	89 c0                	mov    %eax,%eax
+  8001f1:	48 09 c2             	or     %rax,%rdx
+  8001f4:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+        envid_t child = fork();
+  8001f8:	48 b8 a1 17 80 00 00 	movabs $0x8017a1,%rax
+  8001ff:	00 00 00 
+  800202:	ff d0                	call   *%rax
+  800204:	41 89 c4             	mov    %eax,%r12d
+        if (child < 0) panic("fork: %i", child);
+  800207:	85 c0                	test   %eax,%eax
+  800209:	78 80                	js     80018b <umain+0x166>
+        if (!child) exit();
+  80020b:	75 ab                	jne    8001b8 <umain+0x193>
+  80020d:	48 b8 1e 03 80 00 00 	movabs $0x80031e,%rax
+  800214:	00 00 00 
+  800217:	ff d0                	call   *%rax
+  800219:	eb 9d                	jmp    8001b8 <umain+0x193>
+    }
+
+    cprintf("forkexit: exofork %lu cycles, destroy %lu cycles, fork+exit+wait %lu cycles\n",
+  80021b:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  80021f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800224:	48 f7 f3             	div    %rbx
+  800227:	48 89 c1             	mov    %rax,%rcx
+  80022a:	4c 89 f8             	mov    %r15,%rax
+  80022d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800232:	48 f7 f3             	div    %rbx
+  800235:	49 89 c7             	mov    %rax,%r15
+  800238:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80023c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800241:	48 f7 f3             	div    %rbx
+  800244:	48 89 c6             	mov    %rax,%rsi
+  800247:	4c 89 fa             	mov    %r15,%rdx
+  80024a:	48 bf 18 31 80 00 00 	movabs $0x803118,%rdi
+  800251:	00 00 00 
+  800254:	b8 00 00 00 00       	mov    $0x0,%eax
+  800259:	49 b8 91 04 80 00 00 	movabs $0x800491,%r8
+  800260:	00 00 00 
+  800263:	41 ff d0             	call   *%r8
+            (unsigned long)(alloc_cycles / iterations),
+            (unsigned long)(free_cycles / iterations),
+            (unsigned long)(fork_cycles / iterations));
+}
+  800266:	48 83 c4 28          	add    $0x28,%rsp
+  80026a:	5b                   	pop    %rbx
+  80026b:	41 5c                	pop    %r12
+  80026d:	41 5d                	pop    %r13
+  80026f:	41 5e                	pop    %r14
+  800271:	41 5f                	pop    %r15
+  800273:	5d                   	pop    %rbp
+  800274:	c3                   	ret
+
+0000000000800275 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800275:	55                   	push   %rbp
+  800276:	48 89 e5             	mov    %rsp,%rbp
+  800279:	41 56                	push   %r14
+  80027b:	41 55                	push   %r13
+  80027d:	41 54                	push   %r12
+  80027f:	53                   	push   %rbx
+  800280:	41 89 fd             	mov    %edi,%r13d
+  800283:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800286:	48 ba d8 40 80 00 00 	movabs $0x8040d8,%rdx
+  80028d:	00 00 00 
+  800290:	48 b8 d8 40 80 00 00 	movabs $0x8040d8,%rax
+  800297:	00 00 00 
+  80029a:	48 39 c2             	cmp    %rax,%rdx
+  80029d:	73 17                	jae    8002b6 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  80029f:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  8002a2:	49 89 c4             	mov    %rax,%r12
+  8002a5:	48 83 c3 08          	add    $0x8,%rbx
+  8002a9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002ae:	ff 53 f8             	call   *-0x8(%rbx)
+  8002b1:	4c 39 e3             	cmp    %r12,%rbx
+  8002b4:	72 ef                	jb     8002a5 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+    envid_t this_env_id = sys_getenvid();
+  8002b6:	48 b8 a6 12 80 00 00 	movabs $0x8012a6,%rax
+  8002bd:	00 00 00 
+  8002c0:	ff d0                	call   *%rax
+    thisenv = &((struct Env*)UENVS)[ENVX(this_env_id)];
+  8002c2:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8002c7:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+  8002ce:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8002d5:	00 00 00 
+  8002d8:	48 01 d0             	add    %rdx,%rax
+  8002db:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  8002e2:	00 00 00 
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8002e5:	45 85 ed             	test   %r13d,%r13d
+  8002e8:	7e 0d                	jle    8002f7 <libmain+0x82>
+  8002ea:	49 8b 06             	mov    (%r14),%rax
+  8002ed:	48 a3 00 40 80 00 00 	movabs %rax,0x804000
+  8002f4:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8002f7:	4c 89 f6             	mov    %r14,%rsi
+  8002fa:	44 89 ef             	mov    %r13d,%edi
+  8002fd:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  800304:	00 00 00 
+  800307:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  800309:	48 b8 1e 03 80 00 00 	movabs $0x80031e,%rax
+  800310:	00 00 00 
+  800313:	ff d0                	call   *%rax
+#endif
+}
+  800315:	5b                   	pop    %rbx
+  800316:	41 5c                	pop    %r12
+  800318:	41 5d                	pop    %r13
+  80031a:	41 5e                	pop    %r14
+  80031c:	5d                   	pop    %rbp
+  80031d:	c3                   	ret
+
+000000000080031e <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  80031e:	55                   	push   %rbp
+  80031f:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  800322:	48 b8 5e 1b 80 00 00 	movabs $0x801b5e,%rax
+  800329:	00 00 00 
+  80032c:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  80032e:	bf 00 00 00 00       	mov    $0x0,%edi
+  800333:	48 b8 3b 12 80 00 00 	movabs $0x80123b,%rax
+  80033a:	00 00 00 
+  80033d:	ff d0                	call   *%rax
+}
+  80033f:	5d                   	pop    %rbp
+  800340:	c3                   	ret
+
+0000000000800341 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  800341:	55                   	push   %rbp
+  800342:	48 89 e5             	mov    %rsp,%rbp
+  800345:	41 56                	push   %r14
+  800347:	41 55                	push   %r13
+  800349:	41 54                	push   %r12
+  80034b:	53                   	push   %rbx
+  80034c:	48 83 ec 50          	sub    $0x50,%rsp
+  800350:	49 89 fc             	mov    %rdi,%r12
+  800353:	41 89 f5             	mov    %esi,%r13d
+  800356:	48 89 d3             	mov    %rdx,%rbx
+  800359:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  80035d:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  800361:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800365:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  80036c:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800370:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  800374:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  800378:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  80037c:	48 b8 00 40 80 00 00 	movabs $0x804000,%rax
+  800383:	00 00 00 
+  800386:	4c 8b 30             	mov    (%rax),%r14
+  800389:	48 b8 a6 12 80 00 00 	movabs $0x8012a6,%rax
+  800390:	00 00 00 
+  800393:	ff d0                	call   *%rax
+  800395:	89 c6                	mov    %eax,%esi
+  800397:	45 89 e8             	mov    %r13d,%r8d
+  80039a:	4c 89 e1             	mov    %r12,%rcx
+  80039d:	4c 89 f2             	mov    %r14,%rdx
+  8003a0:	48 bf 70 31 80 00 00 	movabs $0x803170,%rdi
+  8003a7:	00 00 00 
+  8003aa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003af:	49 bc 91 04 80 00 00 	movabs $0x800491,%r12
+  8003b6:	00 00 00 
+  8003b9:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  8003bc:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  8003c0:	48 89 df             	mov    %rbx,%rdi
+  8003c3:	48 b8 2d 04 80 00 00 	movabs $0x80042d,%rax
+  8003ca:	00 00 00 
+  8003cd:	ff d0                	call   *%rax
+    cprintf("\n");
+  8003cf:	48 bf b3 37 80 00 00 	movabs $0x8037b3,%rdi
+  8003d6:	00 00 00 
+  8003d9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003de:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  8003e1:	cc                   	int3
+  8003e2:	eb fd                	jmp    8003e1 <_panic+0xa0>
+
+00000000008003e4 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  8003e4:	55                   	push   %rbp
+  8003e5:	48 89 e5             	mov    %rsp,%rbp
+  8003e8:	53                   	push   %rbx
+  8003e9:	48 83 ec 08          	sub    $0x8,%rsp
+  8003ed:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  8003f0:	8b 06                	mov    (%rsi),%eax
+  8003f2:	8d 50 01             	lea    0x1(%rax),%edx
+  8003f5:	89 16                	mov    %edx,(%rsi)
+  8003f7:	48 98                	cltq
+  8003f9:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  8003fe:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  800404:	74 0a                	je     800410 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  800406:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  80040a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80040e:	c9                   	leave
+  80040f:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  800410:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  800414:	be ff 00 00 00       	mov    $0xff,%esi
+  800419:	48 b8 dd 11 80 00 00 	movabs $0x8011dd,%rax
+  800420:	00 00 00 
+  800423:	ff d0                	call   *%rax
+        state->offset = 0;
+  800425:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  80042b:	eb d9                	jmp    800406 <putch+0x22>
+
+000000000080042d <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  80042d:	55                   	push   %rbp
+  80042e:	48 89 e5             	mov    %rsp,%rbp
+  800431:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  800438:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  80043b:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  800442:	b9 21 00 00 00       	mov    $0x21,%ecx
+  800447:	b8 00 00 00 00       	mov    $0x0,%eax
+  80044c:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  80044f:	48 89 f1             	mov    %rsi,%rcx
+  800452:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  800459:	48 bf e4 03 80 00 00 	movabs $0x8003e4,%rdi
+  800460:	00 00 00 
+  800463:	48 b8 e1 05 80 00 00 	movabs $0x8005e1,%rax
+  80046a:	00 00 00 
+  80046d:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  80046f:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  800476:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  80047d:	48 b8 dd 11 80 00 00 	movabs $0x8011dd,%rax
+  800484:	00 00 00 
+  800487:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  800489:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  80048f:	c9                   	leave
+  800490:	c3                   	ret
+
+0000000000800491 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  800491:	55                   	push   %rbp
+  800492:	48 89 e5             	mov    %rsp,%rbp
+  800495:	48 83 ec 50          	sub    $0x50,%rsp
+  800499:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  80049d:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8004a1:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8004a5:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8004a9:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  8004ad:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  8004b4:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8004b8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8004bc:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8004c0:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  8004c4:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  8004c8:	48 b8 2d 04 80 00 00 	movabs $0x80042d,%rax
+  8004cf:	00 00 00 
+  8004d2:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  8004d4:	c9                   	leave
+  8004d5:	c3                   	ret
+
+00000000008004d6 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  8004d6:	55                   	push   %rbp
+  8004d7:	48 89 e5             	mov    %rsp,%rbp
+  8004da:	41 57                	push   %r15
+  8004dc:	41 56                	push   %r14
+  8004de:	41 55                	push   %r13
+  8004e0:	41 54                	push   %r12
+  8004e2:	53                   	push   %rbx
+  8004e3:	48 83 ec 18          	sub    $0x18,%rsp
+  8004e7:	49 89 fc             	mov    %rdi,%r12
+  8004ea:	49 89 f5             	mov    %rsi,%r13
+  8004ed:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8004f1:	8b 45 10             	mov    0x10(%rbp),%eax
+  8004f4:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  8004f7:	41 89 cf             	mov    %ecx,%r15d
+  8004fa:	4c 39 fa             	cmp    %r15,%rdx
+  8004fd:	73 5b                	jae    80055a <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  8004ff:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  800503:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  800507:	85 db                	test   %ebx,%ebx
+  800509:	7e 0e                	jle    800519 <print_num+0x43>
+            putch(padc, put_arg);
+  80050b:	4c 89 ee             	mov    %r13,%rsi
+  80050e:	44 89 f7             	mov    %r14d,%edi
+  800511:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  800514:	83 eb 01             	sub    $0x1,%ebx
+  800517:	75 f2                	jne    80050b <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  800519:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  80051d:	48 b9 a4 31 80 00 00 	movabs $0x8031a4,%rcx
+  800524:	00 00 00 
+  800527:	48 b8 93 31 80 00 00 	movabs $0x803193,%rax
+  80052e:	00 00 00 
+  800531:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  800535:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800539:	ba 00 00 00 00       	mov    $0x0,%edx
+  80053e:	49 f7 f7             	div    %r15
+  800541:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  800545:	4c 89 ee             	mov    %r13,%rsi
+  800548:	41 ff d4             	call   *%r12
+}
+  80054b:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  80054f:	5b                   	pop    %rbx
+  800550:	41 5c                	pop    %r12
+  800552:	41 5d                	pop    %r13
+  800554:	41 5e                	pop    %r14
+  800556:	41 5f                	pop    %r15
+  800558:	5d                   	pop    %rbp
+  800559:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  80055a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80055e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800563:	49 f7 f7             	div    %r15
+  800566:	48 83 ec 08          	sub    $0x8,%rsp
+  80056a:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  80056e:	52                   	push   %rdx
+  80056f:	45 0f be c9          	movsbl %r9b,%r9d
+  800573:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  800577:	48 89 c2             	mov    %rax,%rdx
+  80057a:	48 b8 d6 04 80 00 00 	movabs $0x8004d6,%rax
+  800581:	00 00 00 
+  800584:	ff d0                	call   *%rax
+  800586:	48 83 c4 10          	add    $0x10,%rsp
+  80058a:	eb 8d                	jmp    800519 <print_num+0x43>
+
+000000000080058c <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  80058c:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  800590:	48 8b 06             	mov    (%rsi),%rax
+  800593:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  800597:	73 0a                	jae    8005a3 <sprintputch+0x17>
+        *state->start++ = ch;
+  800599:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80059d:	48 89 16             	mov    %rdx,(%rsi)
+  8005a0:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  8005a3:	c3                   	ret
+
+00000000008005a4 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  8005a4:	55                   	push   %rbp
+  8005a5:	48 89 e5             	mov    %rsp,%rbp
+  8005a8:	48 83 ec 50          	sub    $0x50,%rsp
+  8005ac:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8005b0:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8005b4:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  8005b8:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8005bf:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8005c3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8005c7:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8005cb:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  8005cf:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8005d3:	48 b8 e1 05 80 00 00 	movabs $0x8005e1,%rax
+  8005da:	00 00 00 
+  8005dd:	ff d0                	call   *%rax
+}
+  8005df:	c9                   	leave
+  8005e0:	c3                   	ret
+
+00000000008005e1 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  8005e1:	55                   	push   %rbp
+  8005e2:	48 89 e5             	mov    %rsp,%rbp
+  8005e5:	41 57                	push   %r15
+  8005e7:	41 56                	push   %r14
+  8005e9:	41 55                	push   %r13
+  8005eb:	41 54                	push   %r12
+  8005ed:	53                   	push   %rbx
+  8005ee:	48 83 ec 38          	sub    $0x38,%rsp
+  8005f2:	49 89 fe             	mov    %rdi,%r14
+  8005f5:	49 89 f5             	mov    %rsi,%r13
+  8005f8:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  8005fb:	48 8b 01             	mov    (%rcx),%rax
+  8005fe:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  800602:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800606:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80060a:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  80060e:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  800612:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  800616:	0f b6 3b             	movzbl (%rbx),%edi
+  800619:	40 80 ff 25          	cmp    $0x25,%dil
+  80061d:	74 18                	je     800637 <vprintfmt+0x56>
+            if (!ch) return;
+  80061f:	40 84 ff             	test   %dil,%dil
+  800622:	0f 84 b1 06 00 00    	je     800cd9 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  800628:	40 0f b6 ff          	movzbl %dil,%edi
+  80062c:	4c 89 ee             	mov    %r13,%rsi
+  80062f:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  800632:	4c 89 e3             	mov    %r12,%rbx
+  800635:	eb db                	jmp    800612 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  800637:	be 00 00 00 00       	mov    $0x0,%esi
+  80063c:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  800640:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  800645:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  80064b:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  800652:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800656:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  80065b:	41 0f b6 04 24       	movzbl (%r12),%eax
+  800660:	88 45 a0             	mov    %al,-0x60(%rbp)
+  800663:	83 e8 23             	sub    $0x23,%eax
+  800666:	3c 57                	cmp    $0x57,%al
+  800668:	0f 87 51 06 00 00    	ja     800cbf <vprintfmt+0x6de>
+  80066e:	0f b6 c0             	movzbl %al,%eax
+  800671:	48 b9 60 33 80 00 00 	movabs $0x803360,%rcx
+  800678:	00 00 00 
+  80067b:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  80067e:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  800681:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  800685:	eb cf                	jmp    800656 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  800687:	49 89 dc             	mov    %rbx,%r12
+  80068a:	be 01 00 00 00       	mov    $0x1,%esi
+  80068f:	eb c5                	jmp    800656 <vprintfmt+0x75>
+            padc = ch;
+  800691:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  800695:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800698:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80069b:	eb b9                	jmp    800656 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  80069d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006a0:	83 f8 2f             	cmp    $0x2f,%eax
+  8006a3:	77 24                	ja     8006c9 <vprintfmt+0xe8>
+  8006a5:	89 c1                	mov    %eax,%ecx
+  8006a7:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  8006ab:	83 c0 08             	add    $0x8,%eax
+  8006ae:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8006b1:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  8006b4:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  8006b7:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8006bb:	79 99                	jns    800656 <vprintfmt+0x75>
+                width = precision;
+  8006bd:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  8006c1:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8006c7:	eb 8d                	jmp    800656 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8006c9:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8006cd:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  8006d1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006d5:	eb da                	jmp    8006b1 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  8006d7:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  8006dc:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8006e0:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  8006e6:	3c 39                	cmp    $0x39,%al
+  8006e8:	77 1c                	ja     800706 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  8006ea:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  8006ee:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  8006f2:	0f b6 c0             	movzbl %al,%eax
+  8006f5:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8006fa:	0f b6 03             	movzbl (%rbx),%eax
+  8006fd:	3c 39                	cmp    $0x39,%al
+  8006ff:	76 e9                	jbe    8006ea <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  800701:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  800704:	eb b1                	jmp    8006b7 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  800706:	49 89 dc             	mov    %rbx,%r12
+  800709:	eb ac                	jmp    8006b7 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  80070b:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  80070e:	85 c9                	test   %ecx,%ecx
+  800710:	b8 00 00 00 00       	mov    $0x0,%eax
+  800715:	0f 49 c1             	cmovns %ecx,%eax
+  800718:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  80071b:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80071e:	e9 33 ff ff ff       	jmp    800656 <vprintfmt+0x75>
+            lflag++;
+  800723:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  800726:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800729:	e9 28 ff ff ff       	jmp    800656 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  80072e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800731:	83 f8 2f             	cmp    $0x2f,%eax
+  800734:	77 19                	ja     80074f <vprintfmt+0x16e>
+  800736:	89 c2                	mov    %eax,%edx
+  800738:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80073c:	83 c0 08             	add    $0x8,%eax
+  80073f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800742:	8b 3a                	mov    (%rdx),%edi
+  800744:	4c 89 ee             	mov    %r13,%rsi
+  800747:	41 ff d6             	call   *%r14
+            break;
+  80074a:	e9 c3 fe ff ff       	jmp    800612 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  80074f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800753:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800757:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80075b:	eb e5                	jmp    800742 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  80075d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800760:	83 f8 2f             	cmp    $0x2f,%eax
+  800763:	77 5a                	ja     8007bf <vprintfmt+0x1de>
+  800765:	89 c2                	mov    %eax,%edx
+  800767:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80076b:	83 c0 08             	add    $0x8,%eax
+  80076e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  800771:	8b 02                	mov    (%rdx),%eax
+  800773:	89 c1                	mov    %eax,%ecx
+  800775:	f7 d9                	neg    %ecx
+  800777:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  80077a:	83 f9 15             	cmp    $0x15,%ecx
+  80077d:	7f 4e                	jg     8007cd <vprintfmt+0x1ec>
+  80077f:	48 63 c1             	movslq %ecx,%rax
+  800782:	48 ba 20 36 80 00 00 	movabs $0x803620,%rdx
+  800789:	00 00 00 
+  80078c:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  800790:	48 85 c0             	test   %rax,%rax
+  800793:	74 38                	je     8007cd <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  800795:	48 89 c1             	mov    %rax,%rcx
+  800798:	48 ba 19 38 80 00 00 	movabs $0x803819,%rdx
+  80079f:	00 00 00 
+  8007a2:	4c 89 ee             	mov    %r13,%rsi
+  8007a5:	4c 89 f7             	mov    %r14,%rdi
+  8007a8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007ad:	49 b8 a4 05 80 00 00 	movabs $0x8005a4,%r8
+  8007b4:	00 00 00 
+  8007b7:	41 ff d0             	call   *%r8
+  8007ba:	e9 53 fe ff ff       	jmp    800612 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  8007bf:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007c3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007c7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007cb:	eb a4                	jmp    800771 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  8007cd:	48 ba bc 31 80 00 00 	movabs $0x8031bc,%rdx
+  8007d4:	00 00 00 
+  8007d7:	4c 89 ee             	mov    %r13,%rsi
+  8007da:	4c 89 f7             	mov    %r14,%rdi
+  8007dd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007e2:	49 b8 a4 05 80 00 00 	movabs $0x8005a4,%r8
+  8007e9:	00 00 00 
+  8007ec:	41 ff d0             	call   *%r8
+  8007ef:	e9 1e fe ff ff       	jmp    800612 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8007f4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007f7:	83 f8 2f             	cmp    $0x2f,%eax
+  8007fa:	77 6c                	ja     800868 <vprintfmt+0x287>
+  8007fc:	89 c2                	mov    %eax,%edx
+  8007fe:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800802:	83 c0 08             	add    $0x8,%eax
+  800805:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800808:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  80080b:	48 85 d2             	test   %rdx,%rdx
+  80080e:	48 b8 b5 31 80 00 00 	movabs $0x8031b5,%rax
+  800815:	00 00 00 
+  800818:	48 0f 45 c2          	cmovne %rdx,%rax
+  80081c:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  800820:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800824:	7e 06                	jle    80082c <vprintfmt+0x24b>
+  800826:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  80082a:	75 4a                	jne    800876 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  80082c:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800830:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  800834:	0f b6 00             	movzbl (%rax),%eax
+  800837:	84 c0                	test   %al,%al
+  800839:	0f 85 9a 00 00 00    	jne    8008d9 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  80083f:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800842:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  800846:	85 c0                	test   %eax,%eax
+  800848:	0f 8e c4 fd ff ff    	jle    800612 <vprintfmt+0x31>
+  80084e:	4c 89 ee             	mov    %r13,%rsi
+  800851:	bf 20 00 00 00       	mov    $0x20,%edi
+  800856:	41 ff d6             	call   *%r14
+  800859:	41 83 ec 01          	sub    $0x1,%r12d
+  80085d:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  800861:	75 eb                	jne    80084e <vprintfmt+0x26d>
+  800863:	e9 aa fd ff ff       	jmp    800612 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800868:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80086c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800870:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800874:	eb 92                	jmp    800808 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  800876:	49 63 f7             	movslq %r15d,%rsi
+  800879:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  80087d:	48 b8 93 0d 80 00 00 	movabs $0x800d93,%rax
+  800884:	00 00 00 
+  800887:	ff d0                	call   *%rax
+  800889:	48 89 c2             	mov    %rax,%rdx
+  80088c:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80088f:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  800891:	8d 70 ff             	lea    -0x1(%rax),%esi
+  800894:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  800897:	85 c0                	test   %eax,%eax
+  800899:	7e 91                	jle    80082c <vprintfmt+0x24b>
+  80089b:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  8008a0:	4c 89 ee             	mov    %r13,%rsi
+  8008a3:	44 89 e7             	mov    %r12d,%edi
+  8008a6:	41 ff d6             	call   *%r14
+  8008a9:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8008ad:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8008b0:	83 f8 ff             	cmp    $0xffffffff,%eax
+  8008b3:	75 eb                	jne    8008a0 <vprintfmt+0x2bf>
+  8008b5:	e9 72 ff ff ff       	jmp    80082c <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8008ba:	0f b6 f8             	movzbl %al,%edi
+  8008bd:	4c 89 ee             	mov    %r13,%rsi
+  8008c0:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8008c3:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8008c7:	49 83 c4 01          	add    $0x1,%r12
+  8008cb:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  8008d1:	84 c0                	test   %al,%al
+  8008d3:	0f 84 66 ff ff ff    	je     80083f <vprintfmt+0x25e>
+  8008d9:	45 85 ff             	test   %r15d,%r15d
+  8008dc:	78 0a                	js     8008e8 <vprintfmt+0x307>
+  8008de:	41 83 ef 01          	sub    $0x1,%r15d
+  8008e2:	0f 88 57 ff ff ff    	js     80083f <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8008e8:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  8008ec:	74 cc                	je     8008ba <vprintfmt+0x2d9>
+  8008ee:	8d 50 e0             	lea    -0x20(%rax),%edx
+  8008f1:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  8008f6:	80 fa 5e             	cmp    $0x5e,%dl
+  8008f9:	77 c2                	ja     8008bd <vprintfmt+0x2dc>
+  8008fb:	eb bd                	jmp    8008ba <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  8008fd:	40 84 f6             	test   %sil,%sil
+  800900:	75 26                	jne    800928 <vprintfmt+0x347>
+    switch (lflag) {
+  800902:	85 d2                	test   %edx,%edx
+  800904:	74 59                	je     80095f <vprintfmt+0x37e>
+  800906:	83 fa 01             	cmp    $0x1,%edx
+  800909:	74 7b                	je     800986 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  80090b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80090e:	83 f8 2f             	cmp    $0x2f,%eax
+  800911:	0f 87 96 00 00 00    	ja     8009ad <vprintfmt+0x3cc>
+  800917:	89 c2                	mov    %eax,%edx
+  800919:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80091d:	83 c0 08             	add    $0x8,%eax
+  800920:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800923:	4c 8b 22             	mov    (%rdx),%r12
+  800926:	eb 17                	jmp    80093f <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  800928:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80092b:	83 f8 2f             	cmp    $0x2f,%eax
+  80092e:	77 21                	ja     800951 <vprintfmt+0x370>
+  800930:	89 c2                	mov    %eax,%edx
+  800932:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800936:	83 c0 08             	add    $0x8,%eax
+  800939:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80093c:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  80093f:	4d 85 e4             	test   %r12,%r12
+  800942:	78 7a                	js     8009be <vprintfmt+0x3dd>
+            num = i;
+  800944:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  800947:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  80094c:	e9 50 02 00 00       	jmp    800ba1 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800951:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800955:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800959:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80095d:	eb dd                	jmp    80093c <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  80095f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800962:	83 f8 2f             	cmp    $0x2f,%eax
+  800965:	77 11                	ja     800978 <vprintfmt+0x397>
+  800967:	89 c2                	mov    %eax,%edx
+  800969:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80096d:	83 c0 08             	add    $0x8,%eax
+  800970:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800973:	4c 63 22             	movslq (%rdx),%r12
+  800976:	eb c7                	jmp    80093f <vprintfmt+0x35e>
+  800978:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80097c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800980:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800984:	eb ed                	jmp    800973 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  800986:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800989:	83 f8 2f             	cmp    $0x2f,%eax
+  80098c:	77 11                	ja     80099f <vprintfmt+0x3be>
+  80098e:	89 c2                	mov    %eax,%edx
+  800990:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800994:	83 c0 08             	add    $0x8,%eax
+  800997:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80099a:	4c 8b 22             	mov    (%rdx),%r12
+  80099d:	eb a0                	jmp    80093f <vprintfmt+0x35e>
+  80099f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009a3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009a7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009ab:	eb ed                	jmp    80099a <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  8009ad:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009b1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009b5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009b9:	e9 65 ff ff ff       	jmp    800923 <vprintfmt+0x342>
+                putch('-', put_arg);
+  8009be:	4c 89 ee             	mov    %r13,%rsi
+  8009c1:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  8009c6:	41 ff d6             	call   *%r14
+                i = -i;
+  8009c9:	49 f7 dc             	neg    %r12
+  8009cc:	e9 73 ff ff ff       	jmp    800944 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  8009d1:	40 84 f6             	test   %sil,%sil
+  8009d4:	75 32                	jne    800a08 <vprintfmt+0x427>
+    switch (lflag) {
+  8009d6:	85 d2                	test   %edx,%edx
+  8009d8:	74 5d                	je     800a37 <vprintfmt+0x456>
+  8009da:	83 fa 01             	cmp    $0x1,%edx
+  8009dd:	0f 84 82 00 00 00    	je     800a65 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  8009e3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009e6:	83 f8 2f             	cmp    $0x2f,%eax
+  8009e9:	0f 87 a5 00 00 00    	ja     800a94 <vprintfmt+0x4b3>
+  8009ef:	89 c2                	mov    %eax,%edx
+  8009f1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009f5:	83 c0 08             	add    $0x8,%eax
+  8009f8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009fb:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8009fe:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  800a03:	e9 99 01 00 00       	jmp    800ba1 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800a08:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a0b:	83 f8 2f             	cmp    $0x2f,%eax
+  800a0e:	77 19                	ja     800a29 <vprintfmt+0x448>
+  800a10:	89 c2                	mov    %eax,%edx
+  800a12:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a16:	83 c0 08             	add    $0x8,%eax
+  800a19:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a1c:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800a1f:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800a24:	e9 78 01 00 00       	jmp    800ba1 <vprintfmt+0x5c0>
+  800a29:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a2d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a31:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a35:	eb e5                	jmp    800a1c <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  800a37:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a3a:	83 f8 2f             	cmp    $0x2f,%eax
+  800a3d:	77 18                	ja     800a57 <vprintfmt+0x476>
+  800a3f:	89 c2                	mov    %eax,%edx
+  800a41:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a45:	83 c0 08             	add    $0x8,%eax
+  800a48:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a4b:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800a4d:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  800a52:	e9 4a 01 00 00       	jmp    800ba1 <vprintfmt+0x5c0>
+  800a57:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a5b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a5f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a63:	eb e6                	jmp    800a4b <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  800a65:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a68:	83 f8 2f             	cmp    $0x2f,%eax
+  800a6b:	77 19                	ja     800a86 <vprintfmt+0x4a5>
+  800a6d:	89 c2                	mov    %eax,%edx
+  800a6f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a73:	83 c0 08             	add    $0x8,%eax
+  800a76:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a79:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800a7c:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  800a81:	e9 1b 01 00 00       	jmp    800ba1 <vprintfmt+0x5c0>
+  800a86:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a8a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a8e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a92:	eb e5                	jmp    800a79 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  800a94:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a98:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a9c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800aa0:	e9 56 ff ff ff       	jmp    8009fb <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  800aa5:	40 84 f6             	test   %sil,%sil
+  800aa8:	75 2e                	jne    800ad8 <vprintfmt+0x4f7>
+    switch (lflag) {
+  800aaa:	85 d2                	test   %edx,%edx
+  800aac:	74 59                	je     800b07 <vprintfmt+0x526>
+  800aae:	83 fa 01             	cmp    $0x1,%edx
+  800ab1:	74 7f                	je     800b32 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  800ab3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ab6:	83 f8 2f             	cmp    $0x2f,%eax
+  800ab9:	0f 87 9f 00 00 00    	ja     800b5e <vprintfmt+0x57d>
+  800abf:	89 c2                	mov    %eax,%edx
+  800ac1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ac5:	83 c0 08             	add    $0x8,%eax
+  800ac8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800acb:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800ace:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  800ad3:	e9 c9 00 00 00       	jmp    800ba1 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800ad8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800adb:	83 f8 2f             	cmp    $0x2f,%eax
+  800ade:	77 19                	ja     800af9 <vprintfmt+0x518>
+  800ae0:	89 c2                	mov    %eax,%edx
+  800ae2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ae6:	83 c0 08             	add    $0x8,%eax
+  800ae9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800aec:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800aef:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800af4:	e9 a8 00 00 00       	jmp    800ba1 <vprintfmt+0x5c0>
+  800af9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800afd:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b01:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b05:	eb e5                	jmp    800aec <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  800b07:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b0a:	83 f8 2f             	cmp    $0x2f,%eax
+  800b0d:	77 15                	ja     800b24 <vprintfmt+0x543>
+  800b0f:	89 c2                	mov    %eax,%edx
+  800b11:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b15:	83 c0 08             	add    $0x8,%eax
+  800b18:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b1b:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  800b1d:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  800b22:	eb 7d                	jmp    800ba1 <vprintfmt+0x5c0>
+  800b24:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b28:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b2c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b30:	eb e9                	jmp    800b1b <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  800b32:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b35:	83 f8 2f             	cmp    $0x2f,%eax
+  800b38:	77 16                	ja     800b50 <vprintfmt+0x56f>
+  800b3a:	89 c2                	mov    %eax,%edx
+  800b3c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b40:	83 c0 08             	add    $0x8,%eax
+  800b43:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b46:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800b49:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  800b4e:	eb 51                	jmp    800ba1 <vprintfmt+0x5c0>
+  800b50:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b54:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b58:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b5c:	eb e8                	jmp    800b46 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  800b5e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b62:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b66:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b6a:	e9 5c ff ff ff       	jmp    800acb <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  800b6f:	4c 89 ee             	mov    %r13,%rsi
+  800b72:	bf 30 00 00 00       	mov    $0x30,%edi
+  800b77:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800b7a:	4c 89 ee             	mov    %r13,%rsi
+  800b7d:	bf 78 00 00 00       	mov    $0x78,%edi
+  800b82:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800b85:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b88:	83 f8 2f             	cmp    $0x2f,%eax
+  800b8b:	77 47                	ja     800bd4 <vprintfmt+0x5f3>
+  800b8d:	89 c2                	mov    %eax,%edx
+  800b8f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b93:	83 c0 08             	add    $0x8,%eax
+  800b96:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b99:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800b9c:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800ba1:	48 83 ec 08          	sub    $0x8,%rsp
+  800ba5:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800ba9:	0f 94 c0             	sete   %al
+  800bac:	0f b6 c0             	movzbl %al,%eax
+  800baf:	50                   	push   %rax
+  800bb0:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800bb5:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800bb9:	4c 89 ee             	mov    %r13,%rsi
+  800bbc:	4c 89 f7             	mov    %r14,%rdi
+  800bbf:	48 b8 d6 04 80 00 00 	movabs $0x8004d6,%rax
+  800bc6:	00 00 00 
+  800bc9:	ff d0                	call   *%rax
+            break;
+  800bcb:	48 83 c4 10          	add    $0x10,%rsp
+  800bcf:	e9 3e fa ff ff       	jmp    800612 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800bd4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bd8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bdc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800be0:	eb b7                	jmp    800b99 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  800be2:	40 84 f6             	test   %sil,%sil
+  800be5:	75 2b                	jne    800c12 <vprintfmt+0x631>
+    switch (lflag) {
+  800be7:	85 d2                	test   %edx,%edx
+  800be9:	74 56                	je     800c41 <vprintfmt+0x660>
+  800beb:	83 fa 01             	cmp    $0x1,%edx
+  800bee:	74 7f                	je     800c6f <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800bf0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bf3:	83 f8 2f             	cmp    $0x2f,%eax
+  800bf6:	0f 87 a2 00 00 00    	ja     800c9e <vprintfmt+0x6bd>
+  800bfc:	89 c2                	mov    %eax,%edx
+  800bfe:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c02:	83 c0 08             	add    $0x8,%eax
+  800c05:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c08:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800c0b:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800c10:	eb 8f                	jmp    800ba1 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800c12:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c15:	83 f8 2f             	cmp    $0x2f,%eax
+  800c18:	77 19                	ja     800c33 <vprintfmt+0x652>
+  800c1a:	89 c2                	mov    %eax,%edx
+  800c1c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c20:	83 c0 08             	add    $0x8,%eax
+  800c23:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c26:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800c29:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800c2e:	e9 6e ff ff ff       	jmp    800ba1 <vprintfmt+0x5c0>
+  800c33:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c37:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c3b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c3f:	eb e5                	jmp    800c26 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800c41:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c44:	83 f8 2f             	cmp    $0x2f,%eax
+  800c47:	77 18                	ja     800c61 <vprintfmt+0x680>
+  800c49:	89 c2                	mov    %eax,%edx
+  800c4b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c4f:	83 c0 08             	add    $0x8,%eax
+  800c52:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c55:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800c57:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800c5c:	e9 40 ff ff ff       	jmp    800ba1 <vprintfmt+0x5c0>
+  800c61:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c65:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c69:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c6d:	eb e6                	jmp    800c55 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800c6f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c72:	83 f8 2f             	cmp    $0x2f,%eax
+  800c75:	77 19                	ja     800c90 <vprintfmt+0x6af>
+  800c77:	89 c2                	mov    %eax,%edx
+  800c79:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c7d:	83 c0 08             	add    $0x8,%eax
+  800c80:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c83:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800c86:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800c8b:	e9 11 ff ff ff       	jmp    800ba1 <vprintfmt+0x5c0>
+  800c90:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c94:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c98:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c9c:	eb e5                	jmp    800c83 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800c9e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ca2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ca6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800caa:	e9 59 ff ff ff       	jmp    800c08 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800caf:	4c 89 ee             	mov    %r13,%rsi
+  800cb2:	bf 25 00 00 00       	mov    $0x25,%edi
+  800cb7:	41 ff d6             	call   *%r14
+            break;
+  800cba:	e9 53 f9 ff ff       	jmp    800612 <vprintfmt+0x31>
+            putch('%', put_arg);
+  800cbf:	4c 89 ee             	mov    %r13,%rsi
+  800cc2:	bf 25 00 00 00       	mov    $0x25,%edi
+  800cc7:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800cca:	48 83 eb 01          	sub    $0x1,%rbx
+  800cce:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800cd2:	75 f6                	jne    800cca <vprintfmt+0x6e9>
+  800cd4:	e9 39 f9 ff ff       	jmp    800612 <vprintfmt+0x31>
+}
+  800cd9:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800cdd:	5b                   	pop    %rbx
+  800cde:	41 5c                	pop    %r12
+  800ce0:	41 5d                	pop    %r13
+  800ce2:	41 5e                	pop    %r14
+  800ce4:	41 5f                	pop    %r15
+  800ce6:	5d                   	pop    %rbp
+  800ce7:	c3                   	ret
+
+0000000000800ce8 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800ce8:	55                   	push   %rbp
+  800ce9:	48 89 e5             	mov    %rsp,%rbp
+  800cec:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800cf0:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800cf4:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800cf9:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800cfd:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800d04:	48 85 ff             	test   %rdi,%rdi
+  800d07:	74 2b                	je     800d34 <vsnprintf+0x4c>
+  800d09:	48 85 f6             	test   %rsi,%rsi
+  800d0c:	74 26                	je     800d34 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800d0e:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800d12:	48 bf 8c 05 80 00 00 	movabs $0x80058c,%rdi
+  800d19:	00 00 00 
+  800d1c:	48 b8 e1 05 80 00 00 	movabs $0x8005e1,%rax
+  800d23:	00 00 00 
+  800d26:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800d28:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800d2c:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800d2f:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800d32:	c9                   	leave
+  800d33:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800d34:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800d39:	eb f7                	jmp    800d32 <vsnprintf+0x4a>
+
+0000000000800d3b <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800d3b:	55                   	push   %rbp
+  800d3c:	48 89 e5             	mov    %rsp,%rbp
+  800d3f:	48 83 ec 50          	sub    $0x50,%rsp
+  800d43:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800d47:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800d4b:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800d4f:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800d56:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800d5a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d5e:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800d62:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800d66:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800d6a:	48 b8 e8 0c 80 00 00 	movabs $0x800ce8,%rax
+  800d71:	00 00 00 
+  800d74:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800d76:	c9                   	leave
+  800d77:	c3                   	ret
+
+0000000000800d78 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800d78:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800d7b:	74 10                	je     800d8d <strlen+0x15>
+    size_t n = 0;
+  800d7d:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800d82:	48 83 c0 01          	add    $0x1,%rax
+  800d86:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800d8a:	75 f6                	jne    800d82 <strlen+0xa>
+  800d8c:	c3                   	ret
+    size_t n = 0;
+  800d8d:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800d92:	c3                   	ret
+
+0000000000800d93 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800d93:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800d96:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800d9b:	48 85 f6             	test   %rsi,%rsi
+  800d9e:	74 11                	je     800db1 <strnlen+0x1e>
+  800da0:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800da4:	74 0c                	je     800db2 <strnlen+0x1f>
+  800da6:	48 83 c2 01          	add    $0x1,%rdx
+  800daa:	48 39 d0             	cmp    %rdx,%rax
+  800dad:	75 f1                	jne    800da0 <strnlen+0xd>
+  800daf:	eb 04                	jmp    800db5 <strnlen+0x22>
+  800db1:	c3                   	ret
+  800db2:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800db5:	c3                   	ret
+
+0000000000800db6 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800db6:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800db9:	ba 00 00 00 00       	mov    $0x0,%edx
+  800dbe:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800dc2:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800dc5:	48 83 c2 01          	add    $0x1,%rdx
+  800dc9:	84 c9                	test   %cl,%cl
+  800dcb:	75 f1                	jne    800dbe <strcpy+0x8>
+        ;
+    return res;
+}
+  800dcd:	c3                   	ret
+
+0000000000800dce <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800dce:	55                   	push   %rbp
+  800dcf:	48 89 e5             	mov    %rsp,%rbp
+  800dd2:	41 54                	push   %r12
+  800dd4:	53                   	push   %rbx
+  800dd5:	48 89 fb             	mov    %rdi,%rbx
+  800dd8:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800ddb:	48 b8 78 0d 80 00 00 	movabs $0x800d78,%rax
+  800de2:	00 00 00 
+  800de5:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800de7:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800deb:	4c 89 e6             	mov    %r12,%rsi
+  800dee:	48 b8 b6 0d 80 00 00 	movabs $0x800db6,%rax
+  800df5:	00 00 00 
+  800df8:	ff d0                	call   *%rax
+    return dst;
+}
+  800dfa:	48 89 d8             	mov    %rbx,%rax
+  800dfd:	5b                   	pop    %rbx
+  800dfe:	41 5c                	pop    %r12
+  800e00:	5d                   	pop    %rbp
+  800e01:	c3                   	ret
+
+0000000000800e02 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800e02:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800e05:	48 85 d2             	test   %rdx,%rdx
+  800e08:	74 1f                	je     800e29 <strncpy+0x27>
+  800e0a:	48 01 fa             	add    %rdi,%rdx
+  800e0d:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800e10:	48 83 c1 01          	add    $0x1,%rcx
+  800e14:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800e18:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800e1c:	41 80 f8 01          	cmp    $0x1,%r8b
+  800e20:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800e24:	48 39 ca             	cmp    %rcx,%rdx
+  800e27:	75 e7                	jne    800e10 <strncpy+0xe>
+    }
+    return ret;
+}
+  800e29:	c3                   	ret
+
+0000000000800e2a <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800e2a:	48 89 f8             	mov    %rdi,%rax
+  800e2d:	48 85 d2             	test   %rdx,%rdx
+  800e30:	74 24                	je     800e56 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800e32:	48 83 ea 01          	sub    $0x1,%rdx
+  800e36:	74 1b                	je     800e53 <strlcpy+0x29>
+  800e38:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800e3c:	0f b6 16             	movzbl (%rsi),%edx
+  800e3f:	84 d2                	test   %dl,%dl
+  800e41:	74 10                	je     800e53 <strlcpy+0x29>
+            *dst++ = *src++;
+  800e43:	48 83 c6 01          	add    $0x1,%rsi
+  800e47:	48 83 c0 01          	add    $0x1,%rax
+  800e4b:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800e4e:	48 39 c8             	cmp    %rcx,%rax
+  800e51:	75 e9                	jne    800e3c <strlcpy+0x12>
+        *dst = '\0';
+  800e53:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800e56:	48 29 f8             	sub    %rdi,%rax
+}
+  800e59:	c3                   	ret
+
+0000000000800e5a <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800e5a:	0f b6 07             	movzbl (%rdi),%eax
+  800e5d:	84 c0                	test   %al,%al
+  800e5f:	74 13                	je     800e74 <strcmp+0x1a>
+  800e61:	38 06                	cmp    %al,(%rsi)
+  800e63:	75 0f                	jne    800e74 <strcmp+0x1a>
+  800e65:	48 83 c7 01          	add    $0x1,%rdi
+  800e69:	48 83 c6 01          	add    $0x1,%rsi
+  800e6d:	0f b6 07             	movzbl (%rdi),%eax
+  800e70:	84 c0                	test   %al,%al
+  800e72:	75 ed                	jne    800e61 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800e74:	0f b6 c0             	movzbl %al,%eax
+  800e77:	0f b6 16             	movzbl (%rsi),%edx
+  800e7a:	29 d0                	sub    %edx,%eax
+}
+  800e7c:	c3                   	ret
+
+0000000000800e7d <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800e7d:	48 85 d2             	test   %rdx,%rdx
+  800e80:	74 1f                	je     800ea1 <strncmp+0x24>
+  800e82:	0f b6 07             	movzbl (%rdi),%eax
+  800e85:	84 c0                	test   %al,%al
+  800e87:	74 1e                	je     800ea7 <strncmp+0x2a>
+  800e89:	3a 06                	cmp    (%rsi),%al
+  800e8b:	75 1a                	jne    800ea7 <strncmp+0x2a>
+  800e8d:	48 83 c7 01          	add    $0x1,%rdi
+  800e91:	48 83 c6 01          	add    $0x1,%rsi
+  800e95:	48 83 ea 01          	sub    $0x1,%rdx
+  800e99:	75 e7                	jne    800e82 <strncmp+0x5>
+
+    if (!n) return 0;
+  800e9b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ea0:	c3                   	ret
+  800ea1:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ea6:	c3                   	ret
+  800ea7:	48 85 d2             	test   %rdx,%rdx
+  800eaa:	74 09                	je     800eb5 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800eac:	0f b6 07             	movzbl (%rdi),%eax
+  800eaf:	0f b6 16             	movzbl (%rsi),%edx
+  800eb2:	29 d0                	sub    %edx,%eax
+  800eb4:	c3                   	ret
+    if (!n) return 0;
+  800eb5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800eba:	c3                   	ret
+
+0000000000800ebb <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800ebb:	0f b6 17             	movzbl (%rdi),%edx
+  800ebe:	84 d2                	test   %dl,%dl
+  800ec0:	74 18                	je     800eda <strchr+0x1f>
+        if (*str == c) {
+  800ec2:	0f be d2             	movsbl %dl,%edx
+  800ec5:	39 f2                	cmp    %esi,%edx
+  800ec7:	74 17                	je     800ee0 <strchr+0x25>
+    for (; *str; str++) {
+  800ec9:	48 83 c7 01          	add    $0x1,%rdi
+  800ecd:	0f b6 17             	movzbl (%rdi),%edx
+  800ed0:	84 d2                	test   %dl,%dl
+  800ed2:	75 ee                	jne    800ec2 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800ed4:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ed9:	c3                   	ret
+  800eda:	b8 00 00 00 00       	mov    $0x0,%eax
+  800edf:	c3                   	ret
+  800ee0:	48 89 f8             	mov    %rdi,%rax
+}
+  800ee3:	c3                   	ret
+
+0000000000800ee4 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800ee4:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800ee7:	0f b6 17             	movzbl (%rdi),%edx
+  800eea:	84 d2                	test   %dl,%dl
+  800eec:	74 13                	je     800f01 <strfind+0x1d>
+  800eee:	0f be d2             	movsbl %dl,%edx
+  800ef1:	39 f2                	cmp    %esi,%edx
+  800ef3:	74 0b                	je     800f00 <strfind+0x1c>
+  800ef5:	48 83 c0 01          	add    $0x1,%rax
+  800ef9:	0f b6 10             	movzbl (%rax),%edx
+  800efc:	84 d2                	test   %dl,%dl
+  800efe:	75 ee                	jne    800eee <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800f00:	c3                   	ret
+  800f01:	c3                   	ret
+
+0000000000800f02 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800f02:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800f05:	48 89 f8             	mov    %rdi,%rax
+  800f08:	48 f7 d8             	neg    %rax
+  800f0b:	83 e0 07             	and    $0x7,%eax
+  800f0e:	49 89 d1             	mov    %rdx,%r9
+  800f11:	49 29 c1             	sub    %rax,%r9
+  800f14:	78 36                	js     800f4c <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800f16:	40 0f b6 c6          	movzbl %sil,%eax
+  800f1a:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800f21:	01 01 01 
+  800f24:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800f28:	40 f6 c7 07          	test   $0x7,%dil
+  800f2c:	75 38                	jne    800f66 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800f2e:	4c 89 c9             	mov    %r9,%rcx
+  800f31:	48 c1 f9 03          	sar    $0x3,%rcx
+  800f35:	74 0c                	je     800f43 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800f37:	fc                   	cld
+  800f38:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800f3b:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800f3f:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800f43:	4d 85 c9             	test   %r9,%r9
+  800f46:	75 45                	jne    800f8d <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800f48:	4c 89 c0             	mov    %r8,%rax
+  800f4b:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800f4c:	48 85 d2             	test   %rdx,%rdx
+  800f4f:	74 f7                	je     800f48 <memset+0x46>
+  800f51:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800f54:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800f57:	48 83 c0 01          	add    $0x1,%rax
+  800f5b:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  800f5f:	48 39 c2             	cmp    %rax,%rdx
+  800f62:	75 f3                	jne    800f57 <memset+0x55>
+  800f64:	eb e2                	jmp    800f48 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  800f66:	40 f6 c7 01          	test   $0x1,%dil
+  800f6a:	74 06                	je     800f72 <memset+0x70>
+  800f6c:	88 07                	mov    %al,(%rdi)
+  800f6e:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800f72:	40 f6 c7 02          	test   $0x2,%dil
+  800f76:	74 07                	je     800f7f <memset+0x7d>
+  800f78:	66 89 07             	mov    %ax,(%rdi)
+  800f7b:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800f7f:	40 f6 c7 04          	test   $0x4,%dil
+  800f83:	74 a9                	je     800f2e <memset+0x2c>
+  800f85:	89 07                	mov    %eax,(%rdi)
+  800f87:	48 83 c7 04          	add    $0x4,%rdi
+  800f8b:	eb a1                	jmp    800f2e <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800f8d:	41 f6 c1 04          	test   $0x4,%r9b
+  800f91:	74 06                	je     800f99 <memset+0x97>
+  800f93:	89 07                	mov    %eax,(%rdi)
+  800f95:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800f99:	41 f6 c1 02          	test   $0x2,%r9b
+  800f9d:	74 07                	je     800fa6 <memset+0xa4>
+  800f9f:	66 89 07             	mov    %ax,(%rdi)
+  800fa2:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  800fa6:	41 f6 c1 01          	test   $0x1,%r9b
+  800faa:	74 9c                	je     800f48 <memset+0x46>
+  800fac:	88 07                	mov    %al,(%rdi)
+  800fae:	eb 98                	jmp    800f48 <memset+0x46>
+
+0000000000800fb0 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  800fb0:	48 89 f8             	mov    %rdi,%rax
+  800fb3:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  800fb6:	48 39 fe             	cmp    %rdi,%rsi
+  800fb9:	73 3b                	jae    800ff6 <memmove+0x46>
+  800fbb:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  800fbf:	48 39 d7             	cmp    %rdx,%rdi
+  800fc2:	73 32                	jae    800ff6 <memmove+0x46>
+        s += n;
+        d += n;
+  800fc4:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800fc8:	48 89 d6             	mov    %rdx,%rsi
+  800fcb:	48 09 fe             	or     %rdi,%rsi
+  800fce:	48 09 ce             	or     %rcx,%rsi
+  800fd1:	40 f6 c6 07          	test   $0x7,%sil
+  800fd5:	75 12                	jne    800fe9 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  800fd7:	48 83 ef 08          	sub    $0x8,%rdi
+  800fdb:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  800fdf:	48 c1 e9 03          	shr    $0x3,%rcx
+  800fe3:	fd                   	std
+  800fe4:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  800fe7:	fc                   	cld
+  800fe8:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  800fe9:	48 83 ef 01          	sub    $0x1,%rdi
+  800fed:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  800ff1:	fd                   	std
+  800ff2:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  800ff4:	eb f1                	jmp    800fe7 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800ff6:	48 89 f2             	mov    %rsi,%rdx
+  800ff9:	48 09 c2             	or     %rax,%rdx
+  800ffc:	48 09 ca             	or     %rcx,%rdx
+  800fff:	f6 c2 07             	test   $0x7,%dl
+  801002:	75 0c                	jne    801010 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  801004:	48 c1 e9 03          	shr    $0x3,%rcx
+  801008:	48 89 c7             	mov    %rax,%rdi
+  80100b:	fc                   	cld
+  80100c:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  80100f:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  801010:	48 89 c7             	mov    %rax,%rdi
+  801013:	fc                   	cld
+  801014:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  801016:	c3                   	ret
+
+0000000000801017 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  801017:	55                   	push   %rbp
+  801018:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  80101b:	48 b8 b0 0f 80 00 00 	movabs $0x800fb0,%rax
+  801022:	00 00 00 
+  801025:	ff d0                	call   *%rax
+}
+  801027:	5d                   	pop    %rbp
+  801028:	c3                   	ret
+
+0000000000801029 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  801029:	55                   	push   %rbp
+  80102a:	48 89 e5             	mov    %rsp,%rbp
+  80102d:	41 57                	push   %r15
+  80102f:	41 56                	push   %r14
+  801031:	41 55                	push   %r13
+  801033:	41 54                	push   %r12
+  801035:	53                   	push   %rbx
+  801036:	48 83 ec 08          	sub    $0x8,%rsp
+  80103a:	49 89 fe             	mov    %rdi,%r14
+  80103d:	49 89 f7             	mov    %rsi,%r15
+  801040:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  801043:	48 89 f7             	mov    %rsi,%rdi
+  801046:	48 b8 78 0d 80 00 00 	movabs $0x800d78,%rax
+  80104d:	00 00 00 
+  801050:	ff d0                	call   *%rax
+  801052:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  801055:	48 89 de             	mov    %rbx,%rsi
+  801058:	4c 89 f7             	mov    %r14,%rdi
+  80105b:	48 b8 93 0d 80 00 00 	movabs $0x800d93,%rax
+  801062:	00 00 00 
+  801065:	ff d0                	call   *%rax
+  801067:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  80106a:	48 39 c3             	cmp    %rax,%rbx
+  80106d:	74 36                	je     8010a5 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  80106f:	48 89 d8             	mov    %rbx,%rax
+  801072:	4c 29 e8             	sub    %r13,%rax
+  801075:	49 39 c4             	cmp    %rax,%r12
+  801078:	73 31                	jae    8010ab <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  80107a:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  80107f:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  801083:	4c 89 fe             	mov    %r15,%rsi
+  801086:	48 b8 17 10 80 00 00 	movabs $0x801017,%rax
+  80108d:	00 00 00 
+  801090:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  801092:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  801096:	48 83 c4 08          	add    $0x8,%rsp
+  80109a:	5b                   	pop    %rbx
+  80109b:	41 5c                	pop    %r12
+  80109d:	41 5d                	pop    %r13
+  80109f:	41 5e                	pop    %r14
+  8010a1:	41 5f                	pop    %r15
+  8010a3:	5d                   	pop    %rbp
+  8010a4:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  8010a5:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  8010a9:	eb eb                	jmp    801096 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  8010ab:	48 83 eb 01          	sub    $0x1,%rbx
+  8010af:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8010b3:	48 89 da             	mov    %rbx,%rdx
+  8010b6:	4c 89 fe             	mov    %r15,%rsi
+  8010b9:	48 b8 17 10 80 00 00 	movabs $0x801017,%rax
+  8010c0:	00 00 00 
+  8010c3:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  8010c5:	49 01 de             	add    %rbx,%r14
+  8010c8:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  8010cd:	eb c3                	jmp    801092 <strlcat+0x69>
+
+00000000008010cf <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  8010cf:	48 85 d2             	test   %rdx,%rdx
+  8010d2:	74 2d                	je     801101 <memcmp+0x32>
+  8010d4:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  8010d9:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  8010dd:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  8010e2:	44 38 c1             	cmp    %r8b,%cl
+  8010e5:	75 0f                	jne    8010f6 <memcmp+0x27>
+    while (n-- > 0) {
+  8010e7:	48 83 c0 01          	add    $0x1,%rax
+  8010eb:	48 39 c2             	cmp    %rax,%rdx
+  8010ee:	75 e9                	jne    8010d9 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  8010f0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010f5:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  8010f6:	0f b6 c1             	movzbl %cl,%eax
+  8010f9:	45 0f b6 c0          	movzbl %r8b,%r8d
+  8010fd:	44 29 c0             	sub    %r8d,%eax
+  801100:	c3                   	ret
+    return 0;
+  801101:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801106:	c3                   	ret
+
+0000000000801107 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  801107:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  80110b:	48 39 c7             	cmp    %rax,%rdi
+  80110e:	73 0f                	jae    80111f <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  801110:	40 38 37             	cmp    %sil,(%rdi)
+  801113:	74 0e                	je     801123 <memfind+0x1c>
+    for (; src < end; src++) {
+  801115:	48 83 c7 01          	add    $0x1,%rdi
+  801119:	48 39 f8             	cmp    %rdi,%rax
+  80111c:	75 f2                	jne    801110 <memfind+0x9>
+  80111e:	c3                   	ret
+  80111f:	48 89 f8             	mov    %rdi,%rax
+  801122:	c3                   	ret
+  801123:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  801126:	c3                   	ret
+
+0000000000801127 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  801127:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  80112a:	0f b6 37             	movzbl (%rdi),%esi
+  80112d:	40 80 fe 20          	cmp    $0x20,%sil
+  801131:	74 06                	je     801139 <strtol+0x12>
+  801133:	40 80 fe 09          	cmp    $0x9,%sil
+  801137:	75 13                	jne    80114c <strtol+0x25>
+  801139:	48 83 c7 01          	add    $0x1,%rdi
+  80113d:	0f b6 37             	movzbl (%rdi),%esi
+  801140:	40 80 fe 20          	cmp    $0x20,%sil
+  801144:	74 f3                	je     801139 <strtol+0x12>
+  801146:	40 80 fe 09          	cmp    $0x9,%sil
+  80114a:	74 ed                	je     801139 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  80114c:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  80114f:	83 e0 fd             	and    $0xfffffffd,%eax
+  801152:	3c 01                	cmp    $0x1,%al
+  801154:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801158:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  80115e:	75 0f                	jne    80116f <strtol+0x48>
+  801160:	80 3f 30             	cmpb   $0x30,(%rdi)
+  801163:	74 14                	je     801179 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  801165:	85 d2                	test   %edx,%edx
+  801167:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80116c:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  80116f:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  801174:	4c 63 ca             	movslq %edx,%r9
+  801177:	eb 36                	jmp    8011af <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801179:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  80117d:	74 0f                	je     80118e <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  80117f:	85 d2                	test   %edx,%edx
+  801181:	75 ec                	jne    80116f <strtol+0x48>
+        s++;
+  801183:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  801187:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  80118c:	eb e1                	jmp    80116f <strtol+0x48>
+        s += 2;
+  80118e:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  801192:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  801197:	eb d6                	jmp    80116f <strtol+0x48>
+            dig -= '0';
+  801199:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  80119c:	44 0f b6 c1          	movzbl %cl,%r8d
+  8011a0:	41 39 d0             	cmp    %edx,%r8d
+  8011a3:	7d 21                	jge    8011c6 <strtol+0x9f>
+        val = val * base + dig;
+  8011a5:	49 0f af c1          	imul   %r9,%rax
+  8011a9:	0f b6 c9             	movzbl %cl,%ecx
+  8011ac:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  8011af:	48 83 c7 01          	add    $0x1,%rdi
+  8011b3:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  8011b7:	80 f9 39             	cmp    $0x39,%cl
+  8011ba:	76 dd                	jbe    801199 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  8011bc:	80 f9 7b             	cmp    $0x7b,%cl
+  8011bf:	77 05                	ja     8011c6 <strtol+0x9f>
+            dig -= 'a' - 10;
+  8011c1:	83 e9 57             	sub    $0x57,%ecx
+  8011c4:	eb d6                	jmp    80119c <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  8011c6:	4d 85 d2             	test   %r10,%r10
+  8011c9:	74 03                	je     8011ce <strtol+0xa7>
+  8011cb:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  8011ce:	48 89 c2             	mov    %rax,%rdx
+  8011d1:	48 f7 da             	neg    %rdx
+  8011d4:	40 80 fe 2d          	cmp    $0x2d,%sil
+  8011d8:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  8011dc:	c3                   	ret
+
+00000000008011dd <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  8011dd:	55                   	push   %rbp
+  8011de:	48 89 e5             	mov    %rsp,%rbp
+  8011e1:	53                   	push   %rbx
+  8011e2:	48 89 fa             	mov    %rdi,%rdx
+  8011e5:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8011e8:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8011ed:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011f2:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8011f7:	be 00 00 00 00       	mov    $0x0,%esi
+  8011fc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801202:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  801204:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801208:	c9                   	leave
+  801209:	c3                   	ret
+
+000000000080120a <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  80120a:	55                   	push   %rbp
+  80120b:	48 89 e5             	mov    %rsp,%rbp
+  80120e:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80120f:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801214:	ba 00 00 00 00       	mov    $0x0,%edx
+  801219:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80121e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801223:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801228:	be 00 00 00 00       	mov    $0x0,%esi
+  80122d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801233:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  801235:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801239:	c9                   	leave
+  80123a:	c3                   	ret
+
+000000000080123b <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  80123b:	55                   	push   %rbp
+  80123c:	48 89 e5             	mov    %rsp,%rbp
+  80123f:	53                   	push   %rbx
+  801240:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  801244:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801247:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80124c:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801251:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801256:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80125b:	be 00 00 00 00       	mov    $0x0,%esi
+  801260:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801266:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801268:	48 85 c0             	test   %rax,%rax
+  80126b:	7f 06                	jg     801273 <sys_env_destroy+0x38>
+}
+  80126d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801271:	c9                   	leave
+  801272:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801273:	49 89 c0             	mov    %rax,%r8
+  801276:	b9 03 00 00 00       	mov    $0x3,%ecx
+  80127b:	48 ba f0 36 80 00 00 	movabs $0x8036f0,%rdx
+  801282:	00 00 00 
+  801285:	be 26 00 00 00       	mov    $0x26,%esi
+  80128a:	48 bf 0f 37 80 00 00 	movabs $0x80370f,%rdi
+  801291:	00 00 00 
+  801294:	b8 00 00 00 00       	mov    $0x0,%eax
+  801299:	49 b9 41 03 80 00 00 	movabs $0x800341,%r9
+  8012a0:	00 00 00 
+  8012a3:	41 ff d1             	call   *%r9
+
+00000000008012a6 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  8012a6:	55                   	push   %rbp
+  8012a7:	48 89 e5             	mov    %rsp,%rbp
+  8012aa:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8012ab:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8012b0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012b5:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8012ba:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012bf:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012c4:	be 00 00 00 00       	mov    $0x0,%esi
+  8012c9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8012cf:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  8012d1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012d5:	c9                   	leave
+  8012d6:	c3                   	ret
+
+00000000008012d7 <sys_yield>:
+
+void
+sys_yield(void) {
+  8012d7:	55                   	push   %rbp
+  8012d8:	48 89 e5             	mov    %rsp,%rbp
+  8012db:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8012dc:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8012e1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012e6:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8012eb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012f0:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012f5:	be 00 00 00 00       	mov    $0x0,%esi
+  8012fa:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801300:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  801302:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801306:	c9                   	leave
+  801307:	c3                   	ret
+
+0000000000801308 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  801308:	55                   	push   %rbp
+  801309:	48 89 e5             	mov    %rsp,%rbp
+  80130c:	53                   	push   %rbx
+  80130d:	48 89 fa             	mov    %rdi,%rdx
+  801310:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801313:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801318:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  80131f:	00 00 00 
+  801322:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801327:	be 00 00 00 00       	mov    $0x0,%esi
+  80132c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801332:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  801334:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801338:	c9                   	leave
+  801339:	c3                   	ret
+
+000000000080133a <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  80133a:	55                   	push   %rbp
+  80133b:	48 89 e5             	mov    %rsp,%rbp
+  80133e:	53                   	push   %rbx
+  80133f:	49 89 f8             	mov    %rdi,%r8
+  801342:	48 89 d3             	mov    %rdx,%rbx
+  801345:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801348:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80134d:	4c 89 c2             	mov    %r8,%rdx
+  801350:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801353:	be 00 00 00 00       	mov    $0x0,%esi
+  801358:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80135e:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  801360:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801364:	c9                   	leave
+  801365:	c3                   	ret
+
+0000000000801366 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  801366:	55                   	push   %rbp
+  801367:	48 89 e5             	mov    %rsp,%rbp
+  80136a:	53                   	push   %rbx
+  80136b:	48 83 ec 08          	sub    $0x8,%rsp
+  80136f:	89 f8                	mov    %edi,%eax
+  801371:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  801374:	48 63 f9             	movslq %ecx,%rdi
+  801377:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80137a:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80137f:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801382:	be 00 00 00 00       	mov    $0x0,%esi
+  801387:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80138d:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80138f:	48 85 c0             	test   %rax,%rax
+  801392:	7f 06                	jg     80139a <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  801394:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801398:	c9                   	leave
+  801399:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80139a:	49 89 c0             	mov    %rax,%r8
+  80139d:	b9 04 00 00 00       	mov    $0x4,%ecx
+  8013a2:	48 ba f0 36 80 00 00 	movabs $0x8036f0,%rdx
+  8013a9:	00 00 00 
+  8013ac:	be 26 00 00 00       	mov    $0x26,%esi
+  8013b1:	48 bf 0f 37 80 00 00 	movabs $0x80370f,%rdi
+  8013b8:	00 00 00 
+  8013bb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013c0:	49 b9 41 03 80 00 00 	movabs $0x800341,%r9
+  8013c7:	00 00 00 
+  8013ca:	41 ff d1             	call   *%r9
+
+00000000008013cd <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8013cd:	55                   	push   %rbp
+  8013ce:	48 89 e5             	mov    %rsp,%rbp
+  8013d1:	53                   	push   %rbx
+  8013d2:	48 83 ec 08          	sub    $0x8,%rsp
+  8013d6:	89 f8                	mov    %edi,%eax
+  8013d8:	49 89 f2             	mov    %rsi,%r10
+  8013db:	48 89 cf             	mov    %rcx,%rdi
+  8013de:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  8013e1:	48 63 da             	movslq %edx,%rbx
+  8013e4:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8013e7:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8013ec:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013ef:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  8013f2:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8013f4:	48 85 c0             	test   %rax,%rax
+  8013f7:	7f 06                	jg     8013ff <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8013f9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013fd:	c9                   	leave
+  8013fe:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8013ff:	49 89 c0             	mov    %rax,%r8
+  801402:	b9 05 00 00 00       	mov    $0x5,%ecx
+  801407:	48 ba f0 36 80 00 00 	movabs $0x8036f0,%rdx
+  80140e:	00 00 00 
+  801411:	be 26 00 00 00       	mov    $0x26,%esi
+  801416:	48 bf 0f 37 80 00 00 	movabs $0x80370f,%rdi
+  80141d:	00 00 00 
+  801420:	b8 00 00 00 00       	mov    $0x0,%eax
+  801425:	49 b9 41 03 80 00 00 	movabs $0x800341,%r9
+  80142c:	00 00 00 
+  80142f:	41 ff d1             	call   *%r9
+
+0000000000801432 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  801432:	55                   	push   %rbp
+  801433:	48 89 e5             	mov    %rsp,%rbp
+  801436:	53                   	push   %rbx
+  801437:	48 83 ec 08          	sub    $0x8,%rsp
+  80143b:	48 89 f1             	mov    %rsi,%rcx
+  80143e:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  801441:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801444:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801449:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80144e:	be 00 00 00 00       	mov    $0x0,%esi
+  801453:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801459:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80145b:	48 85 c0             	test   %rax,%rax
+  80145e:	7f 06                	jg     801466 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  801460:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801464:	c9                   	leave
+  801465:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801466:	49 89 c0             	mov    %rax,%r8
+  801469:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80146e:	48 ba f0 36 80 00 00 	movabs $0x8036f0,%rdx
+  801475:	00 00 00 
+  801478:	be 26 00 00 00       	mov    $0x26,%esi
+  80147d:	48 bf 0f 37 80 00 00 	movabs $0x80370f,%rdi
+  801484:	00 00 00 
+  801487:	b8 00 00 00 00       	mov    $0x0,%eax
+  80148c:	49 b9 41 03 80 00 00 	movabs $0x800341,%r9
+  801493:	00 00 00 
+  801496:	41 ff d1             	call   *%r9
+
+0000000000801499 <sys_region_batch>:
+
+int
+sys_region_batch(const struct RegionOp *ops, size_t count) {
+  801499:	55                   	push   %rbp
+  80149a:	48 89 e5             	mov    %rsp,%rbp
+  80149d:	53                   	push   %rbx
+  80149e:	48 83 ec 08          	sub    $0x8,%rsp
+  8014a2:	48 89 fa             	mov    %rdi,%rdx
+  8014a5:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8014a8:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8014ad:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014b2:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014b7:	be 00 00 00 00       	mov    $0x0,%esi
+  8014bc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014c2:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8014c4:	48 85 c0             	test   %rax,%rax
+  8014c7:	7f 06                	jg     8014cf <sys_region_batch+0x36>
+        else
+            platform_asan_unpoison(va, ops[i].size);
+    }
+#endif
+    return res;
+}
+  8014c9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014cd:	c9                   	leave
+  8014ce:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8014cf:	49 89 c0             	mov    %rax,%r8
+  8014d2:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  8014d7:	48 ba f0 36 80 00 00 	movabs $0x8036f0,%rdx
+  8014de:	00 00 00 
+  8014e1:	be 26 00 00 00       	mov    $0x26,%esi
+  8014e6:	48 bf 0f 37 80 00 00 	movabs $0x80370f,%rdi
+  8014ed:	00 00 00 
+  8014f0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014f5:	49 b9 41 03 80 00 00 	movabs $0x800341,%r9
+  8014fc:	00 00 00 
+  8014ff:	41 ff d1             	call   *%r9
+
+0000000000801502 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  801502:	55                   	push   %rbp
+  801503:	48 89 e5             	mov    %rsp,%rbp
+  801506:	53                   	push   %rbx
+  801507:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  80150b:	48 63 ce             	movslq %esi,%rcx
+  80150e:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801511:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801516:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80151b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801520:	be 00 00 00 00       	mov    $0x0,%esi
+  801525:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80152b:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80152d:	48 85 c0             	test   %rax,%rax
+  801530:	7f 06                	jg     801538 <sys_env_set_status+0x36>
+}
+  801532:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801536:	c9                   	leave
+  801537:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801538:	49 89 c0             	mov    %rax,%r8
+  80153b:	b9 09 00 00 00       	mov    $0x9,%ecx
+  801540:	48 ba f0 36 80 00 00 	movabs $0x8036f0,%rdx
+  801547:	00 00 00 
+  80154a:	be 26 00 00 00       	mov    $0x26,%esi
+  80154f:	48 bf 0f 37 80 00 00 	movabs $0x80370f,%rdi
+  801556:	00 00 00 
+  801559:	b8 00 00 00 00       	mov    $0x0,%eax
+  80155e:	49 b9 41 03 80 00 00 	movabs $0x800341,%r9
+  801565:	00 00 00 
+  801568:	41 ff d1             	call   *%r9
+
+000000000080156b <sys_env_set_weight>:
+
+int
+sys_env_set_weight(envid_t envid, uint32_t weight) {
+  80156b:	55                   	push   %rbp
+  80156c:	48 89 e5             	mov    %rsp,%rbp
+  80156f:	53                   	push   %rbx
+  801570:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_weight, 1, envid, weight, 0, 0, 0, 0);
+  801574:	89 f1                	mov    %esi,%ecx
+  801576:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801579:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80157e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801583:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801588:	be 00 00 00 00       	mov    $0x0,%esi
+  80158d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801593:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801595:	48 85 c0             	test   %rax,%rax
+  801598:	7f 06                	jg     8015a0 <sys_env_set_weight+0x35>
+}
+  80159a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80159e:	c9                   	leave
+  80159f:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8015a0:	49 89 c0             	mov    %rax,%r8
+  8015a3:	b9 10 00 00 00       	mov    $0x10,%ecx
+  8015a8:	48 ba f0 36 80 00 00 	movabs $0x8036f0,%rdx
+  8015af:	00 00 00 
+  8015b2:	be 26 00 00 00       	mov    $0x26,%esi
+  8015b7:	48 bf 0f 37 80 00 00 	movabs $0x80370f,%rdi
+  8015be:	00 00 00 
+  8015c1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015c6:	49 b9 41 03 80 00 00 	movabs $0x800341,%r9
+  8015cd:	00 00 00 
+  8015d0:	41 ff d1             	call   *%r9
+
+00000000008015d3 <sys_env_set_rt>:
+
+int
+sys_env_set_rt(envid_t envid, uint64_t period, uint64_t budget, uint64_t deadline) {
+  8015d3:	55                   	push   %rbp
+  8015d4:	48 89 e5             	mov    %rsp,%rbp
+  8015d7:	53                   	push   %rbx
+  8015d8:	48 83 ec 08          	sub    $0x8,%rsp
+  8015dc:	89 f8                	mov    %edi,%eax
+  8015de:	48 89 d3             	mov    %rdx,%rbx
+  8015e1:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_env_set_rt, 1, envid, period, budget, deadline, 0, 0);
+  8015e4:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8015e7:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8015ec:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015ef:	be 00 00 00 00       	mov    $0x0,%esi
+  8015f4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015fa:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8015fc:	48 85 c0             	test   %rax,%rax
+  8015ff:	7f 06                	jg     801607 <sys_env_set_rt+0x34>
+}
+  801601:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801605:	c9                   	leave
+  801606:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801607:	49 89 c0             	mov    %rax,%r8
+  80160a:	b9 11 00 00 00       	mov    $0x11,%ecx
+  80160f:	48 ba f0 36 80 00 00 	movabs $0x8036f0,%rdx
+  801616:	00 00 00 
+  801619:	be 26 00 00 00       	mov    $0x26,%esi
+  80161e:	48 bf 0f 37 80 00 00 	movabs $0x80370f,%rdi
+  801625:	00 00 00 
+  801628:	b8 00 00 00 00       	mov    $0x0,%eax
+  80162d:	49 b9 41 03 80 00 00 	movabs $0x800341,%r9
+  801634:	00 00 00 
+  801637:	41 ff d1             	call   *%r9
+
+000000000080163a <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  80163a:	55                   	push   %rbp
+  80163b:	48 89 e5             	mov    %rsp,%rbp
+  80163e:	53                   	push   %rbx
+  80163f:	48 83 ec 08          	sub    $0x8,%rsp
+  801643:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  801646:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801649:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80164e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801653:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801658:	be 00 00 00 00       	mov    $0x0,%esi
+  80165d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801663:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801665:	48 85 c0             	test   %rax,%rax
+  801668:	7f 06                	jg     801670 <sys_env_set_trapframe+0x36>
+}
+  80166a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80166e:	c9                   	leave
+  80166f:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801670:	49 89 c0             	mov    %rax,%r8
+  801673:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  801678:	48 ba f0 36 80 00 00 	movabs $0x8036f0,%rdx
+  80167f:	00 00 00 
+  801682:	be 26 00 00 00       	mov    $0x26,%esi
+  801687:	48 bf 0f 37 80 00 00 	movabs $0x80370f,%rdi
+  80168e:	00 00 00 
+  801691:	b8 00 00 00 00       	mov    $0x0,%eax
+  801696:	49 b9 41 03 80 00 00 	movabs $0x800341,%r9
+  80169d:	00 00 00 
+  8016a0:	41 ff d1             	call   *%r9
+
+00000000008016a3 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  8016a3:	55                   	push   %rbp
+  8016a4:	48 89 e5             	mov    %rsp,%rbp
+  8016a7:	53                   	push   %rbx
+  8016a8:	48 83 ec 08          	sub    $0x8,%rsp
+  8016ac:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  8016af:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8016b2:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8016b7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016bc:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8016c1:	be 00 00 00 00       	mov    $0x0,%esi
+  8016c6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8016cc:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8016ce:	48 85 c0             	test   %rax,%rax
+  8016d1:	7f 06                	jg     8016d9 <sys_env_set_pgfault_upcall+0x36>
+}
+  8016d3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8016d7:	c9                   	leave
+  8016d8:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8016d9:	49 89 c0             	mov    %rax,%r8
+  8016dc:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  8016e1:	48 ba f0 36 80 00 00 	movabs $0x8036f0,%rdx
+  8016e8:	00 00 00 
+  8016eb:	be 26 00 00 00       	mov    $0x26,%esi
+  8016f0:	48 bf 0f 37 80 00 00 	movabs $0x80370f,%rdi
+  8016f7:	00 00 00 
+  8016fa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016ff:	49 b9 41 03 80 00 00 	movabs $0x800341,%r9
+  801706:	00 00 00 
+  801709:	41 ff d1             	call   *%r9
+
+000000000080170c <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  80170c:	55                   	push   %rbp
+  80170d:	48 89 e5             	mov    %rsp,%rbp
+  801710:	53                   	push   %rbx
+  801711:	89 f8                	mov    %edi,%eax
+  801713:	49 89 f1             	mov    %rsi,%r9
+  801716:	48 89 d3             	mov    %rdx,%rbx
+  801719:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  80171c:	49 63 f0             	movslq %r8d,%rsi
+  80171f:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801722:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801727:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80172a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801730:	cd 30                	int    $0x30
+}
+  801732:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801736:	c9                   	leave
+  801737:	c3                   	ret
+
+0000000000801738 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  801738:	55                   	push   %rbp
+  801739:	48 89 e5             	mov    %rsp,%rbp
+  80173c:	53                   	push   %rbx
+  80173d:	48 83 ec 08          	sub    $0x8,%rsp
+  801741:	48 89 fa             	mov    %rdi,%rdx
+  801744:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801747:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80174c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801751:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801756:	be 00 00 00 00       	mov    $0x0,%esi
+  80175b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801761:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801763:	48 85 c0             	test   %rax,%rax
+  801766:	7f 06                	jg     80176e <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801768:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80176c:	c9                   	leave
+  80176d:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80176e:	49 89 c0             	mov    %rax,%r8
+  801771:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  801776:	48 ba f0 36 80 00 00 	movabs $0x8036f0,%rdx
+  80177d:	00 00 00 
+  801780:	be 26 00 00 00       	mov    $0x26,%esi
+  801785:	48 bf 0f 37 80 00 00 	movabs $0x80370f,%rdi
+  80178c:	00 00 00 
+  80178f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801794:	49 b9 41 03 80 00 00 	movabs $0x800341,%r9
+  80179b:	00 00 00 
+  80179e:	41 ff d1             	call   *%r9
+
+00000000008017a1 <fork>:
+ * Hint:
+ *   Use sys_map_region, it can perform address space copying in one call
+ *   Remember to fix "thisenv" in the child process.
+ */
+envid_t
+fork(void) {
+  8017a1:	55                   	push   %rbp
+  8017a2:	48 89 e5             	mov    %rsp,%rbp
+  8017a5:	41 55                	push   %r13
+  8017a7:	41 54                	push   %r12
+  8017a9:	53                   	push   %rbx
+  8017aa:	48 83 ec 08          	sub    $0x8,%rsp
+  8017ae:	b8 08 00 00 00       	mov    $0x8,%eax
+  8017b3:	cd 30                	int    $0x30
+  8017b5:	41 89 c5             	mov    %eax,%r13d
+    // LAB 9: Your code here
+
+    envid_t child_id = sys_exofork();
+    if (child_id < 0) {
+  8017b8:	85 c0                	test   %eax,%eax
+  8017ba:	0f 88 ae 00 00 00    	js     80186e <fork+0xcd>
+  8017c0:	89 c3                	mov    %eax,%ebx
+        return child_id;
+    }
+    if (child_id == 0) {
+  8017c2:	0f 84 b4 00 00 00    	je     80187c <fork+0xdb>
+        thisenv = &envs[ENVX(sys_getenvid())];
+        return 0;
+    }
+    int res = sys_map_region(0, NULL, child_id, NULL, MAX_USER_ADDRESS, PROT_ALL | PROT_LAZY | PROT_COMBINE);
+  8017c8:	41 b9 df 01 00 00    	mov    $0x1df,%r9d
+  8017ce:	49 b8 00 00 00 00 80 	movabs $0x8000000000,%r8
+  8017d5:	00 00 00 
+  8017d8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8017dd:	89 c2                	mov    %eax,%edx
+  8017df:	be 00 00 00 00       	mov    $0x0,%esi
+  8017e4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8017e9:	48 b8 cd 13 80 00 00 	movabs $0x8013cd,%rax
+  8017f0:	00 00 00 
+  8017f3:	ff d0                	call   *%rax
+  8017f5:	41 89 c4             	mov    %eax,%r12d
+    if (res < 0) {
+  8017f8:	85 c0                	test   %eax,%eax
+  8017fa:	78 5d                	js     801859 <fork+0xb8>
+        goto error;
+    }
+    res = sys_env_set_pgfault_upcall(child_id, envs[ENVX(sys_getenvid())].env_pgfault_upcall);
+  8017fc:	48 b8 a6 12 80 00 00 	movabs $0x8012a6,%rax
+  801803:	00 00 00 
+  801806:	ff d0                	call   *%rax
+  801808:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80180d:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+  801814:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  80181b:	00 00 00 
+  80181e:	48 01 d0             	add    %rdx,%rax
+  801821:	48 8b b0 88 01 00 00 	mov    0x188(%rax),%rsi
+  801828:	44 89 ef             	mov    %r13d,%edi
+  80182b:	48 b8 a3 16 80 00 00 	movabs $0x8016a3,%rax
+  801832:	00 00 00 
+  801835:	ff d0                	call   *%rax
+  801837:	41 89 c4             	mov    %eax,%r12d
+    if (res < 0) {
+  80183a:	85 c0                	test   %eax,%eax
+  80183c:	78 1b                	js     801859 <fork+0xb8>
+        goto error;
+    }
+    res = sys_env_set_status(child_id, ENV_RUNNABLE);
+  80183e:	be 02 00 00 00       	mov    $0x2,%esi
+  801843:	44 89 ef             	mov    %r13d,%edi
+  801846:	48 b8 02 15 80 00 00 	movabs $0x801502,%rax
+  80184d:	00 00 00 
+  801850:	ff d0                	call   *%rax
+  801852:	41 89 c4             	mov    %eax,%r12d
+    if (res < 0) {
+  801855:	85 c0                	test   %eax,%eax
+  801857:	79 15                	jns    80186e <fork+0xcd>
+        goto error;
+    }
+    return child_id;
+error:
+    ;
+    int res2 = sys_env_destroy(child_id);
+  801859:	89 df                	mov    %ebx,%edi
+  80185b:	48 b8 3b 12 80 00 00 	movabs $0x80123b,%rax
+  801862:	00 00 00 
+  801865:	ff d0                	call   *%rax
+    if (res2 < 0) {
+  801867:	85 c0                	test   %eax,%eax
+  801869:	78 42                	js     8018ad <fork+0x10c>
+        panic("Fork double fault");
+    }
+    return res;
+  80186b:	45 89 e5             	mov    %r12d,%r13d
+}
+  80186e:	44 89 e8             	mov    %r13d,%eax
+  801871:	48 83 c4 08          	add    $0x8,%rsp
+  801875:	5b                   	pop    %rbx
+  801876:	41 5c                	pop    %r12
+  801878:	41 5d                	pop    %r13
+  80187a:	5d                   	pop    %rbp
+  80187b:	c3                   	ret
+        thisenv = &envs[ENVX(sys_getenvid())];
+  80187c:	48 b8 a6 12 80 00 00 	movabs $0x8012a6,%rax
+  801883:	00 00 00 
+  801886:	ff d0                	call   *%rax
+  801888:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80188d:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+  801894:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  80189b:	00 00 00 
+  80189e:	48 01 d0             	add    %rdx,%rax
+  8018a1:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  8018a8:	00 00 00 
+        return 0;
+  8018ab:	eb c1                	jmp    80186e <fork+0xcd>
+        panic("Fork double fault");
+  8018ad:	48 ba 1d 37 80 00 00 	movabs $0x80371d,%rdx
+  8018b4:	00 00 00 
+  8018b7:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8018bc:	48 bf 2f 37 80 00 00 	movabs $0x80372f,%rdi
+  8018c3:	00 00 00 
+  8018c6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018cb:	48 b9 41 03 80 00 00 	movabs $0x800341,%rcx
+  8018d2:	00 00 00 
+  8018d5:	ff d1                	call   *%rcx
+
+00000000008018d7 <sfork>:
+
+envid_t
+sfork() {
+  8018d7:	55                   	push   %rbp
+  8018d8:	48 89 e5             	mov    %rsp,%rbp
+    panic("sfork() is not implemented");
+  8018db:	48 ba 3a 37 80 00 00 	movabs $0x80373a,%rdx
+  8018e2:	00 00 00 
+  8018e5:	be 36 00 00 00       	mov    $0x36,%esi
+  8018ea:	48 bf 2f 37 80 00 00 	movabs $0x80372f,%rdi
+  8018f1:	00 00 00 
+  8018f4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018f9:	48 b9 41 03 80 00 00 	movabs $0x800341,%rcx
+  801900:	00 00 00 
+  801903:	ff d1                	call   *%rcx
+
+0000000000801905 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801905:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  80190c:	ff ff ff 
+  80190f:	48 01 f8             	add    %rdi,%rax
+  801912:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  801916:	c3                   	ret
+
+0000000000801917 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801917:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  80191e:	ff ff ff 
+  801921:	48 01 f8             	add    %rdi,%rax
+  801924:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  801928:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  80192e:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  801932:	c3                   	ret
+
+0000000000801933 <fd_alloc_from>:
+}
+
+/* Like fd_alloc(), but only considers fds starting from fdnum,
+ * so that several fds can be found before their pages are allocated */
+int
+fd_alloc_from(int fdnum, struct Fd **fd_store) {
+  801933:	55                   	push   %rbp
+  801934:	48 89 e5             	mov    %rsp,%rbp
+  801937:	41 57                	push   %r15
+  801939:	41 56                	push   %r14
+  80193b:	41 55                	push   %r13
+  80193d:	41 54                	push   %r12
+  80193f:	53                   	push   %rbx
+  801940:	48 83 ec 08          	sub    $0x8,%rsp
+  801944:	49 89 f7             	mov    %rsi,%r15
+    for (int i = MAX(fdnum, 0); i < MAXFD; i++) {
+  801947:	85 ff                	test   %edi,%edi
+  801949:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80194f:	44 0f 49 e7          	cmovns %edi,%r12d
+  801953:	83 ff 1f             	cmp    $0x1f,%edi
+  801956:	7f 37                	jg     80198f <fd_alloc_from+0x5c>
+  801958:	49 63 dc             	movslq %r12d,%rbx
+  80195b:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  801962:	48 c1 e3 0c          	shl    $0xc,%rbx
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  801966:	49 be f5 2a 80 00 00 	movabs $0x802af5,%r14
+  80196d:	00 00 00 
+        struct Fd *fd = INDEX2FD(i);
+  801970:	49 89 dd             	mov    %rbx,%r13
+        if (!(get_prot(fd) & PROT_R)) {
+  801973:	48 89 df             	mov    %rbx,%rdi
+  801976:	41 ff d6             	call   *%r14
+  801979:	83 e0 04             	and    $0x4,%eax
+  80197c:	74 1c                	je     80199a <fd_alloc_from+0x67>
+    for (int i = MAX(fdnum, 0); i < MAXFD; i++) {
+  80197e:	41 83 c4 01          	add    $0x1,%r12d
+  801982:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801989:	41 83 fc 1f          	cmp    $0x1f,%r12d
+  80198d:	7e e1                	jle    801970 <fd_alloc_from+0x3d>
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  80198f:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801995:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  80199a:	4d 89 2f             	mov    %r13,(%r15)
+}
+  80199d:	48 83 c4 08          	add    $0x8,%rsp
+  8019a1:	5b                   	pop    %rbx
+  8019a2:	41 5c                	pop    %r12
+  8019a4:	41 5d                	pop    %r13
+  8019a6:	41 5e                	pop    %r14
+  8019a8:	41 5f                	pop    %r15
+  8019aa:	5d                   	pop    %rbp
+  8019ab:	c3                   	ret
+
+00000000008019ac <fd_alloc>:
+fd_alloc(struct Fd **fd_store) {
+  8019ac:	55                   	push   %rbp
+  8019ad:	48 89 e5             	mov    %rsp,%rbp
+  8019b0:	48 89 fe             	mov    %rdi,%rsi
+    return fd_alloc_from(0, fd_store);
+  8019b3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8019b8:	48 b8 33 19 80 00 00 	movabs $0x801933,%rax
+  8019bf:	00 00 00 
+  8019c2:	ff d0                	call   *%rax
+}
+  8019c4:	5d                   	pop    %rbp
+  8019c5:	c3                   	ret
+
+00000000008019c6 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  8019c6:	83 ff 1f             	cmp    $0x1f,%edi
+  8019c9:	77 39                	ja     801a04 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  8019cb:	55                   	push   %rbp
+  8019cc:	48 89 e5             	mov    %rsp,%rbp
+  8019cf:	41 54                	push   %r12
+  8019d1:	53                   	push   %rbx
+  8019d2:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  8019d5:	48 63 df             	movslq %edi,%rbx
+  8019d8:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  8019df:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  8019e3:	48 89 df             	mov    %rbx,%rdi
+  8019e6:	48 b8 f5 2a 80 00 00 	movabs $0x802af5,%rax
+  8019ed:	00 00 00 
+  8019f0:	ff d0                	call   *%rax
+  8019f2:	a8 04                	test   $0x4,%al
+  8019f4:	74 14                	je     801a0a <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  8019f6:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  8019fa:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8019ff:	5b                   	pop    %rbx
+  801a00:	41 5c                	pop    %r12
+  801a02:	5d                   	pop    %rbp
+  801a03:	c3                   	ret
+        return -E_INVAL;
+  801a04:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801a09:	c3                   	ret
+        return -E_INVAL;
+  801a0a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801a0f:	eb ee                	jmp    8019ff <fd_lookup+0x39>
+
+0000000000801a11 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  801a11:	55                   	push   %rbp
+  801a12:	48 89 e5             	mov    %rsp,%rbp
+  801a15:	41 54                	push   %r12
+  801a17:	53                   	push   %rbx
+  801a18:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  801a1b:	48 b8 e0 37 80 00 00 	movabs $0x8037e0,%rax
+  801a22:	00 00 00 
+  801a25:	48 bb 20 40 80 00 00 	movabs $0x804020,%rbx
+  801a2c:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  801a2f:	39 3b                	cmp    %edi,(%rbx)
+  801a31:	74 47                	je     801a7a <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  801a33:	48 83 c0 08          	add    $0x8,%rax
+  801a37:	48 8b 18             	mov    (%rax),%rbx
+  801a3a:	48 85 db             	test   %rbx,%rbx
+  801a3d:	75 f0                	jne    801a2f <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801a3f:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801a46:	00 00 00 
+  801a49:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+  801a4f:	89 fa                	mov    %edi,%edx
+  801a51:	48 bf 58 37 80 00 00 	movabs $0x803758,%rdi
+  801a58:	00 00 00 
+  801a5b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a60:	48 b9 91 04 80 00 00 	movabs $0x800491,%rcx
+  801a67:	00 00 00 
+  801a6a:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  801a6c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  801a71:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  801a75:	5b                   	pop    %rbx
+  801a76:	41 5c                	pop    %r12
+  801a78:	5d                   	pop    %rbp
+  801a79:	c3                   	ret
+            return 0;
+  801a7a:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a7f:	eb f0                	jmp    801a71 <dev_lookup+0x60>
+
+0000000000801a81 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  801a81:	55                   	push   %rbp
+  801a82:	48 89 e5             	mov    %rsp,%rbp
+  801a85:	41 55                	push   %r13
+  801a87:	41 54                	push   %r12
+  801a89:	53                   	push   %rbx
+  801a8a:	48 83 ec 18          	sub    $0x18,%rsp
+  801a8e:	48 89 fb             	mov    %rdi,%rbx
+  801a91:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801a94:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  801a9b:	ff ff ff 
+  801a9e:	48 01 df             	add    %rbx,%rdi
+  801aa1:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  801aa5:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801aa9:	48 b8 c6 19 80 00 00 	movabs $0x8019c6,%rax
+  801ab0:	00 00 00 
+  801ab3:	ff d0                	call   *%rax
+  801ab5:	41 89 c5             	mov    %eax,%r13d
+  801ab8:	85 c0                	test   %eax,%eax
+  801aba:	78 06                	js     801ac2 <fd_close+0x41>
+  801abc:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  801ac0:	74 1a                	je     801adc <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  801ac2:	45 84 e4             	test   %r12b,%r12b
+  801ac5:	b8 00 00 00 00       	mov    $0x0,%eax
+  801aca:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  801ace:	44 89 e8             	mov    %r13d,%eax
+  801ad1:	48 83 c4 18          	add    $0x18,%rsp
+  801ad5:	5b                   	pop    %rbx
+  801ad6:	41 5c                	pop    %r12
+  801ad8:	41 5d                	pop    %r13
+  801ada:	5d                   	pop    %rbp
+  801adb:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801adc:	8b 3b                	mov    (%rbx),%edi
+  801ade:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801ae2:	48 b8 11 1a 80 00 00 	movabs $0x801a11,%rax
+  801ae9:	00 00 00 
+  801aec:	ff d0                	call   *%rax
+  801aee:	41 89 c5             	mov    %eax,%r13d
+  801af1:	85 c0                	test   %eax,%eax
+  801af3:	78 1b                	js     801b10 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  801af5:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801af9:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801afd:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801b03:	48 85 c0             	test   %rax,%rax
+  801b06:	74 08                	je     801b10 <fd_close+0x8f>
+  801b08:	48 89 df             	mov    %rbx,%rdi
+  801b0b:	ff d0                	call   *%rax
+  801b0d:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801b10:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801b15:	48 89 de             	mov    %rbx,%rsi
+  801b18:	bf 00 00 00 00       	mov    $0x0,%edi
+  801b1d:	48 b8 32 14 80 00 00 	movabs $0x801432,%rax
+  801b24:	00 00 00 
+  801b27:	ff d0                	call   *%rax
+    return res;
+  801b29:	eb a3                	jmp    801ace <fd_close+0x4d>
+
+0000000000801b2b <close>:
+
+int
+close(int fdnum) {
+  801b2b:	55                   	push   %rbp
+  801b2c:	48 89 e5             	mov    %rsp,%rbp
+  801b2f:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  801b33:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801b37:	48 b8 c6 19 80 00 00 	movabs $0x8019c6,%rax
+  801b3e:	00 00 00 
+  801b41:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801b43:	85 c0                	test   %eax,%eax
+  801b45:	78 15                	js     801b5c <close+0x31>
+
+    return fd_close(fd, 1);
+  801b47:	be 01 00 00 00       	mov    $0x1,%esi
+  801b4c:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801b50:	48 b8 81 1a 80 00 00 	movabs $0x801a81,%rax
+  801b57:	00 00 00 
+  801b5a:	ff d0                	call   *%rax
+}
+  801b5c:	c9                   	leave
+  801b5d:	c3                   	ret
+
+0000000000801b5e <close_all>:
+
+void
+close_all(void) {
+  801b5e:	55                   	push   %rbp
+  801b5f:	48 89 e5             	mov    %rsp,%rbp
+  801b62:	41 54                	push   %r12
+  801b64:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  801b65:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b6a:	49 bc 2b 1b 80 00 00 	movabs $0x801b2b,%r12
+  801b71:	00 00 00 
+  801b74:	89 df                	mov    %ebx,%edi
+  801b76:	41 ff d4             	call   *%r12
+  801b79:	83 c3 01             	add    $0x1,%ebx
+  801b7c:	83 fb 20             	cmp    $0x20,%ebx
+  801b7f:	75 f3                	jne    801b74 <close_all+0x16>
+}
+  801b81:	5b                   	pop    %rbx
+  801b82:	41 5c                	pop    %r12
+  801b84:	5d                   	pop    %rbp
+  801b85:	c3                   	ret
+
+0000000000801b86 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  801b86:	55                   	push   %rbp
+  801b87:	48 89 e5             	mov    %rsp,%rbp
+  801b8a:	41 57                	push   %r15
+  801b8c:	41 56                	push   %r14
+  801b8e:	41 55                	push   %r13
+  801b90:	41 54                	push   %r12
+  801b92:	53                   	push   %rbx
+  801b93:	48 83 ec 18          	sub    $0x18,%rsp
+  801b97:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  801b9a:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801b9e:	48 b8 c6 19 80 00 00 	movabs $0x8019c6,%rax
+  801ba5:	00 00 00 
+  801ba8:	ff d0                	call   *%rax
+  801baa:	89 c3                	mov    %eax,%ebx
+  801bac:	85 c0                	test   %eax,%eax
+  801bae:	0f 88 b8 00 00 00    	js     801c6c <dup+0xe6>
+    close(newfdnum);
+  801bb4:	44 89 e7             	mov    %r12d,%edi
+  801bb7:	48 b8 2b 1b 80 00 00 	movabs $0x801b2b,%rax
+  801bbe:	00 00 00 
+  801bc1:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  801bc3:	4d 63 ec             	movslq %r12d,%r13
+  801bc6:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  801bcd:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  801bd1:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  801bd5:	4c 89 ff             	mov    %r15,%rdi
+  801bd8:	49 be 17 19 80 00 00 	movabs $0x801917,%r14
+  801bdf:	00 00 00 
+  801be2:	41 ff d6             	call   *%r14
+  801be5:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  801be8:	4c 89 ef             	mov    %r13,%rdi
+  801beb:	41 ff d6             	call   *%r14
+  801bee:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  801bf1:	48 89 df             	mov    %rbx,%rdi
+  801bf4:	48 b8 f5 2a 80 00 00 	movabs $0x802af5,%rax
+  801bfb:	00 00 00 
+  801bfe:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  801c00:	a8 04                	test   $0x4,%al
+  801c02:	74 2b                	je     801c2f <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  801c04:	41 89 c1             	mov    %eax,%r9d
+  801c07:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801c0d:	4c 89 f1             	mov    %r14,%rcx
+  801c10:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c15:	48 89 de             	mov    %rbx,%rsi
+  801c18:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c1d:	48 b8 cd 13 80 00 00 	movabs $0x8013cd,%rax
+  801c24:	00 00 00 
+  801c27:	ff d0                	call   *%rax
+  801c29:	89 c3                	mov    %eax,%ebx
+  801c2b:	85 c0                	test   %eax,%eax
+  801c2d:	78 4e                	js     801c7d <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  801c2f:	4c 89 ff             	mov    %r15,%rdi
+  801c32:	48 b8 f5 2a 80 00 00 	movabs $0x802af5,%rax
+  801c39:	00 00 00 
+  801c3c:	ff d0                	call   *%rax
+  801c3e:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801c41:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801c47:	4c 89 e9             	mov    %r13,%rcx
+  801c4a:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c4f:	4c 89 fe             	mov    %r15,%rsi
+  801c52:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c57:	48 b8 cd 13 80 00 00 	movabs $0x8013cd,%rax
+  801c5e:	00 00 00 
+  801c61:	ff d0                	call   *%rax
+  801c63:	89 c3                	mov    %eax,%ebx
+  801c65:	85 c0                	test   %eax,%eax
+  801c67:	78 14                	js     801c7d <dup+0xf7>
+
+    return newfdnum;
+  801c69:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  801c6c:	89 d8                	mov    %ebx,%eax
+  801c6e:	48 83 c4 18          	add    $0x18,%rsp
+  801c72:	5b                   	pop    %rbx
+  801c73:	41 5c                	pop    %r12
+  801c75:	41 5d                	pop    %r13
+  801c77:	41 5e                	pop    %r14
+  801c79:	41 5f                	pop    %r15
+  801c7b:	5d                   	pop    %rbp
+  801c7c:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  801c7d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801c82:	4c 89 ee             	mov    %r13,%rsi
+  801c85:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c8a:	49 bc 32 14 80 00 00 	movabs $0x801432,%r12
+  801c91:	00 00 00 
+  801c94:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  801c97:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801c9c:	4c 89 f6             	mov    %r14,%rsi
+  801c9f:	bf 00 00 00 00       	mov    $0x0,%edi
+  801ca4:	41 ff d4             	call   *%r12
+    return res;
+  801ca7:	eb c3                	jmp    801c6c <dup+0xe6>
+
+0000000000801ca9 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  801ca9:	55                   	push   %rbp
+  801caa:	48 89 e5             	mov    %rsp,%rbp
+  801cad:	41 56                	push   %r14
+  801caf:	41 55                	push   %r13
+  801cb1:	41 54                	push   %r12
+  801cb3:	53                   	push   %rbx
+  801cb4:	48 83 ec 10          	sub    $0x10,%rsp
+  801cb8:	89 fb                	mov    %edi,%ebx
+  801cba:	49 89 f4             	mov    %rsi,%r12
+  801cbd:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801cc0:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801cc4:	48 b8 c6 19 80 00 00 	movabs $0x8019c6,%rax
+  801ccb:	00 00 00 
+  801cce:	ff d0                	call   *%rax
+  801cd0:	85 c0                	test   %eax,%eax
+  801cd2:	78 4c                	js     801d20 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801cd4:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801cd8:	41 8b 3e             	mov    (%r14),%edi
+  801cdb:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801cdf:	48 b8 11 1a 80 00 00 	movabs $0x801a11,%rax
+  801ce6:	00 00 00 
+  801ce9:	ff d0                	call   *%rax
+  801ceb:	85 c0                	test   %eax,%eax
+  801ced:	78 35                	js     801d24 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801cef:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801cf3:	83 e0 03             	and    $0x3,%eax
+  801cf6:	83 f8 01             	cmp    $0x1,%eax
+  801cf9:	74 2d                	je     801d28 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801cfb:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801cff:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801d03:	48 85 c0             	test   %rax,%rax
+  801d06:	74 56                	je     801d5e <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  801d08:	4c 89 ea             	mov    %r13,%rdx
+  801d0b:	4c 89 e6             	mov    %r12,%rsi
+  801d0e:	4c 89 f7             	mov    %r14,%rdi
+  801d11:	ff d0                	call   *%rax
+}
+  801d13:	48 83 c4 10          	add    $0x10,%rsp
+  801d17:	5b                   	pop    %rbx
+  801d18:	41 5c                	pop    %r12
+  801d1a:	41 5d                	pop    %r13
+  801d1c:	41 5e                	pop    %r14
+  801d1e:	5d                   	pop    %rbp
+  801d1f:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801d20:	48 98                	cltq
+  801d22:	eb ef                	jmp    801d13 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801d24:	48 98                	cltq
+  801d26:	eb eb                	jmp    801d13 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801d28:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801d2f:	00 00 00 
+  801d32:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+  801d38:	89 da                	mov    %ebx,%edx
+  801d3a:	48 bf 99 37 80 00 00 	movabs $0x803799,%rdi
+  801d41:	00 00 00 
+  801d44:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d49:	48 b9 91 04 80 00 00 	movabs $0x800491,%rcx
+  801d50:	00 00 00 
+  801d53:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801d55:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801d5c:	eb b5                	jmp    801d13 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801d5e:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801d65:	eb ac                	jmp    801d13 <read+0x6a>
+
+0000000000801d67 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801d67:	55                   	push   %rbp
+  801d68:	48 89 e5             	mov    %rsp,%rbp
+  801d6b:	41 57                	push   %r15
+  801d6d:	41 56                	push   %r14
+  801d6f:	41 55                	push   %r13
+  801d71:	41 54                	push   %r12
+  801d73:	53                   	push   %rbx
+  801d74:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  801d78:	48 85 d2             	test   %rdx,%rdx
+  801d7b:	74 54                	je     801dd1 <readn+0x6a>
+  801d7d:	41 89 fd             	mov    %edi,%r13d
+  801d80:	49 89 f6             	mov    %rsi,%r14
+  801d83:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  801d86:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  801d8b:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  801d90:	49 bf a9 1c 80 00 00 	movabs $0x801ca9,%r15
+  801d97:	00 00 00 
+  801d9a:	4c 89 e2             	mov    %r12,%rdx
+  801d9d:	48 29 f2             	sub    %rsi,%rdx
+  801da0:	4c 01 f6             	add    %r14,%rsi
+  801da3:	44 89 ef             	mov    %r13d,%edi
+  801da6:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  801da9:	85 c0                	test   %eax,%eax
+  801dab:	78 20                	js     801dcd <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  801dad:	01 c3                	add    %eax,%ebx
+  801daf:	85 c0                	test   %eax,%eax
+  801db1:	74 08                	je     801dbb <readn+0x54>
+  801db3:	48 63 f3             	movslq %ebx,%rsi
+  801db6:	4c 39 e6             	cmp    %r12,%rsi
+  801db9:	72 df                	jb     801d9a <readn+0x33>
+    }
+    return res;
+  801dbb:	48 63 c3             	movslq %ebx,%rax
+}
+  801dbe:	48 83 c4 08          	add    $0x8,%rsp
+  801dc2:	5b                   	pop    %rbx
+  801dc3:	41 5c                	pop    %r12
+  801dc5:	41 5d                	pop    %r13
+  801dc7:	41 5e                	pop    %r14
+  801dc9:	41 5f                	pop    %r15
+  801dcb:	5d                   	pop    %rbp
+  801dcc:	c3                   	ret
+        if (inc < 0) return inc;
+  801dcd:	48 98                	cltq
+  801dcf:	eb ed                	jmp    801dbe <readn+0x57>
+    int inc = 1, res = 0;
+  801dd1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801dd6:	eb e3                	jmp    801dbb <readn+0x54>
+
+0000000000801dd8 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  801dd8:	55                   	push   %rbp
+  801dd9:	48 89 e5             	mov    %rsp,%rbp
+  801ddc:	41 56                	push   %r14
+  801dde:	41 55                	push   %r13
+  801de0:	41 54                	push   %r12
+  801de2:	53                   	push   %rbx
+  801de3:	48 83 ec 10          	sub    $0x10,%rsp
+  801de7:	89 fb                	mov    %edi,%ebx
+  801de9:	49 89 f4             	mov    %rsi,%r12
+  801dec:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801def:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801df3:	48 b8 c6 19 80 00 00 	movabs $0x8019c6,%rax
+  801dfa:	00 00 00 
+  801dfd:	ff d0                	call   *%rax
+  801dff:	85 c0                	test   %eax,%eax
+  801e01:	78 47                	js     801e4a <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801e03:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801e07:	41 8b 3e             	mov    (%r14),%edi
+  801e0a:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801e0e:	48 b8 11 1a 80 00 00 	movabs $0x801a11,%rax
+  801e15:	00 00 00 
+  801e18:	ff d0                	call   *%rax
+  801e1a:	85 c0                	test   %eax,%eax
+  801e1c:	78 30                	js     801e4e <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801e1e:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  801e23:	74 2d                	je     801e52 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801e25:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801e29:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801e2d:	48 85 c0             	test   %rax,%rax
+  801e30:	74 56                	je     801e88 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  801e32:	4c 89 ea             	mov    %r13,%rdx
+  801e35:	4c 89 e6             	mov    %r12,%rsi
+  801e38:	4c 89 f7             	mov    %r14,%rdi
+  801e3b:	ff d0                	call   *%rax
+}
+  801e3d:	48 83 c4 10          	add    $0x10,%rsp
+  801e41:	5b                   	pop    %rbx
+  801e42:	41 5c                	pop    %r12
+  801e44:	41 5d                	pop    %r13
+  801e46:	41 5e                	pop    %r14
+  801e48:	5d                   	pop    %rbp
+  801e49:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801e4a:	48 98                	cltq
+  801e4c:	eb ef                	jmp    801e3d <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801e4e:	48 98                	cltq
+  801e50:	eb eb                	jmp    801e3d <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801e52:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801e59:	00 00 00 
+  801e5c:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+  801e62:	89 da                	mov    %ebx,%edx
+  801e64:	48 bf b5 37 80 00 00 	movabs $0x8037b5,%rdi
+  801e6b:	00 00 00 
+  801e6e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e73:	48 b9 91 04 80 00 00 	movabs $0x800491,%rcx
+  801e7a:	00 00 00 
+  801e7d:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801e7f:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801e86:	eb b5                	jmp    801e3d <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801e88:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801e8f:	eb ac                	jmp    801e3d <write+0x65>
+
+0000000000801e91 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  801e91:	55                   	push   %rbp
+  801e92:	48 89 e5             	mov    %rsp,%rbp
+  801e95:	53                   	push   %rbx
+  801e96:	48 83 ec 18          	sub    $0x18,%rsp
+  801e9a:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801e9c:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801ea0:	48 b8 c6 19 80 00 00 	movabs $0x8019c6,%rax
+  801ea7:	00 00 00 
+  801eaa:	ff d0                	call   *%rax
+  801eac:	85 c0                	test   %eax,%eax
+  801eae:	78 0c                	js     801ebc <seek+0x2b>
+
+    fd->fd_offset = offset;
+  801eb0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801eb4:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  801eb7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801ebc:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801ec0:	c9                   	leave
+  801ec1:	c3                   	ret
+
+0000000000801ec2 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  801ec2:	55                   	push   %rbp
+  801ec3:	48 89 e5             	mov    %rsp,%rbp
+  801ec6:	41 55                	push   %r13
+  801ec8:	41 54                	push   %r12
+  801eca:	53                   	push   %rbx
+  801ecb:	48 83 ec 18          	sub    $0x18,%rsp
+  801ecf:	89 fb                	mov    %edi,%ebx
+  801ed1:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801ed4:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801ed8:	48 b8 c6 19 80 00 00 	movabs $0x8019c6,%rax
+  801edf:	00 00 00 
+  801ee2:	ff d0                	call   *%rax
+  801ee4:	85 c0                	test   %eax,%eax
+  801ee6:	78 38                	js     801f20 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801ee8:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  801eec:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  801ef0:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801ef4:	48 b8 11 1a 80 00 00 	movabs $0x801a11,%rax
+  801efb:	00 00 00 
+  801efe:	ff d0                	call   *%rax
+  801f00:	85 c0                	test   %eax,%eax
+  801f02:	78 1c                	js     801f20 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801f04:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  801f09:	74 20                	je     801f2b <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801f0b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801f0f:	48 8b 40 30          	mov    0x30(%rax),%rax
+  801f13:	48 85 c0             	test   %rax,%rax
+  801f16:	74 47                	je     801f5f <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  801f18:	44 89 e6             	mov    %r12d,%esi
+  801f1b:	4c 89 ef             	mov    %r13,%rdi
+  801f1e:	ff d0                	call   *%rax
+}
+  801f20:	48 83 c4 18          	add    $0x18,%rsp
+  801f24:	5b                   	pop    %rbx
+  801f25:	41 5c                	pop    %r12
+  801f27:	41 5d                	pop    %r13
+  801f29:	5d                   	pop    %rbp
+  801f2a:	c3                   	ret
+                thisenv->env_id, fdnum);
+  801f2b:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801f32:	00 00 00 
+  801f35:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801f3b:	89 da                	mov    %ebx,%edx
+  801f3d:	48 bf 78 37 80 00 00 	movabs $0x803778,%rdi
+  801f44:	00 00 00 
+  801f47:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f4c:	48 b9 91 04 80 00 00 	movabs $0x800491,%rcx
+  801f53:	00 00 00 
+  801f56:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801f58:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801f5d:	eb c1                	jmp    801f20 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801f5f:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801f64:	eb ba                	jmp    801f20 <ftruncate+0x5e>
+
+0000000000801f66 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  801f66:	55                   	push   %rbp
+  801f67:	48 89 e5             	mov    %rsp,%rbp
+  801f6a:	41 54                	push   %r12
+  801f6c:	53                   	push   %rbx
+  801f6d:	48 83 ec 10          	sub    $0x10,%rsp
+  801f71:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801f74:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801f78:	48 b8 c6 19 80 00 00 	movabs $0x8019c6,%rax
+  801f7f:	00 00 00 
+  801f82:	ff d0                	call   *%rax
+  801f84:	85 c0                	test   %eax,%eax
+  801f86:	78 4e                	js     801fd6 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801f88:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801f8c:	41 8b 3c 24          	mov    (%r12),%edi
+  801f90:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801f94:	48 b8 11 1a 80 00 00 	movabs $0x801a11,%rax
+  801f9b:	00 00 00 
+  801f9e:	ff d0                	call   *%rax
+  801fa0:	85 c0                	test   %eax,%eax
+  801fa2:	78 32                	js     801fd6 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801fa4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801fa8:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  801fad:	74 30                	je     801fdf <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  801faf:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  801fb2:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  801fb9:	00 00 00 
+    stat->st_isdir = 0;
+  801fbc:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  801fc3:	00 00 00 
+    stat->st_dev = dev;
+  801fc6:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  801fcd:	48 89 de             	mov    %rbx,%rsi
+  801fd0:	4c 89 e7             	mov    %r12,%rdi
+  801fd3:	ff 50 28             	call   *0x28(%rax)
+}
+  801fd6:	48 83 c4 10          	add    $0x10,%rsp
+  801fda:	5b                   	pop    %rbx
+  801fdb:	41 5c                	pop    %r12
+  801fdd:	5d                   	pop    %rbp
+  801fde:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801fdf:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801fe4:	eb f0                	jmp    801fd6 <fstat+0x70>
+
+0000000000801fe6 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  801fe6:	55                   	push   %rbp
+  801fe7:	48 89 e5             	mov    %rsp,%rbp
+  801fea:	41 54                	push   %r12
+  801fec:	53                   	push   %rbx
+  801fed:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  801ff0:	be 00 00 00 00       	mov    $0x0,%esi
+  801ff5:	48 b8 c9 23 80 00 00 	movabs $0x8023c9,%rax
+  801ffc:	00 00 00 
+  801fff:	ff d0                	call   *%rax
+  802001:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  802003:	85 c0                	test   %eax,%eax
+  802005:	78 25                	js     80202c <stat+0x46>
+
+    int res = fstat(fd, stat);
+  802007:	4c 89 e6             	mov    %r12,%rsi
+  80200a:	89 c7                	mov    %eax,%edi
+  80200c:	48 b8 66 1f 80 00 00 	movabs $0x801f66,%rax
+  802013:	00 00 00 
+  802016:	ff d0                	call   *%rax
+  802018:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  80201b:	89 df                	mov    %ebx,%edi
+  80201d:	48 b8 2b 1b 80 00 00 	movabs $0x801b2b,%rax
+  802024:	00 00 00 
+  802027:	ff d0                	call   *%rax
+
+    return res;
+  802029:	44 89 e3             	mov    %r12d,%ebx
+}
+  80202c:	89 d8                	mov    %ebx,%eax
+  80202e:	5b                   	pop    %rbx
+  80202f:	41 5c                	pop    %r12
+  802031:	5d                   	pop    %rbp
+  802032:	c3                   	ret
+
+0000000000802033 <fsipc>:
+ * response may be written back to fsipcbuf.
+ * type: request code, passed as the simple integer IPC value.
+ * dstva: virtual address at which to receive reply page, 0 if none.
+ * Returns result from the file server. */
+static int
+fsipc(unsigned type, void *dstva) {
+  802033:	55                   	push   %rbp
+  802034:	48 89 e5             	mov    %rsp,%rbp
+  802037:	41 54                	push   %r12
+  802039:	53                   	push   %rbx
+  80203a:	48 83 ec 10          	sub    $0x10,%rsp
+  80203e:	41 89 fc             	mov    %edi,%r12d
+  802041:	48 89 f3             	mov    %rsi,%rbx
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802044:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  80204b:	00 00 00 
+  80204e:	83 38 00             	cmpl   $0x0,(%rax)
+  802051:	74 5e                	je     8020b1 <fsipc+0x7e>
+    if (debug) {
+        cprintf("[%08x] fsipc %d %08x\n",
+                thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+    }
+
+    ipc_send(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW);
+  802053:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802059:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80205e:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  802065:	00 00 00 
+  802068:	44 89 e6             	mov    %r12d,%esi
+  80206b:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  802072:	00 00 00 
+  802075:	8b 38                	mov    (%rax),%edi
+  802077:	48 b8 e9 2f 80 00 00 	movabs $0x802fe9,%rax
+  80207e:	00 00 00 
+  802081:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  802083:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  80208a:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  80208b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802090:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  802094:	48 89 de             	mov    %rbx,%rsi
+  802097:	bf 00 00 00 00       	mov    $0x0,%edi
+  80209c:	48 b8 14 2f 80 00 00 	movabs $0x802f14,%rax
+  8020a3:	00 00 00 
+  8020a6:	ff d0                	call   *%rax
+}
+  8020a8:	48 83 c4 10          	add    $0x10,%rsp
+  8020ac:	5b                   	pop    %rbx
+  8020ad:	41 5c                	pop    %r12
+  8020af:	5d                   	pop    %rbp
+  8020b0:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8020b1:	bf 03 00 00 00       	mov    $0x3,%edi
+  8020b6:	48 b8 8c 30 80 00 00 	movabs $0x80308c,%rax
+  8020bd:	00 00 00 
+  8020c0:	ff d0                	call   *%rax
+  8020c2:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  8020c9:	00 00 
+  8020cb:	eb 86                	jmp    802053 <fsipc+0x20>
+
+00000000008020cd <devfile_trunc>:
+    return 0;
+}
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  8020cd:	55                   	push   %rbp
+  8020ce:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  8020d1:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  8020d8:	00 00 00 
+  8020db:	8b 57 0c             	mov    0xc(%rdi),%edx
+  8020de:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  8020e0:	89 70 04             	mov    %esi,0x4(%rax)
+
+    return fsipc(FSREQ_SET_SIZE, NULL);
+  8020e3:	be 00 00 00 00       	mov    $0x0,%esi
+  8020e8:	bf 02 00 00 00       	mov    $0x2,%edi
+  8020ed:	48 b8 33 20 80 00 00 	movabs $0x802033,%rax
+  8020f4:	00 00 00 
+  8020f7:	ff d0                	call   *%rax
+}
+  8020f9:	5d                   	pop    %rbp
+  8020fa:	c3                   	ret
+
+00000000008020fb <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  8020fb:	55                   	push   %rbp
+  8020fc:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  8020ff:	8b 47 0c             	mov    0xc(%rdi),%eax
+  802102:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  802109:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  80210b:	be 00 00 00 00       	mov    $0x0,%esi
+  802110:	bf 06 00 00 00       	mov    $0x6,%edi
+  802115:	48 b8 33 20 80 00 00 	movabs $0x802033,%rax
+  80211c:	00 00 00 
+  80211f:	ff d0                	call   *%rax
+}
+  802121:	5d                   	pop    %rbp
+  802122:	c3                   	ret
+
+0000000000802123 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  802123:	55                   	push   %rbp
+  802124:	48 89 e5             	mov    %rsp,%rbp
+  802127:	41 54                	push   %r12
+  802129:	53                   	push   %rbx
+  80212a:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  80212d:	8b 47 0c             	mov    0xc(%rdi),%eax
+  802130:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  802137:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  802139:	be 00 00 00 00       	mov    $0x0,%esi
+  80213e:	bf 05 00 00 00       	mov    $0x5,%edi
+  802143:	48 b8 33 20 80 00 00 	movabs $0x802033,%rax
+  80214a:	00 00 00 
+  80214d:	ff d0                	call   *%rax
+    if (res < 0) {
+  80214f:	85 c0                	test   %eax,%eax
+  802151:	78 3d                	js     802190 <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802153:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  80215a:	00 00 00 
+  80215d:	4c 89 e6             	mov    %r12,%rsi
+  802160:	48 89 df             	mov    %rbx,%rdi
+  802163:	48 b8 b6 0d 80 00 00 	movabs $0x800db6,%rax
+  80216a:	00 00 00 
+  80216d:	ff d0                	call   *%rax
+    st->st_size  = fsipcbuf.statRet.ret_size;
+  80216f:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  802176:	00 
+  802177:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  80217d:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  802184:	00 
+  802185:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  80218b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802190:	5b                   	pop    %rbx
+  802191:	41 5c                	pop    %r12
+  802193:	5d                   	pop    %rbp
+  802194:	c3                   	ret
+
+0000000000802195 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  802195:	55                   	push   %rbp
+  802196:	48 89 e5             	mov    %rsp,%rbp
+  802199:	41 57                	push   %r15
+  80219b:	41 56                	push   %r14
+  80219d:	41 55                	push   %r13
+  80219f:	41 54                	push   %r12
+  8021a1:	53                   	push   %rbx
+  8021a2:	48 83 ec 18          	sub    $0x18,%rsp
+  8021a6:	49 89 fe             	mov    %rdi,%r14
+  8021a9:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+  8021ad:	48 89 d3             	mov    %rdx,%rbx
+    while (n > sizeof(fsipcbuf.write.req_buf))
+  8021b0:	48 81 fa f0 0f 00 00 	cmp    $0xff0,%rdx
+  8021b7:	0f 86 e4 00 00 00    	jbe    8022a1 <devfile_write+0x10c>
+  8021bd:	49 89 f4             	mov    %rsi,%r12
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8021c0:	49 bd 00 60 80 00 00 	movabs $0x806000,%r13
+  8021c7:	00 00 00 
+        memcpy(fsipcbuf.write.req_buf, buf, sizeof(fsipcbuf.write.req_buf));
+  8021ca:	49 bf 17 10 80 00 00 	movabs $0x801017,%r15
+  8021d1:	00 00 00 
+  8021d4:	eb 03                	jmp    8021d9 <devfile_write+0x44>
+        buf += sizeof(fsipcbuf.write.req_buf);
+  8021d6:	49 89 f4             	mov    %rsi,%r12
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8021d9:	41 8b 46 0c          	mov    0xc(%r14),%eax
+  8021dd:	41 89 45 00          	mov    %eax,0x0(%r13)
+        fsipcbuf.write.req_n      = sizeof(fsipcbuf.write.req_buf);
+  8021e1:	49 c7 45 08 f0 0f 00 	movq   $0xff0,0x8(%r13)
+  8021e8:	00 
+        memcpy(fsipcbuf.write.req_buf, buf, sizeof(fsipcbuf.write.req_buf));
+  8021e9:	ba f0 0f 00 00       	mov    $0xff0,%edx
+  8021ee:	4c 89 e6             	mov    %r12,%rsi
+  8021f1:	48 bf 10 60 80 00 00 	movabs $0x806010,%rdi
+  8021f8:	00 00 00 
+  8021fb:	41 ff d7             	call   *%r15
+        ssize_t res = fsipc(FSREQ_WRITE, NULL);
+  8021fe:	be 00 00 00 00       	mov    $0x0,%esi
+  802203:	bf 04 00 00 00       	mov    $0x4,%edi
+  802208:	48 b8 33 20 80 00 00 	movabs $0x802033,%rax
+  80220f:	00 00 00 
+  802212:	ff d0                	call   *%rax
+  802214:	48 63 d0             	movslq %eax,%rdx
+        if (res < 0 || res < sizeof(fsipcbuf.write.req_buf))
+  802217:	3d ef 0f 00 00       	cmp    $0xfef,%eax
+  80221c:	7e 71                	jle    80228f <devfile_write+0xfa>
+        buf += sizeof(fsipcbuf.write.req_buf);
+  80221e:	49 8d b4 24 f0 0f 00 	lea    0xff0(%r12),%rsi
+  802225:	00 
+        n -= sizeof(fsipcbuf.write.req_buf);
+  802226:	48 81 eb f0 0f 00 00 	sub    $0xff0,%rbx
+    while (n > sizeof(fsipcbuf.write.req_buf))
+  80222d:	48 81 fb f0 0f 00 00 	cmp    $0xff0,%rbx
+  802234:	77 a0                	ja     8021d6 <devfile_write+0x41>
+        written += sizeof(fsipcbuf.write.req_buf);
+  802236:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80223a:	49 29 c4             	sub    %rax,%r12
+  80223d:	4d 8d a4 24 f0 0f 00 	lea    0xff0(%r12),%r12
+  802244:	00 
+    fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802245:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  80224c:	00 00 00 
+  80224f:	41 8b 56 0c          	mov    0xc(%r14),%edx
+  802253:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.write.req_n      = n;
+  802255:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    memcpy(fsipcbuf.write.req_buf, buf, n);
+  802259:	48 89 da             	mov    %rbx,%rdx
+  80225c:	48 8d 78 10          	lea    0x10(%rax),%rdi
+  802260:	48 b8 17 10 80 00 00 	movabs $0x801017,%rax
+  802267:	00 00 00 
+  80226a:	ff d0                	call   *%rax
+    ssize_t res = fsipc(FSREQ_WRITE, NULL);
+  80226c:	be 00 00 00 00       	mov    $0x0,%esi
+  802271:	bf 04 00 00 00       	mov    $0x4,%edi
+  802276:	48 b8 33 20 80 00 00 	movabs $0x802033,%rax
+  80227d:	00 00 00 
+  802280:	ff d0                	call   *%rax
+  802282:	48 63 d0             	movslq %eax,%rdx
+    written += res;
+  802285:	49 01 d4             	add    %rdx,%r12
+  802288:	48 85 d2             	test   %rdx,%rdx
+  80228b:	49 0f 49 d4          	cmovns %r12,%rdx
+}
+  80228f:	48 89 d0             	mov    %rdx,%rax
+  802292:	48 83 c4 18          	add    $0x18,%rsp
+  802296:	5b                   	pop    %rbx
+  802297:	41 5c                	pop    %r12
+  802299:	41 5d                	pop    %r13
+  80229b:	41 5e                	pop    %r14
+  80229d:	41 5f                	pop    %r15
+  80229f:	5d                   	pop    %rbp
+  8022a0:	c3                   	ret
+    while (n > sizeof(fsipcbuf.write.req_buf))
+  8022a1:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+    ssize_t written = 0;
+  8022a5:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8022ab:	eb 98                	jmp    802245 <devfile_write+0xb0>
+
+00000000008022ad <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  8022ad:	55                   	push   %rbp
+  8022ae:	48 89 e5             	mov    %rsp,%rbp
+  8022b1:	41 57                	push   %r15
+  8022b3:	41 56                	push   %r14
+  8022b5:	41 55                	push   %r13
+  8022b7:	41 54                	push   %r12
+  8022b9:	53                   	push   %rbx
+  8022ba:	48 83 ec 18          	sub    $0x18,%rsp
+  8022be:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  8022c2:	49 89 f6             	mov    %rsi,%r14
+  8022c5:	49 89 d4             	mov    %rdx,%r12
+    while (n > sizeof(fsipcbuf.readRet.ret_buf))
+  8022c8:	48 81 fa 00 10 00 00 	cmp    $0x1000,%rdx
+  8022cf:	0f 86 ea 00 00 00    	jbe    8023bf <devfile_read+0x112>
+    ssize_t readsz = 0;
+  8022d5:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  8022dc:	00 
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8022dd:	49 bf 00 60 80 00 00 	movabs $0x806000,%r15
+  8022e4:	00 00 00 
+  8022e7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8022eb:	8b 40 0c             	mov    0xc(%rax),%eax
+  8022ee:	41 89 07             	mov    %eax,(%r15)
+        fsipcbuf.read.req_n = sizeof(fsipcbuf.readRet.ret_buf);
+  8022f1:	49 c7 47 08 00 10 00 	movq   $0x1000,0x8(%r15)
+  8022f8:	00 
+        ssize_t res = fsipc(FSREQ_READ, NULL);
+  8022f9:	be 00 00 00 00       	mov    $0x0,%esi
+  8022fe:	bf 03 00 00 00       	mov    $0x3,%edi
+  802303:	48 b8 33 20 80 00 00 	movabs $0x802033,%rax
+  80230a:	00 00 00 
+  80230d:	ff d0                	call   *%rax
+  80230f:	4c 63 e8             	movslq %eax,%r13
+        if (res < 0)
+  802312:	4d 85 ed             	test   %r13,%r13
+  802315:	0f 88 92 00 00 00    	js     8023ad <devfile_read+0x100>
+        memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  80231b:	4c 89 ea             	mov    %r13,%rdx
+  80231e:	4c 89 fe             	mov    %r15,%rsi
+  802321:	4c 89 f7             	mov    %r14,%rdi
+  802324:	48 b8 17 10 80 00 00 	movabs $0x801017,%rax
+  80232b:	00 00 00 
+  80232e:	ff d0                	call   *%rax
+        if (res < sizeof(fsipcbuf.readRet.ret_buf))
+  802330:	49 81 fd ff 0f 00 00 	cmp    $0xfff,%r13
+  802337:	76 6d                	jbe    8023a6 <devfile_read+0xf9>
+        readsz += res;
+  802339:	4c 01 6d c0          	add    %r13,-0x40(%rbp)
+        buf += res;
+  80233d:	4d 01 ee             	add    %r13,%r14
+        n -= res;
+  802340:	4d 29 ec             	sub    %r13,%r12
+    while (n > sizeof(fsipcbuf.readRet.ret_buf))
+  802343:	49 81 fc 00 10 00 00 	cmp    $0x1000,%r12
+  80234a:	77 9b                	ja     8022e7 <devfile_read+0x3a>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  80234c:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  802353:	00 00 00 
+  802356:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  80235a:	8b 51 0c             	mov    0xc(%rcx),%edx
+  80235d:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.read.req_n = n;
+  80235f:	4c 89 60 08          	mov    %r12,0x8(%rax)
+    ssize_t res = fsipc(FSREQ_READ, NULL);
+  802363:	be 00 00 00 00       	mov    $0x0,%esi
+  802368:	bf 03 00 00 00       	mov    $0x3,%edi
+  80236d:	48 b8 33 20 80 00 00 	movabs $0x802033,%rax
+  802374:	00 00 00 
+  802377:	ff d0                	call   *%rax
+  802379:	4c 63 e8             	movslq %eax,%r13
+    if (res < 0)
+  80237c:	4d 85 ed             	test   %r13,%r13
+  80237f:	78 2c                	js     8023ad <devfile_read+0x100>
+    memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  802381:	4c 89 ea             	mov    %r13,%rdx
+  802384:	48 be 00 60 80 00 00 	movabs $0x806000,%rsi
+  80238b:	00 00 00 
+  80238e:	4c 89 f7             	mov    %r14,%rdi
+  802391:	48 b8 17 10 80 00 00 	movabs $0x801017,%rax
+  802398:	00 00 00 
+  80239b:	ff d0                	call   *%rax
+    readsz += res;
+  80239d:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8023a1:	49 01 c5             	add    %rax,%r13
+    return readsz;
+  8023a4:	eb 07                	jmp    8023ad <devfile_read+0x100>
+            return readsz + res;
+  8023a6:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8023aa:	49 01 c5             	add    %rax,%r13
+}
+  8023ad:	4c 89 e8             	mov    %r13,%rax
+  8023b0:	48 83 c4 18          	add    $0x18,%rsp
+  8023b4:	5b                   	pop    %rbx
+  8023b5:	41 5c                	pop    %r12
+  8023b7:	41 5d                	pop    %r13
+  8023b9:	41 5e                	pop    %r14
+  8023bb:	41 5f                	pop    %r15
+  8023bd:	5d                   	pop    %rbp
+  8023be:	c3                   	ret
+    ssize_t readsz = 0;
+  8023bf:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  8023c6:	00 
+  8023c7:	eb 83                	jmp    80234c <devfile_read+0x9f>
+
+00000000008023c9 <open>:
+open(const char *path, int mode) {
+  8023c9:	55                   	push   %rbp
+  8023ca:	48 89 e5             	mov    %rsp,%rbp
+  8023cd:	41 55                	push   %r13
+  8023cf:	41 54                	push   %r12
+  8023d1:	53                   	push   %rbx
+  8023d2:	48 83 ec 18          	sub    $0x18,%rsp
+  8023d6:	49 89 fc             	mov    %rdi,%r12
+  8023d9:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  8023dc:	48 b8 78 0d 80 00 00 	movabs $0x800d78,%rax
+  8023e3:	00 00 00 
+  8023e6:	ff d0                	call   *%rax
+  8023e8:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  8023ee:	0f 87 8a 00 00 00    	ja     80247e <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8023f4:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  8023f8:	48 b8 ac 19 80 00 00 	movabs $0x8019ac,%rax
+  8023ff:	00 00 00 
+  802402:	ff d0                	call   *%rax
+  802404:	89 c3                	mov    %eax,%ebx
+  802406:	85 c0                	test   %eax,%eax
+  802408:	78 50                	js     80245a <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  80240a:	4c 89 e6             	mov    %r12,%rsi
+  80240d:	48 bb 00 60 80 00 00 	movabs $0x806000,%rbx
+  802414:	00 00 00 
+  802417:	48 89 df             	mov    %rbx,%rdi
+  80241a:	48 b8 b6 0d 80 00 00 	movabs $0x800db6,%rax
+  802421:	00 00 00 
+  802424:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  802426:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  80242d:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802431:	bf 01 00 00 00       	mov    $0x1,%edi
+  802436:	48 b8 33 20 80 00 00 	movabs $0x802033,%rax
+  80243d:	00 00 00 
+  802440:	ff d0                	call   *%rax
+  802442:	89 c3                	mov    %eax,%ebx
+  802444:	85 c0                	test   %eax,%eax
+  802446:	78 1f                	js     802467 <open+0x9e>
+    return fd2num(fd);
+  802448:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80244c:	48 b8 05 19 80 00 00 	movabs $0x801905,%rax
+  802453:	00 00 00 
+  802456:	ff d0                	call   *%rax
+  802458:	89 c3                	mov    %eax,%ebx
+}
+  80245a:	89 d8                	mov    %ebx,%eax
+  80245c:	48 83 c4 18          	add    $0x18,%rsp
+  802460:	5b                   	pop    %rbx
+  802461:	41 5c                	pop    %r12
+  802463:	41 5d                	pop    %r13
+  802465:	5d                   	pop    %rbp
+  802466:	c3                   	ret
+        fd_close(fd, 0);
+  802467:	be 00 00 00 00       	mov    $0x0,%esi
+  80246c:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802470:	48 b8 81 1a 80 00 00 	movabs $0x801a81,%rax
+  802477:	00 00 00 
+  80247a:	ff d0                	call   *%rax
+        return res;
+  80247c:	eb dc                	jmp    80245a <open+0x91>
+        return -E_BAD_PATH;
+  80247e:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  802483:	eb d5                	jmp    80245a <open+0x91>
+
+0000000000802485 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  802485:	55                   	push   %rbp
+  802486:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc(FSREQ_SYNC, NULL);
+  802489:	be 00 00 00 00       	mov    $0x0,%esi
+  80248e:	bf 08 00 00 00       	mov    $0x8,%edi
+  802493:	48 b8 33 20 80 00 00 	movabs $0x802033,%rax
+  80249a:	00 00 00 
+  80249d:	ff d0                	call   *%rax
+}
+  80249f:	5d                   	pop    %rbp
+  8024a0:	c3                   	ret
+
+00000000008024a1 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  8024a1:	55                   	push   %rbp
+  8024a2:	48 89 e5             	mov    %rsp,%rbp
+  8024a5:	41 54                	push   %r12
+  8024a7:	53                   	push   %rbx
+  8024a8:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8024ab:	48 b8 17 19 80 00 00 	movabs $0x801917,%rax
+  8024b2:	00 00 00 
+  8024b5:	ff d0                	call   *%rax
+  8024b7:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  8024ba:	48 be 00 38 80 00 00 	movabs $0x803800,%rsi
+  8024c1:	00 00 00 
+  8024c4:	48 89 df             	mov    %rbx,%rdi
+  8024c7:	48 b8 b6 0d 80 00 00 	movabs $0x800db6,%rax
+  8024ce:	00 00 00 
+  8024d1:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  8024d3:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  8024d8:	41 2b 04 24          	sub    (%r12),%eax
+  8024dc:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  8024e2:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8024e9:	00 00 00 
+    stat->st_dev = &devpipe;
+  8024ec:	48 b8 60 40 80 00 00 	movabs $0x804060,%rax
+  8024f3:	00 00 00 
+  8024f6:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  8024fd:	b8 00 00 00 00       	mov    $0x0,%eax
+  802502:	5b                   	pop    %rbx
+  802503:	41 5c                	pop    %r12
+  802505:	5d                   	pop    %rbp
+  802506:	c3                   	ret
+
+0000000000802507 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  802507:	55                   	push   %rbp
+  802508:	48 89 e5             	mov    %rsp,%rbp
+  80250b:	41 54                	push   %r12
+  80250d:	53                   	push   %rbx
+  80250e:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  802511:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802516:	48 89 fe             	mov    %rdi,%rsi
+  802519:	bf 00 00 00 00       	mov    $0x0,%edi
+  80251e:	49 bc 32 14 80 00 00 	movabs $0x801432,%r12
+  802525:	00 00 00 
+  802528:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  80252b:	48 89 df             	mov    %rbx,%rdi
+  80252e:	48 b8 17 19 80 00 00 	movabs $0x801917,%rax
+  802535:	00 00 00 
+  802538:	ff d0                	call   *%rax
+  80253a:	48 89 c6             	mov    %rax,%rsi
+  80253d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802542:	bf 00 00 00 00       	mov    $0x0,%edi
+  802547:	41 ff d4             	call   *%r12
+}
+  80254a:	5b                   	pop    %rbx
+  80254b:	41 5c                	pop    %r12
+  80254d:	5d                   	pop    %rbp
+  80254e:	c3                   	ret
+
+000000000080254f <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  80254f:	55                   	push   %rbp
+  802550:	48 89 e5             	mov    %rsp,%rbp
+  802553:	41 57                	push   %r15
+  802555:	41 56                	push   %r14
+  802557:	41 55                	push   %r13
+  802559:	41 54                	push   %r12
+  80255b:	53                   	push   %rbx
+  80255c:	48 83 ec 18          	sub    $0x18,%rsp
+  802560:	49 89 fc             	mov    %rdi,%r12
+  802563:	49 89 f5             	mov    %rsi,%r13
+  802566:	49 89 d7             	mov    %rdx,%r15
+  802569:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80256d:	48 b8 17 19 80 00 00 	movabs $0x801917,%rax
+  802574:	00 00 00 
+  802577:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  802579:	4d 85 ff             	test   %r15,%r15
+  80257c:	0f 84 af 00 00 00    	je     802631 <devpipe_write+0xe2>
+  802582:	48 89 c3             	mov    %rax,%rbx
+  802585:	4c 89 f8             	mov    %r15,%rax
+  802588:	4d 89 ef             	mov    %r13,%r15
+  80258b:	4c 01 e8             	add    %r13,%rax
+  80258e:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802592:	49 bd 3a 13 80 00 00 	movabs $0x80133a,%r13
+  802599:	00 00 00 
+            sys_yield();
+  80259c:	49 be d7 12 80 00 00 	movabs $0x8012d7,%r14
+  8025a3:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  8025a6:	8b 73 04             	mov    0x4(%rbx),%esi
+  8025a9:	48 63 ce             	movslq %esi,%rcx
+  8025ac:	48 63 03             	movslq (%rbx),%rax
+  8025af:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  8025b5:	48 39 c1             	cmp    %rax,%rcx
+  8025b8:	72 2e                	jb     8025e8 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8025ba:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8025bf:	48 89 da             	mov    %rbx,%rdx
+  8025c2:	be 00 10 00 00       	mov    $0x1000,%esi
+  8025c7:	4c 89 e7             	mov    %r12,%rdi
+  8025ca:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  8025cd:	85 c0                	test   %eax,%eax
+  8025cf:	74 66                	je     802637 <devpipe_write+0xe8>
+            sys_yield();
+  8025d1:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  8025d4:	8b 73 04             	mov    0x4(%rbx),%esi
+  8025d7:	48 63 ce             	movslq %esi,%rcx
+  8025da:	48 63 03             	movslq (%rbx),%rax
+  8025dd:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  8025e3:	48 39 c1             	cmp    %rax,%rcx
+  8025e6:	73 d2                	jae    8025ba <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8025e8:	41 0f b6 3f          	movzbl (%r15),%edi
+  8025ec:	48 89 ca             	mov    %rcx,%rdx
+  8025ef:	48 c1 ea 03          	shr    $0x3,%rdx
+  8025f3:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  8025fa:	08 10 20 
+  8025fd:	48 f7 e2             	mul    %rdx
+  802600:	48 c1 ea 06          	shr    $0x6,%rdx
+  802604:	48 89 d0             	mov    %rdx,%rax
+  802607:	48 c1 e0 09          	shl    $0x9,%rax
+  80260b:	48 29 d0             	sub    %rdx,%rax
+  80260e:	48 c1 e0 03          	shl    $0x3,%rax
+  802612:	48 29 c1             	sub    %rax,%rcx
+  802615:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  80261a:	83 c6 01             	add    $0x1,%esi
+  80261d:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  802620:	49 83 c7 01          	add    $0x1,%r15
+  802624:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802628:	49 39 c7             	cmp    %rax,%r15
+  80262b:	0f 85 75 ff ff ff    	jne    8025a6 <devpipe_write+0x57>
+    return n;
+  802631:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802635:	eb 05                	jmp    80263c <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  802637:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80263c:	48 83 c4 18          	add    $0x18,%rsp
+  802640:	5b                   	pop    %rbx
+  802641:	41 5c                	pop    %r12
+  802643:	41 5d                	pop    %r13
+  802645:	41 5e                	pop    %r14
+  802647:	41 5f                	pop    %r15
+  802649:	5d                   	pop    %rbp
+  80264a:	c3                   	ret
+
+000000000080264b <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  80264b:	55                   	push   %rbp
+  80264c:	48 89 e5             	mov    %rsp,%rbp
+  80264f:	41 57                	push   %r15
+  802651:	41 56                	push   %r14
+  802653:	41 55                	push   %r13
+  802655:	41 54                	push   %r12
+  802657:	53                   	push   %rbx
+  802658:	48 83 ec 18          	sub    $0x18,%rsp
+  80265c:	49 89 fc             	mov    %rdi,%r12
+  80265f:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  802663:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802667:	48 b8 17 19 80 00 00 	movabs $0x801917,%rax
+  80266e:	00 00 00 
+  802671:	ff d0                	call   *%rax
+  802673:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  802676:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80267c:	49 bd 3a 13 80 00 00 	movabs $0x80133a,%r13
+  802683:	00 00 00 
+            sys_yield();
+  802686:	49 be d7 12 80 00 00 	movabs $0x8012d7,%r14
+  80268d:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  802690:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  802695:	74 7d                	je     802714 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  802697:	8b 03                	mov    (%rbx),%eax
+  802699:	3b 43 04             	cmp    0x4(%rbx),%eax
+  80269c:	75 26                	jne    8026c4 <devpipe_read+0x79>
+            if (i > 0) return i;
+  80269e:	4d 85 ff             	test   %r15,%r15
+  8026a1:	75 77                	jne    80271a <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8026a3:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8026a8:	48 89 da             	mov    %rbx,%rdx
+  8026ab:	be 00 10 00 00       	mov    $0x1000,%esi
+  8026b0:	4c 89 e7             	mov    %r12,%rdi
+  8026b3:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  8026b6:	85 c0                	test   %eax,%eax
+  8026b8:	74 72                	je     80272c <devpipe_read+0xe1>
+            sys_yield();
+  8026ba:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  8026bd:	8b 03                	mov    (%rbx),%eax
+  8026bf:	3b 43 04             	cmp    0x4(%rbx),%eax
+  8026c2:	74 df                	je     8026a3 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  8026c4:	48 63 c8             	movslq %eax,%rcx
+  8026c7:	48 89 ca             	mov    %rcx,%rdx
+  8026ca:	48 c1 ea 03          	shr    $0x3,%rdx
+  8026ce:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  8026d5:	08 10 20 
+  8026d8:	48 89 d0             	mov    %rdx,%rax
+  8026db:	48 f7 e6             	mul    %rsi
+  8026de:	48 c1 ea 06          	shr    $0x6,%rdx
+  8026e2:	48 89 d0             	mov    %rdx,%rax
+  8026e5:	48 c1 e0 09          	shl    $0x9,%rax
+  8026e9:	48 29 d0             	sub    %rdx,%rax
+  8026ec:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  8026f3:	00 
+  8026f4:	48 89 c8             	mov    %rcx,%rax
+  8026f7:	48 29 d0             	sub    %rdx,%rax
+  8026fa:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  8026ff:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  802703:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  802707:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  80270a:	49 83 c7 01          	add    $0x1,%r15
+  80270e:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  802712:	75 83                	jne    802697 <devpipe_read+0x4c>
+    return n;
+  802714:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802718:	eb 03                	jmp    80271d <devpipe_read+0xd2>
+            if (i > 0) return i;
+  80271a:	4c 89 f8             	mov    %r15,%rax
+}
+  80271d:	48 83 c4 18          	add    $0x18,%rsp
+  802721:	5b                   	pop    %rbx
+  802722:	41 5c                	pop    %r12
+  802724:	41 5d                	pop    %r13
+  802726:	41 5e                	pop    %r14
+  802728:	41 5f                	pop    %r15
+  80272a:	5d                   	pop    %rbp
+  80272b:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  80272c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802731:	eb ea                	jmp    80271d <devpipe_read+0xd2>
+
+0000000000802733 <pipe>:
+pipe(int pfd[2]) {
+  802733:	55                   	push   %rbp
+  802734:	48 89 e5             	mov    %rsp,%rbp
+  802737:	41 55                	push   %r13
+  802739:	41 54                	push   %r12
+  80273b:	53                   	push   %rbx
+  80273c:	48 81 ec b8 00 00 00 	sub    $0xb8,%rsp
+  802743:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  802746:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  80274a:	48 b8 ac 19 80 00 00 	movabs $0x8019ac,%rax
+  802751:	00 00 00 
+  802754:	ff d0                	call   *%rax
+  802756:	89 c3                	mov    %eax,%ebx
+  802758:	85 c0                	test   %eax,%eax
+  80275a:	0f 88 51 01 00 00    	js     8028b1 <pipe+0x17e>
+        (res = fd_alloc_from(fd2num(fd0) + 1, &fd1)) < 0) goto err;
+  802760:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802764:	48 b8 05 19 80 00 00 	movabs $0x801905,%rax
+  80276b:	00 00 00 
+  80276e:	ff d0                	call   *%rax
+  802770:	8d 78 01             	lea    0x1(%rax),%edi
+  802773:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802777:	48 b8 33 19 80 00 00 	movabs $0x801933,%rax
+  80277e:	00 00 00 
+  802781:	ff d0                	call   *%rax
+  802783:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  802785:	85 c0                	test   %eax,%eax
+  802787:	0f 88 24 01 00 00    	js     8028b1 <pipe+0x17e>
+    va = fd2data(fd0);
+  80278d:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802791:	48 bb 17 19 80 00 00 	movabs $0x801917,%rbx
+  802798:	00 00 00 
+  80279b:	ff d3                	call   *%rbx
+  80279d:	49 89 c5             	mov    %rax,%r13
+    struct RegionOp ops[] = {
+  8027a0:	48 8d bd 30 ff ff ff 	lea    -0xd0(%rbp),%rdi
+  8027a7:	b9 14 00 00 00       	mov    $0x14,%ecx
+  8027ac:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027b1:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+  8027b4:	c7 85 34 ff ff ff 46 	movl   $0x46,-0xcc(%rbp)
+  8027bb:	00 00 00 
+  8027be:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8027c2:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+  8027c9:	48 c7 85 50 ff ff ff 	movq   $0x1000,-0xb0(%rbp)
+  8027d0:	00 10 00 00 
+  8027d4:	c7 85 5c ff ff ff 46 	movl   $0x46,-0xa4(%rbp)
+  8027db:	00 00 00 
+            {.type = REGION_ALLOC, .dstva = (uintptr_t)fd1, .size = PAGE_SIZE, .perm = PROT_RW | PROT_SHARE},
+  8027de:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+    struct RegionOp ops[] = {
+  8027e2:	48 89 bd 70 ff ff ff 	mov    %rdi,-0x90(%rbp)
+  8027e9:	48 c7 85 78 ff ff ff 	movq   $0x1000,-0x88(%rbp)
+  8027f0:	00 10 00 00 
+  8027f4:	c7 45 84 46 00 00 00 	movl   $0x46,-0x7c(%rbp)
+  8027fb:	4c 89 6d 98          	mov    %r13,-0x68(%rbp)
+  8027ff:	48 c7 45 a0 00 10 00 	movq   $0x1000,-0x60(%rbp)
+  802806:	00 
+  802807:	c7 45 a8 01 00 00 00 	movl   $0x1,-0x58(%rbp)
+  80280e:	c7 45 ac 46 00 00 00 	movl   $0x46,-0x54(%rbp)
+  802815:	4c 89 6d b8          	mov    %r13,-0x48(%rbp)
+            {.type = REGION_MAP, .srcva = (uintptr_t)va, .dstva = (uintptr_t)fd2data(fd1), .size = PAGE_SIZE, .perm = PROT_RW | PROT_SHARE},
+  802819:	ff d3                	call   *%rbx
+    struct RegionOp ops[] = {
+  80281b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80281f:	48 c7 45 c8 00 10 00 	movq   $0x1000,-0x38(%rbp)
+  802826:	00 
+    if ((res = sys_region_batch(ops, sizeof ops / sizeof *ops)) < 0) goto err1;
+  802827:	be 04 00 00 00       	mov    $0x4,%esi
+  80282c:	48 8d bd 30 ff ff ff 	lea    -0xd0(%rbp),%rdi
+  802833:	48 b8 99 14 80 00 00 	movabs $0x801499,%rax
+  80283a:	00 00 00 
+  80283d:	ff d0                	call   *%rax
+  80283f:	89 c3                	mov    %eax,%ebx
+  802841:	85 c0                	test   %eax,%eax
+  802843:	0f 88 ad 00 00 00    	js     8028f6 <pipe+0x1c3>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  802849:	be 00 10 00 00       	mov    $0x1000,%esi
+  80284e:	4c 89 ef             	mov    %r13,%rdi
+  802851:	48 b8 08 13 80 00 00 	movabs $0x801308,%rax
+  802858:	00 00 00 
+  80285b:	ff d0                	call   *%rax
+  80285d:	83 f8 02             	cmp    $0x2,%eax
+  802860:	75 5f                	jne    8028c1 <pipe+0x18e>
+    fd0->fd_dev_id = devpipe.dev_id;
+  802862:	a1 60 40 80 00 00 00 	movabs 0x804060,%eax
+  802869:	00 00 
+  80286b:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80286f:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  802871:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802875:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  80287c:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  802880:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  802882:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802886:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  80288d:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802891:	48 bb 05 19 80 00 00 	movabs $0x801905,%rbx
+  802898:	00 00 00 
+  80289b:	ff d3                	call   *%rbx
+  80289d:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  8028a1:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  8028a5:	ff d3                	call   *%rbx
+  8028a7:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  8028ac:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  8028b1:	89 d8                	mov    %ebx,%eax
+  8028b3:	48 81 c4 b8 00 00 00 	add    $0xb8,%rsp
+  8028ba:	5b                   	pop    %rbx
+  8028bb:	41 5c                	pop    %r12
+  8028bd:	41 5d                	pop    %r13
+  8028bf:	5d                   	pop    %rbp
+  8028c0:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8028c1:	48 b9 30 38 80 00 00 	movabs $0x803830,%rcx
+  8028c8:	00 00 00 
+  8028cb:	48 ba 07 38 80 00 00 	movabs $0x803807,%rdx
+  8028d2:	00 00 00 
+  8028d5:	be 33 00 00 00       	mov    $0x33,%esi
+  8028da:	48 bf 1c 38 80 00 00 	movabs $0x80381c,%rdi
+  8028e1:	00 00 00 
+  8028e4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028e9:	49 b8 41 03 80 00 00 	movabs $0x800341,%r8
+  8028f0:	00 00 00 
+  8028f3:	41 ff d0             	call   *%r8
+        ops[i].type = REGION_UNMAP;
+  8028f6:	c7 85 30 ff ff ff 02 	movl   $0x2,-0xd0(%rbp)
+  8028fd:	00 00 00 
+  802900:	c7 85 58 ff ff ff 02 	movl   $0x2,-0xa8(%rbp)
+  802907:	00 00 00 
+  80290a:	c7 45 80 02 00 00 00 	movl   $0x2,-0x80(%rbp)
+  802911:	c7 45 a8 02 00 00 00 	movl   $0x2,-0x58(%rbp)
+    sys_region_batch(ops, sizeof ops / sizeof *ops);
+  802918:	be 04 00 00 00       	mov    $0x4,%esi
+  80291d:	48 8d bd 30 ff ff ff 	lea    -0xd0(%rbp),%rdi
+  802924:	48 b8 99 14 80 00 00 	movabs $0x801499,%rax
+  80292b:	00 00 00 
+  80292e:	ff d0                	call   *%rax
+  802930:	e9 7c ff ff ff       	jmp    8028b1 <pipe+0x17e>
+
+0000000000802935 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  802935:	55                   	push   %rbp
+  802936:	48 89 e5             	mov    %rsp,%rbp
+  802939:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  80293d:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802941:	48 b8 c6 19 80 00 00 	movabs $0x8019c6,%rax
+  802948:	00 00 00 
+  80294b:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80294d:	85 c0                	test   %eax,%eax
+  80294f:	78 35                	js     802986 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  802951:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802955:	48 b8 17 19 80 00 00 	movabs $0x801917,%rax
+  80295c:	00 00 00 
+  80295f:	ff d0                	call   *%rax
+  802961:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802964:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802969:	be 00 10 00 00       	mov    $0x1000,%esi
+  80296e:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802972:	48 b8 3a 13 80 00 00 	movabs $0x80133a,%rax
+  802979:	00 00 00 
+  80297c:	ff d0                	call   *%rax
+  80297e:	85 c0                	test   %eax,%eax
+  802980:	0f 94 c0             	sete   %al
+  802983:	0f b6 c0             	movzbl %al,%eax
+}
+  802986:	c9                   	leave
+  802987:	c3                   	ret
+
+0000000000802988 <wait>:
+#include <inc/lib.h>
+
+/* Waits until 'envid' exits. */
+void
+wait(envid_t envid) {
+  802988:	55                   	push   %rbp
+  802989:	48 89 e5             	mov    %rsp,%rbp
+  80298c:	41 55                	push   %r13
+  80298e:	41 54                	push   %r12
+  802990:	53                   	push   %rbx
+  802991:	48 83 ec 08          	sub    $0x8,%rsp
+    assert(envid != 0);
+  802995:	85 ff                	test   %edi,%edi
+  802997:	74 73                	je     802a0c <wait+0x84>
+  802999:	41 89 fc             	mov    %edi,%r12d
+
+    const volatile struct Env *env = &envs[ENVX(envid)];
+  80299c:	89 f8                	mov    %edi,%eax
+  80299e:	25 ff 03 00 00       	and    $0x3ff,%eax
+
+    while (env->env_id == envid &&
+  8029a3:	89 f9                	mov    %edi,%ecx
+  8029a5:	81 e1 ff 03 00 00    	and    $0x3ff,%ecx
+  8029ab:	48 69 c9 d0 01 00 00 	imul   $0x1d0,%rcx,%rcx
+  8029b2:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8029b9:	00 00 00 
+  8029bc:	48 01 ca             	add    %rcx,%rdx
+  8029bf:	8b 92 e0 00 00 00    	mov    0xe0(%rdx),%edx
+  8029c5:	39 d7                	cmp    %edx,%edi
+  8029c7:	75 38                	jne    802a01 <wait+0x79>
+           env->env_status != ENV_FREE) {
+  8029c9:	48 98                	cltq
+  8029cb:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+  8029d2:	48 bb 00 00 c0 1f 80 	movabs $0x801fc00000,%rbx
+  8029d9:	00 00 00 
+  8029dc:	48 01 c3             	add    %rax,%rbx
+        sys_yield();
+  8029df:	49 bd d7 12 80 00 00 	movabs $0x8012d7,%r13
+  8029e6:	00 00 00 
+           env->env_status != ENV_FREE) {
+  8029e9:	8b 83 ec 00 00 00    	mov    0xec(%rbx),%eax
+    while (env->env_id == envid &&
+  8029ef:	85 c0                	test   %eax,%eax
+  8029f1:	74 0e                	je     802a01 <wait+0x79>
+        sys_yield();
+  8029f3:	41 ff d5             	call   *%r13
+    while (env->env_id == envid &&
+  8029f6:	8b 83 e0 00 00 00    	mov    0xe0(%rbx),%eax
+  8029fc:	44 39 e0             	cmp    %r12d,%eax
+  8029ff:	74 e8                	je     8029e9 <wait+0x61>
+    }
+}
+  802a01:	48 83 c4 08          	add    $0x8,%rsp
+  802a05:	5b                   	pop    %rbx
+  802a06:	41 5c                	pop    %r12
+  802a08:	41 5d                	pop    %r13
+  802a0a:	5d                   	pop    %rbp
+  802a0b:	c3                   	ret
+    assert(envid != 0);
+  802a0c:	48 b9 54 38 80 00 00 	movabs $0x803854,%rcx
+  802a13:	00 00 00 
+  802a16:	48 ba 07 38 80 00 00 	movabs $0x803807,%rdx
+  802a1d:	00 00 00 
+  802a20:	be 06 00 00 00       	mov    $0x6,%esi
+  802a25:	48 bf 5f 38 80 00 00 	movabs $0x80385f,%rdi
+  802a2c:	00 00 00 
+  802a2f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a34:	49 b8 41 03 80 00 00 	movabs $0x800341,%r8
+  802a3b:	00 00 00 
+  802a3e:	41 ff d0             	call   *%r8
+
+0000000000802a41 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  802a41:	48 89 f8             	mov    %rdi,%rax
+  802a44:	48 c1 e8 27          	shr    $0x27,%rax
+  802a48:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  802a4f:	01 00 00 
+  802a52:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802a56:	f6 c2 01             	test   $0x1,%dl
+  802a59:	74 6d                	je     802ac8 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  802a5b:	48 89 f8             	mov    %rdi,%rax
+  802a5e:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802a62:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802a69:	01 00 00 
+  802a6c:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802a70:	f6 c2 01             	test   $0x1,%dl
+  802a73:	74 62                	je     802ad7 <get_uvpt_entry+0x96>
+  802a75:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802a7c:	01 00 00 
+  802a7f:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802a83:	f6 c2 80             	test   $0x80,%dl
+  802a86:	75 4f                	jne    802ad7 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  802a88:	48 89 f8             	mov    %rdi,%rax
+  802a8b:	48 c1 e8 15          	shr    $0x15,%rax
+  802a8f:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802a96:	01 00 00 
+  802a99:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802a9d:	f6 c2 01             	test   $0x1,%dl
+  802aa0:	74 44                	je     802ae6 <get_uvpt_entry+0xa5>
+  802aa2:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802aa9:	01 00 00 
+  802aac:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802ab0:	f6 c2 80             	test   $0x80,%dl
+  802ab3:	75 31                	jne    802ae6 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  802ab5:	48 c1 ef 0c          	shr    $0xc,%rdi
+  802ab9:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802ac0:	01 00 00 
+  802ac3:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  802ac7:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  802ac8:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  802acf:	01 00 00 
+  802ad2:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802ad6:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  802ad7:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802ade:	01 00 00 
+  802ae1:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802ae5:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  802ae6:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802aed:	01 00 00 
+  802af0:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802af4:	c3                   	ret
+
+0000000000802af5 <get_prot>:
+
+int
+get_prot(void *va) {
+  802af5:	55                   	push   %rbp
+  802af6:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  802af9:	48 b8 41 2a 80 00 00 	movabs $0x802a41,%rax
+  802b00:	00 00 00 
+  802b03:	ff d0                	call   *%rax
+  802b05:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  802b08:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  802b0d:	89 c1                	mov    %eax,%ecx
+  802b0f:	83 c9 04             	or     $0x4,%ecx
+  802b12:	f6 c2 01             	test   $0x1,%dl
+  802b15:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  802b18:	89 c1                	mov    %eax,%ecx
+  802b1a:	83 c9 02             	or     $0x2,%ecx
+  802b1d:	f6 c2 02             	test   $0x2,%dl
+  802b20:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  802b23:	89 c1                	mov    %eax,%ecx
+  802b25:	83 c9 01             	or     $0x1,%ecx
+  802b28:	48 85 d2             	test   %rdx,%rdx
+  802b2b:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  802b2e:	89 c1                	mov    %eax,%ecx
+  802b30:	83 c9 40             	or     $0x40,%ecx
+  802b33:	f6 c6 04             	test   $0x4,%dh
+  802b36:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  802b39:	5d                   	pop    %rbp
+  802b3a:	c3                   	ret
+
+0000000000802b3b <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  802b3b:	55                   	push   %rbp
+  802b3c:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  802b3f:	48 b8 41 2a 80 00 00 	movabs $0x802a41,%rax
+  802b46:	00 00 00 
+  802b49:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  802b4b:	48 c1 e8 06          	shr    $0x6,%rax
+  802b4f:	83 e0 01             	and    $0x1,%eax
+}
+  802b52:	5d                   	pop    %rbp
+  802b53:	c3                   	ret
+
+0000000000802b54 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  802b54:	55                   	push   %rbp
+  802b55:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  802b58:	48 b8 41 2a 80 00 00 	movabs $0x802a41,%rax
+  802b5f:	00 00 00 
+  802b62:	ff d0                	call   *%rax
+  802b64:	83 e0 01             	and    $0x1,%eax
+}
+  802b67:	5d                   	pop    %rbp
+  802b68:	c3                   	ret
+
+0000000000802b69 <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  802b69:	55                   	push   %rbp
+  802b6a:	48 89 e5             	mov    %rsp,%rbp
+  802b6d:	41 57                	push   %r15
+  802b6f:	41 56                	push   %r14
+  802b71:	41 55                	push   %r13
+  802b73:	41 54                	push   %r12
+  802b75:	53                   	push   %rbx
+  802b76:	48 83 ec 38          	sub    $0x38,%rsp
+  802b7a:	49 89 f7             	mov    %rsi,%r15
+  802b7d:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+                    }
+                    continue;
+                }
+                for (int ptei = 0; ptei < PT_ENTRY_COUNT; ptei++) {
+                    uintptr_t pte_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, pdei, ptei, 0);
+                    pte_t pte = uvpt[VPT(pte_addr)];
+  802b83:	49 bd 00 00 00 00 00 	movabs $0x10000000000,%r13
+  802b8a:	01 00 00 
+  802b8d:	4d 89 e6             	mov    %r12,%r14
+  802b90:	49 89 fc             	mov    %rdi,%r12
+  802b93:	e9 19 01 00 00       	jmp    802cb1 <foreach_shared_region+0x148>
+  802b98:	48 89 5d b0          	mov    %rbx,-0x50(%rbp)
+  802b9c:	4c 89 75 a8          	mov    %r14,-0x58(%rbp)
+  802ba0:	eb 52                	jmp    802bf4 <foreach_shared_region+0x8b>
+                for (int ptei = 0; ptei < PT_ENTRY_COUNT; ptei++) {
+  802ba2:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802ba9:	48 81 fb 00 00 20 00 	cmp    $0x200000,%rbx
+  802bb0:	74 2e                	je     802be0 <foreach_shared_region+0x77>
+                    uintptr_t pte_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, pdei, ptei, 0);
+  802bb2:	48 89 df             	mov    %rbx,%rdi
+  802bb5:	4c 09 f7             	or     %r14,%rdi
+                    pte_t pte = uvpt[VPT(pte_addr)];
+  802bb8:	48 89 f8             	mov    %rdi,%rax
+  802bbb:	48 c1 e8 0c          	shr    $0xc,%rax
+  802bbf:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+                    if ((pte & PTE_P) && (pte & PTE_SHARE)) {
+  802bc4:	25 01 04 00 00       	and    $0x401,%eax
+  802bc9:	48 3d 01 04 00 00    	cmp    $0x401,%rax
+  802bcf:	75 d1                	jne    802ba2 <foreach_shared_region+0x39>
+                        fun((void*)pte_addr, (void*)(pte_addr + PAGE_SIZE), arg);
+  802bd1:	48 8d b7 00 10 00 00 	lea    0x1000(%rdi),%rsi
+  802bd8:	4c 89 fa             	mov    %r15,%rdx
+  802bdb:	41 ff d4             	call   *%r12
+  802bde:	eb c2                	jmp    802ba2 <foreach_shared_region+0x39>
+            for (int pdei = 0; pdei < PD_ENTRY_COUNT; pdei++) {
+  802be0:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  802be7:	00 
+  802be8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802bec:	48 3d 00 00 00 40    	cmp    $0x40000000,%rax
+  802bf2:	74 46                	je     802c3a <foreach_shared_region+0xd1>
+                uintptr_t pde_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, pdei, 0, 0);
+  802bf4:	4c 8b 75 c8          	mov    -0x38(%rbp),%r14
+  802bf8:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802bfc:	49 09 c6             	or     %rax,%r14
+                pde_t pde = uvpd[VPD(pde_addr)];
+  802bff:	4c 89 f0             	mov    %r14,%rax
+  802c02:	48 c1 e8 15          	shr    $0x15,%rax
+  802c06:	48 b9 00 00 00 80 00 	movabs $0x10080000000,%rcx
+  802c0d:	01 00 00 
+  802c10:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+                if (!(pde & PTE_P)) {
+  802c14:	a8 01                	test   $0x1,%al
+  802c16:	74 c8                	je     802be0 <foreach_shared_region+0x77>
+                if (pde & PTE_PS) {
+  802c18:	48 89 c3             	mov    %rax,%rbx
+  802c1b:	81 e3 80 00 00 00    	and    $0x80,%ebx
+  802c21:	74 8f                	je     802bb2 <foreach_shared_region+0x49>
+                    if (pde & PTE_SHARE) {
+  802c23:	f6 c4 04             	test   $0x4,%ah
+  802c26:	74 b8                	je     802be0 <foreach_shared_region+0x77>
+                        fun((void*)pde_addr, (void*)(pde_addr + 1024 * 1024 * 2), arg);
+  802c28:	49 8d b6 00 00 20 00 	lea    0x200000(%r14),%rsi
+  802c2f:	4c 89 fa             	mov    %r15,%rdx
+  802c32:	4c 89 f7             	mov    %r14,%rdi
+  802c35:	41 ff d4             	call   *%r12
+  802c38:	eb a6                	jmp    802be0 <foreach_shared_region+0x77>
+  802c3a:	48 8b 5d b0          	mov    -0x50(%rbp),%rbx
+  802c3e:	4c 8b 75 a8          	mov    -0x58(%rbp),%r14
+        for (int pdpei = 0; pdpei < PDP_ENTRY_COUNT; pdpei++) {
+  802c42:	48 81 c3 00 00 00 40 	add    $0x40000000,%rbx
+  802c49:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802c50:	00 00 00 
+  802c53:	48 39 c3             	cmp    %rax,%rbx
+  802c56:	74 4c                	je     802ca4 <foreach_shared_region+0x13b>
+            uintptr_t pdpe_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, 0, 0, 0);
+  802c58:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802c5c:	48 09 d8             	or     %rbx,%rax
+  802c5f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+            pdpe_t pdpe = uvpdp[VPDP(pdpe_addr)];
+  802c63:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802c67:	48 b9 00 00 40 80 00 	movabs $0x10080400000,%rcx
+  802c6e:	01 00 00 
+  802c71:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+            if (!(pdpe & PTE_P)) {
+  802c75:	a8 01                	test   $0x1,%al
+  802c77:	74 c9                	je     802c42 <foreach_shared_region+0xd9>
+            if (pdpe & PTE_PS) {
+  802c79:	48 89 c1             	mov    %rax,%rcx
+  802c7c:	81 e1 80 00 00 00    	and    $0x80,%ecx
+  802c82:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  802c86:	0f 84 0c ff ff ff    	je     802b98 <foreach_shared_region+0x2f>
+                if (pdpe & PTE_SHARE) {
+  802c8c:	f6 c4 04             	test   $0x4,%ah
+  802c8f:	74 b1                	je     802c42 <foreach_shared_region+0xd9>
+                    fun((void*)pdpe_addr, (void*)(pdpe_addr + 1024 * 1024 * 1024), arg); 
+  802c91:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  802c95:	48 8d b7 00 00 00 40 	lea    0x40000000(%rdi),%rsi
+  802c9c:	4c 89 fa             	mov    %r15,%rdx
+  802c9f:	41 ff d4             	call   *%r12
+  802ca2:	eb 9e                	jmp    802c42 <foreach_shared_region+0xd9>
+    for (int pml4ei = 0; pml4ei < PML4_ENTRY_COUNT; pml4ei++) {
+  802ca4:	49 83 c6 01          	add    $0x1,%r14
+  802ca8:	49 81 fe 00 02 00 00 	cmp    $0x200,%r14
+  802caf:	74 24                	je     802cd5 <foreach_shared_region+0x16c>
+        pml4e_t pml4e = uvpml4[VPML4(pml4_addr)];
+  802cb1:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  802cb8:	01 00 00 
+  802cbb:	4a 8b 04 f0          	mov    (%rax,%r14,8),%rax
+        if (!(pml4e & PTE_P)) {
+  802cbf:	a8 01                	test   $0x1,%al
+  802cc1:	74 e1                	je     802ca4 <foreach_shared_region+0x13b>
+  802cc3:	4c 89 f0             	mov    %r14,%rax
+  802cc6:	48 c1 e0 27          	shl    $0x27,%rax
+  802cca:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  802cce:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802cd3:	eb 83                	jmp    802c58 <foreach_shared_region+0xef>
+            }
+        }
+    }
+    
+    return 0;
+}
+  802cd5:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cda:	48 83 c4 38          	add    $0x38,%rsp
+  802cde:	5b                   	pop    %rbx
+  802cdf:	41 5c                	pop    %r12
+  802ce1:	41 5d                	pop    %r13
+  802ce3:	41 5e                	pop    %r14
+  802ce5:	41 5f                	pop    %r15
+  802ce7:	5d                   	pop    %rbp
+  802ce8:	c3                   	ret
+
+0000000000802ce9 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  802ce9:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cee:	c3                   	ret
+
+0000000000802cef <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  802cef:	55                   	push   %rbp
+  802cf0:	48 89 e5             	mov    %rsp,%rbp
+  802cf3:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  802cf6:	48 be 6a 38 80 00 00 	movabs $0x80386a,%rsi
+  802cfd:	00 00 00 
+  802d00:	48 b8 b6 0d 80 00 00 	movabs $0x800db6,%rax
+  802d07:	00 00 00 
+  802d0a:	ff d0                	call   *%rax
+    return 0;
+}
+  802d0c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d11:	5d                   	pop    %rbp
+  802d12:	c3                   	ret
+
+0000000000802d13 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  802d13:	55                   	push   %rbp
+  802d14:	48 89 e5             	mov    %rsp,%rbp
+  802d17:	41 57                	push   %r15
+  802d19:	41 56                	push   %r14
+  802d1b:	41 55                	push   %r13
+  802d1d:	41 54                	push   %r12
+  802d1f:	53                   	push   %rbx
+  802d20:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  802d27:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  802d2e:	48 85 d2             	test   %rdx,%rdx
+  802d31:	74 7a                	je     802dad <devcons_write+0x9a>
+  802d33:	49 89 d6             	mov    %rdx,%r14
+  802d36:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802d3c:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  802d41:	49 bf b0 0f 80 00 00 	movabs $0x800fb0,%r15
+  802d48:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  802d4b:	4c 89 f3             	mov    %r14,%rbx
+  802d4e:	48 29 f3             	sub    %rsi,%rbx
+  802d51:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802d56:	48 39 c3             	cmp    %rax,%rbx
+  802d59:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  802d5d:	4c 63 eb             	movslq %ebx,%r13
+  802d60:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  802d67:	48 01 c6             	add    %rax,%rsi
+  802d6a:	4c 89 ea             	mov    %r13,%rdx
+  802d6d:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802d74:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  802d77:	4c 89 ee             	mov    %r13,%rsi
+  802d7a:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802d81:	48 b8 dd 11 80 00 00 	movabs $0x8011dd,%rax
+  802d88:	00 00 00 
+  802d8b:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  802d8d:	41 01 dc             	add    %ebx,%r12d
+  802d90:	49 63 f4             	movslq %r12d,%rsi
+  802d93:	4c 39 f6             	cmp    %r14,%rsi
+  802d96:	72 b3                	jb     802d4b <devcons_write+0x38>
+    return res;
+  802d98:	49 63 c4             	movslq %r12d,%rax
+}
+  802d9b:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  802da2:	5b                   	pop    %rbx
+  802da3:	41 5c                	pop    %r12
+  802da5:	41 5d                	pop    %r13
+  802da7:	41 5e                	pop    %r14
+  802da9:	41 5f                	pop    %r15
+  802dab:	5d                   	pop    %rbp
+  802dac:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  802dad:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802db3:	eb e3                	jmp    802d98 <devcons_write+0x85>
+
+0000000000802db5 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  802db5:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  802db8:	ba 00 00 00 00       	mov    $0x0,%edx
+  802dbd:	48 85 c0             	test   %rax,%rax
+  802dc0:	74 55                	je     802e17 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  802dc2:	55                   	push   %rbp
+  802dc3:	48 89 e5             	mov    %rsp,%rbp
+  802dc6:	41 55                	push   %r13
+  802dc8:	41 54                	push   %r12
+  802dca:	53                   	push   %rbx
+  802dcb:	48 83 ec 08          	sub    $0x8,%rsp
+  802dcf:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  802dd2:	48 bb 0a 12 80 00 00 	movabs $0x80120a,%rbx
+  802dd9:	00 00 00 
+  802ddc:	49 bc d7 12 80 00 00 	movabs $0x8012d7,%r12
+  802de3:	00 00 00 
+  802de6:	eb 03                	jmp    802deb <devcons_read+0x36>
+  802de8:	41 ff d4             	call   *%r12
+  802deb:	ff d3                	call   *%rbx
+  802ded:	85 c0                	test   %eax,%eax
+  802def:	74 f7                	je     802de8 <devcons_read+0x33>
+    if (c < 0) return c;
+  802df1:	48 63 d0             	movslq %eax,%rdx
+  802df4:	78 13                	js     802e09 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  802df6:	ba 00 00 00 00       	mov    $0x0,%edx
+  802dfb:	83 f8 04             	cmp    $0x4,%eax
+  802dfe:	74 09                	je     802e09 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  802e00:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  802e04:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  802e09:	48 89 d0             	mov    %rdx,%rax
+  802e0c:	48 83 c4 08          	add    $0x8,%rsp
+  802e10:	5b                   	pop    %rbx
+  802e11:	41 5c                	pop    %r12
+  802e13:	41 5d                	pop    %r13
+  802e15:	5d                   	pop    %rbp
+  802e16:	c3                   	ret
+  802e17:	48 89 d0             	mov    %rdx,%rax
+  802e1a:	c3                   	ret
+
+0000000000802e1b <cputchar>:
+cputchar(int ch) {
+  802e1b:	55                   	push   %rbp
+  802e1c:	48 89 e5             	mov    %rsp,%rbp
+  802e1f:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  802e23:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  802e27:	be 01 00 00 00       	mov    $0x1,%esi
+  802e2c:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  802e30:	48 b8 dd 11 80 00 00 	movabs $0x8011dd,%rax
+  802e37:	00 00 00 
+  802e3a:	ff d0                	call   *%rax
+}
+  802e3c:	c9                   	leave
+  802e3d:	c3                   	ret
+
+0000000000802e3e <getchar>:
+getchar(void) {
+  802e3e:	55                   	push   %rbp
+  802e3f:	48 89 e5             	mov    %rsp,%rbp
+  802e42:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  802e46:	ba 01 00 00 00       	mov    $0x1,%edx
+  802e4b:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  802e4f:	bf 00 00 00 00       	mov    $0x0,%edi
+  802e54:	48 b8 a9 1c 80 00 00 	movabs $0x801ca9,%rax
+  802e5b:	00 00 00 
+  802e5e:	ff d0                	call   *%rax
+  802e60:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  802e62:	85 c0                	test   %eax,%eax
+  802e64:	78 06                	js     802e6c <getchar+0x2e>
+  802e66:	74 08                	je     802e70 <getchar+0x32>
+  802e68:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  802e6c:	89 d0                	mov    %edx,%eax
+  802e6e:	c9                   	leave
+  802e6f:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  802e70:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  802e75:	eb f5                	jmp    802e6c <getchar+0x2e>
+
+0000000000802e77 <iscons>:
+iscons(int fdnum) {
+  802e77:	55                   	push   %rbp
+  802e78:	48 89 e5             	mov    %rsp,%rbp
+  802e7b:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  802e7f:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802e83:	48 b8 c6 19 80 00 00 	movabs $0x8019c6,%rax
+  802e8a:	00 00 00 
+  802e8d:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802e8f:	85 c0                	test   %eax,%eax
+  802e91:	78 18                	js     802eab <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  802e93:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802e97:	48 b8 a0 40 80 00 00 	movabs $0x8040a0,%rax
+  802e9e:	00 00 00 
+  802ea1:	8b 00                	mov    (%rax),%eax
+  802ea3:	39 02                	cmp    %eax,(%rdx)
+  802ea5:	0f 94 c0             	sete   %al
+  802ea8:	0f b6 c0             	movzbl %al,%eax
+}
+  802eab:	c9                   	leave
+  802eac:	c3                   	ret
+
+0000000000802ead <opencons>:
+opencons(void) {
+  802ead:	55                   	push   %rbp
+  802eae:	48 89 e5             	mov    %rsp,%rbp
+  802eb1:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802eb5:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  802eb9:	48 b8 ac 19 80 00 00 	movabs $0x8019ac,%rax
+  802ec0:	00 00 00 
+  802ec3:	ff d0                	call   *%rax
+  802ec5:	85 c0                	test   %eax,%eax
+  802ec7:	78 49                	js     802f12 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  802ec9:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802ece:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802ed3:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  802ed7:	bf 00 00 00 00       	mov    $0x0,%edi
+  802edc:	48 b8 66 13 80 00 00 	movabs $0x801366,%rax
+  802ee3:	00 00 00 
+  802ee6:	ff d0                	call   *%rax
+  802ee8:	85 c0                	test   %eax,%eax
+  802eea:	78 26                	js     802f12 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  802eec:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802ef0:	a1 a0 40 80 00 00 00 	movabs 0x8040a0,%eax
+  802ef7:	00 00 
+  802ef9:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  802efb:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802eff:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  802f06:	48 b8 05 19 80 00 00 	movabs $0x801905,%rax
+  802f0d:	00 00 00 
+  802f10:	ff d0                	call   *%rax
+}
+  802f12:	c9                   	leave
+  802f13:	c3                   	ret
+
+0000000000802f14 <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  802f14:	55                   	push   %rbp
+  802f15:	48 89 e5             	mov    %rsp,%rbp
+  802f18:	41 55                	push   %r13
+  802f1a:	41 54                	push   %r12
+  802f1c:	53                   	push   %rbx
+  802f1d:	48 83 ec 08          	sub    $0x8,%rsp
+  802f21:	49 89 fc             	mov    %rdi,%r12
+  802f24:	48 89 f7             	mov    %rsi,%rdi
+  802f27:	48 89 d3             	mov    %rdx,%rbx
+  802f2a:	49 89 cd             	mov    %rcx,%r13
+    // LAB 9: Your code here:
+    int res = sys_ipc_recv(!pg ? (void*)MAX_USER_ADDRESS : pg, !size ? 0 : *size);
+  802f2d:	be 00 00 00 00       	mov    $0x0,%esi
+  802f32:	48 85 d2             	test   %rdx,%rdx
+  802f35:	74 03                	je     802f3a <ipc_recv+0x26>
+  802f37:	48 8b 32             	mov    (%rdx),%rsi
+  802f3a:	48 85 ff             	test   %rdi,%rdi
+  802f3d:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802f44:	00 00 00 
+  802f47:	48 0f 44 f8          	cmove  %rax,%rdi
+  802f4b:	48 b8 38 17 80 00 00 	movabs $0x801738,%rax
+  802f52:	00 00 00 
+  802f55:	ff d0                	call   *%rax
+    if (res < 0) {
+  802f57:	85 c0                	test   %eax,%eax
+  802f59:	78 66                	js     802fc1 <ipc_recv+0xad>
+        if (size) {
+            *size = 0;
+        }
+        return res;
+    }
+    if (from_env_store) {
+  802f5b:	4d 85 e4             	test   %r12,%r12
+  802f5e:	74 14                	je     802f74 <ipc_recv+0x60>
+        *from_env_store = thisenv->env_ipc_from;
+  802f60:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802f67:	00 00 00 
+  802f6a:	8b 80 ac 01 00 00    	mov    0x1ac(%rax),%eax
+  802f70:	41 89 04 24          	mov    %eax,(%r12)
+    }
+    if (perm_store) {
+  802f74:	4d 85 ed             	test   %r13,%r13
+  802f77:	74 14                	je     802f8d <ipc_recv+0x79>
+        *perm_store = thisenv->env_ipc_perm;
+  802f79:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802f80:	00 00 00 
+  802f83:	8b 80 b0 01 00 00    	mov    0x1b0(%rax),%eax
+  802f89:	41 89 45 00          	mov    %eax,0x0(%r13)
+    }
+    if (size) {
+  802f8d:	48 85 db             	test   %rbx,%rbx
+  802f90:	74 14                	je     802fa6 <ipc_recv+0x92>
+        *size = thisenv->env_ipc_maxsz;
+  802f92:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802f99:	00 00 00 
+  802f9c:	48 8b 80 a0 01 00 00 	mov    0x1a0(%rax),%rax
+  802fa3:	48 89 03             	mov    %rax,(%rbx)
+    }
+    return thisenv->env_ipc_value;
+  802fa6:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802fad:	00 00 00 
+  802fb0:	8b 80 a8 01 00 00    	mov    0x1a8(%rax),%eax
+}
+  802fb6:	48 83 c4 08          	add    $0x8,%rsp
+  802fba:	5b                   	pop    %rbx
+  802fbb:	41 5c                	pop    %r12
+  802fbd:	41 5d                	pop    %r13
+  802fbf:	5d                   	pop    %rbp
+  802fc0:	c3                   	ret
+        if (from_env_store) {
+  802fc1:	4d 85 e4             	test   %r12,%r12
+  802fc4:	74 08                	je     802fce <ipc_recv+0xba>
+            *from_env_store = 0;
+  802fc6:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  802fcd:	00 
+        if (perm_store) {
+  802fce:	4d 85 ed             	test   %r13,%r13
+  802fd1:	74 08                	je     802fdb <ipc_recv+0xc7>
+            *perm_store = 0;
+  802fd3:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  802fda:	00 
+        if (size) {
+  802fdb:	48 85 db             	test   %rbx,%rbx
+  802fde:	74 d6                	je     802fb6 <ipc_recv+0xa2>
+            *size = 0;
+  802fe0:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  802fe7:	eb cd                	jmp    802fb6 <ipc_recv+0xa2>
+
+0000000000802fe9 <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  802fe9:	55                   	push   %rbp
+  802fea:	48 89 e5             	mov    %rsp,%rbp
+  802fed:	41 57                	push   %r15
+  802fef:	41 56                	push   %r14
+  802ff1:	41 55                	push   %r13
+  802ff3:	41 54                	push   %r12
+  802ff5:	53                   	push   %rbx
+  802ff6:	48 83 ec 18          	sub    $0x18,%rsp
+  802ffa:	41 89 fd             	mov    %edi,%r13d
+  802ffd:	89 75 cc             	mov    %esi,-0x34(%rbp)
+  803000:	49 89 cc             	mov    %rcx,%r12
+  803003:	44 89 45 c8          	mov    %r8d,-0x38(%rbp)
+    // LAB 9: Your code here:
+    int res = 0;
+    while ((res = sys_ipc_try_send(to_env, val, !pg ? (void*)MAX_USER_ADDRESS : pg, size, perm)) < 0) {
+  803007:	48 85 d2             	test   %rdx,%rdx
+  80300a:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803011:	00 00 00 
+  803014:	48 0f 45 c2          	cmovne %rdx,%rax
+  803018:	48 89 c3             	mov    %rax,%rbx
+  80301b:	49 be 0c 17 80 00 00 	movabs $0x80170c,%r14
+  803022:	00 00 00 
+        if (res != -E_IPC_NOT_RECV) {
+            panic("sys_ipc_try_send failed: %i", res);
+        }
+        sys_yield();
+  803025:	49 bf d7 12 80 00 00 	movabs $0x8012d7,%r15
+  80302c:	00 00 00 
+    while ((res = sys_ipc_try_send(to_env, val, !pg ? (void*)MAX_USER_ADDRESS : pg, size, perm)) < 0) {
+  80302f:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  803032:	44 8b 45 c8          	mov    -0x38(%rbp),%r8d
+  803036:	4c 89 e1             	mov    %r12,%rcx
+  803039:	48 89 da             	mov    %rbx,%rdx
+  80303c:	44 89 ef             	mov    %r13d,%edi
+  80303f:	41 ff d6             	call   *%r14
+  803042:	85 c0                	test   %eax,%eax
+  803044:	79 37                	jns    80307d <ipc_send+0x94>
+        if (res != -E_IPC_NOT_RECV) {
+  803046:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  803049:	75 05                	jne    803050 <ipc_send+0x67>
+        sys_yield();
+  80304b:	41 ff d7             	call   *%r15
+  80304e:	eb df                	jmp    80302f <ipc_send+0x46>
+            panic("sys_ipc_try_send failed: %i", res);
+  803050:	89 c1                	mov    %eax,%ecx
+  803052:	48 ba 76 38 80 00 00 	movabs $0x803876,%rdx
+  803059:	00 00 00 
+  80305c:	be 40 00 00 00       	mov    $0x40,%esi
+  803061:	48 bf 92 38 80 00 00 	movabs $0x803892,%rdi
+  803068:	00 00 00 
+  80306b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803070:	49 b8 41 03 80 00 00 	movabs $0x800341,%r8
+  803077:	00 00 00 
+  80307a:	41 ff d0             	call   *%r8
+    }
+    return;
+}
+  80307d:	48 83 c4 18          	add    $0x18,%rsp
+  803081:	5b                   	pop    %rbx
+  803082:	41 5c                	pop    %r12
+  803084:	41 5d                	pop    %r13
+  803086:	41 5e                	pop    %r14
+  803088:	41 5f                	pop    %r15
+  80308a:	5d                   	pop    %rbp
+  80308b:	c3                   	ret
+
+000000000080308c <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  80308c:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  803091:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  803098:	00 00 00 
+  80309b:	48 69 d0 d0 01 00 00 	imul   $0x1d0,%rax,%rdx
+  8030a2:	48 01 ca             	add    %rcx,%rdx
+  8030a5:	8b 92 e8 00 00 00    	mov    0xe8(%rdx),%edx
+  8030ab:	39 fa                	cmp    %edi,%edx
+  8030ad:	74 12                	je     8030c1 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  8030af:	48 83 c0 01          	add    $0x1,%rax
+  8030b3:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  8030b9:	75 e0                	jne    80309b <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  8030bb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8030c0:	c3                   	ret
+            return envs[i].env_id;
+  8030c1:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+  8030c8:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8030cf:	00 00 00 
+  8030d2:	48 01 d0             	add    %rdx,%rax
+  8030d5:	8b 80 e0 00 00 00    	mov    0xe0(%rax),%eax
+  8030db:	c3                   	ret
+  8030dc:	0f 1f 40 00          	nopl   0x0(%rax)
+
+00000000008030e0 <__rodata_start>:
+  8030e0:	73 79                	jae    80315b <__rodata_start+0x7b>
+  8030e2:	73 5f                	jae    803143 <__rodata_start+0x63>
+  8030e4:	65 78 6f             	gs js  803156 <__rodata_start+0x76>
+  8030e7:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  8030e9:	72 6b                	jb     803156 <__rodata_start+0x76>
+  8030eb:	3a 20                	cmp    (%rax),%ah
+  8030ed:	25 69 00 75 73       	and    $0x73750069,%eax
+  8030f2:	65 72 2f             	gs jb  803124 <__rodata_start+0x44>
+  8030f5:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  8030f7:	72 6b                	jb     803164 <__rodata_start+0x84>
+  8030f9:	65 78 69             	gs js  803165 <__rodata_start+0x85>
+  8030fc:	74 2e                	je     80312c <__rodata_start+0x4c>
+  8030fe:	63 00                	movsxd (%rax),%eax
+  803100:	73 79                	jae    80317b <__rodata_start+0x9b>
+  803102:	73 5f                	jae    803163 <__rodata_start+0x83>
+  803104:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803106:	76 5f                	jbe    803167 <__rodata_start+0x87>
+  803108:	64 65 73 74          	fs gs jae 803180 <__rodata_start+0xa0>
+  80310c:	72 6f                	jb     80317d <__rodata_start+0x9d>
+  80310e:	79 3a                	jns    80314a <__rodata_start+0x6a>
+  803110:	20 25 69 00 0f 1f    	and    %ah,0x1f0f0069(%rip)        # 1f8f317f <__bss_end+0x1f0eb17f>
+  803116:	40 00 66 6f          	add    %spl,0x6f(%rsi)
+  80311a:	72 6b                	jb     803187 <__rodata_start+0xa7>
+  80311c:	65 78 69             	gs js  803188 <__rodata_start+0xa8>
+  80311f:	74 3a                	je     80315b <__rodata_start+0x7b>
+  803121:	20 65 78             	and    %ah,0x78(%rbp)
+  803124:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803125:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  803127:	72 6b                	jb     803194 <__rodata_start+0xb4>
+  803129:	20 25 6c 75 20 63    	and    %ah,0x6320756c(%rip)        # 63a0a69b <__bss_end+0x6320269b>
+  80312f:	79 63                	jns    803194 <__rodata_start+0xb4>
+  803131:	6c                   	insb   (%dx),%es:(%rdi)
+  803132:	65 73 2c             	gs jae 803161 <__rodata_start+0x81>
+  803135:	20 64 65 73          	and    %ah,0x73(%rbp,%riz,2)
+  803139:	74 72                	je     8031ad <__rodata_start+0xcd>
+  80313b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80313c:	79 20                	jns    80315e <__rodata_start+0x7e>
+  80313e:	25 6c 75 20 63       	and    $0x6320756c,%eax
+  803143:	79 63                	jns    8031a8 <__rodata_start+0xc8>
+  803145:	6c                   	insb   (%dx),%es:(%rdi)
+  803146:	65 73 2c             	gs jae 803175 <__rodata_start+0x95>
+  803149:	20 66 6f             	and    %ah,0x6f(%rsi)
+  80314c:	72 6b                	jb     8031b9 <__rodata_start+0xd9>
+  80314e:	2b 65 78             	sub    0x78(%rbp),%esp
+  803151:	69 74 2b 77 61 69 74 	imul   $0x20746961,0x77(%rbx,%rbp,1),%esi
+  803158:	20 
+  803159:	25 6c 75 20 63       	and    $0x6320756c,%eax
+  80315e:	79 63                	jns    8031c3 <__rodata_start+0xe3>
+  803160:	6c                   	insb   (%dx),%es:(%rdi)
+  803161:	65 73 0a             	gs jae 80316e <__rodata_start+0x8e>
+  803164:	00 3c 75 6e 6b 6e 6f 	add    %bh,0x6f6e6b6e(,%rsi,2)
+  80316b:	77 6e                	ja     8031db <__rodata_start+0xfb>
+  80316d:	3e 00 90 5b 25 30 38 	ds add %dl,0x3830255b(%rax)
+  803174:	78 5d                	js     8031d3 <__rodata_start+0xf3>
+  803176:	20 75 73             	and    %dh,0x73(%rbp)
+  803179:	65 72 20             	gs jb  80319c <__rodata_start+0xbc>
+  80317c:	70 61                	jo     8031df <__rodata_start+0xff>
+  80317e:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80317f:	69 63 20 69 6e 20 25 	imul   $0x25206e69,0x20(%rbx),%esp
+  803186:	73 20                	jae    8031a8 <__rodata_start+0xc8>
+  803188:	61                   	(bad)
+  803189:	74 20                	je     8031ab <__rodata_start+0xcb>
+  80318b:	25 73 3a 25 64       	and    $0x64253a73,%eax
+  803190:	3a 20                	cmp    (%rax),%ah
+  803192:	00 30                	add    %dh,(%rax)
+  803194:	31 32                	xor    %esi,(%rdx)
+  803196:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  80319d:	41                   	rex.B
+  80319e:	42                   	rex.X
+  80319f:	43                   	rex.XB
+  8031a0:	44                   	rex.R
+  8031a1:	45                   	rex.RB
+  8031a2:	46 00 30             	rex.RX add %r14b,(%rax)
+  8031a5:	31 32                	xor    %esi,(%rdx)
+  8031a7:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  8031ae:	61                   	(bad)
+  8031af:	62 63 64 65 66       	(bad)
+  8031b4:	00 28                	add    %ch,(%rax)
+  8031b6:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8031b7:	75 6c                	jne    803225 <__rodata_start+0x145>
+  8031b9:	6c                   	insb   (%dx),%es:(%rdi)
+  8031ba:	29 00                	sub    %eax,(%rax)
+  8031bc:	65 72 72             	gs jb  803231 <__rodata_start+0x151>
+  8031bf:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8031c0:	72 20                	jb     8031e2 <__rodata_start+0x102>
+  8031c2:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  8031c7:	73 70                	jae    803239 <__rodata_start+0x159>
+  8031c9:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  8031cd:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  8031d4:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8031d5:	72 00                	jb     8031d7 <__rodata_start+0xf7>
+  8031d7:	62 61 64 20 65       	(bad)
+  8031dc:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8031dd:	76 69                	jbe    803248 <__rodata_start+0x168>
+  8031df:	72 6f                	jb     803250 <__rodata_start+0x170>
+  8031e1:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8031e2:	6d                   	insl   (%dx),%es:(%rdi)
+  8031e3:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  8031e5:	74 00                	je     8031e7 <__rodata_start+0x107>
+  8031e7:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  8031ee:	20 70 61             	and    %dh,0x61(%rax)
+  8031f1:	72 61                	jb     803254 <__rodata_start+0x174>
+  8031f3:	6d                   	insl   (%dx),%es:(%rdi)
+  8031f4:	65 74 65             	gs je  80325c <__rodata_start+0x17c>
+  8031f7:	72 00                	jb     8031f9 <__rodata_start+0x119>
+  8031f9:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8031fa:	75 74                	jne    803270 <__rodata_start+0x190>
+  8031fc:	20 6f 66             	and    %ch,0x66(%rdi)
+  8031ff:	20 6d 65             	and    %ch,0x65(%rbp)
+  803202:	6d                   	insl   (%dx),%es:(%rdi)
+  803203:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803204:	72 79                	jb     80327f <__rodata_start+0x19f>
+  803206:	00 6f 75             	add    %ch,0x75(%rdi)
+  803209:	74 20                	je     80322b <__rodata_start+0x14b>
+  80320b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80320c:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  803210:	76 69                	jbe    80327b <__rodata_start+0x19b>
+  803212:	72 6f                	jb     803283 <__rodata_start+0x1a3>
+  803214:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803215:	6d                   	insl   (%dx),%es:(%rdi)
+  803216:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803218:	74 73                	je     80328d <__rodata_start+0x1ad>
+  80321a:	00 63 6f             	add    %ah,0x6f(%rbx)
+  80321d:	72 72                	jb     803291 <__rodata_start+0x1b1>
+  80321f:	75 70                	jne    803291 <__rodata_start+0x1b1>
+  803221:	74 65                	je     803288 <__rodata_start+0x1a8>
+  803223:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  803228:	75 67                	jne    803291 <__rodata_start+0x1b1>
+  80322a:	20 69 6e             	and    %ch,0x6e(%rcx)
+  80322d:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  80322f:	00 73 65             	add    %dh,0x65(%rbx)
+  803232:	67 6d                	insl   (%dx),%es:(%edi)
+  803234:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803236:	74 61                	je     803299 <__rodata_start+0x1b9>
+  803238:	74 69                	je     8032a3 <__rodata_start+0x1c3>
+  80323a:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80323b:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80323c:	20 66 61             	and    %ah,0x61(%rsi)
+  80323f:	75 6c                	jne    8032ad <__rodata_start+0x1cd>
+  803241:	74 00                	je     803243 <__rodata_start+0x163>
+  803243:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  80324a:	20 45 4c             	and    %al,0x4c(%rbp)
+  80324d:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  803251:	61                   	(bad)
+  803252:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  803257:	20 73 75             	and    %dh,0x75(%rbx)
+  80325a:	63 68 20             	movsxd 0x20(%rax),%ebp
+  80325d:	73 79                	jae    8032d8 <__rodata_start+0x1f8>
+  80325f:	73 74                	jae    8032d5 <__rodata_start+0x1f5>
+  803261:	65 6d                	gs insl (%dx),%es:(%rdi)
+  803263:	20 63 61             	and    %ah,0x61(%rbx)
+  803266:	6c                   	insb   (%dx),%es:(%rdi)
+  803267:	6c                   	insb   (%dx),%es:(%rdi)
+  803268:	00 65 6e             	add    %ah,0x6e(%rbp)
+  80326b:	74 72                	je     8032df <__rodata_start+0x1ff>
+  80326d:	79 20                	jns    80328f <__rodata_start+0x1af>
+  80326f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803270:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803271:	74 20                	je     803293 <__rodata_start+0x1b3>
+  803273:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  803275:	75 6e                	jne    8032e5 <__rodata_start+0x205>
+  803277:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  80327b:	76 20                	jbe    80329d <__rodata_start+0x1bd>
+  80327d:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  803284:	72 65                	jb     8032eb <__rodata_start+0x20b>
+  803286:	63 76 69             	movsxd 0x69(%rsi),%esi
+  803289:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80328a:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  80328e:	65 78 70             	gs js  803301 <__rodata_start+0x221>
+  803291:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  803296:	20 65 6e             	and    %ah,0x6e(%rbp)
+  803299:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  80329d:	20 66 69             	and    %ah,0x69(%rsi)
+  8032a0:	6c                   	insb   (%dx),%es:(%rdi)
+  8032a1:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  8032a5:	20 66 72             	and    %ah,0x72(%rsi)
+  8032a8:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  8032ad:	61                   	(bad)
+  8032ae:	63 65 20             	movsxd 0x20(%rbp),%esp
+  8032b1:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8032b2:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8032b3:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  8032b7:	6b 00 74             	imul   $0x74,(%rax),%eax
+  8032ba:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8032bb:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8032bc:	20 6d 61             	and    %ch,0x61(%rbp)
+  8032bf:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8032c0:	79 20                	jns    8032e2 <__rodata_start+0x202>
+  8032c2:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  8032c9:	72 65                	jb     803330 <__rodata_start+0x250>
+  8032cb:	20 6f 70             	and    %ch,0x70(%rdi)
+  8032ce:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  8032d0:	00 66 69             	add    %ah,0x69(%rsi)
+  8032d3:	6c                   	insb   (%dx),%es:(%rdi)
+  8032d4:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  8032d8:	20 62 6c             	and    %ah,0x6c(%rdx)
+  8032db:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8032dc:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  8032df:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8032e0:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8032e1:	74 20                	je     803303 <__rodata_start+0x223>
+  8032e3:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  8032e5:	75 6e                	jne    803355 <__rodata_start+0x275>
+  8032e7:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  8032eb:	76 61                	jbe    80334e <__rodata_start+0x26e>
+  8032ed:	6c                   	insb   (%dx),%es:(%rdi)
+  8032ee:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  8032f5:	00 
+  8032f6:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  8032fd:	72 65                	jb     803364 <__rodata_start+0x284>
+  8032ff:	61                   	(bad)
+  803300:	64 79 20             	fs jns 803323 <__rodata_start+0x243>
+  803303:	65 78 69             	gs js  80336f <__rodata_start+0x28f>
+  803306:	73 74                	jae    80337c <__rodata_start+0x29c>
+  803308:	73 00                	jae    80330a <__rodata_start+0x22a>
+  80330a:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80330b:	70 65                	jo     803372 <__rodata_start+0x292>
+  80330d:	72 61                	jb     803370 <__rodata_start+0x290>
+  80330f:	74 69                	je     80337a <__rodata_start+0x29a>
+  803311:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803312:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803313:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  803316:	74 20                	je     803338 <__rodata_start+0x258>
+  803318:	73 75                	jae    80338f <__rodata_start+0x2af>
+  80331a:	70 70                	jo     80338c <__rodata_start+0x2ac>
+  80331c:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80331d:	72 74                	jb     803393 <__rodata_start+0x2b3>
+  80331f:	65 64 00 6f 70       	gs add %ch,%fs:0x70(%rdi)
+  803324:	65 72 61             	gs jb  803388 <__rodata_start+0x2a8>
+  803327:	74 69                	je     803392 <__rodata_start+0x2b2>
+  803329:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80332a:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80332b:	20 69 6e             	and    %ch,0x6e(%rcx)
+  80332e:	74 65                	je     803395 <__rodata_start+0x2b5>
+  803330:	72 72                	jb     8033a4 <__rodata_start+0x2c4>
+  803332:	75 70                	jne    8033a4 <__rodata_start+0x2c4>
+  803334:	74 65                	je     80339b <__rodata_start+0x2bb>
+  803336:	64 00 6e 6f          	add    %ch,%fs:0x6f(%rsi)
+  80333a:	74 20                	je     80335c <__rodata_start+0x27c>
+  80333c:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  80333e:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80333f:	75 67                	jne    8033a8 <__rodata_start+0x2c8>
+  803341:	68 20 43 50 55       	push   $0x55504320
+  803346:	20 74 69 6d          	and    %dh,0x6d(%rcx,%rbp,2)
+  80334a:	65 00 66 2e          	add    %ah,%gs:0x2e(%rsi)
+  80334e:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+  803355:	00 
+  803356:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80335d:	00 00 00 
+  803360:	7e 06                	jle    803368 <__rodata_start+0x288>
+  803362:	80 00 00             	addb   $0x0,(%rax)
+  803365:	00 00                	add    %al,(%rax)
+  803367:	00 bf 0c 80 00 00    	add    %bh,0x800c(%rdi)
+  80336d:	00 00                	add    %al,(%rax)
+  80336f:	00 af 0c 80 00 00    	add    %ch,0x800c(%rdi)
+  803375:	00 00                	add    %al,(%rax)
+  803377:	00 bf 0c 80 00 00    	add    %bh,0x800c(%rdi)
+  80337d:	00 00                	add    %al,(%rax)
+  80337f:	00 bf 0c 80 00 00    	add    %bh,0x800c(%rdi)
+  803385:	00 00                	add    %al,(%rax)
+  803387:	00 bf 0c 80 00 00    	add    %bh,0x800c(%rdi)
+  80338d:	00 00                	add    %al,(%rax)
+  80338f:	00 bf 0c 80 00 00    	add    %bh,0x800c(%rdi)
+  803395:	00 00                	add    %al,(%rax)
+  803397:	00 9d 06 80 00 00    	add    %bl,0x8006(%rbp)
+  80339d:	00 00                	add    %al,(%rax)
+  80339f:	00 bf 0c 80 00 00    	add    %bh,0x800c(%rdi)
+  8033a5:	00 00                	add    %al,(%rax)
+  8033a7:	00 bf 0c 80 00 00    	add    %bh,0x800c(%rdi)
+  8033ad:	00 00                	add    %al,(%rax)
+  8033af:	00 91 06 80 00 00    	add    %dl,0x8006(%rcx)
+  8033b5:	00 00                	add    %al,(%rax)
+  8033b7:	00 0b                	add    %cl,(%rbx)
+  8033b9:	07                   	(bad)
+  8033ba:	80 00 00             	addb   $0x0,(%rax)
+  8033bd:	00 00                	add    %al,(%rax)
+  8033bf:	00 bf 0c 80 00 00    	add    %bh,0x800c(%rdi)
+  8033c5:	00 00                	add    %al,(%rax)
+  8033c7:	00 91 06 80 00 00    	add    %dl,0x8006(%rcx)
+  8033cd:	00 00                	add    %al,(%rax)
+  8033cf:	00 d7                	add    %dl,%bh
+  8033d1:	06                   	(bad)
+  8033d2:	80 00 00             	addb   $0x0,(%rax)
+  8033d5:	00 00                	add    %al,(%rax)
+  8033d7:	00 d7                	add    %dl,%bh
+  8033d9:	06                   	(bad)
+  8033da:	80 00 00             	addb   $0x0,(%rax)
+  8033dd:	00 00                	add    %al,(%rax)
+  8033df:	00 d7                	add    %dl,%bh
+  8033e1:	06                   	(bad)
+  8033e2:	80 00 00             	addb   $0x0,(%rax)
+  8033e5:	00 00                	add    %al,(%rax)
+  8033e7:	00 d7                	add    %dl,%bh
+  8033e9:	06                   	(bad)
+  8033ea:	80 00 00             	addb   $0x0,(%rax)
+  8033ed:	00 00                	add    %al,(%rax)
+  8033ef:	00 d7                	add    %dl,%bh
+  8033f1:	06                   	(bad)
+  8033f2:	80 00 00             	addb   $0x0,(%rax)
+  8033f5:	00 00                	add    %al,(%rax)
+  8033f7:	00 d7                	add    %dl,%bh
+  8033f9:	06                   	(bad)
+  8033fa:	80 00 00             	addb   $0x0,(%rax)
+  8033fd:	00 00                	add    %al,(%rax)
+  8033ff:	00 d7                	add    %dl,%bh
+  803401:	06                   	(bad)
+  803402:	80 00 00             	addb   $0x0,(%rax)
+  803405:	00 00                	add    %al,(%rax)
+  803407:	00 d7                	add    %dl,%bh
+  803409:	06                   	(bad)
+  80340a:	80 00 00             	addb   $0x0,(%rax)
+  80340d:	00 00                	add    %al,(%rax)
+  80340f:	00 d7                	add    %dl,%bh
+  803411:	06                   	(bad)
+  803412:	80 00 00             	addb   $0x0,(%rax)
+  803415:	00 00                	add    %al,(%rax)
+  803417:	00 bf 0c 80 00 00    	add    %bh,0x800c(%rdi)
+  80341d:	00 00                	add    %al,(%rax)
+  80341f:	00 bf 0c 80 00 00    	add    %bh,0x800c(%rdi)
+  803425:	00 00                	add    %al,(%rax)
+  803427:	00 bf 0c 80 00 00    	add    %bh,0x800c(%rdi)
+  80342d:	00 00                	add    %al,(%rax)
+  80342f:	00 bf 0c 80 00 00    	add    %bh,0x800c(%rdi)
+  803435:	00 00                	add    %al,(%rax)
+  803437:	00 bf 0c 80 00 00    	add    %bh,0x800c(%rdi)
+  80343d:	00 00                	add    %al,(%rax)
+  80343f:	00 bf 0c 80 00 00    	add    %bh,0x800c(%rdi)
+  803445:	00 00                	add    %al,(%rax)
+  803447:	00 bf 0c 80 00 00    	add    %bh,0x800c(%rdi)
+  80344d:	00 00                	add    %al,(%rax)
+  80344f:	00 bf 0c 80 00 00    	add    %bh,0x800c(%rdi)
+  803455:	00 00                	add    %al,(%rax)
+  803457:	00 bf 0c 80 00 00    	add    %bh,0x800c(%rdi)
+  80345d:	00 00                	add    %al,(%rax)
+  80345f:	00 bf 0c 80 00 00    	add    %bh,0x800c(%rdi)
+  803465:	00 00                	add    %al,(%rax)
+  803467:	00 bf 0c 80 00 00    	add    %bh,0x800c(%rdi)
+  80346d:	00 00                	add    %al,(%rax)
+  80346f:	00 bf 0c 80 00 00    	add    %bh,0x800c(%rdi)
+  803475:	00 00                	add    %al,(%rax)
+  803477:	00 bf 0c 80 00 00    	add    %bh,0x800c(%rdi)
+  80347d:	00 00                	add    %al,(%rax)
+  80347f:	00 bf 0c 80 00 00    	add    %bh,0x800c(%rdi)
+  803485:	00 00                	add    %al,(%rax)
+  803487:	00 bf 0c 80 00 00    	add    %bh,0x800c(%rdi)
+  80348d:	00 00                	add    %al,(%rax)
+  80348f:	00 bf 0c 80 00 00    	add    %bh,0x800c(%rdi)
+  803495:	00 00                	add    %al,(%rax)
+  803497:	00 bf 0c 80 00 00    	add    %bh,0x800c(%rdi)
+  80349d:	00 00                	add    %al,(%rax)
+  80349f:	00 bf 0c 80 00 00    	add    %bh,0x800c(%rdi)
+  8034a5:	00 00                	add    %al,(%rax)
+  8034a7:	00 bf 0c 80 00 00    	add    %bh,0x800c(%rdi)
+  8034ad:	00 00                	add    %al,(%rax)
+  8034af:	00 bf 0c 80 00 00    	add    %bh,0x800c(%rdi)
+  8034b5:	00 00                	add    %al,(%rax)
+  8034b7:	00 bf 0c 80 00 00    	add    %bh,0x800c(%rdi)
+  8034bd:	00 00                	add    %al,(%rax)
+  8034bf:	00 bf 0c 80 00 00    	add    %bh,0x800c(%rdi)
+  8034c5:	00 00                	add    %al,(%rax)
+  8034c7:	00 bf 0c 80 00 00    	add    %bh,0x800c(%rdi)
+  8034cd:	00 00                	add    %al,(%rax)
+  8034cf:	00 bf 0c 80 00 00    	add    %bh,0x800c(%rdi)
+  8034d5:	00 00                	add    %al,(%rax)
+  8034d7:	00 bf 0c 80 00 00    	add    %bh,0x800c(%rdi)
+  8034dd:	00 00                	add    %al,(%rax)
+  8034df:	00 bf 0c 80 00 00    	add    %bh,0x800c(%rdi)
+  8034e5:	00 00                	add    %al,(%rax)
+  8034e7:	00 bf 0c 80 00 00    	add    %bh,0x800c(%rdi)
+  8034ed:	00 00                	add    %al,(%rax)
+  8034ef:	00 bf 0c 80 00 00    	add    %bh,0x800c(%rdi)
+  8034f5:	00 00                	add    %al,(%rax)
+  8034f7:	00 bf 0c 80 00 00    	add    %bh,0x800c(%rdi)
+  8034fd:	00 00                	add    %al,(%rax)
+  8034ff:	00 bf 0c 80 00 00    	add    %bh,0x800c(%rdi)
+  803505:	00 00                	add    %al,(%rax)
+  803507:	00 e2                	add    %ah,%dl
+  803509:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  80350f:	00 bf 0c 80 00 00    	add    %bh,0x800c(%rdi)
+  803515:	00 00                	add    %al,(%rax)
+  803517:	00 bf 0c 80 00 00    	add    %bh,0x800c(%rdi)
+  80351d:	00 00                	add    %al,(%rax)
+  80351f:	00 bf 0c 80 00 00    	add    %bh,0x800c(%rdi)
+  803525:	00 00                	add    %al,(%rax)
+  803527:	00 bf 0c 80 00 00    	add    %bh,0x800c(%rdi)
+  80352d:	00 00                	add    %al,(%rax)
+  80352f:	00 bf 0c 80 00 00    	add    %bh,0x800c(%rdi)
+  803535:	00 00                	add    %al,(%rax)
+  803537:	00 bf 0c 80 00 00    	add    %bh,0x800c(%rdi)
+  80353d:	00 00                	add    %al,(%rax)
+  80353f:	00 bf 0c 80 00 00    	add    %bh,0x800c(%rdi)
+  803545:	00 00                	add    %al,(%rax)
+  803547:	00 bf 0c 80 00 00    	add    %bh,0x800c(%rdi)
+  80354d:	00 00                	add    %al,(%rax)
+  80354f:	00 bf 0c 80 00 00    	add    %bh,0x800c(%rdi)
+  803555:	00 00                	add    %al,(%rax)
+  803557:	00 bf 0c 80 00 00    	add    %bh,0x800c(%rdi)
+  80355d:	00 00                	add    %al,(%rax)
+  80355f:	00 2e                	add    %ch,(%rsi)
+  803561:	07                   	(bad)
+  803562:	80 00 00             	addb   $0x0,(%rax)
+  803565:	00 00                	add    %al,(%rax)
+  803567:	00 fd                	add    %bh,%ch
+  803569:	08 80 00 00 00 00    	or     %al,0x0(%rax)
+  80356f:	00 bf 0c 80 00 00    	add    %bh,0x800c(%rdi)
+  803575:	00 00                	add    %al,(%rax)
+  803577:	00 bf 0c 80 00 00    	add    %bh,0x800c(%rdi)
+  80357d:	00 00                	add    %al,(%rax)
+  80357f:	00 bf 0c 80 00 00    	add    %bh,0x800c(%rdi)
+  803585:	00 00                	add    %al,(%rax)
+  803587:	00 bf 0c 80 00 00    	add    %bh,0x800c(%rdi)
+  80358d:	00 00                	add    %al,(%rax)
+  80358f:	00 5d 07             	add    %bl,0x7(%rbp)
+  803592:	80 00 00             	addb   $0x0,(%rax)
+  803595:	00 00                	add    %al,(%rax)
+  803597:	00 bf 0c 80 00 00    	add    %bh,0x800c(%rdi)
+  80359d:	00 00                	add    %al,(%rax)
+  80359f:	00 bf 0c 80 00 00    	add    %bh,0x800c(%rdi)
+  8035a5:	00 00                	add    %al,(%rax)
+  8035a7:	00 23                	add    %ah,(%rbx)
+  8035a9:	07                   	(bad)
+  8035aa:	80 00 00             	addb   $0x0,(%rax)
+  8035ad:	00 00                	add    %al,(%rax)
+  8035af:	00 bf 0c 80 00 00    	add    %bh,0x800c(%rdi)
+  8035b5:	00 00                	add    %al,(%rax)
+  8035b7:	00 bf 0c 80 00 00    	add    %bh,0x800c(%rdi)
+  8035bd:	00 00                	add    %al,(%rax)
+  8035bf:	00 a5 0a 80 00 00    	add    %ah,0x800a(%rbp)
+  8035c5:	00 00                	add    %al,(%rax)
+  8035c7:	00 6f 0b             	add    %ch,0xb(%rdi)
+  8035ca:	80 00 00             	addb   $0x0,(%rax)
+  8035cd:	00 00                	add    %al,(%rax)
+  8035cf:	00 bf 0c 80 00 00    	add    %bh,0x800c(%rdi)
+  8035d5:	00 00                	add    %al,(%rax)
+  8035d7:	00 bf 0c 80 00 00    	add    %bh,0x800c(%rdi)
+  8035dd:	00 00                	add    %al,(%rax)
+  8035df:	00 f4                	add    %dh,%ah
+  8035e1:	07                   	(bad)
+  8035e2:	80 00 00             	addb   $0x0,(%rax)
+  8035e5:	00 00                	add    %al,(%rax)
+  8035e7:	00 bf 0c 80 00 00    	add    %bh,0x800c(%rdi)
+  8035ed:	00 00                	add    %al,(%rax)
+  8035ef:	00 d1                	add    %dl,%cl
+  8035f1:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  8035f7:	00 bf 0c 80 00 00    	add    %bh,0x800c(%rdi)
+  8035fd:	00 00                	add    %al,(%rax)
+  8035ff:	00 bf 0c 80 00 00    	add    %bh,0x800c(%rdi)
+  803605:	00 00                	add    %al,(%rax)
+  803607:	00 e2                	add    %ah,%dl
+  803609:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  80360f:	00 bf 0c 80 00 00    	add    %bh,0x800c(%rdi)
+  803615:	00 00                	add    %al,(%rax)
+  803617:	00 87 06 80 00 00    	add    %al,0x8006(%rdi)
+  80361d:	00 00                	add    %al,(%rax)
+	...
+
+0000000000803620 <error_string>:
+	...
+  803628:	c5 31 80 00 00 00 00 00 d7 31 80 00 00 00 00 00     .1.......1......
+  803638:	e7 31 80 00 00 00 00 00 f9 31 80 00 00 00 00 00     .1.......1......
+  803648:	07 32 80 00 00 00 00 00 1b 32 80 00 00 00 00 00     .2.......2......
+  803658:	30 32 80 00 00 00 00 00 43 32 80 00 00 00 00 00     02......C2......
+  803668:	55 32 80 00 00 00 00 00 69 32 80 00 00 00 00 00     U2......i2......
+  803678:	79 32 80 00 00 00 00 00 8c 32 80 00 00 00 00 00     y2.......2......
+  803688:	a3 32 80 00 00 00 00 00 b9 32 80 00 00 00 00 00     .2.......2......
+  803698:	d1 32 80 00 00 00 00 00 e9 32 80 00 00 00 00 00     .2.......2......
+  8036a8:	f6 32 80 00 00 00 00 00 d0 36 80 00 00 00 00 00     .2.......6......
+  8036b8:	0a 33 80 00 00 00 00 00 22 33 80 00 00 00 00 00     .3......"3......
+  8036c8:	38 33 80 00 00 00 00 00 66 69 6c 65 20 69 73 20     83......file is 
+  8036d8:	6e 6f 74 20 61 20 76 61 6c 69 64 20 65 78 65 63     not a valid exec
+  8036e8:	75 74 61 62 6c 65 00 90 73 79 73 63 61 6c 6c 20     utable..syscall 
+  8036f8:	25 7a 64 20 72 65 74 75 72 6e 65 64 20 25 7a 64     %zd returned %zd
+  803708:	20 28 3e 20 30 29 00 6c 69 62 2f 73 79 73 63 61      (> 0).lib/sysca
+  803718:	6c 6c 2e 63 00 46 6f 72 6b 20 64 6f 75 62 6c 65     ll.c.Fork double
+  803728:	20 66 61 75 6c 74 00 6c 69 62 2f 66 6f 72 6b 2e      fault.lib/fork.
+  803738:	63 00 73 66 6f 72 6b 28 29 20 69 73 20 6e 6f 74     c.sfork() is not
+  803748:	20 69 6d 70 6c 65 6d 65 6e 74 65 64 00 0f 1f 00      implemented....
+  803758:	5b 25 30 38 78 5d 20 75 6e 6b 6e 6f 77 6e 20 64     [%08x] unknown d
+  803768:	65 76 69 63 65 20 74 79 70 65 20 25 64 0a 00 00     evice type %d...
+  803778:	5b 25 30 38 78 5d 20 66 74 72 75 6e 63 61 74 65     [%08x] ftruncate
+  803788:	20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65 0a      %d -- bad mode.
+  803798:	00 5b 25 30 38 78 5d 20 72 65 61 64 20 25 64 20     .[%08x] read %d 
+  8037a8:	2d 2d 20 62 61 64 20 6d 6f 64 65 0a 00 5b 25 30     -- bad mode..[%0
+  8037b8:	38 78 5d 20 77 72 69 74 65 20 25 64 20 2d 2d 20     8x] write %d -- 
+  8037c8:	62 61 64 20 6d 6f 64 65 0a 00 66 2e 0f 1f 84 00     bad mode..f.....
+  8037d8:	00 00 00 00 0f 1f 40 00                             ......@.
+
+00000000008037e0 <devtab>:
+  8037e0:	20 40 80 00 00 00 00 00 60 40 80 00 00 00 00 00      @......`@......
+  8037f0:	a0 40 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .@..............
+  803800:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  803810:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  803820:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  803830:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  803840:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  803850:	3d 20 32 00 65 6e 76 69 64 20 21 3d 20 30 00 6c     = 2.envid != 0.l
+  803860:	69 62 2f 77 61 69 74 2e 63 00 3c 63 6f 6e 73 3e     ib/wait.c.<cons>
+  803870:	00 63 6f 6e 73 00 73 79 73 5f 69 70 63 5f 74 72     .cons.sys_ipc_tr
+  803880:	79 5f 73 65 6e 64 20 66 61 69 6c 65 64 3a 20 25     y_send failed: %
+  803890:	69 00 6c 69 62 2f 69 70 63 2e 63 00 66 2e 0f 1f     i.lib/ipc.c.f...
+  8038a0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8038b0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8038c0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8038d0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8038e0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8038f0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803900:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803910:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803920:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803930:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803940:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803950:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803960:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803970:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803980:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803990:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8039a0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8039b0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8039c0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8039d0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8039e0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8039f0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803a00:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803a10:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803a20:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803a30:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803a40:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803a50:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803a60:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803a70:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803a80:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803a90:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803aa0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803ab0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803ac0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803ad0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803ae0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803af0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803b00:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803b10:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803b20:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803b30:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803b40:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803b50:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803b60:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803b70:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803b80:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803b90:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803ba0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803bb0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803bc0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803bd0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803be0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803bf0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803c00:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803c10:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803c20:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803c30:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803c40:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803c50:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803c60:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803c70:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803c80:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803c90:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803ca0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803cb0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803cc0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803cd0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803ce0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803cf0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803d00:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803d10:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803d20:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803d30:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803d40:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803d50:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803d60:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803d70:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803d80:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803d90:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803da0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803db0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803dc0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803dd0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803de0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803df0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803e00:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803e10:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803e20:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803e30:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803e40:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803e50:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803e60:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803e70:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803e80:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803e90:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803ea0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803eb0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803ec0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803ed0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803ee0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803ef0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803f00:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803f10:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803f20:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803f30:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803f40:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803f50:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803f60:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803f70:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803f80:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803f90:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803fa0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803fb0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803fc0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803fd0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803fe0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803ff0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 90     ....f.........f.
@@ -0,0 +1,5915 @@
+
+obj/user/forktree:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 ff 00 00 00       	call   800122 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <forktree>:
+        exit();
+    }
+}
+
+void
+forktree(const char *cur) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 54                	push   %r12
+  80002b:	53                   	push   %rbx
+  80002c:	48 89 fb             	mov    %rdi,%rbx
+    cprintf("%04x: I am '%s'\n", sys_getenvid(), cur);
+  80002f:	48 b8 b0 10 80 00 00 	movabs $0x8010b0,%rax
+  800036:	00 00 00 
+  800039:	ff d0                	call   *%rax
+  80003b:	89 c6                	mov    %eax,%esi
+  80003d:	48 89 da             	mov    %rbx,%rdx
+  800040:	48 bf d0 2e 80 00 00 	movabs $0x802ed0,%rdi
+  800047:	00 00 00 
+  80004a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80004f:	48 b9 9b 02 80 00 00 	movabs $0x80029b,%rcx
+  800056:	00 00 00 
+  800059:	ff d1                	call   *%rcx
+
+    forkchild(cur, '0');
+  80005b:	be 30 00 00 00       	mov    $0x30,%esi
+  800060:	48 89 df             	mov    %rbx,%rdi
+  800063:	49 bc 80 00 80 00 00 	movabs $0x800080,%r12
+  80006a:	00 00 00 
+  80006d:	41 ff d4             	call   *%r12
+    forkchild(cur, '1');
+  800070:	be 31 00 00 00       	mov    $0x31,%esi
+  800075:	48 89 df             	mov    %rbx,%rdi
+  800078:	41 ff d4             	call   *%r12
+}
+  80007b:	5b                   	pop    %rbx
+  80007c:	41 5c                	pop    %r12
+  80007e:	5d                   	pop    %rbp
+  80007f:	c3                   	ret
+
+0000000000800080 <forkchild>:
+forkchild(const char *cur, char branch) {
+  800080:	55                   	push   %rbp
+  800081:	48 89 e5             	mov    %rsp,%rbp
+  800084:	41 54                	push   %r12
+  800086:	53                   	push   %rbx
+  800087:	48 83 ec 10          	sub    $0x10,%rsp
+  80008b:	48 89 fb             	mov    %rdi,%rbx
+  80008e:	41 89 f4             	mov    %esi,%r12d
+    if (strlen(cur) >= DEPTH)
+  800091:	48 b8 82 0b 80 00 00 	movabs $0x800b82,%rax
+  800098:	00 00 00 
+  80009b:	ff d0                	call   *%rax
+  80009d:	48 83 f8 02          	cmp    $0x2,%rax
+  8000a1:	76 09                	jbe    8000ac <forkchild+0x2c>
+}
+  8000a3:	48 83 c4 10          	add    $0x10,%rsp
+  8000a7:	5b                   	pop    %rbx
+  8000a8:	41 5c                	pop    %r12
+  8000aa:	5d                   	pop    %rbp
+  8000ab:	c3                   	ret
+    snprintf(nxt, DEPTH + 1, "%s%c", cur, branch);
+  8000ac:	45 0f be c4          	movsbl %r12b,%r8d
+  8000b0:	48 89 d9             	mov    %rbx,%rcx
+  8000b3:	48 ba e1 2e 80 00 00 	movabs $0x802ee1,%rdx
+  8000ba:	00 00 00 
+  8000bd:	be 04 00 00 00       	mov    $0x4,%esi
+  8000c2:	48 8d 7d ec          	lea    -0x14(%rbp),%rdi
+  8000c6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000cb:	49 b9 45 0b 80 00 00 	movabs $0x800b45,%r9
+  8000d2:	00 00 00 
+  8000d5:	41 ff d1             	call   *%r9
+    if (fork() == 0) {
+  8000d8:	48 b8 ab 15 80 00 00 	movabs $0x8015ab,%rax
+  8000df:	00 00 00 
+  8000e2:	ff d0                	call   *%rax
+  8000e4:	85 c0                	test   %eax,%eax
+  8000e6:	75 bb                	jne    8000a3 <forkchild+0x23>
+        forktree(nxt);
+  8000e8:	48 8d 7d ec          	lea    -0x14(%rbp),%rdi
+  8000ec:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8000f3:	00 00 00 
+  8000f6:	ff d0                	call   *%rax
+        exit();
+  8000f8:	48 b8 cb 01 80 00 00 	movabs $0x8001cb,%rax
+  8000ff:	00 00 00 
+  800102:	ff d0                	call   *%rax
+  800104:	eb 9d                	jmp    8000a3 <forkchild+0x23>
+
+0000000000800106 <umain>:
+
+void
+umain(int argc, char **argv) {
+  800106:	55                   	push   %rbp
+  800107:	48 89 e5             	mov    %rsp,%rbp
+    forktree("");
+  80010a:	48 bf e0 2e 80 00 00 	movabs $0x802ee0,%rdi
+  800111:	00 00 00 
+  800114:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  80011b:	00 00 00 
+  80011e:	ff d0                	call   *%rax
+}
+  800120:	5d                   	pop    %rbp
+  800121:	c3                   	ret
+
+0000000000800122 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800122:	55                   	push   %rbp
+  800123:	48 89 e5             	mov    %rsp,%rbp
+  800126:	41 56                	push   %r14
+  800128:	41 55                	push   %r13
+  80012a:	41 54                	push   %r12
+  80012c:	53                   	push   %rbx
+  80012d:	41 89 fd             	mov    %edi,%r13d
+  800130:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800133:	48 ba d8 40 80 00 00 	movabs $0x8040d8,%rdx
+  80013a:	00 00 00 
+  80013d:	48 b8 d8 40 80 00 00 	movabs $0x8040d8,%rax
+  800144:	00 00 00 
+  800147:	48 39 c2             	cmp    %rax,%rdx
+  80014a:	73 17                	jae    800163 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  80014c:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  80014f:	49 89 c4             	mov    %rax,%r12
+  800152:	48 83 c3 08          	add    $0x8,%rbx
+  800156:	b8 00 00 00 00       	mov    $0x0,%eax
+  80015b:	ff 53 f8             	call   *-0x8(%rbx)
+  80015e:	4c 39 e3             	cmp    %r12,%rbx
+  800161:	72 ef                	jb     800152 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+    envid_t this_env_id = sys_getenvid();
+  800163:	48 b8 b0 10 80 00 00 	movabs $0x8010b0,%rax
+  80016a:	00 00 00 
+  80016d:	ff d0                	call   *%rax
+    thisenv = &((struct Env*)UENVS)[ENVX(this_env_id)];
+  80016f:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800174:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+  80017b:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  800182:	00 00 00 
+  800185:	48 01 d0             	add    %rdx,%rax
+  800188:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  80018f:	00 00 00 
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  800192:	45 85 ed             	test   %r13d,%r13d
+  800195:	7e 0d                	jle    8001a4 <libmain+0x82>
+  800197:	49 8b 06             	mov    (%r14),%rax
+  80019a:	48 a3 00 40 80 00 00 	movabs %rax,0x804000
+  8001a1:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8001a4:	4c 89 f6             	mov    %r14,%rsi
+  8001a7:	44 89 ef             	mov    %r13d,%edi
+  8001aa:	48 b8 06 01 80 00 00 	movabs $0x800106,%rax
+  8001b1:	00 00 00 
+  8001b4:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8001b6:	48 b8 cb 01 80 00 00 	movabs $0x8001cb,%rax
+  8001bd:	00 00 00 
+  8001c0:	ff d0                	call   *%rax
+#endif
+}
+  8001c2:	5b                   	pop    %rbx
+  8001c3:	41 5c                	pop    %r12
+  8001c5:	41 5d                	pop    %r13
+  8001c7:	41 5e                	pop    %r14
+  8001c9:	5d                   	pop    %rbp
+  8001ca:	c3                   	ret
+
+00000000008001cb <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8001cb:	55                   	push   %rbp
+  8001cc:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  8001cf:	48 b8 68 19 80 00 00 	movabs $0x801968,%rax
+  8001d6:	00 00 00 
+  8001d9:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  8001db:	bf 00 00 00 00       	mov    $0x0,%edi
+  8001e0:	48 b8 45 10 80 00 00 	movabs $0x801045,%rax
+  8001e7:	00 00 00 
+  8001ea:	ff d0                	call   *%rax
+}
+  8001ec:	5d                   	pop    %rbp
+  8001ed:	c3                   	ret
+
+00000000008001ee <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  8001ee:	55                   	push   %rbp
+  8001ef:	48 89 e5             	mov    %rsp,%rbp
+  8001f2:	53                   	push   %rbx
+  8001f3:	48 83 ec 08          	sub    $0x8,%rsp
+  8001f7:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  8001fa:	8b 06                	mov    (%rsi),%eax
+  8001fc:	8d 50 01             	lea    0x1(%rax),%edx
+  8001ff:	89 16                	mov    %edx,(%rsi)
+  800201:	48 98                	cltq
+  800203:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  800208:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  80020e:	74 0a                	je     80021a <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  800210:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  800214:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800218:	c9                   	leave
+  800219:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  80021a:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  80021e:	be ff 00 00 00       	mov    $0xff,%esi
+  800223:	48 b8 e7 0f 80 00 00 	movabs $0x800fe7,%rax
+  80022a:	00 00 00 
+  80022d:	ff d0                	call   *%rax
+        state->offset = 0;
+  80022f:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  800235:	eb d9                	jmp    800210 <putch+0x22>
+
+0000000000800237 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  800237:	55                   	push   %rbp
+  800238:	48 89 e5             	mov    %rsp,%rbp
+  80023b:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  800242:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  800245:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  80024c:	b9 21 00 00 00       	mov    $0x21,%ecx
+  800251:	b8 00 00 00 00       	mov    $0x0,%eax
+  800256:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  800259:	48 89 f1             	mov    %rsi,%rcx
+  80025c:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  800263:	48 bf ee 01 80 00 00 	movabs $0x8001ee,%rdi
+  80026a:	00 00 00 
+  80026d:	48 b8 eb 03 80 00 00 	movabs $0x8003eb,%rax
+  800274:	00 00 00 
+  800277:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  800279:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  800280:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  800287:	48 b8 e7 0f 80 00 00 	movabs $0x800fe7,%rax
+  80028e:	00 00 00 
+  800291:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  800293:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  800299:	c9                   	leave
+  80029a:	c3                   	ret
+
+000000000080029b <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  80029b:	55                   	push   %rbp
+  80029c:	48 89 e5             	mov    %rsp,%rbp
+  80029f:	48 83 ec 50          	sub    $0x50,%rsp
+  8002a3:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8002a7:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8002ab:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8002af:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8002b3:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  8002b7:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  8002be:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8002c2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8002c6:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8002ca:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  8002ce:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  8002d2:	48 b8 37 02 80 00 00 	movabs $0x800237,%rax
+  8002d9:	00 00 00 
+  8002dc:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  8002de:	c9                   	leave
+  8002df:	c3                   	ret
+
+00000000008002e0 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  8002e0:	55                   	push   %rbp
+  8002e1:	48 89 e5             	mov    %rsp,%rbp
+  8002e4:	41 57                	push   %r15
+  8002e6:	41 56                	push   %r14
+  8002e8:	41 55                	push   %r13
+  8002ea:	41 54                	push   %r12
+  8002ec:	53                   	push   %rbx
+  8002ed:	48 83 ec 18          	sub    $0x18,%rsp
+  8002f1:	49 89 fc             	mov    %rdi,%r12
+  8002f4:	49 89 f5             	mov    %rsi,%r13
+  8002f7:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8002fb:	8b 45 10             	mov    0x10(%rbp),%eax
+  8002fe:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  800301:	41 89 cf             	mov    %ecx,%r15d
+  800304:	4c 39 fa             	cmp    %r15,%rdx
+  800307:	73 5b                	jae    800364 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  800309:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  80030d:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  800311:	85 db                	test   %ebx,%ebx
+  800313:	7e 0e                	jle    800323 <print_num+0x43>
+            putch(padc, put_arg);
+  800315:	4c 89 ee             	mov    %r13,%rsi
+  800318:	44 89 f7             	mov    %r14d,%edi
+  80031b:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  80031e:	83 eb 01             	sub    $0x1,%ebx
+  800321:	75 f2                	jne    800315 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  800323:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  800327:	48 b9 01 2f 80 00 00 	movabs $0x802f01,%rcx
+  80032e:	00 00 00 
+  800331:	48 b8 f0 2e 80 00 00 	movabs $0x802ef0,%rax
+  800338:	00 00 00 
+  80033b:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  80033f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800343:	ba 00 00 00 00       	mov    $0x0,%edx
+  800348:	49 f7 f7             	div    %r15
+  80034b:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  80034f:	4c 89 ee             	mov    %r13,%rsi
+  800352:	41 ff d4             	call   *%r12
+}
+  800355:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800359:	5b                   	pop    %rbx
+  80035a:	41 5c                	pop    %r12
+  80035c:	41 5d                	pop    %r13
+  80035e:	41 5e                	pop    %r14
+  800360:	41 5f                	pop    %r15
+  800362:	5d                   	pop    %rbp
+  800363:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  800364:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800368:	ba 00 00 00 00       	mov    $0x0,%edx
+  80036d:	49 f7 f7             	div    %r15
+  800370:	48 83 ec 08          	sub    $0x8,%rsp
+  800374:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  800378:	52                   	push   %rdx
+  800379:	45 0f be c9          	movsbl %r9b,%r9d
+  80037d:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  800381:	48 89 c2             	mov    %rax,%rdx
+  800384:	48 b8 e0 02 80 00 00 	movabs $0x8002e0,%rax
+  80038b:	00 00 00 
+  80038e:	ff d0                	call   *%rax
+  800390:	48 83 c4 10          	add    $0x10,%rsp
+  800394:	eb 8d                	jmp    800323 <print_num+0x43>
+
+0000000000800396 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  800396:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  80039a:	48 8b 06             	mov    (%rsi),%rax
+  80039d:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  8003a1:	73 0a                	jae    8003ad <sprintputch+0x17>
+        *state->start++ = ch;
+  8003a3:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8003a7:	48 89 16             	mov    %rdx,(%rsi)
+  8003aa:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  8003ad:	c3                   	ret
+
+00000000008003ae <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  8003ae:	55                   	push   %rbp
+  8003af:	48 89 e5             	mov    %rsp,%rbp
+  8003b2:	48 83 ec 50          	sub    $0x50,%rsp
+  8003b6:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8003ba:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8003be:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  8003c2:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8003c9:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8003cd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8003d1:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8003d5:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  8003d9:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8003dd:	48 b8 eb 03 80 00 00 	movabs $0x8003eb,%rax
+  8003e4:	00 00 00 
+  8003e7:	ff d0                	call   *%rax
+}
+  8003e9:	c9                   	leave
+  8003ea:	c3                   	ret
+
+00000000008003eb <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  8003eb:	55                   	push   %rbp
+  8003ec:	48 89 e5             	mov    %rsp,%rbp
+  8003ef:	41 57                	push   %r15
+  8003f1:	41 56                	push   %r14
+  8003f3:	41 55                	push   %r13
+  8003f5:	41 54                	push   %r12
+  8003f7:	53                   	push   %rbx
+  8003f8:	48 83 ec 38          	sub    $0x38,%rsp
+  8003fc:	49 89 fe             	mov    %rdi,%r14
+  8003ff:	49 89 f5             	mov    %rsi,%r13
+  800402:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  800405:	48 8b 01             	mov    (%rcx),%rax
+  800408:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  80040c:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800410:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800414:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  800418:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  80041c:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  800420:	0f b6 3b             	movzbl (%rbx),%edi
+  800423:	40 80 ff 25          	cmp    $0x25,%dil
+  800427:	74 18                	je     800441 <vprintfmt+0x56>
+            if (!ch) return;
+  800429:	40 84 ff             	test   %dil,%dil
+  80042c:	0f 84 b1 06 00 00    	je     800ae3 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  800432:	40 0f b6 ff          	movzbl %dil,%edi
+  800436:	4c 89 ee             	mov    %r13,%rsi
+  800439:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  80043c:	4c 89 e3             	mov    %r12,%rbx
+  80043f:	eb db                	jmp    80041c <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  800441:	be 00 00 00 00       	mov    $0x0,%esi
+  800446:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  80044a:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  80044f:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800455:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  80045c:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800460:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  800465:	41 0f b6 04 24       	movzbl (%r12),%eax
+  80046a:	88 45 a0             	mov    %al,-0x60(%rbp)
+  80046d:	83 e8 23             	sub    $0x23,%eax
+  800470:	3c 57                	cmp    $0x57,%al
+  800472:	0f 87 51 06 00 00    	ja     800ac9 <vprintfmt+0x6de>
+  800478:	0f b6 c0             	movzbl %al,%eax
+  80047b:	48 b9 c0 30 80 00 00 	movabs $0x8030c0,%rcx
+  800482:	00 00 00 
+  800485:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  800488:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  80048b:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  80048f:	eb cf                	jmp    800460 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  800491:	49 89 dc             	mov    %rbx,%r12
+  800494:	be 01 00 00 00       	mov    $0x1,%esi
+  800499:	eb c5                	jmp    800460 <vprintfmt+0x75>
+            padc = ch;
+  80049b:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  80049f:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8004a2:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8004a5:	eb b9                	jmp    800460 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8004a7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8004aa:	83 f8 2f             	cmp    $0x2f,%eax
+  8004ad:	77 24                	ja     8004d3 <vprintfmt+0xe8>
+  8004af:	89 c1                	mov    %eax,%ecx
+  8004b1:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  8004b5:	83 c0 08             	add    $0x8,%eax
+  8004b8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8004bb:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  8004be:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  8004c1:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8004c5:	79 99                	jns    800460 <vprintfmt+0x75>
+                width = precision;
+  8004c7:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  8004cb:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8004d1:	eb 8d                	jmp    800460 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8004d3:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8004d7:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  8004db:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8004df:	eb da                	jmp    8004bb <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  8004e1:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  8004e6:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8004ea:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  8004f0:	3c 39                	cmp    $0x39,%al
+  8004f2:	77 1c                	ja     800510 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  8004f4:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  8004f8:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  8004fc:	0f b6 c0             	movzbl %al,%eax
+  8004ff:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800504:	0f b6 03             	movzbl (%rbx),%eax
+  800507:	3c 39                	cmp    $0x39,%al
+  800509:	76 e9                	jbe    8004f4 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  80050b:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  80050e:	eb b1                	jmp    8004c1 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  800510:	49 89 dc             	mov    %rbx,%r12
+  800513:	eb ac                	jmp    8004c1 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  800515:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  800518:	85 c9                	test   %ecx,%ecx
+  80051a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80051f:	0f 49 c1             	cmovns %ecx,%eax
+  800522:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  800525:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800528:	e9 33 ff ff ff       	jmp    800460 <vprintfmt+0x75>
+            lflag++;
+  80052d:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  800530:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800533:	e9 28 ff ff ff       	jmp    800460 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  800538:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80053b:	83 f8 2f             	cmp    $0x2f,%eax
+  80053e:	77 19                	ja     800559 <vprintfmt+0x16e>
+  800540:	89 c2                	mov    %eax,%edx
+  800542:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800546:	83 c0 08             	add    $0x8,%eax
+  800549:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80054c:	8b 3a                	mov    (%rdx),%edi
+  80054e:	4c 89 ee             	mov    %r13,%rsi
+  800551:	41 ff d6             	call   *%r14
+            break;
+  800554:	e9 c3 fe ff ff       	jmp    80041c <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  800559:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80055d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800561:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800565:	eb e5                	jmp    80054c <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  800567:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80056a:	83 f8 2f             	cmp    $0x2f,%eax
+  80056d:	77 5a                	ja     8005c9 <vprintfmt+0x1de>
+  80056f:	89 c2                	mov    %eax,%edx
+  800571:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800575:	83 c0 08             	add    $0x8,%eax
+  800578:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  80057b:	8b 02                	mov    (%rdx),%eax
+  80057d:	89 c1                	mov    %eax,%ecx
+  80057f:	f7 d9                	neg    %ecx
+  800581:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  800584:	83 f9 15             	cmp    $0x15,%ecx
+  800587:	7f 4e                	jg     8005d7 <vprintfmt+0x1ec>
+  800589:	48 63 c1             	movslq %ecx,%rax
+  80058c:	48 ba 80 33 80 00 00 	movabs $0x803380,%rdx
+  800593:	00 00 00 
+  800596:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80059a:	48 85 c0             	test   %rax,%rax
+  80059d:	74 38                	je     8005d7 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  80059f:	48 89 c1             	mov    %rax,%rcx
+  8005a2:	48 ba 79 35 80 00 00 	movabs $0x803579,%rdx
+  8005a9:	00 00 00 
+  8005ac:	4c 89 ee             	mov    %r13,%rsi
+  8005af:	4c 89 f7             	mov    %r14,%rdi
+  8005b2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005b7:	49 b8 ae 03 80 00 00 	movabs $0x8003ae,%r8
+  8005be:	00 00 00 
+  8005c1:	41 ff d0             	call   *%r8
+  8005c4:	e9 53 fe ff ff       	jmp    80041c <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  8005c9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8005cd:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8005d1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8005d5:	eb a4                	jmp    80057b <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  8005d7:	48 ba 19 2f 80 00 00 	movabs $0x802f19,%rdx
+  8005de:	00 00 00 
+  8005e1:	4c 89 ee             	mov    %r13,%rsi
+  8005e4:	4c 89 f7             	mov    %r14,%rdi
+  8005e7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005ec:	49 b8 ae 03 80 00 00 	movabs $0x8003ae,%r8
+  8005f3:	00 00 00 
+  8005f6:	41 ff d0             	call   *%r8
+  8005f9:	e9 1e fe ff ff       	jmp    80041c <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8005fe:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800601:	83 f8 2f             	cmp    $0x2f,%eax
+  800604:	77 6c                	ja     800672 <vprintfmt+0x287>
+  800606:	89 c2                	mov    %eax,%edx
+  800608:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80060c:	83 c0 08             	add    $0x8,%eax
+  80060f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800612:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  800615:	48 85 d2             	test   %rdx,%rdx
+  800618:	48 b8 12 2f 80 00 00 	movabs $0x802f12,%rax
+  80061f:	00 00 00 
+  800622:	48 0f 45 c2          	cmovne %rdx,%rax
+  800626:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  80062a:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  80062e:	7e 06                	jle    800636 <vprintfmt+0x24b>
+  800630:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  800634:	75 4a                	jne    800680 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800636:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  80063a:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  80063e:	0f b6 00             	movzbl (%rax),%eax
+  800641:	84 c0                	test   %al,%al
+  800643:	0f 85 9a 00 00 00    	jne    8006e3 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  800649:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80064c:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  800650:	85 c0                	test   %eax,%eax
+  800652:	0f 8e c4 fd ff ff    	jle    80041c <vprintfmt+0x31>
+  800658:	4c 89 ee             	mov    %r13,%rsi
+  80065b:	bf 20 00 00 00       	mov    $0x20,%edi
+  800660:	41 ff d6             	call   *%r14
+  800663:	41 83 ec 01          	sub    $0x1,%r12d
+  800667:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  80066b:	75 eb                	jne    800658 <vprintfmt+0x26d>
+  80066d:	e9 aa fd ff ff       	jmp    80041c <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800672:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800676:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80067a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80067e:	eb 92                	jmp    800612 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  800680:	49 63 f7             	movslq %r15d,%rsi
+  800683:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  800687:	48 b8 9d 0b 80 00 00 	movabs $0x800b9d,%rax
+  80068e:	00 00 00 
+  800691:	ff d0                	call   *%rax
+  800693:	48 89 c2             	mov    %rax,%rdx
+  800696:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800699:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  80069b:	8d 70 ff             	lea    -0x1(%rax),%esi
+  80069e:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  8006a1:	85 c0                	test   %eax,%eax
+  8006a3:	7e 91                	jle    800636 <vprintfmt+0x24b>
+  8006a5:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  8006aa:	4c 89 ee             	mov    %r13,%rsi
+  8006ad:	44 89 e7             	mov    %r12d,%edi
+  8006b0:	41 ff d6             	call   *%r14
+  8006b3:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8006b7:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8006ba:	83 f8 ff             	cmp    $0xffffffff,%eax
+  8006bd:	75 eb                	jne    8006aa <vprintfmt+0x2bf>
+  8006bf:	e9 72 ff ff ff       	jmp    800636 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8006c4:	0f b6 f8             	movzbl %al,%edi
+  8006c7:	4c 89 ee             	mov    %r13,%rsi
+  8006ca:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8006cd:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8006d1:	49 83 c4 01          	add    $0x1,%r12
+  8006d5:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  8006db:	84 c0                	test   %al,%al
+  8006dd:	0f 84 66 ff ff ff    	je     800649 <vprintfmt+0x25e>
+  8006e3:	45 85 ff             	test   %r15d,%r15d
+  8006e6:	78 0a                	js     8006f2 <vprintfmt+0x307>
+  8006e8:	41 83 ef 01          	sub    $0x1,%r15d
+  8006ec:	0f 88 57 ff ff ff    	js     800649 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8006f2:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  8006f6:	74 cc                	je     8006c4 <vprintfmt+0x2d9>
+  8006f8:	8d 50 e0             	lea    -0x20(%rax),%edx
+  8006fb:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800700:	80 fa 5e             	cmp    $0x5e,%dl
+  800703:	77 c2                	ja     8006c7 <vprintfmt+0x2dc>
+  800705:	eb bd                	jmp    8006c4 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  800707:	40 84 f6             	test   %sil,%sil
+  80070a:	75 26                	jne    800732 <vprintfmt+0x347>
+    switch (lflag) {
+  80070c:	85 d2                	test   %edx,%edx
+  80070e:	74 59                	je     800769 <vprintfmt+0x37e>
+  800710:	83 fa 01             	cmp    $0x1,%edx
+  800713:	74 7b                	je     800790 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  800715:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800718:	83 f8 2f             	cmp    $0x2f,%eax
+  80071b:	0f 87 96 00 00 00    	ja     8007b7 <vprintfmt+0x3cc>
+  800721:	89 c2                	mov    %eax,%edx
+  800723:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800727:	83 c0 08             	add    $0x8,%eax
+  80072a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80072d:	4c 8b 22             	mov    (%rdx),%r12
+  800730:	eb 17                	jmp    800749 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  800732:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800735:	83 f8 2f             	cmp    $0x2f,%eax
+  800738:	77 21                	ja     80075b <vprintfmt+0x370>
+  80073a:	89 c2                	mov    %eax,%edx
+  80073c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800740:	83 c0 08             	add    $0x8,%eax
+  800743:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800746:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  800749:	4d 85 e4             	test   %r12,%r12
+  80074c:	78 7a                	js     8007c8 <vprintfmt+0x3dd>
+            num = i;
+  80074e:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  800751:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  800756:	e9 50 02 00 00       	jmp    8009ab <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  80075b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80075f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800763:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800767:	eb dd                	jmp    800746 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  800769:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80076c:	83 f8 2f             	cmp    $0x2f,%eax
+  80076f:	77 11                	ja     800782 <vprintfmt+0x397>
+  800771:	89 c2                	mov    %eax,%edx
+  800773:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800777:	83 c0 08             	add    $0x8,%eax
+  80077a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80077d:	4c 63 22             	movslq (%rdx),%r12
+  800780:	eb c7                	jmp    800749 <vprintfmt+0x35e>
+  800782:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800786:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80078a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80078e:	eb ed                	jmp    80077d <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  800790:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800793:	83 f8 2f             	cmp    $0x2f,%eax
+  800796:	77 11                	ja     8007a9 <vprintfmt+0x3be>
+  800798:	89 c2                	mov    %eax,%edx
+  80079a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80079e:	83 c0 08             	add    $0x8,%eax
+  8007a1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007a4:	4c 8b 22             	mov    (%rdx),%r12
+  8007a7:	eb a0                	jmp    800749 <vprintfmt+0x35e>
+  8007a9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007ad:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007b1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007b5:	eb ed                	jmp    8007a4 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  8007b7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007bb:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007bf:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007c3:	e9 65 ff ff ff       	jmp    80072d <vprintfmt+0x342>
+                putch('-', put_arg);
+  8007c8:	4c 89 ee             	mov    %r13,%rsi
+  8007cb:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  8007d0:	41 ff d6             	call   *%r14
+                i = -i;
+  8007d3:	49 f7 dc             	neg    %r12
+  8007d6:	e9 73 ff ff ff       	jmp    80074e <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  8007db:	40 84 f6             	test   %sil,%sil
+  8007de:	75 32                	jne    800812 <vprintfmt+0x427>
+    switch (lflag) {
+  8007e0:	85 d2                	test   %edx,%edx
+  8007e2:	74 5d                	je     800841 <vprintfmt+0x456>
+  8007e4:	83 fa 01             	cmp    $0x1,%edx
+  8007e7:	0f 84 82 00 00 00    	je     80086f <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  8007ed:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007f0:	83 f8 2f             	cmp    $0x2f,%eax
+  8007f3:	0f 87 a5 00 00 00    	ja     80089e <vprintfmt+0x4b3>
+  8007f9:	89 c2                	mov    %eax,%edx
+  8007fb:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007ff:	83 c0 08             	add    $0x8,%eax
+  800802:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800805:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800808:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  80080d:	e9 99 01 00 00       	jmp    8009ab <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800812:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800815:	83 f8 2f             	cmp    $0x2f,%eax
+  800818:	77 19                	ja     800833 <vprintfmt+0x448>
+  80081a:	89 c2                	mov    %eax,%edx
+  80081c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800820:	83 c0 08             	add    $0x8,%eax
+  800823:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800826:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800829:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  80082e:	e9 78 01 00 00       	jmp    8009ab <vprintfmt+0x5c0>
+  800833:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800837:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80083b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80083f:	eb e5                	jmp    800826 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  800841:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800844:	83 f8 2f             	cmp    $0x2f,%eax
+  800847:	77 18                	ja     800861 <vprintfmt+0x476>
+  800849:	89 c2                	mov    %eax,%edx
+  80084b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80084f:	83 c0 08             	add    $0x8,%eax
+  800852:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800855:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800857:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  80085c:	e9 4a 01 00 00       	jmp    8009ab <vprintfmt+0x5c0>
+  800861:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800865:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800869:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80086d:	eb e6                	jmp    800855 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  80086f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800872:	83 f8 2f             	cmp    $0x2f,%eax
+  800875:	77 19                	ja     800890 <vprintfmt+0x4a5>
+  800877:	89 c2                	mov    %eax,%edx
+  800879:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80087d:	83 c0 08             	add    $0x8,%eax
+  800880:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800883:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800886:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  80088b:	e9 1b 01 00 00       	jmp    8009ab <vprintfmt+0x5c0>
+  800890:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800894:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800898:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80089c:	eb e5                	jmp    800883 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  80089e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008a2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008a6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008aa:	e9 56 ff ff ff       	jmp    800805 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  8008af:	40 84 f6             	test   %sil,%sil
+  8008b2:	75 2e                	jne    8008e2 <vprintfmt+0x4f7>
+    switch (lflag) {
+  8008b4:	85 d2                	test   %edx,%edx
+  8008b6:	74 59                	je     800911 <vprintfmt+0x526>
+  8008b8:	83 fa 01             	cmp    $0x1,%edx
+  8008bb:	74 7f                	je     80093c <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  8008bd:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008c0:	83 f8 2f             	cmp    $0x2f,%eax
+  8008c3:	0f 87 9f 00 00 00    	ja     800968 <vprintfmt+0x57d>
+  8008c9:	89 c2                	mov    %eax,%edx
+  8008cb:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008cf:	83 c0 08             	add    $0x8,%eax
+  8008d2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008d5:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8008d8:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  8008dd:	e9 c9 00 00 00       	jmp    8009ab <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8008e2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008e5:	83 f8 2f             	cmp    $0x2f,%eax
+  8008e8:	77 19                	ja     800903 <vprintfmt+0x518>
+  8008ea:	89 c2                	mov    %eax,%edx
+  8008ec:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008f0:	83 c0 08             	add    $0x8,%eax
+  8008f3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008f6:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8008f9:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8008fe:	e9 a8 00 00 00       	jmp    8009ab <vprintfmt+0x5c0>
+  800903:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800907:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80090b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80090f:	eb e5                	jmp    8008f6 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  800911:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800914:	83 f8 2f             	cmp    $0x2f,%eax
+  800917:	77 15                	ja     80092e <vprintfmt+0x543>
+  800919:	89 c2                	mov    %eax,%edx
+  80091b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80091f:	83 c0 08             	add    $0x8,%eax
+  800922:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800925:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  800927:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  80092c:	eb 7d                	jmp    8009ab <vprintfmt+0x5c0>
+  80092e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800932:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800936:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80093a:	eb e9                	jmp    800925 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  80093c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80093f:	83 f8 2f             	cmp    $0x2f,%eax
+  800942:	77 16                	ja     80095a <vprintfmt+0x56f>
+  800944:	89 c2                	mov    %eax,%edx
+  800946:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80094a:	83 c0 08             	add    $0x8,%eax
+  80094d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800950:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800953:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  800958:	eb 51                	jmp    8009ab <vprintfmt+0x5c0>
+  80095a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80095e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800962:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800966:	eb e8                	jmp    800950 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  800968:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80096c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800970:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800974:	e9 5c ff ff ff       	jmp    8008d5 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  800979:	4c 89 ee             	mov    %r13,%rsi
+  80097c:	bf 30 00 00 00       	mov    $0x30,%edi
+  800981:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800984:	4c 89 ee             	mov    %r13,%rsi
+  800987:	bf 78 00 00 00       	mov    $0x78,%edi
+  80098c:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  80098f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800992:	83 f8 2f             	cmp    $0x2f,%eax
+  800995:	77 47                	ja     8009de <vprintfmt+0x5f3>
+  800997:	89 c2                	mov    %eax,%edx
+  800999:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80099d:	83 c0 08             	add    $0x8,%eax
+  8009a0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009a3:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8009a6:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  8009ab:	48 83 ec 08          	sub    $0x8,%rsp
+  8009af:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  8009b3:	0f 94 c0             	sete   %al
+  8009b6:	0f b6 c0             	movzbl %al,%eax
+  8009b9:	50                   	push   %rax
+  8009ba:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  8009bf:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  8009c3:	4c 89 ee             	mov    %r13,%rsi
+  8009c6:	4c 89 f7             	mov    %r14,%rdi
+  8009c9:	48 b8 e0 02 80 00 00 	movabs $0x8002e0,%rax
+  8009d0:	00 00 00 
+  8009d3:	ff d0                	call   *%rax
+            break;
+  8009d5:	48 83 c4 10          	add    $0x10,%rsp
+  8009d9:	e9 3e fa ff ff       	jmp    80041c <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  8009de:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009e2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009e6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009ea:	eb b7                	jmp    8009a3 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  8009ec:	40 84 f6             	test   %sil,%sil
+  8009ef:	75 2b                	jne    800a1c <vprintfmt+0x631>
+    switch (lflag) {
+  8009f1:	85 d2                	test   %edx,%edx
+  8009f3:	74 56                	je     800a4b <vprintfmt+0x660>
+  8009f5:	83 fa 01             	cmp    $0x1,%edx
+  8009f8:	74 7f                	je     800a79 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  8009fa:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009fd:	83 f8 2f             	cmp    $0x2f,%eax
+  800a00:	0f 87 a2 00 00 00    	ja     800aa8 <vprintfmt+0x6bd>
+  800a06:	89 c2                	mov    %eax,%edx
+  800a08:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a0c:	83 c0 08             	add    $0x8,%eax
+  800a0f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a12:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800a15:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800a1a:	eb 8f                	jmp    8009ab <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800a1c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a1f:	83 f8 2f             	cmp    $0x2f,%eax
+  800a22:	77 19                	ja     800a3d <vprintfmt+0x652>
+  800a24:	89 c2                	mov    %eax,%edx
+  800a26:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a2a:	83 c0 08             	add    $0x8,%eax
+  800a2d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a30:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800a33:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800a38:	e9 6e ff ff ff       	jmp    8009ab <vprintfmt+0x5c0>
+  800a3d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a41:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a45:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a49:	eb e5                	jmp    800a30 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800a4b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a4e:	83 f8 2f             	cmp    $0x2f,%eax
+  800a51:	77 18                	ja     800a6b <vprintfmt+0x680>
+  800a53:	89 c2                	mov    %eax,%edx
+  800a55:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a59:	83 c0 08             	add    $0x8,%eax
+  800a5c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a5f:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800a61:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800a66:	e9 40 ff ff ff       	jmp    8009ab <vprintfmt+0x5c0>
+  800a6b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a6f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a73:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a77:	eb e6                	jmp    800a5f <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800a79:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a7c:	83 f8 2f             	cmp    $0x2f,%eax
+  800a7f:	77 19                	ja     800a9a <vprintfmt+0x6af>
+  800a81:	89 c2                	mov    %eax,%edx
+  800a83:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a87:	83 c0 08             	add    $0x8,%eax
+  800a8a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a8d:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800a90:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800a95:	e9 11 ff ff ff       	jmp    8009ab <vprintfmt+0x5c0>
+  800a9a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a9e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800aa2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800aa6:	eb e5                	jmp    800a8d <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800aa8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800aac:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ab0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ab4:	e9 59 ff ff ff       	jmp    800a12 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800ab9:	4c 89 ee             	mov    %r13,%rsi
+  800abc:	bf 25 00 00 00       	mov    $0x25,%edi
+  800ac1:	41 ff d6             	call   *%r14
+            break;
+  800ac4:	e9 53 f9 ff ff       	jmp    80041c <vprintfmt+0x31>
+            putch('%', put_arg);
+  800ac9:	4c 89 ee             	mov    %r13,%rsi
+  800acc:	bf 25 00 00 00       	mov    $0x25,%edi
+  800ad1:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800ad4:	48 83 eb 01          	sub    $0x1,%rbx
+  800ad8:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800adc:	75 f6                	jne    800ad4 <vprintfmt+0x6e9>
+  800ade:	e9 39 f9 ff ff       	jmp    80041c <vprintfmt+0x31>
+}
+  800ae3:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800ae7:	5b                   	pop    %rbx
+  800ae8:	41 5c                	pop    %r12
+  800aea:	41 5d                	pop    %r13
+  800aec:	41 5e                	pop    %r14
+  800aee:	41 5f                	pop    %r15
+  800af0:	5d                   	pop    %rbp
+  800af1:	c3                   	ret
+
+0000000000800af2 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800af2:	55                   	push   %rbp
+  800af3:	48 89 e5             	mov    %rsp,%rbp
+  800af6:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800afa:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800afe:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800b03:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800b07:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800b0e:	48 85 ff             	test   %rdi,%rdi
+  800b11:	74 2b                	je     800b3e <vsnprintf+0x4c>
+  800b13:	48 85 f6             	test   %rsi,%rsi
+  800b16:	74 26                	je     800b3e <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800b18:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800b1c:	48 bf 96 03 80 00 00 	movabs $0x800396,%rdi
+  800b23:	00 00 00 
+  800b26:	48 b8 eb 03 80 00 00 	movabs $0x8003eb,%rax
+  800b2d:	00 00 00 
+  800b30:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800b32:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800b36:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800b39:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800b3c:	c9                   	leave
+  800b3d:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800b3e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800b43:	eb f7                	jmp    800b3c <vsnprintf+0x4a>
+
+0000000000800b45 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800b45:	55                   	push   %rbp
+  800b46:	48 89 e5             	mov    %rsp,%rbp
+  800b49:	48 83 ec 50          	sub    $0x50,%rsp
+  800b4d:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800b51:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800b55:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800b59:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800b60:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800b64:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b68:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800b6c:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800b70:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800b74:	48 b8 f2 0a 80 00 00 	movabs $0x800af2,%rax
+  800b7b:	00 00 00 
+  800b7e:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800b80:	c9                   	leave
+  800b81:	c3                   	ret
+
+0000000000800b82 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800b82:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800b85:	74 10                	je     800b97 <strlen+0x15>
+    size_t n = 0;
+  800b87:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800b8c:	48 83 c0 01          	add    $0x1,%rax
+  800b90:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800b94:	75 f6                	jne    800b8c <strlen+0xa>
+  800b96:	c3                   	ret
+    size_t n = 0;
+  800b97:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800b9c:	c3                   	ret
+
+0000000000800b9d <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800b9d:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800ba0:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800ba5:	48 85 f6             	test   %rsi,%rsi
+  800ba8:	74 11                	je     800bbb <strnlen+0x1e>
+  800baa:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800bae:	74 0c                	je     800bbc <strnlen+0x1f>
+  800bb0:	48 83 c2 01          	add    $0x1,%rdx
+  800bb4:	48 39 d0             	cmp    %rdx,%rax
+  800bb7:	75 f1                	jne    800baa <strnlen+0xd>
+  800bb9:	eb 04                	jmp    800bbf <strnlen+0x22>
+  800bbb:	c3                   	ret
+  800bbc:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800bbf:	c3                   	ret
+
+0000000000800bc0 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800bc0:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800bc3:	ba 00 00 00 00       	mov    $0x0,%edx
+  800bc8:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800bcc:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800bcf:	48 83 c2 01          	add    $0x1,%rdx
+  800bd3:	84 c9                	test   %cl,%cl
+  800bd5:	75 f1                	jne    800bc8 <strcpy+0x8>
+        ;
+    return res;
+}
+  800bd7:	c3                   	ret
+
+0000000000800bd8 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800bd8:	55                   	push   %rbp
+  800bd9:	48 89 e5             	mov    %rsp,%rbp
+  800bdc:	41 54                	push   %r12
+  800bde:	53                   	push   %rbx
+  800bdf:	48 89 fb             	mov    %rdi,%rbx
+  800be2:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800be5:	48 b8 82 0b 80 00 00 	movabs $0x800b82,%rax
+  800bec:	00 00 00 
+  800bef:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800bf1:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800bf5:	4c 89 e6             	mov    %r12,%rsi
+  800bf8:	48 b8 c0 0b 80 00 00 	movabs $0x800bc0,%rax
+  800bff:	00 00 00 
+  800c02:	ff d0                	call   *%rax
+    return dst;
+}
+  800c04:	48 89 d8             	mov    %rbx,%rax
+  800c07:	5b                   	pop    %rbx
+  800c08:	41 5c                	pop    %r12
+  800c0a:	5d                   	pop    %rbp
+  800c0b:	c3                   	ret
+
+0000000000800c0c <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800c0c:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800c0f:	48 85 d2             	test   %rdx,%rdx
+  800c12:	74 1f                	je     800c33 <strncpy+0x27>
+  800c14:	48 01 fa             	add    %rdi,%rdx
+  800c17:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800c1a:	48 83 c1 01          	add    $0x1,%rcx
+  800c1e:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800c22:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800c26:	41 80 f8 01          	cmp    $0x1,%r8b
+  800c2a:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800c2e:	48 39 ca             	cmp    %rcx,%rdx
+  800c31:	75 e7                	jne    800c1a <strncpy+0xe>
+    }
+    return ret;
+}
+  800c33:	c3                   	ret
+
+0000000000800c34 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800c34:	48 89 f8             	mov    %rdi,%rax
+  800c37:	48 85 d2             	test   %rdx,%rdx
+  800c3a:	74 24                	je     800c60 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800c3c:	48 83 ea 01          	sub    $0x1,%rdx
+  800c40:	74 1b                	je     800c5d <strlcpy+0x29>
+  800c42:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800c46:	0f b6 16             	movzbl (%rsi),%edx
+  800c49:	84 d2                	test   %dl,%dl
+  800c4b:	74 10                	je     800c5d <strlcpy+0x29>
+            *dst++ = *src++;
+  800c4d:	48 83 c6 01          	add    $0x1,%rsi
+  800c51:	48 83 c0 01          	add    $0x1,%rax
+  800c55:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800c58:	48 39 c8             	cmp    %rcx,%rax
+  800c5b:	75 e9                	jne    800c46 <strlcpy+0x12>
+        *dst = '\0';
+  800c5d:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800c60:	48 29 f8             	sub    %rdi,%rax
+}
+  800c63:	c3                   	ret
+
+0000000000800c64 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800c64:	0f b6 07             	movzbl (%rdi),%eax
+  800c67:	84 c0                	test   %al,%al
+  800c69:	74 13                	je     800c7e <strcmp+0x1a>
+  800c6b:	38 06                	cmp    %al,(%rsi)
+  800c6d:	75 0f                	jne    800c7e <strcmp+0x1a>
+  800c6f:	48 83 c7 01          	add    $0x1,%rdi
+  800c73:	48 83 c6 01          	add    $0x1,%rsi
+  800c77:	0f b6 07             	movzbl (%rdi),%eax
+  800c7a:	84 c0                	test   %al,%al
+  800c7c:	75 ed                	jne    800c6b <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800c7e:	0f b6 c0             	movzbl %al,%eax
+  800c81:	0f b6 16             	movzbl (%rsi),%edx
+  800c84:	29 d0                	sub    %edx,%eax
+}
+  800c86:	c3                   	ret
+
+0000000000800c87 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800c87:	48 85 d2             	test   %rdx,%rdx
+  800c8a:	74 1f                	je     800cab <strncmp+0x24>
+  800c8c:	0f b6 07             	movzbl (%rdi),%eax
+  800c8f:	84 c0                	test   %al,%al
+  800c91:	74 1e                	je     800cb1 <strncmp+0x2a>
+  800c93:	3a 06                	cmp    (%rsi),%al
+  800c95:	75 1a                	jne    800cb1 <strncmp+0x2a>
+  800c97:	48 83 c7 01          	add    $0x1,%rdi
+  800c9b:	48 83 c6 01          	add    $0x1,%rsi
+  800c9f:	48 83 ea 01          	sub    $0x1,%rdx
+  800ca3:	75 e7                	jne    800c8c <strncmp+0x5>
+
+    if (!n) return 0;
+  800ca5:	b8 00 00 00 00       	mov    $0x0,%eax
+  800caa:	c3                   	ret
+  800cab:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cb0:	c3                   	ret
+  800cb1:	48 85 d2             	test   %rdx,%rdx
+  800cb4:	74 09                	je     800cbf <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800cb6:	0f b6 07             	movzbl (%rdi),%eax
+  800cb9:	0f b6 16             	movzbl (%rsi),%edx
+  800cbc:	29 d0                	sub    %edx,%eax
+  800cbe:	c3                   	ret
+    if (!n) return 0;
+  800cbf:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800cc4:	c3                   	ret
+
+0000000000800cc5 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800cc5:	0f b6 17             	movzbl (%rdi),%edx
+  800cc8:	84 d2                	test   %dl,%dl
+  800cca:	74 18                	je     800ce4 <strchr+0x1f>
+        if (*str == c) {
+  800ccc:	0f be d2             	movsbl %dl,%edx
+  800ccf:	39 f2                	cmp    %esi,%edx
+  800cd1:	74 17                	je     800cea <strchr+0x25>
+    for (; *str; str++) {
+  800cd3:	48 83 c7 01          	add    $0x1,%rdi
+  800cd7:	0f b6 17             	movzbl (%rdi),%edx
+  800cda:	84 d2                	test   %dl,%dl
+  800cdc:	75 ee                	jne    800ccc <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800cde:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ce3:	c3                   	ret
+  800ce4:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ce9:	c3                   	ret
+  800cea:	48 89 f8             	mov    %rdi,%rax
+}
+  800ced:	c3                   	ret
+
+0000000000800cee <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800cee:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800cf1:	0f b6 17             	movzbl (%rdi),%edx
+  800cf4:	84 d2                	test   %dl,%dl
+  800cf6:	74 13                	je     800d0b <strfind+0x1d>
+  800cf8:	0f be d2             	movsbl %dl,%edx
+  800cfb:	39 f2                	cmp    %esi,%edx
+  800cfd:	74 0b                	je     800d0a <strfind+0x1c>
+  800cff:	48 83 c0 01          	add    $0x1,%rax
+  800d03:	0f b6 10             	movzbl (%rax),%edx
+  800d06:	84 d2                	test   %dl,%dl
+  800d08:	75 ee                	jne    800cf8 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800d0a:	c3                   	ret
+  800d0b:	c3                   	ret
+
+0000000000800d0c <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800d0c:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800d0f:	48 89 f8             	mov    %rdi,%rax
+  800d12:	48 f7 d8             	neg    %rax
+  800d15:	83 e0 07             	and    $0x7,%eax
+  800d18:	49 89 d1             	mov    %rdx,%r9
+  800d1b:	49 29 c1             	sub    %rax,%r9
+  800d1e:	78 36                	js     800d56 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800d20:	40 0f b6 c6          	movzbl %sil,%eax
+  800d24:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800d2b:	01 01 01 
+  800d2e:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800d32:	40 f6 c7 07          	test   $0x7,%dil
+  800d36:	75 38                	jne    800d70 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800d38:	4c 89 c9             	mov    %r9,%rcx
+  800d3b:	48 c1 f9 03          	sar    $0x3,%rcx
+  800d3f:	74 0c                	je     800d4d <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800d41:	fc                   	cld
+  800d42:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800d45:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800d49:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800d4d:	4d 85 c9             	test   %r9,%r9
+  800d50:	75 45                	jne    800d97 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800d52:	4c 89 c0             	mov    %r8,%rax
+  800d55:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800d56:	48 85 d2             	test   %rdx,%rdx
+  800d59:	74 f7                	je     800d52 <memset+0x46>
+  800d5b:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800d5e:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800d61:	48 83 c0 01          	add    $0x1,%rax
+  800d65:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  800d69:	48 39 c2             	cmp    %rax,%rdx
+  800d6c:	75 f3                	jne    800d61 <memset+0x55>
+  800d6e:	eb e2                	jmp    800d52 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  800d70:	40 f6 c7 01          	test   $0x1,%dil
+  800d74:	74 06                	je     800d7c <memset+0x70>
+  800d76:	88 07                	mov    %al,(%rdi)
+  800d78:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800d7c:	40 f6 c7 02          	test   $0x2,%dil
+  800d80:	74 07                	je     800d89 <memset+0x7d>
+  800d82:	66 89 07             	mov    %ax,(%rdi)
+  800d85:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800d89:	40 f6 c7 04          	test   $0x4,%dil
+  800d8d:	74 a9                	je     800d38 <memset+0x2c>
+  800d8f:	89 07                	mov    %eax,(%rdi)
+  800d91:	48 83 c7 04          	add    $0x4,%rdi
+  800d95:	eb a1                	jmp    800d38 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800d97:	41 f6 c1 04          	test   $0x4,%r9b
+  800d9b:	74 06                	je     800da3 <memset+0x97>
+  800d9d:	89 07                	mov    %eax,(%rdi)
+  800d9f:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800da3:	41 f6 c1 02          	test   $0x2,%r9b
+  800da7:	74 07                	je     800db0 <memset+0xa4>
+  800da9:	66 89 07             	mov    %ax,(%rdi)
+  800dac:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  800db0:	41 f6 c1 01          	test   $0x1,%r9b
+  800db4:	74 9c                	je     800d52 <memset+0x46>
+  800db6:	88 07                	mov    %al,(%rdi)
+  800db8:	eb 98                	jmp    800d52 <memset+0x46>
+
+0000000000800dba <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  800dba:	48 89 f8             	mov    %rdi,%rax
+  800dbd:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  800dc0:	48 39 fe             	cmp    %rdi,%rsi
+  800dc3:	73 3b                	jae    800e00 <memmove+0x46>
+  800dc5:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  800dc9:	48 39 d7             	cmp    %rdx,%rdi
+  800dcc:	73 32                	jae    800e00 <memmove+0x46>
+        s += n;
+        d += n;
+  800dce:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800dd2:	48 89 d6             	mov    %rdx,%rsi
+  800dd5:	48 09 fe             	or     %rdi,%rsi
+  800dd8:	48 09 ce             	or     %rcx,%rsi
+  800ddb:	40 f6 c6 07          	test   $0x7,%sil
+  800ddf:	75 12                	jne    800df3 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  800de1:	48 83 ef 08          	sub    $0x8,%rdi
+  800de5:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  800de9:	48 c1 e9 03          	shr    $0x3,%rcx
+  800ded:	fd                   	std
+  800dee:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  800df1:	fc                   	cld
+  800df2:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  800df3:	48 83 ef 01          	sub    $0x1,%rdi
+  800df7:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  800dfb:	fd                   	std
+  800dfc:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  800dfe:	eb f1                	jmp    800df1 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800e00:	48 89 f2             	mov    %rsi,%rdx
+  800e03:	48 09 c2             	or     %rax,%rdx
+  800e06:	48 09 ca             	or     %rcx,%rdx
+  800e09:	f6 c2 07             	test   $0x7,%dl
+  800e0c:	75 0c                	jne    800e1a <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  800e0e:	48 c1 e9 03          	shr    $0x3,%rcx
+  800e12:	48 89 c7             	mov    %rax,%rdi
+  800e15:	fc                   	cld
+  800e16:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  800e19:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  800e1a:	48 89 c7             	mov    %rax,%rdi
+  800e1d:	fc                   	cld
+  800e1e:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  800e20:	c3                   	ret
+
+0000000000800e21 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  800e21:	55                   	push   %rbp
+  800e22:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  800e25:	48 b8 ba 0d 80 00 00 	movabs $0x800dba,%rax
+  800e2c:	00 00 00 
+  800e2f:	ff d0                	call   *%rax
+}
+  800e31:	5d                   	pop    %rbp
+  800e32:	c3                   	ret
+
+0000000000800e33 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  800e33:	55                   	push   %rbp
+  800e34:	48 89 e5             	mov    %rsp,%rbp
+  800e37:	41 57                	push   %r15
+  800e39:	41 56                	push   %r14
+  800e3b:	41 55                	push   %r13
+  800e3d:	41 54                	push   %r12
+  800e3f:	53                   	push   %rbx
+  800e40:	48 83 ec 08          	sub    $0x8,%rsp
+  800e44:	49 89 fe             	mov    %rdi,%r14
+  800e47:	49 89 f7             	mov    %rsi,%r15
+  800e4a:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  800e4d:	48 89 f7             	mov    %rsi,%rdi
+  800e50:	48 b8 82 0b 80 00 00 	movabs $0x800b82,%rax
+  800e57:	00 00 00 
+  800e5a:	ff d0                	call   *%rax
+  800e5c:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  800e5f:	48 89 de             	mov    %rbx,%rsi
+  800e62:	4c 89 f7             	mov    %r14,%rdi
+  800e65:	48 b8 9d 0b 80 00 00 	movabs $0x800b9d,%rax
+  800e6c:	00 00 00 
+  800e6f:	ff d0                	call   *%rax
+  800e71:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  800e74:	48 39 c3             	cmp    %rax,%rbx
+  800e77:	74 36                	je     800eaf <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  800e79:	48 89 d8             	mov    %rbx,%rax
+  800e7c:	4c 29 e8             	sub    %r13,%rax
+  800e7f:	49 39 c4             	cmp    %rax,%r12
+  800e82:	73 31                	jae    800eb5 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  800e84:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  800e89:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800e8d:	4c 89 fe             	mov    %r15,%rsi
+  800e90:	48 b8 21 0e 80 00 00 	movabs $0x800e21,%rax
+  800e97:	00 00 00 
+  800e9a:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  800e9c:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  800ea0:	48 83 c4 08          	add    $0x8,%rsp
+  800ea4:	5b                   	pop    %rbx
+  800ea5:	41 5c                	pop    %r12
+  800ea7:	41 5d                	pop    %r13
+  800ea9:	41 5e                	pop    %r14
+  800eab:	41 5f                	pop    %r15
+  800ead:	5d                   	pop    %rbp
+  800eae:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  800eaf:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800eb3:	eb eb                	jmp    800ea0 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  800eb5:	48 83 eb 01          	sub    $0x1,%rbx
+  800eb9:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800ebd:	48 89 da             	mov    %rbx,%rdx
+  800ec0:	4c 89 fe             	mov    %r15,%rsi
+  800ec3:	48 b8 21 0e 80 00 00 	movabs $0x800e21,%rax
+  800eca:	00 00 00 
+  800ecd:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  800ecf:	49 01 de             	add    %rbx,%r14
+  800ed2:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  800ed7:	eb c3                	jmp    800e9c <strlcat+0x69>
+
+0000000000800ed9 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  800ed9:	48 85 d2             	test   %rdx,%rdx
+  800edc:	74 2d                	je     800f0b <memcmp+0x32>
+  800ede:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  800ee3:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800ee7:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  800eec:	44 38 c1             	cmp    %r8b,%cl
+  800eef:	75 0f                	jne    800f00 <memcmp+0x27>
+    while (n-- > 0) {
+  800ef1:	48 83 c0 01          	add    $0x1,%rax
+  800ef5:	48 39 c2             	cmp    %rax,%rdx
+  800ef8:	75 e9                	jne    800ee3 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  800efa:	b8 00 00 00 00       	mov    $0x0,%eax
+  800eff:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  800f00:	0f b6 c1             	movzbl %cl,%eax
+  800f03:	45 0f b6 c0          	movzbl %r8b,%r8d
+  800f07:	44 29 c0             	sub    %r8d,%eax
+  800f0a:	c3                   	ret
+    return 0;
+  800f0b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800f10:	c3                   	ret
+
+0000000000800f11 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  800f11:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  800f15:	48 39 c7             	cmp    %rax,%rdi
+  800f18:	73 0f                	jae    800f29 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  800f1a:	40 38 37             	cmp    %sil,(%rdi)
+  800f1d:	74 0e                	je     800f2d <memfind+0x1c>
+    for (; src < end; src++) {
+  800f1f:	48 83 c7 01          	add    $0x1,%rdi
+  800f23:	48 39 f8             	cmp    %rdi,%rax
+  800f26:	75 f2                	jne    800f1a <memfind+0x9>
+  800f28:	c3                   	ret
+  800f29:	48 89 f8             	mov    %rdi,%rax
+  800f2c:	c3                   	ret
+  800f2d:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  800f30:	c3                   	ret
+
+0000000000800f31 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  800f31:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  800f34:	0f b6 37             	movzbl (%rdi),%esi
+  800f37:	40 80 fe 20          	cmp    $0x20,%sil
+  800f3b:	74 06                	je     800f43 <strtol+0x12>
+  800f3d:	40 80 fe 09          	cmp    $0x9,%sil
+  800f41:	75 13                	jne    800f56 <strtol+0x25>
+  800f43:	48 83 c7 01          	add    $0x1,%rdi
+  800f47:	0f b6 37             	movzbl (%rdi),%esi
+  800f4a:	40 80 fe 20          	cmp    $0x20,%sil
+  800f4e:	74 f3                	je     800f43 <strtol+0x12>
+  800f50:	40 80 fe 09          	cmp    $0x9,%sil
+  800f54:	74 ed                	je     800f43 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  800f56:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  800f59:	83 e0 fd             	and    $0xfffffffd,%eax
+  800f5c:	3c 01                	cmp    $0x1,%al
+  800f5e:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  800f62:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  800f68:	75 0f                	jne    800f79 <strtol+0x48>
+  800f6a:	80 3f 30             	cmpb   $0x30,(%rdi)
+  800f6d:	74 14                	je     800f83 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  800f6f:	85 d2                	test   %edx,%edx
+  800f71:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800f76:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  800f79:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  800f7e:	4c 63 ca             	movslq %edx,%r9
+  800f81:	eb 36                	jmp    800fb9 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  800f83:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  800f87:	74 0f                	je     800f98 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  800f89:	85 d2                	test   %edx,%edx
+  800f8b:	75 ec                	jne    800f79 <strtol+0x48>
+        s++;
+  800f8d:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  800f91:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  800f96:	eb e1                	jmp    800f79 <strtol+0x48>
+        s += 2;
+  800f98:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  800f9c:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  800fa1:	eb d6                	jmp    800f79 <strtol+0x48>
+            dig -= '0';
+  800fa3:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  800fa6:	44 0f b6 c1          	movzbl %cl,%r8d
+  800faa:	41 39 d0             	cmp    %edx,%r8d
+  800fad:	7d 21                	jge    800fd0 <strtol+0x9f>
+        val = val * base + dig;
+  800faf:	49 0f af c1          	imul   %r9,%rax
+  800fb3:	0f b6 c9             	movzbl %cl,%ecx
+  800fb6:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  800fb9:	48 83 c7 01          	add    $0x1,%rdi
+  800fbd:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  800fc1:	80 f9 39             	cmp    $0x39,%cl
+  800fc4:	76 dd                	jbe    800fa3 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  800fc6:	80 f9 7b             	cmp    $0x7b,%cl
+  800fc9:	77 05                	ja     800fd0 <strtol+0x9f>
+            dig -= 'a' - 10;
+  800fcb:	83 e9 57             	sub    $0x57,%ecx
+  800fce:	eb d6                	jmp    800fa6 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  800fd0:	4d 85 d2             	test   %r10,%r10
+  800fd3:	74 03                	je     800fd8 <strtol+0xa7>
+  800fd5:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  800fd8:	48 89 c2             	mov    %rax,%rdx
+  800fdb:	48 f7 da             	neg    %rdx
+  800fde:	40 80 fe 2d          	cmp    $0x2d,%sil
+  800fe2:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  800fe6:	c3                   	ret
+
+0000000000800fe7 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  800fe7:	55                   	push   %rbp
+  800fe8:	48 89 e5             	mov    %rsp,%rbp
+  800feb:	53                   	push   %rbx
+  800fec:	48 89 fa             	mov    %rdi,%rdx
+  800fef:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  800ff2:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800ff7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ffc:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801001:	be 00 00 00 00       	mov    $0x0,%esi
+  801006:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80100c:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  80100e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801012:	c9                   	leave
+  801013:	c3                   	ret
+
+0000000000801014 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  801014:	55                   	push   %rbp
+  801015:	48 89 e5             	mov    %rsp,%rbp
+  801018:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801019:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80101e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801023:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801028:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80102d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801032:	be 00 00 00 00       	mov    $0x0,%esi
+  801037:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80103d:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  80103f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801043:	c9                   	leave
+  801044:	c3                   	ret
+
+0000000000801045 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  801045:	55                   	push   %rbp
+  801046:	48 89 e5             	mov    %rsp,%rbp
+  801049:	53                   	push   %rbx
+  80104a:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  80104e:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801051:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801056:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80105b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801060:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801065:	be 00 00 00 00       	mov    $0x0,%esi
+  80106a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801070:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801072:	48 85 c0             	test   %rax,%rax
+  801075:	7f 06                	jg     80107d <sys_env_destroy+0x38>
+}
+  801077:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80107b:	c9                   	leave
+  80107c:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80107d:	49 89 c0             	mov    %rax,%r8
+  801080:	b9 03 00 00 00       	mov    $0x3,%ecx
+  801085:	48 ba 50 34 80 00 00 	movabs $0x803450,%rdx
+  80108c:	00 00 00 
+  80108f:	be 26 00 00 00       	mov    $0x26,%esi
+  801094:	48 bf 6f 34 80 00 00 	movabs $0x80346f,%rdi
+  80109b:	00 00 00 
+  80109e:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010a3:	49 b9 65 2c 80 00 00 	movabs $0x802c65,%r9
+  8010aa:	00 00 00 
+  8010ad:	41 ff d1             	call   *%r9
+
+00000000008010b0 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  8010b0:	55                   	push   %rbp
+  8010b1:	48 89 e5             	mov    %rsp,%rbp
+  8010b4:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8010b5:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8010ba:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010bf:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8010c4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010c9:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8010ce:	be 00 00 00 00       	mov    $0x0,%esi
+  8010d3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8010d9:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  8010db:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8010df:	c9                   	leave
+  8010e0:	c3                   	ret
+
+00000000008010e1 <sys_yield>:
+
+void
+sys_yield(void) {
+  8010e1:	55                   	push   %rbp
+  8010e2:	48 89 e5             	mov    %rsp,%rbp
+  8010e5:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8010e6:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8010eb:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010f0:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8010f5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010fa:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8010ff:	be 00 00 00 00       	mov    $0x0,%esi
+  801104:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80110a:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  80110c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801110:	c9                   	leave
+  801111:	c3                   	ret
+
+0000000000801112 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  801112:	55                   	push   %rbp
+  801113:	48 89 e5             	mov    %rsp,%rbp
+  801116:	53                   	push   %rbx
+  801117:	48 89 fa             	mov    %rdi,%rdx
+  80111a:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80111d:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801122:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  801129:	00 00 00 
+  80112c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801131:	be 00 00 00 00       	mov    $0x0,%esi
+  801136:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80113c:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  80113e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801142:	c9                   	leave
+  801143:	c3                   	ret
+
+0000000000801144 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  801144:	55                   	push   %rbp
+  801145:	48 89 e5             	mov    %rsp,%rbp
+  801148:	53                   	push   %rbx
+  801149:	49 89 f8             	mov    %rdi,%r8
+  80114c:	48 89 d3             	mov    %rdx,%rbx
+  80114f:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801152:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801157:	4c 89 c2             	mov    %r8,%rdx
+  80115a:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80115d:	be 00 00 00 00       	mov    $0x0,%esi
+  801162:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801168:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  80116a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80116e:	c9                   	leave
+  80116f:	c3                   	ret
+
+0000000000801170 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  801170:	55                   	push   %rbp
+  801171:	48 89 e5             	mov    %rsp,%rbp
+  801174:	53                   	push   %rbx
+  801175:	48 83 ec 08          	sub    $0x8,%rsp
+  801179:	89 f8                	mov    %edi,%eax
+  80117b:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  80117e:	48 63 f9             	movslq %ecx,%rdi
+  801181:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801184:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801189:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80118c:	be 00 00 00 00       	mov    $0x0,%esi
+  801191:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801197:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801199:	48 85 c0             	test   %rax,%rax
+  80119c:	7f 06                	jg     8011a4 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  80119e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8011a2:	c9                   	leave
+  8011a3:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8011a4:	49 89 c0             	mov    %rax,%r8
+  8011a7:	b9 04 00 00 00       	mov    $0x4,%ecx
+  8011ac:	48 ba 50 34 80 00 00 	movabs $0x803450,%rdx
+  8011b3:	00 00 00 
+  8011b6:	be 26 00 00 00       	mov    $0x26,%esi
+  8011bb:	48 bf 6f 34 80 00 00 	movabs $0x80346f,%rdi
+  8011c2:	00 00 00 
+  8011c5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011ca:	49 b9 65 2c 80 00 00 	movabs $0x802c65,%r9
+  8011d1:	00 00 00 
+  8011d4:	41 ff d1             	call   *%r9
+
+00000000008011d7 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8011d7:	55                   	push   %rbp
+  8011d8:	48 89 e5             	mov    %rsp,%rbp
+  8011db:	53                   	push   %rbx
+  8011dc:	48 83 ec 08          	sub    $0x8,%rsp
+  8011e0:	89 f8                	mov    %edi,%eax
+  8011e2:	49 89 f2             	mov    %rsi,%r10
+  8011e5:	48 89 cf             	mov    %rcx,%rdi
+  8011e8:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  8011eb:	48 63 da             	movslq %edx,%rbx
+  8011ee:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8011f1:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8011f6:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8011f9:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  8011fc:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8011fe:	48 85 c0             	test   %rax,%rax
+  801201:	7f 06                	jg     801209 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  801203:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801207:	c9                   	leave
+  801208:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801209:	49 89 c0             	mov    %rax,%r8
+  80120c:	b9 05 00 00 00       	mov    $0x5,%ecx
+  801211:	48 ba 50 34 80 00 00 	movabs $0x803450,%rdx
+  801218:	00 00 00 
+  80121b:	be 26 00 00 00       	mov    $0x26,%esi
+  801220:	48 bf 6f 34 80 00 00 	movabs $0x80346f,%rdi
+  801227:	00 00 00 
+  80122a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80122f:	49 b9 65 2c 80 00 00 	movabs $0x802c65,%r9
+  801236:	00 00 00 
+  801239:	41 ff d1             	call   *%r9
+
+000000000080123c <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  80123c:	55                   	push   %rbp
+  80123d:	48 89 e5             	mov    %rsp,%rbp
+  801240:	53                   	push   %rbx
+  801241:	48 83 ec 08          	sub    $0x8,%rsp
+  801245:	48 89 f1             	mov    %rsi,%rcx
+  801248:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  80124b:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80124e:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801253:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801258:	be 00 00 00 00       	mov    $0x0,%esi
+  80125d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801263:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801265:	48 85 c0             	test   %rax,%rax
+  801268:	7f 06                	jg     801270 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  80126a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80126e:	c9                   	leave
+  80126f:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801270:	49 89 c0             	mov    %rax,%r8
+  801273:	b9 06 00 00 00       	mov    $0x6,%ecx
+  801278:	48 ba 50 34 80 00 00 	movabs $0x803450,%rdx
+  80127f:	00 00 00 
+  801282:	be 26 00 00 00       	mov    $0x26,%esi
+  801287:	48 bf 6f 34 80 00 00 	movabs $0x80346f,%rdi
+  80128e:	00 00 00 
+  801291:	b8 00 00 00 00       	mov    $0x0,%eax
+  801296:	49 b9 65 2c 80 00 00 	movabs $0x802c65,%r9
+  80129d:	00 00 00 
+  8012a0:	41 ff d1             	call   *%r9
+
+00000000008012a3 <sys_region_batch>:
+
+int
+sys_region_batch(const struct RegionOp *ops, size_t count) {
+  8012a3:	55                   	push   %rbp
+  8012a4:	48 89 e5             	mov    %rsp,%rbp
+  8012a7:	53                   	push   %rbx
+  8012a8:	48 83 ec 08          	sub    $0x8,%rsp
+  8012ac:	48 89 fa             	mov    %rdi,%rdx
+  8012af:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8012b2:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8012b7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012bc:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012c1:	be 00 00 00 00       	mov    $0x0,%esi
+  8012c6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8012cc:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8012ce:	48 85 c0             	test   %rax,%rax
+  8012d1:	7f 06                	jg     8012d9 <sys_region_batch+0x36>
+        else
+            platform_asan_unpoison(va, ops[i].size);
+    }
+#endif
+    return res;
+}
+  8012d3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012d7:	c9                   	leave
+  8012d8:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8012d9:	49 89 c0             	mov    %rax,%r8
+  8012dc:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  8012e1:	48 ba 50 34 80 00 00 	movabs $0x803450,%rdx
+  8012e8:	00 00 00 
+  8012eb:	be 26 00 00 00       	mov    $0x26,%esi
+  8012f0:	48 bf 6f 34 80 00 00 	movabs $0x80346f,%rdi
+  8012f7:	00 00 00 
+  8012fa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012ff:	49 b9 65 2c 80 00 00 	movabs $0x802c65,%r9
+  801306:	00 00 00 
+  801309:	41 ff d1             	call   *%r9
+
+000000000080130c <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  80130c:	55                   	push   %rbp
+  80130d:	48 89 e5             	mov    %rsp,%rbp
+  801310:	53                   	push   %rbx
+  801311:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  801315:	48 63 ce             	movslq %esi,%rcx
+  801318:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80131b:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801320:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801325:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80132a:	be 00 00 00 00       	mov    $0x0,%esi
+  80132f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801335:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801337:	48 85 c0             	test   %rax,%rax
+  80133a:	7f 06                	jg     801342 <sys_env_set_status+0x36>
+}
+  80133c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801340:	c9                   	leave
+  801341:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801342:	49 89 c0             	mov    %rax,%r8
+  801345:	b9 09 00 00 00       	mov    $0x9,%ecx
+  80134a:	48 ba 50 34 80 00 00 	movabs $0x803450,%rdx
+  801351:	00 00 00 
+  801354:	be 26 00 00 00       	mov    $0x26,%esi
+  801359:	48 bf 6f 34 80 00 00 	movabs $0x80346f,%rdi
+  801360:	00 00 00 
+  801363:	b8 00 00 00 00       	mov    $0x0,%eax
+  801368:	49 b9 65 2c 80 00 00 	movabs $0x802c65,%r9
+  80136f:	00 00 00 
+  801372:	41 ff d1             	call   *%r9
+
+0000000000801375 <sys_env_set_weight>:
+
+int
+sys_env_set_weight(envid_t envid, uint32_t weight) {
+  801375:	55                   	push   %rbp
+  801376:	48 89 e5             	mov    %rsp,%rbp
+  801379:	53                   	push   %rbx
+  80137a:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_weight, 1, envid, weight, 0, 0, 0, 0);
+  80137e:	89 f1                	mov    %esi,%ecx
+  801380:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801383:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801388:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80138d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801392:	be 00 00 00 00       	mov    $0x0,%esi
+  801397:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80139d:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80139f:	48 85 c0             	test   %rax,%rax
+  8013a2:	7f 06                	jg     8013aa <sys_env_set_weight+0x35>
+}
+  8013a4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013a8:	c9                   	leave
+  8013a9:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8013aa:	49 89 c0             	mov    %rax,%r8
+  8013ad:	b9 10 00 00 00       	mov    $0x10,%ecx
+  8013b2:	48 ba 50 34 80 00 00 	movabs $0x803450,%rdx
+  8013b9:	00 00 00 
+  8013bc:	be 26 00 00 00       	mov    $0x26,%esi
+  8013c1:	48 bf 6f 34 80 00 00 	movabs $0x80346f,%rdi
+  8013c8:	00 00 00 
+  8013cb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013d0:	49 b9 65 2c 80 00 00 	movabs $0x802c65,%r9
+  8013d7:	00 00 00 
+  8013da:	41 ff d1             	call   *%r9
+
+00000000008013dd <sys_env_set_rt>:
+
+int
+sys_env_set_rt(envid_t envid, uint64_t period, uint64_t budget, uint64_t deadline) {
+  8013dd:	55                   	push   %rbp
+  8013de:	48 89 e5             	mov    %rsp,%rbp
+  8013e1:	53                   	push   %rbx
+  8013e2:	48 83 ec 08          	sub    $0x8,%rsp
+  8013e6:	89 f8                	mov    %edi,%eax
+  8013e8:	48 89 d3             	mov    %rdx,%rbx
+  8013eb:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_env_set_rt, 1, envid, period, budget, deadline, 0, 0);
+  8013ee:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8013f1:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8013f6:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013f9:	be 00 00 00 00       	mov    $0x0,%esi
+  8013fe:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801404:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801406:	48 85 c0             	test   %rax,%rax
+  801409:	7f 06                	jg     801411 <sys_env_set_rt+0x34>
+}
+  80140b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80140f:	c9                   	leave
+  801410:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801411:	49 89 c0             	mov    %rax,%r8
+  801414:	b9 11 00 00 00       	mov    $0x11,%ecx
+  801419:	48 ba 50 34 80 00 00 	movabs $0x803450,%rdx
+  801420:	00 00 00 
+  801423:	be 26 00 00 00       	mov    $0x26,%esi
+  801428:	48 bf 6f 34 80 00 00 	movabs $0x80346f,%rdi
+  80142f:	00 00 00 
+  801432:	b8 00 00 00 00       	mov    $0x0,%eax
+  801437:	49 b9 65 2c 80 00 00 	movabs $0x802c65,%r9
+  80143e:	00 00 00 
+  801441:	41 ff d1             	call   *%r9
+
+0000000000801444 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  801444:	55                   	push   %rbp
+  801445:	48 89 e5             	mov    %rsp,%rbp
+  801448:	53                   	push   %rbx
+  801449:	48 83 ec 08          	sub    $0x8,%rsp
+  80144d:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  801450:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801453:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801458:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80145d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801462:	be 00 00 00 00       	mov    $0x0,%esi
+  801467:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80146d:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80146f:	48 85 c0             	test   %rax,%rax
+  801472:	7f 06                	jg     80147a <sys_env_set_trapframe+0x36>
+}
+  801474:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801478:	c9                   	leave
+  801479:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80147a:	49 89 c0             	mov    %rax,%r8
+  80147d:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  801482:	48 ba 50 34 80 00 00 	movabs $0x803450,%rdx
+  801489:	00 00 00 
+  80148c:	be 26 00 00 00       	mov    $0x26,%esi
+  801491:	48 bf 6f 34 80 00 00 	movabs $0x80346f,%rdi
+  801498:	00 00 00 
+  80149b:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014a0:	49 b9 65 2c 80 00 00 	movabs $0x802c65,%r9
+  8014a7:	00 00 00 
+  8014aa:	41 ff d1             	call   *%r9
+
+00000000008014ad <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  8014ad:	55                   	push   %rbp
+  8014ae:	48 89 e5             	mov    %rsp,%rbp
+  8014b1:	53                   	push   %rbx
+  8014b2:	48 83 ec 08          	sub    $0x8,%rsp
+  8014b6:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  8014b9:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8014bc:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8014c1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014c6:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014cb:	be 00 00 00 00       	mov    $0x0,%esi
+  8014d0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014d6:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8014d8:	48 85 c0             	test   %rax,%rax
+  8014db:	7f 06                	jg     8014e3 <sys_env_set_pgfault_upcall+0x36>
+}
+  8014dd:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014e1:	c9                   	leave
+  8014e2:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8014e3:	49 89 c0             	mov    %rax,%r8
+  8014e6:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  8014eb:	48 ba 50 34 80 00 00 	movabs $0x803450,%rdx
+  8014f2:	00 00 00 
+  8014f5:	be 26 00 00 00       	mov    $0x26,%esi
+  8014fa:	48 bf 6f 34 80 00 00 	movabs $0x80346f,%rdi
+  801501:	00 00 00 
+  801504:	b8 00 00 00 00       	mov    $0x0,%eax
+  801509:	49 b9 65 2c 80 00 00 	movabs $0x802c65,%r9
+  801510:	00 00 00 
+  801513:	41 ff d1             	call   *%r9
+
+0000000000801516 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  801516:	55                   	push   %rbp
+  801517:	48 89 e5             	mov    %rsp,%rbp
+  80151a:	53                   	push   %rbx
+  80151b:	89 f8                	mov    %edi,%eax
+  80151d:	49 89 f1             	mov    %rsi,%r9
+  801520:	48 89 d3             	mov    %rdx,%rbx
+  801523:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  801526:	49 63 f0             	movslq %r8d,%rsi
+  801529:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80152c:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801531:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801534:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80153a:	cd 30                	int    $0x30
+}
+  80153c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801540:	c9                   	leave
+  801541:	c3                   	ret
+
+0000000000801542 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  801542:	55                   	push   %rbp
+  801543:	48 89 e5             	mov    %rsp,%rbp
+  801546:	53                   	push   %rbx
+  801547:	48 83 ec 08          	sub    $0x8,%rsp
+  80154b:	48 89 fa             	mov    %rdi,%rdx
+  80154e:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801551:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801556:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80155b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801560:	be 00 00 00 00       	mov    $0x0,%esi
+  801565:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80156b:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80156d:	48 85 c0             	test   %rax,%rax
+  801570:	7f 06                	jg     801578 <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801572:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801576:	c9                   	leave
+  801577:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801578:	49 89 c0             	mov    %rax,%r8
+  80157b:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  801580:	48 ba 50 34 80 00 00 	movabs $0x803450,%rdx
+  801587:	00 00 00 
+  80158a:	be 26 00 00 00       	mov    $0x26,%esi
+  80158f:	48 bf 6f 34 80 00 00 	movabs $0x80346f,%rdi
+  801596:	00 00 00 
+  801599:	b8 00 00 00 00       	mov    $0x0,%eax
+  80159e:	49 b9 65 2c 80 00 00 	movabs $0x802c65,%r9
+  8015a5:	00 00 00 
+  8015a8:	41 ff d1             	call   *%r9
+
+00000000008015ab <fork>:
+ * Hint:
+ *   Use sys_map_region, it can perform address space copying in one call
+ *   Remember to fix "thisenv" in the child process.
+ */
+envid_t
+fork(void) {
+  8015ab:	55                   	push   %rbp
+  8015ac:	48 89 e5             	mov    %rsp,%rbp
+  8015af:	41 55                	push   %r13
+  8015b1:	41 54                	push   %r12
+  8015b3:	53                   	push   %rbx
+  8015b4:	48 83 ec 08          	sub    $0x8,%rsp
+
+/* This must be inlined. Exercise for reader: why? */
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+    envid_t ret;
+    asm volatile("int %2"
+  8015b8:	b8 08 00 00 00       	mov    $0x8,%eax
+  8015bd:	cd 30                	int    $0x30
+  8015bf:	41 89 c5             	mov    %eax,%r13d
+    // LAB 9: Your code here
+
+    envid_t child_id = sys_exofork();
+    if (child_id < 0) {
+  8015c2:	85 c0                	test   %eax,%eax
+  8015c4:	0f 88 ae 00 00 00    	js     801678 <fork+0xcd>
+  8015ca:	89 c3                	mov    %eax,%ebx
+        return child_id;
+    }
+    if (child_id == 0) {
+  8015cc:	0f 84 b4 00 00 00    	je     801686 <fork+0xdb>
+        thisenv = &envs[ENVX(sys_getenvid())];
+        return 0;
+    }
+    int res = sys_map_region(0, NULL, child_id, NULL, MAX_USER_ADDRESS, PROT_ALL | PROT_LAZY | PROT_COMBINE);
+  8015d2:	41 b9 df 01 00 00    	mov    $0x1df,%r9d
+  8015d8:	49 b8 00 00 00 00 80 	movabs $0x8000000000,%r8
+  8015df:	00 00 00 
+  8015e2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8015e7:	89 c2                	mov    %eax,%edx
+  8015e9:	be 00 00 00 00       	mov    $0x0,%esi
+  8015ee:	bf 00 00 00 00       	mov    $0x0,%edi
+  8015f3:	48 b8 d7 11 80 00 00 	movabs $0x8011d7,%rax
+  8015fa:	00 00 00 
+  8015fd:	ff d0                	call   *%rax
+  8015ff:	41 89 c4             	mov    %eax,%r12d
+    if (res < 0) {
+  801602:	85 c0                	test   %eax,%eax
+  801604:	78 5d                	js     801663 <fork+0xb8>
+        goto error;
+    }
+    res = sys_env_set_pgfault_upcall(child_id, envs[ENVX(sys_getenvid())].env_pgfault_upcall);
+  801606:	48 b8 b0 10 80 00 00 	movabs $0x8010b0,%rax
+  80160d:	00 00 00 
+  801610:	ff d0                	call   *%rax
+  801612:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801617:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+  80161e:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  801625:	00 00 00 
+  801628:	48 01 d0             	add    %rdx,%rax
+  80162b:	48 8b b0 88 01 00 00 	mov    0x188(%rax),%rsi
+  801632:	44 89 ef             	mov    %r13d,%edi
+  801635:	48 b8 ad 14 80 00 00 	movabs $0x8014ad,%rax
+  80163c:	00 00 00 
+  80163f:	ff d0                	call   *%rax
+  801641:	41 89 c4             	mov    %eax,%r12d
+    if (res < 0) {
+  801644:	85 c0                	test   %eax,%eax
+  801646:	78 1b                	js     801663 <fork+0xb8>
+        goto error;
+    }
+    res = sys_env_set_status(child_id, ENV_RUNNABLE);
+  801648:	be 02 00 00 00       	mov    $0x2,%esi
+  80164d:	44 89 ef             	mov    %r13d,%edi
+  801650:	48 b8 0c 13 80 00 00 	movabs $0x80130c,%rax
+  801657:	00 00 00 
+  80165a:	ff d0                	call   *%rax
+  80165c:	41 89 c4             	mov    %eax,%r12d
+    if (res < 0) {
+  80165f:	85 c0                	test   %eax,%eax
+  801661:	79 15                	jns    801678 <fork+0xcd>
+        goto error;
+    }
+    return child_id;
+error:
+    ;
+    int res2 = sys_env_destroy(child_id);
+  801663:	89 df                	mov    %ebx,%edi
+  801665:	48 b8 45 10 80 00 00 	movabs $0x801045,%rax
+  80166c:	00 00 00 
+  80166f:	ff d0                	call   *%rax
+    if (res2 < 0) {
+  801671:	85 c0                	test   %eax,%eax
+  801673:	78 42                	js     8016b7 <fork+0x10c>
+        panic("Fork double fault");
+    }
+    return res;
+  801675:	45 89 e5             	mov    %r12d,%r13d
+}
+  801678:	44 89 e8             	mov    %r13d,%eax
+  80167b:	48 83 c4 08          	add    $0x8,%rsp
+  80167f:	5b                   	pop    %rbx
+  801680:	41 5c                	pop    %r12
+  801682:	41 5d                	pop    %r13
+  801684:	5d                   	pop    %rbp
+  801685:	c3                   	ret
+        thisenv = &envs[ENVX(sys_getenvid())];
+  801686:	48 b8 b0 10 80 00 00 	movabs $0x8010b0,%rax
+  80168d:	00 00 00 
+  801690:	ff d0                	call   *%rax
+  801692:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801697:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+  80169e:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8016a5:	00 00 00 
+  8016a8:	48 01 d0             	add    %rdx,%rax
+  8016ab:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  8016b2:	00 00 00 
+        return 0;
+  8016b5:	eb c1                	jmp    801678 <fork+0xcd>
+        panic("Fork double fault");
+  8016b7:	48 ba 7d 34 80 00 00 	movabs $0x80347d,%rdx
+  8016be:	00 00 00 
+  8016c1:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8016c6:	48 bf 8f 34 80 00 00 	movabs $0x80348f,%rdi
+  8016cd:	00 00 00 
+  8016d0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016d5:	48 b9 65 2c 80 00 00 	movabs $0x802c65,%rcx
+  8016dc:	00 00 00 
+  8016df:	ff d1                	call   *%rcx
+
+00000000008016e1 <sfork>:
+
+envid_t
+sfork() {
+  8016e1:	55                   	push   %rbp
+  8016e2:	48 89 e5             	mov    %rsp,%rbp
+    panic("sfork() is not implemented");
+  8016e5:	48 ba 9a 34 80 00 00 	movabs $0x80349a,%rdx
+  8016ec:	00 00 00 
+  8016ef:	be 36 00 00 00       	mov    $0x36,%esi
+  8016f4:	48 bf 8f 34 80 00 00 	movabs $0x80348f,%rdi
+  8016fb:	00 00 00 
+  8016fe:	b8 00 00 00 00       	mov    $0x0,%eax
+  801703:	48 b9 65 2c 80 00 00 	movabs $0x802c65,%rcx
+  80170a:	00 00 00 
+  80170d:	ff d1                	call   *%rcx
+
+000000000080170f <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80170f:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801716:	ff ff ff 
+  801719:	48 01 f8             	add    %rdi,%rax
+  80171c:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  801720:	c3                   	ret
+
+0000000000801721 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801721:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801728:	ff ff ff 
+  80172b:	48 01 f8             	add    %rdi,%rax
+  80172e:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  801732:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  801738:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  80173c:	c3                   	ret
+
+000000000080173d <fd_alloc_from>:
+}
+
+/* Like fd_alloc(), but only considers fds starting from fdnum,
+ * so that several fds can be found before their pages are allocated */
+int
+fd_alloc_from(int fdnum, struct Fd **fd_store) {
+  80173d:	55                   	push   %rbp
+  80173e:	48 89 e5             	mov    %rsp,%rbp
+  801741:	41 57                	push   %r15
+  801743:	41 56                	push   %r14
+  801745:	41 55                	push   %r13
+  801747:	41 54                	push   %r12
+  801749:	53                   	push   %rbx
+  80174a:	48 83 ec 08          	sub    $0x8,%rsp
+  80174e:	49 89 f7             	mov    %rsi,%r15
+    for (int i = MAX(fdnum, 0); i < MAXFD; i++) {
+  801751:	85 ff                	test   %edi,%edi
+  801753:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  801759:	44 0f 49 e7          	cmovns %edi,%r12d
+  80175d:	83 ff 1f             	cmp    $0x1f,%edi
+  801760:	7f 37                	jg     801799 <fd_alloc_from+0x5c>
+  801762:	49 63 dc             	movslq %r12d,%rbx
+  801765:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  80176c:	48 c1 e3 0c          	shl    $0xc,%rbx
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  801770:	49 be 46 28 80 00 00 	movabs $0x802846,%r14
+  801777:	00 00 00 
+        struct Fd *fd = INDEX2FD(i);
+  80177a:	49 89 dd             	mov    %rbx,%r13
+        if (!(get_prot(fd) & PROT_R)) {
+  80177d:	48 89 df             	mov    %rbx,%rdi
+  801780:	41 ff d6             	call   *%r14
+  801783:	83 e0 04             	and    $0x4,%eax
+  801786:	74 1c                	je     8017a4 <fd_alloc_from+0x67>
+    for (int i = MAX(fdnum, 0); i < MAXFD; i++) {
+  801788:	41 83 c4 01          	add    $0x1,%r12d
+  80178c:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801793:	41 83 fc 1f          	cmp    $0x1f,%r12d
+  801797:	7e e1                	jle    80177a <fd_alloc_from+0x3d>
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  801799:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  80179f:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  8017a4:	4d 89 2f             	mov    %r13,(%r15)
+}
+  8017a7:	48 83 c4 08          	add    $0x8,%rsp
+  8017ab:	5b                   	pop    %rbx
+  8017ac:	41 5c                	pop    %r12
+  8017ae:	41 5d                	pop    %r13
+  8017b0:	41 5e                	pop    %r14
+  8017b2:	41 5f                	pop    %r15
+  8017b4:	5d                   	pop    %rbp
+  8017b5:	c3                   	ret
+
+00000000008017b6 <fd_alloc>:
+fd_alloc(struct Fd **fd_store) {
+  8017b6:	55                   	push   %rbp
+  8017b7:	48 89 e5             	mov    %rsp,%rbp
+  8017ba:	48 89 fe             	mov    %rdi,%rsi
+    return fd_alloc_from(0, fd_store);
+  8017bd:	bf 00 00 00 00       	mov    $0x0,%edi
+  8017c2:	48 b8 3d 17 80 00 00 	movabs $0x80173d,%rax
+  8017c9:	00 00 00 
+  8017cc:	ff d0                	call   *%rax
+}
+  8017ce:	5d                   	pop    %rbp
+  8017cf:	c3                   	ret
+
+00000000008017d0 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  8017d0:	83 ff 1f             	cmp    $0x1f,%edi
+  8017d3:	77 39                	ja     80180e <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  8017d5:	55                   	push   %rbp
+  8017d6:	48 89 e5             	mov    %rsp,%rbp
+  8017d9:	41 54                	push   %r12
+  8017db:	53                   	push   %rbx
+  8017dc:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  8017df:	48 63 df             	movslq %edi,%rbx
+  8017e2:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  8017e9:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  8017ed:	48 89 df             	mov    %rbx,%rdi
+  8017f0:	48 b8 46 28 80 00 00 	movabs $0x802846,%rax
+  8017f7:	00 00 00 
+  8017fa:	ff d0                	call   *%rax
+  8017fc:	a8 04                	test   $0x4,%al
+  8017fe:	74 14                	je     801814 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  801800:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  801804:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801809:	5b                   	pop    %rbx
+  80180a:	41 5c                	pop    %r12
+  80180c:	5d                   	pop    %rbp
+  80180d:	c3                   	ret
+        return -E_INVAL;
+  80180e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801813:	c3                   	ret
+        return -E_INVAL;
+  801814:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801819:	eb ee                	jmp    801809 <fd_lookup+0x39>
+
+000000000080181b <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  80181b:	55                   	push   %rbp
+  80181c:	48 89 e5             	mov    %rsp,%rbp
+  80181f:	41 54                	push   %r12
+  801821:	53                   	push   %rbx
+  801822:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  801825:	48 b8 40 35 80 00 00 	movabs $0x803540,%rax
+  80182c:	00 00 00 
+  80182f:	48 bb 20 40 80 00 00 	movabs $0x804020,%rbx
+  801836:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  801839:	39 3b                	cmp    %edi,(%rbx)
+  80183b:	74 47                	je     801884 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  80183d:	48 83 c0 08          	add    $0x8,%rax
+  801841:	48 8b 18             	mov    (%rax),%rbx
+  801844:	48 85 db             	test   %rbx,%rbx
+  801847:	75 f0                	jne    801839 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801849:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801850:	00 00 00 
+  801853:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+  801859:	89 fa                	mov    %edi,%edx
+  80185b:	48 bf b8 34 80 00 00 	movabs $0x8034b8,%rdi
+  801862:	00 00 00 
+  801865:	b8 00 00 00 00       	mov    $0x0,%eax
+  80186a:	48 b9 9b 02 80 00 00 	movabs $0x80029b,%rcx
+  801871:	00 00 00 
+  801874:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  801876:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  80187b:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  80187f:	5b                   	pop    %rbx
+  801880:	41 5c                	pop    %r12
+  801882:	5d                   	pop    %rbp
+  801883:	c3                   	ret
+            return 0;
+  801884:	b8 00 00 00 00       	mov    $0x0,%eax
+  801889:	eb f0                	jmp    80187b <dev_lookup+0x60>
+
+000000000080188b <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  80188b:	55                   	push   %rbp
+  80188c:	48 89 e5             	mov    %rsp,%rbp
+  80188f:	41 55                	push   %r13
+  801891:	41 54                	push   %r12
+  801893:	53                   	push   %rbx
+  801894:	48 83 ec 18          	sub    $0x18,%rsp
+  801898:	48 89 fb             	mov    %rdi,%rbx
+  80189b:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80189e:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  8018a5:	ff ff ff 
+  8018a8:	48 01 df             	add    %rbx,%rdi
+  8018ab:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  8018af:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8018b3:	48 b8 d0 17 80 00 00 	movabs $0x8017d0,%rax
+  8018ba:	00 00 00 
+  8018bd:	ff d0                	call   *%rax
+  8018bf:	41 89 c5             	mov    %eax,%r13d
+  8018c2:	85 c0                	test   %eax,%eax
+  8018c4:	78 06                	js     8018cc <fd_close+0x41>
+  8018c6:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  8018ca:	74 1a                	je     8018e6 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  8018cc:	45 84 e4             	test   %r12b,%r12b
+  8018cf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018d4:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  8018d8:	44 89 e8             	mov    %r13d,%eax
+  8018db:	48 83 c4 18          	add    $0x18,%rsp
+  8018df:	5b                   	pop    %rbx
+  8018e0:	41 5c                	pop    %r12
+  8018e2:	41 5d                	pop    %r13
+  8018e4:	5d                   	pop    %rbp
+  8018e5:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8018e6:	8b 3b                	mov    (%rbx),%edi
+  8018e8:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8018ec:	48 b8 1b 18 80 00 00 	movabs $0x80181b,%rax
+  8018f3:	00 00 00 
+  8018f6:	ff d0                	call   *%rax
+  8018f8:	41 89 c5             	mov    %eax,%r13d
+  8018fb:	85 c0                	test   %eax,%eax
+  8018fd:	78 1b                	js     80191a <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  8018ff:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801903:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801907:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  80190d:	48 85 c0             	test   %rax,%rax
+  801910:	74 08                	je     80191a <fd_close+0x8f>
+  801912:	48 89 df             	mov    %rbx,%rdi
+  801915:	ff d0                	call   *%rax
+  801917:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  80191a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80191f:	48 89 de             	mov    %rbx,%rsi
+  801922:	bf 00 00 00 00       	mov    $0x0,%edi
+  801927:	48 b8 3c 12 80 00 00 	movabs $0x80123c,%rax
+  80192e:	00 00 00 
+  801931:	ff d0                	call   *%rax
+    return res;
+  801933:	eb a3                	jmp    8018d8 <fd_close+0x4d>
+
+0000000000801935 <close>:
+
+int
+close(int fdnum) {
+  801935:	55                   	push   %rbp
+  801936:	48 89 e5             	mov    %rsp,%rbp
+  801939:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  80193d:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801941:	48 b8 d0 17 80 00 00 	movabs $0x8017d0,%rax
+  801948:	00 00 00 
+  80194b:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80194d:	85 c0                	test   %eax,%eax
+  80194f:	78 15                	js     801966 <close+0x31>
+
+    return fd_close(fd, 1);
+  801951:	be 01 00 00 00       	mov    $0x1,%esi
+  801956:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80195a:	48 b8 8b 18 80 00 00 	movabs $0x80188b,%rax
+  801961:	00 00 00 
+  801964:	ff d0                	call   *%rax
+}
+  801966:	c9                   	leave
+  801967:	c3                   	ret
+
+0000000000801968 <close_all>:
+
+void
+close_all(void) {
+  801968:	55                   	push   %rbp
+  801969:	48 89 e5             	mov    %rsp,%rbp
+  80196c:	41 54                	push   %r12
+  80196e:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  80196f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801974:	49 bc 35 19 80 00 00 	movabs $0x801935,%r12
+  80197b:	00 00 00 
+  80197e:	89 df                	mov    %ebx,%edi
+  801980:	41 ff d4             	call   *%r12
+  801983:	83 c3 01             	add    $0x1,%ebx
+  801986:	83 fb 20             	cmp    $0x20,%ebx
+  801989:	75 f3                	jne    80197e <close_all+0x16>
+}
+  80198b:	5b                   	pop    %rbx
+  80198c:	41 5c                	pop    %r12
+  80198e:	5d                   	pop    %rbp
+  80198f:	c3                   	ret
+
+0000000000801990 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  801990:	55                   	push   %rbp
+  801991:	48 89 e5             	mov    %rsp,%rbp
+  801994:	41 57                	push   %r15
+  801996:	41 56                	push   %r14
+  801998:	41 55                	push   %r13
+  80199a:	41 54                	push   %r12
+  80199c:	53                   	push   %rbx
+  80199d:	48 83 ec 18          	sub    $0x18,%rsp
+  8019a1:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  8019a4:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  8019a8:	48 b8 d0 17 80 00 00 	movabs $0x8017d0,%rax
+  8019af:	00 00 00 
+  8019b2:	ff d0                	call   *%rax
+  8019b4:	89 c3                	mov    %eax,%ebx
+  8019b6:	85 c0                	test   %eax,%eax
+  8019b8:	0f 88 b8 00 00 00    	js     801a76 <dup+0xe6>
+    close(newfdnum);
+  8019be:	44 89 e7             	mov    %r12d,%edi
+  8019c1:	48 b8 35 19 80 00 00 	movabs $0x801935,%rax
+  8019c8:	00 00 00 
+  8019cb:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  8019cd:	4d 63 ec             	movslq %r12d,%r13
+  8019d0:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  8019d7:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  8019db:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  8019df:	4c 89 ff             	mov    %r15,%rdi
+  8019e2:	49 be 21 17 80 00 00 	movabs $0x801721,%r14
+  8019e9:	00 00 00 
+  8019ec:	41 ff d6             	call   *%r14
+  8019ef:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  8019f2:	4c 89 ef             	mov    %r13,%rdi
+  8019f5:	41 ff d6             	call   *%r14
+  8019f8:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  8019fb:	48 89 df             	mov    %rbx,%rdi
+  8019fe:	48 b8 46 28 80 00 00 	movabs $0x802846,%rax
+  801a05:	00 00 00 
+  801a08:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  801a0a:	a8 04                	test   $0x4,%al
+  801a0c:	74 2b                	je     801a39 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  801a0e:	41 89 c1             	mov    %eax,%r9d
+  801a11:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801a17:	4c 89 f1             	mov    %r14,%rcx
+  801a1a:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a1f:	48 89 de             	mov    %rbx,%rsi
+  801a22:	bf 00 00 00 00       	mov    $0x0,%edi
+  801a27:	48 b8 d7 11 80 00 00 	movabs $0x8011d7,%rax
+  801a2e:	00 00 00 
+  801a31:	ff d0                	call   *%rax
+  801a33:	89 c3                	mov    %eax,%ebx
+  801a35:	85 c0                	test   %eax,%eax
+  801a37:	78 4e                	js     801a87 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  801a39:	4c 89 ff             	mov    %r15,%rdi
+  801a3c:	48 b8 46 28 80 00 00 	movabs $0x802846,%rax
+  801a43:	00 00 00 
+  801a46:	ff d0                	call   *%rax
+  801a48:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801a4b:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801a51:	4c 89 e9             	mov    %r13,%rcx
+  801a54:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a59:	4c 89 fe             	mov    %r15,%rsi
+  801a5c:	bf 00 00 00 00       	mov    $0x0,%edi
+  801a61:	48 b8 d7 11 80 00 00 	movabs $0x8011d7,%rax
+  801a68:	00 00 00 
+  801a6b:	ff d0                	call   *%rax
+  801a6d:	89 c3                	mov    %eax,%ebx
+  801a6f:	85 c0                	test   %eax,%eax
+  801a71:	78 14                	js     801a87 <dup+0xf7>
+
+    return newfdnum;
+  801a73:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  801a76:	89 d8                	mov    %ebx,%eax
+  801a78:	48 83 c4 18          	add    $0x18,%rsp
+  801a7c:	5b                   	pop    %rbx
+  801a7d:	41 5c                	pop    %r12
+  801a7f:	41 5d                	pop    %r13
+  801a81:	41 5e                	pop    %r14
+  801a83:	41 5f                	pop    %r15
+  801a85:	5d                   	pop    %rbp
+  801a86:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  801a87:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801a8c:	4c 89 ee             	mov    %r13,%rsi
+  801a8f:	bf 00 00 00 00       	mov    $0x0,%edi
+  801a94:	49 bc 3c 12 80 00 00 	movabs $0x80123c,%r12
+  801a9b:	00 00 00 
+  801a9e:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  801aa1:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801aa6:	4c 89 f6             	mov    %r14,%rsi
+  801aa9:	bf 00 00 00 00       	mov    $0x0,%edi
+  801aae:	41 ff d4             	call   *%r12
+    return res;
+  801ab1:	eb c3                	jmp    801a76 <dup+0xe6>
+
+0000000000801ab3 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  801ab3:	55                   	push   %rbp
+  801ab4:	48 89 e5             	mov    %rsp,%rbp
+  801ab7:	41 56                	push   %r14
+  801ab9:	41 55                	push   %r13
+  801abb:	41 54                	push   %r12
+  801abd:	53                   	push   %rbx
+  801abe:	48 83 ec 10          	sub    $0x10,%rsp
+  801ac2:	89 fb                	mov    %edi,%ebx
+  801ac4:	49 89 f4             	mov    %rsi,%r12
+  801ac7:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801aca:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801ace:	48 b8 d0 17 80 00 00 	movabs $0x8017d0,%rax
+  801ad5:	00 00 00 
+  801ad8:	ff d0                	call   *%rax
+  801ada:	85 c0                	test   %eax,%eax
+  801adc:	78 4c                	js     801b2a <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801ade:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801ae2:	41 8b 3e             	mov    (%r14),%edi
+  801ae5:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801ae9:	48 b8 1b 18 80 00 00 	movabs $0x80181b,%rax
+  801af0:	00 00 00 
+  801af3:	ff d0                	call   *%rax
+  801af5:	85 c0                	test   %eax,%eax
+  801af7:	78 35                	js     801b2e <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801af9:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801afd:	83 e0 03             	and    $0x3,%eax
+  801b00:	83 f8 01             	cmp    $0x1,%eax
+  801b03:	74 2d                	je     801b32 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801b05:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801b09:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801b0d:	48 85 c0             	test   %rax,%rax
+  801b10:	74 56                	je     801b68 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  801b12:	4c 89 ea             	mov    %r13,%rdx
+  801b15:	4c 89 e6             	mov    %r12,%rsi
+  801b18:	4c 89 f7             	mov    %r14,%rdi
+  801b1b:	ff d0                	call   *%rax
+}
+  801b1d:	48 83 c4 10          	add    $0x10,%rsp
+  801b21:	5b                   	pop    %rbx
+  801b22:	41 5c                	pop    %r12
+  801b24:	41 5d                	pop    %r13
+  801b26:	41 5e                	pop    %r14
+  801b28:	5d                   	pop    %rbp
+  801b29:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801b2a:	48 98                	cltq
+  801b2c:	eb ef                	jmp    801b1d <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801b2e:	48 98                	cltq
+  801b30:	eb eb                	jmp    801b1d <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801b32:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801b39:	00 00 00 
+  801b3c:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+  801b42:	89 da                	mov    %ebx,%edx
+  801b44:	48 bf f9 34 80 00 00 	movabs $0x8034f9,%rdi
+  801b4b:	00 00 00 
+  801b4e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b53:	48 b9 9b 02 80 00 00 	movabs $0x80029b,%rcx
+  801b5a:	00 00 00 
+  801b5d:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801b5f:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801b66:	eb b5                	jmp    801b1d <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801b68:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801b6f:	eb ac                	jmp    801b1d <read+0x6a>
+
+0000000000801b71 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801b71:	55                   	push   %rbp
+  801b72:	48 89 e5             	mov    %rsp,%rbp
+  801b75:	41 57                	push   %r15
+  801b77:	41 56                	push   %r14
+  801b79:	41 55                	push   %r13
+  801b7b:	41 54                	push   %r12
+  801b7d:	53                   	push   %rbx
+  801b7e:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  801b82:	48 85 d2             	test   %rdx,%rdx
+  801b85:	74 54                	je     801bdb <readn+0x6a>
+  801b87:	41 89 fd             	mov    %edi,%r13d
+  801b8a:	49 89 f6             	mov    %rsi,%r14
+  801b8d:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  801b90:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  801b95:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  801b9a:	49 bf b3 1a 80 00 00 	movabs $0x801ab3,%r15
+  801ba1:	00 00 00 
+  801ba4:	4c 89 e2             	mov    %r12,%rdx
+  801ba7:	48 29 f2             	sub    %rsi,%rdx
+  801baa:	4c 01 f6             	add    %r14,%rsi
+  801bad:	44 89 ef             	mov    %r13d,%edi
+  801bb0:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  801bb3:	85 c0                	test   %eax,%eax
+  801bb5:	78 20                	js     801bd7 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  801bb7:	01 c3                	add    %eax,%ebx
+  801bb9:	85 c0                	test   %eax,%eax
+  801bbb:	74 08                	je     801bc5 <readn+0x54>
+  801bbd:	48 63 f3             	movslq %ebx,%rsi
+  801bc0:	4c 39 e6             	cmp    %r12,%rsi
+  801bc3:	72 df                	jb     801ba4 <readn+0x33>
+    }
+    return res;
+  801bc5:	48 63 c3             	movslq %ebx,%rax
+}
+  801bc8:	48 83 c4 08          	add    $0x8,%rsp
+  801bcc:	5b                   	pop    %rbx
+  801bcd:	41 5c                	pop    %r12
+  801bcf:	41 5d                	pop    %r13
+  801bd1:	41 5e                	pop    %r14
+  801bd3:	41 5f                	pop    %r15
+  801bd5:	5d                   	pop    %rbp
+  801bd6:	c3                   	ret
+        if (inc < 0) return inc;
+  801bd7:	48 98                	cltq
+  801bd9:	eb ed                	jmp    801bc8 <readn+0x57>
+    int inc = 1, res = 0;
+  801bdb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801be0:	eb e3                	jmp    801bc5 <readn+0x54>
+
+0000000000801be2 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  801be2:	55                   	push   %rbp
+  801be3:	48 89 e5             	mov    %rsp,%rbp
+  801be6:	41 56                	push   %r14
+  801be8:	41 55                	push   %r13
+  801bea:	41 54                	push   %r12
+  801bec:	53                   	push   %rbx
+  801bed:	48 83 ec 10          	sub    $0x10,%rsp
+  801bf1:	89 fb                	mov    %edi,%ebx
+  801bf3:	49 89 f4             	mov    %rsi,%r12
+  801bf6:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801bf9:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801bfd:	48 b8 d0 17 80 00 00 	movabs $0x8017d0,%rax
+  801c04:	00 00 00 
+  801c07:	ff d0                	call   *%rax
+  801c09:	85 c0                	test   %eax,%eax
+  801c0b:	78 47                	js     801c54 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801c0d:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801c11:	41 8b 3e             	mov    (%r14),%edi
+  801c14:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801c18:	48 b8 1b 18 80 00 00 	movabs $0x80181b,%rax
+  801c1f:	00 00 00 
+  801c22:	ff d0                	call   *%rax
+  801c24:	85 c0                	test   %eax,%eax
+  801c26:	78 30                	js     801c58 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801c28:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  801c2d:	74 2d                	je     801c5c <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801c2f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801c33:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801c37:	48 85 c0             	test   %rax,%rax
+  801c3a:	74 56                	je     801c92 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  801c3c:	4c 89 ea             	mov    %r13,%rdx
+  801c3f:	4c 89 e6             	mov    %r12,%rsi
+  801c42:	4c 89 f7             	mov    %r14,%rdi
+  801c45:	ff d0                	call   *%rax
+}
+  801c47:	48 83 c4 10          	add    $0x10,%rsp
+  801c4b:	5b                   	pop    %rbx
+  801c4c:	41 5c                	pop    %r12
+  801c4e:	41 5d                	pop    %r13
+  801c50:	41 5e                	pop    %r14
+  801c52:	5d                   	pop    %rbp
+  801c53:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801c54:	48 98                	cltq
+  801c56:	eb ef                	jmp    801c47 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801c58:	48 98                	cltq
+  801c5a:	eb eb                	jmp    801c47 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801c5c:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801c63:	00 00 00 
+  801c66:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+  801c6c:	89 da                	mov    %ebx,%edx
+  801c6e:	48 bf 15 35 80 00 00 	movabs $0x803515,%rdi
+  801c75:	00 00 00 
+  801c78:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c7d:	48 b9 9b 02 80 00 00 	movabs $0x80029b,%rcx
+  801c84:	00 00 00 
+  801c87:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801c89:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801c90:	eb b5                	jmp    801c47 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801c92:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801c99:	eb ac                	jmp    801c47 <write+0x65>
+
+0000000000801c9b <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  801c9b:	55                   	push   %rbp
+  801c9c:	48 89 e5             	mov    %rsp,%rbp
+  801c9f:	53                   	push   %rbx
+  801ca0:	48 83 ec 18          	sub    $0x18,%rsp
+  801ca4:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801ca6:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801caa:	48 b8 d0 17 80 00 00 	movabs $0x8017d0,%rax
+  801cb1:	00 00 00 
+  801cb4:	ff d0                	call   *%rax
+  801cb6:	85 c0                	test   %eax,%eax
+  801cb8:	78 0c                	js     801cc6 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  801cba:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801cbe:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  801cc1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801cc6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801cca:	c9                   	leave
+  801ccb:	c3                   	ret
+
+0000000000801ccc <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  801ccc:	55                   	push   %rbp
+  801ccd:	48 89 e5             	mov    %rsp,%rbp
+  801cd0:	41 55                	push   %r13
+  801cd2:	41 54                	push   %r12
+  801cd4:	53                   	push   %rbx
+  801cd5:	48 83 ec 18          	sub    $0x18,%rsp
+  801cd9:	89 fb                	mov    %edi,%ebx
+  801cdb:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801cde:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801ce2:	48 b8 d0 17 80 00 00 	movabs $0x8017d0,%rax
+  801ce9:	00 00 00 
+  801cec:	ff d0                	call   *%rax
+  801cee:	85 c0                	test   %eax,%eax
+  801cf0:	78 38                	js     801d2a <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801cf2:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  801cf6:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  801cfa:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801cfe:	48 b8 1b 18 80 00 00 	movabs $0x80181b,%rax
+  801d05:	00 00 00 
+  801d08:	ff d0                	call   *%rax
+  801d0a:	85 c0                	test   %eax,%eax
+  801d0c:	78 1c                	js     801d2a <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801d0e:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  801d13:	74 20                	je     801d35 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801d15:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801d19:	48 8b 40 30          	mov    0x30(%rax),%rax
+  801d1d:	48 85 c0             	test   %rax,%rax
+  801d20:	74 47                	je     801d69 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  801d22:	44 89 e6             	mov    %r12d,%esi
+  801d25:	4c 89 ef             	mov    %r13,%rdi
+  801d28:	ff d0                	call   *%rax
+}
+  801d2a:	48 83 c4 18          	add    $0x18,%rsp
+  801d2e:	5b                   	pop    %rbx
+  801d2f:	41 5c                	pop    %r12
+  801d31:	41 5d                	pop    %r13
+  801d33:	5d                   	pop    %rbp
+  801d34:	c3                   	ret
+                thisenv->env_id, fdnum);
+  801d35:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801d3c:	00 00 00 
+  801d3f:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801d45:	89 da                	mov    %ebx,%edx
+  801d47:	48 bf d8 34 80 00 00 	movabs $0x8034d8,%rdi
+  801d4e:	00 00 00 
+  801d51:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d56:	48 b9 9b 02 80 00 00 	movabs $0x80029b,%rcx
+  801d5d:	00 00 00 
+  801d60:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801d62:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801d67:	eb c1                	jmp    801d2a <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801d69:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801d6e:	eb ba                	jmp    801d2a <ftruncate+0x5e>
+
+0000000000801d70 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  801d70:	55                   	push   %rbp
+  801d71:	48 89 e5             	mov    %rsp,%rbp
+  801d74:	41 54                	push   %r12
+  801d76:	53                   	push   %rbx
+  801d77:	48 83 ec 10          	sub    $0x10,%rsp
+  801d7b:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801d7e:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801d82:	48 b8 d0 17 80 00 00 	movabs $0x8017d0,%rax
+  801d89:	00 00 00 
+  801d8c:	ff d0                	call   *%rax
+  801d8e:	85 c0                	test   %eax,%eax
+  801d90:	78 4e                	js     801de0 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801d92:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801d96:	41 8b 3c 24          	mov    (%r12),%edi
+  801d9a:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801d9e:	48 b8 1b 18 80 00 00 	movabs $0x80181b,%rax
+  801da5:	00 00 00 
+  801da8:	ff d0                	call   *%rax
+  801daa:	85 c0                	test   %eax,%eax
+  801dac:	78 32                	js     801de0 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801dae:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801db2:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  801db7:	74 30                	je     801de9 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  801db9:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  801dbc:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  801dc3:	00 00 00 
+    stat->st_isdir = 0;
+  801dc6:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  801dcd:	00 00 00 
+    stat->st_dev = dev;
+  801dd0:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  801dd7:	48 89 de             	mov    %rbx,%rsi
+  801dda:	4c 89 e7             	mov    %r12,%rdi
+  801ddd:	ff 50 28             	call   *0x28(%rax)
+}
+  801de0:	48 83 c4 10          	add    $0x10,%rsp
+  801de4:	5b                   	pop    %rbx
+  801de5:	41 5c                	pop    %r12
+  801de7:	5d                   	pop    %rbp
+  801de8:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801de9:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801dee:	eb f0                	jmp    801de0 <fstat+0x70>
+
+0000000000801df0 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  801df0:	55                   	push   %rbp
+  801df1:	48 89 e5             	mov    %rsp,%rbp
+  801df4:	41 54                	push   %r12
+  801df6:	53                   	push   %rbx
+  801df7:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  801dfa:	be 00 00 00 00       	mov    $0x0,%esi
+  801dff:	48 b8 d3 21 80 00 00 	movabs $0x8021d3,%rax
+  801e06:	00 00 00 
+  801e09:	ff d0                	call   *%rax
+  801e0b:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  801e0d:	85 c0                	test   %eax,%eax
+  801e0f:	78 25                	js     801e36 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  801e11:	4c 89 e6             	mov    %r12,%rsi
+  801e14:	89 c7                	mov    %eax,%edi
+  801e16:	48 b8 70 1d 80 00 00 	movabs $0x801d70,%rax
+  801e1d:	00 00 00 
+  801e20:	ff d0                	call   *%rax
+  801e22:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  801e25:	89 df                	mov    %ebx,%edi
+  801e27:	48 b8 35 19 80 00 00 	movabs $0x801935,%rax
+  801e2e:	00 00 00 
+  801e31:	ff d0                	call   *%rax
+
+    return res;
+  801e33:	44 89 e3             	mov    %r12d,%ebx
+}
+  801e36:	89 d8                	mov    %ebx,%eax
+  801e38:	5b                   	pop    %rbx
+  801e39:	41 5c                	pop    %r12
+  801e3b:	5d                   	pop    %rbp
+  801e3c:	c3                   	ret
+
+0000000000801e3d <fsipc>:
+ * response may be written back to fsipcbuf.
+ * type: request code, passed as the simple integer IPC value.
+ * dstva: virtual address at which to receive reply page, 0 if none.
+ * Returns result from the file server. */
+static int
+fsipc(unsigned type, void *dstva) {
+  801e3d:	55                   	push   %rbp
+  801e3e:	48 89 e5             	mov    %rsp,%rbp
+  801e41:	41 54                	push   %r12
+  801e43:	53                   	push   %rbx
+  801e44:	48 83 ec 10          	sub    $0x10,%rsp
+  801e48:	41 89 fc             	mov    %edi,%r12d
+  801e4b:	48 89 f3             	mov    %rsi,%rbx
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  801e4e:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  801e55:	00 00 00 
+  801e58:	83 38 00             	cmpl   $0x0,(%rax)
+  801e5b:	74 5e                	je     801ebb <fsipc+0x7e>
+    if (debug) {
+        cprintf("[%08x] fsipc %d %08x\n",
+                thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+    }
+
+    ipc_send(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW);
+  801e5d:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  801e63:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  801e68:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  801e6f:	00 00 00 
+  801e72:	44 89 e6             	mov    %r12d,%esi
+  801e75:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  801e7c:	00 00 00 
+  801e7f:	8b 38                	mov    (%rax),%edi
+  801e81:	48 b8 dd 2d 80 00 00 	movabs $0x802ddd,%rax
+  801e88:	00 00 00 
+  801e8b:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  801e8d:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  801e94:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  801e95:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801e9a:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  801e9e:	48 89 de             	mov    %rbx,%rsi
+  801ea1:	bf 00 00 00 00       	mov    $0x0,%edi
+  801ea6:	48 b8 08 2d 80 00 00 	movabs $0x802d08,%rax
+  801ead:	00 00 00 
+  801eb0:	ff d0                	call   *%rax
+}
+  801eb2:	48 83 c4 10          	add    $0x10,%rsp
+  801eb6:	5b                   	pop    %rbx
+  801eb7:	41 5c                	pop    %r12
+  801eb9:	5d                   	pop    %rbp
+  801eba:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  801ebb:	bf 03 00 00 00       	mov    $0x3,%edi
+  801ec0:	48 b8 80 2e 80 00 00 	movabs $0x802e80,%rax
+  801ec7:	00 00 00 
+  801eca:	ff d0                	call   *%rax
+  801ecc:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  801ed3:	00 00 
+  801ed5:	eb 86                	jmp    801e5d <fsipc+0x20>
+
+0000000000801ed7 <devfile_trunc>:
+    return 0;
+}
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  801ed7:	55                   	push   %rbp
+  801ed8:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801edb:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  801ee2:	00 00 00 
+  801ee5:	8b 57 0c             	mov    0xc(%rdi),%edx
+  801ee8:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  801eea:	89 70 04             	mov    %esi,0x4(%rax)
+
+    return fsipc(FSREQ_SET_SIZE, NULL);
+  801eed:	be 00 00 00 00       	mov    $0x0,%esi
+  801ef2:	bf 02 00 00 00       	mov    $0x2,%edi
+  801ef7:	48 b8 3d 1e 80 00 00 	movabs $0x801e3d,%rax
+  801efe:	00 00 00 
+  801f01:	ff d0                	call   *%rax
+}
+  801f03:	5d                   	pop    %rbp
+  801f04:	c3                   	ret
+
+0000000000801f05 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  801f05:	55                   	push   %rbp
+  801f06:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801f09:	8b 47 0c             	mov    0xc(%rdi),%eax
+  801f0c:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  801f13:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  801f15:	be 00 00 00 00       	mov    $0x0,%esi
+  801f1a:	bf 06 00 00 00       	mov    $0x6,%edi
+  801f1f:	48 b8 3d 1e 80 00 00 	movabs $0x801e3d,%rax
+  801f26:	00 00 00 
+  801f29:	ff d0                	call   *%rax
+}
+  801f2b:	5d                   	pop    %rbp
+  801f2c:	c3                   	ret
+
+0000000000801f2d <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  801f2d:	55                   	push   %rbp
+  801f2e:	48 89 e5             	mov    %rsp,%rbp
+  801f31:	41 54                	push   %r12
+  801f33:	53                   	push   %rbx
+  801f34:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801f37:	8b 47 0c             	mov    0xc(%rdi),%eax
+  801f3a:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  801f41:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  801f43:	be 00 00 00 00       	mov    $0x0,%esi
+  801f48:	bf 05 00 00 00       	mov    $0x5,%edi
+  801f4d:	48 b8 3d 1e 80 00 00 	movabs $0x801e3d,%rax
+  801f54:	00 00 00 
+  801f57:	ff d0                	call   *%rax
+    if (res < 0) {
+  801f59:	85 c0                	test   %eax,%eax
+  801f5b:	78 3d                	js     801f9a <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801f5d:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  801f64:	00 00 00 
+  801f67:	4c 89 e6             	mov    %r12,%rsi
+  801f6a:	48 89 df             	mov    %rbx,%rdi
+  801f6d:	48 b8 c0 0b 80 00 00 	movabs $0x800bc0,%rax
+  801f74:	00 00 00 
+  801f77:	ff d0                	call   *%rax
+    st->st_size  = fsipcbuf.statRet.ret_size;
+  801f79:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  801f80:	00 
+  801f81:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801f87:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  801f8e:	00 
+  801f8f:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  801f95:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801f9a:	5b                   	pop    %rbx
+  801f9b:	41 5c                	pop    %r12
+  801f9d:	5d                   	pop    %rbp
+  801f9e:	c3                   	ret
+
+0000000000801f9f <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  801f9f:	55                   	push   %rbp
+  801fa0:	48 89 e5             	mov    %rsp,%rbp
+  801fa3:	41 57                	push   %r15
+  801fa5:	41 56                	push   %r14
+  801fa7:	41 55                	push   %r13
+  801fa9:	41 54                	push   %r12
+  801fab:	53                   	push   %rbx
+  801fac:	48 83 ec 18          	sub    $0x18,%rsp
+  801fb0:	49 89 fe             	mov    %rdi,%r14
+  801fb3:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+  801fb7:	48 89 d3             	mov    %rdx,%rbx
+    while (n > sizeof(fsipcbuf.write.req_buf))
+  801fba:	48 81 fa f0 0f 00 00 	cmp    $0xff0,%rdx
+  801fc1:	0f 86 e4 00 00 00    	jbe    8020ab <devfile_write+0x10c>
+  801fc7:	49 89 f4             	mov    %rsi,%r12
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801fca:	49 bd 00 60 80 00 00 	movabs $0x806000,%r13
+  801fd1:	00 00 00 
+        memcpy(fsipcbuf.write.req_buf, buf, sizeof(fsipcbuf.write.req_buf));
+  801fd4:	49 bf 21 0e 80 00 00 	movabs $0x800e21,%r15
+  801fdb:	00 00 00 
+  801fde:	eb 03                	jmp    801fe3 <devfile_write+0x44>
+        buf += sizeof(fsipcbuf.write.req_buf);
+  801fe0:	49 89 f4             	mov    %rsi,%r12
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801fe3:	41 8b 46 0c          	mov    0xc(%r14),%eax
+  801fe7:	41 89 45 00          	mov    %eax,0x0(%r13)
+        fsipcbuf.write.req_n      = sizeof(fsipcbuf.write.req_buf);
+  801feb:	49 c7 45 08 f0 0f 00 	movq   $0xff0,0x8(%r13)
+  801ff2:	00 
+        memcpy(fsipcbuf.write.req_buf, buf, sizeof(fsipcbuf.write.req_buf));
+  801ff3:	ba f0 0f 00 00       	mov    $0xff0,%edx
+  801ff8:	4c 89 e6             	mov    %r12,%rsi
+  801ffb:	48 bf 10 60 80 00 00 	movabs $0x806010,%rdi
+  802002:	00 00 00 
+  802005:	41 ff d7             	call   *%r15
+        ssize_t res = fsipc(FSREQ_WRITE, NULL);
+  802008:	be 00 00 00 00       	mov    $0x0,%esi
+  80200d:	bf 04 00 00 00       	mov    $0x4,%edi
+  802012:	48 b8 3d 1e 80 00 00 	movabs $0x801e3d,%rax
+  802019:	00 00 00 
+  80201c:	ff d0                	call   *%rax
+  80201e:	48 63 d0             	movslq %eax,%rdx
+        if (res < 0 || res < sizeof(fsipcbuf.write.req_buf))
+  802021:	3d ef 0f 00 00       	cmp    $0xfef,%eax
+  802026:	7e 71                	jle    802099 <devfile_write+0xfa>
+        buf += sizeof(fsipcbuf.write.req_buf);
+  802028:	49 8d b4 24 f0 0f 00 	lea    0xff0(%r12),%rsi
+  80202f:	00 
+        n -= sizeof(fsipcbuf.write.req_buf);
+  802030:	48 81 eb f0 0f 00 00 	sub    $0xff0,%rbx
+    while (n > sizeof(fsipcbuf.write.req_buf))
+  802037:	48 81 fb f0 0f 00 00 	cmp    $0xff0,%rbx
+  80203e:	77 a0                	ja     801fe0 <devfile_write+0x41>
+        written += sizeof(fsipcbuf.write.req_buf);
+  802040:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802044:	49 29 c4             	sub    %rax,%r12
+  802047:	4d 8d a4 24 f0 0f 00 	lea    0xff0(%r12),%r12
+  80204e:	00 
+    fsipcbuf.write.req_fileid = fd->fd_file.id;
+  80204f:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  802056:	00 00 00 
+  802059:	41 8b 56 0c          	mov    0xc(%r14),%edx
+  80205d:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.write.req_n      = n;
+  80205f:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    memcpy(fsipcbuf.write.req_buf, buf, n);
+  802063:	48 89 da             	mov    %rbx,%rdx
+  802066:	48 8d 78 10          	lea    0x10(%rax),%rdi
+  80206a:	48 b8 21 0e 80 00 00 	movabs $0x800e21,%rax
+  802071:	00 00 00 
+  802074:	ff d0                	call   *%rax
+    ssize_t res = fsipc(FSREQ_WRITE, NULL);
+  802076:	be 00 00 00 00       	mov    $0x0,%esi
+  80207b:	bf 04 00 00 00       	mov    $0x4,%edi
+  802080:	48 b8 3d 1e 80 00 00 	movabs $0x801e3d,%rax
+  802087:	00 00 00 
+  80208a:	ff d0                	call   *%rax
+  80208c:	48 63 d0             	movslq %eax,%rdx
+    written += res;
+  80208f:	49 01 d4             	add    %rdx,%r12
+  802092:	48 85 d2             	test   %rdx,%rdx
+  802095:	49 0f 49 d4          	cmovns %r12,%rdx
+}
+  802099:	48 89 d0             	mov    %rdx,%rax
+  80209c:	48 83 c4 18          	add    $0x18,%rsp
+  8020a0:	5b                   	pop    %rbx
+  8020a1:	41 5c                	pop    %r12
+  8020a3:	41 5d                	pop    %r13
+  8020a5:	41 5e                	pop    %r14
+  8020a7:	41 5f                	pop    %r15
+  8020a9:	5d                   	pop    %rbp
+  8020aa:	c3                   	ret
+    while (n > sizeof(fsipcbuf.write.req_buf))
+  8020ab:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+    ssize_t written = 0;
+  8020af:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8020b5:	eb 98                	jmp    80204f <devfile_write+0xb0>
+
+00000000008020b7 <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  8020b7:	55                   	push   %rbp
+  8020b8:	48 89 e5             	mov    %rsp,%rbp
+  8020bb:	41 57                	push   %r15
+  8020bd:	41 56                	push   %r14
+  8020bf:	41 55                	push   %r13
+  8020c1:	41 54                	push   %r12
+  8020c3:	53                   	push   %rbx
+  8020c4:	48 83 ec 18          	sub    $0x18,%rsp
+  8020c8:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  8020cc:	49 89 f6             	mov    %rsi,%r14
+  8020cf:	49 89 d4             	mov    %rdx,%r12
+    while (n > sizeof(fsipcbuf.readRet.ret_buf))
+  8020d2:	48 81 fa 00 10 00 00 	cmp    $0x1000,%rdx
+  8020d9:	0f 86 ea 00 00 00    	jbe    8021c9 <devfile_read+0x112>
+    ssize_t readsz = 0;
+  8020df:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  8020e6:	00 
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8020e7:	49 bf 00 60 80 00 00 	movabs $0x806000,%r15
+  8020ee:	00 00 00 
+  8020f1:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8020f5:	8b 40 0c             	mov    0xc(%rax),%eax
+  8020f8:	41 89 07             	mov    %eax,(%r15)
+        fsipcbuf.read.req_n = sizeof(fsipcbuf.readRet.ret_buf);
+  8020fb:	49 c7 47 08 00 10 00 	movq   $0x1000,0x8(%r15)
+  802102:	00 
+        ssize_t res = fsipc(FSREQ_READ, NULL);
+  802103:	be 00 00 00 00       	mov    $0x0,%esi
+  802108:	bf 03 00 00 00       	mov    $0x3,%edi
+  80210d:	48 b8 3d 1e 80 00 00 	movabs $0x801e3d,%rax
+  802114:	00 00 00 
+  802117:	ff d0                	call   *%rax
+  802119:	4c 63 e8             	movslq %eax,%r13
+        if (res < 0)
+  80211c:	4d 85 ed             	test   %r13,%r13
+  80211f:	0f 88 92 00 00 00    	js     8021b7 <devfile_read+0x100>
+        memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  802125:	4c 89 ea             	mov    %r13,%rdx
+  802128:	4c 89 fe             	mov    %r15,%rsi
+  80212b:	4c 89 f7             	mov    %r14,%rdi
+  80212e:	48 b8 21 0e 80 00 00 	movabs $0x800e21,%rax
+  802135:	00 00 00 
+  802138:	ff d0                	call   *%rax
+        if (res < sizeof(fsipcbuf.readRet.ret_buf))
+  80213a:	49 81 fd ff 0f 00 00 	cmp    $0xfff,%r13
+  802141:	76 6d                	jbe    8021b0 <devfile_read+0xf9>
+        readsz += res;
+  802143:	4c 01 6d c0          	add    %r13,-0x40(%rbp)
+        buf += res;
+  802147:	4d 01 ee             	add    %r13,%r14
+        n -= res;
+  80214a:	4d 29 ec             	sub    %r13,%r12
+    while (n > sizeof(fsipcbuf.readRet.ret_buf))
+  80214d:	49 81 fc 00 10 00 00 	cmp    $0x1000,%r12
+  802154:	77 9b                	ja     8020f1 <devfile_read+0x3a>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802156:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  80215d:	00 00 00 
+  802160:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  802164:	8b 51 0c             	mov    0xc(%rcx),%edx
+  802167:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.read.req_n = n;
+  802169:	4c 89 60 08          	mov    %r12,0x8(%rax)
+    ssize_t res = fsipc(FSREQ_READ, NULL);
+  80216d:	be 00 00 00 00       	mov    $0x0,%esi
+  802172:	bf 03 00 00 00       	mov    $0x3,%edi
+  802177:	48 b8 3d 1e 80 00 00 	movabs $0x801e3d,%rax
+  80217e:	00 00 00 
+  802181:	ff d0                	call   *%rax
+  802183:	4c 63 e8             	movslq %eax,%r13
+    if (res < 0)
+  802186:	4d 85 ed             	test   %r13,%r13
+  802189:	78 2c                	js     8021b7 <devfile_read+0x100>
+    memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  80218b:	4c 89 ea             	mov    %r13,%rdx
+  80218e:	48 be 00 60 80 00 00 	movabs $0x806000,%rsi
+  802195:	00 00 00 
+  802198:	4c 89 f7             	mov    %r14,%rdi
+  80219b:	48 b8 21 0e 80 00 00 	movabs $0x800e21,%rax
+  8021a2:	00 00 00 
+  8021a5:	ff d0                	call   *%rax
+    readsz += res;
+  8021a7:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8021ab:	49 01 c5             	add    %rax,%r13
+    return readsz;
+  8021ae:	eb 07                	jmp    8021b7 <devfile_read+0x100>
+            return readsz + res;
+  8021b0:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8021b4:	49 01 c5             	add    %rax,%r13
+}
+  8021b7:	4c 89 e8             	mov    %r13,%rax
+  8021ba:	48 83 c4 18          	add    $0x18,%rsp
+  8021be:	5b                   	pop    %rbx
+  8021bf:	41 5c                	pop    %r12
+  8021c1:	41 5d                	pop    %r13
+  8021c3:	41 5e                	pop    %r14
+  8021c5:	41 5f                	pop    %r15
+  8021c7:	5d                   	pop    %rbp
+  8021c8:	c3                   	ret
+    ssize_t readsz = 0;
+  8021c9:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  8021d0:	00 
+  8021d1:	eb 83                	jmp    802156 <devfile_read+0x9f>
+
+00000000008021d3 <open>:
+open(const char *path, int mode) {
+  8021d3:	55                   	push   %rbp
+  8021d4:	48 89 e5             	mov    %rsp,%rbp
+  8021d7:	41 55                	push   %r13
+  8021d9:	41 54                	push   %r12
+  8021db:	53                   	push   %rbx
+  8021dc:	48 83 ec 18          	sub    $0x18,%rsp
+  8021e0:	49 89 fc             	mov    %rdi,%r12
+  8021e3:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  8021e6:	48 b8 82 0b 80 00 00 	movabs $0x800b82,%rax
+  8021ed:	00 00 00 
+  8021f0:	ff d0                	call   *%rax
+  8021f2:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  8021f8:	0f 87 8a 00 00 00    	ja     802288 <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8021fe:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802202:	48 b8 b6 17 80 00 00 	movabs $0x8017b6,%rax
+  802209:	00 00 00 
+  80220c:	ff d0                	call   *%rax
+  80220e:	89 c3                	mov    %eax,%ebx
+  802210:	85 c0                	test   %eax,%eax
+  802212:	78 50                	js     802264 <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  802214:	4c 89 e6             	mov    %r12,%rsi
+  802217:	48 bb 00 60 80 00 00 	movabs $0x806000,%rbx
+  80221e:	00 00 00 
+  802221:	48 89 df             	mov    %rbx,%rdi
+  802224:	48 b8 c0 0b 80 00 00 	movabs $0x800bc0,%rax
+  80222b:	00 00 00 
+  80222e:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  802230:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  802237:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  80223b:	bf 01 00 00 00       	mov    $0x1,%edi
+  802240:	48 b8 3d 1e 80 00 00 	movabs $0x801e3d,%rax
+  802247:	00 00 00 
+  80224a:	ff d0                	call   *%rax
+  80224c:	89 c3                	mov    %eax,%ebx
+  80224e:	85 c0                	test   %eax,%eax
+  802250:	78 1f                	js     802271 <open+0x9e>
+    return fd2num(fd);
+  802252:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802256:	48 b8 0f 17 80 00 00 	movabs $0x80170f,%rax
+  80225d:	00 00 00 
+  802260:	ff d0                	call   *%rax
+  802262:	89 c3                	mov    %eax,%ebx
+}
+  802264:	89 d8                	mov    %ebx,%eax
+  802266:	48 83 c4 18          	add    $0x18,%rsp
+  80226a:	5b                   	pop    %rbx
+  80226b:	41 5c                	pop    %r12
+  80226d:	41 5d                	pop    %r13
+  80226f:	5d                   	pop    %rbp
+  802270:	c3                   	ret
+        fd_close(fd, 0);
+  802271:	be 00 00 00 00       	mov    $0x0,%esi
+  802276:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80227a:	48 b8 8b 18 80 00 00 	movabs $0x80188b,%rax
+  802281:	00 00 00 
+  802284:	ff d0                	call   *%rax
+        return res;
+  802286:	eb dc                	jmp    802264 <open+0x91>
+        return -E_BAD_PATH;
+  802288:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  80228d:	eb d5                	jmp    802264 <open+0x91>
+
+000000000080228f <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  80228f:	55                   	push   %rbp
+  802290:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc(FSREQ_SYNC, NULL);
+  802293:	be 00 00 00 00       	mov    $0x0,%esi
+  802298:	bf 08 00 00 00       	mov    $0x8,%edi
+  80229d:	48 b8 3d 1e 80 00 00 	movabs $0x801e3d,%rax
+  8022a4:	00 00 00 
+  8022a7:	ff d0                	call   *%rax
+}
+  8022a9:	5d                   	pop    %rbp
+  8022aa:	c3                   	ret
+
+00000000008022ab <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  8022ab:	55                   	push   %rbp
+  8022ac:	48 89 e5             	mov    %rsp,%rbp
+  8022af:	41 54                	push   %r12
+  8022b1:	53                   	push   %rbx
+  8022b2:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8022b5:	48 b8 21 17 80 00 00 	movabs $0x801721,%rax
+  8022bc:	00 00 00 
+  8022bf:	ff d0                	call   *%rax
+  8022c1:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  8022c4:	48 be 60 35 80 00 00 	movabs $0x803560,%rsi
+  8022cb:	00 00 00 
+  8022ce:	48 89 df             	mov    %rbx,%rdi
+  8022d1:	48 b8 c0 0b 80 00 00 	movabs $0x800bc0,%rax
+  8022d8:	00 00 00 
+  8022db:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  8022dd:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  8022e2:	41 2b 04 24          	sub    (%r12),%eax
+  8022e6:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  8022ec:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8022f3:	00 00 00 
+    stat->st_dev = &devpipe;
+  8022f6:	48 b8 60 40 80 00 00 	movabs $0x804060,%rax
+  8022fd:	00 00 00 
+  802300:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  802307:	b8 00 00 00 00       	mov    $0x0,%eax
+  80230c:	5b                   	pop    %rbx
+  80230d:	41 5c                	pop    %r12
+  80230f:	5d                   	pop    %rbp
+  802310:	c3                   	ret
+
+0000000000802311 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  802311:	55                   	push   %rbp
+  802312:	48 89 e5             	mov    %rsp,%rbp
+  802315:	41 54                	push   %r12
+  802317:	53                   	push   %rbx
+  802318:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  80231b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802320:	48 89 fe             	mov    %rdi,%rsi
+  802323:	bf 00 00 00 00       	mov    $0x0,%edi
+  802328:	49 bc 3c 12 80 00 00 	movabs $0x80123c,%r12
+  80232f:	00 00 00 
+  802332:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  802335:	48 89 df             	mov    %rbx,%rdi
+  802338:	48 b8 21 17 80 00 00 	movabs $0x801721,%rax
+  80233f:	00 00 00 
+  802342:	ff d0                	call   *%rax
+  802344:	48 89 c6             	mov    %rax,%rsi
+  802347:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80234c:	bf 00 00 00 00       	mov    $0x0,%edi
+  802351:	41 ff d4             	call   *%r12
+}
+  802354:	5b                   	pop    %rbx
+  802355:	41 5c                	pop    %r12
+  802357:	5d                   	pop    %rbp
+  802358:	c3                   	ret
+
+0000000000802359 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  802359:	55                   	push   %rbp
+  80235a:	48 89 e5             	mov    %rsp,%rbp
+  80235d:	41 57                	push   %r15
+  80235f:	41 56                	push   %r14
+  802361:	41 55                	push   %r13
+  802363:	41 54                	push   %r12
+  802365:	53                   	push   %rbx
+  802366:	48 83 ec 18          	sub    $0x18,%rsp
+  80236a:	49 89 fc             	mov    %rdi,%r12
+  80236d:	49 89 f5             	mov    %rsi,%r13
+  802370:	49 89 d7             	mov    %rdx,%r15
+  802373:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802377:	48 b8 21 17 80 00 00 	movabs $0x801721,%rax
+  80237e:	00 00 00 
+  802381:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  802383:	4d 85 ff             	test   %r15,%r15
+  802386:	0f 84 af 00 00 00    	je     80243b <devpipe_write+0xe2>
+  80238c:	48 89 c3             	mov    %rax,%rbx
+  80238f:	4c 89 f8             	mov    %r15,%rax
+  802392:	4d 89 ef             	mov    %r13,%r15
+  802395:	4c 01 e8             	add    %r13,%rax
+  802398:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80239c:	49 bd 44 11 80 00 00 	movabs $0x801144,%r13
+  8023a3:	00 00 00 
+            sys_yield();
+  8023a6:	49 be e1 10 80 00 00 	movabs $0x8010e1,%r14
+  8023ad:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  8023b0:	8b 73 04             	mov    0x4(%rbx),%esi
+  8023b3:	48 63 ce             	movslq %esi,%rcx
+  8023b6:	48 63 03             	movslq (%rbx),%rax
+  8023b9:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  8023bf:	48 39 c1             	cmp    %rax,%rcx
+  8023c2:	72 2e                	jb     8023f2 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8023c4:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8023c9:	48 89 da             	mov    %rbx,%rdx
+  8023cc:	be 00 10 00 00       	mov    $0x1000,%esi
+  8023d1:	4c 89 e7             	mov    %r12,%rdi
+  8023d4:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  8023d7:	85 c0                	test   %eax,%eax
+  8023d9:	74 66                	je     802441 <devpipe_write+0xe8>
+            sys_yield();
+  8023db:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  8023de:	8b 73 04             	mov    0x4(%rbx),%esi
+  8023e1:	48 63 ce             	movslq %esi,%rcx
+  8023e4:	48 63 03             	movslq (%rbx),%rax
+  8023e7:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  8023ed:	48 39 c1             	cmp    %rax,%rcx
+  8023f0:	73 d2                	jae    8023c4 <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8023f2:	41 0f b6 3f          	movzbl (%r15),%edi
+  8023f6:	48 89 ca             	mov    %rcx,%rdx
+  8023f9:	48 c1 ea 03          	shr    $0x3,%rdx
+  8023fd:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  802404:	08 10 20 
+  802407:	48 f7 e2             	mul    %rdx
+  80240a:	48 c1 ea 06          	shr    $0x6,%rdx
+  80240e:	48 89 d0             	mov    %rdx,%rax
+  802411:	48 c1 e0 09          	shl    $0x9,%rax
+  802415:	48 29 d0             	sub    %rdx,%rax
+  802418:	48 c1 e0 03          	shl    $0x3,%rax
+  80241c:	48 29 c1             	sub    %rax,%rcx
+  80241f:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  802424:	83 c6 01             	add    $0x1,%esi
+  802427:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  80242a:	49 83 c7 01          	add    $0x1,%r15
+  80242e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802432:	49 39 c7             	cmp    %rax,%r15
+  802435:	0f 85 75 ff ff ff    	jne    8023b0 <devpipe_write+0x57>
+    return n;
+  80243b:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80243f:	eb 05                	jmp    802446 <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  802441:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802446:	48 83 c4 18          	add    $0x18,%rsp
+  80244a:	5b                   	pop    %rbx
+  80244b:	41 5c                	pop    %r12
+  80244d:	41 5d                	pop    %r13
+  80244f:	41 5e                	pop    %r14
+  802451:	41 5f                	pop    %r15
+  802453:	5d                   	pop    %rbp
+  802454:	c3                   	ret
+
+0000000000802455 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  802455:	55                   	push   %rbp
+  802456:	48 89 e5             	mov    %rsp,%rbp
+  802459:	41 57                	push   %r15
+  80245b:	41 56                	push   %r14
+  80245d:	41 55                	push   %r13
+  80245f:	41 54                	push   %r12
+  802461:	53                   	push   %rbx
+  802462:	48 83 ec 18          	sub    $0x18,%rsp
+  802466:	49 89 fc             	mov    %rdi,%r12
+  802469:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  80246d:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802471:	48 b8 21 17 80 00 00 	movabs $0x801721,%rax
+  802478:	00 00 00 
+  80247b:	ff d0                	call   *%rax
+  80247d:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  802480:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802486:	49 bd 44 11 80 00 00 	movabs $0x801144,%r13
+  80248d:	00 00 00 
+            sys_yield();
+  802490:	49 be e1 10 80 00 00 	movabs $0x8010e1,%r14
+  802497:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  80249a:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  80249f:	74 7d                	je     80251e <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  8024a1:	8b 03                	mov    (%rbx),%eax
+  8024a3:	3b 43 04             	cmp    0x4(%rbx),%eax
+  8024a6:	75 26                	jne    8024ce <devpipe_read+0x79>
+            if (i > 0) return i;
+  8024a8:	4d 85 ff             	test   %r15,%r15
+  8024ab:	75 77                	jne    802524 <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8024ad:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8024b2:	48 89 da             	mov    %rbx,%rdx
+  8024b5:	be 00 10 00 00       	mov    $0x1000,%esi
+  8024ba:	4c 89 e7             	mov    %r12,%rdi
+  8024bd:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  8024c0:	85 c0                	test   %eax,%eax
+  8024c2:	74 72                	je     802536 <devpipe_read+0xe1>
+            sys_yield();
+  8024c4:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  8024c7:	8b 03                	mov    (%rbx),%eax
+  8024c9:	3b 43 04             	cmp    0x4(%rbx),%eax
+  8024cc:	74 df                	je     8024ad <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  8024ce:	48 63 c8             	movslq %eax,%rcx
+  8024d1:	48 89 ca             	mov    %rcx,%rdx
+  8024d4:	48 c1 ea 03          	shr    $0x3,%rdx
+  8024d8:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  8024df:	08 10 20 
+  8024e2:	48 89 d0             	mov    %rdx,%rax
+  8024e5:	48 f7 e6             	mul    %rsi
+  8024e8:	48 c1 ea 06          	shr    $0x6,%rdx
+  8024ec:	48 89 d0             	mov    %rdx,%rax
+  8024ef:	48 c1 e0 09          	shl    $0x9,%rax
+  8024f3:	48 29 d0             	sub    %rdx,%rax
+  8024f6:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  8024fd:	00 
+  8024fe:	48 89 c8             	mov    %rcx,%rax
+  802501:	48 29 d0             	sub    %rdx,%rax
+  802504:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  802509:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80250d:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  802511:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  802514:	49 83 c7 01          	add    $0x1,%r15
+  802518:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  80251c:	75 83                	jne    8024a1 <devpipe_read+0x4c>
+    return n;
+  80251e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802522:	eb 03                	jmp    802527 <devpipe_read+0xd2>
+            if (i > 0) return i;
+  802524:	4c 89 f8             	mov    %r15,%rax
+}
+  802527:	48 83 c4 18          	add    $0x18,%rsp
+  80252b:	5b                   	pop    %rbx
+  80252c:	41 5c                	pop    %r12
+  80252e:	41 5d                	pop    %r13
+  802530:	41 5e                	pop    %r14
+  802532:	41 5f                	pop    %r15
+  802534:	5d                   	pop    %rbp
+  802535:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  802536:	b8 00 00 00 00       	mov    $0x0,%eax
+  80253b:	eb ea                	jmp    802527 <devpipe_read+0xd2>
+
+000000000080253d <pipe>:
+pipe(int pfd[2]) {
+  80253d:	55                   	push   %rbp
+  80253e:	48 89 e5             	mov    %rsp,%rbp
+  802541:	41 55                	push   %r13
+  802543:	41 54                	push   %r12
+  802545:	53                   	push   %rbx
+  802546:	48 81 ec b8 00 00 00 	sub    $0xb8,%rsp
+  80254d:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  802550:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802554:	48 b8 b6 17 80 00 00 	movabs $0x8017b6,%rax
+  80255b:	00 00 00 
+  80255e:	ff d0                	call   *%rax
+  802560:	89 c3                	mov    %eax,%ebx
+  802562:	85 c0                	test   %eax,%eax
+  802564:	0f 88 51 01 00 00    	js     8026bb <pipe+0x17e>
+        (res = fd_alloc_from(fd2num(fd0) + 1, &fd1)) < 0) goto err;
+  80256a:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80256e:	48 b8 0f 17 80 00 00 	movabs $0x80170f,%rax
+  802575:	00 00 00 
+  802578:	ff d0                	call   *%rax
+  80257a:	8d 78 01             	lea    0x1(%rax),%edi
+  80257d:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802581:	48 b8 3d 17 80 00 00 	movabs $0x80173d,%rax
+  802588:	00 00 00 
+  80258b:	ff d0                	call   *%rax
+  80258d:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  80258f:	85 c0                	test   %eax,%eax
+  802591:	0f 88 24 01 00 00    	js     8026bb <pipe+0x17e>
+    va = fd2data(fd0);
+  802597:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80259b:	48 bb 21 17 80 00 00 	movabs $0x801721,%rbx
+  8025a2:	00 00 00 
+  8025a5:	ff d3                	call   *%rbx
+  8025a7:	49 89 c5             	mov    %rax,%r13
+    struct RegionOp ops[] = {
+  8025aa:	48 8d bd 30 ff ff ff 	lea    -0xd0(%rbp),%rdi
+  8025b1:	b9 14 00 00 00       	mov    $0x14,%ecx
+  8025b6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025bb:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+  8025be:	c7 85 34 ff ff ff 46 	movl   $0x46,-0xcc(%rbp)
+  8025c5:	00 00 00 
+  8025c8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8025cc:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+  8025d3:	48 c7 85 50 ff ff ff 	movq   $0x1000,-0xb0(%rbp)
+  8025da:	00 10 00 00 
+  8025de:	c7 85 5c ff ff ff 46 	movl   $0x46,-0xa4(%rbp)
+  8025e5:	00 00 00 
+            {.type = REGION_ALLOC, .dstva = (uintptr_t)fd1, .size = PAGE_SIZE, .perm = PROT_RW | PROT_SHARE},
+  8025e8:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+    struct RegionOp ops[] = {
+  8025ec:	48 89 bd 70 ff ff ff 	mov    %rdi,-0x90(%rbp)
+  8025f3:	48 c7 85 78 ff ff ff 	movq   $0x1000,-0x88(%rbp)
+  8025fa:	00 10 00 00 
+  8025fe:	c7 45 84 46 00 00 00 	movl   $0x46,-0x7c(%rbp)
+  802605:	4c 89 6d 98          	mov    %r13,-0x68(%rbp)
+  802609:	48 c7 45 a0 00 10 00 	movq   $0x1000,-0x60(%rbp)
+  802610:	00 
+  802611:	c7 45 a8 01 00 00 00 	movl   $0x1,-0x58(%rbp)
+  802618:	c7 45 ac 46 00 00 00 	movl   $0x46,-0x54(%rbp)
+  80261f:	4c 89 6d b8          	mov    %r13,-0x48(%rbp)
+            {.type = REGION_MAP, .srcva = (uintptr_t)va, .dstva = (uintptr_t)fd2data(fd1), .size = PAGE_SIZE, .perm = PROT_RW | PROT_SHARE},
+  802623:	ff d3                	call   *%rbx
+    struct RegionOp ops[] = {
+  802625:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802629:	48 c7 45 c8 00 10 00 	movq   $0x1000,-0x38(%rbp)
+  802630:	00 
+    if ((res = sys_region_batch(ops, sizeof ops / sizeof *ops)) < 0) goto err1;
+  802631:	be 04 00 00 00       	mov    $0x4,%esi
+  802636:	48 8d bd 30 ff ff ff 	lea    -0xd0(%rbp),%rdi
+  80263d:	48 b8 a3 12 80 00 00 	movabs $0x8012a3,%rax
+  802644:	00 00 00 
+  802647:	ff d0                	call   *%rax
+  802649:	89 c3                	mov    %eax,%ebx
+  80264b:	85 c0                	test   %eax,%eax
+  80264d:	0f 88 ad 00 00 00    	js     802700 <pipe+0x1c3>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  802653:	be 00 10 00 00       	mov    $0x1000,%esi
+  802658:	4c 89 ef             	mov    %r13,%rdi
+  80265b:	48 b8 12 11 80 00 00 	movabs $0x801112,%rax
+  802662:	00 00 00 
+  802665:	ff d0                	call   *%rax
+  802667:	83 f8 02             	cmp    $0x2,%eax
+  80266a:	75 5f                	jne    8026cb <pipe+0x18e>
+    fd0->fd_dev_id = devpipe.dev_id;
+  80266c:	a1 60 40 80 00 00 00 	movabs 0x804060,%eax
+  802673:	00 00 
+  802675:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802679:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  80267b:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80267f:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  802686:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  80268a:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  80268c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802690:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  802697:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80269b:	48 bb 0f 17 80 00 00 	movabs $0x80170f,%rbx
+  8026a2:	00 00 00 
+  8026a5:	ff d3                	call   *%rbx
+  8026a7:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  8026ab:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  8026af:	ff d3                	call   *%rbx
+  8026b1:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  8026b6:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  8026bb:	89 d8                	mov    %ebx,%eax
+  8026bd:	48 81 c4 b8 00 00 00 	add    $0xb8,%rsp
+  8026c4:	5b                   	pop    %rbx
+  8026c5:	41 5c                	pop    %r12
+  8026c7:	41 5d                	pop    %r13
+  8026c9:	5d                   	pop    %rbp
+  8026ca:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8026cb:	48 b9 90 35 80 00 00 	movabs $0x803590,%rcx
+  8026d2:	00 00 00 
+  8026d5:	48 ba 67 35 80 00 00 	movabs $0x803567,%rdx
+  8026dc:	00 00 00 
+  8026df:	be 33 00 00 00       	mov    $0x33,%esi
+  8026e4:	48 bf 7c 35 80 00 00 	movabs $0x80357c,%rdi
+  8026eb:	00 00 00 
+  8026ee:	b8 00 00 00 00       	mov    $0x0,%eax
+  8026f3:	49 b8 65 2c 80 00 00 	movabs $0x802c65,%r8
+  8026fa:	00 00 00 
+  8026fd:	41 ff d0             	call   *%r8
+        ops[i].type = REGION_UNMAP;
+  802700:	c7 85 30 ff ff ff 02 	movl   $0x2,-0xd0(%rbp)
+  802707:	00 00 00 
+  80270a:	c7 85 58 ff ff ff 02 	movl   $0x2,-0xa8(%rbp)
+  802711:	00 00 00 
+  802714:	c7 45 80 02 00 00 00 	movl   $0x2,-0x80(%rbp)
+  80271b:	c7 45 a8 02 00 00 00 	movl   $0x2,-0x58(%rbp)
+    sys_region_batch(ops, sizeof ops / sizeof *ops);
+  802722:	be 04 00 00 00       	mov    $0x4,%esi
+  802727:	48 8d bd 30 ff ff ff 	lea    -0xd0(%rbp),%rdi
+  80272e:	48 b8 a3 12 80 00 00 	movabs $0x8012a3,%rax
+  802735:	00 00 00 
+  802738:	ff d0                	call   *%rax
+  80273a:	e9 7c ff ff ff       	jmp    8026bb <pipe+0x17e>
+
+000000000080273f <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  80273f:	55                   	push   %rbp
+  802740:	48 89 e5             	mov    %rsp,%rbp
+  802743:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  802747:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80274b:	48 b8 d0 17 80 00 00 	movabs $0x8017d0,%rax
+  802752:	00 00 00 
+  802755:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802757:	85 c0                	test   %eax,%eax
+  802759:	78 35                	js     802790 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  80275b:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80275f:	48 b8 21 17 80 00 00 	movabs $0x801721,%rax
+  802766:	00 00 00 
+  802769:	ff d0                	call   *%rax
+  80276b:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80276e:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802773:	be 00 10 00 00       	mov    $0x1000,%esi
+  802778:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80277c:	48 b8 44 11 80 00 00 	movabs $0x801144,%rax
+  802783:	00 00 00 
+  802786:	ff d0                	call   *%rax
+  802788:	85 c0                	test   %eax,%eax
+  80278a:	0f 94 c0             	sete   %al
+  80278d:	0f b6 c0             	movzbl %al,%eax
+}
+  802790:	c9                   	leave
+  802791:	c3                   	ret
+
+0000000000802792 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  802792:	48 89 f8             	mov    %rdi,%rax
+  802795:	48 c1 e8 27          	shr    $0x27,%rax
+  802799:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  8027a0:	01 00 00 
+  8027a3:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8027a7:	f6 c2 01             	test   $0x1,%dl
+  8027aa:	74 6d                	je     802819 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8027ac:	48 89 f8             	mov    %rdi,%rax
+  8027af:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8027b3:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8027ba:	01 00 00 
+  8027bd:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8027c1:	f6 c2 01             	test   $0x1,%dl
+  8027c4:	74 62                	je     802828 <get_uvpt_entry+0x96>
+  8027c6:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8027cd:	01 00 00 
+  8027d0:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8027d4:	f6 c2 80             	test   $0x80,%dl
+  8027d7:	75 4f                	jne    802828 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8027d9:	48 89 f8             	mov    %rdi,%rax
+  8027dc:	48 c1 e8 15          	shr    $0x15,%rax
+  8027e0:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8027e7:	01 00 00 
+  8027ea:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8027ee:	f6 c2 01             	test   $0x1,%dl
+  8027f1:	74 44                	je     802837 <get_uvpt_entry+0xa5>
+  8027f3:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8027fa:	01 00 00 
+  8027fd:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802801:	f6 c2 80             	test   $0x80,%dl
+  802804:	75 31                	jne    802837 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  802806:	48 c1 ef 0c          	shr    $0xc,%rdi
+  80280a:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802811:	01 00 00 
+  802814:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  802818:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  802819:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  802820:	01 00 00 
+  802823:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802827:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  802828:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  80282f:	01 00 00 
+  802832:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802836:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  802837:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  80283e:	01 00 00 
+  802841:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802845:	c3                   	ret
+
+0000000000802846 <get_prot>:
+
+int
+get_prot(void *va) {
+  802846:	55                   	push   %rbp
+  802847:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  80284a:	48 b8 92 27 80 00 00 	movabs $0x802792,%rax
+  802851:	00 00 00 
+  802854:	ff d0                	call   *%rax
+  802856:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  802859:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  80285e:	89 c1                	mov    %eax,%ecx
+  802860:	83 c9 04             	or     $0x4,%ecx
+  802863:	f6 c2 01             	test   $0x1,%dl
+  802866:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  802869:	89 c1                	mov    %eax,%ecx
+  80286b:	83 c9 02             	or     $0x2,%ecx
+  80286e:	f6 c2 02             	test   $0x2,%dl
+  802871:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  802874:	89 c1                	mov    %eax,%ecx
+  802876:	83 c9 01             	or     $0x1,%ecx
+  802879:	48 85 d2             	test   %rdx,%rdx
+  80287c:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  80287f:	89 c1                	mov    %eax,%ecx
+  802881:	83 c9 40             	or     $0x40,%ecx
+  802884:	f6 c6 04             	test   $0x4,%dh
+  802887:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  80288a:	5d                   	pop    %rbp
+  80288b:	c3                   	ret
+
+000000000080288c <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  80288c:	55                   	push   %rbp
+  80288d:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  802890:	48 b8 92 27 80 00 00 	movabs $0x802792,%rax
+  802897:	00 00 00 
+  80289a:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  80289c:	48 c1 e8 06          	shr    $0x6,%rax
+  8028a0:	83 e0 01             	and    $0x1,%eax
+}
+  8028a3:	5d                   	pop    %rbp
+  8028a4:	c3                   	ret
+
+00000000008028a5 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  8028a5:	55                   	push   %rbp
+  8028a6:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  8028a9:	48 b8 92 27 80 00 00 	movabs $0x802792,%rax
+  8028b0:	00 00 00 
+  8028b3:	ff d0                	call   *%rax
+  8028b5:	83 e0 01             	and    $0x1,%eax
+}
+  8028b8:	5d                   	pop    %rbp
+  8028b9:	c3                   	ret
+
+00000000008028ba <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  8028ba:	55                   	push   %rbp
+  8028bb:	48 89 e5             	mov    %rsp,%rbp
+  8028be:	41 57                	push   %r15
+  8028c0:	41 56                	push   %r14
+  8028c2:	41 55                	push   %r13
+  8028c4:	41 54                	push   %r12
+  8028c6:	53                   	push   %rbx
+  8028c7:	48 83 ec 38          	sub    $0x38,%rsp
+  8028cb:	49 89 f7             	mov    %rsi,%r15
+  8028ce:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+                    }
+                    continue;
+                }
+                for (int ptei = 0; ptei < PT_ENTRY_COUNT; ptei++) {
+                    uintptr_t pte_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, pdei, ptei, 0);
+                    pte_t pte = uvpt[VPT(pte_addr)];
+  8028d4:	49 bd 00 00 00 00 00 	movabs $0x10000000000,%r13
+  8028db:	01 00 00 
+  8028de:	4d 89 e6             	mov    %r12,%r14
+  8028e1:	49 89 fc             	mov    %rdi,%r12
+  8028e4:	e9 19 01 00 00       	jmp    802a02 <foreach_shared_region+0x148>
+  8028e9:	48 89 5d b0          	mov    %rbx,-0x50(%rbp)
+  8028ed:	4c 89 75 a8          	mov    %r14,-0x58(%rbp)
+  8028f1:	eb 52                	jmp    802945 <foreach_shared_region+0x8b>
+                for (int ptei = 0; ptei < PT_ENTRY_COUNT; ptei++) {
+  8028f3:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8028fa:	48 81 fb 00 00 20 00 	cmp    $0x200000,%rbx
+  802901:	74 2e                	je     802931 <foreach_shared_region+0x77>
+                    uintptr_t pte_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, pdei, ptei, 0);
+  802903:	48 89 df             	mov    %rbx,%rdi
+  802906:	4c 09 f7             	or     %r14,%rdi
+                    pte_t pte = uvpt[VPT(pte_addr)];
+  802909:	48 89 f8             	mov    %rdi,%rax
+  80290c:	48 c1 e8 0c          	shr    $0xc,%rax
+  802910:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+                    if ((pte & PTE_P) && (pte & PTE_SHARE)) {
+  802915:	25 01 04 00 00       	and    $0x401,%eax
+  80291a:	48 3d 01 04 00 00    	cmp    $0x401,%rax
+  802920:	75 d1                	jne    8028f3 <foreach_shared_region+0x39>
+                        fun((void*)pte_addr, (void*)(pte_addr + PAGE_SIZE), arg);
+  802922:	48 8d b7 00 10 00 00 	lea    0x1000(%rdi),%rsi
+  802929:	4c 89 fa             	mov    %r15,%rdx
+  80292c:	41 ff d4             	call   *%r12
+  80292f:	eb c2                	jmp    8028f3 <foreach_shared_region+0x39>
+            for (int pdei = 0; pdei < PD_ENTRY_COUNT; pdei++) {
+  802931:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  802938:	00 
+  802939:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80293d:	48 3d 00 00 00 40    	cmp    $0x40000000,%rax
+  802943:	74 46                	je     80298b <foreach_shared_region+0xd1>
+                uintptr_t pde_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, pdei, 0, 0);
+  802945:	4c 8b 75 c8          	mov    -0x38(%rbp),%r14
+  802949:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80294d:	49 09 c6             	or     %rax,%r14
+                pde_t pde = uvpd[VPD(pde_addr)];
+  802950:	4c 89 f0             	mov    %r14,%rax
+  802953:	48 c1 e8 15          	shr    $0x15,%rax
+  802957:	48 b9 00 00 00 80 00 	movabs $0x10080000000,%rcx
+  80295e:	01 00 00 
+  802961:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+                if (!(pde & PTE_P)) {
+  802965:	a8 01                	test   $0x1,%al
+  802967:	74 c8                	je     802931 <foreach_shared_region+0x77>
+                if (pde & PTE_PS) {
+  802969:	48 89 c3             	mov    %rax,%rbx
+  80296c:	81 e3 80 00 00 00    	and    $0x80,%ebx
+  802972:	74 8f                	je     802903 <foreach_shared_region+0x49>
+                    if (pde & PTE_SHARE) {
+  802974:	f6 c4 04             	test   $0x4,%ah
+  802977:	74 b8                	je     802931 <foreach_shared_region+0x77>
+                        fun((void*)pde_addr, (void*)(pde_addr + 1024 * 1024 * 2), arg);
+  802979:	49 8d b6 00 00 20 00 	lea    0x200000(%r14),%rsi
+  802980:	4c 89 fa             	mov    %r15,%rdx
+  802983:	4c 89 f7             	mov    %r14,%rdi
+  802986:	41 ff d4             	call   *%r12
+  802989:	eb a6                	jmp    802931 <foreach_shared_region+0x77>
+  80298b:	48 8b 5d b0          	mov    -0x50(%rbp),%rbx
+  80298f:	4c 8b 75 a8          	mov    -0x58(%rbp),%r14
+        for (int pdpei = 0; pdpei < PDP_ENTRY_COUNT; pdpei++) {
+  802993:	48 81 c3 00 00 00 40 	add    $0x40000000,%rbx
+  80299a:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8029a1:	00 00 00 
+  8029a4:	48 39 c3             	cmp    %rax,%rbx
+  8029a7:	74 4c                	je     8029f5 <foreach_shared_region+0x13b>
+            uintptr_t pdpe_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, 0, 0, 0);
+  8029a9:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  8029ad:	48 09 d8             	or     %rbx,%rax
+  8029b0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+            pdpe_t pdpe = uvpdp[VPDP(pdpe_addr)];
+  8029b4:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8029b8:	48 b9 00 00 40 80 00 	movabs $0x10080400000,%rcx
+  8029bf:	01 00 00 
+  8029c2:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+            if (!(pdpe & PTE_P)) {
+  8029c6:	a8 01                	test   $0x1,%al
+  8029c8:	74 c9                	je     802993 <foreach_shared_region+0xd9>
+            if (pdpe & PTE_PS) {
+  8029ca:	48 89 c1             	mov    %rax,%rcx
+  8029cd:	81 e1 80 00 00 00    	and    $0x80,%ecx
+  8029d3:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  8029d7:	0f 84 0c ff ff ff    	je     8028e9 <foreach_shared_region+0x2f>
+                if (pdpe & PTE_SHARE) {
+  8029dd:	f6 c4 04             	test   $0x4,%ah
+  8029e0:	74 b1                	je     802993 <foreach_shared_region+0xd9>
+                    fun((void*)pdpe_addr, (void*)(pdpe_addr + 1024 * 1024 * 1024), arg); 
+  8029e2:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  8029e6:	48 8d b7 00 00 00 40 	lea    0x40000000(%rdi),%rsi
+  8029ed:	4c 89 fa             	mov    %r15,%rdx
+  8029f0:	41 ff d4             	call   *%r12
+  8029f3:	eb 9e                	jmp    802993 <foreach_shared_region+0xd9>
+    for (int pml4ei = 0; pml4ei < PML4_ENTRY_COUNT; pml4ei++) {
+  8029f5:	49 83 c6 01          	add    $0x1,%r14
+  8029f9:	49 81 fe 00 02 00 00 	cmp    $0x200,%r14
+  802a00:	74 24                	je     802a26 <foreach_shared_region+0x16c>
+        pml4e_t pml4e = uvpml4[VPML4(pml4_addr)];
+  802a02:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  802a09:	01 00 00 
+  802a0c:	4a 8b 04 f0          	mov    (%rax,%r14,8),%rax
+        if (!(pml4e & PTE_P)) {
+  802a10:	a8 01                	test   $0x1,%al
+  802a12:	74 e1                	je     8029f5 <foreach_shared_region+0x13b>
+  802a14:	4c 89 f0             	mov    %r14,%rax
+  802a17:	48 c1 e0 27          	shl    $0x27,%rax
+  802a1b:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  802a1f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802a24:	eb 83                	jmp    8029a9 <foreach_shared_region+0xef>
+            }
+        }
+    }
+    
+    return 0;
+}
+  802a26:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a2b:	48 83 c4 38          	add    $0x38,%rsp
+  802a2f:	5b                   	pop    %rbx
+  802a30:	41 5c                	pop    %r12
+  802a32:	41 5d                	pop    %r13
+  802a34:	41 5e                	pop    %r14
+  802a36:	41 5f                	pop    %r15
+  802a38:	5d                   	pop    %rbp
+  802a39:	c3                   	ret
+
+0000000000802a3a <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  802a3a:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a3f:	c3                   	ret
+
+0000000000802a40 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  802a40:	55                   	push   %rbp
+  802a41:	48 89 e5             	mov    %rsp,%rbp
+  802a44:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  802a47:	48 be b4 35 80 00 00 	movabs $0x8035b4,%rsi
+  802a4e:	00 00 00 
+  802a51:	48 b8 c0 0b 80 00 00 	movabs $0x800bc0,%rax
+  802a58:	00 00 00 
+  802a5b:	ff d0                	call   *%rax
+    return 0;
+}
+  802a5d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a62:	5d                   	pop    %rbp
+  802a63:	c3                   	ret
+
+0000000000802a64 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  802a64:	55                   	push   %rbp
+  802a65:	48 89 e5             	mov    %rsp,%rbp
+  802a68:	41 57                	push   %r15
+  802a6a:	41 56                	push   %r14
+  802a6c:	41 55                	push   %r13
+  802a6e:	41 54                	push   %r12
+  802a70:	53                   	push   %rbx
+  802a71:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  802a78:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  802a7f:	48 85 d2             	test   %rdx,%rdx
+  802a82:	74 7a                	je     802afe <devcons_write+0x9a>
+  802a84:	49 89 d6             	mov    %rdx,%r14
+  802a87:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802a8d:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  802a92:	49 bf ba 0d 80 00 00 	movabs $0x800dba,%r15
+  802a99:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  802a9c:	4c 89 f3             	mov    %r14,%rbx
+  802a9f:	48 29 f3             	sub    %rsi,%rbx
+  802aa2:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802aa7:	48 39 c3             	cmp    %rax,%rbx
+  802aaa:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  802aae:	4c 63 eb             	movslq %ebx,%r13
+  802ab1:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  802ab8:	48 01 c6             	add    %rax,%rsi
+  802abb:	4c 89 ea             	mov    %r13,%rdx
+  802abe:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802ac5:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  802ac8:	4c 89 ee             	mov    %r13,%rsi
+  802acb:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802ad2:	48 b8 e7 0f 80 00 00 	movabs $0x800fe7,%rax
+  802ad9:	00 00 00 
+  802adc:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  802ade:	41 01 dc             	add    %ebx,%r12d
+  802ae1:	49 63 f4             	movslq %r12d,%rsi
+  802ae4:	4c 39 f6             	cmp    %r14,%rsi
+  802ae7:	72 b3                	jb     802a9c <devcons_write+0x38>
+    return res;
+  802ae9:	49 63 c4             	movslq %r12d,%rax
+}
+  802aec:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  802af3:	5b                   	pop    %rbx
+  802af4:	41 5c                	pop    %r12
+  802af6:	41 5d                	pop    %r13
+  802af8:	41 5e                	pop    %r14
+  802afa:	41 5f                	pop    %r15
+  802afc:	5d                   	pop    %rbp
+  802afd:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  802afe:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802b04:	eb e3                	jmp    802ae9 <devcons_write+0x85>
+
+0000000000802b06 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  802b06:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  802b09:	ba 00 00 00 00       	mov    $0x0,%edx
+  802b0e:	48 85 c0             	test   %rax,%rax
+  802b11:	74 55                	je     802b68 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  802b13:	55                   	push   %rbp
+  802b14:	48 89 e5             	mov    %rsp,%rbp
+  802b17:	41 55                	push   %r13
+  802b19:	41 54                	push   %r12
+  802b1b:	53                   	push   %rbx
+  802b1c:	48 83 ec 08          	sub    $0x8,%rsp
+  802b20:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  802b23:	48 bb 14 10 80 00 00 	movabs $0x801014,%rbx
+  802b2a:	00 00 00 
+  802b2d:	49 bc e1 10 80 00 00 	movabs $0x8010e1,%r12
+  802b34:	00 00 00 
+  802b37:	eb 03                	jmp    802b3c <devcons_read+0x36>
+  802b39:	41 ff d4             	call   *%r12
+  802b3c:	ff d3                	call   *%rbx
+  802b3e:	85 c0                	test   %eax,%eax
+  802b40:	74 f7                	je     802b39 <devcons_read+0x33>
+    if (c < 0) return c;
+  802b42:	48 63 d0             	movslq %eax,%rdx
+  802b45:	78 13                	js     802b5a <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  802b47:	ba 00 00 00 00       	mov    $0x0,%edx
+  802b4c:	83 f8 04             	cmp    $0x4,%eax
+  802b4f:	74 09                	je     802b5a <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  802b51:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  802b55:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  802b5a:	48 89 d0             	mov    %rdx,%rax
+  802b5d:	48 83 c4 08          	add    $0x8,%rsp
+  802b61:	5b                   	pop    %rbx
+  802b62:	41 5c                	pop    %r12
+  802b64:	41 5d                	pop    %r13
+  802b66:	5d                   	pop    %rbp
+  802b67:	c3                   	ret
+  802b68:	48 89 d0             	mov    %rdx,%rax
+  802b6b:	c3                   	ret
+
+0000000000802b6c <cputchar>:
+cputchar(int ch) {
+  802b6c:	55                   	push   %rbp
+  802b6d:	48 89 e5             	mov    %rsp,%rbp
+  802b70:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  802b74:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  802b78:	be 01 00 00 00       	mov    $0x1,%esi
+  802b7d:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  802b81:	48 b8 e7 0f 80 00 00 	movabs $0x800fe7,%rax
+  802b88:	00 00 00 
+  802b8b:	ff d0                	call   *%rax
+}
+  802b8d:	c9                   	leave
+  802b8e:	c3                   	ret
+
+0000000000802b8f <getchar>:
+getchar(void) {
+  802b8f:	55                   	push   %rbp
+  802b90:	48 89 e5             	mov    %rsp,%rbp
+  802b93:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  802b97:	ba 01 00 00 00       	mov    $0x1,%edx
+  802b9c:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  802ba0:	bf 00 00 00 00       	mov    $0x0,%edi
+  802ba5:	48 b8 b3 1a 80 00 00 	movabs $0x801ab3,%rax
+  802bac:	00 00 00 
+  802baf:	ff d0                	call   *%rax
+  802bb1:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  802bb3:	85 c0                	test   %eax,%eax
+  802bb5:	78 06                	js     802bbd <getchar+0x2e>
+  802bb7:	74 08                	je     802bc1 <getchar+0x32>
+  802bb9:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  802bbd:	89 d0                	mov    %edx,%eax
+  802bbf:	c9                   	leave
+  802bc0:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  802bc1:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  802bc6:	eb f5                	jmp    802bbd <getchar+0x2e>
+
+0000000000802bc8 <iscons>:
+iscons(int fdnum) {
+  802bc8:	55                   	push   %rbp
+  802bc9:	48 89 e5             	mov    %rsp,%rbp
+  802bcc:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  802bd0:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802bd4:	48 b8 d0 17 80 00 00 	movabs $0x8017d0,%rax
+  802bdb:	00 00 00 
+  802bde:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802be0:	85 c0                	test   %eax,%eax
+  802be2:	78 18                	js     802bfc <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  802be4:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802be8:	48 b8 a0 40 80 00 00 	movabs $0x8040a0,%rax
+  802bef:	00 00 00 
+  802bf2:	8b 00                	mov    (%rax),%eax
+  802bf4:	39 02                	cmp    %eax,(%rdx)
+  802bf6:	0f 94 c0             	sete   %al
+  802bf9:	0f b6 c0             	movzbl %al,%eax
+}
+  802bfc:	c9                   	leave
+  802bfd:	c3                   	ret
+
+0000000000802bfe <opencons>:
+opencons(void) {
+  802bfe:	55                   	push   %rbp
+  802bff:	48 89 e5             	mov    %rsp,%rbp
+  802c02:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802c06:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  802c0a:	48 b8 b6 17 80 00 00 	movabs $0x8017b6,%rax
+  802c11:	00 00 00 
+  802c14:	ff d0                	call   *%rax
+  802c16:	85 c0                	test   %eax,%eax
+  802c18:	78 49                	js     802c63 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  802c1a:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802c1f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802c24:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  802c28:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c2d:	48 b8 70 11 80 00 00 	movabs $0x801170,%rax
+  802c34:	00 00 00 
+  802c37:	ff d0                	call   *%rax
+  802c39:	85 c0                	test   %eax,%eax
+  802c3b:	78 26                	js     802c63 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  802c3d:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802c41:	a1 a0 40 80 00 00 00 	movabs 0x8040a0,%eax
+  802c48:	00 00 
+  802c4a:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  802c4c:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802c50:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  802c57:	48 b8 0f 17 80 00 00 	movabs $0x80170f,%rax
+  802c5e:	00 00 00 
+  802c61:	ff d0                	call   *%rax
+}
+  802c63:	c9                   	leave
+  802c64:	c3                   	ret
+
+0000000000802c65 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  802c65:	55                   	push   %rbp
+  802c66:	48 89 e5             	mov    %rsp,%rbp
+  802c69:	41 56                	push   %r14
+  802c6b:	41 55                	push   %r13
+  802c6d:	41 54                	push   %r12
+  802c6f:	53                   	push   %rbx
+  802c70:	48 83 ec 50          	sub    $0x50,%rsp
+  802c74:	49 89 fc             	mov    %rdi,%r12
+  802c77:	41 89 f5             	mov    %esi,%r13d
+  802c7a:	48 89 d3             	mov    %rdx,%rbx
+  802c7d:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  802c81:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  802c85:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  802c89:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  802c90:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802c94:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  802c98:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  802c9c:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  802ca0:	48 b8 00 40 80 00 00 	movabs $0x804000,%rax
+  802ca7:	00 00 00 
+  802caa:	4c 8b 30             	mov    (%rax),%r14
+  802cad:	48 b8 b0 10 80 00 00 	movabs $0x8010b0,%rax
+  802cb4:	00 00 00 
+  802cb7:	ff d0                	call   *%rax
+  802cb9:	89 c6                	mov    %eax,%esi
+  802cbb:	45 89 e8             	mov    %r13d,%r8d
+  802cbe:	4c 89 e1             	mov    %r12,%rcx
+  802cc1:	4c 89 f2             	mov    %r14,%rdx
+  802cc4:	48 bf c0 35 80 00 00 	movabs $0x8035c0,%rdi
+  802ccb:	00 00 00 
+  802cce:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cd3:	49 bc 9b 02 80 00 00 	movabs $0x80029b,%r12
+  802cda:	00 00 00 
+  802cdd:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  802ce0:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  802ce4:	48 89 df             	mov    %rbx,%rdi
+  802ce7:	48 b8 37 02 80 00 00 	movabs $0x800237,%rax
+  802cee:	00 00 00 
+  802cf1:	ff d0                	call   *%rax
+    cprintf("\n");
+  802cf3:	48 bf df 2e 80 00 00 	movabs $0x802edf,%rdi
+  802cfa:	00 00 00 
+  802cfd:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d02:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  802d05:	cc                   	int3
+  802d06:	eb fd                	jmp    802d05 <_panic+0xa0>
+
+0000000000802d08 <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  802d08:	55                   	push   %rbp
+  802d09:	48 89 e5             	mov    %rsp,%rbp
+  802d0c:	41 55                	push   %r13
+  802d0e:	41 54                	push   %r12
+  802d10:	53                   	push   %rbx
+  802d11:	48 83 ec 08          	sub    $0x8,%rsp
+  802d15:	49 89 fc             	mov    %rdi,%r12
+  802d18:	48 89 f7             	mov    %rsi,%rdi
+  802d1b:	48 89 d3             	mov    %rdx,%rbx
+  802d1e:	49 89 cd             	mov    %rcx,%r13
+    // LAB 9: Your code here:
+    int res = sys_ipc_recv(!pg ? (void*)MAX_USER_ADDRESS : pg, !size ? 0 : *size);
+  802d21:	be 00 00 00 00       	mov    $0x0,%esi
+  802d26:	48 85 d2             	test   %rdx,%rdx
+  802d29:	74 03                	je     802d2e <ipc_recv+0x26>
+  802d2b:	48 8b 32             	mov    (%rdx),%rsi
+  802d2e:	48 85 ff             	test   %rdi,%rdi
+  802d31:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802d38:	00 00 00 
+  802d3b:	48 0f 44 f8          	cmove  %rax,%rdi
+  802d3f:	48 b8 42 15 80 00 00 	movabs $0x801542,%rax
+  802d46:	00 00 00 
+  802d49:	ff d0                	call   *%rax
+    if (res < 0) {
+  802d4b:	85 c0                	test   %eax,%eax
+  802d4d:	78 66                	js     802db5 <ipc_recv+0xad>
+        if (size) {
+            *size = 0;
+        }
+        return res;
+    }
+    if (from_env_store) {
+  802d4f:	4d 85 e4             	test   %r12,%r12
+  802d52:	74 14                	je     802d68 <ipc_recv+0x60>
+        *from_env_store = thisenv->env_ipc_from;
+  802d54:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802d5b:	00 00 00 
+  802d5e:	8b 80 ac 01 00 00    	mov    0x1ac(%rax),%eax
+  802d64:	41 89 04 24          	mov    %eax,(%r12)
+    }
+    if (perm_store) {
+  802d68:	4d 85 ed             	test   %r13,%r13
+  802d6b:	74 14                	je     802d81 <ipc_recv+0x79>
+        *perm_store = thisenv->env_ipc_perm;
+  802d6d:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802d74:	00 00 00 
+  802d77:	8b 80 b0 01 00 00    	mov    0x1b0(%rax),%eax
+  802d7d:	41 89 45 00          	mov    %eax,0x0(%r13)
+    }
+    if (size) {
+  802d81:	48 85 db             	test   %rbx,%rbx
+  802d84:	74 14                	je     802d9a <ipc_recv+0x92>
+        *size = thisenv->env_ipc_maxsz;
+  802d86:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802d8d:	00 00 00 
+  802d90:	48 8b 80 a0 01 00 00 	mov    0x1a0(%rax),%rax
+  802d97:	48 89 03             	mov    %rax,(%rbx)
+    }
+    return thisenv->env_ipc_value;
+  802d9a:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802da1:	00 00 00 
+  802da4:	8b 80 a8 01 00 00    	mov    0x1a8(%rax),%eax
+}
+  802daa:	48 83 c4 08          	add    $0x8,%rsp
+  802dae:	5b                   	pop    %rbx
+  802daf:	41 5c                	pop    %r12
+  802db1:	41 5d                	pop    %r13
+  802db3:	5d                   	pop    %rbp
+  802db4:	c3                   	ret
+        if (from_env_store) {
+  802db5:	4d 85 e4             	test   %r12,%r12
+  802db8:	74 08                	je     802dc2 <ipc_recv+0xba>
+            *from_env_store = 0;
+  802dba:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  802dc1:	00 
+        if (perm_store) {
+  802dc2:	4d 85 ed             	test   %r13,%r13
+  802dc5:	74 08                	je     802dcf <ipc_recv+0xc7>
+            *perm_store = 0;
+  802dc7:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  802dce:	00 
+        if (size) {
+  802dcf:	48 85 db             	test   %rbx,%rbx
+  802dd2:	74 d6                	je     802daa <ipc_recv+0xa2>
+            *size = 0;
+  802dd4:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  802ddb:	eb cd                	jmp    802daa <ipc_recv+0xa2>
+
+0000000000802ddd <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  802ddd:	55                   	push   %rbp
+  802dde:	48 89 e5             	mov    %rsp,%rbp
+  802de1:	41 57                	push   %r15
+  802de3:	41 56                	push   %r14
+  802de5:	41 55                	push   %r13
+  802de7:	41 54                	push   %r12
+  802de9:	53                   	push   %rbx
+  802dea:	48 83 ec 18          	sub    $0x18,%rsp
+  802dee:	41 89 fd             	mov    %edi,%r13d
+  802df1:	89 75 cc             	mov    %esi,-0x34(%rbp)
+  802df4:	49 89 cc             	mov    %rcx,%r12
+  802df7:	44 89 45 c8          	mov    %r8d,-0x38(%rbp)
+    // LAB 9: Your code here:
+    int res = 0;
+    while ((res = sys_ipc_try_send(to_env, val, !pg ? (void*)MAX_USER_ADDRESS : pg, size, perm)) < 0) {
+  802dfb:	48 85 d2             	test   %rdx,%rdx
+  802dfe:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802e05:	00 00 00 
+  802e08:	48 0f 45 c2          	cmovne %rdx,%rax
+  802e0c:	48 89 c3             	mov    %rax,%rbx
+  802e0f:	49 be 16 15 80 00 00 	movabs $0x801516,%r14
+  802e16:	00 00 00 
+        if (res != -E_IPC_NOT_RECV) {
+            panic("sys_ipc_try_send failed: %i", res);
+        }
+        sys_yield();
+  802e19:	49 bf e1 10 80 00 00 	movabs $0x8010e1,%r15
+  802e20:	00 00 00 
+    while ((res = sys_ipc_try_send(to_env, val, !pg ? (void*)MAX_USER_ADDRESS : pg, size, perm)) < 0) {
+  802e23:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  802e26:	44 8b 45 c8          	mov    -0x38(%rbp),%r8d
+  802e2a:	4c 89 e1             	mov    %r12,%rcx
+  802e2d:	48 89 da             	mov    %rbx,%rdx
+  802e30:	44 89 ef             	mov    %r13d,%edi
+  802e33:	41 ff d6             	call   *%r14
+  802e36:	85 c0                	test   %eax,%eax
+  802e38:	79 37                	jns    802e71 <ipc_send+0x94>
+        if (res != -E_IPC_NOT_RECV) {
+  802e3a:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  802e3d:	75 05                	jne    802e44 <ipc_send+0x67>
+        sys_yield();
+  802e3f:	41 ff d7             	call   *%r15
+  802e42:	eb df                	jmp    802e23 <ipc_send+0x46>
+            panic("sys_ipc_try_send failed: %i", res);
+  802e44:	89 c1                	mov    %eax,%ecx
+  802e46:	48 ba e3 35 80 00 00 	movabs $0x8035e3,%rdx
+  802e4d:	00 00 00 
+  802e50:	be 40 00 00 00       	mov    $0x40,%esi
+  802e55:	48 bf ff 35 80 00 00 	movabs $0x8035ff,%rdi
+  802e5c:	00 00 00 
+  802e5f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e64:	49 b8 65 2c 80 00 00 	movabs $0x802c65,%r8
+  802e6b:	00 00 00 
+  802e6e:	41 ff d0             	call   *%r8
+    }
+    return;
+}
+  802e71:	48 83 c4 18          	add    $0x18,%rsp
+  802e75:	5b                   	pop    %rbx
+  802e76:	41 5c                	pop    %r12
+  802e78:	41 5d                	pop    %r13
+  802e7a:	41 5e                	pop    %r14
+  802e7c:	41 5f                	pop    %r15
+  802e7e:	5d                   	pop    %rbp
+  802e7f:	c3                   	ret
+
+0000000000802e80 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  802e80:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  802e85:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  802e8c:	00 00 00 
+  802e8f:	48 69 d0 d0 01 00 00 	imul   $0x1d0,%rax,%rdx
+  802e96:	48 01 ca             	add    %rcx,%rdx
+  802e99:	8b 92 e8 00 00 00    	mov    0xe8(%rdx),%edx
+  802e9f:	39 fa                	cmp    %edi,%edx
+  802ea1:	74 12                	je     802eb5 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  802ea3:	48 83 c0 01          	add    $0x1,%rax
+  802ea7:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  802ead:	75 e0                	jne    802e8f <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  802eaf:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802eb4:	c3                   	ret
+            return envs[i].env_id;
+  802eb5:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+  802ebc:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  802ec3:	00 00 00 
+  802ec6:	48 01 d0             	add    %rdx,%rax
+  802ec9:	8b 80 e0 00 00 00    	mov    0xe0(%rax),%eax
+  802ecf:	c3                   	ret
+
+0000000000802ed0 <__rodata_start>:
+  802ed0:	25 30 34 78 3a       	and    $0x3a783430,%eax
+  802ed5:	20 49 20             	and    %cl,0x20(%rcx)
+  802ed8:	61                   	(bad)
+  802ed9:	6d                   	insl   (%dx),%es:(%rdi)
+  802eda:	20 27                	and    %ah,(%rdi)
+  802edc:	25 73 27 0a 00       	and    $0xa2773,%eax
+  802ee1:	25 73 25 63 00       	and    $0x632573,%eax
+  802ee6:	3c 75                	cmp    $0x75,%al
+  802ee8:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802ee9:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  802eed:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802eee:	3e 00 30             	ds add %dh,(%rax)
+  802ef1:	31 32                	xor    %esi,(%rdx)
+  802ef3:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  802efa:	41                   	rex.B
+  802efb:	42                   	rex.X
+  802efc:	43                   	rex.XB
+  802efd:	44                   	rex.R
+  802efe:	45                   	rex.RB
+  802eff:	46 00 30             	rex.RX add %r14b,(%rax)
+  802f02:	31 32                	xor    %esi,(%rdx)
+  802f04:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  802f0b:	61                   	(bad)
+  802f0c:	62 63 64 65 66       	(bad)
+  802f11:	00 28                	add    %ch,(%rax)
+  802f13:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802f14:	75 6c                	jne    802f82 <__rodata_start+0xb2>
+  802f16:	6c                   	insb   (%dx),%es:(%rdi)
+  802f17:	29 00                	sub    %eax,(%rax)
+  802f19:	65 72 72             	gs jb  802f8e <__rodata_start+0xbe>
+  802f1c:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802f1d:	72 20                	jb     802f3f <__rodata_start+0x6f>
+  802f1f:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  802f24:	73 70                	jae    802f96 <__rodata_start+0xc6>
+  802f26:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  802f2a:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  802f31:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802f32:	72 00                	jb     802f34 <__rodata_start+0x64>
+  802f34:	62 61 64 20 65       	(bad)
+  802f39:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802f3a:	76 69                	jbe    802fa5 <__rodata_start+0xd5>
+  802f3c:	72 6f                	jb     802fad <__rodata_start+0xdd>
+  802f3e:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802f3f:	6d                   	insl   (%dx),%es:(%rdi)
+  802f40:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  802f42:	74 00                	je     802f44 <__rodata_start+0x74>
+  802f44:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  802f4b:	20 70 61             	and    %dh,0x61(%rax)
+  802f4e:	72 61                	jb     802fb1 <__rodata_start+0xe1>
+  802f50:	6d                   	insl   (%dx),%es:(%rdi)
+  802f51:	65 74 65             	gs je  802fb9 <__rodata_start+0xe9>
+  802f54:	72 00                	jb     802f56 <__rodata_start+0x86>
+  802f56:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802f57:	75 74                	jne    802fcd <__rodata_start+0xfd>
+  802f59:	20 6f 66             	and    %ch,0x66(%rdi)
+  802f5c:	20 6d 65             	and    %ch,0x65(%rbp)
+  802f5f:	6d                   	insl   (%dx),%es:(%rdi)
+  802f60:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802f61:	72 79                	jb     802fdc <__rodata_start+0x10c>
+  802f63:	00 6f 75             	add    %ch,0x75(%rdi)
+  802f66:	74 20                	je     802f88 <__rodata_start+0xb8>
+  802f68:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802f69:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  802f6d:	76 69                	jbe    802fd8 <__rodata_start+0x108>
+  802f6f:	72 6f                	jb     802fe0 <__rodata_start+0x110>
+  802f71:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802f72:	6d                   	insl   (%dx),%es:(%rdi)
+  802f73:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  802f75:	74 73                	je     802fea <__rodata_start+0x11a>
+  802f77:	00 63 6f             	add    %ah,0x6f(%rbx)
+  802f7a:	72 72                	jb     802fee <__rodata_start+0x11e>
+  802f7c:	75 70                	jne    802fee <__rodata_start+0x11e>
+  802f7e:	74 65                	je     802fe5 <__rodata_start+0x115>
+  802f80:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  802f85:	75 67                	jne    802fee <__rodata_start+0x11e>
+  802f87:	20 69 6e             	and    %ch,0x6e(%rcx)
+  802f8a:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  802f8c:	00 73 65             	add    %dh,0x65(%rbx)
+  802f8f:	67 6d                	insl   (%dx),%es:(%edi)
+  802f91:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  802f93:	74 61                	je     802ff6 <__rodata_start+0x126>
+  802f95:	74 69                	je     803000 <__rodata_start+0x130>
+  802f97:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802f98:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802f99:	20 66 61             	and    %ah,0x61(%rsi)
+  802f9c:	75 6c                	jne    80300a <__rodata_start+0x13a>
+  802f9e:	74 00                	je     802fa0 <__rodata_start+0xd0>
+  802fa0:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  802fa7:	20 45 4c             	and    %al,0x4c(%rbp)
+  802faa:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  802fae:	61                   	(bad)
+  802faf:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  802fb4:	20 73 75             	and    %dh,0x75(%rbx)
+  802fb7:	63 68 20             	movsxd 0x20(%rax),%ebp
+  802fba:	73 79                	jae    803035 <__rodata_start+0x165>
+  802fbc:	73 74                	jae    803032 <__rodata_start+0x162>
+  802fbe:	65 6d                	gs insl (%dx),%es:(%rdi)
+  802fc0:	20 63 61             	and    %ah,0x61(%rbx)
+  802fc3:	6c                   	insb   (%dx),%es:(%rdi)
+  802fc4:	6c                   	insb   (%dx),%es:(%rdi)
+  802fc5:	00 65 6e             	add    %ah,0x6e(%rbp)
+  802fc8:	74 72                	je     80303c <__rodata_start+0x16c>
+  802fca:	79 20                	jns    802fec <__rodata_start+0x11c>
+  802fcc:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802fcd:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802fce:	74 20                	je     802ff0 <__rodata_start+0x120>
+  802fd0:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  802fd2:	75 6e                	jne    803042 <__rodata_start+0x172>
+  802fd4:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  802fd8:	76 20                	jbe    802ffa <__rodata_start+0x12a>
+  802fda:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  802fe1:	72 65                	jb     803048 <__rodata_start+0x178>
+  802fe3:	63 76 69             	movsxd 0x69(%rsi),%esi
+  802fe6:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802fe7:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  802feb:	65 78 70             	gs js  80305e <__rodata_start+0x18e>
+  802fee:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  802ff3:	20 65 6e             	and    %ah,0x6e(%rbp)
+  802ff6:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  802ffa:	20 66 69             	and    %ah,0x69(%rsi)
+  802ffd:	6c                   	insb   (%dx),%es:(%rdi)
+  802ffe:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  803002:	20 66 72             	and    %ah,0x72(%rsi)
+  803005:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  80300a:	61                   	(bad)
+  80300b:	63 65 20             	movsxd 0x20(%rbp),%esp
+  80300e:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80300f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803010:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  803014:	6b 00 74             	imul   $0x74,(%rax),%eax
+  803017:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803018:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803019:	20 6d 61             	and    %ch,0x61(%rbp)
+  80301c:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80301d:	79 20                	jns    80303f <__rodata_start+0x16f>
+  80301f:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  803026:	72 65                	jb     80308d <__rodata_start+0x1bd>
+  803028:	20 6f 70             	and    %ch,0x70(%rdi)
+  80302b:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  80302d:	00 66 69             	add    %ah,0x69(%rsi)
+  803030:	6c                   	insb   (%dx),%es:(%rdi)
+  803031:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  803035:	20 62 6c             	and    %ah,0x6c(%rdx)
+  803038:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803039:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  80303c:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80303d:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80303e:	74 20                	je     803060 <__rodata_start+0x190>
+  803040:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  803042:	75 6e                	jne    8030b2 <__rodata_start+0x1e2>
+  803044:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  803048:	76 61                	jbe    8030ab <__rodata_start+0x1db>
+  80304a:	6c                   	insb   (%dx),%es:(%rdi)
+  80304b:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  803052:	00 
+  803053:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  80305a:	72 65                	jb     8030c1 <__rodata_start+0x1f1>
+  80305c:	61                   	(bad)
+  80305d:	64 79 20             	fs jns 803080 <__rodata_start+0x1b0>
+  803060:	65 78 69             	gs js  8030cc <__rodata_start+0x1fc>
+  803063:	73 74                	jae    8030d9 <__rodata_start+0x209>
+  803065:	73 00                	jae    803067 <__rodata_start+0x197>
+  803067:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803068:	70 65                	jo     8030cf <__rodata_start+0x1ff>
+  80306a:	72 61                	jb     8030cd <__rodata_start+0x1fd>
+  80306c:	74 69                	je     8030d7 <__rodata_start+0x207>
+  80306e:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80306f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803070:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  803073:	74 20                	je     803095 <__rodata_start+0x1c5>
+  803075:	73 75                	jae    8030ec <__rodata_start+0x21c>
+  803077:	70 70                	jo     8030e9 <__rodata_start+0x219>
+  803079:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80307a:	72 74                	jb     8030f0 <__rodata_start+0x220>
+  80307c:	65 64 00 6f 70       	gs add %ch,%fs:0x70(%rdi)
+  803081:	65 72 61             	gs jb  8030e5 <__rodata_start+0x215>
+  803084:	74 69                	je     8030ef <__rodata_start+0x21f>
+  803086:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803087:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803088:	20 69 6e             	and    %ch,0x6e(%rcx)
+  80308b:	74 65                	je     8030f2 <__rodata_start+0x222>
+  80308d:	72 72                	jb     803101 <__rodata_start+0x231>
+  80308f:	75 70                	jne    803101 <__rodata_start+0x231>
+  803091:	74 65                	je     8030f8 <__rodata_start+0x228>
+  803093:	64 00 6e 6f          	add    %ch,%fs:0x6f(%rsi)
+  803097:	74 20                	je     8030b9 <__rodata_start+0x1e9>
+  803099:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  80309b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80309c:	75 67                	jne    803105 <__rodata_start+0x235>
+  80309e:	68 20 43 50 55       	push   $0x55504320
+  8030a3:	20 74 69 6d          	and    %dh,0x6d(%rcx,%rbp,2)
+  8030a7:	65 00 66 2e          	add    %ah,%gs:0x2e(%rsi)
+  8030ab:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+  8030b2:	00 
+  8030b3:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8030ba:	00 00 00 
+  8030bd:	0f 1f 00             	nopl   (%rax)
+  8030c0:	88 04 80             	mov    %al,(%rax,%rax,4)
+  8030c3:	00 00                	add    %al,(%rax)
+  8030c5:	00 00                	add    %al,(%rax)
+  8030c7:	00 c9                	add    %cl,%cl
+  8030c9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8030cf:	00 b9 0a 80 00 00    	add    %bh,0x800a(%rcx)
+  8030d5:	00 00                	add    %al,(%rax)
+  8030d7:	00 c9                	add    %cl,%cl
+  8030d9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8030df:	00 c9                	add    %cl,%cl
+  8030e1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8030e7:	00 c9                	add    %cl,%cl
+  8030e9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8030ef:	00 c9                	add    %cl,%cl
+  8030f1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8030f7:	00 a7 04 80 00 00    	add    %ah,0x8004(%rdi)
+  8030fd:	00 00                	add    %al,(%rax)
+  8030ff:	00 c9                	add    %cl,%cl
+  803101:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803107:	00 c9                	add    %cl,%cl
+  803109:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80310f:	00 9b 04 80 00 00    	add    %bl,0x8004(%rbx)
+  803115:	00 00                	add    %al,(%rax)
+  803117:	00 15 05 80 00 00    	add    %dl,0x8005(%rip)        # 80b122 <__bss_end+0x3122>
+  80311d:	00 00                	add    %al,(%rax)
+  80311f:	00 c9                	add    %cl,%cl
+  803121:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803127:	00 9b 04 80 00 00    	add    %bl,0x8004(%rbx)
+  80312d:	00 00                	add    %al,(%rax)
+  80312f:	00 e1                	add    %ah,%cl
+  803131:	04 80                	add    $0x80,%al
+  803133:	00 00                	add    %al,(%rax)
+  803135:	00 00                	add    %al,(%rax)
+  803137:	00 e1                	add    %ah,%cl
+  803139:	04 80                	add    $0x80,%al
+  80313b:	00 00                	add    %al,(%rax)
+  80313d:	00 00                	add    %al,(%rax)
+  80313f:	00 e1                	add    %ah,%cl
+  803141:	04 80                	add    $0x80,%al
+  803143:	00 00                	add    %al,(%rax)
+  803145:	00 00                	add    %al,(%rax)
+  803147:	00 e1                	add    %ah,%cl
+  803149:	04 80                	add    $0x80,%al
+  80314b:	00 00                	add    %al,(%rax)
+  80314d:	00 00                	add    %al,(%rax)
+  80314f:	00 e1                	add    %ah,%cl
+  803151:	04 80                	add    $0x80,%al
+  803153:	00 00                	add    %al,(%rax)
+  803155:	00 00                	add    %al,(%rax)
+  803157:	00 e1                	add    %ah,%cl
+  803159:	04 80                	add    $0x80,%al
+  80315b:	00 00                	add    %al,(%rax)
+  80315d:	00 00                	add    %al,(%rax)
+  80315f:	00 e1                	add    %ah,%cl
+  803161:	04 80                	add    $0x80,%al
+  803163:	00 00                	add    %al,(%rax)
+  803165:	00 00                	add    %al,(%rax)
+  803167:	00 e1                	add    %ah,%cl
+  803169:	04 80                	add    $0x80,%al
+  80316b:	00 00                	add    %al,(%rax)
+  80316d:	00 00                	add    %al,(%rax)
+  80316f:	00 e1                	add    %ah,%cl
+  803171:	04 80                	add    $0x80,%al
+  803173:	00 00                	add    %al,(%rax)
+  803175:	00 00                	add    %al,(%rax)
+  803177:	00 c9                	add    %cl,%cl
+  803179:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80317f:	00 c9                	add    %cl,%cl
+  803181:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803187:	00 c9                	add    %cl,%cl
+  803189:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80318f:	00 c9                	add    %cl,%cl
+  803191:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803197:	00 c9                	add    %cl,%cl
+  803199:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80319f:	00 c9                	add    %cl,%cl
+  8031a1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8031a7:	00 c9                	add    %cl,%cl
+  8031a9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8031af:	00 c9                	add    %cl,%cl
+  8031b1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8031b7:	00 c9                	add    %cl,%cl
+  8031b9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8031bf:	00 c9                	add    %cl,%cl
+  8031c1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8031c7:	00 c9                	add    %cl,%cl
+  8031c9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8031cf:	00 c9                	add    %cl,%cl
+  8031d1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8031d7:	00 c9                	add    %cl,%cl
+  8031d9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8031df:	00 c9                	add    %cl,%cl
+  8031e1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8031e7:	00 c9                	add    %cl,%cl
+  8031e9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8031ef:	00 c9                	add    %cl,%cl
+  8031f1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8031f7:	00 c9                	add    %cl,%cl
+  8031f9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8031ff:	00 c9                	add    %cl,%cl
+  803201:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803207:	00 c9                	add    %cl,%cl
+  803209:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80320f:	00 c9                	add    %cl,%cl
+  803211:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803217:	00 c9                	add    %cl,%cl
+  803219:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80321f:	00 c9                	add    %cl,%cl
+  803221:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803227:	00 c9                	add    %cl,%cl
+  803229:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80322f:	00 c9                	add    %cl,%cl
+  803231:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803237:	00 c9                	add    %cl,%cl
+  803239:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80323f:	00 c9                	add    %cl,%cl
+  803241:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803247:	00 c9                	add    %cl,%cl
+  803249:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80324f:	00 c9                	add    %cl,%cl
+  803251:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803257:	00 c9                	add    %cl,%cl
+  803259:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80325f:	00 c9                	add    %cl,%cl
+  803261:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803267:	00 ec                	add    %ch,%ah
+  803269:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  80326f:	00 c9                	add    %cl,%cl
+  803271:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803277:	00 c9                	add    %cl,%cl
+  803279:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80327f:	00 c9                	add    %cl,%cl
+  803281:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803287:	00 c9                	add    %cl,%cl
+  803289:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80328f:	00 c9                	add    %cl,%cl
+  803291:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803297:	00 c9                	add    %cl,%cl
+  803299:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80329f:	00 c9                	add    %cl,%cl
+  8032a1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8032a7:	00 c9                	add    %cl,%cl
+  8032a9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8032af:	00 c9                	add    %cl,%cl
+  8032b1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8032b7:	00 c9                	add    %cl,%cl
+  8032b9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8032bf:	00 38                	add    %bh,(%rax)
+  8032c1:	05 80 00 00 00       	add    $0x80,%eax
+  8032c6:	00 00                	add    %al,(%rax)
+  8032c8:	07                   	(bad)
+  8032c9:	07                   	(bad)
+  8032ca:	80 00 00             	addb   $0x0,(%rax)
+  8032cd:	00 00                	add    %al,(%rax)
+  8032cf:	00 c9                	add    %cl,%cl
+  8032d1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8032d7:	00 c9                	add    %cl,%cl
+  8032d9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8032df:	00 c9                	add    %cl,%cl
+  8032e1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8032e7:	00 c9                	add    %cl,%cl
+  8032e9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8032ef:	00 67 05             	add    %ah,0x5(%rdi)
+  8032f2:	80 00 00             	addb   $0x0,(%rax)
+  8032f5:	00 00                	add    %al,(%rax)
+  8032f7:	00 c9                	add    %cl,%cl
+  8032f9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8032ff:	00 c9                	add    %cl,%cl
+  803301:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803307:	00 2d 05 80 00 00    	add    %ch,0x8005(%rip)        # 80b312 <__bss_end+0x3312>
+  80330d:	00 00                	add    %al,(%rax)
+  80330f:	00 c9                	add    %cl,%cl
+  803311:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803317:	00 c9                	add    %cl,%cl
+  803319:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80331f:	00 af 08 80 00 00    	add    %ch,0x8008(%rdi)
+  803325:	00 00                	add    %al,(%rax)
+  803327:	00 79 09             	add    %bh,0x9(%rcx)
+  80332a:	80 00 00             	addb   $0x0,(%rax)
+  80332d:	00 00                	add    %al,(%rax)
+  80332f:	00 c9                	add    %cl,%cl
+  803331:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803337:	00 c9                	add    %cl,%cl
+  803339:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80333f:	00 fe                	add    %bh,%dh
+  803341:	05 80 00 00 00       	add    $0x80,%eax
+  803346:	00 00                	add    %al,(%rax)
+  803348:	c9                   	leave
+  803349:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80334f:	00 db                	add    %bl,%bl
+  803351:	07                   	(bad)
+  803352:	80 00 00             	addb   $0x0,(%rax)
+  803355:	00 00                	add    %al,(%rax)
+  803357:	00 c9                	add    %cl,%cl
+  803359:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80335f:	00 c9                	add    %cl,%cl
+  803361:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803367:	00 ec                	add    %ch,%ah
+  803369:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  80336f:	00 c9                	add    %cl,%cl
+  803371:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803377:	00 91 04 80 00 00    	add    %dl,0x8004(%rcx)
+  80337d:	00 00                	add    %al,(%rax)
+	...
+
+0000000000803380 <error_string>:
+	...
+  803388:	22 2f 80 00 00 00 00 00 34 2f 80 00 00 00 00 00     "/......4/......
+  803398:	44 2f 80 00 00 00 00 00 56 2f 80 00 00 00 00 00     D/......V/......
+  8033a8:	64 2f 80 00 00 00 00 00 78 2f 80 00 00 00 00 00     d/......x/......
+  8033b8:	8d 2f 80 00 00 00 00 00 a0 2f 80 00 00 00 00 00     ./......./......
+  8033c8:	b2 2f 80 00 00 00 00 00 c6 2f 80 00 00 00 00 00     ./......./......
+  8033d8:	d6 2f 80 00 00 00 00 00 e9 2f 80 00 00 00 00 00     ./......./......
+  8033e8:	00 30 80 00 00 00 00 00 16 30 80 00 00 00 00 00     .0.......0......
+  8033f8:	2e 30 80 00 00 00 00 00 46 30 80 00 00 00 00 00     .0......F0......
+  803408:	53 30 80 00 00 00 00 00 30 34 80 00 00 00 00 00     S0......04......
+  803418:	67 30 80 00 00 00 00 00 7f 30 80 00 00 00 00 00     g0.......0......
+  803428:	95 30 80 00 00 00 00 00 66 69 6c 65 20 69 73 20     .0......file is 
+  803438:	6e 6f 74 20 61 20 76 61 6c 69 64 20 65 78 65 63     not a valid exec
+  803448:	75 74 61 62 6c 65 00 90 73 79 73 63 61 6c 6c 20     utable..syscall 
+  803458:	25 7a 64 20 72 65 74 75 72 6e 65 64 20 25 7a 64     %zd returned %zd
+  803468:	20 28 3e 20 30 29 00 6c 69 62 2f 73 79 73 63 61      (> 0).lib/sysca
+  803478:	6c 6c 2e 63 00 46 6f 72 6b 20 64 6f 75 62 6c 65     ll.c.Fork double
+  803488:	20 66 61 75 6c 74 00 6c 69 62 2f 66 6f 72 6b 2e      fault.lib/fork.
+  803498:	63 00 73 66 6f 72 6b 28 29 20 69 73 20 6e 6f 74     c.sfork() is not
+  8034a8:	20 69 6d 70 6c 65 6d 65 6e 74 65 64 00 0f 1f 00      implemented....
+  8034b8:	5b 25 30 38 78 5d 20 75 6e 6b 6e 6f 77 6e 20 64     [%08x] unknown d
+  8034c8:	65 76 69 63 65 20 74 79 70 65 20 25 64 0a 00 00     evice type %d...
+  8034d8:	5b 25 30 38 78 5d 20 66 74 72 75 6e 63 61 74 65     [%08x] ftruncate
+  8034e8:	20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65 0a      %d -- bad mode.
+  8034f8:	00 5b 25 30 38 78 5d 20 72 65 61 64 20 25 64 20     .[%08x] read %d 
+  803508:	2d 2d 20 62 61 64 20 6d 6f 64 65 0a 00 5b 25 30     -- bad mode..[%0
+  803518:	38 78 5d 20 77 72 69 74 65 20 25 64 20 2d 2d 20     8x] write %d -- 
+  803528:	62 61 64 20 6d 6f 64 65 0a 00 66 2e 0f 1f 84 00     bad mode..f.....
+  803538:	00 00 00 00 0f 1f 40 00                             ......@.
+
+0000000000803540 <devtab>:
+  803540:	20 40 80 00 00 00 00 00 60 40 80 00 00 00 00 00      @......`@......
+  803550:	a0 40 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .@..............
+  803560:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  803570:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  803580:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  803590:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  8035a0:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  8035b0:	3d 20 32 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73 00     = 2.<cons>.cons.
+  8035c0:	5b 25 30 38 78 5d 20 75 73 65 72 20 70 61 6e 69     [%08x] user pani
+  8035d0:	63 20 69 6e 20 25 73 20 61 74 20 25 73 3a 25 64     c in %s at %s:%d
+  8035e0:	3a 20 00 73 79 73 5f 69 70 63 5f 74 72 79 5f 73     : .sys_ipc_try_s
+  8035f0:	65 6e 64 20 66 61 69 6c 65 64 3a 20 25 69 00 6c     end failed: %i.l
+  803600:	69 62 2f 69 70 63 2e 63 00 66 2e 0f 1f 84 00 00     ib/ipc.c.f......
+  803610:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803620:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803630:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803640:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803650:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803660:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803670:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803680:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803690:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8036a0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8036b0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8036c0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8036d0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8036e0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8036f0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803700:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803710:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803720:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803730:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803740:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803750:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803760:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803770:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803780:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803790:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8037a0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8037b0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8037c0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8037d0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8037e0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8037f0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803800:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803810:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803820:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803830:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803840:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803850:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803860:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803870:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803880:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803890:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8038a0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8038b0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8038c0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8038d0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8038e0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8038f0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803900:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803910:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803920:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803930:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803940:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803950:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803960:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803970:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803980:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803990:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8039a0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8039b0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8039c0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8039d0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8039e0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8039f0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803a00:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803a10:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803a20:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803a30:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803a40:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803a50:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803a60:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803a70:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803a80:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803a90:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803aa0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803ab0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803ac0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803ad0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803ae0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803af0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803b00:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803b10:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803b20:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803b30:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803b40:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803b50:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803b60:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803b70:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803b80:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803b90:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803ba0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803bb0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803bc0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803bd0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803be0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803bf0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803c00:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803c10:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803c20:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803c30:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803c40:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803c50:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803c60:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803c70:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803c80:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803c90:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803ca0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803cb0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803cc0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803cd0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803ce0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803cf0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803d00:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803d10:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803d20:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803d30:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803d40:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803d50:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803d60:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803d70:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803d80:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803d90:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803da0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803db0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803dc0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803dd0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803de0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803df0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803e00:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803e10:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803e20:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803e30:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803e40:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803e50:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803e60:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803e70:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803e80:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803e90:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803ea0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803eb0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803ec0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803ed0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803ee0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803ef0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803f00:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803f10:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803f20:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803f30:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803f40:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803f50:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803f60:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803f70:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803f80:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803f90:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803fa0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803fb0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803fc0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803fd0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803fe0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803ff0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 90     .....f..........
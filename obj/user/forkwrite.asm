@@ -0,0 +1,6217 @@
+
+obj/user/forkwrite:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 ca 01 00 00       	call   8001ed <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+
+#define REGION_BASE 0x100000000ULL
+#define REGION_SIZE (32 * HUGE_PAGE_SIZE)
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 54                	push   %r12
+  80002b:	53                   	push   %rbx
+    uint8_t *buf = (uint8_t *)REGION_BASE;
+
+    int res = sys_alloc_region(CURENVID, buf, REGION_SIZE, PROT_RW | ALLOC_ZERO);
+  80002c:	b9 06 00 10 00       	mov    $0x100006,%ecx
+  800031:	ba 00 00 00 04       	mov    $0x4000000,%edx
+  800036:	48 be 00 00 00 00 01 	movabs $0x100000000,%rsi
+  80003d:	00 00 00 
+  800040:	bf 00 00 00 00       	mov    $0x0,%edi
+  800045:	48 b8 de 12 80 00 00 	movabs $0x8012de,%rax
+  80004c:	00 00 00 
+  80004f:	ff d0                	call   *%rax
+    if (res < 0) panic("sys_alloc_region: %i", res);
+  800051:	85 c0                	test   %eax,%eax
+  800053:	0f 88 07 01 00 00    	js     800160 <umain+0x13b>
+  800059:	48 b8 00 00 00 00 01 	movabs $0x100000000,%rax
+  800060:	00 00 00 
+    for (size_t i = 0; i < REGION_SIZE; i += PAGE_SIZE)
+  800063:	48 ba 00 00 00 04 01 	movabs $0x104000000,%rdx
+  80006a:	00 00 00 
+        buf[i] = 1;
+  80006d:	c6 00 01             	movb   $0x1,(%rax)
+    for (size_t i = 0; i < REGION_SIZE; i += PAGE_SIZE)
+  800070:	48 05 00 10 00 00    	add    $0x1000,%rax
+  800076:	48 39 d0             	cmp    %rdx,%rax
+  800079:	75 f2                	jne    80006d <umain+0x48>
+}
+
+static inline uint64_t __attribute__((always_inline))
+read_tsc(void) {
+    uint32_t lo, hi;
+    asm volatile("rdtsc"
+  80007b:	0f 31                	rdtsc
+  80007d:	89 d3                	mov    %edx,%ebx
+  80007f:	41 89 c4             	mov    %eax,%r12d
+
+    uint64_t start = read_tsc();
+    envid_t child = fork();
+  800082:	48 b8 19 17 80 00 00 	movabs $0x801719,%rax
+  800089:	00 00 00 
+  80008c:	ff d0                	call   *%rax
+    if (child < 0) panic("fork: %i", child);
+  80008e:	85 c0                	test   %eax,%eax
+  800090:	0f 88 f7 00 00 00    	js     80018d <umain+0x168>
+
+    if (!child) {
+  800096:	0f 85 1e 01 00 00    	jne    8001ba <umain+0x195>
+  80009c:	0f 31                	rdtsc
+                 : "=a"(lo), "=d"(hi));
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  80009e:	48 c1 e2 20          	shl    $0x20,%rdx
+  8000a2:	89 c0                	mov    %eax,%eax
+  8000a4:	48 09 c2             	or     %rax,%rdx
+  8000a7:	48 c1 e3 20          	shl    $0x20,%rbx
+  8000ab:	45 89 e4             	mov    %r12d,%r12d
+  8000ae:	4c 09 e3             	or     %r12,%rbx
+        uint64_t fork_cycles = read_tsc() - start;
+  8000b1:	48 89 d7             	mov    %rdx,%rdi
+  8000b4:	48 29 df             	sub    %rbx,%rdi
+    asm volatile("rdtsc"
+  8000b7:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  8000b9:	48 c1 e2 20          	shl    $0x20,%rdx
+  8000bd:	89 c0                	mov    %eax,%eax
+  8000bf:	48 09 c2             	or     %rax,%rdx
+  8000c2:	49 89 d0             	mov    %rdx,%r8
+  8000c5:	48 b9 00 00 00 00 01 	movabs $0x100000000,%rcx
+  8000cc:	00 00 00 
+        uint8_t *sparse = buf, *dense = buf + REGION_SIZE / 2;
+
+        start = read_tsc();
+        for (size_t i = 0; i < REGION_SIZE / 2; i += HUGE_PAGE_SIZE)
+  8000cf:	48 b8 00 00 00 02 01 	movabs $0x102000000,%rax
+  8000d6:	00 00 00 
+            sparse[i] = 2;
+  8000d9:	c6 01 02             	movb   $0x2,(%rcx)
+        for (size_t i = 0; i < REGION_SIZE / 2; i += HUGE_PAGE_SIZE)
+  8000dc:	48 81 c1 00 00 20 00 	add    $0x200000,%rcx
+  8000e3:	48 39 c1             	cmp    %rax,%rcx
+  8000e6:	75 f1                	jne    8000d9 <umain+0xb4>
+    asm volatile("rdtsc"
+  8000e8:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  8000ea:	48 c1 e2 20          	shl    $0x20,%rdx
+  8000ee:	89 c0                	mov    %eax,%eax
+  8000f0:	48 09 c2             	or     %rax,%rdx
+        uint64_t sparse_cycles = read_tsc() - start;
+  8000f3:	48 89 d6             	mov    %rdx,%rsi
+  8000f6:	4c 29 c6             	sub    %r8,%rsi
+    asm volatile("rdtsc"
+  8000f9:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  8000fb:	48 c1 e2 20          	shl    $0x20,%rdx
+  8000ff:	89 c0                	mov    %eax,%eax
+  800101:	48 09 c2             	or     %rax,%rdx
+  800104:	49 89 d0             	mov    %rdx,%r8
+
+        start = read_tsc();
+        for (size_t i = 0; i < REGION_SIZE / 2; i += PAGE_SIZE)
+  800107:	48 b8 00 00 00 04 01 	movabs $0x104000000,%rax
+  80010e:	00 00 00 
+            dense[i] = 2;
+  800111:	c6 01 02             	movb   $0x2,(%rcx)
+        for (size_t i = 0; i < REGION_SIZE / 2; i += PAGE_SIZE)
+  800114:	48 81 c1 00 10 00 00 	add    $0x1000,%rcx
+  80011b:	48 39 c1             	cmp    %rax,%rcx
+  80011e:	75 f1                	jne    800111 <umain+0xec>
+    asm volatile("rdtsc"
+  800120:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  800122:	48 c1 e2 20          	shl    $0x20,%rdx
+  800126:	89 c0                	mov    %eax,%eax
+  800128:	48 09 c2             	or     %rax,%rdx
+        uint64_t dense_cycles = read_tsc() - start;
+  80012b:	4c 29 c2             	sub    %r8,%rdx
+  80012e:	48 89 d1             	mov    %rdx,%rcx
+
+        cprintf("forkwrite: fork %lu cycles, sparse write %lu cycles per 2M page, "
+                "dense write %lu cycles per 2M page\n",
+                (unsigned long)fork_cycles,
+                (unsigned long)(sparse_cycles / (REGION_SIZE / 2 / HUGE_PAGE_SIZE)),
+                (unsigned long)(dense_cycles / (REGION_SIZE / 2 / HUGE_PAGE_SIZE)));
+  800131:	48 c1 e9 04          	shr    $0x4,%rcx
+                (unsigned long)(sparse_cycles / (REGION_SIZE / 2 / HUGE_PAGE_SIZE)),
+  800135:	48 c1 ee 04          	shr    $0x4,%rsi
+  800139:	48 89 f2             	mov    %rsi,%rdx
+        cprintf("forkwrite: fork %lu cycles, sparse write %lu cycles per 2M page, "
+  80013c:	48 89 fe             	mov    %rdi,%rsi
+  80013f:	48 bf 88 30 80 00 00 	movabs $0x803088,%rdi
+  800146:	00 00 00 
+  800149:	b8 00 00 00 00       	mov    $0x0,%eax
+  80014e:	49 b8 09 04 80 00 00 	movabs $0x800409,%r8
+  800155:	00 00 00 
+  800158:	41 ff d0             	call   *%r8
+        return;
+    }
+
+    wait(child);
+    sys_unmap_region(CURENVID, buf, REGION_SIZE);
+}
+  80015b:	5b                   	pop    %rbx
+  80015c:	41 5c                	pop    %r12
+  80015e:	5d                   	pop    %rbp
+  80015f:	c3                   	ret
+    if (res < 0) panic("sys_alloc_region: %i", res);
+  800160:	89 c1                	mov    %eax,%ecx
+  800162:	48 ba 58 30 80 00 00 	movabs $0x803058,%rdx
+  800169:	00 00 00 
+  80016c:	be 13 00 00 00       	mov    $0x13,%esi
+  800171:	48 bf 6d 30 80 00 00 	movabs $0x80306d,%rdi
+  800178:	00 00 00 
+  80017b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800180:	49 b8 b9 02 80 00 00 	movabs $0x8002b9,%r8
+  800187:	00 00 00 
+  80018a:	41 ff d0             	call   *%r8
+    if (child < 0) panic("fork: %i", child);
+  80018d:	89 c1                	mov    %eax,%ecx
+  80018f:	48 ba 7e 30 80 00 00 	movabs $0x80307e,%rdx
+  800196:	00 00 00 
+  800199:	be 19 00 00 00       	mov    $0x19,%esi
+  80019e:	48 bf 6d 30 80 00 00 	movabs $0x80306d,%rdi
+  8001a5:	00 00 00 
+  8001a8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001ad:	49 b8 b9 02 80 00 00 	movabs $0x8002b9,%r8
+  8001b4:	00 00 00 
+  8001b7:	41 ff d0             	call   *%r8
+    wait(child);
+  8001ba:	89 c7                	mov    %eax,%edi
+  8001bc:	48 b8 00 29 80 00 00 	movabs $0x802900,%rax
+  8001c3:	00 00 00 
+  8001c6:	ff d0                	call   *%rax
+    sys_unmap_region(CURENVID, buf, REGION_SIZE);
+  8001c8:	ba 00 00 00 04       	mov    $0x4000000,%edx
+  8001cd:	48 be 00 00 00 00 01 	movabs $0x100000000,%rsi
+  8001d4:	00 00 00 
+  8001d7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8001dc:	48 b8 aa 13 80 00 00 	movabs $0x8013aa,%rax
+  8001e3:	00 00 00 
+  8001e6:	ff d0                	call   *%rax
+  8001e8:	e9 6e ff ff ff       	jmp    80015b <umain+0x136>
+
+00000000008001ed <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  8001ed:	55                   	push   %rbp
+  8001ee:	48 89 e5             	mov    %rsp,%rbp
+  8001f1:	41 56                	push   %r14
+  8001f3:	41 55                	push   %r13
+  8001f5:	41 54                	push   %r12
+  8001f7:	53                   	push   %rbx
+  8001f8:	41 89 fd             	mov    %edi,%r13d
+  8001fb:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  8001fe:	48 ba d8 40 80 00 00 	movabs $0x8040d8,%rdx
+  800205:	00 00 00 
+  800208:	48 b8 d8 40 80 00 00 	movabs $0x8040d8,%rax
+  80020f:	00 00 00 
+  800212:	48 39 c2             	cmp    %rax,%rdx
+  800215:	73 17                	jae    80022e <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  800217:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  80021a:	49 89 c4             	mov    %rax,%r12
+  80021d:	48 83 c3 08          	add    $0x8,%rbx
+  800221:	b8 00 00 00 00       	mov    $0x0,%eax
+  800226:	ff 53 f8             	call   *-0x8(%rbx)
+  800229:	4c 39 e3             	cmp    %r12,%rbx
+  80022c:	72 ef                	jb     80021d <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+    envid_t this_env_id = sys_getenvid();
+  80022e:	48 b8 1e 12 80 00 00 	movabs $0x80121e,%rax
+  800235:	00 00 00 
+  800238:	ff d0                	call   *%rax
+    thisenv = &((struct Env*)UENVS)[ENVX(this_env_id)];
+  80023a:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80023f:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+  800246:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  80024d:	00 00 00 
+  800250:	48 01 d0             	add    %rdx,%rax
+  800253:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  80025a:	00 00 00 
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  80025d:	45 85 ed             	test   %r13d,%r13d
+  800260:	7e 0d                	jle    80026f <libmain+0x82>
+  800262:	49 8b 06             	mov    (%r14),%rax
+  800265:	48 a3 00 40 80 00 00 	movabs %rax,0x804000
+  80026c:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  80026f:	4c 89 f6             	mov    %r14,%rsi
+  800272:	44 89 ef             	mov    %r13d,%edi
+  800275:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  80027c:	00 00 00 
+  80027f:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  800281:	48 b8 96 02 80 00 00 	movabs $0x800296,%rax
+  800288:	00 00 00 
+  80028b:	ff d0                	call   *%rax
+#endif
+}
+  80028d:	5b                   	pop    %rbx
+  80028e:	41 5c                	pop    %r12
+  800290:	41 5d                	pop    %r13
+  800292:	41 5e                	pop    %r14
+  800294:	5d                   	pop    %rbp
+  800295:	c3                   	ret
+
+0000000000800296 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  800296:	55                   	push   %rbp
+  800297:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  80029a:	48 b8 d6 1a 80 00 00 	movabs $0x801ad6,%rax
+  8002a1:	00 00 00 
+  8002a4:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  8002a6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8002ab:	48 b8 b3 11 80 00 00 	movabs $0x8011b3,%rax
+  8002b2:	00 00 00 
+  8002b5:	ff d0                	call   *%rax
+}
+  8002b7:	5d                   	pop    %rbp
+  8002b8:	c3                   	ret
+
+00000000008002b9 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  8002b9:	55                   	push   %rbp
+  8002ba:	48 89 e5             	mov    %rsp,%rbp
+  8002bd:	41 56                	push   %r14
+  8002bf:	41 55                	push   %r13
+  8002c1:	41 54                	push   %r12
+  8002c3:	53                   	push   %rbx
+  8002c4:	48 83 ec 50          	sub    $0x50,%rsp
+  8002c8:	49 89 fc             	mov    %rdi,%r12
+  8002cb:	41 89 f5             	mov    %esi,%r13d
+  8002ce:	48 89 d3             	mov    %rdx,%rbx
+  8002d1:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  8002d5:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  8002d9:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  8002dd:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  8002e4:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8002e8:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  8002ec:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  8002f0:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  8002f4:	48 b8 00 40 80 00 00 	movabs $0x804000,%rax
+  8002fb:	00 00 00 
+  8002fe:	4c 8b 30             	mov    (%rax),%r14
+  800301:	48 b8 1e 12 80 00 00 	movabs $0x80121e,%rax
+  800308:	00 00 00 
+  80030b:	ff d0                	call   *%rax
+  80030d:	89 c6                	mov    %eax,%esi
+  80030f:	45 89 e8             	mov    %r13d,%r8d
+  800312:	4c 89 e1             	mov    %r12,%rcx
+  800315:	4c 89 f2             	mov    %r14,%rdx
+  800318:	48 bf f8 30 80 00 00 	movabs $0x8030f8,%rdi
+  80031f:	00 00 00 
+  800322:	b8 00 00 00 00       	mov    $0x0,%eax
+  800327:	49 bc 09 04 80 00 00 	movabs $0x800409,%r12
+  80032e:	00 00 00 
+  800331:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  800334:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  800338:	48 89 df             	mov    %rbx,%rdi
+  80033b:	48 b8 a5 03 80 00 00 	movabs $0x8003a5,%rax
+  800342:	00 00 00 
+  800345:	ff d0                	call   *%rax
+    cprintf("\n");
+  800347:	48 bf 33 37 80 00 00 	movabs $0x803733,%rdi
+  80034e:	00 00 00 
+  800351:	b8 00 00 00 00       	mov    $0x0,%eax
+  800356:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  800359:	cc                   	int3
+  80035a:	eb fd                	jmp    800359 <_panic+0xa0>
+
+000000000080035c <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  80035c:	55                   	push   %rbp
+  80035d:	48 89 e5             	mov    %rsp,%rbp
+  800360:	53                   	push   %rbx
+  800361:	48 83 ec 08          	sub    $0x8,%rsp
+  800365:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  800368:	8b 06                	mov    (%rsi),%eax
+  80036a:	8d 50 01             	lea    0x1(%rax),%edx
+  80036d:	89 16                	mov    %edx,(%rsi)
+  80036f:	48 98                	cltq
+  800371:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  800376:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  80037c:	74 0a                	je     800388 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  80037e:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  800382:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800386:	c9                   	leave
+  800387:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  800388:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  80038c:	be ff 00 00 00       	mov    $0xff,%esi
+  800391:	48 b8 55 11 80 00 00 	movabs $0x801155,%rax
+  800398:	00 00 00 
+  80039b:	ff d0                	call   *%rax
+        state->offset = 0;
+  80039d:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  8003a3:	eb d9                	jmp    80037e <putch+0x22>
+
+00000000008003a5 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  8003a5:	55                   	push   %rbp
+  8003a6:	48 89 e5             	mov    %rsp,%rbp
+  8003a9:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  8003b0:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  8003b3:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  8003ba:	b9 21 00 00 00       	mov    $0x21,%ecx
+  8003bf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003c4:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  8003c7:	48 89 f1             	mov    %rsi,%rcx
+  8003ca:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  8003d1:	48 bf 5c 03 80 00 00 	movabs $0x80035c,%rdi
+  8003d8:	00 00 00 
+  8003db:	48 b8 59 05 80 00 00 	movabs $0x800559,%rax
+  8003e2:	00 00 00 
+  8003e5:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  8003e7:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  8003ee:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  8003f5:	48 b8 55 11 80 00 00 	movabs $0x801155,%rax
+  8003fc:	00 00 00 
+  8003ff:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  800401:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  800407:	c9                   	leave
+  800408:	c3                   	ret
+
+0000000000800409 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  800409:	55                   	push   %rbp
+  80040a:	48 89 e5             	mov    %rsp,%rbp
+  80040d:	48 83 ec 50          	sub    $0x50,%rsp
+  800411:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  800415:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  800419:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80041d:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800421:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  800425:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  80042c:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800430:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800434:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800438:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  80043c:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  800440:	48 b8 a5 03 80 00 00 	movabs $0x8003a5,%rax
+  800447:	00 00 00 
+  80044a:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  80044c:	c9                   	leave
+  80044d:	c3                   	ret
+
+000000000080044e <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  80044e:	55                   	push   %rbp
+  80044f:	48 89 e5             	mov    %rsp,%rbp
+  800452:	41 57                	push   %r15
+  800454:	41 56                	push   %r14
+  800456:	41 55                	push   %r13
+  800458:	41 54                	push   %r12
+  80045a:	53                   	push   %rbx
+  80045b:	48 83 ec 18          	sub    $0x18,%rsp
+  80045f:	49 89 fc             	mov    %rdi,%r12
+  800462:	49 89 f5             	mov    %rsi,%r13
+  800465:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800469:	8b 45 10             	mov    0x10(%rbp),%eax
+  80046c:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  80046f:	41 89 cf             	mov    %ecx,%r15d
+  800472:	4c 39 fa             	cmp    %r15,%rdx
+  800475:	73 5b                	jae    8004d2 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  800477:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  80047b:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  80047f:	85 db                	test   %ebx,%ebx
+  800481:	7e 0e                	jle    800491 <print_num+0x43>
+            putch(padc, put_arg);
+  800483:	4c 89 ee             	mov    %r13,%rsi
+  800486:	44 89 f7             	mov    %r14d,%edi
+  800489:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  80048c:	83 eb 01             	sub    $0x1,%ebx
+  80048f:	75 f2                	jne    800483 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  800491:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  800495:	48 b9 2c 31 80 00 00 	movabs $0x80312c,%rcx
+  80049c:	00 00 00 
+  80049f:	48 b8 1b 31 80 00 00 	movabs $0x80311b,%rax
+  8004a6:	00 00 00 
+  8004a9:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  8004ad:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8004b1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8004b6:	49 f7 f7             	div    %r15
+  8004b9:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  8004bd:	4c 89 ee             	mov    %r13,%rsi
+  8004c0:	41 ff d4             	call   *%r12
+}
+  8004c3:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8004c7:	5b                   	pop    %rbx
+  8004c8:	41 5c                	pop    %r12
+  8004ca:	41 5d                	pop    %r13
+  8004cc:	41 5e                	pop    %r14
+  8004ce:	41 5f                	pop    %r15
+  8004d0:	5d                   	pop    %rbp
+  8004d1:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  8004d2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8004d6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8004db:	49 f7 f7             	div    %r15
+  8004de:	48 83 ec 08          	sub    $0x8,%rsp
+  8004e2:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  8004e6:	52                   	push   %rdx
+  8004e7:	45 0f be c9          	movsbl %r9b,%r9d
+  8004eb:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  8004ef:	48 89 c2             	mov    %rax,%rdx
+  8004f2:	48 b8 4e 04 80 00 00 	movabs $0x80044e,%rax
+  8004f9:	00 00 00 
+  8004fc:	ff d0                	call   *%rax
+  8004fe:	48 83 c4 10          	add    $0x10,%rsp
+  800502:	eb 8d                	jmp    800491 <print_num+0x43>
+
+0000000000800504 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  800504:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  800508:	48 8b 06             	mov    (%rsi),%rax
+  80050b:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  80050f:	73 0a                	jae    80051b <sprintputch+0x17>
+        *state->start++ = ch;
+  800511:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800515:	48 89 16             	mov    %rdx,(%rsi)
+  800518:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  80051b:	c3                   	ret
+
+000000000080051c <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  80051c:	55                   	push   %rbp
+  80051d:	48 89 e5             	mov    %rsp,%rbp
+  800520:	48 83 ec 50          	sub    $0x50,%rsp
+  800524:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800528:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80052c:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  800530:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800537:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80053b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80053f:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800543:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  800547:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80054b:	48 b8 59 05 80 00 00 	movabs $0x800559,%rax
+  800552:	00 00 00 
+  800555:	ff d0                	call   *%rax
+}
+  800557:	c9                   	leave
+  800558:	c3                   	ret
+
+0000000000800559 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  800559:	55                   	push   %rbp
+  80055a:	48 89 e5             	mov    %rsp,%rbp
+  80055d:	41 57                	push   %r15
+  80055f:	41 56                	push   %r14
+  800561:	41 55                	push   %r13
+  800563:	41 54                	push   %r12
+  800565:	53                   	push   %rbx
+  800566:	48 83 ec 38          	sub    $0x38,%rsp
+  80056a:	49 89 fe             	mov    %rdi,%r14
+  80056d:	49 89 f5             	mov    %rsi,%r13
+  800570:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  800573:	48 8b 01             	mov    (%rcx),%rax
+  800576:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  80057a:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  80057e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800582:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  800586:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  80058a:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  80058e:	0f b6 3b             	movzbl (%rbx),%edi
+  800591:	40 80 ff 25          	cmp    $0x25,%dil
+  800595:	74 18                	je     8005af <vprintfmt+0x56>
+            if (!ch) return;
+  800597:	40 84 ff             	test   %dil,%dil
+  80059a:	0f 84 b1 06 00 00    	je     800c51 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  8005a0:	40 0f b6 ff          	movzbl %dil,%edi
+  8005a4:	4c 89 ee             	mov    %r13,%rsi
+  8005a7:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  8005aa:	4c 89 e3             	mov    %r12,%rbx
+  8005ad:	eb db                	jmp    80058a <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  8005af:	be 00 00 00 00       	mov    $0x0,%esi
+  8005b4:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  8005b8:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  8005bd:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8005c3:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  8005ca:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8005ce:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  8005d3:	41 0f b6 04 24       	movzbl (%r12),%eax
+  8005d8:	88 45 a0             	mov    %al,-0x60(%rbp)
+  8005db:	83 e8 23             	sub    $0x23,%eax
+  8005de:	3c 57                	cmp    $0x57,%al
+  8005e0:	0f 87 51 06 00 00    	ja     800c37 <vprintfmt+0x6de>
+  8005e6:	0f b6 c0             	movzbl %al,%eax
+  8005e9:	48 b9 e0 32 80 00 00 	movabs $0x8032e0,%rcx
+  8005f0:	00 00 00 
+  8005f3:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  8005f6:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  8005f9:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  8005fd:	eb cf                	jmp    8005ce <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  8005ff:	49 89 dc             	mov    %rbx,%r12
+  800602:	be 01 00 00 00       	mov    $0x1,%esi
+  800607:	eb c5                	jmp    8005ce <vprintfmt+0x75>
+            padc = ch;
+  800609:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  80060d:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800610:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800613:	eb b9                	jmp    8005ce <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800615:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800618:	83 f8 2f             	cmp    $0x2f,%eax
+  80061b:	77 24                	ja     800641 <vprintfmt+0xe8>
+  80061d:	89 c1                	mov    %eax,%ecx
+  80061f:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  800623:	83 c0 08             	add    $0x8,%eax
+  800626:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800629:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  80062c:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  80062f:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800633:	79 99                	jns    8005ce <vprintfmt+0x75>
+                width = precision;
+  800635:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  800639:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  80063f:	eb 8d                	jmp    8005ce <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800641:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  800645:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  800649:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80064d:	eb da                	jmp    800629 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  80064f:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  800654:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800658:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  80065e:	3c 39                	cmp    $0x39,%al
+  800660:	77 1c                	ja     80067e <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  800662:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  800666:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  80066a:	0f b6 c0             	movzbl %al,%eax
+  80066d:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800672:	0f b6 03             	movzbl (%rbx),%eax
+  800675:	3c 39                	cmp    $0x39,%al
+  800677:	76 e9                	jbe    800662 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  800679:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  80067c:	eb b1                	jmp    80062f <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  80067e:	49 89 dc             	mov    %rbx,%r12
+  800681:	eb ac                	jmp    80062f <vprintfmt+0xd6>
+            width = MAX(0, width);
+  800683:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  800686:	85 c9                	test   %ecx,%ecx
+  800688:	b8 00 00 00 00       	mov    $0x0,%eax
+  80068d:	0f 49 c1             	cmovns %ecx,%eax
+  800690:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  800693:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800696:	e9 33 ff ff ff       	jmp    8005ce <vprintfmt+0x75>
+            lflag++;
+  80069b:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  80069e:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8006a1:	e9 28 ff ff ff       	jmp    8005ce <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  8006a6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006a9:	83 f8 2f             	cmp    $0x2f,%eax
+  8006ac:	77 19                	ja     8006c7 <vprintfmt+0x16e>
+  8006ae:	89 c2                	mov    %eax,%edx
+  8006b0:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8006b4:	83 c0 08             	add    $0x8,%eax
+  8006b7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8006ba:	8b 3a                	mov    (%rdx),%edi
+  8006bc:	4c 89 ee             	mov    %r13,%rsi
+  8006bf:	41 ff d6             	call   *%r14
+            break;
+  8006c2:	e9 c3 fe ff ff       	jmp    80058a <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  8006c7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8006cb:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006cf:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006d3:	eb e5                	jmp    8006ba <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  8006d5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006d8:	83 f8 2f             	cmp    $0x2f,%eax
+  8006db:	77 5a                	ja     800737 <vprintfmt+0x1de>
+  8006dd:	89 c2                	mov    %eax,%edx
+  8006df:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8006e3:	83 c0 08             	add    $0x8,%eax
+  8006e6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  8006e9:	8b 02                	mov    (%rdx),%eax
+  8006eb:	89 c1                	mov    %eax,%ecx
+  8006ed:	f7 d9                	neg    %ecx
+  8006ef:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  8006f2:	83 f9 15             	cmp    $0x15,%ecx
+  8006f5:	7f 4e                	jg     800745 <vprintfmt+0x1ec>
+  8006f7:	48 63 c1             	movslq %ecx,%rax
+  8006fa:	48 ba a0 35 80 00 00 	movabs $0x8035a0,%rdx
+  800701:	00 00 00 
+  800704:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  800708:	48 85 c0             	test   %rax,%rax
+  80070b:	74 38                	je     800745 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  80070d:	48 89 c1             	mov    %rax,%rcx
+  800710:	48 ba 99 37 80 00 00 	movabs $0x803799,%rdx
+  800717:	00 00 00 
+  80071a:	4c 89 ee             	mov    %r13,%rsi
+  80071d:	4c 89 f7             	mov    %r14,%rdi
+  800720:	b8 00 00 00 00       	mov    $0x0,%eax
+  800725:	49 b8 1c 05 80 00 00 	movabs $0x80051c,%r8
+  80072c:	00 00 00 
+  80072f:	41 ff d0             	call   *%r8
+  800732:	e9 53 fe ff ff       	jmp    80058a <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  800737:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80073b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80073f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800743:	eb a4                	jmp    8006e9 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  800745:	48 ba 44 31 80 00 00 	movabs $0x803144,%rdx
+  80074c:	00 00 00 
+  80074f:	4c 89 ee             	mov    %r13,%rsi
+  800752:	4c 89 f7             	mov    %r14,%rdi
+  800755:	b8 00 00 00 00       	mov    $0x0,%eax
+  80075a:	49 b8 1c 05 80 00 00 	movabs $0x80051c,%r8
+  800761:	00 00 00 
+  800764:	41 ff d0             	call   *%r8
+  800767:	e9 1e fe ff ff       	jmp    80058a <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  80076c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80076f:	83 f8 2f             	cmp    $0x2f,%eax
+  800772:	77 6c                	ja     8007e0 <vprintfmt+0x287>
+  800774:	89 c2                	mov    %eax,%edx
+  800776:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80077a:	83 c0 08             	add    $0x8,%eax
+  80077d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800780:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  800783:	48 85 d2             	test   %rdx,%rdx
+  800786:	48 b8 3d 31 80 00 00 	movabs $0x80313d,%rax
+  80078d:	00 00 00 
+  800790:	48 0f 45 c2          	cmovne %rdx,%rax
+  800794:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  800798:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  80079c:	7e 06                	jle    8007a4 <vprintfmt+0x24b>
+  80079e:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  8007a2:	75 4a                	jne    8007ee <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8007a4:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8007a8:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8007ac:	0f b6 00             	movzbl (%rax),%eax
+  8007af:	84 c0                	test   %al,%al
+  8007b1:	0f 85 9a 00 00 00    	jne    800851 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  8007b7:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8007ba:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  8007be:	85 c0                	test   %eax,%eax
+  8007c0:	0f 8e c4 fd ff ff    	jle    80058a <vprintfmt+0x31>
+  8007c6:	4c 89 ee             	mov    %r13,%rsi
+  8007c9:	bf 20 00 00 00       	mov    $0x20,%edi
+  8007ce:	41 ff d6             	call   *%r14
+  8007d1:	41 83 ec 01          	sub    $0x1,%r12d
+  8007d5:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  8007d9:	75 eb                	jne    8007c6 <vprintfmt+0x26d>
+  8007db:	e9 aa fd ff ff       	jmp    80058a <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8007e0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007e4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007e8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007ec:	eb 92                	jmp    800780 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  8007ee:	49 63 f7             	movslq %r15d,%rsi
+  8007f1:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  8007f5:	48 b8 0b 0d 80 00 00 	movabs $0x800d0b,%rax
+  8007fc:	00 00 00 
+  8007ff:	ff d0                	call   *%rax
+  800801:	48 89 c2             	mov    %rax,%rdx
+  800804:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800807:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  800809:	8d 70 ff             	lea    -0x1(%rax),%esi
+  80080c:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  80080f:	85 c0                	test   %eax,%eax
+  800811:	7e 91                	jle    8007a4 <vprintfmt+0x24b>
+  800813:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  800818:	4c 89 ee             	mov    %r13,%rsi
+  80081b:	44 89 e7             	mov    %r12d,%edi
+  80081e:	41 ff d6             	call   *%r14
+  800821:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800825:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800828:	83 f8 ff             	cmp    $0xffffffff,%eax
+  80082b:	75 eb                	jne    800818 <vprintfmt+0x2bf>
+  80082d:	e9 72 ff ff ff       	jmp    8007a4 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800832:	0f b6 f8             	movzbl %al,%edi
+  800835:	4c 89 ee             	mov    %r13,%rsi
+  800838:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  80083b:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  80083f:	49 83 c4 01          	add    $0x1,%r12
+  800843:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  800849:	84 c0                	test   %al,%al
+  80084b:	0f 84 66 ff ff ff    	je     8007b7 <vprintfmt+0x25e>
+  800851:	45 85 ff             	test   %r15d,%r15d
+  800854:	78 0a                	js     800860 <vprintfmt+0x307>
+  800856:	41 83 ef 01          	sub    $0x1,%r15d
+  80085a:	0f 88 57 ff ff ff    	js     8007b7 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800860:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  800864:	74 cc                	je     800832 <vprintfmt+0x2d9>
+  800866:	8d 50 e0             	lea    -0x20(%rax),%edx
+  800869:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  80086e:	80 fa 5e             	cmp    $0x5e,%dl
+  800871:	77 c2                	ja     800835 <vprintfmt+0x2dc>
+  800873:	eb bd                	jmp    800832 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  800875:	40 84 f6             	test   %sil,%sil
+  800878:	75 26                	jne    8008a0 <vprintfmt+0x347>
+    switch (lflag) {
+  80087a:	85 d2                	test   %edx,%edx
+  80087c:	74 59                	je     8008d7 <vprintfmt+0x37e>
+  80087e:	83 fa 01             	cmp    $0x1,%edx
+  800881:	74 7b                	je     8008fe <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  800883:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800886:	83 f8 2f             	cmp    $0x2f,%eax
+  800889:	0f 87 96 00 00 00    	ja     800925 <vprintfmt+0x3cc>
+  80088f:	89 c2                	mov    %eax,%edx
+  800891:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800895:	83 c0 08             	add    $0x8,%eax
+  800898:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80089b:	4c 8b 22             	mov    (%rdx),%r12
+  80089e:	eb 17                	jmp    8008b7 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  8008a0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008a3:	83 f8 2f             	cmp    $0x2f,%eax
+  8008a6:	77 21                	ja     8008c9 <vprintfmt+0x370>
+  8008a8:	89 c2                	mov    %eax,%edx
+  8008aa:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008ae:	83 c0 08             	add    $0x8,%eax
+  8008b1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008b4:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  8008b7:	4d 85 e4             	test   %r12,%r12
+  8008ba:	78 7a                	js     800936 <vprintfmt+0x3dd>
+            num = i;
+  8008bc:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  8008bf:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  8008c4:	e9 50 02 00 00       	jmp    800b19 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8008c9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008cd:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008d1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008d5:	eb dd                	jmp    8008b4 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  8008d7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008da:	83 f8 2f             	cmp    $0x2f,%eax
+  8008dd:	77 11                	ja     8008f0 <vprintfmt+0x397>
+  8008df:	89 c2                	mov    %eax,%edx
+  8008e1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008e5:	83 c0 08             	add    $0x8,%eax
+  8008e8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008eb:	4c 63 22             	movslq (%rdx),%r12
+  8008ee:	eb c7                	jmp    8008b7 <vprintfmt+0x35e>
+  8008f0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008f4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008f8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008fc:	eb ed                	jmp    8008eb <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  8008fe:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800901:	83 f8 2f             	cmp    $0x2f,%eax
+  800904:	77 11                	ja     800917 <vprintfmt+0x3be>
+  800906:	89 c2                	mov    %eax,%edx
+  800908:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80090c:	83 c0 08             	add    $0x8,%eax
+  80090f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800912:	4c 8b 22             	mov    (%rdx),%r12
+  800915:	eb a0                	jmp    8008b7 <vprintfmt+0x35e>
+  800917:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80091b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80091f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800923:	eb ed                	jmp    800912 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  800925:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800929:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80092d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800931:	e9 65 ff ff ff       	jmp    80089b <vprintfmt+0x342>
+                putch('-', put_arg);
+  800936:	4c 89 ee             	mov    %r13,%rsi
+  800939:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  80093e:	41 ff d6             	call   *%r14
+                i = -i;
+  800941:	49 f7 dc             	neg    %r12
+  800944:	e9 73 ff ff ff       	jmp    8008bc <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  800949:	40 84 f6             	test   %sil,%sil
+  80094c:	75 32                	jne    800980 <vprintfmt+0x427>
+    switch (lflag) {
+  80094e:	85 d2                	test   %edx,%edx
+  800950:	74 5d                	je     8009af <vprintfmt+0x456>
+  800952:	83 fa 01             	cmp    $0x1,%edx
+  800955:	0f 84 82 00 00 00    	je     8009dd <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  80095b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80095e:	83 f8 2f             	cmp    $0x2f,%eax
+  800961:	0f 87 a5 00 00 00    	ja     800a0c <vprintfmt+0x4b3>
+  800967:	89 c2                	mov    %eax,%edx
+  800969:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80096d:	83 c0 08             	add    $0x8,%eax
+  800970:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800973:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800976:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  80097b:	e9 99 01 00 00       	jmp    800b19 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800980:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800983:	83 f8 2f             	cmp    $0x2f,%eax
+  800986:	77 19                	ja     8009a1 <vprintfmt+0x448>
+  800988:	89 c2                	mov    %eax,%edx
+  80098a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80098e:	83 c0 08             	add    $0x8,%eax
+  800991:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800994:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800997:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  80099c:	e9 78 01 00 00       	jmp    800b19 <vprintfmt+0x5c0>
+  8009a1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009a5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009a9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009ad:	eb e5                	jmp    800994 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  8009af:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009b2:	83 f8 2f             	cmp    $0x2f,%eax
+  8009b5:	77 18                	ja     8009cf <vprintfmt+0x476>
+  8009b7:	89 c2                	mov    %eax,%edx
+  8009b9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009bd:	83 c0 08             	add    $0x8,%eax
+  8009c0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009c3:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  8009c5:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  8009ca:	e9 4a 01 00 00       	jmp    800b19 <vprintfmt+0x5c0>
+  8009cf:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009d3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009d7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009db:	eb e6                	jmp    8009c3 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  8009dd:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009e0:	83 f8 2f             	cmp    $0x2f,%eax
+  8009e3:	77 19                	ja     8009fe <vprintfmt+0x4a5>
+  8009e5:	89 c2                	mov    %eax,%edx
+  8009e7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009eb:	83 c0 08             	add    $0x8,%eax
+  8009ee:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009f1:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8009f4:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  8009f9:	e9 1b 01 00 00       	jmp    800b19 <vprintfmt+0x5c0>
+  8009fe:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a02:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a06:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a0a:	eb e5                	jmp    8009f1 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  800a0c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a10:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a14:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a18:	e9 56 ff ff ff       	jmp    800973 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  800a1d:	40 84 f6             	test   %sil,%sil
+  800a20:	75 2e                	jne    800a50 <vprintfmt+0x4f7>
+    switch (lflag) {
+  800a22:	85 d2                	test   %edx,%edx
+  800a24:	74 59                	je     800a7f <vprintfmt+0x526>
+  800a26:	83 fa 01             	cmp    $0x1,%edx
+  800a29:	74 7f                	je     800aaa <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  800a2b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a2e:	83 f8 2f             	cmp    $0x2f,%eax
+  800a31:	0f 87 9f 00 00 00    	ja     800ad6 <vprintfmt+0x57d>
+  800a37:	89 c2                	mov    %eax,%edx
+  800a39:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a3d:	83 c0 08             	add    $0x8,%eax
+  800a40:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a43:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800a46:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  800a4b:	e9 c9 00 00 00       	jmp    800b19 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800a50:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a53:	83 f8 2f             	cmp    $0x2f,%eax
+  800a56:	77 19                	ja     800a71 <vprintfmt+0x518>
+  800a58:	89 c2                	mov    %eax,%edx
+  800a5a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a5e:	83 c0 08             	add    $0x8,%eax
+  800a61:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a64:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800a67:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800a6c:	e9 a8 00 00 00       	jmp    800b19 <vprintfmt+0x5c0>
+  800a71:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a75:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a79:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a7d:	eb e5                	jmp    800a64 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  800a7f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a82:	83 f8 2f             	cmp    $0x2f,%eax
+  800a85:	77 15                	ja     800a9c <vprintfmt+0x543>
+  800a87:	89 c2                	mov    %eax,%edx
+  800a89:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a8d:	83 c0 08             	add    $0x8,%eax
+  800a90:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a93:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  800a95:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  800a9a:	eb 7d                	jmp    800b19 <vprintfmt+0x5c0>
+  800a9c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800aa0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800aa4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800aa8:	eb e9                	jmp    800a93 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  800aaa:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800aad:	83 f8 2f             	cmp    $0x2f,%eax
+  800ab0:	77 16                	ja     800ac8 <vprintfmt+0x56f>
+  800ab2:	89 c2                	mov    %eax,%edx
+  800ab4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ab8:	83 c0 08             	add    $0x8,%eax
+  800abb:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800abe:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800ac1:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  800ac6:	eb 51                	jmp    800b19 <vprintfmt+0x5c0>
+  800ac8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800acc:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ad0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ad4:	eb e8                	jmp    800abe <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  800ad6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ada:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ade:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ae2:	e9 5c ff ff ff       	jmp    800a43 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  800ae7:	4c 89 ee             	mov    %r13,%rsi
+  800aea:	bf 30 00 00 00       	mov    $0x30,%edi
+  800aef:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800af2:	4c 89 ee             	mov    %r13,%rsi
+  800af5:	bf 78 00 00 00       	mov    $0x78,%edi
+  800afa:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800afd:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b00:	83 f8 2f             	cmp    $0x2f,%eax
+  800b03:	77 47                	ja     800b4c <vprintfmt+0x5f3>
+  800b05:	89 c2                	mov    %eax,%edx
+  800b07:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b0b:	83 c0 08             	add    $0x8,%eax
+  800b0e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b11:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800b14:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800b19:	48 83 ec 08          	sub    $0x8,%rsp
+  800b1d:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800b21:	0f 94 c0             	sete   %al
+  800b24:	0f b6 c0             	movzbl %al,%eax
+  800b27:	50                   	push   %rax
+  800b28:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800b2d:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800b31:	4c 89 ee             	mov    %r13,%rsi
+  800b34:	4c 89 f7             	mov    %r14,%rdi
+  800b37:	48 b8 4e 04 80 00 00 	movabs $0x80044e,%rax
+  800b3e:	00 00 00 
+  800b41:	ff d0                	call   *%rax
+            break;
+  800b43:	48 83 c4 10          	add    $0x10,%rsp
+  800b47:	e9 3e fa ff ff       	jmp    80058a <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800b4c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b50:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b54:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b58:	eb b7                	jmp    800b11 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  800b5a:	40 84 f6             	test   %sil,%sil
+  800b5d:	75 2b                	jne    800b8a <vprintfmt+0x631>
+    switch (lflag) {
+  800b5f:	85 d2                	test   %edx,%edx
+  800b61:	74 56                	je     800bb9 <vprintfmt+0x660>
+  800b63:	83 fa 01             	cmp    $0x1,%edx
+  800b66:	74 7f                	je     800be7 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800b68:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b6b:	83 f8 2f             	cmp    $0x2f,%eax
+  800b6e:	0f 87 a2 00 00 00    	ja     800c16 <vprintfmt+0x6bd>
+  800b74:	89 c2                	mov    %eax,%edx
+  800b76:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b7a:	83 c0 08             	add    $0x8,%eax
+  800b7d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b80:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800b83:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800b88:	eb 8f                	jmp    800b19 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800b8a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b8d:	83 f8 2f             	cmp    $0x2f,%eax
+  800b90:	77 19                	ja     800bab <vprintfmt+0x652>
+  800b92:	89 c2                	mov    %eax,%edx
+  800b94:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b98:	83 c0 08             	add    $0x8,%eax
+  800b9b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b9e:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800ba1:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800ba6:	e9 6e ff ff ff       	jmp    800b19 <vprintfmt+0x5c0>
+  800bab:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800baf:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bb3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bb7:	eb e5                	jmp    800b9e <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800bb9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bbc:	83 f8 2f             	cmp    $0x2f,%eax
+  800bbf:	77 18                	ja     800bd9 <vprintfmt+0x680>
+  800bc1:	89 c2                	mov    %eax,%edx
+  800bc3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800bc7:	83 c0 08             	add    $0x8,%eax
+  800bca:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800bcd:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800bcf:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800bd4:	e9 40 ff ff ff       	jmp    800b19 <vprintfmt+0x5c0>
+  800bd9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bdd:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800be1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800be5:	eb e6                	jmp    800bcd <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800be7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bea:	83 f8 2f             	cmp    $0x2f,%eax
+  800bed:	77 19                	ja     800c08 <vprintfmt+0x6af>
+  800bef:	89 c2                	mov    %eax,%edx
+  800bf1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800bf5:	83 c0 08             	add    $0x8,%eax
+  800bf8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800bfb:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800bfe:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800c03:	e9 11 ff ff ff       	jmp    800b19 <vprintfmt+0x5c0>
+  800c08:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c0c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c10:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c14:	eb e5                	jmp    800bfb <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800c16:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c1a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c1e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c22:	e9 59 ff ff ff       	jmp    800b80 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800c27:	4c 89 ee             	mov    %r13,%rsi
+  800c2a:	bf 25 00 00 00       	mov    $0x25,%edi
+  800c2f:	41 ff d6             	call   *%r14
+            break;
+  800c32:	e9 53 f9 ff ff       	jmp    80058a <vprintfmt+0x31>
+            putch('%', put_arg);
+  800c37:	4c 89 ee             	mov    %r13,%rsi
+  800c3a:	bf 25 00 00 00       	mov    $0x25,%edi
+  800c3f:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800c42:	48 83 eb 01          	sub    $0x1,%rbx
+  800c46:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800c4a:	75 f6                	jne    800c42 <vprintfmt+0x6e9>
+  800c4c:	e9 39 f9 ff ff       	jmp    80058a <vprintfmt+0x31>
+}
+  800c51:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800c55:	5b                   	pop    %rbx
+  800c56:	41 5c                	pop    %r12
+  800c58:	41 5d                	pop    %r13
+  800c5a:	41 5e                	pop    %r14
+  800c5c:	41 5f                	pop    %r15
+  800c5e:	5d                   	pop    %rbp
+  800c5f:	c3                   	ret
+
+0000000000800c60 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800c60:	55                   	push   %rbp
+  800c61:	48 89 e5             	mov    %rsp,%rbp
+  800c64:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800c68:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800c6c:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800c71:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800c75:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800c7c:	48 85 ff             	test   %rdi,%rdi
+  800c7f:	74 2b                	je     800cac <vsnprintf+0x4c>
+  800c81:	48 85 f6             	test   %rsi,%rsi
+  800c84:	74 26                	je     800cac <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800c86:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800c8a:	48 bf 04 05 80 00 00 	movabs $0x800504,%rdi
+  800c91:	00 00 00 
+  800c94:	48 b8 59 05 80 00 00 	movabs $0x800559,%rax
+  800c9b:	00 00 00 
+  800c9e:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800ca0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800ca4:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800ca7:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800caa:	c9                   	leave
+  800cab:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800cac:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800cb1:	eb f7                	jmp    800caa <vsnprintf+0x4a>
+
+0000000000800cb3 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800cb3:	55                   	push   %rbp
+  800cb4:	48 89 e5             	mov    %rsp,%rbp
+  800cb7:	48 83 ec 50          	sub    $0x50,%rsp
+  800cbb:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800cbf:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800cc3:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800cc7:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800cce:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800cd2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800cd6:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800cda:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800cde:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800ce2:	48 b8 60 0c 80 00 00 	movabs $0x800c60,%rax
+  800ce9:	00 00 00 
+  800cec:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800cee:	c9                   	leave
+  800cef:	c3                   	ret
+
+0000000000800cf0 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800cf0:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800cf3:	74 10                	je     800d05 <strlen+0x15>
+    size_t n = 0;
+  800cf5:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800cfa:	48 83 c0 01          	add    $0x1,%rax
+  800cfe:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800d02:	75 f6                	jne    800cfa <strlen+0xa>
+  800d04:	c3                   	ret
+    size_t n = 0;
+  800d05:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800d0a:	c3                   	ret
+
+0000000000800d0b <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800d0b:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800d0e:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800d13:	48 85 f6             	test   %rsi,%rsi
+  800d16:	74 11                	je     800d29 <strnlen+0x1e>
+  800d18:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800d1c:	74 0c                	je     800d2a <strnlen+0x1f>
+  800d1e:	48 83 c2 01          	add    $0x1,%rdx
+  800d22:	48 39 d0             	cmp    %rdx,%rax
+  800d25:	75 f1                	jne    800d18 <strnlen+0xd>
+  800d27:	eb 04                	jmp    800d2d <strnlen+0x22>
+  800d29:	c3                   	ret
+  800d2a:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800d2d:	c3                   	ret
+
+0000000000800d2e <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800d2e:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800d31:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d36:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800d3a:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800d3d:	48 83 c2 01          	add    $0x1,%rdx
+  800d41:	84 c9                	test   %cl,%cl
+  800d43:	75 f1                	jne    800d36 <strcpy+0x8>
+        ;
+    return res;
+}
+  800d45:	c3                   	ret
+
+0000000000800d46 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800d46:	55                   	push   %rbp
+  800d47:	48 89 e5             	mov    %rsp,%rbp
+  800d4a:	41 54                	push   %r12
+  800d4c:	53                   	push   %rbx
+  800d4d:	48 89 fb             	mov    %rdi,%rbx
+  800d50:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800d53:	48 b8 f0 0c 80 00 00 	movabs $0x800cf0,%rax
+  800d5a:	00 00 00 
+  800d5d:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800d5f:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800d63:	4c 89 e6             	mov    %r12,%rsi
+  800d66:	48 b8 2e 0d 80 00 00 	movabs $0x800d2e,%rax
+  800d6d:	00 00 00 
+  800d70:	ff d0                	call   *%rax
+    return dst;
+}
+  800d72:	48 89 d8             	mov    %rbx,%rax
+  800d75:	5b                   	pop    %rbx
+  800d76:	41 5c                	pop    %r12
+  800d78:	5d                   	pop    %rbp
+  800d79:	c3                   	ret
+
+0000000000800d7a <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800d7a:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800d7d:	48 85 d2             	test   %rdx,%rdx
+  800d80:	74 1f                	je     800da1 <strncpy+0x27>
+  800d82:	48 01 fa             	add    %rdi,%rdx
+  800d85:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800d88:	48 83 c1 01          	add    $0x1,%rcx
+  800d8c:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800d90:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800d94:	41 80 f8 01          	cmp    $0x1,%r8b
+  800d98:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800d9c:	48 39 ca             	cmp    %rcx,%rdx
+  800d9f:	75 e7                	jne    800d88 <strncpy+0xe>
+    }
+    return ret;
+}
+  800da1:	c3                   	ret
+
+0000000000800da2 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800da2:	48 89 f8             	mov    %rdi,%rax
+  800da5:	48 85 d2             	test   %rdx,%rdx
+  800da8:	74 24                	je     800dce <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800daa:	48 83 ea 01          	sub    $0x1,%rdx
+  800dae:	74 1b                	je     800dcb <strlcpy+0x29>
+  800db0:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800db4:	0f b6 16             	movzbl (%rsi),%edx
+  800db7:	84 d2                	test   %dl,%dl
+  800db9:	74 10                	je     800dcb <strlcpy+0x29>
+            *dst++ = *src++;
+  800dbb:	48 83 c6 01          	add    $0x1,%rsi
+  800dbf:	48 83 c0 01          	add    $0x1,%rax
+  800dc3:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800dc6:	48 39 c8             	cmp    %rcx,%rax
+  800dc9:	75 e9                	jne    800db4 <strlcpy+0x12>
+        *dst = '\0';
+  800dcb:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800dce:	48 29 f8             	sub    %rdi,%rax
+}
+  800dd1:	c3                   	ret
+
+0000000000800dd2 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800dd2:	0f b6 07             	movzbl (%rdi),%eax
+  800dd5:	84 c0                	test   %al,%al
+  800dd7:	74 13                	je     800dec <strcmp+0x1a>
+  800dd9:	38 06                	cmp    %al,(%rsi)
+  800ddb:	75 0f                	jne    800dec <strcmp+0x1a>
+  800ddd:	48 83 c7 01          	add    $0x1,%rdi
+  800de1:	48 83 c6 01          	add    $0x1,%rsi
+  800de5:	0f b6 07             	movzbl (%rdi),%eax
+  800de8:	84 c0                	test   %al,%al
+  800dea:	75 ed                	jne    800dd9 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800dec:	0f b6 c0             	movzbl %al,%eax
+  800def:	0f b6 16             	movzbl (%rsi),%edx
+  800df2:	29 d0                	sub    %edx,%eax
+}
+  800df4:	c3                   	ret
+
+0000000000800df5 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800df5:	48 85 d2             	test   %rdx,%rdx
+  800df8:	74 1f                	je     800e19 <strncmp+0x24>
+  800dfa:	0f b6 07             	movzbl (%rdi),%eax
+  800dfd:	84 c0                	test   %al,%al
+  800dff:	74 1e                	je     800e1f <strncmp+0x2a>
+  800e01:	3a 06                	cmp    (%rsi),%al
+  800e03:	75 1a                	jne    800e1f <strncmp+0x2a>
+  800e05:	48 83 c7 01          	add    $0x1,%rdi
+  800e09:	48 83 c6 01          	add    $0x1,%rsi
+  800e0d:	48 83 ea 01          	sub    $0x1,%rdx
+  800e11:	75 e7                	jne    800dfa <strncmp+0x5>
+
+    if (!n) return 0;
+  800e13:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e18:	c3                   	ret
+  800e19:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e1e:	c3                   	ret
+  800e1f:	48 85 d2             	test   %rdx,%rdx
+  800e22:	74 09                	je     800e2d <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800e24:	0f b6 07             	movzbl (%rdi),%eax
+  800e27:	0f b6 16             	movzbl (%rsi),%edx
+  800e2a:	29 d0                	sub    %edx,%eax
+  800e2c:	c3                   	ret
+    if (!n) return 0;
+  800e2d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800e32:	c3                   	ret
+
+0000000000800e33 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800e33:	0f b6 17             	movzbl (%rdi),%edx
+  800e36:	84 d2                	test   %dl,%dl
+  800e38:	74 18                	je     800e52 <strchr+0x1f>
+        if (*str == c) {
+  800e3a:	0f be d2             	movsbl %dl,%edx
+  800e3d:	39 f2                	cmp    %esi,%edx
+  800e3f:	74 17                	je     800e58 <strchr+0x25>
+    for (; *str; str++) {
+  800e41:	48 83 c7 01          	add    $0x1,%rdi
+  800e45:	0f b6 17             	movzbl (%rdi),%edx
+  800e48:	84 d2                	test   %dl,%dl
+  800e4a:	75 ee                	jne    800e3a <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800e4c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e51:	c3                   	ret
+  800e52:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e57:	c3                   	ret
+  800e58:	48 89 f8             	mov    %rdi,%rax
+}
+  800e5b:	c3                   	ret
+
+0000000000800e5c <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800e5c:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800e5f:	0f b6 17             	movzbl (%rdi),%edx
+  800e62:	84 d2                	test   %dl,%dl
+  800e64:	74 13                	je     800e79 <strfind+0x1d>
+  800e66:	0f be d2             	movsbl %dl,%edx
+  800e69:	39 f2                	cmp    %esi,%edx
+  800e6b:	74 0b                	je     800e78 <strfind+0x1c>
+  800e6d:	48 83 c0 01          	add    $0x1,%rax
+  800e71:	0f b6 10             	movzbl (%rax),%edx
+  800e74:	84 d2                	test   %dl,%dl
+  800e76:	75 ee                	jne    800e66 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800e78:	c3                   	ret
+  800e79:	c3                   	ret
+
+0000000000800e7a <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800e7a:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800e7d:	48 89 f8             	mov    %rdi,%rax
+  800e80:	48 f7 d8             	neg    %rax
+  800e83:	83 e0 07             	and    $0x7,%eax
+  800e86:	49 89 d1             	mov    %rdx,%r9
+  800e89:	49 29 c1             	sub    %rax,%r9
+  800e8c:	78 36                	js     800ec4 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800e8e:	40 0f b6 c6          	movzbl %sil,%eax
+  800e92:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800e99:	01 01 01 
+  800e9c:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800ea0:	40 f6 c7 07          	test   $0x7,%dil
+  800ea4:	75 38                	jne    800ede <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800ea6:	4c 89 c9             	mov    %r9,%rcx
+  800ea9:	48 c1 f9 03          	sar    $0x3,%rcx
+  800ead:	74 0c                	je     800ebb <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800eaf:	fc                   	cld
+  800eb0:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800eb3:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800eb7:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800ebb:	4d 85 c9             	test   %r9,%r9
+  800ebe:	75 45                	jne    800f05 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800ec0:	4c 89 c0             	mov    %r8,%rax
+  800ec3:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800ec4:	48 85 d2             	test   %rdx,%rdx
+  800ec7:	74 f7                	je     800ec0 <memset+0x46>
+  800ec9:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800ecc:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800ecf:	48 83 c0 01          	add    $0x1,%rax
+  800ed3:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  800ed7:	48 39 c2             	cmp    %rax,%rdx
+  800eda:	75 f3                	jne    800ecf <memset+0x55>
+  800edc:	eb e2                	jmp    800ec0 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  800ede:	40 f6 c7 01          	test   $0x1,%dil
+  800ee2:	74 06                	je     800eea <memset+0x70>
+  800ee4:	88 07                	mov    %al,(%rdi)
+  800ee6:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800eea:	40 f6 c7 02          	test   $0x2,%dil
+  800eee:	74 07                	je     800ef7 <memset+0x7d>
+  800ef0:	66 89 07             	mov    %ax,(%rdi)
+  800ef3:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800ef7:	40 f6 c7 04          	test   $0x4,%dil
+  800efb:	74 a9                	je     800ea6 <memset+0x2c>
+  800efd:	89 07                	mov    %eax,(%rdi)
+  800eff:	48 83 c7 04          	add    $0x4,%rdi
+  800f03:	eb a1                	jmp    800ea6 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800f05:	41 f6 c1 04          	test   $0x4,%r9b
+  800f09:	74 06                	je     800f11 <memset+0x97>
+  800f0b:	89 07                	mov    %eax,(%rdi)
+  800f0d:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800f11:	41 f6 c1 02          	test   $0x2,%r9b
+  800f15:	74 07                	je     800f1e <memset+0xa4>
+  800f17:	66 89 07             	mov    %ax,(%rdi)
+  800f1a:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  800f1e:	41 f6 c1 01          	test   $0x1,%r9b
+  800f22:	74 9c                	je     800ec0 <memset+0x46>
+  800f24:	88 07                	mov    %al,(%rdi)
+  800f26:	eb 98                	jmp    800ec0 <memset+0x46>
+
+0000000000800f28 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  800f28:	48 89 f8             	mov    %rdi,%rax
+  800f2b:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  800f2e:	48 39 fe             	cmp    %rdi,%rsi
+  800f31:	73 3b                	jae    800f6e <memmove+0x46>
+  800f33:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  800f37:	48 39 d7             	cmp    %rdx,%rdi
+  800f3a:	73 32                	jae    800f6e <memmove+0x46>
+        s += n;
+        d += n;
+  800f3c:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800f40:	48 89 d6             	mov    %rdx,%rsi
+  800f43:	48 09 fe             	or     %rdi,%rsi
+  800f46:	48 09 ce             	or     %rcx,%rsi
+  800f49:	40 f6 c6 07          	test   $0x7,%sil
+  800f4d:	75 12                	jne    800f61 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  800f4f:	48 83 ef 08          	sub    $0x8,%rdi
+  800f53:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  800f57:	48 c1 e9 03          	shr    $0x3,%rcx
+  800f5b:	fd                   	std
+  800f5c:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  800f5f:	fc                   	cld
+  800f60:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  800f61:	48 83 ef 01          	sub    $0x1,%rdi
+  800f65:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  800f69:	fd                   	std
+  800f6a:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  800f6c:	eb f1                	jmp    800f5f <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800f6e:	48 89 f2             	mov    %rsi,%rdx
+  800f71:	48 09 c2             	or     %rax,%rdx
+  800f74:	48 09 ca             	or     %rcx,%rdx
+  800f77:	f6 c2 07             	test   $0x7,%dl
+  800f7a:	75 0c                	jne    800f88 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  800f7c:	48 c1 e9 03          	shr    $0x3,%rcx
+  800f80:	48 89 c7             	mov    %rax,%rdi
+  800f83:	fc                   	cld
+  800f84:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  800f87:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  800f88:	48 89 c7             	mov    %rax,%rdi
+  800f8b:	fc                   	cld
+  800f8c:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  800f8e:	c3                   	ret
+
+0000000000800f8f <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  800f8f:	55                   	push   %rbp
+  800f90:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  800f93:	48 b8 28 0f 80 00 00 	movabs $0x800f28,%rax
+  800f9a:	00 00 00 
+  800f9d:	ff d0                	call   *%rax
+}
+  800f9f:	5d                   	pop    %rbp
+  800fa0:	c3                   	ret
+
+0000000000800fa1 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  800fa1:	55                   	push   %rbp
+  800fa2:	48 89 e5             	mov    %rsp,%rbp
+  800fa5:	41 57                	push   %r15
+  800fa7:	41 56                	push   %r14
+  800fa9:	41 55                	push   %r13
+  800fab:	41 54                	push   %r12
+  800fad:	53                   	push   %rbx
+  800fae:	48 83 ec 08          	sub    $0x8,%rsp
+  800fb2:	49 89 fe             	mov    %rdi,%r14
+  800fb5:	49 89 f7             	mov    %rsi,%r15
+  800fb8:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  800fbb:	48 89 f7             	mov    %rsi,%rdi
+  800fbe:	48 b8 f0 0c 80 00 00 	movabs $0x800cf0,%rax
+  800fc5:	00 00 00 
+  800fc8:	ff d0                	call   *%rax
+  800fca:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  800fcd:	48 89 de             	mov    %rbx,%rsi
+  800fd0:	4c 89 f7             	mov    %r14,%rdi
+  800fd3:	48 b8 0b 0d 80 00 00 	movabs $0x800d0b,%rax
+  800fda:	00 00 00 
+  800fdd:	ff d0                	call   *%rax
+  800fdf:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  800fe2:	48 39 c3             	cmp    %rax,%rbx
+  800fe5:	74 36                	je     80101d <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  800fe7:	48 89 d8             	mov    %rbx,%rax
+  800fea:	4c 29 e8             	sub    %r13,%rax
+  800fed:	49 39 c4             	cmp    %rax,%r12
+  800ff0:	73 31                	jae    801023 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  800ff2:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  800ff7:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800ffb:	4c 89 fe             	mov    %r15,%rsi
+  800ffe:	48 b8 8f 0f 80 00 00 	movabs $0x800f8f,%rax
+  801005:	00 00 00 
+  801008:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  80100a:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  80100e:	48 83 c4 08          	add    $0x8,%rsp
+  801012:	5b                   	pop    %rbx
+  801013:	41 5c                	pop    %r12
+  801015:	41 5d                	pop    %r13
+  801017:	41 5e                	pop    %r14
+  801019:	41 5f                	pop    %r15
+  80101b:	5d                   	pop    %rbp
+  80101c:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  80101d:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  801021:	eb eb                	jmp    80100e <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  801023:	48 83 eb 01          	sub    $0x1,%rbx
+  801027:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  80102b:	48 89 da             	mov    %rbx,%rdx
+  80102e:	4c 89 fe             	mov    %r15,%rsi
+  801031:	48 b8 8f 0f 80 00 00 	movabs $0x800f8f,%rax
+  801038:	00 00 00 
+  80103b:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  80103d:	49 01 de             	add    %rbx,%r14
+  801040:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  801045:	eb c3                	jmp    80100a <strlcat+0x69>
+
+0000000000801047 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  801047:	48 85 d2             	test   %rdx,%rdx
+  80104a:	74 2d                	je     801079 <memcmp+0x32>
+  80104c:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  801051:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  801055:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  80105a:	44 38 c1             	cmp    %r8b,%cl
+  80105d:	75 0f                	jne    80106e <memcmp+0x27>
+    while (n-- > 0) {
+  80105f:	48 83 c0 01          	add    $0x1,%rax
+  801063:	48 39 c2             	cmp    %rax,%rdx
+  801066:	75 e9                	jne    801051 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  801068:	b8 00 00 00 00       	mov    $0x0,%eax
+  80106d:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  80106e:	0f b6 c1             	movzbl %cl,%eax
+  801071:	45 0f b6 c0          	movzbl %r8b,%r8d
+  801075:	44 29 c0             	sub    %r8d,%eax
+  801078:	c3                   	ret
+    return 0;
+  801079:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80107e:	c3                   	ret
+
+000000000080107f <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  80107f:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  801083:	48 39 c7             	cmp    %rax,%rdi
+  801086:	73 0f                	jae    801097 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  801088:	40 38 37             	cmp    %sil,(%rdi)
+  80108b:	74 0e                	je     80109b <memfind+0x1c>
+    for (; src < end; src++) {
+  80108d:	48 83 c7 01          	add    $0x1,%rdi
+  801091:	48 39 f8             	cmp    %rdi,%rax
+  801094:	75 f2                	jne    801088 <memfind+0x9>
+  801096:	c3                   	ret
+  801097:	48 89 f8             	mov    %rdi,%rax
+  80109a:	c3                   	ret
+  80109b:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  80109e:	c3                   	ret
+
+000000000080109f <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  80109f:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  8010a2:	0f b6 37             	movzbl (%rdi),%esi
+  8010a5:	40 80 fe 20          	cmp    $0x20,%sil
+  8010a9:	74 06                	je     8010b1 <strtol+0x12>
+  8010ab:	40 80 fe 09          	cmp    $0x9,%sil
+  8010af:	75 13                	jne    8010c4 <strtol+0x25>
+  8010b1:	48 83 c7 01          	add    $0x1,%rdi
+  8010b5:	0f b6 37             	movzbl (%rdi),%esi
+  8010b8:	40 80 fe 20          	cmp    $0x20,%sil
+  8010bc:	74 f3                	je     8010b1 <strtol+0x12>
+  8010be:	40 80 fe 09          	cmp    $0x9,%sil
+  8010c2:	74 ed                	je     8010b1 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  8010c4:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  8010c7:	83 e0 fd             	and    $0xfffffffd,%eax
+  8010ca:	3c 01                	cmp    $0x1,%al
+  8010cc:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8010d0:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  8010d6:	75 0f                	jne    8010e7 <strtol+0x48>
+  8010d8:	80 3f 30             	cmpb   $0x30,(%rdi)
+  8010db:	74 14                	je     8010f1 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  8010dd:	85 d2                	test   %edx,%edx
+  8010df:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8010e4:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  8010e7:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  8010ec:	4c 63 ca             	movslq %edx,%r9
+  8010ef:	eb 36                	jmp    801127 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8010f1:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  8010f5:	74 0f                	je     801106 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  8010f7:	85 d2                	test   %edx,%edx
+  8010f9:	75 ec                	jne    8010e7 <strtol+0x48>
+        s++;
+  8010fb:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  8010ff:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  801104:	eb e1                	jmp    8010e7 <strtol+0x48>
+        s += 2;
+  801106:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  80110a:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  80110f:	eb d6                	jmp    8010e7 <strtol+0x48>
+            dig -= '0';
+  801111:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  801114:	44 0f b6 c1          	movzbl %cl,%r8d
+  801118:	41 39 d0             	cmp    %edx,%r8d
+  80111b:	7d 21                	jge    80113e <strtol+0x9f>
+        val = val * base + dig;
+  80111d:	49 0f af c1          	imul   %r9,%rax
+  801121:	0f b6 c9             	movzbl %cl,%ecx
+  801124:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  801127:	48 83 c7 01          	add    $0x1,%rdi
+  80112b:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  80112f:	80 f9 39             	cmp    $0x39,%cl
+  801132:	76 dd                	jbe    801111 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  801134:	80 f9 7b             	cmp    $0x7b,%cl
+  801137:	77 05                	ja     80113e <strtol+0x9f>
+            dig -= 'a' - 10;
+  801139:	83 e9 57             	sub    $0x57,%ecx
+  80113c:	eb d6                	jmp    801114 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  80113e:	4d 85 d2             	test   %r10,%r10
+  801141:	74 03                	je     801146 <strtol+0xa7>
+  801143:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  801146:	48 89 c2             	mov    %rax,%rdx
+  801149:	48 f7 da             	neg    %rdx
+  80114c:	40 80 fe 2d          	cmp    $0x2d,%sil
+  801150:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  801154:	c3                   	ret
+
+0000000000801155 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  801155:	55                   	push   %rbp
+  801156:	48 89 e5             	mov    %rsp,%rbp
+  801159:	53                   	push   %rbx
+  80115a:	48 89 fa             	mov    %rdi,%rdx
+  80115d:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801160:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801165:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80116a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80116f:	be 00 00 00 00       	mov    $0x0,%esi
+  801174:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80117a:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  80117c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801180:	c9                   	leave
+  801181:	c3                   	ret
+
+0000000000801182 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  801182:	55                   	push   %rbp
+  801183:	48 89 e5             	mov    %rsp,%rbp
+  801186:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801187:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80118c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801191:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801196:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80119b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8011a0:	be 00 00 00 00       	mov    $0x0,%esi
+  8011a5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8011ab:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  8011ad:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8011b1:	c9                   	leave
+  8011b2:	c3                   	ret
+
+00000000008011b3 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  8011b3:	55                   	push   %rbp
+  8011b4:	48 89 e5             	mov    %rsp,%rbp
+  8011b7:	53                   	push   %rbx
+  8011b8:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  8011bc:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8011bf:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8011c4:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8011c9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011ce:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8011d3:	be 00 00 00 00       	mov    $0x0,%esi
+  8011d8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8011de:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8011e0:	48 85 c0             	test   %rax,%rax
+  8011e3:	7f 06                	jg     8011eb <sys_env_destroy+0x38>
+}
+  8011e5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8011e9:	c9                   	leave
+  8011ea:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8011eb:	49 89 c0             	mov    %rax,%r8
+  8011ee:	b9 03 00 00 00       	mov    $0x3,%ecx
+  8011f3:	48 ba 70 36 80 00 00 	movabs $0x803670,%rdx
+  8011fa:	00 00 00 
+  8011fd:	be 26 00 00 00       	mov    $0x26,%esi
+  801202:	48 bf 8f 36 80 00 00 	movabs $0x80368f,%rdi
+  801209:	00 00 00 
+  80120c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801211:	49 b9 b9 02 80 00 00 	movabs $0x8002b9,%r9
+  801218:	00 00 00 
+  80121b:	41 ff d1             	call   *%r9
+
+000000000080121e <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  80121e:	55                   	push   %rbp
+  80121f:	48 89 e5             	mov    %rsp,%rbp
+  801222:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801223:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801228:	ba 00 00 00 00       	mov    $0x0,%edx
+  80122d:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801232:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801237:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80123c:	be 00 00 00 00       	mov    $0x0,%esi
+  801241:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801247:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  801249:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80124d:	c9                   	leave
+  80124e:	c3                   	ret
+
+000000000080124f <sys_yield>:
+
+void
+sys_yield(void) {
+  80124f:	55                   	push   %rbp
+  801250:	48 89 e5             	mov    %rsp,%rbp
+  801253:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801254:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801259:	ba 00 00 00 00       	mov    $0x0,%edx
+  80125e:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801263:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801268:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80126d:	be 00 00 00 00       	mov    $0x0,%esi
+  801272:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801278:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  80127a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80127e:	c9                   	leave
+  80127f:	c3                   	ret
+
+0000000000801280 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  801280:	55                   	push   %rbp
+  801281:	48 89 e5             	mov    %rsp,%rbp
+  801284:	53                   	push   %rbx
+  801285:	48 89 fa             	mov    %rdi,%rdx
+  801288:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80128b:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801290:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  801297:	00 00 00 
+  80129a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80129f:	be 00 00 00 00       	mov    $0x0,%esi
+  8012a4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8012aa:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  8012ac:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012b0:	c9                   	leave
+  8012b1:	c3                   	ret
+
+00000000008012b2 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  8012b2:	55                   	push   %rbp
+  8012b3:	48 89 e5             	mov    %rsp,%rbp
+  8012b6:	53                   	push   %rbx
+  8012b7:	49 89 f8             	mov    %rdi,%r8
+  8012ba:	48 89 d3             	mov    %rdx,%rbx
+  8012bd:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8012c0:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8012c5:	4c 89 c2             	mov    %r8,%rdx
+  8012c8:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012cb:	be 00 00 00 00       	mov    $0x0,%esi
+  8012d0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8012d6:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  8012d8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012dc:	c9                   	leave
+  8012dd:	c3                   	ret
+
+00000000008012de <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  8012de:	55                   	push   %rbp
+  8012df:	48 89 e5             	mov    %rsp,%rbp
+  8012e2:	53                   	push   %rbx
+  8012e3:	48 83 ec 08          	sub    $0x8,%rsp
+  8012e7:	89 f8                	mov    %edi,%eax
+  8012e9:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  8012ec:	48 63 f9             	movslq %ecx,%rdi
+  8012ef:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8012f2:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8012f7:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012fa:	be 00 00 00 00       	mov    $0x0,%esi
+  8012ff:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801305:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801307:	48 85 c0             	test   %rax,%rax
+  80130a:	7f 06                	jg     801312 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  80130c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801310:	c9                   	leave
+  801311:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801312:	49 89 c0             	mov    %rax,%r8
+  801315:	b9 04 00 00 00       	mov    $0x4,%ecx
+  80131a:	48 ba 70 36 80 00 00 	movabs $0x803670,%rdx
+  801321:	00 00 00 
+  801324:	be 26 00 00 00       	mov    $0x26,%esi
+  801329:	48 bf 8f 36 80 00 00 	movabs $0x80368f,%rdi
+  801330:	00 00 00 
+  801333:	b8 00 00 00 00       	mov    $0x0,%eax
+  801338:	49 b9 b9 02 80 00 00 	movabs $0x8002b9,%r9
+  80133f:	00 00 00 
+  801342:	41 ff d1             	call   *%r9
+
+0000000000801345 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801345:	55                   	push   %rbp
+  801346:	48 89 e5             	mov    %rsp,%rbp
+  801349:	53                   	push   %rbx
+  80134a:	48 83 ec 08          	sub    $0x8,%rsp
+  80134e:	89 f8                	mov    %edi,%eax
+  801350:	49 89 f2             	mov    %rsi,%r10
+  801353:	48 89 cf             	mov    %rcx,%rdi
+  801356:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  801359:	48 63 da             	movslq %edx,%rbx
+  80135c:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80135f:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801364:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801367:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  80136a:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80136c:	48 85 c0             	test   %rax,%rax
+  80136f:	7f 06                	jg     801377 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  801371:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801375:	c9                   	leave
+  801376:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801377:	49 89 c0             	mov    %rax,%r8
+  80137a:	b9 05 00 00 00       	mov    $0x5,%ecx
+  80137f:	48 ba 70 36 80 00 00 	movabs $0x803670,%rdx
+  801386:	00 00 00 
+  801389:	be 26 00 00 00       	mov    $0x26,%esi
+  80138e:	48 bf 8f 36 80 00 00 	movabs $0x80368f,%rdi
+  801395:	00 00 00 
+  801398:	b8 00 00 00 00       	mov    $0x0,%eax
+  80139d:	49 b9 b9 02 80 00 00 	movabs $0x8002b9,%r9
+  8013a4:	00 00 00 
+  8013a7:	41 ff d1             	call   *%r9
+
+00000000008013aa <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  8013aa:	55                   	push   %rbp
+  8013ab:	48 89 e5             	mov    %rsp,%rbp
+  8013ae:	53                   	push   %rbx
+  8013af:	48 83 ec 08          	sub    $0x8,%rsp
+  8013b3:	48 89 f1             	mov    %rsi,%rcx
+  8013b6:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  8013b9:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8013bc:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8013c1:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013c6:	be 00 00 00 00       	mov    $0x0,%esi
+  8013cb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013d1:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8013d3:	48 85 c0             	test   %rax,%rax
+  8013d6:	7f 06                	jg     8013de <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  8013d8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013dc:	c9                   	leave
+  8013dd:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8013de:	49 89 c0             	mov    %rax,%r8
+  8013e1:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8013e6:	48 ba 70 36 80 00 00 	movabs $0x803670,%rdx
+  8013ed:	00 00 00 
+  8013f0:	be 26 00 00 00       	mov    $0x26,%esi
+  8013f5:	48 bf 8f 36 80 00 00 	movabs $0x80368f,%rdi
+  8013fc:	00 00 00 
+  8013ff:	b8 00 00 00 00       	mov    $0x0,%eax
+  801404:	49 b9 b9 02 80 00 00 	movabs $0x8002b9,%r9
+  80140b:	00 00 00 
+  80140e:	41 ff d1             	call   *%r9
+
+0000000000801411 <sys_region_batch>:
+
+int
+sys_region_batch(const struct RegionOp *ops, size_t count) {
+  801411:	55                   	push   %rbp
+  801412:	48 89 e5             	mov    %rsp,%rbp
+  801415:	53                   	push   %rbx
+  801416:	48 83 ec 08          	sub    $0x8,%rsp
+  80141a:	48 89 fa             	mov    %rdi,%rdx
+  80141d:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801420:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801425:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80142a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80142f:	be 00 00 00 00       	mov    $0x0,%esi
+  801434:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80143a:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80143c:	48 85 c0             	test   %rax,%rax
+  80143f:	7f 06                	jg     801447 <sys_region_batch+0x36>
+        else
+            platform_asan_unpoison(va, ops[i].size);
+    }
+#endif
+    return res;
+}
+  801441:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801445:	c9                   	leave
+  801446:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801447:	49 89 c0             	mov    %rax,%r8
+  80144a:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  80144f:	48 ba 70 36 80 00 00 	movabs $0x803670,%rdx
+  801456:	00 00 00 
+  801459:	be 26 00 00 00       	mov    $0x26,%esi
+  80145e:	48 bf 8f 36 80 00 00 	movabs $0x80368f,%rdi
+  801465:	00 00 00 
+  801468:	b8 00 00 00 00       	mov    $0x0,%eax
+  80146d:	49 b9 b9 02 80 00 00 	movabs $0x8002b9,%r9
+  801474:	00 00 00 
+  801477:	41 ff d1             	call   *%r9
+
+000000000080147a <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  80147a:	55                   	push   %rbp
+  80147b:	48 89 e5             	mov    %rsp,%rbp
+  80147e:	53                   	push   %rbx
+  80147f:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  801483:	48 63 ce             	movslq %esi,%rcx
+  801486:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801489:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80148e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801493:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801498:	be 00 00 00 00       	mov    $0x0,%esi
+  80149d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014a3:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8014a5:	48 85 c0             	test   %rax,%rax
+  8014a8:	7f 06                	jg     8014b0 <sys_env_set_status+0x36>
+}
+  8014aa:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014ae:	c9                   	leave
+  8014af:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8014b0:	49 89 c0             	mov    %rax,%r8
+  8014b3:	b9 09 00 00 00       	mov    $0x9,%ecx
+  8014b8:	48 ba 70 36 80 00 00 	movabs $0x803670,%rdx
+  8014bf:	00 00 00 
+  8014c2:	be 26 00 00 00       	mov    $0x26,%esi
+  8014c7:	48 bf 8f 36 80 00 00 	movabs $0x80368f,%rdi
+  8014ce:	00 00 00 
+  8014d1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014d6:	49 b9 b9 02 80 00 00 	movabs $0x8002b9,%r9
+  8014dd:	00 00 00 
+  8014e0:	41 ff d1             	call   *%r9
+
+00000000008014e3 <sys_env_set_weight>:
+
+int
+sys_env_set_weight(envid_t envid, uint32_t weight) {
+  8014e3:	55                   	push   %rbp
+  8014e4:	48 89 e5             	mov    %rsp,%rbp
+  8014e7:	53                   	push   %rbx
+  8014e8:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_weight, 1, envid, weight, 0, 0, 0, 0);
+  8014ec:	89 f1                	mov    %esi,%ecx
+  8014ee:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8014f1:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8014f6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014fb:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801500:	be 00 00 00 00       	mov    $0x0,%esi
+  801505:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80150b:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80150d:	48 85 c0             	test   %rax,%rax
+  801510:	7f 06                	jg     801518 <sys_env_set_weight+0x35>
+}
+  801512:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801516:	c9                   	leave
+  801517:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801518:	49 89 c0             	mov    %rax,%r8
+  80151b:	b9 10 00 00 00       	mov    $0x10,%ecx
+  801520:	48 ba 70 36 80 00 00 	movabs $0x803670,%rdx
+  801527:	00 00 00 
+  80152a:	be 26 00 00 00       	mov    $0x26,%esi
+  80152f:	48 bf 8f 36 80 00 00 	movabs $0x80368f,%rdi
+  801536:	00 00 00 
+  801539:	b8 00 00 00 00       	mov    $0x0,%eax
+  80153e:	49 b9 b9 02 80 00 00 	movabs $0x8002b9,%r9
+  801545:	00 00 00 
+  801548:	41 ff d1             	call   *%r9
+
+000000000080154b <sys_env_set_rt>:
+
+int
+sys_env_set_rt(envid_t envid, uint64_t period, uint64_t budget, uint64_t deadline) {
+  80154b:	55                   	push   %rbp
+  80154c:	48 89 e5             	mov    %rsp,%rbp
+  80154f:	53                   	push   %rbx
+  801550:	48 83 ec 08          	sub    $0x8,%rsp
+  801554:	89 f8                	mov    %edi,%eax
+  801556:	48 89 d3             	mov    %rdx,%rbx
+  801559:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_env_set_rt, 1, envid, period, budget, deadline, 0, 0);
+  80155c:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80155f:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801564:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801567:	be 00 00 00 00       	mov    $0x0,%esi
+  80156c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801572:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801574:	48 85 c0             	test   %rax,%rax
+  801577:	7f 06                	jg     80157f <sys_env_set_rt+0x34>
+}
+  801579:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80157d:	c9                   	leave
+  80157e:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80157f:	49 89 c0             	mov    %rax,%r8
+  801582:	b9 11 00 00 00       	mov    $0x11,%ecx
+  801587:	48 ba 70 36 80 00 00 	movabs $0x803670,%rdx
+  80158e:	00 00 00 
+  801591:	be 26 00 00 00       	mov    $0x26,%esi
+  801596:	48 bf 8f 36 80 00 00 	movabs $0x80368f,%rdi
+  80159d:	00 00 00 
+  8015a0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015a5:	49 b9 b9 02 80 00 00 	movabs $0x8002b9,%r9
+  8015ac:	00 00 00 
+  8015af:	41 ff d1             	call   *%r9
+
+00000000008015b2 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  8015b2:	55                   	push   %rbp
+  8015b3:	48 89 e5             	mov    %rsp,%rbp
+  8015b6:	53                   	push   %rbx
+  8015b7:	48 83 ec 08          	sub    $0x8,%rsp
+  8015bb:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  8015be:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8015c1:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8015c6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015cb:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015d0:	be 00 00 00 00       	mov    $0x0,%esi
+  8015d5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015db:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8015dd:	48 85 c0             	test   %rax,%rax
+  8015e0:	7f 06                	jg     8015e8 <sys_env_set_trapframe+0x36>
+}
+  8015e2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015e6:	c9                   	leave
+  8015e7:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8015e8:	49 89 c0             	mov    %rax,%r8
+  8015eb:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  8015f0:	48 ba 70 36 80 00 00 	movabs $0x803670,%rdx
+  8015f7:	00 00 00 
+  8015fa:	be 26 00 00 00       	mov    $0x26,%esi
+  8015ff:	48 bf 8f 36 80 00 00 	movabs $0x80368f,%rdi
+  801606:	00 00 00 
+  801609:	b8 00 00 00 00       	mov    $0x0,%eax
+  80160e:	49 b9 b9 02 80 00 00 	movabs $0x8002b9,%r9
+  801615:	00 00 00 
+  801618:	41 ff d1             	call   *%r9
+
+000000000080161b <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  80161b:	55                   	push   %rbp
+  80161c:	48 89 e5             	mov    %rsp,%rbp
+  80161f:	53                   	push   %rbx
+  801620:	48 83 ec 08          	sub    $0x8,%rsp
+  801624:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  801627:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80162a:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80162f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801634:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801639:	be 00 00 00 00       	mov    $0x0,%esi
+  80163e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801644:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801646:	48 85 c0             	test   %rax,%rax
+  801649:	7f 06                	jg     801651 <sys_env_set_pgfault_upcall+0x36>
+}
+  80164b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80164f:	c9                   	leave
+  801650:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801651:	49 89 c0             	mov    %rax,%r8
+  801654:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  801659:	48 ba 70 36 80 00 00 	movabs $0x803670,%rdx
+  801660:	00 00 00 
+  801663:	be 26 00 00 00       	mov    $0x26,%esi
+  801668:	48 bf 8f 36 80 00 00 	movabs $0x80368f,%rdi
+  80166f:	00 00 00 
+  801672:	b8 00 00 00 00       	mov    $0x0,%eax
+  801677:	49 b9 b9 02 80 00 00 	movabs $0x8002b9,%r9
+  80167e:	00 00 00 
+  801681:	41 ff d1             	call   *%r9
+
+0000000000801684 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  801684:	55                   	push   %rbp
+  801685:	48 89 e5             	mov    %rsp,%rbp
+  801688:	53                   	push   %rbx
+  801689:	89 f8                	mov    %edi,%eax
+  80168b:	49 89 f1             	mov    %rsi,%r9
+  80168e:	48 89 d3             	mov    %rdx,%rbx
+  801691:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  801694:	49 63 f0             	movslq %r8d,%rsi
+  801697:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80169a:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80169f:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8016a2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8016a8:	cd 30                	int    $0x30
+}
+  8016aa:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8016ae:	c9                   	leave
+  8016af:	c3                   	ret
+
+00000000008016b0 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  8016b0:	55                   	push   %rbp
+  8016b1:	48 89 e5             	mov    %rsp,%rbp
+  8016b4:	53                   	push   %rbx
+  8016b5:	48 83 ec 08          	sub    $0x8,%rsp
+  8016b9:	48 89 fa             	mov    %rdi,%rdx
+  8016bc:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8016bf:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8016c4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016c9:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8016ce:	be 00 00 00 00       	mov    $0x0,%esi
+  8016d3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8016d9:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8016db:	48 85 c0             	test   %rax,%rax
+  8016de:	7f 06                	jg     8016e6 <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8016e0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8016e4:	c9                   	leave
+  8016e5:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8016e6:	49 89 c0             	mov    %rax,%r8
+  8016e9:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  8016ee:	48 ba 70 36 80 00 00 	movabs $0x803670,%rdx
+  8016f5:	00 00 00 
+  8016f8:	be 26 00 00 00       	mov    $0x26,%esi
+  8016fd:	48 bf 8f 36 80 00 00 	movabs $0x80368f,%rdi
+  801704:	00 00 00 
+  801707:	b8 00 00 00 00       	mov    $0x0,%eax
+  80170c:	49 b9 b9 02 80 00 00 	movabs $0x8002b9,%r9
+  801713:	00 00 00 
+  801716:	41 ff d1             	call   *%r9
+
+0000000000801719 <fork>:
+ * Hint:
+ *   Use sys_map_region, it can perform address space copying in one call
+ *   Remember to fix "thisenv" in the child process.
+ */
+envid_t
+fork(void) {
+  801719:	55                   	push   %rbp
+  80171a:	48 89 e5             	mov    %rsp,%rbp
+  80171d:	41 55                	push   %r13
+  80171f:	41 54                	push   %r12
+  801721:	53                   	push   %rbx
+  801722:	48 83 ec 08          	sub    $0x8,%rsp
+
+/* This must be inlined. Exercise for reader: why? */
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+    envid_t ret;
+    asm volatile("int %2"
+  801726:	b8 08 00 00 00       	mov    $0x8,%eax
+  80172b:	cd 30                	int    $0x30
+  80172d:	41 89 c5             	mov    %eax,%r13d
+    // LAB 9: Your code here
+
+    envid_t child_id = sys_exofork();
+    if (child_id < 0) {
+  801730:	85 c0                	test   %eax,%eax
+  801732:	0f 88 ae 00 00 00    	js     8017e6 <fork+0xcd>
+  801738:	89 c3                	mov    %eax,%ebx
+        return child_id;
+    }
+    if (child_id == 0) {
+  80173a:	0f 84 b4 00 00 00    	je     8017f4 <fork+0xdb>
+        thisenv = &envs[ENVX(sys_getenvid())];
+        return 0;
+    }
+    int res = sys_map_region(0, NULL, child_id, NULL, MAX_USER_ADDRESS, PROT_ALL | PROT_LAZY | PROT_COMBINE);
+  801740:	41 b9 df 01 00 00    	mov    $0x1df,%r9d
+  801746:	49 b8 00 00 00 00 80 	movabs $0x8000000000,%r8
+  80174d:	00 00 00 
+  801750:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801755:	89 c2                	mov    %eax,%edx
+  801757:	be 00 00 00 00       	mov    $0x0,%esi
+  80175c:	bf 00 00 00 00       	mov    $0x0,%edi
+  801761:	48 b8 45 13 80 00 00 	movabs $0x801345,%rax
+  801768:	00 00 00 
+  80176b:	ff d0                	call   *%rax
+  80176d:	41 89 c4             	mov    %eax,%r12d
+    if (res < 0) {
+  801770:	85 c0                	test   %eax,%eax
+  801772:	78 5d                	js     8017d1 <fork+0xb8>
+        goto error;
+    }
+    res = sys_env_set_pgfault_upcall(child_id, envs[ENVX(sys_getenvid())].env_pgfault_upcall);
+  801774:	48 b8 1e 12 80 00 00 	movabs $0x80121e,%rax
+  80177b:	00 00 00 
+  80177e:	ff d0                	call   *%rax
+  801780:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801785:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+  80178c:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  801793:	00 00 00 
+  801796:	48 01 d0             	add    %rdx,%rax
+  801799:	48 8b b0 88 01 00 00 	mov    0x188(%rax),%rsi
+  8017a0:	44 89 ef             	mov    %r13d,%edi
+  8017a3:	48 b8 1b 16 80 00 00 	movabs $0x80161b,%rax
+  8017aa:	00 00 00 
+  8017ad:	ff d0                	call   *%rax
+  8017af:	41 89 c4             	mov    %eax,%r12d
+    if (res < 0) {
+  8017b2:	85 c0                	test   %eax,%eax
+  8017b4:	78 1b                	js     8017d1 <fork+0xb8>
+        goto error;
+    }
+    res = sys_env_set_status(child_id, ENV_RUNNABLE);
+  8017b6:	be 02 00 00 00       	mov    $0x2,%esi
+  8017bb:	44 89 ef             	mov    %r13d,%edi
+  8017be:	48 b8 7a 14 80 00 00 	movabs $0x80147a,%rax
+  8017c5:	00 00 00 
+  8017c8:	ff d0                	call   *%rax
+  8017ca:	41 89 c4             	mov    %eax,%r12d
+    if (res < 0) {
+  8017cd:	85 c0                	test   %eax,%eax
+  8017cf:	79 15                	jns    8017e6 <fork+0xcd>
+        goto error;
+    }
+    return child_id;
+error:
+    ;
+    int res2 = sys_env_destroy(child_id);
+  8017d1:	89 df                	mov    %ebx,%edi
+  8017d3:	48 b8 b3 11 80 00 00 	movabs $0x8011b3,%rax
+  8017da:	00 00 00 
+  8017dd:	ff d0                	call   *%rax
+    if (res2 < 0) {
+  8017df:	85 c0                	test   %eax,%eax
+  8017e1:	78 42                	js     801825 <fork+0x10c>
+        panic("Fork double fault");
+    }
+    return res;
+  8017e3:	45 89 e5             	mov    %r12d,%r13d
+}
+  8017e6:	44 89 e8             	mov    %r13d,%eax
+  8017e9:	48 83 c4 08          	add    $0x8,%rsp
+  8017ed:	5b                   	pop    %rbx
+  8017ee:	41 5c                	pop    %r12
+  8017f0:	41 5d                	pop    %r13
+  8017f2:	5d                   	pop    %rbp
+  8017f3:	c3                   	ret
+        thisenv = &envs[ENVX(sys_getenvid())];
+  8017f4:	48 b8 1e 12 80 00 00 	movabs $0x80121e,%rax
+  8017fb:	00 00 00 
+  8017fe:	ff d0                	call   *%rax
+  801800:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801805:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+  80180c:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  801813:	00 00 00 
+  801816:	48 01 d0             	add    %rdx,%rax
+  801819:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  801820:	00 00 00 
+        return 0;
+  801823:	eb c1                	jmp    8017e6 <fork+0xcd>
+        panic("Fork double fault");
+  801825:	48 ba 9d 36 80 00 00 	movabs $0x80369d,%rdx
+  80182c:	00 00 00 
+  80182f:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801834:	48 bf af 36 80 00 00 	movabs $0x8036af,%rdi
+  80183b:	00 00 00 
+  80183e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801843:	48 b9 b9 02 80 00 00 	movabs $0x8002b9,%rcx
+  80184a:	00 00 00 
+  80184d:	ff d1                	call   *%rcx
+
+000000000080184f <sfork>:
+
+envid_t
+sfork() {
+  80184f:	55                   	push   %rbp
+  801850:	48 89 e5             	mov    %rsp,%rbp
+    panic("sfork() is not implemented");
+  801853:	48 ba ba 36 80 00 00 	movabs $0x8036ba,%rdx
+  80185a:	00 00 00 
+  80185d:	be 36 00 00 00       	mov    $0x36,%esi
+  801862:	48 bf af 36 80 00 00 	movabs $0x8036af,%rdi
+  801869:	00 00 00 
+  80186c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801871:	48 b9 b9 02 80 00 00 	movabs $0x8002b9,%rcx
+  801878:	00 00 00 
+  80187b:	ff d1                	call   *%rcx
+
+000000000080187d <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80187d:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801884:	ff ff ff 
+  801887:	48 01 f8             	add    %rdi,%rax
+  80188a:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  80188e:	c3                   	ret
+
+000000000080188f <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80188f:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801896:	ff ff ff 
+  801899:	48 01 f8             	add    %rdi,%rax
+  80189c:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  8018a0:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  8018a6:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  8018aa:	c3                   	ret
+
+00000000008018ab <fd_alloc_from>:
+}
+
+/* Like fd_alloc(), but only considers fds starting from fdnum,
+ * so that several fds can be found before their pages are allocated */
+int
+fd_alloc_from(int fdnum, struct Fd **fd_store) {
+  8018ab:	55                   	push   %rbp
+  8018ac:	48 89 e5             	mov    %rsp,%rbp
+  8018af:	41 57                	push   %r15
+  8018b1:	41 56                	push   %r14
+  8018b3:	41 55                	push   %r13
+  8018b5:	41 54                	push   %r12
+  8018b7:	53                   	push   %rbx
+  8018b8:	48 83 ec 08          	sub    $0x8,%rsp
+  8018bc:	49 89 f7             	mov    %rsi,%r15
+    for (int i = MAX(fdnum, 0); i < MAXFD; i++) {
+  8018bf:	85 ff                	test   %edi,%edi
+  8018c1:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8018c7:	44 0f 49 e7          	cmovns %edi,%r12d
+  8018cb:	83 ff 1f             	cmp    $0x1f,%edi
+  8018ce:	7f 37                	jg     801907 <fd_alloc_from+0x5c>
+  8018d0:	49 63 dc             	movslq %r12d,%rbx
+  8018d3:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  8018da:	48 c1 e3 0c          	shl    $0xc,%rbx
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  8018de:	49 be 6d 2a 80 00 00 	movabs $0x802a6d,%r14
+  8018e5:	00 00 00 
+        struct Fd *fd = INDEX2FD(i);
+  8018e8:	49 89 dd             	mov    %rbx,%r13
+        if (!(get_prot(fd) & PROT_R)) {
+  8018eb:	48 89 df             	mov    %rbx,%rdi
+  8018ee:	41 ff d6             	call   *%r14
+  8018f1:	83 e0 04             	and    $0x4,%eax
+  8018f4:	74 1c                	je     801912 <fd_alloc_from+0x67>
+    for (int i = MAX(fdnum, 0); i < MAXFD; i++) {
+  8018f6:	41 83 c4 01          	add    $0x1,%r12d
+  8018fa:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801901:	41 83 fc 1f          	cmp    $0x1f,%r12d
+  801905:	7e e1                	jle    8018e8 <fd_alloc_from+0x3d>
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  801907:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  80190d:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  801912:	4d 89 2f             	mov    %r13,(%r15)
+}
+  801915:	48 83 c4 08          	add    $0x8,%rsp
+  801919:	5b                   	pop    %rbx
+  80191a:	41 5c                	pop    %r12
+  80191c:	41 5d                	pop    %r13
+  80191e:	41 5e                	pop    %r14
+  801920:	41 5f                	pop    %r15
+  801922:	5d                   	pop    %rbp
+  801923:	c3                   	ret
+
+0000000000801924 <fd_alloc>:
+fd_alloc(struct Fd **fd_store) {
+  801924:	55                   	push   %rbp
+  801925:	48 89 e5             	mov    %rsp,%rbp
+  801928:	48 89 fe             	mov    %rdi,%rsi
+    return fd_alloc_from(0, fd_store);
+  80192b:	bf 00 00 00 00       	mov    $0x0,%edi
+  801930:	48 b8 ab 18 80 00 00 	movabs $0x8018ab,%rax
+  801937:	00 00 00 
+  80193a:	ff d0                	call   *%rax
+}
+  80193c:	5d                   	pop    %rbp
+  80193d:	c3                   	ret
+
+000000000080193e <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  80193e:	83 ff 1f             	cmp    $0x1f,%edi
+  801941:	77 39                	ja     80197c <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  801943:	55                   	push   %rbp
+  801944:	48 89 e5             	mov    %rsp,%rbp
+  801947:	41 54                	push   %r12
+  801949:	53                   	push   %rbx
+  80194a:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  80194d:	48 63 df             	movslq %edi,%rbx
+  801950:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  801957:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  80195b:	48 89 df             	mov    %rbx,%rdi
+  80195e:	48 b8 6d 2a 80 00 00 	movabs $0x802a6d,%rax
+  801965:	00 00 00 
+  801968:	ff d0                	call   *%rax
+  80196a:	a8 04                	test   $0x4,%al
+  80196c:	74 14                	je     801982 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  80196e:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  801972:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801977:	5b                   	pop    %rbx
+  801978:	41 5c                	pop    %r12
+  80197a:	5d                   	pop    %rbp
+  80197b:	c3                   	ret
+        return -E_INVAL;
+  80197c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801981:	c3                   	ret
+        return -E_INVAL;
+  801982:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801987:	eb ee                	jmp    801977 <fd_lookup+0x39>
+
+0000000000801989 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  801989:	55                   	push   %rbp
+  80198a:	48 89 e5             	mov    %rsp,%rbp
+  80198d:	41 54                	push   %r12
+  80198f:	53                   	push   %rbx
+  801990:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  801993:	48 b8 60 37 80 00 00 	movabs $0x803760,%rax
+  80199a:	00 00 00 
+  80199d:	48 bb 20 40 80 00 00 	movabs $0x804020,%rbx
+  8019a4:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  8019a7:	39 3b                	cmp    %edi,(%rbx)
+  8019a9:	74 47                	je     8019f2 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  8019ab:	48 83 c0 08          	add    $0x8,%rax
+  8019af:	48 8b 18             	mov    (%rax),%rbx
+  8019b2:	48 85 db             	test   %rbx,%rbx
+  8019b5:	75 f0                	jne    8019a7 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8019b7:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  8019be:	00 00 00 
+  8019c1:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+  8019c7:	89 fa                	mov    %edi,%edx
+  8019c9:	48 bf d8 36 80 00 00 	movabs $0x8036d8,%rdi
+  8019d0:	00 00 00 
+  8019d3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019d8:	48 b9 09 04 80 00 00 	movabs $0x800409,%rcx
+  8019df:	00 00 00 
+  8019e2:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  8019e4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  8019e9:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  8019ed:	5b                   	pop    %rbx
+  8019ee:	41 5c                	pop    %r12
+  8019f0:	5d                   	pop    %rbp
+  8019f1:	c3                   	ret
+            return 0;
+  8019f2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019f7:	eb f0                	jmp    8019e9 <dev_lookup+0x60>
+
+00000000008019f9 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  8019f9:	55                   	push   %rbp
+  8019fa:	48 89 e5             	mov    %rsp,%rbp
+  8019fd:	41 55                	push   %r13
+  8019ff:	41 54                	push   %r12
+  801a01:	53                   	push   %rbx
+  801a02:	48 83 ec 18          	sub    $0x18,%rsp
+  801a06:	48 89 fb             	mov    %rdi,%rbx
+  801a09:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801a0c:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  801a13:	ff ff ff 
+  801a16:	48 01 df             	add    %rbx,%rdi
+  801a19:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  801a1d:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801a21:	48 b8 3e 19 80 00 00 	movabs $0x80193e,%rax
+  801a28:	00 00 00 
+  801a2b:	ff d0                	call   *%rax
+  801a2d:	41 89 c5             	mov    %eax,%r13d
+  801a30:	85 c0                	test   %eax,%eax
+  801a32:	78 06                	js     801a3a <fd_close+0x41>
+  801a34:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  801a38:	74 1a                	je     801a54 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  801a3a:	45 84 e4             	test   %r12b,%r12b
+  801a3d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a42:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  801a46:	44 89 e8             	mov    %r13d,%eax
+  801a49:	48 83 c4 18          	add    $0x18,%rsp
+  801a4d:	5b                   	pop    %rbx
+  801a4e:	41 5c                	pop    %r12
+  801a50:	41 5d                	pop    %r13
+  801a52:	5d                   	pop    %rbp
+  801a53:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801a54:	8b 3b                	mov    (%rbx),%edi
+  801a56:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801a5a:	48 b8 89 19 80 00 00 	movabs $0x801989,%rax
+  801a61:	00 00 00 
+  801a64:	ff d0                	call   *%rax
+  801a66:	41 89 c5             	mov    %eax,%r13d
+  801a69:	85 c0                	test   %eax,%eax
+  801a6b:	78 1b                	js     801a88 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  801a6d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801a71:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801a75:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801a7b:	48 85 c0             	test   %rax,%rax
+  801a7e:	74 08                	je     801a88 <fd_close+0x8f>
+  801a80:	48 89 df             	mov    %rbx,%rdi
+  801a83:	ff d0                	call   *%rax
+  801a85:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801a88:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801a8d:	48 89 de             	mov    %rbx,%rsi
+  801a90:	bf 00 00 00 00       	mov    $0x0,%edi
+  801a95:	48 b8 aa 13 80 00 00 	movabs $0x8013aa,%rax
+  801a9c:	00 00 00 
+  801a9f:	ff d0                	call   *%rax
+    return res;
+  801aa1:	eb a3                	jmp    801a46 <fd_close+0x4d>
+
+0000000000801aa3 <close>:
+
+int
+close(int fdnum) {
+  801aa3:	55                   	push   %rbp
+  801aa4:	48 89 e5             	mov    %rsp,%rbp
+  801aa7:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  801aab:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801aaf:	48 b8 3e 19 80 00 00 	movabs $0x80193e,%rax
+  801ab6:	00 00 00 
+  801ab9:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801abb:	85 c0                	test   %eax,%eax
+  801abd:	78 15                	js     801ad4 <close+0x31>
+
+    return fd_close(fd, 1);
+  801abf:	be 01 00 00 00       	mov    $0x1,%esi
+  801ac4:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801ac8:	48 b8 f9 19 80 00 00 	movabs $0x8019f9,%rax
+  801acf:	00 00 00 
+  801ad2:	ff d0                	call   *%rax
+}
+  801ad4:	c9                   	leave
+  801ad5:	c3                   	ret
+
+0000000000801ad6 <close_all>:
+
+void
+close_all(void) {
+  801ad6:	55                   	push   %rbp
+  801ad7:	48 89 e5             	mov    %rsp,%rbp
+  801ada:	41 54                	push   %r12
+  801adc:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  801add:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801ae2:	49 bc a3 1a 80 00 00 	movabs $0x801aa3,%r12
+  801ae9:	00 00 00 
+  801aec:	89 df                	mov    %ebx,%edi
+  801aee:	41 ff d4             	call   *%r12
+  801af1:	83 c3 01             	add    $0x1,%ebx
+  801af4:	83 fb 20             	cmp    $0x20,%ebx
+  801af7:	75 f3                	jne    801aec <close_all+0x16>
+}
+  801af9:	5b                   	pop    %rbx
+  801afa:	41 5c                	pop    %r12
+  801afc:	5d                   	pop    %rbp
+  801afd:	c3                   	ret
+
+0000000000801afe <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  801afe:	55                   	push   %rbp
+  801aff:	48 89 e5             	mov    %rsp,%rbp
+  801b02:	41 57                	push   %r15
+  801b04:	41 56                	push   %r14
+  801b06:	41 55                	push   %r13
+  801b08:	41 54                	push   %r12
+  801b0a:	53                   	push   %rbx
+  801b0b:	48 83 ec 18          	sub    $0x18,%rsp
+  801b0f:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  801b12:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801b16:	48 b8 3e 19 80 00 00 	movabs $0x80193e,%rax
+  801b1d:	00 00 00 
+  801b20:	ff d0                	call   *%rax
+  801b22:	89 c3                	mov    %eax,%ebx
+  801b24:	85 c0                	test   %eax,%eax
+  801b26:	0f 88 b8 00 00 00    	js     801be4 <dup+0xe6>
+    close(newfdnum);
+  801b2c:	44 89 e7             	mov    %r12d,%edi
+  801b2f:	48 b8 a3 1a 80 00 00 	movabs $0x801aa3,%rax
+  801b36:	00 00 00 
+  801b39:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  801b3b:	4d 63 ec             	movslq %r12d,%r13
+  801b3e:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  801b45:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  801b49:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  801b4d:	4c 89 ff             	mov    %r15,%rdi
+  801b50:	49 be 8f 18 80 00 00 	movabs $0x80188f,%r14
+  801b57:	00 00 00 
+  801b5a:	41 ff d6             	call   *%r14
+  801b5d:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  801b60:	4c 89 ef             	mov    %r13,%rdi
+  801b63:	41 ff d6             	call   *%r14
+  801b66:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  801b69:	48 89 df             	mov    %rbx,%rdi
+  801b6c:	48 b8 6d 2a 80 00 00 	movabs $0x802a6d,%rax
+  801b73:	00 00 00 
+  801b76:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  801b78:	a8 04                	test   $0x4,%al
+  801b7a:	74 2b                	je     801ba7 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  801b7c:	41 89 c1             	mov    %eax,%r9d
+  801b7f:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801b85:	4c 89 f1             	mov    %r14,%rcx
+  801b88:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b8d:	48 89 de             	mov    %rbx,%rsi
+  801b90:	bf 00 00 00 00       	mov    $0x0,%edi
+  801b95:	48 b8 45 13 80 00 00 	movabs $0x801345,%rax
+  801b9c:	00 00 00 
+  801b9f:	ff d0                	call   *%rax
+  801ba1:	89 c3                	mov    %eax,%ebx
+  801ba3:	85 c0                	test   %eax,%eax
+  801ba5:	78 4e                	js     801bf5 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  801ba7:	4c 89 ff             	mov    %r15,%rdi
+  801baa:	48 b8 6d 2a 80 00 00 	movabs $0x802a6d,%rax
+  801bb1:	00 00 00 
+  801bb4:	ff d0                	call   *%rax
+  801bb6:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801bb9:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801bbf:	4c 89 e9             	mov    %r13,%rcx
+  801bc2:	ba 00 00 00 00       	mov    $0x0,%edx
+  801bc7:	4c 89 fe             	mov    %r15,%rsi
+  801bca:	bf 00 00 00 00       	mov    $0x0,%edi
+  801bcf:	48 b8 45 13 80 00 00 	movabs $0x801345,%rax
+  801bd6:	00 00 00 
+  801bd9:	ff d0                	call   *%rax
+  801bdb:	89 c3                	mov    %eax,%ebx
+  801bdd:	85 c0                	test   %eax,%eax
+  801bdf:	78 14                	js     801bf5 <dup+0xf7>
+
+    return newfdnum;
+  801be1:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  801be4:	89 d8                	mov    %ebx,%eax
+  801be6:	48 83 c4 18          	add    $0x18,%rsp
+  801bea:	5b                   	pop    %rbx
+  801beb:	41 5c                	pop    %r12
+  801bed:	41 5d                	pop    %r13
+  801bef:	41 5e                	pop    %r14
+  801bf1:	41 5f                	pop    %r15
+  801bf3:	5d                   	pop    %rbp
+  801bf4:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  801bf5:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801bfa:	4c 89 ee             	mov    %r13,%rsi
+  801bfd:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c02:	49 bc aa 13 80 00 00 	movabs $0x8013aa,%r12
+  801c09:	00 00 00 
+  801c0c:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  801c0f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801c14:	4c 89 f6             	mov    %r14,%rsi
+  801c17:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c1c:	41 ff d4             	call   *%r12
+    return res;
+  801c1f:	eb c3                	jmp    801be4 <dup+0xe6>
+
+0000000000801c21 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  801c21:	55                   	push   %rbp
+  801c22:	48 89 e5             	mov    %rsp,%rbp
+  801c25:	41 56                	push   %r14
+  801c27:	41 55                	push   %r13
+  801c29:	41 54                	push   %r12
+  801c2b:	53                   	push   %rbx
+  801c2c:	48 83 ec 10          	sub    $0x10,%rsp
+  801c30:	89 fb                	mov    %edi,%ebx
+  801c32:	49 89 f4             	mov    %rsi,%r12
+  801c35:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801c38:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801c3c:	48 b8 3e 19 80 00 00 	movabs $0x80193e,%rax
+  801c43:	00 00 00 
+  801c46:	ff d0                	call   *%rax
+  801c48:	85 c0                	test   %eax,%eax
+  801c4a:	78 4c                	js     801c98 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801c4c:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801c50:	41 8b 3e             	mov    (%r14),%edi
+  801c53:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801c57:	48 b8 89 19 80 00 00 	movabs $0x801989,%rax
+  801c5e:	00 00 00 
+  801c61:	ff d0                	call   *%rax
+  801c63:	85 c0                	test   %eax,%eax
+  801c65:	78 35                	js     801c9c <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801c67:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801c6b:	83 e0 03             	and    $0x3,%eax
+  801c6e:	83 f8 01             	cmp    $0x1,%eax
+  801c71:	74 2d                	je     801ca0 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801c73:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801c77:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801c7b:	48 85 c0             	test   %rax,%rax
+  801c7e:	74 56                	je     801cd6 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  801c80:	4c 89 ea             	mov    %r13,%rdx
+  801c83:	4c 89 e6             	mov    %r12,%rsi
+  801c86:	4c 89 f7             	mov    %r14,%rdi
+  801c89:	ff d0                	call   *%rax
+}
+  801c8b:	48 83 c4 10          	add    $0x10,%rsp
+  801c8f:	5b                   	pop    %rbx
+  801c90:	41 5c                	pop    %r12
+  801c92:	41 5d                	pop    %r13
+  801c94:	41 5e                	pop    %r14
+  801c96:	5d                   	pop    %rbp
+  801c97:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801c98:	48 98                	cltq
+  801c9a:	eb ef                	jmp    801c8b <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801c9c:	48 98                	cltq
+  801c9e:	eb eb                	jmp    801c8b <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801ca0:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801ca7:	00 00 00 
+  801caa:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+  801cb0:	89 da                	mov    %ebx,%edx
+  801cb2:	48 bf 19 37 80 00 00 	movabs $0x803719,%rdi
+  801cb9:	00 00 00 
+  801cbc:	b8 00 00 00 00       	mov    $0x0,%eax
+  801cc1:	48 b9 09 04 80 00 00 	movabs $0x800409,%rcx
+  801cc8:	00 00 00 
+  801ccb:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801ccd:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801cd4:	eb b5                	jmp    801c8b <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801cd6:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801cdd:	eb ac                	jmp    801c8b <read+0x6a>
+
+0000000000801cdf <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801cdf:	55                   	push   %rbp
+  801ce0:	48 89 e5             	mov    %rsp,%rbp
+  801ce3:	41 57                	push   %r15
+  801ce5:	41 56                	push   %r14
+  801ce7:	41 55                	push   %r13
+  801ce9:	41 54                	push   %r12
+  801ceb:	53                   	push   %rbx
+  801cec:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  801cf0:	48 85 d2             	test   %rdx,%rdx
+  801cf3:	74 54                	je     801d49 <readn+0x6a>
+  801cf5:	41 89 fd             	mov    %edi,%r13d
+  801cf8:	49 89 f6             	mov    %rsi,%r14
+  801cfb:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  801cfe:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  801d03:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  801d08:	49 bf 21 1c 80 00 00 	movabs $0x801c21,%r15
+  801d0f:	00 00 00 
+  801d12:	4c 89 e2             	mov    %r12,%rdx
+  801d15:	48 29 f2             	sub    %rsi,%rdx
+  801d18:	4c 01 f6             	add    %r14,%rsi
+  801d1b:	44 89 ef             	mov    %r13d,%edi
+  801d1e:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  801d21:	85 c0                	test   %eax,%eax
+  801d23:	78 20                	js     801d45 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  801d25:	01 c3                	add    %eax,%ebx
+  801d27:	85 c0                	test   %eax,%eax
+  801d29:	74 08                	je     801d33 <readn+0x54>
+  801d2b:	48 63 f3             	movslq %ebx,%rsi
+  801d2e:	4c 39 e6             	cmp    %r12,%rsi
+  801d31:	72 df                	jb     801d12 <readn+0x33>
+    }
+    return res;
+  801d33:	48 63 c3             	movslq %ebx,%rax
+}
+  801d36:	48 83 c4 08          	add    $0x8,%rsp
+  801d3a:	5b                   	pop    %rbx
+  801d3b:	41 5c                	pop    %r12
+  801d3d:	41 5d                	pop    %r13
+  801d3f:	41 5e                	pop    %r14
+  801d41:	41 5f                	pop    %r15
+  801d43:	5d                   	pop    %rbp
+  801d44:	c3                   	ret
+        if (inc < 0) return inc;
+  801d45:	48 98                	cltq
+  801d47:	eb ed                	jmp    801d36 <readn+0x57>
+    int inc = 1, res = 0;
+  801d49:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801d4e:	eb e3                	jmp    801d33 <readn+0x54>
+
+0000000000801d50 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  801d50:	55                   	push   %rbp
+  801d51:	48 89 e5             	mov    %rsp,%rbp
+  801d54:	41 56                	push   %r14
+  801d56:	41 55                	push   %r13
+  801d58:	41 54                	push   %r12
+  801d5a:	53                   	push   %rbx
+  801d5b:	48 83 ec 10          	sub    $0x10,%rsp
+  801d5f:	89 fb                	mov    %edi,%ebx
+  801d61:	49 89 f4             	mov    %rsi,%r12
+  801d64:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801d67:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801d6b:	48 b8 3e 19 80 00 00 	movabs $0x80193e,%rax
+  801d72:	00 00 00 
+  801d75:	ff d0                	call   *%rax
+  801d77:	85 c0                	test   %eax,%eax
+  801d79:	78 47                	js     801dc2 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801d7b:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801d7f:	41 8b 3e             	mov    (%r14),%edi
+  801d82:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801d86:	48 b8 89 19 80 00 00 	movabs $0x801989,%rax
+  801d8d:	00 00 00 
+  801d90:	ff d0                	call   *%rax
+  801d92:	85 c0                	test   %eax,%eax
+  801d94:	78 30                	js     801dc6 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801d96:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  801d9b:	74 2d                	je     801dca <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801d9d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801da1:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801da5:	48 85 c0             	test   %rax,%rax
+  801da8:	74 56                	je     801e00 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  801daa:	4c 89 ea             	mov    %r13,%rdx
+  801dad:	4c 89 e6             	mov    %r12,%rsi
+  801db0:	4c 89 f7             	mov    %r14,%rdi
+  801db3:	ff d0                	call   *%rax
+}
+  801db5:	48 83 c4 10          	add    $0x10,%rsp
+  801db9:	5b                   	pop    %rbx
+  801dba:	41 5c                	pop    %r12
+  801dbc:	41 5d                	pop    %r13
+  801dbe:	41 5e                	pop    %r14
+  801dc0:	5d                   	pop    %rbp
+  801dc1:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801dc2:	48 98                	cltq
+  801dc4:	eb ef                	jmp    801db5 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801dc6:	48 98                	cltq
+  801dc8:	eb eb                	jmp    801db5 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801dca:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801dd1:	00 00 00 
+  801dd4:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+  801dda:	89 da                	mov    %ebx,%edx
+  801ddc:	48 bf 35 37 80 00 00 	movabs $0x803735,%rdi
+  801de3:	00 00 00 
+  801de6:	b8 00 00 00 00       	mov    $0x0,%eax
+  801deb:	48 b9 09 04 80 00 00 	movabs $0x800409,%rcx
+  801df2:	00 00 00 
+  801df5:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801df7:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801dfe:	eb b5                	jmp    801db5 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801e00:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801e07:	eb ac                	jmp    801db5 <write+0x65>
+
+0000000000801e09 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  801e09:	55                   	push   %rbp
+  801e0a:	48 89 e5             	mov    %rsp,%rbp
+  801e0d:	53                   	push   %rbx
+  801e0e:	48 83 ec 18          	sub    $0x18,%rsp
+  801e12:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801e14:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801e18:	48 b8 3e 19 80 00 00 	movabs $0x80193e,%rax
+  801e1f:	00 00 00 
+  801e22:	ff d0                	call   *%rax
+  801e24:	85 c0                	test   %eax,%eax
+  801e26:	78 0c                	js     801e34 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  801e28:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801e2c:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  801e2f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801e34:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801e38:	c9                   	leave
+  801e39:	c3                   	ret
+
+0000000000801e3a <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  801e3a:	55                   	push   %rbp
+  801e3b:	48 89 e5             	mov    %rsp,%rbp
+  801e3e:	41 55                	push   %r13
+  801e40:	41 54                	push   %r12
+  801e42:	53                   	push   %rbx
+  801e43:	48 83 ec 18          	sub    $0x18,%rsp
+  801e47:	89 fb                	mov    %edi,%ebx
+  801e49:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801e4c:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801e50:	48 b8 3e 19 80 00 00 	movabs $0x80193e,%rax
+  801e57:	00 00 00 
+  801e5a:	ff d0                	call   *%rax
+  801e5c:	85 c0                	test   %eax,%eax
+  801e5e:	78 38                	js     801e98 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801e60:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  801e64:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  801e68:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801e6c:	48 b8 89 19 80 00 00 	movabs $0x801989,%rax
+  801e73:	00 00 00 
+  801e76:	ff d0                	call   *%rax
+  801e78:	85 c0                	test   %eax,%eax
+  801e7a:	78 1c                	js     801e98 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801e7c:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  801e81:	74 20                	je     801ea3 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801e83:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801e87:	48 8b 40 30          	mov    0x30(%rax),%rax
+  801e8b:	48 85 c0             	test   %rax,%rax
+  801e8e:	74 47                	je     801ed7 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  801e90:	44 89 e6             	mov    %r12d,%esi
+  801e93:	4c 89 ef             	mov    %r13,%rdi
+  801e96:	ff d0                	call   *%rax
+}
+  801e98:	48 83 c4 18          	add    $0x18,%rsp
+  801e9c:	5b                   	pop    %rbx
+  801e9d:	41 5c                	pop    %r12
+  801e9f:	41 5d                	pop    %r13
+  801ea1:	5d                   	pop    %rbp
+  801ea2:	c3                   	ret
+                thisenv->env_id, fdnum);
+  801ea3:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801eaa:	00 00 00 
+  801ead:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801eb3:	89 da                	mov    %ebx,%edx
+  801eb5:	48 bf f8 36 80 00 00 	movabs $0x8036f8,%rdi
+  801ebc:	00 00 00 
+  801ebf:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ec4:	48 b9 09 04 80 00 00 	movabs $0x800409,%rcx
+  801ecb:	00 00 00 
+  801ece:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801ed0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801ed5:	eb c1                	jmp    801e98 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801ed7:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801edc:	eb ba                	jmp    801e98 <ftruncate+0x5e>
+
+0000000000801ede <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  801ede:	55                   	push   %rbp
+  801edf:	48 89 e5             	mov    %rsp,%rbp
+  801ee2:	41 54                	push   %r12
+  801ee4:	53                   	push   %rbx
+  801ee5:	48 83 ec 10          	sub    $0x10,%rsp
+  801ee9:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801eec:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801ef0:	48 b8 3e 19 80 00 00 	movabs $0x80193e,%rax
+  801ef7:	00 00 00 
+  801efa:	ff d0                	call   *%rax
+  801efc:	85 c0                	test   %eax,%eax
+  801efe:	78 4e                	js     801f4e <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801f00:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801f04:	41 8b 3c 24          	mov    (%r12),%edi
+  801f08:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801f0c:	48 b8 89 19 80 00 00 	movabs $0x801989,%rax
+  801f13:	00 00 00 
+  801f16:	ff d0                	call   *%rax
+  801f18:	85 c0                	test   %eax,%eax
+  801f1a:	78 32                	js     801f4e <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801f1c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801f20:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  801f25:	74 30                	je     801f57 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  801f27:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  801f2a:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  801f31:	00 00 00 
+    stat->st_isdir = 0;
+  801f34:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  801f3b:	00 00 00 
+    stat->st_dev = dev;
+  801f3e:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  801f45:	48 89 de             	mov    %rbx,%rsi
+  801f48:	4c 89 e7             	mov    %r12,%rdi
+  801f4b:	ff 50 28             	call   *0x28(%rax)
+}
+  801f4e:	48 83 c4 10          	add    $0x10,%rsp
+  801f52:	5b                   	pop    %rbx
+  801f53:	41 5c                	pop    %r12
+  801f55:	5d                   	pop    %rbp
+  801f56:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801f57:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801f5c:	eb f0                	jmp    801f4e <fstat+0x70>
+
+0000000000801f5e <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  801f5e:	55                   	push   %rbp
+  801f5f:	48 89 e5             	mov    %rsp,%rbp
+  801f62:	41 54                	push   %r12
+  801f64:	53                   	push   %rbx
+  801f65:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  801f68:	be 00 00 00 00       	mov    $0x0,%esi
+  801f6d:	48 b8 41 23 80 00 00 	movabs $0x802341,%rax
+  801f74:	00 00 00 
+  801f77:	ff d0                	call   *%rax
+  801f79:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  801f7b:	85 c0                	test   %eax,%eax
+  801f7d:	78 25                	js     801fa4 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  801f7f:	4c 89 e6             	mov    %r12,%rsi
+  801f82:	89 c7                	mov    %eax,%edi
+  801f84:	48 b8 de 1e 80 00 00 	movabs $0x801ede,%rax
+  801f8b:	00 00 00 
+  801f8e:	ff d0                	call   *%rax
+  801f90:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  801f93:	89 df                	mov    %ebx,%edi
+  801f95:	48 b8 a3 1a 80 00 00 	movabs $0x801aa3,%rax
+  801f9c:	00 00 00 
+  801f9f:	ff d0                	call   *%rax
+
+    return res;
+  801fa1:	44 89 e3             	mov    %r12d,%ebx
+}
+  801fa4:	89 d8                	mov    %ebx,%eax
+  801fa6:	5b                   	pop    %rbx
+  801fa7:	41 5c                	pop    %r12
+  801fa9:	5d                   	pop    %rbp
+  801faa:	c3                   	ret
+
+0000000000801fab <fsipc>:
+ * response may be written back to fsipcbuf.
+ * type: request code, passed as the simple integer IPC value.
+ * dstva: virtual address at which to receive reply page, 0 if none.
+ * Returns result from the file server. */
+static int
+fsipc(unsigned type, void *dstva) {
+  801fab:	55                   	push   %rbp
+  801fac:	48 89 e5             	mov    %rsp,%rbp
+  801faf:	41 54                	push   %r12
+  801fb1:	53                   	push   %rbx
+  801fb2:	48 83 ec 10          	sub    $0x10,%rsp
+  801fb6:	41 89 fc             	mov    %edi,%r12d
+  801fb9:	48 89 f3             	mov    %rsi,%rbx
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  801fbc:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  801fc3:	00 00 00 
+  801fc6:	83 38 00             	cmpl   $0x0,(%rax)
+  801fc9:	74 5e                	je     802029 <fsipc+0x7e>
+    if (debug) {
+        cprintf("[%08x] fsipc %d %08x\n",
+                thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+    }
+
+    ipc_send(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW);
+  801fcb:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  801fd1:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  801fd6:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  801fdd:	00 00 00 
+  801fe0:	44 89 e6             	mov    %r12d,%esi
+  801fe3:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  801fea:	00 00 00 
+  801fed:	8b 38                	mov    (%rax),%edi
+  801fef:	48 b8 61 2f 80 00 00 	movabs $0x802f61,%rax
+  801ff6:	00 00 00 
+  801ff9:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  801ffb:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  802002:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  802003:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802008:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  80200c:	48 89 de             	mov    %rbx,%rsi
+  80200f:	bf 00 00 00 00       	mov    $0x0,%edi
+  802014:	48 b8 8c 2e 80 00 00 	movabs $0x802e8c,%rax
+  80201b:	00 00 00 
+  80201e:	ff d0                	call   *%rax
+}
+  802020:	48 83 c4 10          	add    $0x10,%rsp
+  802024:	5b                   	pop    %rbx
+  802025:	41 5c                	pop    %r12
+  802027:	5d                   	pop    %rbp
+  802028:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802029:	bf 03 00 00 00       	mov    $0x3,%edi
+  80202e:	48 b8 04 30 80 00 00 	movabs $0x803004,%rax
+  802035:	00 00 00 
+  802038:	ff d0                	call   *%rax
+  80203a:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  802041:	00 00 
+  802043:	eb 86                	jmp    801fcb <fsipc+0x20>
+
+0000000000802045 <devfile_trunc>:
+    return 0;
+}
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  802045:	55                   	push   %rbp
+  802046:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802049:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  802050:	00 00 00 
+  802053:	8b 57 0c             	mov    0xc(%rdi),%edx
+  802056:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  802058:	89 70 04             	mov    %esi,0x4(%rax)
+
+    return fsipc(FSREQ_SET_SIZE, NULL);
+  80205b:	be 00 00 00 00       	mov    $0x0,%esi
+  802060:	bf 02 00 00 00       	mov    $0x2,%edi
+  802065:	48 b8 ab 1f 80 00 00 	movabs $0x801fab,%rax
+  80206c:	00 00 00 
+  80206f:	ff d0                	call   *%rax
+}
+  802071:	5d                   	pop    %rbp
+  802072:	c3                   	ret
+
+0000000000802073 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  802073:	55                   	push   %rbp
+  802074:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  802077:	8b 47 0c             	mov    0xc(%rdi),%eax
+  80207a:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  802081:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  802083:	be 00 00 00 00       	mov    $0x0,%esi
+  802088:	bf 06 00 00 00       	mov    $0x6,%edi
+  80208d:	48 b8 ab 1f 80 00 00 	movabs $0x801fab,%rax
+  802094:	00 00 00 
+  802097:	ff d0                	call   *%rax
+}
+  802099:	5d                   	pop    %rbp
+  80209a:	c3                   	ret
+
+000000000080209b <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  80209b:	55                   	push   %rbp
+  80209c:	48 89 e5             	mov    %rsp,%rbp
+  80209f:	41 54                	push   %r12
+  8020a1:	53                   	push   %rbx
+  8020a2:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8020a5:	8b 47 0c             	mov    0xc(%rdi),%eax
+  8020a8:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  8020af:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  8020b1:	be 00 00 00 00       	mov    $0x0,%esi
+  8020b6:	bf 05 00 00 00       	mov    $0x5,%edi
+  8020bb:	48 b8 ab 1f 80 00 00 	movabs $0x801fab,%rax
+  8020c2:	00 00 00 
+  8020c5:	ff d0                	call   *%rax
+    if (res < 0) {
+  8020c7:	85 c0                	test   %eax,%eax
+  8020c9:	78 3d                	js     802108 <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8020cb:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  8020d2:	00 00 00 
+  8020d5:	4c 89 e6             	mov    %r12,%rsi
+  8020d8:	48 89 df             	mov    %rbx,%rdi
+  8020db:	48 b8 2e 0d 80 00 00 	movabs $0x800d2e,%rax
+  8020e2:	00 00 00 
+  8020e5:	ff d0                	call   *%rax
+    st->st_size  = fsipcbuf.statRet.ret_size;
+  8020e7:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  8020ee:	00 
+  8020ef:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8020f5:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  8020fc:	00 
+  8020fd:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  802103:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802108:	5b                   	pop    %rbx
+  802109:	41 5c                	pop    %r12
+  80210b:	5d                   	pop    %rbp
+  80210c:	c3                   	ret
+
+000000000080210d <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  80210d:	55                   	push   %rbp
+  80210e:	48 89 e5             	mov    %rsp,%rbp
+  802111:	41 57                	push   %r15
+  802113:	41 56                	push   %r14
+  802115:	41 55                	push   %r13
+  802117:	41 54                	push   %r12
+  802119:	53                   	push   %rbx
+  80211a:	48 83 ec 18          	sub    $0x18,%rsp
+  80211e:	49 89 fe             	mov    %rdi,%r14
+  802121:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+  802125:	48 89 d3             	mov    %rdx,%rbx
+    while (n > sizeof(fsipcbuf.write.req_buf))
+  802128:	48 81 fa f0 0f 00 00 	cmp    $0xff0,%rdx
+  80212f:	0f 86 e4 00 00 00    	jbe    802219 <devfile_write+0x10c>
+  802135:	49 89 f4             	mov    %rsi,%r12
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802138:	49 bd 00 60 80 00 00 	movabs $0x806000,%r13
+  80213f:	00 00 00 
+        memcpy(fsipcbuf.write.req_buf, buf, sizeof(fsipcbuf.write.req_buf));
+  802142:	49 bf 8f 0f 80 00 00 	movabs $0x800f8f,%r15
+  802149:	00 00 00 
+  80214c:	eb 03                	jmp    802151 <devfile_write+0x44>
+        buf += sizeof(fsipcbuf.write.req_buf);
+  80214e:	49 89 f4             	mov    %rsi,%r12
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802151:	41 8b 46 0c          	mov    0xc(%r14),%eax
+  802155:	41 89 45 00          	mov    %eax,0x0(%r13)
+        fsipcbuf.write.req_n      = sizeof(fsipcbuf.write.req_buf);
+  802159:	49 c7 45 08 f0 0f 00 	movq   $0xff0,0x8(%r13)
+  802160:	00 
+        memcpy(fsipcbuf.write.req_buf, buf, sizeof(fsipcbuf.write.req_buf));
+  802161:	ba f0 0f 00 00       	mov    $0xff0,%edx
+  802166:	4c 89 e6             	mov    %r12,%rsi
+  802169:	48 bf 10 60 80 00 00 	movabs $0x806010,%rdi
+  802170:	00 00 00 
+  802173:	41 ff d7             	call   *%r15
+        ssize_t res = fsipc(FSREQ_WRITE, NULL);
+  802176:	be 00 00 00 00       	mov    $0x0,%esi
+  80217b:	bf 04 00 00 00       	mov    $0x4,%edi
+  802180:	48 b8 ab 1f 80 00 00 	movabs $0x801fab,%rax
+  802187:	00 00 00 
+  80218a:	ff d0                	call   *%rax
+  80218c:	48 63 d0             	movslq %eax,%rdx
+        if (res < 0 || res < sizeof(fsipcbuf.write.req_buf))
+  80218f:	3d ef 0f 00 00       	cmp    $0xfef,%eax
+  802194:	7e 71                	jle    802207 <devfile_write+0xfa>
+        buf += sizeof(fsipcbuf.write.req_buf);
+  802196:	49 8d b4 24 f0 0f 00 	lea    0xff0(%r12),%rsi
+  80219d:	00 
+        n -= sizeof(fsipcbuf.write.req_buf);
+  80219e:	48 81 eb f0 0f 00 00 	sub    $0xff0,%rbx
+    while (n > sizeof(fsipcbuf.write.req_buf))
+  8021a5:	48 81 fb f0 0f 00 00 	cmp    $0xff0,%rbx
+  8021ac:	77 a0                	ja     80214e <devfile_write+0x41>
+        written += sizeof(fsipcbuf.write.req_buf);
+  8021ae:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8021b2:	49 29 c4             	sub    %rax,%r12
+  8021b5:	4d 8d a4 24 f0 0f 00 	lea    0xff0(%r12),%r12
+  8021bc:	00 
+    fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8021bd:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  8021c4:	00 00 00 
+  8021c7:	41 8b 56 0c          	mov    0xc(%r14),%edx
+  8021cb:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.write.req_n      = n;
+  8021cd:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    memcpy(fsipcbuf.write.req_buf, buf, n);
+  8021d1:	48 89 da             	mov    %rbx,%rdx
+  8021d4:	48 8d 78 10          	lea    0x10(%rax),%rdi
+  8021d8:	48 b8 8f 0f 80 00 00 	movabs $0x800f8f,%rax
+  8021df:	00 00 00 
+  8021e2:	ff d0                	call   *%rax
+    ssize_t res = fsipc(FSREQ_WRITE, NULL);
+  8021e4:	be 00 00 00 00       	mov    $0x0,%esi
+  8021e9:	bf 04 00 00 00       	mov    $0x4,%edi
+  8021ee:	48 b8 ab 1f 80 00 00 	movabs $0x801fab,%rax
+  8021f5:	00 00 00 
+  8021f8:	ff d0                	call   *%rax
+  8021fa:	48 63 d0             	movslq %eax,%rdx
+    written += res;
+  8021fd:	49 01 d4             	add    %rdx,%r12
+  802200:	48 85 d2             	test   %rdx,%rdx
+  802203:	49 0f 49 d4          	cmovns %r12,%rdx
+}
+  802207:	48 89 d0             	mov    %rdx,%rax
+  80220a:	48 83 c4 18          	add    $0x18,%rsp
+  80220e:	5b                   	pop    %rbx
+  80220f:	41 5c                	pop    %r12
+  802211:	41 5d                	pop    %r13
+  802213:	41 5e                	pop    %r14
+  802215:	41 5f                	pop    %r15
+  802217:	5d                   	pop    %rbp
+  802218:	c3                   	ret
+    while (n > sizeof(fsipcbuf.write.req_buf))
+  802219:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+    ssize_t written = 0;
+  80221d:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802223:	eb 98                	jmp    8021bd <devfile_write+0xb0>
+
+0000000000802225 <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  802225:	55                   	push   %rbp
+  802226:	48 89 e5             	mov    %rsp,%rbp
+  802229:	41 57                	push   %r15
+  80222b:	41 56                	push   %r14
+  80222d:	41 55                	push   %r13
+  80222f:	41 54                	push   %r12
+  802231:	53                   	push   %rbx
+  802232:	48 83 ec 18          	sub    $0x18,%rsp
+  802236:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  80223a:	49 89 f6             	mov    %rsi,%r14
+  80223d:	49 89 d4             	mov    %rdx,%r12
+    while (n > sizeof(fsipcbuf.readRet.ret_buf))
+  802240:	48 81 fa 00 10 00 00 	cmp    $0x1000,%rdx
+  802247:	0f 86 ea 00 00 00    	jbe    802337 <devfile_read+0x112>
+    ssize_t readsz = 0;
+  80224d:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  802254:	00 
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802255:	49 bf 00 60 80 00 00 	movabs $0x806000,%r15
+  80225c:	00 00 00 
+  80225f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802263:	8b 40 0c             	mov    0xc(%rax),%eax
+  802266:	41 89 07             	mov    %eax,(%r15)
+        fsipcbuf.read.req_n = sizeof(fsipcbuf.readRet.ret_buf);
+  802269:	49 c7 47 08 00 10 00 	movq   $0x1000,0x8(%r15)
+  802270:	00 
+        ssize_t res = fsipc(FSREQ_READ, NULL);
+  802271:	be 00 00 00 00       	mov    $0x0,%esi
+  802276:	bf 03 00 00 00       	mov    $0x3,%edi
+  80227b:	48 b8 ab 1f 80 00 00 	movabs $0x801fab,%rax
+  802282:	00 00 00 
+  802285:	ff d0                	call   *%rax
+  802287:	4c 63 e8             	movslq %eax,%r13
+        if (res < 0)
+  80228a:	4d 85 ed             	test   %r13,%r13
+  80228d:	0f 88 92 00 00 00    	js     802325 <devfile_read+0x100>
+        memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  802293:	4c 89 ea             	mov    %r13,%rdx
+  802296:	4c 89 fe             	mov    %r15,%rsi
+  802299:	4c 89 f7             	mov    %r14,%rdi
+  80229c:	48 b8 8f 0f 80 00 00 	movabs $0x800f8f,%rax
+  8022a3:	00 00 00 
+  8022a6:	ff d0                	call   *%rax
+        if (res < sizeof(fsipcbuf.readRet.ret_buf))
+  8022a8:	49 81 fd ff 0f 00 00 	cmp    $0xfff,%r13
+  8022af:	76 6d                	jbe    80231e <devfile_read+0xf9>
+        readsz += res;
+  8022b1:	4c 01 6d c0          	add    %r13,-0x40(%rbp)
+        buf += res;
+  8022b5:	4d 01 ee             	add    %r13,%r14
+        n -= res;
+  8022b8:	4d 29 ec             	sub    %r13,%r12
+    while (n > sizeof(fsipcbuf.readRet.ret_buf))
+  8022bb:	49 81 fc 00 10 00 00 	cmp    $0x1000,%r12
+  8022c2:	77 9b                	ja     80225f <devfile_read+0x3a>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8022c4:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  8022cb:	00 00 00 
+  8022ce:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  8022d2:	8b 51 0c             	mov    0xc(%rcx),%edx
+  8022d5:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.read.req_n = n;
+  8022d7:	4c 89 60 08          	mov    %r12,0x8(%rax)
+    ssize_t res = fsipc(FSREQ_READ, NULL);
+  8022db:	be 00 00 00 00       	mov    $0x0,%esi
+  8022e0:	bf 03 00 00 00       	mov    $0x3,%edi
+  8022e5:	48 b8 ab 1f 80 00 00 	movabs $0x801fab,%rax
+  8022ec:	00 00 00 
+  8022ef:	ff d0                	call   *%rax
+  8022f1:	4c 63 e8             	movslq %eax,%r13
+    if (res < 0)
+  8022f4:	4d 85 ed             	test   %r13,%r13
+  8022f7:	78 2c                	js     802325 <devfile_read+0x100>
+    memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  8022f9:	4c 89 ea             	mov    %r13,%rdx
+  8022fc:	48 be 00 60 80 00 00 	movabs $0x806000,%rsi
+  802303:	00 00 00 
+  802306:	4c 89 f7             	mov    %r14,%rdi
+  802309:	48 b8 8f 0f 80 00 00 	movabs $0x800f8f,%rax
+  802310:	00 00 00 
+  802313:	ff d0                	call   *%rax
+    readsz += res;
+  802315:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802319:	49 01 c5             	add    %rax,%r13
+    return readsz;
+  80231c:	eb 07                	jmp    802325 <devfile_read+0x100>
+            return readsz + res;
+  80231e:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802322:	49 01 c5             	add    %rax,%r13
+}
+  802325:	4c 89 e8             	mov    %r13,%rax
+  802328:	48 83 c4 18          	add    $0x18,%rsp
+  80232c:	5b                   	pop    %rbx
+  80232d:	41 5c                	pop    %r12
+  80232f:	41 5d                	pop    %r13
+  802331:	41 5e                	pop    %r14
+  802333:	41 5f                	pop    %r15
+  802335:	5d                   	pop    %rbp
+  802336:	c3                   	ret
+    ssize_t readsz = 0;
+  802337:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  80233e:	00 
+  80233f:	eb 83                	jmp    8022c4 <devfile_read+0x9f>
+
+0000000000802341 <open>:
+open(const char *path, int mode) {
+  802341:	55                   	push   %rbp
+  802342:	48 89 e5             	mov    %rsp,%rbp
+  802345:	41 55                	push   %r13
+  802347:	41 54                	push   %r12
+  802349:	53                   	push   %rbx
+  80234a:	48 83 ec 18          	sub    $0x18,%rsp
+  80234e:	49 89 fc             	mov    %rdi,%r12
+  802351:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  802354:	48 b8 f0 0c 80 00 00 	movabs $0x800cf0,%rax
+  80235b:	00 00 00 
+  80235e:	ff d0                	call   *%rax
+  802360:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802366:	0f 87 8a 00 00 00    	ja     8023f6 <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  80236c:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802370:	48 b8 24 19 80 00 00 	movabs $0x801924,%rax
+  802377:	00 00 00 
+  80237a:	ff d0                	call   *%rax
+  80237c:	89 c3                	mov    %eax,%ebx
+  80237e:	85 c0                	test   %eax,%eax
+  802380:	78 50                	js     8023d2 <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  802382:	4c 89 e6             	mov    %r12,%rsi
+  802385:	48 bb 00 60 80 00 00 	movabs $0x806000,%rbx
+  80238c:	00 00 00 
+  80238f:	48 89 df             	mov    %rbx,%rdi
+  802392:	48 b8 2e 0d 80 00 00 	movabs $0x800d2e,%rax
+  802399:	00 00 00 
+  80239c:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  80239e:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  8023a5:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8023a9:	bf 01 00 00 00       	mov    $0x1,%edi
+  8023ae:	48 b8 ab 1f 80 00 00 	movabs $0x801fab,%rax
+  8023b5:	00 00 00 
+  8023b8:	ff d0                	call   *%rax
+  8023ba:	89 c3                	mov    %eax,%ebx
+  8023bc:	85 c0                	test   %eax,%eax
+  8023be:	78 1f                	js     8023df <open+0x9e>
+    return fd2num(fd);
+  8023c0:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8023c4:	48 b8 7d 18 80 00 00 	movabs $0x80187d,%rax
+  8023cb:	00 00 00 
+  8023ce:	ff d0                	call   *%rax
+  8023d0:	89 c3                	mov    %eax,%ebx
+}
+  8023d2:	89 d8                	mov    %ebx,%eax
+  8023d4:	48 83 c4 18          	add    $0x18,%rsp
+  8023d8:	5b                   	pop    %rbx
+  8023d9:	41 5c                	pop    %r12
+  8023db:	41 5d                	pop    %r13
+  8023dd:	5d                   	pop    %rbp
+  8023de:	c3                   	ret
+        fd_close(fd, 0);
+  8023df:	be 00 00 00 00       	mov    $0x0,%esi
+  8023e4:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8023e8:	48 b8 f9 19 80 00 00 	movabs $0x8019f9,%rax
+  8023ef:	00 00 00 
+  8023f2:	ff d0                	call   *%rax
+        return res;
+  8023f4:	eb dc                	jmp    8023d2 <open+0x91>
+        return -E_BAD_PATH;
+  8023f6:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  8023fb:	eb d5                	jmp    8023d2 <open+0x91>
+
+00000000008023fd <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  8023fd:	55                   	push   %rbp
+  8023fe:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc(FSREQ_SYNC, NULL);
+  802401:	be 00 00 00 00       	mov    $0x0,%esi
+  802406:	bf 08 00 00 00       	mov    $0x8,%edi
+  80240b:	48 b8 ab 1f 80 00 00 	movabs $0x801fab,%rax
+  802412:	00 00 00 
+  802415:	ff d0                	call   *%rax
+}
+  802417:	5d                   	pop    %rbp
+  802418:	c3                   	ret
+
+0000000000802419 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  802419:	55                   	push   %rbp
+  80241a:	48 89 e5             	mov    %rsp,%rbp
+  80241d:	41 54                	push   %r12
+  80241f:	53                   	push   %rbx
+  802420:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802423:	48 b8 8f 18 80 00 00 	movabs $0x80188f,%rax
+  80242a:	00 00 00 
+  80242d:	ff d0                	call   *%rax
+  80242f:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  802432:	48 be 80 37 80 00 00 	movabs $0x803780,%rsi
+  802439:	00 00 00 
+  80243c:	48 89 df             	mov    %rbx,%rdi
+  80243f:	48 b8 2e 0d 80 00 00 	movabs $0x800d2e,%rax
+  802446:	00 00 00 
+  802449:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  80244b:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  802450:	41 2b 04 24          	sub    (%r12),%eax
+  802454:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  80245a:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  802461:	00 00 00 
+    stat->st_dev = &devpipe;
+  802464:	48 b8 60 40 80 00 00 	movabs $0x804060,%rax
+  80246b:	00 00 00 
+  80246e:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  802475:	b8 00 00 00 00       	mov    $0x0,%eax
+  80247a:	5b                   	pop    %rbx
+  80247b:	41 5c                	pop    %r12
+  80247d:	5d                   	pop    %rbp
+  80247e:	c3                   	ret
+
+000000000080247f <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  80247f:	55                   	push   %rbp
+  802480:	48 89 e5             	mov    %rsp,%rbp
+  802483:	41 54                	push   %r12
+  802485:	53                   	push   %rbx
+  802486:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  802489:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80248e:	48 89 fe             	mov    %rdi,%rsi
+  802491:	bf 00 00 00 00       	mov    $0x0,%edi
+  802496:	49 bc aa 13 80 00 00 	movabs $0x8013aa,%r12
+  80249d:	00 00 00 
+  8024a0:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  8024a3:	48 89 df             	mov    %rbx,%rdi
+  8024a6:	48 b8 8f 18 80 00 00 	movabs $0x80188f,%rax
+  8024ad:	00 00 00 
+  8024b0:	ff d0                	call   *%rax
+  8024b2:	48 89 c6             	mov    %rax,%rsi
+  8024b5:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8024ba:	bf 00 00 00 00       	mov    $0x0,%edi
+  8024bf:	41 ff d4             	call   *%r12
+}
+  8024c2:	5b                   	pop    %rbx
+  8024c3:	41 5c                	pop    %r12
+  8024c5:	5d                   	pop    %rbp
+  8024c6:	c3                   	ret
+
+00000000008024c7 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8024c7:	55                   	push   %rbp
+  8024c8:	48 89 e5             	mov    %rsp,%rbp
+  8024cb:	41 57                	push   %r15
+  8024cd:	41 56                	push   %r14
+  8024cf:	41 55                	push   %r13
+  8024d1:	41 54                	push   %r12
+  8024d3:	53                   	push   %rbx
+  8024d4:	48 83 ec 18          	sub    $0x18,%rsp
+  8024d8:	49 89 fc             	mov    %rdi,%r12
+  8024db:	49 89 f5             	mov    %rsi,%r13
+  8024de:	49 89 d7             	mov    %rdx,%r15
+  8024e1:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8024e5:	48 b8 8f 18 80 00 00 	movabs $0x80188f,%rax
+  8024ec:	00 00 00 
+  8024ef:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  8024f1:	4d 85 ff             	test   %r15,%r15
+  8024f4:	0f 84 af 00 00 00    	je     8025a9 <devpipe_write+0xe2>
+  8024fa:	48 89 c3             	mov    %rax,%rbx
+  8024fd:	4c 89 f8             	mov    %r15,%rax
+  802500:	4d 89 ef             	mov    %r13,%r15
+  802503:	4c 01 e8             	add    %r13,%rax
+  802506:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80250a:	49 bd b2 12 80 00 00 	movabs $0x8012b2,%r13
+  802511:	00 00 00 
+            sys_yield();
+  802514:	49 be 4f 12 80 00 00 	movabs $0x80124f,%r14
+  80251b:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  80251e:	8b 73 04             	mov    0x4(%rbx),%esi
+  802521:	48 63 ce             	movslq %esi,%rcx
+  802524:	48 63 03             	movslq (%rbx),%rax
+  802527:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  80252d:	48 39 c1             	cmp    %rax,%rcx
+  802530:	72 2e                	jb     802560 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802532:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802537:	48 89 da             	mov    %rbx,%rdx
+  80253a:	be 00 10 00 00       	mov    $0x1000,%esi
+  80253f:	4c 89 e7             	mov    %r12,%rdi
+  802542:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  802545:	85 c0                	test   %eax,%eax
+  802547:	74 66                	je     8025af <devpipe_write+0xe8>
+            sys_yield();
+  802549:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  80254c:	8b 73 04             	mov    0x4(%rbx),%esi
+  80254f:	48 63 ce             	movslq %esi,%rcx
+  802552:	48 63 03             	movslq (%rbx),%rax
+  802555:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  80255b:	48 39 c1             	cmp    %rax,%rcx
+  80255e:	73 d2                	jae    802532 <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  802560:	41 0f b6 3f          	movzbl (%r15),%edi
+  802564:	48 89 ca             	mov    %rcx,%rdx
+  802567:	48 c1 ea 03          	shr    $0x3,%rdx
+  80256b:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  802572:	08 10 20 
+  802575:	48 f7 e2             	mul    %rdx
+  802578:	48 c1 ea 06          	shr    $0x6,%rdx
+  80257c:	48 89 d0             	mov    %rdx,%rax
+  80257f:	48 c1 e0 09          	shl    $0x9,%rax
+  802583:	48 29 d0             	sub    %rdx,%rax
+  802586:	48 c1 e0 03          	shl    $0x3,%rax
+  80258a:	48 29 c1             	sub    %rax,%rcx
+  80258d:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  802592:	83 c6 01             	add    $0x1,%esi
+  802595:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  802598:	49 83 c7 01          	add    $0x1,%r15
+  80259c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8025a0:	49 39 c7             	cmp    %rax,%r15
+  8025a3:	0f 85 75 ff ff ff    	jne    80251e <devpipe_write+0x57>
+    return n;
+  8025a9:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8025ad:	eb 05                	jmp    8025b4 <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  8025af:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8025b4:	48 83 c4 18          	add    $0x18,%rsp
+  8025b8:	5b                   	pop    %rbx
+  8025b9:	41 5c                	pop    %r12
+  8025bb:	41 5d                	pop    %r13
+  8025bd:	41 5e                	pop    %r14
+  8025bf:	41 5f                	pop    %r15
+  8025c1:	5d                   	pop    %rbp
+  8025c2:	c3                   	ret
+
+00000000008025c3 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  8025c3:	55                   	push   %rbp
+  8025c4:	48 89 e5             	mov    %rsp,%rbp
+  8025c7:	41 57                	push   %r15
+  8025c9:	41 56                	push   %r14
+  8025cb:	41 55                	push   %r13
+  8025cd:	41 54                	push   %r12
+  8025cf:	53                   	push   %rbx
+  8025d0:	48 83 ec 18          	sub    $0x18,%rsp
+  8025d4:	49 89 fc             	mov    %rdi,%r12
+  8025d7:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  8025db:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8025df:	48 b8 8f 18 80 00 00 	movabs $0x80188f,%rax
+  8025e6:	00 00 00 
+  8025e9:	ff d0                	call   *%rax
+  8025eb:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  8025ee:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8025f4:	49 bd b2 12 80 00 00 	movabs $0x8012b2,%r13
+  8025fb:	00 00 00 
+            sys_yield();
+  8025fe:	49 be 4f 12 80 00 00 	movabs $0x80124f,%r14
+  802605:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  802608:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  80260d:	74 7d                	je     80268c <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  80260f:	8b 03                	mov    (%rbx),%eax
+  802611:	3b 43 04             	cmp    0x4(%rbx),%eax
+  802614:	75 26                	jne    80263c <devpipe_read+0x79>
+            if (i > 0) return i;
+  802616:	4d 85 ff             	test   %r15,%r15
+  802619:	75 77                	jne    802692 <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80261b:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802620:	48 89 da             	mov    %rbx,%rdx
+  802623:	be 00 10 00 00       	mov    $0x1000,%esi
+  802628:	4c 89 e7             	mov    %r12,%rdi
+  80262b:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  80262e:	85 c0                	test   %eax,%eax
+  802630:	74 72                	je     8026a4 <devpipe_read+0xe1>
+            sys_yield();
+  802632:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  802635:	8b 03                	mov    (%rbx),%eax
+  802637:	3b 43 04             	cmp    0x4(%rbx),%eax
+  80263a:	74 df                	je     80261b <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  80263c:	48 63 c8             	movslq %eax,%rcx
+  80263f:	48 89 ca             	mov    %rcx,%rdx
+  802642:	48 c1 ea 03          	shr    $0x3,%rdx
+  802646:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  80264d:	08 10 20 
+  802650:	48 89 d0             	mov    %rdx,%rax
+  802653:	48 f7 e6             	mul    %rsi
+  802656:	48 c1 ea 06          	shr    $0x6,%rdx
+  80265a:	48 89 d0             	mov    %rdx,%rax
+  80265d:	48 c1 e0 09          	shl    $0x9,%rax
+  802661:	48 29 d0             	sub    %rdx,%rax
+  802664:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  80266b:	00 
+  80266c:	48 89 c8             	mov    %rcx,%rax
+  80266f:	48 29 d0             	sub    %rdx,%rax
+  802672:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  802677:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80267b:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  80267f:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  802682:	49 83 c7 01          	add    $0x1,%r15
+  802686:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  80268a:	75 83                	jne    80260f <devpipe_read+0x4c>
+    return n;
+  80268c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802690:	eb 03                	jmp    802695 <devpipe_read+0xd2>
+            if (i > 0) return i;
+  802692:	4c 89 f8             	mov    %r15,%rax
+}
+  802695:	48 83 c4 18          	add    $0x18,%rsp
+  802699:	5b                   	pop    %rbx
+  80269a:	41 5c                	pop    %r12
+  80269c:	41 5d                	pop    %r13
+  80269e:	41 5e                	pop    %r14
+  8026a0:	41 5f                	pop    %r15
+  8026a2:	5d                   	pop    %rbp
+  8026a3:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  8026a4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8026a9:	eb ea                	jmp    802695 <devpipe_read+0xd2>
+
+00000000008026ab <pipe>:
+pipe(int pfd[2]) {
+  8026ab:	55                   	push   %rbp
+  8026ac:	48 89 e5             	mov    %rsp,%rbp
+  8026af:	41 55                	push   %r13
+  8026b1:	41 54                	push   %r12
+  8026b3:	53                   	push   %rbx
+  8026b4:	48 81 ec b8 00 00 00 	sub    $0xb8,%rsp
+  8026bb:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8026be:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  8026c2:	48 b8 24 19 80 00 00 	movabs $0x801924,%rax
+  8026c9:	00 00 00 
+  8026cc:	ff d0                	call   *%rax
+  8026ce:	89 c3                	mov    %eax,%ebx
+  8026d0:	85 c0                	test   %eax,%eax
+  8026d2:	0f 88 51 01 00 00    	js     802829 <pipe+0x17e>
+        (res = fd_alloc_from(fd2num(fd0) + 1, &fd1)) < 0) goto err;
+  8026d8:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8026dc:	48 b8 7d 18 80 00 00 	movabs $0x80187d,%rax
+  8026e3:	00 00 00 
+  8026e6:	ff d0                	call   *%rax
+  8026e8:	8d 78 01             	lea    0x1(%rax),%edi
+  8026eb:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8026ef:	48 b8 ab 18 80 00 00 	movabs $0x8018ab,%rax
+  8026f6:	00 00 00 
+  8026f9:	ff d0                	call   *%rax
+  8026fb:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8026fd:	85 c0                	test   %eax,%eax
+  8026ff:	0f 88 24 01 00 00    	js     802829 <pipe+0x17e>
+    va = fd2data(fd0);
+  802705:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802709:	48 bb 8f 18 80 00 00 	movabs $0x80188f,%rbx
+  802710:	00 00 00 
+  802713:	ff d3                	call   *%rbx
+  802715:	49 89 c5             	mov    %rax,%r13
+    struct RegionOp ops[] = {
+  802718:	48 8d bd 30 ff ff ff 	lea    -0xd0(%rbp),%rdi
+  80271f:	b9 14 00 00 00       	mov    $0x14,%ecx
+  802724:	b8 00 00 00 00       	mov    $0x0,%eax
+  802729:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+  80272c:	c7 85 34 ff ff ff 46 	movl   $0x46,-0xcc(%rbp)
+  802733:	00 00 00 
+  802736:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80273a:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+  802741:	48 c7 85 50 ff ff ff 	movq   $0x1000,-0xb0(%rbp)
+  802748:	00 10 00 00 
+  80274c:	c7 85 5c ff ff ff 46 	movl   $0x46,-0xa4(%rbp)
+  802753:	00 00 00 
+            {.type = REGION_ALLOC, .dstva = (uintptr_t)fd1, .size = PAGE_SIZE, .perm = PROT_RW | PROT_SHARE},
+  802756:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+    struct RegionOp ops[] = {
+  80275a:	48 89 bd 70 ff ff ff 	mov    %rdi,-0x90(%rbp)
+  802761:	48 c7 85 78 ff ff ff 	movq   $0x1000,-0x88(%rbp)
+  802768:	00 10 00 00 
+  80276c:	c7 45 84 46 00 00 00 	movl   $0x46,-0x7c(%rbp)
+  802773:	4c 89 6d 98          	mov    %r13,-0x68(%rbp)
+  802777:	48 c7 45 a0 00 10 00 	movq   $0x1000,-0x60(%rbp)
+  80277e:	00 
+  80277f:	c7 45 a8 01 00 00 00 	movl   $0x1,-0x58(%rbp)
+  802786:	c7 45 ac 46 00 00 00 	movl   $0x46,-0x54(%rbp)
+  80278d:	4c 89 6d b8          	mov    %r13,-0x48(%rbp)
+            {.type = REGION_MAP, .srcva = (uintptr_t)va, .dstva = (uintptr_t)fd2data(fd1), .size = PAGE_SIZE, .perm = PROT_RW | PROT_SHARE},
+  802791:	ff d3                	call   *%rbx
+    struct RegionOp ops[] = {
+  802793:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802797:	48 c7 45 c8 00 10 00 	movq   $0x1000,-0x38(%rbp)
+  80279e:	00 
+    if ((res = sys_region_batch(ops, sizeof ops / sizeof *ops)) < 0) goto err1;
+  80279f:	be 04 00 00 00       	mov    $0x4,%esi
+  8027a4:	48 8d bd 30 ff ff ff 	lea    -0xd0(%rbp),%rdi
+  8027ab:	48 b8 11 14 80 00 00 	movabs $0x801411,%rax
+  8027b2:	00 00 00 
+  8027b5:	ff d0                	call   *%rax
+  8027b7:	89 c3                	mov    %eax,%ebx
+  8027b9:	85 c0                	test   %eax,%eax
+  8027bb:	0f 88 ad 00 00 00    	js     80286e <pipe+0x1c3>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8027c1:	be 00 10 00 00       	mov    $0x1000,%esi
+  8027c6:	4c 89 ef             	mov    %r13,%rdi
+  8027c9:	48 b8 80 12 80 00 00 	movabs $0x801280,%rax
+  8027d0:	00 00 00 
+  8027d3:	ff d0                	call   *%rax
+  8027d5:	83 f8 02             	cmp    $0x2,%eax
+  8027d8:	75 5f                	jne    802839 <pipe+0x18e>
+    fd0->fd_dev_id = devpipe.dev_id;
+  8027da:	a1 60 40 80 00 00 00 	movabs 0x804060,%eax
+  8027e1:	00 00 
+  8027e3:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8027e7:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  8027e9:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8027ed:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  8027f4:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8027f8:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  8027fa:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8027fe:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  802805:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802809:	48 bb 7d 18 80 00 00 	movabs $0x80187d,%rbx
+  802810:	00 00 00 
+  802813:	ff d3                	call   *%rbx
+  802815:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  802819:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  80281d:	ff d3                	call   *%rbx
+  80281f:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  802824:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  802829:	89 d8                	mov    %ebx,%eax
+  80282b:	48 81 c4 b8 00 00 00 	add    $0xb8,%rsp
+  802832:	5b                   	pop    %rbx
+  802833:	41 5c                	pop    %r12
+  802835:	41 5d                	pop    %r13
+  802837:	5d                   	pop    %rbp
+  802838:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  802839:	48 b9 b0 37 80 00 00 	movabs $0x8037b0,%rcx
+  802840:	00 00 00 
+  802843:	48 ba 87 37 80 00 00 	movabs $0x803787,%rdx
+  80284a:	00 00 00 
+  80284d:	be 33 00 00 00       	mov    $0x33,%esi
+  802852:	48 bf 9c 37 80 00 00 	movabs $0x80379c,%rdi
+  802859:	00 00 00 
+  80285c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802861:	49 b8 b9 02 80 00 00 	movabs $0x8002b9,%r8
+  802868:	00 00 00 
+  80286b:	41 ff d0             	call   *%r8
+        ops[i].type = REGION_UNMAP;
+  80286e:	c7 85 30 ff ff ff 02 	movl   $0x2,-0xd0(%rbp)
+  802875:	00 00 00 
+  802878:	c7 85 58 ff ff ff 02 	movl   $0x2,-0xa8(%rbp)
+  80287f:	00 00 00 
+  802882:	c7 45 80 02 00 00 00 	movl   $0x2,-0x80(%rbp)
+  802889:	c7 45 a8 02 00 00 00 	movl   $0x2,-0x58(%rbp)
+    sys_region_batch(ops, sizeof ops / sizeof *ops);
+  802890:	be 04 00 00 00       	mov    $0x4,%esi
+  802895:	48 8d bd 30 ff ff ff 	lea    -0xd0(%rbp),%rdi
+  80289c:	48 b8 11 14 80 00 00 	movabs $0x801411,%rax
+  8028a3:	00 00 00 
+  8028a6:	ff d0                	call   *%rax
+  8028a8:	e9 7c ff ff ff       	jmp    802829 <pipe+0x17e>
+
+00000000008028ad <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  8028ad:	55                   	push   %rbp
+  8028ae:	48 89 e5             	mov    %rsp,%rbp
+  8028b1:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8028b5:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8028b9:	48 b8 3e 19 80 00 00 	movabs $0x80193e,%rax
+  8028c0:	00 00 00 
+  8028c3:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8028c5:	85 c0                	test   %eax,%eax
+  8028c7:	78 35                	js     8028fe <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  8028c9:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8028cd:	48 b8 8f 18 80 00 00 	movabs $0x80188f,%rax
+  8028d4:	00 00 00 
+  8028d7:	ff d0                	call   *%rax
+  8028d9:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8028dc:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8028e1:	be 00 10 00 00       	mov    $0x1000,%esi
+  8028e6:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8028ea:	48 b8 b2 12 80 00 00 	movabs $0x8012b2,%rax
+  8028f1:	00 00 00 
+  8028f4:	ff d0                	call   *%rax
+  8028f6:	85 c0                	test   %eax,%eax
+  8028f8:	0f 94 c0             	sete   %al
+  8028fb:	0f b6 c0             	movzbl %al,%eax
+}
+  8028fe:	c9                   	leave
+  8028ff:	c3                   	ret
+
+0000000000802900 <wait>:
+#include <inc/lib.h>
+
+/* Waits until 'envid' exits. */
+void
+wait(envid_t envid) {
+  802900:	55                   	push   %rbp
+  802901:	48 89 e5             	mov    %rsp,%rbp
+  802904:	41 55                	push   %r13
+  802906:	41 54                	push   %r12
+  802908:	53                   	push   %rbx
+  802909:	48 83 ec 08          	sub    $0x8,%rsp
+    assert(envid != 0);
+  80290d:	85 ff                	test   %edi,%edi
+  80290f:	74 73                	je     802984 <wait+0x84>
+  802911:	41 89 fc             	mov    %edi,%r12d
+
+    const volatile struct Env *env = &envs[ENVX(envid)];
+  802914:	89 f8                	mov    %edi,%eax
+  802916:	25 ff 03 00 00       	and    $0x3ff,%eax
+
+    while (env->env_id == envid &&
+  80291b:	89 f9                	mov    %edi,%ecx
+  80291d:	81 e1 ff 03 00 00    	and    $0x3ff,%ecx
+  802923:	48 69 c9 d0 01 00 00 	imul   $0x1d0,%rcx,%rcx
+  80292a:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  802931:	00 00 00 
+  802934:	48 01 ca             	add    %rcx,%rdx
+  802937:	8b 92 e0 00 00 00    	mov    0xe0(%rdx),%edx
+  80293d:	39 d7                	cmp    %edx,%edi
+  80293f:	75 38                	jne    802979 <wait+0x79>
+           env->env_status != ENV_FREE) {
+  802941:	48 98                	cltq
+  802943:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+  80294a:	48 bb 00 00 c0 1f 80 	movabs $0x801fc00000,%rbx
+  802951:	00 00 00 
+  802954:	48 01 c3             	add    %rax,%rbx
+        sys_yield();
+  802957:	49 bd 4f 12 80 00 00 	movabs $0x80124f,%r13
+  80295e:	00 00 00 
+           env->env_status != ENV_FREE) {
+  802961:	8b 83 ec 00 00 00    	mov    0xec(%rbx),%eax
+    while (env->env_id == envid &&
+  802967:	85 c0                	test   %eax,%eax
+  802969:	74 0e                	je     802979 <wait+0x79>
+        sys_yield();
+  80296b:	41 ff d5             	call   *%r13
+    while (env->env_id == envid &&
+  80296e:	8b 83 e0 00 00 00    	mov    0xe0(%rbx),%eax
+  802974:	44 39 e0             	cmp    %r12d,%eax
+  802977:	74 e8                	je     802961 <wait+0x61>
+    }
+}
+  802979:	48 83 c4 08          	add    $0x8,%rsp
+  80297d:	5b                   	pop    %rbx
+  80297e:	41 5c                	pop    %r12
+  802980:	41 5d                	pop    %r13
+  802982:	5d                   	pop    %rbp
+  802983:	c3                   	ret
+    assert(envid != 0);
+  802984:	48 b9 d4 37 80 00 00 	movabs $0x8037d4,%rcx
+  80298b:	00 00 00 
+  80298e:	48 ba 87 37 80 00 00 	movabs $0x803787,%rdx
+  802995:	00 00 00 
+  802998:	be 06 00 00 00       	mov    $0x6,%esi
+  80299d:	48 bf df 37 80 00 00 	movabs $0x8037df,%rdi
+  8029a4:	00 00 00 
+  8029a7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029ac:	49 b8 b9 02 80 00 00 	movabs $0x8002b9,%r8
+  8029b3:	00 00 00 
+  8029b6:	41 ff d0             	call   *%r8
+
+00000000008029b9 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8029b9:	48 89 f8             	mov    %rdi,%rax
+  8029bc:	48 c1 e8 27          	shr    $0x27,%rax
+  8029c0:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  8029c7:	01 00 00 
+  8029ca:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8029ce:	f6 c2 01             	test   $0x1,%dl
+  8029d1:	74 6d                	je     802a40 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8029d3:	48 89 f8             	mov    %rdi,%rax
+  8029d6:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8029da:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8029e1:	01 00 00 
+  8029e4:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8029e8:	f6 c2 01             	test   $0x1,%dl
+  8029eb:	74 62                	je     802a4f <get_uvpt_entry+0x96>
+  8029ed:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8029f4:	01 00 00 
+  8029f7:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8029fb:	f6 c2 80             	test   $0x80,%dl
+  8029fe:	75 4f                	jne    802a4f <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  802a00:	48 89 f8             	mov    %rdi,%rax
+  802a03:	48 c1 e8 15          	shr    $0x15,%rax
+  802a07:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802a0e:	01 00 00 
+  802a11:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802a15:	f6 c2 01             	test   $0x1,%dl
+  802a18:	74 44                	je     802a5e <get_uvpt_entry+0xa5>
+  802a1a:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802a21:	01 00 00 
+  802a24:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802a28:	f6 c2 80             	test   $0x80,%dl
+  802a2b:	75 31                	jne    802a5e <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  802a2d:	48 c1 ef 0c          	shr    $0xc,%rdi
+  802a31:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802a38:	01 00 00 
+  802a3b:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  802a3f:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  802a40:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  802a47:	01 00 00 
+  802a4a:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802a4e:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  802a4f:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802a56:	01 00 00 
+  802a59:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802a5d:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  802a5e:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802a65:	01 00 00 
+  802a68:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802a6c:	c3                   	ret
+
+0000000000802a6d <get_prot>:
+
+int
+get_prot(void *va) {
+  802a6d:	55                   	push   %rbp
+  802a6e:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  802a71:	48 b8 b9 29 80 00 00 	movabs $0x8029b9,%rax
+  802a78:	00 00 00 
+  802a7b:	ff d0                	call   *%rax
+  802a7d:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  802a80:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  802a85:	89 c1                	mov    %eax,%ecx
+  802a87:	83 c9 04             	or     $0x4,%ecx
+  802a8a:	f6 c2 01             	test   $0x1,%dl
+  802a8d:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  802a90:	89 c1                	mov    %eax,%ecx
+  802a92:	83 c9 02             	or     $0x2,%ecx
+  802a95:	f6 c2 02             	test   $0x2,%dl
+  802a98:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  802a9b:	89 c1                	mov    %eax,%ecx
+  802a9d:	83 c9 01             	or     $0x1,%ecx
+  802aa0:	48 85 d2             	test   %rdx,%rdx
+  802aa3:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  802aa6:	89 c1                	mov    %eax,%ecx
+  802aa8:	83 c9 40             	or     $0x40,%ecx
+  802aab:	f6 c6 04             	test   $0x4,%dh
+  802aae:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  802ab1:	5d                   	pop    %rbp
+  802ab2:	c3                   	ret
+
+0000000000802ab3 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  802ab3:	55                   	push   %rbp
+  802ab4:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  802ab7:	48 b8 b9 29 80 00 00 	movabs $0x8029b9,%rax
+  802abe:	00 00 00 
+  802ac1:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  802ac3:	48 c1 e8 06          	shr    $0x6,%rax
+  802ac7:	83 e0 01             	and    $0x1,%eax
+}
+  802aca:	5d                   	pop    %rbp
+  802acb:	c3                   	ret
+
+0000000000802acc <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  802acc:	55                   	push   %rbp
+  802acd:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  802ad0:	48 b8 b9 29 80 00 00 	movabs $0x8029b9,%rax
+  802ad7:	00 00 00 
+  802ada:	ff d0                	call   *%rax
+  802adc:	83 e0 01             	and    $0x1,%eax
+}
+  802adf:	5d                   	pop    %rbp
+  802ae0:	c3                   	ret
+
+0000000000802ae1 <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  802ae1:	55                   	push   %rbp
+  802ae2:	48 89 e5             	mov    %rsp,%rbp
+  802ae5:	41 57                	push   %r15
+  802ae7:	41 56                	push   %r14
+  802ae9:	41 55                	push   %r13
+  802aeb:	41 54                	push   %r12
+  802aed:	53                   	push   %rbx
+  802aee:	48 83 ec 38          	sub    $0x38,%rsp
+  802af2:	49 89 f7             	mov    %rsi,%r15
+  802af5:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+                    }
+                    continue;
+                }
+                for (int ptei = 0; ptei < PT_ENTRY_COUNT; ptei++) {
+                    uintptr_t pte_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, pdei, ptei, 0);
+                    pte_t pte = uvpt[VPT(pte_addr)];
+  802afb:	49 bd 00 00 00 00 00 	movabs $0x10000000000,%r13
+  802b02:	01 00 00 
+  802b05:	4d 89 e6             	mov    %r12,%r14
+  802b08:	49 89 fc             	mov    %rdi,%r12
+  802b0b:	e9 19 01 00 00       	jmp    802c29 <foreach_shared_region+0x148>
+  802b10:	48 89 5d b0          	mov    %rbx,-0x50(%rbp)
+  802b14:	4c 89 75 a8          	mov    %r14,-0x58(%rbp)
+  802b18:	eb 52                	jmp    802b6c <foreach_shared_region+0x8b>
+                for (int ptei = 0; ptei < PT_ENTRY_COUNT; ptei++) {
+  802b1a:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802b21:	48 81 fb 00 00 20 00 	cmp    $0x200000,%rbx
+  802b28:	74 2e                	je     802b58 <foreach_shared_region+0x77>
+                    uintptr_t pte_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, pdei, ptei, 0);
+  802b2a:	48 89 df             	mov    %rbx,%rdi
+  802b2d:	4c 09 f7             	or     %r14,%rdi
+                    pte_t pte = uvpt[VPT(pte_addr)];
+  802b30:	48 89 f8             	mov    %rdi,%rax
+  802b33:	48 c1 e8 0c          	shr    $0xc,%rax
+  802b37:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+                    if ((pte & PTE_P) && (pte & PTE_SHARE)) {
+  802b3c:	25 01 04 00 00       	and    $0x401,%eax
+  802b41:	48 3d 01 04 00 00    	cmp    $0x401,%rax
+  802b47:	75 d1                	jne    802b1a <foreach_shared_region+0x39>
+                        fun((void*)pte_addr, (void*)(pte_addr + PAGE_SIZE), arg);
+  802b49:	48 8d b7 00 10 00 00 	lea    0x1000(%rdi),%rsi
+  802b50:	4c 89 fa             	mov    %r15,%rdx
+  802b53:	41 ff d4             	call   *%r12
+  802b56:	eb c2                	jmp    802b1a <foreach_shared_region+0x39>
+            for (int pdei = 0; pdei < PD_ENTRY_COUNT; pdei++) {
+  802b58:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  802b5f:	00 
+  802b60:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802b64:	48 3d 00 00 00 40    	cmp    $0x40000000,%rax
+  802b6a:	74 46                	je     802bb2 <foreach_shared_region+0xd1>
+                uintptr_t pde_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, pdei, 0, 0);
+  802b6c:	4c 8b 75 c8          	mov    -0x38(%rbp),%r14
+  802b70:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802b74:	49 09 c6             	or     %rax,%r14
+                pde_t pde = uvpd[VPD(pde_addr)];
+  802b77:	4c 89 f0             	mov    %r14,%rax
+  802b7a:	48 c1 e8 15          	shr    $0x15,%rax
+  802b7e:	48 b9 00 00 00 80 00 	movabs $0x10080000000,%rcx
+  802b85:	01 00 00 
+  802b88:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+                if (!(pde & PTE_P)) {
+  802b8c:	a8 01                	test   $0x1,%al
+  802b8e:	74 c8                	je     802b58 <foreach_shared_region+0x77>
+                if (pde & PTE_PS) {
+  802b90:	48 89 c3             	mov    %rax,%rbx
+  802b93:	81 e3 80 00 00 00    	and    $0x80,%ebx
+  802b99:	74 8f                	je     802b2a <foreach_shared_region+0x49>
+                    if (pde & PTE_SHARE) {
+  802b9b:	f6 c4 04             	test   $0x4,%ah
+  802b9e:	74 b8                	je     802b58 <foreach_shared_region+0x77>
+                        fun((void*)pde_addr, (void*)(pde_addr + 1024 * 1024 * 2), arg);
+  802ba0:	49 8d b6 00 00 20 00 	lea    0x200000(%r14),%rsi
+  802ba7:	4c 89 fa             	mov    %r15,%rdx
+  802baa:	4c 89 f7             	mov    %r14,%rdi
+  802bad:	41 ff d4             	call   *%r12
+  802bb0:	eb a6                	jmp    802b58 <foreach_shared_region+0x77>
+  802bb2:	48 8b 5d b0          	mov    -0x50(%rbp),%rbx
+  802bb6:	4c 8b 75 a8          	mov    -0x58(%rbp),%r14
+        for (int pdpei = 0; pdpei < PDP_ENTRY_COUNT; pdpei++) {
+  802bba:	48 81 c3 00 00 00 40 	add    $0x40000000,%rbx
+  802bc1:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802bc8:	00 00 00 
+  802bcb:	48 39 c3             	cmp    %rax,%rbx
+  802bce:	74 4c                	je     802c1c <foreach_shared_region+0x13b>
+            uintptr_t pdpe_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, 0, 0, 0);
+  802bd0:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802bd4:	48 09 d8             	or     %rbx,%rax
+  802bd7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+            pdpe_t pdpe = uvpdp[VPDP(pdpe_addr)];
+  802bdb:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802bdf:	48 b9 00 00 40 80 00 	movabs $0x10080400000,%rcx
+  802be6:	01 00 00 
+  802be9:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+            if (!(pdpe & PTE_P)) {
+  802bed:	a8 01                	test   $0x1,%al
+  802bef:	74 c9                	je     802bba <foreach_shared_region+0xd9>
+            if (pdpe & PTE_PS) {
+  802bf1:	48 89 c1             	mov    %rax,%rcx
+  802bf4:	81 e1 80 00 00 00    	and    $0x80,%ecx
+  802bfa:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  802bfe:	0f 84 0c ff ff ff    	je     802b10 <foreach_shared_region+0x2f>
+                if (pdpe & PTE_SHARE) {
+  802c04:	f6 c4 04             	test   $0x4,%ah
+  802c07:	74 b1                	je     802bba <foreach_shared_region+0xd9>
+                    fun((void*)pdpe_addr, (void*)(pdpe_addr + 1024 * 1024 * 1024), arg); 
+  802c09:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  802c0d:	48 8d b7 00 00 00 40 	lea    0x40000000(%rdi),%rsi
+  802c14:	4c 89 fa             	mov    %r15,%rdx
+  802c17:	41 ff d4             	call   *%r12
+  802c1a:	eb 9e                	jmp    802bba <foreach_shared_region+0xd9>
+    for (int pml4ei = 0; pml4ei < PML4_ENTRY_COUNT; pml4ei++) {
+  802c1c:	49 83 c6 01          	add    $0x1,%r14
+  802c20:	49 81 fe 00 02 00 00 	cmp    $0x200,%r14
+  802c27:	74 24                	je     802c4d <foreach_shared_region+0x16c>
+        pml4e_t pml4e = uvpml4[VPML4(pml4_addr)];
+  802c29:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  802c30:	01 00 00 
+  802c33:	4a 8b 04 f0          	mov    (%rax,%r14,8),%rax
+        if (!(pml4e & PTE_P)) {
+  802c37:	a8 01                	test   $0x1,%al
+  802c39:	74 e1                	je     802c1c <foreach_shared_region+0x13b>
+  802c3b:	4c 89 f0             	mov    %r14,%rax
+  802c3e:	48 c1 e0 27          	shl    $0x27,%rax
+  802c42:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  802c46:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802c4b:	eb 83                	jmp    802bd0 <foreach_shared_region+0xef>
+            }
+        }
+    }
+    
+    return 0;
+}
+  802c4d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c52:	48 83 c4 38          	add    $0x38,%rsp
+  802c56:	5b                   	pop    %rbx
+  802c57:	41 5c                	pop    %r12
+  802c59:	41 5d                	pop    %r13
+  802c5b:	41 5e                	pop    %r14
+  802c5d:	41 5f                	pop    %r15
+  802c5f:	5d                   	pop    %rbp
+  802c60:	c3                   	ret
+
+0000000000802c61 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  802c61:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c66:	c3                   	ret
+
+0000000000802c67 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  802c67:	55                   	push   %rbp
+  802c68:	48 89 e5             	mov    %rsp,%rbp
+  802c6b:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  802c6e:	48 be ea 37 80 00 00 	movabs $0x8037ea,%rsi
+  802c75:	00 00 00 
+  802c78:	48 b8 2e 0d 80 00 00 	movabs $0x800d2e,%rax
+  802c7f:	00 00 00 
+  802c82:	ff d0                	call   *%rax
+    return 0;
+}
+  802c84:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c89:	5d                   	pop    %rbp
+  802c8a:	c3                   	ret
+
+0000000000802c8b <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  802c8b:	55                   	push   %rbp
+  802c8c:	48 89 e5             	mov    %rsp,%rbp
+  802c8f:	41 57                	push   %r15
+  802c91:	41 56                	push   %r14
+  802c93:	41 55                	push   %r13
+  802c95:	41 54                	push   %r12
+  802c97:	53                   	push   %rbx
+  802c98:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  802c9f:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  802ca6:	48 85 d2             	test   %rdx,%rdx
+  802ca9:	74 7a                	je     802d25 <devcons_write+0x9a>
+  802cab:	49 89 d6             	mov    %rdx,%r14
+  802cae:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802cb4:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  802cb9:	49 bf 28 0f 80 00 00 	movabs $0x800f28,%r15
+  802cc0:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  802cc3:	4c 89 f3             	mov    %r14,%rbx
+  802cc6:	48 29 f3             	sub    %rsi,%rbx
+  802cc9:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802cce:	48 39 c3             	cmp    %rax,%rbx
+  802cd1:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  802cd5:	4c 63 eb             	movslq %ebx,%r13
+  802cd8:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  802cdf:	48 01 c6             	add    %rax,%rsi
+  802ce2:	4c 89 ea             	mov    %r13,%rdx
+  802ce5:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802cec:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  802cef:	4c 89 ee             	mov    %r13,%rsi
+  802cf2:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802cf9:	48 b8 55 11 80 00 00 	movabs $0x801155,%rax
+  802d00:	00 00 00 
+  802d03:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  802d05:	41 01 dc             	add    %ebx,%r12d
+  802d08:	49 63 f4             	movslq %r12d,%rsi
+  802d0b:	4c 39 f6             	cmp    %r14,%rsi
+  802d0e:	72 b3                	jb     802cc3 <devcons_write+0x38>
+    return res;
+  802d10:	49 63 c4             	movslq %r12d,%rax
+}
+  802d13:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  802d1a:	5b                   	pop    %rbx
+  802d1b:	41 5c                	pop    %r12
+  802d1d:	41 5d                	pop    %r13
+  802d1f:	41 5e                	pop    %r14
+  802d21:	41 5f                	pop    %r15
+  802d23:	5d                   	pop    %rbp
+  802d24:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  802d25:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802d2b:	eb e3                	jmp    802d10 <devcons_write+0x85>
+
+0000000000802d2d <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  802d2d:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  802d30:	ba 00 00 00 00       	mov    $0x0,%edx
+  802d35:	48 85 c0             	test   %rax,%rax
+  802d38:	74 55                	je     802d8f <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  802d3a:	55                   	push   %rbp
+  802d3b:	48 89 e5             	mov    %rsp,%rbp
+  802d3e:	41 55                	push   %r13
+  802d40:	41 54                	push   %r12
+  802d42:	53                   	push   %rbx
+  802d43:	48 83 ec 08          	sub    $0x8,%rsp
+  802d47:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  802d4a:	48 bb 82 11 80 00 00 	movabs $0x801182,%rbx
+  802d51:	00 00 00 
+  802d54:	49 bc 4f 12 80 00 00 	movabs $0x80124f,%r12
+  802d5b:	00 00 00 
+  802d5e:	eb 03                	jmp    802d63 <devcons_read+0x36>
+  802d60:	41 ff d4             	call   *%r12
+  802d63:	ff d3                	call   *%rbx
+  802d65:	85 c0                	test   %eax,%eax
+  802d67:	74 f7                	je     802d60 <devcons_read+0x33>
+    if (c < 0) return c;
+  802d69:	48 63 d0             	movslq %eax,%rdx
+  802d6c:	78 13                	js     802d81 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  802d6e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802d73:	83 f8 04             	cmp    $0x4,%eax
+  802d76:	74 09                	je     802d81 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  802d78:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  802d7c:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  802d81:	48 89 d0             	mov    %rdx,%rax
+  802d84:	48 83 c4 08          	add    $0x8,%rsp
+  802d88:	5b                   	pop    %rbx
+  802d89:	41 5c                	pop    %r12
+  802d8b:	41 5d                	pop    %r13
+  802d8d:	5d                   	pop    %rbp
+  802d8e:	c3                   	ret
+  802d8f:	48 89 d0             	mov    %rdx,%rax
+  802d92:	c3                   	ret
+
+0000000000802d93 <cputchar>:
+cputchar(int ch) {
+  802d93:	55                   	push   %rbp
+  802d94:	48 89 e5             	mov    %rsp,%rbp
+  802d97:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  802d9b:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  802d9f:	be 01 00 00 00       	mov    $0x1,%esi
+  802da4:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  802da8:	48 b8 55 11 80 00 00 	movabs $0x801155,%rax
+  802daf:	00 00 00 
+  802db2:	ff d0                	call   *%rax
+}
+  802db4:	c9                   	leave
+  802db5:	c3                   	ret
+
+0000000000802db6 <getchar>:
+getchar(void) {
+  802db6:	55                   	push   %rbp
+  802db7:	48 89 e5             	mov    %rsp,%rbp
+  802dba:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  802dbe:	ba 01 00 00 00       	mov    $0x1,%edx
+  802dc3:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  802dc7:	bf 00 00 00 00       	mov    $0x0,%edi
+  802dcc:	48 b8 21 1c 80 00 00 	movabs $0x801c21,%rax
+  802dd3:	00 00 00 
+  802dd6:	ff d0                	call   *%rax
+  802dd8:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  802dda:	85 c0                	test   %eax,%eax
+  802ddc:	78 06                	js     802de4 <getchar+0x2e>
+  802dde:	74 08                	je     802de8 <getchar+0x32>
+  802de0:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  802de4:	89 d0                	mov    %edx,%eax
+  802de6:	c9                   	leave
+  802de7:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  802de8:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  802ded:	eb f5                	jmp    802de4 <getchar+0x2e>
+
+0000000000802def <iscons>:
+iscons(int fdnum) {
+  802def:	55                   	push   %rbp
+  802df0:	48 89 e5             	mov    %rsp,%rbp
+  802df3:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  802df7:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802dfb:	48 b8 3e 19 80 00 00 	movabs $0x80193e,%rax
+  802e02:	00 00 00 
+  802e05:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802e07:	85 c0                	test   %eax,%eax
+  802e09:	78 18                	js     802e23 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  802e0b:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802e0f:	48 b8 a0 40 80 00 00 	movabs $0x8040a0,%rax
+  802e16:	00 00 00 
+  802e19:	8b 00                	mov    (%rax),%eax
+  802e1b:	39 02                	cmp    %eax,(%rdx)
+  802e1d:	0f 94 c0             	sete   %al
+  802e20:	0f b6 c0             	movzbl %al,%eax
+}
+  802e23:	c9                   	leave
+  802e24:	c3                   	ret
+
+0000000000802e25 <opencons>:
+opencons(void) {
+  802e25:	55                   	push   %rbp
+  802e26:	48 89 e5             	mov    %rsp,%rbp
+  802e29:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802e2d:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  802e31:	48 b8 24 19 80 00 00 	movabs $0x801924,%rax
+  802e38:	00 00 00 
+  802e3b:	ff d0                	call   *%rax
+  802e3d:	85 c0                	test   %eax,%eax
+  802e3f:	78 49                	js     802e8a <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  802e41:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802e46:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802e4b:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  802e4f:	bf 00 00 00 00       	mov    $0x0,%edi
+  802e54:	48 b8 de 12 80 00 00 	movabs $0x8012de,%rax
+  802e5b:	00 00 00 
+  802e5e:	ff d0                	call   *%rax
+  802e60:	85 c0                	test   %eax,%eax
+  802e62:	78 26                	js     802e8a <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  802e64:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802e68:	a1 a0 40 80 00 00 00 	movabs 0x8040a0,%eax
+  802e6f:	00 00 
+  802e71:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  802e73:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802e77:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  802e7e:	48 b8 7d 18 80 00 00 	movabs $0x80187d,%rax
+  802e85:	00 00 00 
+  802e88:	ff d0                	call   *%rax
+}
+  802e8a:	c9                   	leave
+  802e8b:	c3                   	ret
+
+0000000000802e8c <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  802e8c:	55                   	push   %rbp
+  802e8d:	48 89 e5             	mov    %rsp,%rbp
+  802e90:	41 55                	push   %r13
+  802e92:	41 54                	push   %r12
+  802e94:	53                   	push   %rbx
+  802e95:	48 83 ec 08          	sub    $0x8,%rsp
+  802e99:	49 89 fc             	mov    %rdi,%r12
+  802e9c:	48 89 f7             	mov    %rsi,%rdi
+  802e9f:	48 89 d3             	mov    %rdx,%rbx
+  802ea2:	49 89 cd             	mov    %rcx,%r13
+    // LAB 9: Your code here:
+    int res = sys_ipc_recv(!pg ? (void*)MAX_USER_ADDRESS : pg, !size ? 0 : *size);
+  802ea5:	be 00 00 00 00       	mov    $0x0,%esi
+  802eaa:	48 85 d2             	test   %rdx,%rdx
+  802ead:	74 03                	je     802eb2 <ipc_recv+0x26>
+  802eaf:	48 8b 32             	mov    (%rdx),%rsi
+  802eb2:	48 85 ff             	test   %rdi,%rdi
+  802eb5:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802ebc:	00 00 00 
+  802ebf:	48 0f 44 f8          	cmove  %rax,%rdi
+  802ec3:	48 b8 b0 16 80 00 00 	movabs $0x8016b0,%rax
+  802eca:	00 00 00 
+  802ecd:	ff d0                	call   *%rax
+    if (res < 0) {
+  802ecf:	85 c0                	test   %eax,%eax
+  802ed1:	78 66                	js     802f39 <ipc_recv+0xad>
+        if (size) {
+            *size = 0;
+        }
+        return res;
+    }
+    if (from_env_store) {
+  802ed3:	4d 85 e4             	test   %r12,%r12
+  802ed6:	74 14                	je     802eec <ipc_recv+0x60>
+        *from_env_store = thisenv->env_ipc_from;
+  802ed8:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802edf:	00 00 00 
+  802ee2:	8b 80 ac 01 00 00    	mov    0x1ac(%rax),%eax
+  802ee8:	41 89 04 24          	mov    %eax,(%r12)
+    }
+    if (perm_store) {
+  802eec:	4d 85 ed             	test   %r13,%r13
+  802eef:	74 14                	je     802f05 <ipc_recv+0x79>
+        *perm_store = thisenv->env_ipc_perm;
+  802ef1:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802ef8:	00 00 00 
+  802efb:	8b 80 b0 01 00 00    	mov    0x1b0(%rax),%eax
+  802f01:	41 89 45 00          	mov    %eax,0x0(%r13)
+    }
+    if (size) {
+  802f05:	48 85 db             	test   %rbx,%rbx
+  802f08:	74 14                	je     802f1e <ipc_recv+0x92>
+        *size = thisenv->env_ipc_maxsz;
+  802f0a:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802f11:	00 00 00 
+  802f14:	48 8b 80 a0 01 00 00 	mov    0x1a0(%rax),%rax
+  802f1b:	48 89 03             	mov    %rax,(%rbx)
+    }
+    return thisenv->env_ipc_value;
+  802f1e:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802f25:	00 00 00 
+  802f28:	8b 80 a8 01 00 00    	mov    0x1a8(%rax),%eax
+}
+  802f2e:	48 83 c4 08          	add    $0x8,%rsp
+  802f32:	5b                   	pop    %rbx
+  802f33:	41 5c                	pop    %r12
+  802f35:	41 5d                	pop    %r13
+  802f37:	5d                   	pop    %rbp
+  802f38:	c3                   	ret
+        if (from_env_store) {
+  802f39:	4d 85 e4             	test   %r12,%r12
+  802f3c:	74 08                	je     802f46 <ipc_recv+0xba>
+            *from_env_store = 0;
+  802f3e:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  802f45:	00 
+        if (perm_store) {
+  802f46:	4d 85 ed             	test   %r13,%r13
+  802f49:	74 08                	je     802f53 <ipc_recv+0xc7>
+            *perm_store = 0;
+  802f4b:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  802f52:	00 
+        if (size) {
+  802f53:	48 85 db             	test   %rbx,%rbx
+  802f56:	74 d6                	je     802f2e <ipc_recv+0xa2>
+            *size = 0;
+  802f58:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  802f5f:	eb cd                	jmp    802f2e <ipc_recv+0xa2>
+
+0000000000802f61 <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  802f61:	55                   	push   %rbp
+  802f62:	48 89 e5             	mov    %rsp,%rbp
+  802f65:	41 57                	push   %r15
+  802f67:	41 56                	push   %r14
+  802f69:	41 55                	push   %r13
+  802f6b:	41 54                	push   %r12
+  802f6d:	53                   	push   %rbx
+  802f6e:	48 83 ec 18          	sub    $0x18,%rsp
+  802f72:	41 89 fd             	mov    %edi,%r13d
+  802f75:	89 75 cc             	mov    %esi,-0x34(%rbp)
+  802f78:	49 89 cc             	mov    %rcx,%r12
+  802f7b:	44 89 45 c8          	mov    %r8d,-0x38(%rbp)
+    // LAB 9: Your code here:
+    int res = 0;
+    while ((res = sys_ipc_try_send(to_env, val, !pg ? (void*)MAX_USER_ADDRESS : pg, size, perm)) < 0) {
+  802f7f:	48 85 d2             	test   %rdx,%rdx
+  802f82:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802f89:	00 00 00 
+  802f8c:	48 0f 45 c2          	cmovne %rdx,%rax
+  802f90:	48 89 c3             	mov    %rax,%rbx
+  802f93:	49 be 84 16 80 00 00 	movabs $0x801684,%r14
+  802f9a:	00 00 00 
+        if (res != -E_IPC_NOT_RECV) {
+            panic("sys_ipc_try_send failed: %i", res);
+        }
+        sys_yield();
+  802f9d:	49 bf 4f 12 80 00 00 	movabs $0x80124f,%r15
+  802fa4:	00 00 00 
+    while ((res = sys_ipc_try_send(to_env, val, !pg ? (void*)MAX_USER_ADDRESS : pg, size, perm)) < 0) {
+  802fa7:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  802faa:	44 8b 45 c8          	mov    -0x38(%rbp),%r8d
+  802fae:	4c 89 e1             	mov    %r12,%rcx
+  802fb1:	48 89 da             	mov    %rbx,%rdx
+  802fb4:	44 89 ef             	mov    %r13d,%edi
+  802fb7:	41 ff d6             	call   *%r14
+  802fba:	85 c0                	test   %eax,%eax
+  802fbc:	79 37                	jns    802ff5 <ipc_send+0x94>
+        if (res != -E_IPC_NOT_RECV) {
+  802fbe:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  802fc1:	75 05                	jne    802fc8 <ipc_send+0x67>
+        sys_yield();
+  802fc3:	41 ff d7             	call   *%r15
+  802fc6:	eb df                	jmp    802fa7 <ipc_send+0x46>
+            panic("sys_ipc_try_send failed: %i", res);
+  802fc8:	89 c1                	mov    %eax,%ecx
+  802fca:	48 ba f6 37 80 00 00 	movabs $0x8037f6,%rdx
+  802fd1:	00 00 00 
+  802fd4:	be 40 00 00 00       	mov    $0x40,%esi
+  802fd9:	48 bf 12 38 80 00 00 	movabs $0x803812,%rdi
+  802fe0:	00 00 00 
+  802fe3:	b8 00 00 00 00       	mov    $0x0,%eax
+  802fe8:	49 b8 b9 02 80 00 00 	movabs $0x8002b9,%r8
+  802fef:	00 00 00 
+  802ff2:	41 ff d0             	call   *%r8
+    }
+    return;
+}
+  802ff5:	48 83 c4 18          	add    $0x18,%rsp
+  802ff9:	5b                   	pop    %rbx
+  802ffa:	41 5c                	pop    %r12
+  802ffc:	41 5d                	pop    %r13
+  802ffe:	41 5e                	pop    %r14
+  803000:	41 5f                	pop    %r15
+  803002:	5d                   	pop    %rbp
+  803003:	c3                   	ret
+
+0000000000803004 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  803004:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  803009:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  803010:	00 00 00 
+  803013:	48 69 d0 d0 01 00 00 	imul   $0x1d0,%rax,%rdx
+  80301a:	48 01 ca             	add    %rcx,%rdx
+  80301d:	8b 92 e8 00 00 00    	mov    0xe8(%rdx),%edx
+  803023:	39 fa                	cmp    %edi,%edx
+  803025:	74 12                	je     803039 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  803027:	48 83 c0 01          	add    $0x1,%rax
+  80302b:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  803031:	75 e0                	jne    803013 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  803033:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803038:	c3                   	ret
+            return envs[i].env_id;
+  803039:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+  803040:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  803047:	00 00 00 
+  80304a:	48 01 d0             	add    %rdx,%rax
+  80304d:	8b 80 e0 00 00 00    	mov    0xe0(%rax),%eax
+  803053:	c3                   	ret
+  803054:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000803058 <__rodata_start>:
+  803058:	73 79                	jae    8030d3 <__rodata_start+0x7b>
+  80305a:	73 5f                	jae    8030bb <__rodata_start+0x63>
+  80305c:	61                   	(bad)
+  80305d:	6c                   	insb   (%dx),%es:(%rdi)
+  80305e:	6c                   	insb   (%dx),%es:(%rdi)
+  80305f:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803060:	63 5f 72             	movsxd 0x72(%rdi),%ebx
+  803063:	65 67 69 6f 6e 3a 20 	imul   $0x6925203a,%gs:0x6e(%edi),%ebp
+  80306a:	25 69 
+  80306c:	00 75 73             	add    %dh,0x73(%rbp)
+  80306f:	65 72 2f             	gs jb  8030a1 <__rodata_start+0x49>
+  803072:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  803074:	72 6b                	jb     8030e1 <__rodata_start+0x89>
+  803076:	77 72                	ja     8030ea <__rodata_start+0x92>
+  803078:	69 74 65 2e 63 00 66 	imul   $0x6f660063,0x2e(%rbp,%riz,2),%esi
+  80307f:	6f 
+  803080:	72 6b                	jb     8030ed <__rodata_start+0x95>
+  803082:	3a 20                	cmp    (%rax),%ah
+  803084:	25 69 00 90 66       	and    $0x66900069,%eax
+  803089:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80308a:	72 6b                	jb     8030f7 <__rodata_start+0x9f>
+  80308c:	77 72                	ja     803100 <__rodata_start+0xa8>
+  80308e:	69 74 65 3a 20 66 6f 	imul   $0x726f6620,0x3a(%rbp,%riz,2),%esi
+  803095:	72 
+  803096:	6b 20 25             	imul   $0x25,(%rax),%esp
+  803099:	6c                   	insb   (%dx),%es:(%rdi)
+  80309a:	75 20                	jne    8030bc <__rodata_start+0x64>
+  80309c:	63 79 63             	movsxd 0x63(%rcx),%edi
+  80309f:	6c                   	insb   (%dx),%es:(%rdi)
+  8030a0:	65 73 2c             	gs jae 8030cf <__rodata_start+0x77>
+  8030a3:	20 73 70             	and    %dh,0x70(%rbx)
+  8030a6:	61                   	(bad)
+  8030a7:	72 73                	jb     80311c <__rodata_start+0xc4>
+  8030a9:	65 20 77 72          	and    %dh,%gs:0x72(%rdi)
+  8030ad:	69 74 65 20 25 6c 75 	imul   $0x20756c25,0x20(%rbp,%riz,2),%esi
+  8030b4:	20 
+  8030b5:	63 79 63             	movsxd 0x63(%rcx),%edi
+  8030b8:	6c                   	insb   (%dx),%es:(%rdi)
+  8030b9:	65 73 20             	gs jae 8030dc <__rodata_start+0x84>
+  8030bc:	70 65                	jo     803123 <__rodata_start+0xcb>
+  8030be:	72 20                	jb     8030e0 <__rodata_start+0x88>
+  8030c0:	32 4d 20             	xor    0x20(%rbp),%cl
+  8030c3:	70 61                	jo     803126 <__rodata_start+0xce>
+  8030c5:	67 65 2c 20          	addr32 gs sub $0x20,%al
+  8030c9:	64 65 6e             	fs outsb %gs:(%rsi),(%dx)
+  8030cc:	73 65                	jae    803133 <__rodata_start+0xdb>
+  8030ce:	20 77 72             	and    %dh,0x72(%rdi)
+  8030d1:	69 74 65 20 25 6c 75 	imul   $0x20756c25,0x20(%rbp,%riz,2),%esi
+  8030d8:	20 
+  8030d9:	63 79 63             	movsxd 0x63(%rcx),%edi
+  8030dc:	6c                   	insb   (%dx),%es:(%rdi)
+  8030dd:	65 73 20             	gs jae 803100 <__rodata_start+0xa8>
+  8030e0:	70 65                	jo     803147 <__rodata_start+0xef>
+  8030e2:	72 20                	jb     803104 <__rodata_start+0xac>
+  8030e4:	32 4d 20             	xor    0x20(%rbp),%cl
+  8030e7:	70 61                	jo     80314a <__rodata_start+0xf2>
+  8030e9:	67 65 0a 00          	or     %gs:(%eax),%al
+  8030ed:	3c 75                	cmp    $0x75,%al
+  8030ef:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8030f0:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  8030f4:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8030f5:	3e 00 90 5b 25 30 38 	ds add %dl,0x3830255b(%rax)
+  8030fc:	78 5d                	js     80315b <__rodata_start+0x103>
+  8030fe:	20 75 73             	and    %dh,0x73(%rbp)
+  803101:	65 72 20             	gs jb  803124 <__rodata_start+0xcc>
+  803104:	70 61                	jo     803167 <__rodata_start+0x10f>
+  803106:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803107:	69 63 20 69 6e 20 25 	imul   $0x25206e69,0x20(%rbx),%esp
+  80310e:	73 20                	jae    803130 <__rodata_start+0xd8>
+  803110:	61                   	(bad)
+  803111:	74 20                	je     803133 <__rodata_start+0xdb>
+  803113:	25 73 3a 25 64       	and    $0x64253a73,%eax
+  803118:	3a 20                	cmp    (%rax),%ah
+  80311a:	00 30                	add    %dh,(%rax)
+  80311c:	31 32                	xor    %esi,(%rdx)
+  80311e:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  803125:	41                   	rex.B
+  803126:	42                   	rex.X
+  803127:	43                   	rex.XB
+  803128:	44                   	rex.R
+  803129:	45                   	rex.RB
+  80312a:	46 00 30             	rex.RX add %r14b,(%rax)
+  80312d:	31 32                	xor    %esi,(%rdx)
+  80312f:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  803136:	61                   	(bad)
+  803137:	62 63 64 65 66       	(bad)
+  80313c:	00 28                	add    %ch,(%rax)
+  80313e:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80313f:	75 6c                	jne    8031ad <__rodata_start+0x155>
+  803141:	6c                   	insb   (%dx),%es:(%rdi)
+  803142:	29 00                	sub    %eax,(%rax)
+  803144:	65 72 72             	gs jb  8031b9 <__rodata_start+0x161>
+  803147:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803148:	72 20                	jb     80316a <__rodata_start+0x112>
+  80314a:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  80314f:	73 70                	jae    8031c1 <__rodata_start+0x169>
+  803151:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  803155:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  80315c:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80315d:	72 00                	jb     80315f <__rodata_start+0x107>
+  80315f:	62 61 64 20 65       	(bad)
+  803164:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803165:	76 69                	jbe    8031d0 <__rodata_start+0x178>
+  803167:	72 6f                	jb     8031d8 <__rodata_start+0x180>
+  803169:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80316a:	6d                   	insl   (%dx),%es:(%rdi)
+  80316b:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  80316d:	74 00                	je     80316f <__rodata_start+0x117>
+  80316f:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  803176:	20 70 61             	and    %dh,0x61(%rax)
+  803179:	72 61                	jb     8031dc <__rodata_start+0x184>
+  80317b:	6d                   	insl   (%dx),%es:(%rdi)
+  80317c:	65 74 65             	gs je  8031e4 <__rodata_start+0x18c>
+  80317f:	72 00                	jb     803181 <__rodata_start+0x129>
+  803181:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803182:	75 74                	jne    8031f8 <__rodata_start+0x1a0>
+  803184:	20 6f 66             	and    %ch,0x66(%rdi)
+  803187:	20 6d 65             	and    %ch,0x65(%rbp)
+  80318a:	6d                   	insl   (%dx),%es:(%rdi)
+  80318b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80318c:	72 79                	jb     803207 <__rodata_start+0x1af>
+  80318e:	00 6f 75             	add    %ch,0x75(%rdi)
+  803191:	74 20                	je     8031b3 <__rodata_start+0x15b>
+  803193:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803194:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  803198:	76 69                	jbe    803203 <__rodata_start+0x1ab>
+  80319a:	72 6f                	jb     80320b <__rodata_start+0x1b3>
+  80319c:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80319d:	6d                   	insl   (%dx),%es:(%rdi)
+  80319e:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  8031a0:	74 73                	je     803215 <__rodata_start+0x1bd>
+  8031a2:	00 63 6f             	add    %ah,0x6f(%rbx)
+  8031a5:	72 72                	jb     803219 <__rodata_start+0x1c1>
+  8031a7:	75 70                	jne    803219 <__rodata_start+0x1c1>
+  8031a9:	74 65                	je     803210 <__rodata_start+0x1b8>
+  8031ab:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  8031b0:	75 67                	jne    803219 <__rodata_start+0x1c1>
+  8031b2:	20 69 6e             	and    %ch,0x6e(%rcx)
+  8031b5:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  8031b7:	00 73 65             	add    %dh,0x65(%rbx)
+  8031ba:	67 6d                	insl   (%dx),%es:(%edi)
+  8031bc:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  8031be:	74 61                	je     803221 <__rodata_start+0x1c9>
+  8031c0:	74 69                	je     80322b <__rodata_start+0x1d3>
+  8031c2:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8031c3:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8031c4:	20 66 61             	and    %ah,0x61(%rsi)
+  8031c7:	75 6c                	jne    803235 <__rodata_start+0x1dd>
+  8031c9:	74 00                	je     8031cb <__rodata_start+0x173>
+  8031cb:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  8031d2:	20 45 4c             	and    %al,0x4c(%rbp)
+  8031d5:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  8031d9:	61                   	(bad)
+  8031da:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  8031df:	20 73 75             	and    %dh,0x75(%rbx)
+  8031e2:	63 68 20             	movsxd 0x20(%rax),%ebp
+  8031e5:	73 79                	jae    803260 <__rodata_start+0x208>
+  8031e7:	73 74                	jae    80325d <__rodata_start+0x205>
+  8031e9:	65 6d                	gs insl (%dx),%es:(%rdi)
+  8031eb:	20 63 61             	and    %ah,0x61(%rbx)
+  8031ee:	6c                   	insb   (%dx),%es:(%rdi)
+  8031ef:	6c                   	insb   (%dx),%es:(%rdi)
+  8031f0:	00 65 6e             	add    %ah,0x6e(%rbp)
+  8031f3:	74 72                	je     803267 <__rodata_start+0x20f>
+  8031f5:	79 20                	jns    803217 <__rodata_start+0x1bf>
+  8031f7:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8031f8:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8031f9:	74 20                	je     80321b <__rodata_start+0x1c3>
+  8031fb:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  8031fd:	75 6e                	jne    80326d <__rodata_start+0x215>
+  8031ff:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  803203:	76 20                	jbe    803225 <__rodata_start+0x1cd>
+  803205:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  80320c:	72 65                	jb     803273 <__rodata_start+0x21b>
+  80320e:	63 76 69             	movsxd 0x69(%rsi),%esi
+  803211:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803212:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  803216:	65 78 70             	gs js  803289 <__rodata_start+0x231>
+  803219:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  80321e:	20 65 6e             	and    %ah,0x6e(%rbp)
+  803221:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  803225:	20 66 69             	and    %ah,0x69(%rsi)
+  803228:	6c                   	insb   (%dx),%es:(%rdi)
+  803229:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  80322d:	20 66 72             	and    %ah,0x72(%rsi)
+  803230:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  803235:	61                   	(bad)
+  803236:	63 65 20             	movsxd 0x20(%rbp),%esp
+  803239:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80323a:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80323b:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  80323f:	6b 00 74             	imul   $0x74,(%rax),%eax
+  803242:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803243:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803244:	20 6d 61             	and    %ch,0x61(%rbp)
+  803247:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803248:	79 20                	jns    80326a <__rodata_start+0x212>
+  80324a:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  803251:	72 65                	jb     8032b8 <__rodata_start+0x260>
+  803253:	20 6f 70             	and    %ch,0x70(%rdi)
+  803256:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803258:	00 66 69             	add    %ah,0x69(%rsi)
+  80325b:	6c                   	insb   (%dx),%es:(%rdi)
+  80325c:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  803260:	20 62 6c             	and    %ah,0x6c(%rdx)
+  803263:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803264:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  803267:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803268:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803269:	74 20                	je     80328b <__rodata_start+0x233>
+  80326b:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  80326d:	75 6e                	jne    8032dd <__rodata_start+0x285>
+  80326f:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  803273:	76 61                	jbe    8032d6 <__rodata_start+0x27e>
+  803275:	6c                   	insb   (%dx),%es:(%rdi)
+  803276:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  80327d:	00 
+  80327e:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  803285:	72 65                	jb     8032ec <__rodata_start+0x294>
+  803287:	61                   	(bad)
+  803288:	64 79 20             	fs jns 8032ab <__rodata_start+0x253>
+  80328b:	65 78 69             	gs js  8032f7 <__rodata_start+0x29f>
+  80328e:	73 74                	jae    803304 <__rodata_start+0x2ac>
+  803290:	73 00                	jae    803292 <__rodata_start+0x23a>
+  803292:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803293:	70 65                	jo     8032fa <__rodata_start+0x2a2>
+  803295:	72 61                	jb     8032f8 <__rodata_start+0x2a0>
+  803297:	74 69                	je     803302 <__rodata_start+0x2aa>
+  803299:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80329a:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80329b:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  80329e:	74 20                	je     8032c0 <__rodata_start+0x268>
+  8032a0:	73 75                	jae    803317 <__rodata_start+0x2bf>
+  8032a2:	70 70                	jo     803314 <__rodata_start+0x2bc>
+  8032a4:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8032a5:	72 74                	jb     80331b <__rodata_start+0x2c3>
+  8032a7:	65 64 00 6f 70       	gs add %ch,%fs:0x70(%rdi)
+  8032ac:	65 72 61             	gs jb  803310 <__rodata_start+0x2b8>
+  8032af:	74 69                	je     80331a <__rodata_start+0x2c2>
+  8032b1:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8032b2:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8032b3:	20 69 6e             	and    %ch,0x6e(%rcx)
+  8032b6:	74 65                	je     80331d <__rodata_start+0x2c5>
+  8032b8:	72 72                	jb     80332c <__rodata_start+0x2d4>
+  8032ba:	75 70                	jne    80332c <__rodata_start+0x2d4>
+  8032bc:	74 65                	je     803323 <__rodata_start+0x2cb>
+  8032be:	64 00 6e 6f          	add    %ch,%fs:0x6f(%rsi)
+  8032c2:	74 20                	je     8032e4 <__rodata_start+0x28c>
+  8032c4:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  8032c6:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8032c7:	75 67                	jne    803330 <__rodata_start+0x2d8>
+  8032c9:	68 20 43 50 55       	push   $0x55504320
+  8032ce:	20 74 69 6d          	and    %dh,0x6d(%rcx,%rbp,2)
+  8032d2:	65 00 66 2e          	add    %ah,%gs:0x2e(%rsi)
+  8032d6:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+  8032dd:	00 
+  8032de:	66 90                	xchg   %ax,%ax
+  8032e0:	f6 05 80 00 00 00 00 	testb  $0x0,0x80(%rip)        # 803367 <__rodata_start+0x30f>
+  8032e7:	00 37                	add    %dh,(%rdi)
+  8032e9:	0c 80                	or     $0x80,%al
+  8032eb:	00 00                	add    %al,(%rax)
+  8032ed:	00 00                	add    %al,(%rax)
+  8032ef:	00 27                	add    %ah,(%rdi)
+  8032f1:	0c 80                	or     $0x80,%al
+  8032f3:	00 00                	add    %al,(%rax)
+  8032f5:	00 00                	add    %al,(%rax)
+  8032f7:	00 37                	add    %dh,(%rdi)
+  8032f9:	0c 80                	or     $0x80,%al
+  8032fb:	00 00                	add    %al,(%rax)
+  8032fd:	00 00                	add    %al,(%rax)
+  8032ff:	00 37                	add    %dh,(%rdi)
+  803301:	0c 80                	or     $0x80,%al
+  803303:	00 00                	add    %al,(%rax)
+  803305:	00 00                	add    %al,(%rax)
+  803307:	00 37                	add    %dh,(%rdi)
+  803309:	0c 80                	or     $0x80,%al
+  80330b:	00 00                	add    %al,(%rax)
+  80330d:	00 00                	add    %al,(%rax)
+  80330f:	00 37                	add    %dh,(%rdi)
+  803311:	0c 80                	or     $0x80,%al
+  803313:	00 00                	add    %al,(%rax)
+  803315:	00 00                	add    %al,(%rax)
+  803317:	00 15 06 80 00 00    	add    %dl,0x8006(%rip)        # 80b323 <__bss_end+0x3323>
+  80331d:	00 00                	add    %al,(%rax)
+  80331f:	00 37                	add    %dh,(%rdi)
+  803321:	0c 80                	or     $0x80,%al
+  803323:	00 00                	add    %al,(%rax)
+  803325:	00 00                	add    %al,(%rax)
+  803327:	00 37                	add    %dh,(%rdi)
+  803329:	0c 80                	or     $0x80,%al
+  80332b:	00 00                	add    %al,(%rax)
+  80332d:	00 00                	add    %al,(%rax)
+  80332f:	00 09                	add    %cl,(%rcx)
+  803331:	06                   	(bad)
+  803332:	80 00 00             	addb   $0x0,(%rax)
+  803335:	00 00                	add    %al,(%rax)
+  803337:	00 83 06 80 00 00    	add    %al,0x8006(%rbx)
+  80333d:	00 00                	add    %al,(%rax)
+  80333f:	00 37                	add    %dh,(%rdi)
+  803341:	0c 80                	or     $0x80,%al
+  803343:	00 00                	add    %al,(%rax)
+  803345:	00 00                	add    %al,(%rax)
+  803347:	00 09                	add    %cl,(%rcx)
+  803349:	06                   	(bad)
+  80334a:	80 00 00             	addb   $0x0,(%rax)
+  80334d:	00 00                	add    %al,(%rax)
+  80334f:	00 4f 06             	add    %cl,0x6(%rdi)
+  803352:	80 00 00             	addb   $0x0,(%rax)
+  803355:	00 00                	add    %al,(%rax)
+  803357:	00 4f 06             	add    %cl,0x6(%rdi)
+  80335a:	80 00 00             	addb   $0x0,(%rax)
+  80335d:	00 00                	add    %al,(%rax)
+  80335f:	00 4f 06             	add    %cl,0x6(%rdi)
+  803362:	80 00 00             	addb   $0x0,(%rax)
+  803365:	00 00                	add    %al,(%rax)
+  803367:	00 4f 06             	add    %cl,0x6(%rdi)
+  80336a:	80 00 00             	addb   $0x0,(%rax)
+  80336d:	00 00                	add    %al,(%rax)
+  80336f:	00 4f 06             	add    %cl,0x6(%rdi)
+  803372:	80 00 00             	addb   $0x0,(%rax)
+  803375:	00 00                	add    %al,(%rax)
+  803377:	00 4f 06             	add    %cl,0x6(%rdi)
+  80337a:	80 00 00             	addb   $0x0,(%rax)
+  80337d:	00 00                	add    %al,(%rax)
+  80337f:	00 4f 06             	add    %cl,0x6(%rdi)
+  803382:	80 00 00             	addb   $0x0,(%rax)
+  803385:	00 00                	add    %al,(%rax)
+  803387:	00 4f 06             	add    %cl,0x6(%rdi)
+  80338a:	80 00 00             	addb   $0x0,(%rax)
+  80338d:	00 00                	add    %al,(%rax)
+  80338f:	00 4f 06             	add    %cl,0x6(%rdi)
+  803392:	80 00 00             	addb   $0x0,(%rax)
+  803395:	00 00                	add    %al,(%rax)
+  803397:	00 37                	add    %dh,(%rdi)
+  803399:	0c 80                	or     $0x80,%al
+  80339b:	00 00                	add    %al,(%rax)
+  80339d:	00 00                	add    %al,(%rax)
+  80339f:	00 37                	add    %dh,(%rdi)
+  8033a1:	0c 80                	or     $0x80,%al
+  8033a3:	00 00                	add    %al,(%rax)
+  8033a5:	00 00                	add    %al,(%rax)
+  8033a7:	00 37                	add    %dh,(%rdi)
+  8033a9:	0c 80                	or     $0x80,%al
+  8033ab:	00 00                	add    %al,(%rax)
+  8033ad:	00 00                	add    %al,(%rax)
+  8033af:	00 37                	add    %dh,(%rdi)
+  8033b1:	0c 80                	or     $0x80,%al
+  8033b3:	00 00                	add    %al,(%rax)
+  8033b5:	00 00                	add    %al,(%rax)
+  8033b7:	00 37                	add    %dh,(%rdi)
+  8033b9:	0c 80                	or     $0x80,%al
+  8033bb:	00 00                	add    %al,(%rax)
+  8033bd:	00 00                	add    %al,(%rax)
+  8033bf:	00 37                	add    %dh,(%rdi)
+  8033c1:	0c 80                	or     $0x80,%al
+  8033c3:	00 00                	add    %al,(%rax)
+  8033c5:	00 00                	add    %al,(%rax)
+  8033c7:	00 37                	add    %dh,(%rdi)
+  8033c9:	0c 80                	or     $0x80,%al
+  8033cb:	00 00                	add    %al,(%rax)
+  8033cd:	00 00                	add    %al,(%rax)
+  8033cf:	00 37                	add    %dh,(%rdi)
+  8033d1:	0c 80                	or     $0x80,%al
+  8033d3:	00 00                	add    %al,(%rax)
+  8033d5:	00 00                	add    %al,(%rax)
+  8033d7:	00 37                	add    %dh,(%rdi)
+  8033d9:	0c 80                	or     $0x80,%al
+  8033db:	00 00                	add    %al,(%rax)
+  8033dd:	00 00                	add    %al,(%rax)
+  8033df:	00 37                	add    %dh,(%rdi)
+  8033e1:	0c 80                	or     $0x80,%al
+  8033e3:	00 00                	add    %al,(%rax)
+  8033e5:	00 00                	add    %al,(%rax)
+  8033e7:	00 37                	add    %dh,(%rdi)
+  8033e9:	0c 80                	or     $0x80,%al
+  8033eb:	00 00                	add    %al,(%rax)
+  8033ed:	00 00                	add    %al,(%rax)
+  8033ef:	00 37                	add    %dh,(%rdi)
+  8033f1:	0c 80                	or     $0x80,%al
+  8033f3:	00 00                	add    %al,(%rax)
+  8033f5:	00 00                	add    %al,(%rax)
+  8033f7:	00 37                	add    %dh,(%rdi)
+  8033f9:	0c 80                	or     $0x80,%al
+  8033fb:	00 00                	add    %al,(%rax)
+  8033fd:	00 00                	add    %al,(%rax)
+  8033ff:	00 37                	add    %dh,(%rdi)
+  803401:	0c 80                	or     $0x80,%al
+  803403:	00 00                	add    %al,(%rax)
+  803405:	00 00                	add    %al,(%rax)
+  803407:	00 37                	add    %dh,(%rdi)
+  803409:	0c 80                	or     $0x80,%al
+  80340b:	00 00                	add    %al,(%rax)
+  80340d:	00 00                	add    %al,(%rax)
+  80340f:	00 37                	add    %dh,(%rdi)
+  803411:	0c 80                	or     $0x80,%al
+  803413:	00 00                	add    %al,(%rax)
+  803415:	00 00                	add    %al,(%rax)
+  803417:	00 37                	add    %dh,(%rdi)
+  803419:	0c 80                	or     $0x80,%al
+  80341b:	00 00                	add    %al,(%rax)
+  80341d:	00 00                	add    %al,(%rax)
+  80341f:	00 37                	add    %dh,(%rdi)
+  803421:	0c 80                	or     $0x80,%al
+  803423:	00 00                	add    %al,(%rax)
+  803425:	00 00                	add    %al,(%rax)
+  803427:	00 37                	add    %dh,(%rdi)
+  803429:	0c 80                	or     $0x80,%al
+  80342b:	00 00                	add    %al,(%rax)
+  80342d:	00 00                	add    %al,(%rax)
+  80342f:	00 37                	add    %dh,(%rdi)
+  803431:	0c 80                	or     $0x80,%al
+  803433:	00 00                	add    %al,(%rax)
+  803435:	00 00                	add    %al,(%rax)
+  803437:	00 37                	add    %dh,(%rdi)
+  803439:	0c 80                	or     $0x80,%al
+  80343b:	00 00                	add    %al,(%rax)
+  80343d:	00 00                	add    %al,(%rax)
+  80343f:	00 37                	add    %dh,(%rdi)
+  803441:	0c 80                	or     $0x80,%al
+  803443:	00 00                	add    %al,(%rax)
+  803445:	00 00                	add    %al,(%rax)
+  803447:	00 37                	add    %dh,(%rdi)
+  803449:	0c 80                	or     $0x80,%al
+  80344b:	00 00                	add    %al,(%rax)
+  80344d:	00 00                	add    %al,(%rax)
+  80344f:	00 37                	add    %dh,(%rdi)
+  803451:	0c 80                	or     $0x80,%al
+  803453:	00 00                	add    %al,(%rax)
+  803455:	00 00                	add    %al,(%rax)
+  803457:	00 37                	add    %dh,(%rdi)
+  803459:	0c 80                	or     $0x80,%al
+  80345b:	00 00                	add    %al,(%rax)
+  80345d:	00 00                	add    %al,(%rax)
+  80345f:	00 37                	add    %dh,(%rdi)
+  803461:	0c 80                	or     $0x80,%al
+  803463:	00 00                	add    %al,(%rax)
+  803465:	00 00                	add    %al,(%rax)
+  803467:	00 37                	add    %dh,(%rdi)
+  803469:	0c 80                	or     $0x80,%al
+  80346b:	00 00                	add    %al,(%rax)
+  80346d:	00 00                	add    %al,(%rax)
+  80346f:	00 37                	add    %dh,(%rdi)
+  803471:	0c 80                	or     $0x80,%al
+  803473:	00 00                	add    %al,(%rax)
+  803475:	00 00                	add    %al,(%rax)
+  803477:	00 37                	add    %dh,(%rdi)
+  803479:	0c 80                	or     $0x80,%al
+  80347b:	00 00                	add    %al,(%rax)
+  80347d:	00 00                	add    %al,(%rax)
+  80347f:	00 37                	add    %dh,(%rdi)
+  803481:	0c 80                	or     $0x80,%al
+  803483:	00 00                	add    %al,(%rax)
+  803485:	00 00                	add    %al,(%rax)
+  803487:	00 5a 0b             	add    %bl,0xb(%rdx)
+  80348a:	80 00 00             	addb   $0x0,(%rax)
+  80348d:	00 00                	add    %al,(%rax)
+  80348f:	00 37                	add    %dh,(%rdi)
+  803491:	0c 80                	or     $0x80,%al
+  803493:	00 00                	add    %al,(%rax)
+  803495:	00 00                	add    %al,(%rax)
+  803497:	00 37                	add    %dh,(%rdi)
+  803499:	0c 80                	or     $0x80,%al
+  80349b:	00 00                	add    %al,(%rax)
+  80349d:	00 00                	add    %al,(%rax)
+  80349f:	00 37                	add    %dh,(%rdi)
+  8034a1:	0c 80                	or     $0x80,%al
+  8034a3:	00 00                	add    %al,(%rax)
+  8034a5:	00 00                	add    %al,(%rax)
+  8034a7:	00 37                	add    %dh,(%rdi)
+  8034a9:	0c 80                	or     $0x80,%al
+  8034ab:	00 00                	add    %al,(%rax)
+  8034ad:	00 00                	add    %al,(%rax)
+  8034af:	00 37                	add    %dh,(%rdi)
+  8034b1:	0c 80                	or     $0x80,%al
+  8034b3:	00 00                	add    %al,(%rax)
+  8034b5:	00 00                	add    %al,(%rax)
+  8034b7:	00 37                	add    %dh,(%rdi)
+  8034b9:	0c 80                	or     $0x80,%al
+  8034bb:	00 00                	add    %al,(%rax)
+  8034bd:	00 00                	add    %al,(%rax)
+  8034bf:	00 37                	add    %dh,(%rdi)
+  8034c1:	0c 80                	or     $0x80,%al
+  8034c3:	00 00                	add    %al,(%rax)
+  8034c5:	00 00                	add    %al,(%rax)
+  8034c7:	00 37                	add    %dh,(%rdi)
+  8034c9:	0c 80                	or     $0x80,%al
+  8034cb:	00 00                	add    %al,(%rax)
+  8034cd:	00 00                	add    %al,(%rax)
+  8034cf:	00 37                	add    %dh,(%rdi)
+  8034d1:	0c 80                	or     $0x80,%al
+  8034d3:	00 00                	add    %al,(%rax)
+  8034d5:	00 00                	add    %al,(%rax)
+  8034d7:	00 37                	add    %dh,(%rdi)
+  8034d9:	0c 80                	or     $0x80,%al
+  8034db:	00 00                	add    %al,(%rax)
+  8034dd:	00 00                	add    %al,(%rax)
+  8034df:	00 a6 06 80 00 00    	add    %ah,0x8006(%rsi)
+  8034e5:	00 00                	add    %al,(%rax)
+  8034e7:	00 75 08             	add    %dh,0x8(%rbp)
+  8034ea:	80 00 00             	addb   $0x0,(%rax)
+  8034ed:	00 00                	add    %al,(%rax)
+  8034ef:	00 37                	add    %dh,(%rdi)
+  8034f1:	0c 80                	or     $0x80,%al
+  8034f3:	00 00                	add    %al,(%rax)
+  8034f5:	00 00                	add    %al,(%rax)
+  8034f7:	00 37                	add    %dh,(%rdi)
+  8034f9:	0c 80                	or     $0x80,%al
+  8034fb:	00 00                	add    %al,(%rax)
+  8034fd:	00 00                	add    %al,(%rax)
+  8034ff:	00 37                	add    %dh,(%rdi)
+  803501:	0c 80                	or     $0x80,%al
+  803503:	00 00                	add    %al,(%rax)
+  803505:	00 00                	add    %al,(%rax)
+  803507:	00 37                	add    %dh,(%rdi)
+  803509:	0c 80                	or     $0x80,%al
+  80350b:	00 00                	add    %al,(%rax)
+  80350d:	00 00                	add    %al,(%rax)
+  80350f:	00 d5                	add    %dl,%ch
+  803511:	06                   	(bad)
+  803512:	80 00 00             	addb   $0x0,(%rax)
+  803515:	00 00                	add    %al,(%rax)
+  803517:	00 37                	add    %dh,(%rdi)
+  803519:	0c 80                	or     $0x80,%al
+  80351b:	00 00                	add    %al,(%rax)
+  80351d:	00 00                	add    %al,(%rax)
+  80351f:	00 37                	add    %dh,(%rdi)
+  803521:	0c 80                	or     $0x80,%al
+  803523:	00 00                	add    %al,(%rax)
+  803525:	00 00                	add    %al,(%rax)
+  803527:	00 9b 06 80 00 00    	add    %bl,0x8006(%rbx)
+  80352d:	00 00                	add    %al,(%rax)
+  80352f:	00 37                	add    %dh,(%rdi)
+  803531:	0c 80                	or     $0x80,%al
+  803533:	00 00                	add    %al,(%rax)
+  803535:	00 00                	add    %al,(%rax)
+  803537:	00 37                	add    %dh,(%rdi)
+  803539:	0c 80                	or     $0x80,%al
+  80353b:	00 00                	add    %al,(%rax)
+  80353d:	00 00                	add    %al,(%rax)
+  80353f:	00 1d 0a 80 00 00    	add    %bl,0x800a(%rip)        # 80b54f <__bss_end+0x354f>
+  803545:	00 00                	add    %al,(%rax)
+  803547:	00 e7                	add    %ah,%bh
+  803549:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80354f:	00 37                	add    %dh,(%rdi)
+  803551:	0c 80                	or     $0x80,%al
+  803553:	00 00                	add    %al,(%rax)
+  803555:	00 00                	add    %al,(%rax)
+  803557:	00 37                	add    %dh,(%rdi)
+  803559:	0c 80                	or     $0x80,%al
+  80355b:	00 00                	add    %al,(%rax)
+  80355d:	00 00                	add    %al,(%rax)
+  80355f:	00 6c 07 80          	add    %ch,-0x80(%rdi,%rax,1)
+  803563:	00 00                	add    %al,(%rax)
+  803565:	00 00                	add    %al,(%rax)
+  803567:	00 37                	add    %dh,(%rdi)
+  803569:	0c 80                	or     $0x80,%al
+  80356b:	00 00                	add    %al,(%rax)
+  80356d:	00 00                	add    %al,(%rax)
+  80356f:	00 49 09             	add    %cl,0x9(%rcx)
+  803572:	80 00 00             	addb   $0x0,(%rax)
+  803575:	00 00                	add    %al,(%rax)
+  803577:	00 37                	add    %dh,(%rdi)
+  803579:	0c 80                	or     $0x80,%al
+  80357b:	00 00                	add    %al,(%rax)
+  80357d:	00 00                	add    %al,(%rax)
+  80357f:	00 37                	add    %dh,(%rdi)
+  803581:	0c 80                	or     $0x80,%al
+  803583:	00 00                	add    %al,(%rax)
+  803585:	00 00                	add    %al,(%rax)
+  803587:	00 5a 0b             	add    %bl,0xb(%rdx)
+  80358a:	80 00 00             	addb   $0x0,(%rax)
+  80358d:	00 00                	add    %al,(%rax)
+  80358f:	00 37                	add    %dh,(%rdi)
+  803591:	0c 80                	or     $0x80,%al
+  803593:	00 00                	add    %al,(%rax)
+  803595:	00 00                	add    %al,(%rax)
+  803597:	00 ff                	add    %bh,%bh
+  803599:	05 80 00 00 00       	add    $0x80,%eax
+	...
+
+00000000008035a0 <error_string>:
+	...
+  8035a8:	4d 31 80 00 00 00 00 00 5f 31 80 00 00 00 00 00     M1......_1......
+  8035b8:	6f 31 80 00 00 00 00 00 81 31 80 00 00 00 00 00     o1.......1......
+  8035c8:	8f 31 80 00 00 00 00 00 a3 31 80 00 00 00 00 00     .1.......1......
+  8035d8:	b8 31 80 00 00 00 00 00 cb 31 80 00 00 00 00 00     .1.......1......
+  8035e8:	dd 31 80 00 00 00 00 00 f1 31 80 00 00 00 00 00     .1.......1......
+  8035f8:	01 32 80 00 00 00 00 00 14 32 80 00 00 00 00 00     .2.......2......
+  803608:	2b 32 80 00 00 00 00 00 41 32 80 00 00 00 00 00     +2......A2......
+  803618:	59 32 80 00 00 00 00 00 71 32 80 00 00 00 00 00     Y2......q2......
+  803628:	7e 32 80 00 00 00 00 00 50 36 80 00 00 00 00 00     ~2......P6......
+  803638:	92 32 80 00 00 00 00 00 aa 32 80 00 00 00 00 00     .2.......2......
+  803648:	c0 32 80 00 00 00 00 00 66 69 6c 65 20 69 73 20     .2......file is 
+  803658:	6e 6f 74 20 61 20 76 61 6c 69 64 20 65 78 65 63     not a valid exec
+  803668:	75 74 61 62 6c 65 00 90 73 79 73 63 61 6c 6c 20     utable..syscall 
+  803678:	25 7a 64 20 72 65 74 75 72 6e 65 64 20 25 7a 64     %zd returned %zd
+  803688:	20 28 3e 20 30 29 00 6c 69 62 2f 73 79 73 63 61      (> 0).lib/sysca
+  803698:	6c 6c 2e 63 00 46 6f 72 6b 20 64 6f 75 62 6c 65     ll.c.Fork double
+  8036a8:	20 66 61 75 6c 74 00 6c 69 62 2f 66 6f 72 6b 2e      fault.lib/fork.
+  8036b8:	63 00 73 66 6f 72 6b 28 29 20 69 73 20 6e 6f 74     c.sfork() is not
+  8036c8:	20 69 6d 70 6c 65 6d 65 6e 74 65 64 00 0f 1f 00      implemented....
+  8036d8:	5b 25 30 38 78 5d 20 75 6e 6b 6e 6f 77 6e 20 64     [%08x] unknown d
+  8036e8:	65 76 69 63 65 20 74 79 70 65 20 25 64 0a 00 00     evice type %d...
+  8036f8:	5b 25 30 38 78 5d 20 66 74 72 75 6e 63 61 74 65     [%08x] ftruncate
+  803708:	20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65 0a      %d -- bad mode.
+  803718:	00 5b 25 30 38 78 5d 20 72 65 61 64 20 25 64 20     .[%08x] read %d 
+  803728:	2d 2d 20 62 61 64 20 6d 6f 64 65 0a 00 5b 25 30     -- bad mode..[%0
+  803738:	38 78 5d 20 77 72 69 74 65 20 25 64 20 2d 2d 20     8x] write %d -- 
+  803748:	62 61 64 20 6d 6f 64 65 0a 00 66 2e 0f 1f 84 00     bad mode..f.....
+  803758:	00 00 00 00 0f 1f 40 00                             ......@.
+
+0000000000803760 <devtab>:
+  803760:	20 40 80 00 00 00 00 00 60 40 80 00 00 00 00 00      @......`@......
+  803770:	a0 40 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .@..............
+  803780:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  803790:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  8037a0:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  8037b0:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  8037c0:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  8037d0:	3d 20 32 00 65 6e 76 69 64 20 21 3d 20 30 00 6c     = 2.envid != 0.l
+  8037e0:	69 62 2f 77 61 69 74 2e 63 00 3c 63 6f 6e 73 3e     ib/wait.c.<cons>
+  8037f0:	00 63 6f 6e 73 00 73 79 73 5f 69 70 63 5f 74 72     .cons.sys_ipc_tr
+  803800:	79 5f 73 65 6e 64 20 66 61 69 6c 65 64 3a 20 25     y_send failed: %
+  803810:	69 00 6c 69 62 2f 69 70 63 2e 63 00 66 2e 0f 1f     i.lib/ipc.c.f...
+  803820:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803830:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803840:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803850:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803860:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803870:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803880:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803890:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8038a0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8038b0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8038c0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8038d0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8038e0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8038f0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803900:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803910:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803920:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803930:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803940:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803950:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803960:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803970:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803980:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803990:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8039a0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8039b0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8039c0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8039d0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8039e0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8039f0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803a00:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803a10:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803a20:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803a30:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803a40:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803a50:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803a60:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803a70:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803a80:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803a90:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803aa0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803ab0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803ac0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803ad0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803ae0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803af0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803b00:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803b10:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803b20:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803b30:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803b40:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803b50:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803b60:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803b70:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803b80:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803b90:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803ba0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803bb0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803bc0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803bd0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803be0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803bf0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803c00:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803c10:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803c20:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803c30:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803c40:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803c50:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803c60:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803c70:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803c80:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803c90:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803ca0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803cb0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803cc0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803cd0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803ce0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803cf0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803d00:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803d10:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803d20:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803d30:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803d40:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803d50:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803d60:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803d70:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803d80:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803d90:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803da0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803db0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803dc0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803dd0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803de0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803df0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803e00:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803e10:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803e20:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803e30:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803e40:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803e50:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803e60:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803e70:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803e80:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803e90:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803ea0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803eb0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803ec0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803ed0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803ee0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803ef0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803f00:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803f10:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803f20:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803f30:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803f40:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803f50:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803f60:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803f70:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803f80:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803f90:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803fa0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803fb0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803fc0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803fd0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803fe0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803ff0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
@@ -0,0 +1,5727 @@
+
+obj/user/hello:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 4d 00 00 00       	call   800070 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+/* hello, world */
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	53                   	push   %rbx
+  80002a:	48 83 ec 08          	sub    $0x8,%rsp
+    cprintf("hello, world\n");
+  80002e:	48 bf c0 2c 80 00 00 	movabs $0x802cc0,%rdi
+  800035:	00 00 00 
+  800038:	b8 00 00 00 00       	mov    $0x0,%eax
+  80003d:	48 bb e9 01 80 00 00 	movabs $0x8001e9,%rbx
+  800044:	00 00 00 
+  800047:	ff d3                	call   *%rbx
+    cprintf("i am environment %08x\n", thisenv->env_id);
+  800049:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  800050:	00 00 00 
+  800053:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+  800059:	48 bf ce 2c 80 00 00 	movabs $0x802cce,%rdi
+  800060:	00 00 00 
+  800063:	b8 00 00 00 00       	mov    $0x0,%eax
+  800068:	ff d3                	call   *%rbx
+}
+  80006a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80006e:	c9                   	leave
+  80006f:	c3                   	ret
+
+0000000000800070 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800070:	55                   	push   %rbp
+  800071:	48 89 e5             	mov    %rsp,%rbp
+  800074:	41 56                	push   %r14
+  800076:	41 55                	push   %r13
+  800078:	41 54                	push   %r12
+  80007a:	53                   	push   %rbx
+  80007b:	41 89 fd             	mov    %edi,%r13d
+  80007e:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800081:	48 ba d8 40 80 00 00 	movabs $0x8040d8,%rdx
+  800088:	00 00 00 
+  80008b:	48 b8 d8 40 80 00 00 	movabs $0x8040d8,%rax
+  800092:	00 00 00 
+  800095:	48 39 c2             	cmp    %rax,%rdx
+  800098:	73 17                	jae    8000b1 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  80009a:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  80009d:	49 89 c4             	mov    %rax,%r12
+  8000a0:	48 83 c3 08          	add    $0x8,%rbx
+  8000a4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000a9:	ff 53 f8             	call   *-0x8(%rbx)
+  8000ac:	4c 39 e3             	cmp    %r12,%rbx
+  8000af:	72 ef                	jb     8000a0 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+    envid_t this_env_id = sys_getenvid();
+  8000b1:	48 b8 fe 0f 80 00 00 	movabs $0x800ffe,%rax
+  8000b8:	00 00 00 
+  8000bb:	ff d0                	call   *%rax
+    thisenv = &((struct Env*)UENVS)[ENVX(this_env_id)];
+  8000bd:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8000c2:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+  8000c9:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8000d0:	00 00 00 
+  8000d3:	48 01 d0             	add    %rdx,%rax
+  8000d6:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  8000dd:	00 00 00 
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8000e0:	45 85 ed             	test   %r13d,%r13d
+  8000e3:	7e 0d                	jle    8000f2 <libmain+0x82>
+  8000e5:	49 8b 06             	mov    (%r14),%rax
+  8000e8:	48 a3 00 40 80 00 00 	movabs %rax,0x804000
+  8000ef:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8000f2:	4c 89 f6             	mov    %r14,%rsi
+  8000f5:	44 89 ef             	mov    %r13d,%edi
+  8000f8:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8000ff:	00 00 00 
+  800102:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  800104:	48 b8 19 01 80 00 00 	movabs $0x800119,%rax
+  80010b:	00 00 00 
+  80010e:	ff d0                	call   *%rax
+#endif
+}
+  800110:	5b                   	pop    %rbx
+  800111:	41 5c                	pop    %r12
+  800113:	41 5d                	pop    %r13
+  800115:	41 5e                	pop    %r14
+  800117:	5d                   	pop    %rbp
+  800118:	c3                   	ret
+
+0000000000800119 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  800119:	55                   	push   %rbp
+  80011a:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  80011d:	48 b8 52 17 80 00 00 	movabs $0x801752,%rax
+  800124:	00 00 00 
+  800127:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  800129:	bf 00 00 00 00       	mov    $0x0,%edi
+  80012e:	48 b8 93 0f 80 00 00 	movabs $0x800f93,%rax
+  800135:	00 00 00 
+  800138:	ff d0                	call   *%rax
+}
+  80013a:	5d                   	pop    %rbp
+  80013b:	c3                   	ret
+
+000000000080013c <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  80013c:	55                   	push   %rbp
+  80013d:	48 89 e5             	mov    %rsp,%rbp
+  800140:	53                   	push   %rbx
+  800141:	48 83 ec 08          	sub    $0x8,%rsp
+  800145:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  800148:	8b 06                	mov    (%rsi),%eax
+  80014a:	8d 50 01             	lea    0x1(%rax),%edx
+  80014d:	89 16                	mov    %edx,(%rsi)
+  80014f:	48 98                	cltq
+  800151:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  800156:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  80015c:	74 0a                	je     800168 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  80015e:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  800162:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800166:	c9                   	leave
+  800167:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  800168:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  80016c:	be ff 00 00 00       	mov    $0xff,%esi
+  800171:	48 b8 35 0f 80 00 00 	movabs $0x800f35,%rax
+  800178:	00 00 00 
+  80017b:	ff d0                	call   *%rax
+        state->offset = 0;
+  80017d:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  800183:	eb d9                	jmp    80015e <putch+0x22>
+
+0000000000800185 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  800185:	55                   	push   %rbp
+  800186:	48 89 e5             	mov    %rsp,%rbp
+  800189:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  800190:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  800193:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  80019a:	b9 21 00 00 00       	mov    $0x21,%ecx
+  80019f:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001a4:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  8001a7:	48 89 f1             	mov    %rsi,%rcx
+  8001aa:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  8001b1:	48 bf 3c 01 80 00 00 	movabs $0x80013c,%rdi
+  8001b8:	00 00 00 
+  8001bb:	48 b8 39 03 80 00 00 	movabs $0x800339,%rax
+  8001c2:	00 00 00 
+  8001c5:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  8001c7:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  8001ce:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  8001d5:	48 b8 35 0f 80 00 00 	movabs $0x800f35,%rax
+  8001dc:	00 00 00 
+  8001df:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  8001e1:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  8001e7:	c9                   	leave
+  8001e8:	c3                   	ret
+
+00000000008001e9 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  8001e9:	55                   	push   %rbp
+  8001ea:	48 89 e5             	mov    %rsp,%rbp
+  8001ed:	48 83 ec 50          	sub    $0x50,%rsp
+  8001f1:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8001f5:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8001f9:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8001fd:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800201:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  800205:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  80020c:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800210:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800214:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800218:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  80021c:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  800220:	48 b8 85 01 80 00 00 	movabs $0x800185,%rax
+  800227:	00 00 00 
+  80022a:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  80022c:	c9                   	leave
+  80022d:	c3                   	ret
+
+000000000080022e <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  80022e:	55                   	push   %rbp
+  80022f:	48 89 e5             	mov    %rsp,%rbp
+  800232:	41 57                	push   %r15
+  800234:	41 56                	push   %r14
+  800236:	41 55                	push   %r13
+  800238:	41 54                	push   %r12
+  80023a:	53                   	push   %rbx
+  80023b:	48 83 ec 18          	sub    $0x18,%rsp
+  80023f:	49 89 fc             	mov    %rdi,%r12
+  800242:	49 89 f5             	mov    %rsi,%r13
+  800245:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800249:	8b 45 10             	mov    0x10(%rbp),%eax
+  80024c:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  80024f:	41 89 cf             	mov    %ecx,%r15d
+  800252:	4c 39 fa             	cmp    %r15,%rdx
+  800255:	73 5b                	jae    8002b2 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  800257:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  80025b:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  80025f:	85 db                	test   %ebx,%ebx
+  800261:	7e 0e                	jle    800271 <print_num+0x43>
+            putch(padc, put_arg);
+  800263:	4c 89 ee             	mov    %r13,%rsi
+  800266:	44 89 f7             	mov    %r14d,%edi
+  800269:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  80026c:	83 eb 01             	sub    $0x1,%ebx
+  80026f:	75 f2                	jne    800263 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  800271:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  800275:	48 b9 00 2d 80 00 00 	movabs $0x802d00,%rcx
+  80027c:	00 00 00 
+  80027f:	48 b8 ef 2c 80 00 00 	movabs $0x802cef,%rax
+  800286:	00 00 00 
+  800289:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  80028d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800291:	ba 00 00 00 00       	mov    $0x0,%edx
+  800296:	49 f7 f7             	div    %r15
+  800299:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  80029d:	4c 89 ee             	mov    %r13,%rsi
+  8002a0:	41 ff d4             	call   *%r12
+}
+  8002a3:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8002a7:	5b                   	pop    %rbx
+  8002a8:	41 5c                	pop    %r12
+  8002aa:	41 5d                	pop    %r13
+  8002ac:	41 5e                	pop    %r14
+  8002ae:	41 5f                	pop    %r15
+  8002b0:	5d                   	pop    %rbp
+  8002b1:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  8002b2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8002b6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8002bb:	49 f7 f7             	div    %r15
+  8002be:	48 83 ec 08          	sub    $0x8,%rsp
+  8002c2:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  8002c6:	52                   	push   %rdx
+  8002c7:	45 0f be c9          	movsbl %r9b,%r9d
+  8002cb:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  8002cf:	48 89 c2             	mov    %rax,%rdx
+  8002d2:	48 b8 2e 02 80 00 00 	movabs $0x80022e,%rax
+  8002d9:	00 00 00 
+  8002dc:	ff d0                	call   *%rax
+  8002de:	48 83 c4 10          	add    $0x10,%rsp
+  8002e2:	eb 8d                	jmp    800271 <print_num+0x43>
+
+00000000008002e4 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  8002e4:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  8002e8:	48 8b 06             	mov    (%rsi),%rax
+  8002eb:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  8002ef:	73 0a                	jae    8002fb <sprintputch+0x17>
+        *state->start++ = ch;
+  8002f1:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8002f5:	48 89 16             	mov    %rdx,(%rsi)
+  8002f8:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  8002fb:	c3                   	ret
+
+00000000008002fc <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  8002fc:	55                   	push   %rbp
+  8002fd:	48 89 e5             	mov    %rsp,%rbp
+  800300:	48 83 ec 50          	sub    $0x50,%rsp
+  800304:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800308:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80030c:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  800310:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800317:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80031b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80031f:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800323:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  800327:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80032b:	48 b8 39 03 80 00 00 	movabs $0x800339,%rax
+  800332:	00 00 00 
+  800335:	ff d0                	call   *%rax
+}
+  800337:	c9                   	leave
+  800338:	c3                   	ret
+
+0000000000800339 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  800339:	55                   	push   %rbp
+  80033a:	48 89 e5             	mov    %rsp,%rbp
+  80033d:	41 57                	push   %r15
+  80033f:	41 56                	push   %r14
+  800341:	41 55                	push   %r13
+  800343:	41 54                	push   %r12
+  800345:	53                   	push   %rbx
+  800346:	48 83 ec 38          	sub    $0x38,%rsp
+  80034a:	49 89 fe             	mov    %rdi,%r14
+  80034d:	49 89 f5             	mov    %rsi,%r13
+  800350:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  800353:	48 8b 01             	mov    (%rcx),%rax
+  800356:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  80035a:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  80035e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800362:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  800366:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  80036a:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  80036e:	0f b6 3b             	movzbl (%rbx),%edi
+  800371:	40 80 ff 25          	cmp    $0x25,%dil
+  800375:	74 18                	je     80038f <vprintfmt+0x56>
+            if (!ch) return;
+  800377:	40 84 ff             	test   %dil,%dil
+  80037a:	0f 84 b1 06 00 00    	je     800a31 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  800380:	40 0f b6 ff          	movzbl %dil,%edi
+  800384:	4c 89 ee             	mov    %r13,%rsi
+  800387:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  80038a:	4c 89 e3             	mov    %r12,%rbx
+  80038d:	eb db                	jmp    80036a <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  80038f:	be 00 00 00 00       	mov    $0x0,%esi
+  800394:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  800398:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  80039d:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8003a3:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  8003aa:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8003ae:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  8003b3:	41 0f b6 04 24       	movzbl (%r12),%eax
+  8003b8:	88 45 a0             	mov    %al,-0x60(%rbp)
+  8003bb:	83 e8 23             	sub    $0x23,%eax
+  8003be:	3c 57                	cmp    $0x57,%al
+  8003c0:	0f 87 51 06 00 00    	ja     800a17 <vprintfmt+0x6de>
+  8003c6:	0f b6 c0             	movzbl %al,%eax
+  8003c9:	48 b9 c0 2e 80 00 00 	movabs $0x802ec0,%rcx
+  8003d0:	00 00 00 
+  8003d3:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  8003d6:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  8003d9:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  8003dd:	eb cf                	jmp    8003ae <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  8003df:	49 89 dc             	mov    %rbx,%r12
+  8003e2:	be 01 00 00 00       	mov    $0x1,%esi
+  8003e7:	eb c5                	jmp    8003ae <vprintfmt+0x75>
+            padc = ch;
+  8003e9:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  8003ed:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8003f0:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8003f3:	eb b9                	jmp    8003ae <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8003f5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8003f8:	83 f8 2f             	cmp    $0x2f,%eax
+  8003fb:	77 24                	ja     800421 <vprintfmt+0xe8>
+  8003fd:	89 c1                	mov    %eax,%ecx
+  8003ff:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  800403:	83 c0 08             	add    $0x8,%eax
+  800406:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800409:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  80040c:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  80040f:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800413:	79 99                	jns    8003ae <vprintfmt+0x75>
+                width = precision;
+  800415:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  800419:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  80041f:	eb 8d                	jmp    8003ae <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800421:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  800425:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  800429:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80042d:	eb da                	jmp    800409 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  80042f:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  800434:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800438:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  80043e:	3c 39                	cmp    $0x39,%al
+  800440:	77 1c                	ja     80045e <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  800442:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  800446:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  80044a:	0f b6 c0             	movzbl %al,%eax
+  80044d:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800452:	0f b6 03             	movzbl (%rbx),%eax
+  800455:	3c 39                	cmp    $0x39,%al
+  800457:	76 e9                	jbe    800442 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  800459:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  80045c:	eb b1                	jmp    80040f <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  80045e:	49 89 dc             	mov    %rbx,%r12
+  800461:	eb ac                	jmp    80040f <vprintfmt+0xd6>
+            width = MAX(0, width);
+  800463:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  800466:	85 c9                	test   %ecx,%ecx
+  800468:	b8 00 00 00 00       	mov    $0x0,%eax
+  80046d:	0f 49 c1             	cmovns %ecx,%eax
+  800470:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  800473:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800476:	e9 33 ff ff ff       	jmp    8003ae <vprintfmt+0x75>
+            lflag++;
+  80047b:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  80047e:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800481:	e9 28 ff ff ff       	jmp    8003ae <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  800486:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800489:	83 f8 2f             	cmp    $0x2f,%eax
+  80048c:	77 19                	ja     8004a7 <vprintfmt+0x16e>
+  80048e:	89 c2                	mov    %eax,%edx
+  800490:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800494:	83 c0 08             	add    $0x8,%eax
+  800497:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80049a:	8b 3a                	mov    (%rdx),%edi
+  80049c:	4c 89 ee             	mov    %r13,%rsi
+  80049f:	41 ff d6             	call   *%r14
+            break;
+  8004a2:	e9 c3 fe ff ff       	jmp    80036a <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  8004a7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8004ab:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8004af:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8004b3:	eb e5                	jmp    80049a <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  8004b5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8004b8:	83 f8 2f             	cmp    $0x2f,%eax
+  8004bb:	77 5a                	ja     800517 <vprintfmt+0x1de>
+  8004bd:	89 c2                	mov    %eax,%edx
+  8004bf:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8004c3:	83 c0 08             	add    $0x8,%eax
+  8004c6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  8004c9:	8b 02                	mov    (%rdx),%eax
+  8004cb:	89 c1                	mov    %eax,%ecx
+  8004cd:	f7 d9                	neg    %ecx
+  8004cf:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  8004d2:	83 f9 15             	cmp    $0x15,%ecx
+  8004d5:	7f 4e                	jg     800525 <vprintfmt+0x1ec>
+  8004d7:	48 63 c1             	movslq %ecx,%rax
+  8004da:	48 ba 80 31 80 00 00 	movabs $0x803180,%rdx
+  8004e1:	00 00 00 
+  8004e4:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8004e8:	48 85 c0             	test   %rax,%rax
+  8004eb:	74 38                	je     800525 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  8004ed:	48 89 c1             	mov    %rax,%rcx
+  8004f0:	48 ba 39 33 80 00 00 	movabs $0x803339,%rdx
+  8004f7:	00 00 00 
+  8004fa:	4c 89 ee             	mov    %r13,%rsi
+  8004fd:	4c 89 f7             	mov    %r14,%rdi
+  800500:	b8 00 00 00 00       	mov    $0x0,%eax
+  800505:	49 b8 fc 02 80 00 00 	movabs $0x8002fc,%r8
+  80050c:	00 00 00 
+  80050f:	41 ff d0             	call   *%r8
+  800512:	e9 53 fe ff ff       	jmp    80036a <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  800517:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80051b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80051f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800523:	eb a4                	jmp    8004c9 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  800525:	48 ba 18 2d 80 00 00 	movabs $0x802d18,%rdx
+  80052c:	00 00 00 
+  80052f:	4c 89 ee             	mov    %r13,%rsi
+  800532:	4c 89 f7             	mov    %r14,%rdi
+  800535:	b8 00 00 00 00       	mov    $0x0,%eax
+  80053a:	49 b8 fc 02 80 00 00 	movabs $0x8002fc,%r8
+  800541:	00 00 00 
+  800544:	41 ff d0             	call   *%r8
+  800547:	e9 1e fe ff ff       	jmp    80036a <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  80054c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80054f:	83 f8 2f             	cmp    $0x2f,%eax
+  800552:	77 6c                	ja     8005c0 <vprintfmt+0x287>
+  800554:	89 c2                	mov    %eax,%edx
+  800556:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80055a:	83 c0 08             	add    $0x8,%eax
+  80055d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800560:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  800563:	48 85 d2             	test   %rdx,%rdx
+  800566:	48 b8 11 2d 80 00 00 	movabs $0x802d11,%rax
+  80056d:	00 00 00 
+  800570:	48 0f 45 c2          	cmovne %rdx,%rax
+  800574:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  800578:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  80057c:	7e 06                	jle    800584 <vprintfmt+0x24b>
+  80057e:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  800582:	75 4a                	jne    8005ce <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800584:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800588:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  80058c:	0f b6 00             	movzbl (%rax),%eax
+  80058f:	84 c0                	test   %al,%al
+  800591:	0f 85 9a 00 00 00    	jne    800631 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  800597:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80059a:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  80059e:	85 c0                	test   %eax,%eax
+  8005a0:	0f 8e c4 fd ff ff    	jle    80036a <vprintfmt+0x31>
+  8005a6:	4c 89 ee             	mov    %r13,%rsi
+  8005a9:	bf 20 00 00 00       	mov    $0x20,%edi
+  8005ae:	41 ff d6             	call   *%r14
+  8005b1:	41 83 ec 01          	sub    $0x1,%r12d
+  8005b5:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  8005b9:	75 eb                	jne    8005a6 <vprintfmt+0x26d>
+  8005bb:	e9 aa fd ff ff       	jmp    80036a <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8005c0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8005c4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8005c8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8005cc:	eb 92                	jmp    800560 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  8005ce:	49 63 f7             	movslq %r15d,%rsi
+  8005d1:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  8005d5:	48 b8 eb 0a 80 00 00 	movabs $0x800aeb,%rax
+  8005dc:	00 00 00 
+  8005df:	ff d0                	call   *%rax
+  8005e1:	48 89 c2             	mov    %rax,%rdx
+  8005e4:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8005e7:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  8005e9:	8d 70 ff             	lea    -0x1(%rax),%esi
+  8005ec:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  8005ef:	85 c0                	test   %eax,%eax
+  8005f1:	7e 91                	jle    800584 <vprintfmt+0x24b>
+  8005f3:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  8005f8:	4c 89 ee             	mov    %r13,%rsi
+  8005fb:	44 89 e7             	mov    %r12d,%edi
+  8005fe:	41 ff d6             	call   *%r14
+  800601:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800605:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800608:	83 f8 ff             	cmp    $0xffffffff,%eax
+  80060b:	75 eb                	jne    8005f8 <vprintfmt+0x2bf>
+  80060d:	e9 72 ff ff ff       	jmp    800584 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800612:	0f b6 f8             	movzbl %al,%edi
+  800615:	4c 89 ee             	mov    %r13,%rsi
+  800618:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  80061b:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  80061f:	49 83 c4 01          	add    $0x1,%r12
+  800623:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  800629:	84 c0                	test   %al,%al
+  80062b:	0f 84 66 ff ff ff    	je     800597 <vprintfmt+0x25e>
+  800631:	45 85 ff             	test   %r15d,%r15d
+  800634:	78 0a                	js     800640 <vprintfmt+0x307>
+  800636:	41 83 ef 01          	sub    $0x1,%r15d
+  80063a:	0f 88 57 ff ff ff    	js     800597 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800640:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  800644:	74 cc                	je     800612 <vprintfmt+0x2d9>
+  800646:	8d 50 e0             	lea    -0x20(%rax),%edx
+  800649:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  80064e:	80 fa 5e             	cmp    $0x5e,%dl
+  800651:	77 c2                	ja     800615 <vprintfmt+0x2dc>
+  800653:	eb bd                	jmp    800612 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  800655:	40 84 f6             	test   %sil,%sil
+  800658:	75 26                	jne    800680 <vprintfmt+0x347>
+    switch (lflag) {
+  80065a:	85 d2                	test   %edx,%edx
+  80065c:	74 59                	je     8006b7 <vprintfmt+0x37e>
+  80065e:	83 fa 01             	cmp    $0x1,%edx
+  800661:	74 7b                	je     8006de <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  800663:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800666:	83 f8 2f             	cmp    $0x2f,%eax
+  800669:	0f 87 96 00 00 00    	ja     800705 <vprintfmt+0x3cc>
+  80066f:	89 c2                	mov    %eax,%edx
+  800671:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800675:	83 c0 08             	add    $0x8,%eax
+  800678:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80067b:	4c 8b 22             	mov    (%rdx),%r12
+  80067e:	eb 17                	jmp    800697 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  800680:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800683:	83 f8 2f             	cmp    $0x2f,%eax
+  800686:	77 21                	ja     8006a9 <vprintfmt+0x370>
+  800688:	89 c2                	mov    %eax,%edx
+  80068a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80068e:	83 c0 08             	add    $0x8,%eax
+  800691:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800694:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  800697:	4d 85 e4             	test   %r12,%r12
+  80069a:	78 7a                	js     800716 <vprintfmt+0x3dd>
+            num = i;
+  80069c:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  80069f:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  8006a4:	e9 50 02 00 00       	jmp    8008f9 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8006a9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8006ad:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006b1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006b5:	eb dd                	jmp    800694 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  8006b7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006ba:	83 f8 2f             	cmp    $0x2f,%eax
+  8006bd:	77 11                	ja     8006d0 <vprintfmt+0x397>
+  8006bf:	89 c2                	mov    %eax,%edx
+  8006c1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8006c5:	83 c0 08             	add    $0x8,%eax
+  8006c8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8006cb:	4c 63 22             	movslq (%rdx),%r12
+  8006ce:	eb c7                	jmp    800697 <vprintfmt+0x35e>
+  8006d0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8006d4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006d8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006dc:	eb ed                	jmp    8006cb <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  8006de:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006e1:	83 f8 2f             	cmp    $0x2f,%eax
+  8006e4:	77 11                	ja     8006f7 <vprintfmt+0x3be>
+  8006e6:	89 c2                	mov    %eax,%edx
+  8006e8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8006ec:	83 c0 08             	add    $0x8,%eax
+  8006ef:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8006f2:	4c 8b 22             	mov    (%rdx),%r12
+  8006f5:	eb a0                	jmp    800697 <vprintfmt+0x35e>
+  8006f7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8006fb:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006ff:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800703:	eb ed                	jmp    8006f2 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  800705:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800709:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80070d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800711:	e9 65 ff ff ff       	jmp    80067b <vprintfmt+0x342>
+                putch('-', put_arg);
+  800716:	4c 89 ee             	mov    %r13,%rsi
+  800719:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  80071e:	41 ff d6             	call   *%r14
+                i = -i;
+  800721:	49 f7 dc             	neg    %r12
+  800724:	e9 73 ff ff ff       	jmp    80069c <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  800729:	40 84 f6             	test   %sil,%sil
+  80072c:	75 32                	jne    800760 <vprintfmt+0x427>
+    switch (lflag) {
+  80072e:	85 d2                	test   %edx,%edx
+  800730:	74 5d                	je     80078f <vprintfmt+0x456>
+  800732:	83 fa 01             	cmp    $0x1,%edx
+  800735:	0f 84 82 00 00 00    	je     8007bd <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  80073b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80073e:	83 f8 2f             	cmp    $0x2f,%eax
+  800741:	0f 87 a5 00 00 00    	ja     8007ec <vprintfmt+0x4b3>
+  800747:	89 c2                	mov    %eax,%edx
+  800749:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80074d:	83 c0 08             	add    $0x8,%eax
+  800750:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800753:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800756:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  80075b:	e9 99 01 00 00       	jmp    8008f9 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800760:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800763:	83 f8 2f             	cmp    $0x2f,%eax
+  800766:	77 19                	ja     800781 <vprintfmt+0x448>
+  800768:	89 c2                	mov    %eax,%edx
+  80076a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80076e:	83 c0 08             	add    $0x8,%eax
+  800771:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800774:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800777:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  80077c:	e9 78 01 00 00       	jmp    8008f9 <vprintfmt+0x5c0>
+  800781:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800785:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800789:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80078d:	eb e5                	jmp    800774 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  80078f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800792:	83 f8 2f             	cmp    $0x2f,%eax
+  800795:	77 18                	ja     8007af <vprintfmt+0x476>
+  800797:	89 c2                	mov    %eax,%edx
+  800799:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80079d:	83 c0 08             	add    $0x8,%eax
+  8007a0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007a3:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  8007a5:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  8007aa:	e9 4a 01 00 00       	jmp    8008f9 <vprintfmt+0x5c0>
+  8007af:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007b3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007b7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007bb:	eb e6                	jmp    8007a3 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  8007bd:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007c0:	83 f8 2f             	cmp    $0x2f,%eax
+  8007c3:	77 19                	ja     8007de <vprintfmt+0x4a5>
+  8007c5:	89 c2                	mov    %eax,%edx
+  8007c7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007cb:	83 c0 08             	add    $0x8,%eax
+  8007ce:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007d1:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8007d4:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  8007d9:	e9 1b 01 00 00       	jmp    8008f9 <vprintfmt+0x5c0>
+  8007de:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007e2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007e6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007ea:	eb e5                	jmp    8007d1 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  8007ec:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007f0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007f4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007f8:	e9 56 ff ff ff       	jmp    800753 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  8007fd:	40 84 f6             	test   %sil,%sil
+  800800:	75 2e                	jne    800830 <vprintfmt+0x4f7>
+    switch (lflag) {
+  800802:	85 d2                	test   %edx,%edx
+  800804:	74 59                	je     80085f <vprintfmt+0x526>
+  800806:	83 fa 01             	cmp    $0x1,%edx
+  800809:	74 7f                	je     80088a <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  80080b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80080e:	83 f8 2f             	cmp    $0x2f,%eax
+  800811:	0f 87 9f 00 00 00    	ja     8008b6 <vprintfmt+0x57d>
+  800817:	89 c2                	mov    %eax,%edx
+  800819:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80081d:	83 c0 08             	add    $0x8,%eax
+  800820:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800823:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800826:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  80082b:	e9 c9 00 00 00       	jmp    8008f9 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800830:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800833:	83 f8 2f             	cmp    $0x2f,%eax
+  800836:	77 19                	ja     800851 <vprintfmt+0x518>
+  800838:	89 c2                	mov    %eax,%edx
+  80083a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80083e:	83 c0 08             	add    $0x8,%eax
+  800841:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800844:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800847:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  80084c:	e9 a8 00 00 00       	jmp    8008f9 <vprintfmt+0x5c0>
+  800851:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800855:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800859:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80085d:	eb e5                	jmp    800844 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  80085f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800862:	83 f8 2f             	cmp    $0x2f,%eax
+  800865:	77 15                	ja     80087c <vprintfmt+0x543>
+  800867:	89 c2                	mov    %eax,%edx
+  800869:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80086d:	83 c0 08             	add    $0x8,%eax
+  800870:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800873:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  800875:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  80087a:	eb 7d                	jmp    8008f9 <vprintfmt+0x5c0>
+  80087c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800880:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800884:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800888:	eb e9                	jmp    800873 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  80088a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80088d:	83 f8 2f             	cmp    $0x2f,%eax
+  800890:	77 16                	ja     8008a8 <vprintfmt+0x56f>
+  800892:	89 c2                	mov    %eax,%edx
+  800894:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800898:	83 c0 08             	add    $0x8,%eax
+  80089b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80089e:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8008a1:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  8008a6:	eb 51                	jmp    8008f9 <vprintfmt+0x5c0>
+  8008a8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008ac:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008b0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008b4:	eb e8                	jmp    80089e <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  8008b6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008ba:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008be:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008c2:	e9 5c ff ff ff       	jmp    800823 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  8008c7:	4c 89 ee             	mov    %r13,%rsi
+  8008ca:	bf 30 00 00 00       	mov    $0x30,%edi
+  8008cf:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  8008d2:	4c 89 ee             	mov    %r13,%rsi
+  8008d5:	bf 78 00 00 00       	mov    $0x78,%edi
+  8008da:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  8008dd:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008e0:	83 f8 2f             	cmp    $0x2f,%eax
+  8008e3:	77 47                	ja     80092c <vprintfmt+0x5f3>
+  8008e5:	89 c2                	mov    %eax,%edx
+  8008e7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008eb:	83 c0 08             	add    $0x8,%eax
+  8008ee:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008f1:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8008f4:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  8008f9:	48 83 ec 08          	sub    $0x8,%rsp
+  8008fd:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800901:	0f 94 c0             	sete   %al
+  800904:	0f b6 c0             	movzbl %al,%eax
+  800907:	50                   	push   %rax
+  800908:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  80090d:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800911:	4c 89 ee             	mov    %r13,%rsi
+  800914:	4c 89 f7             	mov    %r14,%rdi
+  800917:	48 b8 2e 02 80 00 00 	movabs $0x80022e,%rax
+  80091e:	00 00 00 
+  800921:	ff d0                	call   *%rax
+            break;
+  800923:	48 83 c4 10          	add    $0x10,%rsp
+  800927:	e9 3e fa ff ff       	jmp    80036a <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  80092c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800930:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800934:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800938:	eb b7                	jmp    8008f1 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  80093a:	40 84 f6             	test   %sil,%sil
+  80093d:	75 2b                	jne    80096a <vprintfmt+0x631>
+    switch (lflag) {
+  80093f:	85 d2                	test   %edx,%edx
+  800941:	74 56                	je     800999 <vprintfmt+0x660>
+  800943:	83 fa 01             	cmp    $0x1,%edx
+  800946:	74 7f                	je     8009c7 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800948:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80094b:	83 f8 2f             	cmp    $0x2f,%eax
+  80094e:	0f 87 a2 00 00 00    	ja     8009f6 <vprintfmt+0x6bd>
+  800954:	89 c2                	mov    %eax,%edx
+  800956:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80095a:	83 c0 08             	add    $0x8,%eax
+  80095d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800960:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800963:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800968:	eb 8f                	jmp    8008f9 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  80096a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80096d:	83 f8 2f             	cmp    $0x2f,%eax
+  800970:	77 19                	ja     80098b <vprintfmt+0x652>
+  800972:	89 c2                	mov    %eax,%edx
+  800974:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800978:	83 c0 08             	add    $0x8,%eax
+  80097b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80097e:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800981:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800986:	e9 6e ff ff ff       	jmp    8008f9 <vprintfmt+0x5c0>
+  80098b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80098f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800993:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800997:	eb e5                	jmp    80097e <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800999:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80099c:	83 f8 2f             	cmp    $0x2f,%eax
+  80099f:	77 18                	ja     8009b9 <vprintfmt+0x680>
+  8009a1:	89 c2                	mov    %eax,%edx
+  8009a3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009a7:	83 c0 08             	add    $0x8,%eax
+  8009aa:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009ad:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  8009af:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  8009b4:	e9 40 ff ff ff       	jmp    8008f9 <vprintfmt+0x5c0>
+  8009b9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009bd:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009c1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009c5:	eb e6                	jmp    8009ad <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  8009c7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009ca:	83 f8 2f             	cmp    $0x2f,%eax
+  8009cd:	77 19                	ja     8009e8 <vprintfmt+0x6af>
+  8009cf:	89 c2                	mov    %eax,%edx
+  8009d1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009d5:	83 c0 08             	add    $0x8,%eax
+  8009d8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009db:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8009de:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  8009e3:	e9 11 ff ff ff       	jmp    8008f9 <vprintfmt+0x5c0>
+  8009e8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009ec:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009f0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009f4:	eb e5                	jmp    8009db <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  8009f6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009fa:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009fe:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a02:	e9 59 ff ff ff       	jmp    800960 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800a07:	4c 89 ee             	mov    %r13,%rsi
+  800a0a:	bf 25 00 00 00       	mov    $0x25,%edi
+  800a0f:	41 ff d6             	call   *%r14
+            break;
+  800a12:	e9 53 f9 ff ff       	jmp    80036a <vprintfmt+0x31>
+            putch('%', put_arg);
+  800a17:	4c 89 ee             	mov    %r13,%rsi
+  800a1a:	bf 25 00 00 00       	mov    $0x25,%edi
+  800a1f:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800a22:	48 83 eb 01          	sub    $0x1,%rbx
+  800a26:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800a2a:	75 f6                	jne    800a22 <vprintfmt+0x6e9>
+  800a2c:	e9 39 f9 ff ff       	jmp    80036a <vprintfmt+0x31>
+}
+  800a31:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800a35:	5b                   	pop    %rbx
+  800a36:	41 5c                	pop    %r12
+  800a38:	41 5d                	pop    %r13
+  800a3a:	41 5e                	pop    %r14
+  800a3c:	41 5f                	pop    %r15
+  800a3e:	5d                   	pop    %rbp
+  800a3f:	c3                   	ret
+
+0000000000800a40 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800a40:	55                   	push   %rbp
+  800a41:	48 89 e5             	mov    %rsp,%rbp
+  800a44:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800a48:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800a4c:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800a51:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800a55:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800a5c:	48 85 ff             	test   %rdi,%rdi
+  800a5f:	74 2b                	je     800a8c <vsnprintf+0x4c>
+  800a61:	48 85 f6             	test   %rsi,%rsi
+  800a64:	74 26                	je     800a8c <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800a66:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800a6a:	48 bf e4 02 80 00 00 	movabs $0x8002e4,%rdi
+  800a71:	00 00 00 
+  800a74:	48 b8 39 03 80 00 00 	movabs $0x800339,%rax
+  800a7b:	00 00 00 
+  800a7e:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800a80:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800a84:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800a87:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800a8a:	c9                   	leave
+  800a8b:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800a8c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800a91:	eb f7                	jmp    800a8a <vsnprintf+0x4a>
+
+0000000000800a93 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800a93:	55                   	push   %rbp
+  800a94:	48 89 e5             	mov    %rsp,%rbp
+  800a97:	48 83 ec 50          	sub    $0x50,%rsp
+  800a9b:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800a9f:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800aa3:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800aa7:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800aae:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800ab2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ab6:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800aba:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800abe:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800ac2:	48 b8 40 0a 80 00 00 	movabs $0x800a40,%rax
+  800ac9:	00 00 00 
+  800acc:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800ace:	c9                   	leave
+  800acf:	c3                   	ret
+
+0000000000800ad0 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800ad0:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800ad3:	74 10                	je     800ae5 <strlen+0x15>
+    size_t n = 0;
+  800ad5:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800ada:	48 83 c0 01          	add    $0x1,%rax
+  800ade:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800ae2:	75 f6                	jne    800ada <strlen+0xa>
+  800ae4:	c3                   	ret
+    size_t n = 0;
+  800ae5:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800aea:	c3                   	ret
+
+0000000000800aeb <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800aeb:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800aee:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800af3:	48 85 f6             	test   %rsi,%rsi
+  800af6:	74 11                	je     800b09 <strnlen+0x1e>
+  800af8:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800afc:	74 0c                	je     800b0a <strnlen+0x1f>
+  800afe:	48 83 c2 01          	add    $0x1,%rdx
+  800b02:	48 39 d0             	cmp    %rdx,%rax
+  800b05:	75 f1                	jne    800af8 <strnlen+0xd>
+  800b07:	eb 04                	jmp    800b0d <strnlen+0x22>
+  800b09:	c3                   	ret
+  800b0a:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800b0d:	c3                   	ret
+
+0000000000800b0e <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800b0e:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800b11:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b16:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800b1a:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800b1d:	48 83 c2 01          	add    $0x1,%rdx
+  800b21:	84 c9                	test   %cl,%cl
+  800b23:	75 f1                	jne    800b16 <strcpy+0x8>
+        ;
+    return res;
+}
+  800b25:	c3                   	ret
+
+0000000000800b26 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800b26:	55                   	push   %rbp
+  800b27:	48 89 e5             	mov    %rsp,%rbp
+  800b2a:	41 54                	push   %r12
+  800b2c:	53                   	push   %rbx
+  800b2d:	48 89 fb             	mov    %rdi,%rbx
+  800b30:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800b33:	48 b8 d0 0a 80 00 00 	movabs $0x800ad0,%rax
+  800b3a:	00 00 00 
+  800b3d:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800b3f:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800b43:	4c 89 e6             	mov    %r12,%rsi
+  800b46:	48 b8 0e 0b 80 00 00 	movabs $0x800b0e,%rax
+  800b4d:	00 00 00 
+  800b50:	ff d0                	call   *%rax
+    return dst;
+}
+  800b52:	48 89 d8             	mov    %rbx,%rax
+  800b55:	5b                   	pop    %rbx
+  800b56:	41 5c                	pop    %r12
+  800b58:	5d                   	pop    %rbp
+  800b59:	c3                   	ret
+
+0000000000800b5a <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800b5a:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800b5d:	48 85 d2             	test   %rdx,%rdx
+  800b60:	74 1f                	je     800b81 <strncpy+0x27>
+  800b62:	48 01 fa             	add    %rdi,%rdx
+  800b65:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800b68:	48 83 c1 01          	add    $0x1,%rcx
+  800b6c:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800b70:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800b74:	41 80 f8 01          	cmp    $0x1,%r8b
+  800b78:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800b7c:	48 39 ca             	cmp    %rcx,%rdx
+  800b7f:	75 e7                	jne    800b68 <strncpy+0xe>
+    }
+    return ret;
+}
+  800b81:	c3                   	ret
+
+0000000000800b82 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800b82:	48 89 f8             	mov    %rdi,%rax
+  800b85:	48 85 d2             	test   %rdx,%rdx
+  800b88:	74 24                	je     800bae <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800b8a:	48 83 ea 01          	sub    $0x1,%rdx
+  800b8e:	74 1b                	je     800bab <strlcpy+0x29>
+  800b90:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800b94:	0f b6 16             	movzbl (%rsi),%edx
+  800b97:	84 d2                	test   %dl,%dl
+  800b99:	74 10                	je     800bab <strlcpy+0x29>
+            *dst++ = *src++;
+  800b9b:	48 83 c6 01          	add    $0x1,%rsi
+  800b9f:	48 83 c0 01          	add    $0x1,%rax
+  800ba3:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800ba6:	48 39 c8             	cmp    %rcx,%rax
+  800ba9:	75 e9                	jne    800b94 <strlcpy+0x12>
+        *dst = '\0';
+  800bab:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800bae:	48 29 f8             	sub    %rdi,%rax
+}
+  800bb1:	c3                   	ret
+
+0000000000800bb2 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800bb2:	0f b6 07             	movzbl (%rdi),%eax
+  800bb5:	84 c0                	test   %al,%al
+  800bb7:	74 13                	je     800bcc <strcmp+0x1a>
+  800bb9:	38 06                	cmp    %al,(%rsi)
+  800bbb:	75 0f                	jne    800bcc <strcmp+0x1a>
+  800bbd:	48 83 c7 01          	add    $0x1,%rdi
+  800bc1:	48 83 c6 01          	add    $0x1,%rsi
+  800bc5:	0f b6 07             	movzbl (%rdi),%eax
+  800bc8:	84 c0                	test   %al,%al
+  800bca:	75 ed                	jne    800bb9 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800bcc:	0f b6 c0             	movzbl %al,%eax
+  800bcf:	0f b6 16             	movzbl (%rsi),%edx
+  800bd2:	29 d0                	sub    %edx,%eax
+}
+  800bd4:	c3                   	ret
+
+0000000000800bd5 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800bd5:	48 85 d2             	test   %rdx,%rdx
+  800bd8:	74 1f                	je     800bf9 <strncmp+0x24>
+  800bda:	0f b6 07             	movzbl (%rdi),%eax
+  800bdd:	84 c0                	test   %al,%al
+  800bdf:	74 1e                	je     800bff <strncmp+0x2a>
+  800be1:	3a 06                	cmp    (%rsi),%al
+  800be3:	75 1a                	jne    800bff <strncmp+0x2a>
+  800be5:	48 83 c7 01          	add    $0x1,%rdi
+  800be9:	48 83 c6 01          	add    $0x1,%rsi
+  800bed:	48 83 ea 01          	sub    $0x1,%rdx
+  800bf1:	75 e7                	jne    800bda <strncmp+0x5>
+
+    if (!n) return 0;
+  800bf3:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bf8:	c3                   	ret
+  800bf9:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bfe:	c3                   	ret
+  800bff:	48 85 d2             	test   %rdx,%rdx
+  800c02:	74 09                	je     800c0d <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800c04:	0f b6 07             	movzbl (%rdi),%eax
+  800c07:	0f b6 16             	movzbl (%rsi),%edx
+  800c0a:	29 d0                	sub    %edx,%eax
+  800c0c:	c3                   	ret
+    if (!n) return 0;
+  800c0d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800c12:	c3                   	ret
+
+0000000000800c13 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800c13:	0f b6 17             	movzbl (%rdi),%edx
+  800c16:	84 d2                	test   %dl,%dl
+  800c18:	74 18                	je     800c32 <strchr+0x1f>
+        if (*str == c) {
+  800c1a:	0f be d2             	movsbl %dl,%edx
+  800c1d:	39 f2                	cmp    %esi,%edx
+  800c1f:	74 17                	je     800c38 <strchr+0x25>
+    for (; *str; str++) {
+  800c21:	48 83 c7 01          	add    $0x1,%rdi
+  800c25:	0f b6 17             	movzbl (%rdi),%edx
+  800c28:	84 d2                	test   %dl,%dl
+  800c2a:	75 ee                	jne    800c1a <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800c2c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c31:	c3                   	ret
+  800c32:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c37:	c3                   	ret
+  800c38:	48 89 f8             	mov    %rdi,%rax
+}
+  800c3b:	c3                   	ret
+
+0000000000800c3c <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800c3c:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800c3f:	0f b6 17             	movzbl (%rdi),%edx
+  800c42:	84 d2                	test   %dl,%dl
+  800c44:	74 13                	je     800c59 <strfind+0x1d>
+  800c46:	0f be d2             	movsbl %dl,%edx
+  800c49:	39 f2                	cmp    %esi,%edx
+  800c4b:	74 0b                	je     800c58 <strfind+0x1c>
+  800c4d:	48 83 c0 01          	add    $0x1,%rax
+  800c51:	0f b6 10             	movzbl (%rax),%edx
+  800c54:	84 d2                	test   %dl,%dl
+  800c56:	75 ee                	jne    800c46 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800c58:	c3                   	ret
+  800c59:	c3                   	ret
+
+0000000000800c5a <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800c5a:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800c5d:	48 89 f8             	mov    %rdi,%rax
+  800c60:	48 f7 d8             	neg    %rax
+  800c63:	83 e0 07             	and    $0x7,%eax
+  800c66:	49 89 d1             	mov    %rdx,%r9
+  800c69:	49 29 c1             	sub    %rax,%r9
+  800c6c:	78 36                	js     800ca4 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800c6e:	40 0f b6 c6          	movzbl %sil,%eax
+  800c72:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800c79:	01 01 01 
+  800c7c:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800c80:	40 f6 c7 07          	test   $0x7,%dil
+  800c84:	75 38                	jne    800cbe <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800c86:	4c 89 c9             	mov    %r9,%rcx
+  800c89:	48 c1 f9 03          	sar    $0x3,%rcx
+  800c8d:	74 0c                	je     800c9b <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800c8f:	fc                   	cld
+  800c90:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800c93:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800c97:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800c9b:	4d 85 c9             	test   %r9,%r9
+  800c9e:	75 45                	jne    800ce5 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800ca0:	4c 89 c0             	mov    %r8,%rax
+  800ca3:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800ca4:	48 85 d2             	test   %rdx,%rdx
+  800ca7:	74 f7                	je     800ca0 <memset+0x46>
+  800ca9:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800cac:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800caf:	48 83 c0 01          	add    $0x1,%rax
+  800cb3:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  800cb7:	48 39 c2             	cmp    %rax,%rdx
+  800cba:	75 f3                	jne    800caf <memset+0x55>
+  800cbc:	eb e2                	jmp    800ca0 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  800cbe:	40 f6 c7 01          	test   $0x1,%dil
+  800cc2:	74 06                	je     800cca <memset+0x70>
+  800cc4:	88 07                	mov    %al,(%rdi)
+  800cc6:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800cca:	40 f6 c7 02          	test   $0x2,%dil
+  800cce:	74 07                	je     800cd7 <memset+0x7d>
+  800cd0:	66 89 07             	mov    %ax,(%rdi)
+  800cd3:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800cd7:	40 f6 c7 04          	test   $0x4,%dil
+  800cdb:	74 a9                	je     800c86 <memset+0x2c>
+  800cdd:	89 07                	mov    %eax,(%rdi)
+  800cdf:	48 83 c7 04          	add    $0x4,%rdi
+  800ce3:	eb a1                	jmp    800c86 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800ce5:	41 f6 c1 04          	test   $0x4,%r9b
+  800ce9:	74 06                	je     800cf1 <memset+0x97>
+  800ceb:	89 07                	mov    %eax,(%rdi)
+  800ced:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800cf1:	41 f6 c1 02          	test   $0x2,%r9b
+  800cf5:	74 07                	je     800cfe <memset+0xa4>
+  800cf7:	66 89 07             	mov    %ax,(%rdi)
+  800cfa:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  800cfe:	41 f6 c1 01          	test   $0x1,%r9b
+  800d02:	74 9c                	je     800ca0 <memset+0x46>
+  800d04:	88 07                	mov    %al,(%rdi)
+  800d06:	eb 98                	jmp    800ca0 <memset+0x46>
+
+0000000000800d08 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  800d08:	48 89 f8             	mov    %rdi,%rax
+  800d0b:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  800d0e:	48 39 fe             	cmp    %rdi,%rsi
+  800d11:	73 3b                	jae    800d4e <memmove+0x46>
+  800d13:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  800d17:	48 39 d7             	cmp    %rdx,%rdi
+  800d1a:	73 32                	jae    800d4e <memmove+0x46>
+        s += n;
+        d += n;
+  800d1c:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800d20:	48 89 d6             	mov    %rdx,%rsi
+  800d23:	48 09 fe             	or     %rdi,%rsi
+  800d26:	48 09 ce             	or     %rcx,%rsi
+  800d29:	40 f6 c6 07          	test   $0x7,%sil
+  800d2d:	75 12                	jne    800d41 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  800d2f:	48 83 ef 08          	sub    $0x8,%rdi
+  800d33:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  800d37:	48 c1 e9 03          	shr    $0x3,%rcx
+  800d3b:	fd                   	std
+  800d3c:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  800d3f:	fc                   	cld
+  800d40:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  800d41:	48 83 ef 01          	sub    $0x1,%rdi
+  800d45:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  800d49:	fd                   	std
+  800d4a:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  800d4c:	eb f1                	jmp    800d3f <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800d4e:	48 89 f2             	mov    %rsi,%rdx
+  800d51:	48 09 c2             	or     %rax,%rdx
+  800d54:	48 09 ca             	or     %rcx,%rdx
+  800d57:	f6 c2 07             	test   $0x7,%dl
+  800d5a:	75 0c                	jne    800d68 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  800d5c:	48 c1 e9 03          	shr    $0x3,%rcx
+  800d60:	48 89 c7             	mov    %rax,%rdi
+  800d63:	fc                   	cld
+  800d64:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  800d67:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  800d68:	48 89 c7             	mov    %rax,%rdi
+  800d6b:	fc                   	cld
+  800d6c:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  800d6e:	c3                   	ret
+
+0000000000800d6f <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  800d6f:	55                   	push   %rbp
+  800d70:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  800d73:	48 b8 08 0d 80 00 00 	movabs $0x800d08,%rax
+  800d7a:	00 00 00 
+  800d7d:	ff d0                	call   *%rax
+}
+  800d7f:	5d                   	pop    %rbp
+  800d80:	c3                   	ret
+
+0000000000800d81 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  800d81:	55                   	push   %rbp
+  800d82:	48 89 e5             	mov    %rsp,%rbp
+  800d85:	41 57                	push   %r15
+  800d87:	41 56                	push   %r14
+  800d89:	41 55                	push   %r13
+  800d8b:	41 54                	push   %r12
+  800d8d:	53                   	push   %rbx
+  800d8e:	48 83 ec 08          	sub    $0x8,%rsp
+  800d92:	49 89 fe             	mov    %rdi,%r14
+  800d95:	49 89 f7             	mov    %rsi,%r15
+  800d98:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  800d9b:	48 89 f7             	mov    %rsi,%rdi
+  800d9e:	48 b8 d0 0a 80 00 00 	movabs $0x800ad0,%rax
+  800da5:	00 00 00 
+  800da8:	ff d0                	call   *%rax
+  800daa:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  800dad:	48 89 de             	mov    %rbx,%rsi
+  800db0:	4c 89 f7             	mov    %r14,%rdi
+  800db3:	48 b8 eb 0a 80 00 00 	movabs $0x800aeb,%rax
+  800dba:	00 00 00 
+  800dbd:	ff d0                	call   *%rax
+  800dbf:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  800dc2:	48 39 c3             	cmp    %rax,%rbx
+  800dc5:	74 36                	je     800dfd <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  800dc7:	48 89 d8             	mov    %rbx,%rax
+  800dca:	4c 29 e8             	sub    %r13,%rax
+  800dcd:	49 39 c4             	cmp    %rax,%r12
+  800dd0:	73 31                	jae    800e03 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  800dd2:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  800dd7:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800ddb:	4c 89 fe             	mov    %r15,%rsi
+  800dde:	48 b8 6f 0d 80 00 00 	movabs $0x800d6f,%rax
+  800de5:	00 00 00 
+  800de8:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  800dea:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  800dee:	48 83 c4 08          	add    $0x8,%rsp
+  800df2:	5b                   	pop    %rbx
+  800df3:	41 5c                	pop    %r12
+  800df5:	41 5d                	pop    %r13
+  800df7:	41 5e                	pop    %r14
+  800df9:	41 5f                	pop    %r15
+  800dfb:	5d                   	pop    %rbp
+  800dfc:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  800dfd:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800e01:	eb eb                	jmp    800dee <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  800e03:	48 83 eb 01          	sub    $0x1,%rbx
+  800e07:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800e0b:	48 89 da             	mov    %rbx,%rdx
+  800e0e:	4c 89 fe             	mov    %r15,%rsi
+  800e11:	48 b8 6f 0d 80 00 00 	movabs $0x800d6f,%rax
+  800e18:	00 00 00 
+  800e1b:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  800e1d:	49 01 de             	add    %rbx,%r14
+  800e20:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  800e25:	eb c3                	jmp    800dea <strlcat+0x69>
+
+0000000000800e27 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  800e27:	48 85 d2             	test   %rdx,%rdx
+  800e2a:	74 2d                	je     800e59 <memcmp+0x32>
+  800e2c:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  800e31:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800e35:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  800e3a:	44 38 c1             	cmp    %r8b,%cl
+  800e3d:	75 0f                	jne    800e4e <memcmp+0x27>
+    while (n-- > 0) {
+  800e3f:	48 83 c0 01          	add    $0x1,%rax
+  800e43:	48 39 c2             	cmp    %rax,%rdx
+  800e46:	75 e9                	jne    800e31 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  800e48:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e4d:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  800e4e:	0f b6 c1             	movzbl %cl,%eax
+  800e51:	45 0f b6 c0          	movzbl %r8b,%r8d
+  800e55:	44 29 c0             	sub    %r8d,%eax
+  800e58:	c3                   	ret
+    return 0;
+  800e59:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800e5e:	c3                   	ret
+
+0000000000800e5f <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  800e5f:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  800e63:	48 39 c7             	cmp    %rax,%rdi
+  800e66:	73 0f                	jae    800e77 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  800e68:	40 38 37             	cmp    %sil,(%rdi)
+  800e6b:	74 0e                	je     800e7b <memfind+0x1c>
+    for (; src < end; src++) {
+  800e6d:	48 83 c7 01          	add    $0x1,%rdi
+  800e71:	48 39 f8             	cmp    %rdi,%rax
+  800e74:	75 f2                	jne    800e68 <memfind+0x9>
+  800e76:	c3                   	ret
+  800e77:	48 89 f8             	mov    %rdi,%rax
+  800e7a:	c3                   	ret
+  800e7b:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  800e7e:	c3                   	ret
+
+0000000000800e7f <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  800e7f:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  800e82:	0f b6 37             	movzbl (%rdi),%esi
+  800e85:	40 80 fe 20          	cmp    $0x20,%sil
+  800e89:	74 06                	je     800e91 <strtol+0x12>
+  800e8b:	40 80 fe 09          	cmp    $0x9,%sil
+  800e8f:	75 13                	jne    800ea4 <strtol+0x25>
+  800e91:	48 83 c7 01          	add    $0x1,%rdi
+  800e95:	0f b6 37             	movzbl (%rdi),%esi
+  800e98:	40 80 fe 20          	cmp    $0x20,%sil
+  800e9c:	74 f3                	je     800e91 <strtol+0x12>
+  800e9e:	40 80 fe 09          	cmp    $0x9,%sil
+  800ea2:	74 ed                	je     800e91 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  800ea4:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  800ea7:	83 e0 fd             	and    $0xfffffffd,%eax
+  800eaa:	3c 01                	cmp    $0x1,%al
+  800eac:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  800eb0:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  800eb6:	75 0f                	jne    800ec7 <strtol+0x48>
+  800eb8:	80 3f 30             	cmpb   $0x30,(%rdi)
+  800ebb:	74 14                	je     800ed1 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  800ebd:	85 d2                	test   %edx,%edx
+  800ebf:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800ec4:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  800ec7:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  800ecc:	4c 63 ca             	movslq %edx,%r9
+  800ecf:	eb 36                	jmp    800f07 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  800ed1:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  800ed5:	74 0f                	je     800ee6 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  800ed7:	85 d2                	test   %edx,%edx
+  800ed9:	75 ec                	jne    800ec7 <strtol+0x48>
+        s++;
+  800edb:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  800edf:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  800ee4:	eb e1                	jmp    800ec7 <strtol+0x48>
+        s += 2;
+  800ee6:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  800eea:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  800eef:	eb d6                	jmp    800ec7 <strtol+0x48>
+            dig -= '0';
+  800ef1:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  800ef4:	44 0f b6 c1          	movzbl %cl,%r8d
+  800ef8:	41 39 d0             	cmp    %edx,%r8d
+  800efb:	7d 21                	jge    800f1e <strtol+0x9f>
+        val = val * base + dig;
+  800efd:	49 0f af c1          	imul   %r9,%rax
+  800f01:	0f b6 c9             	movzbl %cl,%ecx
+  800f04:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  800f07:	48 83 c7 01          	add    $0x1,%rdi
+  800f0b:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  800f0f:	80 f9 39             	cmp    $0x39,%cl
+  800f12:	76 dd                	jbe    800ef1 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  800f14:	80 f9 7b             	cmp    $0x7b,%cl
+  800f17:	77 05                	ja     800f1e <strtol+0x9f>
+            dig -= 'a' - 10;
+  800f19:	83 e9 57             	sub    $0x57,%ecx
+  800f1c:	eb d6                	jmp    800ef4 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  800f1e:	4d 85 d2             	test   %r10,%r10
+  800f21:	74 03                	je     800f26 <strtol+0xa7>
+  800f23:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  800f26:	48 89 c2             	mov    %rax,%rdx
+  800f29:	48 f7 da             	neg    %rdx
+  800f2c:	40 80 fe 2d          	cmp    $0x2d,%sil
+  800f30:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  800f34:	c3                   	ret
+
+0000000000800f35 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  800f35:	55                   	push   %rbp
+  800f36:	48 89 e5             	mov    %rsp,%rbp
+  800f39:	53                   	push   %rbx
+  800f3a:	48 89 fa             	mov    %rdi,%rdx
+  800f3d:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  800f40:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800f45:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f4a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800f4f:	be 00 00 00 00       	mov    $0x0,%esi
+  800f54:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800f5a:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  800f5c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800f60:	c9                   	leave
+  800f61:	c3                   	ret
+
+0000000000800f62 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  800f62:	55                   	push   %rbp
+  800f63:	48 89 e5             	mov    %rsp,%rbp
+  800f66:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  800f67:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800f6c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f71:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800f76:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f7b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800f80:	be 00 00 00 00       	mov    $0x0,%esi
+  800f85:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800f8b:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  800f8d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800f91:	c9                   	leave
+  800f92:	c3                   	ret
+
+0000000000800f93 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  800f93:	55                   	push   %rbp
+  800f94:	48 89 e5             	mov    %rsp,%rbp
+  800f97:	53                   	push   %rbx
+  800f98:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  800f9c:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800f9f:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800fa4:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800fa9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fae:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800fb3:	be 00 00 00 00       	mov    $0x0,%esi
+  800fb8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800fbe:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800fc0:	48 85 c0             	test   %rax,%rax
+  800fc3:	7f 06                	jg     800fcb <sys_env_destroy+0x38>
+}
+  800fc5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800fc9:	c9                   	leave
+  800fca:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800fcb:	49 89 c0             	mov    %rax,%r8
+  800fce:	b9 03 00 00 00       	mov    $0x3,%ecx
+  800fd3:	48 ba 50 32 80 00 00 	movabs $0x803250,%rdx
+  800fda:	00 00 00 
+  800fdd:	be 26 00 00 00       	mov    $0x26,%esi
+  800fe2:	48 bf 6f 32 80 00 00 	movabs $0x80326f,%rdi
+  800fe9:	00 00 00 
+  800fec:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ff1:	49 b9 4f 2a 80 00 00 	movabs $0x802a4f,%r9
+  800ff8:	00 00 00 
+  800ffb:	41 ff d1             	call   *%r9
+
+0000000000800ffe <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  800ffe:	55                   	push   %rbp
+  800fff:	48 89 e5             	mov    %rsp,%rbp
+  801002:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801003:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801008:	ba 00 00 00 00       	mov    $0x0,%edx
+  80100d:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801012:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801017:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80101c:	be 00 00 00 00       	mov    $0x0,%esi
+  801021:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801027:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  801029:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80102d:	c9                   	leave
+  80102e:	c3                   	ret
+
+000000000080102f <sys_yield>:
+
+void
+sys_yield(void) {
+  80102f:	55                   	push   %rbp
+  801030:	48 89 e5             	mov    %rsp,%rbp
+  801033:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801034:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801039:	ba 00 00 00 00       	mov    $0x0,%edx
+  80103e:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801043:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801048:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80104d:	be 00 00 00 00       	mov    $0x0,%esi
+  801052:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801058:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  80105a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80105e:	c9                   	leave
+  80105f:	c3                   	ret
+
+0000000000801060 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  801060:	55                   	push   %rbp
+  801061:	48 89 e5             	mov    %rsp,%rbp
+  801064:	53                   	push   %rbx
+  801065:	48 89 fa             	mov    %rdi,%rdx
+  801068:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80106b:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801070:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  801077:	00 00 00 
+  80107a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80107f:	be 00 00 00 00       	mov    $0x0,%esi
+  801084:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80108a:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  80108c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801090:	c9                   	leave
+  801091:	c3                   	ret
+
+0000000000801092 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  801092:	55                   	push   %rbp
+  801093:	48 89 e5             	mov    %rsp,%rbp
+  801096:	53                   	push   %rbx
+  801097:	49 89 f8             	mov    %rdi,%r8
+  80109a:	48 89 d3             	mov    %rdx,%rbx
+  80109d:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8010a0:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8010a5:	4c 89 c2             	mov    %r8,%rdx
+  8010a8:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8010ab:	be 00 00 00 00       	mov    $0x0,%esi
+  8010b0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8010b6:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  8010b8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8010bc:	c9                   	leave
+  8010bd:	c3                   	ret
+
+00000000008010be <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  8010be:	55                   	push   %rbp
+  8010bf:	48 89 e5             	mov    %rsp,%rbp
+  8010c2:	53                   	push   %rbx
+  8010c3:	48 83 ec 08          	sub    $0x8,%rsp
+  8010c7:	89 f8                	mov    %edi,%eax
+  8010c9:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  8010cc:	48 63 f9             	movslq %ecx,%rdi
+  8010cf:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8010d2:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8010d7:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8010da:	be 00 00 00 00       	mov    $0x0,%esi
+  8010df:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8010e5:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8010e7:	48 85 c0             	test   %rax,%rax
+  8010ea:	7f 06                	jg     8010f2 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  8010ec:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8010f0:	c9                   	leave
+  8010f1:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8010f2:	49 89 c0             	mov    %rax,%r8
+  8010f5:	b9 04 00 00 00       	mov    $0x4,%ecx
+  8010fa:	48 ba 50 32 80 00 00 	movabs $0x803250,%rdx
+  801101:	00 00 00 
+  801104:	be 26 00 00 00       	mov    $0x26,%esi
+  801109:	48 bf 6f 32 80 00 00 	movabs $0x80326f,%rdi
+  801110:	00 00 00 
+  801113:	b8 00 00 00 00       	mov    $0x0,%eax
+  801118:	49 b9 4f 2a 80 00 00 	movabs $0x802a4f,%r9
+  80111f:	00 00 00 
+  801122:	41 ff d1             	call   *%r9
+
+0000000000801125 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801125:	55                   	push   %rbp
+  801126:	48 89 e5             	mov    %rsp,%rbp
+  801129:	53                   	push   %rbx
+  80112a:	48 83 ec 08          	sub    $0x8,%rsp
+  80112e:	89 f8                	mov    %edi,%eax
+  801130:	49 89 f2             	mov    %rsi,%r10
+  801133:	48 89 cf             	mov    %rcx,%rdi
+  801136:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  801139:	48 63 da             	movslq %edx,%rbx
+  80113c:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80113f:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801144:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801147:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  80114a:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80114c:	48 85 c0             	test   %rax,%rax
+  80114f:	7f 06                	jg     801157 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  801151:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801155:	c9                   	leave
+  801156:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801157:	49 89 c0             	mov    %rax,%r8
+  80115a:	b9 05 00 00 00       	mov    $0x5,%ecx
+  80115f:	48 ba 50 32 80 00 00 	movabs $0x803250,%rdx
+  801166:	00 00 00 
+  801169:	be 26 00 00 00       	mov    $0x26,%esi
+  80116e:	48 bf 6f 32 80 00 00 	movabs $0x80326f,%rdi
+  801175:	00 00 00 
+  801178:	b8 00 00 00 00       	mov    $0x0,%eax
+  80117d:	49 b9 4f 2a 80 00 00 	movabs $0x802a4f,%r9
+  801184:	00 00 00 
+  801187:	41 ff d1             	call   *%r9
+
+000000000080118a <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  80118a:	55                   	push   %rbp
+  80118b:	48 89 e5             	mov    %rsp,%rbp
+  80118e:	53                   	push   %rbx
+  80118f:	48 83 ec 08          	sub    $0x8,%rsp
+  801193:	48 89 f1             	mov    %rsi,%rcx
+  801196:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  801199:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80119c:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8011a1:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8011a6:	be 00 00 00 00       	mov    $0x0,%esi
+  8011ab:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8011b1:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8011b3:	48 85 c0             	test   %rax,%rax
+  8011b6:	7f 06                	jg     8011be <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  8011b8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8011bc:	c9                   	leave
+  8011bd:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8011be:	49 89 c0             	mov    %rax,%r8
+  8011c1:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8011c6:	48 ba 50 32 80 00 00 	movabs $0x803250,%rdx
+  8011cd:	00 00 00 
+  8011d0:	be 26 00 00 00       	mov    $0x26,%esi
+  8011d5:	48 bf 6f 32 80 00 00 	movabs $0x80326f,%rdi
+  8011dc:	00 00 00 
+  8011df:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011e4:	49 b9 4f 2a 80 00 00 	movabs $0x802a4f,%r9
+  8011eb:	00 00 00 
+  8011ee:	41 ff d1             	call   *%r9
+
+00000000008011f1 <sys_region_batch>:
+
+int
+sys_region_batch(const struct RegionOp *ops, size_t count) {
+  8011f1:	55                   	push   %rbp
+  8011f2:	48 89 e5             	mov    %rsp,%rbp
+  8011f5:	53                   	push   %rbx
+  8011f6:	48 83 ec 08          	sub    $0x8,%rsp
+  8011fa:	48 89 fa             	mov    %rdi,%rdx
+  8011fd:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801200:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801205:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80120a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80120f:	be 00 00 00 00       	mov    $0x0,%esi
+  801214:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80121a:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80121c:	48 85 c0             	test   %rax,%rax
+  80121f:	7f 06                	jg     801227 <sys_region_batch+0x36>
+        else
+            platform_asan_unpoison(va, ops[i].size);
+    }
+#endif
+    return res;
+}
+  801221:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801225:	c9                   	leave
+  801226:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801227:	49 89 c0             	mov    %rax,%r8
+  80122a:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  80122f:	48 ba 50 32 80 00 00 	movabs $0x803250,%rdx
+  801236:	00 00 00 
+  801239:	be 26 00 00 00       	mov    $0x26,%esi
+  80123e:	48 bf 6f 32 80 00 00 	movabs $0x80326f,%rdi
+  801245:	00 00 00 
+  801248:	b8 00 00 00 00       	mov    $0x0,%eax
+  80124d:	49 b9 4f 2a 80 00 00 	movabs $0x802a4f,%r9
+  801254:	00 00 00 
+  801257:	41 ff d1             	call   *%r9
+
+000000000080125a <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  80125a:	55                   	push   %rbp
+  80125b:	48 89 e5             	mov    %rsp,%rbp
+  80125e:	53                   	push   %rbx
+  80125f:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  801263:	48 63 ce             	movslq %esi,%rcx
+  801266:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801269:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80126e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801273:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801278:	be 00 00 00 00       	mov    $0x0,%esi
+  80127d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801283:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801285:	48 85 c0             	test   %rax,%rax
+  801288:	7f 06                	jg     801290 <sys_env_set_status+0x36>
+}
+  80128a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80128e:	c9                   	leave
+  80128f:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801290:	49 89 c0             	mov    %rax,%r8
+  801293:	b9 09 00 00 00       	mov    $0x9,%ecx
+  801298:	48 ba 50 32 80 00 00 	movabs $0x803250,%rdx
+  80129f:	00 00 00 
+  8012a2:	be 26 00 00 00       	mov    $0x26,%esi
+  8012a7:	48 bf 6f 32 80 00 00 	movabs $0x80326f,%rdi
+  8012ae:	00 00 00 
+  8012b1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012b6:	49 b9 4f 2a 80 00 00 	movabs $0x802a4f,%r9
+  8012bd:	00 00 00 
+  8012c0:	41 ff d1             	call   *%r9
+
+00000000008012c3 <sys_env_set_weight>:
+
+int
+sys_env_set_weight(envid_t envid, uint32_t weight) {
+  8012c3:	55                   	push   %rbp
+  8012c4:	48 89 e5             	mov    %rsp,%rbp
+  8012c7:	53                   	push   %rbx
+  8012c8:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_weight, 1, envid, weight, 0, 0, 0, 0);
+  8012cc:	89 f1                	mov    %esi,%ecx
+  8012ce:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8012d1:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8012d6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012db:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012e0:	be 00 00 00 00       	mov    $0x0,%esi
+  8012e5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8012eb:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8012ed:	48 85 c0             	test   %rax,%rax
+  8012f0:	7f 06                	jg     8012f8 <sys_env_set_weight+0x35>
+}
+  8012f2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012f6:	c9                   	leave
+  8012f7:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8012f8:	49 89 c0             	mov    %rax,%r8
+  8012fb:	b9 10 00 00 00       	mov    $0x10,%ecx
+  801300:	48 ba 50 32 80 00 00 	movabs $0x803250,%rdx
+  801307:	00 00 00 
+  80130a:	be 26 00 00 00       	mov    $0x26,%esi
+  80130f:	48 bf 6f 32 80 00 00 	movabs $0x80326f,%rdi
+  801316:	00 00 00 
+  801319:	b8 00 00 00 00       	mov    $0x0,%eax
+  80131e:	49 b9 4f 2a 80 00 00 	movabs $0x802a4f,%r9
+  801325:	00 00 00 
+  801328:	41 ff d1             	call   *%r9
+
+000000000080132b <sys_env_set_rt>:
+
+int
+sys_env_set_rt(envid_t envid, uint64_t period, uint64_t budget, uint64_t deadline) {
+  80132b:	55                   	push   %rbp
+  80132c:	48 89 e5             	mov    %rsp,%rbp
+  80132f:	53                   	push   %rbx
+  801330:	48 83 ec 08          	sub    $0x8,%rsp
+  801334:	89 f8                	mov    %edi,%eax
+  801336:	48 89 d3             	mov    %rdx,%rbx
+  801339:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_env_set_rt, 1, envid, period, budget, deadline, 0, 0);
+  80133c:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80133f:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801344:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801347:	be 00 00 00 00       	mov    $0x0,%esi
+  80134c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801352:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801354:	48 85 c0             	test   %rax,%rax
+  801357:	7f 06                	jg     80135f <sys_env_set_rt+0x34>
+}
+  801359:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80135d:	c9                   	leave
+  80135e:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80135f:	49 89 c0             	mov    %rax,%r8
+  801362:	b9 11 00 00 00       	mov    $0x11,%ecx
+  801367:	48 ba 50 32 80 00 00 	movabs $0x803250,%rdx
+  80136e:	00 00 00 
+  801371:	be 26 00 00 00       	mov    $0x26,%esi
+  801376:	48 bf 6f 32 80 00 00 	movabs $0x80326f,%rdi
+  80137d:	00 00 00 
+  801380:	b8 00 00 00 00       	mov    $0x0,%eax
+  801385:	49 b9 4f 2a 80 00 00 	movabs $0x802a4f,%r9
+  80138c:	00 00 00 
+  80138f:	41 ff d1             	call   *%r9
+
+0000000000801392 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  801392:	55                   	push   %rbp
+  801393:	48 89 e5             	mov    %rsp,%rbp
+  801396:	53                   	push   %rbx
+  801397:	48 83 ec 08          	sub    $0x8,%rsp
+  80139b:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  80139e:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8013a1:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8013a6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013ab:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013b0:	be 00 00 00 00       	mov    $0x0,%esi
+  8013b5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013bb:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8013bd:	48 85 c0             	test   %rax,%rax
+  8013c0:	7f 06                	jg     8013c8 <sys_env_set_trapframe+0x36>
+}
+  8013c2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013c6:	c9                   	leave
+  8013c7:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8013c8:	49 89 c0             	mov    %rax,%r8
+  8013cb:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  8013d0:	48 ba 50 32 80 00 00 	movabs $0x803250,%rdx
+  8013d7:	00 00 00 
+  8013da:	be 26 00 00 00       	mov    $0x26,%esi
+  8013df:	48 bf 6f 32 80 00 00 	movabs $0x80326f,%rdi
+  8013e6:	00 00 00 
+  8013e9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013ee:	49 b9 4f 2a 80 00 00 	movabs $0x802a4f,%r9
+  8013f5:	00 00 00 
+  8013f8:	41 ff d1             	call   *%r9
+
+00000000008013fb <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  8013fb:	55                   	push   %rbp
+  8013fc:	48 89 e5             	mov    %rsp,%rbp
+  8013ff:	53                   	push   %rbx
+  801400:	48 83 ec 08          	sub    $0x8,%rsp
+  801404:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  801407:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80140a:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80140f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801414:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801419:	be 00 00 00 00       	mov    $0x0,%esi
+  80141e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801424:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801426:	48 85 c0             	test   %rax,%rax
+  801429:	7f 06                	jg     801431 <sys_env_set_pgfault_upcall+0x36>
+}
+  80142b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80142f:	c9                   	leave
+  801430:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801431:	49 89 c0             	mov    %rax,%r8
+  801434:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  801439:	48 ba 50 32 80 00 00 	movabs $0x803250,%rdx
+  801440:	00 00 00 
+  801443:	be 26 00 00 00       	mov    $0x26,%esi
+  801448:	48 bf 6f 32 80 00 00 	movabs $0x80326f,%rdi
+  80144f:	00 00 00 
+  801452:	b8 00 00 00 00       	mov    $0x0,%eax
+  801457:	49 b9 4f 2a 80 00 00 	movabs $0x802a4f,%r9
+  80145e:	00 00 00 
+  801461:	41 ff d1             	call   *%r9
+
+0000000000801464 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  801464:	55                   	push   %rbp
+  801465:	48 89 e5             	mov    %rsp,%rbp
+  801468:	53                   	push   %rbx
+  801469:	89 f8                	mov    %edi,%eax
+  80146b:	49 89 f1             	mov    %rsi,%r9
+  80146e:	48 89 d3             	mov    %rdx,%rbx
+  801471:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  801474:	49 63 f0             	movslq %r8d,%rsi
+  801477:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80147a:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80147f:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801482:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801488:	cd 30                	int    $0x30
+}
+  80148a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80148e:	c9                   	leave
+  80148f:	c3                   	ret
+
+0000000000801490 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  801490:	55                   	push   %rbp
+  801491:	48 89 e5             	mov    %rsp,%rbp
+  801494:	53                   	push   %rbx
+  801495:	48 83 ec 08          	sub    $0x8,%rsp
+  801499:	48 89 fa             	mov    %rdi,%rdx
+  80149c:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80149f:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8014a4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014a9:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014ae:	be 00 00 00 00       	mov    $0x0,%esi
+  8014b3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014b9:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8014bb:	48 85 c0             	test   %rax,%rax
+  8014be:	7f 06                	jg     8014c6 <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8014c0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014c4:	c9                   	leave
+  8014c5:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8014c6:	49 89 c0             	mov    %rax,%r8
+  8014c9:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  8014ce:	48 ba 50 32 80 00 00 	movabs $0x803250,%rdx
+  8014d5:	00 00 00 
+  8014d8:	be 26 00 00 00       	mov    $0x26,%esi
+  8014dd:	48 bf 6f 32 80 00 00 	movabs $0x80326f,%rdi
+  8014e4:	00 00 00 
+  8014e7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014ec:	49 b9 4f 2a 80 00 00 	movabs $0x802a4f,%r9
+  8014f3:	00 00 00 
+  8014f6:	41 ff d1             	call   *%r9
+
+00000000008014f9 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8014f9:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801500:	ff ff ff 
+  801503:	48 01 f8             	add    %rdi,%rax
+  801506:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  80150a:	c3                   	ret
+
+000000000080150b <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80150b:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801512:	ff ff ff 
+  801515:	48 01 f8             	add    %rdi,%rax
+  801518:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  80151c:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  801522:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  801526:	c3                   	ret
+
+0000000000801527 <fd_alloc_from>:
+}
+
+/* Like fd_alloc(), but only considers fds starting from fdnum,
+ * so that several fds can be found before their pages are allocated */
+int
+fd_alloc_from(int fdnum, struct Fd **fd_store) {
+  801527:	55                   	push   %rbp
+  801528:	48 89 e5             	mov    %rsp,%rbp
+  80152b:	41 57                	push   %r15
+  80152d:	41 56                	push   %r14
+  80152f:	41 55                	push   %r13
+  801531:	41 54                	push   %r12
+  801533:	53                   	push   %rbx
+  801534:	48 83 ec 08          	sub    $0x8,%rsp
+  801538:	49 89 f7             	mov    %rsi,%r15
+    for (int i = MAX(fdnum, 0); i < MAXFD; i++) {
+  80153b:	85 ff                	test   %edi,%edi
+  80153d:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  801543:	44 0f 49 e7          	cmovns %edi,%r12d
+  801547:	83 ff 1f             	cmp    $0x1f,%edi
+  80154a:	7f 37                	jg     801583 <fd_alloc_from+0x5c>
+  80154c:	49 63 dc             	movslq %r12d,%rbx
+  80154f:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  801556:	48 c1 e3 0c          	shl    $0xc,%rbx
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  80155a:	49 be 30 26 80 00 00 	movabs $0x802630,%r14
+  801561:	00 00 00 
+        struct Fd *fd = INDEX2FD(i);
+  801564:	49 89 dd             	mov    %rbx,%r13
+        if (!(get_prot(fd) & PROT_R)) {
+  801567:	48 89 df             	mov    %rbx,%rdi
+  80156a:	41 ff d6             	call   *%r14
+  80156d:	83 e0 04             	and    $0x4,%eax
+  801570:	74 1c                	je     80158e <fd_alloc_from+0x67>
+    for (int i = MAX(fdnum, 0); i < MAXFD; i++) {
+  801572:	41 83 c4 01          	add    $0x1,%r12d
+  801576:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  80157d:	41 83 fc 1f          	cmp    $0x1f,%r12d
+  801581:	7e e1                	jle    801564 <fd_alloc_from+0x3d>
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  801583:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801589:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  80158e:	4d 89 2f             	mov    %r13,(%r15)
+}
+  801591:	48 83 c4 08          	add    $0x8,%rsp
+  801595:	5b                   	pop    %rbx
+  801596:	41 5c                	pop    %r12
+  801598:	41 5d                	pop    %r13
+  80159a:	41 5e                	pop    %r14
+  80159c:	41 5f                	pop    %r15
+  80159e:	5d                   	pop    %rbp
+  80159f:	c3                   	ret
+
+00000000008015a0 <fd_alloc>:
+fd_alloc(struct Fd **fd_store) {
+  8015a0:	55                   	push   %rbp
+  8015a1:	48 89 e5             	mov    %rsp,%rbp
+  8015a4:	48 89 fe             	mov    %rdi,%rsi
+    return fd_alloc_from(0, fd_store);
+  8015a7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8015ac:	48 b8 27 15 80 00 00 	movabs $0x801527,%rax
+  8015b3:	00 00 00 
+  8015b6:	ff d0                	call   *%rax
+}
+  8015b8:	5d                   	pop    %rbp
+  8015b9:	c3                   	ret
+
+00000000008015ba <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  8015ba:	83 ff 1f             	cmp    $0x1f,%edi
+  8015bd:	77 39                	ja     8015f8 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  8015bf:	55                   	push   %rbp
+  8015c0:	48 89 e5             	mov    %rsp,%rbp
+  8015c3:	41 54                	push   %r12
+  8015c5:	53                   	push   %rbx
+  8015c6:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  8015c9:	48 63 df             	movslq %edi,%rbx
+  8015cc:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  8015d3:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  8015d7:	48 89 df             	mov    %rbx,%rdi
+  8015da:	48 b8 30 26 80 00 00 	movabs $0x802630,%rax
+  8015e1:	00 00 00 
+  8015e4:	ff d0                	call   *%rax
+  8015e6:	a8 04                	test   $0x4,%al
+  8015e8:	74 14                	je     8015fe <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  8015ea:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  8015ee:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8015f3:	5b                   	pop    %rbx
+  8015f4:	41 5c                	pop    %r12
+  8015f6:	5d                   	pop    %rbp
+  8015f7:	c3                   	ret
+        return -E_INVAL;
+  8015f8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8015fd:	c3                   	ret
+        return -E_INVAL;
+  8015fe:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801603:	eb ee                	jmp    8015f3 <fd_lookup+0x39>
+
+0000000000801605 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  801605:	55                   	push   %rbp
+  801606:	48 89 e5             	mov    %rsp,%rbp
+  801609:	41 54                	push   %r12
+  80160b:	53                   	push   %rbx
+  80160c:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  80160f:	48 b8 00 33 80 00 00 	movabs $0x803300,%rax
+  801616:	00 00 00 
+  801619:	48 bb 20 40 80 00 00 	movabs $0x804020,%rbx
+  801620:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  801623:	39 3b                	cmp    %edi,(%rbx)
+  801625:	74 47                	je     80166e <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  801627:	48 83 c0 08          	add    $0x8,%rax
+  80162b:	48 8b 18             	mov    (%rax),%rbx
+  80162e:	48 85 db             	test   %rbx,%rbx
+  801631:	75 f0                	jne    801623 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801633:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  80163a:	00 00 00 
+  80163d:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+  801643:	89 fa                	mov    %edi,%edx
+  801645:	48 bf 80 32 80 00 00 	movabs $0x803280,%rdi
+  80164c:	00 00 00 
+  80164f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801654:	48 b9 e9 01 80 00 00 	movabs $0x8001e9,%rcx
+  80165b:	00 00 00 
+  80165e:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  801660:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  801665:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  801669:	5b                   	pop    %rbx
+  80166a:	41 5c                	pop    %r12
+  80166c:	5d                   	pop    %rbp
+  80166d:	c3                   	ret
+            return 0;
+  80166e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801673:	eb f0                	jmp    801665 <dev_lookup+0x60>
+
+0000000000801675 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  801675:	55                   	push   %rbp
+  801676:	48 89 e5             	mov    %rsp,%rbp
+  801679:	41 55                	push   %r13
+  80167b:	41 54                	push   %r12
+  80167d:	53                   	push   %rbx
+  80167e:	48 83 ec 18          	sub    $0x18,%rsp
+  801682:	48 89 fb             	mov    %rdi,%rbx
+  801685:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801688:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  80168f:	ff ff ff 
+  801692:	48 01 df             	add    %rbx,%rdi
+  801695:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  801699:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80169d:	48 b8 ba 15 80 00 00 	movabs $0x8015ba,%rax
+  8016a4:	00 00 00 
+  8016a7:	ff d0                	call   *%rax
+  8016a9:	41 89 c5             	mov    %eax,%r13d
+  8016ac:	85 c0                	test   %eax,%eax
+  8016ae:	78 06                	js     8016b6 <fd_close+0x41>
+  8016b0:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  8016b4:	74 1a                	je     8016d0 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  8016b6:	45 84 e4             	test   %r12b,%r12b
+  8016b9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016be:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  8016c2:	44 89 e8             	mov    %r13d,%eax
+  8016c5:	48 83 c4 18          	add    $0x18,%rsp
+  8016c9:	5b                   	pop    %rbx
+  8016ca:	41 5c                	pop    %r12
+  8016cc:	41 5d                	pop    %r13
+  8016ce:	5d                   	pop    %rbp
+  8016cf:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8016d0:	8b 3b                	mov    (%rbx),%edi
+  8016d2:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8016d6:	48 b8 05 16 80 00 00 	movabs $0x801605,%rax
+  8016dd:	00 00 00 
+  8016e0:	ff d0                	call   *%rax
+  8016e2:	41 89 c5             	mov    %eax,%r13d
+  8016e5:	85 c0                	test   %eax,%eax
+  8016e7:	78 1b                	js     801704 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  8016e9:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8016ed:	48 8b 40 20          	mov    0x20(%rax),%rax
+  8016f1:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  8016f7:	48 85 c0             	test   %rax,%rax
+  8016fa:	74 08                	je     801704 <fd_close+0x8f>
+  8016fc:	48 89 df             	mov    %rbx,%rdi
+  8016ff:	ff d0                	call   *%rax
+  801701:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801704:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801709:	48 89 de             	mov    %rbx,%rsi
+  80170c:	bf 00 00 00 00       	mov    $0x0,%edi
+  801711:	48 b8 8a 11 80 00 00 	movabs $0x80118a,%rax
+  801718:	00 00 00 
+  80171b:	ff d0                	call   *%rax
+    return res;
+  80171d:	eb a3                	jmp    8016c2 <fd_close+0x4d>
+
+000000000080171f <close>:
+
+int
+close(int fdnum) {
+  80171f:	55                   	push   %rbp
+  801720:	48 89 e5             	mov    %rsp,%rbp
+  801723:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  801727:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80172b:	48 b8 ba 15 80 00 00 	movabs $0x8015ba,%rax
+  801732:	00 00 00 
+  801735:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801737:	85 c0                	test   %eax,%eax
+  801739:	78 15                	js     801750 <close+0x31>
+
+    return fd_close(fd, 1);
+  80173b:	be 01 00 00 00       	mov    $0x1,%esi
+  801740:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801744:	48 b8 75 16 80 00 00 	movabs $0x801675,%rax
+  80174b:	00 00 00 
+  80174e:	ff d0                	call   *%rax
+}
+  801750:	c9                   	leave
+  801751:	c3                   	ret
+
+0000000000801752 <close_all>:
+
+void
+close_all(void) {
+  801752:	55                   	push   %rbp
+  801753:	48 89 e5             	mov    %rsp,%rbp
+  801756:	41 54                	push   %r12
+  801758:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  801759:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80175e:	49 bc 1f 17 80 00 00 	movabs $0x80171f,%r12
+  801765:	00 00 00 
+  801768:	89 df                	mov    %ebx,%edi
+  80176a:	41 ff d4             	call   *%r12
+  80176d:	83 c3 01             	add    $0x1,%ebx
+  801770:	83 fb 20             	cmp    $0x20,%ebx
+  801773:	75 f3                	jne    801768 <close_all+0x16>
+}
+  801775:	5b                   	pop    %rbx
+  801776:	41 5c                	pop    %r12
+  801778:	5d                   	pop    %rbp
+  801779:	c3                   	ret
+
+000000000080177a <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  80177a:	55                   	push   %rbp
+  80177b:	48 89 e5             	mov    %rsp,%rbp
+  80177e:	41 57                	push   %r15
+  801780:	41 56                	push   %r14
+  801782:	41 55                	push   %r13
+  801784:	41 54                	push   %r12
+  801786:	53                   	push   %rbx
+  801787:	48 83 ec 18          	sub    $0x18,%rsp
+  80178b:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  80178e:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801792:	48 b8 ba 15 80 00 00 	movabs $0x8015ba,%rax
+  801799:	00 00 00 
+  80179c:	ff d0                	call   *%rax
+  80179e:	89 c3                	mov    %eax,%ebx
+  8017a0:	85 c0                	test   %eax,%eax
+  8017a2:	0f 88 b8 00 00 00    	js     801860 <dup+0xe6>
+    close(newfdnum);
+  8017a8:	44 89 e7             	mov    %r12d,%edi
+  8017ab:	48 b8 1f 17 80 00 00 	movabs $0x80171f,%rax
+  8017b2:	00 00 00 
+  8017b5:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  8017b7:	4d 63 ec             	movslq %r12d,%r13
+  8017ba:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  8017c1:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  8017c5:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  8017c9:	4c 89 ff             	mov    %r15,%rdi
+  8017cc:	49 be 0b 15 80 00 00 	movabs $0x80150b,%r14
+  8017d3:	00 00 00 
+  8017d6:	41 ff d6             	call   *%r14
+  8017d9:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  8017dc:	4c 89 ef             	mov    %r13,%rdi
+  8017df:	41 ff d6             	call   *%r14
+  8017e2:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  8017e5:	48 89 df             	mov    %rbx,%rdi
+  8017e8:	48 b8 30 26 80 00 00 	movabs $0x802630,%rax
+  8017ef:	00 00 00 
+  8017f2:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  8017f4:	a8 04                	test   $0x4,%al
+  8017f6:	74 2b                	je     801823 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  8017f8:	41 89 c1             	mov    %eax,%r9d
+  8017fb:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801801:	4c 89 f1             	mov    %r14,%rcx
+  801804:	ba 00 00 00 00       	mov    $0x0,%edx
+  801809:	48 89 de             	mov    %rbx,%rsi
+  80180c:	bf 00 00 00 00       	mov    $0x0,%edi
+  801811:	48 b8 25 11 80 00 00 	movabs $0x801125,%rax
+  801818:	00 00 00 
+  80181b:	ff d0                	call   *%rax
+  80181d:	89 c3                	mov    %eax,%ebx
+  80181f:	85 c0                	test   %eax,%eax
+  801821:	78 4e                	js     801871 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  801823:	4c 89 ff             	mov    %r15,%rdi
+  801826:	48 b8 30 26 80 00 00 	movabs $0x802630,%rax
+  80182d:	00 00 00 
+  801830:	ff d0                	call   *%rax
+  801832:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801835:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  80183b:	4c 89 e9             	mov    %r13,%rcx
+  80183e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801843:	4c 89 fe             	mov    %r15,%rsi
+  801846:	bf 00 00 00 00       	mov    $0x0,%edi
+  80184b:	48 b8 25 11 80 00 00 	movabs $0x801125,%rax
+  801852:	00 00 00 
+  801855:	ff d0                	call   *%rax
+  801857:	89 c3                	mov    %eax,%ebx
+  801859:	85 c0                	test   %eax,%eax
+  80185b:	78 14                	js     801871 <dup+0xf7>
+
+    return newfdnum;
+  80185d:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  801860:	89 d8                	mov    %ebx,%eax
+  801862:	48 83 c4 18          	add    $0x18,%rsp
+  801866:	5b                   	pop    %rbx
+  801867:	41 5c                	pop    %r12
+  801869:	41 5d                	pop    %r13
+  80186b:	41 5e                	pop    %r14
+  80186d:	41 5f                	pop    %r15
+  80186f:	5d                   	pop    %rbp
+  801870:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  801871:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801876:	4c 89 ee             	mov    %r13,%rsi
+  801879:	bf 00 00 00 00       	mov    $0x0,%edi
+  80187e:	49 bc 8a 11 80 00 00 	movabs $0x80118a,%r12
+  801885:	00 00 00 
+  801888:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  80188b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801890:	4c 89 f6             	mov    %r14,%rsi
+  801893:	bf 00 00 00 00       	mov    $0x0,%edi
+  801898:	41 ff d4             	call   *%r12
+    return res;
+  80189b:	eb c3                	jmp    801860 <dup+0xe6>
+
+000000000080189d <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  80189d:	55                   	push   %rbp
+  80189e:	48 89 e5             	mov    %rsp,%rbp
+  8018a1:	41 56                	push   %r14
+  8018a3:	41 55                	push   %r13
+  8018a5:	41 54                	push   %r12
+  8018a7:	53                   	push   %rbx
+  8018a8:	48 83 ec 10          	sub    $0x10,%rsp
+  8018ac:	89 fb                	mov    %edi,%ebx
+  8018ae:	49 89 f4             	mov    %rsi,%r12
+  8018b1:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8018b4:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8018b8:	48 b8 ba 15 80 00 00 	movabs $0x8015ba,%rax
+  8018bf:	00 00 00 
+  8018c2:	ff d0                	call   *%rax
+  8018c4:	85 c0                	test   %eax,%eax
+  8018c6:	78 4c                	js     801914 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8018c8:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  8018cc:	41 8b 3e             	mov    (%r14),%edi
+  8018cf:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8018d3:	48 b8 05 16 80 00 00 	movabs $0x801605,%rax
+  8018da:	00 00 00 
+  8018dd:	ff d0                	call   *%rax
+  8018df:	85 c0                	test   %eax,%eax
+  8018e1:	78 35                	js     801918 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8018e3:	41 8b 46 08          	mov    0x8(%r14),%eax
+  8018e7:	83 e0 03             	and    $0x3,%eax
+  8018ea:	83 f8 01             	cmp    $0x1,%eax
+  8018ed:	74 2d                	je     80191c <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  8018ef:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8018f3:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8018f7:	48 85 c0             	test   %rax,%rax
+  8018fa:	74 56                	je     801952 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  8018fc:	4c 89 ea             	mov    %r13,%rdx
+  8018ff:	4c 89 e6             	mov    %r12,%rsi
+  801902:	4c 89 f7             	mov    %r14,%rdi
+  801905:	ff d0                	call   *%rax
+}
+  801907:	48 83 c4 10          	add    $0x10,%rsp
+  80190b:	5b                   	pop    %rbx
+  80190c:	41 5c                	pop    %r12
+  80190e:	41 5d                	pop    %r13
+  801910:	41 5e                	pop    %r14
+  801912:	5d                   	pop    %rbp
+  801913:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801914:	48 98                	cltq
+  801916:	eb ef                	jmp    801907 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801918:	48 98                	cltq
+  80191a:	eb eb                	jmp    801907 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  80191c:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801923:	00 00 00 
+  801926:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+  80192c:	89 da                	mov    %ebx,%edx
+  80192e:	48 bf c1 32 80 00 00 	movabs $0x8032c1,%rdi
+  801935:	00 00 00 
+  801938:	b8 00 00 00 00       	mov    $0x0,%eax
+  80193d:	48 b9 e9 01 80 00 00 	movabs $0x8001e9,%rcx
+  801944:	00 00 00 
+  801947:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801949:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801950:	eb b5                	jmp    801907 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801952:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801959:	eb ac                	jmp    801907 <read+0x6a>
+
+000000000080195b <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  80195b:	55                   	push   %rbp
+  80195c:	48 89 e5             	mov    %rsp,%rbp
+  80195f:	41 57                	push   %r15
+  801961:	41 56                	push   %r14
+  801963:	41 55                	push   %r13
+  801965:	41 54                	push   %r12
+  801967:	53                   	push   %rbx
+  801968:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  80196c:	48 85 d2             	test   %rdx,%rdx
+  80196f:	74 54                	je     8019c5 <readn+0x6a>
+  801971:	41 89 fd             	mov    %edi,%r13d
+  801974:	49 89 f6             	mov    %rsi,%r14
+  801977:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  80197a:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  80197f:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  801984:	49 bf 9d 18 80 00 00 	movabs $0x80189d,%r15
+  80198b:	00 00 00 
+  80198e:	4c 89 e2             	mov    %r12,%rdx
+  801991:	48 29 f2             	sub    %rsi,%rdx
+  801994:	4c 01 f6             	add    %r14,%rsi
+  801997:	44 89 ef             	mov    %r13d,%edi
+  80199a:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  80199d:	85 c0                	test   %eax,%eax
+  80199f:	78 20                	js     8019c1 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  8019a1:	01 c3                	add    %eax,%ebx
+  8019a3:	85 c0                	test   %eax,%eax
+  8019a5:	74 08                	je     8019af <readn+0x54>
+  8019a7:	48 63 f3             	movslq %ebx,%rsi
+  8019aa:	4c 39 e6             	cmp    %r12,%rsi
+  8019ad:	72 df                	jb     80198e <readn+0x33>
+    }
+    return res;
+  8019af:	48 63 c3             	movslq %ebx,%rax
+}
+  8019b2:	48 83 c4 08          	add    $0x8,%rsp
+  8019b6:	5b                   	pop    %rbx
+  8019b7:	41 5c                	pop    %r12
+  8019b9:	41 5d                	pop    %r13
+  8019bb:	41 5e                	pop    %r14
+  8019bd:	41 5f                	pop    %r15
+  8019bf:	5d                   	pop    %rbp
+  8019c0:	c3                   	ret
+        if (inc < 0) return inc;
+  8019c1:	48 98                	cltq
+  8019c3:	eb ed                	jmp    8019b2 <readn+0x57>
+    int inc = 1, res = 0;
+  8019c5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8019ca:	eb e3                	jmp    8019af <readn+0x54>
+
+00000000008019cc <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  8019cc:	55                   	push   %rbp
+  8019cd:	48 89 e5             	mov    %rsp,%rbp
+  8019d0:	41 56                	push   %r14
+  8019d2:	41 55                	push   %r13
+  8019d4:	41 54                	push   %r12
+  8019d6:	53                   	push   %rbx
+  8019d7:	48 83 ec 10          	sub    $0x10,%rsp
+  8019db:	89 fb                	mov    %edi,%ebx
+  8019dd:	49 89 f4             	mov    %rsi,%r12
+  8019e0:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8019e3:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8019e7:	48 b8 ba 15 80 00 00 	movabs $0x8015ba,%rax
+  8019ee:	00 00 00 
+  8019f1:	ff d0                	call   *%rax
+  8019f3:	85 c0                	test   %eax,%eax
+  8019f5:	78 47                	js     801a3e <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8019f7:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  8019fb:	41 8b 3e             	mov    (%r14),%edi
+  8019fe:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801a02:	48 b8 05 16 80 00 00 	movabs $0x801605,%rax
+  801a09:	00 00 00 
+  801a0c:	ff d0                	call   *%rax
+  801a0e:	85 c0                	test   %eax,%eax
+  801a10:	78 30                	js     801a42 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801a12:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  801a17:	74 2d                	je     801a46 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801a19:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801a1d:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801a21:	48 85 c0             	test   %rax,%rax
+  801a24:	74 56                	je     801a7c <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  801a26:	4c 89 ea             	mov    %r13,%rdx
+  801a29:	4c 89 e6             	mov    %r12,%rsi
+  801a2c:	4c 89 f7             	mov    %r14,%rdi
+  801a2f:	ff d0                	call   *%rax
+}
+  801a31:	48 83 c4 10          	add    $0x10,%rsp
+  801a35:	5b                   	pop    %rbx
+  801a36:	41 5c                	pop    %r12
+  801a38:	41 5d                	pop    %r13
+  801a3a:	41 5e                	pop    %r14
+  801a3c:	5d                   	pop    %rbp
+  801a3d:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801a3e:	48 98                	cltq
+  801a40:	eb ef                	jmp    801a31 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801a42:	48 98                	cltq
+  801a44:	eb eb                	jmp    801a31 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801a46:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801a4d:	00 00 00 
+  801a50:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+  801a56:	89 da                	mov    %ebx,%edx
+  801a58:	48 bf dd 32 80 00 00 	movabs $0x8032dd,%rdi
+  801a5f:	00 00 00 
+  801a62:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a67:	48 b9 e9 01 80 00 00 	movabs $0x8001e9,%rcx
+  801a6e:	00 00 00 
+  801a71:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801a73:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801a7a:	eb b5                	jmp    801a31 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801a7c:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801a83:	eb ac                	jmp    801a31 <write+0x65>
+
+0000000000801a85 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  801a85:	55                   	push   %rbp
+  801a86:	48 89 e5             	mov    %rsp,%rbp
+  801a89:	53                   	push   %rbx
+  801a8a:	48 83 ec 18          	sub    $0x18,%rsp
+  801a8e:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801a90:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801a94:	48 b8 ba 15 80 00 00 	movabs $0x8015ba,%rax
+  801a9b:	00 00 00 
+  801a9e:	ff d0                	call   *%rax
+  801aa0:	85 c0                	test   %eax,%eax
+  801aa2:	78 0c                	js     801ab0 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  801aa4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801aa8:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  801aab:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801ab0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801ab4:	c9                   	leave
+  801ab5:	c3                   	ret
+
+0000000000801ab6 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  801ab6:	55                   	push   %rbp
+  801ab7:	48 89 e5             	mov    %rsp,%rbp
+  801aba:	41 55                	push   %r13
+  801abc:	41 54                	push   %r12
+  801abe:	53                   	push   %rbx
+  801abf:	48 83 ec 18          	sub    $0x18,%rsp
+  801ac3:	89 fb                	mov    %edi,%ebx
+  801ac5:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801ac8:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801acc:	48 b8 ba 15 80 00 00 	movabs $0x8015ba,%rax
+  801ad3:	00 00 00 
+  801ad6:	ff d0                	call   *%rax
+  801ad8:	85 c0                	test   %eax,%eax
+  801ada:	78 38                	js     801b14 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801adc:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  801ae0:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  801ae4:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801ae8:	48 b8 05 16 80 00 00 	movabs $0x801605,%rax
+  801aef:	00 00 00 
+  801af2:	ff d0                	call   *%rax
+  801af4:	85 c0                	test   %eax,%eax
+  801af6:	78 1c                	js     801b14 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801af8:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  801afd:	74 20                	je     801b1f <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801aff:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801b03:	48 8b 40 30          	mov    0x30(%rax),%rax
+  801b07:	48 85 c0             	test   %rax,%rax
+  801b0a:	74 47                	je     801b53 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  801b0c:	44 89 e6             	mov    %r12d,%esi
+  801b0f:	4c 89 ef             	mov    %r13,%rdi
+  801b12:	ff d0                	call   *%rax
+}
+  801b14:	48 83 c4 18          	add    $0x18,%rsp
+  801b18:	5b                   	pop    %rbx
+  801b19:	41 5c                	pop    %r12
+  801b1b:	41 5d                	pop    %r13
+  801b1d:	5d                   	pop    %rbp
+  801b1e:	c3                   	ret
+                thisenv->env_id, fdnum);
+  801b1f:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801b26:	00 00 00 
+  801b29:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801b2f:	89 da                	mov    %ebx,%edx
+  801b31:	48 bf a0 32 80 00 00 	movabs $0x8032a0,%rdi
+  801b38:	00 00 00 
+  801b3b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b40:	48 b9 e9 01 80 00 00 	movabs $0x8001e9,%rcx
+  801b47:	00 00 00 
+  801b4a:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801b4c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801b51:	eb c1                	jmp    801b14 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801b53:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801b58:	eb ba                	jmp    801b14 <ftruncate+0x5e>
+
+0000000000801b5a <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  801b5a:	55                   	push   %rbp
+  801b5b:	48 89 e5             	mov    %rsp,%rbp
+  801b5e:	41 54                	push   %r12
+  801b60:	53                   	push   %rbx
+  801b61:	48 83 ec 10          	sub    $0x10,%rsp
+  801b65:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801b68:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801b6c:	48 b8 ba 15 80 00 00 	movabs $0x8015ba,%rax
+  801b73:	00 00 00 
+  801b76:	ff d0                	call   *%rax
+  801b78:	85 c0                	test   %eax,%eax
+  801b7a:	78 4e                	js     801bca <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801b7c:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801b80:	41 8b 3c 24          	mov    (%r12),%edi
+  801b84:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801b88:	48 b8 05 16 80 00 00 	movabs $0x801605,%rax
+  801b8f:	00 00 00 
+  801b92:	ff d0                	call   *%rax
+  801b94:	85 c0                	test   %eax,%eax
+  801b96:	78 32                	js     801bca <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801b98:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801b9c:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  801ba1:	74 30                	je     801bd3 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  801ba3:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  801ba6:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  801bad:	00 00 00 
+    stat->st_isdir = 0;
+  801bb0:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  801bb7:	00 00 00 
+    stat->st_dev = dev;
+  801bba:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  801bc1:	48 89 de             	mov    %rbx,%rsi
+  801bc4:	4c 89 e7             	mov    %r12,%rdi
+  801bc7:	ff 50 28             	call   *0x28(%rax)
+}
+  801bca:	48 83 c4 10          	add    $0x10,%rsp
+  801bce:	5b                   	pop    %rbx
+  801bcf:	41 5c                	pop    %r12
+  801bd1:	5d                   	pop    %rbp
+  801bd2:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801bd3:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801bd8:	eb f0                	jmp    801bca <fstat+0x70>
+
+0000000000801bda <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  801bda:	55                   	push   %rbp
+  801bdb:	48 89 e5             	mov    %rsp,%rbp
+  801bde:	41 54                	push   %r12
+  801be0:	53                   	push   %rbx
+  801be1:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  801be4:	be 00 00 00 00       	mov    $0x0,%esi
+  801be9:	48 b8 bd 1f 80 00 00 	movabs $0x801fbd,%rax
+  801bf0:	00 00 00 
+  801bf3:	ff d0                	call   *%rax
+  801bf5:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  801bf7:	85 c0                	test   %eax,%eax
+  801bf9:	78 25                	js     801c20 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  801bfb:	4c 89 e6             	mov    %r12,%rsi
+  801bfe:	89 c7                	mov    %eax,%edi
+  801c00:	48 b8 5a 1b 80 00 00 	movabs $0x801b5a,%rax
+  801c07:	00 00 00 
+  801c0a:	ff d0                	call   *%rax
+  801c0c:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  801c0f:	89 df                	mov    %ebx,%edi
+  801c11:	48 b8 1f 17 80 00 00 	movabs $0x80171f,%rax
+  801c18:	00 00 00 
+  801c1b:	ff d0                	call   *%rax
+
+    return res;
+  801c1d:	44 89 e3             	mov    %r12d,%ebx
+}
+  801c20:	89 d8                	mov    %ebx,%eax
+  801c22:	5b                   	pop    %rbx
+  801c23:	41 5c                	pop    %r12
+  801c25:	5d                   	pop    %rbp
+  801c26:	c3                   	ret
+
+0000000000801c27 <fsipc>:
+ * response may be written back to fsipcbuf.
+ * type: request code, passed as the simple integer IPC value.
+ * dstva: virtual address at which to receive reply page, 0 if none.
+ * Returns result from the file server. */
+static int
+fsipc(unsigned type, void *dstva) {
+  801c27:	55                   	push   %rbp
+  801c28:	48 89 e5             	mov    %rsp,%rbp
+  801c2b:	41 54                	push   %r12
+  801c2d:	53                   	push   %rbx
+  801c2e:	48 83 ec 10          	sub    $0x10,%rsp
+  801c32:	41 89 fc             	mov    %edi,%r12d
+  801c35:	48 89 f3             	mov    %rsi,%rbx
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  801c38:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  801c3f:	00 00 00 
+  801c42:	83 38 00             	cmpl   $0x0,(%rax)
+  801c45:	74 5e                	je     801ca5 <fsipc+0x7e>
+    if (debug) {
+        cprintf("[%08x] fsipc %d %08x\n",
+                thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+    }
+
+    ipc_send(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW);
+  801c47:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  801c4d:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  801c52:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  801c59:	00 00 00 
+  801c5c:	44 89 e6             	mov    %r12d,%esi
+  801c5f:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  801c66:	00 00 00 
+  801c69:	8b 38                	mov    (%rax),%edi
+  801c6b:	48 b8 c7 2b 80 00 00 	movabs $0x802bc7,%rax
+  801c72:	00 00 00 
+  801c75:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  801c77:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  801c7e:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  801c7f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801c84:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  801c88:	48 89 de             	mov    %rbx,%rsi
+  801c8b:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c90:	48 b8 f2 2a 80 00 00 	movabs $0x802af2,%rax
+  801c97:	00 00 00 
+  801c9a:	ff d0                	call   *%rax
+}
+  801c9c:	48 83 c4 10          	add    $0x10,%rsp
+  801ca0:	5b                   	pop    %rbx
+  801ca1:	41 5c                	pop    %r12
+  801ca3:	5d                   	pop    %rbp
+  801ca4:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  801ca5:	bf 03 00 00 00       	mov    $0x3,%edi
+  801caa:	48 b8 6a 2c 80 00 00 	movabs $0x802c6a,%rax
+  801cb1:	00 00 00 
+  801cb4:	ff d0                	call   *%rax
+  801cb6:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  801cbd:	00 00 
+  801cbf:	eb 86                	jmp    801c47 <fsipc+0x20>
+
+0000000000801cc1 <devfile_trunc>:
+    return 0;
+}
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  801cc1:	55                   	push   %rbp
+  801cc2:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801cc5:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  801ccc:	00 00 00 
+  801ccf:	8b 57 0c             	mov    0xc(%rdi),%edx
+  801cd2:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  801cd4:	89 70 04             	mov    %esi,0x4(%rax)
+
+    return fsipc(FSREQ_SET_SIZE, NULL);
+  801cd7:	be 00 00 00 00       	mov    $0x0,%esi
+  801cdc:	bf 02 00 00 00       	mov    $0x2,%edi
+  801ce1:	48 b8 27 1c 80 00 00 	movabs $0x801c27,%rax
+  801ce8:	00 00 00 
+  801ceb:	ff d0                	call   *%rax
+}
+  801ced:	5d                   	pop    %rbp
+  801cee:	c3                   	ret
+
+0000000000801cef <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  801cef:	55                   	push   %rbp
+  801cf0:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801cf3:	8b 47 0c             	mov    0xc(%rdi),%eax
+  801cf6:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  801cfd:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  801cff:	be 00 00 00 00       	mov    $0x0,%esi
+  801d04:	bf 06 00 00 00       	mov    $0x6,%edi
+  801d09:	48 b8 27 1c 80 00 00 	movabs $0x801c27,%rax
+  801d10:	00 00 00 
+  801d13:	ff d0                	call   *%rax
+}
+  801d15:	5d                   	pop    %rbp
+  801d16:	c3                   	ret
+
+0000000000801d17 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  801d17:	55                   	push   %rbp
+  801d18:	48 89 e5             	mov    %rsp,%rbp
+  801d1b:	41 54                	push   %r12
+  801d1d:	53                   	push   %rbx
+  801d1e:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801d21:	8b 47 0c             	mov    0xc(%rdi),%eax
+  801d24:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  801d2b:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  801d2d:	be 00 00 00 00       	mov    $0x0,%esi
+  801d32:	bf 05 00 00 00       	mov    $0x5,%edi
+  801d37:	48 b8 27 1c 80 00 00 	movabs $0x801c27,%rax
+  801d3e:	00 00 00 
+  801d41:	ff d0                	call   *%rax
+    if (res < 0) {
+  801d43:	85 c0                	test   %eax,%eax
+  801d45:	78 3d                	js     801d84 <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801d47:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  801d4e:	00 00 00 
+  801d51:	4c 89 e6             	mov    %r12,%rsi
+  801d54:	48 89 df             	mov    %rbx,%rdi
+  801d57:	48 b8 0e 0b 80 00 00 	movabs $0x800b0e,%rax
+  801d5e:	00 00 00 
+  801d61:	ff d0                	call   *%rax
+    st->st_size  = fsipcbuf.statRet.ret_size;
+  801d63:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  801d6a:	00 
+  801d6b:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801d71:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  801d78:	00 
+  801d79:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  801d7f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801d84:	5b                   	pop    %rbx
+  801d85:	41 5c                	pop    %r12
+  801d87:	5d                   	pop    %rbp
+  801d88:	c3                   	ret
+
+0000000000801d89 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  801d89:	55                   	push   %rbp
+  801d8a:	48 89 e5             	mov    %rsp,%rbp
+  801d8d:	41 57                	push   %r15
+  801d8f:	41 56                	push   %r14
+  801d91:	41 55                	push   %r13
+  801d93:	41 54                	push   %r12
+  801d95:	53                   	push   %rbx
+  801d96:	48 83 ec 18          	sub    $0x18,%rsp
+  801d9a:	49 89 fe             	mov    %rdi,%r14
+  801d9d:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+  801da1:	48 89 d3             	mov    %rdx,%rbx
+    while (n > sizeof(fsipcbuf.write.req_buf))
+  801da4:	48 81 fa f0 0f 00 00 	cmp    $0xff0,%rdx
+  801dab:	0f 86 e4 00 00 00    	jbe    801e95 <devfile_write+0x10c>
+  801db1:	49 89 f4             	mov    %rsi,%r12
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801db4:	49 bd 00 60 80 00 00 	movabs $0x806000,%r13
+  801dbb:	00 00 00 
+        memcpy(fsipcbuf.write.req_buf, buf, sizeof(fsipcbuf.write.req_buf));
+  801dbe:	49 bf 6f 0d 80 00 00 	movabs $0x800d6f,%r15
+  801dc5:	00 00 00 
+  801dc8:	eb 03                	jmp    801dcd <devfile_write+0x44>
+        buf += sizeof(fsipcbuf.write.req_buf);
+  801dca:	49 89 f4             	mov    %rsi,%r12
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801dcd:	41 8b 46 0c          	mov    0xc(%r14),%eax
+  801dd1:	41 89 45 00          	mov    %eax,0x0(%r13)
+        fsipcbuf.write.req_n      = sizeof(fsipcbuf.write.req_buf);
+  801dd5:	49 c7 45 08 f0 0f 00 	movq   $0xff0,0x8(%r13)
+  801ddc:	00 
+        memcpy(fsipcbuf.write.req_buf, buf, sizeof(fsipcbuf.write.req_buf));
+  801ddd:	ba f0 0f 00 00       	mov    $0xff0,%edx
+  801de2:	4c 89 e6             	mov    %r12,%rsi
+  801de5:	48 bf 10 60 80 00 00 	movabs $0x806010,%rdi
+  801dec:	00 00 00 
+  801def:	41 ff d7             	call   *%r15
+        ssize_t res = fsipc(FSREQ_WRITE, NULL);
+  801df2:	be 00 00 00 00       	mov    $0x0,%esi
+  801df7:	bf 04 00 00 00       	mov    $0x4,%edi
+  801dfc:	48 b8 27 1c 80 00 00 	movabs $0x801c27,%rax
+  801e03:	00 00 00 
+  801e06:	ff d0                	call   *%rax
+  801e08:	48 63 d0             	movslq %eax,%rdx
+        if (res < 0 || res < sizeof(fsipcbuf.write.req_buf))
+  801e0b:	3d ef 0f 00 00       	cmp    $0xfef,%eax
+  801e10:	7e 71                	jle    801e83 <devfile_write+0xfa>
+        buf += sizeof(fsipcbuf.write.req_buf);
+  801e12:	49 8d b4 24 f0 0f 00 	lea    0xff0(%r12),%rsi
+  801e19:	00 
+        n -= sizeof(fsipcbuf.write.req_buf);
+  801e1a:	48 81 eb f0 0f 00 00 	sub    $0xff0,%rbx
+    while (n > sizeof(fsipcbuf.write.req_buf))
+  801e21:	48 81 fb f0 0f 00 00 	cmp    $0xff0,%rbx
+  801e28:	77 a0                	ja     801dca <devfile_write+0x41>
+        written += sizeof(fsipcbuf.write.req_buf);
+  801e2a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801e2e:	49 29 c4             	sub    %rax,%r12
+  801e31:	4d 8d a4 24 f0 0f 00 	lea    0xff0(%r12),%r12
+  801e38:	00 
+    fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801e39:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  801e40:	00 00 00 
+  801e43:	41 8b 56 0c          	mov    0xc(%r14),%edx
+  801e47:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.write.req_n      = n;
+  801e49:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    memcpy(fsipcbuf.write.req_buf, buf, n);
+  801e4d:	48 89 da             	mov    %rbx,%rdx
+  801e50:	48 8d 78 10          	lea    0x10(%rax),%rdi
+  801e54:	48 b8 6f 0d 80 00 00 	movabs $0x800d6f,%rax
+  801e5b:	00 00 00 
+  801e5e:	ff d0                	call   *%rax
+    ssize_t res = fsipc(FSREQ_WRITE, NULL);
+  801e60:	be 00 00 00 00       	mov    $0x0,%esi
+  801e65:	bf 04 00 00 00       	mov    $0x4,%edi
+  801e6a:	48 b8 27 1c 80 00 00 	movabs $0x801c27,%rax
+  801e71:	00 00 00 
+  801e74:	ff d0                	call   *%rax
+  801e76:	48 63 d0             	movslq %eax,%rdx
+    written += res;
+  801e79:	49 01 d4             	add    %rdx,%r12
+  801e7c:	48 85 d2             	test   %rdx,%rdx
+  801e7f:	49 0f 49 d4          	cmovns %r12,%rdx
+}
+  801e83:	48 89 d0             	mov    %rdx,%rax
+  801e86:	48 83 c4 18          	add    $0x18,%rsp
+  801e8a:	5b                   	pop    %rbx
+  801e8b:	41 5c                	pop    %r12
+  801e8d:	41 5d                	pop    %r13
+  801e8f:	41 5e                	pop    %r14
+  801e91:	41 5f                	pop    %r15
+  801e93:	5d                   	pop    %rbp
+  801e94:	c3                   	ret
+    while (n > sizeof(fsipcbuf.write.req_buf))
+  801e95:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+    ssize_t written = 0;
+  801e99:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  801e9f:	eb 98                	jmp    801e39 <devfile_write+0xb0>
+
+0000000000801ea1 <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  801ea1:	55                   	push   %rbp
+  801ea2:	48 89 e5             	mov    %rsp,%rbp
+  801ea5:	41 57                	push   %r15
+  801ea7:	41 56                	push   %r14
+  801ea9:	41 55                	push   %r13
+  801eab:	41 54                	push   %r12
+  801ead:	53                   	push   %rbx
+  801eae:	48 83 ec 18          	sub    $0x18,%rsp
+  801eb2:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  801eb6:	49 89 f6             	mov    %rsi,%r14
+  801eb9:	49 89 d4             	mov    %rdx,%r12
+    while (n > sizeof(fsipcbuf.readRet.ret_buf))
+  801ebc:	48 81 fa 00 10 00 00 	cmp    $0x1000,%rdx
+  801ec3:	0f 86 ea 00 00 00    	jbe    801fb3 <devfile_read+0x112>
+    ssize_t readsz = 0;
+  801ec9:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  801ed0:	00 
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801ed1:	49 bf 00 60 80 00 00 	movabs $0x806000,%r15
+  801ed8:	00 00 00 
+  801edb:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801edf:	8b 40 0c             	mov    0xc(%rax),%eax
+  801ee2:	41 89 07             	mov    %eax,(%r15)
+        fsipcbuf.read.req_n = sizeof(fsipcbuf.readRet.ret_buf);
+  801ee5:	49 c7 47 08 00 10 00 	movq   $0x1000,0x8(%r15)
+  801eec:	00 
+        ssize_t res = fsipc(FSREQ_READ, NULL);
+  801eed:	be 00 00 00 00       	mov    $0x0,%esi
+  801ef2:	bf 03 00 00 00       	mov    $0x3,%edi
+  801ef7:	48 b8 27 1c 80 00 00 	movabs $0x801c27,%rax
+  801efe:	00 00 00 
+  801f01:	ff d0                	call   *%rax
+  801f03:	4c 63 e8             	movslq %eax,%r13
+        if (res < 0)
+  801f06:	4d 85 ed             	test   %r13,%r13
+  801f09:	0f 88 92 00 00 00    	js     801fa1 <devfile_read+0x100>
+        memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  801f0f:	4c 89 ea             	mov    %r13,%rdx
+  801f12:	4c 89 fe             	mov    %r15,%rsi
+  801f15:	4c 89 f7             	mov    %r14,%rdi
+  801f18:	48 b8 6f 0d 80 00 00 	movabs $0x800d6f,%rax
+  801f1f:	00 00 00 
+  801f22:	ff d0                	call   *%rax
+        if (res < sizeof(fsipcbuf.readRet.ret_buf))
+  801f24:	49 81 fd ff 0f 00 00 	cmp    $0xfff,%r13
+  801f2b:	76 6d                	jbe    801f9a <devfile_read+0xf9>
+        readsz += res;
+  801f2d:	4c 01 6d c0          	add    %r13,-0x40(%rbp)
+        buf += res;
+  801f31:	4d 01 ee             	add    %r13,%r14
+        n -= res;
+  801f34:	4d 29 ec             	sub    %r13,%r12
+    while (n > sizeof(fsipcbuf.readRet.ret_buf))
+  801f37:	49 81 fc 00 10 00 00 	cmp    $0x1000,%r12
+  801f3e:	77 9b                	ja     801edb <devfile_read+0x3a>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801f40:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  801f47:	00 00 00 
+  801f4a:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  801f4e:	8b 51 0c             	mov    0xc(%rcx),%edx
+  801f51:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.read.req_n = n;
+  801f53:	4c 89 60 08          	mov    %r12,0x8(%rax)
+    ssize_t res = fsipc(FSREQ_READ, NULL);
+  801f57:	be 00 00 00 00       	mov    $0x0,%esi
+  801f5c:	bf 03 00 00 00       	mov    $0x3,%edi
+  801f61:	48 b8 27 1c 80 00 00 	movabs $0x801c27,%rax
+  801f68:	00 00 00 
+  801f6b:	ff d0                	call   *%rax
+  801f6d:	4c 63 e8             	movslq %eax,%r13
+    if (res < 0)
+  801f70:	4d 85 ed             	test   %r13,%r13
+  801f73:	78 2c                	js     801fa1 <devfile_read+0x100>
+    memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  801f75:	4c 89 ea             	mov    %r13,%rdx
+  801f78:	48 be 00 60 80 00 00 	movabs $0x806000,%rsi
+  801f7f:	00 00 00 
+  801f82:	4c 89 f7             	mov    %r14,%rdi
+  801f85:	48 b8 6f 0d 80 00 00 	movabs $0x800d6f,%rax
+  801f8c:	00 00 00 
+  801f8f:	ff d0                	call   *%rax
+    readsz += res;
+  801f91:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  801f95:	49 01 c5             	add    %rax,%r13
+    return readsz;
+  801f98:	eb 07                	jmp    801fa1 <devfile_read+0x100>
+            return readsz + res;
+  801f9a:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  801f9e:	49 01 c5             	add    %rax,%r13
+}
+  801fa1:	4c 89 e8             	mov    %r13,%rax
+  801fa4:	48 83 c4 18          	add    $0x18,%rsp
+  801fa8:	5b                   	pop    %rbx
+  801fa9:	41 5c                	pop    %r12
+  801fab:	41 5d                	pop    %r13
+  801fad:	41 5e                	pop    %r14
+  801faf:	41 5f                	pop    %r15
+  801fb1:	5d                   	pop    %rbp
+  801fb2:	c3                   	ret
+    ssize_t readsz = 0;
+  801fb3:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  801fba:	00 
+  801fbb:	eb 83                	jmp    801f40 <devfile_read+0x9f>
+
+0000000000801fbd <open>:
+open(const char *path, int mode) {
+  801fbd:	55                   	push   %rbp
+  801fbe:	48 89 e5             	mov    %rsp,%rbp
+  801fc1:	41 55                	push   %r13
+  801fc3:	41 54                	push   %r12
+  801fc5:	53                   	push   %rbx
+  801fc6:	48 83 ec 18          	sub    $0x18,%rsp
+  801fca:	49 89 fc             	mov    %rdi,%r12
+  801fcd:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  801fd0:	48 b8 d0 0a 80 00 00 	movabs $0x800ad0,%rax
+  801fd7:	00 00 00 
+  801fda:	ff d0                	call   *%rax
+  801fdc:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  801fe2:	0f 87 8a 00 00 00    	ja     802072 <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  801fe8:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  801fec:	48 b8 a0 15 80 00 00 	movabs $0x8015a0,%rax
+  801ff3:	00 00 00 
+  801ff6:	ff d0                	call   *%rax
+  801ff8:	89 c3                	mov    %eax,%ebx
+  801ffa:	85 c0                	test   %eax,%eax
+  801ffc:	78 50                	js     80204e <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  801ffe:	4c 89 e6             	mov    %r12,%rsi
+  802001:	48 bb 00 60 80 00 00 	movabs $0x806000,%rbx
+  802008:	00 00 00 
+  80200b:	48 89 df             	mov    %rbx,%rdi
+  80200e:	48 b8 0e 0b 80 00 00 	movabs $0x800b0e,%rax
+  802015:	00 00 00 
+  802018:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  80201a:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  802021:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802025:	bf 01 00 00 00       	mov    $0x1,%edi
+  80202a:	48 b8 27 1c 80 00 00 	movabs $0x801c27,%rax
+  802031:	00 00 00 
+  802034:	ff d0                	call   *%rax
+  802036:	89 c3                	mov    %eax,%ebx
+  802038:	85 c0                	test   %eax,%eax
+  80203a:	78 1f                	js     80205b <open+0x9e>
+    return fd2num(fd);
+  80203c:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802040:	48 b8 f9 14 80 00 00 	movabs $0x8014f9,%rax
+  802047:	00 00 00 
+  80204a:	ff d0                	call   *%rax
+  80204c:	89 c3                	mov    %eax,%ebx
+}
+  80204e:	89 d8                	mov    %ebx,%eax
+  802050:	48 83 c4 18          	add    $0x18,%rsp
+  802054:	5b                   	pop    %rbx
+  802055:	41 5c                	pop    %r12
+  802057:	41 5d                	pop    %r13
+  802059:	5d                   	pop    %rbp
+  80205a:	c3                   	ret
+        fd_close(fd, 0);
+  80205b:	be 00 00 00 00       	mov    $0x0,%esi
+  802060:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802064:	48 b8 75 16 80 00 00 	movabs $0x801675,%rax
+  80206b:	00 00 00 
+  80206e:	ff d0                	call   *%rax
+        return res;
+  802070:	eb dc                	jmp    80204e <open+0x91>
+        return -E_BAD_PATH;
+  802072:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  802077:	eb d5                	jmp    80204e <open+0x91>
+
+0000000000802079 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  802079:	55                   	push   %rbp
+  80207a:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc(FSREQ_SYNC, NULL);
+  80207d:	be 00 00 00 00       	mov    $0x0,%esi
+  802082:	bf 08 00 00 00       	mov    $0x8,%edi
+  802087:	48 b8 27 1c 80 00 00 	movabs $0x801c27,%rax
+  80208e:	00 00 00 
+  802091:	ff d0                	call   *%rax
+}
+  802093:	5d                   	pop    %rbp
+  802094:	c3                   	ret
+
+0000000000802095 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  802095:	55                   	push   %rbp
+  802096:	48 89 e5             	mov    %rsp,%rbp
+  802099:	41 54                	push   %r12
+  80209b:	53                   	push   %rbx
+  80209c:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80209f:	48 b8 0b 15 80 00 00 	movabs $0x80150b,%rax
+  8020a6:	00 00 00 
+  8020a9:	ff d0                	call   *%rax
+  8020ab:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  8020ae:	48 be 20 33 80 00 00 	movabs $0x803320,%rsi
+  8020b5:	00 00 00 
+  8020b8:	48 89 df             	mov    %rbx,%rdi
+  8020bb:	48 b8 0e 0b 80 00 00 	movabs $0x800b0e,%rax
+  8020c2:	00 00 00 
+  8020c5:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  8020c7:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  8020cc:	41 2b 04 24          	sub    (%r12),%eax
+  8020d0:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  8020d6:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8020dd:	00 00 00 
+    stat->st_dev = &devpipe;
+  8020e0:	48 b8 60 40 80 00 00 	movabs $0x804060,%rax
+  8020e7:	00 00 00 
+  8020ea:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  8020f1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020f6:	5b                   	pop    %rbx
+  8020f7:	41 5c                	pop    %r12
+  8020f9:	5d                   	pop    %rbp
+  8020fa:	c3                   	ret
+
+00000000008020fb <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  8020fb:	55                   	push   %rbp
+  8020fc:	48 89 e5             	mov    %rsp,%rbp
+  8020ff:	41 54                	push   %r12
+  802101:	53                   	push   %rbx
+  802102:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  802105:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80210a:	48 89 fe             	mov    %rdi,%rsi
+  80210d:	bf 00 00 00 00       	mov    $0x0,%edi
+  802112:	49 bc 8a 11 80 00 00 	movabs $0x80118a,%r12
+  802119:	00 00 00 
+  80211c:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  80211f:	48 89 df             	mov    %rbx,%rdi
+  802122:	48 b8 0b 15 80 00 00 	movabs $0x80150b,%rax
+  802129:	00 00 00 
+  80212c:	ff d0                	call   *%rax
+  80212e:	48 89 c6             	mov    %rax,%rsi
+  802131:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802136:	bf 00 00 00 00       	mov    $0x0,%edi
+  80213b:	41 ff d4             	call   *%r12
+}
+  80213e:	5b                   	pop    %rbx
+  80213f:	41 5c                	pop    %r12
+  802141:	5d                   	pop    %rbp
+  802142:	c3                   	ret
+
+0000000000802143 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  802143:	55                   	push   %rbp
+  802144:	48 89 e5             	mov    %rsp,%rbp
+  802147:	41 57                	push   %r15
+  802149:	41 56                	push   %r14
+  80214b:	41 55                	push   %r13
+  80214d:	41 54                	push   %r12
+  80214f:	53                   	push   %rbx
+  802150:	48 83 ec 18          	sub    $0x18,%rsp
+  802154:	49 89 fc             	mov    %rdi,%r12
+  802157:	49 89 f5             	mov    %rsi,%r13
+  80215a:	49 89 d7             	mov    %rdx,%r15
+  80215d:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802161:	48 b8 0b 15 80 00 00 	movabs $0x80150b,%rax
+  802168:	00 00 00 
+  80216b:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  80216d:	4d 85 ff             	test   %r15,%r15
+  802170:	0f 84 af 00 00 00    	je     802225 <devpipe_write+0xe2>
+  802176:	48 89 c3             	mov    %rax,%rbx
+  802179:	4c 89 f8             	mov    %r15,%rax
+  80217c:	4d 89 ef             	mov    %r13,%r15
+  80217f:	4c 01 e8             	add    %r13,%rax
+  802182:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802186:	49 bd 92 10 80 00 00 	movabs $0x801092,%r13
+  80218d:	00 00 00 
+            sys_yield();
+  802190:	49 be 2f 10 80 00 00 	movabs $0x80102f,%r14
+  802197:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  80219a:	8b 73 04             	mov    0x4(%rbx),%esi
+  80219d:	48 63 ce             	movslq %esi,%rcx
+  8021a0:	48 63 03             	movslq (%rbx),%rax
+  8021a3:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  8021a9:	48 39 c1             	cmp    %rax,%rcx
+  8021ac:	72 2e                	jb     8021dc <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8021ae:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8021b3:	48 89 da             	mov    %rbx,%rdx
+  8021b6:	be 00 10 00 00       	mov    $0x1000,%esi
+  8021bb:	4c 89 e7             	mov    %r12,%rdi
+  8021be:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  8021c1:	85 c0                	test   %eax,%eax
+  8021c3:	74 66                	je     80222b <devpipe_write+0xe8>
+            sys_yield();
+  8021c5:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  8021c8:	8b 73 04             	mov    0x4(%rbx),%esi
+  8021cb:	48 63 ce             	movslq %esi,%rcx
+  8021ce:	48 63 03             	movslq (%rbx),%rax
+  8021d1:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  8021d7:	48 39 c1             	cmp    %rax,%rcx
+  8021da:	73 d2                	jae    8021ae <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8021dc:	41 0f b6 3f          	movzbl (%r15),%edi
+  8021e0:	48 89 ca             	mov    %rcx,%rdx
+  8021e3:	48 c1 ea 03          	shr    $0x3,%rdx
+  8021e7:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  8021ee:	08 10 20 
+  8021f1:	48 f7 e2             	mul    %rdx
+  8021f4:	48 c1 ea 06          	shr    $0x6,%rdx
+  8021f8:	48 89 d0             	mov    %rdx,%rax
+  8021fb:	48 c1 e0 09          	shl    $0x9,%rax
+  8021ff:	48 29 d0             	sub    %rdx,%rax
+  802202:	48 c1 e0 03          	shl    $0x3,%rax
+  802206:	48 29 c1             	sub    %rax,%rcx
+  802209:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  80220e:	83 c6 01             	add    $0x1,%esi
+  802211:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  802214:	49 83 c7 01          	add    $0x1,%r15
+  802218:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80221c:	49 39 c7             	cmp    %rax,%r15
+  80221f:	0f 85 75 ff ff ff    	jne    80219a <devpipe_write+0x57>
+    return n;
+  802225:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802229:	eb 05                	jmp    802230 <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  80222b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802230:	48 83 c4 18          	add    $0x18,%rsp
+  802234:	5b                   	pop    %rbx
+  802235:	41 5c                	pop    %r12
+  802237:	41 5d                	pop    %r13
+  802239:	41 5e                	pop    %r14
+  80223b:	41 5f                	pop    %r15
+  80223d:	5d                   	pop    %rbp
+  80223e:	c3                   	ret
+
+000000000080223f <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  80223f:	55                   	push   %rbp
+  802240:	48 89 e5             	mov    %rsp,%rbp
+  802243:	41 57                	push   %r15
+  802245:	41 56                	push   %r14
+  802247:	41 55                	push   %r13
+  802249:	41 54                	push   %r12
+  80224b:	53                   	push   %rbx
+  80224c:	48 83 ec 18          	sub    $0x18,%rsp
+  802250:	49 89 fc             	mov    %rdi,%r12
+  802253:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  802257:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80225b:	48 b8 0b 15 80 00 00 	movabs $0x80150b,%rax
+  802262:	00 00 00 
+  802265:	ff d0                	call   *%rax
+  802267:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  80226a:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802270:	49 bd 92 10 80 00 00 	movabs $0x801092,%r13
+  802277:	00 00 00 
+            sys_yield();
+  80227a:	49 be 2f 10 80 00 00 	movabs $0x80102f,%r14
+  802281:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  802284:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  802289:	74 7d                	je     802308 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  80228b:	8b 03                	mov    (%rbx),%eax
+  80228d:	3b 43 04             	cmp    0x4(%rbx),%eax
+  802290:	75 26                	jne    8022b8 <devpipe_read+0x79>
+            if (i > 0) return i;
+  802292:	4d 85 ff             	test   %r15,%r15
+  802295:	75 77                	jne    80230e <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802297:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80229c:	48 89 da             	mov    %rbx,%rdx
+  80229f:	be 00 10 00 00       	mov    $0x1000,%esi
+  8022a4:	4c 89 e7             	mov    %r12,%rdi
+  8022a7:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  8022aa:	85 c0                	test   %eax,%eax
+  8022ac:	74 72                	je     802320 <devpipe_read+0xe1>
+            sys_yield();
+  8022ae:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  8022b1:	8b 03                	mov    (%rbx),%eax
+  8022b3:	3b 43 04             	cmp    0x4(%rbx),%eax
+  8022b6:	74 df                	je     802297 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  8022b8:	48 63 c8             	movslq %eax,%rcx
+  8022bb:	48 89 ca             	mov    %rcx,%rdx
+  8022be:	48 c1 ea 03          	shr    $0x3,%rdx
+  8022c2:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  8022c9:	08 10 20 
+  8022cc:	48 89 d0             	mov    %rdx,%rax
+  8022cf:	48 f7 e6             	mul    %rsi
+  8022d2:	48 c1 ea 06          	shr    $0x6,%rdx
+  8022d6:	48 89 d0             	mov    %rdx,%rax
+  8022d9:	48 c1 e0 09          	shl    $0x9,%rax
+  8022dd:	48 29 d0             	sub    %rdx,%rax
+  8022e0:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  8022e7:	00 
+  8022e8:	48 89 c8             	mov    %rcx,%rax
+  8022eb:	48 29 d0             	sub    %rdx,%rax
+  8022ee:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  8022f3:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8022f7:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  8022fb:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8022fe:	49 83 c7 01          	add    $0x1,%r15
+  802302:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  802306:	75 83                	jne    80228b <devpipe_read+0x4c>
+    return n;
+  802308:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80230c:	eb 03                	jmp    802311 <devpipe_read+0xd2>
+            if (i > 0) return i;
+  80230e:	4c 89 f8             	mov    %r15,%rax
+}
+  802311:	48 83 c4 18          	add    $0x18,%rsp
+  802315:	5b                   	pop    %rbx
+  802316:	41 5c                	pop    %r12
+  802318:	41 5d                	pop    %r13
+  80231a:	41 5e                	pop    %r14
+  80231c:	41 5f                	pop    %r15
+  80231e:	5d                   	pop    %rbp
+  80231f:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  802320:	b8 00 00 00 00       	mov    $0x0,%eax
+  802325:	eb ea                	jmp    802311 <devpipe_read+0xd2>
+
+0000000000802327 <pipe>:
+pipe(int pfd[2]) {
+  802327:	55                   	push   %rbp
+  802328:	48 89 e5             	mov    %rsp,%rbp
+  80232b:	41 55                	push   %r13
+  80232d:	41 54                	push   %r12
+  80232f:	53                   	push   %rbx
+  802330:	48 81 ec b8 00 00 00 	sub    $0xb8,%rsp
+  802337:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  80233a:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  80233e:	48 b8 a0 15 80 00 00 	movabs $0x8015a0,%rax
+  802345:	00 00 00 
+  802348:	ff d0                	call   *%rax
+  80234a:	89 c3                	mov    %eax,%ebx
+  80234c:	85 c0                	test   %eax,%eax
+  80234e:	0f 88 51 01 00 00    	js     8024a5 <pipe+0x17e>
+        (res = fd_alloc_from(fd2num(fd0) + 1, &fd1)) < 0) goto err;
+  802354:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802358:	48 b8 f9 14 80 00 00 	movabs $0x8014f9,%rax
+  80235f:	00 00 00 
+  802362:	ff d0                	call   *%rax
+  802364:	8d 78 01             	lea    0x1(%rax),%edi
+  802367:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80236b:	48 b8 27 15 80 00 00 	movabs $0x801527,%rax
+  802372:	00 00 00 
+  802375:	ff d0                	call   *%rax
+  802377:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  802379:	85 c0                	test   %eax,%eax
+  80237b:	0f 88 24 01 00 00    	js     8024a5 <pipe+0x17e>
+    va = fd2data(fd0);
+  802381:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802385:	48 bb 0b 15 80 00 00 	movabs $0x80150b,%rbx
+  80238c:	00 00 00 
+  80238f:	ff d3                	call   *%rbx
+  802391:	49 89 c5             	mov    %rax,%r13
+    struct RegionOp ops[] = {
+  802394:	48 8d bd 30 ff ff ff 	lea    -0xd0(%rbp),%rdi
+  80239b:	b9 14 00 00 00       	mov    $0x14,%ecx
+  8023a0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023a5:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+  8023a8:	c7 85 34 ff ff ff 46 	movl   $0x46,-0xcc(%rbp)
+  8023af:	00 00 00 
+  8023b2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8023b6:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+  8023bd:	48 c7 85 50 ff ff ff 	movq   $0x1000,-0xb0(%rbp)
+  8023c4:	00 10 00 00 
+  8023c8:	c7 85 5c ff ff ff 46 	movl   $0x46,-0xa4(%rbp)
+  8023cf:	00 00 00 
+            {.type = REGION_ALLOC, .dstva = (uintptr_t)fd1, .size = PAGE_SIZE, .perm = PROT_RW | PROT_SHARE},
+  8023d2:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+    struct RegionOp ops[] = {
+  8023d6:	48 89 bd 70 ff ff ff 	mov    %rdi,-0x90(%rbp)
+  8023dd:	48 c7 85 78 ff ff ff 	movq   $0x1000,-0x88(%rbp)
+  8023e4:	00 10 00 00 
+  8023e8:	c7 45 84 46 00 00 00 	movl   $0x46,-0x7c(%rbp)
+  8023ef:	4c 89 6d 98          	mov    %r13,-0x68(%rbp)
+  8023f3:	48 c7 45 a0 00 10 00 	movq   $0x1000,-0x60(%rbp)
+  8023fa:	00 
+  8023fb:	c7 45 a8 01 00 00 00 	movl   $0x1,-0x58(%rbp)
+  802402:	c7 45 ac 46 00 00 00 	movl   $0x46,-0x54(%rbp)
+  802409:	4c 89 6d b8          	mov    %r13,-0x48(%rbp)
+            {.type = REGION_MAP, .srcva = (uintptr_t)va, .dstva = (uintptr_t)fd2data(fd1), .size = PAGE_SIZE, .perm = PROT_RW | PROT_SHARE},
+  80240d:	ff d3                	call   *%rbx
+    struct RegionOp ops[] = {
+  80240f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802413:	48 c7 45 c8 00 10 00 	movq   $0x1000,-0x38(%rbp)
+  80241a:	00 
+    if ((res = sys_region_batch(ops, sizeof ops / sizeof *ops)) < 0) goto err1;
+  80241b:	be 04 00 00 00       	mov    $0x4,%esi
+  802420:	48 8d bd 30 ff ff ff 	lea    -0xd0(%rbp),%rdi
+  802427:	48 b8 f1 11 80 00 00 	movabs $0x8011f1,%rax
+  80242e:	00 00 00 
+  802431:	ff d0                	call   *%rax
+  802433:	89 c3                	mov    %eax,%ebx
+  802435:	85 c0                	test   %eax,%eax
+  802437:	0f 88 ad 00 00 00    	js     8024ea <pipe+0x1c3>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  80243d:	be 00 10 00 00       	mov    $0x1000,%esi
+  802442:	4c 89 ef             	mov    %r13,%rdi
+  802445:	48 b8 60 10 80 00 00 	movabs $0x801060,%rax
+  80244c:	00 00 00 
+  80244f:	ff d0                	call   *%rax
+  802451:	83 f8 02             	cmp    $0x2,%eax
+  802454:	75 5f                	jne    8024b5 <pipe+0x18e>
+    fd0->fd_dev_id = devpipe.dev_id;
+  802456:	a1 60 40 80 00 00 00 	movabs 0x804060,%eax
+  80245d:	00 00 
+  80245f:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802463:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  802465:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802469:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  802470:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  802474:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  802476:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80247a:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  802481:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802485:	48 bb f9 14 80 00 00 	movabs $0x8014f9,%rbx
+  80248c:	00 00 00 
+  80248f:	ff d3                	call   *%rbx
+  802491:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  802495:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  802499:	ff d3                	call   *%rbx
+  80249b:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  8024a0:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  8024a5:	89 d8                	mov    %ebx,%eax
+  8024a7:	48 81 c4 b8 00 00 00 	add    $0xb8,%rsp
+  8024ae:	5b                   	pop    %rbx
+  8024af:	41 5c                	pop    %r12
+  8024b1:	41 5d                	pop    %r13
+  8024b3:	5d                   	pop    %rbp
+  8024b4:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8024b5:	48 b9 50 33 80 00 00 	movabs $0x803350,%rcx
+  8024bc:	00 00 00 
+  8024bf:	48 ba 27 33 80 00 00 	movabs $0x803327,%rdx
+  8024c6:	00 00 00 
+  8024c9:	be 33 00 00 00       	mov    $0x33,%esi
+  8024ce:	48 bf 3c 33 80 00 00 	movabs $0x80333c,%rdi
+  8024d5:	00 00 00 
+  8024d8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024dd:	49 b8 4f 2a 80 00 00 	movabs $0x802a4f,%r8
+  8024e4:	00 00 00 
+  8024e7:	41 ff d0             	call   *%r8
+        ops[i].type = REGION_UNMAP;
+  8024ea:	c7 85 30 ff ff ff 02 	movl   $0x2,-0xd0(%rbp)
+  8024f1:	00 00 00 
+  8024f4:	c7 85 58 ff ff ff 02 	movl   $0x2,-0xa8(%rbp)
+  8024fb:	00 00 00 
+  8024fe:	c7 45 80 02 00 00 00 	movl   $0x2,-0x80(%rbp)
+  802505:	c7 45 a8 02 00 00 00 	movl   $0x2,-0x58(%rbp)
+    sys_region_batch(ops, sizeof ops / sizeof *ops);
+  80250c:	be 04 00 00 00       	mov    $0x4,%esi
+  802511:	48 8d bd 30 ff ff ff 	lea    -0xd0(%rbp),%rdi
+  802518:	48 b8 f1 11 80 00 00 	movabs $0x8011f1,%rax
+  80251f:	00 00 00 
+  802522:	ff d0                	call   *%rax
+  802524:	e9 7c ff ff ff       	jmp    8024a5 <pipe+0x17e>
+
+0000000000802529 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  802529:	55                   	push   %rbp
+  80252a:	48 89 e5             	mov    %rsp,%rbp
+  80252d:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  802531:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802535:	48 b8 ba 15 80 00 00 	movabs $0x8015ba,%rax
+  80253c:	00 00 00 
+  80253f:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802541:	85 c0                	test   %eax,%eax
+  802543:	78 35                	js     80257a <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  802545:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802549:	48 b8 0b 15 80 00 00 	movabs $0x80150b,%rax
+  802550:	00 00 00 
+  802553:	ff d0                	call   *%rax
+  802555:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802558:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80255d:	be 00 10 00 00       	mov    $0x1000,%esi
+  802562:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802566:	48 b8 92 10 80 00 00 	movabs $0x801092,%rax
+  80256d:	00 00 00 
+  802570:	ff d0                	call   *%rax
+  802572:	85 c0                	test   %eax,%eax
+  802574:	0f 94 c0             	sete   %al
+  802577:	0f b6 c0             	movzbl %al,%eax
+}
+  80257a:	c9                   	leave
+  80257b:	c3                   	ret
+
+000000000080257c <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  80257c:	48 89 f8             	mov    %rdi,%rax
+  80257f:	48 c1 e8 27          	shr    $0x27,%rax
+  802583:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  80258a:	01 00 00 
+  80258d:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802591:	f6 c2 01             	test   $0x1,%dl
+  802594:	74 6d                	je     802603 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  802596:	48 89 f8             	mov    %rdi,%rax
+  802599:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80259d:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8025a4:	01 00 00 
+  8025a7:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8025ab:	f6 c2 01             	test   $0x1,%dl
+  8025ae:	74 62                	je     802612 <get_uvpt_entry+0x96>
+  8025b0:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8025b7:	01 00 00 
+  8025ba:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8025be:	f6 c2 80             	test   $0x80,%dl
+  8025c1:	75 4f                	jne    802612 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8025c3:	48 89 f8             	mov    %rdi,%rax
+  8025c6:	48 c1 e8 15          	shr    $0x15,%rax
+  8025ca:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8025d1:	01 00 00 
+  8025d4:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8025d8:	f6 c2 01             	test   $0x1,%dl
+  8025db:	74 44                	je     802621 <get_uvpt_entry+0xa5>
+  8025dd:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8025e4:	01 00 00 
+  8025e7:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8025eb:	f6 c2 80             	test   $0x80,%dl
+  8025ee:	75 31                	jne    802621 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  8025f0:	48 c1 ef 0c          	shr    $0xc,%rdi
+  8025f4:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8025fb:	01 00 00 
+  8025fe:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  802602:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  802603:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  80260a:	01 00 00 
+  80260d:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802611:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  802612:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802619:	01 00 00 
+  80261c:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802620:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  802621:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802628:	01 00 00 
+  80262b:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80262f:	c3                   	ret
+
+0000000000802630 <get_prot>:
+
+int
+get_prot(void *va) {
+  802630:	55                   	push   %rbp
+  802631:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  802634:	48 b8 7c 25 80 00 00 	movabs $0x80257c,%rax
+  80263b:	00 00 00 
+  80263e:	ff d0                	call   *%rax
+  802640:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  802643:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  802648:	89 c1                	mov    %eax,%ecx
+  80264a:	83 c9 04             	or     $0x4,%ecx
+  80264d:	f6 c2 01             	test   $0x1,%dl
+  802650:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  802653:	89 c1                	mov    %eax,%ecx
+  802655:	83 c9 02             	or     $0x2,%ecx
+  802658:	f6 c2 02             	test   $0x2,%dl
+  80265b:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  80265e:	89 c1                	mov    %eax,%ecx
+  802660:	83 c9 01             	or     $0x1,%ecx
+  802663:	48 85 d2             	test   %rdx,%rdx
+  802666:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  802669:	89 c1                	mov    %eax,%ecx
+  80266b:	83 c9 40             	or     $0x40,%ecx
+  80266e:	f6 c6 04             	test   $0x4,%dh
+  802671:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  802674:	5d                   	pop    %rbp
+  802675:	c3                   	ret
+
+0000000000802676 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  802676:	55                   	push   %rbp
+  802677:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  80267a:	48 b8 7c 25 80 00 00 	movabs $0x80257c,%rax
+  802681:	00 00 00 
+  802684:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  802686:	48 c1 e8 06          	shr    $0x6,%rax
+  80268a:	83 e0 01             	and    $0x1,%eax
+}
+  80268d:	5d                   	pop    %rbp
+  80268e:	c3                   	ret
+
+000000000080268f <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  80268f:	55                   	push   %rbp
+  802690:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  802693:	48 b8 7c 25 80 00 00 	movabs $0x80257c,%rax
+  80269a:	00 00 00 
+  80269d:	ff d0                	call   *%rax
+  80269f:	83 e0 01             	and    $0x1,%eax
+}
+  8026a2:	5d                   	pop    %rbp
+  8026a3:	c3                   	ret
+
+00000000008026a4 <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  8026a4:	55                   	push   %rbp
+  8026a5:	48 89 e5             	mov    %rsp,%rbp
+  8026a8:	41 57                	push   %r15
+  8026aa:	41 56                	push   %r14
+  8026ac:	41 55                	push   %r13
+  8026ae:	41 54                	push   %r12
+  8026b0:	53                   	push   %rbx
+  8026b1:	48 83 ec 38          	sub    $0x38,%rsp
+  8026b5:	49 89 f7             	mov    %rsi,%r15
+  8026b8:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+                    }
+                    continue;
+                }
+                for (int ptei = 0; ptei < PT_ENTRY_COUNT; ptei++) {
+                    uintptr_t pte_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, pdei, ptei, 0);
+                    pte_t pte = uvpt[VPT(pte_addr)];
+  8026be:	49 bd 00 00 00 00 00 	movabs $0x10000000000,%r13
+  8026c5:	01 00 00 
+  8026c8:	4d 89 e6             	mov    %r12,%r14
+  8026cb:	49 89 fc             	mov    %rdi,%r12
+  8026ce:	e9 19 01 00 00       	jmp    8027ec <foreach_shared_region+0x148>
+  8026d3:	48 89 5d b0          	mov    %rbx,-0x50(%rbp)
+  8026d7:	4c 89 75 a8          	mov    %r14,-0x58(%rbp)
+  8026db:	eb 52                	jmp    80272f <foreach_shared_region+0x8b>
+                for (int ptei = 0; ptei < PT_ENTRY_COUNT; ptei++) {
+  8026dd:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8026e4:	48 81 fb 00 00 20 00 	cmp    $0x200000,%rbx
+  8026eb:	74 2e                	je     80271b <foreach_shared_region+0x77>
+                    uintptr_t pte_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, pdei, ptei, 0);
+  8026ed:	48 89 df             	mov    %rbx,%rdi
+  8026f0:	4c 09 f7             	or     %r14,%rdi
+                    pte_t pte = uvpt[VPT(pte_addr)];
+  8026f3:	48 89 f8             	mov    %rdi,%rax
+  8026f6:	48 c1 e8 0c          	shr    $0xc,%rax
+  8026fa:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+                    if ((pte & PTE_P) && (pte & PTE_SHARE)) {
+  8026ff:	25 01 04 00 00       	and    $0x401,%eax
+  802704:	48 3d 01 04 00 00    	cmp    $0x401,%rax
+  80270a:	75 d1                	jne    8026dd <foreach_shared_region+0x39>
+                        fun((void*)pte_addr, (void*)(pte_addr + PAGE_SIZE), arg);
+  80270c:	48 8d b7 00 10 00 00 	lea    0x1000(%rdi),%rsi
+  802713:	4c 89 fa             	mov    %r15,%rdx
+  802716:	41 ff d4             	call   *%r12
+  802719:	eb c2                	jmp    8026dd <foreach_shared_region+0x39>
+            for (int pdei = 0; pdei < PD_ENTRY_COUNT; pdei++) {
+  80271b:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  802722:	00 
+  802723:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802727:	48 3d 00 00 00 40    	cmp    $0x40000000,%rax
+  80272d:	74 46                	je     802775 <foreach_shared_region+0xd1>
+                uintptr_t pde_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, pdei, 0, 0);
+  80272f:	4c 8b 75 c8          	mov    -0x38(%rbp),%r14
+  802733:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802737:	49 09 c6             	or     %rax,%r14
+                pde_t pde = uvpd[VPD(pde_addr)];
+  80273a:	4c 89 f0             	mov    %r14,%rax
+  80273d:	48 c1 e8 15          	shr    $0x15,%rax
+  802741:	48 b9 00 00 00 80 00 	movabs $0x10080000000,%rcx
+  802748:	01 00 00 
+  80274b:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+                if (!(pde & PTE_P)) {
+  80274f:	a8 01                	test   $0x1,%al
+  802751:	74 c8                	je     80271b <foreach_shared_region+0x77>
+                if (pde & PTE_PS) {
+  802753:	48 89 c3             	mov    %rax,%rbx
+  802756:	81 e3 80 00 00 00    	and    $0x80,%ebx
+  80275c:	74 8f                	je     8026ed <foreach_shared_region+0x49>
+                    if (pde & PTE_SHARE) {
+  80275e:	f6 c4 04             	test   $0x4,%ah
+  802761:	74 b8                	je     80271b <foreach_shared_region+0x77>
+                        fun((void*)pde_addr, (void*)(pde_addr + 1024 * 1024 * 2), arg);
+  802763:	49 8d b6 00 00 20 00 	lea    0x200000(%r14),%rsi
+  80276a:	4c 89 fa             	mov    %r15,%rdx
+  80276d:	4c 89 f7             	mov    %r14,%rdi
+  802770:	41 ff d4             	call   *%r12
+  802773:	eb a6                	jmp    80271b <foreach_shared_region+0x77>
+  802775:	48 8b 5d b0          	mov    -0x50(%rbp),%rbx
+  802779:	4c 8b 75 a8          	mov    -0x58(%rbp),%r14
+        for (int pdpei = 0; pdpei < PDP_ENTRY_COUNT; pdpei++) {
+  80277d:	48 81 c3 00 00 00 40 	add    $0x40000000,%rbx
+  802784:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80278b:	00 00 00 
+  80278e:	48 39 c3             	cmp    %rax,%rbx
+  802791:	74 4c                	je     8027df <foreach_shared_region+0x13b>
+            uintptr_t pdpe_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, 0, 0, 0);
+  802793:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802797:	48 09 d8             	or     %rbx,%rax
+  80279a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+            pdpe_t pdpe = uvpdp[VPDP(pdpe_addr)];
+  80279e:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8027a2:	48 b9 00 00 40 80 00 	movabs $0x10080400000,%rcx
+  8027a9:	01 00 00 
+  8027ac:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+            if (!(pdpe & PTE_P)) {
+  8027b0:	a8 01                	test   $0x1,%al
+  8027b2:	74 c9                	je     80277d <foreach_shared_region+0xd9>
+            if (pdpe & PTE_PS) {
+  8027b4:	48 89 c1             	mov    %rax,%rcx
+  8027b7:	81 e1 80 00 00 00    	and    $0x80,%ecx
+  8027bd:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  8027c1:	0f 84 0c ff ff ff    	je     8026d3 <foreach_shared_region+0x2f>
+                if (pdpe & PTE_SHARE) {
+  8027c7:	f6 c4 04             	test   $0x4,%ah
+  8027ca:	74 b1                	je     80277d <foreach_shared_region+0xd9>
+                    fun((void*)pdpe_addr, (void*)(pdpe_addr + 1024 * 1024 * 1024), arg); 
+  8027cc:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  8027d0:	48 8d b7 00 00 00 40 	lea    0x40000000(%rdi),%rsi
+  8027d7:	4c 89 fa             	mov    %r15,%rdx
+  8027da:	41 ff d4             	call   *%r12
+  8027dd:	eb 9e                	jmp    80277d <foreach_shared_region+0xd9>
+    for (int pml4ei = 0; pml4ei < PML4_ENTRY_COUNT; pml4ei++) {
+  8027df:	49 83 c6 01          	add    $0x1,%r14
+  8027e3:	49 81 fe 00 02 00 00 	cmp    $0x200,%r14
+  8027ea:	74 24                	je     802810 <foreach_shared_region+0x16c>
+        pml4e_t pml4e = uvpml4[VPML4(pml4_addr)];
+  8027ec:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  8027f3:	01 00 00 
+  8027f6:	4a 8b 04 f0          	mov    (%rax,%r14,8),%rax
+        if (!(pml4e & PTE_P)) {
+  8027fa:	a8 01                	test   $0x1,%al
+  8027fc:	74 e1                	je     8027df <foreach_shared_region+0x13b>
+  8027fe:	4c 89 f0             	mov    %r14,%rax
+  802801:	48 c1 e0 27          	shl    $0x27,%rax
+  802805:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  802809:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80280e:	eb 83                	jmp    802793 <foreach_shared_region+0xef>
+            }
+        }
+    }
+    
+    return 0;
+}
+  802810:	b8 00 00 00 00       	mov    $0x0,%eax
+  802815:	48 83 c4 38          	add    $0x38,%rsp
+  802819:	5b                   	pop    %rbx
+  80281a:	41 5c                	pop    %r12
+  80281c:	41 5d                	pop    %r13
+  80281e:	41 5e                	pop    %r14
+  802820:	41 5f                	pop    %r15
+  802822:	5d                   	pop    %rbp
+  802823:	c3                   	ret
+
+0000000000802824 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  802824:	b8 00 00 00 00       	mov    $0x0,%eax
+  802829:	c3                   	ret
+
+000000000080282a <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  80282a:	55                   	push   %rbp
+  80282b:	48 89 e5             	mov    %rsp,%rbp
+  80282e:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  802831:	48 be 74 33 80 00 00 	movabs $0x803374,%rsi
+  802838:	00 00 00 
+  80283b:	48 b8 0e 0b 80 00 00 	movabs $0x800b0e,%rax
+  802842:	00 00 00 
+  802845:	ff d0                	call   *%rax
+    return 0;
+}
+  802847:	b8 00 00 00 00       	mov    $0x0,%eax
+  80284c:	5d                   	pop    %rbp
+  80284d:	c3                   	ret
+
+000000000080284e <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  80284e:	55                   	push   %rbp
+  80284f:	48 89 e5             	mov    %rsp,%rbp
+  802852:	41 57                	push   %r15
+  802854:	41 56                	push   %r14
+  802856:	41 55                	push   %r13
+  802858:	41 54                	push   %r12
+  80285a:	53                   	push   %rbx
+  80285b:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  802862:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  802869:	48 85 d2             	test   %rdx,%rdx
+  80286c:	74 7a                	je     8028e8 <devcons_write+0x9a>
+  80286e:	49 89 d6             	mov    %rdx,%r14
+  802871:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802877:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  80287c:	49 bf 08 0d 80 00 00 	movabs $0x800d08,%r15
+  802883:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  802886:	4c 89 f3             	mov    %r14,%rbx
+  802889:	48 29 f3             	sub    %rsi,%rbx
+  80288c:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802891:	48 39 c3             	cmp    %rax,%rbx
+  802894:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  802898:	4c 63 eb             	movslq %ebx,%r13
+  80289b:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  8028a2:	48 01 c6             	add    %rax,%rsi
+  8028a5:	4c 89 ea             	mov    %r13,%rdx
+  8028a8:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  8028af:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  8028b2:	4c 89 ee             	mov    %r13,%rsi
+  8028b5:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  8028bc:	48 b8 35 0f 80 00 00 	movabs $0x800f35,%rax
+  8028c3:	00 00 00 
+  8028c6:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  8028c8:	41 01 dc             	add    %ebx,%r12d
+  8028cb:	49 63 f4             	movslq %r12d,%rsi
+  8028ce:	4c 39 f6             	cmp    %r14,%rsi
+  8028d1:	72 b3                	jb     802886 <devcons_write+0x38>
+    return res;
+  8028d3:	49 63 c4             	movslq %r12d,%rax
+}
+  8028d6:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  8028dd:	5b                   	pop    %rbx
+  8028de:	41 5c                	pop    %r12
+  8028e0:	41 5d                	pop    %r13
+  8028e2:	41 5e                	pop    %r14
+  8028e4:	41 5f                	pop    %r15
+  8028e6:	5d                   	pop    %rbp
+  8028e7:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  8028e8:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8028ee:	eb e3                	jmp    8028d3 <devcons_write+0x85>
+
+00000000008028f0 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8028f0:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  8028f3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8028f8:	48 85 c0             	test   %rax,%rax
+  8028fb:	74 55                	je     802952 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8028fd:	55                   	push   %rbp
+  8028fe:	48 89 e5             	mov    %rsp,%rbp
+  802901:	41 55                	push   %r13
+  802903:	41 54                	push   %r12
+  802905:	53                   	push   %rbx
+  802906:	48 83 ec 08          	sub    $0x8,%rsp
+  80290a:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  80290d:	48 bb 62 0f 80 00 00 	movabs $0x800f62,%rbx
+  802914:	00 00 00 
+  802917:	49 bc 2f 10 80 00 00 	movabs $0x80102f,%r12
+  80291e:	00 00 00 
+  802921:	eb 03                	jmp    802926 <devcons_read+0x36>
+  802923:	41 ff d4             	call   *%r12
+  802926:	ff d3                	call   *%rbx
+  802928:	85 c0                	test   %eax,%eax
+  80292a:	74 f7                	je     802923 <devcons_read+0x33>
+    if (c < 0) return c;
+  80292c:	48 63 d0             	movslq %eax,%rdx
+  80292f:	78 13                	js     802944 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  802931:	ba 00 00 00 00       	mov    $0x0,%edx
+  802936:	83 f8 04             	cmp    $0x4,%eax
+  802939:	74 09                	je     802944 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  80293b:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  80293f:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  802944:	48 89 d0             	mov    %rdx,%rax
+  802947:	48 83 c4 08          	add    $0x8,%rsp
+  80294b:	5b                   	pop    %rbx
+  80294c:	41 5c                	pop    %r12
+  80294e:	41 5d                	pop    %r13
+  802950:	5d                   	pop    %rbp
+  802951:	c3                   	ret
+  802952:	48 89 d0             	mov    %rdx,%rax
+  802955:	c3                   	ret
+
+0000000000802956 <cputchar>:
+cputchar(int ch) {
+  802956:	55                   	push   %rbp
+  802957:	48 89 e5             	mov    %rsp,%rbp
+  80295a:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  80295e:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  802962:	be 01 00 00 00       	mov    $0x1,%esi
+  802967:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  80296b:	48 b8 35 0f 80 00 00 	movabs $0x800f35,%rax
+  802972:	00 00 00 
+  802975:	ff d0                	call   *%rax
+}
+  802977:	c9                   	leave
+  802978:	c3                   	ret
+
+0000000000802979 <getchar>:
+getchar(void) {
+  802979:	55                   	push   %rbp
+  80297a:	48 89 e5             	mov    %rsp,%rbp
+  80297d:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  802981:	ba 01 00 00 00       	mov    $0x1,%edx
+  802986:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  80298a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80298f:	48 b8 9d 18 80 00 00 	movabs $0x80189d,%rax
+  802996:	00 00 00 
+  802999:	ff d0                	call   *%rax
+  80299b:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  80299d:	85 c0                	test   %eax,%eax
+  80299f:	78 06                	js     8029a7 <getchar+0x2e>
+  8029a1:	74 08                	je     8029ab <getchar+0x32>
+  8029a3:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  8029a7:	89 d0                	mov    %edx,%eax
+  8029a9:	c9                   	leave
+  8029aa:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  8029ab:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  8029b0:	eb f5                	jmp    8029a7 <getchar+0x2e>
+
+00000000008029b2 <iscons>:
+iscons(int fdnum) {
+  8029b2:	55                   	push   %rbp
+  8029b3:	48 89 e5             	mov    %rsp,%rbp
+  8029b6:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8029ba:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8029be:	48 b8 ba 15 80 00 00 	movabs $0x8015ba,%rax
+  8029c5:	00 00 00 
+  8029c8:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8029ca:	85 c0                	test   %eax,%eax
+  8029cc:	78 18                	js     8029e6 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  8029ce:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8029d2:	48 b8 a0 40 80 00 00 	movabs $0x8040a0,%rax
+  8029d9:	00 00 00 
+  8029dc:	8b 00                	mov    (%rax),%eax
+  8029de:	39 02                	cmp    %eax,(%rdx)
+  8029e0:	0f 94 c0             	sete   %al
+  8029e3:	0f b6 c0             	movzbl %al,%eax
+}
+  8029e6:	c9                   	leave
+  8029e7:	c3                   	ret
+
+00000000008029e8 <opencons>:
+opencons(void) {
+  8029e8:	55                   	push   %rbp
+  8029e9:	48 89 e5             	mov    %rsp,%rbp
+  8029ec:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8029f0:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  8029f4:	48 b8 a0 15 80 00 00 	movabs $0x8015a0,%rax
+  8029fb:	00 00 00 
+  8029fe:	ff d0                	call   *%rax
+  802a00:	85 c0                	test   %eax,%eax
+  802a02:	78 49                	js     802a4d <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  802a04:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802a09:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802a0e:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  802a12:	bf 00 00 00 00       	mov    $0x0,%edi
+  802a17:	48 b8 be 10 80 00 00 	movabs $0x8010be,%rax
+  802a1e:	00 00 00 
+  802a21:	ff d0                	call   *%rax
+  802a23:	85 c0                	test   %eax,%eax
+  802a25:	78 26                	js     802a4d <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  802a27:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802a2b:	a1 a0 40 80 00 00 00 	movabs 0x8040a0,%eax
+  802a32:	00 00 
+  802a34:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  802a36:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802a3a:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  802a41:	48 b8 f9 14 80 00 00 	movabs $0x8014f9,%rax
+  802a48:	00 00 00 
+  802a4b:	ff d0                	call   *%rax
+}
+  802a4d:	c9                   	leave
+  802a4e:	c3                   	ret
+
+0000000000802a4f <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  802a4f:	55                   	push   %rbp
+  802a50:	48 89 e5             	mov    %rsp,%rbp
+  802a53:	41 56                	push   %r14
+  802a55:	41 55                	push   %r13
+  802a57:	41 54                	push   %r12
+  802a59:	53                   	push   %rbx
+  802a5a:	48 83 ec 50          	sub    $0x50,%rsp
+  802a5e:	49 89 fc             	mov    %rdi,%r12
+  802a61:	41 89 f5             	mov    %esi,%r13d
+  802a64:	48 89 d3             	mov    %rdx,%rbx
+  802a67:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  802a6b:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  802a6f:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  802a73:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  802a7a:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802a7e:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  802a82:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  802a86:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  802a8a:	48 b8 00 40 80 00 00 	movabs $0x804000,%rax
+  802a91:	00 00 00 
+  802a94:	4c 8b 30             	mov    (%rax),%r14
+  802a97:	48 b8 fe 0f 80 00 00 	movabs $0x800ffe,%rax
+  802a9e:	00 00 00 
+  802aa1:	ff d0                	call   *%rax
+  802aa3:	89 c6                	mov    %eax,%esi
+  802aa5:	45 89 e8             	mov    %r13d,%r8d
+  802aa8:	4c 89 e1             	mov    %r12,%rcx
+  802aab:	4c 89 f2             	mov    %r14,%rdx
+  802aae:	48 bf 80 33 80 00 00 	movabs $0x803380,%rdi
+  802ab5:	00 00 00 
+  802ab8:	b8 00 00 00 00       	mov    $0x0,%eax
+  802abd:	49 bc e9 01 80 00 00 	movabs $0x8001e9,%r12
+  802ac4:	00 00 00 
+  802ac7:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  802aca:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  802ace:	48 89 df             	mov    %rbx,%rdi
+  802ad1:	48 b8 85 01 80 00 00 	movabs $0x800185,%rax
+  802ad8:	00 00 00 
+  802adb:	ff d0                	call   *%rax
+    cprintf("\n");
+  802add:	48 bf cc 2c 80 00 00 	movabs $0x802ccc,%rdi
+  802ae4:	00 00 00 
+  802ae7:	b8 00 00 00 00       	mov    $0x0,%eax
+  802aec:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  802aef:	cc                   	int3
+  802af0:	eb fd                	jmp    802aef <_panic+0xa0>
+
+0000000000802af2 <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  802af2:	55                   	push   %rbp
+  802af3:	48 89 e5             	mov    %rsp,%rbp
+  802af6:	41 55                	push   %r13
+  802af8:	41 54                	push   %r12
+  802afa:	53                   	push   %rbx
+  802afb:	48 83 ec 08          	sub    $0x8,%rsp
+  802aff:	49 89 fc             	mov    %rdi,%r12
+  802b02:	48 89 f7             	mov    %rsi,%rdi
+  802b05:	48 89 d3             	mov    %rdx,%rbx
+  802b08:	49 89 cd             	mov    %rcx,%r13
+    // LAB 9: Your code here:
+    int res = sys_ipc_recv(!pg ? (void*)MAX_USER_ADDRESS : pg, !size ? 0 : *size);
+  802b0b:	be 00 00 00 00       	mov    $0x0,%esi
+  802b10:	48 85 d2             	test   %rdx,%rdx
+  802b13:	74 03                	je     802b18 <ipc_recv+0x26>
+  802b15:	48 8b 32             	mov    (%rdx),%rsi
+  802b18:	48 85 ff             	test   %rdi,%rdi
+  802b1b:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802b22:	00 00 00 
+  802b25:	48 0f 44 f8          	cmove  %rax,%rdi
+  802b29:	48 b8 90 14 80 00 00 	movabs $0x801490,%rax
+  802b30:	00 00 00 
+  802b33:	ff d0                	call   *%rax
+    if (res < 0) {
+  802b35:	85 c0                	test   %eax,%eax
+  802b37:	78 66                	js     802b9f <ipc_recv+0xad>
+        if (size) {
+            *size = 0;
+        }
+        return res;
+    }
+    if (from_env_store) {
+  802b39:	4d 85 e4             	test   %r12,%r12
+  802b3c:	74 14                	je     802b52 <ipc_recv+0x60>
+        *from_env_store = thisenv->env_ipc_from;
+  802b3e:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802b45:	00 00 00 
+  802b48:	8b 80 ac 01 00 00    	mov    0x1ac(%rax),%eax
+  802b4e:	41 89 04 24          	mov    %eax,(%r12)
+    }
+    if (perm_store) {
+  802b52:	4d 85 ed             	test   %r13,%r13
+  802b55:	74 14                	je     802b6b <ipc_recv+0x79>
+        *perm_store = thisenv->env_ipc_perm;
+  802b57:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802b5e:	00 00 00 
+  802b61:	8b 80 b0 01 00 00    	mov    0x1b0(%rax),%eax
+  802b67:	41 89 45 00          	mov    %eax,0x0(%r13)
+    }
+    if (size) {
+  802b6b:	48 85 db             	test   %rbx,%rbx
+  802b6e:	74 14                	je     802b84 <ipc_recv+0x92>
+        *size = thisenv->env_ipc_maxsz;
+  802b70:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802b77:	00 00 00 
+  802b7a:	48 8b 80 a0 01 00 00 	mov    0x1a0(%rax),%rax
+  802b81:	48 89 03             	mov    %rax,(%rbx)
+    }
+    return thisenv->env_ipc_value;
+  802b84:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802b8b:	00 00 00 
+  802b8e:	8b 80 a8 01 00 00    	mov    0x1a8(%rax),%eax
+}
+  802b94:	48 83 c4 08          	add    $0x8,%rsp
+  802b98:	5b                   	pop    %rbx
+  802b99:	41 5c                	pop    %r12
+  802b9b:	41 5d                	pop    %r13
+  802b9d:	5d                   	pop    %rbp
+  802b9e:	c3                   	ret
+        if (from_env_store) {
+  802b9f:	4d 85 e4             	test   %r12,%r12
+  802ba2:	74 08                	je     802bac <ipc_recv+0xba>
+            *from_env_store = 0;
+  802ba4:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  802bab:	00 
+        if (perm_store) {
+  802bac:	4d 85 ed             	test   %r13,%r13
+  802baf:	74 08                	je     802bb9 <ipc_recv+0xc7>
+            *perm_store = 0;
+  802bb1:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  802bb8:	00 
+        if (size) {
+  802bb9:	48 85 db             	test   %rbx,%rbx
+  802bbc:	74 d6                	je     802b94 <ipc_recv+0xa2>
+            *size = 0;
+  802bbe:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  802bc5:	eb cd                	jmp    802b94 <ipc_recv+0xa2>
+
+0000000000802bc7 <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  802bc7:	55                   	push   %rbp
+  802bc8:	48 89 e5             	mov    %rsp,%rbp
+  802bcb:	41 57                	push   %r15
+  802bcd:	41 56                	push   %r14
+  802bcf:	41 55                	push   %r13
+  802bd1:	41 54                	push   %r12
+  802bd3:	53                   	push   %rbx
+  802bd4:	48 83 ec 18          	sub    $0x18,%rsp
+  802bd8:	41 89 fd             	mov    %edi,%r13d
+  802bdb:	89 75 cc             	mov    %esi,-0x34(%rbp)
+  802bde:	49 89 cc             	mov    %rcx,%r12
+  802be1:	44 89 45 c8          	mov    %r8d,-0x38(%rbp)
+    // LAB 9: Your code here:
+    int res = 0;
+    while ((res = sys_ipc_try_send(to_env, val, !pg ? (void*)MAX_USER_ADDRESS : pg, size, perm)) < 0) {
+  802be5:	48 85 d2             	test   %rdx,%rdx
+  802be8:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802bef:	00 00 00 
+  802bf2:	48 0f 45 c2          	cmovne %rdx,%rax
+  802bf6:	48 89 c3             	mov    %rax,%rbx
+  802bf9:	49 be 64 14 80 00 00 	movabs $0x801464,%r14
+  802c00:	00 00 00 
+        if (res != -E_IPC_NOT_RECV) {
+            panic("sys_ipc_try_send failed: %i", res);
+        }
+        sys_yield();
+  802c03:	49 bf 2f 10 80 00 00 	movabs $0x80102f,%r15
+  802c0a:	00 00 00 
+    while ((res = sys_ipc_try_send(to_env, val, !pg ? (void*)MAX_USER_ADDRESS : pg, size, perm)) < 0) {
+  802c0d:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  802c10:	44 8b 45 c8          	mov    -0x38(%rbp),%r8d
+  802c14:	4c 89 e1             	mov    %r12,%rcx
+  802c17:	48 89 da             	mov    %rbx,%rdx
+  802c1a:	44 89 ef             	mov    %r13d,%edi
+  802c1d:	41 ff d6             	call   *%r14
+  802c20:	85 c0                	test   %eax,%eax
+  802c22:	79 37                	jns    802c5b <ipc_send+0x94>
+        if (res != -E_IPC_NOT_RECV) {
+  802c24:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  802c27:	75 05                	jne    802c2e <ipc_send+0x67>
+        sys_yield();
+  802c29:	41 ff d7             	call   *%r15
+  802c2c:	eb df                	jmp    802c0d <ipc_send+0x46>
+            panic("sys_ipc_try_send failed: %i", res);
+  802c2e:	89 c1                	mov    %eax,%ecx
+  802c30:	48 ba a3 33 80 00 00 	movabs $0x8033a3,%rdx
+  802c37:	00 00 00 
+  802c3a:	be 40 00 00 00       	mov    $0x40,%esi
+  802c3f:	48 bf bf 33 80 00 00 	movabs $0x8033bf,%rdi
+  802c46:	00 00 00 
+  802c49:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c4e:	49 b8 4f 2a 80 00 00 	movabs $0x802a4f,%r8
+  802c55:	00 00 00 
+  802c58:	41 ff d0             	call   *%r8
+    }
+    return;
+}
+  802c5b:	48 83 c4 18          	add    $0x18,%rsp
+  802c5f:	5b                   	pop    %rbx
+  802c60:	41 5c                	pop    %r12
+  802c62:	41 5d                	pop    %r13
+  802c64:	41 5e                	pop    %r14
+  802c66:	41 5f                	pop    %r15
+  802c68:	5d                   	pop    %rbp
+  802c69:	c3                   	ret
+
+0000000000802c6a <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  802c6a:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  802c6f:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  802c76:	00 00 00 
+  802c79:	48 69 d0 d0 01 00 00 	imul   $0x1d0,%rax,%rdx
+  802c80:	48 01 ca             	add    %rcx,%rdx
+  802c83:	8b 92 e8 00 00 00    	mov    0xe8(%rdx),%edx
+  802c89:	39 fa                	cmp    %edi,%edx
+  802c8b:	74 12                	je     802c9f <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  802c8d:	48 83 c0 01          	add    $0x1,%rax
+  802c91:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  802c97:	75 e0                	jne    802c79 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  802c99:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802c9e:	c3                   	ret
+            return envs[i].env_id;
+  802c9f:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+  802ca6:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  802cad:	00 00 00 
+  802cb0:	48 01 d0             	add    %rdx,%rax
+  802cb3:	8b 80 e0 00 00 00    	mov    0xe0(%rax),%eax
+  802cb9:	c3                   	ret
+  802cba:	66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+
+0000000000802cc0 <__rodata_start>:
+  802cc0:	68 65 6c 6c 6f       	push   $0x6f6c6c65
+  802cc5:	2c 20                	sub    $0x20,%al
+  802cc7:	77 6f                	ja     802d38 <__rodata_start+0x78>
+  802cc9:	72 6c                	jb     802d37 <__rodata_start+0x77>
+  802ccb:	64 0a 00             	or     %fs:(%rax),%al
+  802cce:	69 20 61 6d 20 65    	imul   $0x65206d61,(%rax),%esp
+  802cd4:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802cd5:	76 69                	jbe    802d40 <__rodata_start+0x80>
+  802cd7:	72 6f                	jb     802d48 <__rodata_start+0x88>
+  802cd9:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802cda:	6d                   	insl   (%dx),%es:(%rdi)
+  802cdb:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  802cdd:	74 20                	je     802cff <__rodata_start+0x3f>
+  802cdf:	25 30 38 78 0a       	and    $0xa783830,%eax
+  802ce4:	00 3c 75 6e 6b 6e 6f 	add    %bh,0x6f6e6b6e(,%rsi,2)
+  802ceb:	77 6e                	ja     802d5b <__rodata_start+0x9b>
+  802ced:	3e 00 30             	ds add %dh,(%rax)
+  802cf0:	31 32                	xor    %esi,(%rdx)
+  802cf2:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  802cf9:	41                   	rex.B
+  802cfa:	42                   	rex.X
+  802cfb:	43                   	rex.XB
+  802cfc:	44                   	rex.R
+  802cfd:	45                   	rex.RB
+  802cfe:	46 00 30             	rex.RX add %r14b,(%rax)
+  802d01:	31 32                	xor    %esi,(%rdx)
+  802d03:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  802d0a:	61                   	(bad)
+  802d0b:	62 63 64 65 66       	(bad)
+  802d10:	00 28                	add    %ch,(%rax)
+  802d12:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802d13:	75 6c                	jne    802d81 <__rodata_start+0xc1>
+  802d15:	6c                   	insb   (%dx),%es:(%rdi)
+  802d16:	29 00                	sub    %eax,(%rax)
+  802d18:	65 72 72             	gs jb  802d8d <__rodata_start+0xcd>
+  802d1b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802d1c:	72 20                	jb     802d3e <__rodata_start+0x7e>
+  802d1e:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  802d23:	73 70                	jae    802d95 <__rodata_start+0xd5>
+  802d25:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  802d29:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  802d30:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802d31:	72 00                	jb     802d33 <__rodata_start+0x73>
+  802d33:	62 61 64 20 65       	(bad)
+  802d38:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802d39:	76 69                	jbe    802da4 <__rodata_start+0xe4>
+  802d3b:	72 6f                	jb     802dac <__rodata_start+0xec>
+  802d3d:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802d3e:	6d                   	insl   (%dx),%es:(%rdi)
+  802d3f:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  802d41:	74 00                	je     802d43 <__rodata_start+0x83>
+  802d43:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  802d4a:	20 70 61             	and    %dh,0x61(%rax)
+  802d4d:	72 61                	jb     802db0 <__rodata_start+0xf0>
+  802d4f:	6d                   	insl   (%dx),%es:(%rdi)
+  802d50:	65 74 65             	gs je  802db8 <__rodata_start+0xf8>
+  802d53:	72 00                	jb     802d55 <__rodata_start+0x95>
+  802d55:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802d56:	75 74                	jne    802dcc <__rodata_start+0x10c>
+  802d58:	20 6f 66             	and    %ch,0x66(%rdi)
+  802d5b:	20 6d 65             	and    %ch,0x65(%rbp)
+  802d5e:	6d                   	insl   (%dx),%es:(%rdi)
+  802d5f:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802d60:	72 79                	jb     802ddb <__rodata_start+0x11b>
+  802d62:	00 6f 75             	add    %ch,0x75(%rdi)
+  802d65:	74 20                	je     802d87 <__rodata_start+0xc7>
+  802d67:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802d68:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  802d6c:	76 69                	jbe    802dd7 <__rodata_start+0x117>
+  802d6e:	72 6f                	jb     802ddf <__rodata_start+0x11f>
+  802d70:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802d71:	6d                   	insl   (%dx),%es:(%rdi)
+  802d72:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  802d74:	74 73                	je     802de9 <__rodata_start+0x129>
+  802d76:	00 63 6f             	add    %ah,0x6f(%rbx)
+  802d79:	72 72                	jb     802ded <__rodata_start+0x12d>
+  802d7b:	75 70                	jne    802ded <__rodata_start+0x12d>
+  802d7d:	74 65                	je     802de4 <__rodata_start+0x124>
+  802d7f:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  802d84:	75 67                	jne    802ded <__rodata_start+0x12d>
+  802d86:	20 69 6e             	and    %ch,0x6e(%rcx)
+  802d89:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  802d8b:	00 73 65             	add    %dh,0x65(%rbx)
+  802d8e:	67 6d                	insl   (%dx),%es:(%edi)
+  802d90:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  802d92:	74 61                	je     802df5 <__rodata_start+0x135>
+  802d94:	74 69                	je     802dff <__rodata_start+0x13f>
+  802d96:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802d97:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802d98:	20 66 61             	and    %ah,0x61(%rsi)
+  802d9b:	75 6c                	jne    802e09 <__rodata_start+0x149>
+  802d9d:	74 00                	je     802d9f <__rodata_start+0xdf>
+  802d9f:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  802da6:	20 45 4c             	and    %al,0x4c(%rbp)
+  802da9:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  802dad:	61                   	(bad)
+  802dae:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  802db3:	20 73 75             	and    %dh,0x75(%rbx)
+  802db6:	63 68 20             	movsxd 0x20(%rax),%ebp
+  802db9:	73 79                	jae    802e34 <__rodata_start+0x174>
+  802dbb:	73 74                	jae    802e31 <__rodata_start+0x171>
+  802dbd:	65 6d                	gs insl (%dx),%es:(%rdi)
+  802dbf:	20 63 61             	and    %ah,0x61(%rbx)
+  802dc2:	6c                   	insb   (%dx),%es:(%rdi)
+  802dc3:	6c                   	insb   (%dx),%es:(%rdi)
+  802dc4:	00 65 6e             	add    %ah,0x6e(%rbp)
+  802dc7:	74 72                	je     802e3b <__rodata_start+0x17b>
+  802dc9:	79 20                	jns    802deb <__rodata_start+0x12b>
+  802dcb:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802dcc:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802dcd:	74 20                	je     802def <__rodata_start+0x12f>
+  802dcf:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  802dd1:	75 6e                	jne    802e41 <__rodata_start+0x181>
+  802dd3:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  802dd7:	76 20                	jbe    802df9 <__rodata_start+0x139>
+  802dd9:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  802de0:	72 65                	jb     802e47 <__rodata_start+0x187>
+  802de2:	63 76 69             	movsxd 0x69(%rsi),%esi
+  802de5:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802de6:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  802dea:	65 78 70             	gs js  802e5d <__rodata_start+0x19d>
+  802ded:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  802df2:	20 65 6e             	and    %ah,0x6e(%rbp)
+  802df5:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  802df9:	20 66 69             	and    %ah,0x69(%rsi)
+  802dfc:	6c                   	insb   (%dx),%es:(%rdi)
+  802dfd:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  802e01:	20 66 72             	and    %ah,0x72(%rsi)
+  802e04:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  802e09:	61                   	(bad)
+  802e0a:	63 65 20             	movsxd 0x20(%rbp),%esp
+  802e0d:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802e0e:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802e0f:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  802e13:	6b 00 74             	imul   $0x74,(%rax),%eax
+  802e16:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802e17:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802e18:	20 6d 61             	and    %ch,0x61(%rbp)
+  802e1b:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802e1c:	79 20                	jns    802e3e <__rodata_start+0x17e>
+  802e1e:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  802e25:	72 65                	jb     802e8c <__rodata_start+0x1cc>
+  802e27:	20 6f 70             	and    %ch,0x70(%rdi)
+  802e2a:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  802e2c:	00 66 69             	add    %ah,0x69(%rsi)
+  802e2f:	6c                   	insb   (%dx),%es:(%rdi)
+  802e30:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  802e34:	20 62 6c             	and    %ah,0x6c(%rdx)
+  802e37:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802e38:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  802e3b:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802e3c:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802e3d:	74 20                	je     802e5f <__rodata_start+0x19f>
+  802e3f:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  802e41:	75 6e                	jne    802eb1 <__rodata_start+0x1f1>
+  802e43:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  802e47:	76 61                	jbe    802eaa <__rodata_start+0x1ea>
+  802e49:	6c                   	insb   (%dx),%es:(%rdi)
+  802e4a:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  802e51:	00 
+  802e52:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  802e59:	72 65                	jb     802ec0 <__rodata_start+0x200>
+  802e5b:	61                   	(bad)
+  802e5c:	64 79 20             	fs jns 802e7f <__rodata_start+0x1bf>
+  802e5f:	65 78 69             	gs js  802ecb <__rodata_start+0x20b>
+  802e62:	73 74                	jae    802ed8 <__rodata_start+0x218>
+  802e64:	73 00                	jae    802e66 <__rodata_start+0x1a6>
+  802e66:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802e67:	70 65                	jo     802ece <__rodata_start+0x20e>
+  802e69:	72 61                	jb     802ecc <__rodata_start+0x20c>
+  802e6b:	74 69                	je     802ed6 <__rodata_start+0x216>
+  802e6d:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802e6e:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802e6f:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  802e72:	74 20                	je     802e94 <__rodata_start+0x1d4>
+  802e74:	73 75                	jae    802eeb <__rodata_start+0x22b>
+  802e76:	70 70                	jo     802ee8 <__rodata_start+0x228>
+  802e78:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802e79:	72 74                	jb     802eef <__rodata_start+0x22f>
+  802e7b:	65 64 00 6f 70       	gs add %ch,%fs:0x70(%rdi)
+  802e80:	65 72 61             	gs jb  802ee4 <__rodata_start+0x224>
+  802e83:	74 69                	je     802eee <__rodata_start+0x22e>
+  802e85:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802e86:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802e87:	20 69 6e             	and    %ch,0x6e(%rcx)
+  802e8a:	74 65                	je     802ef1 <__rodata_start+0x231>
+  802e8c:	72 72                	jb     802f00 <__rodata_start+0x240>
+  802e8e:	75 70                	jne    802f00 <__rodata_start+0x240>
+  802e90:	74 65                	je     802ef7 <__rodata_start+0x237>
+  802e92:	64 00 6e 6f          	add    %ch,%fs:0x6f(%rsi)
+  802e96:	74 20                	je     802eb8 <__rodata_start+0x1f8>
+  802e98:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  802e9a:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802e9b:	75 67                	jne    802f04 <__rodata_start+0x244>
+  802e9d:	68 20 43 50 55       	push   $0x55504320
+  802ea2:	20 74 69 6d          	and    %dh,0x6d(%rcx,%rbp,2)
+  802ea6:	65 00 66 2e          	add    %ah,%gs:0x2e(%rsi)
+  802eaa:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+  802eb1:	00 
+  802eb2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  802eb9:	00 00 00 
+  802ebc:	0f 1f 40 00          	nopl   0x0(%rax)
+  802ec0:	d6                   	(bad)
+  802ec1:	03 80 00 00 00 00    	add    0x0(%rax),%eax
+  802ec7:	00 17                	add    %dl,(%rdi)
+  802ec9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  802ecf:	00 07                	add    %al,(%rdi)
+  802ed1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  802ed7:	00 17                	add    %dl,(%rdi)
+  802ed9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  802edf:	00 17                	add    %dl,(%rdi)
+  802ee1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  802ee7:	00 17                	add    %dl,(%rdi)
+  802ee9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  802eef:	00 17                	add    %dl,(%rdi)
+  802ef1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  802ef7:	00 f5                	add    %dh,%ch
+  802ef9:	03 80 00 00 00 00    	add    0x0(%rax),%eax
+  802eff:	00 17                	add    %dl,(%rdi)
+  802f01:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  802f07:	00 17                	add    %dl,(%rdi)
+  802f09:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  802f0f:	00 e9                	add    %ch,%cl
+  802f11:	03 80 00 00 00 00    	add    0x0(%rax),%eax
+  802f17:	00 63 04             	add    %ah,0x4(%rbx)
+  802f1a:	80 00 00             	addb   $0x0,(%rax)
+  802f1d:	00 00                	add    %al,(%rax)
+  802f1f:	00 17                	add    %dl,(%rdi)
+  802f21:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  802f27:	00 e9                	add    %ch,%cl
+  802f29:	03 80 00 00 00 00    	add    0x0(%rax),%eax
+  802f2f:	00 2f                	add    %ch,(%rdi)
+  802f31:	04 80                	add    $0x80,%al
+  802f33:	00 00                	add    %al,(%rax)
+  802f35:	00 00                	add    %al,(%rax)
+  802f37:	00 2f                	add    %ch,(%rdi)
+  802f39:	04 80                	add    $0x80,%al
+  802f3b:	00 00                	add    %al,(%rax)
+  802f3d:	00 00                	add    %al,(%rax)
+  802f3f:	00 2f                	add    %ch,(%rdi)
+  802f41:	04 80                	add    $0x80,%al
+  802f43:	00 00                	add    %al,(%rax)
+  802f45:	00 00                	add    %al,(%rax)
+  802f47:	00 2f                	add    %ch,(%rdi)
+  802f49:	04 80                	add    $0x80,%al
+  802f4b:	00 00                	add    %al,(%rax)
+  802f4d:	00 00                	add    %al,(%rax)
+  802f4f:	00 2f                	add    %ch,(%rdi)
+  802f51:	04 80                	add    $0x80,%al
+  802f53:	00 00                	add    %al,(%rax)
+  802f55:	00 00                	add    %al,(%rax)
+  802f57:	00 2f                	add    %ch,(%rdi)
+  802f59:	04 80                	add    $0x80,%al
+  802f5b:	00 00                	add    %al,(%rax)
+  802f5d:	00 00                	add    %al,(%rax)
+  802f5f:	00 2f                	add    %ch,(%rdi)
+  802f61:	04 80                	add    $0x80,%al
+  802f63:	00 00                	add    %al,(%rax)
+  802f65:	00 00                	add    %al,(%rax)
+  802f67:	00 2f                	add    %ch,(%rdi)
+  802f69:	04 80                	add    $0x80,%al
+  802f6b:	00 00                	add    %al,(%rax)
+  802f6d:	00 00                	add    %al,(%rax)
+  802f6f:	00 2f                	add    %ch,(%rdi)
+  802f71:	04 80                	add    $0x80,%al
+  802f73:	00 00                	add    %al,(%rax)
+  802f75:	00 00                	add    %al,(%rax)
+  802f77:	00 17                	add    %dl,(%rdi)
+  802f79:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  802f7f:	00 17                	add    %dl,(%rdi)
+  802f81:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  802f87:	00 17                	add    %dl,(%rdi)
+  802f89:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  802f8f:	00 17                	add    %dl,(%rdi)
+  802f91:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  802f97:	00 17                	add    %dl,(%rdi)
+  802f99:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  802f9f:	00 17                	add    %dl,(%rdi)
+  802fa1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  802fa7:	00 17                	add    %dl,(%rdi)
+  802fa9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  802faf:	00 17                	add    %dl,(%rdi)
+  802fb1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  802fb7:	00 17                	add    %dl,(%rdi)
+  802fb9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  802fbf:	00 17                	add    %dl,(%rdi)
+  802fc1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  802fc7:	00 17                	add    %dl,(%rdi)
+  802fc9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  802fcf:	00 17                	add    %dl,(%rdi)
+  802fd1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  802fd7:	00 17                	add    %dl,(%rdi)
+  802fd9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  802fdf:	00 17                	add    %dl,(%rdi)
+  802fe1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  802fe7:	00 17                	add    %dl,(%rdi)
+  802fe9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  802fef:	00 17                	add    %dl,(%rdi)
+  802ff1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  802ff7:	00 17                	add    %dl,(%rdi)
+  802ff9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  802fff:	00 17                	add    %dl,(%rdi)
+  803001:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803007:	00 17                	add    %dl,(%rdi)
+  803009:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80300f:	00 17                	add    %dl,(%rdi)
+  803011:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803017:	00 17                	add    %dl,(%rdi)
+  803019:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80301f:	00 17                	add    %dl,(%rdi)
+  803021:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803027:	00 17                	add    %dl,(%rdi)
+  803029:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80302f:	00 17                	add    %dl,(%rdi)
+  803031:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803037:	00 17                	add    %dl,(%rdi)
+  803039:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80303f:	00 17                	add    %dl,(%rdi)
+  803041:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803047:	00 17                	add    %dl,(%rdi)
+  803049:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80304f:	00 17                	add    %dl,(%rdi)
+  803051:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803057:	00 17                	add    %dl,(%rdi)
+  803059:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80305f:	00 17                	add    %dl,(%rdi)
+  803061:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803067:	00 3a                	add    %bh,(%rdx)
+  803069:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  80306f:	00 17                	add    %dl,(%rdi)
+  803071:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803077:	00 17                	add    %dl,(%rdi)
+  803079:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80307f:	00 17                	add    %dl,(%rdi)
+  803081:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803087:	00 17                	add    %dl,(%rdi)
+  803089:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80308f:	00 17                	add    %dl,(%rdi)
+  803091:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803097:	00 17                	add    %dl,(%rdi)
+  803099:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80309f:	00 17                	add    %dl,(%rdi)
+  8030a1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8030a7:	00 17                	add    %dl,(%rdi)
+  8030a9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8030af:	00 17                	add    %dl,(%rdi)
+  8030b1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8030b7:	00 17                	add    %dl,(%rdi)
+  8030b9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8030bf:	00 86 04 80 00 00    	add    %al,0x8004(%rsi)
+  8030c5:	00 00                	add    %al,(%rax)
+  8030c7:	00 55 06             	add    %dl,0x6(%rbp)
+  8030ca:	80 00 00             	addb   $0x0,(%rax)
+  8030cd:	00 00                	add    %al,(%rax)
+  8030cf:	00 17                	add    %dl,(%rdi)
+  8030d1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8030d7:	00 17                	add    %dl,(%rdi)
+  8030d9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8030df:	00 17                	add    %dl,(%rdi)
+  8030e1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8030e7:	00 17                	add    %dl,(%rdi)
+  8030e9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8030ef:	00 b5 04 80 00 00    	add    %dh,0x8004(%rbp)
+  8030f5:	00 00                	add    %al,(%rax)
+  8030f7:	00 17                	add    %dl,(%rdi)
+  8030f9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8030ff:	00 17                	add    %dl,(%rdi)
+  803101:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803107:	00 7b 04             	add    %bh,0x4(%rbx)
+  80310a:	80 00 00             	addb   $0x0,(%rax)
+  80310d:	00 00                	add    %al,(%rax)
+  80310f:	00 17                	add    %dl,(%rdi)
+  803111:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803117:	00 17                	add    %dl,(%rdi)
+  803119:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80311f:	00 fd                	add    %bh,%ch
+  803121:	07                   	(bad)
+  803122:	80 00 00             	addb   $0x0,(%rax)
+  803125:	00 00                	add    %al,(%rax)
+  803127:	00 c7                	add    %al,%bh
+  803129:	08 80 00 00 00 00    	or     %al,0x0(%rax)
+  80312f:	00 17                	add    %dl,(%rdi)
+  803131:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803137:	00 17                	add    %dl,(%rdi)
+  803139:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80313f:	00 4c 05 80          	add    %cl,-0x80(%rbp,%rax,1)
+  803143:	00 00                	add    %al,(%rax)
+  803145:	00 00                	add    %al,(%rax)
+  803147:	00 17                	add    %dl,(%rdi)
+  803149:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80314f:	00 29                	add    %ch,(%rcx)
+  803151:	07                   	(bad)
+  803152:	80 00 00             	addb   $0x0,(%rax)
+  803155:	00 00                	add    %al,(%rax)
+  803157:	00 17                	add    %dl,(%rdi)
+  803159:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80315f:	00 17                	add    %dl,(%rdi)
+  803161:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803167:	00 3a                	add    %bh,(%rdx)
+  803169:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  80316f:	00 17                	add    %dl,(%rdi)
+  803171:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803177:	00 df                	add    %bl,%bh
+  803179:	03 80 00 00 00 00    	add    0x0(%rax),%eax
+	...
+
+0000000000803180 <error_string>:
+	...
+  803188:	21 2d 80 00 00 00 00 00 33 2d 80 00 00 00 00 00     !-......3-......
+  803198:	43 2d 80 00 00 00 00 00 55 2d 80 00 00 00 00 00     C-......U-......
+  8031a8:	63 2d 80 00 00 00 00 00 77 2d 80 00 00 00 00 00     c-......w-......
+  8031b8:	8c 2d 80 00 00 00 00 00 9f 2d 80 00 00 00 00 00     .-.......-......
+  8031c8:	b1 2d 80 00 00 00 00 00 c5 2d 80 00 00 00 00 00     .-.......-......
+  8031d8:	d5 2d 80 00 00 00 00 00 e8 2d 80 00 00 00 00 00     .-.......-......
+  8031e8:	ff 2d 80 00 00 00 00 00 15 2e 80 00 00 00 00 00     .-..............
+  8031f8:	2d 2e 80 00 00 00 00 00 45 2e 80 00 00 00 00 00     -.......E.......
+  803208:	52 2e 80 00 00 00 00 00 30 32 80 00 00 00 00 00     R.......02......
+  803218:	66 2e 80 00 00 00 00 00 7e 2e 80 00 00 00 00 00     f.......~.......
+  803228:	94 2e 80 00 00 00 00 00 66 69 6c 65 20 69 73 20     ........file is 
+  803238:	6e 6f 74 20 61 20 76 61 6c 69 64 20 65 78 65 63     not a valid exec
+  803248:	75 74 61 62 6c 65 00 90 73 79 73 63 61 6c 6c 20     utable..syscall 
+  803258:	25 7a 64 20 72 65 74 75 72 6e 65 64 20 25 7a 64     %zd returned %zd
+  803268:	20 28 3e 20 30 29 00 6c 69 62 2f 73 79 73 63 61      (> 0).lib/sysca
+  803278:	6c 6c 2e 63 00 0f 1f 00 5b 25 30 38 78 5d 20 75     ll.c....[%08x] u
+  803288:	6e 6b 6e 6f 77 6e 20 64 65 76 69 63 65 20 74 79     nknown device ty
+  803298:	70 65 20 25 64 0a 00 00 5b 25 30 38 78 5d 20 66     pe %d...[%08x] f
+  8032a8:	74 72 75 6e 63 61 74 65 20 25 64 20 2d 2d 20 62     truncate %d -- b
+  8032b8:	61 64 20 6d 6f 64 65 0a 00 5b 25 30 38 78 5d 20     ad mode..[%08x] 
+  8032c8:	72 65 61 64 20 25 64 20 2d 2d 20 62 61 64 20 6d     read %d -- bad m
+  8032d8:	6f 64 65 0a 00 5b 25 30 38 78 5d 20 77 72 69 74     ode..[%08x] writ
+  8032e8:	65 20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65     e %d -- bad mode
+  8032f8:	0a 00 66 0f 1f 44 00 00                             ..f..D..
+
+0000000000803300 <devtab>:
+  803300:	20 40 80 00 00 00 00 00 60 40 80 00 00 00 00 00      @......`@......
+  803310:	a0 40 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .@..............
+  803320:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  803330:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  803340:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  803350:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  803360:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  803370:	3d 20 32 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73 00     = 2.<cons>.cons.
+  803380:	5b 25 30 38 78 5d 20 75 73 65 72 20 70 61 6e 69     [%08x] user pani
+  803390:	63 20 69 6e 20 25 73 20 61 74 20 25 73 3a 25 64     c in %s at %s:%d
+  8033a0:	3a 20 00 73 79 73 5f 69 70 63 5f 74 72 79 5f 73     : .sys_ipc_try_s
+  8033b0:	65 6e 64 20 66 61 69 6c 65 64 3a 20 25 69 00 6c     end failed: %i.l
+  8033c0:	69 62 2f 69 70 63 2e 63 00 66 2e 0f 1f 84 00 00     ib/ipc.c.f......
+  8033d0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8033e0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8033f0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803400:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803410:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803420:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803430:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803440:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803450:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803460:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803470:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803480:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803490:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8034a0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8034b0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8034c0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8034d0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8034e0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8034f0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803500:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803510:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803520:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803530:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803540:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803550:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803560:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803570:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803580:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803590:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8035a0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8035b0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8035c0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8035d0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8035e0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8035f0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803600:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803610:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803620:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803630:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803640:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803650:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803660:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803670:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803680:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803690:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8036a0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8036b0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8036c0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8036d0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8036e0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8036f0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803700:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803710:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803720:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803730:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803740:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803750:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803760:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803770:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803780:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803790:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8037a0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8037b0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8037c0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8037d0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8037e0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8037f0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803800:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803810:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803820:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803830:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803840:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803850:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803860:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803870:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803880:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803890:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8038a0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8038b0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8038c0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8038d0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8038e0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8038f0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803900:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803910:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803920:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803930:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803940:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803950:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803960:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803970:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803980:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803990:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8039a0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8039b0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8039c0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8039d0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8039e0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8039f0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803a00:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803a10:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803a20:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803a30:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803a40:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803a50:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803a60:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803a70:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803a80:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803a90:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803aa0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803ab0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803ac0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803ad0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803ae0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803af0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803b00:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803b10:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803b20:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803b30:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803b40:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803b50:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803b60:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803b70:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803b80:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803b90:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803ba0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803bb0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803bc0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803bd0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803be0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803bf0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803c00:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803c10:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803c20:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803c30:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803c40:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803c50:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803c60:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803c70:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803c80:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803c90:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803ca0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803cb0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803cc0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803cd0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803ce0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803cf0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803d00:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803d10:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803d20:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803d30:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803d40:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803d50:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803d60:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803d70:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803d80:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803d90:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803da0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803db0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803dc0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803dd0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803de0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803df0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803e00:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803e10:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803e20:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803e30:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803e40:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803e50:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803e60:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803e70:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803e80:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803e90:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803ea0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803eb0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803ec0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803ed0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803ee0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803ef0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803f00:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803f10:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803f20:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803f30:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803f40:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803f50:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803f60:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803f70:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803f80:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803f90:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803fa0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803fb0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803fc0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803fd0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803fe0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803ff0:	2e 0f 1f 84 00 00 00 00 00 0f 1f 80 00 00 00 00     ................
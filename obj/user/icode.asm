@@ -0,0 +1,6911 @@
+
+obj/user/icode:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 c9 01 00 00       	call   8001ec <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 55                	push   %r13
+  80002b:	41 54                	push   %r12
+  80002d:	53                   	push   %rbx
+  80002e:	48 81 ec 18 02 00 00 	sub    $0x218,%rsp
+    int fd, n, r;
+    char buf[512 + 1];
+
+    binaryname = "icode";
+  800035:	48 b8 48 38 80 00 00 	movabs $0x803848,%rax
+  80003c:	00 00 00 
+  80003f:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  800046:	00 00 00 
+
+    cprintf("icode startup\n");
+  800049:	48 bf 4e 38 80 00 00 	movabs $0x80384e,%rdi
+  800050:	00 00 00 
+  800053:	b8 00 00 00 00       	mov    $0x0,%eax
+  800058:	48 bb 08 04 80 00 00 	movabs $0x800408,%rbx
+  80005f:	00 00 00 
+  800062:	ff d3                	call   *%rbx
+
+    cprintf("icode: open /motd\n");
+  800064:	48 bf 5d 38 80 00 00 	movabs $0x80385d,%rdi
+  80006b:	00 00 00 
+  80006e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800073:	ff d3                	call   *%rbx
+    if ((fd = open("/motd", O_RDONLY)) < 0)
+  800075:	be 00 00 00 00       	mov    $0x0,%esi
+  80007a:	48 bf 70 38 80 00 00 	movabs $0x803870,%rdi
+  800081:	00 00 00 
+  800084:	48 b8 dc 21 80 00 00 	movabs $0x8021dc,%rax
+  80008b:	00 00 00 
+  80008e:	ff d0                	call   *%rax
+  800090:	89 c3                	mov    %eax,%ebx
+  800092:	85 c0                	test   %eax,%eax
+  800094:	78 31                	js     8000c7 <umain+0xa2>
+        panic("icode: open /motd: %i", fd);
+
+    cprintf("icode: read /motd\n");
+  800096:	48 bf 99 38 80 00 00 	movabs $0x803899,%rdi
+  80009d:	00 00 00 
+  8000a0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000a5:	48 ba 08 04 80 00 00 	movabs $0x800408,%rdx
+  8000ac:	00 00 00 
+  8000af:	ff d2                	call   *%rdx
+    while ((n = read(fd, buf, sizeof buf - 1)) > 0)
+  8000b1:	49 bc bc 1a 80 00 00 	movabs $0x801abc,%r12
+  8000b8:	00 00 00 
+        sys_cputs(buf, n);
+  8000bb:	49 bd 54 11 80 00 00 	movabs $0x801154,%r13
+  8000c2:	00 00 00 
+    while ((n = read(fd, buf, sizeof buf - 1)) > 0)
+  8000c5:	eb 3a                	jmp    800101 <umain+0xdc>
+        panic("icode: open /motd: %i", fd);
+  8000c7:	89 c1                	mov    %eax,%ecx
+  8000c9:	48 ba 76 38 80 00 00 	movabs $0x803876,%rdx
+  8000d0:	00 00 00 
+  8000d3:	be 0e 00 00 00       	mov    $0xe,%esi
+  8000d8:	48 bf 8c 38 80 00 00 	movabs $0x80388c,%rdi
+  8000df:	00 00 00 
+  8000e2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000e7:	49 b8 b8 02 80 00 00 	movabs $0x8002b8,%r8
+  8000ee:	00 00 00 
+  8000f1:	41 ff d0             	call   *%r8
+        sys_cputs(buf, n);
+  8000f4:	48 63 f0             	movslq %eax,%rsi
+  8000f7:	48 8d bd df fd ff ff 	lea    -0x221(%rbp),%rdi
+  8000fe:	41 ff d5             	call   *%r13
+    while ((n = read(fd, buf, sizeof buf - 1)) > 0)
+  800101:	ba 00 02 00 00       	mov    $0x200,%edx
+  800106:	48 8d b5 df fd ff ff 	lea    -0x221(%rbp),%rsi
+  80010d:	89 df                	mov    %ebx,%edi
+  80010f:	41 ff d4             	call   *%r12
+  800112:	85 c0                	test   %eax,%eax
+  800114:	7f de                	jg     8000f4 <umain+0xcf>
+
+    cprintf("icode: close /motd\n");
+  800116:	48 bf ac 38 80 00 00 	movabs $0x8038ac,%rdi
+  80011d:	00 00 00 
+  800120:	b8 00 00 00 00       	mov    $0x0,%eax
+  800125:	49 bc 08 04 80 00 00 	movabs $0x800408,%r12
+  80012c:	00 00 00 
+  80012f:	41 ff d4             	call   *%r12
+    close(fd);
+  800132:	89 df                	mov    %ebx,%edi
+  800134:	48 b8 3e 19 80 00 00 	movabs $0x80193e,%rax
+  80013b:	00 00 00 
+  80013e:	ff d0                	call   *%rax
+
+    cprintf("icode: spawn /init\n");
+  800140:	48 bf c0 38 80 00 00 	movabs $0x8038c0,%rdi
+  800147:	00 00 00 
+  80014a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80014f:	41 ff d4             	call   *%r12
+    if ((r = spawnl("/init", "init", "initarg1", "initarg2", (char *)0)) < 0)
+  800152:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800158:	48 b9 d4 38 80 00 00 	movabs $0x8038d4,%rcx
+  80015f:	00 00 00 
+  800162:	48 ba dd 38 80 00 00 	movabs $0x8038dd,%rdx
+  800169:	00 00 00 
+  80016c:	48 be e7 38 80 00 00 	movabs $0x8038e7,%rsi
+  800173:	00 00 00 
+  800176:	48 bf e6 38 80 00 00 	movabs $0x8038e6,%rdi
+  80017d:	00 00 00 
+  800180:	b8 00 00 00 00       	mov    $0x0,%eax
+  800185:	49 b9 ba 2b 80 00 00 	movabs $0x802bba,%r9
+  80018c:	00 00 00 
+  80018f:	41 ff d1             	call   *%r9
+  800192:	85 c0                	test   %eax,%eax
+  800194:	78 29                	js     8001bf <umain+0x19a>
+        panic("icode: spawn /init: %i", r);
+
+    cprintf("icode: exiting\n");
+  800196:	48 bf 03 39 80 00 00 	movabs $0x803903,%rdi
+  80019d:	00 00 00 
+  8001a0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001a5:	48 ba 08 04 80 00 00 	movabs $0x800408,%rdx
+  8001ac:	00 00 00 
+  8001af:	ff d2                	call   *%rdx
+}
+  8001b1:	48 81 c4 18 02 00 00 	add    $0x218,%rsp
+  8001b8:	5b                   	pop    %rbx
+  8001b9:	41 5c                	pop    %r12
+  8001bb:	41 5d                	pop    %r13
+  8001bd:	5d                   	pop    %rbp
+  8001be:	c3                   	ret
+        panic("icode: spawn /init: %i", r);
+  8001bf:	89 c1                	mov    %eax,%ecx
+  8001c1:	48 ba ec 38 80 00 00 	movabs $0x8038ec,%rdx
+  8001c8:	00 00 00 
+  8001cb:	be 19 00 00 00       	mov    $0x19,%esi
+  8001d0:	48 bf 8c 38 80 00 00 	movabs $0x80388c,%rdi
+  8001d7:	00 00 00 
+  8001da:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001df:	49 b8 b8 02 80 00 00 	movabs $0x8002b8,%r8
+  8001e6:	00 00 00 
+  8001e9:	41 ff d0             	call   *%r8
+
+00000000008001ec <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  8001ec:	55                   	push   %rbp
+  8001ed:	48 89 e5             	mov    %rsp,%rbp
+  8001f0:	41 56                	push   %r14
+  8001f2:	41 55                	push   %r13
+  8001f4:	41 54                	push   %r12
+  8001f6:	53                   	push   %rbx
+  8001f7:	41 89 fd             	mov    %edi,%r13d
+  8001fa:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  8001fd:	48 ba d8 50 80 00 00 	movabs $0x8050d8,%rdx
+  800204:	00 00 00 
+  800207:	48 b8 d8 50 80 00 00 	movabs $0x8050d8,%rax
+  80020e:	00 00 00 
+  800211:	48 39 c2             	cmp    %rax,%rdx
+  800214:	73 17                	jae    80022d <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  800216:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  800219:	49 89 c4             	mov    %rax,%r12
+  80021c:	48 83 c3 08          	add    $0x8,%rbx
+  800220:	b8 00 00 00 00       	mov    $0x0,%eax
+  800225:	ff 53 f8             	call   *-0x8(%rbx)
+  800228:	4c 39 e3             	cmp    %r12,%rbx
+  80022b:	72 ef                	jb     80021c <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+    envid_t this_env_id = sys_getenvid();
+  80022d:	48 b8 1d 12 80 00 00 	movabs $0x80121d,%rax
+  800234:	00 00 00 
+  800237:	ff d0                	call   *%rax
+    thisenv = &((struct Env*)UENVS)[ENVX(this_env_id)];
+  800239:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80023e:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+  800245:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  80024c:	00 00 00 
+  80024f:	48 01 d0             	add    %rdx,%rax
+  800252:	48 a3 00 60 80 00 00 	movabs %rax,0x806000
+  800259:	00 00 00 
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  80025c:	45 85 ed             	test   %r13d,%r13d
+  80025f:	7e 0d                	jle    80026e <libmain+0x82>
+  800261:	49 8b 06             	mov    (%r14),%rax
+  800264:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  80026b:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  80026e:	4c 89 f6             	mov    %r14,%rsi
+  800271:	44 89 ef             	mov    %r13d,%edi
+  800274:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  80027b:	00 00 00 
+  80027e:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  800280:	48 b8 95 02 80 00 00 	movabs $0x800295,%rax
+  800287:	00 00 00 
+  80028a:	ff d0                	call   *%rax
+#endif
+}
+  80028c:	5b                   	pop    %rbx
+  80028d:	41 5c                	pop    %r12
+  80028f:	41 5d                	pop    %r13
+  800291:	41 5e                	pop    %r14
+  800293:	5d                   	pop    %rbp
+  800294:	c3                   	ret
+
+0000000000800295 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  800295:	55                   	push   %rbp
+  800296:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  800299:	48 b8 71 19 80 00 00 	movabs $0x801971,%rax
+  8002a0:	00 00 00 
+  8002a3:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  8002a5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8002aa:	48 b8 b2 11 80 00 00 	movabs $0x8011b2,%rax
+  8002b1:	00 00 00 
+  8002b4:	ff d0                	call   *%rax
+}
+  8002b6:	5d                   	pop    %rbp
+  8002b7:	c3                   	ret
+
+00000000008002b8 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  8002b8:	55                   	push   %rbp
+  8002b9:	48 89 e5             	mov    %rsp,%rbp
+  8002bc:	41 56                	push   %r14
+  8002be:	41 55                	push   %r13
+  8002c0:	41 54                	push   %r12
+  8002c2:	53                   	push   %rbx
+  8002c3:	48 83 ec 50          	sub    $0x50,%rsp
+  8002c7:	49 89 fc             	mov    %rdi,%r12
+  8002ca:	41 89 f5             	mov    %esi,%r13d
+  8002cd:	48 89 d3             	mov    %rdx,%rbx
+  8002d0:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  8002d4:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  8002d8:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  8002dc:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  8002e3:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8002e7:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  8002eb:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  8002ef:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  8002f3:	48 b8 00 50 80 00 00 	movabs $0x805000,%rax
+  8002fa:	00 00 00 
+  8002fd:	4c 8b 30             	mov    (%rax),%r14
+  800300:	48 b8 1d 12 80 00 00 	movabs $0x80121d,%rax
+  800307:	00 00 00 
+  80030a:	ff d0                	call   *%rax
+  80030c:	89 c6                	mov    %eax,%esi
+  80030e:	45 89 e8             	mov    %r13d,%r8d
+  800311:	4c 89 e1             	mov    %r12,%rcx
+  800314:	4c 89 f2             	mov    %r14,%rdx
+  800317:	48 bf 20 39 80 00 00 	movabs $0x803920,%rdi
+  80031e:	00 00 00 
+  800321:	b8 00 00 00 00       	mov    $0x0,%eax
+  800326:	49 bc 08 04 80 00 00 	movabs $0x800408,%r12
+  80032d:	00 00 00 
+  800330:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  800333:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  800337:	48 89 df             	mov    %rbx,%rdi
+  80033a:	48 b8 a4 03 80 00 00 	movabs $0x8003a4,%rax
+  800341:	00 00 00 
+  800344:	ff d0                	call   *%rax
+    cprintf("\n");
+  800346:	48 bf aa 38 80 00 00 	movabs $0x8038aa,%rdi
+  80034d:	00 00 00 
+  800350:	b8 00 00 00 00       	mov    $0x0,%eax
+  800355:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  800358:	cc                   	int3
+  800359:	eb fd                	jmp    800358 <_panic+0xa0>
+
+000000000080035b <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  80035b:	55                   	push   %rbp
+  80035c:	48 89 e5             	mov    %rsp,%rbp
+  80035f:	53                   	push   %rbx
+  800360:	48 83 ec 08          	sub    $0x8,%rsp
+  800364:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  800367:	8b 06                	mov    (%rsi),%eax
+  800369:	8d 50 01             	lea    0x1(%rax),%edx
+  80036c:	89 16                	mov    %edx,(%rsi)
+  80036e:	48 98                	cltq
+  800370:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  800375:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  80037b:	74 0a                	je     800387 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  80037d:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  800381:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800385:	c9                   	leave
+  800386:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  800387:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  80038b:	be ff 00 00 00       	mov    $0xff,%esi
+  800390:	48 b8 54 11 80 00 00 	movabs $0x801154,%rax
+  800397:	00 00 00 
+  80039a:	ff d0                	call   *%rax
+        state->offset = 0;
+  80039c:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  8003a2:	eb d9                	jmp    80037d <putch+0x22>
+
+00000000008003a4 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  8003a4:	55                   	push   %rbp
+  8003a5:	48 89 e5             	mov    %rsp,%rbp
+  8003a8:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  8003af:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  8003b2:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  8003b9:	b9 21 00 00 00       	mov    $0x21,%ecx
+  8003be:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003c3:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  8003c6:	48 89 f1             	mov    %rsi,%rcx
+  8003c9:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  8003d0:	48 bf 5b 03 80 00 00 	movabs $0x80035b,%rdi
+  8003d7:	00 00 00 
+  8003da:	48 b8 58 05 80 00 00 	movabs $0x800558,%rax
+  8003e1:	00 00 00 
+  8003e4:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  8003e6:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  8003ed:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  8003f4:	48 b8 54 11 80 00 00 	movabs $0x801154,%rax
+  8003fb:	00 00 00 
+  8003fe:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  800400:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  800406:	c9                   	leave
+  800407:	c3                   	ret
+
+0000000000800408 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  800408:	55                   	push   %rbp
+  800409:	48 89 e5             	mov    %rsp,%rbp
+  80040c:	48 83 ec 50          	sub    $0x50,%rsp
+  800410:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  800414:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  800418:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80041c:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800420:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  800424:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  80042b:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80042f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800433:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800437:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  80043b:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  80043f:	48 b8 a4 03 80 00 00 	movabs $0x8003a4,%rax
+  800446:	00 00 00 
+  800449:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  80044b:	c9                   	leave
+  80044c:	c3                   	ret
+
+000000000080044d <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  80044d:	55                   	push   %rbp
+  80044e:	48 89 e5             	mov    %rsp,%rbp
+  800451:	41 57                	push   %r15
+  800453:	41 56                	push   %r14
+  800455:	41 55                	push   %r13
+  800457:	41 54                	push   %r12
+  800459:	53                   	push   %rbx
+  80045a:	48 83 ec 18          	sub    $0x18,%rsp
+  80045e:	49 89 fc             	mov    %rdi,%r12
+  800461:	49 89 f5             	mov    %rsi,%r13
+  800464:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800468:	8b 45 10             	mov    0x10(%rbp),%eax
+  80046b:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  80046e:	41 89 cf             	mov    %ecx,%r15d
+  800471:	4c 39 fa             	cmp    %r15,%rdx
+  800474:	73 5b                	jae    8004d1 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  800476:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  80047a:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  80047e:	85 db                	test   %ebx,%ebx
+  800480:	7e 0e                	jle    800490 <print_num+0x43>
+            putch(padc, put_arg);
+  800482:	4c 89 ee             	mov    %r13,%rsi
+  800485:	44 89 f7             	mov    %r14d,%edi
+  800488:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  80048b:	83 eb 01             	sub    $0x1,%ebx
+  80048e:	75 f2                	jne    800482 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  800490:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  800494:	48 b9 54 39 80 00 00 	movabs $0x803954,%rcx
+  80049b:	00 00 00 
+  80049e:	48 b8 43 39 80 00 00 	movabs $0x803943,%rax
+  8004a5:	00 00 00 
+  8004a8:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  8004ac:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8004b0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8004b5:	49 f7 f7             	div    %r15
+  8004b8:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  8004bc:	4c 89 ee             	mov    %r13,%rsi
+  8004bf:	41 ff d4             	call   *%r12
+}
+  8004c2:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8004c6:	5b                   	pop    %rbx
+  8004c7:	41 5c                	pop    %r12
+  8004c9:	41 5d                	pop    %r13
+  8004cb:	41 5e                	pop    %r14
+  8004cd:	41 5f                	pop    %r15
+  8004cf:	5d                   	pop    %rbp
+  8004d0:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  8004d1:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8004d5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8004da:	49 f7 f7             	div    %r15
+  8004dd:	48 83 ec 08          	sub    $0x8,%rsp
+  8004e1:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  8004e5:	52                   	push   %rdx
+  8004e6:	45 0f be c9          	movsbl %r9b,%r9d
+  8004ea:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  8004ee:	48 89 c2             	mov    %rax,%rdx
+  8004f1:	48 b8 4d 04 80 00 00 	movabs $0x80044d,%rax
+  8004f8:	00 00 00 
+  8004fb:	ff d0                	call   *%rax
+  8004fd:	48 83 c4 10          	add    $0x10,%rsp
+  800501:	eb 8d                	jmp    800490 <print_num+0x43>
+
+0000000000800503 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  800503:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  800507:	48 8b 06             	mov    (%rsi),%rax
+  80050a:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  80050e:	73 0a                	jae    80051a <sprintputch+0x17>
+        *state->start++ = ch;
+  800510:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800514:	48 89 16             	mov    %rdx,(%rsi)
+  800517:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  80051a:	c3                   	ret
+
+000000000080051b <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  80051b:	55                   	push   %rbp
+  80051c:	48 89 e5             	mov    %rsp,%rbp
+  80051f:	48 83 ec 50          	sub    $0x50,%rsp
+  800523:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800527:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80052b:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  80052f:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800536:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80053a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80053e:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800542:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  800546:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80054a:	48 b8 58 05 80 00 00 	movabs $0x800558,%rax
+  800551:	00 00 00 
+  800554:	ff d0                	call   *%rax
+}
+  800556:	c9                   	leave
+  800557:	c3                   	ret
+
+0000000000800558 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  800558:	55                   	push   %rbp
+  800559:	48 89 e5             	mov    %rsp,%rbp
+  80055c:	41 57                	push   %r15
+  80055e:	41 56                	push   %r14
+  800560:	41 55                	push   %r13
+  800562:	41 54                	push   %r12
+  800564:	53                   	push   %rbx
+  800565:	48 83 ec 38          	sub    $0x38,%rsp
+  800569:	49 89 fe             	mov    %rdi,%r14
+  80056c:	49 89 f5             	mov    %rsi,%r13
+  80056f:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  800572:	48 8b 01             	mov    (%rcx),%rax
+  800575:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  800579:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  80057d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800581:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  800585:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  800589:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  80058d:	0f b6 3b             	movzbl (%rbx),%edi
+  800590:	40 80 ff 25          	cmp    $0x25,%dil
+  800594:	74 18                	je     8005ae <vprintfmt+0x56>
+            if (!ch) return;
+  800596:	40 84 ff             	test   %dil,%dil
+  800599:	0f 84 b1 06 00 00    	je     800c50 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  80059f:	40 0f b6 ff          	movzbl %dil,%edi
+  8005a3:	4c 89 ee             	mov    %r13,%rsi
+  8005a6:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  8005a9:	4c 89 e3             	mov    %r12,%rbx
+  8005ac:	eb db                	jmp    800589 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  8005ae:	be 00 00 00 00       	mov    $0x0,%esi
+  8005b3:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  8005b7:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  8005bc:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8005c2:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  8005c9:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8005cd:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  8005d2:	41 0f b6 04 24       	movzbl (%r12),%eax
+  8005d7:	88 45 a0             	mov    %al,-0x60(%rbp)
+  8005da:	83 e8 23             	sub    $0x23,%eax
+  8005dd:	3c 57                	cmp    $0x57,%al
+  8005df:	0f 87 51 06 00 00    	ja     800c36 <vprintfmt+0x6de>
+  8005e5:	0f b6 c0             	movzbl %al,%eax
+  8005e8:	48 b9 00 3b 80 00 00 	movabs $0x803b00,%rcx
+  8005ef:	00 00 00 
+  8005f2:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  8005f5:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  8005f8:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  8005fc:	eb cf                	jmp    8005cd <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  8005fe:	49 89 dc             	mov    %rbx,%r12
+  800601:	be 01 00 00 00       	mov    $0x1,%esi
+  800606:	eb c5                	jmp    8005cd <vprintfmt+0x75>
+            padc = ch;
+  800608:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  80060c:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  80060f:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800612:	eb b9                	jmp    8005cd <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800614:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800617:	83 f8 2f             	cmp    $0x2f,%eax
+  80061a:	77 24                	ja     800640 <vprintfmt+0xe8>
+  80061c:	89 c1                	mov    %eax,%ecx
+  80061e:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  800622:	83 c0 08             	add    $0x8,%eax
+  800625:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800628:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  80062b:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  80062e:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800632:	79 99                	jns    8005cd <vprintfmt+0x75>
+                width = precision;
+  800634:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  800638:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  80063e:	eb 8d                	jmp    8005cd <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800640:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  800644:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  800648:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80064c:	eb da                	jmp    800628 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  80064e:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  800653:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800657:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  80065d:	3c 39                	cmp    $0x39,%al
+  80065f:	77 1c                	ja     80067d <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  800661:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  800665:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  800669:	0f b6 c0             	movzbl %al,%eax
+  80066c:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800671:	0f b6 03             	movzbl (%rbx),%eax
+  800674:	3c 39                	cmp    $0x39,%al
+  800676:	76 e9                	jbe    800661 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  800678:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  80067b:	eb b1                	jmp    80062e <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  80067d:	49 89 dc             	mov    %rbx,%r12
+  800680:	eb ac                	jmp    80062e <vprintfmt+0xd6>
+            width = MAX(0, width);
+  800682:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  800685:	85 c9                	test   %ecx,%ecx
+  800687:	b8 00 00 00 00       	mov    $0x0,%eax
+  80068c:	0f 49 c1             	cmovns %ecx,%eax
+  80068f:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  800692:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800695:	e9 33 ff ff ff       	jmp    8005cd <vprintfmt+0x75>
+            lflag++;
+  80069a:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  80069d:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8006a0:	e9 28 ff ff ff       	jmp    8005cd <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  8006a5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006a8:	83 f8 2f             	cmp    $0x2f,%eax
+  8006ab:	77 19                	ja     8006c6 <vprintfmt+0x16e>
+  8006ad:	89 c2                	mov    %eax,%edx
+  8006af:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8006b3:	83 c0 08             	add    $0x8,%eax
+  8006b6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8006b9:	8b 3a                	mov    (%rdx),%edi
+  8006bb:	4c 89 ee             	mov    %r13,%rsi
+  8006be:	41 ff d6             	call   *%r14
+            break;
+  8006c1:	e9 c3 fe ff ff       	jmp    800589 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  8006c6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8006ca:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006ce:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006d2:	eb e5                	jmp    8006b9 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  8006d4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006d7:	83 f8 2f             	cmp    $0x2f,%eax
+  8006da:	77 5a                	ja     800736 <vprintfmt+0x1de>
+  8006dc:	89 c2                	mov    %eax,%edx
+  8006de:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8006e2:	83 c0 08             	add    $0x8,%eax
+  8006e5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  8006e8:	8b 02                	mov    (%rdx),%eax
+  8006ea:	89 c1                	mov    %eax,%ecx
+  8006ec:	f7 d9                	neg    %ecx
+  8006ee:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  8006f1:	83 f9 15             	cmp    $0x15,%ecx
+  8006f4:	7f 4e                	jg     800744 <vprintfmt+0x1ec>
+  8006f6:	48 63 c1             	movslq %ecx,%rax
+  8006f9:	48 ba c0 3d 80 00 00 	movabs $0x803dc0,%rdx
+  800700:	00 00 00 
+  800703:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  800707:	48 85 c0             	test   %rax,%rax
+  80070a:	74 38                	je     800744 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  80070c:	48 89 c1             	mov    %rax,%rcx
+  80070f:	48 ba ec 3f 80 00 00 	movabs $0x803fec,%rdx
+  800716:	00 00 00 
+  800719:	4c 89 ee             	mov    %r13,%rsi
+  80071c:	4c 89 f7             	mov    %r14,%rdi
+  80071f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800724:	49 b8 1b 05 80 00 00 	movabs $0x80051b,%r8
+  80072b:	00 00 00 
+  80072e:	41 ff d0             	call   *%r8
+  800731:	e9 53 fe ff ff       	jmp    800589 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  800736:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80073a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80073e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800742:	eb a4                	jmp    8006e8 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  800744:	48 ba 6c 39 80 00 00 	movabs $0x80396c,%rdx
+  80074b:	00 00 00 
+  80074e:	4c 89 ee             	mov    %r13,%rsi
+  800751:	4c 89 f7             	mov    %r14,%rdi
+  800754:	b8 00 00 00 00       	mov    $0x0,%eax
+  800759:	49 b8 1b 05 80 00 00 	movabs $0x80051b,%r8
+  800760:	00 00 00 
+  800763:	41 ff d0             	call   *%r8
+  800766:	e9 1e fe ff ff       	jmp    800589 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  80076b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80076e:	83 f8 2f             	cmp    $0x2f,%eax
+  800771:	77 6c                	ja     8007df <vprintfmt+0x287>
+  800773:	89 c2                	mov    %eax,%edx
+  800775:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800779:	83 c0 08             	add    $0x8,%eax
+  80077c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80077f:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  800782:	48 85 d2             	test   %rdx,%rdx
+  800785:	48 b8 65 39 80 00 00 	movabs $0x803965,%rax
+  80078c:	00 00 00 
+  80078f:	48 0f 45 c2          	cmovne %rdx,%rax
+  800793:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  800797:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  80079b:	7e 06                	jle    8007a3 <vprintfmt+0x24b>
+  80079d:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  8007a1:	75 4a                	jne    8007ed <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8007a3:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8007a7:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8007ab:	0f b6 00             	movzbl (%rax),%eax
+  8007ae:	84 c0                	test   %al,%al
+  8007b0:	0f 85 9a 00 00 00    	jne    800850 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  8007b6:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8007b9:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  8007bd:	85 c0                	test   %eax,%eax
+  8007bf:	0f 8e c4 fd ff ff    	jle    800589 <vprintfmt+0x31>
+  8007c5:	4c 89 ee             	mov    %r13,%rsi
+  8007c8:	bf 20 00 00 00       	mov    $0x20,%edi
+  8007cd:	41 ff d6             	call   *%r14
+  8007d0:	41 83 ec 01          	sub    $0x1,%r12d
+  8007d4:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  8007d8:	75 eb                	jne    8007c5 <vprintfmt+0x26d>
+  8007da:	e9 aa fd ff ff       	jmp    800589 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8007df:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007e3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007e7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007eb:	eb 92                	jmp    80077f <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  8007ed:	49 63 f7             	movslq %r15d,%rsi
+  8007f0:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  8007f4:	48 b8 0a 0d 80 00 00 	movabs $0x800d0a,%rax
+  8007fb:	00 00 00 
+  8007fe:	ff d0                	call   *%rax
+  800800:	48 89 c2             	mov    %rax,%rdx
+  800803:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800806:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  800808:	8d 70 ff             	lea    -0x1(%rax),%esi
+  80080b:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  80080e:	85 c0                	test   %eax,%eax
+  800810:	7e 91                	jle    8007a3 <vprintfmt+0x24b>
+  800812:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  800817:	4c 89 ee             	mov    %r13,%rsi
+  80081a:	44 89 e7             	mov    %r12d,%edi
+  80081d:	41 ff d6             	call   *%r14
+  800820:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800824:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800827:	83 f8 ff             	cmp    $0xffffffff,%eax
+  80082a:	75 eb                	jne    800817 <vprintfmt+0x2bf>
+  80082c:	e9 72 ff ff ff       	jmp    8007a3 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800831:	0f b6 f8             	movzbl %al,%edi
+  800834:	4c 89 ee             	mov    %r13,%rsi
+  800837:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  80083a:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  80083e:	49 83 c4 01          	add    $0x1,%r12
+  800842:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  800848:	84 c0                	test   %al,%al
+  80084a:	0f 84 66 ff ff ff    	je     8007b6 <vprintfmt+0x25e>
+  800850:	45 85 ff             	test   %r15d,%r15d
+  800853:	78 0a                	js     80085f <vprintfmt+0x307>
+  800855:	41 83 ef 01          	sub    $0x1,%r15d
+  800859:	0f 88 57 ff ff ff    	js     8007b6 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  80085f:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  800863:	74 cc                	je     800831 <vprintfmt+0x2d9>
+  800865:	8d 50 e0             	lea    -0x20(%rax),%edx
+  800868:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  80086d:	80 fa 5e             	cmp    $0x5e,%dl
+  800870:	77 c2                	ja     800834 <vprintfmt+0x2dc>
+  800872:	eb bd                	jmp    800831 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  800874:	40 84 f6             	test   %sil,%sil
+  800877:	75 26                	jne    80089f <vprintfmt+0x347>
+    switch (lflag) {
+  800879:	85 d2                	test   %edx,%edx
+  80087b:	74 59                	je     8008d6 <vprintfmt+0x37e>
+  80087d:	83 fa 01             	cmp    $0x1,%edx
+  800880:	74 7b                	je     8008fd <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  800882:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800885:	83 f8 2f             	cmp    $0x2f,%eax
+  800888:	0f 87 96 00 00 00    	ja     800924 <vprintfmt+0x3cc>
+  80088e:	89 c2                	mov    %eax,%edx
+  800890:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800894:	83 c0 08             	add    $0x8,%eax
+  800897:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80089a:	4c 8b 22             	mov    (%rdx),%r12
+  80089d:	eb 17                	jmp    8008b6 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  80089f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008a2:	83 f8 2f             	cmp    $0x2f,%eax
+  8008a5:	77 21                	ja     8008c8 <vprintfmt+0x370>
+  8008a7:	89 c2                	mov    %eax,%edx
+  8008a9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008ad:	83 c0 08             	add    $0x8,%eax
+  8008b0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008b3:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  8008b6:	4d 85 e4             	test   %r12,%r12
+  8008b9:	78 7a                	js     800935 <vprintfmt+0x3dd>
+            num = i;
+  8008bb:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  8008be:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  8008c3:	e9 50 02 00 00       	jmp    800b18 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8008c8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008cc:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008d0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008d4:	eb dd                	jmp    8008b3 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  8008d6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008d9:	83 f8 2f             	cmp    $0x2f,%eax
+  8008dc:	77 11                	ja     8008ef <vprintfmt+0x397>
+  8008de:	89 c2                	mov    %eax,%edx
+  8008e0:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008e4:	83 c0 08             	add    $0x8,%eax
+  8008e7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008ea:	4c 63 22             	movslq (%rdx),%r12
+  8008ed:	eb c7                	jmp    8008b6 <vprintfmt+0x35e>
+  8008ef:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008f3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008f7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008fb:	eb ed                	jmp    8008ea <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  8008fd:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800900:	83 f8 2f             	cmp    $0x2f,%eax
+  800903:	77 11                	ja     800916 <vprintfmt+0x3be>
+  800905:	89 c2                	mov    %eax,%edx
+  800907:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80090b:	83 c0 08             	add    $0x8,%eax
+  80090e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800911:	4c 8b 22             	mov    (%rdx),%r12
+  800914:	eb a0                	jmp    8008b6 <vprintfmt+0x35e>
+  800916:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80091a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80091e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800922:	eb ed                	jmp    800911 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  800924:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800928:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80092c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800930:	e9 65 ff ff ff       	jmp    80089a <vprintfmt+0x342>
+                putch('-', put_arg);
+  800935:	4c 89 ee             	mov    %r13,%rsi
+  800938:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  80093d:	41 ff d6             	call   *%r14
+                i = -i;
+  800940:	49 f7 dc             	neg    %r12
+  800943:	e9 73 ff ff ff       	jmp    8008bb <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  800948:	40 84 f6             	test   %sil,%sil
+  80094b:	75 32                	jne    80097f <vprintfmt+0x427>
+    switch (lflag) {
+  80094d:	85 d2                	test   %edx,%edx
+  80094f:	74 5d                	je     8009ae <vprintfmt+0x456>
+  800951:	83 fa 01             	cmp    $0x1,%edx
+  800954:	0f 84 82 00 00 00    	je     8009dc <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  80095a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80095d:	83 f8 2f             	cmp    $0x2f,%eax
+  800960:	0f 87 a5 00 00 00    	ja     800a0b <vprintfmt+0x4b3>
+  800966:	89 c2                	mov    %eax,%edx
+  800968:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80096c:	83 c0 08             	add    $0x8,%eax
+  80096f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800972:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800975:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  80097a:	e9 99 01 00 00       	jmp    800b18 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  80097f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800982:	83 f8 2f             	cmp    $0x2f,%eax
+  800985:	77 19                	ja     8009a0 <vprintfmt+0x448>
+  800987:	89 c2                	mov    %eax,%edx
+  800989:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80098d:	83 c0 08             	add    $0x8,%eax
+  800990:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800993:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800996:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  80099b:	e9 78 01 00 00       	jmp    800b18 <vprintfmt+0x5c0>
+  8009a0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009a4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009a8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009ac:	eb e5                	jmp    800993 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  8009ae:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009b1:	83 f8 2f             	cmp    $0x2f,%eax
+  8009b4:	77 18                	ja     8009ce <vprintfmt+0x476>
+  8009b6:	89 c2                	mov    %eax,%edx
+  8009b8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009bc:	83 c0 08             	add    $0x8,%eax
+  8009bf:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009c2:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  8009c4:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  8009c9:	e9 4a 01 00 00       	jmp    800b18 <vprintfmt+0x5c0>
+  8009ce:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009d2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009d6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009da:	eb e6                	jmp    8009c2 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  8009dc:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009df:	83 f8 2f             	cmp    $0x2f,%eax
+  8009e2:	77 19                	ja     8009fd <vprintfmt+0x4a5>
+  8009e4:	89 c2                	mov    %eax,%edx
+  8009e6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009ea:	83 c0 08             	add    $0x8,%eax
+  8009ed:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009f0:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8009f3:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  8009f8:	e9 1b 01 00 00       	jmp    800b18 <vprintfmt+0x5c0>
+  8009fd:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a01:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a05:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a09:	eb e5                	jmp    8009f0 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  800a0b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a0f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a13:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a17:	e9 56 ff ff ff       	jmp    800972 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  800a1c:	40 84 f6             	test   %sil,%sil
+  800a1f:	75 2e                	jne    800a4f <vprintfmt+0x4f7>
+    switch (lflag) {
+  800a21:	85 d2                	test   %edx,%edx
+  800a23:	74 59                	je     800a7e <vprintfmt+0x526>
+  800a25:	83 fa 01             	cmp    $0x1,%edx
+  800a28:	74 7f                	je     800aa9 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  800a2a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a2d:	83 f8 2f             	cmp    $0x2f,%eax
+  800a30:	0f 87 9f 00 00 00    	ja     800ad5 <vprintfmt+0x57d>
+  800a36:	89 c2                	mov    %eax,%edx
+  800a38:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a3c:	83 c0 08             	add    $0x8,%eax
+  800a3f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a42:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800a45:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  800a4a:	e9 c9 00 00 00       	jmp    800b18 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800a4f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a52:	83 f8 2f             	cmp    $0x2f,%eax
+  800a55:	77 19                	ja     800a70 <vprintfmt+0x518>
+  800a57:	89 c2                	mov    %eax,%edx
+  800a59:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a5d:	83 c0 08             	add    $0x8,%eax
+  800a60:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a63:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800a66:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800a6b:	e9 a8 00 00 00       	jmp    800b18 <vprintfmt+0x5c0>
+  800a70:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a74:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a78:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a7c:	eb e5                	jmp    800a63 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  800a7e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a81:	83 f8 2f             	cmp    $0x2f,%eax
+  800a84:	77 15                	ja     800a9b <vprintfmt+0x543>
+  800a86:	89 c2                	mov    %eax,%edx
+  800a88:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a8c:	83 c0 08             	add    $0x8,%eax
+  800a8f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a92:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  800a94:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  800a99:	eb 7d                	jmp    800b18 <vprintfmt+0x5c0>
+  800a9b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a9f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800aa3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800aa7:	eb e9                	jmp    800a92 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  800aa9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800aac:	83 f8 2f             	cmp    $0x2f,%eax
+  800aaf:	77 16                	ja     800ac7 <vprintfmt+0x56f>
+  800ab1:	89 c2                	mov    %eax,%edx
+  800ab3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ab7:	83 c0 08             	add    $0x8,%eax
+  800aba:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800abd:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800ac0:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  800ac5:	eb 51                	jmp    800b18 <vprintfmt+0x5c0>
+  800ac7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800acb:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800acf:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ad3:	eb e8                	jmp    800abd <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  800ad5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ad9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800add:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ae1:	e9 5c ff ff ff       	jmp    800a42 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  800ae6:	4c 89 ee             	mov    %r13,%rsi
+  800ae9:	bf 30 00 00 00       	mov    $0x30,%edi
+  800aee:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800af1:	4c 89 ee             	mov    %r13,%rsi
+  800af4:	bf 78 00 00 00       	mov    $0x78,%edi
+  800af9:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800afc:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800aff:	83 f8 2f             	cmp    $0x2f,%eax
+  800b02:	77 47                	ja     800b4b <vprintfmt+0x5f3>
+  800b04:	89 c2                	mov    %eax,%edx
+  800b06:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b0a:	83 c0 08             	add    $0x8,%eax
+  800b0d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b10:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800b13:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800b18:	48 83 ec 08          	sub    $0x8,%rsp
+  800b1c:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800b20:	0f 94 c0             	sete   %al
+  800b23:	0f b6 c0             	movzbl %al,%eax
+  800b26:	50                   	push   %rax
+  800b27:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800b2c:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800b30:	4c 89 ee             	mov    %r13,%rsi
+  800b33:	4c 89 f7             	mov    %r14,%rdi
+  800b36:	48 b8 4d 04 80 00 00 	movabs $0x80044d,%rax
+  800b3d:	00 00 00 
+  800b40:	ff d0                	call   *%rax
+            break;
+  800b42:	48 83 c4 10          	add    $0x10,%rsp
+  800b46:	e9 3e fa ff ff       	jmp    800589 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800b4b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b4f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b53:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b57:	eb b7                	jmp    800b10 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  800b59:	40 84 f6             	test   %sil,%sil
+  800b5c:	75 2b                	jne    800b89 <vprintfmt+0x631>
+    switch (lflag) {
+  800b5e:	85 d2                	test   %edx,%edx
+  800b60:	74 56                	je     800bb8 <vprintfmt+0x660>
+  800b62:	83 fa 01             	cmp    $0x1,%edx
+  800b65:	74 7f                	je     800be6 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800b67:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b6a:	83 f8 2f             	cmp    $0x2f,%eax
+  800b6d:	0f 87 a2 00 00 00    	ja     800c15 <vprintfmt+0x6bd>
+  800b73:	89 c2                	mov    %eax,%edx
+  800b75:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b79:	83 c0 08             	add    $0x8,%eax
+  800b7c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b7f:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800b82:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800b87:	eb 8f                	jmp    800b18 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800b89:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b8c:	83 f8 2f             	cmp    $0x2f,%eax
+  800b8f:	77 19                	ja     800baa <vprintfmt+0x652>
+  800b91:	89 c2                	mov    %eax,%edx
+  800b93:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b97:	83 c0 08             	add    $0x8,%eax
+  800b9a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b9d:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800ba0:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800ba5:	e9 6e ff ff ff       	jmp    800b18 <vprintfmt+0x5c0>
+  800baa:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bae:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bb2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bb6:	eb e5                	jmp    800b9d <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800bb8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bbb:	83 f8 2f             	cmp    $0x2f,%eax
+  800bbe:	77 18                	ja     800bd8 <vprintfmt+0x680>
+  800bc0:	89 c2                	mov    %eax,%edx
+  800bc2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800bc6:	83 c0 08             	add    $0x8,%eax
+  800bc9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800bcc:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800bce:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800bd3:	e9 40 ff ff ff       	jmp    800b18 <vprintfmt+0x5c0>
+  800bd8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bdc:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800be0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800be4:	eb e6                	jmp    800bcc <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800be6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800be9:	83 f8 2f             	cmp    $0x2f,%eax
+  800bec:	77 19                	ja     800c07 <vprintfmt+0x6af>
+  800bee:	89 c2                	mov    %eax,%edx
+  800bf0:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800bf4:	83 c0 08             	add    $0x8,%eax
+  800bf7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800bfa:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800bfd:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800c02:	e9 11 ff ff ff       	jmp    800b18 <vprintfmt+0x5c0>
+  800c07:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c0b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c0f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c13:	eb e5                	jmp    800bfa <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800c15:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c19:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c1d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c21:	e9 59 ff ff ff       	jmp    800b7f <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800c26:	4c 89 ee             	mov    %r13,%rsi
+  800c29:	bf 25 00 00 00       	mov    $0x25,%edi
+  800c2e:	41 ff d6             	call   *%r14
+            break;
+  800c31:	e9 53 f9 ff ff       	jmp    800589 <vprintfmt+0x31>
+            putch('%', put_arg);
+  800c36:	4c 89 ee             	mov    %r13,%rsi
+  800c39:	bf 25 00 00 00       	mov    $0x25,%edi
+  800c3e:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800c41:	48 83 eb 01          	sub    $0x1,%rbx
+  800c45:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800c49:	75 f6                	jne    800c41 <vprintfmt+0x6e9>
+  800c4b:	e9 39 f9 ff ff       	jmp    800589 <vprintfmt+0x31>
+}
+  800c50:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800c54:	5b                   	pop    %rbx
+  800c55:	41 5c                	pop    %r12
+  800c57:	41 5d                	pop    %r13
+  800c59:	41 5e                	pop    %r14
+  800c5b:	41 5f                	pop    %r15
+  800c5d:	5d                   	pop    %rbp
+  800c5e:	c3                   	ret
+
+0000000000800c5f <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800c5f:	55                   	push   %rbp
+  800c60:	48 89 e5             	mov    %rsp,%rbp
+  800c63:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800c67:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800c6b:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800c70:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800c74:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800c7b:	48 85 ff             	test   %rdi,%rdi
+  800c7e:	74 2b                	je     800cab <vsnprintf+0x4c>
+  800c80:	48 85 f6             	test   %rsi,%rsi
+  800c83:	74 26                	je     800cab <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800c85:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800c89:	48 bf 03 05 80 00 00 	movabs $0x800503,%rdi
+  800c90:	00 00 00 
+  800c93:	48 b8 58 05 80 00 00 	movabs $0x800558,%rax
+  800c9a:	00 00 00 
+  800c9d:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800c9f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800ca3:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800ca6:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800ca9:	c9                   	leave
+  800caa:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800cab:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800cb0:	eb f7                	jmp    800ca9 <vsnprintf+0x4a>
+
+0000000000800cb2 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800cb2:	55                   	push   %rbp
+  800cb3:	48 89 e5             	mov    %rsp,%rbp
+  800cb6:	48 83 ec 50          	sub    $0x50,%rsp
+  800cba:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800cbe:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800cc2:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800cc6:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800ccd:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800cd1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800cd5:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800cd9:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800cdd:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800ce1:	48 b8 5f 0c 80 00 00 	movabs $0x800c5f,%rax
+  800ce8:	00 00 00 
+  800ceb:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800ced:	c9                   	leave
+  800cee:	c3                   	ret
+
+0000000000800cef <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800cef:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800cf2:	74 10                	je     800d04 <strlen+0x15>
+    size_t n = 0;
+  800cf4:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800cf9:	48 83 c0 01          	add    $0x1,%rax
+  800cfd:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800d01:	75 f6                	jne    800cf9 <strlen+0xa>
+  800d03:	c3                   	ret
+    size_t n = 0;
+  800d04:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800d09:	c3                   	ret
+
+0000000000800d0a <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800d0a:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800d0d:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800d12:	48 85 f6             	test   %rsi,%rsi
+  800d15:	74 11                	je     800d28 <strnlen+0x1e>
+  800d17:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800d1b:	74 0c                	je     800d29 <strnlen+0x1f>
+  800d1d:	48 83 c2 01          	add    $0x1,%rdx
+  800d21:	48 39 d0             	cmp    %rdx,%rax
+  800d24:	75 f1                	jne    800d17 <strnlen+0xd>
+  800d26:	eb 04                	jmp    800d2c <strnlen+0x22>
+  800d28:	c3                   	ret
+  800d29:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800d2c:	c3                   	ret
+
+0000000000800d2d <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800d2d:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800d30:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d35:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800d39:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800d3c:	48 83 c2 01          	add    $0x1,%rdx
+  800d40:	84 c9                	test   %cl,%cl
+  800d42:	75 f1                	jne    800d35 <strcpy+0x8>
+        ;
+    return res;
+}
+  800d44:	c3                   	ret
+
+0000000000800d45 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800d45:	55                   	push   %rbp
+  800d46:	48 89 e5             	mov    %rsp,%rbp
+  800d49:	41 54                	push   %r12
+  800d4b:	53                   	push   %rbx
+  800d4c:	48 89 fb             	mov    %rdi,%rbx
+  800d4f:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800d52:	48 b8 ef 0c 80 00 00 	movabs $0x800cef,%rax
+  800d59:	00 00 00 
+  800d5c:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800d5e:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800d62:	4c 89 e6             	mov    %r12,%rsi
+  800d65:	48 b8 2d 0d 80 00 00 	movabs $0x800d2d,%rax
+  800d6c:	00 00 00 
+  800d6f:	ff d0                	call   *%rax
+    return dst;
+}
+  800d71:	48 89 d8             	mov    %rbx,%rax
+  800d74:	5b                   	pop    %rbx
+  800d75:	41 5c                	pop    %r12
+  800d77:	5d                   	pop    %rbp
+  800d78:	c3                   	ret
+
+0000000000800d79 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800d79:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800d7c:	48 85 d2             	test   %rdx,%rdx
+  800d7f:	74 1f                	je     800da0 <strncpy+0x27>
+  800d81:	48 01 fa             	add    %rdi,%rdx
+  800d84:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800d87:	48 83 c1 01          	add    $0x1,%rcx
+  800d8b:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800d8f:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800d93:	41 80 f8 01          	cmp    $0x1,%r8b
+  800d97:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800d9b:	48 39 ca             	cmp    %rcx,%rdx
+  800d9e:	75 e7                	jne    800d87 <strncpy+0xe>
+    }
+    return ret;
+}
+  800da0:	c3                   	ret
+
+0000000000800da1 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800da1:	48 89 f8             	mov    %rdi,%rax
+  800da4:	48 85 d2             	test   %rdx,%rdx
+  800da7:	74 24                	je     800dcd <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800da9:	48 83 ea 01          	sub    $0x1,%rdx
+  800dad:	74 1b                	je     800dca <strlcpy+0x29>
+  800daf:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800db3:	0f b6 16             	movzbl (%rsi),%edx
+  800db6:	84 d2                	test   %dl,%dl
+  800db8:	74 10                	je     800dca <strlcpy+0x29>
+            *dst++ = *src++;
+  800dba:	48 83 c6 01          	add    $0x1,%rsi
+  800dbe:	48 83 c0 01          	add    $0x1,%rax
+  800dc2:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800dc5:	48 39 c8             	cmp    %rcx,%rax
+  800dc8:	75 e9                	jne    800db3 <strlcpy+0x12>
+        *dst = '\0';
+  800dca:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800dcd:	48 29 f8             	sub    %rdi,%rax
+}
+  800dd0:	c3                   	ret
+
+0000000000800dd1 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800dd1:	0f b6 07             	movzbl (%rdi),%eax
+  800dd4:	84 c0                	test   %al,%al
+  800dd6:	74 13                	je     800deb <strcmp+0x1a>
+  800dd8:	38 06                	cmp    %al,(%rsi)
+  800dda:	75 0f                	jne    800deb <strcmp+0x1a>
+  800ddc:	48 83 c7 01          	add    $0x1,%rdi
+  800de0:	48 83 c6 01          	add    $0x1,%rsi
+  800de4:	0f b6 07             	movzbl (%rdi),%eax
+  800de7:	84 c0                	test   %al,%al
+  800de9:	75 ed                	jne    800dd8 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800deb:	0f b6 c0             	movzbl %al,%eax
+  800dee:	0f b6 16             	movzbl (%rsi),%edx
+  800df1:	29 d0                	sub    %edx,%eax
+}
+  800df3:	c3                   	ret
+
+0000000000800df4 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800df4:	48 85 d2             	test   %rdx,%rdx
+  800df7:	74 1f                	je     800e18 <strncmp+0x24>
+  800df9:	0f b6 07             	movzbl (%rdi),%eax
+  800dfc:	84 c0                	test   %al,%al
+  800dfe:	74 1e                	je     800e1e <strncmp+0x2a>
+  800e00:	3a 06                	cmp    (%rsi),%al
+  800e02:	75 1a                	jne    800e1e <strncmp+0x2a>
+  800e04:	48 83 c7 01          	add    $0x1,%rdi
+  800e08:	48 83 c6 01          	add    $0x1,%rsi
+  800e0c:	48 83 ea 01          	sub    $0x1,%rdx
+  800e10:	75 e7                	jne    800df9 <strncmp+0x5>
+
+    if (!n) return 0;
+  800e12:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e17:	c3                   	ret
+  800e18:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e1d:	c3                   	ret
+  800e1e:	48 85 d2             	test   %rdx,%rdx
+  800e21:	74 09                	je     800e2c <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800e23:	0f b6 07             	movzbl (%rdi),%eax
+  800e26:	0f b6 16             	movzbl (%rsi),%edx
+  800e29:	29 d0                	sub    %edx,%eax
+  800e2b:	c3                   	ret
+    if (!n) return 0;
+  800e2c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800e31:	c3                   	ret
+
+0000000000800e32 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800e32:	0f b6 17             	movzbl (%rdi),%edx
+  800e35:	84 d2                	test   %dl,%dl
+  800e37:	74 18                	je     800e51 <strchr+0x1f>
+        if (*str == c) {
+  800e39:	0f be d2             	movsbl %dl,%edx
+  800e3c:	39 f2                	cmp    %esi,%edx
+  800e3e:	74 17                	je     800e57 <strchr+0x25>
+    for (; *str; str++) {
+  800e40:	48 83 c7 01          	add    $0x1,%rdi
+  800e44:	0f b6 17             	movzbl (%rdi),%edx
+  800e47:	84 d2                	test   %dl,%dl
+  800e49:	75 ee                	jne    800e39 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800e4b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e50:	c3                   	ret
+  800e51:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e56:	c3                   	ret
+  800e57:	48 89 f8             	mov    %rdi,%rax
+}
+  800e5a:	c3                   	ret
+
+0000000000800e5b <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800e5b:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800e5e:	0f b6 17             	movzbl (%rdi),%edx
+  800e61:	84 d2                	test   %dl,%dl
+  800e63:	74 13                	je     800e78 <strfind+0x1d>
+  800e65:	0f be d2             	movsbl %dl,%edx
+  800e68:	39 f2                	cmp    %esi,%edx
+  800e6a:	74 0b                	je     800e77 <strfind+0x1c>
+  800e6c:	48 83 c0 01          	add    $0x1,%rax
+  800e70:	0f b6 10             	movzbl (%rax),%edx
+  800e73:	84 d2                	test   %dl,%dl
+  800e75:	75 ee                	jne    800e65 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800e77:	c3                   	ret
+  800e78:	c3                   	ret
+
+0000000000800e79 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800e79:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800e7c:	48 89 f8             	mov    %rdi,%rax
+  800e7f:	48 f7 d8             	neg    %rax
+  800e82:	83 e0 07             	and    $0x7,%eax
+  800e85:	49 89 d1             	mov    %rdx,%r9
+  800e88:	49 29 c1             	sub    %rax,%r9
+  800e8b:	78 36                	js     800ec3 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800e8d:	40 0f b6 c6          	movzbl %sil,%eax
+  800e91:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800e98:	01 01 01 
+  800e9b:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800e9f:	40 f6 c7 07          	test   $0x7,%dil
+  800ea3:	75 38                	jne    800edd <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800ea5:	4c 89 c9             	mov    %r9,%rcx
+  800ea8:	48 c1 f9 03          	sar    $0x3,%rcx
+  800eac:	74 0c                	je     800eba <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800eae:	fc                   	cld
+  800eaf:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800eb2:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800eb6:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800eba:	4d 85 c9             	test   %r9,%r9
+  800ebd:	75 45                	jne    800f04 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800ebf:	4c 89 c0             	mov    %r8,%rax
+  800ec2:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800ec3:	48 85 d2             	test   %rdx,%rdx
+  800ec6:	74 f7                	je     800ebf <memset+0x46>
+  800ec8:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800ecb:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800ece:	48 83 c0 01          	add    $0x1,%rax
+  800ed2:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  800ed6:	48 39 c2             	cmp    %rax,%rdx
+  800ed9:	75 f3                	jne    800ece <memset+0x55>
+  800edb:	eb e2                	jmp    800ebf <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  800edd:	40 f6 c7 01          	test   $0x1,%dil
+  800ee1:	74 06                	je     800ee9 <memset+0x70>
+  800ee3:	88 07                	mov    %al,(%rdi)
+  800ee5:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800ee9:	40 f6 c7 02          	test   $0x2,%dil
+  800eed:	74 07                	je     800ef6 <memset+0x7d>
+  800eef:	66 89 07             	mov    %ax,(%rdi)
+  800ef2:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800ef6:	40 f6 c7 04          	test   $0x4,%dil
+  800efa:	74 a9                	je     800ea5 <memset+0x2c>
+  800efc:	89 07                	mov    %eax,(%rdi)
+  800efe:	48 83 c7 04          	add    $0x4,%rdi
+  800f02:	eb a1                	jmp    800ea5 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800f04:	41 f6 c1 04          	test   $0x4,%r9b
+  800f08:	74 06                	je     800f10 <memset+0x97>
+  800f0a:	89 07                	mov    %eax,(%rdi)
+  800f0c:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800f10:	41 f6 c1 02          	test   $0x2,%r9b
+  800f14:	74 07                	je     800f1d <memset+0xa4>
+  800f16:	66 89 07             	mov    %ax,(%rdi)
+  800f19:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  800f1d:	41 f6 c1 01          	test   $0x1,%r9b
+  800f21:	74 9c                	je     800ebf <memset+0x46>
+  800f23:	88 07                	mov    %al,(%rdi)
+  800f25:	eb 98                	jmp    800ebf <memset+0x46>
+
+0000000000800f27 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  800f27:	48 89 f8             	mov    %rdi,%rax
+  800f2a:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  800f2d:	48 39 fe             	cmp    %rdi,%rsi
+  800f30:	73 3b                	jae    800f6d <memmove+0x46>
+  800f32:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  800f36:	48 39 d7             	cmp    %rdx,%rdi
+  800f39:	73 32                	jae    800f6d <memmove+0x46>
+        s += n;
+        d += n;
+  800f3b:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800f3f:	48 89 d6             	mov    %rdx,%rsi
+  800f42:	48 09 fe             	or     %rdi,%rsi
+  800f45:	48 09 ce             	or     %rcx,%rsi
+  800f48:	40 f6 c6 07          	test   $0x7,%sil
+  800f4c:	75 12                	jne    800f60 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  800f4e:	48 83 ef 08          	sub    $0x8,%rdi
+  800f52:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  800f56:	48 c1 e9 03          	shr    $0x3,%rcx
+  800f5a:	fd                   	std
+  800f5b:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  800f5e:	fc                   	cld
+  800f5f:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  800f60:	48 83 ef 01          	sub    $0x1,%rdi
+  800f64:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  800f68:	fd                   	std
+  800f69:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  800f6b:	eb f1                	jmp    800f5e <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800f6d:	48 89 f2             	mov    %rsi,%rdx
+  800f70:	48 09 c2             	or     %rax,%rdx
+  800f73:	48 09 ca             	or     %rcx,%rdx
+  800f76:	f6 c2 07             	test   $0x7,%dl
+  800f79:	75 0c                	jne    800f87 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  800f7b:	48 c1 e9 03          	shr    $0x3,%rcx
+  800f7f:	48 89 c7             	mov    %rax,%rdi
+  800f82:	fc                   	cld
+  800f83:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  800f86:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  800f87:	48 89 c7             	mov    %rax,%rdi
+  800f8a:	fc                   	cld
+  800f8b:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  800f8d:	c3                   	ret
+
+0000000000800f8e <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  800f8e:	55                   	push   %rbp
+  800f8f:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  800f92:	48 b8 27 0f 80 00 00 	movabs $0x800f27,%rax
+  800f99:	00 00 00 
+  800f9c:	ff d0                	call   *%rax
+}
+  800f9e:	5d                   	pop    %rbp
+  800f9f:	c3                   	ret
+
+0000000000800fa0 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  800fa0:	55                   	push   %rbp
+  800fa1:	48 89 e5             	mov    %rsp,%rbp
+  800fa4:	41 57                	push   %r15
+  800fa6:	41 56                	push   %r14
+  800fa8:	41 55                	push   %r13
+  800faa:	41 54                	push   %r12
+  800fac:	53                   	push   %rbx
+  800fad:	48 83 ec 08          	sub    $0x8,%rsp
+  800fb1:	49 89 fe             	mov    %rdi,%r14
+  800fb4:	49 89 f7             	mov    %rsi,%r15
+  800fb7:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  800fba:	48 89 f7             	mov    %rsi,%rdi
+  800fbd:	48 b8 ef 0c 80 00 00 	movabs $0x800cef,%rax
+  800fc4:	00 00 00 
+  800fc7:	ff d0                	call   *%rax
+  800fc9:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  800fcc:	48 89 de             	mov    %rbx,%rsi
+  800fcf:	4c 89 f7             	mov    %r14,%rdi
+  800fd2:	48 b8 0a 0d 80 00 00 	movabs $0x800d0a,%rax
+  800fd9:	00 00 00 
+  800fdc:	ff d0                	call   *%rax
+  800fde:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  800fe1:	48 39 c3             	cmp    %rax,%rbx
+  800fe4:	74 36                	je     80101c <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  800fe6:	48 89 d8             	mov    %rbx,%rax
+  800fe9:	4c 29 e8             	sub    %r13,%rax
+  800fec:	49 39 c4             	cmp    %rax,%r12
+  800fef:	73 31                	jae    801022 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  800ff1:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  800ff6:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800ffa:	4c 89 fe             	mov    %r15,%rsi
+  800ffd:	48 b8 8e 0f 80 00 00 	movabs $0x800f8e,%rax
+  801004:	00 00 00 
+  801007:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  801009:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  80100d:	48 83 c4 08          	add    $0x8,%rsp
+  801011:	5b                   	pop    %rbx
+  801012:	41 5c                	pop    %r12
+  801014:	41 5d                	pop    %r13
+  801016:	41 5e                	pop    %r14
+  801018:	41 5f                	pop    %r15
+  80101a:	5d                   	pop    %rbp
+  80101b:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  80101c:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  801020:	eb eb                	jmp    80100d <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  801022:	48 83 eb 01          	sub    $0x1,%rbx
+  801026:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  80102a:	48 89 da             	mov    %rbx,%rdx
+  80102d:	4c 89 fe             	mov    %r15,%rsi
+  801030:	48 b8 8e 0f 80 00 00 	movabs $0x800f8e,%rax
+  801037:	00 00 00 
+  80103a:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  80103c:	49 01 de             	add    %rbx,%r14
+  80103f:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  801044:	eb c3                	jmp    801009 <strlcat+0x69>
+
+0000000000801046 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  801046:	48 85 d2             	test   %rdx,%rdx
+  801049:	74 2d                	je     801078 <memcmp+0x32>
+  80104b:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  801050:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  801054:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  801059:	44 38 c1             	cmp    %r8b,%cl
+  80105c:	75 0f                	jne    80106d <memcmp+0x27>
+    while (n-- > 0) {
+  80105e:	48 83 c0 01          	add    $0x1,%rax
+  801062:	48 39 c2             	cmp    %rax,%rdx
+  801065:	75 e9                	jne    801050 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  801067:	b8 00 00 00 00       	mov    $0x0,%eax
+  80106c:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  80106d:	0f b6 c1             	movzbl %cl,%eax
+  801070:	45 0f b6 c0          	movzbl %r8b,%r8d
+  801074:	44 29 c0             	sub    %r8d,%eax
+  801077:	c3                   	ret
+    return 0;
+  801078:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80107d:	c3                   	ret
+
+000000000080107e <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  80107e:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  801082:	48 39 c7             	cmp    %rax,%rdi
+  801085:	73 0f                	jae    801096 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  801087:	40 38 37             	cmp    %sil,(%rdi)
+  80108a:	74 0e                	je     80109a <memfind+0x1c>
+    for (; src < end; src++) {
+  80108c:	48 83 c7 01          	add    $0x1,%rdi
+  801090:	48 39 f8             	cmp    %rdi,%rax
+  801093:	75 f2                	jne    801087 <memfind+0x9>
+  801095:	c3                   	ret
+  801096:	48 89 f8             	mov    %rdi,%rax
+  801099:	c3                   	ret
+  80109a:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  80109d:	c3                   	ret
+
+000000000080109e <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  80109e:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  8010a1:	0f b6 37             	movzbl (%rdi),%esi
+  8010a4:	40 80 fe 20          	cmp    $0x20,%sil
+  8010a8:	74 06                	je     8010b0 <strtol+0x12>
+  8010aa:	40 80 fe 09          	cmp    $0x9,%sil
+  8010ae:	75 13                	jne    8010c3 <strtol+0x25>
+  8010b0:	48 83 c7 01          	add    $0x1,%rdi
+  8010b4:	0f b6 37             	movzbl (%rdi),%esi
+  8010b7:	40 80 fe 20          	cmp    $0x20,%sil
+  8010bb:	74 f3                	je     8010b0 <strtol+0x12>
+  8010bd:	40 80 fe 09          	cmp    $0x9,%sil
+  8010c1:	74 ed                	je     8010b0 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  8010c3:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  8010c6:	83 e0 fd             	and    $0xfffffffd,%eax
+  8010c9:	3c 01                	cmp    $0x1,%al
+  8010cb:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8010cf:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  8010d5:	75 0f                	jne    8010e6 <strtol+0x48>
+  8010d7:	80 3f 30             	cmpb   $0x30,(%rdi)
+  8010da:	74 14                	je     8010f0 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  8010dc:	85 d2                	test   %edx,%edx
+  8010de:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8010e3:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  8010e6:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  8010eb:	4c 63 ca             	movslq %edx,%r9
+  8010ee:	eb 36                	jmp    801126 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8010f0:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  8010f4:	74 0f                	je     801105 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  8010f6:	85 d2                	test   %edx,%edx
+  8010f8:	75 ec                	jne    8010e6 <strtol+0x48>
+        s++;
+  8010fa:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  8010fe:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  801103:	eb e1                	jmp    8010e6 <strtol+0x48>
+        s += 2;
+  801105:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  801109:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  80110e:	eb d6                	jmp    8010e6 <strtol+0x48>
+            dig -= '0';
+  801110:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  801113:	44 0f b6 c1          	movzbl %cl,%r8d
+  801117:	41 39 d0             	cmp    %edx,%r8d
+  80111a:	7d 21                	jge    80113d <strtol+0x9f>
+        val = val * base + dig;
+  80111c:	49 0f af c1          	imul   %r9,%rax
+  801120:	0f b6 c9             	movzbl %cl,%ecx
+  801123:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  801126:	48 83 c7 01          	add    $0x1,%rdi
+  80112a:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  80112e:	80 f9 39             	cmp    $0x39,%cl
+  801131:	76 dd                	jbe    801110 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  801133:	80 f9 7b             	cmp    $0x7b,%cl
+  801136:	77 05                	ja     80113d <strtol+0x9f>
+            dig -= 'a' - 10;
+  801138:	83 e9 57             	sub    $0x57,%ecx
+  80113b:	eb d6                	jmp    801113 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  80113d:	4d 85 d2             	test   %r10,%r10
+  801140:	74 03                	je     801145 <strtol+0xa7>
+  801142:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  801145:	48 89 c2             	mov    %rax,%rdx
+  801148:	48 f7 da             	neg    %rdx
+  80114b:	40 80 fe 2d          	cmp    $0x2d,%sil
+  80114f:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  801153:	c3                   	ret
+
+0000000000801154 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  801154:	55                   	push   %rbp
+  801155:	48 89 e5             	mov    %rsp,%rbp
+  801158:	53                   	push   %rbx
+  801159:	48 89 fa             	mov    %rdi,%rdx
+  80115c:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80115f:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801164:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801169:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80116e:	be 00 00 00 00       	mov    $0x0,%esi
+  801173:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801179:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  80117b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80117f:	c9                   	leave
+  801180:	c3                   	ret
+
+0000000000801181 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  801181:	55                   	push   %rbp
+  801182:	48 89 e5             	mov    %rsp,%rbp
+  801185:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801186:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80118b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801190:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801195:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80119a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80119f:	be 00 00 00 00       	mov    $0x0,%esi
+  8011a4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8011aa:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  8011ac:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8011b0:	c9                   	leave
+  8011b1:	c3                   	ret
+
+00000000008011b2 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  8011b2:	55                   	push   %rbp
+  8011b3:	48 89 e5             	mov    %rsp,%rbp
+  8011b6:	53                   	push   %rbx
+  8011b7:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  8011bb:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8011be:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8011c3:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8011c8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011cd:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8011d2:	be 00 00 00 00       	mov    $0x0,%esi
+  8011d7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8011dd:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8011df:	48 85 c0             	test   %rax,%rax
+  8011e2:	7f 06                	jg     8011ea <sys_env_destroy+0x38>
+}
+  8011e4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8011e8:	c9                   	leave
+  8011e9:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8011ea:	49 89 c0             	mov    %rax,%r8
+  8011ed:	b9 03 00 00 00       	mov    $0x3,%ecx
+  8011f2:	48 ba 90 3e 80 00 00 	movabs $0x803e90,%rdx
+  8011f9:	00 00 00 
+  8011fc:	be 26 00 00 00       	mov    $0x26,%esi
+  801201:	48 bf af 3e 80 00 00 	movabs $0x803eaf,%rdi
+  801208:	00 00 00 
+  80120b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801210:	49 b9 b8 02 80 00 00 	movabs $0x8002b8,%r9
+  801217:	00 00 00 
+  80121a:	41 ff d1             	call   *%r9
+
+000000000080121d <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  80121d:	55                   	push   %rbp
+  80121e:	48 89 e5             	mov    %rsp,%rbp
+  801221:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801222:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801227:	ba 00 00 00 00       	mov    $0x0,%edx
+  80122c:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801231:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801236:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80123b:	be 00 00 00 00       	mov    $0x0,%esi
+  801240:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801246:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  801248:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80124c:	c9                   	leave
+  80124d:	c3                   	ret
+
+000000000080124e <sys_yield>:
+
+void
+sys_yield(void) {
+  80124e:	55                   	push   %rbp
+  80124f:	48 89 e5             	mov    %rsp,%rbp
+  801252:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801253:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801258:	ba 00 00 00 00       	mov    $0x0,%edx
+  80125d:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801262:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801267:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80126c:	be 00 00 00 00       	mov    $0x0,%esi
+  801271:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801277:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  801279:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80127d:	c9                   	leave
+  80127e:	c3                   	ret
+
+000000000080127f <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  80127f:	55                   	push   %rbp
+  801280:	48 89 e5             	mov    %rsp,%rbp
+  801283:	53                   	push   %rbx
+  801284:	48 89 fa             	mov    %rdi,%rdx
+  801287:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80128a:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80128f:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  801296:	00 00 00 
+  801299:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80129e:	be 00 00 00 00       	mov    $0x0,%esi
+  8012a3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8012a9:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  8012ab:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012af:	c9                   	leave
+  8012b0:	c3                   	ret
+
+00000000008012b1 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  8012b1:	55                   	push   %rbp
+  8012b2:	48 89 e5             	mov    %rsp,%rbp
+  8012b5:	53                   	push   %rbx
+  8012b6:	49 89 f8             	mov    %rdi,%r8
+  8012b9:	48 89 d3             	mov    %rdx,%rbx
+  8012bc:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8012bf:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8012c4:	4c 89 c2             	mov    %r8,%rdx
+  8012c7:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012ca:	be 00 00 00 00       	mov    $0x0,%esi
+  8012cf:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8012d5:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  8012d7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012db:	c9                   	leave
+  8012dc:	c3                   	ret
+
+00000000008012dd <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  8012dd:	55                   	push   %rbp
+  8012de:	48 89 e5             	mov    %rsp,%rbp
+  8012e1:	53                   	push   %rbx
+  8012e2:	48 83 ec 08          	sub    $0x8,%rsp
+  8012e6:	89 f8                	mov    %edi,%eax
+  8012e8:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  8012eb:	48 63 f9             	movslq %ecx,%rdi
+  8012ee:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8012f1:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8012f6:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012f9:	be 00 00 00 00       	mov    $0x0,%esi
+  8012fe:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801304:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801306:	48 85 c0             	test   %rax,%rax
+  801309:	7f 06                	jg     801311 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  80130b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80130f:	c9                   	leave
+  801310:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801311:	49 89 c0             	mov    %rax,%r8
+  801314:	b9 04 00 00 00       	mov    $0x4,%ecx
+  801319:	48 ba 90 3e 80 00 00 	movabs $0x803e90,%rdx
+  801320:	00 00 00 
+  801323:	be 26 00 00 00       	mov    $0x26,%esi
+  801328:	48 bf af 3e 80 00 00 	movabs $0x803eaf,%rdi
+  80132f:	00 00 00 
+  801332:	b8 00 00 00 00       	mov    $0x0,%eax
+  801337:	49 b9 b8 02 80 00 00 	movabs $0x8002b8,%r9
+  80133e:	00 00 00 
+  801341:	41 ff d1             	call   *%r9
+
+0000000000801344 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801344:	55                   	push   %rbp
+  801345:	48 89 e5             	mov    %rsp,%rbp
+  801348:	53                   	push   %rbx
+  801349:	48 83 ec 08          	sub    $0x8,%rsp
+  80134d:	89 f8                	mov    %edi,%eax
+  80134f:	49 89 f2             	mov    %rsi,%r10
+  801352:	48 89 cf             	mov    %rcx,%rdi
+  801355:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  801358:	48 63 da             	movslq %edx,%rbx
+  80135b:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80135e:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801363:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801366:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  801369:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80136b:	48 85 c0             	test   %rax,%rax
+  80136e:	7f 06                	jg     801376 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  801370:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801374:	c9                   	leave
+  801375:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801376:	49 89 c0             	mov    %rax,%r8
+  801379:	b9 05 00 00 00       	mov    $0x5,%ecx
+  80137e:	48 ba 90 3e 80 00 00 	movabs $0x803e90,%rdx
+  801385:	00 00 00 
+  801388:	be 26 00 00 00       	mov    $0x26,%esi
+  80138d:	48 bf af 3e 80 00 00 	movabs $0x803eaf,%rdi
+  801394:	00 00 00 
+  801397:	b8 00 00 00 00       	mov    $0x0,%eax
+  80139c:	49 b9 b8 02 80 00 00 	movabs $0x8002b8,%r9
+  8013a3:	00 00 00 
+  8013a6:	41 ff d1             	call   *%r9
+
+00000000008013a9 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  8013a9:	55                   	push   %rbp
+  8013aa:	48 89 e5             	mov    %rsp,%rbp
+  8013ad:	53                   	push   %rbx
+  8013ae:	48 83 ec 08          	sub    $0x8,%rsp
+  8013b2:	48 89 f1             	mov    %rsi,%rcx
+  8013b5:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  8013b8:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8013bb:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8013c0:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013c5:	be 00 00 00 00       	mov    $0x0,%esi
+  8013ca:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013d0:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8013d2:	48 85 c0             	test   %rax,%rax
+  8013d5:	7f 06                	jg     8013dd <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  8013d7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013db:	c9                   	leave
+  8013dc:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8013dd:	49 89 c0             	mov    %rax,%r8
+  8013e0:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8013e5:	48 ba 90 3e 80 00 00 	movabs $0x803e90,%rdx
+  8013ec:	00 00 00 
+  8013ef:	be 26 00 00 00       	mov    $0x26,%esi
+  8013f4:	48 bf af 3e 80 00 00 	movabs $0x803eaf,%rdi
+  8013fb:	00 00 00 
+  8013fe:	b8 00 00 00 00       	mov    $0x0,%eax
+  801403:	49 b9 b8 02 80 00 00 	movabs $0x8002b8,%r9
+  80140a:	00 00 00 
+  80140d:	41 ff d1             	call   *%r9
+
+0000000000801410 <sys_region_batch>:
+
+int
+sys_region_batch(const struct RegionOp *ops, size_t count) {
+  801410:	55                   	push   %rbp
+  801411:	48 89 e5             	mov    %rsp,%rbp
+  801414:	53                   	push   %rbx
+  801415:	48 83 ec 08          	sub    $0x8,%rsp
+  801419:	48 89 fa             	mov    %rdi,%rdx
+  80141c:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80141f:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801424:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801429:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80142e:	be 00 00 00 00       	mov    $0x0,%esi
+  801433:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801439:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80143b:	48 85 c0             	test   %rax,%rax
+  80143e:	7f 06                	jg     801446 <sys_region_batch+0x36>
+        else
+            platform_asan_unpoison(va, ops[i].size);
+    }
+#endif
+    return res;
+}
+  801440:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801444:	c9                   	leave
+  801445:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801446:	49 89 c0             	mov    %rax,%r8
+  801449:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  80144e:	48 ba 90 3e 80 00 00 	movabs $0x803e90,%rdx
+  801455:	00 00 00 
+  801458:	be 26 00 00 00       	mov    $0x26,%esi
+  80145d:	48 bf af 3e 80 00 00 	movabs $0x803eaf,%rdi
+  801464:	00 00 00 
+  801467:	b8 00 00 00 00       	mov    $0x0,%eax
+  80146c:	49 b9 b8 02 80 00 00 	movabs $0x8002b8,%r9
+  801473:	00 00 00 
+  801476:	41 ff d1             	call   *%r9
+
+0000000000801479 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  801479:	55                   	push   %rbp
+  80147a:	48 89 e5             	mov    %rsp,%rbp
+  80147d:	53                   	push   %rbx
+  80147e:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  801482:	48 63 ce             	movslq %esi,%rcx
+  801485:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801488:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80148d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801492:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801497:	be 00 00 00 00       	mov    $0x0,%esi
+  80149c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014a2:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8014a4:	48 85 c0             	test   %rax,%rax
+  8014a7:	7f 06                	jg     8014af <sys_env_set_status+0x36>
+}
+  8014a9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014ad:	c9                   	leave
+  8014ae:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8014af:	49 89 c0             	mov    %rax,%r8
+  8014b2:	b9 09 00 00 00       	mov    $0x9,%ecx
+  8014b7:	48 ba 90 3e 80 00 00 	movabs $0x803e90,%rdx
+  8014be:	00 00 00 
+  8014c1:	be 26 00 00 00       	mov    $0x26,%esi
+  8014c6:	48 bf af 3e 80 00 00 	movabs $0x803eaf,%rdi
+  8014cd:	00 00 00 
+  8014d0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014d5:	49 b9 b8 02 80 00 00 	movabs $0x8002b8,%r9
+  8014dc:	00 00 00 
+  8014df:	41 ff d1             	call   *%r9
+
+00000000008014e2 <sys_env_set_weight>:
+
+int
+sys_env_set_weight(envid_t envid, uint32_t weight) {
+  8014e2:	55                   	push   %rbp
+  8014e3:	48 89 e5             	mov    %rsp,%rbp
+  8014e6:	53                   	push   %rbx
+  8014e7:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_weight, 1, envid, weight, 0, 0, 0, 0);
+  8014eb:	89 f1                	mov    %esi,%ecx
+  8014ed:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8014f0:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8014f5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014fa:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014ff:	be 00 00 00 00       	mov    $0x0,%esi
+  801504:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80150a:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80150c:	48 85 c0             	test   %rax,%rax
+  80150f:	7f 06                	jg     801517 <sys_env_set_weight+0x35>
+}
+  801511:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801515:	c9                   	leave
+  801516:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801517:	49 89 c0             	mov    %rax,%r8
+  80151a:	b9 10 00 00 00       	mov    $0x10,%ecx
+  80151f:	48 ba 90 3e 80 00 00 	movabs $0x803e90,%rdx
+  801526:	00 00 00 
+  801529:	be 26 00 00 00       	mov    $0x26,%esi
+  80152e:	48 bf af 3e 80 00 00 	movabs $0x803eaf,%rdi
+  801535:	00 00 00 
+  801538:	b8 00 00 00 00       	mov    $0x0,%eax
+  80153d:	49 b9 b8 02 80 00 00 	movabs $0x8002b8,%r9
+  801544:	00 00 00 
+  801547:	41 ff d1             	call   *%r9
+
+000000000080154a <sys_env_set_rt>:
+
+int
+sys_env_set_rt(envid_t envid, uint64_t period, uint64_t budget, uint64_t deadline) {
+  80154a:	55                   	push   %rbp
+  80154b:	48 89 e5             	mov    %rsp,%rbp
+  80154e:	53                   	push   %rbx
+  80154f:	48 83 ec 08          	sub    $0x8,%rsp
+  801553:	89 f8                	mov    %edi,%eax
+  801555:	48 89 d3             	mov    %rdx,%rbx
+  801558:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_env_set_rt, 1, envid, period, budget, deadline, 0, 0);
+  80155b:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80155e:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801563:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801566:	be 00 00 00 00       	mov    $0x0,%esi
+  80156b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801571:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801573:	48 85 c0             	test   %rax,%rax
+  801576:	7f 06                	jg     80157e <sys_env_set_rt+0x34>
+}
+  801578:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80157c:	c9                   	leave
+  80157d:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80157e:	49 89 c0             	mov    %rax,%r8
+  801581:	b9 11 00 00 00       	mov    $0x11,%ecx
+  801586:	48 ba 90 3e 80 00 00 	movabs $0x803e90,%rdx
+  80158d:	00 00 00 
+  801590:	be 26 00 00 00       	mov    $0x26,%esi
+  801595:	48 bf af 3e 80 00 00 	movabs $0x803eaf,%rdi
+  80159c:	00 00 00 
+  80159f:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015a4:	49 b9 b8 02 80 00 00 	movabs $0x8002b8,%r9
+  8015ab:	00 00 00 
+  8015ae:	41 ff d1             	call   *%r9
+
+00000000008015b1 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  8015b1:	55                   	push   %rbp
+  8015b2:	48 89 e5             	mov    %rsp,%rbp
+  8015b5:	53                   	push   %rbx
+  8015b6:	48 83 ec 08          	sub    $0x8,%rsp
+  8015ba:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  8015bd:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8015c0:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8015c5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015ca:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015cf:	be 00 00 00 00       	mov    $0x0,%esi
+  8015d4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015da:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8015dc:	48 85 c0             	test   %rax,%rax
+  8015df:	7f 06                	jg     8015e7 <sys_env_set_trapframe+0x36>
+}
+  8015e1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015e5:	c9                   	leave
+  8015e6:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8015e7:	49 89 c0             	mov    %rax,%r8
+  8015ea:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  8015ef:	48 ba 90 3e 80 00 00 	movabs $0x803e90,%rdx
+  8015f6:	00 00 00 
+  8015f9:	be 26 00 00 00       	mov    $0x26,%esi
+  8015fe:	48 bf af 3e 80 00 00 	movabs $0x803eaf,%rdi
+  801605:	00 00 00 
+  801608:	b8 00 00 00 00       	mov    $0x0,%eax
+  80160d:	49 b9 b8 02 80 00 00 	movabs $0x8002b8,%r9
+  801614:	00 00 00 
+  801617:	41 ff d1             	call   *%r9
+
+000000000080161a <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  80161a:	55                   	push   %rbp
+  80161b:	48 89 e5             	mov    %rsp,%rbp
+  80161e:	53                   	push   %rbx
+  80161f:	48 83 ec 08          	sub    $0x8,%rsp
+  801623:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  801626:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801629:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80162e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801633:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801638:	be 00 00 00 00       	mov    $0x0,%esi
+  80163d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801643:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801645:	48 85 c0             	test   %rax,%rax
+  801648:	7f 06                	jg     801650 <sys_env_set_pgfault_upcall+0x36>
+}
+  80164a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80164e:	c9                   	leave
+  80164f:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801650:	49 89 c0             	mov    %rax,%r8
+  801653:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  801658:	48 ba 90 3e 80 00 00 	movabs $0x803e90,%rdx
+  80165f:	00 00 00 
+  801662:	be 26 00 00 00       	mov    $0x26,%esi
+  801667:	48 bf af 3e 80 00 00 	movabs $0x803eaf,%rdi
+  80166e:	00 00 00 
+  801671:	b8 00 00 00 00       	mov    $0x0,%eax
+  801676:	49 b9 b8 02 80 00 00 	movabs $0x8002b8,%r9
+  80167d:	00 00 00 
+  801680:	41 ff d1             	call   *%r9
+
+0000000000801683 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  801683:	55                   	push   %rbp
+  801684:	48 89 e5             	mov    %rsp,%rbp
+  801687:	53                   	push   %rbx
+  801688:	89 f8                	mov    %edi,%eax
+  80168a:	49 89 f1             	mov    %rsi,%r9
+  80168d:	48 89 d3             	mov    %rdx,%rbx
+  801690:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  801693:	49 63 f0             	movslq %r8d,%rsi
+  801696:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801699:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80169e:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8016a1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8016a7:	cd 30                	int    $0x30
+}
+  8016a9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8016ad:	c9                   	leave
+  8016ae:	c3                   	ret
+
+00000000008016af <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  8016af:	55                   	push   %rbp
+  8016b0:	48 89 e5             	mov    %rsp,%rbp
+  8016b3:	53                   	push   %rbx
+  8016b4:	48 83 ec 08          	sub    $0x8,%rsp
+  8016b8:	48 89 fa             	mov    %rdi,%rdx
+  8016bb:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8016be:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8016c3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016c8:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8016cd:	be 00 00 00 00       	mov    $0x0,%esi
+  8016d2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8016d8:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8016da:	48 85 c0             	test   %rax,%rax
+  8016dd:	7f 06                	jg     8016e5 <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8016df:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8016e3:	c9                   	leave
+  8016e4:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8016e5:	49 89 c0             	mov    %rax,%r8
+  8016e8:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  8016ed:	48 ba 90 3e 80 00 00 	movabs $0x803e90,%rdx
+  8016f4:	00 00 00 
+  8016f7:	be 26 00 00 00       	mov    $0x26,%esi
+  8016fc:	48 bf af 3e 80 00 00 	movabs $0x803eaf,%rdi
+  801703:	00 00 00 
+  801706:	b8 00 00 00 00       	mov    $0x0,%eax
+  80170b:	49 b9 b8 02 80 00 00 	movabs $0x8002b8,%r9
+  801712:	00 00 00 
+  801715:	41 ff d1             	call   *%r9
+
+0000000000801718 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801718:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  80171f:	ff ff ff 
+  801722:	48 01 f8             	add    %rdi,%rax
+  801725:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  801729:	c3                   	ret
+
+000000000080172a <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80172a:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801731:	ff ff ff 
+  801734:	48 01 f8             	add    %rdi,%rax
+  801737:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  80173b:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  801741:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  801745:	c3                   	ret
+
+0000000000801746 <fd_alloc_from>:
+}
+
+/* Like fd_alloc(), but only considers fds starting from fdnum,
+ * so that several fds can be found before their pages are allocated */
+int
+fd_alloc_from(int fdnum, struct Fd **fd_store) {
+  801746:	55                   	push   %rbp
+  801747:	48 89 e5             	mov    %rsp,%rbp
+  80174a:	41 57                	push   %r15
+  80174c:	41 56                	push   %r14
+  80174e:	41 55                	push   %r13
+  801750:	41 54                	push   %r12
+  801752:	53                   	push   %rbx
+  801753:	48 83 ec 08          	sub    $0x8,%rsp
+  801757:	49 89 f7             	mov    %rsi,%r15
+    for (int i = MAX(fdnum, 0); i < MAXFD; i++) {
+  80175a:	85 ff                	test   %edi,%edi
+  80175c:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  801762:	44 0f 49 e7          	cmovns %edi,%r12d
+  801766:	83 ff 1f             	cmp    $0x1f,%edi
+  801769:	7f 37                	jg     8017a2 <fd_alloc_from+0x5c>
+  80176b:	49 63 dc             	movslq %r12d,%rbx
+  80176e:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  801775:	48 c1 e3 0c          	shl    $0xc,%rbx
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  801779:	49 be 5f 32 80 00 00 	movabs $0x80325f,%r14
+  801780:	00 00 00 
+        struct Fd *fd = INDEX2FD(i);
+  801783:	49 89 dd             	mov    %rbx,%r13
+        if (!(get_prot(fd) & PROT_R)) {
+  801786:	48 89 df             	mov    %rbx,%rdi
+  801789:	41 ff d6             	call   *%r14
+  80178c:	83 e0 04             	and    $0x4,%eax
+  80178f:	74 1c                	je     8017ad <fd_alloc_from+0x67>
+    for (int i = MAX(fdnum, 0); i < MAXFD; i++) {
+  801791:	41 83 c4 01          	add    $0x1,%r12d
+  801795:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  80179c:	41 83 fc 1f          	cmp    $0x1f,%r12d
+  8017a0:	7e e1                	jle    801783 <fd_alloc_from+0x3d>
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  8017a2:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  8017a8:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  8017ad:	4d 89 2f             	mov    %r13,(%r15)
+}
+  8017b0:	48 83 c4 08          	add    $0x8,%rsp
+  8017b4:	5b                   	pop    %rbx
+  8017b5:	41 5c                	pop    %r12
+  8017b7:	41 5d                	pop    %r13
+  8017b9:	41 5e                	pop    %r14
+  8017bb:	41 5f                	pop    %r15
+  8017bd:	5d                   	pop    %rbp
+  8017be:	c3                   	ret
+
+00000000008017bf <fd_alloc>:
+fd_alloc(struct Fd **fd_store) {
+  8017bf:	55                   	push   %rbp
+  8017c0:	48 89 e5             	mov    %rsp,%rbp
+  8017c3:	48 89 fe             	mov    %rdi,%rsi
+    return fd_alloc_from(0, fd_store);
+  8017c6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8017cb:	48 b8 46 17 80 00 00 	movabs $0x801746,%rax
+  8017d2:	00 00 00 
+  8017d5:	ff d0                	call   *%rax
+}
+  8017d7:	5d                   	pop    %rbp
+  8017d8:	c3                   	ret
+
+00000000008017d9 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  8017d9:	83 ff 1f             	cmp    $0x1f,%edi
+  8017dc:	77 39                	ja     801817 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  8017de:	55                   	push   %rbp
+  8017df:	48 89 e5             	mov    %rsp,%rbp
+  8017e2:	41 54                	push   %r12
+  8017e4:	53                   	push   %rbx
+  8017e5:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  8017e8:	48 63 df             	movslq %edi,%rbx
+  8017eb:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  8017f2:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  8017f6:	48 89 df             	mov    %rbx,%rdi
+  8017f9:	48 b8 5f 32 80 00 00 	movabs $0x80325f,%rax
+  801800:	00 00 00 
+  801803:	ff d0                	call   *%rax
+  801805:	a8 04                	test   $0x4,%al
+  801807:	74 14                	je     80181d <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  801809:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  80180d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801812:	5b                   	pop    %rbx
+  801813:	41 5c                	pop    %r12
+  801815:	5d                   	pop    %rbp
+  801816:	c3                   	ret
+        return -E_INVAL;
+  801817:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  80181c:	c3                   	ret
+        return -E_INVAL;
+  80181d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801822:	eb ee                	jmp    801812 <fd_lookup+0x39>
+
+0000000000801824 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  801824:	55                   	push   %rbp
+  801825:	48 89 e5             	mov    %rsp,%rbp
+  801828:	41 54                	push   %r12
+  80182a:	53                   	push   %rbx
+  80182b:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  80182e:	48 b8 40 3f 80 00 00 	movabs $0x803f40,%rax
+  801835:	00 00 00 
+  801838:	48 bb 20 50 80 00 00 	movabs $0x805020,%rbx
+  80183f:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  801842:	39 3b                	cmp    %edi,(%rbx)
+  801844:	74 47                	je     80188d <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  801846:	48 83 c0 08          	add    $0x8,%rax
+  80184a:	48 8b 18             	mov    (%rax),%rbx
+  80184d:	48 85 db             	test   %rbx,%rbx
+  801850:	75 f0                	jne    801842 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801852:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  801859:	00 00 00 
+  80185c:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+  801862:	89 fa                	mov    %edi,%edx
+  801864:	48 bf c0 3e 80 00 00 	movabs $0x803ec0,%rdi
+  80186b:	00 00 00 
+  80186e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801873:	48 b9 08 04 80 00 00 	movabs $0x800408,%rcx
+  80187a:	00 00 00 
+  80187d:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  80187f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  801884:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  801888:	5b                   	pop    %rbx
+  801889:	41 5c                	pop    %r12
+  80188b:	5d                   	pop    %rbp
+  80188c:	c3                   	ret
+            return 0;
+  80188d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801892:	eb f0                	jmp    801884 <dev_lookup+0x60>
+
+0000000000801894 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  801894:	55                   	push   %rbp
+  801895:	48 89 e5             	mov    %rsp,%rbp
+  801898:	41 55                	push   %r13
+  80189a:	41 54                	push   %r12
+  80189c:	53                   	push   %rbx
+  80189d:	48 83 ec 18          	sub    $0x18,%rsp
+  8018a1:	48 89 fb             	mov    %rdi,%rbx
+  8018a4:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8018a7:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  8018ae:	ff ff ff 
+  8018b1:	48 01 df             	add    %rbx,%rdi
+  8018b4:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  8018b8:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8018bc:	48 b8 d9 17 80 00 00 	movabs $0x8017d9,%rax
+  8018c3:	00 00 00 
+  8018c6:	ff d0                	call   *%rax
+  8018c8:	41 89 c5             	mov    %eax,%r13d
+  8018cb:	85 c0                	test   %eax,%eax
+  8018cd:	78 06                	js     8018d5 <fd_close+0x41>
+  8018cf:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  8018d3:	74 1a                	je     8018ef <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  8018d5:	45 84 e4             	test   %r12b,%r12b
+  8018d8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018dd:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  8018e1:	44 89 e8             	mov    %r13d,%eax
+  8018e4:	48 83 c4 18          	add    $0x18,%rsp
+  8018e8:	5b                   	pop    %rbx
+  8018e9:	41 5c                	pop    %r12
+  8018eb:	41 5d                	pop    %r13
+  8018ed:	5d                   	pop    %rbp
+  8018ee:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8018ef:	8b 3b                	mov    (%rbx),%edi
+  8018f1:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8018f5:	48 b8 24 18 80 00 00 	movabs $0x801824,%rax
+  8018fc:	00 00 00 
+  8018ff:	ff d0                	call   *%rax
+  801901:	41 89 c5             	mov    %eax,%r13d
+  801904:	85 c0                	test   %eax,%eax
+  801906:	78 1b                	js     801923 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  801908:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80190c:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801910:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801916:	48 85 c0             	test   %rax,%rax
+  801919:	74 08                	je     801923 <fd_close+0x8f>
+  80191b:	48 89 df             	mov    %rbx,%rdi
+  80191e:	ff d0                	call   *%rax
+  801920:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801923:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801928:	48 89 de             	mov    %rbx,%rsi
+  80192b:	bf 00 00 00 00       	mov    $0x0,%edi
+  801930:	48 b8 a9 13 80 00 00 	movabs $0x8013a9,%rax
+  801937:	00 00 00 
+  80193a:	ff d0                	call   *%rax
+    return res;
+  80193c:	eb a3                	jmp    8018e1 <fd_close+0x4d>
+
+000000000080193e <close>:
+
+int
+close(int fdnum) {
+  80193e:	55                   	push   %rbp
+  80193f:	48 89 e5             	mov    %rsp,%rbp
+  801942:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  801946:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80194a:	48 b8 d9 17 80 00 00 	movabs $0x8017d9,%rax
+  801951:	00 00 00 
+  801954:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801956:	85 c0                	test   %eax,%eax
+  801958:	78 15                	js     80196f <close+0x31>
+
+    return fd_close(fd, 1);
+  80195a:	be 01 00 00 00       	mov    $0x1,%esi
+  80195f:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801963:	48 b8 94 18 80 00 00 	movabs $0x801894,%rax
+  80196a:	00 00 00 
+  80196d:	ff d0                	call   *%rax
+}
+  80196f:	c9                   	leave
+  801970:	c3                   	ret
+
+0000000000801971 <close_all>:
+
+void
+close_all(void) {
+  801971:	55                   	push   %rbp
+  801972:	48 89 e5             	mov    %rsp,%rbp
+  801975:	41 54                	push   %r12
+  801977:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  801978:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80197d:	49 bc 3e 19 80 00 00 	movabs $0x80193e,%r12
+  801984:	00 00 00 
+  801987:	89 df                	mov    %ebx,%edi
+  801989:	41 ff d4             	call   *%r12
+  80198c:	83 c3 01             	add    $0x1,%ebx
+  80198f:	83 fb 20             	cmp    $0x20,%ebx
+  801992:	75 f3                	jne    801987 <close_all+0x16>
+}
+  801994:	5b                   	pop    %rbx
+  801995:	41 5c                	pop    %r12
+  801997:	5d                   	pop    %rbp
+  801998:	c3                   	ret
+
+0000000000801999 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  801999:	55                   	push   %rbp
+  80199a:	48 89 e5             	mov    %rsp,%rbp
+  80199d:	41 57                	push   %r15
+  80199f:	41 56                	push   %r14
+  8019a1:	41 55                	push   %r13
+  8019a3:	41 54                	push   %r12
+  8019a5:	53                   	push   %rbx
+  8019a6:	48 83 ec 18          	sub    $0x18,%rsp
+  8019aa:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  8019ad:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  8019b1:	48 b8 d9 17 80 00 00 	movabs $0x8017d9,%rax
+  8019b8:	00 00 00 
+  8019bb:	ff d0                	call   *%rax
+  8019bd:	89 c3                	mov    %eax,%ebx
+  8019bf:	85 c0                	test   %eax,%eax
+  8019c1:	0f 88 b8 00 00 00    	js     801a7f <dup+0xe6>
+    close(newfdnum);
+  8019c7:	44 89 e7             	mov    %r12d,%edi
+  8019ca:	48 b8 3e 19 80 00 00 	movabs $0x80193e,%rax
+  8019d1:	00 00 00 
+  8019d4:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  8019d6:	4d 63 ec             	movslq %r12d,%r13
+  8019d9:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  8019e0:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  8019e4:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  8019e8:	4c 89 ff             	mov    %r15,%rdi
+  8019eb:	49 be 2a 17 80 00 00 	movabs $0x80172a,%r14
+  8019f2:	00 00 00 
+  8019f5:	41 ff d6             	call   *%r14
+  8019f8:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  8019fb:	4c 89 ef             	mov    %r13,%rdi
+  8019fe:	41 ff d6             	call   *%r14
+  801a01:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  801a04:	48 89 df             	mov    %rbx,%rdi
+  801a07:	48 b8 5f 32 80 00 00 	movabs $0x80325f,%rax
+  801a0e:	00 00 00 
+  801a11:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  801a13:	a8 04                	test   $0x4,%al
+  801a15:	74 2b                	je     801a42 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  801a17:	41 89 c1             	mov    %eax,%r9d
+  801a1a:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801a20:	4c 89 f1             	mov    %r14,%rcx
+  801a23:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a28:	48 89 de             	mov    %rbx,%rsi
+  801a2b:	bf 00 00 00 00       	mov    $0x0,%edi
+  801a30:	48 b8 44 13 80 00 00 	movabs $0x801344,%rax
+  801a37:	00 00 00 
+  801a3a:	ff d0                	call   *%rax
+  801a3c:	89 c3                	mov    %eax,%ebx
+  801a3e:	85 c0                	test   %eax,%eax
+  801a40:	78 4e                	js     801a90 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  801a42:	4c 89 ff             	mov    %r15,%rdi
+  801a45:	48 b8 5f 32 80 00 00 	movabs $0x80325f,%rax
+  801a4c:	00 00 00 
+  801a4f:	ff d0                	call   *%rax
+  801a51:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801a54:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801a5a:	4c 89 e9             	mov    %r13,%rcx
+  801a5d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a62:	4c 89 fe             	mov    %r15,%rsi
+  801a65:	bf 00 00 00 00       	mov    $0x0,%edi
+  801a6a:	48 b8 44 13 80 00 00 	movabs $0x801344,%rax
+  801a71:	00 00 00 
+  801a74:	ff d0                	call   *%rax
+  801a76:	89 c3                	mov    %eax,%ebx
+  801a78:	85 c0                	test   %eax,%eax
+  801a7a:	78 14                	js     801a90 <dup+0xf7>
+
+    return newfdnum;
+  801a7c:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  801a7f:	89 d8                	mov    %ebx,%eax
+  801a81:	48 83 c4 18          	add    $0x18,%rsp
+  801a85:	5b                   	pop    %rbx
+  801a86:	41 5c                	pop    %r12
+  801a88:	41 5d                	pop    %r13
+  801a8a:	41 5e                	pop    %r14
+  801a8c:	41 5f                	pop    %r15
+  801a8e:	5d                   	pop    %rbp
+  801a8f:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  801a90:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801a95:	4c 89 ee             	mov    %r13,%rsi
+  801a98:	bf 00 00 00 00       	mov    $0x0,%edi
+  801a9d:	49 bc a9 13 80 00 00 	movabs $0x8013a9,%r12
+  801aa4:	00 00 00 
+  801aa7:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  801aaa:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801aaf:	4c 89 f6             	mov    %r14,%rsi
+  801ab2:	bf 00 00 00 00       	mov    $0x0,%edi
+  801ab7:	41 ff d4             	call   *%r12
+    return res;
+  801aba:	eb c3                	jmp    801a7f <dup+0xe6>
+
+0000000000801abc <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  801abc:	55                   	push   %rbp
+  801abd:	48 89 e5             	mov    %rsp,%rbp
+  801ac0:	41 56                	push   %r14
+  801ac2:	41 55                	push   %r13
+  801ac4:	41 54                	push   %r12
+  801ac6:	53                   	push   %rbx
+  801ac7:	48 83 ec 10          	sub    $0x10,%rsp
+  801acb:	89 fb                	mov    %edi,%ebx
+  801acd:	49 89 f4             	mov    %rsi,%r12
+  801ad0:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801ad3:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801ad7:	48 b8 d9 17 80 00 00 	movabs $0x8017d9,%rax
+  801ade:	00 00 00 
+  801ae1:	ff d0                	call   *%rax
+  801ae3:	85 c0                	test   %eax,%eax
+  801ae5:	78 4c                	js     801b33 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801ae7:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801aeb:	41 8b 3e             	mov    (%r14),%edi
+  801aee:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801af2:	48 b8 24 18 80 00 00 	movabs $0x801824,%rax
+  801af9:	00 00 00 
+  801afc:	ff d0                	call   *%rax
+  801afe:	85 c0                	test   %eax,%eax
+  801b00:	78 35                	js     801b37 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801b02:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801b06:	83 e0 03             	and    $0x3,%eax
+  801b09:	83 f8 01             	cmp    $0x1,%eax
+  801b0c:	74 2d                	je     801b3b <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801b0e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801b12:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801b16:	48 85 c0             	test   %rax,%rax
+  801b19:	74 56                	je     801b71 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  801b1b:	4c 89 ea             	mov    %r13,%rdx
+  801b1e:	4c 89 e6             	mov    %r12,%rsi
+  801b21:	4c 89 f7             	mov    %r14,%rdi
+  801b24:	ff d0                	call   *%rax
+}
+  801b26:	48 83 c4 10          	add    $0x10,%rsp
+  801b2a:	5b                   	pop    %rbx
+  801b2b:	41 5c                	pop    %r12
+  801b2d:	41 5d                	pop    %r13
+  801b2f:	41 5e                	pop    %r14
+  801b31:	5d                   	pop    %rbp
+  801b32:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801b33:	48 98                	cltq
+  801b35:	eb ef                	jmp    801b26 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801b37:	48 98                	cltq
+  801b39:	eb eb                	jmp    801b26 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801b3b:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  801b42:	00 00 00 
+  801b45:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+  801b4b:	89 da                	mov    %ebx,%edx
+  801b4d:	48 bf 01 3f 80 00 00 	movabs $0x803f01,%rdi
+  801b54:	00 00 00 
+  801b57:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b5c:	48 b9 08 04 80 00 00 	movabs $0x800408,%rcx
+  801b63:	00 00 00 
+  801b66:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801b68:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801b6f:	eb b5                	jmp    801b26 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801b71:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801b78:	eb ac                	jmp    801b26 <read+0x6a>
+
+0000000000801b7a <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801b7a:	55                   	push   %rbp
+  801b7b:	48 89 e5             	mov    %rsp,%rbp
+  801b7e:	41 57                	push   %r15
+  801b80:	41 56                	push   %r14
+  801b82:	41 55                	push   %r13
+  801b84:	41 54                	push   %r12
+  801b86:	53                   	push   %rbx
+  801b87:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  801b8b:	48 85 d2             	test   %rdx,%rdx
+  801b8e:	74 54                	je     801be4 <readn+0x6a>
+  801b90:	41 89 fd             	mov    %edi,%r13d
+  801b93:	49 89 f6             	mov    %rsi,%r14
+  801b96:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  801b99:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  801b9e:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  801ba3:	49 bf bc 1a 80 00 00 	movabs $0x801abc,%r15
+  801baa:	00 00 00 
+  801bad:	4c 89 e2             	mov    %r12,%rdx
+  801bb0:	48 29 f2             	sub    %rsi,%rdx
+  801bb3:	4c 01 f6             	add    %r14,%rsi
+  801bb6:	44 89 ef             	mov    %r13d,%edi
+  801bb9:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  801bbc:	85 c0                	test   %eax,%eax
+  801bbe:	78 20                	js     801be0 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  801bc0:	01 c3                	add    %eax,%ebx
+  801bc2:	85 c0                	test   %eax,%eax
+  801bc4:	74 08                	je     801bce <readn+0x54>
+  801bc6:	48 63 f3             	movslq %ebx,%rsi
+  801bc9:	4c 39 e6             	cmp    %r12,%rsi
+  801bcc:	72 df                	jb     801bad <readn+0x33>
+    }
+    return res;
+  801bce:	48 63 c3             	movslq %ebx,%rax
+}
+  801bd1:	48 83 c4 08          	add    $0x8,%rsp
+  801bd5:	5b                   	pop    %rbx
+  801bd6:	41 5c                	pop    %r12
+  801bd8:	41 5d                	pop    %r13
+  801bda:	41 5e                	pop    %r14
+  801bdc:	41 5f                	pop    %r15
+  801bde:	5d                   	pop    %rbp
+  801bdf:	c3                   	ret
+        if (inc < 0) return inc;
+  801be0:	48 98                	cltq
+  801be2:	eb ed                	jmp    801bd1 <readn+0x57>
+    int inc = 1, res = 0;
+  801be4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801be9:	eb e3                	jmp    801bce <readn+0x54>
+
+0000000000801beb <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  801beb:	55                   	push   %rbp
+  801bec:	48 89 e5             	mov    %rsp,%rbp
+  801bef:	41 56                	push   %r14
+  801bf1:	41 55                	push   %r13
+  801bf3:	41 54                	push   %r12
+  801bf5:	53                   	push   %rbx
+  801bf6:	48 83 ec 10          	sub    $0x10,%rsp
+  801bfa:	89 fb                	mov    %edi,%ebx
+  801bfc:	49 89 f4             	mov    %rsi,%r12
+  801bff:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801c02:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801c06:	48 b8 d9 17 80 00 00 	movabs $0x8017d9,%rax
+  801c0d:	00 00 00 
+  801c10:	ff d0                	call   *%rax
+  801c12:	85 c0                	test   %eax,%eax
+  801c14:	78 47                	js     801c5d <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801c16:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801c1a:	41 8b 3e             	mov    (%r14),%edi
+  801c1d:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801c21:	48 b8 24 18 80 00 00 	movabs $0x801824,%rax
+  801c28:	00 00 00 
+  801c2b:	ff d0                	call   *%rax
+  801c2d:	85 c0                	test   %eax,%eax
+  801c2f:	78 30                	js     801c61 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801c31:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  801c36:	74 2d                	je     801c65 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801c38:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801c3c:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801c40:	48 85 c0             	test   %rax,%rax
+  801c43:	74 56                	je     801c9b <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  801c45:	4c 89 ea             	mov    %r13,%rdx
+  801c48:	4c 89 e6             	mov    %r12,%rsi
+  801c4b:	4c 89 f7             	mov    %r14,%rdi
+  801c4e:	ff d0                	call   *%rax
+}
+  801c50:	48 83 c4 10          	add    $0x10,%rsp
+  801c54:	5b                   	pop    %rbx
+  801c55:	41 5c                	pop    %r12
+  801c57:	41 5d                	pop    %r13
+  801c59:	41 5e                	pop    %r14
+  801c5b:	5d                   	pop    %rbp
+  801c5c:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801c5d:	48 98                	cltq
+  801c5f:	eb ef                	jmp    801c50 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801c61:	48 98                	cltq
+  801c63:	eb eb                	jmp    801c50 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801c65:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  801c6c:	00 00 00 
+  801c6f:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+  801c75:	89 da                	mov    %ebx,%edx
+  801c77:	48 bf 1d 3f 80 00 00 	movabs $0x803f1d,%rdi
+  801c7e:	00 00 00 
+  801c81:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c86:	48 b9 08 04 80 00 00 	movabs $0x800408,%rcx
+  801c8d:	00 00 00 
+  801c90:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801c92:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801c99:	eb b5                	jmp    801c50 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801c9b:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801ca2:	eb ac                	jmp    801c50 <write+0x65>
+
+0000000000801ca4 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  801ca4:	55                   	push   %rbp
+  801ca5:	48 89 e5             	mov    %rsp,%rbp
+  801ca8:	53                   	push   %rbx
+  801ca9:	48 83 ec 18          	sub    $0x18,%rsp
+  801cad:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801caf:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801cb3:	48 b8 d9 17 80 00 00 	movabs $0x8017d9,%rax
+  801cba:	00 00 00 
+  801cbd:	ff d0                	call   *%rax
+  801cbf:	85 c0                	test   %eax,%eax
+  801cc1:	78 0c                	js     801ccf <seek+0x2b>
+
+    fd->fd_offset = offset;
+  801cc3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801cc7:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  801cca:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801ccf:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801cd3:	c9                   	leave
+  801cd4:	c3                   	ret
+
+0000000000801cd5 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  801cd5:	55                   	push   %rbp
+  801cd6:	48 89 e5             	mov    %rsp,%rbp
+  801cd9:	41 55                	push   %r13
+  801cdb:	41 54                	push   %r12
+  801cdd:	53                   	push   %rbx
+  801cde:	48 83 ec 18          	sub    $0x18,%rsp
+  801ce2:	89 fb                	mov    %edi,%ebx
+  801ce4:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801ce7:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801ceb:	48 b8 d9 17 80 00 00 	movabs $0x8017d9,%rax
+  801cf2:	00 00 00 
+  801cf5:	ff d0                	call   *%rax
+  801cf7:	85 c0                	test   %eax,%eax
+  801cf9:	78 38                	js     801d33 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801cfb:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  801cff:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  801d03:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801d07:	48 b8 24 18 80 00 00 	movabs $0x801824,%rax
+  801d0e:	00 00 00 
+  801d11:	ff d0                	call   *%rax
+  801d13:	85 c0                	test   %eax,%eax
+  801d15:	78 1c                	js     801d33 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801d17:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  801d1c:	74 20                	je     801d3e <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801d1e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801d22:	48 8b 40 30          	mov    0x30(%rax),%rax
+  801d26:	48 85 c0             	test   %rax,%rax
+  801d29:	74 47                	je     801d72 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  801d2b:	44 89 e6             	mov    %r12d,%esi
+  801d2e:	4c 89 ef             	mov    %r13,%rdi
+  801d31:	ff d0                	call   *%rax
+}
+  801d33:	48 83 c4 18          	add    $0x18,%rsp
+  801d37:	5b                   	pop    %rbx
+  801d38:	41 5c                	pop    %r12
+  801d3a:	41 5d                	pop    %r13
+  801d3c:	5d                   	pop    %rbp
+  801d3d:	c3                   	ret
+                thisenv->env_id, fdnum);
+  801d3e:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  801d45:	00 00 00 
+  801d48:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801d4e:	89 da                	mov    %ebx,%edx
+  801d50:	48 bf e0 3e 80 00 00 	movabs $0x803ee0,%rdi
+  801d57:	00 00 00 
+  801d5a:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d5f:	48 b9 08 04 80 00 00 	movabs $0x800408,%rcx
+  801d66:	00 00 00 
+  801d69:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801d6b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801d70:	eb c1                	jmp    801d33 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801d72:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801d77:	eb ba                	jmp    801d33 <ftruncate+0x5e>
+
+0000000000801d79 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  801d79:	55                   	push   %rbp
+  801d7a:	48 89 e5             	mov    %rsp,%rbp
+  801d7d:	41 54                	push   %r12
+  801d7f:	53                   	push   %rbx
+  801d80:	48 83 ec 10          	sub    $0x10,%rsp
+  801d84:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801d87:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801d8b:	48 b8 d9 17 80 00 00 	movabs $0x8017d9,%rax
+  801d92:	00 00 00 
+  801d95:	ff d0                	call   *%rax
+  801d97:	85 c0                	test   %eax,%eax
+  801d99:	78 4e                	js     801de9 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801d9b:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801d9f:	41 8b 3c 24          	mov    (%r12),%edi
+  801da3:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801da7:	48 b8 24 18 80 00 00 	movabs $0x801824,%rax
+  801dae:	00 00 00 
+  801db1:	ff d0                	call   *%rax
+  801db3:	85 c0                	test   %eax,%eax
+  801db5:	78 32                	js     801de9 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801db7:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801dbb:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  801dc0:	74 30                	je     801df2 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  801dc2:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  801dc5:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  801dcc:	00 00 00 
+    stat->st_isdir = 0;
+  801dcf:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  801dd6:	00 00 00 
+    stat->st_dev = dev;
+  801dd9:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  801de0:	48 89 de             	mov    %rbx,%rsi
+  801de3:	4c 89 e7             	mov    %r12,%rdi
+  801de6:	ff 50 28             	call   *0x28(%rax)
+}
+  801de9:	48 83 c4 10          	add    $0x10,%rsp
+  801ded:	5b                   	pop    %rbx
+  801dee:	41 5c                	pop    %r12
+  801df0:	5d                   	pop    %rbp
+  801df1:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801df2:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801df7:	eb f0                	jmp    801de9 <fstat+0x70>
+
+0000000000801df9 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  801df9:	55                   	push   %rbp
+  801dfa:	48 89 e5             	mov    %rsp,%rbp
+  801dfd:	41 54                	push   %r12
+  801dff:	53                   	push   %rbx
+  801e00:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  801e03:	be 00 00 00 00       	mov    $0x0,%esi
+  801e08:	48 b8 dc 21 80 00 00 	movabs $0x8021dc,%rax
+  801e0f:	00 00 00 
+  801e12:	ff d0                	call   *%rax
+  801e14:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  801e16:	85 c0                	test   %eax,%eax
+  801e18:	78 25                	js     801e3f <stat+0x46>
+
+    int res = fstat(fd, stat);
+  801e1a:	4c 89 e6             	mov    %r12,%rsi
+  801e1d:	89 c7                	mov    %eax,%edi
+  801e1f:	48 b8 79 1d 80 00 00 	movabs $0x801d79,%rax
+  801e26:	00 00 00 
+  801e29:	ff d0                	call   *%rax
+  801e2b:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  801e2e:	89 df                	mov    %ebx,%edi
+  801e30:	48 b8 3e 19 80 00 00 	movabs $0x80193e,%rax
+  801e37:	00 00 00 
+  801e3a:	ff d0                	call   *%rax
+
+    return res;
+  801e3c:	44 89 e3             	mov    %r12d,%ebx
+}
+  801e3f:	89 d8                	mov    %ebx,%eax
+  801e41:	5b                   	pop    %rbx
+  801e42:	41 5c                	pop    %r12
+  801e44:	5d                   	pop    %rbp
+  801e45:	c3                   	ret
+
+0000000000801e46 <fsipc>:
+ * response may be written back to fsipcbuf.
+ * type: request code, passed as the simple integer IPC value.
+ * dstva: virtual address at which to receive reply page, 0 if none.
+ * Returns result from the file server. */
+static int
+fsipc(unsigned type, void *dstva) {
+  801e46:	55                   	push   %rbp
+  801e47:	48 89 e5             	mov    %rsp,%rbp
+  801e4a:	41 54                	push   %r12
+  801e4c:	53                   	push   %rbx
+  801e4d:	48 83 ec 10          	sub    $0x10,%rsp
+  801e51:	41 89 fc             	mov    %edi,%r12d
+  801e54:	48 89 f3             	mov    %rsi,%rbx
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  801e57:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  801e5e:	00 00 00 
+  801e61:	83 38 00             	cmpl   $0x0,(%rax)
+  801e64:	74 5e                	je     801ec4 <fsipc+0x7e>
+    if (debug) {
+        cprintf("[%08x] fsipc %d %08x\n",
+                thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+    }
+
+    ipc_send(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW);
+  801e66:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  801e6c:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  801e71:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  801e78:	00 00 00 
+  801e7b:	44 89 e6             	mov    %r12d,%esi
+  801e7e:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  801e85:	00 00 00 
+  801e88:	8b 38                	mov    (%rax),%edi
+  801e8a:	48 b8 53 37 80 00 00 	movabs $0x803753,%rax
+  801e91:	00 00 00 
+  801e94:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  801e96:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  801e9d:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  801e9e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801ea3:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  801ea7:	48 89 de             	mov    %rbx,%rsi
+  801eaa:	bf 00 00 00 00       	mov    $0x0,%edi
+  801eaf:	48 b8 7e 36 80 00 00 	movabs $0x80367e,%rax
+  801eb6:	00 00 00 
+  801eb9:	ff d0                	call   *%rax
+}
+  801ebb:	48 83 c4 10          	add    $0x10,%rsp
+  801ebf:	5b                   	pop    %rbx
+  801ec0:	41 5c                	pop    %r12
+  801ec2:	5d                   	pop    %rbp
+  801ec3:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  801ec4:	bf 03 00 00 00       	mov    $0x3,%edi
+  801ec9:	48 b8 f6 37 80 00 00 	movabs $0x8037f6,%rax
+  801ed0:	00 00 00 
+  801ed3:	ff d0                	call   *%rax
+  801ed5:	a3 00 80 80 00 00 00 	movabs %eax,0x808000
+  801edc:	00 00 
+  801ede:	eb 86                	jmp    801e66 <fsipc+0x20>
+
+0000000000801ee0 <devfile_trunc>:
+    return 0;
+}
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  801ee0:	55                   	push   %rbp
+  801ee1:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801ee4:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  801eeb:	00 00 00 
+  801eee:	8b 57 0c             	mov    0xc(%rdi),%edx
+  801ef1:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  801ef3:	89 70 04             	mov    %esi,0x4(%rax)
+
+    return fsipc(FSREQ_SET_SIZE, NULL);
+  801ef6:	be 00 00 00 00       	mov    $0x0,%esi
+  801efb:	bf 02 00 00 00       	mov    $0x2,%edi
+  801f00:	48 b8 46 1e 80 00 00 	movabs $0x801e46,%rax
+  801f07:	00 00 00 
+  801f0a:	ff d0                	call   *%rax
+}
+  801f0c:	5d                   	pop    %rbp
+  801f0d:	c3                   	ret
+
+0000000000801f0e <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  801f0e:	55                   	push   %rbp
+  801f0f:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801f12:	8b 47 0c             	mov    0xc(%rdi),%eax
+  801f15:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  801f1c:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  801f1e:	be 00 00 00 00       	mov    $0x0,%esi
+  801f23:	bf 06 00 00 00       	mov    $0x6,%edi
+  801f28:	48 b8 46 1e 80 00 00 	movabs $0x801e46,%rax
+  801f2f:	00 00 00 
+  801f32:	ff d0                	call   *%rax
+}
+  801f34:	5d                   	pop    %rbp
+  801f35:	c3                   	ret
+
+0000000000801f36 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  801f36:	55                   	push   %rbp
+  801f37:	48 89 e5             	mov    %rsp,%rbp
+  801f3a:	41 54                	push   %r12
+  801f3c:	53                   	push   %rbx
+  801f3d:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801f40:	8b 47 0c             	mov    0xc(%rdi),%eax
+  801f43:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  801f4a:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  801f4c:	be 00 00 00 00       	mov    $0x0,%esi
+  801f51:	bf 05 00 00 00       	mov    $0x5,%edi
+  801f56:	48 b8 46 1e 80 00 00 	movabs $0x801e46,%rax
+  801f5d:	00 00 00 
+  801f60:	ff d0                	call   *%rax
+    if (res < 0) {
+  801f62:	85 c0                	test   %eax,%eax
+  801f64:	78 3d                	js     801fa3 <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801f66:	49 bc 00 70 80 00 00 	movabs $0x807000,%r12
+  801f6d:	00 00 00 
+  801f70:	4c 89 e6             	mov    %r12,%rsi
+  801f73:	48 89 df             	mov    %rbx,%rdi
+  801f76:	48 b8 2d 0d 80 00 00 	movabs $0x800d2d,%rax
+  801f7d:	00 00 00 
+  801f80:	ff d0                	call   *%rax
+    st->st_size  = fsipcbuf.statRet.ret_size;
+  801f82:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  801f89:	00 
+  801f8a:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801f90:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  801f97:	00 
+  801f98:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  801f9e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801fa3:	5b                   	pop    %rbx
+  801fa4:	41 5c                	pop    %r12
+  801fa6:	5d                   	pop    %rbp
+  801fa7:	c3                   	ret
+
+0000000000801fa8 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  801fa8:	55                   	push   %rbp
+  801fa9:	48 89 e5             	mov    %rsp,%rbp
+  801fac:	41 57                	push   %r15
+  801fae:	41 56                	push   %r14
+  801fb0:	41 55                	push   %r13
+  801fb2:	41 54                	push   %r12
+  801fb4:	53                   	push   %rbx
+  801fb5:	48 83 ec 18          	sub    $0x18,%rsp
+  801fb9:	49 89 fe             	mov    %rdi,%r14
+  801fbc:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+  801fc0:	48 89 d3             	mov    %rdx,%rbx
+    while (n > sizeof(fsipcbuf.write.req_buf))
+  801fc3:	48 81 fa f0 0f 00 00 	cmp    $0xff0,%rdx
+  801fca:	0f 86 e4 00 00 00    	jbe    8020b4 <devfile_write+0x10c>
+  801fd0:	49 89 f4             	mov    %rsi,%r12
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801fd3:	49 bd 00 70 80 00 00 	movabs $0x807000,%r13
+  801fda:	00 00 00 
+        memcpy(fsipcbuf.write.req_buf, buf, sizeof(fsipcbuf.write.req_buf));
+  801fdd:	49 bf 8e 0f 80 00 00 	movabs $0x800f8e,%r15
+  801fe4:	00 00 00 
+  801fe7:	eb 03                	jmp    801fec <devfile_write+0x44>
+        buf += sizeof(fsipcbuf.write.req_buf);
+  801fe9:	49 89 f4             	mov    %rsi,%r12
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801fec:	41 8b 46 0c          	mov    0xc(%r14),%eax
+  801ff0:	41 89 45 00          	mov    %eax,0x0(%r13)
+        fsipcbuf.write.req_n      = sizeof(fsipcbuf.write.req_buf);
+  801ff4:	49 c7 45 08 f0 0f 00 	movq   $0xff0,0x8(%r13)
+  801ffb:	00 
+        memcpy(fsipcbuf.write.req_buf, buf, sizeof(fsipcbuf.write.req_buf));
+  801ffc:	ba f0 0f 00 00       	mov    $0xff0,%edx
+  802001:	4c 89 e6             	mov    %r12,%rsi
+  802004:	48 bf 10 70 80 00 00 	movabs $0x807010,%rdi
+  80200b:	00 00 00 
+  80200e:	41 ff d7             	call   *%r15
+        ssize_t res = fsipc(FSREQ_WRITE, NULL);
+  802011:	be 00 00 00 00       	mov    $0x0,%esi
+  802016:	bf 04 00 00 00       	mov    $0x4,%edi
+  80201b:	48 b8 46 1e 80 00 00 	movabs $0x801e46,%rax
+  802022:	00 00 00 
+  802025:	ff d0                	call   *%rax
+  802027:	48 63 d0             	movslq %eax,%rdx
+        if (res < 0 || res < sizeof(fsipcbuf.write.req_buf))
+  80202a:	3d ef 0f 00 00       	cmp    $0xfef,%eax
+  80202f:	7e 71                	jle    8020a2 <devfile_write+0xfa>
+        buf += sizeof(fsipcbuf.write.req_buf);
+  802031:	49 8d b4 24 f0 0f 00 	lea    0xff0(%r12),%rsi
+  802038:	00 
+        n -= sizeof(fsipcbuf.write.req_buf);
+  802039:	48 81 eb f0 0f 00 00 	sub    $0xff0,%rbx
+    while (n > sizeof(fsipcbuf.write.req_buf))
+  802040:	48 81 fb f0 0f 00 00 	cmp    $0xff0,%rbx
+  802047:	77 a0                	ja     801fe9 <devfile_write+0x41>
+        written += sizeof(fsipcbuf.write.req_buf);
+  802049:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80204d:	49 29 c4             	sub    %rax,%r12
+  802050:	4d 8d a4 24 f0 0f 00 	lea    0xff0(%r12),%r12
+  802057:	00 
+    fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802058:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  80205f:	00 00 00 
+  802062:	41 8b 56 0c          	mov    0xc(%r14),%edx
+  802066:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.write.req_n      = n;
+  802068:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    memcpy(fsipcbuf.write.req_buf, buf, n);
+  80206c:	48 89 da             	mov    %rbx,%rdx
+  80206f:	48 8d 78 10          	lea    0x10(%rax),%rdi
+  802073:	48 b8 8e 0f 80 00 00 	movabs $0x800f8e,%rax
+  80207a:	00 00 00 
+  80207d:	ff d0                	call   *%rax
+    ssize_t res = fsipc(FSREQ_WRITE, NULL);
+  80207f:	be 00 00 00 00       	mov    $0x0,%esi
+  802084:	bf 04 00 00 00       	mov    $0x4,%edi
+  802089:	48 b8 46 1e 80 00 00 	movabs $0x801e46,%rax
+  802090:	00 00 00 
+  802093:	ff d0                	call   *%rax
+  802095:	48 63 d0             	movslq %eax,%rdx
+    written += res;
+  802098:	49 01 d4             	add    %rdx,%r12
+  80209b:	48 85 d2             	test   %rdx,%rdx
+  80209e:	49 0f 49 d4          	cmovns %r12,%rdx
+}
+  8020a2:	48 89 d0             	mov    %rdx,%rax
+  8020a5:	48 83 c4 18          	add    $0x18,%rsp
+  8020a9:	5b                   	pop    %rbx
+  8020aa:	41 5c                	pop    %r12
+  8020ac:	41 5d                	pop    %r13
+  8020ae:	41 5e                	pop    %r14
+  8020b0:	41 5f                	pop    %r15
+  8020b2:	5d                   	pop    %rbp
+  8020b3:	c3                   	ret
+    while (n > sizeof(fsipcbuf.write.req_buf))
+  8020b4:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+    ssize_t written = 0;
+  8020b8:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8020be:	eb 98                	jmp    802058 <devfile_write+0xb0>
+
+00000000008020c0 <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  8020c0:	55                   	push   %rbp
+  8020c1:	48 89 e5             	mov    %rsp,%rbp
+  8020c4:	41 57                	push   %r15
+  8020c6:	41 56                	push   %r14
+  8020c8:	41 55                	push   %r13
+  8020ca:	41 54                	push   %r12
+  8020cc:	53                   	push   %rbx
+  8020cd:	48 83 ec 18          	sub    $0x18,%rsp
+  8020d1:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  8020d5:	49 89 f6             	mov    %rsi,%r14
+  8020d8:	49 89 d4             	mov    %rdx,%r12
+    while (n > sizeof(fsipcbuf.readRet.ret_buf))
+  8020db:	48 81 fa 00 10 00 00 	cmp    $0x1000,%rdx
+  8020e2:	0f 86 ea 00 00 00    	jbe    8021d2 <devfile_read+0x112>
+    ssize_t readsz = 0;
+  8020e8:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  8020ef:	00 
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8020f0:	49 bf 00 70 80 00 00 	movabs $0x807000,%r15
+  8020f7:	00 00 00 
+  8020fa:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8020fe:	8b 40 0c             	mov    0xc(%rax),%eax
+  802101:	41 89 07             	mov    %eax,(%r15)
+        fsipcbuf.read.req_n = sizeof(fsipcbuf.readRet.ret_buf);
+  802104:	49 c7 47 08 00 10 00 	movq   $0x1000,0x8(%r15)
+  80210b:	00 
+        ssize_t res = fsipc(FSREQ_READ, NULL);
+  80210c:	be 00 00 00 00       	mov    $0x0,%esi
+  802111:	bf 03 00 00 00       	mov    $0x3,%edi
+  802116:	48 b8 46 1e 80 00 00 	movabs $0x801e46,%rax
+  80211d:	00 00 00 
+  802120:	ff d0                	call   *%rax
+  802122:	4c 63 e8             	movslq %eax,%r13
+        if (res < 0)
+  802125:	4d 85 ed             	test   %r13,%r13
+  802128:	0f 88 92 00 00 00    	js     8021c0 <devfile_read+0x100>
+        memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  80212e:	4c 89 ea             	mov    %r13,%rdx
+  802131:	4c 89 fe             	mov    %r15,%rsi
+  802134:	4c 89 f7             	mov    %r14,%rdi
+  802137:	48 b8 8e 0f 80 00 00 	movabs $0x800f8e,%rax
+  80213e:	00 00 00 
+  802141:	ff d0                	call   *%rax
+        if (res < sizeof(fsipcbuf.readRet.ret_buf))
+  802143:	49 81 fd ff 0f 00 00 	cmp    $0xfff,%r13
+  80214a:	76 6d                	jbe    8021b9 <devfile_read+0xf9>
+        readsz += res;
+  80214c:	4c 01 6d c0          	add    %r13,-0x40(%rbp)
+        buf += res;
+  802150:	4d 01 ee             	add    %r13,%r14
+        n -= res;
+  802153:	4d 29 ec             	sub    %r13,%r12
+    while (n > sizeof(fsipcbuf.readRet.ret_buf))
+  802156:	49 81 fc 00 10 00 00 	cmp    $0x1000,%r12
+  80215d:	77 9b                	ja     8020fa <devfile_read+0x3a>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  80215f:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  802166:	00 00 00 
+  802169:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  80216d:	8b 51 0c             	mov    0xc(%rcx),%edx
+  802170:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.read.req_n = n;
+  802172:	4c 89 60 08          	mov    %r12,0x8(%rax)
+    ssize_t res = fsipc(FSREQ_READ, NULL);
+  802176:	be 00 00 00 00       	mov    $0x0,%esi
+  80217b:	bf 03 00 00 00       	mov    $0x3,%edi
+  802180:	48 b8 46 1e 80 00 00 	movabs $0x801e46,%rax
+  802187:	00 00 00 
+  80218a:	ff d0                	call   *%rax
+  80218c:	4c 63 e8             	movslq %eax,%r13
+    if (res < 0)
+  80218f:	4d 85 ed             	test   %r13,%r13
+  802192:	78 2c                	js     8021c0 <devfile_read+0x100>
+    memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  802194:	4c 89 ea             	mov    %r13,%rdx
+  802197:	48 be 00 70 80 00 00 	movabs $0x807000,%rsi
+  80219e:	00 00 00 
+  8021a1:	4c 89 f7             	mov    %r14,%rdi
+  8021a4:	48 b8 8e 0f 80 00 00 	movabs $0x800f8e,%rax
+  8021ab:	00 00 00 
+  8021ae:	ff d0                	call   *%rax
+    readsz += res;
+  8021b0:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8021b4:	49 01 c5             	add    %rax,%r13
+    return readsz;
+  8021b7:	eb 07                	jmp    8021c0 <devfile_read+0x100>
+            return readsz + res;
+  8021b9:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8021bd:	49 01 c5             	add    %rax,%r13
+}
+  8021c0:	4c 89 e8             	mov    %r13,%rax
+  8021c3:	48 83 c4 18          	add    $0x18,%rsp
+  8021c7:	5b                   	pop    %rbx
+  8021c8:	41 5c                	pop    %r12
+  8021ca:	41 5d                	pop    %r13
+  8021cc:	41 5e                	pop    %r14
+  8021ce:	41 5f                	pop    %r15
+  8021d0:	5d                   	pop    %rbp
+  8021d1:	c3                   	ret
+    ssize_t readsz = 0;
+  8021d2:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  8021d9:	00 
+  8021da:	eb 83                	jmp    80215f <devfile_read+0x9f>
+
+00000000008021dc <open>:
+open(const char *path, int mode) {
+  8021dc:	55                   	push   %rbp
+  8021dd:	48 89 e5             	mov    %rsp,%rbp
+  8021e0:	41 55                	push   %r13
+  8021e2:	41 54                	push   %r12
+  8021e4:	53                   	push   %rbx
+  8021e5:	48 83 ec 18          	sub    $0x18,%rsp
+  8021e9:	49 89 fc             	mov    %rdi,%r12
+  8021ec:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  8021ef:	48 b8 ef 0c 80 00 00 	movabs $0x800cef,%rax
+  8021f6:	00 00 00 
+  8021f9:	ff d0                	call   *%rax
+  8021fb:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802201:	0f 87 8a 00 00 00    	ja     802291 <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802207:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  80220b:	48 b8 bf 17 80 00 00 	movabs $0x8017bf,%rax
+  802212:	00 00 00 
+  802215:	ff d0                	call   *%rax
+  802217:	89 c3                	mov    %eax,%ebx
+  802219:	85 c0                	test   %eax,%eax
+  80221b:	78 50                	js     80226d <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  80221d:	4c 89 e6             	mov    %r12,%rsi
+  802220:	48 bb 00 70 80 00 00 	movabs $0x807000,%rbx
+  802227:	00 00 00 
+  80222a:	48 89 df             	mov    %rbx,%rdi
+  80222d:	48 b8 2d 0d 80 00 00 	movabs $0x800d2d,%rax
+  802234:	00 00 00 
+  802237:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  802239:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  802240:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802244:	bf 01 00 00 00       	mov    $0x1,%edi
+  802249:	48 b8 46 1e 80 00 00 	movabs $0x801e46,%rax
+  802250:	00 00 00 
+  802253:	ff d0                	call   *%rax
+  802255:	89 c3                	mov    %eax,%ebx
+  802257:	85 c0                	test   %eax,%eax
+  802259:	78 1f                	js     80227a <open+0x9e>
+    return fd2num(fd);
+  80225b:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80225f:	48 b8 18 17 80 00 00 	movabs $0x801718,%rax
+  802266:	00 00 00 
+  802269:	ff d0                	call   *%rax
+  80226b:	89 c3                	mov    %eax,%ebx
+}
+  80226d:	89 d8                	mov    %ebx,%eax
+  80226f:	48 83 c4 18          	add    $0x18,%rsp
+  802273:	5b                   	pop    %rbx
+  802274:	41 5c                	pop    %r12
+  802276:	41 5d                	pop    %r13
+  802278:	5d                   	pop    %rbp
+  802279:	c3                   	ret
+        fd_close(fd, 0);
+  80227a:	be 00 00 00 00       	mov    $0x0,%esi
+  80227f:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802283:	48 b8 94 18 80 00 00 	movabs $0x801894,%rax
+  80228a:	00 00 00 
+  80228d:	ff d0                	call   *%rax
+        return res;
+  80228f:	eb dc                	jmp    80226d <open+0x91>
+        return -E_BAD_PATH;
+  802291:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  802296:	eb d5                	jmp    80226d <open+0x91>
+
+0000000000802298 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  802298:	55                   	push   %rbp
+  802299:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc(FSREQ_SYNC, NULL);
+  80229c:	be 00 00 00 00       	mov    $0x0,%esi
+  8022a1:	bf 08 00 00 00       	mov    $0x8,%edi
+  8022a6:	48 b8 46 1e 80 00 00 	movabs $0x801e46,%rax
+  8022ad:	00 00 00 
+  8022b0:	ff d0                	call   *%rax
+}
+  8022b2:	5d                   	pop    %rbp
+  8022b3:	c3                   	ret
+
+00000000008022b4 <region_flush>:
+ * sys_region_batch() call right before memory at UTEMP is reused */
+static struct RegionOp region_queue[REGION_BATCH_MAX];
+static size_t region_queued;
+
+static int
+region_flush(void) {
+  8022b4:	55                   	push   %rbp
+  8022b5:	48 89 e5             	mov    %rsp,%rbp
+  8022b8:	41 56                	push   %r14
+  8022ba:	41 55                	push   %r13
+  8022bc:	41 54                	push   %r12
+  8022be:	53                   	push   %rbx
+    int res = region_queued ? sys_region_batch(region_queue, region_queued) : 0;
+  8022bf:	48 b8 20 80 80 00 00 	movabs $0x808020,%rax
+  8022c6:	00 00 00 
+  8022c9:	48 8b 30             	mov    (%rax),%rsi
+  8022cc:	41 be 00 00 00 00    	mov    $0x0,%r14d
+  8022d2:	48 85 f6             	test   %rsi,%rsi
+  8022d5:	74 6d                	je     802344 <region_flush+0x90>
+  8022d7:	48 bf 40 80 80 00 00 	movabs $0x808040,%rdi
+  8022de:	00 00 00 
+  8022e1:	48 b8 10 14 80 00 00 	movabs $0x801410,%rax
+  8022e8:	00 00 00 
+  8022eb:	ff d0                	call   *%rax
+  8022ed:	41 89 c6             	mov    %eax,%r14d
+
+    /* Operations following the failed one are not performed,
+     * but memory at UTEMP still has to be unmapped from ours */
+    for (size_t i = 0; res < 0 && i < region_queued; i++) {
+  8022f0:	85 c0                	test   %eax,%eax
+  8022f2:	79 50                	jns    802344 <region_flush+0x90>
+  8022f4:	48 bb 40 80 80 00 00 	movabs $0x808040,%rbx
+  8022fb:	00 00 00 
+  8022fe:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802304:	49 bd 20 80 80 00 00 	movabs $0x808020,%r13
+  80230b:	00 00 00 
+  80230e:	eb 08                	jmp    802318 <region_flush+0x64>
+  802310:	49 83 c4 01          	add    $0x1,%r12
+  802314:	48 83 c3 28          	add    $0x28,%rbx
+  802318:	4d 3b 65 00          	cmp    0x0(%r13),%r12
+  80231c:	73 26                	jae    802344 <region_flush+0x90>
+        struct RegionOp *op = &region_queue[i];
+        if (op->type == REGION_UNMAP && !op->dstenv)
+  80231e:	83 3b 02             	cmpl   $0x2,(%rbx)
+  802321:	75 ed                	jne    802310 <region_flush+0x5c>
+  802323:	83 7b 0c 00          	cmpl   $0x0,0xc(%rbx)
+  802327:	75 e7                	jne    802310 <region_flush+0x5c>
+            sys_unmap_region(0, (void *)op->dstva, op->size);
+  802329:	48 8b 53 20          	mov    0x20(%rbx),%rdx
+  80232d:	48 8b 73 18          	mov    0x18(%rbx),%rsi
+  802331:	bf 00 00 00 00       	mov    $0x0,%edi
+  802336:	48 b8 a9 13 80 00 00 	movabs $0x8013a9,%rax
+  80233d:	00 00 00 
+  802340:	ff d0                	call   *%rax
+  802342:	eb cc                	jmp    802310 <region_flush+0x5c>
+    }
+    region_queued = 0;
+  802344:	48 b8 20 80 80 00 00 	movabs $0x808020,%rax
+  80234b:	00 00 00 
+  80234e:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+    return res;
+}
+  802355:	44 89 f0             	mov    %r14d,%eax
+  802358:	5b                   	pop    %rbx
+  802359:	41 5c                	pop    %r12
+  80235b:	41 5d                	pop    %r13
+  80235d:	41 5e                	pop    %r14
+  80235f:	5d                   	pop    %rbp
+  802360:	c3                   	ret
+
+0000000000802361 <region_queue_op>:
+
+static int
+region_queue_op(int type, envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  802361:	55                   	push   %rbp
+  802362:	48 89 e5             	mov    %rsp,%rbp
+  802365:	41 57                	push   %r15
+  802367:	41 56                	push   %r14
+  802369:	41 55                	push   %r13
+  80236b:	41 54                	push   %r12
+  80236d:	53                   	push   %rbx
+  80236e:	48 83 ec 18          	sub    $0x18,%rsp
+  802372:	41 89 ff             	mov    %edi,%r15d
+  802375:	41 89 f6             	mov    %esi,%r14d
+  802378:	49 89 d4             	mov    %rdx,%r12
+  80237b:	41 89 cd             	mov    %ecx,%r13d
+  80237e:	4c 89 c3             	mov    %r8,%rbx
+  802381:	4c 89 4d c8          	mov    %r9,-0x38(%rbp)
+    int res = region_queued == REGION_BATCH_MAX ? region_flush() : 0;
+  802385:	bf 00 00 00 00       	mov    $0x0,%edi
+  80238a:	48 b8 20 80 80 00 00 	movabs $0x808020,%rax
+  802391:	00 00 00 
+  802394:	48 83 38 10          	cmpq   $0x10,(%rax)
+  802398:	74 66                	je     802400 <region_queue_op+0x9f>
+    region_queue[region_queued++] = (struct RegionOp){
+  80239a:	48 b8 20 80 80 00 00 	movabs $0x808020,%rax
+  8023a1:	00 00 00 
+  8023a4:	48 8b 08             	mov    (%rax),%rcx
+  8023a7:	48 8d 51 01          	lea    0x1(%rcx),%rdx
+  8023ab:	48 89 10             	mov    %rdx,(%rax)
+  8023ae:	48 be 40 80 80 00 00 	movabs $0x808040,%rsi
+  8023b5:	00 00 00 
+  8023b8:	48 8d 14 8d 00 00 00 	lea    0x0(,%rcx,4),%rdx
+  8023bf:	00 
+  8023c0:	48 8d 04 0a          	lea    (%rdx,%rcx,1),%rax
+  8023c4:	48 8d 04 c6          	lea    (%rsi,%rax,8),%rax
+  8023c8:	44 89 38             	mov    %r15d,(%rax)
+  8023cb:	44 8b 45 10          	mov    0x10(%rbp),%r8d
+  8023cf:	44 89 40 04          	mov    %r8d,0x4(%rax)
+  8023d3:	44 89 70 08          	mov    %r14d,0x8(%rax)
+  8023d7:	44 89 68 0c          	mov    %r13d,0xc(%rax)
+  8023db:	4c 89 60 10          	mov    %r12,0x10(%rax)
+  8023df:	48 89 58 18          	mov    %rbx,0x18(%rax)
+  8023e3:	48 01 ca             	add    %rcx,%rdx
+  8023e6:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8023ea:	48 89 44 d6 20       	mov    %rax,0x20(%rsi,%rdx,8)
+            .srcva = (uintptr_t)srcva,
+            .dstva = (uintptr_t)dstva,
+            .size = size,
+    };
+    return res;
+}
+  8023ef:	89 f8                	mov    %edi,%eax
+  8023f1:	48 83 c4 18          	add    $0x18,%rsp
+  8023f5:	5b                   	pop    %rbx
+  8023f6:	41 5c                	pop    %r12
+  8023f8:	41 5d                	pop    %r13
+  8023fa:	41 5e                	pop    %r14
+  8023fc:	41 5f                	pop    %r15
+  8023fe:	5d                   	pop    %rbp
+  8023ff:	c3                   	ret
+    int res = region_queued == REGION_BATCH_MAX ? region_flush() : 0;
+  802400:	48 b8 b4 22 80 00 00 	movabs $0x8022b4,%rax
+  802407:	00 00 00 
+  80240a:	ff d0                	call   *%rax
+  80240c:	89 c7                	mov    %eax,%edi
+  80240e:	eb 8a                	jmp    80239a <region_queue_op+0x39>
+
+0000000000802410 <copy_shared_region>:
+    int unmap = region_queue_op(REGION_UNMAP, 0, NULL, 0, UTEMP, USER_STACK_SIZE, 0);
+    return res < 0 ? res : unmap;
+}
+
+static int
+copy_shared_region(void *start, void *end, void *arg) {
+  802410:	55                   	push   %rbp
+  802411:	48 89 e5             	mov    %rsp,%rbp
+  802414:	41 55                	push   %r13
+  802416:	41 54                	push   %r12
+  802418:	53                   	push   %rbx
+  802419:	48 83 ec 08          	sub    $0x8,%rsp
+  80241d:	48 89 fb             	mov    %rdi,%rbx
+  802420:	49 89 f4             	mov    %rsi,%r12
+    envid_t child = *(envid_t *)arg;
+  802423:	44 8b 2a             	mov    (%rdx),%r13d
+    return region_queue_op(REGION_MAP, 0, start, child, start, end - start, get_prot(start));
+  802426:	48 b8 5f 32 80 00 00 	movabs $0x80325f,%rax
+  80242d:	00 00 00 
+  802430:	ff d0                	call   *%rax
+  802432:	48 83 ec 08          	sub    $0x8,%rsp
+  802436:	50                   	push   %rax
+  802437:	4d 89 e1             	mov    %r12,%r9
+  80243a:	49 29 d9             	sub    %rbx,%r9
+  80243d:	49 89 d8             	mov    %rbx,%r8
+  802440:	44 89 e9             	mov    %r13d,%ecx
+  802443:	48 89 da             	mov    %rbx,%rdx
+  802446:	be 00 00 00 00       	mov    $0x0,%esi
+  80244b:	bf 01 00 00 00       	mov    $0x1,%edi
+  802450:	48 b8 61 23 80 00 00 	movabs $0x802361,%rax
+  802457:	00 00 00 
+  80245a:	ff d0                	call   *%rax
+}
+  80245c:	48 8d 65 e8          	lea    -0x18(%rbp),%rsp
+  802460:	5b                   	pop    %rbx
+  802461:	41 5c                	pop    %r12
+  802463:	41 5d                	pop    %r13
+  802465:	5d                   	pop    %rbp
+  802466:	c3                   	ret
+
+0000000000802467 <spawn>:
+spawn(const char *prog, const char **argv) {
+  802467:	55                   	push   %rbp
+  802468:	48 89 e5             	mov    %rsp,%rbp
+  80246b:	41 57                	push   %r15
+  80246d:	41 56                	push   %r14
+  80246f:	41 55                	push   %r13
+  802471:	41 54                	push   %r12
+  802473:	53                   	push   %rbx
+  802474:	48 81 ec 08 03 00 00 	sub    $0x308,%rsp
+  80247b:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(prog, O_RDONLY);
+  80247e:	be 00 00 00 00       	mov    $0x0,%esi
+  802483:	48 b8 dc 21 80 00 00 	movabs $0x8021dc,%rax
+  80248a:	00 00 00 
+  80248d:	ff d0                	call   *%rax
+  80248f:	89 85 fc fc ff ff    	mov    %eax,-0x304(%rbp)
+    if (fd < 0) return fd;
+  802495:	85 c0                	test   %eax,%eax
+  802497:	0f 88 08 07 00 00    	js     802ba5 <spawn+0x73e>
+  80249d:	89 c7                	mov    %eax,%edi
+    res = readn(fd, elf_buf, sizeof(elf_buf));
+  80249f:	ba 00 02 00 00       	mov    $0x200,%edx
+  8024a4:	48 8d b5 d0 fd ff ff 	lea    -0x230(%rbp),%rsi
+  8024ab:	48 b8 7a 1b 80 00 00 	movabs $0x801b7a,%rax
+  8024b2:	00 00 00 
+  8024b5:	ff d0                	call   *%rax
+  8024b7:	89 c6                	mov    %eax,%esi
+    if (res != sizeof(elf_buf)) {
+  8024b9:	3d 00 02 00 00       	cmp    $0x200,%eax
+  8024be:	0f 85 d2 02 00 00    	jne    802796 <spawn+0x32f>
+        elf->e_elf[1] != 1 /* little endian */ ||
+  8024c4:	48 b8 ff ff ff ff ff 	movabs $0xffffffffffffff,%rax
+  8024cb:	ff ff 00 
+  8024ce:	48 23 85 d0 fd ff ff 	and    -0x230(%rbp),%rax
+    if (elf->e_magic != ELF_MAGIC ||
+  8024d5:	48 ba 7f 45 4c 46 02 	movabs $0x10102464c457f,%rdx
+  8024dc:	01 01 00 
+  8024df:	48 39 d0             	cmp    %rdx,%rax
+  8024e2:	0f 85 ea 02 00 00    	jne    8027d2 <spawn+0x36b>
+        elf->e_type != ET_EXEC /* executable */ ||
+  8024e8:	81 bd e0 fd ff ff 02 	cmpl   $0x3e0002,-0x220(%rbp)
+  8024ef:	00 3e 00 
+  8024f2:	0f 85 da 02 00 00    	jne    8027d2 <spawn+0x36b>
+
+/* This must be inlined. Exercise for reader: why? */
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+    envid_t ret;
+    asm volatile("int %2"
+  8024f8:	b8 08 00 00 00       	mov    $0x8,%eax
+  8024fd:	cd 30                	int    $0x30
+  8024ff:	89 85 f0 fc ff ff    	mov    %eax,-0x310(%rbp)
+  802505:	89 c3                	mov    %eax,%ebx
+    if ((int)(res = sys_exofork()) < 0) goto error2;
+  802507:	85 c0                	test   %eax,%eax
+  802509:	0f 88 7e 06 00 00    	js     802b8d <spawn+0x726>
+    envid_t child = res;
+  80250f:	89 85 cc fd ff ff    	mov    %eax,-0x234(%rbp)
+    struct Trapframe child_tf = envs[ENVX(child)].env_tf;
+  802515:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80251a:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+  802521:	48 be 00 00 c0 1f 80 	movabs $0x801fc00000,%rsi
+  802528:	00 00 00 
+  80252b:	48 01 c6             	add    %rax,%rsi
+  80252e:	48 8b 06             	mov    (%rsi),%rax
+  802531:	48 89 85 0c fd ff ff 	mov    %rax,-0x2f4(%rbp)
+  802538:	48 8b 86 b8 00 00 00 	mov    0xb8(%rsi),%rax
+  80253f:	48 89 85 c4 fd ff ff 	mov    %rax,-0x23c(%rbp)
+  802546:	48 8d bd 10 fd ff ff 	lea    -0x2f0(%rbp),%rdi
+  80254d:	48 c7 c1 fc ff ff ff 	mov    $0xfffffffffffffffc,%rcx
+  802554:	48 29 ce             	sub    %rcx,%rsi
+  802557:	81 c1 c0 00 00 00    	add    $0xc0,%ecx
+  80255d:	c1 e9 03             	shr    $0x3,%ecx
+  802560:	89 c9                	mov    %ecx,%ecx
+  802562:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+    child_tf.tf_rip = elf->e_entry;
+  802565:	48 8b 85 e8 fd ff ff 	mov    -0x218(%rbp),%rax
+  80256c:	48 89 85 a4 fd ff ff 	mov    %rax,-0x25c(%rbp)
+    for (argc = 0; argv[argc] != 0; argc++)
+  802573:	49 8b 3c 24          	mov    (%r12),%rdi
+  802577:	48 85 ff             	test   %rdi,%rdi
+  80257a:	0f 84 99 02 00 00    	je     802819 <spawn+0x3b2>
+  802580:	41 bd 01 00 00 00    	mov    $0x1,%r13d
+    string_size = 0;
+  802586:	41 be 00 00 00 00    	mov    $0x0,%r14d
+        string_size += strlen(argv[argc]) + 1;
+  80258c:	49 bf ef 0c 80 00 00 	movabs $0x800cef,%r15
+  802593:	00 00 00 
+  802596:	41 ff d7             	call   *%r15
+  802599:	4a 8d 1c 30          	lea    (%rax,%r14,1),%rbx
+  80259d:	4c 8d 73 01          	lea    0x1(%rbx),%r14
+    for (argc = 0; argv[argc] != 0; argc++)
+  8025a1:	4c 89 e8             	mov    %r13,%rax
+  8025a4:	49 83 c5 01          	add    $0x1,%r13
+  8025a8:	4b 8b 7c ec f8       	mov    -0x8(%r12,%r13,8),%rdi
+  8025ad:	48 85 ff             	test   %rdi,%rdi
+  8025b0:	75 e4                	jne    802596 <spawn+0x12f>
+    string_store = (char *)UTEMP + USER_STACK_SIZE - string_size;
+  8025b2:	48 89 c2             	mov    %rax,%rdx
+  8025b5:	48 89 85 e8 fc ff ff 	mov    %rax,-0x318(%rbp)
+  8025bc:	48 f7 d3             	not    %rbx
+  8025bf:	48 81 c3 00 00 41 00 	add    $0x410000,%rbx
+    argv_store = (uintptr_t *)(ROUNDDOWN(string_store, sizeof(uintptr_t)) - sizeof(uintptr_t) * (argc + 1));
+  8025c6:	48 89 d9             	mov    %rbx,%rcx
+  8025c9:	48 83 e1 f8          	and    $0xfffffffffffffff8,%rcx
+  8025cd:	48 89 8d e0 fc ff ff 	mov    %rcx,-0x320(%rbp)
+  8025d4:	83 c0 01             	add    $0x1,%eax
+  8025d7:	48 98                	cltq
+  8025d9:	48 c1 e0 03          	shl    $0x3,%rax
+  8025dd:	48 29 c1             	sub    %rax,%rcx
+  8025e0:	49 89 cf             	mov    %rcx,%r15
+    if ((void *)(argv_store - 2) < (void *)UTEMP) return -E_NO_MEM;
+  8025e3:	48 8d 41 f0          	lea    -0x10(%rcx),%rax
+  8025e7:	48 3d ff ff 3f 00    	cmp    $0x3fffff,%rax
+  8025ed:	0f 86 73 05 00 00    	jbe    802b66 <spawn+0x6ff>
+    for (argc = 0; argv[argc] != 0; argc++)
+  8025f3:	41 89 d6             	mov    %edx,%r14d
+    if ((res = region_queue_op(REGION_ALLOC, 0, NULL, 0, UTEMP, USER_STACK_SIZE, PROT_RW)) < 0 ||
+  8025f6:	48 83 ec 08          	sub    $0x8,%rsp
+  8025fa:	6a 06                	push   $0x6
+  8025fc:	41 b9 00 00 01 00    	mov    $0x10000,%r9d
+  802602:	41 b8 00 00 40 00    	mov    $0x400000,%r8d
+  802608:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80260d:	ba 00 00 00 00       	mov    $0x0,%edx
+  802612:	be 00 00 00 00       	mov    $0x0,%esi
+  802617:	bf 00 00 00 00       	mov    $0x0,%edi
+  80261c:	48 b8 61 23 80 00 00 	movabs $0x802361,%rax
+  802623:	00 00 00 
+  802626:	ff d0                	call   *%rax
+  802628:	41 89 c5             	mov    %eax,%r13d
+  80262b:	48 83 c4 10          	add    $0x10,%rsp
+  80262f:	85 c0                	test   %eax,%eax
+  802631:	0f 88 35 05 00 00    	js     802b6c <spawn+0x705>
+        (res = region_flush()) < 0) return res;
+  802637:	48 b8 b4 22 80 00 00 	movabs $0x8022b4,%rax
+  80263e:	00 00 00 
+  802641:	ff d0                	call   *%rax
+  802643:	41 89 c5             	mov    %eax,%r13d
+    if ((res = region_queue_op(REGION_ALLOC, 0, NULL, 0, UTEMP, USER_STACK_SIZE, PROT_RW)) < 0 ||
+  802646:	85 c0                	test   %eax,%eax
+  802648:	0f 88 1e 05 00 00    	js     802b6c <spawn+0x705>
+    for (i = 0; i < argc; i++) {
+  80264e:	45 85 f6             	test   %r14d,%r14d
+  802651:	7e 55                	jle    8026a8 <spawn+0x241>
+  802653:	4d 89 fd             	mov    %r15,%r13
+  802656:	4d 63 f6             	movslq %r14d,%r14
+  802659:	4f 8d 34 f7          	lea    (%r15,%r14,8),%r14
+        argv_store[i] = UTEMP2USTACK(string_store);
+  80265d:	48 b8 00 70 fe ff 7f 	movabs $0x7ffffe7000,%rax
+  802664:	00 00 00 
+  802667:	48 8d 84 03 00 00 c0 	lea    -0x400000(%rbx,%rax,1),%rax
+  80266e:	ff 
+  80266f:	49 89 45 00          	mov    %rax,0x0(%r13)
+        strcpy(string_store, argv[i]);
+  802673:	49 8b 34 24          	mov    (%r12),%rsi
+  802677:	48 89 df             	mov    %rbx,%rdi
+  80267a:	48 b8 2d 0d 80 00 00 	movabs $0x800d2d,%rax
+  802681:	00 00 00 
+  802684:	ff d0                	call   *%rax
+        string_store += strlen(argv[i]) + 1;
+  802686:	49 8b 3c 24          	mov    (%r12),%rdi
+  80268a:	48 b8 ef 0c 80 00 00 	movabs $0x800cef,%rax
+  802691:	00 00 00 
+  802694:	ff d0                	call   *%rax
+  802696:	48 8d 5c 03 01       	lea    0x1(%rbx,%rax,1),%rbx
+    for (i = 0; i < argc; i++) {
+  80269b:	49 83 c5 08          	add    $0x8,%r13
+  80269f:	49 83 c4 08          	add    $0x8,%r12
+  8026a3:	4d 39 f5             	cmp    %r14,%r13
+  8026a6:	75 b5                	jne    80265d <spawn+0x1f6>
+    argv_store[argc] = 0;
+  8026a8:	48 8b 85 e0 fc ff ff 	mov    -0x320(%rbp),%rax
+  8026af:	48 c7 40 f8 00 00 00 	movq   $0x0,-0x8(%rax)
+  8026b6:	00 
+    assert(string_store == (char *)UTEMP + USER_STACK_SIZE);
+  8026b7:	48 81 fb 00 00 41 00 	cmp    $0x410000,%rbx
+  8026be:	0f 85 81 01 00 00    	jne    802845 <spawn+0x3de>
+    argv_store[-1] = UTEMP2USTACK(argv_store);
+  8026c4:	49 b8 00 70 fe ff 7f 	movabs $0x7ffffe7000,%r8
+  8026cb:	00 00 00 
+  8026ce:	4b 8d 84 07 00 00 c0 	lea    -0x400000(%r15,%r8,1),%rax
+  8026d5:	ff 
+  8026d6:	49 89 47 f8          	mov    %rax,-0x8(%r15)
+    argv_store[-2] = argc;
+  8026da:	48 8b 85 e8 fc ff ff 	mov    -0x318(%rbp),%rax
+  8026e1:	49 89 47 f0          	mov    %rax,-0x10(%r15)
+    tf->tf_rsp = UTEMP2USTACK(&argv_store[-2]);
+  8026e5:	48 b8 f0 6f fe ff 7f 	movabs $0x7ffffe6ff0,%rax
+  8026ec:	00 00 00 
+  8026ef:	49 8d 84 07 00 00 c0 	lea    -0x400000(%r15,%rax,1),%rax
+  8026f6:	ff 
+  8026f7:	48 89 85 bc fd ff ff 	mov    %rax,-0x244(%rbp)
+    res = region_queue_op(REGION_MAP, 0, UTEMP, child, (void *)(USER_STACK_TOP - USER_STACK_SIZE),
+  8026fe:	48 83 ec 08          	sub    $0x8,%rsp
+  802702:	6a 06                	push   $0x6
+  802704:	41 b9 00 00 01 00    	mov    $0x10000,%r9d
+  80270a:	8b 8d f0 fc ff ff    	mov    -0x310(%rbp),%ecx
+  802710:	ba 00 00 40 00       	mov    $0x400000,%edx
+  802715:	be 00 00 00 00       	mov    $0x0,%esi
+  80271a:	bf 01 00 00 00       	mov    $0x1,%edi
+  80271f:	48 bb 61 23 80 00 00 	movabs $0x802361,%rbx
+  802726:	00 00 00 
+  802729:	ff d3                	call   *%rbx
+  80272b:	41 89 c5             	mov    %eax,%r13d
+    int unmap = region_queue_op(REGION_UNMAP, 0, NULL, 0, UTEMP, USER_STACK_SIZE, 0);
+  80272e:	c7 04 24 00 00 00 00 	movl   $0x0,(%rsp)
+  802735:	41 b9 00 00 01 00    	mov    $0x10000,%r9d
+  80273b:	41 b8 00 00 40 00    	mov    $0x400000,%r8d
+  802741:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802746:	ba 00 00 00 00       	mov    $0x0,%edx
+  80274b:	be 00 00 00 00       	mov    $0x0,%esi
+  802750:	bf 02 00 00 00       	mov    $0x2,%edi
+  802755:	ff d3                	call   *%rbx
+  802757:	89 c3                	mov    %eax,%ebx
+    return res < 0 ? res : unmap;
+  802759:	48 83 c4 10          	add    $0x10,%rsp
+  80275d:	45 85 ed             	test   %r13d,%r13d
+  802760:	0f 88 06 04 00 00    	js     802b6c <spawn+0x705>
+    if ((res = init_stack(child, argv, &child_tf)) < 0) goto error;
+  802766:	85 c0                	test   %eax,%eax
+  802768:	0f 88 01 04 00 00    	js     802b6f <spawn+0x708>
+    struct Proghdr *ph = (struct Proghdr *)(elf_buf + elf->e_phoff);
+  80276e:	48 8b 85 f0 fd ff ff 	mov    -0x210(%rbp),%rax
+  802775:	4c 8d ac 05 d0 fd ff 	lea    -0x230(%rbp,%rax,1),%r13
+  80277c:	ff 
+    for (size_t i = 0; i < elf->e_phnum; i++, ph++) {
+  80277d:	66 83 bd 08 fe ff ff 	cmpw   $0x0,-0x1f8(%rbp)
+  802784:	00 
+  802785:	0f 84 c8 02 00 00    	je     802a53 <spawn+0x5ec>
+  80278b:	41 be 00 00 00 00    	mov    $0x0,%r14d
+  802791:	e9 63 01 00 00       	jmp    8028f9 <spawn+0x492>
+        cprintf("Wrong ELF header size or read error: %i\n", res);
+  802796:	48 bf 60 3f 80 00 00 	movabs $0x803f60,%rdi
+  80279d:	00 00 00 
+  8027a0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027a5:	48 ba 08 04 80 00 00 	movabs $0x800408,%rdx
+  8027ac:	00 00 00 
+  8027af:	ff d2                	call   *%rdx
+        close(fd);
+  8027b1:	8b bd fc fc ff ff    	mov    -0x304(%rbp),%edi
+  8027b7:	48 b8 3e 19 80 00 00 	movabs $0x80193e,%rax
+  8027be:	00 00 00 
+  8027c1:	ff d0                	call   *%rax
+        return -E_NOT_EXEC;
+  8027c3:	c7 85 fc fc ff ff ee 	movl   $0xffffffee,-0x304(%rbp)
+  8027ca:	ff ff ff 
+  8027cd:	e9 d3 03 00 00       	jmp    802ba5 <spawn+0x73e>
+        cprintf("Elf magic %08x want %08x\n", elf->e_magic, ELF_MAGIC);
+  8027d2:	ba 7f 45 4c 46       	mov    $0x464c457f,%edx
+  8027d7:	8b b5 d0 fd ff ff    	mov    -0x230(%rbp),%esi
+  8027dd:	48 bf c0 3f 80 00 00 	movabs $0x803fc0,%rdi
+  8027e4:	00 00 00 
+  8027e7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027ec:	48 b9 08 04 80 00 00 	movabs $0x800408,%rcx
+  8027f3:	00 00 00 
+  8027f6:	ff d1                	call   *%rcx
+        close(fd);
+  8027f8:	8b bd fc fc ff ff    	mov    -0x304(%rbp),%edi
+  8027fe:	48 b8 3e 19 80 00 00 	movabs $0x80193e,%rax
+  802805:	00 00 00 
+  802808:	ff d0                	call   *%rax
+        return -E_NOT_EXEC;
+  80280a:	c7 85 fc fc ff ff ee 	movl   $0xffffffee,-0x304(%rbp)
+  802811:	ff ff ff 
+  802814:	e9 8c 03 00 00       	jmp    802ba5 <spawn+0x73e>
+    for (argc = 0; argv[argc] != 0; argc++)
+  802819:	48 c7 85 e8 fc ff ff 	movq   $0x0,-0x318(%rbp)
+  802820:	00 00 00 00 
+  802824:	41 be 00 00 00 00    	mov    $0x0,%r14d
+    argv_store = (uintptr_t *)(ROUNDDOWN(string_store, sizeof(uintptr_t)) - sizeof(uintptr_t) * (argc + 1));
+  80282a:	41 bf f8 ff 40 00    	mov    $0x40fff8,%r15d
+  802830:	48 c7 85 e0 fc ff ff 	movq   $0x410000,-0x320(%rbp)
+  802837:	00 00 41 00 
+    string_store = (char *)UTEMP + USER_STACK_SIZE - string_size;
+  80283b:	bb 00 00 41 00       	mov    $0x410000,%ebx
+  802840:	e9 b1 fd ff ff       	jmp    8025f6 <spawn+0x18f>
+    assert(string_store == (char *)UTEMP + USER_STACK_SIZE);
+  802845:	48 b9 90 3f 80 00 00 	movabs $0x803f90,%rcx
+  80284c:	00 00 00 
+  80284f:	48 ba da 3f 80 00 00 	movabs $0x803fda,%rdx
+  802856:	00 00 00 
+  802859:	be 16 01 00 00       	mov    $0x116,%esi
+  80285e:	48 bf ef 3f 80 00 00 	movabs $0x803fef,%rdi
+  802865:	00 00 00 
+  802868:	b8 00 00 00 00       	mov    $0x0,%eax
+  80286d:	49 b8 b8 02 80 00 00 	movabs $0x8002b8,%r8
+  802874:	00 00 00 
+  802877:	41 ff d0             	call   *%r8
+    }
+    res = readn(fd, UTEMP, filesz);
+    if (res < 0) {
+        goto cleanup;
+    }
+    res = region_queue_op(REGION_MAP, 0, UTEMP, child, (void *)va, memsz, perm);
+  80287a:	48 83 ec 08          	sub    $0x8,%rsp
+  80287e:	41 54                	push   %r12
+  802880:	4d 89 f9             	mov    %r15,%r9
+  802883:	4c 8b 85 f0 fc ff ff 	mov    -0x310(%rbp),%r8
+  80288a:	8b 8d e8 fc ff ff    	mov    -0x318(%rbp),%ecx
+  802890:	ba 00 00 40 00       	mov    $0x400000,%edx
+  802895:	be 00 00 00 00       	mov    $0x0,%esi
+  80289a:	bf 01 00 00 00       	mov    $0x1,%edi
+  80289f:	49 bc 61 23 80 00 00 	movabs $0x802361,%r12
+  8028a6:	00 00 00 
+  8028a9:	41 ff d4             	call   *%r12
+  8028ac:	89 c3                	mov    %eax,%ebx
+    if (res < 0) {
+        goto cleanup;
+    }
+cleanup:
+    region_queue_op(REGION_UNMAP, 0, NULL, 0, UTEMP, memsz, 0);
+  8028ae:	c7 04 24 00 00 00 00 	movl   $0x0,(%rsp)
+  8028b5:	4d 89 f9             	mov    %r15,%r9
+  8028b8:	41 b8 00 00 40 00    	mov    $0x400000,%r8d
+  8028be:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8028c3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8028c8:	be 00 00 00 00       	mov    $0x0,%esi
+  8028cd:	bf 02 00 00 00       	mov    $0x2,%edi
+  8028d2:	41 ff d4             	call   *%r12
+        if ((res = map_segment(child, ph->p_va, ph->p_memsz,
+  8028d5:	48 83 c4 10          	add    $0x10,%rsp
+  8028d9:	85 db                	test   %ebx,%ebx
+  8028db:	0f 88 8e 02 00 00    	js     802b6f <spawn+0x708>
+    for (size_t i = 0; i < elf->e_phnum; i++, ph++) {
+  8028e1:	49 83 c6 01          	add    $0x1,%r14
+  8028e5:	49 83 c5 38          	add    $0x38,%r13
+  8028e9:	0f b7 85 08 fe ff ff 	movzwl -0x1f8(%rbp),%eax
+  8028f0:	49 39 c6             	cmp    %rax,%r14
+  8028f3:	0f 83 5a 01 00 00    	jae    802a53 <spawn+0x5ec>
+        if (ph->p_type != ELF_PROG_LOAD) continue;
+  8028f9:	41 83 7d 00 01       	cmpl   $0x1,0x0(%r13)
+  8028fe:	75 e1                	jne    8028e1 <spawn+0x47a>
+        if (ph->p_flags & ELF_PROG_FLAG_WRITE) perm |= PROT_W;
+  802900:	41 8b 45 04          	mov    0x4(%r13),%eax
+  802904:	41 89 c4             	mov    %eax,%r12d
+  802907:	41 83 e4 02          	and    $0x2,%r12d
+        if (ph->p_flags & ELF_PROG_FLAG_READ) perm |= PROT_R;
+  80290b:	44 89 e2             	mov    %r12d,%edx
+  80290e:	83 ca 04             	or     $0x4,%edx
+  802911:	a8 04                	test   $0x4,%al
+  802913:	44 0f 45 e2          	cmovne %edx,%r12d
+        if (ph->p_flags & ELF_PROG_FLAG_EXEC) perm |= PROT_X;
+  802917:	44 89 e2             	mov    %r12d,%edx
+  80291a:	83 ca 01             	or     $0x1,%edx
+  80291d:	a8 01                	test   $0x1,%al
+  80291f:	44 0f 45 e2          	cmovne %edx,%r12d
+        if ((res = map_segment(child, ph->p_va, ph->p_memsz,
+  802923:	49 8b 45 08          	mov    0x8(%r13),%rax
+  802927:	89 85 e0 fc ff ff    	mov    %eax,-0x320(%rbp)
+  80292d:	49 8b 5d 20          	mov    0x20(%r13),%rbx
+  802931:	48 89 9d d8 fc ff ff 	mov    %rbx,-0x328(%rbp)
+  802938:	4d 8b 7d 28          	mov    0x28(%r13),%r15
+  80293c:	49 8b 75 10          	mov    0x10(%r13),%rsi
+  802940:	48 89 b5 f0 fc ff ff 	mov    %rsi,-0x310(%rbp)
+  802947:	8b 8d cc fd ff ff    	mov    -0x234(%rbp),%ecx
+  80294d:	89 8d e8 fc ff ff    	mov    %ecx,-0x318(%rbp)
+    if (res) {
+  802953:	89 f2                	mov    %esi,%edx
+  802955:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  80295b:	74 22                	je     80297f <spawn+0x518>
+        va -= res;
+  80295d:	48 63 ca             	movslq %edx,%rcx
+  802960:	48 29 ce             	sub    %rcx,%rsi
+  802963:	48 89 b5 f0 fc ff ff 	mov    %rsi,-0x310(%rbp)
+        memsz += res;
+  80296a:	49 01 cf             	add    %rcx,%r15
+        filesz += res;
+  80296d:	48 01 cb             	add    %rcx,%rbx
+  802970:	48 89 9d d8 fc ff ff 	mov    %rbx,-0x328(%rbp)
+        fileoffset -= res;
+  802977:	29 d0                	sub    %edx,%eax
+  802979:	89 85 e0 fc ff ff    	mov    %eax,-0x320(%rbp)
+    res = region_queue_op(REGION_ALLOC, 0, NULL, 0, UTEMP, memsz, PROT_RW | PROT_X | ALLOC_ZERO);
+  80297f:	48 83 ec 08          	sub    $0x8,%rsp
+  802983:	68 07 00 10 00       	push   $0x100007
+  802988:	4d 89 f9             	mov    %r15,%r9
+  80298b:	41 b8 00 00 40 00    	mov    $0x400000,%r8d
+  802991:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802996:	ba 00 00 00 00       	mov    $0x0,%edx
+  80299b:	be 00 00 00 00       	mov    $0x0,%esi
+  8029a0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8029a5:	48 b8 61 23 80 00 00 	movabs $0x802361,%rax
+  8029ac:	00 00 00 
+  8029af:	ff d0                	call   *%rax
+  8029b1:	89 c3                	mov    %eax,%ebx
+    if (res < 0 || (res = region_flush()) < 0) {
+  8029b3:	48 83 c4 10          	add    $0x10,%rsp
+  8029b7:	85 c0                	test   %eax,%eax
+  8029b9:	0f 88 b0 01 00 00    	js     802b6f <spawn+0x708>
+  8029bf:	48 b9 b4 22 80 00 00 	movabs $0x8022b4,%rcx
+  8029c6:	00 00 00 
+  8029c9:	ff d1                	call   *%rcx
+  8029cb:	89 c3                	mov    %eax,%ebx
+  8029cd:	85 c0                	test   %eax,%eax
+  8029cf:	0f 88 9a 01 00 00    	js     802b6f <spawn+0x708>
+    res = seek(fd, fileoffset);
+  8029d5:	8b b5 e0 fc ff ff    	mov    -0x320(%rbp),%esi
+  8029db:	8b bd fc fc ff ff    	mov    -0x304(%rbp),%edi
+  8029e1:	48 b9 a4 1c 80 00 00 	movabs $0x801ca4,%rcx
+  8029e8:	00 00 00 
+  8029eb:	ff d1                	call   *%rcx
+  8029ed:	89 c3                	mov    %eax,%ebx
+    if (res < 0) {
+  8029ef:	85 c0                	test   %eax,%eax
+  8029f1:	78 28                	js     802a1b <spawn+0x5b4>
+    res = readn(fd, UTEMP, filesz);
+  8029f3:	48 8b 95 d8 fc ff ff 	mov    -0x328(%rbp),%rdx
+  8029fa:	be 00 00 40 00       	mov    $0x400000,%esi
+  8029ff:	8b bd fc fc ff ff    	mov    -0x304(%rbp),%edi
+  802a05:	48 b9 7a 1b 80 00 00 	movabs $0x801b7a,%rcx
+  802a0c:	00 00 00 
+  802a0f:	ff d1                	call   *%rcx
+  802a11:	89 c3                	mov    %eax,%ebx
+    if (res < 0) {
+  802a13:	85 c0                	test   %eax,%eax
+  802a15:	0f 89 5f fe ff ff    	jns    80287a <spawn+0x413>
+    region_queue_op(REGION_UNMAP, 0, NULL, 0, UTEMP, memsz, 0);
+  802a1b:	48 83 ec 08          	sub    $0x8,%rsp
+  802a1f:	6a 00                	push   $0x0
+  802a21:	4d 89 f9             	mov    %r15,%r9
+  802a24:	41 b8 00 00 40 00    	mov    $0x400000,%r8d
+  802a2a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802a2f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a34:	be 00 00 00 00       	mov    $0x0,%esi
+  802a39:	bf 02 00 00 00       	mov    $0x2,%edi
+  802a3e:	48 b8 61 23 80 00 00 	movabs $0x802361,%rax
+  802a45:	00 00 00 
+  802a48:	ff d0                	call   *%rax
+  802a4a:	48 83 c4 10          	add    $0x10,%rsp
+  802a4e:	e9 1c 01 00 00       	jmp    802b6f <spawn+0x708>
+    close(fd);
+  802a53:	8b bd fc fc ff ff    	mov    -0x304(%rbp),%edi
+  802a59:	48 b8 3e 19 80 00 00 	movabs $0x80193e,%rax
+  802a60:	00 00 00 
+  802a63:	ff d0                	call   *%rax
+    if ((res = foreach_shared_region(copy_shared_region, &child)) < 0 ||
+  802a65:	48 8d b5 cc fd ff ff 	lea    -0x234(%rbp),%rsi
+  802a6c:	48 bf 10 24 80 00 00 	movabs $0x802410,%rdi
+  802a73:	00 00 00 
+  802a76:	48 b8 d3 32 80 00 00 	movabs $0x8032d3,%rax
+  802a7d:	00 00 00 
+  802a80:	ff d0                	call   *%rax
+  802a82:	85 c0                	test   %eax,%eax
+  802a84:	78 59                	js     802adf <spawn+0x678>
+        (res = region_flush()) < 0)
+  802a86:	48 b8 b4 22 80 00 00 	movabs $0x8022b4,%rax
+  802a8d:	00 00 00 
+  802a90:	ff d0                	call   *%rax
+    if ((res = foreach_shared_region(copy_shared_region, &child)) < 0 ||
+  802a92:	85 c0                	test   %eax,%eax
+  802a94:	78 49                	js     802adf <spawn+0x678>
+    if ((res = sys_env_set_trapframe(child, &child_tf)) < 0)
+  802a96:	48 8d b5 0c fd ff ff 	lea    -0x2f4(%rbp),%rsi
+  802a9d:	8b bd cc fd ff ff    	mov    -0x234(%rbp),%edi
+  802aa3:	48 b8 b1 15 80 00 00 	movabs $0x8015b1,%rax
+  802aaa:	00 00 00 
+  802aad:	ff d0                	call   *%rax
+  802aaf:	85 c0                	test   %eax,%eax
+  802ab1:	78 59                	js     802b0c <spawn+0x6a5>
+    if ((res = sys_env_set_status(child, ENV_RUNNABLE)) < 0)
+  802ab3:	be 02 00 00 00       	mov    $0x2,%esi
+  802ab8:	8b bd cc fd ff ff    	mov    -0x234(%rbp),%edi
+  802abe:	48 b8 79 14 80 00 00 	movabs $0x801479,%rax
+  802ac5:	00 00 00 
+  802ac8:	ff d0                	call   *%rax
+  802aca:	85 c0                	test   %eax,%eax
+  802acc:	78 6b                	js     802b39 <spawn+0x6d2>
+    return child;
+  802ace:	8b 85 cc fd ff ff    	mov    -0x234(%rbp),%eax
+  802ad4:	89 85 fc fc ff ff    	mov    %eax,-0x304(%rbp)
+  802ada:	e9 c6 00 00 00       	jmp    802ba5 <spawn+0x73e>
+        panic("copy_shared_region: %i", res);
+  802adf:	89 c1                	mov    %eax,%ecx
+  802ae1:	48 ba fb 3f 80 00 00 	movabs $0x803ffb,%rdx
+  802ae8:	00 00 00 
+  802aeb:	be a8 00 00 00       	mov    $0xa8,%esi
+  802af0:	48 bf ef 3f 80 00 00 	movabs $0x803fef,%rdi
+  802af7:	00 00 00 
+  802afa:	b8 00 00 00 00       	mov    $0x0,%eax
+  802aff:	49 b8 b8 02 80 00 00 	movabs $0x8002b8,%r8
+  802b06:	00 00 00 
+  802b09:	41 ff d0             	call   *%r8
+        panic("sys_env_set_trapframe: %i", res);
+  802b0c:	89 c1                	mov    %eax,%ecx
+  802b0e:	48 ba 12 40 80 00 00 	movabs $0x804012,%rdx
+  802b15:	00 00 00 
+  802b18:	be ab 00 00 00       	mov    $0xab,%esi
+  802b1d:	48 bf ef 3f 80 00 00 	movabs $0x803fef,%rdi
+  802b24:	00 00 00 
+  802b27:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b2c:	49 b8 b8 02 80 00 00 	movabs $0x8002b8,%r8
+  802b33:	00 00 00 
+  802b36:	41 ff d0             	call   *%r8
+        panic("sys_env_set_status: %i", res);
+  802b39:	89 c1                	mov    %eax,%ecx
+  802b3b:	48 ba 2c 40 80 00 00 	movabs $0x80402c,%rdx
+  802b42:	00 00 00 
+  802b45:	be ae 00 00 00       	mov    $0xae,%esi
+  802b4a:	48 bf ef 3f 80 00 00 	movabs $0x803fef,%rdi
+  802b51:	00 00 00 
+  802b54:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b59:	49 b8 b8 02 80 00 00 	movabs $0x8002b8,%r8
+  802b60:	00 00 00 
+  802b63:	41 ff d0             	call   *%r8
+    if ((void *)(argv_store - 2) < (void *)UTEMP) return -E_NO_MEM;
+  802b66:	41 bd fc ff ff ff    	mov    $0xfffffffc,%r13d
+    for (size_t i = 0; i < elf->e_phnum; i++, ph++) {
+  802b6c:	44 89 eb             	mov    %r13d,%ebx
+    region_flush();
+  802b6f:	48 b8 b4 22 80 00 00 	movabs $0x8022b4,%rax
+  802b76:	00 00 00 
+  802b79:	ff d0                	call   *%rax
+    sys_env_destroy(child);
+  802b7b:	8b bd cc fd ff ff    	mov    -0x234(%rbp),%edi
+  802b81:	48 b8 b2 11 80 00 00 	movabs $0x8011b2,%rax
+  802b88:	00 00 00 
+  802b8b:	ff d0                	call   *%rax
+    close(fd);
+  802b8d:	8b bd fc fc ff ff    	mov    -0x304(%rbp),%edi
+  802b93:	48 b8 3e 19 80 00 00 	movabs $0x80193e,%rax
+  802b9a:	00 00 00 
+  802b9d:	ff d0                	call   *%rax
+    return res;
+  802b9f:	89 9d fc fc ff ff    	mov    %ebx,-0x304(%rbp)
+}
+  802ba5:	8b 85 fc fc ff ff    	mov    -0x304(%rbp),%eax
+  802bab:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  802baf:	5b                   	pop    %rbx
+  802bb0:	41 5c                	pop    %r12
+  802bb2:	41 5d                	pop    %r13
+  802bb4:	41 5e                	pop    %r14
+  802bb6:	41 5f                	pop    %r15
+  802bb8:	5d                   	pop    %rbp
+  802bb9:	c3                   	ret
+
+0000000000802bba <spawnl>:
+spawnl(const char *prog, const char *arg0, ...) {
+  802bba:	55                   	push   %rbp
+  802bbb:	48 89 e5             	mov    %rsp,%rbp
+  802bbe:	48 83 ec 50          	sub    $0x50,%rsp
+  802bc2:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  802bc6:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  802bca:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  802bce:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(vl, arg0);
+  802bd2:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  802bd9:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802bdd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802be1:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  802be5:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int argc = 0;
+  802be9:	b9 00 00 00 00       	mov    $0x0,%ecx
+    while (va_arg(vl, void *) != NULL) argc++;
+  802bee:	eb 15                	jmp    802c05 <spawnl+0x4b>
+  802bf0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802bf4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802bf8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802bfc:	48 83 3a 00          	cmpq   $0x0,(%rdx)
+  802c00:	74 1c                	je     802c1e <spawnl+0x64>
+  802c02:	83 c1 01             	add    $0x1,%ecx
+  802c05:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802c08:	83 f8 2f             	cmp    $0x2f,%eax
+  802c0b:	77 e3                	ja     802bf0 <spawnl+0x36>
+  802c0d:	89 c2                	mov    %eax,%edx
+  802c0f:	4c 8d 55 d0          	lea    -0x30(%rbp),%r10
+  802c13:	4c 01 d2             	add    %r10,%rdx
+  802c16:	83 c0 08             	add    $0x8,%eax
+  802c19:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802c1c:	eb de                	jmp    802bfc <spawnl+0x42>
+    const char *argv[argc + 2];
+  802c1e:	8d 41 02             	lea    0x2(%rcx),%eax
+  802c21:	48 98                	cltq
+  802c23:	48 8d 04 c5 0f 00 00 	lea    0xf(,%rax,8),%rax
+  802c2a:	00 
+  802c2b:	48 83 e0 f0          	and    $0xfffffffffffffff0,%rax
+  802c2f:	48 29 c4             	sub    %rax,%rsp
+  802c32:	4c 8d 44 24 07       	lea    0x7(%rsp),%r8
+  802c37:	4c 89 c0             	mov    %r8,%rax
+  802c3a:	48 c1 e8 03          	shr    $0x3,%rax
+  802c3e:	49 83 e0 f8          	and    $0xfffffffffffffff8,%r8
+    argv[0] = arg0;
+  802c42:	48 89 34 c5 00 00 00 	mov    %rsi,0x0(,%rax,8)
+  802c49:	00 
+    argv[argc + 1] = NULL;
+  802c4a:	8d 41 01             	lea    0x1(%rcx),%eax
+  802c4d:	48 98                	cltq
+  802c4f:	49 c7 04 c0 00 00 00 	movq   $0x0,(%r8,%rax,8)
+  802c56:	00 
+    va_start(vl, arg0);
+  802c57:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  802c5e:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802c62:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802c66:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  802c6a:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    for (i = 0; i < argc; i++) {
+  802c6e:	85 c9                	test   %ecx,%ecx
+  802c70:	74 41                	je     802cb3 <spawnl+0xf9>
+        argv[i + 1] = va_arg(vl, const char *);
+  802c72:	49 89 c1             	mov    %rax,%r9
+  802c75:	49 8d 40 08          	lea    0x8(%r8),%rax
+  802c79:	8d 51 ff             	lea    -0x1(%rcx),%edx
+  802c7c:	49 8d 74 d0 10       	lea    0x10(%r8,%rdx,8),%rsi
+  802c81:	eb 1b                	jmp    802c9e <spawnl+0xe4>
+  802c83:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  802c87:	48 8d 51 08          	lea    0x8(%rcx),%rdx
+  802c8b:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  802c8f:	48 8b 11             	mov    (%rcx),%rdx
+  802c92:	48 89 10             	mov    %rdx,(%rax)
+    for (i = 0; i < argc; i++) {
+  802c95:	48 83 c0 08          	add    $0x8,%rax
+  802c99:	48 39 f0             	cmp    %rsi,%rax
+  802c9c:	74 15                	je     802cb3 <spawnl+0xf9>
+        argv[i + 1] = va_arg(vl, const char *);
+  802c9e:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  802ca1:	83 fa 2f             	cmp    $0x2f,%edx
+  802ca4:	77 dd                	ja     802c83 <spawnl+0xc9>
+  802ca6:	89 d1                	mov    %edx,%ecx
+  802ca8:	4c 01 c9             	add    %r9,%rcx
+  802cab:	83 c2 08             	add    $0x8,%edx
+  802cae:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  802cb1:	eb dc                	jmp    802c8f <spawnl+0xd5>
+    return spawn(prog, argv);
+  802cb3:	4c 89 c6             	mov    %r8,%rsi
+  802cb6:	48 b8 67 24 80 00 00 	movabs $0x802467,%rax
+  802cbd:	00 00 00 
+  802cc0:	ff d0                	call   *%rax
+}
+  802cc2:	c9                   	leave
+  802cc3:	c3                   	ret
+
+0000000000802cc4 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  802cc4:	55                   	push   %rbp
+  802cc5:	48 89 e5             	mov    %rsp,%rbp
+  802cc8:	41 54                	push   %r12
+  802cca:	53                   	push   %rbx
+  802ccb:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802cce:	48 b8 2a 17 80 00 00 	movabs $0x80172a,%rax
+  802cd5:	00 00 00 
+  802cd8:	ff d0                	call   *%rax
+  802cda:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  802cdd:	48 be 43 40 80 00 00 	movabs $0x804043,%rsi
+  802ce4:	00 00 00 
+  802ce7:	48 89 df             	mov    %rbx,%rdi
+  802cea:	48 b8 2d 0d 80 00 00 	movabs $0x800d2d,%rax
+  802cf1:	00 00 00 
+  802cf4:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  802cf6:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  802cfb:	41 2b 04 24          	sub    (%r12),%eax
+  802cff:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  802d05:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  802d0c:	00 00 00 
+    stat->st_dev = &devpipe;
+  802d0f:	48 b8 60 50 80 00 00 	movabs $0x805060,%rax
+  802d16:	00 00 00 
+  802d19:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  802d20:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d25:	5b                   	pop    %rbx
+  802d26:	41 5c                	pop    %r12
+  802d28:	5d                   	pop    %rbp
+  802d29:	c3                   	ret
+
+0000000000802d2a <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  802d2a:	55                   	push   %rbp
+  802d2b:	48 89 e5             	mov    %rsp,%rbp
+  802d2e:	41 54                	push   %r12
+  802d30:	53                   	push   %rbx
+  802d31:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  802d34:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802d39:	48 89 fe             	mov    %rdi,%rsi
+  802d3c:	bf 00 00 00 00       	mov    $0x0,%edi
+  802d41:	49 bc a9 13 80 00 00 	movabs $0x8013a9,%r12
+  802d48:	00 00 00 
+  802d4b:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  802d4e:	48 89 df             	mov    %rbx,%rdi
+  802d51:	48 b8 2a 17 80 00 00 	movabs $0x80172a,%rax
+  802d58:	00 00 00 
+  802d5b:	ff d0                	call   *%rax
+  802d5d:	48 89 c6             	mov    %rax,%rsi
+  802d60:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802d65:	bf 00 00 00 00       	mov    $0x0,%edi
+  802d6a:	41 ff d4             	call   *%r12
+}
+  802d6d:	5b                   	pop    %rbx
+  802d6e:	41 5c                	pop    %r12
+  802d70:	5d                   	pop    %rbp
+  802d71:	c3                   	ret
+
+0000000000802d72 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  802d72:	55                   	push   %rbp
+  802d73:	48 89 e5             	mov    %rsp,%rbp
+  802d76:	41 57                	push   %r15
+  802d78:	41 56                	push   %r14
+  802d7a:	41 55                	push   %r13
+  802d7c:	41 54                	push   %r12
+  802d7e:	53                   	push   %rbx
+  802d7f:	48 83 ec 18          	sub    $0x18,%rsp
+  802d83:	49 89 fc             	mov    %rdi,%r12
+  802d86:	49 89 f5             	mov    %rsi,%r13
+  802d89:	49 89 d7             	mov    %rdx,%r15
+  802d8c:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802d90:	48 b8 2a 17 80 00 00 	movabs $0x80172a,%rax
+  802d97:	00 00 00 
+  802d9a:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  802d9c:	4d 85 ff             	test   %r15,%r15
+  802d9f:	0f 84 af 00 00 00    	je     802e54 <devpipe_write+0xe2>
+  802da5:	48 89 c3             	mov    %rax,%rbx
+  802da8:	4c 89 f8             	mov    %r15,%rax
+  802dab:	4d 89 ef             	mov    %r13,%r15
+  802dae:	4c 01 e8             	add    %r13,%rax
+  802db1:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802db5:	49 bd b1 12 80 00 00 	movabs $0x8012b1,%r13
+  802dbc:	00 00 00 
+            sys_yield();
+  802dbf:	49 be 4e 12 80 00 00 	movabs $0x80124e,%r14
+  802dc6:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  802dc9:	8b 73 04             	mov    0x4(%rbx),%esi
+  802dcc:	48 63 ce             	movslq %esi,%rcx
+  802dcf:	48 63 03             	movslq (%rbx),%rax
+  802dd2:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  802dd8:	48 39 c1             	cmp    %rax,%rcx
+  802ddb:	72 2e                	jb     802e0b <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802ddd:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802de2:	48 89 da             	mov    %rbx,%rdx
+  802de5:	be 00 10 00 00       	mov    $0x1000,%esi
+  802dea:	4c 89 e7             	mov    %r12,%rdi
+  802ded:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  802df0:	85 c0                	test   %eax,%eax
+  802df2:	74 66                	je     802e5a <devpipe_write+0xe8>
+            sys_yield();
+  802df4:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  802df7:	8b 73 04             	mov    0x4(%rbx),%esi
+  802dfa:	48 63 ce             	movslq %esi,%rcx
+  802dfd:	48 63 03             	movslq (%rbx),%rax
+  802e00:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  802e06:	48 39 c1             	cmp    %rax,%rcx
+  802e09:	73 d2                	jae    802ddd <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  802e0b:	41 0f b6 3f          	movzbl (%r15),%edi
+  802e0f:	48 89 ca             	mov    %rcx,%rdx
+  802e12:	48 c1 ea 03          	shr    $0x3,%rdx
+  802e16:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  802e1d:	08 10 20 
+  802e20:	48 f7 e2             	mul    %rdx
+  802e23:	48 c1 ea 06          	shr    $0x6,%rdx
+  802e27:	48 89 d0             	mov    %rdx,%rax
+  802e2a:	48 c1 e0 09          	shl    $0x9,%rax
+  802e2e:	48 29 d0             	sub    %rdx,%rax
+  802e31:	48 c1 e0 03          	shl    $0x3,%rax
+  802e35:	48 29 c1             	sub    %rax,%rcx
+  802e38:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  802e3d:	83 c6 01             	add    $0x1,%esi
+  802e40:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  802e43:	49 83 c7 01          	add    $0x1,%r15
+  802e47:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802e4b:	49 39 c7             	cmp    %rax,%r15
+  802e4e:	0f 85 75 ff ff ff    	jne    802dc9 <devpipe_write+0x57>
+    return n;
+  802e54:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802e58:	eb 05                	jmp    802e5f <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  802e5a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802e5f:	48 83 c4 18          	add    $0x18,%rsp
+  802e63:	5b                   	pop    %rbx
+  802e64:	41 5c                	pop    %r12
+  802e66:	41 5d                	pop    %r13
+  802e68:	41 5e                	pop    %r14
+  802e6a:	41 5f                	pop    %r15
+  802e6c:	5d                   	pop    %rbp
+  802e6d:	c3                   	ret
+
+0000000000802e6e <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  802e6e:	55                   	push   %rbp
+  802e6f:	48 89 e5             	mov    %rsp,%rbp
+  802e72:	41 57                	push   %r15
+  802e74:	41 56                	push   %r14
+  802e76:	41 55                	push   %r13
+  802e78:	41 54                	push   %r12
+  802e7a:	53                   	push   %rbx
+  802e7b:	48 83 ec 18          	sub    $0x18,%rsp
+  802e7f:	49 89 fc             	mov    %rdi,%r12
+  802e82:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  802e86:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802e8a:	48 b8 2a 17 80 00 00 	movabs $0x80172a,%rax
+  802e91:	00 00 00 
+  802e94:	ff d0                	call   *%rax
+  802e96:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  802e99:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802e9f:	49 bd b1 12 80 00 00 	movabs $0x8012b1,%r13
+  802ea6:	00 00 00 
+            sys_yield();
+  802ea9:	49 be 4e 12 80 00 00 	movabs $0x80124e,%r14
+  802eb0:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  802eb3:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  802eb8:	74 7d                	je     802f37 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  802eba:	8b 03                	mov    (%rbx),%eax
+  802ebc:	3b 43 04             	cmp    0x4(%rbx),%eax
+  802ebf:	75 26                	jne    802ee7 <devpipe_read+0x79>
+            if (i > 0) return i;
+  802ec1:	4d 85 ff             	test   %r15,%r15
+  802ec4:	75 77                	jne    802f3d <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802ec6:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802ecb:	48 89 da             	mov    %rbx,%rdx
+  802ece:	be 00 10 00 00       	mov    $0x1000,%esi
+  802ed3:	4c 89 e7             	mov    %r12,%rdi
+  802ed6:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  802ed9:	85 c0                	test   %eax,%eax
+  802edb:	74 72                	je     802f4f <devpipe_read+0xe1>
+            sys_yield();
+  802edd:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  802ee0:	8b 03                	mov    (%rbx),%eax
+  802ee2:	3b 43 04             	cmp    0x4(%rbx),%eax
+  802ee5:	74 df                	je     802ec6 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802ee7:	48 63 c8             	movslq %eax,%rcx
+  802eea:	48 89 ca             	mov    %rcx,%rdx
+  802eed:	48 c1 ea 03          	shr    $0x3,%rdx
+  802ef1:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  802ef8:	08 10 20 
+  802efb:	48 89 d0             	mov    %rdx,%rax
+  802efe:	48 f7 e6             	mul    %rsi
+  802f01:	48 c1 ea 06          	shr    $0x6,%rdx
+  802f05:	48 89 d0             	mov    %rdx,%rax
+  802f08:	48 c1 e0 09          	shl    $0x9,%rax
+  802f0c:	48 29 d0             	sub    %rdx,%rax
+  802f0f:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  802f16:	00 
+  802f17:	48 89 c8             	mov    %rcx,%rax
+  802f1a:	48 29 d0             	sub    %rdx,%rax
+  802f1d:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  802f22:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  802f26:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  802f2a:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  802f2d:	49 83 c7 01          	add    $0x1,%r15
+  802f31:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  802f35:	75 83                	jne    802eba <devpipe_read+0x4c>
+    return n;
+  802f37:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802f3b:	eb 03                	jmp    802f40 <devpipe_read+0xd2>
+            if (i > 0) return i;
+  802f3d:	4c 89 f8             	mov    %r15,%rax
+}
+  802f40:	48 83 c4 18          	add    $0x18,%rsp
+  802f44:	5b                   	pop    %rbx
+  802f45:	41 5c                	pop    %r12
+  802f47:	41 5d                	pop    %r13
+  802f49:	41 5e                	pop    %r14
+  802f4b:	41 5f                	pop    %r15
+  802f4d:	5d                   	pop    %rbp
+  802f4e:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  802f4f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f54:	eb ea                	jmp    802f40 <devpipe_read+0xd2>
+
+0000000000802f56 <pipe>:
+pipe(int pfd[2]) {
+  802f56:	55                   	push   %rbp
+  802f57:	48 89 e5             	mov    %rsp,%rbp
+  802f5a:	41 55                	push   %r13
+  802f5c:	41 54                	push   %r12
+  802f5e:	53                   	push   %rbx
+  802f5f:	48 81 ec b8 00 00 00 	sub    $0xb8,%rsp
+  802f66:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  802f69:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802f6d:	48 b8 bf 17 80 00 00 	movabs $0x8017bf,%rax
+  802f74:	00 00 00 
+  802f77:	ff d0                	call   *%rax
+  802f79:	89 c3                	mov    %eax,%ebx
+  802f7b:	85 c0                	test   %eax,%eax
+  802f7d:	0f 88 51 01 00 00    	js     8030d4 <pipe+0x17e>
+        (res = fd_alloc_from(fd2num(fd0) + 1, &fd1)) < 0) goto err;
+  802f83:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802f87:	48 b8 18 17 80 00 00 	movabs $0x801718,%rax
+  802f8e:	00 00 00 
+  802f91:	ff d0                	call   *%rax
+  802f93:	8d 78 01             	lea    0x1(%rax),%edi
+  802f96:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802f9a:	48 b8 46 17 80 00 00 	movabs $0x801746,%rax
+  802fa1:	00 00 00 
+  802fa4:	ff d0                	call   *%rax
+  802fa6:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  802fa8:	85 c0                	test   %eax,%eax
+  802faa:	0f 88 24 01 00 00    	js     8030d4 <pipe+0x17e>
+    va = fd2data(fd0);
+  802fb0:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802fb4:	48 bb 2a 17 80 00 00 	movabs $0x80172a,%rbx
+  802fbb:	00 00 00 
+  802fbe:	ff d3                	call   *%rbx
+  802fc0:	49 89 c5             	mov    %rax,%r13
+    struct RegionOp ops[] = {
+  802fc3:	48 8d bd 30 ff ff ff 	lea    -0xd0(%rbp),%rdi
+  802fca:	b9 14 00 00 00       	mov    $0x14,%ecx
+  802fcf:	b8 00 00 00 00       	mov    $0x0,%eax
+  802fd4:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+  802fd7:	c7 85 34 ff ff ff 46 	movl   $0x46,-0xcc(%rbp)
+  802fde:	00 00 00 
+  802fe1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802fe5:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+  802fec:	48 c7 85 50 ff ff ff 	movq   $0x1000,-0xb0(%rbp)
+  802ff3:	00 10 00 00 
+  802ff7:	c7 85 5c ff ff ff 46 	movl   $0x46,-0xa4(%rbp)
+  802ffe:	00 00 00 
+            {.type = REGION_ALLOC, .dstva = (uintptr_t)fd1, .size = PAGE_SIZE, .perm = PROT_RW | PROT_SHARE},
+  803001:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+    struct RegionOp ops[] = {
+  803005:	48 89 bd 70 ff ff ff 	mov    %rdi,-0x90(%rbp)
+  80300c:	48 c7 85 78 ff ff ff 	movq   $0x1000,-0x88(%rbp)
+  803013:	00 10 00 00 
+  803017:	c7 45 84 46 00 00 00 	movl   $0x46,-0x7c(%rbp)
+  80301e:	4c 89 6d 98          	mov    %r13,-0x68(%rbp)
+  803022:	48 c7 45 a0 00 10 00 	movq   $0x1000,-0x60(%rbp)
+  803029:	00 
+  80302a:	c7 45 a8 01 00 00 00 	movl   $0x1,-0x58(%rbp)
+  803031:	c7 45 ac 46 00 00 00 	movl   $0x46,-0x54(%rbp)
+  803038:	4c 89 6d b8          	mov    %r13,-0x48(%rbp)
+            {.type = REGION_MAP, .srcva = (uintptr_t)va, .dstva = (uintptr_t)fd2data(fd1), .size = PAGE_SIZE, .perm = PROT_RW | PROT_SHARE},
+  80303c:	ff d3                	call   *%rbx
+    struct RegionOp ops[] = {
+  80303e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803042:	48 c7 45 c8 00 10 00 	movq   $0x1000,-0x38(%rbp)
+  803049:	00 
+    if ((res = sys_region_batch(ops, sizeof ops / sizeof *ops)) < 0) goto err1;
+  80304a:	be 04 00 00 00       	mov    $0x4,%esi
+  80304f:	48 8d bd 30 ff ff ff 	lea    -0xd0(%rbp),%rdi
+  803056:	48 b8 10 14 80 00 00 	movabs $0x801410,%rax
+  80305d:	00 00 00 
+  803060:	ff d0                	call   *%rax
+  803062:	89 c3                	mov    %eax,%ebx
+  803064:	85 c0                	test   %eax,%eax
+  803066:	0f 88 ad 00 00 00    	js     803119 <pipe+0x1c3>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  80306c:	be 00 10 00 00       	mov    $0x1000,%esi
+  803071:	4c 89 ef             	mov    %r13,%rdi
+  803074:	48 b8 7f 12 80 00 00 	movabs $0x80127f,%rax
+  80307b:	00 00 00 
+  80307e:	ff d0                	call   *%rax
+  803080:	83 f8 02             	cmp    $0x2,%eax
+  803083:	75 5f                	jne    8030e4 <pipe+0x18e>
+    fd0->fd_dev_id = devpipe.dev_id;
+  803085:	a1 60 50 80 00 00 00 	movabs 0x805060,%eax
+  80308c:	00 00 
+  80308e:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803092:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  803094:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803098:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  80309f:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8030a3:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  8030a5:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8030a9:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  8030b0:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8030b4:	48 bb 18 17 80 00 00 	movabs $0x801718,%rbx
+  8030bb:	00 00 00 
+  8030be:	ff d3                	call   *%rbx
+  8030c0:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  8030c4:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  8030c8:	ff d3                	call   *%rbx
+  8030ca:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  8030cf:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  8030d4:	89 d8                	mov    %ebx,%eax
+  8030d6:	48 81 c4 b8 00 00 00 	add    $0xb8,%rsp
+  8030dd:	5b                   	pop    %rbx
+  8030de:	41 5c                	pop    %r12
+  8030e0:	41 5d                	pop    %r13
+  8030e2:	5d                   	pop    %rbp
+  8030e3:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8030e4:	48 b9 60 40 80 00 00 	movabs $0x804060,%rcx
+  8030eb:	00 00 00 
+  8030ee:	48 ba da 3f 80 00 00 	movabs $0x803fda,%rdx
+  8030f5:	00 00 00 
+  8030f8:	be 33 00 00 00       	mov    $0x33,%esi
+  8030fd:	48 bf 4a 40 80 00 00 	movabs $0x80404a,%rdi
+  803104:	00 00 00 
+  803107:	b8 00 00 00 00       	mov    $0x0,%eax
+  80310c:	49 b8 b8 02 80 00 00 	movabs $0x8002b8,%r8
+  803113:	00 00 00 
+  803116:	41 ff d0             	call   *%r8
+        ops[i].type = REGION_UNMAP;
+  803119:	c7 85 30 ff ff ff 02 	movl   $0x2,-0xd0(%rbp)
+  803120:	00 00 00 
+  803123:	c7 85 58 ff ff ff 02 	movl   $0x2,-0xa8(%rbp)
+  80312a:	00 00 00 
+  80312d:	c7 45 80 02 00 00 00 	movl   $0x2,-0x80(%rbp)
+  803134:	c7 45 a8 02 00 00 00 	movl   $0x2,-0x58(%rbp)
+    sys_region_batch(ops, sizeof ops / sizeof *ops);
+  80313b:	be 04 00 00 00       	mov    $0x4,%esi
+  803140:	48 8d bd 30 ff ff ff 	lea    -0xd0(%rbp),%rdi
+  803147:	48 b8 10 14 80 00 00 	movabs $0x801410,%rax
+  80314e:	00 00 00 
+  803151:	ff d0                	call   *%rax
+  803153:	e9 7c ff ff ff       	jmp    8030d4 <pipe+0x17e>
+
+0000000000803158 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  803158:	55                   	push   %rbp
+  803159:	48 89 e5             	mov    %rsp,%rbp
+  80315c:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803160:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803164:	48 b8 d9 17 80 00 00 	movabs $0x8017d9,%rax
+  80316b:	00 00 00 
+  80316e:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803170:	85 c0                	test   %eax,%eax
+  803172:	78 35                	js     8031a9 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  803174:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803178:	48 b8 2a 17 80 00 00 	movabs $0x80172a,%rax
+  80317f:	00 00 00 
+  803182:	ff d0                	call   *%rax
+  803184:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803187:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80318c:	be 00 10 00 00       	mov    $0x1000,%esi
+  803191:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803195:	48 b8 b1 12 80 00 00 	movabs $0x8012b1,%rax
+  80319c:	00 00 00 
+  80319f:	ff d0                	call   *%rax
+  8031a1:	85 c0                	test   %eax,%eax
+  8031a3:	0f 94 c0             	sete   %al
+  8031a6:	0f b6 c0             	movzbl %al,%eax
+}
+  8031a9:	c9                   	leave
+  8031aa:	c3                   	ret
+
+00000000008031ab <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8031ab:	48 89 f8             	mov    %rdi,%rax
+  8031ae:	48 c1 e8 27          	shr    $0x27,%rax
+  8031b2:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  8031b9:	01 00 00 
+  8031bc:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8031c0:	f6 c2 01             	test   $0x1,%dl
+  8031c3:	74 6d                	je     803232 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8031c5:	48 89 f8             	mov    %rdi,%rax
+  8031c8:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8031cc:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8031d3:	01 00 00 
+  8031d6:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8031da:	f6 c2 01             	test   $0x1,%dl
+  8031dd:	74 62                	je     803241 <get_uvpt_entry+0x96>
+  8031df:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8031e6:	01 00 00 
+  8031e9:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8031ed:	f6 c2 80             	test   $0x80,%dl
+  8031f0:	75 4f                	jne    803241 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8031f2:	48 89 f8             	mov    %rdi,%rax
+  8031f5:	48 c1 e8 15          	shr    $0x15,%rax
+  8031f9:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  803200:	01 00 00 
+  803203:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803207:	f6 c2 01             	test   $0x1,%dl
+  80320a:	74 44                	je     803250 <get_uvpt_entry+0xa5>
+  80320c:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  803213:	01 00 00 
+  803216:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80321a:	f6 c2 80             	test   $0x80,%dl
+  80321d:	75 31                	jne    803250 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  80321f:	48 c1 ef 0c          	shr    $0xc,%rdi
+  803223:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  80322a:	01 00 00 
+  80322d:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  803231:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803232:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  803239:	01 00 00 
+  80323c:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803240:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803241:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  803248:	01 00 00 
+  80324b:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80324f:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803250:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  803257:	01 00 00 
+  80325a:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80325e:	c3                   	ret
+
+000000000080325f <get_prot>:
+
+int
+get_prot(void *va) {
+  80325f:	55                   	push   %rbp
+  803260:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803263:	48 b8 ab 31 80 00 00 	movabs $0x8031ab,%rax
+  80326a:	00 00 00 
+  80326d:	ff d0                	call   *%rax
+  80326f:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  803272:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  803277:	89 c1                	mov    %eax,%ecx
+  803279:	83 c9 04             	or     $0x4,%ecx
+  80327c:	f6 c2 01             	test   $0x1,%dl
+  80327f:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  803282:	89 c1                	mov    %eax,%ecx
+  803284:	83 c9 02             	or     $0x2,%ecx
+  803287:	f6 c2 02             	test   $0x2,%dl
+  80328a:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  80328d:	89 c1                	mov    %eax,%ecx
+  80328f:	83 c9 01             	or     $0x1,%ecx
+  803292:	48 85 d2             	test   %rdx,%rdx
+  803295:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  803298:	89 c1                	mov    %eax,%ecx
+  80329a:	83 c9 40             	or     $0x40,%ecx
+  80329d:	f6 c6 04             	test   $0x4,%dh
+  8032a0:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  8032a3:	5d                   	pop    %rbp
+  8032a4:	c3                   	ret
+
+00000000008032a5 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  8032a5:	55                   	push   %rbp
+  8032a6:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8032a9:	48 b8 ab 31 80 00 00 	movabs $0x8031ab,%rax
+  8032b0:	00 00 00 
+  8032b3:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  8032b5:	48 c1 e8 06          	shr    $0x6,%rax
+  8032b9:	83 e0 01             	and    $0x1,%eax
+}
+  8032bc:	5d                   	pop    %rbp
+  8032bd:	c3                   	ret
+
+00000000008032be <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  8032be:	55                   	push   %rbp
+  8032bf:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  8032c2:	48 b8 ab 31 80 00 00 	movabs $0x8031ab,%rax
+  8032c9:	00 00 00 
+  8032cc:	ff d0                	call   *%rax
+  8032ce:	83 e0 01             	and    $0x1,%eax
+}
+  8032d1:	5d                   	pop    %rbp
+  8032d2:	c3                   	ret
+
+00000000008032d3 <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  8032d3:	55                   	push   %rbp
+  8032d4:	48 89 e5             	mov    %rsp,%rbp
+  8032d7:	41 57                	push   %r15
+  8032d9:	41 56                	push   %r14
+  8032db:	41 55                	push   %r13
+  8032dd:	41 54                	push   %r12
+  8032df:	53                   	push   %rbx
+  8032e0:	48 83 ec 38          	sub    $0x38,%rsp
+  8032e4:	49 89 f7             	mov    %rsi,%r15
+  8032e7:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+                    }
+                    continue;
+                }
+                for (int ptei = 0; ptei < PT_ENTRY_COUNT; ptei++) {
+                    uintptr_t pte_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, pdei, ptei, 0);
+                    pte_t pte = uvpt[VPT(pte_addr)];
+  8032ed:	49 bd 00 00 00 00 00 	movabs $0x10000000000,%r13
+  8032f4:	01 00 00 
+  8032f7:	4d 89 e6             	mov    %r12,%r14
+  8032fa:	49 89 fc             	mov    %rdi,%r12
+  8032fd:	e9 19 01 00 00       	jmp    80341b <foreach_shared_region+0x148>
+  803302:	48 89 5d b0          	mov    %rbx,-0x50(%rbp)
+  803306:	4c 89 75 a8          	mov    %r14,-0x58(%rbp)
+  80330a:	eb 52                	jmp    80335e <foreach_shared_region+0x8b>
+                for (int ptei = 0; ptei < PT_ENTRY_COUNT; ptei++) {
+  80330c:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  803313:	48 81 fb 00 00 20 00 	cmp    $0x200000,%rbx
+  80331a:	74 2e                	je     80334a <foreach_shared_region+0x77>
+                    uintptr_t pte_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, pdei, ptei, 0);
+  80331c:	48 89 df             	mov    %rbx,%rdi
+  80331f:	4c 09 f7             	or     %r14,%rdi
+                    pte_t pte = uvpt[VPT(pte_addr)];
+  803322:	48 89 f8             	mov    %rdi,%rax
+  803325:	48 c1 e8 0c          	shr    $0xc,%rax
+  803329:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+                    if ((pte & PTE_P) && (pte & PTE_SHARE)) {
+  80332e:	25 01 04 00 00       	and    $0x401,%eax
+  803333:	48 3d 01 04 00 00    	cmp    $0x401,%rax
+  803339:	75 d1                	jne    80330c <foreach_shared_region+0x39>
+                        fun((void*)pte_addr, (void*)(pte_addr + PAGE_SIZE), arg);
+  80333b:	48 8d b7 00 10 00 00 	lea    0x1000(%rdi),%rsi
+  803342:	4c 89 fa             	mov    %r15,%rdx
+  803345:	41 ff d4             	call   *%r12
+  803348:	eb c2                	jmp    80330c <foreach_shared_region+0x39>
+            for (int pdei = 0; pdei < PD_ENTRY_COUNT; pdei++) {
+  80334a:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  803351:	00 
+  803352:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803356:	48 3d 00 00 00 40    	cmp    $0x40000000,%rax
+  80335c:	74 46                	je     8033a4 <foreach_shared_region+0xd1>
+                uintptr_t pde_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, pdei, 0, 0);
+  80335e:	4c 8b 75 c8          	mov    -0x38(%rbp),%r14
+  803362:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803366:	49 09 c6             	or     %rax,%r14
+                pde_t pde = uvpd[VPD(pde_addr)];
+  803369:	4c 89 f0             	mov    %r14,%rax
+  80336c:	48 c1 e8 15          	shr    $0x15,%rax
+  803370:	48 b9 00 00 00 80 00 	movabs $0x10080000000,%rcx
+  803377:	01 00 00 
+  80337a:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+                if (!(pde & PTE_P)) {
+  80337e:	a8 01                	test   $0x1,%al
+  803380:	74 c8                	je     80334a <foreach_shared_region+0x77>
+                if (pde & PTE_PS) {
+  803382:	48 89 c3             	mov    %rax,%rbx
+  803385:	81 e3 80 00 00 00    	and    $0x80,%ebx
+  80338b:	74 8f                	je     80331c <foreach_shared_region+0x49>
+                    if (pde & PTE_SHARE) {
+  80338d:	f6 c4 04             	test   $0x4,%ah
+  803390:	74 b8                	je     80334a <foreach_shared_region+0x77>
+                        fun((void*)pde_addr, (void*)(pde_addr + 1024 * 1024 * 2), arg);
+  803392:	49 8d b6 00 00 20 00 	lea    0x200000(%r14),%rsi
+  803399:	4c 89 fa             	mov    %r15,%rdx
+  80339c:	4c 89 f7             	mov    %r14,%rdi
+  80339f:	41 ff d4             	call   *%r12
+  8033a2:	eb a6                	jmp    80334a <foreach_shared_region+0x77>
+  8033a4:	48 8b 5d b0          	mov    -0x50(%rbp),%rbx
+  8033a8:	4c 8b 75 a8          	mov    -0x58(%rbp),%r14
+        for (int pdpei = 0; pdpei < PDP_ENTRY_COUNT; pdpei++) {
+  8033ac:	48 81 c3 00 00 00 40 	add    $0x40000000,%rbx
+  8033b3:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8033ba:	00 00 00 
+  8033bd:	48 39 c3             	cmp    %rax,%rbx
+  8033c0:	74 4c                	je     80340e <foreach_shared_region+0x13b>
+            uintptr_t pdpe_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, 0, 0, 0);
+  8033c2:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  8033c6:	48 09 d8             	or     %rbx,%rax
+  8033c9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+            pdpe_t pdpe = uvpdp[VPDP(pdpe_addr)];
+  8033cd:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8033d1:	48 b9 00 00 40 80 00 	movabs $0x10080400000,%rcx
+  8033d8:	01 00 00 
+  8033db:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+            if (!(pdpe & PTE_P)) {
+  8033df:	a8 01                	test   $0x1,%al
+  8033e1:	74 c9                	je     8033ac <foreach_shared_region+0xd9>
+            if (pdpe & PTE_PS) {
+  8033e3:	48 89 c1             	mov    %rax,%rcx
+  8033e6:	81 e1 80 00 00 00    	and    $0x80,%ecx
+  8033ec:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  8033f0:	0f 84 0c ff ff ff    	je     803302 <foreach_shared_region+0x2f>
+                if (pdpe & PTE_SHARE) {
+  8033f6:	f6 c4 04             	test   $0x4,%ah
+  8033f9:	74 b1                	je     8033ac <foreach_shared_region+0xd9>
+                    fun((void*)pdpe_addr, (void*)(pdpe_addr + 1024 * 1024 * 1024), arg); 
+  8033fb:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  8033ff:	48 8d b7 00 00 00 40 	lea    0x40000000(%rdi),%rsi
+  803406:	4c 89 fa             	mov    %r15,%rdx
+  803409:	41 ff d4             	call   *%r12
+  80340c:	eb 9e                	jmp    8033ac <foreach_shared_region+0xd9>
+    for (int pml4ei = 0; pml4ei < PML4_ENTRY_COUNT; pml4ei++) {
+  80340e:	49 83 c6 01          	add    $0x1,%r14
+  803412:	49 81 fe 00 02 00 00 	cmp    $0x200,%r14
+  803419:	74 24                	je     80343f <foreach_shared_region+0x16c>
+        pml4e_t pml4e = uvpml4[VPML4(pml4_addr)];
+  80341b:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  803422:	01 00 00 
+  803425:	4a 8b 04 f0          	mov    (%rax,%r14,8),%rax
+        if (!(pml4e & PTE_P)) {
+  803429:	a8 01                	test   $0x1,%al
+  80342b:	74 e1                	je     80340e <foreach_shared_region+0x13b>
+  80342d:	4c 89 f0             	mov    %r14,%rax
+  803430:	48 c1 e0 27          	shl    $0x27,%rax
+  803434:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  803438:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80343d:	eb 83                	jmp    8033c2 <foreach_shared_region+0xef>
+            }
+        }
+    }
+    
+    return 0;
+}
+  80343f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803444:	48 83 c4 38          	add    $0x38,%rsp
+  803448:	5b                   	pop    %rbx
+  803449:	41 5c                	pop    %r12
+  80344b:	41 5d                	pop    %r13
+  80344d:	41 5e                	pop    %r14
+  80344f:	41 5f                	pop    %r15
+  803451:	5d                   	pop    %rbp
+  803452:	c3                   	ret
+
+0000000000803453 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  803453:	b8 00 00 00 00       	mov    $0x0,%eax
+  803458:	c3                   	ret
+
+0000000000803459 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  803459:	55                   	push   %rbp
+  80345a:	48 89 e5             	mov    %rsp,%rbp
+  80345d:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  803460:	48 be 84 40 80 00 00 	movabs $0x804084,%rsi
+  803467:	00 00 00 
+  80346a:	48 b8 2d 0d 80 00 00 	movabs $0x800d2d,%rax
+  803471:	00 00 00 
+  803474:	ff d0                	call   *%rax
+    return 0;
+}
+  803476:	b8 00 00 00 00       	mov    $0x0,%eax
+  80347b:	5d                   	pop    %rbp
+  80347c:	c3                   	ret
+
+000000000080347d <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  80347d:	55                   	push   %rbp
+  80347e:	48 89 e5             	mov    %rsp,%rbp
+  803481:	41 57                	push   %r15
+  803483:	41 56                	push   %r14
+  803485:	41 55                	push   %r13
+  803487:	41 54                	push   %r12
+  803489:	53                   	push   %rbx
+  80348a:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  803491:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  803498:	48 85 d2             	test   %rdx,%rdx
+  80349b:	74 7a                	je     803517 <devcons_write+0x9a>
+  80349d:	49 89 d6             	mov    %rdx,%r14
+  8034a0:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8034a6:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  8034ab:	49 bf 27 0f 80 00 00 	movabs $0x800f27,%r15
+  8034b2:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  8034b5:	4c 89 f3             	mov    %r14,%rbx
+  8034b8:	48 29 f3             	sub    %rsi,%rbx
+  8034bb:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8034c0:	48 39 c3             	cmp    %rax,%rbx
+  8034c3:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  8034c7:	4c 63 eb             	movslq %ebx,%r13
+  8034ca:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  8034d1:	48 01 c6             	add    %rax,%rsi
+  8034d4:	4c 89 ea             	mov    %r13,%rdx
+  8034d7:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  8034de:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  8034e1:	4c 89 ee             	mov    %r13,%rsi
+  8034e4:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  8034eb:	48 b8 54 11 80 00 00 	movabs $0x801154,%rax
+  8034f2:	00 00 00 
+  8034f5:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  8034f7:	41 01 dc             	add    %ebx,%r12d
+  8034fa:	49 63 f4             	movslq %r12d,%rsi
+  8034fd:	4c 39 f6             	cmp    %r14,%rsi
+  803500:	72 b3                	jb     8034b5 <devcons_write+0x38>
+    return res;
+  803502:	49 63 c4             	movslq %r12d,%rax
+}
+  803505:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  80350c:	5b                   	pop    %rbx
+  80350d:	41 5c                	pop    %r12
+  80350f:	41 5d                	pop    %r13
+  803511:	41 5e                	pop    %r14
+  803513:	41 5f                	pop    %r15
+  803515:	5d                   	pop    %rbp
+  803516:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  803517:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80351d:	eb e3                	jmp    803502 <devcons_write+0x85>
+
+000000000080351f <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  80351f:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  803522:	ba 00 00 00 00       	mov    $0x0,%edx
+  803527:	48 85 c0             	test   %rax,%rax
+  80352a:	74 55                	je     803581 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  80352c:	55                   	push   %rbp
+  80352d:	48 89 e5             	mov    %rsp,%rbp
+  803530:	41 55                	push   %r13
+  803532:	41 54                	push   %r12
+  803534:	53                   	push   %rbx
+  803535:	48 83 ec 08          	sub    $0x8,%rsp
+  803539:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  80353c:	48 bb 81 11 80 00 00 	movabs $0x801181,%rbx
+  803543:	00 00 00 
+  803546:	49 bc 4e 12 80 00 00 	movabs $0x80124e,%r12
+  80354d:	00 00 00 
+  803550:	eb 03                	jmp    803555 <devcons_read+0x36>
+  803552:	41 ff d4             	call   *%r12
+  803555:	ff d3                	call   *%rbx
+  803557:	85 c0                	test   %eax,%eax
+  803559:	74 f7                	je     803552 <devcons_read+0x33>
+    if (c < 0) return c;
+  80355b:	48 63 d0             	movslq %eax,%rdx
+  80355e:	78 13                	js     803573 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  803560:	ba 00 00 00 00       	mov    $0x0,%edx
+  803565:	83 f8 04             	cmp    $0x4,%eax
+  803568:	74 09                	je     803573 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  80356a:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  80356e:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  803573:	48 89 d0             	mov    %rdx,%rax
+  803576:	48 83 c4 08          	add    $0x8,%rsp
+  80357a:	5b                   	pop    %rbx
+  80357b:	41 5c                	pop    %r12
+  80357d:	41 5d                	pop    %r13
+  80357f:	5d                   	pop    %rbp
+  803580:	c3                   	ret
+  803581:	48 89 d0             	mov    %rdx,%rax
+  803584:	c3                   	ret
+
+0000000000803585 <cputchar>:
+cputchar(int ch) {
+  803585:	55                   	push   %rbp
+  803586:	48 89 e5             	mov    %rsp,%rbp
+  803589:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  80358d:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  803591:	be 01 00 00 00       	mov    $0x1,%esi
+  803596:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  80359a:	48 b8 54 11 80 00 00 	movabs $0x801154,%rax
+  8035a1:	00 00 00 
+  8035a4:	ff d0                	call   *%rax
+}
+  8035a6:	c9                   	leave
+  8035a7:	c3                   	ret
+
+00000000008035a8 <getchar>:
+getchar(void) {
+  8035a8:	55                   	push   %rbp
+  8035a9:	48 89 e5             	mov    %rsp,%rbp
+  8035ac:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  8035b0:	ba 01 00 00 00       	mov    $0x1,%edx
+  8035b5:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  8035b9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8035be:	48 b8 bc 1a 80 00 00 	movabs $0x801abc,%rax
+  8035c5:	00 00 00 
+  8035c8:	ff d0                	call   *%rax
+  8035ca:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  8035cc:	85 c0                	test   %eax,%eax
+  8035ce:	78 06                	js     8035d6 <getchar+0x2e>
+  8035d0:	74 08                	je     8035da <getchar+0x32>
+  8035d2:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  8035d6:	89 d0                	mov    %edx,%eax
+  8035d8:	c9                   	leave
+  8035d9:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  8035da:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  8035df:	eb f5                	jmp    8035d6 <getchar+0x2e>
+
+00000000008035e1 <iscons>:
+iscons(int fdnum) {
+  8035e1:	55                   	push   %rbp
+  8035e2:	48 89 e5             	mov    %rsp,%rbp
+  8035e5:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8035e9:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8035ed:	48 b8 d9 17 80 00 00 	movabs $0x8017d9,%rax
+  8035f4:	00 00 00 
+  8035f7:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8035f9:	85 c0                	test   %eax,%eax
+  8035fb:	78 18                	js     803615 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  8035fd:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803601:	48 b8 a0 50 80 00 00 	movabs $0x8050a0,%rax
+  803608:	00 00 00 
+  80360b:	8b 00                	mov    (%rax),%eax
+  80360d:	39 02                	cmp    %eax,(%rdx)
+  80360f:	0f 94 c0             	sete   %al
+  803612:	0f b6 c0             	movzbl %al,%eax
+}
+  803615:	c9                   	leave
+  803616:	c3                   	ret
+
+0000000000803617 <opencons>:
+opencons(void) {
+  803617:	55                   	push   %rbp
+  803618:	48 89 e5             	mov    %rsp,%rbp
+  80361b:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  80361f:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  803623:	48 b8 bf 17 80 00 00 	movabs $0x8017bf,%rax
+  80362a:	00 00 00 
+  80362d:	ff d0                	call   *%rax
+  80362f:	85 c0                	test   %eax,%eax
+  803631:	78 49                	js     80367c <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  803633:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803638:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80363d:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  803641:	bf 00 00 00 00       	mov    $0x0,%edi
+  803646:	48 b8 dd 12 80 00 00 	movabs $0x8012dd,%rax
+  80364d:	00 00 00 
+  803650:	ff d0                	call   *%rax
+  803652:	85 c0                	test   %eax,%eax
+  803654:	78 26                	js     80367c <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  803656:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80365a:	a1 a0 50 80 00 00 00 	movabs 0x8050a0,%eax
+  803661:	00 00 
+  803663:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  803665:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803669:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  803670:	48 b8 18 17 80 00 00 	movabs $0x801718,%rax
+  803677:	00 00 00 
+  80367a:	ff d0                	call   *%rax
+}
+  80367c:	c9                   	leave
+  80367d:	c3                   	ret
+
+000000000080367e <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  80367e:	55                   	push   %rbp
+  80367f:	48 89 e5             	mov    %rsp,%rbp
+  803682:	41 55                	push   %r13
+  803684:	41 54                	push   %r12
+  803686:	53                   	push   %rbx
+  803687:	48 83 ec 08          	sub    $0x8,%rsp
+  80368b:	49 89 fc             	mov    %rdi,%r12
+  80368e:	48 89 f7             	mov    %rsi,%rdi
+  803691:	48 89 d3             	mov    %rdx,%rbx
+  803694:	49 89 cd             	mov    %rcx,%r13
+    // LAB 9: Your code here:
+    int res = sys_ipc_recv(!pg ? (void*)MAX_USER_ADDRESS : pg, !size ? 0 : *size);
+  803697:	be 00 00 00 00       	mov    $0x0,%esi
+  80369c:	48 85 d2             	test   %rdx,%rdx
+  80369f:	74 03                	je     8036a4 <ipc_recv+0x26>
+  8036a1:	48 8b 32             	mov    (%rdx),%rsi
+  8036a4:	48 85 ff             	test   %rdi,%rdi
+  8036a7:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8036ae:	00 00 00 
+  8036b1:	48 0f 44 f8          	cmove  %rax,%rdi
+  8036b5:	48 b8 af 16 80 00 00 	movabs $0x8016af,%rax
+  8036bc:	00 00 00 
+  8036bf:	ff d0                	call   *%rax
+    if (res < 0) {
+  8036c1:	85 c0                	test   %eax,%eax
+  8036c3:	78 66                	js     80372b <ipc_recv+0xad>
+        if (size) {
+            *size = 0;
+        }
+        return res;
+    }
+    if (from_env_store) {
+  8036c5:	4d 85 e4             	test   %r12,%r12
+  8036c8:	74 14                	je     8036de <ipc_recv+0x60>
+        *from_env_store = thisenv->env_ipc_from;
+  8036ca:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  8036d1:	00 00 00 
+  8036d4:	8b 80 ac 01 00 00    	mov    0x1ac(%rax),%eax
+  8036da:	41 89 04 24          	mov    %eax,(%r12)
+    }
+    if (perm_store) {
+  8036de:	4d 85 ed             	test   %r13,%r13
+  8036e1:	74 14                	je     8036f7 <ipc_recv+0x79>
+        *perm_store = thisenv->env_ipc_perm;
+  8036e3:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  8036ea:	00 00 00 
+  8036ed:	8b 80 b0 01 00 00    	mov    0x1b0(%rax),%eax
+  8036f3:	41 89 45 00          	mov    %eax,0x0(%r13)
+    }
+    if (size) {
+  8036f7:	48 85 db             	test   %rbx,%rbx
+  8036fa:	74 14                	je     803710 <ipc_recv+0x92>
+        *size = thisenv->env_ipc_maxsz;
+  8036fc:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  803703:	00 00 00 
+  803706:	48 8b 80 a0 01 00 00 	mov    0x1a0(%rax),%rax
+  80370d:	48 89 03             	mov    %rax,(%rbx)
+    }
+    return thisenv->env_ipc_value;
+  803710:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  803717:	00 00 00 
+  80371a:	8b 80 a8 01 00 00    	mov    0x1a8(%rax),%eax
+}
+  803720:	48 83 c4 08          	add    $0x8,%rsp
+  803724:	5b                   	pop    %rbx
+  803725:	41 5c                	pop    %r12
+  803727:	41 5d                	pop    %r13
+  803729:	5d                   	pop    %rbp
+  80372a:	c3                   	ret
+        if (from_env_store) {
+  80372b:	4d 85 e4             	test   %r12,%r12
+  80372e:	74 08                	je     803738 <ipc_recv+0xba>
+            *from_env_store = 0;
+  803730:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  803737:	00 
+        if (perm_store) {
+  803738:	4d 85 ed             	test   %r13,%r13
+  80373b:	74 08                	je     803745 <ipc_recv+0xc7>
+            *perm_store = 0;
+  80373d:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  803744:	00 
+        if (size) {
+  803745:	48 85 db             	test   %rbx,%rbx
+  803748:	74 d6                	je     803720 <ipc_recv+0xa2>
+            *size = 0;
+  80374a:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  803751:	eb cd                	jmp    803720 <ipc_recv+0xa2>
+
+0000000000803753 <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  803753:	55                   	push   %rbp
+  803754:	48 89 e5             	mov    %rsp,%rbp
+  803757:	41 57                	push   %r15
+  803759:	41 56                	push   %r14
+  80375b:	41 55                	push   %r13
+  80375d:	41 54                	push   %r12
+  80375f:	53                   	push   %rbx
+  803760:	48 83 ec 18          	sub    $0x18,%rsp
+  803764:	41 89 fd             	mov    %edi,%r13d
+  803767:	89 75 cc             	mov    %esi,-0x34(%rbp)
+  80376a:	49 89 cc             	mov    %rcx,%r12
+  80376d:	44 89 45 c8          	mov    %r8d,-0x38(%rbp)
+    // LAB 9: Your code here:
+    int res = 0;
+    while ((res = sys_ipc_try_send(to_env, val, !pg ? (void*)MAX_USER_ADDRESS : pg, size, perm)) < 0) {
+  803771:	48 85 d2             	test   %rdx,%rdx
+  803774:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80377b:	00 00 00 
+  80377e:	48 0f 45 c2          	cmovne %rdx,%rax
+  803782:	48 89 c3             	mov    %rax,%rbx
+  803785:	49 be 83 16 80 00 00 	movabs $0x801683,%r14
+  80378c:	00 00 00 
+        if (res != -E_IPC_NOT_RECV) {
+            panic("sys_ipc_try_send failed: %i", res);
+        }
+        sys_yield();
+  80378f:	49 bf 4e 12 80 00 00 	movabs $0x80124e,%r15
+  803796:	00 00 00 
+    while ((res = sys_ipc_try_send(to_env, val, !pg ? (void*)MAX_USER_ADDRESS : pg, size, perm)) < 0) {
+  803799:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  80379c:	44 8b 45 c8          	mov    -0x38(%rbp),%r8d
+  8037a0:	4c 89 e1             	mov    %r12,%rcx
+  8037a3:	48 89 da             	mov    %rbx,%rdx
+  8037a6:	44 89 ef             	mov    %r13d,%edi
+  8037a9:	41 ff d6             	call   *%r14
+  8037ac:	85 c0                	test   %eax,%eax
+  8037ae:	79 37                	jns    8037e7 <ipc_send+0x94>
+        if (res != -E_IPC_NOT_RECV) {
+  8037b0:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  8037b3:	75 05                	jne    8037ba <ipc_send+0x67>
+        sys_yield();
+  8037b5:	41 ff d7             	call   *%r15
+  8037b8:	eb df                	jmp    803799 <ipc_send+0x46>
+            panic("sys_ipc_try_send failed: %i", res);
+  8037ba:	89 c1                	mov    %eax,%ecx
+  8037bc:	48 ba 90 40 80 00 00 	movabs $0x804090,%rdx
+  8037c3:	00 00 00 
+  8037c6:	be 40 00 00 00       	mov    $0x40,%esi
+  8037cb:	48 bf ac 40 80 00 00 	movabs $0x8040ac,%rdi
+  8037d2:	00 00 00 
+  8037d5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8037da:	49 b8 b8 02 80 00 00 	movabs $0x8002b8,%r8
+  8037e1:	00 00 00 
+  8037e4:	41 ff d0             	call   *%r8
+    }
+    return;
+}
+  8037e7:	48 83 c4 18          	add    $0x18,%rsp
+  8037eb:	5b                   	pop    %rbx
+  8037ec:	41 5c                	pop    %r12
+  8037ee:	41 5d                	pop    %r13
+  8037f0:	41 5e                	pop    %r14
+  8037f2:	41 5f                	pop    %r15
+  8037f4:	5d                   	pop    %rbp
+  8037f5:	c3                   	ret
+
+00000000008037f6 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  8037f6:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  8037fb:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  803802:	00 00 00 
+  803805:	48 69 d0 d0 01 00 00 	imul   $0x1d0,%rax,%rdx
+  80380c:	48 01 ca             	add    %rcx,%rdx
+  80380f:	8b 92 e8 00 00 00    	mov    0xe8(%rdx),%edx
+  803815:	39 fa                	cmp    %edi,%edx
+  803817:	74 12                	je     80382b <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  803819:	48 83 c0 01          	add    $0x1,%rax
+  80381d:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  803823:	75 e0                	jne    803805 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  803825:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80382a:	c3                   	ret
+            return envs[i].env_id;
+  80382b:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+  803832:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  803839:	00 00 00 
+  80383c:	48 01 d0             	add    %rdx,%rax
+  80383f:	8b 80 e0 00 00 00    	mov    0xe0(%rax),%eax
+  803845:	c3                   	ret
+  803846:	66 90                	xchg   %ax,%ax
+
+0000000000803848 <__rodata_start>:
+  803848:	69 63 6f 64 65 00 69 	imul   $0x69006564,0x6f(%rbx),%esp
+  80384f:	63 6f 64             	movsxd 0x64(%rdi),%ebp
+  803852:	65 20 73 74          	and    %dh,%gs:0x74(%rbx)
+  803856:	61                   	(bad)
+  803857:	72 74                	jb     8038cd <__rodata_start+0x85>
+  803859:	75 70                	jne    8038cb <__rodata_start+0x83>
+  80385b:	0a 00                	or     (%rax),%al
+  80385d:	69 63 6f 64 65 3a 20 	imul   $0x203a6564,0x6f(%rbx),%esp
+  803864:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803865:	70 65                	jo     8038cc <__rodata_start+0x84>
+  803867:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803868:	20 2f                	and    %ch,(%rdi)
+  80386a:	6d                   	insl   (%dx),%es:(%rdi)
+  80386b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80386c:	74 64                	je     8038d2 <__rodata_start+0x8a>
+  80386e:	0a 00                	or     (%rax),%al
+  803870:	2f                   	(bad)
+  803871:	6d                   	insl   (%dx),%es:(%rdi)
+  803872:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803873:	74 64                	je     8038d9 <__rodata_start+0x91>
+  803875:	00 69 63             	add    %ch,0x63(%rcx)
+  803878:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803879:	64 65 3a 20          	fs cmp %gs:(%rax),%ah
+  80387d:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80387e:	70 65                	jo     8038e5 <__rodata_start+0x9d>
+  803880:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803881:	20 2f                	and    %ch,(%rdi)
+  803883:	6d                   	insl   (%dx),%es:(%rdi)
+  803884:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803885:	74 64                	je     8038eb <__rodata_start+0xa3>
+  803887:	3a 20                	cmp    (%rax),%ah
+  803889:	25 69 00 75 73       	and    $0x73750069,%eax
+  80388e:	65 72 2f             	gs jb  8038c0 <__rodata_start+0x78>
+  803891:	69 63 6f 64 65 2e 63 	imul   $0x632e6564,0x6f(%rbx),%esp
+  803898:	00 69 63             	add    %ch,0x63(%rcx)
+  80389b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80389c:	64 65 3a 20          	fs cmp %gs:(%rax),%ah
+  8038a0:	72 65                	jb     803907 <__rodata_start+0xbf>
+  8038a2:	61                   	(bad)
+  8038a3:	64 20 2f             	and    %ch,%fs:(%rdi)
+  8038a6:	6d                   	insl   (%dx),%es:(%rdi)
+  8038a7:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8038a8:	74 64                	je     80390e <__rodata_start+0xc6>
+  8038aa:	0a 00                	or     (%rax),%al
+  8038ac:	69 63 6f 64 65 3a 20 	imul   $0x203a6564,0x6f(%rbx),%esp
+  8038b3:	63 6c 6f 73          	movsxd 0x73(%rdi,%rbp,2),%ebp
+  8038b7:	65 20 2f             	and    %ch,%gs:(%rdi)
+  8038ba:	6d                   	insl   (%dx),%es:(%rdi)
+  8038bb:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8038bc:	74 64                	je     803922 <__rodata_start+0xda>
+  8038be:	0a 00                	or     (%rax),%al
+  8038c0:	69 63 6f 64 65 3a 20 	imul   $0x203a6564,0x6f(%rbx),%esp
+  8038c7:	73 70                	jae    803939 <__rodata_start+0xf1>
+  8038c9:	61                   	(bad)
+  8038ca:	77 6e                	ja     80393a <__rodata_start+0xf2>
+  8038cc:	20 2f                	and    %ch,(%rdi)
+  8038ce:	69 6e 69 74 0a 00 69 	imul   $0x69000a74,0x69(%rsi),%ebp
+  8038d5:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8038d6:	69 74 61 72 67 32 00 	imul   $0x69003267,0x72(%rcx,%riz,2),%esi
+  8038dd:	69 
+  8038de:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8038df:	69 74 61 72 67 31 00 	imul   $0x2f003167,0x72(%rcx,%riz,2),%esi
+  8038e6:	2f 
+  8038e7:	69 6e 69 74 00 69 63 	imul   $0x63690074,0x69(%rsi),%ebp
+  8038ee:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8038ef:	64 65 3a 20          	fs cmp %gs:(%rax),%ah
+  8038f3:	73 70                	jae    803965 <__rodata_start+0x11d>
+  8038f5:	61                   	(bad)
+  8038f6:	77 6e                	ja     803966 <__rodata_start+0x11e>
+  8038f8:	20 2f                	and    %ch,(%rdi)
+  8038fa:	69 6e 69 74 3a 20 25 	imul   $0x25203a74,0x69(%rsi),%ebp
+  803901:	69 00 69 63 6f 64    	imul   $0x646f6369,(%rax),%eax
+  803907:	65 3a 20             	cmp    %gs:(%rax),%ah
+  80390a:	65 78 69             	gs js  803976 <__rodata_start+0x12e>
+  80390d:	74 69                	je     803978 <__rodata_start+0x130>
+  80390f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803910:	67 0a 00             	or     (%eax),%al
+  803913:	3c 75                	cmp    $0x75,%al
+  803915:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803916:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  80391a:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80391b:	3e 00 0f             	ds add %cl,(%rdi)
+  80391e:	1f                   	(bad)
+  80391f:	00 5b 25             	add    %bl,0x25(%rbx)
+  803922:	30 38                	xor    %bh,(%rax)
+  803924:	78 5d                	js     803983 <__rodata_start+0x13b>
+  803926:	20 75 73             	and    %dh,0x73(%rbp)
+  803929:	65 72 20             	gs jb  80394c <__rodata_start+0x104>
+  80392c:	70 61                	jo     80398f <__rodata_start+0x147>
+  80392e:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80392f:	69 63 20 69 6e 20 25 	imul   $0x25206e69,0x20(%rbx),%esp
+  803936:	73 20                	jae    803958 <__rodata_start+0x110>
+  803938:	61                   	(bad)
+  803939:	74 20                	je     80395b <__rodata_start+0x113>
+  80393b:	25 73 3a 25 64       	and    $0x64253a73,%eax
+  803940:	3a 20                	cmp    (%rax),%ah
+  803942:	00 30                	add    %dh,(%rax)
+  803944:	31 32                	xor    %esi,(%rdx)
+  803946:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  80394d:	41                   	rex.B
+  80394e:	42                   	rex.X
+  80394f:	43                   	rex.XB
+  803950:	44                   	rex.R
+  803951:	45                   	rex.RB
+  803952:	46 00 30             	rex.RX add %r14b,(%rax)
+  803955:	31 32                	xor    %esi,(%rdx)
+  803957:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  80395e:	61                   	(bad)
+  80395f:	62 63 64 65 66       	(bad)
+  803964:	00 28                	add    %ch,(%rax)
+  803966:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803967:	75 6c                	jne    8039d5 <__rodata_start+0x18d>
+  803969:	6c                   	insb   (%dx),%es:(%rdi)
+  80396a:	29 00                	sub    %eax,(%rax)
+  80396c:	65 72 72             	gs jb  8039e1 <__rodata_start+0x199>
+  80396f:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803970:	72 20                	jb     803992 <__rodata_start+0x14a>
+  803972:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  803977:	73 70                	jae    8039e9 <__rodata_start+0x1a1>
+  803979:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  80397d:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  803984:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803985:	72 00                	jb     803987 <__rodata_start+0x13f>
+  803987:	62 61 64 20 65       	(bad)
+  80398c:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80398d:	76 69                	jbe    8039f8 <__rodata_start+0x1b0>
+  80398f:	72 6f                	jb     803a00 <__rodata_start+0x1b8>
+  803991:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803992:	6d                   	insl   (%dx),%es:(%rdi)
+  803993:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803995:	74 00                	je     803997 <__rodata_start+0x14f>
+  803997:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  80399e:	20 70 61             	and    %dh,0x61(%rax)
+  8039a1:	72 61                	jb     803a04 <__rodata_start+0x1bc>
+  8039a3:	6d                   	insl   (%dx),%es:(%rdi)
+  8039a4:	65 74 65             	gs je  803a0c <__rodata_start+0x1c4>
+  8039a7:	72 00                	jb     8039a9 <__rodata_start+0x161>
+  8039a9:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8039aa:	75 74                	jne    803a20 <__rodata_start+0x1d8>
+  8039ac:	20 6f 66             	and    %ch,0x66(%rdi)
+  8039af:	20 6d 65             	and    %ch,0x65(%rbp)
+  8039b2:	6d                   	insl   (%dx),%es:(%rdi)
+  8039b3:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8039b4:	72 79                	jb     803a2f <__rodata_start+0x1e7>
+  8039b6:	00 6f 75             	add    %ch,0x75(%rdi)
+  8039b9:	74 20                	je     8039db <__rodata_start+0x193>
+  8039bb:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8039bc:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  8039c0:	76 69                	jbe    803a2b <__rodata_start+0x1e3>
+  8039c2:	72 6f                	jb     803a33 <__rodata_start+0x1eb>
+  8039c4:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8039c5:	6d                   	insl   (%dx),%es:(%rdi)
+  8039c6:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  8039c8:	74 73                	je     803a3d <__rodata_start+0x1f5>
+  8039ca:	00 63 6f             	add    %ah,0x6f(%rbx)
+  8039cd:	72 72                	jb     803a41 <__rodata_start+0x1f9>
+  8039cf:	75 70                	jne    803a41 <__rodata_start+0x1f9>
+  8039d1:	74 65                	je     803a38 <__rodata_start+0x1f0>
+  8039d3:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  8039d8:	75 67                	jne    803a41 <__rodata_start+0x1f9>
+  8039da:	20 69 6e             	and    %ch,0x6e(%rcx)
+  8039dd:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  8039df:	00 73 65             	add    %dh,0x65(%rbx)
+  8039e2:	67 6d                	insl   (%dx),%es:(%edi)
+  8039e4:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  8039e6:	74 61                	je     803a49 <__rodata_start+0x201>
+  8039e8:	74 69                	je     803a53 <__rodata_start+0x20b>
+  8039ea:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8039eb:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8039ec:	20 66 61             	and    %ah,0x61(%rsi)
+  8039ef:	75 6c                	jne    803a5d <__rodata_start+0x215>
+  8039f1:	74 00                	je     8039f3 <__rodata_start+0x1ab>
+  8039f3:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  8039fa:	20 45 4c             	and    %al,0x4c(%rbp)
+  8039fd:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  803a01:	61                   	(bad)
+  803a02:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  803a07:	20 73 75             	and    %dh,0x75(%rbx)
+  803a0a:	63 68 20             	movsxd 0x20(%rax),%ebp
+  803a0d:	73 79                	jae    803a88 <__rodata_start+0x240>
+  803a0f:	73 74                	jae    803a85 <__rodata_start+0x23d>
+  803a11:	65 6d                	gs insl (%dx),%es:(%rdi)
+  803a13:	20 63 61             	and    %ah,0x61(%rbx)
+  803a16:	6c                   	insb   (%dx),%es:(%rdi)
+  803a17:	6c                   	insb   (%dx),%es:(%rdi)
+  803a18:	00 65 6e             	add    %ah,0x6e(%rbp)
+  803a1b:	74 72                	je     803a8f <__rodata_start+0x247>
+  803a1d:	79 20                	jns    803a3f <__rodata_start+0x1f7>
+  803a1f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803a20:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803a21:	74 20                	je     803a43 <__rodata_start+0x1fb>
+  803a23:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  803a25:	75 6e                	jne    803a95 <__rodata_start+0x24d>
+  803a27:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  803a2b:	76 20                	jbe    803a4d <__rodata_start+0x205>
+  803a2d:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  803a34:	72 65                	jb     803a9b <__rodata_start+0x253>
+  803a36:	63 76 69             	movsxd 0x69(%rsi),%esi
+  803a39:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803a3a:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  803a3e:	65 78 70             	gs js  803ab1 <__rodata_start+0x269>
+  803a41:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  803a46:	20 65 6e             	and    %ah,0x6e(%rbp)
+  803a49:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  803a4d:	20 66 69             	and    %ah,0x69(%rsi)
+  803a50:	6c                   	insb   (%dx),%es:(%rdi)
+  803a51:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  803a55:	20 66 72             	and    %ah,0x72(%rsi)
+  803a58:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  803a5d:	61                   	(bad)
+  803a5e:	63 65 20             	movsxd 0x20(%rbp),%esp
+  803a61:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803a62:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803a63:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  803a67:	6b 00 74             	imul   $0x74,(%rax),%eax
+  803a6a:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803a6b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803a6c:	20 6d 61             	and    %ch,0x61(%rbp)
+  803a6f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803a70:	79 20                	jns    803a92 <__rodata_start+0x24a>
+  803a72:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  803a79:	72 65                	jb     803ae0 <__rodata_start+0x298>
+  803a7b:	20 6f 70             	and    %ch,0x70(%rdi)
+  803a7e:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803a80:	00 66 69             	add    %ah,0x69(%rsi)
+  803a83:	6c                   	insb   (%dx),%es:(%rdi)
+  803a84:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  803a88:	20 62 6c             	and    %ah,0x6c(%rdx)
+  803a8b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803a8c:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  803a8f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803a90:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803a91:	74 20                	je     803ab3 <__rodata_start+0x26b>
+  803a93:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  803a95:	75 6e                	jne    803b05 <__rodata_start+0x2bd>
+  803a97:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  803a9b:	76 61                	jbe    803afe <__rodata_start+0x2b6>
+  803a9d:	6c                   	insb   (%dx),%es:(%rdi)
+  803a9e:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  803aa5:	00 
+  803aa6:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  803aad:	72 65                	jb     803b14 <__rodata_start+0x2cc>
+  803aaf:	61                   	(bad)
+  803ab0:	64 79 20             	fs jns 803ad3 <__rodata_start+0x28b>
+  803ab3:	65 78 69             	gs js  803b1f <__rodata_start+0x2d7>
+  803ab6:	73 74                	jae    803b2c <__rodata_start+0x2e4>
+  803ab8:	73 00                	jae    803aba <__rodata_start+0x272>
+  803aba:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803abb:	70 65                	jo     803b22 <__rodata_start+0x2da>
+  803abd:	72 61                	jb     803b20 <__rodata_start+0x2d8>
+  803abf:	74 69                	je     803b2a <__rodata_start+0x2e2>
+  803ac1:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803ac2:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803ac3:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  803ac6:	74 20                	je     803ae8 <__rodata_start+0x2a0>
+  803ac8:	73 75                	jae    803b3f <__rodata_start+0x2f7>
+  803aca:	70 70                	jo     803b3c <__rodata_start+0x2f4>
+  803acc:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803acd:	72 74                	jb     803b43 <__rodata_start+0x2fb>
+  803acf:	65 64 00 6f 70       	gs add %ch,%fs:0x70(%rdi)
+  803ad4:	65 72 61             	gs jb  803b38 <__rodata_start+0x2f0>
+  803ad7:	74 69                	je     803b42 <__rodata_start+0x2fa>
+  803ad9:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803ada:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803adb:	20 69 6e             	and    %ch,0x6e(%rcx)
+  803ade:	74 65                	je     803b45 <__rodata_start+0x2fd>
+  803ae0:	72 72                	jb     803b54 <__rodata_start+0x30c>
+  803ae2:	75 70                	jne    803b54 <__rodata_start+0x30c>
+  803ae4:	74 65                	je     803b4b <__rodata_start+0x303>
+  803ae6:	64 00 6e 6f          	add    %ch,%fs:0x6f(%rsi)
+  803aea:	74 20                	je     803b0c <__rodata_start+0x2c4>
+  803aec:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803aee:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803aef:	75 67                	jne    803b58 <__rodata_start+0x310>
+  803af1:	68 20 43 50 55       	push   $0x55504320
+  803af6:	20 74 69 6d          	and    %dh,0x6d(%rcx,%rbp,2)
+  803afa:	65 00 0f             	add    %cl,%gs:(%rdi)
+  803afd:	1f                   	(bad)
+  803afe:	40 00 f5             	add    %sil,%bpl
+  803b01:	05 80 00 00 00       	add    $0x80,%eax
+  803b06:	00 00                	add    %al,(%rax)
+  803b08:	36 0c 80             	ss or  $0x80,%al
+  803b0b:	00 00                	add    %al,(%rax)
+  803b0d:	00 00                	add    %al,(%rax)
+  803b0f:	00 26                	add    %ah,(%rsi)
+  803b11:	0c 80                	or     $0x80,%al
+  803b13:	00 00                	add    %al,(%rax)
+  803b15:	00 00                	add    %al,(%rax)
+  803b17:	00 36                	add    %dh,(%rsi)
+  803b19:	0c 80                	or     $0x80,%al
+  803b1b:	00 00                	add    %al,(%rax)
+  803b1d:	00 00                	add    %al,(%rax)
+  803b1f:	00 36                	add    %dh,(%rsi)
+  803b21:	0c 80                	or     $0x80,%al
+  803b23:	00 00                	add    %al,(%rax)
+  803b25:	00 00                	add    %al,(%rax)
+  803b27:	00 36                	add    %dh,(%rsi)
+  803b29:	0c 80                	or     $0x80,%al
+  803b2b:	00 00                	add    %al,(%rax)
+  803b2d:	00 00                	add    %al,(%rax)
+  803b2f:	00 36                	add    %dh,(%rsi)
+  803b31:	0c 80                	or     $0x80,%al
+  803b33:	00 00                	add    %al,(%rax)
+  803b35:	00 00                	add    %al,(%rax)
+  803b37:	00 14 06             	add    %dl,(%rsi,%rax,1)
+  803b3a:	80 00 00             	addb   $0x0,(%rax)
+  803b3d:	00 00                	add    %al,(%rax)
+  803b3f:	00 36                	add    %dh,(%rsi)
+  803b41:	0c 80                	or     $0x80,%al
+  803b43:	00 00                	add    %al,(%rax)
+  803b45:	00 00                	add    %al,(%rax)
+  803b47:	00 36                	add    %dh,(%rsi)
+  803b49:	0c 80                	or     $0x80,%al
+  803b4b:	00 00                	add    %al,(%rax)
+  803b4d:	00 00                	add    %al,(%rax)
+  803b4f:	00 08                	add    %cl,(%rax)
+  803b51:	06                   	(bad)
+  803b52:	80 00 00             	addb   $0x0,(%rax)
+  803b55:	00 00                	add    %al,(%rax)
+  803b57:	00 82 06 80 00 00    	add    %al,0x8006(%rdx)
+  803b5d:	00 00                	add    %al,(%rax)
+  803b5f:	00 36                	add    %dh,(%rsi)
+  803b61:	0c 80                	or     $0x80,%al
+  803b63:	00 00                	add    %al,(%rax)
+  803b65:	00 00                	add    %al,(%rax)
+  803b67:	00 08                	add    %cl,(%rax)
+  803b69:	06                   	(bad)
+  803b6a:	80 00 00             	addb   $0x0,(%rax)
+  803b6d:	00 00                	add    %al,(%rax)
+  803b6f:	00 4e 06             	add    %cl,0x6(%rsi)
+  803b72:	80 00 00             	addb   $0x0,(%rax)
+  803b75:	00 00                	add    %al,(%rax)
+  803b77:	00 4e 06             	add    %cl,0x6(%rsi)
+  803b7a:	80 00 00             	addb   $0x0,(%rax)
+  803b7d:	00 00                	add    %al,(%rax)
+  803b7f:	00 4e 06             	add    %cl,0x6(%rsi)
+  803b82:	80 00 00             	addb   $0x0,(%rax)
+  803b85:	00 00                	add    %al,(%rax)
+  803b87:	00 4e 06             	add    %cl,0x6(%rsi)
+  803b8a:	80 00 00             	addb   $0x0,(%rax)
+  803b8d:	00 00                	add    %al,(%rax)
+  803b8f:	00 4e 06             	add    %cl,0x6(%rsi)
+  803b92:	80 00 00             	addb   $0x0,(%rax)
+  803b95:	00 00                	add    %al,(%rax)
+  803b97:	00 4e 06             	add    %cl,0x6(%rsi)
+  803b9a:	80 00 00             	addb   $0x0,(%rax)
+  803b9d:	00 00                	add    %al,(%rax)
+  803b9f:	00 4e 06             	add    %cl,0x6(%rsi)
+  803ba2:	80 00 00             	addb   $0x0,(%rax)
+  803ba5:	00 00                	add    %al,(%rax)
+  803ba7:	00 4e 06             	add    %cl,0x6(%rsi)
+  803baa:	80 00 00             	addb   $0x0,(%rax)
+  803bad:	00 00                	add    %al,(%rax)
+  803baf:	00 4e 06             	add    %cl,0x6(%rsi)
+  803bb2:	80 00 00             	addb   $0x0,(%rax)
+  803bb5:	00 00                	add    %al,(%rax)
+  803bb7:	00 36                	add    %dh,(%rsi)
+  803bb9:	0c 80                	or     $0x80,%al
+  803bbb:	00 00                	add    %al,(%rax)
+  803bbd:	00 00                	add    %al,(%rax)
+  803bbf:	00 36                	add    %dh,(%rsi)
+  803bc1:	0c 80                	or     $0x80,%al
+  803bc3:	00 00                	add    %al,(%rax)
+  803bc5:	00 00                	add    %al,(%rax)
+  803bc7:	00 36                	add    %dh,(%rsi)
+  803bc9:	0c 80                	or     $0x80,%al
+  803bcb:	00 00                	add    %al,(%rax)
+  803bcd:	00 00                	add    %al,(%rax)
+  803bcf:	00 36                	add    %dh,(%rsi)
+  803bd1:	0c 80                	or     $0x80,%al
+  803bd3:	00 00                	add    %al,(%rax)
+  803bd5:	00 00                	add    %al,(%rax)
+  803bd7:	00 36                	add    %dh,(%rsi)
+  803bd9:	0c 80                	or     $0x80,%al
+  803bdb:	00 00                	add    %al,(%rax)
+  803bdd:	00 00                	add    %al,(%rax)
+  803bdf:	00 36                	add    %dh,(%rsi)
+  803be1:	0c 80                	or     $0x80,%al
+  803be3:	00 00                	add    %al,(%rax)
+  803be5:	00 00                	add    %al,(%rax)
+  803be7:	00 36                	add    %dh,(%rsi)
+  803be9:	0c 80                	or     $0x80,%al
+  803beb:	00 00                	add    %al,(%rax)
+  803bed:	00 00                	add    %al,(%rax)
+  803bef:	00 36                	add    %dh,(%rsi)
+  803bf1:	0c 80                	or     $0x80,%al
+  803bf3:	00 00                	add    %al,(%rax)
+  803bf5:	00 00                	add    %al,(%rax)
+  803bf7:	00 36                	add    %dh,(%rsi)
+  803bf9:	0c 80                	or     $0x80,%al
+  803bfb:	00 00                	add    %al,(%rax)
+  803bfd:	00 00                	add    %al,(%rax)
+  803bff:	00 36                	add    %dh,(%rsi)
+  803c01:	0c 80                	or     $0x80,%al
+  803c03:	00 00                	add    %al,(%rax)
+  803c05:	00 00                	add    %al,(%rax)
+  803c07:	00 36                	add    %dh,(%rsi)
+  803c09:	0c 80                	or     $0x80,%al
+  803c0b:	00 00                	add    %al,(%rax)
+  803c0d:	00 00                	add    %al,(%rax)
+  803c0f:	00 36                	add    %dh,(%rsi)
+  803c11:	0c 80                	or     $0x80,%al
+  803c13:	00 00                	add    %al,(%rax)
+  803c15:	00 00                	add    %al,(%rax)
+  803c17:	00 36                	add    %dh,(%rsi)
+  803c19:	0c 80                	or     $0x80,%al
+  803c1b:	00 00                	add    %al,(%rax)
+  803c1d:	00 00                	add    %al,(%rax)
+  803c1f:	00 36                	add    %dh,(%rsi)
+  803c21:	0c 80                	or     $0x80,%al
+  803c23:	00 00                	add    %al,(%rax)
+  803c25:	00 00                	add    %al,(%rax)
+  803c27:	00 36                	add    %dh,(%rsi)
+  803c29:	0c 80                	or     $0x80,%al
+  803c2b:	00 00                	add    %al,(%rax)
+  803c2d:	00 00                	add    %al,(%rax)
+  803c2f:	00 36                	add    %dh,(%rsi)
+  803c31:	0c 80                	or     $0x80,%al
+  803c33:	00 00                	add    %al,(%rax)
+  803c35:	00 00                	add    %al,(%rax)
+  803c37:	00 36                	add    %dh,(%rsi)
+  803c39:	0c 80                	or     $0x80,%al
+  803c3b:	00 00                	add    %al,(%rax)
+  803c3d:	00 00                	add    %al,(%rax)
+  803c3f:	00 36                	add    %dh,(%rsi)
+  803c41:	0c 80                	or     $0x80,%al
+  803c43:	00 00                	add    %al,(%rax)
+  803c45:	00 00                	add    %al,(%rax)
+  803c47:	00 36                	add    %dh,(%rsi)
+  803c49:	0c 80                	or     $0x80,%al
+  803c4b:	00 00                	add    %al,(%rax)
+  803c4d:	00 00                	add    %al,(%rax)
+  803c4f:	00 36                	add    %dh,(%rsi)
+  803c51:	0c 80                	or     $0x80,%al
+  803c53:	00 00                	add    %al,(%rax)
+  803c55:	00 00                	add    %al,(%rax)
+  803c57:	00 36                	add    %dh,(%rsi)
+  803c59:	0c 80                	or     $0x80,%al
+  803c5b:	00 00                	add    %al,(%rax)
+  803c5d:	00 00                	add    %al,(%rax)
+  803c5f:	00 36                	add    %dh,(%rsi)
+  803c61:	0c 80                	or     $0x80,%al
+  803c63:	00 00                	add    %al,(%rax)
+  803c65:	00 00                	add    %al,(%rax)
+  803c67:	00 36                	add    %dh,(%rsi)
+  803c69:	0c 80                	or     $0x80,%al
+  803c6b:	00 00                	add    %al,(%rax)
+  803c6d:	00 00                	add    %al,(%rax)
+  803c6f:	00 36                	add    %dh,(%rsi)
+  803c71:	0c 80                	or     $0x80,%al
+  803c73:	00 00                	add    %al,(%rax)
+  803c75:	00 00                	add    %al,(%rax)
+  803c77:	00 36                	add    %dh,(%rsi)
+  803c79:	0c 80                	or     $0x80,%al
+  803c7b:	00 00                	add    %al,(%rax)
+  803c7d:	00 00                	add    %al,(%rax)
+  803c7f:	00 36                	add    %dh,(%rsi)
+  803c81:	0c 80                	or     $0x80,%al
+  803c83:	00 00                	add    %al,(%rax)
+  803c85:	00 00                	add    %al,(%rax)
+  803c87:	00 36                	add    %dh,(%rsi)
+  803c89:	0c 80                	or     $0x80,%al
+  803c8b:	00 00                	add    %al,(%rax)
+  803c8d:	00 00                	add    %al,(%rax)
+  803c8f:	00 36                	add    %dh,(%rsi)
+  803c91:	0c 80                	or     $0x80,%al
+  803c93:	00 00                	add    %al,(%rax)
+  803c95:	00 00                	add    %al,(%rax)
+  803c97:	00 36                	add    %dh,(%rsi)
+  803c99:	0c 80                	or     $0x80,%al
+  803c9b:	00 00                	add    %al,(%rax)
+  803c9d:	00 00                	add    %al,(%rax)
+  803c9f:	00 36                	add    %dh,(%rsi)
+  803ca1:	0c 80                	or     $0x80,%al
+  803ca3:	00 00                	add    %al,(%rax)
+  803ca5:	00 00                	add    %al,(%rax)
+  803ca7:	00 59 0b             	add    %bl,0xb(%rcx)
+  803caa:	80 00 00             	addb   $0x0,(%rax)
+  803cad:	00 00                	add    %al,(%rax)
+  803caf:	00 36                	add    %dh,(%rsi)
+  803cb1:	0c 80                	or     $0x80,%al
+  803cb3:	00 00                	add    %al,(%rax)
+  803cb5:	00 00                	add    %al,(%rax)
+  803cb7:	00 36                	add    %dh,(%rsi)
+  803cb9:	0c 80                	or     $0x80,%al
+  803cbb:	00 00                	add    %al,(%rax)
+  803cbd:	00 00                	add    %al,(%rax)
+  803cbf:	00 36                	add    %dh,(%rsi)
+  803cc1:	0c 80                	or     $0x80,%al
+  803cc3:	00 00                	add    %al,(%rax)
+  803cc5:	00 00                	add    %al,(%rax)
+  803cc7:	00 36                	add    %dh,(%rsi)
+  803cc9:	0c 80                	or     $0x80,%al
+  803ccb:	00 00                	add    %al,(%rax)
+  803ccd:	00 00                	add    %al,(%rax)
+  803ccf:	00 36                	add    %dh,(%rsi)
+  803cd1:	0c 80                	or     $0x80,%al
+  803cd3:	00 00                	add    %al,(%rax)
+  803cd5:	00 00                	add    %al,(%rax)
+  803cd7:	00 36                	add    %dh,(%rsi)
+  803cd9:	0c 80                	or     $0x80,%al
+  803cdb:	00 00                	add    %al,(%rax)
+  803cdd:	00 00                	add    %al,(%rax)
+  803cdf:	00 36                	add    %dh,(%rsi)
+  803ce1:	0c 80                	or     $0x80,%al
+  803ce3:	00 00                	add    %al,(%rax)
+  803ce5:	00 00                	add    %al,(%rax)
+  803ce7:	00 36                	add    %dh,(%rsi)
+  803ce9:	0c 80                	or     $0x80,%al
+  803ceb:	00 00                	add    %al,(%rax)
+  803ced:	00 00                	add    %al,(%rax)
+  803cef:	00 36                	add    %dh,(%rsi)
+  803cf1:	0c 80                	or     $0x80,%al
+  803cf3:	00 00                	add    %al,(%rax)
+  803cf5:	00 00                	add    %al,(%rax)
+  803cf7:	00 36                	add    %dh,(%rsi)
+  803cf9:	0c 80                	or     $0x80,%al
+  803cfb:	00 00                	add    %al,(%rax)
+  803cfd:	00 00                	add    %al,(%rax)
+  803cff:	00 a5 06 80 00 00    	add    %ah,0x8006(%rbp)
+  803d05:	00 00                	add    %al,(%rax)
+  803d07:	00 74 08 80          	add    %dh,-0x80(%rax,%rcx,1)
+  803d0b:	00 00                	add    %al,(%rax)
+  803d0d:	00 00                	add    %al,(%rax)
+  803d0f:	00 36                	add    %dh,(%rsi)
+  803d11:	0c 80                	or     $0x80,%al
+  803d13:	00 00                	add    %al,(%rax)
+  803d15:	00 00                	add    %al,(%rax)
+  803d17:	00 36                	add    %dh,(%rsi)
+  803d19:	0c 80                	or     $0x80,%al
+  803d1b:	00 00                	add    %al,(%rax)
+  803d1d:	00 00                	add    %al,(%rax)
+  803d1f:	00 36                	add    %dh,(%rsi)
+  803d21:	0c 80                	or     $0x80,%al
+  803d23:	00 00                	add    %al,(%rax)
+  803d25:	00 00                	add    %al,(%rax)
+  803d27:	00 36                	add    %dh,(%rsi)
+  803d29:	0c 80                	or     $0x80,%al
+  803d2b:	00 00                	add    %al,(%rax)
+  803d2d:	00 00                	add    %al,(%rax)
+  803d2f:	00 d4                	add    %dl,%ah
+  803d31:	06                   	(bad)
+  803d32:	80 00 00             	addb   $0x0,(%rax)
+  803d35:	00 00                	add    %al,(%rax)
+  803d37:	00 36                	add    %dh,(%rsi)
+  803d39:	0c 80                	or     $0x80,%al
+  803d3b:	00 00                	add    %al,(%rax)
+  803d3d:	00 00                	add    %al,(%rax)
+  803d3f:	00 36                	add    %dh,(%rsi)
+  803d41:	0c 80                	or     $0x80,%al
+  803d43:	00 00                	add    %al,(%rax)
+  803d45:	00 00                	add    %al,(%rax)
+  803d47:	00 9a 06 80 00 00    	add    %bl,0x8006(%rdx)
+  803d4d:	00 00                	add    %al,(%rax)
+  803d4f:	00 36                	add    %dh,(%rsi)
+  803d51:	0c 80                	or     $0x80,%al
+  803d53:	00 00                	add    %al,(%rax)
+  803d55:	00 00                	add    %al,(%rax)
+  803d57:	00 36                	add    %dh,(%rsi)
+  803d59:	0c 80                	or     $0x80,%al
+  803d5b:	00 00                	add    %al,(%rax)
+  803d5d:	00 00                	add    %al,(%rax)
+  803d5f:	00 1c 0a             	add    %bl,(%rdx,%rcx,1)
+  803d62:	80 00 00             	addb   $0x0,(%rax)
+  803d65:	00 00                	add    %al,(%rax)
+  803d67:	00 e6                	add    %ah,%dh
+  803d69:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803d6f:	00 36                	add    %dh,(%rsi)
+  803d71:	0c 80                	or     $0x80,%al
+  803d73:	00 00                	add    %al,(%rax)
+  803d75:	00 00                	add    %al,(%rax)
+  803d77:	00 36                	add    %dh,(%rsi)
+  803d79:	0c 80                	or     $0x80,%al
+  803d7b:	00 00                	add    %al,(%rax)
+  803d7d:	00 00                	add    %al,(%rax)
+  803d7f:	00 6b 07             	add    %ch,0x7(%rbx)
+  803d82:	80 00 00             	addb   $0x0,(%rax)
+  803d85:	00 00                	add    %al,(%rax)
+  803d87:	00 36                	add    %dh,(%rsi)
+  803d89:	0c 80                	or     $0x80,%al
+  803d8b:	00 00                	add    %al,(%rax)
+  803d8d:	00 00                	add    %al,(%rax)
+  803d8f:	00 48 09             	add    %cl,0x9(%rax)
+  803d92:	80 00 00             	addb   $0x0,(%rax)
+  803d95:	00 00                	add    %al,(%rax)
+  803d97:	00 36                	add    %dh,(%rsi)
+  803d99:	0c 80                	or     $0x80,%al
+  803d9b:	00 00                	add    %al,(%rax)
+  803d9d:	00 00                	add    %al,(%rax)
+  803d9f:	00 36                	add    %dh,(%rsi)
+  803da1:	0c 80                	or     $0x80,%al
+  803da3:	00 00                	add    %al,(%rax)
+  803da5:	00 00                	add    %al,(%rax)
+  803da7:	00 59 0b             	add    %bl,0xb(%rcx)
+  803daa:	80 00 00             	addb   $0x0,(%rax)
+  803dad:	00 00                	add    %al,(%rax)
+  803daf:	00 36                	add    %dh,(%rsi)
+  803db1:	0c 80                	or     $0x80,%al
+  803db3:	00 00                	add    %al,(%rax)
+  803db5:	00 00                	add    %al,(%rax)
+  803db7:	00 fe                	add    %bh,%dh
+  803db9:	05 80 00 00 00       	add    $0x80,%eax
+	...
+
+0000000000803dc0 <error_string>:
+	...
+  803dc8:	75 39 80 00 00 00 00 00 87 39 80 00 00 00 00 00     u9.......9......
+  803dd8:	97 39 80 00 00 00 00 00 a9 39 80 00 00 00 00 00     .9.......9......
+  803de8:	b7 39 80 00 00 00 00 00 cb 39 80 00 00 00 00 00     .9.......9......
+  803df8:	e0 39 80 00 00 00 00 00 f3 39 80 00 00 00 00 00     .9.......9......
+  803e08:	05 3a 80 00 00 00 00 00 19 3a 80 00 00 00 00 00     .:.......:......
+  803e18:	29 3a 80 00 00 00 00 00 3c 3a 80 00 00 00 00 00     ):......<:......
+  803e28:	53 3a 80 00 00 00 00 00 69 3a 80 00 00 00 00 00     S:......i:......
+  803e38:	81 3a 80 00 00 00 00 00 99 3a 80 00 00 00 00 00     .:.......:......
+  803e48:	a6 3a 80 00 00 00 00 00 70 3e 80 00 00 00 00 00     .:......p>......
+  803e58:	ba 3a 80 00 00 00 00 00 d2 3a 80 00 00 00 00 00     .:.......:......
+  803e68:	e8 3a 80 00 00 00 00 00 66 69 6c 65 20 69 73 20     .:......file is 
+  803e78:	6e 6f 74 20 61 20 76 61 6c 69 64 20 65 78 65 63     not a valid exec
+  803e88:	75 74 61 62 6c 65 00 90 73 79 73 63 61 6c 6c 20     utable..syscall 
+  803e98:	25 7a 64 20 72 65 74 75 72 6e 65 64 20 25 7a 64     %zd returned %zd
+  803ea8:	20 28 3e 20 30 29 00 6c 69 62 2f 73 79 73 63 61      (> 0).lib/sysca
+  803eb8:	6c 6c 2e 63 00 0f 1f 00 5b 25 30 38 78 5d 20 75     ll.c....[%08x] u
+  803ec8:	6e 6b 6e 6f 77 6e 20 64 65 76 69 63 65 20 74 79     nknown device ty
+  803ed8:	70 65 20 25 64 0a 00 00 5b 25 30 38 78 5d 20 66     pe %d...[%08x] f
+  803ee8:	74 72 75 6e 63 61 74 65 20 25 64 20 2d 2d 20 62     truncate %d -- b
+  803ef8:	61 64 20 6d 6f 64 65 0a 00 5b 25 30 38 78 5d 20     ad mode..[%08x] 
+  803f08:	72 65 61 64 20 25 64 20 2d 2d 20 62 61 64 20 6d     read %d -- bad m
+  803f18:	6f 64 65 0a 00 5b 25 30 38 78 5d 20 77 72 69 74     ode..[%08x] writ
+  803f28:	65 20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65     e %d -- bad mode
+  803f38:	0a 00 66 0f 1f 44 00 00                             ..f..D..
+
+0000000000803f40 <devtab>:
+  803f40:	20 50 80 00 00 00 00 00 60 50 80 00 00 00 00 00      P......`P......
+  803f50:	a0 50 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .P..............
+  803f60:	57 72 6f 6e 67 20 45 4c 46 20 68 65 61 64 65 72     Wrong ELF header
+  803f70:	20 73 69 7a 65 20 6f 72 20 72 65 61 64 20 65 72      size or read er
+  803f80:	72 6f 72 3a 20 25 69 0a 00 00 00 00 00 00 00 00     ror: %i.........
+  803f90:	73 74 72 69 6e 67 5f 73 74 6f 72 65 20 3d 3d 20     string_store == 
+  803fa0:	28 63 68 61 72 20 2a 29 55 54 45 4d 50 20 2b 20     (char *)UTEMP + 
+  803fb0:	55 53 45 52 5f 53 54 41 43 4b 5f 53 49 5a 45 00     USER_STACK_SIZE.
+  803fc0:	45 6c 66 20 6d 61 67 69 63 20 25 30 38 78 20 77     Elf magic %08x w
+  803fd0:	61 6e 74 20 25 30 38 78 0a 00 61 73 73 65 72 74     ant %08x..assert
+  803fe0:	69 6f 6e 20 66 61 69 6c 65 64 3a 20 25 73 00 6c     ion failed: %s.l
+  803ff0:	69 62 2f 73 70 61 77 6e 2e 63 00 63 6f 70 79 5f     ib/spawn.c.copy_
+  804000:	73 68 61 72 65 64 5f 72 65 67 69 6f 6e 3a 20 25     shared_region: %
+  804010:	69 00 73 79 73 5f 65 6e 76 5f 73 65 74 5f 74 72     i.sys_env_set_tr
+  804020:	61 70 66 72 61 6d 65 3a 20 25 69 00 73 79 73 5f     apframe: %i.sys_
+  804030:	65 6e 76 5f 73 65 74 5f 73 74 61 74 75 73 3a 20     env_set_status: 
+  804040:	25 69 00 3c 70 69 70 65 3e 00 6c 69 62 2f 70 69     %i.<pipe>.lib/pi
+  804050:	70 65 2e 63 00 70 69 70 65 00 66 0f 1f 44 00 00     pe.c.pipe.f..D..
+  804060:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  804070:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  804080:	3d 20 32 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73 00     = 2.<cons>.cons.
+  804090:	73 79 73 5f 69 70 63 5f 74 72 79 5f 73 65 6e 64     sys_ipc_try_send
+  8040a0:	20 66 61 69 6c 65 64 3a 20 25 69 00 6c 69 62 2f      failed: %i.lib/
+  8040b0:	69 70 63 2e 63 00 66 2e 0f 1f 84 00 00 00 00 00     ipc.c.f.........
+  8040c0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8040d0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8040e0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8040f0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804100:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804110:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804120:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804130:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804140:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804150:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804160:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804170:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804180:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804190:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8041a0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8041b0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8041c0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8041d0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8041e0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8041f0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804200:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804210:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804220:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804230:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804240:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804250:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804260:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804270:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804280:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804290:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8042a0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8042b0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8042c0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8042d0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8042e0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8042f0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804300:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804310:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804320:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804330:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804340:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804350:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804360:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804370:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804380:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804390:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8043a0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8043b0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8043c0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8043d0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8043e0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8043f0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804400:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804410:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804420:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804430:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804440:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804450:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804460:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804470:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804480:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804490:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8044a0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8044b0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8044c0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8044d0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8044e0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8044f0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804500:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804510:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804520:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804530:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804540:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804550:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804560:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804570:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804580:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804590:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8045a0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8045b0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8045c0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8045d0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8045e0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8045f0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804600:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804610:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804620:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804630:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804640:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804650:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804660:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804670:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804680:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804690:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8046a0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8046b0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8046c0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8046d0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8046e0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8046f0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804700:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804710:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804720:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804730:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804740:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804750:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804760:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804770:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804780:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804790:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8047a0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8047b0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8047c0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8047d0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8047e0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8047f0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804800:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804810:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804820:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804830:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804840:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804850:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804860:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804870:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804880:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804890:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8048a0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8048b0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8048c0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8048d0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8048e0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8048f0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804900:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804910:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804920:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804930:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804940:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804950:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804960:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804970:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804980:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804990:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8049a0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8049b0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8049c0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8049d0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8049e0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8049f0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804a00:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804a10:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804a20:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804a30:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804a40:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804a50:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804a60:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804a70:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804a80:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804a90:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804aa0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804ab0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804ac0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804ad0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804ae0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804af0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804b00:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804b10:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804b20:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804b30:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804b40:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804b50:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804b60:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804b70:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804b80:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804b90:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804ba0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804bb0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804bc0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804bd0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804be0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804bf0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804c00:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804c10:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804c20:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804c30:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804c40:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804c50:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804c60:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804c70:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804c80:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804c90:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804ca0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804cb0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804cc0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804cd0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804ce0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804cf0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804d00:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804d10:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804d20:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804d30:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804d40:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804d50:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804d60:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804d70:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804d80:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804d90:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804da0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804db0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804dc0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804dd0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804de0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804df0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804e00:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804e10:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804e20:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804e30:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804e40:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804e50:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804e60:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804e70:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804e80:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804e90:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804ea0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804eb0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804ec0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804ed0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804ee0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804ef0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804f00:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804f10:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804f20:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804f30:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804f40:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804f50:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804f60:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804f70:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804f80:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804f90:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804fa0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804fb0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804fc0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804fd0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804fe0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804ff0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 0f 1f 40 00     ..f...........@.
@@ -0,0 +1,5443 @@
+
+obj/user/idle:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 2d 00 00 00       	call   800050 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+
+#include <inc/x86.h>
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	53                   	push   %rbx
+  80002a:	48 83 ec 08          	sub    $0x8,%rsp
+    binaryname = "idle";
+  80002e:	48 b8 a0 2c 80 00 00 	movabs $0x802ca0,%rax
+  800035:	00 00 00 
+  800038:	48 a3 00 40 80 00 00 	movabs %rax,0x804000
+  80003f:	00 00 00 
+     * Instead of busy-waiting like this,
+     * a better way would be to use the processor's HLT instruction
+     * to cause the processor to stop executing until the next interrupt -
+     * doing so allows the processor to conserve power more effectively. */
+    while (1) {
+        sys_yield();
+  800042:	48 bb 16 02 80 00 00 	movabs $0x800216,%rbx
+  800049:	00 00 00 
+  80004c:	ff d3                	call   *%rbx
+    while (1) {
+  80004e:	eb fc                	jmp    80004c <umain+0x27>
+
+0000000000800050 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800050:	55                   	push   %rbp
+  800051:	48 89 e5             	mov    %rsp,%rbp
+  800054:	41 56                	push   %r14
+  800056:	41 55                	push   %r13
+  800058:	41 54                	push   %r12
+  80005a:	53                   	push   %rbx
+  80005b:	41 89 fd             	mov    %edi,%r13d
+  80005e:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800061:	48 ba d8 40 80 00 00 	movabs $0x8040d8,%rdx
+  800068:	00 00 00 
+  80006b:	48 b8 d8 40 80 00 00 	movabs $0x8040d8,%rax
+  800072:	00 00 00 
+  800075:	48 39 c2             	cmp    %rax,%rdx
+  800078:	73 17                	jae    800091 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  80007a:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  80007d:	49 89 c4             	mov    %rax,%r12
+  800080:	48 83 c3 08          	add    $0x8,%rbx
+  800084:	b8 00 00 00 00       	mov    $0x0,%eax
+  800089:	ff 53 f8             	call   *-0x8(%rbx)
+  80008c:	4c 39 e3             	cmp    %r12,%rbx
+  80008f:	72 ef                	jb     800080 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+    envid_t this_env_id = sys_getenvid();
+  800091:	48 b8 e5 01 80 00 00 	movabs $0x8001e5,%rax
+  800098:	00 00 00 
+  80009b:	ff d0                	call   *%rax
+    thisenv = &((struct Env*)UENVS)[ENVX(this_env_id)];
+  80009d:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8000a2:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+  8000a9:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8000b0:	00 00 00 
+  8000b3:	48 01 d0             	add    %rdx,%rax
+  8000b6:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  8000bd:	00 00 00 
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8000c0:	45 85 ed             	test   %r13d,%r13d
+  8000c3:	7e 0d                	jle    8000d2 <libmain+0x82>
+  8000c5:	49 8b 06             	mov    (%r14),%rax
+  8000c8:	48 a3 00 40 80 00 00 	movabs %rax,0x804000
+  8000cf:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8000d2:	4c 89 f6             	mov    %r14,%rsi
+  8000d5:	44 89 ef             	mov    %r13d,%edi
+  8000d8:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8000df:	00 00 00 
+  8000e2:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8000e4:	48 b8 f9 00 80 00 00 	movabs $0x8000f9,%rax
+  8000eb:	00 00 00 
+  8000ee:	ff d0                	call   *%rax
+#endif
+}
+  8000f0:	5b                   	pop    %rbx
+  8000f1:	41 5c                	pop    %r12
+  8000f3:	41 5d                	pop    %r13
+  8000f5:	41 5e                	pop    %r14
+  8000f7:	5d                   	pop    %rbp
+  8000f8:	c3                   	ret
+
+00000000008000f9 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8000f9:	55                   	push   %rbp
+  8000fa:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  8000fd:	48 b8 39 09 80 00 00 	movabs $0x800939,%rax
+  800104:	00 00 00 
+  800107:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  800109:	bf 00 00 00 00       	mov    $0x0,%edi
+  80010e:	48 b8 7a 01 80 00 00 	movabs $0x80017a,%rax
+  800115:	00 00 00 
+  800118:	ff d0                	call   *%rax
+}
+  80011a:	5d                   	pop    %rbp
+  80011b:	c3                   	ret
+
+000000000080011c <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  80011c:	55                   	push   %rbp
+  80011d:	48 89 e5             	mov    %rsp,%rbp
+  800120:	53                   	push   %rbx
+  800121:	48 89 fa             	mov    %rdi,%rdx
+  800124:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  800127:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80012c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800131:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800136:	be 00 00 00 00       	mov    $0x0,%esi
+  80013b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800141:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  800143:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800147:	c9                   	leave
+  800148:	c3                   	ret
+
+0000000000800149 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  800149:	55                   	push   %rbp
+  80014a:	48 89 e5             	mov    %rsp,%rbp
+  80014d:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80014e:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800153:	ba 00 00 00 00       	mov    $0x0,%edx
+  800158:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80015d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800162:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800167:	be 00 00 00 00       	mov    $0x0,%esi
+  80016c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800172:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  800174:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800178:	c9                   	leave
+  800179:	c3                   	ret
+
+000000000080017a <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  80017a:	55                   	push   %rbp
+  80017b:	48 89 e5             	mov    %rsp,%rbp
+  80017e:	53                   	push   %rbx
+  80017f:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  800183:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800186:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80018b:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800190:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800195:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80019a:	be 00 00 00 00       	mov    $0x0,%esi
+  80019f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8001a5:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8001a7:	48 85 c0             	test   %rax,%rax
+  8001aa:	7f 06                	jg     8001b2 <sys_env_destroy+0x38>
+}
+  8001ac:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8001b0:	c9                   	leave
+  8001b1:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8001b2:	49 89 c0             	mov    %rax,%r8
+  8001b5:	b9 03 00 00 00       	mov    $0x3,%ecx
+  8001ba:	48 ba b0 2c 80 00 00 	movabs $0x802cb0,%rdx
+  8001c1:	00 00 00 
+  8001c4:	be 26 00 00 00       	mov    $0x26,%esi
+  8001c9:	48 bf cf 2c 80 00 00 	movabs $0x802ccf,%rdi
+  8001d0:	00 00 00 
+  8001d3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001d8:	49 b9 36 1c 80 00 00 	movabs $0x801c36,%r9
+  8001df:	00 00 00 
+  8001e2:	41 ff d1             	call   *%r9
+
+00000000008001e5 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  8001e5:	55                   	push   %rbp
+  8001e6:	48 89 e5             	mov    %rsp,%rbp
+  8001e9:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8001ea:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8001ef:	ba 00 00 00 00       	mov    $0x0,%edx
+  8001f4:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8001f9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8001fe:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800203:	be 00 00 00 00       	mov    $0x0,%esi
+  800208:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80020e:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  800210:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800214:	c9                   	leave
+  800215:	c3                   	ret
+
+0000000000800216 <sys_yield>:
+
+void
+sys_yield(void) {
+  800216:	55                   	push   %rbp
+  800217:	48 89 e5             	mov    %rsp,%rbp
+  80021a:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80021b:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800220:	ba 00 00 00 00       	mov    $0x0,%edx
+  800225:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80022a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80022f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800234:	be 00 00 00 00       	mov    $0x0,%esi
+  800239:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80023f:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  800241:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800245:	c9                   	leave
+  800246:	c3                   	ret
+
+0000000000800247 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  800247:	55                   	push   %rbp
+  800248:	48 89 e5             	mov    %rsp,%rbp
+  80024b:	53                   	push   %rbx
+  80024c:	48 89 fa             	mov    %rdi,%rdx
+  80024f:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  800252:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800257:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  80025e:	00 00 00 
+  800261:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800266:	be 00 00 00 00       	mov    $0x0,%esi
+  80026b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800271:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  800273:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800277:	c9                   	leave
+  800278:	c3                   	ret
+
+0000000000800279 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  800279:	55                   	push   %rbp
+  80027a:	48 89 e5             	mov    %rsp,%rbp
+  80027d:	53                   	push   %rbx
+  80027e:	49 89 f8             	mov    %rdi,%r8
+  800281:	48 89 d3             	mov    %rdx,%rbx
+  800284:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  800287:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80028c:	4c 89 c2             	mov    %r8,%rdx
+  80028f:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800292:	be 00 00 00 00       	mov    $0x0,%esi
+  800297:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80029d:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  80029f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8002a3:	c9                   	leave
+  8002a4:	c3                   	ret
+
+00000000008002a5 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  8002a5:	55                   	push   %rbp
+  8002a6:	48 89 e5             	mov    %rsp,%rbp
+  8002a9:	53                   	push   %rbx
+  8002aa:	48 83 ec 08          	sub    $0x8,%rsp
+  8002ae:	89 f8                	mov    %edi,%eax
+  8002b0:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  8002b3:	48 63 f9             	movslq %ecx,%rdi
+  8002b6:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8002b9:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8002be:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8002c1:	be 00 00 00 00       	mov    $0x0,%esi
+  8002c6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8002cc:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8002ce:	48 85 c0             	test   %rax,%rax
+  8002d1:	7f 06                	jg     8002d9 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  8002d3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8002d7:	c9                   	leave
+  8002d8:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8002d9:	49 89 c0             	mov    %rax,%r8
+  8002dc:	b9 04 00 00 00       	mov    $0x4,%ecx
+  8002e1:	48 ba b0 2c 80 00 00 	movabs $0x802cb0,%rdx
+  8002e8:	00 00 00 
+  8002eb:	be 26 00 00 00       	mov    $0x26,%esi
+  8002f0:	48 bf cf 2c 80 00 00 	movabs $0x802ccf,%rdi
+  8002f7:	00 00 00 
+  8002fa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002ff:	49 b9 36 1c 80 00 00 	movabs $0x801c36,%r9
+  800306:	00 00 00 
+  800309:	41 ff d1             	call   *%r9
+
+000000000080030c <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  80030c:	55                   	push   %rbp
+  80030d:	48 89 e5             	mov    %rsp,%rbp
+  800310:	53                   	push   %rbx
+  800311:	48 83 ec 08          	sub    $0x8,%rsp
+  800315:	89 f8                	mov    %edi,%eax
+  800317:	49 89 f2             	mov    %rsi,%r10
+  80031a:	48 89 cf             	mov    %rcx,%rdi
+  80031d:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  800320:	48 63 da             	movslq %edx,%rbx
+  800323:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800326:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80032b:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80032e:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  800331:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800333:	48 85 c0             	test   %rax,%rax
+  800336:	7f 06                	jg     80033e <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  800338:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80033c:	c9                   	leave
+  80033d:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80033e:	49 89 c0             	mov    %rax,%r8
+  800341:	b9 05 00 00 00       	mov    $0x5,%ecx
+  800346:	48 ba b0 2c 80 00 00 	movabs $0x802cb0,%rdx
+  80034d:	00 00 00 
+  800350:	be 26 00 00 00       	mov    $0x26,%esi
+  800355:	48 bf cf 2c 80 00 00 	movabs $0x802ccf,%rdi
+  80035c:	00 00 00 
+  80035f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800364:	49 b9 36 1c 80 00 00 	movabs $0x801c36,%r9
+  80036b:	00 00 00 
+  80036e:	41 ff d1             	call   *%r9
+
+0000000000800371 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  800371:	55                   	push   %rbp
+  800372:	48 89 e5             	mov    %rsp,%rbp
+  800375:	53                   	push   %rbx
+  800376:	48 83 ec 08          	sub    $0x8,%rsp
+  80037a:	48 89 f1             	mov    %rsi,%rcx
+  80037d:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  800380:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800383:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800388:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80038d:	be 00 00 00 00       	mov    $0x0,%esi
+  800392:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800398:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80039a:	48 85 c0             	test   %rax,%rax
+  80039d:	7f 06                	jg     8003a5 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  80039f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8003a3:	c9                   	leave
+  8003a4:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8003a5:	49 89 c0             	mov    %rax,%r8
+  8003a8:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8003ad:	48 ba b0 2c 80 00 00 	movabs $0x802cb0,%rdx
+  8003b4:	00 00 00 
+  8003b7:	be 26 00 00 00       	mov    $0x26,%esi
+  8003bc:	48 bf cf 2c 80 00 00 	movabs $0x802ccf,%rdi
+  8003c3:	00 00 00 
+  8003c6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003cb:	49 b9 36 1c 80 00 00 	movabs $0x801c36,%r9
+  8003d2:	00 00 00 
+  8003d5:	41 ff d1             	call   *%r9
+
+00000000008003d8 <sys_region_batch>:
+
+int
+sys_region_batch(const struct RegionOp *ops, size_t count) {
+  8003d8:	55                   	push   %rbp
+  8003d9:	48 89 e5             	mov    %rsp,%rbp
+  8003dc:	53                   	push   %rbx
+  8003dd:	48 83 ec 08          	sub    $0x8,%rsp
+  8003e1:	48 89 fa             	mov    %rdi,%rdx
+  8003e4:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8003e7:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8003ec:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8003f1:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8003f6:	be 00 00 00 00       	mov    $0x0,%esi
+  8003fb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800401:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800403:	48 85 c0             	test   %rax,%rax
+  800406:	7f 06                	jg     80040e <sys_region_batch+0x36>
+        else
+            platform_asan_unpoison(va, ops[i].size);
+    }
+#endif
+    return res;
+}
+  800408:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80040c:	c9                   	leave
+  80040d:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80040e:	49 89 c0             	mov    %rax,%r8
+  800411:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  800416:	48 ba b0 2c 80 00 00 	movabs $0x802cb0,%rdx
+  80041d:	00 00 00 
+  800420:	be 26 00 00 00       	mov    $0x26,%esi
+  800425:	48 bf cf 2c 80 00 00 	movabs $0x802ccf,%rdi
+  80042c:	00 00 00 
+  80042f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800434:	49 b9 36 1c 80 00 00 	movabs $0x801c36,%r9
+  80043b:	00 00 00 
+  80043e:	41 ff d1             	call   *%r9
+
+0000000000800441 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  800441:	55                   	push   %rbp
+  800442:	48 89 e5             	mov    %rsp,%rbp
+  800445:	53                   	push   %rbx
+  800446:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  80044a:	48 63 ce             	movslq %esi,%rcx
+  80044d:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800450:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800455:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80045a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80045f:	be 00 00 00 00       	mov    $0x0,%esi
+  800464:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80046a:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80046c:	48 85 c0             	test   %rax,%rax
+  80046f:	7f 06                	jg     800477 <sys_env_set_status+0x36>
+}
+  800471:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800475:	c9                   	leave
+  800476:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800477:	49 89 c0             	mov    %rax,%r8
+  80047a:	b9 09 00 00 00       	mov    $0x9,%ecx
+  80047f:	48 ba b0 2c 80 00 00 	movabs $0x802cb0,%rdx
+  800486:	00 00 00 
+  800489:	be 26 00 00 00       	mov    $0x26,%esi
+  80048e:	48 bf cf 2c 80 00 00 	movabs $0x802ccf,%rdi
+  800495:	00 00 00 
+  800498:	b8 00 00 00 00       	mov    $0x0,%eax
+  80049d:	49 b9 36 1c 80 00 00 	movabs $0x801c36,%r9
+  8004a4:	00 00 00 
+  8004a7:	41 ff d1             	call   *%r9
+
+00000000008004aa <sys_env_set_weight>:
+
+int
+sys_env_set_weight(envid_t envid, uint32_t weight) {
+  8004aa:	55                   	push   %rbp
+  8004ab:	48 89 e5             	mov    %rsp,%rbp
+  8004ae:	53                   	push   %rbx
+  8004af:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_weight, 1, envid, weight, 0, 0, 0, 0);
+  8004b3:	89 f1                	mov    %esi,%ecx
+  8004b5:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8004b8:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8004bd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8004c2:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8004c7:	be 00 00 00 00       	mov    $0x0,%esi
+  8004cc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8004d2:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8004d4:	48 85 c0             	test   %rax,%rax
+  8004d7:	7f 06                	jg     8004df <sys_env_set_weight+0x35>
+}
+  8004d9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8004dd:	c9                   	leave
+  8004de:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8004df:	49 89 c0             	mov    %rax,%r8
+  8004e2:	b9 10 00 00 00       	mov    $0x10,%ecx
+  8004e7:	48 ba b0 2c 80 00 00 	movabs $0x802cb0,%rdx
+  8004ee:	00 00 00 
+  8004f1:	be 26 00 00 00       	mov    $0x26,%esi
+  8004f6:	48 bf cf 2c 80 00 00 	movabs $0x802ccf,%rdi
+  8004fd:	00 00 00 
+  800500:	b8 00 00 00 00       	mov    $0x0,%eax
+  800505:	49 b9 36 1c 80 00 00 	movabs $0x801c36,%r9
+  80050c:	00 00 00 
+  80050f:	41 ff d1             	call   *%r9
+
+0000000000800512 <sys_env_set_rt>:
+
+int
+sys_env_set_rt(envid_t envid, uint64_t period, uint64_t budget, uint64_t deadline) {
+  800512:	55                   	push   %rbp
+  800513:	48 89 e5             	mov    %rsp,%rbp
+  800516:	53                   	push   %rbx
+  800517:	48 83 ec 08          	sub    $0x8,%rsp
+  80051b:	89 f8                	mov    %edi,%eax
+  80051d:	48 89 d3             	mov    %rdx,%rbx
+  800520:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_env_set_rt, 1, envid, period, budget, deadline, 0, 0);
+  800523:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800526:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80052b:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80052e:	be 00 00 00 00       	mov    $0x0,%esi
+  800533:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800539:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80053b:	48 85 c0             	test   %rax,%rax
+  80053e:	7f 06                	jg     800546 <sys_env_set_rt+0x34>
+}
+  800540:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800544:	c9                   	leave
+  800545:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800546:	49 89 c0             	mov    %rax,%r8
+  800549:	b9 11 00 00 00       	mov    $0x11,%ecx
+  80054e:	48 ba b0 2c 80 00 00 	movabs $0x802cb0,%rdx
+  800555:	00 00 00 
+  800558:	be 26 00 00 00       	mov    $0x26,%esi
+  80055d:	48 bf cf 2c 80 00 00 	movabs $0x802ccf,%rdi
+  800564:	00 00 00 
+  800567:	b8 00 00 00 00       	mov    $0x0,%eax
+  80056c:	49 b9 36 1c 80 00 00 	movabs $0x801c36,%r9
+  800573:	00 00 00 
+  800576:	41 ff d1             	call   *%r9
+
+0000000000800579 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  800579:	55                   	push   %rbp
+  80057a:	48 89 e5             	mov    %rsp,%rbp
+  80057d:	53                   	push   %rbx
+  80057e:	48 83 ec 08          	sub    $0x8,%rsp
+  800582:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  800585:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800588:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80058d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800592:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800597:	be 00 00 00 00       	mov    $0x0,%esi
+  80059c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8005a2:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8005a4:	48 85 c0             	test   %rax,%rax
+  8005a7:	7f 06                	jg     8005af <sys_env_set_trapframe+0x36>
+}
+  8005a9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8005ad:	c9                   	leave
+  8005ae:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8005af:	49 89 c0             	mov    %rax,%r8
+  8005b2:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  8005b7:	48 ba b0 2c 80 00 00 	movabs $0x802cb0,%rdx
+  8005be:	00 00 00 
+  8005c1:	be 26 00 00 00       	mov    $0x26,%esi
+  8005c6:	48 bf cf 2c 80 00 00 	movabs $0x802ccf,%rdi
+  8005cd:	00 00 00 
+  8005d0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005d5:	49 b9 36 1c 80 00 00 	movabs $0x801c36,%r9
+  8005dc:	00 00 00 
+  8005df:	41 ff d1             	call   *%r9
+
+00000000008005e2 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  8005e2:	55                   	push   %rbp
+  8005e3:	48 89 e5             	mov    %rsp,%rbp
+  8005e6:	53                   	push   %rbx
+  8005e7:	48 83 ec 08          	sub    $0x8,%rsp
+  8005eb:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  8005ee:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8005f1:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8005f6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8005fb:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800600:	be 00 00 00 00       	mov    $0x0,%esi
+  800605:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80060b:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80060d:	48 85 c0             	test   %rax,%rax
+  800610:	7f 06                	jg     800618 <sys_env_set_pgfault_upcall+0x36>
+}
+  800612:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800616:	c9                   	leave
+  800617:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800618:	49 89 c0             	mov    %rax,%r8
+  80061b:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  800620:	48 ba b0 2c 80 00 00 	movabs $0x802cb0,%rdx
+  800627:	00 00 00 
+  80062a:	be 26 00 00 00       	mov    $0x26,%esi
+  80062f:	48 bf cf 2c 80 00 00 	movabs $0x802ccf,%rdi
+  800636:	00 00 00 
+  800639:	b8 00 00 00 00       	mov    $0x0,%eax
+  80063e:	49 b9 36 1c 80 00 00 	movabs $0x801c36,%r9
+  800645:	00 00 00 
+  800648:	41 ff d1             	call   *%r9
+
+000000000080064b <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  80064b:	55                   	push   %rbp
+  80064c:	48 89 e5             	mov    %rsp,%rbp
+  80064f:	53                   	push   %rbx
+  800650:	89 f8                	mov    %edi,%eax
+  800652:	49 89 f1             	mov    %rsi,%r9
+  800655:	48 89 d3             	mov    %rdx,%rbx
+  800658:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  80065b:	49 63 f0             	movslq %r8d,%rsi
+  80065e:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800661:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800666:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800669:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80066f:	cd 30                	int    $0x30
+}
+  800671:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800675:	c9                   	leave
+  800676:	c3                   	ret
+
+0000000000800677 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  800677:	55                   	push   %rbp
+  800678:	48 89 e5             	mov    %rsp,%rbp
+  80067b:	53                   	push   %rbx
+  80067c:	48 83 ec 08          	sub    $0x8,%rsp
+  800680:	48 89 fa             	mov    %rdi,%rdx
+  800683:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  800686:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80068b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800690:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800695:	be 00 00 00 00       	mov    $0x0,%esi
+  80069a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8006a0:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8006a2:	48 85 c0             	test   %rax,%rax
+  8006a5:	7f 06                	jg     8006ad <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8006a7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8006ab:	c9                   	leave
+  8006ac:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8006ad:	49 89 c0             	mov    %rax,%r8
+  8006b0:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  8006b5:	48 ba b0 2c 80 00 00 	movabs $0x802cb0,%rdx
+  8006bc:	00 00 00 
+  8006bf:	be 26 00 00 00       	mov    $0x26,%esi
+  8006c4:	48 bf cf 2c 80 00 00 	movabs $0x802ccf,%rdi
+  8006cb:	00 00 00 
+  8006ce:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006d3:	49 b9 36 1c 80 00 00 	movabs $0x801c36,%r9
+  8006da:	00 00 00 
+  8006dd:	41 ff d1             	call   *%r9
+
+00000000008006e0 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8006e0:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8006e7:	ff ff ff 
+  8006ea:	48 01 f8             	add    %rdi,%rax
+  8006ed:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  8006f1:	c3                   	ret
+
+00000000008006f2 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8006f2:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8006f9:	ff ff ff 
+  8006fc:	48 01 f8             	add    %rdi,%rax
+  8006ff:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  800703:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  800709:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  80070d:	c3                   	ret
+
+000000000080070e <fd_alloc_from>:
+}
+
+/* Like fd_alloc(), but only considers fds starting from fdnum,
+ * so that several fds can be found before their pages are allocated */
+int
+fd_alloc_from(int fdnum, struct Fd **fd_store) {
+  80070e:	55                   	push   %rbp
+  80070f:	48 89 e5             	mov    %rsp,%rbp
+  800712:	41 57                	push   %r15
+  800714:	41 56                	push   %r14
+  800716:	41 55                	push   %r13
+  800718:	41 54                	push   %r12
+  80071a:	53                   	push   %rbx
+  80071b:	48 83 ec 08          	sub    $0x8,%rsp
+  80071f:	49 89 f7             	mov    %rsi,%r15
+    for (int i = MAX(fdnum, 0); i < MAXFD; i++) {
+  800722:	85 ff                	test   %edi,%edi
+  800724:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80072a:	44 0f 49 e7          	cmovns %edi,%r12d
+  80072e:	83 ff 1f             	cmp    $0x1f,%edi
+  800731:	7f 37                	jg     80076a <fd_alloc_from+0x5c>
+  800733:	49 63 dc             	movslq %r12d,%rbx
+  800736:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  80073d:	48 c1 e3 0c          	shl    $0xc,%rbx
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  800741:	49 be 17 18 80 00 00 	movabs $0x801817,%r14
+  800748:	00 00 00 
+        struct Fd *fd = INDEX2FD(i);
+  80074b:	49 89 dd             	mov    %rbx,%r13
+        if (!(get_prot(fd) & PROT_R)) {
+  80074e:	48 89 df             	mov    %rbx,%rdi
+  800751:	41 ff d6             	call   *%r14
+  800754:	83 e0 04             	and    $0x4,%eax
+  800757:	74 1c                	je     800775 <fd_alloc_from+0x67>
+    for (int i = MAX(fdnum, 0); i < MAXFD; i++) {
+  800759:	41 83 c4 01          	add    $0x1,%r12d
+  80075d:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  800764:	41 83 fc 1f          	cmp    $0x1f,%r12d
+  800768:	7e e1                	jle    80074b <fd_alloc_from+0x3d>
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  80076a:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  800770:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  800775:	4d 89 2f             	mov    %r13,(%r15)
+}
+  800778:	48 83 c4 08          	add    $0x8,%rsp
+  80077c:	5b                   	pop    %rbx
+  80077d:	41 5c                	pop    %r12
+  80077f:	41 5d                	pop    %r13
+  800781:	41 5e                	pop    %r14
+  800783:	41 5f                	pop    %r15
+  800785:	5d                   	pop    %rbp
+  800786:	c3                   	ret
+
+0000000000800787 <fd_alloc>:
+fd_alloc(struct Fd **fd_store) {
+  800787:	55                   	push   %rbp
+  800788:	48 89 e5             	mov    %rsp,%rbp
+  80078b:	48 89 fe             	mov    %rdi,%rsi
+    return fd_alloc_from(0, fd_store);
+  80078e:	bf 00 00 00 00       	mov    $0x0,%edi
+  800793:	48 b8 0e 07 80 00 00 	movabs $0x80070e,%rax
+  80079a:	00 00 00 
+  80079d:	ff d0                	call   *%rax
+}
+  80079f:	5d                   	pop    %rbp
+  8007a0:	c3                   	ret
+
+00000000008007a1 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  8007a1:	83 ff 1f             	cmp    $0x1f,%edi
+  8007a4:	77 39                	ja     8007df <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  8007a6:	55                   	push   %rbp
+  8007a7:	48 89 e5             	mov    %rsp,%rbp
+  8007aa:	41 54                	push   %r12
+  8007ac:	53                   	push   %rbx
+  8007ad:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  8007b0:	48 63 df             	movslq %edi,%rbx
+  8007b3:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  8007ba:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  8007be:	48 89 df             	mov    %rbx,%rdi
+  8007c1:	48 b8 17 18 80 00 00 	movabs $0x801817,%rax
+  8007c8:	00 00 00 
+  8007cb:	ff d0                	call   *%rax
+  8007cd:	a8 04                	test   $0x4,%al
+  8007cf:	74 14                	je     8007e5 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  8007d1:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  8007d5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8007da:	5b                   	pop    %rbx
+  8007db:	41 5c                	pop    %r12
+  8007dd:	5d                   	pop    %rbp
+  8007de:	c3                   	ret
+        return -E_INVAL;
+  8007df:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8007e4:	c3                   	ret
+        return -E_INVAL;
+  8007e5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8007ea:	eb ee                	jmp    8007da <fd_lookup+0x39>
+
+00000000008007ec <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  8007ec:	55                   	push   %rbp
+  8007ed:	48 89 e5             	mov    %rsp,%rbp
+  8007f0:	41 54                	push   %r12
+  8007f2:	53                   	push   %rbx
+  8007f3:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  8007f6:	48 b8 60 2d 80 00 00 	movabs $0x802d60,%rax
+  8007fd:	00 00 00 
+  800800:	48 bb 20 40 80 00 00 	movabs $0x804020,%rbx
+  800807:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  80080a:	39 3b                	cmp    %edi,(%rbx)
+  80080c:	74 47                	je     800855 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  80080e:	48 83 c0 08          	add    $0x8,%rax
+  800812:	48 8b 18             	mov    (%rax),%rbx
+  800815:	48 85 db             	test   %rbx,%rbx
+  800818:	75 f0                	jne    80080a <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  80081a:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  800821:	00 00 00 
+  800824:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+  80082a:	89 fa                	mov    %edi,%edx
+  80082c:	48 bf e0 2c 80 00 00 	movabs $0x802ce0,%rdi
+  800833:	00 00 00 
+  800836:	b8 00 00 00 00       	mov    $0x0,%eax
+  80083b:	48 b9 86 1d 80 00 00 	movabs $0x801d86,%rcx
+  800842:	00 00 00 
+  800845:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  800847:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  80084c:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  800850:	5b                   	pop    %rbx
+  800851:	41 5c                	pop    %r12
+  800853:	5d                   	pop    %rbp
+  800854:	c3                   	ret
+            return 0;
+  800855:	b8 00 00 00 00       	mov    $0x0,%eax
+  80085a:	eb f0                	jmp    80084c <dev_lookup+0x60>
+
+000000000080085c <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  80085c:	55                   	push   %rbp
+  80085d:	48 89 e5             	mov    %rsp,%rbp
+  800860:	41 55                	push   %r13
+  800862:	41 54                	push   %r12
+  800864:	53                   	push   %rbx
+  800865:	48 83 ec 18          	sub    $0x18,%rsp
+  800869:	48 89 fb             	mov    %rdi,%rbx
+  80086c:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80086f:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  800876:	ff ff ff 
+  800879:	48 01 df             	add    %rbx,%rdi
+  80087c:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  800880:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800884:	48 b8 a1 07 80 00 00 	movabs $0x8007a1,%rax
+  80088b:	00 00 00 
+  80088e:	ff d0                	call   *%rax
+  800890:	41 89 c5             	mov    %eax,%r13d
+  800893:	85 c0                	test   %eax,%eax
+  800895:	78 06                	js     80089d <fd_close+0x41>
+  800897:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  80089b:	74 1a                	je     8008b7 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  80089d:	45 84 e4             	test   %r12b,%r12b
+  8008a0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008a5:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  8008a9:	44 89 e8             	mov    %r13d,%eax
+  8008ac:	48 83 c4 18          	add    $0x18,%rsp
+  8008b0:	5b                   	pop    %rbx
+  8008b1:	41 5c                	pop    %r12
+  8008b3:	41 5d                	pop    %r13
+  8008b5:	5d                   	pop    %rbp
+  8008b6:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8008b7:	8b 3b                	mov    (%rbx),%edi
+  8008b9:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8008bd:	48 b8 ec 07 80 00 00 	movabs $0x8007ec,%rax
+  8008c4:	00 00 00 
+  8008c7:	ff d0                	call   *%rax
+  8008c9:	41 89 c5             	mov    %eax,%r13d
+  8008cc:	85 c0                	test   %eax,%eax
+  8008ce:	78 1b                	js     8008eb <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  8008d0:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8008d4:	48 8b 40 20          	mov    0x20(%rax),%rax
+  8008d8:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  8008de:	48 85 c0             	test   %rax,%rax
+  8008e1:	74 08                	je     8008eb <fd_close+0x8f>
+  8008e3:	48 89 df             	mov    %rbx,%rdi
+  8008e6:	ff d0                	call   *%rax
+  8008e8:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8008eb:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8008f0:	48 89 de             	mov    %rbx,%rsi
+  8008f3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8008f8:	48 b8 71 03 80 00 00 	movabs $0x800371,%rax
+  8008ff:	00 00 00 
+  800902:	ff d0                	call   *%rax
+    return res;
+  800904:	eb a3                	jmp    8008a9 <fd_close+0x4d>
+
+0000000000800906 <close>:
+
+int
+close(int fdnum) {
+  800906:	55                   	push   %rbp
+  800907:	48 89 e5             	mov    %rsp,%rbp
+  80090a:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  80090e:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  800912:	48 b8 a1 07 80 00 00 	movabs $0x8007a1,%rax
+  800919:	00 00 00 
+  80091c:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80091e:	85 c0                	test   %eax,%eax
+  800920:	78 15                	js     800937 <close+0x31>
+
+    return fd_close(fd, 1);
+  800922:	be 01 00 00 00       	mov    $0x1,%esi
+  800927:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80092b:	48 b8 5c 08 80 00 00 	movabs $0x80085c,%rax
+  800932:	00 00 00 
+  800935:	ff d0                	call   *%rax
+}
+  800937:	c9                   	leave
+  800938:	c3                   	ret
+
+0000000000800939 <close_all>:
+
+void
+close_all(void) {
+  800939:	55                   	push   %rbp
+  80093a:	48 89 e5             	mov    %rsp,%rbp
+  80093d:	41 54                	push   %r12
+  80093f:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  800940:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800945:	49 bc 06 09 80 00 00 	movabs $0x800906,%r12
+  80094c:	00 00 00 
+  80094f:	89 df                	mov    %ebx,%edi
+  800951:	41 ff d4             	call   *%r12
+  800954:	83 c3 01             	add    $0x1,%ebx
+  800957:	83 fb 20             	cmp    $0x20,%ebx
+  80095a:	75 f3                	jne    80094f <close_all+0x16>
+}
+  80095c:	5b                   	pop    %rbx
+  80095d:	41 5c                	pop    %r12
+  80095f:	5d                   	pop    %rbp
+  800960:	c3                   	ret
+
+0000000000800961 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  800961:	55                   	push   %rbp
+  800962:	48 89 e5             	mov    %rsp,%rbp
+  800965:	41 57                	push   %r15
+  800967:	41 56                	push   %r14
+  800969:	41 55                	push   %r13
+  80096b:	41 54                	push   %r12
+  80096d:	53                   	push   %rbx
+  80096e:	48 83 ec 18          	sub    $0x18,%rsp
+  800972:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  800975:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  800979:	48 b8 a1 07 80 00 00 	movabs $0x8007a1,%rax
+  800980:	00 00 00 
+  800983:	ff d0                	call   *%rax
+  800985:	89 c3                	mov    %eax,%ebx
+  800987:	85 c0                	test   %eax,%eax
+  800989:	0f 88 b8 00 00 00    	js     800a47 <dup+0xe6>
+    close(newfdnum);
+  80098f:	44 89 e7             	mov    %r12d,%edi
+  800992:	48 b8 06 09 80 00 00 	movabs $0x800906,%rax
+  800999:	00 00 00 
+  80099c:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  80099e:	4d 63 ec             	movslq %r12d,%r13
+  8009a1:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  8009a8:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  8009ac:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  8009b0:	4c 89 ff             	mov    %r15,%rdi
+  8009b3:	49 be f2 06 80 00 00 	movabs $0x8006f2,%r14
+  8009ba:	00 00 00 
+  8009bd:	41 ff d6             	call   *%r14
+  8009c0:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  8009c3:	4c 89 ef             	mov    %r13,%rdi
+  8009c6:	41 ff d6             	call   *%r14
+  8009c9:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  8009cc:	48 89 df             	mov    %rbx,%rdi
+  8009cf:	48 b8 17 18 80 00 00 	movabs $0x801817,%rax
+  8009d6:	00 00 00 
+  8009d9:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  8009db:	a8 04                	test   $0x4,%al
+  8009dd:	74 2b                	je     800a0a <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  8009df:	41 89 c1             	mov    %eax,%r9d
+  8009e2:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8009e8:	4c 89 f1             	mov    %r14,%rcx
+  8009eb:	ba 00 00 00 00       	mov    $0x0,%edx
+  8009f0:	48 89 de             	mov    %rbx,%rsi
+  8009f3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8009f8:	48 b8 0c 03 80 00 00 	movabs $0x80030c,%rax
+  8009ff:	00 00 00 
+  800a02:	ff d0                	call   *%rax
+  800a04:	89 c3                	mov    %eax,%ebx
+  800a06:	85 c0                	test   %eax,%eax
+  800a08:	78 4e                	js     800a58 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  800a0a:	4c 89 ff             	mov    %r15,%rdi
+  800a0d:	48 b8 17 18 80 00 00 	movabs $0x801817,%rax
+  800a14:	00 00 00 
+  800a17:	ff d0                	call   *%rax
+  800a19:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  800a1c:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  800a22:	4c 89 e9             	mov    %r13,%rcx
+  800a25:	ba 00 00 00 00       	mov    $0x0,%edx
+  800a2a:	4c 89 fe             	mov    %r15,%rsi
+  800a2d:	bf 00 00 00 00       	mov    $0x0,%edi
+  800a32:	48 b8 0c 03 80 00 00 	movabs $0x80030c,%rax
+  800a39:	00 00 00 
+  800a3c:	ff d0                	call   *%rax
+  800a3e:	89 c3                	mov    %eax,%ebx
+  800a40:	85 c0                	test   %eax,%eax
+  800a42:	78 14                	js     800a58 <dup+0xf7>
+
+    return newfdnum;
+  800a44:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  800a47:	89 d8                	mov    %ebx,%eax
+  800a49:	48 83 c4 18          	add    $0x18,%rsp
+  800a4d:	5b                   	pop    %rbx
+  800a4e:	41 5c                	pop    %r12
+  800a50:	41 5d                	pop    %r13
+  800a52:	41 5e                	pop    %r14
+  800a54:	41 5f                	pop    %r15
+  800a56:	5d                   	pop    %rbp
+  800a57:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  800a58:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800a5d:	4c 89 ee             	mov    %r13,%rsi
+  800a60:	bf 00 00 00 00       	mov    $0x0,%edi
+  800a65:	49 bc 71 03 80 00 00 	movabs $0x800371,%r12
+  800a6c:	00 00 00 
+  800a6f:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  800a72:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800a77:	4c 89 f6             	mov    %r14,%rsi
+  800a7a:	bf 00 00 00 00       	mov    $0x0,%edi
+  800a7f:	41 ff d4             	call   *%r12
+    return res;
+  800a82:	eb c3                	jmp    800a47 <dup+0xe6>
+
+0000000000800a84 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  800a84:	55                   	push   %rbp
+  800a85:	48 89 e5             	mov    %rsp,%rbp
+  800a88:	41 56                	push   %r14
+  800a8a:	41 55                	push   %r13
+  800a8c:	41 54                	push   %r12
+  800a8e:	53                   	push   %rbx
+  800a8f:	48 83 ec 10          	sub    $0x10,%rsp
+  800a93:	89 fb                	mov    %edi,%ebx
+  800a95:	49 89 f4             	mov    %rsi,%r12
+  800a98:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800a9b:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800a9f:	48 b8 a1 07 80 00 00 	movabs $0x8007a1,%rax
+  800aa6:	00 00 00 
+  800aa9:	ff d0                	call   *%rax
+  800aab:	85 c0                	test   %eax,%eax
+  800aad:	78 4c                	js     800afb <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800aaf:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  800ab3:	41 8b 3e             	mov    (%r14),%edi
+  800ab6:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800aba:	48 b8 ec 07 80 00 00 	movabs $0x8007ec,%rax
+  800ac1:	00 00 00 
+  800ac4:	ff d0                	call   *%rax
+  800ac6:	85 c0                	test   %eax,%eax
+  800ac8:	78 35                	js     800aff <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  800aca:	41 8b 46 08          	mov    0x8(%r14),%eax
+  800ace:	83 e0 03             	and    $0x3,%eax
+  800ad1:	83 f8 01             	cmp    $0x1,%eax
+  800ad4:	74 2d                	je     800b03 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  800ad6:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800ada:	48 8b 40 10          	mov    0x10(%rax),%rax
+  800ade:	48 85 c0             	test   %rax,%rax
+  800ae1:	74 56                	je     800b39 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  800ae3:	4c 89 ea             	mov    %r13,%rdx
+  800ae6:	4c 89 e6             	mov    %r12,%rsi
+  800ae9:	4c 89 f7             	mov    %r14,%rdi
+  800aec:	ff d0                	call   *%rax
+}
+  800aee:	48 83 c4 10          	add    $0x10,%rsp
+  800af2:	5b                   	pop    %rbx
+  800af3:	41 5c                	pop    %r12
+  800af5:	41 5d                	pop    %r13
+  800af7:	41 5e                	pop    %r14
+  800af9:	5d                   	pop    %rbp
+  800afa:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800afb:	48 98                	cltq
+  800afd:	eb ef                	jmp    800aee <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800aff:	48 98                	cltq
+  800b01:	eb eb                	jmp    800aee <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  800b03:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  800b0a:	00 00 00 
+  800b0d:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+  800b13:	89 da                	mov    %ebx,%edx
+  800b15:	48 bf 21 2d 80 00 00 	movabs $0x802d21,%rdi
+  800b1c:	00 00 00 
+  800b1f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b24:	48 b9 86 1d 80 00 00 	movabs $0x801d86,%rcx
+  800b2b:	00 00 00 
+  800b2e:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  800b30:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  800b37:	eb b5                	jmp    800aee <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  800b39:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  800b40:	eb ac                	jmp    800aee <read+0x6a>
+
+0000000000800b42 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  800b42:	55                   	push   %rbp
+  800b43:	48 89 e5             	mov    %rsp,%rbp
+  800b46:	41 57                	push   %r15
+  800b48:	41 56                	push   %r14
+  800b4a:	41 55                	push   %r13
+  800b4c:	41 54                	push   %r12
+  800b4e:	53                   	push   %rbx
+  800b4f:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  800b53:	48 85 d2             	test   %rdx,%rdx
+  800b56:	74 54                	je     800bac <readn+0x6a>
+  800b58:	41 89 fd             	mov    %edi,%r13d
+  800b5b:	49 89 f6             	mov    %rsi,%r14
+  800b5e:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  800b61:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  800b66:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  800b6b:	49 bf 84 0a 80 00 00 	movabs $0x800a84,%r15
+  800b72:	00 00 00 
+  800b75:	4c 89 e2             	mov    %r12,%rdx
+  800b78:	48 29 f2             	sub    %rsi,%rdx
+  800b7b:	4c 01 f6             	add    %r14,%rsi
+  800b7e:	44 89 ef             	mov    %r13d,%edi
+  800b81:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  800b84:	85 c0                	test   %eax,%eax
+  800b86:	78 20                	js     800ba8 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  800b88:	01 c3                	add    %eax,%ebx
+  800b8a:	85 c0                	test   %eax,%eax
+  800b8c:	74 08                	je     800b96 <readn+0x54>
+  800b8e:	48 63 f3             	movslq %ebx,%rsi
+  800b91:	4c 39 e6             	cmp    %r12,%rsi
+  800b94:	72 df                	jb     800b75 <readn+0x33>
+    }
+    return res;
+  800b96:	48 63 c3             	movslq %ebx,%rax
+}
+  800b99:	48 83 c4 08          	add    $0x8,%rsp
+  800b9d:	5b                   	pop    %rbx
+  800b9e:	41 5c                	pop    %r12
+  800ba0:	41 5d                	pop    %r13
+  800ba2:	41 5e                	pop    %r14
+  800ba4:	41 5f                	pop    %r15
+  800ba6:	5d                   	pop    %rbp
+  800ba7:	c3                   	ret
+        if (inc < 0) return inc;
+  800ba8:	48 98                	cltq
+  800baa:	eb ed                	jmp    800b99 <readn+0x57>
+    int inc = 1, res = 0;
+  800bac:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800bb1:	eb e3                	jmp    800b96 <readn+0x54>
+
+0000000000800bb3 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  800bb3:	55                   	push   %rbp
+  800bb4:	48 89 e5             	mov    %rsp,%rbp
+  800bb7:	41 56                	push   %r14
+  800bb9:	41 55                	push   %r13
+  800bbb:	41 54                	push   %r12
+  800bbd:	53                   	push   %rbx
+  800bbe:	48 83 ec 10          	sub    $0x10,%rsp
+  800bc2:	89 fb                	mov    %edi,%ebx
+  800bc4:	49 89 f4             	mov    %rsi,%r12
+  800bc7:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800bca:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800bce:	48 b8 a1 07 80 00 00 	movabs $0x8007a1,%rax
+  800bd5:	00 00 00 
+  800bd8:	ff d0                	call   *%rax
+  800bda:	85 c0                	test   %eax,%eax
+  800bdc:	78 47                	js     800c25 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800bde:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  800be2:	41 8b 3e             	mov    (%r14),%edi
+  800be5:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800be9:	48 b8 ec 07 80 00 00 	movabs $0x8007ec,%rax
+  800bf0:	00 00 00 
+  800bf3:	ff d0                	call   *%rax
+  800bf5:	85 c0                	test   %eax,%eax
+  800bf7:	78 30                	js     800c29 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800bf9:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  800bfe:	74 2d                	je     800c2d <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  800c00:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800c04:	48 8b 40 18          	mov    0x18(%rax),%rax
+  800c08:	48 85 c0             	test   %rax,%rax
+  800c0b:	74 56                	je     800c63 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  800c0d:	4c 89 ea             	mov    %r13,%rdx
+  800c10:	4c 89 e6             	mov    %r12,%rsi
+  800c13:	4c 89 f7             	mov    %r14,%rdi
+  800c16:	ff d0                	call   *%rax
+}
+  800c18:	48 83 c4 10          	add    $0x10,%rsp
+  800c1c:	5b                   	pop    %rbx
+  800c1d:	41 5c                	pop    %r12
+  800c1f:	41 5d                	pop    %r13
+  800c21:	41 5e                	pop    %r14
+  800c23:	5d                   	pop    %rbp
+  800c24:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800c25:	48 98                	cltq
+  800c27:	eb ef                	jmp    800c18 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800c29:	48 98                	cltq
+  800c2b:	eb eb                	jmp    800c18 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  800c2d:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  800c34:	00 00 00 
+  800c37:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+  800c3d:	89 da                	mov    %ebx,%edx
+  800c3f:	48 bf 3d 2d 80 00 00 	movabs $0x802d3d,%rdi
+  800c46:	00 00 00 
+  800c49:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c4e:	48 b9 86 1d 80 00 00 	movabs $0x801d86,%rcx
+  800c55:	00 00 00 
+  800c58:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  800c5a:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  800c61:	eb b5                	jmp    800c18 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  800c63:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  800c6a:	eb ac                	jmp    800c18 <write+0x65>
+
+0000000000800c6c <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  800c6c:	55                   	push   %rbp
+  800c6d:	48 89 e5             	mov    %rsp,%rbp
+  800c70:	53                   	push   %rbx
+  800c71:	48 83 ec 18          	sub    $0x18,%rsp
+  800c75:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800c77:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800c7b:	48 b8 a1 07 80 00 00 	movabs $0x8007a1,%rax
+  800c82:	00 00 00 
+  800c85:	ff d0                	call   *%rax
+  800c87:	85 c0                	test   %eax,%eax
+  800c89:	78 0c                	js     800c97 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  800c8b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800c8f:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  800c92:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800c97:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800c9b:	c9                   	leave
+  800c9c:	c3                   	ret
+
+0000000000800c9d <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  800c9d:	55                   	push   %rbp
+  800c9e:	48 89 e5             	mov    %rsp,%rbp
+  800ca1:	41 55                	push   %r13
+  800ca3:	41 54                	push   %r12
+  800ca5:	53                   	push   %rbx
+  800ca6:	48 83 ec 18          	sub    $0x18,%rsp
+  800caa:	89 fb                	mov    %edi,%ebx
+  800cac:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800caf:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800cb3:	48 b8 a1 07 80 00 00 	movabs $0x8007a1,%rax
+  800cba:	00 00 00 
+  800cbd:	ff d0                	call   *%rax
+  800cbf:	85 c0                	test   %eax,%eax
+  800cc1:	78 38                	js     800cfb <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800cc3:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  800cc7:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  800ccb:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800ccf:	48 b8 ec 07 80 00 00 	movabs $0x8007ec,%rax
+  800cd6:	00 00 00 
+  800cd9:	ff d0                	call   *%rax
+  800cdb:	85 c0                	test   %eax,%eax
+  800cdd:	78 1c                	js     800cfb <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800cdf:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  800ce4:	74 20                	je     800d06 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  800ce6:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800cea:	48 8b 40 30          	mov    0x30(%rax),%rax
+  800cee:	48 85 c0             	test   %rax,%rax
+  800cf1:	74 47                	je     800d3a <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  800cf3:	44 89 e6             	mov    %r12d,%esi
+  800cf6:	4c 89 ef             	mov    %r13,%rdi
+  800cf9:	ff d0                	call   *%rax
+}
+  800cfb:	48 83 c4 18          	add    $0x18,%rsp
+  800cff:	5b                   	pop    %rbx
+  800d00:	41 5c                	pop    %r12
+  800d02:	41 5d                	pop    %r13
+  800d04:	5d                   	pop    %rbp
+  800d05:	c3                   	ret
+                thisenv->env_id, fdnum);
+  800d06:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  800d0d:	00 00 00 
+  800d10:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  800d16:	89 da                	mov    %ebx,%edx
+  800d18:	48 bf 00 2d 80 00 00 	movabs $0x802d00,%rdi
+  800d1f:	00 00 00 
+  800d22:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d27:	48 b9 86 1d 80 00 00 	movabs $0x801d86,%rcx
+  800d2e:	00 00 00 
+  800d31:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  800d33:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800d38:	eb c1                	jmp    800cfb <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  800d3a:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  800d3f:	eb ba                	jmp    800cfb <ftruncate+0x5e>
+
+0000000000800d41 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  800d41:	55                   	push   %rbp
+  800d42:	48 89 e5             	mov    %rsp,%rbp
+  800d45:	41 54                	push   %r12
+  800d47:	53                   	push   %rbx
+  800d48:	48 83 ec 10          	sub    $0x10,%rsp
+  800d4c:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800d4f:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800d53:	48 b8 a1 07 80 00 00 	movabs $0x8007a1,%rax
+  800d5a:	00 00 00 
+  800d5d:	ff d0                	call   *%rax
+  800d5f:	85 c0                	test   %eax,%eax
+  800d61:	78 4e                	js     800db1 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800d63:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  800d67:	41 8b 3c 24          	mov    (%r12),%edi
+  800d6b:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  800d6f:	48 b8 ec 07 80 00 00 	movabs $0x8007ec,%rax
+  800d76:	00 00 00 
+  800d79:	ff d0                	call   *%rax
+  800d7b:	85 c0                	test   %eax,%eax
+  800d7d:	78 32                	js     800db1 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  800d7f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800d83:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  800d88:	74 30                	je     800dba <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  800d8a:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  800d8d:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  800d94:	00 00 00 
+    stat->st_isdir = 0;
+  800d97:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  800d9e:	00 00 00 
+    stat->st_dev = dev;
+  800da1:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  800da8:	48 89 de             	mov    %rbx,%rsi
+  800dab:	4c 89 e7             	mov    %r12,%rdi
+  800dae:	ff 50 28             	call   *0x28(%rax)
+}
+  800db1:	48 83 c4 10          	add    $0x10,%rsp
+  800db5:	5b                   	pop    %rbx
+  800db6:	41 5c                	pop    %r12
+  800db8:	5d                   	pop    %rbp
+  800db9:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  800dba:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  800dbf:	eb f0                	jmp    800db1 <fstat+0x70>
+
+0000000000800dc1 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  800dc1:	55                   	push   %rbp
+  800dc2:	48 89 e5             	mov    %rsp,%rbp
+  800dc5:	41 54                	push   %r12
+  800dc7:	53                   	push   %rbx
+  800dc8:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  800dcb:	be 00 00 00 00       	mov    $0x0,%esi
+  800dd0:	48 b8 a4 11 80 00 00 	movabs $0x8011a4,%rax
+  800dd7:	00 00 00 
+  800dda:	ff d0                	call   *%rax
+  800ddc:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  800dde:	85 c0                	test   %eax,%eax
+  800de0:	78 25                	js     800e07 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  800de2:	4c 89 e6             	mov    %r12,%rsi
+  800de5:	89 c7                	mov    %eax,%edi
+  800de7:	48 b8 41 0d 80 00 00 	movabs $0x800d41,%rax
+  800dee:	00 00 00 
+  800df1:	ff d0                	call   *%rax
+  800df3:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  800df6:	89 df                	mov    %ebx,%edi
+  800df8:	48 b8 06 09 80 00 00 	movabs $0x800906,%rax
+  800dff:	00 00 00 
+  800e02:	ff d0                	call   *%rax
+
+    return res;
+  800e04:	44 89 e3             	mov    %r12d,%ebx
+}
+  800e07:	89 d8                	mov    %ebx,%eax
+  800e09:	5b                   	pop    %rbx
+  800e0a:	41 5c                	pop    %r12
+  800e0c:	5d                   	pop    %rbp
+  800e0d:	c3                   	ret
+
+0000000000800e0e <fsipc>:
+ * response may be written back to fsipcbuf.
+ * type: request code, passed as the simple integer IPC value.
+ * dstva: virtual address at which to receive reply page, 0 if none.
+ * Returns result from the file server. */
+static int
+fsipc(unsigned type, void *dstva) {
+  800e0e:	55                   	push   %rbp
+  800e0f:	48 89 e5             	mov    %rsp,%rbp
+  800e12:	41 54                	push   %r12
+  800e14:	53                   	push   %rbx
+  800e15:	48 83 ec 10          	sub    $0x10,%rsp
+  800e19:	41 89 fc             	mov    %edi,%r12d
+  800e1c:	48 89 f3             	mov    %rsi,%rbx
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  800e1f:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  800e26:	00 00 00 
+  800e29:	83 38 00             	cmpl   $0x0,(%rax)
+  800e2c:	74 5e                	je     800e8c <fsipc+0x7e>
+    if (debug) {
+        cprintf("[%08x] fsipc %d %08x\n",
+                thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+    }
+
+    ipc_send(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW);
+  800e2e:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  800e34:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  800e39:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  800e40:	00 00 00 
+  800e43:	44 89 e6             	mov    %r12d,%esi
+  800e46:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  800e4d:	00 00 00 
+  800e50:	8b 38                	mov    (%rax),%edi
+  800e52:	48 b8 a7 2b 80 00 00 	movabs $0x802ba7,%rax
+  800e59:	00 00 00 
+  800e5c:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  800e5e:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  800e65:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  800e66:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e6b:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  800e6f:	48 89 de             	mov    %rbx,%rsi
+  800e72:	bf 00 00 00 00       	mov    $0x0,%edi
+  800e77:	48 b8 d2 2a 80 00 00 	movabs $0x802ad2,%rax
+  800e7e:	00 00 00 
+  800e81:	ff d0                	call   *%rax
+}
+  800e83:	48 83 c4 10          	add    $0x10,%rsp
+  800e87:	5b                   	pop    %rbx
+  800e88:	41 5c                	pop    %r12
+  800e8a:	5d                   	pop    %rbp
+  800e8b:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  800e8c:	bf 03 00 00 00       	mov    $0x3,%edi
+  800e91:	48 b8 4a 2c 80 00 00 	movabs $0x802c4a,%rax
+  800e98:	00 00 00 
+  800e9b:	ff d0                	call   *%rax
+  800e9d:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  800ea4:	00 00 
+  800ea6:	eb 86                	jmp    800e2e <fsipc+0x20>
+
+0000000000800ea8 <devfile_trunc>:
+    return 0;
+}
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  800ea8:	55                   	push   %rbp
+  800ea9:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  800eac:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  800eb3:	00 00 00 
+  800eb6:	8b 57 0c             	mov    0xc(%rdi),%edx
+  800eb9:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  800ebb:	89 70 04             	mov    %esi,0x4(%rax)
+
+    return fsipc(FSREQ_SET_SIZE, NULL);
+  800ebe:	be 00 00 00 00       	mov    $0x0,%esi
+  800ec3:	bf 02 00 00 00       	mov    $0x2,%edi
+  800ec8:	48 b8 0e 0e 80 00 00 	movabs $0x800e0e,%rax
+  800ecf:	00 00 00 
+  800ed2:	ff d0                	call   *%rax
+}
+  800ed4:	5d                   	pop    %rbp
+  800ed5:	c3                   	ret
+
+0000000000800ed6 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  800ed6:	55                   	push   %rbp
+  800ed7:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  800eda:	8b 47 0c             	mov    0xc(%rdi),%eax
+  800edd:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  800ee4:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  800ee6:	be 00 00 00 00       	mov    $0x0,%esi
+  800eeb:	bf 06 00 00 00       	mov    $0x6,%edi
+  800ef0:	48 b8 0e 0e 80 00 00 	movabs $0x800e0e,%rax
+  800ef7:	00 00 00 
+  800efa:	ff d0                	call   *%rax
+}
+  800efc:	5d                   	pop    %rbp
+  800efd:	c3                   	ret
+
+0000000000800efe <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  800efe:	55                   	push   %rbp
+  800eff:	48 89 e5             	mov    %rsp,%rbp
+  800f02:	41 54                	push   %r12
+  800f04:	53                   	push   %rbx
+  800f05:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  800f08:	8b 47 0c             	mov    0xc(%rdi),%eax
+  800f0b:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  800f12:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  800f14:	be 00 00 00 00       	mov    $0x0,%esi
+  800f19:	bf 05 00 00 00       	mov    $0x5,%edi
+  800f1e:	48 b8 0e 0e 80 00 00 	movabs $0x800e0e,%rax
+  800f25:	00 00 00 
+  800f28:	ff d0                	call   *%rax
+    if (res < 0) {
+  800f2a:	85 c0                	test   %eax,%eax
+  800f2c:	78 3d                	js     800f6b <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  800f2e:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  800f35:	00 00 00 
+  800f38:	4c 89 e6             	mov    %r12,%rsi
+  800f3b:	48 89 df             	mov    %rbx,%rdi
+  800f3e:	48 b8 ab 26 80 00 00 	movabs $0x8026ab,%rax
+  800f45:	00 00 00 
+  800f48:	ff d0                	call   *%rax
+    st->st_size  = fsipcbuf.statRet.ret_size;
+  800f4a:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  800f51:	00 
+  800f52:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  800f58:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  800f5f:	00 
+  800f60:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  800f66:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800f6b:	5b                   	pop    %rbx
+  800f6c:	41 5c                	pop    %r12
+  800f6e:	5d                   	pop    %rbp
+  800f6f:	c3                   	ret
+
+0000000000800f70 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  800f70:	55                   	push   %rbp
+  800f71:	48 89 e5             	mov    %rsp,%rbp
+  800f74:	41 57                	push   %r15
+  800f76:	41 56                	push   %r14
+  800f78:	41 55                	push   %r13
+  800f7a:	41 54                	push   %r12
+  800f7c:	53                   	push   %rbx
+  800f7d:	48 83 ec 18          	sub    $0x18,%rsp
+  800f81:	49 89 fe             	mov    %rdi,%r14
+  800f84:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+  800f88:	48 89 d3             	mov    %rdx,%rbx
+    while (n > sizeof(fsipcbuf.write.req_buf))
+  800f8b:	48 81 fa f0 0f 00 00 	cmp    $0xff0,%rdx
+  800f92:	0f 86 e4 00 00 00    	jbe    80107c <devfile_write+0x10c>
+  800f98:	49 89 f4             	mov    %rsi,%r12
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  800f9b:	49 bd 00 60 80 00 00 	movabs $0x806000,%r13
+  800fa2:	00 00 00 
+        memcpy(fsipcbuf.write.req_buf, buf, sizeof(fsipcbuf.write.req_buf));
+  800fa5:	49 bf 0c 29 80 00 00 	movabs $0x80290c,%r15
+  800fac:	00 00 00 
+  800faf:	eb 03                	jmp    800fb4 <devfile_write+0x44>
+        buf += sizeof(fsipcbuf.write.req_buf);
+  800fb1:	49 89 f4             	mov    %rsi,%r12
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  800fb4:	41 8b 46 0c          	mov    0xc(%r14),%eax
+  800fb8:	41 89 45 00          	mov    %eax,0x0(%r13)
+        fsipcbuf.write.req_n      = sizeof(fsipcbuf.write.req_buf);
+  800fbc:	49 c7 45 08 f0 0f 00 	movq   $0xff0,0x8(%r13)
+  800fc3:	00 
+        memcpy(fsipcbuf.write.req_buf, buf, sizeof(fsipcbuf.write.req_buf));
+  800fc4:	ba f0 0f 00 00       	mov    $0xff0,%edx
+  800fc9:	4c 89 e6             	mov    %r12,%rsi
+  800fcc:	48 bf 10 60 80 00 00 	movabs $0x806010,%rdi
+  800fd3:	00 00 00 
+  800fd6:	41 ff d7             	call   *%r15
+        ssize_t res = fsipc(FSREQ_WRITE, NULL);
+  800fd9:	be 00 00 00 00       	mov    $0x0,%esi
+  800fde:	bf 04 00 00 00       	mov    $0x4,%edi
+  800fe3:	48 b8 0e 0e 80 00 00 	movabs $0x800e0e,%rax
+  800fea:	00 00 00 
+  800fed:	ff d0                	call   *%rax
+  800fef:	48 63 d0             	movslq %eax,%rdx
+        if (res < 0 || res < sizeof(fsipcbuf.write.req_buf))
+  800ff2:	3d ef 0f 00 00       	cmp    $0xfef,%eax
+  800ff7:	7e 71                	jle    80106a <devfile_write+0xfa>
+        buf += sizeof(fsipcbuf.write.req_buf);
+  800ff9:	49 8d b4 24 f0 0f 00 	lea    0xff0(%r12),%rsi
+  801000:	00 
+        n -= sizeof(fsipcbuf.write.req_buf);
+  801001:	48 81 eb f0 0f 00 00 	sub    $0xff0,%rbx
+    while (n > sizeof(fsipcbuf.write.req_buf))
+  801008:	48 81 fb f0 0f 00 00 	cmp    $0xff0,%rbx
+  80100f:	77 a0                	ja     800fb1 <devfile_write+0x41>
+        written += sizeof(fsipcbuf.write.req_buf);
+  801011:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801015:	49 29 c4             	sub    %rax,%r12
+  801018:	4d 8d a4 24 f0 0f 00 	lea    0xff0(%r12),%r12
+  80101f:	00 
+    fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801020:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  801027:	00 00 00 
+  80102a:	41 8b 56 0c          	mov    0xc(%r14),%edx
+  80102e:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.write.req_n      = n;
+  801030:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    memcpy(fsipcbuf.write.req_buf, buf, n);
+  801034:	48 89 da             	mov    %rbx,%rdx
+  801037:	48 8d 78 10          	lea    0x10(%rax),%rdi
+  80103b:	48 b8 0c 29 80 00 00 	movabs $0x80290c,%rax
+  801042:	00 00 00 
+  801045:	ff d0                	call   *%rax
+    ssize_t res = fsipc(FSREQ_WRITE, NULL);
+  801047:	be 00 00 00 00       	mov    $0x0,%esi
+  80104c:	bf 04 00 00 00       	mov    $0x4,%edi
+  801051:	48 b8 0e 0e 80 00 00 	movabs $0x800e0e,%rax
+  801058:	00 00 00 
+  80105b:	ff d0                	call   *%rax
+  80105d:	48 63 d0             	movslq %eax,%rdx
+    written += res;
+  801060:	49 01 d4             	add    %rdx,%r12
+  801063:	48 85 d2             	test   %rdx,%rdx
+  801066:	49 0f 49 d4          	cmovns %r12,%rdx
+}
+  80106a:	48 89 d0             	mov    %rdx,%rax
+  80106d:	48 83 c4 18          	add    $0x18,%rsp
+  801071:	5b                   	pop    %rbx
+  801072:	41 5c                	pop    %r12
+  801074:	41 5d                	pop    %r13
+  801076:	41 5e                	pop    %r14
+  801078:	41 5f                	pop    %r15
+  80107a:	5d                   	pop    %rbp
+  80107b:	c3                   	ret
+    while (n > sizeof(fsipcbuf.write.req_buf))
+  80107c:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+    ssize_t written = 0;
+  801080:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  801086:	eb 98                	jmp    801020 <devfile_write+0xb0>
+
+0000000000801088 <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  801088:	55                   	push   %rbp
+  801089:	48 89 e5             	mov    %rsp,%rbp
+  80108c:	41 57                	push   %r15
+  80108e:	41 56                	push   %r14
+  801090:	41 55                	push   %r13
+  801092:	41 54                	push   %r12
+  801094:	53                   	push   %rbx
+  801095:	48 83 ec 18          	sub    $0x18,%rsp
+  801099:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  80109d:	49 89 f6             	mov    %rsi,%r14
+  8010a0:	49 89 d4             	mov    %rdx,%r12
+    while (n > sizeof(fsipcbuf.readRet.ret_buf))
+  8010a3:	48 81 fa 00 10 00 00 	cmp    $0x1000,%rdx
+  8010aa:	0f 86 ea 00 00 00    	jbe    80119a <devfile_read+0x112>
+    ssize_t readsz = 0;
+  8010b0:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  8010b7:	00 
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8010b8:	49 bf 00 60 80 00 00 	movabs $0x806000,%r15
+  8010bf:	00 00 00 
+  8010c2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8010c6:	8b 40 0c             	mov    0xc(%rax),%eax
+  8010c9:	41 89 07             	mov    %eax,(%r15)
+        fsipcbuf.read.req_n = sizeof(fsipcbuf.readRet.ret_buf);
+  8010cc:	49 c7 47 08 00 10 00 	movq   $0x1000,0x8(%r15)
+  8010d3:	00 
+        ssize_t res = fsipc(FSREQ_READ, NULL);
+  8010d4:	be 00 00 00 00       	mov    $0x0,%esi
+  8010d9:	bf 03 00 00 00       	mov    $0x3,%edi
+  8010de:	48 b8 0e 0e 80 00 00 	movabs $0x800e0e,%rax
+  8010e5:	00 00 00 
+  8010e8:	ff d0                	call   *%rax
+  8010ea:	4c 63 e8             	movslq %eax,%r13
+        if (res < 0)
+  8010ed:	4d 85 ed             	test   %r13,%r13
+  8010f0:	0f 88 92 00 00 00    	js     801188 <devfile_read+0x100>
+        memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  8010f6:	4c 89 ea             	mov    %r13,%rdx
+  8010f9:	4c 89 fe             	mov    %r15,%rsi
+  8010fc:	4c 89 f7             	mov    %r14,%rdi
+  8010ff:	48 b8 0c 29 80 00 00 	movabs $0x80290c,%rax
+  801106:	00 00 00 
+  801109:	ff d0                	call   *%rax
+        if (res < sizeof(fsipcbuf.readRet.ret_buf))
+  80110b:	49 81 fd ff 0f 00 00 	cmp    $0xfff,%r13
+  801112:	76 6d                	jbe    801181 <devfile_read+0xf9>
+        readsz += res;
+  801114:	4c 01 6d c0          	add    %r13,-0x40(%rbp)
+        buf += res;
+  801118:	4d 01 ee             	add    %r13,%r14
+        n -= res;
+  80111b:	4d 29 ec             	sub    %r13,%r12
+    while (n > sizeof(fsipcbuf.readRet.ret_buf))
+  80111e:	49 81 fc 00 10 00 00 	cmp    $0x1000,%r12
+  801125:	77 9b                	ja     8010c2 <devfile_read+0x3a>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801127:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  80112e:	00 00 00 
+  801131:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  801135:	8b 51 0c             	mov    0xc(%rcx),%edx
+  801138:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.read.req_n = n;
+  80113a:	4c 89 60 08          	mov    %r12,0x8(%rax)
+    ssize_t res = fsipc(FSREQ_READ, NULL);
+  80113e:	be 00 00 00 00       	mov    $0x0,%esi
+  801143:	bf 03 00 00 00       	mov    $0x3,%edi
+  801148:	48 b8 0e 0e 80 00 00 	movabs $0x800e0e,%rax
+  80114f:	00 00 00 
+  801152:	ff d0                	call   *%rax
+  801154:	4c 63 e8             	movslq %eax,%r13
+    if (res < 0)
+  801157:	4d 85 ed             	test   %r13,%r13
+  80115a:	78 2c                	js     801188 <devfile_read+0x100>
+    memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  80115c:	4c 89 ea             	mov    %r13,%rdx
+  80115f:	48 be 00 60 80 00 00 	movabs $0x806000,%rsi
+  801166:	00 00 00 
+  801169:	4c 89 f7             	mov    %r14,%rdi
+  80116c:	48 b8 0c 29 80 00 00 	movabs $0x80290c,%rax
+  801173:	00 00 00 
+  801176:	ff d0                	call   *%rax
+    readsz += res;
+  801178:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80117c:	49 01 c5             	add    %rax,%r13
+    return readsz;
+  80117f:	eb 07                	jmp    801188 <devfile_read+0x100>
+            return readsz + res;
+  801181:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  801185:	49 01 c5             	add    %rax,%r13
+}
+  801188:	4c 89 e8             	mov    %r13,%rax
+  80118b:	48 83 c4 18          	add    $0x18,%rsp
+  80118f:	5b                   	pop    %rbx
+  801190:	41 5c                	pop    %r12
+  801192:	41 5d                	pop    %r13
+  801194:	41 5e                	pop    %r14
+  801196:	41 5f                	pop    %r15
+  801198:	5d                   	pop    %rbp
+  801199:	c3                   	ret
+    ssize_t readsz = 0;
+  80119a:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  8011a1:	00 
+  8011a2:	eb 83                	jmp    801127 <devfile_read+0x9f>
+
+00000000008011a4 <open>:
+open(const char *path, int mode) {
+  8011a4:	55                   	push   %rbp
+  8011a5:	48 89 e5             	mov    %rsp,%rbp
+  8011a8:	41 55                	push   %r13
+  8011aa:	41 54                	push   %r12
+  8011ac:	53                   	push   %rbx
+  8011ad:	48 83 ec 18          	sub    $0x18,%rsp
+  8011b1:	49 89 fc             	mov    %rdi,%r12
+  8011b4:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  8011b7:	48 b8 6d 26 80 00 00 	movabs $0x80266d,%rax
+  8011be:	00 00 00 
+  8011c1:	ff d0                	call   *%rax
+  8011c3:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  8011c9:	0f 87 8a 00 00 00    	ja     801259 <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8011cf:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  8011d3:	48 b8 87 07 80 00 00 	movabs $0x800787,%rax
+  8011da:	00 00 00 
+  8011dd:	ff d0                	call   *%rax
+  8011df:	89 c3                	mov    %eax,%ebx
+  8011e1:	85 c0                	test   %eax,%eax
+  8011e3:	78 50                	js     801235 <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  8011e5:	4c 89 e6             	mov    %r12,%rsi
+  8011e8:	48 bb 00 60 80 00 00 	movabs $0x806000,%rbx
+  8011ef:	00 00 00 
+  8011f2:	48 89 df             	mov    %rbx,%rdi
+  8011f5:	48 b8 ab 26 80 00 00 	movabs $0x8026ab,%rax
+  8011fc:	00 00 00 
+  8011ff:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  801201:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801208:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  80120c:	bf 01 00 00 00       	mov    $0x1,%edi
+  801211:	48 b8 0e 0e 80 00 00 	movabs $0x800e0e,%rax
+  801218:	00 00 00 
+  80121b:	ff d0                	call   *%rax
+  80121d:	89 c3                	mov    %eax,%ebx
+  80121f:	85 c0                	test   %eax,%eax
+  801221:	78 1f                	js     801242 <open+0x9e>
+    return fd2num(fd);
+  801223:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  801227:	48 b8 e0 06 80 00 00 	movabs $0x8006e0,%rax
+  80122e:	00 00 00 
+  801231:	ff d0                	call   *%rax
+  801233:	89 c3                	mov    %eax,%ebx
+}
+  801235:	89 d8                	mov    %ebx,%eax
+  801237:	48 83 c4 18          	add    $0x18,%rsp
+  80123b:	5b                   	pop    %rbx
+  80123c:	41 5c                	pop    %r12
+  80123e:	41 5d                	pop    %r13
+  801240:	5d                   	pop    %rbp
+  801241:	c3                   	ret
+        fd_close(fd, 0);
+  801242:	be 00 00 00 00       	mov    $0x0,%esi
+  801247:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80124b:	48 b8 5c 08 80 00 00 	movabs $0x80085c,%rax
+  801252:	00 00 00 
+  801255:	ff d0                	call   *%rax
+        return res;
+  801257:	eb dc                	jmp    801235 <open+0x91>
+        return -E_BAD_PATH;
+  801259:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  80125e:	eb d5                	jmp    801235 <open+0x91>
+
+0000000000801260 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  801260:	55                   	push   %rbp
+  801261:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc(FSREQ_SYNC, NULL);
+  801264:	be 00 00 00 00       	mov    $0x0,%esi
+  801269:	bf 08 00 00 00       	mov    $0x8,%edi
+  80126e:	48 b8 0e 0e 80 00 00 	movabs $0x800e0e,%rax
+  801275:	00 00 00 
+  801278:	ff d0                	call   *%rax
+}
+  80127a:	5d                   	pop    %rbp
+  80127b:	c3                   	ret
+
+000000000080127c <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  80127c:	55                   	push   %rbp
+  80127d:	48 89 e5             	mov    %rsp,%rbp
+  801280:	41 54                	push   %r12
+  801282:	53                   	push   %rbx
+  801283:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  801286:	48 b8 f2 06 80 00 00 	movabs $0x8006f2,%rax
+  80128d:	00 00 00 
+  801290:	ff d0                	call   *%rax
+  801292:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  801295:	48 be 80 2d 80 00 00 	movabs $0x802d80,%rsi
+  80129c:	00 00 00 
+  80129f:	48 89 df             	mov    %rbx,%rdi
+  8012a2:	48 b8 ab 26 80 00 00 	movabs $0x8026ab,%rax
+  8012a9:	00 00 00 
+  8012ac:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  8012ae:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  8012b3:	41 2b 04 24          	sub    (%r12),%eax
+  8012b7:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  8012bd:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8012c4:	00 00 00 
+    stat->st_dev = &devpipe;
+  8012c7:	48 b8 60 40 80 00 00 	movabs $0x804060,%rax
+  8012ce:	00 00 00 
+  8012d1:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  8012d8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012dd:	5b                   	pop    %rbx
+  8012de:	41 5c                	pop    %r12
+  8012e0:	5d                   	pop    %rbp
+  8012e1:	c3                   	ret
+
+00000000008012e2 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  8012e2:	55                   	push   %rbp
+  8012e3:	48 89 e5             	mov    %rsp,%rbp
+  8012e6:	41 54                	push   %r12
+  8012e8:	53                   	push   %rbx
+  8012e9:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8012ec:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8012f1:	48 89 fe             	mov    %rdi,%rsi
+  8012f4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8012f9:	49 bc 71 03 80 00 00 	movabs $0x800371,%r12
+  801300:	00 00 00 
+  801303:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  801306:	48 89 df             	mov    %rbx,%rdi
+  801309:	48 b8 f2 06 80 00 00 	movabs $0x8006f2,%rax
+  801310:	00 00 00 
+  801313:	ff d0                	call   *%rax
+  801315:	48 89 c6             	mov    %rax,%rsi
+  801318:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80131d:	bf 00 00 00 00       	mov    $0x0,%edi
+  801322:	41 ff d4             	call   *%r12
+}
+  801325:	5b                   	pop    %rbx
+  801326:	41 5c                	pop    %r12
+  801328:	5d                   	pop    %rbp
+  801329:	c3                   	ret
+
+000000000080132a <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  80132a:	55                   	push   %rbp
+  80132b:	48 89 e5             	mov    %rsp,%rbp
+  80132e:	41 57                	push   %r15
+  801330:	41 56                	push   %r14
+  801332:	41 55                	push   %r13
+  801334:	41 54                	push   %r12
+  801336:	53                   	push   %rbx
+  801337:	48 83 ec 18          	sub    $0x18,%rsp
+  80133b:	49 89 fc             	mov    %rdi,%r12
+  80133e:	49 89 f5             	mov    %rsi,%r13
+  801341:	49 89 d7             	mov    %rdx,%r15
+  801344:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  801348:	48 b8 f2 06 80 00 00 	movabs $0x8006f2,%rax
+  80134f:	00 00 00 
+  801352:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  801354:	4d 85 ff             	test   %r15,%r15
+  801357:	0f 84 af 00 00 00    	je     80140c <devpipe_write+0xe2>
+  80135d:	48 89 c3             	mov    %rax,%rbx
+  801360:	4c 89 f8             	mov    %r15,%rax
+  801363:	4d 89 ef             	mov    %r13,%r15
+  801366:	4c 01 e8             	add    %r13,%rax
+  801369:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80136d:	49 bd 79 02 80 00 00 	movabs $0x800279,%r13
+  801374:	00 00 00 
+            sys_yield();
+  801377:	49 be 16 02 80 00 00 	movabs $0x800216,%r14
+  80137e:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  801381:	8b 73 04             	mov    0x4(%rbx),%esi
+  801384:	48 63 ce             	movslq %esi,%rcx
+  801387:	48 63 03             	movslq (%rbx),%rax
+  80138a:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  801390:	48 39 c1             	cmp    %rax,%rcx
+  801393:	72 2e                	jb     8013c3 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  801395:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80139a:	48 89 da             	mov    %rbx,%rdx
+  80139d:	be 00 10 00 00       	mov    $0x1000,%esi
+  8013a2:	4c 89 e7             	mov    %r12,%rdi
+  8013a5:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  8013a8:	85 c0                	test   %eax,%eax
+  8013aa:	74 66                	je     801412 <devpipe_write+0xe8>
+            sys_yield();
+  8013ac:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  8013af:	8b 73 04             	mov    0x4(%rbx),%esi
+  8013b2:	48 63 ce             	movslq %esi,%rcx
+  8013b5:	48 63 03             	movslq (%rbx),%rax
+  8013b8:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  8013be:	48 39 c1             	cmp    %rax,%rcx
+  8013c1:	73 d2                	jae    801395 <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8013c3:	41 0f b6 3f          	movzbl (%r15),%edi
+  8013c7:	48 89 ca             	mov    %rcx,%rdx
+  8013ca:	48 c1 ea 03          	shr    $0x3,%rdx
+  8013ce:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  8013d5:	08 10 20 
+  8013d8:	48 f7 e2             	mul    %rdx
+  8013db:	48 c1 ea 06          	shr    $0x6,%rdx
+  8013df:	48 89 d0             	mov    %rdx,%rax
+  8013e2:	48 c1 e0 09          	shl    $0x9,%rax
+  8013e6:	48 29 d0             	sub    %rdx,%rax
+  8013e9:	48 c1 e0 03          	shl    $0x3,%rax
+  8013ed:	48 29 c1             	sub    %rax,%rcx
+  8013f0:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  8013f5:	83 c6 01             	add    $0x1,%esi
+  8013f8:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8013fb:	49 83 c7 01          	add    $0x1,%r15
+  8013ff:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801403:	49 39 c7             	cmp    %rax,%r15
+  801406:	0f 85 75 ff ff ff    	jne    801381 <devpipe_write+0x57>
+    return n;
+  80140c:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  801410:	eb 05                	jmp    801417 <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  801412:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801417:	48 83 c4 18          	add    $0x18,%rsp
+  80141b:	5b                   	pop    %rbx
+  80141c:	41 5c                	pop    %r12
+  80141e:	41 5d                	pop    %r13
+  801420:	41 5e                	pop    %r14
+  801422:	41 5f                	pop    %r15
+  801424:	5d                   	pop    %rbp
+  801425:	c3                   	ret
+
+0000000000801426 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  801426:	55                   	push   %rbp
+  801427:	48 89 e5             	mov    %rsp,%rbp
+  80142a:	41 57                	push   %r15
+  80142c:	41 56                	push   %r14
+  80142e:	41 55                	push   %r13
+  801430:	41 54                	push   %r12
+  801432:	53                   	push   %rbx
+  801433:	48 83 ec 18          	sub    $0x18,%rsp
+  801437:	49 89 fc             	mov    %rdi,%r12
+  80143a:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  80143e:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  801442:	48 b8 f2 06 80 00 00 	movabs $0x8006f2,%rax
+  801449:	00 00 00 
+  80144c:	ff d0                	call   *%rax
+  80144e:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  801451:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  801457:	49 bd 79 02 80 00 00 	movabs $0x800279,%r13
+  80145e:	00 00 00 
+            sys_yield();
+  801461:	49 be 16 02 80 00 00 	movabs $0x800216,%r14
+  801468:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  80146b:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  801470:	74 7d                	je     8014ef <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  801472:	8b 03                	mov    (%rbx),%eax
+  801474:	3b 43 04             	cmp    0x4(%rbx),%eax
+  801477:	75 26                	jne    80149f <devpipe_read+0x79>
+            if (i > 0) return i;
+  801479:	4d 85 ff             	test   %r15,%r15
+  80147c:	75 77                	jne    8014f5 <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80147e:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  801483:	48 89 da             	mov    %rbx,%rdx
+  801486:	be 00 10 00 00       	mov    $0x1000,%esi
+  80148b:	4c 89 e7             	mov    %r12,%rdi
+  80148e:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  801491:	85 c0                	test   %eax,%eax
+  801493:	74 72                	je     801507 <devpipe_read+0xe1>
+            sys_yield();
+  801495:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  801498:	8b 03                	mov    (%rbx),%eax
+  80149a:	3b 43 04             	cmp    0x4(%rbx),%eax
+  80149d:	74 df                	je     80147e <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  80149f:	48 63 c8             	movslq %eax,%rcx
+  8014a2:	48 89 ca             	mov    %rcx,%rdx
+  8014a5:	48 c1 ea 03          	shr    $0x3,%rdx
+  8014a9:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  8014b0:	08 10 20 
+  8014b3:	48 89 d0             	mov    %rdx,%rax
+  8014b6:	48 f7 e6             	mul    %rsi
+  8014b9:	48 c1 ea 06          	shr    $0x6,%rdx
+  8014bd:	48 89 d0             	mov    %rdx,%rax
+  8014c0:	48 c1 e0 09          	shl    $0x9,%rax
+  8014c4:	48 29 d0             	sub    %rdx,%rax
+  8014c7:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  8014ce:	00 
+  8014cf:	48 89 c8             	mov    %rcx,%rax
+  8014d2:	48 29 d0             	sub    %rdx,%rax
+  8014d5:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  8014da:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8014de:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  8014e2:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8014e5:	49 83 c7 01          	add    $0x1,%r15
+  8014e9:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  8014ed:	75 83                	jne    801472 <devpipe_read+0x4c>
+    return n;
+  8014ef:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8014f3:	eb 03                	jmp    8014f8 <devpipe_read+0xd2>
+            if (i > 0) return i;
+  8014f5:	4c 89 f8             	mov    %r15,%rax
+}
+  8014f8:	48 83 c4 18          	add    $0x18,%rsp
+  8014fc:	5b                   	pop    %rbx
+  8014fd:	41 5c                	pop    %r12
+  8014ff:	41 5d                	pop    %r13
+  801501:	41 5e                	pop    %r14
+  801503:	41 5f                	pop    %r15
+  801505:	5d                   	pop    %rbp
+  801506:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  801507:	b8 00 00 00 00       	mov    $0x0,%eax
+  80150c:	eb ea                	jmp    8014f8 <devpipe_read+0xd2>
+
+000000000080150e <pipe>:
+pipe(int pfd[2]) {
+  80150e:	55                   	push   %rbp
+  80150f:	48 89 e5             	mov    %rsp,%rbp
+  801512:	41 55                	push   %r13
+  801514:	41 54                	push   %r12
+  801516:	53                   	push   %rbx
+  801517:	48 81 ec b8 00 00 00 	sub    $0xb8,%rsp
+  80151e:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  801521:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  801525:	48 b8 87 07 80 00 00 	movabs $0x800787,%rax
+  80152c:	00 00 00 
+  80152f:	ff d0                	call   *%rax
+  801531:	89 c3                	mov    %eax,%ebx
+  801533:	85 c0                	test   %eax,%eax
+  801535:	0f 88 51 01 00 00    	js     80168c <pipe+0x17e>
+        (res = fd_alloc_from(fd2num(fd0) + 1, &fd1)) < 0) goto err;
+  80153b:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80153f:	48 b8 e0 06 80 00 00 	movabs $0x8006e0,%rax
+  801546:	00 00 00 
+  801549:	ff d0                	call   *%rax
+  80154b:	8d 78 01             	lea    0x1(%rax),%edi
+  80154e:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801552:	48 b8 0e 07 80 00 00 	movabs $0x80070e,%rax
+  801559:	00 00 00 
+  80155c:	ff d0                	call   *%rax
+  80155e:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  801560:	85 c0                	test   %eax,%eax
+  801562:	0f 88 24 01 00 00    	js     80168c <pipe+0x17e>
+    va = fd2data(fd0);
+  801568:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80156c:	48 bb f2 06 80 00 00 	movabs $0x8006f2,%rbx
+  801573:	00 00 00 
+  801576:	ff d3                	call   *%rbx
+  801578:	49 89 c5             	mov    %rax,%r13
+    struct RegionOp ops[] = {
+  80157b:	48 8d bd 30 ff ff ff 	lea    -0xd0(%rbp),%rdi
+  801582:	b9 14 00 00 00       	mov    $0x14,%ecx
+  801587:	b8 00 00 00 00       	mov    $0x0,%eax
+  80158c:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+  80158f:	c7 85 34 ff ff ff 46 	movl   $0x46,-0xcc(%rbp)
+  801596:	00 00 00 
+  801599:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80159d:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+  8015a4:	48 c7 85 50 ff ff ff 	movq   $0x1000,-0xb0(%rbp)
+  8015ab:	00 10 00 00 
+  8015af:	c7 85 5c ff ff ff 46 	movl   $0x46,-0xa4(%rbp)
+  8015b6:	00 00 00 
+            {.type = REGION_ALLOC, .dstva = (uintptr_t)fd1, .size = PAGE_SIZE, .perm = PROT_RW | PROT_SHARE},
+  8015b9:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+    struct RegionOp ops[] = {
+  8015bd:	48 89 bd 70 ff ff ff 	mov    %rdi,-0x90(%rbp)
+  8015c4:	48 c7 85 78 ff ff ff 	movq   $0x1000,-0x88(%rbp)
+  8015cb:	00 10 00 00 
+  8015cf:	c7 45 84 46 00 00 00 	movl   $0x46,-0x7c(%rbp)
+  8015d6:	4c 89 6d 98          	mov    %r13,-0x68(%rbp)
+  8015da:	48 c7 45 a0 00 10 00 	movq   $0x1000,-0x60(%rbp)
+  8015e1:	00 
+  8015e2:	c7 45 a8 01 00 00 00 	movl   $0x1,-0x58(%rbp)
+  8015e9:	c7 45 ac 46 00 00 00 	movl   $0x46,-0x54(%rbp)
+  8015f0:	4c 89 6d b8          	mov    %r13,-0x48(%rbp)
+            {.type = REGION_MAP, .srcva = (uintptr_t)va, .dstva = (uintptr_t)fd2data(fd1), .size = PAGE_SIZE, .perm = PROT_RW | PROT_SHARE},
+  8015f4:	ff d3                	call   *%rbx
+    struct RegionOp ops[] = {
+  8015f6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8015fa:	48 c7 45 c8 00 10 00 	movq   $0x1000,-0x38(%rbp)
+  801601:	00 
+    if ((res = sys_region_batch(ops, sizeof ops / sizeof *ops)) < 0) goto err1;
+  801602:	be 04 00 00 00       	mov    $0x4,%esi
+  801607:	48 8d bd 30 ff ff ff 	lea    -0xd0(%rbp),%rdi
+  80160e:	48 b8 d8 03 80 00 00 	movabs $0x8003d8,%rax
+  801615:	00 00 00 
+  801618:	ff d0                	call   *%rax
+  80161a:	89 c3                	mov    %eax,%ebx
+  80161c:	85 c0                	test   %eax,%eax
+  80161e:	0f 88 ad 00 00 00    	js     8016d1 <pipe+0x1c3>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  801624:	be 00 10 00 00       	mov    $0x1000,%esi
+  801629:	4c 89 ef             	mov    %r13,%rdi
+  80162c:	48 b8 47 02 80 00 00 	movabs $0x800247,%rax
+  801633:	00 00 00 
+  801636:	ff d0                	call   *%rax
+  801638:	83 f8 02             	cmp    $0x2,%eax
+  80163b:	75 5f                	jne    80169c <pipe+0x18e>
+    fd0->fd_dev_id = devpipe.dev_id;
+  80163d:	a1 60 40 80 00 00 00 	movabs 0x804060,%eax
+  801644:	00 00 
+  801646:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80164a:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  80164c:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801650:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  801657:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  80165b:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  80165d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801661:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  801668:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80166c:	48 bb e0 06 80 00 00 	movabs $0x8006e0,%rbx
+  801673:	00 00 00 
+  801676:	ff d3                	call   *%rbx
+  801678:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  80167c:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  801680:	ff d3                	call   *%rbx
+  801682:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  801687:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  80168c:	89 d8                	mov    %ebx,%eax
+  80168e:	48 81 c4 b8 00 00 00 	add    $0xb8,%rsp
+  801695:	5b                   	pop    %rbx
+  801696:	41 5c                	pop    %r12
+  801698:	41 5d                	pop    %r13
+  80169a:	5d                   	pop    %rbp
+  80169b:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  80169c:	48 b9 b0 2d 80 00 00 	movabs $0x802db0,%rcx
+  8016a3:	00 00 00 
+  8016a6:	48 ba 87 2d 80 00 00 	movabs $0x802d87,%rdx
+  8016ad:	00 00 00 
+  8016b0:	be 33 00 00 00       	mov    $0x33,%esi
+  8016b5:	48 bf 9c 2d 80 00 00 	movabs $0x802d9c,%rdi
+  8016bc:	00 00 00 
+  8016bf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016c4:	49 b8 36 1c 80 00 00 	movabs $0x801c36,%r8
+  8016cb:	00 00 00 
+  8016ce:	41 ff d0             	call   *%r8
+        ops[i].type = REGION_UNMAP;
+  8016d1:	c7 85 30 ff ff ff 02 	movl   $0x2,-0xd0(%rbp)
+  8016d8:	00 00 00 
+  8016db:	c7 85 58 ff ff ff 02 	movl   $0x2,-0xa8(%rbp)
+  8016e2:	00 00 00 
+  8016e5:	c7 45 80 02 00 00 00 	movl   $0x2,-0x80(%rbp)
+  8016ec:	c7 45 a8 02 00 00 00 	movl   $0x2,-0x58(%rbp)
+    sys_region_batch(ops, sizeof ops / sizeof *ops);
+  8016f3:	be 04 00 00 00       	mov    $0x4,%esi
+  8016f8:	48 8d bd 30 ff ff ff 	lea    -0xd0(%rbp),%rdi
+  8016ff:	48 b8 d8 03 80 00 00 	movabs $0x8003d8,%rax
+  801706:	00 00 00 
+  801709:	ff d0                	call   *%rax
+  80170b:	e9 7c ff ff ff       	jmp    80168c <pipe+0x17e>
+
+0000000000801710 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  801710:	55                   	push   %rbp
+  801711:	48 89 e5             	mov    %rsp,%rbp
+  801714:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  801718:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80171c:	48 b8 a1 07 80 00 00 	movabs $0x8007a1,%rax
+  801723:	00 00 00 
+  801726:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801728:	85 c0                	test   %eax,%eax
+  80172a:	78 35                	js     801761 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  80172c:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801730:	48 b8 f2 06 80 00 00 	movabs $0x8006f2,%rax
+  801737:	00 00 00 
+  80173a:	ff d0                	call   *%rax
+  80173c:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80173f:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  801744:	be 00 10 00 00       	mov    $0x1000,%esi
+  801749:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80174d:	48 b8 79 02 80 00 00 	movabs $0x800279,%rax
+  801754:	00 00 00 
+  801757:	ff d0                	call   *%rax
+  801759:	85 c0                	test   %eax,%eax
+  80175b:	0f 94 c0             	sete   %al
+  80175e:	0f b6 c0             	movzbl %al,%eax
+}
+  801761:	c9                   	leave
+  801762:	c3                   	ret
+
+0000000000801763 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  801763:	48 89 f8             	mov    %rdi,%rax
+  801766:	48 c1 e8 27          	shr    $0x27,%rax
+  80176a:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  801771:	01 00 00 
+  801774:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  801778:	f6 c2 01             	test   $0x1,%dl
+  80177b:	74 6d                	je     8017ea <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  80177d:	48 89 f8             	mov    %rdi,%rax
+  801780:	48 c1 e8 1e          	shr    $0x1e,%rax
+  801784:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  80178b:	01 00 00 
+  80178e:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  801792:	f6 c2 01             	test   $0x1,%dl
+  801795:	74 62                	je     8017f9 <get_uvpt_entry+0x96>
+  801797:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  80179e:	01 00 00 
+  8017a1:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8017a5:	f6 c2 80             	test   $0x80,%dl
+  8017a8:	75 4f                	jne    8017f9 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8017aa:	48 89 f8             	mov    %rdi,%rax
+  8017ad:	48 c1 e8 15          	shr    $0x15,%rax
+  8017b1:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8017b8:	01 00 00 
+  8017bb:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8017bf:	f6 c2 01             	test   $0x1,%dl
+  8017c2:	74 44                	je     801808 <get_uvpt_entry+0xa5>
+  8017c4:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8017cb:	01 00 00 
+  8017ce:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8017d2:	f6 c2 80             	test   $0x80,%dl
+  8017d5:	75 31                	jne    801808 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  8017d7:	48 c1 ef 0c          	shr    $0xc,%rdi
+  8017db:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8017e2:	01 00 00 
+  8017e5:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  8017e9:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8017ea:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  8017f1:	01 00 00 
+  8017f4:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8017f8:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8017f9:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  801800:	01 00 00 
+  801803:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  801807:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  801808:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  80180f:	01 00 00 
+  801812:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  801816:	c3                   	ret
+
+0000000000801817 <get_prot>:
+
+int
+get_prot(void *va) {
+  801817:	55                   	push   %rbp
+  801818:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  80181b:	48 b8 63 17 80 00 00 	movabs $0x801763,%rax
+  801822:	00 00 00 
+  801825:	ff d0                	call   *%rax
+  801827:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  80182a:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  80182f:	89 c1                	mov    %eax,%ecx
+  801831:	83 c9 04             	or     $0x4,%ecx
+  801834:	f6 c2 01             	test   $0x1,%dl
+  801837:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  80183a:	89 c1                	mov    %eax,%ecx
+  80183c:	83 c9 02             	or     $0x2,%ecx
+  80183f:	f6 c2 02             	test   $0x2,%dl
+  801842:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  801845:	89 c1                	mov    %eax,%ecx
+  801847:	83 c9 01             	or     $0x1,%ecx
+  80184a:	48 85 d2             	test   %rdx,%rdx
+  80184d:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  801850:	89 c1                	mov    %eax,%ecx
+  801852:	83 c9 40             	or     $0x40,%ecx
+  801855:	f6 c6 04             	test   $0x4,%dh
+  801858:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  80185b:	5d                   	pop    %rbp
+  80185c:	c3                   	ret
+
+000000000080185d <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  80185d:	55                   	push   %rbp
+  80185e:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  801861:	48 b8 63 17 80 00 00 	movabs $0x801763,%rax
+  801868:	00 00 00 
+  80186b:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  80186d:	48 c1 e8 06          	shr    $0x6,%rax
+  801871:	83 e0 01             	and    $0x1,%eax
+}
+  801874:	5d                   	pop    %rbp
+  801875:	c3                   	ret
+
+0000000000801876 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  801876:	55                   	push   %rbp
+  801877:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  80187a:	48 b8 63 17 80 00 00 	movabs $0x801763,%rax
+  801881:	00 00 00 
+  801884:	ff d0                	call   *%rax
+  801886:	83 e0 01             	and    $0x1,%eax
+}
+  801889:	5d                   	pop    %rbp
+  80188a:	c3                   	ret
+
+000000000080188b <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  80188b:	55                   	push   %rbp
+  80188c:	48 89 e5             	mov    %rsp,%rbp
+  80188f:	41 57                	push   %r15
+  801891:	41 56                	push   %r14
+  801893:	41 55                	push   %r13
+  801895:	41 54                	push   %r12
+  801897:	53                   	push   %rbx
+  801898:	48 83 ec 38          	sub    $0x38,%rsp
+  80189c:	49 89 f7             	mov    %rsi,%r15
+  80189f:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+                    }
+                    continue;
+                }
+                for (int ptei = 0; ptei < PT_ENTRY_COUNT; ptei++) {
+                    uintptr_t pte_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, pdei, ptei, 0);
+                    pte_t pte = uvpt[VPT(pte_addr)];
+  8018a5:	49 bd 00 00 00 00 00 	movabs $0x10000000000,%r13
+  8018ac:	01 00 00 
+  8018af:	4d 89 e6             	mov    %r12,%r14
+  8018b2:	49 89 fc             	mov    %rdi,%r12
+  8018b5:	e9 19 01 00 00       	jmp    8019d3 <foreach_shared_region+0x148>
+  8018ba:	48 89 5d b0          	mov    %rbx,-0x50(%rbp)
+  8018be:	4c 89 75 a8          	mov    %r14,-0x58(%rbp)
+  8018c2:	eb 52                	jmp    801916 <foreach_shared_region+0x8b>
+                for (int ptei = 0; ptei < PT_ENTRY_COUNT; ptei++) {
+  8018c4:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8018cb:	48 81 fb 00 00 20 00 	cmp    $0x200000,%rbx
+  8018d2:	74 2e                	je     801902 <foreach_shared_region+0x77>
+                    uintptr_t pte_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, pdei, ptei, 0);
+  8018d4:	48 89 df             	mov    %rbx,%rdi
+  8018d7:	4c 09 f7             	or     %r14,%rdi
+                    pte_t pte = uvpt[VPT(pte_addr)];
+  8018da:	48 89 f8             	mov    %rdi,%rax
+  8018dd:	48 c1 e8 0c          	shr    $0xc,%rax
+  8018e1:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+                    if ((pte & PTE_P) && (pte & PTE_SHARE)) {
+  8018e6:	25 01 04 00 00       	and    $0x401,%eax
+  8018eb:	48 3d 01 04 00 00    	cmp    $0x401,%rax
+  8018f1:	75 d1                	jne    8018c4 <foreach_shared_region+0x39>
+                        fun((void*)pte_addr, (void*)(pte_addr + PAGE_SIZE), arg);
+  8018f3:	48 8d b7 00 10 00 00 	lea    0x1000(%rdi),%rsi
+  8018fa:	4c 89 fa             	mov    %r15,%rdx
+  8018fd:	41 ff d4             	call   *%r12
+  801900:	eb c2                	jmp    8018c4 <foreach_shared_region+0x39>
+            for (int pdei = 0; pdei < PD_ENTRY_COUNT; pdei++) {
+  801902:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  801909:	00 
+  80190a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80190e:	48 3d 00 00 00 40    	cmp    $0x40000000,%rax
+  801914:	74 46                	je     80195c <foreach_shared_region+0xd1>
+                uintptr_t pde_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, pdei, 0, 0);
+  801916:	4c 8b 75 c8          	mov    -0x38(%rbp),%r14
+  80191a:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80191e:	49 09 c6             	or     %rax,%r14
+                pde_t pde = uvpd[VPD(pde_addr)];
+  801921:	4c 89 f0             	mov    %r14,%rax
+  801924:	48 c1 e8 15          	shr    $0x15,%rax
+  801928:	48 b9 00 00 00 80 00 	movabs $0x10080000000,%rcx
+  80192f:	01 00 00 
+  801932:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+                if (!(pde & PTE_P)) {
+  801936:	a8 01                	test   $0x1,%al
+  801938:	74 c8                	je     801902 <foreach_shared_region+0x77>
+                if (pde & PTE_PS) {
+  80193a:	48 89 c3             	mov    %rax,%rbx
+  80193d:	81 e3 80 00 00 00    	and    $0x80,%ebx
+  801943:	74 8f                	je     8018d4 <foreach_shared_region+0x49>
+                    if (pde & PTE_SHARE) {
+  801945:	f6 c4 04             	test   $0x4,%ah
+  801948:	74 b8                	je     801902 <foreach_shared_region+0x77>
+                        fun((void*)pde_addr, (void*)(pde_addr + 1024 * 1024 * 2), arg);
+  80194a:	49 8d b6 00 00 20 00 	lea    0x200000(%r14),%rsi
+  801951:	4c 89 fa             	mov    %r15,%rdx
+  801954:	4c 89 f7             	mov    %r14,%rdi
+  801957:	41 ff d4             	call   *%r12
+  80195a:	eb a6                	jmp    801902 <foreach_shared_region+0x77>
+  80195c:	48 8b 5d b0          	mov    -0x50(%rbp),%rbx
+  801960:	4c 8b 75 a8          	mov    -0x58(%rbp),%r14
+        for (int pdpei = 0; pdpei < PDP_ENTRY_COUNT; pdpei++) {
+  801964:	48 81 c3 00 00 00 40 	add    $0x40000000,%rbx
+  80196b:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  801972:	00 00 00 
+  801975:	48 39 c3             	cmp    %rax,%rbx
+  801978:	74 4c                	je     8019c6 <foreach_shared_region+0x13b>
+            uintptr_t pdpe_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, 0, 0, 0);
+  80197a:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  80197e:	48 09 d8             	or     %rbx,%rax
+  801981:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+            pdpe_t pdpe = uvpdp[VPDP(pdpe_addr)];
+  801985:	48 c1 e8 1e          	shr    $0x1e,%rax
+  801989:	48 b9 00 00 40 80 00 	movabs $0x10080400000,%rcx
+  801990:	01 00 00 
+  801993:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+            if (!(pdpe & PTE_P)) {
+  801997:	a8 01                	test   $0x1,%al
+  801999:	74 c9                	je     801964 <foreach_shared_region+0xd9>
+            if (pdpe & PTE_PS) {
+  80199b:	48 89 c1             	mov    %rax,%rcx
+  80199e:	81 e1 80 00 00 00    	and    $0x80,%ecx
+  8019a4:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  8019a8:	0f 84 0c ff ff ff    	je     8018ba <foreach_shared_region+0x2f>
+                if (pdpe & PTE_SHARE) {
+  8019ae:	f6 c4 04             	test   $0x4,%ah
+  8019b1:	74 b1                	je     801964 <foreach_shared_region+0xd9>
+                    fun((void*)pdpe_addr, (void*)(pdpe_addr + 1024 * 1024 * 1024), arg); 
+  8019b3:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  8019b7:	48 8d b7 00 00 00 40 	lea    0x40000000(%rdi),%rsi
+  8019be:	4c 89 fa             	mov    %r15,%rdx
+  8019c1:	41 ff d4             	call   *%r12
+  8019c4:	eb 9e                	jmp    801964 <foreach_shared_region+0xd9>
+    for (int pml4ei = 0; pml4ei < PML4_ENTRY_COUNT; pml4ei++) {
+  8019c6:	49 83 c6 01          	add    $0x1,%r14
+  8019ca:	49 81 fe 00 02 00 00 	cmp    $0x200,%r14
+  8019d1:	74 24                	je     8019f7 <foreach_shared_region+0x16c>
+        pml4e_t pml4e = uvpml4[VPML4(pml4_addr)];
+  8019d3:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  8019da:	01 00 00 
+  8019dd:	4a 8b 04 f0          	mov    (%rax,%r14,8),%rax
+        if (!(pml4e & PTE_P)) {
+  8019e1:	a8 01                	test   $0x1,%al
+  8019e3:	74 e1                	je     8019c6 <foreach_shared_region+0x13b>
+  8019e5:	4c 89 f0             	mov    %r14,%rax
+  8019e8:	48 c1 e0 27          	shl    $0x27,%rax
+  8019ec:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8019f0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8019f5:	eb 83                	jmp    80197a <foreach_shared_region+0xef>
+            }
+        }
+    }
+    
+    return 0;
+}
+  8019f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019fc:	48 83 c4 38          	add    $0x38,%rsp
+  801a00:	5b                   	pop    %rbx
+  801a01:	41 5c                	pop    %r12
+  801a03:	41 5d                	pop    %r13
+  801a05:	41 5e                	pop    %r14
+  801a07:	41 5f                	pop    %r15
+  801a09:	5d                   	pop    %rbp
+  801a0a:	c3                   	ret
+
+0000000000801a0b <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  801a0b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a10:	c3                   	ret
+
+0000000000801a11 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  801a11:	55                   	push   %rbp
+  801a12:	48 89 e5             	mov    %rsp,%rbp
+  801a15:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  801a18:	48 be d4 2d 80 00 00 	movabs $0x802dd4,%rsi
+  801a1f:	00 00 00 
+  801a22:	48 b8 ab 26 80 00 00 	movabs $0x8026ab,%rax
+  801a29:	00 00 00 
+  801a2c:	ff d0                	call   *%rax
+    return 0;
+}
+  801a2e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a33:	5d                   	pop    %rbp
+  801a34:	c3                   	ret
+
+0000000000801a35 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  801a35:	55                   	push   %rbp
+  801a36:	48 89 e5             	mov    %rsp,%rbp
+  801a39:	41 57                	push   %r15
+  801a3b:	41 56                	push   %r14
+  801a3d:	41 55                	push   %r13
+  801a3f:	41 54                	push   %r12
+  801a41:	53                   	push   %rbx
+  801a42:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  801a49:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  801a50:	48 85 d2             	test   %rdx,%rdx
+  801a53:	74 7a                	je     801acf <devcons_write+0x9a>
+  801a55:	49 89 d6             	mov    %rdx,%r14
+  801a58:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  801a5e:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  801a63:	49 bf a5 28 80 00 00 	movabs $0x8028a5,%r15
+  801a6a:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  801a6d:	4c 89 f3             	mov    %r14,%rbx
+  801a70:	48 29 f3             	sub    %rsi,%rbx
+  801a73:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  801a78:	48 39 c3             	cmp    %rax,%rbx
+  801a7b:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  801a7f:	4c 63 eb             	movslq %ebx,%r13
+  801a82:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  801a89:	48 01 c6             	add    %rax,%rsi
+  801a8c:	4c 89 ea             	mov    %r13,%rdx
+  801a8f:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  801a96:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  801a99:	4c 89 ee             	mov    %r13,%rsi
+  801a9c:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  801aa3:	48 b8 1c 01 80 00 00 	movabs $0x80011c,%rax
+  801aaa:	00 00 00 
+  801aad:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  801aaf:	41 01 dc             	add    %ebx,%r12d
+  801ab2:	49 63 f4             	movslq %r12d,%rsi
+  801ab5:	4c 39 f6             	cmp    %r14,%rsi
+  801ab8:	72 b3                	jb     801a6d <devcons_write+0x38>
+    return res;
+  801aba:	49 63 c4             	movslq %r12d,%rax
+}
+  801abd:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  801ac4:	5b                   	pop    %rbx
+  801ac5:	41 5c                	pop    %r12
+  801ac7:	41 5d                	pop    %r13
+  801ac9:	41 5e                	pop    %r14
+  801acb:	41 5f                	pop    %r15
+  801acd:	5d                   	pop    %rbp
+  801ace:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  801acf:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  801ad5:	eb e3                	jmp    801aba <devcons_write+0x85>
+
+0000000000801ad7 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  801ad7:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  801ada:	ba 00 00 00 00       	mov    $0x0,%edx
+  801adf:	48 85 c0             	test   %rax,%rax
+  801ae2:	74 55                	je     801b39 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  801ae4:	55                   	push   %rbp
+  801ae5:	48 89 e5             	mov    %rsp,%rbp
+  801ae8:	41 55                	push   %r13
+  801aea:	41 54                	push   %r12
+  801aec:	53                   	push   %rbx
+  801aed:	48 83 ec 08          	sub    $0x8,%rsp
+  801af1:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  801af4:	48 bb 49 01 80 00 00 	movabs $0x800149,%rbx
+  801afb:	00 00 00 
+  801afe:	49 bc 16 02 80 00 00 	movabs $0x800216,%r12
+  801b05:	00 00 00 
+  801b08:	eb 03                	jmp    801b0d <devcons_read+0x36>
+  801b0a:	41 ff d4             	call   *%r12
+  801b0d:	ff d3                	call   *%rbx
+  801b0f:	85 c0                	test   %eax,%eax
+  801b11:	74 f7                	je     801b0a <devcons_read+0x33>
+    if (c < 0) return c;
+  801b13:	48 63 d0             	movslq %eax,%rdx
+  801b16:	78 13                	js     801b2b <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  801b18:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b1d:	83 f8 04             	cmp    $0x4,%eax
+  801b20:	74 09                	je     801b2b <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  801b22:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  801b26:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  801b2b:	48 89 d0             	mov    %rdx,%rax
+  801b2e:	48 83 c4 08          	add    $0x8,%rsp
+  801b32:	5b                   	pop    %rbx
+  801b33:	41 5c                	pop    %r12
+  801b35:	41 5d                	pop    %r13
+  801b37:	5d                   	pop    %rbp
+  801b38:	c3                   	ret
+  801b39:	48 89 d0             	mov    %rdx,%rax
+  801b3c:	c3                   	ret
+
+0000000000801b3d <cputchar>:
+cputchar(int ch) {
+  801b3d:	55                   	push   %rbp
+  801b3e:	48 89 e5             	mov    %rsp,%rbp
+  801b41:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  801b45:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  801b49:	be 01 00 00 00       	mov    $0x1,%esi
+  801b4e:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  801b52:	48 b8 1c 01 80 00 00 	movabs $0x80011c,%rax
+  801b59:	00 00 00 
+  801b5c:	ff d0                	call   *%rax
+}
+  801b5e:	c9                   	leave
+  801b5f:	c3                   	ret
+
+0000000000801b60 <getchar>:
+getchar(void) {
+  801b60:	55                   	push   %rbp
+  801b61:	48 89 e5             	mov    %rsp,%rbp
+  801b64:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  801b68:	ba 01 00 00 00       	mov    $0x1,%edx
+  801b6d:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  801b71:	bf 00 00 00 00       	mov    $0x0,%edi
+  801b76:	48 b8 84 0a 80 00 00 	movabs $0x800a84,%rax
+  801b7d:	00 00 00 
+  801b80:	ff d0                	call   *%rax
+  801b82:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  801b84:	85 c0                	test   %eax,%eax
+  801b86:	78 06                	js     801b8e <getchar+0x2e>
+  801b88:	74 08                	je     801b92 <getchar+0x32>
+  801b8a:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  801b8e:	89 d0                	mov    %edx,%eax
+  801b90:	c9                   	leave
+  801b91:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  801b92:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  801b97:	eb f5                	jmp    801b8e <getchar+0x2e>
+
+0000000000801b99 <iscons>:
+iscons(int fdnum) {
+  801b99:	55                   	push   %rbp
+  801b9a:	48 89 e5             	mov    %rsp,%rbp
+  801b9d:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  801ba1:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801ba5:	48 b8 a1 07 80 00 00 	movabs $0x8007a1,%rax
+  801bac:	00 00 00 
+  801baf:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801bb1:	85 c0                	test   %eax,%eax
+  801bb3:	78 18                	js     801bcd <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  801bb5:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801bb9:	48 b8 a0 40 80 00 00 	movabs $0x8040a0,%rax
+  801bc0:	00 00 00 
+  801bc3:	8b 00                	mov    (%rax),%eax
+  801bc5:	39 02                	cmp    %eax,(%rdx)
+  801bc7:	0f 94 c0             	sete   %al
+  801bca:	0f b6 c0             	movzbl %al,%eax
+}
+  801bcd:	c9                   	leave
+  801bce:	c3                   	ret
+
+0000000000801bcf <opencons>:
+opencons(void) {
+  801bcf:	55                   	push   %rbp
+  801bd0:	48 89 e5             	mov    %rsp,%rbp
+  801bd3:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  801bd7:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  801bdb:	48 b8 87 07 80 00 00 	movabs $0x800787,%rax
+  801be2:	00 00 00 
+  801be5:	ff d0                	call   *%rax
+  801be7:	85 c0                	test   %eax,%eax
+  801be9:	78 49                	js     801c34 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  801beb:	b9 46 00 00 00       	mov    $0x46,%ecx
+  801bf0:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801bf5:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  801bf9:	bf 00 00 00 00       	mov    $0x0,%edi
+  801bfe:	48 b8 a5 02 80 00 00 	movabs $0x8002a5,%rax
+  801c05:	00 00 00 
+  801c08:	ff d0                	call   *%rax
+  801c0a:	85 c0                	test   %eax,%eax
+  801c0c:	78 26                	js     801c34 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  801c0e:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801c12:	a1 a0 40 80 00 00 00 	movabs 0x8040a0,%eax
+  801c19:	00 00 
+  801c1b:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  801c1d:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801c21:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  801c28:	48 b8 e0 06 80 00 00 	movabs $0x8006e0,%rax
+  801c2f:	00 00 00 
+  801c32:	ff d0                	call   *%rax
+}
+  801c34:	c9                   	leave
+  801c35:	c3                   	ret
+
+0000000000801c36 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  801c36:	55                   	push   %rbp
+  801c37:	48 89 e5             	mov    %rsp,%rbp
+  801c3a:	41 56                	push   %r14
+  801c3c:	41 55                	push   %r13
+  801c3e:	41 54                	push   %r12
+  801c40:	53                   	push   %rbx
+  801c41:	48 83 ec 50          	sub    $0x50,%rsp
+  801c45:	49 89 fc             	mov    %rdi,%r12
+  801c48:	41 89 f5             	mov    %esi,%r13d
+  801c4b:	48 89 d3             	mov    %rdx,%rbx
+  801c4e:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  801c52:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  801c56:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  801c5a:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  801c61:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801c65:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  801c69:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  801c6d:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  801c71:	48 b8 00 40 80 00 00 	movabs $0x804000,%rax
+  801c78:	00 00 00 
+  801c7b:	4c 8b 30             	mov    (%rax),%r14
+  801c7e:	48 b8 e5 01 80 00 00 	movabs $0x8001e5,%rax
+  801c85:	00 00 00 
+  801c88:	ff d0                	call   *%rax
+  801c8a:	89 c6                	mov    %eax,%esi
+  801c8c:	45 89 e8             	mov    %r13d,%r8d
+  801c8f:	4c 89 e1             	mov    %r12,%rcx
+  801c92:	4c 89 f2             	mov    %r14,%rdx
+  801c95:	48 bf e0 2d 80 00 00 	movabs $0x802de0,%rdi
+  801c9c:	00 00 00 
+  801c9f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ca4:	49 bc 86 1d 80 00 00 	movabs $0x801d86,%r12
+  801cab:	00 00 00 
+  801cae:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  801cb1:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  801cb5:	48 89 df             	mov    %rbx,%rdi
+  801cb8:	48 b8 22 1d 80 00 00 	movabs $0x801d22,%rax
+  801cbf:	00 00 00 
+  801cc2:	ff d0                	call   *%rax
+    cprintf("\n");
+  801cc4:	48 bf 3b 2d 80 00 00 	movabs $0x802d3b,%rdi
+  801ccb:	00 00 00 
+  801cce:	b8 00 00 00 00       	mov    $0x0,%eax
+  801cd3:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  801cd6:	cc                   	int3
+  801cd7:	eb fd                	jmp    801cd6 <_panic+0xa0>
+
+0000000000801cd9 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  801cd9:	55                   	push   %rbp
+  801cda:	48 89 e5             	mov    %rsp,%rbp
+  801cdd:	53                   	push   %rbx
+  801cde:	48 83 ec 08          	sub    $0x8,%rsp
+  801ce2:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  801ce5:	8b 06                	mov    (%rsi),%eax
+  801ce7:	8d 50 01             	lea    0x1(%rax),%edx
+  801cea:	89 16                	mov    %edx,(%rsi)
+  801cec:	48 98                	cltq
+  801cee:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  801cf3:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  801cf9:	74 0a                	je     801d05 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  801cfb:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  801cff:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801d03:	c9                   	leave
+  801d04:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  801d05:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  801d09:	be ff 00 00 00       	mov    $0xff,%esi
+  801d0e:	48 b8 1c 01 80 00 00 	movabs $0x80011c,%rax
+  801d15:	00 00 00 
+  801d18:	ff d0                	call   *%rax
+        state->offset = 0;
+  801d1a:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  801d20:	eb d9                	jmp    801cfb <putch+0x22>
+
+0000000000801d22 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  801d22:	55                   	push   %rbp
+  801d23:	48 89 e5             	mov    %rsp,%rbp
+  801d26:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  801d2d:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  801d30:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  801d37:	b9 21 00 00 00       	mov    $0x21,%ecx
+  801d3c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d41:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  801d44:	48 89 f1             	mov    %rsi,%rcx
+  801d47:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  801d4e:	48 bf d9 1c 80 00 00 	movabs $0x801cd9,%rdi
+  801d55:	00 00 00 
+  801d58:	48 b8 d6 1e 80 00 00 	movabs $0x801ed6,%rax
+  801d5f:	00 00 00 
+  801d62:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  801d64:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  801d6b:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  801d72:	48 b8 1c 01 80 00 00 	movabs $0x80011c,%rax
+  801d79:	00 00 00 
+  801d7c:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  801d7e:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  801d84:	c9                   	leave
+  801d85:	c3                   	ret
+
+0000000000801d86 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  801d86:	55                   	push   %rbp
+  801d87:	48 89 e5             	mov    %rsp,%rbp
+  801d8a:	48 83 ec 50          	sub    $0x50,%rsp
+  801d8e:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  801d92:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  801d96:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801d9a:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  801d9e:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  801da2:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  801da9:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801dad:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801db1:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  801db5:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  801db9:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  801dbd:	48 b8 22 1d 80 00 00 	movabs $0x801d22,%rax
+  801dc4:	00 00 00 
+  801dc7:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  801dc9:	c9                   	leave
+  801dca:	c3                   	ret
+
+0000000000801dcb <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  801dcb:	55                   	push   %rbp
+  801dcc:	48 89 e5             	mov    %rsp,%rbp
+  801dcf:	41 57                	push   %r15
+  801dd1:	41 56                	push   %r14
+  801dd3:	41 55                	push   %r13
+  801dd5:	41 54                	push   %r12
+  801dd7:	53                   	push   %rbx
+  801dd8:	48 83 ec 18          	sub    $0x18,%rsp
+  801ddc:	49 89 fc             	mov    %rdi,%r12
+  801ddf:	49 89 f5             	mov    %rsi,%r13
+  801de2:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801de6:	8b 45 10             	mov    0x10(%rbp),%eax
+  801de9:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  801dec:	41 89 cf             	mov    %ecx,%r15d
+  801def:	4c 39 fa             	cmp    %r15,%rdx
+  801df2:	73 5b                	jae    801e4f <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  801df4:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  801df8:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  801dfc:	85 db                	test   %ebx,%ebx
+  801dfe:	7e 0e                	jle    801e0e <print_num+0x43>
+            putch(padc, put_arg);
+  801e00:	4c 89 ee             	mov    %r13,%rsi
+  801e03:	44 89 f7             	mov    %r14d,%edi
+  801e06:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  801e09:	83 eb 01             	sub    $0x1,%ebx
+  801e0c:	75 f2                	jne    801e00 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  801e0e:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  801e12:	48 b9 14 2e 80 00 00 	movabs $0x802e14,%rcx
+  801e19:	00 00 00 
+  801e1c:	48 b8 03 2e 80 00 00 	movabs $0x802e03,%rax
+  801e23:	00 00 00 
+  801e26:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  801e2a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801e2e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e33:	49 f7 f7             	div    %r15
+  801e36:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  801e3a:	4c 89 ee             	mov    %r13,%rsi
+  801e3d:	41 ff d4             	call   *%r12
+}
+  801e40:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  801e44:	5b                   	pop    %rbx
+  801e45:	41 5c                	pop    %r12
+  801e47:	41 5d                	pop    %r13
+  801e49:	41 5e                	pop    %r14
+  801e4b:	41 5f                	pop    %r15
+  801e4d:	5d                   	pop    %rbp
+  801e4e:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  801e4f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801e53:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e58:	49 f7 f7             	div    %r15
+  801e5b:	48 83 ec 08          	sub    $0x8,%rsp
+  801e5f:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  801e63:	52                   	push   %rdx
+  801e64:	45 0f be c9          	movsbl %r9b,%r9d
+  801e68:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  801e6c:	48 89 c2             	mov    %rax,%rdx
+  801e6f:	48 b8 cb 1d 80 00 00 	movabs $0x801dcb,%rax
+  801e76:	00 00 00 
+  801e79:	ff d0                	call   *%rax
+  801e7b:	48 83 c4 10          	add    $0x10,%rsp
+  801e7f:	eb 8d                	jmp    801e0e <print_num+0x43>
+
+0000000000801e81 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  801e81:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  801e85:	48 8b 06             	mov    (%rsi),%rax
+  801e88:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  801e8c:	73 0a                	jae    801e98 <sprintputch+0x17>
+        *state->start++ = ch;
+  801e8e:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801e92:	48 89 16             	mov    %rdx,(%rsi)
+  801e95:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  801e98:	c3                   	ret
+
+0000000000801e99 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  801e99:	55                   	push   %rbp
+  801e9a:	48 89 e5             	mov    %rsp,%rbp
+  801e9d:	48 83 ec 50          	sub    $0x50,%rsp
+  801ea1:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801ea5:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  801ea9:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  801ead:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  801eb4:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801eb8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801ebc:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  801ec0:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  801ec4:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  801ec8:	48 b8 d6 1e 80 00 00 	movabs $0x801ed6,%rax
+  801ecf:	00 00 00 
+  801ed2:	ff d0                	call   *%rax
+}
+  801ed4:	c9                   	leave
+  801ed5:	c3                   	ret
+
+0000000000801ed6 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  801ed6:	55                   	push   %rbp
+  801ed7:	48 89 e5             	mov    %rsp,%rbp
+  801eda:	41 57                	push   %r15
+  801edc:	41 56                	push   %r14
+  801ede:	41 55                	push   %r13
+  801ee0:	41 54                	push   %r12
+  801ee2:	53                   	push   %rbx
+  801ee3:	48 83 ec 38          	sub    $0x38,%rsp
+  801ee7:	49 89 fe             	mov    %rdi,%r14
+  801eea:	49 89 f5             	mov    %rsi,%r13
+  801eed:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  801ef0:	48 8b 01             	mov    (%rcx),%rax
+  801ef3:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  801ef7:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  801efb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801eff:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  801f03:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  801f07:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  801f0b:	0f b6 3b             	movzbl (%rbx),%edi
+  801f0e:	40 80 ff 25          	cmp    $0x25,%dil
+  801f12:	74 18                	je     801f2c <vprintfmt+0x56>
+            if (!ch) return;
+  801f14:	40 84 ff             	test   %dil,%dil
+  801f17:	0f 84 b1 06 00 00    	je     8025ce <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  801f1d:	40 0f b6 ff          	movzbl %dil,%edi
+  801f21:	4c 89 ee             	mov    %r13,%rsi
+  801f24:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  801f27:	4c 89 e3             	mov    %r12,%rbx
+  801f2a:	eb db                	jmp    801f07 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  801f2c:	be 00 00 00 00       	mov    $0x0,%esi
+  801f31:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  801f35:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  801f3a:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  801f40:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  801f47:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  801f4b:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  801f50:	41 0f b6 04 24       	movzbl (%r12),%eax
+  801f55:	88 45 a0             	mov    %al,-0x60(%rbp)
+  801f58:	83 e8 23             	sub    $0x23,%eax
+  801f5b:	3c 57                	cmp    $0x57,%al
+  801f5d:	0f 87 51 06 00 00    	ja     8025b4 <vprintfmt+0x6de>
+  801f63:	0f b6 c0             	movzbl %al,%eax
+  801f66:	48 b9 c0 2f 80 00 00 	movabs $0x802fc0,%rcx
+  801f6d:	00 00 00 
+  801f70:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  801f73:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  801f76:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  801f7a:	eb cf                	jmp    801f4b <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  801f7c:	49 89 dc             	mov    %rbx,%r12
+  801f7f:	be 01 00 00 00       	mov    $0x1,%esi
+  801f84:	eb c5                	jmp    801f4b <vprintfmt+0x75>
+            padc = ch;
+  801f86:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  801f8a:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  801f8d:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801f90:	eb b9                	jmp    801f4b <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  801f92:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801f95:	83 f8 2f             	cmp    $0x2f,%eax
+  801f98:	77 24                	ja     801fbe <vprintfmt+0xe8>
+  801f9a:	89 c1                	mov    %eax,%ecx
+  801f9c:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  801fa0:	83 c0 08             	add    $0x8,%eax
+  801fa3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801fa6:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  801fa9:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  801fac:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  801fb0:	79 99                	jns    801f4b <vprintfmt+0x75>
+                width = precision;
+  801fb2:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  801fb6:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  801fbc:	eb 8d                	jmp    801f4b <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  801fbe:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  801fc2:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  801fc6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801fca:	eb da                	jmp    801fa6 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  801fcc:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  801fd1:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  801fd5:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  801fdb:	3c 39                	cmp    $0x39,%al
+  801fdd:	77 1c                	ja     801ffb <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  801fdf:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  801fe3:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  801fe7:	0f b6 c0             	movzbl %al,%eax
+  801fea:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  801fef:	0f b6 03             	movzbl (%rbx),%eax
+  801ff2:	3c 39                	cmp    $0x39,%al
+  801ff4:	76 e9                	jbe    801fdf <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  801ff6:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  801ff9:	eb b1                	jmp    801fac <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  801ffb:	49 89 dc             	mov    %rbx,%r12
+  801ffe:	eb ac                	jmp    801fac <vprintfmt+0xd6>
+            width = MAX(0, width);
+  802000:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  802003:	85 c9                	test   %ecx,%ecx
+  802005:	b8 00 00 00 00       	mov    $0x0,%eax
+  80200a:	0f 49 c1             	cmovns %ecx,%eax
+  80200d:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  802010:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  802013:	e9 33 ff ff ff       	jmp    801f4b <vprintfmt+0x75>
+            lflag++;
+  802018:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  80201b:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80201e:	e9 28 ff ff ff       	jmp    801f4b <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  802023:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802026:	83 f8 2f             	cmp    $0x2f,%eax
+  802029:	77 19                	ja     802044 <vprintfmt+0x16e>
+  80202b:	89 c2                	mov    %eax,%edx
+  80202d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802031:	83 c0 08             	add    $0x8,%eax
+  802034:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802037:	8b 3a                	mov    (%rdx),%edi
+  802039:	4c 89 ee             	mov    %r13,%rsi
+  80203c:	41 ff d6             	call   *%r14
+            break;
+  80203f:	e9 c3 fe ff ff       	jmp    801f07 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  802044:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802048:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80204c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802050:	eb e5                	jmp    802037 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  802052:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802055:	83 f8 2f             	cmp    $0x2f,%eax
+  802058:	77 5a                	ja     8020b4 <vprintfmt+0x1de>
+  80205a:	89 c2                	mov    %eax,%edx
+  80205c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802060:	83 c0 08             	add    $0x8,%eax
+  802063:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  802066:	8b 02                	mov    (%rdx),%eax
+  802068:	89 c1                	mov    %eax,%ecx
+  80206a:	f7 d9                	neg    %ecx
+  80206c:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  80206f:	83 f9 15             	cmp    $0x15,%ecx
+  802072:	7f 4e                	jg     8020c2 <vprintfmt+0x1ec>
+  802074:	48 63 c1             	movslq %ecx,%rax
+  802077:	48 ba 80 32 80 00 00 	movabs $0x803280,%rdx
+  80207e:	00 00 00 
+  802081:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802085:	48 85 c0             	test   %rax,%rax
+  802088:	74 38                	je     8020c2 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  80208a:	48 89 c1             	mov    %rax,%rcx
+  80208d:	48 ba 99 2d 80 00 00 	movabs $0x802d99,%rdx
+  802094:	00 00 00 
+  802097:	4c 89 ee             	mov    %r13,%rsi
+  80209a:	4c 89 f7             	mov    %r14,%rdi
+  80209d:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020a2:	49 b8 99 1e 80 00 00 	movabs $0x801e99,%r8
+  8020a9:	00 00 00 
+  8020ac:	41 ff d0             	call   *%r8
+  8020af:	e9 53 fe ff ff       	jmp    801f07 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  8020b4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8020b8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8020bc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8020c0:	eb a4                	jmp    802066 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  8020c2:	48 ba 2c 2e 80 00 00 	movabs $0x802e2c,%rdx
+  8020c9:	00 00 00 
+  8020cc:	4c 89 ee             	mov    %r13,%rsi
+  8020cf:	4c 89 f7             	mov    %r14,%rdi
+  8020d2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020d7:	49 b8 99 1e 80 00 00 	movabs $0x801e99,%r8
+  8020de:	00 00 00 
+  8020e1:	41 ff d0             	call   *%r8
+  8020e4:	e9 1e fe ff ff       	jmp    801f07 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8020e9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8020ec:	83 f8 2f             	cmp    $0x2f,%eax
+  8020ef:	77 6c                	ja     80215d <vprintfmt+0x287>
+  8020f1:	89 c2                	mov    %eax,%edx
+  8020f3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8020f7:	83 c0 08             	add    $0x8,%eax
+  8020fa:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8020fd:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  802100:	48 85 d2             	test   %rdx,%rdx
+  802103:	48 b8 25 2e 80 00 00 	movabs $0x802e25,%rax
+  80210a:	00 00 00 
+  80210d:	48 0f 45 c2          	cmovne %rdx,%rax
+  802111:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  802115:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  802119:	7e 06                	jle    802121 <vprintfmt+0x24b>
+  80211b:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  80211f:	75 4a                	jne    80216b <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  802121:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  802125:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  802129:	0f b6 00             	movzbl (%rax),%eax
+  80212c:	84 c0                	test   %al,%al
+  80212e:	0f 85 9a 00 00 00    	jne    8021ce <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  802134:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  802137:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  80213b:	85 c0                	test   %eax,%eax
+  80213d:	0f 8e c4 fd ff ff    	jle    801f07 <vprintfmt+0x31>
+  802143:	4c 89 ee             	mov    %r13,%rsi
+  802146:	bf 20 00 00 00       	mov    $0x20,%edi
+  80214b:	41 ff d6             	call   *%r14
+  80214e:	41 83 ec 01          	sub    $0x1,%r12d
+  802152:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  802156:	75 eb                	jne    802143 <vprintfmt+0x26d>
+  802158:	e9 aa fd ff ff       	jmp    801f07 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  80215d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802161:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802165:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802169:	eb 92                	jmp    8020fd <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  80216b:	49 63 f7             	movslq %r15d,%rsi
+  80216e:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  802172:	48 b8 88 26 80 00 00 	movabs $0x802688,%rax
+  802179:	00 00 00 
+  80217c:	ff d0                	call   *%rax
+  80217e:	48 89 c2             	mov    %rax,%rdx
+  802181:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  802184:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  802186:	8d 70 ff             	lea    -0x1(%rax),%esi
+  802189:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  80218c:	85 c0                	test   %eax,%eax
+  80218e:	7e 91                	jle    802121 <vprintfmt+0x24b>
+  802190:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  802195:	4c 89 ee             	mov    %r13,%rsi
+  802198:	44 89 e7             	mov    %r12d,%edi
+  80219b:	41 ff d6             	call   *%r14
+  80219e:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8021a2:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8021a5:	83 f8 ff             	cmp    $0xffffffff,%eax
+  8021a8:	75 eb                	jne    802195 <vprintfmt+0x2bf>
+  8021aa:	e9 72 ff ff ff       	jmp    802121 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8021af:	0f b6 f8             	movzbl %al,%edi
+  8021b2:	4c 89 ee             	mov    %r13,%rsi
+  8021b5:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8021b8:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8021bc:	49 83 c4 01          	add    $0x1,%r12
+  8021c0:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  8021c6:	84 c0                	test   %al,%al
+  8021c8:	0f 84 66 ff ff ff    	je     802134 <vprintfmt+0x25e>
+  8021ce:	45 85 ff             	test   %r15d,%r15d
+  8021d1:	78 0a                	js     8021dd <vprintfmt+0x307>
+  8021d3:	41 83 ef 01          	sub    $0x1,%r15d
+  8021d7:	0f 88 57 ff ff ff    	js     802134 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8021dd:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  8021e1:	74 cc                	je     8021af <vprintfmt+0x2d9>
+  8021e3:	8d 50 e0             	lea    -0x20(%rax),%edx
+  8021e6:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  8021eb:	80 fa 5e             	cmp    $0x5e,%dl
+  8021ee:	77 c2                	ja     8021b2 <vprintfmt+0x2dc>
+  8021f0:	eb bd                	jmp    8021af <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  8021f2:	40 84 f6             	test   %sil,%sil
+  8021f5:	75 26                	jne    80221d <vprintfmt+0x347>
+    switch (lflag) {
+  8021f7:	85 d2                	test   %edx,%edx
+  8021f9:	74 59                	je     802254 <vprintfmt+0x37e>
+  8021fb:	83 fa 01             	cmp    $0x1,%edx
+  8021fe:	74 7b                	je     80227b <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  802200:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802203:	83 f8 2f             	cmp    $0x2f,%eax
+  802206:	0f 87 96 00 00 00    	ja     8022a2 <vprintfmt+0x3cc>
+  80220c:	89 c2                	mov    %eax,%edx
+  80220e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802212:	83 c0 08             	add    $0x8,%eax
+  802215:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802218:	4c 8b 22             	mov    (%rdx),%r12
+  80221b:	eb 17                	jmp    802234 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  80221d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802220:	83 f8 2f             	cmp    $0x2f,%eax
+  802223:	77 21                	ja     802246 <vprintfmt+0x370>
+  802225:	89 c2                	mov    %eax,%edx
+  802227:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80222b:	83 c0 08             	add    $0x8,%eax
+  80222e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802231:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  802234:	4d 85 e4             	test   %r12,%r12
+  802237:	78 7a                	js     8022b3 <vprintfmt+0x3dd>
+            num = i;
+  802239:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  80223c:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  802241:	e9 50 02 00 00       	jmp    802496 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  802246:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80224a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80224e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802252:	eb dd                	jmp    802231 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  802254:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802257:	83 f8 2f             	cmp    $0x2f,%eax
+  80225a:	77 11                	ja     80226d <vprintfmt+0x397>
+  80225c:	89 c2                	mov    %eax,%edx
+  80225e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802262:	83 c0 08             	add    $0x8,%eax
+  802265:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802268:	4c 63 22             	movslq (%rdx),%r12
+  80226b:	eb c7                	jmp    802234 <vprintfmt+0x35e>
+  80226d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802271:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802275:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802279:	eb ed                	jmp    802268 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  80227b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80227e:	83 f8 2f             	cmp    $0x2f,%eax
+  802281:	77 11                	ja     802294 <vprintfmt+0x3be>
+  802283:	89 c2                	mov    %eax,%edx
+  802285:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802289:	83 c0 08             	add    $0x8,%eax
+  80228c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80228f:	4c 8b 22             	mov    (%rdx),%r12
+  802292:	eb a0                	jmp    802234 <vprintfmt+0x35e>
+  802294:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802298:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80229c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8022a0:	eb ed                	jmp    80228f <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  8022a2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8022a6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8022aa:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8022ae:	e9 65 ff ff ff       	jmp    802218 <vprintfmt+0x342>
+                putch('-', put_arg);
+  8022b3:	4c 89 ee             	mov    %r13,%rsi
+  8022b6:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  8022bb:	41 ff d6             	call   *%r14
+                i = -i;
+  8022be:	49 f7 dc             	neg    %r12
+  8022c1:	e9 73 ff ff ff       	jmp    802239 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  8022c6:	40 84 f6             	test   %sil,%sil
+  8022c9:	75 32                	jne    8022fd <vprintfmt+0x427>
+    switch (lflag) {
+  8022cb:	85 d2                	test   %edx,%edx
+  8022cd:	74 5d                	je     80232c <vprintfmt+0x456>
+  8022cf:	83 fa 01             	cmp    $0x1,%edx
+  8022d2:	0f 84 82 00 00 00    	je     80235a <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  8022d8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8022db:	83 f8 2f             	cmp    $0x2f,%eax
+  8022de:	0f 87 a5 00 00 00    	ja     802389 <vprintfmt+0x4b3>
+  8022e4:	89 c2                	mov    %eax,%edx
+  8022e6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8022ea:	83 c0 08             	add    $0x8,%eax
+  8022ed:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8022f0:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8022f3:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  8022f8:	e9 99 01 00 00       	jmp    802496 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8022fd:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802300:	83 f8 2f             	cmp    $0x2f,%eax
+  802303:	77 19                	ja     80231e <vprintfmt+0x448>
+  802305:	89 c2                	mov    %eax,%edx
+  802307:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80230b:	83 c0 08             	add    $0x8,%eax
+  80230e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802311:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  802314:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  802319:	e9 78 01 00 00       	jmp    802496 <vprintfmt+0x5c0>
+  80231e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802322:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802326:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80232a:	eb e5                	jmp    802311 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  80232c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80232f:	83 f8 2f             	cmp    $0x2f,%eax
+  802332:	77 18                	ja     80234c <vprintfmt+0x476>
+  802334:	89 c2                	mov    %eax,%edx
+  802336:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80233a:	83 c0 08             	add    $0x8,%eax
+  80233d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802340:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  802342:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  802347:	e9 4a 01 00 00       	jmp    802496 <vprintfmt+0x5c0>
+  80234c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802350:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802354:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802358:	eb e6                	jmp    802340 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  80235a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80235d:	83 f8 2f             	cmp    $0x2f,%eax
+  802360:	77 19                	ja     80237b <vprintfmt+0x4a5>
+  802362:	89 c2                	mov    %eax,%edx
+  802364:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802368:	83 c0 08             	add    $0x8,%eax
+  80236b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80236e:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  802371:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  802376:	e9 1b 01 00 00       	jmp    802496 <vprintfmt+0x5c0>
+  80237b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80237f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802383:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802387:	eb e5                	jmp    80236e <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  802389:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80238d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802391:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802395:	e9 56 ff ff ff       	jmp    8022f0 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  80239a:	40 84 f6             	test   %sil,%sil
+  80239d:	75 2e                	jne    8023cd <vprintfmt+0x4f7>
+    switch (lflag) {
+  80239f:	85 d2                	test   %edx,%edx
+  8023a1:	74 59                	je     8023fc <vprintfmt+0x526>
+  8023a3:	83 fa 01             	cmp    $0x1,%edx
+  8023a6:	74 7f                	je     802427 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  8023a8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8023ab:	83 f8 2f             	cmp    $0x2f,%eax
+  8023ae:	0f 87 9f 00 00 00    	ja     802453 <vprintfmt+0x57d>
+  8023b4:	89 c2                	mov    %eax,%edx
+  8023b6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8023ba:	83 c0 08             	add    $0x8,%eax
+  8023bd:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8023c0:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8023c3:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  8023c8:	e9 c9 00 00 00       	jmp    802496 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8023cd:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8023d0:	83 f8 2f             	cmp    $0x2f,%eax
+  8023d3:	77 19                	ja     8023ee <vprintfmt+0x518>
+  8023d5:	89 c2                	mov    %eax,%edx
+  8023d7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8023db:	83 c0 08             	add    $0x8,%eax
+  8023de:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8023e1:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8023e4:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8023e9:	e9 a8 00 00 00       	jmp    802496 <vprintfmt+0x5c0>
+  8023ee:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8023f2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8023f6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8023fa:	eb e5                	jmp    8023e1 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  8023fc:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8023ff:	83 f8 2f             	cmp    $0x2f,%eax
+  802402:	77 15                	ja     802419 <vprintfmt+0x543>
+  802404:	89 c2                	mov    %eax,%edx
+  802406:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80240a:	83 c0 08             	add    $0x8,%eax
+  80240d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802410:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  802412:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  802417:	eb 7d                	jmp    802496 <vprintfmt+0x5c0>
+  802419:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80241d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802421:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802425:	eb e9                	jmp    802410 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  802427:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80242a:	83 f8 2f             	cmp    $0x2f,%eax
+  80242d:	77 16                	ja     802445 <vprintfmt+0x56f>
+  80242f:	89 c2                	mov    %eax,%edx
+  802431:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802435:	83 c0 08             	add    $0x8,%eax
+  802438:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80243b:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  80243e:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  802443:	eb 51                	jmp    802496 <vprintfmt+0x5c0>
+  802445:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802449:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80244d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802451:	eb e8                	jmp    80243b <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  802453:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802457:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80245b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80245f:	e9 5c ff ff ff       	jmp    8023c0 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  802464:	4c 89 ee             	mov    %r13,%rsi
+  802467:	bf 30 00 00 00       	mov    $0x30,%edi
+  80246c:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  80246f:	4c 89 ee             	mov    %r13,%rsi
+  802472:	bf 78 00 00 00       	mov    $0x78,%edi
+  802477:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  80247a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80247d:	83 f8 2f             	cmp    $0x2f,%eax
+  802480:	77 47                	ja     8024c9 <vprintfmt+0x5f3>
+  802482:	89 c2                	mov    %eax,%edx
+  802484:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802488:	83 c0 08             	add    $0x8,%eax
+  80248b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80248e:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  802491:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  802496:	48 83 ec 08          	sub    $0x8,%rsp
+  80249a:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  80249e:	0f 94 c0             	sete   %al
+  8024a1:	0f b6 c0             	movzbl %al,%eax
+  8024a4:	50                   	push   %rax
+  8024a5:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  8024aa:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  8024ae:	4c 89 ee             	mov    %r13,%rsi
+  8024b1:	4c 89 f7             	mov    %r14,%rdi
+  8024b4:	48 b8 cb 1d 80 00 00 	movabs $0x801dcb,%rax
+  8024bb:	00 00 00 
+  8024be:	ff d0                	call   *%rax
+            break;
+  8024c0:	48 83 c4 10          	add    $0x10,%rsp
+  8024c4:	e9 3e fa ff ff       	jmp    801f07 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  8024c9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8024cd:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8024d1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8024d5:	eb b7                	jmp    80248e <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  8024d7:	40 84 f6             	test   %sil,%sil
+  8024da:	75 2b                	jne    802507 <vprintfmt+0x631>
+    switch (lflag) {
+  8024dc:	85 d2                	test   %edx,%edx
+  8024de:	74 56                	je     802536 <vprintfmt+0x660>
+  8024e0:	83 fa 01             	cmp    $0x1,%edx
+  8024e3:	74 7f                	je     802564 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  8024e5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8024e8:	83 f8 2f             	cmp    $0x2f,%eax
+  8024eb:	0f 87 a2 00 00 00    	ja     802593 <vprintfmt+0x6bd>
+  8024f1:	89 c2                	mov    %eax,%edx
+  8024f3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8024f7:	83 c0 08             	add    $0x8,%eax
+  8024fa:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8024fd:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  802500:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  802505:	eb 8f                	jmp    802496 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  802507:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80250a:	83 f8 2f             	cmp    $0x2f,%eax
+  80250d:	77 19                	ja     802528 <vprintfmt+0x652>
+  80250f:	89 c2                	mov    %eax,%edx
+  802511:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802515:	83 c0 08             	add    $0x8,%eax
+  802518:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80251b:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  80251e:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  802523:	e9 6e ff ff ff       	jmp    802496 <vprintfmt+0x5c0>
+  802528:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80252c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802530:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802534:	eb e5                	jmp    80251b <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  802536:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802539:	83 f8 2f             	cmp    $0x2f,%eax
+  80253c:	77 18                	ja     802556 <vprintfmt+0x680>
+  80253e:	89 c2                	mov    %eax,%edx
+  802540:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802544:	83 c0 08             	add    $0x8,%eax
+  802547:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80254a:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  80254c:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  802551:	e9 40 ff ff ff       	jmp    802496 <vprintfmt+0x5c0>
+  802556:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80255a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80255e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802562:	eb e6                	jmp    80254a <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  802564:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802567:	83 f8 2f             	cmp    $0x2f,%eax
+  80256a:	77 19                	ja     802585 <vprintfmt+0x6af>
+  80256c:	89 c2                	mov    %eax,%edx
+  80256e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802572:	83 c0 08             	add    $0x8,%eax
+  802575:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802578:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  80257b:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  802580:	e9 11 ff ff ff       	jmp    802496 <vprintfmt+0x5c0>
+  802585:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802589:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80258d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802591:	eb e5                	jmp    802578 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  802593:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802597:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80259b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80259f:	e9 59 ff ff ff       	jmp    8024fd <vprintfmt+0x627>
+            putch(ch, put_arg);
+  8025a4:	4c 89 ee             	mov    %r13,%rsi
+  8025a7:	bf 25 00 00 00       	mov    $0x25,%edi
+  8025ac:	41 ff d6             	call   *%r14
+            break;
+  8025af:	e9 53 f9 ff ff       	jmp    801f07 <vprintfmt+0x31>
+            putch('%', put_arg);
+  8025b4:	4c 89 ee             	mov    %r13,%rsi
+  8025b7:	bf 25 00 00 00       	mov    $0x25,%edi
+  8025bc:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  8025bf:	48 83 eb 01          	sub    $0x1,%rbx
+  8025c3:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  8025c7:	75 f6                	jne    8025bf <vprintfmt+0x6e9>
+  8025c9:	e9 39 f9 ff ff       	jmp    801f07 <vprintfmt+0x31>
+}
+  8025ce:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8025d2:	5b                   	pop    %rbx
+  8025d3:	41 5c                	pop    %r12
+  8025d5:	41 5d                	pop    %r13
+  8025d7:	41 5e                	pop    %r14
+  8025d9:	41 5f                	pop    %r15
+  8025db:	5d                   	pop    %rbp
+  8025dc:	c3                   	ret
+
+00000000008025dd <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  8025dd:	55                   	push   %rbp
+  8025de:	48 89 e5             	mov    %rsp,%rbp
+  8025e1:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  8025e5:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8025e9:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  8025ee:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  8025f2:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  8025f9:	48 85 ff             	test   %rdi,%rdi
+  8025fc:	74 2b                	je     802629 <vsnprintf+0x4c>
+  8025fe:	48 85 f6             	test   %rsi,%rsi
+  802601:	74 26                	je     802629 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  802603:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802607:	48 bf 81 1e 80 00 00 	movabs $0x801e81,%rdi
+  80260e:	00 00 00 
+  802611:	48 b8 d6 1e 80 00 00 	movabs $0x801ed6,%rax
+  802618:	00 00 00 
+  80261b:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  80261d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802621:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  802624:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  802627:	c9                   	leave
+  802628:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  802629:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80262e:	eb f7                	jmp    802627 <vsnprintf+0x4a>
+
+0000000000802630 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  802630:	55                   	push   %rbp
+  802631:	48 89 e5             	mov    %rsp,%rbp
+  802634:	48 83 ec 50          	sub    $0x50,%rsp
+  802638:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80263c:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  802640:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  802644:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  80264b:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80264f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802653:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  802657:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  80265b:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80265f:	48 b8 dd 25 80 00 00 	movabs $0x8025dd,%rax
+  802666:	00 00 00 
+  802669:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  80266b:	c9                   	leave
+  80266c:	c3                   	ret
+
+000000000080266d <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  80266d:	80 3f 00             	cmpb   $0x0,(%rdi)
+  802670:	74 10                	je     802682 <strlen+0x15>
+    size_t n = 0;
+  802672:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  802677:	48 83 c0 01          	add    $0x1,%rax
+  80267b:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  80267f:	75 f6                	jne    802677 <strlen+0xa>
+  802681:	c3                   	ret
+    size_t n = 0;
+  802682:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  802687:	c3                   	ret
+
+0000000000802688 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  802688:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  80268b:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  802690:	48 85 f6             	test   %rsi,%rsi
+  802693:	74 11                	je     8026a6 <strnlen+0x1e>
+  802695:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  802699:	74 0c                	je     8026a7 <strnlen+0x1f>
+  80269b:	48 83 c2 01          	add    $0x1,%rdx
+  80269f:	48 39 d0             	cmp    %rdx,%rax
+  8026a2:	75 f1                	jne    802695 <strnlen+0xd>
+  8026a4:	eb 04                	jmp    8026aa <strnlen+0x22>
+  8026a6:	c3                   	ret
+  8026a7:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  8026aa:	c3                   	ret
+
+00000000008026ab <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  8026ab:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  8026ae:	ba 00 00 00 00       	mov    $0x0,%edx
+  8026b3:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  8026b7:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  8026ba:	48 83 c2 01          	add    $0x1,%rdx
+  8026be:	84 c9                	test   %cl,%cl
+  8026c0:	75 f1                	jne    8026b3 <strcpy+0x8>
+        ;
+    return res;
+}
+  8026c2:	c3                   	ret
+
+00000000008026c3 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  8026c3:	55                   	push   %rbp
+  8026c4:	48 89 e5             	mov    %rsp,%rbp
+  8026c7:	41 54                	push   %r12
+  8026c9:	53                   	push   %rbx
+  8026ca:	48 89 fb             	mov    %rdi,%rbx
+  8026cd:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  8026d0:	48 b8 6d 26 80 00 00 	movabs $0x80266d,%rax
+  8026d7:	00 00 00 
+  8026da:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  8026dc:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  8026e0:	4c 89 e6             	mov    %r12,%rsi
+  8026e3:	48 b8 ab 26 80 00 00 	movabs $0x8026ab,%rax
+  8026ea:	00 00 00 
+  8026ed:	ff d0                	call   *%rax
+    return dst;
+}
+  8026ef:	48 89 d8             	mov    %rbx,%rax
+  8026f2:	5b                   	pop    %rbx
+  8026f3:	41 5c                	pop    %r12
+  8026f5:	5d                   	pop    %rbp
+  8026f6:	c3                   	ret
+
+00000000008026f7 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8026f7:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  8026fa:	48 85 d2             	test   %rdx,%rdx
+  8026fd:	74 1f                	je     80271e <strncpy+0x27>
+  8026ff:	48 01 fa             	add    %rdi,%rdx
+  802702:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  802705:	48 83 c1 01          	add    $0x1,%rcx
+  802709:	44 0f b6 06          	movzbl (%rsi),%r8d
+  80270d:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  802711:	41 80 f8 01          	cmp    $0x1,%r8b
+  802715:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  802719:	48 39 ca             	cmp    %rcx,%rdx
+  80271c:	75 e7                	jne    802705 <strncpy+0xe>
+    }
+    return ret;
+}
+  80271e:	c3                   	ret
+
+000000000080271f <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  80271f:	48 89 f8             	mov    %rdi,%rax
+  802722:	48 85 d2             	test   %rdx,%rdx
+  802725:	74 24                	je     80274b <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  802727:	48 83 ea 01          	sub    $0x1,%rdx
+  80272b:	74 1b                	je     802748 <strlcpy+0x29>
+  80272d:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  802731:	0f b6 16             	movzbl (%rsi),%edx
+  802734:	84 d2                	test   %dl,%dl
+  802736:	74 10                	je     802748 <strlcpy+0x29>
+            *dst++ = *src++;
+  802738:	48 83 c6 01          	add    $0x1,%rsi
+  80273c:	48 83 c0 01          	add    $0x1,%rax
+  802740:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  802743:	48 39 c8             	cmp    %rcx,%rax
+  802746:	75 e9                	jne    802731 <strlcpy+0x12>
+        *dst = '\0';
+  802748:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  80274b:	48 29 f8             	sub    %rdi,%rax
+}
+  80274e:	c3                   	ret
+
+000000000080274f <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  80274f:	0f b6 07             	movzbl (%rdi),%eax
+  802752:	84 c0                	test   %al,%al
+  802754:	74 13                	je     802769 <strcmp+0x1a>
+  802756:	38 06                	cmp    %al,(%rsi)
+  802758:	75 0f                	jne    802769 <strcmp+0x1a>
+  80275a:	48 83 c7 01          	add    $0x1,%rdi
+  80275e:	48 83 c6 01          	add    $0x1,%rsi
+  802762:	0f b6 07             	movzbl (%rdi),%eax
+  802765:	84 c0                	test   %al,%al
+  802767:	75 ed                	jne    802756 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  802769:	0f b6 c0             	movzbl %al,%eax
+  80276c:	0f b6 16             	movzbl (%rsi),%edx
+  80276f:	29 d0                	sub    %edx,%eax
+}
+  802771:	c3                   	ret
+
+0000000000802772 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  802772:	48 85 d2             	test   %rdx,%rdx
+  802775:	74 1f                	je     802796 <strncmp+0x24>
+  802777:	0f b6 07             	movzbl (%rdi),%eax
+  80277a:	84 c0                	test   %al,%al
+  80277c:	74 1e                	je     80279c <strncmp+0x2a>
+  80277e:	3a 06                	cmp    (%rsi),%al
+  802780:	75 1a                	jne    80279c <strncmp+0x2a>
+  802782:	48 83 c7 01          	add    $0x1,%rdi
+  802786:	48 83 c6 01          	add    $0x1,%rsi
+  80278a:	48 83 ea 01          	sub    $0x1,%rdx
+  80278e:	75 e7                	jne    802777 <strncmp+0x5>
+
+    if (!n) return 0;
+  802790:	b8 00 00 00 00       	mov    $0x0,%eax
+  802795:	c3                   	ret
+  802796:	b8 00 00 00 00       	mov    $0x0,%eax
+  80279b:	c3                   	ret
+  80279c:	48 85 d2             	test   %rdx,%rdx
+  80279f:	74 09                	je     8027aa <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  8027a1:	0f b6 07             	movzbl (%rdi),%eax
+  8027a4:	0f b6 16             	movzbl (%rsi),%edx
+  8027a7:	29 d0                	sub    %edx,%eax
+  8027a9:	c3                   	ret
+    if (!n) return 0;
+  8027aa:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8027af:	c3                   	ret
+
+00000000008027b0 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  8027b0:	0f b6 17             	movzbl (%rdi),%edx
+  8027b3:	84 d2                	test   %dl,%dl
+  8027b5:	74 18                	je     8027cf <strchr+0x1f>
+        if (*str == c) {
+  8027b7:	0f be d2             	movsbl %dl,%edx
+  8027ba:	39 f2                	cmp    %esi,%edx
+  8027bc:	74 17                	je     8027d5 <strchr+0x25>
+    for (; *str; str++) {
+  8027be:	48 83 c7 01          	add    $0x1,%rdi
+  8027c2:	0f b6 17             	movzbl (%rdi),%edx
+  8027c5:	84 d2                	test   %dl,%dl
+  8027c7:	75 ee                	jne    8027b7 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  8027c9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027ce:	c3                   	ret
+  8027cf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027d4:	c3                   	ret
+  8027d5:	48 89 f8             	mov    %rdi,%rax
+}
+  8027d8:	c3                   	ret
+
+00000000008027d9 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  8027d9:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  8027dc:	0f b6 17             	movzbl (%rdi),%edx
+  8027df:	84 d2                	test   %dl,%dl
+  8027e1:	74 13                	je     8027f6 <strfind+0x1d>
+  8027e3:	0f be d2             	movsbl %dl,%edx
+  8027e6:	39 f2                	cmp    %esi,%edx
+  8027e8:	74 0b                	je     8027f5 <strfind+0x1c>
+  8027ea:	48 83 c0 01          	add    $0x1,%rax
+  8027ee:	0f b6 10             	movzbl (%rax),%edx
+  8027f1:	84 d2                	test   %dl,%dl
+  8027f3:	75 ee                	jne    8027e3 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  8027f5:	c3                   	ret
+  8027f6:	c3                   	ret
+
+00000000008027f7 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  8027f7:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  8027fa:	48 89 f8             	mov    %rdi,%rax
+  8027fd:	48 f7 d8             	neg    %rax
+  802800:	83 e0 07             	and    $0x7,%eax
+  802803:	49 89 d1             	mov    %rdx,%r9
+  802806:	49 29 c1             	sub    %rax,%r9
+  802809:	78 36                	js     802841 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  80280b:	40 0f b6 c6          	movzbl %sil,%eax
+  80280f:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  802816:	01 01 01 
+  802819:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  80281d:	40 f6 c7 07          	test   $0x7,%dil
+  802821:	75 38                	jne    80285b <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  802823:	4c 89 c9             	mov    %r9,%rcx
+  802826:	48 c1 f9 03          	sar    $0x3,%rcx
+  80282a:	74 0c                	je     802838 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  80282c:	fc                   	cld
+  80282d:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  802830:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  802834:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  802838:	4d 85 c9             	test   %r9,%r9
+  80283b:	75 45                	jne    802882 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  80283d:	4c 89 c0             	mov    %r8,%rax
+  802840:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  802841:	48 85 d2             	test   %rdx,%rdx
+  802844:	74 f7                	je     80283d <memset+0x46>
+  802846:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  802849:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  80284c:	48 83 c0 01          	add    $0x1,%rax
+  802850:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  802854:	48 39 c2             	cmp    %rax,%rdx
+  802857:	75 f3                	jne    80284c <memset+0x55>
+  802859:	eb e2                	jmp    80283d <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  80285b:	40 f6 c7 01          	test   $0x1,%dil
+  80285f:	74 06                	je     802867 <memset+0x70>
+  802861:	88 07                	mov    %al,(%rdi)
+  802863:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  802867:	40 f6 c7 02          	test   $0x2,%dil
+  80286b:	74 07                	je     802874 <memset+0x7d>
+  80286d:	66 89 07             	mov    %ax,(%rdi)
+  802870:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  802874:	40 f6 c7 04          	test   $0x4,%dil
+  802878:	74 a9                	je     802823 <memset+0x2c>
+  80287a:	89 07                	mov    %eax,(%rdi)
+  80287c:	48 83 c7 04          	add    $0x4,%rdi
+  802880:	eb a1                	jmp    802823 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  802882:	41 f6 c1 04          	test   $0x4,%r9b
+  802886:	74 06                	je     80288e <memset+0x97>
+  802888:	89 07                	mov    %eax,(%rdi)
+  80288a:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  80288e:	41 f6 c1 02          	test   $0x2,%r9b
+  802892:	74 07                	je     80289b <memset+0xa4>
+  802894:	66 89 07             	mov    %ax,(%rdi)
+  802897:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  80289b:	41 f6 c1 01          	test   $0x1,%r9b
+  80289f:	74 9c                	je     80283d <memset+0x46>
+  8028a1:	88 07                	mov    %al,(%rdi)
+  8028a3:	eb 98                	jmp    80283d <memset+0x46>
+
+00000000008028a5 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  8028a5:	48 89 f8             	mov    %rdi,%rax
+  8028a8:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  8028ab:	48 39 fe             	cmp    %rdi,%rsi
+  8028ae:	73 3b                	jae    8028eb <memmove+0x46>
+  8028b0:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  8028b4:	48 39 d7             	cmp    %rdx,%rdi
+  8028b7:	73 32                	jae    8028eb <memmove+0x46>
+        s += n;
+        d += n;
+  8028b9:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  8028bd:	48 89 d6             	mov    %rdx,%rsi
+  8028c0:	48 09 fe             	or     %rdi,%rsi
+  8028c3:	48 09 ce             	or     %rcx,%rsi
+  8028c6:	40 f6 c6 07          	test   $0x7,%sil
+  8028ca:	75 12                	jne    8028de <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  8028cc:	48 83 ef 08          	sub    $0x8,%rdi
+  8028d0:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  8028d4:	48 c1 e9 03          	shr    $0x3,%rcx
+  8028d8:	fd                   	std
+  8028d9:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  8028dc:	fc                   	cld
+  8028dd:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  8028de:	48 83 ef 01          	sub    $0x1,%rdi
+  8028e2:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  8028e6:	fd                   	std
+  8028e7:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  8028e9:	eb f1                	jmp    8028dc <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  8028eb:	48 89 f2             	mov    %rsi,%rdx
+  8028ee:	48 09 c2             	or     %rax,%rdx
+  8028f1:	48 09 ca             	or     %rcx,%rdx
+  8028f4:	f6 c2 07             	test   $0x7,%dl
+  8028f7:	75 0c                	jne    802905 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  8028f9:	48 c1 e9 03          	shr    $0x3,%rcx
+  8028fd:	48 89 c7             	mov    %rax,%rdi
+  802900:	fc                   	cld
+  802901:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  802904:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  802905:	48 89 c7             	mov    %rax,%rdi
+  802908:	fc                   	cld
+  802909:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  80290b:	c3                   	ret
+
+000000000080290c <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  80290c:	55                   	push   %rbp
+  80290d:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  802910:	48 b8 a5 28 80 00 00 	movabs $0x8028a5,%rax
+  802917:	00 00 00 
+  80291a:	ff d0                	call   *%rax
+}
+  80291c:	5d                   	pop    %rbp
+  80291d:	c3                   	ret
+
+000000000080291e <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  80291e:	55                   	push   %rbp
+  80291f:	48 89 e5             	mov    %rsp,%rbp
+  802922:	41 57                	push   %r15
+  802924:	41 56                	push   %r14
+  802926:	41 55                	push   %r13
+  802928:	41 54                	push   %r12
+  80292a:	53                   	push   %rbx
+  80292b:	48 83 ec 08          	sub    $0x8,%rsp
+  80292f:	49 89 fe             	mov    %rdi,%r14
+  802932:	49 89 f7             	mov    %rsi,%r15
+  802935:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  802938:	48 89 f7             	mov    %rsi,%rdi
+  80293b:	48 b8 6d 26 80 00 00 	movabs $0x80266d,%rax
+  802942:	00 00 00 
+  802945:	ff d0                	call   *%rax
+  802947:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  80294a:	48 89 de             	mov    %rbx,%rsi
+  80294d:	4c 89 f7             	mov    %r14,%rdi
+  802950:	48 b8 88 26 80 00 00 	movabs $0x802688,%rax
+  802957:	00 00 00 
+  80295a:	ff d0                	call   *%rax
+  80295c:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  80295f:	48 39 c3             	cmp    %rax,%rbx
+  802962:	74 36                	je     80299a <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  802964:	48 89 d8             	mov    %rbx,%rax
+  802967:	4c 29 e8             	sub    %r13,%rax
+  80296a:	49 39 c4             	cmp    %rax,%r12
+  80296d:	73 31                	jae    8029a0 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  80296f:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  802974:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  802978:	4c 89 fe             	mov    %r15,%rsi
+  80297b:	48 b8 0c 29 80 00 00 	movabs $0x80290c,%rax
+  802982:	00 00 00 
+  802985:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  802987:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  80298b:	48 83 c4 08          	add    $0x8,%rsp
+  80298f:	5b                   	pop    %rbx
+  802990:	41 5c                	pop    %r12
+  802992:	41 5d                	pop    %r13
+  802994:	41 5e                	pop    %r14
+  802996:	41 5f                	pop    %r15
+  802998:	5d                   	pop    %rbp
+  802999:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  80299a:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  80299e:	eb eb                	jmp    80298b <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  8029a0:	48 83 eb 01          	sub    $0x1,%rbx
+  8029a4:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8029a8:	48 89 da             	mov    %rbx,%rdx
+  8029ab:	4c 89 fe             	mov    %r15,%rsi
+  8029ae:	48 b8 0c 29 80 00 00 	movabs $0x80290c,%rax
+  8029b5:	00 00 00 
+  8029b8:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  8029ba:	49 01 de             	add    %rbx,%r14
+  8029bd:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  8029c2:	eb c3                	jmp    802987 <strlcat+0x69>
+
+00000000008029c4 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  8029c4:	48 85 d2             	test   %rdx,%rdx
+  8029c7:	74 2d                	je     8029f6 <memcmp+0x32>
+  8029c9:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  8029ce:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  8029d2:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  8029d7:	44 38 c1             	cmp    %r8b,%cl
+  8029da:	75 0f                	jne    8029eb <memcmp+0x27>
+    while (n-- > 0) {
+  8029dc:	48 83 c0 01          	add    $0x1,%rax
+  8029e0:	48 39 c2             	cmp    %rax,%rdx
+  8029e3:	75 e9                	jne    8029ce <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  8029e5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029ea:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  8029eb:	0f b6 c1             	movzbl %cl,%eax
+  8029ee:	45 0f b6 c0          	movzbl %r8b,%r8d
+  8029f2:	44 29 c0             	sub    %r8d,%eax
+  8029f5:	c3                   	ret
+    return 0;
+  8029f6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8029fb:	c3                   	ret
+
+00000000008029fc <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  8029fc:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  802a00:	48 39 c7             	cmp    %rax,%rdi
+  802a03:	73 0f                	jae    802a14 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  802a05:	40 38 37             	cmp    %sil,(%rdi)
+  802a08:	74 0e                	je     802a18 <memfind+0x1c>
+    for (; src < end; src++) {
+  802a0a:	48 83 c7 01          	add    $0x1,%rdi
+  802a0e:	48 39 f8             	cmp    %rdi,%rax
+  802a11:	75 f2                	jne    802a05 <memfind+0x9>
+  802a13:	c3                   	ret
+  802a14:	48 89 f8             	mov    %rdi,%rax
+  802a17:	c3                   	ret
+  802a18:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  802a1b:	c3                   	ret
+
+0000000000802a1c <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  802a1c:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  802a1f:	0f b6 37             	movzbl (%rdi),%esi
+  802a22:	40 80 fe 20          	cmp    $0x20,%sil
+  802a26:	74 06                	je     802a2e <strtol+0x12>
+  802a28:	40 80 fe 09          	cmp    $0x9,%sil
+  802a2c:	75 13                	jne    802a41 <strtol+0x25>
+  802a2e:	48 83 c7 01          	add    $0x1,%rdi
+  802a32:	0f b6 37             	movzbl (%rdi),%esi
+  802a35:	40 80 fe 20          	cmp    $0x20,%sil
+  802a39:	74 f3                	je     802a2e <strtol+0x12>
+  802a3b:	40 80 fe 09          	cmp    $0x9,%sil
+  802a3f:	74 ed                	je     802a2e <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  802a41:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  802a44:	83 e0 fd             	and    $0xfffffffd,%eax
+  802a47:	3c 01                	cmp    $0x1,%al
+  802a49:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  802a4d:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  802a53:	75 0f                	jne    802a64 <strtol+0x48>
+  802a55:	80 3f 30             	cmpb   $0x30,(%rdi)
+  802a58:	74 14                	je     802a6e <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  802a5a:	85 d2                	test   %edx,%edx
+  802a5c:	b8 0a 00 00 00       	mov    $0xa,%eax
+  802a61:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  802a64:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  802a69:	4c 63 ca             	movslq %edx,%r9
+  802a6c:	eb 36                	jmp    802aa4 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  802a6e:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  802a72:	74 0f                	je     802a83 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  802a74:	85 d2                	test   %edx,%edx
+  802a76:	75 ec                	jne    802a64 <strtol+0x48>
+        s++;
+  802a78:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  802a7c:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  802a81:	eb e1                	jmp    802a64 <strtol+0x48>
+        s += 2;
+  802a83:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  802a87:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  802a8c:	eb d6                	jmp    802a64 <strtol+0x48>
+            dig -= '0';
+  802a8e:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  802a91:	44 0f b6 c1          	movzbl %cl,%r8d
+  802a95:	41 39 d0             	cmp    %edx,%r8d
+  802a98:	7d 21                	jge    802abb <strtol+0x9f>
+        val = val * base + dig;
+  802a9a:	49 0f af c1          	imul   %r9,%rax
+  802a9e:	0f b6 c9             	movzbl %cl,%ecx
+  802aa1:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  802aa4:	48 83 c7 01          	add    $0x1,%rdi
+  802aa8:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  802aac:	80 f9 39             	cmp    $0x39,%cl
+  802aaf:	76 dd                	jbe    802a8e <strtol+0x72>
+        else if (dig - 'a' < 27)
+  802ab1:	80 f9 7b             	cmp    $0x7b,%cl
+  802ab4:	77 05                	ja     802abb <strtol+0x9f>
+            dig -= 'a' - 10;
+  802ab6:	83 e9 57             	sub    $0x57,%ecx
+  802ab9:	eb d6                	jmp    802a91 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  802abb:	4d 85 d2             	test   %r10,%r10
+  802abe:	74 03                	je     802ac3 <strtol+0xa7>
+  802ac0:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  802ac3:	48 89 c2             	mov    %rax,%rdx
+  802ac6:	48 f7 da             	neg    %rdx
+  802ac9:	40 80 fe 2d          	cmp    $0x2d,%sil
+  802acd:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  802ad1:	c3                   	ret
+
+0000000000802ad2 <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  802ad2:	55                   	push   %rbp
+  802ad3:	48 89 e5             	mov    %rsp,%rbp
+  802ad6:	41 55                	push   %r13
+  802ad8:	41 54                	push   %r12
+  802ada:	53                   	push   %rbx
+  802adb:	48 83 ec 08          	sub    $0x8,%rsp
+  802adf:	49 89 fc             	mov    %rdi,%r12
+  802ae2:	48 89 f7             	mov    %rsi,%rdi
+  802ae5:	48 89 d3             	mov    %rdx,%rbx
+  802ae8:	49 89 cd             	mov    %rcx,%r13
+    // LAB 9: Your code here:
+    int res = sys_ipc_recv(!pg ? (void*)MAX_USER_ADDRESS : pg, !size ? 0 : *size);
+  802aeb:	be 00 00 00 00       	mov    $0x0,%esi
+  802af0:	48 85 d2             	test   %rdx,%rdx
+  802af3:	74 03                	je     802af8 <ipc_recv+0x26>
+  802af5:	48 8b 32             	mov    (%rdx),%rsi
+  802af8:	48 85 ff             	test   %rdi,%rdi
+  802afb:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802b02:	00 00 00 
+  802b05:	48 0f 44 f8          	cmove  %rax,%rdi
+  802b09:	48 b8 77 06 80 00 00 	movabs $0x800677,%rax
+  802b10:	00 00 00 
+  802b13:	ff d0                	call   *%rax
+    if (res < 0) {
+  802b15:	85 c0                	test   %eax,%eax
+  802b17:	78 66                	js     802b7f <ipc_recv+0xad>
+        if (size) {
+            *size = 0;
+        }
+        return res;
+    }
+    if (from_env_store) {
+  802b19:	4d 85 e4             	test   %r12,%r12
+  802b1c:	74 14                	je     802b32 <ipc_recv+0x60>
+        *from_env_store = thisenv->env_ipc_from;
+  802b1e:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802b25:	00 00 00 
+  802b28:	8b 80 ac 01 00 00    	mov    0x1ac(%rax),%eax
+  802b2e:	41 89 04 24          	mov    %eax,(%r12)
+    }
+    if (perm_store) {
+  802b32:	4d 85 ed             	test   %r13,%r13
+  802b35:	74 14                	je     802b4b <ipc_recv+0x79>
+        *perm_store = thisenv->env_ipc_perm;
+  802b37:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802b3e:	00 00 00 
+  802b41:	8b 80 b0 01 00 00    	mov    0x1b0(%rax),%eax
+  802b47:	41 89 45 00          	mov    %eax,0x0(%r13)
+    }
+    if (size) {
+  802b4b:	48 85 db             	test   %rbx,%rbx
+  802b4e:	74 14                	je     802b64 <ipc_recv+0x92>
+        *size = thisenv->env_ipc_maxsz;
+  802b50:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802b57:	00 00 00 
+  802b5a:	48 8b 80 a0 01 00 00 	mov    0x1a0(%rax),%rax
+  802b61:	48 89 03             	mov    %rax,(%rbx)
+    }
+    return thisenv->env_ipc_value;
+  802b64:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802b6b:	00 00 00 
+  802b6e:	8b 80 a8 01 00 00    	mov    0x1a8(%rax),%eax
+}
+  802b74:	48 83 c4 08          	add    $0x8,%rsp
+  802b78:	5b                   	pop    %rbx
+  802b79:	41 5c                	pop    %r12
+  802b7b:	41 5d                	pop    %r13
+  802b7d:	5d                   	pop    %rbp
+  802b7e:	c3                   	ret
+        if (from_env_store) {
+  802b7f:	4d 85 e4             	test   %r12,%r12
+  802b82:	74 08                	je     802b8c <ipc_recv+0xba>
+            *from_env_store = 0;
+  802b84:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  802b8b:	00 
+        if (perm_store) {
+  802b8c:	4d 85 ed             	test   %r13,%r13
+  802b8f:	74 08                	je     802b99 <ipc_recv+0xc7>
+            *perm_store = 0;
+  802b91:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  802b98:	00 
+        if (size) {
+  802b99:	48 85 db             	test   %rbx,%rbx
+  802b9c:	74 d6                	je     802b74 <ipc_recv+0xa2>
+            *size = 0;
+  802b9e:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  802ba5:	eb cd                	jmp    802b74 <ipc_recv+0xa2>
+
+0000000000802ba7 <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  802ba7:	55                   	push   %rbp
+  802ba8:	48 89 e5             	mov    %rsp,%rbp
+  802bab:	41 57                	push   %r15
+  802bad:	41 56                	push   %r14
+  802baf:	41 55                	push   %r13
+  802bb1:	41 54                	push   %r12
+  802bb3:	53                   	push   %rbx
+  802bb4:	48 83 ec 18          	sub    $0x18,%rsp
+  802bb8:	41 89 fd             	mov    %edi,%r13d
+  802bbb:	89 75 cc             	mov    %esi,-0x34(%rbp)
+  802bbe:	49 89 cc             	mov    %rcx,%r12
+  802bc1:	44 89 45 c8          	mov    %r8d,-0x38(%rbp)
+    // LAB 9: Your code here:
+    int res = 0;
+    while ((res = sys_ipc_try_send(to_env, val, !pg ? (void*)MAX_USER_ADDRESS : pg, size, perm)) < 0) {
+  802bc5:	48 85 d2             	test   %rdx,%rdx
+  802bc8:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802bcf:	00 00 00 
+  802bd2:	48 0f 45 c2          	cmovne %rdx,%rax
+  802bd6:	48 89 c3             	mov    %rax,%rbx
+  802bd9:	49 be 4b 06 80 00 00 	movabs $0x80064b,%r14
+  802be0:	00 00 00 
+        if (res != -E_IPC_NOT_RECV) {
+            panic("sys_ipc_try_send failed: %i", res);
+        }
+        sys_yield();
+  802be3:	49 bf 16 02 80 00 00 	movabs $0x800216,%r15
+  802bea:	00 00 00 
+    while ((res = sys_ipc_try_send(to_env, val, !pg ? (void*)MAX_USER_ADDRESS : pg, size, perm)) < 0) {
+  802bed:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  802bf0:	44 8b 45 c8          	mov    -0x38(%rbp),%r8d
+  802bf4:	4c 89 e1             	mov    %r12,%rcx
+  802bf7:	48 89 da             	mov    %rbx,%rdx
+  802bfa:	44 89 ef             	mov    %r13d,%edi
+  802bfd:	41 ff d6             	call   *%r14
+  802c00:	85 c0                	test   %eax,%eax
+  802c02:	79 37                	jns    802c3b <ipc_send+0x94>
+        if (res != -E_IPC_NOT_RECV) {
+  802c04:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  802c07:	75 05                	jne    802c0e <ipc_send+0x67>
+        sys_yield();
+  802c09:	41 ff d7             	call   *%r15
+  802c0c:	eb df                	jmp    802bed <ipc_send+0x46>
+            panic("sys_ipc_try_send failed: %i", res);
+  802c0e:	89 c1                	mov    %eax,%ecx
+  802c10:	48 ba 4f 33 80 00 00 	movabs $0x80334f,%rdx
+  802c17:	00 00 00 
+  802c1a:	be 40 00 00 00       	mov    $0x40,%esi
+  802c1f:	48 bf 6b 33 80 00 00 	movabs $0x80336b,%rdi
+  802c26:	00 00 00 
+  802c29:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c2e:	49 b8 36 1c 80 00 00 	movabs $0x801c36,%r8
+  802c35:	00 00 00 
+  802c38:	41 ff d0             	call   *%r8
+    }
+    return;
+}
+  802c3b:	48 83 c4 18          	add    $0x18,%rsp
+  802c3f:	5b                   	pop    %rbx
+  802c40:	41 5c                	pop    %r12
+  802c42:	41 5d                	pop    %r13
+  802c44:	41 5e                	pop    %r14
+  802c46:	41 5f                	pop    %r15
+  802c48:	5d                   	pop    %rbp
+  802c49:	c3                   	ret
+
+0000000000802c4a <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  802c4a:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  802c4f:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  802c56:	00 00 00 
+  802c59:	48 69 d0 d0 01 00 00 	imul   $0x1d0,%rax,%rdx
+  802c60:	48 01 ca             	add    %rcx,%rdx
+  802c63:	8b 92 e8 00 00 00    	mov    0xe8(%rdx),%edx
+  802c69:	39 fa                	cmp    %edi,%edx
+  802c6b:	74 12                	je     802c7f <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  802c6d:	48 83 c0 01          	add    $0x1,%rax
+  802c71:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  802c77:	75 e0                	jne    802c59 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  802c79:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802c7e:	c3                   	ret
+            return envs[i].env_id;
+  802c7f:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+  802c86:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  802c8d:	00 00 00 
+  802c90:	48 01 d0             	add    %rdx,%rax
+  802c93:	8b 80 e0 00 00 00    	mov    0xe0(%rax),%eax
+  802c99:	c3                   	ret
+  802c9a:	66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+
+0000000000802ca0 <__rodata_start>:
+  802ca0:	69 64 6c 65 00 3c 75 	imul   $0x6e753c00,0x65(%rsp,%rbp,2),%esp
+  802ca7:	6e 
+  802ca8:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  802cac:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802cad:	3e 00 90 73 79 73 63 	ds add %dl,0x63737973(%rax)
+  802cb4:	61                   	(bad)
+  802cb5:	6c                   	insb   (%dx),%es:(%rdi)
+  802cb6:	6c                   	insb   (%dx),%es:(%rdi)
+  802cb7:	20 25 7a 64 20 72    	and    %ah,0x7220647a(%rip)        # 72a09137 <__bss_end+0x72201137>
+  802cbd:	65 74 75             	gs je  802d35 <__rodata_start+0x95>
+  802cc0:	72 6e                	jb     802d30 <__rodata_start+0x90>
+  802cc2:	65 64 20 25 7a 64 20 	gs and %ah,%fs:0x2820647a(%rip)        # 28a09144 <__bss_end+0x28201144>
+  802cc9:	28 
+  802cca:	3e 20 30             	ds and %dh,(%rax)
+  802ccd:	29 00                	sub    %eax,(%rax)
+  802ccf:	6c                   	insb   (%dx),%es:(%rdi)
+  802cd0:	69 62 2f 73 79 73 63 	imul   $0x63737973,0x2f(%rdx),%esp
+  802cd7:	61                   	(bad)
+  802cd8:	6c                   	insb   (%dx),%es:(%rdi)
+  802cd9:	6c                   	insb   (%dx),%es:(%rdi)
+  802cda:	2e 63 00             	cs movsxd (%rax),%eax
+  802cdd:	0f 1f 00             	nopl   (%rax)
+  802ce0:	5b                   	pop    %rbx
+  802ce1:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  802ce6:	20 75 6e             	and    %dh,0x6e(%rbp)
+  802ce9:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  802ced:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802cee:	20 64 65 76          	and    %ah,0x76(%rbp,%riz,2)
+  802cf2:	69 63 65 20 74 79 70 	imul   $0x70797420,0x65(%rbx),%esp
+  802cf9:	65 20 25 64 0a 00 00 	and    %ah,%gs:0xa64(%rip)        # 803764 <error_string+0x4e4>
+  802d00:	5b                   	pop    %rbx
+  802d01:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  802d06:	20 66 74             	and    %ah,0x74(%rsi)
+  802d09:	72 75                	jb     802d80 <devtab+0x20>
+  802d0b:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802d0c:	63 61 74             	movsxd 0x74(%rcx),%esp
+  802d0f:	65 20 25 64 20 2d 2d 	and    %ah,%gs:0x2d2d2064(%rip)        # 2dad4d7a <__bss_end+0x2d2ccd7a>
+  802d16:	20 62 61             	and    %ah,0x61(%rdx)
+  802d19:	64 20 6d 6f          	and    %ch,%fs:0x6f(%rbp)
+  802d1d:	64 65 0a 00          	fs or  %gs:(%rax),%al
+  802d21:	5b                   	pop    %rbx
+  802d22:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  802d27:	20 72 65             	and    %dh,0x65(%rdx)
+  802d2a:	61                   	(bad)
+  802d2b:	64 20 25 64 20 2d 2d 	and    %ah,%fs:0x2d2d2064(%rip)        # 2dad4d96 <__bss_end+0x2d2ccd96>
+  802d32:	20 62 61             	and    %ah,0x61(%rdx)
+  802d35:	64 20 6d 6f          	and    %ch,%fs:0x6f(%rbp)
+  802d39:	64 65 0a 00          	fs or  %gs:(%rax),%al
+  802d3d:	5b                   	pop    %rbx
+  802d3e:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  802d43:	20 77 72             	and    %dh,0x72(%rdi)
+  802d46:	69 74 65 20 25 64 20 	imul   $0x2d206425,0x20(%rbp,%riz,2),%esi
+  802d4d:	2d 
+  802d4e:	2d 20 62 61 64       	sub    $0x64616220,%eax
+  802d53:	20 6d 6f             	and    %ch,0x6f(%rbp)
+  802d56:	64 65 0a 00          	fs or  %gs:(%rax),%al
+  802d5a:	66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+
+0000000000802d60 <devtab>:
+  802d60:	20 40 80 00 00 00 00 00 60 40 80 00 00 00 00 00      @......`@......
+  802d70:	a0 40 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .@..............
+  802d80:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  802d90:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  802da0:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  802db0:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  802dc0:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  802dd0:	3d 20 32 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73 00     = 2.<cons>.cons.
+  802de0:	5b 25 30 38 78 5d 20 75 73 65 72 20 70 61 6e 69     [%08x] user pani
+  802df0:	63 20 69 6e 20 25 73 20 61 74 20 25 73 3a 25 64     c in %s at %s:%d
+  802e00:	3a 20 00 30 31 32 33 34 35 36 37 38 39 41 42 43     : .0123456789ABC
+  802e10:	44 45 46 00 30 31 32 33 34 35 36 37 38 39 61 62     DEF.0123456789ab
+  802e20:	63 64 65 66 00 28 6e 75 6c 6c 29 00 65 72 72 6f     cdef.(null).erro
+  802e30:	72 20 25 64 00 75 6e 73 70 65 63 69 66 69 65 64     r %d.unspecified
+  802e40:	20 65 72 72 6f 72 00 62 61 64 20 65 6e 76 69 72      error.bad envir
+  802e50:	6f 6e 6d 65 6e 74 00 69 6e 76 61 6c 69 64 20 70     onment.invalid p
+  802e60:	61 72 61 6d 65 74 65 72 00 6f 75 74 20 6f 66 20     arameter.out of 
+  802e70:	6d 65 6d 6f 72 79 00 6f 75 74 20 6f 66 20 65 6e     memory.out of en
+  802e80:	76 69 72 6f 6e 6d 65 6e 74 73 00 63 6f 72 72 75     vironments.corru
+  802e90:	70 74 65 64 20 64 65 62 75 67 20 69 6e 66 6f 00     pted debug info.
+  802ea0:	73 65 67 6d 65 6e 74 61 74 69 6f 6e 20 66 61 75     segmentation fau
+  802eb0:	6c 74 00 69 6e 76 61 6c 69 64 20 45 4c 46 20 69     lt.invalid ELF i
+  802ec0:	6d 61 67 65 00 6e 6f 20 73 75 63 68 20 73 79 73     mage.no such sys
+  802ed0:	74 65 6d 20 63 61 6c 6c 00 65 6e 74 72 79 20 6e     tem call.entry n
+  802ee0:	6f 74 20 66 6f 75 6e 64 00 65 6e 76 20 69 73 20     ot found.env is 
+  802ef0:	6e 6f 74 20 72 65 63 76 69 6e 67 00 75 6e 65 78     not recving.unex
+  802f00:	70 65 63 74 65 64 20 65 6e 64 20 6f 66 20 66 69     pected end of fi
+  802f10:	6c 65 00 6e 6f 20 66 72 65 65 20 73 70 61 63 65     le.no free space
+  802f20:	20 6f 6e 20 64 69 73 6b 00 74 6f 6f 20 6d 61 6e      on disk.too man
+  802f30:	79 20 66 69 6c 65 73 20 61 72 65 20 6f 70 65 6e     y files are open
+  802f40:	00 66 69 6c 65 20 6f 72 20 62 6c 6f 63 6b 20 6e     .file or block n
+  802f50:	6f 74 20 66 6f 75 6e 64 00 69 6e 76 61 6c 69 64     ot found.invalid
+  802f60:	20 70 61 74 68 00 66 69 6c 65 20 61 6c 72 65 61      path.file alrea
+  802f70:	64 79 20 65 78 69 73 74 73 00 6f 70 65 72 61 74     dy exists.operat
+  802f80:	69 6f 6e 20 6e 6f 74 20 73 75 70 70 6f 72 74 65     ion not supporte
+  802f90:	64 00 6f 70 65 72 61 74 69 6f 6e 20 69 6e 74 65     d.operation inte
+  802fa0:	72 72 75 70 74 65 64 00 6e 6f 74 20 65 6e 6f 75     rrupted.not enou
+  802fb0:	67 68 20 43 50 55 20 74 69 6d 65 00 0f 1f 40 00     gh CPU time...@.
+  802fc0:	73 1f 80 00 00 00 00 00 b4 25 80 00 00 00 00 00     s........%......
+  802fd0:	a4 25 80 00 00 00 00 00 b4 25 80 00 00 00 00 00     .%.......%......
+  802fe0:	b4 25 80 00 00 00 00 00 b4 25 80 00 00 00 00 00     .%.......%......
+  802ff0:	b4 25 80 00 00 00 00 00 92 1f 80 00 00 00 00 00     .%..............
+  803000:	b4 25 80 00 00 00 00 00 b4 25 80 00 00 00 00 00     .%.......%......
+  803010:	86 1f 80 00 00 00 00 00 00 20 80 00 00 00 00 00     ......... ......
+  803020:	b4 25 80 00 00 00 00 00 86 1f 80 00 00 00 00 00     .%..............
+  803030:	cc 1f 80 00 00 00 00 00 cc 1f 80 00 00 00 00 00     ................
+  803040:	cc 1f 80 00 00 00 00 00 cc 1f 80 00 00 00 00 00     ................
+  803050:	cc 1f 80 00 00 00 00 00 cc 1f 80 00 00 00 00 00     ................
+  803060:	cc 1f 80 00 00 00 00 00 cc 1f 80 00 00 00 00 00     ................
+  803070:	cc 1f 80 00 00 00 00 00 b4 25 80 00 00 00 00 00     .........%......
+  803080:	b4 25 80 00 00 00 00 00 b4 25 80 00 00 00 00 00     .%.......%......
+  803090:	b4 25 80 00 00 00 00 00 b4 25 80 00 00 00 00 00     .%.......%......
+  8030a0:	b4 25 80 00 00 00 00 00 b4 25 80 00 00 00 00 00     .%.......%......
+  8030b0:	b4 25 80 00 00 00 00 00 b4 25 80 00 00 00 00 00     .%.......%......
+  8030c0:	b4 25 80 00 00 00 00 00 b4 25 80 00 00 00 00 00     .%.......%......
+  8030d0:	b4 25 80 00 00 00 00 00 b4 25 80 00 00 00 00 00     .%.......%......
+  8030e0:	b4 25 80 00 00 00 00 00 b4 25 80 00 00 00 00 00     .%.......%......
+  8030f0:	b4 25 80 00 00 00 00 00 b4 25 80 00 00 00 00 00     .%.......%......
+  803100:	b4 25 80 00 00 00 00 00 b4 25 80 00 00 00 00 00     .%.......%......
+  803110:	b4 25 80 00 00 00 00 00 b4 25 80 00 00 00 00 00     .%.......%......
+  803120:	b4 25 80 00 00 00 00 00 b4 25 80 00 00 00 00 00     .%.......%......
+  803130:	b4 25 80 00 00 00 00 00 b4 25 80 00 00 00 00 00     .%.......%......
+  803140:	b4 25 80 00 00 00 00 00 b4 25 80 00 00 00 00 00     .%.......%......
+  803150:	b4 25 80 00 00 00 00 00 b4 25 80 00 00 00 00 00     .%.......%......
+  803160:	b4 25 80 00 00 00 00 00 d7 24 80 00 00 00 00 00     .%.......$......
+  803170:	b4 25 80 00 00 00 00 00 b4 25 80 00 00 00 00 00     .%.......%......
+  803180:	b4 25 80 00 00 00 00 00 b4 25 80 00 00 00 00 00     .%.......%......
+  803190:	b4 25 80 00 00 00 00 00 b4 25 80 00 00 00 00 00     .%.......%......
+  8031a0:	b4 25 80 00 00 00 00 00 b4 25 80 00 00 00 00 00     .%.......%......
+  8031b0:	b4 25 80 00 00 00 00 00 b4 25 80 00 00 00 00 00     .%.......%......
+  8031c0:	23 20 80 00 00 00 00 00 f2 21 80 00 00 00 00 00     # .......!......
+  8031d0:	b4 25 80 00 00 00 00 00 b4 25 80 00 00 00 00 00     .%.......%......
+  8031e0:	b4 25 80 00 00 00 00 00 b4 25 80 00 00 00 00 00     .%.......%......
+  8031f0:	52 20 80 00 00 00 00 00 b4 25 80 00 00 00 00 00     R .......%......
+  803200:	b4 25 80 00 00 00 00 00 18 20 80 00 00 00 00 00     .%....... ......
+  803210:	b4 25 80 00 00 00 00 00 b4 25 80 00 00 00 00 00     .%.......%......
+  803220:	9a 23 80 00 00 00 00 00 64 24 80 00 00 00 00 00     .#......d$......
+  803230:	b4 25 80 00 00 00 00 00 b4 25 80 00 00 00 00 00     .%.......%......
+  803240:	e9 20 80 00 00 00 00 00 b4 25 80 00 00 00 00 00     . .......%......
+  803250:	c6 22 80 00 00 00 00 00 b4 25 80 00 00 00 00 00     .".......%......
+  803260:	b4 25 80 00 00 00 00 00 d7 24 80 00 00 00 00 00     .%.......$......
+  803270:	b4 25 80 00 00 00 00 00 7c 1f 80 00 00 00 00 00     .%......|.......
+
+0000000000803280 <error_string>:
+	...
+  803288:	35 2e 80 00 00 00 00 00 47 2e 80 00 00 00 00 00     5.......G.......
+  803298:	57 2e 80 00 00 00 00 00 69 2e 80 00 00 00 00 00     W.......i.......
+  8032a8:	77 2e 80 00 00 00 00 00 8b 2e 80 00 00 00 00 00     w...............
+  8032b8:	a0 2e 80 00 00 00 00 00 b3 2e 80 00 00 00 00 00     ................
+  8032c8:	c5 2e 80 00 00 00 00 00 d9 2e 80 00 00 00 00 00     ................
+  8032d8:	e9 2e 80 00 00 00 00 00 fc 2e 80 00 00 00 00 00     ................
+  8032e8:	13 2f 80 00 00 00 00 00 29 2f 80 00 00 00 00 00     ./......)/......
+  8032f8:	41 2f 80 00 00 00 00 00 59 2f 80 00 00 00 00 00     A/......Y/......
+  803308:	66 2f 80 00 00 00 00 00 30 33 80 00 00 00 00 00     f/......03......
+  803318:	7a 2f 80 00 00 00 00 00 92 2f 80 00 00 00 00 00     z/......./......
+  803328:	a8 2f 80 00 00 00 00 00 66 69 6c 65 20 69 73 20     ./......file is 
+  803338:	6e 6f 74 20 61 20 76 61 6c 69 64 20 65 78 65 63     not a valid exec
+  803348:	75 74 61 62 6c 65 00 73 79 73 5f 69 70 63 5f 74     utable.sys_ipc_t
+  803358:	72 79 5f 73 65 6e 64 20 66 61 69 6c 65 64 3a 20     ry_send failed: 
+  803368:	25 69 00 6c 69 62 2f 69 70 63 2e 63 00 66 2e 0f     %i.lib/ipc.c.f..
+  803378:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803388:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803398:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8033a8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8033b8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8033c8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8033d8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8033e8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8033f8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803408:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803418:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803428:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803438:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803448:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803458:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803468:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803478:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803488:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803498:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8034a8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8034b8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8034c8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8034d8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8034e8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8034f8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803508:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803518:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803528:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803538:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803548:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803558:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803568:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803578:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803588:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803598:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8035a8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8035b8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8035c8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8035d8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8035e8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8035f8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803608:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803618:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803628:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803638:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803648:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803658:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803668:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803678:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803688:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803698:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8036a8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8036b8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8036c8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8036d8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8036e8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8036f8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803708:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803718:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803728:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803738:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803748:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803758:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803768:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803778:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803788:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803798:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8037a8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8037b8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8037c8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8037d8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8037e8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8037f8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803808:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803818:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803828:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803838:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803848:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803858:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803868:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803878:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803888:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803898:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8038a8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8038b8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8038c8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8038d8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8038e8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8038f8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803908:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803918:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803928:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803938:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803948:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803958:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803968:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803978:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803988:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803998:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8039a8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8039b8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8039c8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8039d8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8039e8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8039f8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803a08:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803a18:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803a28:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803a38:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803a48:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803a58:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803a68:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803a78:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803a88:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803a98:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803aa8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803ab8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803ac8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803ad8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803ae8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803af8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803b08:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803b18:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803b28:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803b38:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803b48:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803b58:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803b68:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803b78:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803b88:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803b98:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803ba8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803bb8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803bc8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803bd8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803be8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803bf8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803c08:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803c18:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803c28:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803c38:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803c48:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803c58:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803c68:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803c78:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803c88:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803c98:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803ca8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803cb8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803cc8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803cd8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803ce8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803cf8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803d08:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803d18:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803d28:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803d38:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803d48:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803d58:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803d68:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803d78:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803d88:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803d98:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803da8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803db8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803dc8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803dd8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803de8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803df8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803e08:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803e18:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803e28:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803e38:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803e48:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803e58:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803e68:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803e78:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803e88:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803e98:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803ea8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803eb8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803ec8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803ed8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803ee8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803ef8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803f08:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803f18:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803f28:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803f38:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803f48:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803f58:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803f68:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803f78:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803f88:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803f98:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803fa8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803fb8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803fc8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803fd8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803fe8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803ff8:	1f 84 00 00 00 00 00 90                             ........
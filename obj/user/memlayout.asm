@@ -0,0 +1,6155 @@
+
+obj/user/memlayout:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 52 03 00 00       	call   800375 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <memlayout>:
+#ifndef PROT_SHARE
+#define PROT_SHARE 0x400
+#endif
+
+void
+memlayout(void) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 57                	push   %r15
+  80002b:	41 56                	push   %r14
+  80002d:	41 55                	push   %r13
+  80002f:	41 54                	push   %r12
+  800031:	53                   	push   %rbx
+  800032:	48 83 ec 48          	sub    $0x48,%rsp
+    size_t total_p = 0;
+    size_t total_u = 0;
+    size_t total_w = 0;
+    size_t total_cow = 0;
+
+    cprintf("EID: %d, PEID: %d\n", thisenv->env_id, thisenv->env_parent_id);
+  800036:	49 bc 00 50 80 00 00 	movabs $0x805000,%r12
+  80003d:	00 00 00 
+  800040:	49 8b 04 24          	mov    (%r12),%rax
+  800044:	8b 90 e4 00 00 00    	mov    0xe4(%rax),%edx
+  80004a:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+  800050:	48 bf 34 31 80 00 00 	movabs $0x803134,%rdi
+  800057:	00 00 00 
+  80005a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80005f:	48 bb 91 05 80 00 00 	movabs $0x800591,%rbx
+  800066:	00 00 00 
+  800069:	ff d3                	call   *%rbx
+    cprintf("pml4=%p uvpml4=%p uvpdp=%p uvpd=%p uvpt=%p\n", thisenv->address_space.pml4,
+  80006b:	49 8b 04 24          	mov    (%r12),%rax
+  80006f:	48 8b b0 50 01 00 00 	mov    0x150(%rax),%rsi
+  800076:	49 b9 00 00 00 80 00 	movabs $0x10080000000,%r9
+  80007d:	01 00 00 
+  800080:	49 b8 00 00 00 00 00 	movabs $0x10000000000,%r8
+  800087:	01 00 00 
+  80008a:	48 b9 00 00 40 80 00 	movabs $0x10080400000,%rcx
+  800091:	01 00 00 
+  800094:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  80009b:	01 00 00 
+  80009e:	48 bf e0 31 80 00 00 	movabs $0x8031e0,%rdi
+  8000a5:	00 00 00 
+  8000a8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000ad:	ff d3                	call   *%rbx
+    size_t total_cow = 0;
+  8000af:	48 c7 45 90 00 00 00 	movq   $0x0,-0x70(%rbp)
+  8000b6:	00 
+    size_t total_w = 0;
+  8000b7:	48 c7 45 98 00 00 00 	movq   $0x0,-0x68(%rbp)
+  8000be:	00 
+    size_t total_u = 0;
+  8000bf:	48 c7 45 a0 00 00 00 	movq   $0x0,-0x60(%rbp)
+  8000c6:	00 
+    size_t total_p = 0;
+  8000c7:	48 c7 45 a8 00 00 00 	movq   $0x0,-0x58(%rbp)
+  8000ce:	00 
+            (void *)UVPML4, (void *)UVPDP, (void *)UVPT, (void *)UVPD);
+
+    for (addr = 0; addr < KERN_BASE_ADDR; addr += PAGE_SIZE) {
+  8000cf:	41 be 00 00 00 00    	mov    $0x0,%r14d
+        pte_t ent = get_uvpt_entry((void *)addr);
+  8000d5:	49 bd 88 2a 80 00 00 	movabs $0x802a88,%r13
+  8000dc:	00 00 00 
+        if (ent) {
+            cprintf("[%p] %lx -> %08lx: %c %c %c |%s%s\n",
+  8000df:	49 bc 5d 31 80 00 00 	movabs $0x80315d,%r12
+  8000e6:	00 00 00 
+  8000e9:	eb 5f                	jmp    80014a <memlayout+0x125>
+                    (void *)get_uvpt_entry((void *)addr), (unsigned long)addr, (unsigned long)ent,
+  8000eb:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8000ef:	41 ff d5             	call   *%r13
+  8000f2:	48 89 c6             	mov    %rax,%rsi
+            cprintf("[%p] %lx -> %08lx: %c %c %c |%s%s\n",
+  8000f5:	48 83 ec 08          	sub    $0x8,%rsp
+  8000f9:	41 57                	push   %r15
+  8000fb:	ff 75 c0             	push   -0x40(%rbp)
+  8000fe:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  800101:	50                   	push   %rax
+  800102:	44 8b 4d b8          	mov    -0x48(%rbp),%r9d
+  800106:	44 8b 45 b4          	mov    -0x4c(%rbp),%r8d
+  80010a:	48 89 d9             	mov    %rbx,%rcx
+  80010d:	4c 89 f2             	mov    %r14,%rdx
+  800110:	48 bf 10 32 80 00 00 	movabs $0x803210,%rdi
+  800117:	00 00 00 
+  80011a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80011f:	49 ba 91 05 80 00 00 	movabs $0x800591,%r10
+  800126:	00 00 00 
+  800129:	41 ff d2             	call   *%r10
+  80012c:	48 83 c4 20          	add    $0x20,%rsp
+    for (addr = 0; addr < KERN_BASE_ADDR; addr += PAGE_SIZE) {
+  800130:	49 81 c6 00 10 00 00 	add    $0x1000,%r14
+  800137:	48 b8 00 00 00 40 80 	movabs $0x8040000000,%rax
+  80013e:	00 00 00 
+  800141:	49 39 c6             	cmp    %rax,%r14
+  800144:	0f 84 8f 00 00 00    	je     8001d9 <memlayout+0x1b4>
+        pte_t ent = get_uvpt_entry((void *)addr);
+  80014a:	4c 89 75 c8          	mov    %r14,-0x38(%rbp)
+  80014e:	4c 89 f7             	mov    %r14,%rdi
+  800151:	41 ff d5             	call   *%r13
+  800154:	48 89 c3             	mov    %rax,%rbx
+        if (ent) {
+  800157:	48 85 c0             	test   %rax,%rax
+  80015a:	74 d4                	je     800130 <memlayout+0x10b>
+            cprintf("[%p] %lx -> %08lx: %c %c %c |%s%s\n",
+  80015c:	a8 40                	test   $0x40,%al
+  80015e:	49 bf 28 31 80 00 00 	movabs $0x803128,%r15
+  800165:	00 00 00 
+  800168:	4d 0f 44 fc          	cmove  %r12,%r15
+  80016c:	4c 89 65 c0          	mov    %r12,-0x40(%rbp)
+  800170:	f6 c4 08             	test   $0x8,%ah
+  800173:	74 13                	je     800188 <memlayout+0x163>
+                    (ent & PTE_P)    ? total_p++, 'P' : '-',
+                    (ent & PTE_U)    ? total_u++, 'U' : '-',
+                    (ent & PTE_W)    ? total_w++, 'W' : '-',
+                    (ent & PROT_COW) ? total_cow++, " COW" : "",
+  800175:	48 83 45 90 01       	addq   $0x1,-0x70(%rbp)
+            cprintf("[%p] %lx -> %08lx: %c %c %c |%s%s\n",
+  80017a:	48 b8 2f 31 80 00 00 	movabs $0x80312f,%rax
+  800181:	00 00 00 
+  800184:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800188:	c7 45 bc 2d 00 00 00 	movl   $0x2d,-0x44(%rbp)
+  80018f:	f6 c3 02             	test   $0x2,%bl
+  800192:	74 0c                	je     8001a0 <memlayout+0x17b>
+                    (ent & PTE_W)    ? total_w++, 'W' : '-',
+  800194:	48 83 45 98 01       	addq   $0x1,-0x68(%rbp)
+            cprintf("[%p] %lx -> %08lx: %c %c %c |%s%s\n",
+  800199:	c7 45 bc 57 00 00 00 	movl   $0x57,-0x44(%rbp)
+  8001a0:	c7 45 b8 2d 00 00 00 	movl   $0x2d,-0x48(%rbp)
+  8001a7:	f6 c3 04             	test   $0x4,%bl
+  8001aa:	74 0c                	je     8001b8 <memlayout+0x193>
+                    (ent & PTE_U)    ? total_u++, 'U' : '-',
+  8001ac:	48 83 45 a0 01       	addq   $0x1,-0x60(%rbp)
+            cprintf("[%p] %lx -> %08lx: %c %c %c |%s%s\n",
+  8001b1:	c7 45 b8 55 00 00 00 	movl   $0x55,-0x48(%rbp)
+  8001b8:	c7 45 b4 2d 00 00 00 	movl   $0x2d,-0x4c(%rbp)
+  8001bf:	f6 c3 01             	test   $0x1,%bl
+  8001c2:	0f 84 23 ff ff ff    	je     8000eb <memlayout+0xc6>
+                    (ent & PTE_P)    ? total_p++, 'P' : '-',
+  8001c8:	48 83 45 a8 01       	addq   $0x1,-0x58(%rbp)
+            cprintf("[%p] %lx -> %08lx: %c %c %c |%s%s\n",
+  8001cd:	c7 45 b4 50 00 00 00 	movl   $0x50,-0x4c(%rbp)
+  8001d4:	e9 12 ff ff ff       	jmp    8000eb <memlayout+0xc6>
+                    (ent & PROT_SHARE) ? " SHARE" : "");
+        }
+    }
+
+    cprintf("Memory usage summary:\n");
+  8001d9:	48 bf 47 31 80 00 00 	movabs $0x803147,%rdi
+  8001e0:	00 00 00 
+  8001e3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001e8:	48 bb 91 05 80 00 00 	movabs $0x800591,%rbx
+  8001ef:	00 00 00 
+  8001f2:	ff d3                	call   *%rbx
+    cprintf("  PTE_P: %lu\n", (unsigned long)total_p);
+  8001f4:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  8001f8:	48 bf 5e 31 80 00 00 	movabs $0x80315e,%rdi
+  8001ff:	00 00 00 
+  800202:	b8 00 00 00 00       	mov    $0x0,%eax
+  800207:	ff d3                	call   *%rbx
+    cprintf("  PTE_U: %lu\n", (unsigned long)total_u);
+  800209:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  80020d:	48 bf 6c 31 80 00 00 	movabs $0x80316c,%rdi
+  800214:	00 00 00 
+  800217:	b8 00 00 00 00       	mov    $0x0,%eax
+  80021c:	ff d3                	call   *%rbx
+    cprintf("  PTE_W: %lu\n", (unsigned long)total_w);
+  80021e:	48 8b 75 98          	mov    -0x68(%rbp),%rsi
+  800222:	48 bf 7a 31 80 00 00 	movabs $0x80317a,%rdi
+  800229:	00 00 00 
+  80022c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800231:	ff d3                	call   *%rbx
+    cprintf("  PTE_COW: %lu\n", (unsigned long)total_cow);
+  800233:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  800237:	48 bf 88 31 80 00 00 	movabs $0x803188,%rdi
+  80023e:	00 00 00 
+  800241:	b8 00 00 00 00       	mov    $0x0,%eax
+  800246:	ff d3                	call   *%rbx
+}
+  800248:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  80024c:	5b                   	pop    %rbx
+  80024d:	41 5c                	pop    %r12
+  80024f:	41 5d                	pop    %r13
+  800251:	41 5e                	pop    %r14
+  800253:	41 5f                	pop    %r15
+  800255:	5d                   	pop    %rbp
+  800256:	c3                   	ret
+
+0000000000800257 <umain>:
+
+void
+umain(int argc, char *argv[]) {
+  800257:	55                   	push   %rbp
+  800258:	48 89 e5             	mov    %rsp,%rbp
+  80025b:	41 54                	push   %r12
+  80025d:	53                   	push   %rbx
+  80025e:	48 83 ec 10          	sub    $0x10,%rsp
+    envid_t ceid;
+    int pipefd[2];
+    int res;
+
+    memlayout();
+  800262:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  800269:	00 00 00 
+  80026c:	ff d0                	call   *%rax
+
+    res = pipe(pipefd);
+  80026e:	48 8d 7d e8          	lea    -0x18(%rbp),%rdi
+  800272:	48 b8 33 28 80 00 00 	movabs $0x802833,%rax
+  800279:	00 00 00 
+  80027c:	ff d0                	call   *%rax
+    if (res < 0) panic("pipe() failed\n");
+  80027e:	85 c0                	test   %eax,%eax
+  800280:	78 46                	js     8002c8 <umain+0x71>
+    ceid = fork();
+  800282:	48 b8 a1 18 80 00 00 	movabs $0x8018a1,%rax
+  800289:	00 00 00 
+  80028c:	ff d0                	call   *%rax
+    if (ceid < 0) panic("fork() failed\n");
+  80028e:	85 c0                	test   %eax,%eax
+  800290:	78 60                	js     8002f2 <umain+0x9b>
+
+    if (!ceid) {
+  800292:	0f 84 84 00 00 00    	je     80031c <umain+0xc5>
+        cprintf("==== Child\n");
+        memlayout();
+        return;
+    }
+
+    cprintf("==== Parent\n");
+  800298:	48 bf d3 31 80 00 00 	movabs $0x8031d3,%rdi
+  80029f:	00 00 00 
+  8002a2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002a7:	48 ba 91 05 80 00 00 	movabs $0x800591,%rdx
+  8002ae:	00 00 00 
+  8002b1:	ff d2                	call   *%rdx
+    memlayout();
+  8002b3:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8002ba:	00 00 00 
+  8002bd:	ff d0                	call   *%rax
+}
+  8002bf:	48 83 c4 10          	add    $0x10,%rsp
+  8002c3:	5b                   	pop    %rbx
+  8002c4:	41 5c                	pop    %r12
+  8002c6:	5d                   	pop    %rbp
+  8002c7:	c3                   	ret
+    if (res < 0) panic("pipe() failed\n");
+  8002c8:	48 ba 98 31 80 00 00 	movabs $0x803198,%rdx
+  8002cf:	00 00 00 
+  8002d2:	be 33 00 00 00       	mov    $0x33,%esi
+  8002d7:	48 bf a7 31 80 00 00 	movabs $0x8031a7,%rdi
+  8002de:	00 00 00 
+  8002e1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002e6:	48 b9 41 04 80 00 00 	movabs $0x800441,%rcx
+  8002ed:	00 00 00 
+  8002f0:	ff d1                	call   *%rcx
+    if (ceid < 0) panic("fork() failed\n");
+  8002f2:	48 ba b8 31 80 00 00 	movabs $0x8031b8,%rdx
+  8002f9:	00 00 00 
+  8002fc:	be 35 00 00 00       	mov    $0x35,%esi
+  800301:	48 bf a7 31 80 00 00 	movabs $0x8031a7,%rdi
+  800308:	00 00 00 
+  80030b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800310:	48 b9 41 04 80 00 00 	movabs $0x800441,%rcx
+  800317:	00 00 00 
+  80031a:	ff d1                	call   *%rcx
+        cprintf("\n");
+  80031c:	48 bf 5c 31 80 00 00 	movabs $0x80315c,%rdi
+  800323:	00 00 00 
+  800326:	48 ba 91 05 80 00 00 	movabs $0x800591,%rdx
+  80032d:	00 00 00 
+  800330:	ff d2                	call   *%rdx
+  800332:	bb 00 90 01 00       	mov    $0x19000,%ebx
+            sys_yield();
+  800337:	49 bc d7 13 80 00 00 	movabs $0x8013d7,%r12
+  80033e:	00 00 00 
+  800341:	41 ff d4             	call   *%r12
+        for (i = 0; i < 102400; i++)
+  800344:	83 eb 01             	sub    $0x1,%ebx
+  800347:	75 f8                	jne    800341 <umain+0xea>
+        cprintf("==== Child\n");
+  800349:	48 bf c7 31 80 00 00 	movabs $0x8031c7,%rdi
+  800350:	00 00 00 
+  800353:	b8 00 00 00 00       	mov    $0x0,%eax
+  800358:	48 ba 91 05 80 00 00 	movabs $0x800591,%rdx
+  80035f:	00 00 00 
+  800362:	ff d2                	call   *%rdx
+        memlayout();
+  800364:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  80036b:	00 00 00 
+  80036e:	ff d0                	call   *%rax
+        return;
+  800370:	e9 4a ff ff ff       	jmp    8002bf <umain+0x68>
+
+0000000000800375 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800375:	55                   	push   %rbp
+  800376:	48 89 e5             	mov    %rsp,%rbp
+  800379:	41 56                	push   %r14
+  80037b:	41 55                	push   %r13
+  80037d:	41 54                	push   %r12
+  80037f:	53                   	push   %rbx
+  800380:	41 89 fd             	mov    %edi,%r13d
+  800383:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800386:	48 ba d8 40 80 00 00 	movabs $0x8040d8,%rdx
+  80038d:	00 00 00 
+  800390:	48 b8 d8 40 80 00 00 	movabs $0x8040d8,%rax
+  800397:	00 00 00 
+  80039a:	48 39 c2             	cmp    %rax,%rdx
+  80039d:	73 17                	jae    8003b6 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  80039f:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  8003a2:	49 89 c4             	mov    %rax,%r12
+  8003a5:	48 83 c3 08          	add    $0x8,%rbx
+  8003a9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003ae:	ff 53 f8             	call   *-0x8(%rbx)
+  8003b1:	4c 39 e3             	cmp    %r12,%rbx
+  8003b4:	72 ef                	jb     8003a5 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+    envid_t this_env_id = sys_getenvid();
+  8003b6:	48 b8 a6 13 80 00 00 	movabs $0x8013a6,%rax
+  8003bd:	00 00 00 
+  8003c0:	ff d0                	call   *%rax
+    thisenv = &((struct Env*)UENVS)[ENVX(this_env_id)];
+  8003c2:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8003c7:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+  8003ce:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8003d5:	00 00 00 
+  8003d8:	48 01 d0             	add    %rdx,%rax
+  8003db:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  8003e2:	00 00 00 
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8003e5:	45 85 ed             	test   %r13d,%r13d
+  8003e8:	7e 0d                	jle    8003f7 <libmain+0x82>
+  8003ea:	49 8b 06             	mov    (%r14),%rax
+  8003ed:	48 a3 00 40 80 00 00 	movabs %rax,0x804000
+  8003f4:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8003f7:	4c 89 f6             	mov    %r14,%rsi
+  8003fa:	44 89 ef             	mov    %r13d,%edi
+  8003fd:	48 b8 57 02 80 00 00 	movabs $0x800257,%rax
+  800404:	00 00 00 
+  800407:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  800409:	48 b8 1e 04 80 00 00 	movabs $0x80041e,%rax
+  800410:	00 00 00 
+  800413:	ff d0                	call   *%rax
+#endif
+}
+  800415:	5b                   	pop    %rbx
+  800416:	41 5c                	pop    %r12
+  800418:	41 5d                	pop    %r13
+  80041a:	41 5e                	pop    %r14
+  80041c:	5d                   	pop    %rbp
+  80041d:	c3                   	ret
+
+000000000080041e <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  80041e:	55                   	push   %rbp
+  80041f:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  800422:	48 b8 5e 1c 80 00 00 	movabs $0x801c5e,%rax
+  800429:	00 00 00 
+  80042c:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  80042e:	bf 00 00 00 00       	mov    $0x0,%edi
+  800433:	48 b8 3b 13 80 00 00 	movabs $0x80133b,%rax
+  80043a:	00 00 00 
+  80043d:	ff d0                	call   *%rax
+}
+  80043f:	5d                   	pop    %rbp
+  800440:	c3                   	ret
+
+0000000000800441 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  800441:	55                   	push   %rbp
+  800442:	48 89 e5             	mov    %rsp,%rbp
+  800445:	41 56                	push   %r14
+  800447:	41 55                	push   %r13
+  800449:	41 54                	push   %r12
+  80044b:	53                   	push   %rbx
+  80044c:	48 83 ec 50          	sub    $0x50,%rsp
+  800450:	49 89 fc             	mov    %rdi,%r12
+  800453:	41 89 f5             	mov    %esi,%r13d
+  800456:	48 89 d3             	mov    %rdx,%rbx
+  800459:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  80045d:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  800461:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800465:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  80046c:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800470:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  800474:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  800478:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  80047c:	48 b8 00 40 80 00 00 	movabs $0x804000,%rax
+  800483:	00 00 00 
+  800486:	4c 8b 30             	mov    (%rax),%r14
+  800489:	48 b8 a6 13 80 00 00 	movabs $0x8013a6,%rax
+  800490:	00 00 00 
+  800493:	ff d0                	call   *%rax
+  800495:	89 c6                	mov    %eax,%esi
+  800497:	45 89 e8             	mov    %r13d,%r8d
+  80049a:	4c 89 e1             	mov    %r12,%rcx
+  80049d:	4c 89 f2             	mov    %r14,%rdx
+  8004a0:	48 bf 40 32 80 00 00 	movabs $0x803240,%rdi
+  8004a7:	00 00 00 
+  8004aa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004af:	49 bc 91 05 80 00 00 	movabs $0x800591,%r12
+  8004b6:	00 00 00 
+  8004b9:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  8004bc:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  8004c0:	48 89 df             	mov    %rbx,%rdi
+  8004c3:	48 b8 2d 05 80 00 00 	movabs $0x80052d,%rax
+  8004ca:	00 00 00 
+  8004cd:	ff d0                	call   *%rax
+    cprintf("\n");
+  8004cf:	48 bf 5c 31 80 00 00 	movabs $0x80315c,%rdi
+  8004d6:	00 00 00 
+  8004d9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004de:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  8004e1:	cc                   	int3
+  8004e2:	eb fd                	jmp    8004e1 <_panic+0xa0>
+
+00000000008004e4 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  8004e4:	55                   	push   %rbp
+  8004e5:	48 89 e5             	mov    %rsp,%rbp
+  8004e8:	53                   	push   %rbx
+  8004e9:	48 83 ec 08          	sub    $0x8,%rsp
+  8004ed:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  8004f0:	8b 06                	mov    (%rsi),%eax
+  8004f2:	8d 50 01             	lea    0x1(%rax),%edx
+  8004f5:	89 16                	mov    %edx,(%rsi)
+  8004f7:	48 98                	cltq
+  8004f9:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  8004fe:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  800504:	74 0a                	je     800510 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  800506:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  80050a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80050e:	c9                   	leave
+  80050f:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  800510:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  800514:	be ff 00 00 00       	mov    $0xff,%esi
+  800519:	48 b8 dd 12 80 00 00 	movabs $0x8012dd,%rax
+  800520:	00 00 00 
+  800523:	ff d0                	call   *%rax
+        state->offset = 0;
+  800525:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  80052b:	eb d9                	jmp    800506 <putch+0x22>
+
+000000000080052d <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  80052d:	55                   	push   %rbp
+  80052e:	48 89 e5             	mov    %rsp,%rbp
+  800531:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  800538:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  80053b:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  800542:	b9 21 00 00 00       	mov    $0x21,%ecx
+  800547:	b8 00 00 00 00       	mov    $0x0,%eax
+  80054c:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  80054f:	48 89 f1             	mov    %rsi,%rcx
+  800552:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  800559:	48 bf e4 04 80 00 00 	movabs $0x8004e4,%rdi
+  800560:	00 00 00 
+  800563:	48 b8 e1 06 80 00 00 	movabs $0x8006e1,%rax
+  80056a:	00 00 00 
+  80056d:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  80056f:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  800576:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  80057d:	48 b8 dd 12 80 00 00 	movabs $0x8012dd,%rax
+  800584:	00 00 00 
+  800587:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  800589:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  80058f:	c9                   	leave
+  800590:	c3                   	ret
+
+0000000000800591 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  800591:	55                   	push   %rbp
+  800592:	48 89 e5             	mov    %rsp,%rbp
+  800595:	48 83 ec 50          	sub    $0x50,%rsp
+  800599:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  80059d:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8005a1:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8005a5:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8005a9:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  8005ad:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  8005b4:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8005b8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8005bc:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8005c0:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  8005c4:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  8005c8:	48 b8 2d 05 80 00 00 	movabs $0x80052d,%rax
+  8005cf:	00 00 00 
+  8005d2:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  8005d4:	c9                   	leave
+  8005d5:	c3                   	ret
+
+00000000008005d6 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  8005d6:	55                   	push   %rbp
+  8005d7:	48 89 e5             	mov    %rsp,%rbp
+  8005da:	41 57                	push   %r15
+  8005dc:	41 56                	push   %r14
+  8005de:	41 55                	push   %r13
+  8005e0:	41 54                	push   %r12
+  8005e2:	53                   	push   %rbx
+  8005e3:	48 83 ec 18          	sub    $0x18,%rsp
+  8005e7:	49 89 fc             	mov    %rdi,%r12
+  8005ea:	49 89 f5             	mov    %rsi,%r13
+  8005ed:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8005f1:	8b 45 10             	mov    0x10(%rbp),%eax
+  8005f4:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  8005f7:	41 89 cf             	mov    %ecx,%r15d
+  8005fa:	4c 39 fa             	cmp    %r15,%rdx
+  8005fd:	73 5b                	jae    80065a <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  8005ff:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  800603:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  800607:	85 db                	test   %ebx,%ebx
+  800609:	7e 0e                	jle    800619 <print_num+0x43>
+            putch(padc, put_arg);
+  80060b:	4c 89 ee             	mov    %r13,%rsi
+  80060e:	44 89 f7             	mov    %r14d,%edi
+  800611:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  800614:	83 eb 01             	sub    $0x1,%ebx
+  800617:	75 f2                	jne    80060b <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  800619:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  80061d:	48 b9 74 32 80 00 00 	movabs $0x803274,%rcx
+  800624:	00 00 00 
+  800627:	48 b8 63 32 80 00 00 	movabs $0x803263,%rax
+  80062e:	00 00 00 
+  800631:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  800635:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800639:	ba 00 00 00 00       	mov    $0x0,%edx
+  80063e:	49 f7 f7             	div    %r15
+  800641:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  800645:	4c 89 ee             	mov    %r13,%rsi
+  800648:	41 ff d4             	call   *%r12
+}
+  80064b:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  80064f:	5b                   	pop    %rbx
+  800650:	41 5c                	pop    %r12
+  800652:	41 5d                	pop    %r13
+  800654:	41 5e                	pop    %r14
+  800656:	41 5f                	pop    %r15
+  800658:	5d                   	pop    %rbp
+  800659:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  80065a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80065e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800663:	49 f7 f7             	div    %r15
+  800666:	48 83 ec 08          	sub    $0x8,%rsp
+  80066a:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  80066e:	52                   	push   %rdx
+  80066f:	45 0f be c9          	movsbl %r9b,%r9d
+  800673:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  800677:	48 89 c2             	mov    %rax,%rdx
+  80067a:	48 b8 d6 05 80 00 00 	movabs $0x8005d6,%rax
+  800681:	00 00 00 
+  800684:	ff d0                	call   *%rax
+  800686:	48 83 c4 10          	add    $0x10,%rsp
+  80068a:	eb 8d                	jmp    800619 <print_num+0x43>
+
+000000000080068c <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  80068c:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  800690:	48 8b 06             	mov    (%rsi),%rax
+  800693:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  800697:	73 0a                	jae    8006a3 <sprintputch+0x17>
+        *state->start++ = ch;
+  800699:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80069d:	48 89 16             	mov    %rdx,(%rsi)
+  8006a0:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  8006a3:	c3                   	ret
+
+00000000008006a4 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  8006a4:	55                   	push   %rbp
+  8006a5:	48 89 e5             	mov    %rsp,%rbp
+  8006a8:	48 83 ec 50          	sub    $0x50,%rsp
+  8006ac:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8006b0:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8006b4:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  8006b8:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8006bf:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8006c3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006c7:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8006cb:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  8006cf:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8006d3:	48 b8 e1 06 80 00 00 	movabs $0x8006e1,%rax
+  8006da:	00 00 00 
+  8006dd:	ff d0                	call   *%rax
+}
+  8006df:	c9                   	leave
+  8006e0:	c3                   	ret
+
+00000000008006e1 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  8006e1:	55                   	push   %rbp
+  8006e2:	48 89 e5             	mov    %rsp,%rbp
+  8006e5:	41 57                	push   %r15
+  8006e7:	41 56                	push   %r14
+  8006e9:	41 55                	push   %r13
+  8006eb:	41 54                	push   %r12
+  8006ed:	53                   	push   %rbx
+  8006ee:	48 83 ec 38          	sub    $0x38,%rsp
+  8006f2:	49 89 fe             	mov    %rdi,%r14
+  8006f5:	49 89 f5             	mov    %rsi,%r13
+  8006f8:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  8006fb:	48 8b 01             	mov    (%rcx),%rax
+  8006fe:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  800702:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800706:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80070a:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  80070e:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  800712:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  800716:	0f b6 3b             	movzbl (%rbx),%edi
+  800719:	40 80 ff 25          	cmp    $0x25,%dil
+  80071d:	74 18                	je     800737 <vprintfmt+0x56>
+            if (!ch) return;
+  80071f:	40 84 ff             	test   %dil,%dil
+  800722:	0f 84 b1 06 00 00    	je     800dd9 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  800728:	40 0f b6 ff          	movzbl %dil,%edi
+  80072c:	4c 89 ee             	mov    %r13,%rsi
+  80072f:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  800732:	4c 89 e3             	mov    %r12,%rbx
+  800735:	eb db                	jmp    800712 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  800737:	be 00 00 00 00       	mov    $0x0,%esi
+  80073c:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  800740:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  800745:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  80074b:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  800752:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800756:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  80075b:	41 0f b6 04 24       	movzbl (%r12),%eax
+  800760:	88 45 a0             	mov    %al,-0x60(%rbp)
+  800763:	83 e8 23             	sub    $0x23,%eax
+  800766:	3c 57                	cmp    $0x57,%al
+  800768:	0f 87 51 06 00 00    	ja     800dbf <vprintfmt+0x6de>
+  80076e:	0f b6 c0             	movzbl %al,%eax
+  800771:	48 b9 20 34 80 00 00 	movabs $0x803420,%rcx
+  800778:	00 00 00 
+  80077b:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  80077e:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  800781:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  800785:	eb cf                	jmp    800756 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  800787:	49 89 dc             	mov    %rbx,%r12
+  80078a:	be 01 00 00 00       	mov    $0x1,%esi
+  80078f:	eb c5                	jmp    800756 <vprintfmt+0x75>
+            padc = ch;
+  800791:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  800795:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800798:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80079b:	eb b9                	jmp    800756 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  80079d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007a0:	83 f8 2f             	cmp    $0x2f,%eax
+  8007a3:	77 24                	ja     8007c9 <vprintfmt+0xe8>
+  8007a5:	89 c1                	mov    %eax,%ecx
+  8007a7:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  8007ab:	83 c0 08             	add    $0x8,%eax
+  8007ae:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007b1:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  8007b4:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  8007b7:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8007bb:	79 99                	jns    800756 <vprintfmt+0x75>
+                width = precision;
+  8007bd:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  8007c1:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8007c7:	eb 8d                	jmp    800756 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8007c9:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8007cd:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  8007d1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007d5:	eb da                	jmp    8007b1 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  8007d7:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  8007dc:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8007e0:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  8007e6:	3c 39                	cmp    $0x39,%al
+  8007e8:	77 1c                	ja     800806 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  8007ea:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  8007ee:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  8007f2:	0f b6 c0             	movzbl %al,%eax
+  8007f5:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8007fa:	0f b6 03             	movzbl (%rbx),%eax
+  8007fd:	3c 39                	cmp    $0x39,%al
+  8007ff:	76 e9                	jbe    8007ea <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  800801:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  800804:	eb b1                	jmp    8007b7 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  800806:	49 89 dc             	mov    %rbx,%r12
+  800809:	eb ac                	jmp    8007b7 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  80080b:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  80080e:	85 c9                	test   %ecx,%ecx
+  800810:	b8 00 00 00 00       	mov    $0x0,%eax
+  800815:	0f 49 c1             	cmovns %ecx,%eax
+  800818:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  80081b:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80081e:	e9 33 ff ff ff       	jmp    800756 <vprintfmt+0x75>
+            lflag++;
+  800823:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  800826:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800829:	e9 28 ff ff ff       	jmp    800756 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  80082e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800831:	83 f8 2f             	cmp    $0x2f,%eax
+  800834:	77 19                	ja     80084f <vprintfmt+0x16e>
+  800836:	89 c2                	mov    %eax,%edx
+  800838:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80083c:	83 c0 08             	add    $0x8,%eax
+  80083f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800842:	8b 3a                	mov    (%rdx),%edi
+  800844:	4c 89 ee             	mov    %r13,%rsi
+  800847:	41 ff d6             	call   *%r14
+            break;
+  80084a:	e9 c3 fe ff ff       	jmp    800712 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  80084f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800853:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800857:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80085b:	eb e5                	jmp    800842 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  80085d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800860:	83 f8 2f             	cmp    $0x2f,%eax
+  800863:	77 5a                	ja     8008bf <vprintfmt+0x1de>
+  800865:	89 c2                	mov    %eax,%edx
+  800867:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80086b:	83 c0 08             	add    $0x8,%eax
+  80086e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  800871:	8b 02                	mov    (%rdx),%eax
+  800873:	89 c1                	mov    %eax,%ecx
+  800875:	f7 d9                	neg    %ecx
+  800877:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  80087a:	83 f9 15             	cmp    $0x15,%ecx
+  80087d:	7f 4e                	jg     8008cd <vprintfmt+0x1ec>
+  80087f:	48 63 c1             	movslq %ecx,%rax
+  800882:	48 ba e0 36 80 00 00 	movabs $0x8036e0,%rdx
+  800889:	00 00 00 
+  80088c:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  800890:	48 85 c0             	test   %rax,%rax
+  800893:	74 38                	je     8008cd <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  800895:	48 89 c1             	mov    %rax,%rcx
+  800898:	48 ba d9 38 80 00 00 	movabs $0x8038d9,%rdx
+  80089f:	00 00 00 
+  8008a2:	4c 89 ee             	mov    %r13,%rsi
+  8008a5:	4c 89 f7             	mov    %r14,%rdi
+  8008a8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008ad:	49 b8 a4 06 80 00 00 	movabs $0x8006a4,%r8
+  8008b4:	00 00 00 
+  8008b7:	41 ff d0             	call   *%r8
+  8008ba:	e9 53 fe ff ff       	jmp    800712 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  8008bf:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008c3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008c7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008cb:	eb a4                	jmp    800871 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  8008cd:	48 ba 8c 32 80 00 00 	movabs $0x80328c,%rdx
+  8008d4:	00 00 00 
+  8008d7:	4c 89 ee             	mov    %r13,%rsi
+  8008da:	4c 89 f7             	mov    %r14,%rdi
+  8008dd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008e2:	49 b8 a4 06 80 00 00 	movabs $0x8006a4,%r8
+  8008e9:	00 00 00 
+  8008ec:	41 ff d0             	call   *%r8
+  8008ef:	e9 1e fe ff ff       	jmp    800712 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8008f4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008f7:	83 f8 2f             	cmp    $0x2f,%eax
+  8008fa:	77 6c                	ja     800968 <vprintfmt+0x287>
+  8008fc:	89 c2                	mov    %eax,%edx
+  8008fe:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800902:	83 c0 08             	add    $0x8,%eax
+  800905:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800908:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  80090b:	48 85 d2             	test   %rdx,%rdx
+  80090e:	48 b8 85 32 80 00 00 	movabs $0x803285,%rax
+  800915:	00 00 00 
+  800918:	48 0f 45 c2          	cmovne %rdx,%rax
+  80091c:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  800920:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800924:	7e 06                	jle    80092c <vprintfmt+0x24b>
+  800926:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  80092a:	75 4a                	jne    800976 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  80092c:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800930:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  800934:	0f b6 00             	movzbl (%rax),%eax
+  800937:	84 c0                	test   %al,%al
+  800939:	0f 85 9a 00 00 00    	jne    8009d9 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  80093f:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800942:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  800946:	85 c0                	test   %eax,%eax
+  800948:	0f 8e c4 fd ff ff    	jle    800712 <vprintfmt+0x31>
+  80094e:	4c 89 ee             	mov    %r13,%rsi
+  800951:	bf 20 00 00 00       	mov    $0x20,%edi
+  800956:	41 ff d6             	call   *%r14
+  800959:	41 83 ec 01          	sub    $0x1,%r12d
+  80095d:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  800961:	75 eb                	jne    80094e <vprintfmt+0x26d>
+  800963:	e9 aa fd ff ff       	jmp    800712 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800968:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80096c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800970:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800974:	eb 92                	jmp    800908 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  800976:	49 63 f7             	movslq %r15d,%rsi
+  800979:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  80097d:	48 b8 93 0e 80 00 00 	movabs $0x800e93,%rax
+  800984:	00 00 00 
+  800987:	ff d0                	call   *%rax
+  800989:	48 89 c2             	mov    %rax,%rdx
+  80098c:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80098f:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  800991:	8d 70 ff             	lea    -0x1(%rax),%esi
+  800994:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  800997:	85 c0                	test   %eax,%eax
+  800999:	7e 91                	jle    80092c <vprintfmt+0x24b>
+  80099b:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  8009a0:	4c 89 ee             	mov    %r13,%rsi
+  8009a3:	44 89 e7             	mov    %r12d,%edi
+  8009a6:	41 ff d6             	call   *%r14
+  8009a9:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8009ad:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8009b0:	83 f8 ff             	cmp    $0xffffffff,%eax
+  8009b3:	75 eb                	jne    8009a0 <vprintfmt+0x2bf>
+  8009b5:	e9 72 ff ff ff       	jmp    80092c <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8009ba:	0f b6 f8             	movzbl %al,%edi
+  8009bd:	4c 89 ee             	mov    %r13,%rsi
+  8009c0:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8009c3:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8009c7:	49 83 c4 01          	add    $0x1,%r12
+  8009cb:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  8009d1:	84 c0                	test   %al,%al
+  8009d3:	0f 84 66 ff ff ff    	je     80093f <vprintfmt+0x25e>
+  8009d9:	45 85 ff             	test   %r15d,%r15d
+  8009dc:	78 0a                	js     8009e8 <vprintfmt+0x307>
+  8009de:	41 83 ef 01          	sub    $0x1,%r15d
+  8009e2:	0f 88 57 ff ff ff    	js     80093f <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8009e8:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  8009ec:	74 cc                	je     8009ba <vprintfmt+0x2d9>
+  8009ee:	8d 50 e0             	lea    -0x20(%rax),%edx
+  8009f1:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  8009f6:	80 fa 5e             	cmp    $0x5e,%dl
+  8009f9:	77 c2                	ja     8009bd <vprintfmt+0x2dc>
+  8009fb:	eb bd                	jmp    8009ba <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  8009fd:	40 84 f6             	test   %sil,%sil
+  800a00:	75 26                	jne    800a28 <vprintfmt+0x347>
+    switch (lflag) {
+  800a02:	85 d2                	test   %edx,%edx
+  800a04:	74 59                	je     800a5f <vprintfmt+0x37e>
+  800a06:	83 fa 01             	cmp    $0x1,%edx
+  800a09:	74 7b                	je     800a86 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  800a0b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a0e:	83 f8 2f             	cmp    $0x2f,%eax
+  800a11:	0f 87 96 00 00 00    	ja     800aad <vprintfmt+0x3cc>
+  800a17:	89 c2                	mov    %eax,%edx
+  800a19:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a1d:	83 c0 08             	add    $0x8,%eax
+  800a20:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a23:	4c 8b 22             	mov    (%rdx),%r12
+  800a26:	eb 17                	jmp    800a3f <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  800a28:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a2b:	83 f8 2f             	cmp    $0x2f,%eax
+  800a2e:	77 21                	ja     800a51 <vprintfmt+0x370>
+  800a30:	89 c2                	mov    %eax,%edx
+  800a32:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a36:	83 c0 08             	add    $0x8,%eax
+  800a39:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a3c:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  800a3f:	4d 85 e4             	test   %r12,%r12
+  800a42:	78 7a                	js     800abe <vprintfmt+0x3dd>
+            num = i;
+  800a44:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  800a47:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  800a4c:	e9 50 02 00 00       	jmp    800ca1 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800a51:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a55:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a59:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a5d:	eb dd                	jmp    800a3c <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  800a5f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a62:	83 f8 2f             	cmp    $0x2f,%eax
+  800a65:	77 11                	ja     800a78 <vprintfmt+0x397>
+  800a67:	89 c2                	mov    %eax,%edx
+  800a69:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a6d:	83 c0 08             	add    $0x8,%eax
+  800a70:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a73:	4c 63 22             	movslq (%rdx),%r12
+  800a76:	eb c7                	jmp    800a3f <vprintfmt+0x35e>
+  800a78:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a7c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a80:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a84:	eb ed                	jmp    800a73 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  800a86:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a89:	83 f8 2f             	cmp    $0x2f,%eax
+  800a8c:	77 11                	ja     800a9f <vprintfmt+0x3be>
+  800a8e:	89 c2                	mov    %eax,%edx
+  800a90:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a94:	83 c0 08             	add    $0x8,%eax
+  800a97:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a9a:	4c 8b 22             	mov    (%rdx),%r12
+  800a9d:	eb a0                	jmp    800a3f <vprintfmt+0x35e>
+  800a9f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800aa3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800aa7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800aab:	eb ed                	jmp    800a9a <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  800aad:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ab1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ab5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ab9:	e9 65 ff ff ff       	jmp    800a23 <vprintfmt+0x342>
+                putch('-', put_arg);
+  800abe:	4c 89 ee             	mov    %r13,%rsi
+  800ac1:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800ac6:	41 ff d6             	call   *%r14
+                i = -i;
+  800ac9:	49 f7 dc             	neg    %r12
+  800acc:	e9 73 ff ff ff       	jmp    800a44 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  800ad1:	40 84 f6             	test   %sil,%sil
+  800ad4:	75 32                	jne    800b08 <vprintfmt+0x427>
+    switch (lflag) {
+  800ad6:	85 d2                	test   %edx,%edx
+  800ad8:	74 5d                	je     800b37 <vprintfmt+0x456>
+  800ada:	83 fa 01             	cmp    $0x1,%edx
+  800add:	0f 84 82 00 00 00    	je     800b65 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  800ae3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ae6:	83 f8 2f             	cmp    $0x2f,%eax
+  800ae9:	0f 87 a5 00 00 00    	ja     800b94 <vprintfmt+0x4b3>
+  800aef:	89 c2                	mov    %eax,%edx
+  800af1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800af5:	83 c0 08             	add    $0x8,%eax
+  800af8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800afb:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800afe:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  800b03:	e9 99 01 00 00       	jmp    800ca1 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800b08:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b0b:	83 f8 2f             	cmp    $0x2f,%eax
+  800b0e:	77 19                	ja     800b29 <vprintfmt+0x448>
+  800b10:	89 c2                	mov    %eax,%edx
+  800b12:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b16:	83 c0 08             	add    $0x8,%eax
+  800b19:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b1c:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800b1f:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800b24:	e9 78 01 00 00       	jmp    800ca1 <vprintfmt+0x5c0>
+  800b29:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b2d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b31:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b35:	eb e5                	jmp    800b1c <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  800b37:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b3a:	83 f8 2f             	cmp    $0x2f,%eax
+  800b3d:	77 18                	ja     800b57 <vprintfmt+0x476>
+  800b3f:	89 c2                	mov    %eax,%edx
+  800b41:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b45:	83 c0 08             	add    $0x8,%eax
+  800b48:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b4b:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800b4d:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  800b52:	e9 4a 01 00 00       	jmp    800ca1 <vprintfmt+0x5c0>
+  800b57:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b5b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b5f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b63:	eb e6                	jmp    800b4b <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  800b65:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b68:	83 f8 2f             	cmp    $0x2f,%eax
+  800b6b:	77 19                	ja     800b86 <vprintfmt+0x4a5>
+  800b6d:	89 c2                	mov    %eax,%edx
+  800b6f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b73:	83 c0 08             	add    $0x8,%eax
+  800b76:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b79:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800b7c:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  800b81:	e9 1b 01 00 00       	jmp    800ca1 <vprintfmt+0x5c0>
+  800b86:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b8a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b8e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b92:	eb e5                	jmp    800b79 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  800b94:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b98:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b9c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ba0:	e9 56 ff ff ff       	jmp    800afb <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  800ba5:	40 84 f6             	test   %sil,%sil
+  800ba8:	75 2e                	jne    800bd8 <vprintfmt+0x4f7>
+    switch (lflag) {
+  800baa:	85 d2                	test   %edx,%edx
+  800bac:	74 59                	je     800c07 <vprintfmt+0x526>
+  800bae:	83 fa 01             	cmp    $0x1,%edx
+  800bb1:	74 7f                	je     800c32 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  800bb3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bb6:	83 f8 2f             	cmp    $0x2f,%eax
+  800bb9:	0f 87 9f 00 00 00    	ja     800c5e <vprintfmt+0x57d>
+  800bbf:	89 c2                	mov    %eax,%edx
+  800bc1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800bc5:	83 c0 08             	add    $0x8,%eax
+  800bc8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800bcb:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800bce:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  800bd3:	e9 c9 00 00 00       	jmp    800ca1 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800bd8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bdb:	83 f8 2f             	cmp    $0x2f,%eax
+  800bde:	77 19                	ja     800bf9 <vprintfmt+0x518>
+  800be0:	89 c2                	mov    %eax,%edx
+  800be2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800be6:	83 c0 08             	add    $0x8,%eax
+  800be9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800bec:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800bef:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800bf4:	e9 a8 00 00 00       	jmp    800ca1 <vprintfmt+0x5c0>
+  800bf9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bfd:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c01:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c05:	eb e5                	jmp    800bec <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  800c07:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c0a:	83 f8 2f             	cmp    $0x2f,%eax
+  800c0d:	77 15                	ja     800c24 <vprintfmt+0x543>
+  800c0f:	89 c2                	mov    %eax,%edx
+  800c11:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c15:	83 c0 08             	add    $0x8,%eax
+  800c18:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c1b:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  800c1d:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  800c22:	eb 7d                	jmp    800ca1 <vprintfmt+0x5c0>
+  800c24:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c28:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c2c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c30:	eb e9                	jmp    800c1b <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  800c32:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c35:	83 f8 2f             	cmp    $0x2f,%eax
+  800c38:	77 16                	ja     800c50 <vprintfmt+0x56f>
+  800c3a:	89 c2                	mov    %eax,%edx
+  800c3c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c40:	83 c0 08             	add    $0x8,%eax
+  800c43:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c46:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800c49:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  800c4e:	eb 51                	jmp    800ca1 <vprintfmt+0x5c0>
+  800c50:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c54:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c58:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c5c:	eb e8                	jmp    800c46 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  800c5e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c62:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c66:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c6a:	e9 5c ff ff ff       	jmp    800bcb <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  800c6f:	4c 89 ee             	mov    %r13,%rsi
+  800c72:	bf 30 00 00 00       	mov    $0x30,%edi
+  800c77:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800c7a:	4c 89 ee             	mov    %r13,%rsi
+  800c7d:	bf 78 00 00 00       	mov    $0x78,%edi
+  800c82:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800c85:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c88:	83 f8 2f             	cmp    $0x2f,%eax
+  800c8b:	77 47                	ja     800cd4 <vprintfmt+0x5f3>
+  800c8d:	89 c2                	mov    %eax,%edx
+  800c8f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c93:	83 c0 08             	add    $0x8,%eax
+  800c96:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c99:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800c9c:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800ca1:	48 83 ec 08          	sub    $0x8,%rsp
+  800ca5:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800ca9:	0f 94 c0             	sete   %al
+  800cac:	0f b6 c0             	movzbl %al,%eax
+  800caf:	50                   	push   %rax
+  800cb0:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800cb5:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800cb9:	4c 89 ee             	mov    %r13,%rsi
+  800cbc:	4c 89 f7             	mov    %r14,%rdi
+  800cbf:	48 b8 d6 05 80 00 00 	movabs $0x8005d6,%rax
+  800cc6:	00 00 00 
+  800cc9:	ff d0                	call   *%rax
+            break;
+  800ccb:	48 83 c4 10          	add    $0x10,%rsp
+  800ccf:	e9 3e fa ff ff       	jmp    800712 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800cd4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800cd8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800cdc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ce0:	eb b7                	jmp    800c99 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  800ce2:	40 84 f6             	test   %sil,%sil
+  800ce5:	75 2b                	jne    800d12 <vprintfmt+0x631>
+    switch (lflag) {
+  800ce7:	85 d2                	test   %edx,%edx
+  800ce9:	74 56                	je     800d41 <vprintfmt+0x660>
+  800ceb:	83 fa 01             	cmp    $0x1,%edx
+  800cee:	74 7f                	je     800d6f <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800cf0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800cf3:	83 f8 2f             	cmp    $0x2f,%eax
+  800cf6:	0f 87 a2 00 00 00    	ja     800d9e <vprintfmt+0x6bd>
+  800cfc:	89 c2                	mov    %eax,%edx
+  800cfe:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d02:	83 c0 08             	add    $0x8,%eax
+  800d05:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d08:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800d0b:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800d10:	eb 8f                	jmp    800ca1 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800d12:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d15:	83 f8 2f             	cmp    $0x2f,%eax
+  800d18:	77 19                	ja     800d33 <vprintfmt+0x652>
+  800d1a:	89 c2                	mov    %eax,%edx
+  800d1c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d20:	83 c0 08             	add    $0x8,%eax
+  800d23:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d26:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800d29:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800d2e:	e9 6e ff ff ff       	jmp    800ca1 <vprintfmt+0x5c0>
+  800d33:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d37:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d3b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d3f:	eb e5                	jmp    800d26 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800d41:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d44:	83 f8 2f             	cmp    $0x2f,%eax
+  800d47:	77 18                	ja     800d61 <vprintfmt+0x680>
+  800d49:	89 c2                	mov    %eax,%edx
+  800d4b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d4f:	83 c0 08             	add    $0x8,%eax
+  800d52:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d55:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800d57:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800d5c:	e9 40 ff ff ff       	jmp    800ca1 <vprintfmt+0x5c0>
+  800d61:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d65:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d69:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d6d:	eb e6                	jmp    800d55 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800d6f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d72:	83 f8 2f             	cmp    $0x2f,%eax
+  800d75:	77 19                	ja     800d90 <vprintfmt+0x6af>
+  800d77:	89 c2                	mov    %eax,%edx
+  800d79:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d7d:	83 c0 08             	add    $0x8,%eax
+  800d80:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d83:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800d86:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800d8b:	e9 11 ff ff ff       	jmp    800ca1 <vprintfmt+0x5c0>
+  800d90:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d94:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d98:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d9c:	eb e5                	jmp    800d83 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800d9e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800da2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800da6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800daa:	e9 59 ff ff ff       	jmp    800d08 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800daf:	4c 89 ee             	mov    %r13,%rsi
+  800db2:	bf 25 00 00 00       	mov    $0x25,%edi
+  800db7:	41 ff d6             	call   *%r14
+            break;
+  800dba:	e9 53 f9 ff ff       	jmp    800712 <vprintfmt+0x31>
+            putch('%', put_arg);
+  800dbf:	4c 89 ee             	mov    %r13,%rsi
+  800dc2:	bf 25 00 00 00       	mov    $0x25,%edi
+  800dc7:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800dca:	48 83 eb 01          	sub    $0x1,%rbx
+  800dce:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800dd2:	75 f6                	jne    800dca <vprintfmt+0x6e9>
+  800dd4:	e9 39 f9 ff ff       	jmp    800712 <vprintfmt+0x31>
+}
+  800dd9:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800ddd:	5b                   	pop    %rbx
+  800dde:	41 5c                	pop    %r12
+  800de0:	41 5d                	pop    %r13
+  800de2:	41 5e                	pop    %r14
+  800de4:	41 5f                	pop    %r15
+  800de6:	5d                   	pop    %rbp
+  800de7:	c3                   	ret
+
+0000000000800de8 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800de8:	55                   	push   %rbp
+  800de9:	48 89 e5             	mov    %rsp,%rbp
+  800dec:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800df0:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800df4:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800df9:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800dfd:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800e04:	48 85 ff             	test   %rdi,%rdi
+  800e07:	74 2b                	je     800e34 <vsnprintf+0x4c>
+  800e09:	48 85 f6             	test   %rsi,%rsi
+  800e0c:	74 26                	je     800e34 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800e0e:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800e12:	48 bf 8c 06 80 00 00 	movabs $0x80068c,%rdi
+  800e19:	00 00 00 
+  800e1c:	48 b8 e1 06 80 00 00 	movabs $0x8006e1,%rax
+  800e23:	00 00 00 
+  800e26:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800e28:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800e2c:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800e2f:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800e32:	c9                   	leave
+  800e33:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800e34:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800e39:	eb f7                	jmp    800e32 <vsnprintf+0x4a>
+
+0000000000800e3b <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800e3b:	55                   	push   %rbp
+  800e3c:	48 89 e5             	mov    %rsp,%rbp
+  800e3f:	48 83 ec 50          	sub    $0x50,%rsp
+  800e43:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800e47:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800e4b:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800e4f:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800e56:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800e5a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e5e:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800e62:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800e66:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800e6a:	48 b8 e8 0d 80 00 00 	movabs $0x800de8,%rax
+  800e71:	00 00 00 
+  800e74:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800e76:	c9                   	leave
+  800e77:	c3                   	ret
+
+0000000000800e78 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800e78:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800e7b:	74 10                	je     800e8d <strlen+0x15>
+    size_t n = 0;
+  800e7d:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800e82:	48 83 c0 01          	add    $0x1,%rax
+  800e86:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800e8a:	75 f6                	jne    800e82 <strlen+0xa>
+  800e8c:	c3                   	ret
+    size_t n = 0;
+  800e8d:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800e92:	c3                   	ret
+
+0000000000800e93 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800e93:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800e96:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800e9b:	48 85 f6             	test   %rsi,%rsi
+  800e9e:	74 11                	je     800eb1 <strnlen+0x1e>
+  800ea0:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800ea4:	74 0c                	je     800eb2 <strnlen+0x1f>
+  800ea6:	48 83 c2 01          	add    $0x1,%rdx
+  800eaa:	48 39 d0             	cmp    %rdx,%rax
+  800ead:	75 f1                	jne    800ea0 <strnlen+0xd>
+  800eaf:	eb 04                	jmp    800eb5 <strnlen+0x22>
+  800eb1:	c3                   	ret
+  800eb2:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800eb5:	c3                   	ret
+
+0000000000800eb6 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800eb6:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800eb9:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ebe:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800ec2:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800ec5:	48 83 c2 01          	add    $0x1,%rdx
+  800ec9:	84 c9                	test   %cl,%cl
+  800ecb:	75 f1                	jne    800ebe <strcpy+0x8>
+        ;
+    return res;
+}
+  800ecd:	c3                   	ret
+
+0000000000800ece <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800ece:	55                   	push   %rbp
+  800ecf:	48 89 e5             	mov    %rsp,%rbp
+  800ed2:	41 54                	push   %r12
+  800ed4:	53                   	push   %rbx
+  800ed5:	48 89 fb             	mov    %rdi,%rbx
+  800ed8:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800edb:	48 b8 78 0e 80 00 00 	movabs $0x800e78,%rax
+  800ee2:	00 00 00 
+  800ee5:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800ee7:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800eeb:	4c 89 e6             	mov    %r12,%rsi
+  800eee:	48 b8 b6 0e 80 00 00 	movabs $0x800eb6,%rax
+  800ef5:	00 00 00 
+  800ef8:	ff d0                	call   *%rax
+    return dst;
+}
+  800efa:	48 89 d8             	mov    %rbx,%rax
+  800efd:	5b                   	pop    %rbx
+  800efe:	41 5c                	pop    %r12
+  800f00:	5d                   	pop    %rbp
+  800f01:	c3                   	ret
+
+0000000000800f02 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800f02:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800f05:	48 85 d2             	test   %rdx,%rdx
+  800f08:	74 1f                	je     800f29 <strncpy+0x27>
+  800f0a:	48 01 fa             	add    %rdi,%rdx
+  800f0d:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800f10:	48 83 c1 01          	add    $0x1,%rcx
+  800f14:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800f18:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800f1c:	41 80 f8 01          	cmp    $0x1,%r8b
+  800f20:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800f24:	48 39 ca             	cmp    %rcx,%rdx
+  800f27:	75 e7                	jne    800f10 <strncpy+0xe>
+    }
+    return ret;
+}
+  800f29:	c3                   	ret
+
+0000000000800f2a <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800f2a:	48 89 f8             	mov    %rdi,%rax
+  800f2d:	48 85 d2             	test   %rdx,%rdx
+  800f30:	74 24                	je     800f56 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800f32:	48 83 ea 01          	sub    $0x1,%rdx
+  800f36:	74 1b                	je     800f53 <strlcpy+0x29>
+  800f38:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800f3c:	0f b6 16             	movzbl (%rsi),%edx
+  800f3f:	84 d2                	test   %dl,%dl
+  800f41:	74 10                	je     800f53 <strlcpy+0x29>
+            *dst++ = *src++;
+  800f43:	48 83 c6 01          	add    $0x1,%rsi
+  800f47:	48 83 c0 01          	add    $0x1,%rax
+  800f4b:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800f4e:	48 39 c8             	cmp    %rcx,%rax
+  800f51:	75 e9                	jne    800f3c <strlcpy+0x12>
+        *dst = '\0';
+  800f53:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800f56:	48 29 f8             	sub    %rdi,%rax
+}
+  800f59:	c3                   	ret
+
+0000000000800f5a <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800f5a:	0f b6 07             	movzbl (%rdi),%eax
+  800f5d:	84 c0                	test   %al,%al
+  800f5f:	74 13                	je     800f74 <strcmp+0x1a>
+  800f61:	38 06                	cmp    %al,(%rsi)
+  800f63:	75 0f                	jne    800f74 <strcmp+0x1a>
+  800f65:	48 83 c7 01          	add    $0x1,%rdi
+  800f69:	48 83 c6 01          	add    $0x1,%rsi
+  800f6d:	0f b6 07             	movzbl (%rdi),%eax
+  800f70:	84 c0                	test   %al,%al
+  800f72:	75 ed                	jne    800f61 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800f74:	0f b6 c0             	movzbl %al,%eax
+  800f77:	0f b6 16             	movzbl (%rsi),%edx
+  800f7a:	29 d0                	sub    %edx,%eax
+}
+  800f7c:	c3                   	ret
+
+0000000000800f7d <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800f7d:	48 85 d2             	test   %rdx,%rdx
+  800f80:	74 1f                	je     800fa1 <strncmp+0x24>
+  800f82:	0f b6 07             	movzbl (%rdi),%eax
+  800f85:	84 c0                	test   %al,%al
+  800f87:	74 1e                	je     800fa7 <strncmp+0x2a>
+  800f89:	3a 06                	cmp    (%rsi),%al
+  800f8b:	75 1a                	jne    800fa7 <strncmp+0x2a>
+  800f8d:	48 83 c7 01          	add    $0x1,%rdi
+  800f91:	48 83 c6 01          	add    $0x1,%rsi
+  800f95:	48 83 ea 01          	sub    $0x1,%rdx
+  800f99:	75 e7                	jne    800f82 <strncmp+0x5>
+
+    if (!n) return 0;
+  800f9b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fa0:	c3                   	ret
+  800fa1:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fa6:	c3                   	ret
+  800fa7:	48 85 d2             	test   %rdx,%rdx
+  800faa:	74 09                	je     800fb5 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800fac:	0f b6 07             	movzbl (%rdi),%eax
+  800faf:	0f b6 16             	movzbl (%rsi),%edx
+  800fb2:	29 d0                	sub    %edx,%eax
+  800fb4:	c3                   	ret
+    if (!n) return 0;
+  800fb5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800fba:	c3                   	ret
+
+0000000000800fbb <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800fbb:	0f b6 17             	movzbl (%rdi),%edx
+  800fbe:	84 d2                	test   %dl,%dl
+  800fc0:	74 18                	je     800fda <strchr+0x1f>
+        if (*str == c) {
+  800fc2:	0f be d2             	movsbl %dl,%edx
+  800fc5:	39 f2                	cmp    %esi,%edx
+  800fc7:	74 17                	je     800fe0 <strchr+0x25>
+    for (; *str; str++) {
+  800fc9:	48 83 c7 01          	add    $0x1,%rdi
+  800fcd:	0f b6 17             	movzbl (%rdi),%edx
+  800fd0:	84 d2                	test   %dl,%dl
+  800fd2:	75 ee                	jne    800fc2 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800fd4:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fd9:	c3                   	ret
+  800fda:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fdf:	c3                   	ret
+  800fe0:	48 89 f8             	mov    %rdi,%rax
+}
+  800fe3:	c3                   	ret
+
+0000000000800fe4 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800fe4:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800fe7:	0f b6 17             	movzbl (%rdi),%edx
+  800fea:	84 d2                	test   %dl,%dl
+  800fec:	74 13                	je     801001 <strfind+0x1d>
+  800fee:	0f be d2             	movsbl %dl,%edx
+  800ff1:	39 f2                	cmp    %esi,%edx
+  800ff3:	74 0b                	je     801000 <strfind+0x1c>
+  800ff5:	48 83 c0 01          	add    $0x1,%rax
+  800ff9:	0f b6 10             	movzbl (%rax),%edx
+  800ffc:	84 d2                	test   %dl,%dl
+  800ffe:	75 ee                	jne    800fee <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  801000:	c3                   	ret
+  801001:	c3                   	ret
+
+0000000000801002 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  801002:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  801005:	48 89 f8             	mov    %rdi,%rax
+  801008:	48 f7 d8             	neg    %rax
+  80100b:	83 e0 07             	and    $0x7,%eax
+  80100e:	49 89 d1             	mov    %rdx,%r9
+  801011:	49 29 c1             	sub    %rax,%r9
+  801014:	78 36                	js     80104c <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  801016:	40 0f b6 c6          	movzbl %sil,%eax
+  80101a:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  801021:	01 01 01 
+  801024:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  801028:	40 f6 c7 07          	test   $0x7,%dil
+  80102c:	75 38                	jne    801066 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  80102e:	4c 89 c9             	mov    %r9,%rcx
+  801031:	48 c1 f9 03          	sar    $0x3,%rcx
+  801035:	74 0c                	je     801043 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  801037:	fc                   	cld
+  801038:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  80103b:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  80103f:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  801043:	4d 85 c9             	test   %r9,%r9
+  801046:	75 45                	jne    80108d <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  801048:	4c 89 c0             	mov    %r8,%rax
+  80104b:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  80104c:	48 85 d2             	test   %rdx,%rdx
+  80104f:	74 f7                	je     801048 <memset+0x46>
+  801051:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  801054:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  801057:	48 83 c0 01          	add    $0x1,%rax
+  80105b:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  80105f:	48 39 c2             	cmp    %rax,%rdx
+  801062:	75 f3                	jne    801057 <memset+0x55>
+  801064:	eb e2                	jmp    801048 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  801066:	40 f6 c7 01          	test   $0x1,%dil
+  80106a:	74 06                	je     801072 <memset+0x70>
+  80106c:	88 07                	mov    %al,(%rdi)
+  80106e:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  801072:	40 f6 c7 02          	test   $0x2,%dil
+  801076:	74 07                	je     80107f <memset+0x7d>
+  801078:	66 89 07             	mov    %ax,(%rdi)
+  80107b:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  80107f:	40 f6 c7 04          	test   $0x4,%dil
+  801083:	74 a9                	je     80102e <memset+0x2c>
+  801085:	89 07                	mov    %eax,(%rdi)
+  801087:	48 83 c7 04          	add    $0x4,%rdi
+  80108b:	eb a1                	jmp    80102e <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  80108d:	41 f6 c1 04          	test   $0x4,%r9b
+  801091:	74 06                	je     801099 <memset+0x97>
+  801093:	89 07                	mov    %eax,(%rdi)
+  801095:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  801099:	41 f6 c1 02          	test   $0x2,%r9b
+  80109d:	74 07                	je     8010a6 <memset+0xa4>
+  80109f:	66 89 07             	mov    %ax,(%rdi)
+  8010a2:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  8010a6:	41 f6 c1 01          	test   $0x1,%r9b
+  8010aa:	74 9c                	je     801048 <memset+0x46>
+  8010ac:	88 07                	mov    %al,(%rdi)
+  8010ae:	eb 98                	jmp    801048 <memset+0x46>
+
+00000000008010b0 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  8010b0:	48 89 f8             	mov    %rdi,%rax
+  8010b3:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  8010b6:	48 39 fe             	cmp    %rdi,%rsi
+  8010b9:	73 3b                	jae    8010f6 <memmove+0x46>
+  8010bb:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  8010bf:	48 39 d7             	cmp    %rdx,%rdi
+  8010c2:	73 32                	jae    8010f6 <memmove+0x46>
+        s += n;
+        d += n;
+  8010c4:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  8010c8:	48 89 d6             	mov    %rdx,%rsi
+  8010cb:	48 09 fe             	or     %rdi,%rsi
+  8010ce:	48 09 ce             	or     %rcx,%rsi
+  8010d1:	40 f6 c6 07          	test   $0x7,%sil
+  8010d5:	75 12                	jne    8010e9 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  8010d7:	48 83 ef 08          	sub    $0x8,%rdi
+  8010db:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  8010df:	48 c1 e9 03          	shr    $0x3,%rcx
+  8010e3:	fd                   	std
+  8010e4:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  8010e7:	fc                   	cld
+  8010e8:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  8010e9:	48 83 ef 01          	sub    $0x1,%rdi
+  8010ed:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  8010f1:	fd                   	std
+  8010f2:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  8010f4:	eb f1                	jmp    8010e7 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  8010f6:	48 89 f2             	mov    %rsi,%rdx
+  8010f9:	48 09 c2             	or     %rax,%rdx
+  8010fc:	48 09 ca             	or     %rcx,%rdx
+  8010ff:	f6 c2 07             	test   $0x7,%dl
+  801102:	75 0c                	jne    801110 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  801104:	48 c1 e9 03          	shr    $0x3,%rcx
+  801108:	48 89 c7             	mov    %rax,%rdi
+  80110b:	fc                   	cld
+  80110c:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  80110f:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  801110:	48 89 c7             	mov    %rax,%rdi
+  801113:	fc                   	cld
+  801114:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  801116:	c3                   	ret
+
+0000000000801117 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  801117:	55                   	push   %rbp
+  801118:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  80111b:	48 b8 b0 10 80 00 00 	movabs $0x8010b0,%rax
+  801122:	00 00 00 
+  801125:	ff d0                	call   *%rax
+}
+  801127:	5d                   	pop    %rbp
+  801128:	c3                   	ret
+
+0000000000801129 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  801129:	55                   	push   %rbp
+  80112a:	48 89 e5             	mov    %rsp,%rbp
+  80112d:	41 57                	push   %r15
+  80112f:	41 56                	push   %r14
+  801131:	41 55                	push   %r13
+  801133:	41 54                	push   %r12
+  801135:	53                   	push   %rbx
+  801136:	48 83 ec 08          	sub    $0x8,%rsp
+  80113a:	49 89 fe             	mov    %rdi,%r14
+  80113d:	49 89 f7             	mov    %rsi,%r15
+  801140:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  801143:	48 89 f7             	mov    %rsi,%rdi
+  801146:	48 b8 78 0e 80 00 00 	movabs $0x800e78,%rax
+  80114d:	00 00 00 
+  801150:	ff d0                	call   *%rax
+  801152:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  801155:	48 89 de             	mov    %rbx,%rsi
+  801158:	4c 89 f7             	mov    %r14,%rdi
+  80115b:	48 b8 93 0e 80 00 00 	movabs $0x800e93,%rax
+  801162:	00 00 00 
+  801165:	ff d0                	call   *%rax
+  801167:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  80116a:	48 39 c3             	cmp    %rax,%rbx
+  80116d:	74 36                	je     8011a5 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  80116f:	48 89 d8             	mov    %rbx,%rax
+  801172:	4c 29 e8             	sub    %r13,%rax
+  801175:	49 39 c4             	cmp    %rax,%r12
+  801178:	73 31                	jae    8011ab <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  80117a:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  80117f:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  801183:	4c 89 fe             	mov    %r15,%rsi
+  801186:	48 b8 17 11 80 00 00 	movabs $0x801117,%rax
+  80118d:	00 00 00 
+  801190:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  801192:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  801196:	48 83 c4 08          	add    $0x8,%rsp
+  80119a:	5b                   	pop    %rbx
+  80119b:	41 5c                	pop    %r12
+  80119d:	41 5d                	pop    %r13
+  80119f:	41 5e                	pop    %r14
+  8011a1:	41 5f                	pop    %r15
+  8011a3:	5d                   	pop    %rbp
+  8011a4:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  8011a5:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  8011a9:	eb eb                	jmp    801196 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  8011ab:	48 83 eb 01          	sub    $0x1,%rbx
+  8011af:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8011b3:	48 89 da             	mov    %rbx,%rdx
+  8011b6:	4c 89 fe             	mov    %r15,%rsi
+  8011b9:	48 b8 17 11 80 00 00 	movabs $0x801117,%rax
+  8011c0:	00 00 00 
+  8011c3:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  8011c5:	49 01 de             	add    %rbx,%r14
+  8011c8:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  8011cd:	eb c3                	jmp    801192 <strlcat+0x69>
+
+00000000008011cf <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  8011cf:	48 85 d2             	test   %rdx,%rdx
+  8011d2:	74 2d                	je     801201 <memcmp+0x32>
+  8011d4:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  8011d9:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  8011dd:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  8011e2:	44 38 c1             	cmp    %r8b,%cl
+  8011e5:	75 0f                	jne    8011f6 <memcmp+0x27>
+    while (n-- > 0) {
+  8011e7:	48 83 c0 01          	add    $0x1,%rax
+  8011eb:	48 39 c2             	cmp    %rax,%rdx
+  8011ee:	75 e9                	jne    8011d9 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  8011f0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011f5:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  8011f6:	0f b6 c1             	movzbl %cl,%eax
+  8011f9:	45 0f b6 c0          	movzbl %r8b,%r8d
+  8011fd:	44 29 c0             	sub    %r8d,%eax
+  801200:	c3                   	ret
+    return 0;
+  801201:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801206:	c3                   	ret
+
+0000000000801207 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  801207:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  80120b:	48 39 c7             	cmp    %rax,%rdi
+  80120e:	73 0f                	jae    80121f <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  801210:	40 38 37             	cmp    %sil,(%rdi)
+  801213:	74 0e                	je     801223 <memfind+0x1c>
+    for (; src < end; src++) {
+  801215:	48 83 c7 01          	add    $0x1,%rdi
+  801219:	48 39 f8             	cmp    %rdi,%rax
+  80121c:	75 f2                	jne    801210 <memfind+0x9>
+  80121e:	c3                   	ret
+  80121f:	48 89 f8             	mov    %rdi,%rax
+  801222:	c3                   	ret
+  801223:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  801226:	c3                   	ret
+
+0000000000801227 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  801227:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  80122a:	0f b6 37             	movzbl (%rdi),%esi
+  80122d:	40 80 fe 20          	cmp    $0x20,%sil
+  801231:	74 06                	je     801239 <strtol+0x12>
+  801233:	40 80 fe 09          	cmp    $0x9,%sil
+  801237:	75 13                	jne    80124c <strtol+0x25>
+  801239:	48 83 c7 01          	add    $0x1,%rdi
+  80123d:	0f b6 37             	movzbl (%rdi),%esi
+  801240:	40 80 fe 20          	cmp    $0x20,%sil
+  801244:	74 f3                	je     801239 <strtol+0x12>
+  801246:	40 80 fe 09          	cmp    $0x9,%sil
+  80124a:	74 ed                	je     801239 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  80124c:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  80124f:	83 e0 fd             	and    $0xfffffffd,%eax
+  801252:	3c 01                	cmp    $0x1,%al
+  801254:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801258:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  80125e:	75 0f                	jne    80126f <strtol+0x48>
+  801260:	80 3f 30             	cmpb   $0x30,(%rdi)
+  801263:	74 14                	je     801279 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  801265:	85 d2                	test   %edx,%edx
+  801267:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80126c:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  80126f:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  801274:	4c 63 ca             	movslq %edx,%r9
+  801277:	eb 36                	jmp    8012af <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801279:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  80127d:	74 0f                	je     80128e <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  80127f:	85 d2                	test   %edx,%edx
+  801281:	75 ec                	jne    80126f <strtol+0x48>
+        s++;
+  801283:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  801287:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  80128c:	eb e1                	jmp    80126f <strtol+0x48>
+        s += 2;
+  80128e:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  801292:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  801297:	eb d6                	jmp    80126f <strtol+0x48>
+            dig -= '0';
+  801299:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  80129c:	44 0f b6 c1          	movzbl %cl,%r8d
+  8012a0:	41 39 d0             	cmp    %edx,%r8d
+  8012a3:	7d 21                	jge    8012c6 <strtol+0x9f>
+        val = val * base + dig;
+  8012a5:	49 0f af c1          	imul   %r9,%rax
+  8012a9:	0f b6 c9             	movzbl %cl,%ecx
+  8012ac:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  8012af:	48 83 c7 01          	add    $0x1,%rdi
+  8012b3:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  8012b7:	80 f9 39             	cmp    $0x39,%cl
+  8012ba:	76 dd                	jbe    801299 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  8012bc:	80 f9 7b             	cmp    $0x7b,%cl
+  8012bf:	77 05                	ja     8012c6 <strtol+0x9f>
+            dig -= 'a' - 10;
+  8012c1:	83 e9 57             	sub    $0x57,%ecx
+  8012c4:	eb d6                	jmp    80129c <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  8012c6:	4d 85 d2             	test   %r10,%r10
+  8012c9:	74 03                	je     8012ce <strtol+0xa7>
+  8012cb:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  8012ce:	48 89 c2             	mov    %rax,%rdx
+  8012d1:	48 f7 da             	neg    %rdx
+  8012d4:	40 80 fe 2d          	cmp    $0x2d,%sil
+  8012d8:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  8012dc:	c3                   	ret
+
+00000000008012dd <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  8012dd:	55                   	push   %rbp
+  8012de:	48 89 e5             	mov    %rsp,%rbp
+  8012e1:	53                   	push   %rbx
+  8012e2:	48 89 fa             	mov    %rdi,%rdx
+  8012e5:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8012e8:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8012ed:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012f2:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012f7:	be 00 00 00 00       	mov    $0x0,%esi
+  8012fc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801302:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  801304:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801308:	c9                   	leave
+  801309:	c3                   	ret
+
+000000000080130a <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  80130a:	55                   	push   %rbp
+  80130b:	48 89 e5             	mov    %rsp,%rbp
+  80130e:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80130f:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801314:	ba 00 00 00 00       	mov    $0x0,%edx
+  801319:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80131e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801323:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801328:	be 00 00 00 00       	mov    $0x0,%esi
+  80132d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801333:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  801335:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801339:	c9                   	leave
+  80133a:	c3                   	ret
+
+000000000080133b <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  80133b:	55                   	push   %rbp
+  80133c:	48 89 e5             	mov    %rsp,%rbp
+  80133f:	53                   	push   %rbx
+  801340:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  801344:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801347:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80134c:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801351:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801356:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80135b:	be 00 00 00 00       	mov    $0x0,%esi
+  801360:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801366:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801368:	48 85 c0             	test   %rax,%rax
+  80136b:	7f 06                	jg     801373 <sys_env_destroy+0x38>
+}
+  80136d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801371:	c9                   	leave
+  801372:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801373:	49 89 c0             	mov    %rax,%r8
+  801376:	b9 03 00 00 00       	mov    $0x3,%ecx
+  80137b:	48 ba b0 37 80 00 00 	movabs $0x8037b0,%rdx
+  801382:	00 00 00 
+  801385:	be 26 00 00 00       	mov    $0x26,%esi
+  80138a:	48 bf cf 37 80 00 00 	movabs $0x8037cf,%rdi
+  801391:	00 00 00 
+  801394:	b8 00 00 00 00       	mov    $0x0,%eax
+  801399:	49 b9 41 04 80 00 00 	movabs $0x800441,%r9
+  8013a0:	00 00 00 
+  8013a3:	41 ff d1             	call   *%r9
+
+00000000008013a6 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  8013a6:	55                   	push   %rbp
+  8013a7:	48 89 e5             	mov    %rsp,%rbp
+  8013aa:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8013ab:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8013b0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8013b5:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8013ba:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013bf:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013c4:	be 00 00 00 00       	mov    $0x0,%esi
+  8013c9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013cf:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  8013d1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013d5:	c9                   	leave
+  8013d6:	c3                   	ret
+
+00000000008013d7 <sys_yield>:
+
+void
+sys_yield(void) {
+  8013d7:	55                   	push   %rbp
+  8013d8:	48 89 e5             	mov    %rsp,%rbp
+  8013db:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8013dc:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8013e1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8013e6:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8013eb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013f0:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013f5:	be 00 00 00 00       	mov    $0x0,%esi
+  8013fa:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801400:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  801402:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801406:	c9                   	leave
+  801407:	c3                   	ret
+
+0000000000801408 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  801408:	55                   	push   %rbp
+  801409:	48 89 e5             	mov    %rsp,%rbp
+  80140c:	53                   	push   %rbx
+  80140d:	48 89 fa             	mov    %rdi,%rdx
+  801410:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801413:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801418:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  80141f:	00 00 00 
+  801422:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801427:	be 00 00 00 00       	mov    $0x0,%esi
+  80142c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801432:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  801434:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801438:	c9                   	leave
+  801439:	c3                   	ret
+
+000000000080143a <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  80143a:	55                   	push   %rbp
+  80143b:	48 89 e5             	mov    %rsp,%rbp
+  80143e:	53                   	push   %rbx
+  80143f:	49 89 f8             	mov    %rdi,%r8
+  801442:	48 89 d3             	mov    %rdx,%rbx
+  801445:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801448:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80144d:	4c 89 c2             	mov    %r8,%rdx
+  801450:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801453:	be 00 00 00 00       	mov    $0x0,%esi
+  801458:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80145e:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  801460:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801464:	c9                   	leave
+  801465:	c3                   	ret
+
+0000000000801466 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  801466:	55                   	push   %rbp
+  801467:	48 89 e5             	mov    %rsp,%rbp
+  80146a:	53                   	push   %rbx
+  80146b:	48 83 ec 08          	sub    $0x8,%rsp
+  80146f:	89 f8                	mov    %edi,%eax
+  801471:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  801474:	48 63 f9             	movslq %ecx,%rdi
+  801477:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80147a:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80147f:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801482:	be 00 00 00 00       	mov    $0x0,%esi
+  801487:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80148d:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80148f:	48 85 c0             	test   %rax,%rax
+  801492:	7f 06                	jg     80149a <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  801494:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801498:	c9                   	leave
+  801499:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80149a:	49 89 c0             	mov    %rax,%r8
+  80149d:	b9 04 00 00 00       	mov    $0x4,%ecx
+  8014a2:	48 ba b0 37 80 00 00 	movabs $0x8037b0,%rdx
+  8014a9:	00 00 00 
+  8014ac:	be 26 00 00 00       	mov    $0x26,%esi
+  8014b1:	48 bf cf 37 80 00 00 	movabs $0x8037cf,%rdi
+  8014b8:	00 00 00 
+  8014bb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014c0:	49 b9 41 04 80 00 00 	movabs $0x800441,%r9
+  8014c7:	00 00 00 
+  8014ca:	41 ff d1             	call   *%r9
+
+00000000008014cd <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8014cd:	55                   	push   %rbp
+  8014ce:	48 89 e5             	mov    %rsp,%rbp
+  8014d1:	53                   	push   %rbx
+  8014d2:	48 83 ec 08          	sub    $0x8,%rsp
+  8014d6:	89 f8                	mov    %edi,%eax
+  8014d8:	49 89 f2             	mov    %rsi,%r10
+  8014db:	48 89 cf             	mov    %rcx,%rdi
+  8014de:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  8014e1:	48 63 da             	movslq %edx,%rbx
+  8014e4:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8014e7:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8014ec:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014ef:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  8014f2:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8014f4:	48 85 c0             	test   %rax,%rax
+  8014f7:	7f 06                	jg     8014ff <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8014f9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014fd:	c9                   	leave
+  8014fe:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8014ff:	49 89 c0             	mov    %rax,%r8
+  801502:	b9 05 00 00 00       	mov    $0x5,%ecx
+  801507:	48 ba b0 37 80 00 00 	movabs $0x8037b0,%rdx
+  80150e:	00 00 00 
+  801511:	be 26 00 00 00       	mov    $0x26,%esi
+  801516:	48 bf cf 37 80 00 00 	movabs $0x8037cf,%rdi
+  80151d:	00 00 00 
+  801520:	b8 00 00 00 00       	mov    $0x0,%eax
+  801525:	49 b9 41 04 80 00 00 	movabs $0x800441,%r9
+  80152c:	00 00 00 
+  80152f:	41 ff d1             	call   *%r9
+
+0000000000801532 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  801532:	55                   	push   %rbp
+  801533:	48 89 e5             	mov    %rsp,%rbp
+  801536:	53                   	push   %rbx
+  801537:	48 83 ec 08          	sub    $0x8,%rsp
+  80153b:	48 89 f1             	mov    %rsi,%rcx
+  80153e:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  801541:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801544:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801549:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80154e:	be 00 00 00 00       	mov    $0x0,%esi
+  801553:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801559:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80155b:	48 85 c0             	test   %rax,%rax
+  80155e:	7f 06                	jg     801566 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  801560:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801564:	c9                   	leave
+  801565:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801566:	49 89 c0             	mov    %rax,%r8
+  801569:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80156e:	48 ba b0 37 80 00 00 	movabs $0x8037b0,%rdx
+  801575:	00 00 00 
+  801578:	be 26 00 00 00       	mov    $0x26,%esi
+  80157d:	48 bf cf 37 80 00 00 	movabs $0x8037cf,%rdi
+  801584:	00 00 00 
+  801587:	b8 00 00 00 00       	mov    $0x0,%eax
+  80158c:	49 b9 41 04 80 00 00 	movabs $0x800441,%r9
+  801593:	00 00 00 
+  801596:	41 ff d1             	call   *%r9
+
+0000000000801599 <sys_region_batch>:
+
+int
+sys_region_batch(const struct RegionOp *ops, size_t count) {
+  801599:	55                   	push   %rbp
+  80159a:	48 89 e5             	mov    %rsp,%rbp
+  80159d:	53                   	push   %rbx
+  80159e:	48 83 ec 08          	sub    $0x8,%rsp
+  8015a2:	48 89 fa             	mov    %rdi,%rdx
+  8015a5:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8015a8:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8015ad:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015b2:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015b7:	be 00 00 00 00       	mov    $0x0,%esi
+  8015bc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015c2:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8015c4:	48 85 c0             	test   %rax,%rax
+  8015c7:	7f 06                	jg     8015cf <sys_region_batch+0x36>
+        else
+            platform_asan_unpoison(va, ops[i].size);
+    }
+#endif
+    return res;
+}
+  8015c9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015cd:	c9                   	leave
+  8015ce:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8015cf:	49 89 c0             	mov    %rax,%r8
+  8015d2:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  8015d7:	48 ba b0 37 80 00 00 	movabs $0x8037b0,%rdx
+  8015de:	00 00 00 
+  8015e1:	be 26 00 00 00       	mov    $0x26,%esi
+  8015e6:	48 bf cf 37 80 00 00 	movabs $0x8037cf,%rdi
+  8015ed:	00 00 00 
+  8015f0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015f5:	49 b9 41 04 80 00 00 	movabs $0x800441,%r9
+  8015fc:	00 00 00 
+  8015ff:	41 ff d1             	call   *%r9
+
+0000000000801602 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  801602:	55                   	push   %rbp
+  801603:	48 89 e5             	mov    %rsp,%rbp
+  801606:	53                   	push   %rbx
+  801607:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  80160b:	48 63 ce             	movslq %esi,%rcx
+  80160e:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801611:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801616:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80161b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801620:	be 00 00 00 00       	mov    $0x0,%esi
+  801625:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80162b:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80162d:	48 85 c0             	test   %rax,%rax
+  801630:	7f 06                	jg     801638 <sys_env_set_status+0x36>
+}
+  801632:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801636:	c9                   	leave
+  801637:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801638:	49 89 c0             	mov    %rax,%r8
+  80163b:	b9 09 00 00 00       	mov    $0x9,%ecx
+  801640:	48 ba b0 37 80 00 00 	movabs $0x8037b0,%rdx
+  801647:	00 00 00 
+  80164a:	be 26 00 00 00       	mov    $0x26,%esi
+  80164f:	48 bf cf 37 80 00 00 	movabs $0x8037cf,%rdi
+  801656:	00 00 00 
+  801659:	b8 00 00 00 00       	mov    $0x0,%eax
+  80165e:	49 b9 41 04 80 00 00 	movabs $0x800441,%r9
+  801665:	00 00 00 
+  801668:	41 ff d1             	call   *%r9
+
+000000000080166b <sys_env_set_weight>:
+
+int
+sys_env_set_weight(envid_t envid, uint32_t weight) {
+  80166b:	55                   	push   %rbp
+  80166c:	48 89 e5             	mov    %rsp,%rbp
+  80166f:	53                   	push   %rbx
+  801670:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_weight, 1, envid, weight, 0, 0, 0, 0);
+  801674:	89 f1                	mov    %esi,%ecx
+  801676:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801679:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80167e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801683:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801688:	be 00 00 00 00       	mov    $0x0,%esi
+  80168d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801693:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801695:	48 85 c0             	test   %rax,%rax
+  801698:	7f 06                	jg     8016a0 <sys_env_set_weight+0x35>
+}
+  80169a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80169e:	c9                   	leave
+  80169f:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8016a0:	49 89 c0             	mov    %rax,%r8
+  8016a3:	b9 10 00 00 00       	mov    $0x10,%ecx
+  8016a8:	48 ba b0 37 80 00 00 	movabs $0x8037b0,%rdx
+  8016af:	00 00 00 
+  8016b2:	be 26 00 00 00       	mov    $0x26,%esi
+  8016b7:	48 bf cf 37 80 00 00 	movabs $0x8037cf,%rdi
+  8016be:	00 00 00 
+  8016c1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016c6:	49 b9 41 04 80 00 00 	movabs $0x800441,%r9
+  8016cd:	00 00 00 
+  8016d0:	41 ff d1             	call   *%r9
+
+00000000008016d3 <sys_env_set_rt>:
+
+int
+sys_env_set_rt(envid_t envid, uint64_t period, uint64_t budget, uint64_t deadline) {
+  8016d3:	55                   	push   %rbp
+  8016d4:	48 89 e5             	mov    %rsp,%rbp
+  8016d7:	53                   	push   %rbx
+  8016d8:	48 83 ec 08          	sub    $0x8,%rsp
+  8016dc:	89 f8                	mov    %edi,%eax
+  8016de:	48 89 d3             	mov    %rdx,%rbx
+  8016e1:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_env_set_rt, 1, envid, period, budget, deadline, 0, 0);
+  8016e4:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8016e7:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8016ec:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8016ef:	be 00 00 00 00       	mov    $0x0,%esi
+  8016f4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8016fa:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8016fc:	48 85 c0             	test   %rax,%rax
+  8016ff:	7f 06                	jg     801707 <sys_env_set_rt+0x34>
+}
+  801701:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801705:	c9                   	leave
+  801706:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801707:	49 89 c0             	mov    %rax,%r8
+  80170a:	b9 11 00 00 00       	mov    $0x11,%ecx
+  80170f:	48 ba b0 37 80 00 00 	movabs $0x8037b0,%rdx
+  801716:	00 00 00 
+  801719:	be 26 00 00 00       	mov    $0x26,%esi
+  80171e:	48 bf cf 37 80 00 00 	movabs $0x8037cf,%rdi
+  801725:	00 00 00 
+  801728:	b8 00 00 00 00       	mov    $0x0,%eax
+  80172d:	49 b9 41 04 80 00 00 	movabs $0x800441,%r9
+  801734:	00 00 00 
+  801737:	41 ff d1             	call   *%r9
+
+000000000080173a <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  80173a:	55                   	push   %rbp
+  80173b:	48 89 e5             	mov    %rsp,%rbp
+  80173e:	53                   	push   %rbx
+  80173f:	48 83 ec 08          	sub    $0x8,%rsp
+  801743:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  801746:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801749:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80174e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801753:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801758:	be 00 00 00 00       	mov    $0x0,%esi
+  80175d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801763:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801765:	48 85 c0             	test   %rax,%rax
+  801768:	7f 06                	jg     801770 <sys_env_set_trapframe+0x36>
+}
+  80176a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80176e:	c9                   	leave
+  80176f:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801770:	49 89 c0             	mov    %rax,%r8
+  801773:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  801778:	48 ba b0 37 80 00 00 	movabs $0x8037b0,%rdx
+  80177f:	00 00 00 
+  801782:	be 26 00 00 00       	mov    $0x26,%esi
+  801787:	48 bf cf 37 80 00 00 	movabs $0x8037cf,%rdi
+  80178e:	00 00 00 
+  801791:	b8 00 00 00 00       	mov    $0x0,%eax
+  801796:	49 b9 41 04 80 00 00 	movabs $0x800441,%r9
+  80179d:	00 00 00 
+  8017a0:	41 ff d1             	call   *%r9
+
+00000000008017a3 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  8017a3:	55                   	push   %rbp
+  8017a4:	48 89 e5             	mov    %rsp,%rbp
+  8017a7:	53                   	push   %rbx
+  8017a8:	48 83 ec 08          	sub    $0x8,%rsp
+  8017ac:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  8017af:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8017b2:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8017b7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017bc:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8017c1:	be 00 00 00 00       	mov    $0x0,%esi
+  8017c6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8017cc:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8017ce:	48 85 c0             	test   %rax,%rax
+  8017d1:	7f 06                	jg     8017d9 <sys_env_set_pgfault_upcall+0x36>
+}
+  8017d3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8017d7:	c9                   	leave
+  8017d8:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8017d9:	49 89 c0             	mov    %rax,%r8
+  8017dc:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  8017e1:	48 ba b0 37 80 00 00 	movabs $0x8037b0,%rdx
+  8017e8:	00 00 00 
+  8017eb:	be 26 00 00 00       	mov    $0x26,%esi
+  8017f0:	48 bf cf 37 80 00 00 	movabs $0x8037cf,%rdi
+  8017f7:	00 00 00 
+  8017fa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017ff:	49 b9 41 04 80 00 00 	movabs $0x800441,%r9
+  801806:	00 00 00 
+  801809:	41 ff d1             	call   *%r9
+
+000000000080180c <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  80180c:	55                   	push   %rbp
+  80180d:	48 89 e5             	mov    %rsp,%rbp
+  801810:	53                   	push   %rbx
+  801811:	89 f8                	mov    %edi,%eax
+  801813:	49 89 f1             	mov    %rsi,%r9
+  801816:	48 89 d3             	mov    %rdx,%rbx
+  801819:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  80181c:	49 63 f0             	movslq %r8d,%rsi
+  80181f:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801822:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801827:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80182a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801830:	cd 30                	int    $0x30
+}
+  801832:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801836:	c9                   	leave
+  801837:	c3                   	ret
+
+0000000000801838 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  801838:	55                   	push   %rbp
+  801839:	48 89 e5             	mov    %rsp,%rbp
+  80183c:	53                   	push   %rbx
+  80183d:	48 83 ec 08          	sub    $0x8,%rsp
+  801841:	48 89 fa             	mov    %rdi,%rdx
+  801844:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801847:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80184c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801851:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801856:	be 00 00 00 00       	mov    $0x0,%esi
+  80185b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801861:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801863:	48 85 c0             	test   %rax,%rax
+  801866:	7f 06                	jg     80186e <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801868:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80186c:	c9                   	leave
+  80186d:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80186e:	49 89 c0             	mov    %rax,%r8
+  801871:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  801876:	48 ba b0 37 80 00 00 	movabs $0x8037b0,%rdx
+  80187d:	00 00 00 
+  801880:	be 26 00 00 00       	mov    $0x26,%esi
+  801885:	48 bf cf 37 80 00 00 	movabs $0x8037cf,%rdi
+  80188c:	00 00 00 
+  80188f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801894:	49 b9 41 04 80 00 00 	movabs $0x800441,%r9
+  80189b:	00 00 00 
+  80189e:	41 ff d1             	call   *%r9
+
+00000000008018a1 <fork>:
+ * Hint:
+ *   Use sys_map_region, it can perform address space copying in one call
+ *   Remember to fix "thisenv" in the child process.
+ */
+envid_t
+fork(void) {
+  8018a1:	55                   	push   %rbp
+  8018a2:	48 89 e5             	mov    %rsp,%rbp
+  8018a5:	41 55                	push   %r13
+  8018a7:	41 54                	push   %r12
+  8018a9:	53                   	push   %rbx
+  8018aa:	48 83 ec 08          	sub    $0x8,%rsp
+
+/* This must be inlined. Exercise for reader: why? */
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+    envid_t ret;
+    asm volatile("int %2"
+  8018ae:	b8 08 00 00 00       	mov    $0x8,%eax
+  8018b3:	cd 30                	int    $0x30
+  8018b5:	41 89 c5             	mov    %eax,%r13d
+    // LAB 9: Your code here
+
+    envid_t child_id = sys_exofork();
+    if (child_id < 0) {
+  8018b8:	85 c0                	test   %eax,%eax
+  8018ba:	0f 88 ae 00 00 00    	js     80196e <fork+0xcd>
+  8018c0:	89 c3                	mov    %eax,%ebx
+        return child_id;
+    }
+    if (child_id == 0) {
+  8018c2:	0f 84 b4 00 00 00    	je     80197c <fork+0xdb>
+        thisenv = &envs[ENVX(sys_getenvid())];
+        return 0;
+    }
+    int res = sys_map_region(0, NULL, child_id, NULL, MAX_USER_ADDRESS, PROT_ALL | PROT_LAZY | PROT_COMBINE);
+  8018c8:	41 b9 df 01 00 00    	mov    $0x1df,%r9d
+  8018ce:	49 b8 00 00 00 00 80 	movabs $0x8000000000,%r8
+  8018d5:	00 00 00 
+  8018d8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8018dd:	89 c2                	mov    %eax,%edx
+  8018df:	be 00 00 00 00       	mov    $0x0,%esi
+  8018e4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8018e9:	48 b8 cd 14 80 00 00 	movabs $0x8014cd,%rax
+  8018f0:	00 00 00 
+  8018f3:	ff d0                	call   *%rax
+  8018f5:	41 89 c4             	mov    %eax,%r12d
+    if (res < 0) {
+  8018f8:	85 c0                	test   %eax,%eax
+  8018fa:	78 5d                	js     801959 <fork+0xb8>
+        goto error;
+    }
+    res = sys_env_set_pgfault_upcall(child_id, envs[ENVX(sys_getenvid())].env_pgfault_upcall);
+  8018fc:	48 b8 a6 13 80 00 00 	movabs $0x8013a6,%rax
+  801903:	00 00 00 
+  801906:	ff d0                	call   *%rax
+  801908:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80190d:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+  801914:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  80191b:	00 00 00 
+  80191e:	48 01 d0             	add    %rdx,%rax
+  801921:	48 8b b0 88 01 00 00 	mov    0x188(%rax),%rsi
+  801928:	44 89 ef             	mov    %r13d,%edi
+  80192b:	48 b8 a3 17 80 00 00 	movabs $0x8017a3,%rax
+  801932:	00 00 00 
+  801935:	ff d0                	call   *%rax
+  801937:	41 89 c4             	mov    %eax,%r12d
+    if (res < 0) {
+  80193a:	85 c0                	test   %eax,%eax
+  80193c:	78 1b                	js     801959 <fork+0xb8>
+        goto error;
+    }
+    res = sys_env_set_status(child_id, ENV_RUNNABLE);
+  80193e:	be 02 00 00 00       	mov    $0x2,%esi
+  801943:	44 89 ef             	mov    %r13d,%edi
+  801946:	48 b8 02 16 80 00 00 	movabs $0x801602,%rax
+  80194d:	00 00 00 
+  801950:	ff d0                	call   *%rax
+  801952:	41 89 c4             	mov    %eax,%r12d
+    if (res < 0) {
+  801955:	85 c0                	test   %eax,%eax
+  801957:	79 15                	jns    80196e <fork+0xcd>
+        goto error;
+    }
+    return child_id;
+error:
+    ;
+    int res2 = sys_env_destroy(child_id);
+  801959:	89 df                	mov    %ebx,%edi
+  80195b:	48 b8 3b 13 80 00 00 	movabs $0x80133b,%rax
+  801962:	00 00 00 
+  801965:	ff d0                	call   *%rax
+    if (res2 < 0) {
+  801967:	85 c0                	test   %eax,%eax
+  801969:	78 42                	js     8019ad <fork+0x10c>
+        panic("Fork double fault");
+    }
+    return res;
+  80196b:	45 89 e5             	mov    %r12d,%r13d
+}
+  80196e:	44 89 e8             	mov    %r13d,%eax
+  801971:	48 83 c4 08          	add    $0x8,%rsp
+  801975:	5b                   	pop    %rbx
+  801976:	41 5c                	pop    %r12
+  801978:	41 5d                	pop    %r13
+  80197a:	5d                   	pop    %rbp
+  80197b:	c3                   	ret
+        thisenv = &envs[ENVX(sys_getenvid())];
+  80197c:	48 b8 a6 13 80 00 00 	movabs $0x8013a6,%rax
+  801983:	00 00 00 
+  801986:	ff d0                	call   *%rax
+  801988:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80198d:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+  801994:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  80199b:	00 00 00 
+  80199e:	48 01 d0             	add    %rdx,%rax
+  8019a1:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  8019a8:	00 00 00 
+        return 0;
+  8019ab:	eb c1                	jmp    80196e <fork+0xcd>
+        panic("Fork double fault");
+  8019ad:	48 ba dd 37 80 00 00 	movabs $0x8037dd,%rdx
+  8019b4:	00 00 00 
+  8019b7:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8019bc:	48 bf ef 37 80 00 00 	movabs $0x8037ef,%rdi
+  8019c3:	00 00 00 
+  8019c6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019cb:	48 b9 41 04 80 00 00 	movabs $0x800441,%rcx
+  8019d2:	00 00 00 
+  8019d5:	ff d1                	call   *%rcx
+
+00000000008019d7 <sfork>:
+
+envid_t
+sfork() {
+  8019d7:	55                   	push   %rbp
+  8019d8:	48 89 e5             	mov    %rsp,%rbp
+    panic("sfork() is not implemented");
+  8019db:	48 ba fa 37 80 00 00 	movabs $0x8037fa,%rdx
+  8019e2:	00 00 00 
+  8019e5:	be 36 00 00 00       	mov    $0x36,%esi
+  8019ea:	48 bf ef 37 80 00 00 	movabs $0x8037ef,%rdi
+  8019f1:	00 00 00 
+  8019f4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019f9:	48 b9 41 04 80 00 00 	movabs $0x800441,%rcx
+  801a00:	00 00 00 
+  801a03:	ff d1                	call   *%rcx
+
+0000000000801a05 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801a05:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801a0c:	ff ff ff 
+  801a0f:	48 01 f8             	add    %rdi,%rax
+  801a12:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  801a16:	c3                   	ret
+
+0000000000801a17 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801a17:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801a1e:	ff ff ff 
+  801a21:	48 01 f8             	add    %rdi,%rax
+  801a24:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  801a28:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  801a2e:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  801a32:	c3                   	ret
+
+0000000000801a33 <fd_alloc_from>:
+}
+
+/* Like fd_alloc(), but only considers fds starting from fdnum,
+ * so that several fds can be found before their pages are allocated */
+int
+fd_alloc_from(int fdnum, struct Fd **fd_store) {
+  801a33:	55                   	push   %rbp
+  801a34:	48 89 e5             	mov    %rsp,%rbp
+  801a37:	41 57                	push   %r15
+  801a39:	41 56                	push   %r14
+  801a3b:	41 55                	push   %r13
+  801a3d:	41 54                	push   %r12
+  801a3f:	53                   	push   %rbx
+  801a40:	48 83 ec 08          	sub    $0x8,%rsp
+  801a44:	49 89 f7             	mov    %rsi,%r15
+    for (int i = MAX(fdnum, 0); i < MAXFD; i++) {
+  801a47:	85 ff                	test   %edi,%edi
+  801a49:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  801a4f:	44 0f 49 e7          	cmovns %edi,%r12d
+  801a53:	83 ff 1f             	cmp    $0x1f,%edi
+  801a56:	7f 37                	jg     801a8f <fd_alloc_from+0x5c>
+  801a58:	49 63 dc             	movslq %r12d,%rbx
+  801a5b:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  801a62:	48 c1 e3 0c          	shl    $0xc,%rbx
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  801a66:	49 be 3c 2b 80 00 00 	movabs $0x802b3c,%r14
+  801a6d:	00 00 00 
+        struct Fd *fd = INDEX2FD(i);
+  801a70:	49 89 dd             	mov    %rbx,%r13
+        if (!(get_prot(fd) & PROT_R)) {
+  801a73:	48 89 df             	mov    %rbx,%rdi
+  801a76:	41 ff d6             	call   *%r14
+  801a79:	83 e0 04             	and    $0x4,%eax
+  801a7c:	74 1c                	je     801a9a <fd_alloc_from+0x67>
+    for (int i = MAX(fdnum, 0); i < MAXFD; i++) {
+  801a7e:	41 83 c4 01          	add    $0x1,%r12d
+  801a82:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801a89:	41 83 fc 1f          	cmp    $0x1f,%r12d
+  801a8d:	7e e1                	jle    801a70 <fd_alloc_from+0x3d>
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  801a8f:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801a95:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  801a9a:	4d 89 2f             	mov    %r13,(%r15)
+}
+  801a9d:	48 83 c4 08          	add    $0x8,%rsp
+  801aa1:	5b                   	pop    %rbx
+  801aa2:	41 5c                	pop    %r12
+  801aa4:	41 5d                	pop    %r13
+  801aa6:	41 5e                	pop    %r14
+  801aa8:	41 5f                	pop    %r15
+  801aaa:	5d                   	pop    %rbp
+  801aab:	c3                   	ret
+
+0000000000801aac <fd_alloc>:
+fd_alloc(struct Fd **fd_store) {
+  801aac:	55                   	push   %rbp
+  801aad:	48 89 e5             	mov    %rsp,%rbp
+  801ab0:	48 89 fe             	mov    %rdi,%rsi
+    return fd_alloc_from(0, fd_store);
+  801ab3:	bf 00 00 00 00       	mov    $0x0,%edi
+  801ab8:	48 b8 33 1a 80 00 00 	movabs $0x801a33,%rax
+  801abf:	00 00 00 
+  801ac2:	ff d0                	call   *%rax
+}
+  801ac4:	5d                   	pop    %rbp
+  801ac5:	c3                   	ret
+
+0000000000801ac6 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  801ac6:	83 ff 1f             	cmp    $0x1f,%edi
+  801ac9:	77 39                	ja     801b04 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  801acb:	55                   	push   %rbp
+  801acc:	48 89 e5             	mov    %rsp,%rbp
+  801acf:	41 54                	push   %r12
+  801ad1:	53                   	push   %rbx
+  801ad2:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  801ad5:	48 63 df             	movslq %edi,%rbx
+  801ad8:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  801adf:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  801ae3:	48 89 df             	mov    %rbx,%rdi
+  801ae6:	48 b8 3c 2b 80 00 00 	movabs $0x802b3c,%rax
+  801aed:	00 00 00 
+  801af0:	ff d0                	call   *%rax
+  801af2:	a8 04                	test   $0x4,%al
+  801af4:	74 14                	je     801b0a <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  801af6:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  801afa:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801aff:	5b                   	pop    %rbx
+  801b00:	41 5c                	pop    %r12
+  801b02:	5d                   	pop    %rbp
+  801b03:	c3                   	ret
+        return -E_INVAL;
+  801b04:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801b09:	c3                   	ret
+        return -E_INVAL;
+  801b0a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801b0f:	eb ee                	jmp    801aff <fd_lookup+0x39>
+
+0000000000801b11 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  801b11:	55                   	push   %rbp
+  801b12:	48 89 e5             	mov    %rsp,%rbp
+  801b15:	41 54                	push   %r12
+  801b17:	53                   	push   %rbx
+  801b18:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  801b1b:	48 b8 a0 38 80 00 00 	movabs $0x8038a0,%rax
+  801b22:	00 00 00 
+  801b25:	48 bb 20 40 80 00 00 	movabs $0x804020,%rbx
+  801b2c:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  801b2f:	39 3b                	cmp    %edi,(%rbx)
+  801b31:	74 47                	je     801b7a <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  801b33:	48 83 c0 08          	add    $0x8,%rax
+  801b37:	48 8b 18             	mov    (%rax),%rbx
+  801b3a:	48 85 db             	test   %rbx,%rbx
+  801b3d:	75 f0                	jne    801b2f <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801b3f:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801b46:	00 00 00 
+  801b49:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+  801b4f:	89 fa                	mov    %edi,%edx
+  801b51:	48 bf 18 38 80 00 00 	movabs $0x803818,%rdi
+  801b58:	00 00 00 
+  801b5b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b60:	48 b9 91 05 80 00 00 	movabs $0x800591,%rcx
+  801b67:	00 00 00 
+  801b6a:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  801b6c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  801b71:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  801b75:	5b                   	pop    %rbx
+  801b76:	41 5c                	pop    %r12
+  801b78:	5d                   	pop    %rbp
+  801b79:	c3                   	ret
+            return 0;
+  801b7a:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b7f:	eb f0                	jmp    801b71 <dev_lookup+0x60>
+
+0000000000801b81 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  801b81:	55                   	push   %rbp
+  801b82:	48 89 e5             	mov    %rsp,%rbp
+  801b85:	41 55                	push   %r13
+  801b87:	41 54                	push   %r12
+  801b89:	53                   	push   %rbx
+  801b8a:	48 83 ec 18          	sub    $0x18,%rsp
+  801b8e:	48 89 fb             	mov    %rdi,%rbx
+  801b91:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801b94:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  801b9b:	ff ff ff 
+  801b9e:	48 01 df             	add    %rbx,%rdi
+  801ba1:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  801ba5:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801ba9:	48 b8 c6 1a 80 00 00 	movabs $0x801ac6,%rax
+  801bb0:	00 00 00 
+  801bb3:	ff d0                	call   *%rax
+  801bb5:	41 89 c5             	mov    %eax,%r13d
+  801bb8:	85 c0                	test   %eax,%eax
+  801bba:	78 06                	js     801bc2 <fd_close+0x41>
+  801bbc:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  801bc0:	74 1a                	je     801bdc <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  801bc2:	45 84 e4             	test   %r12b,%r12b
+  801bc5:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bca:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  801bce:	44 89 e8             	mov    %r13d,%eax
+  801bd1:	48 83 c4 18          	add    $0x18,%rsp
+  801bd5:	5b                   	pop    %rbx
+  801bd6:	41 5c                	pop    %r12
+  801bd8:	41 5d                	pop    %r13
+  801bda:	5d                   	pop    %rbp
+  801bdb:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801bdc:	8b 3b                	mov    (%rbx),%edi
+  801bde:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801be2:	48 b8 11 1b 80 00 00 	movabs $0x801b11,%rax
+  801be9:	00 00 00 
+  801bec:	ff d0                	call   *%rax
+  801bee:	41 89 c5             	mov    %eax,%r13d
+  801bf1:	85 c0                	test   %eax,%eax
+  801bf3:	78 1b                	js     801c10 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  801bf5:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801bf9:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801bfd:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801c03:	48 85 c0             	test   %rax,%rax
+  801c06:	74 08                	je     801c10 <fd_close+0x8f>
+  801c08:	48 89 df             	mov    %rbx,%rdi
+  801c0b:	ff d0                	call   *%rax
+  801c0d:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801c10:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801c15:	48 89 de             	mov    %rbx,%rsi
+  801c18:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c1d:	48 b8 32 15 80 00 00 	movabs $0x801532,%rax
+  801c24:	00 00 00 
+  801c27:	ff d0                	call   *%rax
+    return res;
+  801c29:	eb a3                	jmp    801bce <fd_close+0x4d>
+
+0000000000801c2b <close>:
+
+int
+close(int fdnum) {
+  801c2b:	55                   	push   %rbp
+  801c2c:	48 89 e5             	mov    %rsp,%rbp
+  801c2f:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  801c33:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801c37:	48 b8 c6 1a 80 00 00 	movabs $0x801ac6,%rax
+  801c3e:	00 00 00 
+  801c41:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801c43:	85 c0                	test   %eax,%eax
+  801c45:	78 15                	js     801c5c <close+0x31>
+
+    return fd_close(fd, 1);
+  801c47:	be 01 00 00 00       	mov    $0x1,%esi
+  801c4c:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801c50:	48 b8 81 1b 80 00 00 	movabs $0x801b81,%rax
+  801c57:	00 00 00 
+  801c5a:	ff d0                	call   *%rax
+}
+  801c5c:	c9                   	leave
+  801c5d:	c3                   	ret
+
+0000000000801c5e <close_all>:
+
+void
+close_all(void) {
+  801c5e:	55                   	push   %rbp
+  801c5f:	48 89 e5             	mov    %rsp,%rbp
+  801c62:	41 54                	push   %r12
+  801c64:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  801c65:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801c6a:	49 bc 2b 1c 80 00 00 	movabs $0x801c2b,%r12
+  801c71:	00 00 00 
+  801c74:	89 df                	mov    %ebx,%edi
+  801c76:	41 ff d4             	call   *%r12
+  801c79:	83 c3 01             	add    $0x1,%ebx
+  801c7c:	83 fb 20             	cmp    $0x20,%ebx
+  801c7f:	75 f3                	jne    801c74 <close_all+0x16>
+}
+  801c81:	5b                   	pop    %rbx
+  801c82:	41 5c                	pop    %r12
+  801c84:	5d                   	pop    %rbp
+  801c85:	c3                   	ret
+
+0000000000801c86 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  801c86:	55                   	push   %rbp
+  801c87:	48 89 e5             	mov    %rsp,%rbp
+  801c8a:	41 57                	push   %r15
+  801c8c:	41 56                	push   %r14
+  801c8e:	41 55                	push   %r13
+  801c90:	41 54                	push   %r12
+  801c92:	53                   	push   %rbx
+  801c93:	48 83 ec 18          	sub    $0x18,%rsp
+  801c97:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  801c9a:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801c9e:	48 b8 c6 1a 80 00 00 	movabs $0x801ac6,%rax
+  801ca5:	00 00 00 
+  801ca8:	ff d0                	call   *%rax
+  801caa:	89 c3                	mov    %eax,%ebx
+  801cac:	85 c0                	test   %eax,%eax
+  801cae:	0f 88 b8 00 00 00    	js     801d6c <dup+0xe6>
+    close(newfdnum);
+  801cb4:	44 89 e7             	mov    %r12d,%edi
+  801cb7:	48 b8 2b 1c 80 00 00 	movabs $0x801c2b,%rax
+  801cbe:	00 00 00 
+  801cc1:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  801cc3:	4d 63 ec             	movslq %r12d,%r13
+  801cc6:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  801ccd:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  801cd1:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  801cd5:	4c 89 ff             	mov    %r15,%rdi
+  801cd8:	49 be 17 1a 80 00 00 	movabs $0x801a17,%r14
+  801cdf:	00 00 00 
+  801ce2:	41 ff d6             	call   *%r14
+  801ce5:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  801ce8:	4c 89 ef             	mov    %r13,%rdi
+  801ceb:	41 ff d6             	call   *%r14
+  801cee:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  801cf1:	48 89 df             	mov    %rbx,%rdi
+  801cf4:	48 b8 3c 2b 80 00 00 	movabs $0x802b3c,%rax
+  801cfb:	00 00 00 
+  801cfe:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  801d00:	a8 04                	test   $0x4,%al
+  801d02:	74 2b                	je     801d2f <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  801d04:	41 89 c1             	mov    %eax,%r9d
+  801d07:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801d0d:	4c 89 f1             	mov    %r14,%rcx
+  801d10:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d15:	48 89 de             	mov    %rbx,%rsi
+  801d18:	bf 00 00 00 00       	mov    $0x0,%edi
+  801d1d:	48 b8 cd 14 80 00 00 	movabs $0x8014cd,%rax
+  801d24:	00 00 00 
+  801d27:	ff d0                	call   *%rax
+  801d29:	89 c3                	mov    %eax,%ebx
+  801d2b:	85 c0                	test   %eax,%eax
+  801d2d:	78 4e                	js     801d7d <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  801d2f:	4c 89 ff             	mov    %r15,%rdi
+  801d32:	48 b8 3c 2b 80 00 00 	movabs $0x802b3c,%rax
+  801d39:	00 00 00 
+  801d3c:	ff d0                	call   *%rax
+  801d3e:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801d41:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801d47:	4c 89 e9             	mov    %r13,%rcx
+  801d4a:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d4f:	4c 89 fe             	mov    %r15,%rsi
+  801d52:	bf 00 00 00 00       	mov    $0x0,%edi
+  801d57:	48 b8 cd 14 80 00 00 	movabs $0x8014cd,%rax
+  801d5e:	00 00 00 
+  801d61:	ff d0                	call   *%rax
+  801d63:	89 c3                	mov    %eax,%ebx
+  801d65:	85 c0                	test   %eax,%eax
+  801d67:	78 14                	js     801d7d <dup+0xf7>
+
+    return newfdnum;
+  801d69:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  801d6c:	89 d8                	mov    %ebx,%eax
+  801d6e:	48 83 c4 18          	add    $0x18,%rsp
+  801d72:	5b                   	pop    %rbx
+  801d73:	41 5c                	pop    %r12
+  801d75:	41 5d                	pop    %r13
+  801d77:	41 5e                	pop    %r14
+  801d79:	41 5f                	pop    %r15
+  801d7b:	5d                   	pop    %rbp
+  801d7c:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  801d7d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801d82:	4c 89 ee             	mov    %r13,%rsi
+  801d85:	bf 00 00 00 00       	mov    $0x0,%edi
+  801d8a:	49 bc 32 15 80 00 00 	movabs $0x801532,%r12
+  801d91:	00 00 00 
+  801d94:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  801d97:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801d9c:	4c 89 f6             	mov    %r14,%rsi
+  801d9f:	bf 00 00 00 00       	mov    $0x0,%edi
+  801da4:	41 ff d4             	call   *%r12
+    return res;
+  801da7:	eb c3                	jmp    801d6c <dup+0xe6>
+
+0000000000801da9 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  801da9:	55                   	push   %rbp
+  801daa:	48 89 e5             	mov    %rsp,%rbp
+  801dad:	41 56                	push   %r14
+  801daf:	41 55                	push   %r13
+  801db1:	41 54                	push   %r12
+  801db3:	53                   	push   %rbx
+  801db4:	48 83 ec 10          	sub    $0x10,%rsp
+  801db8:	89 fb                	mov    %edi,%ebx
+  801dba:	49 89 f4             	mov    %rsi,%r12
+  801dbd:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801dc0:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801dc4:	48 b8 c6 1a 80 00 00 	movabs $0x801ac6,%rax
+  801dcb:	00 00 00 
+  801dce:	ff d0                	call   *%rax
+  801dd0:	85 c0                	test   %eax,%eax
+  801dd2:	78 4c                	js     801e20 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801dd4:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801dd8:	41 8b 3e             	mov    (%r14),%edi
+  801ddb:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801ddf:	48 b8 11 1b 80 00 00 	movabs $0x801b11,%rax
+  801de6:	00 00 00 
+  801de9:	ff d0                	call   *%rax
+  801deb:	85 c0                	test   %eax,%eax
+  801ded:	78 35                	js     801e24 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801def:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801df3:	83 e0 03             	and    $0x3,%eax
+  801df6:	83 f8 01             	cmp    $0x1,%eax
+  801df9:	74 2d                	je     801e28 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801dfb:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801dff:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801e03:	48 85 c0             	test   %rax,%rax
+  801e06:	74 56                	je     801e5e <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  801e08:	4c 89 ea             	mov    %r13,%rdx
+  801e0b:	4c 89 e6             	mov    %r12,%rsi
+  801e0e:	4c 89 f7             	mov    %r14,%rdi
+  801e11:	ff d0                	call   *%rax
+}
+  801e13:	48 83 c4 10          	add    $0x10,%rsp
+  801e17:	5b                   	pop    %rbx
+  801e18:	41 5c                	pop    %r12
+  801e1a:	41 5d                	pop    %r13
+  801e1c:	41 5e                	pop    %r14
+  801e1e:	5d                   	pop    %rbp
+  801e1f:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801e20:	48 98                	cltq
+  801e22:	eb ef                	jmp    801e13 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801e24:	48 98                	cltq
+  801e26:	eb eb                	jmp    801e13 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801e28:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801e2f:	00 00 00 
+  801e32:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+  801e38:	89 da                	mov    %ebx,%edx
+  801e3a:	48 bf 59 38 80 00 00 	movabs $0x803859,%rdi
+  801e41:	00 00 00 
+  801e44:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e49:	48 b9 91 05 80 00 00 	movabs $0x800591,%rcx
+  801e50:	00 00 00 
+  801e53:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801e55:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801e5c:	eb b5                	jmp    801e13 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801e5e:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801e65:	eb ac                	jmp    801e13 <read+0x6a>
+
+0000000000801e67 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801e67:	55                   	push   %rbp
+  801e68:	48 89 e5             	mov    %rsp,%rbp
+  801e6b:	41 57                	push   %r15
+  801e6d:	41 56                	push   %r14
+  801e6f:	41 55                	push   %r13
+  801e71:	41 54                	push   %r12
+  801e73:	53                   	push   %rbx
+  801e74:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  801e78:	48 85 d2             	test   %rdx,%rdx
+  801e7b:	74 54                	je     801ed1 <readn+0x6a>
+  801e7d:	41 89 fd             	mov    %edi,%r13d
+  801e80:	49 89 f6             	mov    %rsi,%r14
+  801e83:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  801e86:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  801e8b:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  801e90:	49 bf a9 1d 80 00 00 	movabs $0x801da9,%r15
+  801e97:	00 00 00 
+  801e9a:	4c 89 e2             	mov    %r12,%rdx
+  801e9d:	48 29 f2             	sub    %rsi,%rdx
+  801ea0:	4c 01 f6             	add    %r14,%rsi
+  801ea3:	44 89 ef             	mov    %r13d,%edi
+  801ea6:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  801ea9:	85 c0                	test   %eax,%eax
+  801eab:	78 20                	js     801ecd <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  801ead:	01 c3                	add    %eax,%ebx
+  801eaf:	85 c0                	test   %eax,%eax
+  801eb1:	74 08                	je     801ebb <readn+0x54>
+  801eb3:	48 63 f3             	movslq %ebx,%rsi
+  801eb6:	4c 39 e6             	cmp    %r12,%rsi
+  801eb9:	72 df                	jb     801e9a <readn+0x33>
+    }
+    return res;
+  801ebb:	48 63 c3             	movslq %ebx,%rax
+}
+  801ebe:	48 83 c4 08          	add    $0x8,%rsp
+  801ec2:	5b                   	pop    %rbx
+  801ec3:	41 5c                	pop    %r12
+  801ec5:	41 5d                	pop    %r13
+  801ec7:	41 5e                	pop    %r14
+  801ec9:	41 5f                	pop    %r15
+  801ecb:	5d                   	pop    %rbp
+  801ecc:	c3                   	ret
+        if (inc < 0) return inc;
+  801ecd:	48 98                	cltq
+  801ecf:	eb ed                	jmp    801ebe <readn+0x57>
+    int inc = 1, res = 0;
+  801ed1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801ed6:	eb e3                	jmp    801ebb <readn+0x54>
+
+0000000000801ed8 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  801ed8:	55                   	push   %rbp
+  801ed9:	48 89 e5             	mov    %rsp,%rbp
+  801edc:	41 56                	push   %r14
+  801ede:	41 55                	push   %r13
+  801ee0:	41 54                	push   %r12
+  801ee2:	53                   	push   %rbx
+  801ee3:	48 83 ec 10          	sub    $0x10,%rsp
+  801ee7:	89 fb                	mov    %edi,%ebx
+  801ee9:	49 89 f4             	mov    %rsi,%r12
+  801eec:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801eef:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801ef3:	48 b8 c6 1a 80 00 00 	movabs $0x801ac6,%rax
+  801efa:	00 00 00 
+  801efd:	ff d0                	call   *%rax
+  801eff:	85 c0                	test   %eax,%eax
+  801f01:	78 47                	js     801f4a <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801f03:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801f07:	41 8b 3e             	mov    (%r14),%edi
+  801f0a:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801f0e:	48 b8 11 1b 80 00 00 	movabs $0x801b11,%rax
+  801f15:	00 00 00 
+  801f18:	ff d0                	call   *%rax
+  801f1a:	85 c0                	test   %eax,%eax
+  801f1c:	78 30                	js     801f4e <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801f1e:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  801f23:	74 2d                	je     801f52 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801f25:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801f29:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801f2d:	48 85 c0             	test   %rax,%rax
+  801f30:	74 56                	je     801f88 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  801f32:	4c 89 ea             	mov    %r13,%rdx
+  801f35:	4c 89 e6             	mov    %r12,%rsi
+  801f38:	4c 89 f7             	mov    %r14,%rdi
+  801f3b:	ff d0                	call   *%rax
+}
+  801f3d:	48 83 c4 10          	add    $0x10,%rsp
+  801f41:	5b                   	pop    %rbx
+  801f42:	41 5c                	pop    %r12
+  801f44:	41 5d                	pop    %r13
+  801f46:	41 5e                	pop    %r14
+  801f48:	5d                   	pop    %rbp
+  801f49:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801f4a:	48 98                	cltq
+  801f4c:	eb ef                	jmp    801f3d <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801f4e:	48 98                	cltq
+  801f50:	eb eb                	jmp    801f3d <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801f52:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801f59:	00 00 00 
+  801f5c:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+  801f62:	89 da                	mov    %ebx,%edx
+  801f64:	48 bf 75 38 80 00 00 	movabs $0x803875,%rdi
+  801f6b:	00 00 00 
+  801f6e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f73:	48 b9 91 05 80 00 00 	movabs $0x800591,%rcx
+  801f7a:	00 00 00 
+  801f7d:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801f7f:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801f86:	eb b5                	jmp    801f3d <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801f88:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801f8f:	eb ac                	jmp    801f3d <write+0x65>
+
+0000000000801f91 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  801f91:	55                   	push   %rbp
+  801f92:	48 89 e5             	mov    %rsp,%rbp
+  801f95:	53                   	push   %rbx
+  801f96:	48 83 ec 18          	sub    $0x18,%rsp
+  801f9a:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801f9c:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801fa0:	48 b8 c6 1a 80 00 00 	movabs $0x801ac6,%rax
+  801fa7:	00 00 00 
+  801faa:	ff d0                	call   *%rax
+  801fac:	85 c0                	test   %eax,%eax
+  801fae:	78 0c                	js     801fbc <seek+0x2b>
+
+    fd->fd_offset = offset;
+  801fb0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801fb4:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  801fb7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801fbc:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801fc0:	c9                   	leave
+  801fc1:	c3                   	ret
+
+0000000000801fc2 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  801fc2:	55                   	push   %rbp
+  801fc3:	48 89 e5             	mov    %rsp,%rbp
+  801fc6:	41 55                	push   %r13
+  801fc8:	41 54                	push   %r12
+  801fca:	53                   	push   %rbx
+  801fcb:	48 83 ec 18          	sub    $0x18,%rsp
+  801fcf:	89 fb                	mov    %edi,%ebx
+  801fd1:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801fd4:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801fd8:	48 b8 c6 1a 80 00 00 	movabs $0x801ac6,%rax
+  801fdf:	00 00 00 
+  801fe2:	ff d0                	call   *%rax
+  801fe4:	85 c0                	test   %eax,%eax
+  801fe6:	78 38                	js     802020 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801fe8:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  801fec:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  801ff0:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801ff4:	48 b8 11 1b 80 00 00 	movabs $0x801b11,%rax
+  801ffb:	00 00 00 
+  801ffe:	ff d0                	call   *%rax
+  802000:	85 c0                	test   %eax,%eax
+  802002:	78 1c                	js     802020 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802004:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  802009:	74 20                	je     80202b <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  80200b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80200f:	48 8b 40 30          	mov    0x30(%rax),%rax
+  802013:	48 85 c0             	test   %rax,%rax
+  802016:	74 47                	je     80205f <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  802018:	44 89 e6             	mov    %r12d,%esi
+  80201b:	4c 89 ef             	mov    %r13,%rdi
+  80201e:	ff d0                	call   *%rax
+}
+  802020:	48 83 c4 18          	add    $0x18,%rsp
+  802024:	5b                   	pop    %rbx
+  802025:	41 5c                	pop    %r12
+  802027:	41 5d                	pop    %r13
+  802029:	5d                   	pop    %rbp
+  80202a:	c3                   	ret
+                thisenv->env_id, fdnum);
+  80202b:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802032:	00 00 00 
+  802035:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  80203b:	89 da                	mov    %ebx,%edx
+  80203d:	48 bf 38 38 80 00 00 	movabs $0x803838,%rdi
+  802044:	00 00 00 
+  802047:	b8 00 00 00 00       	mov    $0x0,%eax
+  80204c:	48 b9 91 05 80 00 00 	movabs $0x800591,%rcx
+  802053:	00 00 00 
+  802056:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  802058:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80205d:	eb c1                	jmp    802020 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  80205f:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802064:	eb ba                	jmp    802020 <ftruncate+0x5e>
+
+0000000000802066 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  802066:	55                   	push   %rbp
+  802067:	48 89 e5             	mov    %rsp,%rbp
+  80206a:	41 54                	push   %r12
+  80206c:	53                   	push   %rbx
+  80206d:	48 83 ec 10          	sub    $0x10,%rsp
+  802071:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802074:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802078:	48 b8 c6 1a 80 00 00 	movabs $0x801ac6,%rax
+  80207f:	00 00 00 
+  802082:	ff d0                	call   *%rax
+  802084:	85 c0                	test   %eax,%eax
+  802086:	78 4e                	js     8020d6 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802088:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  80208c:	41 8b 3c 24          	mov    (%r12),%edi
+  802090:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  802094:	48 b8 11 1b 80 00 00 	movabs $0x801b11,%rax
+  80209b:	00 00 00 
+  80209e:	ff d0                	call   *%rax
+  8020a0:	85 c0                	test   %eax,%eax
+  8020a2:	78 32                	js     8020d6 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  8020a4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8020a8:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  8020ad:	74 30                	je     8020df <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  8020af:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  8020b2:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  8020b9:	00 00 00 
+    stat->st_isdir = 0;
+  8020bc:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8020c3:	00 00 00 
+    stat->st_dev = dev;
+  8020c6:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  8020cd:	48 89 de             	mov    %rbx,%rsi
+  8020d0:	4c 89 e7             	mov    %r12,%rdi
+  8020d3:	ff 50 28             	call   *0x28(%rax)
+}
+  8020d6:	48 83 c4 10          	add    $0x10,%rsp
+  8020da:	5b                   	pop    %rbx
+  8020db:	41 5c                	pop    %r12
+  8020dd:	5d                   	pop    %rbp
+  8020de:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  8020df:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8020e4:	eb f0                	jmp    8020d6 <fstat+0x70>
+
+00000000008020e6 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  8020e6:	55                   	push   %rbp
+  8020e7:	48 89 e5             	mov    %rsp,%rbp
+  8020ea:	41 54                	push   %r12
+  8020ec:	53                   	push   %rbx
+  8020ed:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  8020f0:	be 00 00 00 00       	mov    $0x0,%esi
+  8020f5:	48 b8 c9 24 80 00 00 	movabs $0x8024c9,%rax
+  8020fc:	00 00 00 
+  8020ff:	ff d0                	call   *%rax
+  802101:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  802103:	85 c0                	test   %eax,%eax
+  802105:	78 25                	js     80212c <stat+0x46>
+
+    int res = fstat(fd, stat);
+  802107:	4c 89 e6             	mov    %r12,%rsi
+  80210a:	89 c7                	mov    %eax,%edi
+  80210c:	48 b8 66 20 80 00 00 	movabs $0x802066,%rax
+  802113:	00 00 00 
+  802116:	ff d0                	call   *%rax
+  802118:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  80211b:	89 df                	mov    %ebx,%edi
+  80211d:	48 b8 2b 1c 80 00 00 	movabs $0x801c2b,%rax
+  802124:	00 00 00 
+  802127:	ff d0                	call   *%rax
+
+    return res;
+  802129:	44 89 e3             	mov    %r12d,%ebx
+}
+  80212c:	89 d8                	mov    %ebx,%eax
+  80212e:	5b                   	pop    %rbx
+  80212f:	41 5c                	pop    %r12
+  802131:	5d                   	pop    %rbp
+  802132:	c3                   	ret
+
+0000000000802133 <fsipc>:
+ * response may be written back to fsipcbuf.
+ * type: request code, passed as the simple integer IPC value.
+ * dstva: virtual address at which to receive reply page, 0 if none.
+ * Returns result from the file server. */
+static int
+fsipc(unsigned type, void *dstva) {
+  802133:	55                   	push   %rbp
+  802134:	48 89 e5             	mov    %rsp,%rbp
+  802137:	41 54                	push   %r12
+  802139:	53                   	push   %rbx
+  80213a:	48 83 ec 10          	sub    $0x10,%rsp
+  80213e:	41 89 fc             	mov    %edi,%r12d
+  802141:	48 89 f3             	mov    %rsi,%rbx
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802144:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  80214b:	00 00 00 
+  80214e:	83 38 00             	cmpl   $0x0,(%rax)
+  802151:	74 5e                	je     8021b1 <fsipc+0x7e>
+    if (debug) {
+        cprintf("[%08x] fsipc %d %08x\n",
+                thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+    }
+
+    ipc_send(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW);
+  802153:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802159:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80215e:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  802165:	00 00 00 
+  802168:	44 89 e6             	mov    %r12d,%esi
+  80216b:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  802172:	00 00 00 
+  802175:	8b 38                	mov    (%rax),%edi
+  802177:	48 b8 30 30 80 00 00 	movabs $0x803030,%rax
+  80217e:	00 00 00 
+  802181:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  802183:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  80218a:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  80218b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802190:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  802194:	48 89 de             	mov    %rbx,%rsi
+  802197:	bf 00 00 00 00       	mov    $0x0,%edi
+  80219c:	48 b8 5b 2f 80 00 00 	movabs $0x802f5b,%rax
+  8021a3:	00 00 00 
+  8021a6:	ff d0                	call   *%rax
+}
+  8021a8:	48 83 c4 10          	add    $0x10,%rsp
+  8021ac:	5b                   	pop    %rbx
+  8021ad:	41 5c                	pop    %r12
+  8021af:	5d                   	pop    %rbp
+  8021b0:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8021b1:	bf 03 00 00 00       	mov    $0x3,%edi
+  8021b6:	48 b8 d3 30 80 00 00 	movabs $0x8030d3,%rax
+  8021bd:	00 00 00 
+  8021c0:	ff d0                	call   *%rax
+  8021c2:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  8021c9:	00 00 
+  8021cb:	eb 86                	jmp    802153 <fsipc+0x20>
+
+00000000008021cd <devfile_trunc>:
+    return 0;
+}
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  8021cd:	55                   	push   %rbp
+  8021ce:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  8021d1:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  8021d8:	00 00 00 
+  8021db:	8b 57 0c             	mov    0xc(%rdi),%edx
+  8021de:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  8021e0:	89 70 04             	mov    %esi,0x4(%rax)
+
+    return fsipc(FSREQ_SET_SIZE, NULL);
+  8021e3:	be 00 00 00 00       	mov    $0x0,%esi
+  8021e8:	bf 02 00 00 00       	mov    $0x2,%edi
+  8021ed:	48 b8 33 21 80 00 00 	movabs $0x802133,%rax
+  8021f4:	00 00 00 
+  8021f7:	ff d0                	call   *%rax
+}
+  8021f9:	5d                   	pop    %rbp
+  8021fa:	c3                   	ret
+
+00000000008021fb <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  8021fb:	55                   	push   %rbp
+  8021fc:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  8021ff:	8b 47 0c             	mov    0xc(%rdi),%eax
+  802202:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  802209:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  80220b:	be 00 00 00 00       	mov    $0x0,%esi
+  802210:	bf 06 00 00 00       	mov    $0x6,%edi
+  802215:	48 b8 33 21 80 00 00 	movabs $0x802133,%rax
+  80221c:	00 00 00 
+  80221f:	ff d0                	call   *%rax
+}
+  802221:	5d                   	pop    %rbp
+  802222:	c3                   	ret
+
+0000000000802223 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  802223:	55                   	push   %rbp
+  802224:	48 89 e5             	mov    %rsp,%rbp
+  802227:	41 54                	push   %r12
+  802229:	53                   	push   %rbx
+  80222a:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  80222d:	8b 47 0c             	mov    0xc(%rdi),%eax
+  802230:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  802237:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  802239:	be 00 00 00 00       	mov    $0x0,%esi
+  80223e:	bf 05 00 00 00       	mov    $0x5,%edi
+  802243:	48 b8 33 21 80 00 00 	movabs $0x802133,%rax
+  80224a:	00 00 00 
+  80224d:	ff d0                	call   *%rax
+    if (res < 0) {
+  80224f:	85 c0                	test   %eax,%eax
+  802251:	78 3d                	js     802290 <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802253:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  80225a:	00 00 00 
+  80225d:	4c 89 e6             	mov    %r12,%rsi
+  802260:	48 89 df             	mov    %rbx,%rdi
+  802263:	48 b8 b6 0e 80 00 00 	movabs $0x800eb6,%rax
+  80226a:	00 00 00 
+  80226d:	ff d0                	call   *%rax
+    st->st_size  = fsipcbuf.statRet.ret_size;
+  80226f:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  802276:	00 
+  802277:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  80227d:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  802284:	00 
+  802285:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  80228b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802290:	5b                   	pop    %rbx
+  802291:	41 5c                	pop    %r12
+  802293:	5d                   	pop    %rbp
+  802294:	c3                   	ret
+
+0000000000802295 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  802295:	55                   	push   %rbp
+  802296:	48 89 e5             	mov    %rsp,%rbp
+  802299:	41 57                	push   %r15
+  80229b:	41 56                	push   %r14
+  80229d:	41 55                	push   %r13
+  80229f:	41 54                	push   %r12
+  8022a1:	53                   	push   %rbx
+  8022a2:	48 83 ec 18          	sub    $0x18,%rsp
+  8022a6:	49 89 fe             	mov    %rdi,%r14
+  8022a9:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+  8022ad:	48 89 d3             	mov    %rdx,%rbx
+    while (n > sizeof(fsipcbuf.write.req_buf))
+  8022b0:	48 81 fa f0 0f 00 00 	cmp    $0xff0,%rdx
+  8022b7:	0f 86 e4 00 00 00    	jbe    8023a1 <devfile_write+0x10c>
+  8022bd:	49 89 f4             	mov    %rsi,%r12
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8022c0:	49 bd 00 60 80 00 00 	movabs $0x806000,%r13
+  8022c7:	00 00 00 
+        memcpy(fsipcbuf.write.req_buf, buf, sizeof(fsipcbuf.write.req_buf));
+  8022ca:	49 bf 17 11 80 00 00 	movabs $0x801117,%r15
+  8022d1:	00 00 00 
+  8022d4:	eb 03                	jmp    8022d9 <devfile_write+0x44>
+        buf += sizeof(fsipcbuf.write.req_buf);
+  8022d6:	49 89 f4             	mov    %rsi,%r12
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8022d9:	41 8b 46 0c          	mov    0xc(%r14),%eax
+  8022dd:	41 89 45 00          	mov    %eax,0x0(%r13)
+        fsipcbuf.write.req_n      = sizeof(fsipcbuf.write.req_buf);
+  8022e1:	49 c7 45 08 f0 0f 00 	movq   $0xff0,0x8(%r13)
+  8022e8:	00 
+        memcpy(fsipcbuf.write.req_buf, buf, sizeof(fsipcbuf.write.req_buf));
+  8022e9:	ba f0 0f 00 00       	mov    $0xff0,%edx
+  8022ee:	4c 89 e6             	mov    %r12,%rsi
+  8022f1:	48 bf 10 60 80 00 00 	movabs $0x806010,%rdi
+  8022f8:	00 00 00 
+  8022fb:	41 ff d7             	call   *%r15
+        ssize_t res = fsipc(FSREQ_WRITE, NULL);
+  8022fe:	be 00 00 00 00       	mov    $0x0,%esi
+  802303:	bf 04 00 00 00       	mov    $0x4,%edi
+  802308:	48 b8 33 21 80 00 00 	movabs $0x802133,%rax
+  80230f:	00 00 00 
+  802312:	ff d0                	call   *%rax
+  802314:	48 63 d0             	movslq %eax,%rdx
+        if (res < 0 || res < sizeof(fsipcbuf.write.req_buf))
+  802317:	3d ef 0f 00 00       	cmp    $0xfef,%eax
+  80231c:	7e 71                	jle    80238f <devfile_write+0xfa>
+        buf += sizeof(fsipcbuf.write.req_buf);
+  80231e:	49 8d b4 24 f0 0f 00 	lea    0xff0(%r12),%rsi
+  802325:	00 
+        n -= sizeof(fsipcbuf.write.req_buf);
+  802326:	48 81 eb f0 0f 00 00 	sub    $0xff0,%rbx
+    while (n > sizeof(fsipcbuf.write.req_buf))
+  80232d:	48 81 fb f0 0f 00 00 	cmp    $0xff0,%rbx
+  802334:	77 a0                	ja     8022d6 <devfile_write+0x41>
+        written += sizeof(fsipcbuf.write.req_buf);
+  802336:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80233a:	49 29 c4             	sub    %rax,%r12
+  80233d:	4d 8d a4 24 f0 0f 00 	lea    0xff0(%r12),%r12
+  802344:	00 
+    fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802345:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  80234c:	00 00 00 
+  80234f:	41 8b 56 0c          	mov    0xc(%r14),%edx
+  802353:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.write.req_n      = n;
+  802355:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    memcpy(fsipcbuf.write.req_buf, buf, n);
+  802359:	48 89 da             	mov    %rbx,%rdx
+  80235c:	48 8d 78 10          	lea    0x10(%rax),%rdi
+  802360:	48 b8 17 11 80 00 00 	movabs $0x801117,%rax
+  802367:	00 00 00 
+  80236a:	ff d0                	call   *%rax
+    ssize_t res = fsipc(FSREQ_WRITE, NULL);
+  80236c:	be 00 00 00 00       	mov    $0x0,%esi
+  802371:	bf 04 00 00 00       	mov    $0x4,%edi
+  802376:	48 b8 33 21 80 00 00 	movabs $0x802133,%rax
+  80237d:	00 00 00 
+  802380:	ff d0                	call   *%rax
+  802382:	48 63 d0             	movslq %eax,%rdx
+    written += res;
+  802385:	49 01 d4             	add    %rdx,%r12
+  802388:	48 85 d2             	test   %rdx,%rdx
+  80238b:	49 0f 49 d4          	cmovns %r12,%rdx
+}
+  80238f:	48 89 d0             	mov    %rdx,%rax
+  802392:	48 83 c4 18          	add    $0x18,%rsp
+  802396:	5b                   	pop    %rbx
+  802397:	41 5c                	pop    %r12
+  802399:	41 5d                	pop    %r13
+  80239b:	41 5e                	pop    %r14
+  80239d:	41 5f                	pop    %r15
+  80239f:	5d                   	pop    %rbp
+  8023a0:	c3                   	ret
+    while (n > sizeof(fsipcbuf.write.req_buf))
+  8023a1:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+    ssize_t written = 0;
+  8023a5:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8023ab:	eb 98                	jmp    802345 <devfile_write+0xb0>
+
+00000000008023ad <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  8023ad:	55                   	push   %rbp
+  8023ae:	48 89 e5             	mov    %rsp,%rbp
+  8023b1:	41 57                	push   %r15
+  8023b3:	41 56                	push   %r14
+  8023b5:	41 55                	push   %r13
+  8023b7:	41 54                	push   %r12
+  8023b9:	53                   	push   %rbx
+  8023ba:	48 83 ec 18          	sub    $0x18,%rsp
+  8023be:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  8023c2:	49 89 f6             	mov    %rsi,%r14
+  8023c5:	49 89 d4             	mov    %rdx,%r12
+    while (n > sizeof(fsipcbuf.readRet.ret_buf))
+  8023c8:	48 81 fa 00 10 00 00 	cmp    $0x1000,%rdx
+  8023cf:	0f 86 ea 00 00 00    	jbe    8024bf <devfile_read+0x112>
+    ssize_t readsz = 0;
+  8023d5:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  8023dc:	00 
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8023dd:	49 bf 00 60 80 00 00 	movabs $0x806000,%r15
+  8023e4:	00 00 00 
+  8023e7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8023eb:	8b 40 0c             	mov    0xc(%rax),%eax
+  8023ee:	41 89 07             	mov    %eax,(%r15)
+        fsipcbuf.read.req_n = sizeof(fsipcbuf.readRet.ret_buf);
+  8023f1:	49 c7 47 08 00 10 00 	movq   $0x1000,0x8(%r15)
+  8023f8:	00 
+        ssize_t res = fsipc(FSREQ_READ, NULL);
+  8023f9:	be 00 00 00 00       	mov    $0x0,%esi
+  8023fe:	bf 03 00 00 00       	mov    $0x3,%edi
+  802403:	48 b8 33 21 80 00 00 	movabs $0x802133,%rax
+  80240a:	00 00 00 
+  80240d:	ff d0                	call   *%rax
+  80240f:	4c 63 e8             	movslq %eax,%r13
+        if (res < 0)
+  802412:	4d 85 ed             	test   %r13,%r13
+  802415:	0f 88 92 00 00 00    	js     8024ad <devfile_read+0x100>
+        memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  80241b:	4c 89 ea             	mov    %r13,%rdx
+  80241e:	4c 89 fe             	mov    %r15,%rsi
+  802421:	4c 89 f7             	mov    %r14,%rdi
+  802424:	48 b8 17 11 80 00 00 	movabs $0x801117,%rax
+  80242b:	00 00 00 
+  80242e:	ff d0                	call   *%rax
+        if (res < sizeof(fsipcbuf.readRet.ret_buf))
+  802430:	49 81 fd ff 0f 00 00 	cmp    $0xfff,%r13
+  802437:	76 6d                	jbe    8024a6 <devfile_read+0xf9>
+        readsz += res;
+  802439:	4c 01 6d c0          	add    %r13,-0x40(%rbp)
+        buf += res;
+  80243d:	4d 01 ee             	add    %r13,%r14
+        n -= res;
+  802440:	4d 29 ec             	sub    %r13,%r12
+    while (n > sizeof(fsipcbuf.readRet.ret_buf))
+  802443:	49 81 fc 00 10 00 00 	cmp    $0x1000,%r12
+  80244a:	77 9b                	ja     8023e7 <devfile_read+0x3a>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  80244c:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  802453:	00 00 00 
+  802456:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  80245a:	8b 51 0c             	mov    0xc(%rcx),%edx
+  80245d:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.read.req_n = n;
+  80245f:	4c 89 60 08          	mov    %r12,0x8(%rax)
+    ssize_t res = fsipc(FSREQ_READ, NULL);
+  802463:	be 00 00 00 00       	mov    $0x0,%esi
+  802468:	bf 03 00 00 00       	mov    $0x3,%edi
+  80246d:	48 b8 33 21 80 00 00 	movabs $0x802133,%rax
+  802474:	00 00 00 
+  802477:	ff d0                	call   *%rax
+  802479:	4c 63 e8             	movslq %eax,%r13
+    if (res < 0)
+  80247c:	4d 85 ed             	test   %r13,%r13
+  80247f:	78 2c                	js     8024ad <devfile_read+0x100>
+    memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  802481:	4c 89 ea             	mov    %r13,%rdx
+  802484:	48 be 00 60 80 00 00 	movabs $0x806000,%rsi
+  80248b:	00 00 00 
+  80248e:	4c 89 f7             	mov    %r14,%rdi
+  802491:	48 b8 17 11 80 00 00 	movabs $0x801117,%rax
+  802498:	00 00 00 
+  80249b:	ff d0                	call   *%rax
+    readsz += res;
+  80249d:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8024a1:	49 01 c5             	add    %rax,%r13
+    return readsz;
+  8024a4:	eb 07                	jmp    8024ad <devfile_read+0x100>
+            return readsz + res;
+  8024a6:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8024aa:	49 01 c5             	add    %rax,%r13
+}
+  8024ad:	4c 89 e8             	mov    %r13,%rax
+  8024b0:	48 83 c4 18          	add    $0x18,%rsp
+  8024b4:	5b                   	pop    %rbx
+  8024b5:	41 5c                	pop    %r12
+  8024b7:	41 5d                	pop    %r13
+  8024b9:	41 5e                	pop    %r14
+  8024bb:	41 5f                	pop    %r15
+  8024bd:	5d                   	pop    %rbp
+  8024be:	c3                   	ret
+    ssize_t readsz = 0;
+  8024bf:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  8024c6:	00 
+  8024c7:	eb 83                	jmp    80244c <devfile_read+0x9f>
+
+00000000008024c9 <open>:
+open(const char *path, int mode) {
+  8024c9:	55                   	push   %rbp
+  8024ca:	48 89 e5             	mov    %rsp,%rbp
+  8024cd:	41 55                	push   %r13
+  8024cf:	41 54                	push   %r12
+  8024d1:	53                   	push   %rbx
+  8024d2:	48 83 ec 18          	sub    $0x18,%rsp
+  8024d6:	49 89 fc             	mov    %rdi,%r12
+  8024d9:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  8024dc:	48 b8 78 0e 80 00 00 	movabs $0x800e78,%rax
+  8024e3:	00 00 00 
+  8024e6:	ff d0                	call   *%rax
+  8024e8:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  8024ee:	0f 87 8a 00 00 00    	ja     80257e <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8024f4:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  8024f8:	48 b8 ac 1a 80 00 00 	movabs $0x801aac,%rax
+  8024ff:	00 00 00 
+  802502:	ff d0                	call   *%rax
+  802504:	89 c3                	mov    %eax,%ebx
+  802506:	85 c0                	test   %eax,%eax
+  802508:	78 50                	js     80255a <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  80250a:	4c 89 e6             	mov    %r12,%rsi
+  80250d:	48 bb 00 60 80 00 00 	movabs $0x806000,%rbx
+  802514:	00 00 00 
+  802517:	48 89 df             	mov    %rbx,%rdi
+  80251a:	48 b8 b6 0e 80 00 00 	movabs $0x800eb6,%rax
+  802521:	00 00 00 
+  802524:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  802526:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  80252d:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802531:	bf 01 00 00 00       	mov    $0x1,%edi
+  802536:	48 b8 33 21 80 00 00 	movabs $0x802133,%rax
+  80253d:	00 00 00 
+  802540:	ff d0                	call   *%rax
+  802542:	89 c3                	mov    %eax,%ebx
+  802544:	85 c0                	test   %eax,%eax
+  802546:	78 1f                	js     802567 <open+0x9e>
+    return fd2num(fd);
+  802548:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80254c:	48 b8 05 1a 80 00 00 	movabs $0x801a05,%rax
+  802553:	00 00 00 
+  802556:	ff d0                	call   *%rax
+  802558:	89 c3                	mov    %eax,%ebx
+}
+  80255a:	89 d8                	mov    %ebx,%eax
+  80255c:	48 83 c4 18          	add    $0x18,%rsp
+  802560:	5b                   	pop    %rbx
+  802561:	41 5c                	pop    %r12
+  802563:	41 5d                	pop    %r13
+  802565:	5d                   	pop    %rbp
+  802566:	c3                   	ret
+        fd_close(fd, 0);
+  802567:	be 00 00 00 00       	mov    $0x0,%esi
+  80256c:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802570:	48 b8 81 1b 80 00 00 	movabs $0x801b81,%rax
+  802577:	00 00 00 
+  80257a:	ff d0                	call   *%rax
+        return res;
+  80257c:	eb dc                	jmp    80255a <open+0x91>
+        return -E_BAD_PATH;
+  80257e:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  802583:	eb d5                	jmp    80255a <open+0x91>
+
+0000000000802585 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  802585:	55                   	push   %rbp
+  802586:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc(FSREQ_SYNC, NULL);
+  802589:	be 00 00 00 00       	mov    $0x0,%esi
+  80258e:	bf 08 00 00 00       	mov    $0x8,%edi
+  802593:	48 b8 33 21 80 00 00 	movabs $0x802133,%rax
+  80259a:	00 00 00 
+  80259d:	ff d0                	call   *%rax
+}
+  80259f:	5d                   	pop    %rbp
+  8025a0:	c3                   	ret
+
+00000000008025a1 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  8025a1:	55                   	push   %rbp
+  8025a2:	48 89 e5             	mov    %rsp,%rbp
+  8025a5:	41 54                	push   %r12
+  8025a7:	53                   	push   %rbx
+  8025a8:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8025ab:	48 b8 17 1a 80 00 00 	movabs $0x801a17,%rax
+  8025b2:	00 00 00 
+  8025b5:	ff d0                	call   *%rax
+  8025b7:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  8025ba:	48 be c0 38 80 00 00 	movabs $0x8038c0,%rsi
+  8025c1:	00 00 00 
+  8025c4:	48 89 df             	mov    %rbx,%rdi
+  8025c7:	48 b8 b6 0e 80 00 00 	movabs $0x800eb6,%rax
+  8025ce:	00 00 00 
+  8025d1:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  8025d3:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  8025d8:	41 2b 04 24          	sub    (%r12),%eax
+  8025dc:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  8025e2:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8025e9:	00 00 00 
+    stat->st_dev = &devpipe;
+  8025ec:	48 b8 60 40 80 00 00 	movabs $0x804060,%rax
+  8025f3:	00 00 00 
+  8025f6:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  8025fd:	b8 00 00 00 00       	mov    $0x0,%eax
+  802602:	5b                   	pop    %rbx
+  802603:	41 5c                	pop    %r12
+  802605:	5d                   	pop    %rbp
+  802606:	c3                   	ret
+
+0000000000802607 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  802607:	55                   	push   %rbp
+  802608:	48 89 e5             	mov    %rsp,%rbp
+  80260b:	41 54                	push   %r12
+  80260d:	53                   	push   %rbx
+  80260e:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  802611:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802616:	48 89 fe             	mov    %rdi,%rsi
+  802619:	bf 00 00 00 00       	mov    $0x0,%edi
+  80261e:	49 bc 32 15 80 00 00 	movabs $0x801532,%r12
+  802625:	00 00 00 
+  802628:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  80262b:	48 89 df             	mov    %rbx,%rdi
+  80262e:	48 b8 17 1a 80 00 00 	movabs $0x801a17,%rax
+  802635:	00 00 00 
+  802638:	ff d0                	call   *%rax
+  80263a:	48 89 c6             	mov    %rax,%rsi
+  80263d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802642:	bf 00 00 00 00       	mov    $0x0,%edi
+  802647:	41 ff d4             	call   *%r12
+}
+  80264a:	5b                   	pop    %rbx
+  80264b:	41 5c                	pop    %r12
+  80264d:	5d                   	pop    %rbp
+  80264e:	c3                   	ret
+
+000000000080264f <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  80264f:	55                   	push   %rbp
+  802650:	48 89 e5             	mov    %rsp,%rbp
+  802653:	41 57                	push   %r15
+  802655:	41 56                	push   %r14
+  802657:	41 55                	push   %r13
+  802659:	41 54                	push   %r12
+  80265b:	53                   	push   %rbx
+  80265c:	48 83 ec 18          	sub    $0x18,%rsp
+  802660:	49 89 fc             	mov    %rdi,%r12
+  802663:	49 89 f5             	mov    %rsi,%r13
+  802666:	49 89 d7             	mov    %rdx,%r15
+  802669:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80266d:	48 b8 17 1a 80 00 00 	movabs $0x801a17,%rax
+  802674:	00 00 00 
+  802677:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  802679:	4d 85 ff             	test   %r15,%r15
+  80267c:	0f 84 af 00 00 00    	je     802731 <devpipe_write+0xe2>
+  802682:	48 89 c3             	mov    %rax,%rbx
+  802685:	4c 89 f8             	mov    %r15,%rax
+  802688:	4d 89 ef             	mov    %r13,%r15
+  80268b:	4c 01 e8             	add    %r13,%rax
+  80268e:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802692:	49 bd 3a 14 80 00 00 	movabs $0x80143a,%r13
+  802699:	00 00 00 
+            sys_yield();
+  80269c:	49 be d7 13 80 00 00 	movabs $0x8013d7,%r14
+  8026a3:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  8026a6:	8b 73 04             	mov    0x4(%rbx),%esi
+  8026a9:	48 63 ce             	movslq %esi,%rcx
+  8026ac:	48 63 03             	movslq (%rbx),%rax
+  8026af:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  8026b5:	48 39 c1             	cmp    %rax,%rcx
+  8026b8:	72 2e                	jb     8026e8 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8026ba:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8026bf:	48 89 da             	mov    %rbx,%rdx
+  8026c2:	be 00 10 00 00       	mov    $0x1000,%esi
+  8026c7:	4c 89 e7             	mov    %r12,%rdi
+  8026ca:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  8026cd:	85 c0                	test   %eax,%eax
+  8026cf:	74 66                	je     802737 <devpipe_write+0xe8>
+            sys_yield();
+  8026d1:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  8026d4:	8b 73 04             	mov    0x4(%rbx),%esi
+  8026d7:	48 63 ce             	movslq %esi,%rcx
+  8026da:	48 63 03             	movslq (%rbx),%rax
+  8026dd:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  8026e3:	48 39 c1             	cmp    %rax,%rcx
+  8026e6:	73 d2                	jae    8026ba <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8026e8:	41 0f b6 3f          	movzbl (%r15),%edi
+  8026ec:	48 89 ca             	mov    %rcx,%rdx
+  8026ef:	48 c1 ea 03          	shr    $0x3,%rdx
+  8026f3:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  8026fa:	08 10 20 
+  8026fd:	48 f7 e2             	mul    %rdx
+  802700:	48 c1 ea 06          	shr    $0x6,%rdx
+  802704:	48 89 d0             	mov    %rdx,%rax
+  802707:	48 c1 e0 09          	shl    $0x9,%rax
+  80270b:	48 29 d0             	sub    %rdx,%rax
+  80270e:	48 c1 e0 03          	shl    $0x3,%rax
+  802712:	48 29 c1             	sub    %rax,%rcx
+  802715:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  80271a:	83 c6 01             	add    $0x1,%esi
+  80271d:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  802720:	49 83 c7 01          	add    $0x1,%r15
+  802724:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802728:	49 39 c7             	cmp    %rax,%r15
+  80272b:	0f 85 75 ff ff ff    	jne    8026a6 <devpipe_write+0x57>
+    return n;
+  802731:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802735:	eb 05                	jmp    80273c <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  802737:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80273c:	48 83 c4 18          	add    $0x18,%rsp
+  802740:	5b                   	pop    %rbx
+  802741:	41 5c                	pop    %r12
+  802743:	41 5d                	pop    %r13
+  802745:	41 5e                	pop    %r14
+  802747:	41 5f                	pop    %r15
+  802749:	5d                   	pop    %rbp
+  80274a:	c3                   	ret
+
+000000000080274b <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  80274b:	55                   	push   %rbp
+  80274c:	48 89 e5             	mov    %rsp,%rbp
+  80274f:	41 57                	push   %r15
+  802751:	41 56                	push   %r14
+  802753:	41 55                	push   %r13
+  802755:	41 54                	push   %r12
+  802757:	53                   	push   %rbx
+  802758:	48 83 ec 18          	sub    $0x18,%rsp
+  80275c:	49 89 fc             	mov    %rdi,%r12
+  80275f:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  802763:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802767:	48 b8 17 1a 80 00 00 	movabs $0x801a17,%rax
+  80276e:	00 00 00 
+  802771:	ff d0                	call   *%rax
+  802773:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  802776:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80277c:	49 bd 3a 14 80 00 00 	movabs $0x80143a,%r13
+  802783:	00 00 00 
+            sys_yield();
+  802786:	49 be d7 13 80 00 00 	movabs $0x8013d7,%r14
+  80278d:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  802790:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  802795:	74 7d                	je     802814 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  802797:	8b 03                	mov    (%rbx),%eax
+  802799:	3b 43 04             	cmp    0x4(%rbx),%eax
+  80279c:	75 26                	jne    8027c4 <devpipe_read+0x79>
+            if (i > 0) return i;
+  80279e:	4d 85 ff             	test   %r15,%r15
+  8027a1:	75 77                	jne    80281a <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8027a3:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8027a8:	48 89 da             	mov    %rbx,%rdx
+  8027ab:	be 00 10 00 00       	mov    $0x1000,%esi
+  8027b0:	4c 89 e7             	mov    %r12,%rdi
+  8027b3:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  8027b6:	85 c0                	test   %eax,%eax
+  8027b8:	74 72                	je     80282c <devpipe_read+0xe1>
+            sys_yield();
+  8027ba:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  8027bd:	8b 03                	mov    (%rbx),%eax
+  8027bf:	3b 43 04             	cmp    0x4(%rbx),%eax
+  8027c2:	74 df                	je     8027a3 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  8027c4:	48 63 c8             	movslq %eax,%rcx
+  8027c7:	48 89 ca             	mov    %rcx,%rdx
+  8027ca:	48 c1 ea 03          	shr    $0x3,%rdx
+  8027ce:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  8027d5:	08 10 20 
+  8027d8:	48 89 d0             	mov    %rdx,%rax
+  8027db:	48 f7 e6             	mul    %rsi
+  8027de:	48 c1 ea 06          	shr    $0x6,%rdx
+  8027e2:	48 89 d0             	mov    %rdx,%rax
+  8027e5:	48 c1 e0 09          	shl    $0x9,%rax
+  8027e9:	48 29 d0             	sub    %rdx,%rax
+  8027ec:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  8027f3:	00 
+  8027f4:	48 89 c8             	mov    %rcx,%rax
+  8027f7:	48 29 d0             	sub    %rdx,%rax
+  8027fa:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  8027ff:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  802803:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  802807:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  80280a:	49 83 c7 01          	add    $0x1,%r15
+  80280e:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  802812:	75 83                	jne    802797 <devpipe_read+0x4c>
+    return n;
+  802814:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802818:	eb 03                	jmp    80281d <devpipe_read+0xd2>
+            if (i > 0) return i;
+  80281a:	4c 89 f8             	mov    %r15,%rax
+}
+  80281d:	48 83 c4 18          	add    $0x18,%rsp
+  802821:	5b                   	pop    %rbx
+  802822:	41 5c                	pop    %r12
+  802824:	41 5d                	pop    %r13
+  802826:	41 5e                	pop    %r14
+  802828:	41 5f                	pop    %r15
+  80282a:	5d                   	pop    %rbp
+  80282b:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  80282c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802831:	eb ea                	jmp    80281d <devpipe_read+0xd2>
+
+0000000000802833 <pipe>:
+pipe(int pfd[2]) {
+  802833:	55                   	push   %rbp
+  802834:	48 89 e5             	mov    %rsp,%rbp
+  802837:	41 55                	push   %r13
+  802839:	41 54                	push   %r12
+  80283b:	53                   	push   %rbx
+  80283c:	48 81 ec b8 00 00 00 	sub    $0xb8,%rsp
+  802843:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  802846:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  80284a:	48 b8 ac 1a 80 00 00 	movabs $0x801aac,%rax
+  802851:	00 00 00 
+  802854:	ff d0                	call   *%rax
+  802856:	89 c3                	mov    %eax,%ebx
+  802858:	85 c0                	test   %eax,%eax
+  80285a:	0f 88 51 01 00 00    	js     8029b1 <pipe+0x17e>
+        (res = fd_alloc_from(fd2num(fd0) + 1, &fd1)) < 0) goto err;
+  802860:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802864:	48 b8 05 1a 80 00 00 	movabs $0x801a05,%rax
+  80286b:	00 00 00 
+  80286e:	ff d0                	call   *%rax
+  802870:	8d 78 01             	lea    0x1(%rax),%edi
+  802873:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802877:	48 b8 33 1a 80 00 00 	movabs $0x801a33,%rax
+  80287e:	00 00 00 
+  802881:	ff d0                	call   *%rax
+  802883:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  802885:	85 c0                	test   %eax,%eax
+  802887:	0f 88 24 01 00 00    	js     8029b1 <pipe+0x17e>
+    va = fd2data(fd0);
+  80288d:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802891:	48 bb 17 1a 80 00 00 	movabs $0x801a17,%rbx
+  802898:	00 00 00 
+  80289b:	ff d3                	call   *%rbx
+  80289d:	49 89 c5             	mov    %rax,%r13
+    struct RegionOp ops[] = {
+  8028a0:	48 8d bd 30 ff ff ff 	lea    -0xd0(%rbp),%rdi
+  8028a7:	b9 14 00 00 00       	mov    $0x14,%ecx
+  8028ac:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028b1:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+  8028b4:	c7 85 34 ff ff ff 46 	movl   $0x46,-0xcc(%rbp)
+  8028bb:	00 00 00 
+  8028be:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8028c2:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+  8028c9:	48 c7 85 50 ff ff ff 	movq   $0x1000,-0xb0(%rbp)
+  8028d0:	00 10 00 00 
+  8028d4:	c7 85 5c ff ff ff 46 	movl   $0x46,-0xa4(%rbp)
+  8028db:	00 00 00 
+            {.type = REGION_ALLOC, .dstva = (uintptr_t)fd1, .size = PAGE_SIZE, .perm = PROT_RW | PROT_SHARE},
+  8028de:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+    struct RegionOp ops[] = {
+  8028e2:	48 89 bd 70 ff ff ff 	mov    %rdi,-0x90(%rbp)
+  8028e9:	48 c7 85 78 ff ff ff 	movq   $0x1000,-0x88(%rbp)
+  8028f0:	00 10 00 00 
+  8028f4:	c7 45 84 46 00 00 00 	movl   $0x46,-0x7c(%rbp)
+  8028fb:	4c 89 6d 98          	mov    %r13,-0x68(%rbp)
+  8028ff:	48 c7 45 a0 00 10 00 	movq   $0x1000,-0x60(%rbp)
+  802906:	00 
+  802907:	c7 45 a8 01 00 00 00 	movl   $0x1,-0x58(%rbp)
+  80290e:	c7 45 ac 46 00 00 00 	movl   $0x46,-0x54(%rbp)
+  802915:	4c 89 6d b8          	mov    %r13,-0x48(%rbp)
+            {.type = REGION_MAP, .srcva = (uintptr_t)va, .dstva = (uintptr_t)fd2data(fd1), .size = PAGE_SIZE, .perm = PROT_RW | PROT_SHARE},
+  802919:	ff d3                	call   *%rbx
+    struct RegionOp ops[] = {
+  80291b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80291f:	48 c7 45 c8 00 10 00 	movq   $0x1000,-0x38(%rbp)
+  802926:	00 
+    if ((res = sys_region_batch(ops, sizeof ops / sizeof *ops)) < 0) goto err1;
+  802927:	be 04 00 00 00       	mov    $0x4,%esi
+  80292c:	48 8d bd 30 ff ff ff 	lea    -0xd0(%rbp),%rdi
+  802933:	48 b8 99 15 80 00 00 	movabs $0x801599,%rax
+  80293a:	00 00 00 
+  80293d:	ff d0                	call   *%rax
+  80293f:	89 c3                	mov    %eax,%ebx
+  802941:	85 c0                	test   %eax,%eax
+  802943:	0f 88 ad 00 00 00    	js     8029f6 <pipe+0x1c3>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  802949:	be 00 10 00 00       	mov    $0x1000,%esi
+  80294e:	4c 89 ef             	mov    %r13,%rdi
+  802951:	48 b8 08 14 80 00 00 	movabs $0x801408,%rax
+  802958:	00 00 00 
+  80295b:	ff d0                	call   *%rax
+  80295d:	83 f8 02             	cmp    $0x2,%eax
+  802960:	75 5f                	jne    8029c1 <pipe+0x18e>
+    fd0->fd_dev_id = devpipe.dev_id;
+  802962:	a1 60 40 80 00 00 00 	movabs 0x804060,%eax
+  802969:	00 00 
+  80296b:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80296f:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  802971:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802975:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  80297c:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  802980:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  802982:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802986:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  80298d:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802991:	48 bb 05 1a 80 00 00 	movabs $0x801a05,%rbx
+  802998:	00 00 00 
+  80299b:	ff d3                	call   *%rbx
+  80299d:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  8029a1:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  8029a5:	ff d3                	call   *%rbx
+  8029a7:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  8029ac:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  8029b1:	89 d8                	mov    %ebx,%eax
+  8029b3:	48 81 c4 b8 00 00 00 	add    $0xb8,%rsp
+  8029ba:	5b                   	pop    %rbx
+  8029bb:	41 5c                	pop    %r12
+  8029bd:	41 5d                	pop    %r13
+  8029bf:	5d                   	pop    %rbp
+  8029c0:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8029c1:	48 b9 f0 38 80 00 00 	movabs $0x8038f0,%rcx
+  8029c8:	00 00 00 
+  8029cb:	48 ba c7 38 80 00 00 	movabs $0x8038c7,%rdx
+  8029d2:	00 00 00 
+  8029d5:	be 33 00 00 00       	mov    $0x33,%esi
+  8029da:	48 bf dc 38 80 00 00 	movabs $0x8038dc,%rdi
+  8029e1:	00 00 00 
+  8029e4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029e9:	49 b8 41 04 80 00 00 	movabs $0x800441,%r8
+  8029f0:	00 00 00 
+  8029f3:	41 ff d0             	call   *%r8
+        ops[i].type = REGION_UNMAP;
+  8029f6:	c7 85 30 ff ff ff 02 	movl   $0x2,-0xd0(%rbp)
+  8029fd:	00 00 00 
+  802a00:	c7 85 58 ff ff ff 02 	movl   $0x2,-0xa8(%rbp)
+  802a07:	00 00 00 
+  802a0a:	c7 45 80 02 00 00 00 	movl   $0x2,-0x80(%rbp)
+  802a11:	c7 45 a8 02 00 00 00 	movl   $0x2,-0x58(%rbp)
+    sys_region_batch(ops, sizeof ops / sizeof *ops);
+  802a18:	be 04 00 00 00       	mov    $0x4,%esi
+  802a1d:	48 8d bd 30 ff ff ff 	lea    -0xd0(%rbp),%rdi
+  802a24:	48 b8 99 15 80 00 00 	movabs $0x801599,%rax
+  802a2b:	00 00 00 
+  802a2e:	ff d0                	call   *%rax
+  802a30:	e9 7c ff ff ff       	jmp    8029b1 <pipe+0x17e>
+
+0000000000802a35 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  802a35:	55                   	push   %rbp
+  802a36:	48 89 e5             	mov    %rsp,%rbp
+  802a39:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  802a3d:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802a41:	48 b8 c6 1a 80 00 00 	movabs $0x801ac6,%rax
+  802a48:	00 00 00 
+  802a4b:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802a4d:	85 c0                	test   %eax,%eax
+  802a4f:	78 35                	js     802a86 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  802a51:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802a55:	48 b8 17 1a 80 00 00 	movabs $0x801a17,%rax
+  802a5c:	00 00 00 
+  802a5f:	ff d0                	call   *%rax
+  802a61:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802a64:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802a69:	be 00 10 00 00       	mov    $0x1000,%esi
+  802a6e:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802a72:	48 b8 3a 14 80 00 00 	movabs $0x80143a,%rax
+  802a79:	00 00 00 
+  802a7c:	ff d0                	call   *%rax
+  802a7e:	85 c0                	test   %eax,%eax
+  802a80:	0f 94 c0             	sete   %al
+  802a83:	0f b6 c0             	movzbl %al,%eax
+}
+  802a86:	c9                   	leave
+  802a87:	c3                   	ret
+
+0000000000802a88 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  802a88:	48 89 f8             	mov    %rdi,%rax
+  802a8b:	48 c1 e8 27          	shr    $0x27,%rax
+  802a8f:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  802a96:	01 00 00 
+  802a99:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802a9d:	f6 c2 01             	test   $0x1,%dl
+  802aa0:	74 6d                	je     802b0f <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  802aa2:	48 89 f8             	mov    %rdi,%rax
+  802aa5:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802aa9:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802ab0:	01 00 00 
+  802ab3:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802ab7:	f6 c2 01             	test   $0x1,%dl
+  802aba:	74 62                	je     802b1e <get_uvpt_entry+0x96>
+  802abc:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802ac3:	01 00 00 
+  802ac6:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802aca:	f6 c2 80             	test   $0x80,%dl
+  802acd:	75 4f                	jne    802b1e <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  802acf:	48 89 f8             	mov    %rdi,%rax
+  802ad2:	48 c1 e8 15          	shr    $0x15,%rax
+  802ad6:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802add:	01 00 00 
+  802ae0:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802ae4:	f6 c2 01             	test   $0x1,%dl
+  802ae7:	74 44                	je     802b2d <get_uvpt_entry+0xa5>
+  802ae9:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802af0:	01 00 00 
+  802af3:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802af7:	f6 c2 80             	test   $0x80,%dl
+  802afa:	75 31                	jne    802b2d <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  802afc:	48 c1 ef 0c          	shr    $0xc,%rdi
+  802b00:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802b07:	01 00 00 
+  802b0a:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  802b0e:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  802b0f:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  802b16:	01 00 00 
+  802b19:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802b1d:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  802b1e:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802b25:	01 00 00 
+  802b28:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802b2c:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  802b2d:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802b34:	01 00 00 
+  802b37:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802b3b:	c3                   	ret
+
+0000000000802b3c <get_prot>:
+
+int
+get_prot(void *va) {
+  802b3c:	55                   	push   %rbp
+  802b3d:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  802b40:	48 b8 88 2a 80 00 00 	movabs $0x802a88,%rax
+  802b47:	00 00 00 
+  802b4a:	ff d0                	call   *%rax
+  802b4c:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  802b4f:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  802b54:	89 c1                	mov    %eax,%ecx
+  802b56:	83 c9 04             	or     $0x4,%ecx
+  802b59:	f6 c2 01             	test   $0x1,%dl
+  802b5c:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  802b5f:	89 c1                	mov    %eax,%ecx
+  802b61:	83 c9 02             	or     $0x2,%ecx
+  802b64:	f6 c2 02             	test   $0x2,%dl
+  802b67:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  802b6a:	89 c1                	mov    %eax,%ecx
+  802b6c:	83 c9 01             	or     $0x1,%ecx
+  802b6f:	48 85 d2             	test   %rdx,%rdx
+  802b72:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  802b75:	89 c1                	mov    %eax,%ecx
+  802b77:	83 c9 40             	or     $0x40,%ecx
+  802b7a:	f6 c6 04             	test   $0x4,%dh
+  802b7d:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  802b80:	5d                   	pop    %rbp
+  802b81:	c3                   	ret
+
+0000000000802b82 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  802b82:	55                   	push   %rbp
+  802b83:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  802b86:	48 b8 88 2a 80 00 00 	movabs $0x802a88,%rax
+  802b8d:	00 00 00 
+  802b90:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  802b92:	48 c1 e8 06          	shr    $0x6,%rax
+  802b96:	83 e0 01             	and    $0x1,%eax
+}
+  802b99:	5d                   	pop    %rbp
+  802b9a:	c3                   	ret
+
+0000000000802b9b <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  802b9b:	55                   	push   %rbp
+  802b9c:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  802b9f:	48 b8 88 2a 80 00 00 	movabs $0x802a88,%rax
+  802ba6:	00 00 00 
+  802ba9:	ff d0                	call   *%rax
+  802bab:	83 e0 01             	and    $0x1,%eax
+}
+  802bae:	5d                   	pop    %rbp
+  802baf:	c3                   	ret
+
+0000000000802bb0 <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  802bb0:	55                   	push   %rbp
+  802bb1:	48 89 e5             	mov    %rsp,%rbp
+  802bb4:	41 57                	push   %r15
+  802bb6:	41 56                	push   %r14
+  802bb8:	41 55                	push   %r13
+  802bba:	41 54                	push   %r12
+  802bbc:	53                   	push   %rbx
+  802bbd:	48 83 ec 38          	sub    $0x38,%rsp
+  802bc1:	49 89 f7             	mov    %rsi,%r15
+  802bc4:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+                    }
+                    continue;
+                }
+                for (int ptei = 0; ptei < PT_ENTRY_COUNT; ptei++) {
+                    uintptr_t pte_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, pdei, ptei, 0);
+                    pte_t pte = uvpt[VPT(pte_addr)];
+  802bca:	49 bd 00 00 00 00 00 	movabs $0x10000000000,%r13
+  802bd1:	01 00 00 
+  802bd4:	4d 89 e6             	mov    %r12,%r14
+  802bd7:	49 89 fc             	mov    %rdi,%r12
+  802bda:	e9 19 01 00 00       	jmp    802cf8 <foreach_shared_region+0x148>
+  802bdf:	48 89 5d b0          	mov    %rbx,-0x50(%rbp)
+  802be3:	4c 89 75 a8          	mov    %r14,-0x58(%rbp)
+  802be7:	eb 52                	jmp    802c3b <foreach_shared_region+0x8b>
+                for (int ptei = 0; ptei < PT_ENTRY_COUNT; ptei++) {
+  802be9:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802bf0:	48 81 fb 00 00 20 00 	cmp    $0x200000,%rbx
+  802bf7:	74 2e                	je     802c27 <foreach_shared_region+0x77>
+                    uintptr_t pte_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, pdei, ptei, 0);
+  802bf9:	48 89 df             	mov    %rbx,%rdi
+  802bfc:	4c 09 f7             	or     %r14,%rdi
+                    pte_t pte = uvpt[VPT(pte_addr)];
+  802bff:	48 89 f8             	mov    %rdi,%rax
+  802c02:	48 c1 e8 0c          	shr    $0xc,%rax
+  802c06:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+                    if ((pte & PTE_P) && (pte & PTE_SHARE)) {
+  802c0b:	25 01 04 00 00       	and    $0x401,%eax
+  802c10:	48 3d 01 04 00 00    	cmp    $0x401,%rax
+  802c16:	75 d1                	jne    802be9 <foreach_shared_region+0x39>
+                        fun((void*)pte_addr, (void*)(pte_addr + PAGE_SIZE), arg);
+  802c18:	48 8d b7 00 10 00 00 	lea    0x1000(%rdi),%rsi
+  802c1f:	4c 89 fa             	mov    %r15,%rdx
+  802c22:	41 ff d4             	call   *%r12
+  802c25:	eb c2                	jmp    802be9 <foreach_shared_region+0x39>
+            for (int pdei = 0; pdei < PD_ENTRY_COUNT; pdei++) {
+  802c27:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  802c2e:	00 
+  802c2f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802c33:	48 3d 00 00 00 40    	cmp    $0x40000000,%rax
+  802c39:	74 46                	je     802c81 <foreach_shared_region+0xd1>
+                uintptr_t pde_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, pdei, 0, 0);
+  802c3b:	4c 8b 75 c8          	mov    -0x38(%rbp),%r14
+  802c3f:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802c43:	49 09 c6             	or     %rax,%r14
+                pde_t pde = uvpd[VPD(pde_addr)];
+  802c46:	4c 89 f0             	mov    %r14,%rax
+  802c49:	48 c1 e8 15          	shr    $0x15,%rax
+  802c4d:	48 b9 00 00 00 80 00 	movabs $0x10080000000,%rcx
+  802c54:	01 00 00 
+  802c57:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+                if (!(pde & PTE_P)) {
+  802c5b:	a8 01                	test   $0x1,%al
+  802c5d:	74 c8                	je     802c27 <foreach_shared_region+0x77>
+                if (pde & PTE_PS) {
+  802c5f:	48 89 c3             	mov    %rax,%rbx
+  802c62:	81 e3 80 00 00 00    	and    $0x80,%ebx
+  802c68:	74 8f                	je     802bf9 <foreach_shared_region+0x49>
+                    if (pde & PTE_SHARE) {
+  802c6a:	f6 c4 04             	test   $0x4,%ah
+  802c6d:	74 b8                	je     802c27 <foreach_shared_region+0x77>
+                        fun((void*)pde_addr, (void*)(pde_addr + 1024 * 1024 * 2), arg);
+  802c6f:	49 8d b6 00 00 20 00 	lea    0x200000(%r14),%rsi
+  802c76:	4c 89 fa             	mov    %r15,%rdx
+  802c79:	4c 89 f7             	mov    %r14,%rdi
+  802c7c:	41 ff d4             	call   *%r12
+  802c7f:	eb a6                	jmp    802c27 <foreach_shared_region+0x77>
+  802c81:	48 8b 5d b0          	mov    -0x50(%rbp),%rbx
+  802c85:	4c 8b 75 a8          	mov    -0x58(%rbp),%r14
+        for (int pdpei = 0; pdpei < PDP_ENTRY_COUNT; pdpei++) {
+  802c89:	48 81 c3 00 00 00 40 	add    $0x40000000,%rbx
+  802c90:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802c97:	00 00 00 
+  802c9a:	48 39 c3             	cmp    %rax,%rbx
+  802c9d:	74 4c                	je     802ceb <foreach_shared_region+0x13b>
+            uintptr_t pdpe_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, 0, 0, 0);
+  802c9f:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802ca3:	48 09 d8             	or     %rbx,%rax
+  802ca6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+            pdpe_t pdpe = uvpdp[VPDP(pdpe_addr)];
+  802caa:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802cae:	48 b9 00 00 40 80 00 	movabs $0x10080400000,%rcx
+  802cb5:	01 00 00 
+  802cb8:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+            if (!(pdpe & PTE_P)) {
+  802cbc:	a8 01                	test   $0x1,%al
+  802cbe:	74 c9                	je     802c89 <foreach_shared_region+0xd9>
+            if (pdpe & PTE_PS) {
+  802cc0:	48 89 c1             	mov    %rax,%rcx
+  802cc3:	81 e1 80 00 00 00    	and    $0x80,%ecx
+  802cc9:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  802ccd:	0f 84 0c ff ff ff    	je     802bdf <foreach_shared_region+0x2f>
+                if (pdpe & PTE_SHARE) {
+  802cd3:	f6 c4 04             	test   $0x4,%ah
+  802cd6:	74 b1                	je     802c89 <foreach_shared_region+0xd9>
+                    fun((void*)pdpe_addr, (void*)(pdpe_addr + 1024 * 1024 * 1024), arg); 
+  802cd8:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  802cdc:	48 8d b7 00 00 00 40 	lea    0x40000000(%rdi),%rsi
+  802ce3:	4c 89 fa             	mov    %r15,%rdx
+  802ce6:	41 ff d4             	call   *%r12
+  802ce9:	eb 9e                	jmp    802c89 <foreach_shared_region+0xd9>
+    for (int pml4ei = 0; pml4ei < PML4_ENTRY_COUNT; pml4ei++) {
+  802ceb:	49 83 c6 01          	add    $0x1,%r14
+  802cef:	49 81 fe 00 02 00 00 	cmp    $0x200,%r14
+  802cf6:	74 24                	je     802d1c <foreach_shared_region+0x16c>
+        pml4e_t pml4e = uvpml4[VPML4(pml4_addr)];
+  802cf8:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  802cff:	01 00 00 
+  802d02:	4a 8b 04 f0          	mov    (%rax,%r14,8),%rax
+        if (!(pml4e & PTE_P)) {
+  802d06:	a8 01                	test   $0x1,%al
+  802d08:	74 e1                	je     802ceb <foreach_shared_region+0x13b>
+  802d0a:	4c 89 f0             	mov    %r14,%rax
+  802d0d:	48 c1 e0 27          	shl    $0x27,%rax
+  802d11:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  802d15:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802d1a:	eb 83                	jmp    802c9f <foreach_shared_region+0xef>
+            }
+        }
+    }
+    
+    return 0;
+}
+  802d1c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d21:	48 83 c4 38          	add    $0x38,%rsp
+  802d25:	5b                   	pop    %rbx
+  802d26:	41 5c                	pop    %r12
+  802d28:	41 5d                	pop    %r13
+  802d2a:	41 5e                	pop    %r14
+  802d2c:	41 5f                	pop    %r15
+  802d2e:	5d                   	pop    %rbp
+  802d2f:	c3                   	ret
+
+0000000000802d30 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  802d30:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d35:	c3                   	ret
+
+0000000000802d36 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  802d36:	55                   	push   %rbp
+  802d37:	48 89 e5             	mov    %rsp,%rbp
+  802d3a:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  802d3d:	48 be 14 39 80 00 00 	movabs $0x803914,%rsi
+  802d44:	00 00 00 
+  802d47:	48 b8 b6 0e 80 00 00 	movabs $0x800eb6,%rax
+  802d4e:	00 00 00 
+  802d51:	ff d0                	call   *%rax
+    return 0;
+}
+  802d53:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d58:	5d                   	pop    %rbp
+  802d59:	c3                   	ret
+
+0000000000802d5a <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  802d5a:	55                   	push   %rbp
+  802d5b:	48 89 e5             	mov    %rsp,%rbp
+  802d5e:	41 57                	push   %r15
+  802d60:	41 56                	push   %r14
+  802d62:	41 55                	push   %r13
+  802d64:	41 54                	push   %r12
+  802d66:	53                   	push   %rbx
+  802d67:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  802d6e:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  802d75:	48 85 d2             	test   %rdx,%rdx
+  802d78:	74 7a                	je     802df4 <devcons_write+0x9a>
+  802d7a:	49 89 d6             	mov    %rdx,%r14
+  802d7d:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802d83:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  802d88:	49 bf b0 10 80 00 00 	movabs $0x8010b0,%r15
+  802d8f:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  802d92:	4c 89 f3             	mov    %r14,%rbx
+  802d95:	48 29 f3             	sub    %rsi,%rbx
+  802d98:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802d9d:	48 39 c3             	cmp    %rax,%rbx
+  802da0:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  802da4:	4c 63 eb             	movslq %ebx,%r13
+  802da7:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  802dae:	48 01 c6             	add    %rax,%rsi
+  802db1:	4c 89 ea             	mov    %r13,%rdx
+  802db4:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802dbb:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  802dbe:	4c 89 ee             	mov    %r13,%rsi
+  802dc1:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802dc8:	48 b8 dd 12 80 00 00 	movabs $0x8012dd,%rax
+  802dcf:	00 00 00 
+  802dd2:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  802dd4:	41 01 dc             	add    %ebx,%r12d
+  802dd7:	49 63 f4             	movslq %r12d,%rsi
+  802dda:	4c 39 f6             	cmp    %r14,%rsi
+  802ddd:	72 b3                	jb     802d92 <devcons_write+0x38>
+    return res;
+  802ddf:	49 63 c4             	movslq %r12d,%rax
+}
+  802de2:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  802de9:	5b                   	pop    %rbx
+  802dea:	41 5c                	pop    %r12
+  802dec:	41 5d                	pop    %r13
+  802dee:	41 5e                	pop    %r14
+  802df0:	41 5f                	pop    %r15
+  802df2:	5d                   	pop    %rbp
+  802df3:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  802df4:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802dfa:	eb e3                	jmp    802ddf <devcons_write+0x85>
+
+0000000000802dfc <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  802dfc:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  802dff:	ba 00 00 00 00       	mov    $0x0,%edx
+  802e04:	48 85 c0             	test   %rax,%rax
+  802e07:	74 55                	je     802e5e <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  802e09:	55                   	push   %rbp
+  802e0a:	48 89 e5             	mov    %rsp,%rbp
+  802e0d:	41 55                	push   %r13
+  802e0f:	41 54                	push   %r12
+  802e11:	53                   	push   %rbx
+  802e12:	48 83 ec 08          	sub    $0x8,%rsp
+  802e16:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  802e19:	48 bb 0a 13 80 00 00 	movabs $0x80130a,%rbx
+  802e20:	00 00 00 
+  802e23:	49 bc d7 13 80 00 00 	movabs $0x8013d7,%r12
+  802e2a:	00 00 00 
+  802e2d:	eb 03                	jmp    802e32 <devcons_read+0x36>
+  802e2f:	41 ff d4             	call   *%r12
+  802e32:	ff d3                	call   *%rbx
+  802e34:	85 c0                	test   %eax,%eax
+  802e36:	74 f7                	je     802e2f <devcons_read+0x33>
+    if (c < 0) return c;
+  802e38:	48 63 d0             	movslq %eax,%rdx
+  802e3b:	78 13                	js     802e50 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  802e3d:	ba 00 00 00 00       	mov    $0x0,%edx
+  802e42:	83 f8 04             	cmp    $0x4,%eax
+  802e45:	74 09                	je     802e50 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  802e47:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  802e4b:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  802e50:	48 89 d0             	mov    %rdx,%rax
+  802e53:	48 83 c4 08          	add    $0x8,%rsp
+  802e57:	5b                   	pop    %rbx
+  802e58:	41 5c                	pop    %r12
+  802e5a:	41 5d                	pop    %r13
+  802e5c:	5d                   	pop    %rbp
+  802e5d:	c3                   	ret
+  802e5e:	48 89 d0             	mov    %rdx,%rax
+  802e61:	c3                   	ret
+
+0000000000802e62 <cputchar>:
+cputchar(int ch) {
+  802e62:	55                   	push   %rbp
+  802e63:	48 89 e5             	mov    %rsp,%rbp
+  802e66:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  802e6a:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  802e6e:	be 01 00 00 00       	mov    $0x1,%esi
+  802e73:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  802e77:	48 b8 dd 12 80 00 00 	movabs $0x8012dd,%rax
+  802e7e:	00 00 00 
+  802e81:	ff d0                	call   *%rax
+}
+  802e83:	c9                   	leave
+  802e84:	c3                   	ret
+
+0000000000802e85 <getchar>:
+getchar(void) {
+  802e85:	55                   	push   %rbp
+  802e86:	48 89 e5             	mov    %rsp,%rbp
+  802e89:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  802e8d:	ba 01 00 00 00       	mov    $0x1,%edx
+  802e92:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  802e96:	bf 00 00 00 00       	mov    $0x0,%edi
+  802e9b:	48 b8 a9 1d 80 00 00 	movabs $0x801da9,%rax
+  802ea2:	00 00 00 
+  802ea5:	ff d0                	call   *%rax
+  802ea7:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  802ea9:	85 c0                	test   %eax,%eax
+  802eab:	78 06                	js     802eb3 <getchar+0x2e>
+  802ead:	74 08                	je     802eb7 <getchar+0x32>
+  802eaf:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  802eb3:	89 d0                	mov    %edx,%eax
+  802eb5:	c9                   	leave
+  802eb6:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  802eb7:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  802ebc:	eb f5                	jmp    802eb3 <getchar+0x2e>
+
+0000000000802ebe <iscons>:
+iscons(int fdnum) {
+  802ebe:	55                   	push   %rbp
+  802ebf:	48 89 e5             	mov    %rsp,%rbp
+  802ec2:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  802ec6:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802eca:	48 b8 c6 1a 80 00 00 	movabs $0x801ac6,%rax
+  802ed1:	00 00 00 
+  802ed4:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802ed6:	85 c0                	test   %eax,%eax
+  802ed8:	78 18                	js     802ef2 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  802eda:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802ede:	48 b8 a0 40 80 00 00 	movabs $0x8040a0,%rax
+  802ee5:	00 00 00 
+  802ee8:	8b 00                	mov    (%rax),%eax
+  802eea:	39 02                	cmp    %eax,(%rdx)
+  802eec:	0f 94 c0             	sete   %al
+  802eef:	0f b6 c0             	movzbl %al,%eax
+}
+  802ef2:	c9                   	leave
+  802ef3:	c3                   	ret
+
+0000000000802ef4 <opencons>:
+opencons(void) {
+  802ef4:	55                   	push   %rbp
+  802ef5:	48 89 e5             	mov    %rsp,%rbp
+  802ef8:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802efc:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  802f00:	48 b8 ac 1a 80 00 00 	movabs $0x801aac,%rax
+  802f07:	00 00 00 
+  802f0a:	ff d0                	call   *%rax
+  802f0c:	85 c0                	test   %eax,%eax
+  802f0e:	78 49                	js     802f59 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  802f10:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802f15:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802f1a:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  802f1e:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f23:	48 b8 66 14 80 00 00 	movabs $0x801466,%rax
+  802f2a:	00 00 00 
+  802f2d:	ff d0                	call   *%rax
+  802f2f:	85 c0                	test   %eax,%eax
+  802f31:	78 26                	js     802f59 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  802f33:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802f37:	a1 a0 40 80 00 00 00 	movabs 0x8040a0,%eax
+  802f3e:	00 00 
+  802f40:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  802f42:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802f46:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  802f4d:	48 b8 05 1a 80 00 00 	movabs $0x801a05,%rax
+  802f54:	00 00 00 
+  802f57:	ff d0                	call   *%rax
+}
+  802f59:	c9                   	leave
+  802f5a:	c3                   	ret
+
+0000000000802f5b <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  802f5b:	55                   	push   %rbp
+  802f5c:	48 89 e5             	mov    %rsp,%rbp
+  802f5f:	41 55                	push   %r13
+  802f61:	41 54                	push   %r12
+  802f63:	53                   	push   %rbx
+  802f64:	48 83 ec 08          	sub    $0x8,%rsp
+  802f68:	49 89 fc             	mov    %rdi,%r12
+  802f6b:	48 89 f7             	mov    %rsi,%rdi
+  802f6e:	48 89 d3             	mov    %rdx,%rbx
+  802f71:	49 89 cd             	mov    %rcx,%r13
+    // LAB 9: Your code here:
+    int res = sys_ipc_recv(!pg ? (void*)MAX_USER_ADDRESS : pg, !size ? 0 : *size);
+  802f74:	be 00 00 00 00       	mov    $0x0,%esi
+  802f79:	48 85 d2             	test   %rdx,%rdx
+  802f7c:	74 03                	je     802f81 <ipc_recv+0x26>
+  802f7e:	48 8b 32             	mov    (%rdx),%rsi
+  802f81:	48 85 ff             	test   %rdi,%rdi
+  802f84:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802f8b:	00 00 00 
+  802f8e:	48 0f 44 f8          	cmove  %rax,%rdi
+  802f92:	48 b8 38 18 80 00 00 	movabs $0x801838,%rax
+  802f99:	00 00 00 
+  802f9c:	ff d0                	call   *%rax
+    if (res < 0) {
+  802f9e:	85 c0                	test   %eax,%eax
+  802fa0:	78 66                	js     803008 <ipc_recv+0xad>
+        if (size) {
+            *size = 0;
+        }
+        return res;
+    }
+    if (from_env_store) {
+  802fa2:	4d 85 e4             	test   %r12,%r12
+  802fa5:	74 14                	je     802fbb <ipc_recv+0x60>
+        *from_env_store = thisenv->env_ipc_from;
+  802fa7:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802fae:	00 00 00 
+  802fb1:	8b 80 ac 01 00 00    	mov    0x1ac(%rax),%eax
+  802fb7:	41 89 04 24          	mov    %eax,(%r12)
+    }
+    if (perm_store) {
+  802fbb:	4d 85 ed             	test   %r13,%r13
+  802fbe:	74 14                	je     802fd4 <ipc_recv+0x79>
+        *perm_store = thisenv->env_ipc_perm;
+  802fc0:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802fc7:	00 00 00 
+  802fca:	8b 80 b0 01 00 00    	mov    0x1b0(%rax),%eax
+  802fd0:	41 89 45 00          	mov    %eax,0x0(%r13)
+    }
+    if (size) {
+  802fd4:	48 85 db             	test   %rbx,%rbx
+  802fd7:	74 14                	je     802fed <ipc_recv+0x92>
+        *size = thisenv->env_ipc_maxsz;
+  802fd9:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802fe0:	00 00 00 
+  802fe3:	48 8b 80 a0 01 00 00 	mov    0x1a0(%rax),%rax
+  802fea:	48 89 03             	mov    %rax,(%rbx)
+    }
+    return thisenv->env_ipc_value;
+  802fed:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802ff4:	00 00 00 
+  802ff7:	8b 80 a8 01 00 00    	mov    0x1a8(%rax),%eax
+}
+  802ffd:	48 83 c4 08          	add    $0x8,%rsp
+  803001:	5b                   	pop    %rbx
+  803002:	41 5c                	pop    %r12
+  803004:	41 5d                	pop    %r13
+  803006:	5d                   	pop    %rbp
+  803007:	c3                   	ret
+        if (from_env_store) {
+  803008:	4d 85 e4             	test   %r12,%r12
+  80300b:	74 08                	je     803015 <ipc_recv+0xba>
+            *from_env_store = 0;
+  80300d:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  803014:	00 
+        if (perm_store) {
+  803015:	4d 85 ed             	test   %r13,%r13
+  803018:	74 08                	je     803022 <ipc_recv+0xc7>
+            *perm_store = 0;
+  80301a:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  803021:	00 
+        if (size) {
+  803022:	48 85 db             	test   %rbx,%rbx
+  803025:	74 d6                	je     802ffd <ipc_recv+0xa2>
+            *size = 0;
+  803027:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  80302e:	eb cd                	jmp    802ffd <ipc_recv+0xa2>
+
+0000000000803030 <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  803030:	55                   	push   %rbp
+  803031:	48 89 e5             	mov    %rsp,%rbp
+  803034:	41 57                	push   %r15
+  803036:	41 56                	push   %r14
+  803038:	41 55                	push   %r13
+  80303a:	41 54                	push   %r12
+  80303c:	53                   	push   %rbx
+  80303d:	48 83 ec 18          	sub    $0x18,%rsp
+  803041:	41 89 fd             	mov    %edi,%r13d
+  803044:	89 75 cc             	mov    %esi,-0x34(%rbp)
+  803047:	49 89 cc             	mov    %rcx,%r12
+  80304a:	44 89 45 c8          	mov    %r8d,-0x38(%rbp)
+    // LAB 9: Your code here:
+    int res = 0;
+    while ((res = sys_ipc_try_send(to_env, val, !pg ? (void*)MAX_USER_ADDRESS : pg, size, perm)) < 0) {
+  80304e:	48 85 d2             	test   %rdx,%rdx
+  803051:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803058:	00 00 00 
+  80305b:	48 0f 45 c2          	cmovne %rdx,%rax
+  80305f:	48 89 c3             	mov    %rax,%rbx
+  803062:	49 be 0c 18 80 00 00 	movabs $0x80180c,%r14
+  803069:	00 00 00 
+        if (res != -E_IPC_NOT_RECV) {
+            panic("sys_ipc_try_send failed: %i", res);
+        }
+        sys_yield();
+  80306c:	49 bf d7 13 80 00 00 	movabs $0x8013d7,%r15
+  803073:	00 00 00 
+    while ((res = sys_ipc_try_send(to_env, val, !pg ? (void*)MAX_USER_ADDRESS : pg, size, perm)) < 0) {
+  803076:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  803079:	44 8b 45 c8          	mov    -0x38(%rbp),%r8d
+  80307d:	4c 89 e1             	mov    %r12,%rcx
+  803080:	48 89 da             	mov    %rbx,%rdx
+  803083:	44 89 ef             	mov    %r13d,%edi
+  803086:	41 ff d6             	call   *%r14
+  803089:	85 c0                	test   %eax,%eax
+  80308b:	79 37                	jns    8030c4 <ipc_send+0x94>
+        if (res != -E_IPC_NOT_RECV) {
+  80308d:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  803090:	75 05                	jne    803097 <ipc_send+0x67>
+        sys_yield();
+  803092:	41 ff d7             	call   *%r15
+  803095:	eb df                	jmp    803076 <ipc_send+0x46>
+            panic("sys_ipc_try_send failed: %i", res);
+  803097:	89 c1                	mov    %eax,%ecx
+  803099:	48 ba 20 39 80 00 00 	movabs $0x803920,%rdx
+  8030a0:	00 00 00 
+  8030a3:	be 40 00 00 00       	mov    $0x40,%esi
+  8030a8:	48 bf 3c 39 80 00 00 	movabs $0x80393c,%rdi
+  8030af:	00 00 00 
+  8030b2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8030b7:	49 b8 41 04 80 00 00 	movabs $0x800441,%r8
+  8030be:	00 00 00 
+  8030c1:	41 ff d0             	call   *%r8
+    }
+    return;
+}
+  8030c4:	48 83 c4 18          	add    $0x18,%rsp
+  8030c8:	5b                   	pop    %rbx
+  8030c9:	41 5c                	pop    %r12
+  8030cb:	41 5d                	pop    %r13
+  8030cd:	41 5e                	pop    %r14
+  8030cf:	41 5f                	pop    %r15
+  8030d1:	5d                   	pop    %rbp
+  8030d2:	c3                   	ret
+
+00000000008030d3 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  8030d3:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  8030d8:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  8030df:	00 00 00 
+  8030e2:	48 69 d0 d0 01 00 00 	imul   $0x1d0,%rax,%rdx
+  8030e9:	48 01 ca             	add    %rcx,%rdx
+  8030ec:	8b 92 e8 00 00 00    	mov    0xe8(%rdx),%edx
+  8030f2:	39 fa                	cmp    %edi,%edx
+  8030f4:	74 12                	je     803108 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  8030f6:	48 83 c0 01          	add    $0x1,%rax
+  8030fa:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  803100:	75 e0                	jne    8030e2 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  803102:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803107:	c3                   	ret
+            return envs[i].env_id;
+  803108:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+  80310f:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  803116:	00 00 00 
+  803119:	48 01 d0             	add    %rdx,%rax
+  80311c:	8b 80 e0 00 00 00    	mov    0xe0(%rax),%eax
+  803122:	c3                   	ret
+  803123:	0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+
+0000000000803128 <__rodata_start>:
+  803128:	20 53 48             	and    %dl,0x48(%rbx)
+  80312b:	41 52                	push   %r10
+  80312d:	45 00 20             	add    %r12b,(%r8)
+  803130:	43                   	rex.XB
+  803131:	4f 57                	rex.WRXB push %r15
+  803133:	00 45 49             	add    %al,0x49(%rbp)
+  803136:	44 3a 20             	cmp    (%rax),%r12b
+  803139:	25 64 2c 20 50       	and    $0x50202c64,%eax
+  80313e:	45                   	rex.RB
+  80313f:	49                   	rex.WB
+  803140:	44 3a 20             	cmp    (%rax),%r12b
+  803143:	25 64 0a 00 4d       	and    $0x4d000a64,%eax
+  803148:	65 6d                	gs insl (%dx),%es:(%rdi)
+  80314a:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80314b:	72 79                	jb     8031c6 <__rodata_start+0x9e>
+  80314d:	20 75 73             	and    %dh,0x73(%rbp)
+  803150:	61                   	(bad)
+  803151:	67 65 20 73 75       	and    %dh,%gs:0x75(%ebx)
+  803156:	6d                   	insl   (%dx),%es:(%rdi)
+  803157:	6d                   	insl   (%dx),%es:(%rdi)
+  803158:	61                   	(bad)
+  803159:	72 79                	jb     8031d4 <__rodata_start+0xac>
+  80315b:	3a 0a                	cmp    (%rdx),%cl
+  80315d:	00 20                	add    %ah,(%rax)
+  80315f:	20 50 54             	and    %dl,0x54(%rax)
+  803162:	45 5f                	rex.RB pop %r15
+  803164:	50                   	push   %rax
+  803165:	3a 20                	cmp    (%rax),%ah
+  803167:	25 6c 75 0a 00       	and    $0xa756c,%eax
+  80316c:	20 20                	and    %ah,(%rax)
+  80316e:	50                   	push   %rax
+  80316f:	54                   	push   %rsp
+  803170:	45 5f                	rex.RB pop %r15
+  803172:	55                   	push   %rbp
+  803173:	3a 20                	cmp    (%rax),%ah
+  803175:	25 6c 75 0a 00       	and    $0xa756c,%eax
+  80317a:	20 20                	and    %ah,(%rax)
+  80317c:	50                   	push   %rax
+  80317d:	54                   	push   %rsp
+  80317e:	45 5f                	rex.RB pop %r15
+  803180:	57                   	push   %rdi
+  803181:	3a 20                	cmp    (%rax),%ah
+  803183:	25 6c 75 0a 00       	and    $0xa756c,%eax
+  803188:	20 20                	and    %ah,(%rax)
+  80318a:	50                   	push   %rax
+  80318b:	54                   	push   %rsp
+  80318c:	45 5f                	rex.RB pop %r15
+  80318e:	43                   	rex.XB
+  80318f:	4f 57                	rex.WRXB push %r15
+  803191:	3a 20                	cmp    (%rax),%ah
+  803193:	25 6c 75 0a 00       	and    $0xa756c,%eax
+  803198:	70 69                	jo     803203 <__rodata_start+0xdb>
+  80319a:	70 65                	jo     803201 <__rodata_start+0xd9>
+  80319c:	28 29                	sub    %ch,(%rcx)
+  80319e:	20 66 61             	and    %ah,0x61(%rsi)
+  8031a1:	69 6c 65 64 0a 00 75 	imul   $0x7375000a,0x64(%rbp,%riz,2),%ebp
+  8031a8:	73 
+  8031a9:	65 72 2f             	gs jb  8031db <__rodata_start+0xb3>
+  8031ac:	6d                   	insl   (%dx),%es:(%rdi)
+  8031ad:	65 6d                	gs insl (%dx),%es:(%rdi)
+  8031af:	6c                   	insb   (%dx),%es:(%rdi)
+  8031b0:	61                   	(bad)
+  8031b1:	79 6f                	jns    803222 <__rodata_start+0xfa>
+  8031b3:	75 74                	jne    803229 <__rodata_start+0x101>
+  8031b5:	2e 63 00             	cs movsxd (%rax),%eax
+  8031b8:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  8031ba:	72 6b                	jb     803227 <__rodata_start+0xff>
+  8031bc:	28 29                	sub    %ch,(%rcx)
+  8031be:	20 66 61             	and    %ah,0x61(%rsi)
+  8031c1:	69 6c 65 64 0a 00 3d 	imul   $0x3d3d000a,0x64(%rbp,%riz,2),%ebp
+  8031c8:	3d 
+  8031c9:	3d 3d 20 43 68       	cmp    $0x6843203d,%eax
+  8031ce:	69 6c 64 0a 00 3d 3d 	imul   $0x3d3d3d00,0xa(%rsp,%riz,2),%ebp
+  8031d5:	3d 
+  8031d6:	3d 20 50 61 72       	cmp    $0x72615020,%eax
+  8031db:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  8031dd:	74 0a                	je     8031e9 <__rodata_start+0xc1>
+  8031df:	00 70 6d             	add    %dh,0x6d(%rax)
+  8031e2:	6c                   	insb   (%dx),%es:(%rdi)
+  8031e3:	34 3d                	xor    $0x3d,%al
+  8031e5:	25 70 20 75 76       	and    $0x76752070,%eax
+  8031ea:	70 6d                	jo     803259 <__rodata_start+0x131>
+  8031ec:	6c                   	insb   (%dx),%es:(%rdi)
+  8031ed:	34 3d                	xor    $0x3d,%al
+  8031ef:	25 70 20 75 76       	and    $0x76752070,%eax
+  8031f4:	70 64                	jo     80325a <__rodata_start+0x132>
+  8031f6:	70 3d                	jo     803235 <__rodata_start+0x10d>
+  8031f8:	25 70 20 75 76       	and    $0x76752070,%eax
+  8031fd:	70 64                	jo     803263 <__rodata_start+0x13b>
+  8031ff:	3d 25 70 20 75       	cmp    $0x75207025,%eax
+  803204:	76 70                	jbe    803276 <__rodata_start+0x14e>
+  803206:	74 3d                	je     803245 <__rodata_start+0x11d>
+  803208:	25 70 0a 00 00       	and    $0xa70,%eax
+  80320d:	00 00                	add    %al,(%rax)
+  80320f:	00 5b 25             	add    %bl,0x25(%rbx)
+  803212:	70 5d                	jo     803271 <__rodata_start+0x149>
+  803214:	20 25 6c 78 20 2d    	and    %ah,0x2d20786c(%rip)        # 2da0aa86 <__bss_end+0x2d202a86>
+  80321a:	3e 20 25 30 38 6c 78 	ds and %ah,0x786c3830(%rip)        # 78ec6a51 <__bss_end+0x786bea51>
+  803221:	3a 20                	cmp    (%rax),%ah
+  803223:	25 63 20 25 63       	and    $0x63252063,%eax
+  803228:	20 25 63 20 7c 25    	and    %ah,0x257c2063(%rip)        # 25fc5291 <__bss_end+0x257bd291>
+  80322e:	73 25                	jae    803255 <__rodata_start+0x12d>
+  803230:	73 0a                	jae    80323c <__rodata_start+0x114>
+  803232:	00 3c 75 6e 6b 6e 6f 	add    %bh,0x6f6e6b6e(,%rsi,2)
+  803239:	77 6e                	ja     8032a9 <__rodata_start+0x181>
+  80323b:	3e 00 0f             	ds add %cl,(%rdi)
+  80323e:	1f                   	(bad)
+  80323f:	00 5b 25             	add    %bl,0x25(%rbx)
+  803242:	30 38                	xor    %bh,(%rax)
+  803244:	78 5d                	js     8032a3 <__rodata_start+0x17b>
+  803246:	20 75 73             	and    %dh,0x73(%rbp)
+  803249:	65 72 20             	gs jb  80326c <__rodata_start+0x144>
+  80324c:	70 61                	jo     8032af <__rodata_start+0x187>
+  80324e:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80324f:	69 63 20 69 6e 20 25 	imul   $0x25206e69,0x20(%rbx),%esp
+  803256:	73 20                	jae    803278 <__rodata_start+0x150>
+  803258:	61                   	(bad)
+  803259:	74 20                	je     80327b <__rodata_start+0x153>
+  80325b:	25 73 3a 25 64       	and    $0x64253a73,%eax
+  803260:	3a 20                	cmp    (%rax),%ah
+  803262:	00 30                	add    %dh,(%rax)
+  803264:	31 32                	xor    %esi,(%rdx)
+  803266:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  80326d:	41                   	rex.B
+  80326e:	42                   	rex.X
+  80326f:	43                   	rex.XB
+  803270:	44                   	rex.R
+  803271:	45                   	rex.RB
+  803272:	46 00 30             	rex.RX add %r14b,(%rax)
+  803275:	31 32                	xor    %esi,(%rdx)
+  803277:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  80327e:	61                   	(bad)
+  80327f:	62 63 64 65 66       	(bad)
+  803284:	00 28                	add    %ch,(%rax)
+  803286:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803287:	75 6c                	jne    8032f5 <__rodata_start+0x1cd>
+  803289:	6c                   	insb   (%dx),%es:(%rdi)
+  80328a:	29 00                	sub    %eax,(%rax)
+  80328c:	65 72 72             	gs jb  803301 <__rodata_start+0x1d9>
+  80328f:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803290:	72 20                	jb     8032b2 <__rodata_start+0x18a>
+  803292:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  803297:	73 70                	jae    803309 <__rodata_start+0x1e1>
+  803299:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  80329d:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  8032a4:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8032a5:	72 00                	jb     8032a7 <__rodata_start+0x17f>
+  8032a7:	62 61 64 20 65       	(bad)
+  8032ac:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8032ad:	76 69                	jbe    803318 <__rodata_start+0x1f0>
+  8032af:	72 6f                	jb     803320 <__rodata_start+0x1f8>
+  8032b1:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8032b2:	6d                   	insl   (%dx),%es:(%rdi)
+  8032b3:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  8032b5:	74 00                	je     8032b7 <__rodata_start+0x18f>
+  8032b7:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  8032be:	20 70 61             	and    %dh,0x61(%rax)
+  8032c1:	72 61                	jb     803324 <__rodata_start+0x1fc>
+  8032c3:	6d                   	insl   (%dx),%es:(%rdi)
+  8032c4:	65 74 65             	gs je  80332c <__rodata_start+0x204>
+  8032c7:	72 00                	jb     8032c9 <__rodata_start+0x1a1>
+  8032c9:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8032ca:	75 74                	jne    803340 <__rodata_start+0x218>
+  8032cc:	20 6f 66             	and    %ch,0x66(%rdi)
+  8032cf:	20 6d 65             	and    %ch,0x65(%rbp)
+  8032d2:	6d                   	insl   (%dx),%es:(%rdi)
+  8032d3:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8032d4:	72 79                	jb     80334f <__rodata_start+0x227>
+  8032d6:	00 6f 75             	add    %ch,0x75(%rdi)
+  8032d9:	74 20                	je     8032fb <__rodata_start+0x1d3>
+  8032db:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8032dc:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  8032e0:	76 69                	jbe    80334b <__rodata_start+0x223>
+  8032e2:	72 6f                	jb     803353 <__rodata_start+0x22b>
+  8032e4:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8032e5:	6d                   	insl   (%dx),%es:(%rdi)
+  8032e6:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  8032e8:	74 73                	je     80335d <__rodata_start+0x235>
+  8032ea:	00 63 6f             	add    %ah,0x6f(%rbx)
+  8032ed:	72 72                	jb     803361 <__rodata_start+0x239>
+  8032ef:	75 70                	jne    803361 <__rodata_start+0x239>
+  8032f1:	74 65                	je     803358 <__rodata_start+0x230>
+  8032f3:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  8032f8:	75 67                	jne    803361 <__rodata_start+0x239>
+  8032fa:	20 69 6e             	and    %ch,0x6e(%rcx)
+  8032fd:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  8032ff:	00 73 65             	add    %dh,0x65(%rbx)
+  803302:	67 6d                	insl   (%dx),%es:(%edi)
+  803304:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803306:	74 61                	je     803369 <__rodata_start+0x241>
+  803308:	74 69                	je     803373 <__rodata_start+0x24b>
+  80330a:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80330b:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80330c:	20 66 61             	and    %ah,0x61(%rsi)
+  80330f:	75 6c                	jne    80337d <__rodata_start+0x255>
+  803311:	74 00                	je     803313 <__rodata_start+0x1eb>
+  803313:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  80331a:	20 45 4c             	and    %al,0x4c(%rbp)
+  80331d:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  803321:	61                   	(bad)
+  803322:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  803327:	20 73 75             	and    %dh,0x75(%rbx)
+  80332a:	63 68 20             	movsxd 0x20(%rax),%ebp
+  80332d:	73 79                	jae    8033a8 <__rodata_start+0x280>
+  80332f:	73 74                	jae    8033a5 <__rodata_start+0x27d>
+  803331:	65 6d                	gs insl (%dx),%es:(%rdi)
+  803333:	20 63 61             	and    %ah,0x61(%rbx)
+  803336:	6c                   	insb   (%dx),%es:(%rdi)
+  803337:	6c                   	insb   (%dx),%es:(%rdi)
+  803338:	00 65 6e             	add    %ah,0x6e(%rbp)
+  80333b:	74 72                	je     8033af <__rodata_start+0x287>
+  80333d:	79 20                	jns    80335f <__rodata_start+0x237>
+  80333f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803340:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803341:	74 20                	je     803363 <__rodata_start+0x23b>
+  803343:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  803345:	75 6e                	jne    8033b5 <__rodata_start+0x28d>
+  803347:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  80334b:	76 20                	jbe    80336d <__rodata_start+0x245>
+  80334d:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  803354:	72 65                	jb     8033bb <__rodata_start+0x293>
+  803356:	63 76 69             	movsxd 0x69(%rsi),%esi
+  803359:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80335a:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  80335e:	65 78 70             	gs js  8033d1 <__rodata_start+0x2a9>
+  803361:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  803366:	20 65 6e             	and    %ah,0x6e(%rbp)
+  803369:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  80336d:	20 66 69             	and    %ah,0x69(%rsi)
+  803370:	6c                   	insb   (%dx),%es:(%rdi)
+  803371:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  803375:	20 66 72             	and    %ah,0x72(%rsi)
+  803378:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  80337d:	61                   	(bad)
+  80337e:	63 65 20             	movsxd 0x20(%rbp),%esp
+  803381:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803382:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803383:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  803387:	6b 00 74             	imul   $0x74,(%rax),%eax
+  80338a:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80338b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80338c:	20 6d 61             	and    %ch,0x61(%rbp)
+  80338f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803390:	79 20                	jns    8033b2 <__rodata_start+0x28a>
+  803392:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  803399:	72 65                	jb     803400 <__rodata_start+0x2d8>
+  80339b:	20 6f 70             	and    %ch,0x70(%rdi)
+  80339e:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  8033a0:	00 66 69             	add    %ah,0x69(%rsi)
+  8033a3:	6c                   	insb   (%dx),%es:(%rdi)
+  8033a4:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  8033a8:	20 62 6c             	and    %ah,0x6c(%rdx)
+  8033ab:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8033ac:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  8033af:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8033b0:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8033b1:	74 20                	je     8033d3 <__rodata_start+0x2ab>
+  8033b3:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  8033b5:	75 6e                	jne    803425 <__rodata_start+0x2fd>
+  8033b7:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  8033bb:	76 61                	jbe    80341e <__rodata_start+0x2f6>
+  8033bd:	6c                   	insb   (%dx),%es:(%rdi)
+  8033be:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  8033c5:	00 
+  8033c6:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  8033cd:	72 65                	jb     803434 <__rodata_start+0x30c>
+  8033cf:	61                   	(bad)
+  8033d0:	64 79 20             	fs jns 8033f3 <__rodata_start+0x2cb>
+  8033d3:	65 78 69             	gs js  80343f <__rodata_start+0x317>
+  8033d6:	73 74                	jae    80344c <__rodata_start+0x324>
+  8033d8:	73 00                	jae    8033da <__rodata_start+0x2b2>
+  8033da:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8033db:	70 65                	jo     803442 <__rodata_start+0x31a>
+  8033dd:	72 61                	jb     803440 <__rodata_start+0x318>
+  8033df:	74 69                	je     80344a <__rodata_start+0x322>
+  8033e1:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8033e2:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8033e3:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  8033e6:	74 20                	je     803408 <__rodata_start+0x2e0>
+  8033e8:	73 75                	jae    80345f <__rodata_start+0x337>
+  8033ea:	70 70                	jo     80345c <__rodata_start+0x334>
+  8033ec:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8033ed:	72 74                	jb     803463 <__rodata_start+0x33b>
+  8033ef:	65 64 00 6f 70       	gs add %ch,%fs:0x70(%rdi)
+  8033f4:	65 72 61             	gs jb  803458 <__rodata_start+0x330>
+  8033f7:	74 69                	je     803462 <__rodata_start+0x33a>
+  8033f9:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8033fa:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8033fb:	20 69 6e             	and    %ch,0x6e(%rcx)
+  8033fe:	74 65                	je     803465 <__rodata_start+0x33d>
+  803400:	72 72                	jb     803474 <__rodata_start+0x34c>
+  803402:	75 70                	jne    803474 <__rodata_start+0x34c>
+  803404:	74 65                	je     80346b <__rodata_start+0x343>
+  803406:	64 00 6e 6f          	add    %ch,%fs:0x6f(%rsi)
+  80340a:	74 20                	je     80342c <__rodata_start+0x304>
+  80340c:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  80340e:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80340f:	75 67                	jne    803478 <__rodata_start+0x350>
+  803411:	68 20 43 50 55       	push   $0x55504320
+  803416:	20 74 69 6d          	and    %dh,0x6d(%rcx,%rbp,2)
+  80341a:	65 00 0f             	add    %cl,%gs:(%rdi)
+  80341d:	1f                   	(bad)
+  80341e:	40 00 7e 07          	add    %dil,0x7(%rsi)
+  803422:	80 00 00             	addb   $0x0,(%rax)
+  803425:	00 00                	add    %al,(%rax)
+  803427:	00 bf 0d 80 00 00    	add    %bh,0x800d(%rdi)
+  80342d:	00 00                	add    %al,(%rax)
+  80342f:	00 af 0d 80 00 00    	add    %ch,0x800d(%rdi)
+  803435:	00 00                	add    %al,(%rax)
+  803437:	00 bf 0d 80 00 00    	add    %bh,0x800d(%rdi)
+  80343d:	00 00                	add    %al,(%rax)
+  80343f:	00 bf 0d 80 00 00    	add    %bh,0x800d(%rdi)
+  803445:	00 00                	add    %al,(%rax)
+  803447:	00 bf 0d 80 00 00    	add    %bh,0x800d(%rdi)
+  80344d:	00 00                	add    %al,(%rax)
+  80344f:	00 bf 0d 80 00 00    	add    %bh,0x800d(%rdi)
+  803455:	00 00                	add    %al,(%rax)
+  803457:	00 9d 07 80 00 00    	add    %bl,0x8007(%rbp)
+  80345d:	00 00                	add    %al,(%rax)
+  80345f:	00 bf 0d 80 00 00    	add    %bh,0x800d(%rdi)
+  803465:	00 00                	add    %al,(%rax)
+  803467:	00 bf 0d 80 00 00    	add    %bh,0x800d(%rdi)
+  80346d:	00 00                	add    %al,(%rax)
+  80346f:	00 91 07 80 00 00    	add    %dl,0x8007(%rcx)
+  803475:	00 00                	add    %al,(%rax)
+  803477:	00 0b                	add    %cl,(%rbx)
+  803479:	08 80 00 00 00 00    	or     %al,0x0(%rax)
+  80347f:	00 bf 0d 80 00 00    	add    %bh,0x800d(%rdi)
+  803485:	00 00                	add    %al,(%rax)
+  803487:	00 91 07 80 00 00    	add    %dl,0x8007(%rcx)
+  80348d:	00 00                	add    %al,(%rax)
+  80348f:	00 d7                	add    %dl,%bh
+  803491:	07                   	(bad)
+  803492:	80 00 00             	addb   $0x0,(%rax)
+  803495:	00 00                	add    %al,(%rax)
+  803497:	00 d7                	add    %dl,%bh
+  803499:	07                   	(bad)
+  80349a:	80 00 00             	addb   $0x0,(%rax)
+  80349d:	00 00                	add    %al,(%rax)
+  80349f:	00 d7                	add    %dl,%bh
+  8034a1:	07                   	(bad)
+  8034a2:	80 00 00             	addb   $0x0,(%rax)
+  8034a5:	00 00                	add    %al,(%rax)
+  8034a7:	00 d7                	add    %dl,%bh
+  8034a9:	07                   	(bad)
+  8034aa:	80 00 00             	addb   $0x0,(%rax)
+  8034ad:	00 00                	add    %al,(%rax)
+  8034af:	00 d7                	add    %dl,%bh
+  8034b1:	07                   	(bad)
+  8034b2:	80 00 00             	addb   $0x0,(%rax)
+  8034b5:	00 00                	add    %al,(%rax)
+  8034b7:	00 d7                	add    %dl,%bh
+  8034b9:	07                   	(bad)
+  8034ba:	80 00 00             	addb   $0x0,(%rax)
+  8034bd:	00 00                	add    %al,(%rax)
+  8034bf:	00 d7                	add    %dl,%bh
+  8034c1:	07                   	(bad)
+  8034c2:	80 00 00             	addb   $0x0,(%rax)
+  8034c5:	00 00                	add    %al,(%rax)
+  8034c7:	00 d7                	add    %dl,%bh
+  8034c9:	07                   	(bad)
+  8034ca:	80 00 00             	addb   $0x0,(%rax)
+  8034cd:	00 00                	add    %al,(%rax)
+  8034cf:	00 d7                	add    %dl,%bh
+  8034d1:	07                   	(bad)
+  8034d2:	80 00 00             	addb   $0x0,(%rax)
+  8034d5:	00 00                	add    %al,(%rax)
+  8034d7:	00 bf 0d 80 00 00    	add    %bh,0x800d(%rdi)
+  8034dd:	00 00                	add    %al,(%rax)
+  8034df:	00 bf 0d 80 00 00    	add    %bh,0x800d(%rdi)
+  8034e5:	00 00                	add    %al,(%rax)
+  8034e7:	00 bf 0d 80 00 00    	add    %bh,0x800d(%rdi)
+  8034ed:	00 00                	add    %al,(%rax)
+  8034ef:	00 bf 0d 80 00 00    	add    %bh,0x800d(%rdi)
+  8034f5:	00 00                	add    %al,(%rax)
+  8034f7:	00 bf 0d 80 00 00    	add    %bh,0x800d(%rdi)
+  8034fd:	00 00                	add    %al,(%rax)
+  8034ff:	00 bf 0d 80 00 00    	add    %bh,0x800d(%rdi)
+  803505:	00 00                	add    %al,(%rax)
+  803507:	00 bf 0d 80 00 00    	add    %bh,0x800d(%rdi)
+  80350d:	00 00                	add    %al,(%rax)
+  80350f:	00 bf 0d 80 00 00    	add    %bh,0x800d(%rdi)
+  803515:	00 00                	add    %al,(%rax)
+  803517:	00 bf 0d 80 00 00    	add    %bh,0x800d(%rdi)
+  80351d:	00 00                	add    %al,(%rax)
+  80351f:	00 bf 0d 80 00 00    	add    %bh,0x800d(%rdi)
+  803525:	00 00                	add    %al,(%rax)
+  803527:	00 bf 0d 80 00 00    	add    %bh,0x800d(%rdi)
+  80352d:	00 00                	add    %al,(%rax)
+  80352f:	00 bf 0d 80 00 00    	add    %bh,0x800d(%rdi)
+  803535:	00 00                	add    %al,(%rax)
+  803537:	00 bf 0d 80 00 00    	add    %bh,0x800d(%rdi)
+  80353d:	00 00                	add    %al,(%rax)
+  80353f:	00 bf 0d 80 00 00    	add    %bh,0x800d(%rdi)
+  803545:	00 00                	add    %al,(%rax)
+  803547:	00 bf 0d 80 00 00    	add    %bh,0x800d(%rdi)
+  80354d:	00 00                	add    %al,(%rax)
+  80354f:	00 bf 0d 80 00 00    	add    %bh,0x800d(%rdi)
+  803555:	00 00                	add    %al,(%rax)
+  803557:	00 bf 0d 80 00 00    	add    %bh,0x800d(%rdi)
+  80355d:	00 00                	add    %al,(%rax)
+  80355f:	00 bf 0d 80 00 00    	add    %bh,0x800d(%rdi)
+  803565:	00 00                	add    %al,(%rax)
+  803567:	00 bf 0d 80 00 00    	add    %bh,0x800d(%rdi)
+  80356d:	00 00                	add    %al,(%rax)
+  80356f:	00 bf 0d 80 00 00    	add    %bh,0x800d(%rdi)
+  803575:	00 00                	add    %al,(%rax)
+  803577:	00 bf 0d 80 00 00    	add    %bh,0x800d(%rdi)
+  80357d:	00 00                	add    %al,(%rax)
+  80357f:	00 bf 0d 80 00 00    	add    %bh,0x800d(%rdi)
+  803585:	00 00                	add    %al,(%rax)
+  803587:	00 bf 0d 80 00 00    	add    %bh,0x800d(%rdi)
+  80358d:	00 00                	add    %al,(%rax)
+  80358f:	00 bf 0d 80 00 00    	add    %bh,0x800d(%rdi)
+  803595:	00 00                	add    %al,(%rax)
+  803597:	00 bf 0d 80 00 00    	add    %bh,0x800d(%rdi)
+  80359d:	00 00                	add    %al,(%rax)
+  80359f:	00 bf 0d 80 00 00    	add    %bh,0x800d(%rdi)
+  8035a5:	00 00                	add    %al,(%rax)
+  8035a7:	00 bf 0d 80 00 00    	add    %bh,0x800d(%rdi)
+  8035ad:	00 00                	add    %al,(%rax)
+  8035af:	00 bf 0d 80 00 00    	add    %bh,0x800d(%rdi)
+  8035b5:	00 00                	add    %al,(%rax)
+  8035b7:	00 bf 0d 80 00 00    	add    %bh,0x800d(%rdi)
+  8035bd:	00 00                	add    %al,(%rax)
+  8035bf:	00 bf 0d 80 00 00    	add    %bh,0x800d(%rdi)
+  8035c5:	00 00                	add    %al,(%rax)
+  8035c7:	00 e2                	add    %ah,%dl
+  8035c9:	0c 80                	or     $0x80,%al
+  8035cb:	00 00                	add    %al,(%rax)
+  8035cd:	00 00                	add    %al,(%rax)
+  8035cf:	00 bf 0d 80 00 00    	add    %bh,0x800d(%rdi)
+  8035d5:	00 00                	add    %al,(%rax)
+  8035d7:	00 bf 0d 80 00 00    	add    %bh,0x800d(%rdi)
+  8035dd:	00 00                	add    %al,(%rax)
+  8035df:	00 bf 0d 80 00 00    	add    %bh,0x800d(%rdi)
+  8035e5:	00 00                	add    %al,(%rax)
+  8035e7:	00 bf 0d 80 00 00    	add    %bh,0x800d(%rdi)
+  8035ed:	00 00                	add    %al,(%rax)
+  8035ef:	00 bf 0d 80 00 00    	add    %bh,0x800d(%rdi)
+  8035f5:	00 00                	add    %al,(%rax)
+  8035f7:	00 bf 0d 80 00 00    	add    %bh,0x800d(%rdi)
+  8035fd:	00 00                	add    %al,(%rax)
+  8035ff:	00 bf 0d 80 00 00    	add    %bh,0x800d(%rdi)
+  803605:	00 00                	add    %al,(%rax)
+  803607:	00 bf 0d 80 00 00    	add    %bh,0x800d(%rdi)
+  80360d:	00 00                	add    %al,(%rax)
+  80360f:	00 bf 0d 80 00 00    	add    %bh,0x800d(%rdi)
+  803615:	00 00                	add    %al,(%rax)
+  803617:	00 bf 0d 80 00 00    	add    %bh,0x800d(%rdi)
+  80361d:	00 00                	add    %al,(%rax)
+  80361f:	00 2e                	add    %ch,(%rsi)
+  803621:	08 80 00 00 00 00    	or     %al,0x0(%rax)
+  803627:	00 fd                	add    %bh,%ch
+  803629:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  80362f:	00 bf 0d 80 00 00    	add    %bh,0x800d(%rdi)
+  803635:	00 00                	add    %al,(%rax)
+  803637:	00 bf 0d 80 00 00    	add    %bh,0x800d(%rdi)
+  80363d:	00 00                	add    %al,(%rax)
+  80363f:	00 bf 0d 80 00 00    	add    %bh,0x800d(%rdi)
+  803645:	00 00                	add    %al,(%rax)
+  803647:	00 bf 0d 80 00 00    	add    %bh,0x800d(%rdi)
+  80364d:	00 00                	add    %al,(%rax)
+  80364f:	00 5d 08             	add    %bl,0x8(%rbp)
+  803652:	80 00 00             	addb   $0x0,(%rax)
+  803655:	00 00                	add    %al,(%rax)
+  803657:	00 bf 0d 80 00 00    	add    %bh,0x800d(%rdi)
+  80365d:	00 00                	add    %al,(%rax)
+  80365f:	00 bf 0d 80 00 00    	add    %bh,0x800d(%rdi)
+  803665:	00 00                	add    %al,(%rax)
+  803667:	00 23                	add    %ah,(%rbx)
+  803669:	08 80 00 00 00 00    	or     %al,0x0(%rax)
+  80366f:	00 bf 0d 80 00 00    	add    %bh,0x800d(%rdi)
+  803675:	00 00                	add    %al,(%rax)
+  803677:	00 bf 0d 80 00 00    	add    %bh,0x800d(%rdi)
+  80367d:	00 00                	add    %al,(%rax)
+  80367f:	00 a5 0b 80 00 00    	add    %ah,0x800b(%rbp)
+  803685:	00 00                	add    %al,(%rax)
+  803687:	00 6f 0c             	add    %ch,0xc(%rdi)
+  80368a:	80 00 00             	addb   $0x0,(%rax)
+  80368d:	00 00                	add    %al,(%rax)
+  80368f:	00 bf 0d 80 00 00    	add    %bh,0x800d(%rdi)
+  803695:	00 00                	add    %al,(%rax)
+  803697:	00 bf 0d 80 00 00    	add    %bh,0x800d(%rdi)
+  80369d:	00 00                	add    %al,(%rax)
+  80369f:	00 f4                	add    %dh,%ah
+  8036a1:	08 80 00 00 00 00    	or     %al,0x0(%rax)
+  8036a7:	00 bf 0d 80 00 00    	add    %bh,0x800d(%rdi)
+  8036ad:	00 00                	add    %al,(%rax)
+  8036af:	00 d1                	add    %dl,%cl
+  8036b1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8036b7:	00 bf 0d 80 00 00    	add    %bh,0x800d(%rdi)
+  8036bd:	00 00                	add    %al,(%rax)
+  8036bf:	00 bf 0d 80 00 00    	add    %bh,0x800d(%rdi)
+  8036c5:	00 00                	add    %al,(%rax)
+  8036c7:	00 e2                	add    %ah,%dl
+  8036c9:	0c 80                	or     $0x80,%al
+  8036cb:	00 00                	add    %al,(%rax)
+  8036cd:	00 00                	add    %al,(%rax)
+  8036cf:	00 bf 0d 80 00 00    	add    %bh,0x800d(%rdi)
+  8036d5:	00 00                	add    %al,(%rax)
+  8036d7:	00 87 07 80 00 00    	add    %al,0x8007(%rdi)
+  8036dd:	00 00                	add    %al,(%rax)
+	...
+
+00000000008036e0 <error_string>:
+	...
+  8036e8:	95 32 80 00 00 00 00 00 a7 32 80 00 00 00 00 00     .2.......2......
+  8036f8:	b7 32 80 00 00 00 00 00 c9 32 80 00 00 00 00 00     .2.......2......
+  803708:	d7 32 80 00 00 00 00 00 eb 32 80 00 00 00 00 00     .2.......2......
+  803718:	00 33 80 00 00 00 00 00 13 33 80 00 00 00 00 00     .3.......3......
+  803728:	25 33 80 00 00 00 00 00 39 33 80 00 00 00 00 00     %3......93......
+  803738:	49 33 80 00 00 00 00 00 5c 33 80 00 00 00 00 00     I3......\3......
+  803748:	73 33 80 00 00 00 00 00 89 33 80 00 00 00 00 00     s3.......3......
+  803758:	a1 33 80 00 00 00 00 00 b9 33 80 00 00 00 00 00     .3.......3......
+  803768:	c6 33 80 00 00 00 00 00 90 37 80 00 00 00 00 00     .3.......7......
+  803778:	da 33 80 00 00 00 00 00 f2 33 80 00 00 00 00 00     .3.......3......
+  803788:	08 34 80 00 00 00 00 00 66 69 6c 65 20 69 73 20     .4......file is 
+  803798:	6e 6f 74 20 61 20 76 61 6c 69 64 20 65 78 65 63     not a valid exec
+  8037a8:	75 74 61 62 6c 65 00 90 73 79 73 63 61 6c 6c 20     utable..syscall 
+  8037b8:	25 7a 64 20 72 65 74 75 72 6e 65 64 20 25 7a 64     %zd returned %zd
+  8037c8:	20 28 3e 20 30 29 00 6c 69 62 2f 73 79 73 63 61      (> 0).lib/sysca
+  8037d8:	6c 6c 2e 63 00 46 6f 72 6b 20 64 6f 75 62 6c 65     ll.c.Fork double
+  8037e8:	20 66 61 75 6c 74 00 6c 69 62 2f 66 6f 72 6b 2e      fault.lib/fork.
+  8037f8:	63 00 73 66 6f 72 6b 28 29 20 69 73 20 6e 6f 74     c.sfork() is not
+  803808:	20 69 6d 70 6c 65 6d 65 6e 74 65 64 00 0f 1f 00      implemented....
+  803818:	5b 25 30 38 78 5d 20 75 6e 6b 6e 6f 77 6e 20 64     [%08x] unknown d
+  803828:	65 76 69 63 65 20 74 79 70 65 20 25 64 0a 00 00     evice type %d...
+  803838:	5b 25 30 38 78 5d 20 66 74 72 75 6e 63 61 74 65     [%08x] ftruncate
+  803848:	20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65 0a      %d -- bad mode.
+  803858:	00 5b 25 30 38 78 5d 20 72 65 61 64 20 25 64 20     .[%08x] read %d 
+  803868:	2d 2d 20 62 61 64 20 6d 6f 64 65 0a 00 5b 25 30     -- bad mode..[%0
+  803878:	38 78 5d 20 77 72 69 74 65 20 25 64 20 2d 2d 20     8x] write %d -- 
+  803888:	62 61 64 20 6d 6f 64 65 0a 00 66 2e 0f 1f 84 00     bad mode..f.....
+  803898:	00 00 00 00 0f 1f 40 00                             ......@.
+
+00000000008038a0 <devtab>:
+  8038a0:	20 40 80 00 00 00 00 00 60 40 80 00 00 00 00 00      @......`@......
+  8038b0:	a0 40 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .@..............
+  8038c0:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  8038d0:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  8038e0:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  8038f0:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  803900:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  803910:	3d 20 32 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73 00     = 2.<cons>.cons.
+  803920:	73 79 73 5f 69 70 63 5f 74 72 79 5f 73 65 6e 64     sys_ipc_try_send
+  803930:	20 66 61 69 6c 65 64 3a 20 25 69 00 6c 69 62 2f      failed: %i.lib/
+  803940:	69 70 63 2e 63 00 66 2e 0f 1f 84 00 00 00 00 00     ipc.c.f.........
+  803950:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803960:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803970:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803980:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803990:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8039a0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8039b0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8039c0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8039d0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8039e0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8039f0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803a00:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803a10:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803a20:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803a30:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803a40:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803a50:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803a60:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803a70:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803a80:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803a90:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803aa0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803ab0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803ac0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803ad0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803ae0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803af0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803b00:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803b10:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803b20:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803b30:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803b40:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803b50:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803b60:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803b70:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803b80:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803b90:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803ba0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803bb0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803bc0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803bd0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803be0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803bf0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803c00:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803c10:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803c20:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803c30:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803c40:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803c50:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803c60:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803c70:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803c80:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803c90:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803ca0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803cb0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803cc0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803cd0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803ce0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803cf0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803d00:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803d10:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803d20:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803d30:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803d40:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803d50:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803d60:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803d70:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803d80:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803d90:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803da0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803db0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803dc0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803dd0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803de0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803df0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803e00:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803e10:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803e20:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803e30:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803e40:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803e50:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803e60:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803e70:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803e80:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803e90:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803ea0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803eb0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803ec0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803ed0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803ee0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803ef0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803f00:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803f10:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803f20:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803f30:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803f40:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803f50:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803f60:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803f70:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803f80:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803f90:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803fa0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803fb0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803fc0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803fd0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803fe0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803ff0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 90     ....f.........f.
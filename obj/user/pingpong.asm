@@ -0,0 +1,5922 @@
+
+obj/user/pingpong:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 13 01 00 00       	call   800136 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+ * Only need to start one of these -- splits into two with fork. */
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 57                	push   %r15
+  80002b:	41 56                	push   %r14
+  80002d:	41 55                	push   %r13
+  80002f:	41 54                	push   %r12
+  800031:	53                   	push   %rbx
+  800032:	48 83 ec 18          	sub    $0x18,%rsp
+    envid_t who;
+
+    if ((who = fork()) != 0) {
+  800036:	48 b8 bf 15 80 00 00 	movabs $0x8015bf,%rax
+  80003d:	00 00 00 
+  800040:	ff d0                	call   *%rax
+  800042:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  800045:	85 c0                	test   %eax,%eax
+  800047:	0f 85 93 00 00 00    	jne    8000e0 <umain+0xbb>
+        cprintf("send 0 from %x to %x\n", sys_getenvid(), who);
+        ipc_send(who, 0, 0, 0, 0);
+    }
+
+    while (1) {
+        uint32_t i = ipc_recv(&who, 0, 0, 0);
+  80004d:	49 bf 23 17 80 00 00 	movabs $0x801723,%r15
+  800054:	00 00 00 
+        cprintf("%x got %d from %x\n", sys_getenvid(), i, who);
+  800057:	49 be c4 10 80 00 00 	movabs $0x8010c4,%r14
+  80005e:	00 00 00 
+  800061:	49 bd af 02 80 00 00 	movabs $0x8002af,%r13
+  800068:	00 00 00 
+        uint32_t i = ipc_recv(&who, 0, 0, 0);
+  80006b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800070:	ba 00 00 00 00       	mov    $0x0,%edx
+  800075:	be 00 00 00 00       	mov    $0x0,%esi
+  80007a:	48 8d 7d cc          	lea    -0x34(%rbp),%rdi
+  80007e:	41 ff d7             	call   *%r15
+  800081:	89 c3                	mov    %eax,%ebx
+        cprintf("%x got %d from %x\n", sys_getenvid(), i, who);
+  800083:	44 8b 65 cc          	mov    -0x34(%rbp),%r12d
+  800087:	41 ff d6             	call   *%r14
+  80008a:	89 c6                	mov    %eax,%esi
+  80008c:	44 89 e1             	mov    %r12d,%ecx
+  80008f:	89 da                	mov    %ebx,%edx
+  800091:	48 bf fe 2e 80 00 00 	movabs $0x802efe,%rdi
+  800098:	00 00 00 
+  80009b:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000a0:	41 ff d5             	call   *%r13
+        if (i == 10) return;
+  8000a3:	83 fb 0a             	cmp    $0xa,%ebx
+  8000a6:	74 29                	je     8000d1 <umain+0xac>
+        i++;
+  8000a8:	83 c3 01             	add    $0x1,%ebx
+        ipc_send(who, i, 0, 0, 0);
+  8000ab:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8000b1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8000b6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8000bb:	89 de                	mov    %ebx,%esi
+  8000bd:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  8000c0:	48 b8 f8 17 80 00 00 	movabs $0x8017f8,%rax
+  8000c7:	00 00 00 
+  8000ca:	ff d0                	call   *%rax
+        if (i == 10) return;
+  8000cc:	83 fb 0a             	cmp    $0xa,%ebx
+  8000cf:	75 9a                	jne    80006b <umain+0x46>
+    }
+}
+  8000d1:	48 83 c4 18          	add    $0x18,%rsp
+  8000d5:	5b                   	pop    %rbx
+  8000d6:	41 5c                	pop    %r12
+  8000d8:	41 5d                	pop    %r13
+  8000da:	41 5e                	pop    %r14
+  8000dc:	41 5f                	pop    %r15
+  8000de:	5d                   	pop    %rbp
+  8000df:	c3                   	ret
+  8000e0:	89 c3                	mov    %eax,%ebx
+        cprintf("send 0 from %x to %x\n", sys_getenvid(), who);
+  8000e2:	48 b8 c4 10 80 00 00 	movabs $0x8010c4,%rax
+  8000e9:	00 00 00 
+  8000ec:	ff d0                	call   *%rax
+  8000ee:	89 c6                	mov    %eax,%esi
+  8000f0:	89 da                	mov    %ebx,%edx
+  8000f2:	48 bf e8 2e 80 00 00 	movabs $0x802ee8,%rdi
+  8000f9:	00 00 00 
+  8000fc:	b8 00 00 00 00       	mov    $0x0,%eax
+  800101:	48 b9 af 02 80 00 00 	movabs $0x8002af,%rcx
+  800108:	00 00 00 
+  80010b:	ff d1                	call   *%rcx
+        ipc_send(who, 0, 0, 0, 0);
+  80010d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800113:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800118:	ba 00 00 00 00       	mov    $0x0,%edx
+  80011d:	be 00 00 00 00       	mov    $0x0,%esi
+  800122:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  800125:	48 b8 f8 17 80 00 00 	movabs $0x8017f8,%rax
+  80012c:	00 00 00 
+  80012f:	ff d0                	call   *%rax
+  800131:	e9 17 ff ff ff       	jmp    80004d <umain+0x28>
+
+0000000000800136 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800136:	55                   	push   %rbp
+  800137:	48 89 e5             	mov    %rsp,%rbp
+  80013a:	41 56                	push   %r14
+  80013c:	41 55                	push   %r13
+  80013e:	41 54                	push   %r12
+  800140:	53                   	push   %rbx
+  800141:	41 89 fd             	mov    %edi,%r13d
+  800144:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800147:	48 ba d8 40 80 00 00 	movabs $0x8040d8,%rdx
+  80014e:	00 00 00 
+  800151:	48 b8 d8 40 80 00 00 	movabs $0x8040d8,%rax
+  800158:	00 00 00 
+  80015b:	48 39 c2             	cmp    %rax,%rdx
+  80015e:	73 17                	jae    800177 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  800160:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  800163:	49 89 c4             	mov    %rax,%r12
+  800166:	48 83 c3 08          	add    $0x8,%rbx
+  80016a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80016f:	ff 53 f8             	call   *-0x8(%rbx)
+  800172:	4c 39 e3             	cmp    %r12,%rbx
+  800175:	72 ef                	jb     800166 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+    envid_t this_env_id = sys_getenvid();
+  800177:	48 b8 c4 10 80 00 00 	movabs $0x8010c4,%rax
+  80017e:	00 00 00 
+  800181:	ff d0                	call   *%rax
+    thisenv = &((struct Env*)UENVS)[ENVX(this_env_id)];
+  800183:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800188:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+  80018f:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  800196:	00 00 00 
+  800199:	48 01 d0             	add    %rdx,%rax
+  80019c:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  8001a3:	00 00 00 
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8001a6:	45 85 ed             	test   %r13d,%r13d
+  8001a9:	7e 0d                	jle    8001b8 <libmain+0x82>
+  8001ab:	49 8b 06             	mov    (%r14),%rax
+  8001ae:	48 a3 00 40 80 00 00 	movabs %rax,0x804000
+  8001b5:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8001b8:	4c 89 f6             	mov    %r14,%rsi
+  8001bb:	44 89 ef             	mov    %r13d,%edi
+  8001be:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8001c5:	00 00 00 
+  8001c8:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8001ca:	48 b8 df 01 80 00 00 	movabs $0x8001df,%rax
+  8001d1:	00 00 00 
+  8001d4:	ff d0                	call   *%rax
+#endif
+}
+  8001d6:	5b                   	pop    %rbx
+  8001d7:	41 5c                	pop    %r12
+  8001d9:	41 5d                	pop    %r13
+  8001db:	41 5e                	pop    %r14
+  8001dd:	5d                   	pop    %rbp
+  8001de:	c3                   	ret
+
+00000000008001df <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8001df:	55                   	push   %rbp
+  8001e0:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  8001e3:	48 b8 44 1b 80 00 00 	movabs $0x801b44,%rax
+  8001ea:	00 00 00 
+  8001ed:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  8001ef:	bf 00 00 00 00       	mov    $0x0,%edi
+  8001f4:	48 b8 59 10 80 00 00 	movabs $0x801059,%rax
+  8001fb:	00 00 00 
+  8001fe:	ff d0                	call   *%rax
+}
+  800200:	5d                   	pop    %rbp
+  800201:	c3                   	ret
+
+0000000000800202 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  800202:	55                   	push   %rbp
+  800203:	48 89 e5             	mov    %rsp,%rbp
+  800206:	53                   	push   %rbx
+  800207:	48 83 ec 08          	sub    $0x8,%rsp
+  80020b:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  80020e:	8b 06                	mov    (%rsi),%eax
+  800210:	8d 50 01             	lea    0x1(%rax),%edx
+  800213:	89 16                	mov    %edx,(%rsi)
+  800215:	48 98                	cltq
+  800217:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  80021c:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  800222:	74 0a                	je     80022e <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  800224:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  800228:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80022c:	c9                   	leave
+  80022d:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  80022e:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  800232:	be ff 00 00 00       	mov    $0xff,%esi
+  800237:	48 b8 fb 0f 80 00 00 	movabs $0x800ffb,%rax
+  80023e:	00 00 00 
+  800241:	ff d0                	call   *%rax
+        state->offset = 0;
+  800243:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  800249:	eb d9                	jmp    800224 <putch+0x22>
+
+000000000080024b <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  80024b:	55                   	push   %rbp
+  80024c:	48 89 e5             	mov    %rsp,%rbp
+  80024f:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  800256:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  800259:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  800260:	b9 21 00 00 00       	mov    $0x21,%ecx
+  800265:	b8 00 00 00 00       	mov    $0x0,%eax
+  80026a:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  80026d:	48 89 f1             	mov    %rsi,%rcx
+  800270:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  800277:	48 bf 02 02 80 00 00 	movabs $0x800202,%rdi
+  80027e:	00 00 00 
+  800281:	48 b8 ff 03 80 00 00 	movabs $0x8003ff,%rax
+  800288:	00 00 00 
+  80028b:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  80028d:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  800294:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  80029b:	48 b8 fb 0f 80 00 00 	movabs $0x800ffb,%rax
+  8002a2:	00 00 00 
+  8002a5:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  8002a7:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  8002ad:	c9                   	leave
+  8002ae:	c3                   	ret
+
+00000000008002af <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  8002af:	55                   	push   %rbp
+  8002b0:	48 89 e5             	mov    %rsp,%rbp
+  8002b3:	48 83 ec 50          	sub    $0x50,%rsp
+  8002b7:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8002bb:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8002bf:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8002c3:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8002c7:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  8002cb:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  8002d2:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8002d6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8002da:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8002de:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  8002e2:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  8002e6:	48 b8 4b 02 80 00 00 	movabs $0x80024b,%rax
+  8002ed:	00 00 00 
+  8002f0:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  8002f2:	c9                   	leave
+  8002f3:	c3                   	ret
+
+00000000008002f4 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  8002f4:	55                   	push   %rbp
+  8002f5:	48 89 e5             	mov    %rsp,%rbp
+  8002f8:	41 57                	push   %r15
+  8002fa:	41 56                	push   %r14
+  8002fc:	41 55                	push   %r13
+  8002fe:	41 54                	push   %r12
+  800300:	53                   	push   %rbx
+  800301:	48 83 ec 18          	sub    $0x18,%rsp
+  800305:	49 89 fc             	mov    %rdi,%r12
+  800308:	49 89 f5             	mov    %rsi,%r13
+  80030b:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  80030f:	8b 45 10             	mov    0x10(%rbp),%eax
+  800312:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  800315:	41 89 cf             	mov    %ecx,%r15d
+  800318:	4c 39 fa             	cmp    %r15,%rdx
+  80031b:	73 5b                	jae    800378 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  80031d:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  800321:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  800325:	85 db                	test   %ebx,%ebx
+  800327:	7e 0e                	jle    800337 <print_num+0x43>
+            putch(padc, put_arg);
+  800329:	4c 89 ee             	mov    %r13,%rsi
+  80032c:	44 89 f7             	mov    %r14d,%edi
+  80032f:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  800332:	83 eb 01             	sub    $0x1,%ebx
+  800335:	75 f2                	jne    800329 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  800337:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  80033b:	48 b9 2c 2f 80 00 00 	movabs $0x802f2c,%rcx
+  800342:	00 00 00 
+  800345:	48 b8 1b 2f 80 00 00 	movabs $0x802f1b,%rax
+  80034c:	00 00 00 
+  80034f:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  800353:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800357:	ba 00 00 00 00       	mov    $0x0,%edx
+  80035c:	49 f7 f7             	div    %r15
+  80035f:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  800363:	4c 89 ee             	mov    %r13,%rsi
+  800366:	41 ff d4             	call   *%r12
+}
+  800369:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  80036d:	5b                   	pop    %rbx
+  80036e:	41 5c                	pop    %r12
+  800370:	41 5d                	pop    %r13
+  800372:	41 5e                	pop    %r14
+  800374:	41 5f                	pop    %r15
+  800376:	5d                   	pop    %rbp
+  800377:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  800378:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80037c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800381:	49 f7 f7             	div    %r15
+  800384:	48 83 ec 08          	sub    $0x8,%rsp
+  800388:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  80038c:	52                   	push   %rdx
+  80038d:	45 0f be c9          	movsbl %r9b,%r9d
+  800391:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  800395:	48 89 c2             	mov    %rax,%rdx
+  800398:	48 b8 f4 02 80 00 00 	movabs $0x8002f4,%rax
+  80039f:	00 00 00 
+  8003a2:	ff d0                	call   *%rax
+  8003a4:	48 83 c4 10          	add    $0x10,%rsp
+  8003a8:	eb 8d                	jmp    800337 <print_num+0x43>
+
+00000000008003aa <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  8003aa:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  8003ae:	48 8b 06             	mov    (%rsi),%rax
+  8003b1:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  8003b5:	73 0a                	jae    8003c1 <sprintputch+0x17>
+        *state->start++ = ch;
+  8003b7:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8003bb:	48 89 16             	mov    %rdx,(%rsi)
+  8003be:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  8003c1:	c3                   	ret
+
+00000000008003c2 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  8003c2:	55                   	push   %rbp
+  8003c3:	48 89 e5             	mov    %rsp,%rbp
+  8003c6:	48 83 ec 50          	sub    $0x50,%rsp
+  8003ca:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8003ce:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8003d2:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  8003d6:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8003dd:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8003e1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8003e5:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8003e9:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  8003ed:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8003f1:	48 b8 ff 03 80 00 00 	movabs $0x8003ff,%rax
+  8003f8:	00 00 00 
+  8003fb:	ff d0                	call   *%rax
+}
+  8003fd:	c9                   	leave
+  8003fe:	c3                   	ret
+
+00000000008003ff <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  8003ff:	55                   	push   %rbp
+  800400:	48 89 e5             	mov    %rsp,%rbp
+  800403:	41 57                	push   %r15
+  800405:	41 56                	push   %r14
+  800407:	41 55                	push   %r13
+  800409:	41 54                	push   %r12
+  80040b:	53                   	push   %rbx
+  80040c:	48 83 ec 38          	sub    $0x38,%rsp
+  800410:	49 89 fe             	mov    %rdi,%r14
+  800413:	49 89 f5             	mov    %rsi,%r13
+  800416:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  800419:	48 8b 01             	mov    (%rcx),%rax
+  80041c:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  800420:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800424:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800428:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  80042c:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  800430:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  800434:	0f b6 3b             	movzbl (%rbx),%edi
+  800437:	40 80 ff 25          	cmp    $0x25,%dil
+  80043b:	74 18                	je     800455 <vprintfmt+0x56>
+            if (!ch) return;
+  80043d:	40 84 ff             	test   %dil,%dil
+  800440:	0f 84 b1 06 00 00    	je     800af7 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  800446:	40 0f b6 ff          	movzbl %dil,%edi
+  80044a:	4c 89 ee             	mov    %r13,%rsi
+  80044d:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  800450:	4c 89 e3             	mov    %r12,%rbx
+  800453:	eb db                	jmp    800430 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  800455:	be 00 00 00 00       	mov    $0x0,%esi
+  80045a:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  80045e:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  800463:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800469:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  800470:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800474:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  800479:	41 0f b6 04 24       	movzbl (%r12),%eax
+  80047e:	88 45 a0             	mov    %al,-0x60(%rbp)
+  800481:	83 e8 23             	sub    $0x23,%eax
+  800484:	3c 57                	cmp    $0x57,%al
+  800486:	0f 87 51 06 00 00    	ja     800add <vprintfmt+0x6de>
+  80048c:	0f b6 c0             	movzbl %al,%eax
+  80048f:	48 b9 e0 30 80 00 00 	movabs $0x8030e0,%rcx
+  800496:	00 00 00 
+  800499:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  80049c:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  80049f:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  8004a3:	eb cf                	jmp    800474 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  8004a5:	49 89 dc             	mov    %rbx,%r12
+  8004a8:	be 01 00 00 00       	mov    $0x1,%esi
+  8004ad:	eb c5                	jmp    800474 <vprintfmt+0x75>
+            padc = ch;
+  8004af:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  8004b3:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8004b6:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8004b9:	eb b9                	jmp    800474 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8004bb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8004be:	83 f8 2f             	cmp    $0x2f,%eax
+  8004c1:	77 24                	ja     8004e7 <vprintfmt+0xe8>
+  8004c3:	89 c1                	mov    %eax,%ecx
+  8004c5:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  8004c9:	83 c0 08             	add    $0x8,%eax
+  8004cc:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8004cf:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  8004d2:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  8004d5:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8004d9:	79 99                	jns    800474 <vprintfmt+0x75>
+                width = precision;
+  8004db:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  8004df:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8004e5:	eb 8d                	jmp    800474 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8004e7:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8004eb:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  8004ef:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8004f3:	eb da                	jmp    8004cf <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  8004f5:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  8004fa:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8004fe:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  800504:	3c 39                	cmp    $0x39,%al
+  800506:	77 1c                	ja     800524 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  800508:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  80050c:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  800510:	0f b6 c0             	movzbl %al,%eax
+  800513:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800518:	0f b6 03             	movzbl (%rbx),%eax
+  80051b:	3c 39                	cmp    $0x39,%al
+  80051d:	76 e9                	jbe    800508 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  80051f:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  800522:	eb b1                	jmp    8004d5 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  800524:	49 89 dc             	mov    %rbx,%r12
+  800527:	eb ac                	jmp    8004d5 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  800529:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  80052c:	85 c9                	test   %ecx,%ecx
+  80052e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800533:	0f 49 c1             	cmovns %ecx,%eax
+  800536:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  800539:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80053c:	e9 33 ff ff ff       	jmp    800474 <vprintfmt+0x75>
+            lflag++;
+  800541:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  800544:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800547:	e9 28 ff ff ff       	jmp    800474 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  80054c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80054f:	83 f8 2f             	cmp    $0x2f,%eax
+  800552:	77 19                	ja     80056d <vprintfmt+0x16e>
+  800554:	89 c2                	mov    %eax,%edx
+  800556:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80055a:	83 c0 08             	add    $0x8,%eax
+  80055d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800560:	8b 3a                	mov    (%rdx),%edi
+  800562:	4c 89 ee             	mov    %r13,%rsi
+  800565:	41 ff d6             	call   *%r14
+            break;
+  800568:	e9 c3 fe ff ff       	jmp    800430 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  80056d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800571:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800575:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800579:	eb e5                	jmp    800560 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  80057b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80057e:	83 f8 2f             	cmp    $0x2f,%eax
+  800581:	77 5a                	ja     8005dd <vprintfmt+0x1de>
+  800583:	89 c2                	mov    %eax,%edx
+  800585:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800589:	83 c0 08             	add    $0x8,%eax
+  80058c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  80058f:	8b 02                	mov    (%rdx),%eax
+  800591:	89 c1                	mov    %eax,%ecx
+  800593:	f7 d9                	neg    %ecx
+  800595:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  800598:	83 f9 15             	cmp    $0x15,%ecx
+  80059b:	7f 4e                	jg     8005eb <vprintfmt+0x1ec>
+  80059d:	48 63 c1             	movslq %ecx,%rax
+  8005a0:	48 ba a0 33 80 00 00 	movabs $0x8033a0,%rdx
+  8005a7:	00 00 00 
+  8005aa:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8005ae:	48 85 c0             	test   %rax,%rax
+  8005b1:	74 38                	je     8005eb <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  8005b3:	48 89 c1             	mov    %rax,%rcx
+  8005b6:	48 ba b9 35 80 00 00 	movabs $0x8035b9,%rdx
+  8005bd:	00 00 00 
+  8005c0:	4c 89 ee             	mov    %r13,%rsi
+  8005c3:	4c 89 f7             	mov    %r14,%rdi
+  8005c6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005cb:	49 b8 c2 03 80 00 00 	movabs $0x8003c2,%r8
+  8005d2:	00 00 00 
+  8005d5:	41 ff d0             	call   *%r8
+  8005d8:	e9 53 fe ff ff       	jmp    800430 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  8005dd:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8005e1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8005e5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8005e9:	eb a4                	jmp    80058f <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  8005eb:	48 ba 44 2f 80 00 00 	movabs $0x802f44,%rdx
+  8005f2:	00 00 00 
+  8005f5:	4c 89 ee             	mov    %r13,%rsi
+  8005f8:	4c 89 f7             	mov    %r14,%rdi
+  8005fb:	b8 00 00 00 00       	mov    $0x0,%eax
+  800600:	49 b8 c2 03 80 00 00 	movabs $0x8003c2,%r8
+  800607:	00 00 00 
+  80060a:	41 ff d0             	call   *%r8
+  80060d:	e9 1e fe ff ff       	jmp    800430 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800612:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800615:	83 f8 2f             	cmp    $0x2f,%eax
+  800618:	77 6c                	ja     800686 <vprintfmt+0x287>
+  80061a:	89 c2                	mov    %eax,%edx
+  80061c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800620:	83 c0 08             	add    $0x8,%eax
+  800623:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800626:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  800629:	48 85 d2             	test   %rdx,%rdx
+  80062c:	48 b8 3d 2f 80 00 00 	movabs $0x802f3d,%rax
+  800633:	00 00 00 
+  800636:	48 0f 45 c2          	cmovne %rdx,%rax
+  80063a:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  80063e:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800642:	7e 06                	jle    80064a <vprintfmt+0x24b>
+  800644:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  800648:	75 4a                	jne    800694 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  80064a:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  80064e:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  800652:	0f b6 00             	movzbl (%rax),%eax
+  800655:	84 c0                	test   %al,%al
+  800657:	0f 85 9a 00 00 00    	jne    8006f7 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  80065d:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800660:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  800664:	85 c0                	test   %eax,%eax
+  800666:	0f 8e c4 fd ff ff    	jle    800430 <vprintfmt+0x31>
+  80066c:	4c 89 ee             	mov    %r13,%rsi
+  80066f:	bf 20 00 00 00       	mov    $0x20,%edi
+  800674:	41 ff d6             	call   *%r14
+  800677:	41 83 ec 01          	sub    $0x1,%r12d
+  80067b:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  80067f:	75 eb                	jne    80066c <vprintfmt+0x26d>
+  800681:	e9 aa fd ff ff       	jmp    800430 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800686:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80068a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80068e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800692:	eb 92                	jmp    800626 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  800694:	49 63 f7             	movslq %r15d,%rsi
+  800697:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  80069b:	48 b8 b1 0b 80 00 00 	movabs $0x800bb1,%rax
+  8006a2:	00 00 00 
+  8006a5:	ff d0                	call   *%rax
+  8006a7:	48 89 c2             	mov    %rax,%rdx
+  8006aa:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8006ad:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  8006af:	8d 70 ff             	lea    -0x1(%rax),%esi
+  8006b2:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  8006b5:	85 c0                	test   %eax,%eax
+  8006b7:	7e 91                	jle    80064a <vprintfmt+0x24b>
+  8006b9:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  8006be:	4c 89 ee             	mov    %r13,%rsi
+  8006c1:	44 89 e7             	mov    %r12d,%edi
+  8006c4:	41 ff d6             	call   *%r14
+  8006c7:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8006cb:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8006ce:	83 f8 ff             	cmp    $0xffffffff,%eax
+  8006d1:	75 eb                	jne    8006be <vprintfmt+0x2bf>
+  8006d3:	e9 72 ff ff ff       	jmp    80064a <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8006d8:	0f b6 f8             	movzbl %al,%edi
+  8006db:	4c 89 ee             	mov    %r13,%rsi
+  8006de:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8006e1:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8006e5:	49 83 c4 01          	add    $0x1,%r12
+  8006e9:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  8006ef:	84 c0                	test   %al,%al
+  8006f1:	0f 84 66 ff ff ff    	je     80065d <vprintfmt+0x25e>
+  8006f7:	45 85 ff             	test   %r15d,%r15d
+  8006fa:	78 0a                	js     800706 <vprintfmt+0x307>
+  8006fc:	41 83 ef 01          	sub    $0x1,%r15d
+  800700:	0f 88 57 ff ff ff    	js     80065d <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800706:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  80070a:	74 cc                	je     8006d8 <vprintfmt+0x2d9>
+  80070c:	8d 50 e0             	lea    -0x20(%rax),%edx
+  80070f:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800714:	80 fa 5e             	cmp    $0x5e,%dl
+  800717:	77 c2                	ja     8006db <vprintfmt+0x2dc>
+  800719:	eb bd                	jmp    8006d8 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  80071b:	40 84 f6             	test   %sil,%sil
+  80071e:	75 26                	jne    800746 <vprintfmt+0x347>
+    switch (lflag) {
+  800720:	85 d2                	test   %edx,%edx
+  800722:	74 59                	je     80077d <vprintfmt+0x37e>
+  800724:	83 fa 01             	cmp    $0x1,%edx
+  800727:	74 7b                	je     8007a4 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  800729:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80072c:	83 f8 2f             	cmp    $0x2f,%eax
+  80072f:	0f 87 96 00 00 00    	ja     8007cb <vprintfmt+0x3cc>
+  800735:	89 c2                	mov    %eax,%edx
+  800737:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80073b:	83 c0 08             	add    $0x8,%eax
+  80073e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800741:	4c 8b 22             	mov    (%rdx),%r12
+  800744:	eb 17                	jmp    80075d <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  800746:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800749:	83 f8 2f             	cmp    $0x2f,%eax
+  80074c:	77 21                	ja     80076f <vprintfmt+0x370>
+  80074e:	89 c2                	mov    %eax,%edx
+  800750:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800754:	83 c0 08             	add    $0x8,%eax
+  800757:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80075a:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  80075d:	4d 85 e4             	test   %r12,%r12
+  800760:	78 7a                	js     8007dc <vprintfmt+0x3dd>
+            num = i;
+  800762:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  800765:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  80076a:	e9 50 02 00 00       	jmp    8009bf <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  80076f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800773:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800777:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80077b:	eb dd                	jmp    80075a <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  80077d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800780:	83 f8 2f             	cmp    $0x2f,%eax
+  800783:	77 11                	ja     800796 <vprintfmt+0x397>
+  800785:	89 c2                	mov    %eax,%edx
+  800787:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80078b:	83 c0 08             	add    $0x8,%eax
+  80078e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800791:	4c 63 22             	movslq (%rdx),%r12
+  800794:	eb c7                	jmp    80075d <vprintfmt+0x35e>
+  800796:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80079a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80079e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007a2:	eb ed                	jmp    800791 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  8007a4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007a7:	83 f8 2f             	cmp    $0x2f,%eax
+  8007aa:	77 11                	ja     8007bd <vprintfmt+0x3be>
+  8007ac:	89 c2                	mov    %eax,%edx
+  8007ae:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007b2:	83 c0 08             	add    $0x8,%eax
+  8007b5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007b8:	4c 8b 22             	mov    (%rdx),%r12
+  8007bb:	eb a0                	jmp    80075d <vprintfmt+0x35e>
+  8007bd:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007c1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007c5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007c9:	eb ed                	jmp    8007b8 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  8007cb:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007cf:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007d3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007d7:	e9 65 ff ff ff       	jmp    800741 <vprintfmt+0x342>
+                putch('-', put_arg);
+  8007dc:	4c 89 ee             	mov    %r13,%rsi
+  8007df:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  8007e4:	41 ff d6             	call   *%r14
+                i = -i;
+  8007e7:	49 f7 dc             	neg    %r12
+  8007ea:	e9 73 ff ff ff       	jmp    800762 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  8007ef:	40 84 f6             	test   %sil,%sil
+  8007f2:	75 32                	jne    800826 <vprintfmt+0x427>
+    switch (lflag) {
+  8007f4:	85 d2                	test   %edx,%edx
+  8007f6:	74 5d                	je     800855 <vprintfmt+0x456>
+  8007f8:	83 fa 01             	cmp    $0x1,%edx
+  8007fb:	0f 84 82 00 00 00    	je     800883 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  800801:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800804:	83 f8 2f             	cmp    $0x2f,%eax
+  800807:	0f 87 a5 00 00 00    	ja     8008b2 <vprintfmt+0x4b3>
+  80080d:	89 c2                	mov    %eax,%edx
+  80080f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800813:	83 c0 08             	add    $0x8,%eax
+  800816:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800819:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  80081c:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  800821:	e9 99 01 00 00       	jmp    8009bf <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800826:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800829:	83 f8 2f             	cmp    $0x2f,%eax
+  80082c:	77 19                	ja     800847 <vprintfmt+0x448>
+  80082e:	89 c2                	mov    %eax,%edx
+  800830:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800834:	83 c0 08             	add    $0x8,%eax
+  800837:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80083a:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  80083d:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800842:	e9 78 01 00 00       	jmp    8009bf <vprintfmt+0x5c0>
+  800847:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80084b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80084f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800853:	eb e5                	jmp    80083a <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  800855:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800858:	83 f8 2f             	cmp    $0x2f,%eax
+  80085b:	77 18                	ja     800875 <vprintfmt+0x476>
+  80085d:	89 c2                	mov    %eax,%edx
+  80085f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800863:	83 c0 08             	add    $0x8,%eax
+  800866:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800869:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  80086b:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  800870:	e9 4a 01 00 00       	jmp    8009bf <vprintfmt+0x5c0>
+  800875:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800879:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80087d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800881:	eb e6                	jmp    800869 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  800883:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800886:	83 f8 2f             	cmp    $0x2f,%eax
+  800889:	77 19                	ja     8008a4 <vprintfmt+0x4a5>
+  80088b:	89 c2                	mov    %eax,%edx
+  80088d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800891:	83 c0 08             	add    $0x8,%eax
+  800894:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800897:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  80089a:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  80089f:	e9 1b 01 00 00       	jmp    8009bf <vprintfmt+0x5c0>
+  8008a4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008a8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008ac:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008b0:	eb e5                	jmp    800897 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  8008b2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008b6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008ba:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008be:	e9 56 ff ff ff       	jmp    800819 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  8008c3:	40 84 f6             	test   %sil,%sil
+  8008c6:	75 2e                	jne    8008f6 <vprintfmt+0x4f7>
+    switch (lflag) {
+  8008c8:	85 d2                	test   %edx,%edx
+  8008ca:	74 59                	je     800925 <vprintfmt+0x526>
+  8008cc:	83 fa 01             	cmp    $0x1,%edx
+  8008cf:	74 7f                	je     800950 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  8008d1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008d4:	83 f8 2f             	cmp    $0x2f,%eax
+  8008d7:	0f 87 9f 00 00 00    	ja     80097c <vprintfmt+0x57d>
+  8008dd:	89 c2                	mov    %eax,%edx
+  8008df:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008e3:	83 c0 08             	add    $0x8,%eax
+  8008e6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008e9:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8008ec:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  8008f1:	e9 c9 00 00 00       	jmp    8009bf <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8008f6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008f9:	83 f8 2f             	cmp    $0x2f,%eax
+  8008fc:	77 19                	ja     800917 <vprintfmt+0x518>
+  8008fe:	89 c2                	mov    %eax,%edx
+  800900:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800904:	83 c0 08             	add    $0x8,%eax
+  800907:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80090a:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  80090d:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800912:	e9 a8 00 00 00       	jmp    8009bf <vprintfmt+0x5c0>
+  800917:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80091b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80091f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800923:	eb e5                	jmp    80090a <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  800925:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800928:	83 f8 2f             	cmp    $0x2f,%eax
+  80092b:	77 15                	ja     800942 <vprintfmt+0x543>
+  80092d:	89 c2                	mov    %eax,%edx
+  80092f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800933:	83 c0 08             	add    $0x8,%eax
+  800936:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800939:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  80093b:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  800940:	eb 7d                	jmp    8009bf <vprintfmt+0x5c0>
+  800942:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800946:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80094a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80094e:	eb e9                	jmp    800939 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  800950:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800953:	83 f8 2f             	cmp    $0x2f,%eax
+  800956:	77 16                	ja     80096e <vprintfmt+0x56f>
+  800958:	89 c2                	mov    %eax,%edx
+  80095a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80095e:	83 c0 08             	add    $0x8,%eax
+  800961:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800964:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800967:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  80096c:	eb 51                	jmp    8009bf <vprintfmt+0x5c0>
+  80096e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800972:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800976:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80097a:	eb e8                	jmp    800964 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  80097c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800980:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800984:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800988:	e9 5c ff ff ff       	jmp    8008e9 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  80098d:	4c 89 ee             	mov    %r13,%rsi
+  800990:	bf 30 00 00 00       	mov    $0x30,%edi
+  800995:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800998:	4c 89 ee             	mov    %r13,%rsi
+  80099b:	bf 78 00 00 00       	mov    $0x78,%edi
+  8009a0:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  8009a3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009a6:	83 f8 2f             	cmp    $0x2f,%eax
+  8009a9:	77 47                	ja     8009f2 <vprintfmt+0x5f3>
+  8009ab:	89 c2                	mov    %eax,%edx
+  8009ad:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009b1:	83 c0 08             	add    $0x8,%eax
+  8009b4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009b7:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8009ba:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  8009bf:	48 83 ec 08          	sub    $0x8,%rsp
+  8009c3:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  8009c7:	0f 94 c0             	sete   %al
+  8009ca:	0f b6 c0             	movzbl %al,%eax
+  8009cd:	50                   	push   %rax
+  8009ce:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  8009d3:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  8009d7:	4c 89 ee             	mov    %r13,%rsi
+  8009da:	4c 89 f7             	mov    %r14,%rdi
+  8009dd:	48 b8 f4 02 80 00 00 	movabs $0x8002f4,%rax
+  8009e4:	00 00 00 
+  8009e7:	ff d0                	call   *%rax
+            break;
+  8009e9:	48 83 c4 10          	add    $0x10,%rsp
+  8009ed:	e9 3e fa ff ff       	jmp    800430 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  8009f2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009f6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009fa:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009fe:	eb b7                	jmp    8009b7 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  800a00:	40 84 f6             	test   %sil,%sil
+  800a03:	75 2b                	jne    800a30 <vprintfmt+0x631>
+    switch (lflag) {
+  800a05:	85 d2                	test   %edx,%edx
+  800a07:	74 56                	je     800a5f <vprintfmt+0x660>
+  800a09:	83 fa 01             	cmp    $0x1,%edx
+  800a0c:	74 7f                	je     800a8d <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800a0e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a11:	83 f8 2f             	cmp    $0x2f,%eax
+  800a14:	0f 87 a2 00 00 00    	ja     800abc <vprintfmt+0x6bd>
+  800a1a:	89 c2                	mov    %eax,%edx
+  800a1c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a20:	83 c0 08             	add    $0x8,%eax
+  800a23:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a26:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800a29:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800a2e:	eb 8f                	jmp    8009bf <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800a30:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a33:	83 f8 2f             	cmp    $0x2f,%eax
+  800a36:	77 19                	ja     800a51 <vprintfmt+0x652>
+  800a38:	89 c2                	mov    %eax,%edx
+  800a3a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a3e:	83 c0 08             	add    $0x8,%eax
+  800a41:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a44:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800a47:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800a4c:	e9 6e ff ff ff       	jmp    8009bf <vprintfmt+0x5c0>
+  800a51:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a55:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a59:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a5d:	eb e5                	jmp    800a44 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800a5f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a62:	83 f8 2f             	cmp    $0x2f,%eax
+  800a65:	77 18                	ja     800a7f <vprintfmt+0x680>
+  800a67:	89 c2                	mov    %eax,%edx
+  800a69:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a6d:	83 c0 08             	add    $0x8,%eax
+  800a70:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a73:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800a75:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800a7a:	e9 40 ff ff ff       	jmp    8009bf <vprintfmt+0x5c0>
+  800a7f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a83:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a87:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a8b:	eb e6                	jmp    800a73 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800a8d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a90:	83 f8 2f             	cmp    $0x2f,%eax
+  800a93:	77 19                	ja     800aae <vprintfmt+0x6af>
+  800a95:	89 c2                	mov    %eax,%edx
+  800a97:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a9b:	83 c0 08             	add    $0x8,%eax
+  800a9e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800aa1:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800aa4:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800aa9:	e9 11 ff ff ff       	jmp    8009bf <vprintfmt+0x5c0>
+  800aae:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ab2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ab6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800aba:	eb e5                	jmp    800aa1 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800abc:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ac0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ac4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ac8:	e9 59 ff ff ff       	jmp    800a26 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800acd:	4c 89 ee             	mov    %r13,%rsi
+  800ad0:	bf 25 00 00 00       	mov    $0x25,%edi
+  800ad5:	41 ff d6             	call   *%r14
+            break;
+  800ad8:	e9 53 f9 ff ff       	jmp    800430 <vprintfmt+0x31>
+            putch('%', put_arg);
+  800add:	4c 89 ee             	mov    %r13,%rsi
+  800ae0:	bf 25 00 00 00       	mov    $0x25,%edi
+  800ae5:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800ae8:	48 83 eb 01          	sub    $0x1,%rbx
+  800aec:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800af0:	75 f6                	jne    800ae8 <vprintfmt+0x6e9>
+  800af2:	e9 39 f9 ff ff       	jmp    800430 <vprintfmt+0x31>
+}
+  800af7:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800afb:	5b                   	pop    %rbx
+  800afc:	41 5c                	pop    %r12
+  800afe:	41 5d                	pop    %r13
+  800b00:	41 5e                	pop    %r14
+  800b02:	41 5f                	pop    %r15
+  800b04:	5d                   	pop    %rbp
+  800b05:	c3                   	ret
+
+0000000000800b06 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800b06:	55                   	push   %rbp
+  800b07:	48 89 e5             	mov    %rsp,%rbp
+  800b0a:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800b0e:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800b12:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800b17:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800b1b:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800b22:	48 85 ff             	test   %rdi,%rdi
+  800b25:	74 2b                	je     800b52 <vsnprintf+0x4c>
+  800b27:	48 85 f6             	test   %rsi,%rsi
+  800b2a:	74 26                	je     800b52 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800b2c:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800b30:	48 bf aa 03 80 00 00 	movabs $0x8003aa,%rdi
+  800b37:	00 00 00 
+  800b3a:	48 b8 ff 03 80 00 00 	movabs $0x8003ff,%rax
+  800b41:	00 00 00 
+  800b44:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800b46:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800b4a:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800b4d:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800b50:	c9                   	leave
+  800b51:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800b52:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800b57:	eb f7                	jmp    800b50 <vsnprintf+0x4a>
+
+0000000000800b59 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800b59:	55                   	push   %rbp
+  800b5a:	48 89 e5             	mov    %rsp,%rbp
+  800b5d:	48 83 ec 50          	sub    $0x50,%rsp
+  800b61:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800b65:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800b69:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800b6d:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800b74:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800b78:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b7c:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800b80:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800b84:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800b88:	48 b8 06 0b 80 00 00 	movabs $0x800b06,%rax
+  800b8f:	00 00 00 
+  800b92:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800b94:	c9                   	leave
+  800b95:	c3                   	ret
+
+0000000000800b96 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800b96:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800b99:	74 10                	je     800bab <strlen+0x15>
+    size_t n = 0;
+  800b9b:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800ba0:	48 83 c0 01          	add    $0x1,%rax
+  800ba4:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800ba8:	75 f6                	jne    800ba0 <strlen+0xa>
+  800baa:	c3                   	ret
+    size_t n = 0;
+  800bab:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800bb0:	c3                   	ret
+
+0000000000800bb1 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800bb1:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800bb4:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800bb9:	48 85 f6             	test   %rsi,%rsi
+  800bbc:	74 11                	je     800bcf <strnlen+0x1e>
+  800bbe:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800bc2:	74 0c                	je     800bd0 <strnlen+0x1f>
+  800bc4:	48 83 c2 01          	add    $0x1,%rdx
+  800bc8:	48 39 d0             	cmp    %rdx,%rax
+  800bcb:	75 f1                	jne    800bbe <strnlen+0xd>
+  800bcd:	eb 04                	jmp    800bd3 <strnlen+0x22>
+  800bcf:	c3                   	ret
+  800bd0:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800bd3:	c3                   	ret
+
+0000000000800bd4 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800bd4:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800bd7:	ba 00 00 00 00       	mov    $0x0,%edx
+  800bdc:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800be0:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800be3:	48 83 c2 01          	add    $0x1,%rdx
+  800be7:	84 c9                	test   %cl,%cl
+  800be9:	75 f1                	jne    800bdc <strcpy+0x8>
+        ;
+    return res;
+}
+  800beb:	c3                   	ret
+
+0000000000800bec <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800bec:	55                   	push   %rbp
+  800bed:	48 89 e5             	mov    %rsp,%rbp
+  800bf0:	41 54                	push   %r12
+  800bf2:	53                   	push   %rbx
+  800bf3:	48 89 fb             	mov    %rdi,%rbx
+  800bf6:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800bf9:	48 b8 96 0b 80 00 00 	movabs $0x800b96,%rax
+  800c00:	00 00 00 
+  800c03:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800c05:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800c09:	4c 89 e6             	mov    %r12,%rsi
+  800c0c:	48 b8 d4 0b 80 00 00 	movabs $0x800bd4,%rax
+  800c13:	00 00 00 
+  800c16:	ff d0                	call   *%rax
+    return dst;
+}
+  800c18:	48 89 d8             	mov    %rbx,%rax
+  800c1b:	5b                   	pop    %rbx
+  800c1c:	41 5c                	pop    %r12
+  800c1e:	5d                   	pop    %rbp
+  800c1f:	c3                   	ret
+
+0000000000800c20 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800c20:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800c23:	48 85 d2             	test   %rdx,%rdx
+  800c26:	74 1f                	je     800c47 <strncpy+0x27>
+  800c28:	48 01 fa             	add    %rdi,%rdx
+  800c2b:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800c2e:	48 83 c1 01          	add    $0x1,%rcx
+  800c32:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800c36:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800c3a:	41 80 f8 01          	cmp    $0x1,%r8b
+  800c3e:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800c42:	48 39 ca             	cmp    %rcx,%rdx
+  800c45:	75 e7                	jne    800c2e <strncpy+0xe>
+    }
+    return ret;
+}
+  800c47:	c3                   	ret
+
+0000000000800c48 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800c48:	48 89 f8             	mov    %rdi,%rax
+  800c4b:	48 85 d2             	test   %rdx,%rdx
+  800c4e:	74 24                	je     800c74 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800c50:	48 83 ea 01          	sub    $0x1,%rdx
+  800c54:	74 1b                	je     800c71 <strlcpy+0x29>
+  800c56:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800c5a:	0f b6 16             	movzbl (%rsi),%edx
+  800c5d:	84 d2                	test   %dl,%dl
+  800c5f:	74 10                	je     800c71 <strlcpy+0x29>
+            *dst++ = *src++;
+  800c61:	48 83 c6 01          	add    $0x1,%rsi
+  800c65:	48 83 c0 01          	add    $0x1,%rax
+  800c69:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800c6c:	48 39 c8             	cmp    %rcx,%rax
+  800c6f:	75 e9                	jne    800c5a <strlcpy+0x12>
+        *dst = '\0';
+  800c71:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800c74:	48 29 f8             	sub    %rdi,%rax
+}
+  800c77:	c3                   	ret
+
+0000000000800c78 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800c78:	0f b6 07             	movzbl (%rdi),%eax
+  800c7b:	84 c0                	test   %al,%al
+  800c7d:	74 13                	je     800c92 <strcmp+0x1a>
+  800c7f:	38 06                	cmp    %al,(%rsi)
+  800c81:	75 0f                	jne    800c92 <strcmp+0x1a>
+  800c83:	48 83 c7 01          	add    $0x1,%rdi
+  800c87:	48 83 c6 01          	add    $0x1,%rsi
+  800c8b:	0f b6 07             	movzbl (%rdi),%eax
+  800c8e:	84 c0                	test   %al,%al
+  800c90:	75 ed                	jne    800c7f <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800c92:	0f b6 c0             	movzbl %al,%eax
+  800c95:	0f b6 16             	movzbl (%rsi),%edx
+  800c98:	29 d0                	sub    %edx,%eax
+}
+  800c9a:	c3                   	ret
+
+0000000000800c9b <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800c9b:	48 85 d2             	test   %rdx,%rdx
+  800c9e:	74 1f                	je     800cbf <strncmp+0x24>
+  800ca0:	0f b6 07             	movzbl (%rdi),%eax
+  800ca3:	84 c0                	test   %al,%al
+  800ca5:	74 1e                	je     800cc5 <strncmp+0x2a>
+  800ca7:	3a 06                	cmp    (%rsi),%al
+  800ca9:	75 1a                	jne    800cc5 <strncmp+0x2a>
+  800cab:	48 83 c7 01          	add    $0x1,%rdi
+  800caf:	48 83 c6 01          	add    $0x1,%rsi
+  800cb3:	48 83 ea 01          	sub    $0x1,%rdx
+  800cb7:	75 e7                	jne    800ca0 <strncmp+0x5>
+
+    if (!n) return 0;
+  800cb9:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cbe:	c3                   	ret
+  800cbf:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cc4:	c3                   	ret
+  800cc5:	48 85 d2             	test   %rdx,%rdx
+  800cc8:	74 09                	je     800cd3 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800cca:	0f b6 07             	movzbl (%rdi),%eax
+  800ccd:	0f b6 16             	movzbl (%rsi),%edx
+  800cd0:	29 d0                	sub    %edx,%eax
+  800cd2:	c3                   	ret
+    if (!n) return 0;
+  800cd3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800cd8:	c3                   	ret
+
+0000000000800cd9 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800cd9:	0f b6 17             	movzbl (%rdi),%edx
+  800cdc:	84 d2                	test   %dl,%dl
+  800cde:	74 18                	je     800cf8 <strchr+0x1f>
+        if (*str == c) {
+  800ce0:	0f be d2             	movsbl %dl,%edx
+  800ce3:	39 f2                	cmp    %esi,%edx
+  800ce5:	74 17                	je     800cfe <strchr+0x25>
+    for (; *str; str++) {
+  800ce7:	48 83 c7 01          	add    $0x1,%rdi
+  800ceb:	0f b6 17             	movzbl (%rdi),%edx
+  800cee:	84 d2                	test   %dl,%dl
+  800cf0:	75 ee                	jne    800ce0 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800cf2:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cf7:	c3                   	ret
+  800cf8:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cfd:	c3                   	ret
+  800cfe:	48 89 f8             	mov    %rdi,%rax
+}
+  800d01:	c3                   	ret
+
+0000000000800d02 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800d02:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800d05:	0f b6 17             	movzbl (%rdi),%edx
+  800d08:	84 d2                	test   %dl,%dl
+  800d0a:	74 13                	je     800d1f <strfind+0x1d>
+  800d0c:	0f be d2             	movsbl %dl,%edx
+  800d0f:	39 f2                	cmp    %esi,%edx
+  800d11:	74 0b                	je     800d1e <strfind+0x1c>
+  800d13:	48 83 c0 01          	add    $0x1,%rax
+  800d17:	0f b6 10             	movzbl (%rax),%edx
+  800d1a:	84 d2                	test   %dl,%dl
+  800d1c:	75 ee                	jne    800d0c <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800d1e:	c3                   	ret
+  800d1f:	c3                   	ret
+
+0000000000800d20 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800d20:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800d23:	48 89 f8             	mov    %rdi,%rax
+  800d26:	48 f7 d8             	neg    %rax
+  800d29:	83 e0 07             	and    $0x7,%eax
+  800d2c:	49 89 d1             	mov    %rdx,%r9
+  800d2f:	49 29 c1             	sub    %rax,%r9
+  800d32:	78 36                	js     800d6a <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800d34:	40 0f b6 c6          	movzbl %sil,%eax
+  800d38:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800d3f:	01 01 01 
+  800d42:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800d46:	40 f6 c7 07          	test   $0x7,%dil
+  800d4a:	75 38                	jne    800d84 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800d4c:	4c 89 c9             	mov    %r9,%rcx
+  800d4f:	48 c1 f9 03          	sar    $0x3,%rcx
+  800d53:	74 0c                	je     800d61 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800d55:	fc                   	cld
+  800d56:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800d59:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800d5d:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800d61:	4d 85 c9             	test   %r9,%r9
+  800d64:	75 45                	jne    800dab <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800d66:	4c 89 c0             	mov    %r8,%rax
+  800d69:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800d6a:	48 85 d2             	test   %rdx,%rdx
+  800d6d:	74 f7                	je     800d66 <memset+0x46>
+  800d6f:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800d72:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800d75:	48 83 c0 01          	add    $0x1,%rax
+  800d79:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  800d7d:	48 39 c2             	cmp    %rax,%rdx
+  800d80:	75 f3                	jne    800d75 <memset+0x55>
+  800d82:	eb e2                	jmp    800d66 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  800d84:	40 f6 c7 01          	test   $0x1,%dil
+  800d88:	74 06                	je     800d90 <memset+0x70>
+  800d8a:	88 07                	mov    %al,(%rdi)
+  800d8c:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800d90:	40 f6 c7 02          	test   $0x2,%dil
+  800d94:	74 07                	je     800d9d <memset+0x7d>
+  800d96:	66 89 07             	mov    %ax,(%rdi)
+  800d99:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800d9d:	40 f6 c7 04          	test   $0x4,%dil
+  800da1:	74 a9                	je     800d4c <memset+0x2c>
+  800da3:	89 07                	mov    %eax,(%rdi)
+  800da5:	48 83 c7 04          	add    $0x4,%rdi
+  800da9:	eb a1                	jmp    800d4c <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800dab:	41 f6 c1 04          	test   $0x4,%r9b
+  800daf:	74 06                	je     800db7 <memset+0x97>
+  800db1:	89 07                	mov    %eax,(%rdi)
+  800db3:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800db7:	41 f6 c1 02          	test   $0x2,%r9b
+  800dbb:	74 07                	je     800dc4 <memset+0xa4>
+  800dbd:	66 89 07             	mov    %ax,(%rdi)
+  800dc0:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  800dc4:	41 f6 c1 01          	test   $0x1,%r9b
+  800dc8:	74 9c                	je     800d66 <memset+0x46>
+  800dca:	88 07                	mov    %al,(%rdi)
+  800dcc:	eb 98                	jmp    800d66 <memset+0x46>
+
+0000000000800dce <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  800dce:	48 89 f8             	mov    %rdi,%rax
+  800dd1:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  800dd4:	48 39 fe             	cmp    %rdi,%rsi
+  800dd7:	73 3b                	jae    800e14 <memmove+0x46>
+  800dd9:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  800ddd:	48 39 d7             	cmp    %rdx,%rdi
+  800de0:	73 32                	jae    800e14 <memmove+0x46>
+        s += n;
+        d += n;
+  800de2:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800de6:	48 89 d6             	mov    %rdx,%rsi
+  800de9:	48 09 fe             	or     %rdi,%rsi
+  800dec:	48 09 ce             	or     %rcx,%rsi
+  800def:	40 f6 c6 07          	test   $0x7,%sil
+  800df3:	75 12                	jne    800e07 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  800df5:	48 83 ef 08          	sub    $0x8,%rdi
+  800df9:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  800dfd:	48 c1 e9 03          	shr    $0x3,%rcx
+  800e01:	fd                   	std
+  800e02:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  800e05:	fc                   	cld
+  800e06:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  800e07:	48 83 ef 01          	sub    $0x1,%rdi
+  800e0b:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  800e0f:	fd                   	std
+  800e10:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  800e12:	eb f1                	jmp    800e05 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800e14:	48 89 f2             	mov    %rsi,%rdx
+  800e17:	48 09 c2             	or     %rax,%rdx
+  800e1a:	48 09 ca             	or     %rcx,%rdx
+  800e1d:	f6 c2 07             	test   $0x7,%dl
+  800e20:	75 0c                	jne    800e2e <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  800e22:	48 c1 e9 03          	shr    $0x3,%rcx
+  800e26:	48 89 c7             	mov    %rax,%rdi
+  800e29:	fc                   	cld
+  800e2a:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  800e2d:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  800e2e:	48 89 c7             	mov    %rax,%rdi
+  800e31:	fc                   	cld
+  800e32:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  800e34:	c3                   	ret
+
+0000000000800e35 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  800e35:	55                   	push   %rbp
+  800e36:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  800e39:	48 b8 ce 0d 80 00 00 	movabs $0x800dce,%rax
+  800e40:	00 00 00 
+  800e43:	ff d0                	call   *%rax
+}
+  800e45:	5d                   	pop    %rbp
+  800e46:	c3                   	ret
+
+0000000000800e47 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  800e47:	55                   	push   %rbp
+  800e48:	48 89 e5             	mov    %rsp,%rbp
+  800e4b:	41 57                	push   %r15
+  800e4d:	41 56                	push   %r14
+  800e4f:	41 55                	push   %r13
+  800e51:	41 54                	push   %r12
+  800e53:	53                   	push   %rbx
+  800e54:	48 83 ec 08          	sub    $0x8,%rsp
+  800e58:	49 89 fe             	mov    %rdi,%r14
+  800e5b:	49 89 f7             	mov    %rsi,%r15
+  800e5e:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  800e61:	48 89 f7             	mov    %rsi,%rdi
+  800e64:	48 b8 96 0b 80 00 00 	movabs $0x800b96,%rax
+  800e6b:	00 00 00 
+  800e6e:	ff d0                	call   *%rax
+  800e70:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  800e73:	48 89 de             	mov    %rbx,%rsi
+  800e76:	4c 89 f7             	mov    %r14,%rdi
+  800e79:	48 b8 b1 0b 80 00 00 	movabs $0x800bb1,%rax
+  800e80:	00 00 00 
+  800e83:	ff d0                	call   *%rax
+  800e85:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  800e88:	48 39 c3             	cmp    %rax,%rbx
+  800e8b:	74 36                	je     800ec3 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  800e8d:	48 89 d8             	mov    %rbx,%rax
+  800e90:	4c 29 e8             	sub    %r13,%rax
+  800e93:	49 39 c4             	cmp    %rax,%r12
+  800e96:	73 31                	jae    800ec9 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  800e98:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  800e9d:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800ea1:	4c 89 fe             	mov    %r15,%rsi
+  800ea4:	48 b8 35 0e 80 00 00 	movabs $0x800e35,%rax
+  800eab:	00 00 00 
+  800eae:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  800eb0:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  800eb4:	48 83 c4 08          	add    $0x8,%rsp
+  800eb8:	5b                   	pop    %rbx
+  800eb9:	41 5c                	pop    %r12
+  800ebb:	41 5d                	pop    %r13
+  800ebd:	41 5e                	pop    %r14
+  800ebf:	41 5f                	pop    %r15
+  800ec1:	5d                   	pop    %rbp
+  800ec2:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  800ec3:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800ec7:	eb eb                	jmp    800eb4 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  800ec9:	48 83 eb 01          	sub    $0x1,%rbx
+  800ecd:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800ed1:	48 89 da             	mov    %rbx,%rdx
+  800ed4:	4c 89 fe             	mov    %r15,%rsi
+  800ed7:	48 b8 35 0e 80 00 00 	movabs $0x800e35,%rax
+  800ede:	00 00 00 
+  800ee1:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  800ee3:	49 01 de             	add    %rbx,%r14
+  800ee6:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  800eeb:	eb c3                	jmp    800eb0 <strlcat+0x69>
+
+0000000000800eed <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  800eed:	48 85 d2             	test   %rdx,%rdx
+  800ef0:	74 2d                	je     800f1f <memcmp+0x32>
+  800ef2:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  800ef7:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800efb:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  800f00:	44 38 c1             	cmp    %r8b,%cl
+  800f03:	75 0f                	jne    800f14 <memcmp+0x27>
+    while (n-- > 0) {
+  800f05:	48 83 c0 01          	add    $0x1,%rax
+  800f09:	48 39 c2             	cmp    %rax,%rdx
+  800f0c:	75 e9                	jne    800ef7 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  800f0e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f13:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  800f14:	0f b6 c1             	movzbl %cl,%eax
+  800f17:	45 0f b6 c0          	movzbl %r8b,%r8d
+  800f1b:	44 29 c0             	sub    %r8d,%eax
+  800f1e:	c3                   	ret
+    return 0;
+  800f1f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800f24:	c3                   	ret
+
+0000000000800f25 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  800f25:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  800f29:	48 39 c7             	cmp    %rax,%rdi
+  800f2c:	73 0f                	jae    800f3d <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  800f2e:	40 38 37             	cmp    %sil,(%rdi)
+  800f31:	74 0e                	je     800f41 <memfind+0x1c>
+    for (; src < end; src++) {
+  800f33:	48 83 c7 01          	add    $0x1,%rdi
+  800f37:	48 39 f8             	cmp    %rdi,%rax
+  800f3a:	75 f2                	jne    800f2e <memfind+0x9>
+  800f3c:	c3                   	ret
+  800f3d:	48 89 f8             	mov    %rdi,%rax
+  800f40:	c3                   	ret
+  800f41:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  800f44:	c3                   	ret
+
+0000000000800f45 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  800f45:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  800f48:	0f b6 37             	movzbl (%rdi),%esi
+  800f4b:	40 80 fe 20          	cmp    $0x20,%sil
+  800f4f:	74 06                	je     800f57 <strtol+0x12>
+  800f51:	40 80 fe 09          	cmp    $0x9,%sil
+  800f55:	75 13                	jne    800f6a <strtol+0x25>
+  800f57:	48 83 c7 01          	add    $0x1,%rdi
+  800f5b:	0f b6 37             	movzbl (%rdi),%esi
+  800f5e:	40 80 fe 20          	cmp    $0x20,%sil
+  800f62:	74 f3                	je     800f57 <strtol+0x12>
+  800f64:	40 80 fe 09          	cmp    $0x9,%sil
+  800f68:	74 ed                	je     800f57 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  800f6a:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  800f6d:	83 e0 fd             	and    $0xfffffffd,%eax
+  800f70:	3c 01                	cmp    $0x1,%al
+  800f72:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  800f76:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  800f7c:	75 0f                	jne    800f8d <strtol+0x48>
+  800f7e:	80 3f 30             	cmpb   $0x30,(%rdi)
+  800f81:	74 14                	je     800f97 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  800f83:	85 d2                	test   %edx,%edx
+  800f85:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800f8a:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  800f8d:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  800f92:	4c 63 ca             	movslq %edx,%r9
+  800f95:	eb 36                	jmp    800fcd <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  800f97:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  800f9b:	74 0f                	je     800fac <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  800f9d:	85 d2                	test   %edx,%edx
+  800f9f:	75 ec                	jne    800f8d <strtol+0x48>
+        s++;
+  800fa1:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  800fa5:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  800faa:	eb e1                	jmp    800f8d <strtol+0x48>
+        s += 2;
+  800fac:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  800fb0:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  800fb5:	eb d6                	jmp    800f8d <strtol+0x48>
+            dig -= '0';
+  800fb7:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  800fba:	44 0f b6 c1          	movzbl %cl,%r8d
+  800fbe:	41 39 d0             	cmp    %edx,%r8d
+  800fc1:	7d 21                	jge    800fe4 <strtol+0x9f>
+        val = val * base + dig;
+  800fc3:	49 0f af c1          	imul   %r9,%rax
+  800fc7:	0f b6 c9             	movzbl %cl,%ecx
+  800fca:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  800fcd:	48 83 c7 01          	add    $0x1,%rdi
+  800fd1:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  800fd5:	80 f9 39             	cmp    $0x39,%cl
+  800fd8:	76 dd                	jbe    800fb7 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  800fda:	80 f9 7b             	cmp    $0x7b,%cl
+  800fdd:	77 05                	ja     800fe4 <strtol+0x9f>
+            dig -= 'a' - 10;
+  800fdf:	83 e9 57             	sub    $0x57,%ecx
+  800fe2:	eb d6                	jmp    800fba <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  800fe4:	4d 85 d2             	test   %r10,%r10
+  800fe7:	74 03                	je     800fec <strtol+0xa7>
+  800fe9:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  800fec:	48 89 c2             	mov    %rax,%rdx
+  800fef:	48 f7 da             	neg    %rdx
+  800ff2:	40 80 fe 2d          	cmp    $0x2d,%sil
+  800ff6:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  800ffa:	c3                   	ret
+
+0000000000800ffb <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  800ffb:	55                   	push   %rbp
+  800ffc:	48 89 e5             	mov    %rsp,%rbp
+  800fff:	53                   	push   %rbx
+  801000:	48 89 fa             	mov    %rdi,%rdx
+  801003:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801006:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80100b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801010:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801015:	be 00 00 00 00       	mov    $0x0,%esi
+  80101a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801020:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  801022:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801026:	c9                   	leave
+  801027:	c3                   	ret
+
+0000000000801028 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  801028:	55                   	push   %rbp
+  801029:	48 89 e5             	mov    %rsp,%rbp
+  80102c:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80102d:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801032:	ba 00 00 00 00       	mov    $0x0,%edx
+  801037:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80103c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801041:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801046:	be 00 00 00 00       	mov    $0x0,%esi
+  80104b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801051:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  801053:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801057:	c9                   	leave
+  801058:	c3                   	ret
+
+0000000000801059 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  801059:	55                   	push   %rbp
+  80105a:	48 89 e5             	mov    %rsp,%rbp
+  80105d:	53                   	push   %rbx
+  80105e:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  801062:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801065:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80106a:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80106f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801074:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801079:	be 00 00 00 00       	mov    $0x0,%esi
+  80107e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801084:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801086:	48 85 c0             	test   %rax,%rax
+  801089:	7f 06                	jg     801091 <sys_env_destroy+0x38>
+}
+  80108b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80108f:	c9                   	leave
+  801090:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801091:	49 89 c0             	mov    %rax,%r8
+  801094:	b9 03 00 00 00       	mov    $0x3,%ecx
+  801099:	48 ba 70 34 80 00 00 	movabs $0x803470,%rdx
+  8010a0:	00 00 00 
+  8010a3:	be 26 00 00 00       	mov    $0x26,%esi
+  8010a8:	48 bf 8f 34 80 00 00 	movabs $0x80348f,%rdi
+  8010af:	00 00 00 
+  8010b2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010b7:	49 b9 41 2e 80 00 00 	movabs $0x802e41,%r9
+  8010be:	00 00 00 
+  8010c1:	41 ff d1             	call   *%r9
+
+00000000008010c4 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  8010c4:	55                   	push   %rbp
+  8010c5:	48 89 e5             	mov    %rsp,%rbp
+  8010c8:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8010c9:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8010ce:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010d3:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8010d8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010dd:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8010e2:	be 00 00 00 00       	mov    $0x0,%esi
+  8010e7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8010ed:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  8010ef:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8010f3:	c9                   	leave
+  8010f4:	c3                   	ret
+
+00000000008010f5 <sys_yield>:
+
+void
+sys_yield(void) {
+  8010f5:	55                   	push   %rbp
+  8010f6:	48 89 e5             	mov    %rsp,%rbp
+  8010f9:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8010fa:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8010ff:	ba 00 00 00 00       	mov    $0x0,%edx
+  801104:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801109:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80110e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801113:	be 00 00 00 00       	mov    $0x0,%esi
+  801118:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80111e:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  801120:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801124:	c9                   	leave
+  801125:	c3                   	ret
+
+0000000000801126 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  801126:	55                   	push   %rbp
+  801127:	48 89 e5             	mov    %rsp,%rbp
+  80112a:	53                   	push   %rbx
+  80112b:	48 89 fa             	mov    %rdi,%rdx
+  80112e:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801131:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801136:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  80113d:	00 00 00 
+  801140:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801145:	be 00 00 00 00       	mov    $0x0,%esi
+  80114a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801150:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  801152:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801156:	c9                   	leave
+  801157:	c3                   	ret
+
+0000000000801158 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  801158:	55                   	push   %rbp
+  801159:	48 89 e5             	mov    %rsp,%rbp
+  80115c:	53                   	push   %rbx
+  80115d:	49 89 f8             	mov    %rdi,%r8
+  801160:	48 89 d3             	mov    %rdx,%rbx
+  801163:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801166:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80116b:	4c 89 c2             	mov    %r8,%rdx
+  80116e:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801171:	be 00 00 00 00       	mov    $0x0,%esi
+  801176:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80117c:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  80117e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801182:	c9                   	leave
+  801183:	c3                   	ret
+
+0000000000801184 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  801184:	55                   	push   %rbp
+  801185:	48 89 e5             	mov    %rsp,%rbp
+  801188:	53                   	push   %rbx
+  801189:	48 83 ec 08          	sub    $0x8,%rsp
+  80118d:	89 f8                	mov    %edi,%eax
+  80118f:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  801192:	48 63 f9             	movslq %ecx,%rdi
+  801195:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801198:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80119d:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8011a0:	be 00 00 00 00       	mov    $0x0,%esi
+  8011a5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8011ab:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8011ad:	48 85 c0             	test   %rax,%rax
+  8011b0:	7f 06                	jg     8011b8 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  8011b2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8011b6:	c9                   	leave
+  8011b7:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8011b8:	49 89 c0             	mov    %rax,%r8
+  8011bb:	b9 04 00 00 00       	mov    $0x4,%ecx
+  8011c0:	48 ba 70 34 80 00 00 	movabs $0x803470,%rdx
+  8011c7:	00 00 00 
+  8011ca:	be 26 00 00 00       	mov    $0x26,%esi
+  8011cf:	48 bf 8f 34 80 00 00 	movabs $0x80348f,%rdi
+  8011d6:	00 00 00 
+  8011d9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011de:	49 b9 41 2e 80 00 00 	movabs $0x802e41,%r9
+  8011e5:	00 00 00 
+  8011e8:	41 ff d1             	call   *%r9
+
+00000000008011eb <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8011eb:	55                   	push   %rbp
+  8011ec:	48 89 e5             	mov    %rsp,%rbp
+  8011ef:	53                   	push   %rbx
+  8011f0:	48 83 ec 08          	sub    $0x8,%rsp
+  8011f4:	89 f8                	mov    %edi,%eax
+  8011f6:	49 89 f2             	mov    %rsi,%r10
+  8011f9:	48 89 cf             	mov    %rcx,%rdi
+  8011fc:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  8011ff:	48 63 da             	movslq %edx,%rbx
+  801202:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801205:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80120a:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80120d:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  801210:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801212:	48 85 c0             	test   %rax,%rax
+  801215:	7f 06                	jg     80121d <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  801217:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80121b:	c9                   	leave
+  80121c:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80121d:	49 89 c0             	mov    %rax,%r8
+  801220:	b9 05 00 00 00       	mov    $0x5,%ecx
+  801225:	48 ba 70 34 80 00 00 	movabs $0x803470,%rdx
+  80122c:	00 00 00 
+  80122f:	be 26 00 00 00       	mov    $0x26,%esi
+  801234:	48 bf 8f 34 80 00 00 	movabs $0x80348f,%rdi
+  80123b:	00 00 00 
+  80123e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801243:	49 b9 41 2e 80 00 00 	movabs $0x802e41,%r9
+  80124a:	00 00 00 
+  80124d:	41 ff d1             	call   *%r9
+
+0000000000801250 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  801250:	55                   	push   %rbp
+  801251:	48 89 e5             	mov    %rsp,%rbp
+  801254:	53                   	push   %rbx
+  801255:	48 83 ec 08          	sub    $0x8,%rsp
+  801259:	48 89 f1             	mov    %rsi,%rcx
+  80125c:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  80125f:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801262:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801267:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80126c:	be 00 00 00 00       	mov    $0x0,%esi
+  801271:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801277:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801279:	48 85 c0             	test   %rax,%rax
+  80127c:	7f 06                	jg     801284 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  80127e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801282:	c9                   	leave
+  801283:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801284:	49 89 c0             	mov    %rax,%r8
+  801287:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80128c:	48 ba 70 34 80 00 00 	movabs $0x803470,%rdx
+  801293:	00 00 00 
+  801296:	be 26 00 00 00       	mov    $0x26,%esi
+  80129b:	48 bf 8f 34 80 00 00 	movabs $0x80348f,%rdi
+  8012a2:	00 00 00 
+  8012a5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012aa:	49 b9 41 2e 80 00 00 	movabs $0x802e41,%r9
+  8012b1:	00 00 00 
+  8012b4:	41 ff d1             	call   *%r9
+
+00000000008012b7 <sys_region_batch>:
+
+int
+sys_region_batch(const struct RegionOp *ops, size_t count) {
+  8012b7:	55                   	push   %rbp
+  8012b8:	48 89 e5             	mov    %rsp,%rbp
+  8012bb:	53                   	push   %rbx
+  8012bc:	48 83 ec 08          	sub    $0x8,%rsp
+  8012c0:	48 89 fa             	mov    %rdi,%rdx
+  8012c3:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8012c6:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8012cb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012d0:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012d5:	be 00 00 00 00       	mov    $0x0,%esi
+  8012da:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8012e0:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8012e2:	48 85 c0             	test   %rax,%rax
+  8012e5:	7f 06                	jg     8012ed <sys_region_batch+0x36>
+        else
+            platform_asan_unpoison(va, ops[i].size);
+    }
+#endif
+    return res;
+}
+  8012e7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012eb:	c9                   	leave
+  8012ec:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8012ed:	49 89 c0             	mov    %rax,%r8
+  8012f0:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  8012f5:	48 ba 70 34 80 00 00 	movabs $0x803470,%rdx
+  8012fc:	00 00 00 
+  8012ff:	be 26 00 00 00       	mov    $0x26,%esi
+  801304:	48 bf 8f 34 80 00 00 	movabs $0x80348f,%rdi
+  80130b:	00 00 00 
+  80130e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801313:	49 b9 41 2e 80 00 00 	movabs $0x802e41,%r9
+  80131a:	00 00 00 
+  80131d:	41 ff d1             	call   *%r9
+
+0000000000801320 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  801320:	55                   	push   %rbp
+  801321:	48 89 e5             	mov    %rsp,%rbp
+  801324:	53                   	push   %rbx
+  801325:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  801329:	48 63 ce             	movslq %esi,%rcx
+  80132c:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80132f:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801334:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801339:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80133e:	be 00 00 00 00       	mov    $0x0,%esi
+  801343:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801349:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80134b:	48 85 c0             	test   %rax,%rax
+  80134e:	7f 06                	jg     801356 <sys_env_set_status+0x36>
+}
+  801350:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801354:	c9                   	leave
+  801355:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801356:	49 89 c0             	mov    %rax,%r8
+  801359:	b9 09 00 00 00       	mov    $0x9,%ecx
+  80135e:	48 ba 70 34 80 00 00 	movabs $0x803470,%rdx
+  801365:	00 00 00 
+  801368:	be 26 00 00 00       	mov    $0x26,%esi
+  80136d:	48 bf 8f 34 80 00 00 	movabs $0x80348f,%rdi
+  801374:	00 00 00 
+  801377:	b8 00 00 00 00       	mov    $0x0,%eax
+  80137c:	49 b9 41 2e 80 00 00 	movabs $0x802e41,%r9
+  801383:	00 00 00 
+  801386:	41 ff d1             	call   *%r9
+
+0000000000801389 <sys_env_set_weight>:
+
+int
+sys_env_set_weight(envid_t envid, uint32_t weight) {
+  801389:	55                   	push   %rbp
+  80138a:	48 89 e5             	mov    %rsp,%rbp
+  80138d:	53                   	push   %rbx
+  80138e:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_weight, 1, envid, weight, 0, 0, 0, 0);
+  801392:	89 f1                	mov    %esi,%ecx
+  801394:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801397:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80139c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013a1:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013a6:	be 00 00 00 00       	mov    $0x0,%esi
+  8013ab:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013b1:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8013b3:	48 85 c0             	test   %rax,%rax
+  8013b6:	7f 06                	jg     8013be <sys_env_set_weight+0x35>
+}
+  8013b8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013bc:	c9                   	leave
+  8013bd:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8013be:	49 89 c0             	mov    %rax,%r8
+  8013c1:	b9 10 00 00 00       	mov    $0x10,%ecx
+  8013c6:	48 ba 70 34 80 00 00 	movabs $0x803470,%rdx
+  8013cd:	00 00 00 
+  8013d0:	be 26 00 00 00       	mov    $0x26,%esi
+  8013d5:	48 bf 8f 34 80 00 00 	movabs $0x80348f,%rdi
+  8013dc:	00 00 00 
+  8013df:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013e4:	49 b9 41 2e 80 00 00 	movabs $0x802e41,%r9
+  8013eb:	00 00 00 
+  8013ee:	41 ff d1             	call   *%r9
+
+00000000008013f1 <sys_env_set_rt>:
+
+int
+sys_env_set_rt(envid_t envid, uint64_t period, uint64_t budget, uint64_t deadline) {
+  8013f1:	55                   	push   %rbp
+  8013f2:	48 89 e5             	mov    %rsp,%rbp
+  8013f5:	53                   	push   %rbx
+  8013f6:	48 83 ec 08          	sub    $0x8,%rsp
+  8013fa:	89 f8                	mov    %edi,%eax
+  8013fc:	48 89 d3             	mov    %rdx,%rbx
+  8013ff:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_env_set_rt, 1, envid, period, budget, deadline, 0, 0);
+  801402:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801405:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80140a:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80140d:	be 00 00 00 00       	mov    $0x0,%esi
+  801412:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801418:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80141a:	48 85 c0             	test   %rax,%rax
+  80141d:	7f 06                	jg     801425 <sys_env_set_rt+0x34>
+}
+  80141f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801423:	c9                   	leave
+  801424:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801425:	49 89 c0             	mov    %rax,%r8
+  801428:	b9 11 00 00 00       	mov    $0x11,%ecx
+  80142d:	48 ba 70 34 80 00 00 	movabs $0x803470,%rdx
+  801434:	00 00 00 
+  801437:	be 26 00 00 00       	mov    $0x26,%esi
+  80143c:	48 bf 8f 34 80 00 00 	movabs $0x80348f,%rdi
+  801443:	00 00 00 
+  801446:	b8 00 00 00 00       	mov    $0x0,%eax
+  80144b:	49 b9 41 2e 80 00 00 	movabs $0x802e41,%r9
+  801452:	00 00 00 
+  801455:	41 ff d1             	call   *%r9
+
+0000000000801458 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  801458:	55                   	push   %rbp
+  801459:	48 89 e5             	mov    %rsp,%rbp
+  80145c:	53                   	push   %rbx
+  80145d:	48 83 ec 08          	sub    $0x8,%rsp
+  801461:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  801464:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801467:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80146c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801471:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801476:	be 00 00 00 00       	mov    $0x0,%esi
+  80147b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801481:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801483:	48 85 c0             	test   %rax,%rax
+  801486:	7f 06                	jg     80148e <sys_env_set_trapframe+0x36>
+}
+  801488:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80148c:	c9                   	leave
+  80148d:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80148e:	49 89 c0             	mov    %rax,%r8
+  801491:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  801496:	48 ba 70 34 80 00 00 	movabs $0x803470,%rdx
+  80149d:	00 00 00 
+  8014a0:	be 26 00 00 00       	mov    $0x26,%esi
+  8014a5:	48 bf 8f 34 80 00 00 	movabs $0x80348f,%rdi
+  8014ac:	00 00 00 
+  8014af:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014b4:	49 b9 41 2e 80 00 00 	movabs $0x802e41,%r9
+  8014bb:	00 00 00 
+  8014be:	41 ff d1             	call   *%r9
+
+00000000008014c1 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  8014c1:	55                   	push   %rbp
+  8014c2:	48 89 e5             	mov    %rsp,%rbp
+  8014c5:	53                   	push   %rbx
+  8014c6:	48 83 ec 08          	sub    $0x8,%rsp
+  8014ca:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  8014cd:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8014d0:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8014d5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014da:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014df:	be 00 00 00 00       	mov    $0x0,%esi
+  8014e4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014ea:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8014ec:	48 85 c0             	test   %rax,%rax
+  8014ef:	7f 06                	jg     8014f7 <sys_env_set_pgfault_upcall+0x36>
+}
+  8014f1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014f5:	c9                   	leave
+  8014f6:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8014f7:	49 89 c0             	mov    %rax,%r8
+  8014fa:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  8014ff:	48 ba 70 34 80 00 00 	movabs $0x803470,%rdx
+  801506:	00 00 00 
+  801509:	be 26 00 00 00       	mov    $0x26,%esi
+  80150e:	48 bf 8f 34 80 00 00 	movabs $0x80348f,%rdi
+  801515:	00 00 00 
+  801518:	b8 00 00 00 00       	mov    $0x0,%eax
+  80151d:	49 b9 41 2e 80 00 00 	movabs $0x802e41,%r9
+  801524:	00 00 00 
+  801527:	41 ff d1             	call   *%r9
+
+000000000080152a <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  80152a:	55                   	push   %rbp
+  80152b:	48 89 e5             	mov    %rsp,%rbp
+  80152e:	53                   	push   %rbx
+  80152f:	89 f8                	mov    %edi,%eax
+  801531:	49 89 f1             	mov    %rsi,%r9
+  801534:	48 89 d3             	mov    %rdx,%rbx
+  801537:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  80153a:	49 63 f0             	movslq %r8d,%rsi
+  80153d:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801540:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801545:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801548:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80154e:	cd 30                	int    $0x30
+}
+  801550:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801554:	c9                   	leave
+  801555:	c3                   	ret
+
+0000000000801556 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  801556:	55                   	push   %rbp
+  801557:	48 89 e5             	mov    %rsp,%rbp
+  80155a:	53                   	push   %rbx
+  80155b:	48 83 ec 08          	sub    $0x8,%rsp
+  80155f:	48 89 fa             	mov    %rdi,%rdx
+  801562:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801565:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80156a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80156f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801574:	be 00 00 00 00       	mov    $0x0,%esi
+  801579:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80157f:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801581:	48 85 c0             	test   %rax,%rax
+  801584:	7f 06                	jg     80158c <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801586:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80158a:	c9                   	leave
+  80158b:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80158c:	49 89 c0             	mov    %rax,%r8
+  80158f:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  801594:	48 ba 70 34 80 00 00 	movabs $0x803470,%rdx
+  80159b:	00 00 00 
+  80159e:	be 26 00 00 00       	mov    $0x26,%esi
+  8015a3:	48 bf 8f 34 80 00 00 	movabs $0x80348f,%rdi
+  8015aa:	00 00 00 
+  8015ad:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015b2:	49 b9 41 2e 80 00 00 	movabs $0x802e41,%r9
+  8015b9:	00 00 00 
+  8015bc:	41 ff d1             	call   *%r9
+
+00000000008015bf <fork>:
+ * Hint:
+ *   Use sys_map_region, it can perform address space copying in one call
+ *   Remember to fix "thisenv" in the child process.
+ */
+envid_t
+fork(void) {
+  8015bf:	55                   	push   %rbp
+  8015c0:	48 89 e5             	mov    %rsp,%rbp
+  8015c3:	41 55                	push   %r13
+  8015c5:	41 54                	push   %r12
+  8015c7:	53                   	push   %rbx
+  8015c8:	48 83 ec 08          	sub    $0x8,%rsp
+
+/* This must be inlined. Exercise for reader: why? */
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+    envid_t ret;
+    asm volatile("int %2"
+  8015cc:	b8 08 00 00 00       	mov    $0x8,%eax
+  8015d1:	cd 30                	int    $0x30
+  8015d3:	41 89 c5             	mov    %eax,%r13d
+    // LAB 9: Your code here
+
+    envid_t child_id = sys_exofork();
+    if (child_id < 0) {
+  8015d6:	85 c0                	test   %eax,%eax
+  8015d8:	0f 88 ae 00 00 00    	js     80168c <fork+0xcd>
+  8015de:	89 c3                	mov    %eax,%ebx
+        return child_id;
+    }
+    if (child_id == 0) {
+  8015e0:	0f 84 b4 00 00 00    	je     80169a <fork+0xdb>
+        thisenv = &envs[ENVX(sys_getenvid())];
+        return 0;
+    }
+    int res = sys_map_region(0, NULL, child_id, NULL, MAX_USER_ADDRESS, PROT_ALL | PROT_LAZY | PROT_COMBINE);
+  8015e6:	41 b9 df 01 00 00    	mov    $0x1df,%r9d
+  8015ec:	49 b8 00 00 00 00 80 	movabs $0x8000000000,%r8
+  8015f3:	00 00 00 
+  8015f6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8015fb:	89 c2                	mov    %eax,%edx
+  8015fd:	be 00 00 00 00       	mov    $0x0,%esi
+  801602:	bf 00 00 00 00       	mov    $0x0,%edi
+  801607:	48 b8 eb 11 80 00 00 	movabs $0x8011eb,%rax
+  80160e:	00 00 00 
+  801611:	ff d0                	call   *%rax
+  801613:	41 89 c4             	mov    %eax,%r12d
+    if (res < 0) {
+  801616:	85 c0                	test   %eax,%eax
+  801618:	78 5d                	js     801677 <fork+0xb8>
+        goto error;
+    }
+    res = sys_env_set_pgfault_upcall(child_id, envs[ENVX(sys_getenvid())].env_pgfault_upcall);
+  80161a:	48 b8 c4 10 80 00 00 	movabs $0x8010c4,%rax
+  801621:	00 00 00 
+  801624:	ff d0                	call   *%rax
+  801626:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80162b:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+  801632:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  801639:	00 00 00 
+  80163c:	48 01 d0             	add    %rdx,%rax
+  80163f:	48 8b b0 88 01 00 00 	mov    0x188(%rax),%rsi
+  801646:	44 89 ef             	mov    %r13d,%edi
+  801649:	48 b8 c1 14 80 00 00 	movabs $0x8014c1,%rax
+  801650:	00 00 00 
+  801653:	ff d0                	call   *%rax
+  801655:	41 89 c4             	mov    %eax,%r12d
+    if (res < 0) {
+  801658:	85 c0                	test   %eax,%eax
+  80165a:	78 1b                	js     801677 <fork+0xb8>
+        goto error;
+    }
+    res = sys_env_set_status(child_id, ENV_RUNNABLE);
+  80165c:	be 02 00 00 00       	mov    $0x2,%esi
+  801661:	44 89 ef             	mov    %r13d,%edi
+  801664:	48 b8 20 13 80 00 00 	movabs $0x801320,%rax
+  80166b:	00 00 00 
+  80166e:	ff d0                	call   *%rax
+  801670:	41 89 c4             	mov    %eax,%r12d
+    if (res < 0) {
+  801673:	85 c0                	test   %eax,%eax
+  801675:	79 15                	jns    80168c <fork+0xcd>
+        goto error;
+    }
+    return child_id;
+error:
+    ;
+    int res2 = sys_env_destroy(child_id);
+  801677:	89 df                	mov    %ebx,%edi
+  801679:	48 b8 59 10 80 00 00 	movabs $0x801059,%rax
+  801680:	00 00 00 
+  801683:	ff d0                	call   *%rax
+    if (res2 < 0) {
+  801685:	85 c0                	test   %eax,%eax
+  801687:	78 42                	js     8016cb <fork+0x10c>
+        panic("Fork double fault");
+    }
+    return res;
+  801689:	45 89 e5             	mov    %r12d,%r13d
+}
+  80168c:	44 89 e8             	mov    %r13d,%eax
+  80168f:	48 83 c4 08          	add    $0x8,%rsp
+  801693:	5b                   	pop    %rbx
+  801694:	41 5c                	pop    %r12
+  801696:	41 5d                	pop    %r13
+  801698:	5d                   	pop    %rbp
+  801699:	c3                   	ret
+        thisenv = &envs[ENVX(sys_getenvid())];
+  80169a:	48 b8 c4 10 80 00 00 	movabs $0x8010c4,%rax
+  8016a1:	00 00 00 
+  8016a4:	ff d0                	call   *%rax
+  8016a6:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8016ab:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+  8016b2:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8016b9:	00 00 00 
+  8016bc:	48 01 d0             	add    %rdx,%rax
+  8016bf:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  8016c6:	00 00 00 
+        return 0;
+  8016c9:	eb c1                	jmp    80168c <fork+0xcd>
+        panic("Fork double fault");
+  8016cb:	48 ba 9d 34 80 00 00 	movabs $0x80349d,%rdx
+  8016d2:	00 00 00 
+  8016d5:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8016da:	48 bf af 34 80 00 00 	movabs $0x8034af,%rdi
+  8016e1:	00 00 00 
+  8016e4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016e9:	48 b9 41 2e 80 00 00 	movabs $0x802e41,%rcx
+  8016f0:	00 00 00 
+  8016f3:	ff d1                	call   *%rcx
+
+00000000008016f5 <sfork>:
+
+envid_t
+sfork() {
+  8016f5:	55                   	push   %rbp
+  8016f6:	48 89 e5             	mov    %rsp,%rbp
+    panic("sfork() is not implemented");
+  8016f9:	48 ba ba 34 80 00 00 	movabs $0x8034ba,%rdx
+  801700:	00 00 00 
+  801703:	be 36 00 00 00       	mov    $0x36,%esi
+  801708:	48 bf af 34 80 00 00 	movabs $0x8034af,%rdi
+  80170f:	00 00 00 
+  801712:	b8 00 00 00 00       	mov    $0x0,%eax
+  801717:	48 b9 41 2e 80 00 00 	movabs $0x802e41,%rcx
+  80171e:	00 00 00 
+  801721:	ff d1                	call   *%rcx
+
+0000000000801723 <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  801723:	55                   	push   %rbp
+  801724:	48 89 e5             	mov    %rsp,%rbp
+  801727:	41 55                	push   %r13
+  801729:	41 54                	push   %r12
+  80172b:	53                   	push   %rbx
+  80172c:	48 83 ec 08          	sub    $0x8,%rsp
+  801730:	49 89 fc             	mov    %rdi,%r12
+  801733:	48 89 f7             	mov    %rsi,%rdi
+  801736:	48 89 d3             	mov    %rdx,%rbx
+  801739:	49 89 cd             	mov    %rcx,%r13
+    // LAB 9: Your code here:
+    int res = sys_ipc_recv(!pg ? (void*)MAX_USER_ADDRESS : pg, !size ? 0 : *size);
+  80173c:	be 00 00 00 00       	mov    $0x0,%esi
+  801741:	48 85 d2             	test   %rdx,%rdx
+  801744:	74 03                	je     801749 <ipc_recv+0x26>
+  801746:	48 8b 32             	mov    (%rdx),%rsi
+  801749:	48 85 ff             	test   %rdi,%rdi
+  80174c:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  801753:	00 00 00 
+  801756:	48 0f 44 f8          	cmove  %rax,%rdi
+  80175a:	48 b8 56 15 80 00 00 	movabs $0x801556,%rax
+  801761:	00 00 00 
+  801764:	ff d0                	call   *%rax
+    if (res < 0) {
+  801766:	85 c0                	test   %eax,%eax
+  801768:	78 66                	js     8017d0 <ipc_recv+0xad>
+        if (size) {
+            *size = 0;
+        }
+        return res;
+    }
+    if (from_env_store) {
+  80176a:	4d 85 e4             	test   %r12,%r12
+  80176d:	74 14                	je     801783 <ipc_recv+0x60>
+        *from_env_store = thisenv->env_ipc_from;
+  80176f:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801776:	00 00 00 
+  801779:	8b 80 ac 01 00 00    	mov    0x1ac(%rax),%eax
+  80177f:	41 89 04 24          	mov    %eax,(%r12)
+    }
+    if (perm_store) {
+  801783:	4d 85 ed             	test   %r13,%r13
+  801786:	74 14                	je     80179c <ipc_recv+0x79>
+        *perm_store = thisenv->env_ipc_perm;
+  801788:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  80178f:	00 00 00 
+  801792:	8b 80 b0 01 00 00    	mov    0x1b0(%rax),%eax
+  801798:	41 89 45 00          	mov    %eax,0x0(%r13)
+    }
+    if (size) {
+  80179c:	48 85 db             	test   %rbx,%rbx
+  80179f:	74 14                	je     8017b5 <ipc_recv+0x92>
+        *size = thisenv->env_ipc_maxsz;
+  8017a1:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  8017a8:	00 00 00 
+  8017ab:	48 8b 80 a0 01 00 00 	mov    0x1a0(%rax),%rax
+  8017b2:	48 89 03             	mov    %rax,(%rbx)
+    }
+    return thisenv->env_ipc_value;
+  8017b5:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  8017bc:	00 00 00 
+  8017bf:	8b 80 a8 01 00 00    	mov    0x1a8(%rax),%eax
+}
+  8017c5:	48 83 c4 08          	add    $0x8,%rsp
+  8017c9:	5b                   	pop    %rbx
+  8017ca:	41 5c                	pop    %r12
+  8017cc:	41 5d                	pop    %r13
+  8017ce:	5d                   	pop    %rbp
+  8017cf:	c3                   	ret
+        if (from_env_store) {
+  8017d0:	4d 85 e4             	test   %r12,%r12
+  8017d3:	74 08                	je     8017dd <ipc_recv+0xba>
+            *from_env_store = 0;
+  8017d5:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  8017dc:	00 
+        if (perm_store) {
+  8017dd:	4d 85 ed             	test   %r13,%r13
+  8017e0:	74 08                	je     8017ea <ipc_recv+0xc7>
+            *perm_store = 0;
+  8017e2:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  8017e9:	00 
+        if (size) {
+  8017ea:	48 85 db             	test   %rbx,%rbx
+  8017ed:	74 d6                	je     8017c5 <ipc_recv+0xa2>
+            *size = 0;
+  8017ef:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  8017f6:	eb cd                	jmp    8017c5 <ipc_recv+0xa2>
+
+00000000008017f8 <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  8017f8:	55                   	push   %rbp
+  8017f9:	48 89 e5             	mov    %rsp,%rbp
+  8017fc:	41 57                	push   %r15
+  8017fe:	41 56                	push   %r14
+  801800:	41 55                	push   %r13
+  801802:	41 54                	push   %r12
+  801804:	53                   	push   %rbx
+  801805:	48 83 ec 18          	sub    $0x18,%rsp
+  801809:	41 89 fd             	mov    %edi,%r13d
+  80180c:	89 75 cc             	mov    %esi,-0x34(%rbp)
+  80180f:	49 89 cc             	mov    %rcx,%r12
+  801812:	44 89 45 c8          	mov    %r8d,-0x38(%rbp)
+    // LAB 9: Your code here:
+    int res = 0;
+    while ((res = sys_ipc_try_send(to_env, val, !pg ? (void*)MAX_USER_ADDRESS : pg, size, perm)) < 0) {
+  801816:	48 85 d2             	test   %rdx,%rdx
+  801819:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  801820:	00 00 00 
+  801823:	48 0f 45 c2          	cmovne %rdx,%rax
+  801827:	48 89 c3             	mov    %rax,%rbx
+  80182a:	49 be 2a 15 80 00 00 	movabs $0x80152a,%r14
+  801831:	00 00 00 
+        if (res != -E_IPC_NOT_RECV) {
+            panic("sys_ipc_try_send failed: %i", res);
+        }
+        sys_yield();
+  801834:	49 bf f5 10 80 00 00 	movabs $0x8010f5,%r15
+  80183b:	00 00 00 
+    while ((res = sys_ipc_try_send(to_env, val, !pg ? (void*)MAX_USER_ADDRESS : pg, size, perm)) < 0) {
+  80183e:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  801841:	44 8b 45 c8          	mov    -0x38(%rbp),%r8d
+  801845:	4c 89 e1             	mov    %r12,%rcx
+  801848:	48 89 da             	mov    %rbx,%rdx
+  80184b:	44 89 ef             	mov    %r13d,%edi
+  80184e:	41 ff d6             	call   *%r14
+  801851:	85 c0                	test   %eax,%eax
+  801853:	79 37                	jns    80188c <ipc_send+0x94>
+        if (res != -E_IPC_NOT_RECV) {
+  801855:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  801858:	75 05                	jne    80185f <ipc_send+0x67>
+        sys_yield();
+  80185a:	41 ff d7             	call   *%r15
+  80185d:	eb df                	jmp    80183e <ipc_send+0x46>
+            panic("sys_ipc_try_send failed: %i", res);
+  80185f:	89 c1                	mov    %eax,%ecx
+  801861:	48 ba d5 34 80 00 00 	movabs $0x8034d5,%rdx
+  801868:	00 00 00 
+  80186b:	be 40 00 00 00       	mov    $0x40,%esi
+  801870:	48 bf f1 34 80 00 00 	movabs $0x8034f1,%rdi
+  801877:	00 00 00 
+  80187a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80187f:	49 b8 41 2e 80 00 00 	movabs $0x802e41,%r8
+  801886:	00 00 00 
+  801889:	41 ff d0             	call   *%r8
+    }
+    return;
+}
+  80188c:	48 83 c4 18          	add    $0x18,%rsp
+  801890:	5b                   	pop    %rbx
+  801891:	41 5c                	pop    %r12
+  801893:	41 5d                	pop    %r13
+  801895:	41 5e                	pop    %r14
+  801897:	41 5f                	pop    %r15
+  801899:	5d                   	pop    %rbp
+  80189a:	c3                   	ret
+
+000000000080189b <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  80189b:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  8018a0:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  8018a7:	00 00 00 
+  8018aa:	48 69 d0 d0 01 00 00 	imul   $0x1d0,%rax,%rdx
+  8018b1:	48 01 ca             	add    %rcx,%rdx
+  8018b4:	8b 92 e8 00 00 00    	mov    0xe8(%rdx),%edx
+  8018ba:	39 fa                	cmp    %edi,%edx
+  8018bc:	74 12                	je     8018d0 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  8018be:	48 83 c0 01          	add    $0x1,%rax
+  8018c2:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  8018c8:	75 e0                	jne    8018aa <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  8018ca:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8018cf:	c3                   	ret
+            return envs[i].env_id;
+  8018d0:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+  8018d7:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8018de:	00 00 00 
+  8018e1:	48 01 d0             	add    %rdx,%rax
+  8018e4:	8b 80 e0 00 00 00    	mov    0xe0(%rax),%eax
+  8018ea:	c3                   	ret
+
+00000000008018eb <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8018eb:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8018f2:	ff ff ff 
+  8018f5:	48 01 f8             	add    %rdi,%rax
+  8018f8:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  8018fc:	c3                   	ret
+
+00000000008018fd <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8018fd:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801904:	ff ff ff 
+  801907:	48 01 f8             	add    %rdi,%rax
+  80190a:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  80190e:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  801914:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  801918:	c3                   	ret
+
+0000000000801919 <fd_alloc_from>:
+}
+
+/* Like fd_alloc(), but only considers fds starting from fdnum,
+ * so that several fds can be found before their pages are allocated */
+int
+fd_alloc_from(int fdnum, struct Fd **fd_store) {
+  801919:	55                   	push   %rbp
+  80191a:	48 89 e5             	mov    %rsp,%rbp
+  80191d:	41 57                	push   %r15
+  80191f:	41 56                	push   %r14
+  801921:	41 55                	push   %r13
+  801923:	41 54                	push   %r12
+  801925:	53                   	push   %rbx
+  801926:	48 83 ec 08          	sub    $0x8,%rsp
+  80192a:	49 89 f7             	mov    %rsi,%r15
+    for (int i = MAX(fdnum, 0); i < MAXFD; i++) {
+  80192d:	85 ff                	test   %edi,%edi
+  80192f:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  801935:	44 0f 49 e7          	cmovns %edi,%r12d
+  801939:	83 ff 1f             	cmp    $0x1f,%edi
+  80193c:	7f 37                	jg     801975 <fd_alloc_from+0x5c>
+  80193e:	49 63 dc             	movslq %r12d,%rbx
+  801941:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  801948:	48 c1 e3 0c          	shl    $0xc,%rbx
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  80194c:	49 be 22 2a 80 00 00 	movabs $0x802a22,%r14
+  801953:	00 00 00 
+        struct Fd *fd = INDEX2FD(i);
+  801956:	49 89 dd             	mov    %rbx,%r13
+        if (!(get_prot(fd) & PROT_R)) {
+  801959:	48 89 df             	mov    %rbx,%rdi
+  80195c:	41 ff d6             	call   *%r14
+  80195f:	83 e0 04             	and    $0x4,%eax
+  801962:	74 1c                	je     801980 <fd_alloc_from+0x67>
+    for (int i = MAX(fdnum, 0); i < MAXFD; i++) {
+  801964:	41 83 c4 01          	add    $0x1,%r12d
+  801968:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  80196f:	41 83 fc 1f          	cmp    $0x1f,%r12d
+  801973:	7e e1                	jle    801956 <fd_alloc_from+0x3d>
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  801975:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  80197b:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  801980:	4d 89 2f             	mov    %r13,(%r15)
+}
+  801983:	48 83 c4 08          	add    $0x8,%rsp
+  801987:	5b                   	pop    %rbx
+  801988:	41 5c                	pop    %r12
+  80198a:	41 5d                	pop    %r13
+  80198c:	41 5e                	pop    %r14
+  80198e:	41 5f                	pop    %r15
+  801990:	5d                   	pop    %rbp
+  801991:	c3                   	ret
+
+0000000000801992 <fd_alloc>:
+fd_alloc(struct Fd **fd_store) {
+  801992:	55                   	push   %rbp
+  801993:	48 89 e5             	mov    %rsp,%rbp
+  801996:	48 89 fe             	mov    %rdi,%rsi
+    return fd_alloc_from(0, fd_store);
+  801999:	bf 00 00 00 00       	mov    $0x0,%edi
+  80199e:	48 b8 19 19 80 00 00 	movabs $0x801919,%rax
+  8019a5:	00 00 00 
+  8019a8:	ff d0                	call   *%rax
+}
+  8019aa:	5d                   	pop    %rbp
+  8019ab:	c3                   	ret
+
+00000000008019ac <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  8019ac:	83 ff 1f             	cmp    $0x1f,%edi
+  8019af:	77 39                	ja     8019ea <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  8019b1:	55                   	push   %rbp
+  8019b2:	48 89 e5             	mov    %rsp,%rbp
+  8019b5:	41 54                	push   %r12
+  8019b7:	53                   	push   %rbx
+  8019b8:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  8019bb:	48 63 df             	movslq %edi,%rbx
+  8019be:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  8019c5:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  8019c9:	48 89 df             	mov    %rbx,%rdi
+  8019cc:	48 b8 22 2a 80 00 00 	movabs $0x802a22,%rax
+  8019d3:	00 00 00 
+  8019d6:	ff d0                	call   *%rax
+  8019d8:	a8 04                	test   $0x4,%al
+  8019da:	74 14                	je     8019f0 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  8019dc:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  8019e0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8019e5:	5b                   	pop    %rbx
+  8019e6:	41 5c                	pop    %r12
+  8019e8:	5d                   	pop    %rbp
+  8019e9:	c3                   	ret
+        return -E_INVAL;
+  8019ea:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8019ef:	c3                   	ret
+        return -E_INVAL;
+  8019f0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8019f5:	eb ee                	jmp    8019e5 <fd_lookup+0x39>
+
+00000000008019f7 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  8019f7:	55                   	push   %rbp
+  8019f8:	48 89 e5             	mov    %rsp,%rbp
+  8019fb:	41 54                	push   %r12
+  8019fd:	53                   	push   %rbx
+  8019fe:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  801a01:	48 b8 80 35 80 00 00 	movabs $0x803580,%rax
+  801a08:	00 00 00 
+  801a0b:	48 bb 20 40 80 00 00 	movabs $0x804020,%rbx
+  801a12:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  801a15:	39 3b                	cmp    %edi,(%rbx)
+  801a17:	74 47                	je     801a60 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  801a19:	48 83 c0 08          	add    $0x8,%rax
+  801a1d:	48 8b 18             	mov    (%rax),%rbx
+  801a20:	48 85 db             	test   %rbx,%rbx
+  801a23:	75 f0                	jne    801a15 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801a25:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801a2c:	00 00 00 
+  801a2f:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+  801a35:	89 fa                	mov    %edi,%edx
+  801a37:	48 bf 00 35 80 00 00 	movabs $0x803500,%rdi
+  801a3e:	00 00 00 
+  801a41:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a46:	48 b9 af 02 80 00 00 	movabs $0x8002af,%rcx
+  801a4d:	00 00 00 
+  801a50:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  801a52:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  801a57:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  801a5b:	5b                   	pop    %rbx
+  801a5c:	41 5c                	pop    %r12
+  801a5e:	5d                   	pop    %rbp
+  801a5f:	c3                   	ret
+            return 0;
+  801a60:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a65:	eb f0                	jmp    801a57 <dev_lookup+0x60>
+
+0000000000801a67 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  801a67:	55                   	push   %rbp
+  801a68:	48 89 e5             	mov    %rsp,%rbp
+  801a6b:	41 55                	push   %r13
+  801a6d:	41 54                	push   %r12
+  801a6f:	53                   	push   %rbx
+  801a70:	48 83 ec 18          	sub    $0x18,%rsp
+  801a74:	48 89 fb             	mov    %rdi,%rbx
+  801a77:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801a7a:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  801a81:	ff ff ff 
+  801a84:	48 01 df             	add    %rbx,%rdi
+  801a87:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  801a8b:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801a8f:	48 b8 ac 19 80 00 00 	movabs $0x8019ac,%rax
+  801a96:	00 00 00 
+  801a99:	ff d0                	call   *%rax
+  801a9b:	41 89 c5             	mov    %eax,%r13d
+  801a9e:	85 c0                	test   %eax,%eax
+  801aa0:	78 06                	js     801aa8 <fd_close+0x41>
+  801aa2:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  801aa6:	74 1a                	je     801ac2 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  801aa8:	45 84 e4             	test   %r12b,%r12b
+  801aab:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ab0:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  801ab4:	44 89 e8             	mov    %r13d,%eax
+  801ab7:	48 83 c4 18          	add    $0x18,%rsp
+  801abb:	5b                   	pop    %rbx
+  801abc:	41 5c                	pop    %r12
+  801abe:	41 5d                	pop    %r13
+  801ac0:	5d                   	pop    %rbp
+  801ac1:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801ac2:	8b 3b                	mov    (%rbx),%edi
+  801ac4:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801ac8:	48 b8 f7 19 80 00 00 	movabs $0x8019f7,%rax
+  801acf:	00 00 00 
+  801ad2:	ff d0                	call   *%rax
+  801ad4:	41 89 c5             	mov    %eax,%r13d
+  801ad7:	85 c0                	test   %eax,%eax
+  801ad9:	78 1b                	js     801af6 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  801adb:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801adf:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801ae3:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801ae9:	48 85 c0             	test   %rax,%rax
+  801aec:	74 08                	je     801af6 <fd_close+0x8f>
+  801aee:	48 89 df             	mov    %rbx,%rdi
+  801af1:	ff d0                	call   *%rax
+  801af3:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801af6:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801afb:	48 89 de             	mov    %rbx,%rsi
+  801afe:	bf 00 00 00 00       	mov    $0x0,%edi
+  801b03:	48 b8 50 12 80 00 00 	movabs $0x801250,%rax
+  801b0a:	00 00 00 
+  801b0d:	ff d0                	call   *%rax
+    return res;
+  801b0f:	eb a3                	jmp    801ab4 <fd_close+0x4d>
+
+0000000000801b11 <close>:
+
+int
+close(int fdnum) {
+  801b11:	55                   	push   %rbp
+  801b12:	48 89 e5             	mov    %rsp,%rbp
+  801b15:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  801b19:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801b1d:	48 b8 ac 19 80 00 00 	movabs $0x8019ac,%rax
+  801b24:	00 00 00 
+  801b27:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801b29:	85 c0                	test   %eax,%eax
+  801b2b:	78 15                	js     801b42 <close+0x31>
+
+    return fd_close(fd, 1);
+  801b2d:	be 01 00 00 00       	mov    $0x1,%esi
+  801b32:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801b36:	48 b8 67 1a 80 00 00 	movabs $0x801a67,%rax
+  801b3d:	00 00 00 
+  801b40:	ff d0                	call   *%rax
+}
+  801b42:	c9                   	leave
+  801b43:	c3                   	ret
+
+0000000000801b44 <close_all>:
+
+void
+close_all(void) {
+  801b44:	55                   	push   %rbp
+  801b45:	48 89 e5             	mov    %rsp,%rbp
+  801b48:	41 54                	push   %r12
+  801b4a:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  801b4b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b50:	49 bc 11 1b 80 00 00 	movabs $0x801b11,%r12
+  801b57:	00 00 00 
+  801b5a:	89 df                	mov    %ebx,%edi
+  801b5c:	41 ff d4             	call   *%r12
+  801b5f:	83 c3 01             	add    $0x1,%ebx
+  801b62:	83 fb 20             	cmp    $0x20,%ebx
+  801b65:	75 f3                	jne    801b5a <close_all+0x16>
+}
+  801b67:	5b                   	pop    %rbx
+  801b68:	41 5c                	pop    %r12
+  801b6a:	5d                   	pop    %rbp
+  801b6b:	c3                   	ret
+
+0000000000801b6c <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  801b6c:	55                   	push   %rbp
+  801b6d:	48 89 e5             	mov    %rsp,%rbp
+  801b70:	41 57                	push   %r15
+  801b72:	41 56                	push   %r14
+  801b74:	41 55                	push   %r13
+  801b76:	41 54                	push   %r12
+  801b78:	53                   	push   %rbx
+  801b79:	48 83 ec 18          	sub    $0x18,%rsp
+  801b7d:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  801b80:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801b84:	48 b8 ac 19 80 00 00 	movabs $0x8019ac,%rax
+  801b8b:	00 00 00 
+  801b8e:	ff d0                	call   *%rax
+  801b90:	89 c3                	mov    %eax,%ebx
+  801b92:	85 c0                	test   %eax,%eax
+  801b94:	0f 88 b8 00 00 00    	js     801c52 <dup+0xe6>
+    close(newfdnum);
+  801b9a:	44 89 e7             	mov    %r12d,%edi
+  801b9d:	48 b8 11 1b 80 00 00 	movabs $0x801b11,%rax
+  801ba4:	00 00 00 
+  801ba7:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  801ba9:	4d 63 ec             	movslq %r12d,%r13
+  801bac:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  801bb3:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  801bb7:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  801bbb:	4c 89 ff             	mov    %r15,%rdi
+  801bbe:	49 be fd 18 80 00 00 	movabs $0x8018fd,%r14
+  801bc5:	00 00 00 
+  801bc8:	41 ff d6             	call   *%r14
+  801bcb:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  801bce:	4c 89 ef             	mov    %r13,%rdi
+  801bd1:	41 ff d6             	call   *%r14
+  801bd4:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  801bd7:	48 89 df             	mov    %rbx,%rdi
+  801bda:	48 b8 22 2a 80 00 00 	movabs $0x802a22,%rax
+  801be1:	00 00 00 
+  801be4:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  801be6:	a8 04                	test   $0x4,%al
+  801be8:	74 2b                	je     801c15 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  801bea:	41 89 c1             	mov    %eax,%r9d
+  801bed:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801bf3:	4c 89 f1             	mov    %r14,%rcx
+  801bf6:	ba 00 00 00 00       	mov    $0x0,%edx
+  801bfb:	48 89 de             	mov    %rbx,%rsi
+  801bfe:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c03:	48 b8 eb 11 80 00 00 	movabs $0x8011eb,%rax
+  801c0a:	00 00 00 
+  801c0d:	ff d0                	call   *%rax
+  801c0f:	89 c3                	mov    %eax,%ebx
+  801c11:	85 c0                	test   %eax,%eax
+  801c13:	78 4e                	js     801c63 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  801c15:	4c 89 ff             	mov    %r15,%rdi
+  801c18:	48 b8 22 2a 80 00 00 	movabs $0x802a22,%rax
+  801c1f:	00 00 00 
+  801c22:	ff d0                	call   *%rax
+  801c24:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801c27:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801c2d:	4c 89 e9             	mov    %r13,%rcx
+  801c30:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c35:	4c 89 fe             	mov    %r15,%rsi
+  801c38:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c3d:	48 b8 eb 11 80 00 00 	movabs $0x8011eb,%rax
+  801c44:	00 00 00 
+  801c47:	ff d0                	call   *%rax
+  801c49:	89 c3                	mov    %eax,%ebx
+  801c4b:	85 c0                	test   %eax,%eax
+  801c4d:	78 14                	js     801c63 <dup+0xf7>
+
+    return newfdnum;
+  801c4f:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  801c52:	89 d8                	mov    %ebx,%eax
+  801c54:	48 83 c4 18          	add    $0x18,%rsp
+  801c58:	5b                   	pop    %rbx
+  801c59:	41 5c                	pop    %r12
+  801c5b:	41 5d                	pop    %r13
+  801c5d:	41 5e                	pop    %r14
+  801c5f:	41 5f                	pop    %r15
+  801c61:	5d                   	pop    %rbp
+  801c62:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  801c63:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801c68:	4c 89 ee             	mov    %r13,%rsi
+  801c6b:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c70:	49 bc 50 12 80 00 00 	movabs $0x801250,%r12
+  801c77:	00 00 00 
+  801c7a:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  801c7d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801c82:	4c 89 f6             	mov    %r14,%rsi
+  801c85:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c8a:	41 ff d4             	call   *%r12
+    return res;
+  801c8d:	eb c3                	jmp    801c52 <dup+0xe6>
+
+0000000000801c8f <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  801c8f:	55                   	push   %rbp
+  801c90:	48 89 e5             	mov    %rsp,%rbp
+  801c93:	41 56                	push   %r14
+  801c95:	41 55                	push   %r13
+  801c97:	41 54                	push   %r12
+  801c99:	53                   	push   %rbx
+  801c9a:	48 83 ec 10          	sub    $0x10,%rsp
+  801c9e:	89 fb                	mov    %edi,%ebx
+  801ca0:	49 89 f4             	mov    %rsi,%r12
+  801ca3:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801ca6:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801caa:	48 b8 ac 19 80 00 00 	movabs $0x8019ac,%rax
+  801cb1:	00 00 00 
+  801cb4:	ff d0                	call   *%rax
+  801cb6:	85 c0                	test   %eax,%eax
+  801cb8:	78 4c                	js     801d06 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801cba:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801cbe:	41 8b 3e             	mov    (%r14),%edi
+  801cc1:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801cc5:	48 b8 f7 19 80 00 00 	movabs $0x8019f7,%rax
+  801ccc:	00 00 00 
+  801ccf:	ff d0                	call   *%rax
+  801cd1:	85 c0                	test   %eax,%eax
+  801cd3:	78 35                	js     801d0a <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801cd5:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801cd9:	83 e0 03             	and    $0x3,%eax
+  801cdc:	83 f8 01             	cmp    $0x1,%eax
+  801cdf:	74 2d                	je     801d0e <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801ce1:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801ce5:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801ce9:	48 85 c0             	test   %rax,%rax
+  801cec:	74 56                	je     801d44 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  801cee:	4c 89 ea             	mov    %r13,%rdx
+  801cf1:	4c 89 e6             	mov    %r12,%rsi
+  801cf4:	4c 89 f7             	mov    %r14,%rdi
+  801cf7:	ff d0                	call   *%rax
+}
+  801cf9:	48 83 c4 10          	add    $0x10,%rsp
+  801cfd:	5b                   	pop    %rbx
+  801cfe:	41 5c                	pop    %r12
+  801d00:	41 5d                	pop    %r13
+  801d02:	41 5e                	pop    %r14
+  801d04:	5d                   	pop    %rbp
+  801d05:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801d06:	48 98                	cltq
+  801d08:	eb ef                	jmp    801cf9 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801d0a:	48 98                	cltq
+  801d0c:	eb eb                	jmp    801cf9 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801d0e:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801d15:	00 00 00 
+  801d18:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+  801d1e:	89 da                	mov    %ebx,%edx
+  801d20:	48 bf 41 35 80 00 00 	movabs $0x803541,%rdi
+  801d27:	00 00 00 
+  801d2a:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d2f:	48 b9 af 02 80 00 00 	movabs $0x8002af,%rcx
+  801d36:	00 00 00 
+  801d39:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801d3b:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801d42:	eb b5                	jmp    801cf9 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801d44:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801d4b:	eb ac                	jmp    801cf9 <read+0x6a>
+
+0000000000801d4d <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801d4d:	55                   	push   %rbp
+  801d4e:	48 89 e5             	mov    %rsp,%rbp
+  801d51:	41 57                	push   %r15
+  801d53:	41 56                	push   %r14
+  801d55:	41 55                	push   %r13
+  801d57:	41 54                	push   %r12
+  801d59:	53                   	push   %rbx
+  801d5a:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  801d5e:	48 85 d2             	test   %rdx,%rdx
+  801d61:	74 54                	je     801db7 <readn+0x6a>
+  801d63:	41 89 fd             	mov    %edi,%r13d
+  801d66:	49 89 f6             	mov    %rsi,%r14
+  801d69:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  801d6c:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  801d71:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  801d76:	49 bf 8f 1c 80 00 00 	movabs $0x801c8f,%r15
+  801d7d:	00 00 00 
+  801d80:	4c 89 e2             	mov    %r12,%rdx
+  801d83:	48 29 f2             	sub    %rsi,%rdx
+  801d86:	4c 01 f6             	add    %r14,%rsi
+  801d89:	44 89 ef             	mov    %r13d,%edi
+  801d8c:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  801d8f:	85 c0                	test   %eax,%eax
+  801d91:	78 20                	js     801db3 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  801d93:	01 c3                	add    %eax,%ebx
+  801d95:	85 c0                	test   %eax,%eax
+  801d97:	74 08                	je     801da1 <readn+0x54>
+  801d99:	48 63 f3             	movslq %ebx,%rsi
+  801d9c:	4c 39 e6             	cmp    %r12,%rsi
+  801d9f:	72 df                	jb     801d80 <readn+0x33>
+    }
+    return res;
+  801da1:	48 63 c3             	movslq %ebx,%rax
+}
+  801da4:	48 83 c4 08          	add    $0x8,%rsp
+  801da8:	5b                   	pop    %rbx
+  801da9:	41 5c                	pop    %r12
+  801dab:	41 5d                	pop    %r13
+  801dad:	41 5e                	pop    %r14
+  801daf:	41 5f                	pop    %r15
+  801db1:	5d                   	pop    %rbp
+  801db2:	c3                   	ret
+        if (inc < 0) return inc;
+  801db3:	48 98                	cltq
+  801db5:	eb ed                	jmp    801da4 <readn+0x57>
+    int inc = 1, res = 0;
+  801db7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801dbc:	eb e3                	jmp    801da1 <readn+0x54>
+
+0000000000801dbe <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  801dbe:	55                   	push   %rbp
+  801dbf:	48 89 e5             	mov    %rsp,%rbp
+  801dc2:	41 56                	push   %r14
+  801dc4:	41 55                	push   %r13
+  801dc6:	41 54                	push   %r12
+  801dc8:	53                   	push   %rbx
+  801dc9:	48 83 ec 10          	sub    $0x10,%rsp
+  801dcd:	89 fb                	mov    %edi,%ebx
+  801dcf:	49 89 f4             	mov    %rsi,%r12
+  801dd2:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801dd5:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801dd9:	48 b8 ac 19 80 00 00 	movabs $0x8019ac,%rax
+  801de0:	00 00 00 
+  801de3:	ff d0                	call   *%rax
+  801de5:	85 c0                	test   %eax,%eax
+  801de7:	78 47                	js     801e30 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801de9:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801ded:	41 8b 3e             	mov    (%r14),%edi
+  801df0:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801df4:	48 b8 f7 19 80 00 00 	movabs $0x8019f7,%rax
+  801dfb:	00 00 00 
+  801dfe:	ff d0                	call   *%rax
+  801e00:	85 c0                	test   %eax,%eax
+  801e02:	78 30                	js     801e34 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801e04:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  801e09:	74 2d                	je     801e38 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801e0b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801e0f:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801e13:	48 85 c0             	test   %rax,%rax
+  801e16:	74 56                	je     801e6e <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  801e18:	4c 89 ea             	mov    %r13,%rdx
+  801e1b:	4c 89 e6             	mov    %r12,%rsi
+  801e1e:	4c 89 f7             	mov    %r14,%rdi
+  801e21:	ff d0                	call   *%rax
+}
+  801e23:	48 83 c4 10          	add    $0x10,%rsp
+  801e27:	5b                   	pop    %rbx
+  801e28:	41 5c                	pop    %r12
+  801e2a:	41 5d                	pop    %r13
+  801e2c:	41 5e                	pop    %r14
+  801e2e:	5d                   	pop    %rbp
+  801e2f:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801e30:	48 98                	cltq
+  801e32:	eb ef                	jmp    801e23 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801e34:	48 98                	cltq
+  801e36:	eb eb                	jmp    801e23 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801e38:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801e3f:	00 00 00 
+  801e42:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+  801e48:	89 da                	mov    %ebx,%edx
+  801e4a:	48 bf 5d 35 80 00 00 	movabs $0x80355d,%rdi
+  801e51:	00 00 00 
+  801e54:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e59:	48 b9 af 02 80 00 00 	movabs $0x8002af,%rcx
+  801e60:	00 00 00 
+  801e63:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801e65:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801e6c:	eb b5                	jmp    801e23 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801e6e:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801e75:	eb ac                	jmp    801e23 <write+0x65>
+
+0000000000801e77 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  801e77:	55                   	push   %rbp
+  801e78:	48 89 e5             	mov    %rsp,%rbp
+  801e7b:	53                   	push   %rbx
+  801e7c:	48 83 ec 18          	sub    $0x18,%rsp
+  801e80:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801e82:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801e86:	48 b8 ac 19 80 00 00 	movabs $0x8019ac,%rax
+  801e8d:	00 00 00 
+  801e90:	ff d0                	call   *%rax
+  801e92:	85 c0                	test   %eax,%eax
+  801e94:	78 0c                	js     801ea2 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  801e96:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801e9a:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  801e9d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801ea2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801ea6:	c9                   	leave
+  801ea7:	c3                   	ret
+
+0000000000801ea8 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  801ea8:	55                   	push   %rbp
+  801ea9:	48 89 e5             	mov    %rsp,%rbp
+  801eac:	41 55                	push   %r13
+  801eae:	41 54                	push   %r12
+  801eb0:	53                   	push   %rbx
+  801eb1:	48 83 ec 18          	sub    $0x18,%rsp
+  801eb5:	89 fb                	mov    %edi,%ebx
+  801eb7:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801eba:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801ebe:	48 b8 ac 19 80 00 00 	movabs $0x8019ac,%rax
+  801ec5:	00 00 00 
+  801ec8:	ff d0                	call   *%rax
+  801eca:	85 c0                	test   %eax,%eax
+  801ecc:	78 38                	js     801f06 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801ece:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  801ed2:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  801ed6:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801eda:	48 b8 f7 19 80 00 00 	movabs $0x8019f7,%rax
+  801ee1:	00 00 00 
+  801ee4:	ff d0                	call   *%rax
+  801ee6:	85 c0                	test   %eax,%eax
+  801ee8:	78 1c                	js     801f06 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801eea:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  801eef:	74 20                	je     801f11 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801ef1:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801ef5:	48 8b 40 30          	mov    0x30(%rax),%rax
+  801ef9:	48 85 c0             	test   %rax,%rax
+  801efc:	74 47                	je     801f45 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  801efe:	44 89 e6             	mov    %r12d,%esi
+  801f01:	4c 89 ef             	mov    %r13,%rdi
+  801f04:	ff d0                	call   *%rax
+}
+  801f06:	48 83 c4 18          	add    $0x18,%rsp
+  801f0a:	5b                   	pop    %rbx
+  801f0b:	41 5c                	pop    %r12
+  801f0d:	41 5d                	pop    %r13
+  801f0f:	5d                   	pop    %rbp
+  801f10:	c3                   	ret
+                thisenv->env_id, fdnum);
+  801f11:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801f18:	00 00 00 
+  801f1b:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801f21:	89 da                	mov    %ebx,%edx
+  801f23:	48 bf 20 35 80 00 00 	movabs $0x803520,%rdi
+  801f2a:	00 00 00 
+  801f2d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f32:	48 b9 af 02 80 00 00 	movabs $0x8002af,%rcx
+  801f39:	00 00 00 
+  801f3c:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801f3e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801f43:	eb c1                	jmp    801f06 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801f45:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801f4a:	eb ba                	jmp    801f06 <ftruncate+0x5e>
+
+0000000000801f4c <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  801f4c:	55                   	push   %rbp
+  801f4d:	48 89 e5             	mov    %rsp,%rbp
+  801f50:	41 54                	push   %r12
+  801f52:	53                   	push   %rbx
+  801f53:	48 83 ec 10          	sub    $0x10,%rsp
+  801f57:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801f5a:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801f5e:	48 b8 ac 19 80 00 00 	movabs $0x8019ac,%rax
+  801f65:	00 00 00 
+  801f68:	ff d0                	call   *%rax
+  801f6a:	85 c0                	test   %eax,%eax
+  801f6c:	78 4e                	js     801fbc <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801f6e:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801f72:	41 8b 3c 24          	mov    (%r12),%edi
+  801f76:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801f7a:	48 b8 f7 19 80 00 00 	movabs $0x8019f7,%rax
+  801f81:	00 00 00 
+  801f84:	ff d0                	call   *%rax
+  801f86:	85 c0                	test   %eax,%eax
+  801f88:	78 32                	js     801fbc <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801f8a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801f8e:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  801f93:	74 30                	je     801fc5 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  801f95:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  801f98:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  801f9f:	00 00 00 
+    stat->st_isdir = 0;
+  801fa2:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  801fa9:	00 00 00 
+    stat->st_dev = dev;
+  801fac:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  801fb3:	48 89 de             	mov    %rbx,%rsi
+  801fb6:	4c 89 e7             	mov    %r12,%rdi
+  801fb9:	ff 50 28             	call   *0x28(%rax)
+}
+  801fbc:	48 83 c4 10          	add    $0x10,%rsp
+  801fc0:	5b                   	pop    %rbx
+  801fc1:	41 5c                	pop    %r12
+  801fc3:	5d                   	pop    %rbp
+  801fc4:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801fc5:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801fca:	eb f0                	jmp    801fbc <fstat+0x70>
+
+0000000000801fcc <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  801fcc:	55                   	push   %rbp
+  801fcd:	48 89 e5             	mov    %rsp,%rbp
+  801fd0:	41 54                	push   %r12
+  801fd2:	53                   	push   %rbx
+  801fd3:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  801fd6:	be 00 00 00 00       	mov    $0x0,%esi
+  801fdb:	48 b8 af 23 80 00 00 	movabs $0x8023af,%rax
+  801fe2:	00 00 00 
+  801fe5:	ff d0                	call   *%rax
+  801fe7:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  801fe9:	85 c0                	test   %eax,%eax
+  801feb:	78 25                	js     802012 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  801fed:	4c 89 e6             	mov    %r12,%rsi
+  801ff0:	89 c7                	mov    %eax,%edi
+  801ff2:	48 b8 4c 1f 80 00 00 	movabs $0x801f4c,%rax
+  801ff9:	00 00 00 
+  801ffc:	ff d0                	call   *%rax
+  801ffe:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  802001:	89 df                	mov    %ebx,%edi
+  802003:	48 b8 11 1b 80 00 00 	movabs $0x801b11,%rax
+  80200a:	00 00 00 
+  80200d:	ff d0                	call   *%rax
+
+    return res;
+  80200f:	44 89 e3             	mov    %r12d,%ebx
+}
+  802012:	89 d8                	mov    %ebx,%eax
+  802014:	5b                   	pop    %rbx
+  802015:	41 5c                	pop    %r12
+  802017:	5d                   	pop    %rbp
+  802018:	c3                   	ret
+
+0000000000802019 <fsipc>:
+ * response may be written back to fsipcbuf.
+ * type: request code, passed as the simple integer IPC value.
+ * dstva: virtual address at which to receive reply page, 0 if none.
+ * Returns result from the file server. */
+static int
+fsipc(unsigned type, void *dstva) {
+  802019:	55                   	push   %rbp
+  80201a:	48 89 e5             	mov    %rsp,%rbp
+  80201d:	41 54                	push   %r12
+  80201f:	53                   	push   %rbx
+  802020:	48 83 ec 10          	sub    $0x10,%rsp
+  802024:	41 89 fc             	mov    %edi,%r12d
+  802027:	48 89 f3             	mov    %rsi,%rbx
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  80202a:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  802031:	00 00 00 
+  802034:	83 38 00             	cmpl   $0x0,(%rax)
+  802037:	74 5e                	je     802097 <fsipc+0x7e>
+    if (debug) {
+        cprintf("[%08x] fsipc %d %08x\n",
+                thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+    }
+
+    ipc_send(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW);
+  802039:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  80203f:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802044:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  80204b:	00 00 00 
+  80204e:	44 89 e6             	mov    %r12d,%esi
+  802051:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  802058:	00 00 00 
+  80205b:	8b 38                	mov    (%rax),%edi
+  80205d:	48 b8 f8 17 80 00 00 	movabs $0x8017f8,%rax
+  802064:	00 00 00 
+  802067:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  802069:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  802070:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  802071:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802076:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  80207a:	48 89 de             	mov    %rbx,%rsi
+  80207d:	bf 00 00 00 00       	mov    $0x0,%edi
+  802082:	48 b8 23 17 80 00 00 	movabs $0x801723,%rax
+  802089:	00 00 00 
+  80208c:	ff d0                	call   *%rax
+}
+  80208e:	48 83 c4 10          	add    $0x10,%rsp
+  802092:	5b                   	pop    %rbx
+  802093:	41 5c                	pop    %r12
+  802095:	5d                   	pop    %rbp
+  802096:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802097:	bf 03 00 00 00       	mov    $0x3,%edi
+  80209c:	48 b8 9b 18 80 00 00 	movabs $0x80189b,%rax
+  8020a3:	00 00 00 
+  8020a6:	ff d0                	call   *%rax
+  8020a8:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  8020af:	00 00 
+  8020b1:	eb 86                	jmp    802039 <fsipc+0x20>
+
+00000000008020b3 <devfile_trunc>:
+    return 0;
+}
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  8020b3:	55                   	push   %rbp
+  8020b4:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  8020b7:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  8020be:	00 00 00 
+  8020c1:	8b 57 0c             	mov    0xc(%rdi),%edx
+  8020c4:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  8020c6:	89 70 04             	mov    %esi,0x4(%rax)
+
+    return fsipc(FSREQ_SET_SIZE, NULL);
+  8020c9:	be 00 00 00 00       	mov    $0x0,%esi
+  8020ce:	bf 02 00 00 00       	mov    $0x2,%edi
+  8020d3:	48 b8 19 20 80 00 00 	movabs $0x802019,%rax
+  8020da:	00 00 00 
+  8020dd:	ff d0                	call   *%rax
+}
+  8020df:	5d                   	pop    %rbp
+  8020e0:	c3                   	ret
+
+00000000008020e1 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  8020e1:	55                   	push   %rbp
+  8020e2:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  8020e5:	8b 47 0c             	mov    0xc(%rdi),%eax
+  8020e8:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  8020ef:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  8020f1:	be 00 00 00 00       	mov    $0x0,%esi
+  8020f6:	bf 06 00 00 00       	mov    $0x6,%edi
+  8020fb:	48 b8 19 20 80 00 00 	movabs $0x802019,%rax
+  802102:	00 00 00 
+  802105:	ff d0                	call   *%rax
+}
+  802107:	5d                   	pop    %rbp
+  802108:	c3                   	ret
+
+0000000000802109 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  802109:	55                   	push   %rbp
+  80210a:	48 89 e5             	mov    %rsp,%rbp
+  80210d:	41 54                	push   %r12
+  80210f:	53                   	push   %rbx
+  802110:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802113:	8b 47 0c             	mov    0xc(%rdi),%eax
+  802116:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  80211d:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  80211f:	be 00 00 00 00       	mov    $0x0,%esi
+  802124:	bf 05 00 00 00       	mov    $0x5,%edi
+  802129:	48 b8 19 20 80 00 00 	movabs $0x802019,%rax
+  802130:	00 00 00 
+  802133:	ff d0                	call   *%rax
+    if (res < 0) {
+  802135:	85 c0                	test   %eax,%eax
+  802137:	78 3d                	js     802176 <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802139:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  802140:	00 00 00 
+  802143:	4c 89 e6             	mov    %r12,%rsi
+  802146:	48 89 df             	mov    %rbx,%rdi
+  802149:	48 b8 d4 0b 80 00 00 	movabs $0x800bd4,%rax
+  802150:	00 00 00 
+  802153:	ff d0                	call   *%rax
+    st->st_size  = fsipcbuf.statRet.ret_size;
+  802155:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  80215c:	00 
+  80215d:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802163:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  80216a:	00 
+  80216b:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  802171:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802176:	5b                   	pop    %rbx
+  802177:	41 5c                	pop    %r12
+  802179:	5d                   	pop    %rbp
+  80217a:	c3                   	ret
+
+000000000080217b <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  80217b:	55                   	push   %rbp
+  80217c:	48 89 e5             	mov    %rsp,%rbp
+  80217f:	41 57                	push   %r15
+  802181:	41 56                	push   %r14
+  802183:	41 55                	push   %r13
+  802185:	41 54                	push   %r12
+  802187:	53                   	push   %rbx
+  802188:	48 83 ec 18          	sub    $0x18,%rsp
+  80218c:	49 89 fe             	mov    %rdi,%r14
+  80218f:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+  802193:	48 89 d3             	mov    %rdx,%rbx
+    while (n > sizeof(fsipcbuf.write.req_buf))
+  802196:	48 81 fa f0 0f 00 00 	cmp    $0xff0,%rdx
+  80219d:	0f 86 e4 00 00 00    	jbe    802287 <devfile_write+0x10c>
+  8021a3:	49 89 f4             	mov    %rsi,%r12
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8021a6:	49 bd 00 60 80 00 00 	movabs $0x806000,%r13
+  8021ad:	00 00 00 
+        memcpy(fsipcbuf.write.req_buf, buf, sizeof(fsipcbuf.write.req_buf));
+  8021b0:	49 bf 35 0e 80 00 00 	movabs $0x800e35,%r15
+  8021b7:	00 00 00 
+  8021ba:	eb 03                	jmp    8021bf <devfile_write+0x44>
+        buf += sizeof(fsipcbuf.write.req_buf);
+  8021bc:	49 89 f4             	mov    %rsi,%r12
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8021bf:	41 8b 46 0c          	mov    0xc(%r14),%eax
+  8021c3:	41 89 45 00          	mov    %eax,0x0(%r13)
+        fsipcbuf.write.req_n      = sizeof(fsipcbuf.write.req_buf);
+  8021c7:	49 c7 45 08 f0 0f 00 	movq   $0xff0,0x8(%r13)
+  8021ce:	00 
+        memcpy(fsipcbuf.write.req_buf, buf, sizeof(fsipcbuf.write.req_buf));
+  8021cf:	ba f0 0f 00 00       	mov    $0xff0,%edx
+  8021d4:	4c 89 e6             	mov    %r12,%rsi
+  8021d7:	48 bf 10 60 80 00 00 	movabs $0x806010,%rdi
+  8021de:	00 00 00 
+  8021e1:	41 ff d7             	call   *%r15
+        ssize_t res = fsipc(FSREQ_WRITE, NULL);
+  8021e4:	be 00 00 00 00       	mov    $0x0,%esi
+  8021e9:	bf 04 00 00 00       	mov    $0x4,%edi
+  8021ee:	48 b8 19 20 80 00 00 	movabs $0x802019,%rax
+  8021f5:	00 00 00 
+  8021f8:	ff d0                	call   *%rax
+  8021fa:	48 63 d0             	movslq %eax,%rdx
+        if (res < 0 || res < sizeof(fsipcbuf.write.req_buf))
+  8021fd:	3d ef 0f 00 00       	cmp    $0xfef,%eax
+  802202:	7e 71                	jle    802275 <devfile_write+0xfa>
+        buf += sizeof(fsipcbuf.write.req_buf);
+  802204:	49 8d b4 24 f0 0f 00 	lea    0xff0(%r12),%rsi
+  80220b:	00 
+        n -= sizeof(fsipcbuf.write.req_buf);
+  80220c:	48 81 eb f0 0f 00 00 	sub    $0xff0,%rbx
+    while (n > sizeof(fsipcbuf.write.req_buf))
+  802213:	48 81 fb f0 0f 00 00 	cmp    $0xff0,%rbx
+  80221a:	77 a0                	ja     8021bc <devfile_write+0x41>
+        written += sizeof(fsipcbuf.write.req_buf);
+  80221c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802220:	49 29 c4             	sub    %rax,%r12
+  802223:	4d 8d a4 24 f0 0f 00 	lea    0xff0(%r12),%r12
+  80222a:	00 
+    fsipcbuf.write.req_fileid = fd->fd_file.id;
+  80222b:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  802232:	00 00 00 
+  802235:	41 8b 56 0c          	mov    0xc(%r14),%edx
+  802239:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.write.req_n      = n;
+  80223b:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    memcpy(fsipcbuf.write.req_buf, buf, n);
+  80223f:	48 89 da             	mov    %rbx,%rdx
+  802242:	48 8d 78 10          	lea    0x10(%rax),%rdi
+  802246:	48 b8 35 0e 80 00 00 	movabs $0x800e35,%rax
+  80224d:	00 00 00 
+  802250:	ff d0                	call   *%rax
+    ssize_t res = fsipc(FSREQ_WRITE, NULL);
+  802252:	be 00 00 00 00       	mov    $0x0,%esi
+  802257:	bf 04 00 00 00       	mov    $0x4,%edi
+  80225c:	48 b8 19 20 80 00 00 	movabs $0x802019,%rax
+  802263:	00 00 00 
+  802266:	ff d0                	call   *%rax
+  802268:	48 63 d0             	movslq %eax,%rdx
+    written += res;
+  80226b:	49 01 d4             	add    %rdx,%r12
+  80226e:	48 85 d2             	test   %rdx,%rdx
+  802271:	49 0f 49 d4          	cmovns %r12,%rdx
+}
+  802275:	48 89 d0             	mov    %rdx,%rax
+  802278:	48 83 c4 18          	add    $0x18,%rsp
+  80227c:	5b                   	pop    %rbx
+  80227d:	41 5c                	pop    %r12
+  80227f:	41 5d                	pop    %r13
+  802281:	41 5e                	pop    %r14
+  802283:	41 5f                	pop    %r15
+  802285:	5d                   	pop    %rbp
+  802286:	c3                   	ret
+    while (n > sizeof(fsipcbuf.write.req_buf))
+  802287:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+    ssize_t written = 0;
+  80228b:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802291:	eb 98                	jmp    80222b <devfile_write+0xb0>
+
+0000000000802293 <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  802293:	55                   	push   %rbp
+  802294:	48 89 e5             	mov    %rsp,%rbp
+  802297:	41 57                	push   %r15
+  802299:	41 56                	push   %r14
+  80229b:	41 55                	push   %r13
+  80229d:	41 54                	push   %r12
+  80229f:	53                   	push   %rbx
+  8022a0:	48 83 ec 18          	sub    $0x18,%rsp
+  8022a4:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  8022a8:	49 89 f6             	mov    %rsi,%r14
+  8022ab:	49 89 d4             	mov    %rdx,%r12
+    while (n > sizeof(fsipcbuf.readRet.ret_buf))
+  8022ae:	48 81 fa 00 10 00 00 	cmp    $0x1000,%rdx
+  8022b5:	0f 86 ea 00 00 00    	jbe    8023a5 <devfile_read+0x112>
+    ssize_t readsz = 0;
+  8022bb:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  8022c2:	00 
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8022c3:	49 bf 00 60 80 00 00 	movabs $0x806000,%r15
+  8022ca:	00 00 00 
+  8022cd:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8022d1:	8b 40 0c             	mov    0xc(%rax),%eax
+  8022d4:	41 89 07             	mov    %eax,(%r15)
+        fsipcbuf.read.req_n = sizeof(fsipcbuf.readRet.ret_buf);
+  8022d7:	49 c7 47 08 00 10 00 	movq   $0x1000,0x8(%r15)
+  8022de:	00 
+        ssize_t res = fsipc(FSREQ_READ, NULL);
+  8022df:	be 00 00 00 00       	mov    $0x0,%esi
+  8022e4:	bf 03 00 00 00       	mov    $0x3,%edi
+  8022e9:	48 b8 19 20 80 00 00 	movabs $0x802019,%rax
+  8022f0:	00 00 00 
+  8022f3:	ff d0                	call   *%rax
+  8022f5:	4c 63 e8             	movslq %eax,%r13
+        if (res < 0)
+  8022f8:	4d 85 ed             	test   %r13,%r13
+  8022fb:	0f 88 92 00 00 00    	js     802393 <devfile_read+0x100>
+        memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  802301:	4c 89 ea             	mov    %r13,%rdx
+  802304:	4c 89 fe             	mov    %r15,%rsi
+  802307:	4c 89 f7             	mov    %r14,%rdi
+  80230a:	48 b8 35 0e 80 00 00 	movabs $0x800e35,%rax
+  802311:	00 00 00 
+  802314:	ff d0                	call   *%rax
+        if (res < sizeof(fsipcbuf.readRet.ret_buf))
+  802316:	49 81 fd ff 0f 00 00 	cmp    $0xfff,%r13
+  80231d:	76 6d                	jbe    80238c <devfile_read+0xf9>
+        readsz += res;
+  80231f:	4c 01 6d c0          	add    %r13,-0x40(%rbp)
+        buf += res;
+  802323:	4d 01 ee             	add    %r13,%r14
+        n -= res;
+  802326:	4d 29 ec             	sub    %r13,%r12
+    while (n > sizeof(fsipcbuf.readRet.ret_buf))
+  802329:	49 81 fc 00 10 00 00 	cmp    $0x1000,%r12
+  802330:	77 9b                	ja     8022cd <devfile_read+0x3a>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802332:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  802339:	00 00 00 
+  80233c:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  802340:	8b 51 0c             	mov    0xc(%rcx),%edx
+  802343:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.read.req_n = n;
+  802345:	4c 89 60 08          	mov    %r12,0x8(%rax)
+    ssize_t res = fsipc(FSREQ_READ, NULL);
+  802349:	be 00 00 00 00       	mov    $0x0,%esi
+  80234e:	bf 03 00 00 00       	mov    $0x3,%edi
+  802353:	48 b8 19 20 80 00 00 	movabs $0x802019,%rax
+  80235a:	00 00 00 
+  80235d:	ff d0                	call   *%rax
+  80235f:	4c 63 e8             	movslq %eax,%r13
+    if (res < 0)
+  802362:	4d 85 ed             	test   %r13,%r13
+  802365:	78 2c                	js     802393 <devfile_read+0x100>
+    memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  802367:	4c 89 ea             	mov    %r13,%rdx
+  80236a:	48 be 00 60 80 00 00 	movabs $0x806000,%rsi
+  802371:	00 00 00 
+  802374:	4c 89 f7             	mov    %r14,%rdi
+  802377:	48 b8 35 0e 80 00 00 	movabs $0x800e35,%rax
+  80237e:	00 00 00 
+  802381:	ff d0                	call   *%rax
+    readsz += res;
+  802383:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802387:	49 01 c5             	add    %rax,%r13
+    return readsz;
+  80238a:	eb 07                	jmp    802393 <devfile_read+0x100>
+            return readsz + res;
+  80238c:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802390:	49 01 c5             	add    %rax,%r13
+}
+  802393:	4c 89 e8             	mov    %r13,%rax
+  802396:	48 83 c4 18          	add    $0x18,%rsp
+  80239a:	5b                   	pop    %rbx
+  80239b:	41 5c                	pop    %r12
+  80239d:	41 5d                	pop    %r13
+  80239f:	41 5e                	pop    %r14
+  8023a1:	41 5f                	pop    %r15
+  8023a3:	5d                   	pop    %rbp
+  8023a4:	c3                   	ret
+    ssize_t readsz = 0;
+  8023a5:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  8023ac:	00 
+  8023ad:	eb 83                	jmp    802332 <devfile_read+0x9f>
+
+00000000008023af <open>:
+open(const char *path, int mode) {
+  8023af:	55                   	push   %rbp
+  8023b0:	48 89 e5             	mov    %rsp,%rbp
+  8023b3:	41 55                	push   %r13
+  8023b5:	41 54                	push   %r12
+  8023b7:	53                   	push   %rbx
+  8023b8:	48 83 ec 18          	sub    $0x18,%rsp
+  8023bc:	49 89 fc             	mov    %rdi,%r12
+  8023bf:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  8023c2:	48 b8 96 0b 80 00 00 	movabs $0x800b96,%rax
+  8023c9:	00 00 00 
+  8023cc:	ff d0                	call   *%rax
+  8023ce:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  8023d4:	0f 87 8a 00 00 00    	ja     802464 <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8023da:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  8023de:	48 b8 92 19 80 00 00 	movabs $0x801992,%rax
+  8023e5:	00 00 00 
+  8023e8:	ff d0                	call   *%rax
+  8023ea:	89 c3                	mov    %eax,%ebx
+  8023ec:	85 c0                	test   %eax,%eax
+  8023ee:	78 50                	js     802440 <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  8023f0:	4c 89 e6             	mov    %r12,%rsi
+  8023f3:	48 bb 00 60 80 00 00 	movabs $0x806000,%rbx
+  8023fa:	00 00 00 
+  8023fd:	48 89 df             	mov    %rbx,%rdi
+  802400:	48 b8 d4 0b 80 00 00 	movabs $0x800bd4,%rax
+  802407:	00 00 00 
+  80240a:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  80240c:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  802413:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802417:	bf 01 00 00 00       	mov    $0x1,%edi
+  80241c:	48 b8 19 20 80 00 00 	movabs $0x802019,%rax
+  802423:	00 00 00 
+  802426:	ff d0                	call   *%rax
+  802428:	89 c3                	mov    %eax,%ebx
+  80242a:	85 c0                	test   %eax,%eax
+  80242c:	78 1f                	js     80244d <open+0x9e>
+    return fd2num(fd);
+  80242e:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802432:	48 b8 eb 18 80 00 00 	movabs $0x8018eb,%rax
+  802439:	00 00 00 
+  80243c:	ff d0                	call   *%rax
+  80243e:	89 c3                	mov    %eax,%ebx
+}
+  802440:	89 d8                	mov    %ebx,%eax
+  802442:	48 83 c4 18          	add    $0x18,%rsp
+  802446:	5b                   	pop    %rbx
+  802447:	41 5c                	pop    %r12
+  802449:	41 5d                	pop    %r13
+  80244b:	5d                   	pop    %rbp
+  80244c:	c3                   	ret
+        fd_close(fd, 0);
+  80244d:	be 00 00 00 00       	mov    $0x0,%esi
+  802452:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802456:	48 b8 67 1a 80 00 00 	movabs $0x801a67,%rax
+  80245d:	00 00 00 
+  802460:	ff d0                	call   *%rax
+        return res;
+  802462:	eb dc                	jmp    802440 <open+0x91>
+        return -E_BAD_PATH;
+  802464:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  802469:	eb d5                	jmp    802440 <open+0x91>
+
+000000000080246b <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  80246b:	55                   	push   %rbp
+  80246c:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc(FSREQ_SYNC, NULL);
+  80246f:	be 00 00 00 00       	mov    $0x0,%esi
+  802474:	bf 08 00 00 00       	mov    $0x8,%edi
+  802479:	48 b8 19 20 80 00 00 	movabs $0x802019,%rax
+  802480:	00 00 00 
+  802483:	ff d0                	call   *%rax
+}
+  802485:	5d                   	pop    %rbp
+  802486:	c3                   	ret
+
+0000000000802487 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  802487:	55                   	push   %rbp
+  802488:	48 89 e5             	mov    %rsp,%rbp
+  80248b:	41 54                	push   %r12
+  80248d:	53                   	push   %rbx
+  80248e:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802491:	48 b8 fd 18 80 00 00 	movabs $0x8018fd,%rax
+  802498:	00 00 00 
+  80249b:	ff d0                	call   *%rax
+  80249d:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  8024a0:	48 be a0 35 80 00 00 	movabs $0x8035a0,%rsi
+  8024a7:	00 00 00 
+  8024aa:	48 89 df             	mov    %rbx,%rdi
+  8024ad:	48 b8 d4 0b 80 00 00 	movabs $0x800bd4,%rax
+  8024b4:	00 00 00 
+  8024b7:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  8024b9:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  8024be:	41 2b 04 24          	sub    (%r12),%eax
+  8024c2:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  8024c8:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8024cf:	00 00 00 
+    stat->st_dev = &devpipe;
+  8024d2:	48 b8 60 40 80 00 00 	movabs $0x804060,%rax
+  8024d9:	00 00 00 
+  8024dc:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  8024e3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024e8:	5b                   	pop    %rbx
+  8024e9:	41 5c                	pop    %r12
+  8024eb:	5d                   	pop    %rbp
+  8024ec:	c3                   	ret
+
+00000000008024ed <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  8024ed:	55                   	push   %rbp
+  8024ee:	48 89 e5             	mov    %rsp,%rbp
+  8024f1:	41 54                	push   %r12
+  8024f3:	53                   	push   %rbx
+  8024f4:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8024f7:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8024fc:	48 89 fe             	mov    %rdi,%rsi
+  8024ff:	bf 00 00 00 00       	mov    $0x0,%edi
+  802504:	49 bc 50 12 80 00 00 	movabs $0x801250,%r12
+  80250b:	00 00 00 
+  80250e:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  802511:	48 89 df             	mov    %rbx,%rdi
+  802514:	48 b8 fd 18 80 00 00 	movabs $0x8018fd,%rax
+  80251b:	00 00 00 
+  80251e:	ff d0                	call   *%rax
+  802520:	48 89 c6             	mov    %rax,%rsi
+  802523:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802528:	bf 00 00 00 00       	mov    $0x0,%edi
+  80252d:	41 ff d4             	call   *%r12
+}
+  802530:	5b                   	pop    %rbx
+  802531:	41 5c                	pop    %r12
+  802533:	5d                   	pop    %rbp
+  802534:	c3                   	ret
+
+0000000000802535 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  802535:	55                   	push   %rbp
+  802536:	48 89 e5             	mov    %rsp,%rbp
+  802539:	41 57                	push   %r15
+  80253b:	41 56                	push   %r14
+  80253d:	41 55                	push   %r13
+  80253f:	41 54                	push   %r12
+  802541:	53                   	push   %rbx
+  802542:	48 83 ec 18          	sub    $0x18,%rsp
+  802546:	49 89 fc             	mov    %rdi,%r12
+  802549:	49 89 f5             	mov    %rsi,%r13
+  80254c:	49 89 d7             	mov    %rdx,%r15
+  80254f:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802553:	48 b8 fd 18 80 00 00 	movabs $0x8018fd,%rax
+  80255a:	00 00 00 
+  80255d:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  80255f:	4d 85 ff             	test   %r15,%r15
+  802562:	0f 84 af 00 00 00    	je     802617 <devpipe_write+0xe2>
+  802568:	48 89 c3             	mov    %rax,%rbx
+  80256b:	4c 89 f8             	mov    %r15,%rax
+  80256e:	4d 89 ef             	mov    %r13,%r15
+  802571:	4c 01 e8             	add    %r13,%rax
+  802574:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802578:	49 bd 58 11 80 00 00 	movabs $0x801158,%r13
+  80257f:	00 00 00 
+            sys_yield();
+  802582:	49 be f5 10 80 00 00 	movabs $0x8010f5,%r14
+  802589:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  80258c:	8b 73 04             	mov    0x4(%rbx),%esi
+  80258f:	48 63 ce             	movslq %esi,%rcx
+  802592:	48 63 03             	movslq (%rbx),%rax
+  802595:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  80259b:	48 39 c1             	cmp    %rax,%rcx
+  80259e:	72 2e                	jb     8025ce <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8025a0:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8025a5:	48 89 da             	mov    %rbx,%rdx
+  8025a8:	be 00 10 00 00       	mov    $0x1000,%esi
+  8025ad:	4c 89 e7             	mov    %r12,%rdi
+  8025b0:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  8025b3:	85 c0                	test   %eax,%eax
+  8025b5:	74 66                	je     80261d <devpipe_write+0xe8>
+            sys_yield();
+  8025b7:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  8025ba:	8b 73 04             	mov    0x4(%rbx),%esi
+  8025bd:	48 63 ce             	movslq %esi,%rcx
+  8025c0:	48 63 03             	movslq (%rbx),%rax
+  8025c3:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  8025c9:	48 39 c1             	cmp    %rax,%rcx
+  8025cc:	73 d2                	jae    8025a0 <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8025ce:	41 0f b6 3f          	movzbl (%r15),%edi
+  8025d2:	48 89 ca             	mov    %rcx,%rdx
+  8025d5:	48 c1 ea 03          	shr    $0x3,%rdx
+  8025d9:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  8025e0:	08 10 20 
+  8025e3:	48 f7 e2             	mul    %rdx
+  8025e6:	48 c1 ea 06          	shr    $0x6,%rdx
+  8025ea:	48 89 d0             	mov    %rdx,%rax
+  8025ed:	48 c1 e0 09          	shl    $0x9,%rax
+  8025f1:	48 29 d0             	sub    %rdx,%rax
+  8025f4:	48 c1 e0 03          	shl    $0x3,%rax
+  8025f8:	48 29 c1             	sub    %rax,%rcx
+  8025fb:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  802600:	83 c6 01             	add    $0x1,%esi
+  802603:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  802606:	49 83 c7 01          	add    $0x1,%r15
+  80260a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80260e:	49 39 c7             	cmp    %rax,%r15
+  802611:	0f 85 75 ff ff ff    	jne    80258c <devpipe_write+0x57>
+    return n;
+  802617:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80261b:	eb 05                	jmp    802622 <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  80261d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802622:	48 83 c4 18          	add    $0x18,%rsp
+  802626:	5b                   	pop    %rbx
+  802627:	41 5c                	pop    %r12
+  802629:	41 5d                	pop    %r13
+  80262b:	41 5e                	pop    %r14
+  80262d:	41 5f                	pop    %r15
+  80262f:	5d                   	pop    %rbp
+  802630:	c3                   	ret
+
+0000000000802631 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  802631:	55                   	push   %rbp
+  802632:	48 89 e5             	mov    %rsp,%rbp
+  802635:	41 57                	push   %r15
+  802637:	41 56                	push   %r14
+  802639:	41 55                	push   %r13
+  80263b:	41 54                	push   %r12
+  80263d:	53                   	push   %rbx
+  80263e:	48 83 ec 18          	sub    $0x18,%rsp
+  802642:	49 89 fc             	mov    %rdi,%r12
+  802645:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  802649:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80264d:	48 b8 fd 18 80 00 00 	movabs $0x8018fd,%rax
+  802654:	00 00 00 
+  802657:	ff d0                	call   *%rax
+  802659:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  80265c:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802662:	49 bd 58 11 80 00 00 	movabs $0x801158,%r13
+  802669:	00 00 00 
+            sys_yield();
+  80266c:	49 be f5 10 80 00 00 	movabs $0x8010f5,%r14
+  802673:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  802676:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  80267b:	74 7d                	je     8026fa <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  80267d:	8b 03                	mov    (%rbx),%eax
+  80267f:	3b 43 04             	cmp    0x4(%rbx),%eax
+  802682:	75 26                	jne    8026aa <devpipe_read+0x79>
+            if (i > 0) return i;
+  802684:	4d 85 ff             	test   %r15,%r15
+  802687:	75 77                	jne    802700 <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802689:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80268e:	48 89 da             	mov    %rbx,%rdx
+  802691:	be 00 10 00 00       	mov    $0x1000,%esi
+  802696:	4c 89 e7             	mov    %r12,%rdi
+  802699:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  80269c:	85 c0                	test   %eax,%eax
+  80269e:	74 72                	je     802712 <devpipe_read+0xe1>
+            sys_yield();
+  8026a0:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  8026a3:	8b 03                	mov    (%rbx),%eax
+  8026a5:	3b 43 04             	cmp    0x4(%rbx),%eax
+  8026a8:	74 df                	je     802689 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  8026aa:	48 63 c8             	movslq %eax,%rcx
+  8026ad:	48 89 ca             	mov    %rcx,%rdx
+  8026b0:	48 c1 ea 03          	shr    $0x3,%rdx
+  8026b4:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  8026bb:	08 10 20 
+  8026be:	48 89 d0             	mov    %rdx,%rax
+  8026c1:	48 f7 e6             	mul    %rsi
+  8026c4:	48 c1 ea 06          	shr    $0x6,%rdx
+  8026c8:	48 89 d0             	mov    %rdx,%rax
+  8026cb:	48 c1 e0 09          	shl    $0x9,%rax
+  8026cf:	48 29 d0             	sub    %rdx,%rax
+  8026d2:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  8026d9:	00 
+  8026da:	48 89 c8             	mov    %rcx,%rax
+  8026dd:	48 29 d0             	sub    %rdx,%rax
+  8026e0:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  8026e5:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8026e9:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  8026ed:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8026f0:	49 83 c7 01          	add    $0x1,%r15
+  8026f4:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  8026f8:	75 83                	jne    80267d <devpipe_read+0x4c>
+    return n;
+  8026fa:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8026fe:	eb 03                	jmp    802703 <devpipe_read+0xd2>
+            if (i > 0) return i;
+  802700:	4c 89 f8             	mov    %r15,%rax
+}
+  802703:	48 83 c4 18          	add    $0x18,%rsp
+  802707:	5b                   	pop    %rbx
+  802708:	41 5c                	pop    %r12
+  80270a:	41 5d                	pop    %r13
+  80270c:	41 5e                	pop    %r14
+  80270e:	41 5f                	pop    %r15
+  802710:	5d                   	pop    %rbp
+  802711:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  802712:	b8 00 00 00 00       	mov    $0x0,%eax
+  802717:	eb ea                	jmp    802703 <devpipe_read+0xd2>
+
+0000000000802719 <pipe>:
+pipe(int pfd[2]) {
+  802719:	55                   	push   %rbp
+  80271a:	48 89 e5             	mov    %rsp,%rbp
+  80271d:	41 55                	push   %r13
+  80271f:	41 54                	push   %r12
+  802721:	53                   	push   %rbx
+  802722:	48 81 ec b8 00 00 00 	sub    $0xb8,%rsp
+  802729:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  80272c:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802730:	48 b8 92 19 80 00 00 	movabs $0x801992,%rax
+  802737:	00 00 00 
+  80273a:	ff d0                	call   *%rax
+  80273c:	89 c3                	mov    %eax,%ebx
+  80273e:	85 c0                	test   %eax,%eax
+  802740:	0f 88 51 01 00 00    	js     802897 <pipe+0x17e>
+        (res = fd_alloc_from(fd2num(fd0) + 1, &fd1)) < 0) goto err;
+  802746:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80274a:	48 b8 eb 18 80 00 00 	movabs $0x8018eb,%rax
+  802751:	00 00 00 
+  802754:	ff d0                	call   *%rax
+  802756:	8d 78 01             	lea    0x1(%rax),%edi
+  802759:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80275d:	48 b8 19 19 80 00 00 	movabs $0x801919,%rax
+  802764:	00 00 00 
+  802767:	ff d0                	call   *%rax
+  802769:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  80276b:	85 c0                	test   %eax,%eax
+  80276d:	0f 88 24 01 00 00    	js     802897 <pipe+0x17e>
+    va = fd2data(fd0);
+  802773:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802777:	48 bb fd 18 80 00 00 	movabs $0x8018fd,%rbx
+  80277e:	00 00 00 
+  802781:	ff d3                	call   *%rbx
+  802783:	49 89 c5             	mov    %rax,%r13
+    struct RegionOp ops[] = {
+  802786:	48 8d bd 30 ff ff ff 	lea    -0xd0(%rbp),%rdi
+  80278d:	b9 14 00 00 00       	mov    $0x14,%ecx
+  802792:	b8 00 00 00 00       	mov    $0x0,%eax
+  802797:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+  80279a:	c7 85 34 ff ff ff 46 	movl   $0x46,-0xcc(%rbp)
+  8027a1:	00 00 00 
+  8027a4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8027a8:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+  8027af:	48 c7 85 50 ff ff ff 	movq   $0x1000,-0xb0(%rbp)
+  8027b6:	00 10 00 00 
+  8027ba:	c7 85 5c ff ff ff 46 	movl   $0x46,-0xa4(%rbp)
+  8027c1:	00 00 00 
+            {.type = REGION_ALLOC, .dstva = (uintptr_t)fd1, .size = PAGE_SIZE, .perm = PROT_RW | PROT_SHARE},
+  8027c4:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+    struct RegionOp ops[] = {
+  8027c8:	48 89 bd 70 ff ff ff 	mov    %rdi,-0x90(%rbp)
+  8027cf:	48 c7 85 78 ff ff ff 	movq   $0x1000,-0x88(%rbp)
+  8027d6:	00 10 00 00 
+  8027da:	c7 45 84 46 00 00 00 	movl   $0x46,-0x7c(%rbp)
+  8027e1:	4c 89 6d 98          	mov    %r13,-0x68(%rbp)
+  8027e5:	48 c7 45 a0 00 10 00 	movq   $0x1000,-0x60(%rbp)
+  8027ec:	00 
+  8027ed:	c7 45 a8 01 00 00 00 	movl   $0x1,-0x58(%rbp)
+  8027f4:	c7 45 ac 46 00 00 00 	movl   $0x46,-0x54(%rbp)
+  8027fb:	4c 89 6d b8          	mov    %r13,-0x48(%rbp)
+            {.type = REGION_MAP, .srcva = (uintptr_t)va, .dstva = (uintptr_t)fd2data(fd1), .size = PAGE_SIZE, .perm = PROT_RW | PROT_SHARE},
+  8027ff:	ff d3                	call   *%rbx
+    struct RegionOp ops[] = {
+  802801:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802805:	48 c7 45 c8 00 10 00 	movq   $0x1000,-0x38(%rbp)
+  80280c:	00 
+    if ((res = sys_region_batch(ops, sizeof ops / sizeof *ops)) < 0) goto err1;
+  80280d:	be 04 00 00 00       	mov    $0x4,%esi
+  802812:	48 8d bd 30 ff ff ff 	lea    -0xd0(%rbp),%rdi
+  802819:	48 b8 b7 12 80 00 00 	movabs $0x8012b7,%rax
+  802820:	00 00 00 
+  802823:	ff d0                	call   *%rax
+  802825:	89 c3                	mov    %eax,%ebx
+  802827:	85 c0                	test   %eax,%eax
+  802829:	0f 88 ad 00 00 00    	js     8028dc <pipe+0x1c3>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  80282f:	be 00 10 00 00       	mov    $0x1000,%esi
+  802834:	4c 89 ef             	mov    %r13,%rdi
+  802837:	48 b8 26 11 80 00 00 	movabs $0x801126,%rax
+  80283e:	00 00 00 
+  802841:	ff d0                	call   *%rax
+  802843:	83 f8 02             	cmp    $0x2,%eax
+  802846:	75 5f                	jne    8028a7 <pipe+0x18e>
+    fd0->fd_dev_id = devpipe.dev_id;
+  802848:	a1 60 40 80 00 00 00 	movabs 0x804060,%eax
+  80284f:	00 00 
+  802851:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802855:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  802857:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80285b:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  802862:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  802866:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  802868:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80286c:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  802873:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802877:	48 bb eb 18 80 00 00 	movabs $0x8018eb,%rbx
+  80287e:	00 00 00 
+  802881:	ff d3                	call   *%rbx
+  802883:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  802887:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  80288b:	ff d3                	call   *%rbx
+  80288d:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  802892:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  802897:	89 d8                	mov    %ebx,%eax
+  802899:	48 81 c4 b8 00 00 00 	add    $0xb8,%rsp
+  8028a0:	5b                   	pop    %rbx
+  8028a1:	41 5c                	pop    %r12
+  8028a3:	41 5d                	pop    %r13
+  8028a5:	5d                   	pop    %rbp
+  8028a6:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8028a7:	48 b9 d0 35 80 00 00 	movabs $0x8035d0,%rcx
+  8028ae:	00 00 00 
+  8028b1:	48 ba a7 35 80 00 00 	movabs $0x8035a7,%rdx
+  8028b8:	00 00 00 
+  8028bb:	be 33 00 00 00       	mov    $0x33,%esi
+  8028c0:	48 bf bc 35 80 00 00 	movabs $0x8035bc,%rdi
+  8028c7:	00 00 00 
+  8028ca:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028cf:	49 b8 41 2e 80 00 00 	movabs $0x802e41,%r8
+  8028d6:	00 00 00 
+  8028d9:	41 ff d0             	call   *%r8
+        ops[i].type = REGION_UNMAP;
+  8028dc:	c7 85 30 ff ff ff 02 	movl   $0x2,-0xd0(%rbp)
+  8028e3:	00 00 00 
+  8028e6:	c7 85 58 ff ff ff 02 	movl   $0x2,-0xa8(%rbp)
+  8028ed:	00 00 00 
+  8028f0:	c7 45 80 02 00 00 00 	movl   $0x2,-0x80(%rbp)
+  8028f7:	c7 45 a8 02 00 00 00 	movl   $0x2,-0x58(%rbp)
+    sys_region_batch(ops, sizeof ops / sizeof *ops);
+  8028fe:	be 04 00 00 00       	mov    $0x4,%esi
+  802903:	48 8d bd 30 ff ff ff 	lea    -0xd0(%rbp),%rdi
+  80290a:	48 b8 b7 12 80 00 00 	movabs $0x8012b7,%rax
+  802911:	00 00 00 
+  802914:	ff d0                	call   *%rax
+  802916:	e9 7c ff ff ff       	jmp    802897 <pipe+0x17e>
+
+000000000080291b <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  80291b:	55                   	push   %rbp
+  80291c:	48 89 e5             	mov    %rsp,%rbp
+  80291f:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  802923:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802927:	48 b8 ac 19 80 00 00 	movabs $0x8019ac,%rax
+  80292e:	00 00 00 
+  802931:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802933:	85 c0                	test   %eax,%eax
+  802935:	78 35                	js     80296c <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  802937:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80293b:	48 b8 fd 18 80 00 00 	movabs $0x8018fd,%rax
+  802942:	00 00 00 
+  802945:	ff d0                	call   *%rax
+  802947:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80294a:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80294f:	be 00 10 00 00       	mov    $0x1000,%esi
+  802954:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802958:	48 b8 58 11 80 00 00 	movabs $0x801158,%rax
+  80295f:	00 00 00 
+  802962:	ff d0                	call   *%rax
+  802964:	85 c0                	test   %eax,%eax
+  802966:	0f 94 c0             	sete   %al
+  802969:	0f b6 c0             	movzbl %al,%eax
+}
+  80296c:	c9                   	leave
+  80296d:	c3                   	ret
+
+000000000080296e <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  80296e:	48 89 f8             	mov    %rdi,%rax
+  802971:	48 c1 e8 27          	shr    $0x27,%rax
+  802975:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  80297c:	01 00 00 
+  80297f:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802983:	f6 c2 01             	test   $0x1,%dl
+  802986:	74 6d                	je     8029f5 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  802988:	48 89 f8             	mov    %rdi,%rax
+  80298b:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80298f:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802996:	01 00 00 
+  802999:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80299d:	f6 c2 01             	test   $0x1,%dl
+  8029a0:	74 62                	je     802a04 <get_uvpt_entry+0x96>
+  8029a2:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8029a9:	01 00 00 
+  8029ac:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8029b0:	f6 c2 80             	test   $0x80,%dl
+  8029b3:	75 4f                	jne    802a04 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8029b5:	48 89 f8             	mov    %rdi,%rax
+  8029b8:	48 c1 e8 15          	shr    $0x15,%rax
+  8029bc:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8029c3:	01 00 00 
+  8029c6:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8029ca:	f6 c2 01             	test   $0x1,%dl
+  8029cd:	74 44                	je     802a13 <get_uvpt_entry+0xa5>
+  8029cf:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8029d6:	01 00 00 
+  8029d9:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8029dd:	f6 c2 80             	test   $0x80,%dl
+  8029e0:	75 31                	jne    802a13 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  8029e2:	48 c1 ef 0c          	shr    $0xc,%rdi
+  8029e6:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8029ed:	01 00 00 
+  8029f0:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  8029f4:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8029f5:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  8029fc:	01 00 00 
+  8029ff:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802a03:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  802a04:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802a0b:	01 00 00 
+  802a0e:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802a12:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  802a13:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802a1a:	01 00 00 
+  802a1d:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802a21:	c3                   	ret
+
+0000000000802a22 <get_prot>:
+
+int
+get_prot(void *va) {
+  802a22:	55                   	push   %rbp
+  802a23:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  802a26:	48 b8 6e 29 80 00 00 	movabs $0x80296e,%rax
+  802a2d:	00 00 00 
+  802a30:	ff d0                	call   *%rax
+  802a32:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  802a35:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  802a3a:	89 c1                	mov    %eax,%ecx
+  802a3c:	83 c9 04             	or     $0x4,%ecx
+  802a3f:	f6 c2 01             	test   $0x1,%dl
+  802a42:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  802a45:	89 c1                	mov    %eax,%ecx
+  802a47:	83 c9 02             	or     $0x2,%ecx
+  802a4a:	f6 c2 02             	test   $0x2,%dl
+  802a4d:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  802a50:	89 c1                	mov    %eax,%ecx
+  802a52:	83 c9 01             	or     $0x1,%ecx
+  802a55:	48 85 d2             	test   %rdx,%rdx
+  802a58:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  802a5b:	89 c1                	mov    %eax,%ecx
+  802a5d:	83 c9 40             	or     $0x40,%ecx
+  802a60:	f6 c6 04             	test   $0x4,%dh
+  802a63:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  802a66:	5d                   	pop    %rbp
+  802a67:	c3                   	ret
+
+0000000000802a68 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  802a68:	55                   	push   %rbp
+  802a69:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  802a6c:	48 b8 6e 29 80 00 00 	movabs $0x80296e,%rax
+  802a73:	00 00 00 
+  802a76:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  802a78:	48 c1 e8 06          	shr    $0x6,%rax
+  802a7c:	83 e0 01             	and    $0x1,%eax
+}
+  802a7f:	5d                   	pop    %rbp
+  802a80:	c3                   	ret
+
+0000000000802a81 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  802a81:	55                   	push   %rbp
+  802a82:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  802a85:	48 b8 6e 29 80 00 00 	movabs $0x80296e,%rax
+  802a8c:	00 00 00 
+  802a8f:	ff d0                	call   *%rax
+  802a91:	83 e0 01             	and    $0x1,%eax
+}
+  802a94:	5d                   	pop    %rbp
+  802a95:	c3                   	ret
+
+0000000000802a96 <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  802a96:	55                   	push   %rbp
+  802a97:	48 89 e5             	mov    %rsp,%rbp
+  802a9a:	41 57                	push   %r15
+  802a9c:	41 56                	push   %r14
+  802a9e:	41 55                	push   %r13
+  802aa0:	41 54                	push   %r12
+  802aa2:	53                   	push   %rbx
+  802aa3:	48 83 ec 38          	sub    $0x38,%rsp
+  802aa7:	49 89 f7             	mov    %rsi,%r15
+  802aaa:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+                    }
+                    continue;
+                }
+                for (int ptei = 0; ptei < PT_ENTRY_COUNT; ptei++) {
+                    uintptr_t pte_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, pdei, ptei, 0);
+                    pte_t pte = uvpt[VPT(pte_addr)];
+  802ab0:	49 bd 00 00 00 00 00 	movabs $0x10000000000,%r13
+  802ab7:	01 00 00 
+  802aba:	4d 89 e6             	mov    %r12,%r14
+  802abd:	49 89 fc             	mov    %rdi,%r12
+  802ac0:	e9 19 01 00 00       	jmp    802bde <foreach_shared_region+0x148>
+  802ac5:	48 89 5d b0          	mov    %rbx,-0x50(%rbp)
+  802ac9:	4c 89 75 a8          	mov    %r14,-0x58(%rbp)
+  802acd:	eb 52                	jmp    802b21 <foreach_shared_region+0x8b>
+                for (int ptei = 0; ptei < PT_ENTRY_COUNT; ptei++) {
+  802acf:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802ad6:	48 81 fb 00 00 20 00 	cmp    $0x200000,%rbx
+  802add:	74 2e                	je     802b0d <foreach_shared_region+0x77>
+                    uintptr_t pte_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, pdei, ptei, 0);
+  802adf:	48 89 df             	mov    %rbx,%rdi
+  802ae2:	4c 09 f7             	or     %r14,%rdi
+                    pte_t pte = uvpt[VPT(pte_addr)];
+  802ae5:	48 89 f8             	mov    %rdi,%rax
+  802ae8:	48 c1 e8 0c          	shr    $0xc,%rax
+  802aec:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+                    if ((pte & PTE_P) && (pte & PTE_SHARE)) {
+  802af1:	25 01 04 00 00       	and    $0x401,%eax
+  802af6:	48 3d 01 04 00 00    	cmp    $0x401,%rax
+  802afc:	75 d1                	jne    802acf <foreach_shared_region+0x39>
+                        fun((void*)pte_addr, (void*)(pte_addr + PAGE_SIZE), arg);
+  802afe:	48 8d b7 00 10 00 00 	lea    0x1000(%rdi),%rsi
+  802b05:	4c 89 fa             	mov    %r15,%rdx
+  802b08:	41 ff d4             	call   *%r12
+  802b0b:	eb c2                	jmp    802acf <foreach_shared_region+0x39>
+            for (int pdei = 0; pdei < PD_ENTRY_COUNT; pdei++) {
+  802b0d:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  802b14:	00 
+  802b15:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802b19:	48 3d 00 00 00 40    	cmp    $0x40000000,%rax
+  802b1f:	74 46                	je     802b67 <foreach_shared_region+0xd1>
+                uintptr_t pde_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, pdei, 0, 0);
+  802b21:	4c 8b 75 c8          	mov    -0x38(%rbp),%r14
+  802b25:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802b29:	49 09 c6             	or     %rax,%r14
+                pde_t pde = uvpd[VPD(pde_addr)];
+  802b2c:	4c 89 f0             	mov    %r14,%rax
+  802b2f:	48 c1 e8 15          	shr    $0x15,%rax
+  802b33:	48 b9 00 00 00 80 00 	movabs $0x10080000000,%rcx
+  802b3a:	01 00 00 
+  802b3d:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+                if (!(pde & PTE_P)) {
+  802b41:	a8 01                	test   $0x1,%al
+  802b43:	74 c8                	je     802b0d <foreach_shared_region+0x77>
+                if (pde & PTE_PS) {
+  802b45:	48 89 c3             	mov    %rax,%rbx
+  802b48:	81 e3 80 00 00 00    	and    $0x80,%ebx
+  802b4e:	74 8f                	je     802adf <foreach_shared_region+0x49>
+                    if (pde & PTE_SHARE) {
+  802b50:	f6 c4 04             	test   $0x4,%ah
+  802b53:	74 b8                	je     802b0d <foreach_shared_region+0x77>
+                        fun((void*)pde_addr, (void*)(pde_addr + 1024 * 1024 * 2), arg);
+  802b55:	49 8d b6 00 00 20 00 	lea    0x200000(%r14),%rsi
+  802b5c:	4c 89 fa             	mov    %r15,%rdx
+  802b5f:	4c 89 f7             	mov    %r14,%rdi
+  802b62:	41 ff d4             	call   *%r12
+  802b65:	eb a6                	jmp    802b0d <foreach_shared_region+0x77>
+  802b67:	48 8b 5d b0          	mov    -0x50(%rbp),%rbx
+  802b6b:	4c 8b 75 a8          	mov    -0x58(%rbp),%r14
+        for (int pdpei = 0; pdpei < PDP_ENTRY_COUNT; pdpei++) {
+  802b6f:	48 81 c3 00 00 00 40 	add    $0x40000000,%rbx
+  802b76:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802b7d:	00 00 00 
+  802b80:	48 39 c3             	cmp    %rax,%rbx
+  802b83:	74 4c                	je     802bd1 <foreach_shared_region+0x13b>
+            uintptr_t pdpe_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, 0, 0, 0);
+  802b85:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802b89:	48 09 d8             	or     %rbx,%rax
+  802b8c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+            pdpe_t pdpe = uvpdp[VPDP(pdpe_addr)];
+  802b90:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802b94:	48 b9 00 00 40 80 00 	movabs $0x10080400000,%rcx
+  802b9b:	01 00 00 
+  802b9e:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+            if (!(pdpe & PTE_P)) {
+  802ba2:	a8 01                	test   $0x1,%al
+  802ba4:	74 c9                	je     802b6f <foreach_shared_region+0xd9>
+            if (pdpe & PTE_PS) {
+  802ba6:	48 89 c1             	mov    %rax,%rcx
+  802ba9:	81 e1 80 00 00 00    	and    $0x80,%ecx
+  802baf:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  802bb3:	0f 84 0c ff ff ff    	je     802ac5 <foreach_shared_region+0x2f>
+                if (pdpe & PTE_SHARE) {
+  802bb9:	f6 c4 04             	test   $0x4,%ah
+  802bbc:	74 b1                	je     802b6f <foreach_shared_region+0xd9>
+                    fun((void*)pdpe_addr, (void*)(pdpe_addr + 1024 * 1024 * 1024), arg); 
+  802bbe:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  802bc2:	48 8d b7 00 00 00 40 	lea    0x40000000(%rdi),%rsi
+  802bc9:	4c 89 fa             	mov    %r15,%rdx
+  802bcc:	41 ff d4             	call   *%r12
+  802bcf:	eb 9e                	jmp    802b6f <foreach_shared_region+0xd9>
+    for (int pml4ei = 0; pml4ei < PML4_ENTRY_COUNT; pml4ei++) {
+  802bd1:	49 83 c6 01          	add    $0x1,%r14
+  802bd5:	49 81 fe 00 02 00 00 	cmp    $0x200,%r14
+  802bdc:	74 24                	je     802c02 <foreach_shared_region+0x16c>
+        pml4e_t pml4e = uvpml4[VPML4(pml4_addr)];
+  802bde:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  802be5:	01 00 00 
+  802be8:	4a 8b 04 f0          	mov    (%rax,%r14,8),%rax
+        if (!(pml4e & PTE_P)) {
+  802bec:	a8 01                	test   $0x1,%al
+  802bee:	74 e1                	je     802bd1 <foreach_shared_region+0x13b>
+  802bf0:	4c 89 f0             	mov    %r14,%rax
+  802bf3:	48 c1 e0 27          	shl    $0x27,%rax
+  802bf7:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  802bfb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802c00:	eb 83                	jmp    802b85 <foreach_shared_region+0xef>
+            }
+        }
+    }
+    
+    return 0;
+}
+  802c02:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c07:	48 83 c4 38          	add    $0x38,%rsp
+  802c0b:	5b                   	pop    %rbx
+  802c0c:	41 5c                	pop    %r12
+  802c0e:	41 5d                	pop    %r13
+  802c10:	41 5e                	pop    %r14
+  802c12:	41 5f                	pop    %r15
+  802c14:	5d                   	pop    %rbp
+  802c15:	c3                   	ret
+
+0000000000802c16 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  802c16:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c1b:	c3                   	ret
+
+0000000000802c1c <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  802c1c:	55                   	push   %rbp
+  802c1d:	48 89 e5             	mov    %rsp,%rbp
+  802c20:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  802c23:	48 be f4 35 80 00 00 	movabs $0x8035f4,%rsi
+  802c2a:	00 00 00 
+  802c2d:	48 b8 d4 0b 80 00 00 	movabs $0x800bd4,%rax
+  802c34:	00 00 00 
+  802c37:	ff d0                	call   *%rax
+    return 0;
+}
+  802c39:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c3e:	5d                   	pop    %rbp
+  802c3f:	c3                   	ret
+
+0000000000802c40 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  802c40:	55                   	push   %rbp
+  802c41:	48 89 e5             	mov    %rsp,%rbp
+  802c44:	41 57                	push   %r15
+  802c46:	41 56                	push   %r14
+  802c48:	41 55                	push   %r13
+  802c4a:	41 54                	push   %r12
+  802c4c:	53                   	push   %rbx
+  802c4d:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  802c54:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  802c5b:	48 85 d2             	test   %rdx,%rdx
+  802c5e:	74 7a                	je     802cda <devcons_write+0x9a>
+  802c60:	49 89 d6             	mov    %rdx,%r14
+  802c63:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802c69:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  802c6e:	49 bf ce 0d 80 00 00 	movabs $0x800dce,%r15
+  802c75:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  802c78:	4c 89 f3             	mov    %r14,%rbx
+  802c7b:	48 29 f3             	sub    %rsi,%rbx
+  802c7e:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802c83:	48 39 c3             	cmp    %rax,%rbx
+  802c86:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  802c8a:	4c 63 eb             	movslq %ebx,%r13
+  802c8d:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  802c94:	48 01 c6             	add    %rax,%rsi
+  802c97:	4c 89 ea             	mov    %r13,%rdx
+  802c9a:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802ca1:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  802ca4:	4c 89 ee             	mov    %r13,%rsi
+  802ca7:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802cae:	48 b8 fb 0f 80 00 00 	movabs $0x800ffb,%rax
+  802cb5:	00 00 00 
+  802cb8:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  802cba:	41 01 dc             	add    %ebx,%r12d
+  802cbd:	49 63 f4             	movslq %r12d,%rsi
+  802cc0:	4c 39 f6             	cmp    %r14,%rsi
+  802cc3:	72 b3                	jb     802c78 <devcons_write+0x38>
+    return res;
+  802cc5:	49 63 c4             	movslq %r12d,%rax
+}
+  802cc8:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  802ccf:	5b                   	pop    %rbx
+  802cd0:	41 5c                	pop    %r12
+  802cd2:	41 5d                	pop    %r13
+  802cd4:	41 5e                	pop    %r14
+  802cd6:	41 5f                	pop    %r15
+  802cd8:	5d                   	pop    %rbp
+  802cd9:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  802cda:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802ce0:	eb e3                	jmp    802cc5 <devcons_write+0x85>
+
+0000000000802ce2 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  802ce2:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  802ce5:	ba 00 00 00 00       	mov    $0x0,%edx
+  802cea:	48 85 c0             	test   %rax,%rax
+  802ced:	74 55                	je     802d44 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  802cef:	55                   	push   %rbp
+  802cf0:	48 89 e5             	mov    %rsp,%rbp
+  802cf3:	41 55                	push   %r13
+  802cf5:	41 54                	push   %r12
+  802cf7:	53                   	push   %rbx
+  802cf8:	48 83 ec 08          	sub    $0x8,%rsp
+  802cfc:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  802cff:	48 bb 28 10 80 00 00 	movabs $0x801028,%rbx
+  802d06:	00 00 00 
+  802d09:	49 bc f5 10 80 00 00 	movabs $0x8010f5,%r12
+  802d10:	00 00 00 
+  802d13:	eb 03                	jmp    802d18 <devcons_read+0x36>
+  802d15:	41 ff d4             	call   *%r12
+  802d18:	ff d3                	call   *%rbx
+  802d1a:	85 c0                	test   %eax,%eax
+  802d1c:	74 f7                	je     802d15 <devcons_read+0x33>
+    if (c < 0) return c;
+  802d1e:	48 63 d0             	movslq %eax,%rdx
+  802d21:	78 13                	js     802d36 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  802d23:	ba 00 00 00 00       	mov    $0x0,%edx
+  802d28:	83 f8 04             	cmp    $0x4,%eax
+  802d2b:	74 09                	je     802d36 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  802d2d:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  802d31:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  802d36:	48 89 d0             	mov    %rdx,%rax
+  802d39:	48 83 c4 08          	add    $0x8,%rsp
+  802d3d:	5b                   	pop    %rbx
+  802d3e:	41 5c                	pop    %r12
+  802d40:	41 5d                	pop    %r13
+  802d42:	5d                   	pop    %rbp
+  802d43:	c3                   	ret
+  802d44:	48 89 d0             	mov    %rdx,%rax
+  802d47:	c3                   	ret
+
+0000000000802d48 <cputchar>:
+cputchar(int ch) {
+  802d48:	55                   	push   %rbp
+  802d49:	48 89 e5             	mov    %rsp,%rbp
+  802d4c:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  802d50:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  802d54:	be 01 00 00 00       	mov    $0x1,%esi
+  802d59:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  802d5d:	48 b8 fb 0f 80 00 00 	movabs $0x800ffb,%rax
+  802d64:	00 00 00 
+  802d67:	ff d0                	call   *%rax
+}
+  802d69:	c9                   	leave
+  802d6a:	c3                   	ret
+
+0000000000802d6b <getchar>:
+getchar(void) {
+  802d6b:	55                   	push   %rbp
+  802d6c:	48 89 e5             	mov    %rsp,%rbp
+  802d6f:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  802d73:	ba 01 00 00 00       	mov    $0x1,%edx
+  802d78:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  802d7c:	bf 00 00 00 00       	mov    $0x0,%edi
+  802d81:	48 b8 8f 1c 80 00 00 	movabs $0x801c8f,%rax
+  802d88:	00 00 00 
+  802d8b:	ff d0                	call   *%rax
+  802d8d:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  802d8f:	85 c0                	test   %eax,%eax
+  802d91:	78 06                	js     802d99 <getchar+0x2e>
+  802d93:	74 08                	je     802d9d <getchar+0x32>
+  802d95:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  802d99:	89 d0                	mov    %edx,%eax
+  802d9b:	c9                   	leave
+  802d9c:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  802d9d:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  802da2:	eb f5                	jmp    802d99 <getchar+0x2e>
+
+0000000000802da4 <iscons>:
+iscons(int fdnum) {
+  802da4:	55                   	push   %rbp
+  802da5:	48 89 e5             	mov    %rsp,%rbp
+  802da8:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  802dac:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802db0:	48 b8 ac 19 80 00 00 	movabs $0x8019ac,%rax
+  802db7:	00 00 00 
+  802dba:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802dbc:	85 c0                	test   %eax,%eax
+  802dbe:	78 18                	js     802dd8 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  802dc0:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802dc4:	48 b8 a0 40 80 00 00 	movabs $0x8040a0,%rax
+  802dcb:	00 00 00 
+  802dce:	8b 00                	mov    (%rax),%eax
+  802dd0:	39 02                	cmp    %eax,(%rdx)
+  802dd2:	0f 94 c0             	sete   %al
+  802dd5:	0f b6 c0             	movzbl %al,%eax
+}
+  802dd8:	c9                   	leave
+  802dd9:	c3                   	ret
+
+0000000000802dda <opencons>:
+opencons(void) {
+  802dda:	55                   	push   %rbp
+  802ddb:	48 89 e5             	mov    %rsp,%rbp
+  802dde:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802de2:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  802de6:	48 b8 92 19 80 00 00 	movabs $0x801992,%rax
+  802ded:	00 00 00 
+  802df0:	ff d0                	call   *%rax
+  802df2:	85 c0                	test   %eax,%eax
+  802df4:	78 49                	js     802e3f <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  802df6:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802dfb:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802e00:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  802e04:	bf 00 00 00 00       	mov    $0x0,%edi
+  802e09:	48 b8 84 11 80 00 00 	movabs $0x801184,%rax
+  802e10:	00 00 00 
+  802e13:	ff d0                	call   *%rax
+  802e15:	85 c0                	test   %eax,%eax
+  802e17:	78 26                	js     802e3f <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  802e19:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802e1d:	a1 a0 40 80 00 00 00 	movabs 0x8040a0,%eax
+  802e24:	00 00 
+  802e26:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  802e28:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802e2c:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  802e33:	48 b8 eb 18 80 00 00 	movabs $0x8018eb,%rax
+  802e3a:	00 00 00 
+  802e3d:	ff d0                	call   *%rax
+}
+  802e3f:	c9                   	leave
+  802e40:	c3                   	ret
+
+0000000000802e41 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  802e41:	55                   	push   %rbp
+  802e42:	48 89 e5             	mov    %rsp,%rbp
+  802e45:	41 56                	push   %r14
+  802e47:	41 55                	push   %r13
+  802e49:	41 54                	push   %r12
+  802e4b:	53                   	push   %rbx
+  802e4c:	48 83 ec 50          	sub    $0x50,%rsp
+  802e50:	49 89 fc             	mov    %rdi,%r12
+  802e53:	41 89 f5             	mov    %esi,%r13d
+  802e56:	48 89 d3             	mov    %rdx,%rbx
+  802e59:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  802e5d:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  802e61:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  802e65:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  802e6c:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802e70:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  802e74:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  802e78:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  802e7c:	48 b8 00 40 80 00 00 	movabs $0x804000,%rax
+  802e83:	00 00 00 
+  802e86:	4c 8b 30             	mov    (%rax),%r14
+  802e89:	48 b8 c4 10 80 00 00 	movabs $0x8010c4,%rax
+  802e90:	00 00 00 
+  802e93:	ff d0                	call   *%rax
+  802e95:	89 c6                	mov    %eax,%esi
+  802e97:	45 89 e8             	mov    %r13d,%r8d
+  802e9a:	4c 89 e1             	mov    %r12,%rcx
+  802e9d:	4c 89 f2             	mov    %r14,%rdx
+  802ea0:	48 bf 00 36 80 00 00 	movabs $0x803600,%rdi
+  802ea7:	00 00 00 
+  802eaa:	b8 00 00 00 00       	mov    $0x0,%eax
+  802eaf:	49 bc af 02 80 00 00 	movabs $0x8002af,%r12
+  802eb6:	00 00 00 
+  802eb9:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  802ebc:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  802ec0:	48 89 df             	mov    %rbx,%rdi
+  802ec3:	48 b8 4b 02 80 00 00 	movabs $0x80024b,%rax
+  802eca:	00 00 00 
+  802ecd:	ff d0                	call   *%rax
+    cprintf("\n");
+  802ecf:	48 bf 5b 35 80 00 00 	movabs $0x80355b,%rdi
+  802ed6:	00 00 00 
+  802ed9:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ede:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  802ee1:	cc                   	int3
+  802ee2:	eb fd                	jmp    802ee1 <_panic+0xa0>
+  802ee4:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000802ee8 <__rodata_start>:
+  802ee8:	73 65                	jae    802f4f <__rodata_start+0x67>
+  802eea:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802eeb:	64 20 30             	and    %dh,%fs:(%rax)
+  802eee:	20 66 72             	and    %ah,0x72(%rsi)
+  802ef1:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802ef2:	6d                   	insl   (%dx),%es:(%rdi)
+  802ef3:	20 25 78 20 74 6f    	and    %ah,0x6f742078(%rip)        # 6ff44f71 <__bss_end+0x6f73cf71>
+  802ef9:	20 25 78 0a 00 25    	and    %ah,0x25000a78(%rip)        # 25803977 <__bss_end+0x24ffb977>
+  802eff:	78 20                	js     802f21 <__rodata_start+0x39>
+  802f01:	67 6f                	outsl  %ds:(%esi),(%dx)
+  802f03:	74 20                	je     802f25 <__rodata_start+0x3d>
+  802f05:	25 64 20 66 72       	and    $0x72662064,%eax
+  802f0a:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802f0b:	6d                   	insl   (%dx),%es:(%rdi)
+  802f0c:	20 25 78 0a 00 3c    	and    %ah,0x3c000a78(%rip)        # 3c80398a <__bss_end+0x3bffb98a>
+  802f12:	75 6e                	jne    802f82 <__rodata_start+0x9a>
+  802f14:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  802f18:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802f19:	3e 00 30             	ds add %dh,(%rax)
+  802f1c:	31 32                	xor    %esi,(%rdx)
+  802f1e:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  802f25:	41                   	rex.B
+  802f26:	42                   	rex.X
+  802f27:	43                   	rex.XB
+  802f28:	44                   	rex.R
+  802f29:	45                   	rex.RB
+  802f2a:	46 00 30             	rex.RX add %r14b,(%rax)
+  802f2d:	31 32                	xor    %esi,(%rdx)
+  802f2f:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  802f36:	61                   	(bad)
+  802f37:	62 63 64 65 66       	(bad)
+  802f3c:	00 28                	add    %ch,(%rax)
+  802f3e:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802f3f:	75 6c                	jne    802fad <__rodata_start+0xc5>
+  802f41:	6c                   	insb   (%dx),%es:(%rdi)
+  802f42:	29 00                	sub    %eax,(%rax)
+  802f44:	65 72 72             	gs jb  802fb9 <__rodata_start+0xd1>
+  802f47:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802f48:	72 20                	jb     802f6a <__rodata_start+0x82>
+  802f4a:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  802f4f:	73 70                	jae    802fc1 <__rodata_start+0xd9>
+  802f51:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  802f55:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  802f5c:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802f5d:	72 00                	jb     802f5f <__rodata_start+0x77>
+  802f5f:	62 61 64 20 65       	(bad)
+  802f64:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802f65:	76 69                	jbe    802fd0 <__rodata_start+0xe8>
+  802f67:	72 6f                	jb     802fd8 <__rodata_start+0xf0>
+  802f69:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802f6a:	6d                   	insl   (%dx),%es:(%rdi)
+  802f6b:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  802f6d:	74 00                	je     802f6f <__rodata_start+0x87>
+  802f6f:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  802f76:	20 70 61             	and    %dh,0x61(%rax)
+  802f79:	72 61                	jb     802fdc <__rodata_start+0xf4>
+  802f7b:	6d                   	insl   (%dx),%es:(%rdi)
+  802f7c:	65 74 65             	gs je  802fe4 <__rodata_start+0xfc>
+  802f7f:	72 00                	jb     802f81 <__rodata_start+0x99>
+  802f81:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802f82:	75 74                	jne    802ff8 <__rodata_start+0x110>
+  802f84:	20 6f 66             	and    %ch,0x66(%rdi)
+  802f87:	20 6d 65             	and    %ch,0x65(%rbp)
+  802f8a:	6d                   	insl   (%dx),%es:(%rdi)
+  802f8b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802f8c:	72 79                	jb     803007 <__rodata_start+0x11f>
+  802f8e:	00 6f 75             	add    %ch,0x75(%rdi)
+  802f91:	74 20                	je     802fb3 <__rodata_start+0xcb>
+  802f93:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802f94:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  802f98:	76 69                	jbe    803003 <__rodata_start+0x11b>
+  802f9a:	72 6f                	jb     80300b <__rodata_start+0x123>
+  802f9c:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802f9d:	6d                   	insl   (%dx),%es:(%rdi)
+  802f9e:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  802fa0:	74 73                	je     803015 <__rodata_start+0x12d>
+  802fa2:	00 63 6f             	add    %ah,0x6f(%rbx)
+  802fa5:	72 72                	jb     803019 <__rodata_start+0x131>
+  802fa7:	75 70                	jne    803019 <__rodata_start+0x131>
+  802fa9:	74 65                	je     803010 <__rodata_start+0x128>
+  802fab:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  802fb0:	75 67                	jne    803019 <__rodata_start+0x131>
+  802fb2:	20 69 6e             	and    %ch,0x6e(%rcx)
+  802fb5:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  802fb7:	00 73 65             	add    %dh,0x65(%rbx)
+  802fba:	67 6d                	insl   (%dx),%es:(%edi)
+  802fbc:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  802fbe:	74 61                	je     803021 <__rodata_start+0x139>
+  802fc0:	74 69                	je     80302b <__rodata_start+0x143>
+  802fc2:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802fc3:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802fc4:	20 66 61             	and    %ah,0x61(%rsi)
+  802fc7:	75 6c                	jne    803035 <__rodata_start+0x14d>
+  802fc9:	74 00                	je     802fcb <__rodata_start+0xe3>
+  802fcb:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  802fd2:	20 45 4c             	and    %al,0x4c(%rbp)
+  802fd5:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  802fd9:	61                   	(bad)
+  802fda:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  802fdf:	20 73 75             	and    %dh,0x75(%rbx)
+  802fe2:	63 68 20             	movsxd 0x20(%rax),%ebp
+  802fe5:	73 79                	jae    803060 <__rodata_start+0x178>
+  802fe7:	73 74                	jae    80305d <__rodata_start+0x175>
+  802fe9:	65 6d                	gs insl (%dx),%es:(%rdi)
+  802feb:	20 63 61             	and    %ah,0x61(%rbx)
+  802fee:	6c                   	insb   (%dx),%es:(%rdi)
+  802fef:	6c                   	insb   (%dx),%es:(%rdi)
+  802ff0:	00 65 6e             	add    %ah,0x6e(%rbp)
+  802ff3:	74 72                	je     803067 <__rodata_start+0x17f>
+  802ff5:	79 20                	jns    803017 <__rodata_start+0x12f>
+  802ff7:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802ff8:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802ff9:	74 20                	je     80301b <__rodata_start+0x133>
+  802ffb:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  802ffd:	75 6e                	jne    80306d <__rodata_start+0x185>
+  802fff:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  803003:	76 20                	jbe    803025 <__rodata_start+0x13d>
+  803005:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  80300c:	72 65                	jb     803073 <__rodata_start+0x18b>
+  80300e:	63 76 69             	movsxd 0x69(%rsi),%esi
+  803011:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803012:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  803016:	65 78 70             	gs js  803089 <__rodata_start+0x1a1>
+  803019:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  80301e:	20 65 6e             	and    %ah,0x6e(%rbp)
+  803021:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  803025:	20 66 69             	and    %ah,0x69(%rsi)
+  803028:	6c                   	insb   (%dx),%es:(%rdi)
+  803029:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  80302d:	20 66 72             	and    %ah,0x72(%rsi)
+  803030:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  803035:	61                   	(bad)
+  803036:	63 65 20             	movsxd 0x20(%rbp),%esp
+  803039:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80303a:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80303b:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  80303f:	6b 00 74             	imul   $0x74,(%rax),%eax
+  803042:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803043:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803044:	20 6d 61             	and    %ch,0x61(%rbp)
+  803047:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803048:	79 20                	jns    80306a <__rodata_start+0x182>
+  80304a:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  803051:	72 65                	jb     8030b8 <__rodata_start+0x1d0>
+  803053:	20 6f 70             	and    %ch,0x70(%rdi)
+  803056:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803058:	00 66 69             	add    %ah,0x69(%rsi)
+  80305b:	6c                   	insb   (%dx),%es:(%rdi)
+  80305c:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  803060:	20 62 6c             	and    %ah,0x6c(%rdx)
+  803063:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803064:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  803067:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803068:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803069:	74 20                	je     80308b <__rodata_start+0x1a3>
+  80306b:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  80306d:	75 6e                	jne    8030dd <__rodata_start+0x1f5>
+  80306f:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  803073:	76 61                	jbe    8030d6 <__rodata_start+0x1ee>
+  803075:	6c                   	insb   (%dx),%es:(%rdi)
+  803076:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  80307d:	00 
+  80307e:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  803085:	72 65                	jb     8030ec <__rodata_start+0x204>
+  803087:	61                   	(bad)
+  803088:	64 79 20             	fs jns 8030ab <__rodata_start+0x1c3>
+  80308b:	65 78 69             	gs js  8030f7 <__rodata_start+0x20f>
+  80308e:	73 74                	jae    803104 <__rodata_start+0x21c>
+  803090:	73 00                	jae    803092 <__rodata_start+0x1aa>
+  803092:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803093:	70 65                	jo     8030fa <__rodata_start+0x212>
+  803095:	72 61                	jb     8030f8 <__rodata_start+0x210>
+  803097:	74 69                	je     803102 <__rodata_start+0x21a>
+  803099:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80309a:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80309b:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  80309e:	74 20                	je     8030c0 <__rodata_start+0x1d8>
+  8030a0:	73 75                	jae    803117 <__rodata_start+0x22f>
+  8030a2:	70 70                	jo     803114 <__rodata_start+0x22c>
+  8030a4:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8030a5:	72 74                	jb     80311b <__rodata_start+0x233>
+  8030a7:	65 64 00 6f 70       	gs add %ch,%fs:0x70(%rdi)
+  8030ac:	65 72 61             	gs jb  803110 <__rodata_start+0x228>
+  8030af:	74 69                	je     80311a <__rodata_start+0x232>
+  8030b1:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8030b2:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8030b3:	20 69 6e             	and    %ch,0x6e(%rcx)
+  8030b6:	74 65                	je     80311d <__rodata_start+0x235>
+  8030b8:	72 72                	jb     80312c <__rodata_start+0x244>
+  8030ba:	75 70                	jne    80312c <__rodata_start+0x244>
+  8030bc:	74 65                	je     803123 <__rodata_start+0x23b>
+  8030be:	64 00 6e 6f          	add    %ch,%fs:0x6f(%rsi)
+  8030c2:	74 20                	je     8030e4 <__rodata_start+0x1fc>
+  8030c4:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  8030c6:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8030c7:	75 67                	jne    803130 <__rodata_start+0x248>
+  8030c9:	68 20 43 50 55       	push   $0x55504320
+  8030ce:	20 74 69 6d          	and    %dh,0x6d(%rcx,%rbp,2)
+  8030d2:	65 00 66 2e          	add    %ah,%gs:0x2e(%rsi)
+  8030d6:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+  8030dd:	00 
+  8030de:	66 90                	xchg   %ax,%ax
+  8030e0:	9c                   	pushf
+  8030e1:	04 80                	add    $0x80,%al
+  8030e3:	00 00                	add    %al,(%rax)
+  8030e5:	00 00                	add    %al,(%rax)
+  8030e7:	00 dd                	add    %bl,%ch
+  8030e9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8030ef:	00 cd                	add    %cl,%ch
+  8030f1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8030f7:	00 dd                	add    %bl,%ch
+  8030f9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8030ff:	00 dd                	add    %bl,%ch
+  803101:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803107:	00 dd                	add    %bl,%ch
+  803109:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80310f:	00 dd                	add    %bl,%ch
+  803111:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803117:	00 bb 04 80 00 00    	add    %bh,0x8004(%rbx)
+  80311d:	00 00                	add    %al,(%rax)
+  80311f:	00 dd                	add    %bl,%ch
+  803121:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803127:	00 dd                	add    %bl,%ch
+  803129:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80312f:	00 af 04 80 00 00    	add    %ch,0x8004(%rdi)
+  803135:	00 00                	add    %al,(%rax)
+  803137:	00 29                	add    %ch,(%rcx)
+  803139:	05 80 00 00 00       	add    $0x80,%eax
+  80313e:	00 00                	add    %al,(%rax)
+  803140:	dd 0a                	fisttpll (%rdx)
+  803142:	80 00 00             	addb   $0x0,(%rax)
+  803145:	00 00                	add    %al,(%rax)
+  803147:	00 af 04 80 00 00    	add    %ch,0x8004(%rdi)
+  80314d:	00 00                	add    %al,(%rax)
+  80314f:	00 f5                	add    %dh,%ch
+  803151:	04 80                	add    $0x80,%al
+  803153:	00 00                	add    %al,(%rax)
+  803155:	00 00                	add    %al,(%rax)
+  803157:	00 f5                	add    %dh,%ch
+  803159:	04 80                	add    $0x80,%al
+  80315b:	00 00                	add    %al,(%rax)
+  80315d:	00 00                	add    %al,(%rax)
+  80315f:	00 f5                	add    %dh,%ch
+  803161:	04 80                	add    $0x80,%al
+  803163:	00 00                	add    %al,(%rax)
+  803165:	00 00                	add    %al,(%rax)
+  803167:	00 f5                	add    %dh,%ch
+  803169:	04 80                	add    $0x80,%al
+  80316b:	00 00                	add    %al,(%rax)
+  80316d:	00 00                	add    %al,(%rax)
+  80316f:	00 f5                	add    %dh,%ch
+  803171:	04 80                	add    $0x80,%al
+  803173:	00 00                	add    %al,(%rax)
+  803175:	00 00                	add    %al,(%rax)
+  803177:	00 f5                	add    %dh,%ch
+  803179:	04 80                	add    $0x80,%al
+  80317b:	00 00                	add    %al,(%rax)
+  80317d:	00 00                	add    %al,(%rax)
+  80317f:	00 f5                	add    %dh,%ch
+  803181:	04 80                	add    $0x80,%al
+  803183:	00 00                	add    %al,(%rax)
+  803185:	00 00                	add    %al,(%rax)
+  803187:	00 f5                	add    %dh,%ch
+  803189:	04 80                	add    $0x80,%al
+  80318b:	00 00                	add    %al,(%rax)
+  80318d:	00 00                	add    %al,(%rax)
+  80318f:	00 f5                	add    %dh,%ch
+  803191:	04 80                	add    $0x80,%al
+  803193:	00 00                	add    %al,(%rax)
+  803195:	00 00                	add    %al,(%rax)
+  803197:	00 dd                	add    %bl,%ch
+  803199:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80319f:	00 dd                	add    %bl,%ch
+  8031a1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8031a7:	00 dd                	add    %bl,%ch
+  8031a9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8031af:	00 dd                	add    %bl,%ch
+  8031b1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8031b7:	00 dd                	add    %bl,%ch
+  8031b9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8031bf:	00 dd                	add    %bl,%ch
+  8031c1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8031c7:	00 dd                	add    %bl,%ch
+  8031c9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8031cf:	00 dd                	add    %bl,%ch
+  8031d1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8031d7:	00 dd                	add    %bl,%ch
+  8031d9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8031df:	00 dd                	add    %bl,%ch
+  8031e1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8031e7:	00 dd                	add    %bl,%ch
+  8031e9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8031ef:	00 dd                	add    %bl,%ch
+  8031f1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8031f7:	00 dd                	add    %bl,%ch
+  8031f9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8031ff:	00 dd                	add    %bl,%ch
+  803201:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803207:	00 dd                	add    %bl,%ch
+  803209:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80320f:	00 dd                	add    %bl,%ch
+  803211:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803217:	00 dd                	add    %bl,%ch
+  803219:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80321f:	00 dd                	add    %bl,%ch
+  803221:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803227:	00 dd                	add    %bl,%ch
+  803229:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80322f:	00 dd                	add    %bl,%ch
+  803231:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803237:	00 dd                	add    %bl,%ch
+  803239:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80323f:	00 dd                	add    %bl,%ch
+  803241:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803247:	00 dd                	add    %bl,%ch
+  803249:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80324f:	00 dd                	add    %bl,%ch
+  803251:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803257:	00 dd                	add    %bl,%ch
+  803259:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80325f:	00 dd                	add    %bl,%ch
+  803261:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803267:	00 dd                	add    %bl,%ch
+  803269:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80326f:	00 dd                	add    %bl,%ch
+  803271:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803277:	00 dd                	add    %bl,%ch
+  803279:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80327f:	00 dd                	add    %bl,%ch
+  803281:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803287:	00 00                	add    %al,(%rax)
+  803289:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80328f:	00 dd                	add    %bl,%ch
+  803291:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803297:	00 dd                	add    %bl,%ch
+  803299:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80329f:	00 dd                	add    %bl,%ch
+  8032a1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8032a7:	00 dd                	add    %bl,%ch
+  8032a9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8032af:	00 dd                	add    %bl,%ch
+  8032b1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8032b7:	00 dd                	add    %bl,%ch
+  8032b9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8032bf:	00 dd                	add    %bl,%ch
+  8032c1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8032c7:	00 dd                	add    %bl,%ch
+  8032c9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8032cf:	00 dd                	add    %bl,%ch
+  8032d1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8032d7:	00 dd                	add    %bl,%ch
+  8032d9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8032df:	00 4c 05 80          	add    %cl,-0x80(%rbp,%rax,1)
+  8032e3:	00 00                	add    %al,(%rax)
+  8032e5:	00 00                	add    %al,(%rax)
+  8032e7:	00 1b                	add    %bl,(%rbx)
+  8032e9:	07                   	(bad)
+  8032ea:	80 00 00             	addb   $0x0,(%rax)
+  8032ed:	00 00                	add    %al,(%rax)
+  8032ef:	00 dd                	add    %bl,%ch
+  8032f1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8032f7:	00 dd                	add    %bl,%ch
+  8032f9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8032ff:	00 dd                	add    %bl,%ch
+  803301:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803307:	00 dd                	add    %bl,%ch
+  803309:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80330f:	00 7b 05             	add    %bh,0x5(%rbx)
+  803312:	80 00 00             	addb   $0x0,(%rax)
+  803315:	00 00                	add    %al,(%rax)
+  803317:	00 dd                	add    %bl,%ch
+  803319:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80331f:	00 dd                	add    %bl,%ch
+  803321:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803327:	00 41 05             	add    %al,0x5(%rcx)
+  80332a:	80 00 00             	addb   $0x0,(%rax)
+  80332d:	00 00                	add    %al,(%rax)
+  80332f:	00 dd                	add    %bl,%ch
+  803331:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803337:	00 dd                	add    %bl,%ch
+  803339:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80333f:	00 c3                	add    %al,%bl
+  803341:	08 80 00 00 00 00    	or     %al,0x0(%rax)
+  803347:	00 8d 09 80 00 00    	add    %cl,0x8009(%rbp)
+  80334d:	00 00                	add    %al,(%rax)
+  80334f:	00 dd                	add    %bl,%ch
+  803351:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803357:	00 dd                	add    %bl,%ch
+  803359:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80335f:	00 12                	add    %dl,(%rdx)
+  803361:	06                   	(bad)
+  803362:	80 00 00             	addb   $0x0,(%rax)
+  803365:	00 00                	add    %al,(%rax)
+  803367:	00 dd                	add    %bl,%ch
+  803369:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80336f:	00 ef                	add    %ch,%bh
+  803371:	07                   	(bad)
+  803372:	80 00 00             	addb   $0x0,(%rax)
+  803375:	00 00                	add    %al,(%rax)
+  803377:	00 dd                	add    %bl,%ch
+  803379:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80337f:	00 dd                	add    %bl,%ch
+  803381:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803387:	00 00                	add    %al,(%rax)
+  803389:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80338f:	00 dd                	add    %bl,%ch
+  803391:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803397:	00 a5 04 80 00 00    	add    %ah,0x8004(%rbp)
+  80339d:	00 00                	add    %al,(%rax)
+	...
+
+00000000008033a0 <error_string>:
+	...
+  8033a8:	4d 2f 80 00 00 00 00 00 5f 2f 80 00 00 00 00 00     M/......_/......
+  8033b8:	6f 2f 80 00 00 00 00 00 81 2f 80 00 00 00 00 00     o/......./......
+  8033c8:	8f 2f 80 00 00 00 00 00 a3 2f 80 00 00 00 00 00     ./......./......
+  8033d8:	b8 2f 80 00 00 00 00 00 cb 2f 80 00 00 00 00 00     ./......./......
+  8033e8:	dd 2f 80 00 00 00 00 00 f1 2f 80 00 00 00 00 00     ./......./......
+  8033f8:	01 30 80 00 00 00 00 00 14 30 80 00 00 00 00 00     .0.......0......
+  803408:	2b 30 80 00 00 00 00 00 41 30 80 00 00 00 00 00     +0......A0......
+  803418:	59 30 80 00 00 00 00 00 71 30 80 00 00 00 00 00     Y0......q0......
+  803428:	7e 30 80 00 00 00 00 00 50 34 80 00 00 00 00 00     ~0......P4......
+  803438:	92 30 80 00 00 00 00 00 aa 30 80 00 00 00 00 00     .0.......0......
+  803448:	c0 30 80 00 00 00 00 00 66 69 6c 65 20 69 73 20     .0......file is 
+  803458:	6e 6f 74 20 61 20 76 61 6c 69 64 20 65 78 65 63     not a valid exec
+  803468:	75 74 61 62 6c 65 00 90 73 79 73 63 61 6c 6c 20     utable..syscall 
+  803478:	25 7a 64 20 72 65 74 75 72 6e 65 64 20 25 7a 64     %zd returned %zd
+  803488:	20 28 3e 20 30 29 00 6c 69 62 2f 73 79 73 63 61      (> 0).lib/sysca
+  803498:	6c 6c 2e 63 00 46 6f 72 6b 20 64 6f 75 62 6c 65     ll.c.Fork double
+  8034a8:	20 66 61 75 6c 74 00 6c 69 62 2f 66 6f 72 6b 2e      fault.lib/fork.
+  8034b8:	63 00 73 66 6f 72 6b 28 29 20 69 73 20 6e 6f 74     c.sfork() is not
+  8034c8:	20 69 6d 70 6c 65 6d 65 6e 74 65 64 00 73 79 73      implemented.sys
+  8034d8:	5f 69 70 63 5f 74 72 79 5f 73 65 6e 64 20 66 61     _ipc_try_send fa
+  8034e8:	69 6c 65 64 3a 20 25 69 00 6c 69 62 2f 69 70 63     iled: %i.lib/ipc
+  8034f8:	2e 63 00 0f 1f 44 00 00 5b 25 30 38 78 5d 20 75     .c...D..[%08x] u
+  803508:	6e 6b 6e 6f 77 6e 20 64 65 76 69 63 65 20 74 79     nknown device ty
+  803518:	70 65 20 25 64 0a 00 00 5b 25 30 38 78 5d 20 66     pe %d...[%08x] f
+  803528:	74 72 75 6e 63 61 74 65 20 25 64 20 2d 2d 20 62     truncate %d -- b
+  803538:	61 64 20 6d 6f 64 65 0a 00 5b 25 30 38 78 5d 20     ad mode..[%08x] 
+  803548:	72 65 61 64 20 25 64 20 2d 2d 20 62 61 64 20 6d     read %d -- bad m
+  803558:	6f 64 65 0a 00 5b 25 30 38 78 5d 20 77 72 69 74     ode..[%08x] writ
+  803568:	65 20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65     e %d -- bad mode
+  803578:	0a 00 66 0f 1f 44 00 00                             ..f..D..
+
+0000000000803580 <devtab>:
+  803580:	20 40 80 00 00 00 00 00 60 40 80 00 00 00 00 00      @......`@......
+  803590:	a0 40 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .@..............
+  8035a0:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  8035b0:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  8035c0:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  8035d0:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  8035e0:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  8035f0:	3d 20 32 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73 00     = 2.<cons>.cons.
+  803600:	5b 25 30 38 78 5d 20 75 73 65 72 20 70 61 6e 69     [%08x] user pani
+  803610:	63 20 69 6e 20 25 73 20 61 74 20 25 73 3a 25 64     c in %s at %s:%d
+  803620:	3a 20 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     : .f.........f..
+  803630:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803640:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803650:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803660:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803670:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803680:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803690:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8036a0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8036b0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8036c0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8036d0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8036e0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8036f0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803700:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803710:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803720:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803730:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803740:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803750:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803760:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803770:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803780:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803790:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8037a0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8037b0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8037c0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8037d0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8037e0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8037f0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803800:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803810:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803820:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803830:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803840:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803850:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803860:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803870:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803880:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803890:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8038a0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8038b0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8038c0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8038d0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8038e0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8038f0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803900:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803910:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803920:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803930:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803940:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803950:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803960:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803970:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803980:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803990:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8039a0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8039b0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8039c0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8039d0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8039e0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8039f0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803a00:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803a10:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803a20:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803a30:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803a40:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803a50:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803a60:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803a70:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803a80:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803a90:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803aa0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803ab0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803ac0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803ad0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803ae0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803af0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803b00:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803b10:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803b20:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803b30:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803b40:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803b50:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803b60:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803b70:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803b80:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803b90:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803ba0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803bb0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803bc0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803bd0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803be0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803bf0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803c00:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803c10:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803c20:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803c30:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803c40:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803c50:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803c60:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803c70:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803c80:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803c90:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803ca0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803cb0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803cc0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803cd0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803ce0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803cf0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803d00:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803d10:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803d20:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803d30:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803d40:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803d50:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803d60:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803d70:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803d80:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803d90:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803da0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803db0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803dc0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803dd0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803de0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803df0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803e00:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803e10:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803e20:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803e30:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803e40:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803e50:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803e60:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803e70:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803e80:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803e90:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803ea0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803eb0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803ec0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803ed0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803ee0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803ef0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803f00:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803f10:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803f20:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803f30:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803f40:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803f50:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803f60:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803f70:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803f80:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803f90:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803fa0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803fb0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803fc0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803fd0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803fe0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803ff0:	00 66 2e 0f 1f 84 00 00 00 00 00 0f 1f 44 00 00     .f...........D..
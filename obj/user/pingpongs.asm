@@ -0,0 +1,5928 @@
+
+obj/user/pingpongs:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 6d 01 00 00       	call   800190 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+#include <inc/lib.h>
+
+uint32_t val;
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 57                	push   %r15
+  80002b:	41 56                	push   %r14
+  80002d:	41 55                	push   %r13
+  80002f:	41 54                	push   %r12
+  800031:	53                   	push   %rbx
+  800032:	48 83 ec 18          	sub    $0x18,%rsp
+    envid_t who;
+
+    if ((who = sfork()) != 0) {
+  800036:	48 b8 4f 17 80 00 00 	movabs $0x80174f,%rax
+  80003d:	00 00 00 
+  800040:	ff d0                	call   *%rax
+  800042:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  800045:	85 c0                	test   %eax,%eax
+  800047:	0f 85 c3 00 00 00    	jne    800110 <umain+0xeb>
+        ipc_send(who, 0, 0, 0, 0);
+    }
+
+    while (1) {
+        ipc_recv(&who, 0, 0, 0);
+        cprintf("%x got %d from %x (thisenv is %p %x)\n", sys_getenvid(), val, who, thisenv, thisenv->env_id);
+  80004d:	48 bb 00 50 80 00 00 	movabs $0x805000,%rbx
+  800054:	00 00 00 
+        ipc_recv(&who, 0, 0, 0);
+  800057:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80005c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800061:	be 00 00 00 00       	mov    $0x0,%esi
+  800066:	48 8d 7d cc          	lea    -0x34(%rbp),%rdi
+  80006a:	48 b8 7d 17 80 00 00 	movabs $0x80177d,%rax
+  800071:	00 00 00 
+  800074:	ff d0                	call   *%rax
+        cprintf("%x got %d from %x (thisenv is %p %x)\n", sys_getenvid(), val, who, thisenv, thisenv->env_id);
+  800076:	48 b8 08 50 80 00 00 	movabs $0x805008,%rax
+  80007d:	00 00 00 
+  800080:	4c 8b 20             	mov    (%rax),%r12
+  800083:	45 8b bc 24 e0 00 00 	mov    0xe0(%r12),%r15d
+  80008a:	00 
+  80008b:	44 8b 75 cc          	mov    -0x34(%rbp),%r14d
+  80008f:	44 8b 2b             	mov    (%rbx),%r13d
+  800092:	48 b8 1e 11 80 00 00 	movabs $0x80111e,%rax
+  800099:	00 00 00 
+  80009c:	ff d0                	call   *%rax
+  80009e:	89 c6                	mov    %eax,%esi
+  8000a0:	45 89 f9             	mov    %r15d,%r9d
+  8000a3:	4d 89 e0             	mov    %r12,%r8
+  8000a6:	44 89 f1             	mov    %r14d,%ecx
+  8000a9:	44 89 ea             	mov    %r13d,%edx
+  8000ac:	48 bf 70 2f 80 00 00 	movabs $0x802f70,%rdi
+  8000b3:	00 00 00 
+  8000b6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000bb:	49 ba 09 03 80 00 00 	movabs $0x800309,%r10
+  8000c2:	00 00 00 
+  8000c5:	41 ff d2             	call   *%r10
+        if (val == 10) return;
+  8000c8:	8b 03                	mov    (%rbx),%eax
+  8000ca:	83 f8 0a             	cmp    $0xa,%eax
+  8000cd:	74 32                	je     800101 <umain+0xdc>
+        ++val;
+  8000cf:	83 c0 01             	add    $0x1,%eax
+  8000d2:	89 03                	mov    %eax,(%rbx)
+        ipc_send(who, 0, 0, 0, 0);
+  8000d4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8000da:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8000df:	ba 00 00 00 00       	mov    $0x0,%edx
+  8000e4:	be 00 00 00 00       	mov    $0x0,%esi
+  8000e9:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  8000ec:	48 b8 52 18 80 00 00 	movabs $0x801852,%rax
+  8000f3:	00 00 00 
+  8000f6:	ff d0                	call   *%rax
+        if (val == 10) return;
+  8000f8:	83 3b 0a             	cmpl   $0xa,(%rbx)
+  8000fb:	0f 85 56 ff ff ff    	jne    800057 <umain+0x32>
+    }
+}
+  800101:	48 83 c4 18          	add    $0x18,%rsp
+  800105:	5b                   	pop    %rbx
+  800106:	41 5c                	pop    %r12
+  800108:	41 5d                	pop    %r13
+  80010a:	41 5e                	pop    %r14
+  80010c:	41 5f                	pop    %r15
+  80010e:	5d                   	pop    %rbp
+  80010f:	c3                   	ret
+        cprintf("i am %08x; thisenv is %p\n", sys_getenvid(), thisenv);
+  800110:	48 b8 08 50 80 00 00 	movabs $0x805008,%rax
+  800117:	00 00 00 
+  80011a:	48 8b 18             	mov    (%rax),%rbx
+  80011d:	49 bc 1e 11 80 00 00 	movabs $0x80111e,%r12
+  800124:	00 00 00 
+  800127:	41 ff d4             	call   *%r12
+  80012a:	89 c6                	mov    %eax,%esi
+  80012c:	48 89 da             	mov    %rbx,%rdx
+  80012f:	48 bf 40 2f 80 00 00 	movabs $0x802f40,%rdi
+  800136:	00 00 00 
+  800139:	b8 00 00 00 00       	mov    $0x0,%eax
+  80013e:	48 bb 09 03 80 00 00 	movabs $0x800309,%rbx
+  800145:	00 00 00 
+  800148:	ff d3                	call   *%rbx
+        cprintf("send 0 from %x to %x\n", sys_getenvid(), who);
+  80014a:	44 8b 6d cc          	mov    -0x34(%rbp),%r13d
+  80014e:	41 ff d4             	call   *%r12
+  800151:	89 c6                	mov    %eax,%esi
+  800153:	44 89 ea             	mov    %r13d,%edx
+  800156:	48 bf 5a 2f 80 00 00 	movabs $0x802f5a,%rdi
+  80015d:	00 00 00 
+  800160:	b8 00 00 00 00       	mov    $0x0,%eax
+  800165:	ff d3                	call   *%rbx
+        ipc_send(who, 0, 0, 0, 0);
+  800167:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80016d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800172:	ba 00 00 00 00       	mov    $0x0,%edx
+  800177:	be 00 00 00 00       	mov    $0x0,%esi
+  80017c:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  80017f:	48 b8 52 18 80 00 00 	movabs $0x801852,%rax
+  800186:	00 00 00 
+  800189:	ff d0                	call   *%rax
+  80018b:	e9 bd fe ff ff       	jmp    80004d <umain+0x28>
+
+0000000000800190 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800190:	55                   	push   %rbp
+  800191:	48 89 e5             	mov    %rsp,%rbp
+  800194:	41 56                	push   %r14
+  800196:	41 55                	push   %r13
+  800198:	41 54                	push   %r12
+  80019a:	53                   	push   %rbx
+  80019b:	41 89 fd             	mov    %edi,%r13d
+  80019e:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  8001a1:	48 ba d8 40 80 00 00 	movabs $0x8040d8,%rdx
+  8001a8:	00 00 00 
+  8001ab:	48 b8 d8 40 80 00 00 	movabs $0x8040d8,%rax
+  8001b2:	00 00 00 
+  8001b5:	48 39 c2             	cmp    %rax,%rdx
+  8001b8:	73 17                	jae    8001d1 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  8001ba:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  8001bd:	49 89 c4             	mov    %rax,%r12
+  8001c0:	48 83 c3 08          	add    $0x8,%rbx
+  8001c4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001c9:	ff 53 f8             	call   *-0x8(%rbx)
+  8001cc:	4c 39 e3             	cmp    %r12,%rbx
+  8001cf:	72 ef                	jb     8001c0 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+    envid_t this_env_id = sys_getenvid();
+  8001d1:	48 b8 1e 11 80 00 00 	movabs $0x80111e,%rax
+  8001d8:	00 00 00 
+  8001db:	ff d0                	call   *%rax
+    thisenv = &((struct Env*)UENVS)[ENVX(this_env_id)];
+  8001dd:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8001e2:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+  8001e9:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8001f0:	00 00 00 
+  8001f3:	48 01 d0             	add    %rdx,%rax
+  8001f6:	48 a3 08 50 80 00 00 	movabs %rax,0x805008
+  8001fd:	00 00 00 
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  800200:	45 85 ed             	test   %r13d,%r13d
+  800203:	7e 0d                	jle    800212 <libmain+0x82>
+  800205:	49 8b 06             	mov    (%r14),%rax
+  800208:	48 a3 00 40 80 00 00 	movabs %rax,0x804000
+  80020f:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  800212:	4c 89 f6             	mov    %r14,%rsi
+  800215:	44 89 ef             	mov    %r13d,%edi
+  800218:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  80021f:	00 00 00 
+  800222:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  800224:	48 b8 39 02 80 00 00 	movabs $0x800239,%rax
+  80022b:	00 00 00 
+  80022e:	ff d0                	call   *%rax
+#endif
+}
+  800230:	5b                   	pop    %rbx
+  800231:	41 5c                	pop    %r12
+  800233:	41 5d                	pop    %r13
+  800235:	41 5e                	pop    %r14
+  800237:	5d                   	pop    %rbp
+  800238:	c3                   	ret
+
+0000000000800239 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  800239:	55                   	push   %rbp
+  80023a:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  80023d:	48 b8 9e 1b 80 00 00 	movabs $0x801b9e,%rax
+  800244:	00 00 00 
+  800247:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  800249:	bf 00 00 00 00       	mov    $0x0,%edi
+  80024e:	48 b8 b3 10 80 00 00 	movabs $0x8010b3,%rax
+  800255:	00 00 00 
+  800258:	ff d0                	call   *%rax
+}
+  80025a:	5d                   	pop    %rbp
+  80025b:	c3                   	ret
+
+000000000080025c <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  80025c:	55                   	push   %rbp
+  80025d:	48 89 e5             	mov    %rsp,%rbp
+  800260:	53                   	push   %rbx
+  800261:	48 83 ec 08          	sub    $0x8,%rsp
+  800265:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  800268:	8b 06                	mov    (%rsi),%eax
+  80026a:	8d 50 01             	lea    0x1(%rax),%edx
+  80026d:	89 16                	mov    %edx,(%rsi)
+  80026f:	48 98                	cltq
+  800271:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  800276:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  80027c:	74 0a                	je     800288 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  80027e:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  800282:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800286:	c9                   	leave
+  800287:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  800288:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  80028c:	be ff 00 00 00       	mov    $0xff,%esi
+  800291:	48 b8 55 10 80 00 00 	movabs $0x801055,%rax
+  800298:	00 00 00 
+  80029b:	ff d0                	call   *%rax
+        state->offset = 0;
+  80029d:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  8002a3:	eb d9                	jmp    80027e <putch+0x22>
+
+00000000008002a5 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  8002a5:	55                   	push   %rbp
+  8002a6:	48 89 e5             	mov    %rsp,%rbp
+  8002a9:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  8002b0:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  8002b3:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  8002ba:	b9 21 00 00 00       	mov    $0x21,%ecx
+  8002bf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002c4:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  8002c7:	48 89 f1             	mov    %rsi,%rcx
+  8002ca:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  8002d1:	48 bf 5c 02 80 00 00 	movabs $0x80025c,%rdi
+  8002d8:	00 00 00 
+  8002db:	48 b8 59 04 80 00 00 	movabs $0x800459,%rax
+  8002e2:	00 00 00 
+  8002e5:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  8002e7:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  8002ee:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  8002f5:	48 b8 55 10 80 00 00 	movabs $0x801055,%rax
+  8002fc:	00 00 00 
+  8002ff:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  800301:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  800307:	c9                   	leave
+  800308:	c3                   	ret
+
+0000000000800309 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  800309:	55                   	push   %rbp
+  80030a:	48 89 e5             	mov    %rsp,%rbp
+  80030d:	48 83 ec 50          	sub    $0x50,%rsp
+  800311:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  800315:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  800319:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80031d:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800321:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  800325:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  80032c:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800330:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800334:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800338:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  80033c:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  800340:	48 b8 a5 02 80 00 00 	movabs $0x8002a5,%rax
+  800347:	00 00 00 
+  80034a:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  80034c:	c9                   	leave
+  80034d:	c3                   	ret
+
+000000000080034e <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  80034e:	55                   	push   %rbp
+  80034f:	48 89 e5             	mov    %rsp,%rbp
+  800352:	41 57                	push   %r15
+  800354:	41 56                	push   %r14
+  800356:	41 55                	push   %r13
+  800358:	41 54                	push   %r12
+  80035a:	53                   	push   %rbx
+  80035b:	48 83 ec 18          	sub    $0x18,%rsp
+  80035f:	49 89 fc             	mov    %rdi,%r12
+  800362:	49 89 f5             	mov    %rsi,%r13
+  800365:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800369:	8b 45 10             	mov    0x10(%rbp),%eax
+  80036c:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  80036f:	41 89 cf             	mov    %ecx,%r15d
+  800372:	4c 39 fa             	cmp    %r15,%rdx
+  800375:	73 5b                	jae    8003d2 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  800377:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  80037b:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  80037f:	85 db                	test   %ebx,%ebx
+  800381:	7e 0e                	jle    800391 <print_num+0x43>
+            putch(padc, put_arg);
+  800383:	4c 89 ee             	mov    %r13,%rsi
+  800386:	44 89 f7             	mov    %r14d,%edi
+  800389:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  80038c:	83 eb 01             	sub    $0x1,%ebx
+  80038f:	75 f2                	jne    800383 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  800391:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  800395:	48 b9 b1 2f 80 00 00 	movabs $0x802fb1,%rcx
+  80039c:	00 00 00 
+  80039f:	48 b8 a0 2f 80 00 00 	movabs $0x802fa0,%rax
+  8003a6:	00 00 00 
+  8003a9:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  8003ad:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8003b1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8003b6:	49 f7 f7             	div    %r15
+  8003b9:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  8003bd:	4c 89 ee             	mov    %r13,%rsi
+  8003c0:	41 ff d4             	call   *%r12
+}
+  8003c3:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8003c7:	5b                   	pop    %rbx
+  8003c8:	41 5c                	pop    %r12
+  8003ca:	41 5d                	pop    %r13
+  8003cc:	41 5e                	pop    %r14
+  8003ce:	41 5f                	pop    %r15
+  8003d0:	5d                   	pop    %rbp
+  8003d1:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  8003d2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8003d6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8003db:	49 f7 f7             	div    %r15
+  8003de:	48 83 ec 08          	sub    $0x8,%rsp
+  8003e2:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  8003e6:	52                   	push   %rdx
+  8003e7:	45 0f be c9          	movsbl %r9b,%r9d
+  8003eb:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  8003ef:	48 89 c2             	mov    %rax,%rdx
+  8003f2:	48 b8 4e 03 80 00 00 	movabs $0x80034e,%rax
+  8003f9:	00 00 00 
+  8003fc:	ff d0                	call   *%rax
+  8003fe:	48 83 c4 10          	add    $0x10,%rsp
+  800402:	eb 8d                	jmp    800391 <print_num+0x43>
+
+0000000000800404 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  800404:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  800408:	48 8b 06             	mov    (%rsi),%rax
+  80040b:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  80040f:	73 0a                	jae    80041b <sprintputch+0x17>
+        *state->start++ = ch;
+  800411:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800415:	48 89 16             	mov    %rdx,(%rsi)
+  800418:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  80041b:	c3                   	ret
+
+000000000080041c <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  80041c:	55                   	push   %rbp
+  80041d:	48 89 e5             	mov    %rsp,%rbp
+  800420:	48 83 ec 50          	sub    $0x50,%rsp
+  800424:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800428:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80042c:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  800430:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800437:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80043b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80043f:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800443:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  800447:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80044b:	48 b8 59 04 80 00 00 	movabs $0x800459,%rax
+  800452:	00 00 00 
+  800455:	ff d0                	call   *%rax
+}
+  800457:	c9                   	leave
+  800458:	c3                   	ret
+
+0000000000800459 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  800459:	55                   	push   %rbp
+  80045a:	48 89 e5             	mov    %rsp,%rbp
+  80045d:	41 57                	push   %r15
+  80045f:	41 56                	push   %r14
+  800461:	41 55                	push   %r13
+  800463:	41 54                	push   %r12
+  800465:	53                   	push   %rbx
+  800466:	48 83 ec 38          	sub    $0x38,%rsp
+  80046a:	49 89 fe             	mov    %rdi,%r14
+  80046d:	49 89 f5             	mov    %rsi,%r13
+  800470:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  800473:	48 8b 01             	mov    (%rcx),%rax
+  800476:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  80047a:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  80047e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800482:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  800486:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  80048a:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  80048e:	0f b6 3b             	movzbl (%rbx),%edi
+  800491:	40 80 ff 25          	cmp    $0x25,%dil
+  800495:	74 18                	je     8004af <vprintfmt+0x56>
+            if (!ch) return;
+  800497:	40 84 ff             	test   %dil,%dil
+  80049a:	0f 84 b1 06 00 00    	je     800b51 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  8004a0:	40 0f b6 ff          	movzbl %dil,%edi
+  8004a4:	4c 89 ee             	mov    %r13,%rsi
+  8004a7:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  8004aa:	4c 89 e3             	mov    %r12,%rbx
+  8004ad:	eb db                	jmp    80048a <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  8004af:	be 00 00 00 00       	mov    $0x0,%esi
+  8004b4:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  8004b8:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  8004bd:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8004c3:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  8004ca:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8004ce:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  8004d3:	41 0f b6 04 24       	movzbl (%r12),%eax
+  8004d8:	88 45 a0             	mov    %al,-0x60(%rbp)
+  8004db:	83 e8 23             	sub    $0x23,%eax
+  8004de:	3c 57                	cmp    $0x57,%al
+  8004e0:	0f 87 51 06 00 00    	ja     800b37 <vprintfmt+0x6de>
+  8004e6:	0f b6 c0             	movzbl %al,%eax
+  8004e9:	48 b9 60 31 80 00 00 	movabs $0x803160,%rcx
+  8004f0:	00 00 00 
+  8004f3:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  8004f6:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  8004f9:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  8004fd:	eb cf                	jmp    8004ce <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  8004ff:	49 89 dc             	mov    %rbx,%r12
+  800502:	be 01 00 00 00       	mov    $0x1,%esi
+  800507:	eb c5                	jmp    8004ce <vprintfmt+0x75>
+            padc = ch;
+  800509:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  80050d:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800510:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800513:	eb b9                	jmp    8004ce <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800515:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800518:	83 f8 2f             	cmp    $0x2f,%eax
+  80051b:	77 24                	ja     800541 <vprintfmt+0xe8>
+  80051d:	89 c1                	mov    %eax,%ecx
+  80051f:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  800523:	83 c0 08             	add    $0x8,%eax
+  800526:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800529:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  80052c:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  80052f:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800533:	79 99                	jns    8004ce <vprintfmt+0x75>
+                width = precision;
+  800535:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  800539:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  80053f:	eb 8d                	jmp    8004ce <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800541:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  800545:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  800549:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80054d:	eb da                	jmp    800529 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  80054f:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  800554:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800558:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  80055e:	3c 39                	cmp    $0x39,%al
+  800560:	77 1c                	ja     80057e <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  800562:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  800566:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  80056a:	0f b6 c0             	movzbl %al,%eax
+  80056d:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800572:	0f b6 03             	movzbl (%rbx),%eax
+  800575:	3c 39                	cmp    $0x39,%al
+  800577:	76 e9                	jbe    800562 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  800579:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  80057c:	eb b1                	jmp    80052f <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  80057e:	49 89 dc             	mov    %rbx,%r12
+  800581:	eb ac                	jmp    80052f <vprintfmt+0xd6>
+            width = MAX(0, width);
+  800583:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  800586:	85 c9                	test   %ecx,%ecx
+  800588:	b8 00 00 00 00       	mov    $0x0,%eax
+  80058d:	0f 49 c1             	cmovns %ecx,%eax
+  800590:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  800593:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800596:	e9 33 ff ff ff       	jmp    8004ce <vprintfmt+0x75>
+            lflag++;
+  80059b:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  80059e:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8005a1:	e9 28 ff ff ff       	jmp    8004ce <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  8005a6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8005a9:	83 f8 2f             	cmp    $0x2f,%eax
+  8005ac:	77 19                	ja     8005c7 <vprintfmt+0x16e>
+  8005ae:	89 c2                	mov    %eax,%edx
+  8005b0:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8005b4:	83 c0 08             	add    $0x8,%eax
+  8005b7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8005ba:	8b 3a                	mov    (%rdx),%edi
+  8005bc:	4c 89 ee             	mov    %r13,%rsi
+  8005bf:	41 ff d6             	call   *%r14
+            break;
+  8005c2:	e9 c3 fe ff ff       	jmp    80048a <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  8005c7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8005cb:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8005cf:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8005d3:	eb e5                	jmp    8005ba <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  8005d5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8005d8:	83 f8 2f             	cmp    $0x2f,%eax
+  8005db:	77 5a                	ja     800637 <vprintfmt+0x1de>
+  8005dd:	89 c2                	mov    %eax,%edx
+  8005df:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8005e3:	83 c0 08             	add    $0x8,%eax
+  8005e6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  8005e9:	8b 02                	mov    (%rdx),%eax
+  8005eb:	89 c1                	mov    %eax,%ecx
+  8005ed:	f7 d9                	neg    %ecx
+  8005ef:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  8005f2:	83 f9 15             	cmp    $0x15,%ecx
+  8005f5:	7f 4e                	jg     800645 <vprintfmt+0x1ec>
+  8005f7:	48 63 c1             	movslq %ecx,%rax
+  8005fa:	48 ba 20 34 80 00 00 	movabs $0x803420,%rdx
+  800601:	00 00 00 
+  800604:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  800608:	48 85 c0             	test   %rax,%rax
+  80060b:	74 38                	je     800645 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  80060d:	48 89 c1             	mov    %rax,%rcx
+  800610:	48 ba 39 36 80 00 00 	movabs $0x803639,%rdx
+  800617:	00 00 00 
+  80061a:	4c 89 ee             	mov    %r13,%rsi
+  80061d:	4c 89 f7             	mov    %r14,%rdi
+  800620:	b8 00 00 00 00       	mov    $0x0,%eax
+  800625:	49 b8 1c 04 80 00 00 	movabs $0x80041c,%r8
+  80062c:	00 00 00 
+  80062f:	41 ff d0             	call   *%r8
+  800632:	e9 53 fe ff ff       	jmp    80048a <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  800637:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80063b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80063f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800643:	eb a4                	jmp    8005e9 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  800645:	48 ba c9 2f 80 00 00 	movabs $0x802fc9,%rdx
+  80064c:	00 00 00 
+  80064f:	4c 89 ee             	mov    %r13,%rsi
+  800652:	4c 89 f7             	mov    %r14,%rdi
+  800655:	b8 00 00 00 00       	mov    $0x0,%eax
+  80065a:	49 b8 1c 04 80 00 00 	movabs $0x80041c,%r8
+  800661:	00 00 00 
+  800664:	41 ff d0             	call   *%r8
+  800667:	e9 1e fe ff ff       	jmp    80048a <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  80066c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80066f:	83 f8 2f             	cmp    $0x2f,%eax
+  800672:	77 6c                	ja     8006e0 <vprintfmt+0x287>
+  800674:	89 c2                	mov    %eax,%edx
+  800676:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80067a:	83 c0 08             	add    $0x8,%eax
+  80067d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800680:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  800683:	48 85 d2             	test   %rdx,%rdx
+  800686:	48 b8 c2 2f 80 00 00 	movabs $0x802fc2,%rax
+  80068d:	00 00 00 
+  800690:	48 0f 45 c2          	cmovne %rdx,%rax
+  800694:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  800698:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  80069c:	7e 06                	jle    8006a4 <vprintfmt+0x24b>
+  80069e:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  8006a2:	75 4a                	jne    8006ee <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8006a4:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8006a8:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8006ac:	0f b6 00             	movzbl (%rax),%eax
+  8006af:	84 c0                	test   %al,%al
+  8006b1:	0f 85 9a 00 00 00    	jne    800751 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  8006b7:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8006ba:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  8006be:	85 c0                	test   %eax,%eax
+  8006c0:	0f 8e c4 fd ff ff    	jle    80048a <vprintfmt+0x31>
+  8006c6:	4c 89 ee             	mov    %r13,%rsi
+  8006c9:	bf 20 00 00 00       	mov    $0x20,%edi
+  8006ce:	41 ff d6             	call   *%r14
+  8006d1:	41 83 ec 01          	sub    $0x1,%r12d
+  8006d5:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  8006d9:	75 eb                	jne    8006c6 <vprintfmt+0x26d>
+  8006db:	e9 aa fd ff ff       	jmp    80048a <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8006e0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8006e4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006e8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006ec:	eb 92                	jmp    800680 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  8006ee:	49 63 f7             	movslq %r15d,%rsi
+  8006f1:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  8006f5:	48 b8 0b 0c 80 00 00 	movabs $0x800c0b,%rax
+  8006fc:	00 00 00 
+  8006ff:	ff d0                	call   *%rax
+  800701:	48 89 c2             	mov    %rax,%rdx
+  800704:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800707:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  800709:	8d 70 ff             	lea    -0x1(%rax),%esi
+  80070c:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  80070f:	85 c0                	test   %eax,%eax
+  800711:	7e 91                	jle    8006a4 <vprintfmt+0x24b>
+  800713:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  800718:	4c 89 ee             	mov    %r13,%rsi
+  80071b:	44 89 e7             	mov    %r12d,%edi
+  80071e:	41 ff d6             	call   *%r14
+  800721:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800725:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800728:	83 f8 ff             	cmp    $0xffffffff,%eax
+  80072b:	75 eb                	jne    800718 <vprintfmt+0x2bf>
+  80072d:	e9 72 ff ff ff       	jmp    8006a4 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800732:	0f b6 f8             	movzbl %al,%edi
+  800735:	4c 89 ee             	mov    %r13,%rsi
+  800738:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  80073b:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  80073f:	49 83 c4 01          	add    $0x1,%r12
+  800743:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  800749:	84 c0                	test   %al,%al
+  80074b:	0f 84 66 ff ff ff    	je     8006b7 <vprintfmt+0x25e>
+  800751:	45 85 ff             	test   %r15d,%r15d
+  800754:	78 0a                	js     800760 <vprintfmt+0x307>
+  800756:	41 83 ef 01          	sub    $0x1,%r15d
+  80075a:	0f 88 57 ff ff ff    	js     8006b7 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800760:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  800764:	74 cc                	je     800732 <vprintfmt+0x2d9>
+  800766:	8d 50 e0             	lea    -0x20(%rax),%edx
+  800769:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  80076e:	80 fa 5e             	cmp    $0x5e,%dl
+  800771:	77 c2                	ja     800735 <vprintfmt+0x2dc>
+  800773:	eb bd                	jmp    800732 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  800775:	40 84 f6             	test   %sil,%sil
+  800778:	75 26                	jne    8007a0 <vprintfmt+0x347>
+    switch (lflag) {
+  80077a:	85 d2                	test   %edx,%edx
+  80077c:	74 59                	je     8007d7 <vprintfmt+0x37e>
+  80077e:	83 fa 01             	cmp    $0x1,%edx
+  800781:	74 7b                	je     8007fe <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  800783:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800786:	83 f8 2f             	cmp    $0x2f,%eax
+  800789:	0f 87 96 00 00 00    	ja     800825 <vprintfmt+0x3cc>
+  80078f:	89 c2                	mov    %eax,%edx
+  800791:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800795:	83 c0 08             	add    $0x8,%eax
+  800798:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80079b:	4c 8b 22             	mov    (%rdx),%r12
+  80079e:	eb 17                	jmp    8007b7 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  8007a0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007a3:	83 f8 2f             	cmp    $0x2f,%eax
+  8007a6:	77 21                	ja     8007c9 <vprintfmt+0x370>
+  8007a8:	89 c2                	mov    %eax,%edx
+  8007aa:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007ae:	83 c0 08             	add    $0x8,%eax
+  8007b1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007b4:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  8007b7:	4d 85 e4             	test   %r12,%r12
+  8007ba:	78 7a                	js     800836 <vprintfmt+0x3dd>
+            num = i;
+  8007bc:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  8007bf:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  8007c4:	e9 50 02 00 00       	jmp    800a19 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8007c9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007cd:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007d1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007d5:	eb dd                	jmp    8007b4 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  8007d7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007da:	83 f8 2f             	cmp    $0x2f,%eax
+  8007dd:	77 11                	ja     8007f0 <vprintfmt+0x397>
+  8007df:	89 c2                	mov    %eax,%edx
+  8007e1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007e5:	83 c0 08             	add    $0x8,%eax
+  8007e8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007eb:	4c 63 22             	movslq (%rdx),%r12
+  8007ee:	eb c7                	jmp    8007b7 <vprintfmt+0x35e>
+  8007f0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007f4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007f8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007fc:	eb ed                	jmp    8007eb <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  8007fe:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800801:	83 f8 2f             	cmp    $0x2f,%eax
+  800804:	77 11                	ja     800817 <vprintfmt+0x3be>
+  800806:	89 c2                	mov    %eax,%edx
+  800808:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80080c:	83 c0 08             	add    $0x8,%eax
+  80080f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800812:	4c 8b 22             	mov    (%rdx),%r12
+  800815:	eb a0                	jmp    8007b7 <vprintfmt+0x35e>
+  800817:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80081b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80081f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800823:	eb ed                	jmp    800812 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  800825:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800829:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80082d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800831:	e9 65 ff ff ff       	jmp    80079b <vprintfmt+0x342>
+                putch('-', put_arg);
+  800836:	4c 89 ee             	mov    %r13,%rsi
+  800839:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  80083e:	41 ff d6             	call   *%r14
+                i = -i;
+  800841:	49 f7 dc             	neg    %r12
+  800844:	e9 73 ff ff ff       	jmp    8007bc <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  800849:	40 84 f6             	test   %sil,%sil
+  80084c:	75 32                	jne    800880 <vprintfmt+0x427>
+    switch (lflag) {
+  80084e:	85 d2                	test   %edx,%edx
+  800850:	74 5d                	je     8008af <vprintfmt+0x456>
+  800852:	83 fa 01             	cmp    $0x1,%edx
+  800855:	0f 84 82 00 00 00    	je     8008dd <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  80085b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80085e:	83 f8 2f             	cmp    $0x2f,%eax
+  800861:	0f 87 a5 00 00 00    	ja     80090c <vprintfmt+0x4b3>
+  800867:	89 c2                	mov    %eax,%edx
+  800869:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80086d:	83 c0 08             	add    $0x8,%eax
+  800870:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800873:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800876:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  80087b:	e9 99 01 00 00       	jmp    800a19 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800880:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800883:	83 f8 2f             	cmp    $0x2f,%eax
+  800886:	77 19                	ja     8008a1 <vprintfmt+0x448>
+  800888:	89 c2                	mov    %eax,%edx
+  80088a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80088e:	83 c0 08             	add    $0x8,%eax
+  800891:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800894:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800897:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  80089c:	e9 78 01 00 00       	jmp    800a19 <vprintfmt+0x5c0>
+  8008a1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008a5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008a9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008ad:	eb e5                	jmp    800894 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  8008af:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008b2:	83 f8 2f             	cmp    $0x2f,%eax
+  8008b5:	77 18                	ja     8008cf <vprintfmt+0x476>
+  8008b7:	89 c2                	mov    %eax,%edx
+  8008b9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008bd:	83 c0 08             	add    $0x8,%eax
+  8008c0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008c3:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  8008c5:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  8008ca:	e9 4a 01 00 00       	jmp    800a19 <vprintfmt+0x5c0>
+  8008cf:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008d3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008d7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008db:	eb e6                	jmp    8008c3 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  8008dd:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008e0:	83 f8 2f             	cmp    $0x2f,%eax
+  8008e3:	77 19                	ja     8008fe <vprintfmt+0x4a5>
+  8008e5:	89 c2                	mov    %eax,%edx
+  8008e7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008eb:	83 c0 08             	add    $0x8,%eax
+  8008ee:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008f1:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8008f4:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  8008f9:	e9 1b 01 00 00       	jmp    800a19 <vprintfmt+0x5c0>
+  8008fe:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800902:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800906:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80090a:	eb e5                	jmp    8008f1 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  80090c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800910:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800914:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800918:	e9 56 ff ff ff       	jmp    800873 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  80091d:	40 84 f6             	test   %sil,%sil
+  800920:	75 2e                	jne    800950 <vprintfmt+0x4f7>
+    switch (lflag) {
+  800922:	85 d2                	test   %edx,%edx
+  800924:	74 59                	je     80097f <vprintfmt+0x526>
+  800926:	83 fa 01             	cmp    $0x1,%edx
+  800929:	74 7f                	je     8009aa <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  80092b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80092e:	83 f8 2f             	cmp    $0x2f,%eax
+  800931:	0f 87 9f 00 00 00    	ja     8009d6 <vprintfmt+0x57d>
+  800937:	89 c2                	mov    %eax,%edx
+  800939:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80093d:	83 c0 08             	add    $0x8,%eax
+  800940:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800943:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800946:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  80094b:	e9 c9 00 00 00       	jmp    800a19 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800950:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800953:	83 f8 2f             	cmp    $0x2f,%eax
+  800956:	77 19                	ja     800971 <vprintfmt+0x518>
+  800958:	89 c2                	mov    %eax,%edx
+  80095a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80095e:	83 c0 08             	add    $0x8,%eax
+  800961:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800964:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800967:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  80096c:	e9 a8 00 00 00       	jmp    800a19 <vprintfmt+0x5c0>
+  800971:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800975:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800979:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80097d:	eb e5                	jmp    800964 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  80097f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800982:	83 f8 2f             	cmp    $0x2f,%eax
+  800985:	77 15                	ja     80099c <vprintfmt+0x543>
+  800987:	89 c2                	mov    %eax,%edx
+  800989:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80098d:	83 c0 08             	add    $0x8,%eax
+  800990:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800993:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  800995:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  80099a:	eb 7d                	jmp    800a19 <vprintfmt+0x5c0>
+  80099c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009a0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009a4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009a8:	eb e9                	jmp    800993 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  8009aa:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009ad:	83 f8 2f             	cmp    $0x2f,%eax
+  8009b0:	77 16                	ja     8009c8 <vprintfmt+0x56f>
+  8009b2:	89 c2                	mov    %eax,%edx
+  8009b4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009b8:	83 c0 08             	add    $0x8,%eax
+  8009bb:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009be:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8009c1:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  8009c6:	eb 51                	jmp    800a19 <vprintfmt+0x5c0>
+  8009c8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009cc:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009d0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009d4:	eb e8                	jmp    8009be <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  8009d6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009da:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009de:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009e2:	e9 5c ff ff ff       	jmp    800943 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  8009e7:	4c 89 ee             	mov    %r13,%rsi
+  8009ea:	bf 30 00 00 00       	mov    $0x30,%edi
+  8009ef:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  8009f2:	4c 89 ee             	mov    %r13,%rsi
+  8009f5:	bf 78 00 00 00       	mov    $0x78,%edi
+  8009fa:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  8009fd:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a00:	83 f8 2f             	cmp    $0x2f,%eax
+  800a03:	77 47                	ja     800a4c <vprintfmt+0x5f3>
+  800a05:	89 c2                	mov    %eax,%edx
+  800a07:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a0b:	83 c0 08             	add    $0x8,%eax
+  800a0e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a11:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800a14:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800a19:	48 83 ec 08          	sub    $0x8,%rsp
+  800a1d:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800a21:	0f 94 c0             	sete   %al
+  800a24:	0f b6 c0             	movzbl %al,%eax
+  800a27:	50                   	push   %rax
+  800a28:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800a2d:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800a31:	4c 89 ee             	mov    %r13,%rsi
+  800a34:	4c 89 f7             	mov    %r14,%rdi
+  800a37:	48 b8 4e 03 80 00 00 	movabs $0x80034e,%rax
+  800a3e:	00 00 00 
+  800a41:	ff d0                	call   *%rax
+            break;
+  800a43:	48 83 c4 10          	add    $0x10,%rsp
+  800a47:	e9 3e fa ff ff       	jmp    80048a <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800a4c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a50:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a54:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a58:	eb b7                	jmp    800a11 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  800a5a:	40 84 f6             	test   %sil,%sil
+  800a5d:	75 2b                	jne    800a8a <vprintfmt+0x631>
+    switch (lflag) {
+  800a5f:	85 d2                	test   %edx,%edx
+  800a61:	74 56                	je     800ab9 <vprintfmt+0x660>
+  800a63:	83 fa 01             	cmp    $0x1,%edx
+  800a66:	74 7f                	je     800ae7 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800a68:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a6b:	83 f8 2f             	cmp    $0x2f,%eax
+  800a6e:	0f 87 a2 00 00 00    	ja     800b16 <vprintfmt+0x6bd>
+  800a74:	89 c2                	mov    %eax,%edx
+  800a76:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a7a:	83 c0 08             	add    $0x8,%eax
+  800a7d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a80:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800a83:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800a88:	eb 8f                	jmp    800a19 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800a8a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a8d:	83 f8 2f             	cmp    $0x2f,%eax
+  800a90:	77 19                	ja     800aab <vprintfmt+0x652>
+  800a92:	89 c2                	mov    %eax,%edx
+  800a94:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a98:	83 c0 08             	add    $0x8,%eax
+  800a9b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a9e:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800aa1:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800aa6:	e9 6e ff ff ff       	jmp    800a19 <vprintfmt+0x5c0>
+  800aab:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800aaf:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ab3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ab7:	eb e5                	jmp    800a9e <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800ab9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800abc:	83 f8 2f             	cmp    $0x2f,%eax
+  800abf:	77 18                	ja     800ad9 <vprintfmt+0x680>
+  800ac1:	89 c2                	mov    %eax,%edx
+  800ac3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ac7:	83 c0 08             	add    $0x8,%eax
+  800aca:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800acd:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800acf:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800ad4:	e9 40 ff ff ff       	jmp    800a19 <vprintfmt+0x5c0>
+  800ad9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800add:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ae1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ae5:	eb e6                	jmp    800acd <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800ae7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800aea:	83 f8 2f             	cmp    $0x2f,%eax
+  800aed:	77 19                	ja     800b08 <vprintfmt+0x6af>
+  800aef:	89 c2                	mov    %eax,%edx
+  800af1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800af5:	83 c0 08             	add    $0x8,%eax
+  800af8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800afb:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800afe:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800b03:	e9 11 ff ff ff       	jmp    800a19 <vprintfmt+0x5c0>
+  800b08:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b0c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b10:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b14:	eb e5                	jmp    800afb <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800b16:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b1a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b1e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b22:	e9 59 ff ff ff       	jmp    800a80 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800b27:	4c 89 ee             	mov    %r13,%rsi
+  800b2a:	bf 25 00 00 00       	mov    $0x25,%edi
+  800b2f:	41 ff d6             	call   *%r14
+            break;
+  800b32:	e9 53 f9 ff ff       	jmp    80048a <vprintfmt+0x31>
+            putch('%', put_arg);
+  800b37:	4c 89 ee             	mov    %r13,%rsi
+  800b3a:	bf 25 00 00 00       	mov    $0x25,%edi
+  800b3f:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800b42:	48 83 eb 01          	sub    $0x1,%rbx
+  800b46:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800b4a:	75 f6                	jne    800b42 <vprintfmt+0x6e9>
+  800b4c:	e9 39 f9 ff ff       	jmp    80048a <vprintfmt+0x31>
+}
+  800b51:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800b55:	5b                   	pop    %rbx
+  800b56:	41 5c                	pop    %r12
+  800b58:	41 5d                	pop    %r13
+  800b5a:	41 5e                	pop    %r14
+  800b5c:	41 5f                	pop    %r15
+  800b5e:	5d                   	pop    %rbp
+  800b5f:	c3                   	ret
+
+0000000000800b60 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800b60:	55                   	push   %rbp
+  800b61:	48 89 e5             	mov    %rsp,%rbp
+  800b64:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800b68:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800b6c:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800b71:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800b75:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800b7c:	48 85 ff             	test   %rdi,%rdi
+  800b7f:	74 2b                	je     800bac <vsnprintf+0x4c>
+  800b81:	48 85 f6             	test   %rsi,%rsi
+  800b84:	74 26                	je     800bac <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800b86:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800b8a:	48 bf 04 04 80 00 00 	movabs $0x800404,%rdi
+  800b91:	00 00 00 
+  800b94:	48 b8 59 04 80 00 00 	movabs $0x800459,%rax
+  800b9b:	00 00 00 
+  800b9e:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800ba0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800ba4:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800ba7:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800baa:	c9                   	leave
+  800bab:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800bac:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800bb1:	eb f7                	jmp    800baa <vsnprintf+0x4a>
+
+0000000000800bb3 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800bb3:	55                   	push   %rbp
+  800bb4:	48 89 e5             	mov    %rsp,%rbp
+  800bb7:	48 83 ec 50          	sub    $0x50,%rsp
+  800bbb:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800bbf:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800bc3:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800bc7:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800bce:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800bd2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bd6:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800bda:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800bde:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800be2:	48 b8 60 0b 80 00 00 	movabs $0x800b60,%rax
+  800be9:	00 00 00 
+  800bec:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800bee:	c9                   	leave
+  800bef:	c3                   	ret
+
+0000000000800bf0 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800bf0:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800bf3:	74 10                	je     800c05 <strlen+0x15>
+    size_t n = 0;
+  800bf5:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800bfa:	48 83 c0 01          	add    $0x1,%rax
+  800bfe:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800c02:	75 f6                	jne    800bfa <strlen+0xa>
+  800c04:	c3                   	ret
+    size_t n = 0;
+  800c05:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800c0a:	c3                   	ret
+
+0000000000800c0b <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800c0b:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800c0e:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800c13:	48 85 f6             	test   %rsi,%rsi
+  800c16:	74 11                	je     800c29 <strnlen+0x1e>
+  800c18:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800c1c:	74 0c                	je     800c2a <strnlen+0x1f>
+  800c1e:	48 83 c2 01          	add    $0x1,%rdx
+  800c22:	48 39 d0             	cmp    %rdx,%rax
+  800c25:	75 f1                	jne    800c18 <strnlen+0xd>
+  800c27:	eb 04                	jmp    800c2d <strnlen+0x22>
+  800c29:	c3                   	ret
+  800c2a:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800c2d:	c3                   	ret
+
+0000000000800c2e <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800c2e:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800c31:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c36:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800c3a:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800c3d:	48 83 c2 01          	add    $0x1,%rdx
+  800c41:	84 c9                	test   %cl,%cl
+  800c43:	75 f1                	jne    800c36 <strcpy+0x8>
+        ;
+    return res;
+}
+  800c45:	c3                   	ret
+
+0000000000800c46 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800c46:	55                   	push   %rbp
+  800c47:	48 89 e5             	mov    %rsp,%rbp
+  800c4a:	41 54                	push   %r12
+  800c4c:	53                   	push   %rbx
+  800c4d:	48 89 fb             	mov    %rdi,%rbx
+  800c50:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800c53:	48 b8 f0 0b 80 00 00 	movabs $0x800bf0,%rax
+  800c5a:	00 00 00 
+  800c5d:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800c5f:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800c63:	4c 89 e6             	mov    %r12,%rsi
+  800c66:	48 b8 2e 0c 80 00 00 	movabs $0x800c2e,%rax
+  800c6d:	00 00 00 
+  800c70:	ff d0                	call   *%rax
+    return dst;
+}
+  800c72:	48 89 d8             	mov    %rbx,%rax
+  800c75:	5b                   	pop    %rbx
+  800c76:	41 5c                	pop    %r12
+  800c78:	5d                   	pop    %rbp
+  800c79:	c3                   	ret
+
+0000000000800c7a <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800c7a:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800c7d:	48 85 d2             	test   %rdx,%rdx
+  800c80:	74 1f                	je     800ca1 <strncpy+0x27>
+  800c82:	48 01 fa             	add    %rdi,%rdx
+  800c85:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800c88:	48 83 c1 01          	add    $0x1,%rcx
+  800c8c:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800c90:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800c94:	41 80 f8 01          	cmp    $0x1,%r8b
+  800c98:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800c9c:	48 39 ca             	cmp    %rcx,%rdx
+  800c9f:	75 e7                	jne    800c88 <strncpy+0xe>
+    }
+    return ret;
+}
+  800ca1:	c3                   	ret
+
+0000000000800ca2 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800ca2:	48 89 f8             	mov    %rdi,%rax
+  800ca5:	48 85 d2             	test   %rdx,%rdx
+  800ca8:	74 24                	je     800cce <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800caa:	48 83 ea 01          	sub    $0x1,%rdx
+  800cae:	74 1b                	je     800ccb <strlcpy+0x29>
+  800cb0:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800cb4:	0f b6 16             	movzbl (%rsi),%edx
+  800cb7:	84 d2                	test   %dl,%dl
+  800cb9:	74 10                	je     800ccb <strlcpy+0x29>
+            *dst++ = *src++;
+  800cbb:	48 83 c6 01          	add    $0x1,%rsi
+  800cbf:	48 83 c0 01          	add    $0x1,%rax
+  800cc3:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800cc6:	48 39 c8             	cmp    %rcx,%rax
+  800cc9:	75 e9                	jne    800cb4 <strlcpy+0x12>
+        *dst = '\0';
+  800ccb:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800cce:	48 29 f8             	sub    %rdi,%rax
+}
+  800cd1:	c3                   	ret
+
+0000000000800cd2 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800cd2:	0f b6 07             	movzbl (%rdi),%eax
+  800cd5:	84 c0                	test   %al,%al
+  800cd7:	74 13                	je     800cec <strcmp+0x1a>
+  800cd9:	38 06                	cmp    %al,(%rsi)
+  800cdb:	75 0f                	jne    800cec <strcmp+0x1a>
+  800cdd:	48 83 c7 01          	add    $0x1,%rdi
+  800ce1:	48 83 c6 01          	add    $0x1,%rsi
+  800ce5:	0f b6 07             	movzbl (%rdi),%eax
+  800ce8:	84 c0                	test   %al,%al
+  800cea:	75 ed                	jne    800cd9 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800cec:	0f b6 c0             	movzbl %al,%eax
+  800cef:	0f b6 16             	movzbl (%rsi),%edx
+  800cf2:	29 d0                	sub    %edx,%eax
+}
+  800cf4:	c3                   	ret
+
+0000000000800cf5 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800cf5:	48 85 d2             	test   %rdx,%rdx
+  800cf8:	74 1f                	je     800d19 <strncmp+0x24>
+  800cfa:	0f b6 07             	movzbl (%rdi),%eax
+  800cfd:	84 c0                	test   %al,%al
+  800cff:	74 1e                	je     800d1f <strncmp+0x2a>
+  800d01:	3a 06                	cmp    (%rsi),%al
+  800d03:	75 1a                	jne    800d1f <strncmp+0x2a>
+  800d05:	48 83 c7 01          	add    $0x1,%rdi
+  800d09:	48 83 c6 01          	add    $0x1,%rsi
+  800d0d:	48 83 ea 01          	sub    $0x1,%rdx
+  800d11:	75 e7                	jne    800cfa <strncmp+0x5>
+
+    if (!n) return 0;
+  800d13:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d18:	c3                   	ret
+  800d19:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d1e:	c3                   	ret
+  800d1f:	48 85 d2             	test   %rdx,%rdx
+  800d22:	74 09                	je     800d2d <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800d24:	0f b6 07             	movzbl (%rdi),%eax
+  800d27:	0f b6 16             	movzbl (%rsi),%edx
+  800d2a:	29 d0                	sub    %edx,%eax
+  800d2c:	c3                   	ret
+    if (!n) return 0;
+  800d2d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800d32:	c3                   	ret
+
+0000000000800d33 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800d33:	0f b6 17             	movzbl (%rdi),%edx
+  800d36:	84 d2                	test   %dl,%dl
+  800d38:	74 18                	je     800d52 <strchr+0x1f>
+        if (*str == c) {
+  800d3a:	0f be d2             	movsbl %dl,%edx
+  800d3d:	39 f2                	cmp    %esi,%edx
+  800d3f:	74 17                	je     800d58 <strchr+0x25>
+    for (; *str; str++) {
+  800d41:	48 83 c7 01          	add    $0x1,%rdi
+  800d45:	0f b6 17             	movzbl (%rdi),%edx
+  800d48:	84 d2                	test   %dl,%dl
+  800d4a:	75 ee                	jne    800d3a <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800d4c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d51:	c3                   	ret
+  800d52:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d57:	c3                   	ret
+  800d58:	48 89 f8             	mov    %rdi,%rax
+}
+  800d5b:	c3                   	ret
+
+0000000000800d5c <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800d5c:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800d5f:	0f b6 17             	movzbl (%rdi),%edx
+  800d62:	84 d2                	test   %dl,%dl
+  800d64:	74 13                	je     800d79 <strfind+0x1d>
+  800d66:	0f be d2             	movsbl %dl,%edx
+  800d69:	39 f2                	cmp    %esi,%edx
+  800d6b:	74 0b                	je     800d78 <strfind+0x1c>
+  800d6d:	48 83 c0 01          	add    $0x1,%rax
+  800d71:	0f b6 10             	movzbl (%rax),%edx
+  800d74:	84 d2                	test   %dl,%dl
+  800d76:	75 ee                	jne    800d66 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800d78:	c3                   	ret
+  800d79:	c3                   	ret
+
+0000000000800d7a <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800d7a:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800d7d:	48 89 f8             	mov    %rdi,%rax
+  800d80:	48 f7 d8             	neg    %rax
+  800d83:	83 e0 07             	and    $0x7,%eax
+  800d86:	49 89 d1             	mov    %rdx,%r9
+  800d89:	49 29 c1             	sub    %rax,%r9
+  800d8c:	78 36                	js     800dc4 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800d8e:	40 0f b6 c6          	movzbl %sil,%eax
+  800d92:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800d99:	01 01 01 
+  800d9c:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800da0:	40 f6 c7 07          	test   $0x7,%dil
+  800da4:	75 38                	jne    800dde <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800da6:	4c 89 c9             	mov    %r9,%rcx
+  800da9:	48 c1 f9 03          	sar    $0x3,%rcx
+  800dad:	74 0c                	je     800dbb <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800daf:	fc                   	cld
+  800db0:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800db3:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800db7:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800dbb:	4d 85 c9             	test   %r9,%r9
+  800dbe:	75 45                	jne    800e05 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800dc0:	4c 89 c0             	mov    %r8,%rax
+  800dc3:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800dc4:	48 85 d2             	test   %rdx,%rdx
+  800dc7:	74 f7                	je     800dc0 <memset+0x46>
+  800dc9:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800dcc:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800dcf:	48 83 c0 01          	add    $0x1,%rax
+  800dd3:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  800dd7:	48 39 c2             	cmp    %rax,%rdx
+  800dda:	75 f3                	jne    800dcf <memset+0x55>
+  800ddc:	eb e2                	jmp    800dc0 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  800dde:	40 f6 c7 01          	test   $0x1,%dil
+  800de2:	74 06                	je     800dea <memset+0x70>
+  800de4:	88 07                	mov    %al,(%rdi)
+  800de6:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800dea:	40 f6 c7 02          	test   $0x2,%dil
+  800dee:	74 07                	je     800df7 <memset+0x7d>
+  800df0:	66 89 07             	mov    %ax,(%rdi)
+  800df3:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800df7:	40 f6 c7 04          	test   $0x4,%dil
+  800dfb:	74 a9                	je     800da6 <memset+0x2c>
+  800dfd:	89 07                	mov    %eax,(%rdi)
+  800dff:	48 83 c7 04          	add    $0x4,%rdi
+  800e03:	eb a1                	jmp    800da6 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800e05:	41 f6 c1 04          	test   $0x4,%r9b
+  800e09:	74 06                	je     800e11 <memset+0x97>
+  800e0b:	89 07                	mov    %eax,(%rdi)
+  800e0d:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800e11:	41 f6 c1 02          	test   $0x2,%r9b
+  800e15:	74 07                	je     800e1e <memset+0xa4>
+  800e17:	66 89 07             	mov    %ax,(%rdi)
+  800e1a:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  800e1e:	41 f6 c1 01          	test   $0x1,%r9b
+  800e22:	74 9c                	je     800dc0 <memset+0x46>
+  800e24:	88 07                	mov    %al,(%rdi)
+  800e26:	eb 98                	jmp    800dc0 <memset+0x46>
+
+0000000000800e28 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  800e28:	48 89 f8             	mov    %rdi,%rax
+  800e2b:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  800e2e:	48 39 fe             	cmp    %rdi,%rsi
+  800e31:	73 3b                	jae    800e6e <memmove+0x46>
+  800e33:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  800e37:	48 39 d7             	cmp    %rdx,%rdi
+  800e3a:	73 32                	jae    800e6e <memmove+0x46>
+        s += n;
+        d += n;
+  800e3c:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800e40:	48 89 d6             	mov    %rdx,%rsi
+  800e43:	48 09 fe             	or     %rdi,%rsi
+  800e46:	48 09 ce             	or     %rcx,%rsi
+  800e49:	40 f6 c6 07          	test   $0x7,%sil
+  800e4d:	75 12                	jne    800e61 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  800e4f:	48 83 ef 08          	sub    $0x8,%rdi
+  800e53:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  800e57:	48 c1 e9 03          	shr    $0x3,%rcx
+  800e5b:	fd                   	std
+  800e5c:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  800e5f:	fc                   	cld
+  800e60:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  800e61:	48 83 ef 01          	sub    $0x1,%rdi
+  800e65:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  800e69:	fd                   	std
+  800e6a:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  800e6c:	eb f1                	jmp    800e5f <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800e6e:	48 89 f2             	mov    %rsi,%rdx
+  800e71:	48 09 c2             	or     %rax,%rdx
+  800e74:	48 09 ca             	or     %rcx,%rdx
+  800e77:	f6 c2 07             	test   $0x7,%dl
+  800e7a:	75 0c                	jne    800e88 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  800e7c:	48 c1 e9 03          	shr    $0x3,%rcx
+  800e80:	48 89 c7             	mov    %rax,%rdi
+  800e83:	fc                   	cld
+  800e84:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  800e87:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  800e88:	48 89 c7             	mov    %rax,%rdi
+  800e8b:	fc                   	cld
+  800e8c:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  800e8e:	c3                   	ret
+
+0000000000800e8f <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  800e8f:	55                   	push   %rbp
+  800e90:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  800e93:	48 b8 28 0e 80 00 00 	movabs $0x800e28,%rax
+  800e9a:	00 00 00 
+  800e9d:	ff d0                	call   *%rax
+}
+  800e9f:	5d                   	pop    %rbp
+  800ea0:	c3                   	ret
+
+0000000000800ea1 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  800ea1:	55                   	push   %rbp
+  800ea2:	48 89 e5             	mov    %rsp,%rbp
+  800ea5:	41 57                	push   %r15
+  800ea7:	41 56                	push   %r14
+  800ea9:	41 55                	push   %r13
+  800eab:	41 54                	push   %r12
+  800ead:	53                   	push   %rbx
+  800eae:	48 83 ec 08          	sub    $0x8,%rsp
+  800eb2:	49 89 fe             	mov    %rdi,%r14
+  800eb5:	49 89 f7             	mov    %rsi,%r15
+  800eb8:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  800ebb:	48 89 f7             	mov    %rsi,%rdi
+  800ebe:	48 b8 f0 0b 80 00 00 	movabs $0x800bf0,%rax
+  800ec5:	00 00 00 
+  800ec8:	ff d0                	call   *%rax
+  800eca:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  800ecd:	48 89 de             	mov    %rbx,%rsi
+  800ed0:	4c 89 f7             	mov    %r14,%rdi
+  800ed3:	48 b8 0b 0c 80 00 00 	movabs $0x800c0b,%rax
+  800eda:	00 00 00 
+  800edd:	ff d0                	call   *%rax
+  800edf:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  800ee2:	48 39 c3             	cmp    %rax,%rbx
+  800ee5:	74 36                	je     800f1d <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  800ee7:	48 89 d8             	mov    %rbx,%rax
+  800eea:	4c 29 e8             	sub    %r13,%rax
+  800eed:	49 39 c4             	cmp    %rax,%r12
+  800ef0:	73 31                	jae    800f23 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  800ef2:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  800ef7:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800efb:	4c 89 fe             	mov    %r15,%rsi
+  800efe:	48 b8 8f 0e 80 00 00 	movabs $0x800e8f,%rax
+  800f05:	00 00 00 
+  800f08:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  800f0a:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  800f0e:	48 83 c4 08          	add    $0x8,%rsp
+  800f12:	5b                   	pop    %rbx
+  800f13:	41 5c                	pop    %r12
+  800f15:	41 5d                	pop    %r13
+  800f17:	41 5e                	pop    %r14
+  800f19:	41 5f                	pop    %r15
+  800f1b:	5d                   	pop    %rbp
+  800f1c:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  800f1d:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800f21:	eb eb                	jmp    800f0e <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  800f23:	48 83 eb 01          	sub    $0x1,%rbx
+  800f27:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800f2b:	48 89 da             	mov    %rbx,%rdx
+  800f2e:	4c 89 fe             	mov    %r15,%rsi
+  800f31:	48 b8 8f 0e 80 00 00 	movabs $0x800e8f,%rax
+  800f38:	00 00 00 
+  800f3b:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  800f3d:	49 01 de             	add    %rbx,%r14
+  800f40:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  800f45:	eb c3                	jmp    800f0a <strlcat+0x69>
+
+0000000000800f47 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  800f47:	48 85 d2             	test   %rdx,%rdx
+  800f4a:	74 2d                	je     800f79 <memcmp+0x32>
+  800f4c:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  800f51:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800f55:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  800f5a:	44 38 c1             	cmp    %r8b,%cl
+  800f5d:	75 0f                	jne    800f6e <memcmp+0x27>
+    while (n-- > 0) {
+  800f5f:	48 83 c0 01          	add    $0x1,%rax
+  800f63:	48 39 c2             	cmp    %rax,%rdx
+  800f66:	75 e9                	jne    800f51 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  800f68:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f6d:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  800f6e:	0f b6 c1             	movzbl %cl,%eax
+  800f71:	45 0f b6 c0          	movzbl %r8b,%r8d
+  800f75:	44 29 c0             	sub    %r8d,%eax
+  800f78:	c3                   	ret
+    return 0;
+  800f79:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800f7e:	c3                   	ret
+
+0000000000800f7f <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  800f7f:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  800f83:	48 39 c7             	cmp    %rax,%rdi
+  800f86:	73 0f                	jae    800f97 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  800f88:	40 38 37             	cmp    %sil,(%rdi)
+  800f8b:	74 0e                	je     800f9b <memfind+0x1c>
+    for (; src < end; src++) {
+  800f8d:	48 83 c7 01          	add    $0x1,%rdi
+  800f91:	48 39 f8             	cmp    %rdi,%rax
+  800f94:	75 f2                	jne    800f88 <memfind+0x9>
+  800f96:	c3                   	ret
+  800f97:	48 89 f8             	mov    %rdi,%rax
+  800f9a:	c3                   	ret
+  800f9b:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  800f9e:	c3                   	ret
+
+0000000000800f9f <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  800f9f:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  800fa2:	0f b6 37             	movzbl (%rdi),%esi
+  800fa5:	40 80 fe 20          	cmp    $0x20,%sil
+  800fa9:	74 06                	je     800fb1 <strtol+0x12>
+  800fab:	40 80 fe 09          	cmp    $0x9,%sil
+  800faf:	75 13                	jne    800fc4 <strtol+0x25>
+  800fb1:	48 83 c7 01          	add    $0x1,%rdi
+  800fb5:	0f b6 37             	movzbl (%rdi),%esi
+  800fb8:	40 80 fe 20          	cmp    $0x20,%sil
+  800fbc:	74 f3                	je     800fb1 <strtol+0x12>
+  800fbe:	40 80 fe 09          	cmp    $0x9,%sil
+  800fc2:	74 ed                	je     800fb1 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  800fc4:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  800fc7:	83 e0 fd             	and    $0xfffffffd,%eax
+  800fca:	3c 01                	cmp    $0x1,%al
+  800fcc:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  800fd0:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  800fd6:	75 0f                	jne    800fe7 <strtol+0x48>
+  800fd8:	80 3f 30             	cmpb   $0x30,(%rdi)
+  800fdb:	74 14                	je     800ff1 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  800fdd:	85 d2                	test   %edx,%edx
+  800fdf:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800fe4:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  800fe7:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  800fec:	4c 63 ca             	movslq %edx,%r9
+  800fef:	eb 36                	jmp    801027 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  800ff1:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  800ff5:	74 0f                	je     801006 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  800ff7:	85 d2                	test   %edx,%edx
+  800ff9:	75 ec                	jne    800fe7 <strtol+0x48>
+        s++;
+  800ffb:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  800fff:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  801004:	eb e1                	jmp    800fe7 <strtol+0x48>
+        s += 2;
+  801006:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  80100a:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  80100f:	eb d6                	jmp    800fe7 <strtol+0x48>
+            dig -= '0';
+  801011:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  801014:	44 0f b6 c1          	movzbl %cl,%r8d
+  801018:	41 39 d0             	cmp    %edx,%r8d
+  80101b:	7d 21                	jge    80103e <strtol+0x9f>
+        val = val * base + dig;
+  80101d:	49 0f af c1          	imul   %r9,%rax
+  801021:	0f b6 c9             	movzbl %cl,%ecx
+  801024:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  801027:	48 83 c7 01          	add    $0x1,%rdi
+  80102b:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  80102f:	80 f9 39             	cmp    $0x39,%cl
+  801032:	76 dd                	jbe    801011 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  801034:	80 f9 7b             	cmp    $0x7b,%cl
+  801037:	77 05                	ja     80103e <strtol+0x9f>
+            dig -= 'a' - 10;
+  801039:	83 e9 57             	sub    $0x57,%ecx
+  80103c:	eb d6                	jmp    801014 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  80103e:	4d 85 d2             	test   %r10,%r10
+  801041:	74 03                	je     801046 <strtol+0xa7>
+  801043:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  801046:	48 89 c2             	mov    %rax,%rdx
+  801049:	48 f7 da             	neg    %rdx
+  80104c:	40 80 fe 2d          	cmp    $0x2d,%sil
+  801050:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  801054:	c3                   	ret
+
+0000000000801055 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  801055:	55                   	push   %rbp
+  801056:	48 89 e5             	mov    %rsp,%rbp
+  801059:	53                   	push   %rbx
+  80105a:	48 89 fa             	mov    %rdi,%rdx
+  80105d:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801060:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801065:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80106a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80106f:	be 00 00 00 00       	mov    $0x0,%esi
+  801074:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80107a:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  80107c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801080:	c9                   	leave
+  801081:	c3                   	ret
+
+0000000000801082 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  801082:	55                   	push   %rbp
+  801083:	48 89 e5             	mov    %rsp,%rbp
+  801086:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801087:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80108c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801091:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801096:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80109b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8010a0:	be 00 00 00 00       	mov    $0x0,%esi
+  8010a5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8010ab:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  8010ad:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8010b1:	c9                   	leave
+  8010b2:	c3                   	ret
+
+00000000008010b3 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  8010b3:	55                   	push   %rbp
+  8010b4:	48 89 e5             	mov    %rsp,%rbp
+  8010b7:	53                   	push   %rbx
+  8010b8:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  8010bc:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8010bf:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8010c4:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8010c9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010ce:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8010d3:	be 00 00 00 00       	mov    $0x0,%esi
+  8010d8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8010de:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8010e0:	48 85 c0             	test   %rax,%rax
+  8010e3:	7f 06                	jg     8010eb <sys_env_destroy+0x38>
+}
+  8010e5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8010e9:	c9                   	leave
+  8010ea:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8010eb:	49 89 c0             	mov    %rax,%r8
+  8010ee:	b9 03 00 00 00       	mov    $0x3,%ecx
+  8010f3:	48 ba f0 34 80 00 00 	movabs $0x8034f0,%rdx
+  8010fa:	00 00 00 
+  8010fd:	be 26 00 00 00       	mov    $0x26,%esi
+  801102:	48 bf 0f 35 80 00 00 	movabs $0x80350f,%rdi
+  801109:	00 00 00 
+  80110c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801111:	49 b9 9b 2e 80 00 00 	movabs $0x802e9b,%r9
+  801118:	00 00 00 
+  80111b:	41 ff d1             	call   *%r9
+
+000000000080111e <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  80111e:	55                   	push   %rbp
+  80111f:	48 89 e5             	mov    %rsp,%rbp
+  801122:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801123:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801128:	ba 00 00 00 00       	mov    $0x0,%edx
+  80112d:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801132:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801137:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80113c:	be 00 00 00 00       	mov    $0x0,%esi
+  801141:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801147:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  801149:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80114d:	c9                   	leave
+  80114e:	c3                   	ret
+
+000000000080114f <sys_yield>:
+
+void
+sys_yield(void) {
+  80114f:	55                   	push   %rbp
+  801150:	48 89 e5             	mov    %rsp,%rbp
+  801153:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801154:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801159:	ba 00 00 00 00       	mov    $0x0,%edx
+  80115e:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801163:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801168:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80116d:	be 00 00 00 00       	mov    $0x0,%esi
+  801172:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801178:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  80117a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80117e:	c9                   	leave
+  80117f:	c3                   	ret
+
+0000000000801180 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  801180:	55                   	push   %rbp
+  801181:	48 89 e5             	mov    %rsp,%rbp
+  801184:	53                   	push   %rbx
+  801185:	48 89 fa             	mov    %rdi,%rdx
+  801188:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80118b:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801190:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  801197:	00 00 00 
+  80119a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80119f:	be 00 00 00 00       	mov    $0x0,%esi
+  8011a4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8011aa:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  8011ac:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8011b0:	c9                   	leave
+  8011b1:	c3                   	ret
+
+00000000008011b2 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  8011b2:	55                   	push   %rbp
+  8011b3:	48 89 e5             	mov    %rsp,%rbp
+  8011b6:	53                   	push   %rbx
+  8011b7:	49 89 f8             	mov    %rdi,%r8
+  8011ba:	48 89 d3             	mov    %rdx,%rbx
+  8011bd:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8011c0:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8011c5:	4c 89 c2             	mov    %r8,%rdx
+  8011c8:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8011cb:	be 00 00 00 00       	mov    $0x0,%esi
+  8011d0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8011d6:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  8011d8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8011dc:	c9                   	leave
+  8011dd:	c3                   	ret
+
+00000000008011de <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  8011de:	55                   	push   %rbp
+  8011df:	48 89 e5             	mov    %rsp,%rbp
+  8011e2:	53                   	push   %rbx
+  8011e3:	48 83 ec 08          	sub    $0x8,%rsp
+  8011e7:	89 f8                	mov    %edi,%eax
+  8011e9:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  8011ec:	48 63 f9             	movslq %ecx,%rdi
+  8011ef:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8011f2:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8011f7:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8011fa:	be 00 00 00 00       	mov    $0x0,%esi
+  8011ff:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801205:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801207:	48 85 c0             	test   %rax,%rax
+  80120a:	7f 06                	jg     801212 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  80120c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801210:	c9                   	leave
+  801211:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801212:	49 89 c0             	mov    %rax,%r8
+  801215:	b9 04 00 00 00       	mov    $0x4,%ecx
+  80121a:	48 ba f0 34 80 00 00 	movabs $0x8034f0,%rdx
+  801221:	00 00 00 
+  801224:	be 26 00 00 00       	mov    $0x26,%esi
+  801229:	48 bf 0f 35 80 00 00 	movabs $0x80350f,%rdi
+  801230:	00 00 00 
+  801233:	b8 00 00 00 00       	mov    $0x0,%eax
+  801238:	49 b9 9b 2e 80 00 00 	movabs $0x802e9b,%r9
+  80123f:	00 00 00 
+  801242:	41 ff d1             	call   *%r9
+
+0000000000801245 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801245:	55                   	push   %rbp
+  801246:	48 89 e5             	mov    %rsp,%rbp
+  801249:	53                   	push   %rbx
+  80124a:	48 83 ec 08          	sub    $0x8,%rsp
+  80124e:	89 f8                	mov    %edi,%eax
+  801250:	49 89 f2             	mov    %rsi,%r10
+  801253:	48 89 cf             	mov    %rcx,%rdi
+  801256:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  801259:	48 63 da             	movslq %edx,%rbx
+  80125c:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80125f:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801264:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801267:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  80126a:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80126c:	48 85 c0             	test   %rax,%rax
+  80126f:	7f 06                	jg     801277 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  801271:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801275:	c9                   	leave
+  801276:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801277:	49 89 c0             	mov    %rax,%r8
+  80127a:	b9 05 00 00 00       	mov    $0x5,%ecx
+  80127f:	48 ba f0 34 80 00 00 	movabs $0x8034f0,%rdx
+  801286:	00 00 00 
+  801289:	be 26 00 00 00       	mov    $0x26,%esi
+  80128e:	48 bf 0f 35 80 00 00 	movabs $0x80350f,%rdi
+  801295:	00 00 00 
+  801298:	b8 00 00 00 00       	mov    $0x0,%eax
+  80129d:	49 b9 9b 2e 80 00 00 	movabs $0x802e9b,%r9
+  8012a4:	00 00 00 
+  8012a7:	41 ff d1             	call   *%r9
+
+00000000008012aa <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  8012aa:	55                   	push   %rbp
+  8012ab:	48 89 e5             	mov    %rsp,%rbp
+  8012ae:	53                   	push   %rbx
+  8012af:	48 83 ec 08          	sub    $0x8,%rsp
+  8012b3:	48 89 f1             	mov    %rsi,%rcx
+  8012b6:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  8012b9:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8012bc:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8012c1:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012c6:	be 00 00 00 00       	mov    $0x0,%esi
+  8012cb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8012d1:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8012d3:	48 85 c0             	test   %rax,%rax
+  8012d6:	7f 06                	jg     8012de <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  8012d8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012dc:	c9                   	leave
+  8012dd:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8012de:	49 89 c0             	mov    %rax,%r8
+  8012e1:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8012e6:	48 ba f0 34 80 00 00 	movabs $0x8034f0,%rdx
+  8012ed:	00 00 00 
+  8012f0:	be 26 00 00 00       	mov    $0x26,%esi
+  8012f5:	48 bf 0f 35 80 00 00 	movabs $0x80350f,%rdi
+  8012fc:	00 00 00 
+  8012ff:	b8 00 00 00 00       	mov    $0x0,%eax
+  801304:	49 b9 9b 2e 80 00 00 	movabs $0x802e9b,%r9
+  80130b:	00 00 00 
+  80130e:	41 ff d1             	call   *%r9
+
+0000000000801311 <sys_region_batch>:
+
+int
+sys_region_batch(const struct RegionOp *ops, size_t count) {
+  801311:	55                   	push   %rbp
+  801312:	48 89 e5             	mov    %rsp,%rbp
+  801315:	53                   	push   %rbx
+  801316:	48 83 ec 08          	sub    $0x8,%rsp
+  80131a:	48 89 fa             	mov    %rdi,%rdx
+  80131d:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801320:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801325:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80132a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80132f:	be 00 00 00 00       	mov    $0x0,%esi
+  801334:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80133a:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80133c:	48 85 c0             	test   %rax,%rax
+  80133f:	7f 06                	jg     801347 <sys_region_batch+0x36>
+        else
+            platform_asan_unpoison(va, ops[i].size);
+    }
+#endif
+    return res;
+}
+  801341:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801345:	c9                   	leave
+  801346:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801347:	49 89 c0             	mov    %rax,%r8
+  80134a:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  80134f:	48 ba f0 34 80 00 00 	movabs $0x8034f0,%rdx
+  801356:	00 00 00 
+  801359:	be 26 00 00 00       	mov    $0x26,%esi
+  80135e:	48 bf 0f 35 80 00 00 	movabs $0x80350f,%rdi
+  801365:	00 00 00 
+  801368:	b8 00 00 00 00       	mov    $0x0,%eax
+  80136d:	49 b9 9b 2e 80 00 00 	movabs $0x802e9b,%r9
+  801374:	00 00 00 
+  801377:	41 ff d1             	call   *%r9
+
+000000000080137a <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  80137a:	55                   	push   %rbp
+  80137b:	48 89 e5             	mov    %rsp,%rbp
+  80137e:	53                   	push   %rbx
+  80137f:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  801383:	48 63 ce             	movslq %esi,%rcx
+  801386:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801389:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80138e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801393:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801398:	be 00 00 00 00       	mov    $0x0,%esi
+  80139d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013a3:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8013a5:	48 85 c0             	test   %rax,%rax
+  8013a8:	7f 06                	jg     8013b0 <sys_env_set_status+0x36>
+}
+  8013aa:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013ae:	c9                   	leave
+  8013af:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8013b0:	49 89 c0             	mov    %rax,%r8
+  8013b3:	b9 09 00 00 00       	mov    $0x9,%ecx
+  8013b8:	48 ba f0 34 80 00 00 	movabs $0x8034f0,%rdx
+  8013bf:	00 00 00 
+  8013c2:	be 26 00 00 00       	mov    $0x26,%esi
+  8013c7:	48 bf 0f 35 80 00 00 	movabs $0x80350f,%rdi
+  8013ce:	00 00 00 
+  8013d1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013d6:	49 b9 9b 2e 80 00 00 	movabs $0x802e9b,%r9
+  8013dd:	00 00 00 
+  8013e0:	41 ff d1             	call   *%r9
+
+00000000008013e3 <sys_env_set_weight>:
+
+int
+sys_env_set_weight(envid_t envid, uint32_t weight) {
+  8013e3:	55                   	push   %rbp
+  8013e4:	48 89 e5             	mov    %rsp,%rbp
+  8013e7:	53                   	push   %rbx
+  8013e8:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_weight, 1, envid, weight, 0, 0, 0, 0);
+  8013ec:	89 f1                	mov    %esi,%ecx
+  8013ee:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8013f1:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8013f6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013fb:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801400:	be 00 00 00 00       	mov    $0x0,%esi
+  801405:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80140b:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80140d:	48 85 c0             	test   %rax,%rax
+  801410:	7f 06                	jg     801418 <sys_env_set_weight+0x35>
+}
+  801412:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801416:	c9                   	leave
+  801417:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801418:	49 89 c0             	mov    %rax,%r8
+  80141b:	b9 10 00 00 00       	mov    $0x10,%ecx
+  801420:	48 ba f0 34 80 00 00 	movabs $0x8034f0,%rdx
+  801427:	00 00 00 
+  80142a:	be 26 00 00 00       	mov    $0x26,%esi
+  80142f:	48 bf 0f 35 80 00 00 	movabs $0x80350f,%rdi
+  801436:	00 00 00 
+  801439:	b8 00 00 00 00       	mov    $0x0,%eax
+  80143e:	49 b9 9b 2e 80 00 00 	movabs $0x802e9b,%r9
+  801445:	00 00 00 
+  801448:	41 ff d1             	call   *%r9
+
+000000000080144b <sys_env_set_rt>:
+
+int
+sys_env_set_rt(envid_t envid, uint64_t period, uint64_t budget, uint64_t deadline) {
+  80144b:	55                   	push   %rbp
+  80144c:	48 89 e5             	mov    %rsp,%rbp
+  80144f:	53                   	push   %rbx
+  801450:	48 83 ec 08          	sub    $0x8,%rsp
+  801454:	89 f8                	mov    %edi,%eax
+  801456:	48 89 d3             	mov    %rdx,%rbx
+  801459:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_env_set_rt, 1, envid, period, budget, deadline, 0, 0);
+  80145c:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80145f:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801464:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801467:	be 00 00 00 00       	mov    $0x0,%esi
+  80146c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801472:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801474:	48 85 c0             	test   %rax,%rax
+  801477:	7f 06                	jg     80147f <sys_env_set_rt+0x34>
+}
+  801479:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80147d:	c9                   	leave
+  80147e:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80147f:	49 89 c0             	mov    %rax,%r8
+  801482:	b9 11 00 00 00       	mov    $0x11,%ecx
+  801487:	48 ba f0 34 80 00 00 	movabs $0x8034f0,%rdx
+  80148e:	00 00 00 
+  801491:	be 26 00 00 00       	mov    $0x26,%esi
+  801496:	48 bf 0f 35 80 00 00 	movabs $0x80350f,%rdi
+  80149d:	00 00 00 
+  8014a0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014a5:	49 b9 9b 2e 80 00 00 	movabs $0x802e9b,%r9
+  8014ac:	00 00 00 
+  8014af:	41 ff d1             	call   *%r9
+
+00000000008014b2 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  8014b2:	55                   	push   %rbp
+  8014b3:	48 89 e5             	mov    %rsp,%rbp
+  8014b6:	53                   	push   %rbx
+  8014b7:	48 83 ec 08          	sub    $0x8,%rsp
+  8014bb:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  8014be:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8014c1:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8014c6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014cb:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014d0:	be 00 00 00 00       	mov    $0x0,%esi
+  8014d5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014db:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8014dd:	48 85 c0             	test   %rax,%rax
+  8014e0:	7f 06                	jg     8014e8 <sys_env_set_trapframe+0x36>
+}
+  8014e2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014e6:	c9                   	leave
+  8014e7:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8014e8:	49 89 c0             	mov    %rax,%r8
+  8014eb:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  8014f0:	48 ba f0 34 80 00 00 	movabs $0x8034f0,%rdx
+  8014f7:	00 00 00 
+  8014fa:	be 26 00 00 00       	mov    $0x26,%esi
+  8014ff:	48 bf 0f 35 80 00 00 	movabs $0x80350f,%rdi
+  801506:	00 00 00 
+  801509:	b8 00 00 00 00       	mov    $0x0,%eax
+  80150e:	49 b9 9b 2e 80 00 00 	movabs $0x802e9b,%r9
+  801515:	00 00 00 
+  801518:	41 ff d1             	call   *%r9
+
+000000000080151b <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  80151b:	55                   	push   %rbp
+  80151c:	48 89 e5             	mov    %rsp,%rbp
+  80151f:	53                   	push   %rbx
+  801520:	48 83 ec 08          	sub    $0x8,%rsp
+  801524:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  801527:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80152a:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80152f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801534:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801539:	be 00 00 00 00       	mov    $0x0,%esi
+  80153e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801544:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801546:	48 85 c0             	test   %rax,%rax
+  801549:	7f 06                	jg     801551 <sys_env_set_pgfault_upcall+0x36>
+}
+  80154b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80154f:	c9                   	leave
+  801550:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801551:	49 89 c0             	mov    %rax,%r8
+  801554:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  801559:	48 ba f0 34 80 00 00 	movabs $0x8034f0,%rdx
+  801560:	00 00 00 
+  801563:	be 26 00 00 00       	mov    $0x26,%esi
+  801568:	48 bf 0f 35 80 00 00 	movabs $0x80350f,%rdi
+  80156f:	00 00 00 
+  801572:	b8 00 00 00 00       	mov    $0x0,%eax
+  801577:	49 b9 9b 2e 80 00 00 	movabs $0x802e9b,%r9
+  80157e:	00 00 00 
+  801581:	41 ff d1             	call   *%r9
+
+0000000000801584 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  801584:	55                   	push   %rbp
+  801585:	48 89 e5             	mov    %rsp,%rbp
+  801588:	53                   	push   %rbx
+  801589:	89 f8                	mov    %edi,%eax
+  80158b:	49 89 f1             	mov    %rsi,%r9
+  80158e:	48 89 d3             	mov    %rdx,%rbx
+  801591:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  801594:	49 63 f0             	movslq %r8d,%rsi
+  801597:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80159a:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80159f:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015a2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015a8:	cd 30                	int    $0x30
+}
+  8015aa:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015ae:	c9                   	leave
+  8015af:	c3                   	ret
+
+00000000008015b0 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  8015b0:	55                   	push   %rbp
+  8015b1:	48 89 e5             	mov    %rsp,%rbp
+  8015b4:	53                   	push   %rbx
+  8015b5:	48 83 ec 08          	sub    $0x8,%rsp
+  8015b9:	48 89 fa             	mov    %rdi,%rdx
+  8015bc:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8015bf:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8015c4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015c9:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015ce:	be 00 00 00 00       	mov    $0x0,%esi
+  8015d3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015d9:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8015db:	48 85 c0             	test   %rax,%rax
+  8015de:	7f 06                	jg     8015e6 <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8015e0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015e4:	c9                   	leave
+  8015e5:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8015e6:	49 89 c0             	mov    %rax,%r8
+  8015e9:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  8015ee:	48 ba f0 34 80 00 00 	movabs $0x8034f0,%rdx
+  8015f5:	00 00 00 
+  8015f8:	be 26 00 00 00       	mov    $0x26,%esi
+  8015fd:	48 bf 0f 35 80 00 00 	movabs $0x80350f,%rdi
+  801604:	00 00 00 
+  801607:	b8 00 00 00 00       	mov    $0x0,%eax
+  80160c:	49 b9 9b 2e 80 00 00 	movabs $0x802e9b,%r9
+  801613:	00 00 00 
+  801616:	41 ff d1             	call   *%r9
+
+0000000000801619 <fork>:
+ * Hint:
+ *   Use sys_map_region, it can perform address space copying in one call
+ *   Remember to fix "thisenv" in the child process.
+ */
+envid_t
+fork(void) {
+  801619:	55                   	push   %rbp
+  80161a:	48 89 e5             	mov    %rsp,%rbp
+  80161d:	41 55                	push   %r13
+  80161f:	41 54                	push   %r12
+  801621:	53                   	push   %rbx
+  801622:	48 83 ec 08          	sub    $0x8,%rsp
+
+/* This must be inlined. Exercise for reader: why? */
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+    envid_t ret;
+    asm volatile("int %2"
+  801626:	b8 08 00 00 00       	mov    $0x8,%eax
+  80162b:	cd 30                	int    $0x30
+  80162d:	41 89 c5             	mov    %eax,%r13d
+    // LAB 9: Your code here
+
+    envid_t child_id = sys_exofork();
+    if (child_id < 0) {
+  801630:	85 c0                	test   %eax,%eax
+  801632:	0f 88 ae 00 00 00    	js     8016e6 <fork+0xcd>
+  801638:	89 c3                	mov    %eax,%ebx
+        return child_id;
+    }
+    if (child_id == 0) {
+  80163a:	0f 84 b4 00 00 00    	je     8016f4 <fork+0xdb>
+        thisenv = &envs[ENVX(sys_getenvid())];
+        return 0;
+    }
+    int res = sys_map_region(0, NULL, child_id, NULL, MAX_USER_ADDRESS, PROT_ALL | PROT_LAZY | PROT_COMBINE);
+  801640:	41 b9 df 01 00 00    	mov    $0x1df,%r9d
+  801646:	49 b8 00 00 00 00 80 	movabs $0x8000000000,%r8
+  80164d:	00 00 00 
+  801650:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801655:	89 c2                	mov    %eax,%edx
+  801657:	be 00 00 00 00       	mov    $0x0,%esi
+  80165c:	bf 00 00 00 00       	mov    $0x0,%edi
+  801661:	48 b8 45 12 80 00 00 	movabs $0x801245,%rax
+  801668:	00 00 00 
+  80166b:	ff d0                	call   *%rax
+  80166d:	41 89 c4             	mov    %eax,%r12d
+    if (res < 0) {
+  801670:	85 c0                	test   %eax,%eax
+  801672:	78 5d                	js     8016d1 <fork+0xb8>
+        goto error;
+    }
+    res = sys_env_set_pgfault_upcall(child_id, envs[ENVX(sys_getenvid())].env_pgfault_upcall);
+  801674:	48 b8 1e 11 80 00 00 	movabs $0x80111e,%rax
+  80167b:	00 00 00 
+  80167e:	ff d0                	call   *%rax
+  801680:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801685:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+  80168c:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  801693:	00 00 00 
+  801696:	48 01 d0             	add    %rdx,%rax
+  801699:	48 8b b0 88 01 00 00 	mov    0x188(%rax),%rsi
+  8016a0:	44 89 ef             	mov    %r13d,%edi
+  8016a3:	48 b8 1b 15 80 00 00 	movabs $0x80151b,%rax
+  8016aa:	00 00 00 
+  8016ad:	ff d0                	call   *%rax
+  8016af:	41 89 c4             	mov    %eax,%r12d
+    if (res < 0) {
+  8016b2:	85 c0                	test   %eax,%eax
+  8016b4:	78 1b                	js     8016d1 <fork+0xb8>
+        goto error;
+    }
+    res = sys_env_set_status(child_id, ENV_RUNNABLE);
+  8016b6:	be 02 00 00 00       	mov    $0x2,%esi
+  8016bb:	44 89 ef             	mov    %r13d,%edi
+  8016be:	48 b8 7a 13 80 00 00 	movabs $0x80137a,%rax
+  8016c5:	00 00 00 
+  8016c8:	ff d0                	call   *%rax
+  8016ca:	41 89 c4             	mov    %eax,%r12d
+    if (res < 0) {
+  8016cd:	85 c0                	test   %eax,%eax
+  8016cf:	79 15                	jns    8016e6 <fork+0xcd>
+        goto error;
+    }
+    return child_id;
+error:
+    ;
+    int res2 = sys_env_destroy(child_id);
+  8016d1:	89 df                	mov    %ebx,%edi
+  8016d3:	48 b8 b3 10 80 00 00 	movabs $0x8010b3,%rax
+  8016da:	00 00 00 
+  8016dd:	ff d0                	call   *%rax
+    if (res2 < 0) {
+  8016df:	85 c0                	test   %eax,%eax
+  8016e1:	78 42                	js     801725 <fork+0x10c>
+        panic("Fork double fault");
+    }
+    return res;
+  8016e3:	45 89 e5             	mov    %r12d,%r13d
+}
+  8016e6:	44 89 e8             	mov    %r13d,%eax
+  8016e9:	48 83 c4 08          	add    $0x8,%rsp
+  8016ed:	5b                   	pop    %rbx
+  8016ee:	41 5c                	pop    %r12
+  8016f0:	41 5d                	pop    %r13
+  8016f2:	5d                   	pop    %rbp
+  8016f3:	c3                   	ret
+        thisenv = &envs[ENVX(sys_getenvid())];
+  8016f4:	48 b8 1e 11 80 00 00 	movabs $0x80111e,%rax
+  8016fb:	00 00 00 
+  8016fe:	ff d0                	call   *%rax
+  801700:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801705:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+  80170c:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  801713:	00 00 00 
+  801716:	48 01 d0             	add    %rdx,%rax
+  801719:	48 a3 08 50 80 00 00 	movabs %rax,0x805008
+  801720:	00 00 00 
+        return 0;
+  801723:	eb c1                	jmp    8016e6 <fork+0xcd>
+        panic("Fork double fault");
+  801725:	48 ba 1d 35 80 00 00 	movabs $0x80351d,%rdx
+  80172c:	00 00 00 
+  80172f:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801734:	48 bf 2f 35 80 00 00 	movabs $0x80352f,%rdi
+  80173b:	00 00 00 
+  80173e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801743:	48 b9 9b 2e 80 00 00 	movabs $0x802e9b,%rcx
+  80174a:	00 00 00 
+  80174d:	ff d1                	call   *%rcx
+
+000000000080174f <sfork>:
+
+envid_t
+sfork() {
+  80174f:	55                   	push   %rbp
+  801750:	48 89 e5             	mov    %rsp,%rbp
+    panic("sfork() is not implemented");
+  801753:	48 ba 3a 35 80 00 00 	movabs $0x80353a,%rdx
+  80175a:	00 00 00 
+  80175d:	be 36 00 00 00       	mov    $0x36,%esi
+  801762:	48 bf 2f 35 80 00 00 	movabs $0x80352f,%rdi
+  801769:	00 00 00 
+  80176c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801771:	48 b9 9b 2e 80 00 00 	movabs $0x802e9b,%rcx
+  801778:	00 00 00 
+  80177b:	ff d1                	call   *%rcx
+
+000000000080177d <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  80177d:	55                   	push   %rbp
+  80177e:	48 89 e5             	mov    %rsp,%rbp
+  801781:	41 55                	push   %r13
+  801783:	41 54                	push   %r12
+  801785:	53                   	push   %rbx
+  801786:	48 83 ec 08          	sub    $0x8,%rsp
+  80178a:	49 89 fc             	mov    %rdi,%r12
+  80178d:	48 89 f7             	mov    %rsi,%rdi
+  801790:	48 89 d3             	mov    %rdx,%rbx
+  801793:	49 89 cd             	mov    %rcx,%r13
+    // LAB 9: Your code here:
+    int res = sys_ipc_recv(!pg ? (void*)MAX_USER_ADDRESS : pg, !size ? 0 : *size);
+  801796:	be 00 00 00 00       	mov    $0x0,%esi
+  80179b:	48 85 d2             	test   %rdx,%rdx
+  80179e:	74 03                	je     8017a3 <ipc_recv+0x26>
+  8017a0:	48 8b 32             	mov    (%rdx),%rsi
+  8017a3:	48 85 ff             	test   %rdi,%rdi
+  8017a6:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8017ad:	00 00 00 
+  8017b0:	48 0f 44 f8          	cmove  %rax,%rdi
+  8017b4:	48 b8 b0 15 80 00 00 	movabs $0x8015b0,%rax
+  8017bb:	00 00 00 
+  8017be:	ff d0                	call   *%rax
+    if (res < 0) {
+  8017c0:	85 c0                	test   %eax,%eax
+  8017c2:	78 66                	js     80182a <ipc_recv+0xad>
+        if (size) {
+            *size = 0;
+        }
+        return res;
+    }
+    if (from_env_store) {
+  8017c4:	4d 85 e4             	test   %r12,%r12
+  8017c7:	74 14                	je     8017dd <ipc_recv+0x60>
+        *from_env_store = thisenv->env_ipc_from;
+  8017c9:	48 a1 08 50 80 00 00 	movabs 0x805008,%rax
+  8017d0:	00 00 00 
+  8017d3:	8b 80 ac 01 00 00    	mov    0x1ac(%rax),%eax
+  8017d9:	41 89 04 24          	mov    %eax,(%r12)
+    }
+    if (perm_store) {
+  8017dd:	4d 85 ed             	test   %r13,%r13
+  8017e0:	74 14                	je     8017f6 <ipc_recv+0x79>
+        *perm_store = thisenv->env_ipc_perm;
+  8017e2:	48 a1 08 50 80 00 00 	movabs 0x805008,%rax
+  8017e9:	00 00 00 
+  8017ec:	8b 80 b0 01 00 00    	mov    0x1b0(%rax),%eax
+  8017f2:	41 89 45 00          	mov    %eax,0x0(%r13)
+    }
+    if (size) {
+  8017f6:	48 85 db             	test   %rbx,%rbx
+  8017f9:	74 14                	je     80180f <ipc_recv+0x92>
+        *size = thisenv->env_ipc_maxsz;
+  8017fb:	48 a1 08 50 80 00 00 	movabs 0x805008,%rax
+  801802:	00 00 00 
+  801805:	48 8b 80 a0 01 00 00 	mov    0x1a0(%rax),%rax
+  80180c:	48 89 03             	mov    %rax,(%rbx)
+    }
+    return thisenv->env_ipc_value;
+  80180f:	48 a1 08 50 80 00 00 	movabs 0x805008,%rax
+  801816:	00 00 00 
+  801819:	8b 80 a8 01 00 00    	mov    0x1a8(%rax),%eax
+}
+  80181f:	48 83 c4 08          	add    $0x8,%rsp
+  801823:	5b                   	pop    %rbx
+  801824:	41 5c                	pop    %r12
+  801826:	41 5d                	pop    %r13
+  801828:	5d                   	pop    %rbp
+  801829:	c3                   	ret
+        if (from_env_store) {
+  80182a:	4d 85 e4             	test   %r12,%r12
+  80182d:	74 08                	je     801837 <ipc_recv+0xba>
+            *from_env_store = 0;
+  80182f:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  801836:	00 
+        if (perm_store) {
+  801837:	4d 85 ed             	test   %r13,%r13
+  80183a:	74 08                	je     801844 <ipc_recv+0xc7>
+            *perm_store = 0;
+  80183c:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  801843:	00 
+        if (size) {
+  801844:	48 85 db             	test   %rbx,%rbx
+  801847:	74 d6                	je     80181f <ipc_recv+0xa2>
+            *size = 0;
+  801849:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  801850:	eb cd                	jmp    80181f <ipc_recv+0xa2>
+
+0000000000801852 <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  801852:	55                   	push   %rbp
+  801853:	48 89 e5             	mov    %rsp,%rbp
+  801856:	41 57                	push   %r15
+  801858:	41 56                	push   %r14
+  80185a:	41 55                	push   %r13
+  80185c:	41 54                	push   %r12
+  80185e:	53                   	push   %rbx
+  80185f:	48 83 ec 18          	sub    $0x18,%rsp
+  801863:	41 89 fd             	mov    %edi,%r13d
+  801866:	89 75 cc             	mov    %esi,-0x34(%rbp)
+  801869:	49 89 cc             	mov    %rcx,%r12
+  80186c:	44 89 45 c8          	mov    %r8d,-0x38(%rbp)
+    // LAB 9: Your code here:
+    int res = 0;
+    while ((res = sys_ipc_try_send(to_env, val, !pg ? (void*)MAX_USER_ADDRESS : pg, size, perm)) < 0) {
+  801870:	48 85 d2             	test   %rdx,%rdx
+  801873:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80187a:	00 00 00 
+  80187d:	48 0f 45 c2          	cmovne %rdx,%rax
+  801881:	48 89 c3             	mov    %rax,%rbx
+  801884:	49 be 84 15 80 00 00 	movabs $0x801584,%r14
+  80188b:	00 00 00 
+        if (res != -E_IPC_NOT_RECV) {
+            panic("sys_ipc_try_send failed: %i", res);
+        }
+        sys_yield();
+  80188e:	49 bf 4f 11 80 00 00 	movabs $0x80114f,%r15
+  801895:	00 00 00 
+    while ((res = sys_ipc_try_send(to_env, val, !pg ? (void*)MAX_USER_ADDRESS : pg, size, perm)) < 0) {
+  801898:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  80189b:	44 8b 45 c8          	mov    -0x38(%rbp),%r8d
+  80189f:	4c 89 e1             	mov    %r12,%rcx
+  8018a2:	48 89 da             	mov    %rbx,%rdx
+  8018a5:	44 89 ef             	mov    %r13d,%edi
+  8018a8:	41 ff d6             	call   *%r14
+  8018ab:	85 c0                	test   %eax,%eax
+  8018ad:	79 37                	jns    8018e6 <ipc_send+0x94>
+        if (res != -E_IPC_NOT_RECV) {
+  8018af:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  8018b2:	75 05                	jne    8018b9 <ipc_send+0x67>
+        sys_yield();
+  8018b4:	41 ff d7             	call   *%r15
+  8018b7:	eb df                	jmp    801898 <ipc_send+0x46>
+            panic("sys_ipc_try_send failed: %i", res);
+  8018b9:	89 c1                	mov    %eax,%ecx
+  8018bb:	48 ba 55 35 80 00 00 	movabs $0x803555,%rdx
+  8018c2:	00 00 00 
+  8018c5:	be 40 00 00 00       	mov    $0x40,%esi
+  8018ca:	48 bf 71 35 80 00 00 	movabs $0x803571,%rdi
+  8018d1:	00 00 00 
+  8018d4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018d9:	49 b8 9b 2e 80 00 00 	movabs $0x802e9b,%r8
+  8018e0:	00 00 00 
+  8018e3:	41 ff d0             	call   *%r8
+    }
+    return;
+}
+  8018e6:	48 83 c4 18          	add    $0x18,%rsp
+  8018ea:	5b                   	pop    %rbx
+  8018eb:	41 5c                	pop    %r12
+  8018ed:	41 5d                	pop    %r13
+  8018ef:	41 5e                	pop    %r14
+  8018f1:	41 5f                	pop    %r15
+  8018f3:	5d                   	pop    %rbp
+  8018f4:	c3                   	ret
+
+00000000008018f5 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  8018f5:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  8018fa:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  801901:	00 00 00 
+  801904:	48 69 d0 d0 01 00 00 	imul   $0x1d0,%rax,%rdx
+  80190b:	48 01 ca             	add    %rcx,%rdx
+  80190e:	8b 92 e8 00 00 00    	mov    0xe8(%rdx),%edx
+  801914:	39 fa                	cmp    %edi,%edx
+  801916:	74 12                	je     80192a <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  801918:	48 83 c0 01          	add    $0x1,%rax
+  80191c:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  801922:	75 e0                	jne    801904 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  801924:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801929:	c3                   	ret
+            return envs[i].env_id;
+  80192a:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+  801931:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  801938:	00 00 00 
+  80193b:	48 01 d0             	add    %rdx,%rax
+  80193e:	8b 80 e0 00 00 00    	mov    0xe0(%rax),%eax
+  801944:	c3                   	ret
+
+0000000000801945 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801945:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  80194c:	ff ff ff 
+  80194f:	48 01 f8             	add    %rdi,%rax
+  801952:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  801956:	c3                   	ret
+
+0000000000801957 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801957:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  80195e:	ff ff ff 
+  801961:	48 01 f8             	add    %rdi,%rax
+  801964:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  801968:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  80196e:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  801972:	c3                   	ret
+
+0000000000801973 <fd_alloc_from>:
+}
+
+/* Like fd_alloc(), but only considers fds starting from fdnum,
+ * so that several fds can be found before their pages are allocated */
+int
+fd_alloc_from(int fdnum, struct Fd **fd_store) {
+  801973:	55                   	push   %rbp
+  801974:	48 89 e5             	mov    %rsp,%rbp
+  801977:	41 57                	push   %r15
+  801979:	41 56                	push   %r14
+  80197b:	41 55                	push   %r13
+  80197d:	41 54                	push   %r12
+  80197f:	53                   	push   %rbx
+  801980:	48 83 ec 08          	sub    $0x8,%rsp
+  801984:	49 89 f7             	mov    %rsi,%r15
+    for (int i = MAX(fdnum, 0); i < MAXFD; i++) {
+  801987:	85 ff                	test   %edi,%edi
+  801989:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80198f:	44 0f 49 e7          	cmovns %edi,%r12d
+  801993:	83 ff 1f             	cmp    $0x1f,%edi
+  801996:	7f 37                	jg     8019cf <fd_alloc_from+0x5c>
+  801998:	49 63 dc             	movslq %r12d,%rbx
+  80199b:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  8019a2:	48 c1 e3 0c          	shl    $0xc,%rbx
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  8019a6:	49 be 7c 2a 80 00 00 	movabs $0x802a7c,%r14
+  8019ad:	00 00 00 
+        struct Fd *fd = INDEX2FD(i);
+  8019b0:	49 89 dd             	mov    %rbx,%r13
+        if (!(get_prot(fd) & PROT_R)) {
+  8019b3:	48 89 df             	mov    %rbx,%rdi
+  8019b6:	41 ff d6             	call   *%r14
+  8019b9:	83 e0 04             	and    $0x4,%eax
+  8019bc:	74 1c                	je     8019da <fd_alloc_from+0x67>
+    for (int i = MAX(fdnum, 0); i < MAXFD; i++) {
+  8019be:	41 83 c4 01          	add    $0x1,%r12d
+  8019c2:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8019c9:	41 83 fc 1f          	cmp    $0x1f,%r12d
+  8019cd:	7e e1                	jle    8019b0 <fd_alloc_from+0x3d>
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  8019cf:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  8019d5:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  8019da:	4d 89 2f             	mov    %r13,(%r15)
+}
+  8019dd:	48 83 c4 08          	add    $0x8,%rsp
+  8019e1:	5b                   	pop    %rbx
+  8019e2:	41 5c                	pop    %r12
+  8019e4:	41 5d                	pop    %r13
+  8019e6:	41 5e                	pop    %r14
+  8019e8:	41 5f                	pop    %r15
+  8019ea:	5d                   	pop    %rbp
+  8019eb:	c3                   	ret
+
+00000000008019ec <fd_alloc>:
+fd_alloc(struct Fd **fd_store) {
+  8019ec:	55                   	push   %rbp
+  8019ed:	48 89 e5             	mov    %rsp,%rbp
+  8019f0:	48 89 fe             	mov    %rdi,%rsi
+    return fd_alloc_from(0, fd_store);
+  8019f3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8019f8:	48 b8 73 19 80 00 00 	movabs $0x801973,%rax
+  8019ff:	00 00 00 
+  801a02:	ff d0                	call   *%rax
+}
+  801a04:	5d                   	pop    %rbp
+  801a05:	c3                   	ret
+
+0000000000801a06 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  801a06:	83 ff 1f             	cmp    $0x1f,%edi
+  801a09:	77 39                	ja     801a44 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  801a0b:	55                   	push   %rbp
+  801a0c:	48 89 e5             	mov    %rsp,%rbp
+  801a0f:	41 54                	push   %r12
+  801a11:	53                   	push   %rbx
+  801a12:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  801a15:	48 63 df             	movslq %edi,%rbx
+  801a18:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  801a1f:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  801a23:	48 89 df             	mov    %rbx,%rdi
+  801a26:	48 b8 7c 2a 80 00 00 	movabs $0x802a7c,%rax
+  801a2d:	00 00 00 
+  801a30:	ff d0                	call   *%rax
+  801a32:	a8 04                	test   $0x4,%al
+  801a34:	74 14                	je     801a4a <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  801a36:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  801a3a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801a3f:	5b                   	pop    %rbx
+  801a40:	41 5c                	pop    %r12
+  801a42:	5d                   	pop    %rbp
+  801a43:	c3                   	ret
+        return -E_INVAL;
+  801a44:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801a49:	c3                   	ret
+        return -E_INVAL;
+  801a4a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801a4f:	eb ee                	jmp    801a3f <fd_lookup+0x39>
+
+0000000000801a51 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  801a51:	55                   	push   %rbp
+  801a52:	48 89 e5             	mov    %rsp,%rbp
+  801a55:	41 54                	push   %r12
+  801a57:	53                   	push   %rbx
+  801a58:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  801a5b:	48 b8 00 36 80 00 00 	movabs $0x803600,%rax
+  801a62:	00 00 00 
+  801a65:	48 bb 20 40 80 00 00 	movabs $0x804020,%rbx
+  801a6c:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  801a6f:	39 3b                	cmp    %edi,(%rbx)
+  801a71:	74 47                	je     801aba <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  801a73:	48 83 c0 08          	add    $0x8,%rax
+  801a77:	48 8b 18             	mov    (%rax),%rbx
+  801a7a:	48 85 db             	test   %rbx,%rbx
+  801a7d:	75 f0                	jne    801a6f <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801a7f:	48 a1 08 50 80 00 00 	movabs 0x805008,%rax
+  801a86:	00 00 00 
+  801a89:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+  801a8f:	89 fa                	mov    %edi,%edx
+  801a91:	48 bf 80 35 80 00 00 	movabs $0x803580,%rdi
+  801a98:	00 00 00 
+  801a9b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801aa0:	48 b9 09 03 80 00 00 	movabs $0x800309,%rcx
+  801aa7:	00 00 00 
+  801aaa:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  801aac:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  801ab1:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  801ab5:	5b                   	pop    %rbx
+  801ab6:	41 5c                	pop    %r12
+  801ab8:	5d                   	pop    %rbp
+  801ab9:	c3                   	ret
+            return 0;
+  801aba:	b8 00 00 00 00       	mov    $0x0,%eax
+  801abf:	eb f0                	jmp    801ab1 <dev_lookup+0x60>
+
+0000000000801ac1 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  801ac1:	55                   	push   %rbp
+  801ac2:	48 89 e5             	mov    %rsp,%rbp
+  801ac5:	41 55                	push   %r13
+  801ac7:	41 54                	push   %r12
+  801ac9:	53                   	push   %rbx
+  801aca:	48 83 ec 18          	sub    $0x18,%rsp
+  801ace:	48 89 fb             	mov    %rdi,%rbx
+  801ad1:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801ad4:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  801adb:	ff ff ff 
+  801ade:	48 01 df             	add    %rbx,%rdi
+  801ae1:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  801ae5:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801ae9:	48 b8 06 1a 80 00 00 	movabs $0x801a06,%rax
+  801af0:	00 00 00 
+  801af3:	ff d0                	call   *%rax
+  801af5:	41 89 c5             	mov    %eax,%r13d
+  801af8:	85 c0                	test   %eax,%eax
+  801afa:	78 06                	js     801b02 <fd_close+0x41>
+  801afc:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  801b00:	74 1a                	je     801b1c <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  801b02:	45 84 e4             	test   %r12b,%r12b
+  801b05:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b0a:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  801b0e:	44 89 e8             	mov    %r13d,%eax
+  801b11:	48 83 c4 18          	add    $0x18,%rsp
+  801b15:	5b                   	pop    %rbx
+  801b16:	41 5c                	pop    %r12
+  801b18:	41 5d                	pop    %r13
+  801b1a:	5d                   	pop    %rbp
+  801b1b:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801b1c:	8b 3b                	mov    (%rbx),%edi
+  801b1e:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801b22:	48 b8 51 1a 80 00 00 	movabs $0x801a51,%rax
+  801b29:	00 00 00 
+  801b2c:	ff d0                	call   *%rax
+  801b2e:	41 89 c5             	mov    %eax,%r13d
+  801b31:	85 c0                	test   %eax,%eax
+  801b33:	78 1b                	js     801b50 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  801b35:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801b39:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801b3d:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801b43:	48 85 c0             	test   %rax,%rax
+  801b46:	74 08                	je     801b50 <fd_close+0x8f>
+  801b48:	48 89 df             	mov    %rbx,%rdi
+  801b4b:	ff d0                	call   *%rax
+  801b4d:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801b50:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801b55:	48 89 de             	mov    %rbx,%rsi
+  801b58:	bf 00 00 00 00       	mov    $0x0,%edi
+  801b5d:	48 b8 aa 12 80 00 00 	movabs $0x8012aa,%rax
+  801b64:	00 00 00 
+  801b67:	ff d0                	call   *%rax
+    return res;
+  801b69:	eb a3                	jmp    801b0e <fd_close+0x4d>
+
+0000000000801b6b <close>:
+
+int
+close(int fdnum) {
+  801b6b:	55                   	push   %rbp
+  801b6c:	48 89 e5             	mov    %rsp,%rbp
+  801b6f:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  801b73:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801b77:	48 b8 06 1a 80 00 00 	movabs $0x801a06,%rax
+  801b7e:	00 00 00 
+  801b81:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801b83:	85 c0                	test   %eax,%eax
+  801b85:	78 15                	js     801b9c <close+0x31>
+
+    return fd_close(fd, 1);
+  801b87:	be 01 00 00 00       	mov    $0x1,%esi
+  801b8c:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801b90:	48 b8 c1 1a 80 00 00 	movabs $0x801ac1,%rax
+  801b97:	00 00 00 
+  801b9a:	ff d0                	call   *%rax
+}
+  801b9c:	c9                   	leave
+  801b9d:	c3                   	ret
+
+0000000000801b9e <close_all>:
+
+void
+close_all(void) {
+  801b9e:	55                   	push   %rbp
+  801b9f:	48 89 e5             	mov    %rsp,%rbp
+  801ba2:	41 54                	push   %r12
+  801ba4:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  801ba5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801baa:	49 bc 6b 1b 80 00 00 	movabs $0x801b6b,%r12
+  801bb1:	00 00 00 
+  801bb4:	89 df                	mov    %ebx,%edi
+  801bb6:	41 ff d4             	call   *%r12
+  801bb9:	83 c3 01             	add    $0x1,%ebx
+  801bbc:	83 fb 20             	cmp    $0x20,%ebx
+  801bbf:	75 f3                	jne    801bb4 <close_all+0x16>
+}
+  801bc1:	5b                   	pop    %rbx
+  801bc2:	41 5c                	pop    %r12
+  801bc4:	5d                   	pop    %rbp
+  801bc5:	c3                   	ret
+
+0000000000801bc6 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  801bc6:	55                   	push   %rbp
+  801bc7:	48 89 e5             	mov    %rsp,%rbp
+  801bca:	41 57                	push   %r15
+  801bcc:	41 56                	push   %r14
+  801bce:	41 55                	push   %r13
+  801bd0:	41 54                	push   %r12
+  801bd2:	53                   	push   %rbx
+  801bd3:	48 83 ec 18          	sub    $0x18,%rsp
+  801bd7:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  801bda:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801bde:	48 b8 06 1a 80 00 00 	movabs $0x801a06,%rax
+  801be5:	00 00 00 
+  801be8:	ff d0                	call   *%rax
+  801bea:	89 c3                	mov    %eax,%ebx
+  801bec:	85 c0                	test   %eax,%eax
+  801bee:	0f 88 b8 00 00 00    	js     801cac <dup+0xe6>
+    close(newfdnum);
+  801bf4:	44 89 e7             	mov    %r12d,%edi
+  801bf7:	48 b8 6b 1b 80 00 00 	movabs $0x801b6b,%rax
+  801bfe:	00 00 00 
+  801c01:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  801c03:	4d 63 ec             	movslq %r12d,%r13
+  801c06:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  801c0d:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  801c11:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  801c15:	4c 89 ff             	mov    %r15,%rdi
+  801c18:	49 be 57 19 80 00 00 	movabs $0x801957,%r14
+  801c1f:	00 00 00 
+  801c22:	41 ff d6             	call   *%r14
+  801c25:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  801c28:	4c 89 ef             	mov    %r13,%rdi
+  801c2b:	41 ff d6             	call   *%r14
+  801c2e:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  801c31:	48 89 df             	mov    %rbx,%rdi
+  801c34:	48 b8 7c 2a 80 00 00 	movabs $0x802a7c,%rax
+  801c3b:	00 00 00 
+  801c3e:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  801c40:	a8 04                	test   $0x4,%al
+  801c42:	74 2b                	je     801c6f <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  801c44:	41 89 c1             	mov    %eax,%r9d
+  801c47:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801c4d:	4c 89 f1             	mov    %r14,%rcx
+  801c50:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c55:	48 89 de             	mov    %rbx,%rsi
+  801c58:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c5d:	48 b8 45 12 80 00 00 	movabs $0x801245,%rax
+  801c64:	00 00 00 
+  801c67:	ff d0                	call   *%rax
+  801c69:	89 c3                	mov    %eax,%ebx
+  801c6b:	85 c0                	test   %eax,%eax
+  801c6d:	78 4e                	js     801cbd <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  801c6f:	4c 89 ff             	mov    %r15,%rdi
+  801c72:	48 b8 7c 2a 80 00 00 	movabs $0x802a7c,%rax
+  801c79:	00 00 00 
+  801c7c:	ff d0                	call   *%rax
+  801c7e:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801c81:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801c87:	4c 89 e9             	mov    %r13,%rcx
+  801c8a:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c8f:	4c 89 fe             	mov    %r15,%rsi
+  801c92:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c97:	48 b8 45 12 80 00 00 	movabs $0x801245,%rax
+  801c9e:	00 00 00 
+  801ca1:	ff d0                	call   *%rax
+  801ca3:	89 c3                	mov    %eax,%ebx
+  801ca5:	85 c0                	test   %eax,%eax
+  801ca7:	78 14                	js     801cbd <dup+0xf7>
+
+    return newfdnum;
+  801ca9:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  801cac:	89 d8                	mov    %ebx,%eax
+  801cae:	48 83 c4 18          	add    $0x18,%rsp
+  801cb2:	5b                   	pop    %rbx
+  801cb3:	41 5c                	pop    %r12
+  801cb5:	41 5d                	pop    %r13
+  801cb7:	41 5e                	pop    %r14
+  801cb9:	41 5f                	pop    %r15
+  801cbb:	5d                   	pop    %rbp
+  801cbc:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  801cbd:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801cc2:	4c 89 ee             	mov    %r13,%rsi
+  801cc5:	bf 00 00 00 00       	mov    $0x0,%edi
+  801cca:	49 bc aa 12 80 00 00 	movabs $0x8012aa,%r12
+  801cd1:	00 00 00 
+  801cd4:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  801cd7:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801cdc:	4c 89 f6             	mov    %r14,%rsi
+  801cdf:	bf 00 00 00 00       	mov    $0x0,%edi
+  801ce4:	41 ff d4             	call   *%r12
+    return res;
+  801ce7:	eb c3                	jmp    801cac <dup+0xe6>
+
+0000000000801ce9 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  801ce9:	55                   	push   %rbp
+  801cea:	48 89 e5             	mov    %rsp,%rbp
+  801ced:	41 56                	push   %r14
+  801cef:	41 55                	push   %r13
+  801cf1:	41 54                	push   %r12
+  801cf3:	53                   	push   %rbx
+  801cf4:	48 83 ec 10          	sub    $0x10,%rsp
+  801cf8:	89 fb                	mov    %edi,%ebx
+  801cfa:	49 89 f4             	mov    %rsi,%r12
+  801cfd:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801d00:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801d04:	48 b8 06 1a 80 00 00 	movabs $0x801a06,%rax
+  801d0b:	00 00 00 
+  801d0e:	ff d0                	call   *%rax
+  801d10:	85 c0                	test   %eax,%eax
+  801d12:	78 4c                	js     801d60 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801d14:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801d18:	41 8b 3e             	mov    (%r14),%edi
+  801d1b:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801d1f:	48 b8 51 1a 80 00 00 	movabs $0x801a51,%rax
+  801d26:	00 00 00 
+  801d29:	ff d0                	call   *%rax
+  801d2b:	85 c0                	test   %eax,%eax
+  801d2d:	78 35                	js     801d64 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801d2f:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801d33:	83 e0 03             	and    $0x3,%eax
+  801d36:	83 f8 01             	cmp    $0x1,%eax
+  801d39:	74 2d                	je     801d68 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801d3b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801d3f:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801d43:	48 85 c0             	test   %rax,%rax
+  801d46:	74 56                	je     801d9e <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  801d48:	4c 89 ea             	mov    %r13,%rdx
+  801d4b:	4c 89 e6             	mov    %r12,%rsi
+  801d4e:	4c 89 f7             	mov    %r14,%rdi
+  801d51:	ff d0                	call   *%rax
+}
+  801d53:	48 83 c4 10          	add    $0x10,%rsp
+  801d57:	5b                   	pop    %rbx
+  801d58:	41 5c                	pop    %r12
+  801d5a:	41 5d                	pop    %r13
+  801d5c:	41 5e                	pop    %r14
+  801d5e:	5d                   	pop    %rbp
+  801d5f:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801d60:	48 98                	cltq
+  801d62:	eb ef                	jmp    801d53 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801d64:	48 98                	cltq
+  801d66:	eb eb                	jmp    801d53 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801d68:	48 a1 08 50 80 00 00 	movabs 0x805008,%rax
+  801d6f:	00 00 00 
+  801d72:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+  801d78:	89 da                	mov    %ebx,%edx
+  801d7a:	48 bf c1 35 80 00 00 	movabs $0x8035c1,%rdi
+  801d81:	00 00 00 
+  801d84:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d89:	48 b9 09 03 80 00 00 	movabs $0x800309,%rcx
+  801d90:	00 00 00 
+  801d93:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801d95:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801d9c:	eb b5                	jmp    801d53 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801d9e:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801da5:	eb ac                	jmp    801d53 <read+0x6a>
+
+0000000000801da7 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801da7:	55                   	push   %rbp
+  801da8:	48 89 e5             	mov    %rsp,%rbp
+  801dab:	41 57                	push   %r15
+  801dad:	41 56                	push   %r14
+  801daf:	41 55                	push   %r13
+  801db1:	41 54                	push   %r12
+  801db3:	53                   	push   %rbx
+  801db4:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  801db8:	48 85 d2             	test   %rdx,%rdx
+  801dbb:	74 54                	je     801e11 <readn+0x6a>
+  801dbd:	41 89 fd             	mov    %edi,%r13d
+  801dc0:	49 89 f6             	mov    %rsi,%r14
+  801dc3:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  801dc6:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  801dcb:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  801dd0:	49 bf e9 1c 80 00 00 	movabs $0x801ce9,%r15
+  801dd7:	00 00 00 
+  801dda:	4c 89 e2             	mov    %r12,%rdx
+  801ddd:	48 29 f2             	sub    %rsi,%rdx
+  801de0:	4c 01 f6             	add    %r14,%rsi
+  801de3:	44 89 ef             	mov    %r13d,%edi
+  801de6:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  801de9:	85 c0                	test   %eax,%eax
+  801deb:	78 20                	js     801e0d <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  801ded:	01 c3                	add    %eax,%ebx
+  801def:	85 c0                	test   %eax,%eax
+  801df1:	74 08                	je     801dfb <readn+0x54>
+  801df3:	48 63 f3             	movslq %ebx,%rsi
+  801df6:	4c 39 e6             	cmp    %r12,%rsi
+  801df9:	72 df                	jb     801dda <readn+0x33>
+    }
+    return res;
+  801dfb:	48 63 c3             	movslq %ebx,%rax
+}
+  801dfe:	48 83 c4 08          	add    $0x8,%rsp
+  801e02:	5b                   	pop    %rbx
+  801e03:	41 5c                	pop    %r12
+  801e05:	41 5d                	pop    %r13
+  801e07:	41 5e                	pop    %r14
+  801e09:	41 5f                	pop    %r15
+  801e0b:	5d                   	pop    %rbp
+  801e0c:	c3                   	ret
+        if (inc < 0) return inc;
+  801e0d:	48 98                	cltq
+  801e0f:	eb ed                	jmp    801dfe <readn+0x57>
+    int inc = 1, res = 0;
+  801e11:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801e16:	eb e3                	jmp    801dfb <readn+0x54>
+
+0000000000801e18 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  801e18:	55                   	push   %rbp
+  801e19:	48 89 e5             	mov    %rsp,%rbp
+  801e1c:	41 56                	push   %r14
+  801e1e:	41 55                	push   %r13
+  801e20:	41 54                	push   %r12
+  801e22:	53                   	push   %rbx
+  801e23:	48 83 ec 10          	sub    $0x10,%rsp
+  801e27:	89 fb                	mov    %edi,%ebx
+  801e29:	49 89 f4             	mov    %rsi,%r12
+  801e2c:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801e2f:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801e33:	48 b8 06 1a 80 00 00 	movabs $0x801a06,%rax
+  801e3a:	00 00 00 
+  801e3d:	ff d0                	call   *%rax
+  801e3f:	85 c0                	test   %eax,%eax
+  801e41:	78 47                	js     801e8a <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801e43:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801e47:	41 8b 3e             	mov    (%r14),%edi
+  801e4a:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801e4e:	48 b8 51 1a 80 00 00 	movabs $0x801a51,%rax
+  801e55:	00 00 00 
+  801e58:	ff d0                	call   *%rax
+  801e5a:	85 c0                	test   %eax,%eax
+  801e5c:	78 30                	js     801e8e <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801e5e:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  801e63:	74 2d                	je     801e92 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801e65:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801e69:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801e6d:	48 85 c0             	test   %rax,%rax
+  801e70:	74 56                	je     801ec8 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  801e72:	4c 89 ea             	mov    %r13,%rdx
+  801e75:	4c 89 e6             	mov    %r12,%rsi
+  801e78:	4c 89 f7             	mov    %r14,%rdi
+  801e7b:	ff d0                	call   *%rax
+}
+  801e7d:	48 83 c4 10          	add    $0x10,%rsp
+  801e81:	5b                   	pop    %rbx
+  801e82:	41 5c                	pop    %r12
+  801e84:	41 5d                	pop    %r13
+  801e86:	41 5e                	pop    %r14
+  801e88:	5d                   	pop    %rbp
+  801e89:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801e8a:	48 98                	cltq
+  801e8c:	eb ef                	jmp    801e7d <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801e8e:	48 98                	cltq
+  801e90:	eb eb                	jmp    801e7d <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801e92:	48 a1 08 50 80 00 00 	movabs 0x805008,%rax
+  801e99:	00 00 00 
+  801e9c:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+  801ea2:	89 da                	mov    %ebx,%edx
+  801ea4:	48 bf dd 35 80 00 00 	movabs $0x8035dd,%rdi
+  801eab:	00 00 00 
+  801eae:	b8 00 00 00 00       	mov    $0x0,%eax
+  801eb3:	48 b9 09 03 80 00 00 	movabs $0x800309,%rcx
+  801eba:	00 00 00 
+  801ebd:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801ebf:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801ec6:	eb b5                	jmp    801e7d <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801ec8:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801ecf:	eb ac                	jmp    801e7d <write+0x65>
+
+0000000000801ed1 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  801ed1:	55                   	push   %rbp
+  801ed2:	48 89 e5             	mov    %rsp,%rbp
+  801ed5:	53                   	push   %rbx
+  801ed6:	48 83 ec 18          	sub    $0x18,%rsp
+  801eda:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801edc:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801ee0:	48 b8 06 1a 80 00 00 	movabs $0x801a06,%rax
+  801ee7:	00 00 00 
+  801eea:	ff d0                	call   *%rax
+  801eec:	85 c0                	test   %eax,%eax
+  801eee:	78 0c                	js     801efc <seek+0x2b>
+
+    fd->fd_offset = offset;
+  801ef0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801ef4:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  801ef7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801efc:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801f00:	c9                   	leave
+  801f01:	c3                   	ret
+
+0000000000801f02 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  801f02:	55                   	push   %rbp
+  801f03:	48 89 e5             	mov    %rsp,%rbp
+  801f06:	41 55                	push   %r13
+  801f08:	41 54                	push   %r12
+  801f0a:	53                   	push   %rbx
+  801f0b:	48 83 ec 18          	sub    $0x18,%rsp
+  801f0f:	89 fb                	mov    %edi,%ebx
+  801f11:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801f14:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801f18:	48 b8 06 1a 80 00 00 	movabs $0x801a06,%rax
+  801f1f:	00 00 00 
+  801f22:	ff d0                	call   *%rax
+  801f24:	85 c0                	test   %eax,%eax
+  801f26:	78 38                	js     801f60 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801f28:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  801f2c:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  801f30:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801f34:	48 b8 51 1a 80 00 00 	movabs $0x801a51,%rax
+  801f3b:	00 00 00 
+  801f3e:	ff d0                	call   *%rax
+  801f40:	85 c0                	test   %eax,%eax
+  801f42:	78 1c                	js     801f60 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801f44:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  801f49:	74 20                	je     801f6b <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801f4b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801f4f:	48 8b 40 30          	mov    0x30(%rax),%rax
+  801f53:	48 85 c0             	test   %rax,%rax
+  801f56:	74 47                	je     801f9f <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  801f58:	44 89 e6             	mov    %r12d,%esi
+  801f5b:	4c 89 ef             	mov    %r13,%rdi
+  801f5e:	ff d0                	call   *%rax
+}
+  801f60:	48 83 c4 18          	add    $0x18,%rsp
+  801f64:	5b                   	pop    %rbx
+  801f65:	41 5c                	pop    %r12
+  801f67:	41 5d                	pop    %r13
+  801f69:	5d                   	pop    %rbp
+  801f6a:	c3                   	ret
+                thisenv->env_id, fdnum);
+  801f6b:	48 a1 08 50 80 00 00 	movabs 0x805008,%rax
+  801f72:	00 00 00 
+  801f75:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801f7b:	89 da                	mov    %ebx,%edx
+  801f7d:	48 bf a0 35 80 00 00 	movabs $0x8035a0,%rdi
+  801f84:	00 00 00 
+  801f87:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f8c:	48 b9 09 03 80 00 00 	movabs $0x800309,%rcx
+  801f93:	00 00 00 
+  801f96:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801f98:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801f9d:	eb c1                	jmp    801f60 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801f9f:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801fa4:	eb ba                	jmp    801f60 <ftruncate+0x5e>
+
+0000000000801fa6 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  801fa6:	55                   	push   %rbp
+  801fa7:	48 89 e5             	mov    %rsp,%rbp
+  801faa:	41 54                	push   %r12
+  801fac:	53                   	push   %rbx
+  801fad:	48 83 ec 10          	sub    $0x10,%rsp
+  801fb1:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801fb4:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801fb8:	48 b8 06 1a 80 00 00 	movabs $0x801a06,%rax
+  801fbf:	00 00 00 
+  801fc2:	ff d0                	call   *%rax
+  801fc4:	85 c0                	test   %eax,%eax
+  801fc6:	78 4e                	js     802016 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801fc8:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801fcc:	41 8b 3c 24          	mov    (%r12),%edi
+  801fd0:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801fd4:	48 b8 51 1a 80 00 00 	movabs $0x801a51,%rax
+  801fdb:	00 00 00 
+  801fde:	ff d0                	call   *%rax
+  801fe0:	85 c0                	test   %eax,%eax
+  801fe2:	78 32                	js     802016 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801fe4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801fe8:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  801fed:	74 30                	je     80201f <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  801fef:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  801ff2:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  801ff9:	00 00 00 
+    stat->st_isdir = 0;
+  801ffc:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  802003:	00 00 00 
+    stat->st_dev = dev;
+  802006:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  80200d:	48 89 de             	mov    %rbx,%rsi
+  802010:	4c 89 e7             	mov    %r12,%rdi
+  802013:	ff 50 28             	call   *0x28(%rax)
+}
+  802016:	48 83 c4 10          	add    $0x10,%rsp
+  80201a:	5b                   	pop    %rbx
+  80201b:	41 5c                	pop    %r12
+  80201d:	5d                   	pop    %rbp
+  80201e:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  80201f:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802024:	eb f0                	jmp    802016 <fstat+0x70>
+
+0000000000802026 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  802026:	55                   	push   %rbp
+  802027:	48 89 e5             	mov    %rsp,%rbp
+  80202a:	41 54                	push   %r12
+  80202c:	53                   	push   %rbx
+  80202d:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  802030:	be 00 00 00 00       	mov    $0x0,%esi
+  802035:	48 b8 09 24 80 00 00 	movabs $0x802409,%rax
+  80203c:	00 00 00 
+  80203f:	ff d0                	call   *%rax
+  802041:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  802043:	85 c0                	test   %eax,%eax
+  802045:	78 25                	js     80206c <stat+0x46>
+
+    int res = fstat(fd, stat);
+  802047:	4c 89 e6             	mov    %r12,%rsi
+  80204a:	89 c7                	mov    %eax,%edi
+  80204c:	48 b8 a6 1f 80 00 00 	movabs $0x801fa6,%rax
+  802053:	00 00 00 
+  802056:	ff d0                	call   *%rax
+  802058:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  80205b:	89 df                	mov    %ebx,%edi
+  80205d:	48 b8 6b 1b 80 00 00 	movabs $0x801b6b,%rax
+  802064:	00 00 00 
+  802067:	ff d0                	call   *%rax
+
+    return res;
+  802069:	44 89 e3             	mov    %r12d,%ebx
+}
+  80206c:	89 d8                	mov    %ebx,%eax
+  80206e:	5b                   	pop    %rbx
+  80206f:	41 5c                	pop    %r12
+  802071:	5d                   	pop    %rbp
+  802072:	c3                   	ret
+
+0000000000802073 <fsipc>:
+ * response may be written back to fsipcbuf.
+ * type: request code, passed as the simple integer IPC value.
+ * dstva: virtual address at which to receive reply page, 0 if none.
+ * Returns result from the file server. */
+static int
+fsipc(unsigned type, void *dstva) {
+  802073:	55                   	push   %rbp
+  802074:	48 89 e5             	mov    %rsp,%rbp
+  802077:	41 54                	push   %r12
+  802079:	53                   	push   %rbx
+  80207a:	48 83 ec 10          	sub    $0x10,%rsp
+  80207e:	41 89 fc             	mov    %edi,%r12d
+  802081:	48 89 f3             	mov    %rsi,%rbx
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802084:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  80208b:	00 00 00 
+  80208e:	83 38 00             	cmpl   $0x0,(%rax)
+  802091:	74 5e                	je     8020f1 <fsipc+0x7e>
+    if (debug) {
+        cprintf("[%08x] fsipc %d %08x\n",
+                thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+    }
+
+    ipc_send(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW);
+  802093:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802099:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80209e:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  8020a5:	00 00 00 
+  8020a8:	44 89 e6             	mov    %r12d,%esi
+  8020ab:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  8020b2:	00 00 00 
+  8020b5:	8b 38                	mov    (%rax),%edi
+  8020b7:	48 b8 52 18 80 00 00 	movabs $0x801852,%rax
+  8020be:	00 00 00 
+  8020c1:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  8020c3:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  8020ca:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  8020cb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8020d0:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  8020d4:	48 89 de             	mov    %rbx,%rsi
+  8020d7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8020dc:	48 b8 7d 17 80 00 00 	movabs $0x80177d,%rax
+  8020e3:	00 00 00 
+  8020e6:	ff d0                	call   *%rax
+}
+  8020e8:	48 83 c4 10          	add    $0x10,%rsp
+  8020ec:	5b                   	pop    %rbx
+  8020ed:	41 5c                	pop    %r12
+  8020ef:	5d                   	pop    %rbp
+  8020f0:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8020f1:	bf 03 00 00 00       	mov    $0x3,%edi
+  8020f6:	48 b8 f5 18 80 00 00 	movabs $0x8018f5,%rax
+  8020fd:	00 00 00 
+  802100:	ff d0                	call   *%rax
+  802102:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  802109:	00 00 
+  80210b:	eb 86                	jmp    802093 <fsipc+0x20>
+
+000000000080210d <devfile_trunc>:
+    return 0;
+}
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  80210d:	55                   	push   %rbp
+  80210e:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802111:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  802118:	00 00 00 
+  80211b:	8b 57 0c             	mov    0xc(%rdi),%edx
+  80211e:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  802120:	89 70 04             	mov    %esi,0x4(%rax)
+
+    return fsipc(FSREQ_SET_SIZE, NULL);
+  802123:	be 00 00 00 00       	mov    $0x0,%esi
+  802128:	bf 02 00 00 00       	mov    $0x2,%edi
+  80212d:	48 b8 73 20 80 00 00 	movabs $0x802073,%rax
+  802134:	00 00 00 
+  802137:	ff d0                	call   *%rax
+}
+  802139:	5d                   	pop    %rbp
+  80213a:	c3                   	ret
+
+000000000080213b <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  80213b:	55                   	push   %rbp
+  80213c:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  80213f:	8b 47 0c             	mov    0xc(%rdi),%eax
+  802142:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  802149:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  80214b:	be 00 00 00 00       	mov    $0x0,%esi
+  802150:	bf 06 00 00 00       	mov    $0x6,%edi
+  802155:	48 b8 73 20 80 00 00 	movabs $0x802073,%rax
+  80215c:	00 00 00 
+  80215f:	ff d0                	call   *%rax
+}
+  802161:	5d                   	pop    %rbp
+  802162:	c3                   	ret
+
+0000000000802163 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  802163:	55                   	push   %rbp
+  802164:	48 89 e5             	mov    %rsp,%rbp
+  802167:	41 54                	push   %r12
+  802169:	53                   	push   %rbx
+  80216a:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  80216d:	8b 47 0c             	mov    0xc(%rdi),%eax
+  802170:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  802177:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  802179:	be 00 00 00 00       	mov    $0x0,%esi
+  80217e:	bf 05 00 00 00       	mov    $0x5,%edi
+  802183:	48 b8 73 20 80 00 00 	movabs $0x802073,%rax
+  80218a:	00 00 00 
+  80218d:	ff d0                	call   *%rax
+    if (res < 0) {
+  80218f:	85 c0                	test   %eax,%eax
+  802191:	78 3d                	js     8021d0 <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802193:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  80219a:	00 00 00 
+  80219d:	4c 89 e6             	mov    %r12,%rsi
+  8021a0:	48 89 df             	mov    %rbx,%rdi
+  8021a3:	48 b8 2e 0c 80 00 00 	movabs $0x800c2e,%rax
+  8021aa:	00 00 00 
+  8021ad:	ff d0                	call   *%rax
+    st->st_size  = fsipcbuf.statRet.ret_size;
+  8021af:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  8021b6:	00 
+  8021b7:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8021bd:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  8021c4:	00 
+  8021c5:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  8021cb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8021d0:	5b                   	pop    %rbx
+  8021d1:	41 5c                	pop    %r12
+  8021d3:	5d                   	pop    %rbp
+  8021d4:	c3                   	ret
+
+00000000008021d5 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  8021d5:	55                   	push   %rbp
+  8021d6:	48 89 e5             	mov    %rsp,%rbp
+  8021d9:	41 57                	push   %r15
+  8021db:	41 56                	push   %r14
+  8021dd:	41 55                	push   %r13
+  8021df:	41 54                	push   %r12
+  8021e1:	53                   	push   %rbx
+  8021e2:	48 83 ec 18          	sub    $0x18,%rsp
+  8021e6:	49 89 fe             	mov    %rdi,%r14
+  8021e9:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+  8021ed:	48 89 d3             	mov    %rdx,%rbx
+    while (n > sizeof(fsipcbuf.write.req_buf))
+  8021f0:	48 81 fa f0 0f 00 00 	cmp    $0xff0,%rdx
+  8021f7:	0f 86 e4 00 00 00    	jbe    8022e1 <devfile_write+0x10c>
+  8021fd:	49 89 f4             	mov    %rsi,%r12
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802200:	49 bd 00 60 80 00 00 	movabs $0x806000,%r13
+  802207:	00 00 00 
+        memcpy(fsipcbuf.write.req_buf, buf, sizeof(fsipcbuf.write.req_buf));
+  80220a:	49 bf 8f 0e 80 00 00 	movabs $0x800e8f,%r15
+  802211:	00 00 00 
+  802214:	eb 03                	jmp    802219 <devfile_write+0x44>
+        buf += sizeof(fsipcbuf.write.req_buf);
+  802216:	49 89 f4             	mov    %rsi,%r12
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802219:	41 8b 46 0c          	mov    0xc(%r14),%eax
+  80221d:	41 89 45 00          	mov    %eax,0x0(%r13)
+        fsipcbuf.write.req_n      = sizeof(fsipcbuf.write.req_buf);
+  802221:	49 c7 45 08 f0 0f 00 	movq   $0xff0,0x8(%r13)
+  802228:	00 
+        memcpy(fsipcbuf.write.req_buf, buf, sizeof(fsipcbuf.write.req_buf));
+  802229:	ba f0 0f 00 00       	mov    $0xff0,%edx
+  80222e:	4c 89 e6             	mov    %r12,%rsi
+  802231:	48 bf 10 60 80 00 00 	movabs $0x806010,%rdi
+  802238:	00 00 00 
+  80223b:	41 ff d7             	call   *%r15
+        ssize_t res = fsipc(FSREQ_WRITE, NULL);
+  80223e:	be 00 00 00 00       	mov    $0x0,%esi
+  802243:	bf 04 00 00 00       	mov    $0x4,%edi
+  802248:	48 b8 73 20 80 00 00 	movabs $0x802073,%rax
+  80224f:	00 00 00 
+  802252:	ff d0                	call   *%rax
+  802254:	48 63 d0             	movslq %eax,%rdx
+        if (res < 0 || res < sizeof(fsipcbuf.write.req_buf))
+  802257:	3d ef 0f 00 00       	cmp    $0xfef,%eax
+  80225c:	7e 71                	jle    8022cf <devfile_write+0xfa>
+        buf += sizeof(fsipcbuf.write.req_buf);
+  80225e:	49 8d b4 24 f0 0f 00 	lea    0xff0(%r12),%rsi
+  802265:	00 
+        n -= sizeof(fsipcbuf.write.req_buf);
+  802266:	48 81 eb f0 0f 00 00 	sub    $0xff0,%rbx
+    while (n > sizeof(fsipcbuf.write.req_buf))
+  80226d:	48 81 fb f0 0f 00 00 	cmp    $0xff0,%rbx
+  802274:	77 a0                	ja     802216 <devfile_write+0x41>
+        written += sizeof(fsipcbuf.write.req_buf);
+  802276:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80227a:	49 29 c4             	sub    %rax,%r12
+  80227d:	4d 8d a4 24 f0 0f 00 	lea    0xff0(%r12),%r12
+  802284:	00 
+    fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802285:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  80228c:	00 00 00 
+  80228f:	41 8b 56 0c          	mov    0xc(%r14),%edx
+  802293:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.write.req_n      = n;
+  802295:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    memcpy(fsipcbuf.write.req_buf, buf, n);
+  802299:	48 89 da             	mov    %rbx,%rdx
+  80229c:	48 8d 78 10          	lea    0x10(%rax),%rdi
+  8022a0:	48 b8 8f 0e 80 00 00 	movabs $0x800e8f,%rax
+  8022a7:	00 00 00 
+  8022aa:	ff d0                	call   *%rax
+    ssize_t res = fsipc(FSREQ_WRITE, NULL);
+  8022ac:	be 00 00 00 00       	mov    $0x0,%esi
+  8022b1:	bf 04 00 00 00       	mov    $0x4,%edi
+  8022b6:	48 b8 73 20 80 00 00 	movabs $0x802073,%rax
+  8022bd:	00 00 00 
+  8022c0:	ff d0                	call   *%rax
+  8022c2:	48 63 d0             	movslq %eax,%rdx
+    written += res;
+  8022c5:	49 01 d4             	add    %rdx,%r12
+  8022c8:	48 85 d2             	test   %rdx,%rdx
+  8022cb:	49 0f 49 d4          	cmovns %r12,%rdx
+}
+  8022cf:	48 89 d0             	mov    %rdx,%rax
+  8022d2:	48 83 c4 18          	add    $0x18,%rsp
+  8022d6:	5b                   	pop    %rbx
+  8022d7:	41 5c                	pop    %r12
+  8022d9:	41 5d                	pop    %r13
+  8022db:	41 5e                	pop    %r14
+  8022dd:	41 5f                	pop    %r15
+  8022df:	5d                   	pop    %rbp
+  8022e0:	c3                   	ret
+    while (n > sizeof(fsipcbuf.write.req_buf))
+  8022e1:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+    ssize_t written = 0;
+  8022e5:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8022eb:	eb 98                	jmp    802285 <devfile_write+0xb0>
+
+00000000008022ed <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  8022ed:	55                   	push   %rbp
+  8022ee:	48 89 e5             	mov    %rsp,%rbp
+  8022f1:	41 57                	push   %r15
+  8022f3:	41 56                	push   %r14
+  8022f5:	41 55                	push   %r13
+  8022f7:	41 54                	push   %r12
+  8022f9:	53                   	push   %rbx
+  8022fa:	48 83 ec 18          	sub    $0x18,%rsp
+  8022fe:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  802302:	49 89 f6             	mov    %rsi,%r14
+  802305:	49 89 d4             	mov    %rdx,%r12
+    while (n > sizeof(fsipcbuf.readRet.ret_buf))
+  802308:	48 81 fa 00 10 00 00 	cmp    $0x1000,%rdx
+  80230f:	0f 86 ea 00 00 00    	jbe    8023ff <devfile_read+0x112>
+    ssize_t readsz = 0;
+  802315:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  80231c:	00 
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  80231d:	49 bf 00 60 80 00 00 	movabs $0x806000,%r15
+  802324:	00 00 00 
+  802327:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80232b:	8b 40 0c             	mov    0xc(%rax),%eax
+  80232e:	41 89 07             	mov    %eax,(%r15)
+        fsipcbuf.read.req_n = sizeof(fsipcbuf.readRet.ret_buf);
+  802331:	49 c7 47 08 00 10 00 	movq   $0x1000,0x8(%r15)
+  802338:	00 
+        ssize_t res = fsipc(FSREQ_READ, NULL);
+  802339:	be 00 00 00 00       	mov    $0x0,%esi
+  80233e:	bf 03 00 00 00       	mov    $0x3,%edi
+  802343:	48 b8 73 20 80 00 00 	movabs $0x802073,%rax
+  80234a:	00 00 00 
+  80234d:	ff d0                	call   *%rax
+  80234f:	4c 63 e8             	movslq %eax,%r13
+        if (res < 0)
+  802352:	4d 85 ed             	test   %r13,%r13
+  802355:	0f 88 92 00 00 00    	js     8023ed <devfile_read+0x100>
+        memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  80235b:	4c 89 ea             	mov    %r13,%rdx
+  80235e:	4c 89 fe             	mov    %r15,%rsi
+  802361:	4c 89 f7             	mov    %r14,%rdi
+  802364:	48 b8 8f 0e 80 00 00 	movabs $0x800e8f,%rax
+  80236b:	00 00 00 
+  80236e:	ff d0                	call   *%rax
+        if (res < sizeof(fsipcbuf.readRet.ret_buf))
+  802370:	49 81 fd ff 0f 00 00 	cmp    $0xfff,%r13
+  802377:	76 6d                	jbe    8023e6 <devfile_read+0xf9>
+        readsz += res;
+  802379:	4c 01 6d c0          	add    %r13,-0x40(%rbp)
+        buf += res;
+  80237d:	4d 01 ee             	add    %r13,%r14
+        n -= res;
+  802380:	4d 29 ec             	sub    %r13,%r12
+    while (n > sizeof(fsipcbuf.readRet.ret_buf))
+  802383:	49 81 fc 00 10 00 00 	cmp    $0x1000,%r12
+  80238a:	77 9b                	ja     802327 <devfile_read+0x3a>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  80238c:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  802393:	00 00 00 
+  802396:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  80239a:	8b 51 0c             	mov    0xc(%rcx),%edx
+  80239d:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.read.req_n = n;
+  80239f:	4c 89 60 08          	mov    %r12,0x8(%rax)
+    ssize_t res = fsipc(FSREQ_READ, NULL);
+  8023a3:	be 00 00 00 00       	mov    $0x0,%esi
+  8023a8:	bf 03 00 00 00       	mov    $0x3,%edi
+  8023ad:	48 b8 73 20 80 00 00 	movabs $0x802073,%rax
+  8023b4:	00 00 00 
+  8023b7:	ff d0                	call   *%rax
+  8023b9:	4c 63 e8             	movslq %eax,%r13
+    if (res < 0)
+  8023bc:	4d 85 ed             	test   %r13,%r13
+  8023bf:	78 2c                	js     8023ed <devfile_read+0x100>
+    memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  8023c1:	4c 89 ea             	mov    %r13,%rdx
+  8023c4:	48 be 00 60 80 00 00 	movabs $0x806000,%rsi
+  8023cb:	00 00 00 
+  8023ce:	4c 89 f7             	mov    %r14,%rdi
+  8023d1:	48 b8 8f 0e 80 00 00 	movabs $0x800e8f,%rax
+  8023d8:	00 00 00 
+  8023db:	ff d0                	call   *%rax
+    readsz += res;
+  8023dd:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8023e1:	49 01 c5             	add    %rax,%r13
+    return readsz;
+  8023e4:	eb 07                	jmp    8023ed <devfile_read+0x100>
+            return readsz + res;
+  8023e6:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8023ea:	49 01 c5             	add    %rax,%r13
+}
+  8023ed:	4c 89 e8             	mov    %r13,%rax
+  8023f0:	48 83 c4 18          	add    $0x18,%rsp
+  8023f4:	5b                   	pop    %rbx
+  8023f5:	41 5c                	pop    %r12
+  8023f7:	41 5d                	pop    %r13
+  8023f9:	41 5e                	pop    %r14
+  8023fb:	41 5f                	pop    %r15
+  8023fd:	5d                   	pop    %rbp
+  8023fe:	c3                   	ret
+    ssize_t readsz = 0;
+  8023ff:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  802406:	00 
+  802407:	eb 83                	jmp    80238c <devfile_read+0x9f>
+
+0000000000802409 <open>:
+open(const char *path, int mode) {
+  802409:	55                   	push   %rbp
+  80240a:	48 89 e5             	mov    %rsp,%rbp
+  80240d:	41 55                	push   %r13
+  80240f:	41 54                	push   %r12
+  802411:	53                   	push   %rbx
+  802412:	48 83 ec 18          	sub    $0x18,%rsp
+  802416:	49 89 fc             	mov    %rdi,%r12
+  802419:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  80241c:	48 b8 f0 0b 80 00 00 	movabs $0x800bf0,%rax
+  802423:	00 00 00 
+  802426:	ff d0                	call   *%rax
+  802428:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  80242e:	0f 87 8a 00 00 00    	ja     8024be <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802434:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802438:	48 b8 ec 19 80 00 00 	movabs $0x8019ec,%rax
+  80243f:	00 00 00 
+  802442:	ff d0                	call   *%rax
+  802444:	89 c3                	mov    %eax,%ebx
+  802446:	85 c0                	test   %eax,%eax
+  802448:	78 50                	js     80249a <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  80244a:	4c 89 e6             	mov    %r12,%rsi
+  80244d:	48 bb 00 60 80 00 00 	movabs $0x806000,%rbx
+  802454:	00 00 00 
+  802457:	48 89 df             	mov    %rbx,%rdi
+  80245a:	48 b8 2e 0c 80 00 00 	movabs $0x800c2e,%rax
+  802461:	00 00 00 
+  802464:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  802466:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  80246d:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802471:	bf 01 00 00 00       	mov    $0x1,%edi
+  802476:	48 b8 73 20 80 00 00 	movabs $0x802073,%rax
+  80247d:	00 00 00 
+  802480:	ff d0                	call   *%rax
+  802482:	89 c3                	mov    %eax,%ebx
+  802484:	85 c0                	test   %eax,%eax
+  802486:	78 1f                	js     8024a7 <open+0x9e>
+    return fd2num(fd);
+  802488:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80248c:	48 b8 45 19 80 00 00 	movabs $0x801945,%rax
+  802493:	00 00 00 
+  802496:	ff d0                	call   *%rax
+  802498:	89 c3                	mov    %eax,%ebx
+}
+  80249a:	89 d8                	mov    %ebx,%eax
+  80249c:	48 83 c4 18          	add    $0x18,%rsp
+  8024a0:	5b                   	pop    %rbx
+  8024a1:	41 5c                	pop    %r12
+  8024a3:	41 5d                	pop    %r13
+  8024a5:	5d                   	pop    %rbp
+  8024a6:	c3                   	ret
+        fd_close(fd, 0);
+  8024a7:	be 00 00 00 00       	mov    $0x0,%esi
+  8024ac:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8024b0:	48 b8 c1 1a 80 00 00 	movabs $0x801ac1,%rax
+  8024b7:	00 00 00 
+  8024ba:	ff d0                	call   *%rax
+        return res;
+  8024bc:	eb dc                	jmp    80249a <open+0x91>
+        return -E_BAD_PATH;
+  8024be:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  8024c3:	eb d5                	jmp    80249a <open+0x91>
+
+00000000008024c5 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  8024c5:	55                   	push   %rbp
+  8024c6:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc(FSREQ_SYNC, NULL);
+  8024c9:	be 00 00 00 00       	mov    $0x0,%esi
+  8024ce:	bf 08 00 00 00       	mov    $0x8,%edi
+  8024d3:	48 b8 73 20 80 00 00 	movabs $0x802073,%rax
+  8024da:	00 00 00 
+  8024dd:	ff d0                	call   *%rax
+}
+  8024df:	5d                   	pop    %rbp
+  8024e0:	c3                   	ret
+
+00000000008024e1 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  8024e1:	55                   	push   %rbp
+  8024e2:	48 89 e5             	mov    %rsp,%rbp
+  8024e5:	41 54                	push   %r12
+  8024e7:	53                   	push   %rbx
+  8024e8:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8024eb:	48 b8 57 19 80 00 00 	movabs $0x801957,%rax
+  8024f2:	00 00 00 
+  8024f5:	ff d0                	call   *%rax
+  8024f7:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  8024fa:	48 be 20 36 80 00 00 	movabs $0x803620,%rsi
+  802501:	00 00 00 
+  802504:	48 89 df             	mov    %rbx,%rdi
+  802507:	48 b8 2e 0c 80 00 00 	movabs $0x800c2e,%rax
+  80250e:	00 00 00 
+  802511:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  802513:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  802518:	41 2b 04 24          	sub    (%r12),%eax
+  80251c:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  802522:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  802529:	00 00 00 
+    stat->st_dev = &devpipe;
+  80252c:	48 b8 60 40 80 00 00 	movabs $0x804060,%rax
+  802533:	00 00 00 
+  802536:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  80253d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802542:	5b                   	pop    %rbx
+  802543:	41 5c                	pop    %r12
+  802545:	5d                   	pop    %rbp
+  802546:	c3                   	ret
+
+0000000000802547 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  802547:	55                   	push   %rbp
+  802548:	48 89 e5             	mov    %rsp,%rbp
+  80254b:	41 54                	push   %r12
+  80254d:	53                   	push   %rbx
+  80254e:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  802551:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802556:	48 89 fe             	mov    %rdi,%rsi
+  802559:	bf 00 00 00 00       	mov    $0x0,%edi
+  80255e:	49 bc aa 12 80 00 00 	movabs $0x8012aa,%r12
+  802565:	00 00 00 
+  802568:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  80256b:	48 89 df             	mov    %rbx,%rdi
+  80256e:	48 b8 57 19 80 00 00 	movabs $0x801957,%rax
+  802575:	00 00 00 
+  802578:	ff d0                	call   *%rax
+  80257a:	48 89 c6             	mov    %rax,%rsi
+  80257d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802582:	bf 00 00 00 00       	mov    $0x0,%edi
+  802587:	41 ff d4             	call   *%r12
+}
+  80258a:	5b                   	pop    %rbx
+  80258b:	41 5c                	pop    %r12
+  80258d:	5d                   	pop    %rbp
+  80258e:	c3                   	ret
+
+000000000080258f <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  80258f:	55                   	push   %rbp
+  802590:	48 89 e5             	mov    %rsp,%rbp
+  802593:	41 57                	push   %r15
+  802595:	41 56                	push   %r14
+  802597:	41 55                	push   %r13
+  802599:	41 54                	push   %r12
+  80259b:	53                   	push   %rbx
+  80259c:	48 83 ec 18          	sub    $0x18,%rsp
+  8025a0:	49 89 fc             	mov    %rdi,%r12
+  8025a3:	49 89 f5             	mov    %rsi,%r13
+  8025a6:	49 89 d7             	mov    %rdx,%r15
+  8025a9:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8025ad:	48 b8 57 19 80 00 00 	movabs $0x801957,%rax
+  8025b4:	00 00 00 
+  8025b7:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  8025b9:	4d 85 ff             	test   %r15,%r15
+  8025bc:	0f 84 af 00 00 00    	je     802671 <devpipe_write+0xe2>
+  8025c2:	48 89 c3             	mov    %rax,%rbx
+  8025c5:	4c 89 f8             	mov    %r15,%rax
+  8025c8:	4d 89 ef             	mov    %r13,%r15
+  8025cb:	4c 01 e8             	add    %r13,%rax
+  8025ce:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8025d2:	49 bd b2 11 80 00 00 	movabs $0x8011b2,%r13
+  8025d9:	00 00 00 
+            sys_yield();
+  8025dc:	49 be 4f 11 80 00 00 	movabs $0x80114f,%r14
+  8025e3:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  8025e6:	8b 73 04             	mov    0x4(%rbx),%esi
+  8025e9:	48 63 ce             	movslq %esi,%rcx
+  8025ec:	48 63 03             	movslq (%rbx),%rax
+  8025ef:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  8025f5:	48 39 c1             	cmp    %rax,%rcx
+  8025f8:	72 2e                	jb     802628 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8025fa:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8025ff:	48 89 da             	mov    %rbx,%rdx
+  802602:	be 00 10 00 00       	mov    $0x1000,%esi
+  802607:	4c 89 e7             	mov    %r12,%rdi
+  80260a:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  80260d:	85 c0                	test   %eax,%eax
+  80260f:	74 66                	je     802677 <devpipe_write+0xe8>
+            sys_yield();
+  802611:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  802614:	8b 73 04             	mov    0x4(%rbx),%esi
+  802617:	48 63 ce             	movslq %esi,%rcx
+  80261a:	48 63 03             	movslq (%rbx),%rax
+  80261d:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  802623:	48 39 c1             	cmp    %rax,%rcx
+  802626:	73 d2                	jae    8025fa <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  802628:	41 0f b6 3f          	movzbl (%r15),%edi
+  80262c:	48 89 ca             	mov    %rcx,%rdx
+  80262f:	48 c1 ea 03          	shr    $0x3,%rdx
+  802633:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  80263a:	08 10 20 
+  80263d:	48 f7 e2             	mul    %rdx
+  802640:	48 c1 ea 06          	shr    $0x6,%rdx
+  802644:	48 89 d0             	mov    %rdx,%rax
+  802647:	48 c1 e0 09          	shl    $0x9,%rax
+  80264b:	48 29 d0             	sub    %rdx,%rax
+  80264e:	48 c1 e0 03          	shl    $0x3,%rax
+  802652:	48 29 c1             	sub    %rax,%rcx
+  802655:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  80265a:	83 c6 01             	add    $0x1,%esi
+  80265d:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  802660:	49 83 c7 01          	add    $0x1,%r15
+  802664:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802668:	49 39 c7             	cmp    %rax,%r15
+  80266b:	0f 85 75 ff ff ff    	jne    8025e6 <devpipe_write+0x57>
+    return n;
+  802671:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802675:	eb 05                	jmp    80267c <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  802677:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80267c:	48 83 c4 18          	add    $0x18,%rsp
+  802680:	5b                   	pop    %rbx
+  802681:	41 5c                	pop    %r12
+  802683:	41 5d                	pop    %r13
+  802685:	41 5e                	pop    %r14
+  802687:	41 5f                	pop    %r15
+  802689:	5d                   	pop    %rbp
+  80268a:	c3                   	ret
+
+000000000080268b <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  80268b:	55                   	push   %rbp
+  80268c:	48 89 e5             	mov    %rsp,%rbp
+  80268f:	41 57                	push   %r15
+  802691:	41 56                	push   %r14
+  802693:	41 55                	push   %r13
+  802695:	41 54                	push   %r12
+  802697:	53                   	push   %rbx
+  802698:	48 83 ec 18          	sub    $0x18,%rsp
+  80269c:	49 89 fc             	mov    %rdi,%r12
+  80269f:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  8026a3:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8026a7:	48 b8 57 19 80 00 00 	movabs $0x801957,%rax
+  8026ae:	00 00 00 
+  8026b1:	ff d0                	call   *%rax
+  8026b3:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  8026b6:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8026bc:	49 bd b2 11 80 00 00 	movabs $0x8011b2,%r13
+  8026c3:	00 00 00 
+            sys_yield();
+  8026c6:	49 be 4f 11 80 00 00 	movabs $0x80114f,%r14
+  8026cd:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  8026d0:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  8026d5:	74 7d                	je     802754 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  8026d7:	8b 03                	mov    (%rbx),%eax
+  8026d9:	3b 43 04             	cmp    0x4(%rbx),%eax
+  8026dc:	75 26                	jne    802704 <devpipe_read+0x79>
+            if (i > 0) return i;
+  8026de:	4d 85 ff             	test   %r15,%r15
+  8026e1:	75 77                	jne    80275a <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8026e3:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8026e8:	48 89 da             	mov    %rbx,%rdx
+  8026eb:	be 00 10 00 00       	mov    $0x1000,%esi
+  8026f0:	4c 89 e7             	mov    %r12,%rdi
+  8026f3:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  8026f6:	85 c0                	test   %eax,%eax
+  8026f8:	74 72                	je     80276c <devpipe_read+0xe1>
+            sys_yield();
+  8026fa:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  8026fd:	8b 03                	mov    (%rbx),%eax
+  8026ff:	3b 43 04             	cmp    0x4(%rbx),%eax
+  802702:	74 df                	je     8026e3 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802704:	48 63 c8             	movslq %eax,%rcx
+  802707:	48 89 ca             	mov    %rcx,%rdx
+  80270a:	48 c1 ea 03          	shr    $0x3,%rdx
+  80270e:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  802715:	08 10 20 
+  802718:	48 89 d0             	mov    %rdx,%rax
+  80271b:	48 f7 e6             	mul    %rsi
+  80271e:	48 c1 ea 06          	shr    $0x6,%rdx
+  802722:	48 89 d0             	mov    %rdx,%rax
+  802725:	48 c1 e0 09          	shl    $0x9,%rax
+  802729:	48 29 d0             	sub    %rdx,%rax
+  80272c:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  802733:	00 
+  802734:	48 89 c8             	mov    %rcx,%rax
+  802737:	48 29 d0             	sub    %rdx,%rax
+  80273a:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  80273f:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  802743:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  802747:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  80274a:	49 83 c7 01          	add    $0x1,%r15
+  80274e:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  802752:	75 83                	jne    8026d7 <devpipe_read+0x4c>
+    return n;
+  802754:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802758:	eb 03                	jmp    80275d <devpipe_read+0xd2>
+            if (i > 0) return i;
+  80275a:	4c 89 f8             	mov    %r15,%rax
+}
+  80275d:	48 83 c4 18          	add    $0x18,%rsp
+  802761:	5b                   	pop    %rbx
+  802762:	41 5c                	pop    %r12
+  802764:	41 5d                	pop    %r13
+  802766:	41 5e                	pop    %r14
+  802768:	41 5f                	pop    %r15
+  80276a:	5d                   	pop    %rbp
+  80276b:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  80276c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802771:	eb ea                	jmp    80275d <devpipe_read+0xd2>
+
+0000000000802773 <pipe>:
+pipe(int pfd[2]) {
+  802773:	55                   	push   %rbp
+  802774:	48 89 e5             	mov    %rsp,%rbp
+  802777:	41 55                	push   %r13
+  802779:	41 54                	push   %r12
+  80277b:	53                   	push   %rbx
+  80277c:	48 81 ec b8 00 00 00 	sub    $0xb8,%rsp
+  802783:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  802786:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  80278a:	48 b8 ec 19 80 00 00 	movabs $0x8019ec,%rax
+  802791:	00 00 00 
+  802794:	ff d0                	call   *%rax
+  802796:	89 c3                	mov    %eax,%ebx
+  802798:	85 c0                	test   %eax,%eax
+  80279a:	0f 88 51 01 00 00    	js     8028f1 <pipe+0x17e>
+        (res = fd_alloc_from(fd2num(fd0) + 1, &fd1)) < 0) goto err;
+  8027a0:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8027a4:	48 b8 45 19 80 00 00 	movabs $0x801945,%rax
+  8027ab:	00 00 00 
+  8027ae:	ff d0                	call   *%rax
+  8027b0:	8d 78 01             	lea    0x1(%rax),%edi
+  8027b3:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8027b7:	48 b8 73 19 80 00 00 	movabs $0x801973,%rax
+  8027be:	00 00 00 
+  8027c1:	ff d0                	call   *%rax
+  8027c3:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8027c5:	85 c0                	test   %eax,%eax
+  8027c7:	0f 88 24 01 00 00    	js     8028f1 <pipe+0x17e>
+    va = fd2data(fd0);
+  8027cd:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8027d1:	48 bb 57 19 80 00 00 	movabs $0x801957,%rbx
+  8027d8:	00 00 00 
+  8027db:	ff d3                	call   *%rbx
+  8027dd:	49 89 c5             	mov    %rax,%r13
+    struct RegionOp ops[] = {
+  8027e0:	48 8d bd 30 ff ff ff 	lea    -0xd0(%rbp),%rdi
+  8027e7:	b9 14 00 00 00       	mov    $0x14,%ecx
+  8027ec:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027f1:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+  8027f4:	c7 85 34 ff ff ff 46 	movl   $0x46,-0xcc(%rbp)
+  8027fb:	00 00 00 
+  8027fe:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802802:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+  802809:	48 c7 85 50 ff ff ff 	movq   $0x1000,-0xb0(%rbp)
+  802810:	00 10 00 00 
+  802814:	c7 85 5c ff ff ff 46 	movl   $0x46,-0xa4(%rbp)
+  80281b:	00 00 00 
+            {.type = REGION_ALLOC, .dstva = (uintptr_t)fd1, .size = PAGE_SIZE, .perm = PROT_RW | PROT_SHARE},
+  80281e:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+    struct RegionOp ops[] = {
+  802822:	48 89 bd 70 ff ff ff 	mov    %rdi,-0x90(%rbp)
+  802829:	48 c7 85 78 ff ff ff 	movq   $0x1000,-0x88(%rbp)
+  802830:	00 10 00 00 
+  802834:	c7 45 84 46 00 00 00 	movl   $0x46,-0x7c(%rbp)
+  80283b:	4c 89 6d 98          	mov    %r13,-0x68(%rbp)
+  80283f:	48 c7 45 a0 00 10 00 	movq   $0x1000,-0x60(%rbp)
+  802846:	00 
+  802847:	c7 45 a8 01 00 00 00 	movl   $0x1,-0x58(%rbp)
+  80284e:	c7 45 ac 46 00 00 00 	movl   $0x46,-0x54(%rbp)
+  802855:	4c 89 6d b8          	mov    %r13,-0x48(%rbp)
+            {.type = REGION_MAP, .srcva = (uintptr_t)va, .dstva = (uintptr_t)fd2data(fd1), .size = PAGE_SIZE, .perm = PROT_RW | PROT_SHARE},
+  802859:	ff d3                	call   *%rbx
+    struct RegionOp ops[] = {
+  80285b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80285f:	48 c7 45 c8 00 10 00 	movq   $0x1000,-0x38(%rbp)
+  802866:	00 
+    if ((res = sys_region_batch(ops, sizeof ops / sizeof *ops)) < 0) goto err1;
+  802867:	be 04 00 00 00       	mov    $0x4,%esi
+  80286c:	48 8d bd 30 ff ff ff 	lea    -0xd0(%rbp),%rdi
+  802873:	48 b8 11 13 80 00 00 	movabs $0x801311,%rax
+  80287a:	00 00 00 
+  80287d:	ff d0                	call   *%rax
+  80287f:	89 c3                	mov    %eax,%ebx
+  802881:	85 c0                	test   %eax,%eax
+  802883:	0f 88 ad 00 00 00    	js     802936 <pipe+0x1c3>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  802889:	be 00 10 00 00       	mov    $0x1000,%esi
+  80288e:	4c 89 ef             	mov    %r13,%rdi
+  802891:	48 b8 80 11 80 00 00 	movabs $0x801180,%rax
+  802898:	00 00 00 
+  80289b:	ff d0                	call   *%rax
+  80289d:	83 f8 02             	cmp    $0x2,%eax
+  8028a0:	75 5f                	jne    802901 <pipe+0x18e>
+    fd0->fd_dev_id = devpipe.dev_id;
+  8028a2:	a1 60 40 80 00 00 00 	movabs 0x804060,%eax
+  8028a9:	00 00 
+  8028ab:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8028af:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  8028b1:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8028b5:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  8028bc:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8028c0:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  8028c2:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8028c6:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  8028cd:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8028d1:	48 bb 45 19 80 00 00 	movabs $0x801945,%rbx
+  8028d8:	00 00 00 
+  8028db:	ff d3                	call   *%rbx
+  8028dd:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  8028e1:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  8028e5:	ff d3                	call   *%rbx
+  8028e7:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  8028ec:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  8028f1:	89 d8                	mov    %ebx,%eax
+  8028f3:	48 81 c4 b8 00 00 00 	add    $0xb8,%rsp
+  8028fa:	5b                   	pop    %rbx
+  8028fb:	41 5c                	pop    %r12
+  8028fd:	41 5d                	pop    %r13
+  8028ff:	5d                   	pop    %rbp
+  802900:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  802901:	48 b9 50 36 80 00 00 	movabs $0x803650,%rcx
+  802908:	00 00 00 
+  80290b:	48 ba 27 36 80 00 00 	movabs $0x803627,%rdx
+  802912:	00 00 00 
+  802915:	be 33 00 00 00       	mov    $0x33,%esi
+  80291a:	48 bf 3c 36 80 00 00 	movabs $0x80363c,%rdi
+  802921:	00 00 00 
+  802924:	b8 00 00 00 00       	mov    $0x0,%eax
+  802929:	49 b8 9b 2e 80 00 00 	movabs $0x802e9b,%r8
+  802930:	00 00 00 
+  802933:	41 ff d0             	call   *%r8
+        ops[i].type = REGION_UNMAP;
+  802936:	c7 85 30 ff ff ff 02 	movl   $0x2,-0xd0(%rbp)
+  80293d:	00 00 00 
+  802940:	c7 85 58 ff ff ff 02 	movl   $0x2,-0xa8(%rbp)
+  802947:	00 00 00 
+  80294a:	c7 45 80 02 00 00 00 	movl   $0x2,-0x80(%rbp)
+  802951:	c7 45 a8 02 00 00 00 	movl   $0x2,-0x58(%rbp)
+    sys_region_batch(ops, sizeof ops / sizeof *ops);
+  802958:	be 04 00 00 00       	mov    $0x4,%esi
+  80295d:	48 8d bd 30 ff ff ff 	lea    -0xd0(%rbp),%rdi
+  802964:	48 b8 11 13 80 00 00 	movabs $0x801311,%rax
+  80296b:	00 00 00 
+  80296e:	ff d0                	call   *%rax
+  802970:	e9 7c ff ff ff       	jmp    8028f1 <pipe+0x17e>
+
+0000000000802975 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  802975:	55                   	push   %rbp
+  802976:	48 89 e5             	mov    %rsp,%rbp
+  802979:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  80297d:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802981:	48 b8 06 1a 80 00 00 	movabs $0x801a06,%rax
+  802988:	00 00 00 
+  80298b:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80298d:	85 c0                	test   %eax,%eax
+  80298f:	78 35                	js     8029c6 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  802991:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802995:	48 b8 57 19 80 00 00 	movabs $0x801957,%rax
+  80299c:	00 00 00 
+  80299f:	ff d0                	call   *%rax
+  8029a1:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8029a4:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8029a9:	be 00 10 00 00       	mov    $0x1000,%esi
+  8029ae:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8029b2:	48 b8 b2 11 80 00 00 	movabs $0x8011b2,%rax
+  8029b9:	00 00 00 
+  8029bc:	ff d0                	call   *%rax
+  8029be:	85 c0                	test   %eax,%eax
+  8029c0:	0f 94 c0             	sete   %al
+  8029c3:	0f b6 c0             	movzbl %al,%eax
+}
+  8029c6:	c9                   	leave
+  8029c7:	c3                   	ret
+
+00000000008029c8 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8029c8:	48 89 f8             	mov    %rdi,%rax
+  8029cb:	48 c1 e8 27          	shr    $0x27,%rax
+  8029cf:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  8029d6:	01 00 00 
+  8029d9:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8029dd:	f6 c2 01             	test   $0x1,%dl
+  8029e0:	74 6d                	je     802a4f <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8029e2:	48 89 f8             	mov    %rdi,%rax
+  8029e5:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8029e9:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8029f0:	01 00 00 
+  8029f3:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8029f7:	f6 c2 01             	test   $0x1,%dl
+  8029fa:	74 62                	je     802a5e <get_uvpt_entry+0x96>
+  8029fc:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802a03:	01 00 00 
+  802a06:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802a0a:	f6 c2 80             	test   $0x80,%dl
+  802a0d:	75 4f                	jne    802a5e <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  802a0f:	48 89 f8             	mov    %rdi,%rax
+  802a12:	48 c1 e8 15          	shr    $0x15,%rax
+  802a16:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802a1d:	01 00 00 
+  802a20:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802a24:	f6 c2 01             	test   $0x1,%dl
+  802a27:	74 44                	je     802a6d <get_uvpt_entry+0xa5>
+  802a29:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802a30:	01 00 00 
+  802a33:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802a37:	f6 c2 80             	test   $0x80,%dl
+  802a3a:	75 31                	jne    802a6d <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  802a3c:	48 c1 ef 0c          	shr    $0xc,%rdi
+  802a40:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802a47:	01 00 00 
+  802a4a:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  802a4e:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  802a4f:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  802a56:	01 00 00 
+  802a59:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802a5d:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  802a5e:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802a65:	01 00 00 
+  802a68:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802a6c:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  802a6d:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802a74:	01 00 00 
+  802a77:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802a7b:	c3                   	ret
+
+0000000000802a7c <get_prot>:
+
+int
+get_prot(void *va) {
+  802a7c:	55                   	push   %rbp
+  802a7d:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  802a80:	48 b8 c8 29 80 00 00 	movabs $0x8029c8,%rax
+  802a87:	00 00 00 
+  802a8a:	ff d0                	call   *%rax
+  802a8c:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  802a8f:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  802a94:	89 c1                	mov    %eax,%ecx
+  802a96:	83 c9 04             	or     $0x4,%ecx
+  802a99:	f6 c2 01             	test   $0x1,%dl
+  802a9c:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  802a9f:	89 c1                	mov    %eax,%ecx
+  802aa1:	83 c9 02             	or     $0x2,%ecx
+  802aa4:	f6 c2 02             	test   $0x2,%dl
+  802aa7:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  802aaa:	89 c1                	mov    %eax,%ecx
+  802aac:	83 c9 01             	or     $0x1,%ecx
+  802aaf:	48 85 d2             	test   %rdx,%rdx
+  802ab2:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  802ab5:	89 c1                	mov    %eax,%ecx
+  802ab7:	83 c9 40             	or     $0x40,%ecx
+  802aba:	f6 c6 04             	test   $0x4,%dh
+  802abd:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  802ac0:	5d                   	pop    %rbp
+  802ac1:	c3                   	ret
+
+0000000000802ac2 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  802ac2:	55                   	push   %rbp
+  802ac3:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  802ac6:	48 b8 c8 29 80 00 00 	movabs $0x8029c8,%rax
+  802acd:	00 00 00 
+  802ad0:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  802ad2:	48 c1 e8 06          	shr    $0x6,%rax
+  802ad6:	83 e0 01             	and    $0x1,%eax
+}
+  802ad9:	5d                   	pop    %rbp
+  802ada:	c3                   	ret
+
+0000000000802adb <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  802adb:	55                   	push   %rbp
+  802adc:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  802adf:	48 b8 c8 29 80 00 00 	movabs $0x8029c8,%rax
+  802ae6:	00 00 00 
+  802ae9:	ff d0                	call   *%rax
+  802aeb:	83 e0 01             	and    $0x1,%eax
+}
+  802aee:	5d                   	pop    %rbp
+  802aef:	c3                   	ret
+
+0000000000802af0 <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  802af0:	55                   	push   %rbp
+  802af1:	48 89 e5             	mov    %rsp,%rbp
+  802af4:	41 57                	push   %r15
+  802af6:	41 56                	push   %r14
+  802af8:	41 55                	push   %r13
+  802afa:	41 54                	push   %r12
+  802afc:	53                   	push   %rbx
+  802afd:	48 83 ec 38          	sub    $0x38,%rsp
+  802b01:	49 89 f7             	mov    %rsi,%r15
+  802b04:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+                    }
+                    continue;
+                }
+                for (int ptei = 0; ptei < PT_ENTRY_COUNT; ptei++) {
+                    uintptr_t pte_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, pdei, ptei, 0);
+                    pte_t pte = uvpt[VPT(pte_addr)];
+  802b0a:	49 bd 00 00 00 00 00 	movabs $0x10000000000,%r13
+  802b11:	01 00 00 
+  802b14:	4d 89 e6             	mov    %r12,%r14
+  802b17:	49 89 fc             	mov    %rdi,%r12
+  802b1a:	e9 19 01 00 00       	jmp    802c38 <foreach_shared_region+0x148>
+  802b1f:	48 89 5d b0          	mov    %rbx,-0x50(%rbp)
+  802b23:	4c 89 75 a8          	mov    %r14,-0x58(%rbp)
+  802b27:	eb 52                	jmp    802b7b <foreach_shared_region+0x8b>
+                for (int ptei = 0; ptei < PT_ENTRY_COUNT; ptei++) {
+  802b29:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802b30:	48 81 fb 00 00 20 00 	cmp    $0x200000,%rbx
+  802b37:	74 2e                	je     802b67 <foreach_shared_region+0x77>
+                    uintptr_t pte_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, pdei, ptei, 0);
+  802b39:	48 89 df             	mov    %rbx,%rdi
+  802b3c:	4c 09 f7             	or     %r14,%rdi
+                    pte_t pte = uvpt[VPT(pte_addr)];
+  802b3f:	48 89 f8             	mov    %rdi,%rax
+  802b42:	48 c1 e8 0c          	shr    $0xc,%rax
+  802b46:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+                    if ((pte & PTE_P) && (pte & PTE_SHARE)) {
+  802b4b:	25 01 04 00 00       	and    $0x401,%eax
+  802b50:	48 3d 01 04 00 00    	cmp    $0x401,%rax
+  802b56:	75 d1                	jne    802b29 <foreach_shared_region+0x39>
+                        fun((void*)pte_addr, (void*)(pte_addr + PAGE_SIZE), arg);
+  802b58:	48 8d b7 00 10 00 00 	lea    0x1000(%rdi),%rsi
+  802b5f:	4c 89 fa             	mov    %r15,%rdx
+  802b62:	41 ff d4             	call   *%r12
+  802b65:	eb c2                	jmp    802b29 <foreach_shared_region+0x39>
+            for (int pdei = 0; pdei < PD_ENTRY_COUNT; pdei++) {
+  802b67:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  802b6e:	00 
+  802b6f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802b73:	48 3d 00 00 00 40    	cmp    $0x40000000,%rax
+  802b79:	74 46                	je     802bc1 <foreach_shared_region+0xd1>
+                uintptr_t pde_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, pdei, 0, 0);
+  802b7b:	4c 8b 75 c8          	mov    -0x38(%rbp),%r14
+  802b7f:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802b83:	49 09 c6             	or     %rax,%r14
+                pde_t pde = uvpd[VPD(pde_addr)];
+  802b86:	4c 89 f0             	mov    %r14,%rax
+  802b89:	48 c1 e8 15          	shr    $0x15,%rax
+  802b8d:	48 b9 00 00 00 80 00 	movabs $0x10080000000,%rcx
+  802b94:	01 00 00 
+  802b97:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+                if (!(pde & PTE_P)) {
+  802b9b:	a8 01                	test   $0x1,%al
+  802b9d:	74 c8                	je     802b67 <foreach_shared_region+0x77>
+                if (pde & PTE_PS) {
+  802b9f:	48 89 c3             	mov    %rax,%rbx
+  802ba2:	81 e3 80 00 00 00    	and    $0x80,%ebx
+  802ba8:	74 8f                	je     802b39 <foreach_shared_region+0x49>
+                    if (pde & PTE_SHARE) {
+  802baa:	f6 c4 04             	test   $0x4,%ah
+  802bad:	74 b8                	je     802b67 <foreach_shared_region+0x77>
+                        fun((void*)pde_addr, (void*)(pde_addr + 1024 * 1024 * 2), arg);
+  802baf:	49 8d b6 00 00 20 00 	lea    0x200000(%r14),%rsi
+  802bb6:	4c 89 fa             	mov    %r15,%rdx
+  802bb9:	4c 89 f7             	mov    %r14,%rdi
+  802bbc:	41 ff d4             	call   *%r12
+  802bbf:	eb a6                	jmp    802b67 <foreach_shared_region+0x77>
+  802bc1:	48 8b 5d b0          	mov    -0x50(%rbp),%rbx
+  802bc5:	4c 8b 75 a8          	mov    -0x58(%rbp),%r14
+        for (int pdpei = 0; pdpei < PDP_ENTRY_COUNT; pdpei++) {
+  802bc9:	48 81 c3 00 00 00 40 	add    $0x40000000,%rbx
+  802bd0:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802bd7:	00 00 00 
+  802bda:	48 39 c3             	cmp    %rax,%rbx
+  802bdd:	74 4c                	je     802c2b <foreach_shared_region+0x13b>
+            uintptr_t pdpe_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, 0, 0, 0);
+  802bdf:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802be3:	48 09 d8             	or     %rbx,%rax
+  802be6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+            pdpe_t pdpe = uvpdp[VPDP(pdpe_addr)];
+  802bea:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802bee:	48 b9 00 00 40 80 00 	movabs $0x10080400000,%rcx
+  802bf5:	01 00 00 
+  802bf8:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+            if (!(pdpe & PTE_P)) {
+  802bfc:	a8 01                	test   $0x1,%al
+  802bfe:	74 c9                	je     802bc9 <foreach_shared_region+0xd9>
+            if (pdpe & PTE_PS) {
+  802c00:	48 89 c1             	mov    %rax,%rcx
+  802c03:	81 e1 80 00 00 00    	and    $0x80,%ecx
+  802c09:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  802c0d:	0f 84 0c ff ff ff    	je     802b1f <foreach_shared_region+0x2f>
+                if (pdpe & PTE_SHARE) {
+  802c13:	f6 c4 04             	test   $0x4,%ah
+  802c16:	74 b1                	je     802bc9 <foreach_shared_region+0xd9>
+                    fun((void*)pdpe_addr, (void*)(pdpe_addr + 1024 * 1024 * 1024), arg); 
+  802c18:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  802c1c:	48 8d b7 00 00 00 40 	lea    0x40000000(%rdi),%rsi
+  802c23:	4c 89 fa             	mov    %r15,%rdx
+  802c26:	41 ff d4             	call   *%r12
+  802c29:	eb 9e                	jmp    802bc9 <foreach_shared_region+0xd9>
+    for (int pml4ei = 0; pml4ei < PML4_ENTRY_COUNT; pml4ei++) {
+  802c2b:	49 83 c6 01          	add    $0x1,%r14
+  802c2f:	49 81 fe 00 02 00 00 	cmp    $0x200,%r14
+  802c36:	74 24                	je     802c5c <foreach_shared_region+0x16c>
+        pml4e_t pml4e = uvpml4[VPML4(pml4_addr)];
+  802c38:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  802c3f:	01 00 00 
+  802c42:	4a 8b 04 f0          	mov    (%rax,%r14,8),%rax
+        if (!(pml4e & PTE_P)) {
+  802c46:	a8 01                	test   $0x1,%al
+  802c48:	74 e1                	je     802c2b <foreach_shared_region+0x13b>
+  802c4a:	4c 89 f0             	mov    %r14,%rax
+  802c4d:	48 c1 e0 27          	shl    $0x27,%rax
+  802c51:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  802c55:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802c5a:	eb 83                	jmp    802bdf <foreach_shared_region+0xef>
+            }
+        }
+    }
+    
+    return 0;
+}
+  802c5c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c61:	48 83 c4 38          	add    $0x38,%rsp
+  802c65:	5b                   	pop    %rbx
+  802c66:	41 5c                	pop    %r12
+  802c68:	41 5d                	pop    %r13
+  802c6a:	41 5e                	pop    %r14
+  802c6c:	41 5f                	pop    %r15
+  802c6e:	5d                   	pop    %rbp
+  802c6f:	c3                   	ret
+
+0000000000802c70 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  802c70:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c75:	c3                   	ret
+
+0000000000802c76 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  802c76:	55                   	push   %rbp
+  802c77:	48 89 e5             	mov    %rsp,%rbp
+  802c7a:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  802c7d:	48 be 74 36 80 00 00 	movabs $0x803674,%rsi
+  802c84:	00 00 00 
+  802c87:	48 b8 2e 0c 80 00 00 	movabs $0x800c2e,%rax
+  802c8e:	00 00 00 
+  802c91:	ff d0                	call   *%rax
+    return 0;
+}
+  802c93:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c98:	5d                   	pop    %rbp
+  802c99:	c3                   	ret
+
+0000000000802c9a <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  802c9a:	55                   	push   %rbp
+  802c9b:	48 89 e5             	mov    %rsp,%rbp
+  802c9e:	41 57                	push   %r15
+  802ca0:	41 56                	push   %r14
+  802ca2:	41 55                	push   %r13
+  802ca4:	41 54                	push   %r12
+  802ca6:	53                   	push   %rbx
+  802ca7:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  802cae:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  802cb5:	48 85 d2             	test   %rdx,%rdx
+  802cb8:	74 7a                	je     802d34 <devcons_write+0x9a>
+  802cba:	49 89 d6             	mov    %rdx,%r14
+  802cbd:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802cc3:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  802cc8:	49 bf 28 0e 80 00 00 	movabs $0x800e28,%r15
+  802ccf:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  802cd2:	4c 89 f3             	mov    %r14,%rbx
+  802cd5:	48 29 f3             	sub    %rsi,%rbx
+  802cd8:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802cdd:	48 39 c3             	cmp    %rax,%rbx
+  802ce0:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  802ce4:	4c 63 eb             	movslq %ebx,%r13
+  802ce7:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  802cee:	48 01 c6             	add    %rax,%rsi
+  802cf1:	4c 89 ea             	mov    %r13,%rdx
+  802cf4:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802cfb:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  802cfe:	4c 89 ee             	mov    %r13,%rsi
+  802d01:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802d08:	48 b8 55 10 80 00 00 	movabs $0x801055,%rax
+  802d0f:	00 00 00 
+  802d12:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  802d14:	41 01 dc             	add    %ebx,%r12d
+  802d17:	49 63 f4             	movslq %r12d,%rsi
+  802d1a:	4c 39 f6             	cmp    %r14,%rsi
+  802d1d:	72 b3                	jb     802cd2 <devcons_write+0x38>
+    return res;
+  802d1f:	49 63 c4             	movslq %r12d,%rax
+}
+  802d22:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  802d29:	5b                   	pop    %rbx
+  802d2a:	41 5c                	pop    %r12
+  802d2c:	41 5d                	pop    %r13
+  802d2e:	41 5e                	pop    %r14
+  802d30:	41 5f                	pop    %r15
+  802d32:	5d                   	pop    %rbp
+  802d33:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  802d34:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802d3a:	eb e3                	jmp    802d1f <devcons_write+0x85>
+
+0000000000802d3c <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  802d3c:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  802d3f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802d44:	48 85 c0             	test   %rax,%rax
+  802d47:	74 55                	je     802d9e <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  802d49:	55                   	push   %rbp
+  802d4a:	48 89 e5             	mov    %rsp,%rbp
+  802d4d:	41 55                	push   %r13
+  802d4f:	41 54                	push   %r12
+  802d51:	53                   	push   %rbx
+  802d52:	48 83 ec 08          	sub    $0x8,%rsp
+  802d56:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  802d59:	48 bb 82 10 80 00 00 	movabs $0x801082,%rbx
+  802d60:	00 00 00 
+  802d63:	49 bc 4f 11 80 00 00 	movabs $0x80114f,%r12
+  802d6a:	00 00 00 
+  802d6d:	eb 03                	jmp    802d72 <devcons_read+0x36>
+  802d6f:	41 ff d4             	call   *%r12
+  802d72:	ff d3                	call   *%rbx
+  802d74:	85 c0                	test   %eax,%eax
+  802d76:	74 f7                	je     802d6f <devcons_read+0x33>
+    if (c < 0) return c;
+  802d78:	48 63 d0             	movslq %eax,%rdx
+  802d7b:	78 13                	js     802d90 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  802d7d:	ba 00 00 00 00       	mov    $0x0,%edx
+  802d82:	83 f8 04             	cmp    $0x4,%eax
+  802d85:	74 09                	je     802d90 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  802d87:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  802d8b:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  802d90:	48 89 d0             	mov    %rdx,%rax
+  802d93:	48 83 c4 08          	add    $0x8,%rsp
+  802d97:	5b                   	pop    %rbx
+  802d98:	41 5c                	pop    %r12
+  802d9a:	41 5d                	pop    %r13
+  802d9c:	5d                   	pop    %rbp
+  802d9d:	c3                   	ret
+  802d9e:	48 89 d0             	mov    %rdx,%rax
+  802da1:	c3                   	ret
+
+0000000000802da2 <cputchar>:
+cputchar(int ch) {
+  802da2:	55                   	push   %rbp
+  802da3:	48 89 e5             	mov    %rsp,%rbp
+  802da6:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  802daa:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  802dae:	be 01 00 00 00       	mov    $0x1,%esi
+  802db3:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  802db7:	48 b8 55 10 80 00 00 	movabs $0x801055,%rax
+  802dbe:	00 00 00 
+  802dc1:	ff d0                	call   *%rax
+}
+  802dc3:	c9                   	leave
+  802dc4:	c3                   	ret
+
+0000000000802dc5 <getchar>:
+getchar(void) {
+  802dc5:	55                   	push   %rbp
+  802dc6:	48 89 e5             	mov    %rsp,%rbp
+  802dc9:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  802dcd:	ba 01 00 00 00       	mov    $0x1,%edx
+  802dd2:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  802dd6:	bf 00 00 00 00       	mov    $0x0,%edi
+  802ddb:	48 b8 e9 1c 80 00 00 	movabs $0x801ce9,%rax
+  802de2:	00 00 00 
+  802de5:	ff d0                	call   *%rax
+  802de7:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  802de9:	85 c0                	test   %eax,%eax
+  802deb:	78 06                	js     802df3 <getchar+0x2e>
+  802ded:	74 08                	je     802df7 <getchar+0x32>
+  802def:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  802df3:	89 d0                	mov    %edx,%eax
+  802df5:	c9                   	leave
+  802df6:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  802df7:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  802dfc:	eb f5                	jmp    802df3 <getchar+0x2e>
+
+0000000000802dfe <iscons>:
+iscons(int fdnum) {
+  802dfe:	55                   	push   %rbp
+  802dff:	48 89 e5             	mov    %rsp,%rbp
+  802e02:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  802e06:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802e0a:	48 b8 06 1a 80 00 00 	movabs $0x801a06,%rax
+  802e11:	00 00 00 
+  802e14:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802e16:	85 c0                	test   %eax,%eax
+  802e18:	78 18                	js     802e32 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  802e1a:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802e1e:	48 b8 a0 40 80 00 00 	movabs $0x8040a0,%rax
+  802e25:	00 00 00 
+  802e28:	8b 00                	mov    (%rax),%eax
+  802e2a:	39 02                	cmp    %eax,(%rdx)
+  802e2c:	0f 94 c0             	sete   %al
+  802e2f:	0f b6 c0             	movzbl %al,%eax
+}
+  802e32:	c9                   	leave
+  802e33:	c3                   	ret
+
+0000000000802e34 <opencons>:
+opencons(void) {
+  802e34:	55                   	push   %rbp
+  802e35:	48 89 e5             	mov    %rsp,%rbp
+  802e38:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802e3c:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  802e40:	48 b8 ec 19 80 00 00 	movabs $0x8019ec,%rax
+  802e47:	00 00 00 
+  802e4a:	ff d0                	call   *%rax
+  802e4c:	85 c0                	test   %eax,%eax
+  802e4e:	78 49                	js     802e99 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  802e50:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802e55:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802e5a:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  802e5e:	bf 00 00 00 00       	mov    $0x0,%edi
+  802e63:	48 b8 de 11 80 00 00 	movabs $0x8011de,%rax
+  802e6a:	00 00 00 
+  802e6d:	ff d0                	call   *%rax
+  802e6f:	85 c0                	test   %eax,%eax
+  802e71:	78 26                	js     802e99 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  802e73:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802e77:	a1 a0 40 80 00 00 00 	movabs 0x8040a0,%eax
+  802e7e:	00 00 
+  802e80:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  802e82:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802e86:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  802e8d:	48 b8 45 19 80 00 00 	movabs $0x801945,%rax
+  802e94:	00 00 00 
+  802e97:	ff d0                	call   *%rax
+}
+  802e99:	c9                   	leave
+  802e9a:	c3                   	ret
+
+0000000000802e9b <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  802e9b:	55                   	push   %rbp
+  802e9c:	48 89 e5             	mov    %rsp,%rbp
+  802e9f:	41 56                	push   %r14
+  802ea1:	41 55                	push   %r13
+  802ea3:	41 54                	push   %r12
+  802ea5:	53                   	push   %rbx
+  802ea6:	48 83 ec 50          	sub    $0x50,%rsp
+  802eaa:	49 89 fc             	mov    %rdi,%r12
+  802ead:	41 89 f5             	mov    %esi,%r13d
+  802eb0:	48 89 d3             	mov    %rdx,%rbx
+  802eb3:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  802eb7:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  802ebb:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  802ebf:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  802ec6:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802eca:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  802ece:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  802ed2:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  802ed6:	48 b8 00 40 80 00 00 	movabs $0x804000,%rax
+  802edd:	00 00 00 
+  802ee0:	4c 8b 30             	mov    (%rax),%r14
+  802ee3:	48 b8 1e 11 80 00 00 	movabs $0x80111e,%rax
+  802eea:	00 00 00 
+  802eed:	ff d0                	call   *%rax
+  802eef:	89 c6                	mov    %eax,%esi
+  802ef1:	45 89 e8             	mov    %r13d,%r8d
+  802ef4:	4c 89 e1             	mov    %r12,%rcx
+  802ef7:	4c 89 f2             	mov    %r14,%rdx
+  802efa:	48 bf 80 36 80 00 00 	movabs $0x803680,%rdi
+  802f01:	00 00 00 
+  802f04:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f09:	49 bc 09 03 80 00 00 	movabs $0x800309,%r12
+  802f10:	00 00 00 
+  802f13:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  802f16:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  802f1a:	48 89 df             	mov    %rbx,%rdi
+  802f1d:	48 b8 a5 02 80 00 00 	movabs $0x8002a5,%rax
+  802f24:	00 00 00 
+  802f27:	ff d0                	call   *%rax
+    cprintf("\n");
+  802f29:	48 bf db 35 80 00 00 	movabs $0x8035db,%rdi
+  802f30:	00 00 00 
+  802f33:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f38:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  802f3b:	cc                   	int3
+  802f3c:	eb fd                	jmp    802f3b <_panic+0xa0>
+  802f3e:	66 90                	xchg   %ax,%ax
+
+0000000000802f40 <__rodata_start>:
+  802f40:	69 20 61 6d 20 25    	imul   $0x25206d61,(%rax),%esp
+  802f46:	30 38                	xor    %bh,(%rax)
+  802f48:	78 3b                	js     802f85 <__rodata_start+0x45>
+  802f4a:	20 74 68 69          	and    %dh,0x69(%rax,%rbp,2)
+  802f4e:	73 65                	jae    802fb5 <__rodata_start+0x75>
+  802f50:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802f51:	76 20                	jbe    802f73 <__rodata_start+0x33>
+  802f53:	69 73 20 25 70 0a 00 	imul   $0xa7025,0x20(%rbx),%esi
+  802f5a:	73 65                	jae    802fc1 <__rodata_start+0x81>
+  802f5c:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802f5d:	64 20 30             	and    %dh,%fs:(%rax)
+  802f60:	20 66 72             	and    %ah,0x72(%rsi)
+  802f63:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802f64:	6d                   	insl   (%dx),%es:(%rdi)
+  802f65:	20 25 78 20 74 6f    	and    %ah,0x6f742078(%rip)        # 6ff44fe3 <__bss_end+0x6f73cfe3>
+  802f6b:	20 25 78 0a 00 25    	and    %ah,0x25000a78(%rip)        # 258039e9 <__bss_end+0x24ffb9e9>
+  802f71:	78 20                	js     802f93 <__rodata_start+0x53>
+  802f73:	67 6f                	outsl  %ds:(%esi),(%dx)
+  802f75:	74 20                	je     802f97 <__rodata_start+0x57>
+  802f77:	25 64 20 66 72       	and    $0x72662064,%eax
+  802f7c:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802f7d:	6d                   	insl   (%dx),%es:(%rdi)
+  802f7e:	20 25 78 20 28 74    	and    %ah,0x74282078(%rip)        # 74a84ffc <__bss_end+0x7427cffc>
+  802f84:	68 69 73 65 6e       	push   $0x6e657369
+  802f89:	76 20                	jbe    802fab <__rodata_start+0x6b>
+  802f8b:	69 73 20 25 70 20 25 	imul   $0x25207025,0x20(%rbx),%esi
+  802f92:	78 29                	js     802fbd <__rodata_start+0x7d>
+  802f94:	0a 00                	or     (%rax),%al
+  802f96:	3c 75                	cmp    $0x75,%al
+  802f98:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802f99:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  802f9d:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802f9e:	3e 00 30             	ds add %dh,(%rax)
+  802fa1:	31 32                	xor    %esi,(%rdx)
+  802fa3:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  802faa:	41                   	rex.B
+  802fab:	42                   	rex.X
+  802fac:	43                   	rex.XB
+  802fad:	44                   	rex.R
+  802fae:	45                   	rex.RB
+  802faf:	46 00 30             	rex.RX add %r14b,(%rax)
+  802fb2:	31 32                	xor    %esi,(%rdx)
+  802fb4:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  802fbb:	61                   	(bad)
+  802fbc:	62 63 64 65 66       	(bad)
+  802fc1:	00 28                	add    %ch,(%rax)
+  802fc3:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802fc4:	75 6c                	jne    803032 <__rodata_start+0xf2>
+  802fc6:	6c                   	insb   (%dx),%es:(%rdi)
+  802fc7:	29 00                	sub    %eax,(%rax)
+  802fc9:	65 72 72             	gs jb  80303e <__rodata_start+0xfe>
+  802fcc:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802fcd:	72 20                	jb     802fef <__rodata_start+0xaf>
+  802fcf:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  802fd4:	73 70                	jae    803046 <__rodata_start+0x106>
+  802fd6:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  802fda:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  802fe1:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802fe2:	72 00                	jb     802fe4 <__rodata_start+0xa4>
+  802fe4:	62 61 64 20 65       	(bad)
+  802fe9:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802fea:	76 69                	jbe    803055 <__rodata_start+0x115>
+  802fec:	72 6f                	jb     80305d <__rodata_start+0x11d>
+  802fee:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802fef:	6d                   	insl   (%dx),%es:(%rdi)
+  802ff0:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  802ff2:	74 00                	je     802ff4 <__rodata_start+0xb4>
+  802ff4:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  802ffb:	20 70 61             	and    %dh,0x61(%rax)
+  802ffe:	72 61                	jb     803061 <__rodata_start+0x121>
+  803000:	6d                   	insl   (%dx),%es:(%rdi)
+  803001:	65 74 65             	gs je  803069 <__rodata_start+0x129>
+  803004:	72 00                	jb     803006 <__rodata_start+0xc6>
+  803006:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803007:	75 74                	jne    80307d <__rodata_start+0x13d>
+  803009:	20 6f 66             	and    %ch,0x66(%rdi)
+  80300c:	20 6d 65             	and    %ch,0x65(%rbp)
+  80300f:	6d                   	insl   (%dx),%es:(%rdi)
+  803010:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803011:	72 79                	jb     80308c <__rodata_start+0x14c>
+  803013:	00 6f 75             	add    %ch,0x75(%rdi)
+  803016:	74 20                	je     803038 <__rodata_start+0xf8>
+  803018:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803019:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  80301d:	76 69                	jbe    803088 <__rodata_start+0x148>
+  80301f:	72 6f                	jb     803090 <__rodata_start+0x150>
+  803021:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803022:	6d                   	insl   (%dx),%es:(%rdi)
+  803023:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803025:	74 73                	je     80309a <__rodata_start+0x15a>
+  803027:	00 63 6f             	add    %ah,0x6f(%rbx)
+  80302a:	72 72                	jb     80309e <__rodata_start+0x15e>
+  80302c:	75 70                	jne    80309e <__rodata_start+0x15e>
+  80302e:	74 65                	je     803095 <__rodata_start+0x155>
+  803030:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  803035:	75 67                	jne    80309e <__rodata_start+0x15e>
+  803037:	20 69 6e             	and    %ch,0x6e(%rcx)
+  80303a:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  80303c:	00 73 65             	add    %dh,0x65(%rbx)
+  80303f:	67 6d                	insl   (%dx),%es:(%edi)
+  803041:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803043:	74 61                	je     8030a6 <__rodata_start+0x166>
+  803045:	74 69                	je     8030b0 <__rodata_start+0x170>
+  803047:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803048:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803049:	20 66 61             	and    %ah,0x61(%rsi)
+  80304c:	75 6c                	jne    8030ba <__rodata_start+0x17a>
+  80304e:	74 00                	je     803050 <__rodata_start+0x110>
+  803050:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  803057:	20 45 4c             	and    %al,0x4c(%rbp)
+  80305a:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  80305e:	61                   	(bad)
+  80305f:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  803064:	20 73 75             	and    %dh,0x75(%rbx)
+  803067:	63 68 20             	movsxd 0x20(%rax),%ebp
+  80306a:	73 79                	jae    8030e5 <__rodata_start+0x1a5>
+  80306c:	73 74                	jae    8030e2 <__rodata_start+0x1a2>
+  80306e:	65 6d                	gs insl (%dx),%es:(%rdi)
+  803070:	20 63 61             	and    %ah,0x61(%rbx)
+  803073:	6c                   	insb   (%dx),%es:(%rdi)
+  803074:	6c                   	insb   (%dx),%es:(%rdi)
+  803075:	00 65 6e             	add    %ah,0x6e(%rbp)
+  803078:	74 72                	je     8030ec <__rodata_start+0x1ac>
+  80307a:	79 20                	jns    80309c <__rodata_start+0x15c>
+  80307c:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80307d:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80307e:	74 20                	je     8030a0 <__rodata_start+0x160>
+  803080:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  803082:	75 6e                	jne    8030f2 <__rodata_start+0x1b2>
+  803084:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  803088:	76 20                	jbe    8030aa <__rodata_start+0x16a>
+  80308a:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  803091:	72 65                	jb     8030f8 <__rodata_start+0x1b8>
+  803093:	63 76 69             	movsxd 0x69(%rsi),%esi
+  803096:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803097:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  80309b:	65 78 70             	gs js  80310e <__rodata_start+0x1ce>
+  80309e:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  8030a3:	20 65 6e             	and    %ah,0x6e(%rbp)
+  8030a6:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  8030aa:	20 66 69             	and    %ah,0x69(%rsi)
+  8030ad:	6c                   	insb   (%dx),%es:(%rdi)
+  8030ae:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  8030b2:	20 66 72             	and    %ah,0x72(%rsi)
+  8030b5:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  8030ba:	61                   	(bad)
+  8030bb:	63 65 20             	movsxd 0x20(%rbp),%esp
+  8030be:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8030bf:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8030c0:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  8030c4:	6b 00 74             	imul   $0x74,(%rax),%eax
+  8030c7:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8030c8:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8030c9:	20 6d 61             	and    %ch,0x61(%rbp)
+  8030cc:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8030cd:	79 20                	jns    8030ef <__rodata_start+0x1af>
+  8030cf:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  8030d6:	72 65                	jb     80313d <__rodata_start+0x1fd>
+  8030d8:	20 6f 70             	and    %ch,0x70(%rdi)
+  8030db:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  8030dd:	00 66 69             	add    %ah,0x69(%rsi)
+  8030e0:	6c                   	insb   (%dx),%es:(%rdi)
+  8030e1:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  8030e5:	20 62 6c             	and    %ah,0x6c(%rdx)
+  8030e8:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8030e9:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  8030ec:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8030ed:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8030ee:	74 20                	je     803110 <__rodata_start+0x1d0>
+  8030f0:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  8030f2:	75 6e                	jne    803162 <__rodata_start+0x222>
+  8030f4:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  8030f8:	76 61                	jbe    80315b <__rodata_start+0x21b>
+  8030fa:	6c                   	insb   (%dx),%es:(%rdi)
+  8030fb:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  803102:	00 
+  803103:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  80310a:	72 65                	jb     803171 <__rodata_start+0x231>
+  80310c:	61                   	(bad)
+  80310d:	64 79 20             	fs jns 803130 <__rodata_start+0x1f0>
+  803110:	65 78 69             	gs js  80317c <__rodata_start+0x23c>
+  803113:	73 74                	jae    803189 <__rodata_start+0x249>
+  803115:	73 00                	jae    803117 <__rodata_start+0x1d7>
+  803117:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803118:	70 65                	jo     80317f <__rodata_start+0x23f>
+  80311a:	72 61                	jb     80317d <__rodata_start+0x23d>
+  80311c:	74 69                	je     803187 <__rodata_start+0x247>
+  80311e:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80311f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803120:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  803123:	74 20                	je     803145 <__rodata_start+0x205>
+  803125:	73 75                	jae    80319c <__rodata_start+0x25c>
+  803127:	70 70                	jo     803199 <__rodata_start+0x259>
+  803129:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80312a:	72 74                	jb     8031a0 <__rodata_start+0x260>
+  80312c:	65 64 00 6f 70       	gs add %ch,%fs:0x70(%rdi)
+  803131:	65 72 61             	gs jb  803195 <__rodata_start+0x255>
+  803134:	74 69                	je     80319f <__rodata_start+0x25f>
+  803136:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803137:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803138:	20 69 6e             	and    %ch,0x6e(%rcx)
+  80313b:	74 65                	je     8031a2 <__rodata_start+0x262>
+  80313d:	72 72                	jb     8031b1 <__rodata_start+0x271>
+  80313f:	75 70                	jne    8031b1 <__rodata_start+0x271>
+  803141:	74 65                	je     8031a8 <__rodata_start+0x268>
+  803143:	64 00 6e 6f          	add    %ch,%fs:0x6f(%rsi)
+  803147:	74 20                	je     803169 <__rodata_start+0x229>
+  803149:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  80314b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80314c:	75 67                	jne    8031b5 <__rodata_start+0x275>
+  80314e:	68 20 43 50 55       	push   $0x55504320
+  803153:	20 74 69 6d          	and    %dh,0x6d(%rcx,%rbp,2)
+  803157:	65 00 0f             	add    %cl,%gs:(%rdi)
+  80315a:	1f                   	(bad)
+  80315b:	80 00 00             	addb   $0x0,(%rax)
+  80315e:	00 00                	add    %al,(%rax)
+  803160:	f6 04 80 00          	testb  $0x0,(%rax,%rax,4)
+  803164:	00 00                	add    %al,(%rax)
+  803166:	00 00                	add    %al,(%rax)
+  803168:	37                   	(bad)
+  803169:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  80316f:	00 27                	add    %ah,(%rdi)
+  803171:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803177:	00 37                	add    %dh,(%rdi)
+  803179:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  80317f:	00 37                	add    %dh,(%rdi)
+  803181:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803187:	00 37                	add    %dh,(%rdi)
+  803189:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  80318f:	00 37                	add    %dh,(%rdi)
+  803191:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803197:	00 15 05 80 00 00    	add    %dl,0x8005(%rip)        # 80b1a2 <__bss_end+0x31a2>
+  80319d:	00 00                	add    %al,(%rax)
+  80319f:	00 37                	add    %dh,(%rdi)
+  8031a1:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  8031a7:	00 37                	add    %dh,(%rdi)
+  8031a9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  8031af:	00 09                	add    %cl,(%rcx)
+  8031b1:	05 80 00 00 00       	add    $0x80,%eax
+  8031b6:	00 00                	add    %al,(%rax)
+  8031b8:	83 05 80 00 00 00 00 	addl   $0x0,0x80(%rip)        # 80323f <__rodata_start+0x2ff>
+  8031bf:	00 37                	add    %dh,(%rdi)
+  8031c1:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  8031c7:	00 09                	add    %cl,(%rcx)
+  8031c9:	05 80 00 00 00       	add    $0x80,%eax
+  8031ce:	00 00                	add    %al,(%rax)
+  8031d0:	4f 05 80 00 00 00    	rex.WRXB add $0x80,%rax
+  8031d6:	00 00                	add    %al,(%rax)
+  8031d8:	4f 05 80 00 00 00    	rex.WRXB add $0x80,%rax
+  8031de:	00 00                	add    %al,(%rax)
+  8031e0:	4f 05 80 00 00 00    	rex.WRXB add $0x80,%rax
+  8031e6:	00 00                	add    %al,(%rax)
+  8031e8:	4f 05 80 00 00 00    	rex.WRXB add $0x80,%rax
+  8031ee:	00 00                	add    %al,(%rax)
+  8031f0:	4f 05 80 00 00 00    	rex.WRXB add $0x80,%rax
+  8031f6:	00 00                	add    %al,(%rax)
+  8031f8:	4f 05 80 00 00 00    	rex.WRXB add $0x80,%rax
+  8031fe:	00 00                	add    %al,(%rax)
+  803200:	4f 05 80 00 00 00    	rex.WRXB add $0x80,%rax
+  803206:	00 00                	add    %al,(%rax)
+  803208:	4f 05 80 00 00 00    	rex.WRXB add $0x80,%rax
+  80320e:	00 00                	add    %al,(%rax)
+  803210:	4f 05 80 00 00 00    	rex.WRXB add $0x80,%rax
+  803216:	00 00                	add    %al,(%rax)
+  803218:	37                   	(bad)
+  803219:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  80321f:	00 37                	add    %dh,(%rdi)
+  803221:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803227:	00 37                	add    %dh,(%rdi)
+  803229:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  80322f:	00 37                	add    %dh,(%rdi)
+  803231:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803237:	00 37                	add    %dh,(%rdi)
+  803239:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  80323f:	00 37                	add    %dh,(%rdi)
+  803241:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803247:	00 37                	add    %dh,(%rdi)
+  803249:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  80324f:	00 37                	add    %dh,(%rdi)
+  803251:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803257:	00 37                	add    %dh,(%rdi)
+  803259:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  80325f:	00 37                	add    %dh,(%rdi)
+  803261:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803267:	00 37                	add    %dh,(%rdi)
+  803269:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  80326f:	00 37                	add    %dh,(%rdi)
+  803271:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803277:	00 37                	add    %dh,(%rdi)
+  803279:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  80327f:	00 37                	add    %dh,(%rdi)
+  803281:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803287:	00 37                	add    %dh,(%rdi)
+  803289:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  80328f:	00 37                	add    %dh,(%rdi)
+  803291:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803297:	00 37                	add    %dh,(%rdi)
+  803299:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  80329f:	00 37                	add    %dh,(%rdi)
+  8032a1:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  8032a7:	00 37                	add    %dh,(%rdi)
+  8032a9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  8032af:	00 37                	add    %dh,(%rdi)
+  8032b1:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  8032b7:	00 37                	add    %dh,(%rdi)
+  8032b9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  8032bf:	00 37                	add    %dh,(%rdi)
+  8032c1:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  8032c7:	00 37                	add    %dh,(%rdi)
+  8032c9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  8032cf:	00 37                	add    %dh,(%rdi)
+  8032d1:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  8032d7:	00 37                	add    %dh,(%rdi)
+  8032d9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  8032df:	00 37                	add    %dh,(%rdi)
+  8032e1:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  8032e7:	00 37                	add    %dh,(%rdi)
+  8032e9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  8032ef:	00 37                	add    %dh,(%rdi)
+  8032f1:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  8032f7:	00 37                	add    %dh,(%rdi)
+  8032f9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  8032ff:	00 37                	add    %dh,(%rdi)
+  803301:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803307:	00 5a 0a             	add    %bl,0xa(%rdx)
+  80330a:	80 00 00             	addb   $0x0,(%rax)
+  80330d:	00 00                	add    %al,(%rax)
+  80330f:	00 37                	add    %dh,(%rdi)
+  803311:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803317:	00 37                	add    %dh,(%rdi)
+  803319:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  80331f:	00 37                	add    %dh,(%rdi)
+  803321:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803327:	00 37                	add    %dh,(%rdi)
+  803329:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  80332f:	00 37                	add    %dh,(%rdi)
+  803331:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803337:	00 37                	add    %dh,(%rdi)
+  803339:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  80333f:	00 37                	add    %dh,(%rdi)
+  803341:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803347:	00 37                	add    %dh,(%rdi)
+  803349:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  80334f:	00 37                	add    %dh,(%rdi)
+  803351:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803357:	00 37                	add    %dh,(%rdi)
+  803359:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  80335f:	00 a6 05 80 00 00    	add    %ah,0x8005(%rsi)
+  803365:	00 00                	add    %al,(%rax)
+  803367:	00 75 07             	add    %dh,0x7(%rbp)
+  80336a:	80 00 00             	addb   $0x0,(%rax)
+  80336d:	00 00                	add    %al,(%rax)
+  80336f:	00 37                	add    %dh,(%rdi)
+  803371:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803377:	00 37                	add    %dh,(%rdi)
+  803379:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  80337f:	00 37                	add    %dh,(%rdi)
+  803381:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803387:	00 37                	add    %dh,(%rdi)
+  803389:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  80338f:	00 d5                	add    %dl,%ch
+  803391:	05 80 00 00 00       	add    $0x80,%eax
+  803396:	00 00                	add    %al,(%rax)
+  803398:	37                   	(bad)
+  803399:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  80339f:	00 37                	add    %dh,(%rdi)
+  8033a1:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  8033a7:	00 9b 05 80 00 00    	add    %bl,0x8005(%rbx)
+  8033ad:	00 00                	add    %al,(%rax)
+  8033af:	00 37                	add    %dh,(%rdi)
+  8033b1:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  8033b7:	00 37                	add    %dh,(%rdi)
+  8033b9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  8033bf:	00 1d 09 80 00 00    	add    %bl,0x8009(%rip)        # 80b3ce <__bss_end+0x33ce>
+  8033c5:	00 00                	add    %al,(%rax)
+  8033c7:	00 e7                	add    %ah,%bh
+  8033c9:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  8033cf:	00 37                	add    %dh,(%rdi)
+  8033d1:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  8033d7:	00 37                	add    %dh,(%rdi)
+  8033d9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  8033df:	00 6c 06 80          	add    %ch,-0x80(%rsi,%rax,1)
+  8033e3:	00 00                	add    %al,(%rax)
+  8033e5:	00 00                	add    %al,(%rax)
+  8033e7:	00 37                	add    %dh,(%rdi)
+  8033e9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  8033ef:	00 49 08             	add    %cl,0x8(%rcx)
+  8033f2:	80 00 00             	addb   $0x0,(%rax)
+  8033f5:	00 00                	add    %al,(%rax)
+  8033f7:	00 37                	add    %dh,(%rdi)
+  8033f9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  8033ff:	00 37                	add    %dh,(%rdi)
+  803401:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803407:	00 5a 0a             	add    %bl,0xa(%rdx)
+  80340a:	80 00 00             	addb   $0x0,(%rax)
+  80340d:	00 00                	add    %al,(%rax)
+  80340f:	00 37                	add    %dh,(%rdi)
+  803411:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803417:	00 ff                	add    %bh,%bh
+  803419:	04 80                	add    $0x80,%al
+  80341b:	00 00                	add    %al,(%rax)
+  80341d:	00 00                	add    %al,(%rax)
+	...
+
+0000000000803420 <error_string>:
+	...
+  803428:	d2 2f 80 00 00 00 00 00 e4 2f 80 00 00 00 00 00     ./......./......
+  803438:	f4 2f 80 00 00 00 00 00 06 30 80 00 00 00 00 00     ./.......0......
+  803448:	14 30 80 00 00 00 00 00 28 30 80 00 00 00 00 00     .0......(0......
+  803458:	3d 30 80 00 00 00 00 00 50 30 80 00 00 00 00 00     =0......P0......
+  803468:	62 30 80 00 00 00 00 00 76 30 80 00 00 00 00 00     b0......v0......
+  803478:	86 30 80 00 00 00 00 00 99 30 80 00 00 00 00 00     .0.......0......
+  803488:	b0 30 80 00 00 00 00 00 c6 30 80 00 00 00 00 00     .0.......0......
+  803498:	de 30 80 00 00 00 00 00 f6 30 80 00 00 00 00 00     .0.......0......
+  8034a8:	03 31 80 00 00 00 00 00 d0 34 80 00 00 00 00 00     .1.......4......
+  8034b8:	17 31 80 00 00 00 00 00 2f 31 80 00 00 00 00 00     .1....../1......
+  8034c8:	45 31 80 00 00 00 00 00 66 69 6c 65 20 69 73 20     E1......file is 
+  8034d8:	6e 6f 74 20 61 20 76 61 6c 69 64 20 65 78 65 63     not a valid exec
+  8034e8:	75 74 61 62 6c 65 00 90 73 79 73 63 61 6c 6c 20     utable..syscall 
+  8034f8:	25 7a 64 20 72 65 74 75 72 6e 65 64 20 25 7a 64     %zd returned %zd
+  803508:	20 28 3e 20 30 29 00 6c 69 62 2f 73 79 73 63 61      (> 0).lib/sysca
+  803518:	6c 6c 2e 63 00 46 6f 72 6b 20 64 6f 75 62 6c 65     ll.c.Fork double
+  803528:	20 66 61 75 6c 74 00 6c 69 62 2f 66 6f 72 6b 2e      fault.lib/fork.
+  803538:	63 00 73 66 6f 72 6b 28 29 20 69 73 20 6e 6f 74     c.sfork() is not
+  803548:	20 69 6d 70 6c 65 6d 65 6e 74 65 64 00 73 79 73      implemented.sys
+  803558:	5f 69 70 63 5f 74 72 79 5f 73 65 6e 64 20 66 61     _ipc_try_send fa
+  803568:	69 6c 65 64 3a 20 25 69 00 6c 69 62 2f 69 70 63     iled: %i.lib/ipc
+  803578:	2e 63 00 0f 1f 44 00 00 5b 25 30 38 78 5d 20 75     .c...D..[%08x] u
+  803588:	6e 6b 6e 6f 77 6e 20 64 65 76 69 63 65 20 74 79     nknown device ty
+  803598:	70 65 20 25 64 0a 00 00 5b 25 30 38 78 5d 20 66     pe %d...[%08x] f
+  8035a8:	74 72 75 6e 63 61 74 65 20 25 64 20 2d 2d 20 62     truncate %d -- b
+  8035b8:	61 64 20 6d 6f 64 65 0a 00 5b 25 30 38 78 5d 20     ad mode..[%08x] 
+  8035c8:	72 65 61 64 20 25 64 20 2d 2d 20 62 61 64 20 6d     read %d -- bad m
+  8035d8:	6f 64 65 0a 00 5b 25 30 38 78 5d 20 77 72 69 74     ode..[%08x] writ
+  8035e8:	65 20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65     e %d -- bad mode
+  8035f8:	0a 00 66 0f 1f 44 00 00                             ..f..D..
+
+0000000000803600 <devtab>:
+  803600:	20 40 80 00 00 00 00 00 60 40 80 00 00 00 00 00      @......`@......
+  803610:	a0 40 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .@..............
+  803620:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  803630:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  803640:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  803650:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  803660:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  803670:	3d 20 32 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73 00     = 2.<cons>.cons.
+  803680:	5b 25 30 38 78 5d 20 75 73 65 72 20 70 61 6e 69     [%08x] user pani
+  803690:	63 20 69 6e 20 25 73 20 61 74 20 25 73 3a 25 64     c in %s at %s:%d
+  8036a0:	3a 20 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     : .f.........f..
+  8036b0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8036c0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8036d0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8036e0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8036f0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803700:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803710:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803720:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803730:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803740:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803750:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803760:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803770:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803780:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803790:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8037a0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8037b0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8037c0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8037d0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8037e0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8037f0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803800:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803810:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803820:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803830:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803840:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803850:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803860:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803870:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803880:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803890:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8038a0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8038b0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8038c0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8038d0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8038e0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8038f0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803900:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803910:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803920:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803930:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803940:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803950:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803960:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803970:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803980:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803990:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8039a0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8039b0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8039c0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8039d0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8039e0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8039f0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803a00:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803a10:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803a20:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803a30:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803a40:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803a50:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803a60:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803a70:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803a80:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803a90:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803aa0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803ab0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803ac0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803ad0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803ae0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803af0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803b00:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803b10:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803b20:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803b30:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803b40:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803b50:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803b60:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803b70:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803b80:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803b90:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803ba0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803bb0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803bc0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803bd0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803be0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803bf0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803c00:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803c10:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803c20:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803c30:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803c40:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803c50:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803c60:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803c70:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803c80:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803c90:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803ca0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803cb0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803cc0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803cd0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803ce0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803cf0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803d00:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803d10:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803d20:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803d30:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803d40:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803d50:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803d60:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803d70:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803d80:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803d90:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803da0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803db0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803dc0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803dd0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803de0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803df0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803e00:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803e10:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803e20:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803e30:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803e40:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803e50:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803e60:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803e70:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803e80:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803e90:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803ea0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803eb0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803ec0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803ed0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803ee0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803ef0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803f00:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803f10:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803f20:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803f30:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803f40:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803f50:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803f60:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803f70:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803f80:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803f90:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803fa0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803fb0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803fc0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803fd0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803fe0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803ff0:	2e 0f 1f 84 00 00 00 00 00 0f 1f 80 00 00 00 00     ................
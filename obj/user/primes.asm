@@ -0,0 +1,5962 @@
+
+obj/user/primes:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 68 01 00 00       	call   80018b <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <primeproc>:
+ * of main and user/idle. */
+
+#include <inc/lib.h>
+
+unsigned
+primeproc(void) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 57                	push   %r15
+  80002b:	41 56                	push   %r14
+  80002d:	41 55                	push   %r13
+  80002f:	41 54                	push   %r12
+  800031:	53                   	push   %rbx
+  800032:	48 83 ec 18          	sub    $0x18,%rsp
+    int i, id, p;
+    envid_t envid;
+
+    /* Fetch a prime from our left neighbor */
+top:
+    p = ipc_recv(&envid, 0, 0, 0);
+  800036:	49 bf 1b 18 80 00 00 	movabs $0x80181b,%r15
+  80003d:	00 00 00 
+    cprintf("%d ", p);
+  800040:	49 be a7 03 80 00 00 	movabs $0x8003a7,%r14
+  800047:	00 00 00 
+
+    /* Fork a right neighbor to continue the chain */
+    if ((id = fork()) < 0)
+  80004a:	49 bd b7 16 80 00 00 	movabs $0x8016b7,%r13
+  800051:	00 00 00 
+    p = ipc_recv(&envid, 0, 0, 0);
+  800054:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800059:	ba 00 00 00 00       	mov    $0x0,%edx
+  80005e:	be 00 00 00 00       	mov    $0x0,%esi
+  800063:	48 8d 7d cc          	lea    -0x34(%rbp),%rdi
+  800067:	41 ff d7             	call   *%r15
+  80006a:	89 c3                	mov    %eax,%ebx
+    cprintf("%d ", p);
+  80006c:	89 c6                	mov    %eax,%esi
+  80006e:	48 bf 40 2f 80 00 00 	movabs $0x802f40,%rdi
+  800075:	00 00 00 
+  800078:	b8 00 00 00 00       	mov    $0x0,%eax
+  80007d:	41 ff d6             	call   *%r14
+    if ((id = fork()) < 0)
+  800080:	41 ff d5             	call   *%r13
+  800083:	41 89 c4             	mov    %eax,%r12d
+  800086:	85 c0                	test   %eax,%eax
+  800088:	78 4d                	js     8000d7 <primeproc+0xb2>
+        panic("fork: %i", id);
+    if (id == 0)
+  80008a:	74 c8                	je     800054 <primeproc+0x2f>
+        goto top;
+
+    /* Filter out multiples of our prime */
+    while (1) {
+        i = ipc_recv(&envid, 0, 0, 0);
+  80008c:	49 bd 1b 18 80 00 00 	movabs $0x80181b,%r13
+  800093:	00 00 00 
+        if (i % p)
+            ipc_send(id, i, 0, 0, 0);
+  800096:	49 be f0 18 80 00 00 	movabs $0x8018f0,%r14
+  80009d:	00 00 00 
+        i = ipc_recv(&envid, 0, 0, 0);
+  8000a0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8000a5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8000aa:	be 00 00 00 00       	mov    $0x0,%esi
+  8000af:	48 8d 7d cc          	lea    -0x34(%rbp),%rdi
+  8000b3:	41 ff d5             	call   *%r13
+  8000b6:	89 c6                	mov    %eax,%esi
+        if (i % p)
+  8000b8:	99                   	cltd
+  8000b9:	f7 fb                	idiv   %ebx
+  8000bb:	85 d2                	test   %edx,%edx
+  8000bd:	74 e1                	je     8000a0 <primeproc+0x7b>
+            ipc_send(id, i, 0, 0, 0);
+  8000bf:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8000c5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8000ca:	ba 00 00 00 00       	mov    $0x0,%edx
+  8000cf:	44 89 e7             	mov    %r12d,%edi
+  8000d2:	41 ff d6             	call   *%r14
+  8000d5:	eb c9                	jmp    8000a0 <primeproc+0x7b>
+        panic("fork: %i", id);
+  8000d7:	89 c1                	mov    %eax,%ecx
+  8000d9:	48 ba 44 2f 80 00 00 	movabs $0x802f44,%rdx
+  8000e0:	00 00 00 
+  8000e3:	be 19 00 00 00       	mov    $0x19,%esi
+  8000e8:	48 bf 4d 2f 80 00 00 	movabs $0x802f4d,%rdi
+  8000ef:	00 00 00 
+  8000f2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000f7:	49 b8 57 02 80 00 00 	movabs $0x800257,%r8
+  8000fe:	00 00 00 
+  800101:	41 ff d0             	call   *%r8
+
+0000000000800104 <umain>:
+    }
+}
+
+void
+umain(int argc, char **argv) {
+  800104:	55                   	push   %rbp
+  800105:	48 89 e5             	mov    %rsp,%rbp
+  800108:	41 55                	push   %r13
+  80010a:	41 54                	push   %r12
+  80010c:	53                   	push   %rbx
+  80010d:	48 83 ec 08          	sub    $0x8,%rsp
+    int id;
+
+    /* Fork the first prime process in the chain */
+    if ((id = fork()) < 0)
+  800111:	48 b8 b7 16 80 00 00 	movabs $0x8016b7,%rax
+  800118:	00 00 00 
+  80011b:	ff d0                	call   *%rax
+  80011d:	41 89 c4             	mov    %eax,%r12d
+  800120:	85 c0                	test   %eax,%eax
+  800122:	78 2e                	js     800152 <umain+0x4e>
+        panic("fork: %i", id);
+    if (id == 0)
+        primeproc();
+
+    /* Feed all the integers through */
+    for (int i = 2;; i++)
+  800124:	bb 02 00 00 00       	mov    $0x2,%ebx
+        ipc_send(id, i, 0, 0, 0);
+  800129:	49 bd f0 18 80 00 00 	movabs $0x8018f0,%r13
+  800130:	00 00 00 
+    if (id == 0)
+  800133:	74 4a                	je     80017f <umain+0x7b>
+        ipc_send(id, i, 0, 0, 0);
+  800135:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80013b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800140:	ba 00 00 00 00       	mov    $0x0,%edx
+  800145:	89 de                	mov    %ebx,%esi
+  800147:	44 89 e7             	mov    %r12d,%edi
+  80014a:	41 ff d5             	call   *%r13
+    for (int i = 2;; i++)
+  80014d:	83 c3 01             	add    $0x1,%ebx
+  800150:	eb e3                	jmp    800135 <umain+0x31>
+        panic("fork: %i", id);
+  800152:	89 c1                	mov    %eax,%ecx
+  800154:	48 ba 44 2f 80 00 00 	movabs $0x802f44,%rdx
+  80015b:	00 00 00 
+  80015e:	be 2b 00 00 00       	mov    $0x2b,%esi
+  800163:	48 bf 4d 2f 80 00 00 	movabs $0x802f4d,%rdi
+  80016a:	00 00 00 
+  80016d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800172:	49 b8 57 02 80 00 00 	movabs $0x800257,%r8
+  800179:	00 00 00 
+  80017c:	41 ff d0             	call   *%r8
+        primeproc();
+  80017f:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  800186:	00 00 00 
+  800189:	ff d0                	call   *%rax
+
+000000000080018b <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  80018b:	55                   	push   %rbp
+  80018c:	48 89 e5             	mov    %rsp,%rbp
+  80018f:	41 56                	push   %r14
+  800191:	41 55                	push   %r13
+  800193:	41 54                	push   %r12
+  800195:	53                   	push   %rbx
+  800196:	41 89 fd             	mov    %edi,%r13d
+  800199:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  80019c:	48 ba d8 40 80 00 00 	movabs $0x8040d8,%rdx
+  8001a3:	00 00 00 
+  8001a6:	48 b8 d8 40 80 00 00 	movabs $0x8040d8,%rax
+  8001ad:	00 00 00 
+  8001b0:	48 39 c2             	cmp    %rax,%rdx
+  8001b3:	73 17                	jae    8001cc <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  8001b5:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  8001b8:	49 89 c4             	mov    %rax,%r12
+  8001bb:	48 83 c3 08          	add    $0x8,%rbx
+  8001bf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001c4:	ff 53 f8             	call   *-0x8(%rbx)
+  8001c7:	4c 39 e3             	cmp    %r12,%rbx
+  8001ca:	72 ef                	jb     8001bb <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+    envid_t this_env_id = sys_getenvid();
+  8001cc:	48 b8 bc 11 80 00 00 	movabs $0x8011bc,%rax
+  8001d3:	00 00 00 
+  8001d6:	ff d0                	call   *%rax
+    thisenv = &((struct Env*)UENVS)[ENVX(this_env_id)];
+  8001d8:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8001dd:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+  8001e4:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8001eb:	00 00 00 
+  8001ee:	48 01 d0             	add    %rdx,%rax
+  8001f1:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  8001f8:	00 00 00 
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8001fb:	45 85 ed             	test   %r13d,%r13d
+  8001fe:	7e 0d                	jle    80020d <libmain+0x82>
+  800200:	49 8b 06             	mov    (%r14),%rax
+  800203:	48 a3 00 40 80 00 00 	movabs %rax,0x804000
+  80020a:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  80020d:	4c 89 f6             	mov    %r14,%rsi
+  800210:	44 89 ef             	mov    %r13d,%edi
+  800213:	48 b8 04 01 80 00 00 	movabs $0x800104,%rax
+  80021a:	00 00 00 
+  80021d:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  80021f:	48 b8 34 02 80 00 00 	movabs $0x800234,%rax
+  800226:	00 00 00 
+  800229:	ff d0                	call   *%rax
+#endif
+}
+  80022b:	5b                   	pop    %rbx
+  80022c:	41 5c                	pop    %r12
+  80022e:	41 5d                	pop    %r13
+  800230:	41 5e                	pop    %r14
+  800232:	5d                   	pop    %rbp
+  800233:	c3                   	ret
+
+0000000000800234 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  800234:	55                   	push   %rbp
+  800235:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  800238:	48 b8 3c 1c 80 00 00 	movabs $0x801c3c,%rax
+  80023f:	00 00 00 
+  800242:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  800244:	bf 00 00 00 00       	mov    $0x0,%edi
+  800249:	48 b8 51 11 80 00 00 	movabs $0x801151,%rax
+  800250:	00 00 00 
+  800253:	ff d0                	call   *%rax
+}
+  800255:	5d                   	pop    %rbp
+  800256:	c3                   	ret
+
+0000000000800257 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  800257:	55                   	push   %rbp
+  800258:	48 89 e5             	mov    %rsp,%rbp
+  80025b:	41 56                	push   %r14
+  80025d:	41 55                	push   %r13
+  80025f:	41 54                	push   %r12
+  800261:	53                   	push   %rbx
+  800262:	48 83 ec 50          	sub    $0x50,%rsp
+  800266:	49 89 fc             	mov    %rdi,%r12
+  800269:	41 89 f5             	mov    %esi,%r13d
+  80026c:	48 89 d3             	mov    %rdx,%rbx
+  80026f:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  800273:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  800277:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  80027b:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  800282:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800286:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  80028a:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  80028e:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  800292:	48 b8 00 40 80 00 00 	movabs $0x804000,%rax
+  800299:	00 00 00 
+  80029c:	4c 8b 30             	mov    (%rax),%r14
+  80029f:	48 b8 bc 11 80 00 00 	movabs $0x8011bc,%rax
+  8002a6:	00 00 00 
+  8002a9:	ff d0                	call   *%rax
+  8002ab:	89 c6                	mov    %eax,%esi
+  8002ad:	45 89 e8             	mov    %r13d,%r8d
+  8002b0:	4c 89 e1             	mov    %r12,%rcx
+  8002b3:	4c 89 f2             	mov    %r14,%rdx
+  8002b6:	48 bf 68 2f 80 00 00 	movabs $0x802f68,%rdi
+  8002bd:	00 00 00 
+  8002c0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002c5:	49 bc a7 03 80 00 00 	movabs $0x8003a7,%r12
+  8002cc:	00 00 00 
+  8002cf:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  8002d2:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  8002d6:	48 89 df             	mov    %rbx,%rdi
+  8002d9:	48 b8 43 03 80 00 00 	movabs $0x800343,%rax
+  8002e0:	00 00 00 
+  8002e3:	ff d0                	call   *%rax
+    cprintf("\n");
+  8002e5:	48 bf db 35 80 00 00 	movabs $0x8035db,%rdi
+  8002ec:	00 00 00 
+  8002ef:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002f4:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  8002f7:	cc                   	int3
+  8002f8:	eb fd                	jmp    8002f7 <_panic+0xa0>
+
+00000000008002fa <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  8002fa:	55                   	push   %rbp
+  8002fb:	48 89 e5             	mov    %rsp,%rbp
+  8002fe:	53                   	push   %rbx
+  8002ff:	48 83 ec 08          	sub    $0x8,%rsp
+  800303:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  800306:	8b 06                	mov    (%rsi),%eax
+  800308:	8d 50 01             	lea    0x1(%rax),%edx
+  80030b:	89 16                	mov    %edx,(%rsi)
+  80030d:	48 98                	cltq
+  80030f:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  800314:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  80031a:	74 0a                	je     800326 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  80031c:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  800320:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800324:	c9                   	leave
+  800325:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  800326:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  80032a:	be ff 00 00 00       	mov    $0xff,%esi
+  80032f:	48 b8 f3 10 80 00 00 	movabs $0x8010f3,%rax
+  800336:	00 00 00 
+  800339:	ff d0                	call   *%rax
+        state->offset = 0;
+  80033b:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  800341:	eb d9                	jmp    80031c <putch+0x22>
+
+0000000000800343 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  800343:	55                   	push   %rbp
+  800344:	48 89 e5             	mov    %rsp,%rbp
+  800347:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  80034e:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  800351:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  800358:	b9 21 00 00 00       	mov    $0x21,%ecx
+  80035d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800362:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  800365:	48 89 f1             	mov    %rsi,%rcx
+  800368:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  80036f:	48 bf fa 02 80 00 00 	movabs $0x8002fa,%rdi
+  800376:	00 00 00 
+  800379:	48 b8 f7 04 80 00 00 	movabs $0x8004f7,%rax
+  800380:	00 00 00 
+  800383:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  800385:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  80038c:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  800393:	48 b8 f3 10 80 00 00 	movabs $0x8010f3,%rax
+  80039a:	00 00 00 
+  80039d:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  80039f:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  8003a5:	c9                   	leave
+  8003a6:	c3                   	ret
+
+00000000008003a7 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  8003a7:	55                   	push   %rbp
+  8003a8:	48 89 e5             	mov    %rsp,%rbp
+  8003ab:	48 83 ec 50          	sub    $0x50,%rsp
+  8003af:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8003b3:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8003b7:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8003bb:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8003bf:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  8003c3:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  8003ca:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8003ce:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8003d2:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8003d6:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  8003da:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  8003de:	48 b8 43 03 80 00 00 	movabs $0x800343,%rax
+  8003e5:	00 00 00 
+  8003e8:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  8003ea:	c9                   	leave
+  8003eb:	c3                   	ret
+
+00000000008003ec <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  8003ec:	55                   	push   %rbp
+  8003ed:	48 89 e5             	mov    %rsp,%rbp
+  8003f0:	41 57                	push   %r15
+  8003f2:	41 56                	push   %r14
+  8003f4:	41 55                	push   %r13
+  8003f6:	41 54                	push   %r12
+  8003f8:	53                   	push   %rbx
+  8003f9:	48 83 ec 18          	sub    $0x18,%rsp
+  8003fd:	49 89 fc             	mov    %rdi,%r12
+  800400:	49 89 f5             	mov    %rsi,%r13
+  800403:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800407:	8b 45 10             	mov    0x10(%rbp),%eax
+  80040a:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  80040d:	41 89 cf             	mov    %ecx,%r15d
+  800410:	4c 39 fa             	cmp    %r15,%rdx
+  800413:	73 5b                	jae    800470 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  800415:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  800419:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  80041d:	85 db                	test   %ebx,%ebx
+  80041f:	7e 0e                	jle    80042f <print_num+0x43>
+            putch(padc, put_arg);
+  800421:	4c 89 ee             	mov    %r13,%rsi
+  800424:	44 89 f7             	mov    %r14d,%edi
+  800427:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  80042a:	83 eb 01             	sub    $0x1,%ebx
+  80042d:	75 f2                	jne    800421 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  80042f:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  800433:	48 b9 9c 2f 80 00 00 	movabs $0x802f9c,%rcx
+  80043a:	00 00 00 
+  80043d:	48 b8 8b 2f 80 00 00 	movabs $0x802f8b,%rax
+  800444:	00 00 00 
+  800447:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  80044b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80044f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800454:	49 f7 f7             	div    %r15
+  800457:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  80045b:	4c 89 ee             	mov    %r13,%rsi
+  80045e:	41 ff d4             	call   *%r12
+}
+  800461:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800465:	5b                   	pop    %rbx
+  800466:	41 5c                	pop    %r12
+  800468:	41 5d                	pop    %r13
+  80046a:	41 5e                	pop    %r14
+  80046c:	41 5f                	pop    %r15
+  80046e:	5d                   	pop    %rbp
+  80046f:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  800470:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800474:	ba 00 00 00 00       	mov    $0x0,%edx
+  800479:	49 f7 f7             	div    %r15
+  80047c:	48 83 ec 08          	sub    $0x8,%rsp
+  800480:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  800484:	52                   	push   %rdx
+  800485:	45 0f be c9          	movsbl %r9b,%r9d
+  800489:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  80048d:	48 89 c2             	mov    %rax,%rdx
+  800490:	48 b8 ec 03 80 00 00 	movabs $0x8003ec,%rax
+  800497:	00 00 00 
+  80049a:	ff d0                	call   *%rax
+  80049c:	48 83 c4 10          	add    $0x10,%rsp
+  8004a0:	eb 8d                	jmp    80042f <print_num+0x43>
+
+00000000008004a2 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  8004a2:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  8004a6:	48 8b 06             	mov    (%rsi),%rax
+  8004a9:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  8004ad:	73 0a                	jae    8004b9 <sprintputch+0x17>
+        *state->start++ = ch;
+  8004af:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8004b3:	48 89 16             	mov    %rdx,(%rsi)
+  8004b6:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  8004b9:	c3                   	ret
+
+00000000008004ba <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  8004ba:	55                   	push   %rbp
+  8004bb:	48 89 e5             	mov    %rsp,%rbp
+  8004be:	48 83 ec 50          	sub    $0x50,%rsp
+  8004c2:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8004c6:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8004ca:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  8004ce:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8004d5:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8004d9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8004dd:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8004e1:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  8004e5:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8004e9:	48 b8 f7 04 80 00 00 	movabs $0x8004f7,%rax
+  8004f0:	00 00 00 
+  8004f3:	ff d0                	call   *%rax
+}
+  8004f5:	c9                   	leave
+  8004f6:	c3                   	ret
+
+00000000008004f7 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  8004f7:	55                   	push   %rbp
+  8004f8:	48 89 e5             	mov    %rsp,%rbp
+  8004fb:	41 57                	push   %r15
+  8004fd:	41 56                	push   %r14
+  8004ff:	41 55                	push   %r13
+  800501:	41 54                	push   %r12
+  800503:	53                   	push   %rbx
+  800504:	48 83 ec 38          	sub    $0x38,%rsp
+  800508:	49 89 fe             	mov    %rdi,%r14
+  80050b:	49 89 f5             	mov    %rsi,%r13
+  80050e:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  800511:	48 8b 01             	mov    (%rcx),%rax
+  800514:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  800518:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  80051c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800520:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  800524:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  800528:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  80052c:	0f b6 3b             	movzbl (%rbx),%edi
+  80052f:	40 80 ff 25          	cmp    $0x25,%dil
+  800533:	74 18                	je     80054d <vprintfmt+0x56>
+            if (!ch) return;
+  800535:	40 84 ff             	test   %dil,%dil
+  800538:	0f 84 b1 06 00 00    	je     800bef <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  80053e:	40 0f b6 ff          	movzbl %dil,%edi
+  800542:	4c 89 ee             	mov    %r13,%rsi
+  800545:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  800548:	4c 89 e3             	mov    %r12,%rbx
+  80054b:	eb db                	jmp    800528 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  80054d:	be 00 00 00 00       	mov    $0x0,%esi
+  800552:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  800556:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  80055b:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800561:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  800568:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  80056c:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  800571:	41 0f b6 04 24       	movzbl (%r12),%eax
+  800576:	88 45 a0             	mov    %al,-0x60(%rbp)
+  800579:	83 e8 23             	sub    $0x23,%eax
+  80057c:	3c 57                	cmp    $0x57,%al
+  80057e:	0f 87 51 06 00 00    	ja     800bd5 <vprintfmt+0x6de>
+  800584:	0f b6 c0             	movzbl %al,%eax
+  800587:	48 b9 60 31 80 00 00 	movabs $0x803160,%rcx
+  80058e:	00 00 00 
+  800591:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  800594:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  800597:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  80059b:	eb cf                	jmp    80056c <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  80059d:	49 89 dc             	mov    %rbx,%r12
+  8005a0:	be 01 00 00 00       	mov    $0x1,%esi
+  8005a5:	eb c5                	jmp    80056c <vprintfmt+0x75>
+            padc = ch;
+  8005a7:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  8005ab:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8005ae:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8005b1:	eb b9                	jmp    80056c <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8005b3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8005b6:	83 f8 2f             	cmp    $0x2f,%eax
+  8005b9:	77 24                	ja     8005df <vprintfmt+0xe8>
+  8005bb:	89 c1                	mov    %eax,%ecx
+  8005bd:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  8005c1:	83 c0 08             	add    $0x8,%eax
+  8005c4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8005c7:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  8005ca:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  8005cd:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8005d1:	79 99                	jns    80056c <vprintfmt+0x75>
+                width = precision;
+  8005d3:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  8005d7:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8005dd:	eb 8d                	jmp    80056c <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8005df:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8005e3:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  8005e7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8005eb:	eb da                	jmp    8005c7 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  8005ed:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  8005f2:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8005f6:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  8005fc:	3c 39                	cmp    $0x39,%al
+  8005fe:	77 1c                	ja     80061c <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  800600:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  800604:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  800608:	0f b6 c0             	movzbl %al,%eax
+  80060b:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800610:	0f b6 03             	movzbl (%rbx),%eax
+  800613:	3c 39                	cmp    $0x39,%al
+  800615:	76 e9                	jbe    800600 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  800617:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  80061a:	eb b1                	jmp    8005cd <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  80061c:	49 89 dc             	mov    %rbx,%r12
+  80061f:	eb ac                	jmp    8005cd <vprintfmt+0xd6>
+            width = MAX(0, width);
+  800621:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  800624:	85 c9                	test   %ecx,%ecx
+  800626:	b8 00 00 00 00       	mov    $0x0,%eax
+  80062b:	0f 49 c1             	cmovns %ecx,%eax
+  80062e:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  800631:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800634:	e9 33 ff ff ff       	jmp    80056c <vprintfmt+0x75>
+            lflag++;
+  800639:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  80063c:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80063f:	e9 28 ff ff ff       	jmp    80056c <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  800644:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800647:	83 f8 2f             	cmp    $0x2f,%eax
+  80064a:	77 19                	ja     800665 <vprintfmt+0x16e>
+  80064c:	89 c2                	mov    %eax,%edx
+  80064e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800652:	83 c0 08             	add    $0x8,%eax
+  800655:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800658:	8b 3a                	mov    (%rdx),%edi
+  80065a:	4c 89 ee             	mov    %r13,%rsi
+  80065d:	41 ff d6             	call   *%r14
+            break;
+  800660:	e9 c3 fe ff ff       	jmp    800528 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  800665:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800669:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80066d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800671:	eb e5                	jmp    800658 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  800673:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800676:	83 f8 2f             	cmp    $0x2f,%eax
+  800679:	77 5a                	ja     8006d5 <vprintfmt+0x1de>
+  80067b:	89 c2                	mov    %eax,%edx
+  80067d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800681:	83 c0 08             	add    $0x8,%eax
+  800684:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  800687:	8b 02                	mov    (%rdx),%eax
+  800689:	89 c1                	mov    %eax,%ecx
+  80068b:	f7 d9                	neg    %ecx
+  80068d:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  800690:	83 f9 15             	cmp    $0x15,%ecx
+  800693:	7f 4e                	jg     8006e3 <vprintfmt+0x1ec>
+  800695:	48 63 c1             	movslq %ecx,%rax
+  800698:	48 ba 20 34 80 00 00 	movabs $0x803420,%rdx
+  80069f:	00 00 00 
+  8006a2:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8006a6:	48 85 c0             	test   %rax,%rax
+  8006a9:	74 38                	je     8006e3 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  8006ab:	48 89 c1             	mov    %rax,%rcx
+  8006ae:	48 ba 39 36 80 00 00 	movabs $0x803639,%rdx
+  8006b5:	00 00 00 
+  8006b8:	4c 89 ee             	mov    %r13,%rsi
+  8006bb:	4c 89 f7             	mov    %r14,%rdi
+  8006be:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006c3:	49 b8 ba 04 80 00 00 	movabs $0x8004ba,%r8
+  8006ca:	00 00 00 
+  8006cd:	41 ff d0             	call   *%r8
+  8006d0:	e9 53 fe ff ff       	jmp    800528 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  8006d5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8006d9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006dd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006e1:	eb a4                	jmp    800687 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  8006e3:	48 ba b4 2f 80 00 00 	movabs $0x802fb4,%rdx
+  8006ea:	00 00 00 
+  8006ed:	4c 89 ee             	mov    %r13,%rsi
+  8006f0:	4c 89 f7             	mov    %r14,%rdi
+  8006f3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006f8:	49 b8 ba 04 80 00 00 	movabs $0x8004ba,%r8
+  8006ff:	00 00 00 
+  800702:	41 ff d0             	call   *%r8
+  800705:	e9 1e fe ff ff       	jmp    800528 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  80070a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80070d:	83 f8 2f             	cmp    $0x2f,%eax
+  800710:	77 6c                	ja     80077e <vprintfmt+0x287>
+  800712:	89 c2                	mov    %eax,%edx
+  800714:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800718:	83 c0 08             	add    $0x8,%eax
+  80071b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80071e:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  800721:	48 85 d2             	test   %rdx,%rdx
+  800724:	48 b8 ad 2f 80 00 00 	movabs $0x802fad,%rax
+  80072b:	00 00 00 
+  80072e:	48 0f 45 c2          	cmovne %rdx,%rax
+  800732:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  800736:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  80073a:	7e 06                	jle    800742 <vprintfmt+0x24b>
+  80073c:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  800740:	75 4a                	jne    80078c <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800742:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800746:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  80074a:	0f b6 00             	movzbl (%rax),%eax
+  80074d:	84 c0                	test   %al,%al
+  80074f:	0f 85 9a 00 00 00    	jne    8007ef <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  800755:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800758:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  80075c:	85 c0                	test   %eax,%eax
+  80075e:	0f 8e c4 fd ff ff    	jle    800528 <vprintfmt+0x31>
+  800764:	4c 89 ee             	mov    %r13,%rsi
+  800767:	bf 20 00 00 00       	mov    $0x20,%edi
+  80076c:	41 ff d6             	call   *%r14
+  80076f:	41 83 ec 01          	sub    $0x1,%r12d
+  800773:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  800777:	75 eb                	jne    800764 <vprintfmt+0x26d>
+  800779:	e9 aa fd ff ff       	jmp    800528 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  80077e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800782:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800786:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80078a:	eb 92                	jmp    80071e <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  80078c:	49 63 f7             	movslq %r15d,%rsi
+  80078f:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  800793:	48 b8 a9 0c 80 00 00 	movabs $0x800ca9,%rax
+  80079a:	00 00 00 
+  80079d:	ff d0                	call   *%rax
+  80079f:	48 89 c2             	mov    %rax,%rdx
+  8007a2:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8007a5:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  8007a7:	8d 70 ff             	lea    -0x1(%rax),%esi
+  8007aa:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  8007ad:	85 c0                	test   %eax,%eax
+  8007af:	7e 91                	jle    800742 <vprintfmt+0x24b>
+  8007b1:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  8007b6:	4c 89 ee             	mov    %r13,%rsi
+  8007b9:	44 89 e7             	mov    %r12d,%edi
+  8007bc:	41 ff d6             	call   *%r14
+  8007bf:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8007c3:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8007c6:	83 f8 ff             	cmp    $0xffffffff,%eax
+  8007c9:	75 eb                	jne    8007b6 <vprintfmt+0x2bf>
+  8007cb:	e9 72 ff ff ff       	jmp    800742 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8007d0:	0f b6 f8             	movzbl %al,%edi
+  8007d3:	4c 89 ee             	mov    %r13,%rsi
+  8007d6:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8007d9:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8007dd:	49 83 c4 01          	add    $0x1,%r12
+  8007e1:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  8007e7:	84 c0                	test   %al,%al
+  8007e9:	0f 84 66 ff ff ff    	je     800755 <vprintfmt+0x25e>
+  8007ef:	45 85 ff             	test   %r15d,%r15d
+  8007f2:	78 0a                	js     8007fe <vprintfmt+0x307>
+  8007f4:	41 83 ef 01          	sub    $0x1,%r15d
+  8007f8:	0f 88 57 ff ff ff    	js     800755 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8007fe:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  800802:	74 cc                	je     8007d0 <vprintfmt+0x2d9>
+  800804:	8d 50 e0             	lea    -0x20(%rax),%edx
+  800807:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  80080c:	80 fa 5e             	cmp    $0x5e,%dl
+  80080f:	77 c2                	ja     8007d3 <vprintfmt+0x2dc>
+  800811:	eb bd                	jmp    8007d0 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  800813:	40 84 f6             	test   %sil,%sil
+  800816:	75 26                	jne    80083e <vprintfmt+0x347>
+    switch (lflag) {
+  800818:	85 d2                	test   %edx,%edx
+  80081a:	74 59                	je     800875 <vprintfmt+0x37e>
+  80081c:	83 fa 01             	cmp    $0x1,%edx
+  80081f:	74 7b                	je     80089c <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  800821:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800824:	83 f8 2f             	cmp    $0x2f,%eax
+  800827:	0f 87 96 00 00 00    	ja     8008c3 <vprintfmt+0x3cc>
+  80082d:	89 c2                	mov    %eax,%edx
+  80082f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800833:	83 c0 08             	add    $0x8,%eax
+  800836:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800839:	4c 8b 22             	mov    (%rdx),%r12
+  80083c:	eb 17                	jmp    800855 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  80083e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800841:	83 f8 2f             	cmp    $0x2f,%eax
+  800844:	77 21                	ja     800867 <vprintfmt+0x370>
+  800846:	89 c2                	mov    %eax,%edx
+  800848:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80084c:	83 c0 08             	add    $0x8,%eax
+  80084f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800852:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  800855:	4d 85 e4             	test   %r12,%r12
+  800858:	78 7a                	js     8008d4 <vprintfmt+0x3dd>
+            num = i;
+  80085a:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  80085d:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  800862:	e9 50 02 00 00       	jmp    800ab7 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800867:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80086b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80086f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800873:	eb dd                	jmp    800852 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  800875:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800878:	83 f8 2f             	cmp    $0x2f,%eax
+  80087b:	77 11                	ja     80088e <vprintfmt+0x397>
+  80087d:	89 c2                	mov    %eax,%edx
+  80087f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800883:	83 c0 08             	add    $0x8,%eax
+  800886:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800889:	4c 63 22             	movslq (%rdx),%r12
+  80088c:	eb c7                	jmp    800855 <vprintfmt+0x35e>
+  80088e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800892:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800896:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80089a:	eb ed                	jmp    800889 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  80089c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80089f:	83 f8 2f             	cmp    $0x2f,%eax
+  8008a2:	77 11                	ja     8008b5 <vprintfmt+0x3be>
+  8008a4:	89 c2                	mov    %eax,%edx
+  8008a6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008aa:	83 c0 08             	add    $0x8,%eax
+  8008ad:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008b0:	4c 8b 22             	mov    (%rdx),%r12
+  8008b3:	eb a0                	jmp    800855 <vprintfmt+0x35e>
+  8008b5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008b9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008bd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008c1:	eb ed                	jmp    8008b0 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  8008c3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008c7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008cb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008cf:	e9 65 ff ff ff       	jmp    800839 <vprintfmt+0x342>
+                putch('-', put_arg);
+  8008d4:	4c 89 ee             	mov    %r13,%rsi
+  8008d7:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  8008dc:	41 ff d6             	call   *%r14
+                i = -i;
+  8008df:	49 f7 dc             	neg    %r12
+  8008e2:	e9 73 ff ff ff       	jmp    80085a <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  8008e7:	40 84 f6             	test   %sil,%sil
+  8008ea:	75 32                	jne    80091e <vprintfmt+0x427>
+    switch (lflag) {
+  8008ec:	85 d2                	test   %edx,%edx
+  8008ee:	74 5d                	je     80094d <vprintfmt+0x456>
+  8008f0:	83 fa 01             	cmp    $0x1,%edx
+  8008f3:	0f 84 82 00 00 00    	je     80097b <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  8008f9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008fc:	83 f8 2f             	cmp    $0x2f,%eax
+  8008ff:	0f 87 a5 00 00 00    	ja     8009aa <vprintfmt+0x4b3>
+  800905:	89 c2                	mov    %eax,%edx
+  800907:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80090b:	83 c0 08             	add    $0x8,%eax
+  80090e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800911:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800914:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  800919:	e9 99 01 00 00       	jmp    800ab7 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  80091e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800921:	83 f8 2f             	cmp    $0x2f,%eax
+  800924:	77 19                	ja     80093f <vprintfmt+0x448>
+  800926:	89 c2                	mov    %eax,%edx
+  800928:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80092c:	83 c0 08             	add    $0x8,%eax
+  80092f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800932:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800935:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  80093a:	e9 78 01 00 00       	jmp    800ab7 <vprintfmt+0x5c0>
+  80093f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800943:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800947:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80094b:	eb e5                	jmp    800932 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  80094d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800950:	83 f8 2f             	cmp    $0x2f,%eax
+  800953:	77 18                	ja     80096d <vprintfmt+0x476>
+  800955:	89 c2                	mov    %eax,%edx
+  800957:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80095b:	83 c0 08             	add    $0x8,%eax
+  80095e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800961:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800963:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  800968:	e9 4a 01 00 00       	jmp    800ab7 <vprintfmt+0x5c0>
+  80096d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800971:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800975:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800979:	eb e6                	jmp    800961 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  80097b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80097e:	83 f8 2f             	cmp    $0x2f,%eax
+  800981:	77 19                	ja     80099c <vprintfmt+0x4a5>
+  800983:	89 c2                	mov    %eax,%edx
+  800985:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800989:	83 c0 08             	add    $0x8,%eax
+  80098c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80098f:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800992:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  800997:	e9 1b 01 00 00       	jmp    800ab7 <vprintfmt+0x5c0>
+  80099c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009a0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009a4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009a8:	eb e5                	jmp    80098f <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  8009aa:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009ae:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009b2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009b6:	e9 56 ff ff ff       	jmp    800911 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  8009bb:	40 84 f6             	test   %sil,%sil
+  8009be:	75 2e                	jne    8009ee <vprintfmt+0x4f7>
+    switch (lflag) {
+  8009c0:	85 d2                	test   %edx,%edx
+  8009c2:	74 59                	je     800a1d <vprintfmt+0x526>
+  8009c4:	83 fa 01             	cmp    $0x1,%edx
+  8009c7:	74 7f                	je     800a48 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  8009c9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009cc:	83 f8 2f             	cmp    $0x2f,%eax
+  8009cf:	0f 87 9f 00 00 00    	ja     800a74 <vprintfmt+0x57d>
+  8009d5:	89 c2                	mov    %eax,%edx
+  8009d7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009db:	83 c0 08             	add    $0x8,%eax
+  8009de:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009e1:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8009e4:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  8009e9:	e9 c9 00 00 00       	jmp    800ab7 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8009ee:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009f1:	83 f8 2f             	cmp    $0x2f,%eax
+  8009f4:	77 19                	ja     800a0f <vprintfmt+0x518>
+  8009f6:	89 c2                	mov    %eax,%edx
+  8009f8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009fc:	83 c0 08             	add    $0x8,%eax
+  8009ff:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a02:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800a05:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800a0a:	e9 a8 00 00 00       	jmp    800ab7 <vprintfmt+0x5c0>
+  800a0f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a13:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a17:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a1b:	eb e5                	jmp    800a02 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  800a1d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a20:	83 f8 2f             	cmp    $0x2f,%eax
+  800a23:	77 15                	ja     800a3a <vprintfmt+0x543>
+  800a25:	89 c2                	mov    %eax,%edx
+  800a27:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a2b:	83 c0 08             	add    $0x8,%eax
+  800a2e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a31:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  800a33:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  800a38:	eb 7d                	jmp    800ab7 <vprintfmt+0x5c0>
+  800a3a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a3e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a42:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a46:	eb e9                	jmp    800a31 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  800a48:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a4b:	83 f8 2f             	cmp    $0x2f,%eax
+  800a4e:	77 16                	ja     800a66 <vprintfmt+0x56f>
+  800a50:	89 c2                	mov    %eax,%edx
+  800a52:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a56:	83 c0 08             	add    $0x8,%eax
+  800a59:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a5c:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800a5f:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  800a64:	eb 51                	jmp    800ab7 <vprintfmt+0x5c0>
+  800a66:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a6a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a6e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a72:	eb e8                	jmp    800a5c <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  800a74:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a78:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a7c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a80:	e9 5c ff ff ff       	jmp    8009e1 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  800a85:	4c 89 ee             	mov    %r13,%rsi
+  800a88:	bf 30 00 00 00       	mov    $0x30,%edi
+  800a8d:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800a90:	4c 89 ee             	mov    %r13,%rsi
+  800a93:	bf 78 00 00 00       	mov    $0x78,%edi
+  800a98:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800a9b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a9e:	83 f8 2f             	cmp    $0x2f,%eax
+  800aa1:	77 47                	ja     800aea <vprintfmt+0x5f3>
+  800aa3:	89 c2                	mov    %eax,%edx
+  800aa5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800aa9:	83 c0 08             	add    $0x8,%eax
+  800aac:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800aaf:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800ab2:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800ab7:	48 83 ec 08          	sub    $0x8,%rsp
+  800abb:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800abf:	0f 94 c0             	sete   %al
+  800ac2:	0f b6 c0             	movzbl %al,%eax
+  800ac5:	50                   	push   %rax
+  800ac6:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800acb:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800acf:	4c 89 ee             	mov    %r13,%rsi
+  800ad2:	4c 89 f7             	mov    %r14,%rdi
+  800ad5:	48 b8 ec 03 80 00 00 	movabs $0x8003ec,%rax
+  800adc:	00 00 00 
+  800adf:	ff d0                	call   *%rax
+            break;
+  800ae1:	48 83 c4 10          	add    $0x10,%rsp
+  800ae5:	e9 3e fa ff ff       	jmp    800528 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800aea:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800aee:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800af2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800af6:	eb b7                	jmp    800aaf <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  800af8:	40 84 f6             	test   %sil,%sil
+  800afb:	75 2b                	jne    800b28 <vprintfmt+0x631>
+    switch (lflag) {
+  800afd:	85 d2                	test   %edx,%edx
+  800aff:	74 56                	je     800b57 <vprintfmt+0x660>
+  800b01:	83 fa 01             	cmp    $0x1,%edx
+  800b04:	74 7f                	je     800b85 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800b06:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b09:	83 f8 2f             	cmp    $0x2f,%eax
+  800b0c:	0f 87 a2 00 00 00    	ja     800bb4 <vprintfmt+0x6bd>
+  800b12:	89 c2                	mov    %eax,%edx
+  800b14:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b18:	83 c0 08             	add    $0x8,%eax
+  800b1b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b1e:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800b21:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800b26:	eb 8f                	jmp    800ab7 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800b28:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b2b:	83 f8 2f             	cmp    $0x2f,%eax
+  800b2e:	77 19                	ja     800b49 <vprintfmt+0x652>
+  800b30:	89 c2                	mov    %eax,%edx
+  800b32:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b36:	83 c0 08             	add    $0x8,%eax
+  800b39:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b3c:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800b3f:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800b44:	e9 6e ff ff ff       	jmp    800ab7 <vprintfmt+0x5c0>
+  800b49:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b4d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b51:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b55:	eb e5                	jmp    800b3c <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800b57:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b5a:	83 f8 2f             	cmp    $0x2f,%eax
+  800b5d:	77 18                	ja     800b77 <vprintfmt+0x680>
+  800b5f:	89 c2                	mov    %eax,%edx
+  800b61:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b65:	83 c0 08             	add    $0x8,%eax
+  800b68:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b6b:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800b6d:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800b72:	e9 40 ff ff ff       	jmp    800ab7 <vprintfmt+0x5c0>
+  800b77:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b7b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b7f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b83:	eb e6                	jmp    800b6b <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800b85:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b88:	83 f8 2f             	cmp    $0x2f,%eax
+  800b8b:	77 19                	ja     800ba6 <vprintfmt+0x6af>
+  800b8d:	89 c2                	mov    %eax,%edx
+  800b8f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b93:	83 c0 08             	add    $0x8,%eax
+  800b96:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b99:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800b9c:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800ba1:	e9 11 ff ff ff       	jmp    800ab7 <vprintfmt+0x5c0>
+  800ba6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800baa:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bae:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bb2:	eb e5                	jmp    800b99 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800bb4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bb8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bbc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bc0:	e9 59 ff ff ff       	jmp    800b1e <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800bc5:	4c 89 ee             	mov    %r13,%rsi
+  800bc8:	bf 25 00 00 00       	mov    $0x25,%edi
+  800bcd:	41 ff d6             	call   *%r14
+            break;
+  800bd0:	e9 53 f9 ff ff       	jmp    800528 <vprintfmt+0x31>
+            putch('%', put_arg);
+  800bd5:	4c 89 ee             	mov    %r13,%rsi
+  800bd8:	bf 25 00 00 00       	mov    $0x25,%edi
+  800bdd:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800be0:	48 83 eb 01          	sub    $0x1,%rbx
+  800be4:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800be8:	75 f6                	jne    800be0 <vprintfmt+0x6e9>
+  800bea:	e9 39 f9 ff ff       	jmp    800528 <vprintfmt+0x31>
+}
+  800bef:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800bf3:	5b                   	pop    %rbx
+  800bf4:	41 5c                	pop    %r12
+  800bf6:	41 5d                	pop    %r13
+  800bf8:	41 5e                	pop    %r14
+  800bfa:	41 5f                	pop    %r15
+  800bfc:	5d                   	pop    %rbp
+  800bfd:	c3                   	ret
+
+0000000000800bfe <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800bfe:	55                   	push   %rbp
+  800bff:	48 89 e5             	mov    %rsp,%rbp
+  800c02:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800c06:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800c0a:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800c0f:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800c13:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800c1a:	48 85 ff             	test   %rdi,%rdi
+  800c1d:	74 2b                	je     800c4a <vsnprintf+0x4c>
+  800c1f:	48 85 f6             	test   %rsi,%rsi
+  800c22:	74 26                	je     800c4a <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800c24:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800c28:	48 bf a2 04 80 00 00 	movabs $0x8004a2,%rdi
+  800c2f:	00 00 00 
+  800c32:	48 b8 f7 04 80 00 00 	movabs $0x8004f7,%rax
+  800c39:	00 00 00 
+  800c3c:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800c3e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800c42:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800c45:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800c48:	c9                   	leave
+  800c49:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800c4a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800c4f:	eb f7                	jmp    800c48 <vsnprintf+0x4a>
+
+0000000000800c51 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800c51:	55                   	push   %rbp
+  800c52:	48 89 e5             	mov    %rsp,%rbp
+  800c55:	48 83 ec 50          	sub    $0x50,%rsp
+  800c59:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800c5d:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800c61:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800c65:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800c6c:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800c70:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c74:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800c78:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800c7c:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800c80:	48 b8 fe 0b 80 00 00 	movabs $0x800bfe,%rax
+  800c87:	00 00 00 
+  800c8a:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800c8c:	c9                   	leave
+  800c8d:	c3                   	ret
+
+0000000000800c8e <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800c8e:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800c91:	74 10                	je     800ca3 <strlen+0x15>
+    size_t n = 0;
+  800c93:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800c98:	48 83 c0 01          	add    $0x1,%rax
+  800c9c:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800ca0:	75 f6                	jne    800c98 <strlen+0xa>
+  800ca2:	c3                   	ret
+    size_t n = 0;
+  800ca3:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800ca8:	c3                   	ret
+
+0000000000800ca9 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800ca9:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800cac:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800cb1:	48 85 f6             	test   %rsi,%rsi
+  800cb4:	74 11                	je     800cc7 <strnlen+0x1e>
+  800cb6:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800cba:	74 0c                	je     800cc8 <strnlen+0x1f>
+  800cbc:	48 83 c2 01          	add    $0x1,%rdx
+  800cc0:	48 39 d0             	cmp    %rdx,%rax
+  800cc3:	75 f1                	jne    800cb6 <strnlen+0xd>
+  800cc5:	eb 04                	jmp    800ccb <strnlen+0x22>
+  800cc7:	c3                   	ret
+  800cc8:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800ccb:	c3                   	ret
+
+0000000000800ccc <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800ccc:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800ccf:	ba 00 00 00 00       	mov    $0x0,%edx
+  800cd4:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800cd8:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800cdb:	48 83 c2 01          	add    $0x1,%rdx
+  800cdf:	84 c9                	test   %cl,%cl
+  800ce1:	75 f1                	jne    800cd4 <strcpy+0x8>
+        ;
+    return res;
+}
+  800ce3:	c3                   	ret
+
+0000000000800ce4 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800ce4:	55                   	push   %rbp
+  800ce5:	48 89 e5             	mov    %rsp,%rbp
+  800ce8:	41 54                	push   %r12
+  800cea:	53                   	push   %rbx
+  800ceb:	48 89 fb             	mov    %rdi,%rbx
+  800cee:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800cf1:	48 b8 8e 0c 80 00 00 	movabs $0x800c8e,%rax
+  800cf8:	00 00 00 
+  800cfb:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800cfd:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800d01:	4c 89 e6             	mov    %r12,%rsi
+  800d04:	48 b8 cc 0c 80 00 00 	movabs $0x800ccc,%rax
+  800d0b:	00 00 00 
+  800d0e:	ff d0                	call   *%rax
+    return dst;
+}
+  800d10:	48 89 d8             	mov    %rbx,%rax
+  800d13:	5b                   	pop    %rbx
+  800d14:	41 5c                	pop    %r12
+  800d16:	5d                   	pop    %rbp
+  800d17:	c3                   	ret
+
+0000000000800d18 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800d18:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800d1b:	48 85 d2             	test   %rdx,%rdx
+  800d1e:	74 1f                	je     800d3f <strncpy+0x27>
+  800d20:	48 01 fa             	add    %rdi,%rdx
+  800d23:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800d26:	48 83 c1 01          	add    $0x1,%rcx
+  800d2a:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800d2e:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800d32:	41 80 f8 01          	cmp    $0x1,%r8b
+  800d36:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800d3a:	48 39 ca             	cmp    %rcx,%rdx
+  800d3d:	75 e7                	jne    800d26 <strncpy+0xe>
+    }
+    return ret;
+}
+  800d3f:	c3                   	ret
+
+0000000000800d40 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800d40:	48 89 f8             	mov    %rdi,%rax
+  800d43:	48 85 d2             	test   %rdx,%rdx
+  800d46:	74 24                	je     800d6c <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800d48:	48 83 ea 01          	sub    $0x1,%rdx
+  800d4c:	74 1b                	je     800d69 <strlcpy+0x29>
+  800d4e:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800d52:	0f b6 16             	movzbl (%rsi),%edx
+  800d55:	84 d2                	test   %dl,%dl
+  800d57:	74 10                	je     800d69 <strlcpy+0x29>
+            *dst++ = *src++;
+  800d59:	48 83 c6 01          	add    $0x1,%rsi
+  800d5d:	48 83 c0 01          	add    $0x1,%rax
+  800d61:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800d64:	48 39 c8             	cmp    %rcx,%rax
+  800d67:	75 e9                	jne    800d52 <strlcpy+0x12>
+        *dst = '\0';
+  800d69:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800d6c:	48 29 f8             	sub    %rdi,%rax
+}
+  800d6f:	c3                   	ret
+
+0000000000800d70 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800d70:	0f b6 07             	movzbl (%rdi),%eax
+  800d73:	84 c0                	test   %al,%al
+  800d75:	74 13                	je     800d8a <strcmp+0x1a>
+  800d77:	38 06                	cmp    %al,(%rsi)
+  800d79:	75 0f                	jne    800d8a <strcmp+0x1a>
+  800d7b:	48 83 c7 01          	add    $0x1,%rdi
+  800d7f:	48 83 c6 01          	add    $0x1,%rsi
+  800d83:	0f b6 07             	movzbl (%rdi),%eax
+  800d86:	84 c0                	test   %al,%al
+  800d88:	75 ed                	jne    800d77 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800d8a:	0f b6 c0             	movzbl %al,%eax
+  800d8d:	0f b6 16             	movzbl (%rsi),%edx
+  800d90:	29 d0                	sub    %edx,%eax
+}
+  800d92:	c3                   	ret
+
+0000000000800d93 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800d93:	48 85 d2             	test   %rdx,%rdx
+  800d96:	74 1f                	je     800db7 <strncmp+0x24>
+  800d98:	0f b6 07             	movzbl (%rdi),%eax
+  800d9b:	84 c0                	test   %al,%al
+  800d9d:	74 1e                	je     800dbd <strncmp+0x2a>
+  800d9f:	3a 06                	cmp    (%rsi),%al
+  800da1:	75 1a                	jne    800dbd <strncmp+0x2a>
+  800da3:	48 83 c7 01          	add    $0x1,%rdi
+  800da7:	48 83 c6 01          	add    $0x1,%rsi
+  800dab:	48 83 ea 01          	sub    $0x1,%rdx
+  800daf:	75 e7                	jne    800d98 <strncmp+0x5>
+
+    if (!n) return 0;
+  800db1:	b8 00 00 00 00       	mov    $0x0,%eax
+  800db6:	c3                   	ret
+  800db7:	b8 00 00 00 00       	mov    $0x0,%eax
+  800dbc:	c3                   	ret
+  800dbd:	48 85 d2             	test   %rdx,%rdx
+  800dc0:	74 09                	je     800dcb <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800dc2:	0f b6 07             	movzbl (%rdi),%eax
+  800dc5:	0f b6 16             	movzbl (%rsi),%edx
+  800dc8:	29 d0                	sub    %edx,%eax
+  800dca:	c3                   	ret
+    if (!n) return 0;
+  800dcb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800dd0:	c3                   	ret
+
+0000000000800dd1 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800dd1:	0f b6 17             	movzbl (%rdi),%edx
+  800dd4:	84 d2                	test   %dl,%dl
+  800dd6:	74 18                	je     800df0 <strchr+0x1f>
+        if (*str == c) {
+  800dd8:	0f be d2             	movsbl %dl,%edx
+  800ddb:	39 f2                	cmp    %esi,%edx
+  800ddd:	74 17                	je     800df6 <strchr+0x25>
+    for (; *str; str++) {
+  800ddf:	48 83 c7 01          	add    $0x1,%rdi
+  800de3:	0f b6 17             	movzbl (%rdi),%edx
+  800de6:	84 d2                	test   %dl,%dl
+  800de8:	75 ee                	jne    800dd8 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800dea:	b8 00 00 00 00       	mov    $0x0,%eax
+  800def:	c3                   	ret
+  800df0:	b8 00 00 00 00       	mov    $0x0,%eax
+  800df5:	c3                   	ret
+  800df6:	48 89 f8             	mov    %rdi,%rax
+}
+  800df9:	c3                   	ret
+
+0000000000800dfa <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800dfa:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800dfd:	0f b6 17             	movzbl (%rdi),%edx
+  800e00:	84 d2                	test   %dl,%dl
+  800e02:	74 13                	je     800e17 <strfind+0x1d>
+  800e04:	0f be d2             	movsbl %dl,%edx
+  800e07:	39 f2                	cmp    %esi,%edx
+  800e09:	74 0b                	je     800e16 <strfind+0x1c>
+  800e0b:	48 83 c0 01          	add    $0x1,%rax
+  800e0f:	0f b6 10             	movzbl (%rax),%edx
+  800e12:	84 d2                	test   %dl,%dl
+  800e14:	75 ee                	jne    800e04 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800e16:	c3                   	ret
+  800e17:	c3                   	ret
+
+0000000000800e18 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800e18:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800e1b:	48 89 f8             	mov    %rdi,%rax
+  800e1e:	48 f7 d8             	neg    %rax
+  800e21:	83 e0 07             	and    $0x7,%eax
+  800e24:	49 89 d1             	mov    %rdx,%r9
+  800e27:	49 29 c1             	sub    %rax,%r9
+  800e2a:	78 36                	js     800e62 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800e2c:	40 0f b6 c6          	movzbl %sil,%eax
+  800e30:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800e37:	01 01 01 
+  800e3a:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800e3e:	40 f6 c7 07          	test   $0x7,%dil
+  800e42:	75 38                	jne    800e7c <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800e44:	4c 89 c9             	mov    %r9,%rcx
+  800e47:	48 c1 f9 03          	sar    $0x3,%rcx
+  800e4b:	74 0c                	je     800e59 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800e4d:	fc                   	cld
+  800e4e:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800e51:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800e55:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800e59:	4d 85 c9             	test   %r9,%r9
+  800e5c:	75 45                	jne    800ea3 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800e5e:	4c 89 c0             	mov    %r8,%rax
+  800e61:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800e62:	48 85 d2             	test   %rdx,%rdx
+  800e65:	74 f7                	je     800e5e <memset+0x46>
+  800e67:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800e6a:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800e6d:	48 83 c0 01          	add    $0x1,%rax
+  800e71:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  800e75:	48 39 c2             	cmp    %rax,%rdx
+  800e78:	75 f3                	jne    800e6d <memset+0x55>
+  800e7a:	eb e2                	jmp    800e5e <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  800e7c:	40 f6 c7 01          	test   $0x1,%dil
+  800e80:	74 06                	je     800e88 <memset+0x70>
+  800e82:	88 07                	mov    %al,(%rdi)
+  800e84:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800e88:	40 f6 c7 02          	test   $0x2,%dil
+  800e8c:	74 07                	je     800e95 <memset+0x7d>
+  800e8e:	66 89 07             	mov    %ax,(%rdi)
+  800e91:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800e95:	40 f6 c7 04          	test   $0x4,%dil
+  800e99:	74 a9                	je     800e44 <memset+0x2c>
+  800e9b:	89 07                	mov    %eax,(%rdi)
+  800e9d:	48 83 c7 04          	add    $0x4,%rdi
+  800ea1:	eb a1                	jmp    800e44 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800ea3:	41 f6 c1 04          	test   $0x4,%r9b
+  800ea7:	74 06                	je     800eaf <memset+0x97>
+  800ea9:	89 07                	mov    %eax,(%rdi)
+  800eab:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800eaf:	41 f6 c1 02          	test   $0x2,%r9b
+  800eb3:	74 07                	je     800ebc <memset+0xa4>
+  800eb5:	66 89 07             	mov    %ax,(%rdi)
+  800eb8:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  800ebc:	41 f6 c1 01          	test   $0x1,%r9b
+  800ec0:	74 9c                	je     800e5e <memset+0x46>
+  800ec2:	88 07                	mov    %al,(%rdi)
+  800ec4:	eb 98                	jmp    800e5e <memset+0x46>
+
+0000000000800ec6 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  800ec6:	48 89 f8             	mov    %rdi,%rax
+  800ec9:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  800ecc:	48 39 fe             	cmp    %rdi,%rsi
+  800ecf:	73 3b                	jae    800f0c <memmove+0x46>
+  800ed1:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  800ed5:	48 39 d7             	cmp    %rdx,%rdi
+  800ed8:	73 32                	jae    800f0c <memmove+0x46>
+        s += n;
+        d += n;
+  800eda:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800ede:	48 89 d6             	mov    %rdx,%rsi
+  800ee1:	48 09 fe             	or     %rdi,%rsi
+  800ee4:	48 09 ce             	or     %rcx,%rsi
+  800ee7:	40 f6 c6 07          	test   $0x7,%sil
+  800eeb:	75 12                	jne    800eff <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  800eed:	48 83 ef 08          	sub    $0x8,%rdi
+  800ef1:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  800ef5:	48 c1 e9 03          	shr    $0x3,%rcx
+  800ef9:	fd                   	std
+  800efa:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  800efd:	fc                   	cld
+  800efe:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  800eff:	48 83 ef 01          	sub    $0x1,%rdi
+  800f03:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  800f07:	fd                   	std
+  800f08:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  800f0a:	eb f1                	jmp    800efd <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800f0c:	48 89 f2             	mov    %rsi,%rdx
+  800f0f:	48 09 c2             	or     %rax,%rdx
+  800f12:	48 09 ca             	or     %rcx,%rdx
+  800f15:	f6 c2 07             	test   $0x7,%dl
+  800f18:	75 0c                	jne    800f26 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  800f1a:	48 c1 e9 03          	shr    $0x3,%rcx
+  800f1e:	48 89 c7             	mov    %rax,%rdi
+  800f21:	fc                   	cld
+  800f22:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  800f25:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  800f26:	48 89 c7             	mov    %rax,%rdi
+  800f29:	fc                   	cld
+  800f2a:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  800f2c:	c3                   	ret
+
+0000000000800f2d <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  800f2d:	55                   	push   %rbp
+  800f2e:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  800f31:	48 b8 c6 0e 80 00 00 	movabs $0x800ec6,%rax
+  800f38:	00 00 00 
+  800f3b:	ff d0                	call   *%rax
+}
+  800f3d:	5d                   	pop    %rbp
+  800f3e:	c3                   	ret
+
+0000000000800f3f <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  800f3f:	55                   	push   %rbp
+  800f40:	48 89 e5             	mov    %rsp,%rbp
+  800f43:	41 57                	push   %r15
+  800f45:	41 56                	push   %r14
+  800f47:	41 55                	push   %r13
+  800f49:	41 54                	push   %r12
+  800f4b:	53                   	push   %rbx
+  800f4c:	48 83 ec 08          	sub    $0x8,%rsp
+  800f50:	49 89 fe             	mov    %rdi,%r14
+  800f53:	49 89 f7             	mov    %rsi,%r15
+  800f56:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  800f59:	48 89 f7             	mov    %rsi,%rdi
+  800f5c:	48 b8 8e 0c 80 00 00 	movabs $0x800c8e,%rax
+  800f63:	00 00 00 
+  800f66:	ff d0                	call   *%rax
+  800f68:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  800f6b:	48 89 de             	mov    %rbx,%rsi
+  800f6e:	4c 89 f7             	mov    %r14,%rdi
+  800f71:	48 b8 a9 0c 80 00 00 	movabs $0x800ca9,%rax
+  800f78:	00 00 00 
+  800f7b:	ff d0                	call   *%rax
+  800f7d:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  800f80:	48 39 c3             	cmp    %rax,%rbx
+  800f83:	74 36                	je     800fbb <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  800f85:	48 89 d8             	mov    %rbx,%rax
+  800f88:	4c 29 e8             	sub    %r13,%rax
+  800f8b:	49 39 c4             	cmp    %rax,%r12
+  800f8e:	73 31                	jae    800fc1 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  800f90:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  800f95:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800f99:	4c 89 fe             	mov    %r15,%rsi
+  800f9c:	48 b8 2d 0f 80 00 00 	movabs $0x800f2d,%rax
+  800fa3:	00 00 00 
+  800fa6:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  800fa8:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  800fac:	48 83 c4 08          	add    $0x8,%rsp
+  800fb0:	5b                   	pop    %rbx
+  800fb1:	41 5c                	pop    %r12
+  800fb3:	41 5d                	pop    %r13
+  800fb5:	41 5e                	pop    %r14
+  800fb7:	41 5f                	pop    %r15
+  800fb9:	5d                   	pop    %rbp
+  800fba:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  800fbb:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800fbf:	eb eb                	jmp    800fac <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  800fc1:	48 83 eb 01          	sub    $0x1,%rbx
+  800fc5:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800fc9:	48 89 da             	mov    %rbx,%rdx
+  800fcc:	4c 89 fe             	mov    %r15,%rsi
+  800fcf:	48 b8 2d 0f 80 00 00 	movabs $0x800f2d,%rax
+  800fd6:	00 00 00 
+  800fd9:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  800fdb:	49 01 de             	add    %rbx,%r14
+  800fde:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  800fe3:	eb c3                	jmp    800fa8 <strlcat+0x69>
+
+0000000000800fe5 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  800fe5:	48 85 d2             	test   %rdx,%rdx
+  800fe8:	74 2d                	je     801017 <memcmp+0x32>
+  800fea:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  800fef:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800ff3:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  800ff8:	44 38 c1             	cmp    %r8b,%cl
+  800ffb:	75 0f                	jne    80100c <memcmp+0x27>
+    while (n-- > 0) {
+  800ffd:	48 83 c0 01          	add    $0x1,%rax
+  801001:	48 39 c2             	cmp    %rax,%rdx
+  801004:	75 e9                	jne    800fef <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  801006:	b8 00 00 00 00       	mov    $0x0,%eax
+  80100b:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  80100c:	0f b6 c1             	movzbl %cl,%eax
+  80100f:	45 0f b6 c0          	movzbl %r8b,%r8d
+  801013:	44 29 c0             	sub    %r8d,%eax
+  801016:	c3                   	ret
+    return 0;
+  801017:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80101c:	c3                   	ret
+
+000000000080101d <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  80101d:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  801021:	48 39 c7             	cmp    %rax,%rdi
+  801024:	73 0f                	jae    801035 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  801026:	40 38 37             	cmp    %sil,(%rdi)
+  801029:	74 0e                	je     801039 <memfind+0x1c>
+    for (; src < end; src++) {
+  80102b:	48 83 c7 01          	add    $0x1,%rdi
+  80102f:	48 39 f8             	cmp    %rdi,%rax
+  801032:	75 f2                	jne    801026 <memfind+0x9>
+  801034:	c3                   	ret
+  801035:	48 89 f8             	mov    %rdi,%rax
+  801038:	c3                   	ret
+  801039:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  80103c:	c3                   	ret
+
+000000000080103d <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  80103d:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  801040:	0f b6 37             	movzbl (%rdi),%esi
+  801043:	40 80 fe 20          	cmp    $0x20,%sil
+  801047:	74 06                	je     80104f <strtol+0x12>
+  801049:	40 80 fe 09          	cmp    $0x9,%sil
+  80104d:	75 13                	jne    801062 <strtol+0x25>
+  80104f:	48 83 c7 01          	add    $0x1,%rdi
+  801053:	0f b6 37             	movzbl (%rdi),%esi
+  801056:	40 80 fe 20          	cmp    $0x20,%sil
+  80105a:	74 f3                	je     80104f <strtol+0x12>
+  80105c:	40 80 fe 09          	cmp    $0x9,%sil
+  801060:	74 ed                	je     80104f <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  801062:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  801065:	83 e0 fd             	and    $0xfffffffd,%eax
+  801068:	3c 01                	cmp    $0x1,%al
+  80106a:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  80106e:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  801074:	75 0f                	jne    801085 <strtol+0x48>
+  801076:	80 3f 30             	cmpb   $0x30,(%rdi)
+  801079:	74 14                	je     80108f <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  80107b:	85 d2                	test   %edx,%edx
+  80107d:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801082:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  801085:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  80108a:	4c 63 ca             	movslq %edx,%r9
+  80108d:	eb 36                	jmp    8010c5 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  80108f:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  801093:	74 0f                	je     8010a4 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  801095:	85 d2                	test   %edx,%edx
+  801097:	75 ec                	jne    801085 <strtol+0x48>
+        s++;
+  801099:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  80109d:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  8010a2:	eb e1                	jmp    801085 <strtol+0x48>
+        s += 2;
+  8010a4:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  8010a8:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  8010ad:	eb d6                	jmp    801085 <strtol+0x48>
+            dig -= '0';
+  8010af:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  8010b2:	44 0f b6 c1          	movzbl %cl,%r8d
+  8010b6:	41 39 d0             	cmp    %edx,%r8d
+  8010b9:	7d 21                	jge    8010dc <strtol+0x9f>
+        val = val * base + dig;
+  8010bb:	49 0f af c1          	imul   %r9,%rax
+  8010bf:	0f b6 c9             	movzbl %cl,%ecx
+  8010c2:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  8010c5:	48 83 c7 01          	add    $0x1,%rdi
+  8010c9:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  8010cd:	80 f9 39             	cmp    $0x39,%cl
+  8010d0:	76 dd                	jbe    8010af <strtol+0x72>
+        else if (dig - 'a' < 27)
+  8010d2:	80 f9 7b             	cmp    $0x7b,%cl
+  8010d5:	77 05                	ja     8010dc <strtol+0x9f>
+            dig -= 'a' - 10;
+  8010d7:	83 e9 57             	sub    $0x57,%ecx
+  8010da:	eb d6                	jmp    8010b2 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  8010dc:	4d 85 d2             	test   %r10,%r10
+  8010df:	74 03                	je     8010e4 <strtol+0xa7>
+  8010e1:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  8010e4:	48 89 c2             	mov    %rax,%rdx
+  8010e7:	48 f7 da             	neg    %rdx
+  8010ea:	40 80 fe 2d          	cmp    $0x2d,%sil
+  8010ee:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  8010f2:	c3                   	ret
+
+00000000008010f3 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  8010f3:	55                   	push   %rbp
+  8010f4:	48 89 e5             	mov    %rsp,%rbp
+  8010f7:	53                   	push   %rbx
+  8010f8:	48 89 fa             	mov    %rdi,%rdx
+  8010fb:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8010fe:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801103:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801108:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80110d:	be 00 00 00 00       	mov    $0x0,%esi
+  801112:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801118:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  80111a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80111e:	c9                   	leave
+  80111f:	c3                   	ret
+
+0000000000801120 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  801120:	55                   	push   %rbp
+  801121:	48 89 e5             	mov    %rsp,%rbp
+  801124:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801125:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80112a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80112f:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801134:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801139:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80113e:	be 00 00 00 00       	mov    $0x0,%esi
+  801143:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801149:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  80114b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80114f:	c9                   	leave
+  801150:	c3                   	ret
+
+0000000000801151 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  801151:	55                   	push   %rbp
+  801152:	48 89 e5             	mov    %rsp,%rbp
+  801155:	53                   	push   %rbx
+  801156:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  80115a:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80115d:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801162:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801167:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80116c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801171:	be 00 00 00 00       	mov    $0x0,%esi
+  801176:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80117c:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80117e:	48 85 c0             	test   %rax,%rax
+  801181:	7f 06                	jg     801189 <sys_env_destroy+0x38>
+}
+  801183:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801187:	c9                   	leave
+  801188:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801189:	49 89 c0             	mov    %rax,%r8
+  80118c:	b9 03 00 00 00       	mov    $0x3,%ecx
+  801191:	48 ba f0 34 80 00 00 	movabs $0x8034f0,%rdx
+  801198:	00 00 00 
+  80119b:	be 26 00 00 00       	mov    $0x26,%esi
+  8011a0:	48 bf 0f 35 80 00 00 	movabs $0x80350f,%rdi
+  8011a7:	00 00 00 
+  8011aa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011af:	49 b9 57 02 80 00 00 	movabs $0x800257,%r9
+  8011b6:	00 00 00 
+  8011b9:	41 ff d1             	call   *%r9
+
+00000000008011bc <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  8011bc:	55                   	push   %rbp
+  8011bd:	48 89 e5             	mov    %rsp,%rbp
+  8011c0:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8011c1:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8011c6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011cb:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8011d0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011d5:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8011da:	be 00 00 00 00       	mov    $0x0,%esi
+  8011df:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8011e5:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  8011e7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8011eb:	c9                   	leave
+  8011ec:	c3                   	ret
+
+00000000008011ed <sys_yield>:
+
+void
+sys_yield(void) {
+  8011ed:	55                   	push   %rbp
+  8011ee:	48 89 e5             	mov    %rsp,%rbp
+  8011f1:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8011f2:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8011f7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011fc:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801201:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801206:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80120b:	be 00 00 00 00       	mov    $0x0,%esi
+  801210:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801216:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  801218:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80121c:	c9                   	leave
+  80121d:	c3                   	ret
+
+000000000080121e <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  80121e:	55                   	push   %rbp
+  80121f:	48 89 e5             	mov    %rsp,%rbp
+  801222:	53                   	push   %rbx
+  801223:	48 89 fa             	mov    %rdi,%rdx
+  801226:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801229:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80122e:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  801235:	00 00 00 
+  801238:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80123d:	be 00 00 00 00       	mov    $0x0,%esi
+  801242:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801248:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  80124a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80124e:	c9                   	leave
+  80124f:	c3                   	ret
+
+0000000000801250 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  801250:	55                   	push   %rbp
+  801251:	48 89 e5             	mov    %rsp,%rbp
+  801254:	53                   	push   %rbx
+  801255:	49 89 f8             	mov    %rdi,%r8
+  801258:	48 89 d3             	mov    %rdx,%rbx
+  80125b:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80125e:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801263:	4c 89 c2             	mov    %r8,%rdx
+  801266:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801269:	be 00 00 00 00       	mov    $0x0,%esi
+  80126e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801274:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  801276:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80127a:	c9                   	leave
+  80127b:	c3                   	ret
+
+000000000080127c <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  80127c:	55                   	push   %rbp
+  80127d:	48 89 e5             	mov    %rsp,%rbp
+  801280:	53                   	push   %rbx
+  801281:	48 83 ec 08          	sub    $0x8,%rsp
+  801285:	89 f8                	mov    %edi,%eax
+  801287:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  80128a:	48 63 f9             	movslq %ecx,%rdi
+  80128d:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801290:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801295:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801298:	be 00 00 00 00       	mov    $0x0,%esi
+  80129d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8012a3:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8012a5:	48 85 c0             	test   %rax,%rax
+  8012a8:	7f 06                	jg     8012b0 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  8012aa:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012ae:	c9                   	leave
+  8012af:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8012b0:	49 89 c0             	mov    %rax,%r8
+  8012b3:	b9 04 00 00 00       	mov    $0x4,%ecx
+  8012b8:	48 ba f0 34 80 00 00 	movabs $0x8034f0,%rdx
+  8012bf:	00 00 00 
+  8012c2:	be 26 00 00 00       	mov    $0x26,%esi
+  8012c7:	48 bf 0f 35 80 00 00 	movabs $0x80350f,%rdi
+  8012ce:	00 00 00 
+  8012d1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012d6:	49 b9 57 02 80 00 00 	movabs $0x800257,%r9
+  8012dd:	00 00 00 
+  8012e0:	41 ff d1             	call   *%r9
+
+00000000008012e3 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8012e3:	55                   	push   %rbp
+  8012e4:	48 89 e5             	mov    %rsp,%rbp
+  8012e7:	53                   	push   %rbx
+  8012e8:	48 83 ec 08          	sub    $0x8,%rsp
+  8012ec:	89 f8                	mov    %edi,%eax
+  8012ee:	49 89 f2             	mov    %rsi,%r10
+  8012f1:	48 89 cf             	mov    %rcx,%rdi
+  8012f4:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  8012f7:	48 63 da             	movslq %edx,%rbx
+  8012fa:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8012fd:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801302:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801305:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  801308:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80130a:	48 85 c0             	test   %rax,%rax
+  80130d:	7f 06                	jg     801315 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  80130f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801313:	c9                   	leave
+  801314:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801315:	49 89 c0             	mov    %rax,%r8
+  801318:	b9 05 00 00 00       	mov    $0x5,%ecx
+  80131d:	48 ba f0 34 80 00 00 	movabs $0x8034f0,%rdx
+  801324:	00 00 00 
+  801327:	be 26 00 00 00       	mov    $0x26,%esi
+  80132c:	48 bf 0f 35 80 00 00 	movabs $0x80350f,%rdi
+  801333:	00 00 00 
+  801336:	b8 00 00 00 00       	mov    $0x0,%eax
+  80133b:	49 b9 57 02 80 00 00 	movabs $0x800257,%r9
+  801342:	00 00 00 
+  801345:	41 ff d1             	call   *%r9
+
+0000000000801348 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  801348:	55                   	push   %rbp
+  801349:	48 89 e5             	mov    %rsp,%rbp
+  80134c:	53                   	push   %rbx
+  80134d:	48 83 ec 08          	sub    $0x8,%rsp
+  801351:	48 89 f1             	mov    %rsi,%rcx
+  801354:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  801357:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80135a:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80135f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801364:	be 00 00 00 00       	mov    $0x0,%esi
+  801369:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80136f:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801371:	48 85 c0             	test   %rax,%rax
+  801374:	7f 06                	jg     80137c <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  801376:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80137a:	c9                   	leave
+  80137b:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80137c:	49 89 c0             	mov    %rax,%r8
+  80137f:	b9 06 00 00 00       	mov    $0x6,%ecx
+  801384:	48 ba f0 34 80 00 00 	movabs $0x8034f0,%rdx
+  80138b:	00 00 00 
+  80138e:	be 26 00 00 00       	mov    $0x26,%esi
+  801393:	48 bf 0f 35 80 00 00 	movabs $0x80350f,%rdi
+  80139a:	00 00 00 
+  80139d:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013a2:	49 b9 57 02 80 00 00 	movabs $0x800257,%r9
+  8013a9:	00 00 00 
+  8013ac:	41 ff d1             	call   *%r9
+
+00000000008013af <sys_region_batch>:
+
+int
+sys_region_batch(const struct RegionOp *ops, size_t count) {
+  8013af:	55                   	push   %rbp
+  8013b0:	48 89 e5             	mov    %rsp,%rbp
+  8013b3:	53                   	push   %rbx
+  8013b4:	48 83 ec 08          	sub    $0x8,%rsp
+  8013b8:	48 89 fa             	mov    %rdi,%rdx
+  8013bb:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8013be:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8013c3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013c8:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013cd:	be 00 00 00 00       	mov    $0x0,%esi
+  8013d2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013d8:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8013da:	48 85 c0             	test   %rax,%rax
+  8013dd:	7f 06                	jg     8013e5 <sys_region_batch+0x36>
+        else
+            platform_asan_unpoison(va, ops[i].size);
+    }
+#endif
+    return res;
+}
+  8013df:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013e3:	c9                   	leave
+  8013e4:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8013e5:	49 89 c0             	mov    %rax,%r8
+  8013e8:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  8013ed:	48 ba f0 34 80 00 00 	movabs $0x8034f0,%rdx
+  8013f4:	00 00 00 
+  8013f7:	be 26 00 00 00       	mov    $0x26,%esi
+  8013fc:	48 bf 0f 35 80 00 00 	movabs $0x80350f,%rdi
+  801403:	00 00 00 
+  801406:	b8 00 00 00 00       	mov    $0x0,%eax
+  80140b:	49 b9 57 02 80 00 00 	movabs $0x800257,%r9
+  801412:	00 00 00 
+  801415:	41 ff d1             	call   *%r9
+
+0000000000801418 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  801418:	55                   	push   %rbp
+  801419:	48 89 e5             	mov    %rsp,%rbp
+  80141c:	53                   	push   %rbx
+  80141d:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  801421:	48 63 ce             	movslq %esi,%rcx
+  801424:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801427:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80142c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801431:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801436:	be 00 00 00 00       	mov    $0x0,%esi
+  80143b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801441:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801443:	48 85 c0             	test   %rax,%rax
+  801446:	7f 06                	jg     80144e <sys_env_set_status+0x36>
+}
+  801448:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80144c:	c9                   	leave
+  80144d:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80144e:	49 89 c0             	mov    %rax,%r8
+  801451:	b9 09 00 00 00       	mov    $0x9,%ecx
+  801456:	48 ba f0 34 80 00 00 	movabs $0x8034f0,%rdx
+  80145d:	00 00 00 
+  801460:	be 26 00 00 00       	mov    $0x26,%esi
+  801465:	48 bf 0f 35 80 00 00 	movabs $0x80350f,%rdi
+  80146c:	00 00 00 
+  80146f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801474:	49 b9 57 02 80 00 00 	movabs $0x800257,%r9
+  80147b:	00 00 00 
+  80147e:	41 ff d1             	call   *%r9
+
+0000000000801481 <sys_env_set_weight>:
+
+int
+sys_env_set_weight(envid_t envid, uint32_t weight) {
+  801481:	55                   	push   %rbp
+  801482:	48 89 e5             	mov    %rsp,%rbp
+  801485:	53                   	push   %rbx
+  801486:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_weight, 1, envid, weight, 0, 0, 0, 0);
+  80148a:	89 f1                	mov    %esi,%ecx
+  80148c:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80148f:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801494:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801499:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80149e:	be 00 00 00 00       	mov    $0x0,%esi
+  8014a3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014a9:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8014ab:	48 85 c0             	test   %rax,%rax
+  8014ae:	7f 06                	jg     8014b6 <sys_env_set_weight+0x35>
+}
+  8014b0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014b4:	c9                   	leave
+  8014b5:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8014b6:	49 89 c0             	mov    %rax,%r8
+  8014b9:	b9 10 00 00 00       	mov    $0x10,%ecx
+  8014be:	48 ba f0 34 80 00 00 	movabs $0x8034f0,%rdx
+  8014c5:	00 00 00 
+  8014c8:	be 26 00 00 00       	mov    $0x26,%esi
+  8014cd:	48 bf 0f 35 80 00 00 	movabs $0x80350f,%rdi
+  8014d4:	00 00 00 
+  8014d7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014dc:	49 b9 57 02 80 00 00 	movabs $0x800257,%r9
+  8014e3:	00 00 00 
+  8014e6:	41 ff d1             	call   *%r9
+
+00000000008014e9 <sys_env_set_rt>:
+
+int
+sys_env_set_rt(envid_t envid, uint64_t period, uint64_t budget, uint64_t deadline) {
+  8014e9:	55                   	push   %rbp
+  8014ea:	48 89 e5             	mov    %rsp,%rbp
+  8014ed:	53                   	push   %rbx
+  8014ee:	48 83 ec 08          	sub    $0x8,%rsp
+  8014f2:	89 f8                	mov    %edi,%eax
+  8014f4:	48 89 d3             	mov    %rdx,%rbx
+  8014f7:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_env_set_rt, 1, envid, period, budget, deadline, 0, 0);
+  8014fa:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8014fd:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801502:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801505:	be 00 00 00 00       	mov    $0x0,%esi
+  80150a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801510:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801512:	48 85 c0             	test   %rax,%rax
+  801515:	7f 06                	jg     80151d <sys_env_set_rt+0x34>
+}
+  801517:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80151b:	c9                   	leave
+  80151c:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80151d:	49 89 c0             	mov    %rax,%r8
+  801520:	b9 11 00 00 00       	mov    $0x11,%ecx
+  801525:	48 ba f0 34 80 00 00 	movabs $0x8034f0,%rdx
+  80152c:	00 00 00 
+  80152f:	be 26 00 00 00       	mov    $0x26,%esi
+  801534:	48 bf 0f 35 80 00 00 	movabs $0x80350f,%rdi
+  80153b:	00 00 00 
+  80153e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801543:	49 b9 57 02 80 00 00 	movabs $0x800257,%r9
+  80154a:	00 00 00 
+  80154d:	41 ff d1             	call   *%r9
+
+0000000000801550 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  801550:	55                   	push   %rbp
+  801551:	48 89 e5             	mov    %rsp,%rbp
+  801554:	53                   	push   %rbx
+  801555:	48 83 ec 08          	sub    $0x8,%rsp
+  801559:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  80155c:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80155f:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801564:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801569:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80156e:	be 00 00 00 00       	mov    $0x0,%esi
+  801573:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801579:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80157b:	48 85 c0             	test   %rax,%rax
+  80157e:	7f 06                	jg     801586 <sys_env_set_trapframe+0x36>
+}
+  801580:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801584:	c9                   	leave
+  801585:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801586:	49 89 c0             	mov    %rax,%r8
+  801589:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  80158e:	48 ba f0 34 80 00 00 	movabs $0x8034f0,%rdx
+  801595:	00 00 00 
+  801598:	be 26 00 00 00       	mov    $0x26,%esi
+  80159d:	48 bf 0f 35 80 00 00 	movabs $0x80350f,%rdi
+  8015a4:	00 00 00 
+  8015a7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015ac:	49 b9 57 02 80 00 00 	movabs $0x800257,%r9
+  8015b3:	00 00 00 
+  8015b6:	41 ff d1             	call   *%r9
+
+00000000008015b9 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  8015b9:	55                   	push   %rbp
+  8015ba:	48 89 e5             	mov    %rsp,%rbp
+  8015bd:	53                   	push   %rbx
+  8015be:	48 83 ec 08          	sub    $0x8,%rsp
+  8015c2:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  8015c5:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8015c8:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8015cd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015d2:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015d7:	be 00 00 00 00       	mov    $0x0,%esi
+  8015dc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015e2:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8015e4:	48 85 c0             	test   %rax,%rax
+  8015e7:	7f 06                	jg     8015ef <sys_env_set_pgfault_upcall+0x36>
+}
+  8015e9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015ed:	c9                   	leave
+  8015ee:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8015ef:	49 89 c0             	mov    %rax,%r8
+  8015f2:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  8015f7:	48 ba f0 34 80 00 00 	movabs $0x8034f0,%rdx
+  8015fe:	00 00 00 
+  801601:	be 26 00 00 00       	mov    $0x26,%esi
+  801606:	48 bf 0f 35 80 00 00 	movabs $0x80350f,%rdi
+  80160d:	00 00 00 
+  801610:	b8 00 00 00 00       	mov    $0x0,%eax
+  801615:	49 b9 57 02 80 00 00 	movabs $0x800257,%r9
+  80161c:	00 00 00 
+  80161f:	41 ff d1             	call   *%r9
+
+0000000000801622 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  801622:	55                   	push   %rbp
+  801623:	48 89 e5             	mov    %rsp,%rbp
+  801626:	53                   	push   %rbx
+  801627:	89 f8                	mov    %edi,%eax
+  801629:	49 89 f1             	mov    %rsi,%r9
+  80162c:	48 89 d3             	mov    %rdx,%rbx
+  80162f:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  801632:	49 63 f0             	movslq %r8d,%rsi
+  801635:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801638:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80163d:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801640:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801646:	cd 30                	int    $0x30
+}
+  801648:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80164c:	c9                   	leave
+  80164d:	c3                   	ret
+
+000000000080164e <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  80164e:	55                   	push   %rbp
+  80164f:	48 89 e5             	mov    %rsp,%rbp
+  801652:	53                   	push   %rbx
+  801653:	48 83 ec 08          	sub    $0x8,%rsp
+  801657:	48 89 fa             	mov    %rdi,%rdx
+  80165a:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80165d:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801662:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801667:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80166c:	be 00 00 00 00       	mov    $0x0,%esi
+  801671:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801677:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801679:	48 85 c0             	test   %rax,%rax
+  80167c:	7f 06                	jg     801684 <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  80167e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801682:	c9                   	leave
+  801683:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801684:	49 89 c0             	mov    %rax,%r8
+  801687:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  80168c:	48 ba f0 34 80 00 00 	movabs $0x8034f0,%rdx
+  801693:	00 00 00 
+  801696:	be 26 00 00 00       	mov    $0x26,%esi
+  80169b:	48 bf 0f 35 80 00 00 	movabs $0x80350f,%rdi
+  8016a2:	00 00 00 
+  8016a5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016aa:	49 b9 57 02 80 00 00 	movabs $0x800257,%r9
+  8016b1:	00 00 00 
+  8016b4:	41 ff d1             	call   *%r9
+
+00000000008016b7 <fork>:
+ * Hint:
+ *   Use sys_map_region, it can perform address space copying in one call
+ *   Remember to fix "thisenv" in the child process.
+ */
+envid_t
+fork(void) {
+  8016b7:	55                   	push   %rbp
+  8016b8:	48 89 e5             	mov    %rsp,%rbp
+  8016bb:	41 55                	push   %r13
+  8016bd:	41 54                	push   %r12
+  8016bf:	53                   	push   %rbx
+  8016c0:	48 83 ec 08          	sub    $0x8,%rsp
+
+/* This must be inlined. Exercise for reader: why? */
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+    envid_t ret;
+    asm volatile("int %2"
+  8016c4:	b8 08 00 00 00       	mov    $0x8,%eax
+  8016c9:	cd 30                	int    $0x30
+  8016cb:	41 89 c5             	mov    %eax,%r13d
+    // LAB 9: Your code here
+
+    envid_t child_id = sys_exofork();
+    if (child_id < 0) {
+  8016ce:	85 c0                	test   %eax,%eax
+  8016d0:	0f 88 ae 00 00 00    	js     801784 <fork+0xcd>
+  8016d6:	89 c3                	mov    %eax,%ebx
+        return child_id;
+    }
+    if (child_id == 0) {
+  8016d8:	0f 84 b4 00 00 00    	je     801792 <fork+0xdb>
+        thisenv = &envs[ENVX(sys_getenvid())];
+        return 0;
+    }
+    int res = sys_map_region(0, NULL, child_id, NULL, MAX_USER_ADDRESS, PROT_ALL | PROT_LAZY | PROT_COMBINE);
+  8016de:	41 b9 df 01 00 00    	mov    $0x1df,%r9d
+  8016e4:	49 b8 00 00 00 00 80 	movabs $0x8000000000,%r8
+  8016eb:	00 00 00 
+  8016ee:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8016f3:	89 c2                	mov    %eax,%edx
+  8016f5:	be 00 00 00 00       	mov    $0x0,%esi
+  8016fa:	bf 00 00 00 00       	mov    $0x0,%edi
+  8016ff:	48 b8 e3 12 80 00 00 	movabs $0x8012e3,%rax
+  801706:	00 00 00 
+  801709:	ff d0                	call   *%rax
+  80170b:	41 89 c4             	mov    %eax,%r12d
+    if (res < 0) {
+  80170e:	85 c0                	test   %eax,%eax
+  801710:	78 5d                	js     80176f <fork+0xb8>
+        goto error;
+    }
+    res = sys_env_set_pgfault_upcall(child_id, envs[ENVX(sys_getenvid())].env_pgfault_upcall);
+  801712:	48 b8 bc 11 80 00 00 	movabs $0x8011bc,%rax
+  801719:	00 00 00 
+  80171c:	ff d0                	call   *%rax
+  80171e:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801723:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+  80172a:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  801731:	00 00 00 
+  801734:	48 01 d0             	add    %rdx,%rax
+  801737:	48 8b b0 88 01 00 00 	mov    0x188(%rax),%rsi
+  80173e:	44 89 ef             	mov    %r13d,%edi
+  801741:	48 b8 b9 15 80 00 00 	movabs $0x8015b9,%rax
+  801748:	00 00 00 
+  80174b:	ff d0                	call   *%rax
+  80174d:	41 89 c4             	mov    %eax,%r12d
+    if (res < 0) {
+  801750:	85 c0                	test   %eax,%eax
+  801752:	78 1b                	js     80176f <fork+0xb8>
+        goto error;
+    }
+    res = sys_env_set_status(child_id, ENV_RUNNABLE);
+  801754:	be 02 00 00 00       	mov    $0x2,%esi
+  801759:	44 89 ef             	mov    %r13d,%edi
+  80175c:	48 b8 18 14 80 00 00 	movabs $0x801418,%rax
+  801763:	00 00 00 
+  801766:	ff d0                	call   *%rax
+  801768:	41 89 c4             	mov    %eax,%r12d
+    if (res < 0) {
+  80176b:	85 c0                	test   %eax,%eax
+  80176d:	79 15                	jns    801784 <fork+0xcd>
+        goto error;
+    }
+    return child_id;
+error:
+    ;
+    int res2 = sys_env_destroy(child_id);
+  80176f:	89 df                	mov    %ebx,%edi
+  801771:	48 b8 51 11 80 00 00 	movabs $0x801151,%rax
+  801778:	00 00 00 
+  80177b:	ff d0                	call   *%rax
+    if (res2 < 0) {
+  80177d:	85 c0                	test   %eax,%eax
+  80177f:	78 42                	js     8017c3 <fork+0x10c>
+        panic("Fork double fault");
+    }
+    return res;
+  801781:	45 89 e5             	mov    %r12d,%r13d
+}
+  801784:	44 89 e8             	mov    %r13d,%eax
+  801787:	48 83 c4 08          	add    $0x8,%rsp
+  80178b:	5b                   	pop    %rbx
+  80178c:	41 5c                	pop    %r12
+  80178e:	41 5d                	pop    %r13
+  801790:	5d                   	pop    %rbp
+  801791:	c3                   	ret
+        thisenv = &envs[ENVX(sys_getenvid())];
+  801792:	48 b8 bc 11 80 00 00 	movabs $0x8011bc,%rax
+  801799:	00 00 00 
+  80179c:	ff d0                	call   *%rax
+  80179e:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8017a3:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+  8017aa:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8017b1:	00 00 00 
+  8017b4:	48 01 d0             	add    %rdx,%rax
+  8017b7:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  8017be:	00 00 00 
+        return 0;
+  8017c1:	eb c1                	jmp    801784 <fork+0xcd>
+        panic("Fork double fault");
+  8017c3:	48 ba 1d 35 80 00 00 	movabs $0x80351d,%rdx
+  8017ca:	00 00 00 
+  8017cd:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8017d2:	48 bf 2f 35 80 00 00 	movabs $0x80352f,%rdi
+  8017d9:	00 00 00 
+  8017dc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017e1:	48 b9 57 02 80 00 00 	movabs $0x800257,%rcx
+  8017e8:	00 00 00 
+  8017eb:	ff d1                	call   *%rcx
+
+00000000008017ed <sfork>:
+
+envid_t
+sfork() {
+  8017ed:	55                   	push   %rbp
+  8017ee:	48 89 e5             	mov    %rsp,%rbp
+    panic("sfork() is not implemented");
+  8017f1:	48 ba 3a 35 80 00 00 	movabs $0x80353a,%rdx
+  8017f8:	00 00 00 
+  8017fb:	be 36 00 00 00       	mov    $0x36,%esi
+  801800:	48 bf 2f 35 80 00 00 	movabs $0x80352f,%rdi
+  801807:	00 00 00 
+  80180a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80180f:	48 b9 57 02 80 00 00 	movabs $0x800257,%rcx
+  801816:	00 00 00 
+  801819:	ff d1                	call   *%rcx
+
+000000000080181b <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  80181b:	55                   	push   %rbp
+  80181c:	48 89 e5             	mov    %rsp,%rbp
+  80181f:	41 55                	push   %r13
+  801821:	41 54                	push   %r12
+  801823:	53                   	push   %rbx
+  801824:	48 83 ec 08          	sub    $0x8,%rsp
+  801828:	49 89 fc             	mov    %rdi,%r12
+  80182b:	48 89 f7             	mov    %rsi,%rdi
+  80182e:	48 89 d3             	mov    %rdx,%rbx
+  801831:	49 89 cd             	mov    %rcx,%r13
+    // LAB 9: Your code here:
+    int res = sys_ipc_recv(!pg ? (void*)MAX_USER_ADDRESS : pg, !size ? 0 : *size);
+  801834:	be 00 00 00 00       	mov    $0x0,%esi
+  801839:	48 85 d2             	test   %rdx,%rdx
+  80183c:	74 03                	je     801841 <ipc_recv+0x26>
+  80183e:	48 8b 32             	mov    (%rdx),%rsi
+  801841:	48 85 ff             	test   %rdi,%rdi
+  801844:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80184b:	00 00 00 
+  80184e:	48 0f 44 f8          	cmove  %rax,%rdi
+  801852:	48 b8 4e 16 80 00 00 	movabs $0x80164e,%rax
+  801859:	00 00 00 
+  80185c:	ff d0                	call   *%rax
+    if (res < 0) {
+  80185e:	85 c0                	test   %eax,%eax
+  801860:	78 66                	js     8018c8 <ipc_recv+0xad>
+        if (size) {
+            *size = 0;
+        }
+        return res;
+    }
+    if (from_env_store) {
+  801862:	4d 85 e4             	test   %r12,%r12
+  801865:	74 14                	je     80187b <ipc_recv+0x60>
+        *from_env_store = thisenv->env_ipc_from;
+  801867:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  80186e:	00 00 00 
+  801871:	8b 80 ac 01 00 00    	mov    0x1ac(%rax),%eax
+  801877:	41 89 04 24          	mov    %eax,(%r12)
+    }
+    if (perm_store) {
+  80187b:	4d 85 ed             	test   %r13,%r13
+  80187e:	74 14                	je     801894 <ipc_recv+0x79>
+        *perm_store = thisenv->env_ipc_perm;
+  801880:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801887:	00 00 00 
+  80188a:	8b 80 b0 01 00 00    	mov    0x1b0(%rax),%eax
+  801890:	41 89 45 00          	mov    %eax,0x0(%r13)
+    }
+    if (size) {
+  801894:	48 85 db             	test   %rbx,%rbx
+  801897:	74 14                	je     8018ad <ipc_recv+0x92>
+        *size = thisenv->env_ipc_maxsz;
+  801899:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  8018a0:	00 00 00 
+  8018a3:	48 8b 80 a0 01 00 00 	mov    0x1a0(%rax),%rax
+  8018aa:	48 89 03             	mov    %rax,(%rbx)
+    }
+    return thisenv->env_ipc_value;
+  8018ad:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  8018b4:	00 00 00 
+  8018b7:	8b 80 a8 01 00 00    	mov    0x1a8(%rax),%eax
+}
+  8018bd:	48 83 c4 08          	add    $0x8,%rsp
+  8018c1:	5b                   	pop    %rbx
+  8018c2:	41 5c                	pop    %r12
+  8018c4:	41 5d                	pop    %r13
+  8018c6:	5d                   	pop    %rbp
+  8018c7:	c3                   	ret
+        if (from_env_store) {
+  8018c8:	4d 85 e4             	test   %r12,%r12
+  8018cb:	74 08                	je     8018d5 <ipc_recv+0xba>
+            *from_env_store = 0;
+  8018cd:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  8018d4:	00 
+        if (perm_store) {
+  8018d5:	4d 85 ed             	test   %r13,%r13
+  8018d8:	74 08                	je     8018e2 <ipc_recv+0xc7>
+            *perm_store = 0;
+  8018da:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  8018e1:	00 
+        if (size) {
+  8018e2:	48 85 db             	test   %rbx,%rbx
+  8018e5:	74 d6                	je     8018bd <ipc_recv+0xa2>
+            *size = 0;
+  8018e7:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  8018ee:	eb cd                	jmp    8018bd <ipc_recv+0xa2>
+
+00000000008018f0 <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  8018f0:	55                   	push   %rbp
+  8018f1:	48 89 e5             	mov    %rsp,%rbp
+  8018f4:	41 57                	push   %r15
+  8018f6:	41 56                	push   %r14
+  8018f8:	41 55                	push   %r13
+  8018fa:	41 54                	push   %r12
+  8018fc:	53                   	push   %rbx
+  8018fd:	48 83 ec 18          	sub    $0x18,%rsp
+  801901:	41 89 fd             	mov    %edi,%r13d
+  801904:	89 75 cc             	mov    %esi,-0x34(%rbp)
+  801907:	49 89 cc             	mov    %rcx,%r12
+  80190a:	44 89 45 c8          	mov    %r8d,-0x38(%rbp)
+    // LAB 9: Your code here:
+    int res = 0;
+    while ((res = sys_ipc_try_send(to_env, val, !pg ? (void*)MAX_USER_ADDRESS : pg, size, perm)) < 0) {
+  80190e:	48 85 d2             	test   %rdx,%rdx
+  801911:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  801918:	00 00 00 
+  80191b:	48 0f 45 c2          	cmovne %rdx,%rax
+  80191f:	48 89 c3             	mov    %rax,%rbx
+  801922:	49 be 22 16 80 00 00 	movabs $0x801622,%r14
+  801929:	00 00 00 
+        if (res != -E_IPC_NOT_RECV) {
+            panic("sys_ipc_try_send failed: %i", res);
+        }
+        sys_yield();
+  80192c:	49 bf ed 11 80 00 00 	movabs $0x8011ed,%r15
+  801933:	00 00 00 
+    while ((res = sys_ipc_try_send(to_env, val, !pg ? (void*)MAX_USER_ADDRESS : pg, size, perm)) < 0) {
+  801936:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  801939:	44 8b 45 c8          	mov    -0x38(%rbp),%r8d
+  80193d:	4c 89 e1             	mov    %r12,%rcx
+  801940:	48 89 da             	mov    %rbx,%rdx
+  801943:	44 89 ef             	mov    %r13d,%edi
+  801946:	41 ff d6             	call   *%r14
+  801949:	85 c0                	test   %eax,%eax
+  80194b:	79 37                	jns    801984 <ipc_send+0x94>
+        if (res != -E_IPC_NOT_RECV) {
+  80194d:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  801950:	75 05                	jne    801957 <ipc_send+0x67>
+        sys_yield();
+  801952:	41 ff d7             	call   *%r15
+  801955:	eb df                	jmp    801936 <ipc_send+0x46>
+            panic("sys_ipc_try_send failed: %i", res);
+  801957:	89 c1                	mov    %eax,%ecx
+  801959:	48 ba 55 35 80 00 00 	movabs $0x803555,%rdx
+  801960:	00 00 00 
+  801963:	be 40 00 00 00       	mov    $0x40,%esi
+  801968:	48 bf 71 35 80 00 00 	movabs $0x803571,%rdi
+  80196f:	00 00 00 
+  801972:	b8 00 00 00 00       	mov    $0x0,%eax
+  801977:	49 b8 57 02 80 00 00 	movabs $0x800257,%r8
+  80197e:	00 00 00 
+  801981:	41 ff d0             	call   *%r8
+    }
+    return;
+}
+  801984:	48 83 c4 18          	add    $0x18,%rsp
+  801988:	5b                   	pop    %rbx
+  801989:	41 5c                	pop    %r12
+  80198b:	41 5d                	pop    %r13
+  80198d:	41 5e                	pop    %r14
+  80198f:	41 5f                	pop    %r15
+  801991:	5d                   	pop    %rbp
+  801992:	c3                   	ret
+
+0000000000801993 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  801993:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  801998:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  80199f:	00 00 00 
+  8019a2:	48 69 d0 d0 01 00 00 	imul   $0x1d0,%rax,%rdx
+  8019a9:	48 01 ca             	add    %rcx,%rdx
+  8019ac:	8b 92 e8 00 00 00    	mov    0xe8(%rdx),%edx
+  8019b2:	39 fa                	cmp    %edi,%edx
+  8019b4:	74 12                	je     8019c8 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  8019b6:	48 83 c0 01          	add    $0x1,%rax
+  8019ba:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  8019c0:	75 e0                	jne    8019a2 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  8019c2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8019c7:	c3                   	ret
+            return envs[i].env_id;
+  8019c8:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+  8019cf:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8019d6:	00 00 00 
+  8019d9:	48 01 d0             	add    %rdx,%rax
+  8019dc:	8b 80 e0 00 00 00    	mov    0xe0(%rax),%eax
+  8019e2:	c3                   	ret
+
+00000000008019e3 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8019e3:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8019ea:	ff ff ff 
+  8019ed:	48 01 f8             	add    %rdi,%rax
+  8019f0:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  8019f4:	c3                   	ret
+
+00000000008019f5 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8019f5:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8019fc:	ff ff ff 
+  8019ff:	48 01 f8             	add    %rdi,%rax
+  801a02:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  801a06:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  801a0c:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  801a10:	c3                   	ret
+
+0000000000801a11 <fd_alloc_from>:
+}
+
+/* Like fd_alloc(), but only considers fds starting from fdnum,
+ * so that several fds can be found before their pages are allocated */
+int
+fd_alloc_from(int fdnum, struct Fd **fd_store) {
+  801a11:	55                   	push   %rbp
+  801a12:	48 89 e5             	mov    %rsp,%rbp
+  801a15:	41 57                	push   %r15
+  801a17:	41 56                	push   %r14
+  801a19:	41 55                	push   %r13
+  801a1b:	41 54                	push   %r12
+  801a1d:	53                   	push   %rbx
+  801a1e:	48 83 ec 08          	sub    $0x8,%rsp
+  801a22:	49 89 f7             	mov    %rsi,%r15
+    for (int i = MAX(fdnum, 0); i < MAXFD; i++) {
+  801a25:	85 ff                	test   %edi,%edi
+  801a27:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  801a2d:	44 0f 49 e7          	cmovns %edi,%r12d
+  801a31:	83 ff 1f             	cmp    $0x1f,%edi
+  801a34:	7f 37                	jg     801a6d <fd_alloc_from+0x5c>
+  801a36:	49 63 dc             	movslq %r12d,%rbx
+  801a39:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  801a40:	48 c1 e3 0c          	shl    $0xc,%rbx
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  801a44:	49 be 1a 2b 80 00 00 	movabs $0x802b1a,%r14
+  801a4b:	00 00 00 
+        struct Fd *fd = INDEX2FD(i);
+  801a4e:	49 89 dd             	mov    %rbx,%r13
+        if (!(get_prot(fd) & PROT_R)) {
+  801a51:	48 89 df             	mov    %rbx,%rdi
+  801a54:	41 ff d6             	call   *%r14
+  801a57:	83 e0 04             	and    $0x4,%eax
+  801a5a:	74 1c                	je     801a78 <fd_alloc_from+0x67>
+    for (int i = MAX(fdnum, 0); i < MAXFD; i++) {
+  801a5c:	41 83 c4 01          	add    $0x1,%r12d
+  801a60:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801a67:	41 83 fc 1f          	cmp    $0x1f,%r12d
+  801a6b:	7e e1                	jle    801a4e <fd_alloc_from+0x3d>
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  801a6d:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801a73:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  801a78:	4d 89 2f             	mov    %r13,(%r15)
+}
+  801a7b:	48 83 c4 08          	add    $0x8,%rsp
+  801a7f:	5b                   	pop    %rbx
+  801a80:	41 5c                	pop    %r12
+  801a82:	41 5d                	pop    %r13
+  801a84:	41 5e                	pop    %r14
+  801a86:	41 5f                	pop    %r15
+  801a88:	5d                   	pop    %rbp
+  801a89:	c3                   	ret
+
+0000000000801a8a <fd_alloc>:
+fd_alloc(struct Fd **fd_store) {
+  801a8a:	55                   	push   %rbp
+  801a8b:	48 89 e5             	mov    %rsp,%rbp
+  801a8e:	48 89 fe             	mov    %rdi,%rsi
+    return fd_alloc_from(0, fd_store);
+  801a91:	bf 00 00 00 00       	mov    $0x0,%edi
+  801a96:	48 b8 11 1a 80 00 00 	movabs $0x801a11,%rax
+  801a9d:	00 00 00 
+  801aa0:	ff d0                	call   *%rax
+}
+  801aa2:	5d                   	pop    %rbp
+  801aa3:	c3                   	ret
+
+0000000000801aa4 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  801aa4:	83 ff 1f             	cmp    $0x1f,%edi
+  801aa7:	77 39                	ja     801ae2 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  801aa9:	55                   	push   %rbp
+  801aaa:	48 89 e5             	mov    %rsp,%rbp
+  801aad:	41 54                	push   %r12
+  801aaf:	53                   	push   %rbx
+  801ab0:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  801ab3:	48 63 df             	movslq %edi,%rbx
+  801ab6:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  801abd:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  801ac1:	48 89 df             	mov    %rbx,%rdi
+  801ac4:	48 b8 1a 2b 80 00 00 	movabs $0x802b1a,%rax
+  801acb:	00 00 00 
+  801ace:	ff d0                	call   *%rax
+  801ad0:	a8 04                	test   $0x4,%al
+  801ad2:	74 14                	je     801ae8 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  801ad4:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  801ad8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801add:	5b                   	pop    %rbx
+  801ade:	41 5c                	pop    %r12
+  801ae0:	5d                   	pop    %rbp
+  801ae1:	c3                   	ret
+        return -E_INVAL;
+  801ae2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801ae7:	c3                   	ret
+        return -E_INVAL;
+  801ae8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801aed:	eb ee                	jmp    801add <fd_lookup+0x39>
+
+0000000000801aef <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  801aef:	55                   	push   %rbp
+  801af0:	48 89 e5             	mov    %rsp,%rbp
+  801af3:	41 54                	push   %r12
+  801af5:	53                   	push   %rbx
+  801af6:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  801af9:	48 b8 00 36 80 00 00 	movabs $0x803600,%rax
+  801b00:	00 00 00 
+  801b03:	48 bb 20 40 80 00 00 	movabs $0x804020,%rbx
+  801b0a:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  801b0d:	39 3b                	cmp    %edi,(%rbx)
+  801b0f:	74 47                	je     801b58 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  801b11:	48 83 c0 08          	add    $0x8,%rax
+  801b15:	48 8b 18             	mov    (%rax),%rbx
+  801b18:	48 85 db             	test   %rbx,%rbx
+  801b1b:	75 f0                	jne    801b0d <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801b1d:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801b24:	00 00 00 
+  801b27:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+  801b2d:	89 fa                	mov    %edi,%edx
+  801b2f:	48 bf 80 35 80 00 00 	movabs $0x803580,%rdi
+  801b36:	00 00 00 
+  801b39:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b3e:	48 b9 a7 03 80 00 00 	movabs $0x8003a7,%rcx
+  801b45:	00 00 00 
+  801b48:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  801b4a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  801b4f:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  801b53:	5b                   	pop    %rbx
+  801b54:	41 5c                	pop    %r12
+  801b56:	5d                   	pop    %rbp
+  801b57:	c3                   	ret
+            return 0;
+  801b58:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b5d:	eb f0                	jmp    801b4f <dev_lookup+0x60>
+
+0000000000801b5f <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  801b5f:	55                   	push   %rbp
+  801b60:	48 89 e5             	mov    %rsp,%rbp
+  801b63:	41 55                	push   %r13
+  801b65:	41 54                	push   %r12
+  801b67:	53                   	push   %rbx
+  801b68:	48 83 ec 18          	sub    $0x18,%rsp
+  801b6c:	48 89 fb             	mov    %rdi,%rbx
+  801b6f:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801b72:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  801b79:	ff ff ff 
+  801b7c:	48 01 df             	add    %rbx,%rdi
+  801b7f:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  801b83:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801b87:	48 b8 a4 1a 80 00 00 	movabs $0x801aa4,%rax
+  801b8e:	00 00 00 
+  801b91:	ff d0                	call   *%rax
+  801b93:	41 89 c5             	mov    %eax,%r13d
+  801b96:	85 c0                	test   %eax,%eax
+  801b98:	78 06                	js     801ba0 <fd_close+0x41>
+  801b9a:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  801b9e:	74 1a                	je     801bba <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  801ba0:	45 84 e4             	test   %r12b,%r12b
+  801ba3:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ba8:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  801bac:	44 89 e8             	mov    %r13d,%eax
+  801baf:	48 83 c4 18          	add    $0x18,%rsp
+  801bb3:	5b                   	pop    %rbx
+  801bb4:	41 5c                	pop    %r12
+  801bb6:	41 5d                	pop    %r13
+  801bb8:	5d                   	pop    %rbp
+  801bb9:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801bba:	8b 3b                	mov    (%rbx),%edi
+  801bbc:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801bc0:	48 b8 ef 1a 80 00 00 	movabs $0x801aef,%rax
+  801bc7:	00 00 00 
+  801bca:	ff d0                	call   *%rax
+  801bcc:	41 89 c5             	mov    %eax,%r13d
+  801bcf:	85 c0                	test   %eax,%eax
+  801bd1:	78 1b                	js     801bee <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  801bd3:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801bd7:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801bdb:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801be1:	48 85 c0             	test   %rax,%rax
+  801be4:	74 08                	je     801bee <fd_close+0x8f>
+  801be6:	48 89 df             	mov    %rbx,%rdi
+  801be9:	ff d0                	call   *%rax
+  801beb:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801bee:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801bf3:	48 89 de             	mov    %rbx,%rsi
+  801bf6:	bf 00 00 00 00       	mov    $0x0,%edi
+  801bfb:	48 b8 48 13 80 00 00 	movabs $0x801348,%rax
+  801c02:	00 00 00 
+  801c05:	ff d0                	call   *%rax
+    return res;
+  801c07:	eb a3                	jmp    801bac <fd_close+0x4d>
+
+0000000000801c09 <close>:
+
+int
+close(int fdnum) {
+  801c09:	55                   	push   %rbp
+  801c0a:	48 89 e5             	mov    %rsp,%rbp
+  801c0d:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  801c11:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801c15:	48 b8 a4 1a 80 00 00 	movabs $0x801aa4,%rax
+  801c1c:	00 00 00 
+  801c1f:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801c21:	85 c0                	test   %eax,%eax
+  801c23:	78 15                	js     801c3a <close+0x31>
+
+    return fd_close(fd, 1);
+  801c25:	be 01 00 00 00       	mov    $0x1,%esi
+  801c2a:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801c2e:	48 b8 5f 1b 80 00 00 	movabs $0x801b5f,%rax
+  801c35:	00 00 00 
+  801c38:	ff d0                	call   *%rax
+}
+  801c3a:	c9                   	leave
+  801c3b:	c3                   	ret
+
+0000000000801c3c <close_all>:
+
+void
+close_all(void) {
+  801c3c:	55                   	push   %rbp
+  801c3d:	48 89 e5             	mov    %rsp,%rbp
+  801c40:	41 54                	push   %r12
+  801c42:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  801c43:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801c48:	49 bc 09 1c 80 00 00 	movabs $0x801c09,%r12
+  801c4f:	00 00 00 
+  801c52:	89 df                	mov    %ebx,%edi
+  801c54:	41 ff d4             	call   *%r12
+  801c57:	83 c3 01             	add    $0x1,%ebx
+  801c5a:	83 fb 20             	cmp    $0x20,%ebx
+  801c5d:	75 f3                	jne    801c52 <close_all+0x16>
+}
+  801c5f:	5b                   	pop    %rbx
+  801c60:	41 5c                	pop    %r12
+  801c62:	5d                   	pop    %rbp
+  801c63:	c3                   	ret
+
+0000000000801c64 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  801c64:	55                   	push   %rbp
+  801c65:	48 89 e5             	mov    %rsp,%rbp
+  801c68:	41 57                	push   %r15
+  801c6a:	41 56                	push   %r14
+  801c6c:	41 55                	push   %r13
+  801c6e:	41 54                	push   %r12
+  801c70:	53                   	push   %rbx
+  801c71:	48 83 ec 18          	sub    $0x18,%rsp
+  801c75:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  801c78:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801c7c:	48 b8 a4 1a 80 00 00 	movabs $0x801aa4,%rax
+  801c83:	00 00 00 
+  801c86:	ff d0                	call   *%rax
+  801c88:	89 c3                	mov    %eax,%ebx
+  801c8a:	85 c0                	test   %eax,%eax
+  801c8c:	0f 88 b8 00 00 00    	js     801d4a <dup+0xe6>
+    close(newfdnum);
+  801c92:	44 89 e7             	mov    %r12d,%edi
+  801c95:	48 b8 09 1c 80 00 00 	movabs $0x801c09,%rax
+  801c9c:	00 00 00 
+  801c9f:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  801ca1:	4d 63 ec             	movslq %r12d,%r13
+  801ca4:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  801cab:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  801caf:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  801cb3:	4c 89 ff             	mov    %r15,%rdi
+  801cb6:	49 be f5 19 80 00 00 	movabs $0x8019f5,%r14
+  801cbd:	00 00 00 
+  801cc0:	41 ff d6             	call   *%r14
+  801cc3:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  801cc6:	4c 89 ef             	mov    %r13,%rdi
+  801cc9:	41 ff d6             	call   *%r14
+  801ccc:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  801ccf:	48 89 df             	mov    %rbx,%rdi
+  801cd2:	48 b8 1a 2b 80 00 00 	movabs $0x802b1a,%rax
+  801cd9:	00 00 00 
+  801cdc:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  801cde:	a8 04                	test   $0x4,%al
+  801ce0:	74 2b                	je     801d0d <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  801ce2:	41 89 c1             	mov    %eax,%r9d
+  801ce5:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801ceb:	4c 89 f1             	mov    %r14,%rcx
+  801cee:	ba 00 00 00 00       	mov    $0x0,%edx
+  801cf3:	48 89 de             	mov    %rbx,%rsi
+  801cf6:	bf 00 00 00 00       	mov    $0x0,%edi
+  801cfb:	48 b8 e3 12 80 00 00 	movabs $0x8012e3,%rax
+  801d02:	00 00 00 
+  801d05:	ff d0                	call   *%rax
+  801d07:	89 c3                	mov    %eax,%ebx
+  801d09:	85 c0                	test   %eax,%eax
+  801d0b:	78 4e                	js     801d5b <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  801d0d:	4c 89 ff             	mov    %r15,%rdi
+  801d10:	48 b8 1a 2b 80 00 00 	movabs $0x802b1a,%rax
+  801d17:	00 00 00 
+  801d1a:	ff d0                	call   *%rax
+  801d1c:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801d1f:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801d25:	4c 89 e9             	mov    %r13,%rcx
+  801d28:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d2d:	4c 89 fe             	mov    %r15,%rsi
+  801d30:	bf 00 00 00 00       	mov    $0x0,%edi
+  801d35:	48 b8 e3 12 80 00 00 	movabs $0x8012e3,%rax
+  801d3c:	00 00 00 
+  801d3f:	ff d0                	call   *%rax
+  801d41:	89 c3                	mov    %eax,%ebx
+  801d43:	85 c0                	test   %eax,%eax
+  801d45:	78 14                	js     801d5b <dup+0xf7>
+
+    return newfdnum;
+  801d47:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  801d4a:	89 d8                	mov    %ebx,%eax
+  801d4c:	48 83 c4 18          	add    $0x18,%rsp
+  801d50:	5b                   	pop    %rbx
+  801d51:	41 5c                	pop    %r12
+  801d53:	41 5d                	pop    %r13
+  801d55:	41 5e                	pop    %r14
+  801d57:	41 5f                	pop    %r15
+  801d59:	5d                   	pop    %rbp
+  801d5a:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  801d5b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801d60:	4c 89 ee             	mov    %r13,%rsi
+  801d63:	bf 00 00 00 00       	mov    $0x0,%edi
+  801d68:	49 bc 48 13 80 00 00 	movabs $0x801348,%r12
+  801d6f:	00 00 00 
+  801d72:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  801d75:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801d7a:	4c 89 f6             	mov    %r14,%rsi
+  801d7d:	bf 00 00 00 00       	mov    $0x0,%edi
+  801d82:	41 ff d4             	call   *%r12
+    return res;
+  801d85:	eb c3                	jmp    801d4a <dup+0xe6>
+
+0000000000801d87 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  801d87:	55                   	push   %rbp
+  801d88:	48 89 e5             	mov    %rsp,%rbp
+  801d8b:	41 56                	push   %r14
+  801d8d:	41 55                	push   %r13
+  801d8f:	41 54                	push   %r12
+  801d91:	53                   	push   %rbx
+  801d92:	48 83 ec 10          	sub    $0x10,%rsp
+  801d96:	89 fb                	mov    %edi,%ebx
+  801d98:	49 89 f4             	mov    %rsi,%r12
+  801d9b:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801d9e:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801da2:	48 b8 a4 1a 80 00 00 	movabs $0x801aa4,%rax
+  801da9:	00 00 00 
+  801dac:	ff d0                	call   *%rax
+  801dae:	85 c0                	test   %eax,%eax
+  801db0:	78 4c                	js     801dfe <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801db2:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801db6:	41 8b 3e             	mov    (%r14),%edi
+  801db9:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801dbd:	48 b8 ef 1a 80 00 00 	movabs $0x801aef,%rax
+  801dc4:	00 00 00 
+  801dc7:	ff d0                	call   *%rax
+  801dc9:	85 c0                	test   %eax,%eax
+  801dcb:	78 35                	js     801e02 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801dcd:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801dd1:	83 e0 03             	and    $0x3,%eax
+  801dd4:	83 f8 01             	cmp    $0x1,%eax
+  801dd7:	74 2d                	je     801e06 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801dd9:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801ddd:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801de1:	48 85 c0             	test   %rax,%rax
+  801de4:	74 56                	je     801e3c <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  801de6:	4c 89 ea             	mov    %r13,%rdx
+  801de9:	4c 89 e6             	mov    %r12,%rsi
+  801dec:	4c 89 f7             	mov    %r14,%rdi
+  801def:	ff d0                	call   *%rax
+}
+  801df1:	48 83 c4 10          	add    $0x10,%rsp
+  801df5:	5b                   	pop    %rbx
+  801df6:	41 5c                	pop    %r12
+  801df8:	41 5d                	pop    %r13
+  801dfa:	41 5e                	pop    %r14
+  801dfc:	5d                   	pop    %rbp
+  801dfd:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801dfe:	48 98                	cltq
+  801e00:	eb ef                	jmp    801df1 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801e02:	48 98                	cltq
+  801e04:	eb eb                	jmp    801df1 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801e06:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801e0d:	00 00 00 
+  801e10:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+  801e16:	89 da                	mov    %ebx,%edx
+  801e18:	48 bf c1 35 80 00 00 	movabs $0x8035c1,%rdi
+  801e1f:	00 00 00 
+  801e22:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e27:	48 b9 a7 03 80 00 00 	movabs $0x8003a7,%rcx
+  801e2e:	00 00 00 
+  801e31:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801e33:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801e3a:	eb b5                	jmp    801df1 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801e3c:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801e43:	eb ac                	jmp    801df1 <read+0x6a>
+
+0000000000801e45 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801e45:	55                   	push   %rbp
+  801e46:	48 89 e5             	mov    %rsp,%rbp
+  801e49:	41 57                	push   %r15
+  801e4b:	41 56                	push   %r14
+  801e4d:	41 55                	push   %r13
+  801e4f:	41 54                	push   %r12
+  801e51:	53                   	push   %rbx
+  801e52:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  801e56:	48 85 d2             	test   %rdx,%rdx
+  801e59:	74 54                	je     801eaf <readn+0x6a>
+  801e5b:	41 89 fd             	mov    %edi,%r13d
+  801e5e:	49 89 f6             	mov    %rsi,%r14
+  801e61:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  801e64:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  801e69:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  801e6e:	49 bf 87 1d 80 00 00 	movabs $0x801d87,%r15
+  801e75:	00 00 00 
+  801e78:	4c 89 e2             	mov    %r12,%rdx
+  801e7b:	48 29 f2             	sub    %rsi,%rdx
+  801e7e:	4c 01 f6             	add    %r14,%rsi
+  801e81:	44 89 ef             	mov    %r13d,%edi
+  801e84:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  801e87:	85 c0                	test   %eax,%eax
+  801e89:	78 20                	js     801eab <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  801e8b:	01 c3                	add    %eax,%ebx
+  801e8d:	85 c0                	test   %eax,%eax
+  801e8f:	74 08                	je     801e99 <readn+0x54>
+  801e91:	48 63 f3             	movslq %ebx,%rsi
+  801e94:	4c 39 e6             	cmp    %r12,%rsi
+  801e97:	72 df                	jb     801e78 <readn+0x33>
+    }
+    return res;
+  801e99:	48 63 c3             	movslq %ebx,%rax
+}
+  801e9c:	48 83 c4 08          	add    $0x8,%rsp
+  801ea0:	5b                   	pop    %rbx
+  801ea1:	41 5c                	pop    %r12
+  801ea3:	41 5d                	pop    %r13
+  801ea5:	41 5e                	pop    %r14
+  801ea7:	41 5f                	pop    %r15
+  801ea9:	5d                   	pop    %rbp
+  801eaa:	c3                   	ret
+        if (inc < 0) return inc;
+  801eab:	48 98                	cltq
+  801ead:	eb ed                	jmp    801e9c <readn+0x57>
+    int inc = 1, res = 0;
+  801eaf:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801eb4:	eb e3                	jmp    801e99 <readn+0x54>
+
+0000000000801eb6 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  801eb6:	55                   	push   %rbp
+  801eb7:	48 89 e5             	mov    %rsp,%rbp
+  801eba:	41 56                	push   %r14
+  801ebc:	41 55                	push   %r13
+  801ebe:	41 54                	push   %r12
+  801ec0:	53                   	push   %rbx
+  801ec1:	48 83 ec 10          	sub    $0x10,%rsp
+  801ec5:	89 fb                	mov    %edi,%ebx
+  801ec7:	49 89 f4             	mov    %rsi,%r12
+  801eca:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801ecd:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801ed1:	48 b8 a4 1a 80 00 00 	movabs $0x801aa4,%rax
+  801ed8:	00 00 00 
+  801edb:	ff d0                	call   *%rax
+  801edd:	85 c0                	test   %eax,%eax
+  801edf:	78 47                	js     801f28 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801ee1:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801ee5:	41 8b 3e             	mov    (%r14),%edi
+  801ee8:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801eec:	48 b8 ef 1a 80 00 00 	movabs $0x801aef,%rax
+  801ef3:	00 00 00 
+  801ef6:	ff d0                	call   *%rax
+  801ef8:	85 c0                	test   %eax,%eax
+  801efa:	78 30                	js     801f2c <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801efc:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  801f01:	74 2d                	je     801f30 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801f03:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801f07:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801f0b:	48 85 c0             	test   %rax,%rax
+  801f0e:	74 56                	je     801f66 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  801f10:	4c 89 ea             	mov    %r13,%rdx
+  801f13:	4c 89 e6             	mov    %r12,%rsi
+  801f16:	4c 89 f7             	mov    %r14,%rdi
+  801f19:	ff d0                	call   *%rax
+}
+  801f1b:	48 83 c4 10          	add    $0x10,%rsp
+  801f1f:	5b                   	pop    %rbx
+  801f20:	41 5c                	pop    %r12
+  801f22:	41 5d                	pop    %r13
+  801f24:	41 5e                	pop    %r14
+  801f26:	5d                   	pop    %rbp
+  801f27:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801f28:	48 98                	cltq
+  801f2a:	eb ef                	jmp    801f1b <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801f2c:	48 98                	cltq
+  801f2e:	eb eb                	jmp    801f1b <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801f30:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801f37:	00 00 00 
+  801f3a:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+  801f40:	89 da                	mov    %ebx,%edx
+  801f42:	48 bf dd 35 80 00 00 	movabs $0x8035dd,%rdi
+  801f49:	00 00 00 
+  801f4c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f51:	48 b9 a7 03 80 00 00 	movabs $0x8003a7,%rcx
+  801f58:	00 00 00 
+  801f5b:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801f5d:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801f64:	eb b5                	jmp    801f1b <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801f66:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801f6d:	eb ac                	jmp    801f1b <write+0x65>
+
+0000000000801f6f <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  801f6f:	55                   	push   %rbp
+  801f70:	48 89 e5             	mov    %rsp,%rbp
+  801f73:	53                   	push   %rbx
+  801f74:	48 83 ec 18          	sub    $0x18,%rsp
+  801f78:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801f7a:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801f7e:	48 b8 a4 1a 80 00 00 	movabs $0x801aa4,%rax
+  801f85:	00 00 00 
+  801f88:	ff d0                	call   *%rax
+  801f8a:	85 c0                	test   %eax,%eax
+  801f8c:	78 0c                	js     801f9a <seek+0x2b>
+
+    fd->fd_offset = offset;
+  801f8e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801f92:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  801f95:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801f9a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801f9e:	c9                   	leave
+  801f9f:	c3                   	ret
+
+0000000000801fa0 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  801fa0:	55                   	push   %rbp
+  801fa1:	48 89 e5             	mov    %rsp,%rbp
+  801fa4:	41 55                	push   %r13
+  801fa6:	41 54                	push   %r12
+  801fa8:	53                   	push   %rbx
+  801fa9:	48 83 ec 18          	sub    $0x18,%rsp
+  801fad:	89 fb                	mov    %edi,%ebx
+  801faf:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801fb2:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801fb6:	48 b8 a4 1a 80 00 00 	movabs $0x801aa4,%rax
+  801fbd:	00 00 00 
+  801fc0:	ff d0                	call   *%rax
+  801fc2:	85 c0                	test   %eax,%eax
+  801fc4:	78 38                	js     801ffe <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801fc6:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  801fca:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  801fce:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801fd2:	48 b8 ef 1a 80 00 00 	movabs $0x801aef,%rax
+  801fd9:	00 00 00 
+  801fdc:	ff d0                	call   *%rax
+  801fde:	85 c0                	test   %eax,%eax
+  801fe0:	78 1c                	js     801ffe <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801fe2:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  801fe7:	74 20                	je     802009 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801fe9:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801fed:	48 8b 40 30          	mov    0x30(%rax),%rax
+  801ff1:	48 85 c0             	test   %rax,%rax
+  801ff4:	74 47                	je     80203d <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  801ff6:	44 89 e6             	mov    %r12d,%esi
+  801ff9:	4c 89 ef             	mov    %r13,%rdi
+  801ffc:	ff d0                	call   *%rax
+}
+  801ffe:	48 83 c4 18          	add    $0x18,%rsp
+  802002:	5b                   	pop    %rbx
+  802003:	41 5c                	pop    %r12
+  802005:	41 5d                	pop    %r13
+  802007:	5d                   	pop    %rbp
+  802008:	c3                   	ret
+                thisenv->env_id, fdnum);
+  802009:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802010:	00 00 00 
+  802013:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  802019:	89 da                	mov    %ebx,%edx
+  80201b:	48 bf a0 35 80 00 00 	movabs $0x8035a0,%rdi
+  802022:	00 00 00 
+  802025:	b8 00 00 00 00       	mov    $0x0,%eax
+  80202a:	48 b9 a7 03 80 00 00 	movabs $0x8003a7,%rcx
+  802031:	00 00 00 
+  802034:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  802036:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80203b:	eb c1                	jmp    801ffe <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  80203d:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802042:	eb ba                	jmp    801ffe <ftruncate+0x5e>
+
+0000000000802044 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  802044:	55                   	push   %rbp
+  802045:	48 89 e5             	mov    %rsp,%rbp
+  802048:	41 54                	push   %r12
+  80204a:	53                   	push   %rbx
+  80204b:	48 83 ec 10          	sub    $0x10,%rsp
+  80204f:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802052:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802056:	48 b8 a4 1a 80 00 00 	movabs $0x801aa4,%rax
+  80205d:	00 00 00 
+  802060:	ff d0                	call   *%rax
+  802062:	85 c0                	test   %eax,%eax
+  802064:	78 4e                	js     8020b4 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802066:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  80206a:	41 8b 3c 24          	mov    (%r12),%edi
+  80206e:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  802072:	48 b8 ef 1a 80 00 00 	movabs $0x801aef,%rax
+  802079:	00 00 00 
+  80207c:	ff d0                	call   *%rax
+  80207e:	85 c0                	test   %eax,%eax
+  802080:	78 32                	js     8020b4 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  802082:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802086:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  80208b:	74 30                	je     8020bd <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  80208d:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  802090:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  802097:	00 00 00 
+    stat->st_isdir = 0;
+  80209a:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8020a1:	00 00 00 
+    stat->st_dev = dev;
+  8020a4:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  8020ab:	48 89 de             	mov    %rbx,%rsi
+  8020ae:	4c 89 e7             	mov    %r12,%rdi
+  8020b1:	ff 50 28             	call   *0x28(%rax)
+}
+  8020b4:	48 83 c4 10          	add    $0x10,%rsp
+  8020b8:	5b                   	pop    %rbx
+  8020b9:	41 5c                	pop    %r12
+  8020bb:	5d                   	pop    %rbp
+  8020bc:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  8020bd:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8020c2:	eb f0                	jmp    8020b4 <fstat+0x70>
+
+00000000008020c4 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  8020c4:	55                   	push   %rbp
+  8020c5:	48 89 e5             	mov    %rsp,%rbp
+  8020c8:	41 54                	push   %r12
+  8020ca:	53                   	push   %rbx
+  8020cb:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  8020ce:	be 00 00 00 00       	mov    $0x0,%esi
+  8020d3:	48 b8 a7 24 80 00 00 	movabs $0x8024a7,%rax
+  8020da:	00 00 00 
+  8020dd:	ff d0                	call   *%rax
+  8020df:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  8020e1:	85 c0                	test   %eax,%eax
+  8020e3:	78 25                	js     80210a <stat+0x46>
+
+    int res = fstat(fd, stat);
+  8020e5:	4c 89 e6             	mov    %r12,%rsi
+  8020e8:	89 c7                	mov    %eax,%edi
+  8020ea:	48 b8 44 20 80 00 00 	movabs $0x802044,%rax
+  8020f1:	00 00 00 
+  8020f4:	ff d0                	call   *%rax
+  8020f6:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  8020f9:	89 df                	mov    %ebx,%edi
+  8020fb:	48 b8 09 1c 80 00 00 	movabs $0x801c09,%rax
+  802102:	00 00 00 
+  802105:	ff d0                	call   *%rax
+
+    return res;
+  802107:	44 89 e3             	mov    %r12d,%ebx
+}
+  80210a:	89 d8                	mov    %ebx,%eax
+  80210c:	5b                   	pop    %rbx
+  80210d:	41 5c                	pop    %r12
+  80210f:	5d                   	pop    %rbp
+  802110:	c3                   	ret
+
+0000000000802111 <fsipc>:
+ * response may be written back to fsipcbuf.
+ * type: request code, passed as the simple integer IPC value.
+ * dstva: virtual address at which to receive reply page, 0 if none.
+ * Returns result from the file server. */
+static int
+fsipc(unsigned type, void *dstva) {
+  802111:	55                   	push   %rbp
+  802112:	48 89 e5             	mov    %rsp,%rbp
+  802115:	41 54                	push   %r12
+  802117:	53                   	push   %rbx
+  802118:	48 83 ec 10          	sub    $0x10,%rsp
+  80211c:	41 89 fc             	mov    %edi,%r12d
+  80211f:	48 89 f3             	mov    %rsi,%rbx
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802122:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  802129:	00 00 00 
+  80212c:	83 38 00             	cmpl   $0x0,(%rax)
+  80212f:	74 5e                	je     80218f <fsipc+0x7e>
+    if (debug) {
+        cprintf("[%08x] fsipc %d %08x\n",
+                thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+    }
+
+    ipc_send(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW);
+  802131:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802137:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80213c:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  802143:	00 00 00 
+  802146:	44 89 e6             	mov    %r12d,%esi
+  802149:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  802150:	00 00 00 
+  802153:	8b 38                	mov    (%rax),%edi
+  802155:	48 b8 f0 18 80 00 00 	movabs $0x8018f0,%rax
+  80215c:	00 00 00 
+  80215f:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  802161:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  802168:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  802169:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80216e:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  802172:	48 89 de             	mov    %rbx,%rsi
+  802175:	bf 00 00 00 00       	mov    $0x0,%edi
+  80217a:	48 b8 1b 18 80 00 00 	movabs $0x80181b,%rax
+  802181:	00 00 00 
+  802184:	ff d0                	call   *%rax
+}
+  802186:	48 83 c4 10          	add    $0x10,%rsp
+  80218a:	5b                   	pop    %rbx
+  80218b:	41 5c                	pop    %r12
+  80218d:	5d                   	pop    %rbp
+  80218e:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  80218f:	bf 03 00 00 00       	mov    $0x3,%edi
+  802194:	48 b8 93 19 80 00 00 	movabs $0x801993,%rax
+  80219b:	00 00 00 
+  80219e:	ff d0                	call   *%rax
+  8021a0:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  8021a7:	00 00 
+  8021a9:	eb 86                	jmp    802131 <fsipc+0x20>
+
+00000000008021ab <devfile_trunc>:
+    return 0;
+}
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  8021ab:	55                   	push   %rbp
+  8021ac:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  8021af:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  8021b6:	00 00 00 
+  8021b9:	8b 57 0c             	mov    0xc(%rdi),%edx
+  8021bc:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  8021be:	89 70 04             	mov    %esi,0x4(%rax)
+
+    return fsipc(FSREQ_SET_SIZE, NULL);
+  8021c1:	be 00 00 00 00       	mov    $0x0,%esi
+  8021c6:	bf 02 00 00 00       	mov    $0x2,%edi
+  8021cb:	48 b8 11 21 80 00 00 	movabs $0x802111,%rax
+  8021d2:	00 00 00 
+  8021d5:	ff d0                	call   *%rax
+}
+  8021d7:	5d                   	pop    %rbp
+  8021d8:	c3                   	ret
+
+00000000008021d9 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  8021d9:	55                   	push   %rbp
+  8021da:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  8021dd:	8b 47 0c             	mov    0xc(%rdi),%eax
+  8021e0:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  8021e7:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  8021e9:	be 00 00 00 00       	mov    $0x0,%esi
+  8021ee:	bf 06 00 00 00       	mov    $0x6,%edi
+  8021f3:	48 b8 11 21 80 00 00 	movabs $0x802111,%rax
+  8021fa:	00 00 00 
+  8021fd:	ff d0                	call   *%rax
+}
+  8021ff:	5d                   	pop    %rbp
+  802200:	c3                   	ret
+
+0000000000802201 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  802201:	55                   	push   %rbp
+  802202:	48 89 e5             	mov    %rsp,%rbp
+  802205:	41 54                	push   %r12
+  802207:	53                   	push   %rbx
+  802208:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  80220b:	8b 47 0c             	mov    0xc(%rdi),%eax
+  80220e:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  802215:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  802217:	be 00 00 00 00       	mov    $0x0,%esi
+  80221c:	bf 05 00 00 00       	mov    $0x5,%edi
+  802221:	48 b8 11 21 80 00 00 	movabs $0x802111,%rax
+  802228:	00 00 00 
+  80222b:	ff d0                	call   *%rax
+    if (res < 0) {
+  80222d:	85 c0                	test   %eax,%eax
+  80222f:	78 3d                	js     80226e <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802231:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  802238:	00 00 00 
+  80223b:	4c 89 e6             	mov    %r12,%rsi
+  80223e:	48 89 df             	mov    %rbx,%rdi
+  802241:	48 b8 cc 0c 80 00 00 	movabs $0x800ccc,%rax
+  802248:	00 00 00 
+  80224b:	ff d0                	call   *%rax
+    st->st_size  = fsipcbuf.statRet.ret_size;
+  80224d:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  802254:	00 
+  802255:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  80225b:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  802262:	00 
+  802263:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  802269:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80226e:	5b                   	pop    %rbx
+  80226f:	41 5c                	pop    %r12
+  802271:	5d                   	pop    %rbp
+  802272:	c3                   	ret
+
+0000000000802273 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  802273:	55                   	push   %rbp
+  802274:	48 89 e5             	mov    %rsp,%rbp
+  802277:	41 57                	push   %r15
+  802279:	41 56                	push   %r14
+  80227b:	41 55                	push   %r13
+  80227d:	41 54                	push   %r12
+  80227f:	53                   	push   %rbx
+  802280:	48 83 ec 18          	sub    $0x18,%rsp
+  802284:	49 89 fe             	mov    %rdi,%r14
+  802287:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+  80228b:	48 89 d3             	mov    %rdx,%rbx
+    while (n > sizeof(fsipcbuf.write.req_buf))
+  80228e:	48 81 fa f0 0f 00 00 	cmp    $0xff0,%rdx
+  802295:	0f 86 e4 00 00 00    	jbe    80237f <devfile_write+0x10c>
+  80229b:	49 89 f4             	mov    %rsi,%r12
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  80229e:	49 bd 00 60 80 00 00 	movabs $0x806000,%r13
+  8022a5:	00 00 00 
+        memcpy(fsipcbuf.write.req_buf, buf, sizeof(fsipcbuf.write.req_buf));
+  8022a8:	49 bf 2d 0f 80 00 00 	movabs $0x800f2d,%r15
+  8022af:	00 00 00 
+  8022b2:	eb 03                	jmp    8022b7 <devfile_write+0x44>
+        buf += sizeof(fsipcbuf.write.req_buf);
+  8022b4:	49 89 f4             	mov    %rsi,%r12
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8022b7:	41 8b 46 0c          	mov    0xc(%r14),%eax
+  8022bb:	41 89 45 00          	mov    %eax,0x0(%r13)
+        fsipcbuf.write.req_n      = sizeof(fsipcbuf.write.req_buf);
+  8022bf:	49 c7 45 08 f0 0f 00 	movq   $0xff0,0x8(%r13)
+  8022c6:	00 
+        memcpy(fsipcbuf.write.req_buf, buf, sizeof(fsipcbuf.write.req_buf));
+  8022c7:	ba f0 0f 00 00       	mov    $0xff0,%edx
+  8022cc:	4c 89 e6             	mov    %r12,%rsi
+  8022cf:	48 bf 10 60 80 00 00 	movabs $0x806010,%rdi
+  8022d6:	00 00 00 
+  8022d9:	41 ff d7             	call   *%r15
+        ssize_t res = fsipc(FSREQ_WRITE, NULL);
+  8022dc:	be 00 00 00 00       	mov    $0x0,%esi
+  8022e1:	bf 04 00 00 00       	mov    $0x4,%edi
+  8022e6:	48 b8 11 21 80 00 00 	movabs $0x802111,%rax
+  8022ed:	00 00 00 
+  8022f0:	ff d0                	call   *%rax
+  8022f2:	48 63 d0             	movslq %eax,%rdx
+        if (res < 0 || res < sizeof(fsipcbuf.write.req_buf))
+  8022f5:	3d ef 0f 00 00       	cmp    $0xfef,%eax
+  8022fa:	7e 71                	jle    80236d <devfile_write+0xfa>
+        buf += sizeof(fsipcbuf.write.req_buf);
+  8022fc:	49 8d b4 24 f0 0f 00 	lea    0xff0(%r12),%rsi
+  802303:	00 
+        n -= sizeof(fsipcbuf.write.req_buf);
+  802304:	48 81 eb f0 0f 00 00 	sub    $0xff0,%rbx
+    while (n > sizeof(fsipcbuf.write.req_buf))
+  80230b:	48 81 fb f0 0f 00 00 	cmp    $0xff0,%rbx
+  802312:	77 a0                	ja     8022b4 <devfile_write+0x41>
+        written += sizeof(fsipcbuf.write.req_buf);
+  802314:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802318:	49 29 c4             	sub    %rax,%r12
+  80231b:	4d 8d a4 24 f0 0f 00 	lea    0xff0(%r12),%r12
+  802322:	00 
+    fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802323:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  80232a:	00 00 00 
+  80232d:	41 8b 56 0c          	mov    0xc(%r14),%edx
+  802331:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.write.req_n      = n;
+  802333:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    memcpy(fsipcbuf.write.req_buf, buf, n);
+  802337:	48 89 da             	mov    %rbx,%rdx
+  80233a:	48 8d 78 10          	lea    0x10(%rax),%rdi
+  80233e:	48 b8 2d 0f 80 00 00 	movabs $0x800f2d,%rax
+  802345:	00 00 00 
+  802348:	ff d0                	call   *%rax
+    ssize_t res = fsipc(FSREQ_WRITE, NULL);
+  80234a:	be 00 00 00 00       	mov    $0x0,%esi
+  80234f:	bf 04 00 00 00       	mov    $0x4,%edi
+  802354:	48 b8 11 21 80 00 00 	movabs $0x802111,%rax
+  80235b:	00 00 00 
+  80235e:	ff d0                	call   *%rax
+  802360:	48 63 d0             	movslq %eax,%rdx
+    written += res;
+  802363:	49 01 d4             	add    %rdx,%r12
+  802366:	48 85 d2             	test   %rdx,%rdx
+  802369:	49 0f 49 d4          	cmovns %r12,%rdx
+}
+  80236d:	48 89 d0             	mov    %rdx,%rax
+  802370:	48 83 c4 18          	add    $0x18,%rsp
+  802374:	5b                   	pop    %rbx
+  802375:	41 5c                	pop    %r12
+  802377:	41 5d                	pop    %r13
+  802379:	41 5e                	pop    %r14
+  80237b:	41 5f                	pop    %r15
+  80237d:	5d                   	pop    %rbp
+  80237e:	c3                   	ret
+    while (n > sizeof(fsipcbuf.write.req_buf))
+  80237f:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+    ssize_t written = 0;
+  802383:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802389:	eb 98                	jmp    802323 <devfile_write+0xb0>
+
+000000000080238b <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  80238b:	55                   	push   %rbp
+  80238c:	48 89 e5             	mov    %rsp,%rbp
+  80238f:	41 57                	push   %r15
+  802391:	41 56                	push   %r14
+  802393:	41 55                	push   %r13
+  802395:	41 54                	push   %r12
+  802397:	53                   	push   %rbx
+  802398:	48 83 ec 18          	sub    $0x18,%rsp
+  80239c:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  8023a0:	49 89 f6             	mov    %rsi,%r14
+  8023a3:	49 89 d4             	mov    %rdx,%r12
+    while (n > sizeof(fsipcbuf.readRet.ret_buf))
+  8023a6:	48 81 fa 00 10 00 00 	cmp    $0x1000,%rdx
+  8023ad:	0f 86 ea 00 00 00    	jbe    80249d <devfile_read+0x112>
+    ssize_t readsz = 0;
+  8023b3:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  8023ba:	00 
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8023bb:	49 bf 00 60 80 00 00 	movabs $0x806000,%r15
+  8023c2:	00 00 00 
+  8023c5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8023c9:	8b 40 0c             	mov    0xc(%rax),%eax
+  8023cc:	41 89 07             	mov    %eax,(%r15)
+        fsipcbuf.read.req_n = sizeof(fsipcbuf.readRet.ret_buf);
+  8023cf:	49 c7 47 08 00 10 00 	movq   $0x1000,0x8(%r15)
+  8023d6:	00 
+        ssize_t res = fsipc(FSREQ_READ, NULL);
+  8023d7:	be 00 00 00 00       	mov    $0x0,%esi
+  8023dc:	bf 03 00 00 00       	mov    $0x3,%edi
+  8023e1:	48 b8 11 21 80 00 00 	movabs $0x802111,%rax
+  8023e8:	00 00 00 
+  8023eb:	ff d0                	call   *%rax
+  8023ed:	4c 63 e8             	movslq %eax,%r13
+        if (res < 0)
+  8023f0:	4d 85 ed             	test   %r13,%r13
+  8023f3:	0f 88 92 00 00 00    	js     80248b <devfile_read+0x100>
+        memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  8023f9:	4c 89 ea             	mov    %r13,%rdx
+  8023fc:	4c 89 fe             	mov    %r15,%rsi
+  8023ff:	4c 89 f7             	mov    %r14,%rdi
+  802402:	48 b8 2d 0f 80 00 00 	movabs $0x800f2d,%rax
+  802409:	00 00 00 
+  80240c:	ff d0                	call   *%rax
+        if (res < sizeof(fsipcbuf.readRet.ret_buf))
+  80240e:	49 81 fd ff 0f 00 00 	cmp    $0xfff,%r13
+  802415:	76 6d                	jbe    802484 <devfile_read+0xf9>
+        readsz += res;
+  802417:	4c 01 6d c0          	add    %r13,-0x40(%rbp)
+        buf += res;
+  80241b:	4d 01 ee             	add    %r13,%r14
+        n -= res;
+  80241e:	4d 29 ec             	sub    %r13,%r12
+    while (n > sizeof(fsipcbuf.readRet.ret_buf))
+  802421:	49 81 fc 00 10 00 00 	cmp    $0x1000,%r12
+  802428:	77 9b                	ja     8023c5 <devfile_read+0x3a>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  80242a:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  802431:	00 00 00 
+  802434:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  802438:	8b 51 0c             	mov    0xc(%rcx),%edx
+  80243b:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.read.req_n = n;
+  80243d:	4c 89 60 08          	mov    %r12,0x8(%rax)
+    ssize_t res = fsipc(FSREQ_READ, NULL);
+  802441:	be 00 00 00 00       	mov    $0x0,%esi
+  802446:	bf 03 00 00 00       	mov    $0x3,%edi
+  80244b:	48 b8 11 21 80 00 00 	movabs $0x802111,%rax
+  802452:	00 00 00 
+  802455:	ff d0                	call   *%rax
+  802457:	4c 63 e8             	movslq %eax,%r13
+    if (res < 0)
+  80245a:	4d 85 ed             	test   %r13,%r13
+  80245d:	78 2c                	js     80248b <devfile_read+0x100>
+    memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  80245f:	4c 89 ea             	mov    %r13,%rdx
+  802462:	48 be 00 60 80 00 00 	movabs $0x806000,%rsi
+  802469:	00 00 00 
+  80246c:	4c 89 f7             	mov    %r14,%rdi
+  80246f:	48 b8 2d 0f 80 00 00 	movabs $0x800f2d,%rax
+  802476:	00 00 00 
+  802479:	ff d0                	call   *%rax
+    readsz += res;
+  80247b:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80247f:	49 01 c5             	add    %rax,%r13
+    return readsz;
+  802482:	eb 07                	jmp    80248b <devfile_read+0x100>
+            return readsz + res;
+  802484:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802488:	49 01 c5             	add    %rax,%r13
+}
+  80248b:	4c 89 e8             	mov    %r13,%rax
+  80248e:	48 83 c4 18          	add    $0x18,%rsp
+  802492:	5b                   	pop    %rbx
+  802493:	41 5c                	pop    %r12
+  802495:	41 5d                	pop    %r13
+  802497:	41 5e                	pop    %r14
+  802499:	41 5f                	pop    %r15
+  80249b:	5d                   	pop    %rbp
+  80249c:	c3                   	ret
+    ssize_t readsz = 0;
+  80249d:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  8024a4:	00 
+  8024a5:	eb 83                	jmp    80242a <devfile_read+0x9f>
+
+00000000008024a7 <open>:
+open(const char *path, int mode) {
+  8024a7:	55                   	push   %rbp
+  8024a8:	48 89 e5             	mov    %rsp,%rbp
+  8024ab:	41 55                	push   %r13
+  8024ad:	41 54                	push   %r12
+  8024af:	53                   	push   %rbx
+  8024b0:	48 83 ec 18          	sub    $0x18,%rsp
+  8024b4:	49 89 fc             	mov    %rdi,%r12
+  8024b7:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  8024ba:	48 b8 8e 0c 80 00 00 	movabs $0x800c8e,%rax
+  8024c1:	00 00 00 
+  8024c4:	ff d0                	call   *%rax
+  8024c6:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  8024cc:	0f 87 8a 00 00 00    	ja     80255c <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8024d2:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  8024d6:	48 b8 8a 1a 80 00 00 	movabs $0x801a8a,%rax
+  8024dd:	00 00 00 
+  8024e0:	ff d0                	call   *%rax
+  8024e2:	89 c3                	mov    %eax,%ebx
+  8024e4:	85 c0                	test   %eax,%eax
+  8024e6:	78 50                	js     802538 <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  8024e8:	4c 89 e6             	mov    %r12,%rsi
+  8024eb:	48 bb 00 60 80 00 00 	movabs $0x806000,%rbx
+  8024f2:	00 00 00 
+  8024f5:	48 89 df             	mov    %rbx,%rdi
+  8024f8:	48 b8 cc 0c 80 00 00 	movabs $0x800ccc,%rax
+  8024ff:	00 00 00 
+  802502:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  802504:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  80250b:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  80250f:	bf 01 00 00 00       	mov    $0x1,%edi
+  802514:	48 b8 11 21 80 00 00 	movabs $0x802111,%rax
+  80251b:	00 00 00 
+  80251e:	ff d0                	call   *%rax
+  802520:	89 c3                	mov    %eax,%ebx
+  802522:	85 c0                	test   %eax,%eax
+  802524:	78 1f                	js     802545 <open+0x9e>
+    return fd2num(fd);
+  802526:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80252a:	48 b8 e3 19 80 00 00 	movabs $0x8019e3,%rax
+  802531:	00 00 00 
+  802534:	ff d0                	call   *%rax
+  802536:	89 c3                	mov    %eax,%ebx
+}
+  802538:	89 d8                	mov    %ebx,%eax
+  80253a:	48 83 c4 18          	add    $0x18,%rsp
+  80253e:	5b                   	pop    %rbx
+  80253f:	41 5c                	pop    %r12
+  802541:	41 5d                	pop    %r13
+  802543:	5d                   	pop    %rbp
+  802544:	c3                   	ret
+        fd_close(fd, 0);
+  802545:	be 00 00 00 00       	mov    $0x0,%esi
+  80254a:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80254e:	48 b8 5f 1b 80 00 00 	movabs $0x801b5f,%rax
+  802555:	00 00 00 
+  802558:	ff d0                	call   *%rax
+        return res;
+  80255a:	eb dc                	jmp    802538 <open+0x91>
+        return -E_BAD_PATH;
+  80255c:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  802561:	eb d5                	jmp    802538 <open+0x91>
+
+0000000000802563 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  802563:	55                   	push   %rbp
+  802564:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc(FSREQ_SYNC, NULL);
+  802567:	be 00 00 00 00       	mov    $0x0,%esi
+  80256c:	bf 08 00 00 00       	mov    $0x8,%edi
+  802571:	48 b8 11 21 80 00 00 	movabs $0x802111,%rax
+  802578:	00 00 00 
+  80257b:	ff d0                	call   *%rax
+}
+  80257d:	5d                   	pop    %rbp
+  80257e:	c3                   	ret
+
+000000000080257f <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  80257f:	55                   	push   %rbp
+  802580:	48 89 e5             	mov    %rsp,%rbp
+  802583:	41 54                	push   %r12
+  802585:	53                   	push   %rbx
+  802586:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802589:	48 b8 f5 19 80 00 00 	movabs $0x8019f5,%rax
+  802590:	00 00 00 
+  802593:	ff d0                	call   *%rax
+  802595:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  802598:	48 be 20 36 80 00 00 	movabs $0x803620,%rsi
+  80259f:	00 00 00 
+  8025a2:	48 89 df             	mov    %rbx,%rdi
+  8025a5:	48 b8 cc 0c 80 00 00 	movabs $0x800ccc,%rax
+  8025ac:	00 00 00 
+  8025af:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  8025b1:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  8025b6:	41 2b 04 24          	sub    (%r12),%eax
+  8025ba:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  8025c0:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8025c7:	00 00 00 
+    stat->st_dev = &devpipe;
+  8025ca:	48 b8 60 40 80 00 00 	movabs $0x804060,%rax
+  8025d1:	00 00 00 
+  8025d4:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  8025db:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025e0:	5b                   	pop    %rbx
+  8025e1:	41 5c                	pop    %r12
+  8025e3:	5d                   	pop    %rbp
+  8025e4:	c3                   	ret
+
+00000000008025e5 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  8025e5:	55                   	push   %rbp
+  8025e6:	48 89 e5             	mov    %rsp,%rbp
+  8025e9:	41 54                	push   %r12
+  8025eb:	53                   	push   %rbx
+  8025ec:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8025ef:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8025f4:	48 89 fe             	mov    %rdi,%rsi
+  8025f7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8025fc:	49 bc 48 13 80 00 00 	movabs $0x801348,%r12
+  802603:	00 00 00 
+  802606:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  802609:	48 89 df             	mov    %rbx,%rdi
+  80260c:	48 b8 f5 19 80 00 00 	movabs $0x8019f5,%rax
+  802613:	00 00 00 
+  802616:	ff d0                	call   *%rax
+  802618:	48 89 c6             	mov    %rax,%rsi
+  80261b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802620:	bf 00 00 00 00       	mov    $0x0,%edi
+  802625:	41 ff d4             	call   *%r12
+}
+  802628:	5b                   	pop    %rbx
+  802629:	41 5c                	pop    %r12
+  80262b:	5d                   	pop    %rbp
+  80262c:	c3                   	ret
+
+000000000080262d <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  80262d:	55                   	push   %rbp
+  80262e:	48 89 e5             	mov    %rsp,%rbp
+  802631:	41 57                	push   %r15
+  802633:	41 56                	push   %r14
+  802635:	41 55                	push   %r13
+  802637:	41 54                	push   %r12
+  802639:	53                   	push   %rbx
+  80263a:	48 83 ec 18          	sub    $0x18,%rsp
+  80263e:	49 89 fc             	mov    %rdi,%r12
+  802641:	49 89 f5             	mov    %rsi,%r13
+  802644:	49 89 d7             	mov    %rdx,%r15
+  802647:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80264b:	48 b8 f5 19 80 00 00 	movabs $0x8019f5,%rax
+  802652:	00 00 00 
+  802655:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  802657:	4d 85 ff             	test   %r15,%r15
+  80265a:	0f 84 af 00 00 00    	je     80270f <devpipe_write+0xe2>
+  802660:	48 89 c3             	mov    %rax,%rbx
+  802663:	4c 89 f8             	mov    %r15,%rax
+  802666:	4d 89 ef             	mov    %r13,%r15
+  802669:	4c 01 e8             	add    %r13,%rax
+  80266c:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802670:	49 bd 50 12 80 00 00 	movabs $0x801250,%r13
+  802677:	00 00 00 
+            sys_yield();
+  80267a:	49 be ed 11 80 00 00 	movabs $0x8011ed,%r14
+  802681:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  802684:	8b 73 04             	mov    0x4(%rbx),%esi
+  802687:	48 63 ce             	movslq %esi,%rcx
+  80268a:	48 63 03             	movslq (%rbx),%rax
+  80268d:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  802693:	48 39 c1             	cmp    %rax,%rcx
+  802696:	72 2e                	jb     8026c6 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802698:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80269d:	48 89 da             	mov    %rbx,%rdx
+  8026a0:	be 00 10 00 00       	mov    $0x1000,%esi
+  8026a5:	4c 89 e7             	mov    %r12,%rdi
+  8026a8:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  8026ab:	85 c0                	test   %eax,%eax
+  8026ad:	74 66                	je     802715 <devpipe_write+0xe8>
+            sys_yield();
+  8026af:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  8026b2:	8b 73 04             	mov    0x4(%rbx),%esi
+  8026b5:	48 63 ce             	movslq %esi,%rcx
+  8026b8:	48 63 03             	movslq (%rbx),%rax
+  8026bb:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  8026c1:	48 39 c1             	cmp    %rax,%rcx
+  8026c4:	73 d2                	jae    802698 <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8026c6:	41 0f b6 3f          	movzbl (%r15),%edi
+  8026ca:	48 89 ca             	mov    %rcx,%rdx
+  8026cd:	48 c1 ea 03          	shr    $0x3,%rdx
+  8026d1:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  8026d8:	08 10 20 
+  8026db:	48 f7 e2             	mul    %rdx
+  8026de:	48 c1 ea 06          	shr    $0x6,%rdx
+  8026e2:	48 89 d0             	mov    %rdx,%rax
+  8026e5:	48 c1 e0 09          	shl    $0x9,%rax
+  8026e9:	48 29 d0             	sub    %rdx,%rax
+  8026ec:	48 c1 e0 03          	shl    $0x3,%rax
+  8026f0:	48 29 c1             	sub    %rax,%rcx
+  8026f3:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  8026f8:	83 c6 01             	add    $0x1,%esi
+  8026fb:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8026fe:	49 83 c7 01          	add    $0x1,%r15
+  802702:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802706:	49 39 c7             	cmp    %rax,%r15
+  802709:	0f 85 75 ff ff ff    	jne    802684 <devpipe_write+0x57>
+    return n;
+  80270f:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802713:	eb 05                	jmp    80271a <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  802715:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80271a:	48 83 c4 18          	add    $0x18,%rsp
+  80271e:	5b                   	pop    %rbx
+  80271f:	41 5c                	pop    %r12
+  802721:	41 5d                	pop    %r13
+  802723:	41 5e                	pop    %r14
+  802725:	41 5f                	pop    %r15
+  802727:	5d                   	pop    %rbp
+  802728:	c3                   	ret
+
+0000000000802729 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  802729:	55                   	push   %rbp
+  80272a:	48 89 e5             	mov    %rsp,%rbp
+  80272d:	41 57                	push   %r15
+  80272f:	41 56                	push   %r14
+  802731:	41 55                	push   %r13
+  802733:	41 54                	push   %r12
+  802735:	53                   	push   %rbx
+  802736:	48 83 ec 18          	sub    $0x18,%rsp
+  80273a:	49 89 fc             	mov    %rdi,%r12
+  80273d:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  802741:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802745:	48 b8 f5 19 80 00 00 	movabs $0x8019f5,%rax
+  80274c:	00 00 00 
+  80274f:	ff d0                	call   *%rax
+  802751:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  802754:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80275a:	49 bd 50 12 80 00 00 	movabs $0x801250,%r13
+  802761:	00 00 00 
+            sys_yield();
+  802764:	49 be ed 11 80 00 00 	movabs $0x8011ed,%r14
+  80276b:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  80276e:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  802773:	74 7d                	je     8027f2 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  802775:	8b 03                	mov    (%rbx),%eax
+  802777:	3b 43 04             	cmp    0x4(%rbx),%eax
+  80277a:	75 26                	jne    8027a2 <devpipe_read+0x79>
+            if (i > 0) return i;
+  80277c:	4d 85 ff             	test   %r15,%r15
+  80277f:	75 77                	jne    8027f8 <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802781:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802786:	48 89 da             	mov    %rbx,%rdx
+  802789:	be 00 10 00 00       	mov    $0x1000,%esi
+  80278e:	4c 89 e7             	mov    %r12,%rdi
+  802791:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  802794:	85 c0                	test   %eax,%eax
+  802796:	74 72                	je     80280a <devpipe_read+0xe1>
+            sys_yield();
+  802798:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  80279b:	8b 03                	mov    (%rbx),%eax
+  80279d:	3b 43 04             	cmp    0x4(%rbx),%eax
+  8027a0:	74 df                	je     802781 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  8027a2:	48 63 c8             	movslq %eax,%rcx
+  8027a5:	48 89 ca             	mov    %rcx,%rdx
+  8027a8:	48 c1 ea 03          	shr    $0x3,%rdx
+  8027ac:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  8027b3:	08 10 20 
+  8027b6:	48 89 d0             	mov    %rdx,%rax
+  8027b9:	48 f7 e6             	mul    %rsi
+  8027bc:	48 c1 ea 06          	shr    $0x6,%rdx
+  8027c0:	48 89 d0             	mov    %rdx,%rax
+  8027c3:	48 c1 e0 09          	shl    $0x9,%rax
+  8027c7:	48 29 d0             	sub    %rdx,%rax
+  8027ca:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  8027d1:	00 
+  8027d2:	48 89 c8             	mov    %rcx,%rax
+  8027d5:	48 29 d0             	sub    %rdx,%rax
+  8027d8:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  8027dd:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8027e1:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  8027e5:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8027e8:	49 83 c7 01          	add    $0x1,%r15
+  8027ec:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  8027f0:	75 83                	jne    802775 <devpipe_read+0x4c>
+    return n;
+  8027f2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8027f6:	eb 03                	jmp    8027fb <devpipe_read+0xd2>
+            if (i > 0) return i;
+  8027f8:	4c 89 f8             	mov    %r15,%rax
+}
+  8027fb:	48 83 c4 18          	add    $0x18,%rsp
+  8027ff:	5b                   	pop    %rbx
+  802800:	41 5c                	pop    %r12
+  802802:	41 5d                	pop    %r13
+  802804:	41 5e                	pop    %r14
+  802806:	41 5f                	pop    %r15
+  802808:	5d                   	pop    %rbp
+  802809:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  80280a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80280f:	eb ea                	jmp    8027fb <devpipe_read+0xd2>
+
+0000000000802811 <pipe>:
+pipe(int pfd[2]) {
+  802811:	55                   	push   %rbp
+  802812:	48 89 e5             	mov    %rsp,%rbp
+  802815:	41 55                	push   %r13
+  802817:	41 54                	push   %r12
+  802819:	53                   	push   %rbx
+  80281a:	48 81 ec b8 00 00 00 	sub    $0xb8,%rsp
+  802821:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  802824:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802828:	48 b8 8a 1a 80 00 00 	movabs $0x801a8a,%rax
+  80282f:	00 00 00 
+  802832:	ff d0                	call   *%rax
+  802834:	89 c3                	mov    %eax,%ebx
+  802836:	85 c0                	test   %eax,%eax
+  802838:	0f 88 51 01 00 00    	js     80298f <pipe+0x17e>
+        (res = fd_alloc_from(fd2num(fd0) + 1, &fd1)) < 0) goto err;
+  80283e:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802842:	48 b8 e3 19 80 00 00 	movabs $0x8019e3,%rax
+  802849:	00 00 00 
+  80284c:	ff d0                	call   *%rax
+  80284e:	8d 78 01             	lea    0x1(%rax),%edi
+  802851:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802855:	48 b8 11 1a 80 00 00 	movabs $0x801a11,%rax
+  80285c:	00 00 00 
+  80285f:	ff d0                	call   *%rax
+  802861:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  802863:	85 c0                	test   %eax,%eax
+  802865:	0f 88 24 01 00 00    	js     80298f <pipe+0x17e>
+    va = fd2data(fd0);
+  80286b:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80286f:	48 bb f5 19 80 00 00 	movabs $0x8019f5,%rbx
+  802876:	00 00 00 
+  802879:	ff d3                	call   *%rbx
+  80287b:	49 89 c5             	mov    %rax,%r13
+    struct RegionOp ops[] = {
+  80287e:	48 8d bd 30 ff ff ff 	lea    -0xd0(%rbp),%rdi
+  802885:	b9 14 00 00 00       	mov    $0x14,%ecx
+  80288a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80288f:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+  802892:	c7 85 34 ff ff ff 46 	movl   $0x46,-0xcc(%rbp)
+  802899:	00 00 00 
+  80289c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8028a0:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+  8028a7:	48 c7 85 50 ff ff ff 	movq   $0x1000,-0xb0(%rbp)
+  8028ae:	00 10 00 00 
+  8028b2:	c7 85 5c ff ff ff 46 	movl   $0x46,-0xa4(%rbp)
+  8028b9:	00 00 00 
+            {.type = REGION_ALLOC, .dstva = (uintptr_t)fd1, .size = PAGE_SIZE, .perm = PROT_RW | PROT_SHARE},
+  8028bc:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+    struct RegionOp ops[] = {
+  8028c0:	48 89 bd 70 ff ff ff 	mov    %rdi,-0x90(%rbp)
+  8028c7:	48 c7 85 78 ff ff ff 	movq   $0x1000,-0x88(%rbp)
+  8028ce:	00 10 00 00 
+  8028d2:	c7 45 84 46 00 00 00 	movl   $0x46,-0x7c(%rbp)
+  8028d9:	4c 89 6d 98          	mov    %r13,-0x68(%rbp)
+  8028dd:	48 c7 45 a0 00 10 00 	movq   $0x1000,-0x60(%rbp)
+  8028e4:	00 
+  8028e5:	c7 45 a8 01 00 00 00 	movl   $0x1,-0x58(%rbp)
+  8028ec:	c7 45 ac 46 00 00 00 	movl   $0x46,-0x54(%rbp)
+  8028f3:	4c 89 6d b8          	mov    %r13,-0x48(%rbp)
+            {.type = REGION_MAP, .srcva = (uintptr_t)va, .dstva = (uintptr_t)fd2data(fd1), .size = PAGE_SIZE, .perm = PROT_RW | PROT_SHARE},
+  8028f7:	ff d3                	call   *%rbx
+    struct RegionOp ops[] = {
+  8028f9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8028fd:	48 c7 45 c8 00 10 00 	movq   $0x1000,-0x38(%rbp)
+  802904:	00 
+    if ((res = sys_region_batch(ops, sizeof ops / sizeof *ops)) < 0) goto err1;
+  802905:	be 04 00 00 00       	mov    $0x4,%esi
+  80290a:	48 8d bd 30 ff ff ff 	lea    -0xd0(%rbp),%rdi
+  802911:	48 b8 af 13 80 00 00 	movabs $0x8013af,%rax
+  802918:	00 00 00 
+  80291b:	ff d0                	call   *%rax
+  80291d:	89 c3                	mov    %eax,%ebx
+  80291f:	85 c0                	test   %eax,%eax
+  802921:	0f 88 ad 00 00 00    	js     8029d4 <pipe+0x1c3>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  802927:	be 00 10 00 00       	mov    $0x1000,%esi
+  80292c:	4c 89 ef             	mov    %r13,%rdi
+  80292f:	48 b8 1e 12 80 00 00 	movabs $0x80121e,%rax
+  802936:	00 00 00 
+  802939:	ff d0                	call   *%rax
+  80293b:	83 f8 02             	cmp    $0x2,%eax
+  80293e:	75 5f                	jne    80299f <pipe+0x18e>
+    fd0->fd_dev_id = devpipe.dev_id;
+  802940:	a1 60 40 80 00 00 00 	movabs 0x804060,%eax
+  802947:	00 00 
+  802949:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80294d:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  80294f:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802953:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  80295a:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  80295e:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  802960:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802964:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  80296b:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80296f:	48 bb e3 19 80 00 00 	movabs $0x8019e3,%rbx
+  802976:	00 00 00 
+  802979:	ff d3                	call   *%rbx
+  80297b:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  80297f:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  802983:	ff d3                	call   *%rbx
+  802985:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  80298a:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  80298f:	89 d8                	mov    %ebx,%eax
+  802991:	48 81 c4 b8 00 00 00 	add    $0xb8,%rsp
+  802998:	5b                   	pop    %rbx
+  802999:	41 5c                	pop    %r12
+  80299b:	41 5d                	pop    %r13
+  80299d:	5d                   	pop    %rbp
+  80299e:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  80299f:	48 b9 50 36 80 00 00 	movabs $0x803650,%rcx
+  8029a6:	00 00 00 
+  8029a9:	48 ba 27 36 80 00 00 	movabs $0x803627,%rdx
+  8029b0:	00 00 00 
+  8029b3:	be 33 00 00 00       	mov    $0x33,%esi
+  8029b8:	48 bf 3c 36 80 00 00 	movabs $0x80363c,%rdi
+  8029bf:	00 00 00 
+  8029c2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029c7:	49 b8 57 02 80 00 00 	movabs $0x800257,%r8
+  8029ce:	00 00 00 
+  8029d1:	41 ff d0             	call   *%r8
+        ops[i].type = REGION_UNMAP;
+  8029d4:	c7 85 30 ff ff ff 02 	movl   $0x2,-0xd0(%rbp)
+  8029db:	00 00 00 
+  8029de:	c7 85 58 ff ff ff 02 	movl   $0x2,-0xa8(%rbp)
+  8029e5:	00 00 00 
+  8029e8:	c7 45 80 02 00 00 00 	movl   $0x2,-0x80(%rbp)
+  8029ef:	c7 45 a8 02 00 00 00 	movl   $0x2,-0x58(%rbp)
+    sys_region_batch(ops, sizeof ops / sizeof *ops);
+  8029f6:	be 04 00 00 00       	mov    $0x4,%esi
+  8029fb:	48 8d bd 30 ff ff ff 	lea    -0xd0(%rbp),%rdi
+  802a02:	48 b8 af 13 80 00 00 	movabs $0x8013af,%rax
+  802a09:	00 00 00 
+  802a0c:	ff d0                	call   *%rax
+  802a0e:	e9 7c ff ff ff       	jmp    80298f <pipe+0x17e>
+
+0000000000802a13 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  802a13:	55                   	push   %rbp
+  802a14:	48 89 e5             	mov    %rsp,%rbp
+  802a17:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  802a1b:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802a1f:	48 b8 a4 1a 80 00 00 	movabs $0x801aa4,%rax
+  802a26:	00 00 00 
+  802a29:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802a2b:	85 c0                	test   %eax,%eax
+  802a2d:	78 35                	js     802a64 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  802a2f:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802a33:	48 b8 f5 19 80 00 00 	movabs $0x8019f5,%rax
+  802a3a:	00 00 00 
+  802a3d:	ff d0                	call   *%rax
+  802a3f:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802a42:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802a47:	be 00 10 00 00       	mov    $0x1000,%esi
+  802a4c:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802a50:	48 b8 50 12 80 00 00 	movabs $0x801250,%rax
+  802a57:	00 00 00 
+  802a5a:	ff d0                	call   *%rax
+  802a5c:	85 c0                	test   %eax,%eax
+  802a5e:	0f 94 c0             	sete   %al
+  802a61:	0f b6 c0             	movzbl %al,%eax
+}
+  802a64:	c9                   	leave
+  802a65:	c3                   	ret
+
+0000000000802a66 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  802a66:	48 89 f8             	mov    %rdi,%rax
+  802a69:	48 c1 e8 27          	shr    $0x27,%rax
+  802a6d:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  802a74:	01 00 00 
+  802a77:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802a7b:	f6 c2 01             	test   $0x1,%dl
+  802a7e:	74 6d                	je     802aed <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  802a80:	48 89 f8             	mov    %rdi,%rax
+  802a83:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802a87:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802a8e:	01 00 00 
+  802a91:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802a95:	f6 c2 01             	test   $0x1,%dl
+  802a98:	74 62                	je     802afc <get_uvpt_entry+0x96>
+  802a9a:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802aa1:	01 00 00 
+  802aa4:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802aa8:	f6 c2 80             	test   $0x80,%dl
+  802aab:	75 4f                	jne    802afc <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  802aad:	48 89 f8             	mov    %rdi,%rax
+  802ab0:	48 c1 e8 15          	shr    $0x15,%rax
+  802ab4:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802abb:	01 00 00 
+  802abe:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802ac2:	f6 c2 01             	test   $0x1,%dl
+  802ac5:	74 44                	je     802b0b <get_uvpt_entry+0xa5>
+  802ac7:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802ace:	01 00 00 
+  802ad1:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802ad5:	f6 c2 80             	test   $0x80,%dl
+  802ad8:	75 31                	jne    802b0b <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  802ada:	48 c1 ef 0c          	shr    $0xc,%rdi
+  802ade:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802ae5:	01 00 00 
+  802ae8:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  802aec:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  802aed:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  802af4:	01 00 00 
+  802af7:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802afb:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  802afc:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802b03:	01 00 00 
+  802b06:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802b0a:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  802b0b:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802b12:	01 00 00 
+  802b15:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802b19:	c3                   	ret
+
+0000000000802b1a <get_prot>:
+
+int
+get_prot(void *va) {
+  802b1a:	55                   	push   %rbp
+  802b1b:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  802b1e:	48 b8 66 2a 80 00 00 	movabs $0x802a66,%rax
+  802b25:	00 00 00 
+  802b28:	ff d0                	call   *%rax
+  802b2a:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  802b2d:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  802b32:	89 c1                	mov    %eax,%ecx
+  802b34:	83 c9 04             	or     $0x4,%ecx
+  802b37:	f6 c2 01             	test   $0x1,%dl
+  802b3a:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  802b3d:	89 c1                	mov    %eax,%ecx
+  802b3f:	83 c9 02             	or     $0x2,%ecx
+  802b42:	f6 c2 02             	test   $0x2,%dl
+  802b45:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  802b48:	89 c1                	mov    %eax,%ecx
+  802b4a:	83 c9 01             	or     $0x1,%ecx
+  802b4d:	48 85 d2             	test   %rdx,%rdx
+  802b50:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  802b53:	89 c1                	mov    %eax,%ecx
+  802b55:	83 c9 40             	or     $0x40,%ecx
+  802b58:	f6 c6 04             	test   $0x4,%dh
+  802b5b:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  802b5e:	5d                   	pop    %rbp
+  802b5f:	c3                   	ret
+
+0000000000802b60 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  802b60:	55                   	push   %rbp
+  802b61:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  802b64:	48 b8 66 2a 80 00 00 	movabs $0x802a66,%rax
+  802b6b:	00 00 00 
+  802b6e:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  802b70:	48 c1 e8 06          	shr    $0x6,%rax
+  802b74:	83 e0 01             	and    $0x1,%eax
+}
+  802b77:	5d                   	pop    %rbp
+  802b78:	c3                   	ret
+
+0000000000802b79 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  802b79:	55                   	push   %rbp
+  802b7a:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  802b7d:	48 b8 66 2a 80 00 00 	movabs $0x802a66,%rax
+  802b84:	00 00 00 
+  802b87:	ff d0                	call   *%rax
+  802b89:	83 e0 01             	and    $0x1,%eax
+}
+  802b8c:	5d                   	pop    %rbp
+  802b8d:	c3                   	ret
+
+0000000000802b8e <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  802b8e:	55                   	push   %rbp
+  802b8f:	48 89 e5             	mov    %rsp,%rbp
+  802b92:	41 57                	push   %r15
+  802b94:	41 56                	push   %r14
+  802b96:	41 55                	push   %r13
+  802b98:	41 54                	push   %r12
+  802b9a:	53                   	push   %rbx
+  802b9b:	48 83 ec 38          	sub    $0x38,%rsp
+  802b9f:	49 89 f7             	mov    %rsi,%r15
+  802ba2:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+                    }
+                    continue;
+                }
+                for (int ptei = 0; ptei < PT_ENTRY_COUNT; ptei++) {
+                    uintptr_t pte_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, pdei, ptei, 0);
+                    pte_t pte = uvpt[VPT(pte_addr)];
+  802ba8:	49 bd 00 00 00 00 00 	movabs $0x10000000000,%r13
+  802baf:	01 00 00 
+  802bb2:	4d 89 e6             	mov    %r12,%r14
+  802bb5:	49 89 fc             	mov    %rdi,%r12
+  802bb8:	e9 19 01 00 00       	jmp    802cd6 <foreach_shared_region+0x148>
+  802bbd:	48 89 5d b0          	mov    %rbx,-0x50(%rbp)
+  802bc1:	4c 89 75 a8          	mov    %r14,-0x58(%rbp)
+  802bc5:	eb 52                	jmp    802c19 <foreach_shared_region+0x8b>
+                for (int ptei = 0; ptei < PT_ENTRY_COUNT; ptei++) {
+  802bc7:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802bce:	48 81 fb 00 00 20 00 	cmp    $0x200000,%rbx
+  802bd5:	74 2e                	je     802c05 <foreach_shared_region+0x77>
+                    uintptr_t pte_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, pdei, ptei, 0);
+  802bd7:	48 89 df             	mov    %rbx,%rdi
+  802bda:	4c 09 f7             	or     %r14,%rdi
+                    pte_t pte = uvpt[VPT(pte_addr)];
+  802bdd:	48 89 f8             	mov    %rdi,%rax
+  802be0:	48 c1 e8 0c          	shr    $0xc,%rax
+  802be4:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+                    if ((pte & PTE_P) && (pte & PTE_SHARE)) {
+  802be9:	25 01 04 00 00       	and    $0x401,%eax
+  802bee:	48 3d 01 04 00 00    	cmp    $0x401,%rax
+  802bf4:	75 d1                	jne    802bc7 <foreach_shared_region+0x39>
+                        fun((void*)pte_addr, (void*)(pte_addr + PAGE_SIZE), arg);
+  802bf6:	48 8d b7 00 10 00 00 	lea    0x1000(%rdi),%rsi
+  802bfd:	4c 89 fa             	mov    %r15,%rdx
+  802c00:	41 ff d4             	call   *%r12
+  802c03:	eb c2                	jmp    802bc7 <foreach_shared_region+0x39>
+            for (int pdei = 0; pdei < PD_ENTRY_COUNT; pdei++) {
+  802c05:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  802c0c:	00 
+  802c0d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802c11:	48 3d 00 00 00 40    	cmp    $0x40000000,%rax
+  802c17:	74 46                	je     802c5f <foreach_shared_region+0xd1>
+                uintptr_t pde_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, pdei, 0, 0);
+  802c19:	4c 8b 75 c8          	mov    -0x38(%rbp),%r14
+  802c1d:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802c21:	49 09 c6             	or     %rax,%r14
+                pde_t pde = uvpd[VPD(pde_addr)];
+  802c24:	4c 89 f0             	mov    %r14,%rax
+  802c27:	48 c1 e8 15          	shr    $0x15,%rax
+  802c2b:	48 b9 00 00 00 80 00 	movabs $0x10080000000,%rcx
+  802c32:	01 00 00 
+  802c35:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+                if (!(pde & PTE_P)) {
+  802c39:	a8 01                	test   $0x1,%al
+  802c3b:	74 c8                	je     802c05 <foreach_shared_region+0x77>
+                if (pde & PTE_PS) {
+  802c3d:	48 89 c3             	mov    %rax,%rbx
+  802c40:	81 e3 80 00 00 00    	and    $0x80,%ebx
+  802c46:	74 8f                	je     802bd7 <foreach_shared_region+0x49>
+                    if (pde & PTE_SHARE) {
+  802c48:	f6 c4 04             	test   $0x4,%ah
+  802c4b:	74 b8                	je     802c05 <foreach_shared_region+0x77>
+                        fun((void*)pde_addr, (void*)(pde_addr + 1024 * 1024 * 2), arg);
+  802c4d:	49 8d b6 00 00 20 00 	lea    0x200000(%r14),%rsi
+  802c54:	4c 89 fa             	mov    %r15,%rdx
+  802c57:	4c 89 f7             	mov    %r14,%rdi
+  802c5a:	41 ff d4             	call   *%r12
+  802c5d:	eb a6                	jmp    802c05 <foreach_shared_region+0x77>
+  802c5f:	48 8b 5d b0          	mov    -0x50(%rbp),%rbx
+  802c63:	4c 8b 75 a8          	mov    -0x58(%rbp),%r14
+        for (int pdpei = 0; pdpei < PDP_ENTRY_COUNT; pdpei++) {
+  802c67:	48 81 c3 00 00 00 40 	add    $0x40000000,%rbx
+  802c6e:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802c75:	00 00 00 
+  802c78:	48 39 c3             	cmp    %rax,%rbx
+  802c7b:	74 4c                	je     802cc9 <foreach_shared_region+0x13b>
+            uintptr_t pdpe_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, 0, 0, 0);
+  802c7d:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802c81:	48 09 d8             	or     %rbx,%rax
+  802c84:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+            pdpe_t pdpe = uvpdp[VPDP(pdpe_addr)];
+  802c88:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802c8c:	48 b9 00 00 40 80 00 	movabs $0x10080400000,%rcx
+  802c93:	01 00 00 
+  802c96:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+            if (!(pdpe & PTE_P)) {
+  802c9a:	a8 01                	test   $0x1,%al
+  802c9c:	74 c9                	je     802c67 <foreach_shared_region+0xd9>
+            if (pdpe & PTE_PS) {
+  802c9e:	48 89 c1             	mov    %rax,%rcx
+  802ca1:	81 e1 80 00 00 00    	and    $0x80,%ecx
+  802ca7:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  802cab:	0f 84 0c ff ff ff    	je     802bbd <foreach_shared_region+0x2f>
+                if (pdpe & PTE_SHARE) {
+  802cb1:	f6 c4 04             	test   $0x4,%ah
+  802cb4:	74 b1                	je     802c67 <foreach_shared_region+0xd9>
+                    fun((void*)pdpe_addr, (void*)(pdpe_addr + 1024 * 1024 * 1024), arg); 
+  802cb6:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  802cba:	48 8d b7 00 00 00 40 	lea    0x40000000(%rdi),%rsi
+  802cc1:	4c 89 fa             	mov    %r15,%rdx
+  802cc4:	41 ff d4             	call   *%r12
+  802cc7:	eb 9e                	jmp    802c67 <foreach_shared_region+0xd9>
+    for (int pml4ei = 0; pml4ei < PML4_ENTRY_COUNT; pml4ei++) {
+  802cc9:	49 83 c6 01          	add    $0x1,%r14
+  802ccd:	49 81 fe 00 02 00 00 	cmp    $0x200,%r14
+  802cd4:	74 24                	je     802cfa <foreach_shared_region+0x16c>
+        pml4e_t pml4e = uvpml4[VPML4(pml4_addr)];
+  802cd6:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  802cdd:	01 00 00 
+  802ce0:	4a 8b 04 f0          	mov    (%rax,%r14,8),%rax
+        if (!(pml4e & PTE_P)) {
+  802ce4:	a8 01                	test   $0x1,%al
+  802ce6:	74 e1                	je     802cc9 <foreach_shared_region+0x13b>
+  802ce8:	4c 89 f0             	mov    %r14,%rax
+  802ceb:	48 c1 e0 27          	shl    $0x27,%rax
+  802cef:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  802cf3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802cf8:	eb 83                	jmp    802c7d <foreach_shared_region+0xef>
+            }
+        }
+    }
+    
+    return 0;
+}
+  802cfa:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cff:	48 83 c4 38          	add    $0x38,%rsp
+  802d03:	5b                   	pop    %rbx
+  802d04:	41 5c                	pop    %r12
+  802d06:	41 5d                	pop    %r13
+  802d08:	41 5e                	pop    %r14
+  802d0a:	41 5f                	pop    %r15
+  802d0c:	5d                   	pop    %rbp
+  802d0d:	c3                   	ret
+
+0000000000802d0e <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  802d0e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d13:	c3                   	ret
+
+0000000000802d14 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  802d14:	55                   	push   %rbp
+  802d15:	48 89 e5             	mov    %rsp,%rbp
+  802d18:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  802d1b:	48 be 74 36 80 00 00 	movabs $0x803674,%rsi
+  802d22:	00 00 00 
+  802d25:	48 b8 cc 0c 80 00 00 	movabs $0x800ccc,%rax
+  802d2c:	00 00 00 
+  802d2f:	ff d0                	call   *%rax
+    return 0;
+}
+  802d31:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d36:	5d                   	pop    %rbp
+  802d37:	c3                   	ret
+
+0000000000802d38 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  802d38:	55                   	push   %rbp
+  802d39:	48 89 e5             	mov    %rsp,%rbp
+  802d3c:	41 57                	push   %r15
+  802d3e:	41 56                	push   %r14
+  802d40:	41 55                	push   %r13
+  802d42:	41 54                	push   %r12
+  802d44:	53                   	push   %rbx
+  802d45:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  802d4c:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  802d53:	48 85 d2             	test   %rdx,%rdx
+  802d56:	74 7a                	je     802dd2 <devcons_write+0x9a>
+  802d58:	49 89 d6             	mov    %rdx,%r14
+  802d5b:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802d61:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  802d66:	49 bf c6 0e 80 00 00 	movabs $0x800ec6,%r15
+  802d6d:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  802d70:	4c 89 f3             	mov    %r14,%rbx
+  802d73:	48 29 f3             	sub    %rsi,%rbx
+  802d76:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802d7b:	48 39 c3             	cmp    %rax,%rbx
+  802d7e:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  802d82:	4c 63 eb             	movslq %ebx,%r13
+  802d85:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  802d8c:	48 01 c6             	add    %rax,%rsi
+  802d8f:	4c 89 ea             	mov    %r13,%rdx
+  802d92:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802d99:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  802d9c:	4c 89 ee             	mov    %r13,%rsi
+  802d9f:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802da6:	48 b8 f3 10 80 00 00 	movabs $0x8010f3,%rax
+  802dad:	00 00 00 
+  802db0:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  802db2:	41 01 dc             	add    %ebx,%r12d
+  802db5:	49 63 f4             	movslq %r12d,%rsi
+  802db8:	4c 39 f6             	cmp    %r14,%rsi
+  802dbb:	72 b3                	jb     802d70 <devcons_write+0x38>
+    return res;
+  802dbd:	49 63 c4             	movslq %r12d,%rax
+}
+  802dc0:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  802dc7:	5b                   	pop    %rbx
+  802dc8:	41 5c                	pop    %r12
+  802dca:	41 5d                	pop    %r13
+  802dcc:	41 5e                	pop    %r14
+  802dce:	41 5f                	pop    %r15
+  802dd0:	5d                   	pop    %rbp
+  802dd1:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  802dd2:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802dd8:	eb e3                	jmp    802dbd <devcons_write+0x85>
+
+0000000000802dda <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  802dda:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  802ddd:	ba 00 00 00 00       	mov    $0x0,%edx
+  802de2:	48 85 c0             	test   %rax,%rax
+  802de5:	74 55                	je     802e3c <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  802de7:	55                   	push   %rbp
+  802de8:	48 89 e5             	mov    %rsp,%rbp
+  802deb:	41 55                	push   %r13
+  802ded:	41 54                	push   %r12
+  802def:	53                   	push   %rbx
+  802df0:	48 83 ec 08          	sub    $0x8,%rsp
+  802df4:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  802df7:	48 bb 20 11 80 00 00 	movabs $0x801120,%rbx
+  802dfe:	00 00 00 
+  802e01:	49 bc ed 11 80 00 00 	movabs $0x8011ed,%r12
+  802e08:	00 00 00 
+  802e0b:	eb 03                	jmp    802e10 <devcons_read+0x36>
+  802e0d:	41 ff d4             	call   *%r12
+  802e10:	ff d3                	call   *%rbx
+  802e12:	85 c0                	test   %eax,%eax
+  802e14:	74 f7                	je     802e0d <devcons_read+0x33>
+    if (c < 0) return c;
+  802e16:	48 63 d0             	movslq %eax,%rdx
+  802e19:	78 13                	js     802e2e <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  802e1b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802e20:	83 f8 04             	cmp    $0x4,%eax
+  802e23:	74 09                	je     802e2e <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  802e25:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  802e29:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  802e2e:	48 89 d0             	mov    %rdx,%rax
+  802e31:	48 83 c4 08          	add    $0x8,%rsp
+  802e35:	5b                   	pop    %rbx
+  802e36:	41 5c                	pop    %r12
+  802e38:	41 5d                	pop    %r13
+  802e3a:	5d                   	pop    %rbp
+  802e3b:	c3                   	ret
+  802e3c:	48 89 d0             	mov    %rdx,%rax
+  802e3f:	c3                   	ret
+
+0000000000802e40 <cputchar>:
+cputchar(int ch) {
+  802e40:	55                   	push   %rbp
+  802e41:	48 89 e5             	mov    %rsp,%rbp
+  802e44:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  802e48:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  802e4c:	be 01 00 00 00       	mov    $0x1,%esi
+  802e51:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  802e55:	48 b8 f3 10 80 00 00 	movabs $0x8010f3,%rax
+  802e5c:	00 00 00 
+  802e5f:	ff d0                	call   *%rax
+}
+  802e61:	c9                   	leave
+  802e62:	c3                   	ret
+
+0000000000802e63 <getchar>:
+getchar(void) {
+  802e63:	55                   	push   %rbp
+  802e64:	48 89 e5             	mov    %rsp,%rbp
+  802e67:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  802e6b:	ba 01 00 00 00       	mov    $0x1,%edx
+  802e70:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  802e74:	bf 00 00 00 00       	mov    $0x0,%edi
+  802e79:	48 b8 87 1d 80 00 00 	movabs $0x801d87,%rax
+  802e80:	00 00 00 
+  802e83:	ff d0                	call   *%rax
+  802e85:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  802e87:	85 c0                	test   %eax,%eax
+  802e89:	78 06                	js     802e91 <getchar+0x2e>
+  802e8b:	74 08                	je     802e95 <getchar+0x32>
+  802e8d:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  802e91:	89 d0                	mov    %edx,%eax
+  802e93:	c9                   	leave
+  802e94:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  802e95:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  802e9a:	eb f5                	jmp    802e91 <getchar+0x2e>
+
+0000000000802e9c <iscons>:
+iscons(int fdnum) {
+  802e9c:	55                   	push   %rbp
+  802e9d:	48 89 e5             	mov    %rsp,%rbp
+  802ea0:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  802ea4:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802ea8:	48 b8 a4 1a 80 00 00 	movabs $0x801aa4,%rax
+  802eaf:	00 00 00 
+  802eb2:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802eb4:	85 c0                	test   %eax,%eax
+  802eb6:	78 18                	js     802ed0 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  802eb8:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802ebc:	48 b8 a0 40 80 00 00 	movabs $0x8040a0,%rax
+  802ec3:	00 00 00 
+  802ec6:	8b 00                	mov    (%rax),%eax
+  802ec8:	39 02                	cmp    %eax,(%rdx)
+  802eca:	0f 94 c0             	sete   %al
+  802ecd:	0f b6 c0             	movzbl %al,%eax
+}
+  802ed0:	c9                   	leave
+  802ed1:	c3                   	ret
+
+0000000000802ed2 <opencons>:
+opencons(void) {
+  802ed2:	55                   	push   %rbp
+  802ed3:	48 89 e5             	mov    %rsp,%rbp
+  802ed6:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802eda:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  802ede:	48 b8 8a 1a 80 00 00 	movabs $0x801a8a,%rax
+  802ee5:	00 00 00 
+  802ee8:	ff d0                	call   *%rax
+  802eea:	85 c0                	test   %eax,%eax
+  802eec:	78 49                	js     802f37 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  802eee:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802ef3:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802ef8:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  802efc:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f01:	48 b8 7c 12 80 00 00 	movabs $0x80127c,%rax
+  802f08:	00 00 00 
+  802f0b:	ff d0                	call   *%rax
+  802f0d:	85 c0                	test   %eax,%eax
+  802f0f:	78 26                	js     802f37 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  802f11:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802f15:	a1 a0 40 80 00 00 00 	movabs 0x8040a0,%eax
+  802f1c:	00 00 
+  802f1e:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  802f20:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802f24:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  802f2b:	48 b8 e3 19 80 00 00 	movabs $0x8019e3,%rax
+  802f32:	00 00 00 
+  802f35:	ff d0                	call   *%rax
+}
+  802f37:	c9                   	leave
+  802f38:	c3                   	ret
+  802f39:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000802f40 <__rodata_start>:
+  802f40:	25 64 20 00 66       	and    $0x66002064,%eax
+  802f45:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802f46:	72 6b                	jb     802fb3 <__rodata_start+0x73>
+  802f48:	3a 20                	cmp    (%rax),%ah
+  802f4a:	25 69 00 75 73       	and    $0x73750069,%eax
+  802f4f:	65 72 2f             	gs jb  802f81 <__rodata_start+0x41>
+  802f52:	70 72                	jo     802fc6 <__rodata_start+0x86>
+  802f54:	69 6d 65 73 2e 63 00 	imul   $0x632e73,0x65(%rbp),%ebp
+  802f5b:	3c 75                	cmp    $0x75,%al
+  802f5d:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802f5e:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  802f62:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802f63:	3e 00 0f             	ds add %cl,(%rdi)
+  802f66:	1f                   	(bad)
+  802f67:	00 5b 25             	add    %bl,0x25(%rbx)
+  802f6a:	30 38                	xor    %bh,(%rax)
+  802f6c:	78 5d                	js     802fcb <__rodata_start+0x8b>
+  802f6e:	20 75 73             	and    %dh,0x73(%rbp)
+  802f71:	65 72 20             	gs jb  802f94 <__rodata_start+0x54>
+  802f74:	70 61                	jo     802fd7 <__rodata_start+0x97>
+  802f76:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802f77:	69 63 20 69 6e 20 25 	imul   $0x25206e69,0x20(%rbx),%esp
+  802f7e:	73 20                	jae    802fa0 <__rodata_start+0x60>
+  802f80:	61                   	(bad)
+  802f81:	74 20                	je     802fa3 <__rodata_start+0x63>
+  802f83:	25 73 3a 25 64       	and    $0x64253a73,%eax
+  802f88:	3a 20                	cmp    (%rax),%ah
+  802f8a:	00 30                	add    %dh,(%rax)
+  802f8c:	31 32                	xor    %esi,(%rdx)
+  802f8e:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  802f95:	41                   	rex.B
+  802f96:	42                   	rex.X
+  802f97:	43                   	rex.XB
+  802f98:	44                   	rex.R
+  802f99:	45                   	rex.RB
+  802f9a:	46 00 30             	rex.RX add %r14b,(%rax)
+  802f9d:	31 32                	xor    %esi,(%rdx)
+  802f9f:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  802fa6:	61                   	(bad)
+  802fa7:	62 63 64 65 66       	(bad)
+  802fac:	00 28                	add    %ch,(%rax)
+  802fae:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802faf:	75 6c                	jne    80301d <__rodata_start+0xdd>
+  802fb1:	6c                   	insb   (%dx),%es:(%rdi)
+  802fb2:	29 00                	sub    %eax,(%rax)
+  802fb4:	65 72 72             	gs jb  803029 <__rodata_start+0xe9>
+  802fb7:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802fb8:	72 20                	jb     802fda <__rodata_start+0x9a>
+  802fba:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  802fbf:	73 70                	jae    803031 <__rodata_start+0xf1>
+  802fc1:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  802fc5:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  802fcc:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802fcd:	72 00                	jb     802fcf <__rodata_start+0x8f>
+  802fcf:	62 61 64 20 65       	(bad)
+  802fd4:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802fd5:	76 69                	jbe    803040 <__rodata_start+0x100>
+  802fd7:	72 6f                	jb     803048 <__rodata_start+0x108>
+  802fd9:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802fda:	6d                   	insl   (%dx),%es:(%rdi)
+  802fdb:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  802fdd:	74 00                	je     802fdf <__rodata_start+0x9f>
+  802fdf:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  802fe6:	20 70 61             	and    %dh,0x61(%rax)
+  802fe9:	72 61                	jb     80304c <__rodata_start+0x10c>
+  802feb:	6d                   	insl   (%dx),%es:(%rdi)
+  802fec:	65 74 65             	gs je  803054 <__rodata_start+0x114>
+  802fef:	72 00                	jb     802ff1 <__rodata_start+0xb1>
+  802ff1:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802ff2:	75 74                	jne    803068 <__rodata_start+0x128>
+  802ff4:	20 6f 66             	and    %ch,0x66(%rdi)
+  802ff7:	20 6d 65             	and    %ch,0x65(%rbp)
+  802ffa:	6d                   	insl   (%dx),%es:(%rdi)
+  802ffb:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802ffc:	72 79                	jb     803077 <__rodata_start+0x137>
+  802ffe:	00 6f 75             	add    %ch,0x75(%rdi)
+  803001:	74 20                	je     803023 <__rodata_start+0xe3>
+  803003:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803004:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  803008:	76 69                	jbe    803073 <__rodata_start+0x133>
+  80300a:	72 6f                	jb     80307b <__rodata_start+0x13b>
+  80300c:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80300d:	6d                   	insl   (%dx),%es:(%rdi)
+  80300e:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803010:	74 73                	je     803085 <__rodata_start+0x145>
+  803012:	00 63 6f             	add    %ah,0x6f(%rbx)
+  803015:	72 72                	jb     803089 <__rodata_start+0x149>
+  803017:	75 70                	jne    803089 <__rodata_start+0x149>
+  803019:	74 65                	je     803080 <__rodata_start+0x140>
+  80301b:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  803020:	75 67                	jne    803089 <__rodata_start+0x149>
+  803022:	20 69 6e             	and    %ch,0x6e(%rcx)
+  803025:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  803027:	00 73 65             	add    %dh,0x65(%rbx)
+  80302a:	67 6d                	insl   (%dx),%es:(%edi)
+  80302c:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  80302e:	74 61                	je     803091 <__rodata_start+0x151>
+  803030:	74 69                	je     80309b <__rodata_start+0x15b>
+  803032:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803033:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803034:	20 66 61             	and    %ah,0x61(%rsi)
+  803037:	75 6c                	jne    8030a5 <__rodata_start+0x165>
+  803039:	74 00                	je     80303b <__rodata_start+0xfb>
+  80303b:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  803042:	20 45 4c             	and    %al,0x4c(%rbp)
+  803045:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  803049:	61                   	(bad)
+  80304a:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  80304f:	20 73 75             	and    %dh,0x75(%rbx)
+  803052:	63 68 20             	movsxd 0x20(%rax),%ebp
+  803055:	73 79                	jae    8030d0 <__rodata_start+0x190>
+  803057:	73 74                	jae    8030cd <__rodata_start+0x18d>
+  803059:	65 6d                	gs insl (%dx),%es:(%rdi)
+  80305b:	20 63 61             	and    %ah,0x61(%rbx)
+  80305e:	6c                   	insb   (%dx),%es:(%rdi)
+  80305f:	6c                   	insb   (%dx),%es:(%rdi)
+  803060:	00 65 6e             	add    %ah,0x6e(%rbp)
+  803063:	74 72                	je     8030d7 <__rodata_start+0x197>
+  803065:	79 20                	jns    803087 <__rodata_start+0x147>
+  803067:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803068:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803069:	74 20                	je     80308b <__rodata_start+0x14b>
+  80306b:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  80306d:	75 6e                	jne    8030dd <__rodata_start+0x19d>
+  80306f:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  803073:	76 20                	jbe    803095 <__rodata_start+0x155>
+  803075:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  80307c:	72 65                	jb     8030e3 <__rodata_start+0x1a3>
+  80307e:	63 76 69             	movsxd 0x69(%rsi),%esi
+  803081:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803082:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  803086:	65 78 70             	gs js  8030f9 <__rodata_start+0x1b9>
+  803089:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  80308e:	20 65 6e             	and    %ah,0x6e(%rbp)
+  803091:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  803095:	20 66 69             	and    %ah,0x69(%rsi)
+  803098:	6c                   	insb   (%dx),%es:(%rdi)
+  803099:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  80309d:	20 66 72             	and    %ah,0x72(%rsi)
+  8030a0:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  8030a5:	61                   	(bad)
+  8030a6:	63 65 20             	movsxd 0x20(%rbp),%esp
+  8030a9:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8030aa:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8030ab:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  8030af:	6b 00 74             	imul   $0x74,(%rax),%eax
+  8030b2:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8030b3:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8030b4:	20 6d 61             	and    %ch,0x61(%rbp)
+  8030b7:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8030b8:	79 20                	jns    8030da <__rodata_start+0x19a>
+  8030ba:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  8030c1:	72 65                	jb     803128 <__rodata_start+0x1e8>
+  8030c3:	20 6f 70             	and    %ch,0x70(%rdi)
+  8030c6:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  8030c8:	00 66 69             	add    %ah,0x69(%rsi)
+  8030cb:	6c                   	insb   (%dx),%es:(%rdi)
+  8030cc:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  8030d0:	20 62 6c             	and    %ah,0x6c(%rdx)
+  8030d3:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8030d4:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  8030d7:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8030d8:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8030d9:	74 20                	je     8030fb <__rodata_start+0x1bb>
+  8030db:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  8030dd:	75 6e                	jne    80314d <__rodata_start+0x20d>
+  8030df:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  8030e3:	76 61                	jbe    803146 <__rodata_start+0x206>
+  8030e5:	6c                   	insb   (%dx),%es:(%rdi)
+  8030e6:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  8030ed:	00 
+  8030ee:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  8030f5:	72 65                	jb     80315c <__rodata_start+0x21c>
+  8030f7:	61                   	(bad)
+  8030f8:	64 79 20             	fs jns 80311b <__rodata_start+0x1db>
+  8030fb:	65 78 69             	gs js  803167 <__rodata_start+0x227>
+  8030fe:	73 74                	jae    803174 <__rodata_start+0x234>
+  803100:	73 00                	jae    803102 <__rodata_start+0x1c2>
+  803102:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803103:	70 65                	jo     80316a <__rodata_start+0x22a>
+  803105:	72 61                	jb     803168 <__rodata_start+0x228>
+  803107:	74 69                	je     803172 <__rodata_start+0x232>
+  803109:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80310a:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80310b:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  80310e:	74 20                	je     803130 <__rodata_start+0x1f0>
+  803110:	73 75                	jae    803187 <__rodata_start+0x247>
+  803112:	70 70                	jo     803184 <__rodata_start+0x244>
+  803114:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803115:	72 74                	jb     80318b <__rodata_start+0x24b>
+  803117:	65 64 00 6f 70       	gs add %ch,%fs:0x70(%rdi)
+  80311c:	65 72 61             	gs jb  803180 <__rodata_start+0x240>
+  80311f:	74 69                	je     80318a <__rodata_start+0x24a>
+  803121:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803122:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803123:	20 69 6e             	and    %ch,0x6e(%rcx)
+  803126:	74 65                	je     80318d <__rodata_start+0x24d>
+  803128:	72 72                	jb     80319c <__rodata_start+0x25c>
+  80312a:	75 70                	jne    80319c <__rodata_start+0x25c>
+  80312c:	74 65                	je     803193 <__rodata_start+0x253>
+  80312e:	64 00 6e 6f          	add    %ch,%fs:0x6f(%rsi)
+  803132:	74 20                	je     803154 <__rodata_start+0x214>
+  803134:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803136:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803137:	75 67                	jne    8031a0 <__rodata_start+0x260>
+  803139:	68 20 43 50 55       	push   $0x55504320
+  80313e:	20 74 69 6d          	and    %dh,0x6d(%rcx,%rbp,2)
+  803142:	65 00 66 2e          	add    %ah,%gs:0x2e(%rsi)
+  803146:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+  80314d:	00 
+  80314e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  803155:	00 00 00 
+  803158:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+  80315f:	00 
+  803160:	94                   	xchg   %eax,%esp
+  803161:	05 80 00 00 00       	add    $0x80,%eax
+  803166:	00 00                	add    %al,(%rax)
+  803168:	d5                   	(bad)
+  803169:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  80316f:	00 c5                	add    %al,%ch
+  803171:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803177:	00 d5                	add    %dl,%ch
+  803179:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  80317f:	00 d5                	add    %dl,%ch
+  803181:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803187:	00 d5                	add    %dl,%ch
+  803189:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  80318f:	00 d5                	add    %dl,%ch
+  803191:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803197:	00 b3 05 80 00 00    	add    %dh,0x8005(%rbx)
+  80319d:	00 00                	add    %al,(%rax)
+  80319f:	00 d5                	add    %dl,%ch
+  8031a1:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  8031a7:	00 d5                	add    %dl,%ch
+  8031a9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  8031af:	00 a7 05 80 00 00    	add    %ah,0x8005(%rdi)
+  8031b5:	00 00                	add    %al,(%rax)
+  8031b7:	00 21                	add    %ah,(%rcx)
+  8031b9:	06                   	(bad)
+  8031ba:	80 00 00             	addb   $0x0,(%rax)
+  8031bd:	00 00                	add    %al,(%rax)
+  8031bf:	00 d5                	add    %dl,%ch
+  8031c1:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  8031c7:	00 a7 05 80 00 00    	add    %ah,0x8005(%rdi)
+  8031cd:	00 00                	add    %al,(%rax)
+  8031cf:	00 ed                	add    %ch,%ch
+  8031d1:	05 80 00 00 00       	add    $0x80,%eax
+  8031d6:	00 00                	add    %al,(%rax)
+  8031d8:	ed                   	in     (%dx),%eax
+  8031d9:	05 80 00 00 00       	add    $0x80,%eax
+  8031de:	00 00                	add    %al,(%rax)
+  8031e0:	ed                   	in     (%dx),%eax
+  8031e1:	05 80 00 00 00       	add    $0x80,%eax
+  8031e6:	00 00                	add    %al,(%rax)
+  8031e8:	ed                   	in     (%dx),%eax
+  8031e9:	05 80 00 00 00       	add    $0x80,%eax
+  8031ee:	00 00                	add    %al,(%rax)
+  8031f0:	ed                   	in     (%dx),%eax
+  8031f1:	05 80 00 00 00       	add    $0x80,%eax
+  8031f6:	00 00                	add    %al,(%rax)
+  8031f8:	ed                   	in     (%dx),%eax
+  8031f9:	05 80 00 00 00       	add    $0x80,%eax
+  8031fe:	00 00                	add    %al,(%rax)
+  803200:	ed                   	in     (%dx),%eax
+  803201:	05 80 00 00 00       	add    $0x80,%eax
+  803206:	00 00                	add    %al,(%rax)
+  803208:	ed                   	in     (%dx),%eax
+  803209:	05 80 00 00 00       	add    $0x80,%eax
+  80320e:	00 00                	add    %al,(%rax)
+  803210:	ed                   	in     (%dx),%eax
+  803211:	05 80 00 00 00       	add    $0x80,%eax
+  803216:	00 00                	add    %al,(%rax)
+  803218:	d5                   	(bad)
+  803219:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  80321f:	00 d5                	add    %dl,%ch
+  803221:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803227:	00 d5                	add    %dl,%ch
+  803229:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  80322f:	00 d5                	add    %dl,%ch
+  803231:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803237:	00 d5                	add    %dl,%ch
+  803239:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  80323f:	00 d5                	add    %dl,%ch
+  803241:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803247:	00 d5                	add    %dl,%ch
+  803249:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  80324f:	00 d5                	add    %dl,%ch
+  803251:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803257:	00 d5                	add    %dl,%ch
+  803259:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  80325f:	00 d5                	add    %dl,%ch
+  803261:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803267:	00 d5                	add    %dl,%ch
+  803269:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  80326f:	00 d5                	add    %dl,%ch
+  803271:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803277:	00 d5                	add    %dl,%ch
+  803279:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  80327f:	00 d5                	add    %dl,%ch
+  803281:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803287:	00 d5                	add    %dl,%ch
+  803289:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  80328f:	00 d5                	add    %dl,%ch
+  803291:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803297:	00 d5                	add    %dl,%ch
+  803299:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  80329f:	00 d5                	add    %dl,%ch
+  8032a1:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  8032a7:	00 d5                	add    %dl,%ch
+  8032a9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  8032af:	00 d5                	add    %dl,%ch
+  8032b1:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  8032b7:	00 d5                	add    %dl,%ch
+  8032b9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  8032bf:	00 d5                	add    %dl,%ch
+  8032c1:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  8032c7:	00 d5                	add    %dl,%ch
+  8032c9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  8032cf:	00 d5                	add    %dl,%ch
+  8032d1:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  8032d7:	00 d5                	add    %dl,%ch
+  8032d9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  8032df:	00 d5                	add    %dl,%ch
+  8032e1:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  8032e7:	00 d5                	add    %dl,%ch
+  8032e9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  8032ef:	00 d5                	add    %dl,%ch
+  8032f1:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  8032f7:	00 d5                	add    %dl,%ch
+  8032f9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  8032ff:	00 d5                	add    %dl,%ch
+  803301:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803307:	00 f8                	add    %bh,%al
+  803309:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80330f:	00 d5                	add    %dl,%ch
+  803311:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803317:	00 d5                	add    %dl,%ch
+  803319:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  80331f:	00 d5                	add    %dl,%ch
+  803321:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803327:	00 d5                	add    %dl,%ch
+  803329:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  80332f:	00 d5                	add    %dl,%ch
+  803331:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803337:	00 d5                	add    %dl,%ch
+  803339:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  80333f:	00 d5                	add    %dl,%ch
+  803341:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803347:	00 d5                	add    %dl,%ch
+  803349:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  80334f:	00 d5                	add    %dl,%ch
+  803351:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803357:	00 d5                	add    %dl,%ch
+  803359:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  80335f:	00 44 06 80          	add    %al,-0x80(%rsi,%rax,1)
+  803363:	00 00                	add    %al,(%rax)
+  803365:	00 00                	add    %al,(%rax)
+  803367:	00 13                	add    %dl,(%rbx)
+  803369:	08 80 00 00 00 00    	or     %al,0x0(%rax)
+  80336f:	00 d5                	add    %dl,%ch
+  803371:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803377:	00 d5                	add    %dl,%ch
+  803379:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  80337f:	00 d5                	add    %dl,%ch
+  803381:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803387:	00 d5                	add    %dl,%ch
+  803389:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  80338f:	00 73 06             	add    %dh,0x6(%rbx)
+  803392:	80 00 00             	addb   $0x0,(%rax)
+  803395:	00 00                	add    %al,(%rax)
+  803397:	00 d5                	add    %dl,%ch
+  803399:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  80339f:	00 d5                	add    %dl,%ch
+  8033a1:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  8033a7:	00 39                	add    %bh,(%rcx)
+  8033a9:	06                   	(bad)
+  8033aa:	80 00 00             	addb   $0x0,(%rax)
+  8033ad:	00 00                	add    %al,(%rax)
+  8033af:	00 d5                	add    %dl,%ch
+  8033b1:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  8033b7:	00 d5                	add    %dl,%ch
+  8033b9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  8033bf:	00 bb 09 80 00 00    	add    %bh,0x8009(%rbx)
+  8033c5:	00 00                	add    %al,(%rax)
+  8033c7:	00 85 0a 80 00 00    	add    %al,0x800a(%rbp)
+  8033cd:	00 00                	add    %al,(%rax)
+  8033cf:	00 d5                	add    %dl,%ch
+  8033d1:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  8033d7:	00 d5                	add    %dl,%ch
+  8033d9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  8033df:	00 0a                	add    %cl,(%rdx)
+  8033e1:	07                   	(bad)
+  8033e2:	80 00 00             	addb   $0x0,(%rax)
+  8033e5:	00 00                	add    %al,(%rax)
+  8033e7:	00 d5                	add    %dl,%ch
+  8033e9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  8033ef:	00 e7                	add    %ah,%bh
+  8033f1:	08 80 00 00 00 00    	or     %al,0x0(%rax)
+  8033f7:	00 d5                	add    %dl,%ch
+  8033f9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  8033ff:	00 d5                	add    %dl,%ch
+  803401:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803407:	00 f8                	add    %bh,%al
+  803409:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80340f:	00 d5                	add    %dl,%ch
+  803411:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803417:	00 9d 05 80 00 00    	add    %bl,0x8005(%rbp)
+  80341d:	00 00                	add    %al,(%rax)
+	...
+
+0000000000803420 <error_string>:
+	...
+  803428:	bd 2f 80 00 00 00 00 00 cf 2f 80 00 00 00 00 00     ./......./......
+  803438:	df 2f 80 00 00 00 00 00 f1 2f 80 00 00 00 00 00     ./......./......
+  803448:	ff 2f 80 00 00 00 00 00 13 30 80 00 00 00 00 00     ./.......0......
+  803458:	28 30 80 00 00 00 00 00 3b 30 80 00 00 00 00 00     (0......;0......
+  803468:	4d 30 80 00 00 00 00 00 61 30 80 00 00 00 00 00     M0......a0......
+  803478:	71 30 80 00 00 00 00 00 84 30 80 00 00 00 00 00     q0.......0......
+  803488:	9b 30 80 00 00 00 00 00 b1 30 80 00 00 00 00 00     .0.......0......
+  803498:	c9 30 80 00 00 00 00 00 e1 30 80 00 00 00 00 00     .0.......0......
+  8034a8:	ee 30 80 00 00 00 00 00 d0 34 80 00 00 00 00 00     .0.......4......
+  8034b8:	02 31 80 00 00 00 00 00 1a 31 80 00 00 00 00 00     .1.......1......
+  8034c8:	30 31 80 00 00 00 00 00 66 69 6c 65 20 69 73 20     01......file is 
+  8034d8:	6e 6f 74 20 61 20 76 61 6c 69 64 20 65 78 65 63     not a valid exec
+  8034e8:	75 74 61 62 6c 65 00 90 73 79 73 63 61 6c 6c 20     utable..syscall 
+  8034f8:	25 7a 64 20 72 65 74 75 72 6e 65 64 20 25 7a 64     %zd returned %zd
+  803508:	20 28 3e 20 30 29 00 6c 69 62 2f 73 79 73 63 61      (> 0).lib/sysca
+  803518:	6c 6c 2e 63 00 46 6f 72 6b 20 64 6f 75 62 6c 65     ll.c.Fork double
+  803528:	20 66 61 75 6c 74 00 6c 69 62 2f 66 6f 72 6b 2e      fault.lib/fork.
+  803538:	63 00 73 66 6f 72 6b 28 29 20 69 73 20 6e 6f 74     c.sfork() is not
+  803548:	20 69 6d 70 6c 65 6d 65 6e 74 65 64 00 73 79 73      implemented.sys
+  803558:	5f 69 70 63 5f 74 72 79 5f 73 65 6e 64 20 66 61     _ipc_try_send fa
+  803568:	69 6c 65 64 3a 20 25 69 00 6c 69 62 2f 69 70 63     iled: %i.lib/ipc
+  803578:	2e 63 00 0f 1f 44 00 00 5b 25 30 38 78 5d 20 75     .c...D..[%08x] u
+  803588:	6e 6b 6e 6f 77 6e 20 64 65 76 69 63 65 20 74 79     nknown device ty
+  803598:	70 65 20 25 64 0a 00 00 5b 25 30 38 78 5d 20 66     pe %d...[%08x] f
+  8035a8:	74 72 75 6e 63 61 74 65 20 25 64 20 2d 2d 20 62     truncate %d -- b
+  8035b8:	61 64 20 6d 6f 64 65 0a 00 5b 25 30 38 78 5d 20     ad mode..[%08x] 
+  8035c8:	72 65 61 64 20 25 64 20 2d 2d 20 62 61 64 20 6d     read %d -- bad m
+  8035d8:	6f 64 65 0a 00 5b 25 30 38 78 5d 20 77 72 69 74     ode..[%08x] writ
+  8035e8:	65 20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65     e %d -- bad mode
+  8035f8:	0a 00 66 0f 1f 44 00 00                             ..f..D..
+
+0000000000803600 <devtab>:
+  803600:	20 40 80 00 00 00 00 00 60 40 80 00 00 00 00 00      @......`@......
+  803610:	a0 40 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .@..............
+  803620:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  803630:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  803640:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  803650:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  803660:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  803670:	3d 20 32 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73 00     = 2.<cons>.cons.
+  803680:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803690:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8036a0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8036b0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8036c0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8036d0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8036e0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8036f0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803700:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803710:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803720:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803730:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803740:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803750:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803760:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803770:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803780:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803790:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8037a0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8037b0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8037c0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8037d0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8037e0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8037f0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803800:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803810:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803820:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803830:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803840:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803850:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803860:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803870:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803880:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803890:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8038a0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8038b0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8038c0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8038d0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8038e0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8038f0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803900:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803910:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803920:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803930:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803940:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803950:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803960:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803970:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803980:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803990:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8039a0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8039b0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8039c0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8039d0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8039e0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8039f0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803a00:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803a10:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803a20:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803a30:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803a40:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803a50:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803a60:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803a70:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803a80:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803a90:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803aa0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803ab0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803ac0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803ad0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803ae0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803af0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803b00:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803b10:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803b20:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803b30:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803b40:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803b50:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803b60:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803b70:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803b80:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803b90:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803ba0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803bb0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803bc0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803bd0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803be0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803bf0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803c00:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803c10:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803c20:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803c30:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803c40:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803c50:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803c60:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803c70:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803c80:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803c90:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803ca0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803cb0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803cc0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803cd0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803ce0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803cf0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803d00:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803d10:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803d20:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803d30:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803d40:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803d50:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803d60:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803d70:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803d80:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803d90:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803da0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803db0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803dc0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803dd0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803de0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803df0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803e00:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803e10:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803e20:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803e30:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803e40:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803e50:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803e60:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803e70:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803e80:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803e90:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803ea0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803eb0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803ec0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803ed0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803ee0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803ef0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803f00:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803f10:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803f20:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803f30:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803f40:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803f50:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803f60:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803f70:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803f80:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803f90:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803fa0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803fb0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803fc0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803fd0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803fe0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803ff0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 90     ....f.........f.
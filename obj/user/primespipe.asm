@@ -0,0 +1,6093 @@
+
+obj/user/primespipe:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 36 03 00 00       	call   800359 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <primeproc>:
+ * of main and user/idle. */
+
+#include <inc/lib.h>
+
+unsigned
+primeproc(int fd) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 57                	push   %r15
+  80002b:	41 56                	push   %r14
+  80002d:	41 55                	push   %r13
+  80002f:	41 54                	push   %r12
+  800031:	53                   	push   %rbx
+  800032:	48 83 ec 18          	sub    $0x18,%rsp
+  800036:	89 fb                	mov    %edi,%ebx
+    int id, p, pfd[2], wfd, r;
+
+    /* Fetch a prime from our left neighbor */
+top:
+    if ((r = readn(fd, &p, 4)) != 4)
+  800038:	49 bc 4b 1e 80 00 00 	movabs $0x801e4b,%r12
+  80003f:	00 00 00 
+        panic("primeproc could not read initial prime: %d, %i", r, r >= 0 ? 0 : r);
+
+    cprintf("%d\n", p);
+  800042:	49 bf 49 31 80 00 00 	movabs $0x803149,%r15
+  800049:	00 00 00 
+  80004c:	49 be 75 05 80 00 00 	movabs $0x800575,%r14
+  800053:	00 00 00 
+
+    /* Fork a right neighbor to continue the chain */
+    if ((r = pipe(pfd)) < 0)
+  800056:	49 bd 17 28 80 00 00 	movabs $0x802817,%r13
+  80005d:	00 00 00 
+    if ((r = readn(fd, &p, 4)) != 4)
+  800060:	ba 04 00 00 00       	mov    $0x4,%edx
+  800065:	48 8d 75 cc          	lea    -0x34(%rbp),%rsi
+  800069:	89 df                	mov    %ebx,%edi
+  80006b:	41 ff d4             	call   *%r12
+  80006e:	89 c1                	mov    %eax,%ecx
+  800070:	83 f8 04             	cmp    $0x4,%eax
+  800073:	75 4b                	jne    8000c0 <primeproc+0x9b>
+    cprintf("%d\n", p);
+  800075:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  800078:	4c 89 ff             	mov    %r15,%rdi
+  80007b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800080:	41 ff d6             	call   *%r14
+    if ((r = pipe(pfd)) < 0)
+  800083:	48 8d 7d c4          	lea    -0x3c(%rbp),%rdi
+  800087:	41 ff d5             	call   *%r13
+  80008a:	85 c0                	test   %eax,%eax
+  80008c:	78 69                	js     8000f7 <primeproc+0xd2>
+        panic("pipe: %i", r);
+    if ((id = fork()) < 0)
+  80008e:	48 b8 85 18 80 00 00 	movabs $0x801885,%rax
+  800095:	00 00 00 
+  800098:	ff d0                	call   *%rax
+  80009a:	85 c0                	test   %eax,%eax
+  80009c:	0f 88 82 00 00 00    	js     800124 <primeproc+0xff>
+        panic("fork: %i", id);
+    if (id == 0) {
+  8000a2:	0f 85 a9 00 00 00    	jne    800151 <primeproc+0x12c>
+        close(fd);
+  8000a8:	89 df                	mov    %ebx,%edi
+  8000aa:	48 bb 0f 1c 80 00 00 	movabs $0x801c0f,%rbx
+  8000b1:	00 00 00 
+  8000b4:	ff d3                	call   *%rbx
+        close(pfd[1]);
+  8000b6:	8b 7d c8             	mov    -0x38(%rbp),%edi
+  8000b9:	ff d3                	call   *%rbx
+        fd = pfd[0];
+  8000bb:	8b 5d c4             	mov    -0x3c(%rbp),%ebx
+        goto top;
+  8000be:	eb a0                	jmp    800060 <primeproc+0x3b>
+        panic("primeproc could not read initial prime: %d, %i", r, r >= 0 ? 0 : r);
+  8000c0:	85 c0                	test   %eax,%eax
+  8000c2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8000c8:	44 0f 4e c0          	cmovle %eax,%r8d
+  8000cc:	48 ba 08 31 80 00 00 	movabs $0x803108,%rdx
+  8000d3:	00 00 00 
+  8000d6:	be 14 00 00 00       	mov    $0x14,%esi
+  8000db:	48 bf 37 31 80 00 00 	movabs $0x803137,%rdi
+  8000e2:	00 00 00 
+  8000e5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000ea:	49 b9 25 04 80 00 00 	movabs $0x800425,%r9
+  8000f1:	00 00 00 
+  8000f4:	41 ff d1             	call   *%r9
+        panic("pipe: %i", r);
+  8000f7:	89 c1                	mov    %eax,%ecx
+  8000f9:	48 ba 4d 31 80 00 00 	movabs $0x80314d,%rdx
+  800100:	00 00 00 
+  800103:	be 1a 00 00 00       	mov    $0x1a,%esi
+  800108:	48 bf 37 31 80 00 00 	movabs $0x803137,%rdi
+  80010f:	00 00 00 
+  800112:	b8 00 00 00 00       	mov    $0x0,%eax
+  800117:	49 b8 25 04 80 00 00 	movabs $0x800425,%r8
+  80011e:	00 00 00 
+  800121:	41 ff d0             	call   *%r8
+        panic("fork: %i", id);
+  800124:	89 c1                	mov    %eax,%ecx
+  800126:	48 ba 56 31 80 00 00 	movabs $0x803156,%rdx
+  80012d:	00 00 00 
+  800130:	be 1c 00 00 00       	mov    $0x1c,%esi
+  800135:	48 bf 37 31 80 00 00 	movabs $0x803137,%rdi
+  80013c:	00 00 00 
+  80013f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800144:	49 b8 25 04 80 00 00 	movabs $0x800425,%r8
+  80014b:	00 00 00 
+  80014e:	41 ff d0             	call   *%r8
+    }
+
+    close(pfd[0]);
+  800151:	8b 7d c4             	mov    -0x3c(%rbp),%edi
+  800154:	48 b8 0f 1c 80 00 00 	movabs $0x801c0f,%rax
+  80015b:	00 00 00 
+  80015e:	ff d0                	call   *%rax
+    wfd = pfd[1];
+  800160:	44 8b 6d c8          	mov    -0x38(%rbp),%r13d
+
+    /* Filter out multiples of our prime */
+    for (int i;;) {
+        if ((r = readn(fd, &i, 4)) != 4)
+  800164:	49 bc 4b 1e 80 00 00 	movabs $0x801e4b,%r12
+  80016b:	00 00 00 
+  80016e:	ba 04 00 00 00       	mov    $0x4,%edx
+  800173:	48 8d 75 c0          	lea    -0x40(%rbp),%rsi
+  800177:	89 df                	mov    %ebx,%edi
+  800179:	41 ff d4             	call   *%r12
+  80017c:	83 f8 04             	cmp    $0x4,%eax
+  80017f:	75 65                	jne    8001e6 <primeproc+0x1c1>
+            panic("primeproc %d readn %d %d %i", p, fd, r, r >= 0 ? 0 : r);
+        if (i % p)
+  800181:	8b 45 c0             	mov    -0x40(%rbp),%eax
+  800184:	99                   	cltd
+  800185:	f7 7d cc             	idivl  -0x34(%rbp)
+  800188:	85 d2                	test   %edx,%edx
+  80018a:	74 e2                	je     80016e <primeproc+0x149>
+            if ((r = write(wfd, &i, 4)) != 4)
+  80018c:	ba 04 00 00 00       	mov    $0x4,%edx
+  800191:	48 8d 75 c0          	lea    -0x40(%rbp),%rsi
+  800195:	44 89 ef             	mov    %r13d,%edi
+  800198:	48 b8 bc 1e 80 00 00 	movabs $0x801ebc,%rax
+  80019f:	00 00 00 
+  8001a2:	ff d0                	call   *%rax
+  8001a4:	83 f8 04             	cmp    $0x4,%eax
+  8001a7:	74 c5                	je     80016e <primeproc+0x149>
+                panic("primeproc %d write: %d %i", p, r, r >= 0 ? 0 : r);
+  8001a9:	85 c0                	test   %eax,%eax
+  8001ab:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8001b1:	44 0f 4e c8          	cmovle %eax,%r9d
+  8001b5:	41 89 c0             	mov    %eax,%r8d
+  8001b8:	8b 4d cc             	mov    -0x34(%rbp),%ecx
+  8001bb:	48 ba 7b 31 80 00 00 	movabs $0x80317b,%rdx
+  8001c2:	00 00 00 
+  8001c5:	be 2d 00 00 00       	mov    $0x2d,%esi
+  8001ca:	48 bf 37 31 80 00 00 	movabs $0x803137,%rdi
+  8001d1:	00 00 00 
+  8001d4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001d9:	49 ba 25 04 80 00 00 	movabs $0x800425,%r10
+  8001e0:	00 00 00 
+  8001e3:	41 ff d2             	call   *%r10
+            panic("primeproc %d readn %d %d %i", p, fd, r, r >= 0 ? 0 : r);
+  8001e6:	48 83 ec 08          	sub    $0x8,%rsp
+  8001ea:	85 c0                	test   %eax,%eax
+  8001ec:	ba 00 00 00 00       	mov    $0x0,%edx
+  8001f1:	0f 4e d0             	cmovle %eax,%edx
+  8001f4:	52                   	push   %rdx
+  8001f5:	41 89 c1             	mov    %eax,%r9d
+  8001f8:	41 89 d8             	mov    %ebx,%r8d
+  8001fb:	8b 4d cc             	mov    -0x34(%rbp),%ecx
+  8001fe:	48 ba 5f 31 80 00 00 	movabs $0x80315f,%rdx
+  800205:	00 00 00 
+  800208:	be 2a 00 00 00       	mov    $0x2a,%esi
+  80020d:	48 bf 37 31 80 00 00 	movabs $0x803137,%rdi
+  800214:	00 00 00 
+  800217:	b8 00 00 00 00       	mov    $0x0,%eax
+  80021c:	49 ba 25 04 80 00 00 	movabs $0x800425,%r10
+  800223:	00 00 00 
+  800226:	41 ff d2             	call   *%r10
+
+0000000000800229 <umain>:
+    }
+}
+
+void
+umain(int argc, char **argv) {
+  800229:	55                   	push   %rbp
+  80022a:	48 89 e5             	mov    %rsp,%rbp
+  80022d:	53                   	push   %rbx
+  80022e:	48 83 ec 18          	sub    $0x18,%rsp
+    int id, p[2], r;
+
+    binaryname = "primespipe";
+  800232:	48 b8 95 31 80 00 00 	movabs $0x803195,%rax
+  800239:	00 00 00 
+  80023c:	48 a3 00 40 80 00 00 	movabs %rax,0x804000
+  800243:	00 00 00 
+
+    if ((r = pipe(p)) < 0)
+  800246:	48 8d 7d e8          	lea    -0x18(%rbp),%rdi
+  80024a:	48 b8 17 28 80 00 00 	movabs $0x802817,%rax
+  800251:	00 00 00 
+  800254:	ff d0                	call   *%rax
+  800256:	85 c0                	test   %eax,%eax
+  800258:	78 30                	js     80028a <umain+0x61>
+        panic("pipe: %i", r);
+
+    /* Fork the first prime process in the chain */
+    if ((id = fork()) < 0)
+  80025a:	48 b8 85 18 80 00 00 	movabs $0x801885,%rax
+  800261:	00 00 00 
+  800264:	ff d0                	call   *%rax
+  800266:	85 c0                	test   %eax,%eax
+  800268:	78 4d                	js     8002b7 <umain+0x8e>
+        panic("fork: %i", id);
+
+    if (id == 0) {
+  80026a:	75 78                	jne    8002e4 <umain+0xbb>
+        close(p[1]);
+  80026c:	8b 7d ec             	mov    -0x14(%rbp),%edi
+  80026f:	48 b8 0f 1c 80 00 00 	movabs $0x801c0f,%rax
+  800276:	00 00 00 
+  800279:	ff d0                	call   *%rax
+        primeproc(p[0]);
+  80027b:	8b 7d e8             	mov    -0x18(%rbp),%edi
+  80027e:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  800285:	00 00 00 
+  800288:	ff d0                	call   *%rax
+        panic("pipe: %i", r);
+  80028a:	89 c1                	mov    %eax,%ecx
+  80028c:	48 ba 4d 31 80 00 00 	movabs $0x80314d,%rdx
+  800293:	00 00 00 
+  800296:	be 38 00 00 00       	mov    $0x38,%esi
+  80029b:	48 bf 37 31 80 00 00 	movabs $0x803137,%rdi
+  8002a2:	00 00 00 
+  8002a5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002aa:	49 b8 25 04 80 00 00 	movabs $0x800425,%r8
+  8002b1:	00 00 00 
+  8002b4:	41 ff d0             	call   *%r8
+        panic("fork: %i", id);
+  8002b7:	89 c1                	mov    %eax,%ecx
+  8002b9:	48 ba 56 31 80 00 00 	movabs $0x803156,%rdx
+  8002c0:	00 00 00 
+  8002c3:	be 3c 00 00 00       	mov    $0x3c,%esi
+  8002c8:	48 bf 37 31 80 00 00 	movabs $0x803137,%rdi
+  8002cf:	00 00 00 
+  8002d2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002d7:	49 b8 25 04 80 00 00 	movabs $0x800425,%r8
+  8002de:	00 00 00 
+  8002e1:	41 ff d0             	call   *%r8
+    }
+
+    close(p[0]);
+  8002e4:	8b 7d e8             	mov    -0x18(%rbp),%edi
+  8002e7:	48 b8 0f 1c 80 00 00 	movabs $0x801c0f,%rax
+  8002ee:	00 00 00 
+  8002f1:	ff d0                	call   *%rax
+  8002f3:	b8 02 00 00 00       	mov    $0x2,%eax
+
+    /* Feed all the integers through */
+    for (int i = 2;; i++)
+        if ((r = write(p[1], &i, 4)) != 4)
+  8002f8:	48 bb bc 1e 80 00 00 	movabs $0x801ebc,%rbx
+  8002ff:	00 00 00 
+  800302:	eb 06                	jmp    80030a <umain+0xe1>
+    for (int i = 2;; i++)
+  800304:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  800307:	83 c0 01             	add    $0x1,%eax
+  80030a:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+        if ((r = write(p[1], &i, 4)) != 4)
+  80030d:	ba 04 00 00 00       	mov    $0x4,%edx
+  800312:	48 8d 75 e4          	lea    -0x1c(%rbp),%rsi
+  800316:	8b 7d ec             	mov    -0x14(%rbp),%edi
+  800319:	ff d3                	call   *%rbx
+  80031b:	89 c1                	mov    %eax,%ecx
+  80031d:	83 f8 04             	cmp    $0x4,%eax
+  800320:	74 e2                	je     800304 <umain+0xdb>
+            panic("generator write: %d, %i", r, r >= 0 ? 0 : r);
+  800322:	85 c0                	test   %eax,%eax
+  800324:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80032a:	44 0f 4e c0          	cmovle %eax,%r8d
+  80032e:	48 ba a0 31 80 00 00 	movabs $0x8031a0,%rdx
+  800335:	00 00 00 
+  800338:	be 48 00 00 00       	mov    $0x48,%esi
+  80033d:	48 bf 37 31 80 00 00 	movabs $0x803137,%rdi
+  800344:	00 00 00 
+  800347:	b8 00 00 00 00       	mov    $0x0,%eax
+  80034c:	49 b9 25 04 80 00 00 	movabs $0x800425,%r9
+  800353:	00 00 00 
+  800356:	41 ff d1             	call   *%r9
+
+0000000000800359 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800359:	55                   	push   %rbp
+  80035a:	48 89 e5             	mov    %rsp,%rbp
+  80035d:	41 56                	push   %r14
+  80035f:	41 55                	push   %r13
+  800361:	41 54                	push   %r12
+  800363:	53                   	push   %rbx
+  800364:	41 89 fd             	mov    %edi,%r13d
+  800367:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  80036a:	48 ba d8 40 80 00 00 	movabs $0x8040d8,%rdx
+  800371:	00 00 00 
+  800374:	48 b8 d8 40 80 00 00 	movabs $0x8040d8,%rax
+  80037b:	00 00 00 
+  80037e:	48 39 c2             	cmp    %rax,%rdx
+  800381:	73 17                	jae    80039a <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  800383:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  800386:	49 89 c4             	mov    %rax,%r12
+  800389:	48 83 c3 08          	add    $0x8,%rbx
+  80038d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800392:	ff 53 f8             	call   *-0x8(%rbx)
+  800395:	4c 39 e3             	cmp    %r12,%rbx
+  800398:	72 ef                	jb     800389 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+    envid_t this_env_id = sys_getenvid();
+  80039a:	48 b8 8a 13 80 00 00 	movabs $0x80138a,%rax
+  8003a1:	00 00 00 
+  8003a4:	ff d0                	call   *%rax
+    thisenv = &((struct Env*)UENVS)[ENVX(this_env_id)];
+  8003a6:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8003ab:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+  8003b2:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8003b9:	00 00 00 
+  8003bc:	48 01 d0             	add    %rdx,%rax
+  8003bf:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  8003c6:	00 00 00 
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8003c9:	45 85 ed             	test   %r13d,%r13d
+  8003cc:	7e 0d                	jle    8003db <libmain+0x82>
+  8003ce:	49 8b 06             	mov    (%r14),%rax
+  8003d1:	48 a3 00 40 80 00 00 	movabs %rax,0x804000
+  8003d8:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8003db:	4c 89 f6             	mov    %r14,%rsi
+  8003de:	44 89 ef             	mov    %r13d,%edi
+  8003e1:	48 b8 29 02 80 00 00 	movabs $0x800229,%rax
+  8003e8:	00 00 00 
+  8003eb:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8003ed:	48 b8 02 04 80 00 00 	movabs $0x800402,%rax
+  8003f4:	00 00 00 
+  8003f7:	ff d0                	call   *%rax
+#endif
+}
+  8003f9:	5b                   	pop    %rbx
+  8003fa:	41 5c                	pop    %r12
+  8003fc:	41 5d                	pop    %r13
+  8003fe:	41 5e                	pop    %r14
+  800400:	5d                   	pop    %rbp
+  800401:	c3                   	ret
+
+0000000000800402 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  800402:	55                   	push   %rbp
+  800403:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  800406:	48 b8 42 1c 80 00 00 	movabs $0x801c42,%rax
+  80040d:	00 00 00 
+  800410:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  800412:	bf 00 00 00 00       	mov    $0x0,%edi
+  800417:	48 b8 1f 13 80 00 00 	movabs $0x80131f,%rax
+  80041e:	00 00 00 
+  800421:	ff d0                	call   *%rax
+}
+  800423:	5d                   	pop    %rbp
+  800424:	c3                   	ret
+
+0000000000800425 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  800425:	55                   	push   %rbp
+  800426:	48 89 e5             	mov    %rsp,%rbp
+  800429:	41 56                	push   %r14
+  80042b:	41 55                	push   %r13
+  80042d:	41 54                	push   %r12
+  80042f:	53                   	push   %rbx
+  800430:	48 83 ec 50          	sub    $0x50,%rsp
+  800434:	49 89 fc             	mov    %rdi,%r12
+  800437:	41 89 f5             	mov    %esi,%r13d
+  80043a:	48 89 d3             	mov    %rdx,%rbx
+  80043d:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  800441:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  800445:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800449:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  800450:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800454:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  800458:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  80045c:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  800460:	48 b8 00 40 80 00 00 	movabs $0x804000,%rax
+  800467:	00 00 00 
+  80046a:	4c 8b 30             	mov    (%rax),%r14
+  80046d:	48 b8 8a 13 80 00 00 	movabs $0x80138a,%rax
+  800474:	00 00 00 
+  800477:	ff d0                	call   *%rax
+  800479:	89 c6                	mov    %eax,%esi
+  80047b:	45 89 e8             	mov    %r13d,%r8d
+  80047e:	4c 89 e1             	mov    %r12,%rcx
+  800481:	4c 89 f2             	mov    %r14,%rdx
+  800484:	48 bf c8 31 80 00 00 	movabs $0x8031c8,%rdi
+  80048b:	00 00 00 
+  80048e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800493:	49 bc 75 05 80 00 00 	movabs $0x800575,%r12
+  80049a:	00 00 00 
+  80049d:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  8004a0:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  8004a4:	48 89 df             	mov    %rbx,%rdi
+  8004a7:	48 b8 11 05 80 00 00 	movabs $0x800511,%rax
+  8004ae:	00 00 00 
+  8004b1:	ff d0                	call   *%rax
+    cprintf("\n");
+  8004b3:	48 bf 4b 31 80 00 00 	movabs $0x80314b,%rdi
+  8004ba:	00 00 00 
+  8004bd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004c2:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  8004c5:	cc                   	int3
+  8004c6:	eb fd                	jmp    8004c5 <_panic+0xa0>
+
+00000000008004c8 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  8004c8:	55                   	push   %rbp
+  8004c9:	48 89 e5             	mov    %rsp,%rbp
+  8004cc:	53                   	push   %rbx
+  8004cd:	48 83 ec 08          	sub    $0x8,%rsp
+  8004d1:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  8004d4:	8b 06                	mov    (%rsi),%eax
+  8004d6:	8d 50 01             	lea    0x1(%rax),%edx
+  8004d9:	89 16                	mov    %edx,(%rsi)
+  8004db:	48 98                	cltq
+  8004dd:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  8004e2:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  8004e8:	74 0a                	je     8004f4 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  8004ea:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  8004ee:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8004f2:	c9                   	leave
+  8004f3:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  8004f4:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  8004f8:	be ff 00 00 00       	mov    $0xff,%esi
+  8004fd:	48 b8 c1 12 80 00 00 	movabs $0x8012c1,%rax
+  800504:	00 00 00 
+  800507:	ff d0                	call   *%rax
+        state->offset = 0;
+  800509:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  80050f:	eb d9                	jmp    8004ea <putch+0x22>
+
+0000000000800511 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  800511:	55                   	push   %rbp
+  800512:	48 89 e5             	mov    %rsp,%rbp
+  800515:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  80051c:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  80051f:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  800526:	b9 21 00 00 00       	mov    $0x21,%ecx
+  80052b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800530:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  800533:	48 89 f1             	mov    %rsi,%rcx
+  800536:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  80053d:	48 bf c8 04 80 00 00 	movabs $0x8004c8,%rdi
+  800544:	00 00 00 
+  800547:	48 b8 c5 06 80 00 00 	movabs $0x8006c5,%rax
+  80054e:	00 00 00 
+  800551:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  800553:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  80055a:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  800561:	48 b8 c1 12 80 00 00 	movabs $0x8012c1,%rax
+  800568:	00 00 00 
+  80056b:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  80056d:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  800573:	c9                   	leave
+  800574:	c3                   	ret
+
+0000000000800575 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  800575:	55                   	push   %rbp
+  800576:	48 89 e5             	mov    %rsp,%rbp
+  800579:	48 83 ec 50          	sub    $0x50,%rsp
+  80057d:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  800581:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  800585:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800589:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80058d:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  800591:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  800598:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80059c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8005a0:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8005a4:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  8005a8:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  8005ac:	48 b8 11 05 80 00 00 	movabs $0x800511,%rax
+  8005b3:	00 00 00 
+  8005b6:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  8005b8:	c9                   	leave
+  8005b9:	c3                   	ret
+
+00000000008005ba <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  8005ba:	55                   	push   %rbp
+  8005bb:	48 89 e5             	mov    %rsp,%rbp
+  8005be:	41 57                	push   %r15
+  8005c0:	41 56                	push   %r14
+  8005c2:	41 55                	push   %r13
+  8005c4:	41 54                	push   %r12
+  8005c6:	53                   	push   %rbx
+  8005c7:	48 83 ec 18          	sub    $0x18,%rsp
+  8005cb:	49 89 fc             	mov    %rdi,%r12
+  8005ce:	49 89 f5             	mov    %rsi,%r13
+  8005d1:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8005d5:	8b 45 10             	mov    0x10(%rbp),%eax
+  8005d8:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  8005db:	41 89 cf             	mov    %ecx,%r15d
+  8005de:	4c 39 fa             	cmp    %r15,%rdx
+  8005e1:	73 5b                	jae    80063e <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  8005e3:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  8005e7:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  8005eb:	85 db                	test   %ebx,%ebx
+  8005ed:	7e 0e                	jle    8005fd <print_num+0x43>
+            putch(padc, put_arg);
+  8005ef:	4c 89 ee             	mov    %r13,%rsi
+  8005f2:	44 89 f7             	mov    %r14d,%edi
+  8005f5:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  8005f8:	83 eb 01             	sub    $0x1,%ebx
+  8005fb:	75 f2                	jne    8005ef <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  8005fd:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  800601:	48 b9 fc 31 80 00 00 	movabs $0x8031fc,%rcx
+  800608:	00 00 00 
+  80060b:	48 b8 eb 31 80 00 00 	movabs $0x8031eb,%rax
+  800612:	00 00 00 
+  800615:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  800619:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80061d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800622:	49 f7 f7             	div    %r15
+  800625:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  800629:	4c 89 ee             	mov    %r13,%rsi
+  80062c:	41 ff d4             	call   *%r12
+}
+  80062f:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800633:	5b                   	pop    %rbx
+  800634:	41 5c                	pop    %r12
+  800636:	41 5d                	pop    %r13
+  800638:	41 5e                	pop    %r14
+  80063a:	41 5f                	pop    %r15
+  80063c:	5d                   	pop    %rbp
+  80063d:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  80063e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800642:	ba 00 00 00 00       	mov    $0x0,%edx
+  800647:	49 f7 f7             	div    %r15
+  80064a:	48 83 ec 08          	sub    $0x8,%rsp
+  80064e:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  800652:	52                   	push   %rdx
+  800653:	45 0f be c9          	movsbl %r9b,%r9d
+  800657:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  80065b:	48 89 c2             	mov    %rax,%rdx
+  80065e:	48 b8 ba 05 80 00 00 	movabs $0x8005ba,%rax
+  800665:	00 00 00 
+  800668:	ff d0                	call   *%rax
+  80066a:	48 83 c4 10          	add    $0x10,%rsp
+  80066e:	eb 8d                	jmp    8005fd <print_num+0x43>
+
+0000000000800670 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  800670:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  800674:	48 8b 06             	mov    (%rsi),%rax
+  800677:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  80067b:	73 0a                	jae    800687 <sprintputch+0x17>
+        *state->start++ = ch;
+  80067d:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800681:	48 89 16             	mov    %rdx,(%rsi)
+  800684:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  800687:	c3                   	ret
+
+0000000000800688 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  800688:	55                   	push   %rbp
+  800689:	48 89 e5             	mov    %rsp,%rbp
+  80068c:	48 83 ec 50          	sub    $0x50,%rsp
+  800690:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800694:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800698:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  80069c:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8006a3:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8006a7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006ab:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8006af:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  8006b3:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8006b7:	48 b8 c5 06 80 00 00 	movabs $0x8006c5,%rax
+  8006be:	00 00 00 
+  8006c1:	ff d0                	call   *%rax
+}
+  8006c3:	c9                   	leave
+  8006c4:	c3                   	ret
+
+00000000008006c5 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  8006c5:	55                   	push   %rbp
+  8006c6:	48 89 e5             	mov    %rsp,%rbp
+  8006c9:	41 57                	push   %r15
+  8006cb:	41 56                	push   %r14
+  8006cd:	41 55                	push   %r13
+  8006cf:	41 54                	push   %r12
+  8006d1:	53                   	push   %rbx
+  8006d2:	48 83 ec 38          	sub    $0x38,%rsp
+  8006d6:	49 89 fe             	mov    %rdi,%r14
+  8006d9:	49 89 f5             	mov    %rsi,%r13
+  8006dc:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  8006df:	48 8b 01             	mov    (%rcx),%rax
+  8006e2:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8006e6:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  8006ea:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006ee:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  8006f2:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  8006f6:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  8006fa:	0f b6 3b             	movzbl (%rbx),%edi
+  8006fd:	40 80 ff 25          	cmp    $0x25,%dil
+  800701:	74 18                	je     80071b <vprintfmt+0x56>
+            if (!ch) return;
+  800703:	40 84 ff             	test   %dil,%dil
+  800706:	0f 84 b1 06 00 00    	je     800dbd <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  80070c:	40 0f b6 ff          	movzbl %dil,%edi
+  800710:	4c 89 ee             	mov    %r13,%rsi
+  800713:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  800716:	4c 89 e3             	mov    %r12,%rbx
+  800719:	eb db                	jmp    8006f6 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  80071b:	be 00 00 00 00       	mov    $0x0,%esi
+  800720:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  800724:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  800729:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  80072f:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  800736:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  80073a:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  80073f:	41 0f b6 04 24       	movzbl (%r12),%eax
+  800744:	88 45 a0             	mov    %al,-0x60(%rbp)
+  800747:	83 e8 23             	sub    $0x23,%eax
+  80074a:	3c 57                	cmp    $0x57,%al
+  80074c:	0f 87 51 06 00 00    	ja     800da3 <vprintfmt+0x6de>
+  800752:	0f b6 c0             	movzbl %al,%eax
+  800755:	48 b9 c0 33 80 00 00 	movabs $0x8033c0,%rcx
+  80075c:	00 00 00 
+  80075f:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  800762:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  800765:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  800769:	eb cf                	jmp    80073a <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  80076b:	49 89 dc             	mov    %rbx,%r12
+  80076e:	be 01 00 00 00       	mov    $0x1,%esi
+  800773:	eb c5                	jmp    80073a <vprintfmt+0x75>
+            padc = ch;
+  800775:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  800779:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  80077c:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80077f:	eb b9                	jmp    80073a <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800781:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800784:	83 f8 2f             	cmp    $0x2f,%eax
+  800787:	77 24                	ja     8007ad <vprintfmt+0xe8>
+  800789:	89 c1                	mov    %eax,%ecx
+  80078b:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  80078f:	83 c0 08             	add    $0x8,%eax
+  800792:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800795:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  800798:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  80079b:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  80079f:	79 99                	jns    80073a <vprintfmt+0x75>
+                width = precision;
+  8007a1:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  8007a5:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8007ab:	eb 8d                	jmp    80073a <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8007ad:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8007b1:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  8007b5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007b9:	eb da                	jmp    800795 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  8007bb:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  8007c0:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8007c4:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  8007ca:	3c 39                	cmp    $0x39,%al
+  8007cc:	77 1c                	ja     8007ea <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  8007ce:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  8007d2:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  8007d6:	0f b6 c0             	movzbl %al,%eax
+  8007d9:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8007de:	0f b6 03             	movzbl (%rbx),%eax
+  8007e1:	3c 39                	cmp    $0x39,%al
+  8007e3:	76 e9                	jbe    8007ce <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  8007e5:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  8007e8:	eb b1                	jmp    80079b <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  8007ea:	49 89 dc             	mov    %rbx,%r12
+  8007ed:	eb ac                	jmp    80079b <vprintfmt+0xd6>
+            width = MAX(0, width);
+  8007ef:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  8007f2:	85 c9                	test   %ecx,%ecx
+  8007f4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007f9:	0f 49 c1             	cmovns %ecx,%eax
+  8007fc:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  8007ff:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800802:	e9 33 ff ff ff       	jmp    80073a <vprintfmt+0x75>
+            lflag++;
+  800807:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  80080a:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80080d:	e9 28 ff ff ff       	jmp    80073a <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  800812:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800815:	83 f8 2f             	cmp    $0x2f,%eax
+  800818:	77 19                	ja     800833 <vprintfmt+0x16e>
+  80081a:	89 c2                	mov    %eax,%edx
+  80081c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800820:	83 c0 08             	add    $0x8,%eax
+  800823:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800826:	8b 3a                	mov    (%rdx),%edi
+  800828:	4c 89 ee             	mov    %r13,%rsi
+  80082b:	41 ff d6             	call   *%r14
+            break;
+  80082e:	e9 c3 fe ff ff       	jmp    8006f6 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  800833:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800837:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80083b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80083f:	eb e5                	jmp    800826 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  800841:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800844:	83 f8 2f             	cmp    $0x2f,%eax
+  800847:	77 5a                	ja     8008a3 <vprintfmt+0x1de>
+  800849:	89 c2                	mov    %eax,%edx
+  80084b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80084f:	83 c0 08             	add    $0x8,%eax
+  800852:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  800855:	8b 02                	mov    (%rdx),%eax
+  800857:	89 c1                	mov    %eax,%ecx
+  800859:	f7 d9                	neg    %ecx
+  80085b:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  80085e:	83 f9 15             	cmp    $0x15,%ecx
+  800861:	7f 4e                	jg     8008b1 <vprintfmt+0x1ec>
+  800863:	48 63 c1             	movslq %ecx,%rax
+  800866:	48 ba 80 36 80 00 00 	movabs $0x803680,%rdx
+  80086d:	00 00 00 
+  800870:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  800874:	48 85 c0             	test   %rax,%rax
+  800877:	74 38                	je     8008b1 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  800879:	48 89 c1             	mov    %rax,%rcx
+  80087c:	48 ba 79 38 80 00 00 	movabs $0x803879,%rdx
+  800883:	00 00 00 
+  800886:	4c 89 ee             	mov    %r13,%rsi
+  800889:	4c 89 f7             	mov    %r14,%rdi
+  80088c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800891:	49 b8 88 06 80 00 00 	movabs $0x800688,%r8
+  800898:	00 00 00 
+  80089b:	41 ff d0             	call   *%r8
+  80089e:	e9 53 fe ff ff       	jmp    8006f6 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  8008a3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008a7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008ab:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008af:	eb a4                	jmp    800855 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  8008b1:	48 ba 14 32 80 00 00 	movabs $0x803214,%rdx
+  8008b8:	00 00 00 
+  8008bb:	4c 89 ee             	mov    %r13,%rsi
+  8008be:	4c 89 f7             	mov    %r14,%rdi
+  8008c1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008c6:	49 b8 88 06 80 00 00 	movabs $0x800688,%r8
+  8008cd:	00 00 00 
+  8008d0:	41 ff d0             	call   *%r8
+  8008d3:	e9 1e fe ff ff       	jmp    8006f6 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8008d8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008db:	83 f8 2f             	cmp    $0x2f,%eax
+  8008de:	77 6c                	ja     80094c <vprintfmt+0x287>
+  8008e0:	89 c2                	mov    %eax,%edx
+  8008e2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008e6:	83 c0 08             	add    $0x8,%eax
+  8008e9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008ec:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  8008ef:	48 85 d2             	test   %rdx,%rdx
+  8008f2:	48 b8 0d 32 80 00 00 	movabs $0x80320d,%rax
+  8008f9:	00 00 00 
+  8008fc:	48 0f 45 c2          	cmovne %rdx,%rax
+  800900:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  800904:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800908:	7e 06                	jle    800910 <vprintfmt+0x24b>
+  80090a:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  80090e:	75 4a                	jne    80095a <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800910:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800914:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  800918:	0f b6 00             	movzbl (%rax),%eax
+  80091b:	84 c0                	test   %al,%al
+  80091d:	0f 85 9a 00 00 00    	jne    8009bd <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  800923:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800926:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  80092a:	85 c0                	test   %eax,%eax
+  80092c:	0f 8e c4 fd ff ff    	jle    8006f6 <vprintfmt+0x31>
+  800932:	4c 89 ee             	mov    %r13,%rsi
+  800935:	bf 20 00 00 00       	mov    $0x20,%edi
+  80093a:	41 ff d6             	call   *%r14
+  80093d:	41 83 ec 01          	sub    $0x1,%r12d
+  800941:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  800945:	75 eb                	jne    800932 <vprintfmt+0x26d>
+  800947:	e9 aa fd ff ff       	jmp    8006f6 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  80094c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800950:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800954:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800958:	eb 92                	jmp    8008ec <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  80095a:	49 63 f7             	movslq %r15d,%rsi
+  80095d:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  800961:	48 b8 77 0e 80 00 00 	movabs $0x800e77,%rax
+  800968:	00 00 00 
+  80096b:	ff d0                	call   *%rax
+  80096d:	48 89 c2             	mov    %rax,%rdx
+  800970:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800973:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  800975:	8d 70 ff             	lea    -0x1(%rax),%esi
+  800978:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  80097b:	85 c0                	test   %eax,%eax
+  80097d:	7e 91                	jle    800910 <vprintfmt+0x24b>
+  80097f:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  800984:	4c 89 ee             	mov    %r13,%rsi
+  800987:	44 89 e7             	mov    %r12d,%edi
+  80098a:	41 ff d6             	call   *%r14
+  80098d:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800991:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800994:	83 f8 ff             	cmp    $0xffffffff,%eax
+  800997:	75 eb                	jne    800984 <vprintfmt+0x2bf>
+  800999:	e9 72 ff ff ff       	jmp    800910 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  80099e:	0f b6 f8             	movzbl %al,%edi
+  8009a1:	4c 89 ee             	mov    %r13,%rsi
+  8009a4:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8009a7:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8009ab:	49 83 c4 01          	add    $0x1,%r12
+  8009af:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  8009b5:	84 c0                	test   %al,%al
+  8009b7:	0f 84 66 ff ff ff    	je     800923 <vprintfmt+0x25e>
+  8009bd:	45 85 ff             	test   %r15d,%r15d
+  8009c0:	78 0a                	js     8009cc <vprintfmt+0x307>
+  8009c2:	41 83 ef 01          	sub    $0x1,%r15d
+  8009c6:	0f 88 57 ff ff ff    	js     800923 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8009cc:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  8009d0:	74 cc                	je     80099e <vprintfmt+0x2d9>
+  8009d2:	8d 50 e0             	lea    -0x20(%rax),%edx
+  8009d5:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  8009da:	80 fa 5e             	cmp    $0x5e,%dl
+  8009dd:	77 c2                	ja     8009a1 <vprintfmt+0x2dc>
+  8009df:	eb bd                	jmp    80099e <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  8009e1:	40 84 f6             	test   %sil,%sil
+  8009e4:	75 26                	jne    800a0c <vprintfmt+0x347>
+    switch (lflag) {
+  8009e6:	85 d2                	test   %edx,%edx
+  8009e8:	74 59                	je     800a43 <vprintfmt+0x37e>
+  8009ea:	83 fa 01             	cmp    $0x1,%edx
+  8009ed:	74 7b                	je     800a6a <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  8009ef:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009f2:	83 f8 2f             	cmp    $0x2f,%eax
+  8009f5:	0f 87 96 00 00 00    	ja     800a91 <vprintfmt+0x3cc>
+  8009fb:	89 c2                	mov    %eax,%edx
+  8009fd:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a01:	83 c0 08             	add    $0x8,%eax
+  800a04:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a07:	4c 8b 22             	mov    (%rdx),%r12
+  800a0a:	eb 17                	jmp    800a23 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  800a0c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a0f:	83 f8 2f             	cmp    $0x2f,%eax
+  800a12:	77 21                	ja     800a35 <vprintfmt+0x370>
+  800a14:	89 c2                	mov    %eax,%edx
+  800a16:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a1a:	83 c0 08             	add    $0x8,%eax
+  800a1d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a20:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  800a23:	4d 85 e4             	test   %r12,%r12
+  800a26:	78 7a                	js     800aa2 <vprintfmt+0x3dd>
+            num = i;
+  800a28:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  800a2b:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  800a30:	e9 50 02 00 00       	jmp    800c85 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800a35:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a39:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a3d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a41:	eb dd                	jmp    800a20 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  800a43:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a46:	83 f8 2f             	cmp    $0x2f,%eax
+  800a49:	77 11                	ja     800a5c <vprintfmt+0x397>
+  800a4b:	89 c2                	mov    %eax,%edx
+  800a4d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a51:	83 c0 08             	add    $0x8,%eax
+  800a54:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a57:	4c 63 22             	movslq (%rdx),%r12
+  800a5a:	eb c7                	jmp    800a23 <vprintfmt+0x35e>
+  800a5c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a60:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a64:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a68:	eb ed                	jmp    800a57 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  800a6a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a6d:	83 f8 2f             	cmp    $0x2f,%eax
+  800a70:	77 11                	ja     800a83 <vprintfmt+0x3be>
+  800a72:	89 c2                	mov    %eax,%edx
+  800a74:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a78:	83 c0 08             	add    $0x8,%eax
+  800a7b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a7e:	4c 8b 22             	mov    (%rdx),%r12
+  800a81:	eb a0                	jmp    800a23 <vprintfmt+0x35e>
+  800a83:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a87:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a8b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a8f:	eb ed                	jmp    800a7e <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  800a91:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a95:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a99:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a9d:	e9 65 ff ff ff       	jmp    800a07 <vprintfmt+0x342>
+                putch('-', put_arg);
+  800aa2:	4c 89 ee             	mov    %r13,%rsi
+  800aa5:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800aaa:	41 ff d6             	call   *%r14
+                i = -i;
+  800aad:	49 f7 dc             	neg    %r12
+  800ab0:	e9 73 ff ff ff       	jmp    800a28 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  800ab5:	40 84 f6             	test   %sil,%sil
+  800ab8:	75 32                	jne    800aec <vprintfmt+0x427>
+    switch (lflag) {
+  800aba:	85 d2                	test   %edx,%edx
+  800abc:	74 5d                	je     800b1b <vprintfmt+0x456>
+  800abe:	83 fa 01             	cmp    $0x1,%edx
+  800ac1:	0f 84 82 00 00 00    	je     800b49 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  800ac7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800aca:	83 f8 2f             	cmp    $0x2f,%eax
+  800acd:	0f 87 a5 00 00 00    	ja     800b78 <vprintfmt+0x4b3>
+  800ad3:	89 c2                	mov    %eax,%edx
+  800ad5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ad9:	83 c0 08             	add    $0x8,%eax
+  800adc:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800adf:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800ae2:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  800ae7:	e9 99 01 00 00       	jmp    800c85 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800aec:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800aef:	83 f8 2f             	cmp    $0x2f,%eax
+  800af2:	77 19                	ja     800b0d <vprintfmt+0x448>
+  800af4:	89 c2                	mov    %eax,%edx
+  800af6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800afa:	83 c0 08             	add    $0x8,%eax
+  800afd:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b00:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800b03:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800b08:	e9 78 01 00 00       	jmp    800c85 <vprintfmt+0x5c0>
+  800b0d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b11:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b15:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b19:	eb e5                	jmp    800b00 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  800b1b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b1e:	83 f8 2f             	cmp    $0x2f,%eax
+  800b21:	77 18                	ja     800b3b <vprintfmt+0x476>
+  800b23:	89 c2                	mov    %eax,%edx
+  800b25:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b29:	83 c0 08             	add    $0x8,%eax
+  800b2c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b2f:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800b31:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  800b36:	e9 4a 01 00 00       	jmp    800c85 <vprintfmt+0x5c0>
+  800b3b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b3f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b43:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b47:	eb e6                	jmp    800b2f <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  800b49:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b4c:	83 f8 2f             	cmp    $0x2f,%eax
+  800b4f:	77 19                	ja     800b6a <vprintfmt+0x4a5>
+  800b51:	89 c2                	mov    %eax,%edx
+  800b53:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b57:	83 c0 08             	add    $0x8,%eax
+  800b5a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b5d:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800b60:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  800b65:	e9 1b 01 00 00       	jmp    800c85 <vprintfmt+0x5c0>
+  800b6a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b6e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b72:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b76:	eb e5                	jmp    800b5d <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  800b78:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b7c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b80:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b84:	e9 56 ff ff ff       	jmp    800adf <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  800b89:	40 84 f6             	test   %sil,%sil
+  800b8c:	75 2e                	jne    800bbc <vprintfmt+0x4f7>
+    switch (lflag) {
+  800b8e:	85 d2                	test   %edx,%edx
+  800b90:	74 59                	je     800beb <vprintfmt+0x526>
+  800b92:	83 fa 01             	cmp    $0x1,%edx
+  800b95:	74 7f                	je     800c16 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  800b97:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b9a:	83 f8 2f             	cmp    $0x2f,%eax
+  800b9d:	0f 87 9f 00 00 00    	ja     800c42 <vprintfmt+0x57d>
+  800ba3:	89 c2                	mov    %eax,%edx
+  800ba5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ba9:	83 c0 08             	add    $0x8,%eax
+  800bac:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800baf:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800bb2:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  800bb7:	e9 c9 00 00 00       	jmp    800c85 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800bbc:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bbf:	83 f8 2f             	cmp    $0x2f,%eax
+  800bc2:	77 19                	ja     800bdd <vprintfmt+0x518>
+  800bc4:	89 c2                	mov    %eax,%edx
+  800bc6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800bca:	83 c0 08             	add    $0x8,%eax
+  800bcd:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800bd0:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800bd3:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800bd8:	e9 a8 00 00 00       	jmp    800c85 <vprintfmt+0x5c0>
+  800bdd:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800be1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800be5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800be9:	eb e5                	jmp    800bd0 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  800beb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bee:	83 f8 2f             	cmp    $0x2f,%eax
+  800bf1:	77 15                	ja     800c08 <vprintfmt+0x543>
+  800bf3:	89 c2                	mov    %eax,%edx
+  800bf5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800bf9:	83 c0 08             	add    $0x8,%eax
+  800bfc:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800bff:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  800c01:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  800c06:	eb 7d                	jmp    800c85 <vprintfmt+0x5c0>
+  800c08:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c0c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c10:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c14:	eb e9                	jmp    800bff <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  800c16:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c19:	83 f8 2f             	cmp    $0x2f,%eax
+  800c1c:	77 16                	ja     800c34 <vprintfmt+0x56f>
+  800c1e:	89 c2                	mov    %eax,%edx
+  800c20:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c24:	83 c0 08             	add    $0x8,%eax
+  800c27:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c2a:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800c2d:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  800c32:	eb 51                	jmp    800c85 <vprintfmt+0x5c0>
+  800c34:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c38:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c3c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c40:	eb e8                	jmp    800c2a <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  800c42:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c46:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c4a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c4e:	e9 5c ff ff ff       	jmp    800baf <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  800c53:	4c 89 ee             	mov    %r13,%rsi
+  800c56:	bf 30 00 00 00       	mov    $0x30,%edi
+  800c5b:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800c5e:	4c 89 ee             	mov    %r13,%rsi
+  800c61:	bf 78 00 00 00       	mov    $0x78,%edi
+  800c66:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800c69:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c6c:	83 f8 2f             	cmp    $0x2f,%eax
+  800c6f:	77 47                	ja     800cb8 <vprintfmt+0x5f3>
+  800c71:	89 c2                	mov    %eax,%edx
+  800c73:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c77:	83 c0 08             	add    $0x8,%eax
+  800c7a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c7d:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800c80:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800c85:	48 83 ec 08          	sub    $0x8,%rsp
+  800c89:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800c8d:	0f 94 c0             	sete   %al
+  800c90:	0f b6 c0             	movzbl %al,%eax
+  800c93:	50                   	push   %rax
+  800c94:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800c99:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800c9d:	4c 89 ee             	mov    %r13,%rsi
+  800ca0:	4c 89 f7             	mov    %r14,%rdi
+  800ca3:	48 b8 ba 05 80 00 00 	movabs $0x8005ba,%rax
+  800caa:	00 00 00 
+  800cad:	ff d0                	call   *%rax
+            break;
+  800caf:	48 83 c4 10          	add    $0x10,%rsp
+  800cb3:	e9 3e fa ff ff       	jmp    8006f6 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800cb8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800cbc:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800cc0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800cc4:	eb b7                	jmp    800c7d <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  800cc6:	40 84 f6             	test   %sil,%sil
+  800cc9:	75 2b                	jne    800cf6 <vprintfmt+0x631>
+    switch (lflag) {
+  800ccb:	85 d2                	test   %edx,%edx
+  800ccd:	74 56                	je     800d25 <vprintfmt+0x660>
+  800ccf:	83 fa 01             	cmp    $0x1,%edx
+  800cd2:	74 7f                	je     800d53 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800cd4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800cd7:	83 f8 2f             	cmp    $0x2f,%eax
+  800cda:	0f 87 a2 00 00 00    	ja     800d82 <vprintfmt+0x6bd>
+  800ce0:	89 c2                	mov    %eax,%edx
+  800ce2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ce6:	83 c0 08             	add    $0x8,%eax
+  800ce9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800cec:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800cef:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800cf4:	eb 8f                	jmp    800c85 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800cf6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800cf9:	83 f8 2f             	cmp    $0x2f,%eax
+  800cfc:	77 19                	ja     800d17 <vprintfmt+0x652>
+  800cfe:	89 c2                	mov    %eax,%edx
+  800d00:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d04:	83 c0 08             	add    $0x8,%eax
+  800d07:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d0a:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800d0d:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800d12:	e9 6e ff ff ff       	jmp    800c85 <vprintfmt+0x5c0>
+  800d17:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d1b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d1f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d23:	eb e5                	jmp    800d0a <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800d25:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d28:	83 f8 2f             	cmp    $0x2f,%eax
+  800d2b:	77 18                	ja     800d45 <vprintfmt+0x680>
+  800d2d:	89 c2                	mov    %eax,%edx
+  800d2f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d33:	83 c0 08             	add    $0x8,%eax
+  800d36:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d39:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800d3b:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800d40:	e9 40 ff ff ff       	jmp    800c85 <vprintfmt+0x5c0>
+  800d45:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d49:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d4d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d51:	eb e6                	jmp    800d39 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800d53:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d56:	83 f8 2f             	cmp    $0x2f,%eax
+  800d59:	77 19                	ja     800d74 <vprintfmt+0x6af>
+  800d5b:	89 c2                	mov    %eax,%edx
+  800d5d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d61:	83 c0 08             	add    $0x8,%eax
+  800d64:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d67:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800d6a:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800d6f:	e9 11 ff ff ff       	jmp    800c85 <vprintfmt+0x5c0>
+  800d74:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d78:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d7c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d80:	eb e5                	jmp    800d67 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800d82:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d86:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d8a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d8e:	e9 59 ff ff ff       	jmp    800cec <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800d93:	4c 89 ee             	mov    %r13,%rsi
+  800d96:	bf 25 00 00 00       	mov    $0x25,%edi
+  800d9b:	41 ff d6             	call   *%r14
+            break;
+  800d9e:	e9 53 f9 ff ff       	jmp    8006f6 <vprintfmt+0x31>
+            putch('%', put_arg);
+  800da3:	4c 89 ee             	mov    %r13,%rsi
+  800da6:	bf 25 00 00 00       	mov    $0x25,%edi
+  800dab:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800dae:	48 83 eb 01          	sub    $0x1,%rbx
+  800db2:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800db6:	75 f6                	jne    800dae <vprintfmt+0x6e9>
+  800db8:	e9 39 f9 ff ff       	jmp    8006f6 <vprintfmt+0x31>
+}
+  800dbd:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800dc1:	5b                   	pop    %rbx
+  800dc2:	41 5c                	pop    %r12
+  800dc4:	41 5d                	pop    %r13
+  800dc6:	41 5e                	pop    %r14
+  800dc8:	41 5f                	pop    %r15
+  800dca:	5d                   	pop    %rbp
+  800dcb:	c3                   	ret
+
+0000000000800dcc <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800dcc:	55                   	push   %rbp
+  800dcd:	48 89 e5             	mov    %rsp,%rbp
+  800dd0:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800dd4:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800dd8:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800ddd:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800de1:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800de8:	48 85 ff             	test   %rdi,%rdi
+  800deb:	74 2b                	je     800e18 <vsnprintf+0x4c>
+  800ded:	48 85 f6             	test   %rsi,%rsi
+  800df0:	74 26                	je     800e18 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800df2:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800df6:	48 bf 70 06 80 00 00 	movabs $0x800670,%rdi
+  800dfd:	00 00 00 
+  800e00:	48 b8 c5 06 80 00 00 	movabs $0x8006c5,%rax
+  800e07:	00 00 00 
+  800e0a:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800e0c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800e10:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800e13:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800e16:	c9                   	leave
+  800e17:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800e18:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800e1d:	eb f7                	jmp    800e16 <vsnprintf+0x4a>
+
+0000000000800e1f <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800e1f:	55                   	push   %rbp
+  800e20:	48 89 e5             	mov    %rsp,%rbp
+  800e23:	48 83 ec 50          	sub    $0x50,%rsp
+  800e27:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800e2b:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800e2f:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800e33:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800e3a:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800e3e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e42:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800e46:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800e4a:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800e4e:	48 b8 cc 0d 80 00 00 	movabs $0x800dcc,%rax
+  800e55:	00 00 00 
+  800e58:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800e5a:	c9                   	leave
+  800e5b:	c3                   	ret
+
+0000000000800e5c <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800e5c:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800e5f:	74 10                	je     800e71 <strlen+0x15>
+    size_t n = 0;
+  800e61:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800e66:	48 83 c0 01          	add    $0x1,%rax
+  800e6a:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800e6e:	75 f6                	jne    800e66 <strlen+0xa>
+  800e70:	c3                   	ret
+    size_t n = 0;
+  800e71:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800e76:	c3                   	ret
+
+0000000000800e77 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800e77:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800e7a:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800e7f:	48 85 f6             	test   %rsi,%rsi
+  800e82:	74 11                	je     800e95 <strnlen+0x1e>
+  800e84:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800e88:	74 0c                	je     800e96 <strnlen+0x1f>
+  800e8a:	48 83 c2 01          	add    $0x1,%rdx
+  800e8e:	48 39 d0             	cmp    %rdx,%rax
+  800e91:	75 f1                	jne    800e84 <strnlen+0xd>
+  800e93:	eb 04                	jmp    800e99 <strnlen+0x22>
+  800e95:	c3                   	ret
+  800e96:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800e99:	c3                   	ret
+
+0000000000800e9a <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800e9a:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800e9d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ea2:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800ea6:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800ea9:	48 83 c2 01          	add    $0x1,%rdx
+  800ead:	84 c9                	test   %cl,%cl
+  800eaf:	75 f1                	jne    800ea2 <strcpy+0x8>
+        ;
+    return res;
+}
+  800eb1:	c3                   	ret
+
+0000000000800eb2 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800eb2:	55                   	push   %rbp
+  800eb3:	48 89 e5             	mov    %rsp,%rbp
+  800eb6:	41 54                	push   %r12
+  800eb8:	53                   	push   %rbx
+  800eb9:	48 89 fb             	mov    %rdi,%rbx
+  800ebc:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800ebf:	48 b8 5c 0e 80 00 00 	movabs $0x800e5c,%rax
+  800ec6:	00 00 00 
+  800ec9:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800ecb:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800ecf:	4c 89 e6             	mov    %r12,%rsi
+  800ed2:	48 b8 9a 0e 80 00 00 	movabs $0x800e9a,%rax
+  800ed9:	00 00 00 
+  800edc:	ff d0                	call   *%rax
+    return dst;
+}
+  800ede:	48 89 d8             	mov    %rbx,%rax
+  800ee1:	5b                   	pop    %rbx
+  800ee2:	41 5c                	pop    %r12
+  800ee4:	5d                   	pop    %rbp
+  800ee5:	c3                   	ret
+
+0000000000800ee6 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800ee6:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800ee9:	48 85 d2             	test   %rdx,%rdx
+  800eec:	74 1f                	je     800f0d <strncpy+0x27>
+  800eee:	48 01 fa             	add    %rdi,%rdx
+  800ef1:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800ef4:	48 83 c1 01          	add    $0x1,%rcx
+  800ef8:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800efc:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800f00:	41 80 f8 01          	cmp    $0x1,%r8b
+  800f04:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800f08:	48 39 ca             	cmp    %rcx,%rdx
+  800f0b:	75 e7                	jne    800ef4 <strncpy+0xe>
+    }
+    return ret;
+}
+  800f0d:	c3                   	ret
+
+0000000000800f0e <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800f0e:	48 89 f8             	mov    %rdi,%rax
+  800f11:	48 85 d2             	test   %rdx,%rdx
+  800f14:	74 24                	je     800f3a <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800f16:	48 83 ea 01          	sub    $0x1,%rdx
+  800f1a:	74 1b                	je     800f37 <strlcpy+0x29>
+  800f1c:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800f20:	0f b6 16             	movzbl (%rsi),%edx
+  800f23:	84 d2                	test   %dl,%dl
+  800f25:	74 10                	je     800f37 <strlcpy+0x29>
+            *dst++ = *src++;
+  800f27:	48 83 c6 01          	add    $0x1,%rsi
+  800f2b:	48 83 c0 01          	add    $0x1,%rax
+  800f2f:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800f32:	48 39 c8             	cmp    %rcx,%rax
+  800f35:	75 e9                	jne    800f20 <strlcpy+0x12>
+        *dst = '\0';
+  800f37:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800f3a:	48 29 f8             	sub    %rdi,%rax
+}
+  800f3d:	c3                   	ret
+
+0000000000800f3e <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800f3e:	0f b6 07             	movzbl (%rdi),%eax
+  800f41:	84 c0                	test   %al,%al
+  800f43:	74 13                	je     800f58 <strcmp+0x1a>
+  800f45:	38 06                	cmp    %al,(%rsi)
+  800f47:	75 0f                	jne    800f58 <strcmp+0x1a>
+  800f49:	48 83 c7 01          	add    $0x1,%rdi
+  800f4d:	48 83 c6 01          	add    $0x1,%rsi
+  800f51:	0f b6 07             	movzbl (%rdi),%eax
+  800f54:	84 c0                	test   %al,%al
+  800f56:	75 ed                	jne    800f45 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800f58:	0f b6 c0             	movzbl %al,%eax
+  800f5b:	0f b6 16             	movzbl (%rsi),%edx
+  800f5e:	29 d0                	sub    %edx,%eax
+}
+  800f60:	c3                   	ret
+
+0000000000800f61 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800f61:	48 85 d2             	test   %rdx,%rdx
+  800f64:	74 1f                	je     800f85 <strncmp+0x24>
+  800f66:	0f b6 07             	movzbl (%rdi),%eax
+  800f69:	84 c0                	test   %al,%al
+  800f6b:	74 1e                	je     800f8b <strncmp+0x2a>
+  800f6d:	3a 06                	cmp    (%rsi),%al
+  800f6f:	75 1a                	jne    800f8b <strncmp+0x2a>
+  800f71:	48 83 c7 01          	add    $0x1,%rdi
+  800f75:	48 83 c6 01          	add    $0x1,%rsi
+  800f79:	48 83 ea 01          	sub    $0x1,%rdx
+  800f7d:	75 e7                	jne    800f66 <strncmp+0x5>
+
+    if (!n) return 0;
+  800f7f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f84:	c3                   	ret
+  800f85:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f8a:	c3                   	ret
+  800f8b:	48 85 d2             	test   %rdx,%rdx
+  800f8e:	74 09                	je     800f99 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800f90:	0f b6 07             	movzbl (%rdi),%eax
+  800f93:	0f b6 16             	movzbl (%rsi),%edx
+  800f96:	29 d0                	sub    %edx,%eax
+  800f98:	c3                   	ret
+    if (!n) return 0;
+  800f99:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800f9e:	c3                   	ret
+
+0000000000800f9f <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800f9f:	0f b6 17             	movzbl (%rdi),%edx
+  800fa2:	84 d2                	test   %dl,%dl
+  800fa4:	74 18                	je     800fbe <strchr+0x1f>
+        if (*str == c) {
+  800fa6:	0f be d2             	movsbl %dl,%edx
+  800fa9:	39 f2                	cmp    %esi,%edx
+  800fab:	74 17                	je     800fc4 <strchr+0x25>
+    for (; *str; str++) {
+  800fad:	48 83 c7 01          	add    $0x1,%rdi
+  800fb1:	0f b6 17             	movzbl (%rdi),%edx
+  800fb4:	84 d2                	test   %dl,%dl
+  800fb6:	75 ee                	jne    800fa6 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800fb8:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fbd:	c3                   	ret
+  800fbe:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fc3:	c3                   	ret
+  800fc4:	48 89 f8             	mov    %rdi,%rax
+}
+  800fc7:	c3                   	ret
+
+0000000000800fc8 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800fc8:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800fcb:	0f b6 17             	movzbl (%rdi),%edx
+  800fce:	84 d2                	test   %dl,%dl
+  800fd0:	74 13                	je     800fe5 <strfind+0x1d>
+  800fd2:	0f be d2             	movsbl %dl,%edx
+  800fd5:	39 f2                	cmp    %esi,%edx
+  800fd7:	74 0b                	je     800fe4 <strfind+0x1c>
+  800fd9:	48 83 c0 01          	add    $0x1,%rax
+  800fdd:	0f b6 10             	movzbl (%rax),%edx
+  800fe0:	84 d2                	test   %dl,%dl
+  800fe2:	75 ee                	jne    800fd2 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800fe4:	c3                   	ret
+  800fe5:	c3                   	ret
+
+0000000000800fe6 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800fe6:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800fe9:	48 89 f8             	mov    %rdi,%rax
+  800fec:	48 f7 d8             	neg    %rax
+  800fef:	83 e0 07             	and    $0x7,%eax
+  800ff2:	49 89 d1             	mov    %rdx,%r9
+  800ff5:	49 29 c1             	sub    %rax,%r9
+  800ff8:	78 36                	js     801030 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800ffa:	40 0f b6 c6          	movzbl %sil,%eax
+  800ffe:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  801005:	01 01 01 
+  801008:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  80100c:	40 f6 c7 07          	test   $0x7,%dil
+  801010:	75 38                	jne    80104a <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  801012:	4c 89 c9             	mov    %r9,%rcx
+  801015:	48 c1 f9 03          	sar    $0x3,%rcx
+  801019:	74 0c                	je     801027 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  80101b:	fc                   	cld
+  80101c:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  80101f:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  801023:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  801027:	4d 85 c9             	test   %r9,%r9
+  80102a:	75 45                	jne    801071 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  80102c:	4c 89 c0             	mov    %r8,%rax
+  80102f:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  801030:	48 85 d2             	test   %rdx,%rdx
+  801033:	74 f7                	je     80102c <memset+0x46>
+  801035:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  801038:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  80103b:	48 83 c0 01          	add    $0x1,%rax
+  80103f:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  801043:	48 39 c2             	cmp    %rax,%rdx
+  801046:	75 f3                	jne    80103b <memset+0x55>
+  801048:	eb e2                	jmp    80102c <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  80104a:	40 f6 c7 01          	test   $0x1,%dil
+  80104e:	74 06                	je     801056 <memset+0x70>
+  801050:	88 07                	mov    %al,(%rdi)
+  801052:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  801056:	40 f6 c7 02          	test   $0x2,%dil
+  80105a:	74 07                	je     801063 <memset+0x7d>
+  80105c:	66 89 07             	mov    %ax,(%rdi)
+  80105f:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  801063:	40 f6 c7 04          	test   $0x4,%dil
+  801067:	74 a9                	je     801012 <memset+0x2c>
+  801069:	89 07                	mov    %eax,(%rdi)
+  80106b:	48 83 c7 04          	add    $0x4,%rdi
+  80106f:	eb a1                	jmp    801012 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  801071:	41 f6 c1 04          	test   $0x4,%r9b
+  801075:	74 06                	je     80107d <memset+0x97>
+  801077:	89 07                	mov    %eax,(%rdi)
+  801079:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  80107d:	41 f6 c1 02          	test   $0x2,%r9b
+  801081:	74 07                	je     80108a <memset+0xa4>
+  801083:	66 89 07             	mov    %ax,(%rdi)
+  801086:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  80108a:	41 f6 c1 01          	test   $0x1,%r9b
+  80108e:	74 9c                	je     80102c <memset+0x46>
+  801090:	88 07                	mov    %al,(%rdi)
+  801092:	eb 98                	jmp    80102c <memset+0x46>
+
+0000000000801094 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  801094:	48 89 f8             	mov    %rdi,%rax
+  801097:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  80109a:	48 39 fe             	cmp    %rdi,%rsi
+  80109d:	73 3b                	jae    8010da <memmove+0x46>
+  80109f:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  8010a3:	48 39 d7             	cmp    %rdx,%rdi
+  8010a6:	73 32                	jae    8010da <memmove+0x46>
+        s += n;
+        d += n;
+  8010a8:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  8010ac:	48 89 d6             	mov    %rdx,%rsi
+  8010af:	48 09 fe             	or     %rdi,%rsi
+  8010b2:	48 09 ce             	or     %rcx,%rsi
+  8010b5:	40 f6 c6 07          	test   $0x7,%sil
+  8010b9:	75 12                	jne    8010cd <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  8010bb:	48 83 ef 08          	sub    $0x8,%rdi
+  8010bf:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  8010c3:	48 c1 e9 03          	shr    $0x3,%rcx
+  8010c7:	fd                   	std
+  8010c8:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  8010cb:	fc                   	cld
+  8010cc:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  8010cd:	48 83 ef 01          	sub    $0x1,%rdi
+  8010d1:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  8010d5:	fd                   	std
+  8010d6:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  8010d8:	eb f1                	jmp    8010cb <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  8010da:	48 89 f2             	mov    %rsi,%rdx
+  8010dd:	48 09 c2             	or     %rax,%rdx
+  8010e0:	48 09 ca             	or     %rcx,%rdx
+  8010e3:	f6 c2 07             	test   $0x7,%dl
+  8010e6:	75 0c                	jne    8010f4 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  8010e8:	48 c1 e9 03          	shr    $0x3,%rcx
+  8010ec:	48 89 c7             	mov    %rax,%rdi
+  8010ef:	fc                   	cld
+  8010f0:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  8010f3:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  8010f4:	48 89 c7             	mov    %rax,%rdi
+  8010f7:	fc                   	cld
+  8010f8:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  8010fa:	c3                   	ret
+
+00000000008010fb <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  8010fb:	55                   	push   %rbp
+  8010fc:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  8010ff:	48 b8 94 10 80 00 00 	movabs $0x801094,%rax
+  801106:	00 00 00 
+  801109:	ff d0                	call   *%rax
+}
+  80110b:	5d                   	pop    %rbp
+  80110c:	c3                   	ret
+
+000000000080110d <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  80110d:	55                   	push   %rbp
+  80110e:	48 89 e5             	mov    %rsp,%rbp
+  801111:	41 57                	push   %r15
+  801113:	41 56                	push   %r14
+  801115:	41 55                	push   %r13
+  801117:	41 54                	push   %r12
+  801119:	53                   	push   %rbx
+  80111a:	48 83 ec 08          	sub    $0x8,%rsp
+  80111e:	49 89 fe             	mov    %rdi,%r14
+  801121:	49 89 f7             	mov    %rsi,%r15
+  801124:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  801127:	48 89 f7             	mov    %rsi,%rdi
+  80112a:	48 b8 5c 0e 80 00 00 	movabs $0x800e5c,%rax
+  801131:	00 00 00 
+  801134:	ff d0                	call   *%rax
+  801136:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  801139:	48 89 de             	mov    %rbx,%rsi
+  80113c:	4c 89 f7             	mov    %r14,%rdi
+  80113f:	48 b8 77 0e 80 00 00 	movabs $0x800e77,%rax
+  801146:	00 00 00 
+  801149:	ff d0                	call   *%rax
+  80114b:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  80114e:	48 39 c3             	cmp    %rax,%rbx
+  801151:	74 36                	je     801189 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  801153:	48 89 d8             	mov    %rbx,%rax
+  801156:	4c 29 e8             	sub    %r13,%rax
+  801159:	49 39 c4             	cmp    %rax,%r12
+  80115c:	73 31                	jae    80118f <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  80115e:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  801163:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  801167:	4c 89 fe             	mov    %r15,%rsi
+  80116a:	48 b8 fb 10 80 00 00 	movabs $0x8010fb,%rax
+  801171:	00 00 00 
+  801174:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  801176:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  80117a:	48 83 c4 08          	add    $0x8,%rsp
+  80117e:	5b                   	pop    %rbx
+  80117f:	41 5c                	pop    %r12
+  801181:	41 5d                	pop    %r13
+  801183:	41 5e                	pop    %r14
+  801185:	41 5f                	pop    %r15
+  801187:	5d                   	pop    %rbp
+  801188:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  801189:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  80118d:	eb eb                	jmp    80117a <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  80118f:	48 83 eb 01          	sub    $0x1,%rbx
+  801193:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  801197:	48 89 da             	mov    %rbx,%rdx
+  80119a:	4c 89 fe             	mov    %r15,%rsi
+  80119d:	48 b8 fb 10 80 00 00 	movabs $0x8010fb,%rax
+  8011a4:	00 00 00 
+  8011a7:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  8011a9:	49 01 de             	add    %rbx,%r14
+  8011ac:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  8011b1:	eb c3                	jmp    801176 <strlcat+0x69>
+
+00000000008011b3 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  8011b3:	48 85 d2             	test   %rdx,%rdx
+  8011b6:	74 2d                	je     8011e5 <memcmp+0x32>
+  8011b8:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  8011bd:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  8011c1:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  8011c6:	44 38 c1             	cmp    %r8b,%cl
+  8011c9:	75 0f                	jne    8011da <memcmp+0x27>
+    while (n-- > 0) {
+  8011cb:	48 83 c0 01          	add    $0x1,%rax
+  8011cf:	48 39 c2             	cmp    %rax,%rdx
+  8011d2:	75 e9                	jne    8011bd <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  8011d4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011d9:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  8011da:	0f b6 c1             	movzbl %cl,%eax
+  8011dd:	45 0f b6 c0          	movzbl %r8b,%r8d
+  8011e1:	44 29 c0             	sub    %r8d,%eax
+  8011e4:	c3                   	ret
+    return 0;
+  8011e5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8011ea:	c3                   	ret
+
+00000000008011eb <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  8011eb:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  8011ef:	48 39 c7             	cmp    %rax,%rdi
+  8011f2:	73 0f                	jae    801203 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  8011f4:	40 38 37             	cmp    %sil,(%rdi)
+  8011f7:	74 0e                	je     801207 <memfind+0x1c>
+    for (; src < end; src++) {
+  8011f9:	48 83 c7 01          	add    $0x1,%rdi
+  8011fd:	48 39 f8             	cmp    %rdi,%rax
+  801200:	75 f2                	jne    8011f4 <memfind+0x9>
+  801202:	c3                   	ret
+  801203:	48 89 f8             	mov    %rdi,%rax
+  801206:	c3                   	ret
+  801207:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  80120a:	c3                   	ret
+
+000000000080120b <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  80120b:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  80120e:	0f b6 37             	movzbl (%rdi),%esi
+  801211:	40 80 fe 20          	cmp    $0x20,%sil
+  801215:	74 06                	je     80121d <strtol+0x12>
+  801217:	40 80 fe 09          	cmp    $0x9,%sil
+  80121b:	75 13                	jne    801230 <strtol+0x25>
+  80121d:	48 83 c7 01          	add    $0x1,%rdi
+  801221:	0f b6 37             	movzbl (%rdi),%esi
+  801224:	40 80 fe 20          	cmp    $0x20,%sil
+  801228:	74 f3                	je     80121d <strtol+0x12>
+  80122a:	40 80 fe 09          	cmp    $0x9,%sil
+  80122e:	74 ed                	je     80121d <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  801230:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  801233:	83 e0 fd             	and    $0xfffffffd,%eax
+  801236:	3c 01                	cmp    $0x1,%al
+  801238:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  80123c:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  801242:	75 0f                	jne    801253 <strtol+0x48>
+  801244:	80 3f 30             	cmpb   $0x30,(%rdi)
+  801247:	74 14                	je     80125d <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  801249:	85 d2                	test   %edx,%edx
+  80124b:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801250:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  801253:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  801258:	4c 63 ca             	movslq %edx,%r9
+  80125b:	eb 36                	jmp    801293 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  80125d:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  801261:	74 0f                	je     801272 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  801263:	85 d2                	test   %edx,%edx
+  801265:	75 ec                	jne    801253 <strtol+0x48>
+        s++;
+  801267:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  80126b:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  801270:	eb e1                	jmp    801253 <strtol+0x48>
+        s += 2;
+  801272:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  801276:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  80127b:	eb d6                	jmp    801253 <strtol+0x48>
+            dig -= '0';
+  80127d:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  801280:	44 0f b6 c1          	movzbl %cl,%r8d
+  801284:	41 39 d0             	cmp    %edx,%r8d
+  801287:	7d 21                	jge    8012aa <strtol+0x9f>
+        val = val * base + dig;
+  801289:	49 0f af c1          	imul   %r9,%rax
+  80128d:	0f b6 c9             	movzbl %cl,%ecx
+  801290:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  801293:	48 83 c7 01          	add    $0x1,%rdi
+  801297:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  80129b:	80 f9 39             	cmp    $0x39,%cl
+  80129e:	76 dd                	jbe    80127d <strtol+0x72>
+        else if (dig - 'a' < 27)
+  8012a0:	80 f9 7b             	cmp    $0x7b,%cl
+  8012a3:	77 05                	ja     8012aa <strtol+0x9f>
+            dig -= 'a' - 10;
+  8012a5:	83 e9 57             	sub    $0x57,%ecx
+  8012a8:	eb d6                	jmp    801280 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  8012aa:	4d 85 d2             	test   %r10,%r10
+  8012ad:	74 03                	je     8012b2 <strtol+0xa7>
+  8012af:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  8012b2:	48 89 c2             	mov    %rax,%rdx
+  8012b5:	48 f7 da             	neg    %rdx
+  8012b8:	40 80 fe 2d          	cmp    $0x2d,%sil
+  8012bc:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  8012c0:	c3                   	ret
+
+00000000008012c1 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  8012c1:	55                   	push   %rbp
+  8012c2:	48 89 e5             	mov    %rsp,%rbp
+  8012c5:	53                   	push   %rbx
+  8012c6:	48 89 fa             	mov    %rdi,%rdx
+  8012c9:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8012cc:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8012d1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012d6:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012db:	be 00 00 00 00       	mov    $0x0,%esi
+  8012e0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8012e6:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  8012e8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012ec:	c9                   	leave
+  8012ed:	c3                   	ret
+
+00000000008012ee <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  8012ee:	55                   	push   %rbp
+  8012ef:	48 89 e5             	mov    %rsp,%rbp
+  8012f2:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8012f3:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8012f8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012fd:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801302:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801307:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80130c:	be 00 00 00 00       	mov    $0x0,%esi
+  801311:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801317:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  801319:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80131d:	c9                   	leave
+  80131e:	c3                   	ret
+
+000000000080131f <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  80131f:	55                   	push   %rbp
+  801320:	48 89 e5             	mov    %rsp,%rbp
+  801323:	53                   	push   %rbx
+  801324:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  801328:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80132b:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801330:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801335:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80133a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80133f:	be 00 00 00 00       	mov    $0x0,%esi
+  801344:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80134a:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80134c:	48 85 c0             	test   %rax,%rax
+  80134f:	7f 06                	jg     801357 <sys_env_destroy+0x38>
+}
+  801351:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801355:	c9                   	leave
+  801356:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801357:	49 89 c0             	mov    %rax,%r8
+  80135a:	b9 03 00 00 00       	mov    $0x3,%ecx
+  80135f:	48 ba 50 37 80 00 00 	movabs $0x803750,%rdx
+  801366:	00 00 00 
+  801369:	be 26 00 00 00       	mov    $0x26,%esi
+  80136e:	48 bf 6f 37 80 00 00 	movabs $0x80376f,%rdi
+  801375:	00 00 00 
+  801378:	b8 00 00 00 00       	mov    $0x0,%eax
+  80137d:	49 b9 25 04 80 00 00 	movabs $0x800425,%r9
+  801384:	00 00 00 
+  801387:	41 ff d1             	call   *%r9
+
+000000000080138a <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  80138a:	55                   	push   %rbp
+  80138b:	48 89 e5             	mov    %rsp,%rbp
+  80138e:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80138f:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801394:	ba 00 00 00 00       	mov    $0x0,%edx
+  801399:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80139e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013a3:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013a8:	be 00 00 00 00       	mov    $0x0,%esi
+  8013ad:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013b3:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  8013b5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013b9:	c9                   	leave
+  8013ba:	c3                   	ret
+
+00000000008013bb <sys_yield>:
+
+void
+sys_yield(void) {
+  8013bb:	55                   	push   %rbp
+  8013bc:	48 89 e5             	mov    %rsp,%rbp
+  8013bf:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8013c0:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8013c5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8013ca:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8013cf:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013d4:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013d9:	be 00 00 00 00       	mov    $0x0,%esi
+  8013de:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013e4:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  8013e6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013ea:	c9                   	leave
+  8013eb:	c3                   	ret
+
+00000000008013ec <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  8013ec:	55                   	push   %rbp
+  8013ed:	48 89 e5             	mov    %rsp,%rbp
+  8013f0:	53                   	push   %rbx
+  8013f1:	48 89 fa             	mov    %rdi,%rdx
+  8013f4:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8013f7:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8013fc:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  801403:	00 00 00 
+  801406:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80140b:	be 00 00 00 00       	mov    $0x0,%esi
+  801410:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801416:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  801418:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80141c:	c9                   	leave
+  80141d:	c3                   	ret
+
+000000000080141e <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  80141e:	55                   	push   %rbp
+  80141f:	48 89 e5             	mov    %rsp,%rbp
+  801422:	53                   	push   %rbx
+  801423:	49 89 f8             	mov    %rdi,%r8
+  801426:	48 89 d3             	mov    %rdx,%rbx
+  801429:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80142c:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801431:	4c 89 c2             	mov    %r8,%rdx
+  801434:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801437:	be 00 00 00 00       	mov    $0x0,%esi
+  80143c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801442:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  801444:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801448:	c9                   	leave
+  801449:	c3                   	ret
+
+000000000080144a <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  80144a:	55                   	push   %rbp
+  80144b:	48 89 e5             	mov    %rsp,%rbp
+  80144e:	53                   	push   %rbx
+  80144f:	48 83 ec 08          	sub    $0x8,%rsp
+  801453:	89 f8                	mov    %edi,%eax
+  801455:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  801458:	48 63 f9             	movslq %ecx,%rdi
+  80145b:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80145e:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801463:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801466:	be 00 00 00 00       	mov    $0x0,%esi
+  80146b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801471:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801473:	48 85 c0             	test   %rax,%rax
+  801476:	7f 06                	jg     80147e <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  801478:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80147c:	c9                   	leave
+  80147d:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80147e:	49 89 c0             	mov    %rax,%r8
+  801481:	b9 04 00 00 00       	mov    $0x4,%ecx
+  801486:	48 ba 50 37 80 00 00 	movabs $0x803750,%rdx
+  80148d:	00 00 00 
+  801490:	be 26 00 00 00       	mov    $0x26,%esi
+  801495:	48 bf 6f 37 80 00 00 	movabs $0x80376f,%rdi
+  80149c:	00 00 00 
+  80149f:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014a4:	49 b9 25 04 80 00 00 	movabs $0x800425,%r9
+  8014ab:	00 00 00 
+  8014ae:	41 ff d1             	call   *%r9
+
+00000000008014b1 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8014b1:	55                   	push   %rbp
+  8014b2:	48 89 e5             	mov    %rsp,%rbp
+  8014b5:	53                   	push   %rbx
+  8014b6:	48 83 ec 08          	sub    $0x8,%rsp
+  8014ba:	89 f8                	mov    %edi,%eax
+  8014bc:	49 89 f2             	mov    %rsi,%r10
+  8014bf:	48 89 cf             	mov    %rcx,%rdi
+  8014c2:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  8014c5:	48 63 da             	movslq %edx,%rbx
+  8014c8:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8014cb:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8014d0:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014d3:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  8014d6:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8014d8:	48 85 c0             	test   %rax,%rax
+  8014db:	7f 06                	jg     8014e3 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8014dd:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014e1:	c9                   	leave
+  8014e2:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8014e3:	49 89 c0             	mov    %rax,%r8
+  8014e6:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8014eb:	48 ba 50 37 80 00 00 	movabs $0x803750,%rdx
+  8014f2:	00 00 00 
+  8014f5:	be 26 00 00 00       	mov    $0x26,%esi
+  8014fa:	48 bf 6f 37 80 00 00 	movabs $0x80376f,%rdi
+  801501:	00 00 00 
+  801504:	b8 00 00 00 00       	mov    $0x0,%eax
+  801509:	49 b9 25 04 80 00 00 	movabs $0x800425,%r9
+  801510:	00 00 00 
+  801513:	41 ff d1             	call   *%r9
+
+0000000000801516 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  801516:	55                   	push   %rbp
+  801517:	48 89 e5             	mov    %rsp,%rbp
+  80151a:	53                   	push   %rbx
+  80151b:	48 83 ec 08          	sub    $0x8,%rsp
+  80151f:	48 89 f1             	mov    %rsi,%rcx
+  801522:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  801525:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801528:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80152d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801532:	be 00 00 00 00       	mov    $0x0,%esi
+  801537:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80153d:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80153f:	48 85 c0             	test   %rax,%rax
+  801542:	7f 06                	jg     80154a <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  801544:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801548:	c9                   	leave
+  801549:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80154a:	49 89 c0             	mov    %rax,%r8
+  80154d:	b9 06 00 00 00       	mov    $0x6,%ecx
+  801552:	48 ba 50 37 80 00 00 	movabs $0x803750,%rdx
+  801559:	00 00 00 
+  80155c:	be 26 00 00 00       	mov    $0x26,%esi
+  801561:	48 bf 6f 37 80 00 00 	movabs $0x80376f,%rdi
+  801568:	00 00 00 
+  80156b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801570:	49 b9 25 04 80 00 00 	movabs $0x800425,%r9
+  801577:	00 00 00 
+  80157a:	41 ff d1             	call   *%r9
+
+000000000080157d <sys_region_batch>:
+
+int
+sys_region_batch(const struct RegionOp *ops, size_t count) {
+  80157d:	55                   	push   %rbp
+  80157e:	48 89 e5             	mov    %rsp,%rbp
+  801581:	53                   	push   %rbx
+  801582:	48 83 ec 08          	sub    $0x8,%rsp
+  801586:	48 89 fa             	mov    %rdi,%rdx
+  801589:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80158c:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801591:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801596:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80159b:	be 00 00 00 00       	mov    $0x0,%esi
+  8015a0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015a6:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8015a8:	48 85 c0             	test   %rax,%rax
+  8015ab:	7f 06                	jg     8015b3 <sys_region_batch+0x36>
+        else
+            platform_asan_unpoison(va, ops[i].size);
+    }
+#endif
+    return res;
+}
+  8015ad:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015b1:	c9                   	leave
+  8015b2:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8015b3:	49 89 c0             	mov    %rax,%r8
+  8015b6:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  8015bb:	48 ba 50 37 80 00 00 	movabs $0x803750,%rdx
+  8015c2:	00 00 00 
+  8015c5:	be 26 00 00 00       	mov    $0x26,%esi
+  8015ca:	48 bf 6f 37 80 00 00 	movabs $0x80376f,%rdi
+  8015d1:	00 00 00 
+  8015d4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015d9:	49 b9 25 04 80 00 00 	movabs $0x800425,%r9
+  8015e0:	00 00 00 
+  8015e3:	41 ff d1             	call   *%r9
+
+00000000008015e6 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  8015e6:	55                   	push   %rbp
+  8015e7:	48 89 e5             	mov    %rsp,%rbp
+  8015ea:	53                   	push   %rbx
+  8015eb:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  8015ef:	48 63 ce             	movslq %esi,%rcx
+  8015f2:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8015f5:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8015fa:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015ff:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801604:	be 00 00 00 00       	mov    $0x0,%esi
+  801609:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80160f:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801611:	48 85 c0             	test   %rax,%rax
+  801614:	7f 06                	jg     80161c <sys_env_set_status+0x36>
+}
+  801616:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80161a:	c9                   	leave
+  80161b:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80161c:	49 89 c0             	mov    %rax,%r8
+  80161f:	b9 09 00 00 00       	mov    $0x9,%ecx
+  801624:	48 ba 50 37 80 00 00 	movabs $0x803750,%rdx
+  80162b:	00 00 00 
+  80162e:	be 26 00 00 00       	mov    $0x26,%esi
+  801633:	48 bf 6f 37 80 00 00 	movabs $0x80376f,%rdi
+  80163a:	00 00 00 
+  80163d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801642:	49 b9 25 04 80 00 00 	movabs $0x800425,%r9
+  801649:	00 00 00 
+  80164c:	41 ff d1             	call   *%r9
+
+000000000080164f <sys_env_set_weight>:
+
+int
+sys_env_set_weight(envid_t envid, uint32_t weight) {
+  80164f:	55                   	push   %rbp
+  801650:	48 89 e5             	mov    %rsp,%rbp
+  801653:	53                   	push   %rbx
+  801654:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_weight, 1, envid, weight, 0, 0, 0, 0);
+  801658:	89 f1                	mov    %esi,%ecx
+  80165a:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80165d:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801662:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801667:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80166c:	be 00 00 00 00       	mov    $0x0,%esi
+  801671:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801677:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801679:	48 85 c0             	test   %rax,%rax
+  80167c:	7f 06                	jg     801684 <sys_env_set_weight+0x35>
+}
+  80167e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801682:	c9                   	leave
+  801683:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801684:	49 89 c0             	mov    %rax,%r8
+  801687:	b9 10 00 00 00       	mov    $0x10,%ecx
+  80168c:	48 ba 50 37 80 00 00 	movabs $0x803750,%rdx
+  801693:	00 00 00 
+  801696:	be 26 00 00 00       	mov    $0x26,%esi
+  80169b:	48 bf 6f 37 80 00 00 	movabs $0x80376f,%rdi
+  8016a2:	00 00 00 
+  8016a5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016aa:	49 b9 25 04 80 00 00 	movabs $0x800425,%r9
+  8016b1:	00 00 00 
+  8016b4:	41 ff d1             	call   *%r9
+
+00000000008016b7 <sys_env_set_rt>:
+
+int
+sys_env_set_rt(envid_t envid, uint64_t period, uint64_t budget, uint64_t deadline) {
+  8016b7:	55                   	push   %rbp
+  8016b8:	48 89 e5             	mov    %rsp,%rbp
+  8016bb:	53                   	push   %rbx
+  8016bc:	48 83 ec 08          	sub    $0x8,%rsp
+  8016c0:	89 f8                	mov    %edi,%eax
+  8016c2:	48 89 d3             	mov    %rdx,%rbx
+  8016c5:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_env_set_rt, 1, envid, period, budget, deadline, 0, 0);
+  8016c8:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8016cb:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8016d0:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8016d3:	be 00 00 00 00       	mov    $0x0,%esi
+  8016d8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8016de:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8016e0:	48 85 c0             	test   %rax,%rax
+  8016e3:	7f 06                	jg     8016eb <sys_env_set_rt+0x34>
+}
+  8016e5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8016e9:	c9                   	leave
+  8016ea:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8016eb:	49 89 c0             	mov    %rax,%r8
+  8016ee:	b9 11 00 00 00       	mov    $0x11,%ecx
+  8016f3:	48 ba 50 37 80 00 00 	movabs $0x803750,%rdx
+  8016fa:	00 00 00 
+  8016fd:	be 26 00 00 00       	mov    $0x26,%esi
+  801702:	48 bf 6f 37 80 00 00 	movabs $0x80376f,%rdi
+  801709:	00 00 00 
+  80170c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801711:	49 b9 25 04 80 00 00 	movabs $0x800425,%r9
+  801718:	00 00 00 
+  80171b:	41 ff d1             	call   *%r9
+
+000000000080171e <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  80171e:	55                   	push   %rbp
+  80171f:	48 89 e5             	mov    %rsp,%rbp
+  801722:	53                   	push   %rbx
+  801723:	48 83 ec 08          	sub    $0x8,%rsp
+  801727:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  80172a:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80172d:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801732:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801737:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80173c:	be 00 00 00 00       	mov    $0x0,%esi
+  801741:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801747:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801749:	48 85 c0             	test   %rax,%rax
+  80174c:	7f 06                	jg     801754 <sys_env_set_trapframe+0x36>
+}
+  80174e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801752:	c9                   	leave
+  801753:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801754:	49 89 c0             	mov    %rax,%r8
+  801757:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  80175c:	48 ba 50 37 80 00 00 	movabs $0x803750,%rdx
+  801763:	00 00 00 
+  801766:	be 26 00 00 00       	mov    $0x26,%esi
+  80176b:	48 bf 6f 37 80 00 00 	movabs $0x80376f,%rdi
+  801772:	00 00 00 
+  801775:	b8 00 00 00 00       	mov    $0x0,%eax
+  80177a:	49 b9 25 04 80 00 00 	movabs $0x800425,%r9
+  801781:	00 00 00 
+  801784:	41 ff d1             	call   *%r9
+
+0000000000801787 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  801787:	55                   	push   %rbp
+  801788:	48 89 e5             	mov    %rsp,%rbp
+  80178b:	53                   	push   %rbx
+  80178c:	48 83 ec 08          	sub    $0x8,%rsp
+  801790:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  801793:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801796:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80179b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017a0:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8017a5:	be 00 00 00 00       	mov    $0x0,%esi
+  8017aa:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8017b0:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8017b2:	48 85 c0             	test   %rax,%rax
+  8017b5:	7f 06                	jg     8017bd <sys_env_set_pgfault_upcall+0x36>
+}
+  8017b7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8017bb:	c9                   	leave
+  8017bc:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8017bd:	49 89 c0             	mov    %rax,%r8
+  8017c0:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  8017c5:	48 ba 50 37 80 00 00 	movabs $0x803750,%rdx
+  8017cc:	00 00 00 
+  8017cf:	be 26 00 00 00       	mov    $0x26,%esi
+  8017d4:	48 bf 6f 37 80 00 00 	movabs $0x80376f,%rdi
+  8017db:	00 00 00 
+  8017de:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017e3:	49 b9 25 04 80 00 00 	movabs $0x800425,%r9
+  8017ea:	00 00 00 
+  8017ed:	41 ff d1             	call   *%r9
+
+00000000008017f0 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  8017f0:	55                   	push   %rbp
+  8017f1:	48 89 e5             	mov    %rsp,%rbp
+  8017f4:	53                   	push   %rbx
+  8017f5:	89 f8                	mov    %edi,%eax
+  8017f7:	49 89 f1             	mov    %rsi,%r9
+  8017fa:	48 89 d3             	mov    %rdx,%rbx
+  8017fd:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  801800:	49 63 f0             	movslq %r8d,%rsi
+  801803:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801806:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80180b:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80180e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801814:	cd 30                	int    $0x30
+}
+  801816:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80181a:	c9                   	leave
+  80181b:	c3                   	ret
+
+000000000080181c <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  80181c:	55                   	push   %rbp
+  80181d:	48 89 e5             	mov    %rsp,%rbp
+  801820:	53                   	push   %rbx
+  801821:	48 83 ec 08          	sub    $0x8,%rsp
+  801825:	48 89 fa             	mov    %rdi,%rdx
+  801828:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80182b:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801830:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801835:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80183a:	be 00 00 00 00       	mov    $0x0,%esi
+  80183f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801845:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801847:	48 85 c0             	test   %rax,%rax
+  80184a:	7f 06                	jg     801852 <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  80184c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801850:	c9                   	leave
+  801851:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801852:	49 89 c0             	mov    %rax,%r8
+  801855:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  80185a:	48 ba 50 37 80 00 00 	movabs $0x803750,%rdx
+  801861:	00 00 00 
+  801864:	be 26 00 00 00       	mov    $0x26,%esi
+  801869:	48 bf 6f 37 80 00 00 	movabs $0x80376f,%rdi
+  801870:	00 00 00 
+  801873:	b8 00 00 00 00       	mov    $0x0,%eax
+  801878:	49 b9 25 04 80 00 00 	movabs $0x800425,%r9
+  80187f:	00 00 00 
+  801882:	41 ff d1             	call   *%r9
+
+0000000000801885 <fork>:
+ * Hint:
+ *   Use sys_map_region, it can perform address space copying in one call
+ *   Remember to fix "thisenv" in the child process.
+ */
+envid_t
+fork(void) {
+  801885:	55                   	push   %rbp
+  801886:	48 89 e5             	mov    %rsp,%rbp
+  801889:	41 55                	push   %r13
+  80188b:	41 54                	push   %r12
+  80188d:	53                   	push   %rbx
+  80188e:	48 83 ec 08          	sub    $0x8,%rsp
+
+/* This must be inlined. Exercise for reader: why? */
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+    envid_t ret;
+    asm volatile("int %2"
+  801892:	b8 08 00 00 00       	mov    $0x8,%eax
+  801897:	cd 30                	int    $0x30
+  801899:	41 89 c5             	mov    %eax,%r13d
+    // LAB 9: Your code here
+
+    envid_t child_id = sys_exofork();
+    if (child_id < 0) {
+  80189c:	85 c0                	test   %eax,%eax
+  80189e:	0f 88 ae 00 00 00    	js     801952 <fork+0xcd>
+  8018a4:	89 c3                	mov    %eax,%ebx
+        return child_id;
+    }
+    if (child_id == 0) {
+  8018a6:	0f 84 b4 00 00 00    	je     801960 <fork+0xdb>
+        thisenv = &envs[ENVX(sys_getenvid())];
+        return 0;
+    }
+    int res = sys_map_region(0, NULL, child_id, NULL, MAX_USER_ADDRESS, PROT_ALL | PROT_LAZY | PROT_COMBINE);
+  8018ac:	41 b9 df 01 00 00    	mov    $0x1df,%r9d
+  8018b2:	49 b8 00 00 00 00 80 	movabs $0x8000000000,%r8
+  8018b9:	00 00 00 
+  8018bc:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8018c1:	89 c2                	mov    %eax,%edx
+  8018c3:	be 00 00 00 00       	mov    $0x0,%esi
+  8018c8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8018cd:	48 b8 b1 14 80 00 00 	movabs $0x8014b1,%rax
+  8018d4:	00 00 00 
+  8018d7:	ff d0                	call   *%rax
+  8018d9:	41 89 c4             	mov    %eax,%r12d
+    if (res < 0) {
+  8018dc:	85 c0                	test   %eax,%eax
+  8018de:	78 5d                	js     80193d <fork+0xb8>
+        goto error;
+    }
+    res = sys_env_set_pgfault_upcall(child_id, envs[ENVX(sys_getenvid())].env_pgfault_upcall);
+  8018e0:	48 b8 8a 13 80 00 00 	movabs $0x80138a,%rax
+  8018e7:	00 00 00 
+  8018ea:	ff d0                	call   *%rax
+  8018ec:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8018f1:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+  8018f8:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8018ff:	00 00 00 
+  801902:	48 01 d0             	add    %rdx,%rax
+  801905:	48 8b b0 88 01 00 00 	mov    0x188(%rax),%rsi
+  80190c:	44 89 ef             	mov    %r13d,%edi
+  80190f:	48 b8 87 17 80 00 00 	movabs $0x801787,%rax
+  801916:	00 00 00 
+  801919:	ff d0                	call   *%rax
+  80191b:	41 89 c4             	mov    %eax,%r12d
+    if (res < 0) {
+  80191e:	85 c0                	test   %eax,%eax
+  801920:	78 1b                	js     80193d <fork+0xb8>
+        goto error;
+    }
+    res = sys_env_set_status(child_id, ENV_RUNNABLE);
+  801922:	be 02 00 00 00       	mov    $0x2,%esi
+  801927:	44 89 ef             	mov    %r13d,%edi
+  80192a:	48 b8 e6 15 80 00 00 	movabs $0x8015e6,%rax
+  801931:	00 00 00 
+  801934:	ff d0                	call   *%rax
+  801936:	41 89 c4             	mov    %eax,%r12d
+    if (res < 0) {
+  801939:	85 c0                	test   %eax,%eax
+  80193b:	79 15                	jns    801952 <fork+0xcd>
+        goto error;
+    }
+    return child_id;
+error:
+    ;
+    int res2 = sys_env_destroy(child_id);
+  80193d:	89 df                	mov    %ebx,%edi
+  80193f:	48 b8 1f 13 80 00 00 	movabs $0x80131f,%rax
+  801946:	00 00 00 
+  801949:	ff d0                	call   *%rax
+    if (res2 < 0) {
+  80194b:	85 c0                	test   %eax,%eax
+  80194d:	78 42                	js     801991 <fork+0x10c>
+        panic("Fork double fault");
+    }
+    return res;
+  80194f:	45 89 e5             	mov    %r12d,%r13d
+}
+  801952:	44 89 e8             	mov    %r13d,%eax
+  801955:	48 83 c4 08          	add    $0x8,%rsp
+  801959:	5b                   	pop    %rbx
+  80195a:	41 5c                	pop    %r12
+  80195c:	41 5d                	pop    %r13
+  80195e:	5d                   	pop    %rbp
+  80195f:	c3                   	ret
+        thisenv = &envs[ENVX(sys_getenvid())];
+  801960:	48 b8 8a 13 80 00 00 	movabs $0x80138a,%rax
+  801967:	00 00 00 
+  80196a:	ff d0                	call   *%rax
+  80196c:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801971:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+  801978:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  80197f:	00 00 00 
+  801982:	48 01 d0             	add    %rdx,%rax
+  801985:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  80198c:	00 00 00 
+        return 0;
+  80198f:	eb c1                	jmp    801952 <fork+0xcd>
+        panic("Fork double fault");
+  801991:	48 ba 7d 37 80 00 00 	movabs $0x80377d,%rdx
+  801998:	00 00 00 
+  80199b:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8019a0:	48 bf 8f 37 80 00 00 	movabs $0x80378f,%rdi
+  8019a7:	00 00 00 
+  8019aa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019af:	48 b9 25 04 80 00 00 	movabs $0x800425,%rcx
+  8019b6:	00 00 00 
+  8019b9:	ff d1                	call   *%rcx
+
+00000000008019bb <sfork>:
+
+envid_t
+sfork() {
+  8019bb:	55                   	push   %rbp
+  8019bc:	48 89 e5             	mov    %rsp,%rbp
+    panic("sfork() is not implemented");
+  8019bf:	48 ba 9a 37 80 00 00 	movabs $0x80379a,%rdx
+  8019c6:	00 00 00 
+  8019c9:	be 36 00 00 00       	mov    $0x36,%esi
+  8019ce:	48 bf 8f 37 80 00 00 	movabs $0x80378f,%rdi
+  8019d5:	00 00 00 
+  8019d8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019dd:	48 b9 25 04 80 00 00 	movabs $0x800425,%rcx
+  8019e4:	00 00 00 
+  8019e7:	ff d1                	call   *%rcx
+
+00000000008019e9 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8019e9:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8019f0:	ff ff ff 
+  8019f3:	48 01 f8             	add    %rdi,%rax
+  8019f6:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  8019fa:	c3                   	ret
+
+00000000008019fb <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8019fb:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801a02:	ff ff ff 
+  801a05:	48 01 f8             	add    %rdi,%rax
+  801a08:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  801a0c:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  801a12:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  801a16:	c3                   	ret
+
+0000000000801a17 <fd_alloc_from>:
+}
+
+/* Like fd_alloc(), but only considers fds starting from fdnum,
+ * so that several fds can be found before their pages are allocated */
+int
+fd_alloc_from(int fdnum, struct Fd **fd_store) {
+  801a17:	55                   	push   %rbp
+  801a18:	48 89 e5             	mov    %rsp,%rbp
+  801a1b:	41 57                	push   %r15
+  801a1d:	41 56                	push   %r14
+  801a1f:	41 55                	push   %r13
+  801a21:	41 54                	push   %r12
+  801a23:	53                   	push   %rbx
+  801a24:	48 83 ec 08          	sub    $0x8,%rsp
+  801a28:	49 89 f7             	mov    %rsi,%r15
+    for (int i = MAX(fdnum, 0); i < MAXFD; i++) {
+  801a2b:	85 ff                	test   %edi,%edi
+  801a2d:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  801a33:	44 0f 49 e7          	cmovns %edi,%r12d
+  801a37:	83 ff 1f             	cmp    $0x1f,%edi
+  801a3a:	7f 37                	jg     801a73 <fd_alloc_from+0x5c>
+  801a3c:	49 63 dc             	movslq %r12d,%rbx
+  801a3f:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  801a46:	48 c1 e3 0c          	shl    $0xc,%rbx
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  801a4a:	49 be 20 2b 80 00 00 	movabs $0x802b20,%r14
+  801a51:	00 00 00 
+        struct Fd *fd = INDEX2FD(i);
+  801a54:	49 89 dd             	mov    %rbx,%r13
+        if (!(get_prot(fd) & PROT_R)) {
+  801a57:	48 89 df             	mov    %rbx,%rdi
+  801a5a:	41 ff d6             	call   *%r14
+  801a5d:	83 e0 04             	and    $0x4,%eax
+  801a60:	74 1c                	je     801a7e <fd_alloc_from+0x67>
+    for (int i = MAX(fdnum, 0); i < MAXFD; i++) {
+  801a62:	41 83 c4 01          	add    $0x1,%r12d
+  801a66:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801a6d:	41 83 fc 1f          	cmp    $0x1f,%r12d
+  801a71:	7e e1                	jle    801a54 <fd_alloc_from+0x3d>
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  801a73:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801a79:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  801a7e:	4d 89 2f             	mov    %r13,(%r15)
+}
+  801a81:	48 83 c4 08          	add    $0x8,%rsp
+  801a85:	5b                   	pop    %rbx
+  801a86:	41 5c                	pop    %r12
+  801a88:	41 5d                	pop    %r13
+  801a8a:	41 5e                	pop    %r14
+  801a8c:	41 5f                	pop    %r15
+  801a8e:	5d                   	pop    %rbp
+  801a8f:	c3                   	ret
+
+0000000000801a90 <fd_alloc>:
+fd_alloc(struct Fd **fd_store) {
+  801a90:	55                   	push   %rbp
+  801a91:	48 89 e5             	mov    %rsp,%rbp
+  801a94:	48 89 fe             	mov    %rdi,%rsi
+    return fd_alloc_from(0, fd_store);
+  801a97:	bf 00 00 00 00       	mov    $0x0,%edi
+  801a9c:	48 b8 17 1a 80 00 00 	movabs $0x801a17,%rax
+  801aa3:	00 00 00 
+  801aa6:	ff d0                	call   *%rax
+}
+  801aa8:	5d                   	pop    %rbp
+  801aa9:	c3                   	ret
+
+0000000000801aaa <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  801aaa:	83 ff 1f             	cmp    $0x1f,%edi
+  801aad:	77 39                	ja     801ae8 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  801aaf:	55                   	push   %rbp
+  801ab0:	48 89 e5             	mov    %rsp,%rbp
+  801ab3:	41 54                	push   %r12
+  801ab5:	53                   	push   %rbx
+  801ab6:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  801ab9:	48 63 df             	movslq %edi,%rbx
+  801abc:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  801ac3:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  801ac7:	48 89 df             	mov    %rbx,%rdi
+  801aca:	48 b8 20 2b 80 00 00 	movabs $0x802b20,%rax
+  801ad1:	00 00 00 
+  801ad4:	ff d0                	call   *%rax
+  801ad6:	a8 04                	test   $0x4,%al
+  801ad8:	74 14                	je     801aee <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  801ada:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  801ade:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801ae3:	5b                   	pop    %rbx
+  801ae4:	41 5c                	pop    %r12
+  801ae6:	5d                   	pop    %rbp
+  801ae7:	c3                   	ret
+        return -E_INVAL;
+  801ae8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801aed:	c3                   	ret
+        return -E_INVAL;
+  801aee:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801af3:	eb ee                	jmp    801ae3 <fd_lookup+0x39>
+
+0000000000801af5 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  801af5:	55                   	push   %rbp
+  801af6:	48 89 e5             	mov    %rsp,%rbp
+  801af9:	41 54                	push   %r12
+  801afb:	53                   	push   %rbx
+  801afc:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  801aff:	48 b8 40 38 80 00 00 	movabs $0x803840,%rax
+  801b06:	00 00 00 
+  801b09:	48 bb 20 40 80 00 00 	movabs $0x804020,%rbx
+  801b10:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  801b13:	39 3b                	cmp    %edi,(%rbx)
+  801b15:	74 47                	je     801b5e <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  801b17:	48 83 c0 08          	add    $0x8,%rax
+  801b1b:	48 8b 18             	mov    (%rax),%rbx
+  801b1e:	48 85 db             	test   %rbx,%rbx
+  801b21:	75 f0                	jne    801b13 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801b23:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801b2a:	00 00 00 
+  801b2d:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+  801b33:	89 fa                	mov    %edi,%edx
+  801b35:	48 bf b8 37 80 00 00 	movabs $0x8037b8,%rdi
+  801b3c:	00 00 00 
+  801b3f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b44:	48 b9 75 05 80 00 00 	movabs $0x800575,%rcx
+  801b4b:	00 00 00 
+  801b4e:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  801b50:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  801b55:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  801b59:	5b                   	pop    %rbx
+  801b5a:	41 5c                	pop    %r12
+  801b5c:	5d                   	pop    %rbp
+  801b5d:	c3                   	ret
+            return 0;
+  801b5e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b63:	eb f0                	jmp    801b55 <dev_lookup+0x60>
+
+0000000000801b65 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  801b65:	55                   	push   %rbp
+  801b66:	48 89 e5             	mov    %rsp,%rbp
+  801b69:	41 55                	push   %r13
+  801b6b:	41 54                	push   %r12
+  801b6d:	53                   	push   %rbx
+  801b6e:	48 83 ec 18          	sub    $0x18,%rsp
+  801b72:	48 89 fb             	mov    %rdi,%rbx
+  801b75:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801b78:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  801b7f:	ff ff ff 
+  801b82:	48 01 df             	add    %rbx,%rdi
+  801b85:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  801b89:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801b8d:	48 b8 aa 1a 80 00 00 	movabs $0x801aaa,%rax
+  801b94:	00 00 00 
+  801b97:	ff d0                	call   *%rax
+  801b99:	41 89 c5             	mov    %eax,%r13d
+  801b9c:	85 c0                	test   %eax,%eax
+  801b9e:	78 06                	js     801ba6 <fd_close+0x41>
+  801ba0:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  801ba4:	74 1a                	je     801bc0 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  801ba6:	45 84 e4             	test   %r12b,%r12b
+  801ba9:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bae:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  801bb2:	44 89 e8             	mov    %r13d,%eax
+  801bb5:	48 83 c4 18          	add    $0x18,%rsp
+  801bb9:	5b                   	pop    %rbx
+  801bba:	41 5c                	pop    %r12
+  801bbc:	41 5d                	pop    %r13
+  801bbe:	5d                   	pop    %rbp
+  801bbf:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801bc0:	8b 3b                	mov    (%rbx),%edi
+  801bc2:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801bc6:	48 b8 f5 1a 80 00 00 	movabs $0x801af5,%rax
+  801bcd:	00 00 00 
+  801bd0:	ff d0                	call   *%rax
+  801bd2:	41 89 c5             	mov    %eax,%r13d
+  801bd5:	85 c0                	test   %eax,%eax
+  801bd7:	78 1b                	js     801bf4 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  801bd9:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801bdd:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801be1:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801be7:	48 85 c0             	test   %rax,%rax
+  801bea:	74 08                	je     801bf4 <fd_close+0x8f>
+  801bec:	48 89 df             	mov    %rbx,%rdi
+  801bef:	ff d0                	call   *%rax
+  801bf1:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801bf4:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801bf9:	48 89 de             	mov    %rbx,%rsi
+  801bfc:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c01:	48 b8 16 15 80 00 00 	movabs $0x801516,%rax
+  801c08:	00 00 00 
+  801c0b:	ff d0                	call   *%rax
+    return res;
+  801c0d:	eb a3                	jmp    801bb2 <fd_close+0x4d>
+
+0000000000801c0f <close>:
+
+int
+close(int fdnum) {
+  801c0f:	55                   	push   %rbp
+  801c10:	48 89 e5             	mov    %rsp,%rbp
+  801c13:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  801c17:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801c1b:	48 b8 aa 1a 80 00 00 	movabs $0x801aaa,%rax
+  801c22:	00 00 00 
+  801c25:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801c27:	85 c0                	test   %eax,%eax
+  801c29:	78 15                	js     801c40 <close+0x31>
+
+    return fd_close(fd, 1);
+  801c2b:	be 01 00 00 00       	mov    $0x1,%esi
+  801c30:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801c34:	48 b8 65 1b 80 00 00 	movabs $0x801b65,%rax
+  801c3b:	00 00 00 
+  801c3e:	ff d0                	call   *%rax
+}
+  801c40:	c9                   	leave
+  801c41:	c3                   	ret
+
+0000000000801c42 <close_all>:
+
+void
+close_all(void) {
+  801c42:	55                   	push   %rbp
+  801c43:	48 89 e5             	mov    %rsp,%rbp
+  801c46:	41 54                	push   %r12
+  801c48:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  801c49:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801c4e:	49 bc 0f 1c 80 00 00 	movabs $0x801c0f,%r12
+  801c55:	00 00 00 
+  801c58:	89 df                	mov    %ebx,%edi
+  801c5a:	41 ff d4             	call   *%r12
+  801c5d:	83 c3 01             	add    $0x1,%ebx
+  801c60:	83 fb 20             	cmp    $0x20,%ebx
+  801c63:	75 f3                	jne    801c58 <close_all+0x16>
+}
+  801c65:	5b                   	pop    %rbx
+  801c66:	41 5c                	pop    %r12
+  801c68:	5d                   	pop    %rbp
+  801c69:	c3                   	ret
+
+0000000000801c6a <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  801c6a:	55                   	push   %rbp
+  801c6b:	48 89 e5             	mov    %rsp,%rbp
+  801c6e:	41 57                	push   %r15
+  801c70:	41 56                	push   %r14
+  801c72:	41 55                	push   %r13
+  801c74:	41 54                	push   %r12
+  801c76:	53                   	push   %rbx
+  801c77:	48 83 ec 18          	sub    $0x18,%rsp
+  801c7b:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  801c7e:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801c82:	48 b8 aa 1a 80 00 00 	movabs $0x801aaa,%rax
+  801c89:	00 00 00 
+  801c8c:	ff d0                	call   *%rax
+  801c8e:	89 c3                	mov    %eax,%ebx
+  801c90:	85 c0                	test   %eax,%eax
+  801c92:	0f 88 b8 00 00 00    	js     801d50 <dup+0xe6>
+    close(newfdnum);
+  801c98:	44 89 e7             	mov    %r12d,%edi
+  801c9b:	48 b8 0f 1c 80 00 00 	movabs $0x801c0f,%rax
+  801ca2:	00 00 00 
+  801ca5:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  801ca7:	4d 63 ec             	movslq %r12d,%r13
+  801caa:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  801cb1:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  801cb5:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  801cb9:	4c 89 ff             	mov    %r15,%rdi
+  801cbc:	49 be fb 19 80 00 00 	movabs $0x8019fb,%r14
+  801cc3:	00 00 00 
+  801cc6:	41 ff d6             	call   *%r14
+  801cc9:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  801ccc:	4c 89 ef             	mov    %r13,%rdi
+  801ccf:	41 ff d6             	call   *%r14
+  801cd2:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  801cd5:	48 89 df             	mov    %rbx,%rdi
+  801cd8:	48 b8 20 2b 80 00 00 	movabs $0x802b20,%rax
+  801cdf:	00 00 00 
+  801ce2:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  801ce4:	a8 04                	test   $0x4,%al
+  801ce6:	74 2b                	je     801d13 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  801ce8:	41 89 c1             	mov    %eax,%r9d
+  801ceb:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801cf1:	4c 89 f1             	mov    %r14,%rcx
+  801cf4:	ba 00 00 00 00       	mov    $0x0,%edx
+  801cf9:	48 89 de             	mov    %rbx,%rsi
+  801cfc:	bf 00 00 00 00       	mov    $0x0,%edi
+  801d01:	48 b8 b1 14 80 00 00 	movabs $0x8014b1,%rax
+  801d08:	00 00 00 
+  801d0b:	ff d0                	call   *%rax
+  801d0d:	89 c3                	mov    %eax,%ebx
+  801d0f:	85 c0                	test   %eax,%eax
+  801d11:	78 4e                	js     801d61 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  801d13:	4c 89 ff             	mov    %r15,%rdi
+  801d16:	48 b8 20 2b 80 00 00 	movabs $0x802b20,%rax
+  801d1d:	00 00 00 
+  801d20:	ff d0                	call   *%rax
+  801d22:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801d25:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801d2b:	4c 89 e9             	mov    %r13,%rcx
+  801d2e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d33:	4c 89 fe             	mov    %r15,%rsi
+  801d36:	bf 00 00 00 00       	mov    $0x0,%edi
+  801d3b:	48 b8 b1 14 80 00 00 	movabs $0x8014b1,%rax
+  801d42:	00 00 00 
+  801d45:	ff d0                	call   *%rax
+  801d47:	89 c3                	mov    %eax,%ebx
+  801d49:	85 c0                	test   %eax,%eax
+  801d4b:	78 14                	js     801d61 <dup+0xf7>
+
+    return newfdnum;
+  801d4d:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  801d50:	89 d8                	mov    %ebx,%eax
+  801d52:	48 83 c4 18          	add    $0x18,%rsp
+  801d56:	5b                   	pop    %rbx
+  801d57:	41 5c                	pop    %r12
+  801d59:	41 5d                	pop    %r13
+  801d5b:	41 5e                	pop    %r14
+  801d5d:	41 5f                	pop    %r15
+  801d5f:	5d                   	pop    %rbp
+  801d60:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  801d61:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801d66:	4c 89 ee             	mov    %r13,%rsi
+  801d69:	bf 00 00 00 00       	mov    $0x0,%edi
+  801d6e:	49 bc 16 15 80 00 00 	movabs $0x801516,%r12
+  801d75:	00 00 00 
+  801d78:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  801d7b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801d80:	4c 89 f6             	mov    %r14,%rsi
+  801d83:	bf 00 00 00 00       	mov    $0x0,%edi
+  801d88:	41 ff d4             	call   *%r12
+    return res;
+  801d8b:	eb c3                	jmp    801d50 <dup+0xe6>
+
+0000000000801d8d <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  801d8d:	55                   	push   %rbp
+  801d8e:	48 89 e5             	mov    %rsp,%rbp
+  801d91:	41 56                	push   %r14
+  801d93:	41 55                	push   %r13
+  801d95:	41 54                	push   %r12
+  801d97:	53                   	push   %rbx
+  801d98:	48 83 ec 10          	sub    $0x10,%rsp
+  801d9c:	89 fb                	mov    %edi,%ebx
+  801d9e:	49 89 f4             	mov    %rsi,%r12
+  801da1:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801da4:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801da8:	48 b8 aa 1a 80 00 00 	movabs $0x801aaa,%rax
+  801daf:	00 00 00 
+  801db2:	ff d0                	call   *%rax
+  801db4:	85 c0                	test   %eax,%eax
+  801db6:	78 4c                	js     801e04 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801db8:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801dbc:	41 8b 3e             	mov    (%r14),%edi
+  801dbf:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801dc3:	48 b8 f5 1a 80 00 00 	movabs $0x801af5,%rax
+  801dca:	00 00 00 
+  801dcd:	ff d0                	call   *%rax
+  801dcf:	85 c0                	test   %eax,%eax
+  801dd1:	78 35                	js     801e08 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801dd3:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801dd7:	83 e0 03             	and    $0x3,%eax
+  801dda:	83 f8 01             	cmp    $0x1,%eax
+  801ddd:	74 2d                	je     801e0c <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801ddf:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801de3:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801de7:	48 85 c0             	test   %rax,%rax
+  801dea:	74 56                	je     801e42 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  801dec:	4c 89 ea             	mov    %r13,%rdx
+  801def:	4c 89 e6             	mov    %r12,%rsi
+  801df2:	4c 89 f7             	mov    %r14,%rdi
+  801df5:	ff d0                	call   *%rax
+}
+  801df7:	48 83 c4 10          	add    $0x10,%rsp
+  801dfb:	5b                   	pop    %rbx
+  801dfc:	41 5c                	pop    %r12
+  801dfe:	41 5d                	pop    %r13
+  801e00:	41 5e                	pop    %r14
+  801e02:	5d                   	pop    %rbp
+  801e03:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801e04:	48 98                	cltq
+  801e06:	eb ef                	jmp    801df7 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801e08:	48 98                	cltq
+  801e0a:	eb eb                	jmp    801df7 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801e0c:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801e13:	00 00 00 
+  801e16:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+  801e1c:	89 da                	mov    %ebx,%edx
+  801e1e:	48 bf f9 37 80 00 00 	movabs $0x8037f9,%rdi
+  801e25:	00 00 00 
+  801e28:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e2d:	48 b9 75 05 80 00 00 	movabs $0x800575,%rcx
+  801e34:	00 00 00 
+  801e37:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801e39:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801e40:	eb b5                	jmp    801df7 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801e42:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801e49:	eb ac                	jmp    801df7 <read+0x6a>
+
+0000000000801e4b <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801e4b:	55                   	push   %rbp
+  801e4c:	48 89 e5             	mov    %rsp,%rbp
+  801e4f:	41 57                	push   %r15
+  801e51:	41 56                	push   %r14
+  801e53:	41 55                	push   %r13
+  801e55:	41 54                	push   %r12
+  801e57:	53                   	push   %rbx
+  801e58:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  801e5c:	48 85 d2             	test   %rdx,%rdx
+  801e5f:	74 54                	je     801eb5 <readn+0x6a>
+  801e61:	41 89 fd             	mov    %edi,%r13d
+  801e64:	49 89 f6             	mov    %rsi,%r14
+  801e67:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  801e6a:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  801e6f:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  801e74:	49 bf 8d 1d 80 00 00 	movabs $0x801d8d,%r15
+  801e7b:	00 00 00 
+  801e7e:	4c 89 e2             	mov    %r12,%rdx
+  801e81:	48 29 f2             	sub    %rsi,%rdx
+  801e84:	4c 01 f6             	add    %r14,%rsi
+  801e87:	44 89 ef             	mov    %r13d,%edi
+  801e8a:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  801e8d:	85 c0                	test   %eax,%eax
+  801e8f:	78 20                	js     801eb1 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  801e91:	01 c3                	add    %eax,%ebx
+  801e93:	85 c0                	test   %eax,%eax
+  801e95:	74 08                	je     801e9f <readn+0x54>
+  801e97:	48 63 f3             	movslq %ebx,%rsi
+  801e9a:	4c 39 e6             	cmp    %r12,%rsi
+  801e9d:	72 df                	jb     801e7e <readn+0x33>
+    }
+    return res;
+  801e9f:	48 63 c3             	movslq %ebx,%rax
+}
+  801ea2:	48 83 c4 08          	add    $0x8,%rsp
+  801ea6:	5b                   	pop    %rbx
+  801ea7:	41 5c                	pop    %r12
+  801ea9:	41 5d                	pop    %r13
+  801eab:	41 5e                	pop    %r14
+  801ead:	41 5f                	pop    %r15
+  801eaf:	5d                   	pop    %rbp
+  801eb0:	c3                   	ret
+        if (inc < 0) return inc;
+  801eb1:	48 98                	cltq
+  801eb3:	eb ed                	jmp    801ea2 <readn+0x57>
+    int inc = 1, res = 0;
+  801eb5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801eba:	eb e3                	jmp    801e9f <readn+0x54>
+
+0000000000801ebc <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  801ebc:	55                   	push   %rbp
+  801ebd:	48 89 e5             	mov    %rsp,%rbp
+  801ec0:	41 56                	push   %r14
+  801ec2:	41 55                	push   %r13
+  801ec4:	41 54                	push   %r12
+  801ec6:	53                   	push   %rbx
+  801ec7:	48 83 ec 10          	sub    $0x10,%rsp
+  801ecb:	89 fb                	mov    %edi,%ebx
+  801ecd:	49 89 f4             	mov    %rsi,%r12
+  801ed0:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801ed3:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801ed7:	48 b8 aa 1a 80 00 00 	movabs $0x801aaa,%rax
+  801ede:	00 00 00 
+  801ee1:	ff d0                	call   *%rax
+  801ee3:	85 c0                	test   %eax,%eax
+  801ee5:	78 47                	js     801f2e <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801ee7:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801eeb:	41 8b 3e             	mov    (%r14),%edi
+  801eee:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801ef2:	48 b8 f5 1a 80 00 00 	movabs $0x801af5,%rax
+  801ef9:	00 00 00 
+  801efc:	ff d0                	call   *%rax
+  801efe:	85 c0                	test   %eax,%eax
+  801f00:	78 30                	js     801f32 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801f02:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  801f07:	74 2d                	je     801f36 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801f09:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801f0d:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801f11:	48 85 c0             	test   %rax,%rax
+  801f14:	74 56                	je     801f6c <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  801f16:	4c 89 ea             	mov    %r13,%rdx
+  801f19:	4c 89 e6             	mov    %r12,%rsi
+  801f1c:	4c 89 f7             	mov    %r14,%rdi
+  801f1f:	ff d0                	call   *%rax
+}
+  801f21:	48 83 c4 10          	add    $0x10,%rsp
+  801f25:	5b                   	pop    %rbx
+  801f26:	41 5c                	pop    %r12
+  801f28:	41 5d                	pop    %r13
+  801f2a:	41 5e                	pop    %r14
+  801f2c:	5d                   	pop    %rbp
+  801f2d:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801f2e:	48 98                	cltq
+  801f30:	eb ef                	jmp    801f21 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801f32:	48 98                	cltq
+  801f34:	eb eb                	jmp    801f21 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801f36:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801f3d:	00 00 00 
+  801f40:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+  801f46:	89 da                	mov    %ebx,%edx
+  801f48:	48 bf 15 38 80 00 00 	movabs $0x803815,%rdi
+  801f4f:	00 00 00 
+  801f52:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f57:	48 b9 75 05 80 00 00 	movabs $0x800575,%rcx
+  801f5e:	00 00 00 
+  801f61:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801f63:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801f6a:	eb b5                	jmp    801f21 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801f6c:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801f73:	eb ac                	jmp    801f21 <write+0x65>
+
+0000000000801f75 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  801f75:	55                   	push   %rbp
+  801f76:	48 89 e5             	mov    %rsp,%rbp
+  801f79:	53                   	push   %rbx
+  801f7a:	48 83 ec 18          	sub    $0x18,%rsp
+  801f7e:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801f80:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801f84:	48 b8 aa 1a 80 00 00 	movabs $0x801aaa,%rax
+  801f8b:	00 00 00 
+  801f8e:	ff d0                	call   *%rax
+  801f90:	85 c0                	test   %eax,%eax
+  801f92:	78 0c                	js     801fa0 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  801f94:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801f98:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  801f9b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801fa0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801fa4:	c9                   	leave
+  801fa5:	c3                   	ret
+
+0000000000801fa6 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  801fa6:	55                   	push   %rbp
+  801fa7:	48 89 e5             	mov    %rsp,%rbp
+  801faa:	41 55                	push   %r13
+  801fac:	41 54                	push   %r12
+  801fae:	53                   	push   %rbx
+  801faf:	48 83 ec 18          	sub    $0x18,%rsp
+  801fb3:	89 fb                	mov    %edi,%ebx
+  801fb5:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801fb8:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801fbc:	48 b8 aa 1a 80 00 00 	movabs $0x801aaa,%rax
+  801fc3:	00 00 00 
+  801fc6:	ff d0                	call   *%rax
+  801fc8:	85 c0                	test   %eax,%eax
+  801fca:	78 38                	js     802004 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801fcc:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  801fd0:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  801fd4:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801fd8:	48 b8 f5 1a 80 00 00 	movabs $0x801af5,%rax
+  801fdf:	00 00 00 
+  801fe2:	ff d0                	call   *%rax
+  801fe4:	85 c0                	test   %eax,%eax
+  801fe6:	78 1c                	js     802004 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801fe8:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  801fed:	74 20                	je     80200f <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801fef:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801ff3:	48 8b 40 30          	mov    0x30(%rax),%rax
+  801ff7:	48 85 c0             	test   %rax,%rax
+  801ffa:	74 47                	je     802043 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  801ffc:	44 89 e6             	mov    %r12d,%esi
+  801fff:	4c 89 ef             	mov    %r13,%rdi
+  802002:	ff d0                	call   *%rax
+}
+  802004:	48 83 c4 18          	add    $0x18,%rsp
+  802008:	5b                   	pop    %rbx
+  802009:	41 5c                	pop    %r12
+  80200b:	41 5d                	pop    %r13
+  80200d:	5d                   	pop    %rbp
+  80200e:	c3                   	ret
+                thisenv->env_id, fdnum);
+  80200f:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802016:	00 00 00 
+  802019:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  80201f:	89 da                	mov    %ebx,%edx
+  802021:	48 bf d8 37 80 00 00 	movabs $0x8037d8,%rdi
+  802028:	00 00 00 
+  80202b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802030:	48 b9 75 05 80 00 00 	movabs $0x800575,%rcx
+  802037:	00 00 00 
+  80203a:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  80203c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802041:	eb c1                	jmp    802004 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  802043:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802048:	eb ba                	jmp    802004 <ftruncate+0x5e>
+
+000000000080204a <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  80204a:	55                   	push   %rbp
+  80204b:	48 89 e5             	mov    %rsp,%rbp
+  80204e:	41 54                	push   %r12
+  802050:	53                   	push   %rbx
+  802051:	48 83 ec 10          	sub    $0x10,%rsp
+  802055:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802058:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80205c:	48 b8 aa 1a 80 00 00 	movabs $0x801aaa,%rax
+  802063:	00 00 00 
+  802066:	ff d0                	call   *%rax
+  802068:	85 c0                	test   %eax,%eax
+  80206a:	78 4e                	js     8020ba <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80206c:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  802070:	41 8b 3c 24          	mov    (%r12),%edi
+  802074:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  802078:	48 b8 f5 1a 80 00 00 	movabs $0x801af5,%rax
+  80207f:	00 00 00 
+  802082:	ff d0                	call   *%rax
+  802084:	85 c0                	test   %eax,%eax
+  802086:	78 32                	js     8020ba <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  802088:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80208c:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  802091:	74 30                	je     8020c3 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  802093:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  802096:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  80209d:	00 00 00 
+    stat->st_isdir = 0;
+  8020a0:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8020a7:	00 00 00 
+    stat->st_dev = dev;
+  8020aa:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  8020b1:	48 89 de             	mov    %rbx,%rsi
+  8020b4:	4c 89 e7             	mov    %r12,%rdi
+  8020b7:	ff 50 28             	call   *0x28(%rax)
+}
+  8020ba:	48 83 c4 10          	add    $0x10,%rsp
+  8020be:	5b                   	pop    %rbx
+  8020bf:	41 5c                	pop    %r12
+  8020c1:	5d                   	pop    %rbp
+  8020c2:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  8020c3:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8020c8:	eb f0                	jmp    8020ba <fstat+0x70>
+
+00000000008020ca <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  8020ca:	55                   	push   %rbp
+  8020cb:	48 89 e5             	mov    %rsp,%rbp
+  8020ce:	41 54                	push   %r12
+  8020d0:	53                   	push   %rbx
+  8020d1:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  8020d4:	be 00 00 00 00       	mov    $0x0,%esi
+  8020d9:	48 b8 ad 24 80 00 00 	movabs $0x8024ad,%rax
+  8020e0:	00 00 00 
+  8020e3:	ff d0                	call   *%rax
+  8020e5:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  8020e7:	85 c0                	test   %eax,%eax
+  8020e9:	78 25                	js     802110 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  8020eb:	4c 89 e6             	mov    %r12,%rsi
+  8020ee:	89 c7                	mov    %eax,%edi
+  8020f0:	48 b8 4a 20 80 00 00 	movabs $0x80204a,%rax
+  8020f7:	00 00 00 
+  8020fa:	ff d0                	call   *%rax
+  8020fc:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  8020ff:	89 df                	mov    %ebx,%edi
+  802101:	48 b8 0f 1c 80 00 00 	movabs $0x801c0f,%rax
+  802108:	00 00 00 
+  80210b:	ff d0                	call   *%rax
+
+    return res;
+  80210d:	44 89 e3             	mov    %r12d,%ebx
+}
+  802110:	89 d8                	mov    %ebx,%eax
+  802112:	5b                   	pop    %rbx
+  802113:	41 5c                	pop    %r12
+  802115:	5d                   	pop    %rbp
+  802116:	c3                   	ret
+
+0000000000802117 <fsipc>:
+ * response may be written back to fsipcbuf.
+ * type: request code, passed as the simple integer IPC value.
+ * dstva: virtual address at which to receive reply page, 0 if none.
+ * Returns result from the file server. */
+static int
+fsipc(unsigned type, void *dstva) {
+  802117:	55                   	push   %rbp
+  802118:	48 89 e5             	mov    %rsp,%rbp
+  80211b:	41 54                	push   %r12
+  80211d:	53                   	push   %rbx
+  80211e:	48 83 ec 10          	sub    $0x10,%rsp
+  802122:	41 89 fc             	mov    %edi,%r12d
+  802125:	48 89 f3             	mov    %rsi,%rbx
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802128:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  80212f:	00 00 00 
+  802132:	83 38 00             	cmpl   $0x0,(%rax)
+  802135:	74 5e                	je     802195 <fsipc+0x7e>
+    if (debug) {
+        cprintf("[%08x] fsipc %d %08x\n",
+                thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+    }
+
+    ipc_send(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW);
+  802137:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  80213d:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802142:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  802149:	00 00 00 
+  80214c:	44 89 e6             	mov    %r12d,%esi
+  80214f:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  802156:	00 00 00 
+  802159:	8b 38                	mov    (%rax),%edi
+  80215b:	48 b8 14 30 80 00 00 	movabs $0x803014,%rax
+  802162:	00 00 00 
+  802165:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  802167:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  80216e:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  80216f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802174:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  802178:	48 89 de             	mov    %rbx,%rsi
+  80217b:	bf 00 00 00 00       	mov    $0x0,%edi
+  802180:	48 b8 3f 2f 80 00 00 	movabs $0x802f3f,%rax
+  802187:	00 00 00 
+  80218a:	ff d0                	call   *%rax
+}
+  80218c:	48 83 c4 10          	add    $0x10,%rsp
+  802190:	5b                   	pop    %rbx
+  802191:	41 5c                	pop    %r12
+  802193:	5d                   	pop    %rbp
+  802194:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802195:	bf 03 00 00 00       	mov    $0x3,%edi
+  80219a:	48 b8 b7 30 80 00 00 	movabs $0x8030b7,%rax
+  8021a1:	00 00 00 
+  8021a4:	ff d0                	call   *%rax
+  8021a6:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  8021ad:	00 00 
+  8021af:	eb 86                	jmp    802137 <fsipc+0x20>
+
+00000000008021b1 <devfile_trunc>:
+    return 0;
+}
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  8021b1:	55                   	push   %rbp
+  8021b2:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  8021b5:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  8021bc:	00 00 00 
+  8021bf:	8b 57 0c             	mov    0xc(%rdi),%edx
+  8021c2:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  8021c4:	89 70 04             	mov    %esi,0x4(%rax)
+
+    return fsipc(FSREQ_SET_SIZE, NULL);
+  8021c7:	be 00 00 00 00       	mov    $0x0,%esi
+  8021cc:	bf 02 00 00 00       	mov    $0x2,%edi
+  8021d1:	48 b8 17 21 80 00 00 	movabs $0x802117,%rax
+  8021d8:	00 00 00 
+  8021db:	ff d0                	call   *%rax
+}
+  8021dd:	5d                   	pop    %rbp
+  8021de:	c3                   	ret
+
+00000000008021df <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  8021df:	55                   	push   %rbp
+  8021e0:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  8021e3:	8b 47 0c             	mov    0xc(%rdi),%eax
+  8021e6:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  8021ed:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  8021ef:	be 00 00 00 00       	mov    $0x0,%esi
+  8021f4:	bf 06 00 00 00       	mov    $0x6,%edi
+  8021f9:	48 b8 17 21 80 00 00 	movabs $0x802117,%rax
+  802200:	00 00 00 
+  802203:	ff d0                	call   *%rax
+}
+  802205:	5d                   	pop    %rbp
+  802206:	c3                   	ret
+
+0000000000802207 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  802207:	55                   	push   %rbp
+  802208:	48 89 e5             	mov    %rsp,%rbp
+  80220b:	41 54                	push   %r12
+  80220d:	53                   	push   %rbx
+  80220e:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802211:	8b 47 0c             	mov    0xc(%rdi),%eax
+  802214:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  80221b:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  80221d:	be 00 00 00 00       	mov    $0x0,%esi
+  802222:	bf 05 00 00 00       	mov    $0x5,%edi
+  802227:	48 b8 17 21 80 00 00 	movabs $0x802117,%rax
+  80222e:	00 00 00 
+  802231:	ff d0                	call   *%rax
+    if (res < 0) {
+  802233:	85 c0                	test   %eax,%eax
+  802235:	78 3d                	js     802274 <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802237:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  80223e:	00 00 00 
+  802241:	4c 89 e6             	mov    %r12,%rsi
+  802244:	48 89 df             	mov    %rbx,%rdi
+  802247:	48 b8 9a 0e 80 00 00 	movabs $0x800e9a,%rax
+  80224e:	00 00 00 
+  802251:	ff d0                	call   *%rax
+    st->st_size  = fsipcbuf.statRet.ret_size;
+  802253:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  80225a:	00 
+  80225b:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802261:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  802268:	00 
+  802269:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  80226f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802274:	5b                   	pop    %rbx
+  802275:	41 5c                	pop    %r12
+  802277:	5d                   	pop    %rbp
+  802278:	c3                   	ret
+
+0000000000802279 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  802279:	55                   	push   %rbp
+  80227a:	48 89 e5             	mov    %rsp,%rbp
+  80227d:	41 57                	push   %r15
+  80227f:	41 56                	push   %r14
+  802281:	41 55                	push   %r13
+  802283:	41 54                	push   %r12
+  802285:	53                   	push   %rbx
+  802286:	48 83 ec 18          	sub    $0x18,%rsp
+  80228a:	49 89 fe             	mov    %rdi,%r14
+  80228d:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+  802291:	48 89 d3             	mov    %rdx,%rbx
+    while (n > sizeof(fsipcbuf.write.req_buf))
+  802294:	48 81 fa f0 0f 00 00 	cmp    $0xff0,%rdx
+  80229b:	0f 86 e4 00 00 00    	jbe    802385 <devfile_write+0x10c>
+  8022a1:	49 89 f4             	mov    %rsi,%r12
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8022a4:	49 bd 00 60 80 00 00 	movabs $0x806000,%r13
+  8022ab:	00 00 00 
+        memcpy(fsipcbuf.write.req_buf, buf, sizeof(fsipcbuf.write.req_buf));
+  8022ae:	49 bf fb 10 80 00 00 	movabs $0x8010fb,%r15
+  8022b5:	00 00 00 
+  8022b8:	eb 03                	jmp    8022bd <devfile_write+0x44>
+        buf += sizeof(fsipcbuf.write.req_buf);
+  8022ba:	49 89 f4             	mov    %rsi,%r12
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8022bd:	41 8b 46 0c          	mov    0xc(%r14),%eax
+  8022c1:	41 89 45 00          	mov    %eax,0x0(%r13)
+        fsipcbuf.write.req_n      = sizeof(fsipcbuf.write.req_buf);
+  8022c5:	49 c7 45 08 f0 0f 00 	movq   $0xff0,0x8(%r13)
+  8022cc:	00 
+        memcpy(fsipcbuf.write.req_buf, buf, sizeof(fsipcbuf.write.req_buf));
+  8022cd:	ba f0 0f 00 00       	mov    $0xff0,%edx
+  8022d2:	4c 89 e6             	mov    %r12,%rsi
+  8022d5:	48 bf 10 60 80 00 00 	movabs $0x806010,%rdi
+  8022dc:	00 00 00 
+  8022df:	41 ff d7             	call   *%r15
+        ssize_t res = fsipc(FSREQ_WRITE, NULL);
+  8022e2:	be 00 00 00 00       	mov    $0x0,%esi
+  8022e7:	bf 04 00 00 00       	mov    $0x4,%edi
+  8022ec:	48 b8 17 21 80 00 00 	movabs $0x802117,%rax
+  8022f3:	00 00 00 
+  8022f6:	ff d0                	call   *%rax
+  8022f8:	48 63 d0             	movslq %eax,%rdx
+        if (res < 0 || res < sizeof(fsipcbuf.write.req_buf))
+  8022fb:	3d ef 0f 00 00       	cmp    $0xfef,%eax
+  802300:	7e 71                	jle    802373 <devfile_write+0xfa>
+        buf += sizeof(fsipcbuf.write.req_buf);
+  802302:	49 8d b4 24 f0 0f 00 	lea    0xff0(%r12),%rsi
+  802309:	00 
+        n -= sizeof(fsipcbuf.write.req_buf);
+  80230a:	48 81 eb f0 0f 00 00 	sub    $0xff0,%rbx
+    while (n > sizeof(fsipcbuf.write.req_buf))
+  802311:	48 81 fb f0 0f 00 00 	cmp    $0xff0,%rbx
+  802318:	77 a0                	ja     8022ba <devfile_write+0x41>
+        written += sizeof(fsipcbuf.write.req_buf);
+  80231a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80231e:	49 29 c4             	sub    %rax,%r12
+  802321:	4d 8d a4 24 f0 0f 00 	lea    0xff0(%r12),%r12
+  802328:	00 
+    fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802329:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  802330:	00 00 00 
+  802333:	41 8b 56 0c          	mov    0xc(%r14),%edx
+  802337:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.write.req_n      = n;
+  802339:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    memcpy(fsipcbuf.write.req_buf, buf, n);
+  80233d:	48 89 da             	mov    %rbx,%rdx
+  802340:	48 8d 78 10          	lea    0x10(%rax),%rdi
+  802344:	48 b8 fb 10 80 00 00 	movabs $0x8010fb,%rax
+  80234b:	00 00 00 
+  80234e:	ff d0                	call   *%rax
+    ssize_t res = fsipc(FSREQ_WRITE, NULL);
+  802350:	be 00 00 00 00       	mov    $0x0,%esi
+  802355:	bf 04 00 00 00       	mov    $0x4,%edi
+  80235a:	48 b8 17 21 80 00 00 	movabs $0x802117,%rax
+  802361:	00 00 00 
+  802364:	ff d0                	call   *%rax
+  802366:	48 63 d0             	movslq %eax,%rdx
+    written += res;
+  802369:	49 01 d4             	add    %rdx,%r12
+  80236c:	48 85 d2             	test   %rdx,%rdx
+  80236f:	49 0f 49 d4          	cmovns %r12,%rdx
+}
+  802373:	48 89 d0             	mov    %rdx,%rax
+  802376:	48 83 c4 18          	add    $0x18,%rsp
+  80237a:	5b                   	pop    %rbx
+  80237b:	41 5c                	pop    %r12
+  80237d:	41 5d                	pop    %r13
+  80237f:	41 5e                	pop    %r14
+  802381:	41 5f                	pop    %r15
+  802383:	5d                   	pop    %rbp
+  802384:	c3                   	ret
+    while (n > sizeof(fsipcbuf.write.req_buf))
+  802385:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+    ssize_t written = 0;
+  802389:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80238f:	eb 98                	jmp    802329 <devfile_write+0xb0>
+
+0000000000802391 <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  802391:	55                   	push   %rbp
+  802392:	48 89 e5             	mov    %rsp,%rbp
+  802395:	41 57                	push   %r15
+  802397:	41 56                	push   %r14
+  802399:	41 55                	push   %r13
+  80239b:	41 54                	push   %r12
+  80239d:	53                   	push   %rbx
+  80239e:	48 83 ec 18          	sub    $0x18,%rsp
+  8023a2:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  8023a6:	49 89 f6             	mov    %rsi,%r14
+  8023a9:	49 89 d4             	mov    %rdx,%r12
+    while (n > sizeof(fsipcbuf.readRet.ret_buf))
+  8023ac:	48 81 fa 00 10 00 00 	cmp    $0x1000,%rdx
+  8023b3:	0f 86 ea 00 00 00    	jbe    8024a3 <devfile_read+0x112>
+    ssize_t readsz = 0;
+  8023b9:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  8023c0:	00 
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8023c1:	49 bf 00 60 80 00 00 	movabs $0x806000,%r15
+  8023c8:	00 00 00 
+  8023cb:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8023cf:	8b 40 0c             	mov    0xc(%rax),%eax
+  8023d2:	41 89 07             	mov    %eax,(%r15)
+        fsipcbuf.read.req_n = sizeof(fsipcbuf.readRet.ret_buf);
+  8023d5:	49 c7 47 08 00 10 00 	movq   $0x1000,0x8(%r15)
+  8023dc:	00 
+        ssize_t res = fsipc(FSREQ_READ, NULL);
+  8023dd:	be 00 00 00 00       	mov    $0x0,%esi
+  8023e2:	bf 03 00 00 00       	mov    $0x3,%edi
+  8023e7:	48 b8 17 21 80 00 00 	movabs $0x802117,%rax
+  8023ee:	00 00 00 
+  8023f1:	ff d0                	call   *%rax
+  8023f3:	4c 63 e8             	movslq %eax,%r13
+        if (res < 0)
+  8023f6:	4d 85 ed             	test   %r13,%r13
+  8023f9:	0f 88 92 00 00 00    	js     802491 <devfile_read+0x100>
+        memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  8023ff:	4c 89 ea             	mov    %r13,%rdx
+  802402:	4c 89 fe             	mov    %r15,%rsi
+  802405:	4c 89 f7             	mov    %r14,%rdi
+  802408:	48 b8 fb 10 80 00 00 	movabs $0x8010fb,%rax
+  80240f:	00 00 00 
+  802412:	ff d0                	call   *%rax
+        if (res < sizeof(fsipcbuf.readRet.ret_buf))
+  802414:	49 81 fd ff 0f 00 00 	cmp    $0xfff,%r13
+  80241b:	76 6d                	jbe    80248a <devfile_read+0xf9>
+        readsz += res;
+  80241d:	4c 01 6d c0          	add    %r13,-0x40(%rbp)
+        buf += res;
+  802421:	4d 01 ee             	add    %r13,%r14
+        n -= res;
+  802424:	4d 29 ec             	sub    %r13,%r12
+    while (n > sizeof(fsipcbuf.readRet.ret_buf))
+  802427:	49 81 fc 00 10 00 00 	cmp    $0x1000,%r12
+  80242e:	77 9b                	ja     8023cb <devfile_read+0x3a>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802430:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  802437:	00 00 00 
+  80243a:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  80243e:	8b 51 0c             	mov    0xc(%rcx),%edx
+  802441:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.read.req_n = n;
+  802443:	4c 89 60 08          	mov    %r12,0x8(%rax)
+    ssize_t res = fsipc(FSREQ_READ, NULL);
+  802447:	be 00 00 00 00       	mov    $0x0,%esi
+  80244c:	bf 03 00 00 00       	mov    $0x3,%edi
+  802451:	48 b8 17 21 80 00 00 	movabs $0x802117,%rax
+  802458:	00 00 00 
+  80245b:	ff d0                	call   *%rax
+  80245d:	4c 63 e8             	movslq %eax,%r13
+    if (res < 0)
+  802460:	4d 85 ed             	test   %r13,%r13
+  802463:	78 2c                	js     802491 <devfile_read+0x100>
+    memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  802465:	4c 89 ea             	mov    %r13,%rdx
+  802468:	48 be 00 60 80 00 00 	movabs $0x806000,%rsi
+  80246f:	00 00 00 
+  802472:	4c 89 f7             	mov    %r14,%rdi
+  802475:	48 b8 fb 10 80 00 00 	movabs $0x8010fb,%rax
+  80247c:	00 00 00 
+  80247f:	ff d0                	call   *%rax
+    readsz += res;
+  802481:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802485:	49 01 c5             	add    %rax,%r13
+    return readsz;
+  802488:	eb 07                	jmp    802491 <devfile_read+0x100>
+            return readsz + res;
+  80248a:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80248e:	49 01 c5             	add    %rax,%r13
+}
+  802491:	4c 89 e8             	mov    %r13,%rax
+  802494:	48 83 c4 18          	add    $0x18,%rsp
+  802498:	5b                   	pop    %rbx
+  802499:	41 5c                	pop    %r12
+  80249b:	41 5d                	pop    %r13
+  80249d:	41 5e                	pop    %r14
+  80249f:	41 5f                	pop    %r15
+  8024a1:	5d                   	pop    %rbp
+  8024a2:	c3                   	ret
+    ssize_t readsz = 0;
+  8024a3:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  8024aa:	00 
+  8024ab:	eb 83                	jmp    802430 <devfile_read+0x9f>
+
+00000000008024ad <open>:
+open(const char *path, int mode) {
+  8024ad:	55                   	push   %rbp
+  8024ae:	48 89 e5             	mov    %rsp,%rbp
+  8024b1:	41 55                	push   %r13
+  8024b3:	41 54                	push   %r12
+  8024b5:	53                   	push   %rbx
+  8024b6:	48 83 ec 18          	sub    $0x18,%rsp
+  8024ba:	49 89 fc             	mov    %rdi,%r12
+  8024bd:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  8024c0:	48 b8 5c 0e 80 00 00 	movabs $0x800e5c,%rax
+  8024c7:	00 00 00 
+  8024ca:	ff d0                	call   *%rax
+  8024cc:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  8024d2:	0f 87 8a 00 00 00    	ja     802562 <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8024d8:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  8024dc:	48 b8 90 1a 80 00 00 	movabs $0x801a90,%rax
+  8024e3:	00 00 00 
+  8024e6:	ff d0                	call   *%rax
+  8024e8:	89 c3                	mov    %eax,%ebx
+  8024ea:	85 c0                	test   %eax,%eax
+  8024ec:	78 50                	js     80253e <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  8024ee:	4c 89 e6             	mov    %r12,%rsi
+  8024f1:	48 bb 00 60 80 00 00 	movabs $0x806000,%rbx
+  8024f8:	00 00 00 
+  8024fb:	48 89 df             	mov    %rbx,%rdi
+  8024fe:	48 b8 9a 0e 80 00 00 	movabs $0x800e9a,%rax
+  802505:	00 00 00 
+  802508:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  80250a:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  802511:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802515:	bf 01 00 00 00       	mov    $0x1,%edi
+  80251a:	48 b8 17 21 80 00 00 	movabs $0x802117,%rax
+  802521:	00 00 00 
+  802524:	ff d0                	call   *%rax
+  802526:	89 c3                	mov    %eax,%ebx
+  802528:	85 c0                	test   %eax,%eax
+  80252a:	78 1f                	js     80254b <open+0x9e>
+    return fd2num(fd);
+  80252c:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802530:	48 b8 e9 19 80 00 00 	movabs $0x8019e9,%rax
+  802537:	00 00 00 
+  80253a:	ff d0                	call   *%rax
+  80253c:	89 c3                	mov    %eax,%ebx
+}
+  80253e:	89 d8                	mov    %ebx,%eax
+  802540:	48 83 c4 18          	add    $0x18,%rsp
+  802544:	5b                   	pop    %rbx
+  802545:	41 5c                	pop    %r12
+  802547:	41 5d                	pop    %r13
+  802549:	5d                   	pop    %rbp
+  80254a:	c3                   	ret
+        fd_close(fd, 0);
+  80254b:	be 00 00 00 00       	mov    $0x0,%esi
+  802550:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802554:	48 b8 65 1b 80 00 00 	movabs $0x801b65,%rax
+  80255b:	00 00 00 
+  80255e:	ff d0                	call   *%rax
+        return res;
+  802560:	eb dc                	jmp    80253e <open+0x91>
+        return -E_BAD_PATH;
+  802562:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  802567:	eb d5                	jmp    80253e <open+0x91>
+
+0000000000802569 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  802569:	55                   	push   %rbp
+  80256a:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc(FSREQ_SYNC, NULL);
+  80256d:	be 00 00 00 00       	mov    $0x0,%esi
+  802572:	bf 08 00 00 00       	mov    $0x8,%edi
+  802577:	48 b8 17 21 80 00 00 	movabs $0x802117,%rax
+  80257e:	00 00 00 
+  802581:	ff d0                	call   *%rax
+}
+  802583:	5d                   	pop    %rbp
+  802584:	c3                   	ret
+
+0000000000802585 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  802585:	55                   	push   %rbp
+  802586:	48 89 e5             	mov    %rsp,%rbp
+  802589:	41 54                	push   %r12
+  80258b:	53                   	push   %rbx
+  80258c:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80258f:	48 b8 fb 19 80 00 00 	movabs $0x8019fb,%rax
+  802596:	00 00 00 
+  802599:	ff d0                	call   *%rax
+  80259b:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  80259e:	48 be 60 38 80 00 00 	movabs $0x803860,%rsi
+  8025a5:	00 00 00 
+  8025a8:	48 89 df             	mov    %rbx,%rdi
+  8025ab:	48 b8 9a 0e 80 00 00 	movabs $0x800e9a,%rax
+  8025b2:	00 00 00 
+  8025b5:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  8025b7:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  8025bc:	41 2b 04 24          	sub    (%r12),%eax
+  8025c0:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  8025c6:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8025cd:	00 00 00 
+    stat->st_dev = &devpipe;
+  8025d0:	48 b8 60 40 80 00 00 	movabs $0x804060,%rax
+  8025d7:	00 00 00 
+  8025da:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  8025e1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025e6:	5b                   	pop    %rbx
+  8025e7:	41 5c                	pop    %r12
+  8025e9:	5d                   	pop    %rbp
+  8025ea:	c3                   	ret
+
+00000000008025eb <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  8025eb:	55                   	push   %rbp
+  8025ec:	48 89 e5             	mov    %rsp,%rbp
+  8025ef:	41 54                	push   %r12
+  8025f1:	53                   	push   %rbx
+  8025f2:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8025f5:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8025fa:	48 89 fe             	mov    %rdi,%rsi
+  8025fd:	bf 00 00 00 00       	mov    $0x0,%edi
+  802602:	49 bc 16 15 80 00 00 	movabs $0x801516,%r12
+  802609:	00 00 00 
+  80260c:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  80260f:	48 89 df             	mov    %rbx,%rdi
+  802612:	48 b8 fb 19 80 00 00 	movabs $0x8019fb,%rax
+  802619:	00 00 00 
+  80261c:	ff d0                	call   *%rax
+  80261e:	48 89 c6             	mov    %rax,%rsi
+  802621:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802626:	bf 00 00 00 00       	mov    $0x0,%edi
+  80262b:	41 ff d4             	call   *%r12
+}
+  80262e:	5b                   	pop    %rbx
+  80262f:	41 5c                	pop    %r12
+  802631:	5d                   	pop    %rbp
+  802632:	c3                   	ret
+
+0000000000802633 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  802633:	55                   	push   %rbp
+  802634:	48 89 e5             	mov    %rsp,%rbp
+  802637:	41 57                	push   %r15
+  802639:	41 56                	push   %r14
+  80263b:	41 55                	push   %r13
+  80263d:	41 54                	push   %r12
+  80263f:	53                   	push   %rbx
+  802640:	48 83 ec 18          	sub    $0x18,%rsp
+  802644:	49 89 fc             	mov    %rdi,%r12
+  802647:	49 89 f5             	mov    %rsi,%r13
+  80264a:	49 89 d7             	mov    %rdx,%r15
+  80264d:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802651:	48 b8 fb 19 80 00 00 	movabs $0x8019fb,%rax
+  802658:	00 00 00 
+  80265b:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  80265d:	4d 85 ff             	test   %r15,%r15
+  802660:	0f 84 af 00 00 00    	je     802715 <devpipe_write+0xe2>
+  802666:	48 89 c3             	mov    %rax,%rbx
+  802669:	4c 89 f8             	mov    %r15,%rax
+  80266c:	4d 89 ef             	mov    %r13,%r15
+  80266f:	4c 01 e8             	add    %r13,%rax
+  802672:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802676:	49 bd 1e 14 80 00 00 	movabs $0x80141e,%r13
+  80267d:	00 00 00 
+            sys_yield();
+  802680:	49 be bb 13 80 00 00 	movabs $0x8013bb,%r14
+  802687:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  80268a:	8b 73 04             	mov    0x4(%rbx),%esi
+  80268d:	48 63 ce             	movslq %esi,%rcx
+  802690:	48 63 03             	movslq (%rbx),%rax
+  802693:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  802699:	48 39 c1             	cmp    %rax,%rcx
+  80269c:	72 2e                	jb     8026cc <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80269e:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8026a3:	48 89 da             	mov    %rbx,%rdx
+  8026a6:	be 00 10 00 00       	mov    $0x1000,%esi
+  8026ab:	4c 89 e7             	mov    %r12,%rdi
+  8026ae:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  8026b1:	85 c0                	test   %eax,%eax
+  8026b3:	74 66                	je     80271b <devpipe_write+0xe8>
+            sys_yield();
+  8026b5:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  8026b8:	8b 73 04             	mov    0x4(%rbx),%esi
+  8026bb:	48 63 ce             	movslq %esi,%rcx
+  8026be:	48 63 03             	movslq (%rbx),%rax
+  8026c1:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  8026c7:	48 39 c1             	cmp    %rax,%rcx
+  8026ca:	73 d2                	jae    80269e <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8026cc:	41 0f b6 3f          	movzbl (%r15),%edi
+  8026d0:	48 89 ca             	mov    %rcx,%rdx
+  8026d3:	48 c1 ea 03          	shr    $0x3,%rdx
+  8026d7:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  8026de:	08 10 20 
+  8026e1:	48 f7 e2             	mul    %rdx
+  8026e4:	48 c1 ea 06          	shr    $0x6,%rdx
+  8026e8:	48 89 d0             	mov    %rdx,%rax
+  8026eb:	48 c1 e0 09          	shl    $0x9,%rax
+  8026ef:	48 29 d0             	sub    %rdx,%rax
+  8026f2:	48 c1 e0 03          	shl    $0x3,%rax
+  8026f6:	48 29 c1             	sub    %rax,%rcx
+  8026f9:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  8026fe:	83 c6 01             	add    $0x1,%esi
+  802701:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  802704:	49 83 c7 01          	add    $0x1,%r15
+  802708:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80270c:	49 39 c7             	cmp    %rax,%r15
+  80270f:	0f 85 75 ff ff ff    	jne    80268a <devpipe_write+0x57>
+    return n;
+  802715:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802719:	eb 05                	jmp    802720 <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  80271b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802720:	48 83 c4 18          	add    $0x18,%rsp
+  802724:	5b                   	pop    %rbx
+  802725:	41 5c                	pop    %r12
+  802727:	41 5d                	pop    %r13
+  802729:	41 5e                	pop    %r14
+  80272b:	41 5f                	pop    %r15
+  80272d:	5d                   	pop    %rbp
+  80272e:	c3                   	ret
+
+000000000080272f <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  80272f:	55                   	push   %rbp
+  802730:	48 89 e5             	mov    %rsp,%rbp
+  802733:	41 57                	push   %r15
+  802735:	41 56                	push   %r14
+  802737:	41 55                	push   %r13
+  802739:	41 54                	push   %r12
+  80273b:	53                   	push   %rbx
+  80273c:	48 83 ec 18          	sub    $0x18,%rsp
+  802740:	49 89 fc             	mov    %rdi,%r12
+  802743:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  802747:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80274b:	48 b8 fb 19 80 00 00 	movabs $0x8019fb,%rax
+  802752:	00 00 00 
+  802755:	ff d0                	call   *%rax
+  802757:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  80275a:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802760:	49 bd 1e 14 80 00 00 	movabs $0x80141e,%r13
+  802767:	00 00 00 
+            sys_yield();
+  80276a:	49 be bb 13 80 00 00 	movabs $0x8013bb,%r14
+  802771:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  802774:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  802779:	74 7d                	je     8027f8 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  80277b:	8b 03                	mov    (%rbx),%eax
+  80277d:	3b 43 04             	cmp    0x4(%rbx),%eax
+  802780:	75 26                	jne    8027a8 <devpipe_read+0x79>
+            if (i > 0) return i;
+  802782:	4d 85 ff             	test   %r15,%r15
+  802785:	75 77                	jne    8027fe <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802787:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80278c:	48 89 da             	mov    %rbx,%rdx
+  80278f:	be 00 10 00 00       	mov    $0x1000,%esi
+  802794:	4c 89 e7             	mov    %r12,%rdi
+  802797:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  80279a:	85 c0                	test   %eax,%eax
+  80279c:	74 72                	je     802810 <devpipe_read+0xe1>
+            sys_yield();
+  80279e:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  8027a1:	8b 03                	mov    (%rbx),%eax
+  8027a3:	3b 43 04             	cmp    0x4(%rbx),%eax
+  8027a6:	74 df                	je     802787 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  8027a8:	48 63 c8             	movslq %eax,%rcx
+  8027ab:	48 89 ca             	mov    %rcx,%rdx
+  8027ae:	48 c1 ea 03          	shr    $0x3,%rdx
+  8027b2:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  8027b9:	08 10 20 
+  8027bc:	48 89 d0             	mov    %rdx,%rax
+  8027bf:	48 f7 e6             	mul    %rsi
+  8027c2:	48 c1 ea 06          	shr    $0x6,%rdx
+  8027c6:	48 89 d0             	mov    %rdx,%rax
+  8027c9:	48 c1 e0 09          	shl    $0x9,%rax
+  8027cd:	48 29 d0             	sub    %rdx,%rax
+  8027d0:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  8027d7:	00 
+  8027d8:	48 89 c8             	mov    %rcx,%rax
+  8027db:	48 29 d0             	sub    %rdx,%rax
+  8027de:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  8027e3:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8027e7:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  8027eb:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8027ee:	49 83 c7 01          	add    $0x1,%r15
+  8027f2:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  8027f6:	75 83                	jne    80277b <devpipe_read+0x4c>
+    return n;
+  8027f8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8027fc:	eb 03                	jmp    802801 <devpipe_read+0xd2>
+            if (i > 0) return i;
+  8027fe:	4c 89 f8             	mov    %r15,%rax
+}
+  802801:	48 83 c4 18          	add    $0x18,%rsp
+  802805:	5b                   	pop    %rbx
+  802806:	41 5c                	pop    %r12
+  802808:	41 5d                	pop    %r13
+  80280a:	41 5e                	pop    %r14
+  80280c:	41 5f                	pop    %r15
+  80280e:	5d                   	pop    %rbp
+  80280f:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  802810:	b8 00 00 00 00       	mov    $0x0,%eax
+  802815:	eb ea                	jmp    802801 <devpipe_read+0xd2>
+
+0000000000802817 <pipe>:
+pipe(int pfd[2]) {
+  802817:	55                   	push   %rbp
+  802818:	48 89 e5             	mov    %rsp,%rbp
+  80281b:	41 55                	push   %r13
+  80281d:	41 54                	push   %r12
+  80281f:	53                   	push   %rbx
+  802820:	48 81 ec b8 00 00 00 	sub    $0xb8,%rsp
+  802827:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  80282a:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  80282e:	48 b8 90 1a 80 00 00 	movabs $0x801a90,%rax
+  802835:	00 00 00 
+  802838:	ff d0                	call   *%rax
+  80283a:	89 c3                	mov    %eax,%ebx
+  80283c:	85 c0                	test   %eax,%eax
+  80283e:	0f 88 51 01 00 00    	js     802995 <pipe+0x17e>
+        (res = fd_alloc_from(fd2num(fd0) + 1, &fd1)) < 0) goto err;
+  802844:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802848:	48 b8 e9 19 80 00 00 	movabs $0x8019e9,%rax
+  80284f:	00 00 00 
+  802852:	ff d0                	call   *%rax
+  802854:	8d 78 01             	lea    0x1(%rax),%edi
+  802857:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80285b:	48 b8 17 1a 80 00 00 	movabs $0x801a17,%rax
+  802862:	00 00 00 
+  802865:	ff d0                	call   *%rax
+  802867:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  802869:	85 c0                	test   %eax,%eax
+  80286b:	0f 88 24 01 00 00    	js     802995 <pipe+0x17e>
+    va = fd2data(fd0);
+  802871:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802875:	48 bb fb 19 80 00 00 	movabs $0x8019fb,%rbx
+  80287c:	00 00 00 
+  80287f:	ff d3                	call   *%rbx
+  802881:	49 89 c5             	mov    %rax,%r13
+    struct RegionOp ops[] = {
+  802884:	48 8d bd 30 ff ff ff 	lea    -0xd0(%rbp),%rdi
+  80288b:	b9 14 00 00 00       	mov    $0x14,%ecx
+  802890:	b8 00 00 00 00       	mov    $0x0,%eax
+  802895:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+  802898:	c7 85 34 ff ff ff 46 	movl   $0x46,-0xcc(%rbp)
+  80289f:	00 00 00 
+  8028a2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8028a6:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+  8028ad:	48 c7 85 50 ff ff ff 	movq   $0x1000,-0xb0(%rbp)
+  8028b4:	00 10 00 00 
+  8028b8:	c7 85 5c ff ff ff 46 	movl   $0x46,-0xa4(%rbp)
+  8028bf:	00 00 00 
+            {.type = REGION_ALLOC, .dstva = (uintptr_t)fd1, .size = PAGE_SIZE, .perm = PROT_RW | PROT_SHARE},
+  8028c2:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+    struct RegionOp ops[] = {
+  8028c6:	48 89 bd 70 ff ff ff 	mov    %rdi,-0x90(%rbp)
+  8028cd:	48 c7 85 78 ff ff ff 	movq   $0x1000,-0x88(%rbp)
+  8028d4:	00 10 00 00 
+  8028d8:	c7 45 84 46 00 00 00 	movl   $0x46,-0x7c(%rbp)
+  8028df:	4c 89 6d 98          	mov    %r13,-0x68(%rbp)
+  8028e3:	48 c7 45 a0 00 10 00 	movq   $0x1000,-0x60(%rbp)
+  8028ea:	00 
+  8028eb:	c7 45 a8 01 00 00 00 	movl   $0x1,-0x58(%rbp)
+  8028f2:	c7 45 ac 46 00 00 00 	movl   $0x46,-0x54(%rbp)
+  8028f9:	4c 89 6d b8          	mov    %r13,-0x48(%rbp)
+            {.type = REGION_MAP, .srcva = (uintptr_t)va, .dstva = (uintptr_t)fd2data(fd1), .size = PAGE_SIZE, .perm = PROT_RW | PROT_SHARE},
+  8028fd:	ff d3                	call   *%rbx
+    struct RegionOp ops[] = {
+  8028ff:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802903:	48 c7 45 c8 00 10 00 	movq   $0x1000,-0x38(%rbp)
+  80290a:	00 
+    if ((res = sys_region_batch(ops, sizeof ops / sizeof *ops)) < 0) goto err1;
+  80290b:	be 04 00 00 00       	mov    $0x4,%esi
+  802910:	48 8d bd 30 ff ff ff 	lea    -0xd0(%rbp),%rdi
+  802917:	48 b8 7d 15 80 00 00 	movabs $0x80157d,%rax
+  80291e:	00 00 00 
+  802921:	ff d0                	call   *%rax
+  802923:	89 c3                	mov    %eax,%ebx
+  802925:	85 c0                	test   %eax,%eax
+  802927:	0f 88 ad 00 00 00    	js     8029da <pipe+0x1c3>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  80292d:	be 00 10 00 00       	mov    $0x1000,%esi
+  802932:	4c 89 ef             	mov    %r13,%rdi
+  802935:	48 b8 ec 13 80 00 00 	movabs $0x8013ec,%rax
+  80293c:	00 00 00 
+  80293f:	ff d0                	call   *%rax
+  802941:	83 f8 02             	cmp    $0x2,%eax
+  802944:	75 5f                	jne    8029a5 <pipe+0x18e>
+    fd0->fd_dev_id = devpipe.dev_id;
+  802946:	a1 60 40 80 00 00 00 	movabs 0x804060,%eax
+  80294d:	00 00 
+  80294f:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802953:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  802955:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802959:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  802960:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  802964:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  802966:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80296a:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  802971:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802975:	48 bb e9 19 80 00 00 	movabs $0x8019e9,%rbx
+  80297c:	00 00 00 
+  80297f:	ff d3                	call   *%rbx
+  802981:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  802985:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  802989:	ff d3                	call   *%rbx
+  80298b:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  802990:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  802995:	89 d8                	mov    %ebx,%eax
+  802997:	48 81 c4 b8 00 00 00 	add    $0xb8,%rsp
+  80299e:	5b                   	pop    %rbx
+  80299f:	41 5c                	pop    %r12
+  8029a1:	41 5d                	pop    %r13
+  8029a3:	5d                   	pop    %rbp
+  8029a4:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8029a5:	48 b9 88 38 80 00 00 	movabs $0x803888,%rcx
+  8029ac:	00 00 00 
+  8029af:	48 ba 67 38 80 00 00 	movabs $0x803867,%rdx
+  8029b6:	00 00 00 
+  8029b9:	be 33 00 00 00       	mov    $0x33,%esi
+  8029be:	48 bf 7c 38 80 00 00 	movabs $0x80387c,%rdi
+  8029c5:	00 00 00 
+  8029c8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029cd:	49 b8 25 04 80 00 00 	movabs $0x800425,%r8
+  8029d4:	00 00 00 
+  8029d7:	41 ff d0             	call   *%r8
+        ops[i].type = REGION_UNMAP;
+  8029da:	c7 85 30 ff ff ff 02 	movl   $0x2,-0xd0(%rbp)
+  8029e1:	00 00 00 
+  8029e4:	c7 85 58 ff ff ff 02 	movl   $0x2,-0xa8(%rbp)
+  8029eb:	00 00 00 
+  8029ee:	c7 45 80 02 00 00 00 	movl   $0x2,-0x80(%rbp)
+  8029f5:	c7 45 a8 02 00 00 00 	movl   $0x2,-0x58(%rbp)
+    sys_region_batch(ops, sizeof ops / sizeof *ops);
+  8029fc:	be 04 00 00 00       	mov    $0x4,%esi
+  802a01:	48 8d bd 30 ff ff ff 	lea    -0xd0(%rbp),%rdi
+  802a08:	48 b8 7d 15 80 00 00 	movabs $0x80157d,%rax
+  802a0f:	00 00 00 
+  802a12:	ff d0                	call   *%rax
+  802a14:	e9 7c ff ff ff       	jmp    802995 <pipe+0x17e>
+
+0000000000802a19 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  802a19:	55                   	push   %rbp
+  802a1a:	48 89 e5             	mov    %rsp,%rbp
+  802a1d:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  802a21:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802a25:	48 b8 aa 1a 80 00 00 	movabs $0x801aaa,%rax
+  802a2c:	00 00 00 
+  802a2f:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802a31:	85 c0                	test   %eax,%eax
+  802a33:	78 35                	js     802a6a <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  802a35:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802a39:	48 b8 fb 19 80 00 00 	movabs $0x8019fb,%rax
+  802a40:	00 00 00 
+  802a43:	ff d0                	call   *%rax
+  802a45:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802a48:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802a4d:	be 00 10 00 00       	mov    $0x1000,%esi
+  802a52:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802a56:	48 b8 1e 14 80 00 00 	movabs $0x80141e,%rax
+  802a5d:	00 00 00 
+  802a60:	ff d0                	call   *%rax
+  802a62:	85 c0                	test   %eax,%eax
+  802a64:	0f 94 c0             	sete   %al
+  802a67:	0f b6 c0             	movzbl %al,%eax
+}
+  802a6a:	c9                   	leave
+  802a6b:	c3                   	ret
+
+0000000000802a6c <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  802a6c:	48 89 f8             	mov    %rdi,%rax
+  802a6f:	48 c1 e8 27          	shr    $0x27,%rax
+  802a73:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  802a7a:	01 00 00 
+  802a7d:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802a81:	f6 c2 01             	test   $0x1,%dl
+  802a84:	74 6d                	je     802af3 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  802a86:	48 89 f8             	mov    %rdi,%rax
+  802a89:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802a8d:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802a94:	01 00 00 
+  802a97:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802a9b:	f6 c2 01             	test   $0x1,%dl
+  802a9e:	74 62                	je     802b02 <get_uvpt_entry+0x96>
+  802aa0:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802aa7:	01 00 00 
+  802aaa:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802aae:	f6 c2 80             	test   $0x80,%dl
+  802ab1:	75 4f                	jne    802b02 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  802ab3:	48 89 f8             	mov    %rdi,%rax
+  802ab6:	48 c1 e8 15          	shr    $0x15,%rax
+  802aba:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802ac1:	01 00 00 
+  802ac4:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802ac8:	f6 c2 01             	test   $0x1,%dl
+  802acb:	74 44                	je     802b11 <get_uvpt_entry+0xa5>
+  802acd:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802ad4:	01 00 00 
+  802ad7:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802adb:	f6 c2 80             	test   $0x80,%dl
+  802ade:	75 31                	jne    802b11 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  802ae0:	48 c1 ef 0c          	shr    $0xc,%rdi
+  802ae4:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802aeb:	01 00 00 
+  802aee:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  802af2:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  802af3:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  802afa:	01 00 00 
+  802afd:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802b01:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  802b02:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802b09:	01 00 00 
+  802b0c:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802b10:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  802b11:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802b18:	01 00 00 
+  802b1b:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802b1f:	c3                   	ret
+
+0000000000802b20 <get_prot>:
+
+int
+get_prot(void *va) {
+  802b20:	55                   	push   %rbp
+  802b21:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  802b24:	48 b8 6c 2a 80 00 00 	movabs $0x802a6c,%rax
+  802b2b:	00 00 00 
+  802b2e:	ff d0                	call   *%rax
+  802b30:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  802b33:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  802b38:	89 c1                	mov    %eax,%ecx
+  802b3a:	83 c9 04             	or     $0x4,%ecx
+  802b3d:	f6 c2 01             	test   $0x1,%dl
+  802b40:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  802b43:	89 c1                	mov    %eax,%ecx
+  802b45:	83 c9 02             	or     $0x2,%ecx
+  802b48:	f6 c2 02             	test   $0x2,%dl
+  802b4b:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  802b4e:	89 c1                	mov    %eax,%ecx
+  802b50:	83 c9 01             	or     $0x1,%ecx
+  802b53:	48 85 d2             	test   %rdx,%rdx
+  802b56:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  802b59:	89 c1                	mov    %eax,%ecx
+  802b5b:	83 c9 40             	or     $0x40,%ecx
+  802b5e:	f6 c6 04             	test   $0x4,%dh
+  802b61:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  802b64:	5d                   	pop    %rbp
+  802b65:	c3                   	ret
+
+0000000000802b66 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  802b66:	55                   	push   %rbp
+  802b67:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  802b6a:	48 b8 6c 2a 80 00 00 	movabs $0x802a6c,%rax
+  802b71:	00 00 00 
+  802b74:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  802b76:	48 c1 e8 06          	shr    $0x6,%rax
+  802b7a:	83 e0 01             	and    $0x1,%eax
+}
+  802b7d:	5d                   	pop    %rbp
+  802b7e:	c3                   	ret
+
+0000000000802b7f <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  802b7f:	55                   	push   %rbp
+  802b80:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  802b83:	48 b8 6c 2a 80 00 00 	movabs $0x802a6c,%rax
+  802b8a:	00 00 00 
+  802b8d:	ff d0                	call   *%rax
+  802b8f:	83 e0 01             	and    $0x1,%eax
+}
+  802b92:	5d                   	pop    %rbp
+  802b93:	c3                   	ret
+
+0000000000802b94 <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  802b94:	55                   	push   %rbp
+  802b95:	48 89 e5             	mov    %rsp,%rbp
+  802b98:	41 57                	push   %r15
+  802b9a:	41 56                	push   %r14
+  802b9c:	41 55                	push   %r13
+  802b9e:	41 54                	push   %r12
+  802ba0:	53                   	push   %rbx
+  802ba1:	48 83 ec 38          	sub    $0x38,%rsp
+  802ba5:	49 89 f7             	mov    %rsi,%r15
+  802ba8:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+                    }
+                    continue;
+                }
+                for (int ptei = 0; ptei < PT_ENTRY_COUNT; ptei++) {
+                    uintptr_t pte_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, pdei, ptei, 0);
+                    pte_t pte = uvpt[VPT(pte_addr)];
+  802bae:	49 bd 00 00 00 00 00 	movabs $0x10000000000,%r13
+  802bb5:	01 00 00 
+  802bb8:	4d 89 e6             	mov    %r12,%r14
+  802bbb:	49 89 fc             	mov    %rdi,%r12
+  802bbe:	e9 19 01 00 00       	jmp    802cdc <foreach_shared_region+0x148>
+  802bc3:	48 89 5d b0          	mov    %rbx,-0x50(%rbp)
+  802bc7:	4c 89 75 a8          	mov    %r14,-0x58(%rbp)
+  802bcb:	eb 52                	jmp    802c1f <foreach_shared_region+0x8b>
+                for (int ptei = 0; ptei < PT_ENTRY_COUNT; ptei++) {
+  802bcd:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802bd4:	48 81 fb 00 00 20 00 	cmp    $0x200000,%rbx
+  802bdb:	74 2e                	je     802c0b <foreach_shared_region+0x77>
+                    uintptr_t pte_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, pdei, ptei, 0);
+  802bdd:	48 89 df             	mov    %rbx,%rdi
+  802be0:	4c 09 f7             	or     %r14,%rdi
+                    pte_t pte = uvpt[VPT(pte_addr)];
+  802be3:	48 89 f8             	mov    %rdi,%rax
+  802be6:	48 c1 e8 0c          	shr    $0xc,%rax
+  802bea:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+                    if ((pte & PTE_P) && (pte & PTE_SHARE)) {
+  802bef:	25 01 04 00 00       	and    $0x401,%eax
+  802bf4:	48 3d 01 04 00 00    	cmp    $0x401,%rax
+  802bfa:	75 d1                	jne    802bcd <foreach_shared_region+0x39>
+                        fun((void*)pte_addr, (void*)(pte_addr + PAGE_SIZE), arg);
+  802bfc:	48 8d b7 00 10 00 00 	lea    0x1000(%rdi),%rsi
+  802c03:	4c 89 fa             	mov    %r15,%rdx
+  802c06:	41 ff d4             	call   *%r12
+  802c09:	eb c2                	jmp    802bcd <foreach_shared_region+0x39>
+            for (int pdei = 0; pdei < PD_ENTRY_COUNT; pdei++) {
+  802c0b:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  802c12:	00 
+  802c13:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802c17:	48 3d 00 00 00 40    	cmp    $0x40000000,%rax
+  802c1d:	74 46                	je     802c65 <foreach_shared_region+0xd1>
+                uintptr_t pde_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, pdei, 0, 0);
+  802c1f:	4c 8b 75 c8          	mov    -0x38(%rbp),%r14
+  802c23:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802c27:	49 09 c6             	or     %rax,%r14
+                pde_t pde = uvpd[VPD(pde_addr)];
+  802c2a:	4c 89 f0             	mov    %r14,%rax
+  802c2d:	48 c1 e8 15          	shr    $0x15,%rax
+  802c31:	48 b9 00 00 00 80 00 	movabs $0x10080000000,%rcx
+  802c38:	01 00 00 
+  802c3b:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+                if (!(pde & PTE_P)) {
+  802c3f:	a8 01                	test   $0x1,%al
+  802c41:	74 c8                	je     802c0b <foreach_shared_region+0x77>
+                if (pde & PTE_PS) {
+  802c43:	48 89 c3             	mov    %rax,%rbx
+  802c46:	81 e3 80 00 00 00    	and    $0x80,%ebx
+  802c4c:	74 8f                	je     802bdd <foreach_shared_region+0x49>
+                    if (pde & PTE_SHARE) {
+  802c4e:	f6 c4 04             	test   $0x4,%ah
+  802c51:	74 b8                	je     802c0b <foreach_shared_region+0x77>
+                        fun((void*)pde_addr, (void*)(pde_addr + 1024 * 1024 * 2), arg);
+  802c53:	49 8d b6 00 00 20 00 	lea    0x200000(%r14),%rsi
+  802c5a:	4c 89 fa             	mov    %r15,%rdx
+  802c5d:	4c 89 f7             	mov    %r14,%rdi
+  802c60:	41 ff d4             	call   *%r12
+  802c63:	eb a6                	jmp    802c0b <foreach_shared_region+0x77>
+  802c65:	48 8b 5d b0          	mov    -0x50(%rbp),%rbx
+  802c69:	4c 8b 75 a8          	mov    -0x58(%rbp),%r14
+        for (int pdpei = 0; pdpei < PDP_ENTRY_COUNT; pdpei++) {
+  802c6d:	48 81 c3 00 00 00 40 	add    $0x40000000,%rbx
+  802c74:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802c7b:	00 00 00 
+  802c7e:	48 39 c3             	cmp    %rax,%rbx
+  802c81:	74 4c                	je     802ccf <foreach_shared_region+0x13b>
+            uintptr_t pdpe_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, 0, 0, 0);
+  802c83:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802c87:	48 09 d8             	or     %rbx,%rax
+  802c8a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+            pdpe_t pdpe = uvpdp[VPDP(pdpe_addr)];
+  802c8e:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802c92:	48 b9 00 00 40 80 00 	movabs $0x10080400000,%rcx
+  802c99:	01 00 00 
+  802c9c:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+            if (!(pdpe & PTE_P)) {
+  802ca0:	a8 01                	test   $0x1,%al
+  802ca2:	74 c9                	je     802c6d <foreach_shared_region+0xd9>
+            if (pdpe & PTE_PS) {
+  802ca4:	48 89 c1             	mov    %rax,%rcx
+  802ca7:	81 e1 80 00 00 00    	and    $0x80,%ecx
+  802cad:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  802cb1:	0f 84 0c ff ff ff    	je     802bc3 <foreach_shared_region+0x2f>
+                if (pdpe & PTE_SHARE) {
+  802cb7:	f6 c4 04             	test   $0x4,%ah
+  802cba:	74 b1                	je     802c6d <foreach_shared_region+0xd9>
+                    fun((void*)pdpe_addr, (void*)(pdpe_addr + 1024 * 1024 * 1024), arg); 
+  802cbc:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  802cc0:	48 8d b7 00 00 00 40 	lea    0x40000000(%rdi),%rsi
+  802cc7:	4c 89 fa             	mov    %r15,%rdx
+  802cca:	41 ff d4             	call   *%r12
+  802ccd:	eb 9e                	jmp    802c6d <foreach_shared_region+0xd9>
+    for (int pml4ei = 0; pml4ei < PML4_ENTRY_COUNT; pml4ei++) {
+  802ccf:	49 83 c6 01          	add    $0x1,%r14
+  802cd3:	49 81 fe 00 02 00 00 	cmp    $0x200,%r14
+  802cda:	74 24                	je     802d00 <foreach_shared_region+0x16c>
+        pml4e_t pml4e = uvpml4[VPML4(pml4_addr)];
+  802cdc:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  802ce3:	01 00 00 
+  802ce6:	4a 8b 04 f0          	mov    (%rax,%r14,8),%rax
+        if (!(pml4e & PTE_P)) {
+  802cea:	a8 01                	test   $0x1,%al
+  802cec:	74 e1                	je     802ccf <foreach_shared_region+0x13b>
+  802cee:	4c 89 f0             	mov    %r14,%rax
+  802cf1:	48 c1 e0 27          	shl    $0x27,%rax
+  802cf5:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  802cf9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802cfe:	eb 83                	jmp    802c83 <foreach_shared_region+0xef>
+            }
+        }
+    }
+    
+    return 0;
+}
+  802d00:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d05:	48 83 c4 38          	add    $0x38,%rsp
+  802d09:	5b                   	pop    %rbx
+  802d0a:	41 5c                	pop    %r12
+  802d0c:	41 5d                	pop    %r13
+  802d0e:	41 5e                	pop    %r14
+  802d10:	41 5f                	pop    %r15
+  802d12:	5d                   	pop    %rbp
+  802d13:	c3                   	ret
+
+0000000000802d14 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  802d14:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d19:	c3                   	ret
+
+0000000000802d1a <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  802d1a:	55                   	push   %rbp
+  802d1b:	48 89 e5             	mov    %rsp,%rbp
+  802d1e:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  802d21:	48 be ac 38 80 00 00 	movabs $0x8038ac,%rsi
+  802d28:	00 00 00 
+  802d2b:	48 b8 9a 0e 80 00 00 	movabs $0x800e9a,%rax
+  802d32:	00 00 00 
+  802d35:	ff d0                	call   *%rax
+    return 0;
+}
+  802d37:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d3c:	5d                   	pop    %rbp
+  802d3d:	c3                   	ret
+
+0000000000802d3e <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  802d3e:	55                   	push   %rbp
+  802d3f:	48 89 e5             	mov    %rsp,%rbp
+  802d42:	41 57                	push   %r15
+  802d44:	41 56                	push   %r14
+  802d46:	41 55                	push   %r13
+  802d48:	41 54                	push   %r12
+  802d4a:	53                   	push   %rbx
+  802d4b:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  802d52:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  802d59:	48 85 d2             	test   %rdx,%rdx
+  802d5c:	74 7a                	je     802dd8 <devcons_write+0x9a>
+  802d5e:	49 89 d6             	mov    %rdx,%r14
+  802d61:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802d67:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  802d6c:	49 bf 94 10 80 00 00 	movabs $0x801094,%r15
+  802d73:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  802d76:	4c 89 f3             	mov    %r14,%rbx
+  802d79:	48 29 f3             	sub    %rsi,%rbx
+  802d7c:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802d81:	48 39 c3             	cmp    %rax,%rbx
+  802d84:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  802d88:	4c 63 eb             	movslq %ebx,%r13
+  802d8b:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  802d92:	48 01 c6             	add    %rax,%rsi
+  802d95:	4c 89 ea             	mov    %r13,%rdx
+  802d98:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802d9f:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  802da2:	4c 89 ee             	mov    %r13,%rsi
+  802da5:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802dac:	48 b8 c1 12 80 00 00 	movabs $0x8012c1,%rax
+  802db3:	00 00 00 
+  802db6:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  802db8:	41 01 dc             	add    %ebx,%r12d
+  802dbb:	49 63 f4             	movslq %r12d,%rsi
+  802dbe:	4c 39 f6             	cmp    %r14,%rsi
+  802dc1:	72 b3                	jb     802d76 <devcons_write+0x38>
+    return res;
+  802dc3:	49 63 c4             	movslq %r12d,%rax
+}
+  802dc6:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  802dcd:	5b                   	pop    %rbx
+  802dce:	41 5c                	pop    %r12
+  802dd0:	41 5d                	pop    %r13
+  802dd2:	41 5e                	pop    %r14
+  802dd4:	41 5f                	pop    %r15
+  802dd6:	5d                   	pop    %rbp
+  802dd7:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  802dd8:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802dde:	eb e3                	jmp    802dc3 <devcons_write+0x85>
+
+0000000000802de0 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  802de0:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  802de3:	ba 00 00 00 00       	mov    $0x0,%edx
+  802de8:	48 85 c0             	test   %rax,%rax
+  802deb:	74 55                	je     802e42 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  802ded:	55                   	push   %rbp
+  802dee:	48 89 e5             	mov    %rsp,%rbp
+  802df1:	41 55                	push   %r13
+  802df3:	41 54                	push   %r12
+  802df5:	53                   	push   %rbx
+  802df6:	48 83 ec 08          	sub    $0x8,%rsp
+  802dfa:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  802dfd:	48 bb ee 12 80 00 00 	movabs $0x8012ee,%rbx
+  802e04:	00 00 00 
+  802e07:	49 bc bb 13 80 00 00 	movabs $0x8013bb,%r12
+  802e0e:	00 00 00 
+  802e11:	eb 03                	jmp    802e16 <devcons_read+0x36>
+  802e13:	41 ff d4             	call   *%r12
+  802e16:	ff d3                	call   *%rbx
+  802e18:	85 c0                	test   %eax,%eax
+  802e1a:	74 f7                	je     802e13 <devcons_read+0x33>
+    if (c < 0) return c;
+  802e1c:	48 63 d0             	movslq %eax,%rdx
+  802e1f:	78 13                	js     802e34 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  802e21:	ba 00 00 00 00       	mov    $0x0,%edx
+  802e26:	83 f8 04             	cmp    $0x4,%eax
+  802e29:	74 09                	je     802e34 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  802e2b:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  802e2f:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  802e34:	48 89 d0             	mov    %rdx,%rax
+  802e37:	48 83 c4 08          	add    $0x8,%rsp
+  802e3b:	5b                   	pop    %rbx
+  802e3c:	41 5c                	pop    %r12
+  802e3e:	41 5d                	pop    %r13
+  802e40:	5d                   	pop    %rbp
+  802e41:	c3                   	ret
+  802e42:	48 89 d0             	mov    %rdx,%rax
+  802e45:	c3                   	ret
+
+0000000000802e46 <cputchar>:
+cputchar(int ch) {
+  802e46:	55                   	push   %rbp
+  802e47:	48 89 e5             	mov    %rsp,%rbp
+  802e4a:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  802e4e:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  802e52:	be 01 00 00 00       	mov    $0x1,%esi
+  802e57:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  802e5b:	48 b8 c1 12 80 00 00 	movabs $0x8012c1,%rax
+  802e62:	00 00 00 
+  802e65:	ff d0                	call   *%rax
+}
+  802e67:	c9                   	leave
+  802e68:	c3                   	ret
+
+0000000000802e69 <getchar>:
+getchar(void) {
+  802e69:	55                   	push   %rbp
+  802e6a:	48 89 e5             	mov    %rsp,%rbp
+  802e6d:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  802e71:	ba 01 00 00 00       	mov    $0x1,%edx
+  802e76:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  802e7a:	bf 00 00 00 00       	mov    $0x0,%edi
+  802e7f:	48 b8 8d 1d 80 00 00 	movabs $0x801d8d,%rax
+  802e86:	00 00 00 
+  802e89:	ff d0                	call   *%rax
+  802e8b:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  802e8d:	85 c0                	test   %eax,%eax
+  802e8f:	78 06                	js     802e97 <getchar+0x2e>
+  802e91:	74 08                	je     802e9b <getchar+0x32>
+  802e93:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  802e97:	89 d0                	mov    %edx,%eax
+  802e99:	c9                   	leave
+  802e9a:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  802e9b:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  802ea0:	eb f5                	jmp    802e97 <getchar+0x2e>
+
+0000000000802ea2 <iscons>:
+iscons(int fdnum) {
+  802ea2:	55                   	push   %rbp
+  802ea3:	48 89 e5             	mov    %rsp,%rbp
+  802ea6:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  802eaa:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802eae:	48 b8 aa 1a 80 00 00 	movabs $0x801aaa,%rax
+  802eb5:	00 00 00 
+  802eb8:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802eba:	85 c0                	test   %eax,%eax
+  802ebc:	78 18                	js     802ed6 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  802ebe:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802ec2:	48 b8 a0 40 80 00 00 	movabs $0x8040a0,%rax
+  802ec9:	00 00 00 
+  802ecc:	8b 00                	mov    (%rax),%eax
+  802ece:	39 02                	cmp    %eax,(%rdx)
+  802ed0:	0f 94 c0             	sete   %al
+  802ed3:	0f b6 c0             	movzbl %al,%eax
+}
+  802ed6:	c9                   	leave
+  802ed7:	c3                   	ret
+
+0000000000802ed8 <opencons>:
+opencons(void) {
+  802ed8:	55                   	push   %rbp
+  802ed9:	48 89 e5             	mov    %rsp,%rbp
+  802edc:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802ee0:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  802ee4:	48 b8 90 1a 80 00 00 	movabs $0x801a90,%rax
+  802eeb:	00 00 00 
+  802eee:	ff d0                	call   *%rax
+  802ef0:	85 c0                	test   %eax,%eax
+  802ef2:	78 49                	js     802f3d <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  802ef4:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802ef9:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802efe:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  802f02:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f07:	48 b8 4a 14 80 00 00 	movabs $0x80144a,%rax
+  802f0e:	00 00 00 
+  802f11:	ff d0                	call   *%rax
+  802f13:	85 c0                	test   %eax,%eax
+  802f15:	78 26                	js     802f3d <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  802f17:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802f1b:	a1 a0 40 80 00 00 00 	movabs 0x8040a0,%eax
+  802f22:	00 00 
+  802f24:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  802f26:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802f2a:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  802f31:	48 b8 e9 19 80 00 00 	movabs $0x8019e9,%rax
+  802f38:	00 00 00 
+  802f3b:	ff d0                	call   *%rax
+}
+  802f3d:	c9                   	leave
+  802f3e:	c3                   	ret
+
+0000000000802f3f <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  802f3f:	55                   	push   %rbp
+  802f40:	48 89 e5             	mov    %rsp,%rbp
+  802f43:	41 55                	push   %r13
+  802f45:	41 54                	push   %r12
+  802f47:	53                   	push   %rbx
+  802f48:	48 83 ec 08          	sub    $0x8,%rsp
+  802f4c:	49 89 fc             	mov    %rdi,%r12
+  802f4f:	48 89 f7             	mov    %rsi,%rdi
+  802f52:	48 89 d3             	mov    %rdx,%rbx
+  802f55:	49 89 cd             	mov    %rcx,%r13
+    // LAB 9: Your code here:
+    int res = sys_ipc_recv(!pg ? (void*)MAX_USER_ADDRESS : pg, !size ? 0 : *size);
+  802f58:	be 00 00 00 00       	mov    $0x0,%esi
+  802f5d:	48 85 d2             	test   %rdx,%rdx
+  802f60:	74 03                	je     802f65 <ipc_recv+0x26>
+  802f62:	48 8b 32             	mov    (%rdx),%rsi
+  802f65:	48 85 ff             	test   %rdi,%rdi
+  802f68:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802f6f:	00 00 00 
+  802f72:	48 0f 44 f8          	cmove  %rax,%rdi
+  802f76:	48 b8 1c 18 80 00 00 	movabs $0x80181c,%rax
+  802f7d:	00 00 00 
+  802f80:	ff d0                	call   *%rax
+    if (res < 0) {
+  802f82:	85 c0                	test   %eax,%eax
+  802f84:	78 66                	js     802fec <ipc_recv+0xad>
+        if (size) {
+            *size = 0;
+        }
+        return res;
+    }
+    if (from_env_store) {
+  802f86:	4d 85 e4             	test   %r12,%r12
+  802f89:	74 14                	je     802f9f <ipc_recv+0x60>
+        *from_env_store = thisenv->env_ipc_from;
+  802f8b:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802f92:	00 00 00 
+  802f95:	8b 80 ac 01 00 00    	mov    0x1ac(%rax),%eax
+  802f9b:	41 89 04 24          	mov    %eax,(%r12)
+    }
+    if (perm_store) {
+  802f9f:	4d 85 ed             	test   %r13,%r13
+  802fa2:	74 14                	je     802fb8 <ipc_recv+0x79>
+        *perm_store = thisenv->env_ipc_perm;
+  802fa4:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802fab:	00 00 00 
+  802fae:	8b 80 b0 01 00 00    	mov    0x1b0(%rax),%eax
+  802fb4:	41 89 45 00          	mov    %eax,0x0(%r13)
+    }
+    if (size) {
+  802fb8:	48 85 db             	test   %rbx,%rbx
+  802fbb:	74 14                	je     802fd1 <ipc_recv+0x92>
+        *size = thisenv->env_ipc_maxsz;
+  802fbd:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802fc4:	00 00 00 
+  802fc7:	48 8b 80 a0 01 00 00 	mov    0x1a0(%rax),%rax
+  802fce:	48 89 03             	mov    %rax,(%rbx)
+    }
+    return thisenv->env_ipc_value;
+  802fd1:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802fd8:	00 00 00 
+  802fdb:	8b 80 a8 01 00 00    	mov    0x1a8(%rax),%eax
+}
+  802fe1:	48 83 c4 08          	add    $0x8,%rsp
+  802fe5:	5b                   	pop    %rbx
+  802fe6:	41 5c                	pop    %r12
+  802fe8:	41 5d                	pop    %r13
+  802fea:	5d                   	pop    %rbp
+  802feb:	c3                   	ret
+        if (from_env_store) {
+  802fec:	4d 85 e4             	test   %r12,%r12
+  802fef:	74 08                	je     802ff9 <ipc_recv+0xba>
+            *from_env_store = 0;
+  802ff1:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  802ff8:	00 
+        if (perm_store) {
+  802ff9:	4d 85 ed             	test   %r13,%r13
+  802ffc:	74 08                	je     803006 <ipc_recv+0xc7>
+            *perm_store = 0;
+  802ffe:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  803005:	00 
+        if (size) {
+  803006:	48 85 db             	test   %rbx,%rbx
+  803009:	74 d6                	je     802fe1 <ipc_recv+0xa2>
+            *size = 0;
+  80300b:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  803012:	eb cd                	jmp    802fe1 <ipc_recv+0xa2>
+
+0000000000803014 <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  803014:	55                   	push   %rbp
+  803015:	48 89 e5             	mov    %rsp,%rbp
+  803018:	41 57                	push   %r15
+  80301a:	41 56                	push   %r14
+  80301c:	41 55                	push   %r13
+  80301e:	41 54                	push   %r12
+  803020:	53                   	push   %rbx
+  803021:	48 83 ec 18          	sub    $0x18,%rsp
+  803025:	41 89 fd             	mov    %edi,%r13d
+  803028:	89 75 cc             	mov    %esi,-0x34(%rbp)
+  80302b:	49 89 cc             	mov    %rcx,%r12
+  80302e:	44 89 45 c8          	mov    %r8d,-0x38(%rbp)
+    // LAB 9: Your code here:
+    int res = 0;
+    while ((res = sys_ipc_try_send(to_env, val, !pg ? (void*)MAX_USER_ADDRESS : pg, size, perm)) < 0) {
+  803032:	48 85 d2             	test   %rdx,%rdx
+  803035:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80303c:	00 00 00 
+  80303f:	48 0f 45 c2          	cmovne %rdx,%rax
+  803043:	48 89 c3             	mov    %rax,%rbx
+  803046:	49 be f0 17 80 00 00 	movabs $0x8017f0,%r14
+  80304d:	00 00 00 
+        if (res != -E_IPC_NOT_RECV) {
+            panic("sys_ipc_try_send failed: %i", res);
+        }
+        sys_yield();
+  803050:	49 bf bb 13 80 00 00 	movabs $0x8013bb,%r15
+  803057:	00 00 00 
+    while ((res = sys_ipc_try_send(to_env, val, !pg ? (void*)MAX_USER_ADDRESS : pg, size, perm)) < 0) {
+  80305a:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  80305d:	44 8b 45 c8          	mov    -0x38(%rbp),%r8d
+  803061:	4c 89 e1             	mov    %r12,%rcx
+  803064:	48 89 da             	mov    %rbx,%rdx
+  803067:	44 89 ef             	mov    %r13d,%edi
+  80306a:	41 ff d6             	call   *%r14
+  80306d:	85 c0                	test   %eax,%eax
+  80306f:	79 37                	jns    8030a8 <ipc_send+0x94>
+        if (res != -E_IPC_NOT_RECV) {
+  803071:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  803074:	75 05                	jne    80307b <ipc_send+0x67>
+        sys_yield();
+  803076:	41 ff d7             	call   *%r15
+  803079:	eb df                	jmp    80305a <ipc_send+0x46>
+            panic("sys_ipc_try_send failed: %i", res);
+  80307b:	89 c1                	mov    %eax,%ecx
+  80307d:	48 ba b8 38 80 00 00 	movabs $0x8038b8,%rdx
+  803084:	00 00 00 
+  803087:	be 40 00 00 00       	mov    $0x40,%esi
+  80308c:	48 bf d4 38 80 00 00 	movabs $0x8038d4,%rdi
+  803093:	00 00 00 
+  803096:	b8 00 00 00 00       	mov    $0x0,%eax
+  80309b:	49 b8 25 04 80 00 00 	movabs $0x800425,%r8
+  8030a2:	00 00 00 
+  8030a5:	41 ff d0             	call   *%r8
+    }
+    return;
+}
+  8030a8:	48 83 c4 18          	add    $0x18,%rsp
+  8030ac:	5b                   	pop    %rbx
+  8030ad:	41 5c                	pop    %r12
+  8030af:	41 5d                	pop    %r13
+  8030b1:	41 5e                	pop    %r14
+  8030b3:	41 5f                	pop    %r15
+  8030b5:	5d                   	pop    %rbp
+  8030b6:	c3                   	ret
+
+00000000008030b7 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  8030b7:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  8030bc:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  8030c3:	00 00 00 
+  8030c6:	48 69 d0 d0 01 00 00 	imul   $0x1d0,%rax,%rdx
+  8030cd:	48 01 ca             	add    %rcx,%rdx
+  8030d0:	8b 92 e8 00 00 00    	mov    0xe8(%rdx),%edx
+  8030d6:	39 fa                	cmp    %edi,%edx
+  8030d8:	74 12                	je     8030ec <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  8030da:	48 83 c0 01          	add    $0x1,%rax
+  8030de:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  8030e4:	75 e0                	jne    8030c6 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  8030e6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8030eb:	c3                   	ret
+            return envs[i].env_id;
+  8030ec:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+  8030f3:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8030fa:	00 00 00 
+  8030fd:	48 01 d0             	add    %rdx,%rax
+  803100:	8b 80 e0 00 00 00    	mov    0xe0(%rax),%eax
+  803106:	c3                   	ret
+  803107:	90                   	nop
+
+0000000000803108 <__rodata_start>:
+  803108:	70 72                	jo     80317c <__rodata_start+0x74>
+  80310a:	69 6d 65 70 72 6f 63 	imul   $0x636f7270,0x65(%rbp),%ebp
+  803111:	20 63 6f             	and    %ah,0x6f(%rbx)
+  803114:	75 6c                	jne    803182 <__rodata_start+0x7a>
+  803116:	64 20 6e 6f          	and    %ch,%fs:0x6f(%rsi)
+  80311a:	74 20                	je     80313c <__rodata_start+0x34>
+  80311c:	72 65                	jb     803183 <__rodata_start+0x7b>
+  80311e:	61                   	(bad)
+  80311f:	64 20 69 6e          	and    %ch,%fs:0x6e(%rcx)
+  803123:	69 74 69 61 6c 20 70 	imul   $0x7270206c,0x61(%rcx,%rbp,2),%esi
+  80312a:	72 
+  80312b:	69 6d 65 3a 20 25 64 	imul   $0x6425203a,0x65(%rbp),%ebp
+  803132:	2c 20                	sub    $0x20,%al
+  803134:	25 69 00 75 73       	and    $0x73750069,%eax
+  803139:	65 72 2f             	gs jb  80316b <__rodata_start+0x63>
+  80313c:	70 72                	jo     8031b0 <__rodata_start+0xa8>
+  80313e:	69 6d 65 73 70 69 70 	imul   $0x70697073,0x65(%rbp),%ebp
+  803145:	65 2e 63 00          	gs movsxd %gs:(%rax),%eax
+  803149:	25 64 0a 00 70       	and    $0x70000a64,%eax
+  80314e:	69 70 65 3a 20 25 69 	imul   $0x6925203a,0x65(%rax),%esi
+  803155:	00 66 6f             	add    %ah,0x6f(%rsi)
+  803158:	72 6b                	jb     8031c5 <__rodata_start+0xbd>
+  80315a:	3a 20                	cmp    (%rax),%ah
+  80315c:	25 69 00 70 72       	and    $0x72700069,%eax
+  803161:	69 6d 65 70 72 6f 63 	imul   $0x636f7270,0x65(%rbp),%ebp
+  803168:	20 25 64 20 72 65    	and    %ah,0x65722064(%rip)        # 65f251d2 <__bss_end+0x6571d1d2>
+  80316e:	61                   	(bad)
+  80316f:	64 6e                	outsb  %fs:(%rsi),(%dx)
+  803171:	20 25 64 20 25 64    	and    %ah,0x64252064(%rip)        # 64a551db <__bss_end+0x6424d1db>
+  803177:	20 25 69 00 70 72    	and    %ah,0x72700069(%rip)        # 72f031e6 <__bss_end+0x726fb1e6>
+  80317d:	69 6d 65 70 72 6f 63 	imul   $0x636f7270,0x65(%rbp),%ebp
+  803184:	20 25 64 20 77 72    	and    %ah,0x72772064(%rip)        # 72f751ee <__bss_end+0x7276d1ee>
+  80318a:	69 74 65 3a 20 25 64 	imul   $0x20642520,0x3a(%rbp,%riz,2),%esi
+  803191:	20 
+  803192:	25 69 00 70 72       	and    $0x72700069,%eax
+  803197:	69 6d 65 73 70 69 70 	imul   $0x70697073,0x65(%rbp),%ebp
+  80319e:	65 00 67 65          	add    %ah,%gs:0x65(%rdi)
+  8031a2:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8031a3:	65 72 61             	gs jb  803207 <__rodata_start+0xff>
+  8031a6:	74 6f                	je     803217 <__rodata_start+0x10f>
+  8031a8:	72 20                	jb     8031ca <__rodata_start+0xc2>
+  8031aa:	77 72                	ja     80321e <__rodata_start+0x116>
+  8031ac:	69 74 65 3a 20 25 64 	imul   $0x2c642520,0x3a(%rbp,%riz,2),%esi
+  8031b3:	2c 
+  8031b4:	20 25 69 00 3c 75    	and    %ah,0x753c0069(%rip)        # 75bc3223 <__bss_end+0x753bb223>
+  8031ba:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8031bb:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  8031bf:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8031c0:	3e 00 66 0f          	ds add %ah,0xf(%rsi)
+  8031c4:	1f                   	(bad)
+  8031c5:	44 00 00             	add    %r8b,(%rax)
+  8031c8:	5b                   	pop    %rbx
+  8031c9:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  8031ce:	20 75 73             	and    %dh,0x73(%rbp)
+  8031d1:	65 72 20             	gs jb  8031f4 <__rodata_start+0xec>
+  8031d4:	70 61                	jo     803237 <__rodata_start+0x12f>
+  8031d6:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8031d7:	69 63 20 69 6e 20 25 	imul   $0x25206e69,0x20(%rbx),%esp
+  8031de:	73 20                	jae    803200 <__rodata_start+0xf8>
+  8031e0:	61                   	(bad)
+  8031e1:	74 20                	je     803203 <__rodata_start+0xfb>
+  8031e3:	25 73 3a 25 64       	and    $0x64253a73,%eax
+  8031e8:	3a 20                	cmp    (%rax),%ah
+  8031ea:	00 30                	add    %dh,(%rax)
+  8031ec:	31 32                	xor    %esi,(%rdx)
+  8031ee:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  8031f5:	41                   	rex.B
+  8031f6:	42                   	rex.X
+  8031f7:	43                   	rex.XB
+  8031f8:	44                   	rex.R
+  8031f9:	45                   	rex.RB
+  8031fa:	46 00 30             	rex.RX add %r14b,(%rax)
+  8031fd:	31 32                	xor    %esi,(%rdx)
+  8031ff:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  803206:	61                   	(bad)
+  803207:	62 63 64 65 66       	(bad)
+  80320c:	00 28                	add    %ch,(%rax)
+  80320e:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80320f:	75 6c                	jne    80327d <__rodata_start+0x175>
+  803211:	6c                   	insb   (%dx),%es:(%rdi)
+  803212:	29 00                	sub    %eax,(%rax)
+  803214:	65 72 72             	gs jb  803289 <__rodata_start+0x181>
+  803217:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803218:	72 20                	jb     80323a <__rodata_start+0x132>
+  80321a:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  80321f:	73 70                	jae    803291 <__rodata_start+0x189>
+  803221:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  803225:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  80322c:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80322d:	72 00                	jb     80322f <__rodata_start+0x127>
+  80322f:	62 61 64 20 65       	(bad)
+  803234:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803235:	76 69                	jbe    8032a0 <__rodata_start+0x198>
+  803237:	72 6f                	jb     8032a8 <__rodata_start+0x1a0>
+  803239:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80323a:	6d                   	insl   (%dx),%es:(%rdi)
+  80323b:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  80323d:	74 00                	je     80323f <__rodata_start+0x137>
+  80323f:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  803246:	20 70 61             	and    %dh,0x61(%rax)
+  803249:	72 61                	jb     8032ac <__rodata_start+0x1a4>
+  80324b:	6d                   	insl   (%dx),%es:(%rdi)
+  80324c:	65 74 65             	gs je  8032b4 <__rodata_start+0x1ac>
+  80324f:	72 00                	jb     803251 <__rodata_start+0x149>
+  803251:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803252:	75 74                	jne    8032c8 <__rodata_start+0x1c0>
+  803254:	20 6f 66             	and    %ch,0x66(%rdi)
+  803257:	20 6d 65             	and    %ch,0x65(%rbp)
+  80325a:	6d                   	insl   (%dx),%es:(%rdi)
+  80325b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80325c:	72 79                	jb     8032d7 <__rodata_start+0x1cf>
+  80325e:	00 6f 75             	add    %ch,0x75(%rdi)
+  803261:	74 20                	je     803283 <__rodata_start+0x17b>
+  803263:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803264:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  803268:	76 69                	jbe    8032d3 <__rodata_start+0x1cb>
+  80326a:	72 6f                	jb     8032db <__rodata_start+0x1d3>
+  80326c:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80326d:	6d                   	insl   (%dx),%es:(%rdi)
+  80326e:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803270:	74 73                	je     8032e5 <__rodata_start+0x1dd>
+  803272:	00 63 6f             	add    %ah,0x6f(%rbx)
+  803275:	72 72                	jb     8032e9 <__rodata_start+0x1e1>
+  803277:	75 70                	jne    8032e9 <__rodata_start+0x1e1>
+  803279:	74 65                	je     8032e0 <__rodata_start+0x1d8>
+  80327b:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  803280:	75 67                	jne    8032e9 <__rodata_start+0x1e1>
+  803282:	20 69 6e             	and    %ch,0x6e(%rcx)
+  803285:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  803287:	00 73 65             	add    %dh,0x65(%rbx)
+  80328a:	67 6d                	insl   (%dx),%es:(%edi)
+  80328c:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  80328e:	74 61                	je     8032f1 <__rodata_start+0x1e9>
+  803290:	74 69                	je     8032fb <__rodata_start+0x1f3>
+  803292:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803293:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803294:	20 66 61             	and    %ah,0x61(%rsi)
+  803297:	75 6c                	jne    803305 <__rodata_start+0x1fd>
+  803299:	74 00                	je     80329b <__rodata_start+0x193>
+  80329b:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  8032a2:	20 45 4c             	and    %al,0x4c(%rbp)
+  8032a5:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  8032a9:	61                   	(bad)
+  8032aa:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  8032af:	20 73 75             	and    %dh,0x75(%rbx)
+  8032b2:	63 68 20             	movsxd 0x20(%rax),%ebp
+  8032b5:	73 79                	jae    803330 <__rodata_start+0x228>
+  8032b7:	73 74                	jae    80332d <__rodata_start+0x225>
+  8032b9:	65 6d                	gs insl (%dx),%es:(%rdi)
+  8032bb:	20 63 61             	and    %ah,0x61(%rbx)
+  8032be:	6c                   	insb   (%dx),%es:(%rdi)
+  8032bf:	6c                   	insb   (%dx),%es:(%rdi)
+  8032c0:	00 65 6e             	add    %ah,0x6e(%rbp)
+  8032c3:	74 72                	je     803337 <__rodata_start+0x22f>
+  8032c5:	79 20                	jns    8032e7 <__rodata_start+0x1df>
+  8032c7:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8032c8:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8032c9:	74 20                	je     8032eb <__rodata_start+0x1e3>
+  8032cb:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  8032cd:	75 6e                	jne    80333d <__rodata_start+0x235>
+  8032cf:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  8032d3:	76 20                	jbe    8032f5 <__rodata_start+0x1ed>
+  8032d5:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  8032dc:	72 65                	jb     803343 <__rodata_start+0x23b>
+  8032de:	63 76 69             	movsxd 0x69(%rsi),%esi
+  8032e1:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8032e2:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  8032e6:	65 78 70             	gs js  803359 <__rodata_start+0x251>
+  8032e9:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  8032ee:	20 65 6e             	and    %ah,0x6e(%rbp)
+  8032f1:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  8032f5:	20 66 69             	and    %ah,0x69(%rsi)
+  8032f8:	6c                   	insb   (%dx),%es:(%rdi)
+  8032f9:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  8032fd:	20 66 72             	and    %ah,0x72(%rsi)
+  803300:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  803305:	61                   	(bad)
+  803306:	63 65 20             	movsxd 0x20(%rbp),%esp
+  803309:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80330a:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80330b:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  80330f:	6b 00 74             	imul   $0x74,(%rax),%eax
+  803312:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803313:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803314:	20 6d 61             	and    %ch,0x61(%rbp)
+  803317:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803318:	79 20                	jns    80333a <__rodata_start+0x232>
+  80331a:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  803321:	72 65                	jb     803388 <__rodata_start+0x280>
+  803323:	20 6f 70             	and    %ch,0x70(%rdi)
+  803326:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803328:	00 66 69             	add    %ah,0x69(%rsi)
+  80332b:	6c                   	insb   (%dx),%es:(%rdi)
+  80332c:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  803330:	20 62 6c             	and    %ah,0x6c(%rdx)
+  803333:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803334:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  803337:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803338:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803339:	74 20                	je     80335b <__rodata_start+0x253>
+  80333b:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  80333d:	75 6e                	jne    8033ad <__rodata_start+0x2a5>
+  80333f:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  803343:	76 61                	jbe    8033a6 <__rodata_start+0x29e>
+  803345:	6c                   	insb   (%dx),%es:(%rdi)
+  803346:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  80334d:	00 
+  80334e:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  803355:	72 65                	jb     8033bc <__rodata_start+0x2b4>
+  803357:	61                   	(bad)
+  803358:	64 79 20             	fs jns 80337b <__rodata_start+0x273>
+  80335b:	65 78 69             	gs js  8033c7 <__rodata_start+0x2bf>
+  80335e:	73 74                	jae    8033d4 <__rodata_start+0x2cc>
+  803360:	73 00                	jae    803362 <__rodata_start+0x25a>
+  803362:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803363:	70 65                	jo     8033ca <__rodata_start+0x2c2>
+  803365:	72 61                	jb     8033c8 <__rodata_start+0x2c0>
+  803367:	74 69                	je     8033d2 <__rodata_start+0x2ca>
+  803369:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80336a:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80336b:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  80336e:	74 20                	je     803390 <__rodata_start+0x288>
+  803370:	73 75                	jae    8033e7 <__rodata_start+0x2df>
+  803372:	70 70                	jo     8033e4 <__rodata_start+0x2dc>
+  803374:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803375:	72 74                	jb     8033eb <__rodata_start+0x2e3>
+  803377:	65 64 00 6f 70       	gs add %ch,%fs:0x70(%rdi)
+  80337c:	65 72 61             	gs jb  8033e0 <__rodata_start+0x2d8>
+  80337f:	74 69                	je     8033ea <__rodata_start+0x2e2>
+  803381:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803382:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803383:	20 69 6e             	and    %ch,0x6e(%rcx)
+  803386:	74 65                	je     8033ed <__rodata_start+0x2e5>
+  803388:	72 72                	jb     8033fc <__rodata_start+0x2f4>
+  80338a:	75 70                	jne    8033fc <__rodata_start+0x2f4>
+  80338c:	74 65                	je     8033f3 <__rodata_start+0x2eb>
+  80338e:	64 00 6e 6f          	add    %ch,%fs:0x6f(%rsi)
+  803392:	74 20                	je     8033b4 <__rodata_start+0x2ac>
+  803394:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803396:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803397:	75 67                	jne    803400 <__rodata_start+0x2f8>
+  803399:	68 20 43 50 55       	push   $0x55504320
+  80339e:	20 74 69 6d          	and    %dh,0x6d(%rcx,%rbp,2)
+  8033a2:	65 00 66 2e          	add    %ah,%gs:0x2e(%rsi)
+  8033a6:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+  8033ad:	00 
+  8033ae:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8033b5:	00 00 00 
+  8033b8:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+  8033bf:	00 
+  8033c0:	62                   	(bad)
+  8033c1:	07                   	(bad)
+  8033c2:	80 00 00             	addb   $0x0,(%rax)
+  8033c5:	00 00                	add    %al,(%rax)
+  8033c7:	00 a3 0d 80 00 00    	add    %ah,0x800d(%rbx)
+  8033cd:	00 00                	add    %al,(%rax)
+  8033cf:	00 93 0d 80 00 00    	add    %dl,0x800d(%rbx)
+  8033d5:	00 00                	add    %al,(%rax)
+  8033d7:	00 a3 0d 80 00 00    	add    %ah,0x800d(%rbx)
+  8033dd:	00 00                	add    %al,(%rax)
+  8033df:	00 a3 0d 80 00 00    	add    %ah,0x800d(%rbx)
+  8033e5:	00 00                	add    %al,(%rax)
+  8033e7:	00 a3 0d 80 00 00    	add    %ah,0x800d(%rbx)
+  8033ed:	00 00                	add    %al,(%rax)
+  8033ef:	00 a3 0d 80 00 00    	add    %ah,0x800d(%rbx)
+  8033f5:	00 00                	add    %al,(%rax)
+  8033f7:	00 81 07 80 00 00    	add    %al,0x8007(%rcx)
+  8033fd:	00 00                	add    %al,(%rax)
+  8033ff:	00 a3 0d 80 00 00    	add    %ah,0x800d(%rbx)
+  803405:	00 00                	add    %al,(%rax)
+  803407:	00 a3 0d 80 00 00    	add    %ah,0x800d(%rbx)
+  80340d:	00 00                	add    %al,(%rax)
+  80340f:	00 75 07             	add    %dh,0x7(%rbp)
+  803412:	80 00 00             	addb   $0x0,(%rax)
+  803415:	00 00                	add    %al,(%rax)
+  803417:	00 ef                	add    %ch,%bh
+  803419:	07                   	(bad)
+  80341a:	80 00 00             	addb   $0x0,(%rax)
+  80341d:	00 00                	add    %al,(%rax)
+  80341f:	00 a3 0d 80 00 00    	add    %ah,0x800d(%rbx)
+  803425:	00 00                	add    %al,(%rax)
+  803427:	00 75 07             	add    %dh,0x7(%rbp)
+  80342a:	80 00 00             	addb   $0x0,(%rax)
+  80342d:	00 00                	add    %al,(%rax)
+  80342f:	00 bb 07 80 00 00    	add    %bh,0x8007(%rbx)
+  803435:	00 00                	add    %al,(%rax)
+  803437:	00 bb 07 80 00 00    	add    %bh,0x8007(%rbx)
+  80343d:	00 00                	add    %al,(%rax)
+  80343f:	00 bb 07 80 00 00    	add    %bh,0x8007(%rbx)
+  803445:	00 00                	add    %al,(%rax)
+  803447:	00 bb 07 80 00 00    	add    %bh,0x8007(%rbx)
+  80344d:	00 00                	add    %al,(%rax)
+  80344f:	00 bb 07 80 00 00    	add    %bh,0x8007(%rbx)
+  803455:	00 00                	add    %al,(%rax)
+  803457:	00 bb 07 80 00 00    	add    %bh,0x8007(%rbx)
+  80345d:	00 00                	add    %al,(%rax)
+  80345f:	00 bb 07 80 00 00    	add    %bh,0x8007(%rbx)
+  803465:	00 00                	add    %al,(%rax)
+  803467:	00 bb 07 80 00 00    	add    %bh,0x8007(%rbx)
+  80346d:	00 00                	add    %al,(%rax)
+  80346f:	00 bb 07 80 00 00    	add    %bh,0x8007(%rbx)
+  803475:	00 00                	add    %al,(%rax)
+  803477:	00 a3 0d 80 00 00    	add    %ah,0x800d(%rbx)
+  80347d:	00 00                	add    %al,(%rax)
+  80347f:	00 a3 0d 80 00 00    	add    %ah,0x800d(%rbx)
+  803485:	00 00                	add    %al,(%rax)
+  803487:	00 a3 0d 80 00 00    	add    %ah,0x800d(%rbx)
+  80348d:	00 00                	add    %al,(%rax)
+  80348f:	00 a3 0d 80 00 00    	add    %ah,0x800d(%rbx)
+  803495:	00 00                	add    %al,(%rax)
+  803497:	00 a3 0d 80 00 00    	add    %ah,0x800d(%rbx)
+  80349d:	00 00                	add    %al,(%rax)
+  80349f:	00 a3 0d 80 00 00    	add    %ah,0x800d(%rbx)
+  8034a5:	00 00                	add    %al,(%rax)
+  8034a7:	00 a3 0d 80 00 00    	add    %ah,0x800d(%rbx)
+  8034ad:	00 00                	add    %al,(%rax)
+  8034af:	00 a3 0d 80 00 00    	add    %ah,0x800d(%rbx)
+  8034b5:	00 00                	add    %al,(%rax)
+  8034b7:	00 a3 0d 80 00 00    	add    %ah,0x800d(%rbx)
+  8034bd:	00 00                	add    %al,(%rax)
+  8034bf:	00 a3 0d 80 00 00    	add    %ah,0x800d(%rbx)
+  8034c5:	00 00                	add    %al,(%rax)
+  8034c7:	00 a3 0d 80 00 00    	add    %ah,0x800d(%rbx)
+  8034cd:	00 00                	add    %al,(%rax)
+  8034cf:	00 a3 0d 80 00 00    	add    %ah,0x800d(%rbx)
+  8034d5:	00 00                	add    %al,(%rax)
+  8034d7:	00 a3 0d 80 00 00    	add    %ah,0x800d(%rbx)
+  8034dd:	00 00                	add    %al,(%rax)
+  8034df:	00 a3 0d 80 00 00    	add    %ah,0x800d(%rbx)
+  8034e5:	00 00                	add    %al,(%rax)
+  8034e7:	00 a3 0d 80 00 00    	add    %ah,0x800d(%rbx)
+  8034ed:	00 00                	add    %al,(%rax)
+  8034ef:	00 a3 0d 80 00 00    	add    %ah,0x800d(%rbx)
+  8034f5:	00 00                	add    %al,(%rax)
+  8034f7:	00 a3 0d 80 00 00    	add    %ah,0x800d(%rbx)
+  8034fd:	00 00                	add    %al,(%rax)
+  8034ff:	00 a3 0d 80 00 00    	add    %ah,0x800d(%rbx)
+  803505:	00 00                	add    %al,(%rax)
+  803507:	00 a3 0d 80 00 00    	add    %ah,0x800d(%rbx)
+  80350d:	00 00                	add    %al,(%rax)
+  80350f:	00 a3 0d 80 00 00    	add    %ah,0x800d(%rbx)
+  803515:	00 00                	add    %al,(%rax)
+  803517:	00 a3 0d 80 00 00    	add    %ah,0x800d(%rbx)
+  80351d:	00 00                	add    %al,(%rax)
+  80351f:	00 a3 0d 80 00 00    	add    %ah,0x800d(%rbx)
+  803525:	00 00                	add    %al,(%rax)
+  803527:	00 a3 0d 80 00 00    	add    %ah,0x800d(%rbx)
+  80352d:	00 00                	add    %al,(%rax)
+  80352f:	00 a3 0d 80 00 00    	add    %ah,0x800d(%rbx)
+  803535:	00 00                	add    %al,(%rax)
+  803537:	00 a3 0d 80 00 00    	add    %ah,0x800d(%rbx)
+  80353d:	00 00                	add    %al,(%rax)
+  80353f:	00 a3 0d 80 00 00    	add    %ah,0x800d(%rbx)
+  803545:	00 00                	add    %al,(%rax)
+  803547:	00 a3 0d 80 00 00    	add    %ah,0x800d(%rbx)
+  80354d:	00 00                	add    %al,(%rax)
+  80354f:	00 a3 0d 80 00 00    	add    %ah,0x800d(%rbx)
+  803555:	00 00                	add    %al,(%rax)
+  803557:	00 a3 0d 80 00 00    	add    %ah,0x800d(%rbx)
+  80355d:	00 00                	add    %al,(%rax)
+  80355f:	00 a3 0d 80 00 00    	add    %ah,0x800d(%rbx)
+  803565:	00 00                	add    %al,(%rax)
+  803567:	00 c6                	add    %al,%dh
+  803569:	0c 80                	or     $0x80,%al
+  80356b:	00 00                	add    %al,(%rax)
+  80356d:	00 00                	add    %al,(%rax)
+  80356f:	00 a3 0d 80 00 00    	add    %ah,0x800d(%rbx)
+  803575:	00 00                	add    %al,(%rax)
+  803577:	00 a3 0d 80 00 00    	add    %ah,0x800d(%rbx)
+  80357d:	00 00                	add    %al,(%rax)
+  80357f:	00 a3 0d 80 00 00    	add    %ah,0x800d(%rbx)
+  803585:	00 00                	add    %al,(%rax)
+  803587:	00 a3 0d 80 00 00    	add    %ah,0x800d(%rbx)
+  80358d:	00 00                	add    %al,(%rax)
+  80358f:	00 a3 0d 80 00 00    	add    %ah,0x800d(%rbx)
+  803595:	00 00                	add    %al,(%rax)
+  803597:	00 a3 0d 80 00 00    	add    %ah,0x800d(%rbx)
+  80359d:	00 00                	add    %al,(%rax)
+  80359f:	00 a3 0d 80 00 00    	add    %ah,0x800d(%rbx)
+  8035a5:	00 00                	add    %al,(%rax)
+  8035a7:	00 a3 0d 80 00 00    	add    %ah,0x800d(%rbx)
+  8035ad:	00 00                	add    %al,(%rax)
+  8035af:	00 a3 0d 80 00 00    	add    %ah,0x800d(%rbx)
+  8035b5:	00 00                	add    %al,(%rax)
+  8035b7:	00 a3 0d 80 00 00    	add    %ah,0x800d(%rbx)
+  8035bd:	00 00                	add    %al,(%rax)
+  8035bf:	00 12                	add    %dl,(%rdx)
+  8035c1:	08 80 00 00 00 00    	or     %al,0x0(%rax)
+  8035c7:	00 e1                	add    %ah,%cl
+  8035c9:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  8035cf:	00 a3 0d 80 00 00    	add    %ah,0x800d(%rbx)
+  8035d5:	00 00                	add    %al,(%rax)
+  8035d7:	00 a3 0d 80 00 00    	add    %ah,0x800d(%rbx)
+  8035dd:	00 00                	add    %al,(%rax)
+  8035df:	00 a3 0d 80 00 00    	add    %ah,0x800d(%rbx)
+  8035e5:	00 00                	add    %al,(%rax)
+  8035e7:	00 a3 0d 80 00 00    	add    %ah,0x800d(%rbx)
+  8035ed:	00 00                	add    %al,(%rax)
+  8035ef:	00 41 08             	add    %al,0x8(%rcx)
+  8035f2:	80 00 00             	addb   $0x0,(%rax)
+  8035f5:	00 00                	add    %al,(%rax)
+  8035f7:	00 a3 0d 80 00 00    	add    %ah,0x800d(%rbx)
+  8035fd:	00 00                	add    %al,(%rax)
+  8035ff:	00 a3 0d 80 00 00    	add    %ah,0x800d(%rbx)
+  803605:	00 00                	add    %al,(%rax)
+  803607:	00 07                	add    %al,(%rdi)
+  803609:	08 80 00 00 00 00    	or     %al,0x0(%rax)
+  80360f:	00 a3 0d 80 00 00    	add    %ah,0x800d(%rbx)
+  803615:	00 00                	add    %al,(%rax)
+  803617:	00 a3 0d 80 00 00    	add    %ah,0x800d(%rbx)
+  80361d:	00 00                	add    %al,(%rax)
+  80361f:	00 89 0b 80 00 00    	add    %cl,0x800b(%rcx)
+  803625:	00 00                	add    %al,(%rax)
+  803627:	00 53 0c             	add    %dl,0xc(%rbx)
+  80362a:	80 00 00             	addb   $0x0,(%rax)
+  80362d:	00 00                	add    %al,(%rax)
+  80362f:	00 a3 0d 80 00 00    	add    %ah,0x800d(%rbx)
+  803635:	00 00                	add    %al,(%rax)
+  803637:	00 a3 0d 80 00 00    	add    %ah,0x800d(%rbx)
+  80363d:	00 00                	add    %al,(%rax)
+  80363f:	00 d8                	add    %bl,%al
+  803641:	08 80 00 00 00 00    	or     %al,0x0(%rax)
+  803647:	00 a3 0d 80 00 00    	add    %ah,0x800d(%rbx)
+  80364d:	00 00                	add    %al,(%rax)
+  80364f:	00 b5 0a 80 00 00    	add    %dh,0x800a(%rbp)
+  803655:	00 00                	add    %al,(%rax)
+  803657:	00 a3 0d 80 00 00    	add    %ah,0x800d(%rbx)
+  80365d:	00 00                	add    %al,(%rax)
+  80365f:	00 a3 0d 80 00 00    	add    %ah,0x800d(%rbx)
+  803665:	00 00                	add    %al,(%rax)
+  803667:	00 c6                	add    %al,%dh
+  803669:	0c 80                	or     $0x80,%al
+  80366b:	00 00                	add    %al,(%rax)
+  80366d:	00 00                	add    %al,(%rax)
+  80366f:	00 a3 0d 80 00 00    	add    %ah,0x800d(%rbx)
+  803675:	00 00                	add    %al,(%rax)
+  803677:	00 6b 07             	add    %ch,0x7(%rbx)
+  80367a:	80 00 00             	addb   $0x0,(%rax)
+  80367d:	00 00                	add    %al,(%rax)
+	...
+
+0000000000803680 <error_string>:
+	...
+  803688:	1d 32 80 00 00 00 00 00 2f 32 80 00 00 00 00 00     .2....../2......
+  803698:	3f 32 80 00 00 00 00 00 51 32 80 00 00 00 00 00     ?2......Q2......
+  8036a8:	5f 32 80 00 00 00 00 00 73 32 80 00 00 00 00 00     _2......s2......
+  8036b8:	88 32 80 00 00 00 00 00 9b 32 80 00 00 00 00 00     .2.......2......
+  8036c8:	ad 32 80 00 00 00 00 00 c1 32 80 00 00 00 00 00     .2.......2......
+  8036d8:	d1 32 80 00 00 00 00 00 e4 32 80 00 00 00 00 00     .2.......2......
+  8036e8:	fb 32 80 00 00 00 00 00 11 33 80 00 00 00 00 00     .2.......3......
+  8036f8:	29 33 80 00 00 00 00 00 41 33 80 00 00 00 00 00     )3......A3......
+  803708:	4e 33 80 00 00 00 00 00 30 37 80 00 00 00 00 00     N3......07......
+  803718:	62 33 80 00 00 00 00 00 7a 33 80 00 00 00 00 00     b3......z3......
+  803728:	90 33 80 00 00 00 00 00 66 69 6c 65 20 69 73 20     .3......file is 
+  803738:	6e 6f 74 20 61 20 76 61 6c 69 64 20 65 78 65 63     not a valid exec
+  803748:	75 74 61 62 6c 65 00 90 73 79 73 63 61 6c 6c 20     utable..syscall 
+  803758:	25 7a 64 20 72 65 74 75 72 6e 65 64 20 25 7a 64     %zd returned %zd
+  803768:	20 28 3e 20 30 29 00 6c 69 62 2f 73 79 73 63 61      (> 0).lib/sysca
+  803778:	6c 6c 2e 63 00 46 6f 72 6b 20 64 6f 75 62 6c 65     ll.c.Fork double
+  803788:	20 66 61 75 6c 74 00 6c 69 62 2f 66 6f 72 6b 2e      fault.lib/fork.
+  803798:	63 00 73 66 6f 72 6b 28 29 20 69 73 20 6e 6f 74     c.sfork() is not
+  8037a8:	20 69 6d 70 6c 65 6d 65 6e 74 65 64 00 0f 1f 00      implemented....
+  8037b8:	5b 25 30 38 78 5d 20 75 6e 6b 6e 6f 77 6e 20 64     [%08x] unknown d
+  8037c8:	65 76 69 63 65 20 74 79 70 65 20 25 64 0a 00 00     evice type %d...
+  8037d8:	5b 25 30 38 78 5d 20 66 74 72 75 6e 63 61 74 65     [%08x] ftruncate
+  8037e8:	20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65 0a      %d -- bad mode.
+  8037f8:	00 5b 25 30 38 78 5d 20 72 65 61 64 20 25 64 20     .[%08x] read %d 
+  803808:	2d 2d 20 62 61 64 20 6d 6f 64 65 0a 00 5b 25 30     -- bad mode..[%0
+  803818:	38 78 5d 20 77 72 69 74 65 20 25 64 20 2d 2d 20     8x] write %d -- 
+  803828:	62 61 64 20 6d 6f 64 65 0a 00 66 2e 0f 1f 84 00     bad mode..f.....
+  803838:	00 00 00 00 0f 1f 40 00                             ......@.
+
+0000000000803840 <devtab>:
+  803840:	20 40 80 00 00 00 00 00 60 40 80 00 00 00 00 00      @......`@......
+  803850:	a0 40 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .@..............
+  803860:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  803870:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  803880:	70 69 70 65 2e 63 00 90 73 79 73 5f 72 65 67 69     pipe.c..sys_regi
+  803890:	6f 6e 5f 72 65 66 73 28 76 61 2c 20 50 41 47 45     on_refs(va, PAGE
+  8038a0:	5f 53 49 5a 45 29 20 3d 3d 20 32 00 3c 63 6f 6e     _SIZE) == 2.<con
+  8038b0:	73 3e 00 63 6f 6e 73 00 73 79 73 5f 69 70 63 5f     s>.cons.sys_ipc_
+  8038c0:	74 72 79 5f 73 65 6e 64 20 66 61 69 6c 65 64 3a     try_send failed:
+  8038d0:	20 25 69 00 6c 69 62 2f 69 70 63 2e 63 00 66 2e      %i.lib/ipc.c.f.
+  8038e0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8038f0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803900:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803910:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803920:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803930:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803940:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803950:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803960:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803970:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803980:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803990:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8039a0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8039b0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8039c0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8039d0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8039e0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8039f0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803a00:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803a10:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803a20:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803a30:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803a40:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803a50:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803a60:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803a70:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803a80:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803a90:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803aa0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803ab0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803ac0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803ad0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803ae0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803af0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803b00:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803b10:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803b20:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803b30:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803b40:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803b50:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803b60:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803b70:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803b80:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803b90:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803ba0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803bb0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803bc0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803bd0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803be0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803bf0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803c00:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803c10:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803c20:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803c30:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803c40:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803c50:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803c60:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803c70:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803c80:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803c90:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803ca0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803cb0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803cc0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803cd0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803ce0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803cf0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803d00:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803d10:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803d20:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803d30:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803d40:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803d50:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803d60:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803d70:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803d80:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803d90:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803da0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803db0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803dc0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803dd0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803de0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803df0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803e00:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803e10:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803e20:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803e30:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803e40:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803e50:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803e60:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803e70:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803e80:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803e90:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803ea0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803eb0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803ec0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803ed0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803ee0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803ef0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803f00:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803f10:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803f20:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803f30:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803f40:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803f50:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803f60:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803f70:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803f80:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803f90:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803fa0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803fb0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803fc0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803fd0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803fe0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803ff0:	66 2e 0f 1f 84 00 00 00 00 00 66 0f 1f 44 00 00     f.........f..D..
@@ -0,0 +1,6875 @@
+
+obj/user/regionbatch:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 42 02 00 00       	call   800265 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+ * region operations are submitted with sys_region_batch() */
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 55                	push   %r13
+  80002b:	41 54                	push   %r12
+  80002d:	53                   	push   %rbx
+  80002e:	48 83 ec 68          	sub    $0x68,%rsp
+    int p[2];
+
+    uint32_t start = thisenv->env_syscalls;
+  800032:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  800039:	00 00 00 
+  80003c:	44 8b a8 f8 00 00 00 	mov    0xf8(%rax),%r13d
+    int res = pipe(p);
+  800043:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  800047:	48 b8 cf 2f 80 00 00 	movabs $0x802fcf,%rax
+  80004e:	00 00 00 
+  800051:	ff d0                	call   *%rax
+    if (res < 0) panic("pipe: %i", res);
+  800053:	85 c0                	test   %eax,%eax
+  800055:	0f 88 56 01 00 00    	js     8001b1 <umain+0x18c>
+    uint32_t pipe_calls = thisenv->env_syscalls - start;
+  80005b:	48 bb 00 60 80 00 00 	movabs $0x806000,%rbx
+  800062:	00 00 00 
+  800065:	48 8b 03             	mov    (%rbx),%rax
+  800068:	44 8b a0 f8 00 00 00 	mov    0xf8(%rax),%r12d
+  80006f:	45 29 ec             	sub    %r13d,%r12d
+    close(p[0]);
+  800072:	8b 7d d8             	mov    -0x28(%rbp),%edi
+  800075:	49 bd b7 19 80 00 00 	movabs $0x8019b7,%r13
+  80007c:	00 00 00 
+  80007f:	41 ff d5             	call   *%r13
+    close(p[1]);
+  800082:	8b 7d dc             	mov    -0x24(%rbp),%edi
+  800085:	41 ff d5             	call   *%r13
+
+    start = thisenv->env_syscalls;
+  800088:	48 8b 03             	mov    (%rbx),%rax
+  80008b:	8b 98 f8 00 00 00    	mov    0xf8(%rax),%ebx
+    envid_t child = spawnl("hello", "hello", 0);
+  800091:	ba 00 00 00 00       	mov    $0x0,%edx
+  800096:	48 bf 94 39 80 00 00 	movabs $0x803994,%rdi
+  80009d:	00 00 00 
+  8000a0:	48 89 fe             	mov    %rdi,%rsi
+  8000a3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000a8:	48 b9 33 2c 80 00 00 	movabs $0x802c33,%rcx
+  8000af:	00 00 00 
+  8000b2:	ff d1                	call   *%rcx
+  8000b4:	89 c7                	mov    %eax,%edi
+    if (child < 0) panic("spawn: %i", child);
+  8000b6:	85 c0                	test   %eax,%eax
+  8000b8:	0f 88 20 01 00 00    	js     8001de <umain+0x1b9>
+    uint32_t spawn_calls = thisenv->env_syscalls - start;
+  8000be:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  8000c5:	00 00 00 
+  8000c8:	44 8b a8 f8 00 00 00 	mov    0xf8(%rax),%r13d
+  8000cf:	41 29 dd             	sub    %ebx,%r13d
+    wait(child);
+  8000d2:	48 b8 24 32 80 00 00 	movabs $0x803224,%rax
+  8000d9:	00 00 00 
+  8000dc:	ff d0                	call   *%rax
+
+    /* Operations before the failed one stay applied */
+    struct RegionOp ops[] = {
+  8000de:	48 8d 7d 88          	lea    -0x78(%rbp),%rdi
+  8000e2:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  8000e7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000ec:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+  8000ef:	c7 45 8c 06 00 00 00 	movl   $0x6,-0x74(%rbp)
+  8000f6:	48 c7 45 a0 00 00 40 	movq   $0x400000,-0x60(%rbp)
+  8000fd:	00 
+  8000fe:	48 c7 45 a8 00 10 00 	movq   $0x1000,-0x58(%rbp)
+  800105:	00 
+  800106:	c7 45 b0 ff ff ff ff 	movl   $0xffffffff,-0x50(%rbp)
+            {.type = REGION_ALLOC, .dstva = (uintptr_t)UTEMP, .size = PAGE_SIZE, .perm = PROT_RW},
+            {.type = -1},
+    };
+    res = sys_region_batch(ops, 2);
+  80010d:	be 02 00 00 00       	mov    $0x2,%esi
+  800112:	48 8d 7d 88          	lea    -0x78(%rbp),%rdi
+  800116:	48 b8 89 14 80 00 00 	movabs $0x801489,%rax
+  80011d:	00 00 00 
+  800120:	ff d0                	call   *%rax
+  800122:	89 c3                	mov    %eax,%ebx
+    if (res != -E_INVAL || !(get_prot(UTEMP) & PROT_R))
+  800124:	83 f8 fd             	cmp    $0xfffffffd,%eax
+  800127:	0f 85 de 00 00 00    	jne    80020b <umain+0x1e6>
+  80012d:	bf 00 00 40 00       	mov    $0x400000,%edi
+  800132:	48 b8 91 33 80 00 00 	movabs $0x803391,%rax
+  800139:	00 00 00 
+  80013c:	ff d0                	call   *%rax
+  80013e:	a8 04                	test   $0x4,%al
+  800140:	0f 84 c5 00 00 00    	je     80020b <umain+0x1e6>
+        panic("sys_region_batch with bad operation: %i", res);
+    ops[0].type = REGION_UNMAP;
+  800146:	c7 45 88 02 00 00 00 	movl   $0x2,-0x78(%rbp)
+    if ((res = sys_region_batch(ops, 1)) < 0 || get_prot(UTEMP) & PROT_R)
+  80014d:	be 01 00 00 00       	mov    $0x1,%esi
+  800152:	48 8d 7d 88          	lea    -0x78(%rbp),%rdi
+  800156:	48 b8 89 14 80 00 00 	movabs $0x801489,%rax
+  80015d:	00 00 00 
+  800160:	ff d0                	call   *%rax
+  800162:	89 c3                	mov    %eax,%ebx
+  800164:	85 c0                	test   %eax,%eax
+  800166:	0f 88 cc 00 00 00    	js     800238 <umain+0x213>
+  80016c:	bf 00 00 40 00       	mov    $0x400000,%edi
+  800171:	48 b8 91 33 80 00 00 	movabs $0x803391,%rax
+  800178:	00 00 00 
+  80017b:	ff d0                	call   *%rax
+  80017d:	a8 04                	test   $0x4,%al
+  80017f:	0f 85 b3 00 00 00    	jne    800238 <umain+0x213>
+        panic("sys_region_batch: %i", res);
+
+    cprintf("regionbatch: pipe %u system calls, spawn %u system calls (including file system IPC)\n",
+  800185:	44 89 ea             	mov    %r13d,%edx
+  800188:	44 89 e6             	mov    %r12d,%esi
+  80018b:	48 bf e8 39 80 00 00 	movabs $0x8039e8,%rdi
+  800192:	00 00 00 
+  800195:	b8 00 00 00 00       	mov    $0x0,%eax
+  80019a:	48 b9 81 04 80 00 00 	movabs $0x800481,%rcx
+  8001a1:	00 00 00 
+  8001a4:	ff d1                	call   *%rcx
+            pipe_calls, spawn_calls);
+}
+  8001a6:	48 83 c4 68          	add    $0x68,%rsp
+  8001aa:	5b                   	pop    %rbx
+  8001ab:	41 5c                	pop    %r12
+  8001ad:	41 5d                	pop    %r13
+  8001af:	5d                   	pop    %rbp
+  8001b0:	c3                   	ret
+    if (res < 0) panic("pipe: %i", res);
+  8001b1:	89 c1                	mov    %eax,%ecx
+  8001b3:	48 ba 78 39 80 00 00 	movabs $0x803978,%rdx
+  8001ba:	00 00 00 
+  8001bd:	be 0c 00 00 00       	mov    $0xc,%esi
+  8001c2:	48 bf 81 39 80 00 00 	movabs $0x803981,%rdi
+  8001c9:	00 00 00 
+  8001cc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001d1:	49 b8 31 03 80 00 00 	movabs $0x800331,%r8
+  8001d8:	00 00 00 
+  8001db:	41 ff d0             	call   *%r8
+    if (child < 0) panic("spawn: %i", child);
+  8001de:	89 c1                	mov    %eax,%ecx
+  8001e0:	48 ba 9a 39 80 00 00 	movabs $0x80399a,%rdx
+  8001e7:	00 00 00 
+  8001ea:	be 13 00 00 00       	mov    $0x13,%esi
+  8001ef:	48 bf 81 39 80 00 00 	movabs $0x803981,%rdi
+  8001f6:	00 00 00 
+  8001f9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001fe:	49 b8 31 03 80 00 00 	movabs $0x800331,%r8
+  800205:	00 00 00 
+  800208:	41 ff d0             	call   *%r8
+        panic("sys_region_batch with bad operation: %i", res);
+  80020b:	89 d9                	mov    %ebx,%ecx
+  80020d:	48 ba c0 39 80 00 00 	movabs $0x8039c0,%rdx
+  800214:	00 00 00 
+  800217:	be 1e 00 00 00       	mov    $0x1e,%esi
+  80021c:	48 bf 81 39 80 00 00 	movabs $0x803981,%rdi
+  800223:	00 00 00 
+  800226:	b8 00 00 00 00       	mov    $0x0,%eax
+  80022b:	49 b8 31 03 80 00 00 	movabs $0x800331,%r8
+  800232:	00 00 00 
+  800235:	41 ff d0             	call   *%r8
+        panic("sys_region_batch: %i", res);
+  800238:	89 d9                	mov    %ebx,%ecx
+  80023a:	48 ba a4 39 80 00 00 	movabs $0x8039a4,%rdx
+  800241:	00 00 00 
+  800244:	be 21 00 00 00       	mov    $0x21,%esi
+  800249:	48 bf 81 39 80 00 00 	movabs $0x803981,%rdi
+  800250:	00 00 00 
+  800253:	b8 00 00 00 00       	mov    $0x0,%eax
+  800258:	49 b8 31 03 80 00 00 	movabs $0x800331,%r8
+  80025f:	00 00 00 
+  800262:	41 ff d0             	call   *%r8
+
+0000000000800265 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800265:	55                   	push   %rbp
+  800266:	48 89 e5             	mov    %rsp,%rbp
+  800269:	41 56                	push   %r14
+  80026b:	41 55                	push   %r13
+  80026d:	41 54                	push   %r12
+  80026f:	53                   	push   %rbx
+  800270:	41 89 fd             	mov    %edi,%r13d
+  800273:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800276:	48 ba d8 50 80 00 00 	movabs $0x8050d8,%rdx
+  80027d:	00 00 00 
+  800280:	48 b8 d8 50 80 00 00 	movabs $0x8050d8,%rax
+  800287:	00 00 00 
+  80028a:	48 39 c2             	cmp    %rax,%rdx
+  80028d:	73 17                	jae    8002a6 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  80028f:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  800292:	49 89 c4             	mov    %rax,%r12
+  800295:	48 83 c3 08          	add    $0x8,%rbx
+  800299:	b8 00 00 00 00       	mov    $0x0,%eax
+  80029e:	ff 53 f8             	call   *-0x8(%rbx)
+  8002a1:	4c 39 e3             	cmp    %r12,%rbx
+  8002a4:	72 ef                	jb     800295 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+    envid_t this_env_id = sys_getenvid();
+  8002a6:	48 b8 96 12 80 00 00 	movabs $0x801296,%rax
+  8002ad:	00 00 00 
+  8002b0:	ff d0                	call   *%rax
+    thisenv = &((struct Env*)UENVS)[ENVX(this_env_id)];
+  8002b2:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8002b7:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+  8002be:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8002c5:	00 00 00 
+  8002c8:	48 01 d0             	add    %rdx,%rax
+  8002cb:	48 a3 00 60 80 00 00 	movabs %rax,0x806000
+  8002d2:	00 00 00 
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8002d5:	45 85 ed             	test   %r13d,%r13d
+  8002d8:	7e 0d                	jle    8002e7 <libmain+0x82>
+  8002da:	49 8b 06             	mov    (%r14),%rax
+  8002dd:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  8002e4:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8002e7:	4c 89 f6             	mov    %r14,%rsi
+  8002ea:	44 89 ef             	mov    %r13d,%edi
+  8002ed:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8002f4:	00 00 00 
+  8002f7:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8002f9:	48 b8 0e 03 80 00 00 	movabs $0x80030e,%rax
+  800300:	00 00 00 
+  800303:	ff d0                	call   *%rax
+#endif
+}
+  800305:	5b                   	pop    %rbx
+  800306:	41 5c                	pop    %r12
+  800308:	41 5d                	pop    %r13
+  80030a:	41 5e                	pop    %r14
+  80030c:	5d                   	pop    %rbp
+  80030d:	c3                   	ret
+
+000000000080030e <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  80030e:	55                   	push   %rbp
+  80030f:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  800312:	48 b8 ea 19 80 00 00 	movabs $0x8019ea,%rax
+  800319:	00 00 00 
+  80031c:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  80031e:	bf 00 00 00 00       	mov    $0x0,%edi
+  800323:	48 b8 2b 12 80 00 00 	movabs $0x80122b,%rax
+  80032a:	00 00 00 
+  80032d:	ff d0                	call   *%rax
+}
+  80032f:	5d                   	pop    %rbp
+  800330:	c3                   	ret
+
+0000000000800331 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  800331:	55                   	push   %rbp
+  800332:	48 89 e5             	mov    %rsp,%rbp
+  800335:	41 56                	push   %r14
+  800337:	41 55                	push   %r13
+  800339:	41 54                	push   %r12
+  80033b:	53                   	push   %rbx
+  80033c:	48 83 ec 50          	sub    $0x50,%rsp
+  800340:	49 89 fc             	mov    %rdi,%r12
+  800343:	41 89 f5             	mov    %esi,%r13d
+  800346:	48 89 d3             	mov    %rdx,%rbx
+  800349:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  80034d:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  800351:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800355:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  80035c:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800360:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  800364:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  800368:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  80036c:	48 b8 00 50 80 00 00 	movabs $0x805000,%rax
+  800373:	00 00 00 
+  800376:	4c 8b 30             	mov    (%rax),%r14
+  800379:	48 b8 96 12 80 00 00 	movabs $0x801296,%rax
+  800380:	00 00 00 
+  800383:	ff d0                	call   *%rax
+  800385:	89 c6                	mov    %eax,%esi
+  800387:	45 89 e8             	mov    %r13d,%r8d
+  80038a:	4c 89 e1             	mov    %r12,%rcx
+  80038d:	4c 89 f2             	mov    %r14,%rdx
+  800390:	48 bf 48 3a 80 00 00 	movabs $0x803a48,%rdi
+  800397:	00 00 00 
+  80039a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80039f:	49 bc 81 04 80 00 00 	movabs $0x800481,%r12
+  8003a6:	00 00 00 
+  8003a9:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  8003ac:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  8003b0:	48 89 df             	mov    %rbx,%rdi
+  8003b3:	48 b8 1d 04 80 00 00 	movabs $0x80041d,%rax
+  8003ba:	00 00 00 
+  8003bd:	ff d0                	call   *%rax
+    cprintf("\n");
+  8003bf:	48 bf 5b 40 80 00 00 	movabs $0x80405b,%rdi
+  8003c6:	00 00 00 
+  8003c9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003ce:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  8003d1:	cc                   	int3
+  8003d2:	eb fd                	jmp    8003d1 <_panic+0xa0>
+
+00000000008003d4 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  8003d4:	55                   	push   %rbp
+  8003d5:	48 89 e5             	mov    %rsp,%rbp
+  8003d8:	53                   	push   %rbx
+  8003d9:	48 83 ec 08          	sub    $0x8,%rsp
+  8003dd:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  8003e0:	8b 06                	mov    (%rsi),%eax
+  8003e2:	8d 50 01             	lea    0x1(%rax),%edx
+  8003e5:	89 16                	mov    %edx,(%rsi)
+  8003e7:	48 98                	cltq
+  8003e9:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  8003ee:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  8003f4:	74 0a                	je     800400 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  8003f6:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  8003fa:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8003fe:	c9                   	leave
+  8003ff:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  800400:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  800404:	be ff 00 00 00       	mov    $0xff,%esi
+  800409:	48 b8 cd 11 80 00 00 	movabs $0x8011cd,%rax
+  800410:	00 00 00 
+  800413:	ff d0                	call   *%rax
+        state->offset = 0;
+  800415:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  80041b:	eb d9                	jmp    8003f6 <putch+0x22>
+
+000000000080041d <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  80041d:	55                   	push   %rbp
+  80041e:	48 89 e5             	mov    %rsp,%rbp
+  800421:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  800428:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  80042b:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  800432:	b9 21 00 00 00       	mov    $0x21,%ecx
+  800437:	b8 00 00 00 00       	mov    $0x0,%eax
+  80043c:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  80043f:	48 89 f1             	mov    %rsi,%rcx
+  800442:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  800449:	48 bf d4 03 80 00 00 	movabs $0x8003d4,%rdi
+  800450:	00 00 00 
+  800453:	48 b8 d1 05 80 00 00 	movabs $0x8005d1,%rax
+  80045a:	00 00 00 
+  80045d:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  80045f:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  800466:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  80046d:	48 b8 cd 11 80 00 00 	movabs $0x8011cd,%rax
+  800474:	00 00 00 
+  800477:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  800479:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  80047f:	c9                   	leave
+  800480:	c3                   	ret
+
+0000000000800481 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  800481:	55                   	push   %rbp
+  800482:	48 89 e5             	mov    %rsp,%rbp
+  800485:	48 83 ec 50          	sub    $0x50,%rsp
+  800489:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  80048d:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  800491:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800495:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800499:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  80049d:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  8004a4:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8004a8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8004ac:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8004b0:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  8004b4:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  8004b8:	48 b8 1d 04 80 00 00 	movabs $0x80041d,%rax
+  8004bf:	00 00 00 
+  8004c2:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  8004c4:	c9                   	leave
+  8004c5:	c3                   	ret
+
+00000000008004c6 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  8004c6:	55                   	push   %rbp
+  8004c7:	48 89 e5             	mov    %rsp,%rbp
+  8004ca:	41 57                	push   %r15
+  8004cc:	41 56                	push   %r14
+  8004ce:	41 55                	push   %r13
+  8004d0:	41 54                	push   %r12
+  8004d2:	53                   	push   %rbx
+  8004d3:	48 83 ec 18          	sub    $0x18,%rsp
+  8004d7:	49 89 fc             	mov    %rdi,%r12
+  8004da:	49 89 f5             	mov    %rsi,%r13
+  8004dd:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8004e1:	8b 45 10             	mov    0x10(%rbp),%eax
+  8004e4:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  8004e7:	41 89 cf             	mov    %ecx,%r15d
+  8004ea:	4c 39 fa             	cmp    %r15,%rdx
+  8004ed:	73 5b                	jae    80054a <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  8004ef:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  8004f3:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  8004f7:	85 db                	test   %ebx,%ebx
+  8004f9:	7e 0e                	jle    800509 <print_num+0x43>
+            putch(padc, put_arg);
+  8004fb:	4c 89 ee             	mov    %r13,%rsi
+  8004fe:	44 89 f7             	mov    %r14d,%edi
+  800501:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  800504:	83 eb 01             	sub    $0x1,%ebx
+  800507:	75 f2                	jne    8004fb <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  800509:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  80050d:	48 b9 7c 3a 80 00 00 	movabs $0x803a7c,%rcx
+  800514:	00 00 00 
+  800517:	48 b8 6b 3a 80 00 00 	movabs $0x803a6b,%rax
+  80051e:	00 00 00 
+  800521:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  800525:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800529:	ba 00 00 00 00       	mov    $0x0,%edx
+  80052e:	49 f7 f7             	div    %r15
+  800531:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  800535:	4c 89 ee             	mov    %r13,%rsi
+  800538:	41 ff d4             	call   *%r12
+}
+  80053b:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  80053f:	5b                   	pop    %rbx
+  800540:	41 5c                	pop    %r12
+  800542:	41 5d                	pop    %r13
+  800544:	41 5e                	pop    %r14
+  800546:	41 5f                	pop    %r15
+  800548:	5d                   	pop    %rbp
+  800549:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  80054a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80054e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800553:	49 f7 f7             	div    %r15
+  800556:	48 83 ec 08          	sub    $0x8,%rsp
+  80055a:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  80055e:	52                   	push   %rdx
+  80055f:	45 0f be c9          	movsbl %r9b,%r9d
+  800563:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  800567:	48 89 c2             	mov    %rax,%rdx
+  80056a:	48 b8 c6 04 80 00 00 	movabs $0x8004c6,%rax
+  800571:	00 00 00 
+  800574:	ff d0                	call   *%rax
+  800576:	48 83 c4 10          	add    $0x10,%rsp
+  80057a:	eb 8d                	jmp    800509 <print_num+0x43>
+
+000000000080057c <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  80057c:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  800580:	48 8b 06             	mov    (%rsi),%rax
+  800583:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  800587:	73 0a                	jae    800593 <sprintputch+0x17>
+        *state->start++ = ch;
+  800589:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80058d:	48 89 16             	mov    %rdx,(%rsi)
+  800590:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  800593:	c3                   	ret
+
+0000000000800594 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  800594:	55                   	push   %rbp
+  800595:	48 89 e5             	mov    %rsp,%rbp
+  800598:	48 83 ec 50          	sub    $0x50,%rsp
+  80059c:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8005a0:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8005a4:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  8005a8:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8005af:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8005b3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8005b7:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8005bb:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  8005bf:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8005c3:	48 b8 d1 05 80 00 00 	movabs $0x8005d1,%rax
+  8005ca:	00 00 00 
+  8005cd:	ff d0                	call   *%rax
+}
+  8005cf:	c9                   	leave
+  8005d0:	c3                   	ret
+
+00000000008005d1 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  8005d1:	55                   	push   %rbp
+  8005d2:	48 89 e5             	mov    %rsp,%rbp
+  8005d5:	41 57                	push   %r15
+  8005d7:	41 56                	push   %r14
+  8005d9:	41 55                	push   %r13
+  8005db:	41 54                	push   %r12
+  8005dd:	53                   	push   %rbx
+  8005de:	48 83 ec 38          	sub    $0x38,%rsp
+  8005e2:	49 89 fe             	mov    %rdi,%r14
+  8005e5:	49 89 f5             	mov    %rsi,%r13
+  8005e8:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  8005eb:	48 8b 01             	mov    (%rcx),%rax
+  8005ee:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8005f2:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  8005f6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8005fa:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  8005fe:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  800602:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  800606:	0f b6 3b             	movzbl (%rbx),%edi
+  800609:	40 80 ff 25          	cmp    $0x25,%dil
+  80060d:	74 18                	je     800627 <vprintfmt+0x56>
+            if (!ch) return;
+  80060f:	40 84 ff             	test   %dil,%dil
+  800612:	0f 84 b1 06 00 00    	je     800cc9 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  800618:	40 0f b6 ff          	movzbl %dil,%edi
+  80061c:	4c 89 ee             	mov    %r13,%rsi
+  80061f:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  800622:	4c 89 e3             	mov    %r12,%rbx
+  800625:	eb db                	jmp    800602 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  800627:	be 00 00 00 00       	mov    $0x0,%esi
+  80062c:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  800630:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  800635:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  80063b:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  800642:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800646:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  80064b:	41 0f b6 04 24       	movzbl (%r12),%eax
+  800650:	88 45 a0             	mov    %al,-0x60(%rbp)
+  800653:	83 e8 23             	sub    $0x23,%eax
+  800656:	3c 57                	cmp    $0x57,%al
+  800658:	0f 87 51 06 00 00    	ja     800caf <vprintfmt+0x6de>
+  80065e:	0f b6 c0             	movzbl %al,%eax
+  800661:	48 b9 40 3c 80 00 00 	movabs $0x803c40,%rcx
+  800668:	00 00 00 
+  80066b:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  80066e:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  800671:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  800675:	eb cf                	jmp    800646 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  800677:	49 89 dc             	mov    %rbx,%r12
+  80067a:	be 01 00 00 00       	mov    $0x1,%esi
+  80067f:	eb c5                	jmp    800646 <vprintfmt+0x75>
+            padc = ch;
+  800681:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  800685:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800688:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80068b:	eb b9                	jmp    800646 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  80068d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800690:	83 f8 2f             	cmp    $0x2f,%eax
+  800693:	77 24                	ja     8006b9 <vprintfmt+0xe8>
+  800695:	89 c1                	mov    %eax,%ecx
+  800697:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  80069b:	83 c0 08             	add    $0x8,%eax
+  80069e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8006a1:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  8006a4:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  8006a7:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8006ab:	79 99                	jns    800646 <vprintfmt+0x75>
+                width = precision;
+  8006ad:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  8006b1:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8006b7:	eb 8d                	jmp    800646 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8006b9:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8006bd:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  8006c1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006c5:	eb da                	jmp    8006a1 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  8006c7:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  8006cc:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8006d0:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  8006d6:	3c 39                	cmp    $0x39,%al
+  8006d8:	77 1c                	ja     8006f6 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  8006da:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  8006de:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  8006e2:	0f b6 c0             	movzbl %al,%eax
+  8006e5:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8006ea:	0f b6 03             	movzbl (%rbx),%eax
+  8006ed:	3c 39                	cmp    $0x39,%al
+  8006ef:	76 e9                	jbe    8006da <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  8006f1:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  8006f4:	eb b1                	jmp    8006a7 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  8006f6:	49 89 dc             	mov    %rbx,%r12
+  8006f9:	eb ac                	jmp    8006a7 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  8006fb:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  8006fe:	85 c9                	test   %ecx,%ecx
+  800700:	b8 00 00 00 00       	mov    $0x0,%eax
+  800705:	0f 49 c1             	cmovns %ecx,%eax
+  800708:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  80070b:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80070e:	e9 33 ff ff ff       	jmp    800646 <vprintfmt+0x75>
+            lflag++;
+  800713:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  800716:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800719:	e9 28 ff ff ff       	jmp    800646 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  80071e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800721:	83 f8 2f             	cmp    $0x2f,%eax
+  800724:	77 19                	ja     80073f <vprintfmt+0x16e>
+  800726:	89 c2                	mov    %eax,%edx
+  800728:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80072c:	83 c0 08             	add    $0x8,%eax
+  80072f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800732:	8b 3a                	mov    (%rdx),%edi
+  800734:	4c 89 ee             	mov    %r13,%rsi
+  800737:	41 ff d6             	call   *%r14
+            break;
+  80073a:	e9 c3 fe ff ff       	jmp    800602 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  80073f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800743:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800747:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80074b:	eb e5                	jmp    800732 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  80074d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800750:	83 f8 2f             	cmp    $0x2f,%eax
+  800753:	77 5a                	ja     8007af <vprintfmt+0x1de>
+  800755:	89 c2                	mov    %eax,%edx
+  800757:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80075b:	83 c0 08             	add    $0x8,%eax
+  80075e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  800761:	8b 02                	mov    (%rdx),%eax
+  800763:	89 c1                	mov    %eax,%ecx
+  800765:	f7 d9                	neg    %ecx
+  800767:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  80076a:	83 f9 15             	cmp    $0x15,%ecx
+  80076d:	7f 4e                	jg     8007bd <vprintfmt+0x1ec>
+  80076f:	48 63 c1             	movslq %ecx,%rax
+  800772:	48 ba 00 3f 80 00 00 	movabs $0x803f00,%rdx
+  800779:	00 00 00 
+  80077c:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  800780:	48 85 c0             	test   %rax,%rax
+  800783:	74 38                	je     8007bd <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  800785:	48 89 c1             	mov    %rax,%rcx
+  800788:	48 ba 2c 41 80 00 00 	movabs $0x80412c,%rdx
+  80078f:	00 00 00 
+  800792:	4c 89 ee             	mov    %r13,%rsi
+  800795:	4c 89 f7             	mov    %r14,%rdi
+  800798:	b8 00 00 00 00       	mov    $0x0,%eax
+  80079d:	49 b8 94 05 80 00 00 	movabs $0x800594,%r8
+  8007a4:	00 00 00 
+  8007a7:	41 ff d0             	call   *%r8
+  8007aa:	e9 53 fe ff ff       	jmp    800602 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  8007af:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007b3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007b7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007bb:	eb a4                	jmp    800761 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  8007bd:	48 ba 94 3a 80 00 00 	movabs $0x803a94,%rdx
+  8007c4:	00 00 00 
+  8007c7:	4c 89 ee             	mov    %r13,%rsi
+  8007ca:	4c 89 f7             	mov    %r14,%rdi
+  8007cd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007d2:	49 b8 94 05 80 00 00 	movabs $0x800594,%r8
+  8007d9:	00 00 00 
+  8007dc:	41 ff d0             	call   *%r8
+  8007df:	e9 1e fe ff ff       	jmp    800602 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8007e4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007e7:	83 f8 2f             	cmp    $0x2f,%eax
+  8007ea:	77 6c                	ja     800858 <vprintfmt+0x287>
+  8007ec:	89 c2                	mov    %eax,%edx
+  8007ee:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007f2:	83 c0 08             	add    $0x8,%eax
+  8007f5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007f8:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  8007fb:	48 85 d2             	test   %rdx,%rdx
+  8007fe:	48 b8 8d 3a 80 00 00 	movabs $0x803a8d,%rax
+  800805:	00 00 00 
+  800808:	48 0f 45 c2          	cmovne %rdx,%rax
+  80080c:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  800810:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800814:	7e 06                	jle    80081c <vprintfmt+0x24b>
+  800816:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  80081a:	75 4a                	jne    800866 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  80081c:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800820:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  800824:	0f b6 00             	movzbl (%rax),%eax
+  800827:	84 c0                	test   %al,%al
+  800829:	0f 85 9a 00 00 00    	jne    8008c9 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  80082f:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800832:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  800836:	85 c0                	test   %eax,%eax
+  800838:	0f 8e c4 fd ff ff    	jle    800602 <vprintfmt+0x31>
+  80083e:	4c 89 ee             	mov    %r13,%rsi
+  800841:	bf 20 00 00 00       	mov    $0x20,%edi
+  800846:	41 ff d6             	call   *%r14
+  800849:	41 83 ec 01          	sub    $0x1,%r12d
+  80084d:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  800851:	75 eb                	jne    80083e <vprintfmt+0x26d>
+  800853:	e9 aa fd ff ff       	jmp    800602 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800858:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80085c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800860:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800864:	eb 92                	jmp    8007f8 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  800866:	49 63 f7             	movslq %r15d,%rsi
+  800869:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  80086d:	48 b8 83 0d 80 00 00 	movabs $0x800d83,%rax
+  800874:	00 00 00 
+  800877:	ff d0                	call   *%rax
+  800879:	48 89 c2             	mov    %rax,%rdx
+  80087c:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80087f:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  800881:	8d 70 ff             	lea    -0x1(%rax),%esi
+  800884:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  800887:	85 c0                	test   %eax,%eax
+  800889:	7e 91                	jle    80081c <vprintfmt+0x24b>
+  80088b:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  800890:	4c 89 ee             	mov    %r13,%rsi
+  800893:	44 89 e7             	mov    %r12d,%edi
+  800896:	41 ff d6             	call   *%r14
+  800899:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  80089d:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8008a0:	83 f8 ff             	cmp    $0xffffffff,%eax
+  8008a3:	75 eb                	jne    800890 <vprintfmt+0x2bf>
+  8008a5:	e9 72 ff ff ff       	jmp    80081c <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8008aa:	0f b6 f8             	movzbl %al,%edi
+  8008ad:	4c 89 ee             	mov    %r13,%rsi
+  8008b0:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8008b3:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8008b7:	49 83 c4 01          	add    $0x1,%r12
+  8008bb:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  8008c1:	84 c0                	test   %al,%al
+  8008c3:	0f 84 66 ff ff ff    	je     80082f <vprintfmt+0x25e>
+  8008c9:	45 85 ff             	test   %r15d,%r15d
+  8008cc:	78 0a                	js     8008d8 <vprintfmt+0x307>
+  8008ce:	41 83 ef 01          	sub    $0x1,%r15d
+  8008d2:	0f 88 57 ff ff ff    	js     80082f <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8008d8:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  8008dc:	74 cc                	je     8008aa <vprintfmt+0x2d9>
+  8008de:	8d 50 e0             	lea    -0x20(%rax),%edx
+  8008e1:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  8008e6:	80 fa 5e             	cmp    $0x5e,%dl
+  8008e9:	77 c2                	ja     8008ad <vprintfmt+0x2dc>
+  8008eb:	eb bd                	jmp    8008aa <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  8008ed:	40 84 f6             	test   %sil,%sil
+  8008f0:	75 26                	jne    800918 <vprintfmt+0x347>
+    switch (lflag) {
+  8008f2:	85 d2                	test   %edx,%edx
+  8008f4:	74 59                	je     80094f <vprintfmt+0x37e>
+  8008f6:	83 fa 01             	cmp    $0x1,%edx
+  8008f9:	74 7b                	je     800976 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  8008fb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008fe:	83 f8 2f             	cmp    $0x2f,%eax
+  800901:	0f 87 96 00 00 00    	ja     80099d <vprintfmt+0x3cc>
+  800907:	89 c2                	mov    %eax,%edx
+  800909:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80090d:	83 c0 08             	add    $0x8,%eax
+  800910:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800913:	4c 8b 22             	mov    (%rdx),%r12
+  800916:	eb 17                	jmp    80092f <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  800918:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80091b:	83 f8 2f             	cmp    $0x2f,%eax
+  80091e:	77 21                	ja     800941 <vprintfmt+0x370>
+  800920:	89 c2                	mov    %eax,%edx
+  800922:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800926:	83 c0 08             	add    $0x8,%eax
+  800929:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80092c:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  80092f:	4d 85 e4             	test   %r12,%r12
+  800932:	78 7a                	js     8009ae <vprintfmt+0x3dd>
+            num = i;
+  800934:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  800937:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  80093c:	e9 50 02 00 00       	jmp    800b91 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800941:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800945:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800949:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80094d:	eb dd                	jmp    80092c <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  80094f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800952:	83 f8 2f             	cmp    $0x2f,%eax
+  800955:	77 11                	ja     800968 <vprintfmt+0x397>
+  800957:	89 c2                	mov    %eax,%edx
+  800959:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80095d:	83 c0 08             	add    $0x8,%eax
+  800960:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800963:	4c 63 22             	movslq (%rdx),%r12
+  800966:	eb c7                	jmp    80092f <vprintfmt+0x35e>
+  800968:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80096c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800970:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800974:	eb ed                	jmp    800963 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  800976:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800979:	83 f8 2f             	cmp    $0x2f,%eax
+  80097c:	77 11                	ja     80098f <vprintfmt+0x3be>
+  80097e:	89 c2                	mov    %eax,%edx
+  800980:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800984:	83 c0 08             	add    $0x8,%eax
+  800987:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80098a:	4c 8b 22             	mov    (%rdx),%r12
+  80098d:	eb a0                	jmp    80092f <vprintfmt+0x35e>
+  80098f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800993:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800997:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80099b:	eb ed                	jmp    80098a <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  80099d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009a1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009a5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009a9:	e9 65 ff ff ff       	jmp    800913 <vprintfmt+0x342>
+                putch('-', put_arg);
+  8009ae:	4c 89 ee             	mov    %r13,%rsi
+  8009b1:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  8009b6:	41 ff d6             	call   *%r14
+                i = -i;
+  8009b9:	49 f7 dc             	neg    %r12
+  8009bc:	e9 73 ff ff ff       	jmp    800934 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  8009c1:	40 84 f6             	test   %sil,%sil
+  8009c4:	75 32                	jne    8009f8 <vprintfmt+0x427>
+    switch (lflag) {
+  8009c6:	85 d2                	test   %edx,%edx
+  8009c8:	74 5d                	je     800a27 <vprintfmt+0x456>
+  8009ca:	83 fa 01             	cmp    $0x1,%edx
+  8009cd:	0f 84 82 00 00 00    	je     800a55 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  8009d3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009d6:	83 f8 2f             	cmp    $0x2f,%eax
+  8009d9:	0f 87 a5 00 00 00    	ja     800a84 <vprintfmt+0x4b3>
+  8009df:	89 c2                	mov    %eax,%edx
+  8009e1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009e5:	83 c0 08             	add    $0x8,%eax
+  8009e8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009eb:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8009ee:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  8009f3:	e9 99 01 00 00       	jmp    800b91 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8009f8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009fb:	83 f8 2f             	cmp    $0x2f,%eax
+  8009fe:	77 19                	ja     800a19 <vprintfmt+0x448>
+  800a00:	89 c2                	mov    %eax,%edx
+  800a02:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a06:	83 c0 08             	add    $0x8,%eax
+  800a09:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a0c:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800a0f:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800a14:	e9 78 01 00 00       	jmp    800b91 <vprintfmt+0x5c0>
+  800a19:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a1d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a21:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a25:	eb e5                	jmp    800a0c <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  800a27:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a2a:	83 f8 2f             	cmp    $0x2f,%eax
+  800a2d:	77 18                	ja     800a47 <vprintfmt+0x476>
+  800a2f:	89 c2                	mov    %eax,%edx
+  800a31:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a35:	83 c0 08             	add    $0x8,%eax
+  800a38:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a3b:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800a3d:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  800a42:	e9 4a 01 00 00       	jmp    800b91 <vprintfmt+0x5c0>
+  800a47:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a4b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a4f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a53:	eb e6                	jmp    800a3b <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  800a55:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a58:	83 f8 2f             	cmp    $0x2f,%eax
+  800a5b:	77 19                	ja     800a76 <vprintfmt+0x4a5>
+  800a5d:	89 c2                	mov    %eax,%edx
+  800a5f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a63:	83 c0 08             	add    $0x8,%eax
+  800a66:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a69:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800a6c:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  800a71:	e9 1b 01 00 00       	jmp    800b91 <vprintfmt+0x5c0>
+  800a76:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a7a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a7e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a82:	eb e5                	jmp    800a69 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  800a84:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a88:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a8c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a90:	e9 56 ff ff ff       	jmp    8009eb <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  800a95:	40 84 f6             	test   %sil,%sil
+  800a98:	75 2e                	jne    800ac8 <vprintfmt+0x4f7>
+    switch (lflag) {
+  800a9a:	85 d2                	test   %edx,%edx
+  800a9c:	74 59                	je     800af7 <vprintfmt+0x526>
+  800a9e:	83 fa 01             	cmp    $0x1,%edx
+  800aa1:	74 7f                	je     800b22 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  800aa3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800aa6:	83 f8 2f             	cmp    $0x2f,%eax
+  800aa9:	0f 87 9f 00 00 00    	ja     800b4e <vprintfmt+0x57d>
+  800aaf:	89 c2                	mov    %eax,%edx
+  800ab1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ab5:	83 c0 08             	add    $0x8,%eax
+  800ab8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800abb:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800abe:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  800ac3:	e9 c9 00 00 00       	jmp    800b91 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800ac8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800acb:	83 f8 2f             	cmp    $0x2f,%eax
+  800ace:	77 19                	ja     800ae9 <vprintfmt+0x518>
+  800ad0:	89 c2                	mov    %eax,%edx
+  800ad2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ad6:	83 c0 08             	add    $0x8,%eax
+  800ad9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800adc:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800adf:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800ae4:	e9 a8 00 00 00       	jmp    800b91 <vprintfmt+0x5c0>
+  800ae9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800aed:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800af1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800af5:	eb e5                	jmp    800adc <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  800af7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800afa:	83 f8 2f             	cmp    $0x2f,%eax
+  800afd:	77 15                	ja     800b14 <vprintfmt+0x543>
+  800aff:	89 c2                	mov    %eax,%edx
+  800b01:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b05:	83 c0 08             	add    $0x8,%eax
+  800b08:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b0b:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  800b0d:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  800b12:	eb 7d                	jmp    800b91 <vprintfmt+0x5c0>
+  800b14:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b18:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b1c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b20:	eb e9                	jmp    800b0b <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  800b22:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b25:	83 f8 2f             	cmp    $0x2f,%eax
+  800b28:	77 16                	ja     800b40 <vprintfmt+0x56f>
+  800b2a:	89 c2                	mov    %eax,%edx
+  800b2c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b30:	83 c0 08             	add    $0x8,%eax
+  800b33:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b36:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800b39:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  800b3e:	eb 51                	jmp    800b91 <vprintfmt+0x5c0>
+  800b40:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b44:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b48:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b4c:	eb e8                	jmp    800b36 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  800b4e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b52:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b56:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b5a:	e9 5c ff ff ff       	jmp    800abb <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  800b5f:	4c 89 ee             	mov    %r13,%rsi
+  800b62:	bf 30 00 00 00       	mov    $0x30,%edi
+  800b67:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800b6a:	4c 89 ee             	mov    %r13,%rsi
+  800b6d:	bf 78 00 00 00       	mov    $0x78,%edi
+  800b72:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800b75:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b78:	83 f8 2f             	cmp    $0x2f,%eax
+  800b7b:	77 47                	ja     800bc4 <vprintfmt+0x5f3>
+  800b7d:	89 c2                	mov    %eax,%edx
+  800b7f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b83:	83 c0 08             	add    $0x8,%eax
+  800b86:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b89:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800b8c:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800b91:	48 83 ec 08          	sub    $0x8,%rsp
+  800b95:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800b99:	0f 94 c0             	sete   %al
+  800b9c:	0f b6 c0             	movzbl %al,%eax
+  800b9f:	50                   	push   %rax
+  800ba0:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800ba5:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800ba9:	4c 89 ee             	mov    %r13,%rsi
+  800bac:	4c 89 f7             	mov    %r14,%rdi
+  800baf:	48 b8 c6 04 80 00 00 	movabs $0x8004c6,%rax
+  800bb6:	00 00 00 
+  800bb9:	ff d0                	call   *%rax
+            break;
+  800bbb:	48 83 c4 10          	add    $0x10,%rsp
+  800bbf:	e9 3e fa ff ff       	jmp    800602 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800bc4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bc8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bcc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bd0:	eb b7                	jmp    800b89 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  800bd2:	40 84 f6             	test   %sil,%sil
+  800bd5:	75 2b                	jne    800c02 <vprintfmt+0x631>
+    switch (lflag) {
+  800bd7:	85 d2                	test   %edx,%edx
+  800bd9:	74 56                	je     800c31 <vprintfmt+0x660>
+  800bdb:	83 fa 01             	cmp    $0x1,%edx
+  800bde:	74 7f                	je     800c5f <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800be0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800be3:	83 f8 2f             	cmp    $0x2f,%eax
+  800be6:	0f 87 a2 00 00 00    	ja     800c8e <vprintfmt+0x6bd>
+  800bec:	89 c2                	mov    %eax,%edx
+  800bee:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800bf2:	83 c0 08             	add    $0x8,%eax
+  800bf5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800bf8:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800bfb:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800c00:	eb 8f                	jmp    800b91 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800c02:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c05:	83 f8 2f             	cmp    $0x2f,%eax
+  800c08:	77 19                	ja     800c23 <vprintfmt+0x652>
+  800c0a:	89 c2                	mov    %eax,%edx
+  800c0c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c10:	83 c0 08             	add    $0x8,%eax
+  800c13:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c16:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800c19:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800c1e:	e9 6e ff ff ff       	jmp    800b91 <vprintfmt+0x5c0>
+  800c23:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c27:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c2b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c2f:	eb e5                	jmp    800c16 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800c31:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c34:	83 f8 2f             	cmp    $0x2f,%eax
+  800c37:	77 18                	ja     800c51 <vprintfmt+0x680>
+  800c39:	89 c2                	mov    %eax,%edx
+  800c3b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c3f:	83 c0 08             	add    $0x8,%eax
+  800c42:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c45:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800c47:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800c4c:	e9 40 ff ff ff       	jmp    800b91 <vprintfmt+0x5c0>
+  800c51:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c55:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c59:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c5d:	eb e6                	jmp    800c45 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800c5f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c62:	83 f8 2f             	cmp    $0x2f,%eax
+  800c65:	77 19                	ja     800c80 <vprintfmt+0x6af>
+  800c67:	89 c2                	mov    %eax,%edx
+  800c69:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c6d:	83 c0 08             	add    $0x8,%eax
+  800c70:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c73:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800c76:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800c7b:	e9 11 ff ff ff       	jmp    800b91 <vprintfmt+0x5c0>
+  800c80:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c84:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c88:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c8c:	eb e5                	jmp    800c73 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800c8e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c92:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c96:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c9a:	e9 59 ff ff ff       	jmp    800bf8 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800c9f:	4c 89 ee             	mov    %r13,%rsi
+  800ca2:	bf 25 00 00 00       	mov    $0x25,%edi
+  800ca7:	41 ff d6             	call   *%r14
+            break;
+  800caa:	e9 53 f9 ff ff       	jmp    800602 <vprintfmt+0x31>
+            putch('%', put_arg);
+  800caf:	4c 89 ee             	mov    %r13,%rsi
+  800cb2:	bf 25 00 00 00       	mov    $0x25,%edi
+  800cb7:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800cba:	48 83 eb 01          	sub    $0x1,%rbx
+  800cbe:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800cc2:	75 f6                	jne    800cba <vprintfmt+0x6e9>
+  800cc4:	e9 39 f9 ff ff       	jmp    800602 <vprintfmt+0x31>
+}
+  800cc9:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800ccd:	5b                   	pop    %rbx
+  800cce:	41 5c                	pop    %r12
+  800cd0:	41 5d                	pop    %r13
+  800cd2:	41 5e                	pop    %r14
+  800cd4:	41 5f                	pop    %r15
+  800cd6:	5d                   	pop    %rbp
+  800cd7:	c3                   	ret
+
+0000000000800cd8 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800cd8:	55                   	push   %rbp
+  800cd9:	48 89 e5             	mov    %rsp,%rbp
+  800cdc:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800ce0:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800ce4:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800ce9:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800ced:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800cf4:	48 85 ff             	test   %rdi,%rdi
+  800cf7:	74 2b                	je     800d24 <vsnprintf+0x4c>
+  800cf9:	48 85 f6             	test   %rsi,%rsi
+  800cfc:	74 26                	je     800d24 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800cfe:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800d02:	48 bf 7c 05 80 00 00 	movabs $0x80057c,%rdi
+  800d09:	00 00 00 
+  800d0c:	48 b8 d1 05 80 00 00 	movabs $0x8005d1,%rax
+  800d13:	00 00 00 
+  800d16:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800d18:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800d1c:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800d1f:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800d22:	c9                   	leave
+  800d23:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800d24:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800d29:	eb f7                	jmp    800d22 <vsnprintf+0x4a>
+
+0000000000800d2b <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800d2b:	55                   	push   %rbp
+  800d2c:	48 89 e5             	mov    %rsp,%rbp
+  800d2f:	48 83 ec 50          	sub    $0x50,%rsp
+  800d33:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800d37:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800d3b:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800d3f:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800d46:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800d4a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d4e:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800d52:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800d56:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800d5a:	48 b8 d8 0c 80 00 00 	movabs $0x800cd8,%rax
+  800d61:	00 00 00 
+  800d64:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800d66:	c9                   	leave
+  800d67:	c3                   	ret
+
+0000000000800d68 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800d68:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800d6b:	74 10                	je     800d7d <strlen+0x15>
+    size_t n = 0;
+  800d6d:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800d72:	48 83 c0 01          	add    $0x1,%rax
+  800d76:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800d7a:	75 f6                	jne    800d72 <strlen+0xa>
+  800d7c:	c3                   	ret
+    size_t n = 0;
+  800d7d:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800d82:	c3                   	ret
+
+0000000000800d83 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800d83:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800d86:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800d8b:	48 85 f6             	test   %rsi,%rsi
+  800d8e:	74 11                	je     800da1 <strnlen+0x1e>
+  800d90:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800d94:	74 0c                	je     800da2 <strnlen+0x1f>
+  800d96:	48 83 c2 01          	add    $0x1,%rdx
+  800d9a:	48 39 d0             	cmp    %rdx,%rax
+  800d9d:	75 f1                	jne    800d90 <strnlen+0xd>
+  800d9f:	eb 04                	jmp    800da5 <strnlen+0x22>
+  800da1:	c3                   	ret
+  800da2:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800da5:	c3                   	ret
+
+0000000000800da6 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800da6:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800da9:	ba 00 00 00 00       	mov    $0x0,%edx
+  800dae:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800db2:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800db5:	48 83 c2 01          	add    $0x1,%rdx
+  800db9:	84 c9                	test   %cl,%cl
+  800dbb:	75 f1                	jne    800dae <strcpy+0x8>
+        ;
+    return res;
+}
+  800dbd:	c3                   	ret
+
+0000000000800dbe <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800dbe:	55                   	push   %rbp
+  800dbf:	48 89 e5             	mov    %rsp,%rbp
+  800dc2:	41 54                	push   %r12
+  800dc4:	53                   	push   %rbx
+  800dc5:	48 89 fb             	mov    %rdi,%rbx
+  800dc8:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800dcb:	48 b8 68 0d 80 00 00 	movabs $0x800d68,%rax
+  800dd2:	00 00 00 
+  800dd5:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800dd7:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800ddb:	4c 89 e6             	mov    %r12,%rsi
+  800dde:	48 b8 a6 0d 80 00 00 	movabs $0x800da6,%rax
+  800de5:	00 00 00 
+  800de8:	ff d0                	call   *%rax
+    return dst;
+}
+  800dea:	48 89 d8             	mov    %rbx,%rax
+  800ded:	5b                   	pop    %rbx
+  800dee:	41 5c                	pop    %r12
+  800df0:	5d                   	pop    %rbp
+  800df1:	c3                   	ret
+
+0000000000800df2 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800df2:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800df5:	48 85 d2             	test   %rdx,%rdx
+  800df8:	74 1f                	je     800e19 <strncpy+0x27>
+  800dfa:	48 01 fa             	add    %rdi,%rdx
+  800dfd:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800e00:	48 83 c1 01          	add    $0x1,%rcx
+  800e04:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800e08:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800e0c:	41 80 f8 01          	cmp    $0x1,%r8b
+  800e10:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800e14:	48 39 ca             	cmp    %rcx,%rdx
+  800e17:	75 e7                	jne    800e00 <strncpy+0xe>
+    }
+    return ret;
+}
+  800e19:	c3                   	ret
+
+0000000000800e1a <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800e1a:	48 89 f8             	mov    %rdi,%rax
+  800e1d:	48 85 d2             	test   %rdx,%rdx
+  800e20:	74 24                	je     800e46 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800e22:	48 83 ea 01          	sub    $0x1,%rdx
+  800e26:	74 1b                	je     800e43 <strlcpy+0x29>
+  800e28:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800e2c:	0f b6 16             	movzbl (%rsi),%edx
+  800e2f:	84 d2                	test   %dl,%dl
+  800e31:	74 10                	je     800e43 <strlcpy+0x29>
+            *dst++ = *src++;
+  800e33:	48 83 c6 01          	add    $0x1,%rsi
+  800e37:	48 83 c0 01          	add    $0x1,%rax
+  800e3b:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800e3e:	48 39 c8             	cmp    %rcx,%rax
+  800e41:	75 e9                	jne    800e2c <strlcpy+0x12>
+        *dst = '\0';
+  800e43:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800e46:	48 29 f8             	sub    %rdi,%rax
+}
+  800e49:	c3                   	ret
+
+0000000000800e4a <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800e4a:	0f b6 07             	movzbl (%rdi),%eax
+  800e4d:	84 c0                	test   %al,%al
+  800e4f:	74 13                	je     800e64 <strcmp+0x1a>
+  800e51:	38 06                	cmp    %al,(%rsi)
+  800e53:	75 0f                	jne    800e64 <strcmp+0x1a>
+  800e55:	48 83 c7 01          	add    $0x1,%rdi
+  800e59:	48 83 c6 01          	add    $0x1,%rsi
+  800e5d:	0f b6 07             	movzbl (%rdi),%eax
+  800e60:	84 c0                	test   %al,%al
+  800e62:	75 ed                	jne    800e51 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800e64:	0f b6 c0             	movzbl %al,%eax
+  800e67:	0f b6 16             	movzbl (%rsi),%edx
+  800e6a:	29 d0                	sub    %edx,%eax
+}
+  800e6c:	c3                   	ret
+
+0000000000800e6d <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800e6d:	48 85 d2             	test   %rdx,%rdx
+  800e70:	74 1f                	je     800e91 <strncmp+0x24>
+  800e72:	0f b6 07             	movzbl (%rdi),%eax
+  800e75:	84 c0                	test   %al,%al
+  800e77:	74 1e                	je     800e97 <strncmp+0x2a>
+  800e79:	3a 06                	cmp    (%rsi),%al
+  800e7b:	75 1a                	jne    800e97 <strncmp+0x2a>
+  800e7d:	48 83 c7 01          	add    $0x1,%rdi
+  800e81:	48 83 c6 01          	add    $0x1,%rsi
+  800e85:	48 83 ea 01          	sub    $0x1,%rdx
+  800e89:	75 e7                	jne    800e72 <strncmp+0x5>
+
+    if (!n) return 0;
+  800e8b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e90:	c3                   	ret
+  800e91:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e96:	c3                   	ret
+  800e97:	48 85 d2             	test   %rdx,%rdx
+  800e9a:	74 09                	je     800ea5 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800e9c:	0f b6 07             	movzbl (%rdi),%eax
+  800e9f:	0f b6 16             	movzbl (%rsi),%edx
+  800ea2:	29 d0                	sub    %edx,%eax
+  800ea4:	c3                   	ret
+    if (!n) return 0;
+  800ea5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800eaa:	c3                   	ret
+
+0000000000800eab <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800eab:	0f b6 17             	movzbl (%rdi),%edx
+  800eae:	84 d2                	test   %dl,%dl
+  800eb0:	74 18                	je     800eca <strchr+0x1f>
+        if (*str == c) {
+  800eb2:	0f be d2             	movsbl %dl,%edx
+  800eb5:	39 f2                	cmp    %esi,%edx
+  800eb7:	74 17                	je     800ed0 <strchr+0x25>
+    for (; *str; str++) {
+  800eb9:	48 83 c7 01          	add    $0x1,%rdi
+  800ebd:	0f b6 17             	movzbl (%rdi),%edx
+  800ec0:	84 d2                	test   %dl,%dl
+  800ec2:	75 ee                	jne    800eb2 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800ec4:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ec9:	c3                   	ret
+  800eca:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ecf:	c3                   	ret
+  800ed0:	48 89 f8             	mov    %rdi,%rax
+}
+  800ed3:	c3                   	ret
+
+0000000000800ed4 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800ed4:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800ed7:	0f b6 17             	movzbl (%rdi),%edx
+  800eda:	84 d2                	test   %dl,%dl
+  800edc:	74 13                	je     800ef1 <strfind+0x1d>
+  800ede:	0f be d2             	movsbl %dl,%edx
+  800ee1:	39 f2                	cmp    %esi,%edx
+  800ee3:	74 0b                	je     800ef0 <strfind+0x1c>
+  800ee5:	48 83 c0 01          	add    $0x1,%rax
+  800ee9:	0f b6 10             	movzbl (%rax),%edx
+  800eec:	84 d2                	test   %dl,%dl
+  800eee:	75 ee                	jne    800ede <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800ef0:	c3                   	ret
+  800ef1:	c3                   	ret
+
+0000000000800ef2 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800ef2:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800ef5:	48 89 f8             	mov    %rdi,%rax
+  800ef8:	48 f7 d8             	neg    %rax
+  800efb:	83 e0 07             	and    $0x7,%eax
+  800efe:	49 89 d1             	mov    %rdx,%r9
+  800f01:	49 29 c1             	sub    %rax,%r9
+  800f04:	78 36                	js     800f3c <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800f06:	40 0f b6 c6          	movzbl %sil,%eax
+  800f0a:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800f11:	01 01 01 
+  800f14:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800f18:	40 f6 c7 07          	test   $0x7,%dil
+  800f1c:	75 38                	jne    800f56 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800f1e:	4c 89 c9             	mov    %r9,%rcx
+  800f21:	48 c1 f9 03          	sar    $0x3,%rcx
+  800f25:	74 0c                	je     800f33 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800f27:	fc                   	cld
+  800f28:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800f2b:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800f2f:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800f33:	4d 85 c9             	test   %r9,%r9
+  800f36:	75 45                	jne    800f7d <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800f38:	4c 89 c0             	mov    %r8,%rax
+  800f3b:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800f3c:	48 85 d2             	test   %rdx,%rdx
+  800f3f:	74 f7                	je     800f38 <memset+0x46>
+  800f41:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800f44:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800f47:	48 83 c0 01          	add    $0x1,%rax
+  800f4b:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  800f4f:	48 39 c2             	cmp    %rax,%rdx
+  800f52:	75 f3                	jne    800f47 <memset+0x55>
+  800f54:	eb e2                	jmp    800f38 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  800f56:	40 f6 c7 01          	test   $0x1,%dil
+  800f5a:	74 06                	je     800f62 <memset+0x70>
+  800f5c:	88 07                	mov    %al,(%rdi)
+  800f5e:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800f62:	40 f6 c7 02          	test   $0x2,%dil
+  800f66:	74 07                	je     800f6f <memset+0x7d>
+  800f68:	66 89 07             	mov    %ax,(%rdi)
+  800f6b:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800f6f:	40 f6 c7 04          	test   $0x4,%dil
+  800f73:	74 a9                	je     800f1e <memset+0x2c>
+  800f75:	89 07                	mov    %eax,(%rdi)
+  800f77:	48 83 c7 04          	add    $0x4,%rdi
+  800f7b:	eb a1                	jmp    800f1e <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800f7d:	41 f6 c1 04          	test   $0x4,%r9b
+  800f81:	74 06                	je     800f89 <memset+0x97>
+  800f83:	89 07                	mov    %eax,(%rdi)
+  800f85:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800f89:	41 f6 c1 02          	test   $0x2,%r9b
+  800f8d:	74 07                	je     800f96 <memset+0xa4>
+  800f8f:	66 89 07             	mov    %ax,(%rdi)
+  800f92:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  800f96:	41 f6 c1 01          	test   $0x1,%r9b
+  800f9a:	74 9c                	je     800f38 <memset+0x46>
+  800f9c:	88 07                	mov    %al,(%rdi)
+  800f9e:	eb 98                	jmp    800f38 <memset+0x46>
+
+0000000000800fa0 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  800fa0:	48 89 f8             	mov    %rdi,%rax
+  800fa3:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  800fa6:	48 39 fe             	cmp    %rdi,%rsi
+  800fa9:	73 3b                	jae    800fe6 <memmove+0x46>
+  800fab:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  800faf:	48 39 d7             	cmp    %rdx,%rdi
+  800fb2:	73 32                	jae    800fe6 <memmove+0x46>
+        s += n;
+        d += n;
+  800fb4:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800fb8:	48 89 d6             	mov    %rdx,%rsi
+  800fbb:	48 09 fe             	or     %rdi,%rsi
+  800fbe:	48 09 ce             	or     %rcx,%rsi
+  800fc1:	40 f6 c6 07          	test   $0x7,%sil
+  800fc5:	75 12                	jne    800fd9 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  800fc7:	48 83 ef 08          	sub    $0x8,%rdi
+  800fcb:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  800fcf:	48 c1 e9 03          	shr    $0x3,%rcx
+  800fd3:	fd                   	std
+  800fd4:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  800fd7:	fc                   	cld
+  800fd8:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  800fd9:	48 83 ef 01          	sub    $0x1,%rdi
+  800fdd:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  800fe1:	fd                   	std
+  800fe2:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  800fe4:	eb f1                	jmp    800fd7 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800fe6:	48 89 f2             	mov    %rsi,%rdx
+  800fe9:	48 09 c2             	or     %rax,%rdx
+  800fec:	48 09 ca             	or     %rcx,%rdx
+  800fef:	f6 c2 07             	test   $0x7,%dl
+  800ff2:	75 0c                	jne    801000 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  800ff4:	48 c1 e9 03          	shr    $0x3,%rcx
+  800ff8:	48 89 c7             	mov    %rax,%rdi
+  800ffb:	fc                   	cld
+  800ffc:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  800fff:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  801000:	48 89 c7             	mov    %rax,%rdi
+  801003:	fc                   	cld
+  801004:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  801006:	c3                   	ret
+
+0000000000801007 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  801007:	55                   	push   %rbp
+  801008:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  80100b:	48 b8 a0 0f 80 00 00 	movabs $0x800fa0,%rax
+  801012:	00 00 00 
+  801015:	ff d0                	call   *%rax
+}
+  801017:	5d                   	pop    %rbp
+  801018:	c3                   	ret
+
+0000000000801019 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  801019:	55                   	push   %rbp
+  80101a:	48 89 e5             	mov    %rsp,%rbp
+  80101d:	41 57                	push   %r15
+  80101f:	41 56                	push   %r14
+  801021:	41 55                	push   %r13
+  801023:	41 54                	push   %r12
+  801025:	53                   	push   %rbx
+  801026:	48 83 ec 08          	sub    $0x8,%rsp
+  80102a:	49 89 fe             	mov    %rdi,%r14
+  80102d:	49 89 f7             	mov    %rsi,%r15
+  801030:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  801033:	48 89 f7             	mov    %rsi,%rdi
+  801036:	48 b8 68 0d 80 00 00 	movabs $0x800d68,%rax
+  80103d:	00 00 00 
+  801040:	ff d0                	call   *%rax
+  801042:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  801045:	48 89 de             	mov    %rbx,%rsi
+  801048:	4c 89 f7             	mov    %r14,%rdi
+  80104b:	48 b8 83 0d 80 00 00 	movabs $0x800d83,%rax
+  801052:	00 00 00 
+  801055:	ff d0                	call   *%rax
+  801057:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  80105a:	48 39 c3             	cmp    %rax,%rbx
+  80105d:	74 36                	je     801095 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  80105f:	48 89 d8             	mov    %rbx,%rax
+  801062:	4c 29 e8             	sub    %r13,%rax
+  801065:	49 39 c4             	cmp    %rax,%r12
+  801068:	73 31                	jae    80109b <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  80106a:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  80106f:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  801073:	4c 89 fe             	mov    %r15,%rsi
+  801076:	48 b8 07 10 80 00 00 	movabs $0x801007,%rax
+  80107d:	00 00 00 
+  801080:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  801082:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  801086:	48 83 c4 08          	add    $0x8,%rsp
+  80108a:	5b                   	pop    %rbx
+  80108b:	41 5c                	pop    %r12
+  80108d:	41 5d                	pop    %r13
+  80108f:	41 5e                	pop    %r14
+  801091:	41 5f                	pop    %r15
+  801093:	5d                   	pop    %rbp
+  801094:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  801095:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  801099:	eb eb                	jmp    801086 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  80109b:	48 83 eb 01          	sub    $0x1,%rbx
+  80109f:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8010a3:	48 89 da             	mov    %rbx,%rdx
+  8010a6:	4c 89 fe             	mov    %r15,%rsi
+  8010a9:	48 b8 07 10 80 00 00 	movabs $0x801007,%rax
+  8010b0:	00 00 00 
+  8010b3:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  8010b5:	49 01 de             	add    %rbx,%r14
+  8010b8:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  8010bd:	eb c3                	jmp    801082 <strlcat+0x69>
+
+00000000008010bf <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  8010bf:	48 85 d2             	test   %rdx,%rdx
+  8010c2:	74 2d                	je     8010f1 <memcmp+0x32>
+  8010c4:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  8010c9:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  8010cd:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  8010d2:	44 38 c1             	cmp    %r8b,%cl
+  8010d5:	75 0f                	jne    8010e6 <memcmp+0x27>
+    while (n-- > 0) {
+  8010d7:	48 83 c0 01          	add    $0x1,%rax
+  8010db:	48 39 c2             	cmp    %rax,%rdx
+  8010de:	75 e9                	jne    8010c9 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  8010e0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010e5:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  8010e6:	0f b6 c1             	movzbl %cl,%eax
+  8010e9:	45 0f b6 c0          	movzbl %r8b,%r8d
+  8010ed:	44 29 c0             	sub    %r8d,%eax
+  8010f0:	c3                   	ret
+    return 0;
+  8010f1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8010f6:	c3                   	ret
+
+00000000008010f7 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  8010f7:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  8010fb:	48 39 c7             	cmp    %rax,%rdi
+  8010fe:	73 0f                	jae    80110f <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  801100:	40 38 37             	cmp    %sil,(%rdi)
+  801103:	74 0e                	je     801113 <memfind+0x1c>
+    for (; src < end; src++) {
+  801105:	48 83 c7 01          	add    $0x1,%rdi
+  801109:	48 39 f8             	cmp    %rdi,%rax
+  80110c:	75 f2                	jne    801100 <memfind+0x9>
+  80110e:	c3                   	ret
+  80110f:	48 89 f8             	mov    %rdi,%rax
+  801112:	c3                   	ret
+  801113:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  801116:	c3                   	ret
+
+0000000000801117 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  801117:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  80111a:	0f b6 37             	movzbl (%rdi),%esi
+  80111d:	40 80 fe 20          	cmp    $0x20,%sil
+  801121:	74 06                	je     801129 <strtol+0x12>
+  801123:	40 80 fe 09          	cmp    $0x9,%sil
+  801127:	75 13                	jne    80113c <strtol+0x25>
+  801129:	48 83 c7 01          	add    $0x1,%rdi
+  80112d:	0f b6 37             	movzbl (%rdi),%esi
+  801130:	40 80 fe 20          	cmp    $0x20,%sil
+  801134:	74 f3                	je     801129 <strtol+0x12>
+  801136:	40 80 fe 09          	cmp    $0x9,%sil
+  80113a:	74 ed                	je     801129 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  80113c:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  80113f:	83 e0 fd             	and    $0xfffffffd,%eax
+  801142:	3c 01                	cmp    $0x1,%al
+  801144:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801148:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  80114e:	75 0f                	jne    80115f <strtol+0x48>
+  801150:	80 3f 30             	cmpb   $0x30,(%rdi)
+  801153:	74 14                	je     801169 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  801155:	85 d2                	test   %edx,%edx
+  801157:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80115c:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  80115f:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  801164:	4c 63 ca             	movslq %edx,%r9
+  801167:	eb 36                	jmp    80119f <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801169:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  80116d:	74 0f                	je     80117e <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  80116f:	85 d2                	test   %edx,%edx
+  801171:	75 ec                	jne    80115f <strtol+0x48>
+        s++;
+  801173:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  801177:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  80117c:	eb e1                	jmp    80115f <strtol+0x48>
+        s += 2;
+  80117e:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  801182:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  801187:	eb d6                	jmp    80115f <strtol+0x48>
+            dig -= '0';
+  801189:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  80118c:	44 0f b6 c1          	movzbl %cl,%r8d
+  801190:	41 39 d0             	cmp    %edx,%r8d
+  801193:	7d 21                	jge    8011b6 <strtol+0x9f>
+        val = val * base + dig;
+  801195:	49 0f af c1          	imul   %r9,%rax
+  801199:	0f b6 c9             	movzbl %cl,%ecx
+  80119c:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  80119f:	48 83 c7 01          	add    $0x1,%rdi
+  8011a3:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  8011a7:	80 f9 39             	cmp    $0x39,%cl
+  8011aa:	76 dd                	jbe    801189 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  8011ac:	80 f9 7b             	cmp    $0x7b,%cl
+  8011af:	77 05                	ja     8011b6 <strtol+0x9f>
+            dig -= 'a' - 10;
+  8011b1:	83 e9 57             	sub    $0x57,%ecx
+  8011b4:	eb d6                	jmp    80118c <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  8011b6:	4d 85 d2             	test   %r10,%r10
+  8011b9:	74 03                	je     8011be <strtol+0xa7>
+  8011bb:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  8011be:	48 89 c2             	mov    %rax,%rdx
+  8011c1:	48 f7 da             	neg    %rdx
+  8011c4:	40 80 fe 2d          	cmp    $0x2d,%sil
+  8011c8:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  8011cc:	c3                   	ret
+
+00000000008011cd <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  8011cd:	55                   	push   %rbp
+  8011ce:	48 89 e5             	mov    %rsp,%rbp
+  8011d1:	53                   	push   %rbx
+  8011d2:	48 89 fa             	mov    %rdi,%rdx
+  8011d5:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8011d8:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8011dd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011e2:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8011e7:	be 00 00 00 00       	mov    $0x0,%esi
+  8011ec:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8011f2:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  8011f4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8011f8:	c9                   	leave
+  8011f9:	c3                   	ret
+
+00000000008011fa <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  8011fa:	55                   	push   %rbp
+  8011fb:	48 89 e5             	mov    %rsp,%rbp
+  8011fe:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8011ff:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801204:	ba 00 00 00 00       	mov    $0x0,%edx
+  801209:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80120e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801213:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801218:	be 00 00 00 00       	mov    $0x0,%esi
+  80121d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801223:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  801225:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801229:	c9                   	leave
+  80122a:	c3                   	ret
+
+000000000080122b <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  80122b:	55                   	push   %rbp
+  80122c:	48 89 e5             	mov    %rsp,%rbp
+  80122f:	53                   	push   %rbx
+  801230:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  801234:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801237:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80123c:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801241:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801246:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80124b:	be 00 00 00 00       	mov    $0x0,%esi
+  801250:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801256:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801258:	48 85 c0             	test   %rax,%rax
+  80125b:	7f 06                	jg     801263 <sys_env_destroy+0x38>
+}
+  80125d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801261:	c9                   	leave
+  801262:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801263:	49 89 c0             	mov    %rax,%r8
+  801266:	b9 03 00 00 00       	mov    $0x3,%ecx
+  80126b:	48 ba d0 3f 80 00 00 	movabs $0x803fd0,%rdx
+  801272:	00 00 00 
+  801275:	be 26 00 00 00       	mov    $0x26,%esi
+  80127a:	48 bf ef 3f 80 00 00 	movabs $0x803fef,%rdi
+  801281:	00 00 00 
+  801284:	b8 00 00 00 00       	mov    $0x0,%eax
+  801289:	49 b9 31 03 80 00 00 	movabs $0x800331,%r9
+  801290:	00 00 00 
+  801293:	41 ff d1             	call   *%r9
+
+0000000000801296 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  801296:	55                   	push   %rbp
+  801297:	48 89 e5             	mov    %rsp,%rbp
+  80129a:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80129b:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8012a0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012a5:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8012aa:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012af:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012b4:	be 00 00 00 00       	mov    $0x0,%esi
+  8012b9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8012bf:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  8012c1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012c5:	c9                   	leave
+  8012c6:	c3                   	ret
+
+00000000008012c7 <sys_yield>:
+
+void
+sys_yield(void) {
+  8012c7:	55                   	push   %rbp
+  8012c8:	48 89 e5             	mov    %rsp,%rbp
+  8012cb:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8012cc:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8012d1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012d6:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8012db:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012e0:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012e5:	be 00 00 00 00       	mov    $0x0,%esi
+  8012ea:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8012f0:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  8012f2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012f6:	c9                   	leave
+  8012f7:	c3                   	ret
+
+00000000008012f8 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  8012f8:	55                   	push   %rbp
+  8012f9:	48 89 e5             	mov    %rsp,%rbp
+  8012fc:	53                   	push   %rbx
+  8012fd:	48 89 fa             	mov    %rdi,%rdx
+  801300:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801303:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801308:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  80130f:	00 00 00 
+  801312:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801317:	be 00 00 00 00       	mov    $0x0,%esi
+  80131c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801322:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  801324:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801328:	c9                   	leave
+  801329:	c3                   	ret
+
+000000000080132a <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  80132a:	55                   	push   %rbp
+  80132b:	48 89 e5             	mov    %rsp,%rbp
+  80132e:	53                   	push   %rbx
+  80132f:	49 89 f8             	mov    %rdi,%r8
+  801332:	48 89 d3             	mov    %rdx,%rbx
+  801335:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801338:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80133d:	4c 89 c2             	mov    %r8,%rdx
+  801340:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801343:	be 00 00 00 00       	mov    $0x0,%esi
+  801348:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80134e:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  801350:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801354:	c9                   	leave
+  801355:	c3                   	ret
+
+0000000000801356 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  801356:	55                   	push   %rbp
+  801357:	48 89 e5             	mov    %rsp,%rbp
+  80135a:	53                   	push   %rbx
+  80135b:	48 83 ec 08          	sub    $0x8,%rsp
+  80135f:	89 f8                	mov    %edi,%eax
+  801361:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  801364:	48 63 f9             	movslq %ecx,%rdi
+  801367:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80136a:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80136f:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801372:	be 00 00 00 00       	mov    $0x0,%esi
+  801377:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80137d:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80137f:	48 85 c0             	test   %rax,%rax
+  801382:	7f 06                	jg     80138a <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  801384:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801388:	c9                   	leave
+  801389:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80138a:	49 89 c0             	mov    %rax,%r8
+  80138d:	b9 04 00 00 00       	mov    $0x4,%ecx
+  801392:	48 ba d0 3f 80 00 00 	movabs $0x803fd0,%rdx
+  801399:	00 00 00 
+  80139c:	be 26 00 00 00       	mov    $0x26,%esi
+  8013a1:	48 bf ef 3f 80 00 00 	movabs $0x803fef,%rdi
+  8013a8:	00 00 00 
+  8013ab:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013b0:	49 b9 31 03 80 00 00 	movabs $0x800331,%r9
+  8013b7:	00 00 00 
+  8013ba:	41 ff d1             	call   *%r9
+
+00000000008013bd <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8013bd:	55                   	push   %rbp
+  8013be:	48 89 e5             	mov    %rsp,%rbp
+  8013c1:	53                   	push   %rbx
+  8013c2:	48 83 ec 08          	sub    $0x8,%rsp
+  8013c6:	89 f8                	mov    %edi,%eax
+  8013c8:	49 89 f2             	mov    %rsi,%r10
+  8013cb:	48 89 cf             	mov    %rcx,%rdi
+  8013ce:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  8013d1:	48 63 da             	movslq %edx,%rbx
+  8013d4:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8013d7:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8013dc:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013df:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  8013e2:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8013e4:	48 85 c0             	test   %rax,%rax
+  8013e7:	7f 06                	jg     8013ef <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8013e9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013ed:	c9                   	leave
+  8013ee:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8013ef:	49 89 c0             	mov    %rax,%r8
+  8013f2:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8013f7:	48 ba d0 3f 80 00 00 	movabs $0x803fd0,%rdx
+  8013fe:	00 00 00 
+  801401:	be 26 00 00 00       	mov    $0x26,%esi
+  801406:	48 bf ef 3f 80 00 00 	movabs $0x803fef,%rdi
+  80140d:	00 00 00 
+  801410:	b8 00 00 00 00       	mov    $0x0,%eax
+  801415:	49 b9 31 03 80 00 00 	movabs $0x800331,%r9
+  80141c:	00 00 00 
+  80141f:	41 ff d1             	call   *%r9
+
+0000000000801422 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  801422:	55                   	push   %rbp
+  801423:	48 89 e5             	mov    %rsp,%rbp
+  801426:	53                   	push   %rbx
+  801427:	48 83 ec 08          	sub    $0x8,%rsp
+  80142b:	48 89 f1             	mov    %rsi,%rcx
+  80142e:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  801431:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801434:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801439:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80143e:	be 00 00 00 00       	mov    $0x0,%esi
+  801443:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801449:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80144b:	48 85 c0             	test   %rax,%rax
+  80144e:	7f 06                	jg     801456 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  801450:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801454:	c9                   	leave
+  801455:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801456:	49 89 c0             	mov    %rax,%r8
+  801459:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80145e:	48 ba d0 3f 80 00 00 	movabs $0x803fd0,%rdx
+  801465:	00 00 00 
+  801468:	be 26 00 00 00       	mov    $0x26,%esi
+  80146d:	48 bf ef 3f 80 00 00 	movabs $0x803fef,%rdi
+  801474:	00 00 00 
+  801477:	b8 00 00 00 00       	mov    $0x0,%eax
+  80147c:	49 b9 31 03 80 00 00 	movabs $0x800331,%r9
+  801483:	00 00 00 
+  801486:	41 ff d1             	call   *%r9
+
+0000000000801489 <sys_region_batch>:
+
+int
+sys_region_batch(const struct RegionOp *ops, size_t count) {
+  801489:	55                   	push   %rbp
+  80148a:	48 89 e5             	mov    %rsp,%rbp
+  80148d:	53                   	push   %rbx
+  80148e:	48 83 ec 08          	sub    $0x8,%rsp
+  801492:	48 89 fa             	mov    %rdi,%rdx
+  801495:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801498:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80149d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014a2:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014a7:	be 00 00 00 00       	mov    $0x0,%esi
+  8014ac:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014b2:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8014b4:	48 85 c0             	test   %rax,%rax
+  8014b7:	7f 06                	jg     8014bf <sys_region_batch+0x36>
+        else
+            platform_asan_unpoison(va, ops[i].size);
+    }
+#endif
+    return res;
+}
+  8014b9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014bd:	c9                   	leave
+  8014be:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8014bf:	49 89 c0             	mov    %rax,%r8
+  8014c2:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  8014c7:	48 ba d0 3f 80 00 00 	movabs $0x803fd0,%rdx
+  8014ce:	00 00 00 
+  8014d1:	be 26 00 00 00       	mov    $0x26,%esi
+  8014d6:	48 bf ef 3f 80 00 00 	movabs $0x803fef,%rdi
+  8014dd:	00 00 00 
+  8014e0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014e5:	49 b9 31 03 80 00 00 	movabs $0x800331,%r9
+  8014ec:	00 00 00 
+  8014ef:	41 ff d1             	call   *%r9
+
+00000000008014f2 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  8014f2:	55                   	push   %rbp
+  8014f3:	48 89 e5             	mov    %rsp,%rbp
+  8014f6:	53                   	push   %rbx
+  8014f7:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  8014fb:	48 63 ce             	movslq %esi,%rcx
+  8014fe:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801501:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801506:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80150b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801510:	be 00 00 00 00       	mov    $0x0,%esi
+  801515:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80151b:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80151d:	48 85 c0             	test   %rax,%rax
+  801520:	7f 06                	jg     801528 <sys_env_set_status+0x36>
+}
+  801522:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801526:	c9                   	leave
+  801527:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801528:	49 89 c0             	mov    %rax,%r8
+  80152b:	b9 09 00 00 00       	mov    $0x9,%ecx
+  801530:	48 ba d0 3f 80 00 00 	movabs $0x803fd0,%rdx
+  801537:	00 00 00 
+  80153a:	be 26 00 00 00       	mov    $0x26,%esi
+  80153f:	48 bf ef 3f 80 00 00 	movabs $0x803fef,%rdi
+  801546:	00 00 00 
+  801549:	b8 00 00 00 00       	mov    $0x0,%eax
+  80154e:	49 b9 31 03 80 00 00 	movabs $0x800331,%r9
+  801555:	00 00 00 
+  801558:	41 ff d1             	call   *%r9
+
+000000000080155b <sys_env_set_weight>:
+
+int
+sys_env_set_weight(envid_t envid, uint32_t weight) {
+  80155b:	55                   	push   %rbp
+  80155c:	48 89 e5             	mov    %rsp,%rbp
+  80155f:	53                   	push   %rbx
+  801560:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_weight, 1, envid, weight, 0, 0, 0, 0);
+  801564:	89 f1                	mov    %esi,%ecx
+  801566:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801569:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80156e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801573:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801578:	be 00 00 00 00       	mov    $0x0,%esi
+  80157d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801583:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801585:	48 85 c0             	test   %rax,%rax
+  801588:	7f 06                	jg     801590 <sys_env_set_weight+0x35>
+}
+  80158a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80158e:	c9                   	leave
+  80158f:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801590:	49 89 c0             	mov    %rax,%r8
+  801593:	b9 10 00 00 00       	mov    $0x10,%ecx
+  801598:	48 ba d0 3f 80 00 00 	movabs $0x803fd0,%rdx
+  80159f:	00 00 00 
+  8015a2:	be 26 00 00 00       	mov    $0x26,%esi
+  8015a7:	48 bf ef 3f 80 00 00 	movabs $0x803fef,%rdi
+  8015ae:	00 00 00 
+  8015b1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015b6:	49 b9 31 03 80 00 00 	movabs $0x800331,%r9
+  8015bd:	00 00 00 
+  8015c0:	41 ff d1             	call   *%r9
+
+00000000008015c3 <sys_env_set_rt>:
+
+int
+sys_env_set_rt(envid_t envid, uint64_t period, uint64_t budget, uint64_t deadline) {
+  8015c3:	55                   	push   %rbp
+  8015c4:	48 89 e5             	mov    %rsp,%rbp
+  8015c7:	53                   	push   %rbx
+  8015c8:	48 83 ec 08          	sub    $0x8,%rsp
+  8015cc:	89 f8                	mov    %edi,%eax
+  8015ce:	48 89 d3             	mov    %rdx,%rbx
+  8015d1:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_env_set_rt, 1, envid, period, budget, deadline, 0, 0);
+  8015d4:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8015d7:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8015dc:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015df:	be 00 00 00 00       	mov    $0x0,%esi
+  8015e4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015ea:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8015ec:	48 85 c0             	test   %rax,%rax
+  8015ef:	7f 06                	jg     8015f7 <sys_env_set_rt+0x34>
+}
+  8015f1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015f5:	c9                   	leave
+  8015f6:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8015f7:	49 89 c0             	mov    %rax,%r8
+  8015fa:	b9 11 00 00 00       	mov    $0x11,%ecx
+  8015ff:	48 ba d0 3f 80 00 00 	movabs $0x803fd0,%rdx
+  801606:	00 00 00 
+  801609:	be 26 00 00 00       	mov    $0x26,%esi
+  80160e:	48 bf ef 3f 80 00 00 	movabs $0x803fef,%rdi
+  801615:	00 00 00 
+  801618:	b8 00 00 00 00       	mov    $0x0,%eax
+  80161d:	49 b9 31 03 80 00 00 	movabs $0x800331,%r9
+  801624:	00 00 00 
+  801627:	41 ff d1             	call   *%r9
+
+000000000080162a <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  80162a:	55                   	push   %rbp
+  80162b:	48 89 e5             	mov    %rsp,%rbp
+  80162e:	53                   	push   %rbx
+  80162f:	48 83 ec 08          	sub    $0x8,%rsp
+  801633:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  801636:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801639:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80163e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801643:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801648:	be 00 00 00 00       	mov    $0x0,%esi
+  80164d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801653:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801655:	48 85 c0             	test   %rax,%rax
+  801658:	7f 06                	jg     801660 <sys_env_set_trapframe+0x36>
+}
+  80165a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80165e:	c9                   	leave
+  80165f:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801660:	49 89 c0             	mov    %rax,%r8
+  801663:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  801668:	48 ba d0 3f 80 00 00 	movabs $0x803fd0,%rdx
+  80166f:	00 00 00 
+  801672:	be 26 00 00 00       	mov    $0x26,%esi
+  801677:	48 bf ef 3f 80 00 00 	movabs $0x803fef,%rdi
+  80167e:	00 00 00 
+  801681:	b8 00 00 00 00       	mov    $0x0,%eax
+  801686:	49 b9 31 03 80 00 00 	movabs $0x800331,%r9
+  80168d:	00 00 00 
+  801690:	41 ff d1             	call   *%r9
+
+0000000000801693 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  801693:	55                   	push   %rbp
+  801694:	48 89 e5             	mov    %rsp,%rbp
+  801697:	53                   	push   %rbx
+  801698:	48 83 ec 08          	sub    $0x8,%rsp
+  80169c:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  80169f:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8016a2:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8016a7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016ac:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8016b1:	be 00 00 00 00       	mov    $0x0,%esi
+  8016b6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8016bc:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8016be:	48 85 c0             	test   %rax,%rax
+  8016c1:	7f 06                	jg     8016c9 <sys_env_set_pgfault_upcall+0x36>
+}
+  8016c3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8016c7:	c9                   	leave
+  8016c8:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8016c9:	49 89 c0             	mov    %rax,%r8
+  8016cc:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  8016d1:	48 ba d0 3f 80 00 00 	movabs $0x803fd0,%rdx
+  8016d8:	00 00 00 
+  8016db:	be 26 00 00 00       	mov    $0x26,%esi
+  8016e0:	48 bf ef 3f 80 00 00 	movabs $0x803fef,%rdi
+  8016e7:	00 00 00 
+  8016ea:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016ef:	49 b9 31 03 80 00 00 	movabs $0x800331,%r9
+  8016f6:	00 00 00 
+  8016f9:	41 ff d1             	call   *%r9
+
+00000000008016fc <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  8016fc:	55                   	push   %rbp
+  8016fd:	48 89 e5             	mov    %rsp,%rbp
+  801700:	53                   	push   %rbx
+  801701:	89 f8                	mov    %edi,%eax
+  801703:	49 89 f1             	mov    %rsi,%r9
+  801706:	48 89 d3             	mov    %rdx,%rbx
+  801709:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  80170c:	49 63 f0             	movslq %r8d,%rsi
+  80170f:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801712:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801717:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80171a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801720:	cd 30                	int    $0x30
+}
+  801722:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801726:	c9                   	leave
+  801727:	c3                   	ret
+
+0000000000801728 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  801728:	55                   	push   %rbp
+  801729:	48 89 e5             	mov    %rsp,%rbp
+  80172c:	53                   	push   %rbx
+  80172d:	48 83 ec 08          	sub    $0x8,%rsp
+  801731:	48 89 fa             	mov    %rdi,%rdx
+  801734:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801737:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80173c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801741:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801746:	be 00 00 00 00       	mov    $0x0,%esi
+  80174b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801751:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801753:	48 85 c0             	test   %rax,%rax
+  801756:	7f 06                	jg     80175e <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801758:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80175c:	c9                   	leave
+  80175d:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80175e:	49 89 c0             	mov    %rax,%r8
+  801761:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  801766:	48 ba d0 3f 80 00 00 	movabs $0x803fd0,%rdx
+  80176d:	00 00 00 
+  801770:	be 26 00 00 00       	mov    $0x26,%esi
+  801775:	48 bf ef 3f 80 00 00 	movabs $0x803fef,%rdi
+  80177c:	00 00 00 
+  80177f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801784:	49 b9 31 03 80 00 00 	movabs $0x800331,%r9
+  80178b:	00 00 00 
+  80178e:	41 ff d1             	call   *%r9
+
+0000000000801791 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801791:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801798:	ff ff ff 
+  80179b:	48 01 f8             	add    %rdi,%rax
+  80179e:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  8017a2:	c3                   	ret
+
+00000000008017a3 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8017a3:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8017aa:	ff ff ff 
+  8017ad:	48 01 f8             	add    %rdi,%rax
+  8017b0:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  8017b4:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  8017ba:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  8017be:	c3                   	ret
+
+00000000008017bf <fd_alloc_from>:
+}
+
+/* Like fd_alloc(), but only considers fds starting from fdnum,
+ * so that several fds can be found before their pages are allocated */
+int
+fd_alloc_from(int fdnum, struct Fd **fd_store) {
+  8017bf:	55                   	push   %rbp
+  8017c0:	48 89 e5             	mov    %rsp,%rbp
+  8017c3:	41 57                	push   %r15
+  8017c5:	41 56                	push   %r14
+  8017c7:	41 55                	push   %r13
+  8017c9:	41 54                	push   %r12
+  8017cb:	53                   	push   %rbx
+  8017cc:	48 83 ec 08          	sub    $0x8,%rsp
+  8017d0:	49 89 f7             	mov    %rsi,%r15
+    for (int i = MAX(fdnum, 0); i < MAXFD; i++) {
+  8017d3:	85 ff                	test   %edi,%edi
+  8017d5:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8017db:	44 0f 49 e7          	cmovns %edi,%r12d
+  8017df:	83 ff 1f             	cmp    $0x1f,%edi
+  8017e2:	7f 37                	jg     80181b <fd_alloc_from+0x5c>
+  8017e4:	49 63 dc             	movslq %r12d,%rbx
+  8017e7:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  8017ee:	48 c1 e3 0c          	shl    $0xc,%rbx
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  8017f2:	49 be 91 33 80 00 00 	movabs $0x803391,%r14
+  8017f9:	00 00 00 
+        struct Fd *fd = INDEX2FD(i);
+  8017fc:	49 89 dd             	mov    %rbx,%r13
+        if (!(get_prot(fd) & PROT_R)) {
+  8017ff:	48 89 df             	mov    %rbx,%rdi
+  801802:	41 ff d6             	call   *%r14
+  801805:	83 e0 04             	and    $0x4,%eax
+  801808:	74 1c                	je     801826 <fd_alloc_from+0x67>
+    for (int i = MAX(fdnum, 0); i < MAXFD; i++) {
+  80180a:	41 83 c4 01          	add    $0x1,%r12d
+  80180e:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801815:	41 83 fc 1f          	cmp    $0x1f,%r12d
+  801819:	7e e1                	jle    8017fc <fd_alloc_from+0x3d>
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  80181b:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801821:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  801826:	4d 89 2f             	mov    %r13,(%r15)
+}
+  801829:	48 83 c4 08          	add    $0x8,%rsp
+  80182d:	5b                   	pop    %rbx
+  80182e:	41 5c                	pop    %r12
+  801830:	41 5d                	pop    %r13
+  801832:	41 5e                	pop    %r14
+  801834:	41 5f                	pop    %r15
+  801836:	5d                   	pop    %rbp
+  801837:	c3                   	ret
+
+0000000000801838 <fd_alloc>:
+fd_alloc(struct Fd **fd_store) {
+  801838:	55                   	push   %rbp
+  801839:	48 89 e5             	mov    %rsp,%rbp
+  80183c:	48 89 fe             	mov    %rdi,%rsi
+    return fd_alloc_from(0, fd_store);
+  80183f:	bf 00 00 00 00       	mov    $0x0,%edi
+  801844:	48 b8 bf 17 80 00 00 	movabs $0x8017bf,%rax
+  80184b:	00 00 00 
+  80184e:	ff d0                	call   *%rax
+}
+  801850:	5d                   	pop    %rbp
+  801851:	c3                   	ret
+
+0000000000801852 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  801852:	83 ff 1f             	cmp    $0x1f,%edi
+  801855:	77 39                	ja     801890 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  801857:	55                   	push   %rbp
+  801858:	48 89 e5             	mov    %rsp,%rbp
+  80185b:	41 54                	push   %r12
+  80185d:	53                   	push   %rbx
+  80185e:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  801861:	48 63 df             	movslq %edi,%rbx
+  801864:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  80186b:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  80186f:	48 89 df             	mov    %rbx,%rdi
+  801872:	48 b8 91 33 80 00 00 	movabs $0x803391,%rax
+  801879:	00 00 00 
+  80187c:	ff d0                	call   *%rax
+  80187e:	a8 04                	test   $0x4,%al
+  801880:	74 14                	je     801896 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  801882:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  801886:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80188b:	5b                   	pop    %rbx
+  80188c:	41 5c                	pop    %r12
+  80188e:	5d                   	pop    %rbp
+  80188f:	c3                   	ret
+        return -E_INVAL;
+  801890:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801895:	c3                   	ret
+        return -E_INVAL;
+  801896:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80189b:	eb ee                	jmp    80188b <fd_lookup+0x39>
+
+000000000080189d <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  80189d:	55                   	push   %rbp
+  80189e:	48 89 e5             	mov    %rsp,%rbp
+  8018a1:	41 54                	push   %r12
+  8018a3:	53                   	push   %rbx
+  8018a4:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  8018a7:	48 b8 80 40 80 00 00 	movabs $0x804080,%rax
+  8018ae:	00 00 00 
+  8018b1:	48 bb 20 50 80 00 00 	movabs $0x805020,%rbx
+  8018b8:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  8018bb:	39 3b                	cmp    %edi,(%rbx)
+  8018bd:	74 47                	je     801906 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  8018bf:	48 83 c0 08          	add    $0x8,%rax
+  8018c3:	48 8b 18             	mov    (%rax),%rbx
+  8018c6:	48 85 db             	test   %rbx,%rbx
+  8018c9:	75 f0                	jne    8018bb <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8018cb:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  8018d2:	00 00 00 
+  8018d5:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+  8018db:	89 fa                	mov    %edi,%edx
+  8018dd:	48 bf 00 40 80 00 00 	movabs $0x804000,%rdi
+  8018e4:	00 00 00 
+  8018e7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018ec:	48 b9 81 04 80 00 00 	movabs $0x800481,%rcx
+  8018f3:	00 00 00 
+  8018f6:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  8018f8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  8018fd:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  801901:	5b                   	pop    %rbx
+  801902:	41 5c                	pop    %r12
+  801904:	5d                   	pop    %rbp
+  801905:	c3                   	ret
+            return 0;
+  801906:	b8 00 00 00 00       	mov    $0x0,%eax
+  80190b:	eb f0                	jmp    8018fd <dev_lookup+0x60>
+
+000000000080190d <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  80190d:	55                   	push   %rbp
+  80190e:	48 89 e5             	mov    %rsp,%rbp
+  801911:	41 55                	push   %r13
+  801913:	41 54                	push   %r12
+  801915:	53                   	push   %rbx
+  801916:	48 83 ec 18          	sub    $0x18,%rsp
+  80191a:	48 89 fb             	mov    %rdi,%rbx
+  80191d:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801920:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  801927:	ff ff ff 
+  80192a:	48 01 df             	add    %rbx,%rdi
+  80192d:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  801931:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801935:	48 b8 52 18 80 00 00 	movabs $0x801852,%rax
+  80193c:	00 00 00 
+  80193f:	ff d0                	call   *%rax
+  801941:	41 89 c5             	mov    %eax,%r13d
+  801944:	85 c0                	test   %eax,%eax
+  801946:	78 06                	js     80194e <fd_close+0x41>
+  801948:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  80194c:	74 1a                	je     801968 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  80194e:	45 84 e4             	test   %r12b,%r12b
+  801951:	b8 00 00 00 00       	mov    $0x0,%eax
+  801956:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  80195a:	44 89 e8             	mov    %r13d,%eax
+  80195d:	48 83 c4 18          	add    $0x18,%rsp
+  801961:	5b                   	pop    %rbx
+  801962:	41 5c                	pop    %r12
+  801964:	41 5d                	pop    %r13
+  801966:	5d                   	pop    %rbp
+  801967:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801968:	8b 3b                	mov    (%rbx),%edi
+  80196a:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80196e:	48 b8 9d 18 80 00 00 	movabs $0x80189d,%rax
+  801975:	00 00 00 
+  801978:	ff d0                	call   *%rax
+  80197a:	41 89 c5             	mov    %eax,%r13d
+  80197d:	85 c0                	test   %eax,%eax
+  80197f:	78 1b                	js     80199c <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  801981:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801985:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801989:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  80198f:	48 85 c0             	test   %rax,%rax
+  801992:	74 08                	je     80199c <fd_close+0x8f>
+  801994:	48 89 df             	mov    %rbx,%rdi
+  801997:	ff d0                	call   *%rax
+  801999:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  80199c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8019a1:	48 89 de             	mov    %rbx,%rsi
+  8019a4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8019a9:	48 b8 22 14 80 00 00 	movabs $0x801422,%rax
+  8019b0:	00 00 00 
+  8019b3:	ff d0                	call   *%rax
+    return res;
+  8019b5:	eb a3                	jmp    80195a <fd_close+0x4d>
+
+00000000008019b7 <close>:
+
+int
+close(int fdnum) {
+  8019b7:	55                   	push   %rbp
+  8019b8:	48 89 e5             	mov    %rsp,%rbp
+  8019bb:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  8019bf:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8019c3:	48 b8 52 18 80 00 00 	movabs $0x801852,%rax
+  8019ca:	00 00 00 
+  8019cd:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8019cf:	85 c0                	test   %eax,%eax
+  8019d1:	78 15                	js     8019e8 <close+0x31>
+
+    return fd_close(fd, 1);
+  8019d3:	be 01 00 00 00       	mov    $0x1,%esi
+  8019d8:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8019dc:	48 b8 0d 19 80 00 00 	movabs $0x80190d,%rax
+  8019e3:	00 00 00 
+  8019e6:	ff d0                	call   *%rax
+}
+  8019e8:	c9                   	leave
+  8019e9:	c3                   	ret
+
+00000000008019ea <close_all>:
+
+void
+close_all(void) {
+  8019ea:	55                   	push   %rbp
+  8019eb:	48 89 e5             	mov    %rsp,%rbp
+  8019ee:	41 54                	push   %r12
+  8019f0:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  8019f1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8019f6:	49 bc b7 19 80 00 00 	movabs $0x8019b7,%r12
+  8019fd:	00 00 00 
+  801a00:	89 df                	mov    %ebx,%edi
+  801a02:	41 ff d4             	call   *%r12
+  801a05:	83 c3 01             	add    $0x1,%ebx
+  801a08:	83 fb 20             	cmp    $0x20,%ebx
+  801a0b:	75 f3                	jne    801a00 <close_all+0x16>
+}
+  801a0d:	5b                   	pop    %rbx
+  801a0e:	41 5c                	pop    %r12
+  801a10:	5d                   	pop    %rbp
+  801a11:	c3                   	ret
+
+0000000000801a12 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  801a12:	55                   	push   %rbp
+  801a13:	48 89 e5             	mov    %rsp,%rbp
+  801a16:	41 57                	push   %r15
+  801a18:	41 56                	push   %r14
+  801a1a:	41 55                	push   %r13
+  801a1c:	41 54                	push   %r12
+  801a1e:	53                   	push   %rbx
+  801a1f:	48 83 ec 18          	sub    $0x18,%rsp
+  801a23:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  801a26:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801a2a:	48 b8 52 18 80 00 00 	movabs $0x801852,%rax
+  801a31:	00 00 00 
+  801a34:	ff d0                	call   *%rax
+  801a36:	89 c3                	mov    %eax,%ebx
+  801a38:	85 c0                	test   %eax,%eax
+  801a3a:	0f 88 b8 00 00 00    	js     801af8 <dup+0xe6>
+    close(newfdnum);
+  801a40:	44 89 e7             	mov    %r12d,%edi
+  801a43:	48 b8 b7 19 80 00 00 	movabs $0x8019b7,%rax
+  801a4a:	00 00 00 
+  801a4d:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  801a4f:	4d 63 ec             	movslq %r12d,%r13
+  801a52:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  801a59:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  801a5d:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  801a61:	4c 89 ff             	mov    %r15,%rdi
+  801a64:	49 be a3 17 80 00 00 	movabs $0x8017a3,%r14
+  801a6b:	00 00 00 
+  801a6e:	41 ff d6             	call   *%r14
+  801a71:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  801a74:	4c 89 ef             	mov    %r13,%rdi
+  801a77:	41 ff d6             	call   *%r14
+  801a7a:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  801a7d:	48 89 df             	mov    %rbx,%rdi
+  801a80:	48 b8 91 33 80 00 00 	movabs $0x803391,%rax
+  801a87:	00 00 00 
+  801a8a:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  801a8c:	a8 04                	test   $0x4,%al
+  801a8e:	74 2b                	je     801abb <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  801a90:	41 89 c1             	mov    %eax,%r9d
+  801a93:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801a99:	4c 89 f1             	mov    %r14,%rcx
+  801a9c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801aa1:	48 89 de             	mov    %rbx,%rsi
+  801aa4:	bf 00 00 00 00       	mov    $0x0,%edi
+  801aa9:	48 b8 bd 13 80 00 00 	movabs $0x8013bd,%rax
+  801ab0:	00 00 00 
+  801ab3:	ff d0                	call   *%rax
+  801ab5:	89 c3                	mov    %eax,%ebx
+  801ab7:	85 c0                	test   %eax,%eax
+  801ab9:	78 4e                	js     801b09 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  801abb:	4c 89 ff             	mov    %r15,%rdi
+  801abe:	48 b8 91 33 80 00 00 	movabs $0x803391,%rax
+  801ac5:	00 00 00 
+  801ac8:	ff d0                	call   *%rax
+  801aca:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801acd:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801ad3:	4c 89 e9             	mov    %r13,%rcx
+  801ad6:	ba 00 00 00 00       	mov    $0x0,%edx
+  801adb:	4c 89 fe             	mov    %r15,%rsi
+  801ade:	bf 00 00 00 00       	mov    $0x0,%edi
+  801ae3:	48 b8 bd 13 80 00 00 	movabs $0x8013bd,%rax
+  801aea:	00 00 00 
+  801aed:	ff d0                	call   *%rax
+  801aef:	89 c3                	mov    %eax,%ebx
+  801af1:	85 c0                	test   %eax,%eax
+  801af3:	78 14                	js     801b09 <dup+0xf7>
+
+    return newfdnum;
+  801af5:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  801af8:	89 d8                	mov    %ebx,%eax
+  801afa:	48 83 c4 18          	add    $0x18,%rsp
+  801afe:	5b                   	pop    %rbx
+  801aff:	41 5c                	pop    %r12
+  801b01:	41 5d                	pop    %r13
+  801b03:	41 5e                	pop    %r14
+  801b05:	41 5f                	pop    %r15
+  801b07:	5d                   	pop    %rbp
+  801b08:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  801b09:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801b0e:	4c 89 ee             	mov    %r13,%rsi
+  801b11:	bf 00 00 00 00       	mov    $0x0,%edi
+  801b16:	49 bc 22 14 80 00 00 	movabs $0x801422,%r12
+  801b1d:	00 00 00 
+  801b20:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  801b23:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801b28:	4c 89 f6             	mov    %r14,%rsi
+  801b2b:	bf 00 00 00 00       	mov    $0x0,%edi
+  801b30:	41 ff d4             	call   *%r12
+    return res;
+  801b33:	eb c3                	jmp    801af8 <dup+0xe6>
+
+0000000000801b35 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  801b35:	55                   	push   %rbp
+  801b36:	48 89 e5             	mov    %rsp,%rbp
+  801b39:	41 56                	push   %r14
+  801b3b:	41 55                	push   %r13
+  801b3d:	41 54                	push   %r12
+  801b3f:	53                   	push   %rbx
+  801b40:	48 83 ec 10          	sub    $0x10,%rsp
+  801b44:	89 fb                	mov    %edi,%ebx
+  801b46:	49 89 f4             	mov    %rsi,%r12
+  801b49:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801b4c:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801b50:	48 b8 52 18 80 00 00 	movabs $0x801852,%rax
+  801b57:	00 00 00 
+  801b5a:	ff d0                	call   *%rax
+  801b5c:	85 c0                	test   %eax,%eax
+  801b5e:	78 4c                	js     801bac <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801b60:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801b64:	41 8b 3e             	mov    (%r14),%edi
+  801b67:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801b6b:	48 b8 9d 18 80 00 00 	movabs $0x80189d,%rax
+  801b72:	00 00 00 
+  801b75:	ff d0                	call   *%rax
+  801b77:	85 c0                	test   %eax,%eax
+  801b79:	78 35                	js     801bb0 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801b7b:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801b7f:	83 e0 03             	and    $0x3,%eax
+  801b82:	83 f8 01             	cmp    $0x1,%eax
+  801b85:	74 2d                	je     801bb4 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801b87:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801b8b:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801b8f:	48 85 c0             	test   %rax,%rax
+  801b92:	74 56                	je     801bea <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  801b94:	4c 89 ea             	mov    %r13,%rdx
+  801b97:	4c 89 e6             	mov    %r12,%rsi
+  801b9a:	4c 89 f7             	mov    %r14,%rdi
+  801b9d:	ff d0                	call   *%rax
+}
+  801b9f:	48 83 c4 10          	add    $0x10,%rsp
+  801ba3:	5b                   	pop    %rbx
+  801ba4:	41 5c                	pop    %r12
+  801ba6:	41 5d                	pop    %r13
+  801ba8:	41 5e                	pop    %r14
+  801baa:	5d                   	pop    %rbp
+  801bab:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801bac:	48 98                	cltq
+  801bae:	eb ef                	jmp    801b9f <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801bb0:	48 98                	cltq
+  801bb2:	eb eb                	jmp    801b9f <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801bb4:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  801bbb:	00 00 00 
+  801bbe:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+  801bc4:	89 da                	mov    %ebx,%edx
+  801bc6:	48 bf 41 40 80 00 00 	movabs $0x804041,%rdi
+  801bcd:	00 00 00 
+  801bd0:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bd5:	48 b9 81 04 80 00 00 	movabs $0x800481,%rcx
+  801bdc:	00 00 00 
+  801bdf:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801be1:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801be8:	eb b5                	jmp    801b9f <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801bea:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801bf1:	eb ac                	jmp    801b9f <read+0x6a>
+
+0000000000801bf3 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801bf3:	55                   	push   %rbp
+  801bf4:	48 89 e5             	mov    %rsp,%rbp
+  801bf7:	41 57                	push   %r15
+  801bf9:	41 56                	push   %r14
+  801bfb:	41 55                	push   %r13
+  801bfd:	41 54                	push   %r12
+  801bff:	53                   	push   %rbx
+  801c00:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  801c04:	48 85 d2             	test   %rdx,%rdx
+  801c07:	74 54                	je     801c5d <readn+0x6a>
+  801c09:	41 89 fd             	mov    %edi,%r13d
+  801c0c:	49 89 f6             	mov    %rsi,%r14
+  801c0f:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  801c12:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  801c17:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  801c1c:	49 bf 35 1b 80 00 00 	movabs $0x801b35,%r15
+  801c23:	00 00 00 
+  801c26:	4c 89 e2             	mov    %r12,%rdx
+  801c29:	48 29 f2             	sub    %rsi,%rdx
+  801c2c:	4c 01 f6             	add    %r14,%rsi
+  801c2f:	44 89 ef             	mov    %r13d,%edi
+  801c32:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  801c35:	85 c0                	test   %eax,%eax
+  801c37:	78 20                	js     801c59 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  801c39:	01 c3                	add    %eax,%ebx
+  801c3b:	85 c0                	test   %eax,%eax
+  801c3d:	74 08                	je     801c47 <readn+0x54>
+  801c3f:	48 63 f3             	movslq %ebx,%rsi
+  801c42:	4c 39 e6             	cmp    %r12,%rsi
+  801c45:	72 df                	jb     801c26 <readn+0x33>
+    }
+    return res;
+  801c47:	48 63 c3             	movslq %ebx,%rax
+}
+  801c4a:	48 83 c4 08          	add    $0x8,%rsp
+  801c4e:	5b                   	pop    %rbx
+  801c4f:	41 5c                	pop    %r12
+  801c51:	41 5d                	pop    %r13
+  801c53:	41 5e                	pop    %r14
+  801c55:	41 5f                	pop    %r15
+  801c57:	5d                   	pop    %rbp
+  801c58:	c3                   	ret
+        if (inc < 0) return inc;
+  801c59:	48 98                	cltq
+  801c5b:	eb ed                	jmp    801c4a <readn+0x57>
+    int inc = 1, res = 0;
+  801c5d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801c62:	eb e3                	jmp    801c47 <readn+0x54>
+
+0000000000801c64 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  801c64:	55                   	push   %rbp
+  801c65:	48 89 e5             	mov    %rsp,%rbp
+  801c68:	41 56                	push   %r14
+  801c6a:	41 55                	push   %r13
+  801c6c:	41 54                	push   %r12
+  801c6e:	53                   	push   %rbx
+  801c6f:	48 83 ec 10          	sub    $0x10,%rsp
+  801c73:	89 fb                	mov    %edi,%ebx
+  801c75:	49 89 f4             	mov    %rsi,%r12
+  801c78:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801c7b:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801c7f:	48 b8 52 18 80 00 00 	movabs $0x801852,%rax
+  801c86:	00 00 00 
+  801c89:	ff d0                	call   *%rax
+  801c8b:	85 c0                	test   %eax,%eax
+  801c8d:	78 47                	js     801cd6 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801c8f:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801c93:	41 8b 3e             	mov    (%r14),%edi
+  801c96:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801c9a:	48 b8 9d 18 80 00 00 	movabs $0x80189d,%rax
+  801ca1:	00 00 00 
+  801ca4:	ff d0                	call   *%rax
+  801ca6:	85 c0                	test   %eax,%eax
+  801ca8:	78 30                	js     801cda <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801caa:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  801caf:	74 2d                	je     801cde <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801cb1:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801cb5:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801cb9:	48 85 c0             	test   %rax,%rax
+  801cbc:	74 56                	je     801d14 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  801cbe:	4c 89 ea             	mov    %r13,%rdx
+  801cc1:	4c 89 e6             	mov    %r12,%rsi
+  801cc4:	4c 89 f7             	mov    %r14,%rdi
+  801cc7:	ff d0                	call   *%rax
+}
+  801cc9:	48 83 c4 10          	add    $0x10,%rsp
+  801ccd:	5b                   	pop    %rbx
+  801cce:	41 5c                	pop    %r12
+  801cd0:	41 5d                	pop    %r13
+  801cd2:	41 5e                	pop    %r14
+  801cd4:	5d                   	pop    %rbp
+  801cd5:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801cd6:	48 98                	cltq
+  801cd8:	eb ef                	jmp    801cc9 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801cda:	48 98                	cltq
+  801cdc:	eb eb                	jmp    801cc9 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801cde:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  801ce5:	00 00 00 
+  801ce8:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+  801cee:	89 da                	mov    %ebx,%edx
+  801cf0:	48 bf 5d 40 80 00 00 	movabs $0x80405d,%rdi
+  801cf7:	00 00 00 
+  801cfa:	b8 00 00 00 00       	mov    $0x0,%eax
+  801cff:	48 b9 81 04 80 00 00 	movabs $0x800481,%rcx
+  801d06:	00 00 00 
+  801d09:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801d0b:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801d12:	eb b5                	jmp    801cc9 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801d14:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801d1b:	eb ac                	jmp    801cc9 <write+0x65>
+
+0000000000801d1d <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  801d1d:	55                   	push   %rbp
+  801d1e:	48 89 e5             	mov    %rsp,%rbp
+  801d21:	53                   	push   %rbx
+  801d22:	48 83 ec 18          	sub    $0x18,%rsp
+  801d26:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801d28:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801d2c:	48 b8 52 18 80 00 00 	movabs $0x801852,%rax
+  801d33:	00 00 00 
+  801d36:	ff d0                	call   *%rax
+  801d38:	85 c0                	test   %eax,%eax
+  801d3a:	78 0c                	js     801d48 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  801d3c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801d40:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  801d43:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801d48:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801d4c:	c9                   	leave
+  801d4d:	c3                   	ret
+
+0000000000801d4e <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  801d4e:	55                   	push   %rbp
+  801d4f:	48 89 e5             	mov    %rsp,%rbp
+  801d52:	41 55                	push   %r13
+  801d54:	41 54                	push   %r12
+  801d56:	53                   	push   %rbx
+  801d57:	48 83 ec 18          	sub    $0x18,%rsp
+  801d5b:	89 fb                	mov    %edi,%ebx
+  801d5d:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801d60:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801d64:	48 b8 52 18 80 00 00 	movabs $0x801852,%rax
+  801d6b:	00 00 00 
+  801d6e:	ff d0                	call   *%rax
+  801d70:	85 c0                	test   %eax,%eax
+  801d72:	78 38                	js     801dac <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801d74:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  801d78:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  801d7c:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801d80:	48 b8 9d 18 80 00 00 	movabs $0x80189d,%rax
+  801d87:	00 00 00 
+  801d8a:	ff d0                	call   *%rax
+  801d8c:	85 c0                	test   %eax,%eax
+  801d8e:	78 1c                	js     801dac <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801d90:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  801d95:	74 20                	je     801db7 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801d97:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801d9b:	48 8b 40 30          	mov    0x30(%rax),%rax
+  801d9f:	48 85 c0             	test   %rax,%rax
+  801da2:	74 47                	je     801deb <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  801da4:	44 89 e6             	mov    %r12d,%esi
+  801da7:	4c 89 ef             	mov    %r13,%rdi
+  801daa:	ff d0                	call   *%rax
+}
+  801dac:	48 83 c4 18          	add    $0x18,%rsp
+  801db0:	5b                   	pop    %rbx
+  801db1:	41 5c                	pop    %r12
+  801db3:	41 5d                	pop    %r13
+  801db5:	5d                   	pop    %rbp
+  801db6:	c3                   	ret
+                thisenv->env_id, fdnum);
+  801db7:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  801dbe:	00 00 00 
+  801dc1:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801dc7:	89 da                	mov    %ebx,%edx
+  801dc9:	48 bf 20 40 80 00 00 	movabs $0x804020,%rdi
+  801dd0:	00 00 00 
+  801dd3:	b8 00 00 00 00       	mov    $0x0,%eax
+  801dd8:	48 b9 81 04 80 00 00 	movabs $0x800481,%rcx
+  801ddf:	00 00 00 
+  801de2:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801de4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801de9:	eb c1                	jmp    801dac <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801deb:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801df0:	eb ba                	jmp    801dac <ftruncate+0x5e>
+
+0000000000801df2 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  801df2:	55                   	push   %rbp
+  801df3:	48 89 e5             	mov    %rsp,%rbp
+  801df6:	41 54                	push   %r12
+  801df8:	53                   	push   %rbx
+  801df9:	48 83 ec 10          	sub    $0x10,%rsp
+  801dfd:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801e00:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801e04:	48 b8 52 18 80 00 00 	movabs $0x801852,%rax
+  801e0b:	00 00 00 
+  801e0e:	ff d0                	call   *%rax
+  801e10:	85 c0                	test   %eax,%eax
+  801e12:	78 4e                	js     801e62 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801e14:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801e18:	41 8b 3c 24          	mov    (%r12),%edi
+  801e1c:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801e20:	48 b8 9d 18 80 00 00 	movabs $0x80189d,%rax
+  801e27:	00 00 00 
+  801e2a:	ff d0                	call   *%rax
+  801e2c:	85 c0                	test   %eax,%eax
+  801e2e:	78 32                	js     801e62 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801e30:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801e34:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  801e39:	74 30                	je     801e6b <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  801e3b:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  801e3e:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  801e45:	00 00 00 
+    stat->st_isdir = 0;
+  801e48:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  801e4f:	00 00 00 
+    stat->st_dev = dev;
+  801e52:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  801e59:	48 89 de             	mov    %rbx,%rsi
+  801e5c:	4c 89 e7             	mov    %r12,%rdi
+  801e5f:	ff 50 28             	call   *0x28(%rax)
+}
+  801e62:	48 83 c4 10          	add    $0x10,%rsp
+  801e66:	5b                   	pop    %rbx
+  801e67:	41 5c                	pop    %r12
+  801e69:	5d                   	pop    %rbp
+  801e6a:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801e6b:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801e70:	eb f0                	jmp    801e62 <fstat+0x70>
+
+0000000000801e72 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  801e72:	55                   	push   %rbp
+  801e73:	48 89 e5             	mov    %rsp,%rbp
+  801e76:	41 54                	push   %r12
+  801e78:	53                   	push   %rbx
+  801e79:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  801e7c:	be 00 00 00 00       	mov    $0x0,%esi
+  801e81:	48 b8 55 22 80 00 00 	movabs $0x802255,%rax
+  801e88:	00 00 00 
+  801e8b:	ff d0                	call   *%rax
+  801e8d:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  801e8f:	85 c0                	test   %eax,%eax
+  801e91:	78 25                	js     801eb8 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  801e93:	4c 89 e6             	mov    %r12,%rsi
+  801e96:	89 c7                	mov    %eax,%edi
+  801e98:	48 b8 f2 1d 80 00 00 	movabs $0x801df2,%rax
+  801e9f:	00 00 00 
+  801ea2:	ff d0                	call   *%rax
+  801ea4:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  801ea7:	89 df                	mov    %ebx,%edi
+  801ea9:	48 b8 b7 19 80 00 00 	movabs $0x8019b7,%rax
+  801eb0:	00 00 00 
+  801eb3:	ff d0                	call   *%rax
+
+    return res;
+  801eb5:	44 89 e3             	mov    %r12d,%ebx
+}
+  801eb8:	89 d8                	mov    %ebx,%eax
+  801eba:	5b                   	pop    %rbx
+  801ebb:	41 5c                	pop    %r12
+  801ebd:	5d                   	pop    %rbp
+  801ebe:	c3                   	ret
+
+0000000000801ebf <fsipc>:
+ * response may be written back to fsipcbuf.
+ * type: request code, passed as the simple integer IPC value.
+ * dstva: virtual address at which to receive reply page, 0 if none.
+ * Returns result from the file server. */
+static int
+fsipc(unsigned type, void *dstva) {
+  801ebf:	55                   	push   %rbp
+  801ec0:	48 89 e5             	mov    %rsp,%rbp
+  801ec3:	41 54                	push   %r12
+  801ec5:	53                   	push   %rbx
+  801ec6:	48 83 ec 10          	sub    $0x10,%rsp
+  801eca:	41 89 fc             	mov    %edi,%r12d
+  801ecd:	48 89 f3             	mov    %rsi,%rbx
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  801ed0:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  801ed7:	00 00 00 
+  801eda:	83 38 00             	cmpl   $0x0,(%rax)
+  801edd:	74 5e                	je     801f3d <fsipc+0x7e>
+    if (debug) {
+        cprintf("[%08x] fsipc %d %08x\n",
+                thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+    }
+
+    ipc_send(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW);
+  801edf:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  801ee5:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  801eea:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  801ef1:	00 00 00 
+  801ef4:	44 89 e6             	mov    %r12d,%esi
+  801ef7:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  801efe:	00 00 00 
+  801f01:	8b 38                	mov    (%rax),%edi
+  801f03:	48 b8 85 38 80 00 00 	movabs $0x803885,%rax
+  801f0a:	00 00 00 
+  801f0d:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  801f0f:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  801f16:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  801f17:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801f1c:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  801f20:	48 89 de             	mov    %rbx,%rsi
+  801f23:	bf 00 00 00 00       	mov    $0x0,%edi
+  801f28:	48 b8 b0 37 80 00 00 	movabs $0x8037b0,%rax
+  801f2f:	00 00 00 
+  801f32:	ff d0                	call   *%rax
+}
+  801f34:	48 83 c4 10          	add    $0x10,%rsp
+  801f38:	5b                   	pop    %rbx
+  801f39:	41 5c                	pop    %r12
+  801f3b:	5d                   	pop    %rbp
+  801f3c:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  801f3d:	bf 03 00 00 00       	mov    $0x3,%edi
+  801f42:	48 b8 28 39 80 00 00 	movabs $0x803928,%rax
+  801f49:	00 00 00 
+  801f4c:	ff d0                	call   *%rax
+  801f4e:	a3 00 80 80 00 00 00 	movabs %eax,0x808000
+  801f55:	00 00 
+  801f57:	eb 86                	jmp    801edf <fsipc+0x20>
+
+0000000000801f59 <devfile_trunc>:
+    return 0;
+}
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  801f59:	55                   	push   %rbp
+  801f5a:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801f5d:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  801f64:	00 00 00 
+  801f67:	8b 57 0c             	mov    0xc(%rdi),%edx
+  801f6a:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  801f6c:	89 70 04             	mov    %esi,0x4(%rax)
+
+    return fsipc(FSREQ_SET_SIZE, NULL);
+  801f6f:	be 00 00 00 00       	mov    $0x0,%esi
+  801f74:	bf 02 00 00 00       	mov    $0x2,%edi
+  801f79:	48 b8 bf 1e 80 00 00 	movabs $0x801ebf,%rax
+  801f80:	00 00 00 
+  801f83:	ff d0                	call   *%rax
+}
+  801f85:	5d                   	pop    %rbp
+  801f86:	c3                   	ret
+
+0000000000801f87 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  801f87:	55                   	push   %rbp
+  801f88:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801f8b:	8b 47 0c             	mov    0xc(%rdi),%eax
+  801f8e:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  801f95:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  801f97:	be 00 00 00 00       	mov    $0x0,%esi
+  801f9c:	bf 06 00 00 00       	mov    $0x6,%edi
+  801fa1:	48 b8 bf 1e 80 00 00 	movabs $0x801ebf,%rax
+  801fa8:	00 00 00 
+  801fab:	ff d0                	call   *%rax
+}
+  801fad:	5d                   	pop    %rbp
+  801fae:	c3                   	ret
+
+0000000000801faf <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  801faf:	55                   	push   %rbp
+  801fb0:	48 89 e5             	mov    %rsp,%rbp
+  801fb3:	41 54                	push   %r12
+  801fb5:	53                   	push   %rbx
+  801fb6:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801fb9:	8b 47 0c             	mov    0xc(%rdi),%eax
+  801fbc:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  801fc3:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  801fc5:	be 00 00 00 00       	mov    $0x0,%esi
+  801fca:	bf 05 00 00 00       	mov    $0x5,%edi
+  801fcf:	48 b8 bf 1e 80 00 00 	movabs $0x801ebf,%rax
+  801fd6:	00 00 00 
+  801fd9:	ff d0                	call   *%rax
+    if (res < 0) {
+  801fdb:	85 c0                	test   %eax,%eax
+  801fdd:	78 3d                	js     80201c <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801fdf:	49 bc 00 70 80 00 00 	movabs $0x807000,%r12
+  801fe6:	00 00 00 
+  801fe9:	4c 89 e6             	mov    %r12,%rsi
+  801fec:	48 89 df             	mov    %rbx,%rdi
+  801fef:	48 b8 a6 0d 80 00 00 	movabs $0x800da6,%rax
+  801ff6:	00 00 00 
+  801ff9:	ff d0                	call   *%rax
+    st->st_size  = fsipcbuf.statRet.ret_size;
+  801ffb:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  802002:	00 
+  802003:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802009:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  802010:	00 
+  802011:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  802017:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80201c:	5b                   	pop    %rbx
+  80201d:	41 5c                	pop    %r12
+  80201f:	5d                   	pop    %rbp
+  802020:	c3                   	ret
+
+0000000000802021 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  802021:	55                   	push   %rbp
+  802022:	48 89 e5             	mov    %rsp,%rbp
+  802025:	41 57                	push   %r15
+  802027:	41 56                	push   %r14
+  802029:	41 55                	push   %r13
+  80202b:	41 54                	push   %r12
+  80202d:	53                   	push   %rbx
+  80202e:	48 83 ec 18          	sub    $0x18,%rsp
+  802032:	49 89 fe             	mov    %rdi,%r14
+  802035:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+  802039:	48 89 d3             	mov    %rdx,%rbx
+    while (n > sizeof(fsipcbuf.write.req_buf))
+  80203c:	48 81 fa f0 0f 00 00 	cmp    $0xff0,%rdx
+  802043:	0f 86 e4 00 00 00    	jbe    80212d <devfile_write+0x10c>
+  802049:	49 89 f4             	mov    %rsi,%r12
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  80204c:	49 bd 00 70 80 00 00 	movabs $0x807000,%r13
+  802053:	00 00 00 
+        memcpy(fsipcbuf.write.req_buf, buf, sizeof(fsipcbuf.write.req_buf));
+  802056:	49 bf 07 10 80 00 00 	movabs $0x801007,%r15
+  80205d:	00 00 00 
+  802060:	eb 03                	jmp    802065 <devfile_write+0x44>
+        buf += sizeof(fsipcbuf.write.req_buf);
+  802062:	49 89 f4             	mov    %rsi,%r12
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802065:	41 8b 46 0c          	mov    0xc(%r14),%eax
+  802069:	41 89 45 00          	mov    %eax,0x0(%r13)
+        fsipcbuf.write.req_n      = sizeof(fsipcbuf.write.req_buf);
+  80206d:	49 c7 45 08 f0 0f 00 	movq   $0xff0,0x8(%r13)
+  802074:	00 
+        memcpy(fsipcbuf.write.req_buf, buf, sizeof(fsipcbuf.write.req_buf));
+  802075:	ba f0 0f 00 00       	mov    $0xff0,%edx
+  80207a:	4c 89 e6             	mov    %r12,%rsi
+  80207d:	48 bf 10 70 80 00 00 	movabs $0x807010,%rdi
+  802084:	00 00 00 
+  802087:	41 ff d7             	call   *%r15
+        ssize_t res = fsipc(FSREQ_WRITE, NULL);
+  80208a:	be 00 00 00 00       	mov    $0x0,%esi
+  80208f:	bf 04 00 00 00       	mov    $0x4,%edi
+  802094:	48 b8 bf 1e 80 00 00 	movabs $0x801ebf,%rax
+  80209b:	00 00 00 
+  80209e:	ff d0                	call   *%rax
+  8020a0:	48 63 d0             	movslq %eax,%rdx
+        if (res < 0 || res < sizeof(fsipcbuf.write.req_buf))
+  8020a3:	3d ef 0f 00 00       	cmp    $0xfef,%eax
+  8020a8:	7e 71                	jle    80211b <devfile_write+0xfa>
+        buf += sizeof(fsipcbuf.write.req_buf);
+  8020aa:	49 8d b4 24 f0 0f 00 	lea    0xff0(%r12),%rsi
+  8020b1:	00 
+        n -= sizeof(fsipcbuf.write.req_buf);
+  8020b2:	48 81 eb f0 0f 00 00 	sub    $0xff0,%rbx
+    while (n > sizeof(fsipcbuf.write.req_buf))
+  8020b9:	48 81 fb f0 0f 00 00 	cmp    $0xff0,%rbx
+  8020c0:	77 a0                	ja     802062 <devfile_write+0x41>
+        written += sizeof(fsipcbuf.write.req_buf);
+  8020c2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8020c6:	49 29 c4             	sub    %rax,%r12
+  8020c9:	4d 8d a4 24 f0 0f 00 	lea    0xff0(%r12),%r12
+  8020d0:	00 
+    fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8020d1:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  8020d8:	00 00 00 
+  8020db:	41 8b 56 0c          	mov    0xc(%r14),%edx
+  8020df:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.write.req_n      = n;
+  8020e1:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    memcpy(fsipcbuf.write.req_buf, buf, n);
+  8020e5:	48 89 da             	mov    %rbx,%rdx
+  8020e8:	48 8d 78 10          	lea    0x10(%rax),%rdi
+  8020ec:	48 b8 07 10 80 00 00 	movabs $0x801007,%rax
+  8020f3:	00 00 00 
+  8020f6:	ff d0                	call   *%rax
+    ssize_t res = fsipc(FSREQ_WRITE, NULL);
+  8020f8:	be 00 00 00 00       	mov    $0x0,%esi
+  8020fd:	bf 04 00 00 00       	mov    $0x4,%edi
+  802102:	48 b8 bf 1e 80 00 00 	movabs $0x801ebf,%rax
+  802109:	00 00 00 
+  80210c:	ff d0                	call   *%rax
+  80210e:	48 63 d0             	movslq %eax,%rdx
+    written += res;
+  802111:	49 01 d4             	add    %rdx,%r12
+  802114:	48 85 d2             	test   %rdx,%rdx
+  802117:	49 0f 49 d4          	cmovns %r12,%rdx
+}
+  80211b:	48 89 d0             	mov    %rdx,%rax
+  80211e:	48 83 c4 18          	add    $0x18,%rsp
+  802122:	5b                   	pop    %rbx
+  802123:	41 5c                	pop    %r12
+  802125:	41 5d                	pop    %r13
+  802127:	41 5e                	pop    %r14
+  802129:	41 5f                	pop    %r15
+  80212b:	5d                   	pop    %rbp
+  80212c:	c3                   	ret
+    while (n > sizeof(fsipcbuf.write.req_buf))
+  80212d:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+    ssize_t written = 0;
+  802131:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802137:	eb 98                	jmp    8020d1 <devfile_write+0xb0>
+
+0000000000802139 <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  802139:	55                   	push   %rbp
+  80213a:	48 89 e5             	mov    %rsp,%rbp
+  80213d:	41 57                	push   %r15
+  80213f:	41 56                	push   %r14
+  802141:	41 55                	push   %r13
+  802143:	41 54                	push   %r12
+  802145:	53                   	push   %rbx
+  802146:	48 83 ec 18          	sub    $0x18,%rsp
+  80214a:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  80214e:	49 89 f6             	mov    %rsi,%r14
+  802151:	49 89 d4             	mov    %rdx,%r12
+    while (n > sizeof(fsipcbuf.readRet.ret_buf))
+  802154:	48 81 fa 00 10 00 00 	cmp    $0x1000,%rdx
+  80215b:	0f 86 ea 00 00 00    	jbe    80224b <devfile_read+0x112>
+    ssize_t readsz = 0;
+  802161:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  802168:	00 
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802169:	49 bf 00 70 80 00 00 	movabs $0x807000,%r15
+  802170:	00 00 00 
+  802173:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802177:	8b 40 0c             	mov    0xc(%rax),%eax
+  80217a:	41 89 07             	mov    %eax,(%r15)
+        fsipcbuf.read.req_n = sizeof(fsipcbuf.readRet.ret_buf);
+  80217d:	49 c7 47 08 00 10 00 	movq   $0x1000,0x8(%r15)
+  802184:	00 
+        ssize_t res = fsipc(FSREQ_READ, NULL);
+  802185:	be 00 00 00 00       	mov    $0x0,%esi
+  80218a:	bf 03 00 00 00       	mov    $0x3,%edi
+  80218f:	48 b8 bf 1e 80 00 00 	movabs $0x801ebf,%rax
+  802196:	00 00 00 
+  802199:	ff d0                	call   *%rax
+  80219b:	4c 63 e8             	movslq %eax,%r13
+        if (res < 0)
+  80219e:	4d 85 ed             	test   %r13,%r13
+  8021a1:	0f 88 92 00 00 00    	js     802239 <devfile_read+0x100>
+        memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  8021a7:	4c 89 ea             	mov    %r13,%rdx
+  8021aa:	4c 89 fe             	mov    %r15,%rsi
+  8021ad:	4c 89 f7             	mov    %r14,%rdi
+  8021b0:	48 b8 07 10 80 00 00 	movabs $0x801007,%rax
+  8021b7:	00 00 00 
+  8021ba:	ff d0                	call   *%rax
+        if (res < sizeof(fsipcbuf.readRet.ret_buf))
+  8021bc:	49 81 fd ff 0f 00 00 	cmp    $0xfff,%r13
+  8021c3:	76 6d                	jbe    802232 <devfile_read+0xf9>
+        readsz += res;
+  8021c5:	4c 01 6d c0          	add    %r13,-0x40(%rbp)
+        buf += res;
+  8021c9:	4d 01 ee             	add    %r13,%r14
+        n -= res;
+  8021cc:	4d 29 ec             	sub    %r13,%r12
+    while (n > sizeof(fsipcbuf.readRet.ret_buf))
+  8021cf:	49 81 fc 00 10 00 00 	cmp    $0x1000,%r12
+  8021d6:	77 9b                	ja     802173 <devfile_read+0x3a>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8021d8:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  8021df:	00 00 00 
+  8021e2:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  8021e6:	8b 51 0c             	mov    0xc(%rcx),%edx
+  8021e9:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.read.req_n = n;
+  8021eb:	4c 89 60 08          	mov    %r12,0x8(%rax)
+    ssize_t res = fsipc(FSREQ_READ, NULL);
+  8021ef:	be 00 00 00 00       	mov    $0x0,%esi
+  8021f4:	bf 03 00 00 00       	mov    $0x3,%edi
+  8021f9:	48 b8 bf 1e 80 00 00 	movabs $0x801ebf,%rax
+  802200:	00 00 00 
+  802203:	ff d0                	call   *%rax
+  802205:	4c 63 e8             	movslq %eax,%r13
+    if (res < 0)
+  802208:	4d 85 ed             	test   %r13,%r13
+  80220b:	78 2c                	js     802239 <devfile_read+0x100>
+    memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  80220d:	4c 89 ea             	mov    %r13,%rdx
+  802210:	48 be 00 70 80 00 00 	movabs $0x807000,%rsi
+  802217:	00 00 00 
+  80221a:	4c 89 f7             	mov    %r14,%rdi
+  80221d:	48 b8 07 10 80 00 00 	movabs $0x801007,%rax
+  802224:	00 00 00 
+  802227:	ff d0                	call   *%rax
+    readsz += res;
+  802229:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80222d:	49 01 c5             	add    %rax,%r13
+    return readsz;
+  802230:	eb 07                	jmp    802239 <devfile_read+0x100>
+            return readsz + res;
+  802232:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802236:	49 01 c5             	add    %rax,%r13
+}
+  802239:	4c 89 e8             	mov    %r13,%rax
+  80223c:	48 83 c4 18          	add    $0x18,%rsp
+  802240:	5b                   	pop    %rbx
+  802241:	41 5c                	pop    %r12
+  802243:	41 5d                	pop    %r13
+  802245:	41 5e                	pop    %r14
+  802247:	41 5f                	pop    %r15
+  802249:	5d                   	pop    %rbp
+  80224a:	c3                   	ret
+    ssize_t readsz = 0;
+  80224b:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  802252:	00 
+  802253:	eb 83                	jmp    8021d8 <devfile_read+0x9f>
+
+0000000000802255 <open>:
+open(const char *path, int mode) {
+  802255:	55                   	push   %rbp
+  802256:	48 89 e5             	mov    %rsp,%rbp
+  802259:	41 55                	push   %r13
+  80225b:	41 54                	push   %r12
+  80225d:	53                   	push   %rbx
+  80225e:	48 83 ec 18          	sub    $0x18,%rsp
+  802262:	49 89 fc             	mov    %rdi,%r12
+  802265:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  802268:	48 b8 68 0d 80 00 00 	movabs $0x800d68,%rax
+  80226f:	00 00 00 
+  802272:	ff d0                	call   *%rax
+  802274:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  80227a:	0f 87 8a 00 00 00    	ja     80230a <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802280:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802284:	48 b8 38 18 80 00 00 	movabs $0x801838,%rax
+  80228b:	00 00 00 
+  80228e:	ff d0                	call   *%rax
+  802290:	89 c3                	mov    %eax,%ebx
+  802292:	85 c0                	test   %eax,%eax
+  802294:	78 50                	js     8022e6 <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  802296:	4c 89 e6             	mov    %r12,%rsi
+  802299:	48 bb 00 70 80 00 00 	movabs $0x807000,%rbx
+  8022a0:	00 00 00 
+  8022a3:	48 89 df             	mov    %rbx,%rdi
+  8022a6:	48 b8 a6 0d 80 00 00 	movabs $0x800da6,%rax
+  8022ad:	00 00 00 
+  8022b0:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  8022b2:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  8022b9:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8022bd:	bf 01 00 00 00       	mov    $0x1,%edi
+  8022c2:	48 b8 bf 1e 80 00 00 	movabs $0x801ebf,%rax
+  8022c9:	00 00 00 
+  8022cc:	ff d0                	call   *%rax
+  8022ce:	89 c3                	mov    %eax,%ebx
+  8022d0:	85 c0                	test   %eax,%eax
+  8022d2:	78 1f                	js     8022f3 <open+0x9e>
+    return fd2num(fd);
+  8022d4:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8022d8:	48 b8 91 17 80 00 00 	movabs $0x801791,%rax
+  8022df:	00 00 00 
+  8022e2:	ff d0                	call   *%rax
+  8022e4:	89 c3                	mov    %eax,%ebx
+}
+  8022e6:	89 d8                	mov    %ebx,%eax
+  8022e8:	48 83 c4 18          	add    $0x18,%rsp
+  8022ec:	5b                   	pop    %rbx
+  8022ed:	41 5c                	pop    %r12
+  8022ef:	41 5d                	pop    %r13
+  8022f1:	5d                   	pop    %rbp
+  8022f2:	c3                   	ret
+        fd_close(fd, 0);
+  8022f3:	be 00 00 00 00       	mov    $0x0,%esi
+  8022f8:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8022fc:	48 b8 0d 19 80 00 00 	movabs $0x80190d,%rax
+  802303:	00 00 00 
+  802306:	ff d0                	call   *%rax
+        return res;
+  802308:	eb dc                	jmp    8022e6 <open+0x91>
+        return -E_BAD_PATH;
+  80230a:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  80230f:	eb d5                	jmp    8022e6 <open+0x91>
+
+0000000000802311 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  802311:	55                   	push   %rbp
+  802312:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc(FSREQ_SYNC, NULL);
+  802315:	be 00 00 00 00       	mov    $0x0,%esi
+  80231a:	bf 08 00 00 00       	mov    $0x8,%edi
+  80231f:	48 b8 bf 1e 80 00 00 	movabs $0x801ebf,%rax
+  802326:	00 00 00 
+  802329:	ff d0                	call   *%rax
+}
+  80232b:	5d                   	pop    %rbp
+  80232c:	c3                   	ret
+
+000000000080232d <region_flush>:
+ * sys_region_batch() call right before memory at UTEMP is reused */
+static struct RegionOp region_queue[REGION_BATCH_MAX];
+static size_t region_queued;
+
+static int
+region_flush(void) {
+  80232d:	55                   	push   %rbp
+  80232e:	48 89 e5             	mov    %rsp,%rbp
+  802331:	41 56                	push   %r14
+  802333:	41 55                	push   %r13
+  802335:	41 54                	push   %r12
+  802337:	53                   	push   %rbx
+    int res = region_queued ? sys_region_batch(region_queue, region_queued) : 0;
+  802338:	48 b8 20 80 80 00 00 	movabs $0x808020,%rax
+  80233f:	00 00 00 
+  802342:	48 8b 30             	mov    (%rax),%rsi
+  802345:	41 be 00 00 00 00    	mov    $0x0,%r14d
+  80234b:	48 85 f6             	test   %rsi,%rsi
+  80234e:	74 6d                	je     8023bd <region_flush+0x90>
+  802350:	48 bf 40 80 80 00 00 	movabs $0x808040,%rdi
+  802357:	00 00 00 
+  80235a:	48 b8 89 14 80 00 00 	movabs $0x801489,%rax
+  802361:	00 00 00 
+  802364:	ff d0                	call   *%rax
+  802366:	41 89 c6             	mov    %eax,%r14d
+
+    /* Operations following the failed one are not performed,
+     * but memory at UTEMP still has to be unmapped from ours */
+    for (size_t i = 0; res < 0 && i < region_queued; i++) {
+  802369:	85 c0                	test   %eax,%eax
+  80236b:	79 50                	jns    8023bd <region_flush+0x90>
+  80236d:	48 bb 40 80 80 00 00 	movabs $0x808040,%rbx
+  802374:	00 00 00 
+  802377:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80237d:	49 bd 20 80 80 00 00 	movabs $0x808020,%r13
+  802384:	00 00 00 
+  802387:	eb 08                	jmp    802391 <region_flush+0x64>
+  802389:	49 83 c4 01          	add    $0x1,%r12
+  80238d:	48 83 c3 28          	add    $0x28,%rbx
+  802391:	4d 3b 65 00          	cmp    0x0(%r13),%r12
+  802395:	73 26                	jae    8023bd <region_flush+0x90>
+        struct RegionOp *op = &region_queue[i];
+        if (op->type == REGION_UNMAP && !op->dstenv)
+  802397:	83 3b 02             	cmpl   $0x2,(%rbx)
+  80239a:	75 ed                	jne    802389 <region_flush+0x5c>
+  80239c:	83 7b 0c 00          	cmpl   $0x0,0xc(%rbx)
+  8023a0:	75 e7                	jne    802389 <region_flush+0x5c>
+            sys_unmap_region(0, (void *)op->dstva, op->size);
+  8023a2:	48 8b 53 20          	mov    0x20(%rbx),%rdx
+  8023a6:	48 8b 73 18          	mov    0x18(%rbx),%rsi
+  8023aa:	bf 00 00 00 00       	mov    $0x0,%edi
+  8023af:	48 b8 22 14 80 00 00 	movabs $0x801422,%rax
+  8023b6:	00 00 00 
+  8023b9:	ff d0                	call   *%rax
+  8023bb:	eb cc                	jmp    802389 <region_flush+0x5c>
+    }
+    region_queued = 0;
+  8023bd:	48 b8 20 80 80 00 00 	movabs $0x808020,%rax
+  8023c4:	00 00 00 
+  8023c7:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+    return res;
+}
+  8023ce:	44 89 f0             	mov    %r14d,%eax
+  8023d1:	5b                   	pop    %rbx
+  8023d2:	41 5c                	pop    %r12
+  8023d4:	41 5d                	pop    %r13
+  8023d6:	41 5e                	pop    %r14
+  8023d8:	5d                   	pop    %rbp
+  8023d9:	c3                   	ret
+
+00000000008023da <region_queue_op>:
+
+static int
+region_queue_op(int type, envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8023da:	55                   	push   %rbp
+  8023db:	48 89 e5             	mov    %rsp,%rbp
+  8023de:	41 57                	push   %r15
+  8023e0:	41 56                	push   %r14
+  8023e2:	41 55                	push   %r13
+  8023e4:	41 54                	push   %r12
+  8023e6:	53                   	push   %rbx
+  8023e7:	48 83 ec 18          	sub    $0x18,%rsp
+  8023eb:	41 89 ff             	mov    %edi,%r15d
+  8023ee:	41 89 f6             	mov    %esi,%r14d
+  8023f1:	49 89 d4             	mov    %rdx,%r12
+  8023f4:	41 89 cd             	mov    %ecx,%r13d
+  8023f7:	4c 89 c3             	mov    %r8,%rbx
+  8023fa:	4c 89 4d c8          	mov    %r9,-0x38(%rbp)
+    int res = region_queued == REGION_BATCH_MAX ? region_flush() : 0;
+  8023fe:	bf 00 00 00 00       	mov    $0x0,%edi
+  802403:	48 b8 20 80 80 00 00 	movabs $0x808020,%rax
+  80240a:	00 00 00 
+  80240d:	48 83 38 10          	cmpq   $0x10,(%rax)
+  802411:	74 66                	je     802479 <region_queue_op+0x9f>
+    region_queue[region_queued++] = (struct RegionOp){
+  802413:	48 b8 20 80 80 00 00 	movabs $0x808020,%rax
+  80241a:	00 00 00 
+  80241d:	48 8b 08             	mov    (%rax),%rcx
+  802420:	48 8d 51 01          	lea    0x1(%rcx),%rdx
+  802424:	48 89 10             	mov    %rdx,(%rax)
+  802427:	48 be 40 80 80 00 00 	movabs $0x808040,%rsi
+  80242e:	00 00 00 
+  802431:	48 8d 14 8d 00 00 00 	lea    0x0(,%rcx,4),%rdx
+  802438:	00 
+  802439:	48 8d 04 0a          	lea    (%rdx,%rcx,1),%rax
+  80243d:	48 8d 04 c6          	lea    (%rsi,%rax,8),%rax
+  802441:	44 89 38             	mov    %r15d,(%rax)
+  802444:	44 8b 45 10          	mov    0x10(%rbp),%r8d
+  802448:	44 89 40 04          	mov    %r8d,0x4(%rax)
+  80244c:	44 89 70 08          	mov    %r14d,0x8(%rax)
+  802450:	44 89 68 0c          	mov    %r13d,0xc(%rax)
+  802454:	4c 89 60 10          	mov    %r12,0x10(%rax)
+  802458:	48 89 58 18          	mov    %rbx,0x18(%rax)
+  80245c:	48 01 ca             	add    %rcx,%rdx
+  80245f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802463:	48 89 44 d6 20       	mov    %rax,0x20(%rsi,%rdx,8)
+            .srcva = (uintptr_t)srcva,
+            .dstva = (uintptr_t)dstva,
+            .size = size,
+    };
+    return res;
+}
+  802468:	89 f8                	mov    %edi,%eax
+  80246a:	48 83 c4 18          	add    $0x18,%rsp
+  80246e:	5b                   	pop    %rbx
+  80246f:	41 5c                	pop    %r12
+  802471:	41 5d                	pop    %r13
+  802473:	41 5e                	pop    %r14
+  802475:	41 5f                	pop    %r15
+  802477:	5d                   	pop    %rbp
+  802478:	c3                   	ret
+    int res = region_queued == REGION_BATCH_MAX ? region_flush() : 0;
+  802479:	48 b8 2d 23 80 00 00 	movabs $0x80232d,%rax
+  802480:	00 00 00 
+  802483:	ff d0                	call   *%rax
+  802485:	89 c7                	mov    %eax,%edi
+  802487:	eb 8a                	jmp    802413 <region_queue_op+0x39>
+
+0000000000802489 <copy_shared_region>:
+    int unmap = region_queue_op(REGION_UNMAP, 0, NULL, 0, UTEMP, USER_STACK_SIZE, 0);
+    return res < 0 ? res : unmap;
+}
+
+static int
+copy_shared_region(void *start, void *end, void *arg) {
+  802489:	55                   	push   %rbp
+  80248a:	48 89 e5             	mov    %rsp,%rbp
+  80248d:	41 55                	push   %r13
+  80248f:	41 54                	push   %r12
+  802491:	53                   	push   %rbx
+  802492:	48 83 ec 08          	sub    $0x8,%rsp
+  802496:	48 89 fb             	mov    %rdi,%rbx
+  802499:	49 89 f4             	mov    %rsi,%r12
+    envid_t child = *(envid_t *)arg;
+  80249c:	44 8b 2a             	mov    (%rdx),%r13d
+    return region_queue_op(REGION_MAP, 0, start, child, start, end - start, get_prot(start));
+  80249f:	48 b8 91 33 80 00 00 	movabs $0x803391,%rax
+  8024a6:	00 00 00 
+  8024a9:	ff d0                	call   *%rax
+  8024ab:	48 83 ec 08          	sub    $0x8,%rsp
+  8024af:	50                   	push   %rax
+  8024b0:	4d 89 e1             	mov    %r12,%r9
+  8024b3:	49 29 d9             	sub    %rbx,%r9
+  8024b6:	49 89 d8             	mov    %rbx,%r8
+  8024b9:	44 89 e9             	mov    %r13d,%ecx
+  8024bc:	48 89 da             	mov    %rbx,%rdx
+  8024bf:	be 00 00 00 00       	mov    $0x0,%esi
+  8024c4:	bf 01 00 00 00       	mov    $0x1,%edi
+  8024c9:	48 b8 da 23 80 00 00 	movabs $0x8023da,%rax
+  8024d0:	00 00 00 
+  8024d3:	ff d0                	call   *%rax
+}
+  8024d5:	48 8d 65 e8          	lea    -0x18(%rbp),%rsp
+  8024d9:	5b                   	pop    %rbx
+  8024da:	41 5c                	pop    %r12
+  8024dc:	41 5d                	pop    %r13
+  8024de:	5d                   	pop    %rbp
+  8024df:	c3                   	ret
+
+00000000008024e0 <spawn>:
+spawn(const char *prog, const char **argv) {
+  8024e0:	55                   	push   %rbp
+  8024e1:	48 89 e5             	mov    %rsp,%rbp
+  8024e4:	41 57                	push   %r15
+  8024e6:	41 56                	push   %r14
+  8024e8:	41 55                	push   %r13
+  8024ea:	41 54                	push   %r12
+  8024ec:	53                   	push   %rbx
+  8024ed:	48 81 ec 08 03 00 00 	sub    $0x308,%rsp
+  8024f4:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(prog, O_RDONLY);
+  8024f7:	be 00 00 00 00       	mov    $0x0,%esi
+  8024fc:	48 b8 55 22 80 00 00 	movabs $0x802255,%rax
+  802503:	00 00 00 
+  802506:	ff d0                	call   *%rax
+  802508:	89 85 fc fc ff ff    	mov    %eax,-0x304(%rbp)
+    if (fd < 0) return fd;
+  80250e:	85 c0                	test   %eax,%eax
+  802510:	0f 88 08 07 00 00    	js     802c1e <spawn+0x73e>
+  802516:	89 c7                	mov    %eax,%edi
+    res = readn(fd, elf_buf, sizeof(elf_buf));
+  802518:	ba 00 02 00 00       	mov    $0x200,%edx
+  80251d:	48 8d b5 d0 fd ff ff 	lea    -0x230(%rbp),%rsi
+  802524:	48 b8 f3 1b 80 00 00 	movabs $0x801bf3,%rax
+  80252b:	00 00 00 
+  80252e:	ff d0                	call   *%rax
+  802530:	89 c6                	mov    %eax,%esi
+    if (res != sizeof(elf_buf)) {
+  802532:	3d 00 02 00 00       	cmp    $0x200,%eax
+  802537:	0f 85 d2 02 00 00    	jne    80280f <spawn+0x32f>
+        elf->e_elf[1] != 1 /* little endian */ ||
+  80253d:	48 b8 ff ff ff ff ff 	movabs $0xffffffffffffff,%rax
+  802544:	ff ff 00 
+  802547:	48 23 85 d0 fd ff ff 	and    -0x230(%rbp),%rax
+    if (elf->e_magic != ELF_MAGIC ||
+  80254e:	48 ba 7f 45 4c 46 02 	movabs $0x10102464c457f,%rdx
+  802555:	01 01 00 
+  802558:	48 39 d0             	cmp    %rdx,%rax
+  80255b:	0f 85 ea 02 00 00    	jne    80284b <spawn+0x36b>
+        elf->e_type != ET_EXEC /* executable */ ||
+  802561:	81 bd e0 fd ff ff 02 	cmpl   $0x3e0002,-0x220(%rbp)
+  802568:	00 3e 00 
+  80256b:	0f 85 da 02 00 00    	jne    80284b <spawn+0x36b>
+
+/* This must be inlined. Exercise for reader: why? */
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+    envid_t ret;
+    asm volatile("int %2"
+  802571:	b8 08 00 00 00       	mov    $0x8,%eax
+  802576:	cd 30                	int    $0x30
+  802578:	89 85 f0 fc ff ff    	mov    %eax,-0x310(%rbp)
+  80257e:	89 c3                	mov    %eax,%ebx
+    if ((int)(res = sys_exofork()) < 0) goto error2;
+  802580:	85 c0                	test   %eax,%eax
+  802582:	0f 88 7e 06 00 00    	js     802c06 <spawn+0x726>
+    envid_t child = res;
+  802588:	89 85 cc fd ff ff    	mov    %eax,-0x234(%rbp)
+    struct Trapframe child_tf = envs[ENVX(child)].env_tf;
+  80258e:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802593:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+  80259a:	48 be 00 00 c0 1f 80 	movabs $0x801fc00000,%rsi
+  8025a1:	00 00 00 
+  8025a4:	48 01 c6             	add    %rax,%rsi
+  8025a7:	48 8b 06             	mov    (%rsi),%rax
+  8025aa:	48 89 85 0c fd ff ff 	mov    %rax,-0x2f4(%rbp)
+  8025b1:	48 8b 86 b8 00 00 00 	mov    0xb8(%rsi),%rax
+  8025b8:	48 89 85 c4 fd ff ff 	mov    %rax,-0x23c(%rbp)
+  8025bf:	48 8d bd 10 fd ff ff 	lea    -0x2f0(%rbp),%rdi
+  8025c6:	48 c7 c1 fc ff ff ff 	mov    $0xfffffffffffffffc,%rcx
+  8025cd:	48 29 ce             	sub    %rcx,%rsi
+  8025d0:	81 c1 c0 00 00 00    	add    $0xc0,%ecx
+  8025d6:	c1 e9 03             	shr    $0x3,%ecx
+  8025d9:	89 c9                	mov    %ecx,%ecx
+  8025db:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+    child_tf.tf_rip = elf->e_entry;
+  8025de:	48 8b 85 e8 fd ff ff 	mov    -0x218(%rbp),%rax
+  8025e5:	48 89 85 a4 fd ff ff 	mov    %rax,-0x25c(%rbp)
+    for (argc = 0; argv[argc] != 0; argc++)
+  8025ec:	49 8b 3c 24          	mov    (%r12),%rdi
+  8025f0:	48 85 ff             	test   %rdi,%rdi
+  8025f3:	0f 84 99 02 00 00    	je     802892 <spawn+0x3b2>
+  8025f9:	41 bd 01 00 00 00    	mov    $0x1,%r13d
+    string_size = 0;
+  8025ff:	41 be 00 00 00 00    	mov    $0x0,%r14d
+        string_size += strlen(argv[argc]) + 1;
+  802605:	49 bf 68 0d 80 00 00 	movabs $0x800d68,%r15
+  80260c:	00 00 00 
+  80260f:	41 ff d7             	call   *%r15
+  802612:	4a 8d 1c 30          	lea    (%rax,%r14,1),%rbx
+  802616:	4c 8d 73 01          	lea    0x1(%rbx),%r14
+    for (argc = 0; argv[argc] != 0; argc++)
+  80261a:	4c 89 e8             	mov    %r13,%rax
+  80261d:	49 83 c5 01          	add    $0x1,%r13
+  802621:	4b 8b 7c ec f8       	mov    -0x8(%r12,%r13,8),%rdi
+  802626:	48 85 ff             	test   %rdi,%rdi
+  802629:	75 e4                	jne    80260f <spawn+0x12f>
+    string_store = (char *)UTEMP + USER_STACK_SIZE - string_size;
+  80262b:	48 89 c2             	mov    %rax,%rdx
+  80262e:	48 89 85 e8 fc ff ff 	mov    %rax,-0x318(%rbp)
+  802635:	48 f7 d3             	not    %rbx
+  802638:	48 81 c3 00 00 41 00 	add    $0x410000,%rbx
+    argv_store = (uintptr_t *)(ROUNDDOWN(string_store, sizeof(uintptr_t)) - sizeof(uintptr_t) * (argc + 1));
+  80263f:	48 89 d9             	mov    %rbx,%rcx
+  802642:	48 83 e1 f8          	and    $0xfffffffffffffff8,%rcx
+  802646:	48 89 8d e0 fc ff ff 	mov    %rcx,-0x320(%rbp)
+  80264d:	83 c0 01             	add    $0x1,%eax
+  802650:	48 98                	cltq
+  802652:	48 c1 e0 03          	shl    $0x3,%rax
+  802656:	48 29 c1             	sub    %rax,%rcx
+  802659:	49 89 cf             	mov    %rcx,%r15
+    if ((void *)(argv_store - 2) < (void *)UTEMP) return -E_NO_MEM;
+  80265c:	48 8d 41 f0          	lea    -0x10(%rcx),%rax
+  802660:	48 3d ff ff 3f 00    	cmp    $0x3fffff,%rax
+  802666:	0f 86 73 05 00 00    	jbe    802bdf <spawn+0x6ff>
+    for (argc = 0; argv[argc] != 0; argc++)
+  80266c:	41 89 d6             	mov    %edx,%r14d
+    if ((res = region_queue_op(REGION_ALLOC, 0, NULL, 0, UTEMP, USER_STACK_SIZE, PROT_RW)) < 0 ||
+  80266f:	48 83 ec 08          	sub    $0x8,%rsp
+  802673:	6a 06                	push   $0x6
+  802675:	41 b9 00 00 01 00    	mov    $0x10000,%r9d
+  80267b:	41 b8 00 00 40 00    	mov    $0x400000,%r8d
+  802681:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802686:	ba 00 00 00 00       	mov    $0x0,%edx
+  80268b:	be 00 00 00 00       	mov    $0x0,%esi
+  802690:	bf 00 00 00 00       	mov    $0x0,%edi
+  802695:	48 b8 da 23 80 00 00 	movabs $0x8023da,%rax
+  80269c:	00 00 00 
+  80269f:	ff d0                	call   *%rax
+  8026a1:	41 89 c5             	mov    %eax,%r13d
+  8026a4:	48 83 c4 10          	add    $0x10,%rsp
+  8026a8:	85 c0                	test   %eax,%eax
+  8026aa:	0f 88 35 05 00 00    	js     802be5 <spawn+0x705>
+        (res = region_flush()) < 0) return res;
+  8026b0:	48 b8 2d 23 80 00 00 	movabs $0x80232d,%rax
+  8026b7:	00 00 00 
+  8026ba:	ff d0                	call   *%rax
+  8026bc:	41 89 c5             	mov    %eax,%r13d
+    if ((res = region_queue_op(REGION_ALLOC, 0, NULL, 0, UTEMP, USER_STACK_SIZE, PROT_RW)) < 0 ||
+  8026bf:	85 c0                	test   %eax,%eax
+  8026c1:	0f 88 1e 05 00 00    	js     802be5 <spawn+0x705>
+    for (i = 0; i < argc; i++) {
+  8026c7:	45 85 f6             	test   %r14d,%r14d
+  8026ca:	7e 55                	jle    802721 <spawn+0x241>
+  8026cc:	4d 89 fd             	mov    %r15,%r13
+  8026cf:	4d 63 f6             	movslq %r14d,%r14
+  8026d2:	4f 8d 34 f7          	lea    (%r15,%r14,8),%r14
+        argv_store[i] = UTEMP2USTACK(string_store);
+  8026d6:	48 b8 00 70 fe ff 7f 	movabs $0x7ffffe7000,%rax
+  8026dd:	00 00 00 
+  8026e0:	48 8d 84 03 00 00 c0 	lea    -0x400000(%rbx,%rax,1),%rax
+  8026e7:	ff 
+  8026e8:	49 89 45 00          	mov    %rax,0x0(%r13)
+        strcpy(string_store, argv[i]);
+  8026ec:	49 8b 34 24          	mov    (%r12),%rsi
+  8026f0:	48 89 df             	mov    %rbx,%rdi
+  8026f3:	48 b8 a6 0d 80 00 00 	movabs $0x800da6,%rax
+  8026fa:	00 00 00 
+  8026fd:	ff d0                	call   *%rax
+        string_store += strlen(argv[i]) + 1;
+  8026ff:	49 8b 3c 24          	mov    (%r12),%rdi
+  802703:	48 b8 68 0d 80 00 00 	movabs $0x800d68,%rax
+  80270a:	00 00 00 
+  80270d:	ff d0                	call   *%rax
+  80270f:	48 8d 5c 03 01       	lea    0x1(%rbx,%rax,1),%rbx
+    for (i = 0; i < argc; i++) {
+  802714:	49 83 c5 08          	add    $0x8,%r13
+  802718:	49 83 c4 08          	add    $0x8,%r12
+  80271c:	4d 39 f5             	cmp    %r14,%r13
+  80271f:	75 b5                	jne    8026d6 <spawn+0x1f6>
+    argv_store[argc] = 0;
+  802721:	48 8b 85 e0 fc ff ff 	mov    -0x320(%rbp),%rax
+  802728:	48 c7 40 f8 00 00 00 	movq   $0x0,-0x8(%rax)
+  80272f:	00 
+    assert(string_store == (char *)UTEMP + USER_STACK_SIZE);
+  802730:	48 81 fb 00 00 41 00 	cmp    $0x410000,%rbx
+  802737:	0f 85 81 01 00 00    	jne    8028be <spawn+0x3de>
+    argv_store[-1] = UTEMP2USTACK(argv_store);
+  80273d:	49 b8 00 70 fe ff 7f 	movabs $0x7ffffe7000,%r8
+  802744:	00 00 00 
+  802747:	4b 8d 84 07 00 00 c0 	lea    -0x400000(%r15,%r8,1),%rax
+  80274e:	ff 
+  80274f:	49 89 47 f8          	mov    %rax,-0x8(%r15)
+    argv_store[-2] = argc;
+  802753:	48 8b 85 e8 fc ff ff 	mov    -0x318(%rbp),%rax
+  80275a:	49 89 47 f0          	mov    %rax,-0x10(%r15)
+    tf->tf_rsp = UTEMP2USTACK(&argv_store[-2]);
+  80275e:	48 b8 f0 6f fe ff 7f 	movabs $0x7ffffe6ff0,%rax
+  802765:	00 00 00 
+  802768:	49 8d 84 07 00 00 c0 	lea    -0x400000(%r15,%rax,1),%rax
+  80276f:	ff 
+  802770:	48 89 85 bc fd ff ff 	mov    %rax,-0x244(%rbp)
+    res = region_queue_op(REGION_MAP, 0, UTEMP, child, (void *)(USER_STACK_TOP - USER_STACK_SIZE),
+  802777:	48 83 ec 08          	sub    $0x8,%rsp
+  80277b:	6a 06                	push   $0x6
+  80277d:	41 b9 00 00 01 00    	mov    $0x10000,%r9d
+  802783:	8b 8d f0 fc ff ff    	mov    -0x310(%rbp),%ecx
+  802789:	ba 00 00 40 00       	mov    $0x400000,%edx
+  80278e:	be 00 00 00 00       	mov    $0x0,%esi
+  802793:	bf 01 00 00 00       	mov    $0x1,%edi
+  802798:	48 bb da 23 80 00 00 	movabs $0x8023da,%rbx
+  80279f:	00 00 00 
+  8027a2:	ff d3                	call   *%rbx
+  8027a4:	41 89 c5             	mov    %eax,%r13d
+    int unmap = region_queue_op(REGION_UNMAP, 0, NULL, 0, UTEMP, USER_STACK_SIZE, 0);
+  8027a7:	c7 04 24 00 00 00 00 	movl   $0x0,(%rsp)
+  8027ae:	41 b9 00 00 01 00    	mov    $0x10000,%r9d
+  8027b4:	41 b8 00 00 40 00    	mov    $0x400000,%r8d
+  8027ba:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8027bf:	ba 00 00 00 00       	mov    $0x0,%edx
+  8027c4:	be 00 00 00 00       	mov    $0x0,%esi
+  8027c9:	bf 02 00 00 00       	mov    $0x2,%edi
+  8027ce:	ff d3                	call   *%rbx
+  8027d0:	89 c3                	mov    %eax,%ebx
+    return res < 0 ? res : unmap;
+  8027d2:	48 83 c4 10          	add    $0x10,%rsp
+  8027d6:	45 85 ed             	test   %r13d,%r13d
+  8027d9:	0f 88 06 04 00 00    	js     802be5 <spawn+0x705>
+    if ((res = init_stack(child, argv, &child_tf)) < 0) goto error;
+  8027df:	85 c0                	test   %eax,%eax
+  8027e1:	0f 88 01 04 00 00    	js     802be8 <spawn+0x708>
+    struct Proghdr *ph = (struct Proghdr *)(elf_buf + elf->e_phoff);
+  8027e7:	48 8b 85 f0 fd ff ff 	mov    -0x210(%rbp),%rax
+  8027ee:	4c 8d ac 05 d0 fd ff 	lea    -0x230(%rbp,%rax,1),%r13
+  8027f5:	ff 
+    for (size_t i = 0; i < elf->e_phnum; i++, ph++) {
+  8027f6:	66 83 bd 08 fe ff ff 	cmpw   $0x0,-0x1f8(%rbp)
+  8027fd:	00 
+  8027fe:	0f 84 c8 02 00 00    	je     802acc <spawn+0x5ec>
+  802804:	41 be 00 00 00 00    	mov    $0x0,%r14d
+  80280a:	e9 63 01 00 00       	jmp    802972 <spawn+0x492>
+        cprintf("Wrong ELF header size or read error: %i\n", res);
+  80280f:	48 bf a0 40 80 00 00 	movabs $0x8040a0,%rdi
+  802816:	00 00 00 
+  802819:	b8 00 00 00 00       	mov    $0x0,%eax
+  80281e:	48 ba 81 04 80 00 00 	movabs $0x800481,%rdx
+  802825:	00 00 00 
+  802828:	ff d2                	call   *%rdx
+        close(fd);
+  80282a:	8b bd fc fc ff ff    	mov    -0x304(%rbp),%edi
+  802830:	48 b8 b7 19 80 00 00 	movabs $0x8019b7,%rax
+  802837:	00 00 00 
+  80283a:	ff d0                	call   *%rax
+        return -E_NOT_EXEC;
+  80283c:	c7 85 fc fc ff ff ee 	movl   $0xffffffee,-0x304(%rbp)
+  802843:	ff ff ff 
+  802846:	e9 d3 03 00 00       	jmp    802c1e <spawn+0x73e>
+        cprintf("Elf magic %08x want %08x\n", elf->e_magic, ELF_MAGIC);
+  80284b:	ba 7f 45 4c 46       	mov    $0x464c457f,%edx
+  802850:	8b b5 d0 fd ff ff    	mov    -0x230(%rbp),%esi
+  802856:	48 bf 00 41 80 00 00 	movabs $0x804100,%rdi
+  80285d:	00 00 00 
+  802860:	b8 00 00 00 00       	mov    $0x0,%eax
+  802865:	48 b9 81 04 80 00 00 	movabs $0x800481,%rcx
+  80286c:	00 00 00 
+  80286f:	ff d1                	call   *%rcx
+        close(fd);
+  802871:	8b bd fc fc ff ff    	mov    -0x304(%rbp),%edi
+  802877:	48 b8 b7 19 80 00 00 	movabs $0x8019b7,%rax
+  80287e:	00 00 00 
+  802881:	ff d0                	call   *%rax
+        return -E_NOT_EXEC;
+  802883:	c7 85 fc fc ff ff ee 	movl   $0xffffffee,-0x304(%rbp)
+  80288a:	ff ff ff 
+  80288d:	e9 8c 03 00 00       	jmp    802c1e <spawn+0x73e>
+    for (argc = 0; argv[argc] != 0; argc++)
+  802892:	48 c7 85 e8 fc ff ff 	movq   $0x0,-0x318(%rbp)
+  802899:	00 00 00 00 
+  80289d:	41 be 00 00 00 00    	mov    $0x0,%r14d
+    argv_store = (uintptr_t *)(ROUNDDOWN(string_store, sizeof(uintptr_t)) - sizeof(uintptr_t) * (argc + 1));
+  8028a3:	41 bf f8 ff 40 00    	mov    $0x40fff8,%r15d
+  8028a9:	48 c7 85 e0 fc ff ff 	movq   $0x410000,-0x320(%rbp)
+  8028b0:	00 00 41 00 
+    string_store = (char *)UTEMP + USER_STACK_SIZE - string_size;
+  8028b4:	bb 00 00 41 00       	mov    $0x410000,%ebx
+  8028b9:	e9 b1 fd ff ff       	jmp    80266f <spawn+0x18f>
+    assert(string_store == (char *)UTEMP + USER_STACK_SIZE);
+  8028be:	48 b9 d0 40 80 00 00 	movabs $0x8040d0,%rcx
+  8028c5:	00 00 00 
+  8028c8:	48 ba 1a 41 80 00 00 	movabs $0x80411a,%rdx
+  8028cf:	00 00 00 
+  8028d2:	be 16 01 00 00       	mov    $0x116,%esi
+  8028d7:	48 bf 2f 41 80 00 00 	movabs $0x80412f,%rdi
+  8028de:	00 00 00 
+  8028e1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028e6:	49 b8 31 03 80 00 00 	movabs $0x800331,%r8
+  8028ed:	00 00 00 
+  8028f0:	41 ff d0             	call   *%r8
+    }
+    res = readn(fd, UTEMP, filesz);
+    if (res < 0) {
+        goto cleanup;
+    }
+    res = region_queue_op(REGION_MAP, 0, UTEMP, child, (void *)va, memsz, perm);
+  8028f3:	48 83 ec 08          	sub    $0x8,%rsp
+  8028f7:	41 54                	push   %r12
+  8028f9:	4d 89 f9             	mov    %r15,%r9
+  8028fc:	4c 8b 85 f0 fc ff ff 	mov    -0x310(%rbp),%r8
+  802903:	8b 8d e8 fc ff ff    	mov    -0x318(%rbp),%ecx
+  802909:	ba 00 00 40 00       	mov    $0x400000,%edx
+  80290e:	be 00 00 00 00       	mov    $0x0,%esi
+  802913:	bf 01 00 00 00       	mov    $0x1,%edi
+  802918:	49 bc da 23 80 00 00 	movabs $0x8023da,%r12
+  80291f:	00 00 00 
+  802922:	41 ff d4             	call   *%r12
+  802925:	89 c3                	mov    %eax,%ebx
+    if (res < 0) {
+        goto cleanup;
+    }
+cleanup:
+    region_queue_op(REGION_UNMAP, 0, NULL, 0, UTEMP, memsz, 0);
+  802927:	c7 04 24 00 00 00 00 	movl   $0x0,(%rsp)
+  80292e:	4d 89 f9             	mov    %r15,%r9
+  802931:	41 b8 00 00 40 00    	mov    $0x400000,%r8d
+  802937:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80293c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802941:	be 00 00 00 00       	mov    $0x0,%esi
+  802946:	bf 02 00 00 00       	mov    $0x2,%edi
+  80294b:	41 ff d4             	call   *%r12
+        if ((res = map_segment(child, ph->p_va, ph->p_memsz,
+  80294e:	48 83 c4 10          	add    $0x10,%rsp
+  802952:	85 db                	test   %ebx,%ebx
+  802954:	0f 88 8e 02 00 00    	js     802be8 <spawn+0x708>
+    for (size_t i = 0; i < elf->e_phnum; i++, ph++) {
+  80295a:	49 83 c6 01          	add    $0x1,%r14
+  80295e:	49 83 c5 38          	add    $0x38,%r13
+  802962:	0f b7 85 08 fe ff ff 	movzwl -0x1f8(%rbp),%eax
+  802969:	49 39 c6             	cmp    %rax,%r14
+  80296c:	0f 83 5a 01 00 00    	jae    802acc <spawn+0x5ec>
+        if (ph->p_type != ELF_PROG_LOAD) continue;
+  802972:	41 83 7d 00 01       	cmpl   $0x1,0x0(%r13)
+  802977:	75 e1                	jne    80295a <spawn+0x47a>
+        if (ph->p_flags & ELF_PROG_FLAG_WRITE) perm |= PROT_W;
+  802979:	41 8b 45 04          	mov    0x4(%r13),%eax
+  80297d:	41 89 c4             	mov    %eax,%r12d
+  802980:	41 83 e4 02          	and    $0x2,%r12d
+        if (ph->p_flags & ELF_PROG_FLAG_READ) perm |= PROT_R;
+  802984:	44 89 e2             	mov    %r12d,%edx
+  802987:	83 ca 04             	or     $0x4,%edx
+  80298a:	a8 04                	test   $0x4,%al
+  80298c:	44 0f 45 e2          	cmovne %edx,%r12d
+        if (ph->p_flags & ELF_PROG_FLAG_EXEC) perm |= PROT_X;
+  802990:	44 89 e2             	mov    %r12d,%edx
+  802993:	83 ca 01             	or     $0x1,%edx
+  802996:	a8 01                	test   $0x1,%al
+  802998:	44 0f 45 e2          	cmovne %edx,%r12d
+        if ((res = map_segment(child, ph->p_va, ph->p_memsz,
+  80299c:	49 8b 45 08          	mov    0x8(%r13),%rax
+  8029a0:	89 85 e0 fc ff ff    	mov    %eax,-0x320(%rbp)
+  8029a6:	49 8b 5d 20          	mov    0x20(%r13),%rbx
+  8029aa:	48 89 9d d8 fc ff ff 	mov    %rbx,-0x328(%rbp)
+  8029b1:	4d 8b 7d 28          	mov    0x28(%r13),%r15
+  8029b5:	49 8b 75 10          	mov    0x10(%r13),%rsi
+  8029b9:	48 89 b5 f0 fc ff ff 	mov    %rsi,-0x310(%rbp)
+  8029c0:	8b 8d cc fd ff ff    	mov    -0x234(%rbp),%ecx
+  8029c6:	89 8d e8 fc ff ff    	mov    %ecx,-0x318(%rbp)
+    if (res) {
+  8029cc:	89 f2                	mov    %esi,%edx
+  8029ce:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  8029d4:	74 22                	je     8029f8 <spawn+0x518>
+        va -= res;
+  8029d6:	48 63 ca             	movslq %edx,%rcx
+  8029d9:	48 29 ce             	sub    %rcx,%rsi
+  8029dc:	48 89 b5 f0 fc ff ff 	mov    %rsi,-0x310(%rbp)
+        memsz += res;
+  8029e3:	49 01 cf             	add    %rcx,%r15
+        filesz += res;
+  8029e6:	48 01 cb             	add    %rcx,%rbx
+  8029e9:	48 89 9d d8 fc ff ff 	mov    %rbx,-0x328(%rbp)
+        fileoffset -= res;
+  8029f0:	29 d0                	sub    %edx,%eax
+  8029f2:	89 85 e0 fc ff ff    	mov    %eax,-0x320(%rbp)
+    res = region_queue_op(REGION_ALLOC, 0, NULL, 0, UTEMP, memsz, PROT_RW | PROT_X | ALLOC_ZERO);
+  8029f8:	48 83 ec 08          	sub    $0x8,%rsp
+  8029fc:	68 07 00 10 00       	push   $0x100007
+  802a01:	4d 89 f9             	mov    %r15,%r9
+  802a04:	41 b8 00 00 40 00    	mov    $0x400000,%r8d
+  802a0a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802a0f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a14:	be 00 00 00 00       	mov    $0x0,%esi
+  802a19:	bf 00 00 00 00       	mov    $0x0,%edi
+  802a1e:	48 b8 da 23 80 00 00 	movabs $0x8023da,%rax
+  802a25:	00 00 00 
+  802a28:	ff d0                	call   *%rax
+  802a2a:	89 c3                	mov    %eax,%ebx
+    if (res < 0 || (res = region_flush()) < 0) {
+  802a2c:	48 83 c4 10          	add    $0x10,%rsp
+  802a30:	85 c0                	test   %eax,%eax
+  802a32:	0f 88 b0 01 00 00    	js     802be8 <spawn+0x708>
+  802a38:	48 b9 2d 23 80 00 00 	movabs $0x80232d,%rcx
+  802a3f:	00 00 00 
+  802a42:	ff d1                	call   *%rcx
+  802a44:	89 c3                	mov    %eax,%ebx
+  802a46:	85 c0                	test   %eax,%eax
+  802a48:	0f 88 9a 01 00 00    	js     802be8 <spawn+0x708>
+    res = seek(fd, fileoffset);
+  802a4e:	8b b5 e0 fc ff ff    	mov    -0x320(%rbp),%esi
+  802a54:	8b bd fc fc ff ff    	mov    -0x304(%rbp),%edi
+  802a5a:	48 b9 1d 1d 80 00 00 	movabs $0x801d1d,%rcx
+  802a61:	00 00 00 
+  802a64:	ff d1                	call   *%rcx
+  802a66:	89 c3                	mov    %eax,%ebx
+    if (res < 0) {
+  802a68:	85 c0                	test   %eax,%eax
+  802a6a:	78 28                	js     802a94 <spawn+0x5b4>
+    res = readn(fd, UTEMP, filesz);
+  802a6c:	48 8b 95 d8 fc ff ff 	mov    -0x328(%rbp),%rdx
+  802a73:	be 00 00 40 00       	mov    $0x400000,%esi
+  802a78:	8b bd fc fc ff ff    	mov    -0x304(%rbp),%edi
+  802a7e:	48 b9 f3 1b 80 00 00 	movabs $0x801bf3,%rcx
+  802a85:	00 00 00 
+  802a88:	ff d1                	call   *%rcx
+  802a8a:	89 c3                	mov    %eax,%ebx
+    if (res < 0) {
+  802a8c:	85 c0                	test   %eax,%eax
+  802a8e:	0f 89 5f fe ff ff    	jns    8028f3 <spawn+0x413>
+    region_queue_op(REGION_UNMAP, 0, NULL, 0, UTEMP, memsz, 0);
+  802a94:	48 83 ec 08          	sub    $0x8,%rsp
+  802a98:	6a 00                	push   $0x0
+  802a9a:	4d 89 f9             	mov    %r15,%r9
+  802a9d:	41 b8 00 00 40 00    	mov    $0x400000,%r8d
+  802aa3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802aa8:	ba 00 00 00 00       	mov    $0x0,%edx
+  802aad:	be 00 00 00 00       	mov    $0x0,%esi
+  802ab2:	bf 02 00 00 00       	mov    $0x2,%edi
+  802ab7:	48 b8 da 23 80 00 00 	movabs $0x8023da,%rax
+  802abe:	00 00 00 
+  802ac1:	ff d0                	call   *%rax
+  802ac3:	48 83 c4 10          	add    $0x10,%rsp
+  802ac7:	e9 1c 01 00 00       	jmp    802be8 <spawn+0x708>
+    close(fd);
+  802acc:	8b bd fc fc ff ff    	mov    -0x304(%rbp),%edi
+  802ad2:	48 b8 b7 19 80 00 00 	movabs $0x8019b7,%rax
+  802ad9:	00 00 00 
+  802adc:	ff d0                	call   *%rax
+    if ((res = foreach_shared_region(copy_shared_region, &child)) < 0 ||
+  802ade:	48 8d b5 cc fd ff ff 	lea    -0x234(%rbp),%rsi
+  802ae5:	48 bf 89 24 80 00 00 	movabs $0x802489,%rdi
+  802aec:	00 00 00 
+  802aef:	48 b8 05 34 80 00 00 	movabs $0x803405,%rax
+  802af6:	00 00 00 
+  802af9:	ff d0                	call   *%rax
+  802afb:	85 c0                	test   %eax,%eax
+  802afd:	78 59                	js     802b58 <spawn+0x678>
+        (res = region_flush()) < 0)
+  802aff:	48 b8 2d 23 80 00 00 	movabs $0x80232d,%rax
+  802b06:	00 00 00 
+  802b09:	ff d0                	call   *%rax
+    if ((res = foreach_shared_region(copy_shared_region, &child)) < 0 ||
+  802b0b:	85 c0                	test   %eax,%eax
+  802b0d:	78 49                	js     802b58 <spawn+0x678>
+    if ((res = sys_env_set_trapframe(child, &child_tf)) < 0)
+  802b0f:	48 8d b5 0c fd ff ff 	lea    -0x2f4(%rbp),%rsi
+  802b16:	8b bd cc fd ff ff    	mov    -0x234(%rbp),%edi
+  802b1c:	48 b8 2a 16 80 00 00 	movabs $0x80162a,%rax
+  802b23:	00 00 00 
+  802b26:	ff d0                	call   *%rax
+  802b28:	85 c0                	test   %eax,%eax
+  802b2a:	78 59                	js     802b85 <spawn+0x6a5>
+    if ((res = sys_env_set_status(child, ENV_RUNNABLE)) < 0)
+  802b2c:	be 02 00 00 00       	mov    $0x2,%esi
+  802b31:	8b bd cc fd ff ff    	mov    -0x234(%rbp),%edi
+  802b37:	48 b8 f2 14 80 00 00 	movabs $0x8014f2,%rax
+  802b3e:	00 00 00 
+  802b41:	ff d0                	call   *%rax
+  802b43:	85 c0                	test   %eax,%eax
+  802b45:	78 6b                	js     802bb2 <spawn+0x6d2>
+    return child;
+  802b47:	8b 85 cc fd ff ff    	mov    -0x234(%rbp),%eax
+  802b4d:	89 85 fc fc ff ff    	mov    %eax,-0x304(%rbp)
+  802b53:	e9 c6 00 00 00       	jmp    802c1e <spawn+0x73e>
+        panic("copy_shared_region: %i", res);
+  802b58:	89 c1                	mov    %eax,%ecx
+  802b5a:	48 ba 3b 41 80 00 00 	movabs $0x80413b,%rdx
+  802b61:	00 00 00 
+  802b64:	be a8 00 00 00       	mov    $0xa8,%esi
+  802b69:	48 bf 2f 41 80 00 00 	movabs $0x80412f,%rdi
+  802b70:	00 00 00 
+  802b73:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b78:	49 b8 31 03 80 00 00 	movabs $0x800331,%r8
+  802b7f:	00 00 00 
+  802b82:	41 ff d0             	call   *%r8
+        panic("sys_env_set_trapframe: %i", res);
+  802b85:	89 c1                	mov    %eax,%ecx
+  802b87:	48 ba 52 41 80 00 00 	movabs $0x804152,%rdx
+  802b8e:	00 00 00 
+  802b91:	be ab 00 00 00       	mov    $0xab,%esi
+  802b96:	48 bf 2f 41 80 00 00 	movabs $0x80412f,%rdi
+  802b9d:	00 00 00 
+  802ba0:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ba5:	49 b8 31 03 80 00 00 	movabs $0x800331,%r8
+  802bac:	00 00 00 
+  802baf:	41 ff d0             	call   *%r8
+        panic("sys_env_set_status: %i", res);
+  802bb2:	89 c1                	mov    %eax,%ecx
+  802bb4:	48 ba 6c 41 80 00 00 	movabs $0x80416c,%rdx
+  802bbb:	00 00 00 
+  802bbe:	be ae 00 00 00       	mov    $0xae,%esi
+  802bc3:	48 bf 2f 41 80 00 00 	movabs $0x80412f,%rdi
+  802bca:	00 00 00 
+  802bcd:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bd2:	49 b8 31 03 80 00 00 	movabs $0x800331,%r8
+  802bd9:	00 00 00 
+  802bdc:	41 ff d0             	call   *%r8
+    if ((void *)(argv_store - 2) < (void *)UTEMP) return -E_NO_MEM;
+  802bdf:	41 bd fc ff ff ff    	mov    $0xfffffffc,%r13d
+    for (size_t i = 0; i < elf->e_phnum; i++, ph++) {
+  802be5:	44 89 eb             	mov    %r13d,%ebx
+    region_flush();
+  802be8:	48 b8 2d 23 80 00 00 	movabs $0x80232d,%rax
+  802bef:	00 00 00 
+  802bf2:	ff d0                	call   *%rax
+    sys_env_destroy(child);
+  802bf4:	8b bd cc fd ff ff    	mov    -0x234(%rbp),%edi
+  802bfa:	48 b8 2b 12 80 00 00 	movabs $0x80122b,%rax
+  802c01:	00 00 00 
+  802c04:	ff d0                	call   *%rax
+    close(fd);
+  802c06:	8b bd fc fc ff ff    	mov    -0x304(%rbp),%edi
+  802c0c:	48 b8 b7 19 80 00 00 	movabs $0x8019b7,%rax
+  802c13:	00 00 00 
+  802c16:	ff d0                	call   *%rax
+    return res;
+  802c18:	89 9d fc fc ff ff    	mov    %ebx,-0x304(%rbp)
+}
+  802c1e:	8b 85 fc fc ff ff    	mov    -0x304(%rbp),%eax
+  802c24:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  802c28:	5b                   	pop    %rbx
+  802c29:	41 5c                	pop    %r12
+  802c2b:	41 5d                	pop    %r13
+  802c2d:	41 5e                	pop    %r14
+  802c2f:	41 5f                	pop    %r15
+  802c31:	5d                   	pop    %rbp
+  802c32:	c3                   	ret
+
+0000000000802c33 <spawnl>:
+spawnl(const char *prog, const char *arg0, ...) {
+  802c33:	55                   	push   %rbp
+  802c34:	48 89 e5             	mov    %rsp,%rbp
+  802c37:	48 83 ec 50          	sub    $0x50,%rsp
+  802c3b:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  802c3f:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  802c43:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  802c47:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(vl, arg0);
+  802c4b:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  802c52:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802c56:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802c5a:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  802c5e:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int argc = 0;
+  802c62:	b9 00 00 00 00       	mov    $0x0,%ecx
+    while (va_arg(vl, void *) != NULL) argc++;
+  802c67:	eb 15                	jmp    802c7e <spawnl+0x4b>
+  802c69:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802c6d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802c71:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802c75:	48 83 3a 00          	cmpq   $0x0,(%rdx)
+  802c79:	74 1c                	je     802c97 <spawnl+0x64>
+  802c7b:	83 c1 01             	add    $0x1,%ecx
+  802c7e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802c81:	83 f8 2f             	cmp    $0x2f,%eax
+  802c84:	77 e3                	ja     802c69 <spawnl+0x36>
+  802c86:	89 c2                	mov    %eax,%edx
+  802c88:	4c 8d 55 d0          	lea    -0x30(%rbp),%r10
+  802c8c:	4c 01 d2             	add    %r10,%rdx
+  802c8f:	83 c0 08             	add    $0x8,%eax
+  802c92:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802c95:	eb de                	jmp    802c75 <spawnl+0x42>
+    const char *argv[argc + 2];
+  802c97:	8d 41 02             	lea    0x2(%rcx),%eax
+  802c9a:	48 98                	cltq
+  802c9c:	48 8d 04 c5 0f 00 00 	lea    0xf(,%rax,8),%rax
+  802ca3:	00 
+  802ca4:	48 83 e0 f0          	and    $0xfffffffffffffff0,%rax
+  802ca8:	48 29 c4             	sub    %rax,%rsp
+  802cab:	4c 8d 44 24 07       	lea    0x7(%rsp),%r8
+  802cb0:	4c 89 c0             	mov    %r8,%rax
+  802cb3:	48 c1 e8 03          	shr    $0x3,%rax
+  802cb7:	49 83 e0 f8          	and    $0xfffffffffffffff8,%r8
+    argv[0] = arg0;
+  802cbb:	48 89 34 c5 00 00 00 	mov    %rsi,0x0(,%rax,8)
+  802cc2:	00 
+    argv[argc + 1] = NULL;
+  802cc3:	8d 41 01             	lea    0x1(%rcx),%eax
+  802cc6:	48 98                	cltq
+  802cc8:	49 c7 04 c0 00 00 00 	movq   $0x0,(%r8,%rax,8)
+  802ccf:	00 
+    va_start(vl, arg0);
+  802cd0:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  802cd7:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802cdb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802cdf:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  802ce3:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    for (i = 0; i < argc; i++) {
+  802ce7:	85 c9                	test   %ecx,%ecx
+  802ce9:	74 41                	je     802d2c <spawnl+0xf9>
+        argv[i + 1] = va_arg(vl, const char *);
+  802ceb:	49 89 c1             	mov    %rax,%r9
+  802cee:	49 8d 40 08          	lea    0x8(%r8),%rax
+  802cf2:	8d 51 ff             	lea    -0x1(%rcx),%edx
+  802cf5:	49 8d 74 d0 10       	lea    0x10(%r8,%rdx,8),%rsi
+  802cfa:	eb 1b                	jmp    802d17 <spawnl+0xe4>
+  802cfc:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  802d00:	48 8d 51 08          	lea    0x8(%rcx),%rdx
+  802d04:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  802d08:	48 8b 11             	mov    (%rcx),%rdx
+  802d0b:	48 89 10             	mov    %rdx,(%rax)
+    for (i = 0; i < argc; i++) {
+  802d0e:	48 83 c0 08          	add    $0x8,%rax
+  802d12:	48 39 f0             	cmp    %rsi,%rax
+  802d15:	74 15                	je     802d2c <spawnl+0xf9>
+        argv[i + 1] = va_arg(vl, const char *);
+  802d17:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  802d1a:	83 fa 2f             	cmp    $0x2f,%edx
+  802d1d:	77 dd                	ja     802cfc <spawnl+0xc9>
+  802d1f:	89 d1                	mov    %edx,%ecx
+  802d21:	4c 01 c9             	add    %r9,%rcx
+  802d24:	83 c2 08             	add    $0x8,%edx
+  802d27:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  802d2a:	eb dc                	jmp    802d08 <spawnl+0xd5>
+    return spawn(prog, argv);
+  802d2c:	4c 89 c6             	mov    %r8,%rsi
+  802d2f:	48 b8 e0 24 80 00 00 	movabs $0x8024e0,%rax
+  802d36:	00 00 00 
+  802d39:	ff d0                	call   *%rax
+}
+  802d3b:	c9                   	leave
+  802d3c:	c3                   	ret
+
+0000000000802d3d <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  802d3d:	55                   	push   %rbp
+  802d3e:	48 89 e5             	mov    %rsp,%rbp
+  802d41:	41 54                	push   %r12
+  802d43:	53                   	push   %rbx
+  802d44:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802d47:	48 b8 a3 17 80 00 00 	movabs $0x8017a3,%rax
+  802d4e:	00 00 00 
+  802d51:	ff d0                	call   *%rax
+  802d53:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  802d56:	48 be 83 41 80 00 00 	movabs $0x804183,%rsi
+  802d5d:	00 00 00 
+  802d60:	48 89 df             	mov    %rbx,%rdi
+  802d63:	48 b8 a6 0d 80 00 00 	movabs $0x800da6,%rax
+  802d6a:	00 00 00 
+  802d6d:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  802d6f:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  802d74:	41 2b 04 24          	sub    (%r12),%eax
+  802d78:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  802d7e:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  802d85:	00 00 00 
+    stat->st_dev = &devpipe;
+  802d88:	48 b8 60 50 80 00 00 	movabs $0x805060,%rax
+  802d8f:	00 00 00 
+  802d92:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  802d99:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d9e:	5b                   	pop    %rbx
+  802d9f:	41 5c                	pop    %r12
+  802da1:	5d                   	pop    %rbp
+  802da2:	c3                   	ret
+
+0000000000802da3 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  802da3:	55                   	push   %rbp
+  802da4:	48 89 e5             	mov    %rsp,%rbp
+  802da7:	41 54                	push   %r12
+  802da9:	53                   	push   %rbx
+  802daa:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  802dad:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802db2:	48 89 fe             	mov    %rdi,%rsi
+  802db5:	bf 00 00 00 00       	mov    $0x0,%edi
+  802dba:	49 bc 22 14 80 00 00 	movabs $0x801422,%r12
+  802dc1:	00 00 00 
+  802dc4:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  802dc7:	48 89 df             	mov    %rbx,%rdi
+  802dca:	48 b8 a3 17 80 00 00 	movabs $0x8017a3,%rax
+  802dd1:	00 00 00 
+  802dd4:	ff d0                	call   *%rax
+  802dd6:	48 89 c6             	mov    %rax,%rsi
+  802dd9:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802dde:	bf 00 00 00 00       	mov    $0x0,%edi
+  802de3:	41 ff d4             	call   *%r12
+}
+  802de6:	5b                   	pop    %rbx
+  802de7:	41 5c                	pop    %r12
+  802de9:	5d                   	pop    %rbp
+  802dea:	c3                   	ret
+
+0000000000802deb <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  802deb:	55                   	push   %rbp
+  802dec:	48 89 e5             	mov    %rsp,%rbp
+  802def:	41 57                	push   %r15
+  802df1:	41 56                	push   %r14
+  802df3:	41 55                	push   %r13
+  802df5:	41 54                	push   %r12
+  802df7:	53                   	push   %rbx
+  802df8:	48 83 ec 18          	sub    $0x18,%rsp
+  802dfc:	49 89 fc             	mov    %rdi,%r12
+  802dff:	49 89 f5             	mov    %rsi,%r13
+  802e02:	49 89 d7             	mov    %rdx,%r15
+  802e05:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802e09:	48 b8 a3 17 80 00 00 	movabs $0x8017a3,%rax
+  802e10:	00 00 00 
+  802e13:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  802e15:	4d 85 ff             	test   %r15,%r15
+  802e18:	0f 84 af 00 00 00    	je     802ecd <devpipe_write+0xe2>
+  802e1e:	48 89 c3             	mov    %rax,%rbx
+  802e21:	4c 89 f8             	mov    %r15,%rax
+  802e24:	4d 89 ef             	mov    %r13,%r15
+  802e27:	4c 01 e8             	add    %r13,%rax
+  802e2a:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802e2e:	49 bd 2a 13 80 00 00 	movabs $0x80132a,%r13
+  802e35:	00 00 00 
+            sys_yield();
+  802e38:	49 be c7 12 80 00 00 	movabs $0x8012c7,%r14
+  802e3f:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  802e42:	8b 73 04             	mov    0x4(%rbx),%esi
+  802e45:	48 63 ce             	movslq %esi,%rcx
+  802e48:	48 63 03             	movslq (%rbx),%rax
+  802e4b:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  802e51:	48 39 c1             	cmp    %rax,%rcx
+  802e54:	72 2e                	jb     802e84 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802e56:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802e5b:	48 89 da             	mov    %rbx,%rdx
+  802e5e:	be 00 10 00 00       	mov    $0x1000,%esi
+  802e63:	4c 89 e7             	mov    %r12,%rdi
+  802e66:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  802e69:	85 c0                	test   %eax,%eax
+  802e6b:	74 66                	je     802ed3 <devpipe_write+0xe8>
+            sys_yield();
+  802e6d:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  802e70:	8b 73 04             	mov    0x4(%rbx),%esi
+  802e73:	48 63 ce             	movslq %esi,%rcx
+  802e76:	48 63 03             	movslq (%rbx),%rax
+  802e79:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  802e7f:	48 39 c1             	cmp    %rax,%rcx
+  802e82:	73 d2                	jae    802e56 <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  802e84:	41 0f b6 3f          	movzbl (%r15),%edi
+  802e88:	48 89 ca             	mov    %rcx,%rdx
+  802e8b:	48 c1 ea 03          	shr    $0x3,%rdx
+  802e8f:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  802e96:	08 10 20 
+  802e99:	48 f7 e2             	mul    %rdx
+  802e9c:	48 c1 ea 06          	shr    $0x6,%rdx
+  802ea0:	48 89 d0             	mov    %rdx,%rax
+  802ea3:	48 c1 e0 09          	shl    $0x9,%rax
+  802ea7:	48 29 d0             	sub    %rdx,%rax
+  802eaa:	48 c1 e0 03          	shl    $0x3,%rax
+  802eae:	48 29 c1             	sub    %rax,%rcx
+  802eb1:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  802eb6:	83 c6 01             	add    $0x1,%esi
+  802eb9:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  802ebc:	49 83 c7 01          	add    $0x1,%r15
+  802ec0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802ec4:	49 39 c7             	cmp    %rax,%r15
+  802ec7:	0f 85 75 ff ff ff    	jne    802e42 <devpipe_write+0x57>
+    return n;
+  802ecd:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802ed1:	eb 05                	jmp    802ed8 <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  802ed3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802ed8:	48 83 c4 18          	add    $0x18,%rsp
+  802edc:	5b                   	pop    %rbx
+  802edd:	41 5c                	pop    %r12
+  802edf:	41 5d                	pop    %r13
+  802ee1:	41 5e                	pop    %r14
+  802ee3:	41 5f                	pop    %r15
+  802ee5:	5d                   	pop    %rbp
+  802ee6:	c3                   	ret
+
+0000000000802ee7 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  802ee7:	55                   	push   %rbp
+  802ee8:	48 89 e5             	mov    %rsp,%rbp
+  802eeb:	41 57                	push   %r15
+  802eed:	41 56                	push   %r14
+  802eef:	41 55                	push   %r13
+  802ef1:	41 54                	push   %r12
+  802ef3:	53                   	push   %rbx
+  802ef4:	48 83 ec 18          	sub    $0x18,%rsp
+  802ef8:	49 89 fc             	mov    %rdi,%r12
+  802efb:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  802eff:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802f03:	48 b8 a3 17 80 00 00 	movabs $0x8017a3,%rax
+  802f0a:	00 00 00 
+  802f0d:	ff d0                	call   *%rax
+  802f0f:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  802f12:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802f18:	49 bd 2a 13 80 00 00 	movabs $0x80132a,%r13
+  802f1f:	00 00 00 
+            sys_yield();
+  802f22:	49 be c7 12 80 00 00 	movabs $0x8012c7,%r14
+  802f29:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  802f2c:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  802f31:	74 7d                	je     802fb0 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  802f33:	8b 03                	mov    (%rbx),%eax
+  802f35:	3b 43 04             	cmp    0x4(%rbx),%eax
+  802f38:	75 26                	jne    802f60 <devpipe_read+0x79>
+            if (i > 0) return i;
+  802f3a:	4d 85 ff             	test   %r15,%r15
+  802f3d:	75 77                	jne    802fb6 <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802f3f:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802f44:	48 89 da             	mov    %rbx,%rdx
+  802f47:	be 00 10 00 00       	mov    $0x1000,%esi
+  802f4c:	4c 89 e7             	mov    %r12,%rdi
+  802f4f:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  802f52:	85 c0                	test   %eax,%eax
+  802f54:	74 72                	je     802fc8 <devpipe_read+0xe1>
+            sys_yield();
+  802f56:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  802f59:	8b 03                	mov    (%rbx),%eax
+  802f5b:	3b 43 04             	cmp    0x4(%rbx),%eax
+  802f5e:	74 df                	je     802f3f <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802f60:	48 63 c8             	movslq %eax,%rcx
+  802f63:	48 89 ca             	mov    %rcx,%rdx
+  802f66:	48 c1 ea 03          	shr    $0x3,%rdx
+  802f6a:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  802f71:	08 10 20 
+  802f74:	48 89 d0             	mov    %rdx,%rax
+  802f77:	48 f7 e6             	mul    %rsi
+  802f7a:	48 c1 ea 06          	shr    $0x6,%rdx
+  802f7e:	48 89 d0             	mov    %rdx,%rax
+  802f81:	48 c1 e0 09          	shl    $0x9,%rax
+  802f85:	48 29 d0             	sub    %rdx,%rax
+  802f88:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  802f8f:	00 
+  802f90:	48 89 c8             	mov    %rcx,%rax
+  802f93:	48 29 d0             	sub    %rdx,%rax
+  802f96:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  802f9b:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  802f9f:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  802fa3:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  802fa6:	49 83 c7 01          	add    $0x1,%r15
+  802faa:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  802fae:	75 83                	jne    802f33 <devpipe_read+0x4c>
+    return n;
+  802fb0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802fb4:	eb 03                	jmp    802fb9 <devpipe_read+0xd2>
+            if (i > 0) return i;
+  802fb6:	4c 89 f8             	mov    %r15,%rax
+}
+  802fb9:	48 83 c4 18          	add    $0x18,%rsp
+  802fbd:	5b                   	pop    %rbx
+  802fbe:	41 5c                	pop    %r12
+  802fc0:	41 5d                	pop    %r13
+  802fc2:	41 5e                	pop    %r14
+  802fc4:	41 5f                	pop    %r15
+  802fc6:	5d                   	pop    %rbp
+  802fc7:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  802fc8:	b8 00 00 00 00       	mov    $0x0,%eax
+  802fcd:	eb ea                	jmp    802fb9 <devpipe_read+0xd2>
+
+0000000000802fcf <pipe>:
+pipe(int pfd[2]) {
+  802fcf:	55                   	push   %rbp
+  802fd0:	48 89 e5             	mov    %rsp,%rbp
+  802fd3:	41 55                	push   %r13
+  802fd5:	41 54                	push   %r12
+  802fd7:	53                   	push   %rbx
+  802fd8:	48 81 ec b8 00 00 00 	sub    $0xb8,%rsp
+  802fdf:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  802fe2:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802fe6:	48 b8 38 18 80 00 00 	movabs $0x801838,%rax
+  802fed:	00 00 00 
+  802ff0:	ff d0                	call   *%rax
+  802ff2:	89 c3                	mov    %eax,%ebx
+  802ff4:	85 c0                	test   %eax,%eax
+  802ff6:	0f 88 51 01 00 00    	js     80314d <pipe+0x17e>
+        (res = fd_alloc_from(fd2num(fd0) + 1, &fd1)) < 0) goto err;
+  802ffc:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803000:	48 b8 91 17 80 00 00 	movabs $0x801791,%rax
+  803007:	00 00 00 
+  80300a:	ff d0                	call   *%rax
+  80300c:	8d 78 01             	lea    0x1(%rax),%edi
+  80300f:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  803013:	48 b8 bf 17 80 00 00 	movabs $0x8017bf,%rax
+  80301a:	00 00 00 
+  80301d:	ff d0                	call   *%rax
+  80301f:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803021:	85 c0                	test   %eax,%eax
+  803023:	0f 88 24 01 00 00    	js     80314d <pipe+0x17e>
+    va = fd2data(fd0);
+  803029:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80302d:	48 bb a3 17 80 00 00 	movabs $0x8017a3,%rbx
+  803034:	00 00 00 
+  803037:	ff d3                	call   *%rbx
+  803039:	49 89 c5             	mov    %rax,%r13
+    struct RegionOp ops[] = {
+  80303c:	48 8d bd 30 ff ff ff 	lea    -0xd0(%rbp),%rdi
+  803043:	b9 14 00 00 00       	mov    $0x14,%ecx
+  803048:	b8 00 00 00 00       	mov    $0x0,%eax
+  80304d:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+  803050:	c7 85 34 ff ff ff 46 	movl   $0x46,-0xcc(%rbp)
+  803057:	00 00 00 
+  80305a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80305e:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+  803065:	48 c7 85 50 ff ff ff 	movq   $0x1000,-0xb0(%rbp)
+  80306c:	00 10 00 00 
+  803070:	c7 85 5c ff ff ff 46 	movl   $0x46,-0xa4(%rbp)
+  803077:	00 00 00 
+            {.type = REGION_ALLOC, .dstva = (uintptr_t)fd1, .size = PAGE_SIZE, .perm = PROT_RW | PROT_SHARE},
+  80307a:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+    struct RegionOp ops[] = {
+  80307e:	48 89 bd 70 ff ff ff 	mov    %rdi,-0x90(%rbp)
+  803085:	48 c7 85 78 ff ff ff 	movq   $0x1000,-0x88(%rbp)
+  80308c:	00 10 00 00 
+  803090:	c7 45 84 46 00 00 00 	movl   $0x46,-0x7c(%rbp)
+  803097:	4c 89 6d 98          	mov    %r13,-0x68(%rbp)
+  80309b:	48 c7 45 a0 00 10 00 	movq   $0x1000,-0x60(%rbp)
+  8030a2:	00 
+  8030a3:	c7 45 a8 01 00 00 00 	movl   $0x1,-0x58(%rbp)
+  8030aa:	c7 45 ac 46 00 00 00 	movl   $0x46,-0x54(%rbp)
+  8030b1:	4c 89 6d b8          	mov    %r13,-0x48(%rbp)
+            {.type = REGION_MAP, .srcva = (uintptr_t)va, .dstva = (uintptr_t)fd2data(fd1), .size = PAGE_SIZE, .perm = PROT_RW | PROT_SHARE},
+  8030b5:	ff d3                	call   *%rbx
+    struct RegionOp ops[] = {
+  8030b7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8030bb:	48 c7 45 c8 00 10 00 	movq   $0x1000,-0x38(%rbp)
+  8030c2:	00 
+    if ((res = sys_region_batch(ops, sizeof ops / sizeof *ops)) < 0) goto err1;
+  8030c3:	be 04 00 00 00       	mov    $0x4,%esi
+  8030c8:	48 8d bd 30 ff ff ff 	lea    -0xd0(%rbp),%rdi
+  8030cf:	48 b8 89 14 80 00 00 	movabs $0x801489,%rax
+  8030d6:	00 00 00 
+  8030d9:	ff d0                	call   *%rax
+  8030db:	89 c3                	mov    %eax,%ebx
+  8030dd:	85 c0                	test   %eax,%eax
+  8030df:	0f 88 ad 00 00 00    	js     803192 <pipe+0x1c3>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8030e5:	be 00 10 00 00       	mov    $0x1000,%esi
+  8030ea:	4c 89 ef             	mov    %r13,%rdi
+  8030ed:	48 b8 f8 12 80 00 00 	movabs $0x8012f8,%rax
+  8030f4:	00 00 00 
+  8030f7:	ff d0                	call   *%rax
+  8030f9:	83 f8 02             	cmp    $0x2,%eax
+  8030fc:	75 5f                	jne    80315d <pipe+0x18e>
+    fd0->fd_dev_id = devpipe.dev_id;
+  8030fe:	a1 60 50 80 00 00 00 	movabs 0x805060,%eax
+  803105:	00 00 
+  803107:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80310b:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  80310d:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803111:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  803118:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  80311c:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  80311e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803122:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  803129:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80312d:	48 bb 91 17 80 00 00 	movabs $0x801791,%rbx
+  803134:	00 00 00 
+  803137:	ff d3                	call   *%rbx
+  803139:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  80313d:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  803141:	ff d3                	call   *%rbx
+  803143:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  803148:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  80314d:	89 d8                	mov    %ebx,%eax
+  80314f:	48 81 c4 b8 00 00 00 	add    $0xb8,%rsp
+  803156:	5b                   	pop    %rbx
+  803157:	41 5c                	pop    %r12
+  803159:	41 5d                	pop    %r13
+  80315b:	5d                   	pop    %rbp
+  80315c:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  80315d:	48 b9 a0 41 80 00 00 	movabs $0x8041a0,%rcx
+  803164:	00 00 00 
+  803167:	48 ba 1a 41 80 00 00 	movabs $0x80411a,%rdx
+  80316e:	00 00 00 
+  803171:	be 33 00 00 00       	mov    $0x33,%esi
+  803176:	48 bf 8a 41 80 00 00 	movabs $0x80418a,%rdi
+  80317d:	00 00 00 
+  803180:	b8 00 00 00 00       	mov    $0x0,%eax
+  803185:	49 b8 31 03 80 00 00 	movabs $0x800331,%r8
+  80318c:	00 00 00 
+  80318f:	41 ff d0             	call   *%r8
+        ops[i].type = REGION_UNMAP;
+  803192:	c7 85 30 ff ff ff 02 	movl   $0x2,-0xd0(%rbp)
+  803199:	00 00 00 
+  80319c:	c7 85 58 ff ff ff 02 	movl   $0x2,-0xa8(%rbp)
+  8031a3:	00 00 00 
+  8031a6:	c7 45 80 02 00 00 00 	movl   $0x2,-0x80(%rbp)
+  8031ad:	c7 45 a8 02 00 00 00 	movl   $0x2,-0x58(%rbp)
+    sys_region_batch(ops, sizeof ops / sizeof *ops);
+  8031b4:	be 04 00 00 00       	mov    $0x4,%esi
+  8031b9:	48 8d bd 30 ff ff ff 	lea    -0xd0(%rbp),%rdi
+  8031c0:	48 b8 89 14 80 00 00 	movabs $0x801489,%rax
+  8031c7:	00 00 00 
+  8031ca:	ff d0                	call   *%rax
+  8031cc:	e9 7c ff ff ff       	jmp    80314d <pipe+0x17e>
+
+00000000008031d1 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  8031d1:	55                   	push   %rbp
+  8031d2:	48 89 e5             	mov    %rsp,%rbp
+  8031d5:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8031d9:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8031dd:	48 b8 52 18 80 00 00 	movabs $0x801852,%rax
+  8031e4:	00 00 00 
+  8031e7:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8031e9:	85 c0                	test   %eax,%eax
+  8031eb:	78 35                	js     803222 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  8031ed:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8031f1:	48 b8 a3 17 80 00 00 	movabs $0x8017a3,%rax
+  8031f8:	00 00 00 
+  8031fb:	ff d0                	call   *%rax
+  8031fd:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803200:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803205:	be 00 10 00 00       	mov    $0x1000,%esi
+  80320a:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80320e:	48 b8 2a 13 80 00 00 	movabs $0x80132a,%rax
+  803215:	00 00 00 
+  803218:	ff d0                	call   *%rax
+  80321a:	85 c0                	test   %eax,%eax
+  80321c:	0f 94 c0             	sete   %al
+  80321f:	0f b6 c0             	movzbl %al,%eax
+}
+  803222:	c9                   	leave
+  803223:	c3                   	ret
+
+0000000000803224 <wait>:
+#include <inc/lib.h>
+
+/* Waits until 'envid' exits. */
+void
+wait(envid_t envid) {
+  803224:	55                   	push   %rbp
+  803225:	48 89 e5             	mov    %rsp,%rbp
+  803228:	41 55                	push   %r13
+  80322a:	41 54                	push   %r12
+  80322c:	53                   	push   %rbx
+  80322d:	48 83 ec 08          	sub    $0x8,%rsp
+    assert(envid != 0);
+  803231:	85 ff                	test   %edi,%edi
+  803233:	74 73                	je     8032a8 <wait+0x84>
+  803235:	41 89 fc             	mov    %edi,%r12d
+
+    const volatile struct Env *env = &envs[ENVX(envid)];
+  803238:	89 f8                	mov    %edi,%eax
+  80323a:	25 ff 03 00 00       	and    $0x3ff,%eax
+
+    while (env->env_id == envid &&
+  80323f:	89 f9                	mov    %edi,%ecx
+  803241:	81 e1 ff 03 00 00    	and    $0x3ff,%ecx
+  803247:	48 69 c9 d0 01 00 00 	imul   $0x1d0,%rcx,%rcx
+  80324e:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  803255:	00 00 00 
+  803258:	48 01 ca             	add    %rcx,%rdx
+  80325b:	8b 92 e0 00 00 00    	mov    0xe0(%rdx),%edx
+  803261:	39 d7                	cmp    %edx,%edi
+  803263:	75 38                	jne    80329d <wait+0x79>
+           env->env_status != ENV_FREE) {
+  803265:	48 98                	cltq
+  803267:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+  80326e:	48 bb 00 00 c0 1f 80 	movabs $0x801fc00000,%rbx
+  803275:	00 00 00 
+  803278:	48 01 c3             	add    %rax,%rbx
+        sys_yield();
+  80327b:	49 bd c7 12 80 00 00 	movabs $0x8012c7,%r13
+  803282:	00 00 00 
+           env->env_status != ENV_FREE) {
+  803285:	8b 83 ec 00 00 00    	mov    0xec(%rbx),%eax
+    while (env->env_id == envid &&
+  80328b:	85 c0                	test   %eax,%eax
+  80328d:	74 0e                	je     80329d <wait+0x79>
+        sys_yield();
+  80328f:	41 ff d5             	call   *%r13
+    while (env->env_id == envid &&
+  803292:	8b 83 e0 00 00 00    	mov    0xe0(%rbx),%eax
+  803298:	44 39 e0             	cmp    %r12d,%eax
+  80329b:	74 e8                	je     803285 <wait+0x61>
+    }
+}
+  80329d:	48 83 c4 08          	add    $0x8,%rsp
+  8032a1:	5b                   	pop    %rbx
+  8032a2:	41 5c                	pop    %r12
+  8032a4:	41 5d                	pop    %r13
+  8032a6:	5d                   	pop    %rbp
+  8032a7:	c3                   	ret
+    assert(envid != 0);
+  8032a8:	48 b9 c4 41 80 00 00 	movabs $0x8041c4,%rcx
+  8032af:	00 00 00 
+  8032b2:	48 ba 1a 41 80 00 00 	movabs $0x80411a,%rdx
+  8032b9:	00 00 00 
+  8032bc:	be 06 00 00 00       	mov    $0x6,%esi
+  8032c1:	48 bf cf 41 80 00 00 	movabs $0x8041cf,%rdi
+  8032c8:	00 00 00 
+  8032cb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8032d0:	49 b8 31 03 80 00 00 	movabs $0x800331,%r8
+  8032d7:	00 00 00 
+  8032da:	41 ff d0             	call   *%r8
+
+00000000008032dd <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8032dd:	48 89 f8             	mov    %rdi,%rax
+  8032e0:	48 c1 e8 27          	shr    $0x27,%rax
+  8032e4:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  8032eb:	01 00 00 
+  8032ee:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8032f2:	f6 c2 01             	test   $0x1,%dl
+  8032f5:	74 6d                	je     803364 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8032f7:	48 89 f8             	mov    %rdi,%rax
+  8032fa:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8032fe:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  803305:	01 00 00 
+  803308:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80330c:	f6 c2 01             	test   $0x1,%dl
+  80330f:	74 62                	je     803373 <get_uvpt_entry+0x96>
+  803311:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  803318:	01 00 00 
+  80331b:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80331f:	f6 c2 80             	test   $0x80,%dl
+  803322:	75 4f                	jne    803373 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803324:	48 89 f8             	mov    %rdi,%rax
+  803327:	48 c1 e8 15          	shr    $0x15,%rax
+  80332b:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  803332:	01 00 00 
+  803335:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803339:	f6 c2 01             	test   $0x1,%dl
+  80333c:	74 44                	je     803382 <get_uvpt_entry+0xa5>
+  80333e:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  803345:	01 00 00 
+  803348:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80334c:	f6 c2 80             	test   $0x80,%dl
+  80334f:	75 31                	jne    803382 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  803351:	48 c1 ef 0c          	shr    $0xc,%rdi
+  803355:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  80335c:	01 00 00 
+  80335f:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  803363:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803364:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  80336b:	01 00 00 
+  80336e:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803372:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803373:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  80337a:	01 00 00 
+  80337d:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803381:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803382:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  803389:	01 00 00 
+  80338c:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803390:	c3                   	ret
+
+0000000000803391 <get_prot>:
+
+int
+get_prot(void *va) {
+  803391:	55                   	push   %rbp
+  803392:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803395:	48 b8 dd 32 80 00 00 	movabs $0x8032dd,%rax
+  80339c:	00 00 00 
+  80339f:	ff d0                	call   *%rax
+  8033a1:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  8033a4:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  8033a9:	89 c1                	mov    %eax,%ecx
+  8033ab:	83 c9 04             	or     $0x4,%ecx
+  8033ae:	f6 c2 01             	test   $0x1,%dl
+  8033b1:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  8033b4:	89 c1                	mov    %eax,%ecx
+  8033b6:	83 c9 02             	or     $0x2,%ecx
+  8033b9:	f6 c2 02             	test   $0x2,%dl
+  8033bc:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  8033bf:	89 c1                	mov    %eax,%ecx
+  8033c1:	83 c9 01             	or     $0x1,%ecx
+  8033c4:	48 85 d2             	test   %rdx,%rdx
+  8033c7:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  8033ca:	89 c1                	mov    %eax,%ecx
+  8033cc:	83 c9 40             	or     $0x40,%ecx
+  8033cf:	f6 c6 04             	test   $0x4,%dh
+  8033d2:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  8033d5:	5d                   	pop    %rbp
+  8033d6:	c3                   	ret
+
+00000000008033d7 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  8033d7:	55                   	push   %rbp
+  8033d8:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8033db:	48 b8 dd 32 80 00 00 	movabs $0x8032dd,%rax
+  8033e2:	00 00 00 
+  8033e5:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  8033e7:	48 c1 e8 06          	shr    $0x6,%rax
+  8033eb:	83 e0 01             	and    $0x1,%eax
+}
+  8033ee:	5d                   	pop    %rbp
+  8033ef:	c3                   	ret
+
+00000000008033f0 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  8033f0:	55                   	push   %rbp
+  8033f1:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  8033f4:	48 b8 dd 32 80 00 00 	movabs $0x8032dd,%rax
+  8033fb:	00 00 00 
+  8033fe:	ff d0                	call   *%rax
+  803400:	83 e0 01             	and    $0x1,%eax
+}
+  803403:	5d                   	pop    %rbp
+  803404:	c3                   	ret
+
+0000000000803405 <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  803405:	55                   	push   %rbp
+  803406:	48 89 e5             	mov    %rsp,%rbp
+  803409:	41 57                	push   %r15
+  80340b:	41 56                	push   %r14
+  80340d:	41 55                	push   %r13
+  80340f:	41 54                	push   %r12
+  803411:	53                   	push   %rbx
+  803412:	48 83 ec 38          	sub    $0x38,%rsp
+  803416:	49 89 f7             	mov    %rsi,%r15
+  803419:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+                    }
+                    continue;
+                }
+                for (int ptei = 0; ptei < PT_ENTRY_COUNT; ptei++) {
+                    uintptr_t pte_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, pdei, ptei, 0);
+                    pte_t pte = uvpt[VPT(pte_addr)];
+  80341f:	49 bd 00 00 00 00 00 	movabs $0x10000000000,%r13
+  803426:	01 00 00 
+  803429:	4d 89 e6             	mov    %r12,%r14
+  80342c:	49 89 fc             	mov    %rdi,%r12
+  80342f:	e9 19 01 00 00       	jmp    80354d <foreach_shared_region+0x148>
+  803434:	48 89 5d b0          	mov    %rbx,-0x50(%rbp)
+  803438:	4c 89 75 a8          	mov    %r14,-0x58(%rbp)
+  80343c:	eb 52                	jmp    803490 <foreach_shared_region+0x8b>
+                for (int ptei = 0; ptei < PT_ENTRY_COUNT; ptei++) {
+  80343e:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  803445:	48 81 fb 00 00 20 00 	cmp    $0x200000,%rbx
+  80344c:	74 2e                	je     80347c <foreach_shared_region+0x77>
+                    uintptr_t pte_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, pdei, ptei, 0);
+  80344e:	48 89 df             	mov    %rbx,%rdi
+  803451:	4c 09 f7             	or     %r14,%rdi
+                    pte_t pte = uvpt[VPT(pte_addr)];
+  803454:	48 89 f8             	mov    %rdi,%rax
+  803457:	48 c1 e8 0c          	shr    $0xc,%rax
+  80345b:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+                    if ((pte & PTE_P) && (pte & PTE_SHARE)) {
+  803460:	25 01 04 00 00       	and    $0x401,%eax
+  803465:	48 3d 01 04 00 00    	cmp    $0x401,%rax
+  80346b:	75 d1                	jne    80343e <foreach_shared_region+0x39>
+                        fun((void*)pte_addr, (void*)(pte_addr + PAGE_SIZE), arg);
+  80346d:	48 8d b7 00 10 00 00 	lea    0x1000(%rdi),%rsi
+  803474:	4c 89 fa             	mov    %r15,%rdx
+  803477:	41 ff d4             	call   *%r12
+  80347a:	eb c2                	jmp    80343e <foreach_shared_region+0x39>
+            for (int pdei = 0; pdei < PD_ENTRY_COUNT; pdei++) {
+  80347c:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  803483:	00 
+  803484:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803488:	48 3d 00 00 00 40    	cmp    $0x40000000,%rax
+  80348e:	74 46                	je     8034d6 <foreach_shared_region+0xd1>
+                uintptr_t pde_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, pdei, 0, 0);
+  803490:	4c 8b 75 c8          	mov    -0x38(%rbp),%r14
+  803494:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803498:	49 09 c6             	or     %rax,%r14
+                pde_t pde = uvpd[VPD(pde_addr)];
+  80349b:	4c 89 f0             	mov    %r14,%rax
+  80349e:	48 c1 e8 15          	shr    $0x15,%rax
+  8034a2:	48 b9 00 00 00 80 00 	movabs $0x10080000000,%rcx
+  8034a9:	01 00 00 
+  8034ac:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+                if (!(pde & PTE_P)) {
+  8034b0:	a8 01                	test   $0x1,%al
+  8034b2:	74 c8                	je     80347c <foreach_shared_region+0x77>
+                if (pde & PTE_PS) {
+  8034b4:	48 89 c3             	mov    %rax,%rbx
+  8034b7:	81 e3 80 00 00 00    	and    $0x80,%ebx
+  8034bd:	74 8f                	je     80344e <foreach_shared_region+0x49>
+                    if (pde & PTE_SHARE) {
+  8034bf:	f6 c4 04             	test   $0x4,%ah
+  8034c2:	74 b8                	je     80347c <foreach_shared_region+0x77>
+                        fun((void*)pde_addr, (void*)(pde_addr + 1024 * 1024 * 2), arg);
+  8034c4:	49 8d b6 00 00 20 00 	lea    0x200000(%r14),%rsi
+  8034cb:	4c 89 fa             	mov    %r15,%rdx
+  8034ce:	4c 89 f7             	mov    %r14,%rdi
+  8034d1:	41 ff d4             	call   *%r12
+  8034d4:	eb a6                	jmp    80347c <foreach_shared_region+0x77>
+  8034d6:	48 8b 5d b0          	mov    -0x50(%rbp),%rbx
+  8034da:	4c 8b 75 a8          	mov    -0x58(%rbp),%r14
+        for (int pdpei = 0; pdpei < PDP_ENTRY_COUNT; pdpei++) {
+  8034de:	48 81 c3 00 00 00 40 	add    $0x40000000,%rbx
+  8034e5:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8034ec:	00 00 00 
+  8034ef:	48 39 c3             	cmp    %rax,%rbx
+  8034f2:	74 4c                	je     803540 <foreach_shared_region+0x13b>
+            uintptr_t pdpe_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, 0, 0, 0);
+  8034f4:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  8034f8:	48 09 d8             	or     %rbx,%rax
+  8034fb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+            pdpe_t pdpe = uvpdp[VPDP(pdpe_addr)];
+  8034ff:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803503:	48 b9 00 00 40 80 00 	movabs $0x10080400000,%rcx
+  80350a:	01 00 00 
+  80350d:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+            if (!(pdpe & PTE_P)) {
+  803511:	a8 01                	test   $0x1,%al
+  803513:	74 c9                	je     8034de <foreach_shared_region+0xd9>
+            if (pdpe & PTE_PS) {
+  803515:	48 89 c1             	mov    %rax,%rcx
+  803518:	81 e1 80 00 00 00    	and    $0x80,%ecx
+  80351e:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  803522:	0f 84 0c ff ff ff    	je     803434 <foreach_shared_region+0x2f>
+                if (pdpe & PTE_SHARE) {
+  803528:	f6 c4 04             	test   $0x4,%ah
+  80352b:	74 b1                	je     8034de <foreach_shared_region+0xd9>
+                    fun((void*)pdpe_addr, (void*)(pdpe_addr + 1024 * 1024 * 1024), arg); 
+  80352d:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  803531:	48 8d b7 00 00 00 40 	lea    0x40000000(%rdi),%rsi
+  803538:	4c 89 fa             	mov    %r15,%rdx
+  80353b:	41 ff d4             	call   *%r12
+  80353e:	eb 9e                	jmp    8034de <foreach_shared_region+0xd9>
+    for (int pml4ei = 0; pml4ei < PML4_ENTRY_COUNT; pml4ei++) {
+  803540:	49 83 c6 01          	add    $0x1,%r14
+  803544:	49 81 fe 00 02 00 00 	cmp    $0x200,%r14
+  80354b:	74 24                	je     803571 <foreach_shared_region+0x16c>
+        pml4e_t pml4e = uvpml4[VPML4(pml4_addr)];
+  80354d:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  803554:	01 00 00 
+  803557:	4a 8b 04 f0          	mov    (%rax,%r14,8),%rax
+        if (!(pml4e & PTE_P)) {
+  80355b:	a8 01                	test   $0x1,%al
+  80355d:	74 e1                	je     803540 <foreach_shared_region+0x13b>
+  80355f:	4c 89 f0             	mov    %r14,%rax
+  803562:	48 c1 e0 27          	shl    $0x27,%rax
+  803566:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  80356a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80356f:	eb 83                	jmp    8034f4 <foreach_shared_region+0xef>
+            }
+        }
+    }
+    
+    return 0;
+}
+  803571:	b8 00 00 00 00       	mov    $0x0,%eax
+  803576:	48 83 c4 38          	add    $0x38,%rsp
+  80357a:	5b                   	pop    %rbx
+  80357b:	41 5c                	pop    %r12
+  80357d:	41 5d                	pop    %r13
+  80357f:	41 5e                	pop    %r14
+  803581:	41 5f                	pop    %r15
+  803583:	5d                   	pop    %rbp
+  803584:	c3                   	ret
+
+0000000000803585 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  803585:	b8 00 00 00 00       	mov    $0x0,%eax
+  80358a:	c3                   	ret
+
+000000000080358b <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  80358b:	55                   	push   %rbp
+  80358c:	48 89 e5             	mov    %rsp,%rbp
+  80358f:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  803592:	48 be da 41 80 00 00 	movabs $0x8041da,%rsi
+  803599:	00 00 00 
+  80359c:	48 b8 a6 0d 80 00 00 	movabs $0x800da6,%rax
+  8035a3:	00 00 00 
+  8035a6:	ff d0                	call   *%rax
+    return 0;
+}
+  8035a8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8035ad:	5d                   	pop    %rbp
+  8035ae:	c3                   	ret
+
+00000000008035af <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8035af:	55                   	push   %rbp
+  8035b0:	48 89 e5             	mov    %rsp,%rbp
+  8035b3:	41 57                	push   %r15
+  8035b5:	41 56                	push   %r14
+  8035b7:	41 55                	push   %r13
+  8035b9:	41 54                	push   %r12
+  8035bb:	53                   	push   %rbx
+  8035bc:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  8035c3:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  8035ca:	48 85 d2             	test   %rdx,%rdx
+  8035cd:	74 7a                	je     803649 <devcons_write+0x9a>
+  8035cf:	49 89 d6             	mov    %rdx,%r14
+  8035d2:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8035d8:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  8035dd:	49 bf a0 0f 80 00 00 	movabs $0x800fa0,%r15
+  8035e4:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  8035e7:	4c 89 f3             	mov    %r14,%rbx
+  8035ea:	48 29 f3             	sub    %rsi,%rbx
+  8035ed:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8035f2:	48 39 c3             	cmp    %rax,%rbx
+  8035f5:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  8035f9:	4c 63 eb             	movslq %ebx,%r13
+  8035fc:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  803603:	48 01 c6             	add    %rax,%rsi
+  803606:	4c 89 ea             	mov    %r13,%rdx
+  803609:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  803610:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  803613:	4c 89 ee             	mov    %r13,%rsi
+  803616:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  80361d:	48 b8 cd 11 80 00 00 	movabs $0x8011cd,%rax
+  803624:	00 00 00 
+  803627:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  803629:	41 01 dc             	add    %ebx,%r12d
+  80362c:	49 63 f4             	movslq %r12d,%rsi
+  80362f:	4c 39 f6             	cmp    %r14,%rsi
+  803632:	72 b3                	jb     8035e7 <devcons_write+0x38>
+    return res;
+  803634:	49 63 c4             	movslq %r12d,%rax
+}
+  803637:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  80363e:	5b                   	pop    %rbx
+  80363f:	41 5c                	pop    %r12
+  803641:	41 5d                	pop    %r13
+  803643:	41 5e                	pop    %r14
+  803645:	41 5f                	pop    %r15
+  803647:	5d                   	pop    %rbp
+  803648:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  803649:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80364f:	eb e3                	jmp    803634 <devcons_write+0x85>
+
+0000000000803651 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  803651:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  803654:	ba 00 00 00 00       	mov    $0x0,%edx
+  803659:	48 85 c0             	test   %rax,%rax
+  80365c:	74 55                	je     8036b3 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  80365e:	55                   	push   %rbp
+  80365f:	48 89 e5             	mov    %rsp,%rbp
+  803662:	41 55                	push   %r13
+  803664:	41 54                	push   %r12
+  803666:	53                   	push   %rbx
+  803667:	48 83 ec 08          	sub    $0x8,%rsp
+  80366b:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  80366e:	48 bb fa 11 80 00 00 	movabs $0x8011fa,%rbx
+  803675:	00 00 00 
+  803678:	49 bc c7 12 80 00 00 	movabs $0x8012c7,%r12
+  80367f:	00 00 00 
+  803682:	eb 03                	jmp    803687 <devcons_read+0x36>
+  803684:	41 ff d4             	call   *%r12
+  803687:	ff d3                	call   *%rbx
+  803689:	85 c0                	test   %eax,%eax
+  80368b:	74 f7                	je     803684 <devcons_read+0x33>
+    if (c < 0) return c;
+  80368d:	48 63 d0             	movslq %eax,%rdx
+  803690:	78 13                	js     8036a5 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  803692:	ba 00 00 00 00       	mov    $0x0,%edx
+  803697:	83 f8 04             	cmp    $0x4,%eax
+  80369a:	74 09                	je     8036a5 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  80369c:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  8036a0:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  8036a5:	48 89 d0             	mov    %rdx,%rax
+  8036a8:	48 83 c4 08          	add    $0x8,%rsp
+  8036ac:	5b                   	pop    %rbx
+  8036ad:	41 5c                	pop    %r12
+  8036af:	41 5d                	pop    %r13
+  8036b1:	5d                   	pop    %rbp
+  8036b2:	c3                   	ret
+  8036b3:	48 89 d0             	mov    %rdx,%rax
+  8036b6:	c3                   	ret
+
+00000000008036b7 <cputchar>:
+cputchar(int ch) {
+  8036b7:	55                   	push   %rbp
+  8036b8:	48 89 e5             	mov    %rsp,%rbp
+  8036bb:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  8036bf:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  8036c3:	be 01 00 00 00       	mov    $0x1,%esi
+  8036c8:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  8036cc:	48 b8 cd 11 80 00 00 	movabs $0x8011cd,%rax
+  8036d3:	00 00 00 
+  8036d6:	ff d0                	call   *%rax
+}
+  8036d8:	c9                   	leave
+  8036d9:	c3                   	ret
+
+00000000008036da <getchar>:
+getchar(void) {
+  8036da:	55                   	push   %rbp
+  8036db:	48 89 e5             	mov    %rsp,%rbp
+  8036de:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  8036e2:	ba 01 00 00 00       	mov    $0x1,%edx
+  8036e7:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  8036eb:	bf 00 00 00 00       	mov    $0x0,%edi
+  8036f0:	48 b8 35 1b 80 00 00 	movabs $0x801b35,%rax
+  8036f7:	00 00 00 
+  8036fa:	ff d0                	call   *%rax
+  8036fc:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  8036fe:	85 c0                	test   %eax,%eax
+  803700:	78 06                	js     803708 <getchar+0x2e>
+  803702:	74 08                	je     80370c <getchar+0x32>
+  803704:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  803708:	89 d0                	mov    %edx,%eax
+  80370a:	c9                   	leave
+  80370b:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  80370c:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  803711:	eb f5                	jmp    803708 <getchar+0x2e>
+
+0000000000803713 <iscons>:
+iscons(int fdnum) {
+  803713:	55                   	push   %rbp
+  803714:	48 89 e5             	mov    %rsp,%rbp
+  803717:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  80371b:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80371f:	48 b8 52 18 80 00 00 	movabs $0x801852,%rax
+  803726:	00 00 00 
+  803729:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80372b:	85 c0                	test   %eax,%eax
+  80372d:	78 18                	js     803747 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  80372f:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803733:	48 b8 a0 50 80 00 00 	movabs $0x8050a0,%rax
+  80373a:	00 00 00 
+  80373d:	8b 00                	mov    (%rax),%eax
+  80373f:	39 02                	cmp    %eax,(%rdx)
+  803741:	0f 94 c0             	sete   %al
+  803744:	0f b6 c0             	movzbl %al,%eax
+}
+  803747:	c9                   	leave
+  803748:	c3                   	ret
+
+0000000000803749 <opencons>:
+opencons(void) {
+  803749:	55                   	push   %rbp
+  80374a:	48 89 e5             	mov    %rsp,%rbp
+  80374d:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  803751:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  803755:	48 b8 38 18 80 00 00 	movabs $0x801838,%rax
+  80375c:	00 00 00 
+  80375f:	ff d0                	call   *%rax
+  803761:	85 c0                	test   %eax,%eax
+  803763:	78 49                	js     8037ae <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  803765:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80376a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80376f:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  803773:	bf 00 00 00 00       	mov    $0x0,%edi
+  803778:	48 b8 56 13 80 00 00 	movabs $0x801356,%rax
+  80377f:	00 00 00 
+  803782:	ff d0                	call   *%rax
+  803784:	85 c0                	test   %eax,%eax
+  803786:	78 26                	js     8037ae <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  803788:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80378c:	a1 a0 50 80 00 00 00 	movabs 0x8050a0,%eax
+  803793:	00 00 
+  803795:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  803797:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80379b:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  8037a2:	48 b8 91 17 80 00 00 	movabs $0x801791,%rax
+  8037a9:	00 00 00 
+  8037ac:	ff d0                	call   *%rax
+}
+  8037ae:	c9                   	leave
+  8037af:	c3                   	ret
+
+00000000008037b0 <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  8037b0:	55                   	push   %rbp
+  8037b1:	48 89 e5             	mov    %rsp,%rbp
+  8037b4:	41 55                	push   %r13
+  8037b6:	41 54                	push   %r12
+  8037b8:	53                   	push   %rbx
+  8037b9:	48 83 ec 08          	sub    $0x8,%rsp
+  8037bd:	49 89 fc             	mov    %rdi,%r12
+  8037c0:	48 89 f7             	mov    %rsi,%rdi
+  8037c3:	48 89 d3             	mov    %rdx,%rbx
+  8037c6:	49 89 cd             	mov    %rcx,%r13
+    // LAB 9: Your code here:
+    int res = sys_ipc_recv(!pg ? (void*)MAX_USER_ADDRESS : pg, !size ? 0 : *size);
+  8037c9:	be 00 00 00 00       	mov    $0x0,%esi
+  8037ce:	48 85 d2             	test   %rdx,%rdx
+  8037d1:	74 03                	je     8037d6 <ipc_recv+0x26>
+  8037d3:	48 8b 32             	mov    (%rdx),%rsi
+  8037d6:	48 85 ff             	test   %rdi,%rdi
+  8037d9:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8037e0:	00 00 00 
+  8037e3:	48 0f 44 f8          	cmove  %rax,%rdi
+  8037e7:	48 b8 28 17 80 00 00 	movabs $0x801728,%rax
+  8037ee:	00 00 00 
+  8037f1:	ff d0                	call   *%rax
+    if (res < 0) {
+  8037f3:	85 c0                	test   %eax,%eax
+  8037f5:	78 66                	js     80385d <ipc_recv+0xad>
+        if (size) {
+            *size = 0;
+        }
+        return res;
+    }
+    if (from_env_store) {
+  8037f7:	4d 85 e4             	test   %r12,%r12
+  8037fa:	74 14                	je     803810 <ipc_recv+0x60>
+        *from_env_store = thisenv->env_ipc_from;
+  8037fc:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  803803:	00 00 00 
+  803806:	8b 80 ac 01 00 00    	mov    0x1ac(%rax),%eax
+  80380c:	41 89 04 24          	mov    %eax,(%r12)
+    }
+    if (perm_store) {
+  803810:	4d 85 ed             	test   %r13,%r13
+  803813:	74 14                	je     803829 <ipc_recv+0x79>
+        *perm_store = thisenv->env_ipc_perm;
+  803815:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  80381c:	00 00 00 
+  80381f:	8b 80 b0 01 00 00    	mov    0x1b0(%rax),%eax
+  803825:	41 89 45 00          	mov    %eax,0x0(%r13)
+    }
+    if (size) {
+  803829:	48 85 db             	test   %rbx,%rbx
+  80382c:	74 14                	je     803842 <ipc_recv+0x92>
+        *size = thisenv->env_ipc_maxsz;
+  80382e:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  803835:	00 00 00 
+  803838:	48 8b 80 a0 01 00 00 	mov    0x1a0(%rax),%rax
+  80383f:	48 89 03             	mov    %rax,(%rbx)
+    }
+    return thisenv->env_ipc_value;
+  803842:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  803849:	00 00 00 
+  80384c:	8b 80 a8 01 00 00    	mov    0x1a8(%rax),%eax
+}
+  803852:	48 83 c4 08          	add    $0x8,%rsp
+  803856:	5b                   	pop    %rbx
+  803857:	41 5c                	pop    %r12
+  803859:	41 5d                	pop    %r13
+  80385b:	5d                   	pop    %rbp
+  80385c:	c3                   	ret
+        if (from_env_store) {
+  80385d:	4d 85 e4             	test   %r12,%r12
+  803860:	74 08                	je     80386a <ipc_recv+0xba>
+            *from_env_store = 0;
+  803862:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  803869:	00 
+        if (perm_store) {
+  80386a:	4d 85 ed             	test   %r13,%r13
+  80386d:	74 08                	je     803877 <ipc_recv+0xc7>
+            *perm_store = 0;
+  80386f:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  803876:	00 
+        if (size) {
+  803877:	48 85 db             	test   %rbx,%rbx
+  80387a:	74 d6                	je     803852 <ipc_recv+0xa2>
+            *size = 0;
+  80387c:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  803883:	eb cd                	jmp    803852 <ipc_recv+0xa2>
+
+0000000000803885 <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  803885:	55                   	push   %rbp
+  803886:	48 89 e5             	mov    %rsp,%rbp
+  803889:	41 57                	push   %r15
+  80388b:	41 56                	push   %r14
+  80388d:	41 55                	push   %r13
+  80388f:	41 54                	push   %r12
+  803891:	53                   	push   %rbx
+  803892:	48 83 ec 18          	sub    $0x18,%rsp
+  803896:	41 89 fd             	mov    %edi,%r13d
+  803899:	89 75 cc             	mov    %esi,-0x34(%rbp)
+  80389c:	49 89 cc             	mov    %rcx,%r12
+  80389f:	44 89 45 c8          	mov    %r8d,-0x38(%rbp)
+    // LAB 9: Your code here:
+    int res = 0;
+    while ((res = sys_ipc_try_send(to_env, val, !pg ? (void*)MAX_USER_ADDRESS : pg, size, perm)) < 0) {
+  8038a3:	48 85 d2             	test   %rdx,%rdx
+  8038a6:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8038ad:	00 00 00 
+  8038b0:	48 0f 45 c2          	cmovne %rdx,%rax
+  8038b4:	48 89 c3             	mov    %rax,%rbx
+  8038b7:	49 be fc 16 80 00 00 	movabs $0x8016fc,%r14
+  8038be:	00 00 00 
+        if (res != -E_IPC_NOT_RECV) {
+            panic("sys_ipc_try_send failed: %i", res);
+        }
+        sys_yield();
+  8038c1:	49 bf c7 12 80 00 00 	movabs $0x8012c7,%r15
+  8038c8:	00 00 00 
+    while ((res = sys_ipc_try_send(to_env, val, !pg ? (void*)MAX_USER_ADDRESS : pg, size, perm)) < 0) {
+  8038cb:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  8038ce:	44 8b 45 c8          	mov    -0x38(%rbp),%r8d
+  8038d2:	4c 89 e1             	mov    %r12,%rcx
+  8038d5:	48 89 da             	mov    %rbx,%rdx
+  8038d8:	44 89 ef             	mov    %r13d,%edi
+  8038db:	41 ff d6             	call   *%r14
+  8038de:	85 c0                	test   %eax,%eax
+  8038e0:	79 37                	jns    803919 <ipc_send+0x94>
+        if (res != -E_IPC_NOT_RECV) {
+  8038e2:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  8038e5:	75 05                	jne    8038ec <ipc_send+0x67>
+        sys_yield();
+  8038e7:	41 ff d7             	call   *%r15
+  8038ea:	eb df                	jmp    8038cb <ipc_send+0x46>
+            panic("sys_ipc_try_send failed: %i", res);
+  8038ec:	89 c1                	mov    %eax,%ecx
+  8038ee:	48 ba e6 41 80 00 00 	movabs $0x8041e6,%rdx
+  8038f5:	00 00 00 
+  8038f8:	be 40 00 00 00       	mov    $0x40,%esi
+  8038fd:	48 bf 02 42 80 00 00 	movabs $0x804202,%rdi
+  803904:	00 00 00 
+  803907:	b8 00 00 00 00       	mov    $0x0,%eax
+  80390c:	49 b8 31 03 80 00 00 	movabs $0x800331,%r8
+  803913:	00 00 00 
+  803916:	41 ff d0             	call   *%r8
+    }
+    return;
+}
+  803919:	48 83 c4 18          	add    $0x18,%rsp
+  80391d:	5b                   	pop    %rbx
+  80391e:	41 5c                	pop    %r12
+  803920:	41 5d                	pop    %r13
+  803922:	41 5e                	pop    %r14
+  803924:	41 5f                	pop    %r15
+  803926:	5d                   	pop    %rbp
+  803927:	c3                   	ret
+
+0000000000803928 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  803928:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  80392d:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  803934:	00 00 00 
+  803937:	48 69 d0 d0 01 00 00 	imul   $0x1d0,%rax,%rdx
+  80393e:	48 01 ca             	add    %rcx,%rdx
+  803941:	8b 92 e8 00 00 00    	mov    0xe8(%rdx),%edx
+  803947:	39 fa                	cmp    %edi,%edx
+  803949:	74 12                	je     80395d <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  80394b:	48 83 c0 01          	add    $0x1,%rax
+  80394f:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  803955:	75 e0                	jne    803937 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  803957:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80395c:	c3                   	ret
+            return envs[i].env_id;
+  80395d:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+  803964:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  80396b:	00 00 00 
+  80396e:	48 01 d0             	add    %rdx,%rax
+  803971:	8b 80 e0 00 00 00    	mov    0xe0(%rax),%eax
+  803977:	c3                   	ret
+
+0000000000803978 <__rodata_start>:
+  803978:	70 69                	jo     8039e3 <__rodata_start+0x6b>
+  80397a:	70 65                	jo     8039e1 <__rodata_start+0x69>
+  80397c:	3a 20                	cmp    (%rax),%ah
+  80397e:	25 69 00 75 73       	and    $0x73750069,%eax
+  803983:	65 72 2f             	gs jb  8039b5 <__rodata_start+0x3d>
+  803986:	72 65                	jb     8039ed <__rodata_start+0x75>
+  803988:	67 69 6f 6e 62 61 74 	imul   $0x63746162,0x6e(%edi),%ebp
+  80398f:	63 
+  803990:	68 2e 63 00 68       	push   $0x6800632e
+  803995:	65 6c                	gs insb (%dx),%es:(%rdi)
+  803997:	6c                   	insb   (%dx),%es:(%rdi)
+  803998:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803999:	00 73 70             	add    %dh,0x70(%rbx)
+  80399c:	61                   	(bad)
+  80399d:	77 6e                	ja     803a0d <__rodata_start+0x95>
+  80399f:	3a 20                	cmp    (%rax),%ah
+  8039a1:	25 69 00 73 79       	and    $0x79730069,%eax
+  8039a6:	73 5f                	jae    803a07 <__rodata_start+0x8f>
+  8039a8:	72 65                	jb     803a0f <__rodata_start+0x97>
+  8039aa:	67 69 6f 6e 5f 62 61 	imul   $0x7461625f,0x6e(%edi),%ebp
+  8039b1:	74 
+  8039b2:	63 68 3a             	movsxd 0x3a(%rax),%ebp
+  8039b5:	20 25 69 00 0f 1f    	and    %ah,0x1f0f0069(%rip)        # 1f8f3a24 <__bss_end+0x1f0eaa24>
+  8039bb:	80 00 00             	addb   $0x0,(%rax)
+  8039be:	00 00                	add    %al,(%rax)
+  8039c0:	73 79                	jae    803a3b <__rodata_start+0xc3>
+  8039c2:	73 5f                	jae    803a23 <__rodata_start+0xab>
+  8039c4:	72 65                	jb     803a2b <__rodata_start+0xb3>
+  8039c6:	67 69 6f 6e 5f 62 61 	imul   $0x7461625f,0x6e(%edi),%ebp
+  8039cd:	74 
+  8039ce:	63 68 20             	movsxd 0x20(%rax),%ebp
+  8039d1:	77 69                	ja     803a3c <__rodata_start+0xc4>
+  8039d3:	74 68                	je     803a3d <__rodata_start+0xc5>
+  8039d5:	20 62 61             	and    %ah,0x61(%rdx)
+  8039d8:	64 20 6f 70          	and    %ch,%fs:0x70(%rdi)
+  8039dc:	65 72 61             	gs jb  803a40 <__rodata_start+0xc8>
+  8039df:	74 69                	je     803a4a <__rodata_start+0xd2>
+  8039e1:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8039e2:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8039e3:	3a 20                	cmp    (%rax),%ah
+  8039e5:	25 69 00 72 65       	and    $0x65720069,%eax
+  8039ea:	67 69 6f 6e 62 61 74 	imul   $0x63746162,0x6e(%edi),%ebp
+  8039f1:	63 
+  8039f2:	68 3a 20 70 69       	push   $0x6970203a
+  8039f7:	70 65                	jo     803a5e <__rodata_start+0xe6>
+  8039f9:	20 25 75 20 73 79    	and    %ah,0x79732075(%rip)        # 79f35a74 <__bss_end+0x7972ca74>
+  8039ff:	73 74                	jae    803a75 <__rodata_start+0xfd>
+  803a01:	65 6d                	gs insl (%dx),%es:(%rdi)
+  803a03:	20 63 61             	and    %ah,0x61(%rbx)
+  803a06:	6c                   	insb   (%dx),%es:(%rdi)
+  803a07:	6c                   	insb   (%dx),%es:(%rdi)
+  803a08:	73 2c                	jae    803a36 <__rodata_start+0xbe>
+  803a0a:	20 73 70             	and    %dh,0x70(%rbx)
+  803a0d:	61                   	(bad)
+  803a0e:	77 6e                	ja     803a7e <__rodata_start+0x106>
+  803a10:	20 25 75 20 73 79    	and    %ah,0x79732075(%rip)        # 79f35a8b <__bss_end+0x7972ca8b>
+  803a16:	73 74                	jae    803a8c <__rodata_start+0x114>
+  803a18:	65 6d                	gs insl (%dx),%es:(%rdi)
+  803a1a:	20 63 61             	and    %ah,0x61(%rbx)
+  803a1d:	6c                   	insb   (%dx),%es:(%rdi)
+  803a1e:	6c                   	insb   (%dx),%es:(%rdi)
+  803a1f:	73 20                	jae    803a41 <__rodata_start+0xc9>
+  803a21:	28 69 6e             	sub    %ch,0x6e(%rcx)
+  803a24:	63 6c 75 64          	movsxd 0x64(%rbp,%rsi,2),%ebp
+  803a28:	69 6e 67 20 66 69 6c 	imul   $0x6c696620,0x67(%rsi),%ebp
+  803a2f:	65 20 73 79          	and    %dh,%gs:0x79(%rbx)
+  803a33:	73 74                	jae    803aa9 <__rodata_start+0x131>
+  803a35:	65 6d                	gs insl (%dx),%es:(%rdi)
+  803a37:	20 49 50             	and    %cl,0x50(%rcx)
+  803a3a:	43 29 0a             	rex.XB sub %ecx,(%r10)
+  803a3d:	00 3c 75 6e 6b 6e 6f 	add    %bh,0x6f6e6b6e(,%rsi,2)
+  803a44:	77 6e                	ja     803ab4 <__rodata_start+0x13c>
+  803a46:	3e 00 5b 25          	ds add %bl,0x25(%rbx)
+  803a4a:	30 38                	xor    %bh,(%rax)
+  803a4c:	78 5d                	js     803aab <__rodata_start+0x133>
+  803a4e:	20 75 73             	and    %dh,0x73(%rbp)
+  803a51:	65 72 20             	gs jb  803a74 <__rodata_start+0xfc>
+  803a54:	70 61                	jo     803ab7 <__rodata_start+0x13f>
+  803a56:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803a57:	69 63 20 69 6e 20 25 	imul   $0x25206e69,0x20(%rbx),%esp
+  803a5e:	73 20                	jae    803a80 <__rodata_start+0x108>
+  803a60:	61                   	(bad)
+  803a61:	74 20                	je     803a83 <__rodata_start+0x10b>
+  803a63:	25 73 3a 25 64       	and    $0x64253a73,%eax
+  803a68:	3a 20                	cmp    (%rax),%ah
+  803a6a:	00 30                	add    %dh,(%rax)
+  803a6c:	31 32                	xor    %esi,(%rdx)
+  803a6e:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  803a75:	41                   	rex.B
+  803a76:	42                   	rex.X
+  803a77:	43                   	rex.XB
+  803a78:	44                   	rex.R
+  803a79:	45                   	rex.RB
+  803a7a:	46 00 30             	rex.RX add %r14b,(%rax)
+  803a7d:	31 32                	xor    %esi,(%rdx)
+  803a7f:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  803a86:	61                   	(bad)
+  803a87:	62 63 64 65 66       	(bad)
+  803a8c:	00 28                	add    %ch,(%rax)
+  803a8e:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803a8f:	75 6c                	jne    803afd <__rodata_start+0x185>
+  803a91:	6c                   	insb   (%dx),%es:(%rdi)
+  803a92:	29 00                	sub    %eax,(%rax)
+  803a94:	65 72 72             	gs jb  803b09 <__rodata_start+0x191>
+  803a97:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803a98:	72 20                	jb     803aba <__rodata_start+0x142>
+  803a9a:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  803a9f:	73 70                	jae    803b11 <__rodata_start+0x199>
+  803aa1:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  803aa5:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  803aac:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803aad:	72 00                	jb     803aaf <__rodata_start+0x137>
+  803aaf:	62 61 64 20 65       	(bad)
+  803ab4:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803ab5:	76 69                	jbe    803b20 <__rodata_start+0x1a8>
+  803ab7:	72 6f                	jb     803b28 <__rodata_start+0x1b0>
+  803ab9:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803aba:	6d                   	insl   (%dx),%es:(%rdi)
+  803abb:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803abd:	74 00                	je     803abf <__rodata_start+0x147>
+  803abf:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  803ac6:	20 70 61             	and    %dh,0x61(%rax)
+  803ac9:	72 61                	jb     803b2c <__rodata_start+0x1b4>
+  803acb:	6d                   	insl   (%dx),%es:(%rdi)
+  803acc:	65 74 65             	gs je  803b34 <__rodata_start+0x1bc>
+  803acf:	72 00                	jb     803ad1 <__rodata_start+0x159>
+  803ad1:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803ad2:	75 74                	jne    803b48 <__rodata_start+0x1d0>
+  803ad4:	20 6f 66             	and    %ch,0x66(%rdi)
+  803ad7:	20 6d 65             	and    %ch,0x65(%rbp)
+  803ada:	6d                   	insl   (%dx),%es:(%rdi)
+  803adb:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803adc:	72 79                	jb     803b57 <__rodata_start+0x1df>
+  803ade:	00 6f 75             	add    %ch,0x75(%rdi)
+  803ae1:	74 20                	je     803b03 <__rodata_start+0x18b>
+  803ae3:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803ae4:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  803ae8:	76 69                	jbe    803b53 <__rodata_start+0x1db>
+  803aea:	72 6f                	jb     803b5b <__rodata_start+0x1e3>
+  803aec:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803aed:	6d                   	insl   (%dx),%es:(%rdi)
+  803aee:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803af0:	74 73                	je     803b65 <__rodata_start+0x1ed>
+  803af2:	00 63 6f             	add    %ah,0x6f(%rbx)
+  803af5:	72 72                	jb     803b69 <__rodata_start+0x1f1>
+  803af7:	75 70                	jne    803b69 <__rodata_start+0x1f1>
+  803af9:	74 65                	je     803b60 <__rodata_start+0x1e8>
+  803afb:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  803b00:	75 67                	jne    803b69 <__rodata_start+0x1f1>
+  803b02:	20 69 6e             	and    %ch,0x6e(%rcx)
+  803b05:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  803b07:	00 73 65             	add    %dh,0x65(%rbx)
+  803b0a:	67 6d                	insl   (%dx),%es:(%edi)
+  803b0c:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803b0e:	74 61                	je     803b71 <__rodata_start+0x1f9>
+  803b10:	74 69                	je     803b7b <__rodata_start+0x203>
+  803b12:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803b13:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803b14:	20 66 61             	and    %ah,0x61(%rsi)
+  803b17:	75 6c                	jne    803b85 <__rodata_start+0x20d>
+  803b19:	74 00                	je     803b1b <__rodata_start+0x1a3>
+  803b1b:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  803b22:	20 45 4c             	and    %al,0x4c(%rbp)
+  803b25:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  803b29:	61                   	(bad)
+  803b2a:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  803b2f:	20 73 75             	and    %dh,0x75(%rbx)
+  803b32:	63 68 20             	movsxd 0x20(%rax),%ebp
+  803b35:	73 79                	jae    803bb0 <__rodata_start+0x238>
+  803b37:	73 74                	jae    803bad <__rodata_start+0x235>
+  803b39:	65 6d                	gs insl (%dx),%es:(%rdi)
+  803b3b:	20 63 61             	and    %ah,0x61(%rbx)
+  803b3e:	6c                   	insb   (%dx),%es:(%rdi)
+  803b3f:	6c                   	insb   (%dx),%es:(%rdi)
+  803b40:	00 65 6e             	add    %ah,0x6e(%rbp)
+  803b43:	74 72                	je     803bb7 <__rodata_start+0x23f>
+  803b45:	79 20                	jns    803b67 <__rodata_start+0x1ef>
+  803b47:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803b48:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803b49:	74 20                	je     803b6b <__rodata_start+0x1f3>
+  803b4b:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  803b4d:	75 6e                	jne    803bbd <__rodata_start+0x245>
+  803b4f:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  803b53:	76 20                	jbe    803b75 <__rodata_start+0x1fd>
+  803b55:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  803b5c:	72 65                	jb     803bc3 <__rodata_start+0x24b>
+  803b5e:	63 76 69             	movsxd 0x69(%rsi),%esi
+  803b61:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803b62:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  803b66:	65 78 70             	gs js  803bd9 <__rodata_start+0x261>
+  803b69:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  803b6e:	20 65 6e             	and    %ah,0x6e(%rbp)
+  803b71:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  803b75:	20 66 69             	and    %ah,0x69(%rsi)
+  803b78:	6c                   	insb   (%dx),%es:(%rdi)
+  803b79:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  803b7d:	20 66 72             	and    %ah,0x72(%rsi)
+  803b80:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  803b85:	61                   	(bad)
+  803b86:	63 65 20             	movsxd 0x20(%rbp),%esp
+  803b89:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803b8a:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803b8b:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  803b8f:	6b 00 74             	imul   $0x74,(%rax),%eax
+  803b92:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803b93:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803b94:	20 6d 61             	and    %ch,0x61(%rbp)
+  803b97:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803b98:	79 20                	jns    803bba <__rodata_start+0x242>
+  803b9a:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  803ba1:	72 65                	jb     803c08 <__rodata_start+0x290>
+  803ba3:	20 6f 70             	and    %ch,0x70(%rdi)
+  803ba6:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803ba8:	00 66 69             	add    %ah,0x69(%rsi)
+  803bab:	6c                   	insb   (%dx),%es:(%rdi)
+  803bac:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  803bb0:	20 62 6c             	and    %ah,0x6c(%rdx)
+  803bb3:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803bb4:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  803bb7:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803bb8:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803bb9:	74 20                	je     803bdb <__rodata_start+0x263>
+  803bbb:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  803bbd:	75 6e                	jne    803c2d <__rodata_start+0x2b5>
+  803bbf:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  803bc3:	76 61                	jbe    803c26 <__rodata_start+0x2ae>
+  803bc5:	6c                   	insb   (%dx),%es:(%rdi)
+  803bc6:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  803bcd:	00 
+  803bce:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  803bd5:	72 65                	jb     803c3c <__rodata_start+0x2c4>
+  803bd7:	61                   	(bad)
+  803bd8:	64 79 20             	fs jns 803bfb <__rodata_start+0x283>
+  803bdb:	65 78 69             	gs js  803c47 <__rodata_start+0x2cf>
+  803bde:	73 74                	jae    803c54 <__rodata_start+0x2dc>
+  803be0:	73 00                	jae    803be2 <__rodata_start+0x26a>
+  803be2:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803be3:	70 65                	jo     803c4a <__rodata_start+0x2d2>
+  803be5:	72 61                	jb     803c48 <__rodata_start+0x2d0>
+  803be7:	74 69                	je     803c52 <__rodata_start+0x2da>
+  803be9:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803bea:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803beb:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  803bee:	74 20                	je     803c10 <__rodata_start+0x298>
+  803bf0:	73 75                	jae    803c67 <__rodata_start+0x2ef>
+  803bf2:	70 70                	jo     803c64 <__rodata_start+0x2ec>
+  803bf4:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803bf5:	72 74                	jb     803c6b <__rodata_start+0x2f3>
+  803bf7:	65 64 00 6f 70       	gs add %ch,%fs:0x70(%rdi)
+  803bfc:	65 72 61             	gs jb  803c60 <__rodata_start+0x2e8>
+  803bff:	74 69                	je     803c6a <__rodata_start+0x2f2>
+  803c01:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803c02:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803c03:	20 69 6e             	and    %ch,0x6e(%rcx)
+  803c06:	74 65                	je     803c6d <__rodata_start+0x2f5>
+  803c08:	72 72                	jb     803c7c <__rodata_start+0x304>
+  803c0a:	75 70                	jne    803c7c <__rodata_start+0x304>
+  803c0c:	74 65                	je     803c73 <__rodata_start+0x2fb>
+  803c0e:	64 00 6e 6f          	add    %ch,%fs:0x6f(%rsi)
+  803c12:	74 20                	je     803c34 <__rodata_start+0x2bc>
+  803c14:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803c16:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803c17:	75 67                	jne    803c80 <__rodata_start+0x308>
+  803c19:	68 20 43 50 55       	push   $0x55504320
+  803c1e:	20 74 69 6d          	and    %dh,0x6d(%rcx,%rbp,2)
+  803c22:	65 00 66 2e          	add    %ah,%gs:0x2e(%rsi)
+  803c26:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+  803c2d:	00 
+  803c2e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  803c35:	00 00 00 
+  803c38:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+  803c3f:	00 
+  803c40:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803c41:	06                   	(bad)
+  803c42:	80 00 00             	addb   $0x0,(%rax)
+  803c45:	00 00                	add    %al,(%rax)
+  803c47:	00 af 0c 80 00 00    	add    %ch,0x800c(%rdi)
+  803c4d:	00 00                	add    %al,(%rax)
+  803c4f:	00 9f 0c 80 00 00    	add    %bl,0x800c(%rdi)
+  803c55:	00 00                	add    %al,(%rax)
+  803c57:	00 af 0c 80 00 00    	add    %ch,0x800c(%rdi)
+  803c5d:	00 00                	add    %al,(%rax)
+  803c5f:	00 af 0c 80 00 00    	add    %ch,0x800c(%rdi)
+  803c65:	00 00                	add    %al,(%rax)
+  803c67:	00 af 0c 80 00 00    	add    %ch,0x800c(%rdi)
+  803c6d:	00 00                	add    %al,(%rax)
+  803c6f:	00 af 0c 80 00 00    	add    %ch,0x800c(%rdi)
+  803c75:	00 00                	add    %al,(%rax)
+  803c77:	00 8d 06 80 00 00    	add    %cl,0x8006(%rbp)
+  803c7d:	00 00                	add    %al,(%rax)
+  803c7f:	00 af 0c 80 00 00    	add    %ch,0x800c(%rdi)
+  803c85:	00 00                	add    %al,(%rax)
+  803c87:	00 af 0c 80 00 00    	add    %ch,0x800c(%rdi)
+  803c8d:	00 00                	add    %al,(%rax)
+  803c8f:	00 81 06 80 00 00    	add    %al,0x8006(%rcx)
+  803c95:	00 00                	add    %al,(%rax)
+  803c97:	00 fb                	add    %bh,%bl
+  803c99:	06                   	(bad)
+  803c9a:	80 00 00             	addb   $0x0,(%rax)
+  803c9d:	00 00                	add    %al,(%rax)
+  803c9f:	00 af 0c 80 00 00    	add    %ch,0x800c(%rdi)
+  803ca5:	00 00                	add    %al,(%rax)
+  803ca7:	00 81 06 80 00 00    	add    %al,0x8006(%rcx)
+  803cad:	00 00                	add    %al,(%rax)
+  803caf:	00 c7                	add    %al,%bh
+  803cb1:	06                   	(bad)
+  803cb2:	80 00 00             	addb   $0x0,(%rax)
+  803cb5:	00 00                	add    %al,(%rax)
+  803cb7:	00 c7                	add    %al,%bh
+  803cb9:	06                   	(bad)
+  803cba:	80 00 00             	addb   $0x0,(%rax)
+  803cbd:	00 00                	add    %al,(%rax)
+  803cbf:	00 c7                	add    %al,%bh
+  803cc1:	06                   	(bad)
+  803cc2:	80 00 00             	addb   $0x0,(%rax)
+  803cc5:	00 00                	add    %al,(%rax)
+  803cc7:	00 c7                	add    %al,%bh
+  803cc9:	06                   	(bad)
+  803cca:	80 00 00             	addb   $0x0,(%rax)
+  803ccd:	00 00                	add    %al,(%rax)
+  803ccf:	00 c7                	add    %al,%bh
+  803cd1:	06                   	(bad)
+  803cd2:	80 00 00             	addb   $0x0,(%rax)
+  803cd5:	00 00                	add    %al,(%rax)
+  803cd7:	00 c7                	add    %al,%bh
+  803cd9:	06                   	(bad)
+  803cda:	80 00 00             	addb   $0x0,(%rax)
+  803cdd:	00 00                	add    %al,(%rax)
+  803cdf:	00 c7                	add    %al,%bh
+  803ce1:	06                   	(bad)
+  803ce2:	80 00 00             	addb   $0x0,(%rax)
+  803ce5:	00 00                	add    %al,(%rax)
+  803ce7:	00 c7                	add    %al,%bh
+  803ce9:	06                   	(bad)
+  803cea:	80 00 00             	addb   $0x0,(%rax)
+  803ced:	00 00                	add    %al,(%rax)
+  803cef:	00 c7                	add    %al,%bh
+  803cf1:	06                   	(bad)
+  803cf2:	80 00 00             	addb   $0x0,(%rax)
+  803cf5:	00 00                	add    %al,(%rax)
+  803cf7:	00 af 0c 80 00 00    	add    %ch,0x800c(%rdi)
+  803cfd:	00 00                	add    %al,(%rax)
+  803cff:	00 af 0c 80 00 00    	add    %ch,0x800c(%rdi)
+  803d05:	00 00                	add    %al,(%rax)
+  803d07:	00 af 0c 80 00 00    	add    %ch,0x800c(%rdi)
+  803d0d:	00 00                	add    %al,(%rax)
+  803d0f:	00 af 0c 80 00 00    	add    %ch,0x800c(%rdi)
+  803d15:	00 00                	add    %al,(%rax)
+  803d17:	00 af 0c 80 00 00    	add    %ch,0x800c(%rdi)
+  803d1d:	00 00                	add    %al,(%rax)
+  803d1f:	00 af 0c 80 00 00    	add    %ch,0x800c(%rdi)
+  803d25:	00 00                	add    %al,(%rax)
+  803d27:	00 af 0c 80 00 00    	add    %ch,0x800c(%rdi)
+  803d2d:	00 00                	add    %al,(%rax)
+  803d2f:	00 af 0c 80 00 00    	add    %ch,0x800c(%rdi)
+  803d35:	00 00                	add    %al,(%rax)
+  803d37:	00 af 0c 80 00 00    	add    %ch,0x800c(%rdi)
+  803d3d:	00 00                	add    %al,(%rax)
+  803d3f:	00 af 0c 80 00 00    	add    %ch,0x800c(%rdi)
+  803d45:	00 00                	add    %al,(%rax)
+  803d47:	00 af 0c 80 00 00    	add    %ch,0x800c(%rdi)
+  803d4d:	00 00                	add    %al,(%rax)
+  803d4f:	00 af 0c 80 00 00    	add    %ch,0x800c(%rdi)
+  803d55:	00 00                	add    %al,(%rax)
+  803d57:	00 af 0c 80 00 00    	add    %ch,0x800c(%rdi)
+  803d5d:	00 00                	add    %al,(%rax)
+  803d5f:	00 af 0c 80 00 00    	add    %ch,0x800c(%rdi)
+  803d65:	00 00                	add    %al,(%rax)
+  803d67:	00 af 0c 80 00 00    	add    %ch,0x800c(%rdi)
+  803d6d:	00 00                	add    %al,(%rax)
+  803d6f:	00 af 0c 80 00 00    	add    %ch,0x800c(%rdi)
+  803d75:	00 00                	add    %al,(%rax)
+  803d77:	00 af 0c 80 00 00    	add    %ch,0x800c(%rdi)
+  803d7d:	00 00                	add    %al,(%rax)
+  803d7f:	00 af 0c 80 00 00    	add    %ch,0x800c(%rdi)
+  803d85:	00 00                	add    %al,(%rax)
+  803d87:	00 af 0c 80 00 00    	add    %ch,0x800c(%rdi)
+  803d8d:	00 00                	add    %al,(%rax)
+  803d8f:	00 af 0c 80 00 00    	add    %ch,0x800c(%rdi)
+  803d95:	00 00                	add    %al,(%rax)
+  803d97:	00 af 0c 80 00 00    	add    %ch,0x800c(%rdi)
+  803d9d:	00 00                	add    %al,(%rax)
+  803d9f:	00 af 0c 80 00 00    	add    %ch,0x800c(%rdi)
+  803da5:	00 00                	add    %al,(%rax)
+  803da7:	00 af 0c 80 00 00    	add    %ch,0x800c(%rdi)
+  803dad:	00 00                	add    %al,(%rax)
+  803daf:	00 af 0c 80 00 00    	add    %ch,0x800c(%rdi)
+  803db5:	00 00                	add    %al,(%rax)
+  803db7:	00 af 0c 80 00 00    	add    %ch,0x800c(%rdi)
+  803dbd:	00 00                	add    %al,(%rax)
+  803dbf:	00 af 0c 80 00 00    	add    %ch,0x800c(%rdi)
+  803dc5:	00 00                	add    %al,(%rax)
+  803dc7:	00 af 0c 80 00 00    	add    %ch,0x800c(%rdi)
+  803dcd:	00 00                	add    %al,(%rax)
+  803dcf:	00 af 0c 80 00 00    	add    %ch,0x800c(%rdi)
+  803dd5:	00 00                	add    %al,(%rax)
+  803dd7:	00 af 0c 80 00 00    	add    %ch,0x800c(%rdi)
+  803ddd:	00 00                	add    %al,(%rax)
+  803ddf:	00 af 0c 80 00 00    	add    %ch,0x800c(%rdi)
+  803de5:	00 00                	add    %al,(%rax)
+  803de7:	00 d2                	add    %dl,%dl
+  803de9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803def:	00 af 0c 80 00 00    	add    %ch,0x800c(%rdi)
+  803df5:	00 00                	add    %al,(%rax)
+  803df7:	00 af 0c 80 00 00    	add    %ch,0x800c(%rdi)
+  803dfd:	00 00                	add    %al,(%rax)
+  803dff:	00 af 0c 80 00 00    	add    %ch,0x800c(%rdi)
+  803e05:	00 00                	add    %al,(%rax)
+  803e07:	00 af 0c 80 00 00    	add    %ch,0x800c(%rdi)
+  803e0d:	00 00                	add    %al,(%rax)
+  803e0f:	00 af 0c 80 00 00    	add    %ch,0x800c(%rdi)
+  803e15:	00 00                	add    %al,(%rax)
+  803e17:	00 af 0c 80 00 00    	add    %ch,0x800c(%rdi)
+  803e1d:	00 00                	add    %al,(%rax)
+  803e1f:	00 af 0c 80 00 00    	add    %ch,0x800c(%rdi)
+  803e25:	00 00                	add    %al,(%rax)
+  803e27:	00 af 0c 80 00 00    	add    %ch,0x800c(%rdi)
+  803e2d:	00 00                	add    %al,(%rax)
+  803e2f:	00 af 0c 80 00 00    	add    %ch,0x800c(%rdi)
+  803e35:	00 00                	add    %al,(%rax)
+  803e37:	00 af 0c 80 00 00    	add    %ch,0x800c(%rdi)
+  803e3d:	00 00                	add    %al,(%rax)
+  803e3f:	00 1e                	add    %bl,(%rsi)
+  803e41:	07                   	(bad)
+  803e42:	80 00 00             	addb   $0x0,(%rax)
+  803e45:	00 00                	add    %al,(%rax)
+  803e47:	00 ed                	add    %ch,%ch
+  803e49:	08 80 00 00 00 00    	or     %al,0x0(%rax)
+  803e4f:	00 af 0c 80 00 00    	add    %ch,0x800c(%rdi)
+  803e55:	00 00                	add    %al,(%rax)
+  803e57:	00 af 0c 80 00 00    	add    %ch,0x800c(%rdi)
+  803e5d:	00 00                	add    %al,(%rax)
+  803e5f:	00 af 0c 80 00 00    	add    %ch,0x800c(%rdi)
+  803e65:	00 00                	add    %al,(%rax)
+  803e67:	00 af 0c 80 00 00    	add    %ch,0x800c(%rdi)
+  803e6d:	00 00                	add    %al,(%rax)
+  803e6f:	00 4d 07             	add    %cl,0x7(%rbp)
+  803e72:	80 00 00             	addb   $0x0,(%rax)
+  803e75:	00 00                	add    %al,(%rax)
+  803e77:	00 af 0c 80 00 00    	add    %ch,0x800c(%rdi)
+  803e7d:	00 00                	add    %al,(%rax)
+  803e7f:	00 af 0c 80 00 00    	add    %ch,0x800c(%rdi)
+  803e85:	00 00                	add    %al,(%rax)
+  803e87:	00 13                	add    %dl,(%rbx)
+  803e89:	07                   	(bad)
+  803e8a:	80 00 00             	addb   $0x0,(%rax)
+  803e8d:	00 00                	add    %al,(%rax)
+  803e8f:	00 af 0c 80 00 00    	add    %ch,0x800c(%rdi)
+  803e95:	00 00                	add    %al,(%rax)
+  803e97:	00 af 0c 80 00 00    	add    %ch,0x800c(%rdi)
+  803e9d:	00 00                	add    %al,(%rax)
+  803e9f:	00 95 0a 80 00 00    	add    %dl,0x800a(%rbp)
+  803ea5:	00 00                	add    %al,(%rax)
+  803ea7:	00 5f 0b             	add    %bl,0xb(%rdi)
+  803eaa:	80 00 00             	addb   $0x0,(%rax)
+  803ead:	00 00                	add    %al,(%rax)
+  803eaf:	00 af 0c 80 00 00    	add    %ch,0x800c(%rdi)
+  803eb5:	00 00                	add    %al,(%rax)
+  803eb7:	00 af 0c 80 00 00    	add    %ch,0x800c(%rdi)
+  803ebd:	00 00                	add    %al,(%rax)
+  803ebf:	00 e4                	add    %ah,%ah
+  803ec1:	07                   	(bad)
+  803ec2:	80 00 00             	addb   $0x0,(%rax)
+  803ec5:	00 00                	add    %al,(%rax)
+  803ec7:	00 af 0c 80 00 00    	add    %ch,0x800c(%rdi)
+  803ecd:	00 00                	add    %al,(%rax)
+  803ecf:	00 c1                	add    %al,%cl
+  803ed1:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803ed7:	00 af 0c 80 00 00    	add    %ch,0x800c(%rdi)
+  803edd:	00 00                	add    %al,(%rax)
+  803edf:	00 af 0c 80 00 00    	add    %ch,0x800c(%rdi)
+  803ee5:	00 00                	add    %al,(%rax)
+  803ee7:	00 d2                	add    %dl,%dl
+  803ee9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803eef:	00 af 0c 80 00 00    	add    %ch,0x800c(%rdi)
+  803ef5:	00 00                	add    %al,(%rax)
+  803ef7:	00 77 06             	add    %dh,0x6(%rdi)
+  803efa:	80 00 00             	addb   $0x0,(%rax)
+  803efd:	00 00                	add    %al,(%rax)
+	...
+
+0000000000803f00 <error_string>:
+	...
+  803f08:	9d 3a 80 00 00 00 00 00 af 3a 80 00 00 00 00 00     .:.......:......
+  803f18:	bf 3a 80 00 00 00 00 00 d1 3a 80 00 00 00 00 00     .:.......:......
+  803f28:	df 3a 80 00 00 00 00 00 f3 3a 80 00 00 00 00 00     .:.......:......
+  803f38:	08 3b 80 00 00 00 00 00 1b 3b 80 00 00 00 00 00     .;.......;......
+  803f48:	2d 3b 80 00 00 00 00 00 41 3b 80 00 00 00 00 00     -;......A;......
+  803f58:	51 3b 80 00 00 00 00 00 64 3b 80 00 00 00 00 00     Q;......d;......
+  803f68:	7b 3b 80 00 00 00 00 00 91 3b 80 00 00 00 00 00     {;.......;......
+  803f78:	a9 3b 80 00 00 00 00 00 c1 3b 80 00 00 00 00 00     .;.......;......
+  803f88:	ce 3b 80 00 00 00 00 00 b0 3f 80 00 00 00 00 00     .;.......?......
+  803f98:	e2 3b 80 00 00 00 00 00 fa 3b 80 00 00 00 00 00     .;.......;......
+  803fa8:	10 3c 80 00 00 00 00 00 66 69 6c 65 20 69 73 20     .<......file is 
+  803fb8:	6e 6f 74 20 61 20 76 61 6c 69 64 20 65 78 65 63     not a valid exec
+  803fc8:	75 74 61 62 6c 65 00 90 73 79 73 63 61 6c 6c 20     utable..syscall 
+  803fd8:	25 7a 64 20 72 65 74 75 72 6e 65 64 20 25 7a 64     %zd returned %zd
+  803fe8:	20 28 3e 20 30 29 00 6c 69 62 2f 73 79 73 63 61      (> 0).lib/sysca
+  803ff8:	6c 6c 2e 63 00 0f 1f 00 5b 25 30 38 78 5d 20 75     ll.c....[%08x] u
+  804008:	6e 6b 6e 6f 77 6e 20 64 65 76 69 63 65 20 74 79     nknown device ty
+  804018:	70 65 20 25 64 0a 00 00 5b 25 30 38 78 5d 20 66     pe %d...[%08x] f
+  804028:	74 72 75 6e 63 61 74 65 20 25 64 20 2d 2d 20 62     truncate %d -- b
+  804038:	61 64 20 6d 6f 64 65 0a 00 5b 25 30 38 78 5d 20     ad mode..[%08x] 
+  804048:	72 65 61 64 20 25 64 20 2d 2d 20 62 61 64 20 6d     read %d -- bad m
+  804058:	6f 64 65 0a 00 5b 25 30 38 78 5d 20 77 72 69 74     ode..[%08x] writ
+  804068:	65 20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65     e %d -- bad mode
+  804078:	0a 00 66 0f 1f 44 00 00                             ..f..D..
+
+0000000000804080 <devtab>:
+  804080:	20 50 80 00 00 00 00 00 60 50 80 00 00 00 00 00      P......`P......
+  804090:	a0 50 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .P..............
+  8040a0:	57 72 6f 6e 67 20 45 4c 46 20 68 65 61 64 65 72     Wrong ELF header
+  8040b0:	20 73 69 7a 65 20 6f 72 20 72 65 61 64 20 65 72      size or read er
+  8040c0:	72 6f 72 3a 20 25 69 0a 00 00 00 00 00 00 00 00     ror: %i.........
+  8040d0:	73 74 72 69 6e 67 5f 73 74 6f 72 65 20 3d 3d 20     string_store == 
+  8040e0:	28 63 68 61 72 20 2a 29 55 54 45 4d 50 20 2b 20     (char *)UTEMP + 
+  8040f0:	55 53 45 52 5f 53 54 41 43 4b 5f 53 49 5a 45 00     USER_STACK_SIZE.
+  804100:	45 6c 66 20 6d 61 67 69 63 20 25 30 38 78 20 77     Elf magic %08x w
+  804110:	61 6e 74 20 25 30 38 78 0a 00 61 73 73 65 72 74     ant %08x..assert
+  804120:	69 6f 6e 20 66 61 69 6c 65 64 3a 20 25 73 00 6c     ion failed: %s.l
+  804130:	69 62 2f 73 70 61 77 6e 2e 63 00 63 6f 70 79 5f     ib/spawn.c.copy_
+  804140:	73 68 61 72 65 64 5f 72 65 67 69 6f 6e 3a 20 25     shared_region: %
+  804150:	69 00 73 79 73 5f 65 6e 76 5f 73 65 74 5f 74 72     i.sys_env_set_tr
+  804160:	61 70 66 72 61 6d 65 3a 20 25 69 00 73 79 73 5f     apframe: %i.sys_
+  804170:	65 6e 76 5f 73 65 74 5f 73 74 61 74 75 73 3a 20     env_set_status: 
+  804180:	25 69 00 3c 70 69 70 65 3e 00 6c 69 62 2f 70 69     %i.<pipe>.lib/pi
+  804190:	70 65 2e 63 00 70 69 70 65 00 66 0f 1f 44 00 00     pe.c.pipe.f..D..
+  8041a0:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  8041b0:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  8041c0:	3d 20 32 00 65 6e 76 69 64 20 21 3d 20 30 00 6c     = 2.envid != 0.l
+  8041d0:	69 62 2f 77 61 69 74 2e 63 00 3c 63 6f 6e 73 3e     ib/wait.c.<cons>
+  8041e0:	00 63 6f 6e 73 00 73 79 73 5f 69 70 63 5f 74 72     .cons.sys_ipc_tr
+  8041f0:	79 5f 73 65 6e 64 20 66 61 69 6c 65 64 3a 20 25     y_send failed: %
+  804200:	69 00 6c 69 62 2f 69 70 63 2e 63 00 66 2e 0f 1f     i.lib/ipc.c.f...
+  804210:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804220:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804230:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804240:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804250:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804260:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804270:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804280:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804290:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8042a0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8042b0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8042c0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8042d0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8042e0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8042f0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804300:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804310:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804320:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804330:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804340:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804350:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804360:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804370:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804380:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804390:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8043a0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8043b0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8043c0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8043d0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8043e0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8043f0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804400:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804410:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804420:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804430:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804440:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804450:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804460:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804470:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804480:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804490:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8044a0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8044b0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8044c0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8044d0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8044e0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8044f0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804500:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804510:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804520:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804530:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804540:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804550:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804560:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804570:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804580:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804590:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8045a0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8045b0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8045c0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8045d0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8045e0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8045f0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804600:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804610:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804620:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804630:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804640:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804650:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804660:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804670:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804680:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804690:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8046a0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8046b0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8046c0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8046d0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8046e0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8046f0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804700:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804710:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804720:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804730:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804740:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804750:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804760:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804770:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804780:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804790:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8047a0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8047b0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8047c0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8047d0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8047e0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8047f0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804800:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804810:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804820:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804830:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804840:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804850:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804860:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804870:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804880:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804890:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8048a0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8048b0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8048c0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8048d0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8048e0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8048f0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804900:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804910:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804920:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804930:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804940:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804950:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804960:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804970:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804980:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804990:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8049a0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8049b0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8049c0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8049d0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8049e0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8049f0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804a00:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804a10:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804a20:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804a30:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804a40:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804a50:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804a60:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804a70:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804a80:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804a90:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804aa0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804ab0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804ac0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804ad0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804ae0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804af0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804b00:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804b10:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804b20:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804b30:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804b40:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804b50:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804b60:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804b70:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804b80:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804b90:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804ba0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804bb0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804bc0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804bd0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804be0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804bf0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804c00:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804c10:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804c20:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804c30:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804c40:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804c50:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804c60:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804c70:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804c80:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804c90:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804ca0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804cb0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804cc0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804cd0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804ce0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804cf0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804d00:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804d10:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804d20:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804d30:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804d40:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804d50:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804d60:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804d70:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804d80:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804d90:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804da0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804db0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804dc0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804dd0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804de0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804df0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804e00:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804e10:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804e20:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804e30:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804e40:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804e50:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804e60:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804e70:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804e80:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804e90:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804ea0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804eb0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804ec0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804ed0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804ee0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804ef0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804f00:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804f10:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804f20:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804f30:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804f40:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804f50:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804f60:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804f70:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804f80:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804f90:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804fa0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804fb0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804fc0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804fd0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804fe0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804ff0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 90     ....f.........f.
@@ -0,0 +1,6173 @@
+
+obj/user/rtjitter:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 b1 02 00 00       	call   8002d4 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+#define RT_DEADLINE (1ULL << 21)
+
+#define NBUCKETS 40
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 57                	push   %r15
+  80002b:	41 56                	push   %r14
+  80002d:	41 55                	push   %r13
+  80002f:	41 54                	push   %r12
+  800031:	53                   	push   %rbx
+  800032:	48 81 ec 68 01 00 00 	sub    $0x168,%rsp
+    envid_t spinners[NSPINNERS];
+
+    for (int i = 0; i < NSPINNERS; i++) {
+  800039:	48 8d 5d c4          	lea    -0x3c(%rbp),%rbx
+  80003d:	4c 8d 6d d0          	lea    -0x30(%rbp),%r13
+        envid_t id = fork();
+  800041:	49 bc 00 18 80 00 00 	movabs $0x801800,%r12
+  800048:	00 00 00 
+  80004b:	41 ff d4             	call   *%r12
+        if (id < 0) panic("fork: %i", id);
+  80004e:	85 c0                	test   %eax,%eax
+  800050:	0f 88 db 00 00 00    	js     800131 <umain+0x10c>
+        if (!id)
+  800056:	0f 84 02 01 00 00    	je     80015e <umain+0x139>
+            for (;;) asm volatile("pause");
+        spinners[i] = id;
+  80005c:	89 03                	mov    %eax,(%rbx)
+    for (int i = 0; i < NSPINNERS; i++) {
+  80005e:	48 83 c3 04          	add    $0x4,%rbx
+  800062:	49 39 dd             	cmp    %rbx,%r13
+  800065:	75 e4                	jne    80004b <umain+0x26>
+    }
+
+    int res = sys_env_set_rt(CURENVID, RT_PERIOD, RT_BUDGET, RT_DEADLINE);
+  800067:	b9 00 00 20 00       	mov    $0x200000,%ecx
+  80006c:	ba 00 00 04 00       	mov    $0x40000,%edx
+  800071:	be 00 00 40 00       	mov    $0x400000,%esi
+  800076:	bf 00 00 00 00       	mov    $0x0,%edi
+  80007b:	48 b8 32 16 80 00 00 	movabs $0x801632,%rax
+  800082:	00 00 00 
+  800085:	ff d0                	call   *%rax
+    if (res < 0) panic("sys_env_set_rt: %i", res);
+  800087:	85 c0                	test   %eax,%eax
+  800089:	0f 88 d3 00 00 00    	js     800162 <umain+0x13d>
+
+    /* Together with this environment it's more than the whole CPU */
+    res = sys_env_set_rt(spinners[0], RT_PERIOD, RT_DEADLINE - RT_BUDGET, RT_DEADLINE);
+  80008f:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  800092:	89 85 74 fe ff ff    	mov    %eax,-0x18c(%rbp)
+  800098:	b9 00 00 20 00       	mov    $0x200000,%ecx
+  80009d:	ba 00 00 1c 00       	mov    $0x1c0000,%edx
+  8000a2:	be 00 00 40 00       	mov    $0x400000,%esi
+  8000a7:	89 c7                	mov    %eax,%edi
+  8000a9:	48 b8 32 16 80 00 00 	movabs $0x801632,%rax
+  8000b0:	00 00 00 
+  8000b3:	ff d0                	call   *%rax
+    cprintf("rtjitter: overloading reservation %s\n", res == -E_OVERLOAD ? "rejected" : "ADMITTED");
+  8000b5:	83 f8 eb             	cmp    $0xffffffeb,%eax
+  8000b8:	48 be 91 30 80 00 00 	movabs $0x803091,%rsi
+  8000bf:	00 00 00 
+  8000c2:	48 b8 88 30 80 00 00 	movabs $0x803088,%rax
+  8000c9:	00 00 00 
+  8000cc:	48 0f 44 f0          	cmove  %rax,%rsi
+  8000d0:	48 bf e0 30 80 00 00 	movabs $0x8030e0,%rdi
+  8000d7:	00 00 00 
+  8000da:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000df:	48 ba f0 04 80 00 00 	movabs $0x8004f0,%rdx
+  8000e6:	00 00 00 
+  8000e9:	ff d2                	call   *%rdx
+
+    uint64_t hist[NBUCKETS] = {0};
+  8000eb:	48 8d bd 80 fe ff ff 	lea    -0x180(%rbp),%rdi
+  8000f2:	b9 28 00 00 00       	mov    $0x28,%ecx
+  8000f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000fc:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+  8000ff:	41 bc d0 07 00 00    	mov    $0x7d0,%r12d
+    uint64_t total = 0, worst = 0, missed = 0;
+  800105:	48 c7 85 78 fe ff ff 	movq   $0x0,-0x188(%rbp)
+  80010c:	00 00 00 00 
+  800110:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800115:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+    for (int i = 0; i < NPERIODS; i++) {
+        sys_yield();
+  80011b:	49 bf 36 13 80 00 00 	movabs $0x801336,%r15
+  800122:	00 00 00 
+
+        uint64_t late = read_tsc() - thisenv->env_rt_release;
+  800125:	49 be 00 50 80 00 00 	movabs $0x805000,%r14
+  80012c:	00 00 00 
+  80012f:	eb 79                	jmp    8001aa <umain+0x185>
+        if (id < 0) panic("fork: %i", id);
+  800131:	89 c1                	mov    %eax,%ecx
+  800133:	48 ba 9a 30 80 00 00 	movabs $0x80309a,%rdx
+  80013a:	00 00 00 
+  80013d:	be 1a 00 00 00       	mov    $0x1a,%esi
+  800142:	48 bf a3 30 80 00 00 	movabs $0x8030a3,%rdi
+  800149:	00 00 00 
+  80014c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800151:	49 b8 a0 03 80 00 00 	movabs $0x8003a0,%r8
+  800158:	00 00 00 
+  80015b:	41 ff d0             	call   *%r8
+            for (;;) asm volatile("pause");
+  80015e:	f3 90                	pause
+  800160:	eb fc                	jmp    80015e <umain+0x139>
+    if (res < 0) panic("sys_env_set_rt: %i", res);
+  800162:	89 c1                	mov    %eax,%ecx
+  800164:	48 ba b3 30 80 00 00 	movabs $0x8030b3,%rdx
+  80016b:	00 00 00 
+  80016e:	be 21 00 00 00       	mov    $0x21,%esi
+  800173:	48 bf a3 30 80 00 00 	movabs $0x8030a3,%rdi
+  80017a:	00 00 00 
+  80017d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800182:	49 b8 a0 03 80 00 00 	movabs $0x8003a0,%r8
+  800189:	00 00 00 
+  80018c:	41 ff d0             	call   *%r8
+        total += late;
+        worst = MAX(worst, late);
+        if (late > RT_DEADLINE) missed++;
+        hist[late ? MIN(63 - __builtin_clzll(late), NBUCKETS - 1) : 0]++;
+  80018f:	48 85 d2             	test   %rdx,%rdx
+  800192:	75 4c                	jne    8001e0 <umain+0x1bb>
+  800194:	b8 00 00 00 00       	mov    $0x0,%eax
+  800199:	48 98                	cltq
+  80019b:	48 83 84 c5 80 fe ff 	addq   $0x1,-0x180(%rbp,%rax,8)
+  8001a2:	ff 01 
+    for (int i = 0; i < NPERIODS; i++) {
+  8001a4:	41 83 ec 01          	sub    $0x1,%r12d
+  8001a8:	74 51                	je     8001fb <umain+0x1d6>
+        sys_yield();
+  8001aa:	41 ff d7             	call   *%r15
+}
+
+static inline uint64_t __attribute__((always_inline))
+read_tsc(void) {
+    uint32_t lo, hi;
+    asm volatile("rdtsc"
+  8001ad:	0f 31                	rdtsc
+        uint64_t late = read_tsc() - thisenv->env_rt_release;
+  8001af:	49 8b 0e             	mov    (%r14),%rcx
+  8001b2:	48 8b 89 38 01 00 00 	mov    0x138(%rcx),%rcx
+                 : "=a"(lo), "=d"(hi));
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  8001b9:	48 c1 e2 20          	shl    $0x20,%rdx
+  8001bd:	89 c0                	mov    %eax,%eax
+  8001bf:	48 09 c2             	or     %rax,%rdx
+  8001c2:	48 29 ca             	sub    %rcx,%rdx
+        total += late;
+  8001c5:	49 01 d5             	add    %rdx,%r13
+        worst = MAX(worst, late);
+  8001c8:	48 39 d3             	cmp    %rdx,%rbx
+  8001cb:	48 0f 42 da          	cmovb  %rdx,%rbx
+        if (late > RT_DEADLINE) missed++;
+  8001cf:	48 81 fa 00 00 20 00 	cmp    $0x200000,%rdx
+  8001d6:	76 b7                	jbe    80018f <umain+0x16a>
+  8001d8:	48 83 85 78 fe ff ff 	addq   $0x1,-0x188(%rbp)
+  8001df:	01 
+        hist[late ? MIN(63 - __builtin_clzll(late), NBUCKETS - 1) : 0]++;
+  8001e0:	48 0f bd d2          	bsr    %rdx,%rdx
+  8001e4:	48 83 f2 3f          	xor    $0x3f,%rdx
+  8001e8:	b8 3f 00 00 00       	mov    $0x3f,%eax
+  8001ed:	29 d0                	sub    %edx,%eax
+  8001ef:	ba 27 00 00 00       	mov    $0x27,%edx
+  8001f4:	39 d0                	cmp    %edx,%eax
+  8001f6:	0f 4f c2             	cmovg  %edx,%eax
+  8001f9:	eb 9e                	jmp    800199 <umain+0x174>
+    }
+
+    sys_env_set_rt(CURENVID, 0, 0, 0);
+  8001fb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800200:	ba 00 00 00 00       	mov    $0x0,%edx
+  800205:	be 00 00 00 00       	mov    $0x0,%esi
+  80020a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80020f:	48 b8 32 16 80 00 00 	movabs $0x801632,%rax
+  800216:	00 00 00 
+  800219:	ff d0                	call   *%rax
+    for (int i = 0; i < NSPINNERS; i++)
+        sys_env_destroy(spinners[i]);
+  80021b:	8b bd 74 fe ff ff    	mov    -0x18c(%rbp),%edi
+  800221:	49 bc 9a 12 80 00 00 	movabs $0x80129a,%r12
+  800228:	00 00 00 
+  80022b:	41 ff d4             	call   *%r12
+  80022e:	8b 7d c8             	mov    -0x38(%rbp),%edi
+  800231:	41 ff d4             	call   *%r12
+  800234:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  800237:	41 ff d4             	call   *%r12
+
+    cprintf("rtjitter: %d periods of %lu cycles, wake-up latency avg %lu max %lu cycles, %lu deadlines missed\n",
+            NPERIODS, (unsigned long)RT_PERIOD, (unsigned long)(total / NPERIODS),
+  80023a:	49 c1 ed 04          	shr    $0x4,%r13
+  80023e:	48 ba 7d 3f 35 5e ba 	movabs $0x20c49ba5e353f7d,%rdx
+  800245:	49 0c 02 
+  800248:	4c 89 e8             	mov    %r13,%rax
+  80024b:	48 f7 e2             	mul    %rdx
+  80024e:	48 89 d1             	mov    %rdx,%rcx
+    cprintf("rtjitter: %d periods of %lu cycles, wake-up latency avg %lu max %lu cycles, %lu deadlines missed\n",
+  800251:	4c 8b 8d 78 fe ff ff 	mov    -0x188(%rbp),%r9
+  800258:	49 89 d8             	mov    %rbx,%r8
+  80025b:	ba 00 00 40 00       	mov    $0x400000,%edx
+  800260:	be d0 07 00 00       	mov    $0x7d0,%esi
+  800265:	48 bf 08 31 80 00 00 	movabs $0x803108,%rdi
+  80026c:	00 00 00 
+  80026f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800274:	49 ba f0 04 80 00 00 	movabs $0x8004f0,%r10
+  80027b:	00 00 00 
+  80027e:	41 ff d2             	call   *%r10
+  800281:	bb 01 00 00 00       	mov    $0x1,%ebx
+            (unsigned long)worst, (unsigned long)missed);
+    for (int i = 0; i < NBUCKETS; i++)
+        if (hist[i]) cprintf("  < 2^%-2d cycles: %lu\n", i + 1, (unsigned long)hist[i]);
+  800286:	49 bd c6 30 80 00 00 	movabs $0x8030c6,%r13
+  80028d:	00 00 00 
+  800290:	49 bc f0 04 80 00 00 	movabs $0x8004f0,%r12
+  800297:	00 00 00 
+  80029a:	eb 17                	jmp    8002b3 <umain+0x28e>
+  80029c:	89 de                	mov    %ebx,%esi
+  80029e:	4c 89 ef             	mov    %r13,%rdi
+  8002a1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002a6:	41 ff d4             	call   *%r12
+    for (int i = 0; i < NBUCKETS; i++)
+  8002a9:	48 83 c3 01          	add    $0x1,%rbx
+  8002ad:	48 83 fb 29          	cmp    $0x29,%rbx
+  8002b1:	74 0f                	je     8002c2 <umain+0x29d>
+        if (hist[i]) cprintf("  < 2^%-2d cycles: %lu\n", i + 1, (unsigned long)hist[i]);
+  8002b3:	48 8b 94 dd 78 fe ff 	mov    -0x188(%rbp,%rbx,8),%rdx
+  8002ba:	ff 
+  8002bb:	48 85 d2             	test   %rdx,%rdx
+  8002be:	74 e9                	je     8002a9 <umain+0x284>
+  8002c0:	eb da                	jmp    80029c <umain+0x277>
+}
+  8002c2:	48 81 c4 68 01 00 00 	add    $0x168,%rsp
+  8002c9:	5b                   	pop    %rbx
+  8002ca:	41 5c                	pop    %r12
+  8002cc:	41 5d                	pop    %r13
+  8002ce:	41 5e                	pop    %r14
+  8002d0:	41 5f                	pop    %r15
+  8002d2:	5d                   	pop    %rbp
+  8002d3:	c3                   	ret
+
+00000000008002d4 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  8002d4:	55                   	push   %rbp
+  8002d5:	48 89 e5             	mov    %rsp,%rbp
+  8002d8:	41 56                	push   %r14
+  8002da:	41 55                	push   %r13
+  8002dc:	41 54                	push   %r12
+  8002de:	53                   	push   %rbx
+  8002df:	41 89 fd             	mov    %edi,%r13d
+  8002e2:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  8002e5:	48 ba d8 40 80 00 00 	movabs $0x8040d8,%rdx
+  8002ec:	00 00 00 
+  8002ef:	48 b8 d8 40 80 00 00 	movabs $0x8040d8,%rax
+  8002f6:	00 00 00 
+  8002f9:	48 39 c2             	cmp    %rax,%rdx
+  8002fc:	73 17                	jae    800315 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  8002fe:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  800301:	49 89 c4             	mov    %rax,%r12
+  800304:	48 83 c3 08          	add    $0x8,%rbx
+  800308:	b8 00 00 00 00       	mov    $0x0,%eax
+  80030d:	ff 53 f8             	call   *-0x8(%rbx)
+  800310:	4c 39 e3             	cmp    %r12,%rbx
+  800313:	72 ef                	jb     800304 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+    envid_t this_env_id = sys_getenvid();
+  800315:	48 b8 05 13 80 00 00 	movabs $0x801305,%rax
+  80031c:	00 00 00 
+  80031f:	ff d0                	call   *%rax
+    thisenv = &((struct Env*)UENVS)[ENVX(this_env_id)];
+  800321:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800326:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+  80032d:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  800334:	00 00 00 
+  800337:	48 01 d0             	add    %rdx,%rax
+  80033a:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  800341:	00 00 00 
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  800344:	45 85 ed             	test   %r13d,%r13d
+  800347:	7e 0d                	jle    800356 <libmain+0x82>
+  800349:	49 8b 06             	mov    (%r14),%rax
+  80034c:	48 a3 00 40 80 00 00 	movabs %rax,0x804000
+  800353:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  800356:	4c 89 f6             	mov    %r14,%rsi
+  800359:	44 89 ef             	mov    %r13d,%edi
+  80035c:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  800363:	00 00 00 
+  800366:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  800368:	48 b8 7d 03 80 00 00 	movabs $0x80037d,%rax
+  80036f:	00 00 00 
+  800372:	ff d0                	call   *%rax
+#endif
+}
+  800374:	5b                   	pop    %rbx
+  800375:	41 5c                	pop    %r12
+  800377:	41 5d                	pop    %r13
+  800379:	41 5e                	pop    %r14
+  80037b:	5d                   	pop    %rbp
+  80037c:	c3                   	ret
+
+000000000080037d <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  80037d:	55                   	push   %rbp
+  80037e:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  800381:	48 b8 bd 1b 80 00 00 	movabs $0x801bbd,%rax
+  800388:	00 00 00 
+  80038b:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  80038d:	bf 00 00 00 00       	mov    $0x0,%edi
+  800392:	48 b8 9a 12 80 00 00 	movabs $0x80129a,%rax
+  800399:	00 00 00 
+  80039c:	ff d0                	call   *%rax
+}
+  80039e:	5d                   	pop    %rbp
+  80039f:	c3                   	ret
+
+00000000008003a0 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  8003a0:	55                   	push   %rbp
+  8003a1:	48 89 e5             	mov    %rsp,%rbp
+  8003a4:	41 56                	push   %r14
+  8003a6:	41 55                	push   %r13
+  8003a8:	41 54                	push   %r12
+  8003aa:	53                   	push   %rbx
+  8003ab:	48 83 ec 50          	sub    $0x50,%rsp
+  8003af:	49 89 fc             	mov    %rdi,%r12
+  8003b2:	41 89 f5             	mov    %esi,%r13d
+  8003b5:	48 89 d3             	mov    %rdx,%rbx
+  8003b8:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  8003bc:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  8003c0:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  8003c4:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  8003cb:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8003cf:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  8003d3:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  8003d7:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  8003db:	48 b8 00 40 80 00 00 	movabs $0x804000,%rax
+  8003e2:	00 00 00 
+  8003e5:	4c 8b 30             	mov    (%rax),%r14
+  8003e8:	48 b8 05 13 80 00 00 	movabs $0x801305,%rax
+  8003ef:	00 00 00 
+  8003f2:	ff d0                	call   *%rax
+  8003f4:	89 c6                	mov    %eax,%esi
+  8003f6:	45 89 e8             	mov    %r13d,%r8d
+  8003f9:	4c 89 e1             	mov    %r12,%rcx
+  8003fc:	4c 89 f2             	mov    %r14,%rdx
+  8003ff:	48 bf 78 31 80 00 00 	movabs $0x803178,%rdi
+  800406:	00 00 00 
+  800409:	b8 00 00 00 00       	mov    $0x0,%eax
+  80040e:	49 bc f0 04 80 00 00 	movabs $0x8004f0,%r12
+  800415:	00 00 00 
+  800418:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  80041b:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  80041f:	48 89 df             	mov    %rbx,%rdi
+  800422:	48 b8 8c 04 80 00 00 	movabs $0x80048c,%rax
+  800429:	00 00 00 
+  80042c:	ff d0                	call   *%rax
+    cprintf("\n");
+  80042e:	48 bf b3 37 80 00 00 	movabs $0x8037b3,%rdi
+  800435:	00 00 00 
+  800438:	b8 00 00 00 00       	mov    $0x0,%eax
+  80043d:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  800440:	cc                   	int3
+  800441:	eb fd                	jmp    800440 <_panic+0xa0>
+
+0000000000800443 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  800443:	55                   	push   %rbp
+  800444:	48 89 e5             	mov    %rsp,%rbp
+  800447:	53                   	push   %rbx
+  800448:	48 83 ec 08          	sub    $0x8,%rsp
+  80044c:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  80044f:	8b 06                	mov    (%rsi),%eax
+  800451:	8d 50 01             	lea    0x1(%rax),%edx
+  800454:	89 16                	mov    %edx,(%rsi)
+  800456:	48 98                	cltq
+  800458:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  80045d:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  800463:	74 0a                	je     80046f <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  800465:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  800469:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80046d:	c9                   	leave
+  80046e:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  80046f:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  800473:	be ff 00 00 00       	mov    $0xff,%esi
+  800478:	48 b8 3c 12 80 00 00 	movabs $0x80123c,%rax
+  80047f:	00 00 00 
+  800482:	ff d0                	call   *%rax
+        state->offset = 0;
+  800484:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  80048a:	eb d9                	jmp    800465 <putch+0x22>
+
+000000000080048c <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  80048c:	55                   	push   %rbp
+  80048d:	48 89 e5             	mov    %rsp,%rbp
+  800490:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  800497:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  80049a:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  8004a1:	b9 21 00 00 00       	mov    $0x21,%ecx
+  8004a6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004ab:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  8004ae:	48 89 f1             	mov    %rsi,%rcx
+  8004b1:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  8004b8:	48 bf 43 04 80 00 00 	movabs $0x800443,%rdi
+  8004bf:	00 00 00 
+  8004c2:	48 b8 40 06 80 00 00 	movabs $0x800640,%rax
+  8004c9:	00 00 00 
+  8004cc:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  8004ce:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  8004d5:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  8004dc:	48 b8 3c 12 80 00 00 	movabs $0x80123c,%rax
+  8004e3:	00 00 00 
+  8004e6:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  8004e8:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  8004ee:	c9                   	leave
+  8004ef:	c3                   	ret
+
+00000000008004f0 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  8004f0:	55                   	push   %rbp
+  8004f1:	48 89 e5             	mov    %rsp,%rbp
+  8004f4:	48 83 ec 50          	sub    $0x50,%rsp
+  8004f8:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8004fc:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  800500:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800504:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800508:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  80050c:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  800513:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800517:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80051b:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80051f:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  800523:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  800527:	48 b8 8c 04 80 00 00 	movabs $0x80048c,%rax
+  80052e:	00 00 00 
+  800531:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  800533:	c9                   	leave
+  800534:	c3                   	ret
+
+0000000000800535 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  800535:	55                   	push   %rbp
+  800536:	48 89 e5             	mov    %rsp,%rbp
+  800539:	41 57                	push   %r15
+  80053b:	41 56                	push   %r14
+  80053d:	41 55                	push   %r13
+  80053f:	41 54                	push   %r12
+  800541:	53                   	push   %rbx
+  800542:	48 83 ec 18          	sub    $0x18,%rsp
+  800546:	49 89 fc             	mov    %rdi,%r12
+  800549:	49 89 f5             	mov    %rsi,%r13
+  80054c:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800550:	8b 45 10             	mov    0x10(%rbp),%eax
+  800553:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  800556:	41 89 cf             	mov    %ecx,%r15d
+  800559:	4c 39 fa             	cmp    %r15,%rdx
+  80055c:	73 5b                	jae    8005b9 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  80055e:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  800562:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  800566:	85 db                	test   %ebx,%ebx
+  800568:	7e 0e                	jle    800578 <print_num+0x43>
+            putch(padc, put_arg);
+  80056a:	4c 89 ee             	mov    %r13,%rsi
+  80056d:	44 89 f7             	mov    %r14d,%edi
+  800570:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  800573:	83 eb 01             	sub    $0x1,%ebx
+  800576:	75 f2                	jne    80056a <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  800578:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  80057c:	48 b9 ac 31 80 00 00 	movabs $0x8031ac,%rcx
+  800583:	00 00 00 
+  800586:	48 b8 9b 31 80 00 00 	movabs $0x80319b,%rax
+  80058d:	00 00 00 
+  800590:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  800594:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800598:	ba 00 00 00 00       	mov    $0x0,%edx
+  80059d:	49 f7 f7             	div    %r15
+  8005a0:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  8005a4:	4c 89 ee             	mov    %r13,%rsi
+  8005a7:	41 ff d4             	call   *%r12
+}
+  8005aa:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8005ae:	5b                   	pop    %rbx
+  8005af:	41 5c                	pop    %r12
+  8005b1:	41 5d                	pop    %r13
+  8005b3:	41 5e                	pop    %r14
+  8005b5:	41 5f                	pop    %r15
+  8005b7:	5d                   	pop    %rbp
+  8005b8:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  8005b9:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8005bd:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005c2:	49 f7 f7             	div    %r15
+  8005c5:	48 83 ec 08          	sub    $0x8,%rsp
+  8005c9:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  8005cd:	52                   	push   %rdx
+  8005ce:	45 0f be c9          	movsbl %r9b,%r9d
+  8005d2:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  8005d6:	48 89 c2             	mov    %rax,%rdx
+  8005d9:	48 b8 35 05 80 00 00 	movabs $0x800535,%rax
+  8005e0:	00 00 00 
+  8005e3:	ff d0                	call   *%rax
+  8005e5:	48 83 c4 10          	add    $0x10,%rsp
+  8005e9:	eb 8d                	jmp    800578 <print_num+0x43>
+
+00000000008005eb <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  8005eb:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  8005ef:	48 8b 06             	mov    (%rsi),%rax
+  8005f2:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  8005f6:	73 0a                	jae    800602 <sprintputch+0x17>
+        *state->start++ = ch;
+  8005f8:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8005fc:	48 89 16             	mov    %rdx,(%rsi)
+  8005ff:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  800602:	c3                   	ret
+
+0000000000800603 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  800603:	55                   	push   %rbp
+  800604:	48 89 e5             	mov    %rsp,%rbp
+  800607:	48 83 ec 50          	sub    $0x50,%rsp
+  80060b:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80060f:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800613:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  800617:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  80061e:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800622:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800626:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80062a:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  80062e:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800632:	48 b8 40 06 80 00 00 	movabs $0x800640,%rax
+  800639:	00 00 00 
+  80063c:	ff d0                	call   *%rax
+}
+  80063e:	c9                   	leave
+  80063f:	c3                   	ret
+
+0000000000800640 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  800640:	55                   	push   %rbp
+  800641:	48 89 e5             	mov    %rsp,%rbp
+  800644:	41 57                	push   %r15
+  800646:	41 56                	push   %r14
+  800648:	41 55                	push   %r13
+  80064a:	41 54                	push   %r12
+  80064c:	53                   	push   %rbx
+  80064d:	48 83 ec 38          	sub    $0x38,%rsp
+  800651:	49 89 fe             	mov    %rdi,%r14
+  800654:	49 89 f5             	mov    %rsi,%r13
+  800657:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  80065a:	48 8b 01             	mov    (%rcx),%rax
+  80065d:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  800661:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800665:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800669:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  80066d:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  800671:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  800675:	0f b6 3b             	movzbl (%rbx),%edi
+  800678:	40 80 ff 25          	cmp    $0x25,%dil
+  80067c:	74 18                	je     800696 <vprintfmt+0x56>
+            if (!ch) return;
+  80067e:	40 84 ff             	test   %dil,%dil
+  800681:	0f 84 b1 06 00 00    	je     800d38 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  800687:	40 0f b6 ff          	movzbl %dil,%edi
+  80068b:	4c 89 ee             	mov    %r13,%rsi
+  80068e:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  800691:	4c 89 e3             	mov    %r12,%rbx
+  800694:	eb db                	jmp    800671 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  800696:	be 00 00 00 00       	mov    $0x0,%esi
+  80069b:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  80069f:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  8006a4:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8006aa:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  8006b1:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8006b5:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  8006ba:	41 0f b6 04 24       	movzbl (%r12),%eax
+  8006bf:	88 45 a0             	mov    %al,-0x60(%rbp)
+  8006c2:	83 e8 23             	sub    $0x23,%eax
+  8006c5:	3c 57                	cmp    $0x57,%al
+  8006c7:	0f 87 51 06 00 00    	ja     800d1e <vprintfmt+0x6de>
+  8006cd:	0f b6 c0             	movzbl %al,%eax
+  8006d0:	48 b9 60 33 80 00 00 	movabs $0x803360,%rcx
+  8006d7:	00 00 00 
+  8006da:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  8006dd:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  8006e0:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  8006e4:	eb cf                	jmp    8006b5 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  8006e6:	49 89 dc             	mov    %rbx,%r12
+  8006e9:	be 01 00 00 00       	mov    $0x1,%esi
+  8006ee:	eb c5                	jmp    8006b5 <vprintfmt+0x75>
+            padc = ch;
+  8006f0:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  8006f4:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8006f7:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8006fa:	eb b9                	jmp    8006b5 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8006fc:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006ff:	83 f8 2f             	cmp    $0x2f,%eax
+  800702:	77 24                	ja     800728 <vprintfmt+0xe8>
+  800704:	89 c1                	mov    %eax,%ecx
+  800706:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  80070a:	83 c0 08             	add    $0x8,%eax
+  80070d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800710:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  800713:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  800716:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  80071a:	79 99                	jns    8006b5 <vprintfmt+0x75>
+                width = precision;
+  80071c:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  800720:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800726:	eb 8d                	jmp    8006b5 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800728:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80072c:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  800730:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800734:	eb da                	jmp    800710 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  800736:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  80073b:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  80073f:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  800745:	3c 39                	cmp    $0x39,%al
+  800747:	77 1c                	ja     800765 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  800749:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  80074d:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  800751:	0f b6 c0             	movzbl %al,%eax
+  800754:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800759:	0f b6 03             	movzbl (%rbx),%eax
+  80075c:	3c 39                	cmp    $0x39,%al
+  80075e:	76 e9                	jbe    800749 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  800760:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  800763:	eb b1                	jmp    800716 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  800765:	49 89 dc             	mov    %rbx,%r12
+  800768:	eb ac                	jmp    800716 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  80076a:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  80076d:	85 c9                	test   %ecx,%ecx
+  80076f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800774:	0f 49 c1             	cmovns %ecx,%eax
+  800777:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  80077a:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80077d:	e9 33 ff ff ff       	jmp    8006b5 <vprintfmt+0x75>
+            lflag++;
+  800782:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  800785:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800788:	e9 28 ff ff ff       	jmp    8006b5 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  80078d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800790:	83 f8 2f             	cmp    $0x2f,%eax
+  800793:	77 19                	ja     8007ae <vprintfmt+0x16e>
+  800795:	89 c2                	mov    %eax,%edx
+  800797:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80079b:	83 c0 08             	add    $0x8,%eax
+  80079e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007a1:	8b 3a                	mov    (%rdx),%edi
+  8007a3:	4c 89 ee             	mov    %r13,%rsi
+  8007a6:	41 ff d6             	call   *%r14
+            break;
+  8007a9:	e9 c3 fe ff ff       	jmp    800671 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  8007ae:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007b2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007b6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007ba:	eb e5                	jmp    8007a1 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  8007bc:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007bf:	83 f8 2f             	cmp    $0x2f,%eax
+  8007c2:	77 5a                	ja     80081e <vprintfmt+0x1de>
+  8007c4:	89 c2                	mov    %eax,%edx
+  8007c6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007ca:	83 c0 08             	add    $0x8,%eax
+  8007cd:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  8007d0:	8b 02                	mov    (%rdx),%eax
+  8007d2:	89 c1                	mov    %eax,%ecx
+  8007d4:	f7 d9                	neg    %ecx
+  8007d6:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  8007d9:	83 f9 15             	cmp    $0x15,%ecx
+  8007dc:	7f 4e                	jg     80082c <vprintfmt+0x1ec>
+  8007de:	48 63 c1             	movslq %ecx,%rax
+  8007e1:	48 ba 20 36 80 00 00 	movabs $0x803620,%rdx
+  8007e8:	00 00 00 
+  8007eb:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8007ef:	48 85 c0             	test   %rax,%rax
+  8007f2:	74 38                	je     80082c <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  8007f4:	48 89 c1             	mov    %rax,%rcx
+  8007f7:	48 ba 19 38 80 00 00 	movabs $0x803819,%rdx
+  8007fe:	00 00 00 
+  800801:	4c 89 ee             	mov    %r13,%rsi
+  800804:	4c 89 f7             	mov    %r14,%rdi
+  800807:	b8 00 00 00 00       	mov    $0x0,%eax
+  80080c:	49 b8 03 06 80 00 00 	movabs $0x800603,%r8
+  800813:	00 00 00 
+  800816:	41 ff d0             	call   *%r8
+  800819:	e9 53 fe ff ff       	jmp    800671 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  80081e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800822:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800826:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80082a:	eb a4                	jmp    8007d0 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  80082c:	48 ba c4 31 80 00 00 	movabs $0x8031c4,%rdx
+  800833:	00 00 00 
+  800836:	4c 89 ee             	mov    %r13,%rsi
+  800839:	4c 89 f7             	mov    %r14,%rdi
+  80083c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800841:	49 b8 03 06 80 00 00 	movabs $0x800603,%r8
+  800848:	00 00 00 
+  80084b:	41 ff d0             	call   *%r8
+  80084e:	e9 1e fe ff ff       	jmp    800671 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800853:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800856:	83 f8 2f             	cmp    $0x2f,%eax
+  800859:	77 6c                	ja     8008c7 <vprintfmt+0x287>
+  80085b:	89 c2                	mov    %eax,%edx
+  80085d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800861:	83 c0 08             	add    $0x8,%eax
+  800864:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800867:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  80086a:	48 85 d2             	test   %rdx,%rdx
+  80086d:	48 b8 bd 31 80 00 00 	movabs $0x8031bd,%rax
+  800874:	00 00 00 
+  800877:	48 0f 45 c2          	cmovne %rdx,%rax
+  80087b:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  80087f:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800883:	7e 06                	jle    80088b <vprintfmt+0x24b>
+  800885:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  800889:	75 4a                	jne    8008d5 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  80088b:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  80088f:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  800893:	0f b6 00             	movzbl (%rax),%eax
+  800896:	84 c0                	test   %al,%al
+  800898:	0f 85 9a 00 00 00    	jne    800938 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  80089e:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8008a1:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  8008a5:	85 c0                	test   %eax,%eax
+  8008a7:	0f 8e c4 fd ff ff    	jle    800671 <vprintfmt+0x31>
+  8008ad:	4c 89 ee             	mov    %r13,%rsi
+  8008b0:	bf 20 00 00 00       	mov    $0x20,%edi
+  8008b5:	41 ff d6             	call   *%r14
+  8008b8:	41 83 ec 01          	sub    $0x1,%r12d
+  8008bc:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  8008c0:	75 eb                	jne    8008ad <vprintfmt+0x26d>
+  8008c2:	e9 aa fd ff ff       	jmp    800671 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8008c7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008cb:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008cf:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008d3:	eb 92                	jmp    800867 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  8008d5:	49 63 f7             	movslq %r15d,%rsi
+  8008d8:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  8008dc:	48 b8 f2 0d 80 00 00 	movabs $0x800df2,%rax
+  8008e3:	00 00 00 
+  8008e6:	ff d0                	call   *%rax
+  8008e8:	48 89 c2             	mov    %rax,%rdx
+  8008eb:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8008ee:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  8008f0:	8d 70 ff             	lea    -0x1(%rax),%esi
+  8008f3:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  8008f6:	85 c0                	test   %eax,%eax
+  8008f8:	7e 91                	jle    80088b <vprintfmt+0x24b>
+  8008fa:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  8008ff:	4c 89 ee             	mov    %r13,%rsi
+  800902:	44 89 e7             	mov    %r12d,%edi
+  800905:	41 ff d6             	call   *%r14
+  800908:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  80090c:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80090f:	83 f8 ff             	cmp    $0xffffffff,%eax
+  800912:	75 eb                	jne    8008ff <vprintfmt+0x2bf>
+  800914:	e9 72 ff ff ff       	jmp    80088b <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800919:	0f b6 f8             	movzbl %al,%edi
+  80091c:	4c 89 ee             	mov    %r13,%rsi
+  80091f:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800922:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800926:	49 83 c4 01          	add    $0x1,%r12
+  80092a:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  800930:	84 c0                	test   %al,%al
+  800932:	0f 84 66 ff ff ff    	je     80089e <vprintfmt+0x25e>
+  800938:	45 85 ff             	test   %r15d,%r15d
+  80093b:	78 0a                	js     800947 <vprintfmt+0x307>
+  80093d:	41 83 ef 01          	sub    $0x1,%r15d
+  800941:	0f 88 57 ff ff ff    	js     80089e <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800947:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  80094b:	74 cc                	je     800919 <vprintfmt+0x2d9>
+  80094d:	8d 50 e0             	lea    -0x20(%rax),%edx
+  800950:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800955:	80 fa 5e             	cmp    $0x5e,%dl
+  800958:	77 c2                	ja     80091c <vprintfmt+0x2dc>
+  80095a:	eb bd                	jmp    800919 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  80095c:	40 84 f6             	test   %sil,%sil
+  80095f:	75 26                	jne    800987 <vprintfmt+0x347>
+    switch (lflag) {
+  800961:	85 d2                	test   %edx,%edx
+  800963:	74 59                	je     8009be <vprintfmt+0x37e>
+  800965:	83 fa 01             	cmp    $0x1,%edx
+  800968:	74 7b                	je     8009e5 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  80096a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80096d:	83 f8 2f             	cmp    $0x2f,%eax
+  800970:	0f 87 96 00 00 00    	ja     800a0c <vprintfmt+0x3cc>
+  800976:	89 c2                	mov    %eax,%edx
+  800978:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80097c:	83 c0 08             	add    $0x8,%eax
+  80097f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800982:	4c 8b 22             	mov    (%rdx),%r12
+  800985:	eb 17                	jmp    80099e <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  800987:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80098a:	83 f8 2f             	cmp    $0x2f,%eax
+  80098d:	77 21                	ja     8009b0 <vprintfmt+0x370>
+  80098f:	89 c2                	mov    %eax,%edx
+  800991:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800995:	83 c0 08             	add    $0x8,%eax
+  800998:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80099b:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  80099e:	4d 85 e4             	test   %r12,%r12
+  8009a1:	78 7a                	js     800a1d <vprintfmt+0x3dd>
+            num = i;
+  8009a3:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  8009a6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  8009ab:	e9 50 02 00 00       	jmp    800c00 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8009b0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009b4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009b8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009bc:	eb dd                	jmp    80099b <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  8009be:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009c1:	83 f8 2f             	cmp    $0x2f,%eax
+  8009c4:	77 11                	ja     8009d7 <vprintfmt+0x397>
+  8009c6:	89 c2                	mov    %eax,%edx
+  8009c8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009cc:	83 c0 08             	add    $0x8,%eax
+  8009cf:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009d2:	4c 63 22             	movslq (%rdx),%r12
+  8009d5:	eb c7                	jmp    80099e <vprintfmt+0x35e>
+  8009d7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009db:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009df:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009e3:	eb ed                	jmp    8009d2 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  8009e5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009e8:	83 f8 2f             	cmp    $0x2f,%eax
+  8009eb:	77 11                	ja     8009fe <vprintfmt+0x3be>
+  8009ed:	89 c2                	mov    %eax,%edx
+  8009ef:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009f3:	83 c0 08             	add    $0x8,%eax
+  8009f6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009f9:	4c 8b 22             	mov    (%rdx),%r12
+  8009fc:	eb a0                	jmp    80099e <vprintfmt+0x35e>
+  8009fe:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a02:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a06:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a0a:	eb ed                	jmp    8009f9 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  800a0c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a10:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a14:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a18:	e9 65 ff ff ff       	jmp    800982 <vprintfmt+0x342>
+                putch('-', put_arg);
+  800a1d:	4c 89 ee             	mov    %r13,%rsi
+  800a20:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800a25:	41 ff d6             	call   *%r14
+                i = -i;
+  800a28:	49 f7 dc             	neg    %r12
+  800a2b:	e9 73 ff ff ff       	jmp    8009a3 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  800a30:	40 84 f6             	test   %sil,%sil
+  800a33:	75 32                	jne    800a67 <vprintfmt+0x427>
+    switch (lflag) {
+  800a35:	85 d2                	test   %edx,%edx
+  800a37:	74 5d                	je     800a96 <vprintfmt+0x456>
+  800a39:	83 fa 01             	cmp    $0x1,%edx
+  800a3c:	0f 84 82 00 00 00    	je     800ac4 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  800a42:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a45:	83 f8 2f             	cmp    $0x2f,%eax
+  800a48:	0f 87 a5 00 00 00    	ja     800af3 <vprintfmt+0x4b3>
+  800a4e:	89 c2                	mov    %eax,%edx
+  800a50:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a54:	83 c0 08             	add    $0x8,%eax
+  800a57:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a5a:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800a5d:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  800a62:	e9 99 01 00 00       	jmp    800c00 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800a67:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a6a:	83 f8 2f             	cmp    $0x2f,%eax
+  800a6d:	77 19                	ja     800a88 <vprintfmt+0x448>
+  800a6f:	89 c2                	mov    %eax,%edx
+  800a71:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a75:	83 c0 08             	add    $0x8,%eax
+  800a78:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a7b:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800a7e:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800a83:	e9 78 01 00 00       	jmp    800c00 <vprintfmt+0x5c0>
+  800a88:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a8c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a90:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a94:	eb e5                	jmp    800a7b <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  800a96:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a99:	83 f8 2f             	cmp    $0x2f,%eax
+  800a9c:	77 18                	ja     800ab6 <vprintfmt+0x476>
+  800a9e:	89 c2                	mov    %eax,%edx
+  800aa0:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800aa4:	83 c0 08             	add    $0x8,%eax
+  800aa7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800aaa:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800aac:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  800ab1:	e9 4a 01 00 00       	jmp    800c00 <vprintfmt+0x5c0>
+  800ab6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800aba:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800abe:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ac2:	eb e6                	jmp    800aaa <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  800ac4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ac7:	83 f8 2f             	cmp    $0x2f,%eax
+  800aca:	77 19                	ja     800ae5 <vprintfmt+0x4a5>
+  800acc:	89 c2                	mov    %eax,%edx
+  800ace:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ad2:	83 c0 08             	add    $0x8,%eax
+  800ad5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ad8:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800adb:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  800ae0:	e9 1b 01 00 00       	jmp    800c00 <vprintfmt+0x5c0>
+  800ae5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ae9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800aed:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800af1:	eb e5                	jmp    800ad8 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  800af3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800af7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800afb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800aff:	e9 56 ff ff ff       	jmp    800a5a <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  800b04:	40 84 f6             	test   %sil,%sil
+  800b07:	75 2e                	jne    800b37 <vprintfmt+0x4f7>
+    switch (lflag) {
+  800b09:	85 d2                	test   %edx,%edx
+  800b0b:	74 59                	je     800b66 <vprintfmt+0x526>
+  800b0d:	83 fa 01             	cmp    $0x1,%edx
+  800b10:	74 7f                	je     800b91 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  800b12:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b15:	83 f8 2f             	cmp    $0x2f,%eax
+  800b18:	0f 87 9f 00 00 00    	ja     800bbd <vprintfmt+0x57d>
+  800b1e:	89 c2                	mov    %eax,%edx
+  800b20:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b24:	83 c0 08             	add    $0x8,%eax
+  800b27:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b2a:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800b2d:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  800b32:	e9 c9 00 00 00       	jmp    800c00 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800b37:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b3a:	83 f8 2f             	cmp    $0x2f,%eax
+  800b3d:	77 19                	ja     800b58 <vprintfmt+0x518>
+  800b3f:	89 c2                	mov    %eax,%edx
+  800b41:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b45:	83 c0 08             	add    $0x8,%eax
+  800b48:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b4b:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800b4e:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800b53:	e9 a8 00 00 00       	jmp    800c00 <vprintfmt+0x5c0>
+  800b58:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b5c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b60:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b64:	eb e5                	jmp    800b4b <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  800b66:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b69:	83 f8 2f             	cmp    $0x2f,%eax
+  800b6c:	77 15                	ja     800b83 <vprintfmt+0x543>
+  800b6e:	89 c2                	mov    %eax,%edx
+  800b70:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b74:	83 c0 08             	add    $0x8,%eax
+  800b77:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b7a:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  800b7c:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  800b81:	eb 7d                	jmp    800c00 <vprintfmt+0x5c0>
+  800b83:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b87:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b8b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b8f:	eb e9                	jmp    800b7a <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  800b91:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b94:	83 f8 2f             	cmp    $0x2f,%eax
+  800b97:	77 16                	ja     800baf <vprintfmt+0x56f>
+  800b99:	89 c2                	mov    %eax,%edx
+  800b9b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b9f:	83 c0 08             	add    $0x8,%eax
+  800ba2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ba5:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800ba8:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  800bad:	eb 51                	jmp    800c00 <vprintfmt+0x5c0>
+  800baf:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bb3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bb7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bbb:	eb e8                	jmp    800ba5 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  800bbd:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bc1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bc5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bc9:	e9 5c ff ff ff       	jmp    800b2a <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  800bce:	4c 89 ee             	mov    %r13,%rsi
+  800bd1:	bf 30 00 00 00       	mov    $0x30,%edi
+  800bd6:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800bd9:	4c 89 ee             	mov    %r13,%rsi
+  800bdc:	bf 78 00 00 00       	mov    $0x78,%edi
+  800be1:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800be4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800be7:	83 f8 2f             	cmp    $0x2f,%eax
+  800bea:	77 47                	ja     800c33 <vprintfmt+0x5f3>
+  800bec:	89 c2                	mov    %eax,%edx
+  800bee:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800bf2:	83 c0 08             	add    $0x8,%eax
+  800bf5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800bf8:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800bfb:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800c00:	48 83 ec 08          	sub    $0x8,%rsp
+  800c04:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800c08:	0f 94 c0             	sete   %al
+  800c0b:	0f b6 c0             	movzbl %al,%eax
+  800c0e:	50                   	push   %rax
+  800c0f:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800c14:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800c18:	4c 89 ee             	mov    %r13,%rsi
+  800c1b:	4c 89 f7             	mov    %r14,%rdi
+  800c1e:	48 b8 35 05 80 00 00 	movabs $0x800535,%rax
+  800c25:	00 00 00 
+  800c28:	ff d0                	call   *%rax
+            break;
+  800c2a:	48 83 c4 10          	add    $0x10,%rsp
+  800c2e:	e9 3e fa ff ff       	jmp    800671 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800c33:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c37:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c3b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c3f:	eb b7                	jmp    800bf8 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  800c41:	40 84 f6             	test   %sil,%sil
+  800c44:	75 2b                	jne    800c71 <vprintfmt+0x631>
+    switch (lflag) {
+  800c46:	85 d2                	test   %edx,%edx
+  800c48:	74 56                	je     800ca0 <vprintfmt+0x660>
+  800c4a:	83 fa 01             	cmp    $0x1,%edx
+  800c4d:	74 7f                	je     800cce <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800c4f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c52:	83 f8 2f             	cmp    $0x2f,%eax
+  800c55:	0f 87 a2 00 00 00    	ja     800cfd <vprintfmt+0x6bd>
+  800c5b:	89 c2                	mov    %eax,%edx
+  800c5d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c61:	83 c0 08             	add    $0x8,%eax
+  800c64:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c67:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800c6a:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800c6f:	eb 8f                	jmp    800c00 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800c71:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c74:	83 f8 2f             	cmp    $0x2f,%eax
+  800c77:	77 19                	ja     800c92 <vprintfmt+0x652>
+  800c79:	89 c2                	mov    %eax,%edx
+  800c7b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c7f:	83 c0 08             	add    $0x8,%eax
+  800c82:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c85:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800c88:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800c8d:	e9 6e ff ff ff       	jmp    800c00 <vprintfmt+0x5c0>
+  800c92:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c96:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c9a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c9e:	eb e5                	jmp    800c85 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800ca0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ca3:	83 f8 2f             	cmp    $0x2f,%eax
+  800ca6:	77 18                	ja     800cc0 <vprintfmt+0x680>
+  800ca8:	89 c2                	mov    %eax,%edx
+  800caa:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800cae:	83 c0 08             	add    $0x8,%eax
+  800cb1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800cb4:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800cb6:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800cbb:	e9 40 ff ff ff       	jmp    800c00 <vprintfmt+0x5c0>
+  800cc0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800cc4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800cc8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ccc:	eb e6                	jmp    800cb4 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800cce:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800cd1:	83 f8 2f             	cmp    $0x2f,%eax
+  800cd4:	77 19                	ja     800cef <vprintfmt+0x6af>
+  800cd6:	89 c2                	mov    %eax,%edx
+  800cd8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800cdc:	83 c0 08             	add    $0x8,%eax
+  800cdf:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ce2:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800ce5:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800cea:	e9 11 ff ff ff       	jmp    800c00 <vprintfmt+0x5c0>
+  800cef:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800cf3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800cf7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800cfb:	eb e5                	jmp    800ce2 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800cfd:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d01:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d05:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d09:	e9 59 ff ff ff       	jmp    800c67 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800d0e:	4c 89 ee             	mov    %r13,%rsi
+  800d11:	bf 25 00 00 00       	mov    $0x25,%edi
+  800d16:	41 ff d6             	call   *%r14
+            break;
+  800d19:	e9 53 f9 ff ff       	jmp    800671 <vprintfmt+0x31>
+            putch('%', put_arg);
+  800d1e:	4c 89 ee             	mov    %r13,%rsi
+  800d21:	bf 25 00 00 00       	mov    $0x25,%edi
+  800d26:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800d29:	48 83 eb 01          	sub    $0x1,%rbx
+  800d2d:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800d31:	75 f6                	jne    800d29 <vprintfmt+0x6e9>
+  800d33:	e9 39 f9 ff ff       	jmp    800671 <vprintfmt+0x31>
+}
+  800d38:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800d3c:	5b                   	pop    %rbx
+  800d3d:	41 5c                	pop    %r12
+  800d3f:	41 5d                	pop    %r13
+  800d41:	41 5e                	pop    %r14
+  800d43:	41 5f                	pop    %r15
+  800d45:	5d                   	pop    %rbp
+  800d46:	c3                   	ret
+
+0000000000800d47 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800d47:	55                   	push   %rbp
+  800d48:	48 89 e5             	mov    %rsp,%rbp
+  800d4b:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800d4f:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800d53:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800d58:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800d5c:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800d63:	48 85 ff             	test   %rdi,%rdi
+  800d66:	74 2b                	je     800d93 <vsnprintf+0x4c>
+  800d68:	48 85 f6             	test   %rsi,%rsi
+  800d6b:	74 26                	je     800d93 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800d6d:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800d71:	48 bf eb 05 80 00 00 	movabs $0x8005eb,%rdi
+  800d78:	00 00 00 
+  800d7b:	48 b8 40 06 80 00 00 	movabs $0x800640,%rax
+  800d82:	00 00 00 
+  800d85:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800d87:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800d8b:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800d8e:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800d91:	c9                   	leave
+  800d92:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800d93:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800d98:	eb f7                	jmp    800d91 <vsnprintf+0x4a>
+
+0000000000800d9a <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800d9a:	55                   	push   %rbp
+  800d9b:	48 89 e5             	mov    %rsp,%rbp
+  800d9e:	48 83 ec 50          	sub    $0x50,%rsp
+  800da2:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800da6:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800daa:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800dae:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800db5:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800db9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800dbd:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800dc1:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800dc5:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800dc9:	48 b8 47 0d 80 00 00 	movabs $0x800d47,%rax
+  800dd0:	00 00 00 
+  800dd3:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800dd5:	c9                   	leave
+  800dd6:	c3                   	ret
+
+0000000000800dd7 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800dd7:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800dda:	74 10                	je     800dec <strlen+0x15>
+    size_t n = 0;
+  800ddc:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800de1:	48 83 c0 01          	add    $0x1,%rax
+  800de5:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800de9:	75 f6                	jne    800de1 <strlen+0xa>
+  800deb:	c3                   	ret
+    size_t n = 0;
+  800dec:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800df1:	c3                   	ret
+
+0000000000800df2 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800df2:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800df5:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800dfa:	48 85 f6             	test   %rsi,%rsi
+  800dfd:	74 11                	je     800e10 <strnlen+0x1e>
+  800dff:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800e03:	74 0c                	je     800e11 <strnlen+0x1f>
+  800e05:	48 83 c2 01          	add    $0x1,%rdx
+  800e09:	48 39 d0             	cmp    %rdx,%rax
+  800e0c:	75 f1                	jne    800dff <strnlen+0xd>
+  800e0e:	eb 04                	jmp    800e14 <strnlen+0x22>
+  800e10:	c3                   	ret
+  800e11:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800e14:	c3                   	ret
+
+0000000000800e15 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800e15:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800e18:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e1d:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800e21:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800e24:	48 83 c2 01          	add    $0x1,%rdx
+  800e28:	84 c9                	test   %cl,%cl
+  800e2a:	75 f1                	jne    800e1d <strcpy+0x8>
+        ;
+    return res;
+}
+  800e2c:	c3                   	ret
+
+0000000000800e2d <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800e2d:	55                   	push   %rbp
+  800e2e:	48 89 e5             	mov    %rsp,%rbp
+  800e31:	41 54                	push   %r12
+  800e33:	53                   	push   %rbx
+  800e34:	48 89 fb             	mov    %rdi,%rbx
+  800e37:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800e3a:	48 b8 d7 0d 80 00 00 	movabs $0x800dd7,%rax
+  800e41:	00 00 00 
+  800e44:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800e46:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800e4a:	4c 89 e6             	mov    %r12,%rsi
+  800e4d:	48 b8 15 0e 80 00 00 	movabs $0x800e15,%rax
+  800e54:	00 00 00 
+  800e57:	ff d0                	call   *%rax
+    return dst;
+}
+  800e59:	48 89 d8             	mov    %rbx,%rax
+  800e5c:	5b                   	pop    %rbx
+  800e5d:	41 5c                	pop    %r12
+  800e5f:	5d                   	pop    %rbp
+  800e60:	c3                   	ret
+
+0000000000800e61 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800e61:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800e64:	48 85 d2             	test   %rdx,%rdx
+  800e67:	74 1f                	je     800e88 <strncpy+0x27>
+  800e69:	48 01 fa             	add    %rdi,%rdx
+  800e6c:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800e6f:	48 83 c1 01          	add    $0x1,%rcx
+  800e73:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800e77:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800e7b:	41 80 f8 01          	cmp    $0x1,%r8b
+  800e7f:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800e83:	48 39 ca             	cmp    %rcx,%rdx
+  800e86:	75 e7                	jne    800e6f <strncpy+0xe>
+    }
+    return ret;
+}
+  800e88:	c3                   	ret
+
+0000000000800e89 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800e89:	48 89 f8             	mov    %rdi,%rax
+  800e8c:	48 85 d2             	test   %rdx,%rdx
+  800e8f:	74 24                	je     800eb5 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800e91:	48 83 ea 01          	sub    $0x1,%rdx
+  800e95:	74 1b                	je     800eb2 <strlcpy+0x29>
+  800e97:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800e9b:	0f b6 16             	movzbl (%rsi),%edx
+  800e9e:	84 d2                	test   %dl,%dl
+  800ea0:	74 10                	je     800eb2 <strlcpy+0x29>
+            *dst++ = *src++;
+  800ea2:	48 83 c6 01          	add    $0x1,%rsi
+  800ea6:	48 83 c0 01          	add    $0x1,%rax
+  800eaa:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800ead:	48 39 c8             	cmp    %rcx,%rax
+  800eb0:	75 e9                	jne    800e9b <strlcpy+0x12>
+        *dst = '\0';
+  800eb2:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800eb5:	48 29 f8             	sub    %rdi,%rax
+}
+  800eb8:	c3                   	ret
+
+0000000000800eb9 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800eb9:	0f b6 07             	movzbl (%rdi),%eax
+  800ebc:	84 c0                	test   %al,%al
+  800ebe:	74 13                	je     800ed3 <strcmp+0x1a>
+  800ec0:	38 06                	cmp    %al,(%rsi)
+  800ec2:	75 0f                	jne    800ed3 <strcmp+0x1a>
+  800ec4:	48 83 c7 01          	add    $0x1,%rdi
+  800ec8:	48 83 c6 01          	add    $0x1,%rsi
+  800ecc:	0f b6 07             	movzbl (%rdi),%eax
+  800ecf:	84 c0                	test   %al,%al
+  800ed1:	75 ed                	jne    800ec0 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800ed3:	0f b6 c0             	movzbl %al,%eax
+  800ed6:	0f b6 16             	movzbl (%rsi),%edx
+  800ed9:	29 d0                	sub    %edx,%eax
+}
+  800edb:	c3                   	ret
+
+0000000000800edc <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800edc:	48 85 d2             	test   %rdx,%rdx
+  800edf:	74 1f                	je     800f00 <strncmp+0x24>
+  800ee1:	0f b6 07             	movzbl (%rdi),%eax
+  800ee4:	84 c0                	test   %al,%al
+  800ee6:	74 1e                	je     800f06 <strncmp+0x2a>
+  800ee8:	3a 06                	cmp    (%rsi),%al
+  800eea:	75 1a                	jne    800f06 <strncmp+0x2a>
+  800eec:	48 83 c7 01          	add    $0x1,%rdi
+  800ef0:	48 83 c6 01          	add    $0x1,%rsi
+  800ef4:	48 83 ea 01          	sub    $0x1,%rdx
+  800ef8:	75 e7                	jne    800ee1 <strncmp+0x5>
+
+    if (!n) return 0;
+  800efa:	b8 00 00 00 00       	mov    $0x0,%eax
+  800eff:	c3                   	ret
+  800f00:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f05:	c3                   	ret
+  800f06:	48 85 d2             	test   %rdx,%rdx
+  800f09:	74 09                	je     800f14 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800f0b:	0f b6 07             	movzbl (%rdi),%eax
+  800f0e:	0f b6 16             	movzbl (%rsi),%edx
+  800f11:	29 d0                	sub    %edx,%eax
+  800f13:	c3                   	ret
+    if (!n) return 0;
+  800f14:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800f19:	c3                   	ret
+
+0000000000800f1a <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800f1a:	0f b6 17             	movzbl (%rdi),%edx
+  800f1d:	84 d2                	test   %dl,%dl
+  800f1f:	74 18                	je     800f39 <strchr+0x1f>
+        if (*str == c) {
+  800f21:	0f be d2             	movsbl %dl,%edx
+  800f24:	39 f2                	cmp    %esi,%edx
+  800f26:	74 17                	je     800f3f <strchr+0x25>
+    for (; *str; str++) {
+  800f28:	48 83 c7 01          	add    $0x1,%rdi
+  800f2c:	0f b6 17             	movzbl (%rdi),%edx
+  800f2f:	84 d2                	test   %dl,%dl
+  800f31:	75 ee                	jne    800f21 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800f33:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f38:	c3                   	ret
+  800f39:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f3e:	c3                   	ret
+  800f3f:	48 89 f8             	mov    %rdi,%rax
+}
+  800f42:	c3                   	ret
+
+0000000000800f43 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800f43:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800f46:	0f b6 17             	movzbl (%rdi),%edx
+  800f49:	84 d2                	test   %dl,%dl
+  800f4b:	74 13                	je     800f60 <strfind+0x1d>
+  800f4d:	0f be d2             	movsbl %dl,%edx
+  800f50:	39 f2                	cmp    %esi,%edx
+  800f52:	74 0b                	je     800f5f <strfind+0x1c>
+  800f54:	48 83 c0 01          	add    $0x1,%rax
+  800f58:	0f b6 10             	movzbl (%rax),%edx
+  800f5b:	84 d2                	test   %dl,%dl
+  800f5d:	75 ee                	jne    800f4d <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800f5f:	c3                   	ret
+  800f60:	c3                   	ret
+
+0000000000800f61 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800f61:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800f64:	48 89 f8             	mov    %rdi,%rax
+  800f67:	48 f7 d8             	neg    %rax
+  800f6a:	83 e0 07             	and    $0x7,%eax
+  800f6d:	49 89 d1             	mov    %rdx,%r9
+  800f70:	49 29 c1             	sub    %rax,%r9
+  800f73:	78 36                	js     800fab <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800f75:	40 0f b6 c6          	movzbl %sil,%eax
+  800f79:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800f80:	01 01 01 
+  800f83:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800f87:	40 f6 c7 07          	test   $0x7,%dil
+  800f8b:	75 38                	jne    800fc5 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800f8d:	4c 89 c9             	mov    %r9,%rcx
+  800f90:	48 c1 f9 03          	sar    $0x3,%rcx
+  800f94:	74 0c                	je     800fa2 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800f96:	fc                   	cld
+  800f97:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800f9a:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800f9e:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800fa2:	4d 85 c9             	test   %r9,%r9
+  800fa5:	75 45                	jne    800fec <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800fa7:	4c 89 c0             	mov    %r8,%rax
+  800faa:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800fab:	48 85 d2             	test   %rdx,%rdx
+  800fae:	74 f7                	je     800fa7 <memset+0x46>
+  800fb0:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800fb3:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800fb6:	48 83 c0 01          	add    $0x1,%rax
+  800fba:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  800fbe:	48 39 c2             	cmp    %rax,%rdx
+  800fc1:	75 f3                	jne    800fb6 <memset+0x55>
+  800fc3:	eb e2                	jmp    800fa7 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  800fc5:	40 f6 c7 01          	test   $0x1,%dil
+  800fc9:	74 06                	je     800fd1 <memset+0x70>
+  800fcb:	88 07                	mov    %al,(%rdi)
+  800fcd:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800fd1:	40 f6 c7 02          	test   $0x2,%dil
+  800fd5:	74 07                	je     800fde <memset+0x7d>
+  800fd7:	66 89 07             	mov    %ax,(%rdi)
+  800fda:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800fde:	40 f6 c7 04          	test   $0x4,%dil
+  800fe2:	74 a9                	je     800f8d <memset+0x2c>
+  800fe4:	89 07                	mov    %eax,(%rdi)
+  800fe6:	48 83 c7 04          	add    $0x4,%rdi
+  800fea:	eb a1                	jmp    800f8d <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800fec:	41 f6 c1 04          	test   $0x4,%r9b
+  800ff0:	74 06                	je     800ff8 <memset+0x97>
+  800ff2:	89 07                	mov    %eax,(%rdi)
+  800ff4:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800ff8:	41 f6 c1 02          	test   $0x2,%r9b
+  800ffc:	74 07                	je     801005 <memset+0xa4>
+  800ffe:	66 89 07             	mov    %ax,(%rdi)
+  801001:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  801005:	41 f6 c1 01          	test   $0x1,%r9b
+  801009:	74 9c                	je     800fa7 <memset+0x46>
+  80100b:	88 07                	mov    %al,(%rdi)
+  80100d:	eb 98                	jmp    800fa7 <memset+0x46>
+
+000000000080100f <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  80100f:	48 89 f8             	mov    %rdi,%rax
+  801012:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  801015:	48 39 fe             	cmp    %rdi,%rsi
+  801018:	73 3b                	jae    801055 <memmove+0x46>
+  80101a:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  80101e:	48 39 d7             	cmp    %rdx,%rdi
+  801021:	73 32                	jae    801055 <memmove+0x46>
+        s += n;
+        d += n;
+  801023:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  801027:	48 89 d6             	mov    %rdx,%rsi
+  80102a:	48 09 fe             	or     %rdi,%rsi
+  80102d:	48 09 ce             	or     %rcx,%rsi
+  801030:	40 f6 c6 07          	test   $0x7,%sil
+  801034:	75 12                	jne    801048 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  801036:	48 83 ef 08          	sub    $0x8,%rdi
+  80103a:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  80103e:	48 c1 e9 03          	shr    $0x3,%rcx
+  801042:	fd                   	std
+  801043:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  801046:	fc                   	cld
+  801047:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  801048:	48 83 ef 01          	sub    $0x1,%rdi
+  80104c:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  801050:	fd                   	std
+  801051:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  801053:	eb f1                	jmp    801046 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  801055:	48 89 f2             	mov    %rsi,%rdx
+  801058:	48 09 c2             	or     %rax,%rdx
+  80105b:	48 09 ca             	or     %rcx,%rdx
+  80105e:	f6 c2 07             	test   $0x7,%dl
+  801061:	75 0c                	jne    80106f <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  801063:	48 c1 e9 03          	shr    $0x3,%rcx
+  801067:	48 89 c7             	mov    %rax,%rdi
+  80106a:	fc                   	cld
+  80106b:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  80106e:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  80106f:	48 89 c7             	mov    %rax,%rdi
+  801072:	fc                   	cld
+  801073:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  801075:	c3                   	ret
+
+0000000000801076 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  801076:	55                   	push   %rbp
+  801077:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  80107a:	48 b8 0f 10 80 00 00 	movabs $0x80100f,%rax
+  801081:	00 00 00 
+  801084:	ff d0                	call   *%rax
+}
+  801086:	5d                   	pop    %rbp
+  801087:	c3                   	ret
+
+0000000000801088 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  801088:	55                   	push   %rbp
+  801089:	48 89 e5             	mov    %rsp,%rbp
+  80108c:	41 57                	push   %r15
+  80108e:	41 56                	push   %r14
+  801090:	41 55                	push   %r13
+  801092:	41 54                	push   %r12
+  801094:	53                   	push   %rbx
+  801095:	48 83 ec 08          	sub    $0x8,%rsp
+  801099:	49 89 fe             	mov    %rdi,%r14
+  80109c:	49 89 f7             	mov    %rsi,%r15
+  80109f:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  8010a2:	48 89 f7             	mov    %rsi,%rdi
+  8010a5:	48 b8 d7 0d 80 00 00 	movabs $0x800dd7,%rax
+  8010ac:	00 00 00 
+  8010af:	ff d0                	call   *%rax
+  8010b1:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  8010b4:	48 89 de             	mov    %rbx,%rsi
+  8010b7:	4c 89 f7             	mov    %r14,%rdi
+  8010ba:	48 b8 f2 0d 80 00 00 	movabs $0x800df2,%rax
+  8010c1:	00 00 00 
+  8010c4:	ff d0                	call   *%rax
+  8010c6:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  8010c9:	48 39 c3             	cmp    %rax,%rbx
+  8010cc:	74 36                	je     801104 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  8010ce:	48 89 d8             	mov    %rbx,%rax
+  8010d1:	4c 29 e8             	sub    %r13,%rax
+  8010d4:	49 39 c4             	cmp    %rax,%r12
+  8010d7:	73 31                	jae    80110a <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  8010d9:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  8010de:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8010e2:	4c 89 fe             	mov    %r15,%rsi
+  8010e5:	48 b8 76 10 80 00 00 	movabs $0x801076,%rax
+  8010ec:	00 00 00 
+  8010ef:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  8010f1:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  8010f5:	48 83 c4 08          	add    $0x8,%rsp
+  8010f9:	5b                   	pop    %rbx
+  8010fa:	41 5c                	pop    %r12
+  8010fc:	41 5d                	pop    %r13
+  8010fe:	41 5e                	pop    %r14
+  801100:	41 5f                	pop    %r15
+  801102:	5d                   	pop    %rbp
+  801103:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  801104:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  801108:	eb eb                	jmp    8010f5 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  80110a:	48 83 eb 01          	sub    $0x1,%rbx
+  80110e:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  801112:	48 89 da             	mov    %rbx,%rdx
+  801115:	4c 89 fe             	mov    %r15,%rsi
+  801118:	48 b8 76 10 80 00 00 	movabs $0x801076,%rax
+  80111f:	00 00 00 
+  801122:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  801124:	49 01 de             	add    %rbx,%r14
+  801127:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  80112c:	eb c3                	jmp    8010f1 <strlcat+0x69>
+
+000000000080112e <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  80112e:	48 85 d2             	test   %rdx,%rdx
+  801131:	74 2d                	je     801160 <memcmp+0x32>
+  801133:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  801138:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  80113c:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  801141:	44 38 c1             	cmp    %r8b,%cl
+  801144:	75 0f                	jne    801155 <memcmp+0x27>
+    while (n-- > 0) {
+  801146:	48 83 c0 01          	add    $0x1,%rax
+  80114a:	48 39 c2             	cmp    %rax,%rdx
+  80114d:	75 e9                	jne    801138 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  80114f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801154:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  801155:	0f b6 c1             	movzbl %cl,%eax
+  801158:	45 0f b6 c0          	movzbl %r8b,%r8d
+  80115c:	44 29 c0             	sub    %r8d,%eax
+  80115f:	c3                   	ret
+    return 0;
+  801160:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801165:	c3                   	ret
+
+0000000000801166 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  801166:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  80116a:	48 39 c7             	cmp    %rax,%rdi
+  80116d:	73 0f                	jae    80117e <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  80116f:	40 38 37             	cmp    %sil,(%rdi)
+  801172:	74 0e                	je     801182 <memfind+0x1c>
+    for (; src < end; src++) {
+  801174:	48 83 c7 01          	add    $0x1,%rdi
+  801178:	48 39 f8             	cmp    %rdi,%rax
+  80117b:	75 f2                	jne    80116f <memfind+0x9>
+  80117d:	c3                   	ret
+  80117e:	48 89 f8             	mov    %rdi,%rax
+  801181:	c3                   	ret
+  801182:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  801185:	c3                   	ret
+
+0000000000801186 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  801186:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  801189:	0f b6 37             	movzbl (%rdi),%esi
+  80118c:	40 80 fe 20          	cmp    $0x20,%sil
+  801190:	74 06                	je     801198 <strtol+0x12>
+  801192:	40 80 fe 09          	cmp    $0x9,%sil
+  801196:	75 13                	jne    8011ab <strtol+0x25>
+  801198:	48 83 c7 01          	add    $0x1,%rdi
+  80119c:	0f b6 37             	movzbl (%rdi),%esi
+  80119f:	40 80 fe 20          	cmp    $0x20,%sil
+  8011a3:	74 f3                	je     801198 <strtol+0x12>
+  8011a5:	40 80 fe 09          	cmp    $0x9,%sil
+  8011a9:	74 ed                	je     801198 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  8011ab:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  8011ae:	83 e0 fd             	and    $0xfffffffd,%eax
+  8011b1:	3c 01                	cmp    $0x1,%al
+  8011b3:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8011b7:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  8011bd:	75 0f                	jne    8011ce <strtol+0x48>
+  8011bf:	80 3f 30             	cmpb   $0x30,(%rdi)
+  8011c2:	74 14                	je     8011d8 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  8011c4:	85 d2                	test   %edx,%edx
+  8011c6:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8011cb:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  8011ce:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  8011d3:	4c 63 ca             	movslq %edx,%r9
+  8011d6:	eb 36                	jmp    80120e <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8011d8:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  8011dc:	74 0f                	je     8011ed <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  8011de:	85 d2                	test   %edx,%edx
+  8011e0:	75 ec                	jne    8011ce <strtol+0x48>
+        s++;
+  8011e2:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  8011e6:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  8011eb:	eb e1                	jmp    8011ce <strtol+0x48>
+        s += 2;
+  8011ed:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  8011f1:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  8011f6:	eb d6                	jmp    8011ce <strtol+0x48>
+            dig -= '0';
+  8011f8:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  8011fb:	44 0f b6 c1          	movzbl %cl,%r8d
+  8011ff:	41 39 d0             	cmp    %edx,%r8d
+  801202:	7d 21                	jge    801225 <strtol+0x9f>
+        val = val * base + dig;
+  801204:	49 0f af c1          	imul   %r9,%rax
+  801208:	0f b6 c9             	movzbl %cl,%ecx
+  80120b:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  80120e:	48 83 c7 01          	add    $0x1,%rdi
+  801212:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  801216:	80 f9 39             	cmp    $0x39,%cl
+  801219:	76 dd                	jbe    8011f8 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  80121b:	80 f9 7b             	cmp    $0x7b,%cl
+  80121e:	77 05                	ja     801225 <strtol+0x9f>
+            dig -= 'a' - 10;
+  801220:	83 e9 57             	sub    $0x57,%ecx
+  801223:	eb d6                	jmp    8011fb <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  801225:	4d 85 d2             	test   %r10,%r10
+  801228:	74 03                	je     80122d <strtol+0xa7>
+  80122a:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  80122d:	48 89 c2             	mov    %rax,%rdx
+  801230:	48 f7 da             	neg    %rdx
+  801233:	40 80 fe 2d          	cmp    $0x2d,%sil
+  801237:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  80123b:	c3                   	ret
+
+000000000080123c <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  80123c:	55                   	push   %rbp
+  80123d:	48 89 e5             	mov    %rsp,%rbp
+  801240:	53                   	push   %rbx
+  801241:	48 89 fa             	mov    %rdi,%rdx
+  801244:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801247:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80124c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801251:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801256:	be 00 00 00 00       	mov    $0x0,%esi
+  80125b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801261:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  801263:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801267:	c9                   	leave
+  801268:	c3                   	ret
+
+0000000000801269 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  801269:	55                   	push   %rbp
+  80126a:	48 89 e5             	mov    %rsp,%rbp
+  80126d:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80126e:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801273:	ba 00 00 00 00       	mov    $0x0,%edx
+  801278:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80127d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801282:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801287:	be 00 00 00 00       	mov    $0x0,%esi
+  80128c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801292:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  801294:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801298:	c9                   	leave
+  801299:	c3                   	ret
+
+000000000080129a <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  80129a:	55                   	push   %rbp
+  80129b:	48 89 e5             	mov    %rsp,%rbp
+  80129e:	53                   	push   %rbx
+  80129f:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  8012a3:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8012a6:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8012ab:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8012b0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012b5:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012ba:	be 00 00 00 00       	mov    $0x0,%esi
+  8012bf:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8012c5:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8012c7:	48 85 c0             	test   %rax,%rax
+  8012ca:	7f 06                	jg     8012d2 <sys_env_destroy+0x38>
+}
+  8012cc:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012d0:	c9                   	leave
+  8012d1:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8012d2:	49 89 c0             	mov    %rax,%r8
+  8012d5:	b9 03 00 00 00       	mov    $0x3,%ecx
+  8012da:	48 ba f0 36 80 00 00 	movabs $0x8036f0,%rdx
+  8012e1:	00 00 00 
+  8012e4:	be 26 00 00 00       	mov    $0x26,%esi
+  8012e9:	48 bf 0f 37 80 00 00 	movabs $0x80370f,%rdi
+  8012f0:	00 00 00 
+  8012f3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012f8:	49 b9 a0 03 80 00 00 	movabs $0x8003a0,%r9
+  8012ff:	00 00 00 
+  801302:	41 ff d1             	call   *%r9
+
+0000000000801305 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  801305:	55                   	push   %rbp
+  801306:	48 89 e5             	mov    %rsp,%rbp
+  801309:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80130a:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80130f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801314:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801319:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80131e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801323:	be 00 00 00 00       	mov    $0x0,%esi
+  801328:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80132e:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  801330:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801334:	c9                   	leave
+  801335:	c3                   	ret
+
+0000000000801336 <sys_yield>:
+
+void
+sys_yield(void) {
+  801336:	55                   	push   %rbp
+  801337:	48 89 e5             	mov    %rsp,%rbp
+  80133a:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80133b:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801340:	ba 00 00 00 00       	mov    $0x0,%edx
+  801345:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80134a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80134f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801354:	be 00 00 00 00       	mov    $0x0,%esi
+  801359:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80135f:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  801361:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801365:	c9                   	leave
+  801366:	c3                   	ret
+
+0000000000801367 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  801367:	55                   	push   %rbp
+  801368:	48 89 e5             	mov    %rsp,%rbp
+  80136b:	53                   	push   %rbx
+  80136c:	48 89 fa             	mov    %rdi,%rdx
+  80136f:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801372:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801377:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  80137e:	00 00 00 
+  801381:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801386:	be 00 00 00 00       	mov    $0x0,%esi
+  80138b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801391:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  801393:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801397:	c9                   	leave
+  801398:	c3                   	ret
+
+0000000000801399 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  801399:	55                   	push   %rbp
+  80139a:	48 89 e5             	mov    %rsp,%rbp
+  80139d:	53                   	push   %rbx
+  80139e:	49 89 f8             	mov    %rdi,%r8
+  8013a1:	48 89 d3             	mov    %rdx,%rbx
+  8013a4:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8013a7:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8013ac:	4c 89 c2             	mov    %r8,%rdx
+  8013af:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013b2:	be 00 00 00 00       	mov    $0x0,%esi
+  8013b7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013bd:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  8013bf:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013c3:	c9                   	leave
+  8013c4:	c3                   	ret
+
+00000000008013c5 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  8013c5:	55                   	push   %rbp
+  8013c6:	48 89 e5             	mov    %rsp,%rbp
+  8013c9:	53                   	push   %rbx
+  8013ca:	48 83 ec 08          	sub    $0x8,%rsp
+  8013ce:	89 f8                	mov    %edi,%eax
+  8013d0:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  8013d3:	48 63 f9             	movslq %ecx,%rdi
+  8013d6:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8013d9:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8013de:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013e1:	be 00 00 00 00       	mov    $0x0,%esi
+  8013e6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013ec:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8013ee:	48 85 c0             	test   %rax,%rax
+  8013f1:	7f 06                	jg     8013f9 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  8013f3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013f7:	c9                   	leave
+  8013f8:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8013f9:	49 89 c0             	mov    %rax,%r8
+  8013fc:	b9 04 00 00 00       	mov    $0x4,%ecx
+  801401:	48 ba f0 36 80 00 00 	movabs $0x8036f0,%rdx
+  801408:	00 00 00 
+  80140b:	be 26 00 00 00       	mov    $0x26,%esi
+  801410:	48 bf 0f 37 80 00 00 	movabs $0x80370f,%rdi
+  801417:	00 00 00 
+  80141a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80141f:	49 b9 a0 03 80 00 00 	movabs $0x8003a0,%r9
+  801426:	00 00 00 
+  801429:	41 ff d1             	call   *%r9
+
+000000000080142c <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  80142c:	55                   	push   %rbp
+  80142d:	48 89 e5             	mov    %rsp,%rbp
+  801430:	53                   	push   %rbx
+  801431:	48 83 ec 08          	sub    $0x8,%rsp
+  801435:	89 f8                	mov    %edi,%eax
+  801437:	49 89 f2             	mov    %rsi,%r10
+  80143a:	48 89 cf             	mov    %rcx,%rdi
+  80143d:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  801440:	48 63 da             	movslq %edx,%rbx
+  801443:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801446:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80144b:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80144e:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  801451:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801453:	48 85 c0             	test   %rax,%rax
+  801456:	7f 06                	jg     80145e <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  801458:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80145c:	c9                   	leave
+  80145d:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80145e:	49 89 c0             	mov    %rax,%r8
+  801461:	b9 05 00 00 00       	mov    $0x5,%ecx
+  801466:	48 ba f0 36 80 00 00 	movabs $0x8036f0,%rdx
+  80146d:	00 00 00 
+  801470:	be 26 00 00 00       	mov    $0x26,%esi
+  801475:	48 bf 0f 37 80 00 00 	movabs $0x80370f,%rdi
+  80147c:	00 00 00 
+  80147f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801484:	49 b9 a0 03 80 00 00 	movabs $0x8003a0,%r9
+  80148b:	00 00 00 
+  80148e:	41 ff d1             	call   *%r9
+
+0000000000801491 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  801491:	55                   	push   %rbp
+  801492:	48 89 e5             	mov    %rsp,%rbp
+  801495:	53                   	push   %rbx
+  801496:	48 83 ec 08          	sub    $0x8,%rsp
+  80149a:	48 89 f1             	mov    %rsi,%rcx
+  80149d:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  8014a0:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8014a3:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8014a8:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014ad:	be 00 00 00 00       	mov    $0x0,%esi
+  8014b2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014b8:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8014ba:	48 85 c0             	test   %rax,%rax
+  8014bd:	7f 06                	jg     8014c5 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  8014bf:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014c3:	c9                   	leave
+  8014c4:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8014c5:	49 89 c0             	mov    %rax,%r8
+  8014c8:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8014cd:	48 ba f0 36 80 00 00 	movabs $0x8036f0,%rdx
+  8014d4:	00 00 00 
+  8014d7:	be 26 00 00 00       	mov    $0x26,%esi
+  8014dc:	48 bf 0f 37 80 00 00 	movabs $0x80370f,%rdi
+  8014e3:	00 00 00 
+  8014e6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014eb:	49 b9 a0 03 80 00 00 	movabs $0x8003a0,%r9
+  8014f2:	00 00 00 
+  8014f5:	41 ff d1             	call   *%r9
+
+00000000008014f8 <sys_region_batch>:
+
+int
+sys_region_batch(const struct RegionOp *ops, size_t count) {
+  8014f8:	55                   	push   %rbp
+  8014f9:	48 89 e5             	mov    %rsp,%rbp
+  8014fc:	53                   	push   %rbx
+  8014fd:	48 83 ec 08          	sub    $0x8,%rsp
+  801501:	48 89 fa             	mov    %rdi,%rdx
+  801504:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801507:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80150c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801511:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801516:	be 00 00 00 00       	mov    $0x0,%esi
+  80151b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801521:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801523:	48 85 c0             	test   %rax,%rax
+  801526:	7f 06                	jg     80152e <sys_region_batch+0x36>
+        else
+            platform_asan_unpoison(va, ops[i].size);
+    }
+#endif
+    return res;
+}
+  801528:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80152c:	c9                   	leave
+  80152d:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80152e:	49 89 c0             	mov    %rax,%r8
+  801531:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  801536:	48 ba f0 36 80 00 00 	movabs $0x8036f0,%rdx
+  80153d:	00 00 00 
+  801540:	be 26 00 00 00       	mov    $0x26,%esi
+  801545:	48 bf 0f 37 80 00 00 	movabs $0x80370f,%rdi
+  80154c:	00 00 00 
+  80154f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801554:	49 b9 a0 03 80 00 00 	movabs $0x8003a0,%r9
+  80155b:	00 00 00 
+  80155e:	41 ff d1             	call   *%r9
+
+0000000000801561 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  801561:	55                   	push   %rbp
+  801562:	48 89 e5             	mov    %rsp,%rbp
+  801565:	53                   	push   %rbx
+  801566:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  80156a:	48 63 ce             	movslq %esi,%rcx
+  80156d:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801570:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801575:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80157a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80157f:	be 00 00 00 00       	mov    $0x0,%esi
+  801584:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80158a:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80158c:	48 85 c0             	test   %rax,%rax
+  80158f:	7f 06                	jg     801597 <sys_env_set_status+0x36>
+}
+  801591:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801595:	c9                   	leave
+  801596:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801597:	49 89 c0             	mov    %rax,%r8
+  80159a:	b9 09 00 00 00       	mov    $0x9,%ecx
+  80159f:	48 ba f0 36 80 00 00 	movabs $0x8036f0,%rdx
+  8015a6:	00 00 00 
+  8015a9:	be 26 00 00 00       	mov    $0x26,%esi
+  8015ae:	48 bf 0f 37 80 00 00 	movabs $0x80370f,%rdi
+  8015b5:	00 00 00 
+  8015b8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015bd:	49 b9 a0 03 80 00 00 	movabs $0x8003a0,%r9
+  8015c4:	00 00 00 
+  8015c7:	41 ff d1             	call   *%r9
+
+00000000008015ca <sys_env_set_weight>:
+
+int
+sys_env_set_weight(envid_t envid, uint32_t weight) {
+  8015ca:	55                   	push   %rbp
+  8015cb:	48 89 e5             	mov    %rsp,%rbp
+  8015ce:	53                   	push   %rbx
+  8015cf:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_weight, 1, envid, weight, 0, 0, 0, 0);
+  8015d3:	89 f1                	mov    %esi,%ecx
+  8015d5:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8015d8:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8015dd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015e2:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015e7:	be 00 00 00 00       	mov    $0x0,%esi
+  8015ec:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015f2:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8015f4:	48 85 c0             	test   %rax,%rax
+  8015f7:	7f 06                	jg     8015ff <sys_env_set_weight+0x35>
+}
+  8015f9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015fd:	c9                   	leave
+  8015fe:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8015ff:	49 89 c0             	mov    %rax,%r8
+  801602:	b9 10 00 00 00       	mov    $0x10,%ecx
+  801607:	48 ba f0 36 80 00 00 	movabs $0x8036f0,%rdx
+  80160e:	00 00 00 
+  801611:	be 26 00 00 00       	mov    $0x26,%esi
+  801616:	48 bf 0f 37 80 00 00 	movabs $0x80370f,%rdi
+  80161d:	00 00 00 
+  801620:	b8 00 00 00 00       	mov    $0x0,%eax
+  801625:	49 b9 a0 03 80 00 00 	movabs $0x8003a0,%r9
+  80162c:	00 00 00 
+  80162f:	41 ff d1             	call   *%r9
+
+0000000000801632 <sys_env_set_rt>:
+
+int
+sys_env_set_rt(envid_t envid, uint64_t period, uint64_t budget, uint64_t deadline) {
+  801632:	55                   	push   %rbp
+  801633:	48 89 e5             	mov    %rsp,%rbp
+  801636:	53                   	push   %rbx
+  801637:	48 83 ec 08          	sub    $0x8,%rsp
+  80163b:	89 f8                	mov    %edi,%eax
+  80163d:	48 89 d3             	mov    %rdx,%rbx
+  801640:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_env_set_rt, 1, envid, period, budget, deadline, 0, 0);
+  801643:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801646:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80164b:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80164e:	be 00 00 00 00       	mov    $0x0,%esi
+  801653:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801659:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80165b:	48 85 c0             	test   %rax,%rax
+  80165e:	7f 06                	jg     801666 <sys_env_set_rt+0x34>
+}
+  801660:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801664:	c9                   	leave
+  801665:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801666:	49 89 c0             	mov    %rax,%r8
+  801669:	b9 11 00 00 00       	mov    $0x11,%ecx
+  80166e:	48 ba f0 36 80 00 00 	movabs $0x8036f0,%rdx
+  801675:	00 00 00 
+  801678:	be 26 00 00 00       	mov    $0x26,%esi
+  80167d:	48 bf 0f 37 80 00 00 	movabs $0x80370f,%rdi
+  801684:	00 00 00 
+  801687:	b8 00 00 00 00       	mov    $0x0,%eax
+  80168c:	49 b9 a0 03 80 00 00 	movabs $0x8003a0,%r9
+  801693:	00 00 00 
+  801696:	41 ff d1             	call   *%r9
+
+0000000000801699 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  801699:	55                   	push   %rbp
+  80169a:	48 89 e5             	mov    %rsp,%rbp
+  80169d:	53                   	push   %rbx
+  80169e:	48 83 ec 08          	sub    $0x8,%rsp
+  8016a2:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  8016a5:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8016a8:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8016ad:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016b2:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8016b7:	be 00 00 00 00       	mov    $0x0,%esi
+  8016bc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8016c2:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8016c4:	48 85 c0             	test   %rax,%rax
+  8016c7:	7f 06                	jg     8016cf <sys_env_set_trapframe+0x36>
+}
+  8016c9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8016cd:	c9                   	leave
+  8016ce:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8016cf:	49 89 c0             	mov    %rax,%r8
+  8016d2:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  8016d7:	48 ba f0 36 80 00 00 	movabs $0x8036f0,%rdx
+  8016de:	00 00 00 
+  8016e1:	be 26 00 00 00       	mov    $0x26,%esi
+  8016e6:	48 bf 0f 37 80 00 00 	movabs $0x80370f,%rdi
+  8016ed:	00 00 00 
+  8016f0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016f5:	49 b9 a0 03 80 00 00 	movabs $0x8003a0,%r9
+  8016fc:	00 00 00 
+  8016ff:	41 ff d1             	call   *%r9
+
+0000000000801702 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  801702:	55                   	push   %rbp
+  801703:	48 89 e5             	mov    %rsp,%rbp
+  801706:	53                   	push   %rbx
+  801707:	48 83 ec 08          	sub    $0x8,%rsp
+  80170b:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  80170e:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801711:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801716:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80171b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801720:	be 00 00 00 00       	mov    $0x0,%esi
+  801725:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80172b:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80172d:	48 85 c0             	test   %rax,%rax
+  801730:	7f 06                	jg     801738 <sys_env_set_pgfault_upcall+0x36>
+}
+  801732:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801736:	c9                   	leave
+  801737:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801738:	49 89 c0             	mov    %rax,%r8
+  80173b:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  801740:	48 ba f0 36 80 00 00 	movabs $0x8036f0,%rdx
+  801747:	00 00 00 
+  80174a:	be 26 00 00 00       	mov    $0x26,%esi
+  80174f:	48 bf 0f 37 80 00 00 	movabs $0x80370f,%rdi
+  801756:	00 00 00 
+  801759:	b8 00 00 00 00       	mov    $0x0,%eax
+  80175e:	49 b9 a0 03 80 00 00 	movabs $0x8003a0,%r9
+  801765:	00 00 00 
+  801768:	41 ff d1             	call   *%r9
+
+000000000080176b <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  80176b:	55                   	push   %rbp
+  80176c:	48 89 e5             	mov    %rsp,%rbp
+  80176f:	53                   	push   %rbx
+  801770:	89 f8                	mov    %edi,%eax
+  801772:	49 89 f1             	mov    %rsi,%r9
+  801775:	48 89 d3             	mov    %rdx,%rbx
+  801778:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  80177b:	49 63 f0             	movslq %r8d,%rsi
+  80177e:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801781:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801786:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801789:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80178f:	cd 30                	int    $0x30
+}
+  801791:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801795:	c9                   	leave
+  801796:	c3                   	ret
+
+0000000000801797 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  801797:	55                   	push   %rbp
+  801798:	48 89 e5             	mov    %rsp,%rbp
+  80179b:	53                   	push   %rbx
+  80179c:	48 83 ec 08          	sub    $0x8,%rsp
+  8017a0:	48 89 fa             	mov    %rdi,%rdx
+  8017a3:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8017a6:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8017ab:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017b0:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8017b5:	be 00 00 00 00       	mov    $0x0,%esi
+  8017ba:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8017c0:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8017c2:	48 85 c0             	test   %rax,%rax
+  8017c5:	7f 06                	jg     8017cd <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8017c7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8017cb:	c9                   	leave
+  8017cc:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8017cd:	49 89 c0             	mov    %rax,%r8
+  8017d0:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  8017d5:	48 ba f0 36 80 00 00 	movabs $0x8036f0,%rdx
+  8017dc:	00 00 00 
+  8017df:	be 26 00 00 00       	mov    $0x26,%esi
+  8017e4:	48 bf 0f 37 80 00 00 	movabs $0x80370f,%rdi
+  8017eb:	00 00 00 
+  8017ee:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017f3:	49 b9 a0 03 80 00 00 	movabs $0x8003a0,%r9
+  8017fa:	00 00 00 
+  8017fd:	41 ff d1             	call   *%r9
+
+0000000000801800 <fork>:
+ * Hint:
+ *   Use sys_map_region, it can perform address space copying in one call
+ *   Remember to fix "thisenv" in the child process.
+ */
+envid_t
+fork(void) {
+  801800:	55                   	push   %rbp
+  801801:	48 89 e5             	mov    %rsp,%rbp
+  801804:	41 55                	push   %r13
+  801806:	41 54                	push   %r12
+  801808:	53                   	push   %rbx
+  801809:	48 83 ec 08          	sub    $0x8,%rsp
+
+/* This must be inlined. Exercise for reader: why? */
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+    envid_t ret;
+    asm volatile("int %2"
+  80180d:	b8 08 00 00 00       	mov    $0x8,%eax
+  801812:	cd 30                	int    $0x30
+  801814:	41 89 c5             	mov    %eax,%r13d
+    // LAB 9: Your code here
+
+    envid_t child_id = sys_exofork();
+    if (child_id < 0) {
+  801817:	85 c0                	test   %eax,%eax
+  801819:	0f 88 ae 00 00 00    	js     8018cd <fork+0xcd>
+  80181f:	89 c3                	mov    %eax,%ebx
+        return child_id;
+    }
+    if (child_id == 0) {
+  801821:	0f 84 b4 00 00 00    	je     8018db <fork+0xdb>
+        thisenv = &envs[ENVX(sys_getenvid())];
+        return 0;
+    }
+    int res = sys_map_region(0, NULL, child_id, NULL, MAX_USER_ADDRESS, PROT_ALL | PROT_LAZY | PROT_COMBINE);
+  801827:	41 b9 df 01 00 00    	mov    $0x1df,%r9d
+  80182d:	49 b8 00 00 00 00 80 	movabs $0x8000000000,%r8
+  801834:	00 00 00 
+  801837:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80183c:	89 c2                	mov    %eax,%edx
+  80183e:	be 00 00 00 00       	mov    $0x0,%esi
+  801843:	bf 00 00 00 00       	mov    $0x0,%edi
+  801848:	48 b8 2c 14 80 00 00 	movabs $0x80142c,%rax
+  80184f:	00 00 00 
+  801852:	ff d0                	call   *%rax
+  801854:	41 89 c4             	mov    %eax,%r12d
+    if (res < 0) {
+  801857:	85 c0                	test   %eax,%eax
+  801859:	78 5d                	js     8018b8 <fork+0xb8>
+        goto error;
+    }
+    res = sys_env_set_pgfault_upcall(child_id, envs[ENVX(sys_getenvid())].env_pgfault_upcall);
+  80185b:	48 b8 05 13 80 00 00 	movabs $0x801305,%rax
+  801862:	00 00 00 
+  801865:	ff d0                	call   *%rax
+  801867:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80186c:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+  801873:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  80187a:	00 00 00 
+  80187d:	48 01 d0             	add    %rdx,%rax
+  801880:	48 8b b0 88 01 00 00 	mov    0x188(%rax),%rsi
+  801887:	44 89 ef             	mov    %r13d,%edi
+  80188a:	48 b8 02 17 80 00 00 	movabs $0x801702,%rax
+  801891:	00 00 00 
+  801894:	ff d0                	call   *%rax
+  801896:	41 89 c4             	mov    %eax,%r12d
+    if (res < 0) {
+  801899:	85 c0                	test   %eax,%eax
+  80189b:	78 1b                	js     8018b8 <fork+0xb8>
+        goto error;
+    }
+    res = sys_env_set_status(child_id, ENV_RUNNABLE);
+  80189d:	be 02 00 00 00       	mov    $0x2,%esi
+  8018a2:	44 89 ef             	mov    %r13d,%edi
+  8018a5:	48 b8 61 15 80 00 00 	movabs $0x801561,%rax
+  8018ac:	00 00 00 
+  8018af:	ff d0                	call   *%rax
+  8018b1:	41 89 c4             	mov    %eax,%r12d
+    if (res < 0) {
+  8018b4:	85 c0                	test   %eax,%eax
+  8018b6:	79 15                	jns    8018cd <fork+0xcd>
+        goto error;
+    }
+    return child_id;
+error:
+    ;
+    int res2 = sys_env_destroy(child_id);
+  8018b8:	89 df                	mov    %ebx,%edi
+  8018ba:	48 b8 9a 12 80 00 00 	movabs $0x80129a,%rax
+  8018c1:	00 00 00 
+  8018c4:	ff d0                	call   *%rax
+    if (res2 < 0) {
+  8018c6:	85 c0                	test   %eax,%eax
+  8018c8:	78 42                	js     80190c <fork+0x10c>
+        panic("Fork double fault");
+    }
+    return res;
+  8018ca:	45 89 e5             	mov    %r12d,%r13d
+}
+  8018cd:	44 89 e8             	mov    %r13d,%eax
+  8018d0:	48 83 c4 08          	add    $0x8,%rsp
+  8018d4:	5b                   	pop    %rbx
+  8018d5:	41 5c                	pop    %r12
+  8018d7:	41 5d                	pop    %r13
+  8018d9:	5d                   	pop    %rbp
+  8018da:	c3                   	ret
+        thisenv = &envs[ENVX(sys_getenvid())];
+  8018db:	48 b8 05 13 80 00 00 	movabs $0x801305,%rax
+  8018e2:	00 00 00 
+  8018e5:	ff d0                	call   *%rax
+  8018e7:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8018ec:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+  8018f3:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8018fa:	00 00 00 
+  8018fd:	48 01 d0             	add    %rdx,%rax
+  801900:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  801907:	00 00 00 
+        return 0;
+  80190a:	eb c1                	jmp    8018cd <fork+0xcd>
+        panic("Fork double fault");
+  80190c:	48 ba 1d 37 80 00 00 	movabs $0x80371d,%rdx
+  801913:	00 00 00 
+  801916:	be 2f 00 00 00       	mov    $0x2f,%esi
+  80191b:	48 bf 2f 37 80 00 00 	movabs $0x80372f,%rdi
+  801922:	00 00 00 
+  801925:	b8 00 00 00 00       	mov    $0x0,%eax
+  80192a:	48 b9 a0 03 80 00 00 	movabs $0x8003a0,%rcx
+  801931:	00 00 00 
+  801934:	ff d1                	call   *%rcx
+
+0000000000801936 <sfork>:
+
+envid_t
+sfork() {
+  801936:	55                   	push   %rbp
+  801937:	48 89 e5             	mov    %rsp,%rbp
+    panic("sfork() is not implemented");
+  80193a:	48 ba 3a 37 80 00 00 	movabs $0x80373a,%rdx
+  801941:	00 00 00 
+  801944:	be 36 00 00 00       	mov    $0x36,%esi
+  801949:	48 bf 2f 37 80 00 00 	movabs $0x80372f,%rdi
+  801950:	00 00 00 
+  801953:	b8 00 00 00 00       	mov    $0x0,%eax
+  801958:	48 b9 a0 03 80 00 00 	movabs $0x8003a0,%rcx
+  80195f:	00 00 00 
+  801962:	ff d1                	call   *%rcx
+
+0000000000801964 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801964:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  80196b:	ff ff ff 
+  80196e:	48 01 f8             	add    %rdi,%rax
+  801971:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  801975:	c3                   	ret
+
+0000000000801976 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801976:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  80197d:	ff ff ff 
+  801980:	48 01 f8             	add    %rdi,%rax
+  801983:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  801987:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  80198d:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  801991:	c3                   	ret
+
+0000000000801992 <fd_alloc_from>:
+}
+
+/* Like fd_alloc(), but only considers fds starting from fdnum,
+ * so that several fds can be found before their pages are allocated */
+int
+fd_alloc_from(int fdnum, struct Fd **fd_store) {
+  801992:	55                   	push   %rbp
+  801993:	48 89 e5             	mov    %rsp,%rbp
+  801996:	41 57                	push   %r15
+  801998:	41 56                	push   %r14
+  80199a:	41 55                	push   %r13
+  80199c:	41 54                	push   %r12
+  80199e:	53                   	push   %rbx
+  80199f:	48 83 ec 08          	sub    $0x8,%rsp
+  8019a3:	49 89 f7             	mov    %rsi,%r15
+    for (int i = MAX(fdnum, 0); i < MAXFD; i++) {
+  8019a6:	85 ff                	test   %edi,%edi
+  8019a8:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8019ae:	44 0f 49 e7          	cmovns %edi,%r12d
+  8019b2:	83 ff 1f             	cmp    $0x1f,%edi
+  8019b5:	7f 37                	jg     8019ee <fd_alloc_from+0x5c>
+  8019b7:	49 63 dc             	movslq %r12d,%rbx
+  8019ba:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  8019c1:	48 c1 e3 0c          	shl    $0xc,%rbx
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  8019c5:	49 be 9b 2a 80 00 00 	movabs $0x802a9b,%r14
+  8019cc:	00 00 00 
+        struct Fd *fd = INDEX2FD(i);
+  8019cf:	49 89 dd             	mov    %rbx,%r13
+        if (!(get_prot(fd) & PROT_R)) {
+  8019d2:	48 89 df             	mov    %rbx,%rdi
+  8019d5:	41 ff d6             	call   *%r14
+  8019d8:	83 e0 04             	and    $0x4,%eax
+  8019db:	74 1c                	je     8019f9 <fd_alloc_from+0x67>
+    for (int i = MAX(fdnum, 0); i < MAXFD; i++) {
+  8019dd:	41 83 c4 01          	add    $0x1,%r12d
+  8019e1:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8019e8:	41 83 fc 1f          	cmp    $0x1f,%r12d
+  8019ec:	7e e1                	jle    8019cf <fd_alloc_from+0x3d>
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  8019ee:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  8019f4:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  8019f9:	4d 89 2f             	mov    %r13,(%r15)
+}
+  8019fc:	48 83 c4 08          	add    $0x8,%rsp
+  801a00:	5b                   	pop    %rbx
+  801a01:	41 5c                	pop    %r12
+  801a03:	41 5d                	pop    %r13
+  801a05:	41 5e                	pop    %r14
+  801a07:	41 5f                	pop    %r15
+  801a09:	5d                   	pop    %rbp
+  801a0a:	c3                   	ret
+
+0000000000801a0b <fd_alloc>:
+fd_alloc(struct Fd **fd_store) {
+  801a0b:	55                   	push   %rbp
+  801a0c:	48 89 e5             	mov    %rsp,%rbp
+  801a0f:	48 89 fe             	mov    %rdi,%rsi
+    return fd_alloc_from(0, fd_store);
+  801a12:	bf 00 00 00 00       	mov    $0x0,%edi
+  801a17:	48 b8 92 19 80 00 00 	movabs $0x801992,%rax
+  801a1e:	00 00 00 
+  801a21:	ff d0                	call   *%rax
+}
+  801a23:	5d                   	pop    %rbp
+  801a24:	c3                   	ret
+
+0000000000801a25 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  801a25:	83 ff 1f             	cmp    $0x1f,%edi
+  801a28:	77 39                	ja     801a63 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  801a2a:	55                   	push   %rbp
+  801a2b:	48 89 e5             	mov    %rsp,%rbp
+  801a2e:	41 54                	push   %r12
+  801a30:	53                   	push   %rbx
+  801a31:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  801a34:	48 63 df             	movslq %edi,%rbx
+  801a37:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  801a3e:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  801a42:	48 89 df             	mov    %rbx,%rdi
+  801a45:	48 b8 9b 2a 80 00 00 	movabs $0x802a9b,%rax
+  801a4c:	00 00 00 
+  801a4f:	ff d0                	call   *%rax
+  801a51:	a8 04                	test   $0x4,%al
+  801a53:	74 14                	je     801a69 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  801a55:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  801a59:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801a5e:	5b                   	pop    %rbx
+  801a5f:	41 5c                	pop    %r12
+  801a61:	5d                   	pop    %rbp
+  801a62:	c3                   	ret
+        return -E_INVAL;
+  801a63:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801a68:	c3                   	ret
+        return -E_INVAL;
+  801a69:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801a6e:	eb ee                	jmp    801a5e <fd_lookup+0x39>
+
+0000000000801a70 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  801a70:	55                   	push   %rbp
+  801a71:	48 89 e5             	mov    %rsp,%rbp
+  801a74:	41 54                	push   %r12
+  801a76:	53                   	push   %rbx
+  801a77:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  801a7a:	48 b8 e0 37 80 00 00 	movabs $0x8037e0,%rax
+  801a81:	00 00 00 
+  801a84:	48 bb 20 40 80 00 00 	movabs $0x804020,%rbx
+  801a8b:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  801a8e:	39 3b                	cmp    %edi,(%rbx)
+  801a90:	74 47                	je     801ad9 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  801a92:	48 83 c0 08          	add    $0x8,%rax
+  801a96:	48 8b 18             	mov    (%rax),%rbx
+  801a99:	48 85 db             	test   %rbx,%rbx
+  801a9c:	75 f0                	jne    801a8e <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801a9e:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801aa5:	00 00 00 
+  801aa8:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+  801aae:	89 fa                	mov    %edi,%edx
+  801ab0:	48 bf 58 37 80 00 00 	movabs $0x803758,%rdi
+  801ab7:	00 00 00 
+  801aba:	b8 00 00 00 00       	mov    $0x0,%eax
+  801abf:	48 b9 f0 04 80 00 00 	movabs $0x8004f0,%rcx
+  801ac6:	00 00 00 
+  801ac9:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  801acb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  801ad0:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  801ad4:	5b                   	pop    %rbx
+  801ad5:	41 5c                	pop    %r12
+  801ad7:	5d                   	pop    %rbp
+  801ad8:	c3                   	ret
+            return 0;
+  801ad9:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ade:	eb f0                	jmp    801ad0 <dev_lookup+0x60>
+
+0000000000801ae0 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  801ae0:	55                   	push   %rbp
+  801ae1:	48 89 e5             	mov    %rsp,%rbp
+  801ae4:	41 55                	push   %r13
+  801ae6:	41 54                	push   %r12
+  801ae8:	53                   	push   %rbx
+  801ae9:	48 83 ec 18          	sub    $0x18,%rsp
+  801aed:	48 89 fb             	mov    %rdi,%rbx
+  801af0:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801af3:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  801afa:	ff ff ff 
+  801afd:	48 01 df             	add    %rbx,%rdi
+  801b00:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  801b04:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801b08:	48 b8 25 1a 80 00 00 	movabs $0x801a25,%rax
+  801b0f:	00 00 00 
+  801b12:	ff d0                	call   *%rax
+  801b14:	41 89 c5             	mov    %eax,%r13d
+  801b17:	85 c0                	test   %eax,%eax
+  801b19:	78 06                	js     801b21 <fd_close+0x41>
+  801b1b:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  801b1f:	74 1a                	je     801b3b <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  801b21:	45 84 e4             	test   %r12b,%r12b
+  801b24:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b29:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  801b2d:	44 89 e8             	mov    %r13d,%eax
+  801b30:	48 83 c4 18          	add    $0x18,%rsp
+  801b34:	5b                   	pop    %rbx
+  801b35:	41 5c                	pop    %r12
+  801b37:	41 5d                	pop    %r13
+  801b39:	5d                   	pop    %rbp
+  801b3a:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801b3b:	8b 3b                	mov    (%rbx),%edi
+  801b3d:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801b41:	48 b8 70 1a 80 00 00 	movabs $0x801a70,%rax
+  801b48:	00 00 00 
+  801b4b:	ff d0                	call   *%rax
+  801b4d:	41 89 c5             	mov    %eax,%r13d
+  801b50:	85 c0                	test   %eax,%eax
+  801b52:	78 1b                	js     801b6f <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  801b54:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801b58:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801b5c:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801b62:	48 85 c0             	test   %rax,%rax
+  801b65:	74 08                	je     801b6f <fd_close+0x8f>
+  801b67:	48 89 df             	mov    %rbx,%rdi
+  801b6a:	ff d0                	call   *%rax
+  801b6c:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801b6f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801b74:	48 89 de             	mov    %rbx,%rsi
+  801b77:	bf 00 00 00 00       	mov    $0x0,%edi
+  801b7c:	48 b8 91 14 80 00 00 	movabs $0x801491,%rax
+  801b83:	00 00 00 
+  801b86:	ff d0                	call   *%rax
+    return res;
+  801b88:	eb a3                	jmp    801b2d <fd_close+0x4d>
+
+0000000000801b8a <close>:
+
+int
+close(int fdnum) {
+  801b8a:	55                   	push   %rbp
+  801b8b:	48 89 e5             	mov    %rsp,%rbp
+  801b8e:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  801b92:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801b96:	48 b8 25 1a 80 00 00 	movabs $0x801a25,%rax
+  801b9d:	00 00 00 
+  801ba0:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801ba2:	85 c0                	test   %eax,%eax
+  801ba4:	78 15                	js     801bbb <close+0x31>
+
+    return fd_close(fd, 1);
+  801ba6:	be 01 00 00 00       	mov    $0x1,%esi
+  801bab:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801baf:	48 b8 e0 1a 80 00 00 	movabs $0x801ae0,%rax
+  801bb6:	00 00 00 
+  801bb9:	ff d0                	call   *%rax
+}
+  801bbb:	c9                   	leave
+  801bbc:	c3                   	ret
+
+0000000000801bbd <close_all>:
+
+void
+close_all(void) {
+  801bbd:	55                   	push   %rbp
+  801bbe:	48 89 e5             	mov    %rsp,%rbp
+  801bc1:	41 54                	push   %r12
+  801bc3:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  801bc4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801bc9:	49 bc 8a 1b 80 00 00 	movabs $0x801b8a,%r12
+  801bd0:	00 00 00 
+  801bd3:	89 df                	mov    %ebx,%edi
+  801bd5:	41 ff d4             	call   *%r12
+  801bd8:	83 c3 01             	add    $0x1,%ebx
+  801bdb:	83 fb 20             	cmp    $0x20,%ebx
+  801bde:	75 f3                	jne    801bd3 <close_all+0x16>
+}
+  801be0:	5b                   	pop    %rbx
+  801be1:	41 5c                	pop    %r12
+  801be3:	5d                   	pop    %rbp
+  801be4:	c3                   	ret
+
+0000000000801be5 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  801be5:	55                   	push   %rbp
+  801be6:	48 89 e5             	mov    %rsp,%rbp
+  801be9:	41 57                	push   %r15
+  801beb:	41 56                	push   %r14
+  801bed:	41 55                	push   %r13
+  801bef:	41 54                	push   %r12
+  801bf1:	53                   	push   %rbx
+  801bf2:	48 83 ec 18          	sub    $0x18,%rsp
+  801bf6:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  801bf9:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801bfd:	48 b8 25 1a 80 00 00 	movabs $0x801a25,%rax
+  801c04:	00 00 00 
+  801c07:	ff d0                	call   *%rax
+  801c09:	89 c3                	mov    %eax,%ebx
+  801c0b:	85 c0                	test   %eax,%eax
+  801c0d:	0f 88 b8 00 00 00    	js     801ccb <dup+0xe6>
+    close(newfdnum);
+  801c13:	44 89 e7             	mov    %r12d,%edi
+  801c16:	48 b8 8a 1b 80 00 00 	movabs $0x801b8a,%rax
+  801c1d:	00 00 00 
+  801c20:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  801c22:	4d 63 ec             	movslq %r12d,%r13
+  801c25:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  801c2c:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  801c30:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  801c34:	4c 89 ff             	mov    %r15,%rdi
+  801c37:	49 be 76 19 80 00 00 	movabs $0x801976,%r14
+  801c3e:	00 00 00 
+  801c41:	41 ff d6             	call   *%r14
+  801c44:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  801c47:	4c 89 ef             	mov    %r13,%rdi
+  801c4a:	41 ff d6             	call   *%r14
+  801c4d:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  801c50:	48 89 df             	mov    %rbx,%rdi
+  801c53:	48 b8 9b 2a 80 00 00 	movabs $0x802a9b,%rax
+  801c5a:	00 00 00 
+  801c5d:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  801c5f:	a8 04                	test   $0x4,%al
+  801c61:	74 2b                	je     801c8e <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  801c63:	41 89 c1             	mov    %eax,%r9d
+  801c66:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801c6c:	4c 89 f1             	mov    %r14,%rcx
+  801c6f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c74:	48 89 de             	mov    %rbx,%rsi
+  801c77:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c7c:	48 b8 2c 14 80 00 00 	movabs $0x80142c,%rax
+  801c83:	00 00 00 
+  801c86:	ff d0                	call   *%rax
+  801c88:	89 c3                	mov    %eax,%ebx
+  801c8a:	85 c0                	test   %eax,%eax
+  801c8c:	78 4e                	js     801cdc <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  801c8e:	4c 89 ff             	mov    %r15,%rdi
+  801c91:	48 b8 9b 2a 80 00 00 	movabs $0x802a9b,%rax
+  801c98:	00 00 00 
+  801c9b:	ff d0                	call   *%rax
+  801c9d:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801ca0:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801ca6:	4c 89 e9             	mov    %r13,%rcx
+  801ca9:	ba 00 00 00 00       	mov    $0x0,%edx
+  801cae:	4c 89 fe             	mov    %r15,%rsi
+  801cb1:	bf 00 00 00 00       	mov    $0x0,%edi
+  801cb6:	48 b8 2c 14 80 00 00 	movabs $0x80142c,%rax
+  801cbd:	00 00 00 
+  801cc0:	ff d0                	call   *%rax
+  801cc2:	89 c3                	mov    %eax,%ebx
+  801cc4:	85 c0                	test   %eax,%eax
+  801cc6:	78 14                	js     801cdc <dup+0xf7>
+
+    return newfdnum;
+  801cc8:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  801ccb:	89 d8                	mov    %ebx,%eax
+  801ccd:	48 83 c4 18          	add    $0x18,%rsp
+  801cd1:	5b                   	pop    %rbx
+  801cd2:	41 5c                	pop    %r12
+  801cd4:	41 5d                	pop    %r13
+  801cd6:	41 5e                	pop    %r14
+  801cd8:	41 5f                	pop    %r15
+  801cda:	5d                   	pop    %rbp
+  801cdb:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  801cdc:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801ce1:	4c 89 ee             	mov    %r13,%rsi
+  801ce4:	bf 00 00 00 00       	mov    $0x0,%edi
+  801ce9:	49 bc 91 14 80 00 00 	movabs $0x801491,%r12
+  801cf0:	00 00 00 
+  801cf3:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  801cf6:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801cfb:	4c 89 f6             	mov    %r14,%rsi
+  801cfe:	bf 00 00 00 00       	mov    $0x0,%edi
+  801d03:	41 ff d4             	call   *%r12
+    return res;
+  801d06:	eb c3                	jmp    801ccb <dup+0xe6>
+
+0000000000801d08 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  801d08:	55                   	push   %rbp
+  801d09:	48 89 e5             	mov    %rsp,%rbp
+  801d0c:	41 56                	push   %r14
+  801d0e:	41 55                	push   %r13
+  801d10:	41 54                	push   %r12
+  801d12:	53                   	push   %rbx
+  801d13:	48 83 ec 10          	sub    $0x10,%rsp
+  801d17:	89 fb                	mov    %edi,%ebx
+  801d19:	49 89 f4             	mov    %rsi,%r12
+  801d1c:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801d1f:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801d23:	48 b8 25 1a 80 00 00 	movabs $0x801a25,%rax
+  801d2a:	00 00 00 
+  801d2d:	ff d0                	call   *%rax
+  801d2f:	85 c0                	test   %eax,%eax
+  801d31:	78 4c                	js     801d7f <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801d33:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801d37:	41 8b 3e             	mov    (%r14),%edi
+  801d3a:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801d3e:	48 b8 70 1a 80 00 00 	movabs $0x801a70,%rax
+  801d45:	00 00 00 
+  801d48:	ff d0                	call   *%rax
+  801d4a:	85 c0                	test   %eax,%eax
+  801d4c:	78 35                	js     801d83 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801d4e:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801d52:	83 e0 03             	and    $0x3,%eax
+  801d55:	83 f8 01             	cmp    $0x1,%eax
+  801d58:	74 2d                	je     801d87 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801d5a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801d5e:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801d62:	48 85 c0             	test   %rax,%rax
+  801d65:	74 56                	je     801dbd <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  801d67:	4c 89 ea             	mov    %r13,%rdx
+  801d6a:	4c 89 e6             	mov    %r12,%rsi
+  801d6d:	4c 89 f7             	mov    %r14,%rdi
+  801d70:	ff d0                	call   *%rax
+}
+  801d72:	48 83 c4 10          	add    $0x10,%rsp
+  801d76:	5b                   	pop    %rbx
+  801d77:	41 5c                	pop    %r12
+  801d79:	41 5d                	pop    %r13
+  801d7b:	41 5e                	pop    %r14
+  801d7d:	5d                   	pop    %rbp
+  801d7e:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801d7f:	48 98                	cltq
+  801d81:	eb ef                	jmp    801d72 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801d83:	48 98                	cltq
+  801d85:	eb eb                	jmp    801d72 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801d87:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801d8e:	00 00 00 
+  801d91:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+  801d97:	89 da                	mov    %ebx,%edx
+  801d99:	48 bf 99 37 80 00 00 	movabs $0x803799,%rdi
+  801da0:	00 00 00 
+  801da3:	b8 00 00 00 00       	mov    $0x0,%eax
+  801da8:	48 b9 f0 04 80 00 00 	movabs $0x8004f0,%rcx
+  801daf:	00 00 00 
+  801db2:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801db4:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801dbb:	eb b5                	jmp    801d72 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801dbd:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801dc4:	eb ac                	jmp    801d72 <read+0x6a>
+
+0000000000801dc6 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801dc6:	55                   	push   %rbp
+  801dc7:	48 89 e5             	mov    %rsp,%rbp
+  801dca:	41 57                	push   %r15
+  801dcc:	41 56                	push   %r14
+  801dce:	41 55                	push   %r13
+  801dd0:	41 54                	push   %r12
+  801dd2:	53                   	push   %rbx
+  801dd3:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  801dd7:	48 85 d2             	test   %rdx,%rdx
+  801dda:	74 54                	je     801e30 <readn+0x6a>
+  801ddc:	41 89 fd             	mov    %edi,%r13d
+  801ddf:	49 89 f6             	mov    %rsi,%r14
+  801de2:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  801de5:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  801dea:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  801def:	49 bf 08 1d 80 00 00 	movabs $0x801d08,%r15
+  801df6:	00 00 00 
+  801df9:	4c 89 e2             	mov    %r12,%rdx
+  801dfc:	48 29 f2             	sub    %rsi,%rdx
+  801dff:	4c 01 f6             	add    %r14,%rsi
+  801e02:	44 89 ef             	mov    %r13d,%edi
+  801e05:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  801e08:	85 c0                	test   %eax,%eax
+  801e0a:	78 20                	js     801e2c <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  801e0c:	01 c3                	add    %eax,%ebx
+  801e0e:	85 c0                	test   %eax,%eax
+  801e10:	74 08                	je     801e1a <readn+0x54>
+  801e12:	48 63 f3             	movslq %ebx,%rsi
+  801e15:	4c 39 e6             	cmp    %r12,%rsi
+  801e18:	72 df                	jb     801df9 <readn+0x33>
+    }
+    return res;
+  801e1a:	48 63 c3             	movslq %ebx,%rax
+}
+  801e1d:	48 83 c4 08          	add    $0x8,%rsp
+  801e21:	5b                   	pop    %rbx
+  801e22:	41 5c                	pop    %r12
+  801e24:	41 5d                	pop    %r13
+  801e26:	41 5e                	pop    %r14
+  801e28:	41 5f                	pop    %r15
+  801e2a:	5d                   	pop    %rbp
+  801e2b:	c3                   	ret
+        if (inc < 0) return inc;
+  801e2c:	48 98                	cltq
+  801e2e:	eb ed                	jmp    801e1d <readn+0x57>
+    int inc = 1, res = 0;
+  801e30:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801e35:	eb e3                	jmp    801e1a <readn+0x54>
+
+0000000000801e37 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  801e37:	55                   	push   %rbp
+  801e38:	48 89 e5             	mov    %rsp,%rbp
+  801e3b:	41 56                	push   %r14
+  801e3d:	41 55                	push   %r13
+  801e3f:	41 54                	push   %r12
+  801e41:	53                   	push   %rbx
+  801e42:	48 83 ec 10          	sub    $0x10,%rsp
+  801e46:	89 fb                	mov    %edi,%ebx
+  801e48:	49 89 f4             	mov    %rsi,%r12
+  801e4b:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801e4e:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801e52:	48 b8 25 1a 80 00 00 	movabs $0x801a25,%rax
+  801e59:	00 00 00 
+  801e5c:	ff d0                	call   *%rax
+  801e5e:	85 c0                	test   %eax,%eax
+  801e60:	78 47                	js     801ea9 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801e62:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801e66:	41 8b 3e             	mov    (%r14),%edi
+  801e69:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801e6d:	48 b8 70 1a 80 00 00 	movabs $0x801a70,%rax
+  801e74:	00 00 00 
+  801e77:	ff d0                	call   *%rax
+  801e79:	85 c0                	test   %eax,%eax
+  801e7b:	78 30                	js     801ead <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801e7d:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  801e82:	74 2d                	je     801eb1 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801e84:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801e88:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801e8c:	48 85 c0             	test   %rax,%rax
+  801e8f:	74 56                	je     801ee7 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  801e91:	4c 89 ea             	mov    %r13,%rdx
+  801e94:	4c 89 e6             	mov    %r12,%rsi
+  801e97:	4c 89 f7             	mov    %r14,%rdi
+  801e9a:	ff d0                	call   *%rax
+}
+  801e9c:	48 83 c4 10          	add    $0x10,%rsp
+  801ea0:	5b                   	pop    %rbx
+  801ea1:	41 5c                	pop    %r12
+  801ea3:	41 5d                	pop    %r13
+  801ea5:	41 5e                	pop    %r14
+  801ea7:	5d                   	pop    %rbp
+  801ea8:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801ea9:	48 98                	cltq
+  801eab:	eb ef                	jmp    801e9c <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801ead:	48 98                	cltq
+  801eaf:	eb eb                	jmp    801e9c <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801eb1:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801eb8:	00 00 00 
+  801ebb:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+  801ec1:	89 da                	mov    %ebx,%edx
+  801ec3:	48 bf b5 37 80 00 00 	movabs $0x8037b5,%rdi
+  801eca:	00 00 00 
+  801ecd:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ed2:	48 b9 f0 04 80 00 00 	movabs $0x8004f0,%rcx
+  801ed9:	00 00 00 
+  801edc:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801ede:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801ee5:	eb b5                	jmp    801e9c <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801ee7:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801eee:	eb ac                	jmp    801e9c <write+0x65>
+
+0000000000801ef0 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  801ef0:	55                   	push   %rbp
+  801ef1:	48 89 e5             	mov    %rsp,%rbp
+  801ef4:	53                   	push   %rbx
+  801ef5:	48 83 ec 18          	sub    $0x18,%rsp
+  801ef9:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801efb:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801eff:	48 b8 25 1a 80 00 00 	movabs $0x801a25,%rax
+  801f06:	00 00 00 
+  801f09:	ff d0                	call   *%rax
+  801f0b:	85 c0                	test   %eax,%eax
+  801f0d:	78 0c                	js     801f1b <seek+0x2b>
+
+    fd->fd_offset = offset;
+  801f0f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801f13:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  801f16:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801f1b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801f1f:	c9                   	leave
+  801f20:	c3                   	ret
+
+0000000000801f21 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  801f21:	55                   	push   %rbp
+  801f22:	48 89 e5             	mov    %rsp,%rbp
+  801f25:	41 55                	push   %r13
+  801f27:	41 54                	push   %r12
+  801f29:	53                   	push   %rbx
+  801f2a:	48 83 ec 18          	sub    $0x18,%rsp
+  801f2e:	89 fb                	mov    %edi,%ebx
+  801f30:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801f33:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801f37:	48 b8 25 1a 80 00 00 	movabs $0x801a25,%rax
+  801f3e:	00 00 00 
+  801f41:	ff d0                	call   *%rax
+  801f43:	85 c0                	test   %eax,%eax
+  801f45:	78 38                	js     801f7f <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801f47:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  801f4b:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  801f4f:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801f53:	48 b8 70 1a 80 00 00 	movabs $0x801a70,%rax
+  801f5a:	00 00 00 
+  801f5d:	ff d0                	call   *%rax
+  801f5f:	85 c0                	test   %eax,%eax
+  801f61:	78 1c                	js     801f7f <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801f63:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  801f68:	74 20                	je     801f8a <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801f6a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801f6e:	48 8b 40 30          	mov    0x30(%rax),%rax
+  801f72:	48 85 c0             	test   %rax,%rax
+  801f75:	74 47                	je     801fbe <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  801f77:	44 89 e6             	mov    %r12d,%esi
+  801f7a:	4c 89 ef             	mov    %r13,%rdi
+  801f7d:	ff d0                	call   *%rax
+}
+  801f7f:	48 83 c4 18          	add    $0x18,%rsp
+  801f83:	5b                   	pop    %rbx
+  801f84:	41 5c                	pop    %r12
+  801f86:	41 5d                	pop    %r13
+  801f88:	5d                   	pop    %rbp
+  801f89:	c3                   	ret
+                thisenv->env_id, fdnum);
+  801f8a:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801f91:	00 00 00 
+  801f94:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801f9a:	89 da                	mov    %ebx,%edx
+  801f9c:	48 bf 78 37 80 00 00 	movabs $0x803778,%rdi
+  801fa3:	00 00 00 
+  801fa6:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fab:	48 b9 f0 04 80 00 00 	movabs $0x8004f0,%rcx
+  801fb2:	00 00 00 
+  801fb5:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801fb7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801fbc:	eb c1                	jmp    801f7f <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801fbe:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801fc3:	eb ba                	jmp    801f7f <ftruncate+0x5e>
+
+0000000000801fc5 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  801fc5:	55                   	push   %rbp
+  801fc6:	48 89 e5             	mov    %rsp,%rbp
+  801fc9:	41 54                	push   %r12
+  801fcb:	53                   	push   %rbx
+  801fcc:	48 83 ec 10          	sub    $0x10,%rsp
+  801fd0:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801fd3:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801fd7:	48 b8 25 1a 80 00 00 	movabs $0x801a25,%rax
+  801fde:	00 00 00 
+  801fe1:	ff d0                	call   *%rax
+  801fe3:	85 c0                	test   %eax,%eax
+  801fe5:	78 4e                	js     802035 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801fe7:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801feb:	41 8b 3c 24          	mov    (%r12),%edi
+  801fef:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801ff3:	48 b8 70 1a 80 00 00 	movabs $0x801a70,%rax
+  801ffa:	00 00 00 
+  801ffd:	ff d0                	call   *%rax
+  801fff:	85 c0                	test   %eax,%eax
+  802001:	78 32                	js     802035 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  802003:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802007:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  80200c:	74 30                	je     80203e <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  80200e:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  802011:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  802018:	00 00 00 
+    stat->st_isdir = 0;
+  80201b:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  802022:	00 00 00 
+    stat->st_dev = dev;
+  802025:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  80202c:	48 89 de             	mov    %rbx,%rsi
+  80202f:	4c 89 e7             	mov    %r12,%rdi
+  802032:	ff 50 28             	call   *0x28(%rax)
+}
+  802035:	48 83 c4 10          	add    $0x10,%rsp
+  802039:	5b                   	pop    %rbx
+  80203a:	41 5c                	pop    %r12
+  80203c:	5d                   	pop    %rbp
+  80203d:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  80203e:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802043:	eb f0                	jmp    802035 <fstat+0x70>
+
+0000000000802045 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  802045:	55                   	push   %rbp
+  802046:	48 89 e5             	mov    %rsp,%rbp
+  802049:	41 54                	push   %r12
+  80204b:	53                   	push   %rbx
+  80204c:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  80204f:	be 00 00 00 00       	mov    $0x0,%esi
+  802054:	48 b8 28 24 80 00 00 	movabs $0x802428,%rax
+  80205b:	00 00 00 
+  80205e:	ff d0                	call   *%rax
+  802060:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  802062:	85 c0                	test   %eax,%eax
+  802064:	78 25                	js     80208b <stat+0x46>
+
+    int res = fstat(fd, stat);
+  802066:	4c 89 e6             	mov    %r12,%rsi
+  802069:	89 c7                	mov    %eax,%edi
+  80206b:	48 b8 c5 1f 80 00 00 	movabs $0x801fc5,%rax
+  802072:	00 00 00 
+  802075:	ff d0                	call   *%rax
+  802077:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  80207a:	89 df                	mov    %ebx,%edi
+  80207c:	48 b8 8a 1b 80 00 00 	movabs $0x801b8a,%rax
+  802083:	00 00 00 
+  802086:	ff d0                	call   *%rax
+
+    return res;
+  802088:	44 89 e3             	mov    %r12d,%ebx
+}
+  80208b:	89 d8                	mov    %ebx,%eax
+  80208d:	5b                   	pop    %rbx
+  80208e:	41 5c                	pop    %r12
+  802090:	5d                   	pop    %rbp
+  802091:	c3                   	ret
+
+0000000000802092 <fsipc>:
+ * response may be written back to fsipcbuf.
+ * type: request code, passed as the simple integer IPC value.
+ * dstva: virtual address at which to receive reply page, 0 if none.
+ * Returns result from the file server. */
+static int
+fsipc(unsigned type, void *dstva) {
+  802092:	55                   	push   %rbp
+  802093:	48 89 e5             	mov    %rsp,%rbp
+  802096:	41 54                	push   %r12
+  802098:	53                   	push   %rbx
+  802099:	48 83 ec 10          	sub    $0x10,%rsp
+  80209d:	41 89 fc             	mov    %edi,%r12d
+  8020a0:	48 89 f3             	mov    %rsi,%rbx
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8020a3:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  8020aa:	00 00 00 
+  8020ad:	83 38 00             	cmpl   $0x0,(%rax)
+  8020b0:	74 5e                	je     802110 <fsipc+0x7e>
+    if (debug) {
+        cprintf("[%08x] fsipc %d %08x\n",
+                thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+    }
+
+    ipc_send(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW);
+  8020b2:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8020b8:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8020bd:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  8020c4:	00 00 00 
+  8020c7:	44 89 e6             	mov    %r12d,%esi
+  8020ca:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  8020d1:	00 00 00 
+  8020d4:	8b 38                	mov    (%rax),%edi
+  8020d6:	48 b8 8f 2f 80 00 00 	movabs $0x802f8f,%rax
+  8020dd:	00 00 00 
+  8020e0:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  8020e2:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  8020e9:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  8020ea:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8020ef:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  8020f3:	48 89 de             	mov    %rbx,%rsi
+  8020f6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8020fb:	48 b8 ba 2e 80 00 00 	movabs $0x802eba,%rax
+  802102:	00 00 00 
+  802105:	ff d0                	call   *%rax
+}
+  802107:	48 83 c4 10          	add    $0x10,%rsp
+  80210b:	5b                   	pop    %rbx
+  80210c:	41 5c                	pop    %r12
+  80210e:	5d                   	pop    %rbp
+  80210f:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802110:	bf 03 00 00 00       	mov    $0x3,%edi
+  802115:	48 b8 32 30 80 00 00 	movabs $0x803032,%rax
+  80211c:	00 00 00 
+  80211f:	ff d0                	call   *%rax
+  802121:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  802128:	00 00 
+  80212a:	eb 86                	jmp    8020b2 <fsipc+0x20>
+
+000000000080212c <devfile_trunc>:
+    return 0;
+}
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  80212c:	55                   	push   %rbp
+  80212d:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802130:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  802137:	00 00 00 
+  80213a:	8b 57 0c             	mov    0xc(%rdi),%edx
+  80213d:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  80213f:	89 70 04             	mov    %esi,0x4(%rax)
+
+    return fsipc(FSREQ_SET_SIZE, NULL);
+  802142:	be 00 00 00 00       	mov    $0x0,%esi
+  802147:	bf 02 00 00 00       	mov    $0x2,%edi
+  80214c:	48 b8 92 20 80 00 00 	movabs $0x802092,%rax
+  802153:	00 00 00 
+  802156:	ff d0                	call   *%rax
+}
+  802158:	5d                   	pop    %rbp
+  802159:	c3                   	ret
+
+000000000080215a <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  80215a:	55                   	push   %rbp
+  80215b:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  80215e:	8b 47 0c             	mov    0xc(%rdi),%eax
+  802161:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  802168:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  80216a:	be 00 00 00 00       	mov    $0x0,%esi
+  80216f:	bf 06 00 00 00       	mov    $0x6,%edi
+  802174:	48 b8 92 20 80 00 00 	movabs $0x802092,%rax
+  80217b:	00 00 00 
+  80217e:	ff d0                	call   *%rax
+}
+  802180:	5d                   	pop    %rbp
+  802181:	c3                   	ret
+
+0000000000802182 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  802182:	55                   	push   %rbp
+  802183:	48 89 e5             	mov    %rsp,%rbp
+  802186:	41 54                	push   %r12
+  802188:	53                   	push   %rbx
+  802189:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  80218c:	8b 47 0c             	mov    0xc(%rdi),%eax
+  80218f:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  802196:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  802198:	be 00 00 00 00       	mov    $0x0,%esi
+  80219d:	bf 05 00 00 00       	mov    $0x5,%edi
+  8021a2:	48 b8 92 20 80 00 00 	movabs $0x802092,%rax
+  8021a9:	00 00 00 
+  8021ac:	ff d0                	call   *%rax
+    if (res < 0) {
+  8021ae:	85 c0                	test   %eax,%eax
+  8021b0:	78 3d                	js     8021ef <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8021b2:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  8021b9:	00 00 00 
+  8021bc:	4c 89 e6             	mov    %r12,%rsi
+  8021bf:	48 89 df             	mov    %rbx,%rdi
+  8021c2:	48 b8 15 0e 80 00 00 	movabs $0x800e15,%rax
+  8021c9:	00 00 00 
+  8021cc:	ff d0                	call   *%rax
+    st->st_size  = fsipcbuf.statRet.ret_size;
+  8021ce:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  8021d5:	00 
+  8021d6:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8021dc:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  8021e3:	00 
+  8021e4:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  8021ea:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8021ef:	5b                   	pop    %rbx
+  8021f0:	41 5c                	pop    %r12
+  8021f2:	5d                   	pop    %rbp
+  8021f3:	c3                   	ret
+
+00000000008021f4 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  8021f4:	55                   	push   %rbp
+  8021f5:	48 89 e5             	mov    %rsp,%rbp
+  8021f8:	41 57                	push   %r15
+  8021fa:	41 56                	push   %r14
+  8021fc:	41 55                	push   %r13
+  8021fe:	41 54                	push   %r12
+  802200:	53                   	push   %rbx
+  802201:	48 83 ec 18          	sub    $0x18,%rsp
+  802205:	49 89 fe             	mov    %rdi,%r14
+  802208:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+  80220c:	48 89 d3             	mov    %rdx,%rbx
+    while (n > sizeof(fsipcbuf.write.req_buf))
+  80220f:	48 81 fa f0 0f 00 00 	cmp    $0xff0,%rdx
+  802216:	0f 86 e4 00 00 00    	jbe    802300 <devfile_write+0x10c>
+  80221c:	49 89 f4             	mov    %rsi,%r12
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  80221f:	49 bd 00 60 80 00 00 	movabs $0x806000,%r13
+  802226:	00 00 00 
+        memcpy(fsipcbuf.write.req_buf, buf, sizeof(fsipcbuf.write.req_buf));
+  802229:	49 bf 76 10 80 00 00 	movabs $0x801076,%r15
+  802230:	00 00 00 
+  802233:	eb 03                	jmp    802238 <devfile_write+0x44>
+        buf += sizeof(fsipcbuf.write.req_buf);
+  802235:	49 89 f4             	mov    %rsi,%r12
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802238:	41 8b 46 0c          	mov    0xc(%r14),%eax
+  80223c:	41 89 45 00          	mov    %eax,0x0(%r13)
+        fsipcbuf.write.req_n      = sizeof(fsipcbuf.write.req_buf);
+  802240:	49 c7 45 08 f0 0f 00 	movq   $0xff0,0x8(%r13)
+  802247:	00 
+        memcpy(fsipcbuf.write.req_buf, buf, sizeof(fsipcbuf.write.req_buf));
+  802248:	ba f0 0f 00 00       	mov    $0xff0,%edx
+  80224d:	4c 89 e6             	mov    %r12,%rsi
+  802250:	48 bf 10 60 80 00 00 	movabs $0x806010,%rdi
+  802257:	00 00 00 
+  80225a:	41 ff d7             	call   *%r15
+        ssize_t res = fsipc(FSREQ_WRITE, NULL);
+  80225d:	be 00 00 00 00       	mov    $0x0,%esi
+  802262:	bf 04 00 00 00       	mov    $0x4,%edi
+  802267:	48 b8 92 20 80 00 00 	movabs $0x802092,%rax
+  80226e:	00 00 00 
+  802271:	ff d0                	call   *%rax
+  802273:	48 63 d0             	movslq %eax,%rdx
+        if (res < 0 || res < sizeof(fsipcbuf.write.req_buf))
+  802276:	3d ef 0f 00 00       	cmp    $0xfef,%eax
+  80227b:	7e 71                	jle    8022ee <devfile_write+0xfa>
+        buf += sizeof(fsipcbuf.write.req_buf);
+  80227d:	49 8d b4 24 f0 0f 00 	lea    0xff0(%r12),%rsi
+  802284:	00 
+        n -= sizeof(fsipcbuf.write.req_buf);
+  802285:	48 81 eb f0 0f 00 00 	sub    $0xff0,%rbx
+    while (n > sizeof(fsipcbuf.write.req_buf))
+  80228c:	48 81 fb f0 0f 00 00 	cmp    $0xff0,%rbx
+  802293:	77 a0                	ja     802235 <devfile_write+0x41>
+        written += sizeof(fsipcbuf.write.req_buf);
+  802295:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802299:	49 29 c4             	sub    %rax,%r12
+  80229c:	4d 8d a4 24 f0 0f 00 	lea    0xff0(%r12),%r12
+  8022a3:	00 
+    fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8022a4:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  8022ab:	00 00 00 
+  8022ae:	41 8b 56 0c          	mov    0xc(%r14),%edx
+  8022b2:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.write.req_n      = n;
+  8022b4:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    memcpy(fsipcbuf.write.req_buf, buf, n);
+  8022b8:	48 89 da             	mov    %rbx,%rdx
+  8022bb:	48 8d 78 10          	lea    0x10(%rax),%rdi
+  8022bf:	48 b8 76 10 80 00 00 	movabs $0x801076,%rax
+  8022c6:	00 00 00 
+  8022c9:	ff d0                	call   *%rax
+    ssize_t res = fsipc(FSREQ_WRITE, NULL);
+  8022cb:	be 00 00 00 00       	mov    $0x0,%esi
+  8022d0:	bf 04 00 00 00       	mov    $0x4,%edi
+  8022d5:	48 b8 92 20 80 00 00 	movabs $0x802092,%rax
+  8022dc:	00 00 00 
+  8022df:	ff d0                	call   *%rax
+  8022e1:	48 63 d0             	movslq %eax,%rdx
+    written += res;
+  8022e4:	49 01 d4             	add    %rdx,%r12
+  8022e7:	48 85 d2             	test   %rdx,%rdx
+  8022ea:	49 0f 49 d4          	cmovns %r12,%rdx
+}
+  8022ee:	48 89 d0             	mov    %rdx,%rax
+  8022f1:	48 83 c4 18          	add    $0x18,%rsp
+  8022f5:	5b                   	pop    %rbx
+  8022f6:	41 5c                	pop    %r12
+  8022f8:	41 5d                	pop    %r13
+  8022fa:	41 5e                	pop    %r14
+  8022fc:	41 5f                	pop    %r15
+  8022fe:	5d                   	pop    %rbp
+  8022ff:	c3                   	ret
+    while (n > sizeof(fsipcbuf.write.req_buf))
+  802300:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+    ssize_t written = 0;
+  802304:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80230a:	eb 98                	jmp    8022a4 <devfile_write+0xb0>
+
+000000000080230c <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  80230c:	55                   	push   %rbp
+  80230d:	48 89 e5             	mov    %rsp,%rbp
+  802310:	41 57                	push   %r15
+  802312:	41 56                	push   %r14
+  802314:	41 55                	push   %r13
+  802316:	41 54                	push   %r12
+  802318:	53                   	push   %rbx
+  802319:	48 83 ec 18          	sub    $0x18,%rsp
+  80231d:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  802321:	49 89 f6             	mov    %rsi,%r14
+  802324:	49 89 d4             	mov    %rdx,%r12
+    while (n > sizeof(fsipcbuf.readRet.ret_buf))
+  802327:	48 81 fa 00 10 00 00 	cmp    $0x1000,%rdx
+  80232e:	0f 86 ea 00 00 00    	jbe    80241e <devfile_read+0x112>
+    ssize_t readsz = 0;
+  802334:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  80233b:	00 
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  80233c:	49 bf 00 60 80 00 00 	movabs $0x806000,%r15
+  802343:	00 00 00 
+  802346:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80234a:	8b 40 0c             	mov    0xc(%rax),%eax
+  80234d:	41 89 07             	mov    %eax,(%r15)
+        fsipcbuf.read.req_n = sizeof(fsipcbuf.readRet.ret_buf);
+  802350:	49 c7 47 08 00 10 00 	movq   $0x1000,0x8(%r15)
+  802357:	00 
+        ssize_t res = fsipc(FSREQ_READ, NULL);
+  802358:	be 00 00 00 00       	mov    $0x0,%esi
+  80235d:	bf 03 00 00 00       	mov    $0x3,%edi
+  802362:	48 b8 92 20 80 00 00 	movabs $0x802092,%rax
+  802369:	00 00 00 
+  80236c:	ff d0                	call   *%rax
+  80236e:	4c 63 e8             	movslq %eax,%r13
+        if (res < 0)
+  802371:	4d 85 ed             	test   %r13,%r13
+  802374:	0f 88 92 00 00 00    	js     80240c <devfile_read+0x100>
+        memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  80237a:	4c 89 ea             	mov    %r13,%rdx
+  80237d:	4c 89 fe             	mov    %r15,%rsi
+  802380:	4c 89 f7             	mov    %r14,%rdi
+  802383:	48 b8 76 10 80 00 00 	movabs $0x801076,%rax
+  80238a:	00 00 00 
+  80238d:	ff d0                	call   *%rax
+        if (res < sizeof(fsipcbuf.readRet.ret_buf))
+  80238f:	49 81 fd ff 0f 00 00 	cmp    $0xfff,%r13
+  802396:	76 6d                	jbe    802405 <devfile_read+0xf9>
+        readsz += res;
+  802398:	4c 01 6d c0          	add    %r13,-0x40(%rbp)
+        buf += res;
+  80239c:	4d 01 ee             	add    %r13,%r14
+        n -= res;
+  80239f:	4d 29 ec             	sub    %r13,%r12
+    while (n > sizeof(fsipcbuf.readRet.ret_buf))
+  8023a2:	49 81 fc 00 10 00 00 	cmp    $0x1000,%r12
+  8023a9:	77 9b                	ja     802346 <devfile_read+0x3a>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8023ab:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  8023b2:	00 00 00 
+  8023b5:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  8023b9:	8b 51 0c             	mov    0xc(%rcx),%edx
+  8023bc:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.read.req_n = n;
+  8023be:	4c 89 60 08          	mov    %r12,0x8(%rax)
+    ssize_t res = fsipc(FSREQ_READ, NULL);
+  8023c2:	be 00 00 00 00       	mov    $0x0,%esi
+  8023c7:	bf 03 00 00 00       	mov    $0x3,%edi
+  8023cc:	48 b8 92 20 80 00 00 	movabs $0x802092,%rax
+  8023d3:	00 00 00 
+  8023d6:	ff d0                	call   *%rax
+  8023d8:	4c 63 e8             	movslq %eax,%r13
+    if (res < 0)
+  8023db:	4d 85 ed             	test   %r13,%r13
+  8023de:	78 2c                	js     80240c <devfile_read+0x100>
+    memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  8023e0:	4c 89 ea             	mov    %r13,%rdx
+  8023e3:	48 be 00 60 80 00 00 	movabs $0x806000,%rsi
+  8023ea:	00 00 00 
+  8023ed:	4c 89 f7             	mov    %r14,%rdi
+  8023f0:	48 b8 76 10 80 00 00 	movabs $0x801076,%rax
+  8023f7:	00 00 00 
+  8023fa:	ff d0                	call   *%rax
+    readsz += res;
+  8023fc:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802400:	49 01 c5             	add    %rax,%r13
+    return readsz;
+  802403:	eb 07                	jmp    80240c <devfile_read+0x100>
+            return readsz + res;
+  802405:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802409:	49 01 c5             	add    %rax,%r13
+}
+  80240c:	4c 89 e8             	mov    %r13,%rax
+  80240f:	48 83 c4 18          	add    $0x18,%rsp
+  802413:	5b                   	pop    %rbx
+  802414:	41 5c                	pop    %r12
+  802416:	41 5d                	pop    %r13
+  802418:	41 5e                	pop    %r14
+  80241a:	41 5f                	pop    %r15
+  80241c:	5d                   	pop    %rbp
+  80241d:	c3                   	ret
+    ssize_t readsz = 0;
+  80241e:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  802425:	00 
+  802426:	eb 83                	jmp    8023ab <devfile_read+0x9f>
+
+0000000000802428 <open>:
+open(const char *path, int mode) {
+  802428:	55                   	push   %rbp
+  802429:	48 89 e5             	mov    %rsp,%rbp
+  80242c:	41 55                	push   %r13
+  80242e:	41 54                	push   %r12
+  802430:	53                   	push   %rbx
+  802431:	48 83 ec 18          	sub    $0x18,%rsp
+  802435:	49 89 fc             	mov    %rdi,%r12
+  802438:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  80243b:	48 b8 d7 0d 80 00 00 	movabs $0x800dd7,%rax
+  802442:	00 00 00 
+  802445:	ff d0                	call   *%rax
+  802447:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  80244d:	0f 87 8a 00 00 00    	ja     8024dd <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802453:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802457:	48 b8 0b 1a 80 00 00 	movabs $0x801a0b,%rax
+  80245e:	00 00 00 
+  802461:	ff d0                	call   *%rax
+  802463:	89 c3                	mov    %eax,%ebx
+  802465:	85 c0                	test   %eax,%eax
+  802467:	78 50                	js     8024b9 <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  802469:	4c 89 e6             	mov    %r12,%rsi
+  80246c:	48 bb 00 60 80 00 00 	movabs $0x806000,%rbx
+  802473:	00 00 00 
+  802476:	48 89 df             	mov    %rbx,%rdi
+  802479:	48 b8 15 0e 80 00 00 	movabs $0x800e15,%rax
+  802480:	00 00 00 
+  802483:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  802485:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  80248c:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802490:	bf 01 00 00 00       	mov    $0x1,%edi
+  802495:	48 b8 92 20 80 00 00 	movabs $0x802092,%rax
+  80249c:	00 00 00 
+  80249f:	ff d0                	call   *%rax
+  8024a1:	89 c3                	mov    %eax,%ebx
+  8024a3:	85 c0                	test   %eax,%eax
+  8024a5:	78 1f                	js     8024c6 <open+0x9e>
+    return fd2num(fd);
+  8024a7:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8024ab:	48 b8 64 19 80 00 00 	movabs $0x801964,%rax
+  8024b2:	00 00 00 
+  8024b5:	ff d0                	call   *%rax
+  8024b7:	89 c3                	mov    %eax,%ebx
+}
+  8024b9:	89 d8                	mov    %ebx,%eax
+  8024bb:	48 83 c4 18          	add    $0x18,%rsp
+  8024bf:	5b                   	pop    %rbx
+  8024c0:	41 5c                	pop    %r12
+  8024c2:	41 5d                	pop    %r13
+  8024c4:	5d                   	pop    %rbp
+  8024c5:	c3                   	ret
+        fd_close(fd, 0);
+  8024c6:	be 00 00 00 00       	mov    $0x0,%esi
+  8024cb:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8024cf:	48 b8 e0 1a 80 00 00 	movabs $0x801ae0,%rax
+  8024d6:	00 00 00 
+  8024d9:	ff d0                	call   *%rax
+        return res;
+  8024db:	eb dc                	jmp    8024b9 <open+0x91>
+        return -E_BAD_PATH;
+  8024dd:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  8024e2:	eb d5                	jmp    8024b9 <open+0x91>
+
+00000000008024e4 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  8024e4:	55                   	push   %rbp
+  8024e5:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc(FSREQ_SYNC, NULL);
+  8024e8:	be 00 00 00 00       	mov    $0x0,%esi
+  8024ed:	bf 08 00 00 00       	mov    $0x8,%edi
+  8024f2:	48 b8 92 20 80 00 00 	movabs $0x802092,%rax
+  8024f9:	00 00 00 
+  8024fc:	ff d0                	call   *%rax
+}
+  8024fe:	5d                   	pop    %rbp
+  8024ff:	c3                   	ret
+
+0000000000802500 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  802500:	55                   	push   %rbp
+  802501:	48 89 e5             	mov    %rsp,%rbp
+  802504:	41 54                	push   %r12
+  802506:	53                   	push   %rbx
+  802507:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80250a:	48 b8 76 19 80 00 00 	movabs $0x801976,%rax
+  802511:	00 00 00 
+  802514:	ff d0                	call   *%rax
+  802516:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  802519:	48 be 00 38 80 00 00 	movabs $0x803800,%rsi
+  802520:	00 00 00 
+  802523:	48 89 df             	mov    %rbx,%rdi
+  802526:	48 b8 15 0e 80 00 00 	movabs $0x800e15,%rax
+  80252d:	00 00 00 
+  802530:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  802532:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  802537:	41 2b 04 24          	sub    (%r12),%eax
+  80253b:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  802541:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  802548:	00 00 00 
+    stat->st_dev = &devpipe;
+  80254b:	48 b8 60 40 80 00 00 	movabs $0x804060,%rax
+  802552:	00 00 00 
+  802555:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  80255c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802561:	5b                   	pop    %rbx
+  802562:	41 5c                	pop    %r12
+  802564:	5d                   	pop    %rbp
+  802565:	c3                   	ret
+
+0000000000802566 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  802566:	55                   	push   %rbp
+  802567:	48 89 e5             	mov    %rsp,%rbp
+  80256a:	41 54                	push   %r12
+  80256c:	53                   	push   %rbx
+  80256d:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  802570:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802575:	48 89 fe             	mov    %rdi,%rsi
+  802578:	bf 00 00 00 00       	mov    $0x0,%edi
+  80257d:	49 bc 91 14 80 00 00 	movabs $0x801491,%r12
+  802584:	00 00 00 
+  802587:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  80258a:	48 89 df             	mov    %rbx,%rdi
+  80258d:	48 b8 76 19 80 00 00 	movabs $0x801976,%rax
+  802594:	00 00 00 
+  802597:	ff d0                	call   *%rax
+  802599:	48 89 c6             	mov    %rax,%rsi
+  80259c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8025a1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8025a6:	41 ff d4             	call   *%r12
+}
+  8025a9:	5b                   	pop    %rbx
+  8025aa:	41 5c                	pop    %r12
+  8025ac:	5d                   	pop    %rbp
+  8025ad:	c3                   	ret
+
+00000000008025ae <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8025ae:	55                   	push   %rbp
+  8025af:	48 89 e5             	mov    %rsp,%rbp
+  8025b2:	41 57                	push   %r15
+  8025b4:	41 56                	push   %r14
+  8025b6:	41 55                	push   %r13
+  8025b8:	41 54                	push   %r12
+  8025ba:	53                   	push   %rbx
+  8025bb:	48 83 ec 18          	sub    $0x18,%rsp
+  8025bf:	49 89 fc             	mov    %rdi,%r12
+  8025c2:	49 89 f5             	mov    %rsi,%r13
+  8025c5:	49 89 d7             	mov    %rdx,%r15
+  8025c8:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8025cc:	48 b8 76 19 80 00 00 	movabs $0x801976,%rax
+  8025d3:	00 00 00 
+  8025d6:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  8025d8:	4d 85 ff             	test   %r15,%r15
+  8025db:	0f 84 af 00 00 00    	je     802690 <devpipe_write+0xe2>
+  8025e1:	48 89 c3             	mov    %rax,%rbx
+  8025e4:	4c 89 f8             	mov    %r15,%rax
+  8025e7:	4d 89 ef             	mov    %r13,%r15
+  8025ea:	4c 01 e8             	add    %r13,%rax
+  8025ed:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8025f1:	49 bd 99 13 80 00 00 	movabs $0x801399,%r13
+  8025f8:	00 00 00 
+            sys_yield();
+  8025fb:	49 be 36 13 80 00 00 	movabs $0x801336,%r14
+  802602:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  802605:	8b 73 04             	mov    0x4(%rbx),%esi
+  802608:	48 63 ce             	movslq %esi,%rcx
+  80260b:	48 63 03             	movslq (%rbx),%rax
+  80260e:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  802614:	48 39 c1             	cmp    %rax,%rcx
+  802617:	72 2e                	jb     802647 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802619:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80261e:	48 89 da             	mov    %rbx,%rdx
+  802621:	be 00 10 00 00       	mov    $0x1000,%esi
+  802626:	4c 89 e7             	mov    %r12,%rdi
+  802629:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  80262c:	85 c0                	test   %eax,%eax
+  80262e:	74 66                	je     802696 <devpipe_write+0xe8>
+            sys_yield();
+  802630:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  802633:	8b 73 04             	mov    0x4(%rbx),%esi
+  802636:	48 63 ce             	movslq %esi,%rcx
+  802639:	48 63 03             	movslq (%rbx),%rax
+  80263c:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  802642:	48 39 c1             	cmp    %rax,%rcx
+  802645:	73 d2                	jae    802619 <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  802647:	41 0f b6 3f          	movzbl (%r15),%edi
+  80264b:	48 89 ca             	mov    %rcx,%rdx
+  80264e:	48 c1 ea 03          	shr    $0x3,%rdx
+  802652:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  802659:	08 10 20 
+  80265c:	48 f7 e2             	mul    %rdx
+  80265f:	48 c1 ea 06          	shr    $0x6,%rdx
+  802663:	48 89 d0             	mov    %rdx,%rax
+  802666:	48 c1 e0 09          	shl    $0x9,%rax
+  80266a:	48 29 d0             	sub    %rdx,%rax
+  80266d:	48 c1 e0 03          	shl    $0x3,%rax
+  802671:	48 29 c1             	sub    %rax,%rcx
+  802674:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  802679:	83 c6 01             	add    $0x1,%esi
+  80267c:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  80267f:	49 83 c7 01          	add    $0x1,%r15
+  802683:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802687:	49 39 c7             	cmp    %rax,%r15
+  80268a:	0f 85 75 ff ff ff    	jne    802605 <devpipe_write+0x57>
+    return n;
+  802690:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802694:	eb 05                	jmp    80269b <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  802696:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80269b:	48 83 c4 18          	add    $0x18,%rsp
+  80269f:	5b                   	pop    %rbx
+  8026a0:	41 5c                	pop    %r12
+  8026a2:	41 5d                	pop    %r13
+  8026a4:	41 5e                	pop    %r14
+  8026a6:	41 5f                	pop    %r15
+  8026a8:	5d                   	pop    %rbp
+  8026a9:	c3                   	ret
+
+00000000008026aa <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  8026aa:	55                   	push   %rbp
+  8026ab:	48 89 e5             	mov    %rsp,%rbp
+  8026ae:	41 57                	push   %r15
+  8026b0:	41 56                	push   %r14
+  8026b2:	41 55                	push   %r13
+  8026b4:	41 54                	push   %r12
+  8026b6:	53                   	push   %rbx
+  8026b7:	48 83 ec 18          	sub    $0x18,%rsp
+  8026bb:	49 89 fc             	mov    %rdi,%r12
+  8026be:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  8026c2:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8026c6:	48 b8 76 19 80 00 00 	movabs $0x801976,%rax
+  8026cd:	00 00 00 
+  8026d0:	ff d0                	call   *%rax
+  8026d2:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  8026d5:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8026db:	49 bd 99 13 80 00 00 	movabs $0x801399,%r13
+  8026e2:	00 00 00 
+            sys_yield();
+  8026e5:	49 be 36 13 80 00 00 	movabs $0x801336,%r14
+  8026ec:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  8026ef:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  8026f4:	74 7d                	je     802773 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  8026f6:	8b 03                	mov    (%rbx),%eax
+  8026f8:	3b 43 04             	cmp    0x4(%rbx),%eax
+  8026fb:	75 26                	jne    802723 <devpipe_read+0x79>
+            if (i > 0) return i;
+  8026fd:	4d 85 ff             	test   %r15,%r15
+  802700:	75 77                	jne    802779 <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802702:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802707:	48 89 da             	mov    %rbx,%rdx
+  80270a:	be 00 10 00 00       	mov    $0x1000,%esi
+  80270f:	4c 89 e7             	mov    %r12,%rdi
+  802712:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  802715:	85 c0                	test   %eax,%eax
+  802717:	74 72                	je     80278b <devpipe_read+0xe1>
+            sys_yield();
+  802719:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  80271c:	8b 03                	mov    (%rbx),%eax
+  80271e:	3b 43 04             	cmp    0x4(%rbx),%eax
+  802721:	74 df                	je     802702 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802723:	48 63 c8             	movslq %eax,%rcx
+  802726:	48 89 ca             	mov    %rcx,%rdx
+  802729:	48 c1 ea 03          	shr    $0x3,%rdx
+  80272d:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  802734:	08 10 20 
+  802737:	48 89 d0             	mov    %rdx,%rax
+  80273a:	48 f7 e6             	mul    %rsi
+  80273d:	48 c1 ea 06          	shr    $0x6,%rdx
+  802741:	48 89 d0             	mov    %rdx,%rax
+  802744:	48 c1 e0 09          	shl    $0x9,%rax
+  802748:	48 29 d0             	sub    %rdx,%rax
+  80274b:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  802752:	00 
+  802753:	48 89 c8             	mov    %rcx,%rax
+  802756:	48 29 d0             	sub    %rdx,%rax
+  802759:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  80275e:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  802762:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  802766:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  802769:	49 83 c7 01          	add    $0x1,%r15
+  80276d:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  802771:	75 83                	jne    8026f6 <devpipe_read+0x4c>
+    return n;
+  802773:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802777:	eb 03                	jmp    80277c <devpipe_read+0xd2>
+            if (i > 0) return i;
+  802779:	4c 89 f8             	mov    %r15,%rax
+}
+  80277c:	48 83 c4 18          	add    $0x18,%rsp
+  802780:	5b                   	pop    %rbx
+  802781:	41 5c                	pop    %r12
+  802783:	41 5d                	pop    %r13
+  802785:	41 5e                	pop    %r14
+  802787:	41 5f                	pop    %r15
+  802789:	5d                   	pop    %rbp
+  80278a:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  80278b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802790:	eb ea                	jmp    80277c <devpipe_read+0xd2>
+
+0000000000802792 <pipe>:
+pipe(int pfd[2]) {
+  802792:	55                   	push   %rbp
+  802793:	48 89 e5             	mov    %rsp,%rbp
+  802796:	41 55                	push   %r13
+  802798:	41 54                	push   %r12
+  80279a:	53                   	push   %rbx
+  80279b:	48 81 ec b8 00 00 00 	sub    $0xb8,%rsp
+  8027a2:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8027a5:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  8027a9:	48 b8 0b 1a 80 00 00 	movabs $0x801a0b,%rax
+  8027b0:	00 00 00 
+  8027b3:	ff d0                	call   *%rax
+  8027b5:	89 c3                	mov    %eax,%ebx
+  8027b7:	85 c0                	test   %eax,%eax
+  8027b9:	0f 88 51 01 00 00    	js     802910 <pipe+0x17e>
+        (res = fd_alloc_from(fd2num(fd0) + 1, &fd1)) < 0) goto err;
+  8027bf:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8027c3:	48 b8 64 19 80 00 00 	movabs $0x801964,%rax
+  8027ca:	00 00 00 
+  8027cd:	ff d0                	call   *%rax
+  8027cf:	8d 78 01             	lea    0x1(%rax),%edi
+  8027d2:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8027d6:	48 b8 92 19 80 00 00 	movabs $0x801992,%rax
+  8027dd:	00 00 00 
+  8027e0:	ff d0                	call   *%rax
+  8027e2:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8027e4:	85 c0                	test   %eax,%eax
+  8027e6:	0f 88 24 01 00 00    	js     802910 <pipe+0x17e>
+    va = fd2data(fd0);
+  8027ec:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8027f0:	48 bb 76 19 80 00 00 	movabs $0x801976,%rbx
+  8027f7:	00 00 00 
+  8027fa:	ff d3                	call   *%rbx
+  8027fc:	49 89 c5             	mov    %rax,%r13
+    struct RegionOp ops[] = {
+  8027ff:	48 8d bd 30 ff ff ff 	lea    -0xd0(%rbp),%rdi
+  802806:	b9 14 00 00 00       	mov    $0x14,%ecx
+  80280b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802810:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+  802813:	c7 85 34 ff ff ff 46 	movl   $0x46,-0xcc(%rbp)
+  80281a:	00 00 00 
+  80281d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802821:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+  802828:	48 c7 85 50 ff ff ff 	movq   $0x1000,-0xb0(%rbp)
+  80282f:	00 10 00 00 
+  802833:	c7 85 5c ff ff ff 46 	movl   $0x46,-0xa4(%rbp)
+  80283a:	00 00 00 
+            {.type = REGION_ALLOC, .dstva = (uintptr_t)fd1, .size = PAGE_SIZE, .perm = PROT_RW | PROT_SHARE},
+  80283d:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+    struct RegionOp ops[] = {
+  802841:	48 89 bd 70 ff ff ff 	mov    %rdi,-0x90(%rbp)
+  802848:	48 c7 85 78 ff ff ff 	movq   $0x1000,-0x88(%rbp)
+  80284f:	00 10 00 00 
+  802853:	c7 45 84 46 00 00 00 	movl   $0x46,-0x7c(%rbp)
+  80285a:	4c 89 6d 98          	mov    %r13,-0x68(%rbp)
+  80285e:	48 c7 45 a0 00 10 00 	movq   $0x1000,-0x60(%rbp)
+  802865:	00 
+  802866:	c7 45 a8 01 00 00 00 	movl   $0x1,-0x58(%rbp)
+  80286d:	c7 45 ac 46 00 00 00 	movl   $0x46,-0x54(%rbp)
+  802874:	4c 89 6d b8          	mov    %r13,-0x48(%rbp)
+            {.type = REGION_MAP, .srcva = (uintptr_t)va, .dstva = (uintptr_t)fd2data(fd1), .size = PAGE_SIZE, .perm = PROT_RW | PROT_SHARE},
+  802878:	ff d3                	call   *%rbx
+    struct RegionOp ops[] = {
+  80287a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80287e:	48 c7 45 c8 00 10 00 	movq   $0x1000,-0x38(%rbp)
+  802885:	00 
+    if ((res = sys_region_batch(ops, sizeof ops / sizeof *ops)) < 0) goto err1;
+  802886:	be 04 00 00 00       	mov    $0x4,%esi
+  80288b:	48 8d bd 30 ff ff ff 	lea    -0xd0(%rbp),%rdi
+  802892:	48 b8 f8 14 80 00 00 	movabs $0x8014f8,%rax
+  802899:	00 00 00 
+  80289c:	ff d0                	call   *%rax
+  80289e:	89 c3                	mov    %eax,%ebx
+  8028a0:	85 c0                	test   %eax,%eax
+  8028a2:	0f 88 ad 00 00 00    	js     802955 <pipe+0x1c3>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8028a8:	be 00 10 00 00       	mov    $0x1000,%esi
+  8028ad:	4c 89 ef             	mov    %r13,%rdi
+  8028b0:	48 b8 67 13 80 00 00 	movabs $0x801367,%rax
+  8028b7:	00 00 00 
+  8028ba:	ff d0                	call   *%rax
+  8028bc:	83 f8 02             	cmp    $0x2,%eax
+  8028bf:	75 5f                	jne    802920 <pipe+0x18e>
+    fd0->fd_dev_id = devpipe.dev_id;
+  8028c1:	a1 60 40 80 00 00 00 	movabs 0x804060,%eax
+  8028c8:	00 00 
+  8028ca:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8028ce:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  8028d0:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8028d4:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  8028db:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8028df:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  8028e1:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8028e5:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  8028ec:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8028f0:	48 bb 64 19 80 00 00 	movabs $0x801964,%rbx
+  8028f7:	00 00 00 
+  8028fa:	ff d3                	call   *%rbx
+  8028fc:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  802900:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  802904:	ff d3                	call   *%rbx
+  802906:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  80290b:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  802910:	89 d8                	mov    %ebx,%eax
+  802912:	48 81 c4 b8 00 00 00 	add    $0xb8,%rsp
+  802919:	5b                   	pop    %rbx
+  80291a:	41 5c                	pop    %r12
+  80291c:	41 5d                	pop    %r13
+  80291e:	5d                   	pop    %rbp
+  80291f:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  802920:	48 b9 30 38 80 00 00 	movabs $0x803830,%rcx
+  802927:	00 00 00 
+  80292a:	48 ba 07 38 80 00 00 	movabs $0x803807,%rdx
+  802931:	00 00 00 
+  802934:	be 33 00 00 00       	mov    $0x33,%esi
+  802939:	48 bf 1c 38 80 00 00 	movabs $0x80381c,%rdi
+  802940:	00 00 00 
+  802943:	b8 00 00 00 00       	mov    $0x0,%eax
+  802948:	49 b8 a0 03 80 00 00 	movabs $0x8003a0,%r8
+  80294f:	00 00 00 
+  802952:	41 ff d0             	call   *%r8
+        ops[i].type = REGION_UNMAP;
+  802955:	c7 85 30 ff ff ff 02 	movl   $0x2,-0xd0(%rbp)
+  80295c:	00 00 00 
+  80295f:	c7 85 58 ff ff ff 02 	movl   $0x2,-0xa8(%rbp)
+  802966:	00 00 00 
+  802969:	c7 45 80 02 00 00 00 	movl   $0x2,-0x80(%rbp)
+  802970:	c7 45 a8 02 00 00 00 	movl   $0x2,-0x58(%rbp)
+    sys_region_batch(ops, sizeof ops / sizeof *ops);
+  802977:	be 04 00 00 00       	mov    $0x4,%esi
+  80297c:	48 8d bd 30 ff ff ff 	lea    -0xd0(%rbp),%rdi
+  802983:	48 b8 f8 14 80 00 00 	movabs $0x8014f8,%rax
+  80298a:	00 00 00 
+  80298d:	ff d0                	call   *%rax
+  80298f:	e9 7c ff ff ff       	jmp    802910 <pipe+0x17e>
+
+0000000000802994 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  802994:	55                   	push   %rbp
+  802995:	48 89 e5             	mov    %rsp,%rbp
+  802998:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  80299c:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8029a0:	48 b8 25 1a 80 00 00 	movabs $0x801a25,%rax
+  8029a7:	00 00 00 
+  8029aa:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8029ac:	85 c0                	test   %eax,%eax
+  8029ae:	78 35                	js     8029e5 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  8029b0:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8029b4:	48 b8 76 19 80 00 00 	movabs $0x801976,%rax
+  8029bb:	00 00 00 
+  8029be:	ff d0                	call   *%rax
+  8029c0:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8029c3:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8029c8:	be 00 10 00 00       	mov    $0x1000,%esi
+  8029cd:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8029d1:	48 b8 99 13 80 00 00 	movabs $0x801399,%rax
+  8029d8:	00 00 00 
+  8029db:	ff d0                	call   *%rax
+  8029dd:	85 c0                	test   %eax,%eax
+  8029df:	0f 94 c0             	sete   %al
+  8029e2:	0f b6 c0             	movzbl %al,%eax
+}
+  8029e5:	c9                   	leave
+  8029e6:	c3                   	ret
+
+00000000008029e7 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8029e7:	48 89 f8             	mov    %rdi,%rax
+  8029ea:	48 c1 e8 27          	shr    $0x27,%rax
+  8029ee:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  8029f5:	01 00 00 
+  8029f8:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8029fc:	f6 c2 01             	test   $0x1,%dl
+  8029ff:	74 6d                	je     802a6e <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  802a01:	48 89 f8             	mov    %rdi,%rax
+  802a04:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802a08:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802a0f:	01 00 00 
+  802a12:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802a16:	f6 c2 01             	test   $0x1,%dl
+  802a19:	74 62                	je     802a7d <get_uvpt_entry+0x96>
+  802a1b:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802a22:	01 00 00 
+  802a25:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802a29:	f6 c2 80             	test   $0x80,%dl
+  802a2c:	75 4f                	jne    802a7d <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  802a2e:	48 89 f8             	mov    %rdi,%rax
+  802a31:	48 c1 e8 15          	shr    $0x15,%rax
+  802a35:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802a3c:	01 00 00 
+  802a3f:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802a43:	f6 c2 01             	test   $0x1,%dl
+  802a46:	74 44                	je     802a8c <get_uvpt_entry+0xa5>
+  802a48:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802a4f:	01 00 00 
+  802a52:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802a56:	f6 c2 80             	test   $0x80,%dl
+  802a59:	75 31                	jne    802a8c <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  802a5b:	48 c1 ef 0c          	shr    $0xc,%rdi
+  802a5f:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802a66:	01 00 00 
+  802a69:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  802a6d:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  802a6e:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  802a75:	01 00 00 
+  802a78:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802a7c:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  802a7d:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802a84:	01 00 00 
+  802a87:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802a8b:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  802a8c:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802a93:	01 00 00 
+  802a96:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802a9a:	c3                   	ret
+
+0000000000802a9b <get_prot>:
+
+int
+get_prot(void *va) {
+  802a9b:	55                   	push   %rbp
+  802a9c:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  802a9f:	48 b8 e7 29 80 00 00 	movabs $0x8029e7,%rax
+  802aa6:	00 00 00 
+  802aa9:	ff d0                	call   *%rax
+  802aab:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  802aae:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  802ab3:	89 c1                	mov    %eax,%ecx
+  802ab5:	83 c9 04             	or     $0x4,%ecx
+  802ab8:	f6 c2 01             	test   $0x1,%dl
+  802abb:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  802abe:	89 c1                	mov    %eax,%ecx
+  802ac0:	83 c9 02             	or     $0x2,%ecx
+  802ac3:	f6 c2 02             	test   $0x2,%dl
+  802ac6:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  802ac9:	89 c1                	mov    %eax,%ecx
+  802acb:	83 c9 01             	or     $0x1,%ecx
+  802ace:	48 85 d2             	test   %rdx,%rdx
+  802ad1:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  802ad4:	89 c1                	mov    %eax,%ecx
+  802ad6:	83 c9 40             	or     $0x40,%ecx
+  802ad9:	f6 c6 04             	test   $0x4,%dh
+  802adc:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  802adf:	5d                   	pop    %rbp
+  802ae0:	c3                   	ret
+
+0000000000802ae1 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  802ae1:	55                   	push   %rbp
+  802ae2:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  802ae5:	48 b8 e7 29 80 00 00 	movabs $0x8029e7,%rax
+  802aec:	00 00 00 
+  802aef:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  802af1:	48 c1 e8 06          	shr    $0x6,%rax
+  802af5:	83 e0 01             	and    $0x1,%eax
+}
+  802af8:	5d                   	pop    %rbp
+  802af9:	c3                   	ret
+
+0000000000802afa <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  802afa:	55                   	push   %rbp
+  802afb:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  802afe:	48 b8 e7 29 80 00 00 	movabs $0x8029e7,%rax
+  802b05:	00 00 00 
+  802b08:	ff d0                	call   *%rax
+  802b0a:	83 e0 01             	and    $0x1,%eax
+}
+  802b0d:	5d                   	pop    %rbp
+  802b0e:	c3                   	ret
+
+0000000000802b0f <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  802b0f:	55                   	push   %rbp
+  802b10:	48 89 e5             	mov    %rsp,%rbp
+  802b13:	41 57                	push   %r15
+  802b15:	41 56                	push   %r14
+  802b17:	41 55                	push   %r13
+  802b19:	41 54                	push   %r12
+  802b1b:	53                   	push   %rbx
+  802b1c:	48 83 ec 38          	sub    $0x38,%rsp
+  802b20:	49 89 f7             	mov    %rsi,%r15
+  802b23:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+                    }
+                    continue;
+                }
+                for (int ptei = 0; ptei < PT_ENTRY_COUNT; ptei++) {
+                    uintptr_t pte_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, pdei, ptei, 0);
+                    pte_t pte = uvpt[VPT(pte_addr)];
+  802b29:	49 bd 00 00 00 00 00 	movabs $0x10000000000,%r13
+  802b30:	01 00 00 
+  802b33:	4d 89 e6             	mov    %r12,%r14
+  802b36:	49 89 fc             	mov    %rdi,%r12
+  802b39:	e9 19 01 00 00       	jmp    802c57 <foreach_shared_region+0x148>
+  802b3e:	48 89 5d b0          	mov    %rbx,-0x50(%rbp)
+  802b42:	4c 89 75 a8          	mov    %r14,-0x58(%rbp)
+  802b46:	eb 52                	jmp    802b9a <foreach_shared_region+0x8b>
+                for (int ptei = 0; ptei < PT_ENTRY_COUNT; ptei++) {
+  802b48:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802b4f:	48 81 fb 00 00 20 00 	cmp    $0x200000,%rbx
+  802b56:	74 2e                	je     802b86 <foreach_shared_region+0x77>
+                    uintptr_t pte_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, pdei, ptei, 0);
+  802b58:	48 89 df             	mov    %rbx,%rdi
+  802b5b:	4c 09 f7             	or     %r14,%rdi
+                    pte_t pte = uvpt[VPT(pte_addr)];
+  802b5e:	48 89 f8             	mov    %rdi,%rax
+  802b61:	48 c1 e8 0c          	shr    $0xc,%rax
+  802b65:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+                    if ((pte & PTE_P) && (pte & PTE_SHARE)) {
+  802b6a:	25 01 04 00 00       	and    $0x401,%eax
+  802b6f:	48 3d 01 04 00 00    	cmp    $0x401,%rax
+  802b75:	75 d1                	jne    802b48 <foreach_shared_region+0x39>
+                        fun((void*)pte_addr, (void*)(pte_addr + PAGE_SIZE), arg);
+  802b77:	48 8d b7 00 10 00 00 	lea    0x1000(%rdi),%rsi
+  802b7e:	4c 89 fa             	mov    %r15,%rdx
+  802b81:	41 ff d4             	call   *%r12
+  802b84:	eb c2                	jmp    802b48 <foreach_shared_region+0x39>
+            for (int pdei = 0; pdei < PD_ENTRY_COUNT; pdei++) {
+  802b86:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  802b8d:	00 
+  802b8e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802b92:	48 3d 00 00 00 40    	cmp    $0x40000000,%rax
+  802b98:	74 46                	je     802be0 <foreach_shared_region+0xd1>
+                uintptr_t pde_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, pdei, 0, 0);
+  802b9a:	4c 8b 75 c8          	mov    -0x38(%rbp),%r14
+  802b9e:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802ba2:	49 09 c6             	or     %rax,%r14
+                pde_t pde = uvpd[VPD(pde_addr)];
+  802ba5:	4c 89 f0             	mov    %r14,%rax
+  802ba8:	48 c1 e8 15          	shr    $0x15,%rax
+  802bac:	48 b9 00 00 00 80 00 	movabs $0x10080000000,%rcx
+  802bb3:	01 00 00 
+  802bb6:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+                if (!(pde & PTE_P)) {
+  802bba:	a8 01                	test   $0x1,%al
+  802bbc:	74 c8                	je     802b86 <foreach_shared_region+0x77>
+                if (pde & PTE_PS) {
+  802bbe:	48 89 c3             	mov    %rax,%rbx
+  802bc1:	81 e3 80 00 00 00    	and    $0x80,%ebx
+  802bc7:	74 8f                	je     802b58 <foreach_shared_region+0x49>
+                    if (pde & PTE_SHARE) {
+  802bc9:	f6 c4 04             	test   $0x4,%ah
+  802bcc:	74 b8                	je     802b86 <foreach_shared_region+0x77>
+                        fun((void*)pde_addr, (void*)(pde_addr + 1024 * 1024 * 2), arg);
+  802bce:	49 8d b6 00 00 20 00 	lea    0x200000(%r14),%rsi
+  802bd5:	4c 89 fa             	mov    %r15,%rdx
+  802bd8:	4c 89 f7             	mov    %r14,%rdi
+  802bdb:	41 ff d4             	call   *%r12
+  802bde:	eb a6                	jmp    802b86 <foreach_shared_region+0x77>
+  802be0:	48 8b 5d b0          	mov    -0x50(%rbp),%rbx
+  802be4:	4c 8b 75 a8          	mov    -0x58(%rbp),%r14
+        for (int pdpei = 0; pdpei < PDP_ENTRY_COUNT; pdpei++) {
+  802be8:	48 81 c3 00 00 00 40 	add    $0x40000000,%rbx
+  802bef:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802bf6:	00 00 00 
+  802bf9:	48 39 c3             	cmp    %rax,%rbx
+  802bfc:	74 4c                	je     802c4a <foreach_shared_region+0x13b>
+            uintptr_t pdpe_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, 0, 0, 0);
+  802bfe:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802c02:	48 09 d8             	or     %rbx,%rax
+  802c05:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+            pdpe_t pdpe = uvpdp[VPDP(pdpe_addr)];
+  802c09:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802c0d:	48 b9 00 00 40 80 00 	movabs $0x10080400000,%rcx
+  802c14:	01 00 00 
+  802c17:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+            if (!(pdpe & PTE_P)) {
+  802c1b:	a8 01                	test   $0x1,%al
+  802c1d:	74 c9                	je     802be8 <foreach_shared_region+0xd9>
+            if (pdpe & PTE_PS) {
+  802c1f:	48 89 c1             	mov    %rax,%rcx
+  802c22:	81 e1 80 00 00 00    	and    $0x80,%ecx
+  802c28:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  802c2c:	0f 84 0c ff ff ff    	je     802b3e <foreach_shared_region+0x2f>
+                if (pdpe & PTE_SHARE) {
+  802c32:	f6 c4 04             	test   $0x4,%ah
+  802c35:	74 b1                	je     802be8 <foreach_shared_region+0xd9>
+                    fun((void*)pdpe_addr, (void*)(pdpe_addr + 1024 * 1024 * 1024), arg); 
+  802c37:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  802c3b:	48 8d b7 00 00 00 40 	lea    0x40000000(%rdi),%rsi
+  802c42:	4c 89 fa             	mov    %r15,%rdx
+  802c45:	41 ff d4             	call   *%r12
+  802c48:	eb 9e                	jmp    802be8 <foreach_shared_region+0xd9>
+    for (int pml4ei = 0; pml4ei < PML4_ENTRY_COUNT; pml4ei++) {
+  802c4a:	49 83 c6 01          	add    $0x1,%r14
+  802c4e:	49 81 fe 00 02 00 00 	cmp    $0x200,%r14
+  802c55:	74 24                	je     802c7b <foreach_shared_region+0x16c>
+        pml4e_t pml4e = uvpml4[VPML4(pml4_addr)];
+  802c57:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  802c5e:	01 00 00 
+  802c61:	4a 8b 04 f0          	mov    (%rax,%r14,8),%rax
+        if (!(pml4e & PTE_P)) {
+  802c65:	a8 01                	test   $0x1,%al
+  802c67:	74 e1                	je     802c4a <foreach_shared_region+0x13b>
+  802c69:	4c 89 f0             	mov    %r14,%rax
+  802c6c:	48 c1 e0 27          	shl    $0x27,%rax
+  802c70:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  802c74:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802c79:	eb 83                	jmp    802bfe <foreach_shared_region+0xef>
+            }
+        }
+    }
+    
+    return 0;
+}
+  802c7b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c80:	48 83 c4 38          	add    $0x38,%rsp
+  802c84:	5b                   	pop    %rbx
+  802c85:	41 5c                	pop    %r12
+  802c87:	41 5d                	pop    %r13
+  802c89:	41 5e                	pop    %r14
+  802c8b:	41 5f                	pop    %r15
+  802c8d:	5d                   	pop    %rbp
+  802c8e:	c3                   	ret
+
+0000000000802c8f <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  802c8f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c94:	c3                   	ret
+
+0000000000802c95 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  802c95:	55                   	push   %rbp
+  802c96:	48 89 e5             	mov    %rsp,%rbp
+  802c99:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  802c9c:	48 be 54 38 80 00 00 	movabs $0x803854,%rsi
+  802ca3:	00 00 00 
+  802ca6:	48 b8 15 0e 80 00 00 	movabs $0x800e15,%rax
+  802cad:	00 00 00 
+  802cb0:	ff d0                	call   *%rax
+    return 0;
+}
+  802cb2:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cb7:	5d                   	pop    %rbp
+  802cb8:	c3                   	ret
+
+0000000000802cb9 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  802cb9:	55                   	push   %rbp
+  802cba:	48 89 e5             	mov    %rsp,%rbp
+  802cbd:	41 57                	push   %r15
+  802cbf:	41 56                	push   %r14
+  802cc1:	41 55                	push   %r13
+  802cc3:	41 54                	push   %r12
+  802cc5:	53                   	push   %rbx
+  802cc6:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  802ccd:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  802cd4:	48 85 d2             	test   %rdx,%rdx
+  802cd7:	74 7a                	je     802d53 <devcons_write+0x9a>
+  802cd9:	49 89 d6             	mov    %rdx,%r14
+  802cdc:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802ce2:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  802ce7:	49 bf 0f 10 80 00 00 	movabs $0x80100f,%r15
+  802cee:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  802cf1:	4c 89 f3             	mov    %r14,%rbx
+  802cf4:	48 29 f3             	sub    %rsi,%rbx
+  802cf7:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802cfc:	48 39 c3             	cmp    %rax,%rbx
+  802cff:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  802d03:	4c 63 eb             	movslq %ebx,%r13
+  802d06:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  802d0d:	48 01 c6             	add    %rax,%rsi
+  802d10:	4c 89 ea             	mov    %r13,%rdx
+  802d13:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802d1a:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  802d1d:	4c 89 ee             	mov    %r13,%rsi
+  802d20:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802d27:	48 b8 3c 12 80 00 00 	movabs $0x80123c,%rax
+  802d2e:	00 00 00 
+  802d31:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  802d33:	41 01 dc             	add    %ebx,%r12d
+  802d36:	49 63 f4             	movslq %r12d,%rsi
+  802d39:	4c 39 f6             	cmp    %r14,%rsi
+  802d3c:	72 b3                	jb     802cf1 <devcons_write+0x38>
+    return res;
+  802d3e:	49 63 c4             	movslq %r12d,%rax
+}
+  802d41:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  802d48:	5b                   	pop    %rbx
+  802d49:	41 5c                	pop    %r12
+  802d4b:	41 5d                	pop    %r13
+  802d4d:	41 5e                	pop    %r14
+  802d4f:	41 5f                	pop    %r15
+  802d51:	5d                   	pop    %rbp
+  802d52:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  802d53:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802d59:	eb e3                	jmp    802d3e <devcons_write+0x85>
+
+0000000000802d5b <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  802d5b:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  802d5e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802d63:	48 85 c0             	test   %rax,%rax
+  802d66:	74 55                	je     802dbd <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  802d68:	55                   	push   %rbp
+  802d69:	48 89 e5             	mov    %rsp,%rbp
+  802d6c:	41 55                	push   %r13
+  802d6e:	41 54                	push   %r12
+  802d70:	53                   	push   %rbx
+  802d71:	48 83 ec 08          	sub    $0x8,%rsp
+  802d75:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  802d78:	48 bb 69 12 80 00 00 	movabs $0x801269,%rbx
+  802d7f:	00 00 00 
+  802d82:	49 bc 36 13 80 00 00 	movabs $0x801336,%r12
+  802d89:	00 00 00 
+  802d8c:	eb 03                	jmp    802d91 <devcons_read+0x36>
+  802d8e:	41 ff d4             	call   *%r12
+  802d91:	ff d3                	call   *%rbx
+  802d93:	85 c0                	test   %eax,%eax
+  802d95:	74 f7                	je     802d8e <devcons_read+0x33>
+    if (c < 0) return c;
+  802d97:	48 63 d0             	movslq %eax,%rdx
+  802d9a:	78 13                	js     802daf <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  802d9c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802da1:	83 f8 04             	cmp    $0x4,%eax
+  802da4:	74 09                	je     802daf <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  802da6:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  802daa:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  802daf:	48 89 d0             	mov    %rdx,%rax
+  802db2:	48 83 c4 08          	add    $0x8,%rsp
+  802db6:	5b                   	pop    %rbx
+  802db7:	41 5c                	pop    %r12
+  802db9:	41 5d                	pop    %r13
+  802dbb:	5d                   	pop    %rbp
+  802dbc:	c3                   	ret
+  802dbd:	48 89 d0             	mov    %rdx,%rax
+  802dc0:	c3                   	ret
+
+0000000000802dc1 <cputchar>:
+cputchar(int ch) {
+  802dc1:	55                   	push   %rbp
+  802dc2:	48 89 e5             	mov    %rsp,%rbp
+  802dc5:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  802dc9:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  802dcd:	be 01 00 00 00       	mov    $0x1,%esi
+  802dd2:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  802dd6:	48 b8 3c 12 80 00 00 	movabs $0x80123c,%rax
+  802ddd:	00 00 00 
+  802de0:	ff d0                	call   *%rax
+}
+  802de2:	c9                   	leave
+  802de3:	c3                   	ret
+
+0000000000802de4 <getchar>:
+getchar(void) {
+  802de4:	55                   	push   %rbp
+  802de5:	48 89 e5             	mov    %rsp,%rbp
+  802de8:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  802dec:	ba 01 00 00 00       	mov    $0x1,%edx
+  802df1:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  802df5:	bf 00 00 00 00       	mov    $0x0,%edi
+  802dfa:	48 b8 08 1d 80 00 00 	movabs $0x801d08,%rax
+  802e01:	00 00 00 
+  802e04:	ff d0                	call   *%rax
+  802e06:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  802e08:	85 c0                	test   %eax,%eax
+  802e0a:	78 06                	js     802e12 <getchar+0x2e>
+  802e0c:	74 08                	je     802e16 <getchar+0x32>
+  802e0e:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  802e12:	89 d0                	mov    %edx,%eax
+  802e14:	c9                   	leave
+  802e15:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  802e16:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  802e1b:	eb f5                	jmp    802e12 <getchar+0x2e>
+
+0000000000802e1d <iscons>:
+iscons(int fdnum) {
+  802e1d:	55                   	push   %rbp
+  802e1e:	48 89 e5             	mov    %rsp,%rbp
+  802e21:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  802e25:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802e29:	48 b8 25 1a 80 00 00 	movabs $0x801a25,%rax
+  802e30:	00 00 00 
+  802e33:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802e35:	85 c0                	test   %eax,%eax
+  802e37:	78 18                	js     802e51 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  802e39:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802e3d:	48 b8 a0 40 80 00 00 	movabs $0x8040a0,%rax
+  802e44:	00 00 00 
+  802e47:	8b 00                	mov    (%rax),%eax
+  802e49:	39 02                	cmp    %eax,(%rdx)
+  802e4b:	0f 94 c0             	sete   %al
+  802e4e:	0f b6 c0             	movzbl %al,%eax
+}
+  802e51:	c9                   	leave
+  802e52:	c3                   	ret
+
+0000000000802e53 <opencons>:
+opencons(void) {
+  802e53:	55                   	push   %rbp
+  802e54:	48 89 e5             	mov    %rsp,%rbp
+  802e57:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802e5b:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  802e5f:	48 b8 0b 1a 80 00 00 	movabs $0x801a0b,%rax
+  802e66:	00 00 00 
+  802e69:	ff d0                	call   *%rax
+  802e6b:	85 c0                	test   %eax,%eax
+  802e6d:	78 49                	js     802eb8 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  802e6f:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802e74:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802e79:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  802e7d:	bf 00 00 00 00       	mov    $0x0,%edi
+  802e82:	48 b8 c5 13 80 00 00 	movabs $0x8013c5,%rax
+  802e89:	00 00 00 
+  802e8c:	ff d0                	call   *%rax
+  802e8e:	85 c0                	test   %eax,%eax
+  802e90:	78 26                	js     802eb8 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  802e92:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802e96:	a1 a0 40 80 00 00 00 	movabs 0x8040a0,%eax
+  802e9d:	00 00 
+  802e9f:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  802ea1:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802ea5:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  802eac:	48 b8 64 19 80 00 00 	movabs $0x801964,%rax
+  802eb3:	00 00 00 
+  802eb6:	ff d0                	call   *%rax
+}
+  802eb8:	c9                   	leave
+  802eb9:	c3                   	ret
+
+0000000000802eba <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  802eba:	55                   	push   %rbp
+  802ebb:	48 89 e5             	mov    %rsp,%rbp
+  802ebe:	41 55                	push   %r13
+  802ec0:	41 54                	push   %r12
+  802ec2:	53                   	push   %rbx
+  802ec3:	48 83 ec 08          	sub    $0x8,%rsp
+  802ec7:	49 89 fc             	mov    %rdi,%r12
+  802eca:	48 89 f7             	mov    %rsi,%rdi
+  802ecd:	48 89 d3             	mov    %rdx,%rbx
+  802ed0:	49 89 cd             	mov    %rcx,%r13
+    // LAB 9: Your code here:
+    int res = sys_ipc_recv(!pg ? (void*)MAX_USER_ADDRESS : pg, !size ? 0 : *size);
+  802ed3:	be 00 00 00 00       	mov    $0x0,%esi
+  802ed8:	48 85 d2             	test   %rdx,%rdx
+  802edb:	74 03                	je     802ee0 <ipc_recv+0x26>
+  802edd:	48 8b 32             	mov    (%rdx),%rsi
+  802ee0:	48 85 ff             	test   %rdi,%rdi
+  802ee3:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802eea:	00 00 00 
+  802eed:	48 0f 44 f8          	cmove  %rax,%rdi
+  802ef1:	48 b8 97 17 80 00 00 	movabs $0x801797,%rax
+  802ef8:	00 00 00 
+  802efb:	ff d0                	call   *%rax
+    if (res < 0) {
+  802efd:	85 c0                	test   %eax,%eax
+  802eff:	78 66                	js     802f67 <ipc_recv+0xad>
+        if (size) {
+            *size = 0;
+        }
+        return res;
+    }
+    if (from_env_store) {
+  802f01:	4d 85 e4             	test   %r12,%r12
+  802f04:	74 14                	je     802f1a <ipc_recv+0x60>
+        *from_env_store = thisenv->env_ipc_from;
+  802f06:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802f0d:	00 00 00 
+  802f10:	8b 80 ac 01 00 00    	mov    0x1ac(%rax),%eax
+  802f16:	41 89 04 24          	mov    %eax,(%r12)
+    }
+    if (perm_store) {
+  802f1a:	4d 85 ed             	test   %r13,%r13
+  802f1d:	74 14                	je     802f33 <ipc_recv+0x79>
+        *perm_store = thisenv->env_ipc_perm;
+  802f1f:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802f26:	00 00 00 
+  802f29:	8b 80 b0 01 00 00    	mov    0x1b0(%rax),%eax
+  802f2f:	41 89 45 00          	mov    %eax,0x0(%r13)
+    }
+    if (size) {
+  802f33:	48 85 db             	test   %rbx,%rbx
+  802f36:	74 14                	je     802f4c <ipc_recv+0x92>
+        *size = thisenv->env_ipc_maxsz;
+  802f38:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802f3f:	00 00 00 
+  802f42:	48 8b 80 a0 01 00 00 	mov    0x1a0(%rax),%rax
+  802f49:	48 89 03             	mov    %rax,(%rbx)
+    }
+    return thisenv->env_ipc_value;
+  802f4c:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802f53:	00 00 00 
+  802f56:	8b 80 a8 01 00 00    	mov    0x1a8(%rax),%eax
+}
+  802f5c:	48 83 c4 08          	add    $0x8,%rsp
+  802f60:	5b                   	pop    %rbx
+  802f61:	41 5c                	pop    %r12
+  802f63:	41 5d                	pop    %r13
+  802f65:	5d                   	pop    %rbp
+  802f66:	c3                   	ret
+        if (from_env_store) {
+  802f67:	4d 85 e4             	test   %r12,%r12
+  802f6a:	74 08                	je     802f74 <ipc_recv+0xba>
+            *from_env_store = 0;
+  802f6c:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  802f73:	00 
+        if (perm_store) {
+  802f74:	4d 85 ed             	test   %r13,%r13
+  802f77:	74 08                	je     802f81 <ipc_recv+0xc7>
+            *perm_store = 0;
+  802f79:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  802f80:	00 
+        if (size) {
+  802f81:	48 85 db             	test   %rbx,%rbx
+  802f84:	74 d6                	je     802f5c <ipc_recv+0xa2>
+            *size = 0;
+  802f86:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  802f8d:	eb cd                	jmp    802f5c <ipc_recv+0xa2>
+
+0000000000802f8f <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  802f8f:	55                   	push   %rbp
+  802f90:	48 89 e5             	mov    %rsp,%rbp
+  802f93:	41 57                	push   %r15
+  802f95:	41 56                	push   %r14
+  802f97:	41 55                	push   %r13
+  802f99:	41 54                	push   %r12
+  802f9b:	53                   	push   %rbx
+  802f9c:	48 83 ec 18          	sub    $0x18,%rsp
+  802fa0:	41 89 fd             	mov    %edi,%r13d
+  802fa3:	89 75 cc             	mov    %esi,-0x34(%rbp)
+  802fa6:	49 89 cc             	mov    %rcx,%r12
+  802fa9:	44 89 45 c8          	mov    %r8d,-0x38(%rbp)
+    // LAB 9: Your code here:
+    int res = 0;
+    while ((res = sys_ipc_try_send(to_env, val, !pg ? (void*)MAX_USER_ADDRESS : pg, size, perm)) < 0) {
+  802fad:	48 85 d2             	test   %rdx,%rdx
+  802fb0:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802fb7:	00 00 00 
+  802fba:	48 0f 45 c2          	cmovne %rdx,%rax
+  802fbe:	48 89 c3             	mov    %rax,%rbx
+  802fc1:	49 be 6b 17 80 00 00 	movabs $0x80176b,%r14
+  802fc8:	00 00 00 
+        if (res != -E_IPC_NOT_RECV) {
+            panic("sys_ipc_try_send failed: %i", res);
+        }
+        sys_yield();
+  802fcb:	49 bf 36 13 80 00 00 	movabs $0x801336,%r15
+  802fd2:	00 00 00 
+    while ((res = sys_ipc_try_send(to_env, val, !pg ? (void*)MAX_USER_ADDRESS : pg, size, perm)) < 0) {
+  802fd5:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  802fd8:	44 8b 45 c8          	mov    -0x38(%rbp),%r8d
+  802fdc:	4c 89 e1             	mov    %r12,%rcx
+  802fdf:	48 89 da             	mov    %rbx,%rdx
+  802fe2:	44 89 ef             	mov    %r13d,%edi
+  802fe5:	41 ff d6             	call   *%r14
+  802fe8:	85 c0                	test   %eax,%eax
+  802fea:	79 37                	jns    803023 <ipc_send+0x94>
+        if (res != -E_IPC_NOT_RECV) {
+  802fec:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  802fef:	75 05                	jne    802ff6 <ipc_send+0x67>
+        sys_yield();
+  802ff1:	41 ff d7             	call   *%r15
+  802ff4:	eb df                	jmp    802fd5 <ipc_send+0x46>
+            panic("sys_ipc_try_send failed: %i", res);
+  802ff6:	89 c1                	mov    %eax,%ecx
+  802ff8:	48 ba 60 38 80 00 00 	movabs $0x803860,%rdx
+  802fff:	00 00 00 
+  803002:	be 40 00 00 00       	mov    $0x40,%esi
+  803007:	48 bf 7c 38 80 00 00 	movabs $0x80387c,%rdi
+  80300e:	00 00 00 
+  803011:	b8 00 00 00 00       	mov    $0x0,%eax
+  803016:	49 b8 a0 03 80 00 00 	movabs $0x8003a0,%r8
+  80301d:	00 00 00 
+  803020:	41 ff d0             	call   *%r8
+    }
+    return;
+}
+  803023:	48 83 c4 18          	add    $0x18,%rsp
+  803027:	5b                   	pop    %rbx
+  803028:	41 5c                	pop    %r12
+  80302a:	41 5d                	pop    %r13
+  80302c:	41 5e                	pop    %r14
+  80302e:	41 5f                	pop    %r15
+  803030:	5d                   	pop    %rbp
+  803031:	c3                   	ret
+
+0000000000803032 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  803032:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  803037:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  80303e:	00 00 00 
+  803041:	48 69 d0 d0 01 00 00 	imul   $0x1d0,%rax,%rdx
+  803048:	48 01 ca             	add    %rcx,%rdx
+  80304b:	8b 92 e8 00 00 00    	mov    0xe8(%rdx),%edx
+  803051:	39 fa                	cmp    %edi,%edx
+  803053:	74 12                	je     803067 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  803055:	48 83 c0 01          	add    $0x1,%rax
+  803059:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  80305f:	75 e0                	jne    803041 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  803061:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803066:	c3                   	ret
+            return envs[i].env_id;
+  803067:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+  80306e:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  803075:	00 00 00 
+  803078:	48 01 d0             	add    %rdx,%rax
+  80307b:	8b 80 e0 00 00 00    	mov    0xe0(%rax),%eax
+  803081:	c3                   	ret
+  803082:	66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+
+0000000000803088 <__rodata_start>:
+  803088:	72 65                	jb     8030ef <__rodata_start+0x67>
+  80308a:	6a 65                	push   $0x65
+  80308c:	63 74 65 64          	movsxd 0x64(%rbp,%riz,2),%esi
+  803090:	00 41 44             	add    %al,0x44(%rcx)
+  803093:	4d                   	rex.WRB
+  803094:	49 54                	rex.WB push %r12
+  803096:	54                   	push   %rsp
+  803097:	45                   	rex.RB
+  803098:	44 00 66 6f          	add    %r12b,0x6f(%rsi)
+  80309c:	72 6b                	jb     803109 <__rodata_start+0x81>
+  80309e:	3a 20                	cmp    (%rax),%ah
+  8030a0:	25 69 00 75 73       	and    $0x73750069,%eax
+  8030a5:	65 72 2f             	gs jb  8030d7 <__rodata_start+0x4f>
+  8030a8:	72 74                	jb     80311e <__rodata_start+0x96>
+  8030aa:	6a 69                	push   $0x69
+  8030ac:	74 74                	je     803122 <__rodata_start+0x9a>
+  8030ae:	65 72 2e             	gs jb  8030df <__rodata_start+0x57>
+  8030b1:	63 00                	movsxd (%rax),%eax
+  8030b3:	73 79                	jae    80312e <__rodata_start+0xa6>
+  8030b5:	73 5f                	jae    803116 <__rodata_start+0x8e>
+  8030b7:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  8030b9:	76 5f                	jbe    80311a <__rodata_start+0x92>
+  8030bb:	73 65                	jae    803122 <__rodata_start+0x9a>
+  8030bd:	74 5f                	je     80311e <__rodata_start+0x96>
+  8030bf:	72 74                	jb     803135 <__rodata_start+0xad>
+  8030c1:	3a 20                	cmp    (%rax),%ah
+  8030c3:	25 69 00 20 20       	and    $0x20200069,%eax
+  8030c8:	3c 20                	cmp    $0x20,%al
+  8030ca:	32 5e 25             	xor    0x25(%rsi),%bl
+  8030cd:	2d 32 64 20 63       	sub    $0x63206432,%eax
+  8030d2:	79 63                	jns    803137 <__rodata_start+0xaf>
+  8030d4:	6c                   	insb   (%dx),%es:(%rdi)
+  8030d5:	65 73 3a             	gs jae 803112 <__rodata_start+0x8a>
+  8030d8:	20 25 6c 75 0a 00    	and    %ah,0xa756c(%rip)        # 8aa64a <__bss_end+0xa264a>
+  8030de:	66 90                	xchg   %ax,%ax
+  8030e0:	72 74                	jb     803156 <__rodata_start+0xce>
+  8030e2:	6a 69                	push   $0x69
+  8030e4:	74 74                	je     80315a <__rodata_start+0xd2>
+  8030e6:	65 72 3a             	gs jb  803123 <__rodata_start+0x9b>
+  8030e9:	20 6f 76             	and    %ch,0x76(%rdi)
+  8030ec:	65 72 6c             	gs jb  80315b <__rodata_start+0xd3>
+  8030ef:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8030f0:	61                   	(bad)
+  8030f1:	64 69 6e 67 20 72 65 	imul   $0x73657220,%fs:0x67(%rsi),%ebp
+  8030f8:	73 
+  8030f9:	65 72 76             	gs jb  803172 <__rodata_start+0xea>
+  8030fc:	61                   	(bad)
+  8030fd:	74 69                	je     803168 <__rodata_start+0xe0>
+  8030ff:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803100:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803101:	20 25 73 0a 00 00    	and    %ah,0xa73(%rip)        # 803b7a <devtab+0x39a>
+  803107:	00 72 74             	add    %dh,0x74(%rdx)
+  80310a:	6a 69                	push   $0x69
+  80310c:	74 74                	je     803182 <__rodata_start+0xfa>
+  80310e:	65 72 3a             	gs jb  80314b <__rodata_start+0xc3>
+  803111:	20 25 64 20 70 65    	and    %ah,0x65702064(%rip)        # 65f0517b <__bss_end+0x656fd17b>
+  803117:	72 69                	jb     803182 <__rodata_start+0xfa>
+  803119:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80311a:	64 73 20             	fs jae 80313d <__rodata_start+0xb5>
+  80311d:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80311e:	66 20 25 6c 75 20 63 	data16 and %ah,0x6320756c(%rip)        # 63a0a691 <__bss_end+0x63202691>
+  803125:	79 63                	jns    80318a <__rodata_start+0x102>
+  803127:	6c                   	insb   (%dx),%es:(%rdi)
+  803128:	65 73 2c             	gs jae 803157 <__rodata_start+0xcf>
+  80312b:	20 77 61             	and    %dh,0x61(%rdi)
+  80312e:	6b 65 2d 75          	imul   $0x75,0x2d(%rbp),%esp
+  803132:	70 20                	jo     803154 <__rodata_start+0xcc>
+  803134:	6c                   	insb   (%dx),%es:(%rdi)
+  803135:	61                   	(bad)
+  803136:	74 65                	je     80319d <__rodata_start+0x115>
+  803138:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803139:	63 79 20             	movsxd 0x20(%rcx),%edi
+  80313c:	61                   	(bad)
+  80313d:	76 67                	jbe    8031a6 <__rodata_start+0x11e>
+  80313f:	20 25 6c 75 20 6d    	and    %ah,0x6d20756c(%rip)        # 6da0a6b1 <__bss_end+0x6d2026b1>
+  803145:	61                   	(bad)
+  803146:	78 20                	js     803168 <__rodata_start+0xe0>
+  803148:	25 6c 75 20 63       	and    $0x6320756c,%eax
+  80314d:	79 63                	jns    8031b2 <__rodata_start+0x12a>
+  80314f:	6c                   	insb   (%dx),%es:(%rdi)
+  803150:	65 73 2c             	gs jae 80317f <__rodata_start+0xf7>
+  803153:	20 25 6c 75 20 64    	and    %ah,0x6420756c(%rip)        # 64a0a6c5 <__bss_end+0x642026c5>
+  803159:	65 61                	gs (bad)
+  80315b:	64 6c                	fs insb (%dx),%es:(%rdi)
+  80315d:	69 6e 65 73 20 6d 69 	imul   $0x696d2073,0x65(%rsi),%ebp
+  803164:	73 73                	jae    8031d9 <__rodata_start+0x151>
+  803166:	65 64 0a 00          	gs or  %fs:(%rax),%al
+  80316a:	3c 75                	cmp    $0x75,%al
+  80316c:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80316d:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  803171:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803172:	3e 00 0f             	ds add %cl,(%rdi)
+  803175:	1f                   	(bad)
+  803176:	40 00 5b 25          	rex add %bl,0x25(%rbx)
+  80317a:	30 38                	xor    %bh,(%rax)
+  80317c:	78 5d                	js     8031db <__rodata_start+0x153>
+  80317e:	20 75 73             	and    %dh,0x73(%rbp)
+  803181:	65 72 20             	gs jb  8031a4 <__rodata_start+0x11c>
+  803184:	70 61                	jo     8031e7 <__rodata_start+0x15f>
+  803186:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803187:	69 63 20 69 6e 20 25 	imul   $0x25206e69,0x20(%rbx),%esp
+  80318e:	73 20                	jae    8031b0 <__rodata_start+0x128>
+  803190:	61                   	(bad)
+  803191:	74 20                	je     8031b3 <__rodata_start+0x12b>
+  803193:	25 73 3a 25 64       	and    $0x64253a73,%eax
+  803198:	3a 20                	cmp    (%rax),%ah
+  80319a:	00 30                	add    %dh,(%rax)
+  80319c:	31 32                	xor    %esi,(%rdx)
+  80319e:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  8031a5:	41                   	rex.B
+  8031a6:	42                   	rex.X
+  8031a7:	43                   	rex.XB
+  8031a8:	44                   	rex.R
+  8031a9:	45                   	rex.RB
+  8031aa:	46 00 30             	rex.RX add %r14b,(%rax)
+  8031ad:	31 32                	xor    %esi,(%rdx)
+  8031af:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  8031b6:	61                   	(bad)
+  8031b7:	62 63 64 65 66       	(bad)
+  8031bc:	00 28                	add    %ch,(%rax)
+  8031be:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8031bf:	75 6c                	jne    80322d <__rodata_start+0x1a5>
+  8031c1:	6c                   	insb   (%dx),%es:(%rdi)
+  8031c2:	29 00                	sub    %eax,(%rax)
+  8031c4:	65 72 72             	gs jb  803239 <__rodata_start+0x1b1>
+  8031c7:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8031c8:	72 20                	jb     8031ea <__rodata_start+0x162>
+  8031ca:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  8031cf:	73 70                	jae    803241 <__rodata_start+0x1b9>
+  8031d1:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  8031d5:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  8031dc:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8031dd:	72 00                	jb     8031df <__rodata_start+0x157>
+  8031df:	62 61 64 20 65       	(bad)
+  8031e4:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8031e5:	76 69                	jbe    803250 <__rodata_start+0x1c8>
+  8031e7:	72 6f                	jb     803258 <__rodata_start+0x1d0>
+  8031e9:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8031ea:	6d                   	insl   (%dx),%es:(%rdi)
+  8031eb:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  8031ed:	74 00                	je     8031ef <__rodata_start+0x167>
+  8031ef:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  8031f6:	20 70 61             	and    %dh,0x61(%rax)
+  8031f9:	72 61                	jb     80325c <__rodata_start+0x1d4>
+  8031fb:	6d                   	insl   (%dx),%es:(%rdi)
+  8031fc:	65 74 65             	gs je  803264 <__rodata_start+0x1dc>
+  8031ff:	72 00                	jb     803201 <__rodata_start+0x179>
+  803201:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803202:	75 74                	jne    803278 <__rodata_start+0x1f0>
+  803204:	20 6f 66             	and    %ch,0x66(%rdi)
+  803207:	20 6d 65             	and    %ch,0x65(%rbp)
+  80320a:	6d                   	insl   (%dx),%es:(%rdi)
+  80320b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80320c:	72 79                	jb     803287 <__rodata_start+0x1ff>
+  80320e:	00 6f 75             	add    %ch,0x75(%rdi)
+  803211:	74 20                	je     803233 <__rodata_start+0x1ab>
+  803213:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803214:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  803218:	76 69                	jbe    803283 <__rodata_start+0x1fb>
+  80321a:	72 6f                	jb     80328b <__rodata_start+0x203>
+  80321c:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80321d:	6d                   	insl   (%dx),%es:(%rdi)
+  80321e:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803220:	74 73                	je     803295 <__rodata_start+0x20d>
+  803222:	00 63 6f             	add    %ah,0x6f(%rbx)
+  803225:	72 72                	jb     803299 <__rodata_start+0x211>
+  803227:	75 70                	jne    803299 <__rodata_start+0x211>
+  803229:	74 65                	je     803290 <__rodata_start+0x208>
+  80322b:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  803230:	75 67                	jne    803299 <__rodata_start+0x211>
+  803232:	20 69 6e             	and    %ch,0x6e(%rcx)
+  803235:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  803237:	00 73 65             	add    %dh,0x65(%rbx)
+  80323a:	67 6d                	insl   (%dx),%es:(%edi)
+  80323c:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  80323e:	74 61                	je     8032a1 <__rodata_start+0x219>
+  803240:	74 69                	je     8032ab <__rodata_start+0x223>
+  803242:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803243:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803244:	20 66 61             	and    %ah,0x61(%rsi)
+  803247:	75 6c                	jne    8032b5 <__rodata_start+0x22d>
+  803249:	74 00                	je     80324b <__rodata_start+0x1c3>
+  80324b:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  803252:	20 45 4c             	and    %al,0x4c(%rbp)
+  803255:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  803259:	61                   	(bad)
+  80325a:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  80325f:	20 73 75             	and    %dh,0x75(%rbx)
+  803262:	63 68 20             	movsxd 0x20(%rax),%ebp
+  803265:	73 79                	jae    8032e0 <__rodata_start+0x258>
+  803267:	73 74                	jae    8032dd <__rodata_start+0x255>
+  803269:	65 6d                	gs insl (%dx),%es:(%rdi)
+  80326b:	20 63 61             	and    %ah,0x61(%rbx)
+  80326e:	6c                   	insb   (%dx),%es:(%rdi)
+  80326f:	6c                   	insb   (%dx),%es:(%rdi)
+  803270:	00 65 6e             	add    %ah,0x6e(%rbp)
+  803273:	74 72                	je     8032e7 <__rodata_start+0x25f>
+  803275:	79 20                	jns    803297 <__rodata_start+0x20f>
+  803277:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803278:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803279:	74 20                	je     80329b <__rodata_start+0x213>
+  80327b:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  80327d:	75 6e                	jne    8032ed <__rodata_start+0x265>
+  80327f:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  803283:	76 20                	jbe    8032a5 <__rodata_start+0x21d>
+  803285:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  80328c:	72 65                	jb     8032f3 <__rodata_start+0x26b>
+  80328e:	63 76 69             	movsxd 0x69(%rsi),%esi
+  803291:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803292:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  803296:	65 78 70             	gs js  803309 <__rodata_start+0x281>
+  803299:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  80329e:	20 65 6e             	and    %ah,0x6e(%rbp)
+  8032a1:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  8032a5:	20 66 69             	and    %ah,0x69(%rsi)
+  8032a8:	6c                   	insb   (%dx),%es:(%rdi)
+  8032a9:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  8032ad:	20 66 72             	and    %ah,0x72(%rsi)
+  8032b0:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  8032b5:	61                   	(bad)
+  8032b6:	63 65 20             	movsxd 0x20(%rbp),%esp
+  8032b9:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8032ba:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8032bb:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  8032bf:	6b 00 74             	imul   $0x74,(%rax),%eax
+  8032c2:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8032c3:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8032c4:	20 6d 61             	and    %ch,0x61(%rbp)
+  8032c7:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8032c8:	79 20                	jns    8032ea <__rodata_start+0x262>
+  8032ca:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  8032d1:	72 65                	jb     803338 <__rodata_start+0x2b0>
+  8032d3:	20 6f 70             	and    %ch,0x70(%rdi)
+  8032d6:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  8032d8:	00 66 69             	add    %ah,0x69(%rsi)
+  8032db:	6c                   	insb   (%dx),%es:(%rdi)
+  8032dc:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  8032e0:	20 62 6c             	and    %ah,0x6c(%rdx)
+  8032e3:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8032e4:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  8032e7:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8032e8:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8032e9:	74 20                	je     80330b <__rodata_start+0x283>
+  8032eb:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  8032ed:	75 6e                	jne    80335d <__rodata_start+0x2d5>
+  8032ef:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  8032f3:	76 61                	jbe    803356 <__rodata_start+0x2ce>
+  8032f5:	6c                   	insb   (%dx),%es:(%rdi)
+  8032f6:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  8032fd:	00 
+  8032fe:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  803305:	72 65                	jb     80336c <__rodata_start+0x2e4>
+  803307:	61                   	(bad)
+  803308:	64 79 20             	fs jns 80332b <__rodata_start+0x2a3>
+  80330b:	65 78 69             	gs js  803377 <__rodata_start+0x2ef>
+  80330e:	73 74                	jae    803384 <__rodata_start+0x2fc>
+  803310:	73 00                	jae    803312 <__rodata_start+0x28a>
+  803312:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803313:	70 65                	jo     80337a <__rodata_start+0x2f2>
+  803315:	72 61                	jb     803378 <__rodata_start+0x2f0>
+  803317:	74 69                	je     803382 <__rodata_start+0x2fa>
+  803319:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80331a:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80331b:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  80331e:	74 20                	je     803340 <__rodata_start+0x2b8>
+  803320:	73 75                	jae    803397 <__rodata_start+0x30f>
+  803322:	70 70                	jo     803394 <__rodata_start+0x30c>
+  803324:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803325:	72 74                	jb     80339b <__rodata_start+0x313>
+  803327:	65 64 00 6f 70       	gs add %ch,%fs:0x70(%rdi)
+  80332c:	65 72 61             	gs jb  803390 <__rodata_start+0x308>
+  80332f:	74 69                	je     80339a <__rodata_start+0x312>
+  803331:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803332:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803333:	20 69 6e             	and    %ch,0x6e(%rcx)
+  803336:	74 65                	je     80339d <__rodata_start+0x315>
+  803338:	72 72                	jb     8033ac <__rodata_start+0x324>
+  80333a:	75 70                	jne    8033ac <__rodata_start+0x324>
+  80333c:	74 65                	je     8033a3 <__rodata_start+0x31b>
+  80333e:	64 00 6e 6f          	add    %ch,%fs:0x6f(%rsi)
+  803342:	74 20                	je     803364 <__rodata_start+0x2dc>
+  803344:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803346:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803347:	75 67                	jne    8033b0 <__rodata_start+0x328>
+  803349:	68 20 43 50 55       	push   $0x55504320
+  80334e:	20 74 69 6d          	and    %dh,0x6d(%rcx,%rbp,2)
+  803352:	65 00 66 2e          	add    %ah,%gs:0x2e(%rsi)
+  803356:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+  80335d:	00 
+  80335e:	66 90                	xchg   %ax,%ax
+  803360:	dd 06                	fldl   (%rsi)
+  803362:	80 00 00             	addb   $0x0,(%rax)
+  803365:	00 00                	add    %al,(%rax)
+  803367:	00 1e                	add    %bl,(%rsi)
+  803369:	0d 80 00 00 00       	or     $0x80,%eax
+  80336e:	00 00                	add    %al,(%rax)
+  803370:	0e                   	(bad)
+  803371:	0d 80 00 00 00       	or     $0x80,%eax
+  803376:	00 00                	add    %al,(%rax)
+  803378:	1e                   	(bad)
+  803379:	0d 80 00 00 00       	or     $0x80,%eax
+  80337e:	00 00                	add    %al,(%rax)
+  803380:	1e                   	(bad)
+  803381:	0d 80 00 00 00       	or     $0x80,%eax
+  803386:	00 00                	add    %al,(%rax)
+  803388:	1e                   	(bad)
+  803389:	0d 80 00 00 00       	or     $0x80,%eax
+  80338e:	00 00                	add    %al,(%rax)
+  803390:	1e                   	(bad)
+  803391:	0d 80 00 00 00       	or     $0x80,%eax
+  803396:	00 00                	add    %al,(%rax)
+  803398:	fc                   	cld
+  803399:	06                   	(bad)
+  80339a:	80 00 00             	addb   $0x0,(%rax)
+  80339d:	00 00                	add    %al,(%rax)
+  80339f:	00 1e                	add    %bl,(%rsi)
+  8033a1:	0d 80 00 00 00       	or     $0x80,%eax
+  8033a6:	00 00                	add    %al,(%rax)
+  8033a8:	1e                   	(bad)
+  8033a9:	0d 80 00 00 00       	or     $0x80,%eax
+  8033ae:	00 00                	add    %al,(%rax)
+  8033b0:	f0 06                	lock (bad)
+  8033b2:	80 00 00             	addb   $0x0,(%rax)
+  8033b5:	00 00                	add    %al,(%rax)
+  8033b7:	00 6a 07             	add    %ch,0x7(%rdx)
+  8033ba:	80 00 00             	addb   $0x0,(%rax)
+  8033bd:	00 00                	add    %al,(%rax)
+  8033bf:	00 1e                	add    %bl,(%rsi)
+  8033c1:	0d 80 00 00 00       	or     $0x80,%eax
+  8033c6:	00 00                	add    %al,(%rax)
+  8033c8:	f0 06                	lock (bad)
+  8033ca:	80 00 00             	addb   $0x0,(%rax)
+  8033cd:	00 00                	add    %al,(%rax)
+  8033cf:	00 36                	add    %dh,(%rsi)
+  8033d1:	07                   	(bad)
+  8033d2:	80 00 00             	addb   $0x0,(%rax)
+  8033d5:	00 00                	add    %al,(%rax)
+  8033d7:	00 36                	add    %dh,(%rsi)
+  8033d9:	07                   	(bad)
+  8033da:	80 00 00             	addb   $0x0,(%rax)
+  8033dd:	00 00                	add    %al,(%rax)
+  8033df:	00 36                	add    %dh,(%rsi)
+  8033e1:	07                   	(bad)
+  8033e2:	80 00 00             	addb   $0x0,(%rax)
+  8033e5:	00 00                	add    %al,(%rax)
+  8033e7:	00 36                	add    %dh,(%rsi)
+  8033e9:	07                   	(bad)
+  8033ea:	80 00 00             	addb   $0x0,(%rax)
+  8033ed:	00 00                	add    %al,(%rax)
+  8033ef:	00 36                	add    %dh,(%rsi)
+  8033f1:	07                   	(bad)
+  8033f2:	80 00 00             	addb   $0x0,(%rax)
+  8033f5:	00 00                	add    %al,(%rax)
+  8033f7:	00 36                	add    %dh,(%rsi)
+  8033f9:	07                   	(bad)
+  8033fa:	80 00 00             	addb   $0x0,(%rax)
+  8033fd:	00 00                	add    %al,(%rax)
+  8033ff:	00 36                	add    %dh,(%rsi)
+  803401:	07                   	(bad)
+  803402:	80 00 00             	addb   $0x0,(%rax)
+  803405:	00 00                	add    %al,(%rax)
+  803407:	00 36                	add    %dh,(%rsi)
+  803409:	07                   	(bad)
+  80340a:	80 00 00             	addb   $0x0,(%rax)
+  80340d:	00 00                	add    %al,(%rax)
+  80340f:	00 36                	add    %dh,(%rsi)
+  803411:	07                   	(bad)
+  803412:	80 00 00             	addb   $0x0,(%rax)
+  803415:	00 00                	add    %al,(%rax)
+  803417:	00 1e                	add    %bl,(%rsi)
+  803419:	0d 80 00 00 00       	or     $0x80,%eax
+  80341e:	00 00                	add    %al,(%rax)
+  803420:	1e                   	(bad)
+  803421:	0d 80 00 00 00       	or     $0x80,%eax
+  803426:	00 00                	add    %al,(%rax)
+  803428:	1e                   	(bad)
+  803429:	0d 80 00 00 00       	or     $0x80,%eax
+  80342e:	00 00                	add    %al,(%rax)
+  803430:	1e                   	(bad)
+  803431:	0d 80 00 00 00       	or     $0x80,%eax
+  803436:	00 00                	add    %al,(%rax)
+  803438:	1e                   	(bad)
+  803439:	0d 80 00 00 00       	or     $0x80,%eax
+  80343e:	00 00                	add    %al,(%rax)
+  803440:	1e                   	(bad)
+  803441:	0d 80 00 00 00       	or     $0x80,%eax
+  803446:	00 00                	add    %al,(%rax)
+  803448:	1e                   	(bad)
+  803449:	0d 80 00 00 00       	or     $0x80,%eax
+  80344e:	00 00                	add    %al,(%rax)
+  803450:	1e                   	(bad)
+  803451:	0d 80 00 00 00       	or     $0x80,%eax
+  803456:	00 00                	add    %al,(%rax)
+  803458:	1e                   	(bad)
+  803459:	0d 80 00 00 00       	or     $0x80,%eax
+  80345e:	00 00                	add    %al,(%rax)
+  803460:	1e                   	(bad)
+  803461:	0d 80 00 00 00       	or     $0x80,%eax
+  803466:	00 00                	add    %al,(%rax)
+  803468:	1e                   	(bad)
+  803469:	0d 80 00 00 00       	or     $0x80,%eax
+  80346e:	00 00                	add    %al,(%rax)
+  803470:	1e                   	(bad)
+  803471:	0d 80 00 00 00       	or     $0x80,%eax
+  803476:	00 00                	add    %al,(%rax)
+  803478:	1e                   	(bad)
+  803479:	0d 80 00 00 00       	or     $0x80,%eax
+  80347e:	00 00                	add    %al,(%rax)
+  803480:	1e                   	(bad)
+  803481:	0d 80 00 00 00       	or     $0x80,%eax
+  803486:	00 00                	add    %al,(%rax)
+  803488:	1e                   	(bad)
+  803489:	0d 80 00 00 00       	or     $0x80,%eax
+  80348e:	00 00                	add    %al,(%rax)
+  803490:	1e                   	(bad)
+  803491:	0d 80 00 00 00       	or     $0x80,%eax
+  803496:	00 00                	add    %al,(%rax)
+  803498:	1e                   	(bad)
+  803499:	0d 80 00 00 00       	or     $0x80,%eax
+  80349e:	00 00                	add    %al,(%rax)
+  8034a0:	1e                   	(bad)
+  8034a1:	0d 80 00 00 00       	or     $0x80,%eax
+  8034a6:	00 00                	add    %al,(%rax)
+  8034a8:	1e                   	(bad)
+  8034a9:	0d 80 00 00 00       	or     $0x80,%eax
+  8034ae:	00 00                	add    %al,(%rax)
+  8034b0:	1e                   	(bad)
+  8034b1:	0d 80 00 00 00       	or     $0x80,%eax
+  8034b6:	00 00                	add    %al,(%rax)
+  8034b8:	1e                   	(bad)
+  8034b9:	0d 80 00 00 00       	or     $0x80,%eax
+  8034be:	00 00                	add    %al,(%rax)
+  8034c0:	1e                   	(bad)
+  8034c1:	0d 80 00 00 00       	or     $0x80,%eax
+  8034c6:	00 00                	add    %al,(%rax)
+  8034c8:	1e                   	(bad)
+  8034c9:	0d 80 00 00 00       	or     $0x80,%eax
+  8034ce:	00 00                	add    %al,(%rax)
+  8034d0:	1e                   	(bad)
+  8034d1:	0d 80 00 00 00       	or     $0x80,%eax
+  8034d6:	00 00                	add    %al,(%rax)
+  8034d8:	1e                   	(bad)
+  8034d9:	0d 80 00 00 00       	or     $0x80,%eax
+  8034de:	00 00                	add    %al,(%rax)
+  8034e0:	1e                   	(bad)
+  8034e1:	0d 80 00 00 00       	or     $0x80,%eax
+  8034e6:	00 00                	add    %al,(%rax)
+  8034e8:	1e                   	(bad)
+  8034e9:	0d 80 00 00 00       	or     $0x80,%eax
+  8034ee:	00 00                	add    %al,(%rax)
+  8034f0:	1e                   	(bad)
+  8034f1:	0d 80 00 00 00       	or     $0x80,%eax
+  8034f6:	00 00                	add    %al,(%rax)
+  8034f8:	1e                   	(bad)
+  8034f9:	0d 80 00 00 00       	or     $0x80,%eax
+  8034fe:	00 00                	add    %al,(%rax)
+  803500:	1e                   	(bad)
+  803501:	0d 80 00 00 00       	or     $0x80,%eax
+  803506:	00 00                	add    %al,(%rax)
+  803508:	41 0c 80             	rex.B or $0x80,%al
+  80350b:	00 00                	add    %al,(%rax)
+  80350d:	00 00                	add    %al,(%rax)
+  80350f:	00 1e                	add    %bl,(%rsi)
+  803511:	0d 80 00 00 00       	or     $0x80,%eax
+  803516:	00 00                	add    %al,(%rax)
+  803518:	1e                   	(bad)
+  803519:	0d 80 00 00 00       	or     $0x80,%eax
+  80351e:	00 00                	add    %al,(%rax)
+  803520:	1e                   	(bad)
+  803521:	0d 80 00 00 00       	or     $0x80,%eax
+  803526:	00 00                	add    %al,(%rax)
+  803528:	1e                   	(bad)
+  803529:	0d 80 00 00 00       	or     $0x80,%eax
+  80352e:	00 00                	add    %al,(%rax)
+  803530:	1e                   	(bad)
+  803531:	0d 80 00 00 00       	or     $0x80,%eax
+  803536:	00 00                	add    %al,(%rax)
+  803538:	1e                   	(bad)
+  803539:	0d 80 00 00 00       	or     $0x80,%eax
+  80353e:	00 00                	add    %al,(%rax)
+  803540:	1e                   	(bad)
+  803541:	0d 80 00 00 00       	or     $0x80,%eax
+  803546:	00 00                	add    %al,(%rax)
+  803548:	1e                   	(bad)
+  803549:	0d 80 00 00 00       	or     $0x80,%eax
+  80354e:	00 00                	add    %al,(%rax)
+  803550:	1e                   	(bad)
+  803551:	0d 80 00 00 00       	or     $0x80,%eax
+  803556:	00 00                	add    %al,(%rax)
+  803558:	1e                   	(bad)
+  803559:	0d 80 00 00 00       	or     $0x80,%eax
+  80355e:	00 00                	add    %al,(%rax)
+  803560:	8d 07                	lea    (%rdi),%eax
+  803562:	80 00 00             	addb   $0x0,(%rax)
+  803565:	00 00                	add    %al,(%rax)
+  803567:	00 5c 09 80          	add    %bl,-0x80(%rcx,%rcx,1)
+  80356b:	00 00                	add    %al,(%rax)
+  80356d:	00 00                	add    %al,(%rax)
+  80356f:	00 1e                	add    %bl,(%rsi)
+  803571:	0d 80 00 00 00       	or     $0x80,%eax
+  803576:	00 00                	add    %al,(%rax)
+  803578:	1e                   	(bad)
+  803579:	0d 80 00 00 00       	or     $0x80,%eax
+  80357e:	00 00                	add    %al,(%rax)
+  803580:	1e                   	(bad)
+  803581:	0d 80 00 00 00       	or     $0x80,%eax
+  803586:	00 00                	add    %al,(%rax)
+  803588:	1e                   	(bad)
+  803589:	0d 80 00 00 00       	or     $0x80,%eax
+  80358e:	00 00                	add    %al,(%rax)
+  803590:	bc 07 80 00 00       	mov    $0x8007,%esp
+  803595:	00 00                	add    %al,(%rax)
+  803597:	00 1e                	add    %bl,(%rsi)
+  803599:	0d 80 00 00 00       	or     $0x80,%eax
+  80359e:	00 00                	add    %al,(%rax)
+  8035a0:	1e                   	(bad)
+  8035a1:	0d 80 00 00 00       	or     $0x80,%eax
+  8035a6:	00 00                	add    %al,(%rax)
+  8035a8:	82                   	(bad)
+  8035a9:	07                   	(bad)
+  8035aa:	80 00 00             	addb   $0x0,(%rax)
+  8035ad:	00 00                	add    %al,(%rax)
+  8035af:	00 1e                	add    %bl,(%rsi)
+  8035b1:	0d 80 00 00 00       	or     $0x80,%eax
+  8035b6:	00 00                	add    %al,(%rax)
+  8035b8:	1e                   	(bad)
+  8035b9:	0d 80 00 00 00       	or     $0x80,%eax
+  8035be:	00 00                	add    %al,(%rax)
+  8035c0:	04 0b                	add    $0xb,%al
+  8035c2:	80 00 00             	addb   $0x0,(%rax)
+  8035c5:	00 00                	add    %al,(%rax)
+  8035c7:	00 ce                	add    %cl,%dh
+  8035c9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  8035cf:	00 1e                	add    %bl,(%rsi)
+  8035d1:	0d 80 00 00 00       	or     $0x80,%eax
+  8035d6:	00 00                	add    %al,(%rax)
+  8035d8:	1e                   	(bad)
+  8035d9:	0d 80 00 00 00       	or     $0x80,%eax
+  8035de:	00 00                	add    %al,(%rax)
+  8035e0:	53                   	push   %rbx
+  8035e1:	08 80 00 00 00 00    	or     %al,0x0(%rax)
+  8035e7:	00 1e                	add    %bl,(%rsi)
+  8035e9:	0d 80 00 00 00       	or     $0x80,%eax
+  8035ee:	00 00                	add    %al,(%rax)
+  8035f0:	30 0a                	xor    %cl,(%rdx)
+  8035f2:	80 00 00             	addb   $0x0,(%rax)
+  8035f5:	00 00                	add    %al,(%rax)
+  8035f7:	00 1e                	add    %bl,(%rsi)
+  8035f9:	0d 80 00 00 00       	or     $0x80,%eax
+  8035fe:	00 00                	add    %al,(%rax)
+  803600:	1e                   	(bad)
+  803601:	0d 80 00 00 00       	or     $0x80,%eax
+  803606:	00 00                	add    %al,(%rax)
+  803608:	41 0c 80             	rex.B or $0x80,%al
+  80360b:	00 00                	add    %al,(%rax)
+  80360d:	00 00                	add    %al,(%rax)
+  80360f:	00 1e                	add    %bl,(%rsi)
+  803611:	0d 80 00 00 00       	or     $0x80,%eax
+  803616:	00 00                	add    %al,(%rax)
+  803618:	e6 06                	out    %al,$0x6
+  80361a:	80 00 00             	addb   $0x0,(%rax)
+  80361d:	00 00                	add    %al,(%rax)
+	...
+
+0000000000803620 <error_string>:
+	...
+  803628:	cd 31 80 00 00 00 00 00 df 31 80 00 00 00 00 00     .1.......1......
+  803638:	ef 31 80 00 00 00 00 00 01 32 80 00 00 00 00 00     .1.......2......
+  803648:	0f 32 80 00 00 00 00 00 23 32 80 00 00 00 00 00     .2......#2......
+  803658:	38 32 80 00 00 00 00 00 4b 32 80 00 00 00 00 00     82......K2......
+  803668:	5d 32 80 00 00 00 00 00 71 32 80 00 00 00 00 00     ]2......q2......
+  803678:	81 32 80 00 00 00 00 00 94 32 80 00 00 00 00 00     .2.......2......
+  803688:	ab 32 80 00 00 00 00 00 c1 32 80 00 00 00 00 00     .2.......2......
+  803698:	d9 32 80 00 00 00 00 00 f1 32 80 00 00 00 00 00     .2.......2......
+  8036a8:	fe 32 80 00 00 00 00 00 d0 36 80 00 00 00 00 00     .2.......6......
+  8036b8:	12 33 80 00 00 00 00 00 2a 33 80 00 00 00 00 00     .3......*3......
+  8036c8:	40 33 80 00 00 00 00 00 66 69 6c 65 20 69 73 20     @3......file is 
+  8036d8:	6e 6f 74 20 61 20 76 61 6c 69 64 20 65 78 65 63     not a valid exec
+  8036e8:	75 74 61 62 6c 65 00 90 73 79 73 63 61 6c 6c 20     utable..syscall 
+  8036f8:	25 7a 64 20 72 65 74 75 72 6e 65 64 20 25 7a 64     %zd returned %zd
+  803708:	20 28 3e 20 30 29 00 6c 69 62 2f 73 79 73 63 61      (> 0).lib/sysca
+  803718:	6c 6c 2e 63 00 46 6f 72 6b 20 64 6f 75 62 6c 65     ll.c.Fork double
+  803728:	20 66 61 75 6c 74 00 6c 69 62 2f 66 6f 72 6b 2e      fault.lib/fork.
+  803738:	63 00 73 66 6f 72 6b 28 29 20 69 73 20 6e 6f 74     c.sfork() is not
+  803748:	20 69 6d 70 6c 65 6d 65 6e 74 65 64 00 0f 1f 00      implemented....
+  803758:	5b 25 30 38 78 5d 20 75 6e 6b 6e 6f 77 6e 20 64     [%08x] unknown d
+  803768:	65 76 69 63 65 20 74 79 70 65 20 25 64 0a 00 00     evice type %d...
+  803778:	5b 25 30 38 78 5d 20 66 74 72 75 6e 63 61 74 65     [%08x] ftruncate
+  803788:	20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65 0a      %d -- bad mode.
+  803798:	00 5b 25 30 38 78 5d 20 72 65 61 64 20 25 64 20     .[%08x] read %d 
+  8037a8:	2d 2d 20 62 61 64 20 6d 6f 64 65 0a 00 5b 25 30     -- bad mode..[%0
+  8037b8:	38 78 5d 20 77 72 69 74 65 20 25 64 20 2d 2d 20     8x] write %d -- 
+  8037c8:	62 61 64 20 6d 6f 64 65 0a 00 66 2e 0f 1f 84 00     bad mode..f.....
+  8037d8:	00 00 00 00 0f 1f 40 00                             ......@.
+
+00000000008037e0 <devtab>:
+  8037e0:	20 40 80 00 00 00 00 00 60 40 80 00 00 00 00 00      @......`@......
+  8037f0:	a0 40 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .@..............
+  803800:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  803810:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  803820:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  803830:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  803840:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  803850:	3d 20 32 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73 00     = 2.<cons>.cons.
+  803860:	73 79 73 5f 69 70 63 5f 74 72 79 5f 73 65 6e 64     sys_ipc_try_send
+  803870:	20 66 61 69 6c 65 64 3a 20 25 69 00 6c 69 62 2f      failed: %i.lib/
+  803880:	69 70 63 2e 63 00 66 2e 0f 1f 84 00 00 00 00 00     ipc.c.f.........
+  803890:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8038a0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8038b0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8038c0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8038d0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8038e0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8038f0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803900:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803910:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803920:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803930:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803940:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803950:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803960:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803970:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803980:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803990:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8039a0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8039b0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8039c0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8039d0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8039e0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8039f0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803a00:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803a10:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803a20:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803a30:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803a40:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803a50:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803a60:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803a70:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803a80:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803a90:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803aa0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803ab0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803ac0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803ad0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803ae0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803af0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803b00:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803b10:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803b20:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803b30:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803b40:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803b50:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803b60:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803b70:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803b80:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803b90:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803ba0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803bb0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803bc0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803bd0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803be0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803bf0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803c00:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803c10:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803c20:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803c30:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803c40:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803c50:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803c60:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803c70:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803c80:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803c90:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803ca0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803cb0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803cc0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803cd0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803ce0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803cf0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803d00:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803d10:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803d20:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803d30:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803d40:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803d50:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803d60:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803d70:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803d80:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803d90:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803da0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803db0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803dc0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803dd0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803de0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803df0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803e00:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803e10:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803e20:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803e30:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803e40:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803e50:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803e60:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803e70:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803e80:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803e90:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803ea0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803eb0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803ec0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803ed0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803ee0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803ef0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803f00:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803f10:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803f20:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803f30:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803f40:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803f50:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803f60:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803f70:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803f80:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803f90:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803fa0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803fb0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803fc0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803fd0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803fe0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803ff0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 0f 1f 40 00     ..f...........@.
@@ -0,0 +1,6063 @@
+
+obj/user/schedbench:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 20 02 00 00       	call   800243 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <measure>:
+#define SCHED_ITERATIONS 10000
+
+static envid_t idle[NENV];
+
+static uint64_t
+measure(void) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 56                	push   %r14
+  80002b:	41 55                	push   %r13
+  80002d:	41 54                	push   %r12
+  80002f:	53                   	push   %rbx
+    envid_t partner = fork();
+  800030:	48 b8 6f 17 80 00 00 	movabs $0x80176f,%rax
+  800037:	00 00 00 
+  80003a:	ff d0                	call   *%rax
+  80003c:	41 89 c5             	mov    %eax,%r13d
+    if (partner < 0) panic("fork: %i", partner);
+  80003f:	85 c0                	test   %eax,%eax
+  800041:	78 10                	js     800053 <measure+0x2e>
+    if (!partner) {
+  800043:	75 3b                	jne    800080 <measure+0x5b>
+        for (;;) sys_yield();
+  800045:	48 bb a5 12 80 00 00 	movabs $0x8012a5,%rbx
+  80004c:	00 00 00 
+  80004f:	ff d3                	call   *%rbx
+  800051:	eb fc                	jmp    80004f <measure+0x2a>
+    if (partner < 0) panic("fork: %i", partner);
+  800053:	89 c1                	mov    %eax,%ecx
+  800055:	48 ba f8 2f 80 00 00 	movabs $0x802ff8,%rdx
+  80005c:	00 00 00 
+  80005f:	be 12 00 00 00       	mov    $0x12,%esi
+  800064:	48 bf 01 30 80 00 00 	movabs $0x803001,%rdi
+  80006b:	00 00 00 
+  80006e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800073:	49 b8 0f 03 80 00 00 	movabs $0x80030f,%r8
+  80007a:	00 00 00 
+  80007d:	41 ff d0             	call   *%r8
+    }
+
+    /* Let partner start */
+    sys_yield();
+  800080:	48 b8 a5 12 80 00 00 	movabs $0x8012a5,%rax
+  800087:	00 00 00 
+  80008a:	ff d0                	call   *%rax
+}
+
+static inline uint64_t __attribute__((always_inline))
+read_tsc(void) {
+    uint32_t lo, hi;
+    asm volatile("rdtsc"
+  80008c:	0f 31                	rdtsc
+                 : "=a"(lo), "=d"(hi));
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  80008e:	48 c1 e2 20          	shl    $0x20,%rdx
+  800092:	89 c0                	mov    %eax,%eax
+  800094:	48 09 c2             	or     %rax,%rdx
+  800097:	49 89 d6             	mov    %rdx,%r14
+  80009a:	bb 10 27 00 00       	mov    $0x2710,%ebx
+
+    uint64_t start = read_tsc();
+    for (size_t i = 0; i < SCHED_ITERATIONS; i++)
+        sys_yield();
+  80009f:	49 bc a5 12 80 00 00 	movabs $0x8012a5,%r12
+  8000a6:	00 00 00 
+  8000a9:	41 ff d4             	call   *%r12
+    for (size_t i = 0; i < SCHED_ITERATIONS; i++)
+  8000ac:	48 83 eb 01          	sub    $0x1,%rbx
+  8000b0:	75 f7                	jne    8000a9 <measure+0x84>
+    asm volatile("rdtsc"
+  8000b2:	0f 31                	rdtsc
+  8000b4:	89 d3                	mov    %edx,%ebx
+  8000b6:	41 89 c4             	mov    %eax,%r12d
+    uint64_t cycles = (read_tsc() - start) / SCHED_ITERATIONS;
+
+    sys_env_destroy(partner);
+  8000b9:	44 89 ef             	mov    %r13d,%edi
+  8000bc:	48 b8 09 12 80 00 00 	movabs $0x801209,%rax
+  8000c3:	00 00 00 
+  8000c6:	ff d0                	call   *%rax
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  8000c8:	48 89 da             	mov    %rbx,%rdx
+  8000cb:	48 c1 e2 20          	shl    $0x20,%rdx
+  8000cf:	45 89 e4             	mov    %r12d,%r12d
+  8000d2:	4c 09 e2             	or     %r12,%rdx
+    uint64_t cycles = (read_tsc() - start) / SCHED_ITERATIONS;
+  8000d5:	4c 29 f2             	sub    %r14,%rdx
+  8000d8:	48 b9 4b 59 86 38 d6 	movabs $0x346dc5d63886594b,%rcx
+  8000df:	c5 6d 34 
+  8000e2:	48 89 d0             	mov    %rdx,%rax
+  8000e5:	48 f7 e1             	mul    %rcx
+  8000e8:	48 89 d0             	mov    %rdx,%rax
+  8000eb:	48 c1 e8 0b          	shr    $0xb,%rax
+    return cycles;
+}
+  8000ef:	5b                   	pop    %rbx
+  8000f0:	41 5c                	pop    %r12
+  8000f2:	41 5d                	pop    %r13
+  8000f4:	41 5e                	pop    %r14
+  8000f6:	5d                   	pop    %rbp
+  8000f7:	c3                   	ret
+
+00000000008000f8 <umain>:
+
+void
+umain(int argc, char **argv) {
+  8000f8:	55                   	push   %rbp
+  8000f9:	48 89 e5             	mov    %rsp,%rbp
+  8000fc:	41 57                	push   %r15
+  8000fe:	41 56                	push   %r14
+  800100:	41 55                	push   %r13
+  800102:	41 54                	push   %r12
+  800104:	53                   	push   %rbx
+  800105:	48 83 ec 18          	sub    $0x18,%rsp
+    size_t nidle = argc > 1 ? strtol(argv[1], NULL, 0) : SCHED_IDLE_ENVS;
+  800109:	83 ff 01             	cmp    $0x1,%edi
+  80010c:	7f 35                	jg     800143 <umain+0x4b>
+    nidle = MIN(nidle, NENV);
+
+    uint64_t alone = measure();
+  80010e:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  800115:	00 00 00 
+  800118:	ff d0                	call   *%rax
+  80011a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+    nidle = MIN(nidle, NENV);
+  80011e:	41 be f4 01 00 00    	mov    $0x1f4,%r14d
+
+/* This must be inlined. Exercise for reader: why? */
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+    envid_t ret;
+    asm volatile("int %2"
+  800124:	b8 08 00 00 00       	mov    $0x8,%eax
+  800129:	cd 30                	int    $0x30
+  80012b:	41 89 c5             	mov    %eax,%r13d
+
+    size_t created = 0;
+    for (; created < nidle; created++) {
+        envid_t env = sys_exofork();
+        if (env < 0) break;
+  80012e:	85 c0                	test   %eax,%eax
+  800130:	78 50                	js     800182 <umain+0x8a>
+    size_t created = 0;
+  800132:	bb 00 00 00 00       	mov    $0x0,%ebx
+        /* Never runs */
+        if (!env) exit();
+        idle[created] = env;
+  800137:	49 bf 00 50 80 00 00 	movabs $0x805000,%r15
+  80013e:	00 00 00 
+  800141:	eb 75                	jmp    8001b8 <umain+0xc0>
+    size_t nidle = argc > 1 ? strtol(argv[1], NULL, 0) : SCHED_IDLE_ENVS;
+  800143:	48 8b 7e 08          	mov    0x8(%rsi),%rdi
+  800147:	ba 00 00 00 00       	mov    $0x0,%edx
+  80014c:	be 00 00 00 00       	mov    $0x0,%esi
+  800151:	48 b8 f5 10 80 00 00 	movabs $0x8010f5,%rax
+  800158:	00 00 00 
+  80015b:	ff d0                	call   *%rax
+  80015d:	48 89 c3             	mov    %rax,%rbx
+    nidle = MIN(nidle, NENV);
+  800160:	41 be 00 04 00 00    	mov    $0x400,%r14d
+  800166:	4c 39 f0             	cmp    %r14,%rax
+  800169:	4c 0f 46 f0          	cmovbe %rax,%r14
+    uint64_t alone = measure();
+  80016d:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  800174:	00 00 00 
+  800177:	ff d0                	call   *%rax
+  800179:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+    for (; created < nidle; created++) {
+  80017d:	48 85 db             	test   %rbx,%rbx
+  800180:	75 a2                	jne    800124 <umain+0x2c>
+    }
+
+    uint64_t crowded = measure();
+  800182:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  800189:	00 00 00 
+  80018c:	ff d0                	call   *%rax
+  80018e:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  800192:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  800198:	eb 73                	jmp    80020d <umain+0x115>
+        idle[created] = env;
+  80019a:	45 89 2c 9f          	mov    %r13d,(%r15,%rbx,4)
+    for (; created < nidle; created++) {
+  80019e:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  8001a2:	4d 39 f4             	cmp    %r14,%r12
+  8001a5:	73 24                	jae    8001cb <umain+0xd3>
+  8001a7:	b8 08 00 00 00       	mov    $0x8,%eax
+  8001ac:	cd 30                	int    $0x30
+  8001ae:	41 89 c5             	mov    %eax,%r13d
+        if (env < 0) break;
+  8001b1:	85 c0                	test   %eax,%eax
+  8001b3:	78 16                	js     8001cb <umain+0xd3>
+    for (; created < nidle; created++) {
+  8001b5:	4c 89 e3             	mov    %r12,%rbx
+        if (!env) exit();
+  8001b8:	45 85 ed             	test   %r13d,%r13d
+  8001bb:	75 dd                	jne    80019a <umain+0xa2>
+  8001bd:	48 b8 ec 02 80 00 00 	movabs $0x8002ec,%rax
+  8001c4:	00 00 00 
+  8001c7:	ff d0                	call   *%rax
+  8001c9:	eb cf                	jmp    80019a <umain+0xa2>
+    uint64_t crowded = measure();
+  8001cb:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8001d2:	00 00 00 
+  8001d5:	ff d0                	call   *%rax
+  8001d7:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+
+    for (size_t i = 0; i < created; i++)
+  8001db:	4d 85 e4             	test   %r12,%r12
+  8001de:	74 2d                	je     80020d <umain+0x115>
+  8001e0:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+        sys_env_destroy(idle[i]);
+  8001e6:	49 bf 00 50 80 00 00 	movabs $0x805000,%r15
+  8001ed:	00 00 00 
+  8001f0:	49 be 09 12 80 00 00 	movabs $0x801209,%r14
+  8001f7:	00 00 00 
+  8001fa:	43 8b 3c af          	mov    (%r15,%r13,4),%edi
+  8001fe:	41 ff d6             	call   *%r14
+    for (size_t i = 0; i < created; i++)
+  800201:	4c 89 e8             	mov    %r13,%rax
+  800204:	49 83 c5 01          	add    $0x1,%r13
+  800208:	48 39 c3             	cmp    %rax,%rbx
+  80020b:	75 ed                	jne    8001fa <umain+0x102>
+
+    cprintf("schedbench: yield round trip %lu cycles alone, %lu cycles with %lu idle environments\n",
+  80020d:	4c 89 e1             	mov    %r12,%rcx
+  800210:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  800214:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  800218:	48 bf 18 30 80 00 00 	movabs $0x803018,%rdi
+  80021f:	00 00 00 
+  800222:	b8 00 00 00 00       	mov    $0x0,%eax
+  800227:	49 b8 5f 04 80 00 00 	movabs $0x80045f,%r8
+  80022e:	00 00 00 
+  800231:	41 ff d0             	call   *%r8
+            (unsigned long)alone, (unsigned long)crowded, (unsigned long)created);
+}
+  800234:	48 83 c4 18          	add    $0x18,%rsp
+  800238:	5b                   	pop    %rbx
+  800239:	41 5c                	pop    %r12
+  80023b:	41 5d                	pop    %r13
+  80023d:	41 5e                	pop    %r14
+  80023f:	41 5f                	pop    %r15
+  800241:	5d                   	pop    %rbp
+  800242:	c3                   	ret
+
+0000000000800243 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800243:	55                   	push   %rbp
+  800244:	48 89 e5             	mov    %rsp,%rbp
+  800247:	41 56                	push   %r14
+  800249:	41 55                	push   %r13
+  80024b:	41 54                	push   %r12
+  80024d:	53                   	push   %rbx
+  80024e:	41 89 fd             	mov    %edi,%r13d
+  800251:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800254:	48 ba d8 40 80 00 00 	movabs $0x8040d8,%rdx
+  80025b:	00 00 00 
+  80025e:	48 b8 d8 40 80 00 00 	movabs $0x8040d8,%rax
+  800265:	00 00 00 
+  800268:	48 39 c2             	cmp    %rax,%rdx
+  80026b:	73 17                	jae    800284 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  80026d:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  800270:	49 89 c4             	mov    %rax,%r12
+  800273:	48 83 c3 08          	add    $0x8,%rbx
+  800277:	b8 00 00 00 00       	mov    $0x0,%eax
+  80027c:	ff 53 f8             	call   *-0x8(%rbx)
+  80027f:	4c 39 e3             	cmp    %r12,%rbx
+  800282:	72 ef                	jb     800273 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+    envid_t this_env_id = sys_getenvid();
+  800284:	48 b8 74 12 80 00 00 	movabs $0x801274,%rax
+  80028b:	00 00 00 
+  80028e:	ff d0                	call   *%rax
+    thisenv = &((struct Env*)UENVS)[ENVX(this_env_id)];
+  800290:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800295:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+  80029c:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8002a3:	00 00 00 
+  8002a6:	48 01 d0             	add    %rdx,%rax
+  8002a9:	48 a3 00 60 80 00 00 	movabs %rax,0x806000
+  8002b0:	00 00 00 
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8002b3:	45 85 ed             	test   %r13d,%r13d
+  8002b6:	7e 0d                	jle    8002c5 <libmain+0x82>
+  8002b8:	49 8b 06             	mov    (%r14),%rax
+  8002bb:	48 a3 00 40 80 00 00 	movabs %rax,0x804000
+  8002c2:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8002c5:	4c 89 f6             	mov    %r14,%rsi
+  8002c8:	44 89 ef             	mov    %r13d,%edi
+  8002cb:	48 b8 f8 00 80 00 00 	movabs $0x8000f8,%rax
+  8002d2:	00 00 00 
+  8002d5:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8002d7:	48 b8 ec 02 80 00 00 	movabs $0x8002ec,%rax
+  8002de:	00 00 00 
+  8002e1:	ff d0                	call   *%rax
+#endif
+}
+  8002e3:	5b                   	pop    %rbx
+  8002e4:	41 5c                	pop    %r12
+  8002e6:	41 5d                	pop    %r13
+  8002e8:	41 5e                	pop    %r14
+  8002ea:	5d                   	pop    %rbp
+  8002eb:	c3                   	ret
+
+00000000008002ec <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8002ec:	55                   	push   %rbp
+  8002ed:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  8002f0:	48 b8 2c 1b 80 00 00 	movabs $0x801b2c,%rax
+  8002f7:	00 00 00 
+  8002fa:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  8002fc:	bf 00 00 00 00       	mov    $0x0,%edi
+  800301:	48 b8 09 12 80 00 00 	movabs $0x801209,%rax
+  800308:	00 00 00 
+  80030b:	ff d0                	call   *%rax
+}
+  80030d:	5d                   	pop    %rbp
+  80030e:	c3                   	ret
+
+000000000080030f <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  80030f:	55                   	push   %rbp
+  800310:	48 89 e5             	mov    %rsp,%rbp
+  800313:	41 56                	push   %r14
+  800315:	41 55                	push   %r13
+  800317:	41 54                	push   %r12
+  800319:	53                   	push   %rbx
+  80031a:	48 83 ec 50          	sub    $0x50,%rsp
+  80031e:	49 89 fc             	mov    %rdi,%r12
+  800321:	41 89 f5             	mov    %esi,%r13d
+  800324:	48 89 d3             	mov    %rdx,%rbx
+  800327:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  80032b:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  80032f:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800333:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  80033a:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80033e:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  800342:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  800346:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  80034a:	48 b8 00 40 80 00 00 	movabs $0x804000,%rax
+  800351:	00 00 00 
+  800354:	4c 8b 30             	mov    (%rax),%r14
+  800357:	48 b8 74 12 80 00 00 	movabs $0x801274,%rax
+  80035e:	00 00 00 
+  800361:	ff d0                	call   *%rax
+  800363:	89 c6                	mov    %eax,%esi
+  800365:	45 89 e8             	mov    %r13d,%r8d
+  800368:	4c 89 e1             	mov    %r12,%rcx
+  80036b:	4c 89 f2             	mov    %r14,%rdx
+  80036e:	48 bf 78 30 80 00 00 	movabs $0x803078,%rdi
+  800375:	00 00 00 
+  800378:	b8 00 00 00 00       	mov    $0x0,%eax
+  80037d:	49 bc 5f 04 80 00 00 	movabs $0x80045f,%r12
+  800384:	00 00 00 
+  800387:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  80038a:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  80038e:	48 89 df             	mov    %rbx,%rdi
+  800391:	48 b8 fb 03 80 00 00 	movabs $0x8003fb,%rax
+  800398:	00 00 00 
+  80039b:	ff d0                	call   *%rax
+    cprintf("\n");
+  80039d:	48 bf b3 36 80 00 00 	movabs $0x8036b3,%rdi
+  8003a4:	00 00 00 
+  8003a7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003ac:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  8003af:	cc                   	int3
+  8003b0:	eb fd                	jmp    8003af <_panic+0xa0>
+
+00000000008003b2 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  8003b2:	55                   	push   %rbp
+  8003b3:	48 89 e5             	mov    %rsp,%rbp
+  8003b6:	53                   	push   %rbx
+  8003b7:	48 83 ec 08          	sub    $0x8,%rsp
+  8003bb:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  8003be:	8b 06                	mov    (%rsi),%eax
+  8003c0:	8d 50 01             	lea    0x1(%rax),%edx
+  8003c3:	89 16                	mov    %edx,(%rsi)
+  8003c5:	48 98                	cltq
+  8003c7:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  8003cc:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  8003d2:	74 0a                	je     8003de <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  8003d4:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  8003d8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8003dc:	c9                   	leave
+  8003dd:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  8003de:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  8003e2:	be ff 00 00 00       	mov    $0xff,%esi
+  8003e7:	48 b8 ab 11 80 00 00 	movabs $0x8011ab,%rax
+  8003ee:	00 00 00 
+  8003f1:	ff d0                	call   *%rax
+        state->offset = 0;
+  8003f3:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  8003f9:	eb d9                	jmp    8003d4 <putch+0x22>
+
+00000000008003fb <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  8003fb:	55                   	push   %rbp
+  8003fc:	48 89 e5             	mov    %rsp,%rbp
+  8003ff:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  800406:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  800409:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  800410:	b9 21 00 00 00       	mov    $0x21,%ecx
+  800415:	b8 00 00 00 00       	mov    $0x0,%eax
+  80041a:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  80041d:	48 89 f1             	mov    %rsi,%rcx
+  800420:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  800427:	48 bf b2 03 80 00 00 	movabs $0x8003b2,%rdi
+  80042e:	00 00 00 
+  800431:	48 b8 af 05 80 00 00 	movabs $0x8005af,%rax
+  800438:	00 00 00 
+  80043b:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  80043d:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  800444:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  80044b:	48 b8 ab 11 80 00 00 	movabs $0x8011ab,%rax
+  800452:	00 00 00 
+  800455:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  800457:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  80045d:	c9                   	leave
+  80045e:	c3                   	ret
+
+000000000080045f <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  80045f:	55                   	push   %rbp
+  800460:	48 89 e5             	mov    %rsp,%rbp
+  800463:	48 83 ec 50          	sub    $0x50,%rsp
+  800467:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  80046b:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  80046f:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800473:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800477:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  80047b:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  800482:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800486:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80048a:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80048e:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  800492:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  800496:	48 b8 fb 03 80 00 00 	movabs $0x8003fb,%rax
+  80049d:	00 00 00 
+  8004a0:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  8004a2:	c9                   	leave
+  8004a3:	c3                   	ret
+
+00000000008004a4 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  8004a4:	55                   	push   %rbp
+  8004a5:	48 89 e5             	mov    %rsp,%rbp
+  8004a8:	41 57                	push   %r15
+  8004aa:	41 56                	push   %r14
+  8004ac:	41 55                	push   %r13
+  8004ae:	41 54                	push   %r12
+  8004b0:	53                   	push   %rbx
+  8004b1:	48 83 ec 18          	sub    $0x18,%rsp
+  8004b5:	49 89 fc             	mov    %rdi,%r12
+  8004b8:	49 89 f5             	mov    %rsi,%r13
+  8004bb:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8004bf:	8b 45 10             	mov    0x10(%rbp),%eax
+  8004c2:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  8004c5:	41 89 cf             	mov    %ecx,%r15d
+  8004c8:	4c 39 fa             	cmp    %r15,%rdx
+  8004cb:	73 5b                	jae    800528 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  8004cd:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  8004d1:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  8004d5:	85 db                	test   %ebx,%ebx
+  8004d7:	7e 0e                	jle    8004e7 <print_num+0x43>
+            putch(padc, put_arg);
+  8004d9:	4c 89 ee             	mov    %r13,%rsi
+  8004dc:	44 89 f7             	mov    %r14d,%edi
+  8004df:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  8004e2:	83 eb 01             	sub    $0x1,%ebx
+  8004e5:	75 f2                	jne    8004d9 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  8004e7:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  8004eb:	48 b9 ac 30 80 00 00 	movabs $0x8030ac,%rcx
+  8004f2:	00 00 00 
+  8004f5:	48 b8 9b 30 80 00 00 	movabs $0x80309b,%rax
+  8004fc:	00 00 00 
+  8004ff:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  800503:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800507:	ba 00 00 00 00       	mov    $0x0,%edx
+  80050c:	49 f7 f7             	div    %r15
+  80050f:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  800513:	4c 89 ee             	mov    %r13,%rsi
+  800516:	41 ff d4             	call   *%r12
+}
+  800519:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  80051d:	5b                   	pop    %rbx
+  80051e:	41 5c                	pop    %r12
+  800520:	41 5d                	pop    %r13
+  800522:	41 5e                	pop    %r14
+  800524:	41 5f                	pop    %r15
+  800526:	5d                   	pop    %rbp
+  800527:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  800528:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80052c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800531:	49 f7 f7             	div    %r15
+  800534:	48 83 ec 08          	sub    $0x8,%rsp
+  800538:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  80053c:	52                   	push   %rdx
+  80053d:	45 0f be c9          	movsbl %r9b,%r9d
+  800541:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  800545:	48 89 c2             	mov    %rax,%rdx
+  800548:	48 b8 a4 04 80 00 00 	movabs $0x8004a4,%rax
+  80054f:	00 00 00 
+  800552:	ff d0                	call   *%rax
+  800554:	48 83 c4 10          	add    $0x10,%rsp
+  800558:	eb 8d                	jmp    8004e7 <print_num+0x43>
+
+000000000080055a <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  80055a:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  80055e:	48 8b 06             	mov    (%rsi),%rax
+  800561:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  800565:	73 0a                	jae    800571 <sprintputch+0x17>
+        *state->start++ = ch;
+  800567:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80056b:	48 89 16             	mov    %rdx,(%rsi)
+  80056e:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  800571:	c3                   	ret
+
+0000000000800572 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  800572:	55                   	push   %rbp
+  800573:	48 89 e5             	mov    %rsp,%rbp
+  800576:	48 83 ec 50          	sub    $0x50,%rsp
+  80057a:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80057e:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800582:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  800586:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  80058d:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800591:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800595:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800599:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  80059d:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8005a1:	48 b8 af 05 80 00 00 	movabs $0x8005af,%rax
+  8005a8:	00 00 00 
+  8005ab:	ff d0                	call   *%rax
+}
+  8005ad:	c9                   	leave
+  8005ae:	c3                   	ret
+
+00000000008005af <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  8005af:	55                   	push   %rbp
+  8005b0:	48 89 e5             	mov    %rsp,%rbp
+  8005b3:	41 57                	push   %r15
+  8005b5:	41 56                	push   %r14
+  8005b7:	41 55                	push   %r13
+  8005b9:	41 54                	push   %r12
+  8005bb:	53                   	push   %rbx
+  8005bc:	48 83 ec 38          	sub    $0x38,%rsp
+  8005c0:	49 89 fe             	mov    %rdi,%r14
+  8005c3:	49 89 f5             	mov    %rsi,%r13
+  8005c6:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  8005c9:	48 8b 01             	mov    (%rcx),%rax
+  8005cc:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8005d0:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  8005d4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8005d8:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  8005dc:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  8005e0:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  8005e4:	0f b6 3b             	movzbl (%rbx),%edi
+  8005e7:	40 80 ff 25          	cmp    $0x25,%dil
+  8005eb:	74 18                	je     800605 <vprintfmt+0x56>
+            if (!ch) return;
+  8005ed:	40 84 ff             	test   %dil,%dil
+  8005f0:	0f 84 b1 06 00 00    	je     800ca7 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  8005f6:	40 0f b6 ff          	movzbl %dil,%edi
+  8005fa:	4c 89 ee             	mov    %r13,%rsi
+  8005fd:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  800600:	4c 89 e3             	mov    %r12,%rbx
+  800603:	eb db                	jmp    8005e0 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  800605:	be 00 00 00 00       	mov    $0x0,%esi
+  80060a:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  80060e:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  800613:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800619:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  800620:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800624:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  800629:	41 0f b6 04 24       	movzbl (%r12),%eax
+  80062e:	88 45 a0             	mov    %al,-0x60(%rbp)
+  800631:	83 e8 23             	sub    $0x23,%eax
+  800634:	3c 57                	cmp    $0x57,%al
+  800636:	0f 87 51 06 00 00    	ja     800c8d <vprintfmt+0x6de>
+  80063c:	0f b6 c0             	movzbl %al,%eax
+  80063f:	48 b9 60 32 80 00 00 	movabs $0x803260,%rcx
+  800646:	00 00 00 
+  800649:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  80064c:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  80064f:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  800653:	eb cf                	jmp    800624 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  800655:	49 89 dc             	mov    %rbx,%r12
+  800658:	be 01 00 00 00       	mov    $0x1,%esi
+  80065d:	eb c5                	jmp    800624 <vprintfmt+0x75>
+            padc = ch;
+  80065f:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  800663:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800666:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800669:	eb b9                	jmp    800624 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  80066b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80066e:	83 f8 2f             	cmp    $0x2f,%eax
+  800671:	77 24                	ja     800697 <vprintfmt+0xe8>
+  800673:	89 c1                	mov    %eax,%ecx
+  800675:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  800679:	83 c0 08             	add    $0x8,%eax
+  80067c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80067f:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  800682:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  800685:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800689:	79 99                	jns    800624 <vprintfmt+0x75>
+                width = precision;
+  80068b:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  80068f:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800695:	eb 8d                	jmp    800624 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800697:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80069b:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  80069f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006a3:	eb da                	jmp    80067f <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  8006a5:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  8006aa:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8006ae:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  8006b4:	3c 39                	cmp    $0x39,%al
+  8006b6:	77 1c                	ja     8006d4 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  8006b8:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  8006bc:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  8006c0:	0f b6 c0             	movzbl %al,%eax
+  8006c3:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8006c8:	0f b6 03             	movzbl (%rbx),%eax
+  8006cb:	3c 39                	cmp    $0x39,%al
+  8006cd:	76 e9                	jbe    8006b8 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  8006cf:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  8006d2:	eb b1                	jmp    800685 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  8006d4:	49 89 dc             	mov    %rbx,%r12
+  8006d7:	eb ac                	jmp    800685 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  8006d9:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  8006dc:	85 c9                	test   %ecx,%ecx
+  8006de:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006e3:	0f 49 c1             	cmovns %ecx,%eax
+  8006e6:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  8006e9:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8006ec:	e9 33 ff ff ff       	jmp    800624 <vprintfmt+0x75>
+            lflag++;
+  8006f1:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  8006f4:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8006f7:	e9 28 ff ff ff       	jmp    800624 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  8006fc:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006ff:	83 f8 2f             	cmp    $0x2f,%eax
+  800702:	77 19                	ja     80071d <vprintfmt+0x16e>
+  800704:	89 c2                	mov    %eax,%edx
+  800706:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80070a:	83 c0 08             	add    $0x8,%eax
+  80070d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800710:	8b 3a                	mov    (%rdx),%edi
+  800712:	4c 89 ee             	mov    %r13,%rsi
+  800715:	41 ff d6             	call   *%r14
+            break;
+  800718:	e9 c3 fe ff ff       	jmp    8005e0 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  80071d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800721:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800725:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800729:	eb e5                	jmp    800710 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  80072b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80072e:	83 f8 2f             	cmp    $0x2f,%eax
+  800731:	77 5a                	ja     80078d <vprintfmt+0x1de>
+  800733:	89 c2                	mov    %eax,%edx
+  800735:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800739:	83 c0 08             	add    $0x8,%eax
+  80073c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  80073f:	8b 02                	mov    (%rdx),%eax
+  800741:	89 c1                	mov    %eax,%ecx
+  800743:	f7 d9                	neg    %ecx
+  800745:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  800748:	83 f9 15             	cmp    $0x15,%ecx
+  80074b:	7f 4e                	jg     80079b <vprintfmt+0x1ec>
+  80074d:	48 63 c1             	movslq %ecx,%rax
+  800750:	48 ba 20 35 80 00 00 	movabs $0x803520,%rdx
+  800757:	00 00 00 
+  80075a:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80075e:	48 85 c0             	test   %rax,%rax
+  800761:	74 38                	je     80079b <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  800763:	48 89 c1             	mov    %rax,%rcx
+  800766:	48 ba 19 37 80 00 00 	movabs $0x803719,%rdx
+  80076d:	00 00 00 
+  800770:	4c 89 ee             	mov    %r13,%rsi
+  800773:	4c 89 f7             	mov    %r14,%rdi
+  800776:	b8 00 00 00 00       	mov    $0x0,%eax
+  80077b:	49 b8 72 05 80 00 00 	movabs $0x800572,%r8
+  800782:	00 00 00 
+  800785:	41 ff d0             	call   *%r8
+  800788:	e9 53 fe ff ff       	jmp    8005e0 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  80078d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800791:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800795:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800799:	eb a4                	jmp    80073f <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  80079b:	48 ba c4 30 80 00 00 	movabs $0x8030c4,%rdx
+  8007a2:	00 00 00 
+  8007a5:	4c 89 ee             	mov    %r13,%rsi
+  8007a8:	4c 89 f7             	mov    %r14,%rdi
+  8007ab:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007b0:	49 b8 72 05 80 00 00 	movabs $0x800572,%r8
+  8007b7:	00 00 00 
+  8007ba:	41 ff d0             	call   *%r8
+  8007bd:	e9 1e fe ff ff       	jmp    8005e0 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8007c2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007c5:	83 f8 2f             	cmp    $0x2f,%eax
+  8007c8:	77 6c                	ja     800836 <vprintfmt+0x287>
+  8007ca:	89 c2                	mov    %eax,%edx
+  8007cc:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007d0:	83 c0 08             	add    $0x8,%eax
+  8007d3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007d6:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  8007d9:	48 85 d2             	test   %rdx,%rdx
+  8007dc:	48 b8 bd 30 80 00 00 	movabs $0x8030bd,%rax
+  8007e3:	00 00 00 
+  8007e6:	48 0f 45 c2          	cmovne %rdx,%rax
+  8007ea:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  8007ee:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8007f2:	7e 06                	jle    8007fa <vprintfmt+0x24b>
+  8007f4:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  8007f8:	75 4a                	jne    800844 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8007fa:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8007fe:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  800802:	0f b6 00             	movzbl (%rax),%eax
+  800805:	84 c0                	test   %al,%al
+  800807:	0f 85 9a 00 00 00    	jne    8008a7 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  80080d:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800810:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  800814:	85 c0                	test   %eax,%eax
+  800816:	0f 8e c4 fd ff ff    	jle    8005e0 <vprintfmt+0x31>
+  80081c:	4c 89 ee             	mov    %r13,%rsi
+  80081f:	bf 20 00 00 00       	mov    $0x20,%edi
+  800824:	41 ff d6             	call   *%r14
+  800827:	41 83 ec 01          	sub    $0x1,%r12d
+  80082b:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  80082f:	75 eb                	jne    80081c <vprintfmt+0x26d>
+  800831:	e9 aa fd ff ff       	jmp    8005e0 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800836:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80083a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80083e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800842:	eb 92                	jmp    8007d6 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  800844:	49 63 f7             	movslq %r15d,%rsi
+  800847:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  80084b:	48 b8 61 0d 80 00 00 	movabs $0x800d61,%rax
+  800852:	00 00 00 
+  800855:	ff d0                	call   *%rax
+  800857:	48 89 c2             	mov    %rax,%rdx
+  80085a:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80085d:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  80085f:	8d 70 ff             	lea    -0x1(%rax),%esi
+  800862:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  800865:	85 c0                	test   %eax,%eax
+  800867:	7e 91                	jle    8007fa <vprintfmt+0x24b>
+  800869:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  80086e:	4c 89 ee             	mov    %r13,%rsi
+  800871:	44 89 e7             	mov    %r12d,%edi
+  800874:	41 ff d6             	call   *%r14
+  800877:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  80087b:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80087e:	83 f8 ff             	cmp    $0xffffffff,%eax
+  800881:	75 eb                	jne    80086e <vprintfmt+0x2bf>
+  800883:	e9 72 ff ff ff       	jmp    8007fa <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800888:	0f b6 f8             	movzbl %al,%edi
+  80088b:	4c 89 ee             	mov    %r13,%rsi
+  80088e:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800891:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800895:	49 83 c4 01          	add    $0x1,%r12
+  800899:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  80089f:	84 c0                	test   %al,%al
+  8008a1:	0f 84 66 ff ff ff    	je     80080d <vprintfmt+0x25e>
+  8008a7:	45 85 ff             	test   %r15d,%r15d
+  8008aa:	78 0a                	js     8008b6 <vprintfmt+0x307>
+  8008ac:	41 83 ef 01          	sub    $0x1,%r15d
+  8008b0:	0f 88 57 ff ff ff    	js     80080d <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8008b6:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  8008ba:	74 cc                	je     800888 <vprintfmt+0x2d9>
+  8008bc:	8d 50 e0             	lea    -0x20(%rax),%edx
+  8008bf:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  8008c4:	80 fa 5e             	cmp    $0x5e,%dl
+  8008c7:	77 c2                	ja     80088b <vprintfmt+0x2dc>
+  8008c9:	eb bd                	jmp    800888 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  8008cb:	40 84 f6             	test   %sil,%sil
+  8008ce:	75 26                	jne    8008f6 <vprintfmt+0x347>
+    switch (lflag) {
+  8008d0:	85 d2                	test   %edx,%edx
+  8008d2:	74 59                	je     80092d <vprintfmt+0x37e>
+  8008d4:	83 fa 01             	cmp    $0x1,%edx
+  8008d7:	74 7b                	je     800954 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  8008d9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008dc:	83 f8 2f             	cmp    $0x2f,%eax
+  8008df:	0f 87 96 00 00 00    	ja     80097b <vprintfmt+0x3cc>
+  8008e5:	89 c2                	mov    %eax,%edx
+  8008e7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008eb:	83 c0 08             	add    $0x8,%eax
+  8008ee:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008f1:	4c 8b 22             	mov    (%rdx),%r12
+  8008f4:	eb 17                	jmp    80090d <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  8008f6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008f9:	83 f8 2f             	cmp    $0x2f,%eax
+  8008fc:	77 21                	ja     80091f <vprintfmt+0x370>
+  8008fe:	89 c2                	mov    %eax,%edx
+  800900:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800904:	83 c0 08             	add    $0x8,%eax
+  800907:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80090a:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  80090d:	4d 85 e4             	test   %r12,%r12
+  800910:	78 7a                	js     80098c <vprintfmt+0x3dd>
+            num = i;
+  800912:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  800915:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  80091a:	e9 50 02 00 00       	jmp    800b6f <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  80091f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800923:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800927:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80092b:	eb dd                	jmp    80090a <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  80092d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800930:	83 f8 2f             	cmp    $0x2f,%eax
+  800933:	77 11                	ja     800946 <vprintfmt+0x397>
+  800935:	89 c2                	mov    %eax,%edx
+  800937:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80093b:	83 c0 08             	add    $0x8,%eax
+  80093e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800941:	4c 63 22             	movslq (%rdx),%r12
+  800944:	eb c7                	jmp    80090d <vprintfmt+0x35e>
+  800946:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80094a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80094e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800952:	eb ed                	jmp    800941 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  800954:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800957:	83 f8 2f             	cmp    $0x2f,%eax
+  80095a:	77 11                	ja     80096d <vprintfmt+0x3be>
+  80095c:	89 c2                	mov    %eax,%edx
+  80095e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800962:	83 c0 08             	add    $0x8,%eax
+  800965:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800968:	4c 8b 22             	mov    (%rdx),%r12
+  80096b:	eb a0                	jmp    80090d <vprintfmt+0x35e>
+  80096d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800971:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800975:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800979:	eb ed                	jmp    800968 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  80097b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80097f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800983:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800987:	e9 65 ff ff ff       	jmp    8008f1 <vprintfmt+0x342>
+                putch('-', put_arg);
+  80098c:	4c 89 ee             	mov    %r13,%rsi
+  80098f:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800994:	41 ff d6             	call   *%r14
+                i = -i;
+  800997:	49 f7 dc             	neg    %r12
+  80099a:	e9 73 ff ff ff       	jmp    800912 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  80099f:	40 84 f6             	test   %sil,%sil
+  8009a2:	75 32                	jne    8009d6 <vprintfmt+0x427>
+    switch (lflag) {
+  8009a4:	85 d2                	test   %edx,%edx
+  8009a6:	74 5d                	je     800a05 <vprintfmt+0x456>
+  8009a8:	83 fa 01             	cmp    $0x1,%edx
+  8009ab:	0f 84 82 00 00 00    	je     800a33 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  8009b1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009b4:	83 f8 2f             	cmp    $0x2f,%eax
+  8009b7:	0f 87 a5 00 00 00    	ja     800a62 <vprintfmt+0x4b3>
+  8009bd:	89 c2                	mov    %eax,%edx
+  8009bf:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009c3:	83 c0 08             	add    $0x8,%eax
+  8009c6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009c9:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8009cc:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  8009d1:	e9 99 01 00 00       	jmp    800b6f <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8009d6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009d9:	83 f8 2f             	cmp    $0x2f,%eax
+  8009dc:	77 19                	ja     8009f7 <vprintfmt+0x448>
+  8009de:	89 c2                	mov    %eax,%edx
+  8009e0:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009e4:	83 c0 08             	add    $0x8,%eax
+  8009e7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009ea:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8009ed:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8009f2:	e9 78 01 00 00       	jmp    800b6f <vprintfmt+0x5c0>
+  8009f7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009fb:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009ff:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a03:	eb e5                	jmp    8009ea <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  800a05:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a08:	83 f8 2f             	cmp    $0x2f,%eax
+  800a0b:	77 18                	ja     800a25 <vprintfmt+0x476>
+  800a0d:	89 c2                	mov    %eax,%edx
+  800a0f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a13:	83 c0 08             	add    $0x8,%eax
+  800a16:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a19:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800a1b:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  800a20:	e9 4a 01 00 00       	jmp    800b6f <vprintfmt+0x5c0>
+  800a25:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a29:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a2d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a31:	eb e6                	jmp    800a19 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  800a33:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a36:	83 f8 2f             	cmp    $0x2f,%eax
+  800a39:	77 19                	ja     800a54 <vprintfmt+0x4a5>
+  800a3b:	89 c2                	mov    %eax,%edx
+  800a3d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a41:	83 c0 08             	add    $0x8,%eax
+  800a44:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a47:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800a4a:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  800a4f:	e9 1b 01 00 00       	jmp    800b6f <vprintfmt+0x5c0>
+  800a54:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a58:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a5c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a60:	eb e5                	jmp    800a47 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  800a62:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a66:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a6a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a6e:	e9 56 ff ff ff       	jmp    8009c9 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  800a73:	40 84 f6             	test   %sil,%sil
+  800a76:	75 2e                	jne    800aa6 <vprintfmt+0x4f7>
+    switch (lflag) {
+  800a78:	85 d2                	test   %edx,%edx
+  800a7a:	74 59                	je     800ad5 <vprintfmt+0x526>
+  800a7c:	83 fa 01             	cmp    $0x1,%edx
+  800a7f:	74 7f                	je     800b00 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  800a81:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a84:	83 f8 2f             	cmp    $0x2f,%eax
+  800a87:	0f 87 9f 00 00 00    	ja     800b2c <vprintfmt+0x57d>
+  800a8d:	89 c2                	mov    %eax,%edx
+  800a8f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a93:	83 c0 08             	add    $0x8,%eax
+  800a96:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a99:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800a9c:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  800aa1:	e9 c9 00 00 00       	jmp    800b6f <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800aa6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800aa9:	83 f8 2f             	cmp    $0x2f,%eax
+  800aac:	77 19                	ja     800ac7 <vprintfmt+0x518>
+  800aae:	89 c2                	mov    %eax,%edx
+  800ab0:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ab4:	83 c0 08             	add    $0x8,%eax
+  800ab7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800aba:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800abd:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800ac2:	e9 a8 00 00 00       	jmp    800b6f <vprintfmt+0x5c0>
+  800ac7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800acb:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800acf:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ad3:	eb e5                	jmp    800aba <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  800ad5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ad8:	83 f8 2f             	cmp    $0x2f,%eax
+  800adb:	77 15                	ja     800af2 <vprintfmt+0x543>
+  800add:	89 c2                	mov    %eax,%edx
+  800adf:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ae3:	83 c0 08             	add    $0x8,%eax
+  800ae6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ae9:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  800aeb:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  800af0:	eb 7d                	jmp    800b6f <vprintfmt+0x5c0>
+  800af2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800af6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800afa:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800afe:	eb e9                	jmp    800ae9 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  800b00:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b03:	83 f8 2f             	cmp    $0x2f,%eax
+  800b06:	77 16                	ja     800b1e <vprintfmt+0x56f>
+  800b08:	89 c2                	mov    %eax,%edx
+  800b0a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b0e:	83 c0 08             	add    $0x8,%eax
+  800b11:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b14:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800b17:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  800b1c:	eb 51                	jmp    800b6f <vprintfmt+0x5c0>
+  800b1e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b22:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b26:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b2a:	eb e8                	jmp    800b14 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  800b2c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b30:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b34:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b38:	e9 5c ff ff ff       	jmp    800a99 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  800b3d:	4c 89 ee             	mov    %r13,%rsi
+  800b40:	bf 30 00 00 00       	mov    $0x30,%edi
+  800b45:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800b48:	4c 89 ee             	mov    %r13,%rsi
+  800b4b:	bf 78 00 00 00       	mov    $0x78,%edi
+  800b50:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800b53:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b56:	83 f8 2f             	cmp    $0x2f,%eax
+  800b59:	77 47                	ja     800ba2 <vprintfmt+0x5f3>
+  800b5b:	89 c2                	mov    %eax,%edx
+  800b5d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b61:	83 c0 08             	add    $0x8,%eax
+  800b64:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b67:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800b6a:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800b6f:	48 83 ec 08          	sub    $0x8,%rsp
+  800b73:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800b77:	0f 94 c0             	sete   %al
+  800b7a:	0f b6 c0             	movzbl %al,%eax
+  800b7d:	50                   	push   %rax
+  800b7e:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800b83:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800b87:	4c 89 ee             	mov    %r13,%rsi
+  800b8a:	4c 89 f7             	mov    %r14,%rdi
+  800b8d:	48 b8 a4 04 80 00 00 	movabs $0x8004a4,%rax
+  800b94:	00 00 00 
+  800b97:	ff d0                	call   *%rax
+            break;
+  800b99:	48 83 c4 10          	add    $0x10,%rsp
+  800b9d:	e9 3e fa ff ff       	jmp    8005e0 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800ba2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ba6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800baa:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bae:	eb b7                	jmp    800b67 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  800bb0:	40 84 f6             	test   %sil,%sil
+  800bb3:	75 2b                	jne    800be0 <vprintfmt+0x631>
+    switch (lflag) {
+  800bb5:	85 d2                	test   %edx,%edx
+  800bb7:	74 56                	je     800c0f <vprintfmt+0x660>
+  800bb9:	83 fa 01             	cmp    $0x1,%edx
+  800bbc:	74 7f                	je     800c3d <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800bbe:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bc1:	83 f8 2f             	cmp    $0x2f,%eax
+  800bc4:	0f 87 a2 00 00 00    	ja     800c6c <vprintfmt+0x6bd>
+  800bca:	89 c2                	mov    %eax,%edx
+  800bcc:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800bd0:	83 c0 08             	add    $0x8,%eax
+  800bd3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800bd6:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800bd9:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800bde:	eb 8f                	jmp    800b6f <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800be0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800be3:	83 f8 2f             	cmp    $0x2f,%eax
+  800be6:	77 19                	ja     800c01 <vprintfmt+0x652>
+  800be8:	89 c2                	mov    %eax,%edx
+  800bea:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800bee:	83 c0 08             	add    $0x8,%eax
+  800bf1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800bf4:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800bf7:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800bfc:	e9 6e ff ff ff       	jmp    800b6f <vprintfmt+0x5c0>
+  800c01:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c05:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c09:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c0d:	eb e5                	jmp    800bf4 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800c0f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c12:	83 f8 2f             	cmp    $0x2f,%eax
+  800c15:	77 18                	ja     800c2f <vprintfmt+0x680>
+  800c17:	89 c2                	mov    %eax,%edx
+  800c19:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c1d:	83 c0 08             	add    $0x8,%eax
+  800c20:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c23:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800c25:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800c2a:	e9 40 ff ff ff       	jmp    800b6f <vprintfmt+0x5c0>
+  800c2f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c33:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c37:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c3b:	eb e6                	jmp    800c23 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800c3d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c40:	83 f8 2f             	cmp    $0x2f,%eax
+  800c43:	77 19                	ja     800c5e <vprintfmt+0x6af>
+  800c45:	89 c2                	mov    %eax,%edx
+  800c47:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c4b:	83 c0 08             	add    $0x8,%eax
+  800c4e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c51:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800c54:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800c59:	e9 11 ff ff ff       	jmp    800b6f <vprintfmt+0x5c0>
+  800c5e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c62:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c66:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c6a:	eb e5                	jmp    800c51 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800c6c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c70:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c74:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c78:	e9 59 ff ff ff       	jmp    800bd6 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800c7d:	4c 89 ee             	mov    %r13,%rsi
+  800c80:	bf 25 00 00 00       	mov    $0x25,%edi
+  800c85:	41 ff d6             	call   *%r14
+            break;
+  800c88:	e9 53 f9 ff ff       	jmp    8005e0 <vprintfmt+0x31>
+            putch('%', put_arg);
+  800c8d:	4c 89 ee             	mov    %r13,%rsi
+  800c90:	bf 25 00 00 00       	mov    $0x25,%edi
+  800c95:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800c98:	48 83 eb 01          	sub    $0x1,%rbx
+  800c9c:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800ca0:	75 f6                	jne    800c98 <vprintfmt+0x6e9>
+  800ca2:	e9 39 f9 ff ff       	jmp    8005e0 <vprintfmt+0x31>
+}
+  800ca7:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800cab:	5b                   	pop    %rbx
+  800cac:	41 5c                	pop    %r12
+  800cae:	41 5d                	pop    %r13
+  800cb0:	41 5e                	pop    %r14
+  800cb2:	41 5f                	pop    %r15
+  800cb4:	5d                   	pop    %rbp
+  800cb5:	c3                   	ret
+
+0000000000800cb6 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800cb6:	55                   	push   %rbp
+  800cb7:	48 89 e5             	mov    %rsp,%rbp
+  800cba:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800cbe:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800cc2:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800cc7:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800ccb:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800cd2:	48 85 ff             	test   %rdi,%rdi
+  800cd5:	74 2b                	je     800d02 <vsnprintf+0x4c>
+  800cd7:	48 85 f6             	test   %rsi,%rsi
+  800cda:	74 26                	je     800d02 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800cdc:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800ce0:	48 bf 5a 05 80 00 00 	movabs $0x80055a,%rdi
+  800ce7:	00 00 00 
+  800cea:	48 b8 af 05 80 00 00 	movabs $0x8005af,%rax
+  800cf1:	00 00 00 
+  800cf4:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800cf6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800cfa:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800cfd:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800d00:	c9                   	leave
+  800d01:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800d02:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800d07:	eb f7                	jmp    800d00 <vsnprintf+0x4a>
+
+0000000000800d09 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800d09:	55                   	push   %rbp
+  800d0a:	48 89 e5             	mov    %rsp,%rbp
+  800d0d:	48 83 ec 50          	sub    $0x50,%rsp
+  800d11:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800d15:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800d19:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800d1d:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800d24:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800d28:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d2c:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800d30:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800d34:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800d38:	48 b8 b6 0c 80 00 00 	movabs $0x800cb6,%rax
+  800d3f:	00 00 00 
+  800d42:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800d44:	c9                   	leave
+  800d45:	c3                   	ret
+
+0000000000800d46 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800d46:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800d49:	74 10                	je     800d5b <strlen+0x15>
+    size_t n = 0;
+  800d4b:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800d50:	48 83 c0 01          	add    $0x1,%rax
+  800d54:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800d58:	75 f6                	jne    800d50 <strlen+0xa>
+  800d5a:	c3                   	ret
+    size_t n = 0;
+  800d5b:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800d60:	c3                   	ret
+
+0000000000800d61 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800d61:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800d64:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800d69:	48 85 f6             	test   %rsi,%rsi
+  800d6c:	74 11                	je     800d7f <strnlen+0x1e>
+  800d6e:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800d72:	74 0c                	je     800d80 <strnlen+0x1f>
+  800d74:	48 83 c2 01          	add    $0x1,%rdx
+  800d78:	48 39 d0             	cmp    %rdx,%rax
+  800d7b:	75 f1                	jne    800d6e <strnlen+0xd>
+  800d7d:	eb 04                	jmp    800d83 <strnlen+0x22>
+  800d7f:	c3                   	ret
+  800d80:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800d83:	c3                   	ret
+
+0000000000800d84 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800d84:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800d87:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d8c:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800d90:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800d93:	48 83 c2 01          	add    $0x1,%rdx
+  800d97:	84 c9                	test   %cl,%cl
+  800d99:	75 f1                	jne    800d8c <strcpy+0x8>
+        ;
+    return res;
+}
+  800d9b:	c3                   	ret
+
+0000000000800d9c <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800d9c:	55                   	push   %rbp
+  800d9d:	48 89 e5             	mov    %rsp,%rbp
+  800da0:	41 54                	push   %r12
+  800da2:	53                   	push   %rbx
+  800da3:	48 89 fb             	mov    %rdi,%rbx
+  800da6:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800da9:	48 b8 46 0d 80 00 00 	movabs $0x800d46,%rax
+  800db0:	00 00 00 
+  800db3:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800db5:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800db9:	4c 89 e6             	mov    %r12,%rsi
+  800dbc:	48 b8 84 0d 80 00 00 	movabs $0x800d84,%rax
+  800dc3:	00 00 00 
+  800dc6:	ff d0                	call   *%rax
+    return dst;
+}
+  800dc8:	48 89 d8             	mov    %rbx,%rax
+  800dcb:	5b                   	pop    %rbx
+  800dcc:	41 5c                	pop    %r12
+  800dce:	5d                   	pop    %rbp
+  800dcf:	c3                   	ret
+
+0000000000800dd0 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800dd0:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800dd3:	48 85 d2             	test   %rdx,%rdx
+  800dd6:	74 1f                	je     800df7 <strncpy+0x27>
+  800dd8:	48 01 fa             	add    %rdi,%rdx
+  800ddb:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800dde:	48 83 c1 01          	add    $0x1,%rcx
+  800de2:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800de6:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800dea:	41 80 f8 01          	cmp    $0x1,%r8b
+  800dee:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800df2:	48 39 ca             	cmp    %rcx,%rdx
+  800df5:	75 e7                	jne    800dde <strncpy+0xe>
+    }
+    return ret;
+}
+  800df7:	c3                   	ret
+
+0000000000800df8 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800df8:	48 89 f8             	mov    %rdi,%rax
+  800dfb:	48 85 d2             	test   %rdx,%rdx
+  800dfe:	74 24                	je     800e24 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800e00:	48 83 ea 01          	sub    $0x1,%rdx
+  800e04:	74 1b                	je     800e21 <strlcpy+0x29>
+  800e06:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800e0a:	0f b6 16             	movzbl (%rsi),%edx
+  800e0d:	84 d2                	test   %dl,%dl
+  800e0f:	74 10                	je     800e21 <strlcpy+0x29>
+            *dst++ = *src++;
+  800e11:	48 83 c6 01          	add    $0x1,%rsi
+  800e15:	48 83 c0 01          	add    $0x1,%rax
+  800e19:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800e1c:	48 39 c8             	cmp    %rcx,%rax
+  800e1f:	75 e9                	jne    800e0a <strlcpy+0x12>
+        *dst = '\0';
+  800e21:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800e24:	48 29 f8             	sub    %rdi,%rax
+}
+  800e27:	c3                   	ret
+
+0000000000800e28 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800e28:	0f b6 07             	movzbl (%rdi),%eax
+  800e2b:	84 c0                	test   %al,%al
+  800e2d:	74 13                	je     800e42 <strcmp+0x1a>
+  800e2f:	38 06                	cmp    %al,(%rsi)
+  800e31:	75 0f                	jne    800e42 <strcmp+0x1a>
+  800e33:	48 83 c7 01          	add    $0x1,%rdi
+  800e37:	48 83 c6 01          	add    $0x1,%rsi
+  800e3b:	0f b6 07             	movzbl (%rdi),%eax
+  800e3e:	84 c0                	test   %al,%al
+  800e40:	75 ed                	jne    800e2f <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800e42:	0f b6 c0             	movzbl %al,%eax
+  800e45:	0f b6 16             	movzbl (%rsi),%edx
+  800e48:	29 d0                	sub    %edx,%eax
+}
+  800e4a:	c3                   	ret
+
+0000000000800e4b <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800e4b:	48 85 d2             	test   %rdx,%rdx
+  800e4e:	74 1f                	je     800e6f <strncmp+0x24>
+  800e50:	0f b6 07             	movzbl (%rdi),%eax
+  800e53:	84 c0                	test   %al,%al
+  800e55:	74 1e                	je     800e75 <strncmp+0x2a>
+  800e57:	3a 06                	cmp    (%rsi),%al
+  800e59:	75 1a                	jne    800e75 <strncmp+0x2a>
+  800e5b:	48 83 c7 01          	add    $0x1,%rdi
+  800e5f:	48 83 c6 01          	add    $0x1,%rsi
+  800e63:	48 83 ea 01          	sub    $0x1,%rdx
+  800e67:	75 e7                	jne    800e50 <strncmp+0x5>
+
+    if (!n) return 0;
+  800e69:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e6e:	c3                   	ret
+  800e6f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e74:	c3                   	ret
+  800e75:	48 85 d2             	test   %rdx,%rdx
+  800e78:	74 09                	je     800e83 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800e7a:	0f b6 07             	movzbl (%rdi),%eax
+  800e7d:	0f b6 16             	movzbl (%rsi),%edx
+  800e80:	29 d0                	sub    %edx,%eax
+  800e82:	c3                   	ret
+    if (!n) return 0;
+  800e83:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800e88:	c3                   	ret
+
+0000000000800e89 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800e89:	0f b6 17             	movzbl (%rdi),%edx
+  800e8c:	84 d2                	test   %dl,%dl
+  800e8e:	74 18                	je     800ea8 <strchr+0x1f>
+        if (*str == c) {
+  800e90:	0f be d2             	movsbl %dl,%edx
+  800e93:	39 f2                	cmp    %esi,%edx
+  800e95:	74 17                	je     800eae <strchr+0x25>
+    for (; *str; str++) {
+  800e97:	48 83 c7 01          	add    $0x1,%rdi
+  800e9b:	0f b6 17             	movzbl (%rdi),%edx
+  800e9e:	84 d2                	test   %dl,%dl
+  800ea0:	75 ee                	jne    800e90 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800ea2:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ea7:	c3                   	ret
+  800ea8:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ead:	c3                   	ret
+  800eae:	48 89 f8             	mov    %rdi,%rax
+}
+  800eb1:	c3                   	ret
+
+0000000000800eb2 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800eb2:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800eb5:	0f b6 17             	movzbl (%rdi),%edx
+  800eb8:	84 d2                	test   %dl,%dl
+  800eba:	74 13                	je     800ecf <strfind+0x1d>
+  800ebc:	0f be d2             	movsbl %dl,%edx
+  800ebf:	39 f2                	cmp    %esi,%edx
+  800ec1:	74 0b                	je     800ece <strfind+0x1c>
+  800ec3:	48 83 c0 01          	add    $0x1,%rax
+  800ec7:	0f b6 10             	movzbl (%rax),%edx
+  800eca:	84 d2                	test   %dl,%dl
+  800ecc:	75 ee                	jne    800ebc <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800ece:	c3                   	ret
+  800ecf:	c3                   	ret
+
+0000000000800ed0 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800ed0:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800ed3:	48 89 f8             	mov    %rdi,%rax
+  800ed6:	48 f7 d8             	neg    %rax
+  800ed9:	83 e0 07             	and    $0x7,%eax
+  800edc:	49 89 d1             	mov    %rdx,%r9
+  800edf:	49 29 c1             	sub    %rax,%r9
+  800ee2:	78 36                	js     800f1a <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800ee4:	40 0f b6 c6          	movzbl %sil,%eax
+  800ee8:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800eef:	01 01 01 
+  800ef2:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800ef6:	40 f6 c7 07          	test   $0x7,%dil
+  800efa:	75 38                	jne    800f34 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800efc:	4c 89 c9             	mov    %r9,%rcx
+  800eff:	48 c1 f9 03          	sar    $0x3,%rcx
+  800f03:	74 0c                	je     800f11 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800f05:	fc                   	cld
+  800f06:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800f09:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800f0d:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800f11:	4d 85 c9             	test   %r9,%r9
+  800f14:	75 45                	jne    800f5b <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800f16:	4c 89 c0             	mov    %r8,%rax
+  800f19:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800f1a:	48 85 d2             	test   %rdx,%rdx
+  800f1d:	74 f7                	je     800f16 <memset+0x46>
+  800f1f:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800f22:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800f25:	48 83 c0 01          	add    $0x1,%rax
+  800f29:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  800f2d:	48 39 c2             	cmp    %rax,%rdx
+  800f30:	75 f3                	jne    800f25 <memset+0x55>
+  800f32:	eb e2                	jmp    800f16 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  800f34:	40 f6 c7 01          	test   $0x1,%dil
+  800f38:	74 06                	je     800f40 <memset+0x70>
+  800f3a:	88 07                	mov    %al,(%rdi)
+  800f3c:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800f40:	40 f6 c7 02          	test   $0x2,%dil
+  800f44:	74 07                	je     800f4d <memset+0x7d>
+  800f46:	66 89 07             	mov    %ax,(%rdi)
+  800f49:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800f4d:	40 f6 c7 04          	test   $0x4,%dil
+  800f51:	74 a9                	je     800efc <memset+0x2c>
+  800f53:	89 07                	mov    %eax,(%rdi)
+  800f55:	48 83 c7 04          	add    $0x4,%rdi
+  800f59:	eb a1                	jmp    800efc <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800f5b:	41 f6 c1 04          	test   $0x4,%r9b
+  800f5f:	74 06                	je     800f67 <memset+0x97>
+  800f61:	89 07                	mov    %eax,(%rdi)
+  800f63:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800f67:	41 f6 c1 02          	test   $0x2,%r9b
+  800f6b:	74 07                	je     800f74 <memset+0xa4>
+  800f6d:	66 89 07             	mov    %ax,(%rdi)
+  800f70:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  800f74:	41 f6 c1 01          	test   $0x1,%r9b
+  800f78:	74 9c                	je     800f16 <memset+0x46>
+  800f7a:	88 07                	mov    %al,(%rdi)
+  800f7c:	eb 98                	jmp    800f16 <memset+0x46>
+
+0000000000800f7e <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  800f7e:	48 89 f8             	mov    %rdi,%rax
+  800f81:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  800f84:	48 39 fe             	cmp    %rdi,%rsi
+  800f87:	73 3b                	jae    800fc4 <memmove+0x46>
+  800f89:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  800f8d:	48 39 d7             	cmp    %rdx,%rdi
+  800f90:	73 32                	jae    800fc4 <memmove+0x46>
+        s += n;
+        d += n;
+  800f92:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800f96:	48 89 d6             	mov    %rdx,%rsi
+  800f99:	48 09 fe             	or     %rdi,%rsi
+  800f9c:	48 09 ce             	or     %rcx,%rsi
+  800f9f:	40 f6 c6 07          	test   $0x7,%sil
+  800fa3:	75 12                	jne    800fb7 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  800fa5:	48 83 ef 08          	sub    $0x8,%rdi
+  800fa9:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  800fad:	48 c1 e9 03          	shr    $0x3,%rcx
+  800fb1:	fd                   	std
+  800fb2:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  800fb5:	fc                   	cld
+  800fb6:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  800fb7:	48 83 ef 01          	sub    $0x1,%rdi
+  800fbb:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  800fbf:	fd                   	std
+  800fc0:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  800fc2:	eb f1                	jmp    800fb5 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800fc4:	48 89 f2             	mov    %rsi,%rdx
+  800fc7:	48 09 c2             	or     %rax,%rdx
+  800fca:	48 09 ca             	or     %rcx,%rdx
+  800fcd:	f6 c2 07             	test   $0x7,%dl
+  800fd0:	75 0c                	jne    800fde <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  800fd2:	48 c1 e9 03          	shr    $0x3,%rcx
+  800fd6:	48 89 c7             	mov    %rax,%rdi
+  800fd9:	fc                   	cld
+  800fda:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  800fdd:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  800fde:	48 89 c7             	mov    %rax,%rdi
+  800fe1:	fc                   	cld
+  800fe2:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  800fe4:	c3                   	ret
+
+0000000000800fe5 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  800fe5:	55                   	push   %rbp
+  800fe6:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  800fe9:	48 b8 7e 0f 80 00 00 	movabs $0x800f7e,%rax
+  800ff0:	00 00 00 
+  800ff3:	ff d0                	call   *%rax
+}
+  800ff5:	5d                   	pop    %rbp
+  800ff6:	c3                   	ret
+
+0000000000800ff7 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  800ff7:	55                   	push   %rbp
+  800ff8:	48 89 e5             	mov    %rsp,%rbp
+  800ffb:	41 57                	push   %r15
+  800ffd:	41 56                	push   %r14
+  800fff:	41 55                	push   %r13
+  801001:	41 54                	push   %r12
+  801003:	53                   	push   %rbx
+  801004:	48 83 ec 08          	sub    $0x8,%rsp
+  801008:	49 89 fe             	mov    %rdi,%r14
+  80100b:	49 89 f7             	mov    %rsi,%r15
+  80100e:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  801011:	48 89 f7             	mov    %rsi,%rdi
+  801014:	48 b8 46 0d 80 00 00 	movabs $0x800d46,%rax
+  80101b:	00 00 00 
+  80101e:	ff d0                	call   *%rax
+  801020:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  801023:	48 89 de             	mov    %rbx,%rsi
+  801026:	4c 89 f7             	mov    %r14,%rdi
+  801029:	48 b8 61 0d 80 00 00 	movabs $0x800d61,%rax
+  801030:	00 00 00 
+  801033:	ff d0                	call   *%rax
+  801035:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  801038:	48 39 c3             	cmp    %rax,%rbx
+  80103b:	74 36                	je     801073 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  80103d:	48 89 d8             	mov    %rbx,%rax
+  801040:	4c 29 e8             	sub    %r13,%rax
+  801043:	49 39 c4             	cmp    %rax,%r12
+  801046:	73 31                	jae    801079 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  801048:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  80104d:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  801051:	4c 89 fe             	mov    %r15,%rsi
+  801054:	48 b8 e5 0f 80 00 00 	movabs $0x800fe5,%rax
+  80105b:	00 00 00 
+  80105e:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  801060:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  801064:	48 83 c4 08          	add    $0x8,%rsp
+  801068:	5b                   	pop    %rbx
+  801069:	41 5c                	pop    %r12
+  80106b:	41 5d                	pop    %r13
+  80106d:	41 5e                	pop    %r14
+  80106f:	41 5f                	pop    %r15
+  801071:	5d                   	pop    %rbp
+  801072:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  801073:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  801077:	eb eb                	jmp    801064 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  801079:	48 83 eb 01          	sub    $0x1,%rbx
+  80107d:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  801081:	48 89 da             	mov    %rbx,%rdx
+  801084:	4c 89 fe             	mov    %r15,%rsi
+  801087:	48 b8 e5 0f 80 00 00 	movabs $0x800fe5,%rax
+  80108e:	00 00 00 
+  801091:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  801093:	49 01 de             	add    %rbx,%r14
+  801096:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  80109b:	eb c3                	jmp    801060 <strlcat+0x69>
+
+000000000080109d <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  80109d:	48 85 d2             	test   %rdx,%rdx
+  8010a0:	74 2d                	je     8010cf <memcmp+0x32>
+  8010a2:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  8010a7:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  8010ab:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  8010b0:	44 38 c1             	cmp    %r8b,%cl
+  8010b3:	75 0f                	jne    8010c4 <memcmp+0x27>
+    while (n-- > 0) {
+  8010b5:	48 83 c0 01          	add    $0x1,%rax
+  8010b9:	48 39 c2             	cmp    %rax,%rdx
+  8010bc:	75 e9                	jne    8010a7 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  8010be:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010c3:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  8010c4:	0f b6 c1             	movzbl %cl,%eax
+  8010c7:	45 0f b6 c0          	movzbl %r8b,%r8d
+  8010cb:	44 29 c0             	sub    %r8d,%eax
+  8010ce:	c3                   	ret
+    return 0;
+  8010cf:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8010d4:	c3                   	ret
+
+00000000008010d5 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  8010d5:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  8010d9:	48 39 c7             	cmp    %rax,%rdi
+  8010dc:	73 0f                	jae    8010ed <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  8010de:	40 38 37             	cmp    %sil,(%rdi)
+  8010e1:	74 0e                	je     8010f1 <memfind+0x1c>
+    for (; src < end; src++) {
+  8010e3:	48 83 c7 01          	add    $0x1,%rdi
+  8010e7:	48 39 f8             	cmp    %rdi,%rax
+  8010ea:	75 f2                	jne    8010de <memfind+0x9>
+  8010ec:	c3                   	ret
+  8010ed:	48 89 f8             	mov    %rdi,%rax
+  8010f0:	c3                   	ret
+  8010f1:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  8010f4:	c3                   	ret
+
+00000000008010f5 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  8010f5:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  8010f8:	0f b6 37             	movzbl (%rdi),%esi
+  8010fb:	40 80 fe 20          	cmp    $0x20,%sil
+  8010ff:	74 06                	je     801107 <strtol+0x12>
+  801101:	40 80 fe 09          	cmp    $0x9,%sil
+  801105:	75 13                	jne    80111a <strtol+0x25>
+  801107:	48 83 c7 01          	add    $0x1,%rdi
+  80110b:	0f b6 37             	movzbl (%rdi),%esi
+  80110e:	40 80 fe 20          	cmp    $0x20,%sil
+  801112:	74 f3                	je     801107 <strtol+0x12>
+  801114:	40 80 fe 09          	cmp    $0x9,%sil
+  801118:	74 ed                	je     801107 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  80111a:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  80111d:	83 e0 fd             	and    $0xfffffffd,%eax
+  801120:	3c 01                	cmp    $0x1,%al
+  801122:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801126:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  80112c:	75 0f                	jne    80113d <strtol+0x48>
+  80112e:	80 3f 30             	cmpb   $0x30,(%rdi)
+  801131:	74 14                	je     801147 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  801133:	85 d2                	test   %edx,%edx
+  801135:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80113a:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  80113d:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  801142:	4c 63 ca             	movslq %edx,%r9
+  801145:	eb 36                	jmp    80117d <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801147:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  80114b:	74 0f                	je     80115c <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  80114d:	85 d2                	test   %edx,%edx
+  80114f:	75 ec                	jne    80113d <strtol+0x48>
+        s++;
+  801151:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  801155:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  80115a:	eb e1                	jmp    80113d <strtol+0x48>
+        s += 2;
+  80115c:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  801160:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  801165:	eb d6                	jmp    80113d <strtol+0x48>
+            dig -= '0';
+  801167:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  80116a:	44 0f b6 c1          	movzbl %cl,%r8d
+  80116e:	41 39 d0             	cmp    %edx,%r8d
+  801171:	7d 21                	jge    801194 <strtol+0x9f>
+        val = val * base + dig;
+  801173:	49 0f af c1          	imul   %r9,%rax
+  801177:	0f b6 c9             	movzbl %cl,%ecx
+  80117a:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  80117d:	48 83 c7 01          	add    $0x1,%rdi
+  801181:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  801185:	80 f9 39             	cmp    $0x39,%cl
+  801188:	76 dd                	jbe    801167 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  80118a:	80 f9 7b             	cmp    $0x7b,%cl
+  80118d:	77 05                	ja     801194 <strtol+0x9f>
+            dig -= 'a' - 10;
+  80118f:	83 e9 57             	sub    $0x57,%ecx
+  801192:	eb d6                	jmp    80116a <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  801194:	4d 85 d2             	test   %r10,%r10
+  801197:	74 03                	je     80119c <strtol+0xa7>
+  801199:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  80119c:	48 89 c2             	mov    %rax,%rdx
+  80119f:	48 f7 da             	neg    %rdx
+  8011a2:	40 80 fe 2d          	cmp    $0x2d,%sil
+  8011a6:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  8011aa:	c3                   	ret
+
+00000000008011ab <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  8011ab:	55                   	push   %rbp
+  8011ac:	48 89 e5             	mov    %rsp,%rbp
+  8011af:	53                   	push   %rbx
+  8011b0:	48 89 fa             	mov    %rdi,%rdx
+  8011b3:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8011b6:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8011bb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011c0:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8011c5:	be 00 00 00 00       	mov    $0x0,%esi
+  8011ca:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8011d0:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  8011d2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8011d6:	c9                   	leave
+  8011d7:	c3                   	ret
+
+00000000008011d8 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  8011d8:	55                   	push   %rbp
+  8011d9:	48 89 e5             	mov    %rsp,%rbp
+  8011dc:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8011dd:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8011e2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011e7:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8011ec:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011f1:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8011f6:	be 00 00 00 00       	mov    $0x0,%esi
+  8011fb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801201:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  801203:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801207:	c9                   	leave
+  801208:	c3                   	ret
+
+0000000000801209 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  801209:	55                   	push   %rbp
+  80120a:	48 89 e5             	mov    %rsp,%rbp
+  80120d:	53                   	push   %rbx
+  80120e:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  801212:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801215:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80121a:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80121f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801224:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801229:	be 00 00 00 00       	mov    $0x0,%esi
+  80122e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801234:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801236:	48 85 c0             	test   %rax,%rax
+  801239:	7f 06                	jg     801241 <sys_env_destroy+0x38>
+}
+  80123b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80123f:	c9                   	leave
+  801240:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801241:	49 89 c0             	mov    %rax,%r8
+  801244:	b9 03 00 00 00       	mov    $0x3,%ecx
+  801249:	48 ba f0 35 80 00 00 	movabs $0x8035f0,%rdx
+  801250:	00 00 00 
+  801253:	be 26 00 00 00       	mov    $0x26,%esi
+  801258:	48 bf 0f 36 80 00 00 	movabs $0x80360f,%rdi
+  80125f:	00 00 00 
+  801262:	b8 00 00 00 00       	mov    $0x0,%eax
+  801267:	49 b9 0f 03 80 00 00 	movabs $0x80030f,%r9
+  80126e:	00 00 00 
+  801271:	41 ff d1             	call   *%r9
+
+0000000000801274 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  801274:	55                   	push   %rbp
+  801275:	48 89 e5             	mov    %rsp,%rbp
+  801278:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801279:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80127e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801283:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801288:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80128d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801292:	be 00 00 00 00       	mov    $0x0,%esi
+  801297:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80129d:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  80129f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012a3:	c9                   	leave
+  8012a4:	c3                   	ret
+
+00000000008012a5 <sys_yield>:
+
+void
+sys_yield(void) {
+  8012a5:	55                   	push   %rbp
+  8012a6:	48 89 e5             	mov    %rsp,%rbp
+  8012a9:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8012aa:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8012af:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012b4:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8012b9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012be:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012c3:	be 00 00 00 00       	mov    $0x0,%esi
+  8012c8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8012ce:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  8012d0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012d4:	c9                   	leave
+  8012d5:	c3                   	ret
+
+00000000008012d6 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  8012d6:	55                   	push   %rbp
+  8012d7:	48 89 e5             	mov    %rsp,%rbp
+  8012da:	53                   	push   %rbx
+  8012db:	48 89 fa             	mov    %rdi,%rdx
+  8012de:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8012e1:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8012e6:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  8012ed:	00 00 00 
+  8012f0:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012f5:	be 00 00 00 00       	mov    $0x0,%esi
+  8012fa:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801300:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  801302:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801306:	c9                   	leave
+  801307:	c3                   	ret
+
+0000000000801308 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  801308:	55                   	push   %rbp
+  801309:	48 89 e5             	mov    %rsp,%rbp
+  80130c:	53                   	push   %rbx
+  80130d:	49 89 f8             	mov    %rdi,%r8
+  801310:	48 89 d3             	mov    %rdx,%rbx
+  801313:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801316:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80131b:	4c 89 c2             	mov    %r8,%rdx
+  80131e:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801321:	be 00 00 00 00       	mov    $0x0,%esi
+  801326:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80132c:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  80132e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801332:	c9                   	leave
+  801333:	c3                   	ret
+
+0000000000801334 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  801334:	55                   	push   %rbp
+  801335:	48 89 e5             	mov    %rsp,%rbp
+  801338:	53                   	push   %rbx
+  801339:	48 83 ec 08          	sub    $0x8,%rsp
+  80133d:	89 f8                	mov    %edi,%eax
+  80133f:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  801342:	48 63 f9             	movslq %ecx,%rdi
+  801345:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801348:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80134d:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801350:	be 00 00 00 00       	mov    $0x0,%esi
+  801355:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80135b:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80135d:	48 85 c0             	test   %rax,%rax
+  801360:	7f 06                	jg     801368 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  801362:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801366:	c9                   	leave
+  801367:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801368:	49 89 c0             	mov    %rax,%r8
+  80136b:	b9 04 00 00 00       	mov    $0x4,%ecx
+  801370:	48 ba f0 35 80 00 00 	movabs $0x8035f0,%rdx
+  801377:	00 00 00 
+  80137a:	be 26 00 00 00       	mov    $0x26,%esi
+  80137f:	48 bf 0f 36 80 00 00 	movabs $0x80360f,%rdi
+  801386:	00 00 00 
+  801389:	b8 00 00 00 00       	mov    $0x0,%eax
+  80138e:	49 b9 0f 03 80 00 00 	movabs $0x80030f,%r9
+  801395:	00 00 00 
+  801398:	41 ff d1             	call   *%r9
+
+000000000080139b <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  80139b:	55                   	push   %rbp
+  80139c:	48 89 e5             	mov    %rsp,%rbp
+  80139f:	53                   	push   %rbx
+  8013a0:	48 83 ec 08          	sub    $0x8,%rsp
+  8013a4:	89 f8                	mov    %edi,%eax
+  8013a6:	49 89 f2             	mov    %rsi,%r10
+  8013a9:	48 89 cf             	mov    %rcx,%rdi
+  8013ac:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  8013af:	48 63 da             	movslq %edx,%rbx
+  8013b2:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8013b5:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8013ba:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013bd:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  8013c0:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8013c2:	48 85 c0             	test   %rax,%rax
+  8013c5:	7f 06                	jg     8013cd <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8013c7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013cb:	c9                   	leave
+  8013cc:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8013cd:	49 89 c0             	mov    %rax,%r8
+  8013d0:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8013d5:	48 ba f0 35 80 00 00 	movabs $0x8035f0,%rdx
+  8013dc:	00 00 00 
+  8013df:	be 26 00 00 00       	mov    $0x26,%esi
+  8013e4:	48 bf 0f 36 80 00 00 	movabs $0x80360f,%rdi
+  8013eb:	00 00 00 
+  8013ee:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013f3:	49 b9 0f 03 80 00 00 	movabs $0x80030f,%r9
+  8013fa:	00 00 00 
+  8013fd:	41 ff d1             	call   *%r9
+
+0000000000801400 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  801400:	55                   	push   %rbp
+  801401:	48 89 e5             	mov    %rsp,%rbp
+  801404:	53                   	push   %rbx
+  801405:	48 83 ec 08          	sub    $0x8,%rsp
+  801409:	48 89 f1             	mov    %rsi,%rcx
+  80140c:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  80140f:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801412:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801417:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80141c:	be 00 00 00 00       	mov    $0x0,%esi
+  801421:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801427:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801429:	48 85 c0             	test   %rax,%rax
+  80142c:	7f 06                	jg     801434 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  80142e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801432:	c9                   	leave
+  801433:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801434:	49 89 c0             	mov    %rax,%r8
+  801437:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80143c:	48 ba f0 35 80 00 00 	movabs $0x8035f0,%rdx
+  801443:	00 00 00 
+  801446:	be 26 00 00 00       	mov    $0x26,%esi
+  80144b:	48 bf 0f 36 80 00 00 	movabs $0x80360f,%rdi
+  801452:	00 00 00 
+  801455:	b8 00 00 00 00       	mov    $0x0,%eax
+  80145a:	49 b9 0f 03 80 00 00 	movabs $0x80030f,%r9
+  801461:	00 00 00 
+  801464:	41 ff d1             	call   *%r9
+
+0000000000801467 <sys_region_batch>:
+
+int
+sys_region_batch(const struct RegionOp *ops, size_t count) {
+  801467:	55                   	push   %rbp
+  801468:	48 89 e5             	mov    %rsp,%rbp
+  80146b:	53                   	push   %rbx
+  80146c:	48 83 ec 08          	sub    $0x8,%rsp
+  801470:	48 89 fa             	mov    %rdi,%rdx
+  801473:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801476:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80147b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801480:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801485:	be 00 00 00 00       	mov    $0x0,%esi
+  80148a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801490:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801492:	48 85 c0             	test   %rax,%rax
+  801495:	7f 06                	jg     80149d <sys_region_batch+0x36>
+        else
+            platform_asan_unpoison(va, ops[i].size);
+    }
+#endif
+    return res;
+}
+  801497:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80149b:	c9                   	leave
+  80149c:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80149d:	49 89 c0             	mov    %rax,%r8
+  8014a0:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  8014a5:	48 ba f0 35 80 00 00 	movabs $0x8035f0,%rdx
+  8014ac:	00 00 00 
+  8014af:	be 26 00 00 00       	mov    $0x26,%esi
+  8014b4:	48 bf 0f 36 80 00 00 	movabs $0x80360f,%rdi
+  8014bb:	00 00 00 
+  8014be:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014c3:	49 b9 0f 03 80 00 00 	movabs $0x80030f,%r9
+  8014ca:	00 00 00 
+  8014cd:	41 ff d1             	call   *%r9
+
+00000000008014d0 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  8014d0:	55                   	push   %rbp
+  8014d1:	48 89 e5             	mov    %rsp,%rbp
+  8014d4:	53                   	push   %rbx
+  8014d5:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  8014d9:	48 63 ce             	movslq %esi,%rcx
+  8014dc:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8014df:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8014e4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014e9:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014ee:	be 00 00 00 00       	mov    $0x0,%esi
+  8014f3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014f9:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8014fb:	48 85 c0             	test   %rax,%rax
+  8014fe:	7f 06                	jg     801506 <sys_env_set_status+0x36>
+}
+  801500:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801504:	c9                   	leave
+  801505:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801506:	49 89 c0             	mov    %rax,%r8
+  801509:	b9 09 00 00 00       	mov    $0x9,%ecx
+  80150e:	48 ba f0 35 80 00 00 	movabs $0x8035f0,%rdx
+  801515:	00 00 00 
+  801518:	be 26 00 00 00       	mov    $0x26,%esi
+  80151d:	48 bf 0f 36 80 00 00 	movabs $0x80360f,%rdi
+  801524:	00 00 00 
+  801527:	b8 00 00 00 00       	mov    $0x0,%eax
+  80152c:	49 b9 0f 03 80 00 00 	movabs $0x80030f,%r9
+  801533:	00 00 00 
+  801536:	41 ff d1             	call   *%r9
+
+0000000000801539 <sys_env_set_weight>:
+
+int
+sys_env_set_weight(envid_t envid, uint32_t weight) {
+  801539:	55                   	push   %rbp
+  80153a:	48 89 e5             	mov    %rsp,%rbp
+  80153d:	53                   	push   %rbx
+  80153e:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_weight, 1, envid, weight, 0, 0, 0, 0);
+  801542:	89 f1                	mov    %esi,%ecx
+  801544:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801547:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80154c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801551:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801556:	be 00 00 00 00       	mov    $0x0,%esi
+  80155b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801561:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801563:	48 85 c0             	test   %rax,%rax
+  801566:	7f 06                	jg     80156e <sys_env_set_weight+0x35>
+}
+  801568:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80156c:	c9                   	leave
+  80156d:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80156e:	49 89 c0             	mov    %rax,%r8
+  801571:	b9 10 00 00 00       	mov    $0x10,%ecx
+  801576:	48 ba f0 35 80 00 00 	movabs $0x8035f0,%rdx
+  80157d:	00 00 00 
+  801580:	be 26 00 00 00       	mov    $0x26,%esi
+  801585:	48 bf 0f 36 80 00 00 	movabs $0x80360f,%rdi
+  80158c:	00 00 00 
+  80158f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801594:	49 b9 0f 03 80 00 00 	movabs $0x80030f,%r9
+  80159b:	00 00 00 
+  80159e:	41 ff d1             	call   *%r9
+
+00000000008015a1 <sys_env_set_rt>:
+
+int
+sys_env_set_rt(envid_t envid, uint64_t period, uint64_t budget, uint64_t deadline) {
+  8015a1:	55                   	push   %rbp
+  8015a2:	48 89 e5             	mov    %rsp,%rbp
+  8015a5:	53                   	push   %rbx
+  8015a6:	48 83 ec 08          	sub    $0x8,%rsp
+  8015aa:	89 f8                	mov    %edi,%eax
+  8015ac:	48 89 d3             	mov    %rdx,%rbx
+  8015af:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_env_set_rt, 1, envid, period, budget, deadline, 0, 0);
+  8015b2:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8015b5:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8015ba:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015bd:	be 00 00 00 00       	mov    $0x0,%esi
+  8015c2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015c8:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8015ca:	48 85 c0             	test   %rax,%rax
+  8015cd:	7f 06                	jg     8015d5 <sys_env_set_rt+0x34>
+}
+  8015cf:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015d3:	c9                   	leave
+  8015d4:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8015d5:	49 89 c0             	mov    %rax,%r8
+  8015d8:	b9 11 00 00 00       	mov    $0x11,%ecx
+  8015dd:	48 ba f0 35 80 00 00 	movabs $0x8035f0,%rdx
+  8015e4:	00 00 00 
+  8015e7:	be 26 00 00 00       	mov    $0x26,%esi
+  8015ec:	48 bf 0f 36 80 00 00 	movabs $0x80360f,%rdi
+  8015f3:	00 00 00 
+  8015f6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015fb:	49 b9 0f 03 80 00 00 	movabs $0x80030f,%r9
+  801602:	00 00 00 
+  801605:	41 ff d1             	call   *%r9
+
+0000000000801608 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  801608:	55                   	push   %rbp
+  801609:	48 89 e5             	mov    %rsp,%rbp
+  80160c:	53                   	push   %rbx
+  80160d:	48 83 ec 08          	sub    $0x8,%rsp
+  801611:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  801614:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801617:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80161c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801621:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801626:	be 00 00 00 00       	mov    $0x0,%esi
+  80162b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801631:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801633:	48 85 c0             	test   %rax,%rax
+  801636:	7f 06                	jg     80163e <sys_env_set_trapframe+0x36>
+}
+  801638:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80163c:	c9                   	leave
+  80163d:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80163e:	49 89 c0             	mov    %rax,%r8
+  801641:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  801646:	48 ba f0 35 80 00 00 	movabs $0x8035f0,%rdx
+  80164d:	00 00 00 
+  801650:	be 26 00 00 00       	mov    $0x26,%esi
+  801655:	48 bf 0f 36 80 00 00 	movabs $0x80360f,%rdi
+  80165c:	00 00 00 
+  80165f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801664:	49 b9 0f 03 80 00 00 	movabs $0x80030f,%r9
+  80166b:	00 00 00 
+  80166e:	41 ff d1             	call   *%r9
+
+0000000000801671 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  801671:	55                   	push   %rbp
+  801672:	48 89 e5             	mov    %rsp,%rbp
+  801675:	53                   	push   %rbx
+  801676:	48 83 ec 08          	sub    $0x8,%rsp
+  80167a:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  80167d:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801680:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801685:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80168a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80168f:	be 00 00 00 00       	mov    $0x0,%esi
+  801694:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80169a:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80169c:	48 85 c0             	test   %rax,%rax
+  80169f:	7f 06                	jg     8016a7 <sys_env_set_pgfault_upcall+0x36>
+}
+  8016a1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8016a5:	c9                   	leave
+  8016a6:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8016a7:	49 89 c0             	mov    %rax,%r8
+  8016aa:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  8016af:	48 ba f0 35 80 00 00 	movabs $0x8035f0,%rdx
+  8016b6:	00 00 00 
+  8016b9:	be 26 00 00 00       	mov    $0x26,%esi
+  8016be:	48 bf 0f 36 80 00 00 	movabs $0x80360f,%rdi
+  8016c5:	00 00 00 
+  8016c8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016cd:	49 b9 0f 03 80 00 00 	movabs $0x80030f,%r9
+  8016d4:	00 00 00 
+  8016d7:	41 ff d1             	call   *%r9
+
+00000000008016da <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  8016da:	55                   	push   %rbp
+  8016db:	48 89 e5             	mov    %rsp,%rbp
+  8016de:	53                   	push   %rbx
+  8016df:	89 f8                	mov    %edi,%eax
+  8016e1:	49 89 f1             	mov    %rsi,%r9
+  8016e4:	48 89 d3             	mov    %rdx,%rbx
+  8016e7:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  8016ea:	49 63 f0             	movslq %r8d,%rsi
+  8016ed:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8016f0:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8016f5:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8016f8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8016fe:	cd 30                	int    $0x30
+}
+  801700:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801704:	c9                   	leave
+  801705:	c3                   	ret
+
+0000000000801706 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  801706:	55                   	push   %rbp
+  801707:	48 89 e5             	mov    %rsp,%rbp
+  80170a:	53                   	push   %rbx
+  80170b:	48 83 ec 08          	sub    $0x8,%rsp
+  80170f:	48 89 fa             	mov    %rdi,%rdx
+  801712:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801715:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80171a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80171f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801724:	be 00 00 00 00       	mov    $0x0,%esi
+  801729:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80172f:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801731:	48 85 c0             	test   %rax,%rax
+  801734:	7f 06                	jg     80173c <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801736:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80173a:	c9                   	leave
+  80173b:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80173c:	49 89 c0             	mov    %rax,%r8
+  80173f:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  801744:	48 ba f0 35 80 00 00 	movabs $0x8035f0,%rdx
+  80174b:	00 00 00 
+  80174e:	be 26 00 00 00       	mov    $0x26,%esi
+  801753:	48 bf 0f 36 80 00 00 	movabs $0x80360f,%rdi
+  80175a:	00 00 00 
+  80175d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801762:	49 b9 0f 03 80 00 00 	movabs $0x80030f,%r9
+  801769:	00 00 00 
+  80176c:	41 ff d1             	call   *%r9
+
+000000000080176f <fork>:
+ * Hint:
+ *   Use sys_map_region, it can perform address space copying in one call
+ *   Remember to fix "thisenv" in the child process.
+ */
+envid_t
+fork(void) {
+  80176f:	55                   	push   %rbp
+  801770:	48 89 e5             	mov    %rsp,%rbp
+  801773:	41 55                	push   %r13
+  801775:	41 54                	push   %r12
+  801777:	53                   	push   %rbx
+  801778:	48 83 ec 08          	sub    $0x8,%rsp
+  80177c:	b8 08 00 00 00       	mov    $0x8,%eax
+  801781:	cd 30                	int    $0x30
+  801783:	41 89 c5             	mov    %eax,%r13d
+    // LAB 9: Your code here
+
+    envid_t child_id = sys_exofork();
+    if (child_id < 0) {
+  801786:	85 c0                	test   %eax,%eax
+  801788:	0f 88 ae 00 00 00    	js     80183c <fork+0xcd>
+  80178e:	89 c3                	mov    %eax,%ebx
+        return child_id;
+    }
+    if (child_id == 0) {
+  801790:	0f 84 b4 00 00 00    	je     80184a <fork+0xdb>
+        thisenv = &envs[ENVX(sys_getenvid())];
+        return 0;
+    }
+    int res = sys_map_region(0, NULL, child_id, NULL, MAX_USER_ADDRESS, PROT_ALL | PROT_LAZY | PROT_COMBINE);
+  801796:	41 b9 df 01 00 00    	mov    $0x1df,%r9d
+  80179c:	49 b8 00 00 00 00 80 	movabs $0x8000000000,%r8
+  8017a3:	00 00 00 
+  8017a6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8017ab:	89 c2                	mov    %eax,%edx
+  8017ad:	be 00 00 00 00       	mov    $0x0,%esi
+  8017b2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8017b7:	48 b8 9b 13 80 00 00 	movabs $0x80139b,%rax
+  8017be:	00 00 00 
+  8017c1:	ff d0                	call   *%rax
+  8017c3:	41 89 c4             	mov    %eax,%r12d
+    if (res < 0) {
+  8017c6:	85 c0                	test   %eax,%eax
+  8017c8:	78 5d                	js     801827 <fork+0xb8>
+        goto error;
+    }
+    res = sys_env_set_pgfault_upcall(child_id, envs[ENVX(sys_getenvid())].env_pgfault_upcall);
+  8017ca:	48 b8 74 12 80 00 00 	movabs $0x801274,%rax
+  8017d1:	00 00 00 
+  8017d4:	ff d0                	call   *%rax
+  8017d6:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8017db:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+  8017e2:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8017e9:	00 00 00 
+  8017ec:	48 01 d0             	add    %rdx,%rax
+  8017ef:	48 8b b0 88 01 00 00 	mov    0x188(%rax),%rsi
+  8017f6:	44 89 ef             	mov    %r13d,%edi
+  8017f9:	48 b8 71 16 80 00 00 	movabs $0x801671,%rax
+  801800:	00 00 00 
+  801803:	ff d0                	call   *%rax
+  801805:	41 89 c4             	mov    %eax,%r12d
+    if (res < 0) {
+  801808:	85 c0                	test   %eax,%eax
+  80180a:	78 1b                	js     801827 <fork+0xb8>
+        goto error;
+    }
+    res = sys_env_set_status(child_id, ENV_RUNNABLE);
+  80180c:	be 02 00 00 00       	mov    $0x2,%esi
+  801811:	44 89 ef             	mov    %r13d,%edi
+  801814:	48 b8 d0 14 80 00 00 	movabs $0x8014d0,%rax
+  80181b:	00 00 00 
+  80181e:	ff d0                	call   *%rax
+  801820:	41 89 c4             	mov    %eax,%r12d
+    if (res < 0) {
+  801823:	85 c0                	test   %eax,%eax
+  801825:	79 15                	jns    80183c <fork+0xcd>
+        goto error;
+    }
+    return child_id;
+error:
+    ;
+    int res2 = sys_env_destroy(child_id);
+  801827:	89 df                	mov    %ebx,%edi
+  801829:	48 b8 09 12 80 00 00 	movabs $0x801209,%rax
+  801830:	00 00 00 
+  801833:	ff d0                	call   *%rax
+    if (res2 < 0) {
+  801835:	85 c0                	test   %eax,%eax
+  801837:	78 42                	js     80187b <fork+0x10c>
+        panic("Fork double fault");
+    }
+    return res;
+  801839:	45 89 e5             	mov    %r12d,%r13d
+}
+  80183c:	44 89 e8             	mov    %r13d,%eax
+  80183f:	48 83 c4 08          	add    $0x8,%rsp
+  801843:	5b                   	pop    %rbx
+  801844:	41 5c                	pop    %r12
+  801846:	41 5d                	pop    %r13
+  801848:	5d                   	pop    %rbp
+  801849:	c3                   	ret
+        thisenv = &envs[ENVX(sys_getenvid())];
+  80184a:	48 b8 74 12 80 00 00 	movabs $0x801274,%rax
+  801851:	00 00 00 
+  801854:	ff d0                	call   *%rax
+  801856:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80185b:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+  801862:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  801869:	00 00 00 
+  80186c:	48 01 d0             	add    %rdx,%rax
+  80186f:	48 a3 00 60 80 00 00 	movabs %rax,0x806000
+  801876:	00 00 00 
+        return 0;
+  801879:	eb c1                	jmp    80183c <fork+0xcd>
+        panic("Fork double fault");
+  80187b:	48 ba 1d 36 80 00 00 	movabs $0x80361d,%rdx
+  801882:	00 00 00 
+  801885:	be 2f 00 00 00       	mov    $0x2f,%esi
+  80188a:	48 bf 2f 36 80 00 00 	movabs $0x80362f,%rdi
+  801891:	00 00 00 
+  801894:	b8 00 00 00 00       	mov    $0x0,%eax
+  801899:	48 b9 0f 03 80 00 00 	movabs $0x80030f,%rcx
+  8018a0:	00 00 00 
+  8018a3:	ff d1                	call   *%rcx
+
+00000000008018a5 <sfork>:
+
+envid_t
+sfork() {
+  8018a5:	55                   	push   %rbp
+  8018a6:	48 89 e5             	mov    %rsp,%rbp
+    panic("sfork() is not implemented");
+  8018a9:	48 ba 3a 36 80 00 00 	movabs $0x80363a,%rdx
+  8018b0:	00 00 00 
+  8018b3:	be 36 00 00 00       	mov    $0x36,%esi
+  8018b8:	48 bf 2f 36 80 00 00 	movabs $0x80362f,%rdi
+  8018bf:	00 00 00 
+  8018c2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018c7:	48 b9 0f 03 80 00 00 	movabs $0x80030f,%rcx
+  8018ce:	00 00 00 
+  8018d1:	ff d1                	call   *%rcx
+
+00000000008018d3 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8018d3:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8018da:	ff ff ff 
+  8018dd:	48 01 f8             	add    %rdi,%rax
+  8018e0:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  8018e4:	c3                   	ret
+
+00000000008018e5 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8018e5:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8018ec:	ff ff ff 
+  8018ef:	48 01 f8             	add    %rdi,%rax
+  8018f2:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  8018f6:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  8018fc:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  801900:	c3                   	ret
+
+0000000000801901 <fd_alloc_from>:
+}
+
+/* Like fd_alloc(), but only considers fds starting from fdnum,
+ * so that several fds can be found before their pages are allocated */
+int
+fd_alloc_from(int fdnum, struct Fd **fd_store) {
+  801901:	55                   	push   %rbp
+  801902:	48 89 e5             	mov    %rsp,%rbp
+  801905:	41 57                	push   %r15
+  801907:	41 56                	push   %r14
+  801909:	41 55                	push   %r13
+  80190b:	41 54                	push   %r12
+  80190d:	53                   	push   %rbx
+  80190e:	48 83 ec 08          	sub    $0x8,%rsp
+  801912:	49 89 f7             	mov    %rsi,%r15
+    for (int i = MAX(fdnum, 0); i < MAXFD; i++) {
+  801915:	85 ff                	test   %edi,%edi
+  801917:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80191d:	44 0f 49 e7          	cmovns %edi,%r12d
+  801921:	83 ff 1f             	cmp    $0x1f,%edi
+  801924:	7f 37                	jg     80195d <fd_alloc_from+0x5c>
+  801926:	49 63 dc             	movslq %r12d,%rbx
+  801929:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  801930:	48 c1 e3 0c          	shl    $0xc,%rbx
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  801934:	49 be 0a 2a 80 00 00 	movabs $0x802a0a,%r14
+  80193b:	00 00 00 
+        struct Fd *fd = INDEX2FD(i);
+  80193e:	49 89 dd             	mov    %rbx,%r13
+        if (!(get_prot(fd) & PROT_R)) {
+  801941:	48 89 df             	mov    %rbx,%rdi
+  801944:	41 ff d6             	call   *%r14
+  801947:	83 e0 04             	and    $0x4,%eax
+  80194a:	74 1c                	je     801968 <fd_alloc_from+0x67>
+    for (int i = MAX(fdnum, 0); i < MAXFD; i++) {
+  80194c:	41 83 c4 01          	add    $0x1,%r12d
+  801950:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801957:	41 83 fc 1f          	cmp    $0x1f,%r12d
+  80195b:	7e e1                	jle    80193e <fd_alloc_from+0x3d>
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  80195d:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801963:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  801968:	4d 89 2f             	mov    %r13,(%r15)
+}
+  80196b:	48 83 c4 08          	add    $0x8,%rsp
+  80196f:	5b                   	pop    %rbx
+  801970:	41 5c                	pop    %r12
+  801972:	41 5d                	pop    %r13
+  801974:	41 5e                	pop    %r14
+  801976:	41 5f                	pop    %r15
+  801978:	5d                   	pop    %rbp
+  801979:	c3                   	ret
+
+000000000080197a <fd_alloc>:
+fd_alloc(struct Fd **fd_store) {
+  80197a:	55                   	push   %rbp
+  80197b:	48 89 e5             	mov    %rsp,%rbp
+  80197e:	48 89 fe             	mov    %rdi,%rsi
+    return fd_alloc_from(0, fd_store);
+  801981:	bf 00 00 00 00       	mov    $0x0,%edi
+  801986:	48 b8 01 19 80 00 00 	movabs $0x801901,%rax
+  80198d:	00 00 00 
+  801990:	ff d0                	call   *%rax
+}
+  801992:	5d                   	pop    %rbp
+  801993:	c3                   	ret
+
+0000000000801994 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  801994:	83 ff 1f             	cmp    $0x1f,%edi
+  801997:	77 39                	ja     8019d2 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  801999:	55                   	push   %rbp
+  80199a:	48 89 e5             	mov    %rsp,%rbp
+  80199d:	41 54                	push   %r12
+  80199f:	53                   	push   %rbx
+  8019a0:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  8019a3:	48 63 df             	movslq %edi,%rbx
+  8019a6:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  8019ad:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  8019b1:	48 89 df             	mov    %rbx,%rdi
+  8019b4:	48 b8 0a 2a 80 00 00 	movabs $0x802a0a,%rax
+  8019bb:	00 00 00 
+  8019be:	ff d0                	call   *%rax
+  8019c0:	a8 04                	test   $0x4,%al
+  8019c2:	74 14                	je     8019d8 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  8019c4:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  8019c8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8019cd:	5b                   	pop    %rbx
+  8019ce:	41 5c                	pop    %r12
+  8019d0:	5d                   	pop    %rbp
+  8019d1:	c3                   	ret
+        return -E_INVAL;
+  8019d2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8019d7:	c3                   	ret
+        return -E_INVAL;
+  8019d8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8019dd:	eb ee                	jmp    8019cd <fd_lookup+0x39>
+
+00000000008019df <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  8019df:	55                   	push   %rbp
+  8019e0:	48 89 e5             	mov    %rsp,%rbp
+  8019e3:	41 54                	push   %r12
+  8019e5:	53                   	push   %rbx
+  8019e6:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  8019e9:	48 b8 e0 36 80 00 00 	movabs $0x8036e0,%rax
+  8019f0:	00 00 00 
+  8019f3:	48 bb 20 40 80 00 00 	movabs $0x804020,%rbx
+  8019fa:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  8019fd:	39 3b                	cmp    %edi,(%rbx)
+  8019ff:	74 47                	je     801a48 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  801a01:	48 83 c0 08          	add    $0x8,%rax
+  801a05:	48 8b 18             	mov    (%rax),%rbx
+  801a08:	48 85 db             	test   %rbx,%rbx
+  801a0b:	75 f0                	jne    8019fd <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801a0d:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  801a14:	00 00 00 
+  801a17:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+  801a1d:	89 fa                	mov    %edi,%edx
+  801a1f:	48 bf 58 36 80 00 00 	movabs $0x803658,%rdi
+  801a26:	00 00 00 
+  801a29:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a2e:	48 b9 5f 04 80 00 00 	movabs $0x80045f,%rcx
+  801a35:	00 00 00 
+  801a38:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  801a3a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  801a3f:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  801a43:	5b                   	pop    %rbx
+  801a44:	41 5c                	pop    %r12
+  801a46:	5d                   	pop    %rbp
+  801a47:	c3                   	ret
+            return 0;
+  801a48:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a4d:	eb f0                	jmp    801a3f <dev_lookup+0x60>
+
+0000000000801a4f <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  801a4f:	55                   	push   %rbp
+  801a50:	48 89 e5             	mov    %rsp,%rbp
+  801a53:	41 55                	push   %r13
+  801a55:	41 54                	push   %r12
+  801a57:	53                   	push   %rbx
+  801a58:	48 83 ec 18          	sub    $0x18,%rsp
+  801a5c:	48 89 fb             	mov    %rdi,%rbx
+  801a5f:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801a62:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  801a69:	ff ff ff 
+  801a6c:	48 01 df             	add    %rbx,%rdi
+  801a6f:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  801a73:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801a77:	48 b8 94 19 80 00 00 	movabs $0x801994,%rax
+  801a7e:	00 00 00 
+  801a81:	ff d0                	call   *%rax
+  801a83:	41 89 c5             	mov    %eax,%r13d
+  801a86:	85 c0                	test   %eax,%eax
+  801a88:	78 06                	js     801a90 <fd_close+0x41>
+  801a8a:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  801a8e:	74 1a                	je     801aaa <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  801a90:	45 84 e4             	test   %r12b,%r12b
+  801a93:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a98:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  801a9c:	44 89 e8             	mov    %r13d,%eax
+  801a9f:	48 83 c4 18          	add    $0x18,%rsp
+  801aa3:	5b                   	pop    %rbx
+  801aa4:	41 5c                	pop    %r12
+  801aa6:	41 5d                	pop    %r13
+  801aa8:	5d                   	pop    %rbp
+  801aa9:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801aaa:	8b 3b                	mov    (%rbx),%edi
+  801aac:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801ab0:	48 b8 df 19 80 00 00 	movabs $0x8019df,%rax
+  801ab7:	00 00 00 
+  801aba:	ff d0                	call   *%rax
+  801abc:	41 89 c5             	mov    %eax,%r13d
+  801abf:	85 c0                	test   %eax,%eax
+  801ac1:	78 1b                	js     801ade <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  801ac3:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801ac7:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801acb:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801ad1:	48 85 c0             	test   %rax,%rax
+  801ad4:	74 08                	je     801ade <fd_close+0x8f>
+  801ad6:	48 89 df             	mov    %rbx,%rdi
+  801ad9:	ff d0                	call   *%rax
+  801adb:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801ade:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801ae3:	48 89 de             	mov    %rbx,%rsi
+  801ae6:	bf 00 00 00 00       	mov    $0x0,%edi
+  801aeb:	48 b8 00 14 80 00 00 	movabs $0x801400,%rax
+  801af2:	00 00 00 
+  801af5:	ff d0                	call   *%rax
+    return res;
+  801af7:	eb a3                	jmp    801a9c <fd_close+0x4d>
+
+0000000000801af9 <close>:
+
+int
+close(int fdnum) {
+  801af9:	55                   	push   %rbp
+  801afa:	48 89 e5             	mov    %rsp,%rbp
+  801afd:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  801b01:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801b05:	48 b8 94 19 80 00 00 	movabs $0x801994,%rax
+  801b0c:	00 00 00 
+  801b0f:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801b11:	85 c0                	test   %eax,%eax
+  801b13:	78 15                	js     801b2a <close+0x31>
+
+    return fd_close(fd, 1);
+  801b15:	be 01 00 00 00       	mov    $0x1,%esi
+  801b1a:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801b1e:	48 b8 4f 1a 80 00 00 	movabs $0x801a4f,%rax
+  801b25:	00 00 00 
+  801b28:	ff d0                	call   *%rax
+}
+  801b2a:	c9                   	leave
+  801b2b:	c3                   	ret
+
+0000000000801b2c <close_all>:
+
+void
+close_all(void) {
+  801b2c:	55                   	push   %rbp
+  801b2d:	48 89 e5             	mov    %rsp,%rbp
+  801b30:	41 54                	push   %r12
+  801b32:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  801b33:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b38:	49 bc f9 1a 80 00 00 	movabs $0x801af9,%r12
+  801b3f:	00 00 00 
+  801b42:	89 df                	mov    %ebx,%edi
+  801b44:	41 ff d4             	call   *%r12
+  801b47:	83 c3 01             	add    $0x1,%ebx
+  801b4a:	83 fb 20             	cmp    $0x20,%ebx
+  801b4d:	75 f3                	jne    801b42 <close_all+0x16>
+}
+  801b4f:	5b                   	pop    %rbx
+  801b50:	41 5c                	pop    %r12
+  801b52:	5d                   	pop    %rbp
+  801b53:	c3                   	ret
+
+0000000000801b54 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  801b54:	55                   	push   %rbp
+  801b55:	48 89 e5             	mov    %rsp,%rbp
+  801b58:	41 57                	push   %r15
+  801b5a:	41 56                	push   %r14
+  801b5c:	41 55                	push   %r13
+  801b5e:	41 54                	push   %r12
+  801b60:	53                   	push   %rbx
+  801b61:	48 83 ec 18          	sub    $0x18,%rsp
+  801b65:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  801b68:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801b6c:	48 b8 94 19 80 00 00 	movabs $0x801994,%rax
+  801b73:	00 00 00 
+  801b76:	ff d0                	call   *%rax
+  801b78:	89 c3                	mov    %eax,%ebx
+  801b7a:	85 c0                	test   %eax,%eax
+  801b7c:	0f 88 b8 00 00 00    	js     801c3a <dup+0xe6>
+    close(newfdnum);
+  801b82:	44 89 e7             	mov    %r12d,%edi
+  801b85:	48 b8 f9 1a 80 00 00 	movabs $0x801af9,%rax
+  801b8c:	00 00 00 
+  801b8f:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  801b91:	4d 63 ec             	movslq %r12d,%r13
+  801b94:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  801b9b:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  801b9f:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  801ba3:	4c 89 ff             	mov    %r15,%rdi
+  801ba6:	49 be e5 18 80 00 00 	movabs $0x8018e5,%r14
+  801bad:	00 00 00 
+  801bb0:	41 ff d6             	call   *%r14
+  801bb3:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  801bb6:	4c 89 ef             	mov    %r13,%rdi
+  801bb9:	41 ff d6             	call   *%r14
+  801bbc:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  801bbf:	48 89 df             	mov    %rbx,%rdi
+  801bc2:	48 b8 0a 2a 80 00 00 	movabs $0x802a0a,%rax
+  801bc9:	00 00 00 
+  801bcc:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  801bce:	a8 04                	test   $0x4,%al
+  801bd0:	74 2b                	je     801bfd <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  801bd2:	41 89 c1             	mov    %eax,%r9d
+  801bd5:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801bdb:	4c 89 f1             	mov    %r14,%rcx
+  801bde:	ba 00 00 00 00       	mov    $0x0,%edx
+  801be3:	48 89 de             	mov    %rbx,%rsi
+  801be6:	bf 00 00 00 00       	mov    $0x0,%edi
+  801beb:	48 b8 9b 13 80 00 00 	movabs $0x80139b,%rax
+  801bf2:	00 00 00 
+  801bf5:	ff d0                	call   *%rax
+  801bf7:	89 c3                	mov    %eax,%ebx
+  801bf9:	85 c0                	test   %eax,%eax
+  801bfb:	78 4e                	js     801c4b <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  801bfd:	4c 89 ff             	mov    %r15,%rdi
+  801c00:	48 b8 0a 2a 80 00 00 	movabs $0x802a0a,%rax
+  801c07:	00 00 00 
+  801c0a:	ff d0                	call   *%rax
+  801c0c:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801c0f:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801c15:	4c 89 e9             	mov    %r13,%rcx
+  801c18:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c1d:	4c 89 fe             	mov    %r15,%rsi
+  801c20:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c25:	48 b8 9b 13 80 00 00 	movabs $0x80139b,%rax
+  801c2c:	00 00 00 
+  801c2f:	ff d0                	call   *%rax
+  801c31:	89 c3                	mov    %eax,%ebx
+  801c33:	85 c0                	test   %eax,%eax
+  801c35:	78 14                	js     801c4b <dup+0xf7>
+
+    return newfdnum;
+  801c37:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  801c3a:	89 d8                	mov    %ebx,%eax
+  801c3c:	48 83 c4 18          	add    $0x18,%rsp
+  801c40:	5b                   	pop    %rbx
+  801c41:	41 5c                	pop    %r12
+  801c43:	41 5d                	pop    %r13
+  801c45:	41 5e                	pop    %r14
+  801c47:	41 5f                	pop    %r15
+  801c49:	5d                   	pop    %rbp
+  801c4a:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  801c4b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801c50:	4c 89 ee             	mov    %r13,%rsi
+  801c53:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c58:	49 bc 00 14 80 00 00 	movabs $0x801400,%r12
+  801c5f:	00 00 00 
+  801c62:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  801c65:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801c6a:	4c 89 f6             	mov    %r14,%rsi
+  801c6d:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c72:	41 ff d4             	call   *%r12
+    return res;
+  801c75:	eb c3                	jmp    801c3a <dup+0xe6>
+
+0000000000801c77 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  801c77:	55                   	push   %rbp
+  801c78:	48 89 e5             	mov    %rsp,%rbp
+  801c7b:	41 56                	push   %r14
+  801c7d:	41 55                	push   %r13
+  801c7f:	41 54                	push   %r12
+  801c81:	53                   	push   %rbx
+  801c82:	48 83 ec 10          	sub    $0x10,%rsp
+  801c86:	89 fb                	mov    %edi,%ebx
+  801c88:	49 89 f4             	mov    %rsi,%r12
+  801c8b:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801c8e:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801c92:	48 b8 94 19 80 00 00 	movabs $0x801994,%rax
+  801c99:	00 00 00 
+  801c9c:	ff d0                	call   *%rax
+  801c9e:	85 c0                	test   %eax,%eax
+  801ca0:	78 4c                	js     801cee <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801ca2:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801ca6:	41 8b 3e             	mov    (%r14),%edi
+  801ca9:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801cad:	48 b8 df 19 80 00 00 	movabs $0x8019df,%rax
+  801cb4:	00 00 00 
+  801cb7:	ff d0                	call   *%rax
+  801cb9:	85 c0                	test   %eax,%eax
+  801cbb:	78 35                	js     801cf2 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801cbd:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801cc1:	83 e0 03             	and    $0x3,%eax
+  801cc4:	83 f8 01             	cmp    $0x1,%eax
+  801cc7:	74 2d                	je     801cf6 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801cc9:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801ccd:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801cd1:	48 85 c0             	test   %rax,%rax
+  801cd4:	74 56                	je     801d2c <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  801cd6:	4c 89 ea             	mov    %r13,%rdx
+  801cd9:	4c 89 e6             	mov    %r12,%rsi
+  801cdc:	4c 89 f7             	mov    %r14,%rdi
+  801cdf:	ff d0                	call   *%rax
+}
+  801ce1:	48 83 c4 10          	add    $0x10,%rsp
+  801ce5:	5b                   	pop    %rbx
+  801ce6:	41 5c                	pop    %r12
+  801ce8:	41 5d                	pop    %r13
+  801cea:	41 5e                	pop    %r14
+  801cec:	5d                   	pop    %rbp
+  801ced:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801cee:	48 98                	cltq
+  801cf0:	eb ef                	jmp    801ce1 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801cf2:	48 98                	cltq
+  801cf4:	eb eb                	jmp    801ce1 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801cf6:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  801cfd:	00 00 00 
+  801d00:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+  801d06:	89 da                	mov    %ebx,%edx
+  801d08:	48 bf 99 36 80 00 00 	movabs $0x803699,%rdi
+  801d0f:	00 00 00 
+  801d12:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d17:	48 b9 5f 04 80 00 00 	movabs $0x80045f,%rcx
+  801d1e:	00 00 00 
+  801d21:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801d23:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801d2a:	eb b5                	jmp    801ce1 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801d2c:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801d33:	eb ac                	jmp    801ce1 <read+0x6a>
+
+0000000000801d35 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801d35:	55                   	push   %rbp
+  801d36:	48 89 e5             	mov    %rsp,%rbp
+  801d39:	41 57                	push   %r15
+  801d3b:	41 56                	push   %r14
+  801d3d:	41 55                	push   %r13
+  801d3f:	41 54                	push   %r12
+  801d41:	53                   	push   %rbx
+  801d42:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  801d46:	48 85 d2             	test   %rdx,%rdx
+  801d49:	74 54                	je     801d9f <readn+0x6a>
+  801d4b:	41 89 fd             	mov    %edi,%r13d
+  801d4e:	49 89 f6             	mov    %rsi,%r14
+  801d51:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  801d54:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  801d59:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  801d5e:	49 bf 77 1c 80 00 00 	movabs $0x801c77,%r15
+  801d65:	00 00 00 
+  801d68:	4c 89 e2             	mov    %r12,%rdx
+  801d6b:	48 29 f2             	sub    %rsi,%rdx
+  801d6e:	4c 01 f6             	add    %r14,%rsi
+  801d71:	44 89 ef             	mov    %r13d,%edi
+  801d74:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  801d77:	85 c0                	test   %eax,%eax
+  801d79:	78 20                	js     801d9b <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  801d7b:	01 c3                	add    %eax,%ebx
+  801d7d:	85 c0                	test   %eax,%eax
+  801d7f:	74 08                	je     801d89 <readn+0x54>
+  801d81:	48 63 f3             	movslq %ebx,%rsi
+  801d84:	4c 39 e6             	cmp    %r12,%rsi
+  801d87:	72 df                	jb     801d68 <readn+0x33>
+    }
+    return res;
+  801d89:	48 63 c3             	movslq %ebx,%rax
+}
+  801d8c:	48 83 c4 08          	add    $0x8,%rsp
+  801d90:	5b                   	pop    %rbx
+  801d91:	41 5c                	pop    %r12
+  801d93:	41 5d                	pop    %r13
+  801d95:	41 5e                	pop    %r14
+  801d97:	41 5f                	pop    %r15
+  801d99:	5d                   	pop    %rbp
+  801d9a:	c3                   	ret
+        if (inc < 0) return inc;
+  801d9b:	48 98                	cltq
+  801d9d:	eb ed                	jmp    801d8c <readn+0x57>
+    int inc = 1, res = 0;
+  801d9f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801da4:	eb e3                	jmp    801d89 <readn+0x54>
+
+0000000000801da6 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  801da6:	55                   	push   %rbp
+  801da7:	48 89 e5             	mov    %rsp,%rbp
+  801daa:	41 56                	push   %r14
+  801dac:	41 55                	push   %r13
+  801dae:	41 54                	push   %r12
+  801db0:	53                   	push   %rbx
+  801db1:	48 83 ec 10          	sub    $0x10,%rsp
+  801db5:	89 fb                	mov    %edi,%ebx
+  801db7:	49 89 f4             	mov    %rsi,%r12
+  801dba:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801dbd:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801dc1:	48 b8 94 19 80 00 00 	movabs $0x801994,%rax
+  801dc8:	00 00 00 
+  801dcb:	ff d0                	call   *%rax
+  801dcd:	85 c0                	test   %eax,%eax
+  801dcf:	78 47                	js     801e18 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801dd1:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801dd5:	41 8b 3e             	mov    (%r14),%edi
+  801dd8:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801ddc:	48 b8 df 19 80 00 00 	movabs $0x8019df,%rax
+  801de3:	00 00 00 
+  801de6:	ff d0                	call   *%rax
+  801de8:	85 c0                	test   %eax,%eax
+  801dea:	78 30                	js     801e1c <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801dec:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  801df1:	74 2d                	je     801e20 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801df3:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801df7:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801dfb:	48 85 c0             	test   %rax,%rax
+  801dfe:	74 56                	je     801e56 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  801e00:	4c 89 ea             	mov    %r13,%rdx
+  801e03:	4c 89 e6             	mov    %r12,%rsi
+  801e06:	4c 89 f7             	mov    %r14,%rdi
+  801e09:	ff d0                	call   *%rax
+}
+  801e0b:	48 83 c4 10          	add    $0x10,%rsp
+  801e0f:	5b                   	pop    %rbx
+  801e10:	41 5c                	pop    %r12
+  801e12:	41 5d                	pop    %r13
+  801e14:	41 5e                	pop    %r14
+  801e16:	5d                   	pop    %rbp
+  801e17:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801e18:	48 98                	cltq
+  801e1a:	eb ef                	jmp    801e0b <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801e1c:	48 98                	cltq
+  801e1e:	eb eb                	jmp    801e0b <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801e20:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  801e27:	00 00 00 
+  801e2a:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+  801e30:	89 da                	mov    %ebx,%edx
+  801e32:	48 bf b5 36 80 00 00 	movabs $0x8036b5,%rdi
+  801e39:	00 00 00 
+  801e3c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e41:	48 b9 5f 04 80 00 00 	movabs $0x80045f,%rcx
+  801e48:	00 00 00 
+  801e4b:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801e4d:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801e54:	eb b5                	jmp    801e0b <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801e56:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801e5d:	eb ac                	jmp    801e0b <write+0x65>
+
+0000000000801e5f <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  801e5f:	55                   	push   %rbp
+  801e60:	48 89 e5             	mov    %rsp,%rbp
+  801e63:	53                   	push   %rbx
+  801e64:	48 83 ec 18          	sub    $0x18,%rsp
+  801e68:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801e6a:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801e6e:	48 b8 94 19 80 00 00 	movabs $0x801994,%rax
+  801e75:	00 00 00 
+  801e78:	ff d0                	call   *%rax
+  801e7a:	85 c0                	test   %eax,%eax
+  801e7c:	78 0c                	js     801e8a <seek+0x2b>
+
+    fd->fd_offset = offset;
+  801e7e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801e82:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  801e85:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801e8a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801e8e:	c9                   	leave
+  801e8f:	c3                   	ret
+
+0000000000801e90 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  801e90:	55                   	push   %rbp
+  801e91:	48 89 e5             	mov    %rsp,%rbp
+  801e94:	41 55                	push   %r13
+  801e96:	41 54                	push   %r12
+  801e98:	53                   	push   %rbx
+  801e99:	48 83 ec 18          	sub    $0x18,%rsp
+  801e9d:	89 fb                	mov    %edi,%ebx
+  801e9f:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801ea2:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801ea6:	48 b8 94 19 80 00 00 	movabs $0x801994,%rax
+  801ead:	00 00 00 
+  801eb0:	ff d0                	call   *%rax
+  801eb2:	85 c0                	test   %eax,%eax
+  801eb4:	78 38                	js     801eee <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801eb6:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  801eba:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  801ebe:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801ec2:	48 b8 df 19 80 00 00 	movabs $0x8019df,%rax
+  801ec9:	00 00 00 
+  801ecc:	ff d0                	call   *%rax
+  801ece:	85 c0                	test   %eax,%eax
+  801ed0:	78 1c                	js     801eee <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801ed2:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  801ed7:	74 20                	je     801ef9 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801ed9:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801edd:	48 8b 40 30          	mov    0x30(%rax),%rax
+  801ee1:	48 85 c0             	test   %rax,%rax
+  801ee4:	74 47                	je     801f2d <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  801ee6:	44 89 e6             	mov    %r12d,%esi
+  801ee9:	4c 89 ef             	mov    %r13,%rdi
+  801eec:	ff d0                	call   *%rax
+}
+  801eee:	48 83 c4 18          	add    $0x18,%rsp
+  801ef2:	5b                   	pop    %rbx
+  801ef3:	41 5c                	pop    %r12
+  801ef5:	41 5d                	pop    %r13
+  801ef7:	5d                   	pop    %rbp
+  801ef8:	c3                   	ret
+                thisenv->env_id, fdnum);
+  801ef9:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  801f00:	00 00 00 
+  801f03:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801f09:	89 da                	mov    %ebx,%edx
+  801f0b:	48 bf 78 36 80 00 00 	movabs $0x803678,%rdi
+  801f12:	00 00 00 
+  801f15:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f1a:	48 b9 5f 04 80 00 00 	movabs $0x80045f,%rcx
+  801f21:	00 00 00 
+  801f24:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801f26:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801f2b:	eb c1                	jmp    801eee <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801f2d:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801f32:	eb ba                	jmp    801eee <ftruncate+0x5e>
+
+0000000000801f34 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  801f34:	55                   	push   %rbp
+  801f35:	48 89 e5             	mov    %rsp,%rbp
+  801f38:	41 54                	push   %r12
+  801f3a:	53                   	push   %rbx
+  801f3b:	48 83 ec 10          	sub    $0x10,%rsp
+  801f3f:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801f42:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801f46:	48 b8 94 19 80 00 00 	movabs $0x801994,%rax
+  801f4d:	00 00 00 
+  801f50:	ff d0                	call   *%rax
+  801f52:	85 c0                	test   %eax,%eax
+  801f54:	78 4e                	js     801fa4 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801f56:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801f5a:	41 8b 3c 24          	mov    (%r12),%edi
+  801f5e:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801f62:	48 b8 df 19 80 00 00 	movabs $0x8019df,%rax
+  801f69:	00 00 00 
+  801f6c:	ff d0                	call   *%rax
+  801f6e:	85 c0                	test   %eax,%eax
+  801f70:	78 32                	js     801fa4 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801f72:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801f76:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  801f7b:	74 30                	je     801fad <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  801f7d:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  801f80:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  801f87:	00 00 00 
+    stat->st_isdir = 0;
+  801f8a:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  801f91:	00 00 00 
+    stat->st_dev = dev;
+  801f94:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  801f9b:	48 89 de             	mov    %rbx,%rsi
+  801f9e:	4c 89 e7             	mov    %r12,%rdi
+  801fa1:	ff 50 28             	call   *0x28(%rax)
+}
+  801fa4:	48 83 c4 10          	add    $0x10,%rsp
+  801fa8:	5b                   	pop    %rbx
+  801fa9:	41 5c                	pop    %r12
+  801fab:	5d                   	pop    %rbp
+  801fac:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801fad:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801fb2:	eb f0                	jmp    801fa4 <fstat+0x70>
+
+0000000000801fb4 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  801fb4:	55                   	push   %rbp
+  801fb5:	48 89 e5             	mov    %rsp,%rbp
+  801fb8:	41 54                	push   %r12
+  801fba:	53                   	push   %rbx
+  801fbb:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  801fbe:	be 00 00 00 00       	mov    $0x0,%esi
+  801fc3:	48 b8 97 23 80 00 00 	movabs $0x802397,%rax
+  801fca:	00 00 00 
+  801fcd:	ff d0                	call   *%rax
+  801fcf:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  801fd1:	85 c0                	test   %eax,%eax
+  801fd3:	78 25                	js     801ffa <stat+0x46>
+
+    int res = fstat(fd, stat);
+  801fd5:	4c 89 e6             	mov    %r12,%rsi
+  801fd8:	89 c7                	mov    %eax,%edi
+  801fda:	48 b8 34 1f 80 00 00 	movabs $0x801f34,%rax
+  801fe1:	00 00 00 
+  801fe4:	ff d0                	call   *%rax
+  801fe6:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  801fe9:	89 df                	mov    %ebx,%edi
+  801feb:	48 b8 f9 1a 80 00 00 	movabs $0x801af9,%rax
+  801ff2:	00 00 00 
+  801ff5:	ff d0                	call   *%rax
+
+    return res;
+  801ff7:	44 89 e3             	mov    %r12d,%ebx
+}
+  801ffa:	89 d8                	mov    %ebx,%eax
+  801ffc:	5b                   	pop    %rbx
+  801ffd:	41 5c                	pop    %r12
+  801fff:	5d                   	pop    %rbp
+  802000:	c3                   	ret
+
+0000000000802001 <fsipc>:
+ * response may be written back to fsipcbuf.
+ * type: request code, passed as the simple integer IPC value.
+ * dstva: virtual address at which to receive reply page, 0 if none.
+ * Returns result from the file server. */
+static int
+fsipc(unsigned type, void *dstva) {
+  802001:	55                   	push   %rbp
+  802002:	48 89 e5             	mov    %rsp,%rbp
+  802005:	41 54                	push   %r12
+  802007:	53                   	push   %rbx
+  802008:	48 83 ec 10          	sub    $0x10,%rsp
+  80200c:	41 89 fc             	mov    %edi,%r12d
+  80200f:	48 89 f3             	mov    %rsi,%rbx
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802012:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  802019:	00 00 00 
+  80201c:	83 38 00             	cmpl   $0x0,(%rax)
+  80201f:	74 5e                	je     80207f <fsipc+0x7e>
+    if (debug) {
+        cprintf("[%08x] fsipc %d %08x\n",
+                thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+    }
+
+    ipc_send(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW);
+  802021:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802027:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80202c:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  802033:	00 00 00 
+  802036:	44 89 e6             	mov    %r12d,%esi
+  802039:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  802040:	00 00 00 
+  802043:	8b 38                	mov    (%rax),%edi
+  802045:	48 b8 fe 2e 80 00 00 	movabs $0x802efe,%rax
+  80204c:	00 00 00 
+  80204f:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  802051:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  802058:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  802059:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80205e:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  802062:	48 89 de             	mov    %rbx,%rsi
+  802065:	bf 00 00 00 00       	mov    $0x0,%edi
+  80206a:	48 b8 29 2e 80 00 00 	movabs $0x802e29,%rax
+  802071:	00 00 00 
+  802074:	ff d0                	call   *%rax
+}
+  802076:	48 83 c4 10          	add    $0x10,%rsp
+  80207a:	5b                   	pop    %rbx
+  80207b:	41 5c                	pop    %r12
+  80207d:	5d                   	pop    %rbp
+  80207e:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  80207f:	bf 03 00 00 00       	mov    $0x3,%edi
+  802084:	48 b8 a1 2f 80 00 00 	movabs $0x802fa1,%rax
+  80208b:	00 00 00 
+  80208e:	ff d0                	call   *%rax
+  802090:	a3 00 80 80 00 00 00 	movabs %eax,0x808000
+  802097:	00 00 
+  802099:	eb 86                	jmp    802021 <fsipc+0x20>
+
+000000000080209b <devfile_trunc>:
+    return 0;
+}
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  80209b:	55                   	push   %rbp
+  80209c:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  80209f:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  8020a6:	00 00 00 
+  8020a9:	8b 57 0c             	mov    0xc(%rdi),%edx
+  8020ac:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  8020ae:	89 70 04             	mov    %esi,0x4(%rax)
+
+    return fsipc(FSREQ_SET_SIZE, NULL);
+  8020b1:	be 00 00 00 00       	mov    $0x0,%esi
+  8020b6:	bf 02 00 00 00       	mov    $0x2,%edi
+  8020bb:	48 b8 01 20 80 00 00 	movabs $0x802001,%rax
+  8020c2:	00 00 00 
+  8020c5:	ff d0                	call   *%rax
+}
+  8020c7:	5d                   	pop    %rbp
+  8020c8:	c3                   	ret
+
+00000000008020c9 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  8020c9:	55                   	push   %rbp
+  8020ca:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  8020cd:	8b 47 0c             	mov    0xc(%rdi),%eax
+  8020d0:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  8020d7:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  8020d9:	be 00 00 00 00       	mov    $0x0,%esi
+  8020de:	bf 06 00 00 00       	mov    $0x6,%edi
+  8020e3:	48 b8 01 20 80 00 00 	movabs $0x802001,%rax
+  8020ea:	00 00 00 
+  8020ed:	ff d0                	call   *%rax
+}
+  8020ef:	5d                   	pop    %rbp
+  8020f0:	c3                   	ret
+
+00000000008020f1 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  8020f1:	55                   	push   %rbp
+  8020f2:	48 89 e5             	mov    %rsp,%rbp
+  8020f5:	41 54                	push   %r12
+  8020f7:	53                   	push   %rbx
+  8020f8:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8020fb:	8b 47 0c             	mov    0xc(%rdi),%eax
+  8020fe:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  802105:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  802107:	be 00 00 00 00       	mov    $0x0,%esi
+  80210c:	bf 05 00 00 00       	mov    $0x5,%edi
+  802111:	48 b8 01 20 80 00 00 	movabs $0x802001,%rax
+  802118:	00 00 00 
+  80211b:	ff d0                	call   *%rax
+    if (res < 0) {
+  80211d:	85 c0                	test   %eax,%eax
+  80211f:	78 3d                	js     80215e <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802121:	49 bc 00 70 80 00 00 	movabs $0x807000,%r12
+  802128:	00 00 00 
+  80212b:	4c 89 e6             	mov    %r12,%rsi
+  80212e:	48 89 df             	mov    %rbx,%rdi
+  802131:	48 b8 84 0d 80 00 00 	movabs $0x800d84,%rax
+  802138:	00 00 00 
+  80213b:	ff d0                	call   *%rax
+    st->st_size  = fsipcbuf.statRet.ret_size;
+  80213d:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  802144:	00 
+  802145:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  80214b:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  802152:	00 
+  802153:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  802159:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80215e:	5b                   	pop    %rbx
+  80215f:	41 5c                	pop    %r12
+  802161:	5d                   	pop    %rbp
+  802162:	c3                   	ret
+
+0000000000802163 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  802163:	55                   	push   %rbp
+  802164:	48 89 e5             	mov    %rsp,%rbp
+  802167:	41 57                	push   %r15
+  802169:	41 56                	push   %r14
+  80216b:	41 55                	push   %r13
+  80216d:	41 54                	push   %r12
+  80216f:	53                   	push   %rbx
+  802170:	48 83 ec 18          	sub    $0x18,%rsp
+  802174:	49 89 fe             	mov    %rdi,%r14
+  802177:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+  80217b:	48 89 d3             	mov    %rdx,%rbx
+    while (n > sizeof(fsipcbuf.write.req_buf))
+  80217e:	48 81 fa f0 0f 00 00 	cmp    $0xff0,%rdx
+  802185:	0f 86 e4 00 00 00    	jbe    80226f <devfile_write+0x10c>
+  80218b:	49 89 f4             	mov    %rsi,%r12
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  80218e:	49 bd 00 70 80 00 00 	movabs $0x807000,%r13
+  802195:	00 00 00 
+        memcpy(fsipcbuf.write.req_buf, buf, sizeof(fsipcbuf.write.req_buf));
+  802198:	49 bf e5 0f 80 00 00 	movabs $0x800fe5,%r15
+  80219f:	00 00 00 
+  8021a2:	eb 03                	jmp    8021a7 <devfile_write+0x44>
+        buf += sizeof(fsipcbuf.write.req_buf);
+  8021a4:	49 89 f4             	mov    %rsi,%r12
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8021a7:	41 8b 46 0c          	mov    0xc(%r14),%eax
+  8021ab:	41 89 45 00          	mov    %eax,0x0(%r13)
+        fsipcbuf.write.req_n      = sizeof(fsipcbuf.write.req_buf);
+  8021af:	49 c7 45 08 f0 0f 00 	movq   $0xff0,0x8(%r13)
+  8021b6:	00 
+        memcpy(fsipcbuf.write.req_buf, buf, sizeof(fsipcbuf.write.req_buf));
+  8021b7:	ba f0 0f 00 00       	mov    $0xff0,%edx
+  8021bc:	4c 89 e6             	mov    %r12,%rsi
+  8021bf:	48 bf 10 70 80 00 00 	movabs $0x807010,%rdi
+  8021c6:	00 00 00 
+  8021c9:	41 ff d7             	call   *%r15
+        ssize_t res = fsipc(FSREQ_WRITE, NULL);
+  8021cc:	be 00 00 00 00       	mov    $0x0,%esi
+  8021d1:	bf 04 00 00 00       	mov    $0x4,%edi
+  8021d6:	48 b8 01 20 80 00 00 	movabs $0x802001,%rax
+  8021dd:	00 00 00 
+  8021e0:	ff d0                	call   *%rax
+  8021e2:	48 63 d0             	movslq %eax,%rdx
+        if (res < 0 || res < sizeof(fsipcbuf.write.req_buf))
+  8021e5:	3d ef 0f 00 00       	cmp    $0xfef,%eax
+  8021ea:	7e 71                	jle    80225d <devfile_write+0xfa>
+        buf += sizeof(fsipcbuf.write.req_buf);
+  8021ec:	49 8d b4 24 f0 0f 00 	lea    0xff0(%r12),%rsi
+  8021f3:	00 
+        n -= sizeof(fsipcbuf.write.req_buf);
+  8021f4:	48 81 eb f0 0f 00 00 	sub    $0xff0,%rbx
+    while (n > sizeof(fsipcbuf.write.req_buf))
+  8021fb:	48 81 fb f0 0f 00 00 	cmp    $0xff0,%rbx
+  802202:	77 a0                	ja     8021a4 <devfile_write+0x41>
+        written += sizeof(fsipcbuf.write.req_buf);
+  802204:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802208:	49 29 c4             	sub    %rax,%r12
+  80220b:	4d 8d a4 24 f0 0f 00 	lea    0xff0(%r12),%r12
+  802212:	00 
+    fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802213:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  80221a:	00 00 00 
+  80221d:	41 8b 56 0c          	mov    0xc(%r14),%edx
+  802221:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.write.req_n      = n;
+  802223:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    memcpy(fsipcbuf.write.req_buf, buf, n);
+  802227:	48 89 da             	mov    %rbx,%rdx
+  80222a:	48 8d 78 10          	lea    0x10(%rax),%rdi
+  80222e:	48 b8 e5 0f 80 00 00 	movabs $0x800fe5,%rax
+  802235:	00 00 00 
+  802238:	ff d0                	call   *%rax
+    ssize_t res = fsipc(FSREQ_WRITE, NULL);
+  80223a:	be 00 00 00 00       	mov    $0x0,%esi
+  80223f:	bf 04 00 00 00       	mov    $0x4,%edi
+  802244:	48 b8 01 20 80 00 00 	movabs $0x802001,%rax
+  80224b:	00 00 00 
+  80224e:	ff d0                	call   *%rax
+  802250:	48 63 d0             	movslq %eax,%rdx
+    written += res;
+  802253:	49 01 d4             	add    %rdx,%r12
+  802256:	48 85 d2             	test   %rdx,%rdx
+  802259:	49 0f 49 d4          	cmovns %r12,%rdx
+}
+  80225d:	48 89 d0             	mov    %rdx,%rax
+  802260:	48 83 c4 18          	add    $0x18,%rsp
+  802264:	5b                   	pop    %rbx
+  802265:	41 5c                	pop    %r12
+  802267:	41 5d                	pop    %r13
+  802269:	41 5e                	pop    %r14
+  80226b:	41 5f                	pop    %r15
+  80226d:	5d                   	pop    %rbp
+  80226e:	c3                   	ret
+    while (n > sizeof(fsipcbuf.write.req_buf))
+  80226f:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+    ssize_t written = 0;
+  802273:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802279:	eb 98                	jmp    802213 <devfile_write+0xb0>
+
+000000000080227b <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  80227b:	55                   	push   %rbp
+  80227c:	48 89 e5             	mov    %rsp,%rbp
+  80227f:	41 57                	push   %r15
+  802281:	41 56                	push   %r14
+  802283:	41 55                	push   %r13
+  802285:	41 54                	push   %r12
+  802287:	53                   	push   %rbx
+  802288:	48 83 ec 18          	sub    $0x18,%rsp
+  80228c:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  802290:	49 89 f6             	mov    %rsi,%r14
+  802293:	49 89 d4             	mov    %rdx,%r12
+    while (n > sizeof(fsipcbuf.readRet.ret_buf))
+  802296:	48 81 fa 00 10 00 00 	cmp    $0x1000,%rdx
+  80229d:	0f 86 ea 00 00 00    	jbe    80238d <devfile_read+0x112>
+    ssize_t readsz = 0;
+  8022a3:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  8022aa:	00 
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8022ab:	49 bf 00 70 80 00 00 	movabs $0x807000,%r15
+  8022b2:	00 00 00 
+  8022b5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8022b9:	8b 40 0c             	mov    0xc(%rax),%eax
+  8022bc:	41 89 07             	mov    %eax,(%r15)
+        fsipcbuf.read.req_n = sizeof(fsipcbuf.readRet.ret_buf);
+  8022bf:	49 c7 47 08 00 10 00 	movq   $0x1000,0x8(%r15)
+  8022c6:	00 
+        ssize_t res = fsipc(FSREQ_READ, NULL);
+  8022c7:	be 00 00 00 00       	mov    $0x0,%esi
+  8022cc:	bf 03 00 00 00       	mov    $0x3,%edi
+  8022d1:	48 b8 01 20 80 00 00 	movabs $0x802001,%rax
+  8022d8:	00 00 00 
+  8022db:	ff d0                	call   *%rax
+  8022dd:	4c 63 e8             	movslq %eax,%r13
+        if (res < 0)
+  8022e0:	4d 85 ed             	test   %r13,%r13
+  8022e3:	0f 88 92 00 00 00    	js     80237b <devfile_read+0x100>
+        memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  8022e9:	4c 89 ea             	mov    %r13,%rdx
+  8022ec:	4c 89 fe             	mov    %r15,%rsi
+  8022ef:	4c 89 f7             	mov    %r14,%rdi
+  8022f2:	48 b8 e5 0f 80 00 00 	movabs $0x800fe5,%rax
+  8022f9:	00 00 00 
+  8022fc:	ff d0                	call   *%rax
+        if (res < sizeof(fsipcbuf.readRet.ret_buf))
+  8022fe:	49 81 fd ff 0f 00 00 	cmp    $0xfff,%r13
+  802305:	76 6d                	jbe    802374 <devfile_read+0xf9>
+        readsz += res;
+  802307:	4c 01 6d c0          	add    %r13,-0x40(%rbp)
+        buf += res;
+  80230b:	4d 01 ee             	add    %r13,%r14
+        n -= res;
+  80230e:	4d 29 ec             	sub    %r13,%r12
+    while (n > sizeof(fsipcbuf.readRet.ret_buf))
+  802311:	49 81 fc 00 10 00 00 	cmp    $0x1000,%r12
+  802318:	77 9b                	ja     8022b5 <devfile_read+0x3a>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  80231a:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  802321:	00 00 00 
+  802324:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  802328:	8b 51 0c             	mov    0xc(%rcx),%edx
+  80232b:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.read.req_n = n;
+  80232d:	4c 89 60 08          	mov    %r12,0x8(%rax)
+    ssize_t res = fsipc(FSREQ_READ, NULL);
+  802331:	be 00 00 00 00       	mov    $0x0,%esi
+  802336:	bf 03 00 00 00       	mov    $0x3,%edi
+  80233b:	48 b8 01 20 80 00 00 	movabs $0x802001,%rax
+  802342:	00 00 00 
+  802345:	ff d0                	call   *%rax
+  802347:	4c 63 e8             	movslq %eax,%r13
+    if (res < 0)
+  80234a:	4d 85 ed             	test   %r13,%r13
+  80234d:	78 2c                	js     80237b <devfile_read+0x100>
+    memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  80234f:	4c 89 ea             	mov    %r13,%rdx
+  802352:	48 be 00 70 80 00 00 	movabs $0x807000,%rsi
+  802359:	00 00 00 
+  80235c:	4c 89 f7             	mov    %r14,%rdi
+  80235f:	48 b8 e5 0f 80 00 00 	movabs $0x800fe5,%rax
+  802366:	00 00 00 
+  802369:	ff d0                	call   *%rax
+    readsz += res;
+  80236b:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80236f:	49 01 c5             	add    %rax,%r13
+    return readsz;
+  802372:	eb 07                	jmp    80237b <devfile_read+0x100>
+            return readsz + res;
+  802374:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802378:	49 01 c5             	add    %rax,%r13
+}
+  80237b:	4c 89 e8             	mov    %r13,%rax
+  80237e:	48 83 c4 18          	add    $0x18,%rsp
+  802382:	5b                   	pop    %rbx
+  802383:	41 5c                	pop    %r12
+  802385:	41 5d                	pop    %r13
+  802387:	41 5e                	pop    %r14
+  802389:	41 5f                	pop    %r15
+  80238b:	5d                   	pop    %rbp
+  80238c:	c3                   	ret
+    ssize_t readsz = 0;
+  80238d:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  802394:	00 
+  802395:	eb 83                	jmp    80231a <devfile_read+0x9f>
+
+0000000000802397 <open>:
+open(const char *path, int mode) {
+  802397:	55                   	push   %rbp
+  802398:	48 89 e5             	mov    %rsp,%rbp
+  80239b:	41 55                	push   %r13
+  80239d:	41 54                	push   %r12
+  80239f:	53                   	push   %rbx
+  8023a0:	48 83 ec 18          	sub    $0x18,%rsp
+  8023a4:	49 89 fc             	mov    %rdi,%r12
+  8023a7:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  8023aa:	48 b8 46 0d 80 00 00 	movabs $0x800d46,%rax
+  8023b1:	00 00 00 
+  8023b4:	ff d0                	call   *%rax
+  8023b6:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  8023bc:	0f 87 8a 00 00 00    	ja     80244c <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8023c2:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  8023c6:	48 b8 7a 19 80 00 00 	movabs $0x80197a,%rax
+  8023cd:	00 00 00 
+  8023d0:	ff d0                	call   *%rax
+  8023d2:	89 c3                	mov    %eax,%ebx
+  8023d4:	85 c0                	test   %eax,%eax
+  8023d6:	78 50                	js     802428 <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  8023d8:	4c 89 e6             	mov    %r12,%rsi
+  8023db:	48 bb 00 70 80 00 00 	movabs $0x807000,%rbx
+  8023e2:	00 00 00 
+  8023e5:	48 89 df             	mov    %rbx,%rdi
+  8023e8:	48 b8 84 0d 80 00 00 	movabs $0x800d84,%rax
+  8023ef:	00 00 00 
+  8023f2:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  8023f4:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  8023fb:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8023ff:	bf 01 00 00 00       	mov    $0x1,%edi
+  802404:	48 b8 01 20 80 00 00 	movabs $0x802001,%rax
+  80240b:	00 00 00 
+  80240e:	ff d0                	call   *%rax
+  802410:	89 c3                	mov    %eax,%ebx
+  802412:	85 c0                	test   %eax,%eax
+  802414:	78 1f                	js     802435 <open+0x9e>
+    return fd2num(fd);
+  802416:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80241a:	48 b8 d3 18 80 00 00 	movabs $0x8018d3,%rax
+  802421:	00 00 00 
+  802424:	ff d0                	call   *%rax
+  802426:	89 c3                	mov    %eax,%ebx
+}
+  802428:	89 d8                	mov    %ebx,%eax
+  80242a:	48 83 c4 18          	add    $0x18,%rsp
+  80242e:	5b                   	pop    %rbx
+  80242f:	41 5c                	pop    %r12
+  802431:	41 5d                	pop    %r13
+  802433:	5d                   	pop    %rbp
+  802434:	c3                   	ret
+        fd_close(fd, 0);
+  802435:	be 00 00 00 00       	mov    $0x0,%esi
+  80243a:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80243e:	48 b8 4f 1a 80 00 00 	movabs $0x801a4f,%rax
+  802445:	00 00 00 
+  802448:	ff d0                	call   *%rax
+        return res;
+  80244a:	eb dc                	jmp    802428 <open+0x91>
+        return -E_BAD_PATH;
+  80244c:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  802451:	eb d5                	jmp    802428 <open+0x91>
+
+0000000000802453 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  802453:	55                   	push   %rbp
+  802454:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc(FSREQ_SYNC, NULL);
+  802457:	be 00 00 00 00       	mov    $0x0,%esi
+  80245c:	bf 08 00 00 00       	mov    $0x8,%edi
+  802461:	48 b8 01 20 80 00 00 	movabs $0x802001,%rax
+  802468:	00 00 00 
+  80246b:	ff d0                	call   *%rax
+}
+  80246d:	5d                   	pop    %rbp
+  80246e:	c3                   	ret
+
+000000000080246f <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  80246f:	55                   	push   %rbp
+  802470:	48 89 e5             	mov    %rsp,%rbp
+  802473:	41 54                	push   %r12
+  802475:	53                   	push   %rbx
+  802476:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802479:	48 b8 e5 18 80 00 00 	movabs $0x8018e5,%rax
+  802480:	00 00 00 
+  802483:	ff d0                	call   *%rax
+  802485:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  802488:	48 be 00 37 80 00 00 	movabs $0x803700,%rsi
+  80248f:	00 00 00 
+  802492:	48 89 df             	mov    %rbx,%rdi
+  802495:	48 b8 84 0d 80 00 00 	movabs $0x800d84,%rax
+  80249c:	00 00 00 
+  80249f:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  8024a1:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  8024a6:	41 2b 04 24          	sub    (%r12),%eax
+  8024aa:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  8024b0:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8024b7:	00 00 00 
+    stat->st_dev = &devpipe;
+  8024ba:	48 b8 60 40 80 00 00 	movabs $0x804060,%rax
+  8024c1:	00 00 00 
+  8024c4:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  8024cb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024d0:	5b                   	pop    %rbx
+  8024d1:	41 5c                	pop    %r12
+  8024d3:	5d                   	pop    %rbp
+  8024d4:	c3                   	ret
+
+00000000008024d5 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  8024d5:	55                   	push   %rbp
+  8024d6:	48 89 e5             	mov    %rsp,%rbp
+  8024d9:	41 54                	push   %r12
+  8024db:	53                   	push   %rbx
+  8024dc:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8024df:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8024e4:	48 89 fe             	mov    %rdi,%rsi
+  8024e7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8024ec:	49 bc 00 14 80 00 00 	movabs $0x801400,%r12
+  8024f3:	00 00 00 
+  8024f6:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  8024f9:	48 89 df             	mov    %rbx,%rdi
+  8024fc:	48 b8 e5 18 80 00 00 	movabs $0x8018e5,%rax
+  802503:	00 00 00 
+  802506:	ff d0                	call   *%rax
+  802508:	48 89 c6             	mov    %rax,%rsi
+  80250b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802510:	bf 00 00 00 00       	mov    $0x0,%edi
+  802515:	41 ff d4             	call   *%r12
+}
+  802518:	5b                   	pop    %rbx
+  802519:	41 5c                	pop    %r12
+  80251b:	5d                   	pop    %rbp
+  80251c:	c3                   	ret
+
+000000000080251d <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  80251d:	55                   	push   %rbp
+  80251e:	48 89 e5             	mov    %rsp,%rbp
+  802521:	41 57                	push   %r15
+  802523:	41 56                	push   %r14
+  802525:	41 55                	push   %r13
+  802527:	41 54                	push   %r12
+  802529:	53                   	push   %rbx
+  80252a:	48 83 ec 18          	sub    $0x18,%rsp
+  80252e:	49 89 fc             	mov    %rdi,%r12
+  802531:	49 89 f5             	mov    %rsi,%r13
+  802534:	49 89 d7             	mov    %rdx,%r15
+  802537:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80253b:	48 b8 e5 18 80 00 00 	movabs $0x8018e5,%rax
+  802542:	00 00 00 
+  802545:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  802547:	4d 85 ff             	test   %r15,%r15
+  80254a:	0f 84 af 00 00 00    	je     8025ff <devpipe_write+0xe2>
+  802550:	48 89 c3             	mov    %rax,%rbx
+  802553:	4c 89 f8             	mov    %r15,%rax
+  802556:	4d 89 ef             	mov    %r13,%r15
+  802559:	4c 01 e8             	add    %r13,%rax
+  80255c:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802560:	49 bd 08 13 80 00 00 	movabs $0x801308,%r13
+  802567:	00 00 00 
+            sys_yield();
+  80256a:	49 be a5 12 80 00 00 	movabs $0x8012a5,%r14
+  802571:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  802574:	8b 73 04             	mov    0x4(%rbx),%esi
+  802577:	48 63 ce             	movslq %esi,%rcx
+  80257a:	48 63 03             	movslq (%rbx),%rax
+  80257d:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  802583:	48 39 c1             	cmp    %rax,%rcx
+  802586:	72 2e                	jb     8025b6 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802588:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80258d:	48 89 da             	mov    %rbx,%rdx
+  802590:	be 00 10 00 00       	mov    $0x1000,%esi
+  802595:	4c 89 e7             	mov    %r12,%rdi
+  802598:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  80259b:	85 c0                	test   %eax,%eax
+  80259d:	74 66                	je     802605 <devpipe_write+0xe8>
+            sys_yield();
+  80259f:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  8025a2:	8b 73 04             	mov    0x4(%rbx),%esi
+  8025a5:	48 63 ce             	movslq %esi,%rcx
+  8025a8:	48 63 03             	movslq (%rbx),%rax
+  8025ab:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  8025b1:	48 39 c1             	cmp    %rax,%rcx
+  8025b4:	73 d2                	jae    802588 <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8025b6:	41 0f b6 3f          	movzbl (%r15),%edi
+  8025ba:	48 89 ca             	mov    %rcx,%rdx
+  8025bd:	48 c1 ea 03          	shr    $0x3,%rdx
+  8025c1:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  8025c8:	08 10 20 
+  8025cb:	48 f7 e2             	mul    %rdx
+  8025ce:	48 c1 ea 06          	shr    $0x6,%rdx
+  8025d2:	48 89 d0             	mov    %rdx,%rax
+  8025d5:	48 c1 e0 09          	shl    $0x9,%rax
+  8025d9:	48 29 d0             	sub    %rdx,%rax
+  8025dc:	48 c1 e0 03          	shl    $0x3,%rax
+  8025e0:	48 29 c1             	sub    %rax,%rcx
+  8025e3:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  8025e8:	83 c6 01             	add    $0x1,%esi
+  8025eb:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8025ee:	49 83 c7 01          	add    $0x1,%r15
+  8025f2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8025f6:	49 39 c7             	cmp    %rax,%r15
+  8025f9:	0f 85 75 ff ff ff    	jne    802574 <devpipe_write+0x57>
+    return n;
+  8025ff:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802603:	eb 05                	jmp    80260a <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  802605:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80260a:	48 83 c4 18          	add    $0x18,%rsp
+  80260e:	5b                   	pop    %rbx
+  80260f:	41 5c                	pop    %r12
+  802611:	41 5d                	pop    %r13
+  802613:	41 5e                	pop    %r14
+  802615:	41 5f                	pop    %r15
+  802617:	5d                   	pop    %rbp
+  802618:	c3                   	ret
+
+0000000000802619 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  802619:	55                   	push   %rbp
+  80261a:	48 89 e5             	mov    %rsp,%rbp
+  80261d:	41 57                	push   %r15
+  80261f:	41 56                	push   %r14
+  802621:	41 55                	push   %r13
+  802623:	41 54                	push   %r12
+  802625:	53                   	push   %rbx
+  802626:	48 83 ec 18          	sub    $0x18,%rsp
+  80262a:	49 89 fc             	mov    %rdi,%r12
+  80262d:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  802631:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802635:	48 b8 e5 18 80 00 00 	movabs $0x8018e5,%rax
+  80263c:	00 00 00 
+  80263f:	ff d0                	call   *%rax
+  802641:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  802644:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80264a:	49 bd 08 13 80 00 00 	movabs $0x801308,%r13
+  802651:	00 00 00 
+            sys_yield();
+  802654:	49 be a5 12 80 00 00 	movabs $0x8012a5,%r14
+  80265b:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  80265e:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  802663:	74 7d                	je     8026e2 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  802665:	8b 03                	mov    (%rbx),%eax
+  802667:	3b 43 04             	cmp    0x4(%rbx),%eax
+  80266a:	75 26                	jne    802692 <devpipe_read+0x79>
+            if (i > 0) return i;
+  80266c:	4d 85 ff             	test   %r15,%r15
+  80266f:	75 77                	jne    8026e8 <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802671:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802676:	48 89 da             	mov    %rbx,%rdx
+  802679:	be 00 10 00 00       	mov    $0x1000,%esi
+  80267e:	4c 89 e7             	mov    %r12,%rdi
+  802681:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  802684:	85 c0                	test   %eax,%eax
+  802686:	74 72                	je     8026fa <devpipe_read+0xe1>
+            sys_yield();
+  802688:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  80268b:	8b 03                	mov    (%rbx),%eax
+  80268d:	3b 43 04             	cmp    0x4(%rbx),%eax
+  802690:	74 df                	je     802671 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802692:	48 63 c8             	movslq %eax,%rcx
+  802695:	48 89 ca             	mov    %rcx,%rdx
+  802698:	48 c1 ea 03          	shr    $0x3,%rdx
+  80269c:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  8026a3:	08 10 20 
+  8026a6:	48 89 d0             	mov    %rdx,%rax
+  8026a9:	48 f7 e6             	mul    %rsi
+  8026ac:	48 c1 ea 06          	shr    $0x6,%rdx
+  8026b0:	48 89 d0             	mov    %rdx,%rax
+  8026b3:	48 c1 e0 09          	shl    $0x9,%rax
+  8026b7:	48 29 d0             	sub    %rdx,%rax
+  8026ba:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  8026c1:	00 
+  8026c2:	48 89 c8             	mov    %rcx,%rax
+  8026c5:	48 29 d0             	sub    %rdx,%rax
+  8026c8:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  8026cd:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8026d1:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  8026d5:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8026d8:	49 83 c7 01          	add    $0x1,%r15
+  8026dc:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  8026e0:	75 83                	jne    802665 <devpipe_read+0x4c>
+    return n;
+  8026e2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8026e6:	eb 03                	jmp    8026eb <devpipe_read+0xd2>
+            if (i > 0) return i;
+  8026e8:	4c 89 f8             	mov    %r15,%rax
+}
+  8026eb:	48 83 c4 18          	add    $0x18,%rsp
+  8026ef:	5b                   	pop    %rbx
+  8026f0:	41 5c                	pop    %r12
+  8026f2:	41 5d                	pop    %r13
+  8026f4:	41 5e                	pop    %r14
+  8026f6:	41 5f                	pop    %r15
+  8026f8:	5d                   	pop    %rbp
+  8026f9:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  8026fa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8026ff:	eb ea                	jmp    8026eb <devpipe_read+0xd2>
+
+0000000000802701 <pipe>:
+pipe(int pfd[2]) {
+  802701:	55                   	push   %rbp
+  802702:	48 89 e5             	mov    %rsp,%rbp
+  802705:	41 55                	push   %r13
+  802707:	41 54                	push   %r12
+  802709:	53                   	push   %rbx
+  80270a:	48 81 ec b8 00 00 00 	sub    $0xb8,%rsp
+  802711:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  802714:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802718:	48 b8 7a 19 80 00 00 	movabs $0x80197a,%rax
+  80271f:	00 00 00 
+  802722:	ff d0                	call   *%rax
+  802724:	89 c3                	mov    %eax,%ebx
+  802726:	85 c0                	test   %eax,%eax
+  802728:	0f 88 51 01 00 00    	js     80287f <pipe+0x17e>
+        (res = fd_alloc_from(fd2num(fd0) + 1, &fd1)) < 0) goto err;
+  80272e:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802732:	48 b8 d3 18 80 00 00 	movabs $0x8018d3,%rax
+  802739:	00 00 00 
+  80273c:	ff d0                	call   *%rax
+  80273e:	8d 78 01             	lea    0x1(%rax),%edi
+  802741:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802745:	48 b8 01 19 80 00 00 	movabs $0x801901,%rax
+  80274c:	00 00 00 
+  80274f:	ff d0                	call   *%rax
+  802751:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  802753:	85 c0                	test   %eax,%eax
+  802755:	0f 88 24 01 00 00    	js     80287f <pipe+0x17e>
+    va = fd2data(fd0);
+  80275b:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80275f:	48 bb e5 18 80 00 00 	movabs $0x8018e5,%rbx
+  802766:	00 00 00 
+  802769:	ff d3                	call   *%rbx
+  80276b:	49 89 c5             	mov    %rax,%r13
+    struct RegionOp ops[] = {
+  80276e:	48 8d bd 30 ff ff ff 	lea    -0xd0(%rbp),%rdi
+  802775:	b9 14 00 00 00       	mov    $0x14,%ecx
+  80277a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80277f:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+  802782:	c7 85 34 ff ff ff 46 	movl   $0x46,-0xcc(%rbp)
+  802789:	00 00 00 
+  80278c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802790:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+  802797:	48 c7 85 50 ff ff ff 	movq   $0x1000,-0xb0(%rbp)
+  80279e:	00 10 00 00 
+  8027a2:	c7 85 5c ff ff ff 46 	movl   $0x46,-0xa4(%rbp)
+  8027a9:	00 00 00 
+            {.type = REGION_ALLOC, .dstva = (uintptr_t)fd1, .size = PAGE_SIZE, .perm = PROT_RW | PROT_SHARE},
+  8027ac:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+    struct RegionOp ops[] = {
+  8027b0:	48 89 bd 70 ff ff ff 	mov    %rdi,-0x90(%rbp)
+  8027b7:	48 c7 85 78 ff ff ff 	movq   $0x1000,-0x88(%rbp)
+  8027be:	00 10 00 00 
+  8027c2:	c7 45 84 46 00 00 00 	movl   $0x46,-0x7c(%rbp)
+  8027c9:	4c 89 6d 98          	mov    %r13,-0x68(%rbp)
+  8027cd:	48 c7 45 a0 00 10 00 	movq   $0x1000,-0x60(%rbp)
+  8027d4:	00 
+  8027d5:	c7 45 a8 01 00 00 00 	movl   $0x1,-0x58(%rbp)
+  8027dc:	c7 45 ac 46 00 00 00 	movl   $0x46,-0x54(%rbp)
+  8027e3:	4c 89 6d b8          	mov    %r13,-0x48(%rbp)
+            {.type = REGION_MAP, .srcva = (uintptr_t)va, .dstva = (uintptr_t)fd2data(fd1), .size = PAGE_SIZE, .perm = PROT_RW | PROT_SHARE},
+  8027e7:	ff d3                	call   *%rbx
+    struct RegionOp ops[] = {
+  8027e9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8027ed:	48 c7 45 c8 00 10 00 	movq   $0x1000,-0x38(%rbp)
+  8027f4:	00 
+    if ((res = sys_region_batch(ops, sizeof ops / sizeof *ops)) < 0) goto err1;
+  8027f5:	be 04 00 00 00       	mov    $0x4,%esi
+  8027fa:	48 8d bd 30 ff ff ff 	lea    -0xd0(%rbp),%rdi
+  802801:	48 b8 67 14 80 00 00 	movabs $0x801467,%rax
+  802808:	00 00 00 
+  80280b:	ff d0                	call   *%rax
+  80280d:	89 c3                	mov    %eax,%ebx
+  80280f:	85 c0                	test   %eax,%eax
+  802811:	0f 88 ad 00 00 00    	js     8028c4 <pipe+0x1c3>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  802817:	be 00 10 00 00       	mov    $0x1000,%esi
+  80281c:	4c 89 ef             	mov    %r13,%rdi
+  80281f:	48 b8 d6 12 80 00 00 	movabs $0x8012d6,%rax
+  802826:	00 00 00 
+  802829:	ff d0                	call   *%rax
+  80282b:	83 f8 02             	cmp    $0x2,%eax
+  80282e:	75 5f                	jne    80288f <pipe+0x18e>
+    fd0->fd_dev_id = devpipe.dev_id;
+  802830:	a1 60 40 80 00 00 00 	movabs 0x804060,%eax
+  802837:	00 00 
+  802839:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80283d:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  80283f:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802843:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  80284a:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  80284e:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  802850:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802854:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  80285b:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80285f:	48 bb d3 18 80 00 00 	movabs $0x8018d3,%rbx
+  802866:	00 00 00 
+  802869:	ff d3                	call   *%rbx
+  80286b:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  80286f:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  802873:	ff d3                	call   *%rbx
+  802875:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  80287a:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  80287f:	89 d8                	mov    %ebx,%eax
+  802881:	48 81 c4 b8 00 00 00 	add    $0xb8,%rsp
+  802888:	5b                   	pop    %rbx
+  802889:	41 5c                	pop    %r12
+  80288b:	41 5d                	pop    %r13
+  80288d:	5d                   	pop    %rbp
+  80288e:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  80288f:	48 b9 30 37 80 00 00 	movabs $0x803730,%rcx
+  802896:	00 00 00 
+  802899:	48 ba 07 37 80 00 00 	movabs $0x803707,%rdx
+  8028a0:	00 00 00 
+  8028a3:	be 33 00 00 00       	mov    $0x33,%esi
+  8028a8:	48 bf 1c 37 80 00 00 	movabs $0x80371c,%rdi
+  8028af:	00 00 00 
+  8028b2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028b7:	49 b8 0f 03 80 00 00 	movabs $0x80030f,%r8
+  8028be:	00 00 00 
+  8028c1:	41 ff d0             	call   *%r8
+        ops[i].type = REGION_UNMAP;
+  8028c4:	c7 85 30 ff ff ff 02 	movl   $0x2,-0xd0(%rbp)
+  8028cb:	00 00 00 
+  8028ce:	c7 85 58 ff ff ff 02 	movl   $0x2,-0xa8(%rbp)
+  8028d5:	00 00 00 
+  8028d8:	c7 45 80 02 00 00 00 	movl   $0x2,-0x80(%rbp)
+  8028df:	c7 45 a8 02 00 00 00 	movl   $0x2,-0x58(%rbp)
+    sys_region_batch(ops, sizeof ops / sizeof *ops);
+  8028e6:	be 04 00 00 00       	mov    $0x4,%esi
+  8028eb:	48 8d bd 30 ff ff ff 	lea    -0xd0(%rbp),%rdi
+  8028f2:	48 b8 67 14 80 00 00 	movabs $0x801467,%rax
+  8028f9:	00 00 00 
+  8028fc:	ff d0                	call   *%rax
+  8028fe:	e9 7c ff ff ff       	jmp    80287f <pipe+0x17e>
+
+0000000000802903 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  802903:	55                   	push   %rbp
+  802904:	48 89 e5             	mov    %rsp,%rbp
+  802907:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  80290b:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80290f:	48 b8 94 19 80 00 00 	movabs $0x801994,%rax
+  802916:	00 00 00 
+  802919:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80291b:	85 c0                	test   %eax,%eax
+  80291d:	78 35                	js     802954 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  80291f:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802923:	48 b8 e5 18 80 00 00 	movabs $0x8018e5,%rax
+  80292a:	00 00 00 
+  80292d:	ff d0                	call   *%rax
+  80292f:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802932:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802937:	be 00 10 00 00       	mov    $0x1000,%esi
+  80293c:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802940:	48 b8 08 13 80 00 00 	movabs $0x801308,%rax
+  802947:	00 00 00 
+  80294a:	ff d0                	call   *%rax
+  80294c:	85 c0                	test   %eax,%eax
+  80294e:	0f 94 c0             	sete   %al
+  802951:	0f b6 c0             	movzbl %al,%eax
+}
+  802954:	c9                   	leave
+  802955:	c3                   	ret
+
+0000000000802956 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  802956:	48 89 f8             	mov    %rdi,%rax
+  802959:	48 c1 e8 27          	shr    $0x27,%rax
+  80295d:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  802964:	01 00 00 
+  802967:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80296b:	f6 c2 01             	test   $0x1,%dl
+  80296e:	74 6d                	je     8029dd <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  802970:	48 89 f8             	mov    %rdi,%rax
+  802973:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802977:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  80297e:	01 00 00 
+  802981:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802985:	f6 c2 01             	test   $0x1,%dl
+  802988:	74 62                	je     8029ec <get_uvpt_entry+0x96>
+  80298a:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802991:	01 00 00 
+  802994:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802998:	f6 c2 80             	test   $0x80,%dl
+  80299b:	75 4f                	jne    8029ec <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  80299d:	48 89 f8             	mov    %rdi,%rax
+  8029a0:	48 c1 e8 15          	shr    $0x15,%rax
+  8029a4:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8029ab:	01 00 00 
+  8029ae:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8029b2:	f6 c2 01             	test   $0x1,%dl
+  8029b5:	74 44                	je     8029fb <get_uvpt_entry+0xa5>
+  8029b7:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8029be:	01 00 00 
+  8029c1:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8029c5:	f6 c2 80             	test   $0x80,%dl
+  8029c8:	75 31                	jne    8029fb <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  8029ca:	48 c1 ef 0c          	shr    $0xc,%rdi
+  8029ce:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8029d5:	01 00 00 
+  8029d8:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  8029dc:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8029dd:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  8029e4:	01 00 00 
+  8029e7:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8029eb:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8029ec:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8029f3:	01 00 00 
+  8029f6:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8029fa:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8029fb:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802a02:	01 00 00 
+  802a05:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802a09:	c3                   	ret
+
+0000000000802a0a <get_prot>:
+
+int
+get_prot(void *va) {
+  802a0a:	55                   	push   %rbp
+  802a0b:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  802a0e:	48 b8 56 29 80 00 00 	movabs $0x802956,%rax
+  802a15:	00 00 00 
+  802a18:	ff d0                	call   *%rax
+  802a1a:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  802a1d:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  802a22:	89 c1                	mov    %eax,%ecx
+  802a24:	83 c9 04             	or     $0x4,%ecx
+  802a27:	f6 c2 01             	test   $0x1,%dl
+  802a2a:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  802a2d:	89 c1                	mov    %eax,%ecx
+  802a2f:	83 c9 02             	or     $0x2,%ecx
+  802a32:	f6 c2 02             	test   $0x2,%dl
+  802a35:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  802a38:	89 c1                	mov    %eax,%ecx
+  802a3a:	83 c9 01             	or     $0x1,%ecx
+  802a3d:	48 85 d2             	test   %rdx,%rdx
+  802a40:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  802a43:	89 c1                	mov    %eax,%ecx
+  802a45:	83 c9 40             	or     $0x40,%ecx
+  802a48:	f6 c6 04             	test   $0x4,%dh
+  802a4b:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  802a4e:	5d                   	pop    %rbp
+  802a4f:	c3                   	ret
+
+0000000000802a50 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  802a50:	55                   	push   %rbp
+  802a51:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  802a54:	48 b8 56 29 80 00 00 	movabs $0x802956,%rax
+  802a5b:	00 00 00 
+  802a5e:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  802a60:	48 c1 e8 06          	shr    $0x6,%rax
+  802a64:	83 e0 01             	and    $0x1,%eax
+}
+  802a67:	5d                   	pop    %rbp
+  802a68:	c3                   	ret
+
+0000000000802a69 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  802a69:	55                   	push   %rbp
+  802a6a:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  802a6d:	48 b8 56 29 80 00 00 	movabs $0x802956,%rax
+  802a74:	00 00 00 
+  802a77:	ff d0                	call   *%rax
+  802a79:	83 e0 01             	and    $0x1,%eax
+}
+  802a7c:	5d                   	pop    %rbp
+  802a7d:	c3                   	ret
+
+0000000000802a7e <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  802a7e:	55                   	push   %rbp
+  802a7f:	48 89 e5             	mov    %rsp,%rbp
+  802a82:	41 57                	push   %r15
+  802a84:	41 56                	push   %r14
+  802a86:	41 55                	push   %r13
+  802a88:	41 54                	push   %r12
+  802a8a:	53                   	push   %rbx
+  802a8b:	48 83 ec 38          	sub    $0x38,%rsp
+  802a8f:	49 89 f7             	mov    %rsi,%r15
+  802a92:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+                    }
+                    continue;
+                }
+                for (int ptei = 0; ptei < PT_ENTRY_COUNT; ptei++) {
+                    uintptr_t pte_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, pdei, ptei, 0);
+                    pte_t pte = uvpt[VPT(pte_addr)];
+  802a98:	49 bd 00 00 00 00 00 	movabs $0x10000000000,%r13
+  802a9f:	01 00 00 
+  802aa2:	4d 89 e6             	mov    %r12,%r14
+  802aa5:	49 89 fc             	mov    %rdi,%r12
+  802aa8:	e9 19 01 00 00       	jmp    802bc6 <foreach_shared_region+0x148>
+  802aad:	48 89 5d b0          	mov    %rbx,-0x50(%rbp)
+  802ab1:	4c 89 75 a8          	mov    %r14,-0x58(%rbp)
+  802ab5:	eb 52                	jmp    802b09 <foreach_shared_region+0x8b>
+                for (int ptei = 0; ptei < PT_ENTRY_COUNT; ptei++) {
+  802ab7:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802abe:	48 81 fb 00 00 20 00 	cmp    $0x200000,%rbx
+  802ac5:	74 2e                	je     802af5 <foreach_shared_region+0x77>
+                    uintptr_t pte_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, pdei, ptei, 0);
+  802ac7:	48 89 df             	mov    %rbx,%rdi
+  802aca:	4c 09 f7             	or     %r14,%rdi
+                    pte_t pte = uvpt[VPT(pte_addr)];
+  802acd:	48 89 f8             	mov    %rdi,%rax
+  802ad0:	48 c1 e8 0c          	shr    $0xc,%rax
+  802ad4:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+                    if ((pte & PTE_P) && (pte & PTE_SHARE)) {
+  802ad9:	25 01 04 00 00       	and    $0x401,%eax
+  802ade:	48 3d 01 04 00 00    	cmp    $0x401,%rax
+  802ae4:	75 d1                	jne    802ab7 <foreach_shared_region+0x39>
+                        fun((void*)pte_addr, (void*)(pte_addr + PAGE_SIZE), arg);
+  802ae6:	48 8d b7 00 10 00 00 	lea    0x1000(%rdi),%rsi
+  802aed:	4c 89 fa             	mov    %r15,%rdx
+  802af0:	41 ff d4             	call   *%r12
+  802af3:	eb c2                	jmp    802ab7 <foreach_shared_region+0x39>
+            for (int pdei = 0; pdei < PD_ENTRY_COUNT; pdei++) {
+  802af5:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  802afc:	00 
+  802afd:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802b01:	48 3d 00 00 00 40    	cmp    $0x40000000,%rax
+  802b07:	74 46                	je     802b4f <foreach_shared_region+0xd1>
+                uintptr_t pde_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, pdei, 0, 0);
+  802b09:	4c 8b 75 c8          	mov    -0x38(%rbp),%r14
+  802b0d:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802b11:	49 09 c6             	or     %rax,%r14
+                pde_t pde = uvpd[VPD(pde_addr)];
+  802b14:	4c 89 f0             	mov    %r14,%rax
+  802b17:	48 c1 e8 15          	shr    $0x15,%rax
+  802b1b:	48 b9 00 00 00 80 00 	movabs $0x10080000000,%rcx
+  802b22:	01 00 00 
+  802b25:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+                if (!(pde & PTE_P)) {
+  802b29:	a8 01                	test   $0x1,%al
+  802b2b:	74 c8                	je     802af5 <foreach_shared_region+0x77>
+                if (pde & PTE_PS) {
+  802b2d:	48 89 c3             	mov    %rax,%rbx
+  802b30:	81 e3 80 00 00 00    	and    $0x80,%ebx
+  802b36:	74 8f                	je     802ac7 <foreach_shared_region+0x49>
+                    if (pde & PTE_SHARE) {
+  802b38:	f6 c4 04             	test   $0x4,%ah
+  802b3b:	74 b8                	je     802af5 <foreach_shared_region+0x77>
+                        fun((void*)pde_addr, (void*)(pde_addr + 1024 * 1024 * 2), arg);
+  802b3d:	49 8d b6 00 00 20 00 	lea    0x200000(%r14),%rsi
+  802b44:	4c 89 fa             	mov    %r15,%rdx
+  802b47:	4c 89 f7             	mov    %r14,%rdi
+  802b4a:	41 ff d4             	call   *%r12
+  802b4d:	eb a6                	jmp    802af5 <foreach_shared_region+0x77>
+  802b4f:	48 8b 5d b0          	mov    -0x50(%rbp),%rbx
+  802b53:	4c 8b 75 a8          	mov    -0x58(%rbp),%r14
+        for (int pdpei = 0; pdpei < PDP_ENTRY_COUNT; pdpei++) {
+  802b57:	48 81 c3 00 00 00 40 	add    $0x40000000,%rbx
+  802b5e:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802b65:	00 00 00 
+  802b68:	48 39 c3             	cmp    %rax,%rbx
+  802b6b:	74 4c                	je     802bb9 <foreach_shared_region+0x13b>
+            uintptr_t pdpe_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, 0, 0, 0);
+  802b6d:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802b71:	48 09 d8             	or     %rbx,%rax
+  802b74:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+            pdpe_t pdpe = uvpdp[VPDP(pdpe_addr)];
+  802b78:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802b7c:	48 b9 00 00 40 80 00 	movabs $0x10080400000,%rcx
+  802b83:	01 00 00 
+  802b86:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+            if (!(pdpe & PTE_P)) {
+  802b8a:	a8 01                	test   $0x1,%al
+  802b8c:	74 c9                	je     802b57 <foreach_shared_region+0xd9>
+            if (pdpe & PTE_PS) {
+  802b8e:	48 89 c1             	mov    %rax,%rcx
+  802b91:	81 e1 80 00 00 00    	and    $0x80,%ecx
+  802b97:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  802b9b:	0f 84 0c ff ff ff    	je     802aad <foreach_shared_region+0x2f>
+                if (pdpe & PTE_SHARE) {
+  802ba1:	f6 c4 04             	test   $0x4,%ah
+  802ba4:	74 b1                	je     802b57 <foreach_shared_region+0xd9>
+                    fun((void*)pdpe_addr, (void*)(pdpe_addr + 1024 * 1024 * 1024), arg); 
+  802ba6:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  802baa:	48 8d b7 00 00 00 40 	lea    0x40000000(%rdi),%rsi
+  802bb1:	4c 89 fa             	mov    %r15,%rdx
+  802bb4:	41 ff d4             	call   *%r12
+  802bb7:	eb 9e                	jmp    802b57 <foreach_shared_region+0xd9>
+    for (int pml4ei = 0; pml4ei < PML4_ENTRY_COUNT; pml4ei++) {
+  802bb9:	49 83 c6 01          	add    $0x1,%r14
+  802bbd:	49 81 fe 00 02 00 00 	cmp    $0x200,%r14
+  802bc4:	74 24                	je     802bea <foreach_shared_region+0x16c>
+        pml4e_t pml4e = uvpml4[VPML4(pml4_addr)];
+  802bc6:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  802bcd:	01 00 00 
+  802bd0:	4a 8b 04 f0          	mov    (%rax,%r14,8),%rax
+        if (!(pml4e & PTE_P)) {
+  802bd4:	a8 01                	test   $0x1,%al
+  802bd6:	74 e1                	je     802bb9 <foreach_shared_region+0x13b>
+  802bd8:	4c 89 f0             	mov    %r14,%rax
+  802bdb:	48 c1 e0 27          	shl    $0x27,%rax
+  802bdf:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  802be3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802be8:	eb 83                	jmp    802b6d <foreach_shared_region+0xef>
+            }
+        }
+    }
+    
+    return 0;
+}
+  802bea:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bef:	48 83 c4 38          	add    $0x38,%rsp
+  802bf3:	5b                   	pop    %rbx
+  802bf4:	41 5c                	pop    %r12
+  802bf6:	41 5d                	pop    %r13
+  802bf8:	41 5e                	pop    %r14
+  802bfa:	41 5f                	pop    %r15
+  802bfc:	5d                   	pop    %rbp
+  802bfd:	c3                   	ret
+
+0000000000802bfe <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  802bfe:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c03:	c3                   	ret
+
+0000000000802c04 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  802c04:	55                   	push   %rbp
+  802c05:	48 89 e5             	mov    %rsp,%rbp
+  802c08:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  802c0b:	48 be 54 37 80 00 00 	movabs $0x803754,%rsi
+  802c12:	00 00 00 
+  802c15:	48 b8 84 0d 80 00 00 	movabs $0x800d84,%rax
+  802c1c:	00 00 00 
+  802c1f:	ff d0                	call   *%rax
+    return 0;
+}
+  802c21:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c26:	5d                   	pop    %rbp
+  802c27:	c3                   	ret
+
+0000000000802c28 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  802c28:	55                   	push   %rbp
+  802c29:	48 89 e5             	mov    %rsp,%rbp
+  802c2c:	41 57                	push   %r15
+  802c2e:	41 56                	push   %r14
+  802c30:	41 55                	push   %r13
+  802c32:	41 54                	push   %r12
+  802c34:	53                   	push   %rbx
+  802c35:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  802c3c:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  802c43:	48 85 d2             	test   %rdx,%rdx
+  802c46:	74 7a                	je     802cc2 <devcons_write+0x9a>
+  802c48:	49 89 d6             	mov    %rdx,%r14
+  802c4b:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802c51:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  802c56:	49 bf 7e 0f 80 00 00 	movabs $0x800f7e,%r15
+  802c5d:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  802c60:	4c 89 f3             	mov    %r14,%rbx
+  802c63:	48 29 f3             	sub    %rsi,%rbx
+  802c66:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802c6b:	48 39 c3             	cmp    %rax,%rbx
+  802c6e:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  802c72:	4c 63 eb             	movslq %ebx,%r13
+  802c75:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  802c7c:	48 01 c6             	add    %rax,%rsi
+  802c7f:	4c 89 ea             	mov    %r13,%rdx
+  802c82:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802c89:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  802c8c:	4c 89 ee             	mov    %r13,%rsi
+  802c8f:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802c96:	48 b8 ab 11 80 00 00 	movabs $0x8011ab,%rax
+  802c9d:	00 00 00 
+  802ca0:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  802ca2:	41 01 dc             	add    %ebx,%r12d
+  802ca5:	49 63 f4             	movslq %r12d,%rsi
+  802ca8:	4c 39 f6             	cmp    %r14,%rsi
+  802cab:	72 b3                	jb     802c60 <devcons_write+0x38>
+    return res;
+  802cad:	49 63 c4             	movslq %r12d,%rax
+}
+  802cb0:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  802cb7:	5b                   	pop    %rbx
+  802cb8:	41 5c                	pop    %r12
+  802cba:	41 5d                	pop    %r13
+  802cbc:	41 5e                	pop    %r14
+  802cbe:	41 5f                	pop    %r15
+  802cc0:	5d                   	pop    %rbp
+  802cc1:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  802cc2:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802cc8:	eb e3                	jmp    802cad <devcons_write+0x85>
+
+0000000000802cca <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  802cca:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  802ccd:	ba 00 00 00 00       	mov    $0x0,%edx
+  802cd2:	48 85 c0             	test   %rax,%rax
+  802cd5:	74 55                	je     802d2c <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  802cd7:	55                   	push   %rbp
+  802cd8:	48 89 e5             	mov    %rsp,%rbp
+  802cdb:	41 55                	push   %r13
+  802cdd:	41 54                	push   %r12
+  802cdf:	53                   	push   %rbx
+  802ce0:	48 83 ec 08          	sub    $0x8,%rsp
+  802ce4:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  802ce7:	48 bb d8 11 80 00 00 	movabs $0x8011d8,%rbx
+  802cee:	00 00 00 
+  802cf1:	49 bc a5 12 80 00 00 	movabs $0x8012a5,%r12
+  802cf8:	00 00 00 
+  802cfb:	eb 03                	jmp    802d00 <devcons_read+0x36>
+  802cfd:	41 ff d4             	call   *%r12
+  802d00:	ff d3                	call   *%rbx
+  802d02:	85 c0                	test   %eax,%eax
+  802d04:	74 f7                	je     802cfd <devcons_read+0x33>
+    if (c < 0) return c;
+  802d06:	48 63 d0             	movslq %eax,%rdx
+  802d09:	78 13                	js     802d1e <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  802d0b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802d10:	83 f8 04             	cmp    $0x4,%eax
+  802d13:	74 09                	je     802d1e <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  802d15:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  802d19:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  802d1e:	48 89 d0             	mov    %rdx,%rax
+  802d21:	48 83 c4 08          	add    $0x8,%rsp
+  802d25:	5b                   	pop    %rbx
+  802d26:	41 5c                	pop    %r12
+  802d28:	41 5d                	pop    %r13
+  802d2a:	5d                   	pop    %rbp
+  802d2b:	c3                   	ret
+  802d2c:	48 89 d0             	mov    %rdx,%rax
+  802d2f:	c3                   	ret
+
+0000000000802d30 <cputchar>:
+cputchar(int ch) {
+  802d30:	55                   	push   %rbp
+  802d31:	48 89 e5             	mov    %rsp,%rbp
+  802d34:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  802d38:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  802d3c:	be 01 00 00 00       	mov    $0x1,%esi
+  802d41:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  802d45:	48 b8 ab 11 80 00 00 	movabs $0x8011ab,%rax
+  802d4c:	00 00 00 
+  802d4f:	ff d0                	call   *%rax
+}
+  802d51:	c9                   	leave
+  802d52:	c3                   	ret
+
+0000000000802d53 <getchar>:
+getchar(void) {
+  802d53:	55                   	push   %rbp
+  802d54:	48 89 e5             	mov    %rsp,%rbp
+  802d57:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  802d5b:	ba 01 00 00 00       	mov    $0x1,%edx
+  802d60:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  802d64:	bf 00 00 00 00       	mov    $0x0,%edi
+  802d69:	48 b8 77 1c 80 00 00 	movabs $0x801c77,%rax
+  802d70:	00 00 00 
+  802d73:	ff d0                	call   *%rax
+  802d75:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  802d77:	85 c0                	test   %eax,%eax
+  802d79:	78 06                	js     802d81 <getchar+0x2e>
+  802d7b:	74 08                	je     802d85 <getchar+0x32>
+  802d7d:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  802d81:	89 d0                	mov    %edx,%eax
+  802d83:	c9                   	leave
+  802d84:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  802d85:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  802d8a:	eb f5                	jmp    802d81 <getchar+0x2e>
+
+0000000000802d8c <iscons>:
+iscons(int fdnum) {
+  802d8c:	55                   	push   %rbp
+  802d8d:	48 89 e5             	mov    %rsp,%rbp
+  802d90:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  802d94:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802d98:	48 b8 94 19 80 00 00 	movabs $0x801994,%rax
+  802d9f:	00 00 00 
+  802da2:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802da4:	85 c0                	test   %eax,%eax
+  802da6:	78 18                	js     802dc0 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  802da8:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802dac:	48 b8 a0 40 80 00 00 	movabs $0x8040a0,%rax
+  802db3:	00 00 00 
+  802db6:	8b 00                	mov    (%rax),%eax
+  802db8:	39 02                	cmp    %eax,(%rdx)
+  802dba:	0f 94 c0             	sete   %al
+  802dbd:	0f b6 c0             	movzbl %al,%eax
+}
+  802dc0:	c9                   	leave
+  802dc1:	c3                   	ret
+
+0000000000802dc2 <opencons>:
+opencons(void) {
+  802dc2:	55                   	push   %rbp
+  802dc3:	48 89 e5             	mov    %rsp,%rbp
+  802dc6:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802dca:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  802dce:	48 b8 7a 19 80 00 00 	movabs $0x80197a,%rax
+  802dd5:	00 00 00 
+  802dd8:	ff d0                	call   *%rax
+  802dda:	85 c0                	test   %eax,%eax
+  802ddc:	78 49                	js     802e27 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  802dde:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802de3:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802de8:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  802dec:	bf 00 00 00 00       	mov    $0x0,%edi
+  802df1:	48 b8 34 13 80 00 00 	movabs $0x801334,%rax
+  802df8:	00 00 00 
+  802dfb:	ff d0                	call   *%rax
+  802dfd:	85 c0                	test   %eax,%eax
+  802dff:	78 26                	js     802e27 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  802e01:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802e05:	a1 a0 40 80 00 00 00 	movabs 0x8040a0,%eax
+  802e0c:	00 00 
+  802e0e:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  802e10:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802e14:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  802e1b:	48 b8 d3 18 80 00 00 	movabs $0x8018d3,%rax
+  802e22:	00 00 00 
+  802e25:	ff d0                	call   *%rax
+}
+  802e27:	c9                   	leave
+  802e28:	c3                   	ret
+
+0000000000802e29 <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  802e29:	55                   	push   %rbp
+  802e2a:	48 89 e5             	mov    %rsp,%rbp
+  802e2d:	41 55                	push   %r13
+  802e2f:	41 54                	push   %r12
+  802e31:	53                   	push   %rbx
+  802e32:	48 83 ec 08          	sub    $0x8,%rsp
+  802e36:	49 89 fc             	mov    %rdi,%r12
+  802e39:	48 89 f7             	mov    %rsi,%rdi
+  802e3c:	48 89 d3             	mov    %rdx,%rbx
+  802e3f:	49 89 cd             	mov    %rcx,%r13
+    // LAB 9: Your code here:
+    int res = sys_ipc_recv(!pg ? (void*)MAX_USER_ADDRESS : pg, !size ? 0 : *size);
+  802e42:	be 00 00 00 00       	mov    $0x0,%esi
+  802e47:	48 85 d2             	test   %rdx,%rdx
+  802e4a:	74 03                	je     802e4f <ipc_recv+0x26>
+  802e4c:	48 8b 32             	mov    (%rdx),%rsi
+  802e4f:	48 85 ff             	test   %rdi,%rdi
+  802e52:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802e59:	00 00 00 
+  802e5c:	48 0f 44 f8          	cmove  %rax,%rdi
+  802e60:	48 b8 06 17 80 00 00 	movabs $0x801706,%rax
+  802e67:	00 00 00 
+  802e6a:	ff d0                	call   *%rax
+    if (res < 0) {
+  802e6c:	85 c0                	test   %eax,%eax
+  802e6e:	78 66                	js     802ed6 <ipc_recv+0xad>
+        if (size) {
+            *size = 0;
+        }
+        return res;
+    }
+    if (from_env_store) {
+  802e70:	4d 85 e4             	test   %r12,%r12
+  802e73:	74 14                	je     802e89 <ipc_recv+0x60>
+        *from_env_store = thisenv->env_ipc_from;
+  802e75:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  802e7c:	00 00 00 
+  802e7f:	8b 80 ac 01 00 00    	mov    0x1ac(%rax),%eax
+  802e85:	41 89 04 24          	mov    %eax,(%r12)
+    }
+    if (perm_store) {
+  802e89:	4d 85 ed             	test   %r13,%r13
+  802e8c:	74 14                	je     802ea2 <ipc_recv+0x79>
+        *perm_store = thisenv->env_ipc_perm;
+  802e8e:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  802e95:	00 00 00 
+  802e98:	8b 80 b0 01 00 00    	mov    0x1b0(%rax),%eax
+  802e9e:	41 89 45 00          	mov    %eax,0x0(%r13)
+    }
+    if (size) {
+  802ea2:	48 85 db             	test   %rbx,%rbx
+  802ea5:	74 14                	je     802ebb <ipc_recv+0x92>
+        *size = thisenv->env_ipc_maxsz;
+  802ea7:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  802eae:	00 00 00 
+  802eb1:	48 8b 80 a0 01 00 00 	mov    0x1a0(%rax),%rax
+  802eb8:	48 89 03             	mov    %rax,(%rbx)
+    }
+    return thisenv->env_ipc_value;
+  802ebb:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  802ec2:	00 00 00 
+  802ec5:	8b 80 a8 01 00 00    	mov    0x1a8(%rax),%eax
+}
+  802ecb:	48 83 c4 08          	add    $0x8,%rsp
+  802ecf:	5b                   	pop    %rbx
+  802ed0:	41 5c                	pop    %r12
+  802ed2:	41 5d                	pop    %r13
+  802ed4:	5d                   	pop    %rbp
+  802ed5:	c3                   	ret
+        if (from_env_store) {
+  802ed6:	4d 85 e4             	test   %r12,%r12
+  802ed9:	74 08                	je     802ee3 <ipc_recv+0xba>
+            *from_env_store = 0;
+  802edb:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  802ee2:	00 
+        if (perm_store) {
+  802ee3:	4d 85 ed             	test   %r13,%r13
+  802ee6:	74 08                	je     802ef0 <ipc_recv+0xc7>
+            *perm_store = 0;
+  802ee8:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  802eef:	00 
+        if (size) {
+  802ef0:	48 85 db             	test   %rbx,%rbx
+  802ef3:	74 d6                	je     802ecb <ipc_recv+0xa2>
+            *size = 0;
+  802ef5:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  802efc:	eb cd                	jmp    802ecb <ipc_recv+0xa2>
+
+0000000000802efe <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  802efe:	55                   	push   %rbp
+  802eff:	48 89 e5             	mov    %rsp,%rbp
+  802f02:	41 57                	push   %r15
+  802f04:	41 56                	push   %r14
+  802f06:	41 55                	push   %r13
+  802f08:	41 54                	push   %r12
+  802f0a:	53                   	push   %rbx
+  802f0b:	48 83 ec 18          	sub    $0x18,%rsp
+  802f0f:	41 89 fd             	mov    %edi,%r13d
+  802f12:	89 75 cc             	mov    %esi,-0x34(%rbp)
+  802f15:	49 89 cc             	mov    %rcx,%r12
+  802f18:	44 89 45 c8          	mov    %r8d,-0x38(%rbp)
+    // LAB 9: Your code here:
+    int res = 0;
+    while ((res = sys_ipc_try_send(to_env, val, !pg ? (void*)MAX_USER_ADDRESS : pg, size, perm)) < 0) {
+  802f1c:	48 85 d2             	test   %rdx,%rdx
+  802f1f:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802f26:	00 00 00 
+  802f29:	48 0f 45 c2          	cmovne %rdx,%rax
+  802f2d:	48 89 c3             	mov    %rax,%rbx
+  802f30:	49 be da 16 80 00 00 	movabs $0x8016da,%r14
+  802f37:	00 00 00 
+        if (res != -E_IPC_NOT_RECV) {
+            panic("sys_ipc_try_send failed: %i", res);
+        }
+        sys_yield();
+  802f3a:	49 bf a5 12 80 00 00 	movabs $0x8012a5,%r15
+  802f41:	00 00 00 
+    while ((res = sys_ipc_try_send(to_env, val, !pg ? (void*)MAX_USER_ADDRESS : pg, size, perm)) < 0) {
+  802f44:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  802f47:	44 8b 45 c8          	mov    -0x38(%rbp),%r8d
+  802f4b:	4c 89 e1             	mov    %r12,%rcx
+  802f4e:	48 89 da             	mov    %rbx,%rdx
+  802f51:	44 89 ef             	mov    %r13d,%edi
+  802f54:	41 ff d6             	call   *%r14
+  802f57:	85 c0                	test   %eax,%eax
+  802f59:	79 37                	jns    802f92 <ipc_send+0x94>
+        if (res != -E_IPC_NOT_RECV) {
+  802f5b:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  802f5e:	75 05                	jne    802f65 <ipc_send+0x67>
+        sys_yield();
+  802f60:	41 ff d7             	call   *%r15
+  802f63:	eb df                	jmp    802f44 <ipc_send+0x46>
+            panic("sys_ipc_try_send failed: %i", res);
+  802f65:	89 c1                	mov    %eax,%ecx
+  802f67:	48 ba 60 37 80 00 00 	movabs $0x803760,%rdx
+  802f6e:	00 00 00 
+  802f71:	be 40 00 00 00       	mov    $0x40,%esi
+  802f76:	48 bf 7c 37 80 00 00 	movabs $0x80377c,%rdi
+  802f7d:	00 00 00 
+  802f80:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f85:	49 b8 0f 03 80 00 00 	movabs $0x80030f,%r8
+  802f8c:	00 00 00 
+  802f8f:	41 ff d0             	call   *%r8
+    }
+    return;
+}
+  802f92:	48 83 c4 18          	add    $0x18,%rsp
+  802f96:	5b                   	pop    %rbx
+  802f97:	41 5c                	pop    %r12
+  802f99:	41 5d                	pop    %r13
+  802f9b:	41 5e                	pop    %r14
+  802f9d:	41 5f                	pop    %r15
+  802f9f:	5d                   	pop    %rbp
+  802fa0:	c3                   	ret
+
+0000000000802fa1 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  802fa1:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  802fa6:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  802fad:	00 00 00 
+  802fb0:	48 69 d0 d0 01 00 00 	imul   $0x1d0,%rax,%rdx
+  802fb7:	48 01 ca             	add    %rcx,%rdx
+  802fba:	8b 92 e8 00 00 00    	mov    0xe8(%rdx),%edx
+  802fc0:	39 fa                	cmp    %edi,%edx
+  802fc2:	74 12                	je     802fd6 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  802fc4:	48 83 c0 01          	add    $0x1,%rax
+  802fc8:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  802fce:	75 e0                	jne    802fb0 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  802fd0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802fd5:	c3                   	ret
+            return envs[i].env_id;
+  802fd6:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+  802fdd:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  802fe4:	00 00 00 
+  802fe7:	48 01 d0             	add    %rdx,%rax
+  802fea:	8b 80 e0 00 00 00    	mov    0xe0(%rax),%eax
+  802ff0:	c3                   	ret
+  802ff1:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000802ff8 <__rodata_start>:
+  802ff8:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  802ffa:	72 6b                	jb     803067 <__rodata_start+0x6f>
+  802ffc:	3a 20                	cmp    (%rax),%ah
+  802ffe:	25 69 00 75 73       	and    $0x73750069,%eax
+  803003:	65 72 2f             	gs jb  803035 <__rodata_start+0x3d>
+  803006:	73 63                	jae    80306b <__rodata_start+0x73>
+  803008:	68 65 64 62 65       	push   $0x65626465
+  80300d:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80300e:	63 68 2e             	movsxd 0x2e(%rax),%ebp
+  803011:	63 00                	movsxd (%rax),%eax
+  803013:	0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+  803018:	73 63                	jae    80307d <__rodata_start+0x85>
+  80301a:	68 65 64 62 65       	push   $0x65626465
+  80301f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803020:	63 68 3a             	movsxd 0x3a(%rax),%ebp
+  803023:	20 79 69             	and    %bh,0x69(%rcx)
+  803026:	65 6c                	gs insb (%dx),%es:(%rdi)
+  803028:	64 20 72 6f          	and    %dh,%fs:0x6f(%rdx)
+  80302c:	75 6e                	jne    80309c <__rodata_start+0xa4>
+  80302e:	64 20 74 72 69       	and    %dh,%fs:0x69(%rdx,%rsi,2)
+  803033:	70 20                	jo     803055 <__rodata_start+0x5d>
+  803035:	25 6c 75 20 63       	and    $0x6320756c,%eax
+  80303a:	79 63                	jns    80309f <__rodata_start+0xa7>
+  80303c:	6c                   	insb   (%dx),%es:(%rdi)
+  80303d:	65 73 20             	gs jae 803060 <__rodata_start+0x68>
+  803040:	61                   	(bad)
+  803041:	6c                   	insb   (%dx),%es:(%rdi)
+  803042:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803043:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803044:	65 2c 20             	gs sub $0x20,%al
+  803047:	25 6c 75 20 63       	and    $0x6320756c,%eax
+  80304c:	79 63                	jns    8030b1 <__rodata_start+0xb9>
+  80304e:	6c                   	insb   (%dx),%es:(%rdi)
+  80304f:	65 73 20             	gs jae 803072 <__rodata_start+0x7a>
+  803052:	77 69                	ja     8030bd <__rodata_start+0xc5>
+  803054:	74 68                	je     8030be <__rodata_start+0xc6>
+  803056:	20 25 6c 75 20 69    	and    %ah,0x6920756c(%rip)        # 69a0a5c8 <__bss_end+0x692015c8>
+  80305c:	64 6c                	fs insb (%dx),%es:(%rdi)
+  80305e:	65 20 65 6e          	and    %ah,%gs:0x6e(%rbp)
+  803062:	76 69                	jbe    8030cd <__rodata_start+0xd5>
+  803064:	72 6f                	jb     8030d5 <__rodata_start+0xdd>
+  803066:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803067:	6d                   	insl   (%dx),%es:(%rdi)
+  803068:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  80306a:	74 73                	je     8030df <__rodata_start+0xe7>
+  80306c:	0a 00                	or     (%rax),%al
+  80306e:	3c 75                	cmp    $0x75,%al
+  803070:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803071:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  803075:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803076:	3e 00 5b 25          	ds add %bl,0x25(%rbx)
+  80307a:	30 38                	xor    %bh,(%rax)
+  80307c:	78 5d                	js     8030db <__rodata_start+0xe3>
+  80307e:	20 75 73             	and    %dh,0x73(%rbp)
+  803081:	65 72 20             	gs jb  8030a4 <__rodata_start+0xac>
+  803084:	70 61                	jo     8030e7 <__rodata_start+0xef>
+  803086:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803087:	69 63 20 69 6e 20 25 	imul   $0x25206e69,0x20(%rbx),%esp
+  80308e:	73 20                	jae    8030b0 <__rodata_start+0xb8>
+  803090:	61                   	(bad)
+  803091:	74 20                	je     8030b3 <__rodata_start+0xbb>
+  803093:	25 73 3a 25 64       	and    $0x64253a73,%eax
+  803098:	3a 20                	cmp    (%rax),%ah
+  80309a:	00 30                	add    %dh,(%rax)
+  80309c:	31 32                	xor    %esi,(%rdx)
+  80309e:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  8030a5:	41                   	rex.B
+  8030a6:	42                   	rex.X
+  8030a7:	43                   	rex.XB
+  8030a8:	44                   	rex.R
+  8030a9:	45                   	rex.RB
+  8030aa:	46 00 30             	rex.RX add %r14b,(%rax)
+  8030ad:	31 32                	xor    %esi,(%rdx)
+  8030af:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  8030b6:	61                   	(bad)
+  8030b7:	62 63 64 65 66       	(bad)
+  8030bc:	00 28                	add    %ch,(%rax)
+  8030be:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8030bf:	75 6c                	jne    80312d <__rodata_start+0x135>
+  8030c1:	6c                   	insb   (%dx),%es:(%rdi)
+  8030c2:	29 00                	sub    %eax,(%rax)
+  8030c4:	65 72 72             	gs jb  803139 <__rodata_start+0x141>
+  8030c7:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8030c8:	72 20                	jb     8030ea <__rodata_start+0xf2>
+  8030ca:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  8030cf:	73 70                	jae    803141 <__rodata_start+0x149>
+  8030d1:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  8030d5:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  8030dc:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8030dd:	72 00                	jb     8030df <__rodata_start+0xe7>
+  8030df:	62 61 64 20 65       	(bad)
+  8030e4:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8030e5:	76 69                	jbe    803150 <__rodata_start+0x158>
+  8030e7:	72 6f                	jb     803158 <__rodata_start+0x160>
+  8030e9:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8030ea:	6d                   	insl   (%dx),%es:(%rdi)
+  8030eb:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  8030ed:	74 00                	je     8030ef <__rodata_start+0xf7>
+  8030ef:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  8030f6:	20 70 61             	and    %dh,0x61(%rax)
+  8030f9:	72 61                	jb     80315c <__rodata_start+0x164>
+  8030fb:	6d                   	insl   (%dx),%es:(%rdi)
+  8030fc:	65 74 65             	gs je  803164 <__rodata_start+0x16c>
+  8030ff:	72 00                	jb     803101 <__rodata_start+0x109>
+  803101:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803102:	75 74                	jne    803178 <__rodata_start+0x180>
+  803104:	20 6f 66             	and    %ch,0x66(%rdi)
+  803107:	20 6d 65             	and    %ch,0x65(%rbp)
+  80310a:	6d                   	insl   (%dx),%es:(%rdi)
+  80310b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80310c:	72 79                	jb     803187 <__rodata_start+0x18f>
+  80310e:	00 6f 75             	add    %ch,0x75(%rdi)
+  803111:	74 20                	je     803133 <__rodata_start+0x13b>
+  803113:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803114:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  803118:	76 69                	jbe    803183 <__rodata_start+0x18b>
+  80311a:	72 6f                	jb     80318b <__rodata_start+0x193>
+  80311c:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80311d:	6d                   	insl   (%dx),%es:(%rdi)
+  80311e:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803120:	74 73                	je     803195 <__rodata_start+0x19d>
+  803122:	00 63 6f             	add    %ah,0x6f(%rbx)
+  803125:	72 72                	jb     803199 <__rodata_start+0x1a1>
+  803127:	75 70                	jne    803199 <__rodata_start+0x1a1>
+  803129:	74 65                	je     803190 <__rodata_start+0x198>
+  80312b:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  803130:	75 67                	jne    803199 <__rodata_start+0x1a1>
+  803132:	20 69 6e             	and    %ch,0x6e(%rcx)
+  803135:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  803137:	00 73 65             	add    %dh,0x65(%rbx)
+  80313a:	67 6d                	insl   (%dx),%es:(%edi)
+  80313c:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  80313e:	74 61                	je     8031a1 <__rodata_start+0x1a9>
+  803140:	74 69                	je     8031ab <__rodata_start+0x1b3>
+  803142:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803143:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803144:	20 66 61             	and    %ah,0x61(%rsi)
+  803147:	75 6c                	jne    8031b5 <__rodata_start+0x1bd>
+  803149:	74 00                	je     80314b <__rodata_start+0x153>
+  80314b:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  803152:	20 45 4c             	and    %al,0x4c(%rbp)
+  803155:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  803159:	61                   	(bad)
+  80315a:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  80315f:	20 73 75             	and    %dh,0x75(%rbx)
+  803162:	63 68 20             	movsxd 0x20(%rax),%ebp
+  803165:	73 79                	jae    8031e0 <__rodata_start+0x1e8>
+  803167:	73 74                	jae    8031dd <__rodata_start+0x1e5>
+  803169:	65 6d                	gs insl (%dx),%es:(%rdi)
+  80316b:	20 63 61             	and    %ah,0x61(%rbx)
+  80316e:	6c                   	insb   (%dx),%es:(%rdi)
+  80316f:	6c                   	insb   (%dx),%es:(%rdi)
+  803170:	00 65 6e             	add    %ah,0x6e(%rbp)
+  803173:	74 72                	je     8031e7 <__rodata_start+0x1ef>
+  803175:	79 20                	jns    803197 <__rodata_start+0x19f>
+  803177:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803178:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803179:	74 20                	je     80319b <__rodata_start+0x1a3>
+  80317b:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  80317d:	75 6e                	jne    8031ed <__rodata_start+0x1f5>
+  80317f:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  803183:	76 20                	jbe    8031a5 <__rodata_start+0x1ad>
+  803185:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  80318c:	72 65                	jb     8031f3 <__rodata_start+0x1fb>
+  80318e:	63 76 69             	movsxd 0x69(%rsi),%esi
+  803191:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803192:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  803196:	65 78 70             	gs js  803209 <__rodata_start+0x211>
+  803199:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  80319e:	20 65 6e             	and    %ah,0x6e(%rbp)
+  8031a1:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  8031a5:	20 66 69             	and    %ah,0x69(%rsi)
+  8031a8:	6c                   	insb   (%dx),%es:(%rdi)
+  8031a9:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  8031ad:	20 66 72             	and    %ah,0x72(%rsi)
+  8031b0:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  8031b5:	61                   	(bad)
+  8031b6:	63 65 20             	movsxd 0x20(%rbp),%esp
+  8031b9:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8031ba:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8031bb:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  8031bf:	6b 00 74             	imul   $0x74,(%rax),%eax
+  8031c2:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8031c3:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8031c4:	20 6d 61             	and    %ch,0x61(%rbp)
+  8031c7:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8031c8:	79 20                	jns    8031ea <__rodata_start+0x1f2>
+  8031ca:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  8031d1:	72 65                	jb     803238 <__rodata_start+0x240>
+  8031d3:	20 6f 70             	and    %ch,0x70(%rdi)
+  8031d6:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  8031d8:	00 66 69             	add    %ah,0x69(%rsi)
+  8031db:	6c                   	insb   (%dx),%es:(%rdi)
+  8031dc:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  8031e0:	20 62 6c             	and    %ah,0x6c(%rdx)
+  8031e3:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8031e4:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  8031e7:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8031e8:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8031e9:	74 20                	je     80320b <__rodata_start+0x213>
+  8031eb:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  8031ed:	75 6e                	jne    80325d <__rodata_start+0x265>
+  8031ef:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  8031f3:	76 61                	jbe    803256 <__rodata_start+0x25e>
+  8031f5:	6c                   	insb   (%dx),%es:(%rdi)
+  8031f6:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  8031fd:	00 
+  8031fe:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  803205:	72 65                	jb     80326c <__rodata_start+0x274>
+  803207:	61                   	(bad)
+  803208:	64 79 20             	fs jns 80322b <__rodata_start+0x233>
+  80320b:	65 78 69             	gs js  803277 <__rodata_start+0x27f>
+  80320e:	73 74                	jae    803284 <__rodata_start+0x28c>
+  803210:	73 00                	jae    803212 <__rodata_start+0x21a>
+  803212:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803213:	70 65                	jo     80327a <__rodata_start+0x282>
+  803215:	72 61                	jb     803278 <__rodata_start+0x280>
+  803217:	74 69                	je     803282 <__rodata_start+0x28a>
+  803219:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80321a:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80321b:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  80321e:	74 20                	je     803240 <__rodata_start+0x248>
+  803220:	73 75                	jae    803297 <__rodata_start+0x29f>
+  803222:	70 70                	jo     803294 <__rodata_start+0x29c>
+  803224:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803225:	72 74                	jb     80329b <__rodata_start+0x2a3>
+  803227:	65 64 00 6f 70       	gs add %ch,%fs:0x70(%rdi)
+  80322c:	65 72 61             	gs jb  803290 <__rodata_start+0x298>
+  80322f:	74 69                	je     80329a <__rodata_start+0x2a2>
+  803231:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803232:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803233:	20 69 6e             	and    %ch,0x6e(%rcx)
+  803236:	74 65                	je     80329d <__rodata_start+0x2a5>
+  803238:	72 72                	jb     8032ac <__rodata_start+0x2b4>
+  80323a:	75 70                	jne    8032ac <__rodata_start+0x2b4>
+  80323c:	74 65                	je     8032a3 <__rodata_start+0x2ab>
+  80323e:	64 00 6e 6f          	add    %ch,%fs:0x6f(%rsi)
+  803242:	74 20                	je     803264 <__rodata_start+0x26c>
+  803244:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803246:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803247:	75 67                	jne    8032b0 <__rodata_start+0x2b8>
+  803249:	68 20 43 50 55       	push   $0x55504320
+  80324e:	20 74 69 6d          	and    %dh,0x6d(%rcx,%rbp,2)
+  803252:	65 00 66 2e          	add    %ah,%gs:0x2e(%rsi)
+  803256:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+  80325d:	00 
+  80325e:	66 90                	xchg   %ax,%ax
+  803260:	4c 06                	rex.WR (bad)
+  803262:	80 00 00             	addb   $0x0,(%rax)
+  803265:	00 00                	add    %al,(%rax)
+  803267:	00 8d 0c 80 00 00    	add    %cl,0x800c(%rbp)
+  80326d:	00 00                	add    %al,(%rax)
+  80326f:	00 7d 0c             	add    %bh,0xc(%rbp)
+  803272:	80 00 00             	addb   $0x0,(%rax)
+  803275:	00 00                	add    %al,(%rax)
+  803277:	00 8d 0c 80 00 00    	add    %cl,0x800c(%rbp)
+  80327d:	00 00                	add    %al,(%rax)
+  80327f:	00 8d 0c 80 00 00    	add    %cl,0x800c(%rbp)
+  803285:	00 00                	add    %al,(%rax)
+  803287:	00 8d 0c 80 00 00    	add    %cl,0x800c(%rbp)
+  80328d:	00 00                	add    %al,(%rax)
+  80328f:	00 8d 0c 80 00 00    	add    %cl,0x800c(%rbp)
+  803295:	00 00                	add    %al,(%rax)
+  803297:	00 6b 06             	add    %ch,0x6(%rbx)
+  80329a:	80 00 00             	addb   $0x0,(%rax)
+  80329d:	00 00                	add    %al,(%rax)
+  80329f:	00 8d 0c 80 00 00    	add    %cl,0x800c(%rbp)
+  8032a5:	00 00                	add    %al,(%rax)
+  8032a7:	00 8d 0c 80 00 00    	add    %cl,0x800c(%rbp)
+  8032ad:	00 00                	add    %al,(%rax)
+  8032af:	00 5f 06             	add    %bl,0x6(%rdi)
+  8032b2:	80 00 00             	addb   $0x0,(%rax)
+  8032b5:	00 00                	add    %al,(%rax)
+  8032b7:	00 d9                	add    %bl,%cl
+  8032b9:	06                   	(bad)
+  8032ba:	80 00 00             	addb   $0x0,(%rax)
+  8032bd:	00 00                	add    %al,(%rax)
+  8032bf:	00 8d 0c 80 00 00    	add    %cl,0x800c(%rbp)
+  8032c5:	00 00                	add    %al,(%rax)
+  8032c7:	00 5f 06             	add    %bl,0x6(%rdi)
+  8032ca:	80 00 00             	addb   $0x0,(%rax)
+  8032cd:	00 00                	add    %al,(%rax)
+  8032cf:	00 a5 06 80 00 00    	add    %ah,0x8006(%rbp)
+  8032d5:	00 00                	add    %al,(%rax)
+  8032d7:	00 a5 06 80 00 00    	add    %ah,0x8006(%rbp)
+  8032dd:	00 00                	add    %al,(%rax)
+  8032df:	00 a5 06 80 00 00    	add    %ah,0x8006(%rbp)
+  8032e5:	00 00                	add    %al,(%rax)
+  8032e7:	00 a5 06 80 00 00    	add    %ah,0x8006(%rbp)
+  8032ed:	00 00                	add    %al,(%rax)
+  8032ef:	00 a5 06 80 00 00    	add    %ah,0x8006(%rbp)
+  8032f5:	00 00                	add    %al,(%rax)
+  8032f7:	00 a5 06 80 00 00    	add    %ah,0x8006(%rbp)
+  8032fd:	00 00                	add    %al,(%rax)
+  8032ff:	00 a5 06 80 00 00    	add    %ah,0x8006(%rbp)
+  803305:	00 00                	add    %al,(%rax)
+  803307:	00 a5 06 80 00 00    	add    %ah,0x8006(%rbp)
+  80330d:	00 00                	add    %al,(%rax)
+  80330f:	00 a5 06 80 00 00    	add    %ah,0x8006(%rbp)
+  803315:	00 00                	add    %al,(%rax)
+  803317:	00 8d 0c 80 00 00    	add    %cl,0x800c(%rbp)
+  80331d:	00 00                	add    %al,(%rax)
+  80331f:	00 8d 0c 80 00 00    	add    %cl,0x800c(%rbp)
+  803325:	00 00                	add    %al,(%rax)
+  803327:	00 8d 0c 80 00 00    	add    %cl,0x800c(%rbp)
+  80332d:	00 00                	add    %al,(%rax)
+  80332f:	00 8d 0c 80 00 00    	add    %cl,0x800c(%rbp)
+  803335:	00 00                	add    %al,(%rax)
+  803337:	00 8d 0c 80 00 00    	add    %cl,0x800c(%rbp)
+  80333d:	00 00                	add    %al,(%rax)
+  80333f:	00 8d 0c 80 00 00    	add    %cl,0x800c(%rbp)
+  803345:	00 00                	add    %al,(%rax)
+  803347:	00 8d 0c 80 00 00    	add    %cl,0x800c(%rbp)
+  80334d:	00 00                	add    %al,(%rax)
+  80334f:	00 8d 0c 80 00 00    	add    %cl,0x800c(%rbp)
+  803355:	00 00                	add    %al,(%rax)
+  803357:	00 8d 0c 80 00 00    	add    %cl,0x800c(%rbp)
+  80335d:	00 00                	add    %al,(%rax)
+  80335f:	00 8d 0c 80 00 00    	add    %cl,0x800c(%rbp)
+  803365:	00 00                	add    %al,(%rax)
+  803367:	00 8d 0c 80 00 00    	add    %cl,0x800c(%rbp)
+  80336d:	00 00                	add    %al,(%rax)
+  80336f:	00 8d 0c 80 00 00    	add    %cl,0x800c(%rbp)
+  803375:	00 00                	add    %al,(%rax)
+  803377:	00 8d 0c 80 00 00    	add    %cl,0x800c(%rbp)
+  80337d:	00 00                	add    %al,(%rax)
+  80337f:	00 8d 0c 80 00 00    	add    %cl,0x800c(%rbp)
+  803385:	00 00                	add    %al,(%rax)
+  803387:	00 8d 0c 80 00 00    	add    %cl,0x800c(%rbp)
+  80338d:	00 00                	add    %al,(%rax)
+  80338f:	00 8d 0c 80 00 00    	add    %cl,0x800c(%rbp)
+  803395:	00 00                	add    %al,(%rax)
+  803397:	00 8d 0c 80 00 00    	add    %cl,0x800c(%rbp)
+  80339d:	00 00                	add    %al,(%rax)
+  80339f:	00 8d 0c 80 00 00    	add    %cl,0x800c(%rbp)
+  8033a5:	00 00                	add    %al,(%rax)
+  8033a7:	00 8d 0c 80 00 00    	add    %cl,0x800c(%rbp)
+  8033ad:	00 00                	add    %al,(%rax)
+  8033af:	00 8d 0c 80 00 00    	add    %cl,0x800c(%rbp)
+  8033b5:	00 00                	add    %al,(%rax)
+  8033b7:	00 8d 0c 80 00 00    	add    %cl,0x800c(%rbp)
+  8033bd:	00 00                	add    %al,(%rax)
+  8033bf:	00 8d 0c 80 00 00    	add    %cl,0x800c(%rbp)
+  8033c5:	00 00                	add    %al,(%rax)
+  8033c7:	00 8d 0c 80 00 00    	add    %cl,0x800c(%rbp)
+  8033cd:	00 00                	add    %al,(%rax)
+  8033cf:	00 8d 0c 80 00 00    	add    %cl,0x800c(%rbp)
+  8033d5:	00 00                	add    %al,(%rax)
+  8033d7:	00 8d 0c 80 00 00    	add    %cl,0x800c(%rbp)
+  8033dd:	00 00                	add    %al,(%rax)
+  8033df:	00 8d 0c 80 00 00    	add    %cl,0x800c(%rbp)
+  8033e5:	00 00                	add    %al,(%rax)
+  8033e7:	00 8d 0c 80 00 00    	add    %cl,0x800c(%rbp)
+  8033ed:	00 00                	add    %al,(%rax)
+  8033ef:	00 8d 0c 80 00 00    	add    %cl,0x800c(%rbp)
+  8033f5:	00 00                	add    %al,(%rax)
+  8033f7:	00 8d 0c 80 00 00    	add    %cl,0x800c(%rbp)
+  8033fd:	00 00                	add    %al,(%rax)
+  8033ff:	00 8d 0c 80 00 00    	add    %cl,0x800c(%rbp)
+  803405:	00 00                	add    %al,(%rax)
+  803407:	00 b0 0b 80 00 00    	add    %dh,0x800b(%rax)
+  80340d:	00 00                	add    %al,(%rax)
+  80340f:	00 8d 0c 80 00 00    	add    %cl,0x800c(%rbp)
+  803415:	00 00                	add    %al,(%rax)
+  803417:	00 8d 0c 80 00 00    	add    %cl,0x800c(%rbp)
+  80341d:	00 00                	add    %al,(%rax)
+  80341f:	00 8d 0c 80 00 00    	add    %cl,0x800c(%rbp)
+  803425:	00 00                	add    %al,(%rax)
+  803427:	00 8d 0c 80 00 00    	add    %cl,0x800c(%rbp)
+  80342d:	00 00                	add    %al,(%rax)
+  80342f:	00 8d 0c 80 00 00    	add    %cl,0x800c(%rbp)
+  803435:	00 00                	add    %al,(%rax)
+  803437:	00 8d 0c 80 00 00    	add    %cl,0x800c(%rbp)
+  80343d:	00 00                	add    %al,(%rax)
+  80343f:	00 8d 0c 80 00 00    	add    %cl,0x800c(%rbp)
+  803445:	00 00                	add    %al,(%rax)
+  803447:	00 8d 0c 80 00 00    	add    %cl,0x800c(%rbp)
+  80344d:	00 00                	add    %al,(%rax)
+  80344f:	00 8d 0c 80 00 00    	add    %cl,0x800c(%rbp)
+  803455:	00 00                	add    %al,(%rax)
+  803457:	00 8d 0c 80 00 00    	add    %cl,0x800c(%rbp)
+  80345d:	00 00                	add    %al,(%rax)
+  80345f:	00 fc                	add    %bh,%ah
+  803461:	06                   	(bad)
+  803462:	80 00 00             	addb   $0x0,(%rax)
+  803465:	00 00                	add    %al,(%rax)
+  803467:	00 cb                	add    %cl,%bl
+  803469:	08 80 00 00 00 00    	or     %al,0x0(%rax)
+  80346f:	00 8d 0c 80 00 00    	add    %cl,0x800c(%rbp)
+  803475:	00 00                	add    %al,(%rax)
+  803477:	00 8d 0c 80 00 00    	add    %cl,0x800c(%rbp)
+  80347d:	00 00                	add    %al,(%rax)
+  80347f:	00 8d 0c 80 00 00    	add    %cl,0x800c(%rbp)
+  803485:	00 00                	add    %al,(%rax)
+  803487:	00 8d 0c 80 00 00    	add    %cl,0x800c(%rbp)
+  80348d:	00 00                	add    %al,(%rax)
+  80348f:	00 2b                	add    %ch,(%rbx)
+  803491:	07                   	(bad)
+  803492:	80 00 00             	addb   $0x0,(%rax)
+  803495:	00 00                	add    %al,(%rax)
+  803497:	00 8d 0c 80 00 00    	add    %cl,0x800c(%rbp)
+  80349d:	00 00                	add    %al,(%rax)
+  80349f:	00 8d 0c 80 00 00    	add    %cl,0x800c(%rbp)
+  8034a5:	00 00                	add    %al,(%rax)
+  8034a7:	00 f1                	add    %dh,%cl
+  8034a9:	06                   	(bad)
+  8034aa:	80 00 00             	addb   $0x0,(%rax)
+  8034ad:	00 00                	add    %al,(%rax)
+  8034af:	00 8d 0c 80 00 00    	add    %cl,0x800c(%rbp)
+  8034b5:	00 00                	add    %al,(%rax)
+  8034b7:	00 8d 0c 80 00 00    	add    %cl,0x800c(%rbp)
+  8034bd:	00 00                	add    %al,(%rax)
+  8034bf:	00 73 0a             	add    %dh,0xa(%rbx)
+  8034c2:	80 00 00             	addb   $0x0,(%rax)
+  8034c5:	00 00                	add    %al,(%rax)
+  8034c7:	00 3d 0b 80 00 00    	add    %bh,0x800b(%rip)        # 80b4d8 <__bss_end+0x24d8>
+  8034cd:	00 00                	add    %al,(%rax)
+  8034cf:	00 8d 0c 80 00 00    	add    %cl,0x800c(%rbp)
+  8034d5:	00 00                	add    %al,(%rax)
+  8034d7:	00 8d 0c 80 00 00    	add    %cl,0x800c(%rbp)
+  8034dd:	00 00                	add    %al,(%rax)
+  8034df:	00 c2                	add    %al,%dl
+  8034e1:	07                   	(bad)
+  8034e2:	80 00 00             	addb   $0x0,(%rax)
+  8034e5:	00 00                	add    %al,(%rax)
+  8034e7:	00 8d 0c 80 00 00    	add    %cl,0x800c(%rbp)
+  8034ed:	00 00                	add    %al,(%rax)
+  8034ef:	00 9f 09 80 00 00    	add    %bl,0x8009(%rdi)
+  8034f5:	00 00                	add    %al,(%rax)
+  8034f7:	00 8d 0c 80 00 00    	add    %cl,0x800c(%rbp)
+  8034fd:	00 00                	add    %al,(%rax)
+  8034ff:	00 8d 0c 80 00 00    	add    %cl,0x800c(%rbp)
+  803505:	00 00                	add    %al,(%rax)
+  803507:	00 b0 0b 80 00 00    	add    %dh,0x800b(%rax)
+  80350d:	00 00                	add    %al,(%rax)
+  80350f:	00 8d 0c 80 00 00    	add    %cl,0x800c(%rbp)
+  803515:	00 00                	add    %al,(%rax)
+  803517:	00 55 06             	add    %dl,0x6(%rbp)
+  80351a:	80 00 00             	addb   $0x0,(%rax)
+  80351d:	00 00                	add    %al,(%rax)
+	...
+
+0000000000803520 <error_string>:
+	...
+  803528:	cd 30 80 00 00 00 00 00 df 30 80 00 00 00 00 00     .0.......0......
+  803538:	ef 30 80 00 00 00 00 00 01 31 80 00 00 00 00 00     .0.......1......
+  803548:	0f 31 80 00 00 00 00 00 23 31 80 00 00 00 00 00     .1......#1......
+  803558:	38 31 80 00 00 00 00 00 4b 31 80 00 00 00 00 00     81......K1......
+  803568:	5d 31 80 00 00 00 00 00 71 31 80 00 00 00 00 00     ]1......q1......
+  803578:	81 31 80 00 00 00 00 00 94 31 80 00 00 00 00 00     .1.......1......
+  803588:	ab 31 80 00 00 00 00 00 c1 31 80 00 00 00 00 00     .1.......1......
+  803598:	d9 31 80 00 00 00 00 00 f1 31 80 00 00 00 00 00     .1.......1......
+  8035a8:	fe 31 80 00 00 00 00 00 d0 35 80 00 00 00 00 00     .1.......5......
+  8035b8:	12 32 80 00 00 00 00 00 2a 32 80 00 00 00 00 00     .2......*2......
+  8035c8:	40 32 80 00 00 00 00 00 66 69 6c 65 20 69 73 20     @2......file is 
+  8035d8:	6e 6f 74 20 61 20 76 61 6c 69 64 20 65 78 65 63     not a valid exec
+  8035e8:	75 74 61 62 6c 65 00 90 73 79 73 63 61 6c 6c 20     utable..syscall 
+  8035f8:	25 7a 64 20 72 65 74 75 72 6e 65 64 20 25 7a 64     %zd returned %zd
+  803608:	20 28 3e 20 30 29 00 6c 69 62 2f 73 79 73 63 61      (> 0).lib/sysca
+  803618:	6c 6c 2e 63 00 46 6f 72 6b 20 64 6f 75 62 6c 65     ll.c.Fork double
+  803628:	20 66 61 75 6c 74 00 6c 69 62 2f 66 6f 72 6b 2e      fault.lib/fork.
+  803638:	63 00 73 66 6f 72 6b 28 29 20 69 73 20 6e 6f 74     c.sfork() is not
+  803648:	20 69 6d 70 6c 65 6d 65 6e 74 65 64 00 0f 1f 00      implemented....
+  803658:	5b 25 30 38 78 5d 20 75 6e 6b 6e 6f 77 6e 20 64     [%08x] unknown d
+  803668:	65 76 69 63 65 20 74 79 70 65 20 25 64 0a 00 00     evice type %d...
+  803678:	5b 25 30 38 78 5d 20 66 74 72 75 6e 63 61 74 65     [%08x] ftruncate
+  803688:	20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65 0a      %d -- bad mode.
+  803698:	00 5b 25 30 38 78 5d 20 72 65 61 64 20 25 64 20     .[%08x] read %d 
+  8036a8:	2d 2d 20 62 61 64 20 6d 6f 64 65 0a 00 5b 25 30     -- bad mode..[%0
+  8036b8:	38 78 5d 20 77 72 69 74 65 20 25 64 20 2d 2d 20     8x] write %d -- 
+  8036c8:	62 61 64 20 6d 6f 64 65 0a 00 66 2e 0f 1f 84 00     bad mode..f.....
+  8036d8:	00 00 00 00 0f 1f 40 00                             ......@.
+
+00000000008036e0 <devtab>:
+  8036e0:	20 40 80 00 00 00 00 00 60 40 80 00 00 00 00 00      @......`@......
+  8036f0:	a0 40 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .@..............
+  803700:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  803710:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  803720:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  803730:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  803740:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  803750:	3d 20 32 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73 00     = 2.<cons>.cons.
+  803760:	73 79 73 5f 69 70 63 5f 74 72 79 5f 73 65 6e 64     sys_ipc_try_send
+  803770:	20 66 61 69 6c 65 64 3a 20 25 69 00 6c 69 62 2f      failed: %i.lib/
+  803780:	69 70 63 2e 63 00 66 2e 0f 1f 84 00 00 00 00 00     ipc.c.f.........
+  803790:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8037a0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8037b0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8037c0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8037d0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8037e0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8037f0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803800:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803810:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803820:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803830:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803840:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803850:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803860:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803870:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803880:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803890:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8038a0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8038b0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8038c0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8038d0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8038e0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8038f0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803900:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803910:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803920:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803930:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803940:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803950:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803960:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803970:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803980:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803990:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8039a0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8039b0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8039c0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8039d0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8039e0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8039f0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803a00:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803a10:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803a20:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803a30:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803a40:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803a50:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803a60:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803a70:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803a80:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803a90:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803aa0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803ab0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803ac0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803ad0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803ae0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803af0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803b00:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803b10:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803b20:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803b30:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803b40:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803b50:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803b60:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803b70:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803b80:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803b90:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803ba0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803bb0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803bc0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803bd0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803be0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803bf0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803c00:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803c10:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803c20:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803c30:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803c40:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803c50:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803c60:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803c70:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803c80:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803c90:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803ca0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803cb0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803cc0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803cd0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803ce0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803cf0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803d00:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803d10:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803d20:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803d30:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803d40:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803d50:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803d60:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803d70:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803d80:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803d90:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803da0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803db0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803dc0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803dd0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803de0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803df0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803e00:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803e10:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803e20:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803e30:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803e40:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803e50:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803e60:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803e70:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803e80:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803e90:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803ea0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803eb0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803ec0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803ed0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803ee0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803ef0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803f00:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803f10:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803f20:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803f30:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803f40:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803f50:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803f60:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803f70:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803f80:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803f90:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803fa0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803fb0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803fc0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803fd0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803fe0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803ff0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
@@ -0,0 +1,5711 @@
+
+obj/user/signedoverflow:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 28 00 00 00       	call   80004b <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+/* Test for UBSAN support - signed integer overflow */
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+    /* Creating a 32-bit integer variable with the maximum integer value it can contain */
+    int a = 2147483647;
+    /* Trying to add 1 to the "a" variable and print its contents (which causes undefined behavior). */
+    /* The "cprintf" function is sanitized by UBSAN because lib/Makefrag accesses the USER_SAN_CFLAGS variable. */
+    cprintf("%d\n", a + 1);
+  800029:	be 00 00 00 80       	mov    $0x80000000,%esi
+  80002e:	48 bf 98 2c 80 00 00 	movabs $0x802c98,%rdi
+  800035:	00 00 00 
+  800038:	b8 00 00 00 00       	mov    $0x0,%eax
+  80003d:	48 ba c4 01 80 00 00 	movabs $0x8001c4,%rdx
+  800044:	00 00 00 
+  800047:	ff d2                	call   *%rdx
+}
+  800049:	5d                   	pop    %rbp
+  80004a:	c3                   	ret
+
+000000000080004b <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  80004b:	55                   	push   %rbp
+  80004c:	48 89 e5             	mov    %rsp,%rbp
+  80004f:	41 56                	push   %r14
+  800051:	41 55                	push   %r13
+  800053:	41 54                	push   %r12
+  800055:	53                   	push   %rbx
+  800056:	41 89 fd             	mov    %edi,%r13d
+  800059:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  80005c:	48 ba d8 40 80 00 00 	movabs $0x8040d8,%rdx
+  800063:	00 00 00 
+  800066:	48 b8 d8 40 80 00 00 	movabs $0x8040d8,%rax
+  80006d:	00 00 00 
+  800070:	48 39 c2             	cmp    %rax,%rdx
+  800073:	73 17                	jae    80008c <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  800075:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  800078:	49 89 c4             	mov    %rax,%r12
+  80007b:	48 83 c3 08          	add    $0x8,%rbx
+  80007f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800084:	ff 53 f8             	call   *-0x8(%rbx)
+  800087:	4c 39 e3             	cmp    %r12,%rbx
+  80008a:	72 ef                	jb     80007b <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+    envid_t this_env_id = sys_getenvid();
+  80008c:	48 b8 d9 0f 80 00 00 	movabs $0x800fd9,%rax
+  800093:	00 00 00 
+  800096:	ff d0                	call   *%rax
+    thisenv = &((struct Env*)UENVS)[ENVX(this_env_id)];
+  800098:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80009d:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+  8000a4:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8000ab:	00 00 00 
+  8000ae:	48 01 d0             	add    %rdx,%rax
+  8000b1:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  8000b8:	00 00 00 
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8000bb:	45 85 ed             	test   %r13d,%r13d
+  8000be:	7e 0d                	jle    8000cd <libmain+0x82>
+  8000c0:	49 8b 06             	mov    (%r14),%rax
+  8000c3:	48 a3 00 40 80 00 00 	movabs %rax,0x804000
+  8000ca:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8000cd:	4c 89 f6             	mov    %r14,%rsi
+  8000d0:	44 89 ef             	mov    %r13d,%edi
+  8000d3:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8000da:	00 00 00 
+  8000dd:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8000df:	48 b8 f4 00 80 00 00 	movabs $0x8000f4,%rax
+  8000e6:	00 00 00 
+  8000e9:	ff d0                	call   *%rax
+#endif
+}
+  8000eb:	5b                   	pop    %rbx
+  8000ec:	41 5c                	pop    %r12
+  8000ee:	41 5d                	pop    %r13
+  8000f0:	41 5e                	pop    %r14
+  8000f2:	5d                   	pop    %rbp
+  8000f3:	c3                   	ret
+
+00000000008000f4 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8000f4:	55                   	push   %rbp
+  8000f5:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  8000f8:	48 b8 2d 17 80 00 00 	movabs $0x80172d,%rax
+  8000ff:	00 00 00 
+  800102:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  800104:	bf 00 00 00 00       	mov    $0x0,%edi
+  800109:	48 b8 6e 0f 80 00 00 	movabs $0x800f6e,%rax
+  800110:	00 00 00 
+  800113:	ff d0                	call   *%rax
+}
+  800115:	5d                   	pop    %rbp
+  800116:	c3                   	ret
+
+0000000000800117 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  800117:	55                   	push   %rbp
+  800118:	48 89 e5             	mov    %rsp,%rbp
+  80011b:	53                   	push   %rbx
+  80011c:	48 83 ec 08          	sub    $0x8,%rsp
+  800120:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  800123:	8b 06                	mov    (%rsi),%eax
+  800125:	8d 50 01             	lea    0x1(%rax),%edx
+  800128:	89 16                	mov    %edx,(%rsi)
+  80012a:	48 98                	cltq
+  80012c:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  800131:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  800137:	74 0a                	je     800143 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  800139:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  80013d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800141:	c9                   	leave
+  800142:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  800143:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  800147:	be ff 00 00 00       	mov    $0xff,%esi
+  80014c:	48 b8 10 0f 80 00 00 	movabs $0x800f10,%rax
+  800153:	00 00 00 
+  800156:	ff d0                	call   *%rax
+        state->offset = 0;
+  800158:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  80015e:	eb d9                	jmp    800139 <putch+0x22>
+
+0000000000800160 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  800160:	55                   	push   %rbp
+  800161:	48 89 e5             	mov    %rsp,%rbp
+  800164:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  80016b:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  80016e:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  800175:	b9 21 00 00 00       	mov    $0x21,%ecx
+  80017a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80017f:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  800182:	48 89 f1             	mov    %rsi,%rcx
+  800185:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  80018c:	48 bf 17 01 80 00 00 	movabs $0x800117,%rdi
+  800193:	00 00 00 
+  800196:	48 b8 14 03 80 00 00 	movabs $0x800314,%rax
+  80019d:	00 00 00 
+  8001a0:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  8001a2:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  8001a9:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  8001b0:	48 b8 10 0f 80 00 00 	movabs $0x800f10,%rax
+  8001b7:	00 00 00 
+  8001ba:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  8001bc:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  8001c2:	c9                   	leave
+  8001c3:	c3                   	ret
+
+00000000008001c4 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  8001c4:	55                   	push   %rbp
+  8001c5:	48 89 e5             	mov    %rsp,%rbp
+  8001c8:	48 83 ec 50          	sub    $0x50,%rsp
+  8001cc:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8001d0:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8001d4:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8001d8:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8001dc:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  8001e0:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  8001e7:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8001eb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8001ef:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8001f3:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  8001f7:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  8001fb:	48 b8 60 01 80 00 00 	movabs $0x800160,%rax
+  800202:	00 00 00 
+  800205:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  800207:	c9                   	leave
+  800208:	c3                   	ret
+
+0000000000800209 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  800209:	55                   	push   %rbp
+  80020a:	48 89 e5             	mov    %rsp,%rbp
+  80020d:	41 57                	push   %r15
+  80020f:	41 56                	push   %r14
+  800211:	41 55                	push   %r13
+  800213:	41 54                	push   %r12
+  800215:	53                   	push   %rbx
+  800216:	48 83 ec 18          	sub    $0x18,%rsp
+  80021a:	49 89 fc             	mov    %rdi,%r12
+  80021d:	49 89 f5             	mov    %rsi,%r13
+  800220:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800224:	8b 45 10             	mov    0x10(%rbp),%eax
+  800227:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  80022a:	41 89 cf             	mov    %ecx,%r15d
+  80022d:	4c 39 fa             	cmp    %r15,%rdx
+  800230:	73 5b                	jae    80028d <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  800232:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  800236:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  80023a:	85 db                	test   %ebx,%ebx
+  80023c:	7e 0e                	jle    80024c <print_num+0x43>
+            putch(padc, put_arg);
+  80023e:	4c 89 ee             	mov    %r13,%rsi
+  800241:	44 89 f7             	mov    %r14d,%edi
+  800244:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  800247:	83 eb 01             	sub    $0x1,%ebx
+  80024a:	75 f2                	jne    80023e <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  80024c:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  800250:	48 b9 b7 2c 80 00 00 	movabs $0x802cb7,%rcx
+  800257:	00 00 00 
+  80025a:	48 b8 a6 2c 80 00 00 	movabs $0x802ca6,%rax
+  800261:	00 00 00 
+  800264:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  800268:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80026c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800271:	49 f7 f7             	div    %r15
+  800274:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  800278:	4c 89 ee             	mov    %r13,%rsi
+  80027b:	41 ff d4             	call   *%r12
+}
+  80027e:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800282:	5b                   	pop    %rbx
+  800283:	41 5c                	pop    %r12
+  800285:	41 5d                	pop    %r13
+  800287:	41 5e                	pop    %r14
+  800289:	41 5f                	pop    %r15
+  80028b:	5d                   	pop    %rbp
+  80028c:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  80028d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800291:	ba 00 00 00 00       	mov    $0x0,%edx
+  800296:	49 f7 f7             	div    %r15
+  800299:	48 83 ec 08          	sub    $0x8,%rsp
+  80029d:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  8002a1:	52                   	push   %rdx
+  8002a2:	45 0f be c9          	movsbl %r9b,%r9d
+  8002a6:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  8002aa:	48 89 c2             	mov    %rax,%rdx
+  8002ad:	48 b8 09 02 80 00 00 	movabs $0x800209,%rax
+  8002b4:	00 00 00 
+  8002b7:	ff d0                	call   *%rax
+  8002b9:	48 83 c4 10          	add    $0x10,%rsp
+  8002bd:	eb 8d                	jmp    80024c <print_num+0x43>
+
+00000000008002bf <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  8002bf:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  8002c3:	48 8b 06             	mov    (%rsi),%rax
+  8002c6:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  8002ca:	73 0a                	jae    8002d6 <sprintputch+0x17>
+        *state->start++ = ch;
+  8002cc:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8002d0:	48 89 16             	mov    %rdx,(%rsi)
+  8002d3:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  8002d6:	c3                   	ret
+
+00000000008002d7 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  8002d7:	55                   	push   %rbp
+  8002d8:	48 89 e5             	mov    %rsp,%rbp
+  8002db:	48 83 ec 50          	sub    $0x50,%rsp
+  8002df:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8002e3:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8002e7:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  8002eb:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8002f2:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8002f6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8002fa:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8002fe:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  800302:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800306:	48 b8 14 03 80 00 00 	movabs $0x800314,%rax
+  80030d:	00 00 00 
+  800310:	ff d0                	call   *%rax
+}
+  800312:	c9                   	leave
+  800313:	c3                   	ret
+
+0000000000800314 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  800314:	55                   	push   %rbp
+  800315:	48 89 e5             	mov    %rsp,%rbp
+  800318:	41 57                	push   %r15
+  80031a:	41 56                	push   %r14
+  80031c:	41 55                	push   %r13
+  80031e:	41 54                	push   %r12
+  800320:	53                   	push   %rbx
+  800321:	48 83 ec 38          	sub    $0x38,%rsp
+  800325:	49 89 fe             	mov    %rdi,%r14
+  800328:	49 89 f5             	mov    %rsi,%r13
+  80032b:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  80032e:	48 8b 01             	mov    (%rcx),%rax
+  800331:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  800335:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800339:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80033d:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  800341:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  800345:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  800349:	0f b6 3b             	movzbl (%rbx),%edi
+  80034c:	40 80 ff 25          	cmp    $0x25,%dil
+  800350:	74 18                	je     80036a <vprintfmt+0x56>
+            if (!ch) return;
+  800352:	40 84 ff             	test   %dil,%dil
+  800355:	0f 84 b1 06 00 00    	je     800a0c <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  80035b:	40 0f b6 ff          	movzbl %dil,%edi
+  80035f:	4c 89 ee             	mov    %r13,%rsi
+  800362:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  800365:	4c 89 e3             	mov    %r12,%rbx
+  800368:	eb db                	jmp    800345 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  80036a:	be 00 00 00 00       	mov    $0x0,%esi
+  80036f:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  800373:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  800378:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  80037e:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  800385:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800389:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  80038e:	41 0f b6 04 24       	movzbl (%r12),%eax
+  800393:	88 45 a0             	mov    %al,-0x60(%rbp)
+  800396:	83 e8 23             	sub    $0x23,%eax
+  800399:	3c 57                	cmp    $0x57,%al
+  80039b:	0f 87 51 06 00 00    	ja     8009f2 <vprintfmt+0x6de>
+  8003a1:	0f b6 c0             	movzbl %al,%eax
+  8003a4:	48 b9 60 2e 80 00 00 	movabs $0x802e60,%rcx
+  8003ab:	00 00 00 
+  8003ae:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  8003b1:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  8003b4:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  8003b8:	eb cf                	jmp    800389 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  8003ba:	49 89 dc             	mov    %rbx,%r12
+  8003bd:	be 01 00 00 00       	mov    $0x1,%esi
+  8003c2:	eb c5                	jmp    800389 <vprintfmt+0x75>
+            padc = ch;
+  8003c4:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  8003c8:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8003cb:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8003ce:	eb b9                	jmp    800389 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8003d0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8003d3:	83 f8 2f             	cmp    $0x2f,%eax
+  8003d6:	77 24                	ja     8003fc <vprintfmt+0xe8>
+  8003d8:	89 c1                	mov    %eax,%ecx
+  8003da:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  8003de:	83 c0 08             	add    $0x8,%eax
+  8003e1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8003e4:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  8003e7:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  8003ea:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8003ee:	79 99                	jns    800389 <vprintfmt+0x75>
+                width = precision;
+  8003f0:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  8003f4:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8003fa:	eb 8d                	jmp    800389 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8003fc:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  800400:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  800404:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800408:	eb da                	jmp    8003e4 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  80040a:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  80040f:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800413:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  800419:	3c 39                	cmp    $0x39,%al
+  80041b:	77 1c                	ja     800439 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  80041d:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  800421:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  800425:	0f b6 c0             	movzbl %al,%eax
+  800428:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  80042d:	0f b6 03             	movzbl (%rbx),%eax
+  800430:	3c 39                	cmp    $0x39,%al
+  800432:	76 e9                	jbe    80041d <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  800434:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  800437:	eb b1                	jmp    8003ea <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  800439:	49 89 dc             	mov    %rbx,%r12
+  80043c:	eb ac                	jmp    8003ea <vprintfmt+0xd6>
+            width = MAX(0, width);
+  80043e:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  800441:	85 c9                	test   %ecx,%ecx
+  800443:	b8 00 00 00 00       	mov    $0x0,%eax
+  800448:	0f 49 c1             	cmovns %ecx,%eax
+  80044b:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  80044e:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800451:	e9 33 ff ff ff       	jmp    800389 <vprintfmt+0x75>
+            lflag++;
+  800456:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  800459:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80045c:	e9 28 ff ff ff       	jmp    800389 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  800461:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800464:	83 f8 2f             	cmp    $0x2f,%eax
+  800467:	77 19                	ja     800482 <vprintfmt+0x16e>
+  800469:	89 c2                	mov    %eax,%edx
+  80046b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80046f:	83 c0 08             	add    $0x8,%eax
+  800472:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800475:	8b 3a                	mov    (%rdx),%edi
+  800477:	4c 89 ee             	mov    %r13,%rsi
+  80047a:	41 ff d6             	call   *%r14
+            break;
+  80047d:	e9 c3 fe ff ff       	jmp    800345 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  800482:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800486:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80048a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80048e:	eb e5                	jmp    800475 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  800490:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800493:	83 f8 2f             	cmp    $0x2f,%eax
+  800496:	77 5a                	ja     8004f2 <vprintfmt+0x1de>
+  800498:	89 c2                	mov    %eax,%edx
+  80049a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80049e:	83 c0 08             	add    $0x8,%eax
+  8004a1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  8004a4:	8b 02                	mov    (%rdx),%eax
+  8004a6:	89 c1                	mov    %eax,%ecx
+  8004a8:	f7 d9                	neg    %ecx
+  8004aa:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  8004ad:	83 f9 15             	cmp    $0x15,%ecx
+  8004b0:	7f 4e                	jg     800500 <vprintfmt+0x1ec>
+  8004b2:	48 63 c1             	movslq %ecx,%rax
+  8004b5:	48 ba 20 31 80 00 00 	movabs $0x803120,%rdx
+  8004bc:	00 00 00 
+  8004bf:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8004c3:	48 85 c0             	test   %rax,%rax
+  8004c6:	74 38                	je     800500 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  8004c8:	48 89 c1             	mov    %rax,%rcx
+  8004cb:	48 ba d9 32 80 00 00 	movabs $0x8032d9,%rdx
+  8004d2:	00 00 00 
+  8004d5:	4c 89 ee             	mov    %r13,%rsi
+  8004d8:	4c 89 f7             	mov    %r14,%rdi
+  8004db:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004e0:	49 b8 d7 02 80 00 00 	movabs $0x8002d7,%r8
+  8004e7:	00 00 00 
+  8004ea:	41 ff d0             	call   *%r8
+  8004ed:	e9 53 fe ff ff       	jmp    800345 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  8004f2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8004f6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8004fa:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8004fe:	eb a4                	jmp    8004a4 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  800500:	48 ba cf 2c 80 00 00 	movabs $0x802ccf,%rdx
+  800507:	00 00 00 
+  80050a:	4c 89 ee             	mov    %r13,%rsi
+  80050d:	4c 89 f7             	mov    %r14,%rdi
+  800510:	b8 00 00 00 00       	mov    $0x0,%eax
+  800515:	49 b8 d7 02 80 00 00 	movabs $0x8002d7,%r8
+  80051c:	00 00 00 
+  80051f:	41 ff d0             	call   *%r8
+  800522:	e9 1e fe ff ff       	jmp    800345 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800527:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80052a:	83 f8 2f             	cmp    $0x2f,%eax
+  80052d:	77 6c                	ja     80059b <vprintfmt+0x287>
+  80052f:	89 c2                	mov    %eax,%edx
+  800531:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800535:	83 c0 08             	add    $0x8,%eax
+  800538:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80053b:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  80053e:	48 85 d2             	test   %rdx,%rdx
+  800541:	48 b8 c8 2c 80 00 00 	movabs $0x802cc8,%rax
+  800548:	00 00 00 
+  80054b:	48 0f 45 c2          	cmovne %rdx,%rax
+  80054f:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  800553:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800557:	7e 06                	jle    80055f <vprintfmt+0x24b>
+  800559:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  80055d:	75 4a                	jne    8005a9 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  80055f:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800563:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  800567:	0f b6 00             	movzbl (%rax),%eax
+  80056a:	84 c0                	test   %al,%al
+  80056c:	0f 85 9a 00 00 00    	jne    80060c <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  800572:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800575:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  800579:	85 c0                	test   %eax,%eax
+  80057b:	0f 8e c4 fd ff ff    	jle    800345 <vprintfmt+0x31>
+  800581:	4c 89 ee             	mov    %r13,%rsi
+  800584:	bf 20 00 00 00       	mov    $0x20,%edi
+  800589:	41 ff d6             	call   *%r14
+  80058c:	41 83 ec 01          	sub    $0x1,%r12d
+  800590:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  800594:	75 eb                	jne    800581 <vprintfmt+0x26d>
+  800596:	e9 aa fd ff ff       	jmp    800345 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  80059b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80059f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8005a3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8005a7:	eb 92                	jmp    80053b <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  8005a9:	49 63 f7             	movslq %r15d,%rsi
+  8005ac:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  8005b0:	48 b8 c6 0a 80 00 00 	movabs $0x800ac6,%rax
+  8005b7:	00 00 00 
+  8005ba:	ff d0                	call   *%rax
+  8005bc:	48 89 c2             	mov    %rax,%rdx
+  8005bf:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8005c2:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  8005c4:	8d 70 ff             	lea    -0x1(%rax),%esi
+  8005c7:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  8005ca:	85 c0                	test   %eax,%eax
+  8005cc:	7e 91                	jle    80055f <vprintfmt+0x24b>
+  8005ce:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  8005d3:	4c 89 ee             	mov    %r13,%rsi
+  8005d6:	44 89 e7             	mov    %r12d,%edi
+  8005d9:	41 ff d6             	call   *%r14
+  8005dc:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8005e0:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8005e3:	83 f8 ff             	cmp    $0xffffffff,%eax
+  8005e6:	75 eb                	jne    8005d3 <vprintfmt+0x2bf>
+  8005e8:	e9 72 ff ff ff       	jmp    80055f <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8005ed:	0f b6 f8             	movzbl %al,%edi
+  8005f0:	4c 89 ee             	mov    %r13,%rsi
+  8005f3:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8005f6:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8005fa:	49 83 c4 01          	add    $0x1,%r12
+  8005fe:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  800604:	84 c0                	test   %al,%al
+  800606:	0f 84 66 ff ff ff    	je     800572 <vprintfmt+0x25e>
+  80060c:	45 85 ff             	test   %r15d,%r15d
+  80060f:	78 0a                	js     80061b <vprintfmt+0x307>
+  800611:	41 83 ef 01          	sub    $0x1,%r15d
+  800615:	0f 88 57 ff ff ff    	js     800572 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  80061b:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  80061f:	74 cc                	je     8005ed <vprintfmt+0x2d9>
+  800621:	8d 50 e0             	lea    -0x20(%rax),%edx
+  800624:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800629:	80 fa 5e             	cmp    $0x5e,%dl
+  80062c:	77 c2                	ja     8005f0 <vprintfmt+0x2dc>
+  80062e:	eb bd                	jmp    8005ed <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  800630:	40 84 f6             	test   %sil,%sil
+  800633:	75 26                	jne    80065b <vprintfmt+0x347>
+    switch (lflag) {
+  800635:	85 d2                	test   %edx,%edx
+  800637:	74 59                	je     800692 <vprintfmt+0x37e>
+  800639:	83 fa 01             	cmp    $0x1,%edx
+  80063c:	74 7b                	je     8006b9 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  80063e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800641:	83 f8 2f             	cmp    $0x2f,%eax
+  800644:	0f 87 96 00 00 00    	ja     8006e0 <vprintfmt+0x3cc>
+  80064a:	89 c2                	mov    %eax,%edx
+  80064c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800650:	83 c0 08             	add    $0x8,%eax
+  800653:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800656:	4c 8b 22             	mov    (%rdx),%r12
+  800659:	eb 17                	jmp    800672 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  80065b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80065e:	83 f8 2f             	cmp    $0x2f,%eax
+  800661:	77 21                	ja     800684 <vprintfmt+0x370>
+  800663:	89 c2                	mov    %eax,%edx
+  800665:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800669:	83 c0 08             	add    $0x8,%eax
+  80066c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80066f:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  800672:	4d 85 e4             	test   %r12,%r12
+  800675:	78 7a                	js     8006f1 <vprintfmt+0x3dd>
+            num = i;
+  800677:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  80067a:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  80067f:	e9 50 02 00 00       	jmp    8008d4 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800684:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800688:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80068c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800690:	eb dd                	jmp    80066f <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  800692:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800695:	83 f8 2f             	cmp    $0x2f,%eax
+  800698:	77 11                	ja     8006ab <vprintfmt+0x397>
+  80069a:	89 c2                	mov    %eax,%edx
+  80069c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8006a0:	83 c0 08             	add    $0x8,%eax
+  8006a3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8006a6:	4c 63 22             	movslq (%rdx),%r12
+  8006a9:	eb c7                	jmp    800672 <vprintfmt+0x35e>
+  8006ab:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8006af:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006b3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006b7:	eb ed                	jmp    8006a6 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  8006b9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006bc:	83 f8 2f             	cmp    $0x2f,%eax
+  8006bf:	77 11                	ja     8006d2 <vprintfmt+0x3be>
+  8006c1:	89 c2                	mov    %eax,%edx
+  8006c3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8006c7:	83 c0 08             	add    $0x8,%eax
+  8006ca:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8006cd:	4c 8b 22             	mov    (%rdx),%r12
+  8006d0:	eb a0                	jmp    800672 <vprintfmt+0x35e>
+  8006d2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8006d6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006da:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006de:	eb ed                	jmp    8006cd <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  8006e0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8006e4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006e8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006ec:	e9 65 ff ff ff       	jmp    800656 <vprintfmt+0x342>
+                putch('-', put_arg);
+  8006f1:	4c 89 ee             	mov    %r13,%rsi
+  8006f4:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  8006f9:	41 ff d6             	call   *%r14
+                i = -i;
+  8006fc:	49 f7 dc             	neg    %r12
+  8006ff:	e9 73 ff ff ff       	jmp    800677 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  800704:	40 84 f6             	test   %sil,%sil
+  800707:	75 32                	jne    80073b <vprintfmt+0x427>
+    switch (lflag) {
+  800709:	85 d2                	test   %edx,%edx
+  80070b:	74 5d                	je     80076a <vprintfmt+0x456>
+  80070d:	83 fa 01             	cmp    $0x1,%edx
+  800710:	0f 84 82 00 00 00    	je     800798 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  800716:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800719:	83 f8 2f             	cmp    $0x2f,%eax
+  80071c:	0f 87 a5 00 00 00    	ja     8007c7 <vprintfmt+0x4b3>
+  800722:	89 c2                	mov    %eax,%edx
+  800724:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800728:	83 c0 08             	add    $0x8,%eax
+  80072b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80072e:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800731:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  800736:	e9 99 01 00 00       	jmp    8008d4 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  80073b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80073e:	83 f8 2f             	cmp    $0x2f,%eax
+  800741:	77 19                	ja     80075c <vprintfmt+0x448>
+  800743:	89 c2                	mov    %eax,%edx
+  800745:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800749:	83 c0 08             	add    $0x8,%eax
+  80074c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80074f:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800752:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800757:	e9 78 01 00 00       	jmp    8008d4 <vprintfmt+0x5c0>
+  80075c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800760:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800764:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800768:	eb e5                	jmp    80074f <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  80076a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80076d:	83 f8 2f             	cmp    $0x2f,%eax
+  800770:	77 18                	ja     80078a <vprintfmt+0x476>
+  800772:	89 c2                	mov    %eax,%edx
+  800774:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800778:	83 c0 08             	add    $0x8,%eax
+  80077b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80077e:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800780:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  800785:	e9 4a 01 00 00       	jmp    8008d4 <vprintfmt+0x5c0>
+  80078a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80078e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800792:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800796:	eb e6                	jmp    80077e <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  800798:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80079b:	83 f8 2f             	cmp    $0x2f,%eax
+  80079e:	77 19                	ja     8007b9 <vprintfmt+0x4a5>
+  8007a0:	89 c2                	mov    %eax,%edx
+  8007a2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007a6:	83 c0 08             	add    $0x8,%eax
+  8007a9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007ac:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8007af:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  8007b4:	e9 1b 01 00 00       	jmp    8008d4 <vprintfmt+0x5c0>
+  8007b9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007bd:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007c1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007c5:	eb e5                	jmp    8007ac <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  8007c7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007cb:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007cf:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007d3:	e9 56 ff ff ff       	jmp    80072e <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  8007d8:	40 84 f6             	test   %sil,%sil
+  8007db:	75 2e                	jne    80080b <vprintfmt+0x4f7>
+    switch (lflag) {
+  8007dd:	85 d2                	test   %edx,%edx
+  8007df:	74 59                	je     80083a <vprintfmt+0x526>
+  8007e1:	83 fa 01             	cmp    $0x1,%edx
+  8007e4:	74 7f                	je     800865 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  8007e6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007e9:	83 f8 2f             	cmp    $0x2f,%eax
+  8007ec:	0f 87 9f 00 00 00    	ja     800891 <vprintfmt+0x57d>
+  8007f2:	89 c2                	mov    %eax,%edx
+  8007f4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007f8:	83 c0 08             	add    $0x8,%eax
+  8007fb:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007fe:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800801:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  800806:	e9 c9 00 00 00       	jmp    8008d4 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  80080b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80080e:	83 f8 2f             	cmp    $0x2f,%eax
+  800811:	77 19                	ja     80082c <vprintfmt+0x518>
+  800813:	89 c2                	mov    %eax,%edx
+  800815:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800819:	83 c0 08             	add    $0x8,%eax
+  80081c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80081f:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800822:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800827:	e9 a8 00 00 00       	jmp    8008d4 <vprintfmt+0x5c0>
+  80082c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800830:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800834:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800838:	eb e5                	jmp    80081f <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  80083a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80083d:	83 f8 2f             	cmp    $0x2f,%eax
+  800840:	77 15                	ja     800857 <vprintfmt+0x543>
+  800842:	89 c2                	mov    %eax,%edx
+  800844:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800848:	83 c0 08             	add    $0x8,%eax
+  80084b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80084e:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  800850:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  800855:	eb 7d                	jmp    8008d4 <vprintfmt+0x5c0>
+  800857:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80085b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80085f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800863:	eb e9                	jmp    80084e <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  800865:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800868:	83 f8 2f             	cmp    $0x2f,%eax
+  80086b:	77 16                	ja     800883 <vprintfmt+0x56f>
+  80086d:	89 c2                	mov    %eax,%edx
+  80086f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800873:	83 c0 08             	add    $0x8,%eax
+  800876:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800879:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  80087c:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  800881:	eb 51                	jmp    8008d4 <vprintfmt+0x5c0>
+  800883:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800887:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80088b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80088f:	eb e8                	jmp    800879 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  800891:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800895:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800899:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80089d:	e9 5c ff ff ff       	jmp    8007fe <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  8008a2:	4c 89 ee             	mov    %r13,%rsi
+  8008a5:	bf 30 00 00 00       	mov    $0x30,%edi
+  8008aa:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  8008ad:	4c 89 ee             	mov    %r13,%rsi
+  8008b0:	bf 78 00 00 00       	mov    $0x78,%edi
+  8008b5:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  8008b8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008bb:	83 f8 2f             	cmp    $0x2f,%eax
+  8008be:	77 47                	ja     800907 <vprintfmt+0x5f3>
+  8008c0:	89 c2                	mov    %eax,%edx
+  8008c2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008c6:	83 c0 08             	add    $0x8,%eax
+  8008c9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008cc:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8008cf:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  8008d4:	48 83 ec 08          	sub    $0x8,%rsp
+  8008d8:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  8008dc:	0f 94 c0             	sete   %al
+  8008df:	0f b6 c0             	movzbl %al,%eax
+  8008e2:	50                   	push   %rax
+  8008e3:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  8008e8:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  8008ec:	4c 89 ee             	mov    %r13,%rsi
+  8008ef:	4c 89 f7             	mov    %r14,%rdi
+  8008f2:	48 b8 09 02 80 00 00 	movabs $0x800209,%rax
+  8008f9:	00 00 00 
+  8008fc:	ff d0                	call   *%rax
+            break;
+  8008fe:	48 83 c4 10          	add    $0x10,%rsp
+  800902:	e9 3e fa ff ff       	jmp    800345 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800907:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80090b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80090f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800913:	eb b7                	jmp    8008cc <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  800915:	40 84 f6             	test   %sil,%sil
+  800918:	75 2b                	jne    800945 <vprintfmt+0x631>
+    switch (lflag) {
+  80091a:	85 d2                	test   %edx,%edx
+  80091c:	74 56                	je     800974 <vprintfmt+0x660>
+  80091e:	83 fa 01             	cmp    $0x1,%edx
+  800921:	74 7f                	je     8009a2 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800923:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800926:	83 f8 2f             	cmp    $0x2f,%eax
+  800929:	0f 87 a2 00 00 00    	ja     8009d1 <vprintfmt+0x6bd>
+  80092f:	89 c2                	mov    %eax,%edx
+  800931:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800935:	83 c0 08             	add    $0x8,%eax
+  800938:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80093b:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  80093e:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800943:	eb 8f                	jmp    8008d4 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800945:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800948:	83 f8 2f             	cmp    $0x2f,%eax
+  80094b:	77 19                	ja     800966 <vprintfmt+0x652>
+  80094d:	89 c2                	mov    %eax,%edx
+  80094f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800953:	83 c0 08             	add    $0x8,%eax
+  800956:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800959:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  80095c:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800961:	e9 6e ff ff ff       	jmp    8008d4 <vprintfmt+0x5c0>
+  800966:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80096a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80096e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800972:	eb e5                	jmp    800959 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800974:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800977:	83 f8 2f             	cmp    $0x2f,%eax
+  80097a:	77 18                	ja     800994 <vprintfmt+0x680>
+  80097c:	89 c2                	mov    %eax,%edx
+  80097e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800982:	83 c0 08             	add    $0x8,%eax
+  800985:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800988:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  80098a:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  80098f:	e9 40 ff ff ff       	jmp    8008d4 <vprintfmt+0x5c0>
+  800994:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800998:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80099c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009a0:	eb e6                	jmp    800988 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  8009a2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009a5:	83 f8 2f             	cmp    $0x2f,%eax
+  8009a8:	77 19                	ja     8009c3 <vprintfmt+0x6af>
+  8009aa:	89 c2                	mov    %eax,%edx
+  8009ac:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009b0:	83 c0 08             	add    $0x8,%eax
+  8009b3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009b6:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8009b9:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  8009be:	e9 11 ff ff ff       	jmp    8008d4 <vprintfmt+0x5c0>
+  8009c3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009c7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009cb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009cf:	eb e5                	jmp    8009b6 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  8009d1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009d5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009d9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009dd:	e9 59 ff ff ff       	jmp    80093b <vprintfmt+0x627>
+            putch(ch, put_arg);
+  8009e2:	4c 89 ee             	mov    %r13,%rsi
+  8009e5:	bf 25 00 00 00       	mov    $0x25,%edi
+  8009ea:	41 ff d6             	call   *%r14
+            break;
+  8009ed:	e9 53 f9 ff ff       	jmp    800345 <vprintfmt+0x31>
+            putch('%', put_arg);
+  8009f2:	4c 89 ee             	mov    %r13,%rsi
+  8009f5:	bf 25 00 00 00       	mov    $0x25,%edi
+  8009fa:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  8009fd:	48 83 eb 01          	sub    $0x1,%rbx
+  800a01:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800a05:	75 f6                	jne    8009fd <vprintfmt+0x6e9>
+  800a07:	e9 39 f9 ff ff       	jmp    800345 <vprintfmt+0x31>
+}
+  800a0c:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800a10:	5b                   	pop    %rbx
+  800a11:	41 5c                	pop    %r12
+  800a13:	41 5d                	pop    %r13
+  800a15:	41 5e                	pop    %r14
+  800a17:	41 5f                	pop    %r15
+  800a19:	5d                   	pop    %rbp
+  800a1a:	c3                   	ret
+
+0000000000800a1b <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800a1b:	55                   	push   %rbp
+  800a1c:	48 89 e5             	mov    %rsp,%rbp
+  800a1f:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800a23:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800a27:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800a2c:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800a30:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800a37:	48 85 ff             	test   %rdi,%rdi
+  800a3a:	74 2b                	je     800a67 <vsnprintf+0x4c>
+  800a3c:	48 85 f6             	test   %rsi,%rsi
+  800a3f:	74 26                	je     800a67 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800a41:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800a45:	48 bf bf 02 80 00 00 	movabs $0x8002bf,%rdi
+  800a4c:	00 00 00 
+  800a4f:	48 b8 14 03 80 00 00 	movabs $0x800314,%rax
+  800a56:	00 00 00 
+  800a59:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800a5b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800a5f:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800a62:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800a65:	c9                   	leave
+  800a66:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800a67:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800a6c:	eb f7                	jmp    800a65 <vsnprintf+0x4a>
+
+0000000000800a6e <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800a6e:	55                   	push   %rbp
+  800a6f:	48 89 e5             	mov    %rsp,%rbp
+  800a72:	48 83 ec 50          	sub    $0x50,%rsp
+  800a76:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800a7a:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800a7e:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800a82:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800a89:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800a8d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a91:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800a95:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800a99:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800a9d:	48 b8 1b 0a 80 00 00 	movabs $0x800a1b,%rax
+  800aa4:	00 00 00 
+  800aa7:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800aa9:	c9                   	leave
+  800aaa:	c3                   	ret
+
+0000000000800aab <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800aab:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800aae:	74 10                	je     800ac0 <strlen+0x15>
+    size_t n = 0;
+  800ab0:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800ab5:	48 83 c0 01          	add    $0x1,%rax
+  800ab9:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800abd:	75 f6                	jne    800ab5 <strlen+0xa>
+  800abf:	c3                   	ret
+    size_t n = 0;
+  800ac0:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800ac5:	c3                   	ret
+
+0000000000800ac6 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800ac6:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800ac9:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800ace:	48 85 f6             	test   %rsi,%rsi
+  800ad1:	74 11                	je     800ae4 <strnlen+0x1e>
+  800ad3:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800ad7:	74 0c                	je     800ae5 <strnlen+0x1f>
+  800ad9:	48 83 c2 01          	add    $0x1,%rdx
+  800add:	48 39 d0             	cmp    %rdx,%rax
+  800ae0:	75 f1                	jne    800ad3 <strnlen+0xd>
+  800ae2:	eb 04                	jmp    800ae8 <strnlen+0x22>
+  800ae4:	c3                   	ret
+  800ae5:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800ae8:	c3                   	ret
+
+0000000000800ae9 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800ae9:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800aec:	ba 00 00 00 00       	mov    $0x0,%edx
+  800af1:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800af5:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800af8:	48 83 c2 01          	add    $0x1,%rdx
+  800afc:	84 c9                	test   %cl,%cl
+  800afe:	75 f1                	jne    800af1 <strcpy+0x8>
+        ;
+    return res;
+}
+  800b00:	c3                   	ret
+
+0000000000800b01 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800b01:	55                   	push   %rbp
+  800b02:	48 89 e5             	mov    %rsp,%rbp
+  800b05:	41 54                	push   %r12
+  800b07:	53                   	push   %rbx
+  800b08:	48 89 fb             	mov    %rdi,%rbx
+  800b0b:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800b0e:	48 b8 ab 0a 80 00 00 	movabs $0x800aab,%rax
+  800b15:	00 00 00 
+  800b18:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800b1a:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800b1e:	4c 89 e6             	mov    %r12,%rsi
+  800b21:	48 b8 e9 0a 80 00 00 	movabs $0x800ae9,%rax
+  800b28:	00 00 00 
+  800b2b:	ff d0                	call   *%rax
+    return dst;
+}
+  800b2d:	48 89 d8             	mov    %rbx,%rax
+  800b30:	5b                   	pop    %rbx
+  800b31:	41 5c                	pop    %r12
+  800b33:	5d                   	pop    %rbp
+  800b34:	c3                   	ret
+
+0000000000800b35 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800b35:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800b38:	48 85 d2             	test   %rdx,%rdx
+  800b3b:	74 1f                	je     800b5c <strncpy+0x27>
+  800b3d:	48 01 fa             	add    %rdi,%rdx
+  800b40:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800b43:	48 83 c1 01          	add    $0x1,%rcx
+  800b47:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800b4b:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800b4f:	41 80 f8 01          	cmp    $0x1,%r8b
+  800b53:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800b57:	48 39 ca             	cmp    %rcx,%rdx
+  800b5a:	75 e7                	jne    800b43 <strncpy+0xe>
+    }
+    return ret;
+}
+  800b5c:	c3                   	ret
+
+0000000000800b5d <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800b5d:	48 89 f8             	mov    %rdi,%rax
+  800b60:	48 85 d2             	test   %rdx,%rdx
+  800b63:	74 24                	je     800b89 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800b65:	48 83 ea 01          	sub    $0x1,%rdx
+  800b69:	74 1b                	je     800b86 <strlcpy+0x29>
+  800b6b:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800b6f:	0f b6 16             	movzbl (%rsi),%edx
+  800b72:	84 d2                	test   %dl,%dl
+  800b74:	74 10                	je     800b86 <strlcpy+0x29>
+            *dst++ = *src++;
+  800b76:	48 83 c6 01          	add    $0x1,%rsi
+  800b7a:	48 83 c0 01          	add    $0x1,%rax
+  800b7e:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800b81:	48 39 c8             	cmp    %rcx,%rax
+  800b84:	75 e9                	jne    800b6f <strlcpy+0x12>
+        *dst = '\0';
+  800b86:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800b89:	48 29 f8             	sub    %rdi,%rax
+}
+  800b8c:	c3                   	ret
+
+0000000000800b8d <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800b8d:	0f b6 07             	movzbl (%rdi),%eax
+  800b90:	84 c0                	test   %al,%al
+  800b92:	74 13                	je     800ba7 <strcmp+0x1a>
+  800b94:	38 06                	cmp    %al,(%rsi)
+  800b96:	75 0f                	jne    800ba7 <strcmp+0x1a>
+  800b98:	48 83 c7 01          	add    $0x1,%rdi
+  800b9c:	48 83 c6 01          	add    $0x1,%rsi
+  800ba0:	0f b6 07             	movzbl (%rdi),%eax
+  800ba3:	84 c0                	test   %al,%al
+  800ba5:	75 ed                	jne    800b94 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800ba7:	0f b6 c0             	movzbl %al,%eax
+  800baa:	0f b6 16             	movzbl (%rsi),%edx
+  800bad:	29 d0                	sub    %edx,%eax
+}
+  800baf:	c3                   	ret
+
+0000000000800bb0 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800bb0:	48 85 d2             	test   %rdx,%rdx
+  800bb3:	74 1f                	je     800bd4 <strncmp+0x24>
+  800bb5:	0f b6 07             	movzbl (%rdi),%eax
+  800bb8:	84 c0                	test   %al,%al
+  800bba:	74 1e                	je     800bda <strncmp+0x2a>
+  800bbc:	3a 06                	cmp    (%rsi),%al
+  800bbe:	75 1a                	jne    800bda <strncmp+0x2a>
+  800bc0:	48 83 c7 01          	add    $0x1,%rdi
+  800bc4:	48 83 c6 01          	add    $0x1,%rsi
+  800bc8:	48 83 ea 01          	sub    $0x1,%rdx
+  800bcc:	75 e7                	jne    800bb5 <strncmp+0x5>
+
+    if (!n) return 0;
+  800bce:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bd3:	c3                   	ret
+  800bd4:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bd9:	c3                   	ret
+  800bda:	48 85 d2             	test   %rdx,%rdx
+  800bdd:	74 09                	je     800be8 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800bdf:	0f b6 07             	movzbl (%rdi),%eax
+  800be2:	0f b6 16             	movzbl (%rsi),%edx
+  800be5:	29 d0                	sub    %edx,%eax
+  800be7:	c3                   	ret
+    if (!n) return 0;
+  800be8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800bed:	c3                   	ret
+
+0000000000800bee <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800bee:	0f b6 17             	movzbl (%rdi),%edx
+  800bf1:	84 d2                	test   %dl,%dl
+  800bf3:	74 18                	je     800c0d <strchr+0x1f>
+        if (*str == c) {
+  800bf5:	0f be d2             	movsbl %dl,%edx
+  800bf8:	39 f2                	cmp    %esi,%edx
+  800bfa:	74 17                	je     800c13 <strchr+0x25>
+    for (; *str; str++) {
+  800bfc:	48 83 c7 01          	add    $0x1,%rdi
+  800c00:	0f b6 17             	movzbl (%rdi),%edx
+  800c03:	84 d2                	test   %dl,%dl
+  800c05:	75 ee                	jne    800bf5 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800c07:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c0c:	c3                   	ret
+  800c0d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c12:	c3                   	ret
+  800c13:	48 89 f8             	mov    %rdi,%rax
+}
+  800c16:	c3                   	ret
+
+0000000000800c17 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800c17:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800c1a:	0f b6 17             	movzbl (%rdi),%edx
+  800c1d:	84 d2                	test   %dl,%dl
+  800c1f:	74 13                	je     800c34 <strfind+0x1d>
+  800c21:	0f be d2             	movsbl %dl,%edx
+  800c24:	39 f2                	cmp    %esi,%edx
+  800c26:	74 0b                	je     800c33 <strfind+0x1c>
+  800c28:	48 83 c0 01          	add    $0x1,%rax
+  800c2c:	0f b6 10             	movzbl (%rax),%edx
+  800c2f:	84 d2                	test   %dl,%dl
+  800c31:	75 ee                	jne    800c21 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800c33:	c3                   	ret
+  800c34:	c3                   	ret
+
+0000000000800c35 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800c35:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800c38:	48 89 f8             	mov    %rdi,%rax
+  800c3b:	48 f7 d8             	neg    %rax
+  800c3e:	83 e0 07             	and    $0x7,%eax
+  800c41:	49 89 d1             	mov    %rdx,%r9
+  800c44:	49 29 c1             	sub    %rax,%r9
+  800c47:	78 36                	js     800c7f <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800c49:	40 0f b6 c6          	movzbl %sil,%eax
+  800c4d:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800c54:	01 01 01 
+  800c57:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800c5b:	40 f6 c7 07          	test   $0x7,%dil
+  800c5f:	75 38                	jne    800c99 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800c61:	4c 89 c9             	mov    %r9,%rcx
+  800c64:	48 c1 f9 03          	sar    $0x3,%rcx
+  800c68:	74 0c                	je     800c76 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800c6a:	fc                   	cld
+  800c6b:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800c6e:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800c72:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800c76:	4d 85 c9             	test   %r9,%r9
+  800c79:	75 45                	jne    800cc0 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800c7b:	4c 89 c0             	mov    %r8,%rax
+  800c7e:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800c7f:	48 85 d2             	test   %rdx,%rdx
+  800c82:	74 f7                	je     800c7b <memset+0x46>
+  800c84:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800c87:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800c8a:	48 83 c0 01          	add    $0x1,%rax
+  800c8e:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  800c92:	48 39 c2             	cmp    %rax,%rdx
+  800c95:	75 f3                	jne    800c8a <memset+0x55>
+  800c97:	eb e2                	jmp    800c7b <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  800c99:	40 f6 c7 01          	test   $0x1,%dil
+  800c9d:	74 06                	je     800ca5 <memset+0x70>
+  800c9f:	88 07                	mov    %al,(%rdi)
+  800ca1:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800ca5:	40 f6 c7 02          	test   $0x2,%dil
+  800ca9:	74 07                	je     800cb2 <memset+0x7d>
+  800cab:	66 89 07             	mov    %ax,(%rdi)
+  800cae:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800cb2:	40 f6 c7 04          	test   $0x4,%dil
+  800cb6:	74 a9                	je     800c61 <memset+0x2c>
+  800cb8:	89 07                	mov    %eax,(%rdi)
+  800cba:	48 83 c7 04          	add    $0x4,%rdi
+  800cbe:	eb a1                	jmp    800c61 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800cc0:	41 f6 c1 04          	test   $0x4,%r9b
+  800cc4:	74 06                	je     800ccc <memset+0x97>
+  800cc6:	89 07                	mov    %eax,(%rdi)
+  800cc8:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800ccc:	41 f6 c1 02          	test   $0x2,%r9b
+  800cd0:	74 07                	je     800cd9 <memset+0xa4>
+  800cd2:	66 89 07             	mov    %ax,(%rdi)
+  800cd5:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  800cd9:	41 f6 c1 01          	test   $0x1,%r9b
+  800cdd:	74 9c                	je     800c7b <memset+0x46>
+  800cdf:	88 07                	mov    %al,(%rdi)
+  800ce1:	eb 98                	jmp    800c7b <memset+0x46>
+
+0000000000800ce3 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  800ce3:	48 89 f8             	mov    %rdi,%rax
+  800ce6:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  800ce9:	48 39 fe             	cmp    %rdi,%rsi
+  800cec:	73 3b                	jae    800d29 <memmove+0x46>
+  800cee:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  800cf2:	48 39 d7             	cmp    %rdx,%rdi
+  800cf5:	73 32                	jae    800d29 <memmove+0x46>
+        s += n;
+        d += n;
+  800cf7:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800cfb:	48 89 d6             	mov    %rdx,%rsi
+  800cfe:	48 09 fe             	or     %rdi,%rsi
+  800d01:	48 09 ce             	or     %rcx,%rsi
+  800d04:	40 f6 c6 07          	test   $0x7,%sil
+  800d08:	75 12                	jne    800d1c <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  800d0a:	48 83 ef 08          	sub    $0x8,%rdi
+  800d0e:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  800d12:	48 c1 e9 03          	shr    $0x3,%rcx
+  800d16:	fd                   	std
+  800d17:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  800d1a:	fc                   	cld
+  800d1b:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  800d1c:	48 83 ef 01          	sub    $0x1,%rdi
+  800d20:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  800d24:	fd                   	std
+  800d25:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  800d27:	eb f1                	jmp    800d1a <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800d29:	48 89 f2             	mov    %rsi,%rdx
+  800d2c:	48 09 c2             	or     %rax,%rdx
+  800d2f:	48 09 ca             	or     %rcx,%rdx
+  800d32:	f6 c2 07             	test   $0x7,%dl
+  800d35:	75 0c                	jne    800d43 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  800d37:	48 c1 e9 03          	shr    $0x3,%rcx
+  800d3b:	48 89 c7             	mov    %rax,%rdi
+  800d3e:	fc                   	cld
+  800d3f:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  800d42:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  800d43:	48 89 c7             	mov    %rax,%rdi
+  800d46:	fc                   	cld
+  800d47:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  800d49:	c3                   	ret
+
+0000000000800d4a <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  800d4a:	55                   	push   %rbp
+  800d4b:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  800d4e:	48 b8 e3 0c 80 00 00 	movabs $0x800ce3,%rax
+  800d55:	00 00 00 
+  800d58:	ff d0                	call   *%rax
+}
+  800d5a:	5d                   	pop    %rbp
+  800d5b:	c3                   	ret
+
+0000000000800d5c <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  800d5c:	55                   	push   %rbp
+  800d5d:	48 89 e5             	mov    %rsp,%rbp
+  800d60:	41 57                	push   %r15
+  800d62:	41 56                	push   %r14
+  800d64:	41 55                	push   %r13
+  800d66:	41 54                	push   %r12
+  800d68:	53                   	push   %rbx
+  800d69:	48 83 ec 08          	sub    $0x8,%rsp
+  800d6d:	49 89 fe             	mov    %rdi,%r14
+  800d70:	49 89 f7             	mov    %rsi,%r15
+  800d73:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  800d76:	48 89 f7             	mov    %rsi,%rdi
+  800d79:	48 b8 ab 0a 80 00 00 	movabs $0x800aab,%rax
+  800d80:	00 00 00 
+  800d83:	ff d0                	call   *%rax
+  800d85:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  800d88:	48 89 de             	mov    %rbx,%rsi
+  800d8b:	4c 89 f7             	mov    %r14,%rdi
+  800d8e:	48 b8 c6 0a 80 00 00 	movabs $0x800ac6,%rax
+  800d95:	00 00 00 
+  800d98:	ff d0                	call   *%rax
+  800d9a:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  800d9d:	48 39 c3             	cmp    %rax,%rbx
+  800da0:	74 36                	je     800dd8 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  800da2:	48 89 d8             	mov    %rbx,%rax
+  800da5:	4c 29 e8             	sub    %r13,%rax
+  800da8:	49 39 c4             	cmp    %rax,%r12
+  800dab:	73 31                	jae    800dde <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  800dad:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  800db2:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800db6:	4c 89 fe             	mov    %r15,%rsi
+  800db9:	48 b8 4a 0d 80 00 00 	movabs $0x800d4a,%rax
+  800dc0:	00 00 00 
+  800dc3:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  800dc5:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  800dc9:	48 83 c4 08          	add    $0x8,%rsp
+  800dcd:	5b                   	pop    %rbx
+  800dce:	41 5c                	pop    %r12
+  800dd0:	41 5d                	pop    %r13
+  800dd2:	41 5e                	pop    %r14
+  800dd4:	41 5f                	pop    %r15
+  800dd6:	5d                   	pop    %rbp
+  800dd7:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  800dd8:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800ddc:	eb eb                	jmp    800dc9 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  800dde:	48 83 eb 01          	sub    $0x1,%rbx
+  800de2:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800de6:	48 89 da             	mov    %rbx,%rdx
+  800de9:	4c 89 fe             	mov    %r15,%rsi
+  800dec:	48 b8 4a 0d 80 00 00 	movabs $0x800d4a,%rax
+  800df3:	00 00 00 
+  800df6:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  800df8:	49 01 de             	add    %rbx,%r14
+  800dfb:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  800e00:	eb c3                	jmp    800dc5 <strlcat+0x69>
+
+0000000000800e02 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  800e02:	48 85 d2             	test   %rdx,%rdx
+  800e05:	74 2d                	je     800e34 <memcmp+0x32>
+  800e07:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  800e0c:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800e10:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  800e15:	44 38 c1             	cmp    %r8b,%cl
+  800e18:	75 0f                	jne    800e29 <memcmp+0x27>
+    while (n-- > 0) {
+  800e1a:	48 83 c0 01          	add    $0x1,%rax
+  800e1e:	48 39 c2             	cmp    %rax,%rdx
+  800e21:	75 e9                	jne    800e0c <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  800e23:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e28:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  800e29:	0f b6 c1             	movzbl %cl,%eax
+  800e2c:	45 0f b6 c0          	movzbl %r8b,%r8d
+  800e30:	44 29 c0             	sub    %r8d,%eax
+  800e33:	c3                   	ret
+    return 0;
+  800e34:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800e39:	c3                   	ret
+
+0000000000800e3a <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  800e3a:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  800e3e:	48 39 c7             	cmp    %rax,%rdi
+  800e41:	73 0f                	jae    800e52 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  800e43:	40 38 37             	cmp    %sil,(%rdi)
+  800e46:	74 0e                	je     800e56 <memfind+0x1c>
+    for (; src < end; src++) {
+  800e48:	48 83 c7 01          	add    $0x1,%rdi
+  800e4c:	48 39 f8             	cmp    %rdi,%rax
+  800e4f:	75 f2                	jne    800e43 <memfind+0x9>
+  800e51:	c3                   	ret
+  800e52:	48 89 f8             	mov    %rdi,%rax
+  800e55:	c3                   	ret
+  800e56:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  800e59:	c3                   	ret
+
+0000000000800e5a <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  800e5a:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  800e5d:	0f b6 37             	movzbl (%rdi),%esi
+  800e60:	40 80 fe 20          	cmp    $0x20,%sil
+  800e64:	74 06                	je     800e6c <strtol+0x12>
+  800e66:	40 80 fe 09          	cmp    $0x9,%sil
+  800e6a:	75 13                	jne    800e7f <strtol+0x25>
+  800e6c:	48 83 c7 01          	add    $0x1,%rdi
+  800e70:	0f b6 37             	movzbl (%rdi),%esi
+  800e73:	40 80 fe 20          	cmp    $0x20,%sil
+  800e77:	74 f3                	je     800e6c <strtol+0x12>
+  800e79:	40 80 fe 09          	cmp    $0x9,%sil
+  800e7d:	74 ed                	je     800e6c <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  800e7f:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  800e82:	83 e0 fd             	and    $0xfffffffd,%eax
+  800e85:	3c 01                	cmp    $0x1,%al
+  800e87:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  800e8b:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  800e91:	75 0f                	jne    800ea2 <strtol+0x48>
+  800e93:	80 3f 30             	cmpb   $0x30,(%rdi)
+  800e96:	74 14                	je     800eac <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  800e98:	85 d2                	test   %edx,%edx
+  800e9a:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800e9f:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  800ea2:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  800ea7:	4c 63 ca             	movslq %edx,%r9
+  800eaa:	eb 36                	jmp    800ee2 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  800eac:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  800eb0:	74 0f                	je     800ec1 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  800eb2:	85 d2                	test   %edx,%edx
+  800eb4:	75 ec                	jne    800ea2 <strtol+0x48>
+        s++;
+  800eb6:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  800eba:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  800ebf:	eb e1                	jmp    800ea2 <strtol+0x48>
+        s += 2;
+  800ec1:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  800ec5:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  800eca:	eb d6                	jmp    800ea2 <strtol+0x48>
+            dig -= '0';
+  800ecc:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  800ecf:	44 0f b6 c1          	movzbl %cl,%r8d
+  800ed3:	41 39 d0             	cmp    %edx,%r8d
+  800ed6:	7d 21                	jge    800ef9 <strtol+0x9f>
+        val = val * base + dig;
+  800ed8:	49 0f af c1          	imul   %r9,%rax
+  800edc:	0f b6 c9             	movzbl %cl,%ecx
+  800edf:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  800ee2:	48 83 c7 01          	add    $0x1,%rdi
+  800ee6:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  800eea:	80 f9 39             	cmp    $0x39,%cl
+  800eed:	76 dd                	jbe    800ecc <strtol+0x72>
+        else if (dig - 'a' < 27)
+  800eef:	80 f9 7b             	cmp    $0x7b,%cl
+  800ef2:	77 05                	ja     800ef9 <strtol+0x9f>
+            dig -= 'a' - 10;
+  800ef4:	83 e9 57             	sub    $0x57,%ecx
+  800ef7:	eb d6                	jmp    800ecf <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  800ef9:	4d 85 d2             	test   %r10,%r10
+  800efc:	74 03                	je     800f01 <strtol+0xa7>
+  800efe:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  800f01:	48 89 c2             	mov    %rax,%rdx
+  800f04:	48 f7 da             	neg    %rdx
+  800f07:	40 80 fe 2d          	cmp    $0x2d,%sil
+  800f0b:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  800f0f:	c3                   	ret
+
+0000000000800f10 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  800f10:	55                   	push   %rbp
+  800f11:	48 89 e5             	mov    %rsp,%rbp
+  800f14:	53                   	push   %rbx
+  800f15:	48 89 fa             	mov    %rdi,%rdx
+  800f18:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  800f1b:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800f20:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f25:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800f2a:	be 00 00 00 00       	mov    $0x0,%esi
+  800f2f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800f35:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  800f37:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800f3b:	c9                   	leave
+  800f3c:	c3                   	ret
+
+0000000000800f3d <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  800f3d:	55                   	push   %rbp
+  800f3e:	48 89 e5             	mov    %rsp,%rbp
+  800f41:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  800f42:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800f47:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f4c:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800f51:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f56:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800f5b:	be 00 00 00 00       	mov    $0x0,%esi
+  800f60:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800f66:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  800f68:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800f6c:	c9                   	leave
+  800f6d:	c3                   	ret
+
+0000000000800f6e <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  800f6e:	55                   	push   %rbp
+  800f6f:	48 89 e5             	mov    %rsp,%rbp
+  800f72:	53                   	push   %rbx
+  800f73:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  800f77:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800f7a:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800f7f:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800f84:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f89:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800f8e:	be 00 00 00 00       	mov    $0x0,%esi
+  800f93:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800f99:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800f9b:	48 85 c0             	test   %rax,%rax
+  800f9e:	7f 06                	jg     800fa6 <sys_env_destroy+0x38>
+}
+  800fa0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800fa4:	c9                   	leave
+  800fa5:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800fa6:	49 89 c0             	mov    %rax,%r8
+  800fa9:	b9 03 00 00 00       	mov    $0x3,%ecx
+  800fae:	48 ba f0 31 80 00 00 	movabs $0x8031f0,%rdx
+  800fb5:	00 00 00 
+  800fb8:	be 26 00 00 00       	mov    $0x26,%esi
+  800fbd:	48 bf 0f 32 80 00 00 	movabs $0x80320f,%rdi
+  800fc4:	00 00 00 
+  800fc7:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fcc:	49 b9 2a 2a 80 00 00 	movabs $0x802a2a,%r9
+  800fd3:	00 00 00 
+  800fd6:	41 ff d1             	call   *%r9
+
+0000000000800fd9 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  800fd9:	55                   	push   %rbp
+  800fda:	48 89 e5             	mov    %rsp,%rbp
+  800fdd:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  800fde:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800fe3:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fe8:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800fed:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ff2:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800ff7:	be 00 00 00 00       	mov    $0x0,%esi
+  800ffc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801002:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  801004:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801008:	c9                   	leave
+  801009:	c3                   	ret
+
+000000000080100a <sys_yield>:
+
+void
+sys_yield(void) {
+  80100a:	55                   	push   %rbp
+  80100b:	48 89 e5             	mov    %rsp,%rbp
+  80100e:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80100f:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801014:	ba 00 00 00 00       	mov    $0x0,%edx
+  801019:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80101e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801023:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801028:	be 00 00 00 00       	mov    $0x0,%esi
+  80102d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801033:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  801035:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801039:	c9                   	leave
+  80103a:	c3                   	ret
+
+000000000080103b <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  80103b:	55                   	push   %rbp
+  80103c:	48 89 e5             	mov    %rsp,%rbp
+  80103f:	53                   	push   %rbx
+  801040:	48 89 fa             	mov    %rdi,%rdx
+  801043:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801046:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80104b:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  801052:	00 00 00 
+  801055:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80105a:	be 00 00 00 00       	mov    $0x0,%esi
+  80105f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801065:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  801067:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80106b:	c9                   	leave
+  80106c:	c3                   	ret
+
+000000000080106d <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  80106d:	55                   	push   %rbp
+  80106e:	48 89 e5             	mov    %rsp,%rbp
+  801071:	53                   	push   %rbx
+  801072:	49 89 f8             	mov    %rdi,%r8
+  801075:	48 89 d3             	mov    %rdx,%rbx
+  801078:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80107b:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801080:	4c 89 c2             	mov    %r8,%rdx
+  801083:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801086:	be 00 00 00 00       	mov    $0x0,%esi
+  80108b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801091:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  801093:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801097:	c9                   	leave
+  801098:	c3                   	ret
+
+0000000000801099 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  801099:	55                   	push   %rbp
+  80109a:	48 89 e5             	mov    %rsp,%rbp
+  80109d:	53                   	push   %rbx
+  80109e:	48 83 ec 08          	sub    $0x8,%rsp
+  8010a2:	89 f8                	mov    %edi,%eax
+  8010a4:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  8010a7:	48 63 f9             	movslq %ecx,%rdi
+  8010aa:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8010ad:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8010b2:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8010b5:	be 00 00 00 00       	mov    $0x0,%esi
+  8010ba:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8010c0:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8010c2:	48 85 c0             	test   %rax,%rax
+  8010c5:	7f 06                	jg     8010cd <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  8010c7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8010cb:	c9                   	leave
+  8010cc:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8010cd:	49 89 c0             	mov    %rax,%r8
+  8010d0:	b9 04 00 00 00       	mov    $0x4,%ecx
+  8010d5:	48 ba f0 31 80 00 00 	movabs $0x8031f0,%rdx
+  8010dc:	00 00 00 
+  8010df:	be 26 00 00 00       	mov    $0x26,%esi
+  8010e4:	48 bf 0f 32 80 00 00 	movabs $0x80320f,%rdi
+  8010eb:	00 00 00 
+  8010ee:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010f3:	49 b9 2a 2a 80 00 00 	movabs $0x802a2a,%r9
+  8010fa:	00 00 00 
+  8010fd:	41 ff d1             	call   *%r9
+
+0000000000801100 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801100:	55                   	push   %rbp
+  801101:	48 89 e5             	mov    %rsp,%rbp
+  801104:	53                   	push   %rbx
+  801105:	48 83 ec 08          	sub    $0x8,%rsp
+  801109:	89 f8                	mov    %edi,%eax
+  80110b:	49 89 f2             	mov    %rsi,%r10
+  80110e:	48 89 cf             	mov    %rcx,%rdi
+  801111:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  801114:	48 63 da             	movslq %edx,%rbx
+  801117:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80111a:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80111f:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801122:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  801125:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801127:	48 85 c0             	test   %rax,%rax
+  80112a:	7f 06                	jg     801132 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  80112c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801130:	c9                   	leave
+  801131:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801132:	49 89 c0             	mov    %rax,%r8
+  801135:	b9 05 00 00 00       	mov    $0x5,%ecx
+  80113a:	48 ba f0 31 80 00 00 	movabs $0x8031f0,%rdx
+  801141:	00 00 00 
+  801144:	be 26 00 00 00       	mov    $0x26,%esi
+  801149:	48 bf 0f 32 80 00 00 	movabs $0x80320f,%rdi
+  801150:	00 00 00 
+  801153:	b8 00 00 00 00       	mov    $0x0,%eax
+  801158:	49 b9 2a 2a 80 00 00 	movabs $0x802a2a,%r9
+  80115f:	00 00 00 
+  801162:	41 ff d1             	call   *%r9
+
+0000000000801165 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  801165:	55                   	push   %rbp
+  801166:	48 89 e5             	mov    %rsp,%rbp
+  801169:	53                   	push   %rbx
+  80116a:	48 83 ec 08          	sub    $0x8,%rsp
+  80116e:	48 89 f1             	mov    %rsi,%rcx
+  801171:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  801174:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801177:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80117c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801181:	be 00 00 00 00       	mov    $0x0,%esi
+  801186:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80118c:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80118e:	48 85 c0             	test   %rax,%rax
+  801191:	7f 06                	jg     801199 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  801193:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801197:	c9                   	leave
+  801198:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801199:	49 89 c0             	mov    %rax,%r8
+  80119c:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8011a1:	48 ba f0 31 80 00 00 	movabs $0x8031f0,%rdx
+  8011a8:	00 00 00 
+  8011ab:	be 26 00 00 00       	mov    $0x26,%esi
+  8011b0:	48 bf 0f 32 80 00 00 	movabs $0x80320f,%rdi
+  8011b7:	00 00 00 
+  8011ba:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011bf:	49 b9 2a 2a 80 00 00 	movabs $0x802a2a,%r9
+  8011c6:	00 00 00 
+  8011c9:	41 ff d1             	call   *%r9
+
+00000000008011cc <sys_region_batch>:
+
+int
+sys_region_batch(const struct RegionOp *ops, size_t count) {
+  8011cc:	55                   	push   %rbp
+  8011cd:	48 89 e5             	mov    %rsp,%rbp
+  8011d0:	53                   	push   %rbx
+  8011d1:	48 83 ec 08          	sub    $0x8,%rsp
+  8011d5:	48 89 fa             	mov    %rdi,%rdx
+  8011d8:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8011db:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8011e0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011e5:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8011ea:	be 00 00 00 00       	mov    $0x0,%esi
+  8011ef:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8011f5:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8011f7:	48 85 c0             	test   %rax,%rax
+  8011fa:	7f 06                	jg     801202 <sys_region_batch+0x36>
+        else
+            platform_asan_unpoison(va, ops[i].size);
+    }
+#endif
+    return res;
+}
+  8011fc:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801200:	c9                   	leave
+  801201:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801202:	49 89 c0             	mov    %rax,%r8
+  801205:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  80120a:	48 ba f0 31 80 00 00 	movabs $0x8031f0,%rdx
+  801211:	00 00 00 
+  801214:	be 26 00 00 00       	mov    $0x26,%esi
+  801219:	48 bf 0f 32 80 00 00 	movabs $0x80320f,%rdi
+  801220:	00 00 00 
+  801223:	b8 00 00 00 00       	mov    $0x0,%eax
+  801228:	49 b9 2a 2a 80 00 00 	movabs $0x802a2a,%r9
+  80122f:	00 00 00 
+  801232:	41 ff d1             	call   *%r9
+
+0000000000801235 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  801235:	55                   	push   %rbp
+  801236:	48 89 e5             	mov    %rsp,%rbp
+  801239:	53                   	push   %rbx
+  80123a:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  80123e:	48 63 ce             	movslq %esi,%rcx
+  801241:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801244:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801249:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80124e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801253:	be 00 00 00 00       	mov    $0x0,%esi
+  801258:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80125e:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801260:	48 85 c0             	test   %rax,%rax
+  801263:	7f 06                	jg     80126b <sys_env_set_status+0x36>
+}
+  801265:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801269:	c9                   	leave
+  80126a:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80126b:	49 89 c0             	mov    %rax,%r8
+  80126e:	b9 09 00 00 00       	mov    $0x9,%ecx
+  801273:	48 ba f0 31 80 00 00 	movabs $0x8031f0,%rdx
+  80127a:	00 00 00 
+  80127d:	be 26 00 00 00       	mov    $0x26,%esi
+  801282:	48 bf 0f 32 80 00 00 	movabs $0x80320f,%rdi
+  801289:	00 00 00 
+  80128c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801291:	49 b9 2a 2a 80 00 00 	movabs $0x802a2a,%r9
+  801298:	00 00 00 
+  80129b:	41 ff d1             	call   *%r9
+
+000000000080129e <sys_env_set_weight>:
+
+int
+sys_env_set_weight(envid_t envid, uint32_t weight) {
+  80129e:	55                   	push   %rbp
+  80129f:	48 89 e5             	mov    %rsp,%rbp
+  8012a2:	53                   	push   %rbx
+  8012a3:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_weight, 1, envid, weight, 0, 0, 0, 0);
+  8012a7:	89 f1                	mov    %esi,%ecx
+  8012a9:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8012ac:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8012b1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012b6:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012bb:	be 00 00 00 00       	mov    $0x0,%esi
+  8012c0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8012c6:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8012c8:	48 85 c0             	test   %rax,%rax
+  8012cb:	7f 06                	jg     8012d3 <sys_env_set_weight+0x35>
+}
+  8012cd:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012d1:	c9                   	leave
+  8012d2:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8012d3:	49 89 c0             	mov    %rax,%r8
+  8012d6:	b9 10 00 00 00       	mov    $0x10,%ecx
+  8012db:	48 ba f0 31 80 00 00 	movabs $0x8031f0,%rdx
+  8012e2:	00 00 00 
+  8012e5:	be 26 00 00 00       	mov    $0x26,%esi
+  8012ea:	48 bf 0f 32 80 00 00 	movabs $0x80320f,%rdi
+  8012f1:	00 00 00 
+  8012f4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012f9:	49 b9 2a 2a 80 00 00 	movabs $0x802a2a,%r9
+  801300:	00 00 00 
+  801303:	41 ff d1             	call   *%r9
+
+0000000000801306 <sys_env_set_rt>:
+
+int
+sys_env_set_rt(envid_t envid, uint64_t period, uint64_t budget, uint64_t deadline) {
+  801306:	55                   	push   %rbp
+  801307:	48 89 e5             	mov    %rsp,%rbp
+  80130a:	53                   	push   %rbx
+  80130b:	48 83 ec 08          	sub    $0x8,%rsp
+  80130f:	89 f8                	mov    %edi,%eax
+  801311:	48 89 d3             	mov    %rdx,%rbx
+  801314:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_env_set_rt, 1, envid, period, budget, deadline, 0, 0);
+  801317:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80131a:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80131f:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801322:	be 00 00 00 00       	mov    $0x0,%esi
+  801327:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80132d:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80132f:	48 85 c0             	test   %rax,%rax
+  801332:	7f 06                	jg     80133a <sys_env_set_rt+0x34>
+}
+  801334:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801338:	c9                   	leave
+  801339:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80133a:	49 89 c0             	mov    %rax,%r8
+  80133d:	b9 11 00 00 00       	mov    $0x11,%ecx
+  801342:	48 ba f0 31 80 00 00 	movabs $0x8031f0,%rdx
+  801349:	00 00 00 
+  80134c:	be 26 00 00 00       	mov    $0x26,%esi
+  801351:	48 bf 0f 32 80 00 00 	movabs $0x80320f,%rdi
+  801358:	00 00 00 
+  80135b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801360:	49 b9 2a 2a 80 00 00 	movabs $0x802a2a,%r9
+  801367:	00 00 00 
+  80136a:	41 ff d1             	call   *%r9
+
+000000000080136d <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  80136d:	55                   	push   %rbp
+  80136e:	48 89 e5             	mov    %rsp,%rbp
+  801371:	53                   	push   %rbx
+  801372:	48 83 ec 08          	sub    $0x8,%rsp
+  801376:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  801379:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80137c:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801381:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801386:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80138b:	be 00 00 00 00       	mov    $0x0,%esi
+  801390:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801396:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801398:	48 85 c0             	test   %rax,%rax
+  80139b:	7f 06                	jg     8013a3 <sys_env_set_trapframe+0x36>
+}
+  80139d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013a1:	c9                   	leave
+  8013a2:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8013a3:	49 89 c0             	mov    %rax,%r8
+  8013a6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  8013ab:	48 ba f0 31 80 00 00 	movabs $0x8031f0,%rdx
+  8013b2:	00 00 00 
+  8013b5:	be 26 00 00 00       	mov    $0x26,%esi
+  8013ba:	48 bf 0f 32 80 00 00 	movabs $0x80320f,%rdi
+  8013c1:	00 00 00 
+  8013c4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013c9:	49 b9 2a 2a 80 00 00 	movabs $0x802a2a,%r9
+  8013d0:	00 00 00 
+  8013d3:	41 ff d1             	call   *%r9
+
+00000000008013d6 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  8013d6:	55                   	push   %rbp
+  8013d7:	48 89 e5             	mov    %rsp,%rbp
+  8013da:	53                   	push   %rbx
+  8013db:	48 83 ec 08          	sub    $0x8,%rsp
+  8013df:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  8013e2:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8013e5:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8013ea:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013ef:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013f4:	be 00 00 00 00       	mov    $0x0,%esi
+  8013f9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013ff:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801401:	48 85 c0             	test   %rax,%rax
+  801404:	7f 06                	jg     80140c <sys_env_set_pgfault_upcall+0x36>
+}
+  801406:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80140a:	c9                   	leave
+  80140b:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80140c:	49 89 c0             	mov    %rax,%r8
+  80140f:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  801414:	48 ba f0 31 80 00 00 	movabs $0x8031f0,%rdx
+  80141b:	00 00 00 
+  80141e:	be 26 00 00 00       	mov    $0x26,%esi
+  801423:	48 bf 0f 32 80 00 00 	movabs $0x80320f,%rdi
+  80142a:	00 00 00 
+  80142d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801432:	49 b9 2a 2a 80 00 00 	movabs $0x802a2a,%r9
+  801439:	00 00 00 
+  80143c:	41 ff d1             	call   *%r9
+
+000000000080143f <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  80143f:	55                   	push   %rbp
+  801440:	48 89 e5             	mov    %rsp,%rbp
+  801443:	53                   	push   %rbx
+  801444:	89 f8                	mov    %edi,%eax
+  801446:	49 89 f1             	mov    %rsi,%r9
+  801449:	48 89 d3             	mov    %rdx,%rbx
+  80144c:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  80144f:	49 63 f0             	movslq %r8d,%rsi
+  801452:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801455:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80145a:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80145d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801463:	cd 30                	int    $0x30
+}
+  801465:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801469:	c9                   	leave
+  80146a:	c3                   	ret
+
+000000000080146b <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  80146b:	55                   	push   %rbp
+  80146c:	48 89 e5             	mov    %rsp,%rbp
+  80146f:	53                   	push   %rbx
+  801470:	48 83 ec 08          	sub    $0x8,%rsp
+  801474:	48 89 fa             	mov    %rdi,%rdx
+  801477:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80147a:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80147f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801484:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801489:	be 00 00 00 00       	mov    $0x0,%esi
+  80148e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801494:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801496:	48 85 c0             	test   %rax,%rax
+  801499:	7f 06                	jg     8014a1 <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  80149b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80149f:	c9                   	leave
+  8014a0:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8014a1:	49 89 c0             	mov    %rax,%r8
+  8014a4:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  8014a9:	48 ba f0 31 80 00 00 	movabs $0x8031f0,%rdx
+  8014b0:	00 00 00 
+  8014b3:	be 26 00 00 00       	mov    $0x26,%esi
+  8014b8:	48 bf 0f 32 80 00 00 	movabs $0x80320f,%rdi
+  8014bf:	00 00 00 
+  8014c2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014c7:	49 b9 2a 2a 80 00 00 	movabs $0x802a2a,%r9
+  8014ce:	00 00 00 
+  8014d1:	41 ff d1             	call   *%r9
+
+00000000008014d4 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8014d4:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8014db:	ff ff ff 
+  8014de:	48 01 f8             	add    %rdi,%rax
+  8014e1:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  8014e5:	c3                   	ret
+
+00000000008014e6 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8014e6:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8014ed:	ff ff ff 
+  8014f0:	48 01 f8             	add    %rdi,%rax
+  8014f3:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  8014f7:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  8014fd:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  801501:	c3                   	ret
+
+0000000000801502 <fd_alloc_from>:
+}
+
+/* Like fd_alloc(), but only considers fds starting from fdnum,
+ * so that several fds can be found before their pages are allocated */
+int
+fd_alloc_from(int fdnum, struct Fd **fd_store) {
+  801502:	55                   	push   %rbp
+  801503:	48 89 e5             	mov    %rsp,%rbp
+  801506:	41 57                	push   %r15
+  801508:	41 56                	push   %r14
+  80150a:	41 55                	push   %r13
+  80150c:	41 54                	push   %r12
+  80150e:	53                   	push   %rbx
+  80150f:	48 83 ec 08          	sub    $0x8,%rsp
+  801513:	49 89 f7             	mov    %rsi,%r15
+    for (int i = MAX(fdnum, 0); i < MAXFD; i++) {
+  801516:	85 ff                	test   %edi,%edi
+  801518:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80151e:	44 0f 49 e7          	cmovns %edi,%r12d
+  801522:	83 ff 1f             	cmp    $0x1f,%edi
+  801525:	7f 37                	jg     80155e <fd_alloc_from+0x5c>
+  801527:	49 63 dc             	movslq %r12d,%rbx
+  80152a:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  801531:	48 c1 e3 0c          	shl    $0xc,%rbx
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  801535:	49 be 0b 26 80 00 00 	movabs $0x80260b,%r14
+  80153c:	00 00 00 
+        struct Fd *fd = INDEX2FD(i);
+  80153f:	49 89 dd             	mov    %rbx,%r13
+        if (!(get_prot(fd) & PROT_R)) {
+  801542:	48 89 df             	mov    %rbx,%rdi
+  801545:	41 ff d6             	call   *%r14
+  801548:	83 e0 04             	and    $0x4,%eax
+  80154b:	74 1c                	je     801569 <fd_alloc_from+0x67>
+    for (int i = MAX(fdnum, 0); i < MAXFD; i++) {
+  80154d:	41 83 c4 01          	add    $0x1,%r12d
+  801551:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801558:	41 83 fc 1f          	cmp    $0x1f,%r12d
+  80155c:	7e e1                	jle    80153f <fd_alloc_from+0x3d>
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  80155e:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801564:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  801569:	4d 89 2f             	mov    %r13,(%r15)
+}
+  80156c:	48 83 c4 08          	add    $0x8,%rsp
+  801570:	5b                   	pop    %rbx
+  801571:	41 5c                	pop    %r12
+  801573:	41 5d                	pop    %r13
+  801575:	41 5e                	pop    %r14
+  801577:	41 5f                	pop    %r15
+  801579:	5d                   	pop    %rbp
+  80157a:	c3                   	ret
+
+000000000080157b <fd_alloc>:
+fd_alloc(struct Fd **fd_store) {
+  80157b:	55                   	push   %rbp
+  80157c:	48 89 e5             	mov    %rsp,%rbp
+  80157f:	48 89 fe             	mov    %rdi,%rsi
+    return fd_alloc_from(0, fd_store);
+  801582:	bf 00 00 00 00       	mov    $0x0,%edi
+  801587:	48 b8 02 15 80 00 00 	movabs $0x801502,%rax
+  80158e:	00 00 00 
+  801591:	ff d0                	call   *%rax
+}
+  801593:	5d                   	pop    %rbp
+  801594:	c3                   	ret
+
+0000000000801595 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  801595:	83 ff 1f             	cmp    $0x1f,%edi
+  801598:	77 39                	ja     8015d3 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  80159a:	55                   	push   %rbp
+  80159b:	48 89 e5             	mov    %rsp,%rbp
+  80159e:	41 54                	push   %r12
+  8015a0:	53                   	push   %rbx
+  8015a1:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  8015a4:	48 63 df             	movslq %edi,%rbx
+  8015a7:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  8015ae:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  8015b2:	48 89 df             	mov    %rbx,%rdi
+  8015b5:	48 b8 0b 26 80 00 00 	movabs $0x80260b,%rax
+  8015bc:	00 00 00 
+  8015bf:	ff d0                	call   *%rax
+  8015c1:	a8 04                	test   $0x4,%al
+  8015c3:	74 14                	je     8015d9 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  8015c5:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  8015c9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8015ce:	5b                   	pop    %rbx
+  8015cf:	41 5c                	pop    %r12
+  8015d1:	5d                   	pop    %rbp
+  8015d2:	c3                   	ret
+        return -E_INVAL;
+  8015d3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8015d8:	c3                   	ret
+        return -E_INVAL;
+  8015d9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8015de:	eb ee                	jmp    8015ce <fd_lookup+0x39>
+
+00000000008015e0 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  8015e0:	55                   	push   %rbp
+  8015e1:	48 89 e5             	mov    %rsp,%rbp
+  8015e4:	41 54                	push   %r12
+  8015e6:	53                   	push   %rbx
+  8015e7:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  8015ea:	48 b8 a0 32 80 00 00 	movabs $0x8032a0,%rax
+  8015f1:	00 00 00 
+  8015f4:	48 bb 20 40 80 00 00 	movabs $0x804020,%rbx
+  8015fb:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  8015fe:	39 3b                	cmp    %edi,(%rbx)
+  801600:	74 47                	je     801649 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  801602:	48 83 c0 08          	add    $0x8,%rax
+  801606:	48 8b 18             	mov    (%rax),%rbx
+  801609:	48 85 db             	test   %rbx,%rbx
+  80160c:	75 f0                	jne    8015fe <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  80160e:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801615:	00 00 00 
+  801618:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+  80161e:	89 fa                	mov    %edi,%edx
+  801620:	48 bf 20 32 80 00 00 	movabs $0x803220,%rdi
+  801627:	00 00 00 
+  80162a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80162f:	48 b9 c4 01 80 00 00 	movabs $0x8001c4,%rcx
+  801636:	00 00 00 
+  801639:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  80163b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  801640:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  801644:	5b                   	pop    %rbx
+  801645:	41 5c                	pop    %r12
+  801647:	5d                   	pop    %rbp
+  801648:	c3                   	ret
+            return 0;
+  801649:	b8 00 00 00 00       	mov    $0x0,%eax
+  80164e:	eb f0                	jmp    801640 <dev_lookup+0x60>
+
+0000000000801650 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  801650:	55                   	push   %rbp
+  801651:	48 89 e5             	mov    %rsp,%rbp
+  801654:	41 55                	push   %r13
+  801656:	41 54                	push   %r12
+  801658:	53                   	push   %rbx
+  801659:	48 83 ec 18          	sub    $0x18,%rsp
+  80165d:	48 89 fb             	mov    %rdi,%rbx
+  801660:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801663:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  80166a:	ff ff ff 
+  80166d:	48 01 df             	add    %rbx,%rdi
+  801670:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  801674:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801678:	48 b8 95 15 80 00 00 	movabs $0x801595,%rax
+  80167f:	00 00 00 
+  801682:	ff d0                	call   *%rax
+  801684:	41 89 c5             	mov    %eax,%r13d
+  801687:	85 c0                	test   %eax,%eax
+  801689:	78 06                	js     801691 <fd_close+0x41>
+  80168b:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  80168f:	74 1a                	je     8016ab <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  801691:	45 84 e4             	test   %r12b,%r12b
+  801694:	b8 00 00 00 00       	mov    $0x0,%eax
+  801699:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  80169d:	44 89 e8             	mov    %r13d,%eax
+  8016a0:	48 83 c4 18          	add    $0x18,%rsp
+  8016a4:	5b                   	pop    %rbx
+  8016a5:	41 5c                	pop    %r12
+  8016a7:	41 5d                	pop    %r13
+  8016a9:	5d                   	pop    %rbp
+  8016aa:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8016ab:	8b 3b                	mov    (%rbx),%edi
+  8016ad:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8016b1:	48 b8 e0 15 80 00 00 	movabs $0x8015e0,%rax
+  8016b8:	00 00 00 
+  8016bb:	ff d0                	call   *%rax
+  8016bd:	41 89 c5             	mov    %eax,%r13d
+  8016c0:	85 c0                	test   %eax,%eax
+  8016c2:	78 1b                	js     8016df <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  8016c4:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8016c8:	48 8b 40 20          	mov    0x20(%rax),%rax
+  8016cc:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  8016d2:	48 85 c0             	test   %rax,%rax
+  8016d5:	74 08                	je     8016df <fd_close+0x8f>
+  8016d7:	48 89 df             	mov    %rbx,%rdi
+  8016da:	ff d0                	call   *%rax
+  8016dc:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8016df:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8016e4:	48 89 de             	mov    %rbx,%rsi
+  8016e7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8016ec:	48 b8 65 11 80 00 00 	movabs $0x801165,%rax
+  8016f3:	00 00 00 
+  8016f6:	ff d0                	call   *%rax
+    return res;
+  8016f8:	eb a3                	jmp    80169d <fd_close+0x4d>
+
+00000000008016fa <close>:
+
+int
+close(int fdnum) {
+  8016fa:	55                   	push   %rbp
+  8016fb:	48 89 e5             	mov    %rsp,%rbp
+  8016fe:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  801702:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801706:	48 b8 95 15 80 00 00 	movabs $0x801595,%rax
+  80170d:	00 00 00 
+  801710:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801712:	85 c0                	test   %eax,%eax
+  801714:	78 15                	js     80172b <close+0x31>
+
+    return fd_close(fd, 1);
+  801716:	be 01 00 00 00       	mov    $0x1,%esi
+  80171b:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80171f:	48 b8 50 16 80 00 00 	movabs $0x801650,%rax
+  801726:	00 00 00 
+  801729:	ff d0                	call   *%rax
+}
+  80172b:	c9                   	leave
+  80172c:	c3                   	ret
+
+000000000080172d <close_all>:
+
+void
+close_all(void) {
+  80172d:	55                   	push   %rbp
+  80172e:	48 89 e5             	mov    %rsp,%rbp
+  801731:	41 54                	push   %r12
+  801733:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  801734:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801739:	49 bc fa 16 80 00 00 	movabs $0x8016fa,%r12
+  801740:	00 00 00 
+  801743:	89 df                	mov    %ebx,%edi
+  801745:	41 ff d4             	call   *%r12
+  801748:	83 c3 01             	add    $0x1,%ebx
+  80174b:	83 fb 20             	cmp    $0x20,%ebx
+  80174e:	75 f3                	jne    801743 <close_all+0x16>
+}
+  801750:	5b                   	pop    %rbx
+  801751:	41 5c                	pop    %r12
+  801753:	5d                   	pop    %rbp
+  801754:	c3                   	ret
+
+0000000000801755 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  801755:	55                   	push   %rbp
+  801756:	48 89 e5             	mov    %rsp,%rbp
+  801759:	41 57                	push   %r15
+  80175b:	41 56                	push   %r14
+  80175d:	41 55                	push   %r13
+  80175f:	41 54                	push   %r12
+  801761:	53                   	push   %rbx
+  801762:	48 83 ec 18          	sub    $0x18,%rsp
+  801766:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  801769:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  80176d:	48 b8 95 15 80 00 00 	movabs $0x801595,%rax
+  801774:	00 00 00 
+  801777:	ff d0                	call   *%rax
+  801779:	89 c3                	mov    %eax,%ebx
+  80177b:	85 c0                	test   %eax,%eax
+  80177d:	0f 88 b8 00 00 00    	js     80183b <dup+0xe6>
+    close(newfdnum);
+  801783:	44 89 e7             	mov    %r12d,%edi
+  801786:	48 b8 fa 16 80 00 00 	movabs $0x8016fa,%rax
+  80178d:	00 00 00 
+  801790:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  801792:	4d 63 ec             	movslq %r12d,%r13
+  801795:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  80179c:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  8017a0:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  8017a4:	4c 89 ff             	mov    %r15,%rdi
+  8017a7:	49 be e6 14 80 00 00 	movabs $0x8014e6,%r14
+  8017ae:	00 00 00 
+  8017b1:	41 ff d6             	call   *%r14
+  8017b4:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  8017b7:	4c 89 ef             	mov    %r13,%rdi
+  8017ba:	41 ff d6             	call   *%r14
+  8017bd:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  8017c0:	48 89 df             	mov    %rbx,%rdi
+  8017c3:	48 b8 0b 26 80 00 00 	movabs $0x80260b,%rax
+  8017ca:	00 00 00 
+  8017cd:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  8017cf:	a8 04                	test   $0x4,%al
+  8017d1:	74 2b                	je     8017fe <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  8017d3:	41 89 c1             	mov    %eax,%r9d
+  8017d6:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8017dc:	4c 89 f1             	mov    %r14,%rcx
+  8017df:	ba 00 00 00 00       	mov    $0x0,%edx
+  8017e4:	48 89 de             	mov    %rbx,%rsi
+  8017e7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8017ec:	48 b8 00 11 80 00 00 	movabs $0x801100,%rax
+  8017f3:	00 00 00 
+  8017f6:	ff d0                	call   *%rax
+  8017f8:	89 c3                	mov    %eax,%ebx
+  8017fa:	85 c0                	test   %eax,%eax
+  8017fc:	78 4e                	js     80184c <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  8017fe:	4c 89 ff             	mov    %r15,%rdi
+  801801:	48 b8 0b 26 80 00 00 	movabs $0x80260b,%rax
+  801808:	00 00 00 
+  80180b:	ff d0                	call   *%rax
+  80180d:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801810:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801816:	4c 89 e9             	mov    %r13,%rcx
+  801819:	ba 00 00 00 00       	mov    $0x0,%edx
+  80181e:	4c 89 fe             	mov    %r15,%rsi
+  801821:	bf 00 00 00 00       	mov    $0x0,%edi
+  801826:	48 b8 00 11 80 00 00 	movabs $0x801100,%rax
+  80182d:	00 00 00 
+  801830:	ff d0                	call   *%rax
+  801832:	89 c3                	mov    %eax,%ebx
+  801834:	85 c0                	test   %eax,%eax
+  801836:	78 14                	js     80184c <dup+0xf7>
+
+    return newfdnum;
+  801838:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  80183b:	89 d8                	mov    %ebx,%eax
+  80183d:	48 83 c4 18          	add    $0x18,%rsp
+  801841:	5b                   	pop    %rbx
+  801842:	41 5c                	pop    %r12
+  801844:	41 5d                	pop    %r13
+  801846:	41 5e                	pop    %r14
+  801848:	41 5f                	pop    %r15
+  80184a:	5d                   	pop    %rbp
+  80184b:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  80184c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801851:	4c 89 ee             	mov    %r13,%rsi
+  801854:	bf 00 00 00 00       	mov    $0x0,%edi
+  801859:	49 bc 65 11 80 00 00 	movabs $0x801165,%r12
+  801860:	00 00 00 
+  801863:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  801866:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80186b:	4c 89 f6             	mov    %r14,%rsi
+  80186e:	bf 00 00 00 00       	mov    $0x0,%edi
+  801873:	41 ff d4             	call   *%r12
+    return res;
+  801876:	eb c3                	jmp    80183b <dup+0xe6>
+
+0000000000801878 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  801878:	55                   	push   %rbp
+  801879:	48 89 e5             	mov    %rsp,%rbp
+  80187c:	41 56                	push   %r14
+  80187e:	41 55                	push   %r13
+  801880:	41 54                	push   %r12
+  801882:	53                   	push   %rbx
+  801883:	48 83 ec 10          	sub    $0x10,%rsp
+  801887:	89 fb                	mov    %edi,%ebx
+  801889:	49 89 f4             	mov    %rsi,%r12
+  80188c:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80188f:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801893:	48 b8 95 15 80 00 00 	movabs $0x801595,%rax
+  80189a:	00 00 00 
+  80189d:	ff d0                	call   *%rax
+  80189f:	85 c0                	test   %eax,%eax
+  8018a1:	78 4c                	js     8018ef <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8018a3:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  8018a7:	41 8b 3e             	mov    (%r14),%edi
+  8018aa:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8018ae:	48 b8 e0 15 80 00 00 	movabs $0x8015e0,%rax
+  8018b5:	00 00 00 
+  8018b8:	ff d0                	call   *%rax
+  8018ba:	85 c0                	test   %eax,%eax
+  8018bc:	78 35                	js     8018f3 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8018be:	41 8b 46 08          	mov    0x8(%r14),%eax
+  8018c2:	83 e0 03             	and    $0x3,%eax
+  8018c5:	83 f8 01             	cmp    $0x1,%eax
+  8018c8:	74 2d                	je     8018f7 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  8018ca:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8018ce:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8018d2:	48 85 c0             	test   %rax,%rax
+  8018d5:	74 56                	je     80192d <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  8018d7:	4c 89 ea             	mov    %r13,%rdx
+  8018da:	4c 89 e6             	mov    %r12,%rsi
+  8018dd:	4c 89 f7             	mov    %r14,%rdi
+  8018e0:	ff d0                	call   *%rax
+}
+  8018e2:	48 83 c4 10          	add    $0x10,%rsp
+  8018e6:	5b                   	pop    %rbx
+  8018e7:	41 5c                	pop    %r12
+  8018e9:	41 5d                	pop    %r13
+  8018eb:	41 5e                	pop    %r14
+  8018ed:	5d                   	pop    %rbp
+  8018ee:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8018ef:	48 98                	cltq
+  8018f1:	eb ef                	jmp    8018e2 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8018f3:	48 98                	cltq
+  8018f5:	eb eb                	jmp    8018e2 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8018f7:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  8018fe:	00 00 00 
+  801901:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+  801907:	89 da                	mov    %ebx,%edx
+  801909:	48 bf 61 32 80 00 00 	movabs $0x803261,%rdi
+  801910:	00 00 00 
+  801913:	b8 00 00 00 00       	mov    $0x0,%eax
+  801918:	48 b9 c4 01 80 00 00 	movabs $0x8001c4,%rcx
+  80191f:	00 00 00 
+  801922:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801924:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80192b:	eb b5                	jmp    8018e2 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  80192d:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801934:	eb ac                	jmp    8018e2 <read+0x6a>
+
+0000000000801936 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801936:	55                   	push   %rbp
+  801937:	48 89 e5             	mov    %rsp,%rbp
+  80193a:	41 57                	push   %r15
+  80193c:	41 56                	push   %r14
+  80193e:	41 55                	push   %r13
+  801940:	41 54                	push   %r12
+  801942:	53                   	push   %rbx
+  801943:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  801947:	48 85 d2             	test   %rdx,%rdx
+  80194a:	74 54                	je     8019a0 <readn+0x6a>
+  80194c:	41 89 fd             	mov    %edi,%r13d
+  80194f:	49 89 f6             	mov    %rsi,%r14
+  801952:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  801955:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  80195a:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  80195f:	49 bf 78 18 80 00 00 	movabs $0x801878,%r15
+  801966:	00 00 00 
+  801969:	4c 89 e2             	mov    %r12,%rdx
+  80196c:	48 29 f2             	sub    %rsi,%rdx
+  80196f:	4c 01 f6             	add    %r14,%rsi
+  801972:	44 89 ef             	mov    %r13d,%edi
+  801975:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  801978:	85 c0                	test   %eax,%eax
+  80197a:	78 20                	js     80199c <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  80197c:	01 c3                	add    %eax,%ebx
+  80197e:	85 c0                	test   %eax,%eax
+  801980:	74 08                	je     80198a <readn+0x54>
+  801982:	48 63 f3             	movslq %ebx,%rsi
+  801985:	4c 39 e6             	cmp    %r12,%rsi
+  801988:	72 df                	jb     801969 <readn+0x33>
+    }
+    return res;
+  80198a:	48 63 c3             	movslq %ebx,%rax
+}
+  80198d:	48 83 c4 08          	add    $0x8,%rsp
+  801991:	5b                   	pop    %rbx
+  801992:	41 5c                	pop    %r12
+  801994:	41 5d                	pop    %r13
+  801996:	41 5e                	pop    %r14
+  801998:	41 5f                	pop    %r15
+  80199a:	5d                   	pop    %rbp
+  80199b:	c3                   	ret
+        if (inc < 0) return inc;
+  80199c:	48 98                	cltq
+  80199e:	eb ed                	jmp    80198d <readn+0x57>
+    int inc = 1, res = 0;
+  8019a0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8019a5:	eb e3                	jmp    80198a <readn+0x54>
+
+00000000008019a7 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  8019a7:	55                   	push   %rbp
+  8019a8:	48 89 e5             	mov    %rsp,%rbp
+  8019ab:	41 56                	push   %r14
+  8019ad:	41 55                	push   %r13
+  8019af:	41 54                	push   %r12
+  8019b1:	53                   	push   %rbx
+  8019b2:	48 83 ec 10          	sub    $0x10,%rsp
+  8019b6:	89 fb                	mov    %edi,%ebx
+  8019b8:	49 89 f4             	mov    %rsi,%r12
+  8019bb:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8019be:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8019c2:	48 b8 95 15 80 00 00 	movabs $0x801595,%rax
+  8019c9:	00 00 00 
+  8019cc:	ff d0                	call   *%rax
+  8019ce:	85 c0                	test   %eax,%eax
+  8019d0:	78 47                	js     801a19 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8019d2:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  8019d6:	41 8b 3e             	mov    (%r14),%edi
+  8019d9:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8019dd:	48 b8 e0 15 80 00 00 	movabs $0x8015e0,%rax
+  8019e4:	00 00 00 
+  8019e7:	ff d0                	call   *%rax
+  8019e9:	85 c0                	test   %eax,%eax
+  8019eb:	78 30                	js     801a1d <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8019ed:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  8019f2:	74 2d                	je     801a21 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  8019f4:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8019f8:	48 8b 40 18          	mov    0x18(%rax),%rax
+  8019fc:	48 85 c0             	test   %rax,%rax
+  8019ff:	74 56                	je     801a57 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  801a01:	4c 89 ea             	mov    %r13,%rdx
+  801a04:	4c 89 e6             	mov    %r12,%rsi
+  801a07:	4c 89 f7             	mov    %r14,%rdi
+  801a0a:	ff d0                	call   *%rax
+}
+  801a0c:	48 83 c4 10          	add    $0x10,%rsp
+  801a10:	5b                   	pop    %rbx
+  801a11:	41 5c                	pop    %r12
+  801a13:	41 5d                	pop    %r13
+  801a15:	41 5e                	pop    %r14
+  801a17:	5d                   	pop    %rbp
+  801a18:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801a19:	48 98                	cltq
+  801a1b:	eb ef                	jmp    801a0c <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801a1d:	48 98                	cltq
+  801a1f:	eb eb                	jmp    801a0c <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801a21:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801a28:	00 00 00 
+  801a2b:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+  801a31:	89 da                	mov    %ebx,%edx
+  801a33:	48 bf 7d 32 80 00 00 	movabs $0x80327d,%rdi
+  801a3a:	00 00 00 
+  801a3d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a42:	48 b9 c4 01 80 00 00 	movabs $0x8001c4,%rcx
+  801a49:	00 00 00 
+  801a4c:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801a4e:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801a55:	eb b5                	jmp    801a0c <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801a57:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801a5e:	eb ac                	jmp    801a0c <write+0x65>
+
+0000000000801a60 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  801a60:	55                   	push   %rbp
+  801a61:	48 89 e5             	mov    %rsp,%rbp
+  801a64:	53                   	push   %rbx
+  801a65:	48 83 ec 18          	sub    $0x18,%rsp
+  801a69:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801a6b:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801a6f:	48 b8 95 15 80 00 00 	movabs $0x801595,%rax
+  801a76:	00 00 00 
+  801a79:	ff d0                	call   *%rax
+  801a7b:	85 c0                	test   %eax,%eax
+  801a7d:	78 0c                	js     801a8b <seek+0x2b>
+
+    fd->fd_offset = offset;
+  801a7f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801a83:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  801a86:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801a8b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801a8f:	c9                   	leave
+  801a90:	c3                   	ret
+
+0000000000801a91 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  801a91:	55                   	push   %rbp
+  801a92:	48 89 e5             	mov    %rsp,%rbp
+  801a95:	41 55                	push   %r13
+  801a97:	41 54                	push   %r12
+  801a99:	53                   	push   %rbx
+  801a9a:	48 83 ec 18          	sub    $0x18,%rsp
+  801a9e:	89 fb                	mov    %edi,%ebx
+  801aa0:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801aa3:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801aa7:	48 b8 95 15 80 00 00 	movabs $0x801595,%rax
+  801aae:	00 00 00 
+  801ab1:	ff d0                	call   *%rax
+  801ab3:	85 c0                	test   %eax,%eax
+  801ab5:	78 38                	js     801aef <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801ab7:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  801abb:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  801abf:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801ac3:	48 b8 e0 15 80 00 00 	movabs $0x8015e0,%rax
+  801aca:	00 00 00 
+  801acd:	ff d0                	call   *%rax
+  801acf:	85 c0                	test   %eax,%eax
+  801ad1:	78 1c                	js     801aef <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801ad3:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  801ad8:	74 20                	je     801afa <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801ada:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801ade:	48 8b 40 30          	mov    0x30(%rax),%rax
+  801ae2:	48 85 c0             	test   %rax,%rax
+  801ae5:	74 47                	je     801b2e <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  801ae7:	44 89 e6             	mov    %r12d,%esi
+  801aea:	4c 89 ef             	mov    %r13,%rdi
+  801aed:	ff d0                	call   *%rax
+}
+  801aef:	48 83 c4 18          	add    $0x18,%rsp
+  801af3:	5b                   	pop    %rbx
+  801af4:	41 5c                	pop    %r12
+  801af6:	41 5d                	pop    %r13
+  801af8:	5d                   	pop    %rbp
+  801af9:	c3                   	ret
+                thisenv->env_id, fdnum);
+  801afa:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801b01:	00 00 00 
+  801b04:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801b0a:	89 da                	mov    %ebx,%edx
+  801b0c:	48 bf 40 32 80 00 00 	movabs $0x803240,%rdi
+  801b13:	00 00 00 
+  801b16:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b1b:	48 b9 c4 01 80 00 00 	movabs $0x8001c4,%rcx
+  801b22:	00 00 00 
+  801b25:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801b27:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801b2c:	eb c1                	jmp    801aef <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801b2e:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801b33:	eb ba                	jmp    801aef <ftruncate+0x5e>
+
+0000000000801b35 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  801b35:	55                   	push   %rbp
+  801b36:	48 89 e5             	mov    %rsp,%rbp
+  801b39:	41 54                	push   %r12
+  801b3b:	53                   	push   %rbx
+  801b3c:	48 83 ec 10          	sub    $0x10,%rsp
+  801b40:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801b43:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801b47:	48 b8 95 15 80 00 00 	movabs $0x801595,%rax
+  801b4e:	00 00 00 
+  801b51:	ff d0                	call   *%rax
+  801b53:	85 c0                	test   %eax,%eax
+  801b55:	78 4e                	js     801ba5 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801b57:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801b5b:	41 8b 3c 24          	mov    (%r12),%edi
+  801b5f:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801b63:	48 b8 e0 15 80 00 00 	movabs $0x8015e0,%rax
+  801b6a:	00 00 00 
+  801b6d:	ff d0                	call   *%rax
+  801b6f:	85 c0                	test   %eax,%eax
+  801b71:	78 32                	js     801ba5 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801b73:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801b77:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  801b7c:	74 30                	je     801bae <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  801b7e:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  801b81:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  801b88:	00 00 00 
+    stat->st_isdir = 0;
+  801b8b:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  801b92:	00 00 00 
+    stat->st_dev = dev;
+  801b95:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  801b9c:	48 89 de             	mov    %rbx,%rsi
+  801b9f:	4c 89 e7             	mov    %r12,%rdi
+  801ba2:	ff 50 28             	call   *0x28(%rax)
+}
+  801ba5:	48 83 c4 10          	add    $0x10,%rsp
+  801ba9:	5b                   	pop    %rbx
+  801baa:	41 5c                	pop    %r12
+  801bac:	5d                   	pop    %rbp
+  801bad:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801bae:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801bb3:	eb f0                	jmp    801ba5 <fstat+0x70>
+
+0000000000801bb5 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  801bb5:	55                   	push   %rbp
+  801bb6:	48 89 e5             	mov    %rsp,%rbp
+  801bb9:	41 54                	push   %r12
+  801bbb:	53                   	push   %rbx
+  801bbc:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  801bbf:	be 00 00 00 00       	mov    $0x0,%esi
+  801bc4:	48 b8 98 1f 80 00 00 	movabs $0x801f98,%rax
+  801bcb:	00 00 00 
+  801bce:	ff d0                	call   *%rax
+  801bd0:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  801bd2:	85 c0                	test   %eax,%eax
+  801bd4:	78 25                	js     801bfb <stat+0x46>
+
+    int res = fstat(fd, stat);
+  801bd6:	4c 89 e6             	mov    %r12,%rsi
+  801bd9:	89 c7                	mov    %eax,%edi
+  801bdb:	48 b8 35 1b 80 00 00 	movabs $0x801b35,%rax
+  801be2:	00 00 00 
+  801be5:	ff d0                	call   *%rax
+  801be7:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  801bea:	89 df                	mov    %ebx,%edi
+  801bec:	48 b8 fa 16 80 00 00 	movabs $0x8016fa,%rax
+  801bf3:	00 00 00 
+  801bf6:	ff d0                	call   *%rax
+
+    return res;
+  801bf8:	44 89 e3             	mov    %r12d,%ebx
+}
+  801bfb:	89 d8                	mov    %ebx,%eax
+  801bfd:	5b                   	pop    %rbx
+  801bfe:	41 5c                	pop    %r12
+  801c00:	5d                   	pop    %rbp
+  801c01:	c3                   	ret
+
+0000000000801c02 <fsipc>:
+ * response may be written back to fsipcbuf.
+ * type: request code, passed as the simple integer IPC value.
+ * dstva: virtual address at which to receive reply page, 0 if none.
+ * Returns result from the file server. */
+static int
+fsipc(unsigned type, void *dstva) {
+  801c02:	55                   	push   %rbp
+  801c03:	48 89 e5             	mov    %rsp,%rbp
+  801c06:	41 54                	push   %r12
+  801c08:	53                   	push   %rbx
+  801c09:	48 83 ec 10          	sub    $0x10,%rsp
+  801c0d:	41 89 fc             	mov    %edi,%r12d
+  801c10:	48 89 f3             	mov    %rsi,%rbx
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  801c13:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  801c1a:	00 00 00 
+  801c1d:	83 38 00             	cmpl   $0x0,(%rax)
+  801c20:	74 5e                	je     801c80 <fsipc+0x7e>
+    if (debug) {
+        cprintf("[%08x] fsipc %d %08x\n",
+                thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+    }
+
+    ipc_send(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW);
+  801c22:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  801c28:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  801c2d:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  801c34:	00 00 00 
+  801c37:	44 89 e6             	mov    %r12d,%esi
+  801c3a:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  801c41:	00 00 00 
+  801c44:	8b 38                	mov    (%rax),%edi
+  801c46:	48 b8 a2 2b 80 00 00 	movabs $0x802ba2,%rax
+  801c4d:	00 00 00 
+  801c50:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  801c52:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  801c59:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  801c5a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801c5f:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  801c63:	48 89 de             	mov    %rbx,%rsi
+  801c66:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c6b:	48 b8 cd 2a 80 00 00 	movabs $0x802acd,%rax
+  801c72:	00 00 00 
+  801c75:	ff d0                	call   *%rax
+}
+  801c77:	48 83 c4 10          	add    $0x10,%rsp
+  801c7b:	5b                   	pop    %rbx
+  801c7c:	41 5c                	pop    %r12
+  801c7e:	5d                   	pop    %rbp
+  801c7f:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  801c80:	bf 03 00 00 00       	mov    $0x3,%edi
+  801c85:	48 b8 45 2c 80 00 00 	movabs $0x802c45,%rax
+  801c8c:	00 00 00 
+  801c8f:	ff d0                	call   *%rax
+  801c91:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  801c98:	00 00 
+  801c9a:	eb 86                	jmp    801c22 <fsipc+0x20>
+
+0000000000801c9c <devfile_trunc>:
+    return 0;
+}
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  801c9c:	55                   	push   %rbp
+  801c9d:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801ca0:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  801ca7:	00 00 00 
+  801caa:	8b 57 0c             	mov    0xc(%rdi),%edx
+  801cad:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  801caf:	89 70 04             	mov    %esi,0x4(%rax)
+
+    return fsipc(FSREQ_SET_SIZE, NULL);
+  801cb2:	be 00 00 00 00       	mov    $0x0,%esi
+  801cb7:	bf 02 00 00 00       	mov    $0x2,%edi
+  801cbc:	48 b8 02 1c 80 00 00 	movabs $0x801c02,%rax
+  801cc3:	00 00 00 
+  801cc6:	ff d0                	call   *%rax
+}
+  801cc8:	5d                   	pop    %rbp
+  801cc9:	c3                   	ret
+
+0000000000801cca <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  801cca:	55                   	push   %rbp
+  801ccb:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801cce:	8b 47 0c             	mov    0xc(%rdi),%eax
+  801cd1:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  801cd8:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  801cda:	be 00 00 00 00       	mov    $0x0,%esi
+  801cdf:	bf 06 00 00 00       	mov    $0x6,%edi
+  801ce4:	48 b8 02 1c 80 00 00 	movabs $0x801c02,%rax
+  801ceb:	00 00 00 
+  801cee:	ff d0                	call   *%rax
+}
+  801cf0:	5d                   	pop    %rbp
+  801cf1:	c3                   	ret
+
+0000000000801cf2 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  801cf2:	55                   	push   %rbp
+  801cf3:	48 89 e5             	mov    %rsp,%rbp
+  801cf6:	41 54                	push   %r12
+  801cf8:	53                   	push   %rbx
+  801cf9:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801cfc:	8b 47 0c             	mov    0xc(%rdi),%eax
+  801cff:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  801d06:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  801d08:	be 00 00 00 00       	mov    $0x0,%esi
+  801d0d:	bf 05 00 00 00       	mov    $0x5,%edi
+  801d12:	48 b8 02 1c 80 00 00 	movabs $0x801c02,%rax
+  801d19:	00 00 00 
+  801d1c:	ff d0                	call   *%rax
+    if (res < 0) {
+  801d1e:	85 c0                	test   %eax,%eax
+  801d20:	78 3d                	js     801d5f <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801d22:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  801d29:	00 00 00 
+  801d2c:	4c 89 e6             	mov    %r12,%rsi
+  801d2f:	48 89 df             	mov    %rbx,%rdi
+  801d32:	48 b8 e9 0a 80 00 00 	movabs $0x800ae9,%rax
+  801d39:	00 00 00 
+  801d3c:	ff d0                	call   *%rax
+    st->st_size  = fsipcbuf.statRet.ret_size;
+  801d3e:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  801d45:	00 
+  801d46:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801d4c:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  801d53:	00 
+  801d54:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  801d5a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801d5f:	5b                   	pop    %rbx
+  801d60:	41 5c                	pop    %r12
+  801d62:	5d                   	pop    %rbp
+  801d63:	c3                   	ret
+
+0000000000801d64 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  801d64:	55                   	push   %rbp
+  801d65:	48 89 e5             	mov    %rsp,%rbp
+  801d68:	41 57                	push   %r15
+  801d6a:	41 56                	push   %r14
+  801d6c:	41 55                	push   %r13
+  801d6e:	41 54                	push   %r12
+  801d70:	53                   	push   %rbx
+  801d71:	48 83 ec 18          	sub    $0x18,%rsp
+  801d75:	49 89 fe             	mov    %rdi,%r14
+  801d78:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+  801d7c:	48 89 d3             	mov    %rdx,%rbx
+    while (n > sizeof(fsipcbuf.write.req_buf))
+  801d7f:	48 81 fa f0 0f 00 00 	cmp    $0xff0,%rdx
+  801d86:	0f 86 e4 00 00 00    	jbe    801e70 <devfile_write+0x10c>
+  801d8c:	49 89 f4             	mov    %rsi,%r12
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801d8f:	49 bd 00 60 80 00 00 	movabs $0x806000,%r13
+  801d96:	00 00 00 
+        memcpy(fsipcbuf.write.req_buf, buf, sizeof(fsipcbuf.write.req_buf));
+  801d99:	49 bf 4a 0d 80 00 00 	movabs $0x800d4a,%r15
+  801da0:	00 00 00 
+  801da3:	eb 03                	jmp    801da8 <devfile_write+0x44>
+        buf += sizeof(fsipcbuf.write.req_buf);
+  801da5:	49 89 f4             	mov    %rsi,%r12
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801da8:	41 8b 46 0c          	mov    0xc(%r14),%eax
+  801dac:	41 89 45 00          	mov    %eax,0x0(%r13)
+        fsipcbuf.write.req_n      = sizeof(fsipcbuf.write.req_buf);
+  801db0:	49 c7 45 08 f0 0f 00 	movq   $0xff0,0x8(%r13)
+  801db7:	00 
+        memcpy(fsipcbuf.write.req_buf, buf, sizeof(fsipcbuf.write.req_buf));
+  801db8:	ba f0 0f 00 00       	mov    $0xff0,%edx
+  801dbd:	4c 89 e6             	mov    %r12,%rsi
+  801dc0:	48 bf 10 60 80 00 00 	movabs $0x806010,%rdi
+  801dc7:	00 00 00 
+  801dca:	41 ff d7             	call   *%r15
+        ssize_t res = fsipc(FSREQ_WRITE, NULL);
+  801dcd:	be 00 00 00 00       	mov    $0x0,%esi
+  801dd2:	bf 04 00 00 00       	mov    $0x4,%edi
+  801dd7:	48 b8 02 1c 80 00 00 	movabs $0x801c02,%rax
+  801dde:	00 00 00 
+  801de1:	ff d0                	call   *%rax
+  801de3:	48 63 d0             	movslq %eax,%rdx
+        if (res < 0 || res < sizeof(fsipcbuf.write.req_buf))
+  801de6:	3d ef 0f 00 00       	cmp    $0xfef,%eax
+  801deb:	7e 71                	jle    801e5e <devfile_write+0xfa>
+        buf += sizeof(fsipcbuf.write.req_buf);
+  801ded:	49 8d b4 24 f0 0f 00 	lea    0xff0(%r12),%rsi
+  801df4:	00 
+        n -= sizeof(fsipcbuf.write.req_buf);
+  801df5:	48 81 eb f0 0f 00 00 	sub    $0xff0,%rbx
+    while (n > sizeof(fsipcbuf.write.req_buf))
+  801dfc:	48 81 fb f0 0f 00 00 	cmp    $0xff0,%rbx
+  801e03:	77 a0                	ja     801da5 <devfile_write+0x41>
+        written += sizeof(fsipcbuf.write.req_buf);
+  801e05:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801e09:	49 29 c4             	sub    %rax,%r12
+  801e0c:	4d 8d a4 24 f0 0f 00 	lea    0xff0(%r12),%r12
+  801e13:	00 
+    fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801e14:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  801e1b:	00 00 00 
+  801e1e:	41 8b 56 0c          	mov    0xc(%r14),%edx
+  801e22:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.write.req_n      = n;
+  801e24:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    memcpy(fsipcbuf.write.req_buf, buf, n);
+  801e28:	48 89 da             	mov    %rbx,%rdx
+  801e2b:	48 8d 78 10          	lea    0x10(%rax),%rdi
+  801e2f:	48 b8 4a 0d 80 00 00 	movabs $0x800d4a,%rax
+  801e36:	00 00 00 
+  801e39:	ff d0                	call   *%rax
+    ssize_t res = fsipc(FSREQ_WRITE, NULL);
+  801e3b:	be 00 00 00 00       	mov    $0x0,%esi
+  801e40:	bf 04 00 00 00       	mov    $0x4,%edi
+  801e45:	48 b8 02 1c 80 00 00 	movabs $0x801c02,%rax
+  801e4c:	00 00 00 
+  801e4f:	ff d0                	call   *%rax
+  801e51:	48 63 d0             	movslq %eax,%rdx
+    written += res;
+  801e54:	49 01 d4             	add    %rdx,%r12
+  801e57:	48 85 d2             	test   %rdx,%rdx
+  801e5a:	49 0f 49 d4          	cmovns %r12,%rdx
+}
+  801e5e:	48 89 d0             	mov    %rdx,%rax
+  801e61:	48 83 c4 18          	add    $0x18,%rsp
+  801e65:	5b                   	pop    %rbx
+  801e66:	41 5c                	pop    %r12
+  801e68:	41 5d                	pop    %r13
+  801e6a:	41 5e                	pop    %r14
+  801e6c:	41 5f                	pop    %r15
+  801e6e:	5d                   	pop    %rbp
+  801e6f:	c3                   	ret
+    while (n > sizeof(fsipcbuf.write.req_buf))
+  801e70:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+    ssize_t written = 0;
+  801e74:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  801e7a:	eb 98                	jmp    801e14 <devfile_write+0xb0>
+
+0000000000801e7c <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  801e7c:	55                   	push   %rbp
+  801e7d:	48 89 e5             	mov    %rsp,%rbp
+  801e80:	41 57                	push   %r15
+  801e82:	41 56                	push   %r14
+  801e84:	41 55                	push   %r13
+  801e86:	41 54                	push   %r12
+  801e88:	53                   	push   %rbx
+  801e89:	48 83 ec 18          	sub    $0x18,%rsp
+  801e8d:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  801e91:	49 89 f6             	mov    %rsi,%r14
+  801e94:	49 89 d4             	mov    %rdx,%r12
+    while (n > sizeof(fsipcbuf.readRet.ret_buf))
+  801e97:	48 81 fa 00 10 00 00 	cmp    $0x1000,%rdx
+  801e9e:	0f 86 ea 00 00 00    	jbe    801f8e <devfile_read+0x112>
+    ssize_t readsz = 0;
+  801ea4:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  801eab:	00 
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801eac:	49 bf 00 60 80 00 00 	movabs $0x806000,%r15
+  801eb3:	00 00 00 
+  801eb6:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801eba:	8b 40 0c             	mov    0xc(%rax),%eax
+  801ebd:	41 89 07             	mov    %eax,(%r15)
+        fsipcbuf.read.req_n = sizeof(fsipcbuf.readRet.ret_buf);
+  801ec0:	49 c7 47 08 00 10 00 	movq   $0x1000,0x8(%r15)
+  801ec7:	00 
+        ssize_t res = fsipc(FSREQ_READ, NULL);
+  801ec8:	be 00 00 00 00       	mov    $0x0,%esi
+  801ecd:	bf 03 00 00 00       	mov    $0x3,%edi
+  801ed2:	48 b8 02 1c 80 00 00 	movabs $0x801c02,%rax
+  801ed9:	00 00 00 
+  801edc:	ff d0                	call   *%rax
+  801ede:	4c 63 e8             	movslq %eax,%r13
+        if (res < 0)
+  801ee1:	4d 85 ed             	test   %r13,%r13
+  801ee4:	0f 88 92 00 00 00    	js     801f7c <devfile_read+0x100>
+        memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  801eea:	4c 89 ea             	mov    %r13,%rdx
+  801eed:	4c 89 fe             	mov    %r15,%rsi
+  801ef0:	4c 89 f7             	mov    %r14,%rdi
+  801ef3:	48 b8 4a 0d 80 00 00 	movabs $0x800d4a,%rax
+  801efa:	00 00 00 
+  801efd:	ff d0                	call   *%rax
+        if (res < sizeof(fsipcbuf.readRet.ret_buf))
+  801eff:	49 81 fd ff 0f 00 00 	cmp    $0xfff,%r13
+  801f06:	76 6d                	jbe    801f75 <devfile_read+0xf9>
+        readsz += res;
+  801f08:	4c 01 6d c0          	add    %r13,-0x40(%rbp)
+        buf += res;
+  801f0c:	4d 01 ee             	add    %r13,%r14
+        n -= res;
+  801f0f:	4d 29 ec             	sub    %r13,%r12
+    while (n > sizeof(fsipcbuf.readRet.ret_buf))
+  801f12:	49 81 fc 00 10 00 00 	cmp    $0x1000,%r12
+  801f19:	77 9b                	ja     801eb6 <devfile_read+0x3a>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801f1b:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  801f22:	00 00 00 
+  801f25:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  801f29:	8b 51 0c             	mov    0xc(%rcx),%edx
+  801f2c:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.read.req_n = n;
+  801f2e:	4c 89 60 08          	mov    %r12,0x8(%rax)
+    ssize_t res = fsipc(FSREQ_READ, NULL);
+  801f32:	be 00 00 00 00       	mov    $0x0,%esi
+  801f37:	bf 03 00 00 00       	mov    $0x3,%edi
+  801f3c:	48 b8 02 1c 80 00 00 	movabs $0x801c02,%rax
+  801f43:	00 00 00 
+  801f46:	ff d0                	call   *%rax
+  801f48:	4c 63 e8             	movslq %eax,%r13
+    if (res < 0)
+  801f4b:	4d 85 ed             	test   %r13,%r13
+  801f4e:	78 2c                	js     801f7c <devfile_read+0x100>
+    memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  801f50:	4c 89 ea             	mov    %r13,%rdx
+  801f53:	48 be 00 60 80 00 00 	movabs $0x806000,%rsi
+  801f5a:	00 00 00 
+  801f5d:	4c 89 f7             	mov    %r14,%rdi
+  801f60:	48 b8 4a 0d 80 00 00 	movabs $0x800d4a,%rax
+  801f67:	00 00 00 
+  801f6a:	ff d0                	call   *%rax
+    readsz += res;
+  801f6c:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  801f70:	49 01 c5             	add    %rax,%r13
+    return readsz;
+  801f73:	eb 07                	jmp    801f7c <devfile_read+0x100>
+            return readsz + res;
+  801f75:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  801f79:	49 01 c5             	add    %rax,%r13
+}
+  801f7c:	4c 89 e8             	mov    %r13,%rax
+  801f7f:	48 83 c4 18          	add    $0x18,%rsp
+  801f83:	5b                   	pop    %rbx
+  801f84:	41 5c                	pop    %r12
+  801f86:	41 5d                	pop    %r13
+  801f88:	41 5e                	pop    %r14
+  801f8a:	41 5f                	pop    %r15
+  801f8c:	5d                   	pop    %rbp
+  801f8d:	c3                   	ret
+    ssize_t readsz = 0;
+  801f8e:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  801f95:	00 
+  801f96:	eb 83                	jmp    801f1b <devfile_read+0x9f>
+
+0000000000801f98 <open>:
+open(const char *path, int mode) {
+  801f98:	55                   	push   %rbp
+  801f99:	48 89 e5             	mov    %rsp,%rbp
+  801f9c:	41 55                	push   %r13
+  801f9e:	41 54                	push   %r12
+  801fa0:	53                   	push   %rbx
+  801fa1:	48 83 ec 18          	sub    $0x18,%rsp
+  801fa5:	49 89 fc             	mov    %rdi,%r12
+  801fa8:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  801fab:	48 b8 ab 0a 80 00 00 	movabs $0x800aab,%rax
+  801fb2:	00 00 00 
+  801fb5:	ff d0                	call   *%rax
+  801fb7:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  801fbd:	0f 87 8a 00 00 00    	ja     80204d <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  801fc3:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  801fc7:	48 b8 7b 15 80 00 00 	movabs $0x80157b,%rax
+  801fce:	00 00 00 
+  801fd1:	ff d0                	call   *%rax
+  801fd3:	89 c3                	mov    %eax,%ebx
+  801fd5:	85 c0                	test   %eax,%eax
+  801fd7:	78 50                	js     802029 <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  801fd9:	4c 89 e6             	mov    %r12,%rsi
+  801fdc:	48 bb 00 60 80 00 00 	movabs $0x806000,%rbx
+  801fe3:	00 00 00 
+  801fe6:	48 89 df             	mov    %rbx,%rdi
+  801fe9:	48 b8 e9 0a 80 00 00 	movabs $0x800ae9,%rax
+  801ff0:	00 00 00 
+  801ff3:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  801ff5:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801ffc:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802000:	bf 01 00 00 00       	mov    $0x1,%edi
+  802005:	48 b8 02 1c 80 00 00 	movabs $0x801c02,%rax
+  80200c:	00 00 00 
+  80200f:	ff d0                	call   *%rax
+  802011:	89 c3                	mov    %eax,%ebx
+  802013:	85 c0                	test   %eax,%eax
+  802015:	78 1f                	js     802036 <open+0x9e>
+    return fd2num(fd);
+  802017:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80201b:	48 b8 d4 14 80 00 00 	movabs $0x8014d4,%rax
+  802022:	00 00 00 
+  802025:	ff d0                	call   *%rax
+  802027:	89 c3                	mov    %eax,%ebx
+}
+  802029:	89 d8                	mov    %ebx,%eax
+  80202b:	48 83 c4 18          	add    $0x18,%rsp
+  80202f:	5b                   	pop    %rbx
+  802030:	41 5c                	pop    %r12
+  802032:	41 5d                	pop    %r13
+  802034:	5d                   	pop    %rbp
+  802035:	c3                   	ret
+        fd_close(fd, 0);
+  802036:	be 00 00 00 00       	mov    $0x0,%esi
+  80203b:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80203f:	48 b8 50 16 80 00 00 	movabs $0x801650,%rax
+  802046:	00 00 00 
+  802049:	ff d0                	call   *%rax
+        return res;
+  80204b:	eb dc                	jmp    802029 <open+0x91>
+        return -E_BAD_PATH;
+  80204d:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  802052:	eb d5                	jmp    802029 <open+0x91>
+
+0000000000802054 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  802054:	55                   	push   %rbp
+  802055:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc(FSREQ_SYNC, NULL);
+  802058:	be 00 00 00 00       	mov    $0x0,%esi
+  80205d:	bf 08 00 00 00       	mov    $0x8,%edi
+  802062:	48 b8 02 1c 80 00 00 	movabs $0x801c02,%rax
+  802069:	00 00 00 
+  80206c:	ff d0                	call   *%rax
+}
+  80206e:	5d                   	pop    %rbp
+  80206f:	c3                   	ret
+
+0000000000802070 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  802070:	55                   	push   %rbp
+  802071:	48 89 e5             	mov    %rsp,%rbp
+  802074:	41 54                	push   %r12
+  802076:	53                   	push   %rbx
+  802077:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80207a:	48 b8 e6 14 80 00 00 	movabs $0x8014e6,%rax
+  802081:	00 00 00 
+  802084:	ff d0                	call   *%rax
+  802086:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  802089:	48 be c0 32 80 00 00 	movabs $0x8032c0,%rsi
+  802090:	00 00 00 
+  802093:	48 89 df             	mov    %rbx,%rdi
+  802096:	48 b8 e9 0a 80 00 00 	movabs $0x800ae9,%rax
+  80209d:	00 00 00 
+  8020a0:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  8020a2:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  8020a7:	41 2b 04 24          	sub    (%r12),%eax
+  8020ab:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  8020b1:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8020b8:	00 00 00 
+    stat->st_dev = &devpipe;
+  8020bb:	48 b8 60 40 80 00 00 	movabs $0x804060,%rax
+  8020c2:	00 00 00 
+  8020c5:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  8020cc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020d1:	5b                   	pop    %rbx
+  8020d2:	41 5c                	pop    %r12
+  8020d4:	5d                   	pop    %rbp
+  8020d5:	c3                   	ret
+
+00000000008020d6 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  8020d6:	55                   	push   %rbp
+  8020d7:	48 89 e5             	mov    %rsp,%rbp
+  8020da:	41 54                	push   %r12
+  8020dc:	53                   	push   %rbx
+  8020dd:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8020e0:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8020e5:	48 89 fe             	mov    %rdi,%rsi
+  8020e8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8020ed:	49 bc 65 11 80 00 00 	movabs $0x801165,%r12
+  8020f4:	00 00 00 
+  8020f7:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  8020fa:	48 89 df             	mov    %rbx,%rdi
+  8020fd:	48 b8 e6 14 80 00 00 	movabs $0x8014e6,%rax
+  802104:	00 00 00 
+  802107:	ff d0                	call   *%rax
+  802109:	48 89 c6             	mov    %rax,%rsi
+  80210c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802111:	bf 00 00 00 00       	mov    $0x0,%edi
+  802116:	41 ff d4             	call   *%r12
+}
+  802119:	5b                   	pop    %rbx
+  80211a:	41 5c                	pop    %r12
+  80211c:	5d                   	pop    %rbp
+  80211d:	c3                   	ret
+
+000000000080211e <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  80211e:	55                   	push   %rbp
+  80211f:	48 89 e5             	mov    %rsp,%rbp
+  802122:	41 57                	push   %r15
+  802124:	41 56                	push   %r14
+  802126:	41 55                	push   %r13
+  802128:	41 54                	push   %r12
+  80212a:	53                   	push   %rbx
+  80212b:	48 83 ec 18          	sub    $0x18,%rsp
+  80212f:	49 89 fc             	mov    %rdi,%r12
+  802132:	49 89 f5             	mov    %rsi,%r13
+  802135:	49 89 d7             	mov    %rdx,%r15
+  802138:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80213c:	48 b8 e6 14 80 00 00 	movabs $0x8014e6,%rax
+  802143:	00 00 00 
+  802146:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  802148:	4d 85 ff             	test   %r15,%r15
+  80214b:	0f 84 af 00 00 00    	je     802200 <devpipe_write+0xe2>
+  802151:	48 89 c3             	mov    %rax,%rbx
+  802154:	4c 89 f8             	mov    %r15,%rax
+  802157:	4d 89 ef             	mov    %r13,%r15
+  80215a:	4c 01 e8             	add    %r13,%rax
+  80215d:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802161:	49 bd 6d 10 80 00 00 	movabs $0x80106d,%r13
+  802168:	00 00 00 
+            sys_yield();
+  80216b:	49 be 0a 10 80 00 00 	movabs $0x80100a,%r14
+  802172:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  802175:	8b 73 04             	mov    0x4(%rbx),%esi
+  802178:	48 63 ce             	movslq %esi,%rcx
+  80217b:	48 63 03             	movslq (%rbx),%rax
+  80217e:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  802184:	48 39 c1             	cmp    %rax,%rcx
+  802187:	72 2e                	jb     8021b7 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802189:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80218e:	48 89 da             	mov    %rbx,%rdx
+  802191:	be 00 10 00 00       	mov    $0x1000,%esi
+  802196:	4c 89 e7             	mov    %r12,%rdi
+  802199:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  80219c:	85 c0                	test   %eax,%eax
+  80219e:	74 66                	je     802206 <devpipe_write+0xe8>
+            sys_yield();
+  8021a0:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  8021a3:	8b 73 04             	mov    0x4(%rbx),%esi
+  8021a6:	48 63 ce             	movslq %esi,%rcx
+  8021a9:	48 63 03             	movslq (%rbx),%rax
+  8021ac:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  8021b2:	48 39 c1             	cmp    %rax,%rcx
+  8021b5:	73 d2                	jae    802189 <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8021b7:	41 0f b6 3f          	movzbl (%r15),%edi
+  8021bb:	48 89 ca             	mov    %rcx,%rdx
+  8021be:	48 c1 ea 03          	shr    $0x3,%rdx
+  8021c2:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  8021c9:	08 10 20 
+  8021cc:	48 f7 e2             	mul    %rdx
+  8021cf:	48 c1 ea 06          	shr    $0x6,%rdx
+  8021d3:	48 89 d0             	mov    %rdx,%rax
+  8021d6:	48 c1 e0 09          	shl    $0x9,%rax
+  8021da:	48 29 d0             	sub    %rdx,%rax
+  8021dd:	48 c1 e0 03          	shl    $0x3,%rax
+  8021e1:	48 29 c1             	sub    %rax,%rcx
+  8021e4:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  8021e9:	83 c6 01             	add    $0x1,%esi
+  8021ec:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8021ef:	49 83 c7 01          	add    $0x1,%r15
+  8021f3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8021f7:	49 39 c7             	cmp    %rax,%r15
+  8021fa:	0f 85 75 ff ff ff    	jne    802175 <devpipe_write+0x57>
+    return n;
+  802200:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802204:	eb 05                	jmp    80220b <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  802206:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80220b:	48 83 c4 18          	add    $0x18,%rsp
+  80220f:	5b                   	pop    %rbx
+  802210:	41 5c                	pop    %r12
+  802212:	41 5d                	pop    %r13
+  802214:	41 5e                	pop    %r14
+  802216:	41 5f                	pop    %r15
+  802218:	5d                   	pop    %rbp
+  802219:	c3                   	ret
+
+000000000080221a <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  80221a:	55                   	push   %rbp
+  80221b:	48 89 e5             	mov    %rsp,%rbp
+  80221e:	41 57                	push   %r15
+  802220:	41 56                	push   %r14
+  802222:	41 55                	push   %r13
+  802224:	41 54                	push   %r12
+  802226:	53                   	push   %rbx
+  802227:	48 83 ec 18          	sub    $0x18,%rsp
+  80222b:	49 89 fc             	mov    %rdi,%r12
+  80222e:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  802232:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802236:	48 b8 e6 14 80 00 00 	movabs $0x8014e6,%rax
+  80223d:	00 00 00 
+  802240:	ff d0                	call   *%rax
+  802242:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  802245:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80224b:	49 bd 6d 10 80 00 00 	movabs $0x80106d,%r13
+  802252:	00 00 00 
+            sys_yield();
+  802255:	49 be 0a 10 80 00 00 	movabs $0x80100a,%r14
+  80225c:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  80225f:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  802264:	74 7d                	je     8022e3 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  802266:	8b 03                	mov    (%rbx),%eax
+  802268:	3b 43 04             	cmp    0x4(%rbx),%eax
+  80226b:	75 26                	jne    802293 <devpipe_read+0x79>
+            if (i > 0) return i;
+  80226d:	4d 85 ff             	test   %r15,%r15
+  802270:	75 77                	jne    8022e9 <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802272:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802277:	48 89 da             	mov    %rbx,%rdx
+  80227a:	be 00 10 00 00       	mov    $0x1000,%esi
+  80227f:	4c 89 e7             	mov    %r12,%rdi
+  802282:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  802285:	85 c0                	test   %eax,%eax
+  802287:	74 72                	je     8022fb <devpipe_read+0xe1>
+            sys_yield();
+  802289:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  80228c:	8b 03                	mov    (%rbx),%eax
+  80228e:	3b 43 04             	cmp    0x4(%rbx),%eax
+  802291:	74 df                	je     802272 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802293:	48 63 c8             	movslq %eax,%rcx
+  802296:	48 89 ca             	mov    %rcx,%rdx
+  802299:	48 c1 ea 03          	shr    $0x3,%rdx
+  80229d:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  8022a4:	08 10 20 
+  8022a7:	48 89 d0             	mov    %rdx,%rax
+  8022aa:	48 f7 e6             	mul    %rsi
+  8022ad:	48 c1 ea 06          	shr    $0x6,%rdx
+  8022b1:	48 89 d0             	mov    %rdx,%rax
+  8022b4:	48 c1 e0 09          	shl    $0x9,%rax
+  8022b8:	48 29 d0             	sub    %rdx,%rax
+  8022bb:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  8022c2:	00 
+  8022c3:	48 89 c8             	mov    %rcx,%rax
+  8022c6:	48 29 d0             	sub    %rdx,%rax
+  8022c9:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  8022ce:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8022d2:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  8022d6:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8022d9:	49 83 c7 01          	add    $0x1,%r15
+  8022dd:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  8022e1:	75 83                	jne    802266 <devpipe_read+0x4c>
+    return n;
+  8022e3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8022e7:	eb 03                	jmp    8022ec <devpipe_read+0xd2>
+            if (i > 0) return i;
+  8022e9:	4c 89 f8             	mov    %r15,%rax
+}
+  8022ec:	48 83 c4 18          	add    $0x18,%rsp
+  8022f0:	5b                   	pop    %rbx
+  8022f1:	41 5c                	pop    %r12
+  8022f3:	41 5d                	pop    %r13
+  8022f5:	41 5e                	pop    %r14
+  8022f7:	41 5f                	pop    %r15
+  8022f9:	5d                   	pop    %rbp
+  8022fa:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  8022fb:	b8 00 00 00 00       	mov    $0x0,%eax
+  802300:	eb ea                	jmp    8022ec <devpipe_read+0xd2>
+
+0000000000802302 <pipe>:
+pipe(int pfd[2]) {
+  802302:	55                   	push   %rbp
+  802303:	48 89 e5             	mov    %rsp,%rbp
+  802306:	41 55                	push   %r13
+  802308:	41 54                	push   %r12
+  80230a:	53                   	push   %rbx
+  80230b:	48 81 ec b8 00 00 00 	sub    $0xb8,%rsp
+  802312:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  802315:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802319:	48 b8 7b 15 80 00 00 	movabs $0x80157b,%rax
+  802320:	00 00 00 
+  802323:	ff d0                	call   *%rax
+  802325:	89 c3                	mov    %eax,%ebx
+  802327:	85 c0                	test   %eax,%eax
+  802329:	0f 88 51 01 00 00    	js     802480 <pipe+0x17e>
+        (res = fd_alloc_from(fd2num(fd0) + 1, &fd1)) < 0) goto err;
+  80232f:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802333:	48 b8 d4 14 80 00 00 	movabs $0x8014d4,%rax
+  80233a:	00 00 00 
+  80233d:	ff d0                	call   *%rax
+  80233f:	8d 78 01             	lea    0x1(%rax),%edi
+  802342:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802346:	48 b8 02 15 80 00 00 	movabs $0x801502,%rax
+  80234d:	00 00 00 
+  802350:	ff d0                	call   *%rax
+  802352:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  802354:	85 c0                	test   %eax,%eax
+  802356:	0f 88 24 01 00 00    	js     802480 <pipe+0x17e>
+    va = fd2data(fd0);
+  80235c:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802360:	48 bb e6 14 80 00 00 	movabs $0x8014e6,%rbx
+  802367:	00 00 00 
+  80236a:	ff d3                	call   *%rbx
+  80236c:	49 89 c5             	mov    %rax,%r13
+    struct RegionOp ops[] = {
+  80236f:	48 8d bd 30 ff ff ff 	lea    -0xd0(%rbp),%rdi
+  802376:	b9 14 00 00 00       	mov    $0x14,%ecx
+  80237b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802380:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+  802383:	c7 85 34 ff ff ff 46 	movl   $0x46,-0xcc(%rbp)
+  80238a:	00 00 00 
+  80238d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802391:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+  802398:	48 c7 85 50 ff ff ff 	movq   $0x1000,-0xb0(%rbp)
+  80239f:	00 10 00 00 
+  8023a3:	c7 85 5c ff ff ff 46 	movl   $0x46,-0xa4(%rbp)
+  8023aa:	00 00 00 
+            {.type = REGION_ALLOC, .dstva = (uintptr_t)fd1, .size = PAGE_SIZE, .perm = PROT_RW | PROT_SHARE},
+  8023ad:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+    struct RegionOp ops[] = {
+  8023b1:	48 89 bd 70 ff ff ff 	mov    %rdi,-0x90(%rbp)
+  8023b8:	48 c7 85 78 ff ff ff 	movq   $0x1000,-0x88(%rbp)
+  8023bf:	00 10 00 00 
+  8023c3:	c7 45 84 46 00 00 00 	movl   $0x46,-0x7c(%rbp)
+  8023ca:	4c 89 6d 98          	mov    %r13,-0x68(%rbp)
+  8023ce:	48 c7 45 a0 00 10 00 	movq   $0x1000,-0x60(%rbp)
+  8023d5:	00 
+  8023d6:	c7 45 a8 01 00 00 00 	movl   $0x1,-0x58(%rbp)
+  8023dd:	c7 45 ac 46 00 00 00 	movl   $0x46,-0x54(%rbp)
+  8023e4:	4c 89 6d b8          	mov    %r13,-0x48(%rbp)
+            {.type = REGION_MAP, .srcva = (uintptr_t)va, .dstva = (uintptr_t)fd2data(fd1), .size = PAGE_SIZE, .perm = PROT_RW | PROT_SHARE},
+  8023e8:	ff d3                	call   *%rbx
+    struct RegionOp ops[] = {
+  8023ea:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8023ee:	48 c7 45 c8 00 10 00 	movq   $0x1000,-0x38(%rbp)
+  8023f5:	00 
+    if ((res = sys_region_batch(ops, sizeof ops / sizeof *ops)) < 0) goto err1;
+  8023f6:	be 04 00 00 00       	mov    $0x4,%esi
+  8023fb:	48 8d bd 30 ff ff ff 	lea    -0xd0(%rbp),%rdi
+  802402:	48 b8 cc 11 80 00 00 	movabs $0x8011cc,%rax
+  802409:	00 00 00 
+  80240c:	ff d0                	call   *%rax
+  80240e:	89 c3                	mov    %eax,%ebx
+  802410:	85 c0                	test   %eax,%eax
+  802412:	0f 88 ad 00 00 00    	js     8024c5 <pipe+0x1c3>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  802418:	be 00 10 00 00       	mov    $0x1000,%esi
+  80241d:	4c 89 ef             	mov    %r13,%rdi
+  802420:	48 b8 3b 10 80 00 00 	movabs $0x80103b,%rax
+  802427:	00 00 00 
+  80242a:	ff d0                	call   *%rax
+  80242c:	83 f8 02             	cmp    $0x2,%eax
+  80242f:	75 5f                	jne    802490 <pipe+0x18e>
+    fd0->fd_dev_id = devpipe.dev_id;
+  802431:	a1 60 40 80 00 00 00 	movabs 0x804060,%eax
+  802438:	00 00 
+  80243a:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80243e:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  802440:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802444:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  80244b:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  80244f:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  802451:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802455:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  80245c:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802460:	48 bb d4 14 80 00 00 	movabs $0x8014d4,%rbx
+  802467:	00 00 00 
+  80246a:	ff d3                	call   *%rbx
+  80246c:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  802470:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  802474:	ff d3                	call   *%rbx
+  802476:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  80247b:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  802480:	89 d8                	mov    %ebx,%eax
+  802482:	48 81 c4 b8 00 00 00 	add    $0xb8,%rsp
+  802489:	5b                   	pop    %rbx
+  80248a:	41 5c                	pop    %r12
+  80248c:	41 5d                	pop    %r13
+  80248e:	5d                   	pop    %rbp
+  80248f:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  802490:	48 b9 f0 32 80 00 00 	movabs $0x8032f0,%rcx
+  802497:	00 00 00 
+  80249a:	48 ba c7 32 80 00 00 	movabs $0x8032c7,%rdx
+  8024a1:	00 00 00 
+  8024a4:	be 33 00 00 00       	mov    $0x33,%esi
+  8024a9:	48 bf dc 32 80 00 00 	movabs $0x8032dc,%rdi
+  8024b0:	00 00 00 
+  8024b3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024b8:	49 b8 2a 2a 80 00 00 	movabs $0x802a2a,%r8
+  8024bf:	00 00 00 
+  8024c2:	41 ff d0             	call   *%r8
+        ops[i].type = REGION_UNMAP;
+  8024c5:	c7 85 30 ff ff ff 02 	movl   $0x2,-0xd0(%rbp)
+  8024cc:	00 00 00 
+  8024cf:	c7 85 58 ff ff ff 02 	movl   $0x2,-0xa8(%rbp)
+  8024d6:	00 00 00 
+  8024d9:	c7 45 80 02 00 00 00 	movl   $0x2,-0x80(%rbp)
+  8024e0:	c7 45 a8 02 00 00 00 	movl   $0x2,-0x58(%rbp)
+    sys_region_batch(ops, sizeof ops / sizeof *ops);
+  8024e7:	be 04 00 00 00       	mov    $0x4,%esi
+  8024ec:	48 8d bd 30 ff ff ff 	lea    -0xd0(%rbp),%rdi
+  8024f3:	48 b8 cc 11 80 00 00 	movabs $0x8011cc,%rax
+  8024fa:	00 00 00 
+  8024fd:	ff d0                	call   *%rax
+  8024ff:	e9 7c ff ff ff       	jmp    802480 <pipe+0x17e>
+
+0000000000802504 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  802504:	55                   	push   %rbp
+  802505:	48 89 e5             	mov    %rsp,%rbp
+  802508:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  80250c:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802510:	48 b8 95 15 80 00 00 	movabs $0x801595,%rax
+  802517:	00 00 00 
+  80251a:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80251c:	85 c0                	test   %eax,%eax
+  80251e:	78 35                	js     802555 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  802520:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802524:	48 b8 e6 14 80 00 00 	movabs $0x8014e6,%rax
+  80252b:	00 00 00 
+  80252e:	ff d0                	call   *%rax
+  802530:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802533:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802538:	be 00 10 00 00       	mov    $0x1000,%esi
+  80253d:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802541:	48 b8 6d 10 80 00 00 	movabs $0x80106d,%rax
+  802548:	00 00 00 
+  80254b:	ff d0                	call   *%rax
+  80254d:	85 c0                	test   %eax,%eax
+  80254f:	0f 94 c0             	sete   %al
+  802552:	0f b6 c0             	movzbl %al,%eax
+}
+  802555:	c9                   	leave
+  802556:	c3                   	ret
+
+0000000000802557 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  802557:	48 89 f8             	mov    %rdi,%rax
+  80255a:	48 c1 e8 27          	shr    $0x27,%rax
+  80255e:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  802565:	01 00 00 
+  802568:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80256c:	f6 c2 01             	test   $0x1,%dl
+  80256f:	74 6d                	je     8025de <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  802571:	48 89 f8             	mov    %rdi,%rax
+  802574:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802578:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  80257f:	01 00 00 
+  802582:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802586:	f6 c2 01             	test   $0x1,%dl
+  802589:	74 62                	je     8025ed <get_uvpt_entry+0x96>
+  80258b:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802592:	01 00 00 
+  802595:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802599:	f6 c2 80             	test   $0x80,%dl
+  80259c:	75 4f                	jne    8025ed <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  80259e:	48 89 f8             	mov    %rdi,%rax
+  8025a1:	48 c1 e8 15          	shr    $0x15,%rax
+  8025a5:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8025ac:	01 00 00 
+  8025af:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8025b3:	f6 c2 01             	test   $0x1,%dl
+  8025b6:	74 44                	je     8025fc <get_uvpt_entry+0xa5>
+  8025b8:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8025bf:	01 00 00 
+  8025c2:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8025c6:	f6 c2 80             	test   $0x80,%dl
+  8025c9:	75 31                	jne    8025fc <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  8025cb:	48 c1 ef 0c          	shr    $0xc,%rdi
+  8025cf:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8025d6:	01 00 00 
+  8025d9:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  8025dd:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8025de:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  8025e5:	01 00 00 
+  8025e8:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8025ec:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8025ed:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8025f4:	01 00 00 
+  8025f7:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8025fb:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8025fc:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802603:	01 00 00 
+  802606:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80260a:	c3                   	ret
+
+000000000080260b <get_prot>:
+
+int
+get_prot(void *va) {
+  80260b:	55                   	push   %rbp
+  80260c:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  80260f:	48 b8 57 25 80 00 00 	movabs $0x802557,%rax
+  802616:	00 00 00 
+  802619:	ff d0                	call   *%rax
+  80261b:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  80261e:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  802623:	89 c1                	mov    %eax,%ecx
+  802625:	83 c9 04             	or     $0x4,%ecx
+  802628:	f6 c2 01             	test   $0x1,%dl
+  80262b:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  80262e:	89 c1                	mov    %eax,%ecx
+  802630:	83 c9 02             	or     $0x2,%ecx
+  802633:	f6 c2 02             	test   $0x2,%dl
+  802636:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  802639:	89 c1                	mov    %eax,%ecx
+  80263b:	83 c9 01             	or     $0x1,%ecx
+  80263e:	48 85 d2             	test   %rdx,%rdx
+  802641:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  802644:	89 c1                	mov    %eax,%ecx
+  802646:	83 c9 40             	or     $0x40,%ecx
+  802649:	f6 c6 04             	test   $0x4,%dh
+  80264c:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  80264f:	5d                   	pop    %rbp
+  802650:	c3                   	ret
+
+0000000000802651 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  802651:	55                   	push   %rbp
+  802652:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  802655:	48 b8 57 25 80 00 00 	movabs $0x802557,%rax
+  80265c:	00 00 00 
+  80265f:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  802661:	48 c1 e8 06          	shr    $0x6,%rax
+  802665:	83 e0 01             	and    $0x1,%eax
+}
+  802668:	5d                   	pop    %rbp
+  802669:	c3                   	ret
+
+000000000080266a <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  80266a:	55                   	push   %rbp
+  80266b:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  80266e:	48 b8 57 25 80 00 00 	movabs $0x802557,%rax
+  802675:	00 00 00 
+  802678:	ff d0                	call   *%rax
+  80267a:	83 e0 01             	and    $0x1,%eax
+}
+  80267d:	5d                   	pop    %rbp
+  80267e:	c3                   	ret
+
+000000000080267f <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  80267f:	55                   	push   %rbp
+  802680:	48 89 e5             	mov    %rsp,%rbp
+  802683:	41 57                	push   %r15
+  802685:	41 56                	push   %r14
+  802687:	41 55                	push   %r13
+  802689:	41 54                	push   %r12
+  80268b:	53                   	push   %rbx
+  80268c:	48 83 ec 38          	sub    $0x38,%rsp
+  802690:	49 89 f7             	mov    %rsi,%r15
+  802693:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+                    }
+                    continue;
+                }
+                for (int ptei = 0; ptei < PT_ENTRY_COUNT; ptei++) {
+                    uintptr_t pte_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, pdei, ptei, 0);
+                    pte_t pte = uvpt[VPT(pte_addr)];
+  802699:	49 bd 00 00 00 00 00 	movabs $0x10000000000,%r13
+  8026a0:	01 00 00 
+  8026a3:	4d 89 e6             	mov    %r12,%r14
+  8026a6:	49 89 fc             	mov    %rdi,%r12
+  8026a9:	e9 19 01 00 00       	jmp    8027c7 <foreach_shared_region+0x148>
+  8026ae:	48 89 5d b0          	mov    %rbx,-0x50(%rbp)
+  8026b2:	4c 89 75 a8          	mov    %r14,-0x58(%rbp)
+  8026b6:	eb 52                	jmp    80270a <foreach_shared_region+0x8b>
+                for (int ptei = 0; ptei < PT_ENTRY_COUNT; ptei++) {
+  8026b8:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8026bf:	48 81 fb 00 00 20 00 	cmp    $0x200000,%rbx
+  8026c6:	74 2e                	je     8026f6 <foreach_shared_region+0x77>
+                    uintptr_t pte_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, pdei, ptei, 0);
+  8026c8:	48 89 df             	mov    %rbx,%rdi
+  8026cb:	4c 09 f7             	or     %r14,%rdi
+                    pte_t pte = uvpt[VPT(pte_addr)];
+  8026ce:	48 89 f8             	mov    %rdi,%rax
+  8026d1:	48 c1 e8 0c          	shr    $0xc,%rax
+  8026d5:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+                    if ((pte & PTE_P) && (pte & PTE_SHARE)) {
+  8026da:	25 01 04 00 00       	and    $0x401,%eax
+  8026df:	48 3d 01 04 00 00    	cmp    $0x401,%rax
+  8026e5:	75 d1                	jne    8026b8 <foreach_shared_region+0x39>
+                        fun((void*)pte_addr, (void*)(pte_addr + PAGE_SIZE), arg);
+  8026e7:	48 8d b7 00 10 00 00 	lea    0x1000(%rdi),%rsi
+  8026ee:	4c 89 fa             	mov    %r15,%rdx
+  8026f1:	41 ff d4             	call   *%r12
+  8026f4:	eb c2                	jmp    8026b8 <foreach_shared_region+0x39>
+            for (int pdei = 0; pdei < PD_ENTRY_COUNT; pdei++) {
+  8026f6:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  8026fd:	00 
+  8026fe:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802702:	48 3d 00 00 00 40    	cmp    $0x40000000,%rax
+  802708:	74 46                	je     802750 <foreach_shared_region+0xd1>
+                uintptr_t pde_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, pdei, 0, 0);
+  80270a:	4c 8b 75 c8          	mov    -0x38(%rbp),%r14
+  80270e:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802712:	49 09 c6             	or     %rax,%r14
+                pde_t pde = uvpd[VPD(pde_addr)];
+  802715:	4c 89 f0             	mov    %r14,%rax
+  802718:	48 c1 e8 15          	shr    $0x15,%rax
+  80271c:	48 b9 00 00 00 80 00 	movabs $0x10080000000,%rcx
+  802723:	01 00 00 
+  802726:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+                if (!(pde & PTE_P)) {
+  80272a:	a8 01                	test   $0x1,%al
+  80272c:	74 c8                	je     8026f6 <foreach_shared_region+0x77>
+                if (pde & PTE_PS) {
+  80272e:	48 89 c3             	mov    %rax,%rbx
+  802731:	81 e3 80 00 00 00    	and    $0x80,%ebx
+  802737:	74 8f                	je     8026c8 <foreach_shared_region+0x49>
+                    if (pde & PTE_SHARE) {
+  802739:	f6 c4 04             	test   $0x4,%ah
+  80273c:	74 b8                	je     8026f6 <foreach_shared_region+0x77>
+                        fun((void*)pde_addr, (void*)(pde_addr + 1024 * 1024 * 2), arg);
+  80273e:	49 8d b6 00 00 20 00 	lea    0x200000(%r14),%rsi
+  802745:	4c 89 fa             	mov    %r15,%rdx
+  802748:	4c 89 f7             	mov    %r14,%rdi
+  80274b:	41 ff d4             	call   *%r12
+  80274e:	eb a6                	jmp    8026f6 <foreach_shared_region+0x77>
+  802750:	48 8b 5d b0          	mov    -0x50(%rbp),%rbx
+  802754:	4c 8b 75 a8          	mov    -0x58(%rbp),%r14
+        for (int pdpei = 0; pdpei < PDP_ENTRY_COUNT; pdpei++) {
+  802758:	48 81 c3 00 00 00 40 	add    $0x40000000,%rbx
+  80275f:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802766:	00 00 00 
+  802769:	48 39 c3             	cmp    %rax,%rbx
+  80276c:	74 4c                	je     8027ba <foreach_shared_region+0x13b>
+            uintptr_t pdpe_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, 0, 0, 0);
+  80276e:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802772:	48 09 d8             	or     %rbx,%rax
+  802775:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+            pdpe_t pdpe = uvpdp[VPDP(pdpe_addr)];
+  802779:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80277d:	48 b9 00 00 40 80 00 	movabs $0x10080400000,%rcx
+  802784:	01 00 00 
+  802787:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+            if (!(pdpe & PTE_P)) {
+  80278b:	a8 01                	test   $0x1,%al
+  80278d:	74 c9                	je     802758 <foreach_shared_region+0xd9>
+            if (pdpe & PTE_PS) {
+  80278f:	48 89 c1             	mov    %rax,%rcx
+  802792:	81 e1 80 00 00 00    	and    $0x80,%ecx
+  802798:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  80279c:	0f 84 0c ff ff ff    	je     8026ae <foreach_shared_region+0x2f>
+                if (pdpe & PTE_SHARE) {
+  8027a2:	f6 c4 04             	test   $0x4,%ah
+  8027a5:	74 b1                	je     802758 <foreach_shared_region+0xd9>
+                    fun((void*)pdpe_addr, (void*)(pdpe_addr + 1024 * 1024 * 1024), arg); 
+  8027a7:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  8027ab:	48 8d b7 00 00 00 40 	lea    0x40000000(%rdi),%rsi
+  8027b2:	4c 89 fa             	mov    %r15,%rdx
+  8027b5:	41 ff d4             	call   *%r12
+  8027b8:	eb 9e                	jmp    802758 <foreach_shared_region+0xd9>
+    for (int pml4ei = 0; pml4ei < PML4_ENTRY_COUNT; pml4ei++) {
+  8027ba:	49 83 c6 01          	add    $0x1,%r14
+  8027be:	49 81 fe 00 02 00 00 	cmp    $0x200,%r14
+  8027c5:	74 24                	je     8027eb <foreach_shared_region+0x16c>
+        pml4e_t pml4e = uvpml4[VPML4(pml4_addr)];
+  8027c7:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  8027ce:	01 00 00 
+  8027d1:	4a 8b 04 f0          	mov    (%rax,%r14,8),%rax
+        if (!(pml4e & PTE_P)) {
+  8027d5:	a8 01                	test   $0x1,%al
+  8027d7:	74 e1                	je     8027ba <foreach_shared_region+0x13b>
+  8027d9:	4c 89 f0             	mov    %r14,%rax
+  8027dc:	48 c1 e0 27          	shl    $0x27,%rax
+  8027e0:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8027e4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8027e9:	eb 83                	jmp    80276e <foreach_shared_region+0xef>
+            }
+        }
+    }
+    
+    return 0;
+}
+  8027eb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027f0:	48 83 c4 38          	add    $0x38,%rsp
+  8027f4:	5b                   	pop    %rbx
+  8027f5:	41 5c                	pop    %r12
+  8027f7:	41 5d                	pop    %r13
+  8027f9:	41 5e                	pop    %r14
+  8027fb:	41 5f                	pop    %r15
+  8027fd:	5d                   	pop    %rbp
+  8027fe:	c3                   	ret
+
+00000000008027ff <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  8027ff:	b8 00 00 00 00       	mov    $0x0,%eax
+  802804:	c3                   	ret
+
+0000000000802805 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  802805:	55                   	push   %rbp
+  802806:	48 89 e5             	mov    %rsp,%rbp
+  802809:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  80280c:	48 be 14 33 80 00 00 	movabs $0x803314,%rsi
+  802813:	00 00 00 
+  802816:	48 b8 e9 0a 80 00 00 	movabs $0x800ae9,%rax
+  80281d:	00 00 00 
+  802820:	ff d0                	call   *%rax
+    return 0;
+}
+  802822:	b8 00 00 00 00       	mov    $0x0,%eax
+  802827:	5d                   	pop    %rbp
+  802828:	c3                   	ret
+
+0000000000802829 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  802829:	55                   	push   %rbp
+  80282a:	48 89 e5             	mov    %rsp,%rbp
+  80282d:	41 57                	push   %r15
+  80282f:	41 56                	push   %r14
+  802831:	41 55                	push   %r13
+  802833:	41 54                	push   %r12
+  802835:	53                   	push   %rbx
+  802836:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  80283d:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  802844:	48 85 d2             	test   %rdx,%rdx
+  802847:	74 7a                	je     8028c3 <devcons_write+0x9a>
+  802849:	49 89 d6             	mov    %rdx,%r14
+  80284c:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802852:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  802857:	49 bf e3 0c 80 00 00 	movabs $0x800ce3,%r15
+  80285e:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  802861:	4c 89 f3             	mov    %r14,%rbx
+  802864:	48 29 f3             	sub    %rsi,%rbx
+  802867:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  80286c:	48 39 c3             	cmp    %rax,%rbx
+  80286f:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  802873:	4c 63 eb             	movslq %ebx,%r13
+  802876:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  80287d:	48 01 c6             	add    %rax,%rsi
+  802880:	4c 89 ea             	mov    %r13,%rdx
+  802883:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  80288a:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  80288d:	4c 89 ee             	mov    %r13,%rsi
+  802890:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802897:	48 b8 10 0f 80 00 00 	movabs $0x800f10,%rax
+  80289e:	00 00 00 
+  8028a1:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  8028a3:	41 01 dc             	add    %ebx,%r12d
+  8028a6:	49 63 f4             	movslq %r12d,%rsi
+  8028a9:	4c 39 f6             	cmp    %r14,%rsi
+  8028ac:	72 b3                	jb     802861 <devcons_write+0x38>
+    return res;
+  8028ae:	49 63 c4             	movslq %r12d,%rax
+}
+  8028b1:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  8028b8:	5b                   	pop    %rbx
+  8028b9:	41 5c                	pop    %r12
+  8028bb:	41 5d                	pop    %r13
+  8028bd:	41 5e                	pop    %r14
+  8028bf:	41 5f                	pop    %r15
+  8028c1:	5d                   	pop    %rbp
+  8028c2:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  8028c3:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8028c9:	eb e3                	jmp    8028ae <devcons_write+0x85>
+
+00000000008028cb <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8028cb:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  8028ce:	ba 00 00 00 00       	mov    $0x0,%edx
+  8028d3:	48 85 c0             	test   %rax,%rax
+  8028d6:	74 55                	je     80292d <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8028d8:	55                   	push   %rbp
+  8028d9:	48 89 e5             	mov    %rsp,%rbp
+  8028dc:	41 55                	push   %r13
+  8028de:	41 54                	push   %r12
+  8028e0:	53                   	push   %rbx
+  8028e1:	48 83 ec 08          	sub    $0x8,%rsp
+  8028e5:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  8028e8:	48 bb 3d 0f 80 00 00 	movabs $0x800f3d,%rbx
+  8028ef:	00 00 00 
+  8028f2:	49 bc 0a 10 80 00 00 	movabs $0x80100a,%r12
+  8028f9:	00 00 00 
+  8028fc:	eb 03                	jmp    802901 <devcons_read+0x36>
+  8028fe:	41 ff d4             	call   *%r12
+  802901:	ff d3                	call   *%rbx
+  802903:	85 c0                	test   %eax,%eax
+  802905:	74 f7                	je     8028fe <devcons_read+0x33>
+    if (c < 0) return c;
+  802907:	48 63 d0             	movslq %eax,%rdx
+  80290a:	78 13                	js     80291f <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  80290c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802911:	83 f8 04             	cmp    $0x4,%eax
+  802914:	74 09                	je     80291f <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  802916:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  80291a:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  80291f:	48 89 d0             	mov    %rdx,%rax
+  802922:	48 83 c4 08          	add    $0x8,%rsp
+  802926:	5b                   	pop    %rbx
+  802927:	41 5c                	pop    %r12
+  802929:	41 5d                	pop    %r13
+  80292b:	5d                   	pop    %rbp
+  80292c:	c3                   	ret
+  80292d:	48 89 d0             	mov    %rdx,%rax
+  802930:	c3                   	ret
+
+0000000000802931 <cputchar>:
+cputchar(int ch) {
+  802931:	55                   	push   %rbp
+  802932:	48 89 e5             	mov    %rsp,%rbp
+  802935:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  802939:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  80293d:	be 01 00 00 00       	mov    $0x1,%esi
+  802942:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  802946:	48 b8 10 0f 80 00 00 	movabs $0x800f10,%rax
+  80294d:	00 00 00 
+  802950:	ff d0                	call   *%rax
+}
+  802952:	c9                   	leave
+  802953:	c3                   	ret
+
+0000000000802954 <getchar>:
+getchar(void) {
+  802954:	55                   	push   %rbp
+  802955:	48 89 e5             	mov    %rsp,%rbp
+  802958:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  80295c:	ba 01 00 00 00       	mov    $0x1,%edx
+  802961:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  802965:	bf 00 00 00 00       	mov    $0x0,%edi
+  80296a:	48 b8 78 18 80 00 00 	movabs $0x801878,%rax
+  802971:	00 00 00 
+  802974:	ff d0                	call   *%rax
+  802976:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  802978:	85 c0                	test   %eax,%eax
+  80297a:	78 06                	js     802982 <getchar+0x2e>
+  80297c:	74 08                	je     802986 <getchar+0x32>
+  80297e:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  802982:	89 d0                	mov    %edx,%eax
+  802984:	c9                   	leave
+  802985:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  802986:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  80298b:	eb f5                	jmp    802982 <getchar+0x2e>
+
+000000000080298d <iscons>:
+iscons(int fdnum) {
+  80298d:	55                   	push   %rbp
+  80298e:	48 89 e5             	mov    %rsp,%rbp
+  802991:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  802995:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802999:	48 b8 95 15 80 00 00 	movabs $0x801595,%rax
+  8029a0:	00 00 00 
+  8029a3:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8029a5:	85 c0                	test   %eax,%eax
+  8029a7:	78 18                	js     8029c1 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  8029a9:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8029ad:	48 b8 a0 40 80 00 00 	movabs $0x8040a0,%rax
+  8029b4:	00 00 00 
+  8029b7:	8b 00                	mov    (%rax),%eax
+  8029b9:	39 02                	cmp    %eax,(%rdx)
+  8029bb:	0f 94 c0             	sete   %al
+  8029be:	0f b6 c0             	movzbl %al,%eax
+}
+  8029c1:	c9                   	leave
+  8029c2:	c3                   	ret
+
+00000000008029c3 <opencons>:
+opencons(void) {
+  8029c3:	55                   	push   %rbp
+  8029c4:	48 89 e5             	mov    %rsp,%rbp
+  8029c7:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8029cb:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  8029cf:	48 b8 7b 15 80 00 00 	movabs $0x80157b,%rax
+  8029d6:	00 00 00 
+  8029d9:	ff d0                	call   *%rax
+  8029db:	85 c0                	test   %eax,%eax
+  8029dd:	78 49                	js     802a28 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  8029df:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8029e4:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8029e9:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  8029ed:	bf 00 00 00 00       	mov    $0x0,%edi
+  8029f2:	48 b8 99 10 80 00 00 	movabs $0x801099,%rax
+  8029f9:	00 00 00 
+  8029fc:	ff d0                	call   *%rax
+  8029fe:	85 c0                	test   %eax,%eax
+  802a00:	78 26                	js     802a28 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  802a02:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802a06:	a1 a0 40 80 00 00 00 	movabs 0x8040a0,%eax
+  802a0d:	00 00 
+  802a0f:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  802a11:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802a15:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  802a1c:	48 b8 d4 14 80 00 00 	movabs $0x8014d4,%rax
+  802a23:	00 00 00 
+  802a26:	ff d0                	call   *%rax
+}
+  802a28:	c9                   	leave
+  802a29:	c3                   	ret
+
+0000000000802a2a <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  802a2a:	55                   	push   %rbp
+  802a2b:	48 89 e5             	mov    %rsp,%rbp
+  802a2e:	41 56                	push   %r14
+  802a30:	41 55                	push   %r13
+  802a32:	41 54                	push   %r12
+  802a34:	53                   	push   %rbx
+  802a35:	48 83 ec 50          	sub    $0x50,%rsp
+  802a39:	49 89 fc             	mov    %rdi,%r12
+  802a3c:	41 89 f5             	mov    %esi,%r13d
+  802a3f:	48 89 d3             	mov    %rdx,%rbx
+  802a42:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  802a46:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  802a4a:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  802a4e:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  802a55:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802a59:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  802a5d:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  802a61:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  802a65:	48 b8 00 40 80 00 00 	movabs $0x804000,%rax
+  802a6c:	00 00 00 
+  802a6f:	4c 8b 30             	mov    (%rax),%r14
+  802a72:	48 b8 d9 0f 80 00 00 	movabs $0x800fd9,%rax
+  802a79:	00 00 00 
+  802a7c:	ff d0                	call   *%rax
+  802a7e:	89 c6                	mov    %eax,%esi
+  802a80:	45 89 e8             	mov    %r13d,%r8d
+  802a83:	4c 89 e1             	mov    %r12,%rcx
+  802a86:	4c 89 f2             	mov    %r14,%rdx
+  802a89:	48 bf 20 33 80 00 00 	movabs $0x803320,%rdi
+  802a90:	00 00 00 
+  802a93:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a98:	49 bc c4 01 80 00 00 	movabs $0x8001c4,%r12
+  802a9f:	00 00 00 
+  802aa2:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  802aa5:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  802aa9:	48 89 df             	mov    %rbx,%rdi
+  802aac:	48 b8 60 01 80 00 00 	movabs $0x800160,%rax
+  802ab3:	00 00 00 
+  802ab6:	ff d0                	call   *%rax
+    cprintf("\n");
+  802ab8:	48 bf 9a 2c 80 00 00 	movabs $0x802c9a,%rdi
+  802abf:	00 00 00 
+  802ac2:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ac7:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  802aca:	cc                   	int3
+  802acb:	eb fd                	jmp    802aca <_panic+0xa0>
+
+0000000000802acd <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  802acd:	55                   	push   %rbp
+  802ace:	48 89 e5             	mov    %rsp,%rbp
+  802ad1:	41 55                	push   %r13
+  802ad3:	41 54                	push   %r12
+  802ad5:	53                   	push   %rbx
+  802ad6:	48 83 ec 08          	sub    $0x8,%rsp
+  802ada:	49 89 fc             	mov    %rdi,%r12
+  802add:	48 89 f7             	mov    %rsi,%rdi
+  802ae0:	48 89 d3             	mov    %rdx,%rbx
+  802ae3:	49 89 cd             	mov    %rcx,%r13
+    // LAB 9: Your code here:
+    int res = sys_ipc_recv(!pg ? (void*)MAX_USER_ADDRESS : pg, !size ? 0 : *size);
+  802ae6:	be 00 00 00 00       	mov    $0x0,%esi
+  802aeb:	48 85 d2             	test   %rdx,%rdx
+  802aee:	74 03                	je     802af3 <ipc_recv+0x26>
+  802af0:	48 8b 32             	mov    (%rdx),%rsi
+  802af3:	48 85 ff             	test   %rdi,%rdi
+  802af6:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802afd:	00 00 00 
+  802b00:	48 0f 44 f8          	cmove  %rax,%rdi
+  802b04:	48 b8 6b 14 80 00 00 	movabs $0x80146b,%rax
+  802b0b:	00 00 00 
+  802b0e:	ff d0                	call   *%rax
+    if (res < 0) {
+  802b10:	85 c0                	test   %eax,%eax
+  802b12:	78 66                	js     802b7a <ipc_recv+0xad>
+        if (size) {
+            *size = 0;
+        }
+        return res;
+    }
+    if (from_env_store) {
+  802b14:	4d 85 e4             	test   %r12,%r12
+  802b17:	74 14                	je     802b2d <ipc_recv+0x60>
+        *from_env_store = thisenv->env_ipc_from;
+  802b19:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802b20:	00 00 00 
+  802b23:	8b 80 ac 01 00 00    	mov    0x1ac(%rax),%eax
+  802b29:	41 89 04 24          	mov    %eax,(%r12)
+    }
+    if (perm_store) {
+  802b2d:	4d 85 ed             	test   %r13,%r13
+  802b30:	74 14                	je     802b46 <ipc_recv+0x79>
+        *perm_store = thisenv->env_ipc_perm;
+  802b32:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802b39:	00 00 00 
+  802b3c:	8b 80 b0 01 00 00    	mov    0x1b0(%rax),%eax
+  802b42:	41 89 45 00          	mov    %eax,0x0(%r13)
+    }
+    if (size) {
+  802b46:	48 85 db             	test   %rbx,%rbx
+  802b49:	74 14                	je     802b5f <ipc_recv+0x92>
+        *size = thisenv->env_ipc_maxsz;
+  802b4b:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802b52:	00 00 00 
+  802b55:	48 8b 80 a0 01 00 00 	mov    0x1a0(%rax),%rax
+  802b5c:	48 89 03             	mov    %rax,(%rbx)
+    }
+    return thisenv->env_ipc_value;
+  802b5f:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802b66:	00 00 00 
+  802b69:	8b 80 a8 01 00 00    	mov    0x1a8(%rax),%eax
+}
+  802b6f:	48 83 c4 08          	add    $0x8,%rsp
+  802b73:	5b                   	pop    %rbx
+  802b74:	41 5c                	pop    %r12
+  802b76:	41 5d                	pop    %r13
+  802b78:	5d                   	pop    %rbp
+  802b79:	c3                   	ret
+        if (from_env_store) {
+  802b7a:	4d 85 e4             	test   %r12,%r12
+  802b7d:	74 08                	je     802b87 <ipc_recv+0xba>
+            *from_env_store = 0;
+  802b7f:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  802b86:	00 
+        if (perm_store) {
+  802b87:	4d 85 ed             	test   %r13,%r13
+  802b8a:	74 08                	je     802b94 <ipc_recv+0xc7>
+            *perm_store = 0;
+  802b8c:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  802b93:	00 
+        if (size) {
+  802b94:	48 85 db             	test   %rbx,%rbx
+  802b97:	74 d6                	je     802b6f <ipc_recv+0xa2>
+            *size = 0;
+  802b99:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  802ba0:	eb cd                	jmp    802b6f <ipc_recv+0xa2>
+
+0000000000802ba2 <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  802ba2:	55                   	push   %rbp
+  802ba3:	48 89 e5             	mov    %rsp,%rbp
+  802ba6:	41 57                	push   %r15
+  802ba8:	41 56                	push   %r14
+  802baa:	41 55                	push   %r13
+  802bac:	41 54                	push   %r12
+  802bae:	53                   	push   %rbx
+  802baf:	48 83 ec 18          	sub    $0x18,%rsp
+  802bb3:	41 89 fd             	mov    %edi,%r13d
+  802bb6:	89 75 cc             	mov    %esi,-0x34(%rbp)
+  802bb9:	49 89 cc             	mov    %rcx,%r12
+  802bbc:	44 89 45 c8          	mov    %r8d,-0x38(%rbp)
+    // LAB 9: Your code here:
+    int res = 0;
+    while ((res = sys_ipc_try_send(to_env, val, !pg ? (void*)MAX_USER_ADDRESS : pg, size, perm)) < 0) {
+  802bc0:	48 85 d2             	test   %rdx,%rdx
+  802bc3:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802bca:	00 00 00 
+  802bcd:	48 0f 45 c2          	cmovne %rdx,%rax
+  802bd1:	48 89 c3             	mov    %rax,%rbx
+  802bd4:	49 be 3f 14 80 00 00 	movabs $0x80143f,%r14
+  802bdb:	00 00 00 
+        if (res != -E_IPC_NOT_RECV) {
+            panic("sys_ipc_try_send failed: %i", res);
+        }
+        sys_yield();
+  802bde:	49 bf 0a 10 80 00 00 	movabs $0x80100a,%r15
+  802be5:	00 00 00 
+    while ((res = sys_ipc_try_send(to_env, val, !pg ? (void*)MAX_USER_ADDRESS : pg, size, perm)) < 0) {
+  802be8:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  802beb:	44 8b 45 c8          	mov    -0x38(%rbp),%r8d
+  802bef:	4c 89 e1             	mov    %r12,%rcx
+  802bf2:	48 89 da             	mov    %rbx,%rdx
+  802bf5:	44 89 ef             	mov    %r13d,%edi
+  802bf8:	41 ff d6             	call   *%r14
+  802bfb:	85 c0                	test   %eax,%eax
+  802bfd:	79 37                	jns    802c36 <ipc_send+0x94>
+        if (res != -E_IPC_NOT_RECV) {
+  802bff:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  802c02:	75 05                	jne    802c09 <ipc_send+0x67>
+        sys_yield();
+  802c04:	41 ff d7             	call   *%r15
+  802c07:	eb df                	jmp    802be8 <ipc_send+0x46>
+            panic("sys_ipc_try_send failed: %i", res);
+  802c09:	89 c1                	mov    %eax,%ecx
+  802c0b:	48 ba 43 33 80 00 00 	movabs $0x803343,%rdx
+  802c12:	00 00 00 
+  802c15:	be 40 00 00 00       	mov    $0x40,%esi
+  802c1a:	48 bf 5f 33 80 00 00 	movabs $0x80335f,%rdi
+  802c21:	00 00 00 
+  802c24:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c29:	49 b8 2a 2a 80 00 00 	movabs $0x802a2a,%r8
+  802c30:	00 00 00 
+  802c33:	41 ff d0             	call   *%r8
+    }
+    return;
+}
+  802c36:	48 83 c4 18          	add    $0x18,%rsp
+  802c3a:	5b                   	pop    %rbx
+  802c3b:	41 5c                	pop    %r12
+  802c3d:	41 5d                	pop    %r13
+  802c3f:	41 5e                	pop    %r14
+  802c41:	41 5f                	pop    %r15
+  802c43:	5d                   	pop    %rbp
+  802c44:	c3                   	ret
+
+0000000000802c45 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  802c45:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  802c4a:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  802c51:	00 00 00 
+  802c54:	48 69 d0 d0 01 00 00 	imul   $0x1d0,%rax,%rdx
+  802c5b:	48 01 ca             	add    %rcx,%rdx
+  802c5e:	8b 92 e8 00 00 00    	mov    0xe8(%rdx),%edx
+  802c64:	39 fa                	cmp    %edi,%edx
+  802c66:	74 12                	je     802c7a <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  802c68:	48 83 c0 01          	add    $0x1,%rax
+  802c6c:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  802c72:	75 e0                	jne    802c54 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  802c74:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802c79:	c3                   	ret
+            return envs[i].env_id;
+  802c7a:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+  802c81:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  802c88:	00 00 00 
+  802c8b:	48 01 d0             	add    %rdx,%rax
+  802c8e:	8b 80 e0 00 00 00    	mov    0xe0(%rax),%eax
+  802c94:	c3                   	ret
+  802c95:	0f 1f 00             	nopl   (%rax)
+
+0000000000802c98 <__rodata_start>:
+  802c98:	25 64 0a 00 3c       	and    $0x3c000a64,%eax
+  802c9d:	75 6e                	jne    802d0d <__rodata_start+0x75>
+  802c9f:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  802ca3:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802ca4:	3e 00 30             	ds add %dh,(%rax)
+  802ca7:	31 32                	xor    %esi,(%rdx)
+  802ca9:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  802cb0:	41                   	rex.B
+  802cb1:	42                   	rex.X
+  802cb2:	43                   	rex.XB
+  802cb3:	44                   	rex.R
+  802cb4:	45                   	rex.RB
+  802cb5:	46 00 30             	rex.RX add %r14b,(%rax)
+  802cb8:	31 32                	xor    %esi,(%rdx)
+  802cba:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  802cc1:	61                   	(bad)
+  802cc2:	62 63 64 65 66       	(bad)
+  802cc7:	00 28                	add    %ch,(%rax)
+  802cc9:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802cca:	75 6c                	jne    802d38 <__rodata_start+0xa0>
+  802ccc:	6c                   	insb   (%dx),%es:(%rdi)
+  802ccd:	29 00                	sub    %eax,(%rax)
+  802ccf:	65 72 72             	gs jb  802d44 <__rodata_start+0xac>
+  802cd2:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802cd3:	72 20                	jb     802cf5 <__rodata_start+0x5d>
+  802cd5:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  802cda:	73 70                	jae    802d4c <__rodata_start+0xb4>
+  802cdc:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  802ce0:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  802ce7:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802ce8:	72 00                	jb     802cea <__rodata_start+0x52>
+  802cea:	62 61 64 20 65       	(bad)
+  802cef:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802cf0:	76 69                	jbe    802d5b <__rodata_start+0xc3>
+  802cf2:	72 6f                	jb     802d63 <__rodata_start+0xcb>
+  802cf4:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802cf5:	6d                   	insl   (%dx),%es:(%rdi)
+  802cf6:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  802cf8:	74 00                	je     802cfa <__rodata_start+0x62>
+  802cfa:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  802d01:	20 70 61             	and    %dh,0x61(%rax)
+  802d04:	72 61                	jb     802d67 <__rodata_start+0xcf>
+  802d06:	6d                   	insl   (%dx),%es:(%rdi)
+  802d07:	65 74 65             	gs je  802d6f <__rodata_start+0xd7>
+  802d0a:	72 00                	jb     802d0c <__rodata_start+0x74>
+  802d0c:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802d0d:	75 74                	jne    802d83 <__rodata_start+0xeb>
+  802d0f:	20 6f 66             	and    %ch,0x66(%rdi)
+  802d12:	20 6d 65             	and    %ch,0x65(%rbp)
+  802d15:	6d                   	insl   (%dx),%es:(%rdi)
+  802d16:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802d17:	72 79                	jb     802d92 <__rodata_start+0xfa>
+  802d19:	00 6f 75             	add    %ch,0x75(%rdi)
+  802d1c:	74 20                	je     802d3e <__rodata_start+0xa6>
+  802d1e:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802d1f:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  802d23:	76 69                	jbe    802d8e <__rodata_start+0xf6>
+  802d25:	72 6f                	jb     802d96 <__rodata_start+0xfe>
+  802d27:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802d28:	6d                   	insl   (%dx),%es:(%rdi)
+  802d29:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  802d2b:	74 73                	je     802da0 <__rodata_start+0x108>
+  802d2d:	00 63 6f             	add    %ah,0x6f(%rbx)
+  802d30:	72 72                	jb     802da4 <__rodata_start+0x10c>
+  802d32:	75 70                	jne    802da4 <__rodata_start+0x10c>
+  802d34:	74 65                	je     802d9b <__rodata_start+0x103>
+  802d36:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  802d3b:	75 67                	jne    802da4 <__rodata_start+0x10c>
+  802d3d:	20 69 6e             	and    %ch,0x6e(%rcx)
+  802d40:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  802d42:	00 73 65             	add    %dh,0x65(%rbx)
+  802d45:	67 6d                	insl   (%dx),%es:(%edi)
+  802d47:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  802d49:	74 61                	je     802dac <__rodata_start+0x114>
+  802d4b:	74 69                	je     802db6 <__rodata_start+0x11e>
+  802d4d:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802d4e:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802d4f:	20 66 61             	and    %ah,0x61(%rsi)
+  802d52:	75 6c                	jne    802dc0 <__rodata_start+0x128>
+  802d54:	74 00                	je     802d56 <__rodata_start+0xbe>
+  802d56:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  802d5d:	20 45 4c             	and    %al,0x4c(%rbp)
+  802d60:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  802d64:	61                   	(bad)
+  802d65:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  802d6a:	20 73 75             	and    %dh,0x75(%rbx)
+  802d6d:	63 68 20             	movsxd 0x20(%rax),%ebp
+  802d70:	73 79                	jae    802deb <__rodata_start+0x153>
+  802d72:	73 74                	jae    802de8 <__rodata_start+0x150>
+  802d74:	65 6d                	gs insl (%dx),%es:(%rdi)
+  802d76:	20 63 61             	and    %ah,0x61(%rbx)
+  802d79:	6c                   	insb   (%dx),%es:(%rdi)
+  802d7a:	6c                   	insb   (%dx),%es:(%rdi)
+  802d7b:	00 65 6e             	add    %ah,0x6e(%rbp)
+  802d7e:	74 72                	je     802df2 <__rodata_start+0x15a>
+  802d80:	79 20                	jns    802da2 <__rodata_start+0x10a>
+  802d82:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802d83:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802d84:	74 20                	je     802da6 <__rodata_start+0x10e>
+  802d86:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  802d88:	75 6e                	jne    802df8 <__rodata_start+0x160>
+  802d8a:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  802d8e:	76 20                	jbe    802db0 <__rodata_start+0x118>
+  802d90:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  802d97:	72 65                	jb     802dfe <__rodata_start+0x166>
+  802d99:	63 76 69             	movsxd 0x69(%rsi),%esi
+  802d9c:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802d9d:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  802da1:	65 78 70             	gs js  802e14 <__rodata_start+0x17c>
+  802da4:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  802da9:	20 65 6e             	and    %ah,0x6e(%rbp)
+  802dac:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  802db0:	20 66 69             	and    %ah,0x69(%rsi)
+  802db3:	6c                   	insb   (%dx),%es:(%rdi)
+  802db4:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  802db8:	20 66 72             	and    %ah,0x72(%rsi)
+  802dbb:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  802dc0:	61                   	(bad)
+  802dc1:	63 65 20             	movsxd 0x20(%rbp),%esp
+  802dc4:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802dc5:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802dc6:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  802dca:	6b 00 74             	imul   $0x74,(%rax),%eax
+  802dcd:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802dce:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802dcf:	20 6d 61             	and    %ch,0x61(%rbp)
+  802dd2:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802dd3:	79 20                	jns    802df5 <__rodata_start+0x15d>
+  802dd5:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  802ddc:	72 65                	jb     802e43 <__rodata_start+0x1ab>
+  802dde:	20 6f 70             	and    %ch,0x70(%rdi)
+  802de1:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  802de3:	00 66 69             	add    %ah,0x69(%rsi)
+  802de6:	6c                   	insb   (%dx),%es:(%rdi)
+  802de7:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  802deb:	20 62 6c             	and    %ah,0x6c(%rdx)
+  802dee:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802def:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  802df2:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802df3:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802df4:	74 20                	je     802e16 <__rodata_start+0x17e>
+  802df6:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  802df8:	75 6e                	jne    802e68 <__rodata_start+0x1d0>
+  802dfa:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  802dfe:	76 61                	jbe    802e61 <__rodata_start+0x1c9>
+  802e00:	6c                   	insb   (%dx),%es:(%rdi)
+  802e01:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  802e08:	00 
+  802e09:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  802e10:	72 65                	jb     802e77 <__rodata_start+0x1df>
+  802e12:	61                   	(bad)
+  802e13:	64 79 20             	fs jns 802e36 <__rodata_start+0x19e>
+  802e16:	65 78 69             	gs js  802e82 <__rodata_start+0x1ea>
+  802e19:	73 74                	jae    802e8f <__rodata_start+0x1f7>
+  802e1b:	73 00                	jae    802e1d <__rodata_start+0x185>
+  802e1d:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802e1e:	70 65                	jo     802e85 <__rodata_start+0x1ed>
+  802e20:	72 61                	jb     802e83 <__rodata_start+0x1eb>
+  802e22:	74 69                	je     802e8d <__rodata_start+0x1f5>
+  802e24:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802e25:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802e26:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  802e29:	74 20                	je     802e4b <__rodata_start+0x1b3>
+  802e2b:	73 75                	jae    802ea2 <__rodata_start+0x20a>
+  802e2d:	70 70                	jo     802e9f <__rodata_start+0x207>
+  802e2f:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802e30:	72 74                	jb     802ea6 <__rodata_start+0x20e>
+  802e32:	65 64 00 6f 70       	gs add %ch,%fs:0x70(%rdi)
+  802e37:	65 72 61             	gs jb  802e9b <__rodata_start+0x203>
+  802e3a:	74 69                	je     802ea5 <__rodata_start+0x20d>
+  802e3c:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802e3d:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802e3e:	20 69 6e             	and    %ch,0x6e(%rcx)
+  802e41:	74 65                	je     802ea8 <__rodata_start+0x210>
+  802e43:	72 72                	jb     802eb7 <__rodata_start+0x21f>
+  802e45:	75 70                	jne    802eb7 <__rodata_start+0x21f>
+  802e47:	74 65                	je     802eae <__rodata_start+0x216>
+  802e49:	64 00 6e 6f          	add    %ch,%fs:0x6f(%rsi)
+  802e4d:	74 20                	je     802e6f <__rodata_start+0x1d7>
+  802e4f:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  802e51:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802e52:	75 67                	jne    802ebb <__rodata_start+0x223>
+  802e54:	68 20 43 50 55       	push   $0x55504320
+  802e59:	20 74 69 6d          	and    %dh,0x6d(%rcx,%rbp,2)
+  802e5d:	65 00 90 b1 03 80 00 	add    %dl,%gs:0x8003b1(%rax)
+  802e64:	00 00                	add    %al,(%rax)
+  802e66:	00 00                	add    %al,(%rax)
+  802e68:	f2 09 80 00 00 00 00 	repnz or %eax,0x0(%rax)
+  802e6f:	00 e2                	add    %ah,%dl
+  802e71:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802e77:	00 f2                	add    %dh,%dl
+  802e79:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802e7f:	00 f2                	add    %dh,%dl
+  802e81:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802e87:	00 f2                	add    %dh,%dl
+  802e89:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802e8f:	00 f2                	add    %dh,%dl
+  802e91:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802e97:	00 d0                	add    %dl,%al
+  802e99:	03 80 00 00 00 00    	add    0x0(%rax),%eax
+  802e9f:	00 f2                	add    %dh,%dl
+  802ea1:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802ea7:	00 f2                	add    %dh,%dl
+  802ea9:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802eaf:	00 c4                	add    %al,%ah
+  802eb1:	03 80 00 00 00 00    	add    0x0(%rax),%eax
+  802eb7:	00 3e                	add    %bh,(%rsi)
+  802eb9:	04 80                	add    $0x80,%al
+  802ebb:	00 00                	add    %al,(%rax)
+  802ebd:	00 00                	add    %al,(%rax)
+  802ebf:	00 f2                	add    %dh,%dl
+  802ec1:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802ec7:	00 c4                	add    %al,%ah
+  802ec9:	03 80 00 00 00 00    	add    0x0(%rax),%eax
+  802ecf:	00 0a                	add    %cl,(%rdx)
+  802ed1:	04 80                	add    $0x80,%al
+  802ed3:	00 00                	add    %al,(%rax)
+  802ed5:	00 00                	add    %al,(%rax)
+  802ed7:	00 0a                	add    %cl,(%rdx)
+  802ed9:	04 80                	add    $0x80,%al
+  802edb:	00 00                	add    %al,(%rax)
+  802edd:	00 00                	add    %al,(%rax)
+  802edf:	00 0a                	add    %cl,(%rdx)
+  802ee1:	04 80                	add    $0x80,%al
+  802ee3:	00 00                	add    %al,(%rax)
+  802ee5:	00 00                	add    %al,(%rax)
+  802ee7:	00 0a                	add    %cl,(%rdx)
+  802ee9:	04 80                	add    $0x80,%al
+  802eeb:	00 00                	add    %al,(%rax)
+  802eed:	00 00                	add    %al,(%rax)
+  802eef:	00 0a                	add    %cl,(%rdx)
+  802ef1:	04 80                	add    $0x80,%al
+  802ef3:	00 00                	add    %al,(%rax)
+  802ef5:	00 00                	add    %al,(%rax)
+  802ef7:	00 0a                	add    %cl,(%rdx)
+  802ef9:	04 80                	add    $0x80,%al
+  802efb:	00 00                	add    %al,(%rax)
+  802efd:	00 00                	add    %al,(%rax)
+  802eff:	00 0a                	add    %cl,(%rdx)
+  802f01:	04 80                	add    $0x80,%al
+  802f03:	00 00                	add    %al,(%rax)
+  802f05:	00 00                	add    %al,(%rax)
+  802f07:	00 0a                	add    %cl,(%rdx)
+  802f09:	04 80                	add    $0x80,%al
+  802f0b:	00 00                	add    %al,(%rax)
+  802f0d:	00 00                	add    %al,(%rax)
+  802f0f:	00 0a                	add    %cl,(%rdx)
+  802f11:	04 80                	add    $0x80,%al
+  802f13:	00 00                	add    %al,(%rax)
+  802f15:	00 00                	add    %al,(%rax)
+  802f17:	00 f2                	add    %dh,%dl
+  802f19:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802f1f:	00 f2                	add    %dh,%dl
+  802f21:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802f27:	00 f2                	add    %dh,%dl
+  802f29:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802f2f:	00 f2                	add    %dh,%dl
+  802f31:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802f37:	00 f2                	add    %dh,%dl
+  802f39:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802f3f:	00 f2                	add    %dh,%dl
+  802f41:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802f47:	00 f2                	add    %dh,%dl
+  802f49:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802f4f:	00 f2                	add    %dh,%dl
+  802f51:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802f57:	00 f2                	add    %dh,%dl
+  802f59:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802f5f:	00 f2                	add    %dh,%dl
+  802f61:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802f67:	00 f2                	add    %dh,%dl
+  802f69:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802f6f:	00 f2                	add    %dh,%dl
+  802f71:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802f77:	00 f2                	add    %dh,%dl
+  802f79:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802f7f:	00 f2                	add    %dh,%dl
+  802f81:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802f87:	00 f2                	add    %dh,%dl
+  802f89:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802f8f:	00 f2                	add    %dh,%dl
+  802f91:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802f97:	00 f2                	add    %dh,%dl
+  802f99:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802f9f:	00 f2                	add    %dh,%dl
+  802fa1:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802fa7:	00 f2                	add    %dh,%dl
+  802fa9:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802faf:	00 f2                	add    %dh,%dl
+  802fb1:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802fb7:	00 f2                	add    %dh,%dl
+  802fb9:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802fbf:	00 f2                	add    %dh,%dl
+  802fc1:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802fc7:	00 f2                	add    %dh,%dl
+  802fc9:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802fcf:	00 f2                	add    %dh,%dl
+  802fd1:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802fd7:	00 f2                	add    %dh,%dl
+  802fd9:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802fdf:	00 f2                	add    %dh,%dl
+  802fe1:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802fe7:	00 f2                	add    %dh,%dl
+  802fe9:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802fef:	00 f2                	add    %dh,%dl
+  802ff1:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802ff7:	00 f2                	add    %dh,%dl
+  802ff9:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  802fff:	00 f2                	add    %dh,%dl
+  803001:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803007:	00 15 09 80 00 00    	add    %dl,0x8009(%rip)        # 80b016 <__bss_end+0x3016>
+  80300d:	00 00                	add    %al,(%rax)
+  80300f:	00 f2                	add    %dh,%dl
+  803011:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803017:	00 f2                	add    %dh,%dl
+  803019:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  80301f:	00 f2                	add    %dh,%dl
+  803021:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803027:	00 f2                	add    %dh,%dl
+  803029:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  80302f:	00 f2                	add    %dh,%dl
+  803031:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803037:	00 f2                	add    %dh,%dl
+  803039:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  80303f:	00 f2                	add    %dh,%dl
+  803041:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803047:	00 f2                	add    %dh,%dl
+  803049:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  80304f:	00 f2                	add    %dh,%dl
+  803051:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803057:	00 f2                	add    %dh,%dl
+  803059:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  80305f:	00 61 04             	add    %ah,0x4(%rcx)
+  803062:	80 00 00             	addb   $0x0,(%rax)
+  803065:	00 00                	add    %al,(%rax)
+  803067:	00 30                	add    %dh,(%rax)
+  803069:	06                   	(bad)
+  80306a:	80 00 00             	addb   $0x0,(%rax)
+  80306d:	00 00                	add    %al,(%rax)
+  80306f:	00 f2                	add    %dh,%dl
+  803071:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803077:	00 f2                	add    %dh,%dl
+  803079:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  80307f:	00 f2                	add    %dh,%dl
+  803081:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803087:	00 f2                	add    %dh,%dl
+  803089:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  80308f:	00 90 04 80 00 00    	add    %dl,0x8004(%rax)
+  803095:	00 00                	add    %al,(%rax)
+  803097:	00 f2                	add    %dh,%dl
+  803099:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  80309f:	00 f2                	add    %dh,%dl
+  8030a1:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  8030a7:	00 56 04             	add    %dl,0x4(%rsi)
+  8030aa:	80 00 00             	addb   $0x0,(%rax)
+  8030ad:	00 00                	add    %al,(%rax)
+  8030af:	00 f2                	add    %dh,%dl
+  8030b1:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  8030b7:	00 f2                	add    %dh,%dl
+  8030b9:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  8030bf:	00 d8                	add    %bl,%al
+  8030c1:	07                   	(bad)
+  8030c2:	80 00 00             	addb   $0x0,(%rax)
+  8030c5:	00 00                	add    %al,(%rax)
+  8030c7:	00 a2 08 80 00 00    	add    %ah,0x8008(%rdx)
+  8030cd:	00 00                	add    %al,(%rax)
+  8030cf:	00 f2                	add    %dh,%dl
+  8030d1:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  8030d7:	00 f2                	add    %dh,%dl
+  8030d9:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  8030df:	00 27                	add    %ah,(%rdi)
+  8030e1:	05 80 00 00 00       	add    $0x80,%eax
+  8030e6:	00 00                	add    %al,(%rax)
+  8030e8:	f2 09 80 00 00 00 00 	repnz or %eax,0x0(%rax)
+  8030ef:	00 04 07             	add    %al,(%rdi,%rax,1)
+  8030f2:	80 00 00             	addb   $0x0,(%rax)
+  8030f5:	00 00                	add    %al,(%rax)
+  8030f7:	00 f2                	add    %dh,%dl
+  8030f9:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  8030ff:	00 f2                	add    %dh,%dl
+  803101:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803107:	00 15 09 80 00 00    	add    %dl,0x8009(%rip)        # 80b116 <__bss_end+0x3116>
+  80310d:	00 00                	add    %al,(%rax)
+  80310f:	00 f2                	add    %dh,%dl
+  803111:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803117:	00 ba 03 80 00 00    	add    %bh,0x8003(%rdx)
+  80311d:	00 00                	add    %al,(%rax)
+	...
+
+0000000000803120 <error_string>:
+	...
+  803128:	d8 2c 80 00 00 00 00 00 ea 2c 80 00 00 00 00 00     .,.......,......
+  803138:	fa 2c 80 00 00 00 00 00 0c 2d 80 00 00 00 00 00     .,.......-......
+  803148:	1a 2d 80 00 00 00 00 00 2e 2d 80 00 00 00 00 00     .-.......-......
+  803158:	43 2d 80 00 00 00 00 00 56 2d 80 00 00 00 00 00     C-......V-......
+  803168:	68 2d 80 00 00 00 00 00 7c 2d 80 00 00 00 00 00     h-......|-......
+  803178:	8c 2d 80 00 00 00 00 00 9f 2d 80 00 00 00 00 00     .-.......-......
+  803188:	b6 2d 80 00 00 00 00 00 cc 2d 80 00 00 00 00 00     .-.......-......
+  803198:	e4 2d 80 00 00 00 00 00 fc 2d 80 00 00 00 00 00     .-.......-......
+  8031a8:	09 2e 80 00 00 00 00 00 d0 31 80 00 00 00 00 00     .........1......
+  8031b8:	1d 2e 80 00 00 00 00 00 35 2e 80 00 00 00 00 00     ........5.......
+  8031c8:	4b 2e 80 00 00 00 00 00 66 69 6c 65 20 69 73 20     K.......file is 
+  8031d8:	6e 6f 74 20 61 20 76 61 6c 69 64 20 65 78 65 63     not a valid exec
+  8031e8:	75 74 61 62 6c 65 00 90 73 79 73 63 61 6c 6c 20     utable..syscall 
+  8031f8:	25 7a 64 20 72 65 74 75 72 6e 65 64 20 25 7a 64     %zd returned %zd
+  803208:	20 28 3e 20 30 29 00 6c 69 62 2f 73 79 73 63 61      (> 0).lib/sysca
+  803218:	6c 6c 2e 63 00 0f 1f 00 5b 25 30 38 78 5d 20 75     ll.c....[%08x] u
+  803228:	6e 6b 6e 6f 77 6e 20 64 65 76 69 63 65 20 74 79     nknown device ty
+  803238:	70 65 20 25 64 0a 00 00 5b 25 30 38 78 5d 20 66     pe %d...[%08x] f
+  803248:	74 72 75 6e 63 61 74 65 20 25 64 20 2d 2d 20 62     truncate %d -- b
+  803258:	61 64 20 6d 6f 64 65 0a 00 5b 25 30 38 78 5d 20     ad mode..[%08x] 
+  803268:	72 65 61 64 20 25 64 20 2d 2d 20 62 61 64 20 6d     read %d -- bad m
+  803278:	6f 64 65 0a 00 5b 25 30 38 78 5d 20 77 72 69 74     ode..[%08x] writ
+  803288:	65 20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65     e %d -- bad mode
+  803298:	0a 00 66 0f 1f 44 00 00                             ..f..D..
+
+00000000008032a0 <devtab>:
+  8032a0:	20 40 80 00 00 00 00 00 60 40 80 00 00 00 00 00      @......`@......
+  8032b0:	a0 40 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .@..............
+  8032c0:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  8032d0:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  8032e0:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  8032f0:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  803300:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  803310:	3d 20 32 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73 00     = 2.<cons>.cons.
+  803320:	5b 25 30 38 78 5d 20 75 73 65 72 20 70 61 6e 69     [%08x] user pani
+  803330:	63 20 69 6e 20 25 73 20 61 74 20 25 73 3a 25 64     c in %s at %s:%d
+  803340:	3a 20 00 73 79 73 5f 69 70 63 5f 74 72 79 5f 73     : .sys_ipc_try_s
+  803350:	65 6e 64 20 66 61 69 6c 65 64 3a 20 25 69 00 6c     end failed: %i.l
+  803360:	69 62 2f 69 70 63 2e 63 00 66 2e 0f 1f 84 00 00     ib/ipc.c.f......
+  803370:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803380:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803390:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8033a0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8033b0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8033c0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8033d0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8033e0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8033f0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803400:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803410:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803420:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803430:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803440:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803450:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803460:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803470:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803480:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803490:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8034a0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8034b0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8034c0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8034d0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8034e0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8034f0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803500:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803510:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803520:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803530:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803540:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803550:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803560:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803570:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803580:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803590:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8035a0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8035b0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8035c0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8035d0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8035e0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8035f0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803600:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803610:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803620:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803630:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803640:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803650:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803660:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803670:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803680:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803690:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8036a0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8036b0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8036c0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8036d0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8036e0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8036f0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803700:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803710:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803720:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803730:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803740:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803750:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803760:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803770:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803780:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803790:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8037a0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8037b0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8037c0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8037d0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8037e0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8037f0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803800:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803810:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803820:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803830:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803840:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803850:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803860:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803870:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803880:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803890:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8038a0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8038b0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8038c0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8038d0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8038e0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8038f0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803900:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803910:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803920:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803930:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803940:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803950:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803960:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803970:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803980:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803990:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8039a0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8039b0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8039c0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8039d0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8039e0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8039f0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803a00:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803a10:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803a20:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803a30:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803a40:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803a50:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803a60:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803a70:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803a80:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803a90:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803aa0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803ab0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803ac0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803ad0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803ae0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803af0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803b00:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803b10:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803b20:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803b30:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803b40:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803b50:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803b60:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803b70:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803b80:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803b90:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803ba0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803bb0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803bc0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803bd0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803be0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803bf0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803c00:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803c10:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803c20:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803c30:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803c40:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803c50:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803c60:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803c70:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803c80:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803c90:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803ca0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803cb0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803cc0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803cd0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803ce0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803cf0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803d00:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803d10:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803d20:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803d30:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803d40:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803d50:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803d60:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803d70:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803d80:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803d90:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803da0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803db0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803dc0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803dd0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803de0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803df0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803e00:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803e10:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803e20:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803e30:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803e40:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803e50:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803e60:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803e70:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803e80:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803e90:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803ea0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803eb0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803ec0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803ed0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803ee0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803ef0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803f00:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803f10:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803f20:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803f30:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803f40:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803f50:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803f60:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803f70:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803f80:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803f90:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803fa0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803fb0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803fc0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803fd0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803fe0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803ff0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 0f 1f 00     ...f............
@@ -0,0 +1,6242 @@
+
+obj/user/smpscale:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 de 02 00 00       	call   800301 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <compute>:
+#define NWORKERS 8
+#define SPIN_ITERATIONS (1ULL << 28)
+#define FORKS 64
+
+static void
+compute(void) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	48 83 ec 10          	sub    $0x10,%rsp
+    volatile uint64_t sum = 0;
+  80002d:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  800034:	00 
+    for (uint64_t i = 0; i < SPIN_ITERATIONS / NWORKERS; i++)
+  800035:	b8 00 00 00 00       	mov    $0x0,%eax
+        sum += i;
+  80003a:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80003e:	48 01 c2             	add    %rax,%rdx
+  800041:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+    for (uint64_t i = 0; i < SPIN_ITERATIONS / NWORKERS; i++)
+  800045:	48 83 c0 01          	add    $0x1,%rax
+  800049:	48 3d 00 00 00 02    	cmp    $0x2000000,%rax
+  80004f:	75 e9                	jne    80003a <compute+0x15>
+}
+  800051:	c9                   	leave
+  800052:	c3                   	ret
+
+0000000000800053 <forks>:
+
+static void
+forks(void) {
+  800053:	55                   	push   %rbp
+  800054:	48 89 e5             	mov    %rsp,%rbp
+  800057:	41 57                	push   %r15
+  800059:	41 56                	push   %r14
+  80005b:	41 55                	push   %r13
+  80005d:	41 54                	push   %r12
+  80005f:	53                   	push   %rbx
+  800060:	48 83 ec 08          	sub    $0x8,%rsp
+  800064:	41 bc 08 00 00 00    	mov    $0x8,%r12d
+    for (int i = 0; i < FORKS / NWORKERS; i++) {
+        envid_t id = fork();
+  80006a:	49 be 2d 18 80 00 00 	movabs $0x80182d,%r14
+  800071:	00 00 00 
+        if (id < 0) panic("fork: %i", id);
+        if (!id) exit();
+  800074:	49 bf aa 03 80 00 00 	movabs $0x8003aa,%r15
+  80007b:	00 00 00 
+        wait(id);
+  80007e:	49 bd dc 2b 80 00 00 	movabs $0x802bdc,%r13
+  800085:	00 00 00 
+  800088:	eb 38                	jmp    8000c2 <forks+0x6f>
+        if (id < 0) panic("fork: %i", id);
+  80008a:	89 c1                	mov    %eax,%ecx
+  80008c:	48 ba 68 31 80 00 00 	movabs $0x803168,%rdx
+  800093:	00 00 00 
+  800096:	be 1b 00 00 00       	mov    $0x1b,%esi
+  80009b:	48 bf 71 31 80 00 00 	movabs $0x803171,%rdi
+  8000a2:	00 00 00 
+  8000a5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000aa:	49 b8 cd 03 80 00 00 	movabs $0x8003cd,%r8
+  8000b1:	00 00 00 
+  8000b4:	41 ff d0             	call   *%r8
+        wait(id);
+  8000b7:	89 df                	mov    %ebx,%edi
+  8000b9:	41 ff d5             	call   *%r13
+    for (int i = 0; i < FORKS / NWORKERS; i++) {
+  8000bc:	41 83 ec 01          	sub    $0x1,%r12d
+  8000c0:	74 10                	je     8000d2 <forks+0x7f>
+        envid_t id = fork();
+  8000c2:	41 ff d6             	call   *%r14
+  8000c5:	89 c3                	mov    %eax,%ebx
+        if (id < 0) panic("fork: %i", id);
+  8000c7:	85 c0                	test   %eax,%eax
+  8000c9:	78 bf                	js     80008a <forks+0x37>
+        if (!id) exit();
+  8000cb:	75 ea                	jne    8000b7 <forks+0x64>
+  8000cd:	41 ff d7             	call   *%r15
+  8000d0:	eb e5                	jmp    8000b7 <forks+0x64>
+    }
+}
+  8000d2:	48 83 c4 08          	add    $0x8,%rsp
+  8000d6:	5b                   	pop    %rbx
+  8000d7:	41 5c                	pop    %r12
+  8000d9:	41 5d                	pop    %r13
+  8000db:	41 5e                	pop    %r14
+  8000dd:	41 5f                	pop    %r15
+  8000df:	5d                   	pop    %rbp
+  8000e0:	c3                   	ret
+
+00000000008000e1 <run>:
+
+/* Runs work in NWORKERS environments and waits for them.
+ * Returns elapsed cycles, CPU time of workers is stored in runtime */
+static uint64_t
+run(void (*work)(void), uint64_t *runtime) {
+  8000e1:	55                   	push   %rbp
+  8000e2:	48 89 e5             	mov    %rsp,%rbp
+  8000e5:	41 57                	push   %r15
+  8000e7:	41 56                	push   %r14
+  8000e9:	41 55                	push   %r13
+  8000eb:	41 54                	push   %r12
+  8000ed:	53                   	push   %rbx
+  8000ee:	48 83 ec 28          	sub    $0x28,%rsp
+  8000f2:	48 89 7d c0          	mov    %rdi,-0x40(%rbp)
+  8000f6:	49 89 f4             	mov    %rsi,%r12
+    envid_t parent = sys_getenvid();
+  8000f9:	48 b8 32 13 80 00 00 	movabs $0x801332,%rax
+  800100:	00 00 00 
+  800103:	ff d0                	call   *%rax
+  800105:	89 45 cc             	mov    %eax,-0x34(%rbp)
+}
+
+static inline uint64_t __attribute__((always_inline))
+read_tsc(void) {
+    uint32_t lo, hi;
+    asm volatile("rdtsc"
+  800108:	0f 31                	rdtsc
+                 : "=a"(lo), "=d"(hi));
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  80010a:	48 c1 e2 20          	shl    $0x20,%rdx
+  80010e:	89 c0                	mov    %eax,%eax
+  800110:	48 09 c2             	or     %rax,%rdx
+  800113:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  800117:	bb 08 00 00 00       	mov    $0x8,%ebx
+    uint64_t start = read_tsc();
+
+    for (int i = 0; i < NWORKERS; i++) {
+        envid_t id = fork();
+  80011c:	49 bd 2d 18 80 00 00 	movabs $0x80182d,%r13
+  800123:	00 00 00 
+        if (id < 0) panic("fork: %i", id);
+        if (!id) {
+            work();
+            /* CPU time is accounted when the CPU is given up */
+            sys_yield();
+  800126:	49 bf 63 13 80 00 00 	movabs $0x801363,%r15
+  80012d:	00 00 00 
+            ipc_send(parent, thisenv->env_runtime >> 10, NULL, 0, 0);
+  800130:	49 be 00 50 80 00 00 	movabs $0x805000,%r14
+  800137:	00 00 00 
+  80013a:	eb 32                	jmp    80016e <run+0x8d>
+        if (id < 0) panic("fork: %i", id);
+  80013c:	89 c1                	mov    %eax,%ecx
+  80013e:	48 ba 68 31 80 00 00 	movabs $0x803168,%rdx
+  800145:	00 00 00 
+  800148:	be 2a 00 00 00       	mov    $0x2a,%esi
+  80014d:	48 bf 71 31 80 00 00 	movabs $0x803171,%rdi
+  800154:	00 00 00 
+  800157:	b8 00 00 00 00       	mov    $0x0,%eax
+  80015c:	49 b8 cd 03 80 00 00 	movabs $0x8003cd,%r8
+  800163:	00 00 00 
+  800166:	41 ff d0             	call   *%r8
+    for (int i = 0; i < NWORKERS; i++) {
+  800169:	83 eb 01             	sub    $0x1,%ebx
+  80016c:	74 4d                	je     8001bb <run+0xda>
+        envid_t id = fork();
+  80016e:	41 ff d5             	call   *%r13
+        if (id < 0) panic("fork: %i", id);
+  800171:	85 c0                	test   %eax,%eax
+  800173:	78 c7                	js     80013c <run+0x5b>
+        if (!id) {
+  800175:	75 f2                	jne    800169 <run+0x88>
+            work();
+  800177:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80017b:	ff d0                	call   *%rax
+            sys_yield();
+  80017d:	41 ff d7             	call   *%r15
+            ipc_send(parent, thisenv->env_runtime >> 10, NULL, 0, 0);
+  800180:	49 8b 06             	mov    (%r14),%rax
+  800183:	48 8b b0 08 01 00 00 	mov    0x108(%rax),%rsi
+  80018a:	48 c1 ee 0a          	shr    $0xa,%rsi
+  80018e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800194:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800199:	ba 00 00 00 00       	mov    $0x0,%edx
+  80019e:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  8001a1:	48 b8 66 1a 80 00 00 	movabs $0x801a66,%rax
+  8001a8:	00 00 00 
+  8001ab:	ff d0                	call   *%rax
+            exit();
+  8001ad:	48 b8 aa 03 80 00 00 	movabs $0x8003aa,%rax
+  8001b4:	00 00 00 
+  8001b7:	ff d0                	call   *%rax
+  8001b9:	eb ae                	jmp    800169 <run+0x88>
+        }
+    }
+
+    *runtime = 0;
+  8001bb:	49 c7 04 24 00 00 00 	movq   $0x0,(%r12)
+  8001c2:	00 
+  8001c3:	bb 08 00 00 00       	mov    $0x8,%ebx
+    for (int i = 0; i < NWORKERS; i++)
+        *runtime += (uint64_t)ipc_recv(NULL, NULL, NULL, NULL) << 10;
+  8001c8:	49 bd 91 19 80 00 00 	movabs $0x801991,%r13
+  8001cf:	00 00 00 
+  8001d2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8001d7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8001dc:	be 00 00 00 00       	mov    $0x0,%esi
+  8001e1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8001e6:	41 ff d5             	call   *%r13
+  8001e9:	48 98                	cltq
+  8001eb:	48 c1 e0 0a          	shl    $0xa,%rax
+  8001ef:	49 01 04 24          	add    %rax,(%r12)
+    for (int i = 0; i < NWORKERS; i++)
+  8001f3:	83 eb 01             	sub    $0x1,%ebx
+  8001f6:	75 da                	jne    8001d2 <run+0xf1>
+    asm volatile("rdtsc"
+  8001f8:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  8001fa:	48 c1 e2 20          	shl    $0x20,%rdx
+  8001fe:	89 c0                	mov    %eax,%eax
+  800200:	48 09 c2             	or     %rax,%rdx
+    return read_tsc() - start;
+  800203:	48 89 d0             	mov    %rdx,%rax
+  800206:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  80020a:	48 29 c8             	sub    %rcx,%rax
+}
+  80020d:	48 83 c4 28          	add    $0x28,%rsp
+  800211:	5b                   	pop    %rbx
+  800212:	41 5c                	pop    %r12
+  800214:	41 5d                	pop    %r13
+  800216:	41 5e                	pop    %r14
+  800218:	41 5f                	pop    %r15
+  80021a:	5d                   	pop    %rbp
+  80021b:	c3                   	ret
+
+000000000080021c <umain>:
+
+void
+umain(int argc, char **argv) {
+  80021c:	55                   	push   %rbp
+  80021d:	48 89 e5             	mov    %rsp,%rbp
+  800220:	41 54                	push   %r12
+  800222:	53                   	push   %rbx
+  800223:	48 83 ec 10          	sub    $0x10,%rsp
+    uint64_t runtime;
+
+    uint64_t elapsed = run(compute, &runtime);
+  800227:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80022b:	48 bf 25 00 80 00 00 	movabs $0x800025,%rdi
+  800232:	00 00 00 
+  800235:	48 bb e1 00 80 00 00 	movabs $0x8000e1,%rbx
+  80023c:	00 00 00 
+  80023f:	ff d3                	call   *%rbx
+  800241:	48 89 c6             	mov    %rax,%rsi
+    cprintf("smpscale: compute in %d envs: %lu Mcycles, parallelism %lu.%02lu\n",
+            NWORKERS, (unsigned long)(elapsed >> 20),
+            (unsigned long)(runtime / elapsed), (unsigned long)(runtime * 100 / elapsed % 100));
+  800244:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  800248:	48 8d 04 89          	lea    (%rcx,%rcx,4),%rax
+  80024c:	48 8d 04 80          	lea    (%rax,%rax,4),%rax
+  800250:	48 c1 e0 02          	shl    $0x2,%rax
+  800254:	ba 00 00 00 00       	mov    $0x0,%edx
+  800259:	48 f7 f6             	div    %rsi
+  80025c:	49 89 c0             	mov    %rax,%r8
+  80025f:	48 89 c2             	mov    %rax,%rdx
+  800262:	48 c1 ea 02          	shr    $0x2,%rdx
+  800266:	48 bf c3 f5 28 5c 8f 	movabs $0x28f5c28f5c28f5c3,%rdi
+  80026d:	c2 f5 28 
+  800270:	48 89 d0             	mov    %rdx,%rax
+  800273:	48 f7 e7             	mul    %rdi
+  800276:	48 89 d0             	mov    %rdx,%rax
+  800279:	48 c1 e8 02          	shr    $0x2,%rax
+  80027d:	48 83 e2 fc          	and    $0xfffffffffffffffc,%rdx
+  800281:	48 01 c2             	add    %rax,%rdx
+  800284:	48 8d 3c 92          	lea    (%rdx,%rdx,4),%rdi
+  800288:	48 c1 e7 02          	shl    $0x2,%rdi
+  80028c:	48 89 c8             	mov    %rcx,%rax
+  80028f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800294:	48 f7 f6             	div    %rsi
+  800297:	48 89 c1             	mov    %rax,%rcx
+            NWORKERS, (unsigned long)(elapsed >> 20),
+  80029a:	48 c1 ee 14          	shr    $0x14,%rsi
+  80029e:	48 89 f2             	mov    %rsi,%rdx
+    cprintf("smpscale: compute in %d envs: %lu Mcycles, parallelism %lu.%02lu\n",
+  8002a1:	49 29 f8             	sub    %rdi,%r8
+  8002a4:	be 08 00 00 00       	mov    $0x8,%esi
+  8002a9:	48 bf 88 31 80 00 00 	movabs $0x803188,%rdi
+  8002b0:	00 00 00 
+  8002b3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002b8:	49 bc 1d 05 80 00 00 	movabs $0x80051d,%r12
+  8002bf:	00 00 00 
+  8002c2:	41 ff d4             	call   *%r12
+
+    elapsed = run(forks, &runtime);
+  8002c5:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8002c9:	48 bf 53 00 80 00 00 	movabs $0x800053,%rdi
+  8002d0:	00 00 00 
+  8002d3:	ff d3                	call   *%rbx
+    cprintf("smpscale: %d forks in %d envs: %lu Mcycles\n",
+            FORKS, NWORKERS, (unsigned long)(elapsed >> 20));
+  8002d5:	48 c1 e8 14          	shr    $0x14,%rax
+  8002d9:	48 89 c1             	mov    %rax,%rcx
+    cprintf("smpscale: %d forks in %d envs: %lu Mcycles\n",
+  8002dc:	ba 08 00 00 00       	mov    $0x8,%edx
+  8002e1:	be 40 00 00 00       	mov    $0x40,%esi
+  8002e6:	48 bf d0 31 80 00 00 	movabs $0x8031d0,%rdi
+  8002ed:	00 00 00 
+  8002f0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002f5:	41 ff d4             	call   *%r12
+}
+  8002f8:	48 83 c4 10          	add    $0x10,%rsp
+  8002fc:	5b                   	pop    %rbx
+  8002fd:	41 5c                	pop    %r12
+  8002ff:	5d                   	pop    %rbp
+  800300:	c3                   	ret
+
+0000000000800301 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800301:	55                   	push   %rbp
+  800302:	48 89 e5             	mov    %rsp,%rbp
+  800305:	41 56                	push   %r14
+  800307:	41 55                	push   %r13
+  800309:	41 54                	push   %r12
+  80030b:	53                   	push   %rbx
+  80030c:	41 89 fd             	mov    %edi,%r13d
+  80030f:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800312:	48 ba d8 40 80 00 00 	movabs $0x8040d8,%rdx
+  800319:	00 00 00 
+  80031c:	48 b8 d8 40 80 00 00 	movabs $0x8040d8,%rax
+  800323:	00 00 00 
+  800326:	48 39 c2             	cmp    %rax,%rdx
+  800329:	73 17                	jae    800342 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  80032b:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  80032e:	49 89 c4             	mov    %rax,%r12
+  800331:	48 83 c3 08          	add    $0x8,%rbx
+  800335:	b8 00 00 00 00       	mov    $0x0,%eax
+  80033a:	ff 53 f8             	call   *-0x8(%rbx)
+  80033d:	4c 39 e3             	cmp    %r12,%rbx
+  800340:	72 ef                	jb     800331 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+    envid_t this_env_id = sys_getenvid();
+  800342:	48 b8 32 13 80 00 00 	movabs $0x801332,%rax
+  800349:	00 00 00 
+  80034c:	ff d0                	call   *%rax
+    thisenv = &((struct Env*)UENVS)[ENVX(this_env_id)];
+  80034e:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800353:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+  80035a:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  800361:	00 00 00 
+  800364:	48 01 d0             	add    %rdx,%rax
+  800367:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  80036e:	00 00 00 
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  800371:	45 85 ed             	test   %r13d,%r13d
+  800374:	7e 0d                	jle    800383 <libmain+0x82>
+  800376:	49 8b 06             	mov    (%r14),%rax
+  800379:	48 a3 00 40 80 00 00 	movabs %rax,0x804000
+  800380:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  800383:	4c 89 f6             	mov    %r14,%rsi
+  800386:	44 89 ef             	mov    %r13d,%edi
+  800389:	48 b8 1c 02 80 00 00 	movabs $0x80021c,%rax
+  800390:	00 00 00 
+  800393:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  800395:	48 b8 aa 03 80 00 00 	movabs $0x8003aa,%rax
+  80039c:	00 00 00 
+  80039f:	ff d0                	call   *%rax
+#endif
+}
+  8003a1:	5b                   	pop    %rbx
+  8003a2:	41 5c                	pop    %r12
+  8003a4:	41 5d                	pop    %r13
+  8003a6:	41 5e                	pop    %r14
+  8003a8:	5d                   	pop    %rbp
+  8003a9:	c3                   	ret
+
+00000000008003aa <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8003aa:	55                   	push   %rbp
+  8003ab:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  8003ae:	48 b8 b2 1d 80 00 00 	movabs $0x801db2,%rax
+  8003b5:	00 00 00 
+  8003b8:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  8003ba:	bf 00 00 00 00       	mov    $0x0,%edi
+  8003bf:	48 b8 c7 12 80 00 00 	movabs $0x8012c7,%rax
+  8003c6:	00 00 00 
+  8003c9:	ff d0                	call   *%rax
+}
+  8003cb:	5d                   	pop    %rbp
+  8003cc:	c3                   	ret
+
+00000000008003cd <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  8003cd:	55                   	push   %rbp
+  8003ce:	48 89 e5             	mov    %rsp,%rbp
+  8003d1:	41 56                	push   %r14
+  8003d3:	41 55                	push   %r13
+  8003d5:	41 54                	push   %r12
+  8003d7:	53                   	push   %rbx
+  8003d8:	48 83 ec 50          	sub    $0x50,%rsp
+  8003dc:	49 89 fc             	mov    %rdi,%r12
+  8003df:	41 89 f5             	mov    %esi,%r13d
+  8003e2:	48 89 d3             	mov    %rdx,%rbx
+  8003e5:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  8003e9:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  8003ed:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  8003f1:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  8003f8:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8003fc:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  800400:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  800404:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  800408:	48 b8 00 40 80 00 00 	movabs $0x804000,%rax
+  80040f:	00 00 00 
+  800412:	4c 8b 30             	mov    (%rax),%r14
+  800415:	48 b8 32 13 80 00 00 	movabs $0x801332,%rax
+  80041c:	00 00 00 
+  80041f:	ff d0                	call   *%rax
+  800421:	89 c6                	mov    %eax,%esi
+  800423:	45 89 e8             	mov    %r13d,%r8d
+  800426:	4c 89 e1             	mov    %r12,%rcx
+  800429:	4c 89 f2             	mov    %r14,%rdx
+  80042c:	48 bf 08 32 80 00 00 	movabs $0x803208,%rdi
+  800433:	00 00 00 
+  800436:	b8 00 00 00 00       	mov    $0x0,%eax
+  80043b:	49 bc 1d 05 80 00 00 	movabs $0x80051d,%r12
+  800442:	00 00 00 
+  800445:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  800448:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  80044c:	48 89 df             	mov    %rbx,%rdi
+  80044f:	48 b8 b9 04 80 00 00 	movabs $0x8004b9,%rax
+  800456:	00 00 00 
+  800459:	ff d0                	call   *%rax
+    cprintf("\n");
+  80045b:	48 bf 7b 38 80 00 00 	movabs $0x80387b,%rdi
+  800462:	00 00 00 
+  800465:	b8 00 00 00 00       	mov    $0x0,%eax
+  80046a:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  80046d:	cc                   	int3
+  80046e:	eb fd                	jmp    80046d <_panic+0xa0>
+
+0000000000800470 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  800470:	55                   	push   %rbp
+  800471:	48 89 e5             	mov    %rsp,%rbp
+  800474:	53                   	push   %rbx
+  800475:	48 83 ec 08          	sub    $0x8,%rsp
+  800479:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  80047c:	8b 06                	mov    (%rsi),%eax
+  80047e:	8d 50 01             	lea    0x1(%rax),%edx
+  800481:	89 16                	mov    %edx,(%rsi)
+  800483:	48 98                	cltq
+  800485:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  80048a:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  800490:	74 0a                	je     80049c <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  800492:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  800496:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80049a:	c9                   	leave
+  80049b:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  80049c:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  8004a0:	be ff 00 00 00       	mov    $0xff,%esi
+  8004a5:	48 b8 69 12 80 00 00 	movabs $0x801269,%rax
+  8004ac:	00 00 00 
+  8004af:	ff d0                	call   *%rax
+        state->offset = 0;
+  8004b1:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  8004b7:	eb d9                	jmp    800492 <putch+0x22>
+
+00000000008004b9 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  8004b9:	55                   	push   %rbp
+  8004ba:	48 89 e5             	mov    %rsp,%rbp
+  8004bd:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  8004c4:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  8004c7:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  8004ce:	b9 21 00 00 00       	mov    $0x21,%ecx
+  8004d3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004d8:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  8004db:	48 89 f1             	mov    %rsi,%rcx
+  8004de:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  8004e5:	48 bf 70 04 80 00 00 	movabs $0x800470,%rdi
+  8004ec:	00 00 00 
+  8004ef:	48 b8 6d 06 80 00 00 	movabs $0x80066d,%rax
+  8004f6:	00 00 00 
+  8004f9:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  8004fb:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  800502:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  800509:	48 b8 69 12 80 00 00 	movabs $0x801269,%rax
+  800510:	00 00 00 
+  800513:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  800515:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  80051b:	c9                   	leave
+  80051c:	c3                   	ret
+
+000000000080051d <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  80051d:	55                   	push   %rbp
+  80051e:	48 89 e5             	mov    %rsp,%rbp
+  800521:	48 83 ec 50          	sub    $0x50,%rsp
+  800525:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  800529:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  80052d:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800531:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800535:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  800539:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  800540:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800544:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800548:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80054c:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  800550:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  800554:	48 b8 b9 04 80 00 00 	movabs $0x8004b9,%rax
+  80055b:	00 00 00 
+  80055e:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  800560:	c9                   	leave
+  800561:	c3                   	ret
+
+0000000000800562 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  800562:	55                   	push   %rbp
+  800563:	48 89 e5             	mov    %rsp,%rbp
+  800566:	41 57                	push   %r15
+  800568:	41 56                	push   %r14
+  80056a:	41 55                	push   %r13
+  80056c:	41 54                	push   %r12
+  80056e:	53                   	push   %rbx
+  80056f:	48 83 ec 18          	sub    $0x18,%rsp
+  800573:	49 89 fc             	mov    %rdi,%r12
+  800576:	49 89 f5             	mov    %rsi,%r13
+  800579:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  80057d:	8b 45 10             	mov    0x10(%rbp),%eax
+  800580:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  800583:	41 89 cf             	mov    %ecx,%r15d
+  800586:	4c 39 fa             	cmp    %r15,%rdx
+  800589:	73 5b                	jae    8005e6 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  80058b:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  80058f:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  800593:	85 db                	test   %ebx,%ebx
+  800595:	7e 0e                	jle    8005a5 <print_num+0x43>
+            putch(padc, put_arg);
+  800597:	4c 89 ee             	mov    %r13,%rsi
+  80059a:	44 89 f7             	mov    %r14d,%edi
+  80059d:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  8005a0:	83 eb 01             	sub    $0x1,%ebx
+  8005a3:	75 f2                	jne    800597 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  8005a5:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  8005a9:	48 b9 3c 32 80 00 00 	movabs $0x80323c,%rcx
+  8005b0:	00 00 00 
+  8005b3:	48 b8 2b 32 80 00 00 	movabs $0x80322b,%rax
+  8005ba:	00 00 00 
+  8005bd:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  8005c1:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8005c5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005ca:	49 f7 f7             	div    %r15
+  8005cd:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  8005d1:	4c 89 ee             	mov    %r13,%rsi
+  8005d4:	41 ff d4             	call   *%r12
+}
+  8005d7:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8005db:	5b                   	pop    %rbx
+  8005dc:	41 5c                	pop    %r12
+  8005de:	41 5d                	pop    %r13
+  8005e0:	41 5e                	pop    %r14
+  8005e2:	41 5f                	pop    %r15
+  8005e4:	5d                   	pop    %rbp
+  8005e5:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  8005e6:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8005ea:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005ef:	49 f7 f7             	div    %r15
+  8005f2:	48 83 ec 08          	sub    $0x8,%rsp
+  8005f6:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  8005fa:	52                   	push   %rdx
+  8005fb:	45 0f be c9          	movsbl %r9b,%r9d
+  8005ff:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  800603:	48 89 c2             	mov    %rax,%rdx
+  800606:	48 b8 62 05 80 00 00 	movabs $0x800562,%rax
+  80060d:	00 00 00 
+  800610:	ff d0                	call   *%rax
+  800612:	48 83 c4 10          	add    $0x10,%rsp
+  800616:	eb 8d                	jmp    8005a5 <print_num+0x43>
+
+0000000000800618 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  800618:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  80061c:	48 8b 06             	mov    (%rsi),%rax
+  80061f:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  800623:	73 0a                	jae    80062f <sprintputch+0x17>
+        *state->start++ = ch;
+  800625:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800629:	48 89 16             	mov    %rdx,(%rsi)
+  80062c:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  80062f:	c3                   	ret
+
+0000000000800630 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  800630:	55                   	push   %rbp
+  800631:	48 89 e5             	mov    %rsp,%rbp
+  800634:	48 83 ec 50          	sub    $0x50,%rsp
+  800638:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80063c:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800640:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  800644:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  80064b:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80064f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800653:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800657:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  80065b:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80065f:	48 b8 6d 06 80 00 00 	movabs $0x80066d,%rax
+  800666:	00 00 00 
+  800669:	ff d0                	call   *%rax
+}
+  80066b:	c9                   	leave
+  80066c:	c3                   	ret
+
+000000000080066d <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  80066d:	55                   	push   %rbp
+  80066e:	48 89 e5             	mov    %rsp,%rbp
+  800671:	41 57                	push   %r15
+  800673:	41 56                	push   %r14
+  800675:	41 55                	push   %r13
+  800677:	41 54                	push   %r12
+  800679:	53                   	push   %rbx
+  80067a:	48 83 ec 38          	sub    $0x38,%rsp
+  80067e:	49 89 fe             	mov    %rdi,%r14
+  800681:	49 89 f5             	mov    %rsi,%r13
+  800684:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  800687:	48 8b 01             	mov    (%rcx),%rax
+  80068a:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  80068e:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800692:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800696:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  80069a:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  80069e:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  8006a2:	0f b6 3b             	movzbl (%rbx),%edi
+  8006a5:	40 80 ff 25          	cmp    $0x25,%dil
+  8006a9:	74 18                	je     8006c3 <vprintfmt+0x56>
+            if (!ch) return;
+  8006ab:	40 84 ff             	test   %dil,%dil
+  8006ae:	0f 84 b1 06 00 00    	je     800d65 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  8006b4:	40 0f b6 ff          	movzbl %dil,%edi
+  8006b8:	4c 89 ee             	mov    %r13,%rsi
+  8006bb:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  8006be:	4c 89 e3             	mov    %r12,%rbx
+  8006c1:	eb db                	jmp    80069e <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  8006c3:	be 00 00 00 00       	mov    $0x0,%esi
+  8006c8:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  8006cc:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  8006d1:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8006d7:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  8006de:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8006e2:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  8006e7:	41 0f b6 04 24       	movzbl (%r12),%eax
+  8006ec:	88 45 a0             	mov    %al,-0x60(%rbp)
+  8006ef:	83 e8 23             	sub    $0x23,%eax
+  8006f2:	3c 57                	cmp    $0x57,%al
+  8006f4:	0f 87 51 06 00 00    	ja     800d4b <vprintfmt+0x6de>
+  8006fa:	0f b6 c0             	movzbl %al,%eax
+  8006fd:	48 b9 00 34 80 00 00 	movabs $0x803400,%rcx
+  800704:	00 00 00 
+  800707:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  80070a:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  80070d:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  800711:	eb cf                	jmp    8006e2 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  800713:	49 89 dc             	mov    %rbx,%r12
+  800716:	be 01 00 00 00       	mov    $0x1,%esi
+  80071b:	eb c5                	jmp    8006e2 <vprintfmt+0x75>
+            padc = ch;
+  80071d:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  800721:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800724:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800727:	eb b9                	jmp    8006e2 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800729:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80072c:	83 f8 2f             	cmp    $0x2f,%eax
+  80072f:	77 24                	ja     800755 <vprintfmt+0xe8>
+  800731:	89 c1                	mov    %eax,%ecx
+  800733:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  800737:	83 c0 08             	add    $0x8,%eax
+  80073a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80073d:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  800740:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  800743:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800747:	79 99                	jns    8006e2 <vprintfmt+0x75>
+                width = precision;
+  800749:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  80074d:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800753:	eb 8d                	jmp    8006e2 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800755:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  800759:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  80075d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800761:	eb da                	jmp    80073d <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  800763:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  800768:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  80076c:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  800772:	3c 39                	cmp    $0x39,%al
+  800774:	77 1c                	ja     800792 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  800776:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  80077a:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  80077e:	0f b6 c0             	movzbl %al,%eax
+  800781:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800786:	0f b6 03             	movzbl (%rbx),%eax
+  800789:	3c 39                	cmp    $0x39,%al
+  80078b:	76 e9                	jbe    800776 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  80078d:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  800790:	eb b1                	jmp    800743 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  800792:	49 89 dc             	mov    %rbx,%r12
+  800795:	eb ac                	jmp    800743 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  800797:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  80079a:	85 c9                	test   %ecx,%ecx
+  80079c:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007a1:	0f 49 c1             	cmovns %ecx,%eax
+  8007a4:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  8007a7:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8007aa:	e9 33 ff ff ff       	jmp    8006e2 <vprintfmt+0x75>
+            lflag++;
+  8007af:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  8007b2:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8007b5:	e9 28 ff ff ff       	jmp    8006e2 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  8007ba:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007bd:	83 f8 2f             	cmp    $0x2f,%eax
+  8007c0:	77 19                	ja     8007db <vprintfmt+0x16e>
+  8007c2:	89 c2                	mov    %eax,%edx
+  8007c4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007c8:	83 c0 08             	add    $0x8,%eax
+  8007cb:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007ce:	8b 3a                	mov    (%rdx),%edi
+  8007d0:	4c 89 ee             	mov    %r13,%rsi
+  8007d3:	41 ff d6             	call   *%r14
+            break;
+  8007d6:	e9 c3 fe ff ff       	jmp    80069e <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  8007db:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007df:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007e3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007e7:	eb e5                	jmp    8007ce <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  8007e9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007ec:	83 f8 2f             	cmp    $0x2f,%eax
+  8007ef:	77 5a                	ja     80084b <vprintfmt+0x1de>
+  8007f1:	89 c2                	mov    %eax,%edx
+  8007f3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007f7:	83 c0 08             	add    $0x8,%eax
+  8007fa:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  8007fd:	8b 02                	mov    (%rdx),%eax
+  8007ff:	89 c1                	mov    %eax,%ecx
+  800801:	f7 d9                	neg    %ecx
+  800803:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  800806:	83 f9 15             	cmp    $0x15,%ecx
+  800809:	7f 4e                	jg     800859 <vprintfmt+0x1ec>
+  80080b:	48 63 c1             	movslq %ecx,%rax
+  80080e:	48 ba c0 36 80 00 00 	movabs $0x8036c0,%rdx
+  800815:	00 00 00 
+  800818:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80081c:	48 85 c0             	test   %rax,%rax
+  80081f:	74 38                	je     800859 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  800821:	48 89 c1             	mov    %rax,%rcx
+  800824:	48 ba d9 38 80 00 00 	movabs $0x8038d9,%rdx
+  80082b:	00 00 00 
+  80082e:	4c 89 ee             	mov    %r13,%rsi
+  800831:	4c 89 f7             	mov    %r14,%rdi
+  800834:	b8 00 00 00 00       	mov    $0x0,%eax
+  800839:	49 b8 30 06 80 00 00 	movabs $0x800630,%r8
+  800840:	00 00 00 
+  800843:	41 ff d0             	call   *%r8
+  800846:	e9 53 fe ff ff       	jmp    80069e <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  80084b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80084f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800853:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800857:	eb a4                	jmp    8007fd <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  800859:	48 ba 54 32 80 00 00 	movabs $0x803254,%rdx
+  800860:	00 00 00 
+  800863:	4c 89 ee             	mov    %r13,%rsi
+  800866:	4c 89 f7             	mov    %r14,%rdi
+  800869:	b8 00 00 00 00       	mov    $0x0,%eax
+  80086e:	49 b8 30 06 80 00 00 	movabs $0x800630,%r8
+  800875:	00 00 00 
+  800878:	41 ff d0             	call   *%r8
+  80087b:	e9 1e fe ff ff       	jmp    80069e <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800880:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800883:	83 f8 2f             	cmp    $0x2f,%eax
+  800886:	77 6c                	ja     8008f4 <vprintfmt+0x287>
+  800888:	89 c2                	mov    %eax,%edx
+  80088a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80088e:	83 c0 08             	add    $0x8,%eax
+  800891:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800894:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  800897:	48 85 d2             	test   %rdx,%rdx
+  80089a:	48 b8 4d 32 80 00 00 	movabs $0x80324d,%rax
+  8008a1:	00 00 00 
+  8008a4:	48 0f 45 c2          	cmovne %rdx,%rax
+  8008a8:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  8008ac:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8008b0:	7e 06                	jle    8008b8 <vprintfmt+0x24b>
+  8008b2:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  8008b6:	75 4a                	jne    800902 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8008b8:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8008bc:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8008c0:	0f b6 00             	movzbl (%rax),%eax
+  8008c3:	84 c0                	test   %al,%al
+  8008c5:	0f 85 9a 00 00 00    	jne    800965 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  8008cb:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8008ce:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  8008d2:	85 c0                	test   %eax,%eax
+  8008d4:	0f 8e c4 fd ff ff    	jle    80069e <vprintfmt+0x31>
+  8008da:	4c 89 ee             	mov    %r13,%rsi
+  8008dd:	bf 20 00 00 00       	mov    $0x20,%edi
+  8008e2:	41 ff d6             	call   *%r14
+  8008e5:	41 83 ec 01          	sub    $0x1,%r12d
+  8008e9:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  8008ed:	75 eb                	jne    8008da <vprintfmt+0x26d>
+  8008ef:	e9 aa fd ff ff       	jmp    80069e <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8008f4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008f8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008fc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800900:	eb 92                	jmp    800894 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  800902:	49 63 f7             	movslq %r15d,%rsi
+  800905:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  800909:	48 b8 1f 0e 80 00 00 	movabs $0x800e1f,%rax
+  800910:	00 00 00 
+  800913:	ff d0                	call   *%rax
+  800915:	48 89 c2             	mov    %rax,%rdx
+  800918:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80091b:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  80091d:	8d 70 ff             	lea    -0x1(%rax),%esi
+  800920:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  800923:	85 c0                	test   %eax,%eax
+  800925:	7e 91                	jle    8008b8 <vprintfmt+0x24b>
+  800927:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  80092c:	4c 89 ee             	mov    %r13,%rsi
+  80092f:	44 89 e7             	mov    %r12d,%edi
+  800932:	41 ff d6             	call   *%r14
+  800935:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800939:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80093c:	83 f8 ff             	cmp    $0xffffffff,%eax
+  80093f:	75 eb                	jne    80092c <vprintfmt+0x2bf>
+  800941:	e9 72 ff ff ff       	jmp    8008b8 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800946:	0f b6 f8             	movzbl %al,%edi
+  800949:	4c 89 ee             	mov    %r13,%rsi
+  80094c:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  80094f:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800953:	49 83 c4 01          	add    $0x1,%r12
+  800957:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  80095d:	84 c0                	test   %al,%al
+  80095f:	0f 84 66 ff ff ff    	je     8008cb <vprintfmt+0x25e>
+  800965:	45 85 ff             	test   %r15d,%r15d
+  800968:	78 0a                	js     800974 <vprintfmt+0x307>
+  80096a:	41 83 ef 01          	sub    $0x1,%r15d
+  80096e:	0f 88 57 ff ff ff    	js     8008cb <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800974:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  800978:	74 cc                	je     800946 <vprintfmt+0x2d9>
+  80097a:	8d 50 e0             	lea    -0x20(%rax),%edx
+  80097d:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800982:	80 fa 5e             	cmp    $0x5e,%dl
+  800985:	77 c2                	ja     800949 <vprintfmt+0x2dc>
+  800987:	eb bd                	jmp    800946 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  800989:	40 84 f6             	test   %sil,%sil
+  80098c:	75 26                	jne    8009b4 <vprintfmt+0x347>
+    switch (lflag) {
+  80098e:	85 d2                	test   %edx,%edx
+  800990:	74 59                	je     8009eb <vprintfmt+0x37e>
+  800992:	83 fa 01             	cmp    $0x1,%edx
+  800995:	74 7b                	je     800a12 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  800997:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80099a:	83 f8 2f             	cmp    $0x2f,%eax
+  80099d:	0f 87 96 00 00 00    	ja     800a39 <vprintfmt+0x3cc>
+  8009a3:	89 c2                	mov    %eax,%edx
+  8009a5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009a9:	83 c0 08             	add    $0x8,%eax
+  8009ac:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009af:	4c 8b 22             	mov    (%rdx),%r12
+  8009b2:	eb 17                	jmp    8009cb <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  8009b4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009b7:	83 f8 2f             	cmp    $0x2f,%eax
+  8009ba:	77 21                	ja     8009dd <vprintfmt+0x370>
+  8009bc:	89 c2                	mov    %eax,%edx
+  8009be:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009c2:	83 c0 08             	add    $0x8,%eax
+  8009c5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009c8:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  8009cb:	4d 85 e4             	test   %r12,%r12
+  8009ce:	78 7a                	js     800a4a <vprintfmt+0x3dd>
+            num = i;
+  8009d0:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  8009d3:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  8009d8:	e9 50 02 00 00       	jmp    800c2d <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8009dd:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009e1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009e5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009e9:	eb dd                	jmp    8009c8 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  8009eb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009ee:	83 f8 2f             	cmp    $0x2f,%eax
+  8009f1:	77 11                	ja     800a04 <vprintfmt+0x397>
+  8009f3:	89 c2                	mov    %eax,%edx
+  8009f5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009f9:	83 c0 08             	add    $0x8,%eax
+  8009fc:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009ff:	4c 63 22             	movslq (%rdx),%r12
+  800a02:	eb c7                	jmp    8009cb <vprintfmt+0x35e>
+  800a04:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a08:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a0c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a10:	eb ed                	jmp    8009ff <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  800a12:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a15:	83 f8 2f             	cmp    $0x2f,%eax
+  800a18:	77 11                	ja     800a2b <vprintfmt+0x3be>
+  800a1a:	89 c2                	mov    %eax,%edx
+  800a1c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a20:	83 c0 08             	add    $0x8,%eax
+  800a23:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a26:	4c 8b 22             	mov    (%rdx),%r12
+  800a29:	eb a0                	jmp    8009cb <vprintfmt+0x35e>
+  800a2b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a2f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a33:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a37:	eb ed                	jmp    800a26 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  800a39:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a3d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a41:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a45:	e9 65 ff ff ff       	jmp    8009af <vprintfmt+0x342>
+                putch('-', put_arg);
+  800a4a:	4c 89 ee             	mov    %r13,%rsi
+  800a4d:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800a52:	41 ff d6             	call   *%r14
+                i = -i;
+  800a55:	49 f7 dc             	neg    %r12
+  800a58:	e9 73 ff ff ff       	jmp    8009d0 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  800a5d:	40 84 f6             	test   %sil,%sil
+  800a60:	75 32                	jne    800a94 <vprintfmt+0x427>
+    switch (lflag) {
+  800a62:	85 d2                	test   %edx,%edx
+  800a64:	74 5d                	je     800ac3 <vprintfmt+0x456>
+  800a66:	83 fa 01             	cmp    $0x1,%edx
+  800a69:	0f 84 82 00 00 00    	je     800af1 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  800a6f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a72:	83 f8 2f             	cmp    $0x2f,%eax
+  800a75:	0f 87 a5 00 00 00    	ja     800b20 <vprintfmt+0x4b3>
+  800a7b:	89 c2                	mov    %eax,%edx
+  800a7d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a81:	83 c0 08             	add    $0x8,%eax
+  800a84:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a87:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800a8a:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  800a8f:	e9 99 01 00 00       	jmp    800c2d <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800a94:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a97:	83 f8 2f             	cmp    $0x2f,%eax
+  800a9a:	77 19                	ja     800ab5 <vprintfmt+0x448>
+  800a9c:	89 c2                	mov    %eax,%edx
+  800a9e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800aa2:	83 c0 08             	add    $0x8,%eax
+  800aa5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800aa8:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800aab:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800ab0:	e9 78 01 00 00       	jmp    800c2d <vprintfmt+0x5c0>
+  800ab5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ab9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800abd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ac1:	eb e5                	jmp    800aa8 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  800ac3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ac6:	83 f8 2f             	cmp    $0x2f,%eax
+  800ac9:	77 18                	ja     800ae3 <vprintfmt+0x476>
+  800acb:	89 c2                	mov    %eax,%edx
+  800acd:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ad1:	83 c0 08             	add    $0x8,%eax
+  800ad4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ad7:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800ad9:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  800ade:	e9 4a 01 00 00       	jmp    800c2d <vprintfmt+0x5c0>
+  800ae3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ae7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800aeb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800aef:	eb e6                	jmp    800ad7 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  800af1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800af4:	83 f8 2f             	cmp    $0x2f,%eax
+  800af7:	77 19                	ja     800b12 <vprintfmt+0x4a5>
+  800af9:	89 c2                	mov    %eax,%edx
+  800afb:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800aff:	83 c0 08             	add    $0x8,%eax
+  800b02:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b05:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800b08:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  800b0d:	e9 1b 01 00 00       	jmp    800c2d <vprintfmt+0x5c0>
+  800b12:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b16:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b1a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b1e:	eb e5                	jmp    800b05 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  800b20:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b24:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b28:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b2c:	e9 56 ff ff ff       	jmp    800a87 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  800b31:	40 84 f6             	test   %sil,%sil
+  800b34:	75 2e                	jne    800b64 <vprintfmt+0x4f7>
+    switch (lflag) {
+  800b36:	85 d2                	test   %edx,%edx
+  800b38:	74 59                	je     800b93 <vprintfmt+0x526>
+  800b3a:	83 fa 01             	cmp    $0x1,%edx
+  800b3d:	74 7f                	je     800bbe <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  800b3f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b42:	83 f8 2f             	cmp    $0x2f,%eax
+  800b45:	0f 87 9f 00 00 00    	ja     800bea <vprintfmt+0x57d>
+  800b4b:	89 c2                	mov    %eax,%edx
+  800b4d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b51:	83 c0 08             	add    $0x8,%eax
+  800b54:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b57:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800b5a:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  800b5f:	e9 c9 00 00 00       	jmp    800c2d <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800b64:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b67:	83 f8 2f             	cmp    $0x2f,%eax
+  800b6a:	77 19                	ja     800b85 <vprintfmt+0x518>
+  800b6c:	89 c2                	mov    %eax,%edx
+  800b6e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b72:	83 c0 08             	add    $0x8,%eax
+  800b75:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b78:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800b7b:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800b80:	e9 a8 00 00 00       	jmp    800c2d <vprintfmt+0x5c0>
+  800b85:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b89:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b8d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b91:	eb e5                	jmp    800b78 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  800b93:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b96:	83 f8 2f             	cmp    $0x2f,%eax
+  800b99:	77 15                	ja     800bb0 <vprintfmt+0x543>
+  800b9b:	89 c2                	mov    %eax,%edx
+  800b9d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ba1:	83 c0 08             	add    $0x8,%eax
+  800ba4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ba7:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  800ba9:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  800bae:	eb 7d                	jmp    800c2d <vprintfmt+0x5c0>
+  800bb0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bb4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bb8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bbc:	eb e9                	jmp    800ba7 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  800bbe:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bc1:	83 f8 2f             	cmp    $0x2f,%eax
+  800bc4:	77 16                	ja     800bdc <vprintfmt+0x56f>
+  800bc6:	89 c2                	mov    %eax,%edx
+  800bc8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800bcc:	83 c0 08             	add    $0x8,%eax
+  800bcf:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800bd2:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800bd5:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  800bda:	eb 51                	jmp    800c2d <vprintfmt+0x5c0>
+  800bdc:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800be0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800be4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800be8:	eb e8                	jmp    800bd2 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  800bea:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bee:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bf2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bf6:	e9 5c ff ff ff       	jmp    800b57 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  800bfb:	4c 89 ee             	mov    %r13,%rsi
+  800bfe:	bf 30 00 00 00       	mov    $0x30,%edi
+  800c03:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800c06:	4c 89 ee             	mov    %r13,%rsi
+  800c09:	bf 78 00 00 00       	mov    $0x78,%edi
+  800c0e:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800c11:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c14:	83 f8 2f             	cmp    $0x2f,%eax
+  800c17:	77 47                	ja     800c60 <vprintfmt+0x5f3>
+  800c19:	89 c2                	mov    %eax,%edx
+  800c1b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c1f:	83 c0 08             	add    $0x8,%eax
+  800c22:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c25:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800c28:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800c2d:	48 83 ec 08          	sub    $0x8,%rsp
+  800c31:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800c35:	0f 94 c0             	sete   %al
+  800c38:	0f b6 c0             	movzbl %al,%eax
+  800c3b:	50                   	push   %rax
+  800c3c:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800c41:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800c45:	4c 89 ee             	mov    %r13,%rsi
+  800c48:	4c 89 f7             	mov    %r14,%rdi
+  800c4b:	48 b8 62 05 80 00 00 	movabs $0x800562,%rax
+  800c52:	00 00 00 
+  800c55:	ff d0                	call   *%rax
+            break;
+  800c57:	48 83 c4 10          	add    $0x10,%rsp
+  800c5b:	e9 3e fa ff ff       	jmp    80069e <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800c60:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c64:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c68:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c6c:	eb b7                	jmp    800c25 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  800c6e:	40 84 f6             	test   %sil,%sil
+  800c71:	75 2b                	jne    800c9e <vprintfmt+0x631>
+    switch (lflag) {
+  800c73:	85 d2                	test   %edx,%edx
+  800c75:	74 56                	je     800ccd <vprintfmt+0x660>
+  800c77:	83 fa 01             	cmp    $0x1,%edx
+  800c7a:	74 7f                	je     800cfb <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800c7c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c7f:	83 f8 2f             	cmp    $0x2f,%eax
+  800c82:	0f 87 a2 00 00 00    	ja     800d2a <vprintfmt+0x6bd>
+  800c88:	89 c2                	mov    %eax,%edx
+  800c8a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c8e:	83 c0 08             	add    $0x8,%eax
+  800c91:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c94:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800c97:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800c9c:	eb 8f                	jmp    800c2d <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800c9e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ca1:	83 f8 2f             	cmp    $0x2f,%eax
+  800ca4:	77 19                	ja     800cbf <vprintfmt+0x652>
+  800ca6:	89 c2                	mov    %eax,%edx
+  800ca8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800cac:	83 c0 08             	add    $0x8,%eax
+  800caf:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800cb2:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800cb5:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800cba:	e9 6e ff ff ff       	jmp    800c2d <vprintfmt+0x5c0>
+  800cbf:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800cc3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800cc7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ccb:	eb e5                	jmp    800cb2 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800ccd:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800cd0:	83 f8 2f             	cmp    $0x2f,%eax
+  800cd3:	77 18                	ja     800ced <vprintfmt+0x680>
+  800cd5:	89 c2                	mov    %eax,%edx
+  800cd7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800cdb:	83 c0 08             	add    $0x8,%eax
+  800cde:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ce1:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800ce3:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800ce8:	e9 40 ff ff ff       	jmp    800c2d <vprintfmt+0x5c0>
+  800ced:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800cf1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800cf5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800cf9:	eb e6                	jmp    800ce1 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800cfb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800cfe:	83 f8 2f             	cmp    $0x2f,%eax
+  800d01:	77 19                	ja     800d1c <vprintfmt+0x6af>
+  800d03:	89 c2                	mov    %eax,%edx
+  800d05:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d09:	83 c0 08             	add    $0x8,%eax
+  800d0c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d0f:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800d12:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800d17:	e9 11 ff ff ff       	jmp    800c2d <vprintfmt+0x5c0>
+  800d1c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d20:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d24:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d28:	eb e5                	jmp    800d0f <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800d2a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d2e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d32:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d36:	e9 59 ff ff ff       	jmp    800c94 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800d3b:	4c 89 ee             	mov    %r13,%rsi
+  800d3e:	bf 25 00 00 00       	mov    $0x25,%edi
+  800d43:	41 ff d6             	call   *%r14
+            break;
+  800d46:	e9 53 f9 ff ff       	jmp    80069e <vprintfmt+0x31>
+            putch('%', put_arg);
+  800d4b:	4c 89 ee             	mov    %r13,%rsi
+  800d4e:	bf 25 00 00 00       	mov    $0x25,%edi
+  800d53:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800d56:	48 83 eb 01          	sub    $0x1,%rbx
+  800d5a:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800d5e:	75 f6                	jne    800d56 <vprintfmt+0x6e9>
+  800d60:	e9 39 f9 ff ff       	jmp    80069e <vprintfmt+0x31>
+}
+  800d65:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800d69:	5b                   	pop    %rbx
+  800d6a:	41 5c                	pop    %r12
+  800d6c:	41 5d                	pop    %r13
+  800d6e:	41 5e                	pop    %r14
+  800d70:	41 5f                	pop    %r15
+  800d72:	5d                   	pop    %rbp
+  800d73:	c3                   	ret
+
+0000000000800d74 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800d74:	55                   	push   %rbp
+  800d75:	48 89 e5             	mov    %rsp,%rbp
+  800d78:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800d7c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800d80:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800d85:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800d89:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800d90:	48 85 ff             	test   %rdi,%rdi
+  800d93:	74 2b                	je     800dc0 <vsnprintf+0x4c>
+  800d95:	48 85 f6             	test   %rsi,%rsi
+  800d98:	74 26                	je     800dc0 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800d9a:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800d9e:	48 bf 18 06 80 00 00 	movabs $0x800618,%rdi
+  800da5:	00 00 00 
+  800da8:	48 b8 6d 06 80 00 00 	movabs $0x80066d,%rax
+  800daf:	00 00 00 
+  800db2:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800db4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800db8:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800dbb:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800dbe:	c9                   	leave
+  800dbf:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800dc0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800dc5:	eb f7                	jmp    800dbe <vsnprintf+0x4a>
+
+0000000000800dc7 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800dc7:	55                   	push   %rbp
+  800dc8:	48 89 e5             	mov    %rsp,%rbp
+  800dcb:	48 83 ec 50          	sub    $0x50,%rsp
+  800dcf:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800dd3:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800dd7:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800ddb:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800de2:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800de6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800dea:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800dee:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800df2:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800df6:	48 b8 74 0d 80 00 00 	movabs $0x800d74,%rax
+  800dfd:	00 00 00 
+  800e00:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800e02:	c9                   	leave
+  800e03:	c3                   	ret
+
+0000000000800e04 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800e04:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800e07:	74 10                	je     800e19 <strlen+0x15>
+    size_t n = 0;
+  800e09:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800e0e:	48 83 c0 01          	add    $0x1,%rax
+  800e12:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800e16:	75 f6                	jne    800e0e <strlen+0xa>
+  800e18:	c3                   	ret
+    size_t n = 0;
+  800e19:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800e1e:	c3                   	ret
+
+0000000000800e1f <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800e1f:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800e22:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800e27:	48 85 f6             	test   %rsi,%rsi
+  800e2a:	74 11                	je     800e3d <strnlen+0x1e>
+  800e2c:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800e30:	74 0c                	je     800e3e <strnlen+0x1f>
+  800e32:	48 83 c2 01          	add    $0x1,%rdx
+  800e36:	48 39 d0             	cmp    %rdx,%rax
+  800e39:	75 f1                	jne    800e2c <strnlen+0xd>
+  800e3b:	eb 04                	jmp    800e41 <strnlen+0x22>
+  800e3d:	c3                   	ret
+  800e3e:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800e41:	c3                   	ret
+
+0000000000800e42 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800e42:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800e45:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e4a:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800e4e:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800e51:	48 83 c2 01          	add    $0x1,%rdx
+  800e55:	84 c9                	test   %cl,%cl
+  800e57:	75 f1                	jne    800e4a <strcpy+0x8>
+        ;
+    return res;
+}
+  800e59:	c3                   	ret
+
+0000000000800e5a <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800e5a:	55                   	push   %rbp
+  800e5b:	48 89 e5             	mov    %rsp,%rbp
+  800e5e:	41 54                	push   %r12
+  800e60:	53                   	push   %rbx
+  800e61:	48 89 fb             	mov    %rdi,%rbx
+  800e64:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800e67:	48 b8 04 0e 80 00 00 	movabs $0x800e04,%rax
+  800e6e:	00 00 00 
+  800e71:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800e73:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800e77:	4c 89 e6             	mov    %r12,%rsi
+  800e7a:	48 b8 42 0e 80 00 00 	movabs $0x800e42,%rax
+  800e81:	00 00 00 
+  800e84:	ff d0                	call   *%rax
+    return dst;
+}
+  800e86:	48 89 d8             	mov    %rbx,%rax
+  800e89:	5b                   	pop    %rbx
+  800e8a:	41 5c                	pop    %r12
+  800e8c:	5d                   	pop    %rbp
+  800e8d:	c3                   	ret
+
+0000000000800e8e <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800e8e:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800e91:	48 85 d2             	test   %rdx,%rdx
+  800e94:	74 1f                	je     800eb5 <strncpy+0x27>
+  800e96:	48 01 fa             	add    %rdi,%rdx
+  800e99:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800e9c:	48 83 c1 01          	add    $0x1,%rcx
+  800ea0:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800ea4:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800ea8:	41 80 f8 01          	cmp    $0x1,%r8b
+  800eac:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800eb0:	48 39 ca             	cmp    %rcx,%rdx
+  800eb3:	75 e7                	jne    800e9c <strncpy+0xe>
+    }
+    return ret;
+}
+  800eb5:	c3                   	ret
+
+0000000000800eb6 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800eb6:	48 89 f8             	mov    %rdi,%rax
+  800eb9:	48 85 d2             	test   %rdx,%rdx
+  800ebc:	74 24                	je     800ee2 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800ebe:	48 83 ea 01          	sub    $0x1,%rdx
+  800ec2:	74 1b                	je     800edf <strlcpy+0x29>
+  800ec4:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800ec8:	0f b6 16             	movzbl (%rsi),%edx
+  800ecb:	84 d2                	test   %dl,%dl
+  800ecd:	74 10                	je     800edf <strlcpy+0x29>
+            *dst++ = *src++;
+  800ecf:	48 83 c6 01          	add    $0x1,%rsi
+  800ed3:	48 83 c0 01          	add    $0x1,%rax
+  800ed7:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800eda:	48 39 c8             	cmp    %rcx,%rax
+  800edd:	75 e9                	jne    800ec8 <strlcpy+0x12>
+        *dst = '\0';
+  800edf:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800ee2:	48 29 f8             	sub    %rdi,%rax
+}
+  800ee5:	c3                   	ret
+
+0000000000800ee6 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800ee6:	0f b6 07             	movzbl (%rdi),%eax
+  800ee9:	84 c0                	test   %al,%al
+  800eeb:	74 13                	je     800f00 <strcmp+0x1a>
+  800eed:	38 06                	cmp    %al,(%rsi)
+  800eef:	75 0f                	jne    800f00 <strcmp+0x1a>
+  800ef1:	48 83 c7 01          	add    $0x1,%rdi
+  800ef5:	48 83 c6 01          	add    $0x1,%rsi
+  800ef9:	0f b6 07             	movzbl (%rdi),%eax
+  800efc:	84 c0                	test   %al,%al
+  800efe:	75 ed                	jne    800eed <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800f00:	0f b6 c0             	movzbl %al,%eax
+  800f03:	0f b6 16             	movzbl (%rsi),%edx
+  800f06:	29 d0                	sub    %edx,%eax
+}
+  800f08:	c3                   	ret
+
+0000000000800f09 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800f09:	48 85 d2             	test   %rdx,%rdx
+  800f0c:	74 1f                	je     800f2d <strncmp+0x24>
+  800f0e:	0f b6 07             	movzbl (%rdi),%eax
+  800f11:	84 c0                	test   %al,%al
+  800f13:	74 1e                	je     800f33 <strncmp+0x2a>
+  800f15:	3a 06                	cmp    (%rsi),%al
+  800f17:	75 1a                	jne    800f33 <strncmp+0x2a>
+  800f19:	48 83 c7 01          	add    $0x1,%rdi
+  800f1d:	48 83 c6 01          	add    $0x1,%rsi
+  800f21:	48 83 ea 01          	sub    $0x1,%rdx
+  800f25:	75 e7                	jne    800f0e <strncmp+0x5>
+
+    if (!n) return 0;
+  800f27:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f2c:	c3                   	ret
+  800f2d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f32:	c3                   	ret
+  800f33:	48 85 d2             	test   %rdx,%rdx
+  800f36:	74 09                	je     800f41 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800f38:	0f b6 07             	movzbl (%rdi),%eax
+  800f3b:	0f b6 16             	movzbl (%rsi),%edx
+  800f3e:	29 d0                	sub    %edx,%eax
+  800f40:	c3                   	ret
+    if (!n) return 0;
+  800f41:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800f46:	c3                   	ret
+
+0000000000800f47 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800f47:	0f b6 17             	movzbl (%rdi),%edx
+  800f4a:	84 d2                	test   %dl,%dl
+  800f4c:	74 18                	je     800f66 <strchr+0x1f>
+        if (*str == c) {
+  800f4e:	0f be d2             	movsbl %dl,%edx
+  800f51:	39 f2                	cmp    %esi,%edx
+  800f53:	74 17                	je     800f6c <strchr+0x25>
+    for (; *str; str++) {
+  800f55:	48 83 c7 01          	add    $0x1,%rdi
+  800f59:	0f b6 17             	movzbl (%rdi),%edx
+  800f5c:	84 d2                	test   %dl,%dl
+  800f5e:	75 ee                	jne    800f4e <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800f60:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f65:	c3                   	ret
+  800f66:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f6b:	c3                   	ret
+  800f6c:	48 89 f8             	mov    %rdi,%rax
+}
+  800f6f:	c3                   	ret
+
+0000000000800f70 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800f70:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800f73:	0f b6 17             	movzbl (%rdi),%edx
+  800f76:	84 d2                	test   %dl,%dl
+  800f78:	74 13                	je     800f8d <strfind+0x1d>
+  800f7a:	0f be d2             	movsbl %dl,%edx
+  800f7d:	39 f2                	cmp    %esi,%edx
+  800f7f:	74 0b                	je     800f8c <strfind+0x1c>
+  800f81:	48 83 c0 01          	add    $0x1,%rax
+  800f85:	0f b6 10             	movzbl (%rax),%edx
+  800f88:	84 d2                	test   %dl,%dl
+  800f8a:	75 ee                	jne    800f7a <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800f8c:	c3                   	ret
+  800f8d:	c3                   	ret
+
+0000000000800f8e <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800f8e:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800f91:	48 89 f8             	mov    %rdi,%rax
+  800f94:	48 f7 d8             	neg    %rax
+  800f97:	83 e0 07             	and    $0x7,%eax
+  800f9a:	49 89 d1             	mov    %rdx,%r9
+  800f9d:	49 29 c1             	sub    %rax,%r9
+  800fa0:	78 36                	js     800fd8 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800fa2:	40 0f b6 c6          	movzbl %sil,%eax
+  800fa6:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800fad:	01 01 01 
+  800fb0:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800fb4:	40 f6 c7 07          	test   $0x7,%dil
+  800fb8:	75 38                	jne    800ff2 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800fba:	4c 89 c9             	mov    %r9,%rcx
+  800fbd:	48 c1 f9 03          	sar    $0x3,%rcx
+  800fc1:	74 0c                	je     800fcf <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800fc3:	fc                   	cld
+  800fc4:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800fc7:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800fcb:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800fcf:	4d 85 c9             	test   %r9,%r9
+  800fd2:	75 45                	jne    801019 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800fd4:	4c 89 c0             	mov    %r8,%rax
+  800fd7:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800fd8:	48 85 d2             	test   %rdx,%rdx
+  800fdb:	74 f7                	je     800fd4 <memset+0x46>
+  800fdd:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800fe0:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800fe3:	48 83 c0 01          	add    $0x1,%rax
+  800fe7:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  800feb:	48 39 c2             	cmp    %rax,%rdx
+  800fee:	75 f3                	jne    800fe3 <memset+0x55>
+  800ff0:	eb e2                	jmp    800fd4 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  800ff2:	40 f6 c7 01          	test   $0x1,%dil
+  800ff6:	74 06                	je     800ffe <memset+0x70>
+  800ff8:	88 07                	mov    %al,(%rdi)
+  800ffa:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800ffe:	40 f6 c7 02          	test   $0x2,%dil
+  801002:	74 07                	je     80100b <memset+0x7d>
+  801004:	66 89 07             	mov    %ax,(%rdi)
+  801007:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  80100b:	40 f6 c7 04          	test   $0x4,%dil
+  80100f:	74 a9                	je     800fba <memset+0x2c>
+  801011:	89 07                	mov    %eax,(%rdi)
+  801013:	48 83 c7 04          	add    $0x4,%rdi
+  801017:	eb a1                	jmp    800fba <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  801019:	41 f6 c1 04          	test   $0x4,%r9b
+  80101d:	74 06                	je     801025 <memset+0x97>
+  80101f:	89 07                	mov    %eax,(%rdi)
+  801021:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  801025:	41 f6 c1 02          	test   $0x2,%r9b
+  801029:	74 07                	je     801032 <memset+0xa4>
+  80102b:	66 89 07             	mov    %ax,(%rdi)
+  80102e:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  801032:	41 f6 c1 01          	test   $0x1,%r9b
+  801036:	74 9c                	je     800fd4 <memset+0x46>
+  801038:	88 07                	mov    %al,(%rdi)
+  80103a:	eb 98                	jmp    800fd4 <memset+0x46>
+
+000000000080103c <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  80103c:	48 89 f8             	mov    %rdi,%rax
+  80103f:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  801042:	48 39 fe             	cmp    %rdi,%rsi
+  801045:	73 3b                	jae    801082 <memmove+0x46>
+  801047:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  80104b:	48 39 d7             	cmp    %rdx,%rdi
+  80104e:	73 32                	jae    801082 <memmove+0x46>
+        s += n;
+        d += n;
+  801050:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  801054:	48 89 d6             	mov    %rdx,%rsi
+  801057:	48 09 fe             	or     %rdi,%rsi
+  80105a:	48 09 ce             	or     %rcx,%rsi
+  80105d:	40 f6 c6 07          	test   $0x7,%sil
+  801061:	75 12                	jne    801075 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  801063:	48 83 ef 08          	sub    $0x8,%rdi
+  801067:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  80106b:	48 c1 e9 03          	shr    $0x3,%rcx
+  80106f:	fd                   	std
+  801070:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  801073:	fc                   	cld
+  801074:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  801075:	48 83 ef 01          	sub    $0x1,%rdi
+  801079:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  80107d:	fd                   	std
+  80107e:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  801080:	eb f1                	jmp    801073 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  801082:	48 89 f2             	mov    %rsi,%rdx
+  801085:	48 09 c2             	or     %rax,%rdx
+  801088:	48 09 ca             	or     %rcx,%rdx
+  80108b:	f6 c2 07             	test   $0x7,%dl
+  80108e:	75 0c                	jne    80109c <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  801090:	48 c1 e9 03          	shr    $0x3,%rcx
+  801094:	48 89 c7             	mov    %rax,%rdi
+  801097:	fc                   	cld
+  801098:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  80109b:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  80109c:	48 89 c7             	mov    %rax,%rdi
+  80109f:	fc                   	cld
+  8010a0:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  8010a2:	c3                   	ret
+
+00000000008010a3 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  8010a3:	55                   	push   %rbp
+  8010a4:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  8010a7:	48 b8 3c 10 80 00 00 	movabs $0x80103c,%rax
+  8010ae:	00 00 00 
+  8010b1:	ff d0                	call   *%rax
+}
+  8010b3:	5d                   	pop    %rbp
+  8010b4:	c3                   	ret
+
+00000000008010b5 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  8010b5:	55                   	push   %rbp
+  8010b6:	48 89 e5             	mov    %rsp,%rbp
+  8010b9:	41 57                	push   %r15
+  8010bb:	41 56                	push   %r14
+  8010bd:	41 55                	push   %r13
+  8010bf:	41 54                	push   %r12
+  8010c1:	53                   	push   %rbx
+  8010c2:	48 83 ec 08          	sub    $0x8,%rsp
+  8010c6:	49 89 fe             	mov    %rdi,%r14
+  8010c9:	49 89 f7             	mov    %rsi,%r15
+  8010cc:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  8010cf:	48 89 f7             	mov    %rsi,%rdi
+  8010d2:	48 b8 04 0e 80 00 00 	movabs $0x800e04,%rax
+  8010d9:	00 00 00 
+  8010dc:	ff d0                	call   *%rax
+  8010de:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  8010e1:	48 89 de             	mov    %rbx,%rsi
+  8010e4:	4c 89 f7             	mov    %r14,%rdi
+  8010e7:	48 b8 1f 0e 80 00 00 	movabs $0x800e1f,%rax
+  8010ee:	00 00 00 
+  8010f1:	ff d0                	call   *%rax
+  8010f3:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  8010f6:	48 39 c3             	cmp    %rax,%rbx
+  8010f9:	74 36                	je     801131 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  8010fb:	48 89 d8             	mov    %rbx,%rax
+  8010fe:	4c 29 e8             	sub    %r13,%rax
+  801101:	49 39 c4             	cmp    %rax,%r12
+  801104:	73 31                	jae    801137 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  801106:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  80110b:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  80110f:	4c 89 fe             	mov    %r15,%rsi
+  801112:	48 b8 a3 10 80 00 00 	movabs $0x8010a3,%rax
+  801119:	00 00 00 
+  80111c:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  80111e:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  801122:	48 83 c4 08          	add    $0x8,%rsp
+  801126:	5b                   	pop    %rbx
+  801127:	41 5c                	pop    %r12
+  801129:	41 5d                	pop    %r13
+  80112b:	41 5e                	pop    %r14
+  80112d:	41 5f                	pop    %r15
+  80112f:	5d                   	pop    %rbp
+  801130:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  801131:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  801135:	eb eb                	jmp    801122 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  801137:	48 83 eb 01          	sub    $0x1,%rbx
+  80113b:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  80113f:	48 89 da             	mov    %rbx,%rdx
+  801142:	4c 89 fe             	mov    %r15,%rsi
+  801145:	48 b8 a3 10 80 00 00 	movabs $0x8010a3,%rax
+  80114c:	00 00 00 
+  80114f:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  801151:	49 01 de             	add    %rbx,%r14
+  801154:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  801159:	eb c3                	jmp    80111e <strlcat+0x69>
+
+000000000080115b <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  80115b:	48 85 d2             	test   %rdx,%rdx
+  80115e:	74 2d                	je     80118d <memcmp+0x32>
+  801160:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  801165:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  801169:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  80116e:	44 38 c1             	cmp    %r8b,%cl
+  801171:	75 0f                	jne    801182 <memcmp+0x27>
+    while (n-- > 0) {
+  801173:	48 83 c0 01          	add    $0x1,%rax
+  801177:	48 39 c2             	cmp    %rax,%rdx
+  80117a:	75 e9                	jne    801165 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  80117c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801181:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  801182:	0f b6 c1             	movzbl %cl,%eax
+  801185:	45 0f b6 c0          	movzbl %r8b,%r8d
+  801189:	44 29 c0             	sub    %r8d,%eax
+  80118c:	c3                   	ret
+    return 0;
+  80118d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801192:	c3                   	ret
+
+0000000000801193 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  801193:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  801197:	48 39 c7             	cmp    %rax,%rdi
+  80119a:	73 0f                	jae    8011ab <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  80119c:	40 38 37             	cmp    %sil,(%rdi)
+  80119f:	74 0e                	je     8011af <memfind+0x1c>
+    for (; src < end; src++) {
+  8011a1:	48 83 c7 01          	add    $0x1,%rdi
+  8011a5:	48 39 f8             	cmp    %rdi,%rax
+  8011a8:	75 f2                	jne    80119c <memfind+0x9>
+  8011aa:	c3                   	ret
+  8011ab:	48 89 f8             	mov    %rdi,%rax
+  8011ae:	c3                   	ret
+  8011af:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  8011b2:	c3                   	ret
+
+00000000008011b3 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  8011b3:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  8011b6:	0f b6 37             	movzbl (%rdi),%esi
+  8011b9:	40 80 fe 20          	cmp    $0x20,%sil
+  8011bd:	74 06                	je     8011c5 <strtol+0x12>
+  8011bf:	40 80 fe 09          	cmp    $0x9,%sil
+  8011c3:	75 13                	jne    8011d8 <strtol+0x25>
+  8011c5:	48 83 c7 01          	add    $0x1,%rdi
+  8011c9:	0f b6 37             	movzbl (%rdi),%esi
+  8011cc:	40 80 fe 20          	cmp    $0x20,%sil
+  8011d0:	74 f3                	je     8011c5 <strtol+0x12>
+  8011d2:	40 80 fe 09          	cmp    $0x9,%sil
+  8011d6:	74 ed                	je     8011c5 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  8011d8:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  8011db:	83 e0 fd             	and    $0xfffffffd,%eax
+  8011de:	3c 01                	cmp    $0x1,%al
+  8011e0:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8011e4:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  8011ea:	75 0f                	jne    8011fb <strtol+0x48>
+  8011ec:	80 3f 30             	cmpb   $0x30,(%rdi)
+  8011ef:	74 14                	je     801205 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  8011f1:	85 d2                	test   %edx,%edx
+  8011f3:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8011f8:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  8011fb:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  801200:	4c 63 ca             	movslq %edx,%r9
+  801203:	eb 36                	jmp    80123b <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801205:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  801209:	74 0f                	je     80121a <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  80120b:	85 d2                	test   %edx,%edx
+  80120d:	75 ec                	jne    8011fb <strtol+0x48>
+        s++;
+  80120f:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  801213:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  801218:	eb e1                	jmp    8011fb <strtol+0x48>
+        s += 2;
+  80121a:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  80121e:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  801223:	eb d6                	jmp    8011fb <strtol+0x48>
+            dig -= '0';
+  801225:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  801228:	44 0f b6 c1          	movzbl %cl,%r8d
+  80122c:	41 39 d0             	cmp    %edx,%r8d
+  80122f:	7d 21                	jge    801252 <strtol+0x9f>
+        val = val * base + dig;
+  801231:	49 0f af c1          	imul   %r9,%rax
+  801235:	0f b6 c9             	movzbl %cl,%ecx
+  801238:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  80123b:	48 83 c7 01          	add    $0x1,%rdi
+  80123f:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  801243:	80 f9 39             	cmp    $0x39,%cl
+  801246:	76 dd                	jbe    801225 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  801248:	80 f9 7b             	cmp    $0x7b,%cl
+  80124b:	77 05                	ja     801252 <strtol+0x9f>
+            dig -= 'a' - 10;
+  80124d:	83 e9 57             	sub    $0x57,%ecx
+  801250:	eb d6                	jmp    801228 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  801252:	4d 85 d2             	test   %r10,%r10
+  801255:	74 03                	je     80125a <strtol+0xa7>
+  801257:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  80125a:	48 89 c2             	mov    %rax,%rdx
+  80125d:	48 f7 da             	neg    %rdx
+  801260:	40 80 fe 2d          	cmp    $0x2d,%sil
+  801264:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  801268:	c3                   	ret
+
+0000000000801269 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  801269:	55                   	push   %rbp
+  80126a:	48 89 e5             	mov    %rsp,%rbp
+  80126d:	53                   	push   %rbx
+  80126e:	48 89 fa             	mov    %rdi,%rdx
+  801271:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801274:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801279:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80127e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801283:	be 00 00 00 00       	mov    $0x0,%esi
+  801288:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80128e:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  801290:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801294:	c9                   	leave
+  801295:	c3                   	ret
+
+0000000000801296 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  801296:	55                   	push   %rbp
+  801297:	48 89 e5             	mov    %rsp,%rbp
+  80129a:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80129b:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8012a0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012a5:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8012aa:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012af:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012b4:	be 00 00 00 00       	mov    $0x0,%esi
+  8012b9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8012bf:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  8012c1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012c5:	c9                   	leave
+  8012c6:	c3                   	ret
+
+00000000008012c7 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  8012c7:	55                   	push   %rbp
+  8012c8:	48 89 e5             	mov    %rsp,%rbp
+  8012cb:	53                   	push   %rbx
+  8012cc:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  8012d0:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8012d3:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8012d8:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8012dd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012e2:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012e7:	be 00 00 00 00       	mov    $0x0,%esi
+  8012ec:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8012f2:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8012f4:	48 85 c0             	test   %rax,%rax
+  8012f7:	7f 06                	jg     8012ff <sys_env_destroy+0x38>
+}
+  8012f9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012fd:	c9                   	leave
+  8012fe:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8012ff:	49 89 c0             	mov    %rax,%r8
+  801302:	b9 03 00 00 00       	mov    $0x3,%ecx
+  801307:	48 ba 90 37 80 00 00 	movabs $0x803790,%rdx
+  80130e:	00 00 00 
+  801311:	be 26 00 00 00       	mov    $0x26,%esi
+  801316:	48 bf af 37 80 00 00 	movabs $0x8037af,%rdi
+  80131d:	00 00 00 
+  801320:	b8 00 00 00 00       	mov    $0x0,%eax
+  801325:	49 b9 cd 03 80 00 00 	movabs $0x8003cd,%r9
+  80132c:	00 00 00 
+  80132f:	41 ff d1             	call   *%r9
+
+0000000000801332 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  801332:	55                   	push   %rbp
+  801333:	48 89 e5             	mov    %rsp,%rbp
+  801336:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801337:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80133c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801341:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801346:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80134b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801350:	be 00 00 00 00       	mov    $0x0,%esi
+  801355:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80135b:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  80135d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801361:	c9                   	leave
+  801362:	c3                   	ret
+
+0000000000801363 <sys_yield>:
+
+void
+sys_yield(void) {
+  801363:	55                   	push   %rbp
+  801364:	48 89 e5             	mov    %rsp,%rbp
+  801367:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801368:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80136d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801372:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801377:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80137c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801381:	be 00 00 00 00       	mov    $0x0,%esi
+  801386:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80138c:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  80138e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801392:	c9                   	leave
+  801393:	c3                   	ret
+
+0000000000801394 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  801394:	55                   	push   %rbp
+  801395:	48 89 e5             	mov    %rsp,%rbp
+  801398:	53                   	push   %rbx
+  801399:	48 89 fa             	mov    %rdi,%rdx
+  80139c:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80139f:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8013a4:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  8013ab:	00 00 00 
+  8013ae:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013b3:	be 00 00 00 00       	mov    $0x0,%esi
+  8013b8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013be:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  8013c0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013c4:	c9                   	leave
+  8013c5:	c3                   	ret
+
+00000000008013c6 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  8013c6:	55                   	push   %rbp
+  8013c7:	48 89 e5             	mov    %rsp,%rbp
+  8013ca:	53                   	push   %rbx
+  8013cb:	49 89 f8             	mov    %rdi,%r8
+  8013ce:	48 89 d3             	mov    %rdx,%rbx
+  8013d1:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8013d4:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8013d9:	4c 89 c2             	mov    %r8,%rdx
+  8013dc:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013df:	be 00 00 00 00       	mov    $0x0,%esi
+  8013e4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013ea:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  8013ec:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013f0:	c9                   	leave
+  8013f1:	c3                   	ret
+
+00000000008013f2 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  8013f2:	55                   	push   %rbp
+  8013f3:	48 89 e5             	mov    %rsp,%rbp
+  8013f6:	53                   	push   %rbx
+  8013f7:	48 83 ec 08          	sub    $0x8,%rsp
+  8013fb:	89 f8                	mov    %edi,%eax
+  8013fd:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  801400:	48 63 f9             	movslq %ecx,%rdi
+  801403:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801406:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80140b:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80140e:	be 00 00 00 00       	mov    $0x0,%esi
+  801413:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801419:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80141b:	48 85 c0             	test   %rax,%rax
+  80141e:	7f 06                	jg     801426 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  801420:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801424:	c9                   	leave
+  801425:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801426:	49 89 c0             	mov    %rax,%r8
+  801429:	b9 04 00 00 00       	mov    $0x4,%ecx
+  80142e:	48 ba 90 37 80 00 00 	movabs $0x803790,%rdx
+  801435:	00 00 00 
+  801438:	be 26 00 00 00       	mov    $0x26,%esi
+  80143d:	48 bf af 37 80 00 00 	movabs $0x8037af,%rdi
+  801444:	00 00 00 
+  801447:	b8 00 00 00 00       	mov    $0x0,%eax
+  80144c:	49 b9 cd 03 80 00 00 	movabs $0x8003cd,%r9
+  801453:	00 00 00 
+  801456:	41 ff d1             	call   *%r9
+
+0000000000801459 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801459:	55                   	push   %rbp
+  80145a:	48 89 e5             	mov    %rsp,%rbp
+  80145d:	53                   	push   %rbx
+  80145e:	48 83 ec 08          	sub    $0x8,%rsp
+  801462:	89 f8                	mov    %edi,%eax
+  801464:	49 89 f2             	mov    %rsi,%r10
+  801467:	48 89 cf             	mov    %rcx,%rdi
+  80146a:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  80146d:	48 63 da             	movslq %edx,%rbx
+  801470:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801473:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801478:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80147b:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  80147e:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801480:	48 85 c0             	test   %rax,%rax
+  801483:	7f 06                	jg     80148b <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  801485:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801489:	c9                   	leave
+  80148a:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80148b:	49 89 c0             	mov    %rax,%r8
+  80148e:	b9 05 00 00 00       	mov    $0x5,%ecx
+  801493:	48 ba 90 37 80 00 00 	movabs $0x803790,%rdx
+  80149a:	00 00 00 
+  80149d:	be 26 00 00 00       	mov    $0x26,%esi
+  8014a2:	48 bf af 37 80 00 00 	movabs $0x8037af,%rdi
+  8014a9:	00 00 00 
+  8014ac:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014b1:	49 b9 cd 03 80 00 00 	movabs $0x8003cd,%r9
+  8014b8:	00 00 00 
+  8014bb:	41 ff d1             	call   *%r9
+
+00000000008014be <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  8014be:	55                   	push   %rbp
+  8014bf:	48 89 e5             	mov    %rsp,%rbp
+  8014c2:	53                   	push   %rbx
+  8014c3:	48 83 ec 08          	sub    $0x8,%rsp
+  8014c7:	48 89 f1             	mov    %rsi,%rcx
+  8014ca:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  8014cd:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8014d0:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8014d5:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014da:	be 00 00 00 00       	mov    $0x0,%esi
+  8014df:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014e5:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8014e7:	48 85 c0             	test   %rax,%rax
+  8014ea:	7f 06                	jg     8014f2 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  8014ec:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014f0:	c9                   	leave
+  8014f1:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8014f2:	49 89 c0             	mov    %rax,%r8
+  8014f5:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8014fa:	48 ba 90 37 80 00 00 	movabs $0x803790,%rdx
+  801501:	00 00 00 
+  801504:	be 26 00 00 00       	mov    $0x26,%esi
+  801509:	48 bf af 37 80 00 00 	movabs $0x8037af,%rdi
+  801510:	00 00 00 
+  801513:	b8 00 00 00 00       	mov    $0x0,%eax
+  801518:	49 b9 cd 03 80 00 00 	movabs $0x8003cd,%r9
+  80151f:	00 00 00 
+  801522:	41 ff d1             	call   *%r9
+
+0000000000801525 <sys_region_batch>:
+
+int
+sys_region_batch(const struct RegionOp *ops, size_t count) {
+  801525:	55                   	push   %rbp
+  801526:	48 89 e5             	mov    %rsp,%rbp
+  801529:	53                   	push   %rbx
+  80152a:	48 83 ec 08          	sub    $0x8,%rsp
+  80152e:	48 89 fa             	mov    %rdi,%rdx
+  801531:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801534:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801539:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80153e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801543:	be 00 00 00 00       	mov    $0x0,%esi
+  801548:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80154e:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801550:	48 85 c0             	test   %rax,%rax
+  801553:	7f 06                	jg     80155b <sys_region_batch+0x36>
+        else
+            platform_asan_unpoison(va, ops[i].size);
+    }
+#endif
+    return res;
+}
+  801555:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801559:	c9                   	leave
+  80155a:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80155b:	49 89 c0             	mov    %rax,%r8
+  80155e:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  801563:	48 ba 90 37 80 00 00 	movabs $0x803790,%rdx
+  80156a:	00 00 00 
+  80156d:	be 26 00 00 00       	mov    $0x26,%esi
+  801572:	48 bf af 37 80 00 00 	movabs $0x8037af,%rdi
+  801579:	00 00 00 
+  80157c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801581:	49 b9 cd 03 80 00 00 	movabs $0x8003cd,%r9
+  801588:	00 00 00 
+  80158b:	41 ff d1             	call   *%r9
+
+000000000080158e <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  80158e:	55                   	push   %rbp
+  80158f:	48 89 e5             	mov    %rsp,%rbp
+  801592:	53                   	push   %rbx
+  801593:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  801597:	48 63 ce             	movslq %esi,%rcx
+  80159a:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80159d:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8015a2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015a7:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015ac:	be 00 00 00 00       	mov    $0x0,%esi
+  8015b1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015b7:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8015b9:	48 85 c0             	test   %rax,%rax
+  8015bc:	7f 06                	jg     8015c4 <sys_env_set_status+0x36>
+}
+  8015be:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015c2:	c9                   	leave
+  8015c3:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8015c4:	49 89 c0             	mov    %rax,%r8
+  8015c7:	b9 09 00 00 00       	mov    $0x9,%ecx
+  8015cc:	48 ba 90 37 80 00 00 	movabs $0x803790,%rdx
+  8015d3:	00 00 00 
+  8015d6:	be 26 00 00 00       	mov    $0x26,%esi
+  8015db:	48 bf af 37 80 00 00 	movabs $0x8037af,%rdi
+  8015e2:	00 00 00 
+  8015e5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015ea:	49 b9 cd 03 80 00 00 	movabs $0x8003cd,%r9
+  8015f1:	00 00 00 
+  8015f4:	41 ff d1             	call   *%r9
+
+00000000008015f7 <sys_env_set_weight>:
+
+int
+sys_env_set_weight(envid_t envid, uint32_t weight) {
+  8015f7:	55                   	push   %rbp
+  8015f8:	48 89 e5             	mov    %rsp,%rbp
+  8015fb:	53                   	push   %rbx
+  8015fc:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_weight, 1, envid, weight, 0, 0, 0, 0);
+  801600:	89 f1                	mov    %esi,%ecx
+  801602:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801605:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80160a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80160f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801614:	be 00 00 00 00       	mov    $0x0,%esi
+  801619:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80161f:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801621:	48 85 c0             	test   %rax,%rax
+  801624:	7f 06                	jg     80162c <sys_env_set_weight+0x35>
+}
+  801626:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80162a:	c9                   	leave
+  80162b:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80162c:	49 89 c0             	mov    %rax,%r8
+  80162f:	b9 10 00 00 00       	mov    $0x10,%ecx
+  801634:	48 ba 90 37 80 00 00 	movabs $0x803790,%rdx
+  80163b:	00 00 00 
+  80163e:	be 26 00 00 00       	mov    $0x26,%esi
+  801643:	48 bf af 37 80 00 00 	movabs $0x8037af,%rdi
+  80164a:	00 00 00 
+  80164d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801652:	49 b9 cd 03 80 00 00 	movabs $0x8003cd,%r9
+  801659:	00 00 00 
+  80165c:	41 ff d1             	call   *%r9
+
+000000000080165f <sys_env_set_rt>:
+
+int
+sys_env_set_rt(envid_t envid, uint64_t period, uint64_t budget, uint64_t deadline) {
+  80165f:	55                   	push   %rbp
+  801660:	48 89 e5             	mov    %rsp,%rbp
+  801663:	53                   	push   %rbx
+  801664:	48 83 ec 08          	sub    $0x8,%rsp
+  801668:	89 f8                	mov    %edi,%eax
+  80166a:	48 89 d3             	mov    %rdx,%rbx
+  80166d:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_env_set_rt, 1, envid, period, budget, deadline, 0, 0);
+  801670:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801673:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801678:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80167b:	be 00 00 00 00       	mov    $0x0,%esi
+  801680:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801686:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801688:	48 85 c0             	test   %rax,%rax
+  80168b:	7f 06                	jg     801693 <sys_env_set_rt+0x34>
+}
+  80168d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801691:	c9                   	leave
+  801692:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801693:	49 89 c0             	mov    %rax,%r8
+  801696:	b9 11 00 00 00       	mov    $0x11,%ecx
+  80169b:	48 ba 90 37 80 00 00 	movabs $0x803790,%rdx
+  8016a2:	00 00 00 
+  8016a5:	be 26 00 00 00       	mov    $0x26,%esi
+  8016aa:	48 bf af 37 80 00 00 	movabs $0x8037af,%rdi
+  8016b1:	00 00 00 
+  8016b4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016b9:	49 b9 cd 03 80 00 00 	movabs $0x8003cd,%r9
+  8016c0:	00 00 00 
+  8016c3:	41 ff d1             	call   *%r9
+
+00000000008016c6 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  8016c6:	55                   	push   %rbp
+  8016c7:	48 89 e5             	mov    %rsp,%rbp
+  8016ca:	53                   	push   %rbx
+  8016cb:	48 83 ec 08          	sub    $0x8,%rsp
+  8016cf:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  8016d2:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8016d5:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8016da:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016df:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8016e4:	be 00 00 00 00       	mov    $0x0,%esi
+  8016e9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8016ef:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8016f1:	48 85 c0             	test   %rax,%rax
+  8016f4:	7f 06                	jg     8016fc <sys_env_set_trapframe+0x36>
+}
+  8016f6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8016fa:	c9                   	leave
+  8016fb:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8016fc:	49 89 c0             	mov    %rax,%r8
+  8016ff:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  801704:	48 ba 90 37 80 00 00 	movabs $0x803790,%rdx
+  80170b:	00 00 00 
+  80170e:	be 26 00 00 00       	mov    $0x26,%esi
+  801713:	48 bf af 37 80 00 00 	movabs $0x8037af,%rdi
+  80171a:	00 00 00 
+  80171d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801722:	49 b9 cd 03 80 00 00 	movabs $0x8003cd,%r9
+  801729:	00 00 00 
+  80172c:	41 ff d1             	call   *%r9
+
+000000000080172f <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  80172f:	55                   	push   %rbp
+  801730:	48 89 e5             	mov    %rsp,%rbp
+  801733:	53                   	push   %rbx
+  801734:	48 83 ec 08          	sub    $0x8,%rsp
+  801738:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  80173b:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80173e:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801743:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801748:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80174d:	be 00 00 00 00       	mov    $0x0,%esi
+  801752:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801758:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80175a:	48 85 c0             	test   %rax,%rax
+  80175d:	7f 06                	jg     801765 <sys_env_set_pgfault_upcall+0x36>
+}
+  80175f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801763:	c9                   	leave
+  801764:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801765:	49 89 c0             	mov    %rax,%r8
+  801768:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  80176d:	48 ba 90 37 80 00 00 	movabs $0x803790,%rdx
+  801774:	00 00 00 
+  801777:	be 26 00 00 00       	mov    $0x26,%esi
+  80177c:	48 bf af 37 80 00 00 	movabs $0x8037af,%rdi
+  801783:	00 00 00 
+  801786:	b8 00 00 00 00       	mov    $0x0,%eax
+  80178b:	49 b9 cd 03 80 00 00 	movabs $0x8003cd,%r9
+  801792:	00 00 00 
+  801795:	41 ff d1             	call   *%r9
+
+0000000000801798 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  801798:	55                   	push   %rbp
+  801799:	48 89 e5             	mov    %rsp,%rbp
+  80179c:	53                   	push   %rbx
+  80179d:	89 f8                	mov    %edi,%eax
+  80179f:	49 89 f1             	mov    %rsi,%r9
+  8017a2:	48 89 d3             	mov    %rdx,%rbx
+  8017a5:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  8017a8:	49 63 f0             	movslq %r8d,%rsi
+  8017ab:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8017ae:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8017b3:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8017b6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8017bc:	cd 30                	int    $0x30
+}
+  8017be:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8017c2:	c9                   	leave
+  8017c3:	c3                   	ret
+
+00000000008017c4 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  8017c4:	55                   	push   %rbp
+  8017c5:	48 89 e5             	mov    %rsp,%rbp
+  8017c8:	53                   	push   %rbx
+  8017c9:	48 83 ec 08          	sub    $0x8,%rsp
+  8017cd:	48 89 fa             	mov    %rdi,%rdx
+  8017d0:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8017d3:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8017d8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017dd:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8017e2:	be 00 00 00 00       	mov    $0x0,%esi
+  8017e7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8017ed:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8017ef:	48 85 c0             	test   %rax,%rax
+  8017f2:	7f 06                	jg     8017fa <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8017f4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8017f8:	c9                   	leave
+  8017f9:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8017fa:	49 89 c0             	mov    %rax,%r8
+  8017fd:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  801802:	48 ba 90 37 80 00 00 	movabs $0x803790,%rdx
+  801809:	00 00 00 
+  80180c:	be 26 00 00 00       	mov    $0x26,%esi
+  801811:	48 bf af 37 80 00 00 	movabs $0x8037af,%rdi
+  801818:	00 00 00 
+  80181b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801820:	49 b9 cd 03 80 00 00 	movabs $0x8003cd,%r9
+  801827:	00 00 00 
+  80182a:	41 ff d1             	call   *%r9
+
+000000000080182d <fork>:
+ * Hint:
+ *   Use sys_map_region, it can perform address space copying in one call
+ *   Remember to fix "thisenv" in the child process.
+ */
+envid_t
+fork(void) {
+  80182d:	55                   	push   %rbp
+  80182e:	48 89 e5             	mov    %rsp,%rbp
+  801831:	41 55                	push   %r13
+  801833:	41 54                	push   %r12
+  801835:	53                   	push   %rbx
+  801836:	48 83 ec 08          	sub    $0x8,%rsp
+
+/* This must be inlined. Exercise for reader: why? */
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+    envid_t ret;
+    asm volatile("int %2"
+  80183a:	b8 08 00 00 00       	mov    $0x8,%eax
+  80183f:	cd 30                	int    $0x30
+  801841:	41 89 c5             	mov    %eax,%r13d
+    // LAB 9: Your code here
+
+    envid_t child_id = sys_exofork();
+    if (child_id < 0) {
+  801844:	85 c0                	test   %eax,%eax
+  801846:	0f 88 ae 00 00 00    	js     8018fa <fork+0xcd>
+  80184c:	89 c3                	mov    %eax,%ebx
+        return child_id;
+    }
+    if (child_id == 0) {
+  80184e:	0f 84 b4 00 00 00    	je     801908 <fork+0xdb>
+        thisenv = &envs[ENVX(sys_getenvid())];
+        return 0;
+    }
+    int res = sys_map_region(0, NULL, child_id, NULL, MAX_USER_ADDRESS, PROT_ALL | PROT_LAZY | PROT_COMBINE);
+  801854:	41 b9 df 01 00 00    	mov    $0x1df,%r9d
+  80185a:	49 b8 00 00 00 00 80 	movabs $0x8000000000,%r8
+  801861:	00 00 00 
+  801864:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801869:	89 c2                	mov    %eax,%edx
+  80186b:	be 00 00 00 00       	mov    $0x0,%esi
+  801870:	bf 00 00 00 00       	mov    $0x0,%edi
+  801875:	48 b8 59 14 80 00 00 	movabs $0x801459,%rax
+  80187c:	00 00 00 
+  80187f:	ff d0                	call   *%rax
+  801881:	41 89 c4             	mov    %eax,%r12d
+    if (res < 0) {
+  801884:	85 c0                	test   %eax,%eax
+  801886:	78 5d                	js     8018e5 <fork+0xb8>
+        goto error;
+    }
+    res = sys_env_set_pgfault_upcall(child_id, envs[ENVX(sys_getenvid())].env_pgfault_upcall);
+  801888:	48 b8 32 13 80 00 00 	movabs $0x801332,%rax
+  80188f:	00 00 00 
+  801892:	ff d0                	call   *%rax
+  801894:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801899:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+  8018a0:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8018a7:	00 00 00 
+  8018aa:	48 01 d0             	add    %rdx,%rax
+  8018ad:	48 8b b0 88 01 00 00 	mov    0x188(%rax),%rsi
+  8018b4:	44 89 ef             	mov    %r13d,%edi
+  8018b7:	48 b8 2f 17 80 00 00 	movabs $0x80172f,%rax
+  8018be:	00 00 00 
+  8018c1:	ff d0                	call   *%rax
+  8018c3:	41 89 c4             	mov    %eax,%r12d
+    if (res < 0) {
+  8018c6:	85 c0                	test   %eax,%eax
+  8018c8:	78 1b                	js     8018e5 <fork+0xb8>
+        goto error;
+    }
+    res = sys_env_set_status(child_id, ENV_RUNNABLE);
+  8018ca:	be 02 00 00 00       	mov    $0x2,%esi
+  8018cf:	44 89 ef             	mov    %r13d,%edi
+  8018d2:	48 b8 8e 15 80 00 00 	movabs $0x80158e,%rax
+  8018d9:	00 00 00 
+  8018dc:	ff d0                	call   *%rax
+  8018de:	41 89 c4             	mov    %eax,%r12d
+    if (res < 0) {
+  8018e1:	85 c0                	test   %eax,%eax
+  8018e3:	79 15                	jns    8018fa <fork+0xcd>
+        goto error;
+    }
+    return child_id;
+error:
+    ;
+    int res2 = sys_env_destroy(child_id);
+  8018e5:	89 df                	mov    %ebx,%edi
+  8018e7:	48 b8 c7 12 80 00 00 	movabs $0x8012c7,%rax
+  8018ee:	00 00 00 
+  8018f1:	ff d0                	call   *%rax
+    if (res2 < 0) {
+  8018f3:	85 c0                	test   %eax,%eax
+  8018f5:	78 42                	js     801939 <fork+0x10c>
+        panic("Fork double fault");
+    }
+    return res;
+  8018f7:	45 89 e5             	mov    %r12d,%r13d
+}
+  8018fa:	44 89 e8             	mov    %r13d,%eax
+  8018fd:	48 83 c4 08          	add    $0x8,%rsp
+  801901:	5b                   	pop    %rbx
+  801902:	41 5c                	pop    %r12
+  801904:	41 5d                	pop    %r13
+  801906:	5d                   	pop    %rbp
+  801907:	c3                   	ret
+        thisenv = &envs[ENVX(sys_getenvid())];
+  801908:	48 b8 32 13 80 00 00 	movabs $0x801332,%rax
+  80190f:	00 00 00 
+  801912:	ff d0                	call   *%rax
+  801914:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801919:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+  801920:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  801927:	00 00 00 
+  80192a:	48 01 d0             	add    %rdx,%rax
+  80192d:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  801934:	00 00 00 
+        return 0;
+  801937:	eb c1                	jmp    8018fa <fork+0xcd>
+        panic("Fork double fault");
+  801939:	48 ba bd 37 80 00 00 	movabs $0x8037bd,%rdx
+  801940:	00 00 00 
+  801943:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801948:	48 bf cf 37 80 00 00 	movabs $0x8037cf,%rdi
+  80194f:	00 00 00 
+  801952:	b8 00 00 00 00       	mov    $0x0,%eax
+  801957:	48 b9 cd 03 80 00 00 	movabs $0x8003cd,%rcx
+  80195e:	00 00 00 
+  801961:	ff d1                	call   *%rcx
+
+0000000000801963 <sfork>:
+
+envid_t
+sfork() {
+  801963:	55                   	push   %rbp
+  801964:	48 89 e5             	mov    %rsp,%rbp
+    panic("sfork() is not implemented");
+  801967:	48 ba da 37 80 00 00 	movabs $0x8037da,%rdx
+  80196e:	00 00 00 
+  801971:	be 36 00 00 00       	mov    $0x36,%esi
+  801976:	48 bf cf 37 80 00 00 	movabs $0x8037cf,%rdi
+  80197d:	00 00 00 
+  801980:	b8 00 00 00 00       	mov    $0x0,%eax
+  801985:	48 b9 cd 03 80 00 00 	movabs $0x8003cd,%rcx
+  80198c:	00 00 00 
+  80198f:	ff d1                	call   *%rcx
+
+0000000000801991 <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  801991:	55                   	push   %rbp
+  801992:	48 89 e5             	mov    %rsp,%rbp
+  801995:	41 55                	push   %r13
+  801997:	41 54                	push   %r12
+  801999:	53                   	push   %rbx
+  80199a:	48 83 ec 08          	sub    $0x8,%rsp
+  80199e:	49 89 fc             	mov    %rdi,%r12
+  8019a1:	48 89 f7             	mov    %rsi,%rdi
+  8019a4:	48 89 d3             	mov    %rdx,%rbx
+  8019a7:	49 89 cd             	mov    %rcx,%r13
+    // LAB 9: Your code here:
+    int res = sys_ipc_recv(!pg ? (void*)MAX_USER_ADDRESS : pg, !size ? 0 : *size);
+  8019aa:	be 00 00 00 00       	mov    $0x0,%esi
+  8019af:	48 85 d2             	test   %rdx,%rdx
+  8019b2:	74 03                	je     8019b7 <ipc_recv+0x26>
+  8019b4:	48 8b 32             	mov    (%rdx),%rsi
+  8019b7:	48 85 ff             	test   %rdi,%rdi
+  8019ba:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8019c1:	00 00 00 
+  8019c4:	48 0f 44 f8          	cmove  %rax,%rdi
+  8019c8:	48 b8 c4 17 80 00 00 	movabs $0x8017c4,%rax
+  8019cf:	00 00 00 
+  8019d2:	ff d0                	call   *%rax
+    if (res < 0) {
+  8019d4:	85 c0                	test   %eax,%eax
+  8019d6:	78 66                	js     801a3e <ipc_recv+0xad>
+        if (size) {
+            *size = 0;
+        }
+        return res;
+    }
+    if (from_env_store) {
+  8019d8:	4d 85 e4             	test   %r12,%r12
+  8019db:	74 14                	je     8019f1 <ipc_recv+0x60>
+        *from_env_store = thisenv->env_ipc_from;
+  8019dd:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  8019e4:	00 00 00 
+  8019e7:	8b 80 ac 01 00 00    	mov    0x1ac(%rax),%eax
+  8019ed:	41 89 04 24          	mov    %eax,(%r12)
+    }
+    if (perm_store) {
+  8019f1:	4d 85 ed             	test   %r13,%r13
+  8019f4:	74 14                	je     801a0a <ipc_recv+0x79>
+        *perm_store = thisenv->env_ipc_perm;
+  8019f6:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  8019fd:	00 00 00 
+  801a00:	8b 80 b0 01 00 00    	mov    0x1b0(%rax),%eax
+  801a06:	41 89 45 00          	mov    %eax,0x0(%r13)
+    }
+    if (size) {
+  801a0a:	48 85 db             	test   %rbx,%rbx
+  801a0d:	74 14                	je     801a23 <ipc_recv+0x92>
+        *size = thisenv->env_ipc_maxsz;
+  801a0f:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801a16:	00 00 00 
+  801a19:	48 8b 80 a0 01 00 00 	mov    0x1a0(%rax),%rax
+  801a20:	48 89 03             	mov    %rax,(%rbx)
+    }
+    return thisenv->env_ipc_value;
+  801a23:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801a2a:	00 00 00 
+  801a2d:	8b 80 a8 01 00 00    	mov    0x1a8(%rax),%eax
+}
+  801a33:	48 83 c4 08          	add    $0x8,%rsp
+  801a37:	5b                   	pop    %rbx
+  801a38:	41 5c                	pop    %r12
+  801a3a:	41 5d                	pop    %r13
+  801a3c:	5d                   	pop    %rbp
+  801a3d:	c3                   	ret
+        if (from_env_store) {
+  801a3e:	4d 85 e4             	test   %r12,%r12
+  801a41:	74 08                	je     801a4b <ipc_recv+0xba>
+            *from_env_store = 0;
+  801a43:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  801a4a:	00 
+        if (perm_store) {
+  801a4b:	4d 85 ed             	test   %r13,%r13
+  801a4e:	74 08                	je     801a58 <ipc_recv+0xc7>
+            *perm_store = 0;
+  801a50:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  801a57:	00 
+        if (size) {
+  801a58:	48 85 db             	test   %rbx,%rbx
+  801a5b:	74 d6                	je     801a33 <ipc_recv+0xa2>
+            *size = 0;
+  801a5d:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  801a64:	eb cd                	jmp    801a33 <ipc_recv+0xa2>
+
+0000000000801a66 <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  801a66:	55                   	push   %rbp
+  801a67:	48 89 e5             	mov    %rsp,%rbp
+  801a6a:	41 57                	push   %r15
+  801a6c:	41 56                	push   %r14
+  801a6e:	41 55                	push   %r13
+  801a70:	41 54                	push   %r12
+  801a72:	53                   	push   %rbx
+  801a73:	48 83 ec 18          	sub    $0x18,%rsp
+  801a77:	41 89 fd             	mov    %edi,%r13d
+  801a7a:	89 75 cc             	mov    %esi,-0x34(%rbp)
+  801a7d:	49 89 cc             	mov    %rcx,%r12
+  801a80:	44 89 45 c8          	mov    %r8d,-0x38(%rbp)
+    // LAB 9: Your code here:
+    int res = 0;
+    while ((res = sys_ipc_try_send(to_env, val, !pg ? (void*)MAX_USER_ADDRESS : pg, size, perm)) < 0) {
+  801a84:	48 85 d2             	test   %rdx,%rdx
+  801a87:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  801a8e:	00 00 00 
+  801a91:	48 0f 45 c2          	cmovne %rdx,%rax
+  801a95:	48 89 c3             	mov    %rax,%rbx
+  801a98:	49 be 98 17 80 00 00 	movabs $0x801798,%r14
+  801a9f:	00 00 00 
+        if (res != -E_IPC_NOT_RECV) {
+            panic("sys_ipc_try_send failed: %i", res);
+        }
+        sys_yield();
+  801aa2:	49 bf 63 13 80 00 00 	movabs $0x801363,%r15
+  801aa9:	00 00 00 
+    while ((res = sys_ipc_try_send(to_env, val, !pg ? (void*)MAX_USER_ADDRESS : pg, size, perm)) < 0) {
+  801aac:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  801aaf:	44 8b 45 c8          	mov    -0x38(%rbp),%r8d
+  801ab3:	4c 89 e1             	mov    %r12,%rcx
+  801ab6:	48 89 da             	mov    %rbx,%rdx
+  801ab9:	44 89 ef             	mov    %r13d,%edi
+  801abc:	41 ff d6             	call   *%r14
+  801abf:	85 c0                	test   %eax,%eax
+  801ac1:	79 37                	jns    801afa <ipc_send+0x94>
+        if (res != -E_IPC_NOT_RECV) {
+  801ac3:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  801ac6:	75 05                	jne    801acd <ipc_send+0x67>
+        sys_yield();
+  801ac8:	41 ff d7             	call   *%r15
+  801acb:	eb df                	jmp    801aac <ipc_send+0x46>
+            panic("sys_ipc_try_send failed: %i", res);
+  801acd:	89 c1                	mov    %eax,%ecx
+  801acf:	48 ba f5 37 80 00 00 	movabs $0x8037f5,%rdx
+  801ad6:	00 00 00 
+  801ad9:	be 40 00 00 00       	mov    $0x40,%esi
+  801ade:	48 bf 11 38 80 00 00 	movabs $0x803811,%rdi
+  801ae5:	00 00 00 
+  801ae8:	b8 00 00 00 00       	mov    $0x0,%eax
+  801aed:	49 b8 cd 03 80 00 00 	movabs $0x8003cd,%r8
+  801af4:	00 00 00 
+  801af7:	41 ff d0             	call   *%r8
+    }
+    return;
+}
+  801afa:	48 83 c4 18          	add    $0x18,%rsp
+  801afe:	5b                   	pop    %rbx
+  801aff:	41 5c                	pop    %r12
+  801b01:	41 5d                	pop    %r13
+  801b03:	41 5e                	pop    %r14
+  801b05:	41 5f                	pop    %r15
+  801b07:	5d                   	pop    %rbp
+  801b08:	c3                   	ret
+
+0000000000801b09 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  801b09:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  801b0e:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  801b15:	00 00 00 
+  801b18:	48 69 d0 d0 01 00 00 	imul   $0x1d0,%rax,%rdx
+  801b1f:	48 01 ca             	add    %rcx,%rdx
+  801b22:	8b 92 e8 00 00 00    	mov    0xe8(%rdx),%edx
+  801b28:	39 fa                	cmp    %edi,%edx
+  801b2a:	74 12                	je     801b3e <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  801b2c:	48 83 c0 01          	add    $0x1,%rax
+  801b30:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  801b36:	75 e0                	jne    801b18 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  801b38:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801b3d:	c3                   	ret
+            return envs[i].env_id;
+  801b3e:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+  801b45:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  801b4c:	00 00 00 
+  801b4f:	48 01 d0             	add    %rdx,%rax
+  801b52:	8b 80 e0 00 00 00    	mov    0xe0(%rax),%eax
+  801b58:	c3                   	ret
+
+0000000000801b59 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801b59:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801b60:	ff ff ff 
+  801b63:	48 01 f8             	add    %rdi,%rax
+  801b66:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  801b6a:	c3                   	ret
+
+0000000000801b6b <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801b6b:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801b72:	ff ff ff 
+  801b75:	48 01 f8             	add    %rdi,%rax
+  801b78:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  801b7c:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  801b82:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  801b86:	c3                   	ret
+
+0000000000801b87 <fd_alloc_from>:
+}
+
+/* Like fd_alloc(), but only considers fds starting from fdnum,
+ * so that several fds can be found before their pages are allocated */
+int
+fd_alloc_from(int fdnum, struct Fd **fd_store) {
+  801b87:	55                   	push   %rbp
+  801b88:	48 89 e5             	mov    %rsp,%rbp
+  801b8b:	41 57                	push   %r15
+  801b8d:	41 56                	push   %r14
+  801b8f:	41 55                	push   %r13
+  801b91:	41 54                	push   %r12
+  801b93:	53                   	push   %rbx
+  801b94:	48 83 ec 08          	sub    $0x8,%rsp
+  801b98:	49 89 f7             	mov    %rsi,%r15
+    for (int i = MAX(fdnum, 0); i < MAXFD; i++) {
+  801b9b:	85 ff                	test   %edi,%edi
+  801b9d:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  801ba3:	44 0f 49 e7          	cmovns %edi,%r12d
+  801ba7:	83 ff 1f             	cmp    $0x1f,%edi
+  801baa:	7f 37                	jg     801be3 <fd_alloc_from+0x5c>
+  801bac:	49 63 dc             	movslq %r12d,%rbx
+  801baf:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  801bb6:	48 c1 e3 0c          	shl    $0xc,%rbx
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  801bba:	49 be 49 2d 80 00 00 	movabs $0x802d49,%r14
+  801bc1:	00 00 00 
+        struct Fd *fd = INDEX2FD(i);
+  801bc4:	49 89 dd             	mov    %rbx,%r13
+        if (!(get_prot(fd) & PROT_R)) {
+  801bc7:	48 89 df             	mov    %rbx,%rdi
+  801bca:	41 ff d6             	call   *%r14
+  801bcd:	83 e0 04             	and    $0x4,%eax
+  801bd0:	74 1c                	je     801bee <fd_alloc_from+0x67>
+    for (int i = MAX(fdnum, 0); i < MAXFD; i++) {
+  801bd2:	41 83 c4 01          	add    $0x1,%r12d
+  801bd6:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801bdd:	41 83 fc 1f          	cmp    $0x1f,%r12d
+  801be1:	7e e1                	jle    801bc4 <fd_alloc_from+0x3d>
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  801be3:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801be9:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  801bee:	4d 89 2f             	mov    %r13,(%r15)
+}
+  801bf1:	48 83 c4 08          	add    $0x8,%rsp
+  801bf5:	5b                   	pop    %rbx
+  801bf6:	41 5c                	pop    %r12
+  801bf8:	41 5d                	pop    %r13
+  801bfa:	41 5e                	pop    %r14
+  801bfc:	41 5f                	pop    %r15
+  801bfe:	5d                   	pop    %rbp
+  801bff:	c3                   	ret
+
+0000000000801c00 <fd_alloc>:
+fd_alloc(struct Fd **fd_store) {
+  801c00:	55                   	push   %rbp
+  801c01:	48 89 e5             	mov    %rsp,%rbp
+  801c04:	48 89 fe             	mov    %rdi,%rsi
+    return fd_alloc_from(0, fd_store);
+  801c07:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c0c:	48 b8 87 1b 80 00 00 	movabs $0x801b87,%rax
+  801c13:	00 00 00 
+  801c16:	ff d0                	call   *%rax
+}
+  801c18:	5d                   	pop    %rbp
+  801c19:	c3                   	ret
+
+0000000000801c1a <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  801c1a:	83 ff 1f             	cmp    $0x1f,%edi
+  801c1d:	77 39                	ja     801c58 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  801c1f:	55                   	push   %rbp
+  801c20:	48 89 e5             	mov    %rsp,%rbp
+  801c23:	41 54                	push   %r12
+  801c25:	53                   	push   %rbx
+  801c26:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  801c29:	48 63 df             	movslq %edi,%rbx
+  801c2c:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  801c33:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  801c37:	48 89 df             	mov    %rbx,%rdi
+  801c3a:	48 b8 49 2d 80 00 00 	movabs $0x802d49,%rax
+  801c41:	00 00 00 
+  801c44:	ff d0                	call   *%rax
+  801c46:	a8 04                	test   $0x4,%al
+  801c48:	74 14                	je     801c5e <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  801c4a:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  801c4e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801c53:	5b                   	pop    %rbx
+  801c54:	41 5c                	pop    %r12
+  801c56:	5d                   	pop    %rbp
+  801c57:	c3                   	ret
+        return -E_INVAL;
+  801c58:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801c5d:	c3                   	ret
+        return -E_INVAL;
+  801c5e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801c63:	eb ee                	jmp    801c53 <fd_lookup+0x39>
+
+0000000000801c65 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  801c65:	55                   	push   %rbp
+  801c66:	48 89 e5             	mov    %rsp,%rbp
+  801c69:	41 54                	push   %r12
+  801c6b:	53                   	push   %rbx
+  801c6c:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  801c6f:	48 b8 a0 38 80 00 00 	movabs $0x8038a0,%rax
+  801c76:	00 00 00 
+  801c79:	48 bb 20 40 80 00 00 	movabs $0x804020,%rbx
+  801c80:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  801c83:	39 3b                	cmp    %edi,(%rbx)
+  801c85:	74 47                	je     801cce <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  801c87:	48 83 c0 08          	add    $0x8,%rax
+  801c8b:	48 8b 18             	mov    (%rax),%rbx
+  801c8e:	48 85 db             	test   %rbx,%rbx
+  801c91:	75 f0                	jne    801c83 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801c93:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801c9a:	00 00 00 
+  801c9d:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+  801ca3:	89 fa                	mov    %edi,%edx
+  801ca5:	48 bf 20 38 80 00 00 	movabs $0x803820,%rdi
+  801cac:	00 00 00 
+  801caf:	b8 00 00 00 00       	mov    $0x0,%eax
+  801cb4:	48 b9 1d 05 80 00 00 	movabs $0x80051d,%rcx
+  801cbb:	00 00 00 
+  801cbe:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  801cc0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  801cc5:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  801cc9:	5b                   	pop    %rbx
+  801cca:	41 5c                	pop    %r12
+  801ccc:	5d                   	pop    %rbp
+  801ccd:	c3                   	ret
+            return 0;
+  801cce:	b8 00 00 00 00       	mov    $0x0,%eax
+  801cd3:	eb f0                	jmp    801cc5 <dev_lookup+0x60>
+
+0000000000801cd5 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  801cd5:	55                   	push   %rbp
+  801cd6:	48 89 e5             	mov    %rsp,%rbp
+  801cd9:	41 55                	push   %r13
+  801cdb:	41 54                	push   %r12
+  801cdd:	53                   	push   %rbx
+  801cde:	48 83 ec 18          	sub    $0x18,%rsp
+  801ce2:	48 89 fb             	mov    %rdi,%rbx
+  801ce5:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801ce8:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  801cef:	ff ff ff 
+  801cf2:	48 01 df             	add    %rbx,%rdi
+  801cf5:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  801cf9:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801cfd:	48 b8 1a 1c 80 00 00 	movabs $0x801c1a,%rax
+  801d04:	00 00 00 
+  801d07:	ff d0                	call   *%rax
+  801d09:	41 89 c5             	mov    %eax,%r13d
+  801d0c:	85 c0                	test   %eax,%eax
+  801d0e:	78 06                	js     801d16 <fd_close+0x41>
+  801d10:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  801d14:	74 1a                	je     801d30 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  801d16:	45 84 e4             	test   %r12b,%r12b
+  801d19:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d1e:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  801d22:	44 89 e8             	mov    %r13d,%eax
+  801d25:	48 83 c4 18          	add    $0x18,%rsp
+  801d29:	5b                   	pop    %rbx
+  801d2a:	41 5c                	pop    %r12
+  801d2c:	41 5d                	pop    %r13
+  801d2e:	5d                   	pop    %rbp
+  801d2f:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801d30:	8b 3b                	mov    (%rbx),%edi
+  801d32:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801d36:	48 b8 65 1c 80 00 00 	movabs $0x801c65,%rax
+  801d3d:	00 00 00 
+  801d40:	ff d0                	call   *%rax
+  801d42:	41 89 c5             	mov    %eax,%r13d
+  801d45:	85 c0                	test   %eax,%eax
+  801d47:	78 1b                	js     801d64 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  801d49:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801d4d:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801d51:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801d57:	48 85 c0             	test   %rax,%rax
+  801d5a:	74 08                	je     801d64 <fd_close+0x8f>
+  801d5c:	48 89 df             	mov    %rbx,%rdi
+  801d5f:	ff d0                	call   *%rax
+  801d61:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801d64:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801d69:	48 89 de             	mov    %rbx,%rsi
+  801d6c:	bf 00 00 00 00       	mov    $0x0,%edi
+  801d71:	48 b8 be 14 80 00 00 	movabs $0x8014be,%rax
+  801d78:	00 00 00 
+  801d7b:	ff d0                	call   *%rax
+    return res;
+  801d7d:	eb a3                	jmp    801d22 <fd_close+0x4d>
+
+0000000000801d7f <close>:
+
+int
+close(int fdnum) {
+  801d7f:	55                   	push   %rbp
+  801d80:	48 89 e5             	mov    %rsp,%rbp
+  801d83:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  801d87:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801d8b:	48 b8 1a 1c 80 00 00 	movabs $0x801c1a,%rax
+  801d92:	00 00 00 
+  801d95:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801d97:	85 c0                	test   %eax,%eax
+  801d99:	78 15                	js     801db0 <close+0x31>
+
+    return fd_close(fd, 1);
+  801d9b:	be 01 00 00 00       	mov    $0x1,%esi
+  801da0:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801da4:	48 b8 d5 1c 80 00 00 	movabs $0x801cd5,%rax
+  801dab:	00 00 00 
+  801dae:	ff d0                	call   *%rax
+}
+  801db0:	c9                   	leave
+  801db1:	c3                   	ret
+
+0000000000801db2 <close_all>:
+
+void
+close_all(void) {
+  801db2:	55                   	push   %rbp
+  801db3:	48 89 e5             	mov    %rsp,%rbp
+  801db6:	41 54                	push   %r12
+  801db8:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  801db9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801dbe:	49 bc 7f 1d 80 00 00 	movabs $0x801d7f,%r12
+  801dc5:	00 00 00 
+  801dc8:	89 df                	mov    %ebx,%edi
+  801dca:	41 ff d4             	call   *%r12
+  801dcd:	83 c3 01             	add    $0x1,%ebx
+  801dd0:	83 fb 20             	cmp    $0x20,%ebx
+  801dd3:	75 f3                	jne    801dc8 <close_all+0x16>
+}
+  801dd5:	5b                   	pop    %rbx
+  801dd6:	41 5c                	pop    %r12
+  801dd8:	5d                   	pop    %rbp
+  801dd9:	c3                   	ret
+
+0000000000801dda <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  801dda:	55                   	push   %rbp
+  801ddb:	48 89 e5             	mov    %rsp,%rbp
+  801dde:	41 57                	push   %r15
+  801de0:	41 56                	push   %r14
+  801de2:	41 55                	push   %r13
+  801de4:	41 54                	push   %r12
+  801de6:	53                   	push   %rbx
+  801de7:	48 83 ec 18          	sub    $0x18,%rsp
+  801deb:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  801dee:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801df2:	48 b8 1a 1c 80 00 00 	movabs $0x801c1a,%rax
+  801df9:	00 00 00 
+  801dfc:	ff d0                	call   *%rax
+  801dfe:	89 c3                	mov    %eax,%ebx
+  801e00:	85 c0                	test   %eax,%eax
+  801e02:	0f 88 b8 00 00 00    	js     801ec0 <dup+0xe6>
+    close(newfdnum);
+  801e08:	44 89 e7             	mov    %r12d,%edi
+  801e0b:	48 b8 7f 1d 80 00 00 	movabs $0x801d7f,%rax
+  801e12:	00 00 00 
+  801e15:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  801e17:	4d 63 ec             	movslq %r12d,%r13
+  801e1a:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  801e21:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  801e25:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  801e29:	4c 89 ff             	mov    %r15,%rdi
+  801e2c:	49 be 6b 1b 80 00 00 	movabs $0x801b6b,%r14
+  801e33:	00 00 00 
+  801e36:	41 ff d6             	call   *%r14
+  801e39:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  801e3c:	4c 89 ef             	mov    %r13,%rdi
+  801e3f:	41 ff d6             	call   *%r14
+  801e42:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  801e45:	48 89 df             	mov    %rbx,%rdi
+  801e48:	48 b8 49 2d 80 00 00 	movabs $0x802d49,%rax
+  801e4f:	00 00 00 
+  801e52:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  801e54:	a8 04                	test   $0x4,%al
+  801e56:	74 2b                	je     801e83 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  801e58:	41 89 c1             	mov    %eax,%r9d
+  801e5b:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801e61:	4c 89 f1             	mov    %r14,%rcx
+  801e64:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e69:	48 89 de             	mov    %rbx,%rsi
+  801e6c:	bf 00 00 00 00       	mov    $0x0,%edi
+  801e71:	48 b8 59 14 80 00 00 	movabs $0x801459,%rax
+  801e78:	00 00 00 
+  801e7b:	ff d0                	call   *%rax
+  801e7d:	89 c3                	mov    %eax,%ebx
+  801e7f:	85 c0                	test   %eax,%eax
+  801e81:	78 4e                	js     801ed1 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  801e83:	4c 89 ff             	mov    %r15,%rdi
+  801e86:	48 b8 49 2d 80 00 00 	movabs $0x802d49,%rax
+  801e8d:	00 00 00 
+  801e90:	ff d0                	call   *%rax
+  801e92:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801e95:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801e9b:	4c 89 e9             	mov    %r13,%rcx
+  801e9e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ea3:	4c 89 fe             	mov    %r15,%rsi
+  801ea6:	bf 00 00 00 00       	mov    $0x0,%edi
+  801eab:	48 b8 59 14 80 00 00 	movabs $0x801459,%rax
+  801eb2:	00 00 00 
+  801eb5:	ff d0                	call   *%rax
+  801eb7:	89 c3                	mov    %eax,%ebx
+  801eb9:	85 c0                	test   %eax,%eax
+  801ebb:	78 14                	js     801ed1 <dup+0xf7>
+
+    return newfdnum;
+  801ebd:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  801ec0:	89 d8                	mov    %ebx,%eax
+  801ec2:	48 83 c4 18          	add    $0x18,%rsp
+  801ec6:	5b                   	pop    %rbx
+  801ec7:	41 5c                	pop    %r12
+  801ec9:	41 5d                	pop    %r13
+  801ecb:	41 5e                	pop    %r14
+  801ecd:	41 5f                	pop    %r15
+  801ecf:	5d                   	pop    %rbp
+  801ed0:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  801ed1:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801ed6:	4c 89 ee             	mov    %r13,%rsi
+  801ed9:	bf 00 00 00 00       	mov    $0x0,%edi
+  801ede:	49 bc be 14 80 00 00 	movabs $0x8014be,%r12
+  801ee5:	00 00 00 
+  801ee8:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  801eeb:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801ef0:	4c 89 f6             	mov    %r14,%rsi
+  801ef3:	bf 00 00 00 00       	mov    $0x0,%edi
+  801ef8:	41 ff d4             	call   *%r12
+    return res;
+  801efb:	eb c3                	jmp    801ec0 <dup+0xe6>
+
+0000000000801efd <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  801efd:	55                   	push   %rbp
+  801efe:	48 89 e5             	mov    %rsp,%rbp
+  801f01:	41 56                	push   %r14
+  801f03:	41 55                	push   %r13
+  801f05:	41 54                	push   %r12
+  801f07:	53                   	push   %rbx
+  801f08:	48 83 ec 10          	sub    $0x10,%rsp
+  801f0c:	89 fb                	mov    %edi,%ebx
+  801f0e:	49 89 f4             	mov    %rsi,%r12
+  801f11:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801f14:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801f18:	48 b8 1a 1c 80 00 00 	movabs $0x801c1a,%rax
+  801f1f:	00 00 00 
+  801f22:	ff d0                	call   *%rax
+  801f24:	85 c0                	test   %eax,%eax
+  801f26:	78 4c                	js     801f74 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801f28:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801f2c:	41 8b 3e             	mov    (%r14),%edi
+  801f2f:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801f33:	48 b8 65 1c 80 00 00 	movabs $0x801c65,%rax
+  801f3a:	00 00 00 
+  801f3d:	ff d0                	call   *%rax
+  801f3f:	85 c0                	test   %eax,%eax
+  801f41:	78 35                	js     801f78 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801f43:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801f47:	83 e0 03             	and    $0x3,%eax
+  801f4a:	83 f8 01             	cmp    $0x1,%eax
+  801f4d:	74 2d                	je     801f7c <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801f4f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801f53:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801f57:	48 85 c0             	test   %rax,%rax
+  801f5a:	74 56                	je     801fb2 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  801f5c:	4c 89 ea             	mov    %r13,%rdx
+  801f5f:	4c 89 e6             	mov    %r12,%rsi
+  801f62:	4c 89 f7             	mov    %r14,%rdi
+  801f65:	ff d0                	call   *%rax
+}
+  801f67:	48 83 c4 10          	add    $0x10,%rsp
+  801f6b:	5b                   	pop    %rbx
+  801f6c:	41 5c                	pop    %r12
+  801f6e:	41 5d                	pop    %r13
+  801f70:	41 5e                	pop    %r14
+  801f72:	5d                   	pop    %rbp
+  801f73:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801f74:	48 98                	cltq
+  801f76:	eb ef                	jmp    801f67 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801f78:	48 98                	cltq
+  801f7a:	eb eb                	jmp    801f67 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801f7c:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801f83:	00 00 00 
+  801f86:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+  801f8c:	89 da                	mov    %ebx,%edx
+  801f8e:	48 bf 61 38 80 00 00 	movabs $0x803861,%rdi
+  801f95:	00 00 00 
+  801f98:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f9d:	48 b9 1d 05 80 00 00 	movabs $0x80051d,%rcx
+  801fa4:	00 00 00 
+  801fa7:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801fa9:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801fb0:	eb b5                	jmp    801f67 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801fb2:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801fb9:	eb ac                	jmp    801f67 <read+0x6a>
+
+0000000000801fbb <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801fbb:	55                   	push   %rbp
+  801fbc:	48 89 e5             	mov    %rsp,%rbp
+  801fbf:	41 57                	push   %r15
+  801fc1:	41 56                	push   %r14
+  801fc3:	41 55                	push   %r13
+  801fc5:	41 54                	push   %r12
+  801fc7:	53                   	push   %rbx
+  801fc8:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  801fcc:	48 85 d2             	test   %rdx,%rdx
+  801fcf:	74 54                	je     802025 <readn+0x6a>
+  801fd1:	41 89 fd             	mov    %edi,%r13d
+  801fd4:	49 89 f6             	mov    %rsi,%r14
+  801fd7:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  801fda:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  801fdf:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  801fe4:	49 bf fd 1e 80 00 00 	movabs $0x801efd,%r15
+  801feb:	00 00 00 
+  801fee:	4c 89 e2             	mov    %r12,%rdx
+  801ff1:	48 29 f2             	sub    %rsi,%rdx
+  801ff4:	4c 01 f6             	add    %r14,%rsi
+  801ff7:	44 89 ef             	mov    %r13d,%edi
+  801ffa:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  801ffd:	85 c0                	test   %eax,%eax
+  801fff:	78 20                	js     802021 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  802001:	01 c3                	add    %eax,%ebx
+  802003:	85 c0                	test   %eax,%eax
+  802005:	74 08                	je     80200f <readn+0x54>
+  802007:	48 63 f3             	movslq %ebx,%rsi
+  80200a:	4c 39 e6             	cmp    %r12,%rsi
+  80200d:	72 df                	jb     801fee <readn+0x33>
+    }
+    return res;
+  80200f:	48 63 c3             	movslq %ebx,%rax
+}
+  802012:	48 83 c4 08          	add    $0x8,%rsp
+  802016:	5b                   	pop    %rbx
+  802017:	41 5c                	pop    %r12
+  802019:	41 5d                	pop    %r13
+  80201b:	41 5e                	pop    %r14
+  80201d:	41 5f                	pop    %r15
+  80201f:	5d                   	pop    %rbp
+  802020:	c3                   	ret
+        if (inc < 0) return inc;
+  802021:	48 98                	cltq
+  802023:	eb ed                	jmp    802012 <readn+0x57>
+    int inc = 1, res = 0;
+  802025:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80202a:	eb e3                	jmp    80200f <readn+0x54>
+
+000000000080202c <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  80202c:	55                   	push   %rbp
+  80202d:	48 89 e5             	mov    %rsp,%rbp
+  802030:	41 56                	push   %r14
+  802032:	41 55                	push   %r13
+  802034:	41 54                	push   %r12
+  802036:	53                   	push   %rbx
+  802037:	48 83 ec 10          	sub    $0x10,%rsp
+  80203b:	89 fb                	mov    %edi,%ebx
+  80203d:	49 89 f4             	mov    %rsi,%r12
+  802040:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802043:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802047:	48 b8 1a 1c 80 00 00 	movabs $0x801c1a,%rax
+  80204e:	00 00 00 
+  802051:	ff d0                	call   *%rax
+  802053:	85 c0                	test   %eax,%eax
+  802055:	78 47                	js     80209e <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802057:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  80205b:	41 8b 3e             	mov    (%r14),%edi
+  80205e:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802062:	48 b8 65 1c 80 00 00 	movabs $0x801c65,%rax
+  802069:	00 00 00 
+  80206c:	ff d0                	call   *%rax
+  80206e:	85 c0                	test   %eax,%eax
+  802070:	78 30                	js     8020a2 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802072:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  802077:	74 2d                	je     8020a6 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  802079:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80207d:	48 8b 40 18          	mov    0x18(%rax),%rax
+  802081:	48 85 c0             	test   %rax,%rax
+  802084:	74 56                	je     8020dc <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  802086:	4c 89 ea             	mov    %r13,%rdx
+  802089:	4c 89 e6             	mov    %r12,%rsi
+  80208c:	4c 89 f7             	mov    %r14,%rdi
+  80208f:	ff d0                	call   *%rax
+}
+  802091:	48 83 c4 10          	add    $0x10,%rsp
+  802095:	5b                   	pop    %rbx
+  802096:	41 5c                	pop    %r12
+  802098:	41 5d                	pop    %r13
+  80209a:	41 5e                	pop    %r14
+  80209c:	5d                   	pop    %rbp
+  80209d:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80209e:	48 98                	cltq
+  8020a0:	eb ef                	jmp    802091 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8020a2:	48 98                	cltq
+  8020a4:	eb eb                	jmp    802091 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8020a6:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  8020ad:	00 00 00 
+  8020b0:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+  8020b6:	89 da                	mov    %ebx,%edx
+  8020b8:	48 bf 7d 38 80 00 00 	movabs $0x80387d,%rdi
+  8020bf:	00 00 00 
+  8020c2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020c7:	48 b9 1d 05 80 00 00 	movabs $0x80051d,%rcx
+  8020ce:	00 00 00 
+  8020d1:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8020d3:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8020da:	eb b5                	jmp    802091 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  8020dc:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  8020e3:	eb ac                	jmp    802091 <write+0x65>
+
+00000000008020e5 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  8020e5:	55                   	push   %rbp
+  8020e6:	48 89 e5             	mov    %rsp,%rbp
+  8020e9:	53                   	push   %rbx
+  8020ea:	48 83 ec 18          	sub    $0x18,%rsp
+  8020ee:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8020f0:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8020f4:	48 b8 1a 1c 80 00 00 	movabs $0x801c1a,%rax
+  8020fb:	00 00 00 
+  8020fe:	ff d0                	call   *%rax
+  802100:	85 c0                	test   %eax,%eax
+  802102:	78 0c                	js     802110 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  802104:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802108:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  80210b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802110:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802114:	c9                   	leave
+  802115:	c3                   	ret
+
+0000000000802116 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  802116:	55                   	push   %rbp
+  802117:	48 89 e5             	mov    %rsp,%rbp
+  80211a:	41 55                	push   %r13
+  80211c:	41 54                	push   %r12
+  80211e:	53                   	push   %rbx
+  80211f:	48 83 ec 18          	sub    $0x18,%rsp
+  802123:	89 fb                	mov    %edi,%ebx
+  802125:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802128:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80212c:	48 b8 1a 1c 80 00 00 	movabs $0x801c1a,%rax
+  802133:	00 00 00 
+  802136:	ff d0                	call   *%rax
+  802138:	85 c0                	test   %eax,%eax
+  80213a:	78 38                	js     802174 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80213c:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  802140:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  802144:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802148:	48 b8 65 1c 80 00 00 	movabs $0x801c65,%rax
+  80214f:	00 00 00 
+  802152:	ff d0                	call   *%rax
+  802154:	85 c0                	test   %eax,%eax
+  802156:	78 1c                	js     802174 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802158:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  80215d:	74 20                	je     80217f <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  80215f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802163:	48 8b 40 30          	mov    0x30(%rax),%rax
+  802167:	48 85 c0             	test   %rax,%rax
+  80216a:	74 47                	je     8021b3 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  80216c:	44 89 e6             	mov    %r12d,%esi
+  80216f:	4c 89 ef             	mov    %r13,%rdi
+  802172:	ff d0                	call   *%rax
+}
+  802174:	48 83 c4 18          	add    $0x18,%rsp
+  802178:	5b                   	pop    %rbx
+  802179:	41 5c                	pop    %r12
+  80217b:	41 5d                	pop    %r13
+  80217d:	5d                   	pop    %rbp
+  80217e:	c3                   	ret
+                thisenv->env_id, fdnum);
+  80217f:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802186:	00 00 00 
+  802189:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  80218f:	89 da                	mov    %ebx,%edx
+  802191:	48 bf 40 38 80 00 00 	movabs $0x803840,%rdi
+  802198:	00 00 00 
+  80219b:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021a0:	48 b9 1d 05 80 00 00 	movabs $0x80051d,%rcx
+  8021a7:	00 00 00 
+  8021aa:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8021ac:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8021b1:	eb c1                	jmp    802174 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  8021b3:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8021b8:	eb ba                	jmp    802174 <ftruncate+0x5e>
+
+00000000008021ba <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  8021ba:	55                   	push   %rbp
+  8021bb:	48 89 e5             	mov    %rsp,%rbp
+  8021be:	41 54                	push   %r12
+  8021c0:	53                   	push   %rbx
+  8021c1:	48 83 ec 10          	sub    $0x10,%rsp
+  8021c5:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8021c8:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8021cc:	48 b8 1a 1c 80 00 00 	movabs $0x801c1a,%rax
+  8021d3:	00 00 00 
+  8021d6:	ff d0                	call   *%rax
+  8021d8:	85 c0                	test   %eax,%eax
+  8021da:	78 4e                	js     80222a <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8021dc:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  8021e0:	41 8b 3c 24          	mov    (%r12),%edi
+  8021e4:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  8021e8:	48 b8 65 1c 80 00 00 	movabs $0x801c65,%rax
+  8021ef:	00 00 00 
+  8021f2:	ff d0                	call   *%rax
+  8021f4:	85 c0                	test   %eax,%eax
+  8021f6:	78 32                	js     80222a <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  8021f8:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8021fc:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  802201:	74 30                	je     802233 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  802203:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  802206:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  80220d:	00 00 00 
+    stat->st_isdir = 0;
+  802210:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  802217:	00 00 00 
+    stat->st_dev = dev;
+  80221a:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  802221:	48 89 de             	mov    %rbx,%rsi
+  802224:	4c 89 e7             	mov    %r12,%rdi
+  802227:	ff 50 28             	call   *0x28(%rax)
+}
+  80222a:	48 83 c4 10          	add    $0x10,%rsp
+  80222e:	5b                   	pop    %rbx
+  80222f:	41 5c                	pop    %r12
+  802231:	5d                   	pop    %rbp
+  802232:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  802233:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802238:	eb f0                	jmp    80222a <fstat+0x70>
+
+000000000080223a <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  80223a:	55                   	push   %rbp
+  80223b:	48 89 e5             	mov    %rsp,%rbp
+  80223e:	41 54                	push   %r12
+  802240:	53                   	push   %rbx
+  802241:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  802244:	be 00 00 00 00       	mov    $0x0,%esi
+  802249:	48 b8 1d 26 80 00 00 	movabs $0x80261d,%rax
+  802250:	00 00 00 
+  802253:	ff d0                	call   *%rax
+  802255:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  802257:	85 c0                	test   %eax,%eax
+  802259:	78 25                	js     802280 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  80225b:	4c 89 e6             	mov    %r12,%rsi
+  80225e:	89 c7                	mov    %eax,%edi
+  802260:	48 b8 ba 21 80 00 00 	movabs $0x8021ba,%rax
+  802267:	00 00 00 
+  80226a:	ff d0                	call   *%rax
+  80226c:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  80226f:	89 df                	mov    %ebx,%edi
+  802271:	48 b8 7f 1d 80 00 00 	movabs $0x801d7f,%rax
+  802278:	00 00 00 
+  80227b:	ff d0                	call   *%rax
+
+    return res;
+  80227d:	44 89 e3             	mov    %r12d,%ebx
+}
+  802280:	89 d8                	mov    %ebx,%eax
+  802282:	5b                   	pop    %rbx
+  802283:	41 5c                	pop    %r12
+  802285:	5d                   	pop    %rbp
+  802286:	c3                   	ret
+
+0000000000802287 <fsipc>:
+ * response may be written back to fsipcbuf.
+ * type: request code, passed as the simple integer IPC value.
+ * dstva: virtual address at which to receive reply page, 0 if none.
+ * Returns result from the file server. */
+static int
+fsipc(unsigned type, void *dstva) {
+  802287:	55                   	push   %rbp
+  802288:	48 89 e5             	mov    %rsp,%rbp
+  80228b:	41 54                	push   %r12
+  80228d:	53                   	push   %rbx
+  80228e:	48 83 ec 10          	sub    $0x10,%rsp
+  802292:	41 89 fc             	mov    %edi,%r12d
+  802295:	48 89 f3             	mov    %rsi,%rbx
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802298:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  80229f:	00 00 00 
+  8022a2:	83 38 00             	cmpl   $0x0,(%rax)
+  8022a5:	74 5e                	je     802305 <fsipc+0x7e>
+    if (debug) {
+        cprintf("[%08x] fsipc %d %08x\n",
+                thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+    }
+
+    ipc_send(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW);
+  8022a7:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8022ad:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8022b2:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  8022b9:	00 00 00 
+  8022bc:	44 89 e6             	mov    %r12d,%esi
+  8022bf:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  8022c6:	00 00 00 
+  8022c9:	8b 38                	mov    (%rax),%edi
+  8022cb:	48 b8 66 1a 80 00 00 	movabs $0x801a66,%rax
+  8022d2:	00 00 00 
+  8022d5:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  8022d7:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  8022de:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  8022df:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8022e4:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  8022e8:	48 89 de             	mov    %rbx,%rsi
+  8022eb:	bf 00 00 00 00       	mov    $0x0,%edi
+  8022f0:	48 b8 91 19 80 00 00 	movabs $0x801991,%rax
+  8022f7:	00 00 00 
+  8022fa:	ff d0                	call   *%rax
+}
+  8022fc:	48 83 c4 10          	add    $0x10,%rsp
+  802300:	5b                   	pop    %rbx
+  802301:	41 5c                	pop    %r12
+  802303:	5d                   	pop    %rbp
+  802304:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802305:	bf 03 00 00 00       	mov    $0x3,%edi
+  80230a:	48 b8 09 1b 80 00 00 	movabs $0x801b09,%rax
+  802311:	00 00 00 
+  802314:	ff d0                	call   *%rax
+  802316:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  80231d:	00 00 
+  80231f:	eb 86                	jmp    8022a7 <fsipc+0x20>
+
+0000000000802321 <devfile_trunc>:
+    return 0;
+}
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  802321:	55                   	push   %rbp
+  802322:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802325:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  80232c:	00 00 00 
+  80232f:	8b 57 0c             	mov    0xc(%rdi),%edx
+  802332:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  802334:	89 70 04             	mov    %esi,0x4(%rax)
+
+    return fsipc(FSREQ_SET_SIZE, NULL);
+  802337:	be 00 00 00 00       	mov    $0x0,%esi
+  80233c:	bf 02 00 00 00       	mov    $0x2,%edi
+  802341:	48 b8 87 22 80 00 00 	movabs $0x802287,%rax
+  802348:	00 00 00 
+  80234b:	ff d0                	call   *%rax
+}
+  80234d:	5d                   	pop    %rbp
+  80234e:	c3                   	ret
+
+000000000080234f <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  80234f:	55                   	push   %rbp
+  802350:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  802353:	8b 47 0c             	mov    0xc(%rdi),%eax
+  802356:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  80235d:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  80235f:	be 00 00 00 00       	mov    $0x0,%esi
+  802364:	bf 06 00 00 00       	mov    $0x6,%edi
+  802369:	48 b8 87 22 80 00 00 	movabs $0x802287,%rax
+  802370:	00 00 00 
+  802373:	ff d0                	call   *%rax
+}
+  802375:	5d                   	pop    %rbp
+  802376:	c3                   	ret
+
+0000000000802377 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  802377:	55                   	push   %rbp
+  802378:	48 89 e5             	mov    %rsp,%rbp
+  80237b:	41 54                	push   %r12
+  80237d:	53                   	push   %rbx
+  80237e:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802381:	8b 47 0c             	mov    0xc(%rdi),%eax
+  802384:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  80238b:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  80238d:	be 00 00 00 00       	mov    $0x0,%esi
+  802392:	bf 05 00 00 00       	mov    $0x5,%edi
+  802397:	48 b8 87 22 80 00 00 	movabs $0x802287,%rax
+  80239e:	00 00 00 
+  8023a1:	ff d0                	call   *%rax
+    if (res < 0) {
+  8023a3:	85 c0                	test   %eax,%eax
+  8023a5:	78 3d                	js     8023e4 <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8023a7:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  8023ae:	00 00 00 
+  8023b1:	4c 89 e6             	mov    %r12,%rsi
+  8023b4:	48 89 df             	mov    %rbx,%rdi
+  8023b7:	48 b8 42 0e 80 00 00 	movabs $0x800e42,%rax
+  8023be:	00 00 00 
+  8023c1:	ff d0                	call   *%rax
+    st->st_size  = fsipcbuf.statRet.ret_size;
+  8023c3:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  8023ca:	00 
+  8023cb:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8023d1:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  8023d8:	00 
+  8023d9:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  8023df:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8023e4:	5b                   	pop    %rbx
+  8023e5:	41 5c                	pop    %r12
+  8023e7:	5d                   	pop    %rbp
+  8023e8:	c3                   	ret
+
+00000000008023e9 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  8023e9:	55                   	push   %rbp
+  8023ea:	48 89 e5             	mov    %rsp,%rbp
+  8023ed:	41 57                	push   %r15
+  8023ef:	41 56                	push   %r14
+  8023f1:	41 55                	push   %r13
+  8023f3:	41 54                	push   %r12
+  8023f5:	53                   	push   %rbx
+  8023f6:	48 83 ec 18          	sub    $0x18,%rsp
+  8023fa:	49 89 fe             	mov    %rdi,%r14
+  8023fd:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+  802401:	48 89 d3             	mov    %rdx,%rbx
+    while (n > sizeof(fsipcbuf.write.req_buf))
+  802404:	48 81 fa f0 0f 00 00 	cmp    $0xff0,%rdx
+  80240b:	0f 86 e4 00 00 00    	jbe    8024f5 <devfile_write+0x10c>
+  802411:	49 89 f4             	mov    %rsi,%r12
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802414:	49 bd 00 60 80 00 00 	movabs $0x806000,%r13
+  80241b:	00 00 00 
+        memcpy(fsipcbuf.write.req_buf, buf, sizeof(fsipcbuf.write.req_buf));
+  80241e:	49 bf a3 10 80 00 00 	movabs $0x8010a3,%r15
+  802425:	00 00 00 
+  802428:	eb 03                	jmp    80242d <devfile_write+0x44>
+        buf += sizeof(fsipcbuf.write.req_buf);
+  80242a:	49 89 f4             	mov    %rsi,%r12
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  80242d:	41 8b 46 0c          	mov    0xc(%r14),%eax
+  802431:	41 89 45 00          	mov    %eax,0x0(%r13)
+        fsipcbuf.write.req_n      = sizeof(fsipcbuf.write.req_buf);
+  802435:	49 c7 45 08 f0 0f 00 	movq   $0xff0,0x8(%r13)
+  80243c:	00 
+        memcpy(fsipcbuf.write.req_buf, buf, sizeof(fsipcbuf.write.req_buf));
+  80243d:	ba f0 0f 00 00       	mov    $0xff0,%edx
+  802442:	4c 89 e6             	mov    %r12,%rsi
+  802445:	48 bf 10 60 80 00 00 	movabs $0x806010,%rdi
+  80244c:	00 00 00 
+  80244f:	41 ff d7             	call   *%r15
+        ssize_t res = fsipc(FSREQ_WRITE, NULL);
+  802452:	be 00 00 00 00       	mov    $0x0,%esi
+  802457:	bf 04 00 00 00       	mov    $0x4,%edi
+  80245c:	48 b8 87 22 80 00 00 	movabs $0x802287,%rax
+  802463:	00 00 00 
+  802466:	ff d0                	call   *%rax
+  802468:	48 63 d0             	movslq %eax,%rdx
+        if (res < 0 || res < sizeof(fsipcbuf.write.req_buf))
+  80246b:	3d ef 0f 00 00       	cmp    $0xfef,%eax
+  802470:	7e 71                	jle    8024e3 <devfile_write+0xfa>
+        buf += sizeof(fsipcbuf.write.req_buf);
+  802472:	49 8d b4 24 f0 0f 00 	lea    0xff0(%r12),%rsi
+  802479:	00 
+        n -= sizeof(fsipcbuf.write.req_buf);
+  80247a:	48 81 eb f0 0f 00 00 	sub    $0xff0,%rbx
+    while (n > sizeof(fsipcbuf.write.req_buf))
+  802481:	48 81 fb f0 0f 00 00 	cmp    $0xff0,%rbx
+  802488:	77 a0                	ja     80242a <devfile_write+0x41>
+        written += sizeof(fsipcbuf.write.req_buf);
+  80248a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80248e:	49 29 c4             	sub    %rax,%r12
+  802491:	4d 8d a4 24 f0 0f 00 	lea    0xff0(%r12),%r12
+  802498:	00 
+    fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802499:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  8024a0:	00 00 00 
+  8024a3:	41 8b 56 0c          	mov    0xc(%r14),%edx
+  8024a7:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.write.req_n      = n;
+  8024a9:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    memcpy(fsipcbuf.write.req_buf, buf, n);
+  8024ad:	48 89 da             	mov    %rbx,%rdx
+  8024b0:	48 8d 78 10          	lea    0x10(%rax),%rdi
+  8024b4:	48 b8 a3 10 80 00 00 	movabs $0x8010a3,%rax
+  8024bb:	00 00 00 
+  8024be:	ff d0                	call   *%rax
+    ssize_t res = fsipc(FSREQ_WRITE, NULL);
+  8024c0:	be 00 00 00 00       	mov    $0x0,%esi
+  8024c5:	bf 04 00 00 00       	mov    $0x4,%edi
+  8024ca:	48 b8 87 22 80 00 00 	movabs $0x802287,%rax
+  8024d1:	00 00 00 
+  8024d4:	ff d0                	call   *%rax
+  8024d6:	48 63 d0             	movslq %eax,%rdx
+    written += res;
+  8024d9:	49 01 d4             	add    %rdx,%r12
+  8024dc:	48 85 d2             	test   %rdx,%rdx
+  8024df:	49 0f 49 d4          	cmovns %r12,%rdx
+}
+  8024e3:	48 89 d0             	mov    %rdx,%rax
+  8024e6:	48 83 c4 18          	add    $0x18,%rsp
+  8024ea:	5b                   	pop    %rbx
+  8024eb:	41 5c                	pop    %r12
+  8024ed:	41 5d                	pop    %r13
+  8024ef:	41 5e                	pop    %r14
+  8024f1:	41 5f                	pop    %r15
+  8024f3:	5d                   	pop    %rbp
+  8024f4:	c3                   	ret
+    while (n > sizeof(fsipcbuf.write.req_buf))
+  8024f5:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+    ssize_t written = 0;
+  8024f9:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8024ff:	eb 98                	jmp    802499 <devfile_write+0xb0>
+
+0000000000802501 <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  802501:	55                   	push   %rbp
+  802502:	48 89 e5             	mov    %rsp,%rbp
+  802505:	41 57                	push   %r15
+  802507:	41 56                	push   %r14
+  802509:	41 55                	push   %r13
+  80250b:	41 54                	push   %r12
+  80250d:	53                   	push   %rbx
+  80250e:	48 83 ec 18          	sub    $0x18,%rsp
+  802512:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  802516:	49 89 f6             	mov    %rsi,%r14
+  802519:	49 89 d4             	mov    %rdx,%r12
+    while (n > sizeof(fsipcbuf.readRet.ret_buf))
+  80251c:	48 81 fa 00 10 00 00 	cmp    $0x1000,%rdx
+  802523:	0f 86 ea 00 00 00    	jbe    802613 <devfile_read+0x112>
+    ssize_t readsz = 0;
+  802529:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  802530:	00 
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802531:	49 bf 00 60 80 00 00 	movabs $0x806000,%r15
+  802538:	00 00 00 
+  80253b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80253f:	8b 40 0c             	mov    0xc(%rax),%eax
+  802542:	41 89 07             	mov    %eax,(%r15)
+        fsipcbuf.read.req_n = sizeof(fsipcbuf.readRet.ret_buf);
+  802545:	49 c7 47 08 00 10 00 	movq   $0x1000,0x8(%r15)
+  80254c:	00 
+        ssize_t res = fsipc(FSREQ_READ, NULL);
+  80254d:	be 00 00 00 00       	mov    $0x0,%esi
+  802552:	bf 03 00 00 00       	mov    $0x3,%edi
+  802557:	48 b8 87 22 80 00 00 	movabs $0x802287,%rax
+  80255e:	00 00 00 
+  802561:	ff d0                	call   *%rax
+  802563:	4c 63 e8             	movslq %eax,%r13
+        if (res < 0)
+  802566:	4d 85 ed             	test   %r13,%r13
+  802569:	0f 88 92 00 00 00    	js     802601 <devfile_read+0x100>
+        memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  80256f:	4c 89 ea             	mov    %r13,%rdx
+  802572:	4c 89 fe             	mov    %r15,%rsi
+  802575:	4c 89 f7             	mov    %r14,%rdi
+  802578:	48 b8 a3 10 80 00 00 	movabs $0x8010a3,%rax
+  80257f:	00 00 00 
+  802582:	ff d0                	call   *%rax
+        if (res < sizeof(fsipcbuf.readRet.ret_buf))
+  802584:	49 81 fd ff 0f 00 00 	cmp    $0xfff,%r13
+  80258b:	76 6d                	jbe    8025fa <devfile_read+0xf9>
+        readsz += res;
+  80258d:	4c 01 6d c0          	add    %r13,-0x40(%rbp)
+        buf += res;
+  802591:	4d 01 ee             	add    %r13,%r14
+        n -= res;
+  802594:	4d 29 ec             	sub    %r13,%r12
+    while (n > sizeof(fsipcbuf.readRet.ret_buf))
+  802597:	49 81 fc 00 10 00 00 	cmp    $0x1000,%r12
+  80259e:	77 9b                	ja     80253b <devfile_read+0x3a>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8025a0:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  8025a7:	00 00 00 
+  8025aa:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  8025ae:	8b 51 0c             	mov    0xc(%rcx),%edx
+  8025b1:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.read.req_n = n;
+  8025b3:	4c 89 60 08          	mov    %r12,0x8(%rax)
+    ssize_t res = fsipc(FSREQ_READ, NULL);
+  8025b7:	be 00 00 00 00       	mov    $0x0,%esi
+  8025bc:	bf 03 00 00 00       	mov    $0x3,%edi
+  8025c1:	48 b8 87 22 80 00 00 	movabs $0x802287,%rax
+  8025c8:	00 00 00 
+  8025cb:	ff d0                	call   *%rax
+  8025cd:	4c 63 e8             	movslq %eax,%r13
+    if (res < 0)
+  8025d0:	4d 85 ed             	test   %r13,%r13
+  8025d3:	78 2c                	js     802601 <devfile_read+0x100>
+    memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  8025d5:	4c 89 ea             	mov    %r13,%rdx
+  8025d8:	48 be 00 60 80 00 00 	movabs $0x806000,%rsi
+  8025df:	00 00 00 
+  8025e2:	4c 89 f7             	mov    %r14,%rdi
+  8025e5:	48 b8 a3 10 80 00 00 	movabs $0x8010a3,%rax
+  8025ec:	00 00 00 
+  8025ef:	ff d0                	call   *%rax
+    readsz += res;
+  8025f1:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8025f5:	49 01 c5             	add    %rax,%r13
+    return readsz;
+  8025f8:	eb 07                	jmp    802601 <devfile_read+0x100>
+            return readsz + res;
+  8025fa:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8025fe:	49 01 c5             	add    %rax,%r13
+}
+  802601:	4c 89 e8             	mov    %r13,%rax
+  802604:	48 83 c4 18          	add    $0x18,%rsp
+  802608:	5b                   	pop    %rbx
+  802609:	41 5c                	pop    %r12
+  80260b:	41 5d                	pop    %r13
+  80260d:	41 5e                	pop    %r14
+  80260f:	41 5f                	pop    %r15
+  802611:	5d                   	pop    %rbp
+  802612:	c3                   	ret
+    ssize_t readsz = 0;
+  802613:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  80261a:	00 
+  80261b:	eb 83                	jmp    8025a0 <devfile_read+0x9f>
+
+000000000080261d <open>:
+open(const char *path, int mode) {
+  80261d:	55                   	push   %rbp
+  80261e:	48 89 e5             	mov    %rsp,%rbp
+  802621:	41 55                	push   %r13
+  802623:	41 54                	push   %r12
+  802625:	53                   	push   %rbx
+  802626:	48 83 ec 18          	sub    $0x18,%rsp
+  80262a:	49 89 fc             	mov    %rdi,%r12
+  80262d:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  802630:	48 b8 04 0e 80 00 00 	movabs $0x800e04,%rax
+  802637:	00 00 00 
+  80263a:	ff d0                	call   *%rax
+  80263c:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802642:	0f 87 8a 00 00 00    	ja     8026d2 <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802648:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  80264c:	48 b8 00 1c 80 00 00 	movabs $0x801c00,%rax
+  802653:	00 00 00 
+  802656:	ff d0                	call   *%rax
+  802658:	89 c3                	mov    %eax,%ebx
+  80265a:	85 c0                	test   %eax,%eax
+  80265c:	78 50                	js     8026ae <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  80265e:	4c 89 e6             	mov    %r12,%rsi
+  802661:	48 bb 00 60 80 00 00 	movabs $0x806000,%rbx
+  802668:	00 00 00 
+  80266b:	48 89 df             	mov    %rbx,%rdi
+  80266e:	48 b8 42 0e 80 00 00 	movabs $0x800e42,%rax
+  802675:	00 00 00 
+  802678:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  80267a:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  802681:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802685:	bf 01 00 00 00       	mov    $0x1,%edi
+  80268a:	48 b8 87 22 80 00 00 	movabs $0x802287,%rax
+  802691:	00 00 00 
+  802694:	ff d0                	call   *%rax
+  802696:	89 c3                	mov    %eax,%ebx
+  802698:	85 c0                	test   %eax,%eax
+  80269a:	78 1f                	js     8026bb <open+0x9e>
+    return fd2num(fd);
+  80269c:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8026a0:	48 b8 59 1b 80 00 00 	movabs $0x801b59,%rax
+  8026a7:	00 00 00 
+  8026aa:	ff d0                	call   *%rax
+  8026ac:	89 c3                	mov    %eax,%ebx
+}
+  8026ae:	89 d8                	mov    %ebx,%eax
+  8026b0:	48 83 c4 18          	add    $0x18,%rsp
+  8026b4:	5b                   	pop    %rbx
+  8026b5:	41 5c                	pop    %r12
+  8026b7:	41 5d                	pop    %r13
+  8026b9:	5d                   	pop    %rbp
+  8026ba:	c3                   	ret
+        fd_close(fd, 0);
+  8026bb:	be 00 00 00 00       	mov    $0x0,%esi
+  8026c0:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8026c4:	48 b8 d5 1c 80 00 00 	movabs $0x801cd5,%rax
+  8026cb:	00 00 00 
+  8026ce:	ff d0                	call   *%rax
+        return res;
+  8026d0:	eb dc                	jmp    8026ae <open+0x91>
+        return -E_BAD_PATH;
+  8026d2:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  8026d7:	eb d5                	jmp    8026ae <open+0x91>
+
+00000000008026d9 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  8026d9:	55                   	push   %rbp
+  8026da:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc(FSREQ_SYNC, NULL);
+  8026dd:	be 00 00 00 00       	mov    $0x0,%esi
+  8026e2:	bf 08 00 00 00       	mov    $0x8,%edi
+  8026e7:	48 b8 87 22 80 00 00 	movabs $0x802287,%rax
+  8026ee:	00 00 00 
+  8026f1:	ff d0                	call   *%rax
+}
+  8026f3:	5d                   	pop    %rbp
+  8026f4:	c3                   	ret
+
+00000000008026f5 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  8026f5:	55                   	push   %rbp
+  8026f6:	48 89 e5             	mov    %rsp,%rbp
+  8026f9:	41 54                	push   %r12
+  8026fb:	53                   	push   %rbx
+  8026fc:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8026ff:	48 b8 6b 1b 80 00 00 	movabs $0x801b6b,%rax
+  802706:	00 00 00 
+  802709:	ff d0                	call   *%rax
+  80270b:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  80270e:	48 be c0 38 80 00 00 	movabs $0x8038c0,%rsi
+  802715:	00 00 00 
+  802718:	48 89 df             	mov    %rbx,%rdi
+  80271b:	48 b8 42 0e 80 00 00 	movabs $0x800e42,%rax
+  802722:	00 00 00 
+  802725:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  802727:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  80272c:	41 2b 04 24          	sub    (%r12),%eax
+  802730:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  802736:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  80273d:	00 00 00 
+    stat->st_dev = &devpipe;
+  802740:	48 b8 60 40 80 00 00 	movabs $0x804060,%rax
+  802747:	00 00 00 
+  80274a:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  802751:	b8 00 00 00 00       	mov    $0x0,%eax
+  802756:	5b                   	pop    %rbx
+  802757:	41 5c                	pop    %r12
+  802759:	5d                   	pop    %rbp
+  80275a:	c3                   	ret
+
+000000000080275b <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  80275b:	55                   	push   %rbp
+  80275c:	48 89 e5             	mov    %rsp,%rbp
+  80275f:	41 54                	push   %r12
+  802761:	53                   	push   %rbx
+  802762:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  802765:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80276a:	48 89 fe             	mov    %rdi,%rsi
+  80276d:	bf 00 00 00 00       	mov    $0x0,%edi
+  802772:	49 bc be 14 80 00 00 	movabs $0x8014be,%r12
+  802779:	00 00 00 
+  80277c:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  80277f:	48 89 df             	mov    %rbx,%rdi
+  802782:	48 b8 6b 1b 80 00 00 	movabs $0x801b6b,%rax
+  802789:	00 00 00 
+  80278c:	ff d0                	call   *%rax
+  80278e:	48 89 c6             	mov    %rax,%rsi
+  802791:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802796:	bf 00 00 00 00       	mov    $0x0,%edi
+  80279b:	41 ff d4             	call   *%r12
+}
+  80279e:	5b                   	pop    %rbx
+  80279f:	41 5c                	pop    %r12
+  8027a1:	5d                   	pop    %rbp
+  8027a2:	c3                   	ret
+
+00000000008027a3 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8027a3:	55                   	push   %rbp
+  8027a4:	48 89 e5             	mov    %rsp,%rbp
+  8027a7:	41 57                	push   %r15
+  8027a9:	41 56                	push   %r14
+  8027ab:	41 55                	push   %r13
+  8027ad:	41 54                	push   %r12
+  8027af:	53                   	push   %rbx
+  8027b0:	48 83 ec 18          	sub    $0x18,%rsp
+  8027b4:	49 89 fc             	mov    %rdi,%r12
+  8027b7:	49 89 f5             	mov    %rsi,%r13
+  8027ba:	49 89 d7             	mov    %rdx,%r15
+  8027bd:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8027c1:	48 b8 6b 1b 80 00 00 	movabs $0x801b6b,%rax
+  8027c8:	00 00 00 
+  8027cb:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  8027cd:	4d 85 ff             	test   %r15,%r15
+  8027d0:	0f 84 af 00 00 00    	je     802885 <devpipe_write+0xe2>
+  8027d6:	48 89 c3             	mov    %rax,%rbx
+  8027d9:	4c 89 f8             	mov    %r15,%rax
+  8027dc:	4d 89 ef             	mov    %r13,%r15
+  8027df:	4c 01 e8             	add    %r13,%rax
+  8027e2:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8027e6:	49 bd c6 13 80 00 00 	movabs $0x8013c6,%r13
+  8027ed:	00 00 00 
+            sys_yield();
+  8027f0:	49 be 63 13 80 00 00 	movabs $0x801363,%r14
+  8027f7:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  8027fa:	8b 73 04             	mov    0x4(%rbx),%esi
+  8027fd:	48 63 ce             	movslq %esi,%rcx
+  802800:	48 63 03             	movslq (%rbx),%rax
+  802803:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  802809:	48 39 c1             	cmp    %rax,%rcx
+  80280c:	72 2e                	jb     80283c <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80280e:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802813:	48 89 da             	mov    %rbx,%rdx
+  802816:	be 00 10 00 00       	mov    $0x1000,%esi
+  80281b:	4c 89 e7             	mov    %r12,%rdi
+  80281e:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  802821:	85 c0                	test   %eax,%eax
+  802823:	74 66                	je     80288b <devpipe_write+0xe8>
+            sys_yield();
+  802825:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  802828:	8b 73 04             	mov    0x4(%rbx),%esi
+  80282b:	48 63 ce             	movslq %esi,%rcx
+  80282e:	48 63 03             	movslq (%rbx),%rax
+  802831:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  802837:	48 39 c1             	cmp    %rax,%rcx
+  80283a:	73 d2                	jae    80280e <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  80283c:	41 0f b6 3f          	movzbl (%r15),%edi
+  802840:	48 89 ca             	mov    %rcx,%rdx
+  802843:	48 c1 ea 03          	shr    $0x3,%rdx
+  802847:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  80284e:	08 10 20 
+  802851:	48 f7 e2             	mul    %rdx
+  802854:	48 c1 ea 06          	shr    $0x6,%rdx
+  802858:	48 89 d0             	mov    %rdx,%rax
+  80285b:	48 c1 e0 09          	shl    $0x9,%rax
+  80285f:	48 29 d0             	sub    %rdx,%rax
+  802862:	48 c1 e0 03          	shl    $0x3,%rax
+  802866:	48 29 c1             	sub    %rax,%rcx
+  802869:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  80286e:	83 c6 01             	add    $0x1,%esi
+  802871:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  802874:	49 83 c7 01          	add    $0x1,%r15
+  802878:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80287c:	49 39 c7             	cmp    %rax,%r15
+  80287f:	0f 85 75 ff ff ff    	jne    8027fa <devpipe_write+0x57>
+    return n;
+  802885:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802889:	eb 05                	jmp    802890 <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  80288b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802890:	48 83 c4 18          	add    $0x18,%rsp
+  802894:	5b                   	pop    %rbx
+  802895:	41 5c                	pop    %r12
+  802897:	41 5d                	pop    %r13
+  802899:	41 5e                	pop    %r14
+  80289b:	41 5f                	pop    %r15
+  80289d:	5d                   	pop    %rbp
+  80289e:	c3                   	ret
+
+000000000080289f <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  80289f:	55                   	push   %rbp
+  8028a0:	48 89 e5             	mov    %rsp,%rbp
+  8028a3:	41 57                	push   %r15
+  8028a5:	41 56                	push   %r14
+  8028a7:	41 55                	push   %r13
+  8028a9:	41 54                	push   %r12
+  8028ab:	53                   	push   %rbx
+  8028ac:	48 83 ec 18          	sub    $0x18,%rsp
+  8028b0:	49 89 fc             	mov    %rdi,%r12
+  8028b3:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  8028b7:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8028bb:	48 b8 6b 1b 80 00 00 	movabs $0x801b6b,%rax
+  8028c2:	00 00 00 
+  8028c5:	ff d0                	call   *%rax
+  8028c7:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  8028ca:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8028d0:	49 bd c6 13 80 00 00 	movabs $0x8013c6,%r13
+  8028d7:	00 00 00 
+            sys_yield();
+  8028da:	49 be 63 13 80 00 00 	movabs $0x801363,%r14
+  8028e1:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  8028e4:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  8028e9:	74 7d                	je     802968 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  8028eb:	8b 03                	mov    (%rbx),%eax
+  8028ed:	3b 43 04             	cmp    0x4(%rbx),%eax
+  8028f0:	75 26                	jne    802918 <devpipe_read+0x79>
+            if (i > 0) return i;
+  8028f2:	4d 85 ff             	test   %r15,%r15
+  8028f5:	75 77                	jne    80296e <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8028f7:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8028fc:	48 89 da             	mov    %rbx,%rdx
+  8028ff:	be 00 10 00 00       	mov    $0x1000,%esi
+  802904:	4c 89 e7             	mov    %r12,%rdi
+  802907:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  80290a:	85 c0                	test   %eax,%eax
+  80290c:	74 72                	je     802980 <devpipe_read+0xe1>
+            sys_yield();
+  80290e:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  802911:	8b 03                	mov    (%rbx),%eax
+  802913:	3b 43 04             	cmp    0x4(%rbx),%eax
+  802916:	74 df                	je     8028f7 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802918:	48 63 c8             	movslq %eax,%rcx
+  80291b:	48 89 ca             	mov    %rcx,%rdx
+  80291e:	48 c1 ea 03          	shr    $0x3,%rdx
+  802922:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  802929:	08 10 20 
+  80292c:	48 89 d0             	mov    %rdx,%rax
+  80292f:	48 f7 e6             	mul    %rsi
+  802932:	48 c1 ea 06          	shr    $0x6,%rdx
+  802936:	48 89 d0             	mov    %rdx,%rax
+  802939:	48 c1 e0 09          	shl    $0x9,%rax
+  80293d:	48 29 d0             	sub    %rdx,%rax
+  802940:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  802947:	00 
+  802948:	48 89 c8             	mov    %rcx,%rax
+  80294b:	48 29 d0             	sub    %rdx,%rax
+  80294e:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  802953:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  802957:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  80295b:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  80295e:	49 83 c7 01          	add    $0x1,%r15
+  802962:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  802966:	75 83                	jne    8028eb <devpipe_read+0x4c>
+    return n;
+  802968:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80296c:	eb 03                	jmp    802971 <devpipe_read+0xd2>
+            if (i > 0) return i;
+  80296e:	4c 89 f8             	mov    %r15,%rax
+}
+  802971:	48 83 c4 18          	add    $0x18,%rsp
+  802975:	5b                   	pop    %rbx
+  802976:	41 5c                	pop    %r12
+  802978:	41 5d                	pop    %r13
+  80297a:	41 5e                	pop    %r14
+  80297c:	41 5f                	pop    %r15
+  80297e:	5d                   	pop    %rbp
+  80297f:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  802980:	b8 00 00 00 00       	mov    $0x0,%eax
+  802985:	eb ea                	jmp    802971 <devpipe_read+0xd2>
+
+0000000000802987 <pipe>:
+pipe(int pfd[2]) {
+  802987:	55                   	push   %rbp
+  802988:	48 89 e5             	mov    %rsp,%rbp
+  80298b:	41 55                	push   %r13
+  80298d:	41 54                	push   %r12
+  80298f:	53                   	push   %rbx
+  802990:	48 81 ec b8 00 00 00 	sub    $0xb8,%rsp
+  802997:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  80299a:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  80299e:	48 b8 00 1c 80 00 00 	movabs $0x801c00,%rax
+  8029a5:	00 00 00 
+  8029a8:	ff d0                	call   *%rax
+  8029aa:	89 c3                	mov    %eax,%ebx
+  8029ac:	85 c0                	test   %eax,%eax
+  8029ae:	0f 88 51 01 00 00    	js     802b05 <pipe+0x17e>
+        (res = fd_alloc_from(fd2num(fd0) + 1, &fd1)) < 0) goto err;
+  8029b4:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8029b8:	48 b8 59 1b 80 00 00 	movabs $0x801b59,%rax
+  8029bf:	00 00 00 
+  8029c2:	ff d0                	call   *%rax
+  8029c4:	8d 78 01             	lea    0x1(%rax),%edi
+  8029c7:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8029cb:	48 b8 87 1b 80 00 00 	movabs $0x801b87,%rax
+  8029d2:	00 00 00 
+  8029d5:	ff d0                	call   *%rax
+  8029d7:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8029d9:	85 c0                	test   %eax,%eax
+  8029db:	0f 88 24 01 00 00    	js     802b05 <pipe+0x17e>
+    va = fd2data(fd0);
+  8029e1:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8029e5:	48 bb 6b 1b 80 00 00 	movabs $0x801b6b,%rbx
+  8029ec:	00 00 00 
+  8029ef:	ff d3                	call   *%rbx
+  8029f1:	49 89 c5             	mov    %rax,%r13
+    struct RegionOp ops[] = {
+  8029f4:	48 8d bd 30 ff ff ff 	lea    -0xd0(%rbp),%rdi
+  8029fb:	b9 14 00 00 00       	mov    $0x14,%ecx
+  802a00:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a05:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+  802a08:	c7 85 34 ff ff ff 46 	movl   $0x46,-0xcc(%rbp)
+  802a0f:	00 00 00 
+  802a12:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802a16:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+  802a1d:	48 c7 85 50 ff ff ff 	movq   $0x1000,-0xb0(%rbp)
+  802a24:	00 10 00 00 
+  802a28:	c7 85 5c ff ff ff 46 	movl   $0x46,-0xa4(%rbp)
+  802a2f:	00 00 00 
+            {.type = REGION_ALLOC, .dstva = (uintptr_t)fd1, .size = PAGE_SIZE, .perm = PROT_RW | PROT_SHARE},
+  802a32:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+    struct RegionOp ops[] = {
+  802a36:	48 89 bd 70 ff ff ff 	mov    %rdi,-0x90(%rbp)
+  802a3d:	48 c7 85 78 ff ff ff 	movq   $0x1000,-0x88(%rbp)
+  802a44:	00 10 00 00 
+  802a48:	c7 45 84 46 00 00 00 	movl   $0x46,-0x7c(%rbp)
+  802a4f:	4c 89 6d 98          	mov    %r13,-0x68(%rbp)
+  802a53:	48 c7 45 a0 00 10 00 	movq   $0x1000,-0x60(%rbp)
+  802a5a:	00 
+  802a5b:	c7 45 a8 01 00 00 00 	movl   $0x1,-0x58(%rbp)
+  802a62:	c7 45 ac 46 00 00 00 	movl   $0x46,-0x54(%rbp)
+  802a69:	4c 89 6d b8          	mov    %r13,-0x48(%rbp)
+            {.type = REGION_MAP, .srcva = (uintptr_t)va, .dstva = (uintptr_t)fd2data(fd1), .size = PAGE_SIZE, .perm = PROT_RW | PROT_SHARE},
+  802a6d:	ff d3                	call   *%rbx
+    struct RegionOp ops[] = {
+  802a6f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802a73:	48 c7 45 c8 00 10 00 	movq   $0x1000,-0x38(%rbp)
+  802a7a:	00 
+    if ((res = sys_region_batch(ops, sizeof ops / sizeof *ops)) < 0) goto err1;
+  802a7b:	be 04 00 00 00       	mov    $0x4,%esi
+  802a80:	48 8d bd 30 ff ff ff 	lea    -0xd0(%rbp),%rdi
+  802a87:	48 b8 25 15 80 00 00 	movabs $0x801525,%rax
+  802a8e:	00 00 00 
+  802a91:	ff d0                	call   *%rax
+  802a93:	89 c3                	mov    %eax,%ebx
+  802a95:	85 c0                	test   %eax,%eax
+  802a97:	0f 88 ad 00 00 00    	js     802b4a <pipe+0x1c3>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  802a9d:	be 00 10 00 00       	mov    $0x1000,%esi
+  802aa2:	4c 89 ef             	mov    %r13,%rdi
+  802aa5:	48 b8 94 13 80 00 00 	movabs $0x801394,%rax
+  802aac:	00 00 00 
+  802aaf:	ff d0                	call   *%rax
+  802ab1:	83 f8 02             	cmp    $0x2,%eax
+  802ab4:	75 5f                	jne    802b15 <pipe+0x18e>
+    fd0->fd_dev_id = devpipe.dev_id;
+  802ab6:	a1 60 40 80 00 00 00 	movabs 0x804060,%eax
+  802abd:	00 00 
+  802abf:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802ac3:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  802ac5:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802ac9:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  802ad0:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  802ad4:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  802ad6:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802ada:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  802ae1:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802ae5:	48 bb 59 1b 80 00 00 	movabs $0x801b59,%rbx
+  802aec:	00 00 00 
+  802aef:	ff d3                	call   *%rbx
+  802af1:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  802af5:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  802af9:	ff d3                	call   *%rbx
+  802afb:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  802b00:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  802b05:	89 d8                	mov    %ebx,%eax
+  802b07:	48 81 c4 b8 00 00 00 	add    $0xb8,%rsp
+  802b0e:	5b                   	pop    %rbx
+  802b0f:	41 5c                	pop    %r12
+  802b11:	41 5d                	pop    %r13
+  802b13:	5d                   	pop    %rbp
+  802b14:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  802b15:	48 b9 f0 38 80 00 00 	movabs $0x8038f0,%rcx
+  802b1c:	00 00 00 
+  802b1f:	48 ba c7 38 80 00 00 	movabs $0x8038c7,%rdx
+  802b26:	00 00 00 
+  802b29:	be 33 00 00 00       	mov    $0x33,%esi
+  802b2e:	48 bf dc 38 80 00 00 	movabs $0x8038dc,%rdi
+  802b35:	00 00 00 
+  802b38:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b3d:	49 b8 cd 03 80 00 00 	movabs $0x8003cd,%r8
+  802b44:	00 00 00 
+  802b47:	41 ff d0             	call   *%r8
+        ops[i].type = REGION_UNMAP;
+  802b4a:	c7 85 30 ff ff ff 02 	movl   $0x2,-0xd0(%rbp)
+  802b51:	00 00 00 
+  802b54:	c7 85 58 ff ff ff 02 	movl   $0x2,-0xa8(%rbp)
+  802b5b:	00 00 00 
+  802b5e:	c7 45 80 02 00 00 00 	movl   $0x2,-0x80(%rbp)
+  802b65:	c7 45 a8 02 00 00 00 	movl   $0x2,-0x58(%rbp)
+    sys_region_batch(ops, sizeof ops / sizeof *ops);
+  802b6c:	be 04 00 00 00       	mov    $0x4,%esi
+  802b71:	48 8d bd 30 ff ff ff 	lea    -0xd0(%rbp),%rdi
+  802b78:	48 b8 25 15 80 00 00 	movabs $0x801525,%rax
+  802b7f:	00 00 00 
+  802b82:	ff d0                	call   *%rax
+  802b84:	e9 7c ff ff ff       	jmp    802b05 <pipe+0x17e>
+
+0000000000802b89 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  802b89:	55                   	push   %rbp
+  802b8a:	48 89 e5             	mov    %rsp,%rbp
+  802b8d:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  802b91:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802b95:	48 b8 1a 1c 80 00 00 	movabs $0x801c1a,%rax
+  802b9c:	00 00 00 
+  802b9f:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802ba1:	85 c0                	test   %eax,%eax
+  802ba3:	78 35                	js     802bda <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  802ba5:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802ba9:	48 b8 6b 1b 80 00 00 	movabs $0x801b6b,%rax
+  802bb0:	00 00 00 
+  802bb3:	ff d0                	call   *%rax
+  802bb5:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802bb8:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802bbd:	be 00 10 00 00       	mov    $0x1000,%esi
+  802bc2:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802bc6:	48 b8 c6 13 80 00 00 	movabs $0x8013c6,%rax
+  802bcd:	00 00 00 
+  802bd0:	ff d0                	call   *%rax
+  802bd2:	85 c0                	test   %eax,%eax
+  802bd4:	0f 94 c0             	sete   %al
+  802bd7:	0f b6 c0             	movzbl %al,%eax
+}
+  802bda:	c9                   	leave
+  802bdb:	c3                   	ret
+
+0000000000802bdc <wait>:
+#include <inc/lib.h>
+
+/* Waits until 'envid' exits. */
+void
+wait(envid_t envid) {
+  802bdc:	55                   	push   %rbp
+  802bdd:	48 89 e5             	mov    %rsp,%rbp
+  802be0:	41 55                	push   %r13
+  802be2:	41 54                	push   %r12
+  802be4:	53                   	push   %rbx
+  802be5:	48 83 ec 08          	sub    $0x8,%rsp
+    assert(envid != 0);
+  802be9:	85 ff                	test   %edi,%edi
+  802beb:	74 73                	je     802c60 <wait+0x84>
+  802bed:	41 89 fc             	mov    %edi,%r12d
+
+    const volatile struct Env *env = &envs[ENVX(envid)];
+  802bf0:	89 f8                	mov    %edi,%eax
+  802bf2:	25 ff 03 00 00       	and    $0x3ff,%eax
+
+    while (env->env_id == envid &&
+  802bf7:	89 f9                	mov    %edi,%ecx
+  802bf9:	81 e1 ff 03 00 00    	and    $0x3ff,%ecx
+  802bff:	48 69 c9 d0 01 00 00 	imul   $0x1d0,%rcx,%rcx
+  802c06:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  802c0d:	00 00 00 
+  802c10:	48 01 ca             	add    %rcx,%rdx
+  802c13:	8b 92 e0 00 00 00    	mov    0xe0(%rdx),%edx
+  802c19:	39 d7                	cmp    %edx,%edi
+  802c1b:	75 38                	jne    802c55 <wait+0x79>
+           env->env_status != ENV_FREE) {
+  802c1d:	48 98                	cltq
+  802c1f:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+  802c26:	48 bb 00 00 c0 1f 80 	movabs $0x801fc00000,%rbx
+  802c2d:	00 00 00 
+  802c30:	48 01 c3             	add    %rax,%rbx
+        sys_yield();
+  802c33:	49 bd 63 13 80 00 00 	movabs $0x801363,%r13
+  802c3a:	00 00 00 
+           env->env_status != ENV_FREE) {
+  802c3d:	8b 83 ec 00 00 00    	mov    0xec(%rbx),%eax
+    while (env->env_id == envid &&
+  802c43:	85 c0                	test   %eax,%eax
+  802c45:	74 0e                	je     802c55 <wait+0x79>
+        sys_yield();
+  802c47:	41 ff d5             	call   *%r13
+    while (env->env_id == envid &&
+  802c4a:	8b 83 e0 00 00 00    	mov    0xe0(%rbx),%eax
+  802c50:	44 39 e0             	cmp    %r12d,%eax
+  802c53:	74 e8                	je     802c3d <wait+0x61>
+    }
+}
+  802c55:	48 83 c4 08          	add    $0x8,%rsp
+  802c59:	5b                   	pop    %rbx
+  802c5a:	41 5c                	pop    %r12
+  802c5c:	41 5d                	pop    %r13
+  802c5e:	5d                   	pop    %rbp
+  802c5f:	c3                   	ret
+    assert(envid != 0);
+  802c60:	48 b9 14 39 80 00 00 	movabs $0x803914,%rcx
+  802c67:	00 00 00 
+  802c6a:	48 ba c7 38 80 00 00 	movabs $0x8038c7,%rdx
+  802c71:	00 00 00 
+  802c74:	be 06 00 00 00       	mov    $0x6,%esi
+  802c79:	48 bf 1f 39 80 00 00 	movabs $0x80391f,%rdi
+  802c80:	00 00 00 
+  802c83:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c88:	49 b8 cd 03 80 00 00 	movabs $0x8003cd,%r8
+  802c8f:	00 00 00 
+  802c92:	41 ff d0             	call   *%r8
+
+0000000000802c95 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  802c95:	48 89 f8             	mov    %rdi,%rax
+  802c98:	48 c1 e8 27          	shr    $0x27,%rax
+  802c9c:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  802ca3:	01 00 00 
+  802ca6:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802caa:	f6 c2 01             	test   $0x1,%dl
+  802cad:	74 6d                	je     802d1c <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  802caf:	48 89 f8             	mov    %rdi,%rax
+  802cb2:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802cb6:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802cbd:	01 00 00 
+  802cc0:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802cc4:	f6 c2 01             	test   $0x1,%dl
+  802cc7:	74 62                	je     802d2b <get_uvpt_entry+0x96>
+  802cc9:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802cd0:	01 00 00 
+  802cd3:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802cd7:	f6 c2 80             	test   $0x80,%dl
+  802cda:	75 4f                	jne    802d2b <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  802cdc:	48 89 f8             	mov    %rdi,%rax
+  802cdf:	48 c1 e8 15          	shr    $0x15,%rax
+  802ce3:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802cea:	01 00 00 
+  802ced:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802cf1:	f6 c2 01             	test   $0x1,%dl
+  802cf4:	74 44                	je     802d3a <get_uvpt_entry+0xa5>
+  802cf6:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802cfd:	01 00 00 
+  802d00:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802d04:	f6 c2 80             	test   $0x80,%dl
+  802d07:	75 31                	jne    802d3a <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  802d09:	48 c1 ef 0c          	shr    $0xc,%rdi
+  802d0d:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802d14:	01 00 00 
+  802d17:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  802d1b:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  802d1c:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  802d23:	01 00 00 
+  802d26:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802d2a:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  802d2b:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802d32:	01 00 00 
+  802d35:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802d39:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  802d3a:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802d41:	01 00 00 
+  802d44:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802d48:	c3                   	ret
+
+0000000000802d49 <get_prot>:
+
+int
+get_prot(void *va) {
+  802d49:	55                   	push   %rbp
+  802d4a:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  802d4d:	48 b8 95 2c 80 00 00 	movabs $0x802c95,%rax
+  802d54:	00 00 00 
+  802d57:	ff d0                	call   *%rax
+  802d59:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  802d5c:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  802d61:	89 c1                	mov    %eax,%ecx
+  802d63:	83 c9 04             	or     $0x4,%ecx
+  802d66:	f6 c2 01             	test   $0x1,%dl
+  802d69:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  802d6c:	89 c1                	mov    %eax,%ecx
+  802d6e:	83 c9 02             	or     $0x2,%ecx
+  802d71:	f6 c2 02             	test   $0x2,%dl
+  802d74:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  802d77:	89 c1                	mov    %eax,%ecx
+  802d79:	83 c9 01             	or     $0x1,%ecx
+  802d7c:	48 85 d2             	test   %rdx,%rdx
+  802d7f:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  802d82:	89 c1                	mov    %eax,%ecx
+  802d84:	83 c9 40             	or     $0x40,%ecx
+  802d87:	f6 c6 04             	test   $0x4,%dh
+  802d8a:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  802d8d:	5d                   	pop    %rbp
+  802d8e:	c3                   	ret
+
+0000000000802d8f <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  802d8f:	55                   	push   %rbp
+  802d90:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  802d93:	48 b8 95 2c 80 00 00 	movabs $0x802c95,%rax
+  802d9a:	00 00 00 
+  802d9d:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  802d9f:	48 c1 e8 06          	shr    $0x6,%rax
+  802da3:	83 e0 01             	and    $0x1,%eax
+}
+  802da6:	5d                   	pop    %rbp
+  802da7:	c3                   	ret
+
+0000000000802da8 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  802da8:	55                   	push   %rbp
+  802da9:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  802dac:	48 b8 95 2c 80 00 00 	movabs $0x802c95,%rax
+  802db3:	00 00 00 
+  802db6:	ff d0                	call   *%rax
+  802db8:	83 e0 01             	and    $0x1,%eax
+}
+  802dbb:	5d                   	pop    %rbp
+  802dbc:	c3                   	ret
+
+0000000000802dbd <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  802dbd:	55                   	push   %rbp
+  802dbe:	48 89 e5             	mov    %rsp,%rbp
+  802dc1:	41 57                	push   %r15
+  802dc3:	41 56                	push   %r14
+  802dc5:	41 55                	push   %r13
+  802dc7:	41 54                	push   %r12
+  802dc9:	53                   	push   %rbx
+  802dca:	48 83 ec 38          	sub    $0x38,%rsp
+  802dce:	49 89 f7             	mov    %rsi,%r15
+  802dd1:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+                    }
+                    continue;
+                }
+                for (int ptei = 0; ptei < PT_ENTRY_COUNT; ptei++) {
+                    uintptr_t pte_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, pdei, ptei, 0);
+                    pte_t pte = uvpt[VPT(pte_addr)];
+  802dd7:	49 bd 00 00 00 00 00 	movabs $0x10000000000,%r13
+  802dde:	01 00 00 
+  802de1:	4d 89 e6             	mov    %r12,%r14
+  802de4:	49 89 fc             	mov    %rdi,%r12
+  802de7:	e9 19 01 00 00       	jmp    802f05 <foreach_shared_region+0x148>
+  802dec:	48 89 5d b0          	mov    %rbx,-0x50(%rbp)
+  802df0:	4c 89 75 a8          	mov    %r14,-0x58(%rbp)
+  802df4:	eb 52                	jmp    802e48 <foreach_shared_region+0x8b>
+                for (int ptei = 0; ptei < PT_ENTRY_COUNT; ptei++) {
+  802df6:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802dfd:	48 81 fb 00 00 20 00 	cmp    $0x200000,%rbx
+  802e04:	74 2e                	je     802e34 <foreach_shared_region+0x77>
+                    uintptr_t pte_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, pdei, ptei, 0);
+  802e06:	48 89 df             	mov    %rbx,%rdi
+  802e09:	4c 09 f7             	or     %r14,%rdi
+                    pte_t pte = uvpt[VPT(pte_addr)];
+  802e0c:	48 89 f8             	mov    %rdi,%rax
+  802e0f:	48 c1 e8 0c          	shr    $0xc,%rax
+  802e13:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+                    if ((pte & PTE_P) && (pte & PTE_SHARE)) {
+  802e18:	25 01 04 00 00       	and    $0x401,%eax
+  802e1d:	48 3d 01 04 00 00    	cmp    $0x401,%rax
+  802e23:	75 d1                	jne    802df6 <foreach_shared_region+0x39>
+                        fun((void*)pte_addr, (void*)(pte_addr + PAGE_SIZE), arg);
+  802e25:	48 8d b7 00 10 00 00 	lea    0x1000(%rdi),%rsi
+  802e2c:	4c 89 fa             	mov    %r15,%rdx
+  802e2f:	41 ff d4             	call   *%r12
+  802e32:	eb c2                	jmp    802df6 <foreach_shared_region+0x39>
+            for (int pdei = 0; pdei < PD_ENTRY_COUNT; pdei++) {
+  802e34:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  802e3b:	00 
+  802e3c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802e40:	48 3d 00 00 00 40    	cmp    $0x40000000,%rax
+  802e46:	74 46                	je     802e8e <foreach_shared_region+0xd1>
+                uintptr_t pde_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, pdei, 0, 0);
+  802e48:	4c 8b 75 c8          	mov    -0x38(%rbp),%r14
+  802e4c:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802e50:	49 09 c6             	or     %rax,%r14
+                pde_t pde = uvpd[VPD(pde_addr)];
+  802e53:	4c 89 f0             	mov    %r14,%rax
+  802e56:	48 c1 e8 15          	shr    $0x15,%rax
+  802e5a:	48 b9 00 00 00 80 00 	movabs $0x10080000000,%rcx
+  802e61:	01 00 00 
+  802e64:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+                if (!(pde & PTE_P)) {
+  802e68:	a8 01                	test   $0x1,%al
+  802e6a:	74 c8                	je     802e34 <foreach_shared_region+0x77>
+                if (pde & PTE_PS) {
+  802e6c:	48 89 c3             	mov    %rax,%rbx
+  802e6f:	81 e3 80 00 00 00    	and    $0x80,%ebx
+  802e75:	74 8f                	je     802e06 <foreach_shared_region+0x49>
+                    if (pde & PTE_SHARE) {
+  802e77:	f6 c4 04             	test   $0x4,%ah
+  802e7a:	74 b8                	je     802e34 <foreach_shared_region+0x77>
+                        fun((void*)pde_addr, (void*)(pde_addr + 1024 * 1024 * 2), arg);
+  802e7c:	49 8d b6 00 00 20 00 	lea    0x200000(%r14),%rsi
+  802e83:	4c 89 fa             	mov    %r15,%rdx
+  802e86:	4c 89 f7             	mov    %r14,%rdi
+  802e89:	41 ff d4             	call   *%r12
+  802e8c:	eb a6                	jmp    802e34 <foreach_shared_region+0x77>
+  802e8e:	48 8b 5d b0          	mov    -0x50(%rbp),%rbx
+  802e92:	4c 8b 75 a8          	mov    -0x58(%rbp),%r14
+        for (int pdpei = 0; pdpei < PDP_ENTRY_COUNT; pdpei++) {
+  802e96:	48 81 c3 00 00 00 40 	add    $0x40000000,%rbx
+  802e9d:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802ea4:	00 00 00 
+  802ea7:	48 39 c3             	cmp    %rax,%rbx
+  802eaa:	74 4c                	je     802ef8 <foreach_shared_region+0x13b>
+            uintptr_t pdpe_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, 0, 0, 0);
+  802eac:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802eb0:	48 09 d8             	or     %rbx,%rax
+  802eb3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+            pdpe_t pdpe = uvpdp[VPDP(pdpe_addr)];
+  802eb7:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802ebb:	48 b9 00 00 40 80 00 	movabs $0x10080400000,%rcx
+  802ec2:	01 00 00 
+  802ec5:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+            if (!(pdpe & PTE_P)) {
+  802ec9:	a8 01                	test   $0x1,%al
+  802ecb:	74 c9                	je     802e96 <foreach_shared_region+0xd9>
+            if (pdpe & PTE_PS) {
+  802ecd:	48 89 c1             	mov    %rax,%rcx
+  802ed0:	81 e1 80 00 00 00    	and    $0x80,%ecx
+  802ed6:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  802eda:	0f 84 0c ff ff ff    	je     802dec <foreach_shared_region+0x2f>
+                if (pdpe & PTE_SHARE) {
+  802ee0:	f6 c4 04             	test   $0x4,%ah
+  802ee3:	74 b1                	je     802e96 <foreach_shared_region+0xd9>
+                    fun((void*)pdpe_addr, (void*)(pdpe_addr + 1024 * 1024 * 1024), arg); 
+  802ee5:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  802ee9:	48 8d b7 00 00 00 40 	lea    0x40000000(%rdi),%rsi
+  802ef0:	4c 89 fa             	mov    %r15,%rdx
+  802ef3:	41 ff d4             	call   *%r12
+  802ef6:	eb 9e                	jmp    802e96 <foreach_shared_region+0xd9>
+    for (int pml4ei = 0; pml4ei < PML4_ENTRY_COUNT; pml4ei++) {
+  802ef8:	49 83 c6 01          	add    $0x1,%r14
+  802efc:	49 81 fe 00 02 00 00 	cmp    $0x200,%r14
+  802f03:	74 24                	je     802f29 <foreach_shared_region+0x16c>
+        pml4e_t pml4e = uvpml4[VPML4(pml4_addr)];
+  802f05:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  802f0c:	01 00 00 
+  802f0f:	4a 8b 04 f0          	mov    (%rax,%r14,8),%rax
+        if (!(pml4e & PTE_P)) {
+  802f13:	a8 01                	test   $0x1,%al
+  802f15:	74 e1                	je     802ef8 <foreach_shared_region+0x13b>
+  802f17:	4c 89 f0             	mov    %r14,%rax
+  802f1a:	48 c1 e0 27          	shl    $0x27,%rax
+  802f1e:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  802f22:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802f27:	eb 83                	jmp    802eac <foreach_shared_region+0xef>
+            }
+        }
+    }
+    
+    return 0;
+}
+  802f29:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f2e:	48 83 c4 38          	add    $0x38,%rsp
+  802f32:	5b                   	pop    %rbx
+  802f33:	41 5c                	pop    %r12
+  802f35:	41 5d                	pop    %r13
+  802f37:	41 5e                	pop    %r14
+  802f39:	41 5f                	pop    %r15
+  802f3b:	5d                   	pop    %rbp
+  802f3c:	c3                   	ret
+
+0000000000802f3d <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  802f3d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f42:	c3                   	ret
+
+0000000000802f43 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  802f43:	55                   	push   %rbp
+  802f44:	48 89 e5             	mov    %rsp,%rbp
+  802f47:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  802f4a:	48 be 2a 39 80 00 00 	movabs $0x80392a,%rsi
+  802f51:	00 00 00 
+  802f54:	48 b8 42 0e 80 00 00 	movabs $0x800e42,%rax
+  802f5b:	00 00 00 
+  802f5e:	ff d0                	call   *%rax
+    return 0;
+}
+  802f60:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f65:	5d                   	pop    %rbp
+  802f66:	c3                   	ret
+
+0000000000802f67 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  802f67:	55                   	push   %rbp
+  802f68:	48 89 e5             	mov    %rsp,%rbp
+  802f6b:	41 57                	push   %r15
+  802f6d:	41 56                	push   %r14
+  802f6f:	41 55                	push   %r13
+  802f71:	41 54                	push   %r12
+  802f73:	53                   	push   %rbx
+  802f74:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  802f7b:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  802f82:	48 85 d2             	test   %rdx,%rdx
+  802f85:	74 7a                	je     803001 <devcons_write+0x9a>
+  802f87:	49 89 d6             	mov    %rdx,%r14
+  802f8a:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802f90:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  802f95:	49 bf 3c 10 80 00 00 	movabs $0x80103c,%r15
+  802f9c:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  802f9f:	4c 89 f3             	mov    %r14,%rbx
+  802fa2:	48 29 f3             	sub    %rsi,%rbx
+  802fa5:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802faa:	48 39 c3             	cmp    %rax,%rbx
+  802fad:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  802fb1:	4c 63 eb             	movslq %ebx,%r13
+  802fb4:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  802fbb:	48 01 c6             	add    %rax,%rsi
+  802fbe:	4c 89 ea             	mov    %r13,%rdx
+  802fc1:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802fc8:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  802fcb:	4c 89 ee             	mov    %r13,%rsi
+  802fce:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802fd5:	48 b8 69 12 80 00 00 	movabs $0x801269,%rax
+  802fdc:	00 00 00 
+  802fdf:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  802fe1:	41 01 dc             	add    %ebx,%r12d
+  802fe4:	49 63 f4             	movslq %r12d,%rsi
+  802fe7:	4c 39 f6             	cmp    %r14,%rsi
+  802fea:	72 b3                	jb     802f9f <devcons_write+0x38>
+    return res;
+  802fec:	49 63 c4             	movslq %r12d,%rax
+}
+  802fef:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  802ff6:	5b                   	pop    %rbx
+  802ff7:	41 5c                	pop    %r12
+  802ff9:	41 5d                	pop    %r13
+  802ffb:	41 5e                	pop    %r14
+  802ffd:	41 5f                	pop    %r15
+  802fff:	5d                   	pop    %rbp
+  803000:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  803001:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  803007:	eb e3                	jmp    802fec <devcons_write+0x85>
+
+0000000000803009 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  803009:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  80300c:	ba 00 00 00 00       	mov    $0x0,%edx
+  803011:	48 85 c0             	test   %rax,%rax
+  803014:	74 55                	je     80306b <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  803016:	55                   	push   %rbp
+  803017:	48 89 e5             	mov    %rsp,%rbp
+  80301a:	41 55                	push   %r13
+  80301c:	41 54                	push   %r12
+  80301e:	53                   	push   %rbx
+  80301f:	48 83 ec 08          	sub    $0x8,%rsp
+  803023:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  803026:	48 bb 96 12 80 00 00 	movabs $0x801296,%rbx
+  80302d:	00 00 00 
+  803030:	49 bc 63 13 80 00 00 	movabs $0x801363,%r12
+  803037:	00 00 00 
+  80303a:	eb 03                	jmp    80303f <devcons_read+0x36>
+  80303c:	41 ff d4             	call   *%r12
+  80303f:	ff d3                	call   *%rbx
+  803041:	85 c0                	test   %eax,%eax
+  803043:	74 f7                	je     80303c <devcons_read+0x33>
+    if (c < 0) return c;
+  803045:	48 63 d0             	movslq %eax,%rdx
+  803048:	78 13                	js     80305d <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  80304a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80304f:	83 f8 04             	cmp    $0x4,%eax
+  803052:	74 09                	je     80305d <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  803054:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  803058:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  80305d:	48 89 d0             	mov    %rdx,%rax
+  803060:	48 83 c4 08          	add    $0x8,%rsp
+  803064:	5b                   	pop    %rbx
+  803065:	41 5c                	pop    %r12
+  803067:	41 5d                	pop    %r13
+  803069:	5d                   	pop    %rbp
+  80306a:	c3                   	ret
+  80306b:	48 89 d0             	mov    %rdx,%rax
+  80306e:	c3                   	ret
+
+000000000080306f <cputchar>:
+cputchar(int ch) {
+  80306f:	55                   	push   %rbp
+  803070:	48 89 e5             	mov    %rsp,%rbp
+  803073:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  803077:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  80307b:	be 01 00 00 00       	mov    $0x1,%esi
+  803080:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  803084:	48 b8 69 12 80 00 00 	movabs $0x801269,%rax
+  80308b:	00 00 00 
+  80308e:	ff d0                	call   *%rax
+}
+  803090:	c9                   	leave
+  803091:	c3                   	ret
+
+0000000000803092 <getchar>:
+getchar(void) {
+  803092:	55                   	push   %rbp
+  803093:	48 89 e5             	mov    %rsp,%rbp
+  803096:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  80309a:	ba 01 00 00 00       	mov    $0x1,%edx
+  80309f:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  8030a3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8030a8:	48 b8 fd 1e 80 00 00 	movabs $0x801efd,%rax
+  8030af:	00 00 00 
+  8030b2:	ff d0                	call   *%rax
+  8030b4:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  8030b6:	85 c0                	test   %eax,%eax
+  8030b8:	78 06                	js     8030c0 <getchar+0x2e>
+  8030ba:	74 08                	je     8030c4 <getchar+0x32>
+  8030bc:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  8030c0:	89 d0                	mov    %edx,%eax
+  8030c2:	c9                   	leave
+  8030c3:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  8030c4:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  8030c9:	eb f5                	jmp    8030c0 <getchar+0x2e>
+
+00000000008030cb <iscons>:
+iscons(int fdnum) {
+  8030cb:	55                   	push   %rbp
+  8030cc:	48 89 e5             	mov    %rsp,%rbp
+  8030cf:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8030d3:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8030d7:	48 b8 1a 1c 80 00 00 	movabs $0x801c1a,%rax
+  8030de:	00 00 00 
+  8030e1:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8030e3:	85 c0                	test   %eax,%eax
+  8030e5:	78 18                	js     8030ff <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  8030e7:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8030eb:	48 b8 a0 40 80 00 00 	movabs $0x8040a0,%rax
+  8030f2:	00 00 00 
+  8030f5:	8b 00                	mov    (%rax),%eax
+  8030f7:	39 02                	cmp    %eax,(%rdx)
+  8030f9:	0f 94 c0             	sete   %al
+  8030fc:	0f b6 c0             	movzbl %al,%eax
+}
+  8030ff:	c9                   	leave
+  803100:	c3                   	ret
+
+0000000000803101 <opencons>:
+opencons(void) {
+  803101:	55                   	push   %rbp
+  803102:	48 89 e5             	mov    %rsp,%rbp
+  803105:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  803109:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  80310d:	48 b8 00 1c 80 00 00 	movabs $0x801c00,%rax
+  803114:	00 00 00 
+  803117:	ff d0                	call   *%rax
+  803119:	85 c0                	test   %eax,%eax
+  80311b:	78 49                	js     803166 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  80311d:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803122:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803127:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  80312b:	bf 00 00 00 00       	mov    $0x0,%edi
+  803130:	48 b8 f2 13 80 00 00 	movabs $0x8013f2,%rax
+  803137:	00 00 00 
+  80313a:	ff d0                	call   *%rax
+  80313c:	85 c0                	test   %eax,%eax
+  80313e:	78 26                	js     803166 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  803140:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803144:	a1 a0 40 80 00 00 00 	movabs 0x8040a0,%eax
+  80314b:	00 00 
+  80314d:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  80314f:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803153:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  80315a:	48 b8 59 1b 80 00 00 	movabs $0x801b59,%rax
+  803161:	00 00 00 
+  803164:	ff d0                	call   *%rax
+}
+  803166:	c9                   	leave
+  803167:	c3                   	ret
+
+0000000000803168 <__rodata_start>:
+  803168:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  80316a:	72 6b                	jb     8031d7 <__rodata_start+0x6f>
+  80316c:	3a 20                	cmp    (%rax),%ah
+  80316e:	25 69 00 75 73       	and    $0x73750069,%eax
+  803173:	65 72 2f             	gs jb  8031a5 <__rodata_start+0x3d>
+  803176:	73 6d                	jae    8031e5 <__rodata_start+0x7d>
+  803178:	70 73                	jo     8031ed <__rodata_start+0x85>
+  80317a:	63 61 6c             	movsxd 0x6c(%rcx),%esp
+  80317d:	65 2e 63 00          	gs movsxd %gs:(%rax),%eax
+  803181:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+  803188:	73 6d                	jae    8031f7 <__rodata_start+0x8f>
+  80318a:	70 73                	jo     8031ff <__rodata_start+0x97>
+  80318c:	63 61 6c             	movsxd 0x6c(%rcx),%esp
+  80318f:	65 3a 20             	cmp    %gs:(%rax),%ah
+  803192:	63 6f 6d             	movsxd 0x6d(%rdi),%ebp
+  803195:	70 75                	jo     80320c <__rodata_start+0xa4>
+  803197:	74 65                	je     8031fe <__rodata_start+0x96>
+  803199:	20 69 6e             	and    %ch,0x6e(%rcx)
+  80319c:	20 25 64 20 65 6e    	and    %ah,0x6e652064(%rip)        # 6ee55206 <__bss_end+0x6e64d206>
+  8031a2:	76 73                	jbe    803217 <__rodata_start+0xaf>
+  8031a4:	3a 20                	cmp    (%rax),%ah
+  8031a6:	25 6c 75 20 4d       	and    $0x4d20756c,%eax
+  8031ab:	63 79 63             	movsxd 0x63(%rcx),%edi
+  8031ae:	6c                   	insb   (%dx),%es:(%rdi)
+  8031af:	65 73 2c             	gs jae 8031de <__rodata_start+0x76>
+  8031b2:	20 70 61             	and    %dh,0x61(%rax)
+  8031b5:	72 61                	jb     803218 <__rodata_start+0xb0>
+  8031b7:	6c                   	insb   (%dx),%es:(%rdi)
+  8031b8:	6c                   	insb   (%dx),%es:(%rdi)
+  8031b9:	65 6c                	gs insb (%dx),%es:(%rdi)
+  8031bb:	69 73 6d 20 25 6c 75 	imul   $0x756c2520,0x6d(%rbx),%esi
+  8031c2:	2e 25 30 32 6c 75    	cs and $0x756c3230,%eax
+  8031c8:	0a 00                	or     (%rax),%al
+  8031ca:	00 00                	add    %al,(%rax)
+  8031cc:	00 00                	add    %al,(%rax)
+  8031ce:	00 00                	add    %al,(%rax)
+  8031d0:	73 6d                	jae    80323f <__rodata_start+0xd7>
+  8031d2:	70 73                	jo     803247 <__rodata_start+0xdf>
+  8031d4:	63 61 6c             	movsxd 0x6c(%rcx),%esp
+  8031d7:	65 3a 20             	cmp    %gs:(%rax),%ah
+  8031da:	25 64 20 66 6f       	and    $0x6f662064,%eax
+  8031df:	72 6b                	jb     80324c <__rodata_start+0xe4>
+  8031e1:	73 20                	jae    803203 <__rodata_start+0x9b>
+  8031e3:	69 6e 20 25 64 20 65 	imul   $0x65206425,0x20(%rsi),%ebp
+  8031ea:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8031eb:	76 73                	jbe    803260 <__rodata_start+0xf8>
+  8031ed:	3a 20                	cmp    (%rax),%ah
+  8031ef:	25 6c 75 20 4d       	and    $0x4d20756c,%eax
+  8031f4:	63 79 63             	movsxd 0x63(%rcx),%edi
+  8031f7:	6c                   	insb   (%dx),%es:(%rdi)
+  8031f8:	65 73 0a             	gs jae 803205 <__rodata_start+0x9d>
+  8031fb:	00 3c 75 6e 6b 6e 6f 	add    %bh,0x6f6e6b6e(,%rsi,2)
+  803202:	77 6e                	ja     803272 <__rodata_start+0x10a>
+  803204:	3e 00 66 90          	ds add %ah,-0x70(%rsi)
+  803208:	5b                   	pop    %rbx
+  803209:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  80320e:	20 75 73             	and    %dh,0x73(%rbp)
+  803211:	65 72 20             	gs jb  803234 <__rodata_start+0xcc>
+  803214:	70 61                	jo     803277 <__rodata_start+0x10f>
+  803216:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803217:	69 63 20 69 6e 20 25 	imul   $0x25206e69,0x20(%rbx),%esp
+  80321e:	73 20                	jae    803240 <__rodata_start+0xd8>
+  803220:	61                   	(bad)
+  803221:	74 20                	je     803243 <__rodata_start+0xdb>
+  803223:	25 73 3a 25 64       	and    $0x64253a73,%eax
+  803228:	3a 20                	cmp    (%rax),%ah
+  80322a:	00 30                	add    %dh,(%rax)
+  80322c:	31 32                	xor    %esi,(%rdx)
+  80322e:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  803235:	41                   	rex.B
+  803236:	42                   	rex.X
+  803237:	43                   	rex.XB
+  803238:	44                   	rex.R
+  803239:	45                   	rex.RB
+  80323a:	46 00 30             	rex.RX add %r14b,(%rax)
+  80323d:	31 32                	xor    %esi,(%rdx)
+  80323f:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  803246:	61                   	(bad)
+  803247:	62 63 64 65 66       	(bad)
+  80324c:	00 28                	add    %ch,(%rax)
+  80324e:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80324f:	75 6c                	jne    8032bd <__rodata_start+0x155>
+  803251:	6c                   	insb   (%dx),%es:(%rdi)
+  803252:	29 00                	sub    %eax,(%rax)
+  803254:	65 72 72             	gs jb  8032c9 <__rodata_start+0x161>
+  803257:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803258:	72 20                	jb     80327a <__rodata_start+0x112>
+  80325a:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  80325f:	73 70                	jae    8032d1 <__rodata_start+0x169>
+  803261:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  803265:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  80326c:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80326d:	72 00                	jb     80326f <__rodata_start+0x107>
+  80326f:	62 61 64 20 65       	(bad)
+  803274:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803275:	76 69                	jbe    8032e0 <__rodata_start+0x178>
+  803277:	72 6f                	jb     8032e8 <__rodata_start+0x180>
+  803279:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80327a:	6d                   	insl   (%dx),%es:(%rdi)
+  80327b:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  80327d:	74 00                	je     80327f <__rodata_start+0x117>
+  80327f:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  803286:	20 70 61             	and    %dh,0x61(%rax)
+  803289:	72 61                	jb     8032ec <__rodata_start+0x184>
+  80328b:	6d                   	insl   (%dx),%es:(%rdi)
+  80328c:	65 74 65             	gs je  8032f4 <__rodata_start+0x18c>
+  80328f:	72 00                	jb     803291 <__rodata_start+0x129>
+  803291:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803292:	75 74                	jne    803308 <__rodata_start+0x1a0>
+  803294:	20 6f 66             	and    %ch,0x66(%rdi)
+  803297:	20 6d 65             	and    %ch,0x65(%rbp)
+  80329a:	6d                   	insl   (%dx),%es:(%rdi)
+  80329b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80329c:	72 79                	jb     803317 <__rodata_start+0x1af>
+  80329e:	00 6f 75             	add    %ch,0x75(%rdi)
+  8032a1:	74 20                	je     8032c3 <__rodata_start+0x15b>
+  8032a3:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8032a4:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  8032a8:	76 69                	jbe    803313 <__rodata_start+0x1ab>
+  8032aa:	72 6f                	jb     80331b <__rodata_start+0x1b3>
+  8032ac:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8032ad:	6d                   	insl   (%dx),%es:(%rdi)
+  8032ae:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  8032b0:	74 73                	je     803325 <__rodata_start+0x1bd>
+  8032b2:	00 63 6f             	add    %ah,0x6f(%rbx)
+  8032b5:	72 72                	jb     803329 <__rodata_start+0x1c1>
+  8032b7:	75 70                	jne    803329 <__rodata_start+0x1c1>
+  8032b9:	74 65                	je     803320 <__rodata_start+0x1b8>
+  8032bb:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  8032c0:	75 67                	jne    803329 <__rodata_start+0x1c1>
+  8032c2:	20 69 6e             	and    %ch,0x6e(%rcx)
+  8032c5:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  8032c7:	00 73 65             	add    %dh,0x65(%rbx)
+  8032ca:	67 6d                	insl   (%dx),%es:(%edi)
+  8032cc:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  8032ce:	74 61                	je     803331 <__rodata_start+0x1c9>
+  8032d0:	74 69                	je     80333b <__rodata_start+0x1d3>
+  8032d2:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8032d3:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8032d4:	20 66 61             	and    %ah,0x61(%rsi)
+  8032d7:	75 6c                	jne    803345 <__rodata_start+0x1dd>
+  8032d9:	74 00                	je     8032db <__rodata_start+0x173>
+  8032db:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  8032e2:	20 45 4c             	and    %al,0x4c(%rbp)
+  8032e5:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  8032e9:	61                   	(bad)
+  8032ea:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  8032ef:	20 73 75             	and    %dh,0x75(%rbx)
+  8032f2:	63 68 20             	movsxd 0x20(%rax),%ebp
+  8032f5:	73 79                	jae    803370 <__rodata_start+0x208>
+  8032f7:	73 74                	jae    80336d <__rodata_start+0x205>
+  8032f9:	65 6d                	gs insl (%dx),%es:(%rdi)
+  8032fb:	20 63 61             	and    %ah,0x61(%rbx)
+  8032fe:	6c                   	insb   (%dx),%es:(%rdi)
+  8032ff:	6c                   	insb   (%dx),%es:(%rdi)
+  803300:	00 65 6e             	add    %ah,0x6e(%rbp)
+  803303:	74 72                	je     803377 <__rodata_start+0x20f>
+  803305:	79 20                	jns    803327 <__rodata_start+0x1bf>
+  803307:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803308:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803309:	74 20                	je     80332b <__rodata_start+0x1c3>
+  80330b:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  80330d:	75 6e                	jne    80337d <__rodata_start+0x215>
+  80330f:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  803313:	76 20                	jbe    803335 <__rodata_start+0x1cd>
+  803315:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  80331c:	72 65                	jb     803383 <__rodata_start+0x21b>
+  80331e:	63 76 69             	movsxd 0x69(%rsi),%esi
+  803321:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803322:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  803326:	65 78 70             	gs js  803399 <__rodata_start+0x231>
+  803329:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  80332e:	20 65 6e             	and    %ah,0x6e(%rbp)
+  803331:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  803335:	20 66 69             	and    %ah,0x69(%rsi)
+  803338:	6c                   	insb   (%dx),%es:(%rdi)
+  803339:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  80333d:	20 66 72             	and    %ah,0x72(%rsi)
+  803340:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  803345:	61                   	(bad)
+  803346:	63 65 20             	movsxd 0x20(%rbp),%esp
+  803349:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80334a:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80334b:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  80334f:	6b 00 74             	imul   $0x74,(%rax),%eax
+  803352:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803353:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803354:	20 6d 61             	and    %ch,0x61(%rbp)
+  803357:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803358:	79 20                	jns    80337a <__rodata_start+0x212>
+  80335a:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  803361:	72 65                	jb     8033c8 <__rodata_start+0x260>
+  803363:	20 6f 70             	and    %ch,0x70(%rdi)
+  803366:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803368:	00 66 69             	add    %ah,0x69(%rsi)
+  80336b:	6c                   	insb   (%dx),%es:(%rdi)
+  80336c:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  803370:	20 62 6c             	and    %ah,0x6c(%rdx)
+  803373:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803374:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  803377:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803378:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803379:	74 20                	je     80339b <__rodata_start+0x233>
+  80337b:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  80337d:	75 6e                	jne    8033ed <__rodata_start+0x285>
+  80337f:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  803383:	76 61                	jbe    8033e6 <__rodata_start+0x27e>
+  803385:	6c                   	insb   (%dx),%es:(%rdi)
+  803386:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  80338d:	00 
+  80338e:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  803395:	72 65                	jb     8033fc <__rodata_start+0x294>
+  803397:	61                   	(bad)
+  803398:	64 79 20             	fs jns 8033bb <__rodata_start+0x253>
+  80339b:	65 78 69             	gs js  803407 <__rodata_start+0x29f>
+  80339e:	73 74                	jae    803414 <__rodata_start+0x2ac>
+  8033a0:	73 00                	jae    8033a2 <__rodata_start+0x23a>
+  8033a2:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8033a3:	70 65                	jo     80340a <__rodata_start+0x2a2>
+  8033a5:	72 61                	jb     803408 <__rodata_start+0x2a0>
+  8033a7:	74 69                	je     803412 <__rodata_start+0x2aa>
+  8033a9:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8033aa:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8033ab:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  8033ae:	74 20                	je     8033d0 <__rodata_start+0x268>
+  8033b0:	73 75                	jae    803427 <__rodata_start+0x2bf>
+  8033b2:	70 70                	jo     803424 <__rodata_start+0x2bc>
+  8033b4:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8033b5:	72 74                	jb     80342b <__rodata_start+0x2c3>
+  8033b7:	65 64 00 6f 70       	gs add %ch,%fs:0x70(%rdi)
+  8033bc:	65 72 61             	gs jb  803420 <__rodata_start+0x2b8>
+  8033bf:	74 69                	je     80342a <__rodata_start+0x2c2>
+  8033c1:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8033c2:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8033c3:	20 69 6e             	and    %ch,0x6e(%rcx)
+  8033c6:	74 65                	je     80342d <__rodata_start+0x2c5>
+  8033c8:	72 72                	jb     80343c <__rodata_start+0x2d4>
+  8033ca:	75 70                	jne    80343c <__rodata_start+0x2d4>
+  8033cc:	74 65                	je     803433 <__rodata_start+0x2cb>
+  8033ce:	64 00 6e 6f          	add    %ch,%fs:0x6f(%rsi)
+  8033d2:	74 20                	je     8033f4 <__rodata_start+0x28c>
+  8033d4:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  8033d6:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8033d7:	75 67                	jne    803440 <__rodata_start+0x2d8>
+  8033d9:	68 20 43 50 55       	push   $0x55504320
+  8033de:	20 74 69 6d          	and    %dh,0x6d(%rcx,%rbp,2)
+  8033e2:	65 00 66 2e          	add    %ah,%gs:0x2e(%rsi)
+  8033e6:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+  8033ed:	00 
+  8033ee:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8033f5:	00 00 00 
+  8033f8:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+  8033ff:	00 
+  803400:	0a 07                	or     (%rdi),%al
+  803402:	80 00 00             	addb   $0x0,(%rax)
+  803405:	00 00                	add    %al,(%rax)
+  803407:	00 4b 0d             	add    %cl,0xd(%rbx)
+  80340a:	80 00 00             	addb   $0x0,(%rax)
+  80340d:	00 00                	add    %al,(%rax)
+  80340f:	00 3b                	add    %bh,(%rbx)
+  803411:	0d 80 00 00 00       	or     $0x80,%eax
+  803416:	00 00                	add    %al,(%rax)
+  803418:	4b 0d 80 00 00 00    	rex.WXB or $0x80,%rax
+  80341e:	00 00                	add    %al,(%rax)
+  803420:	4b 0d 80 00 00 00    	rex.WXB or $0x80,%rax
+  803426:	00 00                	add    %al,(%rax)
+  803428:	4b 0d 80 00 00 00    	rex.WXB or $0x80,%rax
+  80342e:	00 00                	add    %al,(%rax)
+  803430:	4b 0d 80 00 00 00    	rex.WXB or $0x80,%rax
+  803436:	00 00                	add    %al,(%rax)
+  803438:	29 07                	sub    %eax,(%rdi)
+  80343a:	80 00 00             	addb   $0x0,(%rax)
+  80343d:	00 00                	add    %al,(%rax)
+  80343f:	00 4b 0d             	add    %cl,0xd(%rbx)
+  803442:	80 00 00             	addb   $0x0,(%rax)
+  803445:	00 00                	add    %al,(%rax)
+  803447:	00 4b 0d             	add    %cl,0xd(%rbx)
+  80344a:	80 00 00             	addb   $0x0,(%rax)
+  80344d:	00 00                	add    %al,(%rax)
+  80344f:	00 1d 07 80 00 00    	add    %bl,0x8007(%rip)        # 80b45c <__bss_end+0x345c>
+  803455:	00 00                	add    %al,(%rax)
+  803457:	00 97 07 80 00 00    	add    %dl,0x8007(%rdi)
+  80345d:	00 00                	add    %al,(%rax)
+  80345f:	00 4b 0d             	add    %cl,0xd(%rbx)
+  803462:	80 00 00             	addb   $0x0,(%rax)
+  803465:	00 00                	add    %al,(%rax)
+  803467:	00 1d 07 80 00 00    	add    %bl,0x8007(%rip)        # 80b474 <__bss_end+0x3474>
+  80346d:	00 00                	add    %al,(%rax)
+  80346f:	00 63 07             	add    %ah,0x7(%rbx)
+  803472:	80 00 00             	addb   $0x0,(%rax)
+  803475:	00 00                	add    %al,(%rax)
+  803477:	00 63 07             	add    %ah,0x7(%rbx)
+  80347a:	80 00 00             	addb   $0x0,(%rax)
+  80347d:	00 00                	add    %al,(%rax)
+  80347f:	00 63 07             	add    %ah,0x7(%rbx)
+  803482:	80 00 00             	addb   $0x0,(%rax)
+  803485:	00 00                	add    %al,(%rax)
+  803487:	00 63 07             	add    %ah,0x7(%rbx)
+  80348a:	80 00 00             	addb   $0x0,(%rax)
+  80348d:	00 00                	add    %al,(%rax)
+  80348f:	00 63 07             	add    %ah,0x7(%rbx)
+  803492:	80 00 00             	addb   $0x0,(%rax)
+  803495:	00 00                	add    %al,(%rax)
+  803497:	00 63 07             	add    %ah,0x7(%rbx)
+  80349a:	80 00 00             	addb   $0x0,(%rax)
+  80349d:	00 00                	add    %al,(%rax)
+  80349f:	00 63 07             	add    %ah,0x7(%rbx)
+  8034a2:	80 00 00             	addb   $0x0,(%rax)
+  8034a5:	00 00                	add    %al,(%rax)
+  8034a7:	00 63 07             	add    %ah,0x7(%rbx)
+  8034aa:	80 00 00             	addb   $0x0,(%rax)
+  8034ad:	00 00                	add    %al,(%rax)
+  8034af:	00 63 07             	add    %ah,0x7(%rbx)
+  8034b2:	80 00 00             	addb   $0x0,(%rax)
+  8034b5:	00 00                	add    %al,(%rax)
+  8034b7:	00 4b 0d             	add    %cl,0xd(%rbx)
+  8034ba:	80 00 00             	addb   $0x0,(%rax)
+  8034bd:	00 00                	add    %al,(%rax)
+  8034bf:	00 4b 0d             	add    %cl,0xd(%rbx)
+  8034c2:	80 00 00             	addb   $0x0,(%rax)
+  8034c5:	00 00                	add    %al,(%rax)
+  8034c7:	00 4b 0d             	add    %cl,0xd(%rbx)
+  8034ca:	80 00 00             	addb   $0x0,(%rax)
+  8034cd:	00 00                	add    %al,(%rax)
+  8034cf:	00 4b 0d             	add    %cl,0xd(%rbx)
+  8034d2:	80 00 00             	addb   $0x0,(%rax)
+  8034d5:	00 00                	add    %al,(%rax)
+  8034d7:	00 4b 0d             	add    %cl,0xd(%rbx)
+  8034da:	80 00 00             	addb   $0x0,(%rax)
+  8034dd:	00 00                	add    %al,(%rax)
+  8034df:	00 4b 0d             	add    %cl,0xd(%rbx)
+  8034e2:	80 00 00             	addb   $0x0,(%rax)
+  8034e5:	00 00                	add    %al,(%rax)
+  8034e7:	00 4b 0d             	add    %cl,0xd(%rbx)
+  8034ea:	80 00 00             	addb   $0x0,(%rax)
+  8034ed:	00 00                	add    %al,(%rax)
+  8034ef:	00 4b 0d             	add    %cl,0xd(%rbx)
+  8034f2:	80 00 00             	addb   $0x0,(%rax)
+  8034f5:	00 00                	add    %al,(%rax)
+  8034f7:	00 4b 0d             	add    %cl,0xd(%rbx)
+  8034fa:	80 00 00             	addb   $0x0,(%rax)
+  8034fd:	00 00                	add    %al,(%rax)
+  8034ff:	00 4b 0d             	add    %cl,0xd(%rbx)
+  803502:	80 00 00             	addb   $0x0,(%rax)
+  803505:	00 00                	add    %al,(%rax)
+  803507:	00 4b 0d             	add    %cl,0xd(%rbx)
+  80350a:	80 00 00             	addb   $0x0,(%rax)
+  80350d:	00 00                	add    %al,(%rax)
+  80350f:	00 4b 0d             	add    %cl,0xd(%rbx)
+  803512:	80 00 00             	addb   $0x0,(%rax)
+  803515:	00 00                	add    %al,(%rax)
+  803517:	00 4b 0d             	add    %cl,0xd(%rbx)
+  80351a:	80 00 00             	addb   $0x0,(%rax)
+  80351d:	00 00                	add    %al,(%rax)
+  80351f:	00 4b 0d             	add    %cl,0xd(%rbx)
+  803522:	80 00 00             	addb   $0x0,(%rax)
+  803525:	00 00                	add    %al,(%rax)
+  803527:	00 4b 0d             	add    %cl,0xd(%rbx)
+  80352a:	80 00 00             	addb   $0x0,(%rax)
+  80352d:	00 00                	add    %al,(%rax)
+  80352f:	00 4b 0d             	add    %cl,0xd(%rbx)
+  803532:	80 00 00             	addb   $0x0,(%rax)
+  803535:	00 00                	add    %al,(%rax)
+  803537:	00 4b 0d             	add    %cl,0xd(%rbx)
+  80353a:	80 00 00             	addb   $0x0,(%rax)
+  80353d:	00 00                	add    %al,(%rax)
+  80353f:	00 4b 0d             	add    %cl,0xd(%rbx)
+  803542:	80 00 00             	addb   $0x0,(%rax)
+  803545:	00 00                	add    %al,(%rax)
+  803547:	00 4b 0d             	add    %cl,0xd(%rbx)
+  80354a:	80 00 00             	addb   $0x0,(%rax)
+  80354d:	00 00                	add    %al,(%rax)
+  80354f:	00 4b 0d             	add    %cl,0xd(%rbx)
+  803552:	80 00 00             	addb   $0x0,(%rax)
+  803555:	00 00                	add    %al,(%rax)
+  803557:	00 4b 0d             	add    %cl,0xd(%rbx)
+  80355a:	80 00 00             	addb   $0x0,(%rax)
+  80355d:	00 00                	add    %al,(%rax)
+  80355f:	00 4b 0d             	add    %cl,0xd(%rbx)
+  803562:	80 00 00             	addb   $0x0,(%rax)
+  803565:	00 00                	add    %al,(%rax)
+  803567:	00 4b 0d             	add    %cl,0xd(%rbx)
+  80356a:	80 00 00             	addb   $0x0,(%rax)
+  80356d:	00 00                	add    %al,(%rax)
+  80356f:	00 4b 0d             	add    %cl,0xd(%rbx)
+  803572:	80 00 00             	addb   $0x0,(%rax)
+  803575:	00 00                	add    %al,(%rax)
+  803577:	00 4b 0d             	add    %cl,0xd(%rbx)
+  80357a:	80 00 00             	addb   $0x0,(%rax)
+  80357d:	00 00                	add    %al,(%rax)
+  80357f:	00 4b 0d             	add    %cl,0xd(%rbx)
+  803582:	80 00 00             	addb   $0x0,(%rax)
+  803585:	00 00                	add    %al,(%rax)
+  803587:	00 4b 0d             	add    %cl,0xd(%rbx)
+  80358a:	80 00 00             	addb   $0x0,(%rax)
+  80358d:	00 00                	add    %al,(%rax)
+  80358f:	00 4b 0d             	add    %cl,0xd(%rbx)
+  803592:	80 00 00             	addb   $0x0,(%rax)
+  803595:	00 00                	add    %al,(%rax)
+  803597:	00 4b 0d             	add    %cl,0xd(%rbx)
+  80359a:	80 00 00             	addb   $0x0,(%rax)
+  80359d:	00 00                	add    %al,(%rax)
+  80359f:	00 4b 0d             	add    %cl,0xd(%rbx)
+  8035a2:	80 00 00             	addb   $0x0,(%rax)
+  8035a5:	00 00                	add    %al,(%rax)
+  8035a7:	00 6e 0c             	add    %ch,0xc(%rsi)
+  8035aa:	80 00 00             	addb   $0x0,(%rax)
+  8035ad:	00 00                	add    %al,(%rax)
+  8035af:	00 4b 0d             	add    %cl,0xd(%rbx)
+  8035b2:	80 00 00             	addb   $0x0,(%rax)
+  8035b5:	00 00                	add    %al,(%rax)
+  8035b7:	00 4b 0d             	add    %cl,0xd(%rbx)
+  8035ba:	80 00 00             	addb   $0x0,(%rax)
+  8035bd:	00 00                	add    %al,(%rax)
+  8035bf:	00 4b 0d             	add    %cl,0xd(%rbx)
+  8035c2:	80 00 00             	addb   $0x0,(%rax)
+  8035c5:	00 00                	add    %al,(%rax)
+  8035c7:	00 4b 0d             	add    %cl,0xd(%rbx)
+  8035ca:	80 00 00             	addb   $0x0,(%rax)
+  8035cd:	00 00                	add    %al,(%rax)
+  8035cf:	00 4b 0d             	add    %cl,0xd(%rbx)
+  8035d2:	80 00 00             	addb   $0x0,(%rax)
+  8035d5:	00 00                	add    %al,(%rax)
+  8035d7:	00 4b 0d             	add    %cl,0xd(%rbx)
+  8035da:	80 00 00             	addb   $0x0,(%rax)
+  8035dd:	00 00                	add    %al,(%rax)
+  8035df:	00 4b 0d             	add    %cl,0xd(%rbx)
+  8035e2:	80 00 00             	addb   $0x0,(%rax)
+  8035e5:	00 00                	add    %al,(%rax)
+  8035e7:	00 4b 0d             	add    %cl,0xd(%rbx)
+  8035ea:	80 00 00             	addb   $0x0,(%rax)
+  8035ed:	00 00                	add    %al,(%rax)
+  8035ef:	00 4b 0d             	add    %cl,0xd(%rbx)
+  8035f2:	80 00 00             	addb   $0x0,(%rax)
+  8035f5:	00 00                	add    %al,(%rax)
+  8035f7:	00 4b 0d             	add    %cl,0xd(%rbx)
+  8035fa:	80 00 00             	addb   $0x0,(%rax)
+  8035fd:	00 00                	add    %al,(%rax)
+  8035ff:	00 ba 07 80 00 00    	add    %bh,0x8007(%rdx)
+  803605:	00 00                	add    %al,(%rax)
+  803607:	00 89 09 80 00 00    	add    %cl,0x8009(%rcx)
+  80360d:	00 00                	add    %al,(%rax)
+  80360f:	00 4b 0d             	add    %cl,0xd(%rbx)
+  803612:	80 00 00             	addb   $0x0,(%rax)
+  803615:	00 00                	add    %al,(%rax)
+  803617:	00 4b 0d             	add    %cl,0xd(%rbx)
+  80361a:	80 00 00             	addb   $0x0,(%rax)
+  80361d:	00 00                	add    %al,(%rax)
+  80361f:	00 4b 0d             	add    %cl,0xd(%rbx)
+  803622:	80 00 00             	addb   $0x0,(%rax)
+  803625:	00 00                	add    %al,(%rax)
+  803627:	00 4b 0d             	add    %cl,0xd(%rbx)
+  80362a:	80 00 00             	addb   $0x0,(%rax)
+  80362d:	00 00                	add    %al,(%rax)
+  80362f:	00 e9                	add    %ch,%cl
+  803631:	07                   	(bad)
+  803632:	80 00 00             	addb   $0x0,(%rax)
+  803635:	00 00                	add    %al,(%rax)
+  803637:	00 4b 0d             	add    %cl,0xd(%rbx)
+  80363a:	80 00 00             	addb   $0x0,(%rax)
+  80363d:	00 00                	add    %al,(%rax)
+  80363f:	00 4b 0d             	add    %cl,0xd(%rbx)
+  803642:	80 00 00             	addb   $0x0,(%rax)
+  803645:	00 00                	add    %al,(%rax)
+  803647:	00 af 07 80 00 00    	add    %ch,0x8007(%rdi)
+  80364d:	00 00                	add    %al,(%rax)
+  80364f:	00 4b 0d             	add    %cl,0xd(%rbx)
+  803652:	80 00 00             	addb   $0x0,(%rax)
+  803655:	00 00                	add    %al,(%rax)
+  803657:	00 4b 0d             	add    %cl,0xd(%rbx)
+  80365a:	80 00 00             	addb   $0x0,(%rax)
+  80365d:	00 00                	add    %al,(%rax)
+  80365f:	00 31                	add    %dh,(%rcx)
+  803661:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803667:	00 fb                	add    %bh,%bl
+  803669:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  80366f:	00 4b 0d             	add    %cl,0xd(%rbx)
+  803672:	80 00 00             	addb   $0x0,(%rax)
+  803675:	00 00                	add    %al,(%rax)
+  803677:	00 4b 0d             	add    %cl,0xd(%rbx)
+  80367a:	80 00 00             	addb   $0x0,(%rax)
+  80367d:	00 00                	add    %al,(%rax)
+  80367f:	00 80 08 80 00 00    	add    %al,0x8008(%rax)
+  803685:	00 00                	add    %al,(%rax)
+  803687:	00 4b 0d             	add    %cl,0xd(%rbx)
+  80368a:	80 00 00             	addb   $0x0,(%rax)
+  80368d:	00 00                	add    %al,(%rax)
+  80368f:	00 5d 0a             	add    %bl,0xa(%rbp)
+  803692:	80 00 00             	addb   $0x0,(%rax)
+  803695:	00 00                	add    %al,(%rax)
+  803697:	00 4b 0d             	add    %cl,0xd(%rbx)
+  80369a:	80 00 00             	addb   $0x0,(%rax)
+  80369d:	00 00                	add    %al,(%rax)
+  80369f:	00 4b 0d             	add    %cl,0xd(%rbx)
+  8036a2:	80 00 00             	addb   $0x0,(%rax)
+  8036a5:	00 00                	add    %al,(%rax)
+  8036a7:	00 6e 0c             	add    %ch,0xc(%rsi)
+  8036aa:	80 00 00             	addb   $0x0,(%rax)
+  8036ad:	00 00                	add    %al,(%rax)
+  8036af:	00 4b 0d             	add    %cl,0xd(%rbx)
+  8036b2:	80 00 00             	addb   $0x0,(%rax)
+  8036b5:	00 00                	add    %al,(%rax)
+  8036b7:	00 13                	add    %dl,(%rbx)
+  8036b9:	07                   	(bad)
+  8036ba:	80 00 00             	addb   $0x0,(%rax)
+  8036bd:	00 00                	add    %al,(%rax)
+	...
+
+00000000008036c0 <error_string>:
+	...
+  8036c8:	5d 32 80 00 00 00 00 00 6f 32 80 00 00 00 00 00     ]2......o2......
+  8036d8:	7f 32 80 00 00 00 00 00 91 32 80 00 00 00 00 00     .2.......2......
+  8036e8:	9f 32 80 00 00 00 00 00 b3 32 80 00 00 00 00 00     .2.......2......
+  8036f8:	c8 32 80 00 00 00 00 00 db 32 80 00 00 00 00 00     .2.......2......
+  803708:	ed 32 80 00 00 00 00 00 01 33 80 00 00 00 00 00     .2.......3......
+  803718:	11 33 80 00 00 00 00 00 24 33 80 00 00 00 00 00     .3......$3......
+  803728:	3b 33 80 00 00 00 00 00 51 33 80 00 00 00 00 00     ;3......Q3......
+  803738:	69 33 80 00 00 00 00 00 81 33 80 00 00 00 00 00     i3.......3......
+  803748:	8e 33 80 00 00 00 00 00 70 37 80 00 00 00 00 00     .3......p7......
+  803758:	a2 33 80 00 00 00 00 00 ba 33 80 00 00 00 00 00     .3.......3......
+  803768:	d0 33 80 00 00 00 00 00 66 69 6c 65 20 69 73 20     .3......file is 
+  803778:	6e 6f 74 20 61 20 76 61 6c 69 64 20 65 78 65 63     not a valid exec
+  803788:	75 74 61 62 6c 65 00 90 73 79 73 63 61 6c 6c 20     utable..syscall 
+  803798:	25 7a 64 20 72 65 74 75 72 6e 65 64 20 25 7a 64     %zd returned %zd
+  8037a8:	20 28 3e 20 30 29 00 6c 69 62 2f 73 79 73 63 61      (> 0).lib/sysca
+  8037b8:	6c 6c 2e 63 00 46 6f 72 6b 20 64 6f 75 62 6c 65     ll.c.Fork double
+  8037c8:	20 66 61 75 6c 74 00 6c 69 62 2f 66 6f 72 6b 2e      fault.lib/fork.
+  8037d8:	63 00 73 66 6f 72 6b 28 29 20 69 73 20 6e 6f 74     c.sfork() is not
+  8037e8:	20 69 6d 70 6c 65 6d 65 6e 74 65 64 00 73 79 73      implemented.sys
+  8037f8:	5f 69 70 63 5f 74 72 79 5f 73 65 6e 64 20 66 61     _ipc_try_send fa
+  803808:	69 6c 65 64 3a 20 25 69 00 6c 69 62 2f 69 70 63     iled: %i.lib/ipc
+  803818:	2e 63 00 0f 1f 44 00 00 5b 25 30 38 78 5d 20 75     .c...D..[%08x] u
+  803828:	6e 6b 6e 6f 77 6e 20 64 65 76 69 63 65 20 74 79     nknown device ty
+  803838:	70 65 20 25 64 0a 00 00 5b 25 30 38 78 5d 20 66     pe %d...[%08x] f
+  803848:	74 72 75 6e 63 61 74 65 20 25 64 20 2d 2d 20 62     truncate %d -- b
+  803858:	61 64 20 6d 6f 64 65 0a 00 5b 25 30 38 78 5d 20     ad mode..[%08x] 
+  803868:	72 65 61 64 20 25 64 20 2d 2d 20 62 61 64 20 6d     read %d -- bad m
+  803878:	6f 64 65 0a 00 5b 25 30 38 78 5d 20 77 72 69 74     ode..[%08x] writ
+  803888:	65 20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65     e %d -- bad mode
+  803898:	0a 00 66 0f 1f 44 00 00                             ..f..D..
+
+00000000008038a0 <devtab>:
+  8038a0:	20 40 80 00 00 00 00 00 60 40 80 00 00 00 00 00      @......`@......
+  8038b0:	a0 40 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .@..............
+  8038c0:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  8038d0:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  8038e0:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  8038f0:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  803900:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  803910:	3d 20 32 00 65 6e 76 69 64 20 21 3d 20 30 00 6c     = 2.envid != 0.l
+  803920:	69 62 2f 77 61 69 74 2e 63 00 3c 63 6f 6e 73 3e     ib/wait.c.<cons>
+  803930:	00 63 6f 6e 73 00 66 2e 0f 1f 84 00 00 00 00 00     .cons.f.........
+  803940:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803950:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803960:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803970:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803980:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803990:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8039a0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8039b0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8039c0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8039d0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8039e0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8039f0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803a00:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803a10:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803a20:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803a30:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803a40:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803a50:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803a60:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803a70:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803a80:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803a90:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803aa0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803ab0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803ac0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803ad0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803ae0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803af0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803b00:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803b10:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803b20:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803b30:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803b40:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803b50:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803b60:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803b70:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803b80:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803b90:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803ba0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803bb0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803bc0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803bd0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803be0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803bf0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803c00:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803c10:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803c20:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803c30:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803c40:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803c50:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803c60:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803c70:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803c80:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803c90:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803ca0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803cb0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803cc0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803cd0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803ce0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803cf0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803d00:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803d10:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803d20:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803d30:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803d40:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803d50:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803d60:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803d70:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803d80:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803d90:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803da0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803db0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803dc0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803dd0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803de0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803df0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803e00:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803e10:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803e20:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803e30:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803e40:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803e50:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803e60:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803e70:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803e80:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803e90:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803ea0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803eb0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803ec0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803ed0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803ee0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803ef0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803f00:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803f10:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803f20:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803f30:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803f40:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803f50:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803f60:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803f70:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803f80:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803f90:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803fa0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803fb0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803fc0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803fd0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803fe0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803ff0:	0f 1f 84 00 00 00 00 00 0f 1f 84 00 00 00 00 00     ................
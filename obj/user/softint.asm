@@ -0,0 +1,5434 @@
+
+obj/user/softint:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 05 00 00 00       	call   800028 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+    asm volatile("int $14"); /* page fault */
+  800025:	cd 0e                	int    $0xe
+}
+  800027:	c3                   	ret
+
+0000000000800028 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800028:	55                   	push   %rbp
+  800029:	48 89 e5             	mov    %rsp,%rbp
+  80002c:	41 56                	push   %r14
+  80002e:	41 55                	push   %r13
+  800030:	41 54                	push   %r12
+  800032:	53                   	push   %rbx
+  800033:	41 89 fd             	mov    %edi,%r13d
+  800036:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800039:	48 ba d8 40 80 00 00 	movabs $0x8040d8,%rdx
+  800040:	00 00 00 
+  800043:	48 b8 d8 40 80 00 00 	movabs $0x8040d8,%rax
+  80004a:	00 00 00 
+  80004d:	48 39 c2             	cmp    %rax,%rdx
+  800050:	73 17                	jae    800069 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  800052:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  800055:	49 89 c4             	mov    %rax,%r12
+  800058:	48 83 c3 08          	add    $0x8,%rbx
+  80005c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800061:	ff 53 f8             	call   *-0x8(%rbx)
+  800064:	4c 39 e3             	cmp    %r12,%rbx
+  800067:	72 ef                	jb     800058 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+    envid_t this_env_id = sys_getenvid();
+  800069:	48 b8 bd 01 80 00 00 	movabs $0x8001bd,%rax
+  800070:	00 00 00 
+  800073:	ff d0                	call   *%rax
+    thisenv = &((struct Env*)UENVS)[ENVX(this_env_id)];
+  800075:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80007a:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+  800081:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  800088:	00 00 00 
+  80008b:	48 01 d0             	add    %rdx,%rax
+  80008e:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  800095:	00 00 00 
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  800098:	45 85 ed             	test   %r13d,%r13d
+  80009b:	7e 0d                	jle    8000aa <libmain+0x82>
+  80009d:	49 8b 06             	mov    (%r14),%rax
+  8000a0:	48 a3 00 40 80 00 00 	movabs %rax,0x804000
+  8000a7:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8000aa:	4c 89 f6             	mov    %r14,%rsi
+  8000ad:	44 89 ef             	mov    %r13d,%edi
+  8000b0:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8000b7:	00 00 00 
+  8000ba:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8000bc:	48 b8 d1 00 80 00 00 	movabs $0x8000d1,%rax
+  8000c3:	00 00 00 
+  8000c6:	ff d0                	call   *%rax
+#endif
+}
+  8000c8:	5b                   	pop    %rbx
+  8000c9:	41 5c                	pop    %r12
+  8000cb:	41 5d                	pop    %r13
+  8000cd:	41 5e                	pop    %r14
+  8000cf:	5d                   	pop    %rbp
+  8000d0:	c3                   	ret
+
+00000000008000d1 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8000d1:	55                   	push   %rbp
+  8000d2:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  8000d5:	48 b8 11 09 80 00 00 	movabs $0x800911,%rax
+  8000dc:	00 00 00 
+  8000df:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  8000e1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8000e6:	48 b8 52 01 80 00 00 	movabs $0x800152,%rax
+  8000ed:	00 00 00 
+  8000f0:	ff d0                	call   *%rax
+}
+  8000f2:	5d                   	pop    %rbp
+  8000f3:	c3                   	ret
+
+00000000008000f4 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  8000f4:	55                   	push   %rbp
+  8000f5:	48 89 e5             	mov    %rsp,%rbp
+  8000f8:	53                   	push   %rbx
+  8000f9:	48 89 fa             	mov    %rdi,%rdx
+  8000fc:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8000ff:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800104:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800109:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80010e:	be 00 00 00 00       	mov    $0x0,%esi
+  800113:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800119:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  80011b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80011f:	c9                   	leave
+  800120:	c3                   	ret
+
+0000000000800121 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  800121:	55                   	push   %rbp
+  800122:	48 89 e5             	mov    %rsp,%rbp
+  800125:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  800126:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80012b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800130:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800135:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80013a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80013f:	be 00 00 00 00       	mov    $0x0,%esi
+  800144:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80014a:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  80014c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800150:	c9                   	leave
+  800151:	c3                   	ret
+
+0000000000800152 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  800152:	55                   	push   %rbp
+  800153:	48 89 e5             	mov    %rsp,%rbp
+  800156:	53                   	push   %rbx
+  800157:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  80015b:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80015e:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800163:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800168:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80016d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800172:	be 00 00 00 00       	mov    $0x0,%esi
+  800177:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80017d:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80017f:	48 85 c0             	test   %rax,%rax
+  800182:	7f 06                	jg     80018a <sys_env_destroy+0x38>
+}
+  800184:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800188:	c9                   	leave
+  800189:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80018a:	49 89 c0             	mov    %rax,%r8
+  80018d:	b9 03 00 00 00       	mov    $0x3,%ecx
+  800192:	48 ba 88 2c 80 00 00 	movabs $0x802c88,%rdx
+  800199:	00 00 00 
+  80019c:	be 26 00 00 00       	mov    $0x26,%esi
+  8001a1:	48 bf a7 2c 80 00 00 	movabs $0x802ca7,%rdi
+  8001a8:	00 00 00 
+  8001ab:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001b0:	49 b9 0e 1c 80 00 00 	movabs $0x801c0e,%r9
+  8001b7:	00 00 00 
+  8001ba:	41 ff d1             	call   *%r9
+
+00000000008001bd <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  8001bd:	55                   	push   %rbp
+  8001be:	48 89 e5             	mov    %rsp,%rbp
+  8001c1:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8001c2:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8001c7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8001cc:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8001d1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8001d6:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8001db:	be 00 00 00 00       	mov    $0x0,%esi
+  8001e0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8001e6:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  8001e8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8001ec:	c9                   	leave
+  8001ed:	c3                   	ret
+
+00000000008001ee <sys_yield>:
+
+void
+sys_yield(void) {
+  8001ee:	55                   	push   %rbp
+  8001ef:	48 89 e5             	mov    %rsp,%rbp
+  8001f2:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8001f3:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8001f8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8001fd:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800202:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800207:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80020c:	be 00 00 00 00       	mov    $0x0,%esi
+  800211:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800217:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  800219:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80021d:	c9                   	leave
+  80021e:	c3                   	ret
+
+000000000080021f <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  80021f:	55                   	push   %rbp
+  800220:	48 89 e5             	mov    %rsp,%rbp
+  800223:	53                   	push   %rbx
+  800224:	48 89 fa             	mov    %rdi,%rdx
+  800227:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80022a:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80022f:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  800236:	00 00 00 
+  800239:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80023e:	be 00 00 00 00       	mov    $0x0,%esi
+  800243:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800249:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  80024b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80024f:	c9                   	leave
+  800250:	c3                   	ret
+
+0000000000800251 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  800251:	55                   	push   %rbp
+  800252:	48 89 e5             	mov    %rsp,%rbp
+  800255:	53                   	push   %rbx
+  800256:	49 89 f8             	mov    %rdi,%r8
+  800259:	48 89 d3             	mov    %rdx,%rbx
+  80025c:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80025f:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800264:	4c 89 c2             	mov    %r8,%rdx
+  800267:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80026a:	be 00 00 00 00       	mov    $0x0,%esi
+  80026f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800275:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  800277:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80027b:	c9                   	leave
+  80027c:	c3                   	ret
+
+000000000080027d <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  80027d:	55                   	push   %rbp
+  80027e:	48 89 e5             	mov    %rsp,%rbp
+  800281:	53                   	push   %rbx
+  800282:	48 83 ec 08          	sub    $0x8,%rsp
+  800286:	89 f8                	mov    %edi,%eax
+  800288:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  80028b:	48 63 f9             	movslq %ecx,%rdi
+  80028e:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800291:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800296:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800299:	be 00 00 00 00       	mov    $0x0,%esi
+  80029e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8002a4:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8002a6:	48 85 c0             	test   %rax,%rax
+  8002a9:	7f 06                	jg     8002b1 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  8002ab:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8002af:	c9                   	leave
+  8002b0:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8002b1:	49 89 c0             	mov    %rax,%r8
+  8002b4:	b9 04 00 00 00       	mov    $0x4,%ecx
+  8002b9:	48 ba 88 2c 80 00 00 	movabs $0x802c88,%rdx
+  8002c0:	00 00 00 
+  8002c3:	be 26 00 00 00       	mov    $0x26,%esi
+  8002c8:	48 bf a7 2c 80 00 00 	movabs $0x802ca7,%rdi
+  8002cf:	00 00 00 
+  8002d2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002d7:	49 b9 0e 1c 80 00 00 	movabs $0x801c0e,%r9
+  8002de:	00 00 00 
+  8002e1:	41 ff d1             	call   *%r9
+
+00000000008002e4 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8002e4:	55                   	push   %rbp
+  8002e5:	48 89 e5             	mov    %rsp,%rbp
+  8002e8:	53                   	push   %rbx
+  8002e9:	48 83 ec 08          	sub    $0x8,%rsp
+  8002ed:	89 f8                	mov    %edi,%eax
+  8002ef:	49 89 f2             	mov    %rsi,%r10
+  8002f2:	48 89 cf             	mov    %rcx,%rdi
+  8002f5:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  8002f8:	48 63 da             	movslq %edx,%rbx
+  8002fb:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8002fe:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800303:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800306:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  800309:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80030b:	48 85 c0             	test   %rax,%rax
+  80030e:	7f 06                	jg     800316 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  800310:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800314:	c9                   	leave
+  800315:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800316:	49 89 c0             	mov    %rax,%r8
+  800319:	b9 05 00 00 00       	mov    $0x5,%ecx
+  80031e:	48 ba 88 2c 80 00 00 	movabs $0x802c88,%rdx
+  800325:	00 00 00 
+  800328:	be 26 00 00 00       	mov    $0x26,%esi
+  80032d:	48 bf a7 2c 80 00 00 	movabs $0x802ca7,%rdi
+  800334:	00 00 00 
+  800337:	b8 00 00 00 00       	mov    $0x0,%eax
+  80033c:	49 b9 0e 1c 80 00 00 	movabs $0x801c0e,%r9
+  800343:	00 00 00 
+  800346:	41 ff d1             	call   *%r9
+
+0000000000800349 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  800349:	55                   	push   %rbp
+  80034a:	48 89 e5             	mov    %rsp,%rbp
+  80034d:	53                   	push   %rbx
+  80034e:	48 83 ec 08          	sub    $0x8,%rsp
+  800352:	48 89 f1             	mov    %rsi,%rcx
+  800355:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  800358:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80035b:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800360:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800365:	be 00 00 00 00       	mov    $0x0,%esi
+  80036a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800370:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800372:	48 85 c0             	test   %rax,%rax
+  800375:	7f 06                	jg     80037d <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  800377:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80037b:	c9                   	leave
+  80037c:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80037d:	49 89 c0             	mov    %rax,%r8
+  800380:	b9 06 00 00 00       	mov    $0x6,%ecx
+  800385:	48 ba 88 2c 80 00 00 	movabs $0x802c88,%rdx
+  80038c:	00 00 00 
+  80038f:	be 26 00 00 00       	mov    $0x26,%esi
+  800394:	48 bf a7 2c 80 00 00 	movabs $0x802ca7,%rdi
+  80039b:	00 00 00 
+  80039e:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003a3:	49 b9 0e 1c 80 00 00 	movabs $0x801c0e,%r9
+  8003aa:	00 00 00 
+  8003ad:	41 ff d1             	call   *%r9
+
+00000000008003b0 <sys_region_batch>:
+
+int
+sys_region_batch(const struct RegionOp *ops, size_t count) {
+  8003b0:	55                   	push   %rbp
+  8003b1:	48 89 e5             	mov    %rsp,%rbp
+  8003b4:	53                   	push   %rbx
+  8003b5:	48 83 ec 08          	sub    $0x8,%rsp
+  8003b9:	48 89 fa             	mov    %rdi,%rdx
+  8003bc:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8003bf:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8003c4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8003c9:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8003ce:	be 00 00 00 00       	mov    $0x0,%esi
+  8003d3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8003d9:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8003db:	48 85 c0             	test   %rax,%rax
+  8003de:	7f 06                	jg     8003e6 <sys_region_batch+0x36>
+        else
+            platform_asan_unpoison(va, ops[i].size);
+    }
+#endif
+    return res;
+}
+  8003e0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8003e4:	c9                   	leave
+  8003e5:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8003e6:	49 89 c0             	mov    %rax,%r8
+  8003e9:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  8003ee:	48 ba 88 2c 80 00 00 	movabs $0x802c88,%rdx
+  8003f5:	00 00 00 
+  8003f8:	be 26 00 00 00       	mov    $0x26,%esi
+  8003fd:	48 bf a7 2c 80 00 00 	movabs $0x802ca7,%rdi
+  800404:	00 00 00 
+  800407:	b8 00 00 00 00       	mov    $0x0,%eax
+  80040c:	49 b9 0e 1c 80 00 00 	movabs $0x801c0e,%r9
+  800413:	00 00 00 
+  800416:	41 ff d1             	call   *%r9
+
+0000000000800419 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  800419:	55                   	push   %rbp
+  80041a:	48 89 e5             	mov    %rsp,%rbp
+  80041d:	53                   	push   %rbx
+  80041e:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  800422:	48 63 ce             	movslq %esi,%rcx
+  800425:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800428:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80042d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800432:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800437:	be 00 00 00 00       	mov    $0x0,%esi
+  80043c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800442:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800444:	48 85 c0             	test   %rax,%rax
+  800447:	7f 06                	jg     80044f <sys_env_set_status+0x36>
+}
+  800449:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80044d:	c9                   	leave
+  80044e:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80044f:	49 89 c0             	mov    %rax,%r8
+  800452:	b9 09 00 00 00       	mov    $0x9,%ecx
+  800457:	48 ba 88 2c 80 00 00 	movabs $0x802c88,%rdx
+  80045e:	00 00 00 
+  800461:	be 26 00 00 00       	mov    $0x26,%esi
+  800466:	48 bf a7 2c 80 00 00 	movabs $0x802ca7,%rdi
+  80046d:	00 00 00 
+  800470:	b8 00 00 00 00       	mov    $0x0,%eax
+  800475:	49 b9 0e 1c 80 00 00 	movabs $0x801c0e,%r9
+  80047c:	00 00 00 
+  80047f:	41 ff d1             	call   *%r9
+
+0000000000800482 <sys_env_set_weight>:
+
+int
+sys_env_set_weight(envid_t envid, uint32_t weight) {
+  800482:	55                   	push   %rbp
+  800483:	48 89 e5             	mov    %rsp,%rbp
+  800486:	53                   	push   %rbx
+  800487:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_weight, 1, envid, weight, 0, 0, 0, 0);
+  80048b:	89 f1                	mov    %esi,%ecx
+  80048d:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800490:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800495:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80049a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80049f:	be 00 00 00 00       	mov    $0x0,%esi
+  8004a4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8004aa:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8004ac:	48 85 c0             	test   %rax,%rax
+  8004af:	7f 06                	jg     8004b7 <sys_env_set_weight+0x35>
+}
+  8004b1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8004b5:	c9                   	leave
+  8004b6:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8004b7:	49 89 c0             	mov    %rax,%r8
+  8004ba:	b9 10 00 00 00       	mov    $0x10,%ecx
+  8004bf:	48 ba 88 2c 80 00 00 	movabs $0x802c88,%rdx
+  8004c6:	00 00 00 
+  8004c9:	be 26 00 00 00       	mov    $0x26,%esi
+  8004ce:	48 bf a7 2c 80 00 00 	movabs $0x802ca7,%rdi
+  8004d5:	00 00 00 
+  8004d8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004dd:	49 b9 0e 1c 80 00 00 	movabs $0x801c0e,%r9
+  8004e4:	00 00 00 
+  8004e7:	41 ff d1             	call   *%r9
+
+00000000008004ea <sys_env_set_rt>:
+
+int
+sys_env_set_rt(envid_t envid, uint64_t period, uint64_t budget, uint64_t deadline) {
+  8004ea:	55                   	push   %rbp
+  8004eb:	48 89 e5             	mov    %rsp,%rbp
+  8004ee:	53                   	push   %rbx
+  8004ef:	48 83 ec 08          	sub    $0x8,%rsp
+  8004f3:	89 f8                	mov    %edi,%eax
+  8004f5:	48 89 d3             	mov    %rdx,%rbx
+  8004f8:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_env_set_rt, 1, envid, period, budget, deadline, 0, 0);
+  8004fb:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8004fe:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800503:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800506:	be 00 00 00 00       	mov    $0x0,%esi
+  80050b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800511:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  800513:	48 85 c0             	test   %rax,%rax
+  800516:	7f 06                	jg     80051e <sys_env_set_rt+0x34>
+}
+  800518:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80051c:	c9                   	leave
+  80051d:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80051e:	49 89 c0             	mov    %rax,%r8
+  800521:	b9 11 00 00 00       	mov    $0x11,%ecx
+  800526:	48 ba 88 2c 80 00 00 	movabs $0x802c88,%rdx
+  80052d:	00 00 00 
+  800530:	be 26 00 00 00       	mov    $0x26,%esi
+  800535:	48 bf a7 2c 80 00 00 	movabs $0x802ca7,%rdi
+  80053c:	00 00 00 
+  80053f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800544:	49 b9 0e 1c 80 00 00 	movabs $0x801c0e,%r9
+  80054b:	00 00 00 
+  80054e:	41 ff d1             	call   *%r9
+
+0000000000800551 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  800551:	55                   	push   %rbp
+  800552:	48 89 e5             	mov    %rsp,%rbp
+  800555:	53                   	push   %rbx
+  800556:	48 83 ec 08          	sub    $0x8,%rsp
+  80055a:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  80055d:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800560:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800565:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80056a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80056f:	be 00 00 00 00       	mov    $0x0,%esi
+  800574:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80057a:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80057c:	48 85 c0             	test   %rax,%rax
+  80057f:	7f 06                	jg     800587 <sys_env_set_trapframe+0x36>
+}
+  800581:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800585:	c9                   	leave
+  800586:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800587:	49 89 c0             	mov    %rax,%r8
+  80058a:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  80058f:	48 ba 88 2c 80 00 00 	movabs $0x802c88,%rdx
+  800596:	00 00 00 
+  800599:	be 26 00 00 00       	mov    $0x26,%esi
+  80059e:	48 bf a7 2c 80 00 00 	movabs $0x802ca7,%rdi
+  8005a5:	00 00 00 
+  8005a8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005ad:	49 b9 0e 1c 80 00 00 	movabs $0x801c0e,%r9
+  8005b4:	00 00 00 
+  8005b7:	41 ff d1             	call   *%r9
+
+00000000008005ba <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  8005ba:	55                   	push   %rbp
+  8005bb:	48 89 e5             	mov    %rsp,%rbp
+  8005be:	53                   	push   %rbx
+  8005bf:	48 83 ec 08          	sub    $0x8,%rsp
+  8005c3:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  8005c6:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8005c9:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8005ce:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8005d3:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8005d8:	be 00 00 00 00       	mov    $0x0,%esi
+  8005dd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8005e3:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8005e5:	48 85 c0             	test   %rax,%rax
+  8005e8:	7f 06                	jg     8005f0 <sys_env_set_pgfault_upcall+0x36>
+}
+  8005ea:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8005ee:	c9                   	leave
+  8005ef:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8005f0:	49 89 c0             	mov    %rax,%r8
+  8005f3:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  8005f8:	48 ba 88 2c 80 00 00 	movabs $0x802c88,%rdx
+  8005ff:	00 00 00 
+  800602:	be 26 00 00 00       	mov    $0x26,%esi
+  800607:	48 bf a7 2c 80 00 00 	movabs $0x802ca7,%rdi
+  80060e:	00 00 00 
+  800611:	b8 00 00 00 00       	mov    $0x0,%eax
+  800616:	49 b9 0e 1c 80 00 00 	movabs $0x801c0e,%r9
+  80061d:	00 00 00 
+  800620:	41 ff d1             	call   *%r9
+
+0000000000800623 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  800623:	55                   	push   %rbp
+  800624:	48 89 e5             	mov    %rsp,%rbp
+  800627:	53                   	push   %rbx
+  800628:	89 f8                	mov    %edi,%eax
+  80062a:	49 89 f1             	mov    %rsi,%r9
+  80062d:	48 89 d3             	mov    %rdx,%rbx
+  800630:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  800633:	49 63 f0             	movslq %r8d,%rsi
+  800636:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  800639:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80063e:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800641:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800647:	cd 30                	int    $0x30
+}
+  800649:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80064d:	c9                   	leave
+  80064e:	c3                   	ret
+
+000000000080064f <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  80064f:	55                   	push   %rbp
+  800650:	48 89 e5             	mov    %rsp,%rbp
+  800653:	53                   	push   %rbx
+  800654:	48 83 ec 08          	sub    $0x8,%rsp
+  800658:	48 89 fa             	mov    %rdi,%rdx
+  80065b:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80065e:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800663:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800668:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80066d:	be 00 00 00 00       	mov    $0x0,%esi
+  800672:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800678:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80067a:	48 85 c0             	test   %rax,%rax
+  80067d:	7f 06                	jg     800685 <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  80067f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800683:	c9                   	leave
+  800684:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800685:	49 89 c0             	mov    %rax,%r8
+  800688:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  80068d:	48 ba 88 2c 80 00 00 	movabs $0x802c88,%rdx
+  800694:	00 00 00 
+  800697:	be 26 00 00 00       	mov    $0x26,%esi
+  80069c:	48 bf a7 2c 80 00 00 	movabs $0x802ca7,%rdi
+  8006a3:	00 00 00 
+  8006a6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006ab:	49 b9 0e 1c 80 00 00 	movabs $0x801c0e,%r9
+  8006b2:	00 00 00 
+  8006b5:	41 ff d1             	call   *%r9
+
+00000000008006b8 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8006b8:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8006bf:	ff ff ff 
+  8006c2:	48 01 f8             	add    %rdi,%rax
+  8006c5:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  8006c9:	c3                   	ret
+
+00000000008006ca <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8006ca:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8006d1:	ff ff ff 
+  8006d4:	48 01 f8             	add    %rdi,%rax
+  8006d7:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  8006db:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  8006e1:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  8006e5:	c3                   	ret
+
+00000000008006e6 <fd_alloc_from>:
+}
+
+/* Like fd_alloc(), but only considers fds starting from fdnum,
+ * so that several fds can be found before their pages are allocated */
+int
+fd_alloc_from(int fdnum, struct Fd **fd_store) {
+  8006e6:	55                   	push   %rbp
+  8006e7:	48 89 e5             	mov    %rsp,%rbp
+  8006ea:	41 57                	push   %r15
+  8006ec:	41 56                	push   %r14
+  8006ee:	41 55                	push   %r13
+  8006f0:	41 54                	push   %r12
+  8006f2:	53                   	push   %rbx
+  8006f3:	48 83 ec 08          	sub    $0x8,%rsp
+  8006f7:	49 89 f7             	mov    %rsi,%r15
+    for (int i = MAX(fdnum, 0); i < MAXFD; i++) {
+  8006fa:	85 ff                	test   %edi,%edi
+  8006fc:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  800702:	44 0f 49 e7          	cmovns %edi,%r12d
+  800706:	83 ff 1f             	cmp    $0x1f,%edi
+  800709:	7f 37                	jg     800742 <fd_alloc_from+0x5c>
+  80070b:	49 63 dc             	movslq %r12d,%rbx
+  80070e:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  800715:	48 c1 e3 0c          	shl    $0xc,%rbx
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  800719:	49 be ef 17 80 00 00 	movabs $0x8017ef,%r14
+  800720:	00 00 00 
+        struct Fd *fd = INDEX2FD(i);
+  800723:	49 89 dd             	mov    %rbx,%r13
+        if (!(get_prot(fd) & PROT_R)) {
+  800726:	48 89 df             	mov    %rbx,%rdi
+  800729:	41 ff d6             	call   *%r14
+  80072c:	83 e0 04             	and    $0x4,%eax
+  80072f:	74 1c                	je     80074d <fd_alloc_from+0x67>
+    for (int i = MAX(fdnum, 0); i < MAXFD; i++) {
+  800731:	41 83 c4 01          	add    $0x1,%r12d
+  800735:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  80073c:	41 83 fc 1f          	cmp    $0x1f,%r12d
+  800740:	7e e1                	jle    800723 <fd_alloc_from+0x3d>
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  800742:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  800748:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  80074d:	4d 89 2f             	mov    %r13,(%r15)
+}
+  800750:	48 83 c4 08          	add    $0x8,%rsp
+  800754:	5b                   	pop    %rbx
+  800755:	41 5c                	pop    %r12
+  800757:	41 5d                	pop    %r13
+  800759:	41 5e                	pop    %r14
+  80075b:	41 5f                	pop    %r15
+  80075d:	5d                   	pop    %rbp
+  80075e:	c3                   	ret
+
+000000000080075f <fd_alloc>:
+fd_alloc(struct Fd **fd_store) {
+  80075f:	55                   	push   %rbp
+  800760:	48 89 e5             	mov    %rsp,%rbp
+  800763:	48 89 fe             	mov    %rdi,%rsi
+    return fd_alloc_from(0, fd_store);
+  800766:	bf 00 00 00 00       	mov    $0x0,%edi
+  80076b:	48 b8 e6 06 80 00 00 	movabs $0x8006e6,%rax
+  800772:	00 00 00 
+  800775:	ff d0                	call   *%rax
+}
+  800777:	5d                   	pop    %rbp
+  800778:	c3                   	ret
+
+0000000000800779 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  800779:	83 ff 1f             	cmp    $0x1f,%edi
+  80077c:	77 39                	ja     8007b7 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  80077e:	55                   	push   %rbp
+  80077f:	48 89 e5             	mov    %rsp,%rbp
+  800782:	41 54                	push   %r12
+  800784:	53                   	push   %rbx
+  800785:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  800788:	48 63 df             	movslq %edi,%rbx
+  80078b:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  800792:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  800796:	48 89 df             	mov    %rbx,%rdi
+  800799:	48 b8 ef 17 80 00 00 	movabs $0x8017ef,%rax
+  8007a0:	00 00 00 
+  8007a3:	ff d0                	call   *%rax
+  8007a5:	a8 04                	test   $0x4,%al
+  8007a7:	74 14                	je     8007bd <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  8007a9:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  8007ad:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8007b2:	5b                   	pop    %rbx
+  8007b3:	41 5c                	pop    %r12
+  8007b5:	5d                   	pop    %rbp
+  8007b6:	c3                   	ret
+        return -E_INVAL;
+  8007b7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8007bc:	c3                   	ret
+        return -E_INVAL;
+  8007bd:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8007c2:	eb ee                	jmp    8007b2 <fd_lookup+0x39>
+
+00000000008007c4 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  8007c4:	55                   	push   %rbp
+  8007c5:	48 89 e5             	mov    %rsp,%rbp
+  8007c8:	41 54                	push   %r12
+  8007ca:	53                   	push   %rbx
+  8007cb:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  8007ce:	48 b8 40 2d 80 00 00 	movabs $0x802d40,%rax
+  8007d5:	00 00 00 
+  8007d8:	48 bb 20 40 80 00 00 	movabs $0x804020,%rbx
+  8007df:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  8007e2:	39 3b                	cmp    %edi,(%rbx)
+  8007e4:	74 47                	je     80082d <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  8007e6:	48 83 c0 08          	add    $0x8,%rax
+  8007ea:	48 8b 18             	mov    (%rax),%rbx
+  8007ed:	48 85 db             	test   %rbx,%rbx
+  8007f0:	75 f0                	jne    8007e2 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8007f2:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  8007f9:	00 00 00 
+  8007fc:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+  800802:	89 fa                	mov    %edi,%edx
+  800804:	48 bf b8 2c 80 00 00 	movabs $0x802cb8,%rdi
+  80080b:	00 00 00 
+  80080e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800813:	48 b9 5e 1d 80 00 00 	movabs $0x801d5e,%rcx
+  80081a:	00 00 00 
+  80081d:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  80081f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  800824:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  800828:	5b                   	pop    %rbx
+  800829:	41 5c                	pop    %r12
+  80082b:	5d                   	pop    %rbp
+  80082c:	c3                   	ret
+            return 0;
+  80082d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800832:	eb f0                	jmp    800824 <dev_lookup+0x60>
+
+0000000000800834 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  800834:	55                   	push   %rbp
+  800835:	48 89 e5             	mov    %rsp,%rbp
+  800838:	41 55                	push   %r13
+  80083a:	41 54                	push   %r12
+  80083c:	53                   	push   %rbx
+  80083d:	48 83 ec 18          	sub    $0x18,%rsp
+  800841:	48 89 fb             	mov    %rdi,%rbx
+  800844:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  800847:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  80084e:	ff ff ff 
+  800851:	48 01 df             	add    %rbx,%rdi
+  800854:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  800858:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80085c:	48 b8 79 07 80 00 00 	movabs $0x800779,%rax
+  800863:	00 00 00 
+  800866:	ff d0                	call   *%rax
+  800868:	41 89 c5             	mov    %eax,%r13d
+  80086b:	85 c0                	test   %eax,%eax
+  80086d:	78 06                	js     800875 <fd_close+0x41>
+  80086f:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  800873:	74 1a                	je     80088f <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  800875:	45 84 e4             	test   %r12b,%r12b
+  800878:	b8 00 00 00 00       	mov    $0x0,%eax
+  80087d:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  800881:	44 89 e8             	mov    %r13d,%eax
+  800884:	48 83 c4 18          	add    $0x18,%rsp
+  800888:	5b                   	pop    %rbx
+  800889:	41 5c                	pop    %r12
+  80088b:	41 5d                	pop    %r13
+  80088d:	5d                   	pop    %rbp
+  80088e:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  80088f:	8b 3b                	mov    (%rbx),%edi
+  800891:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800895:	48 b8 c4 07 80 00 00 	movabs $0x8007c4,%rax
+  80089c:	00 00 00 
+  80089f:	ff d0                	call   *%rax
+  8008a1:	41 89 c5             	mov    %eax,%r13d
+  8008a4:	85 c0                	test   %eax,%eax
+  8008a6:	78 1b                	js     8008c3 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  8008a8:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8008ac:	48 8b 40 20          	mov    0x20(%rax),%rax
+  8008b0:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  8008b6:	48 85 c0             	test   %rax,%rax
+  8008b9:	74 08                	je     8008c3 <fd_close+0x8f>
+  8008bb:	48 89 df             	mov    %rbx,%rdi
+  8008be:	ff d0                	call   *%rax
+  8008c0:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8008c3:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8008c8:	48 89 de             	mov    %rbx,%rsi
+  8008cb:	bf 00 00 00 00       	mov    $0x0,%edi
+  8008d0:	48 b8 49 03 80 00 00 	movabs $0x800349,%rax
+  8008d7:	00 00 00 
+  8008da:	ff d0                	call   *%rax
+    return res;
+  8008dc:	eb a3                	jmp    800881 <fd_close+0x4d>
+
+00000000008008de <close>:
+
+int
+close(int fdnum) {
+  8008de:	55                   	push   %rbp
+  8008df:	48 89 e5             	mov    %rsp,%rbp
+  8008e2:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  8008e6:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8008ea:	48 b8 79 07 80 00 00 	movabs $0x800779,%rax
+  8008f1:	00 00 00 
+  8008f4:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8008f6:	85 c0                	test   %eax,%eax
+  8008f8:	78 15                	js     80090f <close+0x31>
+
+    return fd_close(fd, 1);
+  8008fa:	be 01 00 00 00       	mov    $0x1,%esi
+  8008ff:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  800903:	48 b8 34 08 80 00 00 	movabs $0x800834,%rax
+  80090a:	00 00 00 
+  80090d:	ff d0                	call   *%rax
+}
+  80090f:	c9                   	leave
+  800910:	c3                   	ret
+
+0000000000800911 <close_all>:
+
+void
+close_all(void) {
+  800911:	55                   	push   %rbp
+  800912:	48 89 e5             	mov    %rsp,%rbp
+  800915:	41 54                	push   %r12
+  800917:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  800918:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80091d:	49 bc de 08 80 00 00 	movabs $0x8008de,%r12
+  800924:	00 00 00 
+  800927:	89 df                	mov    %ebx,%edi
+  800929:	41 ff d4             	call   *%r12
+  80092c:	83 c3 01             	add    $0x1,%ebx
+  80092f:	83 fb 20             	cmp    $0x20,%ebx
+  800932:	75 f3                	jne    800927 <close_all+0x16>
+}
+  800934:	5b                   	pop    %rbx
+  800935:	41 5c                	pop    %r12
+  800937:	5d                   	pop    %rbp
+  800938:	c3                   	ret
+
+0000000000800939 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  800939:	55                   	push   %rbp
+  80093a:	48 89 e5             	mov    %rsp,%rbp
+  80093d:	41 57                	push   %r15
+  80093f:	41 56                	push   %r14
+  800941:	41 55                	push   %r13
+  800943:	41 54                	push   %r12
+  800945:	53                   	push   %rbx
+  800946:	48 83 ec 18          	sub    $0x18,%rsp
+  80094a:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  80094d:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  800951:	48 b8 79 07 80 00 00 	movabs $0x800779,%rax
+  800958:	00 00 00 
+  80095b:	ff d0                	call   *%rax
+  80095d:	89 c3                	mov    %eax,%ebx
+  80095f:	85 c0                	test   %eax,%eax
+  800961:	0f 88 b8 00 00 00    	js     800a1f <dup+0xe6>
+    close(newfdnum);
+  800967:	44 89 e7             	mov    %r12d,%edi
+  80096a:	48 b8 de 08 80 00 00 	movabs $0x8008de,%rax
+  800971:	00 00 00 
+  800974:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  800976:	4d 63 ec             	movslq %r12d,%r13
+  800979:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  800980:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  800984:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  800988:	4c 89 ff             	mov    %r15,%rdi
+  80098b:	49 be ca 06 80 00 00 	movabs $0x8006ca,%r14
+  800992:	00 00 00 
+  800995:	41 ff d6             	call   *%r14
+  800998:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  80099b:	4c 89 ef             	mov    %r13,%rdi
+  80099e:	41 ff d6             	call   *%r14
+  8009a1:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  8009a4:	48 89 df             	mov    %rbx,%rdi
+  8009a7:	48 b8 ef 17 80 00 00 	movabs $0x8017ef,%rax
+  8009ae:	00 00 00 
+  8009b1:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  8009b3:	a8 04                	test   $0x4,%al
+  8009b5:	74 2b                	je     8009e2 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  8009b7:	41 89 c1             	mov    %eax,%r9d
+  8009ba:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8009c0:	4c 89 f1             	mov    %r14,%rcx
+  8009c3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8009c8:	48 89 de             	mov    %rbx,%rsi
+  8009cb:	bf 00 00 00 00       	mov    $0x0,%edi
+  8009d0:	48 b8 e4 02 80 00 00 	movabs $0x8002e4,%rax
+  8009d7:	00 00 00 
+  8009da:	ff d0                	call   *%rax
+  8009dc:	89 c3                	mov    %eax,%ebx
+  8009de:	85 c0                	test   %eax,%eax
+  8009e0:	78 4e                	js     800a30 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  8009e2:	4c 89 ff             	mov    %r15,%rdi
+  8009e5:	48 b8 ef 17 80 00 00 	movabs $0x8017ef,%rax
+  8009ec:	00 00 00 
+  8009ef:	ff d0                	call   *%rax
+  8009f1:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  8009f4:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8009fa:	4c 89 e9             	mov    %r13,%rcx
+  8009fd:	ba 00 00 00 00       	mov    $0x0,%edx
+  800a02:	4c 89 fe             	mov    %r15,%rsi
+  800a05:	bf 00 00 00 00       	mov    $0x0,%edi
+  800a0a:	48 b8 e4 02 80 00 00 	movabs $0x8002e4,%rax
+  800a11:	00 00 00 
+  800a14:	ff d0                	call   *%rax
+  800a16:	89 c3                	mov    %eax,%ebx
+  800a18:	85 c0                	test   %eax,%eax
+  800a1a:	78 14                	js     800a30 <dup+0xf7>
+
+    return newfdnum;
+  800a1c:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  800a1f:	89 d8                	mov    %ebx,%eax
+  800a21:	48 83 c4 18          	add    $0x18,%rsp
+  800a25:	5b                   	pop    %rbx
+  800a26:	41 5c                	pop    %r12
+  800a28:	41 5d                	pop    %r13
+  800a2a:	41 5e                	pop    %r14
+  800a2c:	41 5f                	pop    %r15
+  800a2e:	5d                   	pop    %rbp
+  800a2f:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  800a30:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800a35:	4c 89 ee             	mov    %r13,%rsi
+  800a38:	bf 00 00 00 00       	mov    $0x0,%edi
+  800a3d:	49 bc 49 03 80 00 00 	movabs $0x800349,%r12
+  800a44:	00 00 00 
+  800a47:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  800a4a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800a4f:	4c 89 f6             	mov    %r14,%rsi
+  800a52:	bf 00 00 00 00       	mov    $0x0,%edi
+  800a57:	41 ff d4             	call   *%r12
+    return res;
+  800a5a:	eb c3                	jmp    800a1f <dup+0xe6>
+
+0000000000800a5c <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  800a5c:	55                   	push   %rbp
+  800a5d:	48 89 e5             	mov    %rsp,%rbp
+  800a60:	41 56                	push   %r14
+  800a62:	41 55                	push   %r13
+  800a64:	41 54                	push   %r12
+  800a66:	53                   	push   %rbx
+  800a67:	48 83 ec 10          	sub    $0x10,%rsp
+  800a6b:	89 fb                	mov    %edi,%ebx
+  800a6d:	49 89 f4             	mov    %rsi,%r12
+  800a70:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800a73:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800a77:	48 b8 79 07 80 00 00 	movabs $0x800779,%rax
+  800a7e:	00 00 00 
+  800a81:	ff d0                	call   *%rax
+  800a83:	85 c0                	test   %eax,%eax
+  800a85:	78 4c                	js     800ad3 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800a87:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  800a8b:	41 8b 3e             	mov    (%r14),%edi
+  800a8e:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800a92:	48 b8 c4 07 80 00 00 	movabs $0x8007c4,%rax
+  800a99:	00 00 00 
+  800a9c:	ff d0                	call   *%rax
+  800a9e:	85 c0                	test   %eax,%eax
+  800aa0:	78 35                	js     800ad7 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  800aa2:	41 8b 46 08          	mov    0x8(%r14),%eax
+  800aa6:	83 e0 03             	and    $0x3,%eax
+  800aa9:	83 f8 01             	cmp    $0x1,%eax
+  800aac:	74 2d                	je     800adb <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  800aae:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800ab2:	48 8b 40 10          	mov    0x10(%rax),%rax
+  800ab6:	48 85 c0             	test   %rax,%rax
+  800ab9:	74 56                	je     800b11 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  800abb:	4c 89 ea             	mov    %r13,%rdx
+  800abe:	4c 89 e6             	mov    %r12,%rsi
+  800ac1:	4c 89 f7             	mov    %r14,%rdi
+  800ac4:	ff d0                	call   *%rax
+}
+  800ac6:	48 83 c4 10          	add    $0x10,%rsp
+  800aca:	5b                   	pop    %rbx
+  800acb:	41 5c                	pop    %r12
+  800acd:	41 5d                	pop    %r13
+  800acf:	41 5e                	pop    %r14
+  800ad1:	5d                   	pop    %rbp
+  800ad2:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800ad3:	48 98                	cltq
+  800ad5:	eb ef                	jmp    800ac6 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800ad7:	48 98                	cltq
+  800ad9:	eb eb                	jmp    800ac6 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  800adb:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  800ae2:	00 00 00 
+  800ae5:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+  800aeb:	89 da                	mov    %ebx,%edx
+  800aed:	48 bf f9 2c 80 00 00 	movabs $0x802cf9,%rdi
+  800af4:	00 00 00 
+  800af7:	b8 00 00 00 00       	mov    $0x0,%eax
+  800afc:	48 b9 5e 1d 80 00 00 	movabs $0x801d5e,%rcx
+  800b03:	00 00 00 
+  800b06:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  800b08:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  800b0f:	eb b5                	jmp    800ac6 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  800b11:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  800b18:	eb ac                	jmp    800ac6 <read+0x6a>
+
+0000000000800b1a <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  800b1a:	55                   	push   %rbp
+  800b1b:	48 89 e5             	mov    %rsp,%rbp
+  800b1e:	41 57                	push   %r15
+  800b20:	41 56                	push   %r14
+  800b22:	41 55                	push   %r13
+  800b24:	41 54                	push   %r12
+  800b26:	53                   	push   %rbx
+  800b27:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  800b2b:	48 85 d2             	test   %rdx,%rdx
+  800b2e:	74 54                	je     800b84 <readn+0x6a>
+  800b30:	41 89 fd             	mov    %edi,%r13d
+  800b33:	49 89 f6             	mov    %rsi,%r14
+  800b36:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  800b39:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  800b3e:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  800b43:	49 bf 5c 0a 80 00 00 	movabs $0x800a5c,%r15
+  800b4a:	00 00 00 
+  800b4d:	4c 89 e2             	mov    %r12,%rdx
+  800b50:	48 29 f2             	sub    %rsi,%rdx
+  800b53:	4c 01 f6             	add    %r14,%rsi
+  800b56:	44 89 ef             	mov    %r13d,%edi
+  800b59:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  800b5c:	85 c0                	test   %eax,%eax
+  800b5e:	78 20                	js     800b80 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  800b60:	01 c3                	add    %eax,%ebx
+  800b62:	85 c0                	test   %eax,%eax
+  800b64:	74 08                	je     800b6e <readn+0x54>
+  800b66:	48 63 f3             	movslq %ebx,%rsi
+  800b69:	4c 39 e6             	cmp    %r12,%rsi
+  800b6c:	72 df                	jb     800b4d <readn+0x33>
+    }
+    return res;
+  800b6e:	48 63 c3             	movslq %ebx,%rax
+}
+  800b71:	48 83 c4 08          	add    $0x8,%rsp
+  800b75:	5b                   	pop    %rbx
+  800b76:	41 5c                	pop    %r12
+  800b78:	41 5d                	pop    %r13
+  800b7a:	41 5e                	pop    %r14
+  800b7c:	41 5f                	pop    %r15
+  800b7e:	5d                   	pop    %rbp
+  800b7f:	c3                   	ret
+        if (inc < 0) return inc;
+  800b80:	48 98                	cltq
+  800b82:	eb ed                	jmp    800b71 <readn+0x57>
+    int inc = 1, res = 0;
+  800b84:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800b89:	eb e3                	jmp    800b6e <readn+0x54>
+
+0000000000800b8b <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  800b8b:	55                   	push   %rbp
+  800b8c:	48 89 e5             	mov    %rsp,%rbp
+  800b8f:	41 56                	push   %r14
+  800b91:	41 55                	push   %r13
+  800b93:	41 54                	push   %r12
+  800b95:	53                   	push   %rbx
+  800b96:	48 83 ec 10          	sub    $0x10,%rsp
+  800b9a:	89 fb                	mov    %edi,%ebx
+  800b9c:	49 89 f4             	mov    %rsi,%r12
+  800b9f:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800ba2:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800ba6:	48 b8 79 07 80 00 00 	movabs $0x800779,%rax
+  800bad:	00 00 00 
+  800bb0:	ff d0                	call   *%rax
+  800bb2:	85 c0                	test   %eax,%eax
+  800bb4:	78 47                	js     800bfd <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800bb6:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  800bba:	41 8b 3e             	mov    (%r14),%edi
+  800bbd:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800bc1:	48 b8 c4 07 80 00 00 	movabs $0x8007c4,%rax
+  800bc8:	00 00 00 
+  800bcb:	ff d0                	call   *%rax
+  800bcd:	85 c0                	test   %eax,%eax
+  800bcf:	78 30                	js     800c01 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800bd1:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  800bd6:	74 2d                	je     800c05 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  800bd8:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800bdc:	48 8b 40 18          	mov    0x18(%rax),%rax
+  800be0:	48 85 c0             	test   %rax,%rax
+  800be3:	74 56                	je     800c3b <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  800be5:	4c 89 ea             	mov    %r13,%rdx
+  800be8:	4c 89 e6             	mov    %r12,%rsi
+  800beb:	4c 89 f7             	mov    %r14,%rdi
+  800bee:	ff d0                	call   *%rax
+}
+  800bf0:	48 83 c4 10          	add    $0x10,%rsp
+  800bf4:	5b                   	pop    %rbx
+  800bf5:	41 5c                	pop    %r12
+  800bf7:	41 5d                	pop    %r13
+  800bf9:	41 5e                	pop    %r14
+  800bfb:	5d                   	pop    %rbp
+  800bfc:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800bfd:	48 98                	cltq
+  800bff:	eb ef                	jmp    800bf0 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800c01:	48 98                	cltq
+  800c03:	eb eb                	jmp    800bf0 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  800c05:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  800c0c:	00 00 00 
+  800c0f:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+  800c15:	89 da                	mov    %ebx,%edx
+  800c17:	48 bf 15 2d 80 00 00 	movabs $0x802d15,%rdi
+  800c1e:	00 00 00 
+  800c21:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c26:	48 b9 5e 1d 80 00 00 	movabs $0x801d5e,%rcx
+  800c2d:	00 00 00 
+  800c30:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  800c32:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  800c39:	eb b5                	jmp    800bf0 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  800c3b:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  800c42:	eb ac                	jmp    800bf0 <write+0x65>
+
+0000000000800c44 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  800c44:	55                   	push   %rbp
+  800c45:	48 89 e5             	mov    %rsp,%rbp
+  800c48:	53                   	push   %rbx
+  800c49:	48 83 ec 18          	sub    $0x18,%rsp
+  800c4d:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800c4f:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800c53:	48 b8 79 07 80 00 00 	movabs $0x800779,%rax
+  800c5a:	00 00 00 
+  800c5d:	ff d0                	call   *%rax
+  800c5f:	85 c0                	test   %eax,%eax
+  800c61:	78 0c                	js     800c6f <seek+0x2b>
+
+    fd->fd_offset = offset;
+  800c63:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800c67:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  800c6a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800c6f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800c73:	c9                   	leave
+  800c74:	c3                   	ret
+
+0000000000800c75 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  800c75:	55                   	push   %rbp
+  800c76:	48 89 e5             	mov    %rsp,%rbp
+  800c79:	41 55                	push   %r13
+  800c7b:	41 54                	push   %r12
+  800c7d:	53                   	push   %rbx
+  800c7e:	48 83 ec 18          	sub    $0x18,%rsp
+  800c82:	89 fb                	mov    %edi,%ebx
+  800c84:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800c87:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800c8b:	48 b8 79 07 80 00 00 	movabs $0x800779,%rax
+  800c92:	00 00 00 
+  800c95:	ff d0                	call   *%rax
+  800c97:	85 c0                	test   %eax,%eax
+  800c99:	78 38                	js     800cd3 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800c9b:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  800c9f:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  800ca3:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800ca7:	48 b8 c4 07 80 00 00 	movabs $0x8007c4,%rax
+  800cae:	00 00 00 
+  800cb1:	ff d0                	call   *%rax
+  800cb3:	85 c0                	test   %eax,%eax
+  800cb5:	78 1c                	js     800cd3 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800cb7:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  800cbc:	74 20                	je     800cde <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  800cbe:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800cc2:	48 8b 40 30          	mov    0x30(%rax),%rax
+  800cc6:	48 85 c0             	test   %rax,%rax
+  800cc9:	74 47                	je     800d12 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  800ccb:	44 89 e6             	mov    %r12d,%esi
+  800cce:	4c 89 ef             	mov    %r13,%rdi
+  800cd1:	ff d0                	call   *%rax
+}
+  800cd3:	48 83 c4 18          	add    $0x18,%rsp
+  800cd7:	5b                   	pop    %rbx
+  800cd8:	41 5c                	pop    %r12
+  800cda:	41 5d                	pop    %r13
+  800cdc:	5d                   	pop    %rbp
+  800cdd:	c3                   	ret
+                thisenv->env_id, fdnum);
+  800cde:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  800ce5:	00 00 00 
+  800ce8:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  800cee:	89 da                	mov    %ebx,%edx
+  800cf0:	48 bf d8 2c 80 00 00 	movabs $0x802cd8,%rdi
+  800cf7:	00 00 00 
+  800cfa:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cff:	48 b9 5e 1d 80 00 00 	movabs $0x801d5e,%rcx
+  800d06:	00 00 00 
+  800d09:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  800d0b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800d10:	eb c1                	jmp    800cd3 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  800d12:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  800d17:	eb ba                	jmp    800cd3 <ftruncate+0x5e>
+
+0000000000800d19 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  800d19:	55                   	push   %rbp
+  800d1a:	48 89 e5             	mov    %rsp,%rbp
+  800d1d:	41 54                	push   %r12
+  800d1f:	53                   	push   %rbx
+  800d20:	48 83 ec 10          	sub    $0x10,%rsp
+  800d24:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800d27:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800d2b:	48 b8 79 07 80 00 00 	movabs $0x800779,%rax
+  800d32:	00 00 00 
+  800d35:	ff d0                	call   *%rax
+  800d37:	85 c0                	test   %eax,%eax
+  800d39:	78 4e                	js     800d89 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800d3b:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  800d3f:	41 8b 3c 24          	mov    (%r12),%edi
+  800d43:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  800d47:	48 b8 c4 07 80 00 00 	movabs $0x8007c4,%rax
+  800d4e:	00 00 00 
+  800d51:	ff d0                	call   *%rax
+  800d53:	85 c0                	test   %eax,%eax
+  800d55:	78 32                	js     800d89 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  800d57:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800d5b:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  800d60:	74 30                	je     800d92 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  800d62:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  800d65:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  800d6c:	00 00 00 
+    stat->st_isdir = 0;
+  800d6f:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  800d76:	00 00 00 
+    stat->st_dev = dev;
+  800d79:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  800d80:	48 89 de             	mov    %rbx,%rsi
+  800d83:	4c 89 e7             	mov    %r12,%rdi
+  800d86:	ff 50 28             	call   *0x28(%rax)
+}
+  800d89:	48 83 c4 10          	add    $0x10,%rsp
+  800d8d:	5b                   	pop    %rbx
+  800d8e:	41 5c                	pop    %r12
+  800d90:	5d                   	pop    %rbp
+  800d91:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  800d92:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  800d97:	eb f0                	jmp    800d89 <fstat+0x70>
+
+0000000000800d99 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  800d99:	55                   	push   %rbp
+  800d9a:	48 89 e5             	mov    %rsp,%rbp
+  800d9d:	41 54                	push   %r12
+  800d9f:	53                   	push   %rbx
+  800da0:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  800da3:	be 00 00 00 00       	mov    $0x0,%esi
+  800da8:	48 b8 7c 11 80 00 00 	movabs $0x80117c,%rax
+  800daf:	00 00 00 
+  800db2:	ff d0                	call   *%rax
+  800db4:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  800db6:	85 c0                	test   %eax,%eax
+  800db8:	78 25                	js     800ddf <stat+0x46>
+
+    int res = fstat(fd, stat);
+  800dba:	4c 89 e6             	mov    %r12,%rsi
+  800dbd:	89 c7                	mov    %eax,%edi
+  800dbf:	48 b8 19 0d 80 00 00 	movabs $0x800d19,%rax
+  800dc6:	00 00 00 
+  800dc9:	ff d0                	call   *%rax
+  800dcb:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  800dce:	89 df                	mov    %ebx,%edi
+  800dd0:	48 b8 de 08 80 00 00 	movabs $0x8008de,%rax
+  800dd7:	00 00 00 
+  800dda:	ff d0                	call   *%rax
+
+    return res;
+  800ddc:	44 89 e3             	mov    %r12d,%ebx
+}
+  800ddf:	89 d8                	mov    %ebx,%eax
+  800de1:	5b                   	pop    %rbx
+  800de2:	41 5c                	pop    %r12
+  800de4:	5d                   	pop    %rbp
+  800de5:	c3                   	ret
+
+0000000000800de6 <fsipc>:
+ * response may be written back to fsipcbuf.
+ * type: request code, passed as the simple integer IPC value.
+ * dstva: virtual address at which to receive reply page, 0 if none.
+ * Returns result from the file server. */
+static int
+fsipc(unsigned type, void *dstva) {
+  800de6:	55                   	push   %rbp
+  800de7:	48 89 e5             	mov    %rsp,%rbp
+  800dea:	41 54                	push   %r12
+  800dec:	53                   	push   %rbx
+  800ded:	48 83 ec 10          	sub    $0x10,%rsp
+  800df1:	41 89 fc             	mov    %edi,%r12d
+  800df4:	48 89 f3             	mov    %rsi,%rbx
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  800df7:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  800dfe:	00 00 00 
+  800e01:	83 38 00             	cmpl   $0x0,(%rax)
+  800e04:	74 5e                	je     800e64 <fsipc+0x7e>
+    if (debug) {
+        cprintf("[%08x] fsipc %d %08x\n",
+                thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+    }
+
+    ipc_send(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW);
+  800e06:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  800e0c:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  800e11:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  800e18:	00 00 00 
+  800e1b:	44 89 e6             	mov    %r12d,%esi
+  800e1e:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  800e25:	00 00 00 
+  800e28:	8b 38                	mov    (%rax),%edi
+  800e2a:	48 b8 7f 2b 80 00 00 	movabs $0x802b7f,%rax
+  800e31:	00 00 00 
+  800e34:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  800e36:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  800e3d:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  800e3e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e43:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  800e47:	48 89 de             	mov    %rbx,%rsi
+  800e4a:	bf 00 00 00 00       	mov    $0x0,%edi
+  800e4f:	48 b8 aa 2a 80 00 00 	movabs $0x802aaa,%rax
+  800e56:	00 00 00 
+  800e59:	ff d0                	call   *%rax
+}
+  800e5b:	48 83 c4 10          	add    $0x10,%rsp
+  800e5f:	5b                   	pop    %rbx
+  800e60:	41 5c                	pop    %r12
+  800e62:	5d                   	pop    %rbp
+  800e63:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  800e64:	bf 03 00 00 00       	mov    $0x3,%edi
+  800e69:	48 b8 22 2c 80 00 00 	movabs $0x802c22,%rax
+  800e70:	00 00 00 
+  800e73:	ff d0                	call   *%rax
+  800e75:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  800e7c:	00 00 
+  800e7e:	eb 86                	jmp    800e06 <fsipc+0x20>
+
+0000000000800e80 <devfile_trunc>:
+    return 0;
+}
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  800e80:	55                   	push   %rbp
+  800e81:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  800e84:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  800e8b:	00 00 00 
+  800e8e:	8b 57 0c             	mov    0xc(%rdi),%edx
+  800e91:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  800e93:	89 70 04             	mov    %esi,0x4(%rax)
+
+    return fsipc(FSREQ_SET_SIZE, NULL);
+  800e96:	be 00 00 00 00       	mov    $0x0,%esi
+  800e9b:	bf 02 00 00 00       	mov    $0x2,%edi
+  800ea0:	48 b8 e6 0d 80 00 00 	movabs $0x800de6,%rax
+  800ea7:	00 00 00 
+  800eaa:	ff d0                	call   *%rax
+}
+  800eac:	5d                   	pop    %rbp
+  800ead:	c3                   	ret
+
+0000000000800eae <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  800eae:	55                   	push   %rbp
+  800eaf:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  800eb2:	8b 47 0c             	mov    0xc(%rdi),%eax
+  800eb5:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  800ebc:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  800ebe:	be 00 00 00 00       	mov    $0x0,%esi
+  800ec3:	bf 06 00 00 00       	mov    $0x6,%edi
+  800ec8:	48 b8 e6 0d 80 00 00 	movabs $0x800de6,%rax
+  800ecf:	00 00 00 
+  800ed2:	ff d0                	call   *%rax
+}
+  800ed4:	5d                   	pop    %rbp
+  800ed5:	c3                   	ret
+
+0000000000800ed6 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  800ed6:	55                   	push   %rbp
+  800ed7:	48 89 e5             	mov    %rsp,%rbp
+  800eda:	41 54                	push   %r12
+  800edc:	53                   	push   %rbx
+  800edd:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  800ee0:	8b 47 0c             	mov    0xc(%rdi),%eax
+  800ee3:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  800eea:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  800eec:	be 00 00 00 00       	mov    $0x0,%esi
+  800ef1:	bf 05 00 00 00       	mov    $0x5,%edi
+  800ef6:	48 b8 e6 0d 80 00 00 	movabs $0x800de6,%rax
+  800efd:	00 00 00 
+  800f00:	ff d0                	call   *%rax
+    if (res < 0) {
+  800f02:	85 c0                	test   %eax,%eax
+  800f04:	78 3d                	js     800f43 <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  800f06:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  800f0d:	00 00 00 
+  800f10:	4c 89 e6             	mov    %r12,%rsi
+  800f13:	48 89 df             	mov    %rbx,%rdi
+  800f16:	48 b8 83 26 80 00 00 	movabs $0x802683,%rax
+  800f1d:	00 00 00 
+  800f20:	ff d0                	call   *%rax
+    st->st_size  = fsipcbuf.statRet.ret_size;
+  800f22:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  800f29:	00 
+  800f2a:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  800f30:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  800f37:	00 
+  800f38:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  800f3e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800f43:	5b                   	pop    %rbx
+  800f44:	41 5c                	pop    %r12
+  800f46:	5d                   	pop    %rbp
+  800f47:	c3                   	ret
+
+0000000000800f48 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  800f48:	55                   	push   %rbp
+  800f49:	48 89 e5             	mov    %rsp,%rbp
+  800f4c:	41 57                	push   %r15
+  800f4e:	41 56                	push   %r14
+  800f50:	41 55                	push   %r13
+  800f52:	41 54                	push   %r12
+  800f54:	53                   	push   %rbx
+  800f55:	48 83 ec 18          	sub    $0x18,%rsp
+  800f59:	49 89 fe             	mov    %rdi,%r14
+  800f5c:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+  800f60:	48 89 d3             	mov    %rdx,%rbx
+    while (n > sizeof(fsipcbuf.write.req_buf))
+  800f63:	48 81 fa f0 0f 00 00 	cmp    $0xff0,%rdx
+  800f6a:	0f 86 e4 00 00 00    	jbe    801054 <devfile_write+0x10c>
+  800f70:	49 89 f4             	mov    %rsi,%r12
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  800f73:	49 bd 00 60 80 00 00 	movabs $0x806000,%r13
+  800f7a:	00 00 00 
+        memcpy(fsipcbuf.write.req_buf, buf, sizeof(fsipcbuf.write.req_buf));
+  800f7d:	49 bf e4 28 80 00 00 	movabs $0x8028e4,%r15
+  800f84:	00 00 00 
+  800f87:	eb 03                	jmp    800f8c <devfile_write+0x44>
+        buf += sizeof(fsipcbuf.write.req_buf);
+  800f89:	49 89 f4             	mov    %rsi,%r12
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  800f8c:	41 8b 46 0c          	mov    0xc(%r14),%eax
+  800f90:	41 89 45 00          	mov    %eax,0x0(%r13)
+        fsipcbuf.write.req_n      = sizeof(fsipcbuf.write.req_buf);
+  800f94:	49 c7 45 08 f0 0f 00 	movq   $0xff0,0x8(%r13)
+  800f9b:	00 
+        memcpy(fsipcbuf.write.req_buf, buf, sizeof(fsipcbuf.write.req_buf));
+  800f9c:	ba f0 0f 00 00       	mov    $0xff0,%edx
+  800fa1:	4c 89 e6             	mov    %r12,%rsi
+  800fa4:	48 bf 10 60 80 00 00 	movabs $0x806010,%rdi
+  800fab:	00 00 00 
+  800fae:	41 ff d7             	call   *%r15
+        ssize_t res = fsipc(FSREQ_WRITE, NULL);
+  800fb1:	be 00 00 00 00       	mov    $0x0,%esi
+  800fb6:	bf 04 00 00 00       	mov    $0x4,%edi
+  800fbb:	48 b8 e6 0d 80 00 00 	movabs $0x800de6,%rax
+  800fc2:	00 00 00 
+  800fc5:	ff d0                	call   *%rax
+  800fc7:	48 63 d0             	movslq %eax,%rdx
+        if (res < 0 || res < sizeof(fsipcbuf.write.req_buf))
+  800fca:	3d ef 0f 00 00       	cmp    $0xfef,%eax
+  800fcf:	7e 71                	jle    801042 <devfile_write+0xfa>
+        buf += sizeof(fsipcbuf.write.req_buf);
+  800fd1:	49 8d b4 24 f0 0f 00 	lea    0xff0(%r12),%rsi
+  800fd8:	00 
+        n -= sizeof(fsipcbuf.write.req_buf);
+  800fd9:	48 81 eb f0 0f 00 00 	sub    $0xff0,%rbx
+    while (n > sizeof(fsipcbuf.write.req_buf))
+  800fe0:	48 81 fb f0 0f 00 00 	cmp    $0xff0,%rbx
+  800fe7:	77 a0                	ja     800f89 <devfile_write+0x41>
+        written += sizeof(fsipcbuf.write.req_buf);
+  800fe9:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800fed:	49 29 c4             	sub    %rax,%r12
+  800ff0:	4d 8d a4 24 f0 0f 00 	lea    0xff0(%r12),%r12
+  800ff7:	00 
+    fsipcbuf.write.req_fileid = fd->fd_file.id;
+  800ff8:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  800fff:	00 00 00 
+  801002:	41 8b 56 0c          	mov    0xc(%r14),%edx
+  801006:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.write.req_n      = n;
+  801008:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    memcpy(fsipcbuf.write.req_buf, buf, n);
+  80100c:	48 89 da             	mov    %rbx,%rdx
+  80100f:	48 8d 78 10          	lea    0x10(%rax),%rdi
+  801013:	48 b8 e4 28 80 00 00 	movabs $0x8028e4,%rax
+  80101a:	00 00 00 
+  80101d:	ff d0                	call   *%rax
+    ssize_t res = fsipc(FSREQ_WRITE, NULL);
+  80101f:	be 00 00 00 00       	mov    $0x0,%esi
+  801024:	bf 04 00 00 00       	mov    $0x4,%edi
+  801029:	48 b8 e6 0d 80 00 00 	movabs $0x800de6,%rax
+  801030:	00 00 00 
+  801033:	ff d0                	call   *%rax
+  801035:	48 63 d0             	movslq %eax,%rdx
+    written += res;
+  801038:	49 01 d4             	add    %rdx,%r12
+  80103b:	48 85 d2             	test   %rdx,%rdx
+  80103e:	49 0f 49 d4          	cmovns %r12,%rdx
+}
+  801042:	48 89 d0             	mov    %rdx,%rax
+  801045:	48 83 c4 18          	add    $0x18,%rsp
+  801049:	5b                   	pop    %rbx
+  80104a:	41 5c                	pop    %r12
+  80104c:	41 5d                	pop    %r13
+  80104e:	41 5e                	pop    %r14
+  801050:	41 5f                	pop    %r15
+  801052:	5d                   	pop    %rbp
+  801053:	c3                   	ret
+    while (n > sizeof(fsipcbuf.write.req_buf))
+  801054:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+    ssize_t written = 0;
+  801058:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80105e:	eb 98                	jmp    800ff8 <devfile_write+0xb0>
+
+0000000000801060 <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  801060:	55                   	push   %rbp
+  801061:	48 89 e5             	mov    %rsp,%rbp
+  801064:	41 57                	push   %r15
+  801066:	41 56                	push   %r14
+  801068:	41 55                	push   %r13
+  80106a:	41 54                	push   %r12
+  80106c:	53                   	push   %rbx
+  80106d:	48 83 ec 18          	sub    $0x18,%rsp
+  801071:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  801075:	49 89 f6             	mov    %rsi,%r14
+  801078:	49 89 d4             	mov    %rdx,%r12
+    while (n > sizeof(fsipcbuf.readRet.ret_buf))
+  80107b:	48 81 fa 00 10 00 00 	cmp    $0x1000,%rdx
+  801082:	0f 86 ea 00 00 00    	jbe    801172 <devfile_read+0x112>
+    ssize_t readsz = 0;
+  801088:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  80108f:	00 
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801090:	49 bf 00 60 80 00 00 	movabs $0x806000,%r15
+  801097:	00 00 00 
+  80109a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80109e:	8b 40 0c             	mov    0xc(%rax),%eax
+  8010a1:	41 89 07             	mov    %eax,(%r15)
+        fsipcbuf.read.req_n = sizeof(fsipcbuf.readRet.ret_buf);
+  8010a4:	49 c7 47 08 00 10 00 	movq   $0x1000,0x8(%r15)
+  8010ab:	00 
+        ssize_t res = fsipc(FSREQ_READ, NULL);
+  8010ac:	be 00 00 00 00       	mov    $0x0,%esi
+  8010b1:	bf 03 00 00 00       	mov    $0x3,%edi
+  8010b6:	48 b8 e6 0d 80 00 00 	movabs $0x800de6,%rax
+  8010bd:	00 00 00 
+  8010c0:	ff d0                	call   *%rax
+  8010c2:	4c 63 e8             	movslq %eax,%r13
+        if (res < 0)
+  8010c5:	4d 85 ed             	test   %r13,%r13
+  8010c8:	0f 88 92 00 00 00    	js     801160 <devfile_read+0x100>
+        memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  8010ce:	4c 89 ea             	mov    %r13,%rdx
+  8010d1:	4c 89 fe             	mov    %r15,%rsi
+  8010d4:	4c 89 f7             	mov    %r14,%rdi
+  8010d7:	48 b8 e4 28 80 00 00 	movabs $0x8028e4,%rax
+  8010de:	00 00 00 
+  8010e1:	ff d0                	call   *%rax
+        if (res < sizeof(fsipcbuf.readRet.ret_buf))
+  8010e3:	49 81 fd ff 0f 00 00 	cmp    $0xfff,%r13
+  8010ea:	76 6d                	jbe    801159 <devfile_read+0xf9>
+        readsz += res;
+  8010ec:	4c 01 6d c0          	add    %r13,-0x40(%rbp)
+        buf += res;
+  8010f0:	4d 01 ee             	add    %r13,%r14
+        n -= res;
+  8010f3:	4d 29 ec             	sub    %r13,%r12
+    while (n > sizeof(fsipcbuf.readRet.ret_buf))
+  8010f6:	49 81 fc 00 10 00 00 	cmp    $0x1000,%r12
+  8010fd:	77 9b                	ja     80109a <devfile_read+0x3a>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8010ff:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  801106:	00 00 00 
+  801109:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  80110d:	8b 51 0c             	mov    0xc(%rcx),%edx
+  801110:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.read.req_n = n;
+  801112:	4c 89 60 08          	mov    %r12,0x8(%rax)
+    ssize_t res = fsipc(FSREQ_READ, NULL);
+  801116:	be 00 00 00 00       	mov    $0x0,%esi
+  80111b:	bf 03 00 00 00       	mov    $0x3,%edi
+  801120:	48 b8 e6 0d 80 00 00 	movabs $0x800de6,%rax
+  801127:	00 00 00 
+  80112a:	ff d0                	call   *%rax
+  80112c:	4c 63 e8             	movslq %eax,%r13
+    if (res < 0)
+  80112f:	4d 85 ed             	test   %r13,%r13
+  801132:	78 2c                	js     801160 <devfile_read+0x100>
+    memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  801134:	4c 89 ea             	mov    %r13,%rdx
+  801137:	48 be 00 60 80 00 00 	movabs $0x806000,%rsi
+  80113e:	00 00 00 
+  801141:	4c 89 f7             	mov    %r14,%rdi
+  801144:	48 b8 e4 28 80 00 00 	movabs $0x8028e4,%rax
+  80114b:	00 00 00 
+  80114e:	ff d0                	call   *%rax
+    readsz += res;
+  801150:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  801154:	49 01 c5             	add    %rax,%r13
+    return readsz;
+  801157:	eb 07                	jmp    801160 <devfile_read+0x100>
+            return readsz + res;
+  801159:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80115d:	49 01 c5             	add    %rax,%r13
+}
+  801160:	4c 89 e8             	mov    %r13,%rax
+  801163:	48 83 c4 18          	add    $0x18,%rsp
+  801167:	5b                   	pop    %rbx
+  801168:	41 5c                	pop    %r12
+  80116a:	41 5d                	pop    %r13
+  80116c:	41 5e                	pop    %r14
+  80116e:	41 5f                	pop    %r15
+  801170:	5d                   	pop    %rbp
+  801171:	c3                   	ret
+    ssize_t readsz = 0;
+  801172:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  801179:	00 
+  80117a:	eb 83                	jmp    8010ff <devfile_read+0x9f>
+
+000000000080117c <open>:
+open(const char *path, int mode) {
+  80117c:	55                   	push   %rbp
+  80117d:	48 89 e5             	mov    %rsp,%rbp
+  801180:	41 55                	push   %r13
+  801182:	41 54                	push   %r12
+  801184:	53                   	push   %rbx
+  801185:	48 83 ec 18          	sub    $0x18,%rsp
+  801189:	49 89 fc             	mov    %rdi,%r12
+  80118c:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  80118f:	48 b8 45 26 80 00 00 	movabs $0x802645,%rax
+  801196:	00 00 00 
+  801199:	ff d0                	call   *%rax
+  80119b:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  8011a1:	0f 87 8a 00 00 00    	ja     801231 <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8011a7:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  8011ab:	48 b8 5f 07 80 00 00 	movabs $0x80075f,%rax
+  8011b2:	00 00 00 
+  8011b5:	ff d0                	call   *%rax
+  8011b7:	89 c3                	mov    %eax,%ebx
+  8011b9:	85 c0                	test   %eax,%eax
+  8011bb:	78 50                	js     80120d <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  8011bd:	4c 89 e6             	mov    %r12,%rsi
+  8011c0:	48 bb 00 60 80 00 00 	movabs $0x806000,%rbx
+  8011c7:	00 00 00 
+  8011ca:	48 89 df             	mov    %rbx,%rdi
+  8011cd:	48 b8 83 26 80 00 00 	movabs $0x802683,%rax
+  8011d4:	00 00 00 
+  8011d7:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  8011d9:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  8011e0:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8011e4:	bf 01 00 00 00       	mov    $0x1,%edi
+  8011e9:	48 b8 e6 0d 80 00 00 	movabs $0x800de6,%rax
+  8011f0:	00 00 00 
+  8011f3:	ff d0                	call   *%rax
+  8011f5:	89 c3                	mov    %eax,%ebx
+  8011f7:	85 c0                	test   %eax,%eax
+  8011f9:	78 1f                	js     80121a <open+0x9e>
+    return fd2num(fd);
+  8011fb:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8011ff:	48 b8 b8 06 80 00 00 	movabs $0x8006b8,%rax
+  801206:	00 00 00 
+  801209:	ff d0                	call   *%rax
+  80120b:	89 c3                	mov    %eax,%ebx
+}
+  80120d:	89 d8                	mov    %ebx,%eax
+  80120f:	48 83 c4 18          	add    $0x18,%rsp
+  801213:	5b                   	pop    %rbx
+  801214:	41 5c                	pop    %r12
+  801216:	41 5d                	pop    %r13
+  801218:	5d                   	pop    %rbp
+  801219:	c3                   	ret
+        fd_close(fd, 0);
+  80121a:	be 00 00 00 00       	mov    $0x0,%esi
+  80121f:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  801223:	48 b8 34 08 80 00 00 	movabs $0x800834,%rax
+  80122a:	00 00 00 
+  80122d:	ff d0                	call   *%rax
+        return res;
+  80122f:	eb dc                	jmp    80120d <open+0x91>
+        return -E_BAD_PATH;
+  801231:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  801236:	eb d5                	jmp    80120d <open+0x91>
+
+0000000000801238 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  801238:	55                   	push   %rbp
+  801239:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc(FSREQ_SYNC, NULL);
+  80123c:	be 00 00 00 00       	mov    $0x0,%esi
+  801241:	bf 08 00 00 00       	mov    $0x8,%edi
+  801246:	48 b8 e6 0d 80 00 00 	movabs $0x800de6,%rax
+  80124d:	00 00 00 
+  801250:	ff d0                	call   *%rax
+}
+  801252:	5d                   	pop    %rbp
+  801253:	c3                   	ret
+
+0000000000801254 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  801254:	55                   	push   %rbp
+  801255:	48 89 e5             	mov    %rsp,%rbp
+  801258:	41 54                	push   %r12
+  80125a:	53                   	push   %rbx
+  80125b:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80125e:	48 b8 ca 06 80 00 00 	movabs $0x8006ca,%rax
+  801265:	00 00 00 
+  801268:	ff d0                	call   *%rax
+  80126a:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  80126d:	48 be 60 2d 80 00 00 	movabs $0x802d60,%rsi
+  801274:	00 00 00 
+  801277:	48 89 df             	mov    %rbx,%rdi
+  80127a:	48 b8 83 26 80 00 00 	movabs $0x802683,%rax
+  801281:	00 00 00 
+  801284:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  801286:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  80128b:	41 2b 04 24          	sub    (%r12),%eax
+  80128f:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  801295:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  80129c:	00 00 00 
+    stat->st_dev = &devpipe;
+  80129f:	48 b8 60 40 80 00 00 	movabs $0x804060,%rax
+  8012a6:	00 00 00 
+  8012a9:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  8012b0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012b5:	5b                   	pop    %rbx
+  8012b6:	41 5c                	pop    %r12
+  8012b8:	5d                   	pop    %rbp
+  8012b9:	c3                   	ret
+
+00000000008012ba <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  8012ba:	55                   	push   %rbp
+  8012bb:	48 89 e5             	mov    %rsp,%rbp
+  8012be:	41 54                	push   %r12
+  8012c0:	53                   	push   %rbx
+  8012c1:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8012c4:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8012c9:	48 89 fe             	mov    %rdi,%rsi
+  8012cc:	bf 00 00 00 00       	mov    $0x0,%edi
+  8012d1:	49 bc 49 03 80 00 00 	movabs $0x800349,%r12
+  8012d8:	00 00 00 
+  8012db:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  8012de:	48 89 df             	mov    %rbx,%rdi
+  8012e1:	48 b8 ca 06 80 00 00 	movabs $0x8006ca,%rax
+  8012e8:	00 00 00 
+  8012eb:	ff d0                	call   *%rax
+  8012ed:	48 89 c6             	mov    %rax,%rsi
+  8012f0:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8012f5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8012fa:	41 ff d4             	call   *%r12
+}
+  8012fd:	5b                   	pop    %rbx
+  8012fe:	41 5c                	pop    %r12
+  801300:	5d                   	pop    %rbp
+  801301:	c3                   	ret
+
+0000000000801302 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  801302:	55                   	push   %rbp
+  801303:	48 89 e5             	mov    %rsp,%rbp
+  801306:	41 57                	push   %r15
+  801308:	41 56                	push   %r14
+  80130a:	41 55                	push   %r13
+  80130c:	41 54                	push   %r12
+  80130e:	53                   	push   %rbx
+  80130f:	48 83 ec 18          	sub    $0x18,%rsp
+  801313:	49 89 fc             	mov    %rdi,%r12
+  801316:	49 89 f5             	mov    %rsi,%r13
+  801319:	49 89 d7             	mov    %rdx,%r15
+  80131c:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  801320:	48 b8 ca 06 80 00 00 	movabs $0x8006ca,%rax
+  801327:	00 00 00 
+  80132a:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  80132c:	4d 85 ff             	test   %r15,%r15
+  80132f:	0f 84 af 00 00 00    	je     8013e4 <devpipe_write+0xe2>
+  801335:	48 89 c3             	mov    %rax,%rbx
+  801338:	4c 89 f8             	mov    %r15,%rax
+  80133b:	4d 89 ef             	mov    %r13,%r15
+  80133e:	4c 01 e8             	add    %r13,%rax
+  801341:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  801345:	49 bd 51 02 80 00 00 	movabs $0x800251,%r13
+  80134c:	00 00 00 
+            sys_yield();
+  80134f:	49 be ee 01 80 00 00 	movabs $0x8001ee,%r14
+  801356:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  801359:	8b 73 04             	mov    0x4(%rbx),%esi
+  80135c:	48 63 ce             	movslq %esi,%rcx
+  80135f:	48 63 03             	movslq (%rbx),%rax
+  801362:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  801368:	48 39 c1             	cmp    %rax,%rcx
+  80136b:	72 2e                	jb     80139b <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80136d:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  801372:	48 89 da             	mov    %rbx,%rdx
+  801375:	be 00 10 00 00       	mov    $0x1000,%esi
+  80137a:	4c 89 e7             	mov    %r12,%rdi
+  80137d:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  801380:	85 c0                	test   %eax,%eax
+  801382:	74 66                	je     8013ea <devpipe_write+0xe8>
+            sys_yield();
+  801384:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  801387:	8b 73 04             	mov    0x4(%rbx),%esi
+  80138a:	48 63 ce             	movslq %esi,%rcx
+  80138d:	48 63 03             	movslq (%rbx),%rax
+  801390:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  801396:	48 39 c1             	cmp    %rax,%rcx
+  801399:	73 d2                	jae    80136d <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  80139b:	41 0f b6 3f          	movzbl (%r15),%edi
+  80139f:	48 89 ca             	mov    %rcx,%rdx
+  8013a2:	48 c1 ea 03          	shr    $0x3,%rdx
+  8013a6:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  8013ad:	08 10 20 
+  8013b0:	48 f7 e2             	mul    %rdx
+  8013b3:	48 c1 ea 06          	shr    $0x6,%rdx
+  8013b7:	48 89 d0             	mov    %rdx,%rax
+  8013ba:	48 c1 e0 09          	shl    $0x9,%rax
+  8013be:	48 29 d0             	sub    %rdx,%rax
+  8013c1:	48 c1 e0 03          	shl    $0x3,%rax
+  8013c5:	48 29 c1             	sub    %rax,%rcx
+  8013c8:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  8013cd:	83 c6 01             	add    $0x1,%esi
+  8013d0:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8013d3:	49 83 c7 01          	add    $0x1,%r15
+  8013d7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8013db:	49 39 c7             	cmp    %rax,%r15
+  8013de:	0f 85 75 ff ff ff    	jne    801359 <devpipe_write+0x57>
+    return n;
+  8013e4:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8013e8:	eb 05                	jmp    8013ef <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  8013ea:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8013ef:	48 83 c4 18          	add    $0x18,%rsp
+  8013f3:	5b                   	pop    %rbx
+  8013f4:	41 5c                	pop    %r12
+  8013f6:	41 5d                	pop    %r13
+  8013f8:	41 5e                	pop    %r14
+  8013fa:	41 5f                	pop    %r15
+  8013fc:	5d                   	pop    %rbp
+  8013fd:	c3                   	ret
+
+00000000008013fe <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  8013fe:	55                   	push   %rbp
+  8013ff:	48 89 e5             	mov    %rsp,%rbp
+  801402:	41 57                	push   %r15
+  801404:	41 56                	push   %r14
+  801406:	41 55                	push   %r13
+  801408:	41 54                	push   %r12
+  80140a:	53                   	push   %rbx
+  80140b:	48 83 ec 18          	sub    $0x18,%rsp
+  80140f:	49 89 fc             	mov    %rdi,%r12
+  801412:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  801416:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80141a:	48 b8 ca 06 80 00 00 	movabs $0x8006ca,%rax
+  801421:	00 00 00 
+  801424:	ff d0                	call   *%rax
+  801426:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  801429:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80142f:	49 bd 51 02 80 00 00 	movabs $0x800251,%r13
+  801436:	00 00 00 
+            sys_yield();
+  801439:	49 be ee 01 80 00 00 	movabs $0x8001ee,%r14
+  801440:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  801443:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  801448:	74 7d                	je     8014c7 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  80144a:	8b 03                	mov    (%rbx),%eax
+  80144c:	3b 43 04             	cmp    0x4(%rbx),%eax
+  80144f:	75 26                	jne    801477 <devpipe_read+0x79>
+            if (i > 0) return i;
+  801451:	4d 85 ff             	test   %r15,%r15
+  801454:	75 77                	jne    8014cd <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  801456:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80145b:	48 89 da             	mov    %rbx,%rdx
+  80145e:	be 00 10 00 00       	mov    $0x1000,%esi
+  801463:	4c 89 e7             	mov    %r12,%rdi
+  801466:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  801469:	85 c0                	test   %eax,%eax
+  80146b:	74 72                	je     8014df <devpipe_read+0xe1>
+            sys_yield();
+  80146d:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  801470:	8b 03                	mov    (%rbx),%eax
+  801472:	3b 43 04             	cmp    0x4(%rbx),%eax
+  801475:	74 df                	je     801456 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  801477:	48 63 c8             	movslq %eax,%rcx
+  80147a:	48 89 ca             	mov    %rcx,%rdx
+  80147d:	48 c1 ea 03          	shr    $0x3,%rdx
+  801481:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  801488:	08 10 20 
+  80148b:	48 89 d0             	mov    %rdx,%rax
+  80148e:	48 f7 e6             	mul    %rsi
+  801491:	48 c1 ea 06          	shr    $0x6,%rdx
+  801495:	48 89 d0             	mov    %rdx,%rax
+  801498:	48 c1 e0 09          	shl    $0x9,%rax
+  80149c:	48 29 d0             	sub    %rdx,%rax
+  80149f:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  8014a6:	00 
+  8014a7:	48 89 c8             	mov    %rcx,%rax
+  8014aa:	48 29 d0             	sub    %rdx,%rax
+  8014ad:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  8014b2:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8014b6:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  8014ba:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8014bd:	49 83 c7 01          	add    $0x1,%r15
+  8014c1:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  8014c5:	75 83                	jne    80144a <devpipe_read+0x4c>
+    return n;
+  8014c7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8014cb:	eb 03                	jmp    8014d0 <devpipe_read+0xd2>
+            if (i > 0) return i;
+  8014cd:	4c 89 f8             	mov    %r15,%rax
+}
+  8014d0:	48 83 c4 18          	add    $0x18,%rsp
+  8014d4:	5b                   	pop    %rbx
+  8014d5:	41 5c                	pop    %r12
+  8014d7:	41 5d                	pop    %r13
+  8014d9:	41 5e                	pop    %r14
+  8014db:	41 5f                	pop    %r15
+  8014dd:	5d                   	pop    %rbp
+  8014de:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  8014df:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014e4:	eb ea                	jmp    8014d0 <devpipe_read+0xd2>
+
+00000000008014e6 <pipe>:
+pipe(int pfd[2]) {
+  8014e6:	55                   	push   %rbp
+  8014e7:	48 89 e5             	mov    %rsp,%rbp
+  8014ea:	41 55                	push   %r13
+  8014ec:	41 54                	push   %r12
+  8014ee:	53                   	push   %rbx
+  8014ef:	48 81 ec b8 00 00 00 	sub    $0xb8,%rsp
+  8014f6:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8014f9:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  8014fd:	48 b8 5f 07 80 00 00 	movabs $0x80075f,%rax
+  801504:	00 00 00 
+  801507:	ff d0                	call   *%rax
+  801509:	89 c3                	mov    %eax,%ebx
+  80150b:	85 c0                	test   %eax,%eax
+  80150d:	0f 88 51 01 00 00    	js     801664 <pipe+0x17e>
+        (res = fd_alloc_from(fd2num(fd0) + 1, &fd1)) < 0) goto err;
+  801513:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  801517:	48 b8 b8 06 80 00 00 	movabs $0x8006b8,%rax
+  80151e:	00 00 00 
+  801521:	ff d0                	call   *%rax
+  801523:	8d 78 01             	lea    0x1(%rax),%edi
+  801526:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80152a:	48 b8 e6 06 80 00 00 	movabs $0x8006e6,%rax
+  801531:	00 00 00 
+  801534:	ff d0                	call   *%rax
+  801536:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  801538:	85 c0                	test   %eax,%eax
+  80153a:	0f 88 24 01 00 00    	js     801664 <pipe+0x17e>
+    va = fd2data(fd0);
+  801540:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  801544:	48 bb ca 06 80 00 00 	movabs $0x8006ca,%rbx
+  80154b:	00 00 00 
+  80154e:	ff d3                	call   *%rbx
+  801550:	49 89 c5             	mov    %rax,%r13
+    struct RegionOp ops[] = {
+  801553:	48 8d bd 30 ff ff ff 	lea    -0xd0(%rbp),%rdi
+  80155a:	b9 14 00 00 00       	mov    $0x14,%ecx
+  80155f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801564:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+  801567:	c7 85 34 ff ff ff 46 	movl   $0x46,-0xcc(%rbp)
+  80156e:	00 00 00 
+  801571:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801575:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+  80157c:	48 c7 85 50 ff ff ff 	movq   $0x1000,-0xb0(%rbp)
+  801583:	00 10 00 00 
+  801587:	c7 85 5c ff ff ff 46 	movl   $0x46,-0xa4(%rbp)
+  80158e:	00 00 00 
+            {.type = REGION_ALLOC, .dstva = (uintptr_t)fd1, .size = PAGE_SIZE, .perm = PROT_RW | PROT_SHARE},
+  801591:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+    struct RegionOp ops[] = {
+  801595:	48 89 bd 70 ff ff ff 	mov    %rdi,-0x90(%rbp)
+  80159c:	48 c7 85 78 ff ff ff 	movq   $0x1000,-0x88(%rbp)
+  8015a3:	00 10 00 00 
+  8015a7:	c7 45 84 46 00 00 00 	movl   $0x46,-0x7c(%rbp)
+  8015ae:	4c 89 6d 98          	mov    %r13,-0x68(%rbp)
+  8015b2:	48 c7 45 a0 00 10 00 	movq   $0x1000,-0x60(%rbp)
+  8015b9:	00 
+  8015ba:	c7 45 a8 01 00 00 00 	movl   $0x1,-0x58(%rbp)
+  8015c1:	c7 45 ac 46 00 00 00 	movl   $0x46,-0x54(%rbp)
+  8015c8:	4c 89 6d b8          	mov    %r13,-0x48(%rbp)
+            {.type = REGION_MAP, .srcva = (uintptr_t)va, .dstva = (uintptr_t)fd2data(fd1), .size = PAGE_SIZE, .perm = PROT_RW | PROT_SHARE},
+  8015cc:	ff d3                	call   *%rbx
+    struct RegionOp ops[] = {
+  8015ce:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8015d2:	48 c7 45 c8 00 10 00 	movq   $0x1000,-0x38(%rbp)
+  8015d9:	00 
+    if ((res = sys_region_batch(ops, sizeof ops / sizeof *ops)) < 0) goto err1;
+  8015da:	be 04 00 00 00       	mov    $0x4,%esi
+  8015df:	48 8d bd 30 ff ff ff 	lea    -0xd0(%rbp),%rdi
+  8015e6:	48 b8 b0 03 80 00 00 	movabs $0x8003b0,%rax
+  8015ed:	00 00 00 
+  8015f0:	ff d0                	call   *%rax
+  8015f2:	89 c3                	mov    %eax,%ebx
+  8015f4:	85 c0                	test   %eax,%eax
+  8015f6:	0f 88 ad 00 00 00    	js     8016a9 <pipe+0x1c3>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8015fc:	be 00 10 00 00       	mov    $0x1000,%esi
+  801601:	4c 89 ef             	mov    %r13,%rdi
+  801604:	48 b8 1f 02 80 00 00 	movabs $0x80021f,%rax
+  80160b:	00 00 00 
+  80160e:	ff d0                	call   *%rax
+  801610:	83 f8 02             	cmp    $0x2,%eax
+  801613:	75 5f                	jne    801674 <pipe+0x18e>
+    fd0->fd_dev_id = devpipe.dev_id;
+  801615:	a1 60 40 80 00 00 00 	movabs 0x804060,%eax
+  80161c:	00 00 
+  80161e:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801622:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  801624:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801628:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  80162f:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  801633:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  801635:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801639:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  801640:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  801644:	48 bb b8 06 80 00 00 	movabs $0x8006b8,%rbx
+  80164b:	00 00 00 
+  80164e:	ff d3                	call   *%rbx
+  801650:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  801654:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  801658:	ff d3                	call   *%rbx
+  80165a:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  80165f:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  801664:	89 d8                	mov    %ebx,%eax
+  801666:	48 81 c4 b8 00 00 00 	add    $0xb8,%rsp
+  80166d:	5b                   	pop    %rbx
+  80166e:	41 5c                	pop    %r12
+  801670:	41 5d                	pop    %r13
+  801672:	5d                   	pop    %rbp
+  801673:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  801674:	48 b9 90 2d 80 00 00 	movabs $0x802d90,%rcx
+  80167b:	00 00 00 
+  80167e:	48 ba 67 2d 80 00 00 	movabs $0x802d67,%rdx
+  801685:	00 00 00 
+  801688:	be 33 00 00 00       	mov    $0x33,%esi
+  80168d:	48 bf 7c 2d 80 00 00 	movabs $0x802d7c,%rdi
+  801694:	00 00 00 
+  801697:	b8 00 00 00 00       	mov    $0x0,%eax
+  80169c:	49 b8 0e 1c 80 00 00 	movabs $0x801c0e,%r8
+  8016a3:	00 00 00 
+  8016a6:	41 ff d0             	call   *%r8
+        ops[i].type = REGION_UNMAP;
+  8016a9:	c7 85 30 ff ff ff 02 	movl   $0x2,-0xd0(%rbp)
+  8016b0:	00 00 00 
+  8016b3:	c7 85 58 ff ff ff 02 	movl   $0x2,-0xa8(%rbp)
+  8016ba:	00 00 00 
+  8016bd:	c7 45 80 02 00 00 00 	movl   $0x2,-0x80(%rbp)
+  8016c4:	c7 45 a8 02 00 00 00 	movl   $0x2,-0x58(%rbp)
+    sys_region_batch(ops, sizeof ops / sizeof *ops);
+  8016cb:	be 04 00 00 00       	mov    $0x4,%esi
+  8016d0:	48 8d bd 30 ff ff ff 	lea    -0xd0(%rbp),%rdi
+  8016d7:	48 b8 b0 03 80 00 00 	movabs $0x8003b0,%rax
+  8016de:	00 00 00 
+  8016e1:	ff d0                	call   *%rax
+  8016e3:	e9 7c ff ff ff       	jmp    801664 <pipe+0x17e>
+
+00000000008016e8 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  8016e8:	55                   	push   %rbp
+  8016e9:	48 89 e5             	mov    %rsp,%rbp
+  8016ec:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8016f0:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8016f4:	48 b8 79 07 80 00 00 	movabs $0x800779,%rax
+  8016fb:	00 00 00 
+  8016fe:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801700:	85 c0                	test   %eax,%eax
+  801702:	78 35                	js     801739 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  801704:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801708:	48 b8 ca 06 80 00 00 	movabs $0x8006ca,%rax
+  80170f:	00 00 00 
+  801712:	ff d0                	call   *%rax
+  801714:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  801717:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80171c:	be 00 10 00 00       	mov    $0x1000,%esi
+  801721:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801725:	48 b8 51 02 80 00 00 	movabs $0x800251,%rax
+  80172c:	00 00 00 
+  80172f:	ff d0                	call   *%rax
+  801731:	85 c0                	test   %eax,%eax
+  801733:	0f 94 c0             	sete   %al
+  801736:	0f b6 c0             	movzbl %al,%eax
+}
+  801739:	c9                   	leave
+  80173a:	c3                   	ret
+
+000000000080173b <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  80173b:	48 89 f8             	mov    %rdi,%rax
+  80173e:	48 c1 e8 27          	shr    $0x27,%rax
+  801742:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  801749:	01 00 00 
+  80174c:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  801750:	f6 c2 01             	test   $0x1,%dl
+  801753:	74 6d                	je     8017c2 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  801755:	48 89 f8             	mov    %rdi,%rax
+  801758:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80175c:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  801763:	01 00 00 
+  801766:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80176a:	f6 c2 01             	test   $0x1,%dl
+  80176d:	74 62                	je     8017d1 <get_uvpt_entry+0x96>
+  80176f:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  801776:	01 00 00 
+  801779:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80177d:	f6 c2 80             	test   $0x80,%dl
+  801780:	75 4f                	jne    8017d1 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  801782:	48 89 f8             	mov    %rdi,%rax
+  801785:	48 c1 e8 15          	shr    $0x15,%rax
+  801789:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  801790:	01 00 00 
+  801793:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  801797:	f6 c2 01             	test   $0x1,%dl
+  80179a:	74 44                	je     8017e0 <get_uvpt_entry+0xa5>
+  80179c:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8017a3:	01 00 00 
+  8017a6:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8017aa:	f6 c2 80             	test   $0x80,%dl
+  8017ad:	75 31                	jne    8017e0 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  8017af:	48 c1 ef 0c          	shr    $0xc,%rdi
+  8017b3:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8017ba:	01 00 00 
+  8017bd:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  8017c1:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8017c2:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  8017c9:	01 00 00 
+  8017cc:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8017d0:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8017d1:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8017d8:	01 00 00 
+  8017db:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8017df:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8017e0:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8017e7:	01 00 00 
+  8017ea:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8017ee:	c3                   	ret
+
+00000000008017ef <get_prot>:
+
+int
+get_prot(void *va) {
+  8017ef:	55                   	push   %rbp
+  8017f0:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8017f3:	48 b8 3b 17 80 00 00 	movabs $0x80173b,%rax
+  8017fa:	00 00 00 
+  8017fd:	ff d0                	call   *%rax
+  8017ff:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  801802:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  801807:	89 c1                	mov    %eax,%ecx
+  801809:	83 c9 04             	or     $0x4,%ecx
+  80180c:	f6 c2 01             	test   $0x1,%dl
+  80180f:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  801812:	89 c1                	mov    %eax,%ecx
+  801814:	83 c9 02             	or     $0x2,%ecx
+  801817:	f6 c2 02             	test   $0x2,%dl
+  80181a:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  80181d:	89 c1                	mov    %eax,%ecx
+  80181f:	83 c9 01             	or     $0x1,%ecx
+  801822:	48 85 d2             	test   %rdx,%rdx
+  801825:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  801828:	89 c1                	mov    %eax,%ecx
+  80182a:	83 c9 40             	or     $0x40,%ecx
+  80182d:	f6 c6 04             	test   $0x4,%dh
+  801830:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  801833:	5d                   	pop    %rbp
+  801834:	c3                   	ret
+
+0000000000801835 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  801835:	55                   	push   %rbp
+  801836:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  801839:	48 b8 3b 17 80 00 00 	movabs $0x80173b,%rax
+  801840:	00 00 00 
+  801843:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  801845:	48 c1 e8 06          	shr    $0x6,%rax
+  801849:	83 e0 01             	and    $0x1,%eax
+}
+  80184c:	5d                   	pop    %rbp
+  80184d:	c3                   	ret
+
+000000000080184e <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  80184e:	55                   	push   %rbp
+  80184f:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  801852:	48 b8 3b 17 80 00 00 	movabs $0x80173b,%rax
+  801859:	00 00 00 
+  80185c:	ff d0                	call   *%rax
+  80185e:	83 e0 01             	and    $0x1,%eax
+}
+  801861:	5d                   	pop    %rbp
+  801862:	c3                   	ret
+
+0000000000801863 <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  801863:	55                   	push   %rbp
+  801864:	48 89 e5             	mov    %rsp,%rbp
+  801867:	41 57                	push   %r15
+  801869:	41 56                	push   %r14
+  80186b:	41 55                	push   %r13
+  80186d:	41 54                	push   %r12
+  80186f:	53                   	push   %rbx
+  801870:	48 83 ec 38          	sub    $0x38,%rsp
+  801874:	49 89 f7             	mov    %rsi,%r15
+  801877:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+                    }
+                    continue;
+                }
+                for (int ptei = 0; ptei < PT_ENTRY_COUNT; ptei++) {
+                    uintptr_t pte_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, pdei, ptei, 0);
+                    pte_t pte = uvpt[VPT(pte_addr)];
+  80187d:	49 bd 00 00 00 00 00 	movabs $0x10000000000,%r13
+  801884:	01 00 00 
+  801887:	4d 89 e6             	mov    %r12,%r14
+  80188a:	49 89 fc             	mov    %rdi,%r12
+  80188d:	e9 19 01 00 00       	jmp    8019ab <foreach_shared_region+0x148>
+  801892:	48 89 5d b0          	mov    %rbx,-0x50(%rbp)
+  801896:	4c 89 75 a8          	mov    %r14,-0x58(%rbp)
+  80189a:	eb 52                	jmp    8018ee <foreach_shared_region+0x8b>
+                for (int ptei = 0; ptei < PT_ENTRY_COUNT; ptei++) {
+  80189c:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8018a3:	48 81 fb 00 00 20 00 	cmp    $0x200000,%rbx
+  8018aa:	74 2e                	je     8018da <foreach_shared_region+0x77>
+                    uintptr_t pte_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, pdei, ptei, 0);
+  8018ac:	48 89 df             	mov    %rbx,%rdi
+  8018af:	4c 09 f7             	or     %r14,%rdi
+                    pte_t pte = uvpt[VPT(pte_addr)];
+  8018b2:	48 89 f8             	mov    %rdi,%rax
+  8018b5:	48 c1 e8 0c          	shr    $0xc,%rax
+  8018b9:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+                    if ((pte & PTE_P) && (pte & PTE_SHARE)) {
+  8018be:	25 01 04 00 00       	and    $0x401,%eax
+  8018c3:	48 3d 01 04 00 00    	cmp    $0x401,%rax
+  8018c9:	75 d1                	jne    80189c <foreach_shared_region+0x39>
+                        fun((void*)pte_addr, (void*)(pte_addr + PAGE_SIZE), arg);
+  8018cb:	48 8d b7 00 10 00 00 	lea    0x1000(%rdi),%rsi
+  8018d2:	4c 89 fa             	mov    %r15,%rdx
+  8018d5:	41 ff d4             	call   *%r12
+  8018d8:	eb c2                	jmp    80189c <foreach_shared_region+0x39>
+            for (int pdei = 0; pdei < PD_ENTRY_COUNT; pdei++) {
+  8018da:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  8018e1:	00 
+  8018e2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8018e6:	48 3d 00 00 00 40    	cmp    $0x40000000,%rax
+  8018ec:	74 46                	je     801934 <foreach_shared_region+0xd1>
+                uintptr_t pde_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, pdei, 0, 0);
+  8018ee:	4c 8b 75 c8          	mov    -0x38(%rbp),%r14
+  8018f2:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8018f6:	49 09 c6             	or     %rax,%r14
+                pde_t pde = uvpd[VPD(pde_addr)];
+  8018f9:	4c 89 f0             	mov    %r14,%rax
+  8018fc:	48 c1 e8 15          	shr    $0x15,%rax
+  801900:	48 b9 00 00 00 80 00 	movabs $0x10080000000,%rcx
+  801907:	01 00 00 
+  80190a:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+                if (!(pde & PTE_P)) {
+  80190e:	a8 01                	test   $0x1,%al
+  801910:	74 c8                	je     8018da <foreach_shared_region+0x77>
+                if (pde & PTE_PS) {
+  801912:	48 89 c3             	mov    %rax,%rbx
+  801915:	81 e3 80 00 00 00    	and    $0x80,%ebx
+  80191b:	74 8f                	je     8018ac <foreach_shared_region+0x49>
+                    if (pde & PTE_SHARE) {
+  80191d:	f6 c4 04             	test   $0x4,%ah
+  801920:	74 b8                	je     8018da <foreach_shared_region+0x77>
+                        fun((void*)pde_addr, (void*)(pde_addr + 1024 * 1024 * 2), arg);
+  801922:	49 8d b6 00 00 20 00 	lea    0x200000(%r14),%rsi
+  801929:	4c 89 fa             	mov    %r15,%rdx
+  80192c:	4c 89 f7             	mov    %r14,%rdi
+  80192f:	41 ff d4             	call   *%r12
+  801932:	eb a6                	jmp    8018da <foreach_shared_region+0x77>
+  801934:	48 8b 5d b0          	mov    -0x50(%rbp),%rbx
+  801938:	4c 8b 75 a8          	mov    -0x58(%rbp),%r14
+        for (int pdpei = 0; pdpei < PDP_ENTRY_COUNT; pdpei++) {
+  80193c:	48 81 c3 00 00 00 40 	add    $0x40000000,%rbx
+  801943:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80194a:	00 00 00 
+  80194d:	48 39 c3             	cmp    %rax,%rbx
+  801950:	74 4c                	je     80199e <foreach_shared_region+0x13b>
+            uintptr_t pdpe_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, 0, 0, 0);
+  801952:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  801956:	48 09 d8             	or     %rbx,%rax
+  801959:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+            pdpe_t pdpe = uvpdp[VPDP(pdpe_addr)];
+  80195d:	48 c1 e8 1e          	shr    $0x1e,%rax
+  801961:	48 b9 00 00 40 80 00 	movabs $0x10080400000,%rcx
+  801968:	01 00 00 
+  80196b:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+            if (!(pdpe & PTE_P)) {
+  80196f:	a8 01                	test   $0x1,%al
+  801971:	74 c9                	je     80193c <foreach_shared_region+0xd9>
+            if (pdpe & PTE_PS) {
+  801973:	48 89 c1             	mov    %rax,%rcx
+  801976:	81 e1 80 00 00 00    	and    $0x80,%ecx
+  80197c:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  801980:	0f 84 0c ff ff ff    	je     801892 <foreach_shared_region+0x2f>
+                if (pdpe & PTE_SHARE) {
+  801986:	f6 c4 04             	test   $0x4,%ah
+  801989:	74 b1                	je     80193c <foreach_shared_region+0xd9>
+                    fun((void*)pdpe_addr, (void*)(pdpe_addr + 1024 * 1024 * 1024), arg); 
+  80198b:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  80198f:	48 8d b7 00 00 00 40 	lea    0x40000000(%rdi),%rsi
+  801996:	4c 89 fa             	mov    %r15,%rdx
+  801999:	41 ff d4             	call   *%r12
+  80199c:	eb 9e                	jmp    80193c <foreach_shared_region+0xd9>
+    for (int pml4ei = 0; pml4ei < PML4_ENTRY_COUNT; pml4ei++) {
+  80199e:	49 83 c6 01          	add    $0x1,%r14
+  8019a2:	49 81 fe 00 02 00 00 	cmp    $0x200,%r14
+  8019a9:	74 24                	je     8019cf <foreach_shared_region+0x16c>
+        pml4e_t pml4e = uvpml4[VPML4(pml4_addr)];
+  8019ab:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  8019b2:	01 00 00 
+  8019b5:	4a 8b 04 f0          	mov    (%rax,%r14,8),%rax
+        if (!(pml4e & PTE_P)) {
+  8019b9:	a8 01                	test   $0x1,%al
+  8019bb:	74 e1                	je     80199e <foreach_shared_region+0x13b>
+  8019bd:	4c 89 f0             	mov    %r14,%rax
+  8019c0:	48 c1 e0 27          	shl    $0x27,%rax
+  8019c4:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8019c8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8019cd:	eb 83                	jmp    801952 <foreach_shared_region+0xef>
+            }
+        }
+    }
+    
+    return 0;
+}
+  8019cf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019d4:	48 83 c4 38          	add    $0x38,%rsp
+  8019d8:	5b                   	pop    %rbx
+  8019d9:	41 5c                	pop    %r12
+  8019db:	41 5d                	pop    %r13
+  8019dd:	41 5e                	pop    %r14
+  8019df:	41 5f                	pop    %r15
+  8019e1:	5d                   	pop    %rbp
+  8019e2:	c3                   	ret
+
+00000000008019e3 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  8019e3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019e8:	c3                   	ret
+
+00000000008019e9 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  8019e9:	55                   	push   %rbp
+  8019ea:	48 89 e5             	mov    %rsp,%rbp
+  8019ed:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  8019f0:	48 be b4 2d 80 00 00 	movabs $0x802db4,%rsi
+  8019f7:	00 00 00 
+  8019fa:	48 b8 83 26 80 00 00 	movabs $0x802683,%rax
+  801a01:	00 00 00 
+  801a04:	ff d0                	call   *%rax
+    return 0;
+}
+  801a06:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a0b:	5d                   	pop    %rbp
+  801a0c:	c3                   	ret
+
+0000000000801a0d <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  801a0d:	55                   	push   %rbp
+  801a0e:	48 89 e5             	mov    %rsp,%rbp
+  801a11:	41 57                	push   %r15
+  801a13:	41 56                	push   %r14
+  801a15:	41 55                	push   %r13
+  801a17:	41 54                	push   %r12
+  801a19:	53                   	push   %rbx
+  801a1a:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  801a21:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  801a28:	48 85 d2             	test   %rdx,%rdx
+  801a2b:	74 7a                	je     801aa7 <devcons_write+0x9a>
+  801a2d:	49 89 d6             	mov    %rdx,%r14
+  801a30:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  801a36:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  801a3b:	49 bf 7d 28 80 00 00 	movabs $0x80287d,%r15
+  801a42:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  801a45:	4c 89 f3             	mov    %r14,%rbx
+  801a48:	48 29 f3             	sub    %rsi,%rbx
+  801a4b:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  801a50:	48 39 c3             	cmp    %rax,%rbx
+  801a53:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  801a57:	4c 63 eb             	movslq %ebx,%r13
+  801a5a:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  801a61:	48 01 c6             	add    %rax,%rsi
+  801a64:	4c 89 ea             	mov    %r13,%rdx
+  801a67:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  801a6e:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  801a71:	4c 89 ee             	mov    %r13,%rsi
+  801a74:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  801a7b:	48 b8 f4 00 80 00 00 	movabs $0x8000f4,%rax
+  801a82:	00 00 00 
+  801a85:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  801a87:	41 01 dc             	add    %ebx,%r12d
+  801a8a:	49 63 f4             	movslq %r12d,%rsi
+  801a8d:	4c 39 f6             	cmp    %r14,%rsi
+  801a90:	72 b3                	jb     801a45 <devcons_write+0x38>
+    return res;
+  801a92:	49 63 c4             	movslq %r12d,%rax
+}
+  801a95:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  801a9c:	5b                   	pop    %rbx
+  801a9d:	41 5c                	pop    %r12
+  801a9f:	41 5d                	pop    %r13
+  801aa1:	41 5e                	pop    %r14
+  801aa3:	41 5f                	pop    %r15
+  801aa5:	5d                   	pop    %rbp
+  801aa6:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  801aa7:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  801aad:	eb e3                	jmp    801a92 <devcons_write+0x85>
+
+0000000000801aaf <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  801aaf:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  801ab2:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ab7:	48 85 c0             	test   %rax,%rax
+  801aba:	74 55                	je     801b11 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  801abc:	55                   	push   %rbp
+  801abd:	48 89 e5             	mov    %rsp,%rbp
+  801ac0:	41 55                	push   %r13
+  801ac2:	41 54                	push   %r12
+  801ac4:	53                   	push   %rbx
+  801ac5:	48 83 ec 08          	sub    $0x8,%rsp
+  801ac9:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  801acc:	48 bb 21 01 80 00 00 	movabs $0x800121,%rbx
+  801ad3:	00 00 00 
+  801ad6:	49 bc ee 01 80 00 00 	movabs $0x8001ee,%r12
+  801add:	00 00 00 
+  801ae0:	eb 03                	jmp    801ae5 <devcons_read+0x36>
+  801ae2:	41 ff d4             	call   *%r12
+  801ae5:	ff d3                	call   *%rbx
+  801ae7:	85 c0                	test   %eax,%eax
+  801ae9:	74 f7                	je     801ae2 <devcons_read+0x33>
+    if (c < 0) return c;
+  801aeb:	48 63 d0             	movslq %eax,%rdx
+  801aee:	78 13                	js     801b03 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  801af0:	ba 00 00 00 00       	mov    $0x0,%edx
+  801af5:	83 f8 04             	cmp    $0x4,%eax
+  801af8:	74 09                	je     801b03 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  801afa:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  801afe:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  801b03:	48 89 d0             	mov    %rdx,%rax
+  801b06:	48 83 c4 08          	add    $0x8,%rsp
+  801b0a:	5b                   	pop    %rbx
+  801b0b:	41 5c                	pop    %r12
+  801b0d:	41 5d                	pop    %r13
+  801b0f:	5d                   	pop    %rbp
+  801b10:	c3                   	ret
+  801b11:	48 89 d0             	mov    %rdx,%rax
+  801b14:	c3                   	ret
+
+0000000000801b15 <cputchar>:
+cputchar(int ch) {
+  801b15:	55                   	push   %rbp
+  801b16:	48 89 e5             	mov    %rsp,%rbp
+  801b19:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  801b1d:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  801b21:	be 01 00 00 00       	mov    $0x1,%esi
+  801b26:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  801b2a:	48 b8 f4 00 80 00 00 	movabs $0x8000f4,%rax
+  801b31:	00 00 00 
+  801b34:	ff d0                	call   *%rax
+}
+  801b36:	c9                   	leave
+  801b37:	c3                   	ret
+
+0000000000801b38 <getchar>:
+getchar(void) {
+  801b38:	55                   	push   %rbp
+  801b39:	48 89 e5             	mov    %rsp,%rbp
+  801b3c:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  801b40:	ba 01 00 00 00       	mov    $0x1,%edx
+  801b45:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  801b49:	bf 00 00 00 00       	mov    $0x0,%edi
+  801b4e:	48 b8 5c 0a 80 00 00 	movabs $0x800a5c,%rax
+  801b55:	00 00 00 
+  801b58:	ff d0                	call   *%rax
+  801b5a:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  801b5c:	85 c0                	test   %eax,%eax
+  801b5e:	78 06                	js     801b66 <getchar+0x2e>
+  801b60:	74 08                	je     801b6a <getchar+0x32>
+  801b62:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  801b66:	89 d0                	mov    %edx,%eax
+  801b68:	c9                   	leave
+  801b69:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  801b6a:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  801b6f:	eb f5                	jmp    801b66 <getchar+0x2e>
+
+0000000000801b71 <iscons>:
+iscons(int fdnum) {
+  801b71:	55                   	push   %rbp
+  801b72:	48 89 e5             	mov    %rsp,%rbp
+  801b75:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  801b79:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801b7d:	48 b8 79 07 80 00 00 	movabs $0x800779,%rax
+  801b84:	00 00 00 
+  801b87:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801b89:	85 c0                	test   %eax,%eax
+  801b8b:	78 18                	js     801ba5 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  801b8d:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801b91:	48 b8 a0 40 80 00 00 	movabs $0x8040a0,%rax
+  801b98:	00 00 00 
+  801b9b:	8b 00                	mov    (%rax),%eax
+  801b9d:	39 02                	cmp    %eax,(%rdx)
+  801b9f:	0f 94 c0             	sete   %al
+  801ba2:	0f b6 c0             	movzbl %al,%eax
+}
+  801ba5:	c9                   	leave
+  801ba6:	c3                   	ret
+
+0000000000801ba7 <opencons>:
+opencons(void) {
+  801ba7:	55                   	push   %rbp
+  801ba8:	48 89 e5             	mov    %rsp,%rbp
+  801bab:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  801baf:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  801bb3:	48 b8 5f 07 80 00 00 	movabs $0x80075f,%rax
+  801bba:	00 00 00 
+  801bbd:	ff d0                	call   *%rax
+  801bbf:	85 c0                	test   %eax,%eax
+  801bc1:	78 49                	js     801c0c <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  801bc3:	b9 46 00 00 00       	mov    $0x46,%ecx
+  801bc8:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801bcd:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  801bd1:	bf 00 00 00 00       	mov    $0x0,%edi
+  801bd6:	48 b8 7d 02 80 00 00 	movabs $0x80027d,%rax
+  801bdd:	00 00 00 
+  801be0:	ff d0                	call   *%rax
+  801be2:	85 c0                	test   %eax,%eax
+  801be4:	78 26                	js     801c0c <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  801be6:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801bea:	a1 a0 40 80 00 00 00 	movabs 0x8040a0,%eax
+  801bf1:	00 00 
+  801bf3:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  801bf5:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801bf9:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  801c00:	48 b8 b8 06 80 00 00 	movabs $0x8006b8,%rax
+  801c07:	00 00 00 
+  801c0a:	ff d0                	call   *%rax
+}
+  801c0c:	c9                   	leave
+  801c0d:	c3                   	ret
+
+0000000000801c0e <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  801c0e:	55                   	push   %rbp
+  801c0f:	48 89 e5             	mov    %rsp,%rbp
+  801c12:	41 56                	push   %r14
+  801c14:	41 55                	push   %r13
+  801c16:	41 54                	push   %r12
+  801c18:	53                   	push   %rbx
+  801c19:	48 83 ec 50          	sub    $0x50,%rsp
+  801c1d:	49 89 fc             	mov    %rdi,%r12
+  801c20:	41 89 f5             	mov    %esi,%r13d
+  801c23:	48 89 d3             	mov    %rdx,%rbx
+  801c26:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  801c2a:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  801c2e:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  801c32:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  801c39:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801c3d:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  801c41:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  801c45:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  801c49:	48 b8 00 40 80 00 00 	movabs $0x804000,%rax
+  801c50:	00 00 00 
+  801c53:	4c 8b 30             	mov    (%rax),%r14
+  801c56:	48 b8 bd 01 80 00 00 	movabs $0x8001bd,%rax
+  801c5d:	00 00 00 
+  801c60:	ff d0                	call   *%rax
+  801c62:	89 c6                	mov    %eax,%esi
+  801c64:	45 89 e8             	mov    %r13d,%r8d
+  801c67:	4c 89 e1             	mov    %r12,%rcx
+  801c6a:	4c 89 f2             	mov    %r14,%rdx
+  801c6d:	48 bf c0 2d 80 00 00 	movabs $0x802dc0,%rdi
+  801c74:	00 00 00 
+  801c77:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c7c:	49 bc 5e 1d 80 00 00 	movabs $0x801d5e,%r12
+  801c83:	00 00 00 
+  801c86:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  801c89:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  801c8d:	48 89 df             	mov    %rbx,%rdi
+  801c90:	48 b8 fa 1c 80 00 00 	movabs $0x801cfa,%rax
+  801c97:	00 00 00 
+  801c9a:	ff d0                	call   *%rax
+    cprintf("\n");
+  801c9c:	48 bf 13 2d 80 00 00 	movabs $0x802d13,%rdi
+  801ca3:	00 00 00 
+  801ca6:	b8 00 00 00 00       	mov    $0x0,%eax
+  801cab:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  801cae:	cc                   	int3
+  801caf:	eb fd                	jmp    801cae <_panic+0xa0>
+
+0000000000801cb1 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  801cb1:	55                   	push   %rbp
+  801cb2:	48 89 e5             	mov    %rsp,%rbp
+  801cb5:	53                   	push   %rbx
+  801cb6:	48 83 ec 08          	sub    $0x8,%rsp
+  801cba:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  801cbd:	8b 06                	mov    (%rsi),%eax
+  801cbf:	8d 50 01             	lea    0x1(%rax),%edx
+  801cc2:	89 16                	mov    %edx,(%rsi)
+  801cc4:	48 98                	cltq
+  801cc6:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  801ccb:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  801cd1:	74 0a                	je     801cdd <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  801cd3:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  801cd7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801cdb:	c9                   	leave
+  801cdc:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  801cdd:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  801ce1:	be ff 00 00 00       	mov    $0xff,%esi
+  801ce6:	48 b8 f4 00 80 00 00 	movabs $0x8000f4,%rax
+  801ced:	00 00 00 
+  801cf0:	ff d0                	call   *%rax
+        state->offset = 0;
+  801cf2:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  801cf8:	eb d9                	jmp    801cd3 <putch+0x22>
+
+0000000000801cfa <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  801cfa:	55                   	push   %rbp
+  801cfb:	48 89 e5             	mov    %rsp,%rbp
+  801cfe:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  801d05:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  801d08:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  801d0f:	b9 21 00 00 00       	mov    $0x21,%ecx
+  801d14:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d19:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  801d1c:	48 89 f1             	mov    %rsi,%rcx
+  801d1f:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  801d26:	48 bf b1 1c 80 00 00 	movabs $0x801cb1,%rdi
+  801d2d:	00 00 00 
+  801d30:	48 b8 ae 1e 80 00 00 	movabs $0x801eae,%rax
+  801d37:	00 00 00 
+  801d3a:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  801d3c:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  801d43:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  801d4a:	48 b8 f4 00 80 00 00 	movabs $0x8000f4,%rax
+  801d51:	00 00 00 
+  801d54:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  801d56:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  801d5c:	c9                   	leave
+  801d5d:	c3                   	ret
+
+0000000000801d5e <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  801d5e:	55                   	push   %rbp
+  801d5f:	48 89 e5             	mov    %rsp,%rbp
+  801d62:	48 83 ec 50          	sub    $0x50,%rsp
+  801d66:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  801d6a:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  801d6e:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801d72:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  801d76:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  801d7a:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  801d81:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801d85:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801d89:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  801d8d:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  801d91:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  801d95:	48 b8 fa 1c 80 00 00 	movabs $0x801cfa,%rax
+  801d9c:	00 00 00 
+  801d9f:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  801da1:	c9                   	leave
+  801da2:	c3                   	ret
+
+0000000000801da3 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  801da3:	55                   	push   %rbp
+  801da4:	48 89 e5             	mov    %rsp,%rbp
+  801da7:	41 57                	push   %r15
+  801da9:	41 56                	push   %r14
+  801dab:	41 55                	push   %r13
+  801dad:	41 54                	push   %r12
+  801daf:	53                   	push   %rbx
+  801db0:	48 83 ec 18          	sub    $0x18,%rsp
+  801db4:	49 89 fc             	mov    %rdi,%r12
+  801db7:	49 89 f5             	mov    %rsi,%r13
+  801dba:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801dbe:	8b 45 10             	mov    0x10(%rbp),%eax
+  801dc1:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  801dc4:	41 89 cf             	mov    %ecx,%r15d
+  801dc7:	4c 39 fa             	cmp    %r15,%rdx
+  801dca:	73 5b                	jae    801e27 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  801dcc:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  801dd0:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  801dd4:	85 db                	test   %ebx,%ebx
+  801dd6:	7e 0e                	jle    801de6 <print_num+0x43>
+            putch(padc, put_arg);
+  801dd8:	4c 89 ee             	mov    %r13,%rsi
+  801ddb:	44 89 f7             	mov    %r14d,%edi
+  801dde:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  801de1:	83 eb 01             	sub    $0x1,%ebx
+  801de4:	75 f2                	jne    801dd8 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  801de6:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  801dea:	48 b9 f4 2d 80 00 00 	movabs $0x802df4,%rcx
+  801df1:	00 00 00 
+  801df4:	48 b8 e3 2d 80 00 00 	movabs $0x802de3,%rax
+  801dfb:	00 00 00 
+  801dfe:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  801e02:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801e06:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e0b:	49 f7 f7             	div    %r15
+  801e0e:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  801e12:	4c 89 ee             	mov    %r13,%rsi
+  801e15:	41 ff d4             	call   *%r12
+}
+  801e18:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  801e1c:	5b                   	pop    %rbx
+  801e1d:	41 5c                	pop    %r12
+  801e1f:	41 5d                	pop    %r13
+  801e21:	41 5e                	pop    %r14
+  801e23:	41 5f                	pop    %r15
+  801e25:	5d                   	pop    %rbp
+  801e26:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  801e27:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801e2b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e30:	49 f7 f7             	div    %r15
+  801e33:	48 83 ec 08          	sub    $0x8,%rsp
+  801e37:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  801e3b:	52                   	push   %rdx
+  801e3c:	45 0f be c9          	movsbl %r9b,%r9d
+  801e40:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  801e44:	48 89 c2             	mov    %rax,%rdx
+  801e47:	48 b8 a3 1d 80 00 00 	movabs $0x801da3,%rax
+  801e4e:	00 00 00 
+  801e51:	ff d0                	call   *%rax
+  801e53:	48 83 c4 10          	add    $0x10,%rsp
+  801e57:	eb 8d                	jmp    801de6 <print_num+0x43>
+
+0000000000801e59 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  801e59:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  801e5d:	48 8b 06             	mov    (%rsi),%rax
+  801e60:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  801e64:	73 0a                	jae    801e70 <sprintputch+0x17>
+        *state->start++ = ch;
+  801e66:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801e6a:	48 89 16             	mov    %rdx,(%rsi)
+  801e6d:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  801e70:	c3                   	ret
+
+0000000000801e71 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  801e71:	55                   	push   %rbp
+  801e72:	48 89 e5             	mov    %rsp,%rbp
+  801e75:	48 83 ec 50          	sub    $0x50,%rsp
+  801e79:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801e7d:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  801e81:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  801e85:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  801e8c:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801e90:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801e94:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  801e98:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  801e9c:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  801ea0:	48 b8 ae 1e 80 00 00 	movabs $0x801eae,%rax
+  801ea7:	00 00 00 
+  801eaa:	ff d0                	call   *%rax
+}
+  801eac:	c9                   	leave
+  801ead:	c3                   	ret
+
+0000000000801eae <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  801eae:	55                   	push   %rbp
+  801eaf:	48 89 e5             	mov    %rsp,%rbp
+  801eb2:	41 57                	push   %r15
+  801eb4:	41 56                	push   %r14
+  801eb6:	41 55                	push   %r13
+  801eb8:	41 54                	push   %r12
+  801eba:	53                   	push   %rbx
+  801ebb:	48 83 ec 38          	sub    $0x38,%rsp
+  801ebf:	49 89 fe             	mov    %rdi,%r14
+  801ec2:	49 89 f5             	mov    %rsi,%r13
+  801ec5:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  801ec8:	48 8b 01             	mov    (%rcx),%rax
+  801ecb:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  801ecf:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  801ed3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801ed7:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  801edb:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  801edf:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  801ee3:	0f b6 3b             	movzbl (%rbx),%edi
+  801ee6:	40 80 ff 25          	cmp    $0x25,%dil
+  801eea:	74 18                	je     801f04 <vprintfmt+0x56>
+            if (!ch) return;
+  801eec:	40 84 ff             	test   %dil,%dil
+  801eef:	0f 84 b1 06 00 00    	je     8025a6 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  801ef5:	40 0f b6 ff          	movzbl %dil,%edi
+  801ef9:	4c 89 ee             	mov    %r13,%rsi
+  801efc:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  801eff:	4c 89 e3             	mov    %r12,%rbx
+  801f02:	eb db                	jmp    801edf <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  801f04:	be 00 00 00 00       	mov    $0x0,%esi
+  801f09:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  801f0d:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  801f12:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  801f18:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  801f1f:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  801f23:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  801f28:	41 0f b6 04 24       	movzbl (%r12),%eax
+  801f2d:	88 45 a0             	mov    %al,-0x60(%rbp)
+  801f30:	83 e8 23             	sub    $0x23,%eax
+  801f33:	3c 57                	cmp    $0x57,%al
+  801f35:	0f 87 51 06 00 00    	ja     80258c <vprintfmt+0x6de>
+  801f3b:	0f b6 c0             	movzbl %al,%eax
+  801f3e:	48 b9 a0 2f 80 00 00 	movabs $0x802fa0,%rcx
+  801f45:	00 00 00 
+  801f48:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  801f4b:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  801f4e:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  801f52:	eb cf                	jmp    801f23 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  801f54:	49 89 dc             	mov    %rbx,%r12
+  801f57:	be 01 00 00 00       	mov    $0x1,%esi
+  801f5c:	eb c5                	jmp    801f23 <vprintfmt+0x75>
+            padc = ch;
+  801f5e:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  801f62:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  801f65:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801f68:	eb b9                	jmp    801f23 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  801f6a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801f6d:	83 f8 2f             	cmp    $0x2f,%eax
+  801f70:	77 24                	ja     801f96 <vprintfmt+0xe8>
+  801f72:	89 c1                	mov    %eax,%ecx
+  801f74:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  801f78:	83 c0 08             	add    $0x8,%eax
+  801f7b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801f7e:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  801f81:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  801f84:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  801f88:	79 99                	jns    801f23 <vprintfmt+0x75>
+                width = precision;
+  801f8a:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  801f8e:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  801f94:	eb 8d                	jmp    801f23 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  801f96:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  801f9a:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  801f9e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801fa2:	eb da                	jmp    801f7e <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  801fa4:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  801fa9:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  801fad:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  801fb3:	3c 39                	cmp    $0x39,%al
+  801fb5:	77 1c                	ja     801fd3 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  801fb7:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  801fbb:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  801fbf:	0f b6 c0             	movzbl %al,%eax
+  801fc2:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  801fc7:	0f b6 03             	movzbl (%rbx),%eax
+  801fca:	3c 39                	cmp    $0x39,%al
+  801fcc:	76 e9                	jbe    801fb7 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  801fce:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  801fd1:	eb b1                	jmp    801f84 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  801fd3:	49 89 dc             	mov    %rbx,%r12
+  801fd6:	eb ac                	jmp    801f84 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  801fd8:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  801fdb:	85 c9                	test   %ecx,%ecx
+  801fdd:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fe2:	0f 49 c1             	cmovns %ecx,%eax
+  801fe5:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  801fe8:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801feb:	e9 33 ff ff ff       	jmp    801f23 <vprintfmt+0x75>
+            lflag++;
+  801ff0:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  801ff3:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801ff6:	e9 28 ff ff ff       	jmp    801f23 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  801ffb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801ffe:	83 f8 2f             	cmp    $0x2f,%eax
+  802001:	77 19                	ja     80201c <vprintfmt+0x16e>
+  802003:	89 c2                	mov    %eax,%edx
+  802005:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802009:	83 c0 08             	add    $0x8,%eax
+  80200c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80200f:	8b 3a                	mov    (%rdx),%edi
+  802011:	4c 89 ee             	mov    %r13,%rsi
+  802014:	41 ff d6             	call   *%r14
+            break;
+  802017:	e9 c3 fe ff ff       	jmp    801edf <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  80201c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802020:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802024:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802028:	eb e5                	jmp    80200f <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  80202a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80202d:	83 f8 2f             	cmp    $0x2f,%eax
+  802030:	77 5a                	ja     80208c <vprintfmt+0x1de>
+  802032:	89 c2                	mov    %eax,%edx
+  802034:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802038:	83 c0 08             	add    $0x8,%eax
+  80203b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  80203e:	8b 02                	mov    (%rdx),%eax
+  802040:	89 c1                	mov    %eax,%ecx
+  802042:	f7 d9                	neg    %ecx
+  802044:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  802047:	83 f9 15             	cmp    $0x15,%ecx
+  80204a:	7f 4e                	jg     80209a <vprintfmt+0x1ec>
+  80204c:	48 63 c1             	movslq %ecx,%rax
+  80204f:	48 ba 60 32 80 00 00 	movabs $0x803260,%rdx
+  802056:	00 00 00 
+  802059:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80205d:	48 85 c0             	test   %rax,%rax
+  802060:	74 38                	je     80209a <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  802062:	48 89 c1             	mov    %rax,%rcx
+  802065:	48 ba 79 2d 80 00 00 	movabs $0x802d79,%rdx
+  80206c:	00 00 00 
+  80206f:	4c 89 ee             	mov    %r13,%rsi
+  802072:	4c 89 f7             	mov    %r14,%rdi
+  802075:	b8 00 00 00 00       	mov    $0x0,%eax
+  80207a:	49 b8 71 1e 80 00 00 	movabs $0x801e71,%r8
+  802081:	00 00 00 
+  802084:	41 ff d0             	call   *%r8
+  802087:	e9 53 fe ff ff       	jmp    801edf <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  80208c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802090:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802094:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802098:	eb a4                	jmp    80203e <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  80209a:	48 ba 0c 2e 80 00 00 	movabs $0x802e0c,%rdx
+  8020a1:	00 00 00 
+  8020a4:	4c 89 ee             	mov    %r13,%rsi
+  8020a7:	4c 89 f7             	mov    %r14,%rdi
+  8020aa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020af:	49 b8 71 1e 80 00 00 	movabs $0x801e71,%r8
+  8020b6:	00 00 00 
+  8020b9:	41 ff d0             	call   *%r8
+  8020bc:	e9 1e fe ff ff       	jmp    801edf <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8020c1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8020c4:	83 f8 2f             	cmp    $0x2f,%eax
+  8020c7:	77 6c                	ja     802135 <vprintfmt+0x287>
+  8020c9:	89 c2                	mov    %eax,%edx
+  8020cb:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8020cf:	83 c0 08             	add    $0x8,%eax
+  8020d2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8020d5:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  8020d8:	48 85 d2             	test   %rdx,%rdx
+  8020db:	48 b8 05 2e 80 00 00 	movabs $0x802e05,%rax
+  8020e2:	00 00 00 
+  8020e5:	48 0f 45 c2          	cmovne %rdx,%rax
+  8020e9:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  8020ed:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8020f1:	7e 06                	jle    8020f9 <vprintfmt+0x24b>
+  8020f3:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  8020f7:	75 4a                	jne    802143 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8020f9:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8020fd:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  802101:	0f b6 00             	movzbl (%rax),%eax
+  802104:	84 c0                	test   %al,%al
+  802106:	0f 85 9a 00 00 00    	jne    8021a6 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  80210c:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80210f:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  802113:	85 c0                	test   %eax,%eax
+  802115:	0f 8e c4 fd ff ff    	jle    801edf <vprintfmt+0x31>
+  80211b:	4c 89 ee             	mov    %r13,%rsi
+  80211e:	bf 20 00 00 00       	mov    $0x20,%edi
+  802123:	41 ff d6             	call   *%r14
+  802126:	41 83 ec 01          	sub    $0x1,%r12d
+  80212a:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  80212e:	75 eb                	jne    80211b <vprintfmt+0x26d>
+  802130:	e9 aa fd ff ff       	jmp    801edf <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  802135:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802139:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80213d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802141:	eb 92                	jmp    8020d5 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  802143:	49 63 f7             	movslq %r15d,%rsi
+  802146:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  80214a:	48 b8 60 26 80 00 00 	movabs $0x802660,%rax
+  802151:	00 00 00 
+  802154:	ff d0                	call   *%rax
+  802156:	48 89 c2             	mov    %rax,%rdx
+  802159:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80215c:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  80215e:	8d 70 ff             	lea    -0x1(%rax),%esi
+  802161:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  802164:	85 c0                	test   %eax,%eax
+  802166:	7e 91                	jle    8020f9 <vprintfmt+0x24b>
+  802168:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  80216d:	4c 89 ee             	mov    %r13,%rsi
+  802170:	44 89 e7             	mov    %r12d,%edi
+  802173:	41 ff d6             	call   *%r14
+  802176:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  80217a:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80217d:	83 f8 ff             	cmp    $0xffffffff,%eax
+  802180:	75 eb                	jne    80216d <vprintfmt+0x2bf>
+  802182:	e9 72 ff ff ff       	jmp    8020f9 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  802187:	0f b6 f8             	movzbl %al,%edi
+  80218a:	4c 89 ee             	mov    %r13,%rsi
+  80218d:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  802190:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  802194:	49 83 c4 01          	add    $0x1,%r12
+  802198:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  80219e:	84 c0                	test   %al,%al
+  8021a0:	0f 84 66 ff ff ff    	je     80210c <vprintfmt+0x25e>
+  8021a6:	45 85 ff             	test   %r15d,%r15d
+  8021a9:	78 0a                	js     8021b5 <vprintfmt+0x307>
+  8021ab:	41 83 ef 01          	sub    $0x1,%r15d
+  8021af:	0f 88 57 ff ff ff    	js     80210c <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8021b5:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  8021b9:	74 cc                	je     802187 <vprintfmt+0x2d9>
+  8021bb:	8d 50 e0             	lea    -0x20(%rax),%edx
+  8021be:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  8021c3:	80 fa 5e             	cmp    $0x5e,%dl
+  8021c6:	77 c2                	ja     80218a <vprintfmt+0x2dc>
+  8021c8:	eb bd                	jmp    802187 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  8021ca:	40 84 f6             	test   %sil,%sil
+  8021cd:	75 26                	jne    8021f5 <vprintfmt+0x347>
+    switch (lflag) {
+  8021cf:	85 d2                	test   %edx,%edx
+  8021d1:	74 59                	je     80222c <vprintfmt+0x37e>
+  8021d3:	83 fa 01             	cmp    $0x1,%edx
+  8021d6:	74 7b                	je     802253 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  8021d8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8021db:	83 f8 2f             	cmp    $0x2f,%eax
+  8021de:	0f 87 96 00 00 00    	ja     80227a <vprintfmt+0x3cc>
+  8021e4:	89 c2                	mov    %eax,%edx
+  8021e6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8021ea:	83 c0 08             	add    $0x8,%eax
+  8021ed:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8021f0:	4c 8b 22             	mov    (%rdx),%r12
+  8021f3:	eb 17                	jmp    80220c <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  8021f5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8021f8:	83 f8 2f             	cmp    $0x2f,%eax
+  8021fb:	77 21                	ja     80221e <vprintfmt+0x370>
+  8021fd:	89 c2                	mov    %eax,%edx
+  8021ff:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802203:	83 c0 08             	add    $0x8,%eax
+  802206:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802209:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  80220c:	4d 85 e4             	test   %r12,%r12
+  80220f:	78 7a                	js     80228b <vprintfmt+0x3dd>
+            num = i;
+  802211:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  802214:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  802219:	e9 50 02 00 00       	jmp    80246e <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  80221e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802222:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802226:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80222a:	eb dd                	jmp    802209 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  80222c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80222f:	83 f8 2f             	cmp    $0x2f,%eax
+  802232:	77 11                	ja     802245 <vprintfmt+0x397>
+  802234:	89 c2                	mov    %eax,%edx
+  802236:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80223a:	83 c0 08             	add    $0x8,%eax
+  80223d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802240:	4c 63 22             	movslq (%rdx),%r12
+  802243:	eb c7                	jmp    80220c <vprintfmt+0x35e>
+  802245:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802249:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80224d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802251:	eb ed                	jmp    802240 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  802253:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802256:	83 f8 2f             	cmp    $0x2f,%eax
+  802259:	77 11                	ja     80226c <vprintfmt+0x3be>
+  80225b:	89 c2                	mov    %eax,%edx
+  80225d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802261:	83 c0 08             	add    $0x8,%eax
+  802264:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802267:	4c 8b 22             	mov    (%rdx),%r12
+  80226a:	eb a0                	jmp    80220c <vprintfmt+0x35e>
+  80226c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802270:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802274:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802278:	eb ed                	jmp    802267 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  80227a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80227e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802282:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802286:	e9 65 ff ff ff       	jmp    8021f0 <vprintfmt+0x342>
+                putch('-', put_arg);
+  80228b:	4c 89 ee             	mov    %r13,%rsi
+  80228e:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  802293:	41 ff d6             	call   *%r14
+                i = -i;
+  802296:	49 f7 dc             	neg    %r12
+  802299:	e9 73 ff ff ff       	jmp    802211 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  80229e:	40 84 f6             	test   %sil,%sil
+  8022a1:	75 32                	jne    8022d5 <vprintfmt+0x427>
+    switch (lflag) {
+  8022a3:	85 d2                	test   %edx,%edx
+  8022a5:	74 5d                	je     802304 <vprintfmt+0x456>
+  8022a7:	83 fa 01             	cmp    $0x1,%edx
+  8022aa:	0f 84 82 00 00 00    	je     802332 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  8022b0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8022b3:	83 f8 2f             	cmp    $0x2f,%eax
+  8022b6:	0f 87 a5 00 00 00    	ja     802361 <vprintfmt+0x4b3>
+  8022bc:	89 c2                	mov    %eax,%edx
+  8022be:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8022c2:	83 c0 08             	add    $0x8,%eax
+  8022c5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8022c8:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8022cb:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  8022d0:	e9 99 01 00 00       	jmp    80246e <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8022d5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8022d8:	83 f8 2f             	cmp    $0x2f,%eax
+  8022db:	77 19                	ja     8022f6 <vprintfmt+0x448>
+  8022dd:	89 c2                	mov    %eax,%edx
+  8022df:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8022e3:	83 c0 08             	add    $0x8,%eax
+  8022e6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8022e9:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8022ec:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8022f1:	e9 78 01 00 00       	jmp    80246e <vprintfmt+0x5c0>
+  8022f6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8022fa:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8022fe:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802302:	eb e5                	jmp    8022e9 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  802304:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802307:	83 f8 2f             	cmp    $0x2f,%eax
+  80230a:	77 18                	ja     802324 <vprintfmt+0x476>
+  80230c:	89 c2                	mov    %eax,%edx
+  80230e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802312:	83 c0 08             	add    $0x8,%eax
+  802315:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802318:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  80231a:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  80231f:	e9 4a 01 00 00       	jmp    80246e <vprintfmt+0x5c0>
+  802324:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802328:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80232c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802330:	eb e6                	jmp    802318 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  802332:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802335:	83 f8 2f             	cmp    $0x2f,%eax
+  802338:	77 19                	ja     802353 <vprintfmt+0x4a5>
+  80233a:	89 c2                	mov    %eax,%edx
+  80233c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802340:	83 c0 08             	add    $0x8,%eax
+  802343:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802346:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  802349:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  80234e:	e9 1b 01 00 00       	jmp    80246e <vprintfmt+0x5c0>
+  802353:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802357:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80235b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80235f:	eb e5                	jmp    802346 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  802361:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802365:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802369:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80236d:	e9 56 ff ff ff       	jmp    8022c8 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  802372:	40 84 f6             	test   %sil,%sil
+  802375:	75 2e                	jne    8023a5 <vprintfmt+0x4f7>
+    switch (lflag) {
+  802377:	85 d2                	test   %edx,%edx
+  802379:	74 59                	je     8023d4 <vprintfmt+0x526>
+  80237b:	83 fa 01             	cmp    $0x1,%edx
+  80237e:	74 7f                	je     8023ff <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  802380:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802383:	83 f8 2f             	cmp    $0x2f,%eax
+  802386:	0f 87 9f 00 00 00    	ja     80242b <vprintfmt+0x57d>
+  80238c:	89 c2                	mov    %eax,%edx
+  80238e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802392:	83 c0 08             	add    $0x8,%eax
+  802395:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802398:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  80239b:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  8023a0:	e9 c9 00 00 00       	jmp    80246e <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8023a5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8023a8:	83 f8 2f             	cmp    $0x2f,%eax
+  8023ab:	77 19                	ja     8023c6 <vprintfmt+0x518>
+  8023ad:	89 c2                	mov    %eax,%edx
+  8023af:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8023b3:	83 c0 08             	add    $0x8,%eax
+  8023b6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8023b9:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8023bc:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8023c1:	e9 a8 00 00 00       	jmp    80246e <vprintfmt+0x5c0>
+  8023c6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8023ca:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8023ce:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8023d2:	eb e5                	jmp    8023b9 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  8023d4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8023d7:	83 f8 2f             	cmp    $0x2f,%eax
+  8023da:	77 15                	ja     8023f1 <vprintfmt+0x543>
+  8023dc:	89 c2                	mov    %eax,%edx
+  8023de:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8023e2:	83 c0 08             	add    $0x8,%eax
+  8023e5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8023e8:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  8023ea:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  8023ef:	eb 7d                	jmp    80246e <vprintfmt+0x5c0>
+  8023f1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8023f5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8023f9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8023fd:	eb e9                	jmp    8023e8 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  8023ff:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802402:	83 f8 2f             	cmp    $0x2f,%eax
+  802405:	77 16                	ja     80241d <vprintfmt+0x56f>
+  802407:	89 c2                	mov    %eax,%edx
+  802409:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80240d:	83 c0 08             	add    $0x8,%eax
+  802410:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802413:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  802416:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  80241b:	eb 51                	jmp    80246e <vprintfmt+0x5c0>
+  80241d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802421:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802425:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802429:	eb e8                	jmp    802413 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  80242b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80242f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802433:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802437:	e9 5c ff ff ff       	jmp    802398 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  80243c:	4c 89 ee             	mov    %r13,%rsi
+  80243f:	bf 30 00 00 00       	mov    $0x30,%edi
+  802444:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  802447:	4c 89 ee             	mov    %r13,%rsi
+  80244a:	bf 78 00 00 00       	mov    $0x78,%edi
+  80244f:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  802452:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802455:	83 f8 2f             	cmp    $0x2f,%eax
+  802458:	77 47                	ja     8024a1 <vprintfmt+0x5f3>
+  80245a:	89 c2                	mov    %eax,%edx
+  80245c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802460:	83 c0 08             	add    $0x8,%eax
+  802463:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802466:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  802469:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  80246e:	48 83 ec 08          	sub    $0x8,%rsp
+  802472:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  802476:	0f 94 c0             	sete   %al
+  802479:	0f b6 c0             	movzbl %al,%eax
+  80247c:	50                   	push   %rax
+  80247d:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  802482:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  802486:	4c 89 ee             	mov    %r13,%rsi
+  802489:	4c 89 f7             	mov    %r14,%rdi
+  80248c:	48 b8 a3 1d 80 00 00 	movabs $0x801da3,%rax
+  802493:	00 00 00 
+  802496:	ff d0                	call   *%rax
+            break;
+  802498:	48 83 c4 10          	add    $0x10,%rsp
+  80249c:	e9 3e fa ff ff       	jmp    801edf <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  8024a1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8024a5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8024a9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8024ad:	eb b7                	jmp    802466 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  8024af:	40 84 f6             	test   %sil,%sil
+  8024b2:	75 2b                	jne    8024df <vprintfmt+0x631>
+    switch (lflag) {
+  8024b4:	85 d2                	test   %edx,%edx
+  8024b6:	74 56                	je     80250e <vprintfmt+0x660>
+  8024b8:	83 fa 01             	cmp    $0x1,%edx
+  8024bb:	74 7f                	je     80253c <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  8024bd:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8024c0:	83 f8 2f             	cmp    $0x2f,%eax
+  8024c3:	0f 87 a2 00 00 00    	ja     80256b <vprintfmt+0x6bd>
+  8024c9:	89 c2                	mov    %eax,%edx
+  8024cb:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8024cf:	83 c0 08             	add    $0x8,%eax
+  8024d2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8024d5:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8024d8:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  8024dd:	eb 8f                	jmp    80246e <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8024df:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8024e2:	83 f8 2f             	cmp    $0x2f,%eax
+  8024e5:	77 19                	ja     802500 <vprintfmt+0x652>
+  8024e7:	89 c2                	mov    %eax,%edx
+  8024e9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8024ed:	83 c0 08             	add    $0x8,%eax
+  8024f0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8024f3:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8024f6:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8024fb:	e9 6e ff ff ff       	jmp    80246e <vprintfmt+0x5c0>
+  802500:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802504:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802508:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80250c:	eb e5                	jmp    8024f3 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  80250e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802511:	83 f8 2f             	cmp    $0x2f,%eax
+  802514:	77 18                	ja     80252e <vprintfmt+0x680>
+  802516:	89 c2                	mov    %eax,%edx
+  802518:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80251c:	83 c0 08             	add    $0x8,%eax
+  80251f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802522:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  802524:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  802529:	e9 40 ff ff ff       	jmp    80246e <vprintfmt+0x5c0>
+  80252e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802532:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802536:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80253a:	eb e6                	jmp    802522 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  80253c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80253f:	83 f8 2f             	cmp    $0x2f,%eax
+  802542:	77 19                	ja     80255d <vprintfmt+0x6af>
+  802544:	89 c2                	mov    %eax,%edx
+  802546:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80254a:	83 c0 08             	add    $0x8,%eax
+  80254d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802550:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  802553:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  802558:	e9 11 ff ff ff       	jmp    80246e <vprintfmt+0x5c0>
+  80255d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802561:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802565:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802569:	eb e5                	jmp    802550 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  80256b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80256f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802573:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802577:	e9 59 ff ff ff       	jmp    8024d5 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  80257c:	4c 89 ee             	mov    %r13,%rsi
+  80257f:	bf 25 00 00 00       	mov    $0x25,%edi
+  802584:	41 ff d6             	call   *%r14
+            break;
+  802587:	e9 53 f9 ff ff       	jmp    801edf <vprintfmt+0x31>
+            putch('%', put_arg);
+  80258c:	4c 89 ee             	mov    %r13,%rsi
+  80258f:	bf 25 00 00 00       	mov    $0x25,%edi
+  802594:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  802597:	48 83 eb 01          	sub    $0x1,%rbx
+  80259b:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  80259f:	75 f6                	jne    802597 <vprintfmt+0x6e9>
+  8025a1:	e9 39 f9 ff ff       	jmp    801edf <vprintfmt+0x31>
+}
+  8025a6:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8025aa:	5b                   	pop    %rbx
+  8025ab:	41 5c                	pop    %r12
+  8025ad:	41 5d                	pop    %r13
+  8025af:	41 5e                	pop    %r14
+  8025b1:	41 5f                	pop    %r15
+  8025b3:	5d                   	pop    %rbp
+  8025b4:	c3                   	ret
+
+00000000008025b5 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  8025b5:	55                   	push   %rbp
+  8025b6:	48 89 e5             	mov    %rsp,%rbp
+  8025b9:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  8025bd:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8025c1:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  8025c6:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  8025ca:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  8025d1:	48 85 ff             	test   %rdi,%rdi
+  8025d4:	74 2b                	je     802601 <vsnprintf+0x4c>
+  8025d6:	48 85 f6             	test   %rsi,%rsi
+  8025d9:	74 26                	je     802601 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  8025db:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8025df:	48 bf 59 1e 80 00 00 	movabs $0x801e59,%rdi
+  8025e6:	00 00 00 
+  8025e9:	48 b8 ae 1e 80 00 00 	movabs $0x801eae,%rax
+  8025f0:	00 00 00 
+  8025f3:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  8025f5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8025f9:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  8025fc:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  8025ff:	c9                   	leave
+  802600:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  802601:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802606:	eb f7                	jmp    8025ff <vsnprintf+0x4a>
+
+0000000000802608 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  802608:	55                   	push   %rbp
+  802609:	48 89 e5             	mov    %rsp,%rbp
+  80260c:	48 83 ec 50          	sub    $0x50,%rsp
+  802610:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  802614:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  802618:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  80261c:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  802623:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802627:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80262b:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80262f:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  802633:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  802637:	48 b8 b5 25 80 00 00 	movabs $0x8025b5,%rax
+  80263e:	00 00 00 
+  802641:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  802643:	c9                   	leave
+  802644:	c3                   	ret
+
+0000000000802645 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  802645:	80 3f 00             	cmpb   $0x0,(%rdi)
+  802648:	74 10                	je     80265a <strlen+0x15>
+    size_t n = 0;
+  80264a:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  80264f:	48 83 c0 01          	add    $0x1,%rax
+  802653:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  802657:	75 f6                	jne    80264f <strlen+0xa>
+  802659:	c3                   	ret
+    size_t n = 0;
+  80265a:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  80265f:	c3                   	ret
+
+0000000000802660 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  802660:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  802663:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  802668:	48 85 f6             	test   %rsi,%rsi
+  80266b:	74 11                	je     80267e <strnlen+0x1e>
+  80266d:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  802671:	74 0c                	je     80267f <strnlen+0x1f>
+  802673:	48 83 c2 01          	add    $0x1,%rdx
+  802677:	48 39 d0             	cmp    %rdx,%rax
+  80267a:	75 f1                	jne    80266d <strnlen+0xd>
+  80267c:	eb 04                	jmp    802682 <strnlen+0x22>
+  80267e:	c3                   	ret
+  80267f:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  802682:	c3                   	ret
+
+0000000000802683 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  802683:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  802686:	ba 00 00 00 00       	mov    $0x0,%edx
+  80268b:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  80268f:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  802692:	48 83 c2 01          	add    $0x1,%rdx
+  802696:	84 c9                	test   %cl,%cl
+  802698:	75 f1                	jne    80268b <strcpy+0x8>
+        ;
+    return res;
+}
+  80269a:	c3                   	ret
+
+000000000080269b <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  80269b:	55                   	push   %rbp
+  80269c:	48 89 e5             	mov    %rsp,%rbp
+  80269f:	41 54                	push   %r12
+  8026a1:	53                   	push   %rbx
+  8026a2:	48 89 fb             	mov    %rdi,%rbx
+  8026a5:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  8026a8:	48 b8 45 26 80 00 00 	movabs $0x802645,%rax
+  8026af:	00 00 00 
+  8026b2:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  8026b4:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  8026b8:	4c 89 e6             	mov    %r12,%rsi
+  8026bb:	48 b8 83 26 80 00 00 	movabs $0x802683,%rax
+  8026c2:	00 00 00 
+  8026c5:	ff d0                	call   *%rax
+    return dst;
+}
+  8026c7:	48 89 d8             	mov    %rbx,%rax
+  8026ca:	5b                   	pop    %rbx
+  8026cb:	41 5c                	pop    %r12
+  8026cd:	5d                   	pop    %rbp
+  8026ce:	c3                   	ret
+
+00000000008026cf <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8026cf:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  8026d2:	48 85 d2             	test   %rdx,%rdx
+  8026d5:	74 1f                	je     8026f6 <strncpy+0x27>
+  8026d7:	48 01 fa             	add    %rdi,%rdx
+  8026da:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  8026dd:	48 83 c1 01          	add    $0x1,%rcx
+  8026e1:	44 0f b6 06          	movzbl (%rsi),%r8d
+  8026e5:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  8026e9:	41 80 f8 01          	cmp    $0x1,%r8b
+  8026ed:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  8026f1:	48 39 ca             	cmp    %rcx,%rdx
+  8026f4:	75 e7                	jne    8026dd <strncpy+0xe>
+    }
+    return ret;
+}
+  8026f6:	c3                   	ret
+
+00000000008026f7 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  8026f7:	48 89 f8             	mov    %rdi,%rax
+  8026fa:	48 85 d2             	test   %rdx,%rdx
+  8026fd:	74 24                	je     802723 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  8026ff:	48 83 ea 01          	sub    $0x1,%rdx
+  802703:	74 1b                	je     802720 <strlcpy+0x29>
+  802705:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  802709:	0f b6 16             	movzbl (%rsi),%edx
+  80270c:	84 d2                	test   %dl,%dl
+  80270e:	74 10                	je     802720 <strlcpy+0x29>
+            *dst++ = *src++;
+  802710:	48 83 c6 01          	add    $0x1,%rsi
+  802714:	48 83 c0 01          	add    $0x1,%rax
+  802718:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  80271b:	48 39 c8             	cmp    %rcx,%rax
+  80271e:	75 e9                	jne    802709 <strlcpy+0x12>
+        *dst = '\0';
+  802720:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  802723:	48 29 f8             	sub    %rdi,%rax
+}
+  802726:	c3                   	ret
+
+0000000000802727 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  802727:	0f b6 07             	movzbl (%rdi),%eax
+  80272a:	84 c0                	test   %al,%al
+  80272c:	74 13                	je     802741 <strcmp+0x1a>
+  80272e:	38 06                	cmp    %al,(%rsi)
+  802730:	75 0f                	jne    802741 <strcmp+0x1a>
+  802732:	48 83 c7 01          	add    $0x1,%rdi
+  802736:	48 83 c6 01          	add    $0x1,%rsi
+  80273a:	0f b6 07             	movzbl (%rdi),%eax
+  80273d:	84 c0                	test   %al,%al
+  80273f:	75 ed                	jne    80272e <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  802741:	0f b6 c0             	movzbl %al,%eax
+  802744:	0f b6 16             	movzbl (%rsi),%edx
+  802747:	29 d0                	sub    %edx,%eax
+}
+  802749:	c3                   	ret
+
+000000000080274a <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  80274a:	48 85 d2             	test   %rdx,%rdx
+  80274d:	74 1f                	je     80276e <strncmp+0x24>
+  80274f:	0f b6 07             	movzbl (%rdi),%eax
+  802752:	84 c0                	test   %al,%al
+  802754:	74 1e                	je     802774 <strncmp+0x2a>
+  802756:	3a 06                	cmp    (%rsi),%al
+  802758:	75 1a                	jne    802774 <strncmp+0x2a>
+  80275a:	48 83 c7 01          	add    $0x1,%rdi
+  80275e:	48 83 c6 01          	add    $0x1,%rsi
+  802762:	48 83 ea 01          	sub    $0x1,%rdx
+  802766:	75 e7                	jne    80274f <strncmp+0x5>
+
+    if (!n) return 0;
+  802768:	b8 00 00 00 00       	mov    $0x0,%eax
+  80276d:	c3                   	ret
+  80276e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802773:	c3                   	ret
+  802774:	48 85 d2             	test   %rdx,%rdx
+  802777:	74 09                	je     802782 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  802779:	0f b6 07             	movzbl (%rdi),%eax
+  80277c:	0f b6 16             	movzbl (%rsi),%edx
+  80277f:	29 d0                	sub    %edx,%eax
+  802781:	c3                   	ret
+    if (!n) return 0;
+  802782:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802787:	c3                   	ret
+
+0000000000802788 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  802788:	0f b6 17             	movzbl (%rdi),%edx
+  80278b:	84 d2                	test   %dl,%dl
+  80278d:	74 18                	je     8027a7 <strchr+0x1f>
+        if (*str == c) {
+  80278f:	0f be d2             	movsbl %dl,%edx
+  802792:	39 f2                	cmp    %esi,%edx
+  802794:	74 17                	je     8027ad <strchr+0x25>
+    for (; *str; str++) {
+  802796:	48 83 c7 01          	add    $0x1,%rdi
+  80279a:	0f b6 17             	movzbl (%rdi),%edx
+  80279d:	84 d2                	test   %dl,%dl
+  80279f:	75 ee                	jne    80278f <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  8027a1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027a6:	c3                   	ret
+  8027a7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027ac:	c3                   	ret
+  8027ad:	48 89 f8             	mov    %rdi,%rax
+}
+  8027b0:	c3                   	ret
+
+00000000008027b1 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  8027b1:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  8027b4:	0f b6 17             	movzbl (%rdi),%edx
+  8027b7:	84 d2                	test   %dl,%dl
+  8027b9:	74 13                	je     8027ce <strfind+0x1d>
+  8027bb:	0f be d2             	movsbl %dl,%edx
+  8027be:	39 f2                	cmp    %esi,%edx
+  8027c0:	74 0b                	je     8027cd <strfind+0x1c>
+  8027c2:	48 83 c0 01          	add    $0x1,%rax
+  8027c6:	0f b6 10             	movzbl (%rax),%edx
+  8027c9:	84 d2                	test   %dl,%dl
+  8027cb:	75 ee                	jne    8027bb <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  8027cd:	c3                   	ret
+  8027ce:	c3                   	ret
+
+00000000008027cf <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  8027cf:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  8027d2:	48 89 f8             	mov    %rdi,%rax
+  8027d5:	48 f7 d8             	neg    %rax
+  8027d8:	83 e0 07             	and    $0x7,%eax
+  8027db:	49 89 d1             	mov    %rdx,%r9
+  8027de:	49 29 c1             	sub    %rax,%r9
+  8027e1:	78 36                	js     802819 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  8027e3:	40 0f b6 c6          	movzbl %sil,%eax
+  8027e7:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  8027ee:	01 01 01 
+  8027f1:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  8027f5:	40 f6 c7 07          	test   $0x7,%dil
+  8027f9:	75 38                	jne    802833 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  8027fb:	4c 89 c9             	mov    %r9,%rcx
+  8027fe:	48 c1 f9 03          	sar    $0x3,%rcx
+  802802:	74 0c                	je     802810 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  802804:	fc                   	cld
+  802805:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  802808:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  80280c:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  802810:	4d 85 c9             	test   %r9,%r9
+  802813:	75 45                	jne    80285a <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  802815:	4c 89 c0             	mov    %r8,%rax
+  802818:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  802819:	48 85 d2             	test   %rdx,%rdx
+  80281c:	74 f7                	je     802815 <memset+0x46>
+  80281e:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  802821:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  802824:	48 83 c0 01          	add    $0x1,%rax
+  802828:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  80282c:	48 39 c2             	cmp    %rax,%rdx
+  80282f:	75 f3                	jne    802824 <memset+0x55>
+  802831:	eb e2                	jmp    802815 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  802833:	40 f6 c7 01          	test   $0x1,%dil
+  802837:	74 06                	je     80283f <memset+0x70>
+  802839:	88 07                	mov    %al,(%rdi)
+  80283b:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  80283f:	40 f6 c7 02          	test   $0x2,%dil
+  802843:	74 07                	je     80284c <memset+0x7d>
+  802845:	66 89 07             	mov    %ax,(%rdi)
+  802848:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  80284c:	40 f6 c7 04          	test   $0x4,%dil
+  802850:	74 a9                	je     8027fb <memset+0x2c>
+  802852:	89 07                	mov    %eax,(%rdi)
+  802854:	48 83 c7 04          	add    $0x4,%rdi
+  802858:	eb a1                	jmp    8027fb <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  80285a:	41 f6 c1 04          	test   $0x4,%r9b
+  80285e:	74 06                	je     802866 <memset+0x97>
+  802860:	89 07                	mov    %eax,(%rdi)
+  802862:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  802866:	41 f6 c1 02          	test   $0x2,%r9b
+  80286a:	74 07                	je     802873 <memset+0xa4>
+  80286c:	66 89 07             	mov    %ax,(%rdi)
+  80286f:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  802873:	41 f6 c1 01          	test   $0x1,%r9b
+  802877:	74 9c                	je     802815 <memset+0x46>
+  802879:	88 07                	mov    %al,(%rdi)
+  80287b:	eb 98                	jmp    802815 <memset+0x46>
+
+000000000080287d <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  80287d:	48 89 f8             	mov    %rdi,%rax
+  802880:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  802883:	48 39 fe             	cmp    %rdi,%rsi
+  802886:	73 3b                	jae    8028c3 <memmove+0x46>
+  802888:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  80288c:	48 39 d7             	cmp    %rdx,%rdi
+  80288f:	73 32                	jae    8028c3 <memmove+0x46>
+        s += n;
+        d += n;
+  802891:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  802895:	48 89 d6             	mov    %rdx,%rsi
+  802898:	48 09 fe             	or     %rdi,%rsi
+  80289b:	48 09 ce             	or     %rcx,%rsi
+  80289e:	40 f6 c6 07          	test   $0x7,%sil
+  8028a2:	75 12                	jne    8028b6 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  8028a4:	48 83 ef 08          	sub    $0x8,%rdi
+  8028a8:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  8028ac:	48 c1 e9 03          	shr    $0x3,%rcx
+  8028b0:	fd                   	std
+  8028b1:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  8028b4:	fc                   	cld
+  8028b5:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  8028b6:	48 83 ef 01          	sub    $0x1,%rdi
+  8028ba:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  8028be:	fd                   	std
+  8028bf:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  8028c1:	eb f1                	jmp    8028b4 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  8028c3:	48 89 f2             	mov    %rsi,%rdx
+  8028c6:	48 09 c2             	or     %rax,%rdx
+  8028c9:	48 09 ca             	or     %rcx,%rdx
+  8028cc:	f6 c2 07             	test   $0x7,%dl
+  8028cf:	75 0c                	jne    8028dd <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  8028d1:	48 c1 e9 03          	shr    $0x3,%rcx
+  8028d5:	48 89 c7             	mov    %rax,%rdi
+  8028d8:	fc                   	cld
+  8028d9:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  8028dc:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  8028dd:	48 89 c7             	mov    %rax,%rdi
+  8028e0:	fc                   	cld
+  8028e1:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  8028e3:	c3                   	ret
+
+00000000008028e4 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  8028e4:	55                   	push   %rbp
+  8028e5:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  8028e8:	48 b8 7d 28 80 00 00 	movabs $0x80287d,%rax
+  8028ef:	00 00 00 
+  8028f2:	ff d0                	call   *%rax
+}
+  8028f4:	5d                   	pop    %rbp
+  8028f5:	c3                   	ret
+
+00000000008028f6 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  8028f6:	55                   	push   %rbp
+  8028f7:	48 89 e5             	mov    %rsp,%rbp
+  8028fa:	41 57                	push   %r15
+  8028fc:	41 56                	push   %r14
+  8028fe:	41 55                	push   %r13
+  802900:	41 54                	push   %r12
+  802902:	53                   	push   %rbx
+  802903:	48 83 ec 08          	sub    $0x8,%rsp
+  802907:	49 89 fe             	mov    %rdi,%r14
+  80290a:	49 89 f7             	mov    %rsi,%r15
+  80290d:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  802910:	48 89 f7             	mov    %rsi,%rdi
+  802913:	48 b8 45 26 80 00 00 	movabs $0x802645,%rax
+  80291a:	00 00 00 
+  80291d:	ff d0                	call   *%rax
+  80291f:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  802922:	48 89 de             	mov    %rbx,%rsi
+  802925:	4c 89 f7             	mov    %r14,%rdi
+  802928:	48 b8 60 26 80 00 00 	movabs $0x802660,%rax
+  80292f:	00 00 00 
+  802932:	ff d0                	call   *%rax
+  802934:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  802937:	48 39 c3             	cmp    %rax,%rbx
+  80293a:	74 36                	je     802972 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  80293c:	48 89 d8             	mov    %rbx,%rax
+  80293f:	4c 29 e8             	sub    %r13,%rax
+  802942:	49 39 c4             	cmp    %rax,%r12
+  802945:	73 31                	jae    802978 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  802947:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  80294c:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  802950:	4c 89 fe             	mov    %r15,%rsi
+  802953:	48 b8 e4 28 80 00 00 	movabs $0x8028e4,%rax
+  80295a:	00 00 00 
+  80295d:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  80295f:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  802963:	48 83 c4 08          	add    $0x8,%rsp
+  802967:	5b                   	pop    %rbx
+  802968:	41 5c                	pop    %r12
+  80296a:	41 5d                	pop    %r13
+  80296c:	41 5e                	pop    %r14
+  80296e:	41 5f                	pop    %r15
+  802970:	5d                   	pop    %rbp
+  802971:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  802972:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  802976:	eb eb                	jmp    802963 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  802978:	48 83 eb 01          	sub    $0x1,%rbx
+  80297c:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  802980:	48 89 da             	mov    %rbx,%rdx
+  802983:	4c 89 fe             	mov    %r15,%rsi
+  802986:	48 b8 e4 28 80 00 00 	movabs $0x8028e4,%rax
+  80298d:	00 00 00 
+  802990:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  802992:	49 01 de             	add    %rbx,%r14
+  802995:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  80299a:	eb c3                	jmp    80295f <strlcat+0x69>
+
+000000000080299c <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  80299c:	48 85 d2             	test   %rdx,%rdx
+  80299f:	74 2d                	je     8029ce <memcmp+0x32>
+  8029a1:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  8029a6:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  8029aa:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  8029af:	44 38 c1             	cmp    %r8b,%cl
+  8029b2:	75 0f                	jne    8029c3 <memcmp+0x27>
+    while (n-- > 0) {
+  8029b4:	48 83 c0 01          	add    $0x1,%rax
+  8029b8:	48 39 c2             	cmp    %rax,%rdx
+  8029bb:	75 e9                	jne    8029a6 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  8029bd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029c2:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  8029c3:	0f b6 c1             	movzbl %cl,%eax
+  8029c6:	45 0f b6 c0          	movzbl %r8b,%r8d
+  8029ca:	44 29 c0             	sub    %r8d,%eax
+  8029cd:	c3                   	ret
+    return 0;
+  8029ce:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8029d3:	c3                   	ret
+
+00000000008029d4 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  8029d4:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  8029d8:	48 39 c7             	cmp    %rax,%rdi
+  8029db:	73 0f                	jae    8029ec <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  8029dd:	40 38 37             	cmp    %sil,(%rdi)
+  8029e0:	74 0e                	je     8029f0 <memfind+0x1c>
+    for (; src < end; src++) {
+  8029e2:	48 83 c7 01          	add    $0x1,%rdi
+  8029e6:	48 39 f8             	cmp    %rdi,%rax
+  8029e9:	75 f2                	jne    8029dd <memfind+0x9>
+  8029eb:	c3                   	ret
+  8029ec:	48 89 f8             	mov    %rdi,%rax
+  8029ef:	c3                   	ret
+  8029f0:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  8029f3:	c3                   	ret
+
+00000000008029f4 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  8029f4:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  8029f7:	0f b6 37             	movzbl (%rdi),%esi
+  8029fa:	40 80 fe 20          	cmp    $0x20,%sil
+  8029fe:	74 06                	je     802a06 <strtol+0x12>
+  802a00:	40 80 fe 09          	cmp    $0x9,%sil
+  802a04:	75 13                	jne    802a19 <strtol+0x25>
+  802a06:	48 83 c7 01          	add    $0x1,%rdi
+  802a0a:	0f b6 37             	movzbl (%rdi),%esi
+  802a0d:	40 80 fe 20          	cmp    $0x20,%sil
+  802a11:	74 f3                	je     802a06 <strtol+0x12>
+  802a13:	40 80 fe 09          	cmp    $0x9,%sil
+  802a17:	74 ed                	je     802a06 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  802a19:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  802a1c:	83 e0 fd             	and    $0xfffffffd,%eax
+  802a1f:	3c 01                	cmp    $0x1,%al
+  802a21:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  802a25:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  802a2b:	75 0f                	jne    802a3c <strtol+0x48>
+  802a2d:	80 3f 30             	cmpb   $0x30,(%rdi)
+  802a30:	74 14                	je     802a46 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  802a32:	85 d2                	test   %edx,%edx
+  802a34:	b8 0a 00 00 00       	mov    $0xa,%eax
+  802a39:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  802a3c:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  802a41:	4c 63 ca             	movslq %edx,%r9
+  802a44:	eb 36                	jmp    802a7c <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  802a46:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  802a4a:	74 0f                	je     802a5b <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  802a4c:	85 d2                	test   %edx,%edx
+  802a4e:	75 ec                	jne    802a3c <strtol+0x48>
+        s++;
+  802a50:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  802a54:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  802a59:	eb e1                	jmp    802a3c <strtol+0x48>
+        s += 2;
+  802a5b:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  802a5f:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  802a64:	eb d6                	jmp    802a3c <strtol+0x48>
+            dig -= '0';
+  802a66:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  802a69:	44 0f b6 c1          	movzbl %cl,%r8d
+  802a6d:	41 39 d0             	cmp    %edx,%r8d
+  802a70:	7d 21                	jge    802a93 <strtol+0x9f>
+        val = val * base + dig;
+  802a72:	49 0f af c1          	imul   %r9,%rax
+  802a76:	0f b6 c9             	movzbl %cl,%ecx
+  802a79:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  802a7c:	48 83 c7 01          	add    $0x1,%rdi
+  802a80:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  802a84:	80 f9 39             	cmp    $0x39,%cl
+  802a87:	76 dd                	jbe    802a66 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  802a89:	80 f9 7b             	cmp    $0x7b,%cl
+  802a8c:	77 05                	ja     802a93 <strtol+0x9f>
+            dig -= 'a' - 10;
+  802a8e:	83 e9 57             	sub    $0x57,%ecx
+  802a91:	eb d6                	jmp    802a69 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  802a93:	4d 85 d2             	test   %r10,%r10
+  802a96:	74 03                	je     802a9b <strtol+0xa7>
+  802a98:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  802a9b:	48 89 c2             	mov    %rax,%rdx
+  802a9e:	48 f7 da             	neg    %rdx
+  802aa1:	40 80 fe 2d          	cmp    $0x2d,%sil
+  802aa5:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  802aa9:	c3                   	ret
+
+0000000000802aaa <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  802aaa:	55                   	push   %rbp
+  802aab:	48 89 e5             	mov    %rsp,%rbp
+  802aae:	41 55                	push   %r13
+  802ab0:	41 54                	push   %r12
+  802ab2:	53                   	push   %rbx
+  802ab3:	48 83 ec 08          	sub    $0x8,%rsp
+  802ab7:	49 89 fc             	mov    %rdi,%r12
+  802aba:	48 89 f7             	mov    %rsi,%rdi
+  802abd:	48 89 d3             	mov    %rdx,%rbx
+  802ac0:	49 89 cd             	mov    %rcx,%r13
+    // LAB 9: Your code here:
+    int res = sys_ipc_recv(!pg ? (void*)MAX_USER_ADDRESS : pg, !size ? 0 : *size);
+  802ac3:	be 00 00 00 00       	mov    $0x0,%esi
+  802ac8:	48 85 d2             	test   %rdx,%rdx
+  802acb:	74 03                	je     802ad0 <ipc_recv+0x26>
+  802acd:	48 8b 32             	mov    (%rdx),%rsi
+  802ad0:	48 85 ff             	test   %rdi,%rdi
+  802ad3:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802ada:	00 00 00 
+  802add:	48 0f 44 f8          	cmove  %rax,%rdi
+  802ae1:	48 b8 4f 06 80 00 00 	movabs $0x80064f,%rax
+  802ae8:	00 00 00 
+  802aeb:	ff d0                	call   *%rax
+    if (res < 0) {
+  802aed:	85 c0                	test   %eax,%eax
+  802aef:	78 66                	js     802b57 <ipc_recv+0xad>
+        if (size) {
+            *size = 0;
+        }
+        return res;
+    }
+    if (from_env_store) {
+  802af1:	4d 85 e4             	test   %r12,%r12
+  802af4:	74 14                	je     802b0a <ipc_recv+0x60>
+        *from_env_store = thisenv->env_ipc_from;
+  802af6:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802afd:	00 00 00 
+  802b00:	8b 80 ac 01 00 00    	mov    0x1ac(%rax),%eax
+  802b06:	41 89 04 24          	mov    %eax,(%r12)
+    }
+    if (perm_store) {
+  802b0a:	4d 85 ed             	test   %r13,%r13
+  802b0d:	74 14                	je     802b23 <ipc_recv+0x79>
+        *perm_store = thisenv->env_ipc_perm;
+  802b0f:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802b16:	00 00 00 
+  802b19:	8b 80 b0 01 00 00    	mov    0x1b0(%rax),%eax
+  802b1f:	41 89 45 00          	mov    %eax,0x0(%r13)
+    }
+    if (size) {
+  802b23:	48 85 db             	test   %rbx,%rbx
+  802b26:	74 14                	je     802b3c <ipc_recv+0x92>
+        *size = thisenv->env_ipc_maxsz;
+  802b28:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802b2f:	00 00 00 
+  802b32:	48 8b 80 a0 01 00 00 	mov    0x1a0(%rax),%rax
+  802b39:	48 89 03             	mov    %rax,(%rbx)
+    }
+    return thisenv->env_ipc_value;
+  802b3c:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802b43:	00 00 00 
+  802b46:	8b 80 a8 01 00 00    	mov    0x1a8(%rax),%eax
+}
+  802b4c:	48 83 c4 08          	add    $0x8,%rsp
+  802b50:	5b                   	pop    %rbx
+  802b51:	41 5c                	pop    %r12
+  802b53:	41 5d                	pop    %r13
+  802b55:	5d                   	pop    %rbp
+  802b56:	c3                   	ret
+        if (from_env_store) {
+  802b57:	4d 85 e4             	test   %r12,%r12
+  802b5a:	74 08                	je     802b64 <ipc_recv+0xba>
+            *from_env_store = 0;
+  802b5c:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  802b63:	00 
+        if (perm_store) {
+  802b64:	4d 85 ed             	test   %r13,%r13
+  802b67:	74 08                	je     802b71 <ipc_recv+0xc7>
+            *perm_store = 0;
+  802b69:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  802b70:	00 
+        if (size) {
+  802b71:	48 85 db             	test   %rbx,%rbx
+  802b74:	74 d6                	je     802b4c <ipc_recv+0xa2>
+            *size = 0;
+  802b76:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  802b7d:	eb cd                	jmp    802b4c <ipc_recv+0xa2>
+
+0000000000802b7f <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  802b7f:	55                   	push   %rbp
+  802b80:	48 89 e5             	mov    %rsp,%rbp
+  802b83:	41 57                	push   %r15
+  802b85:	41 56                	push   %r14
+  802b87:	41 55                	push   %r13
+  802b89:	41 54                	push   %r12
+  802b8b:	53                   	push   %rbx
+  802b8c:	48 83 ec 18          	sub    $0x18,%rsp
+  802b90:	41 89 fd             	mov    %edi,%r13d
+  802b93:	89 75 cc             	mov    %esi,-0x34(%rbp)
+  802b96:	49 89 cc             	mov    %rcx,%r12
+  802b99:	44 89 45 c8          	mov    %r8d,-0x38(%rbp)
+    // LAB 9: Your code here:
+    int res = 0;
+    while ((res = sys_ipc_try_send(to_env, val, !pg ? (void*)MAX_USER_ADDRESS : pg, size, perm)) < 0) {
+  802b9d:	48 85 d2             	test   %rdx,%rdx
+  802ba0:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802ba7:	00 00 00 
+  802baa:	48 0f 45 c2          	cmovne %rdx,%rax
+  802bae:	48 89 c3             	mov    %rax,%rbx
+  802bb1:	49 be 23 06 80 00 00 	movabs $0x800623,%r14
+  802bb8:	00 00 00 
+        if (res != -E_IPC_NOT_RECV) {
+            panic("sys_ipc_try_send failed: %i", res);
+        }
+        sys_yield();
+  802bbb:	49 bf ee 01 80 00 00 	movabs $0x8001ee,%r15
+  802bc2:	00 00 00 
+    while ((res = sys_ipc_try_send(to_env, val, !pg ? (void*)MAX_USER_ADDRESS : pg, size, perm)) < 0) {
+  802bc5:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  802bc8:	44 8b 45 c8          	mov    -0x38(%rbp),%r8d
+  802bcc:	4c 89 e1             	mov    %r12,%rcx
+  802bcf:	48 89 da             	mov    %rbx,%rdx
+  802bd2:	44 89 ef             	mov    %r13d,%edi
+  802bd5:	41 ff d6             	call   *%r14
+  802bd8:	85 c0                	test   %eax,%eax
+  802bda:	79 37                	jns    802c13 <ipc_send+0x94>
+        if (res != -E_IPC_NOT_RECV) {
+  802bdc:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  802bdf:	75 05                	jne    802be6 <ipc_send+0x67>
+        sys_yield();
+  802be1:	41 ff d7             	call   *%r15
+  802be4:	eb df                	jmp    802bc5 <ipc_send+0x46>
+            panic("sys_ipc_try_send failed: %i", res);
+  802be6:	89 c1                	mov    %eax,%ecx
+  802be8:	48 ba 2f 33 80 00 00 	movabs $0x80332f,%rdx
+  802bef:	00 00 00 
+  802bf2:	be 40 00 00 00       	mov    $0x40,%esi
+  802bf7:	48 bf 4b 33 80 00 00 	movabs $0x80334b,%rdi
+  802bfe:	00 00 00 
+  802c01:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c06:	49 b8 0e 1c 80 00 00 	movabs $0x801c0e,%r8
+  802c0d:	00 00 00 
+  802c10:	41 ff d0             	call   *%r8
+    }
+    return;
+}
+  802c13:	48 83 c4 18          	add    $0x18,%rsp
+  802c17:	5b                   	pop    %rbx
+  802c18:	41 5c                	pop    %r12
+  802c1a:	41 5d                	pop    %r13
+  802c1c:	41 5e                	pop    %r14
+  802c1e:	41 5f                	pop    %r15
+  802c20:	5d                   	pop    %rbp
+  802c21:	c3                   	ret
+
+0000000000802c22 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  802c22:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  802c27:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  802c2e:	00 00 00 
+  802c31:	48 69 d0 d0 01 00 00 	imul   $0x1d0,%rax,%rdx
+  802c38:	48 01 ca             	add    %rcx,%rdx
+  802c3b:	8b 92 e8 00 00 00    	mov    0xe8(%rdx),%edx
+  802c41:	39 fa                	cmp    %edi,%edx
+  802c43:	74 12                	je     802c57 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  802c45:	48 83 c0 01          	add    $0x1,%rax
+  802c49:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  802c4f:	75 e0                	jne    802c31 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  802c51:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802c56:	c3                   	ret
+            return envs[i].env_id;
+  802c57:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+  802c5e:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  802c65:	00 00 00 
+  802c68:	48 01 d0             	add    %rdx,%rax
+  802c6b:	8b 80 e0 00 00 00    	mov    0xe0(%rax),%eax
+  802c71:	c3                   	ret
+  802c72:	66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+
+0000000000802c78 <__rodata_start>:
+  802c78:	3c 75                	cmp    $0x75,%al
+  802c7a:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802c7b:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  802c7f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802c80:	3e 00 66 0f          	ds add %ah,0xf(%rsi)
+  802c84:	1f                   	(bad)
+  802c85:	44 00 00             	add    %r8b,(%rax)
+  802c88:	73 79                	jae    802d03 <__rodata_start+0x8b>
+  802c8a:	73 63                	jae    802cef <__rodata_start+0x77>
+  802c8c:	61                   	(bad)
+  802c8d:	6c                   	insb   (%dx),%es:(%rdi)
+  802c8e:	6c                   	insb   (%dx),%es:(%rdi)
+  802c8f:	20 25 7a 64 20 72    	and    %ah,0x7220647a(%rip)        # 72a0910f <__bss_end+0x7220110f>
+  802c95:	65 74 75             	gs je  802d0d <__rodata_start+0x95>
+  802c98:	72 6e                	jb     802d08 <__rodata_start+0x90>
+  802c9a:	65 64 20 25 7a 64 20 	gs and %ah,%fs:0x2820647a(%rip)        # 28a0911c <__bss_end+0x2820111c>
+  802ca1:	28 
+  802ca2:	3e 20 30             	ds and %dh,(%rax)
+  802ca5:	29 00                	sub    %eax,(%rax)
+  802ca7:	6c                   	insb   (%dx),%es:(%rdi)
+  802ca8:	69 62 2f 73 79 73 63 	imul   $0x63737973,0x2f(%rdx),%esp
+  802caf:	61                   	(bad)
+  802cb0:	6c                   	insb   (%dx),%es:(%rdi)
+  802cb1:	6c                   	insb   (%dx),%es:(%rdi)
+  802cb2:	2e 63 00             	cs movsxd (%rax),%eax
+  802cb5:	0f 1f 00             	nopl   (%rax)
+  802cb8:	5b                   	pop    %rbx
+  802cb9:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  802cbe:	20 75 6e             	and    %dh,0x6e(%rbp)
+  802cc1:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  802cc5:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802cc6:	20 64 65 76          	and    %ah,0x76(%rbp,%riz,2)
+  802cca:	69 63 65 20 74 79 70 	imul   $0x70797420,0x65(%rbx),%esp
+  802cd1:	65 20 25 64 0a 00 00 	and    %ah,%gs:0xa64(%rip)        # 80373c <error_string+0x4dc>
+  802cd8:	5b                   	pop    %rbx
+  802cd9:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  802cde:	20 66 74             	and    %ah,0x74(%rsi)
+  802ce1:	72 75                	jb     802d58 <devtab+0x18>
+  802ce3:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802ce4:	63 61 74             	movsxd 0x74(%rcx),%esp
+  802ce7:	65 20 25 64 20 2d 2d 	and    %ah,%gs:0x2d2d2064(%rip)        # 2dad4d52 <__bss_end+0x2d2ccd52>
+  802cee:	20 62 61             	and    %ah,0x61(%rdx)
+  802cf1:	64 20 6d 6f          	and    %ch,%fs:0x6f(%rbp)
+  802cf5:	64 65 0a 00          	fs or  %gs:(%rax),%al
+  802cf9:	5b                   	pop    %rbx
+  802cfa:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  802cff:	20 72 65             	and    %dh,0x65(%rdx)
+  802d02:	61                   	(bad)
+  802d03:	64 20 25 64 20 2d 2d 	and    %ah,%fs:0x2d2d2064(%rip)        # 2dad4d6e <__bss_end+0x2d2ccd6e>
+  802d0a:	20 62 61             	and    %ah,0x61(%rdx)
+  802d0d:	64 20 6d 6f          	and    %ch,%fs:0x6f(%rbp)
+  802d11:	64 65 0a 00          	fs or  %gs:(%rax),%al
+  802d15:	5b                   	pop    %rbx
+  802d16:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  802d1b:	20 77 72             	and    %dh,0x72(%rdi)
+  802d1e:	69 74 65 20 25 64 20 	imul   $0x2d206425,0x20(%rbp,%riz,2),%esi
+  802d25:	2d 
+  802d26:	2d 20 62 61 64       	sub    $0x64616220,%eax
+  802d2b:	20 6d 6f             	and    %ch,0x6f(%rbp)
+  802d2e:	64 65 0a 00          	fs or  %gs:(%rax),%al
+  802d32:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  802d39:	00 00 00 
+  802d3c:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000802d40 <devtab>:
+  802d40:	20 40 80 00 00 00 00 00 60 40 80 00 00 00 00 00      @......`@......
+  802d50:	a0 40 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .@..............
+  802d60:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  802d70:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  802d80:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  802d90:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  802da0:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  802db0:	3d 20 32 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73 00     = 2.<cons>.cons.
+  802dc0:	5b 25 30 38 78 5d 20 75 73 65 72 20 70 61 6e 69     [%08x] user pani
+  802dd0:	63 20 69 6e 20 25 73 20 61 74 20 25 73 3a 25 64     c in %s at %s:%d
+  802de0:	3a 20 00 30 31 32 33 34 35 36 37 38 39 41 42 43     : .0123456789ABC
+  802df0:	44 45 46 00 30 31 32 33 34 35 36 37 38 39 61 62     DEF.0123456789ab
+  802e00:	63 64 65 66 00 28 6e 75 6c 6c 29 00 65 72 72 6f     cdef.(null).erro
+  802e10:	72 20 25 64 00 75 6e 73 70 65 63 69 66 69 65 64     r %d.unspecified
+  802e20:	20 65 72 72 6f 72 00 62 61 64 20 65 6e 76 69 72      error.bad envir
+  802e30:	6f 6e 6d 65 6e 74 00 69 6e 76 61 6c 69 64 20 70     onment.invalid p
+  802e40:	61 72 61 6d 65 74 65 72 00 6f 75 74 20 6f 66 20     arameter.out of 
+  802e50:	6d 65 6d 6f 72 79 00 6f 75 74 20 6f 66 20 65 6e     memory.out of en
+  802e60:	76 69 72 6f 6e 6d 65 6e 74 73 00 63 6f 72 72 75     vironments.corru
+  802e70:	70 74 65 64 20 64 65 62 75 67 20 69 6e 66 6f 00     pted debug info.
+  802e80:	73 65 67 6d 65 6e 74 61 74 69 6f 6e 20 66 61 75     segmentation fau
+  802e90:	6c 74 00 69 6e 76 61 6c 69 64 20 45 4c 46 20 69     lt.invalid ELF i
+  802ea0:	6d 61 67 65 00 6e 6f 20 73 75 63 68 20 73 79 73     mage.no such sys
+  802eb0:	74 65 6d 20 63 61 6c 6c 00 65 6e 74 72 79 20 6e     tem call.entry n
+  802ec0:	6f 74 20 66 6f 75 6e 64 00 65 6e 76 20 69 73 20     ot found.env is 
+  802ed0:	6e 6f 74 20 72 65 63 76 69 6e 67 00 75 6e 65 78     not recving.unex
+  802ee0:	70 65 63 74 65 64 20 65 6e 64 20 6f 66 20 66 69     pected end of fi
+  802ef0:	6c 65 00 6e 6f 20 66 72 65 65 20 73 70 61 63 65     le.no free space
+  802f00:	20 6f 6e 20 64 69 73 6b 00 74 6f 6f 20 6d 61 6e      on disk.too man
+  802f10:	79 20 66 69 6c 65 73 20 61 72 65 20 6f 70 65 6e     y files are open
+  802f20:	00 66 69 6c 65 20 6f 72 20 62 6c 6f 63 6b 20 6e     .file or block n
+  802f30:	6f 74 20 66 6f 75 6e 64 00 69 6e 76 61 6c 69 64     ot found.invalid
+  802f40:	20 70 61 74 68 00 66 69 6c 65 20 61 6c 72 65 61      path.file alrea
+  802f50:	64 79 20 65 78 69 73 74 73 00 6f 70 65 72 61 74     dy exists.operat
+  802f60:	69 6f 6e 20 6e 6f 74 20 73 75 70 70 6f 72 74 65     ion not supporte
+  802f70:	64 00 6f 70 65 72 61 74 69 6f 6e 20 69 6e 74 65     d.operation inte
+  802f80:	72 72 75 70 74 65 64 00 6e 6f 74 20 65 6e 6f 75     rrupted.not enou
+  802f90:	67 68 20 43 50 55 20 74 69 6d 65 00 0f 1f 40 00     gh CPU time...@.
+  802fa0:	4b 1f 80 00 00 00 00 00 8c 25 80 00 00 00 00 00     K........%......
+  802fb0:	7c 25 80 00 00 00 00 00 8c 25 80 00 00 00 00 00     |%.......%......
+  802fc0:	8c 25 80 00 00 00 00 00 8c 25 80 00 00 00 00 00     .%.......%......
+  802fd0:	8c 25 80 00 00 00 00 00 6a 1f 80 00 00 00 00 00     .%......j.......
+  802fe0:	8c 25 80 00 00 00 00 00 8c 25 80 00 00 00 00 00     .%.......%......
+  802ff0:	5e 1f 80 00 00 00 00 00 d8 1f 80 00 00 00 00 00     ^...............
+  803000:	8c 25 80 00 00 00 00 00 5e 1f 80 00 00 00 00 00     .%......^.......
+  803010:	a4 1f 80 00 00 00 00 00 a4 1f 80 00 00 00 00 00     ................
+  803020:	a4 1f 80 00 00 00 00 00 a4 1f 80 00 00 00 00 00     ................
+  803030:	a4 1f 80 00 00 00 00 00 a4 1f 80 00 00 00 00 00     ................
+  803040:	a4 1f 80 00 00 00 00 00 a4 1f 80 00 00 00 00 00     ................
+  803050:	a4 1f 80 00 00 00 00 00 8c 25 80 00 00 00 00 00     .........%......
+  803060:	8c 25 80 00 00 00 00 00 8c 25 80 00 00 00 00 00     .%.......%......
+  803070:	8c 25 80 00 00 00 00 00 8c 25 80 00 00 00 00 00     .%.......%......
+  803080:	8c 25 80 00 00 00 00 00 8c 25 80 00 00 00 00 00     .%.......%......
+  803090:	8c 25 80 00 00 00 00 00 8c 25 80 00 00 00 00 00     .%.......%......
+  8030a0:	8c 25 80 00 00 00 00 00 8c 25 80 00 00 00 00 00     .%.......%......
+  8030b0:	8c 25 80 00 00 00 00 00 8c 25 80 00 00 00 00 00     .%.......%......
+  8030c0:	8c 25 80 00 00 00 00 00 8c 25 80 00 00 00 00 00     .%.......%......
+  8030d0:	8c 25 80 00 00 00 00 00 8c 25 80 00 00 00 00 00     .%.......%......
+  8030e0:	8c 25 80 00 00 00 00 00 8c 25 80 00 00 00 00 00     .%.......%......
+  8030f0:	8c 25 80 00 00 00 00 00 8c 25 80 00 00 00 00 00     .%.......%......
+  803100:	8c 25 80 00 00 00 00 00 8c 25 80 00 00 00 00 00     .%.......%......
+  803110:	8c 25 80 00 00 00 00 00 8c 25 80 00 00 00 00 00     .%.......%......
+  803120:	8c 25 80 00 00 00 00 00 8c 25 80 00 00 00 00 00     .%.......%......
+  803130:	8c 25 80 00 00 00 00 00 8c 25 80 00 00 00 00 00     .%.......%......
+  803140:	8c 25 80 00 00 00 00 00 af 24 80 00 00 00 00 00     .%.......$......
+  803150:	8c 25 80 00 00 00 00 00 8c 25 80 00 00 00 00 00     .%.......%......
+  803160:	8c 25 80 00 00 00 00 00 8c 25 80 00 00 00 00 00     .%.......%......
+  803170:	8c 25 80 00 00 00 00 00 8c 25 80 00 00 00 00 00     .%.......%......
+  803180:	8c 25 80 00 00 00 00 00 8c 25 80 00 00 00 00 00     .%.......%......
+  803190:	8c 25 80 00 00 00 00 00 8c 25 80 00 00 00 00 00     .%.......%......
+  8031a0:	fb 1f 80 00 00 00 00 00 ca 21 80 00 00 00 00 00     .........!......
+  8031b0:	8c 25 80 00 00 00 00 00 8c 25 80 00 00 00 00 00     .%.......%......
+  8031c0:	8c 25 80 00 00 00 00 00 8c 25 80 00 00 00 00 00     .%.......%......
+  8031d0:	2a 20 80 00 00 00 00 00 8c 25 80 00 00 00 00 00     * .......%......
+  8031e0:	8c 25 80 00 00 00 00 00 f0 1f 80 00 00 00 00 00     .%..............
+  8031f0:	8c 25 80 00 00 00 00 00 8c 25 80 00 00 00 00 00     .%.......%......
+  803200:	72 23 80 00 00 00 00 00 3c 24 80 00 00 00 00 00     r#......<$......
+  803210:	8c 25 80 00 00 00 00 00 8c 25 80 00 00 00 00 00     .%.......%......
+  803220:	c1 20 80 00 00 00 00 00 8c 25 80 00 00 00 00 00     . .......%......
+  803230:	9e 22 80 00 00 00 00 00 8c 25 80 00 00 00 00 00     .".......%......
+  803240:	8c 25 80 00 00 00 00 00 af 24 80 00 00 00 00 00     .%.......$......
+  803250:	8c 25 80 00 00 00 00 00 54 1f 80 00 00 00 00 00     .%......T.......
+
+0000000000803260 <error_string>:
+	...
+  803268:	15 2e 80 00 00 00 00 00 27 2e 80 00 00 00 00 00     ........'.......
+  803278:	37 2e 80 00 00 00 00 00 49 2e 80 00 00 00 00 00     7.......I.......
+  803288:	57 2e 80 00 00 00 00 00 6b 2e 80 00 00 00 00 00     W.......k.......
+  803298:	80 2e 80 00 00 00 00 00 93 2e 80 00 00 00 00 00     ................
+  8032a8:	a5 2e 80 00 00 00 00 00 b9 2e 80 00 00 00 00 00     ................
+  8032b8:	c9 2e 80 00 00 00 00 00 dc 2e 80 00 00 00 00 00     ................
+  8032c8:	f3 2e 80 00 00 00 00 00 09 2f 80 00 00 00 00 00     ........./......
+  8032d8:	21 2f 80 00 00 00 00 00 39 2f 80 00 00 00 00 00     !/......9/......
+  8032e8:	46 2f 80 00 00 00 00 00 10 33 80 00 00 00 00 00     F/.......3......
+  8032f8:	5a 2f 80 00 00 00 00 00 72 2f 80 00 00 00 00 00     Z/......r/......
+  803308:	88 2f 80 00 00 00 00 00 66 69 6c 65 20 69 73 20     ./......file is 
+  803318:	6e 6f 74 20 61 20 76 61 6c 69 64 20 65 78 65 63     not a valid exec
+  803328:	75 74 61 62 6c 65 00 73 79 73 5f 69 70 63 5f 74     utable.sys_ipc_t
+  803338:	72 79 5f 73 65 6e 64 20 66 61 69 6c 65 64 3a 20     ry_send failed: 
+  803348:	25 69 00 6c 69 62 2f 69 70 63 2e 63 00 66 2e 0f     %i.lib/ipc.c.f..
+  803358:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803368:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803378:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803388:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803398:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8033a8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8033b8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8033c8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8033d8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8033e8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8033f8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803408:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803418:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803428:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803438:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803448:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803458:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803468:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803478:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803488:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803498:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8034a8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8034b8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8034c8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8034d8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8034e8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8034f8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803508:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803518:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803528:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803538:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803548:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803558:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803568:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803578:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803588:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803598:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8035a8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8035b8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8035c8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8035d8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8035e8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8035f8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803608:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803618:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803628:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803638:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803648:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803658:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803668:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803678:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803688:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803698:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8036a8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8036b8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8036c8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8036d8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8036e8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8036f8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803708:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803718:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803728:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803738:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803748:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803758:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803768:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803778:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803788:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803798:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8037a8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8037b8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8037c8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8037d8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8037e8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8037f8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803808:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803818:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803828:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803838:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803848:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803858:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803868:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803878:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803888:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803898:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8038a8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8038b8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8038c8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8038d8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8038e8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8038f8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803908:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803918:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803928:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803938:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803948:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803958:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803968:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803978:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803988:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803998:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8039a8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8039b8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8039c8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8039d8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8039e8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8039f8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803a08:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803a18:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803a28:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803a38:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803a48:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803a58:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803a68:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803a78:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803a88:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803a98:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803aa8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803ab8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803ac8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803ad8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803ae8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803af8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803b08:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803b18:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803b28:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803b38:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803b48:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803b58:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803b68:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803b78:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803b88:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803b98:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803ba8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803bb8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803bc8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803bd8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803be8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803bf8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803c08:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803c18:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803c28:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803c38:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803c48:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803c58:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803c68:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803c78:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803c88:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803c98:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803ca8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803cb8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803cc8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803cd8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803ce8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803cf8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803d08:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803d18:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803d28:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803d38:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803d48:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803d58:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803d68:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803d78:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803d88:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803d98:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803da8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803db8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803dc8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803dd8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803de8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803df8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803e08:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803e18:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803e28:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803e38:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803e48:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803e58:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803e68:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803e78:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803e88:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803e98:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803ea8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803eb8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803ec8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803ed8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803ee8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803ef8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803f08:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803f18:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803f28:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803f38:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803f48:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803f58:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803f68:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803f78:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803f88:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803f98:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803fa8:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803fb8:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803fc8:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803fd8:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803fe8:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803ff8:	00 00 00 00 00 0f 1f 00                             ........
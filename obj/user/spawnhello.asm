@@ -0,0 +1,6407 @@
+
+obj/user/spawnhello:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 87 00 00 00       	call   8000aa <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+    int r;
+    cprintf("i am parent environment %08x\n", thisenv->env_id);
+  800029:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  800030:	00 00 00 
+  800033:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+  800039:	48 bf 08 37 80 00 00 	movabs $0x803708,%rdi
+  800040:	00 00 00 
+  800043:	b8 00 00 00 00       	mov    $0x0,%eax
+  800048:	48 ba c6 02 80 00 00 	movabs $0x8002c6,%rdx
+  80004f:	00 00 00 
+  800052:	ff d2                	call   *%rdx
+    if ((r = spawnl("hello", "hello", 0)) < 0)
+  800054:	ba 00 00 00 00       	mov    $0x0,%edx
+  800059:	48 bf 26 37 80 00 00 	movabs $0x803726,%rdi
+  800060:	00 00 00 
+  800063:	48 89 fe             	mov    %rdi,%rsi
+  800066:	b8 00 00 00 00       	mov    $0x0,%eax
+  80006b:	48 b9 78 2a 80 00 00 	movabs $0x802a78,%rcx
+  800072:	00 00 00 
+  800075:	ff d1                	call   *%rcx
+  800077:	85 c0                	test   %eax,%eax
+  800079:	78 02                	js     80007d <umain+0x58>
+        panic("spawn(hello) failed: %i", r);
+}
+  80007b:	5d                   	pop    %rbp
+  80007c:	c3                   	ret
+        panic("spawn(hello) failed: %i", r);
+  80007d:	89 c1                	mov    %eax,%ecx
+  80007f:	48 ba 2c 37 80 00 00 	movabs $0x80372c,%rdx
+  800086:	00 00 00 
+  800089:	be 08 00 00 00       	mov    $0x8,%esi
+  80008e:	48 bf 44 37 80 00 00 	movabs $0x803744,%rdi
+  800095:	00 00 00 
+  800098:	b8 00 00 00 00       	mov    $0x0,%eax
+  80009d:	49 b8 76 01 80 00 00 	movabs $0x800176,%r8
+  8000a4:	00 00 00 
+  8000a7:	41 ff d0             	call   *%r8
+
+00000000008000aa <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  8000aa:	55                   	push   %rbp
+  8000ab:	48 89 e5             	mov    %rsp,%rbp
+  8000ae:	41 56                	push   %r14
+  8000b0:	41 55                	push   %r13
+  8000b2:	41 54                	push   %r12
+  8000b4:	53                   	push   %rbx
+  8000b5:	41 89 fd             	mov    %edi,%r13d
+  8000b8:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  8000bb:	48 ba d8 40 80 00 00 	movabs $0x8040d8,%rdx
+  8000c2:	00 00 00 
+  8000c5:	48 b8 d8 40 80 00 00 	movabs $0x8040d8,%rax
+  8000cc:	00 00 00 
+  8000cf:	48 39 c2             	cmp    %rax,%rdx
+  8000d2:	73 17                	jae    8000eb <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  8000d4:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  8000d7:	49 89 c4             	mov    %rax,%r12
+  8000da:	48 83 c3 08          	add    $0x8,%rbx
+  8000de:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000e3:	ff 53 f8             	call   *-0x8(%rbx)
+  8000e6:	4c 39 e3             	cmp    %r12,%rbx
+  8000e9:	72 ef                	jb     8000da <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+    envid_t this_env_id = sys_getenvid();
+  8000eb:	48 b8 db 10 80 00 00 	movabs $0x8010db,%rax
+  8000f2:	00 00 00 
+  8000f5:	ff d0                	call   *%rax
+    thisenv = &((struct Env*)UENVS)[ENVX(this_env_id)];
+  8000f7:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8000fc:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+  800103:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  80010a:	00 00 00 
+  80010d:	48 01 d0             	add    %rdx,%rax
+  800110:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  800117:	00 00 00 
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  80011a:	45 85 ed             	test   %r13d,%r13d
+  80011d:	7e 0d                	jle    80012c <libmain+0x82>
+  80011f:	49 8b 06             	mov    (%r14),%rax
+  800122:	48 a3 00 40 80 00 00 	movabs %rax,0x804000
+  800129:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  80012c:	4c 89 f6             	mov    %r14,%rsi
+  80012f:	44 89 ef             	mov    %r13d,%edi
+  800132:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  800139:	00 00 00 
+  80013c:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  80013e:	48 b8 53 01 80 00 00 	movabs $0x800153,%rax
+  800145:	00 00 00 
+  800148:	ff d0                	call   *%rax
+#endif
+}
+  80014a:	5b                   	pop    %rbx
+  80014b:	41 5c                	pop    %r12
+  80014d:	41 5d                	pop    %r13
+  80014f:	41 5e                	pop    %r14
+  800151:	5d                   	pop    %rbp
+  800152:	c3                   	ret
+
+0000000000800153 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  800153:	55                   	push   %rbp
+  800154:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  800157:	48 b8 2f 18 80 00 00 	movabs $0x80182f,%rax
+  80015e:	00 00 00 
+  800161:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  800163:	bf 00 00 00 00       	mov    $0x0,%edi
+  800168:	48 b8 70 10 80 00 00 	movabs $0x801070,%rax
+  80016f:	00 00 00 
+  800172:	ff d0                	call   *%rax
+}
+  800174:	5d                   	pop    %rbp
+  800175:	c3                   	ret
+
+0000000000800176 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  800176:	55                   	push   %rbp
+  800177:	48 89 e5             	mov    %rsp,%rbp
+  80017a:	41 56                	push   %r14
+  80017c:	41 55                	push   %r13
+  80017e:	41 54                	push   %r12
+  800180:	53                   	push   %rbx
+  800181:	48 83 ec 50          	sub    $0x50,%rsp
+  800185:	49 89 fc             	mov    %rdi,%r12
+  800188:	41 89 f5             	mov    %esi,%r13d
+  80018b:	48 89 d3             	mov    %rdx,%rbx
+  80018e:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  800192:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  800196:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  80019a:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  8001a1:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8001a5:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  8001a9:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  8001ad:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  8001b1:	48 b8 00 40 80 00 00 	movabs $0x804000,%rax
+  8001b8:	00 00 00 
+  8001bb:	4c 8b 30             	mov    (%rax),%r14
+  8001be:	48 b8 db 10 80 00 00 	movabs $0x8010db,%rax
+  8001c5:	00 00 00 
+  8001c8:	ff d0                	call   *%rax
+  8001ca:	89 c6                	mov    %eax,%esi
+  8001cc:	45 89 e8             	mov    %r13d,%r8d
+  8001cf:	4c 89 e1             	mov    %r12,%rcx
+  8001d2:	4c 89 f2             	mov    %r14,%rdx
+  8001d5:	48 bf 60 37 80 00 00 	movabs $0x803760,%rdi
+  8001dc:	00 00 00 
+  8001df:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001e4:	49 bc c6 02 80 00 00 	movabs $0x8002c6,%r12
+  8001eb:	00 00 00 
+  8001ee:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  8001f1:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  8001f5:	48 89 df             	mov    %rbx,%rdi
+  8001f8:	48 b8 62 02 80 00 00 	movabs $0x800262,%rax
+  8001ff:	00 00 00 
+  800202:	ff d0                	call   *%rax
+    cprintf("\n");
+  800204:	48 bf 5b 3d 80 00 00 	movabs $0x803d5b,%rdi
+  80020b:	00 00 00 
+  80020e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800213:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  800216:	cc                   	int3
+  800217:	eb fd                	jmp    800216 <_panic+0xa0>
+
+0000000000800219 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  800219:	55                   	push   %rbp
+  80021a:	48 89 e5             	mov    %rsp,%rbp
+  80021d:	53                   	push   %rbx
+  80021e:	48 83 ec 08          	sub    $0x8,%rsp
+  800222:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  800225:	8b 06                	mov    (%rsi),%eax
+  800227:	8d 50 01             	lea    0x1(%rax),%edx
+  80022a:	89 16                	mov    %edx,(%rsi)
+  80022c:	48 98                	cltq
+  80022e:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  800233:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  800239:	74 0a                	je     800245 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  80023b:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  80023f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800243:	c9                   	leave
+  800244:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  800245:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  800249:	be ff 00 00 00       	mov    $0xff,%esi
+  80024e:	48 b8 12 10 80 00 00 	movabs $0x801012,%rax
+  800255:	00 00 00 
+  800258:	ff d0                	call   *%rax
+        state->offset = 0;
+  80025a:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  800260:	eb d9                	jmp    80023b <putch+0x22>
+
+0000000000800262 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  800262:	55                   	push   %rbp
+  800263:	48 89 e5             	mov    %rsp,%rbp
+  800266:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  80026d:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  800270:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  800277:	b9 21 00 00 00       	mov    $0x21,%ecx
+  80027c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800281:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  800284:	48 89 f1             	mov    %rsi,%rcx
+  800287:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  80028e:	48 bf 19 02 80 00 00 	movabs $0x800219,%rdi
+  800295:	00 00 00 
+  800298:	48 b8 16 04 80 00 00 	movabs $0x800416,%rax
+  80029f:	00 00 00 
+  8002a2:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  8002a4:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  8002ab:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  8002b2:	48 b8 12 10 80 00 00 	movabs $0x801012,%rax
+  8002b9:	00 00 00 
+  8002bc:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  8002be:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  8002c4:	c9                   	leave
+  8002c5:	c3                   	ret
+
+00000000008002c6 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  8002c6:	55                   	push   %rbp
+  8002c7:	48 89 e5             	mov    %rsp,%rbp
+  8002ca:	48 83 ec 50          	sub    $0x50,%rsp
+  8002ce:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8002d2:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8002d6:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8002da:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8002de:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  8002e2:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  8002e9:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8002ed:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8002f1:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8002f5:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  8002f9:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  8002fd:	48 b8 62 02 80 00 00 	movabs $0x800262,%rax
+  800304:	00 00 00 
+  800307:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  800309:	c9                   	leave
+  80030a:	c3                   	ret
+
+000000000080030b <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  80030b:	55                   	push   %rbp
+  80030c:	48 89 e5             	mov    %rsp,%rbp
+  80030f:	41 57                	push   %r15
+  800311:	41 56                	push   %r14
+  800313:	41 55                	push   %r13
+  800315:	41 54                	push   %r12
+  800317:	53                   	push   %rbx
+  800318:	48 83 ec 18          	sub    $0x18,%rsp
+  80031c:	49 89 fc             	mov    %rdi,%r12
+  80031f:	49 89 f5             	mov    %rsi,%r13
+  800322:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800326:	8b 45 10             	mov    0x10(%rbp),%eax
+  800329:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  80032c:	41 89 cf             	mov    %ecx,%r15d
+  80032f:	4c 39 fa             	cmp    %r15,%rdx
+  800332:	73 5b                	jae    80038f <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  800334:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  800338:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  80033c:	85 db                	test   %ebx,%ebx
+  80033e:	7e 0e                	jle    80034e <print_num+0x43>
+            putch(padc, put_arg);
+  800340:	4c 89 ee             	mov    %r13,%rsi
+  800343:	44 89 f7             	mov    %r14d,%edi
+  800346:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  800349:	83 eb 01             	sub    $0x1,%ebx
+  80034c:	75 f2                	jne    800340 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  80034e:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  800352:	48 b9 94 37 80 00 00 	movabs $0x803794,%rcx
+  800359:	00 00 00 
+  80035c:	48 b8 83 37 80 00 00 	movabs $0x803783,%rax
+  800363:	00 00 00 
+  800366:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  80036a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80036e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800373:	49 f7 f7             	div    %r15
+  800376:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  80037a:	4c 89 ee             	mov    %r13,%rsi
+  80037d:	41 ff d4             	call   *%r12
+}
+  800380:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800384:	5b                   	pop    %rbx
+  800385:	41 5c                	pop    %r12
+  800387:	41 5d                	pop    %r13
+  800389:	41 5e                	pop    %r14
+  80038b:	41 5f                	pop    %r15
+  80038d:	5d                   	pop    %rbp
+  80038e:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  80038f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800393:	ba 00 00 00 00       	mov    $0x0,%edx
+  800398:	49 f7 f7             	div    %r15
+  80039b:	48 83 ec 08          	sub    $0x8,%rsp
+  80039f:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  8003a3:	52                   	push   %rdx
+  8003a4:	45 0f be c9          	movsbl %r9b,%r9d
+  8003a8:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  8003ac:	48 89 c2             	mov    %rax,%rdx
+  8003af:	48 b8 0b 03 80 00 00 	movabs $0x80030b,%rax
+  8003b6:	00 00 00 
+  8003b9:	ff d0                	call   *%rax
+  8003bb:	48 83 c4 10          	add    $0x10,%rsp
+  8003bf:	eb 8d                	jmp    80034e <print_num+0x43>
+
+00000000008003c1 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  8003c1:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  8003c5:	48 8b 06             	mov    (%rsi),%rax
+  8003c8:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  8003cc:	73 0a                	jae    8003d8 <sprintputch+0x17>
+        *state->start++ = ch;
+  8003ce:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8003d2:	48 89 16             	mov    %rdx,(%rsi)
+  8003d5:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  8003d8:	c3                   	ret
+
+00000000008003d9 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  8003d9:	55                   	push   %rbp
+  8003da:	48 89 e5             	mov    %rsp,%rbp
+  8003dd:	48 83 ec 50          	sub    $0x50,%rsp
+  8003e1:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8003e5:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8003e9:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  8003ed:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8003f4:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8003f8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8003fc:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800400:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  800404:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800408:	48 b8 16 04 80 00 00 	movabs $0x800416,%rax
+  80040f:	00 00 00 
+  800412:	ff d0                	call   *%rax
+}
+  800414:	c9                   	leave
+  800415:	c3                   	ret
+
+0000000000800416 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  800416:	55                   	push   %rbp
+  800417:	48 89 e5             	mov    %rsp,%rbp
+  80041a:	41 57                	push   %r15
+  80041c:	41 56                	push   %r14
+  80041e:	41 55                	push   %r13
+  800420:	41 54                	push   %r12
+  800422:	53                   	push   %rbx
+  800423:	48 83 ec 38          	sub    $0x38,%rsp
+  800427:	49 89 fe             	mov    %rdi,%r14
+  80042a:	49 89 f5             	mov    %rsi,%r13
+  80042d:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  800430:	48 8b 01             	mov    (%rcx),%rax
+  800433:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  800437:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  80043b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80043f:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  800443:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  800447:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  80044b:	0f b6 3b             	movzbl (%rbx),%edi
+  80044e:	40 80 ff 25          	cmp    $0x25,%dil
+  800452:	74 18                	je     80046c <vprintfmt+0x56>
+            if (!ch) return;
+  800454:	40 84 ff             	test   %dil,%dil
+  800457:	0f 84 b1 06 00 00    	je     800b0e <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  80045d:	40 0f b6 ff          	movzbl %dil,%edi
+  800461:	4c 89 ee             	mov    %r13,%rsi
+  800464:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  800467:	4c 89 e3             	mov    %r12,%rbx
+  80046a:	eb db                	jmp    800447 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  80046c:	be 00 00 00 00       	mov    $0x0,%esi
+  800471:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  800475:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  80047a:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800480:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  800487:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  80048b:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  800490:	41 0f b6 04 24       	movzbl (%r12),%eax
+  800495:	88 45 a0             	mov    %al,-0x60(%rbp)
+  800498:	83 e8 23             	sub    $0x23,%eax
+  80049b:	3c 57                	cmp    $0x57,%al
+  80049d:	0f 87 51 06 00 00    	ja     800af4 <vprintfmt+0x6de>
+  8004a3:	0f b6 c0             	movzbl %al,%eax
+  8004a6:	48 b9 40 39 80 00 00 	movabs $0x803940,%rcx
+  8004ad:	00 00 00 
+  8004b0:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  8004b3:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  8004b6:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  8004ba:	eb cf                	jmp    80048b <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  8004bc:	49 89 dc             	mov    %rbx,%r12
+  8004bf:	be 01 00 00 00       	mov    $0x1,%esi
+  8004c4:	eb c5                	jmp    80048b <vprintfmt+0x75>
+            padc = ch;
+  8004c6:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  8004ca:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8004cd:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8004d0:	eb b9                	jmp    80048b <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8004d2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8004d5:	83 f8 2f             	cmp    $0x2f,%eax
+  8004d8:	77 24                	ja     8004fe <vprintfmt+0xe8>
+  8004da:	89 c1                	mov    %eax,%ecx
+  8004dc:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  8004e0:	83 c0 08             	add    $0x8,%eax
+  8004e3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8004e6:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  8004e9:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  8004ec:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8004f0:	79 99                	jns    80048b <vprintfmt+0x75>
+                width = precision;
+  8004f2:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  8004f6:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8004fc:	eb 8d                	jmp    80048b <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8004fe:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  800502:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  800506:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80050a:	eb da                	jmp    8004e6 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  80050c:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  800511:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800515:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  80051b:	3c 39                	cmp    $0x39,%al
+  80051d:	77 1c                	ja     80053b <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  80051f:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  800523:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  800527:	0f b6 c0             	movzbl %al,%eax
+  80052a:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  80052f:	0f b6 03             	movzbl (%rbx),%eax
+  800532:	3c 39                	cmp    $0x39,%al
+  800534:	76 e9                	jbe    80051f <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  800536:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  800539:	eb b1                	jmp    8004ec <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  80053b:	49 89 dc             	mov    %rbx,%r12
+  80053e:	eb ac                	jmp    8004ec <vprintfmt+0xd6>
+            width = MAX(0, width);
+  800540:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  800543:	85 c9                	test   %ecx,%ecx
+  800545:	b8 00 00 00 00       	mov    $0x0,%eax
+  80054a:	0f 49 c1             	cmovns %ecx,%eax
+  80054d:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  800550:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800553:	e9 33 ff ff ff       	jmp    80048b <vprintfmt+0x75>
+            lflag++;
+  800558:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  80055b:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80055e:	e9 28 ff ff ff       	jmp    80048b <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  800563:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800566:	83 f8 2f             	cmp    $0x2f,%eax
+  800569:	77 19                	ja     800584 <vprintfmt+0x16e>
+  80056b:	89 c2                	mov    %eax,%edx
+  80056d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800571:	83 c0 08             	add    $0x8,%eax
+  800574:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800577:	8b 3a                	mov    (%rdx),%edi
+  800579:	4c 89 ee             	mov    %r13,%rsi
+  80057c:	41 ff d6             	call   *%r14
+            break;
+  80057f:	e9 c3 fe ff ff       	jmp    800447 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  800584:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800588:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80058c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800590:	eb e5                	jmp    800577 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  800592:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800595:	83 f8 2f             	cmp    $0x2f,%eax
+  800598:	77 5a                	ja     8005f4 <vprintfmt+0x1de>
+  80059a:	89 c2                	mov    %eax,%edx
+  80059c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8005a0:	83 c0 08             	add    $0x8,%eax
+  8005a3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  8005a6:	8b 02                	mov    (%rdx),%eax
+  8005a8:	89 c1                	mov    %eax,%ecx
+  8005aa:	f7 d9                	neg    %ecx
+  8005ac:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  8005af:	83 f9 15             	cmp    $0x15,%ecx
+  8005b2:	7f 4e                	jg     800602 <vprintfmt+0x1ec>
+  8005b4:	48 63 c1             	movslq %ecx,%rax
+  8005b7:	48 ba 00 3c 80 00 00 	movabs $0x803c00,%rdx
+  8005be:	00 00 00 
+  8005c1:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8005c5:	48 85 c0             	test   %rax,%rax
+  8005c8:	74 38                	je     800602 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  8005ca:	48 89 c1             	mov    %rax,%rcx
+  8005cd:	48 ba 2c 3e 80 00 00 	movabs $0x803e2c,%rdx
+  8005d4:	00 00 00 
+  8005d7:	4c 89 ee             	mov    %r13,%rsi
+  8005da:	4c 89 f7             	mov    %r14,%rdi
+  8005dd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005e2:	49 b8 d9 03 80 00 00 	movabs $0x8003d9,%r8
+  8005e9:	00 00 00 
+  8005ec:	41 ff d0             	call   *%r8
+  8005ef:	e9 53 fe ff ff       	jmp    800447 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  8005f4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8005f8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8005fc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800600:	eb a4                	jmp    8005a6 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  800602:	48 ba ac 37 80 00 00 	movabs $0x8037ac,%rdx
+  800609:	00 00 00 
+  80060c:	4c 89 ee             	mov    %r13,%rsi
+  80060f:	4c 89 f7             	mov    %r14,%rdi
+  800612:	b8 00 00 00 00       	mov    $0x0,%eax
+  800617:	49 b8 d9 03 80 00 00 	movabs $0x8003d9,%r8
+  80061e:	00 00 00 
+  800621:	41 ff d0             	call   *%r8
+  800624:	e9 1e fe ff ff       	jmp    800447 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800629:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80062c:	83 f8 2f             	cmp    $0x2f,%eax
+  80062f:	77 6c                	ja     80069d <vprintfmt+0x287>
+  800631:	89 c2                	mov    %eax,%edx
+  800633:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800637:	83 c0 08             	add    $0x8,%eax
+  80063a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80063d:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  800640:	48 85 d2             	test   %rdx,%rdx
+  800643:	48 b8 a5 37 80 00 00 	movabs $0x8037a5,%rax
+  80064a:	00 00 00 
+  80064d:	48 0f 45 c2          	cmovne %rdx,%rax
+  800651:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  800655:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800659:	7e 06                	jle    800661 <vprintfmt+0x24b>
+  80065b:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  80065f:	75 4a                	jne    8006ab <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800661:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800665:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  800669:	0f b6 00             	movzbl (%rax),%eax
+  80066c:	84 c0                	test   %al,%al
+  80066e:	0f 85 9a 00 00 00    	jne    80070e <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  800674:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800677:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  80067b:	85 c0                	test   %eax,%eax
+  80067d:	0f 8e c4 fd ff ff    	jle    800447 <vprintfmt+0x31>
+  800683:	4c 89 ee             	mov    %r13,%rsi
+  800686:	bf 20 00 00 00       	mov    $0x20,%edi
+  80068b:	41 ff d6             	call   *%r14
+  80068e:	41 83 ec 01          	sub    $0x1,%r12d
+  800692:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  800696:	75 eb                	jne    800683 <vprintfmt+0x26d>
+  800698:	e9 aa fd ff ff       	jmp    800447 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  80069d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8006a1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006a5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006a9:	eb 92                	jmp    80063d <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  8006ab:	49 63 f7             	movslq %r15d,%rsi
+  8006ae:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  8006b2:	48 b8 c8 0b 80 00 00 	movabs $0x800bc8,%rax
+  8006b9:	00 00 00 
+  8006bc:	ff d0                	call   *%rax
+  8006be:	48 89 c2             	mov    %rax,%rdx
+  8006c1:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8006c4:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  8006c6:	8d 70 ff             	lea    -0x1(%rax),%esi
+  8006c9:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  8006cc:	85 c0                	test   %eax,%eax
+  8006ce:	7e 91                	jle    800661 <vprintfmt+0x24b>
+  8006d0:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  8006d5:	4c 89 ee             	mov    %r13,%rsi
+  8006d8:	44 89 e7             	mov    %r12d,%edi
+  8006db:	41 ff d6             	call   *%r14
+  8006de:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8006e2:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8006e5:	83 f8 ff             	cmp    $0xffffffff,%eax
+  8006e8:	75 eb                	jne    8006d5 <vprintfmt+0x2bf>
+  8006ea:	e9 72 ff ff ff       	jmp    800661 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8006ef:	0f b6 f8             	movzbl %al,%edi
+  8006f2:	4c 89 ee             	mov    %r13,%rsi
+  8006f5:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8006f8:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8006fc:	49 83 c4 01          	add    $0x1,%r12
+  800700:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  800706:	84 c0                	test   %al,%al
+  800708:	0f 84 66 ff ff ff    	je     800674 <vprintfmt+0x25e>
+  80070e:	45 85 ff             	test   %r15d,%r15d
+  800711:	78 0a                	js     80071d <vprintfmt+0x307>
+  800713:	41 83 ef 01          	sub    $0x1,%r15d
+  800717:	0f 88 57 ff ff ff    	js     800674 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  80071d:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  800721:	74 cc                	je     8006ef <vprintfmt+0x2d9>
+  800723:	8d 50 e0             	lea    -0x20(%rax),%edx
+  800726:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  80072b:	80 fa 5e             	cmp    $0x5e,%dl
+  80072e:	77 c2                	ja     8006f2 <vprintfmt+0x2dc>
+  800730:	eb bd                	jmp    8006ef <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  800732:	40 84 f6             	test   %sil,%sil
+  800735:	75 26                	jne    80075d <vprintfmt+0x347>
+    switch (lflag) {
+  800737:	85 d2                	test   %edx,%edx
+  800739:	74 59                	je     800794 <vprintfmt+0x37e>
+  80073b:	83 fa 01             	cmp    $0x1,%edx
+  80073e:	74 7b                	je     8007bb <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  800740:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800743:	83 f8 2f             	cmp    $0x2f,%eax
+  800746:	0f 87 96 00 00 00    	ja     8007e2 <vprintfmt+0x3cc>
+  80074c:	89 c2                	mov    %eax,%edx
+  80074e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800752:	83 c0 08             	add    $0x8,%eax
+  800755:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800758:	4c 8b 22             	mov    (%rdx),%r12
+  80075b:	eb 17                	jmp    800774 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  80075d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800760:	83 f8 2f             	cmp    $0x2f,%eax
+  800763:	77 21                	ja     800786 <vprintfmt+0x370>
+  800765:	89 c2                	mov    %eax,%edx
+  800767:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80076b:	83 c0 08             	add    $0x8,%eax
+  80076e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800771:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  800774:	4d 85 e4             	test   %r12,%r12
+  800777:	78 7a                	js     8007f3 <vprintfmt+0x3dd>
+            num = i;
+  800779:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  80077c:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  800781:	e9 50 02 00 00       	jmp    8009d6 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800786:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80078a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80078e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800792:	eb dd                	jmp    800771 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  800794:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800797:	83 f8 2f             	cmp    $0x2f,%eax
+  80079a:	77 11                	ja     8007ad <vprintfmt+0x397>
+  80079c:	89 c2                	mov    %eax,%edx
+  80079e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007a2:	83 c0 08             	add    $0x8,%eax
+  8007a5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007a8:	4c 63 22             	movslq (%rdx),%r12
+  8007ab:	eb c7                	jmp    800774 <vprintfmt+0x35e>
+  8007ad:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007b1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007b5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007b9:	eb ed                	jmp    8007a8 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  8007bb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007be:	83 f8 2f             	cmp    $0x2f,%eax
+  8007c1:	77 11                	ja     8007d4 <vprintfmt+0x3be>
+  8007c3:	89 c2                	mov    %eax,%edx
+  8007c5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007c9:	83 c0 08             	add    $0x8,%eax
+  8007cc:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007cf:	4c 8b 22             	mov    (%rdx),%r12
+  8007d2:	eb a0                	jmp    800774 <vprintfmt+0x35e>
+  8007d4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007d8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007dc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007e0:	eb ed                	jmp    8007cf <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  8007e2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007e6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007ea:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007ee:	e9 65 ff ff ff       	jmp    800758 <vprintfmt+0x342>
+                putch('-', put_arg);
+  8007f3:	4c 89 ee             	mov    %r13,%rsi
+  8007f6:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  8007fb:	41 ff d6             	call   *%r14
+                i = -i;
+  8007fe:	49 f7 dc             	neg    %r12
+  800801:	e9 73 ff ff ff       	jmp    800779 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  800806:	40 84 f6             	test   %sil,%sil
+  800809:	75 32                	jne    80083d <vprintfmt+0x427>
+    switch (lflag) {
+  80080b:	85 d2                	test   %edx,%edx
+  80080d:	74 5d                	je     80086c <vprintfmt+0x456>
+  80080f:	83 fa 01             	cmp    $0x1,%edx
+  800812:	0f 84 82 00 00 00    	je     80089a <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  800818:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80081b:	83 f8 2f             	cmp    $0x2f,%eax
+  80081e:	0f 87 a5 00 00 00    	ja     8008c9 <vprintfmt+0x4b3>
+  800824:	89 c2                	mov    %eax,%edx
+  800826:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80082a:	83 c0 08             	add    $0x8,%eax
+  80082d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800830:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800833:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  800838:	e9 99 01 00 00       	jmp    8009d6 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  80083d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800840:	83 f8 2f             	cmp    $0x2f,%eax
+  800843:	77 19                	ja     80085e <vprintfmt+0x448>
+  800845:	89 c2                	mov    %eax,%edx
+  800847:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80084b:	83 c0 08             	add    $0x8,%eax
+  80084e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800851:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800854:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800859:	e9 78 01 00 00       	jmp    8009d6 <vprintfmt+0x5c0>
+  80085e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800862:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800866:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80086a:	eb e5                	jmp    800851 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  80086c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80086f:	83 f8 2f             	cmp    $0x2f,%eax
+  800872:	77 18                	ja     80088c <vprintfmt+0x476>
+  800874:	89 c2                	mov    %eax,%edx
+  800876:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80087a:	83 c0 08             	add    $0x8,%eax
+  80087d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800880:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800882:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  800887:	e9 4a 01 00 00       	jmp    8009d6 <vprintfmt+0x5c0>
+  80088c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800890:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800894:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800898:	eb e6                	jmp    800880 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  80089a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80089d:	83 f8 2f             	cmp    $0x2f,%eax
+  8008a0:	77 19                	ja     8008bb <vprintfmt+0x4a5>
+  8008a2:	89 c2                	mov    %eax,%edx
+  8008a4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008a8:	83 c0 08             	add    $0x8,%eax
+  8008ab:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008ae:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8008b1:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  8008b6:	e9 1b 01 00 00       	jmp    8009d6 <vprintfmt+0x5c0>
+  8008bb:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008bf:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008c3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008c7:	eb e5                	jmp    8008ae <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  8008c9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008cd:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008d1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008d5:	e9 56 ff ff ff       	jmp    800830 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  8008da:	40 84 f6             	test   %sil,%sil
+  8008dd:	75 2e                	jne    80090d <vprintfmt+0x4f7>
+    switch (lflag) {
+  8008df:	85 d2                	test   %edx,%edx
+  8008e1:	74 59                	je     80093c <vprintfmt+0x526>
+  8008e3:	83 fa 01             	cmp    $0x1,%edx
+  8008e6:	74 7f                	je     800967 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  8008e8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008eb:	83 f8 2f             	cmp    $0x2f,%eax
+  8008ee:	0f 87 9f 00 00 00    	ja     800993 <vprintfmt+0x57d>
+  8008f4:	89 c2                	mov    %eax,%edx
+  8008f6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008fa:	83 c0 08             	add    $0x8,%eax
+  8008fd:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800900:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800903:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  800908:	e9 c9 00 00 00       	jmp    8009d6 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  80090d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800910:	83 f8 2f             	cmp    $0x2f,%eax
+  800913:	77 19                	ja     80092e <vprintfmt+0x518>
+  800915:	89 c2                	mov    %eax,%edx
+  800917:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80091b:	83 c0 08             	add    $0x8,%eax
+  80091e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800921:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800924:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800929:	e9 a8 00 00 00       	jmp    8009d6 <vprintfmt+0x5c0>
+  80092e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800932:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800936:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80093a:	eb e5                	jmp    800921 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  80093c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80093f:	83 f8 2f             	cmp    $0x2f,%eax
+  800942:	77 15                	ja     800959 <vprintfmt+0x543>
+  800944:	89 c2                	mov    %eax,%edx
+  800946:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80094a:	83 c0 08             	add    $0x8,%eax
+  80094d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800950:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  800952:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  800957:	eb 7d                	jmp    8009d6 <vprintfmt+0x5c0>
+  800959:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80095d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800961:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800965:	eb e9                	jmp    800950 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  800967:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80096a:	83 f8 2f             	cmp    $0x2f,%eax
+  80096d:	77 16                	ja     800985 <vprintfmt+0x56f>
+  80096f:	89 c2                	mov    %eax,%edx
+  800971:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800975:	83 c0 08             	add    $0x8,%eax
+  800978:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80097b:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  80097e:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  800983:	eb 51                	jmp    8009d6 <vprintfmt+0x5c0>
+  800985:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800989:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80098d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800991:	eb e8                	jmp    80097b <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  800993:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800997:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80099b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80099f:	e9 5c ff ff ff       	jmp    800900 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  8009a4:	4c 89 ee             	mov    %r13,%rsi
+  8009a7:	bf 30 00 00 00       	mov    $0x30,%edi
+  8009ac:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  8009af:	4c 89 ee             	mov    %r13,%rsi
+  8009b2:	bf 78 00 00 00       	mov    $0x78,%edi
+  8009b7:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  8009ba:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009bd:	83 f8 2f             	cmp    $0x2f,%eax
+  8009c0:	77 47                	ja     800a09 <vprintfmt+0x5f3>
+  8009c2:	89 c2                	mov    %eax,%edx
+  8009c4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009c8:	83 c0 08             	add    $0x8,%eax
+  8009cb:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009ce:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8009d1:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  8009d6:	48 83 ec 08          	sub    $0x8,%rsp
+  8009da:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  8009de:	0f 94 c0             	sete   %al
+  8009e1:	0f b6 c0             	movzbl %al,%eax
+  8009e4:	50                   	push   %rax
+  8009e5:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  8009ea:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  8009ee:	4c 89 ee             	mov    %r13,%rsi
+  8009f1:	4c 89 f7             	mov    %r14,%rdi
+  8009f4:	48 b8 0b 03 80 00 00 	movabs $0x80030b,%rax
+  8009fb:	00 00 00 
+  8009fe:	ff d0                	call   *%rax
+            break;
+  800a00:	48 83 c4 10          	add    $0x10,%rsp
+  800a04:	e9 3e fa ff ff       	jmp    800447 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800a09:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a0d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a11:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a15:	eb b7                	jmp    8009ce <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  800a17:	40 84 f6             	test   %sil,%sil
+  800a1a:	75 2b                	jne    800a47 <vprintfmt+0x631>
+    switch (lflag) {
+  800a1c:	85 d2                	test   %edx,%edx
+  800a1e:	74 56                	je     800a76 <vprintfmt+0x660>
+  800a20:	83 fa 01             	cmp    $0x1,%edx
+  800a23:	74 7f                	je     800aa4 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800a25:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a28:	83 f8 2f             	cmp    $0x2f,%eax
+  800a2b:	0f 87 a2 00 00 00    	ja     800ad3 <vprintfmt+0x6bd>
+  800a31:	89 c2                	mov    %eax,%edx
+  800a33:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a37:	83 c0 08             	add    $0x8,%eax
+  800a3a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a3d:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800a40:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800a45:	eb 8f                	jmp    8009d6 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800a47:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a4a:	83 f8 2f             	cmp    $0x2f,%eax
+  800a4d:	77 19                	ja     800a68 <vprintfmt+0x652>
+  800a4f:	89 c2                	mov    %eax,%edx
+  800a51:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a55:	83 c0 08             	add    $0x8,%eax
+  800a58:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a5b:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800a5e:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800a63:	e9 6e ff ff ff       	jmp    8009d6 <vprintfmt+0x5c0>
+  800a68:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a6c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a70:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a74:	eb e5                	jmp    800a5b <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800a76:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a79:	83 f8 2f             	cmp    $0x2f,%eax
+  800a7c:	77 18                	ja     800a96 <vprintfmt+0x680>
+  800a7e:	89 c2                	mov    %eax,%edx
+  800a80:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a84:	83 c0 08             	add    $0x8,%eax
+  800a87:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a8a:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800a8c:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800a91:	e9 40 ff ff ff       	jmp    8009d6 <vprintfmt+0x5c0>
+  800a96:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a9a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a9e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800aa2:	eb e6                	jmp    800a8a <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800aa4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800aa7:	83 f8 2f             	cmp    $0x2f,%eax
+  800aaa:	77 19                	ja     800ac5 <vprintfmt+0x6af>
+  800aac:	89 c2                	mov    %eax,%edx
+  800aae:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ab2:	83 c0 08             	add    $0x8,%eax
+  800ab5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ab8:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800abb:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800ac0:	e9 11 ff ff ff       	jmp    8009d6 <vprintfmt+0x5c0>
+  800ac5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ac9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800acd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ad1:	eb e5                	jmp    800ab8 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800ad3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ad7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800adb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800adf:	e9 59 ff ff ff       	jmp    800a3d <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800ae4:	4c 89 ee             	mov    %r13,%rsi
+  800ae7:	bf 25 00 00 00       	mov    $0x25,%edi
+  800aec:	41 ff d6             	call   *%r14
+            break;
+  800aef:	e9 53 f9 ff ff       	jmp    800447 <vprintfmt+0x31>
+            putch('%', put_arg);
+  800af4:	4c 89 ee             	mov    %r13,%rsi
+  800af7:	bf 25 00 00 00       	mov    $0x25,%edi
+  800afc:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800aff:	48 83 eb 01          	sub    $0x1,%rbx
+  800b03:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800b07:	75 f6                	jne    800aff <vprintfmt+0x6e9>
+  800b09:	e9 39 f9 ff ff       	jmp    800447 <vprintfmt+0x31>
+}
+  800b0e:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800b12:	5b                   	pop    %rbx
+  800b13:	41 5c                	pop    %r12
+  800b15:	41 5d                	pop    %r13
+  800b17:	41 5e                	pop    %r14
+  800b19:	41 5f                	pop    %r15
+  800b1b:	5d                   	pop    %rbp
+  800b1c:	c3                   	ret
+
+0000000000800b1d <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800b1d:	55                   	push   %rbp
+  800b1e:	48 89 e5             	mov    %rsp,%rbp
+  800b21:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800b25:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800b29:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800b2e:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800b32:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800b39:	48 85 ff             	test   %rdi,%rdi
+  800b3c:	74 2b                	je     800b69 <vsnprintf+0x4c>
+  800b3e:	48 85 f6             	test   %rsi,%rsi
+  800b41:	74 26                	je     800b69 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800b43:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800b47:	48 bf c1 03 80 00 00 	movabs $0x8003c1,%rdi
+  800b4e:	00 00 00 
+  800b51:	48 b8 16 04 80 00 00 	movabs $0x800416,%rax
+  800b58:	00 00 00 
+  800b5b:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800b5d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800b61:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800b64:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800b67:	c9                   	leave
+  800b68:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800b69:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800b6e:	eb f7                	jmp    800b67 <vsnprintf+0x4a>
+
+0000000000800b70 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800b70:	55                   	push   %rbp
+  800b71:	48 89 e5             	mov    %rsp,%rbp
+  800b74:	48 83 ec 50          	sub    $0x50,%rsp
+  800b78:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800b7c:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800b80:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800b84:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800b8b:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800b8f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b93:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800b97:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800b9b:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800b9f:	48 b8 1d 0b 80 00 00 	movabs $0x800b1d,%rax
+  800ba6:	00 00 00 
+  800ba9:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800bab:	c9                   	leave
+  800bac:	c3                   	ret
+
+0000000000800bad <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800bad:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800bb0:	74 10                	je     800bc2 <strlen+0x15>
+    size_t n = 0;
+  800bb2:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800bb7:	48 83 c0 01          	add    $0x1,%rax
+  800bbb:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800bbf:	75 f6                	jne    800bb7 <strlen+0xa>
+  800bc1:	c3                   	ret
+    size_t n = 0;
+  800bc2:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800bc7:	c3                   	ret
+
+0000000000800bc8 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800bc8:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800bcb:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800bd0:	48 85 f6             	test   %rsi,%rsi
+  800bd3:	74 11                	je     800be6 <strnlen+0x1e>
+  800bd5:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800bd9:	74 0c                	je     800be7 <strnlen+0x1f>
+  800bdb:	48 83 c2 01          	add    $0x1,%rdx
+  800bdf:	48 39 d0             	cmp    %rdx,%rax
+  800be2:	75 f1                	jne    800bd5 <strnlen+0xd>
+  800be4:	eb 04                	jmp    800bea <strnlen+0x22>
+  800be6:	c3                   	ret
+  800be7:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800bea:	c3                   	ret
+
+0000000000800beb <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800beb:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800bee:	ba 00 00 00 00       	mov    $0x0,%edx
+  800bf3:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800bf7:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800bfa:	48 83 c2 01          	add    $0x1,%rdx
+  800bfe:	84 c9                	test   %cl,%cl
+  800c00:	75 f1                	jne    800bf3 <strcpy+0x8>
+        ;
+    return res;
+}
+  800c02:	c3                   	ret
+
+0000000000800c03 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800c03:	55                   	push   %rbp
+  800c04:	48 89 e5             	mov    %rsp,%rbp
+  800c07:	41 54                	push   %r12
+  800c09:	53                   	push   %rbx
+  800c0a:	48 89 fb             	mov    %rdi,%rbx
+  800c0d:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800c10:	48 b8 ad 0b 80 00 00 	movabs $0x800bad,%rax
+  800c17:	00 00 00 
+  800c1a:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800c1c:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800c20:	4c 89 e6             	mov    %r12,%rsi
+  800c23:	48 b8 eb 0b 80 00 00 	movabs $0x800beb,%rax
+  800c2a:	00 00 00 
+  800c2d:	ff d0                	call   *%rax
+    return dst;
+}
+  800c2f:	48 89 d8             	mov    %rbx,%rax
+  800c32:	5b                   	pop    %rbx
+  800c33:	41 5c                	pop    %r12
+  800c35:	5d                   	pop    %rbp
+  800c36:	c3                   	ret
+
+0000000000800c37 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800c37:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800c3a:	48 85 d2             	test   %rdx,%rdx
+  800c3d:	74 1f                	je     800c5e <strncpy+0x27>
+  800c3f:	48 01 fa             	add    %rdi,%rdx
+  800c42:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800c45:	48 83 c1 01          	add    $0x1,%rcx
+  800c49:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800c4d:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800c51:	41 80 f8 01          	cmp    $0x1,%r8b
+  800c55:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800c59:	48 39 ca             	cmp    %rcx,%rdx
+  800c5c:	75 e7                	jne    800c45 <strncpy+0xe>
+    }
+    return ret;
+}
+  800c5e:	c3                   	ret
+
+0000000000800c5f <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800c5f:	48 89 f8             	mov    %rdi,%rax
+  800c62:	48 85 d2             	test   %rdx,%rdx
+  800c65:	74 24                	je     800c8b <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800c67:	48 83 ea 01          	sub    $0x1,%rdx
+  800c6b:	74 1b                	je     800c88 <strlcpy+0x29>
+  800c6d:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800c71:	0f b6 16             	movzbl (%rsi),%edx
+  800c74:	84 d2                	test   %dl,%dl
+  800c76:	74 10                	je     800c88 <strlcpy+0x29>
+            *dst++ = *src++;
+  800c78:	48 83 c6 01          	add    $0x1,%rsi
+  800c7c:	48 83 c0 01          	add    $0x1,%rax
+  800c80:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800c83:	48 39 c8             	cmp    %rcx,%rax
+  800c86:	75 e9                	jne    800c71 <strlcpy+0x12>
+        *dst = '\0';
+  800c88:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800c8b:	48 29 f8             	sub    %rdi,%rax
+}
+  800c8e:	c3                   	ret
+
+0000000000800c8f <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800c8f:	0f b6 07             	movzbl (%rdi),%eax
+  800c92:	84 c0                	test   %al,%al
+  800c94:	74 13                	je     800ca9 <strcmp+0x1a>
+  800c96:	38 06                	cmp    %al,(%rsi)
+  800c98:	75 0f                	jne    800ca9 <strcmp+0x1a>
+  800c9a:	48 83 c7 01          	add    $0x1,%rdi
+  800c9e:	48 83 c6 01          	add    $0x1,%rsi
+  800ca2:	0f b6 07             	movzbl (%rdi),%eax
+  800ca5:	84 c0                	test   %al,%al
+  800ca7:	75 ed                	jne    800c96 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800ca9:	0f b6 c0             	movzbl %al,%eax
+  800cac:	0f b6 16             	movzbl (%rsi),%edx
+  800caf:	29 d0                	sub    %edx,%eax
+}
+  800cb1:	c3                   	ret
+
+0000000000800cb2 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800cb2:	48 85 d2             	test   %rdx,%rdx
+  800cb5:	74 1f                	je     800cd6 <strncmp+0x24>
+  800cb7:	0f b6 07             	movzbl (%rdi),%eax
+  800cba:	84 c0                	test   %al,%al
+  800cbc:	74 1e                	je     800cdc <strncmp+0x2a>
+  800cbe:	3a 06                	cmp    (%rsi),%al
+  800cc0:	75 1a                	jne    800cdc <strncmp+0x2a>
+  800cc2:	48 83 c7 01          	add    $0x1,%rdi
+  800cc6:	48 83 c6 01          	add    $0x1,%rsi
+  800cca:	48 83 ea 01          	sub    $0x1,%rdx
+  800cce:	75 e7                	jne    800cb7 <strncmp+0x5>
+
+    if (!n) return 0;
+  800cd0:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cd5:	c3                   	ret
+  800cd6:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cdb:	c3                   	ret
+  800cdc:	48 85 d2             	test   %rdx,%rdx
+  800cdf:	74 09                	je     800cea <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800ce1:	0f b6 07             	movzbl (%rdi),%eax
+  800ce4:	0f b6 16             	movzbl (%rsi),%edx
+  800ce7:	29 d0                	sub    %edx,%eax
+  800ce9:	c3                   	ret
+    if (!n) return 0;
+  800cea:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800cef:	c3                   	ret
+
+0000000000800cf0 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800cf0:	0f b6 17             	movzbl (%rdi),%edx
+  800cf3:	84 d2                	test   %dl,%dl
+  800cf5:	74 18                	je     800d0f <strchr+0x1f>
+        if (*str == c) {
+  800cf7:	0f be d2             	movsbl %dl,%edx
+  800cfa:	39 f2                	cmp    %esi,%edx
+  800cfc:	74 17                	je     800d15 <strchr+0x25>
+    for (; *str; str++) {
+  800cfe:	48 83 c7 01          	add    $0x1,%rdi
+  800d02:	0f b6 17             	movzbl (%rdi),%edx
+  800d05:	84 d2                	test   %dl,%dl
+  800d07:	75 ee                	jne    800cf7 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800d09:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d0e:	c3                   	ret
+  800d0f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d14:	c3                   	ret
+  800d15:	48 89 f8             	mov    %rdi,%rax
+}
+  800d18:	c3                   	ret
+
+0000000000800d19 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800d19:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800d1c:	0f b6 17             	movzbl (%rdi),%edx
+  800d1f:	84 d2                	test   %dl,%dl
+  800d21:	74 13                	je     800d36 <strfind+0x1d>
+  800d23:	0f be d2             	movsbl %dl,%edx
+  800d26:	39 f2                	cmp    %esi,%edx
+  800d28:	74 0b                	je     800d35 <strfind+0x1c>
+  800d2a:	48 83 c0 01          	add    $0x1,%rax
+  800d2e:	0f b6 10             	movzbl (%rax),%edx
+  800d31:	84 d2                	test   %dl,%dl
+  800d33:	75 ee                	jne    800d23 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800d35:	c3                   	ret
+  800d36:	c3                   	ret
+
+0000000000800d37 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800d37:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800d3a:	48 89 f8             	mov    %rdi,%rax
+  800d3d:	48 f7 d8             	neg    %rax
+  800d40:	83 e0 07             	and    $0x7,%eax
+  800d43:	49 89 d1             	mov    %rdx,%r9
+  800d46:	49 29 c1             	sub    %rax,%r9
+  800d49:	78 36                	js     800d81 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800d4b:	40 0f b6 c6          	movzbl %sil,%eax
+  800d4f:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800d56:	01 01 01 
+  800d59:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800d5d:	40 f6 c7 07          	test   $0x7,%dil
+  800d61:	75 38                	jne    800d9b <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800d63:	4c 89 c9             	mov    %r9,%rcx
+  800d66:	48 c1 f9 03          	sar    $0x3,%rcx
+  800d6a:	74 0c                	je     800d78 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800d6c:	fc                   	cld
+  800d6d:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800d70:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800d74:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800d78:	4d 85 c9             	test   %r9,%r9
+  800d7b:	75 45                	jne    800dc2 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800d7d:	4c 89 c0             	mov    %r8,%rax
+  800d80:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800d81:	48 85 d2             	test   %rdx,%rdx
+  800d84:	74 f7                	je     800d7d <memset+0x46>
+  800d86:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800d89:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800d8c:	48 83 c0 01          	add    $0x1,%rax
+  800d90:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  800d94:	48 39 c2             	cmp    %rax,%rdx
+  800d97:	75 f3                	jne    800d8c <memset+0x55>
+  800d99:	eb e2                	jmp    800d7d <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  800d9b:	40 f6 c7 01          	test   $0x1,%dil
+  800d9f:	74 06                	je     800da7 <memset+0x70>
+  800da1:	88 07                	mov    %al,(%rdi)
+  800da3:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800da7:	40 f6 c7 02          	test   $0x2,%dil
+  800dab:	74 07                	je     800db4 <memset+0x7d>
+  800dad:	66 89 07             	mov    %ax,(%rdi)
+  800db0:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800db4:	40 f6 c7 04          	test   $0x4,%dil
+  800db8:	74 a9                	je     800d63 <memset+0x2c>
+  800dba:	89 07                	mov    %eax,(%rdi)
+  800dbc:	48 83 c7 04          	add    $0x4,%rdi
+  800dc0:	eb a1                	jmp    800d63 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800dc2:	41 f6 c1 04          	test   $0x4,%r9b
+  800dc6:	74 06                	je     800dce <memset+0x97>
+  800dc8:	89 07                	mov    %eax,(%rdi)
+  800dca:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800dce:	41 f6 c1 02          	test   $0x2,%r9b
+  800dd2:	74 07                	je     800ddb <memset+0xa4>
+  800dd4:	66 89 07             	mov    %ax,(%rdi)
+  800dd7:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  800ddb:	41 f6 c1 01          	test   $0x1,%r9b
+  800ddf:	74 9c                	je     800d7d <memset+0x46>
+  800de1:	88 07                	mov    %al,(%rdi)
+  800de3:	eb 98                	jmp    800d7d <memset+0x46>
+
+0000000000800de5 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  800de5:	48 89 f8             	mov    %rdi,%rax
+  800de8:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  800deb:	48 39 fe             	cmp    %rdi,%rsi
+  800dee:	73 3b                	jae    800e2b <memmove+0x46>
+  800df0:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  800df4:	48 39 d7             	cmp    %rdx,%rdi
+  800df7:	73 32                	jae    800e2b <memmove+0x46>
+        s += n;
+        d += n;
+  800df9:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800dfd:	48 89 d6             	mov    %rdx,%rsi
+  800e00:	48 09 fe             	or     %rdi,%rsi
+  800e03:	48 09 ce             	or     %rcx,%rsi
+  800e06:	40 f6 c6 07          	test   $0x7,%sil
+  800e0a:	75 12                	jne    800e1e <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  800e0c:	48 83 ef 08          	sub    $0x8,%rdi
+  800e10:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  800e14:	48 c1 e9 03          	shr    $0x3,%rcx
+  800e18:	fd                   	std
+  800e19:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  800e1c:	fc                   	cld
+  800e1d:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  800e1e:	48 83 ef 01          	sub    $0x1,%rdi
+  800e22:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  800e26:	fd                   	std
+  800e27:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  800e29:	eb f1                	jmp    800e1c <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800e2b:	48 89 f2             	mov    %rsi,%rdx
+  800e2e:	48 09 c2             	or     %rax,%rdx
+  800e31:	48 09 ca             	or     %rcx,%rdx
+  800e34:	f6 c2 07             	test   $0x7,%dl
+  800e37:	75 0c                	jne    800e45 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  800e39:	48 c1 e9 03          	shr    $0x3,%rcx
+  800e3d:	48 89 c7             	mov    %rax,%rdi
+  800e40:	fc                   	cld
+  800e41:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  800e44:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  800e45:	48 89 c7             	mov    %rax,%rdi
+  800e48:	fc                   	cld
+  800e49:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  800e4b:	c3                   	ret
+
+0000000000800e4c <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  800e4c:	55                   	push   %rbp
+  800e4d:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  800e50:	48 b8 e5 0d 80 00 00 	movabs $0x800de5,%rax
+  800e57:	00 00 00 
+  800e5a:	ff d0                	call   *%rax
+}
+  800e5c:	5d                   	pop    %rbp
+  800e5d:	c3                   	ret
+
+0000000000800e5e <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  800e5e:	55                   	push   %rbp
+  800e5f:	48 89 e5             	mov    %rsp,%rbp
+  800e62:	41 57                	push   %r15
+  800e64:	41 56                	push   %r14
+  800e66:	41 55                	push   %r13
+  800e68:	41 54                	push   %r12
+  800e6a:	53                   	push   %rbx
+  800e6b:	48 83 ec 08          	sub    $0x8,%rsp
+  800e6f:	49 89 fe             	mov    %rdi,%r14
+  800e72:	49 89 f7             	mov    %rsi,%r15
+  800e75:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  800e78:	48 89 f7             	mov    %rsi,%rdi
+  800e7b:	48 b8 ad 0b 80 00 00 	movabs $0x800bad,%rax
+  800e82:	00 00 00 
+  800e85:	ff d0                	call   *%rax
+  800e87:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  800e8a:	48 89 de             	mov    %rbx,%rsi
+  800e8d:	4c 89 f7             	mov    %r14,%rdi
+  800e90:	48 b8 c8 0b 80 00 00 	movabs $0x800bc8,%rax
+  800e97:	00 00 00 
+  800e9a:	ff d0                	call   *%rax
+  800e9c:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  800e9f:	48 39 c3             	cmp    %rax,%rbx
+  800ea2:	74 36                	je     800eda <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  800ea4:	48 89 d8             	mov    %rbx,%rax
+  800ea7:	4c 29 e8             	sub    %r13,%rax
+  800eaa:	49 39 c4             	cmp    %rax,%r12
+  800ead:	73 31                	jae    800ee0 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  800eaf:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  800eb4:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800eb8:	4c 89 fe             	mov    %r15,%rsi
+  800ebb:	48 b8 4c 0e 80 00 00 	movabs $0x800e4c,%rax
+  800ec2:	00 00 00 
+  800ec5:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  800ec7:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  800ecb:	48 83 c4 08          	add    $0x8,%rsp
+  800ecf:	5b                   	pop    %rbx
+  800ed0:	41 5c                	pop    %r12
+  800ed2:	41 5d                	pop    %r13
+  800ed4:	41 5e                	pop    %r14
+  800ed6:	41 5f                	pop    %r15
+  800ed8:	5d                   	pop    %rbp
+  800ed9:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  800eda:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800ede:	eb eb                	jmp    800ecb <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  800ee0:	48 83 eb 01          	sub    $0x1,%rbx
+  800ee4:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800ee8:	48 89 da             	mov    %rbx,%rdx
+  800eeb:	4c 89 fe             	mov    %r15,%rsi
+  800eee:	48 b8 4c 0e 80 00 00 	movabs $0x800e4c,%rax
+  800ef5:	00 00 00 
+  800ef8:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  800efa:	49 01 de             	add    %rbx,%r14
+  800efd:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  800f02:	eb c3                	jmp    800ec7 <strlcat+0x69>
+
+0000000000800f04 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  800f04:	48 85 d2             	test   %rdx,%rdx
+  800f07:	74 2d                	je     800f36 <memcmp+0x32>
+  800f09:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  800f0e:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800f12:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  800f17:	44 38 c1             	cmp    %r8b,%cl
+  800f1a:	75 0f                	jne    800f2b <memcmp+0x27>
+    while (n-- > 0) {
+  800f1c:	48 83 c0 01          	add    $0x1,%rax
+  800f20:	48 39 c2             	cmp    %rax,%rdx
+  800f23:	75 e9                	jne    800f0e <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  800f25:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f2a:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  800f2b:	0f b6 c1             	movzbl %cl,%eax
+  800f2e:	45 0f b6 c0          	movzbl %r8b,%r8d
+  800f32:	44 29 c0             	sub    %r8d,%eax
+  800f35:	c3                   	ret
+    return 0;
+  800f36:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800f3b:	c3                   	ret
+
+0000000000800f3c <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  800f3c:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  800f40:	48 39 c7             	cmp    %rax,%rdi
+  800f43:	73 0f                	jae    800f54 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  800f45:	40 38 37             	cmp    %sil,(%rdi)
+  800f48:	74 0e                	je     800f58 <memfind+0x1c>
+    for (; src < end; src++) {
+  800f4a:	48 83 c7 01          	add    $0x1,%rdi
+  800f4e:	48 39 f8             	cmp    %rdi,%rax
+  800f51:	75 f2                	jne    800f45 <memfind+0x9>
+  800f53:	c3                   	ret
+  800f54:	48 89 f8             	mov    %rdi,%rax
+  800f57:	c3                   	ret
+  800f58:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  800f5b:	c3                   	ret
+
+0000000000800f5c <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  800f5c:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  800f5f:	0f b6 37             	movzbl (%rdi),%esi
+  800f62:	40 80 fe 20          	cmp    $0x20,%sil
+  800f66:	74 06                	je     800f6e <strtol+0x12>
+  800f68:	40 80 fe 09          	cmp    $0x9,%sil
+  800f6c:	75 13                	jne    800f81 <strtol+0x25>
+  800f6e:	48 83 c7 01          	add    $0x1,%rdi
+  800f72:	0f b6 37             	movzbl (%rdi),%esi
+  800f75:	40 80 fe 20          	cmp    $0x20,%sil
+  800f79:	74 f3                	je     800f6e <strtol+0x12>
+  800f7b:	40 80 fe 09          	cmp    $0x9,%sil
+  800f7f:	74 ed                	je     800f6e <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  800f81:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  800f84:	83 e0 fd             	and    $0xfffffffd,%eax
+  800f87:	3c 01                	cmp    $0x1,%al
+  800f89:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  800f8d:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  800f93:	75 0f                	jne    800fa4 <strtol+0x48>
+  800f95:	80 3f 30             	cmpb   $0x30,(%rdi)
+  800f98:	74 14                	je     800fae <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  800f9a:	85 d2                	test   %edx,%edx
+  800f9c:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800fa1:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  800fa4:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  800fa9:	4c 63 ca             	movslq %edx,%r9
+  800fac:	eb 36                	jmp    800fe4 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  800fae:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  800fb2:	74 0f                	je     800fc3 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  800fb4:	85 d2                	test   %edx,%edx
+  800fb6:	75 ec                	jne    800fa4 <strtol+0x48>
+        s++;
+  800fb8:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  800fbc:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  800fc1:	eb e1                	jmp    800fa4 <strtol+0x48>
+        s += 2;
+  800fc3:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  800fc7:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  800fcc:	eb d6                	jmp    800fa4 <strtol+0x48>
+            dig -= '0';
+  800fce:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  800fd1:	44 0f b6 c1          	movzbl %cl,%r8d
+  800fd5:	41 39 d0             	cmp    %edx,%r8d
+  800fd8:	7d 21                	jge    800ffb <strtol+0x9f>
+        val = val * base + dig;
+  800fda:	49 0f af c1          	imul   %r9,%rax
+  800fde:	0f b6 c9             	movzbl %cl,%ecx
+  800fe1:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  800fe4:	48 83 c7 01          	add    $0x1,%rdi
+  800fe8:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  800fec:	80 f9 39             	cmp    $0x39,%cl
+  800fef:	76 dd                	jbe    800fce <strtol+0x72>
+        else if (dig - 'a' < 27)
+  800ff1:	80 f9 7b             	cmp    $0x7b,%cl
+  800ff4:	77 05                	ja     800ffb <strtol+0x9f>
+            dig -= 'a' - 10;
+  800ff6:	83 e9 57             	sub    $0x57,%ecx
+  800ff9:	eb d6                	jmp    800fd1 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  800ffb:	4d 85 d2             	test   %r10,%r10
+  800ffe:	74 03                	je     801003 <strtol+0xa7>
+  801000:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  801003:	48 89 c2             	mov    %rax,%rdx
+  801006:	48 f7 da             	neg    %rdx
+  801009:	40 80 fe 2d          	cmp    $0x2d,%sil
+  80100d:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  801011:	c3                   	ret
+
+0000000000801012 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  801012:	55                   	push   %rbp
+  801013:	48 89 e5             	mov    %rsp,%rbp
+  801016:	53                   	push   %rbx
+  801017:	48 89 fa             	mov    %rdi,%rdx
+  80101a:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80101d:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801022:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801027:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80102c:	be 00 00 00 00       	mov    $0x0,%esi
+  801031:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801037:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  801039:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80103d:	c9                   	leave
+  80103e:	c3                   	ret
+
+000000000080103f <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  80103f:	55                   	push   %rbp
+  801040:	48 89 e5             	mov    %rsp,%rbp
+  801043:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801044:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801049:	ba 00 00 00 00       	mov    $0x0,%edx
+  80104e:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801053:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801058:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80105d:	be 00 00 00 00       	mov    $0x0,%esi
+  801062:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801068:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  80106a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80106e:	c9                   	leave
+  80106f:	c3                   	ret
+
+0000000000801070 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  801070:	55                   	push   %rbp
+  801071:	48 89 e5             	mov    %rsp,%rbp
+  801074:	53                   	push   %rbx
+  801075:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  801079:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80107c:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801081:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801086:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80108b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801090:	be 00 00 00 00       	mov    $0x0,%esi
+  801095:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80109b:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80109d:	48 85 c0             	test   %rax,%rax
+  8010a0:	7f 06                	jg     8010a8 <sys_env_destroy+0x38>
+}
+  8010a2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8010a6:	c9                   	leave
+  8010a7:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8010a8:	49 89 c0             	mov    %rax,%r8
+  8010ab:	b9 03 00 00 00       	mov    $0x3,%ecx
+  8010b0:	48 ba d0 3c 80 00 00 	movabs $0x803cd0,%rdx
+  8010b7:	00 00 00 
+  8010ba:	be 26 00 00 00       	mov    $0x26,%esi
+  8010bf:	48 bf ef 3c 80 00 00 	movabs $0x803cef,%rdi
+  8010c6:	00 00 00 
+  8010c9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010ce:	49 b9 76 01 80 00 00 	movabs $0x800176,%r9
+  8010d5:	00 00 00 
+  8010d8:	41 ff d1             	call   *%r9
+
+00000000008010db <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  8010db:	55                   	push   %rbp
+  8010dc:	48 89 e5             	mov    %rsp,%rbp
+  8010df:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8010e0:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8010e5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010ea:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8010ef:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010f4:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8010f9:	be 00 00 00 00       	mov    $0x0,%esi
+  8010fe:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801104:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  801106:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80110a:	c9                   	leave
+  80110b:	c3                   	ret
+
+000000000080110c <sys_yield>:
+
+void
+sys_yield(void) {
+  80110c:	55                   	push   %rbp
+  80110d:	48 89 e5             	mov    %rsp,%rbp
+  801110:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801111:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801116:	ba 00 00 00 00       	mov    $0x0,%edx
+  80111b:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801120:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801125:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80112a:	be 00 00 00 00       	mov    $0x0,%esi
+  80112f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801135:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  801137:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80113b:	c9                   	leave
+  80113c:	c3                   	ret
+
+000000000080113d <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  80113d:	55                   	push   %rbp
+  80113e:	48 89 e5             	mov    %rsp,%rbp
+  801141:	53                   	push   %rbx
+  801142:	48 89 fa             	mov    %rdi,%rdx
+  801145:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801148:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80114d:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  801154:	00 00 00 
+  801157:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80115c:	be 00 00 00 00       	mov    $0x0,%esi
+  801161:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801167:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  801169:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80116d:	c9                   	leave
+  80116e:	c3                   	ret
+
+000000000080116f <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  80116f:	55                   	push   %rbp
+  801170:	48 89 e5             	mov    %rsp,%rbp
+  801173:	53                   	push   %rbx
+  801174:	49 89 f8             	mov    %rdi,%r8
+  801177:	48 89 d3             	mov    %rdx,%rbx
+  80117a:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80117d:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801182:	4c 89 c2             	mov    %r8,%rdx
+  801185:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801188:	be 00 00 00 00       	mov    $0x0,%esi
+  80118d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801193:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  801195:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801199:	c9                   	leave
+  80119a:	c3                   	ret
+
+000000000080119b <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  80119b:	55                   	push   %rbp
+  80119c:	48 89 e5             	mov    %rsp,%rbp
+  80119f:	53                   	push   %rbx
+  8011a0:	48 83 ec 08          	sub    $0x8,%rsp
+  8011a4:	89 f8                	mov    %edi,%eax
+  8011a6:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  8011a9:	48 63 f9             	movslq %ecx,%rdi
+  8011ac:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8011af:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8011b4:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8011b7:	be 00 00 00 00       	mov    $0x0,%esi
+  8011bc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8011c2:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8011c4:	48 85 c0             	test   %rax,%rax
+  8011c7:	7f 06                	jg     8011cf <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  8011c9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8011cd:	c9                   	leave
+  8011ce:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8011cf:	49 89 c0             	mov    %rax,%r8
+  8011d2:	b9 04 00 00 00       	mov    $0x4,%ecx
+  8011d7:	48 ba d0 3c 80 00 00 	movabs $0x803cd0,%rdx
+  8011de:	00 00 00 
+  8011e1:	be 26 00 00 00       	mov    $0x26,%esi
+  8011e6:	48 bf ef 3c 80 00 00 	movabs $0x803cef,%rdi
+  8011ed:	00 00 00 
+  8011f0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011f5:	49 b9 76 01 80 00 00 	movabs $0x800176,%r9
+  8011fc:	00 00 00 
+  8011ff:	41 ff d1             	call   *%r9
+
+0000000000801202 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801202:	55                   	push   %rbp
+  801203:	48 89 e5             	mov    %rsp,%rbp
+  801206:	53                   	push   %rbx
+  801207:	48 83 ec 08          	sub    $0x8,%rsp
+  80120b:	89 f8                	mov    %edi,%eax
+  80120d:	49 89 f2             	mov    %rsi,%r10
+  801210:	48 89 cf             	mov    %rcx,%rdi
+  801213:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  801216:	48 63 da             	movslq %edx,%rbx
+  801219:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80121c:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801221:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801224:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  801227:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801229:	48 85 c0             	test   %rax,%rax
+  80122c:	7f 06                	jg     801234 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  80122e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801232:	c9                   	leave
+  801233:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801234:	49 89 c0             	mov    %rax,%r8
+  801237:	b9 05 00 00 00       	mov    $0x5,%ecx
+  80123c:	48 ba d0 3c 80 00 00 	movabs $0x803cd0,%rdx
+  801243:	00 00 00 
+  801246:	be 26 00 00 00       	mov    $0x26,%esi
+  80124b:	48 bf ef 3c 80 00 00 	movabs $0x803cef,%rdi
+  801252:	00 00 00 
+  801255:	b8 00 00 00 00       	mov    $0x0,%eax
+  80125a:	49 b9 76 01 80 00 00 	movabs $0x800176,%r9
+  801261:	00 00 00 
+  801264:	41 ff d1             	call   *%r9
+
+0000000000801267 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  801267:	55                   	push   %rbp
+  801268:	48 89 e5             	mov    %rsp,%rbp
+  80126b:	53                   	push   %rbx
+  80126c:	48 83 ec 08          	sub    $0x8,%rsp
+  801270:	48 89 f1             	mov    %rsi,%rcx
+  801273:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  801276:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801279:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80127e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801283:	be 00 00 00 00       	mov    $0x0,%esi
+  801288:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80128e:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801290:	48 85 c0             	test   %rax,%rax
+  801293:	7f 06                	jg     80129b <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  801295:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801299:	c9                   	leave
+  80129a:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80129b:	49 89 c0             	mov    %rax,%r8
+  80129e:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8012a3:	48 ba d0 3c 80 00 00 	movabs $0x803cd0,%rdx
+  8012aa:	00 00 00 
+  8012ad:	be 26 00 00 00       	mov    $0x26,%esi
+  8012b2:	48 bf ef 3c 80 00 00 	movabs $0x803cef,%rdi
+  8012b9:	00 00 00 
+  8012bc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012c1:	49 b9 76 01 80 00 00 	movabs $0x800176,%r9
+  8012c8:	00 00 00 
+  8012cb:	41 ff d1             	call   *%r9
+
+00000000008012ce <sys_region_batch>:
+
+int
+sys_region_batch(const struct RegionOp *ops, size_t count) {
+  8012ce:	55                   	push   %rbp
+  8012cf:	48 89 e5             	mov    %rsp,%rbp
+  8012d2:	53                   	push   %rbx
+  8012d3:	48 83 ec 08          	sub    $0x8,%rsp
+  8012d7:	48 89 fa             	mov    %rdi,%rdx
+  8012da:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8012dd:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8012e2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012e7:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012ec:	be 00 00 00 00       	mov    $0x0,%esi
+  8012f1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8012f7:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8012f9:	48 85 c0             	test   %rax,%rax
+  8012fc:	7f 06                	jg     801304 <sys_region_batch+0x36>
+        else
+            platform_asan_unpoison(va, ops[i].size);
+    }
+#endif
+    return res;
+}
+  8012fe:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801302:	c9                   	leave
+  801303:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801304:	49 89 c0             	mov    %rax,%r8
+  801307:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  80130c:	48 ba d0 3c 80 00 00 	movabs $0x803cd0,%rdx
+  801313:	00 00 00 
+  801316:	be 26 00 00 00       	mov    $0x26,%esi
+  80131b:	48 bf ef 3c 80 00 00 	movabs $0x803cef,%rdi
+  801322:	00 00 00 
+  801325:	b8 00 00 00 00       	mov    $0x0,%eax
+  80132a:	49 b9 76 01 80 00 00 	movabs $0x800176,%r9
+  801331:	00 00 00 
+  801334:	41 ff d1             	call   *%r9
+
+0000000000801337 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  801337:	55                   	push   %rbp
+  801338:	48 89 e5             	mov    %rsp,%rbp
+  80133b:	53                   	push   %rbx
+  80133c:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  801340:	48 63 ce             	movslq %esi,%rcx
+  801343:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801346:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80134b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801350:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801355:	be 00 00 00 00       	mov    $0x0,%esi
+  80135a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801360:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801362:	48 85 c0             	test   %rax,%rax
+  801365:	7f 06                	jg     80136d <sys_env_set_status+0x36>
+}
+  801367:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80136b:	c9                   	leave
+  80136c:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80136d:	49 89 c0             	mov    %rax,%r8
+  801370:	b9 09 00 00 00       	mov    $0x9,%ecx
+  801375:	48 ba d0 3c 80 00 00 	movabs $0x803cd0,%rdx
+  80137c:	00 00 00 
+  80137f:	be 26 00 00 00       	mov    $0x26,%esi
+  801384:	48 bf ef 3c 80 00 00 	movabs $0x803cef,%rdi
+  80138b:	00 00 00 
+  80138e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801393:	49 b9 76 01 80 00 00 	movabs $0x800176,%r9
+  80139a:	00 00 00 
+  80139d:	41 ff d1             	call   *%r9
+
+00000000008013a0 <sys_env_set_weight>:
+
+int
+sys_env_set_weight(envid_t envid, uint32_t weight) {
+  8013a0:	55                   	push   %rbp
+  8013a1:	48 89 e5             	mov    %rsp,%rbp
+  8013a4:	53                   	push   %rbx
+  8013a5:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_weight, 1, envid, weight, 0, 0, 0, 0);
+  8013a9:	89 f1                	mov    %esi,%ecx
+  8013ab:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8013ae:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8013b3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013b8:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013bd:	be 00 00 00 00       	mov    $0x0,%esi
+  8013c2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013c8:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8013ca:	48 85 c0             	test   %rax,%rax
+  8013cd:	7f 06                	jg     8013d5 <sys_env_set_weight+0x35>
+}
+  8013cf:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013d3:	c9                   	leave
+  8013d4:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8013d5:	49 89 c0             	mov    %rax,%r8
+  8013d8:	b9 10 00 00 00       	mov    $0x10,%ecx
+  8013dd:	48 ba d0 3c 80 00 00 	movabs $0x803cd0,%rdx
+  8013e4:	00 00 00 
+  8013e7:	be 26 00 00 00       	mov    $0x26,%esi
+  8013ec:	48 bf ef 3c 80 00 00 	movabs $0x803cef,%rdi
+  8013f3:	00 00 00 
+  8013f6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013fb:	49 b9 76 01 80 00 00 	movabs $0x800176,%r9
+  801402:	00 00 00 
+  801405:	41 ff d1             	call   *%r9
+
+0000000000801408 <sys_env_set_rt>:
+
+int
+sys_env_set_rt(envid_t envid, uint64_t period, uint64_t budget, uint64_t deadline) {
+  801408:	55                   	push   %rbp
+  801409:	48 89 e5             	mov    %rsp,%rbp
+  80140c:	53                   	push   %rbx
+  80140d:	48 83 ec 08          	sub    $0x8,%rsp
+  801411:	89 f8                	mov    %edi,%eax
+  801413:	48 89 d3             	mov    %rdx,%rbx
+  801416:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_env_set_rt, 1, envid, period, budget, deadline, 0, 0);
+  801419:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80141c:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801421:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801424:	be 00 00 00 00       	mov    $0x0,%esi
+  801429:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80142f:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801431:	48 85 c0             	test   %rax,%rax
+  801434:	7f 06                	jg     80143c <sys_env_set_rt+0x34>
+}
+  801436:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80143a:	c9                   	leave
+  80143b:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80143c:	49 89 c0             	mov    %rax,%r8
+  80143f:	b9 11 00 00 00       	mov    $0x11,%ecx
+  801444:	48 ba d0 3c 80 00 00 	movabs $0x803cd0,%rdx
+  80144b:	00 00 00 
+  80144e:	be 26 00 00 00       	mov    $0x26,%esi
+  801453:	48 bf ef 3c 80 00 00 	movabs $0x803cef,%rdi
+  80145a:	00 00 00 
+  80145d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801462:	49 b9 76 01 80 00 00 	movabs $0x800176,%r9
+  801469:	00 00 00 
+  80146c:	41 ff d1             	call   *%r9
+
+000000000080146f <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  80146f:	55                   	push   %rbp
+  801470:	48 89 e5             	mov    %rsp,%rbp
+  801473:	53                   	push   %rbx
+  801474:	48 83 ec 08          	sub    $0x8,%rsp
+  801478:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  80147b:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80147e:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801483:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801488:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80148d:	be 00 00 00 00       	mov    $0x0,%esi
+  801492:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801498:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80149a:	48 85 c0             	test   %rax,%rax
+  80149d:	7f 06                	jg     8014a5 <sys_env_set_trapframe+0x36>
+}
+  80149f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014a3:	c9                   	leave
+  8014a4:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8014a5:	49 89 c0             	mov    %rax,%r8
+  8014a8:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  8014ad:	48 ba d0 3c 80 00 00 	movabs $0x803cd0,%rdx
+  8014b4:	00 00 00 
+  8014b7:	be 26 00 00 00       	mov    $0x26,%esi
+  8014bc:	48 bf ef 3c 80 00 00 	movabs $0x803cef,%rdi
+  8014c3:	00 00 00 
+  8014c6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014cb:	49 b9 76 01 80 00 00 	movabs $0x800176,%r9
+  8014d2:	00 00 00 
+  8014d5:	41 ff d1             	call   *%r9
+
+00000000008014d8 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  8014d8:	55                   	push   %rbp
+  8014d9:	48 89 e5             	mov    %rsp,%rbp
+  8014dc:	53                   	push   %rbx
+  8014dd:	48 83 ec 08          	sub    $0x8,%rsp
+  8014e1:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  8014e4:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8014e7:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8014ec:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014f1:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014f6:	be 00 00 00 00       	mov    $0x0,%esi
+  8014fb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801501:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801503:	48 85 c0             	test   %rax,%rax
+  801506:	7f 06                	jg     80150e <sys_env_set_pgfault_upcall+0x36>
+}
+  801508:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80150c:	c9                   	leave
+  80150d:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80150e:	49 89 c0             	mov    %rax,%r8
+  801511:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  801516:	48 ba d0 3c 80 00 00 	movabs $0x803cd0,%rdx
+  80151d:	00 00 00 
+  801520:	be 26 00 00 00       	mov    $0x26,%esi
+  801525:	48 bf ef 3c 80 00 00 	movabs $0x803cef,%rdi
+  80152c:	00 00 00 
+  80152f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801534:	49 b9 76 01 80 00 00 	movabs $0x800176,%r9
+  80153b:	00 00 00 
+  80153e:	41 ff d1             	call   *%r9
+
+0000000000801541 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  801541:	55                   	push   %rbp
+  801542:	48 89 e5             	mov    %rsp,%rbp
+  801545:	53                   	push   %rbx
+  801546:	89 f8                	mov    %edi,%eax
+  801548:	49 89 f1             	mov    %rsi,%r9
+  80154b:	48 89 d3             	mov    %rdx,%rbx
+  80154e:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  801551:	49 63 f0             	movslq %r8d,%rsi
+  801554:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801557:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80155c:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80155f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801565:	cd 30                	int    $0x30
+}
+  801567:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80156b:	c9                   	leave
+  80156c:	c3                   	ret
+
+000000000080156d <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  80156d:	55                   	push   %rbp
+  80156e:	48 89 e5             	mov    %rsp,%rbp
+  801571:	53                   	push   %rbx
+  801572:	48 83 ec 08          	sub    $0x8,%rsp
+  801576:	48 89 fa             	mov    %rdi,%rdx
+  801579:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80157c:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801581:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801586:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80158b:	be 00 00 00 00       	mov    $0x0,%esi
+  801590:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801596:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801598:	48 85 c0             	test   %rax,%rax
+  80159b:	7f 06                	jg     8015a3 <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  80159d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015a1:	c9                   	leave
+  8015a2:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8015a3:	49 89 c0             	mov    %rax,%r8
+  8015a6:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  8015ab:	48 ba d0 3c 80 00 00 	movabs $0x803cd0,%rdx
+  8015b2:	00 00 00 
+  8015b5:	be 26 00 00 00       	mov    $0x26,%esi
+  8015ba:	48 bf ef 3c 80 00 00 	movabs $0x803cef,%rdi
+  8015c1:	00 00 00 
+  8015c4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015c9:	49 b9 76 01 80 00 00 	movabs $0x800176,%r9
+  8015d0:	00 00 00 
+  8015d3:	41 ff d1             	call   *%r9
+
+00000000008015d6 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8015d6:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8015dd:	ff ff ff 
+  8015e0:	48 01 f8             	add    %rdi,%rax
+  8015e3:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  8015e7:	c3                   	ret
+
+00000000008015e8 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8015e8:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8015ef:	ff ff ff 
+  8015f2:	48 01 f8             	add    %rdi,%rax
+  8015f5:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  8015f9:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  8015ff:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  801603:	c3                   	ret
+
+0000000000801604 <fd_alloc_from>:
+}
+
+/* Like fd_alloc(), but only considers fds starting from fdnum,
+ * so that several fds can be found before their pages are allocated */
+int
+fd_alloc_from(int fdnum, struct Fd **fd_store) {
+  801604:	55                   	push   %rbp
+  801605:	48 89 e5             	mov    %rsp,%rbp
+  801608:	41 57                	push   %r15
+  80160a:	41 56                	push   %r14
+  80160c:	41 55                	push   %r13
+  80160e:	41 54                	push   %r12
+  801610:	53                   	push   %rbx
+  801611:	48 83 ec 08          	sub    $0x8,%rsp
+  801615:	49 89 f7             	mov    %rsi,%r15
+    for (int i = MAX(fdnum, 0); i < MAXFD; i++) {
+  801618:	85 ff                	test   %edi,%edi
+  80161a:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  801620:	44 0f 49 e7          	cmovns %edi,%r12d
+  801624:	83 ff 1f             	cmp    $0x1f,%edi
+  801627:	7f 37                	jg     801660 <fd_alloc_from+0x5c>
+  801629:	49 63 dc             	movslq %r12d,%rbx
+  80162c:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  801633:	48 c1 e3 0c          	shl    $0xc,%rbx
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  801637:	49 be 1d 31 80 00 00 	movabs $0x80311d,%r14
+  80163e:	00 00 00 
+        struct Fd *fd = INDEX2FD(i);
+  801641:	49 89 dd             	mov    %rbx,%r13
+        if (!(get_prot(fd) & PROT_R)) {
+  801644:	48 89 df             	mov    %rbx,%rdi
+  801647:	41 ff d6             	call   *%r14
+  80164a:	83 e0 04             	and    $0x4,%eax
+  80164d:	74 1c                	je     80166b <fd_alloc_from+0x67>
+    for (int i = MAX(fdnum, 0); i < MAXFD; i++) {
+  80164f:	41 83 c4 01          	add    $0x1,%r12d
+  801653:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  80165a:	41 83 fc 1f          	cmp    $0x1f,%r12d
+  80165e:	7e e1                	jle    801641 <fd_alloc_from+0x3d>
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  801660:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801666:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  80166b:	4d 89 2f             	mov    %r13,(%r15)
+}
+  80166e:	48 83 c4 08          	add    $0x8,%rsp
+  801672:	5b                   	pop    %rbx
+  801673:	41 5c                	pop    %r12
+  801675:	41 5d                	pop    %r13
+  801677:	41 5e                	pop    %r14
+  801679:	41 5f                	pop    %r15
+  80167b:	5d                   	pop    %rbp
+  80167c:	c3                   	ret
+
+000000000080167d <fd_alloc>:
+fd_alloc(struct Fd **fd_store) {
+  80167d:	55                   	push   %rbp
+  80167e:	48 89 e5             	mov    %rsp,%rbp
+  801681:	48 89 fe             	mov    %rdi,%rsi
+    return fd_alloc_from(0, fd_store);
+  801684:	bf 00 00 00 00       	mov    $0x0,%edi
+  801689:	48 b8 04 16 80 00 00 	movabs $0x801604,%rax
+  801690:	00 00 00 
+  801693:	ff d0                	call   *%rax
+}
+  801695:	5d                   	pop    %rbp
+  801696:	c3                   	ret
+
+0000000000801697 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  801697:	83 ff 1f             	cmp    $0x1f,%edi
+  80169a:	77 39                	ja     8016d5 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  80169c:	55                   	push   %rbp
+  80169d:	48 89 e5             	mov    %rsp,%rbp
+  8016a0:	41 54                	push   %r12
+  8016a2:	53                   	push   %rbx
+  8016a3:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  8016a6:	48 63 df             	movslq %edi,%rbx
+  8016a9:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  8016b0:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  8016b4:	48 89 df             	mov    %rbx,%rdi
+  8016b7:	48 b8 1d 31 80 00 00 	movabs $0x80311d,%rax
+  8016be:	00 00 00 
+  8016c1:	ff d0                	call   *%rax
+  8016c3:	a8 04                	test   $0x4,%al
+  8016c5:	74 14                	je     8016db <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  8016c7:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  8016cb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8016d0:	5b                   	pop    %rbx
+  8016d1:	41 5c                	pop    %r12
+  8016d3:	5d                   	pop    %rbp
+  8016d4:	c3                   	ret
+        return -E_INVAL;
+  8016d5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8016da:	c3                   	ret
+        return -E_INVAL;
+  8016db:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8016e0:	eb ee                	jmp    8016d0 <fd_lookup+0x39>
+
+00000000008016e2 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  8016e2:	55                   	push   %rbp
+  8016e3:	48 89 e5             	mov    %rsp,%rbp
+  8016e6:	41 54                	push   %r12
+  8016e8:	53                   	push   %rbx
+  8016e9:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  8016ec:	48 b8 80 3d 80 00 00 	movabs $0x803d80,%rax
+  8016f3:	00 00 00 
+  8016f6:	48 bb 20 40 80 00 00 	movabs $0x804020,%rbx
+  8016fd:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  801700:	39 3b                	cmp    %edi,(%rbx)
+  801702:	74 47                	je     80174b <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  801704:	48 83 c0 08          	add    $0x8,%rax
+  801708:	48 8b 18             	mov    (%rax),%rbx
+  80170b:	48 85 db             	test   %rbx,%rbx
+  80170e:	75 f0                	jne    801700 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801710:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801717:	00 00 00 
+  80171a:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+  801720:	89 fa                	mov    %edi,%edx
+  801722:	48 bf 00 3d 80 00 00 	movabs $0x803d00,%rdi
+  801729:	00 00 00 
+  80172c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801731:	48 b9 c6 02 80 00 00 	movabs $0x8002c6,%rcx
+  801738:	00 00 00 
+  80173b:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  80173d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  801742:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  801746:	5b                   	pop    %rbx
+  801747:	41 5c                	pop    %r12
+  801749:	5d                   	pop    %rbp
+  80174a:	c3                   	ret
+            return 0;
+  80174b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801750:	eb f0                	jmp    801742 <dev_lookup+0x60>
+
+0000000000801752 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  801752:	55                   	push   %rbp
+  801753:	48 89 e5             	mov    %rsp,%rbp
+  801756:	41 55                	push   %r13
+  801758:	41 54                	push   %r12
+  80175a:	53                   	push   %rbx
+  80175b:	48 83 ec 18          	sub    $0x18,%rsp
+  80175f:	48 89 fb             	mov    %rdi,%rbx
+  801762:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801765:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  80176c:	ff ff ff 
+  80176f:	48 01 df             	add    %rbx,%rdi
+  801772:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  801776:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80177a:	48 b8 97 16 80 00 00 	movabs $0x801697,%rax
+  801781:	00 00 00 
+  801784:	ff d0                	call   *%rax
+  801786:	41 89 c5             	mov    %eax,%r13d
+  801789:	85 c0                	test   %eax,%eax
+  80178b:	78 06                	js     801793 <fd_close+0x41>
+  80178d:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  801791:	74 1a                	je     8017ad <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  801793:	45 84 e4             	test   %r12b,%r12b
+  801796:	b8 00 00 00 00       	mov    $0x0,%eax
+  80179b:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  80179f:	44 89 e8             	mov    %r13d,%eax
+  8017a2:	48 83 c4 18          	add    $0x18,%rsp
+  8017a6:	5b                   	pop    %rbx
+  8017a7:	41 5c                	pop    %r12
+  8017a9:	41 5d                	pop    %r13
+  8017ab:	5d                   	pop    %rbp
+  8017ac:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8017ad:	8b 3b                	mov    (%rbx),%edi
+  8017af:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8017b3:	48 b8 e2 16 80 00 00 	movabs $0x8016e2,%rax
+  8017ba:	00 00 00 
+  8017bd:	ff d0                	call   *%rax
+  8017bf:	41 89 c5             	mov    %eax,%r13d
+  8017c2:	85 c0                	test   %eax,%eax
+  8017c4:	78 1b                	js     8017e1 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  8017c6:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8017ca:	48 8b 40 20          	mov    0x20(%rax),%rax
+  8017ce:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  8017d4:	48 85 c0             	test   %rax,%rax
+  8017d7:	74 08                	je     8017e1 <fd_close+0x8f>
+  8017d9:	48 89 df             	mov    %rbx,%rdi
+  8017dc:	ff d0                	call   *%rax
+  8017de:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8017e1:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8017e6:	48 89 de             	mov    %rbx,%rsi
+  8017e9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8017ee:	48 b8 67 12 80 00 00 	movabs $0x801267,%rax
+  8017f5:	00 00 00 
+  8017f8:	ff d0                	call   *%rax
+    return res;
+  8017fa:	eb a3                	jmp    80179f <fd_close+0x4d>
+
+00000000008017fc <close>:
+
+int
+close(int fdnum) {
+  8017fc:	55                   	push   %rbp
+  8017fd:	48 89 e5             	mov    %rsp,%rbp
+  801800:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  801804:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801808:	48 b8 97 16 80 00 00 	movabs $0x801697,%rax
+  80180f:	00 00 00 
+  801812:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801814:	85 c0                	test   %eax,%eax
+  801816:	78 15                	js     80182d <close+0x31>
+
+    return fd_close(fd, 1);
+  801818:	be 01 00 00 00       	mov    $0x1,%esi
+  80181d:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801821:	48 b8 52 17 80 00 00 	movabs $0x801752,%rax
+  801828:	00 00 00 
+  80182b:	ff d0                	call   *%rax
+}
+  80182d:	c9                   	leave
+  80182e:	c3                   	ret
+
+000000000080182f <close_all>:
+
+void
+close_all(void) {
+  80182f:	55                   	push   %rbp
+  801830:	48 89 e5             	mov    %rsp,%rbp
+  801833:	41 54                	push   %r12
+  801835:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  801836:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80183b:	49 bc fc 17 80 00 00 	movabs $0x8017fc,%r12
+  801842:	00 00 00 
+  801845:	89 df                	mov    %ebx,%edi
+  801847:	41 ff d4             	call   *%r12
+  80184a:	83 c3 01             	add    $0x1,%ebx
+  80184d:	83 fb 20             	cmp    $0x20,%ebx
+  801850:	75 f3                	jne    801845 <close_all+0x16>
+}
+  801852:	5b                   	pop    %rbx
+  801853:	41 5c                	pop    %r12
+  801855:	5d                   	pop    %rbp
+  801856:	c3                   	ret
+
+0000000000801857 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  801857:	55                   	push   %rbp
+  801858:	48 89 e5             	mov    %rsp,%rbp
+  80185b:	41 57                	push   %r15
+  80185d:	41 56                	push   %r14
+  80185f:	41 55                	push   %r13
+  801861:	41 54                	push   %r12
+  801863:	53                   	push   %rbx
+  801864:	48 83 ec 18          	sub    $0x18,%rsp
+  801868:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  80186b:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  80186f:	48 b8 97 16 80 00 00 	movabs $0x801697,%rax
+  801876:	00 00 00 
+  801879:	ff d0                	call   *%rax
+  80187b:	89 c3                	mov    %eax,%ebx
+  80187d:	85 c0                	test   %eax,%eax
+  80187f:	0f 88 b8 00 00 00    	js     80193d <dup+0xe6>
+    close(newfdnum);
+  801885:	44 89 e7             	mov    %r12d,%edi
+  801888:	48 b8 fc 17 80 00 00 	movabs $0x8017fc,%rax
+  80188f:	00 00 00 
+  801892:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  801894:	4d 63 ec             	movslq %r12d,%r13
+  801897:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  80189e:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  8018a2:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  8018a6:	4c 89 ff             	mov    %r15,%rdi
+  8018a9:	49 be e8 15 80 00 00 	movabs $0x8015e8,%r14
+  8018b0:	00 00 00 
+  8018b3:	41 ff d6             	call   *%r14
+  8018b6:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  8018b9:	4c 89 ef             	mov    %r13,%rdi
+  8018bc:	41 ff d6             	call   *%r14
+  8018bf:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  8018c2:	48 89 df             	mov    %rbx,%rdi
+  8018c5:	48 b8 1d 31 80 00 00 	movabs $0x80311d,%rax
+  8018cc:	00 00 00 
+  8018cf:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  8018d1:	a8 04                	test   $0x4,%al
+  8018d3:	74 2b                	je     801900 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  8018d5:	41 89 c1             	mov    %eax,%r9d
+  8018d8:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8018de:	4c 89 f1             	mov    %r14,%rcx
+  8018e1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8018e6:	48 89 de             	mov    %rbx,%rsi
+  8018e9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8018ee:	48 b8 02 12 80 00 00 	movabs $0x801202,%rax
+  8018f5:	00 00 00 
+  8018f8:	ff d0                	call   *%rax
+  8018fa:	89 c3                	mov    %eax,%ebx
+  8018fc:	85 c0                	test   %eax,%eax
+  8018fe:	78 4e                	js     80194e <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  801900:	4c 89 ff             	mov    %r15,%rdi
+  801903:	48 b8 1d 31 80 00 00 	movabs $0x80311d,%rax
+  80190a:	00 00 00 
+  80190d:	ff d0                	call   *%rax
+  80190f:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801912:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801918:	4c 89 e9             	mov    %r13,%rcx
+  80191b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801920:	4c 89 fe             	mov    %r15,%rsi
+  801923:	bf 00 00 00 00       	mov    $0x0,%edi
+  801928:	48 b8 02 12 80 00 00 	movabs $0x801202,%rax
+  80192f:	00 00 00 
+  801932:	ff d0                	call   *%rax
+  801934:	89 c3                	mov    %eax,%ebx
+  801936:	85 c0                	test   %eax,%eax
+  801938:	78 14                	js     80194e <dup+0xf7>
+
+    return newfdnum;
+  80193a:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  80193d:	89 d8                	mov    %ebx,%eax
+  80193f:	48 83 c4 18          	add    $0x18,%rsp
+  801943:	5b                   	pop    %rbx
+  801944:	41 5c                	pop    %r12
+  801946:	41 5d                	pop    %r13
+  801948:	41 5e                	pop    %r14
+  80194a:	41 5f                	pop    %r15
+  80194c:	5d                   	pop    %rbp
+  80194d:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  80194e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801953:	4c 89 ee             	mov    %r13,%rsi
+  801956:	bf 00 00 00 00       	mov    $0x0,%edi
+  80195b:	49 bc 67 12 80 00 00 	movabs $0x801267,%r12
+  801962:	00 00 00 
+  801965:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  801968:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80196d:	4c 89 f6             	mov    %r14,%rsi
+  801970:	bf 00 00 00 00       	mov    $0x0,%edi
+  801975:	41 ff d4             	call   *%r12
+    return res;
+  801978:	eb c3                	jmp    80193d <dup+0xe6>
+
+000000000080197a <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  80197a:	55                   	push   %rbp
+  80197b:	48 89 e5             	mov    %rsp,%rbp
+  80197e:	41 56                	push   %r14
+  801980:	41 55                	push   %r13
+  801982:	41 54                	push   %r12
+  801984:	53                   	push   %rbx
+  801985:	48 83 ec 10          	sub    $0x10,%rsp
+  801989:	89 fb                	mov    %edi,%ebx
+  80198b:	49 89 f4             	mov    %rsi,%r12
+  80198e:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801991:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801995:	48 b8 97 16 80 00 00 	movabs $0x801697,%rax
+  80199c:	00 00 00 
+  80199f:	ff d0                	call   *%rax
+  8019a1:	85 c0                	test   %eax,%eax
+  8019a3:	78 4c                	js     8019f1 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8019a5:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  8019a9:	41 8b 3e             	mov    (%r14),%edi
+  8019ac:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8019b0:	48 b8 e2 16 80 00 00 	movabs $0x8016e2,%rax
+  8019b7:	00 00 00 
+  8019ba:	ff d0                	call   *%rax
+  8019bc:	85 c0                	test   %eax,%eax
+  8019be:	78 35                	js     8019f5 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8019c0:	41 8b 46 08          	mov    0x8(%r14),%eax
+  8019c4:	83 e0 03             	and    $0x3,%eax
+  8019c7:	83 f8 01             	cmp    $0x1,%eax
+  8019ca:	74 2d                	je     8019f9 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  8019cc:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8019d0:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8019d4:	48 85 c0             	test   %rax,%rax
+  8019d7:	74 56                	je     801a2f <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  8019d9:	4c 89 ea             	mov    %r13,%rdx
+  8019dc:	4c 89 e6             	mov    %r12,%rsi
+  8019df:	4c 89 f7             	mov    %r14,%rdi
+  8019e2:	ff d0                	call   *%rax
+}
+  8019e4:	48 83 c4 10          	add    $0x10,%rsp
+  8019e8:	5b                   	pop    %rbx
+  8019e9:	41 5c                	pop    %r12
+  8019eb:	41 5d                	pop    %r13
+  8019ed:	41 5e                	pop    %r14
+  8019ef:	5d                   	pop    %rbp
+  8019f0:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8019f1:	48 98                	cltq
+  8019f3:	eb ef                	jmp    8019e4 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8019f5:	48 98                	cltq
+  8019f7:	eb eb                	jmp    8019e4 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8019f9:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801a00:	00 00 00 
+  801a03:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+  801a09:	89 da                	mov    %ebx,%edx
+  801a0b:	48 bf 41 3d 80 00 00 	movabs $0x803d41,%rdi
+  801a12:	00 00 00 
+  801a15:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a1a:	48 b9 c6 02 80 00 00 	movabs $0x8002c6,%rcx
+  801a21:	00 00 00 
+  801a24:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801a26:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801a2d:	eb b5                	jmp    8019e4 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801a2f:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801a36:	eb ac                	jmp    8019e4 <read+0x6a>
+
+0000000000801a38 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801a38:	55                   	push   %rbp
+  801a39:	48 89 e5             	mov    %rsp,%rbp
+  801a3c:	41 57                	push   %r15
+  801a3e:	41 56                	push   %r14
+  801a40:	41 55                	push   %r13
+  801a42:	41 54                	push   %r12
+  801a44:	53                   	push   %rbx
+  801a45:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  801a49:	48 85 d2             	test   %rdx,%rdx
+  801a4c:	74 54                	je     801aa2 <readn+0x6a>
+  801a4e:	41 89 fd             	mov    %edi,%r13d
+  801a51:	49 89 f6             	mov    %rsi,%r14
+  801a54:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  801a57:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  801a5c:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  801a61:	49 bf 7a 19 80 00 00 	movabs $0x80197a,%r15
+  801a68:	00 00 00 
+  801a6b:	4c 89 e2             	mov    %r12,%rdx
+  801a6e:	48 29 f2             	sub    %rsi,%rdx
+  801a71:	4c 01 f6             	add    %r14,%rsi
+  801a74:	44 89 ef             	mov    %r13d,%edi
+  801a77:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  801a7a:	85 c0                	test   %eax,%eax
+  801a7c:	78 20                	js     801a9e <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  801a7e:	01 c3                	add    %eax,%ebx
+  801a80:	85 c0                	test   %eax,%eax
+  801a82:	74 08                	je     801a8c <readn+0x54>
+  801a84:	48 63 f3             	movslq %ebx,%rsi
+  801a87:	4c 39 e6             	cmp    %r12,%rsi
+  801a8a:	72 df                	jb     801a6b <readn+0x33>
+    }
+    return res;
+  801a8c:	48 63 c3             	movslq %ebx,%rax
+}
+  801a8f:	48 83 c4 08          	add    $0x8,%rsp
+  801a93:	5b                   	pop    %rbx
+  801a94:	41 5c                	pop    %r12
+  801a96:	41 5d                	pop    %r13
+  801a98:	41 5e                	pop    %r14
+  801a9a:	41 5f                	pop    %r15
+  801a9c:	5d                   	pop    %rbp
+  801a9d:	c3                   	ret
+        if (inc < 0) return inc;
+  801a9e:	48 98                	cltq
+  801aa0:	eb ed                	jmp    801a8f <readn+0x57>
+    int inc = 1, res = 0;
+  801aa2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801aa7:	eb e3                	jmp    801a8c <readn+0x54>
+
+0000000000801aa9 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  801aa9:	55                   	push   %rbp
+  801aaa:	48 89 e5             	mov    %rsp,%rbp
+  801aad:	41 56                	push   %r14
+  801aaf:	41 55                	push   %r13
+  801ab1:	41 54                	push   %r12
+  801ab3:	53                   	push   %rbx
+  801ab4:	48 83 ec 10          	sub    $0x10,%rsp
+  801ab8:	89 fb                	mov    %edi,%ebx
+  801aba:	49 89 f4             	mov    %rsi,%r12
+  801abd:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801ac0:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801ac4:	48 b8 97 16 80 00 00 	movabs $0x801697,%rax
+  801acb:	00 00 00 
+  801ace:	ff d0                	call   *%rax
+  801ad0:	85 c0                	test   %eax,%eax
+  801ad2:	78 47                	js     801b1b <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801ad4:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801ad8:	41 8b 3e             	mov    (%r14),%edi
+  801adb:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801adf:	48 b8 e2 16 80 00 00 	movabs $0x8016e2,%rax
+  801ae6:	00 00 00 
+  801ae9:	ff d0                	call   *%rax
+  801aeb:	85 c0                	test   %eax,%eax
+  801aed:	78 30                	js     801b1f <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801aef:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  801af4:	74 2d                	je     801b23 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801af6:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801afa:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801afe:	48 85 c0             	test   %rax,%rax
+  801b01:	74 56                	je     801b59 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  801b03:	4c 89 ea             	mov    %r13,%rdx
+  801b06:	4c 89 e6             	mov    %r12,%rsi
+  801b09:	4c 89 f7             	mov    %r14,%rdi
+  801b0c:	ff d0                	call   *%rax
+}
+  801b0e:	48 83 c4 10          	add    $0x10,%rsp
+  801b12:	5b                   	pop    %rbx
+  801b13:	41 5c                	pop    %r12
+  801b15:	41 5d                	pop    %r13
+  801b17:	41 5e                	pop    %r14
+  801b19:	5d                   	pop    %rbp
+  801b1a:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801b1b:	48 98                	cltq
+  801b1d:	eb ef                	jmp    801b0e <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801b1f:	48 98                	cltq
+  801b21:	eb eb                	jmp    801b0e <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801b23:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801b2a:	00 00 00 
+  801b2d:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+  801b33:	89 da                	mov    %ebx,%edx
+  801b35:	48 bf 5d 3d 80 00 00 	movabs $0x803d5d,%rdi
+  801b3c:	00 00 00 
+  801b3f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b44:	48 b9 c6 02 80 00 00 	movabs $0x8002c6,%rcx
+  801b4b:	00 00 00 
+  801b4e:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801b50:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801b57:	eb b5                	jmp    801b0e <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801b59:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801b60:	eb ac                	jmp    801b0e <write+0x65>
+
+0000000000801b62 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  801b62:	55                   	push   %rbp
+  801b63:	48 89 e5             	mov    %rsp,%rbp
+  801b66:	53                   	push   %rbx
+  801b67:	48 83 ec 18          	sub    $0x18,%rsp
+  801b6b:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801b6d:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801b71:	48 b8 97 16 80 00 00 	movabs $0x801697,%rax
+  801b78:	00 00 00 
+  801b7b:	ff d0                	call   *%rax
+  801b7d:	85 c0                	test   %eax,%eax
+  801b7f:	78 0c                	js     801b8d <seek+0x2b>
+
+    fd->fd_offset = offset;
+  801b81:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801b85:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  801b88:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801b8d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801b91:	c9                   	leave
+  801b92:	c3                   	ret
+
+0000000000801b93 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  801b93:	55                   	push   %rbp
+  801b94:	48 89 e5             	mov    %rsp,%rbp
+  801b97:	41 55                	push   %r13
+  801b99:	41 54                	push   %r12
+  801b9b:	53                   	push   %rbx
+  801b9c:	48 83 ec 18          	sub    $0x18,%rsp
+  801ba0:	89 fb                	mov    %edi,%ebx
+  801ba2:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801ba5:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801ba9:	48 b8 97 16 80 00 00 	movabs $0x801697,%rax
+  801bb0:	00 00 00 
+  801bb3:	ff d0                	call   *%rax
+  801bb5:	85 c0                	test   %eax,%eax
+  801bb7:	78 38                	js     801bf1 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801bb9:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  801bbd:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  801bc1:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801bc5:	48 b8 e2 16 80 00 00 	movabs $0x8016e2,%rax
+  801bcc:	00 00 00 
+  801bcf:	ff d0                	call   *%rax
+  801bd1:	85 c0                	test   %eax,%eax
+  801bd3:	78 1c                	js     801bf1 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801bd5:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  801bda:	74 20                	je     801bfc <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801bdc:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801be0:	48 8b 40 30          	mov    0x30(%rax),%rax
+  801be4:	48 85 c0             	test   %rax,%rax
+  801be7:	74 47                	je     801c30 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  801be9:	44 89 e6             	mov    %r12d,%esi
+  801bec:	4c 89 ef             	mov    %r13,%rdi
+  801bef:	ff d0                	call   *%rax
+}
+  801bf1:	48 83 c4 18          	add    $0x18,%rsp
+  801bf5:	5b                   	pop    %rbx
+  801bf6:	41 5c                	pop    %r12
+  801bf8:	41 5d                	pop    %r13
+  801bfa:	5d                   	pop    %rbp
+  801bfb:	c3                   	ret
+                thisenv->env_id, fdnum);
+  801bfc:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801c03:	00 00 00 
+  801c06:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801c0c:	89 da                	mov    %ebx,%edx
+  801c0e:	48 bf 20 3d 80 00 00 	movabs $0x803d20,%rdi
+  801c15:	00 00 00 
+  801c18:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c1d:	48 b9 c6 02 80 00 00 	movabs $0x8002c6,%rcx
+  801c24:	00 00 00 
+  801c27:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801c29:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801c2e:	eb c1                	jmp    801bf1 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801c30:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801c35:	eb ba                	jmp    801bf1 <ftruncate+0x5e>
+
+0000000000801c37 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  801c37:	55                   	push   %rbp
+  801c38:	48 89 e5             	mov    %rsp,%rbp
+  801c3b:	41 54                	push   %r12
+  801c3d:	53                   	push   %rbx
+  801c3e:	48 83 ec 10          	sub    $0x10,%rsp
+  801c42:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801c45:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801c49:	48 b8 97 16 80 00 00 	movabs $0x801697,%rax
+  801c50:	00 00 00 
+  801c53:	ff d0                	call   *%rax
+  801c55:	85 c0                	test   %eax,%eax
+  801c57:	78 4e                	js     801ca7 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801c59:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801c5d:	41 8b 3c 24          	mov    (%r12),%edi
+  801c61:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801c65:	48 b8 e2 16 80 00 00 	movabs $0x8016e2,%rax
+  801c6c:	00 00 00 
+  801c6f:	ff d0                	call   *%rax
+  801c71:	85 c0                	test   %eax,%eax
+  801c73:	78 32                	js     801ca7 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801c75:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801c79:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  801c7e:	74 30                	je     801cb0 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  801c80:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  801c83:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  801c8a:	00 00 00 
+    stat->st_isdir = 0;
+  801c8d:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  801c94:	00 00 00 
+    stat->st_dev = dev;
+  801c97:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  801c9e:	48 89 de             	mov    %rbx,%rsi
+  801ca1:	4c 89 e7             	mov    %r12,%rdi
+  801ca4:	ff 50 28             	call   *0x28(%rax)
+}
+  801ca7:	48 83 c4 10          	add    $0x10,%rsp
+  801cab:	5b                   	pop    %rbx
+  801cac:	41 5c                	pop    %r12
+  801cae:	5d                   	pop    %rbp
+  801caf:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801cb0:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801cb5:	eb f0                	jmp    801ca7 <fstat+0x70>
+
+0000000000801cb7 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  801cb7:	55                   	push   %rbp
+  801cb8:	48 89 e5             	mov    %rsp,%rbp
+  801cbb:	41 54                	push   %r12
+  801cbd:	53                   	push   %rbx
+  801cbe:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  801cc1:	be 00 00 00 00       	mov    $0x0,%esi
+  801cc6:	48 b8 9a 20 80 00 00 	movabs $0x80209a,%rax
+  801ccd:	00 00 00 
+  801cd0:	ff d0                	call   *%rax
+  801cd2:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  801cd4:	85 c0                	test   %eax,%eax
+  801cd6:	78 25                	js     801cfd <stat+0x46>
+
+    int res = fstat(fd, stat);
+  801cd8:	4c 89 e6             	mov    %r12,%rsi
+  801cdb:	89 c7                	mov    %eax,%edi
+  801cdd:	48 b8 37 1c 80 00 00 	movabs $0x801c37,%rax
+  801ce4:	00 00 00 
+  801ce7:	ff d0                	call   *%rax
+  801ce9:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  801cec:	89 df                	mov    %ebx,%edi
+  801cee:	48 b8 fc 17 80 00 00 	movabs $0x8017fc,%rax
+  801cf5:	00 00 00 
+  801cf8:	ff d0                	call   *%rax
+
+    return res;
+  801cfa:	44 89 e3             	mov    %r12d,%ebx
+}
+  801cfd:	89 d8                	mov    %ebx,%eax
+  801cff:	5b                   	pop    %rbx
+  801d00:	41 5c                	pop    %r12
+  801d02:	5d                   	pop    %rbp
+  801d03:	c3                   	ret
+
+0000000000801d04 <fsipc>:
+ * response may be written back to fsipcbuf.
+ * type: request code, passed as the simple integer IPC value.
+ * dstva: virtual address at which to receive reply page, 0 if none.
+ * Returns result from the file server. */
+static int
+fsipc(unsigned type, void *dstva) {
+  801d04:	55                   	push   %rbp
+  801d05:	48 89 e5             	mov    %rsp,%rbp
+  801d08:	41 54                	push   %r12
+  801d0a:	53                   	push   %rbx
+  801d0b:	48 83 ec 10          	sub    $0x10,%rsp
+  801d0f:	41 89 fc             	mov    %edi,%r12d
+  801d12:	48 89 f3             	mov    %rsi,%rbx
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  801d15:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  801d1c:	00 00 00 
+  801d1f:	83 38 00             	cmpl   $0x0,(%rax)
+  801d22:	74 5e                	je     801d82 <fsipc+0x7e>
+    if (debug) {
+        cprintf("[%08x] fsipc %d %08x\n",
+                thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+    }
+
+    ipc_send(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW);
+  801d24:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  801d2a:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  801d2f:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  801d36:	00 00 00 
+  801d39:	44 89 e6             	mov    %r12d,%esi
+  801d3c:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  801d43:	00 00 00 
+  801d46:	8b 38                	mov    (%rax),%edi
+  801d48:	48 b8 11 36 80 00 00 	movabs $0x803611,%rax
+  801d4f:	00 00 00 
+  801d52:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  801d54:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  801d5b:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  801d5c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801d61:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  801d65:	48 89 de             	mov    %rbx,%rsi
+  801d68:	bf 00 00 00 00       	mov    $0x0,%edi
+  801d6d:	48 b8 3c 35 80 00 00 	movabs $0x80353c,%rax
+  801d74:	00 00 00 
+  801d77:	ff d0                	call   *%rax
+}
+  801d79:	48 83 c4 10          	add    $0x10,%rsp
+  801d7d:	5b                   	pop    %rbx
+  801d7e:	41 5c                	pop    %r12
+  801d80:	5d                   	pop    %rbp
+  801d81:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  801d82:	bf 03 00 00 00       	mov    $0x3,%edi
+  801d87:	48 b8 b4 36 80 00 00 	movabs $0x8036b4,%rax
+  801d8e:	00 00 00 
+  801d91:	ff d0                	call   *%rax
+  801d93:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  801d9a:	00 00 
+  801d9c:	eb 86                	jmp    801d24 <fsipc+0x20>
+
+0000000000801d9e <devfile_trunc>:
+    return 0;
+}
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  801d9e:	55                   	push   %rbp
+  801d9f:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801da2:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  801da9:	00 00 00 
+  801dac:	8b 57 0c             	mov    0xc(%rdi),%edx
+  801daf:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  801db1:	89 70 04             	mov    %esi,0x4(%rax)
+
+    return fsipc(FSREQ_SET_SIZE, NULL);
+  801db4:	be 00 00 00 00       	mov    $0x0,%esi
+  801db9:	bf 02 00 00 00       	mov    $0x2,%edi
+  801dbe:	48 b8 04 1d 80 00 00 	movabs $0x801d04,%rax
+  801dc5:	00 00 00 
+  801dc8:	ff d0                	call   *%rax
+}
+  801dca:	5d                   	pop    %rbp
+  801dcb:	c3                   	ret
+
+0000000000801dcc <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  801dcc:	55                   	push   %rbp
+  801dcd:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801dd0:	8b 47 0c             	mov    0xc(%rdi),%eax
+  801dd3:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  801dda:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  801ddc:	be 00 00 00 00       	mov    $0x0,%esi
+  801de1:	bf 06 00 00 00       	mov    $0x6,%edi
+  801de6:	48 b8 04 1d 80 00 00 	movabs $0x801d04,%rax
+  801ded:	00 00 00 
+  801df0:	ff d0                	call   *%rax
+}
+  801df2:	5d                   	pop    %rbp
+  801df3:	c3                   	ret
+
+0000000000801df4 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  801df4:	55                   	push   %rbp
+  801df5:	48 89 e5             	mov    %rsp,%rbp
+  801df8:	41 54                	push   %r12
+  801dfa:	53                   	push   %rbx
+  801dfb:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801dfe:	8b 47 0c             	mov    0xc(%rdi),%eax
+  801e01:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  801e08:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  801e0a:	be 00 00 00 00       	mov    $0x0,%esi
+  801e0f:	bf 05 00 00 00       	mov    $0x5,%edi
+  801e14:	48 b8 04 1d 80 00 00 	movabs $0x801d04,%rax
+  801e1b:	00 00 00 
+  801e1e:	ff d0                	call   *%rax
+    if (res < 0) {
+  801e20:	85 c0                	test   %eax,%eax
+  801e22:	78 3d                	js     801e61 <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801e24:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  801e2b:	00 00 00 
+  801e2e:	4c 89 e6             	mov    %r12,%rsi
+  801e31:	48 89 df             	mov    %rbx,%rdi
+  801e34:	48 b8 eb 0b 80 00 00 	movabs $0x800beb,%rax
+  801e3b:	00 00 00 
+  801e3e:	ff d0                	call   *%rax
+    st->st_size  = fsipcbuf.statRet.ret_size;
+  801e40:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  801e47:	00 
+  801e48:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801e4e:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  801e55:	00 
+  801e56:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  801e5c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801e61:	5b                   	pop    %rbx
+  801e62:	41 5c                	pop    %r12
+  801e64:	5d                   	pop    %rbp
+  801e65:	c3                   	ret
+
+0000000000801e66 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  801e66:	55                   	push   %rbp
+  801e67:	48 89 e5             	mov    %rsp,%rbp
+  801e6a:	41 57                	push   %r15
+  801e6c:	41 56                	push   %r14
+  801e6e:	41 55                	push   %r13
+  801e70:	41 54                	push   %r12
+  801e72:	53                   	push   %rbx
+  801e73:	48 83 ec 18          	sub    $0x18,%rsp
+  801e77:	49 89 fe             	mov    %rdi,%r14
+  801e7a:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+  801e7e:	48 89 d3             	mov    %rdx,%rbx
+    while (n > sizeof(fsipcbuf.write.req_buf))
+  801e81:	48 81 fa f0 0f 00 00 	cmp    $0xff0,%rdx
+  801e88:	0f 86 e4 00 00 00    	jbe    801f72 <devfile_write+0x10c>
+  801e8e:	49 89 f4             	mov    %rsi,%r12
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801e91:	49 bd 00 60 80 00 00 	movabs $0x806000,%r13
+  801e98:	00 00 00 
+        memcpy(fsipcbuf.write.req_buf, buf, sizeof(fsipcbuf.write.req_buf));
+  801e9b:	49 bf 4c 0e 80 00 00 	movabs $0x800e4c,%r15
+  801ea2:	00 00 00 
+  801ea5:	eb 03                	jmp    801eaa <devfile_write+0x44>
+        buf += sizeof(fsipcbuf.write.req_buf);
+  801ea7:	49 89 f4             	mov    %rsi,%r12
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801eaa:	41 8b 46 0c          	mov    0xc(%r14),%eax
+  801eae:	41 89 45 00          	mov    %eax,0x0(%r13)
+        fsipcbuf.write.req_n      = sizeof(fsipcbuf.write.req_buf);
+  801eb2:	49 c7 45 08 f0 0f 00 	movq   $0xff0,0x8(%r13)
+  801eb9:	00 
+        memcpy(fsipcbuf.write.req_buf, buf, sizeof(fsipcbuf.write.req_buf));
+  801eba:	ba f0 0f 00 00       	mov    $0xff0,%edx
+  801ebf:	4c 89 e6             	mov    %r12,%rsi
+  801ec2:	48 bf 10 60 80 00 00 	movabs $0x806010,%rdi
+  801ec9:	00 00 00 
+  801ecc:	41 ff d7             	call   *%r15
+        ssize_t res = fsipc(FSREQ_WRITE, NULL);
+  801ecf:	be 00 00 00 00       	mov    $0x0,%esi
+  801ed4:	bf 04 00 00 00       	mov    $0x4,%edi
+  801ed9:	48 b8 04 1d 80 00 00 	movabs $0x801d04,%rax
+  801ee0:	00 00 00 
+  801ee3:	ff d0                	call   *%rax
+  801ee5:	48 63 d0             	movslq %eax,%rdx
+        if (res < 0 || res < sizeof(fsipcbuf.write.req_buf))
+  801ee8:	3d ef 0f 00 00       	cmp    $0xfef,%eax
+  801eed:	7e 71                	jle    801f60 <devfile_write+0xfa>
+        buf += sizeof(fsipcbuf.write.req_buf);
+  801eef:	49 8d b4 24 f0 0f 00 	lea    0xff0(%r12),%rsi
+  801ef6:	00 
+        n -= sizeof(fsipcbuf.write.req_buf);
+  801ef7:	48 81 eb f0 0f 00 00 	sub    $0xff0,%rbx
+    while (n > sizeof(fsipcbuf.write.req_buf))
+  801efe:	48 81 fb f0 0f 00 00 	cmp    $0xff0,%rbx
+  801f05:	77 a0                	ja     801ea7 <devfile_write+0x41>
+        written += sizeof(fsipcbuf.write.req_buf);
+  801f07:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801f0b:	49 29 c4             	sub    %rax,%r12
+  801f0e:	4d 8d a4 24 f0 0f 00 	lea    0xff0(%r12),%r12
+  801f15:	00 
+    fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801f16:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  801f1d:	00 00 00 
+  801f20:	41 8b 56 0c          	mov    0xc(%r14),%edx
+  801f24:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.write.req_n      = n;
+  801f26:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    memcpy(fsipcbuf.write.req_buf, buf, n);
+  801f2a:	48 89 da             	mov    %rbx,%rdx
+  801f2d:	48 8d 78 10          	lea    0x10(%rax),%rdi
+  801f31:	48 b8 4c 0e 80 00 00 	movabs $0x800e4c,%rax
+  801f38:	00 00 00 
+  801f3b:	ff d0                	call   *%rax
+    ssize_t res = fsipc(FSREQ_WRITE, NULL);
+  801f3d:	be 00 00 00 00       	mov    $0x0,%esi
+  801f42:	bf 04 00 00 00       	mov    $0x4,%edi
+  801f47:	48 b8 04 1d 80 00 00 	movabs $0x801d04,%rax
+  801f4e:	00 00 00 
+  801f51:	ff d0                	call   *%rax
+  801f53:	48 63 d0             	movslq %eax,%rdx
+    written += res;
+  801f56:	49 01 d4             	add    %rdx,%r12
+  801f59:	48 85 d2             	test   %rdx,%rdx
+  801f5c:	49 0f 49 d4          	cmovns %r12,%rdx
+}
+  801f60:	48 89 d0             	mov    %rdx,%rax
+  801f63:	48 83 c4 18          	add    $0x18,%rsp
+  801f67:	5b                   	pop    %rbx
+  801f68:	41 5c                	pop    %r12
+  801f6a:	41 5d                	pop    %r13
+  801f6c:	41 5e                	pop    %r14
+  801f6e:	41 5f                	pop    %r15
+  801f70:	5d                   	pop    %rbp
+  801f71:	c3                   	ret
+    while (n > sizeof(fsipcbuf.write.req_buf))
+  801f72:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+    ssize_t written = 0;
+  801f76:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  801f7c:	eb 98                	jmp    801f16 <devfile_write+0xb0>
+
+0000000000801f7e <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  801f7e:	55                   	push   %rbp
+  801f7f:	48 89 e5             	mov    %rsp,%rbp
+  801f82:	41 57                	push   %r15
+  801f84:	41 56                	push   %r14
+  801f86:	41 55                	push   %r13
+  801f88:	41 54                	push   %r12
+  801f8a:	53                   	push   %rbx
+  801f8b:	48 83 ec 18          	sub    $0x18,%rsp
+  801f8f:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  801f93:	49 89 f6             	mov    %rsi,%r14
+  801f96:	49 89 d4             	mov    %rdx,%r12
+    while (n > sizeof(fsipcbuf.readRet.ret_buf))
+  801f99:	48 81 fa 00 10 00 00 	cmp    $0x1000,%rdx
+  801fa0:	0f 86 ea 00 00 00    	jbe    802090 <devfile_read+0x112>
+    ssize_t readsz = 0;
+  801fa6:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  801fad:	00 
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801fae:	49 bf 00 60 80 00 00 	movabs $0x806000,%r15
+  801fb5:	00 00 00 
+  801fb8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801fbc:	8b 40 0c             	mov    0xc(%rax),%eax
+  801fbf:	41 89 07             	mov    %eax,(%r15)
+        fsipcbuf.read.req_n = sizeof(fsipcbuf.readRet.ret_buf);
+  801fc2:	49 c7 47 08 00 10 00 	movq   $0x1000,0x8(%r15)
+  801fc9:	00 
+        ssize_t res = fsipc(FSREQ_READ, NULL);
+  801fca:	be 00 00 00 00       	mov    $0x0,%esi
+  801fcf:	bf 03 00 00 00       	mov    $0x3,%edi
+  801fd4:	48 b8 04 1d 80 00 00 	movabs $0x801d04,%rax
+  801fdb:	00 00 00 
+  801fde:	ff d0                	call   *%rax
+  801fe0:	4c 63 e8             	movslq %eax,%r13
+        if (res < 0)
+  801fe3:	4d 85 ed             	test   %r13,%r13
+  801fe6:	0f 88 92 00 00 00    	js     80207e <devfile_read+0x100>
+        memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  801fec:	4c 89 ea             	mov    %r13,%rdx
+  801fef:	4c 89 fe             	mov    %r15,%rsi
+  801ff2:	4c 89 f7             	mov    %r14,%rdi
+  801ff5:	48 b8 4c 0e 80 00 00 	movabs $0x800e4c,%rax
+  801ffc:	00 00 00 
+  801fff:	ff d0                	call   *%rax
+        if (res < sizeof(fsipcbuf.readRet.ret_buf))
+  802001:	49 81 fd ff 0f 00 00 	cmp    $0xfff,%r13
+  802008:	76 6d                	jbe    802077 <devfile_read+0xf9>
+        readsz += res;
+  80200a:	4c 01 6d c0          	add    %r13,-0x40(%rbp)
+        buf += res;
+  80200e:	4d 01 ee             	add    %r13,%r14
+        n -= res;
+  802011:	4d 29 ec             	sub    %r13,%r12
+    while (n > sizeof(fsipcbuf.readRet.ret_buf))
+  802014:	49 81 fc 00 10 00 00 	cmp    $0x1000,%r12
+  80201b:	77 9b                	ja     801fb8 <devfile_read+0x3a>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  80201d:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  802024:	00 00 00 
+  802027:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  80202b:	8b 51 0c             	mov    0xc(%rcx),%edx
+  80202e:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.read.req_n = n;
+  802030:	4c 89 60 08          	mov    %r12,0x8(%rax)
+    ssize_t res = fsipc(FSREQ_READ, NULL);
+  802034:	be 00 00 00 00       	mov    $0x0,%esi
+  802039:	bf 03 00 00 00       	mov    $0x3,%edi
+  80203e:	48 b8 04 1d 80 00 00 	movabs $0x801d04,%rax
+  802045:	00 00 00 
+  802048:	ff d0                	call   *%rax
+  80204a:	4c 63 e8             	movslq %eax,%r13
+    if (res < 0)
+  80204d:	4d 85 ed             	test   %r13,%r13
+  802050:	78 2c                	js     80207e <devfile_read+0x100>
+    memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  802052:	4c 89 ea             	mov    %r13,%rdx
+  802055:	48 be 00 60 80 00 00 	movabs $0x806000,%rsi
+  80205c:	00 00 00 
+  80205f:	4c 89 f7             	mov    %r14,%rdi
+  802062:	48 b8 4c 0e 80 00 00 	movabs $0x800e4c,%rax
+  802069:	00 00 00 
+  80206c:	ff d0                	call   *%rax
+    readsz += res;
+  80206e:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802072:	49 01 c5             	add    %rax,%r13
+    return readsz;
+  802075:	eb 07                	jmp    80207e <devfile_read+0x100>
+            return readsz + res;
+  802077:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80207b:	49 01 c5             	add    %rax,%r13
+}
+  80207e:	4c 89 e8             	mov    %r13,%rax
+  802081:	48 83 c4 18          	add    $0x18,%rsp
+  802085:	5b                   	pop    %rbx
+  802086:	41 5c                	pop    %r12
+  802088:	41 5d                	pop    %r13
+  80208a:	41 5e                	pop    %r14
+  80208c:	41 5f                	pop    %r15
+  80208e:	5d                   	pop    %rbp
+  80208f:	c3                   	ret
+    ssize_t readsz = 0;
+  802090:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  802097:	00 
+  802098:	eb 83                	jmp    80201d <devfile_read+0x9f>
+
+000000000080209a <open>:
+open(const char *path, int mode) {
+  80209a:	55                   	push   %rbp
+  80209b:	48 89 e5             	mov    %rsp,%rbp
+  80209e:	41 55                	push   %r13
+  8020a0:	41 54                	push   %r12
+  8020a2:	53                   	push   %rbx
+  8020a3:	48 83 ec 18          	sub    $0x18,%rsp
+  8020a7:	49 89 fc             	mov    %rdi,%r12
+  8020aa:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  8020ad:	48 b8 ad 0b 80 00 00 	movabs $0x800bad,%rax
+  8020b4:	00 00 00 
+  8020b7:	ff d0                	call   *%rax
+  8020b9:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  8020bf:	0f 87 8a 00 00 00    	ja     80214f <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8020c5:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  8020c9:	48 b8 7d 16 80 00 00 	movabs $0x80167d,%rax
+  8020d0:	00 00 00 
+  8020d3:	ff d0                	call   *%rax
+  8020d5:	89 c3                	mov    %eax,%ebx
+  8020d7:	85 c0                	test   %eax,%eax
+  8020d9:	78 50                	js     80212b <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  8020db:	4c 89 e6             	mov    %r12,%rsi
+  8020de:	48 bb 00 60 80 00 00 	movabs $0x806000,%rbx
+  8020e5:	00 00 00 
+  8020e8:	48 89 df             	mov    %rbx,%rdi
+  8020eb:	48 b8 eb 0b 80 00 00 	movabs $0x800beb,%rax
+  8020f2:	00 00 00 
+  8020f5:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  8020f7:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  8020fe:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802102:	bf 01 00 00 00       	mov    $0x1,%edi
+  802107:	48 b8 04 1d 80 00 00 	movabs $0x801d04,%rax
+  80210e:	00 00 00 
+  802111:	ff d0                	call   *%rax
+  802113:	89 c3                	mov    %eax,%ebx
+  802115:	85 c0                	test   %eax,%eax
+  802117:	78 1f                	js     802138 <open+0x9e>
+    return fd2num(fd);
+  802119:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80211d:	48 b8 d6 15 80 00 00 	movabs $0x8015d6,%rax
+  802124:	00 00 00 
+  802127:	ff d0                	call   *%rax
+  802129:	89 c3                	mov    %eax,%ebx
+}
+  80212b:	89 d8                	mov    %ebx,%eax
+  80212d:	48 83 c4 18          	add    $0x18,%rsp
+  802131:	5b                   	pop    %rbx
+  802132:	41 5c                	pop    %r12
+  802134:	41 5d                	pop    %r13
+  802136:	5d                   	pop    %rbp
+  802137:	c3                   	ret
+        fd_close(fd, 0);
+  802138:	be 00 00 00 00       	mov    $0x0,%esi
+  80213d:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802141:	48 b8 52 17 80 00 00 	movabs $0x801752,%rax
+  802148:	00 00 00 
+  80214b:	ff d0                	call   *%rax
+        return res;
+  80214d:	eb dc                	jmp    80212b <open+0x91>
+        return -E_BAD_PATH;
+  80214f:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  802154:	eb d5                	jmp    80212b <open+0x91>
+
+0000000000802156 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  802156:	55                   	push   %rbp
+  802157:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc(FSREQ_SYNC, NULL);
+  80215a:	be 00 00 00 00       	mov    $0x0,%esi
+  80215f:	bf 08 00 00 00       	mov    $0x8,%edi
+  802164:	48 b8 04 1d 80 00 00 	movabs $0x801d04,%rax
+  80216b:	00 00 00 
+  80216e:	ff d0                	call   *%rax
+}
+  802170:	5d                   	pop    %rbp
+  802171:	c3                   	ret
+
+0000000000802172 <region_flush>:
+ * sys_region_batch() call right before memory at UTEMP is reused */
+static struct RegionOp region_queue[REGION_BATCH_MAX];
+static size_t region_queued;
+
+static int
+region_flush(void) {
+  802172:	55                   	push   %rbp
+  802173:	48 89 e5             	mov    %rsp,%rbp
+  802176:	41 56                	push   %r14
+  802178:	41 55                	push   %r13
+  80217a:	41 54                	push   %r12
+  80217c:	53                   	push   %rbx
+    int res = region_queued ? sys_region_batch(region_queue, region_queued) : 0;
+  80217d:	48 b8 20 70 80 00 00 	movabs $0x807020,%rax
+  802184:	00 00 00 
+  802187:	48 8b 30             	mov    (%rax),%rsi
+  80218a:	41 be 00 00 00 00    	mov    $0x0,%r14d
+  802190:	48 85 f6             	test   %rsi,%rsi
+  802193:	74 6d                	je     802202 <region_flush+0x90>
+  802195:	48 bf 40 70 80 00 00 	movabs $0x807040,%rdi
+  80219c:	00 00 00 
+  80219f:	48 b8 ce 12 80 00 00 	movabs $0x8012ce,%rax
+  8021a6:	00 00 00 
+  8021a9:	ff d0                	call   *%rax
+  8021ab:	41 89 c6             	mov    %eax,%r14d
+
+    /* Operations following the failed one are not performed,
+     * but memory at UTEMP still has to be unmapped from ours */
+    for (size_t i = 0; res < 0 && i < region_queued; i++) {
+  8021ae:	85 c0                	test   %eax,%eax
+  8021b0:	79 50                	jns    802202 <region_flush+0x90>
+  8021b2:	48 bb 40 70 80 00 00 	movabs $0x807040,%rbx
+  8021b9:	00 00 00 
+  8021bc:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8021c2:	49 bd 20 70 80 00 00 	movabs $0x807020,%r13
+  8021c9:	00 00 00 
+  8021cc:	eb 08                	jmp    8021d6 <region_flush+0x64>
+  8021ce:	49 83 c4 01          	add    $0x1,%r12
+  8021d2:	48 83 c3 28          	add    $0x28,%rbx
+  8021d6:	4d 3b 65 00          	cmp    0x0(%r13),%r12
+  8021da:	73 26                	jae    802202 <region_flush+0x90>
+        struct RegionOp *op = &region_queue[i];
+        if (op->type == REGION_UNMAP && !op->dstenv)
+  8021dc:	83 3b 02             	cmpl   $0x2,(%rbx)
+  8021df:	75 ed                	jne    8021ce <region_flush+0x5c>
+  8021e1:	83 7b 0c 00          	cmpl   $0x0,0xc(%rbx)
+  8021e5:	75 e7                	jne    8021ce <region_flush+0x5c>
+            sys_unmap_region(0, (void *)op->dstva, op->size);
+  8021e7:	48 8b 53 20          	mov    0x20(%rbx),%rdx
+  8021eb:	48 8b 73 18          	mov    0x18(%rbx),%rsi
+  8021ef:	bf 00 00 00 00       	mov    $0x0,%edi
+  8021f4:	48 b8 67 12 80 00 00 	movabs $0x801267,%rax
+  8021fb:	00 00 00 
+  8021fe:	ff d0                	call   *%rax
+  802200:	eb cc                	jmp    8021ce <region_flush+0x5c>
+    }
+    region_queued = 0;
+  802202:	48 b8 20 70 80 00 00 	movabs $0x807020,%rax
+  802209:	00 00 00 
+  80220c:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+    return res;
+}
+  802213:	44 89 f0             	mov    %r14d,%eax
+  802216:	5b                   	pop    %rbx
+  802217:	41 5c                	pop    %r12
+  802219:	41 5d                	pop    %r13
+  80221b:	41 5e                	pop    %r14
+  80221d:	5d                   	pop    %rbp
+  80221e:	c3                   	ret
+
+000000000080221f <region_queue_op>:
+
+static int
+region_queue_op(int type, envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  80221f:	55                   	push   %rbp
+  802220:	48 89 e5             	mov    %rsp,%rbp
+  802223:	41 57                	push   %r15
+  802225:	41 56                	push   %r14
+  802227:	41 55                	push   %r13
+  802229:	41 54                	push   %r12
+  80222b:	53                   	push   %rbx
+  80222c:	48 83 ec 18          	sub    $0x18,%rsp
+  802230:	41 89 ff             	mov    %edi,%r15d
+  802233:	41 89 f6             	mov    %esi,%r14d
+  802236:	49 89 d4             	mov    %rdx,%r12
+  802239:	41 89 cd             	mov    %ecx,%r13d
+  80223c:	4c 89 c3             	mov    %r8,%rbx
+  80223f:	4c 89 4d c8          	mov    %r9,-0x38(%rbp)
+    int res = region_queued == REGION_BATCH_MAX ? region_flush() : 0;
+  802243:	bf 00 00 00 00       	mov    $0x0,%edi
+  802248:	48 b8 20 70 80 00 00 	movabs $0x807020,%rax
+  80224f:	00 00 00 
+  802252:	48 83 38 10          	cmpq   $0x10,(%rax)
+  802256:	74 66                	je     8022be <region_queue_op+0x9f>
+    region_queue[region_queued++] = (struct RegionOp){
+  802258:	48 b8 20 70 80 00 00 	movabs $0x807020,%rax
+  80225f:	00 00 00 
+  802262:	48 8b 08             	mov    (%rax),%rcx
+  802265:	48 8d 51 01          	lea    0x1(%rcx),%rdx
+  802269:	48 89 10             	mov    %rdx,(%rax)
+  80226c:	48 be 40 70 80 00 00 	movabs $0x807040,%rsi
+  802273:	00 00 00 
+  802276:	48 8d 14 8d 00 00 00 	lea    0x0(,%rcx,4),%rdx
+  80227d:	00 
+  80227e:	48 8d 04 0a          	lea    (%rdx,%rcx,1),%rax
+  802282:	48 8d 04 c6          	lea    (%rsi,%rax,8),%rax
+  802286:	44 89 38             	mov    %r15d,(%rax)
+  802289:	44 8b 45 10          	mov    0x10(%rbp),%r8d
+  80228d:	44 89 40 04          	mov    %r8d,0x4(%rax)
+  802291:	44 89 70 08          	mov    %r14d,0x8(%rax)
+  802295:	44 89 68 0c          	mov    %r13d,0xc(%rax)
+  802299:	4c 89 60 10          	mov    %r12,0x10(%rax)
+  80229d:	48 89 58 18          	mov    %rbx,0x18(%rax)
+  8022a1:	48 01 ca             	add    %rcx,%rdx
+  8022a4:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8022a8:	48 89 44 d6 20       	mov    %rax,0x20(%rsi,%rdx,8)
+            .srcva = (uintptr_t)srcva,
+            .dstva = (uintptr_t)dstva,
+            .size = size,
+    };
+    return res;
+}
+  8022ad:	89 f8                	mov    %edi,%eax
+  8022af:	48 83 c4 18          	add    $0x18,%rsp
+  8022b3:	5b                   	pop    %rbx
+  8022b4:	41 5c                	pop    %r12
+  8022b6:	41 5d                	pop    %r13
+  8022b8:	41 5e                	pop    %r14
+  8022ba:	41 5f                	pop    %r15
+  8022bc:	5d                   	pop    %rbp
+  8022bd:	c3                   	ret
+    int res = region_queued == REGION_BATCH_MAX ? region_flush() : 0;
+  8022be:	48 b8 72 21 80 00 00 	movabs $0x802172,%rax
+  8022c5:	00 00 00 
+  8022c8:	ff d0                	call   *%rax
+  8022ca:	89 c7                	mov    %eax,%edi
+  8022cc:	eb 8a                	jmp    802258 <region_queue_op+0x39>
+
+00000000008022ce <copy_shared_region>:
+    int unmap = region_queue_op(REGION_UNMAP, 0, NULL, 0, UTEMP, USER_STACK_SIZE, 0);
+    return res < 0 ? res : unmap;
+}
+
+static int
+copy_shared_region(void *start, void *end, void *arg) {
+  8022ce:	55                   	push   %rbp
+  8022cf:	48 89 e5             	mov    %rsp,%rbp
+  8022d2:	41 55                	push   %r13
+  8022d4:	41 54                	push   %r12
+  8022d6:	53                   	push   %rbx
+  8022d7:	48 83 ec 08          	sub    $0x8,%rsp
+  8022db:	48 89 fb             	mov    %rdi,%rbx
+  8022de:	49 89 f4             	mov    %rsi,%r12
+    envid_t child = *(envid_t *)arg;
+  8022e1:	44 8b 2a             	mov    (%rdx),%r13d
+    return region_queue_op(REGION_MAP, 0, start, child, start, end - start, get_prot(start));
+  8022e4:	48 b8 1d 31 80 00 00 	movabs $0x80311d,%rax
+  8022eb:	00 00 00 
+  8022ee:	ff d0                	call   *%rax
+  8022f0:	48 83 ec 08          	sub    $0x8,%rsp
+  8022f4:	50                   	push   %rax
+  8022f5:	4d 89 e1             	mov    %r12,%r9
+  8022f8:	49 29 d9             	sub    %rbx,%r9
+  8022fb:	49 89 d8             	mov    %rbx,%r8
+  8022fe:	44 89 e9             	mov    %r13d,%ecx
+  802301:	48 89 da             	mov    %rbx,%rdx
+  802304:	be 00 00 00 00       	mov    $0x0,%esi
+  802309:	bf 01 00 00 00       	mov    $0x1,%edi
+  80230e:	48 b8 1f 22 80 00 00 	movabs $0x80221f,%rax
+  802315:	00 00 00 
+  802318:	ff d0                	call   *%rax
+}
+  80231a:	48 8d 65 e8          	lea    -0x18(%rbp),%rsp
+  80231e:	5b                   	pop    %rbx
+  80231f:	41 5c                	pop    %r12
+  802321:	41 5d                	pop    %r13
+  802323:	5d                   	pop    %rbp
+  802324:	c3                   	ret
+
+0000000000802325 <spawn>:
+spawn(const char *prog, const char **argv) {
+  802325:	55                   	push   %rbp
+  802326:	48 89 e5             	mov    %rsp,%rbp
+  802329:	41 57                	push   %r15
+  80232b:	41 56                	push   %r14
+  80232d:	41 55                	push   %r13
+  80232f:	41 54                	push   %r12
+  802331:	53                   	push   %rbx
+  802332:	48 81 ec 08 03 00 00 	sub    $0x308,%rsp
+  802339:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(prog, O_RDONLY);
+  80233c:	be 00 00 00 00       	mov    $0x0,%esi
+  802341:	48 b8 9a 20 80 00 00 	movabs $0x80209a,%rax
+  802348:	00 00 00 
+  80234b:	ff d0                	call   *%rax
+  80234d:	89 85 fc fc ff ff    	mov    %eax,-0x304(%rbp)
+    if (fd < 0) return fd;
+  802353:	85 c0                	test   %eax,%eax
+  802355:	0f 88 08 07 00 00    	js     802a63 <spawn+0x73e>
+  80235b:	89 c7                	mov    %eax,%edi
+    res = readn(fd, elf_buf, sizeof(elf_buf));
+  80235d:	ba 00 02 00 00       	mov    $0x200,%edx
+  802362:	48 8d b5 d0 fd ff ff 	lea    -0x230(%rbp),%rsi
+  802369:	48 b8 38 1a 80 00 00 	movabs $0x801a38,%rax
+  802370:	00 00 00 
+  802373:	ff d0                	call   *%rax
+  802375:	89 c6                	mov    %eax,%esi
+    if (res != sizeof(elf_buf)) {
+  802377:	3d 00 02 00 00       	cmp    $0x200,%eax
+  80237c:	0f 85 d2 02 00 00    	jne    802654 <spawn+0x32f>
+        elf->e_elf[1] != 1 /* little endian */ ||
+  802382:	48 b8 ff ff ff ff ff 	movabs $0xffffffffffffff,%rax
+  802389:	ff ff 00 
+  80238c:	48 23 85 d0 fd ff ff 	and    -0x230(%rbp),%rax
+    if (elf->e_magic != ELF_MAGIC ||
+  802393:	48 ba 7f 45 4c 46 02 	movabs $0x10102464c457f,%rdx
+  80239a:	01 01 00 
+  80239d:	48 39 d0             	cmp    %rdx,%rax
+  8023a0:	0f 85 ea 02 00 00    	jne    802690 <spawn+0x36b>
+        elf->e_type != ET_EXEC /* executable */ ||
+  8023a6:	81 bd e0 fd ff ff 02 	cmpl   $0x3e0002,-0x220(%rbp)
+  8023ad:	00 3e 00 
+  8023b0:	0f 85 da 02 00 00    	jne    802690 <spawn+0x36b>
+
+/* This must be inlined. Exercise for reader: why? */
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+    envid_t ret;
+    asm volatile("int %2"
+  8023b6:	b8 08 00 00 00       	mov    $0x8,%eax
+  8023bb:	cd 30                	int    $0x30
+  8023bd:	89 85 f0 fc ff ff    	mov    %eax,-0x310(%rbp)
+  8023c3:	89 c3                	mov    %eax,%ebx
+    if ((int)(res = sys_exofork()) < 0) goto error2;
+  8023c5:	85 c0                	test   %eax,%eax
+  8023c7:	0f 88 7e 06 00 00    	js     802a4b <spawn+0x726>
+    envid_t child = res;
+  8023cd:	89 85 cc fd ff ff    	mov    %eax,-0x234(%rbp)
+    struct Trapframe child_tf = envs[ENVX(child)].env_tf;
+  8023d3:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8023d8:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+  8023df:	48 be 00 00 c0 1f 80 	movabs $0x801fc00000,%rsi
+  8023e6:	00 00 00 
+  8023e9:	48 01 c6             	add    %rax,%rsi
+  8023ec:	48 8b 06             	mov    (%rsi),%rax
+  8023ef:	48 89 85 0c fd ff ff 	mov    %rax,-0x2f4(%rbp)
+  8023f6:	48 8b 86 b8 00 00 00 	mov    0xb8(%rsi),%rax
+  8023fd:	48 89 85 c4 fd ff ff 	mov    %rax,-0x23c(%rbp)
+  802404:	48 8d bd 10 fd ff ff 	lea    -0x2f0(%rbp),%rdi
+  80240b:	48 c7 c1 fc ff ff ff 	mov    $0xfffffffffffffffc,%rcx
+  802412:	48 29 ce             	sub    %rcx,%rsi
+  802415:	81 c1 c0 00 00 00    	add    $0xc0,%ecx
+  80241b:	c1 e9 03             	shr    $0x3,%ecx
+  80241e:	89 c9                	mov    %ecx,%ecx
+  802420:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+    child_tf.tf_rip = elf->e_entry;
+  802423:	48 8b 85 e8 fd ff ff 	mov    -0x218(%rbp),%rax
+  80242a:	48 89 85 a4 fd ff ff 	mov    %rax,-0x25c(%rbp)
+    for (argc = 0; argv[argc] != 0; argc++)
+  802431:	49 8b 3c 24          	mov    (%r12),%rdi
+  802435:	48 85 ff             	test   %rdi,%rdi
+  802438:	0f 84 99 02 00 00    	je     8026d7 <spawn+0x3b2>
+  80243e:	41 bd 01 00 00 00    	mov    $0x1,%r13d
+    string_size = 0;
+  802444:	41 be 00 00 00 00    	mov    $0x0,%r14d
+        string_size += strlen(argv[argc]) + 1;
+  80244a:	49 bf ad 0b 80 00 00 	movabs $0x800bad,%r15
+  802451:	00 00 00 
+  802454:	41 ff d7             	call   *%r15
+  802457:	4a 8d 1c 30          	lea    (%rax,%r14,1),%rbx
+  80245b:	4c 8d 73 01          	lea    0x1(%rbx),%r14
+    for (argc = 0; argv[argc] != 0; argc++)
+  80245f:	4c 89 e8             	mov    %r13,%rax
+  802462:	49 83 c5 01          	add    $0x1,%r13
+  802466:	4b 8b 7c ec f8       	mov    -0x8(%r12,%r13,8),%rdi
+  80246b:	48 85 ff             	test   %rdi,%rdi
+  80246e:	75 e4                	jne    802454 <spawn+0x12f>
+    string_store = (char *)UTEMP + USER_STACK_SIZE - string_size;
+  802470:	48 89 c2             	mov    %rax,%rdx
+  802473:	48 89 85 e8 fc ff ff 	mov    %rax,-0x318(%rbp)
+  80247a:	48 f7 d3             	not    %rbx
+  80247d:	48 81 c3 00 00 41 00 	add    $0x410000,%rbx
+    argv_store = (uintptr_t *)(ROUNDDOWN(string_store, sizeof(uintptr_t)) - sizeof(uintptr_t) * (argc + 1));
+  802484:	48 89 d9             	mov    %rbx,%rcx
+  802487:	48 83 e1 f8          	and    $0xfffffffffffffff8,%rcx
+  80248b:	48 89 8d e0 fc ff ff 	mov    %rcx,-0x320(%rbp)
+  802492:	83 c0 01             	add    $0x1,%eax
+  802495:	48 98                	cltq
+  802497:	48 c1 e0 03          	shl    $0x3,%rax
+  80249b:	48 29 c1             	sub    %rax,%rcx
+  80249e:	49 89 cf             	mov    %rcx,%r15
+    if ((void *)(argv_store - 2) < (void *)UTEMP) return -E_NO_MEM;
+  8024a1:	48 8d 41 f0          	lea    -0x10(%rcx),%rax
+  8024a5:	48 3d ff ff 3f 00    	cmp    $0x3fffff,%rax
+  8024ab:	0f 86 73 05 00 00    	jbe    802a24 <spawn+0x6ff>
+    for (argc = 0; argv[argc] != 0; argc++)
+  8024b1:	41 89 d6             	mov    %edx,%r14d
+    if ((res = region_queue_op(REGION_ALLOC, 0, NULL, 0, UTEMP, USER_STACK_SIZE, PROT_RW)) < 0 ||
+  8024b4:	48 83 ec 08          	sub    $0x8,%rsp
+  8024b8:	6a 06                	push   $0x6
+  8024ba:	41 b9 00 00 01 00    	mov    $0x10000,%r9d
+  8024c0:	41 b8 00 00 40 00    	mov    $0x400000,%r8d
+  8024c6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8024cb:	ba 00 00 00 00       	mov    $0x0,%edx
+  8024d0:	be 00 00 00 00       	mov    $0x0,%esi
+  8024d5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8024da:	48 b8 1f 22 80 00 00 	movabs $0x80221f,%rax
+  8024e1:	00 00 00 
+  8024e4:	ff d0                	call   *%rax
+  8024e6:	41 89 c5             	mov    %eax,%r13d
+  8024e9:	48 83 c4 10          	add    $0x10,%rsp
+  8024ed:	85 c0                	test   %eax,%eax
+  8024ef:	0f 88 35 05 00 00    	js     802a2a <spawn+0x705>
+        (res = region_flush()) < 0) return res;
+  8024f5:	48 b8 72 21 80 00 00 	movabs $0x802172,%rax
+  8024fc:	00 00 00 
+  8024ff:	ff d0                	call   *%rax
+  802501:	41 89 c5             	mov    %eax,%r13d
+    if ((res = region_queue_op(REGION_ALLOC, 0, NULL, 0, UTEMP, USER_STACK_SIZE, PROT_RW)) < 0 ||
+  802504:	85 c0                	test   %eax,%eax
+  802506:	0f 88 1e 05 00 00    	js     802a2a <spawn+0x705>
+    for (i = 0; i < argc; i++) {
+  80250c:	45 85 f6             	test   %r14d,%r14d
+  80250f:	7e 55                	jle    802566 <spawn+0x241>
+  802511:	4d 89 fd             	mov    %r15,%r13
+  802514:	4d 63 f6             	movslq %r14d,%r14
+  802517:	4f 8d 34 f7          	lea    (%r15,%r14,8),%r14
+        argv_store[i] = UTEMP2USTACK(string_store);
+  80251b:	48 b8 00 70 fe ff 7f 	movabs $0x7ffffe7000,%rax
+  802522:	00 00 00 
+  802525:	48 8d 84 03 00 00 c0 	lea    -0x400000(%rbx,%rax,1),%rax
+  80252c:	ff 
+  80252d:	49 89 45 00          	mov    %rax,0x0(%r13)
+        strcpy(string_store, argv[i]);
+  802531:	49 8b 34 24          	mov    (%r12),%rsi
+  802535:	48 89 df             	mov    %rbx,%rdi
+  802538:	48 b8 eb 0b 80 00 00 	movabs $0x800beb,%rax
+  80253f:	00 00 00 
+  802542:	ff d0                	call   *%rax
+        string_store += strlen(argv[i]) + 1;
+  802544:	49 8b 3c 24          	mov    (%r12),%rdi
+  802548:	48 b8 ad 0b 80 00 00 	movabs $0x800bad,%rax
+  80254f:	00 00 00 
+  802552:	ff d0                	call   *%rax
+  802554:	48 8d 5c 03 01       	lea    0x1(%rbx,%rax,1),%rbx
+    for (i = 0; i < argc; i++) {
+  802559:	49 83 c5 08          	add    $0x8,%r13
+  80255d:	49 83 c4 08          	add    $0x8,%r12
+  802561:	4d 39 f5             	cmp    %r14,%r13
+  802564:	75 b5                	jne    80251b <spawn+0x1f6>
+    argv_store[argc] = 0;
+  802566:	48 8b 85 e0 fc ff ff 	mov    -0x320(%rbp),%rax
+  80256d:	48 c7 40 f8 00 00 00 	movq   $0x0,-0x8(%rax)
+  802574:	00 
+    assert(string_store == (char *)UTEMP + USER_STACK_SIZE);
+  802575:	48 81 fb 00 00 41 00 	cmp    $0x410000,%rbx
+  80257c:	0f 85 81 01 00 00    	jne    802703 <spawn+0x3de>
+    argv_store[-1] = UTEMP2USTACK(argv_store);
+  802582:	49 b8 00 70 fe ff 7f 	movabs $0x7ffffe7000,%r8
+  802589:	00 00 00 
+  80258c:	4b 8d 84 07 00 00 c0 	lea    -0x400000(%r15,%r8,1),%rax
+  802593:	ff 
+  802594:	49 89 47 f8          	mov    %rax,-0x8(%r15)
+    argv_store[-2] = argc;
+  802598:	48 8b 85 e8 fc ff ff 	mov    -0x318(%rbp),%rax
+  80259f:	49 89 47 f0          	mov    %rax,-0x10(%r15)
+    tf->tf_rsp = UTEMP2USTACK(&argv_store[-2]);
+  8025a3:	48 b8 f0 6f fe ff 7f 	movabs $0x7ffffe6ff0,%rax
+  8025aa:	00 00 00 
+  8025ad:	49 8d 84 07 00 00 c0 	lea    -0x400000(%r15,%rax,1),%rax
+  8025b4:	ff 
+  8025b5:	48 89 85 bc fd ff ff 	mov    %rax,-0x244(%rbp)
+    res = region_queue_op(REGION_MAP, 0, UTEMP, child, (void *)(USER_STACK_TOP - USER_STACK_SIZE),
+  8025bc:	48 83 ec 08          	sub    $0x8,%rsp
+  8025c0:	6a 06                	push   $0x6
+  8025c2:	41 b9 00 00 01 00    	mov    $0x10000,%r9d
+  8025c8:	8b 8d f0 fc ff ff    	mov    -0x310(%rbp),%ecx
+  8025ce:	ba 00 00 40 00       	mov    $0x400000,%edx
+  8025d3:	be 00 00 00 00       	mov    $0x0,%esi
+  8025d8:	bf 01 00 00 00       	mov    $0x1,%edi
+  8025dd:	48 bb 1f 22 80 00 00 	movabs $0x80221f,%rbx
+  8025e4:	00 00 00 
+  8025e7:	ff d3                	call   *%rbx
+  8025e9:	41 89 c5             	mov    %eax,%r13d
+    int unmap = region_queue_op(REGION_UNMAP, 0, NULL, 0, UTEMP, USER_STACK_SIZE, 0);
+  8025ec:	c7 04 24 00 00 00 00 	movl   $0x0,(%rsp)
+  8025f3:	41 b9 00 00 01 00    	mov    $0x10000,%r9d
+  8025f9:	41 b8 00 00 40 00    	mov    $0x400000,%r8d
+  8025ff:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802604:	ba 00 00 00 00       	mov    $0x0,%edx
+  802609:	be 00 00 00 00       	mov    $0x0,%esi
+  80260e:	bf 02 00 00 00       	mov    $0x2,%edi
+  802613:	ff d3                	call   *%rbx
+  802615:	89 c3                	mov    %eax,%ebx
+    return res < 0 ? res : unmap;
+  802617:	48 83 c4 10          	add    $0x10,%rsp
+  80261b:	45 85 ed             	test   %r13d,%r13d
+  80261e:	0f 88 06 04 00 00    	js     802a2a <spawn+0x705>
+    if ((res = init_stack(child, argv, &child_tf)) < 0) goto error;
+  802624:	85 c0                	test   %eax,%eax
+  802626:	0f 88 01 04 00 00    	js     802a2d <spawn+0x708>
+    struct Proghdr *ph = (struct Proghdr *)(elf_buf + elf->e_phoff);
+  80262c:	48 8b 85 f0 fd ff ff 	mov    -0x210(%rbp),%rax
+  802633:	4c 8d ac 05 d0 fd ff 	lea    -0x230(%rbp,%rax,1),%r13
+  80263a:	ff 
+    for (size_t i = 0; i < elf->e_phnum; i++, ph++) {
+  80263b:	66 83 bd 08 fe ff ff 	cmpw   $0x0,-0x1f8(%rbp)
+  802642:	00 
+  802643:	0f 84 c8 02 00 00    	je     802911 <spawn+0x5ec>
+  802649:	41 be 00 00 00 00    	mov    $0x0,%r14d
+  80264f:	e9 63 01 00 00       	jmp    8027b7 <spawn+0x492>
+        cprintf("Wrong ELF header size or read error: %i\n", res);
+  802654:	48 bf a0 3d 80 00 00 	movabs $0x803da0,%rdi
+  80265b:	00 00 00 
+  80265e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802663:	48 ba c6 02 80 00 00 	movabs $0x8002c6,%rdx
+  80266a:	00 00 00 
+  80266d:	ff d2                	call   *%rdx
+        close(fd);
+  80266f:	8b bd fc fc ff ff    	mov    -0x304(%rbp),%edi
+  802675:	48 b8 fc 17 80 00 00 	movabs $0x8017fc,%rax
+  80267c:	00 00 00 
+  80267f:	ff d0                	call   *%rax
+        return -E_NOT_EXEC;
+  802681:	c7 85 fc fc ff ff ee 	movl   $0xffffffee,-0x304(%rbp)
+  802688:	ff ff ff 
+  80268b:	e9 d3 03 00 00       	jmp    802a63 <spawn+0x73e>
+        cprintf("Elf magic %08x want %08x\n", elf->e_magic, ELF_MAGIC);
+  802690:	ba 7f 45 4c 46       	mov    $0x464c457f,%edx
+  802695:	8b b5 d0 fd ff ff    	mov    -0x230(%rbp),%esi
+  80269b:	48 bf 00 3e 80 00 00 	movabs $0x803e00,%rdi
+  8026a2:	00 00 00 
+  8026a5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8026aa:	48 b9 c6 02 80 00 00 	movabs $0x8002c6,%rcx
+  8026b1:	00 00 00 
+  8026b4:	ff d1                	call   *%rcx
+        close(fd);
+  8026b6:	8b bd fc fc ff ff    	mov    -0x304(%rbp),%edi
+  8026bc:	48 b8 fc 17 80 00 00 	movabs $0x8017fc,%rax
+  8026c3:	00 00 00 
+  8026c6:	ff d0                	call   *%rax
+        return -E_NOT_EXEC;
+  8026c8:	c7 85 fc fc ff ff ee 	movl   $0xffffffee,-0x304(%rbp)
+  8026cf:	ff ff ff 
+  8026d2:	e9 8c 03 00 00       	jmp    802a63 <spawn+0x73e>
+    for (argc = 0; argv[argc] != 0; argc++)
+  8026d7:	48 c7 85 e8 fc ff ff 	movq   $0x0,-0x318(%rbp)
+  8026de:	00 00 00 00 
+  8026e2:	41 be 00 00 00 00    	mov    $0x0,%r14d
+    argv_store = (uintptr_t *)(ROUNDDOWN(string_store, sizeof(uintptr_t)) - sizeof(uintptr_t) * (argc + 1));
+  8026e8:	41 bf f8 ff 40 00    	mov    $0x40fff8,%r15d
+  8026ee:	48 c7 85 e0 fc ff ff 	movq   $0x410000,-0x320(%rbp)
+  8026f5:	00 00 41 00 
+    string_store = (char *)UTEMP + USER_STACK_SIZE - string_size;
+  8026f9:	bb 00 00 41 00       	mov    $0x410000,%ebx
+  8026fe:	e9 b1 fd ff ff       	jmp    8024b4 <spawn+0x18f>
+    assert(string_store == (char *)UTEMP + USER_STACK_SIZE);
+  802703:	48 b9 d0 3d 80 00 00 	movabs $0x803dd0,%rcx
+  80270a:	00 00 00 
+  80270d:	48 ba 1a 3e 80 00 00 	movabs $0x803e1a,%rdx
+  802714:	00 00 00 
+  802717:	be 16 01 00 00       	mov    $0x116,%esi
+  80271c:	48 bf 2f 3e 80 00 00 	movabs $0x803e2f,%rdi
+  802723:	00 00 00 
+  802726:	b8 00 00 00 00       	mov    $0x0,%eax
+  80272b:	49 b8 76 01 80 00 00 	movabs $0x800176,%r8
+  802732:	00 00 00 
+  802735:	41 ff d0             	call   *%r8
+    }
+    res = readn(fd, UTEMP, filesz);
+    if (res < 0) {
+        goto cleanup;
+    }
+    res = region_queue_op(REGION_MAP, 0, UTEMP, child, (void *)va, memsz, perm);
+  802738:	48 83 ec 08          	sub    $0x8,%rsp
+  80273c:	41 54                	push   %r12
+  80273e:	4d 89 f9             	mov    %r15,%r9
+  802741:	4c 8b 85 f0 fc ff ff 	mov    -0x310(%rbp),%r8
+  802748:	8b 8d e8 fc ff ff    	mov    -0x318(%rbp),%ecx
+  80274e:	ba 00 00 40 00       	mov    $0x400000,%edx
+  802753:	be 00 00 00 00       	mov    $0x0,%esi
+  802758:	bf 01 00 00 00       	mov    $0x1,%edi
+  80275d:	49 bc 1f 22 80 00 00 	movabs $0x80221f,%r12
+  802764:	00 00 00 
+  802767:	41 ff d4             	call   *%r12
+  80276a:	89 c3                	mov    %eax,%ebx
+    if (res < 0) {
+        goto cleanup;
+    }
+cleanup:
+    region_queue_op(REGION_UNMAP, 0, NULL, 0, UTEMP, memsz, 0);
+  80276c:	c7 04 24 00 00 00 00 	movl   $0x0,(%rsp)
+  802773:	4d 89 f9             	mov    %r15,%r9
+  802776:	41 b8 00 00 40 00    	mov    $0x400000,%r8d
+  80277c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802781:	ba 00 00 00 00       	mov    $0x0,%edx
+  802786:	be 00 00 00 00       	mov    $0x0,%esi
+  80278b:	bf 02 00 00 00       	mov    $0x2,%edi
+  802790:	41 ff d4             	call   *%r12
+        if ((res = map_segment(child, ph->p_va, ph->p_memsz,
+  802793:	48 83 c4 10          	add    $0x10,%rsp
+  802797:	85 db                	test   %ebx,%ebx
+  802799:	0f 88 8e 02 00 00    	js     802a2d <spawn+0x708>
+    for (size_t i = 0; i < elf->e_phnum; i++, ph++) {
+  80279f:	49 83 c6 01          	add    $0x1,%r14
+  8027a3:	49 83 c5 38          	add    $0x38,%r13
+  8027a7:	0f b7 85 08 fe ff ff 	movzwl -0x1f8(%rbp),%eax
+  8027ae:	49 39 c6             	cmp    %rax,%r14
+  8027b1:	0f 83 5a 01 00 00    	jae    802911 <spawn+0x5ec>
+        if (ph->p_type != ELF_PROG_LOAD) continue;
+  8027b7:	41 83 7d 00 01       	cmpl   $0x1,0x0(%r13)
+  8027bc:	75 e1                	jne    80279f <spawn+0x47a>
+        if (ph->p_flags & ELF_PROG_FLAG_WRITE) perm |= PROT_W;
+  8027be:	41 8b 45 04          	mov    0x4(%r13),%eax
+  8027c2:	41 89 c4             	mov    %eax,%r12d
+  8027c5:	41 83 e4 02          	and    $0x2,%r12d
+        if (ph->p_flags & ELF_PROG_FLAG_READ) perm |= PROT_R;
+  8027c9:	44 89 e2             	mov    %r12d,%edx
+  8027cc:	83 ca 04             	or     $0x4,%edx
+  8027cf:	a8 04                	test   $0x4,%al
+  8027d1:	44 0f 45 e2          	cmovne %edx,%r12d
+        if (ph->p_flags & ELF_PROG_FLAG_EXEC) perm |= PROT_X;
+  8027d5:	44 89 e2             	mov    %r12d,%edx
+  8027d8:	83 ca 01             	or     $0x1,%edx
+  8027db:	a8 01                	test   $0x1,%al
+  8027dd:	44 0f 45 e2          	cmovne %edx,%r12d
+        if ((res = map_segment(child, ph->p_va, ph->p_memsz,
+  8027e1:	49 8b 45 08          	mov    0x8(%r13),%rax
+  8027e5:	89 85 e0 fc ff ff    	mov    %eax,-0x320(%rbp)
+  8027eb:	49 8b 5d 20          	mov    0x20(%r13),%rbx
+  8027ef:	48 89 9d d8 fc ff ff 	mov    %rbx,-0x328(%rbp)
+  8027f6:	4d 8b 7d 28          	mov    0x28(%r13),%r15
+  8027fa:	49 8b 75 10          	mov    0x10(%r13),%rsi
+  8027fe:	48 89 b5 f0 fc ff ff 	mov    %rsi,-0x310(%rbp)
+  802805:	8b 8d cc fd ff ff    	mov    -0x234(%rbp),%ecx
+  80280b:	89 8d e8 fc ff ff    	mov    %ecx,-0x318(%rbp)
+    if (res) {
+  802811:	89 f2                	mov    %esi,%edx
+  802813:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  802819:	74 22                	je     80283d <spawn+0x518>
+        va -= res;
+  80281b:	48 63 ca             	movslq %edx,%rcx
+  80281e:	48 29 ce             	sub    %rcx,%rsi
+  802821:	48 89 b5 f0 fc ff ff 	mov    %rsi,-0x310(%rbp)
+        memsz += res;
+  802828:	49 01 cf             	add    %rcx,%r15
+        filesz += res;
+  80282b:	48 01 cb             	add    %rcx,%rbx
+  80282e:	48 89 9d d8 fc ff ff 	mov    %rbx,-0x328(%rbp)
+        fileoffset -= res;
+  802835:	29 d0                	sub    %edx,%eax
+  802837:	89 85 e0 fc ff ff    	mov    %eax,-0x320(%rbp)
+    res = region_queue_op(REGION_ALLOC, 0, NULL, 0, UTEMP, memsz, PROT_RW | PROT_X | ALLOC_ZERO);
+  80283d:	48 83 ec 08          	sub    $0x8,%rsp
+  802841:	68 07 00 10 00       	push   $0x100007
+  802846:	4d 89 f9             	mov    %r15,%r9
+  802849:	41 b8 00 00 40 00    	mov    $0x400000,%r8d
+  80284f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802854:	ba 00 00 00 00       	mov    $0x0,%edx
+  802859:	be 00 00 00 00       	mov    $0x0,%esi
+  80285e:	bf 00 00 00 00       	mov    $0x0,%edi
+  802863:	48 b8 1f 22 80 00 00 	movabs $0x80221f,%rax
+  80286a:	00 00 00 
+  80286d:	ff d0                	call   *%rax
+  80286f:	89 c3                	mov    %eax,%ebx
+    if (res < 0 || (res = region_flush()) < 0) {
+  802871:	48 83 c4 10          	add    $0x10,%rsp
+  802875:	85 c0                	test   %eax,%eax
+  802877:	0f 88 b0 01 00 00    	js     802a2d <spawn+0x708>
+  80287d:	48 b9 72 21 80 00 00 	movabs $0x802172,%rcx
+  802884:	00 00 00 
+  802887:	ff d1                	call   *%rcx
+  802889:	89 c3                	mov    %eax,%ebx
+  80288b:	85 c0                	test   %eax,%eax
+  80288d:	0f 88 9a 01 00 00    	js     802a2d <spawn+0x708>
+    res = seek(fd, fileoffset);
+  802893:	8b b5 e0 fc ff ff    	mov    -0x320(%rbp),%esi
+  802899:	8b bd fc fc ff ff    	mov    -0x304(%rbp),%edi
+  80289f:	48 b9 62 1b 80 00 00 	movabs $0x801b62,%rcx
+  8028a6:	00 00 00 
+  8028a9:	ff d1                	call   *%rcx
+  8028ab:	89 c3                	mov    %eax,%ebx
+    if (res < 0) {
+  8028ad:	85 c0                	test   %eax,%eax
+  8028af:	78 28                	js     8028d9 <spawn+0x5b4>
+    res = readn(fd, UTEMP, filesz);
+  8028b1:	48 8b 95 d8 fc ff ff 	mov    -0x328(%rbp),%rdx
+  8028b8:	be 00 00 40 00       	mov    $0x400000,%esi
+  8028bd:	8b bd fc fc ff ff    	mov    -0x304(%rbp),%edi
+  8028c3:	48 b9 38 1a 80 00 00 	movabs $0x801a38,%rcx
+  8028ca:	00 00 00 
+  8028cd:	ff d1                	call   *%rcx
+  8028cf:	89 c3                	mov    %eax,%ebx
+    if (res < 0) {
+  8028d1:	85 c0                	test   %eax,%eax
+  8028d3:	0f 89 5f fe ff ff    	jns    802738 <spawn+0x413>
+    region_queue_op(REGION_UNMAP, 0, NULL, 0, UTEMP, memsz, 0);
+  8028d9:	48 83 ec 08          	sub    $0x8,%rsp
+  8028dd:	6a 00                	push   $0x0
+  8028df:	4d 89 f9             	mov    %r15,%r9
+  8028e2:	41 b8 00 00 40 00    	mov    $0x400000,%r8d
+  8028e8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8028ed:	ba 00 00 00 00       	mov    $0x0,%edx
+  8028f2:	be 00 00 00 00       	mov    $0x0,%esi
+  8028f7:	bf 02 00 00 00       	mov    $0x2,%edi
+  8028fc:	48 b8 1f 22 80 00 00 	movabs $0x80221f,%rax
+  802903:	00 00 00 
+  802906:	ff d0                	call   *%rax
+  802908:	48 83 c4 10          	add    $0x10,%rsp
+  80290c:	e9 1c 01 00 00       	jmp    802a2d <spawn+0x708>
+    close(fd);
+  802911:	8b bd fc fc ff ff    	mov    -0x304(%rbp),%edi
+  802917:	48 b8 fc 17 80 00 00 	movabs $0x8017fc,%rax
+  80291e:	00 00 00 
+  802921:	ff d0                	call   *%rax
+    if ((res = foreach_shared_region(copy_shared_region, &child)) < 0 ||
+  802923:	48 8d b5 cc fd ff ff 	lea    -0x234(%rbp),%rsi
+  80292a:	48 bf ce 22 80 00 00 	movabs $0x8022ce,%rdi
+  802931:	00 00 00 
+  802934:	48 b8 91 31 80 00 00 	movabs $0x803191,%rax
+  80293b:	00 00 00 
+  80293e:	ff d0                	call   *%rax
+  802940:	85 c0                	test   %eax,%eax
+  802942:	78 59                	js     80299d <spawn+0x678>
+        (res = region_flush()) < 0)
+  802944:	48 b8 72 21 80 00 00 	movabs $0x802172,%rax
+  80294b:	00 00 00 
+  80294e:	ff d0                	call   *%rax
+    if ((res = foreach_shared_region(copy_shared_region, &child)) < 0 ||
+  802950:	85 c0                	test   %eax,%eax
+  802952:	78 49                	js     80299d <spawn+0x678>
+    if ((res = sys_env_set_trapframe(child, &child_tf)) < 0)
+  802954:	48 8d b5 0c fd ff ff 	lea    -0x2f4(%rbp),%rsi
+  80295b:	8b bd cc fd ff ff    	mov    -0x234(%rbp),%edi
+  802961:	48 b8 6f 14 80 00 00 	movabs $0x80146f,%rax
+  802968:	00 00 00 
+  80296b:	ff d0                	call   *%rax
+  80296d:	85 c0                	test   %eax,%eax
+  80296f:	78 59                	js     8029ca <spawn+0x6a5>
+    if ((res = sys_env_set_status(child, ENV_RUNNABLE)) < 0)
+  802971:	be 02 00 00 00       	mov    $0x2,%esi
+  802976:	8b bd cc fd ff ff    	mov    -0x234(%rbp),%edi
+  80297c:	48 b8 37 13 80 00 00 	movabs $0x801337,%rax
+  802983:	00 00 00 
+  802986:	ff d0                	call   *%rax
+  802988:	85 c0                	test   %eax,%eax
+  80298a:	78 6b                	js     8029f7 <spawn+0x6d2>
+    return child;
+  80298c:	8b 85 cc fd ff ff    	mov    -0x234(%rbp),%eax
+  802992:	89 85 fc fc ff ff    	mov    %eax,-0x304(%rbp)
+  802998:	e9 c6 00 00 00       	jmp    802a63 <spawn+0x73e>
+        panic("copy_shared_region: %i", res);
+  80299d:	89 c1                	mov    %eax,%ecx
+  80299f:	48 ba 3b 3e 80 00 00 	movabs $0x803e3b,%rdx
+  8029a6:	00 00 00 
+  8029a9:	be a8 00 00 00       	mov    $0xa8,%esi
+  8029ae:	48 bf 2f 3e 80 00 00 	movabs $0x803e2f,%rdi
+  8029b5:	00 00 00 
+  8029b8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029bd:	49 b8 76 01 80 00 00 	movabs $0x800176,%r8
+  8029c4:	00 00 00 
+  8029c7:	41 ff d0             	call   *%r8
+        panic("sys_env_set_trapframe: %i", res);
+  8029ca:	89 c1                	mov    %eax,%ecx
+  8029cc:	48 ba 52 3e 80 00 00 	movabs $0x803e52,%rdx
+  8029d3:	00 00 00 
+  8029d6:	be ab 00 00 00       	mov    $0xab,%esi
+  8029db:	48 bf 2f 3e 80 00 00 	movabs $0x803e2f,%rdi
+  8029e2:	00 00 00 
+  8029e5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029ea:	49 b8 76 01 80 00 00 	movabs $0x800176,%r8
+  8029f1:	00 00 00 
+  8029f4:	41 ff d0             	call   *%r8
+        panic("sys_env_set_status: %i", res);
+  8029f7:	89 c1                	mov    %eax,%ecx
+  8029f9:	48 ba 6c 3e 80 00 00 	movabs $0x803e6c,%rdx
+  802a00:	00 00 00 
+  802a03:	be ae 00 00 00       	mov    $0xae,%esi
+  802a08:	48 bf 2f 3e 80 00 00 	movabs $0x803e2f,%rdi
+  802a0f:	00 00 00 
+  802a12:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a17:	49 b8 76 01 80 00 00 	movabs $0x800176,%r8
+  802a1e:	00 00 00 
+  802a21:	41 ff d0             	call   *%r8
+    if ((void *)(argv_store - 2) < (void *)UTEMP) return -E_NO_MEM;
+  802a24:	41 bd fc ff ff ff    	mov    $0xfffffffc,%r13d
+    for (size_t i = 0; i < elf->e_phnum; i++, ph++) {
+  802a2a:	44 89 eb             	mov    %r13d,%ebx
+    region_flush();
+  802a2d:	48 b8 72 21 80 00 00 	movabs $0x802172,%rax
+  802a34:	00 00 00 
+  802a37:	ff d0                	call   *%rax
+    sys_env_destroy(child);
+  802a39:	8b bd cc fd ff ff    	mov    -0x234(%rbp),%edi
+  802a3f:	48 b8 70 10 80 00 00 	movabs $0x801070,%rax
+  802a46:	00 00 00 
+  802a49:	ff d0                	call   *%rax
+    close(fd);
+  802a4b:	8b bd fc fc ff ff    	mov    -0x304(%rbp),%edi
+  802a51:	48 b8 fc 17 80 00 00 	movabs $0x8017fc,%rax
+  802a58:	00 00 00 
+  802a5b:	ff d0                	call   *%rax
+    return res;
+  802a5d:	89 9d fc fc ff ff    	mov    %ebx,-0x304(%rbp)
+}
+  802a63:	8b 85 fc fc ff ff    	mov    -0x304(%rbp),%eax
+  802a69:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  802a6d:	5b                   	pop    %rbx
+  802a6e:	41 5c                	pop    %r12
+  802a70:	41 5d                	pop    %r13
+  802a72:	41 5e                	pop    %r14
+  802a74:	41 5f                	pop    %r15
+  802a76:	5d                   	pop    %rbp
+  802a77:	c3                   	ret
+
+0000000000802a78 <spawnl>:
+spawnl(const char *prog, const char *arg0, ...) {
+  802a78:	55                   	push   %rbp
+  802a79:	48 89 e5             	mov    %rsp,%rbp
+  802a7c:	48 83 ec 50          	sub    $0x50,%rsp
+  802a80:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  802a84:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  802a88:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  802a8c:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(vl, arg0);
+  802a90:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  802a97:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802a9b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802a9f:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  802aa3:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int argc = 0;
+  802aa7:	b9 00 00 00 00       	mov    $0x0,%ecx
+    while (va_arg(vl, void *) != NULL) argc++;
+  802aac:	eb 15                	jmp    802ac3 <spawnl+0x4b>
+  802aae:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802ab2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802ab6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802aba:	48 83 3a 00          	cmpq   $0x0,(%rdx)
+  802abe:	74 1c                	je     802adc <spawnl+0x64>
+  802ac0:	83 c1 01             	add    $0x1,%ecx
+  802ac3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802ac6:	83 f8 2f             	cmp    $0x2f,%eax
+  802ac9:	77 e3                	ja     802aae <spawnl+0x36>
+  802acb:	89 c2                	mov    %eax,%edx
+  802acd:	4c 8d 55 d0          	lea    -0x30(%rbp),%r10
+  802ad1:	4c 01 d2             	add    %r10,%rdx
+  802ad4:	83 c0 08             	add    $0x8,%eax
+  802ad7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802ada:	eb de                	jmp    802aba <spawnl+0x42>
+    const char *argv[argc + 2];
+  802adc:	8d 41 02             	lea    0x2(%rcx),%eax
+  802adf:	48 98                	cltq
+  802ae1:	48 8d 04 c5 0f 00 00 	lea    0xf(,%rax,8),%rax
+  802ae8:	00 
+  802ae9:	48 83 e0 f0          	and    $0xfffffffffffffff0,%rax
+  802aed:	48 29 c4             	sub    %rax,%rsp
+  802af0:	4c 8d 44 24 07       	lea    0x7(%rsp),%r8
+  802af5:	4c 89 c0             	mov    %r8,%rax
+  802af8:	48 c1 e8 03          	shr    $0x3,%rax
+  802afc:	49 83 e0 f8          	and    $0xfffffffffffffff8,%r8
+    argv[0] = arg0;
+  802b00:	48 89 34 c5 00 00 00 	mov    %rsi,0x0(,%rax,8)
+  802b07:	00 
+    argv[argc + 1] = NULL;
+  802b08:	8d 41 01             	lea    0x1(%rcx),%eax
+  802b0b:	48 98                	cltq
+  802b0d:	49 c7 04 c0 00 00 00 	movq   $0x0,(%r8,%rax,8)
+  802b14:	00 
+    va_start(vl, arg0);
+  802b15:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  802b1c:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802b20:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802b24:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  802b28:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    for (i = 0; i < argc; i++) {
+  802b2c:	85 c9                	test   %ecx,%ecx
+  802b2e:	74 41                	je     802b71 <spawnl+0xf9>
+        argv[i + 1] = va_arg(vl, const char *);
+  802b30:	49 89 c1             	mov    %rax,%r9
+  802b33:	49 8d 40 08          	lea    0x8(%r8),%rax
+  802b37:	8d 51 ff             	lea    -0x1(%rcx),%edx
+  802b3a:	49 8d 74 d0 10       	lea    0x10(%r8,%rdx,8),%rsi
+  802b3f:	eb 1b                	jmp    802b5c <spawnl+0xe4>
+  802b41:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  802b45:	48 8d 51 08          	lea    0x8(%rcx),%rdx
+  802b49:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  802b4d:	48 8b 11             	mov    (%rcx),%rdx
+  802b50:	48 89 10             	mov    %rdx,(%rax)
+    for (i = 0; i < argc; i++) {
+  802b53:	48 83 c0 08          	add    $0x8,%rax
+  802b57:	48 39 f0             	cmp    %rsi,%rax
+  802b5a:	74 15                	je     802b71 <spawnl+0xf9>
+        argv[i + 1] = va_arg(vl, const char *);
+  802b5c:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  802b5f:	83 fa 2f             	cmp    $0x2f,%edx
+  802b62:	77 dd                	ja     802b41 <spawnl+0xc9>
+  802b64:	89 d1                	mov    %edx,%ecx
+  802b66:	4c 01 c9             	add    %r9,%rcx
+  802b69:	83 c2 08             	add    $0x8,%edx
+  802b6c:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  802b6f:	eb dc                	jmp    802b4d <spawnl+0xd5>
+    return spawn(prog, argv);
+  802b71:	4c 89 c6             	mov    %r8,%rsi
+  802b74:	48 b8 25 23 80 00 00 	movabs $0x802325,%rax
+  802b7b:	00 00 00 
+  802b7e:	ff d0                	call   *%rax
+}
+  802b80:	c9                   	leave
+  802b81:	c3                   	ret
+
+0000000000802b82 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  802b82:	55                   	push   %rbp
+  802b83:	48 89 e5             	mov    %rsp,%rbp
+  802b86:	41 54                	push   %r12
+  802b88:	53                   	push   %rbx
+  802b89:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802b8c:	48 b8 e8 15 80 00 00 	movabs $0x8015e8,%rax
+  802b93:	00 00 00 
+  802b96:	ff d0                	call   *%rax
+  802b98:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  802b9b:	48 be 83 3e 80 00 00 	movabs $0x803e83,%rsi
+  802ba2:	00 00 00 
+  802ba5:	48 89 df             	mov    %rbx,%rdi
+  802ba8:	48 b8 eb 0b 80 00 00 	movabs $0x800beb,%rax
+  802baf:	00 00 00 
+  802bb2:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  802bb4:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  802bb9:	41 2b 04 24          	sub    (%r12),%eax
+  802bbd:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  802bc3:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  802bca:	00 00 00 
+    stat->st_dev = &devpipe;
+  802bcd:	48 b8 60 40 80 00 00 	movabs $0x804060,%rax
+  802bd4:	00 00 00 
+  802bd7:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  802bde:	b8 00 00 00 00       	mov    $0x0,%eax
+  802be3:	5b                   	pop    %rbx
+  802be4:	41 5c                	pop    %r12
+  802be6:	5d                   	pop    %rbp
+  802be7:	c3                   	ret
+
+0000000000802be8 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  802be8:	55                   	push   %rbp
+  802be9:	48 89 e5             	mov    %rsp,%rbp
+  802bec:	41 54                	push   %r12
+  802bee:	53                   	push   %rbx
+  802bef:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  802bf2:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802bf7:	48 89 fe             	mov    %rdi,%rsi
+  802bfa:	bf 00 00 00 00       	mov    $0x0,%edi
+  802bff:	49 bc 67 12 80 00 00 	movabs $0x801267,%r12
+  802c06:	00 00 00 
+  802c09:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  802c0c:	48 89 df             	mov    %rbx,%rdi
+  802c0f:	48 b8 e8 15 80 00 00 	movabs $0x8015e8,%rax
+  802c16:	00 00 00 
+  802c19:	ff d0                	call   *%rax
+  802c1b:	48 89 c6             	mov    %rax,%rsi
+  802c1e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802c23:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c28:	41 ff d4             	call   *%r12
+}
+  802c2b:	5b                   	pop    %rbx
+  802c2c:	41 5c                	pop    %r12
+  802c2e:	5d                   	pop    %rbp
+  802c2f:	c3                   	ret
+
+0000000000802c30 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  802c30:	55                   	push   %rbp
+  802c31:	48 89 e5             	mov    %rsp,%rbp
+  802c34:	41 57                	push   %r15
+  802c36:	41 56                	push   %r14
+  802c38:	41 55                	push   %r13
+  802c3a:	41 54                	push   %r12
+  802c3c:	53                   	push   %rbx
+  802c3d:	48 83 ec 18          	sub    $0x18,%rsp
+  802c41:	49 89 fc             	mov    %rdi,%r12
+  802c44:	49 89 f5             	mov    %rsi,%r13
+  802c47:	49 89 d7             	mov    %rdx,%r15
+  802c4a:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802c4e:	48 b8 e8 15 80 00 00 	movabs $0x8015e8,%rax
+  802c55:	00 00 00 
+  802c58:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  802c5a:	4d 85 ff             	test   %r15,%r15
+  802c5d:	0f 84 af 00 00 00    	je     802d12 <devpipe_write+0xe2>
+  802c63:	48 89 c3             	mov    %rax,%rbx
+  802c66:	4c 89 f8             	mov    %r15,%rax
+  802c69:	4d 89 ef             	mov    %r13,%r15
+  802c6c:	4c 01 e8             	add    %r13,%rax
+  802c6f:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802c73:	49 bd 6f 11 80 00 00 	movabs $0x80116f,%r13
+  802c7a:	00 00 00 
+            sys_yield();
+  802c7d:	49 be 0c 11 80 00 00 	movabs $0x80110c,%r14
+  802c84:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  802c87:	8b 73 04             	mov    0x4(%rbx),%esi
+  802c8a:	48 63 ce             	movslq %esi,%rcx
+  802c8d:	48 63 03             	movslq (%rbx),%rax
+  802c90:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  802c96:	48 39 c1             	cmp    %rax,%rcx
+  802c99:	72 2e                	jb     802cc9 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802c9b:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802ca0:	48 89 da             	mov    %rbx,%rdx
+  802ca3:	be 00 10 00 00       	mov    $0x1000,%esi
+  802ca8:	4c 89 e7             	mov    %r12,%rdi
+  802cab:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  802cae:	85 c0                	test   %eax,%eax
+  802cb0:	74 66                	je     802d18 <devpipe_write+0xe8>
+            sys_yield();
+  802cb2:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  802cb5:	8b 73 04             	mov    0x4(%rbx),%esi
+  802cb8:	48 63 ce             	movslq %esi,%rcx
+  802cbb:	48 63 03             	movslq (%rbx),%rax
+  802cbe:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  802cc4:	48 39 c1             	cmp    %rax,%rcx
+  802cc7:	73 d2                	jae    802c9b <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  802cc9:	41 0f b6 3f          	movzbl (%r15),%edi
+  802ccd:	48 89 ca             	mov    %rcx,%rdx
+  802cd0:	48 c1 ea 03          	shr    $0x3,%rdx
+  802cd4:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  802cdb:	08 10 20 
+  802cde:	48 f7 e2             	mul    %rdx
+  802ce1:	48 c1 ea 06          	shr    $0x6,%rdx
+  802ce5:	48 89 d0             	mov    %rdx,%rax
+  802ce8:	48 c1 e0 09          	shl    $0x9,%rax
+  802cec:	48 29 d0             	sub    %rdx,%rax
+  802cef:	48 c1 e0 03          	shl    $0x3,%rax
+  802cf3:	48 29 c1             	sub    %rax,%rcx
+  802cf6:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  802cfb:	83 c6 01             	add    $0x1,%esi
+  802cfe:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  802d01:	49 83 c7 01          	add    $0x1,%r15
+  802d05:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802d09:	49 39 c7             	cmp    %rax,%r15
+  802d0c:	0f 85 75 ff ff ff    	jne    802c87 <devpipe_write+0x57>
+    return n;
+  802d12:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802d16:	eb 05                	jmp    802d1d <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  802d18:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802d1d:	48 83 c4 18          	add    $0x18,%rsp
+  802d21:	5b                   	pop    %rbx
+  802d22:	41 5c                	pop    %r12
+  802d24:	41 5d                	pop    %r13
+  802d26:	41 5e                	pop    %r14
+  802d28:	41 5f                	pop    %r15
+  802d2a:	5d                   	pop    %rbp
+  802d2b:	c3                   	ret
+
+0000000000802d2c <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  802d2c:	55                   	push   %rbp
+  802d2d:	48 89 e5             	mov    %rsp,%rbp
+  802d30:	41 57                	push   %r15
+  802d32:	41 56                	push   %r14
+  802d34:	41 55                	push   %r13
+  802d36:	41 54                	push   %r12
+  802d38:	53                   	push   %rbx
+  802d39:	48 83 ec 18          	sub    $0x18,%rsp
+  802d3d:	49 89 fc             	mov    %rdi,%r12
+  802d40:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  802d44:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802d48:	48 b8 e8 15 80 00 00 	movabs $0x8015e8,%rax
+  802d4f:	00 00 00 
+  802d52:	ff d0                	call   *%rax
+  802d54:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  802d57:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802d5d:	49 bd 6f 11 80 00 00 	movabs $0x80116f,%r13
+  802d64:	00 00 00 
+            sys_yield();
+  802d67:	49 be 0c 11 80 00 00 	movabs $0x80110c,%r14
+  802d6e:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  802d71:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  802d76:	74 7d                	je     802df5 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  802d78:	8b 03                	mov    (%rbx),%eax
+  802d7a:	3b 43 04             	cmp    0x4(%rbx),%eax
+  802d7d:	75 26                	jne    802da5 <devpipe_read+0x79>
+            if (i > 0) return i;
+  802d7f:	4d 85 ff             	test   %r15,%r15
+  802d82:	75 77                	jne    802dfb <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802d84:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802d89:	48 89 da             	mov    %rbx,%rdx
+  802d8c:	be 00 10 00 00       	mov    $0x1000,%esi
+  802d91:	4c 89 e7             	mov    %r12,%rdi
+  802d94:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  802d97:	85 c0                	test   %eax,%eax
+  802d99:	74 72                	je     802e0d <devpipe_read+0xe1>
+            sys_yield();
+  802d9b:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  802d9e:	8b 03                	mov    (%rbx),%eax
+  802da0:	3b 43 04             	cmp    0x4(%rbx),%eax
+  802da3:	74 df                	je     802d84 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802da5:	48 63 c8             	movslq %eax,%rcx
+  802da8:	48 89 ca             	mov    %rcx,%rdx
+  802dab:	48 c1 ea 03          	shr    $0x3,%rdx
+  802daf:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  802db6:	08 10 20 
+  802db9:	48 89 d0             	mov    %rdx,%rax
+  802dbc:	48 f7 e6             	mul    %rsi
+  802dbf:	48 c1 ea 06          	shr    $0x6,%rdx
+  802dc3:	48 89 d0             	mov    %rdx,%rax
+  802dc6:	48 c1 e0 09          	shl    $0x9,%rax
+  802dca:	48 29 d0             	sub    %rdx,%rax
+  802dcd:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  802dd4:	00 
+  802dd5:	48 89 c8             	mov    %rcx,%rax
+  802dd8:	48 29 d0             	sub    %rdx,%rax
+  802ddb:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  802de0:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  802de4:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  802de8:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  802deb:	49 83 c7 01          	add    $0x1,%r15
+  802def:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  802df3:	75 83                	jne    802d78 <devpipe_read+0x4c>
+    return n;
+  802df5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802df9:	eb 03                	jmp    802dfe <devpipe_read+0xd2>
+            if (i > 0) return i;
+  802dfb:	4c 89 f8             	mov    %r15,%rax
+}
+  802dfe:	48 83 c4 18          	add    $0x18,%rsp
+  802e02:	5b                   	pop    %rbx
+  802e03:	41 5c                	pop    %r12
+  802e05:	41 5d                	pop    %r13
+  802e07:	41 5e                	pop    %r14
+  802e09:	41 5f                	pop    %r15
+  802e0b:	5d                   	pop    %rbp
+  802e0c:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  802e0d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e12:	eb ea                	jmp    802dfe <devpipe_read+0xd2>
+
+0000000000802e14 <pipe>:
+pipe(int pfd[2]) {
+  802e14:	55                   	push   %rbp
+  802e15:	48 89 e5             	mov    %rsp,%rbp
+  802e18:	41 55                	push   %r13
+  802e1a:	41 54                	push   %r12
+  802e1c:	53                   	push   %rbx
+  802e1d:	48 81 ec b8 00 00 00 	sub    $0xb8,%rsp
+  802e24:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  802e27:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802e2b:	48 b8 7d 16 80 00 00 	movabs $0x80167d,%rax
+  802e32:	00 00 00 
+  802e35:	ff d0                	call   *%rax
+  802e37:	89 c3                	mov    %eax,%ebx
+  802e39:	85 c0                	test   %eax,%eax
+  802e3b:	0f 88 51 01 00 00    	js     802f92 <pipe+0x17e>
+        (res = fd_alloc_from(fd2num(fd0) + 1, &fd1)) < 0) goto err;
+  802e41:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802e45:	48 b8 d6 15 80 00 00 	movabs $0x8015d6,%rax
+  802e4c:	00 00 00 
+  802e4f:	ff d0                	call   *%rax
+  802e51:	8d 78 01             	lea    0x1(%rax),%edi
+  802e54:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802e58:	48 b8 04 16 80 00 00 	movabs $0x801604,%rax
+  802e5f:	00 00 00 
+  802e62:	ff d0                	call   *%rax
+  802e64:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  802e66:	85 c0                	test   %eax,%eax
+  802e68:	0f 88 24 01 00 00    	js     802f92 <pipe+0x17e>
+    va = fd2data(fd0);
+  802e6e:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802e72:	48 bb e8 15 80 00 00 	movabs $0x8015e8,%rbx
+  802e79:	00 00 00 
+  802e7c:	ff d3                	call   *%rbx
+  802e7e:	49 89 c5             	mov    %rax,%r13
+    struct RegionOp ops[] = {
+  802e81:	48 8d bd 30 ff ff ff 	lea    -0xd0(%rbp),%rdi
+  802e88:	b9 14 00 00 00       	mov    $0x14,%ecx
+  802e8d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e92:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+  802e95:	c7 85 34 ff ff ff 46 	movl   $0x46,-0xcc(%rbp)
+  802e9c:	00 00 00 
+  802e9f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802ea3:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+  802eaa:	48 c7 85 50 ff ff ff 	movq   $0x1000,-0xb0(%rbp)
+  802eb1:	00 10 00 00 
+  802eb5:	c7 85 5c ff ff ff 46 	movl   $0x46,-0xa4(%rbp)
+  802ebc:	00 00 00 
+            {.type = REGION_ALLOC, .dstva = (uintptr_t)fd1, .size = PAGE_SIZE, .perm = PROT_RW | PROT_SHARE},
+  802ebf:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+    struct RegionOp ops[] = {
+  802ec3:	48 89 bd 70 ff ff ff 	mov    %rdi,-0x90(%rbp)
+  802eca:	48 c7 85 78 ff ff ff 	movq   $0x1000,-0x88(%rbp)
+  802ed1:	00 10 00 00 
+  802ed5:	c7 45 84 46 00 00 00 	movl   $0x46,-0x7c(%rbp)
+  802edc:	4c 89 6d 98          	mov    %r13,-0x68(%rbp)
+  802ee0:	48 c7 45 a0 00 10 00 	movq   $0x1000,-0x60(%rbp)
+  802ee7:	00 
+  802ee8:	c7 45 a8 01 00 00 00 	movl   $0x1,-0x58(%rbp)
+  802eef:	c7 45 ac 46 00 00 00 	movl   $0x46,-0x54(%rbp)
+  802ef6:	4c 89 6d b8          	mov    %r13,-0x48(%rbp)
+            {.type = REGION_MAP, .srcva = (uintptr_t)va, .dstva = (uintptr_t)fd2data(fd1), .size = PAGE_SIZE, .perm = PROT_RW | PROT_SHARE},
+  802efa:	ff d3                	call   *%rbx
+    struct RegionOp ops[] = {
+  802efc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802f00:	48 c7 45 c8 00 10 00 	movq   $0x1000,-0x38(%rbp)
+  802f07:	00 
+    if ((res = sys_region_batch(ops, sizeof ops / sizeof *ops)) < 0) goto err1;
+  802f08:	be 04 00 00 00       	mov    $0x4,%esi
+  802f0d:	48 8d bd 30 ff ff ff 	lea    -0xd0(%rbp),%rdi
+  802f14:	48 b8 ce 12 80 00 00 	movabs $0x8012ce,%rax
+  802f1b:	00 00 00 
+  802f1e:	ff d0                	call   *%rax
+  802f20:	89 c3                	mov    %eax,%ebx
+  802f22:	85 c0                	test   %eax,%eax
+  802f24:	0f 88 ad 00 00 00    	js     802fd7 <pipe+0x1c3>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  802f2a:	be 00 10 00 00       	mov    $0x1000,%esi
+  802f2f:	4c 89 ef             	mov    %r13,%rdi
+  802f32:	48 b8 3d 11 80 00 00 	movabs $0x80113d,%rax
+  802f39:	00 00 00 
+  802f3c:	ff d0                	call   *%rax
+  802f3e:	83 f8 02             	cmp    $0x2,%eax
+  802f41:	75 5f                	jne    802fa2 <pipe+0x18e>
+    fd0->fd_dev_id = devpipe.dev_id;
+  802f43:	a1 60 40 80 00 00 00 	movabs 0x804060,%eax
+  802f4a:	00 00 
+  802f4c:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802f50:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  802f52:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802f56:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  802f5d:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  802f61:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  802f63:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802f67:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  802f6e:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802f72:	48 bb d6 15 80 00 00 	movabs $0x8015d6,%rbx
+  802f79:	00 00 00 
+  802f7c:	ff d3                	call   *%rbx
+  802f7e:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  802f82:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  802f86:	ff d3                	call   *%rbx
+  802f88:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  802f8d:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  802f92:	89 d8                	mov    %ebx,%eax
+  802f94:	48 81 c4 b8 00 00 00 	add    $0xb8,%rsp
+  802f9b:	5b                   	pop    %rbx
+  802f9c:	41 5c                	pop    %r12
+  802f9e:	41 5d                	pop    %r13
+  802fa0:	5d                   	pop    %rbp
+  802fa1:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  802fa2:	48 b9 a0 3e 80 00 00 	movabs $0x803ea0,%rcx
+  802fa9:	00 00 00 
+  802fac:	48 ba 1a 3e 80 00 00 	movabs $0x803e1a,%rdx
+  802fb3:	00 00 00 
+  802fb6:	be 33 00 00 00       	mov    $0x33,%esi
+  802fbb:	48 bf 8a 3e 80 00 00 	movabs $0x803e8a,%rdi
+  802fc2:	00 00 00 
+  802fc5:	b8 00 00 00 00       	mov    $0x0,%eax
+  802fca:	49 b8 76 01 80 00 00 	movabs $0x800176,%r8
+  802fd1:	00 00 00 
+  802fd4:	41 ff d0             	call   *%r8
+        ops[i].type = REGION_UNMAP;
+  802fd7:	c7 85 30 ff ff ff 02 	movl   $0x2,-0xd0(%rbp)
+  802fde:	00 00 00 
+  802fe1:	c7 85 58 ff ff ff 02 	movl   $0x2,-0xa8(%rbp)
+  802fe8:	00 00 00 
+  802feb:	c7 45 80 02 00 00 00 	movl   $0x2,-0x80(%rbp)
+  802ff2:	c7 45 a8 02 00 00 00 	movl   $0x2,-0x58(%rbp)
+    sys_region_batch(ops, sizeof ops / sizeof *ops);
+  802ff9:	be 04 00 00 00       	mov    $0x4,%esi
+  802ffe:	48 8d bd 30 ff ff ff 	lea    -0xd0(%rbp),%rdi
+  803005:	48 b8 ce 12 80 00 00 	movabs $0x8012ce,%rax
+  80300c:	00 00 00 
+  80300f:	ff d0                	call   *%rax
+  803011:	e9 7c ff ff ff       	jmp    802f92 <pipe+0x17e>
+
+0000000000803016 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  803016:	55                   	push   %rbp
+  803017:	48 89 e5             	mov    %rsp,%rbp
+  80301a:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  80301e:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803022:	48 b8 97 16 80 00 00 	movabs $0x801697,%rax
+  803029:	00 00 00 
+  80302c:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80302e:	85 c0                	test   %eax,%eax
+  803030:	78 35                	js     803067 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  803032:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803036:	48 b8 e8 15 80 00 00 	movabs $0x8015e8,%rax
+  80303d:	00 00 00 
+  803040:	ff d0                	call   *%rax
+  803042:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803045:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80304a:	be 00 10 00 00       	mov    $0x1000,%esi
+  80304f:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803053:	48 b8 6f 11 80 00 00 	movabs $0x80116f,%rax
+  80305a:	00 00 00 
+  80305d:	ff d0                	call   *%rax
+  80305f:	85 c0                	test   %eax,%eax
+  803061:	0f 94 c0             	sete   %al
+  803064:	0f b6 c0             	movzbl %al,%eax
+}
+  803067:	c9                   	leave
+  803068:	c3                   	ret
+
+0000000000803069 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803069:	48 89 f8             	mov    %rdi,%rax
+  80306c:	48 c1 e8 27          	shr    $0x27,%rax
+  803070:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  803077:	01 00 00 
+  80307a:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80307e:	f6 c2 01             	test   $0x1,%dl
+  803081:	74 6d                	je     8030f0 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803083:	48 89 f8             	mov    %rdi,%rax
+  803086:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80308a:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  803091:	01 00 00 
+  803094:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803098:	f6 c2 01             	test   $0x1,%dl
+  80309b:	74 62                	je     8030ff <get_uvpt_entry+0x96>
+  80309d:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8030a4:	01 00 00 
+  8030a7:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8030ab:	f6 c2 80             	test   $0x80,%dl
+  8030ae:	75 4f                	jne    8030ff <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8030b0:	48 89 f8             	mov    %rdi,%rax
+  8030b3:	48 c1 e8 15          	shr    $0x15,%rax
+  8030b7:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8030be:	01 00 00 
+  8030c1:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8030c5:	f6 c2 01             	test   $0x1,%dl
+  8030c8:	74 44                	je     80310e <get_uvpt_entry+0xa5>
+  8030ca:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8030d1:	01 00 00 
+  8030d4:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8030d8:	f6 c2 80             	test   $0x80,%dl
+  8030db:	75 31                	jne    80310e <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  8030dd:	48 c1 ef 0c          	shr    $0xc,%rdi
+  8030e1:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8030e8:	01 00 00 
+  8030eb:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  8030ef:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8030f0:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  8030f7:	01 00 00 
+  8030fa:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8030fe:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8030ff:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  803106:	01 00 00 
+  803109:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80310d:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  80310e:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  803115:	01 00 00 
+  803118:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80311c:	c3                   	ret
+
+000000000080311d <get_prot>:
+
+int
+get_prot(void *va) {
+  80311d:	55                   	push   %rbp
+  80311e:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803121:	48 b8 69 30 80 00 00 	movabs $0x803069,%rax
+  803128:	00 00 00 
+  80312b:	ff d0                	call   *%rax
+  80312d:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  803130:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  803135:	89 c1                	mov    %eax,%ecx
+  803137:	83 c9 04             	or     $0x4,%ecx
+  80313a:	f6 c2 01             	test   $0x1,%dl
+  80313d:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  803140:	89 c1                	mov    %eax,%ecx
+  803142:	83 c9 02             	or     $0x2,%ecx
+  803145:	f6 c2 02             	test   $0x2,%dl
+  803148:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  80314b:	89 c1                	mov    %eax,%ecx
+  80314d:	83 c9 01             	or     $0x1,%ecx
+  803150:	48 85 d2             	test   %rdx,%rdx
+  803153:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  803156:	89 c1                	mov    %eax,%ecx
+  803158:	83 c9 40             	or     $0x40,%ecx
+  80315b:	f6 c6 04             	test   $0x4,%dh
+  80315e:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  803161:	5d                   	pop    %rbp
+  803162:	c3                   	ret
+
+0000000000803163 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  803163:	55                   	push   %rbp
+  803164:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803167:	48 b8 69 30 80 00 00 	movabs $0x803069,%rax
+  80316e:	00 00 00 
+  803171:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  803173:	48 c1 e8 06          	shr    $0x6,%rax
+  803177:	83 e0 01             	and    $0x1,%eax
+}
+  80317a:	5d                   	pop    %rbp
+  80317b:	c3                   	ret
+
+000000000080317c <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  80317c:	55                   	push   %rbp
+  80317d:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  803180:	48 b8 69 30 80 00 00 	movabs $0x803069,%rax
+  803187:	00 00 00 
+  80318a:	ff d0                	call   *%rax
+  80318c:	83 e0 01             	and    $0x1,%eax
+}
+  80318f:	5d                   	pop    %rbp
+  803190:	c3                   	ret
+
+0000000000803191 <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  803191:	55                   	push   %rbp
+  803192:	48 89 e5             	mov    %rsp,%rbp
+  803195:	41 57                	push   %r15
+  803197:	41 56                	push   %r14
+  803199:	41 55                	push   %r13
+  80319b:	41 54                	push   %r12
+  80319d:	53                   	push   %rbx
+  80319e:	48 83 ec 38          	sub    $0x38,%rsp
+  8031a2:	49 89 f7             	mov    %rsi,%r15
+  8031a5:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+                    }
+                    continue;
+                }
+                for (int ptei = 0; ptei < PT_ENTRY_COUNT; ptei++) {
+                    uintptr_t pte_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, pdei, ptei, 0);
+                    pte_t pte = uvpt[VPT(pte_addr)];
+  8031ab:	49 bd 00 00 00 00 00 	movabs $0x10000000000,%r13
+  8031b2:	01 00 00 
+  8031b5:	4d 89 e6             	mov    %r12,%r14
+  8031b8:	49 89 fc             	mov    %rdi,%r12
+  8031bb:	e9 19 01 00 00       	jmp    8032d9 <foreach_shared_region+0x148>
+  8031c0:	48 89 5d b0          	mov    %rbx,-0x50(%rbp)
+  8031c4:	4c 89 75 a8          	mov    %r14,-0x58(%rbp)
+  8031c8:	eb 52                	jmp    80321c <foreach_shared_region+0x8b>
+                for (int ptei = 0; ptei < PT_ENTRY_COUNT; ptei++) {
+  8031ca:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8031d1:	48 81 fb 00 00 20 00 	cmp    $0x200000,%rbx
+  8031d8:	74 2e                	je     803208 <foreach_shared_region+0x77>
+                    uintptr_t pte_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, pdei, ptei, 0);
+  8031da:	48 89 df             	mov    %rbx,%rdi
+  8031dd:	4c 09 f7             	or     %r14,%rdi
+                    pte_t pte = uvpt[VPT(pte_addr)];
+  8031e0:	48 89 f8             	mov    %rdi,%rax
+  8031e3:	48 c1 e8 0c          	shr    $0xc,%rax
+  8031e7:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+                    if ((pte & PTE_P) && (pte & PTE_SHARE)) {
+  8031ec:	25 01 04 00 00       	and    $0x401,%eax
+  8031f1:	48 3d 01 04 00 00    	cmp    $0x401,%rax
+  8031f7:	75 d1                	jne    8031ca <foreach_shared_region+0x39>
+                        fun((void*)pte_addr, (void*)(pte_addr + PAGE_SIZE), arg);
+  8031f9:	48 8d b7 00 10 00 00 	lea    0x1000(%rdi),%rsi
+  803200:	4c 89 fa             	mov    %r15,%rdx
+  803203:	41 ff d4             	call   *%r12
+  803206:	eb c2                	jmp    8031ca <foreach_shared_region+0x39>
+            for (int pdei = 0; pdei < PD_ENTRY_COUNT; pdei++) {
+  803208:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  80320f:	00 
+  803210:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803214:	48 3d 00 00 00 40    	cmp    $0x40000000,%rax
+  80321a:	74 46                	je     803262 <foreach_shared_region+0xd1>
+                uintptr_t pde_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, pdei, 0, 0);
+  80321c:	4c 8b 75 c8          	mov    -0x38(%rbp),%r14
+  803220:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803224:	49 09 c6             	or     %rax,%r14
+                pde_t pde = uvpd[VPD(pde_addr)];
+  803227:	4c 89 f0             	mov    %r14,%rax
+  80322a:	48 c1 e8 15          	shr    $0x15,%rax
+  80322e:	48 b9 00 00 00 80 00 	movabs $0x10080000000,%rcx
+  803235:	01 00 00 
+  803238:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+                if (!(pde & PTE_P)) {
+  80323c:	a8 01                	test   $0x1,%al
+  80323e:	74 c8                	je     803208 <foreach_shared_region+0x77>
+                if (pde & PTE_PS) {
+  803240:	48 89 c3             	mov    %rax,%rbx
+  803243:	81 e3 80 00 00 00    	and    $0x80,%ebx
+  803249:	74 8f                	je     8031da <foreach_shared_region+0x49>
+                    if (pde & PTE_SHARE) {
+  80324b:	f6 c4 04             	test   $0x4,%ah
+  80324e:	74 b8                	je     803208 <foreach_shared_region+0x77>
+                        fun((void*)pde_addr, (void*)(pde_addr + 1024 * 1024 * 2), arg);
+  803250:	49 8d b6 00 00 20 00 	lea    0x200000(%r14),%rsi
+  803257:	4c 89 fa             	mov    %r15,%rdx
+  80325a:	4c 89 f7             	mov    %r14,%rdi
+  80325d:	41 ff d4             	call   *%r12
+  803260:	eb a6                	jmp    803208 <foreach_shared_region+0x77>
+  803262:	48 8b 5d b0          	mov    -0x50(%rbp),%rbx
+  803266:	4c 8b 75 a8          	mov    -0x58(%rbp),%r14
+        for (int pdpei = 0; pdpei < PDP_ENTRY_COUNT; pdpei++) {
+  80326a:	48 81 c3 00 00 00 40 	add    $0x40000000,%rbx
+  803271:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803278:	00 00 00 
+  80327b:	48 39 c3             	cmp    %rax,%rbx
+  80327e:	74 4c                	je     8032cc <foreach_shared_region+0x13b>
+            uintptr_t pdpe_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, 0, 0, 0);
+  803280:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  803284:	48 09 d8             	or     %rbx,%rax
+  803287:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+            pdpe_t pdpe = uvpdp[VPDP(pdpe_addr)];
+  80328b:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80328f:	48 b9 00 00 40 80 00 	movabs $0x10080400000,%rcx
+  803296:	01 00 00 
+  803299:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+            if (!(pdpe & PTE_P)) {
+  80329d:	a8 01                	test   $0x1,%al
+  80329f:	74 c9                	je     80326a <foreach_shared_region+0xd9>
+            if (pdpe & PTE_PS) {
+  8032a1:	48 89 c1             	mov    %rax,%rcx
+  8032a4:	81 e1 80 00 00 00    	and    $0x80,%ecx
+  8032aa:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  8032ae:	0f 84 0c ff ff ff    	je     8031c0 <foreach_shared_region+0x2f>
+                if (pdpe & PTE_SHARE) {
+  8032b4:	f6 c4 04             	test   $0x4,%ah
+  8032b7:	74 b1                	je     80326a <foreach_shared_region+0xd9>
+                    fun((void*)pdpe_addr, (void*)(pdpe_addr + 1024 * 1024 * 1024), arg); 
+  8032b9:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  8032bd:	48 8d b7 00 00 00 40 	lea    0x40000000(%rdi),%rsi
+  8032c4:	4c 89 fa             	mov    %r15,%rdx
+  8032c7:	41 ff d4             	call   *%r12
+  8032ca:	eb 9e                	jmp    80326a <foreach_shared_region+0xd9>
+    for (int pml4ei = 0; pml4ei < PML4_ENTRY_COUNT; pml4ei++) {
+  8032cc:	49 83 c6 01          	add    $0x1,%r14
+  8032d0:	49 81 fe 00 02 00 00 	cmp    $0x200,%r14
+  8032d7:	74 24                	je     8032fd <foreach_shared_region+0x16c>
+        pml4e_t pml4e = uvpml4[VPML4(pml4_addr)];
+  8032d9:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  8032e0:	01 00 00 
+  8032e3:	4a 8b 04 f0          	mov    (%rax,%r14,8),%rax
+        if (!(pml4e & PTE_P)) {
+  8032e7:	a8 01                	test   $0x1,%al
+  8032e9:	74 e1                	je     8032cc <foreach_shared_region+0x13b>
+  8032eb:	4c 89 f0             	mov    %r14,%rax
+  8032ee:	48 c1 e0 27          	shl    $0x27,%rax
+  8032f2:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8032f6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8032fb:	eb 83                	jmp    803280 <foreach_shared_region+0xef>
+            }
+        }
+    }
+    
+    return 0;
+}
+  8032fd:	b8 00 00 00 00       	mov    $0x0,%eax
+  803302:	48 83 c4 38          	add    $0x38,%rsp
+  803306:	5b                   	pop    %rbx
+  803307:	41 5c                	pop    %r12
+  803309:	41 5d                	pop    %r13
+  80330b:	41 5e                	pop    %r14
+  80330d:	41 5f                	pop    %r15
+  80330f:	5d                   	pop    %rbp
+  803310:	c3                   	ret
+
+0000000000803311 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  803311:	b8 00 00 00 00       	mov    $0x0,%eax
+  803316:	c3                   	ret
+
+0000000000803317 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  803317:	55                   	push   %rbp
+  803318:	48 89 e5             	mov    %rsp,%rbp
+  80331b:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  80331e:	48 be c4 3e 80 00 00 	movabs $0x803ec4,%rsi
+  803325:	00 00 00 
+  803328:	48 b8 eb 0b 80 00 00 	movabs $0x800beb,%rax
+  80332f:	00 00 00 
+  803332:	ff d0                	call   *%rax
+    return 0;
+}
+  803334:	b8 00 00 00 00       	mov    $0x0,%eax
+  803339:	5d                   	pop    %rbp
+  80333a:	c3                   	ret
+
+000000000080333b <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  80333b:	55                   	push   %rbp
+  80333c:	48 89 e5             	mov    %rsp,%rbp
+  80333f:	41 57                	push   %r15
+  803341:	41 56                	push   %r14
+  803343:	41 55                	push   %r13
+  803345:	41 54                	push   %r12
+  803347:	53                   	push   %rbx
+  803348:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  80334f:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  803356:	48 85 d2             	test   %rdx,%rdx
+  803359:	74 7a                	je     8033d5 <devcons_write+0x9a>
+  80335b:	49 89 d6             	mov    %rdx,%r14
+  80335e:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  803364:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  803369:	49 bf e5 0d 80 00 00 	movabs $0x800de5,%r15
+  803370:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  803373:	4c 89 f3             	mov    %r14,%rbx
+  803376:	48 29 f3             	sub    %rsi,%rbx
+  803379:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  80337e:	48 39 c3             	cmp    %rax,%rbx
+  803381:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  803385:	4c 63 eb             	movslq %ebx,%r13
+  803388:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  80338f:	48 01 c6             	add    %rax,%rsi
+  803392:	4c 89 ea             	mov    %r13,%rdx
+  803395:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  80339c:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  80339f:	4c 89 ee             	mov    %r13,%rsi
+  8033a2:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  8033a9:	48 b8 12 10 80 00 00 	movabs $0x801012,%rax
+  8033b0:	00 00 00 
+  8033b3:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  8033b5:	41 01 dc             	add    %ebx,%r12d
+  8033b8:	49 63 f4             	movslq %r12d,%rsi
+  8033bb:	4c 39 f6             	cmp    %r14,%rsi
+  8033be:	72 b3                	jb     803373 <devcons_write+0x38>
+    return res;
+  8033c0:	49 63 c4             	movslq %r12d,%rax
+}
+  8033c3:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  8033ca:	5b                   	pop    %rbx
+  8033cb:	41 5c                	pop    %r12
+  8033cd:	41 5d                	pop    %r13
+  8033cf:	41 5e                	pop    %r14
+  8033d1:	41 5f                	pop    %r15
+  8033d3:	5d                   	pop    %rbp
+  8033d4:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  8033d5:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8033db:	eb e3                	jmp    8033c0 <devcons_write+0x85>
+
+00000000008033dd <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8033dd:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  8033e0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8033e5:	48 85 c0             	test   %rax,%rax
+  8033e8:	74 55                	je     80343f <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8033ea:	55                   	push   %rbp
+  8033eb:	48 89 e5             	mov    %rsp,%rbp
+  8033ee:	41 55                	push   %r13
+  8033f0:	41 54                	push   %r12
+  8033f2:	53                   	push   %rbx
+  8033f3:	48 83 ec 08          	sub    $0x8,%rsp
+  8033f7:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  8033fa:	48 bb 3f 10 80 00 00 	movabs $0x80103f,%rbx
+  803401:	00 00 00 
+  803404:	49 bc 0c 11 80 00 00 	movabs $0x80110c,%r12
+  80340b:	00 00 00 
+  80340e:	eb 03                	jmp    803413 <devcons_read+0x36>
+  803410:	41 ff d4             	call   *%r12
+  803413:	ff d3                	call   *%rbx
+  803415:	85 c0                	test   %eax,%eax
+  803417:	74 f7                	je     803410 <devcons_read+0x33>
+    if (c < 0) return c;
+  803419:	48 63 d0             	movslq %eax,%rdx
+  80341c:	78 13                	js     803431 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  80341e:	ba 00 00 00 00       	mov    $0x0,%edx
+  803423:	83 f8 04             	cmp    $0x4,%eax
+  803426:	74 09                	je     803431 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  803428:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  80342c:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  803431:	48 89 d0             	mov    %rdx,%rax
+  803434:	48 83 c4 08          	add    $0x8,%rsp
+  803438:	5b                   	pop    %rbx
+  803439:	41 5c                	pop    %r12
+  80343b:	41 5d                	pop    %r13
+  80343d:	5d                   	pop    %rbp
+  80343e:	c3                   	ret
+  80343f:	48 89 d0             	mov    %rdx,%rax
+  803442:	c3                   	ret
+
+0000000000803443 <cputchar>:
+cputchar(int ch) {
+  803443:	55                   	push   %rbp
+  803444:	48 89 e5             	mov    %rsp,%rbp
+  803447:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  80344b:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  80344f:	be 01 00 00 00       	mov    $0x1,%esi
+  803454:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  803458:	48 b8 12 10 80 00 00 	movabs $0x801012,%rax
+  80345f:	00 00 00 
+  803462:	ff d0                	call   *%rax
+}
+  803464:	c9                   	leave
+  803465:	c3                   	ret
+
+0000000000803466 <getchar>:
+getchar(void) {
+  803466:	55                   	push   %rbp
+  803467:	48 89 e5             	mov    %rsp,%rbp
+  80346a:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  80346e:	ba 01 00 00 00       	mov    $0x1,%edx
+  803473:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  803477:	bf 00 00 00 00       	mov    $0x0,%edi
+  80347c:	48 b8 7a 19 80 00 00 	movabs $0x80197a,%rax
+  803483:	00 00 00 
+  803486:	ff d0                	call   *%rax
+  803488:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  80348a:	85 c0                	test   %eax,%eax
+  80348c:	78 06                	js     803494 <getchar+0x2e>
+  80348e:	74 08                	je     803498 <getchar+0x32>
+  803490:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  803494:	89 d0                	mov    %edx,%eax
+  803496:	c9                   	leave
+  803497:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  803498:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  80349d:	eb f5                	jmp    803494 <getchar+0x2e>
+
+000000000080349f <iscons>:
+iscons(int fdnum) {
+  80349f:	55                   	push   %rbp
+  8034a0:	48 89 e5             	mov    %rsp,%rbp
+  8034a3:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8034a7:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8034ab:	48 b8 97 16 80 00 00 	movabs $0x801697,%rax
+  8034b2:	00 00 00 
+  8034b5:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8034b7:	85 c0                	test   %eax,%eax
+  8034b9:	78 18                	js     8034d3 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  8034bb:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8034bf:	48 b8 a0 40 80 00 00 	movabs $0x8040a0,%rax
+  8034c6:	00 00 00 
+  8034c9:	8b 00                	mov    (%rax),%eax
+  8034cb:	39 02                	cmp    %eax,(%rdx)
+  8034cd:	0f 94 c0             	sete   %al
+  8034d0:	0f b6 c0             	movzbl %al,%eax
+}
+  8034d3:	c9                   	leave
+  8034d4:	c3                   	ret
+
+00000000008034d5 <opencons>:
+opencons(void) {
+  8034d5:	55                   	push   %rbp
+  8034d6:	48 89 e5             	mov    %rsp,%rbp
+  8034d9:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8034dd:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  8034e1:	48 b8 7d 16 80 00 00 	movabs $0x80167d,%rax
+  8034e8:	00 00 00 
+  8034eb:	ff d0                	call   *%rax
+  8034ed:	85 c0                	test   %eax,%eax
+  8034ef:	78 49                	js     80353a <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  8034f1:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8034f6:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8034fb:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  8034ff:	bf 00 00 00 00       	mov    $0x0,%edi
+  803504:	48 b8 9b 11 80 00 00 	movabs $0x80119b,%rax
+  80350b:	00 00 00 
+  80350e:	ff d0                	call   *%rax
+  803510:	85 c0                	test   %eax,%eax
+  803512:	78 26                	js     80353a <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  803514:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803518:	a1 a0 40 80 00 00 00 	movabs 0x8040a0,%eax
+  80351f:	00 00 
+  803521:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  803523:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803527:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  80352e:	48 b8 d6 15 80 00 00 	movabs $0x8015d6,%rax
+  803535:	00 00 00 
+  803538:	ff d0                	call   *%rax
+}
+  80353a:	c9                   	leave
+  80353b:	c3                   	ret
+
+000000000080353c <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  80353c:	55                   	push   %rbp
+  80353d:	48 89 e5             	mov    %rsp,%rbp
+  803540:	41 55                	push   %r13
+  803542:	41 54                	push   %r12
+  803544:	53                   	push   %rbx
+  803545:	48 83 ec 08          	sub    $0x8,%rsp
+  803549:	49 89 fc             	mov    %rdi,%r12
+  80354c:	48 89 f7             	mov    %rsi,%rdi
+  80354f:	48 89 d3             	mov    %rdx,%rbx
+  803552:	49 89 cd             	mov    %rcx,%r13
+    // LAB 9: Your code here:
+    int res = sys_ipc_recv(!pg ? (void*)MAX_USER_ADDRESS : pg, !size ? 0 : *size);
+  803555:	be 00 00 00 00       	mov    $0x0,%esi
+  80355a:	48 85 d2             	test   %rdx,%rdx
+  80355d:	74 03                	je     803562 <ipc_recv+0x26>
+  80355f:	48 8b 32             	mov    (%rdx),%rsi
+  803562:	48 85 ff             	test   %rdi,%rdi
+  803565:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80356c:	00 00 00 
+  80356f:	48 0f 44 f8          	cmove  %rax,%rdi
+  803573:	48 b8 6d 15 80 00 00 	movabs $0x80156d,%rax
+  80357a:	00 00 00 
+  80357d:	ff d0                	call   *%rax
+    if (res < 0) {
+  80357f:	85 c0                	test   %eax,%eax
+  803581:	78 66                	js     8035e9 <ipc_recv+0xad>
+        if (size) {
+            *size = 0;
+        }
+        return res;
+    }
+    if (from_env_store) {
+  803583:	4d 85 e4             	test   %r12,%r12
+  803586:	74 14                	je     80359c <ipc_recv+0x60>
+        *from_env_store = thisenv->env_ipc_from;
+  803588:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  80358f:	00 00 00 
+  803592:	8b 80 ac 01 00 00    	mov    0x1ac(%rax),%eax
+  803598:	41 89 04 24          	mov    %eax,(%r12)
+    }
+    if (perm_store) {
+  80359c:	4d 85 ed             	test   %r13,%r13
+  80359f:	74 14                	je     8035b5 <ipc_recv+0x79>
+        *perm_store = thisenv->env_ipc_perm;
+  8035a1:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  8035a8:	00 00 00 
+  8035ab:	8b 80 b0 01 00 00    	mov    0x1b0(%rax),%eax
+  8035b1:	41 89 45 00          	mov    %eax,0x0(%r13)
+    }
+    if (size) {
+  8035b5:	48 85 db             	test   %rbx,%rbx
+  8035b8:	74 14                	je     8035ce <ipc_recv+0x92>
+        *size = thisenv->env_ipc_maxsz;
+  8035ba:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  8035c1:	00 00 00 
+  8035c4:	48 8b 80 a0 01 00 00 	mov    0x1a0(%rax),%rax
+  8035cb:	48 89 03             	mov    %rax,(%rbx)
+    }
+    return thisenv->env_ipc_value;
+  8035ce:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  8035d5:	00 00 00 
+  8035d8:	8b 80 a8 01 00 00    	mov    0x1a8(%rax),%eax
+}
+  8035de:	48 83 c4 08          	add    $0x8,%rsp
+  8035e2:	5b                   	pop    %rbx
+  8035e3:	41 5c                	pop    %r12
+  8035e5:	41 5d                	pop    %r13
+  8035e7:	5d                   	pop    %rbp
+  8035e8:	c3                   	ret
+        if (from_env_store) {
+  8035e9:	4d 85 e4             	test   %r12,%r12
+  8035ec:	74 08                	je     8035f6 <ipc_recv+0xba>
+            *from_env_store = 0;
+  8035ee:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  8035f5:	00 
+        if (perm_store) {
+  8035f6:	4d 85 ed             	test   %r13,%r13
+  8035f9:	74 08                	je     803603 <ipc_recv+0xc7>
+            *perm_store = 0;
+  8035fb:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  803602:	00 
+        if (size) {
+  803603:	48 85 db             	test   %rbx,%rbx
+  803606:	74 d6                	je     8035de <ipc_recv+0xa2>
+            *size = 0;
+  803608:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  80360f:	eb cd                	jmp    8035de <ipc_recv+0xa2>
+
+0000000000803611 <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  803611:	55                   	push   %rbp
+  803612:	48 89 e5             	mov    %rsp,%rbp
+  803615:	41 57                	push   %r15
+  803617:	41 56                	push   %r14
+  803619:	41 55                	push   %r13
+  80361b:	41 54                	push   %r12
+  80361d:	53                   	push   %rbx
+  80361e:	48 83 ec 18          	sub    $0x18,%rsp
+  803622:	41 89 fd             	mov    %edi,%r13d
+  803625:	89 75 cc             	mov    %esi,-0x34(%rbp)
+  803628:	49 89 cc             	mov    %rcx,%r12
+  80362b:	44 89 45 c8          	mov    %r8d,-0x38(%rbp)
+    // LAB 9: Your code here:
+    int res = 0;
+    while ((res = sys_ipc_try_send(to_env, val, !pg ? (void*)MAX_USER_ADDRESS : pg, size, perm)) < 0) {
+  80362f:	48 85 d2             	test   %rdx,%rdx
+  803632:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803639:	00 00 00 
+  80363c:	48 0f 45 c2          	cmovne %rdx,%rax
+  803640:	48 89 c3             	mov    %rax,%rbx
+  803643:	49 be 41 15 80 00 00 	movabs $0x801541,%r14
+  80364a:	00 00 00 
+        if (res != -E_IPC_NOT_RECV) {
+            panic("sys_ipc_try_send failed: %i", res);
+        }
+        sys_yield();
+  80364d:	49 bf 0c 11 80 00 00 	movabs $0x80110c,%r15
+  803654:	00 00 00 
+    while ((res = sys_ipc_try_send(to_env, val, !pg ? (void*)MAX_USER_ADDRESS : pg, size, perm)) < 0) {
+  803657:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  80365a:	44 8b 45 c8          	mov    -0x38(%rbp),%r8d
+  80365e:	4c 89 e1             	mov    %r12,%rcx
+  803661:	48 89 da             	mov    %rbx,%rdx
+  803664:	44 89 ef             	mov    %r13d,%edi
+  803667:	41 ff d6             	call   *%r14
+  80366a:	85 c0                	test   %eax,%eax
+  80366c:	79 37                	jns    8036a5 <ipc_send+0x94>
+        if (res != -E_IPC_NOT_RECV) {
+  80366e:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  803671:	75 05                	jne    803678 <ipc_send+0x67>
+        sys_yield();
+  803673:	41 ff d7             	call   *%r15
+  803676:	eb df                	jmp    803657 <ipc_send+0x46>
+            panic("sys_ipc_try_send failed: %i", res);
+  803678:	89 c1                	mov    %eax,%ecx
+  80367a:	48 ba d0 3e 80 00 00 	movabs $0x803ed0,%rdx
+  803681:	00 00 00 
+  803684:	be 40 00 00 00       	mov    $0x40,%esi
+  803689:	48 bf ec 3e 80 00 00 	movabs $0x803eec,%rdi
+  803690:	00 00 00 
+  803693:	b8 00 00 00 00       	mov    $0x0,%eax
+  803698:	49 b8 76 01 80 00 00 	movabs $0x800176,%r8
+  80369f:	00 00 00 
+  8036a2:	41 ff d0             	call   *%r8
+    }
+    return;
+}
+  8036a5:	48 83 c4 18          	add    $0x18,%rsp
+  8036a9:	5b                   	pop    %rbx
+  8036aa:	41 5c                	pop    %r12
+  8036ac:	41 5d                	pop    %r13
+  8036ae:	41 5e                	pop    %r14
+  8036b0:	41 5f                	pop    %r15
+  8036b2:	5d                   	pop    %rbp
+  8036b3:	c3                   	ret
+
+00000000008036b4 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  8036b4:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  8036b9:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  8036c0:	00 00 00 
+  8036c3:	48 69 d0 d0 01 00 00 	imul   $0x1d0,%rax,%rdx
+  8036ca:	48 01 ca             	add    %rcx,%rdx
+  8036cd:	8b 92 e8 00 00 00    	mov    0xe8(%rdx),%edx
+  8036d3:	39 fa                	cmp    %edi,%edx
+  8036d5:	74 12                	je     8036e9 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  8036d7:	48 83 c0 01          	add    $0x1,%rax
+  8036db:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  8036e1:	75 e0                	jne    8036c3 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  8036e3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8036e8:	c3                   	ret
+            return envs[i].env_id;
+  8036e9:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+  8036f0:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8036f7:	00 00 00 
+  8036fa:	48 01 d0             	add    %rdx,%rax
+  8036fd:	8b 80 e0 00 00 00    	mov    0xe0(%rax),%eax
+  803703:	c3                   	ret
+  803704:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000803708 <__rodata_start>:
+  803708:	69 20 61 6d 20 70    	imul   $0x70206d61,(%rax),%esp
+  80370e:	61                   	(bad)
+  80370f:	72 65                	jb     803776 <__rodata_start+0x6e>
+  803711:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803712:	74 20                	je     803734 <__rodata_start+0x2c>
+  803714:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803716:	76 69                	jbe    803781 <__rodata_start+0x79>
+  803718:	72 6f                	jb     803789 <__rodata_start+0x81>
+  80371a:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80371b:	6d                   	insl   (%dx),%es:(%rdi)
+  80371c:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  80371e:	74 20                	je     803740 <__rodata_start+0x38>
+  803720:	25 30 38 78 0a       	and    $0xa783830,%eax
+  803725:	00 68 65             	add    %ch,0x65(%rax)
+  803728:	6c                   	insb   (%dx),%es:(%rdi)
+  803729:	6c                   	insb   (%dx),%es:(%rdi)
+  80372a:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80372b:	00 73 70             	add    %dh,0x70(%rbx)
+  80372e:	61                   	(bad)
+  80372f:	77 6e                	ja     80379f <__rodata_start+0x97>
+  803731:	28 68 65             	sub    %ch,0x65(%rax)
+  803734:	6c                   	insb   (%dx),%es:(%rdi)
+  803735:	6c                   	insb   (%dx),%es:(%rdi)
+  803736:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803737:	29 20                	sub    %esp,(%rax)
+  803739:	66 61                	data16 (bad)
+  80373b:	69 6c 65 64 3a 20 25 	imul   $0x6925203a,0x64(%rbp,%riz,2),%ebp
+  803742:	69 
+  803743:	00 75 73             	add    %dh,0x73(%rbp)
+  803746:	65 72 2f             	gs jb  803778 <__rodata_start+0x70>
+  803749:	73 70                	jae    8037bb <__rodata_start+0xb3>
+  80374b:	61                   	(bad)
+  80374c:	77 6e                	ja     8037bc <__rodata_start+0xb4>
+  80374e:	68 65 6c 6c 6f       	push   $0x6f6c6c65
+  803753:	2e 63 00             	cs movsxd (%rax),%eax
+  803756:	3c 75                	cmp    $0x75,%al
+  803758:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803759:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  80375d:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80375e:	3e 00 5b 25          	ds add %bl,0x25(%rbx)
+  803762:	30 38                	xor    %bh,(%rax)
+  803764:	78 5d                	js     8037c3 <__rodata_start+0xbb>
+  803766:	20 75 73             	and    %dh,0x73(%rbp)
+  803769:	65 72 20             	gs jb  80378c <__rodata_start+0x84>
+  80376c:	70 61                	jo     8037cf <__rodata_start+0xc7>
+  80376e:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80376f:	69 63 20 69 6e 20 25 	imul   $0x25206e69,0x20(%rbx),%esp
+  803776:	73 20                	jae    803798 <__rodata_start+0x90>
+  803778:	61                   	(bad)
+  803779:	74 20                	je     80379b <__rodata_start+0x93>
+  80377b:	25 73 3a 25 64       	and    $0x64253a73,%eax
+  803780:	3a 20                	cmp    (%rax),%ah
+  803782:	00 30                	add    %dh,(%rax)
+  803784:	31 32                	xor    %esi,(%rdx)
+  803786:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  80378d:	41                   	rex.B
+  80378e:	42                   	rex.X
+  80378f:	43                   	rex.XB
+  803790:	44                   	rex.R
+  803791:	45                   	rex.RB
+  803792:	46 00 30             	rex.RX add %r14b,(%rax)
+  803795:	31 32                	xor    %esi,(%rdx)
+  803797:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  80379e:	61                   	(bad)
+  80379f:	62 63 64 65 66       	(bad)
+  8037a4:	00 28                	add    %ch,(%rax)
+  8037a6:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8037a7:	75 6c                	jne    803815 <__rodata_start+0x10d>
+  8037a9:	6c                   	insb   (%dx),%es:(%rdi)
+  8037aa:	29 00                	sub    %eax,(%rax)
+  8037ac:	65 72 72             	gs jb  803821 <__rodata_start+0x119>
+  8037af:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8037b0:	72 20                	jb     8037d2 <__rodata_start+0xca>
+  8037b2:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  8037b7:	73 70                	jae    803829 <__rodata_start+0x121>
+  8037b9:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  8037bd:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  8037c4:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8037c5:	72 00                	jb     8037c7 <__rodata_start+0xbf>
+  8037c7:	62 61 64 20 65       	(bad)
+  8037cc:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8037cd:	76 69                	jbe    803838 <__rodata_start+0x130>
+  8037cf:	72 6f                	jb     803840 <__rodata_start+0x138>
+  8037d1:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8037d2:	6d                   	insl   (%dx),%es:(%rdi)
+  8037d3:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  8037d5:	74 00                	je     8037d7 <__rodata_start+0xcf>
+  8037d7:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  8037de:	20 70 61             	and    %dh,0x61(%rax)
+  8037e1:	72 61                	jb     803844 <__rodata_start+0x13c>
+  8037e3:	6d                   	insl   (%dx),%es:(%rdi)
+  8037e4:	65 74 65             	gs je  80384c <__rodata_start+0x144>
+  8037e7:	72 00                	jb     8037e9 <__rodata_start+0xe1>
+  8037e9:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8037ea:	75 74                	jne    803860 <__rodata_start+0x158>
+  8037ec:	20 6f 66             	and    %ch,0x66(%rdi)
+  8037ef:	20 6d 65             	and    %ch,0x65(%rbp)
+  8037f2:	6d                   	insl   (%dx),%es:(%rdi)
+  8037f3:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8037f4:	72 79                	jb     80386f <__rodata_start+0x167>
+  8037f6:	00 6f 75             	add    %ch,0x75(%rdi)
+  8037f9:	74 20                	je     80381b <__rodata_start+0x113>
+  8037fb:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8037fc:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  803800:	76 69                	jbe    80386b <__rodata_start+0x163>
+  803802:	72 6f                	jb     803873 <__rodata_start+0x16b>
+  803804:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803805:	6d                   	insl   (%dx),%es:(%rdi)
+  803806:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803808:	74 73                	je     80387d <__rodata_start+0x175>
+  80380a:	00 63 6f             	add    %ah,0x6f(%rbx)
+  80380d:	72 72                	jb     803881 <__rodata_start+0x179>
+  80380f:	75 70                	jne    803881 <__rodata_start+0x179>
+  803811:	74 65                	je     803878 <__rodata_start+0x170>
+  803813:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  803818:	75 67                	jne    803881 <__rodata_start+0x179>
+  80381a:	20 69 6e             	and    %ch,0x6e(%rcx)
+  80381d:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  80381f:	00 73 65             	add    %dh,0x65(%rbx)
+  803822:	67 6d                	insl   (%dx),%es:(%edi)
+  803824:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803826:	74 61                	je     803889 <__rodata_start+0x181>
+  803828:	74 69                	je     803893 <__rodata_start+0x18b>
+  80382a:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80382b:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80382c:	20 66 61             	and    %ah,0x61(%rsi)
+  80382f:	75 6c                	jne    80389d <__rodata_start+0x195>
+  803831:	74 00                	je     803833 <__rodata_start+0x12b>
+  803833:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  80383a:	20 45 4c             	and    %al,0x4c(%rbp)
+  80383d:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  803841:	61                   	(bad)
+  803842:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  803847:	20 73 75             	and    %dh,0x75(%rbx)
+  80384a:	63 68 20             	movsxd 0x20(%rax),%ebp
+  80384d:	73 79                	jae    8038c8 <__rodata_start+0x1c0>
+  80384f:	73 74                	jae    8038c5 <__rodata_start+0x1bd>
+  803851:	65 6d                	gs insl (%dx),%es:(%rdi)
+  803853:	20 63 61             	and    %ah,0x61(%rbx)
+  803856:	6c                   	insb   (%dx),%es:(%rdi)
+  803857:	6c                   	insb   (%dx),%es:(%rdi)
+  803858:	00 65 6e             	add    %ah,0x6e(%rbp)
+  80385b:	74 72                	je     8038cf <__rodata_start+0x1c7>
+  80385d:	79 20                	jns    80387f <__rodata_start+0x177>
+  80385f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803860:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803861:	74 20                	je     803883 <__rodata_start+0x17b>
+  803863:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  803865:	75 6e                	jne    8038d5 <__rodata_start+0x1cd>
+  803867:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  80386b:	76 20                	jbe    80388d <__rodata_start+0x185>
+  80386d:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  803874:	72 65                	jb     8038db <__rodata_start+0x1d3>
+  803876:	63 76 69             	movsxd 0x69(%rsi),%esi
+  803879:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80387a:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  80387e:	65 78 70             	gs js  8038f1 <__rodata_start+0x1e9>
+  803881:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  803886:	20 65 6e             	and    %ah,0x6e(%rbp)
+  803889:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  80388d:	20 66 69             	and    %ah,0x69(%rsi)
+  803890:	6c                   	insb   (%dx),%es:(%rdi)
+  803891:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  803895:	20 66 72             	and    %ah,0x72(%rsi)
+  803898:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  80389d:	61                   	(bad)
+  80389e:	63 65 20             	movsxd 0x20(%rbp),%esp
+  8038a1:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8038a2:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8038a3:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  8038a7:	6b 00 74             	imul   $0x74,(%rax),%eax
+  8038aa:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8038ab:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8038ac:	20 6d 61             	and    %ch,0x61(%rbp)
+  8038af:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8038b0:	79 20                	jns    8038d2 <__rodata_start+0x1ca>
+  8038b2:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  8038b9:	72 65                	jb     803920 <__rodata_start+0x218>
+  8038bb:	20 6f 70             	and    %ch,0x70(%rdi)
+  8038be:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  8038c0:	00 66 69             	add    %ah,0x69(%rsi)
+  8038c3:	6c                   	insb   (%dx),%es:(%rdi)
+  8038c4:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  8038c8:	20 62 6c             	and    %ah,0x6c(%rdx)
+  8038cb:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8038cc:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  8038cf:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8038d0:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8038d1:	74 20                	je     8038f3 <__rodata_start+0x1eb>
+  8038d3:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  8038d5:	75 6e                	jne    803945 <__rodata_start+0x23d>
+  8038d7:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  8038db:	76 61                	jbe    80393e <__rodata_start+0x236>
+  8038dd:	6c                   	insb   (%dx),%es:(%rdi)
+  8038de:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  8038e5:	00 
+  8038e6:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  8038ed:	72 65                	jb     803954 <__rodata_start+0x24c>
+  8038ef:	61                   	(bad)
+  8038f0:	64 79 20             	fs jns 803913 <__rodata_start+0x20b>
+  8038f3:	65 78 69             	gs js  80395f <__rodata_start+0x257>
+  8038f6:	73 74                	jae    80396c <__rodata_start+0x264>
+  8038f8:	73 00                	jae    8038fa <__rodata_start+0x1f2>
+  8038fa:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8038fb:	70 65                	jo     803962 <__rodata_start+0x25a>
+  8038fd:	72 61                	jb     803960 <__rodata_start+0x258>
+  8038ff:	74 69                	je     80396a <__rodata_start+0x262>
+  803901:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803902:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803903:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  803906:	74 20                	je     803928 <__rodata_start+0x220>
+  803908:	73 75                	jae    80397f <__rodata_start+0x277>
+  80390a:	70 70                	jo     80397c <__rodata_start+0x274>
+  80390c:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80390d:	72 74                	jb     803983 <__rodata_start+0x27b>
+  80390f:	65 64 00 6f 70       	gs add %ch,%fs:0x70(%rdi)
+  803914:	65 72 61             	gs jb  803978 <__rodata_start+0x270>
+  803917:	74 69                	je     803982 <__rodata_start+0x27a>
+  803919:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80391a:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80391b:	20 69 6e             	and    %ch,0x6e(%rcx)
+  80391e:	74 65                	je     803985 <__rodata_start+0x27d>
+  803920:	72 72                	jb     803994 <__rodata_start+0x28c>
+  803922:	75 70                	jne    803994 <__rodata_start+0x28c>
+  803924:	74 65                	je     80398b <__rodata_start+0x283>
+  803926:	64 00 6e 6f          	add    %ch,%fs:0x6f(%rsi)
+  80392a:	74 20                	je     80394c <__rodata_start+0x244>
+  80392c:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  80392e:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80392f:	75 67                	jne    803998 <__rodata_start+0x290>
+  803931:	68 20 43 50 55       	push   $0x55504320
+  803936:	20 74 69 6d          	and    %dh,0x6d(%rcx,%rbp,2)
+  80393a:	65 00 0f             	add    %cl,%gs:(%rdi)
+  80393d:	1f                   	(bad)
+  80393e:	40 00 b3 04 80 00 00 	add    %sil,0x8004(%rbx)
+  803945:	00 00                	add    %al,(%rax)
+  803947:	00 f4                	add    %dh,%ah
+  803949:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80394f:	00 e4                	add    %ah,%ah
+  803951:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803957:	00 f4                	add    %dh,%ah
+  803959:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80395f:	00 f4                	add    %dh,%ah
+  803961:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803967:	00 f4                	add    %dh,%ah
+  803969:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80396f:	00 f4                	add    %dh,%ah
+  803971:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803977:	00 d2                	add    %dl,%dl
+  803979:	04 80                	add    $0x80,%al
+  80397b:	00 00                	add    %al,(%rax)
+  80397d:	00 00                	add    %al,(%rax)
+  80397f:	00 f4                	add    %dh,%ah
+  803981:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803987:	00 f4                	add    %dh,%ah
+  803989:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80398f:	00 c6                	add    %al,%dh
+  803991:	04 80                	add    $0x80,%al
+  803993:	00 00                	add    %al,(%rax)
+  803995:	00 00                	add    %al,(%rax)
+  803997:	00 40 05             	add    %al,0x5(%rax)
+  80399a:	80 00 00             	addb   $0x0,(%rax)
+  80399d:	00 00                	add    %al,(%rax)
+  80399f:	00 f4                	add    %dh,%ah
+  8039a1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8039a7:	00 c6                	add    %al,%dh
+  8039a9:	04 80                	add    $0x80,%al
+  8039ab:	00 00                	add    %al,(%rax)
+  8039ad:	00 00                	add    %al,(%rax)
+  8039af:	00 0c 05 80 00 00 00 	add    %cl,0x80(,%rax,1)
+  8039b6:	00 00                	add    %al,(%rax)
+  8039b8:	0c 05                	or     $0x5,%al
+  8039ba:	80 00 00             	addb   $0x0,(%rax)
+  8039bd:	00 00                	add    %al,(%rax)
+  8039bf:	00 0c 05 80 00 00 00 	add    %cl,0x80(,%rax,1)
+  8039c6:	00 00                	add    %al,(%rax)
+  8039c8:	0c 05                	or     $0x5,%al
+  8039ca:	80 00 00             	addb   $0x0,(%rax)
+  8039cd:	00 00                	add    %al,(%rax)
+  8039cf:	00 0c 05 80 00 00 00 	add    %cl,0x80(,%rax,1)
+  8039d6:	00 00                	add    %al,(%rax)
+  8039d8:	0c 05                	or     $0x5,%al
+  8039da:	80 00 00             	addb   $0x0,(%rax)
+  8039dd:	00 00                	add    %al,(%rax)
+  8039df:	00 0c 05 80 00 00 00 	add    %cl,0x80(,%rax,1)
+  8039e6:	00 00                	add    %al,(%rax)
+  8039e8:	0c 05                	or     $0x5,%al
+  8039ea:	80 00 00             	addb   $0x0,(%rax)
+  8039ed:	00 00                	add    %al,(%rax)
+  8039ef:	00 0c 05 80 00 00 00 	add    %cl,0x80(,%rax,1)
+  8039f6:	00 00                	add    %al,(%rax)
+  8039f8:	f4                   	hlt
+  8039f9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8039ff:	00 f4                	add    %dh,%ah
+  803a01:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803a07:	00 f4                	add    %dh,%ah
+  803a09:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803a0f:	00 f4                	add    %dh,%ah
+  803a11:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803a17:	00 f4                	add    %dh,%ah
+  803a19:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803a1f:	00 f4                	add    %dh,%ah
+  803a21:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803a27:	00 f4                	add    %dh,%ah
+  803a29:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803a2f:	00 f4                	add    %dh,%ah
+  803a31:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803a37:	00 f4                	add    %dh,%ah
+  803a39:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803a3f:	00 f4                	add    %dh,%ah
+  803a41:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803a47:	00 f4                	add    %dh,%ah
+  803a49:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803a4f:	00 f4                	add    %dh,%ah
+  803a51:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803a57:	00 f4                	add    %dh,%ah
+  803a59:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803a5f:	00 f4                	add    %dh,%ah
+  803a61:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803a67:	00 f4                	add    %dh,%ah
+  803a69:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803a6f:	00 f4                	add    %dh,%ah
+  803a71:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803a77:	00 f4                	add    %dh,%ah
+  803a79:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803a7f:	00 f4                	add    %dh,%ah
+  803a81:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803a87:	00 f4                	add    %dh,%ah
+  803a89:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803a8f:	00 f4                	add    %dh,%ah
+  803a91:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803a97:	00 f4                	add    %dh,%ah
+  803a99:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803a9f:	00 f4                	add    %dh,%ah
+  803aa1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803aa7:	00 f4                	add    %dh,%ah
+  803aa9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803aaf:	00 f4                	add    %dh,%ah
+  803ab1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803ab7:	00 f4                	add    %dh,%ah
+  803ab9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803abf:	00 f4                	add    %dh,%ah
+  803ac1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803ac7:	00 f4                	add    %dh,%ah
+  803ac9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803acf:	00 f4                	add    %dh,%ah
+  803ad1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803ad7:	00 f4                	add    %dh,%ah
+  803ad9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803adf:	00 f4                	add    %dh,%ah
+  803ae1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803ae7:	00 17                	add    %dl,(%rdi)
+  803ae9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803aef:	00 f4                	add    %dh,%ah
+  803af1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803af7:	00 f4                	add    %dh,%ah
+  803af9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803aff:	00 f4                	add    %dh,%ah
+  803b01:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803b07:	00 f4                	add    %dh,%ah
+  803b09:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803b0f:	00 f4                	add    %dh,%ah
+  803b11:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803b17:	00 f4                	add    %dh,%ah
+  803b19:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803b1f:	00 f4                	add    %dh,%ah
+  803b21:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803b27:	00 f4                	add    %dh,%ah
+  803b29:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803b2f:	00 f4                	add    %dh,%ah
+  803b31:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803b37:	00 f4                	add    %dh,%ah
+  803b39:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803b3f:	00 63 05             	add    %ah,0x5(%rbx)
+  803b42:	80 00 00             	addb   $0x0,(%rax)
+  803b45:	00 00                	add    %al,(%rax)
+  803b47:	00 32                	add    %dh,(%rdx)
+  803b49:	07                   	(bad)
+  803b4a:	80 00 00             	addb   $0x0,(%rax)
+  803b4d:	00 00                	add    %al,(%rax)
+  803b4f:	00 f4                	add    %dh,%ah
+  803b51:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803b57:	00 f4                	add    %dh,%ah
+  803b59:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803b5f:	00 f4                	add    %dh,%ah
+  803b61:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803b67:	00 f4                	add    %dh,%ah
+  803b69:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803b6f:	00 92 05 80 00 00    	add    %dl,0x8005(%rdx)
+  803b75:	00 00                	add    %al,(%rax)
+  803b77:	00 f4                	add    %dh,%ah
+  803b79:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803b7f:	00 f4                	add    %dh,%ah
+  803b81:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803b87:	00 58 05             	add    %bl,0x5(%rax)
+  803b8a:	80 00 00             	addb   $0x0,(%rax)
+  803b8d:	00 00                	add    %al,(%rax)
+  803b8f:	00 f4                	add    %dh,%ah
+  803b91:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803b97:	00 f4                	add    %dh,%ah
+  803b99:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803b9f:	00 da                	add    %bl,%dl
+  803ba1:	08 80 00 00 00 00    	or     %al,0x0(%rax)
+  803ba7:	00 a4 09 80 00 00 00 	add    %ah,0x80(%rcx,%rcx,1)
+  803bae:	00 00                	add    %al,(%rax)
+  803bb0:	f4                   	hlt
+  803bb1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803bb7:	00 f4                	add    %dh,%ah
+  803bb9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803bbf:	00 29                	add    %ch,(%rcx)
+  803bc1:	06                   	(bad)
+  803bc2:	80 00 00             	addb   $0x0,(%rax)
+  803bc5:	00 00                	add    %al,(%rax)
+  803bc7:	00 f4                	add    %dh,%ah
+  803bc9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803bcf:	00 06                	add    %al,(%rsi)
+  803bd1:	08 80 00 00 00 00    	or     %al,0x0(%rax)
+  803bd7:	00 f4                	add    %dh,%ah
+  803bd9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803bdf:	00 f4                	add    %dh,%ah
+  803be1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803be7:	00 17                	add    %dl,(%rdi)
+  803be9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803bef:	00 f4                	add    %dh,%ah
+  803bf1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  803bf7:	00 bc 04 80 00 00 00 	add    %bh,0x80(%rsp,%rax,1)
+	...
+
+0000000000803c00 <error_string>:
+	...
+  803c08:	b5 37 80 00 00 00 00 00 c7 37 80 00 00 00 00 00     .7.......7......
+  803c18:	d7 37 80 00 00 00 00 00 e9 37 80 00 00 00 00 00     .7.......7......
+  803c28:	f7 37 80 00 00 00 00 00 0b 38 80 00 00 00 00 00     .7.......8......
+  803c38:	20 38 80 00 00 00 00 00 33 38 80 00 00 00 00 00      8......38......
+  803c48:	45 38 80 00 00 00 00 00 59 38 80 00 00 00 00 00     E8......Y8......
+  803c58:	69 38 80 00 00 00 00 00 7c 38 80 00 00 00 00 00     i8......|8......
+  803c68:	93 38 80 00 00 00 00 00 a9 38 80 00 00 00 00 00     .8.......8......
+  803c78:	c1 38 80 00 00 00 00 00 d9 38 80 00 00 00 00 00     .8.......8......
+  803c88:	e6 38 80 00 00 00 00 00 b0 3c 80 00 00 00 00 00     .8.......<......
+  803c98:	fa 38 80 00 00 00 00 00 12 39 80 00 00 00 00 00     .8.......9......
+  803ca8:	28 39 80 00 00 00 00 00 66 69 6c 65 20 69 73 20     (9......file is 
+  803cb8:	6e 6f 74 20 61 20 76 61 6c 69 64 20 65 78 65 63     not a valid exec
+  803cc8:	75 74 61 62 6c 65 00 90 73 79 73 63 61 6c 6c 20     utable..syscall 
+  803cd8:	25 7a 64 20 72 65 74 75 72 6e 65 64 20 25 7a 64     %zd returned %zd
+  803ce8:	20 28 3e 20 30 29 00 6c 69 62 2f 73 79 73 63 61      (> 0).lib/sysca
+  803cf8:	6c 6c 2e 63 00 0f 1f 00 5b 25 30 38 78 5d 20 75     ll.c....[%08x] u
+  803d08:	6e 6b 6e 6f 77 6e 20 64 65 76 69 63 65 20 74 79     nknown device ty
+  803d18:	70 65 20 25 64 0a 00 00 5b 25 30 38 78 5d 20 66     pe %d...[%08x] f
+  803d28:	74 72 75 6e 63 61 74 65 20 25 64 20 2d 2d 20 62     truncate %d -- b
+  803d38:	61 64 20 6d 6f 64 65 0a 00 5b 25 30 38 78 5d 20     ad mode..[%08x] 
+  803d48:	72 65 61 64 20 25 64 20 2d 2d 20 62 61 64 20 6d     read %d -- bad m
+  803d58:	6f 64 65 0a 00 5b 25 30 38 78 5d 20 77 72 69 74     ode..[%08x] writ
+  803d68:	65 20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65     e %d -- bad mode
+  803d78:	0a 00 66 0f 1f 44 00 00                             ..f..D..
+
+0000000000803d80 <devtab>:
+  803d80:	20 40 80 00 00 00 00 00 60 40 80 00 00 00 00 00      @......`@......
+  803d90:	a0 40 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .@..............
+  803da0:	57 72 6f 6e 67 20 45 4c 46 20 68 65 61 64 65 72     Wrong ELF header
+  803db0:	20 73 69 7a 65 20 6f 72 20 72 65 61 64 20 65 72      size or read er
+  803dc0:	72 6f 72 3a 20 25 69 0a 00 00 00 00 00 00 00 00     ror: %i.........
+  803dd0:	73 74 72 69 6e 67 5f 73 74 6f 72 65 20 3d 3d 20     string_store == 
+  803de0:	28 63 68 61 72 20 2a 29 55 54 45 4d 50 20 2b 20     (char *)UTEMP + 
+  803df0:	55 53 45 52 5f 53 54 41 43 4b 5f 53 49 5a 45 00     USER_STACK_SIZE.
+  803e00:	45 6c 66 20 6d 61 67 69 63 20 25 30 38 78 20 77     Elf magic %08x w
+  803e10:	61 6e 74 20 25 30 38 78 0a 00 61 73 73 65 72 74     ant %08x..assert
+  803e20:	69 6f 6e 20 66 61 69 6c 65 64 3a 20 25 73 00 6c     ion failed: %s.l
+  803e30:	69 62 2f 73 70 61 77 6e 2e 63 00 63 6f 70 79 5f     ib/spawn.c.copy_
+  803e40:	73 68 61 72 65 64 5f 72 65 67 69 6f 6e 3a 20 25     shared_region: %
+  803e50:	69 00 73 79 73 5f 65 6e 76 5f 73 65 74 5f 74 72     i.sys_env_set_tr
+  803e60:	61 70 66 72 61 6d 65 3a 20 25 69 00 73 79 73 5f     apframe: %i.sys_
+  803e70:	65 6e 76 5f 73 65 74 5f 73 74 61 74 75 73 3a 20     env_set_status: 
+  803e80:	25 69 00 3c 70 69 70 65 3e 00 6c 69 62 2f 70 69     %i.<pipe>.lib/pi
+  803e90:	70 65 2e 63 00 70 69 70 65 00 66 0f 1f 44 00 00     pe.c.pipe.f..D..
+  803ea0:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  803eb0:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  803ec0:	3d 20 32 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73 00     = 2.<cons>.cons.
+  803ed0:	73 79 73 5f 69 70 63 5f 74 72 79 5f 73 65 6e 64     sys_ipc_try_send
+  803ee0:	20 66 61 69 6c 65 64 3a 20 25 69 00 6c 69 62 2f      failed: %i.lib/
+  803ef0:	69 70 63 2e 63 00 66 2e 0f 1f 84 00 00 00 00 00     ipc.c.f.........
+  803f00:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803f10:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803f20:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803f30:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803f40:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803f50:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803f60:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803f70:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803f80:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803f90:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803fa0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803fb0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803fc0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803fd0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803fe0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803ff0:	66 2e 0f 1f 84 00 00 00 00 00 66 0f 1f 44 00 00     f.........f..D..
@@ -0,0 +1,5958 @@
+
+obj/user/spin:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 c2 00 00 00       	call   8000e5 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+ * Let it run for a couple time slices, then kill it. */
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 55                	push   %r13
+  80002b:	41 54                	push   %r12
+  80002d:	53                   	push   %rbx
+  80002e:	48 83 ec 08          	sub    $0x8,%rsp
+    envid_t env;
+
+    cprintf("I am the parent.  Forking the child...\n");
+  800032:	48 bf 98 2e 80 00 00 	movabs $0x802e98,%rdi
+  800039:	00 00 00 
+  80003c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800041:	48 ba 5e 02 80 00 00 	movabs $0x80025e,%rdx
+  800048:	00 00 00 
+  80004b:	ff d2                	call   *%rdx
+    if ((env = fork()) == 0) {
+  80004d:	48 b8 6e 15 80 00 00 	movabs $0x80156e,%rax
+  800054:	00 00 00 
+  800057:	ff d0                	call   *%rax
+  800059:	85 c0                	test   %eax,%eax
+  80005b:	75 1d                	jne    80007a <umain+0x55>
+        cprintf("I am the child.  Spinning...\n");
+  80005d:	48 bf 10 2f 80 00 00 	movabs $0x802f10,%rdi
+  800064:	00 00 00 
+  800067:	b8 00 00 00 00       	mov    $0x0,%eax
+  80006c:	48 ba 5e 02 80 00 00 	movabs $0x80025e,%rdx
+  800073:	00 00 00 
+  800076:	ff d2                	call   *%rdx
+        while (1) /* do nothing */
+  800078:	eb fe                	jmp    800078 <umain+0x53>
+  80007a:	89 c3                	mov    %eax,%ebx
+            ;
+    }
+
+    cprintf("I am the parent.  Running the child...\n");
+  80007c:	48 bf c0 2e 80 00 00 	movabs $0x802ec0,%rdi
+  800083:	00 00 00 
+  800086:	b8 00 00 00 00       	mov    $0x0,%eax
+  80008b:	49 bd 5e 02 80 00 00 	movabs $0x80025e,%r13
+  800092:	00 00 00 
+  800095:	41 ff d5             	call   *%r13
+    sys_yield();
+  800098:	49 bc a4 10 80 00 00 	movabs $0x8010a4,%r12
+  80009f:	00 00 00 
+  8000a2:	41 ff d4             	call   *%r12
+    sys_yield();
+  8000a5:	41 ff d4             	call   *%r12
+    sys_yield();
+  8000a8:	41 ff d4             	call   *%r12
+    sys_yield();
+  8000ab:	41 ff d4             	call   *%r12
+    sys_yield();
+  8000ae:	41 ff d4             	call   *%r12
+    sys_yield();
+  8000b1:	41 ff d4             	call   *%r12
+    sys_yield();
+  8000b4:	41 ff d4             	call   *%r12
+    sys_yield();
+  8000b7:	41 ff d4             	call   *%r12
+
+    cprintf("I am the parent.  Killing the child...\n");
+  8000ba:	48 bf e8 2e 80 00 00 	movabs $0x802ee8,%rdi
+  8000c1:	00 00 00 
+  8000c4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000c9:	41 ff d5             	call   *%r13
+    sys_env_destroy(env);
+  8000cc:	89 df                	mov    %ebx,%edi
+  8000ce:	48 b8 08 10 80 00 00 	movabs $0x801008,%rax
+  8000d5:	00 00 00 
+  8000d8:	ff d0                	call   *%rax
+}
+  8000da:	48 83 c4 08          	add    $0x8,%rsp
+  8000de:	5b                   	pop    %rbx
+  8000df:	41 5c                	pop    %r12
+  8000e1:	41 5d                	pop    %r13
+  8000e3:	5d                   	pop    %rbp
+  8000e4:	c3                   	ret
+
+00000000008000e5 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  8000e5:	55                   	push   %rbp
+  8000e6:	48 89 e5             	mov    %rsp,%rbp
+  8000e9:	41 56                	push   %r14
+  8000eb:	41 55                	push   %r13
+  8000ed:	41 54                	push   %r12
+  8000ef:	53                   	push   %rbx
+  8000f0:	41 89 fd             	mov    %edi,%r13d
+  8000f3:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  8000f6:	48 ba d8 40 80 00 00 	movabs $0x8040d8,%rdx
+  8000fd:	00 00 00 
+  800100:	48 b8 d8 40 80 00 00 	movabs $0x8040d8,%rax
+  800107:	00 00 00 
+  80010a:	48 39 c2             	cmp    %rax,%rdx
+  80010d:	73 17                	jae    800126 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  80010f:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  800112:	49 89 c4             	mov    %rax,%r12
+  800115:	48 83 c3 08          	add    $0x8,%rbx
+  800119:	b8 00 00 00 00       	mov    $0x0,%eax
+  80011e:	ff 53 f8             	call   *-0x8(%rbx)
+  800121:	4c 39 e3             	cmp    %r12,%rbx
+  800124:	72 ef                	jb     800115 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+    envid_t this_env_id = sys_getenvid();
+  800126:	48 b8 73 10 80 00 00 	movabs $0x801073,%rax
+  80012d:	00 00 00 
+  800130:	ff d0                	call   *%rax
+    thisenv = &((struct Env*)UENVS)[ENVX(this_env_id)];
+  800132:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800137:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+  80013e:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  800145:	00 00 00 
+  800148:	48 01 d0             	add    %rdx,%rax
+  80014b:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  800152:	00 00 00 
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  800155:	45 85 ed             	test   %r13d,%r13d
+  800158:	7e 0d                	jle    800167 <libmain+0x82>
+  80015a:	49 8b 06             	mov    (%r14),%rax
+  80015d:	48 a3 00 40 80 00 00 	movabs %rax,0x804000
+  800164:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  800167:	4c 89 f6             	mov    %r14,%rsi
+  80016a:	44 89 ef             	mov    %r13d,%edi
+  80016d:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  800174:	00 00 00 
+  800177:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  800179:	48 b8 8e 01 80 00 00 	movabs $0x80018e,%rax
+  800180:	00 00 00 
+  800183:	ff d0                	call   *%rax
+#endif
+}
+  800185:	5b                   	pop    %rbx
+  800186:	41 5c                	pop    %r12
+  800188:	41 5d                	pop    %r13
+  80018a:	41 5e                	pop    %r14
+  80018c:	5d                   	pop    %rbp
+  80018d:	c3                   	ret
+
+000000000080018e <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  80018e:	55                   	push   %rbp
+  80018f:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  800192:	48 b8 2b 19 80 00 00 	movabs $0x80192b,%rax
+  800199:	00 00 00 
+  80019c:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  80019e:	bf 00 00 00 00       	mov    $0x0,%edi
+  8001a3:	48 b8 08 10 80 00 00 	movabs $0x801008,%rax
+  8001aa:	00 00 00 
+  8001ad:	ff d0                	call   *%rax
+}
+  8001af:	5d                   	pop    %rbp
+  8001b0:	c3                   	ret
+
+00000000008001b1 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  8001b1:	55                   	push   %rbp
+  8001b2:	48 89 e5             	mov    %rsp,%rbp
+  8001b5:	53                   	push   %rbx
+  8001b6:	48 83 ec 08          	sub    $0x8,%rsp
+  8001ba:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  8001bd:	8b 06                	mov    (%rsi),%eax
+  8001bf:	8d 50 01             	lea    0x1(%rax),%edx
+  8001c2:	89 16                	mov    %edx,(%rsi)
+  8001c4:	48 98                	cltq
+  8001c6:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  8001cb:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  8001d1:	74 0a                	je     8001dd <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  8001d3:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  8001d7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8001db:	c9                   	leave
+  8001dc:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  8001dd:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  8001e1:	be ff 00 00 00       	mov    $0xff,%esi
+  8001e6:	48 b8 aa 0f 80 00 00 	movabs $0x800faa,%rax
+  8001ed:	00 00 00 
+  8001f0:	ff d0                	call   *%rax
+        state->offset = 0;
+  8001f2:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  8001f8:	eb d9                	jmp    8001d3 <putch+0x22>
+
+00000000008001fa <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  8001fa:	55                   	push   %rbp
+  8001fb:	48 89 e5             	mov    %rsp,%rbp
+  8001fe:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  800205:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  800208:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  80020f:	b9 21 00 00 00       	mov    $0x21,%ecx
+  800214:	b8 00 00 00 00       	mov    $0x0,%eax
+  800219:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  80021c:	48 89 f1             	mov    %rsi,%rcx
+  80021f:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  800226:	48 bf b1 01 80 00 00 	movabs $0x8001b1,%rdi
+  80022d:	00 00 00 
+  800230:	48 b8 ae 03 80 00 00 	movabs $0x8003ae,%rax
+  800237:	00 00 00 
+  80023a:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  80023c:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  800243:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  80024a:	48 b8 aa 0f 80 00 00 	movabs $0x800faa,%rax
+  800251:	00 00 00 
+  800254:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  800256:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  80025c:	c9                   	leave
+  80025d:	c3                   	ret
+
+000000000080025e <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  80025e:	55                   	push   %rbp
+  80025f:	48 89 e5             	mov    %rsp,%rbp
+  800262:	48 83 ec 50          	sub    $0x50,%rsp
+  800266:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  80026a:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  80026e:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800272:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800276:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  80027a:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  800281:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800285:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800289:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80028d:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  800291:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  800295:	48 b8 fa 01 80 00 00 	movabs $0x8001fa,%rax
+  80029c:	00 00 00 
+  80029f:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  8002a1:	c9                   	leave
+  8002a2:	c3                   	ret
+
+00000000008002a3 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  8002a3:	55                   	push   %rbp
+  8002a4:	48 89 e5             	mov    %rsp,%rbp
+  8002a7:	41 57                	push   %r15
+  8002a9:	41 56                	push   %r14
+  8002ab:	41 55                	push   %r13
+  8002ad:	41 54                	push   %r12
+  8002af:	53                   	push   %rbx
+  8002b0:	48 83 ec 18          	sub    $0x18,%rsp
+  8002b4:	49 89 fc             	mov    %rdi,%r12
+  8002b7:	49 89 f5             	mov    %rsi,%r13
+  8002ba:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8002be:	8b 45 10             	mov    0x10(%rbp),%eax
+  8002c1:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  8002c4:	41 89 cf             	mov    %ecx,%r15d
+  8002c7:	4c 39 fa             	cmp    %r15,%rdx
+  8002ca:	73 5b                	jae    800327 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  8002cc:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  8002d0:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  8002d4:	85 db                	test   %ebx,%ebx
+  8002d6:	7e 0e                	jle    8002e6 <print_num+0x43>
+            putch(padc, put_arg);
+  8002d8:	4c 89 ee             	mov    %r13,%rsi
+  8002db:	44 89 f7             	mov    %r14d,%edi
+  8002de:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  8002e1:	83 eb 01             	sub    $0x1,%ebx
+  8002e4:	75 f2                	jne    8002d8 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  8002e6:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  8002ea:	48 b9 49 2f 80 00 00 	movabs $0x802f49,%rcx
+  8002f1:	00 00 00 
+  8002f4:	48 b8 38 2f 80 00 00 	movabs $0x802f38,%rax
+  8002fb:	00 00 00 
+  8002fe:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  800302:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800306:	ba 00 00 00 00       	mov    $0x0,%edx
+  80030b:	49 f7 f7             	div    %r15
+  80030e:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  800312:	4c 89 ee             	mov    %r13,%rsi
+  800315:	41 ff d4             	call   *%r12
+}
+  800318:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  80031c:	5b                   	pop    %rbx
+  80031d:	41 5c                	pop    %r12
+  80031f:	41 5d                	pop    %r13
+  800321:	41 5e                	pop    %r14
+  800323:	41 5f                	pop    %r15
+  800325:	5d                   	pop    %rbp
+  800326:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  800327:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80032b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800330:	49 f7 f7             	div    %r15
+  800333:	48 83 ec 08          	sub    $0x8,%rsp
+  800337:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  80033b:	52                   	push   %rdx
+  80033c:	45 0f be c9          	movsbl %r9b,%r9d
+  800340:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  800344:	48 89 c2             	mov    %rax,%rdx
+  800347:	48 b8 a3 02 80 00 00 	movabs $0x8002a3,%rax
+  80034e:	00 00 00 
+  800351:	ff d0                	call   *%rax
+  800353:	48 83 c4 10          	add    $0x10,%rsp
+  800357:	eb 8d                	jmp    8002e6 <print_num+0x43>
+
+0000000000800359 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  800359:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  80035d:	48 8b 06             	mov    (%rsi),%rax
+  800360:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  800364:	73 0a                	jae    800370 <sprintputch+0x17>
+        *state->start++ = ch;
+  800366:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80036a:	48 89 16             	mov    %rdx,(%rsi)
+  80036d:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  800370:	c3                   	ret
+
+0000000000800371 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  800371:	55                   	push   %rbp
+  800372:	48 89 e5             	mov    %rsp,%rbp
+  800375:	48 83 ec 50          	sub    $0x50,%rsp
+  800379:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80037d:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800381:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  800385:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  80038c:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800390:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800394:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800398:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  80039c:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8003a0:	48 b8 ae 03 80 00 00 	movabs $0x8003ae,%rax
+  8003a7:	00 00 00 
+  8003aa:	ff d0                	call   *%rax
+}
+  8003ac:	c9                   	leave
+  8003ad:	c3                   	ret
+
+00000000008003ae <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  8003ae:	55                   	push   %rbp
+  8003af:	48 89 e5             	mov    %rsp,%rbp
+  8003b2:	41 57                	push   %r15
+  8003b4:	41 56                	push   %r14
+  8003b6:	41 55                	push   %r13
+  8003b8:	41 54                	push   %r12
+  8003ba:	53                   	push   %rbx
+  8003bb:	48 83 ec 38          	sub    $0x38,%rsp
+  8003bf:	49 89 fe             	mov    %rdi,%r14
+  8003c2:	49 89 f5             	mov    %rsi,%r13
+  8003c5:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  8003c8:	48 8b 01             	mov    (%rcx),%rax
+  8003cb:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8003cf:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  8003d3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8003d7:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  8003db:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  8003df:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  8003e3:	0f b6 3b             	movzbl (%rbx),%edi
+  8003e6:	40 80 ff 25          	cmp    $0x25,%dil
+  8003ea:	74 18                	je     800404 <vprintfmt+0x56>
+            if (!ch) return;
+  8003ec:	40 84 ff             	test   %dil,%dil
+  8003ef:	0f 84 b1 06 00 00    	je     800aa6 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  8003f5:	40 0f b6 ff          	movzbl %dil,%edi
+  8003f9:	4c 89 ee             	mov    %r13,%rsi
+  8003fc:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  8003ff:	4c 89 e3             	mov    %r12,%rbx
+  800402:	eb db                	jmp    8003df <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  800404:	be 00 00 00 00       	mov    $0x0,%esi
+  800409:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  80040d:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  800412:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800418:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  80041f:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800423:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  800428:	41 0f b6 04 24       	movzbl (%r12),%eax
+  80042d:	88 45 a0             	mov    %al,-0x60(%rbp)
+  800430:	83 e8 23             	sub    $0x23,%eax
+  800433:	3c 57                	cmp    $0x57,%al
+  800435:	0f 87 51 06 00 00    	ja     800a8c <vprintfmt+0x6de>
+  80043b:	0f b6 c0             	movzbl %al,%eax
+  80043e:	48 b9 00 31 80 00 00 	movabs $0x803100,%rcx
+  800445:	00 00 00 
+  800448:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  80044b:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  80044e:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  800452:	eb cf                	jmp    800423 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  800454:	49 89 dc             	mov    %rbx,%r12
+  800457:	be 01 00 00 00       	mov    $0x1,%esi
+  80045c:	eb c5                	jmp    800423 <vprintfmt+0x75>
+            padc = ch;
+  80045e:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  800462:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800465:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800468:	eb b9                	jmp    800423 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  80046a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80046d:	83 f8 2f             	cmp    $0x2f,%eax
+  800470:	77 24                	ja     800496 <vprintfmt+0xe8>
+  800472:	89 c1                	mov    %eax,%ecx
+  800474:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  800478:	83 c0 08             	add    $0x8,%eax
+  80047b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80047e:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  800481:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  800484:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800488:	79 99                	jns    800423 <vprintfmt+0x75>
+                width = precision;
+  80048a:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  80048e:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800494:	eb 8d                	jmp    800423 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800496:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80049a:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  80049e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8004a2:	eb da                	jmp    80047e <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  8004a4:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  8004a9:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8004ad:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  8004b3:	3c 39                	cmp    $0x39,%al
+  8004b5:	77 1c                	ja     8004d3 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  8004b7:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  8004bb:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  8004bf:	0f b6 c0             	movzbl %al,%eax
+  8004c2:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8004c7:	0f b6 03             	movzbl (%rbx),%eax
+  8004ca:	3c 39                	cmp    $0x39,%al
+  8004cc:	76 e9                	jbe    8004b7 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  8004ce:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  8004d1:	eb b1                	jmp    800484 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  8004d3:	49 89 dc             	mov    %rbx,%r12
+  8004d6:	eb ac                	jmp    800484 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  8004d8:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  8004db:	85 c9                	test   %ecx,%ecx
+  8004dd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004e2:	0f 49 c1             	cmovns %ecx,%eax
+  8004e5:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  8004e8:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8004eb:	e9 33 ff ff ff       	jmp    800423 <vprintfmt+0x75>
+            lflag++;
+  8004f0:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  8004f3:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8004f6:	e9 28 ff ff ff       	jmp    800423 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  8004fb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8004fe:	83 f8 2f             	cmp    $0x2f,%eax
+  800501:	77 19                	ja     80051c <vprintfmt+0x16e>
+  800503:	89 c2                	mov    %eax,%edx
+  800505:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800509:	83 c0 08             	add    $0x8,%eax
+  80050c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80050f:	8b 3a                	mov    (%rdx),%edi
+  800511:	4c 89 ee             	mov    %r13,%rsi
+  800514:	41 ff d6             	call   *%r14
+            break;
+  800517:	e9 c3 fe ff ff       	jmp    8003df <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  80051c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800520:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800524:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800528:	eb e5                	jmp    80050f <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  80052a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80052d:	83 f8 2f             	cmp    $0x2f,%eax
+  800530:	77 5a                	ja     80058c <vprintfmt+0x1de>
+  800532:	89 c2                	mov    %eax,%edx
+  800534:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800538:	83 c0 08             	add    $0x8,%eax
+  80053b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  80053e:	8b 02                	mov    (%rdx),%eax
+  800540:	89 c1                	mov    %eax,%ecx
+  800542:	f7 d9                	neg    %ecx
+  800544:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  800547:	83 f9 15             	cmp    $0x15,%ecx
+  80054a:	7f 4e                	jg     80059a <vprintfmt+0x1ec>
+  80054c:	48 63 c1             	movslq %ecx,%rax
+  80054f:	48 ba c0 33 80 00 00 	movabs $0x8033c0,%rdx
+  800556:	00 00 00 
+  800559:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80055d:	48 85 c0             	test   %rax,%rax
+  800560:	74 38                	je     80059a <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  800562:	48 89 c1             	mov    %rax,%rcx
+  800565:	48 ba b9 35 80 00 00 	movabs $0x8035b9,%rdx
+  80056c:	00 00 00 
+  80056f:	4c 89 ee             	mov    %r13,%rsi
+  800572:	4c 89 f7             	mov    %r14,%rdi
+  800575:	b8 00 00 00 00       	mov    $0x0,%eax
+  80057a:	49 b8 71 03 80 00 00 	movabs $0x800371,%r8
+  800581:	00 00 00 
+  800584:	41 ff d0             	call   *%r8
+  800587:	e9 53 fe ff ff       	jmp    8003df <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  80058c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800590:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800594:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800598:	eb a4                	jmp    80053e <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  80059a:	48 ba 61 2f 80 00 00 	movabs $0x802f61,%rdx
+  8005a1:	00 00 00 
+  8005a4:	4c 89 ee             	mov    %r13,%rsi
+  8005a7:	4c 89 f7             	mov    %r14,%rdi
+  8005aa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005af:	49 b8 71 03 80 00 00 	movabs $0x800371,%r8
+  8005b6:	00 00 00 
+  8005b9:	41 ff d0             	call   *%r8
+  8005bc:	e9 1e fe ff ff       	jmp    8003df <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8005c1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8005c4:	83 f8 2f             	cmp    $0x2f,%eax
+  8005c7:	77 6c                	ja     800635 <vprintfmt+0x287>
+  8005c9:	89 c2                	mov    %eax,%edx
+  8005cb:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8005cf:	83 c0 08             	add    $0x8,%eax
+  8005d2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8005d5:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  8005d8:	48 85 d2             	test   %rdx,%rdx
+  8005db:	48 b8 5a 2f 80 00 00 	movabs $0x802f5a,%rax
+  8005e2:	00 00 00 
+  8005e5:	48 0f 45 c2          	cmovne %rdx,%rax
+  8005e9:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  8005ed:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8005f1:	7e 06                	jle    8005f9 <vprintfmt+0x24b>
+  8005f3:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  8005f7:	75 4a                	jne    800643 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8005f9:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8005fd:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  800601:	0f b6 00             	movzbl (%rax),%eax
+  800604:	84 c0                	test   %al,%al
+  800606:	0f 85 9a 00 00 00    	jne    8006a6 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  80060c:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80060f:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  800613:	85 c0                	test   %eax,%eax
+  800615:	0f 8e c4 fd ff ff    	jle    8003df <vprintfmt+0x31>
+  80061b:	4c 89 ee             	mov    %r13,%rsi
+  80061e:	bf 20 00 00 00       	mov    $0x20,%edi
+  800623:	41 ff d6             	call   *%r14
+  800626:	41 83 ec 01          	sub    $0x1,%r12d
+  80062a:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  80062e:	75 eb                	jne    80061b <vprintfmt+0x26d>
+  800630:	e9 aa fd ff ff       	jmp    8003df <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800635:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800639:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80063d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800641:	eb 92                	jmp    8005d5 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  800643:	49 63 f7             	movslq %r15d,%rsi
+  800646:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  80064a:	48 b8 60 0b 80 00 00 	movabs $0x800b60,%rax
+  800651:	00 00 00 
+  800654:	ff d0                	call   *%rax
+  800656:	48 89 c2             	mov    %rax,%rdx
+  800659:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80065c:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  80065e:	8d 70 ff             	lea    -0x1(%rax),%esi
+  800661:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  800664:	85 c0                	test   %eax,%eax
+  800666:	7e 91                	jle    8005f9 <vprintfmt+0x24b>
+  800668:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  80066d:	4c 89 ee             	mov    %r13,%rsi
+  800670:	44 89 e7             	mov    %r12d,%edi
+  800673:	41 ff d6             	call   *%r14
+  800676:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  80067a:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80067d:	83 f8 ff             	cmp    $0xffffffff,%eax
+  800680:	75 eb                	jne    80066d <vprintfmt+0x2bf>
+  800682:	e9 72 ff ff ff       	jmp    8005f9 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800687:	0f b6 f8             	movzbl %al,%edi
+  80068a:	4c 89 ee             	mov    %r13,%rsi
+  80068d:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800690:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800694:	49 83 c4 01          	add    $0x1,%r12
+  800698:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  80069e:	84 c0                	test   %al,%al
+  8006a0:	0f 84 66 ff ff ff    	je     80060c <vprintfmt+0x25e>
+  8006a6:	45 85 ff             	test   %r15d,%r15d
+  8006a9:	78 0a                	js     8006b5 <vprintfmt+0x307>
+  8006ab:	41 83 ef 01          	sub    $0x1,%r15d
+  8006af:	0f 88 57 ff ff ff    	js     80060c <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8006b5:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  8006b9:	74 cc                	je     800687 <vprintfmt+0x2d9>
+  8006bb:	8d 50 e0             	lea    -0x20(%rax),%edx
+  8006be:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  8006c3:	80 fa 5e             	cmp    $0x5e,%dl
+  8006c6:	77 c2                	ja     80068a <vprintfmt+0x2dc>
+  8006c8:	eb bd                	jmp    800687 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  8006ca:	40 84 f6             	test   %sil,%sil
+  8006cd:	75 26                	jne    8006f5 <vprintfmt+0x347>
+    switch (lflag) {
+  8006cf:	85 d2                	test   %edx,%edx
+  8006d1:	74 59                	je     80072c <vprintfmt+0x37e>
+  8006d3:	83 fa 01             	cmp    $0x1,%edx
+  8006d6:	74 7b                	je     800753 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  8006d8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006db:	83 f8 2f             	cmp    $0x2f,%eax
+  8006de:	0f 87 96 00 00 00    	ja     80077a <vprintfmt+0x3cc>
+  8006e4:	89 c2                	mov    %eax,%edx
+  8006e6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8006ea:	83 c0 08             	add    $0x8,%eax
+  8006ed:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8006f0:	4c 8b 22             	mov    (%rdx),%r12
+  8006f3:	eb 17                	jmp    80070c <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  8006f5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006f8:	83 f8 2f             	cmp    $0x2f,%eax
+  8006fb:	77 21                	ja     80071e <vprintfmt+0x370>
+  8006fd:	89 c2                	mov    %eax,%edx
+  8006ff:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800703:	83 c0 08             	add    $0x8,%eax
+  800706:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800709:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  80070c:	4d 85 e4             	test   %r12,%r12
+  80070f:	78 7a                	js     80078b <vprintfmt+0x3dd>
+            num = i;
+  800711:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  800714:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  800719:	e9 50 02 00 00       	jmp    80096e <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  80071e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800722:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800726:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80072a:	eb dd                	jmp    800709 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  80072c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80072f:	83 f8 2f             	cmp    $0x2f,%eax
+  800732:	77 11                	ja     800745 <vprintfmt+0x397>
+  800734:	89 c2                	mov    %eax,%edx
+  800736:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80073a:	83 c0 08             	add    $0x8,%eax
+  80073d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800740:	4c 63 22             	movslq (%rdx),%r12
+  800743:	eb c7                	jmp    80070c <vprintfmt+0x35e>
+  800745:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800749:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80074d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800751:	eb ed                	jmp    800740 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  800753:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800756:	83 f8 2f             	cmp    $0x2f,%eax
+  800759:	77 11                	ja     80076c <vprintfmt+0x3be>
+  80075b:	89 c2                	mov    %eax,%edx
+  80075d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800761:	83 c0 08             	add    $0x8,%eax
+  800764:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800767:	4c 8b 22             	mov    (%rdx),%r12
+  80076a:	eb a0                	jmp    80070c <vprintfmt+0x35e>
+  80076c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800770:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800774:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800778:	eb ed                	jmp    800767 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  80077a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80077e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800782:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800786:	e9 65 ff ff ff       	jmp    8006f0 <vprintfmt+0x342>
+                putch('-', put_arg);
+  80078b:	4c 89 ee             	mov    %r13,%rsi
+  80078e:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800793:	41 ff d6             	call   *%r14
+                i = -i;
+  800796:	49 f7 dc             	neg    %r12
+  800799:	e9 73 ff ff ff       	jmp    800711 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  80079e:	40 84 f6             	test   %sil,%sil
+  8007a1:	75 32                	jne    8007d5 <vprintfmt+0x427>
+    switch (lflag) {
+  8007a3:	85 d2                	test   %edx,%edx
+  8007a5:	74 5d                	je     800804 <vprintfmt+0x456>
+  8007a7:	83 fa 01             	cmp    $0x1,%edx
+  8007aa:	0f 84 82 00 00 00    	je     800832 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  8007b0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007b3:	83 f8 2f             	cmp    $0x2f,%eax
+  8007b6:	0f 87 a5 00 00 00    	ja     800861 <vprintfmt+0x4b3>
+  8007bc:	89 c2                	mov    %eax,%edx
+  8007be:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007c2:	83 c0 08             	add    $0x8,%eax
+  8007c5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007c8:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8007cb:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  8007d0:	e9 99 01 00 00       	jmp    80096e <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8007d5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007d8:	83 f8 2f             	cmp    $0x2f,%eax
+  8007db:	77 19                	ja     8007f6 <vprintfmt+0x448>
+  8007dd:	89 c2                	mov    %eax,%edx
+  8007df:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007e3:	83 c0 08             	add    $0x8,%eax
+  8007e6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007e9:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8007ec:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8007f1:	e9 78 01 00 00       	jmp    80096e <vprintfmt+0x5c0>
+  8007f6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007fa:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007fe:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800802:	eb e5                	jmp    8007e9 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  800804:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800807:	83 f8 2f             	cmp    $0x2f,%eax
+  80080a:	77 18                	ja     800824 <vprintfmt+0x476>
+  80080c:	89 c2                	mov    %eax,%edx
+  80080e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800812:	83 c0 08             	add    $0x8,%eax
+  800815:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800818:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  80081a:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  80081f:	e9 4a 01 00 00       	jmp    80096e <vprintfmt+0x5c0>
+  800824:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800828:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80082c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800830:	eb e6                	jmp    800818 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  800832:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800835:	83 f8 2f             	cmp    $0x2f,%eax
+  800838:	77 19                	ja     800853 <vprintfmt+0x4a5>
+  80083a:	89 c2                	mov    %eax,%edx
+  80083c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800840:	83 c0 08             	add    $0x8,%eax
+  800843:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800846:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800849:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  80084e:	e9 1b 01 00 00       	jmp    80096e <vprintfmt+0x5c0>
+  800853:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800857:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80085b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80085f:	eb e5                	jmp    800846 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  800861:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800865:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800869:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80086d:	e9 56 ff ff ff       	jmp    8007c8 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  800872:	40 84 f6             	test   %sil,%sil
+  800875:	75 2e                	jne    8008a5 <vprintfmt+0x4f7>
+    switch (lflag) {
+  800877:	85 d2                	test   %edx,%edx
+  800879:	74 59                	je     8008d4 <vprintfmt+0x526>
+  80087b:	83 fa 01             	cmp    $0x1,%edx
+  80087e:	74 7f                	je     8008ff <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  800880:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800883:	83 f8 2f             	cmp    $0x2f,%eax
+  800886:	0f 87 9f 00 00 00    	ja     80092b <vprintfmt+0x57d>
+  80088c:	89 c2                	mov    %eax,%edx
+  80088e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800892:	83 c0 08             	add    $0x8,%eax
+  800895:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800898:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  80089b:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  8008a0:	e9 c9 00 00 00       	jmp    80096e <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8008a5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008a8:	83 f8 2f             	cmp    $0x2f,%eax
+  8008ab:	77 19                	ja     8008c6 <vprintfmt+0x518>
+  8008ad:	89 c2                	mov    %eax,%edx
+  8008af:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008b3:	83 c0 08             	add    $0x8,%eax
+  8008b6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008b9:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8008bc:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8008c1:	e9 a8 00 00 00       	jmp    80096e <vprintfmt+0x5c0>
+  8008c6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008ca:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008ce:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008d2:	eb e5                	jmp    8008b9 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  8008d4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008d7:	83 f8 2f             	cmp    $0x2f,%eax
+  8008da:	77 15                	ja     8008f1 <vprintfmt+0x543>
+  8008dc:	89 c2                	mov    %eax,%edx
+  8008de:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008e2:	83 c0 08             	add    $0x8,%eax
+  8008e5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008e8:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  8008ea:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  8008ef:	eb 7d                	jmp    80096e <vprintfmt+0x5c0>
+  8008f1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008f5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008f9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008fd:	eb e9                	jmp    8008e8 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  8008ff:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800902:	83 f8 2f             	cmp    $0x2f,%eax
+  800905:	77 16                	ja     80091d <vprintfmt+0x56f>
+  800907:	89 c2                	mov    %eax,%edx
+  800909:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80090d:	83 c0 08             	add    $0x8,%eax
+  800910:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800913:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800916:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  80091b:	eb 51                	jmp    80096e <vprintfmt+0x5c0>
+  80091d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800921:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800925:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800929:	eb e8                	jmp    800913 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  80092b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80092f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800933:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800937:	e9 5c ff ff ff       	jmp    800898 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  80093c:	4c 89 ee             	mov    %r13,%rsi
+  80093f:	bf 30 00 00 00       	mov    $0x30,%edi
+  800944:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800947:	4c 89 ee             	mov    %r13,%rsi
+  80094a:	bf 78 00 00 00       	mov    $0x78,%edi
+  80094f:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800952:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800955:	83 f8 2f             	cmp    $0x2f,%eax
+  800958:	77 47                	ja     8009a1 <vprintfmt+0x5f3>
+  80095a:	89 c2                	mov    %eax,%edx
+  80095c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800960:	83 c0 08             	add    $0x8,%eax
+  800963:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800966:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800969:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  80096e:	48 83 ec 08          	sub    $0x8,%rsp
+  800972:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800976:	0f 94 c0             	sete   %al
+  800979:	0f b6 c0             	movzbl %al,%eax
+  80097c:	50                   	push   %rax
+  80097d:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800982:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800986:	4c 89 ee             	mov    %r13,%rsi
+  800989:	4c 89 f7             	mov    %r14,%rdi
+  80098c:	48 b8 a3 02 80 00 00 	movabs $0x8002a3,%rax
+  800993:	00 00 00 
+  800996:	ff d0                	call   *%rax
+            break;
+  800998:	48 83 c4 10          	add    $0x10,%rsp
+  80099c:	e9 3e fa ff ff       	jmp    8003df <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  8009a1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009a5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009a9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009ad:	eb b7                	jmp    800966 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  8009af:	40 84 f6             	test   %sil,%sil
+  8009b2:	75 2b                	jne    8009df <vprintfmt+0x631>
+    switch (lflag) {
+  8009b4:	85 d2                	test   %edx,%edx
+  8009b6:	74 56                	je     800a0e <vprintfmt+0x660>
+  8009b8:	83 fa 01             	cmp    $0x1,%edx
+  8009bb:	74 7f                	je     800a3c <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  8009bd:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009c0:	83 f8 2f             	cmp    $0x2f,%eax
+  8009c3:	0f 87 a2 00 00 00    	ja     800a6b <vprintfmt+0x6bd>
+  8009c9:	89 c2                	mov    %eax,%edx
+  8009cb:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009cf:	83 c0 08             	add    $0x8,%eax
+  8009d2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009d5:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8009d8:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  8009dd:	eb 8f                	jmp    80096e <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8009df:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009e2:	83 f8 2f             	cmp    $0x2f,%eax
+  8009e5:	77 19                	ja     800a00 <vprintfmt+0x652>
+  8009e7:	89 c2                	mov    %eax,%edx
+  8009e9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009ed:	83 c0 08             	add    $0x8,%eax
+  8009f0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009f3:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8009f6:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8009fb:	e9 6e ff ff ff       	jmp    80096e <vprintfmt+0x5c0>
+  800a00:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a04:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a08:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a0c:	eb e5                	jmp    8009f3 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800a0e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a11:	83 f8 2f             	cmp    $0x2f,%eax
+  800a14:	77 18                	ja     800a2e <vprintfmt+0x680>
+  800a16:	89 c2                	mov    %eax,%edx
+  800a18:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a1c:	83 c0 08             	add    $0x8,%eax
+  800a1f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a22:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800a24:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800a29:	e9 40 ff ff ff       	jmp    80096e <vprintfmt+0x5c0>
+  800a2e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a32:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a36:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a3a:	eb e6                	jmp    800a22 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800a3c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a3f:	83 f8 2f             	cmp    $0x2f,%eax
+  800a42:	77 19                	ja     800a5d <vprintfmt+0x6af>
+  800a44:	89 c2                	mov    %eax,%edx
+  800a46:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a4a:	83 c0 08             	add    $0x8,%eax
+  800a4d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a50:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800a53:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800a58:	e9 11 ff ff ff       	jmp    80096e <vprintfmt+0x5c0>
+  800a5d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a61:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a65:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a69:	eb e5                	jmp    800a50 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800a6b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a6f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a73:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a77:	e9 59 ff ff ff       	jmp    8009d5 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800a7c:	4c 89 ee             	mov    %r13,%rsi
+  800a7f:	bf 25 00 00 00       	mov    $0x25,%edi
+  800a84:	41 ff d6             	call   *%r14
+            break;
+  800a87:	e9 53 f9 ff ff       	jmp    8003df <vprintfmt+0x31>
+            putch('%', put_arg);
+  800a8c:	4c 89 ee             	mov    %r13,%rsi
+  800a8f:	bf 25 00 00 00       	mov    $0x25,%edi
+  800a94:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800a97:	48 83 eb 01          	sub    $0x1,%rbx
+  800a9b:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800a9f:	75 f6                	jne    800a97 <vprintfmt+0x6e9>
+  800aa1:	e9 39 f9 ff ff       	jmp    8003df <vprintfmt+0x31>
+}
+  800aa6:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800aaa:	5b                   	pop    %rbx
+  800aab:	41 5c                	pop    %r12
+  800aad:	41 5d                	pop    %r13
+  800aaf:	41 5e                	pop    %r14
+  800ab1:	41 5f                	pop    %r15
+  800ab3:	5d                   	pop    %rbp
+  800ab4:	c3                   	ret
+
+0000000000800ab5 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800ab5:	55                   	push   %rbp
+  800ab6:	48 89 e5             	mov    %rsp,%rbp
+  800ab9:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800abd:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800ac1:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800ac6:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800aca:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800ad1:	48 85 ff             	test   %rdi,%rdi
+  800ad4:	74 2b                	je     800b01 <vsnprintf+0x4c>
+  800ad6:	48 85 f6             	test   %rsi,%rsi
+  800ad9:	74 26                	je     800b01 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800adb:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800adf:	48 bf 59 03 80 00 00 	movabs $0x800359,%rdi
+  800ae6:	00 00 00 
+  800ae9:	48 b8 ae 03 80 00 00 	movabs $0x8003ae,%rax
+  800af0:	00 00 00 
+  800af3:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800af5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800af9:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800afc:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800aff:	c9                   	leave
+  800b00:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800b01:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800b06:	eb f7                	jmp    800aff <vsnprintf+0x4a>
+
+0000000000800b08 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800b08:	55                   	push   %rbp
+  800b09:	48 89 e5             	mov    %rsp,%rbp
+  800b0c:	48 83 ec 50          	sub    $0x50,%rsp
+  800b10:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800b14:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800b18:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800b1c:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800b23:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800b27:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b2b:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800b2f:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800b33:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800b37:	48 b8 b5 0a 80 00 00 	movabs $0x800ab5,%rax
+  800b3e:	00 00 00 
+  800b41:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800b43:	c9                   	leave
+  800b44:	c3                   	ret
+
+0000000000800b45 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800b45:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800b48:	74 10                	je     800b5a <strlen+0x15>
+    size_t n = 0;
+  800b4a:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800b4f:	48 83 c0 01          	add    $0x1,%rax
+  800b53:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800b57:	75 f6                	jne    800b4f <strlen+0xa>
+  800b59:	c3                   	ret
+    size_t n = 0;
+  800b5a:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800b5f:	c3                   	ret
+
+0000000000800b60 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800b60:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800b63:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800b68:	48 85 f6             	test   %rsi,%rsi
+  800b6b:	74 11                	je     800b7e <strnlen+0x1e>
+  800b6d:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800b71:	74 0c                	je     800b7f <strnlen+0x1f>
+  800b73:	48 83 c2 01          	add    $0x1,%rdx
+  800b77:	48 39 d0             	cmp    %rdx,%rax
+  800b7a:	75 f1                	jne    800b6d <strnlen+0xd>
+  800b7c:	eb 04                	jmp    800b82 <strnlen+0x22>
+  800b7e:	c3                   	ret
+  800b7f:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800b82:	c3                   	ret
+
+0000000000800b83 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800b83:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800b86:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b8b:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800b8f:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800b92:	48 83 c2 01          	add    $0x1,%rdx
+  800b96:	84 c9                	test   %cl,%cl
+  800b98:	75 f1                	jne    800b8b <strcpy+0x8>
+        ;
+    return res;
+}
+  800b9a:	c3                   	ret
+
+0000000000800b9b <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800b9b:	55                   	push   %rbp
+  800b9c:	48 89 e5             	mov    %rsp,%rbp
+  800b9f:	41 54                	push   %r12
+  800ba1:	53                   	push   %rbx
+  800ba2:	48 89 fb             	mov    %rdi,%rbx
+  800ba5:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800ba8:	48 b8 45 0b 80 00 00 	movabs $0x800b45,%rax
+  800baf:	00 00 00 
+  800bb2:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800bb4:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800bb8:	4c 89 e6             	mov    %r12,%rsi
+  800bbb:	48 b8 83 0b 80 00 00 	movabs $0x800b83,%rax
+  800bc2:	00 00 00 
+  800bc5:	ff d0                	call   *%rax
+    return dst;
+}
+  800bc7:	48 89 d8             	mov    %rbx,%rax
+  800bca:	5b                   	pop    %rbx
+  800bcb:	41 5c                	pop    %r12
+  800bcd:	5d                   	pop    %rbp
+  800bce:	c3                   	ret
+
+0000000000800bcf <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800bcf:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800bd2:	48 85 d2             	test   %rdx,%rdx
+  800bd5:	74 1f                	je     800bf6 <strncpy+0x27>
+  800bd7:	48 01 fa             	add    %rdi,%rdx
+  800bda:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800bdd:	48 83 c1 01          	add    $0x1,%rcx
+  800be1:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800be5:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800be9:	41 80 f8 01          	cmp    $0x1,%r8b
+  800bed:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800bf1:	48 39 ca             	cmp    %rcx,%rdx
+  800bf4:	75 e7                	jne    800bdd <strncpy+0xe>
+    }
+    return ret;
+}
+  800bf6:	c3                   	ret
+
+0000000000800bf7 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800bf7:	48 89 f8             	mov    %rdi,%rax
+  800bfa:	48 85 d2             	test   %rdx,%rdx
+  800bfd:	74 24                	je     800c23 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800bff:	48 83 ea 01          	sub    $0x1,%rdx
+  800c03:	74 1b                	je     800c20 <strlcpy+0x29>
+  800c05:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800c09:	0f b6 16             	movzbl (%rsi),%edx
+  800c0c:	84 d2                	test   %dl,%dl
+  800c0e:	74 10                	je     800c20 <strlcpy+0x29>
+            *dst++ = *src++;
+  800c10:	48 83 c6 01          	add    $0x1,%rsi
+  800c14:	48 83 c0 01          	add    $0x1,%rax
+  800c18:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800c1b:	48 39 c8             	cmp    %rcx,%rax
+  800c1e:	75 e9                	jne    800c09 <strlcpy+0x12>
+        *dst = '\0';
+  800c20:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800c23:	48 29 f8             	sub    %rdi,%rax
+}
+  800c26:	c3                   	ret
+
+0000000000800c27 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800c27:	0f b6 07             	movzbl (%rdi),%eax
+  800c2a:	84 c0                	test   %al,%al
+  800c2c:	74 13                	je     800c41 <strcmp+0x1a>
+  800c2e:	38 06                	cmp    %al,(%rsi)
+  800c30:	75 0f                	jne    800c41 <strcmp+0x1a>
+  800c32:	48 83 c7 01          	add    $0x1,%rdi
+  800c36:	48 83 c6 01          	add    $0x1,%rsi
+  800c3a:	0f b6 07             	movzbl (%rdi),%eax
+  800c3d:	84 c0                	test   %al,%al
+  800c3f:	75 ed                	jne    800c2e <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800c41:	0f b6 c0             	movzbl %al,%eax
+  800c44:	0f b6 16             	movzbl (%rsi),%edx
+  800c47:	29 d0                	sub    %edx,%eax
+}
+  800c49:	c3                   	ret
+
+0000000000800c4a <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800c4a:	48 85 d2             	test   %rdx,%rdx
+  800c4d:	74 1f                	je     800c6e <strncmp+0x24>
+  800c4f:	0f b6 07             	movzbl (%rdi),%eax
+  800c52:	84 c0                	test   %al,%al
+  800c54:	74 1e                	je     800c74 <strncmp+0x2a>
+  800c56:	3a 06                	cmp    (%rsi),%al
+  800c58:	75 1a                	jne    800c74 <strncmp+0x2a>
+  800c5a:	48 83 c7 01          	add    $0x1,%rdi
+  800c5e:	48 83 c6 01          	add    $0x1,%rsi
+  800c62:	48 83 ea 01          	sub    $0x1,%rdx
+  800c66:	75 e7                	jne    800c4f <strncmp+0x5>
+
+    if (!n) return 0;
+  800c68:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c6d:	c3                   	ret
+  800c6e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c73:	c3                   	ret
+  800c74:	48 85 d2             	test   %rdx,%rdx
+  800c77:	74 09                	je     800c82 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800c79:	0f b6 07             	movzbl (%rdi),%eax
+  800c7c:	0f b6 16             	movzbl (%rsi),%edx
+  800c7f:	29 d0                	sub    %edx,%eax
+  800c81:	c3                   	ret
+    if (!n) return 0;
+  800c82:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800c87:	c3                   	ret
+
+0000000000800c88 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800c88:	0f b6 17             	movzbl (%rdi),%edx
+  800c8b:	84 d2                	test   %dl,%dl
+  800c8d:	74 18                	je     800ca7 <strchr+0x1f>
+        if (*str == c) {
+  800c8f:	0f be d2             	movsbl %dl,%edx
+  800c92:	39 f2                	cmp    %esi,%edx
+  800c94:	74 17                	je     800cad <strchr+0x25>
+    for (; *str; str++) {
+  800c96:	48 83 c7 01          	add    $0x1,%rdi
+  800c9a:	0f b6 17             	movzbl (%rdi),%edx
+  800c9d:	84 d2                	test   %dl,%dl
+  800c9f:	75 ee                	jne    800c8f <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800ca1:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ca6:	c3                   	ret
+  800ca7:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cac:	c3                   	ret
+  800cad:	48 89 f8             	mov    %rdi,%rax
+}
+  800cb0:	c3                   	ret
+
+0000000000800cb1 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800cb1:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800cb4:	0f b6 17             	movzbl (%rdi),%edx
+  800cb7:	84 d2                	test   %dl,%dl
+  800cb9:	74 13                	je     800cce <strfind+0x1d>
+  800cbb:	0f be d2             	movsbl %dl,%edx
+  800cbe:	39 f2                	cmp    %esi,%edx
+  800cc0:	74 0b                	je     800ccd <strfind+0x1c>
+  800cc2:	48 83 c0 01          	add    $0x1,%rax
+  800cc6:	0f b6 10             	movzbl (%rax),%edx
+  800cc9:	84 d2                	test   %dl,%dl
+  800ccb:	75 ee                	jne    800cbb <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800ccd:	c3                   	ret
+  800cce:	c3                   	ret
+
+0000000000800ccf <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800ccf:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800cd2:	48 89 f8             	mov    %rdi,%rax
+  800cd5:	48 f7 d8             	neg    %rax
+  800cd8:	83 e0 07             	and    $0x7,%eax
+  800cdb:	49 89 d1             	mov    %rdx,%r9
+  800cde:	49 29 c1             	sub    %rax,%r9
+  800ce1:	78 36                	js     800d19 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800ce3:	40 0f b6 c6          	movzbl %sil,%eax
+  800ce7:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800cee:	01 01 01 
+  800cf1:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800cf5:	40 f6 c7 07          	test   $0x7,%dil
+  800cf9:	75 38                	jne    800d33 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800cfb:	4c 89 c9             	mov    %r9,%rcx
+  800cfe:	48 c1 f9 03          	sar    $0x3,%rcx
+  800d02:	74 0c                	je     800d10 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800d04:	fc                   	cld
+  800d05:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800d08:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800d0c:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800d10:	4d 85 c9             	test   %r9,%r9
+  800d13:	75 45                	jne    800d5a <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800d15:	4c 89 c0             	mov    %r8,%rax
+  800d18:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800d19:	48 85 d2             	test   %rdx,%rdx
+  800d1c:	74 f7                	je     800d15 <memset+0x46>
+  800d1e:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800d21:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800d24:	48 83 c0 01          	add    $0x1,%rax
+  800d28:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  800d2c:	48 39 c2             	cmp    %rax,%rdx
+  800d2f:	75 f3                	jne    800d24 <memset+0x55>
+  800d31:	eb e2                	jmp    800d15 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  800d33:	40 f6 c7 01          	test   $0x1,%dil
+  800d37:	74 06                	je     800d3f <memset+0x70>
+  800d39:	88 07                	mov    %al,(%rdi)
+  800d3b:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800d3f:	40 f6 c7 02          	test   $0x2,%dil
+  800d43:	74 07                	je     800d4c <memset+0x7d>
+  800d45:	66 89 07             	mov    %ax,(%rdi)
+  800d48:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800d4c:	40 f6 c7 04          	test   $0x4,%dil
+  800d50:	74 a9                	je     800cfb <memset+0x2c>
+  800d52:	89 07                	mov    %eax,(%rdi)
+  800d54:	48 83 c7 04          	add    $0x4,%rdi
+  800d58:	eb a1                	jmp    800cfb <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800d5a:	41 f6 c1 04          	test   $0x4,%r9b
+  800d5e:	74 06                	je     800d66 <memset+0x97>
+  800d60:	89 07                	mov    %eax,(%rdi)
+  800d62:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800d66:	41 f6 c1 02          	test   $0x2,%r9b
+  800d6a:	74 07                	je     800d73 <memset+0xa4>
+  800d6c:	66 89 07             	mov    %ax,(%rdi)
+  800d6f:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  800d73:	41 f6 c1 01          	test   $0x1,%r9b
+  800d77:	74 9c                	je     800d15 <memset+0x46>
+  800d79:	88 07                	mov    %al,(%rdi)
+  800d7b:	eb 98                	jmp    800d15 <memset+0x46>
+
+0000000000800d7d <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  800d7d:	48 89 f8             	mov    %rdi,%rax
+  800d80:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  800d83:	48 39 fe             	cmp    %rdi,%rsi
+  800d86:	73 3b                	jae    800dc3 <memmove+0x46>
+  800d88:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  800d8c:	48 39 d7             	cmp    %rdx,%rdi
+  800d8f:	73 32                	jae    800dc3 <memmove+0x46>
+        s += n;
+        d += n;
+  800d91:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800d95:	48 89 d6             	mov    %rdx,%rsi
+  800d98:	48 09 fe             	or     %rdi,%rsi
+  800d9b:	48 09 ce             	or     %rcx,%rsi
+  800d9e:	40 f6 c6 07          	test   $0x7,%sil
+  800da2:	75 12                	jne    800db6 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  800da4:	48 83 ef 08          	sub    $0x8,%rdi
+  800da8:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  800dac:	48 c1 e9 03          	shr    $0x3,%rcx
+  800db0:	fd                   	std
+  800db1:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  800db4:	fc                   	cld
+  800db5:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  800db6:	48 83 ef 01          	sub    $0x1,%rdi
+  800dba:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  800dbe:	fd                   	std
+  800dbf:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  800dc1:	eb f1                	jmp    800db4 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800dc3:	48 89 f2             	mov    %rsi,%rdx
+  800dc6:	48 09 c2             	or     %rax,%rdx
+  800dc9:	48 09 ca             	or     %rcx,%rdx
+  800dcc:	f6 c2 07             	test   $0x7,%dl
+  800dcf:	75 0c                	jne    800ddd <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  800dd1:	48 c1 e9 03          	shr    $0x3,%rcx
+  800dd5:	48 89 c7             	mov    %rax,%rdi
+  800dd8:	fc                   	cld
+  800dd9:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  800ddc:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  800ddd:	48 89 c7             	mov    %rax,%rdi
+  800de0:	fc                   	cld
+  800de1:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  800de3:	c3                   	ret
+
+0000000000800de4 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  800de4:	55                   	push   %rbp
+  800de5:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  800de8:	48 b8 7d 0d 80 00 00 	movabs $0x800d7d,%rax
+  800def:	00 00 00 
+  800df2:	ff d0                	call   *%rax
+}
+  800df4:	5d                   	pop    %rbp
+  800df5:	c3                   	ret
+
+0000000000800df6 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  800df6:	55                   	push   %rbp
+  800df7:	48 89 e5             	mov    %rsp,%rbp
+  800dfa:	41 57                	push   %r15
+  800dfc:	41 56                	push   %r14
+  800dfe:	41 55                	push   %r13
+  800e00:	41 54                	push   %r12
+  800e02:	53                   	push   %rbx
+  800e03:	48 83 ec 08          	sub    $0x8,%rsp
+  800e07:	49 89 fe             	mov    %rdi,%r14
+  800e0a:	49 89 f7             	mov    %rsi,%r15
+  800e0d:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  800e10:	48 89 f7             	mov    %rsi,%rdi
+  800e13:	48 b8 45 0b 80 00 00 	movabs $0x800b45,%rax
+  800e1a:	00 00 00 
+  800e1d:	ff d0                	call   *%rax
+  800e1f:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  800e22:	48 89 de             	mov    %rbx,%rsi
+  800e25:	4c 89 f7             	mov    %r14,%rdi
+  800e28:	48 b8 60 0b 80 00 00 	movabs $0x800b60,%rax
+  800e2f:	00 00 00 
+  800e32:	ff d0                	call   *%rax
+  800e34:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  800e37:	48 39 c3             	cmp    %rax,%rbx
+  800e3a:	74 36                	je     800e72 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  800e3c:	48 89 d8             	mov    %rbx,%rax
+  800e3f:	4c 29 e8             	sub    %r13,%rax
+  800e42:	49 39 c4             	cmp    %rax,%r12
+  800e45:	73 31                	jae    800e78 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  800e47:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  800e4c:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800e50:	4c 89 fe             	mov    %r15,%rsi
+  800e53:	48 b8 e4 0d 80 00 00 	movabs $0x800de4,%rax
+  800e5a:	00 00 00 
+  800e5d:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  800e5f:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  800e63:	48 83 c4 08          	add    $0x8,%rsp
+  800e67:	5b                   	pop    %rbx
+  800e68:	41 5c                	pop    %r12
+  800e6a:	41 5d                	pop    %r13
+  800e6c:	41 5e                	pop    %r14
+  800e6e:	41 5f                	pop    %r15
+  800e70:	5d                   	pop    %rbp
+  800e71:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  800e72:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800e76:	eb eb                	jmp    800e63 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  800e78:	48 83 eb 01          	sub    $0x1,%rbx
+  800e7c:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800e80:	48 89 da             	mov    %rbx,%rdx
+  800e83:	4c 89 fe             	mov    %r15,%rsi
+  800e86:	48 b8 e4 0d 80 00 00 	movabs $0x800de4,%rax
+  800e8d:	00 00 00 
+  800e90:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  800e92:	49 01 de             	add    %rbx,%r14
+  800e95:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  800e9a:	eb c3                	jmp    800e5f <strlcat+0x69>
+
+0000000000800e9c <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  800e9c:	48 85 d2             	test   %rdx,%rdx
+  800e9f:	74 2d                	je     800ece <memcmp+0x32>
+  800ea1:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  800ea6:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800eaa:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  800eaf:	44 38 c1             	cmp    %r8b,%cl
+  800eb2:	75 0f                	jne    800ec3 <memcmp+0x27>
+    while (n-- > 0) {
+  800eb4:	48 83 c0 01          	add    $0x1,%rax
+  800eb8:	48 39 c2             	cmp    %rax,%rdx
+  800ebb:	75 e9                	jne    800ea6 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  800ebd:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ec2:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  800ec3:	0f b6 c1             	movzbl %cl,%eax
+  800ec6:	45 0f b6 c0          	movzbl %r8b,%r8d
+  800eca:	44 29 c0             	sub    %r8d,%eax
+  800ecd:	c3                   	ret
+    return 0;
+  800ece:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800ed3:	c3                   	ret
+
+0000000000800ed4 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  800ed4:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  800ed8:	48 39 c7             	cmp    %rax,%rdi
+  800edb:	73 0f                	jae    800eec <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  800edd:	40 38 37             	cmp    %sil,(%rdi)
+  800ee0:	74 0e                	je     800ef0 <memfind+0x1c>
+    for (; src < end; src++) {
+  800ee2:	48 83 c7 01          	add    $0x1,%rdi
+  800ee6:	48 39 f8             	cmp    %rdi,%rax
+  800ee9:	75 f2                	jne    800edd <memfind+0x9>
+  800eeb:	c3                   	ret
+  800eec:	48 89 f8             	mov    %rdi,%rax
+  800eef:	c3                   	ret
+  800ef0:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  800ef3:	c3                   	ret
+
+0000000000800ef4 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  800ef4:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  800ef7:	0f b6 37             	movzbl (%rdi),%esi
+  800efa:	40 80 fe 20          	cmp    $0x20,%sil
+  800efe:	74 06                	je     800f06 <strtol+0x12>
+  800f00:	40 80 fe 09          	cmp    $0x9,%sil
+  800f04:	75 13                	jne    800f19 <strtol+0x25>
+  800f06:	48 83 c7 01          	add    $0x1,%rdi
+  800f0a:	0f b6 37             	movzbl (%rdi),%esi
+  800f0d:	40 80 fe 20          	cmp    $0x20,%sil
+  800f11:	74 f3                	je     800f06 <strtol+0x12>
+  800f13:	40 80 fe 09          	cmp    $0x9,%sil
+  800f17:	74 ed                	je     800f06 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  800f19:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  800f1c:	83 e0 fd             	and    $0xfffffffd,%eax
+  800f1f:	3c 01                	cmp    $0x1,%al
+  800f21:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  800f25:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  800f2b:	75 0f                	jne    800f3c <strtol+0x48>
+  800f2d:	80 3f 30             	cmpb   $0x30,(%rdi)
+  800f30:	74 14                	je     800f46 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  800f32:	85 d2                	test   %edx,%edx
+  800f34:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800f39:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  800f3c:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  800f41:	4c 63 ca             	movslq %edx,%r9
+  800f44:	eb 36                	jmp    800f7c <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  800f46:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  800f4a:	74 0f                	je     800f5b <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  800f4c:	85 d2                	test   %edx,%edx
+  800f4e:	75 ec                	jne    800f3c <strtol+0x48>
+        s++;
+  800f50:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  800f54:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  800f59:	eb e1                	jmp    800f3c <strtol+0x48>
+        s += 2;
+  800f5b:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  800f5f:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  800f64:	eb d6                	jmp    800f3c <strtol+0x48>
+            dig -= '0';
+  800f66:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  800f69:	44 0f b6 c1          	movzbl %cl,%r8d
+  800f6d:	41 39 d0             	cmp    %edx,%r8d
+  800f70:	7d 21                	jge    800f93 <strtol+0x9f>
+        val = val * base + dig;
+  800f72:	49 0f af c1          	imul   %r9,%rax
+  800f76:	0f b6 c9             	movzbl %cl,%ecx
+  800f79:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  800f7c:	48 83 c7 01          	add    $0x1,%rdi
+  800f80:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  800f84:	80 f9 39             	cmp    $0x39,%cl
+  800f87:	76 dd                	jbe    800f66 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  800f89:	80 f9 7b             	cmp    $0x7b,%cl
+  800f8c:	77 05                	ja     800f93 <strtol+0x9f>
+            dig -= 'a' - 10;
+  800f8e:	83 e9 57             	sub    $0x57,%ecx
+  800f91:	eb d6                	jmp    800f69 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  800f93:	4d 85 d2             	test   %r10,%r10
+  800f96:	74 03                	je     800f9b <strtol+0xa7>
+  800f98:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  800f9b:	48 89 c2             	mov    %rax,%rdx
+  800f9e:	48 f7 da             	neg    %rdx
+  800fa1:	40 80 fe 2d          	cmp    $0x2d,%sil
+  800fa5:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  800fa9:	c3                   	ret
+
+0000000000800faa <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  800faa:	55                   	push   %rbp
+  800fab:	48 89 e5             	mov    %rsp,%rbp
+  800fae:	53                   	push   %rbx
+  800faf:	48 89 fa             	mov    %rdi,%rdx
+  800fb2:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  800fb5:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800fba:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fbf:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800fc4:	be 00 00 00 00       	mov    $0x0,%esi
+  800fc9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800fcf:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  800fd1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800fd5:	c9                   	leave
+  800fd6:	c3                   	ret
+
+0000000000800fd7 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  800fd7:	55                   	push   %rbp
+  800fd8:	48 89 e5             	mov    %rsp,%rbp
+  800fdb:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  800fdc:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800fe1:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fe6:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800feb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ff0:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800ff5:	be 00 00 00 00       	mov    $0x0,%esi
+  800ffa:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801000:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  801002:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801006:	c9                   	leave
+  801007:	c3                   	ret
+
+0000000000801008 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  801008:	55                   	push   %rbp
+  801009:	48 89 e5             	mov    %rsp,%rbp
+  80100c:	53                   	push   %rbx
+  80100d:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  801011:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801014:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801019:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80101e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801023:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801028:	be 00 00 00 00       	mov    $0x0,%esi
+  80102d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801033:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801035:	48 85 c0             	test   %rax,%rax
+  801038:	7f 06                	jg     801040 <sys_env_destroy+0x38>
+}
+  80103a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80103e:	c9                   	leave
+  80103f:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801040:	49 89 c0             	mov    %rax,%r8
+  801043:	b9 03 00 00 00       	mov    $0x3,%ecx
+  801048:	48 ba 90 34 80 00 00 	movabs $0x803490,%rdx
+  80104f:	00 00 00 
+  801052:	be 26 00 00 00       	mov    $0x26,%esi
+  801057:	48 bf af 34 80 00 00 	movabs $0x8034af,%rdi
+  80105e:	00 00 00 
+  801061:	b8 00 00 00 00       	mov    $0x0,%eax
+  801066:	49 b9 28 2c 80 00 00 	movabs $0x802c28,%r9
+  80106d:	00 00 00 
+  801070:	41 ff d1             	call   *%r9
+
+0000000000801073 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  801073:	55                   	push   %rbp
+  801074:	48 89 e5             	mov    %rsp,%rbp
+  801077:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801078:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80107d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801082:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801087:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80108c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801091:	be 00 00 00 00       	mov    $0x0,%esi
+  801096:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80109c:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  80109e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8010a2:	c9                   	leave
+  8010a3:	c3                   	ret
+
+00000000008010a4 <sys_yield>:
+
+void
+sys_yield(void) {
+  8010a4:	55                   	push   %rbp
+  8010a5:	48 89 e5             	mov    %rsp,%rbp
+  8010a8:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8010a9:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8010ae:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010b3:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8010b8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010bd:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8010c2:	be 00 00 00 00       	mov    $0x0,%esi
+  8010c7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8010cd:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  8010cf:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8010d3:	c9                   	leave
+  8010d4:	c3                   	ret
+
+00000000008010d5 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  8010d5:	55                   	push   %rbp
+  8010d6:	48 89 e5             	mov    %rsp,%rbp
+  8010d9:	53                   	push   %rbx
+  8010da:	48 89 fa             	mov    %rdi,%rdx
+  8010dd:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8010e0:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8010e5:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  8010ec:	00 00 00 
+  8010ef:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8010f4:	be 00 00 00 00       	mov    $0x0,%esi
+  8010f9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8010ff:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  801101:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801105:	c9                   	leave
+  801106:	c3                   	ret
+
+0000000000801107 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  801107:	55                   	push   %rbp
+  801108:	48 89 e5             	mov    %rsp,%rbp
+  80110b:	53                   	push   %rbx
+  80110c:	49 89 f8             	mov    %rdi,%r8
+  80110f:	48 89 d3             	mov    %rdx,%rbx
+  801112:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801115:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80111a:	4c 89 c2             	mov    %r8,%rdx
+  80111d:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801120:	be 00 00 00 00       	mov    $0x0,%esi
+  801125:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80112b:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  80112d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801131:	c9                   	leave
+  801132:	c3                   	ret
+
+0000000000801133 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  801133:	55                   	push   %rbp
+  801134:	48 89 e5             	mov    %rsp,%rbp
+  801137:	53                   	push   %rbx
+  801138:	48 83 ec 08          	sub    $0x8,%rsp
+  80113c:	89 f8                	mov    %edi,%eax
+  80113e:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  801141:	48 63 f9             	movslq %ecx,%rdi
+  801144:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801147:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80114c:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80114f:	be 00 00 00 00       	mov    $0x0,%esi
+  801154:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80115a:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80115c:	48 85 c0             	test   %rax,%rax
+  80115f:	7f 06                	jg     801167 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  801161:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801165:	c9                   	leave
+  801166:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801167:	49 89 c0             	mov    %rax,%r8
+  80116a:	b9 04 00 00 00       	mov    $0x4,%ecx
+  80116f:	48 ba 90 34 80 00 00 	movabs $0x803490,%rdx
+  801176:	00 00 00 
+  801179:	be 26 00 00 00       	mov    $0x26,%esi
+  80117e:	48 bf af 34 80 00 00 	movabs $0x8034af,%rdi
+  801185:	00 00 00 
+  801188:	b8 00 00 00 00       	mov    $0x0,%eax
+  80118d:	49 b9 28 2c 80 00 00 	movabs $0x802c28,%r9
+  801194:	00 00 00 
+  801197:	41 ff d1             	call   *%r9
+
+000000000080119a <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  80119a:	55                   	push   %rbp
+  80119b:	48 89 e5             	mov    %rsp,%rbp
+  80119e:	53                   	push   %rbx
+  80119f:	48 83 ec 08          	sub    $0x8,%rsp
+  8011a3:	89 f8                	mov    %edi,%eax
+  8011a5:	49 89 f2             	mov    %rsi,%r10
+  8011a8:	48 89 cf             	mov    %rcx,%rdi
+  8011ab:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  8011ae:	48 63 da             	movslq %edx,%rbx
+  8011b1:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8011b4:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8011b9:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8011bc:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  8011bf:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8011c1:	48 85 c0             	test   %rax,%rax
+  8011c4:	7f 06                	jg     8011cc <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8011c6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8011ca:	c9                   	leave
+  8011cb:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8011cc:	49 89 c0             	mov    %rax,%r8
+  8011cf:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8011d4:	48 ba 90 34 80 00 00 	movabs $0x803490,%rdx
+  8011db:	00 00 00 
+  8011de:	be 26 00 00 00       	mov    $0x26,%esi
+  8011e3:	48 bf af 34 80 00 00 	movabs $0x8034af,%rdi
+  8011ea:	00 00 00 
+  8011ed:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011f2:	49 b9 28 2c 80 00 00 	movabs $0x802c28,%r9
+  8011f9:	00 00 00 
+  8011fc:	41 ff d1             	call   *%r9
+
+00000000008011ff <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  8011ff:	55                   	push   %rbp
+  801200:	48 89 e5             	mov    %rsp,%rbp
+  801203:	53                   	push   %rbx
+  801204:	48 83 ec 08          	sub    $0x8,%rsp
+  801208:	48 89 f1             	mov    %rsi,%rcx
+  80120b:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  80120e:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801211:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801216:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80121b:	be 00 00 00 00       	mov    $0x0,%esi
+  801220:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801226:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801228:	48 85 c0             	test   %rax,%rax
+  80122b:	7f 06                	jg     801233 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  80122d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801231:	c9                   	leave
+  801232:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801233:	49 89 c0             	mov    %rax,%r8
+  801236:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80123b:	48 ba 90 34 80 00 00 	movabs $0x803490,%rdx
+  801242:	00 00 00 
+  801245:	be 26 00 00 00       	mov    $0x26,%esi
+  80124a:	48 bf af 34 80 00 00 	movabs $0x8034af,%rdi
+  801251:	00 00 00 
+  801254:	b8 00 00 00 00       	mov    $0x0,%eax
+  801259:	49 b9 28 2c 80 00 00 	movabs $0x802c28,%r9
+  801260:	00 00 00 
+  801263:	41 ff d1             	call   *%r9
+
+0000000000801266 <sys_region_batch>:
+
+int
+sys_region_batch(const struct RegionOp *ops, size_t count) {
+  801266:	55                   	push   %rbp
+  801267:	48 89 e5             	mov    %rsp,%rbp
+  80126a:	53                   	push   %rbx
+  80126b:	48 83 ec 08          	sub    $0x8,%rsp
+  80126f:	48 89 fa             	mov    %rdi,%rdx
+  801272:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801275:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80127a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80127f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801284:	be 00 00 00 00       	mov    $0x0,%esi
+  801289:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80128f:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801291:	48 85 c0             	test   %rax,%rax
+  801294:	7f 06                	jg     80129c <sys_region_batch+0x36>
+        else
+            platform_asan_unpoison(va, ops[i].size);
+    }
+#endif
+    return res;
+}
+  801296:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80129a:	c9                   	leave
+  80129b:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80129c:	49 89 c0             	mov    %rax,%r8
+  80129f:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  8012a4:	48 ba 90 34 80 00 00 	movabs $0x803490,%rdx
+  8012ab:	00 00 00 
+  8012ae:	be 26 00 00 00       	mov    $0x26,%esi
+  8012b3:	48 bf af 34 80 00 00 	movabs $0x8034af,%rdi
+  8012ba:	00 00 00 
+  8012bd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012c2:	49 b9 28 2c 80 00 00 	movabs $0x802c28,%r9
+  8012c9:	00 00 00 
+  8012cc:	41 ff d1             	call   *%r9
+
+00000000008012cf <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  8012cf:	55                   	push   %rbp
+  8012d0:	48 89 e5             	mov    %rsp,%rbp
+  8012d3:	53                   	push   %rbx
+  8012d4:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  8012d8:	48 63 ce             	movslq %esi,%rcx
+  8012db:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8012de:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8012e3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012e8:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012ed:	be 00 00 00 00       	mov    $0x0,%esi
+  8012f2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8012f8:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8012fa:	48 85 c0             	test   %rax,%rax
+  8012fd:	7f 06                	jg     801305 <sys_env_set_status+0x36>
+}
+  8012ff:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801303:	c9                   	leave
+  801304:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801305:	49 89 c0             	mov    %rax,%r8
+  801308:	b9 09 00 00 00       	mov    $0x9,%ecx
+  80130d:	48 ba 90 34 80 00 00 	movabs $0x803490,%rdx
+  801314:	00 00 00 
+  801317:	be 26 00 00 00       	mov    $0x26,%esi
+  80131c:	48 bf af 34 80 00 00 	movabs $0x8034af,%rdi
+  801323:	00 00 00 
+  801326:	b8 00 00 00 00       	mov    $0x0,%eax
+  80132b:	49 b9 28 2c 80 00 00 	movabs $0x802c28,%r9
+  801332:	00 00 00 
+  801335:	41 ff d1             	call   *%r9
+
+0000000000801338 <sys_env_set_weight>:
+
+int
+sys_env_set_weight(envid_t envid, uint32_t weight) {
+  801338:	55                   	push   %rbp
+  801339:	48 89 e5             	mov    %rsp,%rbp
+  80133c:	53                   	push   %rbx
+  80133d:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_weight, 1, envid, weight, 0, 0, 0, 0);
+  801341:	89 f1                	mov    %esi,%ecx
+  801343:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801346:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80134b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801350:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801355:	be 00 00 00 00       	mov    $0x0,%esi
+  80135a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801360:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801362:	48 85 c0             	test   %rax,%rax
+  801365:	7f 06                	jg     80136d <sys_env_set_weight+0x35>
+}
+  801367:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80136b:	c9                   	leave
+  80136c:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80136d:	49 89 c0             	mov    %rax,%r8
+  801370:	b9 10 00 00 00       	mov    $0x10,%ecx
+  801375:	48 ba 90 34 80 00 00 	movabs $0x803490,%rdx
+  80137c:	00 00 00 
+  80137f:	be 26 00 00 00       	mov    $0x26,%esi
+  801384:	48 bf af 34 80 00 00 	movabs $0x8034af,%rdi
+  80138b:	00 00 00 
+  80138e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801393:	49 b9 28 2c 80 00 00 	movabs $0x802c28,%r9
+  80139a:	00 00 00 
+  80139d:	41 ff d1             	call   *%r9
+
+00000000008013a0 <sys_env_set_rt>:
+
+int
+sys_env_set_rt(envid_t envid, uint64_t period, uint64_t budget, uint64_t deadline) {
+  8013a0:	55                   	push   %rbp
+  8013a1:	48 89 e5             	mov    %rsp,%rbp
+  8013a4:	53                   	push   %rbx
+  8013a5:	48 83 ec 08          	sub    $0x8,%rsp
+  8013a9:	89 f8                	mov    %edi,%eax
+  8013ab:	48 89 d3             	mov    %rdx,%rbx
+  8013ae:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_env_set_rt, 1, envid, period, budget, deadline, 0, 0);
+  8013b1:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8013b4:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8013b9:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013bc:	be 00 00 00 00       	mov    $0x0,%esi
+  8013c1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013c7:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8013c9:	48 85 c0             	test   %rax,%rax
+  8013cc:	7f 06                	jg     8013d4 <sys_env_set_rt+0x34>
+}
+  8013ce:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013d2:	c9                   	leave
+  8013d3:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8013d4:	49 89 c0             	mov    %rax,%r8
+  8013d7:	b9 11 00 00 00       	mov    $0x11,%ecx
+  8013dc:	48 ba 90 34 80 00 00 	movabs $0x803490,%rdx
+  8013e3:	00 00 00 
+  8013e6:	be 26 00 00 00       	mov    $0x26,%esi
+  8013eb:	48 bf af 34 80 00 00 	movabs $0x8034af,%rdi
+  8013f2:	00 00 00 
+  8013f5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013fa:	49 b9 28 2c 80 00 00 	movabs $0x802c28,%r9
+  801401:	00 00 00 
+  801404:	41 ff d1             	call   *%r9
+
+0000000000801407 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  801407:	55                   	push   %rbp
+  801408:	48 89 e5             	mov    %rsp,%rbp
+  80140b:	53                   	push   %rbx
+  80140c:	48 83 ec 08          	sub    $0x8,%rsp
+  801410:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  801413:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801416:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80141b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801420:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801425:	be 00 00 00 00       	mov    $0x0,%esi
+  80142a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801430:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801432:	48 85 c0             	test   %rax,%rax
+  801435:	7f 06                	jg     80143d <sys_env_set_trapframe+0x36>
+}
+  801437:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80143b:	c9                   	leave
+  80143c:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80143d:	49 89 c0             	mov    %rax,%r8
+  801440:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  801445:	48 ba 90 34 80 00 00 	movabs $0x803490,%rdx
+  80144c:	00 00 00 
+  80144f:	be 26 00 00 00       	mov    $0x26,%esi
+  801454:	48 bf af 34 80 00 00 	movabs $0x8034af,%rdi
+  80145b:	00 00 00 
+  80145e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801463:	49 b9 28 2c 80 00 00 	movabs $0x802c28,%r9
+  80146a:	00 00 00 
+  80146d:	41 ff d1             	call   *%r9
+
+0000000000801470 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  801470:	55                   	push   %rbp
+  801471:	48 89 e5             	mov    %rsp,%rbp
+  801474:	53                   	push   %rbx
+  801475:	48 83 ec 08          	sub    $0x8,%rsp
+  801479:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  80147c:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80147f:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801484:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801489:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80148e:	be 00 00 00 00       	mov    $0x0,%esi
+  801493:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801499:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80149b:	48 85 c0             	test   %rax,%rax
+  80149e:	7f 06                	jg     8014a6 <sys_env_set_pgfault_upcall+0x36>
+}
+  8014a0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014a4:	c9                   	leave
+  8014a5:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8014a6:	49 89 c0             	mov    %rax,%r8
+  8014a9:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  8014ae:	48 ba 90 34 80 00 00 	movabs $0x803490,%rdx
+  8014b5:	00 00 00 
+  8014b8:	be 26 00 00 00       	mov    $0x26,%esi
+  8014bd:	48 bf af 34 80 00 00 	movabs $0x8034af,%rdi
+  8014c4:	00 00 00 
+  8014c7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014cc:	49 b9 28 2c 80 00 00 	movabs $0x802c28,%r9
+  8014d3:	00 00 00 
+  8014d6:	41 ff d1             	call   *%r9
+
+00000000008014d9 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  8014d9:	55                   	push   %rbp
+  8014da:	48 89 e5             	mov    %rsp,%rbp
+  8014dd:	53                   	push   %rbx
+  8014de:	89 f8                	mov    %edi,%eax
+  8014e0:	49 89 f1             	mov    %rsi,%r9
+  8014e3:	48 89 d3             	mov    %rdx,%rbx
+  8014e6:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  8014e9:	49 63 f0             	movslq %r8d,%rsi
+  8014ec:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8014ef:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8014f4:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014f7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014fd:	cd 30                	int    $0x30
+}
+  8014ff:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801503:	c9                   	leave
+  801504:	c3                   	ret
+
+0000000000801505 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  801505:	55                   	push   %rbp
+  801506:	48 89 e5             	mov    %rsp,%rbp
+  801509:	53                   	push   %rbx
+  80150a:	48 83 ec 08          	sub    $0x8,%rsp
+  80150e:	48 89 fa             	mov    %rdi,%rdx
+  801511:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801514:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801519:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80151e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801523:	be 00 00 00 00       	mov    $0x0,%esi
+  801528:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80152e:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801530:	48 85 c0             	test   %rax,%rax
+  801533:	7f 06                	jg     80153b <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801535:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801539:	c9                   	leave
+  80153a:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80153b:	49 89 c0             	mov    %rax,%r8
+  80153e:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  801543:	48 ba 90 34 80 00 00 	movabs $0x803490,%rdx
+  80154a:	00 00 00 
+  80154d:	be 26 00 00 00       	mov    $0x26,%esi
+  801552:	48 bf af 34 80 00 00 	movabs $0x8034af,%rdi
+  801559:	00 00 00 
+  80155c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801561:	49 b9 28 2c 80 00 00 	movabs $0x802c28,%r9
+  801568:	00 00 00 
+  80156b:	41 ff d1             	call   *%r9
+
+000000000080156e <fork>:
+ * Hint:
+ *   Use sys_map_region, it can perform address space copying in one call
+ *   Remember to fix "thisenv" in the child process.
+ */
+envid_t
+fork(void) {
+  80156e:	55                   	push   %rbp
+  80156f:	48 89 e5             	mov    %rsp,%rbp
+  801572:	41 55                	push   %r13
+  801574:	41 54                	push   %r12
+  801576:	53                   	push   %rbx
+  801577:	48 83 ec 08          	sub    $0x8,%rsp
+
+/* This must be inlined. Exercise for reader: why? */
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+    envid_t ret;
+    asm volatile("int %2"
+  80157b:	b8 08 00 00 00       	mov    $0x8,%eax
+  801580:	cd 30                	int    $0x30
+  801582:	41 89 c5             	mov    %eax,%r13d
+    // LAB 9: Your code here
+
+    envid_t child_id = sys_exofork();
+    if (child_id < 0) {
+  801585:	85 c0                	test   %eax,%eax
+  801587:	0f 88 ae 00 00 00    	js     80163b <fork+0xcd>
+  80158d:	89 c3                	mov    %eax,%ebx
+        return child_id;
+    }
+    if (child_id == 0) {
+  80158f:	0f 84 b4 00 00 00    	je     801649 <fork+0xdb>
+        thisenv = &envs[ENVX(sys_getenvid())];
+        return 0;
+    }
+    int res = sys_map_region(0, NULL, child_id, NULL, MAX_USER_ADDRESS, PROT_ALL | PROT_LAZY | PROT_COMBINE);
+  801595:	41 b9 df 01 00 00    	mov    $0x1df,%r9d
+  80159b:	49 b8 00 00 00 00 80 	movabs $0x8000000000,%r8
+  8015a2:	00 00 00 
+  8015a5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8015aa:	89 c2                	mov    %eax,%edx
+  8015ac:	be 00 00 00 00       	mov    $0x0,%esi
+  8015b1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8015b6:	48 b8 9a 11 80 00 00 	movabs $0x80119a,%rax
+  8015bd:	00 00 00 
+  8015c0:	ff d0                	call   *%rax
+  8015c2:	41 89 c4             	mov    %eax,%r12d
+    if (res < 0) {
+  8015c5:	85 c0                	test   %eax,%eax
+  8015c7:	78 5d                	js     801626 <fork+0xb8>
+        goto error;
+    }
+    res = sys_env_set_pgfault_upcall(child_id, envs[ENVX(sys_getenvid())].env_pgfault_upcall);
+  8015c9:	48 b8 73 10 80 00 00 	movabs $0x801073,%rax
+  8015d0:	00 00 00 
+  8015d3:	ff d0                	call   *%rax
+  8015d5:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8015da:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+  8015e1:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8015e8:	00 00 00 
+  8015eb:	48 01 d0             	add    %rdx,%rax
+  8015ee:	48 8b b0 88 01 00 00 	mov    0x188(%rax),%rsi
+  8015f5:	44 89 ef             	mov    %r13d,%edi
+  8015f8:	48 b8 70 14 80 00 00 	movabs $0x801470,%rax
+  8015ff:	00 00 00 
+  801602:	ff d0                	call   *%rax
+  801604:	41 89 c4             	mov    %eax,%r12d
+    if (res < 0) {
+  801607:	85 c0                	test   %eax,%eax
+  801609:	78 1b                	js     801626 <fork+0xb8>
+        goto error;
+    }
+    res = sys_env_set_status(child_id, ENV_RUNNABLE);
+  80160b:	be 02 00 00 00       	mov    $0x2,%esi
+  801610:	44 89 ef             	mov    %r13d,%edi
+  801613:	48 b8 cf 12 80 00 00 	movabs $0x8012cf,%rax
+  80161a:	00 00 00 
+  80161d:	ff d0                	call   *%rax
+  80161f:	41 89 c4             	mov    %eax,%r12d
+    if (res < 0) {
+  801622:	85 c0                	test   %eax,%eax
+  801624:	79 15                	jns    80163b <fork+0xcd>
+        goto error;
+    }
+    return child_id;
+error:
+    ;
+    int res2 = sys_env_destroy(child_id);
+  801626:	89 df                	mov    %ebx,%edi
+  801628:	48 b8 08 10 80 00 00 	movabs $0x801008,%rax
+  80162f:	00 00 00 
+  801632:	ff d0                	call   *%rax
+    if (res2 < 0) {
+  801634:	85 c0                	test   %eax,%eax
+  801636:	78 42                	js     80167a <fork+0x10c>
+        panic("Fork double fault");
+    }
+    return res;
+  801638:	45 89 e5             	mov    %r12d,%r13d
+}
+  80163b:	44 89 e8             	mov    %r13d,%eax
+  80163e:	48 83 c4 08          	add    $0x8,%rsp
+  801642:	5b                   	pop    %rbx
+  801643:	41 5c                	pop    %r12
+  801645:	41 5d                	pop    %r13
+  801647:	5d                   	pop    %rbp
+  801648:	c3                   	ret
+        thisenv = &envs[ENVX(sys_getenvid())];
+  801649:	48 b8 73 10 80 00 00 	movabs $0x801073,%rax
+  801650:	00 00 00 
+  801653:	ff d0                	call   *%rax
+  801655:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80165a:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+  801661:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  801668:	00 00 00 
+  80166b:	48 01 d0             	add    %rdx,%rax
+  80166e:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  801675:	00 00 00 
+        return 0;
+  801678:	eb c1                	jmp    80163b <fork+0xcd>
+        panic("Fork double fault");
+  80167a:	48 ba bd 34 80 00 00 	movabs $0x8034bd,%rdx
+  801681:	00 00 00 
+  801684:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801689:	48 bf cf 34 80 00 00 	movabs $0x8034cf,%rdi
+  801690:	00 00 00 
+  801693:	b8 00 00 00 00       	mov    $0x0,%eax
+  801698:	48 b9 28 2c 80 00 00 	movabs $0x802c28,%rcx
+  80169f:	00 00 00 
+  8016a2:	ff d1                	call   *%rcx
+
+00000000008016a4 <sfork>:
+
+envid_t
+sfork() {
+  8016a4:	55                   	push   %rbp
+  8016a5:	48 89 e5             	mov    %rsp,%rbp
+    panic("sfork() is not implemented");
+  8016a8:	48 ba da 34 80 00 00 	movabs $0x8034da,%rdx
+  8016af:	00 00 00 
+  8016b2:	be 36 00 00 00       	mov    $0x36,%esi
+  8016b7:	48 bf cf 34 80 00 00 	movabs $0x8034cf,%rdi
+  8016be:	00 00 00 
+  8016c1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016c6:	48 b9 28 2c 80 00 00 	movabs $0x802c28,%rcx
+  8016cd:	00 00 00 
+  8016d0:	ff d1                	call   *%rcx
+
+00000000008016d2 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8016d2:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8016d9:	ff ff ff 
+  8016dc:	48 01 f8             	add    %rdi,%rax
+  8016df:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  8016e3:	c3                   	ret
+
+00000000008016e4 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8016e4:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8016eb:	ff ff ff 
+  8016ee:	48 01 f8             	add    %rdi,%rax
+  8016f1:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  8016f5:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  8016fb:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  8016ff:	c3                   	ret
+
+0000000000801700 <fd_alloc_from>:
+}
+
+/* Like fd_alloc(), but only considers fds starting from fdnum,
+ * so that several fds can be found before their pages are allocated */
+int
+fd_alloc_from(int fdnum, struct Fd **fd_store) {
+  801700:	55                   	push   %rbp
+  801701:	48 89 e5             	mov    %rsp,%rbp
+  801704:	41 57                	push   %r15
+  801706:	41 56                	push   %r14
+  801708:	41 55                	push   %r13
+  80170a:	41 54                	push   %r12
+  80170c:	53                   	push   %rbx
+  80170d:	48 83 ec 08          	sub    $0x8,%rsp
+  801711:	49 89 f7             	mov    %rsi,%r15
+    for (int i = MAX(fdnum, 0); i < MAXFD; i++) {
+  801714:	85 ff                	test   %edi,%edi
+  801716:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80171c:	44 0f 49 e7          	cmovns %edi,%r12d
+  801720:	83 ff 1f             	cmp    $0x1f,%edi
+  801723:	7f 37                	jg     80175c <fd_alloc_from+0x5c>
+  801725:	49 63 dc             	movslq %r12d,%rbx
+  801728:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  80172f:	48 c1 e3 0c          	shl    $0xc,%rbx
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  801733:	49 be 09 28 80 00 00 	movabs $0x802809,%r14
+  80173a:	00 00 00 
+        struct Fd *fd = INDEX2FD(i);
+  80173d:	49 89 dd             	mov    %rbx,%r13
+        if (!(get_prot(fd) & PROT_R)) {
+  801740:	48 89 df             	mov    %rbx,%rdi
+  801743:	41 ff d6             	call   *%r14
+  801746:	83 e0 04             	and    $0x4,%eax
+  801749:	74 1c                	je     801767 <fd_alloc_from+0x67>
+    for (int i = MAX(fdnum, 0); i < MAXFD; i++) {
+  80174b:	41 83 c4 01          	add    $0x1,%r12d
+  80174f:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801756:	41 83 fc 1f          	cmp    $0x1f,%r12d
+  80175a:	7e e1                	jle    80173d <fd_alloc_from+0x3d>
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  80175c:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801762:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  801767:	4d 89 2f             	mov    %r13,(%r15)
+}
+  80176a:	48 83 c4 08          	add    $0x8,%rsp
+  80176e:	5b                   	pop    %rbx
+  80176f:	41 5c                	pop    %r12
+  801771:	41 5d                	pop    %r13
+  801773:	41 5e                	pop    %r14
+  801775:	41 5f                	pop    %r15
+  801777:	5d                   	pop    %rbp
+  801778:	c3                   	ret
+
+0000000000801779 <fd_alloc>:
+fd_alloc(struct Fd **fd_store) {
+  801779:	55                   	push   %rbp
+  80177a:	48 89 e5             	mov    %rsp,%rbp
+  80177d:	48 89 fe             	mov    %rdi,%rsi
+    return fd_alloc_from(0, fd_store);
+  801780:	bf 00 00 00 00       	mov    $0x0,%edi
+  801785:	48 b8 00 17 80 00 00 	movabs $0x801700,%rax
+  80178c:	00 00 00 
+  80178f:	ff d0                	call   *%rax
+}
+  801791:	5d                   	pop    %rbp
+  801792:	c3                   	ret
+
+0000000000801793 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  801793:	83 ff 1f             	cmp    $0x1f,%edi
+  801796:	77 39                	ja     8017d1 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  801798:	55                   	push   %rbp
+  801799:	48 89 e5             	mov    %rsp,%rbp
+  80179c:	41 54                	push   %r12
+  80179e:	53                   	push   %rbx
+  80179f:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  8017a2:	48 63 df             	movslq %edi,%rbx
+  8017a5:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  8017ac:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  8017b0:	48 89 df             	mov    %rbx,%rdi
+  8017b3:	48 b8 09 28 80 00 00 	movabs $0x802809,%rax
+  8017ba:	00 00 00 
+  8017bd:	ff d0                	call   *%rax
+  8017bf:	a8 04                	test   $0x4,%al
+  8017c1:	74 14                	je     8017d7 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  8017c3:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  8017c7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8017cc:	5b                   	pop    %rbx
+  8017cd:	41 5c                	pop    %r12
+  8017cf:	5d                   	pop    %rbp
+  8017d0:	c3                   	ret
+        return -E_INVAL;
+  8017d1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8017d6:	c3                   	ret
+        return -E_INVAL;
+  8017d7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8017dc:	eb ee                	jmp    8017cc <fd_lookup+0x39>
+
+00000000008017de <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  8017de:	55                   	push   %rbp
+  8017df:	48 89 e5             	mov    %rsp,%rbp
+  8017e2:	41 54                	push   %r12
+  8017e4:	53                   	push   %rbx
+  8017e5:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  8017e8:	48 b8 80 35 80 00 00 	movabs $0x803580,%rax
+  8017ef:	00 00 00 
+  8017f2:	48 bb 20 40 80 00 00 	movabs $0x804020,%rbx
+  8017f9:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  8017fc:	39 3b                	cmp    %edi,(%rbx)
+  8017fe:	74 47                	je     801847 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  801800:	48 83 c0 08          	add    $0x8,%rax
+  801804:	48 8b 18             	mov    (%rax),%rbx
+  801807:	48 85 db             	test   %rbx,%rbx
+  80180a:	75 f0                	jne    8017fc <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  80180c:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801813:	00 00 00 
+  801816:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+  80181c:	89 fa                	mov    %edi,%edx
+  80181e:	48 bf f8 34 80 00 00 	movabs $0x8034f8,%rdi
+  801825:	00 00 00 
+  801828:	b8 00 00 00 00       	mov    $0x0,%eax
+  80182d:	48 b9 5e 02 80 00 00 	movabs $0x80025e,%rcx
+  801834:	00 00 00 
+  801837:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  801839:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  80183e:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  801842:	5b                   	pop    %rbx
+  801843:	41 5c                	pop    %r12
+  801845:	5d                   	pop    %rbp
+  801846:	c3                   	ret
+            return 0;
+  801847:	b8 00 00 00 00       	mov    $0x0,%eax
+  80184c:	eb f0                	jmp    80183e <dev_lookup+0x60>
+
+000000000080184e <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  80184e:	55                   	push   %rbp
+  80184f:	48 89 e5             	mov    %rsp,%rbp
+  801852:	41 55                	push   %r13
+  801854:	41 54                	push   %r12
+  801856:	53                   	push   %rbx
+  801857:	48 83 ec 18          	sub    $0x18,%rsp
+  80185b:	48 89 fb             	mov    %rdi,%rbx
+  80185e:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801861:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  801868:	ff ff ff 
+  80186b:	48 01 df             	add    %rbx,%rdi
+  80186e:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  801872:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801876:	48 b8 93 17 80 00 00 	movabs $0x801793,%rax
+  80187d:	00 00 00 
+  801880:	ff d0                	call   *%rax
+  801882:	41 89 c5             	mov    %eax,%r13d
+  801885:	85 c0                	test   %eax,%eax
+  801887:	78 06                	js     80188f <fd_close+0x41>
+  801889:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  80188d:	74 1a                	je     8018a9 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  80188f:	45 84 e4             	test   %r12b,%r12b
+  801892:	b8 00 00 00 00       	mov    $0x0,%eax
+  801897:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  80189b:	44 89 e8             	mov    %r13d,%eax
+  80189e:	48 83 c4 18          	add    $0x18,%rsp
+  8018a2:	5b                   	pop    %rbx
+  8018a3:	41 5c                	pop    %r12
+  8018a5:	41 5d                	pop    %r13
+  8018a7:	5d                   	pop    %rbp
+  8018a8:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8018a9:	8b 3b                	mov    (%rbx),%edi
+  8018ab:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8018af:	48 b8 de 17 80 00 00 	movabs $0x8017de,%rax
+  8018b6:	00 00 00 
+  8018b9:	ff d0                	call   *%rax
+  8018bb:	41 89 c5             	mov    %eax,%r13d
+  8018be:	85 c0                	test   %eax,%eax
+  8018c0:	78 1b                	js     8018dd <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  8018c2:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8018c6:	48 8b 40 20          	mov    0x20(%rax),%rax
+  8018ca:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  8018d0:	48 85 c0             	test   %rax,%rax
+  8018d3:	74 08                	je     8018dd <fd_close+0x8f>
+  8018d5:	48 89 df             	mov    %rbx,%rdi
+  8018d8:	ff d0                	call   *%rax
+  8018da:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8018dd:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8018e2:	48 89 de             	mov    %rbx,%rsi
+  8018e5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8018ea:	48 b8 ff 11 80 00 00 	movabs $0x8011ff,%rax
+  8018f1:	00 00 00 
+  8018f4:	ff d0                	call   *%rax
+    return res;
+  8018f6:	eb a3                	jmp    80189b <fd_close+0x4d>
+
+00000000008018f8 <close>:
+
+int
+close(int fdnum) {
+  8018f8:	55                   	push   %rbp
+  8018f9:	48 89 e5             	mov    %rsp,%rbp
+  8018fc:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  801900:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801904:	48 b8 93 17 80 00 00 	movabs $0x801793,%rax
+  80190b:	00 00 00 
+  80190e:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801910:	85 c0                	test   %eax,%eax
+  801912:	78 15                	js     801929 <close+0x31>
+
+    return fd_close(fd, 1);
+  801914:	be 01 00 00 00       	mov    $0x1,%esi
+  801919:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80191d:	48 b8 4e 18 80 00 00 	movabs $0x80184e,%rax
+  801924:	00 00 00 
+  801927:	ff d0                	call   *%rax
+}
+  801929:	c9                   	leave
+  80192a:	c3                   	ret
+
+000000000080192b <close_all>:
+
+void
+close_all(void) {
+  80192b:	55                   	push   %rbp
+  80192c:	48 89 e5             	mov    %rsp,%rbp
+  80192f:	41 54                	push   %r12
+  801931:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  801932:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801937:	49 bc f8 18 80 00 00 	movabs $0x8018f8,%r12
+  80193e:	00 00 00 
+  801941:	89 df                	mov    %ebx,%edi
+  801943:	41 ff d4             	call   *%r12
+  801946:	83 c3 01             	add    $0x1,%ebx
+  801949:	83 fb 20             	cmp    $0x20,%ebx
+  80194c:	75 f3                	jne    801941 <close_all+0x16>
+}
+  80194e:	5b                   	pop    %rbx
+  80194f:	41 5c                	pop    %r12
+  801951:	5d                   	pop    %rbp
+  801952:	c3                   	ret
+
+0000000000801953 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  801953:	55                   	push   %rbp
+  801954:	48 89 e5             	mov    %rsp,%rbp
+  801957:	41 57                	push   %r15
+  801959:	41 56                	push   %r14
+  80195b:	41 55                	push   %r13
+  80195d:	41 54                	push   %r12
+  80195f:	53                   	push   %rbx
+  801960:	48 83 ec 18          	sub    $0x18,%rsp
+  801964:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  801967:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  80196b:	48 b8 93 17 80 00 00 	movabs $0x801793,%rax
+  801972:	00 00 00 
+  801975:	ff d0                	call   *%rax
+  801977:	89 c3                	mov    %eax,%ebx
+  801979:	85 c0                	test   %eax,%eax
+  80197b:	0f 88 b8 00 00 00    	js     801a39 <dup+0xe6>
+    close(newfdnum);
+  801981:	44 89 e7             	mov    %r12d,%edi
+  801984:	48 b8 f8 18 80 00 00 	movabs $0x8018f8,%rax
+  80198b:	00 00 00 
+  80198e:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  801990:	4d 63 ec             	movslq %r12d,%r13
+  801993:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  80199a:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  80199e:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  8019a2:	4c 89 ff             	mov    %r15,%rdi
+  8019a5:	49 be e4 16 80 00 00 	movabs $0x8016e4,%r14
+  8019ac:	00 00 00 
+  8019af:	41 ff d6             	call   *%r14
+  8019b2:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  8019b5:	4c 89 ef             	mov    %r13,%rdi
+  8019b8:	41 ff d6             	call   *%r14
+  8019bb:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  8019be:	48 89 df             	mov    %rbx,%rdi
+  8019c1:	48 b8 09 28 80 00 00 	movabs $0x802809,%rax
+  8019c8:	00 00 00 
+  8019cb:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  8019cd:	a8 04                	test   $0x4,%al
+  8019cf:	74 2b                	je     8019fc <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  8019d1:	41 89 c1             	mov    %eax,%r9d
+  8019d4:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8019da:	4c 89 f1             	mov    %r14,%rcx
+  8019dd:	ba 00 00 00 00       	mov    $0x0,%edx
+  8019e2:	48 89 de             	mov    %rbx,%rsi
+  8019e5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8019ea:	48 b8 9a 11 80 00 00 	movabs $0x80119a,%rax
+  8019f1:	00 00 00 
+  8019f4:	ff d0                	call   *%rax
+  8019f6:	89 c3                	mov    %eax,%ebx
+  8019f8:	85 c0                	test   %eax,%eax
+  8019fa:	78 4e                	js     801a4a <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  8019fc:	4c 89 ff             	mov    %r15,%rdi
+  8019ff:	48 b8 09 28 80 00 00 	movabs $0x802809,%rax
+  801a06:	00 00 00 
+  801a09:	ff d0                	call   *%rax
+  801a0b:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801a0e:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801a14:	4c 89 e9             	mov    %r13,%rcx
+  801a17:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a1c:	4c 89 fe             	mov    %r15,%rsi
+  801a1f:	bf 00 00 00 00       	mov    $0x0,%edi
+  801a24:	48 b8 9a 11 80 00 00 	movabs $0x80119a,%rax
+  801a2b:	00 00 00 
+  801a2e:	ff d0                	call   *%rax
+  801a30:	89 c3                	mov    %eax,%ebx
+  801a32:	85 c0                	test   %eax,%eax
+  801a34:	78 14                	js     801a4a <dup+0xf7>
+
+    return newfdnum;
+  801a36:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  801a39:	89 d8                	mov    %ebx,%eax
+  801a3b:	48 83 c4 18          	add    $0x18,%rsp
+  801a3f:	5b                   	pop    %rbx
+  801a40:	41 5c                	pop    %r12
+  801a42:	41 5d                	pop    %r13
+  801a44:	41 5e                	pop    %r14
+  801a46:	41 5f                	pop    %r15
+  801a48:	5d                   	pop    %rbp
+  801a49:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  801a4a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801a4f:	4c 89 ee             	mov    %r13,%rsi
+  801a52:	bf 00 00 00 00       	mov    $0x0,%edi
+  801a57:	49 bc ff 11 80 00 00 	movabs $0x8011ff,%r12
+  801a5e:	00 00 00 
+  801a61:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  801a64:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801a69:	4c 89 f6             	mov    %r14,%rsi
+  801a6c:	bf 00 00 00 00       	mov    $0x0,%edi
+  801a71:	41 ff d4             	call   *%r12
+    return res;
+  801a74:	eb c3                	jmp    801a39 <dup+0xe6>
+
+0000000000801a76 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  801a76:	55                   	push   %rbp
+  801a77:	48 89 e5             	mov    %rsp,%rbp
+  801a7a:	41 56                	push   %r14
+  801a7c:	41 55                	push   %r13
+  801a7e:	41 54                	push   %r12
+  801a80:	53                   	push   %rbx
+  801a81:	48 83 ec 10          	sub    $0x10,%rsp
+  801a85:	89 fb                	mov    %edi,%ebx
+  801a87:	49 89 f4             	mov    %rsi,%r12
+  801a8a:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801a8d:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801a91:	48 b8 93 17 80 00 00 	movabs $0x801793,%rax
+  801a98:	00 00 00 
+  801a9b:	ff d0                	call   *%rax
+  801a9d:	85 c0                	test   %eax,%eax
+  801a9f:	78 4c                	js     801aed <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801aa1:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801aa5:	41 8b 3e             	mov    (%r14),%edi
+  801aa8:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801aac:	48 b8 de 17 80 00 00 	movabs $0x8017de,%rax
+  801ab3:	00 00 00 
+  801ab6:	ff d0                	call   *%rax
+  801ab8:	85 c0                	test   %eax,%eax
+  801aba:	78 35                	js     801af1 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801abc:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801ac0:	83 e0 03             	and    $0x3,%eax
+  801ac3:	83 f8 01             	cmp    $0x1,%eax
+  801ac6:	74 2d                	je     801af5 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801ac8:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801acc:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801ad0:	48 85 c0             	test   %rax,%rax
+  801ad3:	74 56                	je     801b2b <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  801ad5:	4c 89 ea             	mov    %r13,%rdx
+  801ad8:	4c 89 e6             	mov    %r12,%rsi
+  801adb:	4c 89 f7             	mov    %r14,%rdi
+  801ade:	ff d0                	call   *%rax
+}
+  801ae0:	48 83 c4 10          	add    $0x10,%rsp
+  801ae4:	5b                   	pop    %rbx
+  801ae5:	41 5c                	pop    %r12
+  801ae7:	41 5d                	pop    %r13
+  801ae9:	41 5e                	pop    %r14
+  801aeb:	5d                   	pop    %rbp
+  801aec:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801aed:	48 98                	cltq
+  801aef:	eb ef                	jmp    801ae0 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801af1:	48 98                	cltq
+  801af3:	eb eb                	jmp    801ae0 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801af5:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801afc:	00 00 00 
+  801aff:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+  801b05:	89 da                	mov    %ebx,%edx
+  801b07:	48 bf 39 35 80 00 00 	movabs $0x803539,%rdi
+  801b0e:	00 00 00 
+  801b11:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b16:	48 b9 5e 02 80 00 00 	movabs $0x80025e,%rcx
+  801b1d:	00 00 00 
+  801b20:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801b22:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801b29:	eb b5                	jmp    801ae0 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801b2b:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801b32:	eb ac                	jmp    801ae0 <read+0x6a>
+
+0000000000801b34 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801b34:	55                   	push   %rbp
+  801b35:	48 89 e5             	mov    %rsp,%rbp
+  801b38:	41 57                	push   %r15
+  801b3a:	41 56                	push   %r14
+  801b3c:	41 55                	push   %r13
+  801b3e:	41 54                	push   %r12
+  801b40:	53                   	push   %rbx
+  801b41:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  801b45:	48 85 d2             	test   %rdx,%rdx
+  801b48:	74 54                	je     801b9e <readn+0x6a>
+  801b4a:	41 89 fd             	mov    %edi,%r13d
+  801b4d:	49 89 f6             	mov    %rsi,%r14
+  801b50:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  801b53:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  801b58:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  801b5d:	49 bf 76 1a 80 00 00 	movabs $0x801a76,%r15
+  801b64:	00 00 00 
+  801b67:	4c 89 e2             	mov    %r12,%rdx
+  801b6a:	48 29 f2             	sub    %rsi,%rdx
+  801b6d:	4c 01 f6             	add    %r14,%rsi
+  801b70:	44 89 ef             	mov    %r13d,%edi
+  801b73:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  801b76:	85 c0                	test   %eax,%eax
+  801b78:	78 20                	js     801b9a <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  801b7a:	01 c3                	add    %eax,%ebx
+  801b7c:	85 c0                	test   %eax,%eax
+  801b7e:	74 08                	je     801b88 <readn+0x54>
+  801b80:	48 63 f3             	movslq %ebx,%rsi
+  801b83:	4c 39 e6             	cmp    %r12,%rsi
+  801b86:	72 df                	jb     801b67 <readn+0x33>
+    }
+    return res;
+  801b88:	48 63 c3             	movslq %ebx,%rax
+}
+  801b8b:	48 83 c4 08          	add    $0x8,%rsp
+  801b8f:	5b                   	pop    %rbx
+  801b90:	41 5c                	pop    %r12
+  801b92:	41 5d                	pop    %r13
+  801b94:	41 5e                	pop    %r14
+  801b96:	41 5f                	pop    %r15
+  801b98:	5d                   	pop    %rbp
+  801b99:	c3                   	ret
+        if (inc < 0) return inc;
+  801b9a:	48 98                	cltq
+  801b9c:	eb ed                	jmp    801b8b <readn+0x57>
+    int inc = 1, res = 0;
+  801b9e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801ba3:	eb e3                	jmp    801b88 <readn+0x54>
+
+0000000000801ba5 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  801ba5:	55                   	push   %rbp
+  801ba6:	48 89 e5             	mov    %rsp,%rbp
+  801ba9:	41 56                	push   %r14
+  801bab:	41 55                	push   %r13
+  801bad:	41 54                	push   %r12
+  801baf:	53                   	push   %rbx
+  801bb0:	48 83 ec 10          	sub    $0x10,%rsp
+  801bb4:	89 fb                	mov    %edi,%ebx
+  801bb6:	49 89 f4             	mov    %rsi,%r12
+  801bb9:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801bbc:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801bc0:	48 b8 93 17 80 00 00 	movabs $0x801793,%rax
+  801bc7:	00 00 00 
+  801bca:	ff d0                	call   *%rax
+  801bcc:	85 c0                	test   %eax,%eax
+  801bce:	78 47                	js     801c17 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801bd0:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801bd4:	41 8b 3e             	mov    (%r14),%edi
+  801bd7:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801bdb:	48 b8 de 17 80 00 00 	movabs $0x8017de,%rax
+  801be2:	00 00 00 
+  801be5:	ff d0                	call   *%rax
+  801be7:	85 c0                	test   %eax,%eax
+  801be9:	78 30                	js     801c1b <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801beb:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  801bf0:	74 2d                	je     801c1f <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801bf2:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801bf6:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801bfa:	48 85 c0             	test   %rax,%rax
+  801bfd:	74 56                	je     801c55 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  801bff:	4c 89 ea             	mov    %r13,%rdx
+  801c02:	4c 89 e6             	mov    %r12,%rsi
+  801c05:	4c 89 f7             	mov    %r14,%rdi
+  801c08:	ff d0                	call   *%rax
+}
+  801c0a:	48 83 c4 10          	add    $0x10,%rsp
+  801c0e:	5b                   	pop    %rbx
+  801c0f:	41 5c                	pop    %r12
+  801c11:	41 5d                	pop    %r13
+  801c13:	41 5e                	pop    %r14
+  801c15:	5d                   	pop    %rbp
+  801c16:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801c17:	48 98                	cltq
+  801c19:	eb ef                	jmp    801c0a <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801c1b:	48 98                	cltq
+  801c1d:	eb eb                	jmp    801c0a <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801c1f:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801c26:	00 00 00 
+  801c29:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+  801c2f:	89 da                	mov    %ebx,%edx
+  801c31:	48 bf 55 35 80 00 00 	movabs $0x803555,%rdi
+  801c38:	00 00 00 
+  801c3b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c40:	48 b9 5e 02 80 00 00 	movabs $0x80025e,%rcx
+  801c47:	00 00 00 
+  801c4a:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801c4c:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801c53:	eb b5                	jmp    801c0a <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801c55:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801c5c:	eb ac                	jmp    801c0a <write+0x65>
+
+0000000000801c5e <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  801c5e:	55                   	push   %rbp
+  801c5f:	48 89 e5             	mov    %rsp,%rbp
+  801c62:	53                   	push   %rbx
+  801c63:	48 83 ec 18          	sub    $0x18,%rsp
+  801c67:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801c69:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801c6d:	48 b8 93 17 80 00 00 	movabs $0x801793,%rax
+  801c74:	00 00 00 
+  801c77:	ff d0                	call   *%rax
+  801c79:	85 c0                	test   %eax,%eax
+  801c7b:	78 0c                	js     801c89 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  801c7d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801c81:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  801c84:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801c89:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801c8d:	c9                   	leave
+  801c8e:	c3                   	ret
+
+0000000000801c8f <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  801c8f:	55                   	push   %rbp
+  801c90:	48 89 e5             	mov    %rsp,%rbp
+  801c93:	41 55                	push   %r13
+  801c95:	41 54                	push   %r12
+  801c97:	53                   	push   %rbx
+  801c98:	48 83 ec 18          	sub    $0x18,%rsp
+  801c9c:	89 fb                	mov    %edi,%ebx
+  801c9e:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801ca1:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801ca5:	48 b8 93 17 80 00 00 	movabs $0x801793,%rax
+  801cac:	00 00 00 
+  801caf:	ff d0                	call   *%rax
+  801cb1:	85 c0                	test   %eax,%eax
+  801cb3:	78 38                	js     801ced <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801cb5:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  801cb9:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  801cbd:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801cc1:	48 b8 de 17 80 00 00 	movabs $0x8017de,%rax
+  801cc8:	00 00 00 
+  801ccb:	ff d0                	call   *%rax
+  801ccd:	85 c0                	test   %eax,%eax
+  801ccf:	78 1c                	js     801ced <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801cd1:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  801cd6:	74 20                	je     801cf8 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801cd8:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801cdc:	48 8b 40 30          	mov    0x30(%rax),%rax
+  801ce0:	48 85 c0             	test   %rax,%rax
+  801ce3:	74 47                	je     801d2c <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  801ce5:	44 89 e6             	mov    %r12d,%esi
+  801ce8:	4c 89 ef             	mov    %r13,%rdi
+  801ceb:	ff d0                	call   *%rax
+}
+  801ced:	48 83 c4 18          	add    $0x18,%rsp
+  801cf1:	5b                   	pop    %rbx
+  801cf2:	41 5c                	pop    %r12
+  801cf4:	41 5d                	pop    %r13
+  801cf6:	5d                   	pop    %rbp
+  801cf7:	c3                   	ret
+                thisenv->env_id, fdnum);
+  801cf8:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801cff:	00 00 00 
+  801d02:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801d08:	89 da                	mov    %ebx,%edx
+  801d0a:	48 bf 18 35 80 00 00 	movabs $0x803518,%rdi
+  801d11:	00 00 00 
+  801d14:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d19:	48 b9 5e 02 80 00 00 	movabs $0x80025e,%rcx
+  801d20:	00 00 00 
+  801d23:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801d25:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801d2a:	eb c1                	jmp    801ced <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801d2c:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801d31:	eb ba                	jmp    801ced <ftruncate+0x5e>
+
+0000000000801d33 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  801d33:	55                   	push   %rbp
+  801d34:	48 89 e5             	mov    %rsp,%rbp
+  801d37:	41 54                	push   %r12
+  801d39:	53                   	push   %rbx
+  801d3a:	48 83 ec 10          	sub    $0x10,%rsp
+  801d3e:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801d41:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801d45:	48 b8 93 17 80 00 00 	movabs $0x801793,%rax
+  801d4c:	00 00 00 
+  801d4f:	ff d0                	call   *%rax
+  801d51:	85 c0                	test   %eax,%eax
+  801d53:	78 4e                	js     801da3 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801d55:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801d59:	41 8b 3c 24          	mov    (%r12),%edi
+  801d5d:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801d61:	48 b8 de 17 80 00 00 	movabs $0x8017de,%rax
+  801d68:	00 00 00 
+  801d6b:	ff d0                	call   *%rax
+  801d6d:	85 c0                	test   %eax,%eax
+  801d6f:	78 32                	js     801da3 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801d71:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801d75:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  801d7a:	74 30                	je     801dac <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  801d7c:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  801d7f:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  801d86:	00 00 00 
+    stat->st_isdir = 0;
+  801d89:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  801d90:	00 00 00 
+    stat->st_dev = dev;
+  801d93:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  801d9a:	48 89 de             	mov    %rbx,%rsi
+  801d9d:	4c 89 e7             	mov    %r12,%rdi
+  801da0:	ff 50 28             	call   *0x28(%rax)
+}
+  801da3:	48 83 c4 10          	add    $0x10,%rsp
+  801da7:	5b                   	pop    %rbx
+  801da8:	41 5c                	pop    %r12
+  801daa:	5d                   	pop    %rbp
+  801dab:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801dac:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801db1:	eb f0                	jmp    801da3 <fstat+0x70>
+
+0000000000801db3 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  801db3:	55                   	push   %rbp
+  801db4:	48 89 e5             	mov    %rsp,%rbp
+  801db7:	41 54                	push   %r12
+  801db9:	53                   	push   %rbx
+  801dba:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  801dbd:	be 00 00 00 00       	mov    $0x0,%esi
+  801dc2:	48 b8 96 21 80 00 00 	movabs $0x802196,%rax
+  801dc9:	00 00 00 
+  801dcc:	ff d0                	call   *%rax
+  801dce:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  801dd0:	85 c0                	test   %eax,%eax
+  801dd2:	78 25                	js     801df9 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  801dd4:	4c 89 e6             	mov    %r12,%rsi
+  801dd7:	89 c7                	mov    %eax,%edi
+  801dd9:	48 b8 33 1d 80 00 00 	movabs $0x801d33,%rax
+  801de0:	00 00 00 
+  801de3:	ff d0                	call   *%rax
+  801de5:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  801de8:	89 df                	mov    %ebx,%edi
+  801dea:	48 b8 f8 18 80 00 00 	movabs $0x8018f8,%rax
+  801df1:	00 00 00 
+  801df4:	ff d0                	call   *%rax
+
+    return res;
+  801df6:	44 89 e3             	mov    %r12d,%ebx
+}
+  801df9:	89 d8                	mov    %ebx,%eax
+  801dfb:	5b                   	pop    %rbx
+  801dfc:	41 5c                	pop    %r12
+  801dfe:	5d                   	pop    %rbp
+  801dff:	c3                   	ret
+
+0000000000801e00 <fsipc>:
+ * response may be written back to fsipcbuf.
+ * type: request code, passed as the simple integer IPC value.
+ * dstva: virtual address at which to receive reply page, 0 if none.
+ * Returns result from the file server. */
+static int
+fsipc(unsigned type, void *dstva) {
+  801e00:	55                   	push   %rbp
+  801e01:	48 89 e5             	mov    %rsp,%rbp
+  801e04:	41 54                	push   %r12
+  801e06:	53                   	push   %rbx
+  801e07:	48 83 ec 10          	sub    $0x10,%rsp
+  801e0b:	41 89 fc             	mov    %edi,%r12d
+  801e0e:	48 89 f3             	mov    %rsi,%rbx
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  801e11:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  801e18:	00 00 00 
+  801e1b:	83 38 00             	cmpl   $0x0,(%rax)
+  801e1e:	74 5e                	je     801e7e <fsipc+0x7e>
+    if (debug) {
+        cprintf("[%08x] fsipc %d %08x\n",
+                thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+    }
+
+    ipc_send(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW);
+  801e20:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  801e26:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  801e2b:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  801e32:	00 00 00 
+  801e35:	44 89 e6             	mov    %r12d,%esi
+  801e38:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  801e3f:	00 00 00 
+  801e42:	8b 38                	mov    (%rax),%edi
+  801e44:	48 b8 a0 2d 80 00 00 	movabs $0x802da0,%rax
+  801e4b:	00 00 00 
+  801e4e:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  801e50:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  801e57:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  801e58:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801e5d:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  801e61:	48 89 de             	mov    %rbx,%rsi
+  801e64:	bf 00 00 00 00       	mov    $0x0,%edi
+  801e69:	48 b8 cb 2c 80 00 00 	movabs $0x802ccb,%rax
+  801e70:	00 00 00 
+  801e73:	ff d0                	call   *%rax
+}
+  801e75:	48 83 c4 10          	add    $0x10,%rsp
+  801e79:	5b                   	pop    %rbx
+  801e7a:	41 5c                	pop    %r12
+  801e7c:	5d                   	pop    %rbp
+  801e7d:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  801e7e:	bf 03 00 00 00       	mov    $0x3,%edi
+  801e83:	48 b8 43 2e 80 00 00 	movabs $0x802e43,%rax
+  801e8a:	00 00 00 
+  801e8d:	ff d0                	call   *%rax
+  801e8f:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  801e96:	00 00 
+  801e98:	eb 86                	jmp    801e20 <fsipc+0x20>
+
+0000000000801e9a <devfile_trunc>:
+    return 0;
+}
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  801e9a:	55                   	push   %rbp
+  801e9b:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801e9e:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  801ea5:	00 00 00 
+  801ea8:	8b 57 0c             	mov    0xc(%rdi),%edx
+  801eab:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  801ead:	89 70 04             	mov    %esi,0x4(%rax)
+
+    return fsipc(FSREQ_SET_SIZE, NULL);
+  801eb0:	be 00 00 00 00       	mov    $0x0,%esi
+  801eb5:	bf 02 00 00 00       	mov    $0x2,%edi
+  801eba:	48 b8 00 1e 80 00 00 	movabs $0x801e00,%rax
+  801ec1:	00 00 00 
+  801ec4:	ff d0                	call   *%rax
+}
+  801ec6:	5d                   	pop    %rbp
+  801ec7:	c3                   	ret
+
+0000000000801ec8 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  801ec8:	55                   	push   %rbp
+  801ec9:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801ecc:	8b 47 0c             	mov    0xc(%rdi),%eax
+  801ecf:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  801ed6:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  801ed8:	be 00 00 00 00       	mov    $0x0,%esi
+  801edd:	bf 06 00 00 00       	mov    $0x6,%edi
+  801ee2:	48 b8 00 1e 80 00 00 	movabs $0x801e00,%rax
+  801ee9:	00 00 00 
+  801eec:	ff d0                	call   *%rax
+}
+  801eee:	5d                   	pop    %rbp
+  801eef:	c3                   	ret
+
+0000000000801ef0 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  801ef0:	55                   	push   %rbp
+  801ef1:	48 89 e5             	mov    %rsp,%rbp
+  801ef4:	41 54                	push   %r12
+  801ef6:	53                   	push   %rbx
+  801ef7:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801efa:	8b 47 0c             	mov    0xc(%rdi),%eax
+  801efd:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  801f04:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  801f06:	be 00 00 00 00       	mov    $0x0,%esi
+  801f0b:	bf 05 00 00 00       	mov    $0x5,%edi
+  801f10:	48 b8 00 1e 80 00 00 	movabs $0x801e00,%rax
+  801f17:	00 00 00 
+  801f1a:	ff d0                	call   *%rax
+    if (res < 0) {
+  801f1c:	85 c0                	test   %eax,%eax
+  801f1e:	78 3d                	js     801f5d <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801f20:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  801f27:	00 00 00 
+  801f2a:	4c 89 e6             	mov    %r12,%rsi
+  801f2d:	48 89 df             	mov    %rbx,%rdi
+  801f30:	48 b8 83 0b 80 00 00 	movabs $0x800b83,%rax
+  801f37:	00 00 00 
+  801f3a:	ff d0                	call   *%rax
+    st->st_size  = fsipcbuf.statRet.ret_size;
+  801f3c:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  801f43:	00 
+  801f44:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801f4a:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  801f51:	00 
+  801f52:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  801f58:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801f5d:	5b                   	pop    %rbx
+  801f5e:	41 5c                	pop    %r12
+  801f60:	5d                   	pop    %rbp
+  801f61:	c3                   	ret
+
+0000000000801f62 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  801f62:	55                   	push   %rbp
+  801f63:	48 89 e5             	mov    %rsp,%rbp
+  801f66:	41 57                	push   %r15
+  801f68:	41 56                	push   %r14
+  801f6a:	41 55                	push   %r13
+  801f6c:	41 54                	push   %r12
+  801f6e:	53                   	push   %rbx
+  801f6f:	48 83 ec 18          	sub    $0x18,%rsp
+  801f73:	49 89 fe             	mov    %rdi,%r14
+  801f76:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+  801f7a:	48 89 d3             	mov    %rdx,%rbx
+    while (n > sizeof(fsipcbuf.write.req_buf))
+  801f7d:	48 81 fa f0 0f 00 00 	cmp    $0xff0,%rdx
+  801f84:	0f 86 e4 00 00 00    	jbe    80206e <devfile_write+0x10c>
+  801f8a:	49 89 f4             	mov    %rsi,%r12
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801f8d:	49 bd 00 60 80 00 00 	movabs $0x806000,%r13
+  801f94:	00 00 00 
+        memcpy(fsipcbuf.write.req_buf, buf, sizeof(fsipcbuf.write.req_buf));
+  801f97:	49 bf e4 0d 80 00 00 	movabs $0x800de4,%r15
+  801f9e:	00 00 00 
+  801fa1:	eb 03                	jmp    801fa6 <devfile_write+0x44>
+        buf += sizeof(fsipcbuf.write.req_buf);
+  801fa3:	49 89 f4             	mov    %rsi,%r12
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801fa6:	41 8b 46 0c          	mov    0xc(%r14),%eax
+  801faa:	41 89 45 00          	mov    %eax,0x0(%r13)
+        fsipcbuf.write.req_n      = sizeof(fsipcbuf.write.req_buf);
+  801fae:	49 c7 45 08 f0 0f 00 	movq   $0xff0,0x8(%r13)
+  801fb5:	00 
+        memcpy(fsipcbuf.write.req_buf, buf, sizeof(fsipcbuf.write.req_buf));
+  801fb6:	ba f0 0f 00 00       	mov    $0xff0,%edx
+  801fbb:	4c 89 e6             	mov    %r12,%rsi
+  801fbe:	48 bf 10 60 80 00 00 	movabs $0x806010,%rdi
+  801fc5:	00 00 00 
+  801fc8:	41 ff d7             	call   *%r15
+        ssize_t res = fsipc(FSREQ_WRITE, NULL);
+  801fcb:	be 00 00 00 00       	mov    $0x0,%esi
+  801fd0:	bf 04 00 00 00       	mov    $0x4,%edi
+  801fd5:	48 b8 00 1e 80 00 00 	movabs $0x801e00,%rax
+  801fdc:	00 00 00 
+  801fdf:	ff d0                	call   *%rax
+  801fe1:	48 63 d0             	movslq %eax,%rdx
+        if (res < 0 || res < sizeof(fsipcbuf.write.req_buf))
+  801fe4:	3d ef 0f 00 00       	cmp    $0xfef,%eax
+  801fe9:	7e 71                	jle    80205c <devfile_write+0xfa>
+        buf += sizeof(fsipcbuf.write.req_buf);
+  801feb:	49 8d b4 24 f0 0f 00 	lea    0xff0(%r12),%rsi
+  801ff2:	00 
+        n -= sizeof(fsipcbuf.write.req_buf);
+  801ff3:	48 81 eb f0 0f 00 00 	sub    $0xff0,%rbx
+    while (n > sizeof(fsipcbuf.write.req_buf))
+  801ffa:	48 81 fb f0 0f 00 00 	cmp    $0xff0,%rbx
+  802001:	77 a0                	ja     801fa3 <devfile_write+0x41>
+        written += sizeof(fsipcbuf.write.req_buf);
+  802003:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802007:	49 29 c4             	sub    %rax,%r12
+  80200a:	4d 8d a4 24 f0 0f 00 	lea    0xff0(%r12),%r12
+  802011:	00 
+    fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802012:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  802019:	00 00 00 
+  80201c:	41 8b 56 0c          	mov    0xc(%r14),%edx
+  802020:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.write.req_n      = n;
+  802022:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    memcpy(fsipcbuf.write.req_buf, buf, n);
+  802026:	48 89 da             	mov    %rbx,%rdx
+  802029:	48 8d 78 10          	lea    0x10(%rax),%rdi
+  80202d:	48 b8 e4 0d 80 00 00 	movabs $0x800de4,%rax
+  802034:	00 00 00 
+  802037:	ff d0                	call   *%rax
+    ssize_t res = fsipc(FSREQ_WRITE, NULL);
+  802039:	be 00 00 00 00       	mov    $0x0,%esi
+  80203e:	bf 04 00 00 00       	mov    $0x4,%edi
+  802043:	48 b8 00 1e 80 00 00 	movabs $0x801e00,%rax
+  80204a:	00 00 00 
+  80204d:	ff d0                	call   *%rax
+  80204f:	48 63 d0             	movslq %eax,%rdx
+    written += res;
+  802052:	49 01 d4             	add    %rdx,%r12
+  802055:	48 85 d2             	test   %rdx,%rdx
+  802058:	49 0f 49 d4          	cmovns %r12,%rdx
+}
+  80205c:	48 89 d0             	mov    %rdx,%rax
+  80205f:	48 83 c4 18          	add    $0x18,%rsp
+  802063:	5b                   	pop    %rbx
+  802064:	41 5c                	pop    %r12
+  802066:	41 5d                	pop    %r13
+  802068:	41 5e                	pop    %r14
+  80206a:	41 5f                	pop    %r15
+  80206c:	5d                   	pop    %rbp
+  80206d:	c3                   	ret
+    while (n > sizeof(fsipcbuf.write.req_buf))
+  80206e:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+    ssize_t written = 0;
+  802072:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802078:	eb 98                	jmp    802012 <devfile_write+0xb0>
+
+000000000080207a <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  80207a:	55                   	push   %rbp
+  80207b:	48 89 e5             	mov    %rsp,%rbp
+  80207e:	41 57                	push   %r15
+  802080:	41 56                	push   %r14
+  802082:	41 55                	push   %r13
+  802084:	41 54                	push   %r12
+  802086:	53                   	push   %rbx
+  802087:	48 83 ec 18          	sub    $0x18,%rsp
+  80208b:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  80208f:	49 89 f6             	mov    %rsi,%r14
+  802092:	49 89 d4             	mov    %rdx,%r12
+    while (n > sizeof(fsipcbuf.readRet.ret_buf))
+  802095:	48 81 fa 00 10 00 00 	cmp    $0x1000,%rdx
+  80209c:	0f 86 ea 00 00 00    	jbe    80218c <devfile_read+0x112>
+    ssize_t readsz = 0;
+  8020a2:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  8020a9:	00 
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8020aa:	49 bf 00 60 80 00 00 	movabs $0x806000,%r15
+  8020b1:	00 00 00 
+  8020b4:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8020b8:	8b 40 0c             	mov    0xc(%rax),%eax
+  8020bb:	41 89 07             	mov    %eax,(%r15)
+        fsipcbuf.read.req_n = sizeof(fsipcbuf.readRet.ret_buf);
+  8020be:	49 c7 47 08 00 10 00 	movq   $0x1000,0x8(%r15)
+  8020c5:	00 
+        ssize_t res = fsipc(FSREQ_READ, NULL);
+  8020c6:	be 00 00 00 00       	mov    $0x0,%esi
+  8020cb:	bf 03 00 00 00       	mov    $0x3,%edi
+  8020d0:	48 b8 00 1e 80 00 00 	movabs $0x801e00,%rax
+  8020d7:	00 00 00 
+  8020da:	ff d0                	call   *%rax
+  8020dc:	4c 63 e8             	movslq %eax,%r13
+        if (res < 0)
+  8020df:	4d 85 ed             	test   %r13,%r13
+  8020e2:	0f 88 92 00 00 00    	js     80217a <devfile_read+0x100>
+        memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  8020e8:	4c 89 ea             	mov    %r13,%rdx
+  8020eb:	4c 89 fe             	mov    %r15,%rsi
+  8020ee:	4c 89 f7             	mov    %r14,%rdi
+  8020f1:	48 b8 e4 0d 80 00 00 	movabs $0x800de4,%rax
+  8020f8:	00 00 00 
+  8020fb:	ff d0                	call   *%rax
+        if (res < sizeof(fsipcbuf.readRet.ret_buf))
+  8020fd:	49 81 fd ff 0f 00 00 	cmp    $0xfff,%r13
+  802104:	76 6d                	jbe    802173 <devfile_read+0xf9>
+        readsz += res;
+  802106:	4c 01 6d c0          	add    %r13,-0x40(%rbp)
+        buf += res;
+  80210a:	4d 01 ee             	add    %r13,%r14
+        n -= res;
+  80210d:	4d 29 ec             	sub    %r13,%r12
+    while (n > sizeof(fsipcbuf.readRet.ret_buf))
+  802110:	49 81 fc 00 10 00 00 	cmp    $0x1000,%r12
+  802117:	77 9b                	ja     8020b4 <devfile_read+0x3a>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802119:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  802120:	00 00 00 
+  802123:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  802127:	8b 51 0c             	mov    0xc(%rcx),%edx
+  80212a:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.read.req_n = n;
+  80212c:	4c 89 60 08          	mov    %r12,0x8(%rax)
+    ssize_t res = fsipc(FSREQ_READ, NULL);
+  802130:	be 00 00 00 00       	mov    $0x0,%esi
+  802135:	bf 03 00 00 00       	mov    $0x3,%edi
+  80213a:	48 b8 00 1e 80 00 00 	movabs $0x801e00,%rax
+  802141:	00 00 00 
+  802144:	ff d0                	call   *%rax
+  802146:	4c 63 e8             	movslq %eax,%r13
+    if (res < 0)
+  802149:	4d 85 ed             	test   %r13,%r13
+  80214c:	78 2c                	js     80217a <devfile_read+0x100>
+    memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  80214e:	4c 89 ea             	mov    %r13,%rdx
+  802151:	48 be 00 60 80 00 00 	movabs $0x806000,%rsi
+  802158:	00 00 00 
+  80215b:	4c 89 f7             	mov    %r14,%rdi
+  80215e:	48 b8 e4 0d 80 00 00 	movabs $0x800de4,%rax
+  802165:	00 00 00 
+  802168:	ff d0                	call   *%rax
+    readsz += res;
+  80216a:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80216e:	49 01 c5             	add    %rax,%r13
+    return readsz;
+  802171:	eb 07                	jmp    80217a <devfile_read+0x100>
+            return readsz + res;
+  802173:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802177:	49 01 c5             	add    %rax,%r13
+}
+  80217a:	4c 89 e8             	mov    %r13,%rax
+  80217d:	48 83 c4 18          	add    $0x18,%rsp
+  802181:	5b                   	pop    %rbx
+  802182:	41 5c                	pop    %r12
+  802184:	41 5d                	pop    %r13
+  802186:	41 5e                	pop    %r14
+  802188:	41 5f                	pop    %r15
+  80218a:	5d                   	pop    %rbp
+  80218b:	c3                   	ret
+    ssize_t readsz = 0;
+  80218c:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  802193:	00 
+  802194:	eb 83                	jmp    802119 <devfile_read+0x9f>
+
+0000000000802196 <open>:
+open(const char *path, int mode) {
+  802196:	55                   	push   %rbp
+  802197:	48 89 e5             	mov    %rsp,%rbp
+  80219a:	41 55                	push   %r13
+  80219c:	41 54                	push   %r12
+  80219e:	53                   	push   %rbx
+  80219f:	48 83 ec 18          	sub    $0x18,%rsp
+  8021a3:	49 89 fc             	mov    %rdi,%r12
+  8021a6:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  8021a9:	48 b8 45 0b 80 00 00 	movabs $0x800b45,%rax
+  8021b0:	00 00 00 
+  8021b3:	ff d0                	call   *%rax
+  8021b5:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  8021bb:	0f 87 8a 00 00 00    	ja     80224b <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8021c1:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  8021c5:	48 b8 79 17 80 00 00 	movabs $0x801779,%rax
+  8021cc:	00 00 00 
+  8021cf:	ff d0                	call   *%rax
+  8021d1:	89 c3                	mov    %eax,%ebx
+  8021d3:	85 c0                	test   %eax,%eax
+  8021d5:	78 50                	js     802227 <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  8021d7:	4c 89 e6             	mov    %r12,%rsi
+  8021da:	48 bb 00 60 80 00 00 	movabs $0x806000,%rbx
+  8021e1:	00 00 00 
+  8021e4:	48 89 df             	mov    %rbx,%rdi
+  8021e7:	48 b8 83 0b 80 00 00 	movabs $0x800b83,%rax
+  8021ee:	00 00 00 
+  8021f1:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  8021f3:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  8021fa:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8021fe:	bf 01 00 00 00       	mov    $0x1,%edi
+  802203:	48 b8 00 1e 80 00 00 	movabs $0x801e00,%rax
+  80220a:	00 00 00 
+  80220d:	ff d0                	call   *%rax
+  80220f:	89 c3                	mov    %eax,%ebx
+  802211:	85 c0                	test   %eax,%eax
+  802213:	78 1f                	js     802234 <open+0x9e>
+    return fd2num(fd);
+  802215:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802219:	48 b8 d2 16 80 00 00 	movabs $0x8016d2,%rax
+  802220:	00 00 00 
+  802223:	ff d0                	call   *%rax
+  802225:	89 c3                	mov    %eax,%ebx
+}
+  802227:	89 d8                	mov    %ebx,%eax
+  802229:	48 83 c4 18          	add    $0x18,%rsp
+  80222d:	5b                   	pop    %rbx
+  80222e:	41 5c                	pop    %r12
+  802230:	41 5d                	pop    %r13
+  802232:	5d                   	pop    %rbp
+  802233:	c3                   	ret
+        fd_close(fd, 0);
+  802234:	be 00 00 00 00       	mov    $0x0,%esi
+  802239:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80223d:	48 b8 4e 18 80 00 00 	movabs $0x80184e,%rax
+  802244:	00 00 00 
+  802247:	ff d0                	call   *%rax
+        return res;
+  802249:	eb dc                	jmp    802227 <open+0x91>
+        return -E_BAD_PATH;
+  80224b:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  802250:	eb d5                	jmp    802227 <open+0x91>
+
+0000000000802252 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  802252:	55                   	push   %rbp
+  802253:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc(FSREQ_SYNC, NULL);
+  802256:	be 00 00 00 00       	mov    $0x0,%esi
+  80225b:	bf 08 00 00 00       	mov    $0x8,%edi
+  802260:	48 b8 00 1e 80 00 00 	movabs $0x801e00,%rax
+  802267:	00 00 00 
+  80226a:	ff d0                	call   *%rax
+}
+  80226c:	5d                   	pop    %rbp
+  80226d:	c3                   	ret
+
+000000000080226e <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  80226e:	55                   	push   %rbp
+  80226f:	48 89 e5             	mov    %rsp,%rbp
+  802272:	41 54                	push   %r12
+  802274:	53                   	push   %rbx
+  802275:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802278:	48 b8 e4 16 80 00 00 	movabs $0x8016e4,%rax
+  80227f:	00 00 00 
+  802282:	ff d0                	call   *%rax
+  802284:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  802287:	48 be a0 35 80 00 00 	movabs $0x8035a0,%rsi
+  80228e:	00 00 00 
+  802291:	48 89 df             	mov    %rbx,%rdi
+  802294:	48 b8 83 0b 80 00 00 	movabs $0x800b83,%rax
+  80229b:	00 00 00 
+  80229e:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  8022a0:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  8022a5:	41 2b 04 24          	sub    (%r12),%eax
+  8022a9:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  8022af:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8022b6:	00 00 00 
+    stat->st_dev = &devpipe;
+  8022b9:	48 b8 60 40 80 00 00 	movabs $0x804060,%rax
+  8022c0:	00 00 00 
+  8022c3:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  8022ca:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022cf:	5b                   	pop    %rbx
+  8022d0:	41 5c                	pop    %r12
+  8022d2:	5d                   	pop    %rbp
+  8022d3:	c3                   	ret
+
+00000000008022d4 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  8022d4:	55                   	push   %rbp
+  8022d5:	48 89 e5             	mov    %rsp,%rbp
+  8022d8:	41 54                	push   %r12
+  8022da:	53                   	push   %rbx
+  8022db:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8022de:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8022e3:	48 89 fe             	mov    %rdi,%rsi
+  8022e6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8022eb:	49 bc ff 11 80 00 00 	movabs $0x8011ff,%r12
+  8022f2:	00 00 00 
+  8022f5:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  8022f8:	48 89 df             	mov    %rbx,%rdi
+  8022fb:	48 b8 e4 16 80 00 00 	movabs $0x8016e4,%rax
+  802302:	00 00 00 
+  802305:	ff d0                	call   *%rax
+  802307:	48 89 c6             	mov    %rax,%rsi
+  80230a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80230f:	bf 00 00 00 00       	mov    $0x0,%edi
+  802314:	41 ff d4             	call   *%r12
+}
+  802317:	5b                   	pop    %rbx
+  802318:	41 5c                	pop    %r12
+  80231a:	5d                   	pop    %rbp
+  80231b:	c3                   	ret
+
+000000000080231c <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  80231c:	55                   	push   %rbp
+  80231d:	48 89 e5             	mov    %rsp,%rbp
+  802320:	41 57                	push   %r15
+  802322:	41 56                	push   %r14
+  802324:	41 55                	push   %r13
+  802326:	41 54                	push   %r12
+  802328:	53                   	push   %rbx
+  802329:	48 83 ec 18          	sub    $0x18,%rsp
+  80232d:	49 89 fc             	mov    %rdi,%r12
+  802330:	49 89 f5             	mov    %rsi,%r13
+  802333:	49 89 d7             	mov    %rdx,%r15
+  802336:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80233a:	48 b8 e4 16 80 00 00 	movabs $0x8016e4,%rax
+  802341:	00 00 00 
+  802344:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  802346:	4d 85 ff             	test   %r15,%r15
+  802349:	0f 84 af 00 00 00    	je     8023fe <devpipe_write+0xe2>
+  80234f:	48 89 c3             	mov    %rax,%rbx
+  802352:	4c 89 f8             	mov    %r15,%rax
+  802355:	4d 89 ef             	mov    %r13,%r15
+  802358:	4c 01 e8             	add    %r13,%rax
+  80235b:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80235f:	49 bd 07 11 80 00 00 	movabs $0x801107,%r13
+  802366:	00 00 00 
+            sys_yield();
+  802369:	49 be a4 10 80 00 00 	movabs $0x8010a4,%r14
+  802370:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  802373:	8b 73 04             	mov    0x4(%rbx),%esi
+  802376:	48 63 ce             	movslq %esi,%rcx
+  802379:	48 63 03             	movslq (%rbx),%rax
+  80237c:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  802382:	48 39 c1             	cmp    %rax,%rcx
+  802385:	72 2e                	jb     8023b5 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802387:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80238c:	48 89 da             	mov    %rbx,%rdx
+  80238f:	be 00 10 00 00       	mov    $0x1000,%esi
+  802394:	4c 89 e7             	mov    %r12,%rdi
+  802397:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  80239a:	85 c0                	test   %eax,%eax
+  80239c:	74 66                	je     802404 <devpipe_write+0xe8>
+            sys_yield();
+  80239e:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  8023a1:	8b 73 04             	mov    0x4(%rbx),%esi
+  8023a4:	48 63 ce             	movslq %esi,%rcx
+  8023a7:	48 63 03             	movslq (%rbx),%rax
+  8023aa:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  8023b0:	48 39 c1             	cmp    %rax,%rcx
+  8023b3:	73 d2                	jae    802387 <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8023b5:	41 0f b6 3f          	movzbl (%r15),%edi
+  8023b9:	48 89 ca             	mov    %rcx,%rdx
+  8023bc:	48 c1 ea 03          	shr    $0x3,%rdx
+  8023c0:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  8023c7:	08 10 20 
+  8023ca:	48 f7 e2             	mul    %rdx
+  8023cd:	48 c1 ea 06          	shr    $0x6,%rdx
+  8023d1:	48 89 d0             	mov    %rdx,%rax
+  8023d4:	48 c1 e0 09          	shl    $0x9,%rax
+  8023d8:	48 29 d0             	sub    %rdx,%rax
+  8023db:	48 c1 e0 03          	shl    $0x3,%rax
+  8023df:	48 29 c1             	sub    %rax,%rcx
+  8023e2:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  8023e7:	83 c6 01             	add    $0x1,%esi
+  8023ea:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8023ed:	49 83 c7 01          	add    $0x1,%r15
+  8023f1:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8023f5:	49 39 c7             	cmp    %rax,%r15
+  8023f8:	0f 85 75 ff ff ff    	jne    802373 <devpipe_write+0x57>
+    return n;
+  8023fe:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802402:	eb 05                	jmp    802409 <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  802404:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802409:	48 83 c4 18          	add    $0x18,%rsp
+  80240d:	5b                   	pop    %rbx
+  80240e:	41 5c                	pop    %r12
+  802410:	41 5d                	pop    %r13
+  802412:	41 5e                	pop    %r14
+  802414:	41 5f                	pop    %r15
+  802416:	5d                   	pop    %rbp
+  802417:	c3                   	ret
+
+0000000000802418 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  802418:	55                   	push   %rbp
+  802419:	48 89 e5             	mov    %rsp,%rbp
+  80241c:	41 57                	push   %r15
+  80241e:	41 56                	push   %r14
+  802420:	41 55                	push   %r13
+  802422:	41 54                	push   %r12
+  802424:	53                   	push   %rbx
+  802425:	48 83 ec 18          	sub    $0x18,%rsp
+  802429:	49 89 fc             	mov    %rdi,%r12
+  80242c:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  802430:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802434:	48 b8 e4 16 80 00 00 	movabs $0x8016e4,%rax
+  80243b:	00 00 00 
+  80243e:	ff d0                	call   *%rax
+  802440:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  802443:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802449:	49 bd 07 11 80 00 00 	movabs $0x801107,%r13
+  802450:	00 00 00 
+            sys_yield();
+  802453:	49 be a4 10 80 00 00 	movabs $0x8010a4,%r14
+  80245a:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  80245d:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  802462:	74 7d                	je     8024e1 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  802464:	8b 03                	mov    (%rbx),%eax
+  802466:	3b 43 04             	cmp    0x4(%rbx),%eax
+  802469:	75 26                	jne    802491 <devpipe_read+0x79>
+            if (i > 0) return i;
+  80246b:	4d 85 ff             	test   %r15,%r15
+  80246e:	75 77                	jne    8024e7 <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802470:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802475:	48 89 da             	mov    %rbx,%rdx
+  802478:	be 00 10 00 00       	mov    $0x1000,%esi
+  80247d:	4c 89 e7             	mov    %r12,%rdi
+  802480:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  802483:	85 c0                	test   %eax,%eax
+  802485:	74 72                	je     8024f9 <devpipe_read+0xe1>
+            sys_yield();
+  802487:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  80248a:	8b 03                	mov    (%rbx),%eax
+  80248c:	3b 43 04             	cmp    0x4(%rbx),%eax
+  80248f:	74 df                	je     802470 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802491:	48 63 c8             	movslq %eax,%rcx
+  802494:	48 89 ca             	mov    %rcx,%rdx
+  802497:	48 c1 ea 03          	shr    $0x3,%rdx
+  80249b:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  8024a2:	08 10 20 
+  8024a5:	48 89 d0             	mov    %rdx,%rax
+  8024a8:	48 f7 e6             	mul    %rsi
+  8024ab:	48 c1 ea 06          	shr    $0x6,%rdx
+  8024af:	48 89 d0             	mov    %rdx,%rax
+  8024b2:	48 c1 e0 09          	shl    $0x9,%rax
+  8024b6:	48 29 d0             	sub    %rdx,%rax
+  8024b9:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  8024c0:	00 
+  8024c1:	48 89 c8             	mov    %rcx,%rax
+  8024c4:	48 29 d0             	sub    %rdx,%rax
+  8024c7:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  8024cc:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8024d0:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  8024d4:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8024d7:	49 83 c7 01          	add    $0x1,%r15
+  8024db:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  8024df:	75 83                	jne    802464 <devpipe_read+0x4c>
+    return n;
+  8024e1:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8024e5:	eb 03                	jmp    8024ea <devpipe_read+0xd2>
+            if (i > 0) return i;
+  8024e7:	4c 89 f8             	mov    %r15,%rax
+}
+  8024ea:	48 83 c4 18          	add    $0x18,%rsp
+  8024ee:	5b                   	pop    %rbx
+  8024ef:	41 5c                	pop    %r12
+  8024f1:	41 5d                	pop    %r13
+  8024f3:	41 5e                	pop    %r14
+  8024f5:	41 5f                	pop    %r15
+  8024f7:	5d                   	pop    %rbp
+  8024f8:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  8024f9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024fe:	eb ea                	jmp    8024ea <devpipe_read+0xd2>
+
+0000000000802500 <pipe>:
+pipe(int pfd[2]) {
+  802500:	55                   	push   %rbp
+  802501:	48 89 e5             	mov    %rsp,%rbp
+  802504:	41 55                	push   %r13
+  802506:	41 54                	push   %r12
+  802508:	53                   	push   %rbx
+  802509:	48 81 ec b8 00 00 00 	sub    $0xb8,%rsp
+  802510:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  802513:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802517:	48 b8 79 17 80 00 00 	movabs $0x801779,%rax
+  80251e:	00 00 00 
+  802521:	ff d0                	call   *%rax
+  802523:	89 c3                	mov    %eax,%ebx
+  802525:	85 c0                	test   %eax,%eax
+  802527:	0f 88 51 01 00 00    	js     80267e <pipe+0x17e>
+        (res = fd_alloc_from(fd2num(fd0) + 1, &fd1)) < 0) goto err;
+  80252d:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802531:	48 b8 d2 16 80 00 00 	movabs $0x8016d2,%rax
+  802538:	00 00 00 
+  80253b:	ff d0                	call   *%rax
+  80253d:	8d 78 01             	lea    0x1(%rax),%edi
+  802540:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802544:	48 b8 00 17 80 00 00 	movabs $0x801700,%rax
+  80254b:	00 00 00 
+  80254e:	ff d0                	call   *%rax
+  802550:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  802552:	85 c0                	test   %eax,%eax
+  802554:	0f 88 24 01 00 00    	js     80267e <pipe+0x17e>
+    va = fd2data(fd0);
+  80255a:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80255e:	48 bb e4 16 80 00 00 	movabs $0x8016e4,%rbx
+  802565:	00 00 00 
+  802568:	ff d3                	call   *%rbx
+  80256a:	49 89 c5             	mov    %rax,%r13
+    struct RegionOp ops[] = {
+  80256d:	48 8d bd 30 ff ff ff 	lea    -0xd0(%rbp),%rdi
+  802574:	b9 14 00 00 00       	mov    $0x14,%ecx
+  802579:	b8 00 00 00 00       	mov    $0x0,%eax
+  80257e:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+  802581:	c7 85 34 ff ff ff 46 	movl   $0x46,-0xcc(%rbp)
+  802588:	00 00 00 
+  80258b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80258f:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+  802596:	48 c7 85 50 ff ff ff 	movq   $0x1000,-0xb0(%rbp)
+  80259d:	00 10 00 00 
+  8025a1:	c7 85 5c ff ff ff 46 	movl   $0x46,-0xa4(%rbp)
+  8025a8:	00 00 00 
+            {.type = REGION_ALLOC, .dstva = (uintptr_t)fd1, .size = PAGE_SIZE, .perm = PROT_RW | PROT_SHARE},
+  8025ab:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+    struct RegionOp ops[] = {
+  8025af:	48 89 bd 70 ff ff ff 	mov    %rdi,-0x90(%rbp)
+  8025b6:	48 c7 85 78 ff ff ff 	movq   $0x1000,-0x88(%rbp)
+  8025bd:	00 10 00 00 
+  8025c1:	c7 45 84 46 00 00 00 	movl   $0x46,-0x7c(%rbp)
+  8025c8:	4c 89 6d 98          	mov    %r13,-0x68(%rbp)
+  8025cc:	48 c7 45 a0 00 10 00 	movq   $0x1000,-0x60(%rbp)
+  8025d3:	00 
+  8025d4:	c7 45 a8 01 00 00 00 	movl   $0x1,-0x58(%rbp)
+  8025db:	c7 45 ac 46 00 00 00 	movl   $0x46,-0x54(%rbp)
+  8025e2:	4c 89 6d b8          	mov    %r13,-0x48(%rbp)
+            {.type = REGION_MAP, .srcva = (uintptr_t)va, .dstva = (uintptr_t)fd2data(fd1), .size = PAGE_SIZE, .perm = PROT_RW | PROT_SHARE},
+  8025e6:	ff d3                	call   *%rbx
+    struct RegionOp ops[] = {
+  8025e8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8025ec:	48 c7 45 c8 00 10 00 	movq   $0x1000,-0x38(%rbp)
+  8025f3:	00 
+    if ((res = sys_region_batch(ops, sizeof ops / sizeof *ops)) < 0) goto err1;
+  8025f4:	be 04 00 00 00       	mov    $0x4,%esi
+  8025f9:	48 8d bd 30 ff ff ff 	lea    -0xd0(%rbp),%rdi
+  802600:	48 b8 66 12 80 00 00 	movabs $0x801266,%rax
+  802607:	00 00 00 
+  80260a:	ff d0                	call   *%rax
+  80260c:	89 c3                	mov    %eax,%ebx
+  80260e:	85 c0                	test   %eax,%eax
+  802610:	0f 88 ad 00 00 00    	js     8026c3 <pipe+0x1c3>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  802616:	be 00 10 00 00       	mov    $0x1000,%esi
+  80261b:	4c 89 ef             	mov    %r13,%rdi
+  80261e:	48 b8 d5 10 80 00 00 	movabs $0x8010d5,%rax
+  802625:	00 00 00 
+  802628:	ff d0                	call   *%rax
+  80262a:	83 f8 02             	cmp    $0x2,%eax
+  80262d:	75 5f                	jne    80268e <pipe+0x18e>
+    fd0->fd_dev_id = devpipe.dev_id;
+  80262f:	a1 60 40 80 00 00 00 	movabs 0x804060,%eax
+  802636:	00 00 
+  802638:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80263c:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  80263e:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802642:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  802649:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  80264d:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  80264f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802653:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  80265a:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80265e:	48 bb d2 16 80 00 00 	movabs $0x8016d2,%rbx
+  802665:	00 00 00 
+  802668:	ff d3                	call   *%rbx
+  80266a:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  80266e:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  802672:	ff d3                	call   *%rbx
+  802674:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  802679:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  80267e:	89 d8                	mov    %ebx,%eax
+  802680:	48 81 c4 b8 00 00 00 	add    $0xb8,%rsp
+  802687:	5b                   	pop    %rbx
+  802688:	41 5c                	pop    %r12
+  80268a:	41 5d                	pop    %r13
+  80268c:	5d                   	pop    %rbp
+  80268d:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  80268e:	48 b9 d0 35 80 00 00 	movabs $0x8035d0,%rcx
+  802695:	00 00 00 
+  802698:	48 ba a7 35 80 00 00 	movabs $0x8035a7,%rdx
+  80269f:	00 00 00 
+  8026a2:	be 33 00 00 00       	mov    $0x33,%esi
+  8026a7:	48 bf bc 35 80 00 00 	movabs $0x8035bc,%rdi
+  8026ae:	00 00 00 
+  8026b1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8026b6:	49 b8 28 2c 80 00 00 	movabs $0x802c28,%r8
+  8026bd:	00 00 00 
+  8026c0:	41 ff d0             	call   *%r8
+        ops[i].type = REGION_UNMAP;
+  8026c3:	c7 85 30 ff ff ff 02 	movl   $0x2,-0xd0(%rbp)
+  8026ca:	00 00 00 
+  8026cd:	c7 85 58 ff ff ff 02 	movl   $0x2,-0xa8(%rbp)
+  8026d4:	00 00 00 
+  8026d7:	c7 45 80 02 00 00 00 	movl   $0x2,-0x80(%rbp)
+  8026de:	c7 45 a8 02 00 00 00 	movl   $0x2,-0x58(%rbp)
+    sys_region_batch(ops, sizeof ops / sizeof *ops);
+  8026e5:	be 04 00 00 00       	mov    $0x4,%esi
+  8026ea:	48 8d bd 30 ff ff ff 	lea    -0xd0(%rbp),%rdi
+  8026f1:	48 b8 66 12 80 00 00 	movabs $0x801266,%rax
+  8026f8:	00 00 00 
+  8026fb:	ff d0                	call   *%rax
+  8026fd:	e9 7c ff ff ff       	jmp    80267e <pipe+0x17e>
+
+0000000000802702 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  802702:	55                   	push   %rbp
+  802703:	48 89 e5             	mov    %rsp,%rbp
+  802706:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  80270a:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80270e:	48 b8 93 17 80 00 00 	movabs $0x801793,%rax
+  802715:	00 00 00 
+  802718:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80271a:	85 c0                	test   %eax,%eax
+  80271c:	78 35                	js     802753 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  80271e:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802722:	48 b8 e4 16 80 00 00 	movabs $0x8016e4,%rax
+  802729:	00 00 00 
+  80272c:	ff d0                	call   *%rax
+  80272e:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802731:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802736:	be 00 10 00 00       	mov    $0x1000,%esi
+  80273b:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80273f:	48 b8 07 11 80 00 00 	movabs $0x801107,%rax
+  802746:	00 00 00 
+  802749:	ff d0                	call   *%rax
+  80274b:	85 c0                	test   %eax,%eax
+  80274d:	0f 94 c0             	sete   %al
+  802750:	0f b6 c0             	movzbl %al,%eax
+}
+  802753:	c9                   	leave
+  802754:	c3                   	ret
+
+0000000000802755 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  802755:	48 89 f8             	mov    %rdi,%rax
+  802758:	48 c1 e8 27          	shr    $0x27,%rax
+  80275c:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  802763:	01 00 00 
+  802766:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80276a:	f6 c2 01             	test   $0x1,%dl
+  80276d:	74 6d                	je     8027dc <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  80276f:	48 89 f8             	mov    %rdi,%rax
+  802772:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802776:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  80277d:	01 00 00 
+  802780:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802784:	f6 c2 01             	test   $0x1,%dl
+  802787:	74 62                	je     8027eb <get_uvpt_entry+0x96>
+  802789:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802790:	01 00 00 
+  802793:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802797:	f6 c2 80             	test   $0x80,%dl
+  80279a:	75 4f                	jne    8027eb <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  80279c:	48 89 f8             	mov    %rdi,%rax
+  80279f:	48 c1 e8 15          	shr    $0x15,%rax
+  8027a3:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8027aa:	01 00 00 
+  8027ad:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8027b1:	f6 c2 01             	test   $0x1,%dl
+  8027b4:	74 44                	je     8027fa <get_uvpt_entry+0xa5>
+  8027b6:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8027bd:	01 00 00 
+  8027c0:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8027c4:	f6 c2 80             	test   $0x80,%dl
+  8027c7:	75 31                	jne    8027fa <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  8027c9:	48 c1 ef 0c          	shr    $0xc,%rdi
+  8027cd:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8027d4:	01 00 00 
+  8027d7:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  8027db:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8027dc:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  8027e3:	01 00 00 
+  8027e6:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8027ea:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8027eb:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8027f2:	01 00 00 
+  8027f5:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8027f9:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8027fa:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802801:	01 00 00 
+  802804:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802808:	c3                   	ret
+
+0000000000802809 <get_prot>:
+
+int
+get_prot(void *va) {
+  802809:	55                   	push   %rbp
+  80280a:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  80280d:	48 b8 55 27 80 00 00 	movabs $0x802755,%rax
+  802814:	00 00 00 
+  802817:	ff d0                	call   *%rax
+  802819:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  80281c:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  802821:	89 c1                	mov    %eax,%ecx
+  802823:	83 c9 04             	or     $0x4,%ecx
+  802826:	f6 c2 01             	test   $0x1,%dl
+  802829:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  80282c:	89 c1                	mov    %eax,%ecx
+  80282e:	83 c9 02             	or     $0x2,%ecx
+  802831:	f6 c2 02             	test   $0x2,%dl
+  802834:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  802837:	89 c1                	mov    %eax,%ecx
+  802839:	83 c9 01             	or     $0x1,%ecx
+  80283c:	48 85 d2             	test   %rdx,%rdx
+  80283f:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  802842:	89 c1                	mov    %eax,%ecx
+  802844:	83 c9 40             	or     $0x40,%ecx
+  802847:	f6 c6 04             	test   $0x4,%dh
+  80284a:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  80284d:	5d                   	pop    %rbp
+  80284e:	c3                   	ret
+
+000000000080284f <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  80284f:	55                   	push   %rbp
+  802850:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  802853:	48 b8 55 27 80 00 00 	movabs $0x802755,%rax
+  80285a:	00 00 00 
+  80285d:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  80285f:	48 c1 e8 06          	shr    $0x6,%rax
+  802863:	83 e0 01             	and    $0x1,%eax
+}
+  802866:	5d                   	pop    %rbp
+  802867:	c3                   	ret
+
+0000000000802868 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  802868:	55                   	push   %rbp
+  802869:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  80286c:	48 b8 55 27 80 00 00 	movabs $0x802755,%rax
+  802873:	00 00 00 
+  802876:	ff d0                	call   *%rax
+  802878:	83 e0 01             	and    $0x1,%eax
+}
+  80287b:	5d                   	pop    %rbp
+  80287c:	c3                   	ret
+
+000000000080287d <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  80287d:	55                   	push   %rbp
+  80287e:	48 89 e5             	mov    %rsp,%rbp
+  802881:	41 57                	push   %r15
+  802883:	41 56                	push   %r14
+  802885:	41 55                	push   %r13
+  802887:	41 54                	push   %r12
+  802889:	53                   	push   %rbx
+  80288a:	48 83 ec 38          	sub    $0x38,%rsp
+  80288e:	49 89 f7             	mov    %rsi,%r15
+  802891:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+                    }
+                    continue;
+                }
+                for (int ptei = 0; ptei < PT_ENTRY_COUNT; ptei++) {
+                    uintptr_t pte_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, pdei, ptei, 0);
+                    pte_t pte = uvpt[VPT(pte_addr)];
+  802897:	49 bd 00 00 00 00 00 	movabs $0x10000000000,%r13
+  80289e:	01 00 00 
+  8028a1:	4d 89 e6             	mov    %r12,%r14
+  8028a4:	49 89 fc             	mov    %rdi,%r12
+  8028a7:	e9 19 01 00 00       	jmp    8029c5 <foreach_shared_region+0x148>
+  8028ac:	48 89 5d b0          	mov    %rbx,-0x50(%rbp)
+  8028b0:	4c 89 75 a8          	mov    %r14,-0x58(%rbp)
+  8028b4:	eb 52                	jmp    802908 <foreach_shared_region+0x8b>
+                for (int ptei = 0; ptei < PT_ENTRY_COUNT; ptei++) {
+  8028b6:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8028bd:	48 81 fb 00 00 20 00 	cmp    $0x200000,%rbx
+  8028c4:	74 2e                	je     8028f4 <foreach_shared_region+0x77>
+                    uintptr_t pte_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, pdei, ptei, 0);
+  8028c6:	48 89 df             	mov    %rbx,%rdi
+  8028c9:	4c 09 f7             	or     %r14,%rdi
+                    pte_t pte = uvpt[VPT(pte_addr)];
+  8028cc:	48 89 f8             	mov    %rdi,%rax
+  8028cf:	48 c1 e8 0c          	shr    $0xc,%rax
+  8028d3:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+                    if ((pte & PTE_P) && (pte & PTE_SHARE)) {
+  8028d8:	25 01 04 00 00       	and    $0x401,%eax
+  8028dd:	48 3d 01 04 00 00    	cmp    $0x401,%rax
+  8028e3:	75 d1                	jne    8028b6 <foreach_shared_region+0x39>
+                        fun((void*)pte_addr, (void*)(pte_addr + PAGE_SIZE), arg);
+  8028e5:	48 8d b7 00 10 00 00 	lea    0x1000(%rdi),%rsi
+  8028ec:	4c 89 fa             	mov    %r15,%rdx
+  8028ef:	41 ff d4             	call   *%r12
+  8028f2:	eb c2                	jmp    8028b6 <foreach_shared_region+0x39>
+            for (int pdei = 0; pdei < PD_ENTRY_COUNT; pdei++) {
+  8028f4:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  8028fb:	00 
+  8028fc:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802900:	48 3d 00 00 00 40    	cmp    $0x40000000,%rax
+  802906:	74 46                	je     80294e <foreach_shared_region+0xd1>
+                uintptr_t pde_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, pdei, 0, 0);
+  802908:	4c 8b 75 c8          	mov    -0x38(%rbp),%r14
+  80290c:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802910:	49 09 c6             	or     %rax,%r14
+                pde_t pde = uvpd[VPD(pde_addr)];
+  802913:	4c 89 f0             	mov    %r14,%rax
+  802916:	48 c1 e8 15          	shr    $0x15,%rax
+  80291a:	48 b9 00 00 00 80 00 	movabs $0x10080000000,%rcx
+  802921:	01 00 00 
+  802924:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+                if (!(pde & PTE_P)) {
+  802928:	a8 01                	test   $0x1,%al
+  80292a:	74 c8                	je     8028f4 <foreach_shared_region+0x77>
+                if (pde & PTE_PS) {
+  80292c:	48 89 c3             	mov    %rax,%rbx
+  80292f:	81 e3 80 00 00 00    	and    $0x80,%ebx
+  802935:	74 8f                	je     8028c6 <foreach_shared_region+0x49>
+                    if (pde & PTE_SHARE) {
+  802937:	f6 c4 04             	test   $0x4,%ah
+  80293a:	74 b8                	je     8028f4 <foreach_shared_region+0x77>
+                        fun((void*)pde_addr, (void*)(pde_addr + 1024 * 1024 * 2), arg);
+  80293c:	49 8d b6 00 00 20 00 	lea    0x200000(%r14),%rsi
+  802943:	4c 89 fa             	mov    %r15,%rdx
+  802946:	4c 89 f7             	mov    %r14,%rdi
+  802949:	41 ff d4             	call   *%r12
+  80294c:	eb a6                	jmp    8028f4 <foreach_shared_region+0x77>
+  80294e:	48 8b 5d b0          	mov    -0x50(%rbp),%rbx
+  802952:	4c 8b 75 a8          	mov    -0x58(%rbp),%r14
+        for (int pdpei = 0; pdpei < PDP_ENTRY_COUNT; pdpei++) {
+  802956:	48 81 c3 00 00 00 40 	add    $0x40000000,%rbx
+  80295d:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802964:	00 00 00 
+  802967:	48 39 c3             	cmp    %rax,%rbx
+  80296a:	74 4c                	je     8029b8 <foreach_shared_region+0x13b>
+            uintptr_t pdpe_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, 0, 0, 0);
+  80296c:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802970:	48 09 d8             	or     %rbx,%rax
+  802973:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+            pdpe_t pdpe = uvpdp[VPDP(pdpe_addr)];
+  802977:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80297b:	48 b9 00 00 40 80 00 	movabs $0x10080400000,%rcx
+  802982:	01 00 00 
+  802985:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+            if (!(pdpe & PTE_P)) {
+  802989:	a8 01                	test   $0x1,%al
+  80298b:	74 c9                	je     802956 <foreach_shared_region+0xd9>
+            if (pdpe & PTE_PS) {
+  80298d:	48 89 c1             	mov    %rax,%rcx
+  802990:	81 e1 80 00 00 00    	and    $0x80,%ecx
+  802996:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  80299a:	0f 84 0c ff ff ff    	je     8028ac <foreach_shared_region+0x2f>
+                if (pdpe & PTE_SHARE) {
+  8029a0:	f6 c4 04             	test   $0x4,%ah
+  8029a3:	74 b1                	je     802956 <foreach_shared_region+0xd9>
+                    fun((void*)pdpe_addr, (void*)(pdpe_addr + 1024 * 1024 * 1024), arg); 
+  8029a5:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  8029a9:	48 8d b7 00 00 00 40 	lea    0x40000000(%rdi),%rsi
+  8029b0:	4c 89 fa             	mov    %r15,%rdx
+  8029b3:	41 ff d4             	call   *%r12
+  8029b6:	eb 9e                	jmp    802956 <foreach_shared_region+0xd9>
+    for (int pml4ei = 0; pml4ei < PML4_ENTRY_COUNT; pml4ei++) {
+  8029b8:	49 83 c6 01          	add    $0x1,%r14
+  8029bc:	49 81 fe 00 02 00 00 	cmp    $0x200,%r14
+  8029c3:	74 24                	je     8029e9 <foreach_shared_region+0x16c>
+        pml4e_t pml4e = uvpml4[VPML4(pml4_addr)];
+  8029c5:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  8029cc:	01 00 00 
+  8029cf:	4a 8b 04 f0          	mov    (%rax,%r14,8),%rax
+        if (!(pml4e & PTE_P)) {
+  8029d3:	a8 01                	test   $0x1,%al
+  8029d5:	74 e1                	je     8029b8 <foreach_shared_region+0x13b>
+  8029d7:	4c 89 f0             	mov    %r14,%rax
+  8029da:	48 c1 e0 27          	shl    $0x27,%rax
+  8029de:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8029e2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8029e7:	eb 83                	jmp    80296c <foreach_shared_region+0xef>
+            }
+        }
+    }
+    
+    return 0;
+}
+  8029e9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029ee:	48 83 c4 38          	add    $0x38,%rsp
+  8029f2:	5b                   	pop    %rbx
+  8029f3:	41 5c                	pop    %r12
+  8029f5:	41 5d                	pop    %r13
+  8029f7:	41 5e                	pop    %r14
+  8029f9:	41 5f                	pop    %r15
+  8029fb:	5d                   	pop    %rbp
+  8029fc:	c3                   	ret
+
+00000000008029fd <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  8029fd:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a02:	c3                   	ret
+
+0000000000802a03 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  802a03:	55                   	push   %rbp
+  802a04:	48 89 e5             	mov    %rsp,%rbp
+  802a07:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  802a0a:	48 be f4 35 80 00 00 	movabs $0x8035f4,%rsi
+  802a11:	00 00 00 
+  802a14:	48 b8 83 0b 80 00 00 	movabs $0x800b83,%rax
+  802a1b:	00 00 00 
+  802a1e:	ff d0                	call   *%rax
+    return 0;
+}
+  802a20:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a25:	5d                   	pop    %rbp
+  802a26:	c3                   	ret
+
+0000000000802a27 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  802a27:	55                   	push   %rbp
+  802a28:	48 89 e5             	mov    %rsp,%rbp
+  802a2b:	41 57                	push   %r15
+  802a2d:	41 56                	push   %r14
+  802a2f:	41 55                	push   %r13
+  802a31:	41 54                	push   %r12
+  802a33:	53                   	push   %rbx
+  802a34:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  802a3b:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  802a42:	48 85 d2             	test   %rdx,%rdx
+  802a45:	74 7a                	je     802ac1 <devcons_write+0x9a>
+  802a47:	49 89 d6             	mov    %rdx,%r14
+  802a4a:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802a50:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  802a55:	49 bf 7d 0d 80 00 00 	movabs $0x800d7d,%r15
+  802a5c:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  802a5f:	4c 89 f3             	mov    %r14,%rbx
+  802a62:	48 29 f3             	sub    %rsi,%rbx
+  802a65:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802a6a:	48 39 c3             	cmp    %rax,%rbx
+  802a6d:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  802a71:	4c 63 eb             	movslq %ebx,%r13
+  802a74:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  802a7b:	48 01 c6             	add    %rax,%rsi
+  802a7e:	4c 89 ea             	mov    %r13,%rdx
+  802a81:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802a88:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  802a8b:	4c 89 ee             	mov    %r13,%rsi
+  802a8e:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802a95:	48 b8 aa 0f 80 00 00 	movabs $0x800faa,%rax
+  802a9c:	00 00 00 
+  802a9f:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  802aa1:	41 01 dc             	add    %ebx,%r12d
+  802aa4:	49 63 f4             	movslq %r12d,%rsi
+  802aa7:	4c 39 f6             	cmp    %r14,%rsi
+  802aaa:	72 b3                	jb     802a5f <devcons_write+0x38>
+    return res;
+  802aac:	49 63 c4             	movslq %r12d,%rax
+}
+  802aaf:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  802ab6:	5b                   	pop    %rbx
+  802ab7:	41 5c                	pop    %r12
+  802ab9:	41 5d                	pop    %r13
+  802abb:	41 5e                	pop    %r14
+  802abd:	41 5f                	pop    %r15
+  802abf:	5d                   	pop    %rbp
+  802ac0:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  802ac1:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802ac7:	eb e3                	jmp    802aac <devcons_write+0x85>
+
+0000000000802ac9 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  802ac9:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  802acc:	ba 00 00 00 00       	mov    $0x0,%edx
+  802ad1:	48 85 c0             	test   %rax,%rax
+  802ad4:	74 55                	je     802b2b <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  802ad6:	55                   	push   %rbp
+  802ad7:	48 89 e5             	mov    %rsp,%rbp
+  802ada:	41 55                	push   %r13
+  802adc:	41 54                	push   %r12
+  802ade:	53                   	push   %rbx
+  802adf:	48 83 ec 08          	sub    $0x8,%rsp
+  802ae3:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  802ae6:	48 bb d7 0f 80 00 00 	movabs $0x800fd7,%rbx
+  802aed:	00 00 00 
+  802af0:	49 bc a4 10 80 00 00 	movabs $0x8010a4,%r12
+  802af7:	00 00 00 
+  802afa:	eb 03                	jmp    802aff <devcons_read+0x36>
+  802afc:	41 ff d4             	call   *%r12
+  802aff:	ff d3                	call   *%rbx
+  802b01:	85 c0                	test   %eax,%eax
+  802b03:	74 f7                	je     802afc <devcons_read+0x33>
+    if (c < 0) return c;
+  802b05:	48 63 d0             	movslq %eax,%rdx
+  802b08:	78 13                	js     802b1d <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  802b0a:	ba 00 00 00 00       	mov    $0x0,%edx
+  802b0f:	83 f8 04             	cmp    $0x4,%eax
+  802b12:	74 09                	je     802b1d <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  802b14:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  802b18:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  802b1d:	48 89 d0             	mov    %rdx,%rax
+  802b20:	48 83 c4 08          	add    $0x8,%rsp
+  802b24:	5b                   	pop    %rbx
+  802b25:	41 5c                	pop    %r12
+  802b27:	41 5d                	pop    %r13
+  802b29:	5d                   	pop    %rbp
+  802b2a:	c3                   	ret
+  802b2b:	48 89 d0             	mov    %rdx,%rax
+  802b2e:	c3                   	ret
+
+0000000000802b2f <cputchar>:
+cputchar(int ch) {
+  802b2f:	55                   	push   %rbp
+  802b30:	48 89 e5             	mov    %rsp,%rbp
+  802b33:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  802b37:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  802b3b:	be 01 00 00 00       	mov    $0x1,%esi
+  802b40:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  802b44:	48 b8 aa 0f 80 00 00 	movabs $0x800faa,%rax
+  802b4b:	00 00 00 
+  802b4e:	ff d0                	call   *%rax
+}
+  802b50:	c9                   	leave
+  802b51:	c3                   	ret
+
+0000000000802b52 <getchar>:
+getchar(void) {
+  802b52:	55                   	push   %rbp
+  802b53:	48 89 e5             	mov    %rsp,%rbp
+  802b56:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  802b5a:	ba 01 00 00 00       	mov    $0x1,%edx
+  802b5f:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  802b63:	bf 00 00 00 00       	mov    $0x0,%edi
+  802b68:	48 b8 76 1a 80 00 00 	movabs $0x801a76,%rax
+  802b6f:	00 00 00 
+  802b72:	ff d0                	call   *%rax
+  802b74:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  802b76:	85 c0                	test   %eax,%eax
+  802b78:	78 06                	js     802b80 <getchar+0x2e>
+  802b7a:	74 08                	je     802b84 <getchar+0x32>
+  802b7c:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  802b80:	89 d0                	mov    %edx,%eax
+  802b82:	c9                   	leave
+  802b83:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  802b84:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  802b89:	eb f5                	jmp    802b80 <getchar+0x2e>
+
+0000000000802b8b <iscons>:
+iscons(int fdnum) {
+  802b8b:	55                   	push   %rbp
+  802b8c:	48 89 e5             	mov    %rsp,%rbp
+  802b8f:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  802b93:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802b97:	48 b8 93 17 80 00 00 	movabs $0x801793,%rax
+  802b9e:	00 00 00 
+  802ba1:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802ba3:	85 c0                	test   %eax,%eax
+  802ba5:	78 18                	js     802bbf <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  802ba7:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802bab:	48 b8 a0 40 80 00 00 	movabs $0x8040a0,%rax
+  802bb2:	00 00 00 
+  802bb5:	8b 00                	mov    (%rax),%eax
+  802bb7:	39 02                	cmp    %eax,(%rdx)
+  802bb9:	0f 94 c0             	sete   %al
+  802bbc:	0f b6 c0             	movzbl %al,%eax
+}
+  802bbf:	c9                   	leave
+  802bc0:	c3                   	ret
+
+0000000000802bc1 <opencons>:
+opencons(void) {
+  802bc1:	55                   	push   %rbp
+  802bc2:	48 89 e5             	mov    %rsp,%rbp
+  802bc5:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802bc9:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  802bcd:	48 b8 79 17 80 00 00 	movabs $0x801779,%rax
+  802bd4:	00 00 00 
+  802bd7:	ff d0                	call   *%rax
+  802bd9:	85 c0                	test   %eax,%eax
+  802bdb:	78 49                	js     802c26 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  802bdd:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802be2:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802be7:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  802beb:	bf 00 00 00 00       	mov    $0x0,%edi
+  802bf0:	48 b8 33 11 80 00 00 	movabs $0x801133,%rax
+  802bf7:	00 00 00 
+  802bfa:	ff d0                	call   *%rax
+  802bfc:	85 c0                	test   %eax,%eax
+  802bfe:	78 26                	js     802c26 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  802c00:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802c04:	a1 a0 40 80 00 00 00 	movabs 0x8040a0,%eax
+  802c0b:	00 00 
+  802c0d:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  802c0f:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802c13:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  802c1a:	48 b8 d2 16 80 00 00 	movabs $0x8016d2,%rax
+  802c21:	00 00 00 
+  802c24:	ff d0                	call   *%rax
+}
+  802c26:	c9                   	leave
+  802c27:	c3                   	ret
+
+0000000000802c28 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  802c28:	55                   	push   %rbp
+  802c29:	48 89 e5             	mov    %rsp,%rbp
+  802c2c:	41 56                	push   %r14
+  802c2e:	41 55                	push   %r13
+  802c30:	41 54                	push   %r12
+  802c32:	53                   	push   %rbx
+  802c33:	48 83 ec 50          	sub    $0x50,%rsp
+  802c37:	49 89 fc             	mov    %rdi,%r12
+  802c3a:	41 89 f5             	mov    %esi,%r13d
+  802c3d:	48 89 d3             	mov    %rdx,%rbx
+  802c40:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  802c44:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  802c48:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  802c4c:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  802c53:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802c57:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  802c5b:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  802c5f:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  802c63:	48 b8 00 40 80 00 00 	movabs $0x804000,%rax
+  802c6a:	00 00 00 
+  802c6d:	4c 8b 30             	mov    (%rax),%r14
+  802c70:	48 b8 73 10 80 00 00 	movabs $0x801073,%rax
+  802c77:	00 00 00 
+  802c7a:	ff d0                	call   *%rax
+  802c7c:	89 c6                	mov    %eax,%esi
+  802c7e:	45 89 e8             	mov    %r13d,%r8d
+  802c81:	4c 89 e1             	mov    %r12,%rcx
+  802c84:	4c 89 f2             	mov    %r14,%rdx
+  802c87:	48 bf 00 36 80 00 00 	movabs $0x803600,%rdi
+  802c8e:	00 00 00 
+  802c91:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c96:	49 bc 5e 02 80 00 00 	movabs $0x80025e,%r12
+  802c9d:	00 00 00 
+  802ca0:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  802ca3:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  802ca7:	48 89 df             	mov    %rbx,%rdi
+  802caa:	48 b8 fa 01 80 00 00 	movabs $0x8001fa,%rax
+  802cb1:	00 00 00 
+  802cb4:	ff d0                	call   *%rax
+    cprintf("\n");
+  802cb6:	48 bf 2c 2f 80 00 00 	movabs $0x802f2c,%rdi
+  802cbd:	00 00 00 
+  802cc0:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cc5:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  802cc8:	cc                   	int3
+  802cc9:	eb fd                	jmp    802cc8 <_panic+0xa0>
+
+0000000000802ccb <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  802ccb:	55                   	push   %rbp
+  802ccc:	48 89 e5             	mov    %rsp,%rbp
+  802ccf:	41 55                	push   %r13
+  802cd1:	41 54                	push   %r12
+  802cd3:	53                   	push   %rbx
+  802cd4:	48 83 ec 08          	sub    $0x8,%rsp
+  802cd8:	49 89 fc             	mov    %rdi,%r12
+  802cdb:	48 89 f7             	mov    %rsi,%rdi
+  802cde:	48 89 d3             	mov    %rdx,%rbx
+  802ce1:	49 89 cd             	mov    %rcx,%r13
+    // LAB 9: Your code here:
+    int res = sys_ipc_recv(!pg ? (void*)MAX_USER_ADDRESS : pg, !size ? 0 : *size);
+  802ce4:	be 00 00 00 00       	mov    $0x0,%esi
+  802ce9:	48 85 d2             	test   %rdx,%rdx
+  802cec:	74 03                	je     802cf1 <ipc_recv+0x26>
+  802cee:	48 8b 32             	mov    (%rdx),%rsi
+  802cf1:	48 85 ff             	test   %rdi,%rdi
+  802cf4:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802cfb:	00 00 00 
+  802cfe:	48 0f 44 f8          	cmove  %rax,%rdi
+  802d02:	48 b8 05 15 80 00 00 	movabs $0x801505,%rax
+  802d09:	00 00 00 
+  802d0c:	ff d0                	call   *%rax
+    if (res < 0) {
+  802d0e:	85 c0                	test   %eax,%eax
+  802d10:	78 66                	js     802d78 <ipc_recv+0xad>
+        if (size) {
+            *size = 0;
+        }
+        return res;
+    }
+    if (from_env_store) {
+  802d12:	4d 85 e4             	test   %r12,%r12
+  802d15:	74 14                	je     802d2b <ipc_recv+0x60>
+        *from_env_store = thisenv->env_ipc_from;
+  802d17:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802d1e:	00 00 00 
+  802d21:	8b 80 ac 01 00 00    	mov    0x1ac(%rax),%eax
+  802d27:	41 89 04 24          	mov    %eax,(%r12)
+    }
+    if (perm_store) {
+  802d2b:	4d 85 ed             	test   %r13,%r13
+  802d2e:	74 14                	je     802d44 <ipc_recv+0x79>
+        *perm_store = thisenv->env_ipc_perm;
+  802d30:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802d37:	00 00 00 
+  802d3a:	8b 80 b0 01 00 00    	mov    0x1b0(%rax),%eax
+  802d40:	41 89 45 00          	mov    %eax,0x0(%r13)
+    }
+    if (size) {
+  802d44:	48 85 db             	test   %rbx,%rbx
+  802d47:	74 14                	je     802d5d <ipc_recv+0x92>
+        *size = thisenv->env_ipc_maxsz;
+  802d49:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802d50:	00 00 00 
+  802d53:	48 8b 80 a0 01 00 00 	mov    0x1a0(%rax),%rax
+  802d5a:	48 89 03             	mov    %rax,(%rbx)
+    }
+    return thisenv->env_ipc_value;
+  802d5d:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802d64:	00 00 00 
+  802d67:	8b 80 a8 01 00 00    	mov    0x1a8(%rax),%eax
+}
+  802d6d:	48 83 c4 08          	add    $0x8,%rsp
+  802d71:	5b                   	pop    %rbx
+  802d72:	41 5c                	pop    %r12
+  802d74:	41 5d                	pop    %r13
+  802d76:	5d                   	pop    %rbp
+  802d77:	c3                   	ret
+        if (from_env_store) {
+  802d78:	4d 85 e4             	test   %r12,%r12
+  802d7b:	74 08                	je     802d85 <ipc_recv+0xba>
+            *from_env_store = 0;
+  802d7d:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  802d84:	00 
+        if (perm_store) {
+  802d85:	4d 85 ed             	test   %r13,%r13
+  802d88:	74 08                	je     802d92 <ipc_recv+0xc7>
+            *perm_store = 0;
+  802d8a:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  802d91:	00 
+        if (size) {
+  802d92:	48 85 db             	test   %rbx,%rbx
+  802d95:	74 d6                	je     802d6d <ipc_recv+0xa2>
+            *size = 0;
+  802d97:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  802d9e:	eb cd                	jmp    802d6d <ipc_recv+0xa2>
+
+0000000000802da0 <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  802da0:	55                   	push   %rbp
+  802da1:	48 89 e5             	mov    %rsp,%rbp
+  802da4:	41 57                	push   %r15
+  802da6:	41 56                	push   %r14
+  802da8:	41 55                	push   %r13
+  802daa:	41 54                	push   %r12
+  802dac:	53                   	push   %rbx
+  802dad:	48 83 ec 18          	sub    $0x18,%rsp
+  802db1:	41 89 fd             	mov    %edi,%r13d
+  802db4:	89 75 cc             	mov    %esi,-0x34(%rbp)
+  802db7:	49 89 cc             	mov    %rcx,%r12
+  802dba:	44 89 45 c8          	mov    %r8d,-0x38(%rbp)
+    // LAB 9: Your code here:
+    int res = 0;
+    while ((res = sys_ipc_try_send(to_env, val, !pg ? (void*)MAX_USER_ADDRESS : pg, size, perm)) < 0) {
+  802dbe:	48 85 d2             	test   %rdx,%rdx
+  802dc1:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802dc8:	00 00 00 
+  802dcb:	48 0f 45 c2          	cmovne %rdx,%rax
+  802dcf:	48 89 c3             	mov    %rax,%rbx
+  802dd2:	49 be d9 14 80 00 00 	movabs $0x8014d9,%r14
+  802dd9:	00 00 00 
+        if (res != -E_IPC_NOT_RECV) {
+            panic("sys_ipc_try_send failed: %i", res);
+        }
+        sys_yield();
+  802ddc:	49 bf a4 10 80 00 00 	movabs $0x8010a4,%r15
+  802de3:	00 00 00 
+    while ((res = sys_ipc_try_send(to_env, val, !pg ? (void*)MAX_USER_ADDRESS : pg, size, perm)) < 0) {
+  802de6:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  802de9:	44 8b 45 c8          	mov    -0x38(%rbp),%r8d
+  802ded:	4c 89 e1             	mov    %r12,%rcx
+  802df0:	48 89 da             	mov    %rbx,%rdx
+  802df3:	44 89 ef             	mov    %r13d,%edi
+  802df6:	41 ff d6             	call   *%r14
+  802df9:	85 c0                	test   %eax,%eax
+  802dfb:	79 37                	jns    802e34 <ipc_send+0x94>
+        if (res != -E_IPC_NOT_RECV) {
+  802dfd:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  802e00:	75 05                	jne    802e07 <ipc_send+0x67>
+        sys_yield();
+  802e02:	41 ff d7             	call   *%r15
+  802e05:	eb df                	jmp    802de6 <ipc_send+0x46>
+            panic("sys_ipc_try_send failed: %i", res);
+  802e07:	89 c1                	mov    %eax,%ecx
+  802e09:	48 ba 23 36 80 00 00 	movabs $0x803623,%rdx
+  802e10:	00 00 00 
+  802e13:	be 40 00 00 00       	mov    $0x40,%esi
+  802e18:	48 bf 3f 36 80 00 00 	movabs $0x80363f,%rdi
+  802e1f:	00 00 00 
+  802e22:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e27:	49 b8 28 2c 80 00 00 	movabs $0x802c28,%r8
+  802e2e:	00 00 00 
+  802e31:	41 ff d0             	call   *%r8
+    }
+    return;
+}
+  802e34:	48 83 c4 18          	add    $0x18,%rsp
+  802e38:	5b                   	pop    %rbx
+  802e39:	41 5c                	pop    %r12
+  802e3b:	41 5d                	pop    %r13
+  802e3d:	41 5e                	pop    %r14
+  802e3f:	41 5f                	pop    %r15
+  802e41:	5d                   	pop    %rbp
+  802e42:	c3                   	ret
+
+0000000000802e43 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  802e43:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  802e48:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  802e4f:	00 00 00 
+  802e52:	48 69 d0 d0 01 00 00 	imul   $0x1d0,%rax,%rdx
+  802e59:	48 01 ca             	add    %rcx,%rdx
+  802e5c:	8b 92 e8 00 00 00    	mov    0xe8(%rdx),%edx
+  802e62:	39 fa                	cmp    %edi,%edx
+  802e64:	74 12                	je     802e78 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  802e66:	48 83 c0 01          	add    $0x1,%rax
+  802e6a:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  802e70:	75 e0                	jne    802e52 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  802e72:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802e77:	c3                   	ret
+            return envs[i].env_id;
+  802e78:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+  802e7f:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  802e86:	00 00 00 
+  802e89:	48 01 d0             	add    %rdx,%rax
+  802e8c:	8b 80 e0 00 00 00    	mov    0xe0(%rax),%eax
+  802e92:	c3                   	ret
+  802e93:	0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+
+0000000000802e98 <__rodata_start>:
+  802e98:	49 20 61 6d          	rex.WB and %spl,0x6d(%r9)
+  802e9c:	20 74 68 65          	and    %dh,0x65(%rax,%rbp,2)
+  802ea0:	20 70 61             	and    %dh,0x61(%rax)
+  802ea3:	72 65                	jb     802f0a <__rodata_start+0x72>
+  802ea5:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802ea6:	74 2e                	je     802ed6 <__rodata_start+0x3e>
+  802ea8:	20 20                	and    %ah,(%rax)
+  802eaa:	46 6f                	rex.RX outsl %ds:(%rsi),(%dx)
+  802eac:	72 6b                	jb     802f19 <__rodata_start+0x81>
+  802eae:	69 6e 67 20 74 68 65 	imul   $0x65687420,0x67(%rsi),%ebp
+  802eb5:	20 63 68             	and    %ah,0x68(%rbx)
+  802eb8:	69 6c 64 2e 2e 2e 0a 	imul   $0xa2e2e,0x2e(%rsp,%riz,2),%ebp
+  802ebf:	00 
+  802ec0:	49 20 61 6d          	rex.WB and %spl,0x6d(%r9)
+  802ec4:	20 74 68 65          	and    %dh,0x65(%rax,%rbp,2)
+  802ec8:	20 70 61             	and    %dh,0x61(%rax)
+  802ecb:	72 65                	jb     802f32 <__rodata_start+0x9a>
+  802ecd:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802ece:	74 2e                	je     802efe <__rodata_start+0x66>
+  802ed0:	20 20                	and    %ah,(%rax)
+  802ed2:	52                   	push   %rdx
+  802ed3:	75 6e                	jne    802f43 <__rodata_start+0xab>
+  802ed5:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802ed6:	69 6e 67 20 74 68 65 	imul   $0x65687420,0x67(%rsi),%ebp
+  802edd:	20 63 68             	and    %ah,0x68(%rbx)
+  802ee0:	69 6c 64 2e 2e 2e 0a 	imul   $0xa2e2e,0x2e(%rsp,%riz,2),%ebp
+  802ee7:	00 
+  802ee8:	49 20 61 6d          	rex.WB and %spl,0x6d(%r9)
+  802eec:	20 74 68 65          	and    %dh,0x65(%rax,%rbp,2)
+  802ef0:	20 70 61             	and    %dh,0x61(%rax)
+  802ef3:	72 65                	jb     802f5a <__rodata_start+0xc2>
+  802ef5:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802ef6:	74 2e                	je     802f26 <__rodata_start+0x8e>
+  802ef8:	20 20                	and    %ah,(%rax)
+  802efa:	4b 69 6c 6c 69 6e 67 	imul   $0x7420676e,0x69(%r12,%r13,2),%rbp
+  802f01:	20 74 
+  802f03:	68 65 20 63 68       	push   $0x68632065
+  802f08:	69 6c 64 2e 2e 2e 0a 	imul   $0xa2e2e,0x2e(%rsp,%riz,2),%ebp
+  802f0f:	00 
+  802f10:	49 20 61 6d          	rex.WB and %spl,0x6d(%r9)
+  802f14:	20 74 68 65          	and    %dh,0x65(%rax,%rbp,2)
+  802f18:	20 63 68             	and    %ah,0x68(%rbx)
+  802f1b:	69 6c 64 2e 20 20 53 	imul   $0x70532020,0x2e(%rsp,%riz,2),%ebp
+  802f22:	70 
+  802f23:	69 6e 6e 69 6e 67 2e 	imul   $0x2e676e69,0x6e(%rsi),%ebp
+  802f2a:	2e 2e 0a 00          	cs cs or (%rax),%al
+  802f2e:	3c 75                	cmp    $0x75,%al
+  802f30:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802f31:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  802f35:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802f36:	3e 00 30             	ds add %dh,(%rax)
+  802f39:	31 32                	xor    %esi,(%rdx)
+  802f3b:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  802f42:	41                   	rex.B
+  802f43:	42                   	rex.X
+  802f44:	43                   	rex.XB
+  802f45:	44                   	rex.R
+  802f46:	45                   	rex.RB
+  802f47:	46 00 30             	rex.RX add %r14b,(%rax)
+  802f4a:	31 32                	xor    %esi,(%rdx)
+  802f4c:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  802f53:	61                   	(bad)
+  802f54:	62 63 64 65 66       	(bad)
+  802f59:	00 28                	add    %ch,(%rax)
+  802f5b:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802f5c:	75 6c                	jne    802fca <__rodata_start+0x132>
+  802f5e:	6c                   	insb   (%dx),%es:(%rdi)
+  802f5f:	29 00                	sub    %eax,(%rax)
+  802f61:	65 72 72             	gs jb  802fd6 <__rodata_start+0x13e>
+  802f64:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802f65:	72 20                	jb     802f87 <__rodata_start+0xef>
+  802f67:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  802f6c:	73 70                	jae    802fde <__rodata_start+0x146>
+  802f6e:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  802f72:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  802f79:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802f7a:	72 00                	jb     802f7c <__rodata_start+0xe4>
+  802f7c:	62 61 64 20 65       	(bad)
+  802f81:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802f82:	76 69                	jbe    802fed <__rodata_start+0x155>
+  802f84:	72 6f                	jb     802ff5 <__rodata_start+0x15d>
+  802f86:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802f87:	6d                   	insl   (%dx),%es:(%rdi)
+  802f88:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  802f8a:	74 00                	je     802f8c <__rodata_start+0xf4>
+  802f8c:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  802f93:	20 70 61             	and    %dh,0x61(%rax)
+  802f96:	72 61                	jb     802ff9 <__rodata_start+0x161>
+  802f98:	6d                   	insl   (%dx),%es:(%rdi)
+  802f99:	65 74 65             	gs je  803001 <__rodata_start+0x169>
+  802f9c:	72 00                	jb     802f9e <__rodata_start+0x106>
+  802f9e:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802f9f:	75 74                	jne    803015 <__rodata_start+0x17d>
+  802fa1:	20 6f 66             	and    %ch,0x66(%rdi)
+  802fa4:	20 6d 65             	and    %ch,0x65(%rbp)
+  802fa7:	6d                   	insl   (%dx),%es:(%rdi)
+  802fa8:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802fa9:	72 79                	jb     803024 <__rodata_start+0x18c>
+  802fab:	00 6f 75             	add    %ch,0x75(%rdi)
+  802fae:	74 20                	je     802fd0 <__rodata_start+0x138>
+  802fb0:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802fb1:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  802fb5:	76 69                	jbe    803020 <__rodata_start+0x188>
+  802fb7:	72 6f                	jb     803028 <__rodata_start+0x190>
+  802fb9:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802fba:	6d                   	insl   (%dx),%es:(%rdi)
+  802fbb:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  802fbd:	74 73                	je     803032 <__rodata_start+0x19a>
+  802fbf:	00 63 6f             	add    %ah,0x6f(%rbx)
+  802fc2:	72 72                	jb     803036 <__rodata_start+0x19e>
+  802fc4:	75 70                	jne    803036 <__rodata_start+0x19e>
+  802fc6:	74 65                	je     80302d <__rodata_start+0x195>
+  802fc8:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  802fcd:	75 67                	jne    803036 <__rodata_start+0x19e>
+  802fcf:	20 69 6e             	and    %ch,0x6e(%rcx)
+  802fd2:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  802fd4:	00 73 65             	add    %dh,0x65(%rbx)
+  802fd7:	67 6d                	insl   (%dx),%es:(%edi)
+  802fd9:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  802fdb:	74 61                	je     80303e <__rodata_start+0x1a6>
+  802fdd:	74 69                	je     803048 <__rodata_start+0x1b0>
+  802fdf:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802fe0:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802fe1:	20 66 61             	and    %ah,0x61(%rsi)
+  802fe4:	75 6c                	jne    803052 <__rodata_start+0x1ba>
+  802fe6:	74 00                	je     802fe8 <__rodata_start+0x150>
+  802fe8:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  802fef:	20 45 4c             	and    %al,0x4c(%rbp)
+  802ff2:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  802ff6:	61                   	(bad)
+  802ff7:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  802ffc:	20 73 75             	and    %dh,0x75(%rbx)
+  802fff:	63 68 20             	movsxd 0x20(%rax),%ebp
+  803002:	73 79                	jae    80307d <__rodata_start+0x1e5>
+  803004:	73 74                	jae    80307a <__rodata_start+0x1e2>
+  803006:	65 6d                	gs insl (%dx),%es:(%rdi)
+  803008:	20 63 61             	and    %ah,0x61(%rbx)
+  80300b:	6c                   	insb   (%dx),%es:(%rdi)
+  80300c:	6c                   	insb   (%dx),%es:(%rdi)
+  80300d:	00 65 6e             	add    %ah,0x6e(%rbp)
+  803010:	74 72                	je     803084 <__rodata_start+0x1ec>
+  803012:	79 20                	jns    803034 <__rodata_start+0x19c>
+  803014:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803015:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803016:	74 20                	je     803038 <__rodata_start+0x1a0>
+  803018:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  80301a:	75 6e                	jne    80308a <__rodata_start+0x1f2>
+  80301c:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  803020:	76 20                	jbe    803042 <__rodata_start+0x1aa>
+  803022:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  803029:	72 65                	jb     803090 <__rodata_start+0x1f8>
+  80302b:	63 76 69             	movsxd 0x69(%rsi),%esi
+  80302e:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80302f:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  803033:	65 78 70             	gs js  8030a6 <__rodata_start+0x20e>
+  803036:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  80303b:	20 65 6e             	and    %ah,0x6e(%rbp)
+  80303e:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  803042:	20 66 69             	and    %ah,0x69(%rsi)
+  803045:	6c                   	insb   (%dx),%es:(%rdi)
+  803046:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  80304a:	20 66 72             	and    %ah,0x72(%rsi)
+  80304d:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  803052:	61                   	(bad)
+  803053:	63 65 20             	movsxd 0x20(%rbp),%esp
+  803056:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803057:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803058:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  80305c:	6b 00 74             	imul   $0x74,(%rax),%eax
+  80305f:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803060:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803061:	20 6d 61             	and    %ch,0x61(%rbp)
+  803064:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803065:	79 20                	jns    803087 <__rodata_start+0x1ef>
+  803067:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  80306e:	72 65                	jb     8030d5 <__rodata_start+0x23d>
+  803070:	20 6f 70             	and    %ch,0x70(%rdi)
+  803073:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803075:	00 66 69             	add    %ah,0x69(%rsi)
+  803078:	6c                   	insb   (%dx),%es:(%rdi)
+  803079:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  80307d:	20 62 6c             	and    %ah,0x6c(%rdx)
+  803080:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803081:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  803084:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803085:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803086:	74 20                	je     8030a8 <__rodata_start+0x210>
+  803088:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  80308a:	75 6e                	jne    8030fa <__rodata_start+0x262>
+  80308c:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  803090:	76 61                	jbe    8030f3 <__rodata_start+0x25b>
+  803092:	6c                   	insb   (%dx),%es:(%rdi)
+  803093:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  80309a:	00 
+  80309b:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  8030a2:	72 65                	jb     803109 <__rodata_start+0x271>
+  8030a4:	61                   	(bad)
+  8030a5:	64 79 20             	fs jns 8030c8 <__rodata_start+0x230>
+  8030a8:	65 78 69             	gs js  803114 <__rodata_start+0x27c>
+  8030ab:	73 74                	jae    803121 <__rodata_start+0x289>
+  8030ad:	73 00                	jae    8030af <__rodata_start+0x217>
+  8030af:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8030b0:	70 65                	jo     803117 <__rodata_start+0x27f>
+  8030b2:	72 61                	jb     803115 <__rodata_start+0x27d>
+  8030b4:	74 69                	je     80311f <__rodata_start+0x287>
+  8030b6:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8030b7:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8030b8:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  8030bb:	74 20                	je     8030dd <__rodata_start+0x245>
+  8030bd:	73 75                	jae    803134 <__rodata_start+0x29c>
+  8030bf:	70 70                	jo     803131 <__rodata_start+0x299>
+  8030c1:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8030c2:	72 74                	jb     803138 <__rodata_start+0x2a0>
+  8030c4:	65 64 00 6f 70       	gs add %ch,%fs:0x70(%rdi)
+  8030c9:	65 72 61             	gs jb  80312d <__rodata_start+0x295>
+  8030cc:	74 69                	je     803137 <__rodata_start+0x29f>
+  8030ce:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8030cf:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8030d0:	20 69 6e             	and    %ch,0x6e(%rcx)
+  8030d3:	74 65                	je     80313a <__rodata_start+0x2a2>
+  8030d5:	72 72                	jb     803149 <__rodata_start+0x2b1>
+  8030d7:	75 70                	jne    803149 <__rodata_start+0x2b1>
+  8030d9:	74 65                	je     803140 <__rodata_start+0x2a8>
+  8030db:	64 00 6e 6f          	add    %ch,%fs:0x6f(%rsi)
+  8030df:	74 20                	je     803101 <__rodata_start+0x269>
+  8030e1:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  8030e3:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8030e4:	75 67                	jne    80314d <__rodata_start+0x2b5>
+  8030e6:	68 20 43 50 55       	push   $0x55504320
+  8030eb:	20 74 69 6d          	and    %dh,0x6d(%rcx,%rbp,2)
+  8030ef:	65 00 66 2e          	add    %ah,%gs:0x2e(%rsi)
+  8030f3:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+  8030fa:	00 
+  8030fb:	0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+  803100:	4b 04 80             	rex.WXB add $0x80,%al
+  803103:	00 00                	add    %al,(%rax)
+  803105:	00 00                	add    %al,(%rax)
+  803107:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  80310e:	00 00                	add    %al,(%rax)
+  803110:	7c 0a                	jl     80311c <__rodata_start+0x284>
+  803112:	80 00 00             	addb   $0x0,(%rax)
+  803115:	00 00                	add    %al,(%rax)
+  803117:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  80311e:	00 00                	add    %al,(%rax)
+  803120:	8c 0a                	mov    %cs,(%rdx)
+  803122:	80 00 00             	addb   $0x0,(%rax)
+  803125:	00 00                	add    %al,(%rax)
+  803127:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  80312e:	00 00                	add    %al,(%rax)
+  803130:	8c 0a                	mov    %cs,(%rdx)
+  803132:	80 00 00             	addb   $0x0,(%rax)
+  803135:	00 00                	add    %al,(%rax)
+  803137:	00 6a 04             	add    %ch,0x4(%rdx)
+  80313a:	80 00 00             	addb   $0x0,(%rax)
+  80313d:	00 00                	add    %al,(%rax)
+  80313f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  803146:	00 00                	add    %al,(%rax)
+  803148:	8c 0a                	mov    %cs,(%rdx)
+  80314a:	80 00 00             	addb   $0x0,(%rax)
+  80314d:	00 00                	add    %al,(%rax)
+  80314f:	00 5e 04             	add    %bl,0x4(%rsi)
+  803152:	80 00 00             	addb   $0x0,(%rax)
+  803155:	00 00                	add    %al,(%rax)
+  803157:	00 d8                	add    %bl,%al
+  803159:	04 80                	add    $0x80,%al
+  80315b:	00 00                	add    %al,(%rax)
+  80315d:	00 00                	add    %al,(%rax)
+  80315f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  803166:	00 00                	add    %al,(%rax)
+  803168:	5e                   	pop    %rsi
+  803169:	04 80                	add    $0x80,%al
+  80316b:	00 00                	add    %al,(%rax)
+  80316d:	00 00                	add    %al,(%rax)
+  80316f:	00 a4 04 80 00 00 00 	add    %ah,0x80(%rsp,%rax,1)
+  803176:	00 00                	add    %al,(%rax)
+  803178:	a4                   	movsb  %ds:(%rsi),%es:(%rdi)
+  803179:	04 80                	add    $0x80,%al
+  80317b:	00 00                	add    %al,(%rax)
+  80317d:	00 00                	add    %al,(%rax)
+  80317f:	00 a4 04 80 00 00 00 	add    %ah,0x80(%rsp,%rax,1)
+  803186:	00 00                	add    %al,(%rax)
+  803188:	a4                   	movsb  %ds:(%rsi),%es:(%rdi)
+  803189:	04 80                	add    $0x80,%al
+  80318b:	00 00                	add    %al,(%rax)
+  80318d:	00 00                	add    %al,(%rax)
+  80318f:	00 a4 04 80 00 00 00 	add    %ah,0x80(%rsp,%rax,1)
+  803196:	00 00                	add    %al,(%rax)
+  803198:	a4                   	movsb  %ds:(%rsi),%es:(%rdi)
+  803199:	04 80                	add    $0x80,%al
+  80319b:	00 00                	add    %al,(%rax)
+  80319d:	00 00                	add    %al,(%rax)
+  80319f:	00 a4 04 80 00 00 00 	add    %ah,0x80(%rsp,%rax,1)
+  8031a6:	00 00                	add    %al,(%rax)
+  8031a8:	a4                   	movsb  %ds:(%rsi),%es:(%rdi)
+  8031a9:	04 80                	add    $0x80,%al
+  8031ab:	00 00                	add    %al,(%rax)
+  8031ad:	00 00                	add    %al,(%rax)
+  8031af:	00 a4 04 80 00 00 00 	add    %ah,0x80(%rsp,%rax,1)
+  8031b6:	00 00                	add    %al,(%rax)
+  8031b8:	8c 0a                	mov    %cs,(%rdx)
+  8031ba:	80 00 00             	addb   $0x0,(%rax)
+  8031bd:	00 00                	add    %al,(%rax)
+  8031bf:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  8031c6:	00 00                	add    %al,(%rax)
+  8031c8:	8c 0a                	mov    %cs,(%rdx)
+  8031ca:	80 00 00             	addb   $0x0,(%rax)
+  8031cd:	00 00                	add    %al,(%rax)
+  8031cf:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  8031d6:	00 00                	add    %al,(%rax)
+  8031d8:	8c 0a                	mov    %cs,(%rdx)
+  8031da:	80 00 00             	addb   $0x0,(%rax)
+  8031dd:	00 00                	add    %al,(%rax)
+  8031df:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  8031e6:	00 00                	add    %al,(%rax)
+  8031e8:	8c 0a                	mov    %cs,(%rdx)
+  8031ea:	80 00 00             	addb   $0x0,(%rax)
+  8031ed:	00 00                	add    %al,(%rax)
+  8031ef:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  8031f6:	00 00                	add    %al,(%rax)
+  8031f8:	8c 0a                	mov    %cs,(%rdx)
+  8031fa:	80 00 00             	addb   $0x0,(%rax)
+  8031fd:	00 00                	add    %al,(%rax)
+  8031ff:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  803206:	00 00                	add    %al,(%rax)
+  803208:	8c 0a                	mov    %cs,(%rdx)
+  80320a:	80 00 00             	addb   $0x0,(%rax)
+  80320d:	00 00                	add    %al,(%rax)
+  80320f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  803216:	00 00                	add    %al,(%rax)
+  803218:	8c 0a                	mov    %cs,(%rdx)
+  80321a:	80 00 00             	addb   $0x0,(%rax)
+  80321d:	00 00                	add    %al,(%rax)
+  80321f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  803226:	00 00                	add    %al,(%rax)
+  803228:	8c 0a                	mov    %cs,(%rdx)
+  80322a:	80 00 00             	addb   $0x0,(%rax)
+  80322d:	00 00                	add    %al,(%rax)
+  80322f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  803236:	00 00                	add    %al,(%rax)
+  803238:	8c 0a                	mov    %cs,(%rdx)
+  80323a:	80 00 00             	addb   $0x0,(%rax)
+  80323d:	00 00                	add    %al,(%rax)
+  80323f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  803246:	00 00                	add    %al,(%rax)
+  803248:	8c 0a                	mov    %cs,(%rdx)
+  80324a:	80 00 00             	addb   $0x0,(%rax)
+  80324d:	00 00                	add    %al,(%rax)
+  80324f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  803256:	00 00                	add    %al,(%rax)
+  803258:	8c 0a                	mov    %cs,(%rdx)
+  80325a:	80 00 00             	addb   $0x0,(%rax)
+  80325d:	00 00                	add    %al,(%rax)
+  80325f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  803266:	00 00                	add    %al,(%rax)
+  803268:	8c 0a                	mov    %cs,(%rdx)
+  80326a:	80 00 00             	addb   $0x0,(%rax)
+  80326d:	00 00                	add    %al,(%rax)
+  80326f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  803276:	00 00                	add    %al,(%rax)
+  803278:	8c 0a                	mov    %cs,(%rdx)
+  80327a:	80 00 00             	addb   $0x0,(%rax)
+  80327d:	00 00                	add    %al,(%rax)
+  80327f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  803286:	00 00                	add    %al,(%rax)
+  803288:	8c 0a                	mov    %cs,(%rdx)
+  80328a:	80 00 00             	addb   $0x0,(%rax)
+  80328d:	00 00                	add    %al,(%rax)
+  80328f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  803296:	00 00                	add    %al,(%rax)
+  803298:	8c 0a                	mov    %cs,(%rdx)
+  80329a:	80 00 00             	addb   $0x0,(%rax)
+  80329d:	00 00                	add    %al,(%rax)
+  80329f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  8032a6:	00 00                	add    %al,(%rax)
+  8032a8:	af                   	scas   %es:(%rdi),%eax
+  8032a9:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  8032af:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  8032b6:	00 00                	add    %al,(%rax)
+  8032b8:	8c 0a                	mov    %cs,(%rdx)
+  8032ba:	80 00 00             	addb   $0x0,(%rax)
+  8032bd:	00 00                	add    %al,(%rax)
+  8032bf:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  8032c6:	00 00                	add    %al,(%rax)
+  8032c8:	8c 0a                	mov    %cs,(%rdx)
+  8032ca:	80 00 00             	addb   $0x0,(%rax)
+  8032cd:	00 00                	add    %al,(%rax)
+  8032cf:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  8032d6:	00 00                	add    %al,(%rax)
+  8032d8:	8c 0a                	mov    %cs,(%rdx)
+  8032da:	80 00 00             	addb   $0x0,(%rax)
+  8032dd:	00 00                	add    %al,(%rax)
+  8032df:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  8032e6:	00 00                	add    %al,(%rax)
+  8032e8:	8c 0a                	mov    %cs,(%rdx)
+  8032ea:	80 00 00             	addb   $0x0,(%rax)
+  8032ed:	00 00                	add    %al,(%rax)
+  8032ef:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  8032f6:	00 00                	add    %al,(%rax)
+  8032f8:	8c 0a                	mov    %cs,(%rdx)
+  8032fa:	80 00 00             	addb   $0x0,(%rax)
+  8032fd:	00 00                	add    %al,(%rax)
+  8032ff:	00 fb                	add    %bh,%bl
+  803301:	04 80                	add    $0x80,%al
+  803303:	00 00                	add    %al,(%rax)
+  803305:	00 00                	add    %al,(%rax)
+  803307:	00 ca                	add    %cl,%dl
+  803309:	06                   	(bad)
+  80330a:	80 00 00             	addb   $0x0,(%rax)
+  80330d:	00 00                	add    %al,(%rax)
+  80330f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  803316:	00 00                	add    %al,(%rax)
+  803318:	8c 0a                	mov    %cs,(%rdx)
+  80331a:	80 00 00             	addb   $0x0,(%rax)
+  80331d:	00 00                	add    %al,(%rax)
+  80331f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  803326:	00 00                	add    %al,(%rax)
+  803328:	8c 0a                	mov    %cs,(%rdx)
+  80332a:	80 00 00             	addb   $0x0,(%rax)
+  80332d:	00 00                	add    %al,(%rax)
+  80332f:	00 2a                	add    %ch,(%rdx)
+  803331:	05 80 00 00 00       	add    $0x80,%eax
+  803336:	00 00                	add    %al,(%rax)
+  803338:	8c 0a                	mov    %cs,(%rdx)
+  80333a:	80 00 00             	addb   $0x0,(%rax)
+  80333d:	00 00                	add    %al,(%rax)
+  80333f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  803346:	00 00                	add    %al,(%rax)
+  803348:	f0 04 80             	lock add $0x80,%al
+  80334b:	00 00                	add    %al,(%rax)
+  80334d:	00 00                	add    %al,(%rax)
+  80334f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  803356:	00 00                	add    %al,(%rax)
+  803358:	8c 0a                	mov    %cs,(%rdx)
+  80335a:	80 00 00             	addb   $0x0,(%rax)
+  80335d:	00 00                	add    %al,(%rax)
+  80335f:	00 72 08             	add    %dh,0x8(%rdx)
+  803362:	80 00 00             	addb   $0x0,(%rax)
+  803365:	00 00                	add    %al,(%rax)
+  803367:	00 3c 09             	add    %bh,(%rcx,%rcx,1)
+  80336a:	80 00 00             	addb   $0x0,(%rax)
+  80336d:	00 00                	add    %al,(%rax)
+  80336f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  803376:	00 00                	add    %al,(%rax)
+  803378:	8c 0a                	mov    %cs,(%rdx)
+  80337a:	80 00 00             	addb   $0x0,(%rax)
+  80337d:	00 00                	add    %al,(%rax)
+  80337f:	00 c1                	add    %al,%cl
+  803381:	05 80 00 00 00       	add    $0x80,%eax
+  803386:	00 00                	add    %al,(%rax)
+  803388:	8c 0a                	mov    %cs,(%rdx)
+  80338a:	80 00 00             	addb   $0x0,(%rax)
+  80338d:	00 00                	add    %al,(%rax)
+  80338f:	00 9e 07 80 00 00    	add    %bl,0x8007(%rsi)
+  803395:	00 00                	add    %al,(%rax)
+  803397:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  80339e:	00 00                	add    %al,(%rax)
+  8033a0:	8c 0a                	mov    %cs,(%rdx)
+  8033a2:	80 00 00             	addb   $0x0,(%rax)
+  8033a5:	00 00                	add    %al,(%rax)
+  8033a7:	00 af 09 80 00 00    	add    %ch,0x8009(%rdi)
+  8033ad:	00 00                	add    %al,(%rax)
+  8033af:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  8033b6:	00 00                	add    %al,(%rax)
+  8033b8:	54                   	push   %rsp
+  8033b9:	04 80                	add    $0x80,%al
+  8033bb:	00 00                	add    %al,(%rax)
+  8033bd:	00 00                	add    %al,(%rax)
+	...
+
+00000000008033c0 <error_string>:
+	...
+  8033c8:	6a 2f 80 00 00 00 00 00 7c 2f 80 00 00 00 00 00     j/......|/......
+  8033d8:	8c 2f 80 00 00 00 00 00 9e 2f 80 00 00 00 00 00     ./......./......
+  8033e8:	ac 2f 80 00 00 00 00 00 c0 2f 80 00 00 00 00 00     ./......./......
+  8033f8:	d5 2f 80 00 00 00 00 00 e8 2f 80 00 00 00 00 00     ./......./......
+  803408:	fa 2f 80 00 00 00 00 00 0e 30 80 00 00 00 00 00     ./.......0......
+  803418:	1e 30 80 00 00 00 00 00 31 30 80 00 00 00 00 00     .0......10......
+  803428:	48 30 80 00 00 00 00 00 5e 30 80 00 00 00 00 00     H0......^0......
+  803438:	76 30 80 00 00 00 00 00 8e 30 80 00 00 00 00 00     v0.......0......
+  803448:	9b 30 80 00 00 00 00 00 70 34 80 00 00 00 00 00     .0......p4......
+  803458:	af 30 80 00 00 00 00 00 c7 30 80 00 00 00 00 00     .0.......0......
+  803468:	dd 30 80 00 00 00 00 00 66 69 6c 65 20 69 73 20     .0......file is 
+  803478:	6e 6f 74 20 61 20 76 61 6c 69 64 20 65 78 65 63     not a valid exec
+  803488:	75 74 61 62 6c 65 00 90 73 79 73 63 61 6c 6c 20     utable..syscall 
+  803498:	25 7a 64 20 72 65 74 75 72 6e 65 64 20 25 7a 64     %zd returned %zd
+  8034a8:	20 28 3e 20 30 29 00 6c 69 62 2f 73 79 73 63 61      (> 0).lib/sysca
+  8034b8:	6c 6c 2e 63 00 46 6f 72 6b 20 64 6f 75 62 6c 65     ll.c.Fork double
+  8034c8:	20 66 61 75 6c 74 00 6c 69 62 2f 66 6f 72 6b 2e      fault.lib/fork.
+  8034d8:	63 00 73 66 6f 72 6b 28 29 20 69 73 20 6e 6f 74     c.sfork() is not
+  8034e8:	20 69 6d 70 6c 65 6d 65 6e 74 65 64 00 0f 1f 00      implemented....
+  8034f8:	5b 25 30 38 78 5d 20 75 6e 6b 6e 6f 77 6e 20 64     [%08x] unknown d
+  803508:	65 76 69 63 65 20 74 79 70 65 20 25 64 0a 00 00     evice type %d...
+  803518:	5b 25 30 38 78 5d 20 66 74 72 75 6e 63 61 74 65     [%08x] ftruncate
+  803528:	20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65 0a      %d -- bad mode.
+  803538:	00 5b 25 30 38 78 5d 20 72 65 61 64 20 25 64 20     .[%08x] read %d 
+  803548:	2d 2d 20 62 61 64 20 6d 6f 64 65 0a 00 5b 25 30     -- bad mode..[%0
+  803558:	38 78 5d 20 77 72 69 74 65 20 25 64 20 2d 2d 20     8x] write %d -- 
+  803568:	62 61 64 20 6d 6f 64 65 0a 00 66 2e 0f 1f 84 00     bad mode..f.....
+  803578:	00 00 00 00 0f 1f 40 00                             ......@.
+
+0000000000803580 <devtab>:
+  803580:	20 40 80 00 00 00 00 00 60 40 80 00 00 00 00 00      @......`@......
+  803590:	a0 40 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .@..............
+  8035a0:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  8035b0:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  8035c0:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  8035d0:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  8035e0:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  8035f0:	3d 20 32 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73 00     = 2.<cons>.cons.
+  803600:	5b 25 30 38 78 5d 20 75 73 65 72 20 70 61 6e 69     [%08x] user pani
+  803610:	63 20 69 6e 20 25 73 20 61 74 20 25 73 3a 25 64     c in %s at %s:%d
+  803620:	3a 20 00 73 79 73 5f 69 70 63 5f 74 72 79 5f 73     : .sys_ipc_try_s
+  803630:	65 6e 64 20 66 61 69 6c 65 64 3a 20 25 69 00 6c     end failed: %i.l
+  803640:	69 62 2f 69 70 63 2e 63 00 66 2e 0f 1f 84 00 00     ib/ipc.c.f......
+  803650:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803660:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803670:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803680:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803690:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8036a0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8036b0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8036c0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8036d0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8036e0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8036f0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803700:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803710:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803720:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803730:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803740:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803750:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803760:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803770:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803780:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803790:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8037a0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8037b0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8037c0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8037d0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8037e0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8037f0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803800:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803810:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803820:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803830:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803840:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803850:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803860:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803870:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803880:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803890:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8038a0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8038b0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8038c0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8038d0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8038e0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8038f0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803900:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803910:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803920:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803930:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803940:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803950:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803960:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803970:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803980:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803990:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8039a0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8039b0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8039c0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8039d0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8039e0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8039f0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803a00:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803a10:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803a20:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803a30:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803a40:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803a50:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803a60:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803a70:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803a80:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803a90:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803aa0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803ab0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803ac0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803ad0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803ae0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803af0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803b00:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803b10:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803b20:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803b30:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803b40:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803b50:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803b60:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803b70:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803b80:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803b90:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803ba0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803bb0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803bc0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803bd0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803be0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803bf0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803c00:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803c10:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803c20:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803c30:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803c40:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803c50:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803c60:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803c70:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803c80:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803c90:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803ca0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803cb0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803cc0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803cd0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803ce0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803cf0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803d00:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803d10:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803d20:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803d30:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803d40:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803d50:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803d60:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803d70:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803d80:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803d90:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803da0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803db0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803dc0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803dd0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803de0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803df0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803e00:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803e10:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803e20:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803e30:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803e40:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803e50:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803e60:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803e70:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803e80:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803e90:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803ea0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803eb0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803ec0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803ed0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803ee0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803ef0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803f00:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803f10:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803f20:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803f30:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803f40:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803f50:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803f60:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803f70:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803f80:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803f90:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803fa0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803fb0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803fc0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803fd0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803fe0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803ff0:	2e 0f 1f 84 00 00 00 00 00 0f 1f 80 00 00 00 00     ................
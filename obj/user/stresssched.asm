@@ -0,0 +1,5945 @@
+
+obj/user/stresssched:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 23 01 00 00       	call   800146 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+#include <inc/lib.h>
+
+volatile int counter;
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 55                	push   %r13
+  80002b:	41 54                	push   %r12
+  80002d:	53                   	push   %rbx
+  80002e:	48 83 ec 08          	sub    $0x8,%rsp
+    int i, j;
+    envid_t parent = sys_getenvid();
+  800032:	48 b8 77 11 80 00 00 	movabs $0x801177,%rax
+  800039:	00 00 00 
+  80003c:	ff d0                	call   *%rax
+  80003e:	41 89 c5             	mov    %eax,%r13d
+
+    /* Fork several environments */
+    for (i = 0; i < 20; i++)
+  800041:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (fork() == 0)
+  800046:	49 bc 72 16 80 00 00 	movabs $0x801672,%r12
+  80004d:	00 00 00 
+  800050:	41 ff d4             	call   *%r12
+  800053:	85 c0                	test   %eax,%eax
+  800055:	74 19                	je     800070 <umain+0x4b>
+    for (i = 0; i < 20; i++)
+  800057:	83 c3 01             	add    $0x1,%ebx
+  80005a:	83 fb 14             	cmp    $0x14,%ebx
+  80005d:	75 f1                	jne    800050 <umain+0x2b>
+            break;
+    if (i == 20) {
+        sys_yield();
+  80005f:	48 b8 a8 11 80 00 00 	movabs $0x8011a8,%rax
+  800066:	00 00 00 
+  800069:	ff d0                	call   *%rax
+        return;
+  80006b:	e9 94 00 00 00       	jmp    800104 <umain+0xdf>
+    if (i == 20) {
+  800070:	83 fb 14             	cmp    $0x14,%ebx
+  800073:	74 ea                	je     80005f <umain+0x3a>
+    }
+
+    /* Wait for the parent to finish forking */
+    while (envs[ENVX(parent)].env_status != ENV_FREE)
+  800075:	44 89 ea             	mov    %r13d,%edx
+  800078:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  80007e:	44 89 e8             	mov    %r13d,%eax
+  800081:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800086:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+  80008d:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  800094:	00 00 00 
+  800097:	48 01 c8             	add    %rcx,%rax
+  80009a:	8b 80 ec 00 00 00    	mov    0xec(%rax),%eax
+  8000a0:	85 c0                	test   %eax,%eax
+  8000a2:	74 1c                	je     8000c0 <umain+0x9b>
+  8000a4:	48 63 c2             	movslq %edx,%rax
+  8000a7:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+  8000ae:	48 89 ca             	mov    %rcx,%rdx
+  8000b1:	48 01 c2             	add    %rax,%rdx
+        asm volatile("pause");
+  8000b4:	f3 90                	pause
+    while (envs[ENVX(parent)].env_status != ENV_FREE)
+  8000b6:	8b 82 ec 00 00 00    	mov    0xec(%rdx),%eax
+  8000bc:	85 c0                	test   %eax,%eax
+  8000be:	75 f4                	jne    8000b4 <umain+0x8f>
+    for (i = 0; i < 20; i++)
+  8000c0:	41 bc 0a 00 00 00    	mov    $0xa,%r12d
+
+    /* Check that one environment doesn't run on two CPUs at once */
+    for (i = 0; i < 10; i++) {
+        sys_yield();
+  8000c6:	49 bd a8 11 80 00 00 	movabs $0x8011a8,%r13
+  8000cd:	00 00 00 
+        for (j = 0; j < 10000; j++)
+            counter++;
+  8000d0:	48 bb 00 50 80 00 00 	movabs $0x805000,%rbx
+  8000d7:	00 00 00 
+        sys_yield();
+  8000da:	41 ff d5             	call   *%r13
+  8000dd:	ba 10 27 00 00       	mov    $0x2710,%edx
+            counter++;
+  8000e2:	8b 03                	mov    (%rbx),%eax
+  8000e4:	83 c0 01             	add    $0x1,%eax
+  8000e7:	89 03                	mov    %eax,(%rbx)
+        for (j = 0; j < 10000; j++)
+  8000e9:	83 ea 01             	sub    $0x1,%edx
+  8000ec:	75 f4                	jne    8000e2 <umain+0xbd>
+    for (i = 0; i < 10; i++) {
+  8000ee:	41 83 ec 01          	sub    $0x1,%r12d
+  8000f2:	75 e6                	jne    8000da <umain+0xb5>
+    }
+
+    if (counter != 10 * 10000)
+  8000f4:	a1 00 50 80 00 00 00 	movabs 0x805000,%eax
+  8000fb:	00 00 
+  8000fd:	3d a0 86 01 00       	cmp    $0x186a0,%eax
+  800102:	75 0b                	jne    80010f <umain+0xea>
+        panic("ran on two CPUs at once (counter is %d)", counter);
+
+    /* Check that we see environments running on different CPUs */
+    //cprintf("[%08x] stresssched on CPU %d\n", thisenv->env_id, thisenv->env_cpunum);
+}
+  800104:	48 83 c4 08          	add    $0x8,%rsp
+  800108:	5b                   	pop    %rbx
+  800109:	41 5c                	pop    %r12
+  80010b:	41 5d                	pop    %r13
+  80010d:	5d                   	pop    %rbp
+  80010e:	c3                   	ret
+        panic("ran on two CPUs at once (counter is %d)", counter);
+  80010f:	48 b8 00 50 80 00 00 	movabs $0x805000,%rax
+  800116:	00 00 00 
+  800119:	8b 08                	mov    (%rax),%ecx
+  80011b:	48 ba f8 2e 80 00 00 	movabs $0x802ef8,%rdx
+  800122:	00 00 00 
+  800125:	be 1f 00 00 00       	mov    $0x1f,%esi
+  80012a:	48 bf 20 2f 80 00 00 	movabs $0x802f20,%rdi
+  800131:	00 00 00 
+  800134:	b8 00 00 00 00       	mov    $0x0,%eax
+  800139:	49 b8 12 02 80 00 00 	movabs $0x800212,%r8
+  800140:	00 00 00 
+  800143:	41 ff d0             	call   *%r8
+
+0000000000800146 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800146:	55                   	push   %rbp
+  800147:	48 89 e5             	mov    %rsp,%rbp
+  80014a:	41 56                	push   %r14
+  80014c:	41 55                	push   %r13
+  80014e:	41 54                	push   %r12
+  800150:	53                   	push   %rbx
+  800151:	41 89 fd             	mov    %edi,%r13d
+  800154:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800157:	48 ba d8 40 80 00 00 	movabs $0x8040d8,%rdx
+  80015e:	00 00 00 
+  800161:	48 b8 d8 40 80 00 00 	movabs $0x8040d8,%rax
+  800168:	00 00 00 
+  80016b:	48 39 c2             	cmp    %rax,%rdx
+  80016e:	73 17                	jae    800187 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  800170:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  800173:	49 89 c4             	mov    %rax,%r12
+  800176:	48 83 c3 08          	add    $0x8,%rbx
+  80017a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80017f:	ff 53 f8             	call   *-0x8(%rbx)
+  800182:	4c 39 e3             	cmp    %r12,%rbx
+  800185:	72 ef                	jb     800176 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+    envid_t this_env_id = sys_getenvid();
+  800187:	48 b8 77 11 80 00 00 	movabs $0x801177,%rax
+  80018e:	00 00 00 
+  800191:	ff d0                	call   *%rax
+    thisenv = &((struct Env*)UENVS)[ENVX(this_env_id)];
+  800193:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800198:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+  80019f:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8001a6:	00 00 00 
+  8001a9:	48 01 d0             	add    %rdx,%rax
+  8001ac:	48 a3 08 50 80 00 00 	movabs %rax,0x805008
+  8001b3:	00 00 00 
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8001b6:	45 85 ed             	test   %r13d,%r13d
+  8001b9:	7e 0d                	jle    8001c8 <libmain+0x82>
+  8001bb:	49 8b 06             	mov    (%r14),%rax
+  8001be:	48 a3 00 40 80 00 00 	movabs %rax,0x804000
+  8001c5:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8001c8:	4c 89 f6             	mov    %r14,%rsi
+  8001cb:	44 89 ef             	mov    %r13d,%edi
+  8001ce:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8001d5:	00 00 00 
+  8001d8:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8001da:	48 b8 ef 01 80 00 00 	movabs $0x8001ef,%rax
+  8001e1:	00 00 00 
+  8001e4:	ff d0                	call   *%rax
+#endif
+}
+  8001e6:	5b                   	pop    %rbx
+  8001e7:	41 5c                	pop    %r12
+  8001e9:	41 5d                	pop    %r13
+  8001eb:	41 5e                	pop    %r14
+  8001ed:	5d                   	pop    %rbp
+  8001ee:	c3                   	ret
+
+00000000008001ef <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8001ef:	55                   	push   %rbp
+  8001f0:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  8001f3:	48 b8 2f 1a 80 00 00 	movabs $0x801a2f,%rax
+  8001fa:	00 00 00 
+  8001fd:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  8001ff:	bf 00 00 00 00       	mov    $0x0,%edi
+  800204:	48 b8 0c 11 80 00 00 	movabs $0x80110c,%rax
+  80020b:	00 00 00 
+  80020e:	ff d0                	call   *%rax
+}
+  800210:	5d                   	pop    %rbp
+  800211:	c3                   	ret
+
+0000000000800212 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  800212:	55                   	push   %rbp
+  800213:	48 89 e5             	mov    %rsp,%rbp
+  800216:	41 56                	push   %r14
+  800218:	41 55                	push   %r13
+  80021a:	41 54                	push   %r12
+  80021c:	53                   	push   %rbx
+  80021d:	48 83 ec 50          	sub    $0x50,%rsp
+  800221:	49 89 fc             	mov    %rdi,%r12
+  800224:	41 89 f5             	mov    %esi,%r13d
+  800227:	48 89 d3             	mov    %rdx,%rbx
+  80022a:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  80022e:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  800232:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800236:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  80023d:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800241:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  800245:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  800249:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  80024d:	48 b8 00 40 80 00 00 	movabs $0x804000,%rax
+  800254:	00 00 00 
+  800257:	4c 8b 30             	mov    (%rax),%r14
+  80025a:	48 b8 77 11 80 00 00 	movabs $0x801177,%rax
+  800261:	00 00 00 
+  800264:	ff d0                	call   *%rax
+  800266:	89 c6                	mov    %eax,%esi
+  800268:	45 89 e8             	mov    %r13d,%r8d
+  80026b:	4c 89 e1             	mov    %r12,%rcx
+  80026e:	4c 89 f2             	mov    %r14,%rdx
+  800271:	48 bf 40 2f 80 00 00 	movabs $0x802f40,%rdi
+  800278:	00 00 00 
+  80027b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800280:	49 bc 62 03 80 00 00 	movabs $0x800362,%r12
+  800287:	00 00 00 
+  80028a:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  80028d:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  800291:	48 89 df             	mov    %rbx,%rdi
+  800294:	48 b8 fe 02 80 00 00 	movabs $0x8002fe,%rax
+  80029b:	00 00 00 
+  80029e:	ff d0                	call   *%rax
+    cprintf("\n");
+  8002a0:	48 bf 73 35 80 00 00 	movabs $0x803573,%rdi
+  8002a7:	00 00 00 
+  8002aa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002af:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  8002b2:	cc                   	int3
+  8002b3:	eb fd                	jmp    8002b2 <_panic+0xa0>
+
+00000000008002b5 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  8002b5:	55                   	push   %rbp
+  8002b6:	48 89 e5             	mov    %rsp,%rbp
+  8002b9:	53                   	push   %rbx
+  8002ba:	48 83 ec 08          	sub    $0x8,%rsp
+  8002be:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  8002c1:	8b 06                	mov    (%rsi),%eax
+  8002c3:	8d 50 01             	lea    0x1(%rax),%edx
+  8002c6:	89 16                	mov    %edx,(%rsi)
+  8002c8:	48 98                	cltq
+  8002ca:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  8002cf:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  8002d5:	74 0a                	je     8002e1 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  8002d7:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  8002db:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8002df:	c9                   	leave
+  8002e0:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  8002e1:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  8002e5:	be ff 00 00 00       	mov    $0xff,%esi
+  8002ea:	48 b8 ae 10 80 00 00 	movabs $0x8010ae,%rax
+  8002f1:	00 00 00 
+  8002f4:	ff d0                	call   *%rax
+        state->offset = 0;
+  8002f6:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  8002fc:	eb d9                	jmp    8002d7 <putch+0x22>
+
+00000000008002fe <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  8002fe:	55                   	push   %rbp
+  8002ff:	48 89 e5             	mov    %rsp,%rbp
+  800302:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  800309:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  80030c:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  800313:	b9 21 00 00 00       	mov    $0x21,%ecx
+  800318:	b8 00 00 00 00       	mov    $0x0,%eax
+  80031d:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  800320:	48 89 f1             	mov    %rsi,%rcx
+  800323:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  80032a:	48 bf b5 02 80 00 00 	movabs $0x8002b5,%rdi
+  800331:	00 00 00 
+  800334:	48 b8 b2 04 80 00 00 	movabs $0x8004b2,%rax
+  80033b:	00 00 00 
+  80033e:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  800340:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  800347:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  80034e:	48 b8 ae 10 80 00 00 	movabs $0x8010ae,%rax
+  800355:	00 00 00 
+  800358:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  80035a:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  800360:	c9                   	leave
+  800361:	c3                   	ret
+
+0000000000800362 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  800362:	55                   	push   %rbp
+  800363:	48 89 e5             	mov    %rsp,%rbp
+  800366:	48 83 ec 50          	sub    $0x50,%rsp
+  80036a:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  80036e:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  800372:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800376:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80037a:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  80037e:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  800385:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800389:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80038d:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800391:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  800395:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  800399:	48 b8 fe 02 80 00 00 	movabs $0x8002fe,%rax
+  8003a0:	00 00 00 
+  8003a3:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  8003a5:	c9                   	leave
+  8003a6:	c3                   	ret
+
+00000000008003a7 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  8003a7:	55                   	push   %rbp
+  8003a8:	48 89 e5             	mov    %rsp,%rbp
+  8003ab:	41 57                	push   %r15
+  8003ad:	41 56                	push   %r14
+  8003af:	41 55                	push   %r13
+  8003b1:	41 54                	push   %r12
+  8003b3:	53                   	push   %rbx
+  8003b4:	48 83 ec 18          	sub    $0x18,%rsp
+  8003b8:	49 89 fc             	mov    %rdi,%r12
+  8003bb:	49 89 f5             	mov    %rsi,%r13
+  8003be:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8003c2:	8b 45 10             	mov    0x10(%rbp),%eax
+  8003c5:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  8003c8:	41 89 cf             	mov    %ecx,%r15d
+  8003cb:	4c 39 fa             	cmp    %r15,%rdx
+  8003ce:	73 5b                	jae    80042b <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  8003d0:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  8003d4:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  8003d8:	85 db                	test   %ebx,%ebx
+  8003da:	7e 0e                	jle    8003ea <print_num+0x43>
+            putch(padc, put_arg);
+  8003dc:	4c 89 ee             	mov    %r13,%rsi
+  8003df:	44 89 f7             	mov    %r14d,%edi
+  8003e2:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  8003e5:	83 eb 01             	sub    $0x1,%ebx
+  8003e8:	75 f2                	jne    8003dc <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  8003ea:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  8003ee:	48 b9 74 2f 80 00 00 	movabs $0x802f74,%rcx
+  8003f5:	00 00 00 
+  8003f8:	48 b8 63 2f 80 00 00 	movabs $0x802f63,%rax
+  8003ff:	00 00 00 
+  800402:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  800406:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80040a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80040f:	49 f7 f7             	div    %r15
+  800412:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  800416:	4c 89 ee             	mov    %r13,%rsi
+  800419:	41 ff d4             	call   *%r12
+}
+  80041c:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800420:	5b                   	pop    %rbx
+  800421:	41 5c                	pop    %r12
+  800423:	41 5d                	pop    %r13
+  800425:	41 5e                	pop    %r14
+  800427:	41 5f                	pop    %r15
+  800429:	5d                   	pop    %rbp
+  80042a:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  80042b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80042f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800434:	49 f7 f7             	div    %r15
+  800437:	48 83 ec 08          	sub    $0x8,%rsp
+  80043b:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  80043f:	52                   	push   %rdx
+  800440:	45 0f be c9          	movsbl %r9b,%r9d
+  800444:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  800448:	48 89 c2             	mov    %rax,%rdx
+  80044b:	48 b8 a7 03 80 00 00 	movabs $0x8003a7,%rax
+  800452:	00 00 00 
+  800455:	ff d0                	call   *%rax
+  800457:	48 83 c4 10          	add    $0x10,%rsp
+  80045b:	eb 8d                	jmp    8003ea <print_num+0x43>
+
+000000000080045d <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  80045d:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  800461:	48 8b 06             	mov    (%rsi),%rax
+  800464:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  800468:	73 0a                	jae    800474 <sprintputch+0x17>
+        *state->start++ = ch;
+  80046a:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80046e:	48 89 16             	mov    %rdx,(%rsi)
+  800471:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  800474:	c3                   	ret
+
+0000000000800475 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  800475:	55                   	push   %rbp
+  800476:	48 89 e5             	mov    %rsp,%rbp
+  800479:	48 83 ec 50          	sub    $0x50,%rsp
+  80047d:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800481:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800485:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  800489:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800490:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800494:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800498:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80049c:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  8004a0:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8004a4:	48 b8 b2 04 80 00 00 	movabs $0x8004b2,%rax
+  8004ab:	00 00 00 
+  8004ae:	ff d0                	call   *%rax
+}
+  8004b0:	c9                   	leave
+  8004b1:	c3                   	ret
+
+00000000008004b2 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  8004b2:	55                   	push   %rbp
+  8004b3:	48 89 e5             	mov    %rsp,%rbp
+  8004b6:	41 57                	push   %r15
+  8004b8:	41 56                	push   %r14
+  8004ba:	41 55                	push   %r13
+  8004bc:	41 54                	push   %r12
+  8004be:	53                   	push   %rbx
+  8004bf:	48 83 ec 38          	sub    $0x38,%rsp
+  8004c3:	49 89 fe             	mov    %rdi,%r14
+  8004c6:	49 89 f5             	mov    %rsi,%r13
+  8004c9:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  8004cc:	48 8b 01             	mov    (%rcx),%rax
+  8004cf:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8004d3:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  8004d7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8004db:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  8004df:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  8004e3:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  8004e7:	0f b6 3b             	movzbl (%rbx),%edi
+  8004ea:	40 80 ff 25          	cmp    $0x25,%dil
+  8004ee:	74 18                	je     800508 <vprintfmt+0x56>
+            if (!ch) return;
+  8004f0:	40 84 ff             	test   %dil,%dil
+  8004f3:	0f 84 b1 06 00 00    	je     800baa <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  8004f9:	40 0f b6 ff          	movzbl %dil,%edi
+  8004fd:	4c 89 ee             	mov    %r13,%rsi
+  800500:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  800503:	4c 89 e3             	mov    %r12,%rbx
+  800506:	eb db                	jmp    8004e3 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  800508:	be 00 00 00 00       	mov    $0x0,%esi
+  80050d:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  800511:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  800516:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  80051c:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  800523:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800527:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  80052c:	41 0f b6 04 24       	movzbl (%r12),%eax
+  800531:	88 45 a0             	mov    %al,-0x60(%rbp)
+  800534:	83 e8 23             	sub    $0x23,%eax
+  800537:	3c 57                	cmp    $0x57,%al
+  800539:	0f 87 51 06 00 00    	ja     800b90 <vprintfmt+0x6de>
+  80053f:	0f b6 c0             	movzbl %al,%eax
+  800542:	48 b9 20 31 80 00 00 	movabs $0x803120,%rcx
+  800549:	00 00 00 
+  80054c:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  80054f:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  800552:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  800556:	eb cf                	jmp    800527 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  800558:	49 89 dc             	mov    %rbx,%r12
+  80055b:	be 01 00 00 00       	mov    $0x1,%esi
+  800560:	eb c5                	jmp    800527 <vprintfmt+0x75>
+            padc = ch;
+  800562:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  800566:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800569:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80056c:	eb b9                	jmp    800527 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  80056e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800571:	83 f8 2f             	cmp    $0x2f,%eax
+  800574:	77 24                	ja     80059a <vprintfmt+0xe8>
+  800576:	89 c1                	mov    %eax,%ecx
+  800578:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  80057c:	83 c0 08             	add    $0x8,%eax
+  80057f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800582:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  800585:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  800588:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  80058c:	79 99                	jns    800527 <vprintfmt+0x75>
+                width = precision;
+  80058e:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  800592:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800598:	eb 8d                	jmp    800527 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  80059a:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80059e:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  8005a2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8005a6:	eb da                	jmp    800582 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  8005a8:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  8005ad:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8005b1:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  8005b7:	3c 39                	cmp    $0x39,%al
+  8005b9:	77 1c                	ja     8005d7 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  8005bb:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  8005bf:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  8005c3:	0f b6 c0             	movzbl %al,%eax
+  8005c6:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8005cb:	0f b6 03             	movzbl (%rbx),%eax
+  8005ce:	3c 39                	cmp    $0x39,%al
+  8005d0:	76 e9                	jbe    8005bb <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  8005d2:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  8005d5:	eb b1                	jmp    800588 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  8005d7:	49 89 dc             	mov    %rbx,%r12
+  8005da:	eb ac                	jmp    800588 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  8005dc:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  8005df:	85 c9                	test   %ecx,%ecx
+  8005e1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005e6:	0f 49 c1             	cmovns %ecx,%eax
+  8005e9:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  8005ec:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8005ef:	e9 33 ff ff ff       	jmp    800527 <vprintfmt+0x75>
+            lflag++;
+  8005f4:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  8005f7:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8005fa:	e9 28 ff ff ff       	jmp    800527 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  8005ff:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800602:	83 f8 2f             	cmp    $0x2f,%eax
+  800605:	77 19                	ja     800620 <vprintfmt+0x16e>
+  800607:	89 c2                	mov    %eax,%edx
+  800609:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80060d:	83 c0 08             	add    $0x8,%eax
+  800610:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800613:	8b 3a                	mov    (%rdx),%edi
+  800615:	4c 89 ee             	mov    %r13,%rsi
+  800618:	41 ff d6             	call   *%r14
+            break;
+  80061b:	e9 c3 fe ff ff       	jmp    8004e3 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  800620:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800624:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800628:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80062c:	eb e5                	jmp    800613 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  80062e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800631:	83 f8 2f             	cmp    $0x2f,%eax
+  800634:	77 5a                	ja     800690 <vprintfmt+0x1de>
+  800636:	89 c2                	mov    %eax,%edx
+  800638:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80063c:	83 c0 08             	add    $0x8,%eax
+  80063f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  800642:	8b 02                	mov    (%rdx),%eax
+  800644:	89 c1                	mov    %eax,%ecx
+  800646:	f7 d9                	neg    %ecx
+  800648:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  80064b:	83 f9 15             	cmp    $0x15,%ecx
+  80064e:	7f 4e                	jg     80069e <vprintfmt+0x1ec>
+  800650:	48 63 c1             	movslq %ecx,%rax
+  800653:	48 ba e0 33 80 00 00 	movabs $0x8033e0,%rdx
+  80065a:	00 00 00 
+  80065d:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  800661:	48 85 c0             	test   %rax,%rax
+  800664:	74 38                	je     80069e <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  800666:	48 89 c1             	mov    %rax,%rcx
+  800669:	48 ba d9 35 80 00 00 	movabs $0x8035d9,%rdx
+  800670:	00 00 00 
+  800673:	4c 89 ee             	mov    %r13,%rsi
+  800676:	4c 89 f7             	mov    %r14,%rdi
+  800679:	b8 00 00 00 00       	mov    $0x0,%eax
+  80067e:	49 b8 75 04 80 00 00 	movabs $0x800475,%r8
+  800685:	00 00 00 
+  800688:	41 ff d0             	call   *%r8
+  80068b:	e9 53 fe ff ff       	jmp    8004e3 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  800690:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800694:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800698:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80069c:	eb a4                	jmp    800642 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  80069e:	48 ba 8c 2f 80 00 00 	movabs $0x802f8c,%rdx
+  8006a5:	00 00 00 
+  8006a8:	4c 89 ee             	mov    %r13,%rsi
+  8006ab:	4c 89 f7             	mov    %r14,%rdi
+  8006ae:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006b3:	49 b8 75 04 80 00 00 	movabs $0x800475,%r8
+  8006ba:	00 00 00 
+  8006bd:	41 ff d0             	call   *%r8
+  8006c0:	e9 1e fe ff ff       	jmp    8004e3 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8006c5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006c8:	83 f8 2f             	cmp    $0x2f,%eax
+  8006cb:	77 6c                	ja     800739 <vprintfmt+0x287>
+  8006cd:	89 c2                	mov    %eax,%edx
+  8006cf:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8006d3:	83 c0 08             	add    $0x8,%eax
+  8006d6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8006d9:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  8006dc:	48 85 d2             	test   %rdx,%rdx
+  8006df:	48 b8 85 2f 80 00 00 	movabs $0x802f85,%rax
+  8006e6:	00 00 00 
+  8006e9:	48 0f 45 c2          	cmovne %rdx,%rax
+  8006ed:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  8006f1:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8006f5:	7e 06                	jle    8006fd <vprintfmt+0x24b>
+  8006f7:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  8006fb:	75 4a                	jne    800747 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8006fd:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800701:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  800705:	0f b6 00             	movzbl (%rax),%eax
+  800708:	84 c0                	test   %al,%al
+  80070a:	0f 85 9a 00 00 00    	jne    8007aa <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  800710:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800713:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  800717:	85 c0                	test   %eax,%eax
+  800719:	0f 8e c4 fd ff ff    	jle    8004e3 <vprintfmt+0x31>
+  80071f:	4c 89 ee             	mov    %r13,%rsi
+  800722:	bf 20 00 00 00       	mov    $0x20,%edi
+  800727:	41 ff d6             	call   *%r14
+  80072a:	41 83 ec 01          	sub    $0x1,%r12d
+  80072e:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  800732:	75 eb                	jne    80071f <vprintfmt+0x26d>
+  800734:	e9 aa fd ff ff       	jmp    8004e3 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800739:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80073d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800741:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800745:	eb 92                	jmp    8006d9 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  800747:	49 63 f7             	movslq %r15d,%rsi
+  80074a:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  80074e:	48 b8 64 0c 80 00 00 	movabs $0x800c64,%rax
+  800755:	00 00 00 
+  800758:	ff d0                	call   *%rax
+  80075a:	48 89 c2             	mov    %rax,%rdx
+  80075d:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800760:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  800762:	8d 70 ff             	lea    -0x1(%rax),%esi
+  800765:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  800768:	85 c0                	test   %eax,%eax
+  80076a:	7e 91                	jle    8006fd <vprintfmt+0x24b>
+  80076c:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  800771:	4c 89 ee             	mov    %r13,%rsi
+  800774:	44 89 e7             	mov    %r12d,%edi
+  800777:	41 ff d6             	call   *%r14
+  80077a:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  80077e:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800781:	83 f8 ff             	cmp    $0xffffffff,%eax
+  800784:	75 eb                	jne    800771 <vprintfmt+0x2bf>
+  800786:	e9 72 ff ff ff       	jmp    8006fd <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  80078b:	0f b6 f8             	movzbl %al,%edi
+  80078e:	4c 89 ee             	mov    %r13,%rsi
+  800791:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800794:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800798:	49 83 c4 01          	add    $0x1,%r12
+  80079c:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  8007a2:	84 c0                	test   %al,%al
+  8007a4:	0f 84 66 ff ff ff    	je     800710 <vprintfmt+0x25e>
+  8007aa:	45 85 ff             	test   %r15d,%r15d
+  8007ad:	78 0a                	js     8007b9 <vprintfmt+0x307>
+  8007af:	41 83 ef 01          	sub    $0x1,%r15d
+  8007b3:	0f 88 57 ff ff ff    	js     800710 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8007b9:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  8007bd:	74 cc                	je     80078b <vprintfmt+0x2d9>
+  8007bf:	8d 50 e0             	lea    -0x20(%rax),%edx
+  8007c2:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  8007c7:	80 fa 5e             	cmp    $0x5e,%dl
+  8007ca:	77 c2                	ja     80078e <vprintfmt+0x2dc>
+  8007cc:	eb bd                	jmp    80078b <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  8007ce:	40 84 f6             	test   %sil,%sil
+  8007d1:	75 26                	jne    8007f9 <vprintfmt+0x347>
+    switch (lflag) {
+  8007d3:	85 d2                	test   %edx,%edx
+  8007d5:	74 59                	je     800830 <vprintfmt+0x37e>
+  8007d7:	83 fa 01             	cmp    $0x1,%edx
+  8007da:	74 7b                	je     800857 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  8007dc:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007df:	83 f8 2f             	cmp    $0x2f,%eax
+  8007e2:	0f 87 96 00 00 00    	ja     80087e <vprintfmt+0x3cc>
+  8007e8:	89 c2                	mov    %eax,%edx
+  8007ea:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007ee:	83 c0 08             	add    $0x8,%eax
+  8007f1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007f4:	4c 8b 22             	mov    (%rdx),%r12
+  8007f7:	eb 17                	jmp    800810 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  8007f9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007fc:	83 f8 2f             	cmp    $0x2f,%eax
+  8007ff:	77 21                	ja     800822 <vprintfmt+0x370>
+  800801:	89 c2                	mov    %eax,%edx
+  800803:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800807:	83 c0 08             	add    $0x8,%eax
+  80080a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80080d:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  800810:	4d 85 e4             	test   %r12,%r12
+  800813:	78 7a                	js     80088f <vprintfmt+0x3dd>
+            num = i;
+  800815:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  800818:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  80081d:	e9 50 02 00 00       	jmp    800a72 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800822:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800826:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80082a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80082e:	eb dd                	jmp    80080d <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  800830:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800833:	83 f8 2f             	cmp    $0x2f,%eax
+  800836:	77 11                	ja     800849 <vprintfmt+0x397>
+  800838:	89 c2                	mov    %eax,%edx
+  80083a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80083e:	83 c0 08             	add    $0x8,%eax
+  800841:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800844:	4c 63 22             	movslq (%rdx),%r12
+  800847:	eb c7                	jmp    800810 <vprintfmt+0x35e>
+  800849:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80084d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800851:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800855:	eb ed                	jmp    800844 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  800857:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80085a:	83 f8 2f             	cmp    $0x2f,%eax
+  80085d:	77 11                	ja     800870 <vprintfmt+0x3be>
+  80085f:	89 c2                	mov    %eax,%edx
+  800861:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800865:	83 c0 08             	add    $0x8,%eax
+  800868:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80086b:	4c 8b 22             	mov    (%rdx),%r12
+  80086e:	eb a0                	jmp    800810 <vprintfmt+0x35e>
+  800870:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800874:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800878:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80087c:	eb ed                	jmp    80086b <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  80087e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800882:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800886:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80088a:	e9 65 ff ff ff       	jmp    8007f4 <vprintfmt+0x342>
+                putch('-', put_arg);
+  80088f:	4c 89 ee             	mov    %r13,%rsi
+  800892:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800897:	41 ff d6             	call   *%r14
+                i = -i;
+  80089a:	49 f7 dc             	neg    %r12
+  80089d:	e9 73 ff ff ff       	jmp    800815 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  8008a2:	40 84 f6             	test   %sil,%sil
+  8008a5:	75 32                	jne    8008d9 <vprintfmt+0x427>
+    switch (lflag) {
+  8008a7:	85 d2                	test   %edx,%edx
+  8008a9:	74 5d                	je     800908 <vprintfmt+0x456>
+  8008ab:	83 fa 01             	cmp    $0x1,%edx
+  8008ae:	0f 84 82 00 00 00    	je     800936 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  8008b4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008b7:	83 f8 2f             	cmp    $0x2f,%eax
+  8008ba:	0f 87 a5 00 00 00    	ja     800965 <vprintfmt+0x4b3>
+  8008c0:	89 c2                	mov    %eax,%edx
+  8008c2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008c6:	83 c0 08             	add    $0x8,%eax
+  8008c9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008cc:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8008cf:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  8008d4:	e9 99 01 00 00       	jmp    800a72 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8008d9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008dc:	83 f8 2f             	cmp    $0x2f,%eax
+  8008df:	77 19                	ja     8008fa <vprintfmt+0x448>
+  8008e1:	89 c2                	mov    %eax,%edx
+  8008e3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008e7:	83 c0 08             	add    $0x8,%eax
+  8008ea:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008ed:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8008f0:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8008f5:	e9 78 01 00 00       	jmp    800a72 <vprintfmt+0x5c0>
+  8008fa:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008fe:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800902:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800906:	eb e5                	jmp    8008ed <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  800908:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80090b:	83 f8 2f             	cmp    $0x2f,%eax
+  80090e:	77 18                	ja     800928 <vprintfmt+0x476>
+  800910:	89 c2                	mov    %eax,%edx
+  800912:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800916:	83 c0 08             	add    $0x8,%eax
+  800919:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80091c:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  80091e:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  800923:	e9 4a 01 00 00       	jmp    800a72 <vprintfmt+0x5c0>
+  800928:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80092c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800930:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800934:	eb e6                	jmp    80091c <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  800936:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800939:	83 f8 2f             	cmp    $0x2f,%eax
+  80093c:	77 19                	ja     800957 <vprintfmt+0x4a5>
+  80093e:	89 c2                	mov    %eax,%edx
+  800940:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800944:	83 c0 08             	add    $0x8,%eax
+  800947:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80094a:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  80094d:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  800952:	e9 1b 01 00 00       	jmp    800a72 <vprintfmt+0x5c0>
+  800957:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80095b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80095f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800963:	eb e5                	jmp    80094a <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  800965:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800969:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80096d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800971:	e9 56 ff ff ff       	jmp    8008cc <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  800976:	40 84 f6             	test   %sil,%sil
+  800979:	75 2e                	jne    8009a9 <vprintfmt+0x4f7>
+    switch (lflag) {
+  80097b:	85 d2                	test   %edx,%edx
+  80097d:	74 59                	je     8009d8 <vprintfmt+0x526>
+  80097f:	83 fa 01             	cmp    $0x1,%edx
+  800982:	74 7f                	je     800a03 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  800984:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800987:	83 f8 2f             	cmp    $0x2f,%eax
+  80098a:	0f 87 9f 00 00 00    	ja     800a2f <vprintfmt+0x57d>
+  800990:	89 c2                	mov    %eax,%edx
+  800992:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800996:	83 c0 08             	add    $0x8,%eax
+  800999:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80099c:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  80099f:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  8009a4:	e9 c9 00 00 00       	jmp    800a72 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8009a9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009ac:	83 f8 2f             	cmp    $0x2f,%eax
+  8009af:	77 19                	ja     8009ca <vprintfmt+0x518>
+  8009b1:	89 c2                	mov    %eax,%edx
+  8009b3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009b7:	83 c0 08             	add    $0x8,%eax
+  8009ba:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009bd:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8009c0:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8009c5:	e9 a8 00 00 00       	jmp    800a72 <vprintfmt+0x5c0>
+  8009ca:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009ce:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009d2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009d6:	eb e5                	jmp    8009bd <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  8009d8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009db:	83 f8 2f             	cmp    $0x2f,%eax
+  8009de:	77 15                	ja     8009f5 <vprintfmt+0x543>
+  8009e0:	89 c2                	mov    %eax,%edx
+  8009e2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009e6:	83 c0 08             	add    $0x8,%eax
+  8009e9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009ec:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  8009ee:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  8009f3:	eb 7d                	jmp    800a72 <vprintfmt+0x5c0>
+  8009f5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009f9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009fd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a01:	eb e9                	jmp    8009ec <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  800a03:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a06:	83 f8 2f             	cmp    $0x2f,%eax
+  800a09:	77 16                	ja     800a21 <vprintfmt+0x56f>
+  800a0b:	89 c2                	mov    %eax,%edx
+  800a0d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a11:	83 c0 08             	add    $0x8,%eax
+  800a14:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a17:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800a1a:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  800a1f:	eb 51                	jmp    800a72 <vprintfmt+0x5c0>
+  800a21:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a25:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a29:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a2d:	eb e8                	jmp    800a17 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  800a2f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a33:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a37:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a3b:	e9 5c ff ff ff       	jmp    80099c <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  800a40:	4c 89 ee             	mov    %r13,%rsi
+  800a43:	bf 30 00 00 00       	mov    $0x30,%edi
+  800a48:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800a4b:	4c 89 ee             	mov    %r13,%rsi
+  800a4e:	bf 78 00 00 00       	mov    $0x78,%edi
+  800a53:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800a56:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a59:	83 f8 2f             	cmp    $0x2f,%eax
+  800a5c:	77 47                	ja     800aa5 <vprintfmt+0x5f3>
+  800a5e:	89 c2                	mov    %eax,%edx
+  800a60:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a64:	83 c0 08             	add    $0x8,%eax
+  800a67:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a6a:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800a6d:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800a72:	48 83 ec 08          	sub    $0x8,%rsp
+  800a76:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800a7a:	0f 94 c0             	sete   %al
+  800a7d:	0f b6 c0             	movzbl %al,%eax
+  800a80:	50                   	push   %rax
+  800a81:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800a86:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800a8a:	4c 89 ee             	mov    %r13,%rsi
+  800a8d:	4c 89 f7             	mov    %r14,%rdi
+  800a90:	48 b8 a7 03 80 00 00 	movabs $0x8003a7,%rax
+  800a97:	00 00 00 
+  800a9a:	ff d0                	call   *%rax
+            break;
+  800a9c:	48 83 c4 10          	add    $0x10,%rsp
+  800aa0:	e9 3e fa ff ff       	jmp    8004e3 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800aa5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800aa9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800aad:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ab1:	eb b7                	jmp    800a6a <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  800ab3:	40 84 f6             	test   %sil,%sil
+  800ab6:	75 2b                	jne    800ae3 <vprintfmt+0x631>
+    switch (lflag) {
+  800ab8:	85 d2                	test   %edx,%edx
+  800aba:	74 56                	je     800b12 <vprintfmt+0x660>
+  800abc:	83 fa 01             	cmp    $0x1,%edx
+  800abf:	74 7f                	je     800b40 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800ac1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ac4:	83 f8 2f             	cmp    $0x2f,%eax
+  800ac7:	0f 87 a2 00 00 00    	ja     800b6f <vprintfmt+0x6bd>
+  800acd:	89 c2                	mov    %eax,%edx
+  800acf:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ad3:	83 c0 08             	add    $0x8,%eax
+  800ad6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ad9:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800adc:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800ae1:	eb 8f                	jmp    800a72 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800ae3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ae6:	83 f8 2f             	cmp    $0x2f,%eax
+  800ae9:	77 19                	ja     800b04 <vprintfmt+0x652>
+  800aeb:	89 c2                	mov    %eax,%edx
+  800aed:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800af1:	83 c0 08             	add    $0x8,%eax
+  800af4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800af7:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800afa:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800aff:	e9 6e ff ff ff       	jmp    800a72 <vprintfmt+0x5c0>
+  800b04:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b08:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b0c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b10:	eb e5                	jmp    800af7 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800b12:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b15:	83 f8 2f             	cmp    $0x2f,%eax
+  800b18:	77 18                	ja     800b32 <vprintfmt+0x680>
+  800b1a:	89 c2                	mov    %eax,%edx
+  800b1c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b20:	83 c0 08             	add    $0x8,%eax
+  800b23:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b26:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800b28:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800b2d:	e9 40 ff ff ff       	jmp    800a72 <vprintfmt+0x5c0>
+  800b32:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b36:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b3a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b3e:	eb e6                	jmp    800b26 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800b40:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b43:	83 f8 2f             	cmp    $0x2f,%eax
+  800b46:	77 19                	ja     800b61 <vprintfmt+0x6af>
+  800b48:	89 c2                	mov    %eax,%edx
+  800b4a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b4e:	83 c0 08             	add    $0x8,%eax
+  800b51:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b54:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800b57:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800b5c:	e9 11 ff ff ff       	jmp    800a72 <vprintfmt+0x5c0>
+  800b61:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b65:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b69:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b6d:	eb e5                	jmp    800b54 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800b6f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b73:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b77:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b7b:	e9 59 ff ff ff       	jmp    800ad9 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800b80:	4c 89 ee             	mov    %r13,%rsi
+  800b83:	bf 25 00 00 00       	mov    $0x25,%edi
+  800b88:	41 ff d6             	call   *%r14
+            break;
+  800b8b:	e9 53 f9 ff ff       	jmp    8004e3 <vprintfmt+0x31>
+            putch('%', put_arg);
+  800b90:	4c 89 ee             	mov    %r13,%rsi
+  800b93:	bf 25 00 00 00       	mov    $0x25,%edi
+  800b98:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800b9b:	48 83 eb 01          	sub    $0x1,%rbx
+  800b9f:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800ba3:	75 f6                	jne    800b9b <vprintfmt+0x6e9>
+  800ba5:	e9 39 f9 ff ff       	jmp    8004e3 <vprintfmt+0x31>
+}
+  800baa:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800bae:	5b                   	pop    %rbx
+  800baf:	41 5c                	pop    %r12
+  800bb1:	41 5d                	pop    %r13
+  800bb3:	41 5e                	pop    %r14
+  800bb5:	41 5f                	pop    %r15
+  800bb7:	5d                   	pop    %rbp
+  800bb8:	c3                   	ret
+
+0000000000800bb9 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800bb9:	55                   	push   %rbp
+  800bba:	48 89 e5             	mov    %rsp,%rbp
+  800bbd:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800bc1:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800bc5:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800bca:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800bce:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800bd5:	48 85 ff             	test   %rdi,%rdi
+  800bd8:	74 2b                	je     800c05 <vsnprintf+0x4c>
+  800bda:	48 85 f6             	test   %rsi,%rsi
+  800bdd:	74 26                	je     800c05 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800bdf:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800be3:	48 bf 5d 04 80 00 00 	movabs $0x80045d,%rdi
+  800bea:	00 00 00 
+  800bed:	48 b8 b2 04 80 00 00 	movabs $0x8004b2,%rax
+  800bf4:	00 00 00 
+  800bf7:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800bf9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800bfd:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800c00:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800c03:	c9                   	leave
+  800c04:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800c05:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800c0a:	eb f7                	jmp    800c03 <vsnprintf+0x4a>
+
+0000000000800c0c <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800c0c:	55                   	push   %rbp
+  800c0d:	48 89 e5             	mov    %rsp,%rbp
+  800c10:	48 83 ec 50          	sub    $0x50,%rsp
+  800c14:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800c18:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800c1c:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800c20:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800c27:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800c2b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c2f:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800c33:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800c37:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800c3b:	48 b8 b9 0b 80 00 00 	movabs $0x800bb9,%rax
+  800c42:	00 00 00 
+  800c45:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800c47:	c9                   	leave
+  800c48:	c3                   	ret
+
+0000000000800c49 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800c49:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800c4c:	74 10                	je     800c5e <strlen+0x15>
+    size_t n = 0;
+  800c4e:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800c53:	48 83 c0 01          	add    $0x1,%rax
+  800c57:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800c5b:	75 f6                	jne    800c53 <strlen+0xa>
+  800c5d:	c3                   	ret
+    size_t n = 0;
+  800c5e:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800c63:	c3                   	ret
+
+0000000000800c64 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800c64:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800c67:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800c6c:	48 85 f6             	test   %rsi,%rsi
+  800c6f:	74 11                	je     800c82 <strnlen+0x1e>
+  800c71:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800c75:	74 0c                	je     800c83 <strnlen+0x1f>
+  800c77:	48 83 c2 01          	add    $0x1,%rdx
+  800c7b:	48 39 d0             	cmp    %rdx,%rax
+  800c7e:	75 f1                	jne    800c71 <strnlen+0xd>
+  800c80:	eb 04                	jmp    800c86 <strnlen+0x22>
+  800c82:	c3                   	ret
+  800c83:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800c86:	c3                   	ret
+
+0000000000800c87 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800c87:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800c8a:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c8f:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800c93:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800c96:	48 83 c2 01          	add    $0x1,%rdx
+  800c9a:	84 c9                	test   %cl,%cl
+  800c9c:	75 f1                	jne    800c8f <strcpy+0x8>
+        ;
+    return res;
+}
+  800c9e:	c3                   	ret
+
+0000000000800c9f <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800c9f:	55                   	push   %rbp
+  800ca0:	48 89 e5             	mov    %rsp,%rbp
+  800ca3:	41 54                	push   %r12
+  800ca5:	53                   	push   %rbx
+  800ca6:	48 89 fb             	mov    %rdi,%rbx
+  800ca9:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800cac:	48 b8 49 0c 80 00 00 	movabs $0x800c49,%rax
+  800cb3:	00 00 00 
+  800cb6:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800cb8:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800cbc:	4c 89 e6             	mov    %r12,%rsi
+  800cbf:	48 b8 87 0c 80 00 00 	movabs $0x800c87,%rax
+  800cc6:	00 00 00 
+  800cc9:	ff d0                	call   *%rax
+    return dst;
+}
+  800ccb:	48 89 d8             	mov    %rbx,%rax
+  800cce:	5b                   	pop    %rbx
+  800ccf:	41 5c                	pop    %r12
+  800cd1:	5d                   	pop    %rbp
+  800cd2:	c3                   	ret
+
+0000000000800cd3 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800cd3:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800cd6:	48 85 d2             	test   %rdx,%rdx
+  800cd9:	74 1f                	je     800cfa <strncpy+0x27>
+  800cdb:	48 01 fa             	add    %rdi,%rdx
+  800cde:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800ce1:	48 83 c1 01          	add    $0x1,%rcx
+  800ce5:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800ce9:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800ced:	41 80 f8 01          	cmp    $0x1,%r8b
+  800cf1:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800cf5:	48 39 ca             	cmp    %rcx,%rdx
+  800cf8:	75 e7                	jne    800ce1 <strncpy+0xe>
+    }
+    return ret;
+}
+  800cfa:	c3                   	ret
+
+0000000000800cfb <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800cfb:	48 89 f8             	mov    %rdi,%rax
+  800cfe:	48 85 d2             	test   %rdx,%rdx
+  800d01:	74 24                	je     800d27 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800d03:	48 83 ea 01          	sub    $0x1,%rdx
+  800d07:	74 1b                	je     800d24 <strlcpy+0x29>
+  800d09:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800d0d:	0f b6 16             	movzbl (%rsi),%edx
+  800d10:	84 d2                	test   %dl,%dl
+  800d12:	74 10                	je     800d24 <strlcpy+0x29>
+            *dst++ = *src++;
+  800d14:	48 83 c6 01          	add    $0x1,%rsi
+  800d18:	48 83 c0 01          	add    $0x1,%rax
+  800d1c:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800d1f:	48 39 c8             	cmp    %rcx,%rax
+  800d22:	75 e9                	jne    800d0d <strlcpy+0x12>
+        *dst = '\0';
+  800d24:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800d27:	48 29 f8             	sub    %rdi,%rax
+}
+  800d2a:	c3                   	ret
+
+0000000000800d2b <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800d2b:	0f b6 07             	movzbl (%rdi),%eax
+  800d2e:	84 c0                	test   %al,%al
+  800d30:	74 13                	je     800d45 <strcmp+0x1a>
+  800d32:	38 06                	cmp    %al,(%rsi)
+  800d34:	75 0f                	jne    800d45 <strcmp+0x1a>
+  800d36:	48 83 c7 01          	add    $0x1,%rdi
+  800d3a:	48 83 c6 01          	add    $0x1,%rsi
+  800d3e:	0f b6 07             	movzbl (%rdi),%eax
+  800d41:	84 c0                	test   %al,%al
+  800d43:	75 ed                	jne    800d32 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800d45:	0f b6 c0             	movzbl %al,%eax
+  800d48:	0f b6 16             	movzbl (%rsi),%edx
+  800d4b:	29 d0                	sub    %edx,%eax
+}
+  800d4d:	c3                   	ret
+
+0000000000800d4e <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800d4e:	48 85 d2             	test   %rdx,%rdx
+  800d51:	74 1f                	je     800d72 <strncmp+0x24>
+  800d53:	0f b6 07             	movzbl (%rdi),%eax
+  800d56:	84 c0                	test   %al,%al
+  800d58:	74 1e                	je     800d78 <strncmp+0x2a>
+  800d5a:	3a 06                	cmp    (%rsi),%al
+  800d5c:	75 1a                	jne    800d78 <strncmp+0x2a>
+  800d5e:	48 83 c7 01          	add    $0x1,%rdi
+  800d62:	48 83 c6 01          	add    $0x1,%rsi
+  800d66:	48 83 ea 01          	sub    $0x1,%rdx
+  800d6a:	75 e7                	jne    800d53 <strncmp+0x5>
+
+    if (!n) return 0;
+  800d6c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d71:	c3                   	ret
+  800d72:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d77:	c3                   	ret
+  800d78:	48 85 d2             	test   %rdx,%rdx
+  800d7b:	74 09                	je     800d86 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800d7d:	0f b6 07             	movzbl (%rdi),%eax
+  800d80:	0f b6 16             	movzbl (%rsi),%edx
+  800d83:	29 d0                	sub    %edx,%eax
+  800d85:	c3                   	ret
+    if (!n) return 0;
+  800d86:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800d8b:	c3                   	ret
+
+0000000000800d8c <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800d8c:	0f b6 17             	movzbl (%rdi),%edx
+  800d8f:	84 d2                	test   %dl,%dl
+  800d91:	74 18                	je     800dab <strchr+0x1f>
+        if (*str == c) {
+  800d93:	0f be d2             	movsbl %dl,%edx
+  800d96:	39 f2                	cmp    %esi,%edx
+  800d98:	74 17                	je     800db1 <strchr+0x25>
+    for (; *str; str++) {
+  800d9a:	48 83 c7 01          	add    $0x1,%rdi
+  800d9e:	0f b6 17             	movzbl (%rdi),%edx
+  800da1:	84 d2                	test   %dl,%dl
+  800da3:	75 ee                	jne    800d93 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800da5:	b8 00 00 00 00       	mov    $0x0,%eax
+  800daa:	c3                   	ret
+  800dab:	b8 00 00 00 00       	mov    $0x0,%eax
+  800db0:	c3                   	ret
+  800db1:	48 89 f8             	mov    %rdi,%rax
+}
+  800db4:	c3                   	ret
+
+0000000000800db5 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800db5:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800db8:	0f b6 17             	movzbl (%rdi),%edx
+  800dbb:	84 d2                	test   %dl,%dl
+  800dbd:	74 13                	je     800dd2 <strfind+0x1d>
+  800dbf:	0f be d2             	movsbl %dl,%edx
+  800dc2:	39 f2                	cmp    %esi,%edx
+  800dc4:	74 0b                	je     800dd1 <strfind+0x1c>
+  800dc6:	48 83 c0 01          	add    $0x1,%rax
+  800dca:	0f b6 10             	movzbl (%rax),%edx
+  800dcd:	84 d2                	test   %dl,%dl
+  800dcf:	75 ee                	jne    800dbf <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800dd1:	c3                   	ret
+  800dd2:	c3                   	ret
+
+0000000000800dd3 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800dd3:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800dd6:	48 89 f8             	mov    %rdi,%rax
+  800dd9:	48 f7 d8             	neg    %rax
+  800ddc:	83 e0 07             	and    $0x7,%eax
+  800ddf:	49 89 d1             	mov    %rdx,%r9
+  800de2:	49 29 c1             	sub    %rax,%r9
+  800de5:	78 36                	js     800e1d <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800de7:	40 0f b6 c6          	movzbl %sil,%eax
+  800deb:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800df2:	01 01 01 
+  800df5:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800df9:	40 f6 c7 07          	test   $0x7,%dil
+  800dfd:	75 38                	jne    800e37 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800dff:	4c 89 c9             	mov    %r9,%rcx
+  800e02:	48 c1 f9 03          	sar    $0x3,%rcx
+  800e06:	74 0c                	je     800e14 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800e08:	fc                   	cld
+  800e09:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800e0c:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800e10:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800e14:	4d 85 c9             	test   %r9,%r9
+  800e17:	75 45                	jne    800e5e <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800e19:	4c 89 c0             	mov    %r8,%rax
+  800e1c:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800e1d:	48 85 d2             	test   %rdx,%rdx
+  800e20:	74 f7                	je     800e19 <memset+0x46>
+  800e22:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800e25:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800e28:	48 83 c0 01          	add    $0x1,%rax
+  800e2c:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  800e30:	48 39 c2             	cmp    %rax,%rdx
+  800e33:	75 f3                	jne    800e28 <memset+0x55>
+  800e35:	eb e2                	jmp    800e19 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  800e37:	40 f6 c7 01          	test   $0x1,%dil
+  800e3b:	74 06                	je     800e43 <memset+0x70>
+  800e3d:	88 07                	mov    %al,(%rdi)
+  800e3f:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800e43:	40 f6 c7 02          	test   $0x2,%dil
+  800e47:	74 07                	je     800e50 <memset+0x7d>
+  800e49:	66 89 07             	mov    %ax,(%rdi)
+  800e4c:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800e50:	40 f6 c7 04          	test   $0x4,%dil
+  800e54:	74 a9                	je     800dff <memset+0x2c>
+  800e56:	89 07                	mov    %eax,(%rdi)
+  800e58:	48 83 c7 04          	add    $0x4,%rdi
+  800e5c:	eb a1                	jmp    800dff <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800e5e:	41 f6 c1 04          	test   $0x4,%r9b
+  800e62:	74 06                	je     800e6a <memset+0x97>
+  800e64:	89 07                	mov    %eax,(%rdi)
+  800e66:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800e6a:	41 f6 c1 02          	test   $0x2,%r9b
+  800e6e:	74 07                	je     800e77 <memset+0xa4>
+  800e70:	66 89 07             	mov    %ax,(%rdi)
+  800e73:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  800e77:	41 f6 c1 01          	test   $0x1,%r9b
+  800e7b:	74 9c                	je     800e19 <memset+0x46>
+  800e7d:	88 07                	mov    %al,(%rdi)
+  800e7f:	eb 98                	jmp    800e19 <memset+0x46>
+
+0000000000800e81 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  800e81:	48 89 f8             	mov    %rdi,%rax
+  800e84:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  800e87:	48 39 fe             	cmp    %rdi,%rsi
+  800e8a:	73 3b                	jae    800ec7 <memmove+0x46>
+  800e8c:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  800e90:	48 39 d7             	cmp    %rdx,%rdi
+  800e93:	73 32                	jae    800ec7 <memmove+0x46>
+        s += n;
+        d += n;
+  800e95:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800e99:	48 89 d6             	mov    %rdx,%rsi
+  800e9c:	48 09 fe             	or     %rdi,%rsi
+  800e9f:	48 09 ce             	or     %rcx,%rsi
+  800ea2:	40 f6 c6 07          	test   $0x7,%sil
+  800ea6:	75 12                	jne    800eba <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  800ea8:	48 83 ef 08          	sub    $0x8,%rdi
+  800eac:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  800eb0:	48 c1 e9 03          	shr    $0x3,%rcx
+  800eb4:	fd                   	std
+  800eb5:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  800eb8:	fc                   	cld
+  800eb9:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  800eba:	48 83 ef 01          	sub    $0x1,%rdi
+  800ebe:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  800ec2:	fd                   	std
+  800ec3:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  800ec5:	eb f1                	jmp    800eb8 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800ec7:	48 89 f2             	mov    %rsi,%rdx
+  800eca:	48 09 c2             	or     %rax,%rdx
+  800ecd:	48 09 ca             	or     %rcx,%rdx
+  800ed0:	f6 c2 07             	test   $0x7,%dl
+  800ed3:	75 0c                	jne    800ee1 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  800ed5:	48 c1 e9 03          	shr    $0x3,%rcx
+  800ed9:	48 89 c7             	mov    %rax,%rdi
+  800edc:	fc                   	cld
+  800edd:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  800ee0:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  800ee1:	48 89 c7             	mov    %rax,%rdi
+  800ee4:	fc                   	cld
+  800ee5:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  800ee7:	c3                   	ret
+
+0000000000800ee8 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  800ee8:	55                   	push   %rbp
+  800ee9:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  800eec:	48 b8 81 0e 80 00 00 	movabs $0x800e81,%rax
+  800ef3:	00 00 00 
+  800ef6:	ff d0                	call   *%rax
+}
+  800ef8:	5d                   	pop    %rbp
+  800ef9:	c3                   	ret
+
+0000000000800efa <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  800efa:	55                   	push   %rbp
+  800efb:	48 89 e5             	mov    %rsp,%rbp
+  800efe:	41 57                	push   %r15
+  800f00:	41 56                	push   %r14
+  800f02:	41 55                	push   %r13
+  800f04:	41 54                	push   %r12
+  800f06:	53                   	push   %rbx
+  800f07:	48 83 ec 08          	sub    $0x8,%rsp
+  800f0b:	49 89 fe             	mov    %rdi,%r14
+  800f0e:	49 89 f7             	mov    %rsi,%r15
+  800f11:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  800f14:	48 89 f7             	mov    %rsi,%rdi
+  800f17:	48 b8 49 0c 80 00 00 	movabs $0x800c49,%rax
+  800f1e:	00 00 00 
+  800f21:	ff d0                	call   *%rax
+  800f23:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  800f26:	48 89 de             	mov    %rbx,%rsi
+  800f29:	4c 89 f7             	mov    %r14,%rdi
+  800f2c:	48 b8 64 0c 80 00 00 	movabs $0x800c64,%rax
+  800f33:	00 00 00 
+  800f36:	ff d0                	call   *%rax
+  800f38:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  800f3b:	48 39 c3             	cmp    %rax,%rbx
+  800f3e:	74 36                	je     800f76 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  800f40:	48 89 d8             	mov    %rbx,%rax
+  800f43:	4c 29 e8             	sub    %r13,%rax
+  800f46:	49 39 c4             	cmp    %rax,%r12
+  800f49:	73 31                	jae    800f7c <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  800f4b:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  800f50:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800f54:	4c 89 fe             	mov    %r15,%rsi
+  800f57:	48 b8 e8 0e 80 00 00 	movabs $0x800ee8,%rax
+  800f5e:	00 00 00 
+  800f61:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  800f63:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  800f67:	48 83 c4 08          	add    $0x8,%rsp
+  800f6b:	5b                   	pop    %rbx
+  800f6c:	41 5c                	pop    %r12
+  800f6e:	41 5d                	pop    %r13
+  800f70:	41 5e                	pop    %r14
+  800f72:	41 5f                	pop    %r15
+  800f74:	5d                   	pop    %rbp
+  800f75:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  800f76:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800f7a:	eb eb                	jmp    800f67 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  800f7c:	48 83 eb 01          	sub    $0x1,%rbx
+  800f80:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800f84:	48 89 da             	mov    %rbx,%rdx
+  800f87:	4c 89 fe             	mov    %r15,%rsi
+  800f8a:	48 b8 e8 0e 80 00 00 	movabs $0x800ee8,%rax
+  800f91:	00 00 00 
+  800f94:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  800f96:	49 01 de             	add    %rbx,%r14
+  800f99:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  800f9e:	eb c3                	jmp    800f63 <strlcat+0x69>
+
+0000000000800fa0 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  800fa0:	48 85 d2             	test   %rdx,%rdx
+  800fa3:	74 2d                	je     800fd2 <memcmp+0x32>
+  800fa5:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  800faa:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800fae:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  800fb3:	44 38 c1             	cmp    %r8b,%cl
+  800fb6:	75 0f                	jne    800fc7 <memcmp+0x27>
+    while (n-- > 0) {
+  800fb8:	48 83 c0 01          	add    $0x1,%rax
+  800fbc:	48 39 c2             	cmp    %rax,%rdx
+  800fbf:	75 e9                	jne    800faa <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  800fc1:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fc6:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  800fc7:	0f b6 c1             	movzbl %cl,%eax
+  800fca:	45 0f b6 c0          	movzbl %r8b,%r8d
+  800fce:	44 29 c0             	sub    %r8d,%eax
+  800fd1:	c3                   	ret
+    return 0;
+  800fd2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800fd7:	c3                   	ret
+
+0000000000800fd8 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  800fd8:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  800fdc:	48 39 c7             	cmp    %rax,%rdi
+  800fdf:	73 0f                	jae    800ff0 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  800fe1:	40 38 37             	cmp    %sil,(%rdi)
+  800fe4:	74 0e                	je     800ff4 <memfind+0x1c>
+    for (; src < end; src++) {
+  800fe6:	48 83 c7 01          	add    $0x1,%rdi
+  800fea:	48 39 f8             	cmp    %rdi,%rax
+  800fed:	75 f2                	jne    800fe1 <memfind+0x9>
+  800fef:	c3                   	ret
+  800ff0:	48 89 f8             	mov    %rdi,%rax
+  800ff3:	c3                   	ret
+  800ff4:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  800ff7:	c3                   	ret
+
+0000000000800ff8 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  800ff8:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  800ffb:	0f b6 37             	movzbl (%rdi),%esi
+  800ffe:	40 80 fe 20          	cmp    $0x20,%sil
+  801002:	74 06                	je     80100a <strtol+0x12>
+  801004:	40 80 fe 09          	cmp    $0x9,%sil
+  801008:	75 13                	jne    80101d <strtol+0x25>
+  80100a:	48 83 c7 01          	add    $0x1,%rdi
+  80100e:	0f b6 37             	movzbl (%rdi),%esi
+  801011:	40 80 fe 20          	cmp    $0x20,%sil
+  801015:	74 f3                	je     80100a <strtol+0x12>
+  801017:	40 80 fe 09          	cmp    $0x9,%sil
+  80101b:	74 ed                	je     80100a <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  80101d:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  801020:	83 e0 fd             	and    $0xfffffffd,%eax
+  801023:	3c 01                	cmp    $0x1,%al
+  801025:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801029:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  80102f:	75 0f                	jne    801040 <strtol+0x48>
+  801031:	80 3f 30             	cmpb   $0x30,(%rdi)
+  801034:	74 14                	je     80104a <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  801036:	85 d2                	test   %edx,%edx
+  801038:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80103d:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  801040:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  801045:	4c 63 ca             	movslq %edx,%r9
+  801048:	eb 36                	jmp    801080 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  80104a:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  80104e:	74 0f                	je     80105f <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  801050:	85 d2                	test   %edx,%edx
+  801052:	75 ec                	jne    801040 <strtol+0x48>
+        s++;
+  801054:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  801058:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  80105d:	eb e1                	jmp    801040 <strtol+0x48>
+        s += 2;
+  80105f:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  801063:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  801068:	eb d6                	jmp    801040 <strtol+0x48>
+            dig -= '0';
+  80106a:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  80106d:	44 0f b6 c1          	movzbl %cl,%r8d
+  801071:	41 39 d0             	cmp    %edx,%r8d
+  801074:	7d 21                	jge    801097 <strtol+0x9f>
+        val = val * base + dig;
+  801076:	49 0f af c1          	imul   %r9,%rax
+  80107a:	0f b6 c9             	movzbl %cl,%ecx
+  80107d:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  801080:	48 83 c7 01          	add    $0x1,%rdi
+  801084:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  801088:	80 f9 39             	cmp    $0x39,%cl
+  80108b:	76 dd                	jbe    80106a <strtol+0x72>
+        else if (dig - 'a' < 27)
+  80108d:	80 f9 7b             	cmp    $0x7b,%cl
+  801090:	77 05                	ja     801097 <strtol+0x9f>
+            dig -= 'a' - 10;
+  801092:	83 e9 57             	sub    $0x57,%ecx
+  801095:	eb d6                	jmp    80106d <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  801097:	4d 85 d2             	test   %r10,%r10
+  80109a:	74 03                	je     80109f <strtol+0xa7>
+  80109c:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  80109f:	48 89 c2             	mov    %rax,%rdx
+  8010a2:	48 f7 da             	neg    %rdx
+  8010a5:	40 80 fe 2d          	cmp    $0x2d,%sil
+  8010a9:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  8010ad:	c3                   	ret
+
+00000000008010ae <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  8010ae:	55                   	push   %rbp
+  8010af:	48 89 e5             	mov    %rsp,%rbp
+  8010b2:	53                   	push   %rbx
+  8010b3:	48 89 fa             	mov    %rdi,%rdx
+  8010b6:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8010b9:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8010be:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010c3:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8010c8:	be 00 00 00 00       	mov    $0x0,%esi
+  8010cd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8010d3:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  8010d5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8010d9:	c9                   	leave
+  8010da:	c3                   	ret
+
+00000000008010db <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  8010db:	55                   	push   %rbp
+  8010dc:	48 89 e5             	mov    %rsp,%rbp
+  8010df:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8010e0:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8010e5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010ea:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8010ef:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010f4:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8010f9:	be 00 00 00 00       	mov    $0x0,%esi
+  8010fe:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801104:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  801106:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80110a:	c9                   	leave
+  80110b:	c3                   	ret
+
+000000000080110c <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  80110c:	55                   	push   %rbp
+  80110d:	48 89 e5             	mov    %rsp,%rbp
+  801110:	53                   	push   %rbx
+  801111:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  801115:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801118:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80111d:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801122:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801127:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80112c:	be 00 00 00 00       	mov    $0x0,%esi
+  801131:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801137:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801139:	48 85 c0             	test   %rax,%rax
+  80113c:	7f 06                	jg     801144 <sys_env_destroy+0x38>
+}
+  80113e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801142:	c9                   	leave
+  801143:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801144:	49 89 c0             	mov    %rax,%r8
+  801147:	b9 03 00 00 00       	mov    $0x3,%ecx
+  80114c:	48 ba b0 34 80 00 00 	movabs $0x8034b0,%rdx
+  801153:	00 00 00 
+  801156:	be 26 00 00 00       	mov    $0x26,%esi
+  80115b:	48 bf cf 34 80 00 00 	movabs $0x8034cf,%rdi
+  801162:	00 00 00 
+  801165:	b8 00 00 00 00       	mov    $0x0,%eax
+  80116a:	49 b9 12 02 80 00 00 	movabs $0x800212,%r9
+  801171:	00 00 00 
+  801174:	41 ff d1             	call   *%r9
+
+0000000000801177 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  801177:	55                   	push   %rbp
+  801178:	48 89 e5             	mov    %rsp,%rbp
+  80117b:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80117c:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801181:	ba 00 00 00 00       	mov    $0x0,%edx
+  801186:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80118b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801190:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801195:	be 00 00 00 00       	mov    $0x0,%esi
+  80119a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8011a0:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  8011a2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8011a6:	c9                   	leave
+  8011a7:	c3                   	ret
+
+00000000008011a8 <sys_yield>:
+
+void
+sys_yield(void) {
+  8011a8:	55                   	push   %rbp
+  8011a9:	48 89 e5             	mov    %rsp,%rbp
+  8011ac:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8011ad:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8011b2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011b7:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8011bc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011c1:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8011c6:	be 00 00 00 00       	mov    $0x0,%esi
+  8011cb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8011d1:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  8011d3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8011d7:	c9                   	leave
+  8011d8:	c3                   	ret
+
+00000000008011d9 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  8011d9:	55                   	push   %rbp
+  8011da:	48 89 e5             	mov    %rsp,%rbp
+  8011dd:	53                   	push   %rbx
+  8011de:	48 89 fa             	mov    %rdi,%rdx
+  8011e1:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8011e4:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8011e9:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  8011f0:	00 00 00 
+  8011f3:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8011f8:	be 00 00 00 00       	mov    $0x0,%esi
+  8011fd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801203:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  801205:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801209:	c9                   	leave
+  80120a:	c3                   	ret
+
+000000000080120b <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  80120b:	55                   	push   %rbp
+  80120c:	48 89 e5             	mov    %rsp,%rbp
+  80120f:	53                   	push   %rbx
+  801210:	49 89 f8             	mov    %rdi,%r8
+  801213:	48 89 d3             	mov    %rdx,%rbx
+  801216:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801219:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80121e:	4c 89 c2             	mov    %r8,%rdx
+  801221:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801224:	be 00 00 00 00       	mov    $0x0,%esi
+  801229:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80122f:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  801231:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801235:	c9                   	leave
+  801236:	c3                   	ret
+
+0000000000801237 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  801237:	55                   	push   %rbp
+  801238:	48 89 e5             	mov    %rsp,%rbp
+  80123b:	53                   	push   %rbx
+  80123c:	48 83 ec 08          	sub    $0x8,%rsp
+  801240:	89 f8                	mov    %edi,%eax
+  801242:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  801245:	48 63 f9             	movslq %ecx,%rdi
+  801248:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80124b:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801250:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801253:	be 00 00 00 00       	mov    $0x0,%esi
+  801258:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80125e:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801260:	48 85 c0             	test   %rax,%rax
+  801263:	7f 06                	jg     80126b <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  801265:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801269:	c9                   	leave
+  80126a:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80126b:	49 89 c0             	mov    %rax,%r8
+  80126e:	b9 04 00 00 00       	mov    $0x4,%ecx
+  801273:	48 ba b0 34 80 00 00 	movabs $0x8034b0,%rdx
+  80127a:	00 00 00 
+  80127d:	be 26 00 00 00       	mov    $0x26,%esi
+  801282:	48 bf cf 34 80 00 00 	movabs $0x8034cf,%rdi
+  801289:	00 00 00 
+  80128c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801291:	49 b9 12 02 80 00 00 	movabs $0x800212,%r9
+  801298:	00 00 00 
+  80129b:	41 ff d1             	call   *%r9
+
+000000000080129e <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  80129e:	55                   	push   %rbp
+  80129f:	48 89 e5             	mov    %rsp,%rbp
+  8012a2:	53                   	push   %rbx
+  8012a3:	48 83 ec 08          	sub    $0x8,%rsp
+  8012a7:	89 f8                	mov    %edi,%eax
+  8012a9:	49 89 f2             	mov    %rsi,%r10
+  8012ac:	48 89 cf             	mov    %rcx,%rdi
+  8012af:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  8012b2:	48 63 da             	movslq %edx,%rbx
+  8012b5:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8012b8:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8012bd:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012c0:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  8012c3:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8012c5:	48 85 c0             	test   %rax,%rax
+  8012c8:	7f 06                	jg     8012d0 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8012ca:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012ce:	c9                   	leave
+  8012cf:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8012d0:	49 89 c0             	mov    %rax,%r8
+  8012d3:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8012d8:	48 ba b0 34 80 00 00 	movabs $0x8034b0,%rdx
+  8012df:	00 00 00 
+  8012e2:	be 26 00 00 00       	mov    $0x26,%esi
+  8012e7:	48 bf cf 34 80 00 00 	movabs $0x8034cf,%rdi
+  8012ee:	00 00 00 
+  8012f1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012f6:	49 b9 12 02 80 00 00 	movabs $0x800212,%r9
+  8012fd:	00 00 00 
+  801300:	41 ff d1             	call   *%r9
+
+0000000000801303 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  801303:	55                   	push   %rbp
+  801304:	48 89 e5             	mov    %rsp,%rbp
+  801307:	53                   	push   %rbx
+  801308:	48 83 ec 08          	sub    $0x8,%rsp
+  80130c:	48 89 f1             	mov    %rsi,%rcx
+  80130f:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  801312:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801315:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80131a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80131f:	be 00 00 00 00       	mov    $0x0,%esi
+  801324:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80132a:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80132c:	48 85 c0             	test   %rax,%rax
+  80132f:	7f 06                	jg     801337 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  801331:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801335:	c9                   	leave
+  801336:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801337:	49 89 c0             	mov    %rax,%r8
+  80133a:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80133f:	48 ba b0 34 80 00 00 	movabs $0x8034b0,%rdx
+  801346:	00 00 00 
+  801349:	be 26 00 00 00       	mov    $0x26,%esi
+  80134e:	48 bf cf 34 80 00 00 	movabs $0x8034cf,%rdi
+  801355:	00 00 00 
+  801358:	b8 00 00 00 00       	mov    $0x0,%eax
+  80135d:	49 b9 12 02 80 00 00 	movabs $0x800212,%r9
+  801364:	00 00 00 
+  801367:	41 ff d1             	call   *%r9
+
+000000000080136a <sys_region_batch>:
+
+int
+sys_region_batch(const struct RegionOp *ops, size_t count) {
+  80136a:	55                   	push   %rbp
+  80136b:	48 89 e5             	mov    %rsp,%rbp
+  80136e:	53                   	push   %rbx
+  80136f:	48 83 ec 08          	sub    $0x8,%rsp
+  801373:	48 89 fa             	mov    %rdi,%rdx
+  801376:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801379:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80137e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801383:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801388:	be 00 00 00 00       	mov    $0x0,%esi
+  80138d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801393:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801395:	48 85 c0             	test   %rax,%rax
+  801398:	7f 06                	jg     8013a0 <sys_region_batch+0x36>
+        else
+            platform_asan_unpoison(va, ops[i].size);
+    }
+#endif
+    return res;
+}
+  80139a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80139e:	c9                   	leave
+  80139f:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8013a0:	49 89 c0             	mov    %rax,%r8
+  8013a3:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  8013a8:	48 ba b0 34 80 00 00 	movabs $0x8034b0,%rdx
+  8013af:	00 00 00 
+  8013b2:	be 26 00 00 00       	mov    $0x26,%esi
+  8013b7:	48 bf cf 34 80 00 00 	movabs $0x8034cf,%rdi
+  8013be:	00 00 00 
+  8013c1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013c6:	49 b9 12 02 80 00 00 	movabs $0x800212,%r9
+  8013cd:	00 00 00 
+  8013d0:	41 ff d1             	call   *%r9
+
+00000000008013d3 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  8013d3:	55                   	push   %rbp
+  8013d4:	48 89 e5             	mov    %rsp,%rbp
+  8013d7:	53                   	push   %rbx
+  8013d8:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  8013dc:	48 63 ce             	movslq %esi,%rcx
+  8013df:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8013e2:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8013e7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013ec:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013f1:	be 00 00 00 00       	mov    $0x0,%esi
+  8013f6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013fc:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8013fe:	48 85 c0             	test   %rax,%rax
+  801401:	7f 06                	jg     801409 <sys_env_set_status+0x36>
+}
+  801403:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801407:	c9                   	leave
+  801408:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801409:	49 89 c0             	mov    %rax,%r8
+  80140c:	b9 09 00 00 00       	mov    $0x9,%ecx
+  801411:	48 ba b0 34 80 00 00 	movabs $0x8034b0,%rdx
+  801418:	00 00 00 
+  80141b:	be 26 00 00 00       	mov    $0x26,%esi
+  801420:	48 bf cf 34 80 00 00 	movabs $0x8034cf,%rdi
+  801427:	00 00 00 
+  80142a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80142f:	49 b9 12 02 80 00 00 	movabs $0x800212,%r9
+  801436:	00 00 00 
+  801439:	41 ff d1             	call   *%r9
+
+000000000080143c <sys_env_set_weight>:
+
+int
+sys_env_set_weight(envid_t envid, uint32_t weight) {
+  80143c:	55                   	push   %rbp
+  80143d:	48 89 e5             	mov    %rsp,%rbp
+  801440:	53                   	push   %rbx
+  801441:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_weight, 1, envid, weight, 0, 0, 0, 0);
+  801445:	89 f1                	mov    %esi,%ecx
+  801447:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80144a:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80144f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801454:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801459:	be 00 00 00 00       	mov    $0x0,%esi
+  80145e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801464:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801466:	48 85 c0             	test   %rax,%rax
+  801469:	7f 06                	jg     801471 <sys_env_set_weight+0x35>
+}
+  80146b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80146f:	c9                   	leave
+  801470:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801471:	49 89 c0             	mov    %rax,%r8
+  801474:	b9 10 00 00 00       	mov    $0x10,%ecx
+  801479:	48 ba b0 34 80 00 00 	movabs $0x8034b0,%rdx
+  801480:	00 00 00 
+  801483:	be 26 00 00 00       	mov    $0x26,%esi
+  801488:	48 bf cf 34 80 00 00 	movabs $0x8034cf,%rdi
+  80148f:	00 00 00 
+  801492:	b8 00 00 00 00       	mov    $0x0,%eax
+  801497:	49 b9 12 02 80 00 00 	movabs $0x800212,%r9
+  80149e:	00 00 00 
+  8014a1:	41 ff d1             	call   *%r9
+
+00000000008014a4 <sys_env_set_rt>:
+
+int
+sys_env_set_rt(envid_t envid, uint64_t period, uint64_t budget, uint64_t deadline) {
+  8014a4:	55                   	push   %rbp
+  8014a5:	48 89 e5             	mov    %rsp,%rbp
+  8014a8:	53                   	push   %rbx
+  8014a9:	48 83 ec 08          	sub    $0x8,%rsp
+  8014ad:	89 f8                	mov    %edi,%eax
+  8014af:	48 89 d3             	mov    %rdx,%rbx
+  8014b2:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_env_set_rt, 1, envid, period, budget, deadline, 0, 0);
+  8014b5:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8014b8:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8014bd:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014c0:	be 00 00 00 00       	mov    $0x0,%esi
+  8014c5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014cb:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8014cd:	48 85 c0             	test   %rax,%rax
+  8014d0:	7f 06                	jg     8014d8 <sys_env_set_rt+0x34>
+}
+  8014d2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014d6:	c9                   	leave
+  8014d7:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8014d8:	49 89 c0             	mov    %rax,%r8
+  8014db:	b9 11 00 00 00       	mov    $0x11,%ecx
+  8014e0:	48 ba b0 34 80 00 00 	movabs $0x8034b0,%rdx
+  8014e7:	00 00 00 
+  8014ea:	be 26 00 00 00       	mov    $0x26,%esi
+  8014ef:	48 bf cf 34 80 00 00 	movabs $0x8034cf,%rdi
+  8014f6:	00 00 00 
+  8014f9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014fe:	49 b9 12 02 80 00 00 	movabs $0x800212,%r9
+  801505:	00 00 00 
+  801508:	41 ff d1             	call   *%r9
+
+000000000080150b <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  80150b:	55                   	push   %rbp
+  80150c:	48 89 e5             	mov    %rsp,%rbp
+  80150f:	53                   	push   %rbx
+  801510:	48 83 ec 08          	sub    $0x8,%rsp
+  801514:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  801517:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80151a:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80151f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801524:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801529:	be 00 00 00 00       	mov    $0x0,%esi
+  80152e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801534:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801536:	48 85 c0             	test   %rax,%rax
+  801539:	7f 06                	jg     801541 <sys_env_set_trapframe+0x36>
+}
+  80153b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80153f:	c9                   	leave
+  801540:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801541:	49 89 c0             	mov    %rax,%r8
+  801544:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  801549:	48 ba b0 34 80 00 00 	movabs $0x8034b0,%rdx
+  801550:	00 00 00 
+  801553:	be 26 00 00 00       	mov    $0x26,%esi
+  801558:	48 bf cf 34 80 00 00 	movabs $0x8034cf,%rdi
+  80155f:	00 00 00 
+  801562:	b8 00 00 00 00       	mov    $0x0,%eax
+  801567:	49 b9 12 02 80 00 00 	movabs $0x800212,%r9
+  80156e:	00 00 00 
+  801571:	41 ff d1             	call   *%r9
+
+0000000000801574 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  801574:	55                   	push   %rbp
+  801575:	48 89 e5             	mov    %rsp,%rbp
+  801578:	53                   	push   %rbx
+  801579:	48 83 ec 08          	sub    $0x8,%rsp
+  80157d:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  801580:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801583:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801588:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80158d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801592:	be 00 00 00 00       	mov    $0x0,%esi
+  801597:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80159d:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80159f:	48 85 c0             	test   %rax,%rax
+  8015a2:	7f 06                	jg     8015aa <sys_env_set_pgfault_upcall+0x36>
+}
+  8015a4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015a8:	c9                   	leave
+  8015a9:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8015aa:	49 89 c0             	mov    %rax,%r8
+  8015ad:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  8015b2:	48 ba b0 34 80 00 00 	movabs $0x8034b0,%rdx
+  8015b9:	00 00 00 
+  8015bc:	be 26 00 00 00       	mov    $0x26,%esi
+  8015c1:	48 bf cf 34 80 00 00 	movabs $0x8034cf,%rdi
+  8015c8:	00 00 00 
+  8015cb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015d0:	49 b9 12 02 80 00 00 	movabs $0x800212,%r9
+  8015d7:	00 00 00 
+  8015da:	41 ff d1             	call   *%r9
+
+00000000008015dd <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  8015dd:	55                   	push   %rbp
+  8015de:	48 89 e5             	mov    %rsp,%rbp
+  8015e1:	53                   	push   %rbx
+  8015e2:	89 f8                	mov    %edi,%eax
+  8015e4:	49 89 f1             	mov    %rsi,%r9
+  8015e7:	48 89 d3             	mov    %rdx,%rbx
+  8015ea:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  8015ed:	49 63 f0             	movslq %r8d,%rsi
+  8015f0:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8015f3:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8015f8:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015fb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801601:	cd 30                	int    $0x30
+}
+  801603:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801607:	c9                   	leave
+  801608:	c3                   	ret
+
+0000000000801609 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  801609:	55                   	push   %rbp
+  80160a:	48 89 e5             	mov    %rsp,%rbp
+  80160d:	53                   	push   %rbx
+  80160e:	48 83 ec 08          	sub    $0x8,%rsp
+  801612:	48 89 fa             	mov    %rdi,%rdx
+  801615:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801618:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80161d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801622:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801627:	be 00 00 00 00       	mov    $0x0,%esi
+  80162c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801632:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801634:	48 85 c0             	test   %rax,%rax
+  801637:	7f 06                	jg     80163f <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801639:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80163d:	c9                   	leave
+  80163e:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80163f:	49 89 c0             	mov    %rax,%r8
+  801642:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  801647:	48 ba b0 34 80 00 00 	movabs $0x8034b0,%rdx
+  80164e:	00 00 00 
+  801651:	be 26 00 00 00       	mov    $0x26,%esi
+  801656:	48 bf cf 34 80 00 00 	movabs $0x8034cf,%rdi
+  80165d:	00 00 00 
+  801660:	b8 00 00 00 00       	mov    $0x0,%eax
+  801665:	49 b9 12 02 80 00 00 	movabs $0x800212,%r9
+  80166c:	00 00 00 
+  80166f:	41 ff d1             	call   *%r9
+
+0000000000801672 <fork>:
+ * Hint:
+ *   Use sys_map_region, it can perform address space copying in one call
+ *   Remember to fix "thisenv" in the child process.
+ */
+envid_t
+fork(void) {
+  801672:	55                   	push   %rbp
+  801673:	48 89 e5             	mov    %rsp,%rbp
+  801676:	41 55                	push   %r13
+  801678:	41 54                	push   %r12
+  80167a:	53                   	push   %rbx
+  80167b:	48 83 ec 08          	sub    $0x8,%rsp
+
+/* This must be inlined. Exercise for reader: why? */
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+    envid_t ret;
+    asm volatile("int %2"
+  80167f:	b8 08 00 00 00       	mov    $0x8,%eax
+  801684:	cd 30                	int    $0x30
+  801686:	41 89 c5             	mov    %eax,%r13d
+    // LAB 9: Your code here
+
+    envid_t child_id = sys_exofork();
+    if (child_id < 0) {
+  801689:	85 c0                	test   %eax,%eax
+  80168b:	0f 88 ae 00 00 00    	js     80173f <fork+0xcd>
+  801691:	89 c3                	mov    %eax,%ebx
+        return child_id;
+    }
+    if (child_id == 0) {
+  801693:	0f 84 b4 00 00 00    	je     80174d <fork+0xdb>
+        thisenv = &envs[ENVX(sys_getenvid())];
+        return 0;
+    }
+    int res = sys_map_region(0, NULL, child_id, NULL, MAX_USER_ADDRESS, PROT_ALL | PROT_LAZY | PROT_COMBINE);
+  801699:	41 b9 df 01 00 00    	mov    $0x1df,%r9d
+  80169f:	49 b8 00 00 00 00 80 	movabs $0x8000000000,%r8
+  8016a6:	00 00 00 
+  8016a9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8016ae:	89 c2                	mov    %eax,%edx
+  8016b0:	be 00 00 00 00       	mov    $0x0,%esi
+  8016b5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8016ba:	48 b8 9e 12 80 00 00 	movabs $0x80129e,%rax
+  8016c1:	00 00 00 
+  8016c4:	ff d0                	call   *%rax
+  8016c6:	41 89 c4             	mov    %eax,%r12d
+    if (res < 0) {
+  8016c9:	85 c0                	test   %eax,%eax
+  8016cb:	78 5d                	js     80172a <fork+0xb8>
+        goto error;
+    }
+    res = sys_env_set_pgfault_upcall(child_id, envs[ENVX(sys_getenvid())].env_pgfault_upcall);
+  8016cd:	48 b8 77 11 80 00 00 	movabs $0x801177,%rax
+  8016d4:	00 00 00 
+  8016d7:	ff d0                	call   *%rax
+  8016d9:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8016de:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+  8016e5:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8016ec:	00 00 00 
+  8016ef:	48 01 d0             	add    %rdx,%rax
+  8016f2:	48 8b b0 88 01 00 00 	mov    0x188(%rax),%rsi
+  8016f9:	44 89 ef             	mov    %r13d,%edi
+  8016fc:	48 b8 74 15 80 00 00 	movabs $0x801574,%rax
+  801703:	00 00 00 
+  801706:	ff d0                	call   *%rax
+  801708:	41 89 c4             	mov    %eax,%r12d
+    if (res < 0) {
+  80170b:	85 c0                	test   %eax,%eax
+  80170d:	78 1b                	js     80172a <fork+0xb8>
+        goto error;
+    }
+    res = sys_env_set_status(child_id, ENV_RUNNABLE);
+  80170f:	be 02 00 00 00       	mov    $0x2,%esi
+  801714:	44 89 ef             	mov    %r13d,%edi
+  801717:	48 b8 d3 13 80 00 00 	movabs $0x8013d3,%rax
+  80171e:	00 00 00 
+  801721:	ff d0                	call   *%rax
+  801723:	41 89 c4             	mov    %eax,%r12d
+    if (res < 0) {
+  801726:	85 c0                	test   %eax,%eax
+  801728:	79 15                	jns    80173f <fork+0xcd>
+        goto error;
+    }
+    return child_id;
+error:
+    ;
+    int res2 = sys_env_destroy(child_id);
+  80172a:	89 df                	mov    %ebx,%edi
+  80172c:	48 b8 0c 11 80 00 00 	movabs $0x80110c,%rax
+  801733:	00 00 00 
+  801736:	ff d0                	call   *%rax
+    if (res2 < 0) {
+  801738:	85 c0                	test   %eax,%eax
+  80173a:	78 42                	js     80177e <fork+0x10c>
+        panic("Fork double fault");
+    }
+    return res;
+  80173c:	45 89 e5             	mov    %r12d,%r13d
+}
+  80173f:	44 89 e8             	mov    %r13d,%eax
+  801742:	48 83 c4 08          	add    $0x8,%rsp
+  801746:	5b                   	pop    %rbx
+  801747:	41 5c                	pop    %r12
+  801749:	41 5d                	pop    %r13
+  80174b:	5d                   	pop    %rbp
+  80174c:	c3                   	ret
+        thisenv = &envs[ENVX(sys_getenvid())];
+  80174d:	48 b8 77 11 80 00 00 	movabs $0x801177,%rax
+  801754:	00 00 00 
+  801757:	ff d0                	call   *%rax
+  801759:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80175e:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+  801765:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  80176c:	00 00 00 
+  80176f:	48 01 d0             	add    %rdx,%rax
+  801772:	48 a3 08 50 80 00 00 	movabs %rax,0x805008
+  801779:	00 00 00 
+        return 0;
+  80177c:	eb c1                	jmp    80173f <fork+0xcd>
+        panic("Fork double fault");
+  80177e:	48 ba dd 34 80 00 00 	movabs $0x8034dd,%rdx
+  801785:	00 00 00 
+  801788:	be 2f 00 00 00       	mov    $0x2f,%esi
+  80178d:	48 bf ef 34 80 00 00 	movabs $0x8034ef,%rdi
+  801794:	00 00 00 
+  801797:	b8 00 00 00 00       	mov    $0x0,%eax
+  80179c:	48 b9 12 02 80 00 00 	movabs $0x800212,%rcx
+  8017a3:	00 00 00 
+  8017a6:	ff d1                	call   *%rcx
+
+00000000008017a8 <sfork>:
+
+envid_t
+sfork() {
+  8017a8:	55                   	push   %rbp
+  8017a9:	48 89 e5             	mov    %rsp,%rbp
+    panic("sfork() is not implemented");
+  8017ac:	48 ba fa 34 80 00 00 	movabs $0x8034fa,%rdx
+  8017b3:	00 00 00 
+  8017b6:	be 36 00 00 00       	mov    $0x36,%esi
+  8017bb:	48 bf ef 34 80 00 00 	movabs $0x8034ef,%rdi
+  8017c2:	00 00 00 
+  8017c5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017ca:	48 b9 12 02 80 00 00 	movabs $0x800212,%rcx
+  8017d1:	00 00 00 
+  8017d4:	ff d1                	call   *%rcx
+
+00000000008017d6 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8017d6:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8017dd:	ff ff ff 
+  8017e0:	48 01 f8             	add    %rdi,%rax
+  8017e3:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  8017e7:	c3                   	ret
+
+00000000008017e8 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8017e8:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8017ef:	ff ff ff 
+  8017f2:	48 01 f8             	add    %rdi,%rax
+  8017f5:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  8017f9:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  8017ff:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  801803:	c3                   	ret
+
+0000000000801804 <fd_alloc_from>:
+}
+
+/* Like fd_alloc(), but only considers fds starting from fdnum,
+ * so that several fds can be found before their pages are allocated */
+int
+fd_alloc_from(int fdnum, struct Fd **fd_store) {
+  801804:	55                   	push   %rbp
+  801805:	48 89 e5             	mov    %rsp,%rbp
+  801808:	41 57                	push   %r15
+  80180a:	41 56                	push   %r14
+  80180c:	41 55                	push   %r13
+  80180e:	41 54                	push   %r12
+  801810:	53                   	push   %rbx
+  801811:	48 83 ec 08          	sub    $0x8,%rsp
+  801815:	49 89 f7             	mov    %rsi,%r15
+    for (int i = MAX(fdnum, 0); i < MAXFD; i++) {
+  801818:	85 ff                	test   %edi,%edi
+  80181a:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  801820:	44 0f 49 e7          	cmovns %edi,%r12d
+  801824:	83 ff 1f             	cmp    $0x1f,%edi
+  801827:	7f 37                	jg     801860 <fd_alloc_from+0x5c>
+  801829:	49 63 dc             	movslq %r12d,%rbx
+  80182c:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  801833:	48 c1 e3 0c          	shl    $0xc,%rbx
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  801837:	49 be 0d 29 80 00 00 	movabs $0x80290d,%r14
+  80183e:	00 00 00 
+        struct Fd *fd = INDEX2FD(i);
+  801841:	49 89 dd             	mov    %rbx,%r13
+        if (!(get_prot(fd) & PROT_R)) {
+  801844:	48 89 df             	mov    %rbx,%rdi
+  801847:	41 ff d6             	call   *%r14
+  80184a:	83 e0 04             	and    $0x4,%eax
+  80184d:	74 1c                	je     80186b <fd_alloc_from+0x67>
+    for (int i = MAX(fdnum, 0); i < MAXFD; i++) {
+  80184f:	41 83 c4 01          	add    $0x1,%r12d
+  801853:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  80185a:	41 83 fc 1f          	cmp    $0x1f,%r12d
+  80185e:	7e e1                	jle    801841 <fd_alloc_from+0x3d>
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  801860:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801866:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  80186b:	4d 89 2f             	mov    %r13,(%r15)
+}
+  80186e:	48 83 c4 08          	add    $0x8,%rsp
+  801872:	5b                   	pop    %rbx
+  801873:	41 5c                	pop    %r12
+  801875:	41 5d                	pop    %r13
+  801877:	41 5e                	pop    %r14
+  801879:	41 5f                	pop    %r15
+  80187b:	5d                   	pop    %rbp
+  80187c:	c3                   	ret
+
+000000000080187d <fd_alloc>:
+fd_alloc(struct Fd **fd_store) {
+  80187d:	55                   	push   %rbp
+  80187e:	48 89 e5             	mov    %rsp,%rbp
+  801881:	48 89 fe             	mov    %rdi,%rsi
+    return fd_alloc_from(0, fd_store);
+  801884:	bf 00 00 00 00       	mov    $0x0,%edi
+  801889:	48 b8 04 18 80 00 00 	movabs $0x801804,%rax
+  801890:	00 00 00 
+  801893:	ff d0                	call   *%rax
+}
+  801895:	5d                   	pop    %rbp
+  801896:	c3                   	ret
+
+0000000000801897 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  801897:	83 ff 1f             	cmp    $0x1f,%edi
+  80189a:	77 39                	ja     8018d5 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  80189c:	55                   	push   %rbp
+  80189d:	48 89 e5             	mov    %rsp,%rbp
+  8018a0:	41 54                	push   %r12
+  8018a2:	53                   	push   %rbx
+  8018a3:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  8018a6:	48 63 df             	movslq %edi,%rbx
+  8018a9:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  8018b0:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  8018b4:	48 89 df             	mov    %rbx,%rdi
+  8018b7:	48 b8 0d 29 80 00 00 	movabs $0x80290d,%rax
+  8018be:	00 00 00 
+  8018c1:	ff d0                	call   *%rax
+  8018c3:	a8 04                	test   $0x4,%al
+  8018c5:	74 14                	je     8018db <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  8018c7:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  8018cb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8018d0:	5b                   	pop    %rbx
+  8018d1:	41 5c                	pop    %r12
+  8018d3:	5d                   	pop    %rbp
+  8018d4:	c3                   	ret
+        return -E_INVAL;
+  8018d5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8018da:	c3                   	ret
+        return -E_INVAL;
+  8018db:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8018e0:	eb ee                	jmp    8018d0 <fd_lookup+0x39>
+
+00000000008018e2 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  8018e2:	55                   	push   %rbp
+  8018e3:	48 89 e5             	mov    %rsp,%rbp
+  8018e6:	41 54                	push   %r12
+  8018e8:	53                   	push   %rbx
+  8018e9:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  8018ec:	48 b8 a0 35 80 00 00 	movabs $0x8035a0,%rax
+  8018f3:	00 00 00 
+  8018f6:	48 bb 20 40 80 00 00 	movabs $0x804020,%rbx
+  8018fd:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  801900:	39 3b                	cmp    %edi,(%rbx)
+  801902:	74 47                	je     80194b <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  801904:	48 83 c0 08          	add    $0x8,%rax
+  801908:	48 8b 18             	mov    (%rax),%rbx
+  80190b:	48 85 db             	test   %rbx,%rbx
+  80190e:	75 f0                	jne    801900 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801910:	48 a1 08 50 80 00 00 	movabs 0x805008,%rax
+  801917:	00 00 00 
+  80191a:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+  801920:	89 fa                	mov    %edi,%edx
+  801922:	48 bf 18 35 80 00 00 	movabs $0x803518,%rdi
+  801929:	00 00 00 
+  80192c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801931:	48 b9 62 03 80 00 00 	movabs $0x800362,%rcx
+  801938:	00 00 00 
+  80193b:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  80193d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  801942:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  801946:	5b                   	pop    %rbx
+  801947:	41 5c                	pop    %r12
+  801949:	5d                   	pop    %rbp
+  80194a:	c3                   	ret
+            return 0;
+  80194b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801950:	eb f0                	jmp    801942 <dev_lookup+0x60>
+
+0000000000801952 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  801952:	55                   	push   %rbp
+  801953:	48 89 e5             	mov    %rsp,%rbp
+  801956:	41 55                	push   %r13
+  801958:	41 54                	push   %r12
+  80195a:	53                   	push   %rbx
+  80195b:	48 83 ec 18          	sub    $0x18,%rsp
+  80195f:	48 89 fb             	mov    %rdi,%rbx
+  801962:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801965:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  80196c:	ff ff ff 
+  80196f:	48 01 df             	add    %rbx,%rdi
+  801972:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  801976:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80197a:	48 b8 97 18 80 00 00 	movabs $0x801897,%rax
+  801981:	00 00 00 
+  801984:	ff d0                	call   *%rax
+  801986:	41 89 c5             	mov    %eax,%r13d
+  801989:	85 c0                	test   %eax,%eax
+  80198b:	78 06                	js     801993 <fd_close+0x41>
+  80198d:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  801991:	74 1a                	je     8019ad <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  801993:	45 84 e4             	test   %r12b,%r12b
+  801996:	b8 00 00 00 00       	mov    $0x0,%eax
+  80199b:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  80199f:	44 89 e8             	mov    %r13d,%eax
+  8019a2:	48 83 c4 18          	add    $0x18,%rsp
+  8019a6:	5b                   	pop    %rbx
+  8019a7:	41 5c                	pop    %r12
+  8019a9:	41 5d                	pop    %r13
+  8019ab:	5d                   	pop    %rbp
+  8019ac:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8019ad:	8b 3b                	mov    (%rbx),%edi
+  8019af:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8019b3:	48 b8 e2 18 80 00 00 	movabs $0x8018e2,%rax
+  8019ba:	00 00 00 
+  8019bd:	ff d0                	call   *%rax
+  8019bf:	41 89 c5             	mov    %eax,%r13d
+  8019c2:	85 c0                	test   %eax,%eax
+  8019c4:	78 1b                	js     8019e1 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  8019c6:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8019ca:	48 8b 40 20          	mov    0x20(%rax),%rax
+  8019ce:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  8019d4:	48 85 c0             	test   %rax,%rax
+  8019d7:	74 08                	je     8019e1 <fd_close+0x8f>
+  8019d9:	48 89 df             	mov    %rbx,%rdi
+  8019dc:	ff d0                	call   *%rax
+  8019de:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8019e1:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8019e6:	48 89 de             	mov    %rbx,%rsi
+  8019e9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8019ee:	48 b8 03 13 80 00 00 	movabs $0x801303,%rax
+  8019f5:	00 00 00 
+  8019f8:	ff d0                	call   *%rax
+    return res;
+  8019fa:	eb a3                	jmp    80199f <fd_close+0x4d>
+
+00000000008019fc <close>:
+
+int
+close(int fdnum) {
+  8019fc:	55                   	push   %rbp
+  8019fd:	48 89 e5             	mov    %rsp,%rbp
+  801a00:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  801a04:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801a08:	48 b8 97 18 80 00 00 	movabs $0x801897,%rax
+  801a0f:	00 00 00 
+  801a12:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801a14:	85 c0                	test   %eax,%eax
+  801a16:	78 15                	js     801a2d <close+0x31>
+
+    return fd_close(fd, 1);
+  801a18:	be 01 00 00 00       	mov    $0x1,%esi
+  801a1d:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801a21:	48 b8 52 19 80 00 00 	movabs $0x801952,%rax
+  801a28:	00 00 00 
+  801a2b:	ff d0                	call   *%rax
+}
+  801a2d:	c9                   	leave
+  801a2e:	c3                   	ret
+
+0000000000801a2f <close_all>:
+
+void
+close_all(void) {
+  801a2f:	55                   	push   %rbp
+  801a30:	48 89 e5             	mov    %rsp,%rbp
+  801a33:	41 54                	push   %r12
+  801a35:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  801a36:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a3b:	49 bc fc 19 80 00 00 	movabs $0x8019fc,%r12
+  801a42:	00 00 00 
+  801a45:	89 df                	mov    %ebx,%edi
+  801a47:	41 ff d4             	call   *%r12
+  801a4a:	83 c3 01             	add    $0x1,%ebx
+  801a4d:	83 fb 20             	cmp    $0x20,%ebx
+  801a50:	75 f3                	jne    801a45 <close_all+0x16>
+}
+  801a52:	5b                   	pop    %rbx
+  801a53:	41 5c                	pop    %r12
+  801a55:	5d                   	pop    %rbp
+  801a56:	c3                   	ret
+
+0000000000801a57 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  801a57:	55                   	push   %rbp
+  801a58:	48 89 e5             	mov    %rsp,%rbp
+  801a5b:	41 57                	push   %r15
+  801a5d:	41 56                	push   %r14
+  801a5f:	41 55                	push   %r13
+  801a61:	41 54                	push   %r12
+  801a63:	53                   	push   %rbx
+  801a64:	48 83 ec 18          	sub    $0x18,%rsp
+  801a68:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  801a6b:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801a6f:	48 b8 97 18 80 00 00 	movabs $0x801897,%rax
+  801a76:	00 00 00 
+  801a79:	ff d0                	call   *%rax
+  801a7b:	89 c3                	mov    %eax,%ebx
+  801a7d:	85 c0                	test   %eax,%eax
+  801a7f:	0f 88 b8 00 00 00    	js     801b3d <dup+0xe6>
+    close(newfdnum);
+  801a85:	44 89 e7             	mov    %r12d,%edi
+  801a88:	48 b8 fc 19 80 00 00 	movabs $0x8019fc,%rax
+  801a8f:	00 00 00 
+  801a92:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  801a94:	4d 63 ec             	movslq %r12d,%r13
+  801a97:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  801a9e:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  801aa2:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  801aa6:	4c 89 ff             	mov    %r15,%rdi
+  801aa9:	49 be e8 17 80 00 00 	movabs $0x8017e8,%r14
+  801ab0:	00 00 00 
+  801ab3:	41 ff d6             	call   *%r14
+  801ab6:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  801ab9:	4c 89 ef             	mov    %r13,%rdi
+  801abc:	41 ff d6             	call   *%r14
+  801abf:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  801ac2:	48 89 df             	mov    %rbx,%rdi
+  801ac5:	48 b8 0d 29 80 00 00 	movabs $0x80290d,%rax
+  801acc:	00 00 00 
+  801acf:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  801ad1:	a8 04                	test   $0x4,%al
+  801ad3:	74 2b                	je     801b00 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  801ad5:	41 89 c1             	mov    %eax,%r9d
+  801ad8:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801ade:	4c 89 f1             	mov    %r14,%rcx
+  801ae1:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ae6:	48 89 de             	mov    %rbx,%rsi
+  801ae9:	bf 00 00 00 00       	mov    $0x0,%edi
+  801aee:	48 b8 9e 12 80 00 00 	movabs $0x80129e,%rax
+  801af5:	00 00 00 
+  801af8:	ff d0                	call   *%rax
+  801afa:	89 c3                	mov    %eax,%ebx
+  801afc:	85 c0                	test   %eax,%eax
+  801afe:	78 4e                	js     801b4e <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  801b00:	4c 89 ff             	mov    %r15,%rdi
+  801b03:	48 b8 0d 29 80 00 00 	movabs $0x80290d,%rax
+  801b0a:	00 00 00 
+  801b0d:	ff d0                	call   *%rax
+  801b0f:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801b12:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801b18:	4c 89 e9             	mov    %r13,%rcx
+  801b1b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b20:	4c 89 fe             	mov    %r15,%rsi
+  801b23:	bf 00 00 00 00       	mov    $0x0,%edi
+  801b28:	48 b8 9e 12 80 00 00 	movabs $0x80129e,%rax
+  801b2f:	00 00 00 
+  801b32:	ff d0                	call   *%rax
+  801b34:	89 c3                	mov    %eax,%ebx
+  801b36:	85 c0                	test   %eax,%eax
+  801b38:	78 14                	js     801b4e <dup+0xf7>
+
+    return newfdnum;
+  801b3a:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  801b3d:	89 d8                	mov    %ebx,%eax
+  801b3f:	48 83 c4 18          	add    $0x18,%rsp
+  801b43:	5b                   	pop    %rbx
+  801b44:	41 5c                	pop    %r12
+  801b46:	41 5d                	pop    %r13
+  801b48:	41 5e                	pop    %r14
+  801b4a:	41 5f                	pop    %r15
+  801b4c:	5d                   	pop    %rbp
+  801b4d:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  801b4e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801b53:	4c 89 ee             	mov    %r13,%rsi
+  801b56:	bf 00 00 00 00       	mov    $0x0,%edi
+  801b5b:	49 bc 03 13 80 00 00 	movabs $0x801303,%r12
+  801b62:	00 00 00 
+  801b65:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  801b68:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801b6d:	4c 89 f6             	mov    %r14,%rsi
+  801b70:	bf 00 00 00 00       	mov    $0x0,%edi
+  801b75:	41 ff d4             	call   *%r12
+    return res;
+  801b78:	eb c3                	jmp    801b3d <dup+0xe6>
+
+0000000000801b7a <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  801b7a:	55                   	push   %rbp
+  801b7b:	48 89 e5             	mov    %rsp,%rbp
+  801b7e:	41 56                	push   %r14
+  801b80:	41 55                	push   %r13
+  801b82:	41 54                	push   %r12
+  801b84:	53                   	push   %rbx
+  801b85:	48 83 ec 10          	sub    $0x10,%rsp
+  801b89:	89 fb                	mov    %edi,%ebx
+  801b8b:	49 89 f4             	mov    %rsi,%r12
+  801b8e:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801b91:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801b95:	48 b8 97 18 80 00 00 	movabs $0x801897,%rax
+  801b9c:	00 00 00 
+  801b9f:	ff d0                	call   *%rax
+  801ba1:	85 c0                	test   %eax,%eax
+  801ba3:	78 4c                	js     801bf1 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801ba5:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801ba9:	41 8b 3e             	mov    (%r14),%edi
+  801bac:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801bb0:	48 b8 e2 18 80 00 00 	movabs $0x8018e2,%rax
+  801bb7:	00 00 00 
+  801bba:	ff d0                	call   *%rax
+  801bbc:	85 c0                	test   %eax,%eax
+  801bbe:	78 35                	js     801bf5 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801bc0:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801bc4:	83 e0 03             	and    $0x3,%eax
+  801bc7:	83 f8 01             	cmp    $0x1,%eax
+  801bca:	74 2d                	je     801bf9 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801bcc:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801bd0:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801bd4:	48 85 c0             	test   %rax,%rax
+  801bd7:	74 56                	je     801c2f <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  801bd9:	4c 89 ea             	mov    %r13,%rdx
+  801bdc:	4c 89 e6             	mov    %r12,%rsi
+  801bdf:	4c 89 f7             	mov    %r14,%rdi
+  801be2:	ff d0                	call   *%rax
+}
+  801be4:	48 83 c4 10          	add    $0x10,%rsp
+  801be8:	5b                   	pop    %rbx
+  801be9:	41 5c                	pop    %r12
+  801beb:	41 5d                	pop    %r13
+  801bed:	41 5e                	pop    %r14
+  801bef:	5d                   	pop    %rbp
+  801bf0:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801bf1:	48 98                	cltq
+  801bf3:	eb ef                	jmp    801be4 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801bf5:	48 98                	cltq
+  801bf7:	eb eb                	jmp    801be4 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801bf9:	48 a1 08 50 80 00 00 	movabs 0x805008,%rax
+  801c00:	00 00 00 
+  801c03:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+  801c09:	89 da                	mov    %ebx,%edx
+  801c0b:	48 bf 59 35 80 00 00 	movabs $0x803559,%rdi
+  801c12:	00 00 00 
+  801c15:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c1a:	48 b9 62 03 80 00 00 	movabs $0x800362,%rcx
+  801c21:	00 00 00 
+  801c24:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801c26:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801c2d:	eb b5                	jmp    801be4 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801c2f:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801c36:	eb ac                	jmp    801be4 <read+0x6a>
+
+0000000000801c38 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801c38:	55                   	push   %rbp
+  801c39:	48 89 e5             	mov    %rsp,%rbp
+  801c3c:	41 57                	push   %r15
+  801c3e:	41 56                	push   %r14
+  801c40:	41 55                	push   %r13
+  801c42:	41 54                	push   %r12
+  801c44:	53                   	push   %rbx
+  801c45:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  801c49:	48 85 d2             	test   %rdx,%rdx
+  801c4c:	74 54                	je     801ca2 <readn+0x6a>
+  801c4e:	41 89 fd             	mov    %edi,%r13d
+  801c51:	49 89 f6             	mov    %rsi,%r14
+  801c54:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  801c57:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  801c5c:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  801c61:	49 bf 7a 1b 80 00 00 	movabs $0x801b7a,%r15
+  801c68:	00 00 00 
+  801c6b:	4c 89 e2             	mov    %r12,%rdx
+  801c6e:	48 29 f2             	sub    %rsi,%rdx
+  801c71:	4c 01 f6             	add    %r14,%rsi
+  801c74:	44 89 ef             	mov    %r13d,%edi
+  801c77:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  801c7a:	85 c0                	test   %eax,%eax
+  801c7c:	78 20                	js     801c9e <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  801c7e:	01 c3                	add    %eax,%ebx
+  801c80:	85 c0                	test   %eax,%eax
+  801c82:	74 08                	je     801c8c <readn+0x54>
+  801c84:	48 63 f3             	movslq %ebx,%rsi
+  801c87:	4c 39 e6             	cmp    %r12,%rsi
+  801c8a:	72 df                	jb     801c6b <readn+0x33>
+    }
+    return res;
+  801c8c:	48 63 c3             	movslq %ebx,%rax
+}
+  801c8f:	48 83 c4 08          	add    $0x8,%rsp
+  801c93:	5b                   	pop    %rbx
+  801c94:	41 5c                	pop    %r12
+  801c96:	41 5d                	pop    %r13
+  801c98:	41 5e                	pop    %r14
+  801c9a:	41 5f                	pop    %r15
+  801c9c:	5d                   	pop    %rbp
+  801c9d:	c3                   	ret
+        if (inc < 0) return inc;
+  801c9e:	48 98                	cltq
+  801ca0:	eb ed                	jmp    801c8f <readn+0x57>
+    int inc = 1, res = 0;
+  801ca2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801ca7:	eb e3                	jmp    801c8c <readn+0x54>
+
+0000000000801ca9 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  801ca9:	55                   	push   %rbp
+  801caa:	48 89 e5             	mov    %rsp,%rbp
+  801cad:	41 56                	push   %r14
+  801caf:	41 55                	push   %r13
+  801cb1:	41 54                	push   %r12
+  801cb3:	53                   	push   %rbx
+  801cb4:	48 83 ec 10          	sub    $0x10,%rsp
+  801cb8:	89 fb                	mov    %edi,%ebx
+  801cba:	49 89 f4             	mov    %rsi,%r12
+  801cbd:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801cc0:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801cc4:	48 b8 97 18 80 00 00 	movabs $0x801897,%rax
+  801ccb:	00 00 00 
+  801cce:	ff d0                	call   *%rax
+  801cd0:	85 c0                	test   %eax,%eax
+  801cd2:	78 47                	js     801d1b <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801cd4:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801cd8:	41 8b 3e             	mov    (%r14),%edi
+  801cdb:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801cdf:	48 b8 e2 18 80 00 00 	movabs $0x8018e2,%rax
+  801ce6:	00 00 00 
+  801ce9:	ff d0                	call   *%rax
+  801ceb:	85 c0                	test   %eax,%eax
+  801ced:	78 30                	js     801d1f <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801cef:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  801cf4:	74 2d                	je     801d23 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801cf6:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801cfa:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801cfe:	48 85 c0             	test   %rax,%rax
+  801d01:	74 56                	je     801d59 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  801d03:	4c 89 ea             	mov    %r13,%rdx
+  801d06:	4c 89 e6             	mov    %r12,%rsi
+  801d09:	4c 89 f7             	mov    %r14,%rdi
+  801d0c:	ff d0                	call   *%rax
+}
+  801d0e:	48 83 c4 10          	add    $0x10,%rsp
+  801d12:	5b                   	pop    %rbx
+  801d13:	41 5c                	pop    %r12
+  801d15:	41 5d                	pop    %r13
+  801d17:	41 5e                	pop    %r14
+  801d19:	5d                   	pop    %rbp
+  801d1a:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801d1b:	48 98                	cltq
+  801d1d:	eb ef                	jmp    801d0e <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801d1f:	48 98                	cltq
+  801d21:	eb eb                	jmp    801d0e <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801d23:	48 a1 08 50 80 00 00 	movabs 0x805008,%rax
+  801d2a:	00 00 00 
+  801d2d:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+  801d33:	89 da                	mov    %ebx,%edx
+  801d35:	48 bf 75 35 80 00 00 	movabs $0x803575,%rdi
+  801d3c:	00 00 00 
+  801d3f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d44:	48 b9 62 03 80 00 00 	movabs $0x800362,%rcx
+  801d4b:	00 00 00 
+  801d4e:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801d50:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801d57:	eb b5                	jmp    801d0e <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801d59:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801d60:	eb ac                	jmp    801d0e <write+0x65>
+
+0000000000801d62 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  801d62:	55                   	push   %rbp
+  801d63:	48 89 e5             	mov    %rsp,%rbp
+  801d66:	53                   	push   %rbx
+  801d67:	48 83 ec 18          	sub    $0x18,%rsp
+  801d6b:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801d6d:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801d71:	48 b8 97 18 80 00 00 	movabs $0x801897,%rax
+  801d78:	00 00 00 
+  801d7b:	ff d0                	call   *%rax
+  801d7d:	85 c0                	test   %eax,%eax
+  801d7f:	78 0c                	js     801d8d <seek+0x2b>
+
+    fd->fd_offset = offset;
+  801d81:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801d85:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  801d88:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801d8d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801d91:	c9                   	leave
+  801d92:	c3                   	ret
+
+0000000000801d93 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  801d93:	55                   	push   %rbp
+  801d94:	48 89 e5             	mov    %rsp,%rbp
+  801d97:	41 55                	push   %r13
+  801d99:	41 54                	push   %r12
+  801d9b:	53                   	push   %rbx
+  801d9c:	48 83 ec 18          	sub    $0x18,%rsp
+  801da0:	89 fb                	mov    %edi,%ebx
+  801da2:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801da5:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801da9:	48 b8 97 18 80 00 00 	movabs $0x801897,%rax
+  801db0:	00 00 00 
+  801db3:	ff d0                	call   *%rax
+  801db5:	85 c0                	test   %eax,%eax
+  801db7:	78 38                	js     801df1 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801db9:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  801dbd:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  801dc1:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801dc5:	48 b8 e2 18 80 00 00 	movabs $0x8018e2,%rax
+  801dcc:	00 00 00 
+  801dcf:	ff d0                	call   *%rax
+  801dd1:	85 c0                	test   %eax,%eax
+  801dd3:	78 1c                	js     801df1 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801dd5:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  801dda:	74 20                	je     801dfc <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801ddc:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801de0:	48 8b 40 30          	mov    0x30(%rax),%rax
+  801de4:	48 85 c0             	test   %rax,%rax
+  801de7:	74 47                	je     801e30 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  801de9:	44 89 e6             	mov    %r12d,%esi
+  801dec:	4c 89 ef             	mov    %r13,%rdi
+  801def:	ff d0                	call   *%rax
+}
+  801df1:	48 83 c4 18          	add    $0x18,%rsp
+  801df5:	5b                   	pop    %rbx
+  801df6:	41 5c                	pop    %r12
+  801df8:	41 5d                	pop    %r13
+  801dfa:	5d                   	pop    %rbp
+  801dfb:	c3                   	ret
+                thisenv->env_id, fdnum);
+  801dfc:	48 a1 08 50 80 00 00 	movabs 0x805008,%rax
+  801e03:	00 00 00 
+  801e06:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801e0c:	89 da                	mov    %ebx,%edx
+  801e0e:	48 bf 38 35 80 00 00 	movabs $0x803538,%rdi
+  801e15:	00 00 00 
+  801e18:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e1d:	48 b9 62 03 80 00 00 	movabs $0x800362,%rcx
+  801e24:	00 00 00 
+  801e27:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801e29:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801e2e:	eb c1                	jmp    801df1 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801e30:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801e35:	eb ba                	jmp    801df1 <ftruncate+0x5e>
+
+0000000000801e37 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  801e37:	55                   	push   %rbp
+  801e38:	48 89 e5             	mov    %rsp,%rbp
+  801e3b:	41 54                	push   %r12
+  801e3d:	53                   	push   %rbx
+  801e3e:	48 83 ec 10          	sub    $0x10,%rsp
+  801e42:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801e45:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801e49:	48 b8 97 18 80 00 00 	movabs $0x801897,%rax
+  801e50:	00 00 00 
+  801e53:	ff d0                	call   *%rax
+  801e55:	85 c0                	test   %eax,%eax
+  801e57:	78 4e                	js     801ea7 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801e59:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801e5d:	41 8b 3c 24          	mov    (%r12),%edi
+  801e61:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801e65:	48 b8 e2 18 80 00 00 	movabs $0x8018e2,%rax
+  801e6c:	00 00 00 
+  801e6f:	ff d0                	call   *%rax
+  801e71:	85 c0                	test   %eax,%eax
+  801e73:	78 32                	js     801ea7 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801e75:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801e79:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  801e7e:	74 30                	je     801eb0 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  801e80:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  801e83:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  801e8a:	00 00 00 
+    stat->st_isdir = 0;
+  801e8d:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  801e94:	00 00 00 
+    stat->st_dev = dev;
+  801e97:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  801e9e:	48 89 de             	mov    %rbx,%rsi
+  801ea1:	4c 89 e7             	mov    %r12,%rdi
+  801ea4:	ff 50 28             	call   *0x28(%rax)
+}
+  801ea7:	48 83 c4 10          	add    $0x10,%rsp
+  801eab:	5b                   	pop    %rbx
+  801eac:	41 5c                	pop    %r12
+  801eae:	5d                   	pop    %rbp
+  801eaf:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801eb0:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801eb5:	eb f0                	jmp    801ea7 <fstat+0x70>
+
+0000000000801eb7 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  801eb7:	55                   	push   %rbp
+  801eb8:	48 89 e5             	mov    %rsp,%rbp
+  801ebb:	41 54                	push   %r12
+  801ebd:	53                   	push   %rbx
+  801ebe:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  801ec1:	be 00 00 00 00       	mov    $0x0,%esi
+  801ec6:	48 b8 9a 22 80 00 00 	movabs $0x80229a,%rax
+  801ecd:	00 00 00 
+  801ed0:	ff d0                	call   *%rax
+  801ed2:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  801ed4:	85 c0                	test   %eax,%eax
+  801ed6:	78 25                	js     801efd <stat+0x46>
+
+    int res = fstat(fd, stat);
+  801ed8:	4c 89 e6             	mov    %r12,%rsi
+  801edb:	89 c7                	mov    %eax,%edi
+  801edd:	48 b8 37 1e 80 00 00 	movabs $0x801e37,%rax
+  801ee4:	00 00 00 
+  801ee7:	ff d0                	call   *%rax
+  801ee9:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  801eec:	89 df                	mov    %ebx,%edi
+  801eee:	48 b8 fc 19 80 00 00 	movabs $0x8019fc,%rax
+  801ef5:	00 00 00 
+  801ef8:	ff d0                	call   *%rax
+
+    return res;
+  801efa:	44 89 e3             	mov    %r12d,%ebx
+}
+  801efd:	89 d8                	mov    %ebx,%eax
+  801eff:	5b                   	pop    %rbx
+  801f00:	41 5c                	pop    %r12
+  801f02:	5d                   	pop    %rbp
+  801f03:	c3                   	ret
+
+0000000000801f04 <fsipc>:
+ * response may be written back to fsipcbuf.
+ * type: request code, passed as the simple integer IPC value.
+ * dstva: virtual address at which to receive reply page, 0 if none.
+ * Returns result from the file server. */
+static int
+fsipc(unsigned type, void *dstva) {
+  801f04:	55                   	push   %rbp
+  801f05:	48 89 e5             	mov    %rsp,%rbp
+  801f08:	41 54                	push   %r12
+  801f0a:	53                   	push   %rbx
+  801f0b:	48 83 ec 10          	sub    $0x10,%rsp
+  801f0f:	41 89 fc             	mov    %edi,%r12d
+  801f12:	48 89 f3             	mov    %rsi,%rbx
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  801f15:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  801f1c:	00 00 00 
+  801f1f:	83 38 00             	cmpl   $0x0,(%rax)
+  801f22:	74 5e                	je     801f82 <fsipc+0x7e>
+    if (debug) {
+        cprintf("[%08x] fsipc %d %08x\n",
+                thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+    }
+
+    ipc_send(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW);
+  801f24:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  801f2a:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  801f2f:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  801f36:	00 00 00 
+  801f39:	44 89 e6             	mov    %r12d,%esi
+  801f3c:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  801f43:	00 00 00 
+  801f46:	8b 38                	mov    (%rax),%edi
+  801f48:	48 b8 01 2e 80 00 00 	movabs $0x802e01,%rax
+  801f4f:	00 00 00 
+  801f52:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  801f54:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  801f5b:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  801f5c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801f61:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  801f65:	48 89 de             	mov    %rbx,%rsi
+  801f68:	bf 00 00 00 00       	mov    $0x0,%edi
+  801f6d:	48 b8 2c 2d 80 00 00 	movabs $0x802d2c,%rax
+  801f74:	00 00 00 
+  801f77:	ff d0                	call   *%rax
+}
+  801f79:	48 83 c4 10          	add    $0x10,%rsp
+  801f7d:	5b                   	pop    %rbx
+  801f7e:	41 5c                	pop    %r12
+  801f80:	5d                   	pop    %rbp
+  801f81:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  801f82:	bf 03 00 00 00       	mov    $0x3,%edi
+  801f87:	48 b8 a4 2e 80 00 00 	movabs $0x802ea4,%rax
+  801f8e:	00 00 00 
+  801f91:	ff d0                	call   *%rax
+  801f93:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  801f9a:	00 00 
+  801f9c:	eb 86                	jmp    801f24 <fsipc+0x20>
+
+0000000000801f9e <devfile_trunc>:
+    return 0;
+}
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  801f9e:	55                   	push   %rbp
+  801f9f:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801fa2:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  801fa9:	00 00 00 
+  801fac:	8b 57 0c             	mov    0xc(%rdi),%edx
+  801faf:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  801fb1:	89 70 04             	mov    %esi,0x4(%rax)
+
+    return fsipc(FSREQ_SET_SIZE, NULL);
+  801fb4:	be 00 00 00 00       	mov    $0x0,%esi
+  801fb9:	bf 02 00 00 00       	mov    $0x2,%edi
+  801fbe:	48 b8 04 1f 80 00 00 	movabs $0x801f04,%rax
+  801fc5:	00 00 00 
+  801fc8:	ff d0                	call   *%rax
+}
+  801fca:	5d                   	pop    %rbp
+  801fcb:	c3                   	ret
+
+0000000000801fcc <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  801fcc:	55                   	push   %rbp
+  801fcd:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801fd0:	8b 47 0c             	mov    0xc(%rdi),%eax
+  801fd3:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  801fda:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  801fdc:	be 00 00 00 00       	mov    $0x0,%esi
+  801fe1:	bf 06 00 00 00       	mov    $0x6,%edi
+  801fe6:	48 b8 04 1f 80 00 00 	movabs $0x801f04,%rax
+  801fed:	00 00 00 
+  801ff0:	ff d0                	call   *%rax
+}
+  801ff2:	5d                   	pop    %rbp
+  801ff3:	c3                   	ret
+
+0000000000801ff4 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  801ff4:	55                   	push   %rbp
+  801ff5:	48 89 e5             	mov    %rsp,%rbp
+  801ff8:	41 54                	push   %r12
+  801ffa:	53                   	push   %rbx
+  801ffb:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801ffe:	8b 47 0c             	mov    0xc(%rdi),%eax
+  802001:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  802008:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  80200a:	be 00 00 00 00       	mov    $0x0,%esi
+  80200f:	bf 05 00 00 00       	mov    $0x5,%edi
+  802014:	48 b8 04 1f 80 00 00 	movabs $0x801f04,%rax
+  80201b:	00 00 00 
+  80201e:	ff d0                	call   *%rax
+    if (res < 0) {
+  802020:	85 c0                	test   %eax,%eax
+  802022:	78 3d                	js     802061 <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802024:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  80202b:	00 00 00 
+  80202e:	4c 89 e6             	mov    %r12,%rsi
+  802031:	48 89 df             	mov    %rbx,%rdi
+  802034:	48 b8 87 0c 80 00 00 	movabs $0x800c87,%rax
+  80203b:	00 00 00 
+  80203e:	ff d0                	call   *%rax
+    st->st_size  = fsipcbuf.statRet.ret_size;
+  802040:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  802047:	00 
+  802048:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  80204e:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  802055:	00 
+  802056:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  80205c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802061:	5b                   	pop    %rbx
+  802062:	41 5c                	pop    %r12
+  802064:	5d                   	pop    %rbp
+  802065:	c3                   	ret
+
+0000000000802066 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  802066:	55                   	push   %rbp
+  802067:	48 89 e5             	mov    %rsp,%rbp
+  80206a:	41 57                	push   %r15
+  80206c:	41 56                	push   %r14
+  80206e:	41 55                	push   %r13
+  802070:	41 54                	push   %r12
+  802072:	53                   	push   %rbx
+  802073:	48 83 ec 18          	sub    $0x18,%rsp
+  802077:	49 89 fe             	mov    %rdi,%r14
+  80207a:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+  80207e:	48 89 d3             	mov    %rdx,%rbx
+    while (n > sizeof(fsipcbuf.write.req_buf))
+  802081:	48 81 fa f0 0f 00 00 	cmp    $0xff0,%rdx
+  802088:	0f 86 e4 00 00 00    	jbe    802172 <devfile_write+0x10c>
+  80208e:	49 89 f4             	mov    %rsi,%r12
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802091:	49 bd 00 60 80 00 00 	movabs $0x806000,%r13
+  802098:	00 00 00 
+        memcpy(fsipcbuf.write.req_buf, buf, sizeof(fsipcbuf.write.req_buf));
+  80209b:	49 bf e8 0e 80 00 00 	movabs $0x800ee8,%r15
+  8020a2:	00 00 00 
+  8020a5:	eb 03                	jmp    8020aa <devfile_write+0x44>
+        buf += sizeof(fsipcbuf.write.req_buf);
+  8020a7:	49 89 f4             	mov    %rsi,%r12
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8020aa:	41 8b 46 0c          	mov    0xc(%r14),%eax
+  8020ae:	41 89 45 00          	mov    %eax,0x0(%r13)
+        fsipcbuf.write.req_n      = sizeof(fsipcbuf.write.req_buf);
+  8020b2:	49 c7 45 08 f0 0f 00 	movq   $0xff0,0x8(%r13)
+  8020b9:	00 
+        memcpy(fsipcbuf.write.req_buf, buf, sizeof(fsipcbuf.write.req_buf));
+  8020ba:	ba f0 0f 00 00       	mov    $0xff0,%edx
+  8020bf:	4c 89 e6             	mov    %r12,%rsi
+  8020c2:	48 bf 10 60 80 00 00 	movabs $0x806010,%rdi
+  8020c9:	00 00 00 
+  8020cc:	41 ff d7             	call   *%r15
+        ssize_t res = fsipc(FSREQ_WRITE, NULL);
+  8020cf:	be 00 00 00 00       	mov    $0x0,%esi
+  8020d4:	bf 04 00 00 00       	mov    $0x4,%edi
+  8020d9:	48 b8 04 1f 80 00 00 	movabs $0x801f04,%rax
+  8020e0:	00 00 00 
+  8020e3:	ff d0                	call   *%rax
+  8020e5:	48 63 d0             	movslq %eax,%rdx
+        if (res < 0 || res < sizeof(fsipcbuf.write.req_buf))
+  8020e8:	3d ef 0f 00 00       	cmp    $0xfef,%eax
+  8020ed:	7e 71                	jle    802160 <devfile_write+0xfa>
+        buf += sizeof(fsipcbuf.write.req_buf);
+  8020ef:	49 8d b4 24 f0 0f 00 	lea    0xff0(%r12),%rsi
+  8020f6:	00 
+        n -= sizeof(fsipcbuf.write.req_buf);
+  8020f7:	48 81 eb f0 0f 00 00 	sub    $0xff0,%rbx
+    while (n > sizeof(fsipcbuf.write.req_buf))
+  8020fe:	48 81 fb f0 0f 00 00 	cmp    $0xff0,%rbx
+  802105:	77 a0                	ja     8020a7 <devfile_write+0x41>
+        written += sizeof(fsipcbuf.write.req_buf);
+  802107:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80210b:	49 29 c4             	sub    %rax,%r12
+  80210e:	4d 8d a4 24 f0 0f 00 	lea    0xff0(%r12),%r12
+  802115:	00 
+    fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802116:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  80211d:	00 00 00 
+  802120:	41 8b 56 0c          	mov    0xc(%r14),%edx
+  802124:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.write.req_n      = n;
+  802126:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    memcpy(fsipcbuf.write.req_buf, buf, n);
+  80212a:	48 89 da             	mov    %rbx,%rdx
+  80212d:	48 8d 78 10          	lea    0x10(%rax),%rdi
+  802131:	48 b8 e8 0e 80 00 00 	movabs $0x800ee8,%rax
+  802138:	00 00 00 
+  80213b:	ff d0                	call   *%rax
+    ssize_t res = fsipc(FSREQ_WRITE, NULL);
+  80213d:	be 00 00 00 00       	mov    $0x0,%esi
+  802142:	bf 04 00 00 00       	mov    $0x4,%edi
+  802147:	48 b8 04 1f 80 00 00 	movabs $0x801f04,%rax
+  80214e:	00 00 00 
+  802151:	ff d0                	call   *%rax
+  802153:	48 63 d0             	movslq %eax,%rdx
+    written += res;
+  802156:	49 01 d4             	add    %rdx,%r12
+  802159:	48 85 d2             	test   %rdx,%rdx
+  80215c:	49 0f 49 d4          	cmovns %r12,%rdx
+}
+  802160:	48 89 d0             	mov    %rdx,%rax
+  802163:	48 83 c4 18          	add    $0x18,%rsp
+  802167:	5b                   	pop    %rbx
+  802168:	41 5c                	pop    %r12
+  80216a:	41 5d                	pop    %r13
+  80216c:	41 5e                	pop    %r14
+  80216e:	41 5f                	pop    %r15
+  802170:	5d                   	pop    %rbp
+  802171:	c3                   	ret
+    while (n > sizeof(fsipcbuf.write.req_buf))
+  802172:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+    ssize_t written = 0;
+  802176:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80217c:	eb 98                	jmp    802116 <devfile_write+0xb0>
+
+000000000080217e <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  80217e:	55                   	push   %rbp
+  80217f:	48 89 e5             	mov    %rsp,%rbp
+  802182:	41 57                	push   %r15
+  802184:	41 56                	push   %r14
+  802186:	41 55                	push   %r13
+  802188:	41 54                	push   %r12
+  80218a:	53                   	push   %rbx
+  80218b:	48 83 ec 18          	sub    $0x18,%rsp
+  80218f:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  802193:	49 89 f6             	mov    %rsi,%r14
+  802196:	49 89 d4             	mov    %rdx,%r12
+    while (n > sizeof(fsipcbuf.readRet.ret_buf))
+  802199:	48 81 fa 00 10 00 00 	cmp    $0x1000,%rdx
+  8021a0:	0f 86 ea 00 00 00    	jbe    802290 <devfile_read+0x112>
+    ssize_t readsz = 0;
+  8021a6:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  8021ad:	00 
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8021ae:	49 bf 00 60 80 00 00 	movabs $0x806000,%r15
+  8021b5:	00 00 00 
+  8021b8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8021bc:	8b 40 0c             	mov    0xc(%rax),%eax
+  8021bf:	41 89 07             	mov    %eax,(%r15)
+        fsipcbuf.read.req_n = sizeof(fsipcbuf.readRet.ret_buf);
+  8021c2:	49 c7 47 08 00 10 00 	movq   $0x1000,0x8(%r15)
+  8021c9:	00 
+        ssize_t res = fsipc(FSREQ_READ, NULL);
+  8021ca:	be 00 00 00 00       	mov    $0x0,%esi
+  8021cf:	bf 03 00 00 00       	mov    $0x3,%edi
+  8021d4:	48 b8 04 1f 80 00 00 	movabs $0x801f04,%rax
+  8021db:	00 00 00 
+  8021de:	ff d0                	call   *%rax
+  8021e0:	4c 63 e8             	movslq %eax,%r13
+        if (res < 0)
+  8021e3:	4d 85 ed             	test   %r13,%r13
+  8021e6:	0f 88 92 00 00 00    	js     80227e <devfile_read+0x100>
+        memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  8021ec:	4c 89 ea             	mov    %r13,%rdx
+  8021ef:	4c 89 fe             	mov    %r15,%rsi
+  8021f2:	4c 89 f7             	mov    %r14,%rdi
+  8021f5:	48 b8 e8 0e 80 00 00 	movabs $0x800ee8,%rax
+  8021fc:	00 00 00 
+  8021ff:	ff d0                	call   *%rax
+        if (res < sizeof(fsipcbuf.readRet.ret_buf))
+  802201:	49 81 fd ff 0f 00 00 	cmp    $0xfff,%r13
+  802208:	76 6d                	jbe    802277 <devfile_read+0xf9>
+        readsz += res;
+  80220a:	4c 01 6d c0          	add    %r13,-0x40(%rbp)
+        buf += res;
+  80220e:	4d 01 ee             	add    %r13,%r14
+        n -= res;
+  802211:	4d 29 ec             	sub    %r13,%r12
+    while (n > sizeof(fsipcbuf.readRet.ret_buf))
+  802214:	49 81 fc 00 10 00 00 	cmp    $0x1000,%r12
+  80221b:	77 9b                	ja     8021b8 <devfile_read+0x3a>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  80221d:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  802224:	00 00 00 
+  802227:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  80222b:	8b 51 0c             	mov    0xc(%rcx),%edx
+  80222e:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.read.req_n = n;
+  802230:	4c 89 60 08          	mov    %r12,0x8(%rax)
+    ssize_t res = fsipc(FSREQ_READ, NULL);
+  802234:	be 00 00 00 00       	mov    $0x0,%esi
+  802239:	bf 03 00 00 00       	mov    $0x3,%edi
+  80223e:	48 b8 04 1f 80 00 00 	movabs $0x801f04,%rax
+  802245:	00 00 00 
+  802248:	ff d0                	call   *%rax
+  80224a:	4c 63 e8             	movslq %eax,%r13
+    if (res < 0)
+  80224d:	4d 85 ed             	test   %r13,%r13
+  802250:	78 2c                	js     80227e <devfile_read+0x100>
+    memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  802252:	4c 89 ea             	mov    %r13,%rdx
+  802255:	48 be 00 60 80 00 00 	movabs $0x806000,%rsi
+  80225c:	00 00 00 
+  80225f:	4c 89 f7             	mov    %r14,%rdi
+  802262:	48 b8 e8 0e 80 00 00 	movabs $0x800ee8,%rax
+  802269:	00 00 00 
+  80226c:	ff d0                	call   *%rax
+    readsz += res;
+  80226e:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802272:	49 01 c5             	add    %rax,%r13
+    return readsz;
+  802275:	eb 07                	jmp    80227e <devfile_read+0x100>
+            return readsz + res;
+  802277:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80227b:	49 01 c5             	add    %rax,%r13
+}
+  80227e:	4c 89 e8             	mov    %r13,%rax
+  802281:	48 83 c4 18          	add    $0x18,%rsp
+  802285:	5b                   	pop    %rbx
+  802286:	41 5c                	pop    %r12
+  802288:	41 5d                	pop    %r13
+  80228a:	41 5e                	pop    %r14
+  80228c:	41 5f                	pop    %r15
+  80228e:	5d                   	pop    %rbp
+  80228f:	c3                   	ret
+    ssize_t readsz = 0;
+  802290:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  802297:	00 
+  802298:	eb 83                	jmp    80221d <devfile_read+0x9f>
+
+000000000080229a <open>:
+open(const char *path, int mode) {
+  80229a:	55                   	push   %rbp
+  80229b:	48 89 e5             	mov    %rsp,%rbp
+  80229e:	41 55                	push   %r13
+  8022a0:	41 54                	push   %r12
+  8022a2:	53                   	push   %rbx
+  8022a3:	48 83 ec 18          	sub    $0x18,%rsp
+  8022a7:	49 89 fc             	mov    %rdi,%r12
+  8022aa:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  8022ad:	48 b8 49 0c 80 00 00 	movabs $0x800c49,%rax
+  8022b4:	00 00 00 
+  8022b7:	ff d0                	call   *%rax
+  8022b9:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  8022bf:	0f 87 8a 00 00 00    	ja     80234f <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8022c5:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  8022c9:	48 b8 7d 18 80 00 00 	movabs $0x80187d,%rax
+  8022d0:	00 00 00 
+  8022d3:	ff d0                	call   *%rax
+  8022d5:	89 c3                	mov    %eax,%ebx
+  8022d7:	85 c0                	test   %eax,%eax
+  8022d9:	78 50                	js     80232b <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  8022db:	4c 89 e6             	mov    %r12,%rsi
+  8022de:	48 bb 00 60 80 00 00 	movabs $0x806000,%rbx
+  8022e5:	00 00 00 
+  8022e8:	48 89 df             	mov    %rbx,%rdi
+  8022eb:	48 b8 87 0c 80 00 00 	movabs $0x800c87,%rax
+  8022f2:	00 00 00 
+  8022f5:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  8022f7:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  8022fe:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802302:	bf 01 00 00 00       	mov    $0x1,%edi
+  802307:	48 b8 04 1f 80 00 00 	movabs $0x801f04,%rax
+  80230e:	00 00 00 
+  802311:	ff d0                	call   *%rax
+  802313:	89 c3                	mov    %eax,%ebx
+  802315:	85 c0                	test   %eax,%eax
+  802317:	78 1f                	js     802338 <open+0x9e>
+    return fd2num(fd);
+  802319:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80231d:	48 b8 d6 17 80 00 00 	movabs $0x8017d6,%rax
+  802324:	00 00 00 
+  802327:	ff d0                	call   *%rax
+  802329:	89 c3                	mov    %eax,%ebx
+}
+  80232b:	89 d8                	mov    %ebx,%eax
+  80232d:	48 83 c4 18          	add    $0x18,%rsp
+  802331:	5b                   	pop    %rbx
+  802332:	41 5c                	pop    %r12
+  802334:	41 5d                	pop    %r13
+  802336:	5d                   	pop    %rbp
+  802337:	c3                   	ret
+        fd_close(fd, 0);
+  802338:	be 00 00 00 00       	mov    $0x0,%esi
+  80233d:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802341:	48 b8 52 19 80 00 00 	movabs $0x801952,%rax
+  802348:	00 00 00 
+  80234b:	ff d0                	call   *%rax
+        return res;
+  80234d:	eb dc                	jmp    80232b <open+0x91>
+        return -E_BAD_PATH;
+  80234f:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  802354:	eb d5                	jmp    80232b <open+0x91>
+
+0000000000802356 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  802356:	55                   	push   %rbp
+  802357:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc(FSREQ_SYNC, NULL);
+  80235a:	be 00 00 00 00       	mov    $0x0,%esi
+  80235f:	bf 08 00 00 00       	mov    $0x8,%edi
+  802364:	48 b8 04 1f 80 00 00 	movabs $0x801f04,%rax
+  80236b:	00 00 00 
+  80236e:	ff d0                	call   *%rax
+}
+  802370:	5d                   	pop    %rbp
+  802371:	c3                   	ret
+
+0000000000802372 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  802372:	55                   	push   %rbp
+  802373:	48 89 e5             	mov    %rsp,%rbp
+  802376:	41 54                	push   %r12
+  802378:	53                   	push   %rbx
+  802379:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80237c:	48 b8 e8 17 80 00 00 	movabs $0x8017e8,%rax
+  802383:	00 00 00 
+  802386:	ff d0                	call   *%rax
+  802388:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  80238b:	48 be c0 35 80 00 00 	movabs $0x8035c0,%rsi
+  802392:	00 00 00 
+  802395:	48 89 df             	mov    %rbx,%rdi
+  802398:	48 b8 87 0c 80 00 00 	movabs $0x800c87,%rax
+  80239f:	00 00 00 
+  8023a2:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  8023a4:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  8023a9:	41 2b 04 24          	sub    (%r12),%eax
+  8023ad:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  8023b3:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8023ba:	00 00 00 
+    stat->st_dev = &devpipe;
+  8023bd:	48 b8 60 40 80 00 00 	movabs $0x804060,%rax
+  8023c4:	00 00 00 
+  8023c7:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  8023ce:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023d3:	5b                   	pop    %rbx
+  8023d4:	41 5c                	pop    %r12
+  8023d6:	5d                   	pop    %rbp
+  8023d7:	c3                   	ret
+
+00000000008023d8 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  8023d8:	55                   	push   %rbp
+  8023d9:	48 89 e5             	mov    %rsp,%rbp
+  8023dc:	41 54                	push   %r12
+  8023de:	53                   	push   %rbx
+  8023df:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8023e2:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8023e7:	48 89 fe             	mov    %rdi,%rsi
+  8023ea:	bf 00 00 00 00       	mov    $0x0,%edi
+  8023ef:	49 bc 03 13 80 00 00 	movabs $0x801303,%r12
+  8023f6:	00 00 00 
+  8023f9:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  8023fc:	48 89 df             	mov    %rbx,%rdi
+  8023ff:	48 b8 e8 17 80 00 00 	movabs $0x8017e8,%rax
+  802406:	00 00 00 
+  802409:	ff d0                	call   *%rax
+  80240b:	48 89 c6             	mov    %rax,%rsi
+  80240e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802413:	bf 00 00 00 00       	mov    $0x0,%edi
+  802418:	41 ff d4             	call   *%r12
+}
+  80241b:	5b                   	pop    %rbx
+  80241c:	41 5c                	pop    %r12
+  80241e:	5d                   	pop    %rbp
+  80241f:	c3                   	ret
+
+0000000000802420 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  802420:	55                   	push   %rbp
+  802421:	48 89 e5             	mov    %rsp,%rbp
+  802424:	41 57                	push   %r15
+  802426:	41 56                	push   %r14
+  802428:	41 55                	push   %r13
+  80242a:	41 54                	push   %r12
+  80242c:	53                   	push   %rbx
+  80242d:	48 83 ec 18          	sub    $0x18,%rsp
+  802431:	49 89 fc             	mov    %rdi,%r12
+  802434:	49 89 f5             	mov    %rsi,%r13
+  802437:	49 89 d7             	mov    %rdx,%r15
+  80243a:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80243e:	48 b8 e8 17 80 00 00 	movabs $0x8017e8,%rax
+  802445:	00 00 00 
+  802448:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  80244a:	4d 85 ff             	test   %r15,%r15
+  80244d:	0f 84 af 00 00 00    	je     802502 <devpipe_write+0xe2>
+  802453:	48 89 c3             	mov    %rax,%rbx
+  802456:	4c 89 f8             	mov    %r15,%rax
+  802459:	4d 89 ef             	mov    %r13,%r15
+  80245c:	4c 01 e8             	add    %r13,%rax
+  80245f:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802463:	49 bd 0b 12 80 00 00 	movabs $0x80120b,%r13
+  80246a:	00 00 00 
+            sys_yield();
+  80246d:	49 be a8 11 80 00 00 	movabs $0x8011a8,%r14
+  802474:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  802477:	8b 73 04             	mov    0x4(%rbx),%esi
+  80247a:	48 63 ce             	movslq %esi,%rcx
+  80247d:	48 63 03             	movslq (%rbx),%rax
+  802480:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  802486:	48 39 c1             	cmp    %rax,%rcx
+  802489:	72 2e                	jb     8024b9 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80248b:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802490:	48 89 da             	mov    %rbx,%rdx
+  802493:	be 00 10 00 00       	mov    $0x1000,%esi
+  802498:	4c 89 e7             	mov    %r12,%rdi
+  80249b:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  80249e:	85 c0                	test   %eax,%eax
+  8024a0:	74 66                	je     802508 <devpipe_write+0xe8>
+            sys_yield();
+  8024a2:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  8024a5:	8b 73 04             	mov    0x4(%rbx),%esi
+  8024a8:	48 63 ce             	movslq %esi,%rcx
+  8024ab:	48 63 03             	movslq (%rbx),%rax
+  8024ae:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  8024b4:	48 39 c1             	cmp    %rax,%rcx
+  8024b7:	73 d2                	jae    80248b <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8024b9:	41 0f b6 3f          	movzbl (%r15),%edi
+  8024bd:	48 89 ca             	mov    %rcx,%rdx
+  8024c0:	48 c1 ea 03          	shr    $0x3,%rdx
+  8024c4:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  8024cb:	08 10 20 
+  8024ce:	48 f7 e2             	mul    %rdx
+  8024d1:	48 c1 ea 06          	shr    $0x6,%rdx
+  8024d5:	48 89 d0             	mov    %rdx,%rax
+  8024d8:	48 c1 e0 09          	shl    $0x9,%rax
+  8024dc:	48 29 d0             	sub    %rdx,%rax
+  8024df:	48 c1 e0 03          	shl    $0x3,%rax
+  8024e3:	48 29 c1             	sub    %rax,%rcx
+  8024e6:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  8024eb:	83 c6 01             	add    $0x1,%esi
+  8024ee:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8024f1:	49 83 c7 01          	add    $0x1,%r15
+  8024f5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8024f9:	49 39 c7             	cmp    %rax,%r15
+  8024fc:	0f 85 75 ff ff ff    	jne    802477 <devpipe_write+0x57>
+    return n;
+  802502:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802506:	eb 05                	jmp    80250d <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  802508:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80250d:	48 83 c4 18          	add    $0x18,%rsp
+  802511:	5b                   	pop    %rbx
+  802512:	41 5c                	pop    %r12
+  802514:	41 5d                	pop    %r13
+  802516:	41 5e                	pop    %r14
+  802518:	41 5f                	pop    %r15
+  80251a:	5d                   	pop    %rbp
+  80251b:	c3                   	ret
+
+000000000080251c <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  80251c:	55                   	push   %rbp
+  80251d:	48 89 e5             	mov    %rsp,%rbp
+  802520:	41 57                	push   %r15
+  802522:	41 56                	push   %r14
+  802524:	41 55                	push   %r13
+  802526:	41 54                	push   %r12
+  802528:	53                   	push   %rbx
+  802529:	48 83 ec 18          	sub    $0x18,%rsp
+  80252d:	49 89 fc             	mov    %rdi,%r12
+  802530:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  802534:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802538:	48 b8 e8 17 80 00 00 	movabs $0x8017e8,%rax
+  80253f:	00 00 00 
+  802542:	ff d0                	call   *%rax
+  802544:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  802547:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80254d:	49 bd 0b 12 80 00 00 	movabs $0x80120b,%r13
+  802554:	00 00 00 
+            sys_yield();
+  802557:	49 be a8 11 80 00 00 	movabs $0x8011a8,%r14
+  80255e:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  802561:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  802566:	74 7d                	je     8025e5 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  802568:	8b 03                	mov    (%rbx),%eax
+  80256a:	3b 43 04             	cmp    0x4(%rbx),%eax
+  80256d:	75 26                	jne    802595 <devpipe_read+0x79>
+            if (i > 0) return i;
+  80256f:	4d 85 ff             	test   %r15,%r15
+  802572:	75 77                	jne    8025eb <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802574:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802579:	48 89 da             	mov    %rbx,%rdx
+  80257c:	be 00 10 00 00       	mov    $0x1000,%esi
+  802581:	4c 89 e7             	mov    %r12,%rdi
+  802584:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  802587:	85 c0                	test   %eax,%eax
+  802589:	74 72                	je     8025fd <devpipe_read+0xe1>
+            sys_yield();
+  80258b:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  80258e:	8b 03                	mov    (%rbx),%eax
+  802590:	3b 43 04             	cmp    0x4(%rbx),%eax
+  802593:	74 df                	je     802574 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802595:	48 63 c8             	movslq %eax,%rcx
+  802598:	48 89 ca             	mov    %rcx,%rdx
+  80259b:	48 c1 ea 03          	shr    $0x3,%rdx
+  80259f:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  8025a6:	08 10 20 
+  8025a9:	48 89 d0             	mov    %rdx,%rax
+  8025ac:	48 f7 e6             	mul    %rsi
+  8025af:	48 c1 ea 06          	shr    $0x6,%rdx
+  8025b3:	48 89 d0             	mov    %rdx,%rax
+  8025b6:	48 c1 e0 09          	shl    $0x9,%rax
+  8025ba:	48 29 d0             	sub    %rdx,%rax
+  8025bd:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  8025c4:	00 
+  8025c5:	48 89 c8             	mov    %rcx,%rax
+  8025c8:	48 29 d0             	sub    %rdx,%rax
+  8025cb:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  8025d0:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8025d4:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  8025d8:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8025db:	49 83 c7 01          	add    $0x1,%r15
+  8025df:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  8025e3:	75 83                	jne    802568 <devpipe_read+0x4c>
+    return n;
+  8025e5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8025e9:	eb 03                	jmp    8025ee <devpipe_read+0xd2>
+            if (i > 0) return i;
+  8025eb:	4c 89 f8             	mov    %r15,%rax
+}
+  8025ee:	48 83 c4 18          	add    $0x18,%rsp
+  8025f2:	5b                   	pop    %rbx
+  8025f3:	41 5c                	pop    %r12
+  8025f5:	41 5d                	pop    %r13
+  8025f7:	41 5e                	pop    %r14
+  8025f9:	41 5f                	pop    %r15
+  8025fb:	5d                   	pop    %rbp
+  8025fc:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  8025fd:	b8 00 00 00 00       	mov    $0x0,%eax
+  802602:	eb ea                	jmp    8025ee <devpipe_read+0xd2>
+
+0000000000802604 <pipe>:
+pipe(int pfd[2]) {
+  802604:	55                   	push   %rbp
+  802605:	48 89 e5             	mov    %rsp,%rbp
+  802608:	41 55                	push   %r13
+  80260a:	41 54                	push   %r12
+  80260c:	53                   	push   %rbx
+  80260d:	48 81 ec b8 00 00 00 	sub    $0xb8,%rsp
+  802614:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  802617:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  80261b:	48 b8 7d 18 80 00 00 	movabs $0x80187d,%rax
+  802622:	00 00 00 
+  802625:	ff d0                	call   *%rax
+  802627:	89 c3                	mov    %eax,%ebx
+  802629:	85 c0                	test   %eax,%eax
+  80262b:	0f 88 51 01 00 00    	js     802782 <pipe+0x17e>
+        (res = fd_alloc_from(fd2num(fd0) + 1, &fd1)) < 0) goto err;
+  802631:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802635:	48 b8 d6 17 80 00 00 	movabs $0x8017d6,%rax
+  80263c:	00 00 00 
+  80263f:	ff d0                	call   *%rax
+  802641:	8d 78 01             	lea    0x1(%rax),%edi
+  802644:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802648:	48 b8 04 18 80 00 00 	movabs $0x801804,%rax
+  80264f:	00 00 00 
+  802652:	ff d0                	call   *%rax
+  802654:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  802656:	85 c0                	test   %eax,%eax
+  802658:	0f 88 24 01 00 00    	js     802782 <pipe+0x17e>
+    va = fd2data(fd0);
+  80265e:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802662:	48 bb e8 17 80 00 00 	movabs $0x8017e8,%rbx
+  802669:	00 00 00 
+  80266c:	ff d3                	call   *%rbx
+  80266e:	49 89 c5             	mov    %rax,%r13
+    struct RegionOp ops[] = {
+  802671:	48 8d bd 30 ff ff ff 	lea    -0xd0(%rbp),%rdi
+  802678:	b9 14 00 00 00       	mov    $0x14,%ecx
+  80267d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802682:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+  802685:	c7 85 34 ff ff ff 46 	movl   $0x46,-0xcc(%rbp)
+  80268c:	00 00 00 
+  80268f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802693:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+  80269a:	48 c7 85 50 ff ff ff 	movq   $0x1000,-0xb0(%rbp)
+  8026a1:	00 10 00 00 
+  8026a5:	c7 85 5c ff ff ff 46 	movl   $0x46,-0xa4(%rbp)
+  8026ac:	00 00 00 
+            {.type = REGION_ALLOC, .dstva = (uintptr_t)fd1, .size = PAGE_SIZE, .perm = PROT_RW | PROT_SHARE},
+  8026af:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+    struct RegionOp ops[] = {
+  8026b3:	48 89 bd 70 ff ff ff 	mov    %rdi,-0x90(%rbp)
+  8026ba:	48 c7 85 78 ff ff ff 	movq   $0x1000,-0x88(%rbp)
+  8026c1:	00 10 00 00 
+  8026c5:	c7 45 84 46 00 00 00 	movl   $0x46,-0x7c(%rbp)
+  8026cc:	4c 89 6d 98          	mov    %r13,-0x68(%rbp)
+  8026d0:	48 c7 45 a0 00 10 00 	movq   $0x1000,-0x60(%rbp)
+  8026d7:	00 
+  8026d8:	c7 45 a8 01 00 00 00 	movl   $0x1,-0x58(%rbp)
+  8026df:	c7 45 ac 46 00 00 00 	movl   $0x46,-0x54(%rbp)
+  8026e6:	4c 89 6d b8          	mov    %r13,-0x48(%rbp)
+            {.type = REGION_MAP, .srcva = (uintptr_t)va, .dstva = (uintptr_t)fd2data(fd1), .size = PAGE_SIZE, .perm = PROT_RW | PROT_SHARE},
+  8026ea:	ff d3                	call   *%rbx
+    struct RegionOp ops[] = {
+  8026ec:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8026f0:	48 c7 45 c8 00 10 00 	movq   $0x1000,-0x38(%rbp)
+  8026f7:	00 
+    if ((res = sys_region_batch(ops, sizeof ops / sizeof *ops)) < 0) goto err1;
+  8026f8:	be 04 00 00 00       	mov    $0x4,%esi
+  8026fd:	48 8d bd 30 ff ff ff 	lea    -0xd0(%rbp),%rdi
+  802704:	48 b8 6a 13 80 00 00 	movabs $0x80136a,%rax
+  80270b:	00 00 00 
+  80270e:	ff d0                	call   *%rax
+  802710:	89 c3                	mov    %eax,%ebx
+  802712:	85 c0                	test   %eax,%eax
+  802714:	0f 88 ad 00 00 00    	js     8027c7 <pipe+0x1c3>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  80271a:	be 00 10 00 00       	mov    $0x1000,%esi
+  80271f:	4c 89 ef             	mov    %r13,%rdi
+  802722:	48 b8 d9 11 80 00 00 	movabs $0x8011d9,%rax
+  802729:	00 00 00 
+  80272c:	ff d0                	call   *%rax
+  80272e:	83 f8 02             	cmp    $0x2,%eax
+  802731:	75 5f                	jne    802792 <pipe+0x18e>
+    fd0->fd_dev_id = devpipe.dev_id;
+  802733:	a1 60 40 80 00 00 00 	movabs 0x804060,%eax
+  80273a:	00 00 
+  80273c:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802740:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  802742:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802746:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  80274d:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  802751:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  802753:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802757:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  80275e:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802762:	48 bb d6 17 80 00 00 	movabs $0x8017d6,%rbx
+  802769:	00 00 00 
+  80276c:	ff d3                	call   *%rbx
+  80276e:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  802772:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  802776:	ff d3                	call   *%rbx
+  802778:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  80277d:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  802782:	89 d8                	mov    %ebx,%eax
+  802784:	48 81 c4 b8 00 00 00 	add    $0xb8,%rsp
+  80278b:	5b                   	pop    %rbx
+  80278c:	41 5c                	pop    %r12
+  80278e:	41 5d                	pop    %r13
+  802790:	5d                   	pop    %rbp
+  802791:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  802792:	48 b9 f0 35 80 00 00 	movabs $0x8035f0,%rcx
+  802799:	00 00 00 
+  80279c:	48 ba c7 35 80 00 00 	movabs $0x8035c7,%rdx
+  8027a3:	00 00 00 
+  8027a6:	be 33 00 00 00       	mov    $0x33,%esi
+  8027ab:	48 bf dc 35 80 00 00 	movabs $0x8035dc,%rdi
+  8027b2:	00 00 00 
+  8027b5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027ba:	49 b8 12 02 80 00 00 	movabs $0x800212,%r8
+  8027c1:	00 00 00 
+  8027c4:	41 ff d0             	call   *%r8
+        ops[i].type = REGION_UNMAP;
+  8027c7:	c7 85 30 ff ff ff 02 	movl   $0x2,-0xd0(%rbp)
+  8027ce:	00 00 00 
+  8027d1:	c7 85 58 ff ff ff 02 	movl   $0x2,-0xa8(%rbp)
+  8027d8:	00 00 00 
+  8027db:	c7 45 80 02 00 00 00 	movl   $0x2,-0x80(%rbp)
+  8027e2:	c7 45 a8 02 00 00 00 	movl   $0x2,-0x58(%rbp)
+    sys_region_batch(ops, sizeof ops / sizeof *ops);
+  8027e9:	be 04 00 00 00       	mov    $0x4,%esi
+  8027ee:	48 8d bd 30 ff ff ff 	lea    -0xd0(%rbp),%rdi
+  8027f5:	48 b8 6a 13 80 00 00 	movabs $0x80136a,%rax
+  8027fc:	00 00 00 
+  8027ff:	ff d0                	call   *%rax
+  802801:	e9 7c ff ff ff       	jmp    802782 <pipe+0x17e>
+
+0000000000802806 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  802806:	55                   	push   %rbp
+  802807:	48 89 e5             	mov    %rsp,%rbp
+  80280a:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  80280e:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802812:	48 b8 97 18 80 00 00 	movabs $0x801897,%rax
+  802819:	00 00 00 
+  80281c:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80281e:	85 c0                	test   %eax,%eax
+  802820:	78 35                	js     802857 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  802822:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802826:	48 b8 e8 17 80 00 00 	movabs $0x8017e8,%rax
+  80282d:	00 00 00 
+  802830:	ff d0                	call   *%rax
+  802832:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802835:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80283a:	be 00 10 00 00       	mov    $0x1000,%esi
+  80283f:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802843:	48 b8 0b 12 80 00 00 	movabs $0x80120b,%rax
+  80284a:	00 00 00 
+  80284d:	ff d0                	call   *%rax
+  80284f:	85 c0                	test   %eax,%eax
+  802851:	0f 94 c0             	sete   %al
+  802854:	0f b6 c0             	movzbl %al,%eax
+}
+  802857:	c9                   	leave
+  802858:	c3                   	ret
+
+0000000000802859 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  802859:	48 89 f8             	mov    %rdi,%rax
+  80285c:	48 c1 e8 27          	shr    $0x27,%rax
+  802860:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  802867:	01 00 00 
+  80286a:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80286e:	f6 c2 01             	test   $0x1,%dl
+  802871:	74 6d                	je     8028e0 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  802873:	48 89 f8             	mov    %rdi,%rax
+  802876:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80287a:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802881:	01 00 00 
+  802884:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802888:	f6 c2 01             	test   $0x1,%dl
+  80288b:	74 62                	je     8028ef <get_uvpt_entry+0x96>
+  80288d:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802894:	01 00 00 
+  802897:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80289b:	f6 c2 80             	test   $0x80,%dl
+  80289e:	75 4f                	jne    8028ef <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8028a0:	48 89 f8             	mov    %rdi,%rax
+  8028a3:	48 c1 e8 15          	shr    $0x15,%rax
+  8028a7:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8028ae:	01 00 00 
+  8028b1:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8028b5:	f6 c2 01             	test   $0x1,%dl
+  8028b8:	74 44                	je     8028fe <get_uvpt_entry+0xa5>
+  8028ba:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8028c1:	01 00 00 
+  8028c4:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8028c8:	f6 c2 80             	test   $0x80,%dl
+  8028cb:	75 31                	jne    8028fe <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  8028cd:	48 c1 ef 0c          	shr    $0xc,%rdi
+  8028d1:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8028d8:	01 00 00 
+  8028db:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  8028df:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8028e0:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  8028e7:	01 00 00 
+  8028ea:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8028ee:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8028ef:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8028f6:	01 00 00 
+  8028f9:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8028fd:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8028fe:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802905:	01 00 00 
+  802908:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80290c:	c3                   	ret
+
+000000000080290d <get_prot>:
+
+int
+get_prot(void *va) {
+  80290d:	55                   	push   %rbp
+  80290e:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  802911:	48 b8 59 28 80 00 00 	movabs $0x802859,%rax
+  802918:	00 00 00 
+  80291b:	ff d0                	call   *%rax
+  80291d:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  802920:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  802925:	89 c1                	mov    %eax,%ecx
+  802927:	83 c9 04             	or     $0x4,%ecx
+  80292a:	f6 c2 01             	test   $0x1,%dl
+  80292d:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  802930:	89 c1                	mov    %eax,%ecx
+  802932:	83 c9 02             	or     $0x2,%ecx
+  802935:	f6 c2 02             	test   $0x2,%dl
+  802938:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  80293b:	89 c1                	mov    %eax,%ecx
+  80293d:	83 c9 01             	or     $0x1,%ecx
+  802940:	48 85 d2             	test   %rdx,%rdx
+  802943:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  802946:	89 c1                	mov    %eax,%ecx
+  802948:	83 c9 40             	or     $0x40,%ecx
+  80294b:	f6 c6 04             	test   $0x4,%dh
+  80294e:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  802951:	5d                   	pop    %rbp
+  802952:	c3                   	ret
+
+0000000000802953 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  802953:	55                   	push   %rbp
+  802954:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  802957:	48 b8 59 28 80 00 00 	movabs $0x802859,%rax
+  80295e:	00 00 00 
+  802961:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  802963:	48 c1 e8 06          	shr    $0x6,%rax
+  802967:	83 e0 01             	and    $0x1,%eax
+}
+  80296a:	5d                   	pop    %rbp
+  80296b:	c3                   	ret
+
+000000000080296c <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  80296c:	55                   	push   %rbp
+  80296d:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  802970:	48 b8 59 28 80 00 00 	movabs $0x802859,%rax
+  802977:	00 00 00 
+  80297a:	ff d0                	call   *%rax
+  80297c:	83 e0 01             	and    $0x1,%eax
+}
+  80297f:	5d                   	pop    %rbp
+  802980:	c3                   	ret
+
+0000000000802981 <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  802981:	55                   	push   %rbp
+  802982:	48 89 e5             	mov    %rsp,%rbp
+  802985:	41 57                	push   %r15
+  802987:	41 56                	push   %r14
+  802989:	41 55                	push   %r13
+  80298b:	41 54                	push   %r12
+  80298d:	53                   	push   %rbx
+  80298e:	48 83 ec 38          	sub    $0x38,%rsp
+  802992:	49 89 f7             	mov    %rsi,%r15
+  802995:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+                    }
+                    continue;
+                }
+                for (int ptei = 0; ptei < PT_ENTRY_COUNT; ptei++) {
+                    uintptr_t pte_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, pdei, ptei, 0);
+                    pte_t pte = uvpt[VPT(pte_addr)];
+  80299b:	49 bd 00 00 00 00 00 	movabs $0x10000000000,%r13
+  8029a2:	01 00 00 
+  8029a5:	4d 89 e6             	mov    %r12,%r14
+  8029a8:	49 89 fc             	mov    %rdi,%r12
+  8029ab:	e9 19 01 00 00       	jmp    802ac9 <foreach_shared_region+0x148>
+  8029b0:	48 89 5d b0          	mov    %rbx,-0x50(%rbp)
+  8029b4:	4c 89 75 a8          	mov    %r14,-0x58(%rbp)
+  8029b8:	eb 52                	jmp    802a0c <foreach_shared_region+0x8b>
+                for (int ptei = 0; ptei < PT_ENTRY_COUNT; ptei++) {
+  8029ba:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8029c1:	48 81 fb 00 00 20 00 	cmp    $0x200000,%rbx
+  8029c8:	74 2e                	je     8029f8 <foreach_shared_region+0x77>
+                    uintptr_t pte_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, pdei, ptei, 0);
+  8029ca:	48 89 df             	mov    %rbx,%rdi
+  8029cd:	4c 09 f7             	or     %r14,%rdi
+                    pte_t pte = uvpt[VPT(pte_addr)];
+  8029d0:	48 89 f8             	mov    %rdi,%rax
+  8029d3:	48 c1 e8 0c          	shr    $0xc,%rax
+  8029d7:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+                    if ((pte & PTE_P) && (pte & PTE_SHARE)) {
+  8029dc:	25 01 04 00 00       	and    $0x401,%eax
+  8029e1:	48 3d 01 04 00 00    	cmp    $0x401,%rax
+  8029e7:	75 d1                	jne    8029ba <foreach_shared_region+0x39>
+                        fun((void*)pte_addr, (void*)(pte_addr + PAGE_SIZE), arg);
+  8029e9:	48 8d b7 00 10 00 00 	lea    0x1000(%rdi),%rsi
+  8029f0:	4c 89 fa             	mov    %r15,%rdx
+  8029f3:	41 ff d4             	call   *%r12
+  8029f6:	eb c2                	jmp    8029ba <foreach_shared_region+0x39>
+            for (int pdei = 0; pdei < PD_ENTRY_COUNT; pdei++) {
+  8029f8:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  8029ff:	00 
+  802a00:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802a04:	48 3d 00 00 00 40    	cmp    $0x40000000,%rax
+  802a0a:	74 46                	je     802a52 <foreach_shared_region+0xd1>
+                uintptr_t pde_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, pdei, 0, 0);
+  802a0c:	4c 8b 75 c8          	mov    -0x38(%rbp),%r14
+  802a10:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802a14:	49 09 c6             	or     %rax,%r14
+                pde_t pde = uvpd[VPD(pde_addr)];
+  802a17:	4c 89 f0             	mov    %r14,%rax
+  802a1a:	48 c1 e8 15          	shr    $0x15,%rax
+  802a1e:	48 b9 00 00 00 80 00 	movabs $0x10080000000,%rcx
+  802a25:	01 00 00 
+  802a28:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+                if (!(pde & PTE_P)) {
+  802a2c:	a8 01                	test   $0x1,%al
+  802a2e:	74 c8                	je     8029f8 <foreach_shared_region+0x77>
+                if (pde & PTE_PS) {
+  802a30:	48 89 c3             	mov    %rax,%rbx
+  802a33:	81 e3 80 00 00 00    	and    $0x80,%ebx
+  802a39:	74 8f                	je     8029ca <foreach_shared_region+0x49>
+                    if (pde & PTE_SHARE) {
+  802a3b:	f6 c4 04             	test   $0x4,%ah
+  802a3e:	74 b8                	je     8029f8 <foreach_shared_region+0x77>
+                        fun((void*)pde_addr, (void*)(pde_addr + 1024 * 1024 * 2), arg);
+  802a40:	49 8d b6 00 00 20 00 	lea    0x200000(%r14),%rsi
+  802a47:	4c 89 fa             	mov    %r15,%rdx
+  802a4a:	4c 89 f7             	mov    %r14,%rdi
+  802a4d:	41 ff d4             	call   *%r12
+  802a50:	eb a6                	jmp    8029f8 <foreach_shared_region+0x77>
+  802a52:	48 8b 5d b0          	mov    -0x50(%rbp),%rbx
+  802a56:	4c 8b 75 a8          	mov    -0x58(%rbp),%r14
+        for (int pdpei = 0; pdpei < PDP_ENTRY_COUNT; pdpei++) {
+  802a5a:	48 81 c3 00 00 00 40 	add    $0x40000000,%rbx
+  802a61:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802a68:	00 00 00 
+  802a6b:	48 39 c3             	cmp    %rax,%rbx
+  802a6e:	74 4c                	je     802abc <foreach_shared_region+0x13b>
+            uintptr_t pdpe_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, 0, 0, 0);
+  802a70:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802a74:	48 09 d8             	or     %rbx,%rax
+  802a77:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+            pdpe_t pdpe = uvpdp[VPDP(pdpe_addr)];
+  802a7b:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802a7f:	48 b9 00 00 40 80 00 	movabs $0x10080400000,%rcx
+  802a86:	01 00 00 
+  802a89:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+            if (!(pdpe & PTE_P)) {
+  802a8d:	a8 01                	test   $0x1,%al
+  802a8f:	74 c9                	je     802a5a <foreach_shared_region+0xd9>
+            if (pdpe & PTE_PS) {
+  802a91:	48 89 c1             	mov    %rax,%rcx
+  802a94:	81 e1 80 00 00 00    	and    $0x80,%ecx
+  802a9a:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  802a9e:	0f 84 0c ff ff ff    	je     8029b0 <foreach_shared_region+0x2f>
+                if (pdpe & PTE_SHARE) {
+  802aa4:	f6 c4 04             	test   $0x4,%ah
+  802aa7:	74 b1                	je     802a5a <foreach_shared_region+0xd9>
+                    fun((void*)pdpe_addr, (void*)(pdpe_addr + 1024 * 1024 * 1024), arg); 
+  802aa9:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  802aad:	48 8d b7 00 00 00 40 	lea    0x40000000(%rdi),%rsi
+  802ab4:	4c 89 fa             	mov    %r15,%rdx
+  802ab7:	41 ff d4             	call   *%r12
+  802aba:	eb 9e                	jmp    802a5a <foreach_shared_region+0xd9>
+    for (int pml4ei = 0; pml4ei < PML4_ENTRY_COUNT; pml4ei++) {
+  802abc:	49 83 c6 01          	add    $0x1,%r14
+  802ac0:	49 81 fe 00 02 00 00 	cmp    $0x200,%r14
+  802ac7:	74 24                	je     802aed <foreach_shared_region+0x16c>
+        pml4e_t pml4e = uvpml4[VPML4(pml4_addr)];
+  802ac9:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  802ad0:	01 00 00 
+  802ad3:	4a 8b 04 f0          	mov    (%rax,%r14,8),%rax
+        if (!(pml4e & PTE_P)) {
+  802ad7:	a8 01                	test   $0x1,%al
+  802ad9:	74 e1                	je     802abc <foreach_shared_region+0x13b>
+  802adb:	4c 89 f0             	mov    %r14,%rax
+  802ade:	48 c1 e0 27          	shl    $0x27,%rax
+  802ae2:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  802ae6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802aeb:	eb 83                	jmp    802a70 <foreach_shared_region+0xef>
+            }
+        }
+    }
+    
+    return 0;
+}
+  802aed:	b8 00 00 00 00       	mov    $0x0,%eax
+  802af2:	48 83 c4 38          	add    $0x38,%rsp
+  802af6:	5b                   	pop    %rbx
+  802af7:	41 5c                	pop    %r12
+  802af9:	41 5d                	pop    %r13
+  802afb:	41 5e                	pop    %r14
+  802afd:	41 5f                	pop    %r15
+  802aff:	5d                   	pop    %rbp
+  802b00:	c3                   	ret
+
+0000000000802b01 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  802b01:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b06:	c3                   	ret
+
+0000000000802b07 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  802b07:	55                   	push   %rbp
+  802b08:	48 89 e5             	mov    %rsp,%rbp
+  802b0b:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  802b0e:	48 be 14 36 80 00 00 	movabs $0x803614,%rsi
+  802b15:	00 00 00 
+  802b18:	48 b8 87 0c 80 00 00 	movabs $0x800c87,%rax
+  802b1f:	00 00 00 
+  802b22:	ff d0                	call   *%rax
+    return 0;
+}
+  802b24:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b29:	5d                   	pop    %rbp
+  802b2a:	c3                   	ret
+
+0000000000802b2b <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  802b2b:	55                   	push   %rbp
+  802b2c:	48 89 e5             	mov    %rsp,%rbp
+  802b2f:	41 57                	push   %r15
+  802b31:	41 56                	push   %r14
+  802b33:	41 55                	push   %r13
+  802b35:	41 54                	push   %r12
+  802b37:	53                   	push   %rbx
+  802b38:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  802b3f:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  802b46:	48 85 d2             	test   %rdx,%rdx
+  802b49:	74 7a                	je     802bc5 <devcons_write+0x9a>
+  802b4b:	49 89 d6             	mov    %rdx,%r14
+  802b4e:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802b54:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  802b59:	49 bf 81 0e 80 00 00 	movabs $0x800e81,%r15
+  802b60:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  802b63:	4c 89 f3             	mov    %r14,%rbx
+  802b66:	48 29 f3             	sub    %rsi,%rbx
+  802b69:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802b6e:	48 39 c3             	cmp    %rax,%rbx
+  802b71:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  802b75:	4c 63 eb             	movslq %ebx,%r13
+  802b78:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  802b7f:	48 01 c6             	add    %rax,%rsi
+  802b82:	4c 89 ea             	mov    %r13,%rdx
+  802b85:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802b8c:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  802b8f:	4c 89 ee             	mov    %r13,%rsi
+  802b92:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802b99:	48 b8 ae 10 80 00 00 	movabs $0x8010ae,%rax
+  802ba0:	00 00 00 
+  802ba3:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  802ba5:	41 01 dc             	add    %ebx,%r12d
+  802ba8:	49 63 f4             	movslq %r12d,%rsi
+  802bab:	4c 39 f6             	cmp    %r14,%rsi
+  802bae:	72 b3                	jb     802b63 <devcons_write+0x38>
+    return res;
+  802bb0:	49 63 c4             	movslq %r12d,%rax
+}
+  802bb3:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  802bba:	5b                   	pop    %rbx
+  802bbb:	41 5c                	pop    %r12
+  802bbd:	41 5d                	pop    %r13
+  802bbf:	41 5e                	pop    %r14
+  802bc1:	41 5f                	pop    %r15
+  802bc3:	5d                   	pop    %rbp
+  802bc4:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  802bc5:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802bcb:	eb e3                	jmp    802bb0 <devcons_write+0x85>
+
+0000000000802bcd <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  802bcd:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  802bd0:	ba 00 00 00 00       	mov    $0x0,%edx
+  802bd5:	48 85 c0             	test   %rax,%rax
+  802bd8:	74 55                	je     802c2f <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  802bda:	55                   	push   %rbp
+  802bdb:	48 89 e5             	mov    %rsp,%rbp
+  802bde:	41 55                	push   %r13
+  802be0:	41 54                	push   %r12
+  802be2:	53                   	push   %rbx
+  802be3:	48 83 ec 08          	sub    $0x8,%rsp
+  802be7:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  802bea:	48 bb db 10 80 00 00 	movabs $0x8010db,%rbx
+  802bf1:	00 00 00 
+  802bf4:	49 bc a8 11 80 00 00 	movabs $0x8011a8,%r12
+  802bfb:	00 00 00 
+  802bfe:	eb 03                	jmp    802c03 <devcons_read+0x36>
+  802c00:	41 ff d4             	call   *%r12
+  802c03:	ff d3                	call   *%rbx
+  802c05:	85 c0                	test   %eax,%eax
+  802c07:	74 f7                	je     802c00 <devcons_read+0x33>
+    if (c < 0) return c;
+  802c09:	48 63 d0             	movslq %eax,%rdx
+  802c0c:	78 13                	js     802c21 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  802c0e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802c13:	83 f8 04             	cmp    $0x4,%eax
+  802c16:	74 09                	je     802c21 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  802c18:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  802c1c:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  802c21:	48 89 d0             	mov    %rdx,%rax
+  802c24:	48 83 c4 08          	add    $0x8,%rsp
+  802c28:	5b                   	pop    %rbx
+  802c29:	41 5c                	pop    %r12
+  802c2b:	41 5d                	pop    %r13
+  802c2d:	5d                   	pop    %rbp
+  802c2e:	c3                   	ret
+  802c2f:	48 89 d0             	mov    %rdx,%rax
+  802c32:	c3                   	ret
+
+0000000000802c33 <cputchar>:
+cputchar(int ch) {
+  802c33:	55                   	push   %rbp
+  802c34:	48 89 e5             	mov    %rsp,%rbp
+  802c37:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  802c3b:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  802c3f:	be 01 00 00 00       	mov    $0x1,%esi
+  802c44:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  802c48:	48 b8 ae 10 80 00 00 	movabs $0x8010ae,%rax
+  802c4f:	00 00 00 
+  802c52:	ff d0                	call   *%rax
+}
+  802c54:	c9                   	leave
+  802c55:	c3                   	ret
+
+0000000000802c56 <getchar>:
+getchar(void) {
+  802c56:	55                   	push   %rbp
+  802c57:	48 89 e5             	mov    %rsp,%rbp
+  802c5a:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  802c5e:	ba 01 00 00 00       	mov    $0x1,%edx
+  802c63:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  802c67:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c6c:	48 b8 7a 1b 80 00 00 	movabs $0x801b7a,%rax
+  802c73:	00 00 00 
+  802c76:	ff d0                	call   *%rax
+  802c78:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  802c7a:	85 c0                	test   %eax,%eax
+  802c7c:	78 06                	js     802c84 <getchar+0x2e>
+  802c7e:	74 08                	je     802c88 <getchar+0x32>
+  802c80:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  802c84:	89 d0                	mov    %edx,%eax
+  802c86:	c9                   	leave
+  802c87:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  802c88:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  802c8d:	eb f5                	jmp    802c84 <getchar+0x2e>
+
+0000000000802c8f <iscons>:
+iscons(int fdnum) {
+  802c8f:	55                   	push   %rbp
+  802c90:	48 89 e5             	mov    %rsp,%rbp
+  802c93:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  802c97:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802c9b:	48 b8 97 18 80 00 00 	movabs $0x801897,%rax
+  802ca2:	00 00 00 
+  802ca5:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802ca7:	85 c0                	test   %eax,%eax
+  802ca9:	78 18                	js     802cc3 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  802cab:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802caf:	48 b8 a0 40 80 00 00 	movabs $0x8040a0,%rax
+  802cb6:	00 00 00 
+  802cb9:	8b 00                	mov    (%rax),%eax
+  802cbb:	39 02                	cmp    %eax,(%rdx)
+  802cbd:	0f 94 c0             	sete   %al
+  802cc0:	0f b6 c0             	movzbl %al,%eax
+}
+  802cc3:	c9                   	leave
+  802cc4:	c3                   	ret
+
+0000000000802cc5 <opencons>:
+opencons(void) {
+  802cc5:	55                   	push   %rbp
+  802cc6:	48 89 e5             	mov    %rsp,%rbp
+  802cc9:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802ccd:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  802cd1:	48 b8 7d 18 80 00 00 	movabs $0x80187d,%rax
+  802cd8:	00 00 00 
+  802cdb:	ff d0                	call   *%rax
+  802cdd:	85 c0                	test   %eax,%eax
+  802cdf:	78 49                	js     802d2a <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  802ce1:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802ce6:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802ceb:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  802cef:	bf 00 00 00 00       	mov    $0x0,%edi
+  802cf4:	48 b8 37 12 80 00 00 	movabs $0x801237,%rax
+  802cfb:	00 00 00 
+  802cfe:	ff d0                	call   *%rax
+  802d00:	85 c0                	test   %eax,%eax
+  802d02:	78 26                	js     802d2a <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  802d04:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802d08:	a1 a0 40 80 00 00 00 	movabs 0x8040a0,%eax
+  802d0f:	00 00 
+  802d11:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  802d13:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802d17:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  802d1e:	48 b8 d6 17 80 00 00 	movabs $0x8017d6,%rax
+  802d25:	00 00 00 
+  802d28:	ff d0                	call   *%rax
+}
+  802d2a:	c9                   	leave
+  802d2b:	c3                   	ret
+
+0000000000802d2c <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  802d2c:	55                   	push   %rbp
+  802d2d:	48 89 e5             	mov    %rsp,%rbp
+  802d30:	41 55                	push   %r13
+  802d32:	41 54                	push   %r12
+  802d34:	53                   	push   %rbx
+  802d35:	48 83 ec 08          	sub    $0x8,%rsp
+  802d39:	49 89 fc             	mov    %rdi,%r12
+  802d3c:	48 89 f7             	mov    %rsi,%rdi
+  802d3f:	48 89 d3             	mov    %rdx,%rbx
+  802d42:	49 89 cd             	mov    %rcx,%r13
+    // LAB 9: Your code here:
+    int res = sys_ipc_recv(!pg ? (void*)MAX_USER_ADDRESS : pg, !size ? 0 : *size);
+  802d45:	be 00 00 00 00       	mov    $0x0,%esi
+  802d4a:	48 85 d2             	test   %rdx,%rdx
+  802d4d:	74 03                	je     802d52 <ipc_recv+0x26>
+  802d4f:	48 8b 32             	mov    (%rdx),%rsi
+  802d52:	48 85 ff             	test   %rdi,%rdi
+  802d55:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802d5c:	00 00 00 
+  802d5f:	48 0f 44 f8          	cmove  %rax,%rdi
+  802d63:	48 b8 09 16 80 00 00 	movabs $0x801609,%rax
+  802d6a:	00 00 00 
+  802d6d:	ff d0                	call   *%rax
+    if (res < 0) {
+  802d6f:	85 c0                	test   %eax,%eax
+  802d71:	78 66                	js     802dd9 <ipc_recv+0xad>
+        if (size) {
+            *size = 0;
+        }
+        return res;
+    }
+    if (from_env_store) {
+  802d73:	4d 85 e4             	test   %r12,%r12
+  802d76:	74 14                	je     802d8c <ipc_recv+0x60>
+        *from_env_store = thisenv->env_ipc_from;
+  802d78:	48 a1 08 50 80 00 00 	movabs 0x805008,%rax
+  802d7f:	00 00 00 
+  802d82:	8b 80 ac 01 00 00    	mov    0x1ac(%rax),%eax
+  802d88:	41 89 04 24          	mov    %eax,(%r12)
+    }
+    if (perm_store) {
+  802d8c:	4d 85 ed             	test   %r13,%r13
+  802d8f:	74 14                	je     802da5 <ipc_recv+0x79>
+        *perm_store = thisenv->env_ipc_perm;
+  802d91:	48 a1 08 50 80 00 00 	movabs 0x805008,%rax
+  802d98:	00 00 00 
+  802d9b:	8b 80 b0 01 00 00    	mov    0x1b0(%rax),%eax
+  802da1:	41 89 45 00          	mov    %eax,0x0(%r13)
+    }
+    if (size) {
+  802da5:	48 85 db             	test   %rbx,%rbx
+  802da8:	74 14                	je     802dbe <ipc_recv+0x92>
+        *size = thisenv->env_ipc_maxsz;
+  802daa:	48 a1 08 50 80 00 00 	movabs 0x805008,%rax
+  802db1:	00 00 00 
+  802db4:	48 8b 80 a0 01 00 00 	mov    0x1a0(%rax),%rax
+  802dbb:	48 89 03             	mov    %rax,(%rbx)
+    }
+    return thisenv->env_ipc_value;
+  802dbe:	48 a1 08 50 80 00 00 	movabs 0x805008,%rax
+  802dc5:	00 00 00 
+  802dc8:	8b 80 a8 01 00 00    	mov    0x1a8(%rax),%eax
+}
+  802dce:	48 83 c4 08          	add    $0x8,%rsp
+  802dd2:	5b                   	pop    %rbx
+  802dd3:	41 5c                	pop    %r12
+  802dd5:	41 5d                	pop    %r13
+  802dd7:	5d                   	pop    %rbp
+  802dd8:	c3                   	ret
+        if (from_env_store) {
+  802dd9:	4d 85 e4             	test   %r12,%r12
+  802ddc:	74 08                	je     802de6 <ipc_recv+0xba>
+            *from_env_store = 0;
+  802dde:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  802de5:	00 
+        if (perm_store) {
+  802de6:	4d 85 ed             	test   %r13,%r13
+  802de9:	74 08                	je     802df3 <ipc_recv+0xc7>
+            *perm_store = 0;
+  802deb:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  802df2:	00 
+        if (size) {
+  802df3:	48 85 db             	test   %rbx,%rbx
+  802df6:	74 d6                	je     802dce <ipc_recv+0xa2>
+            *size = 0;
+  802df8:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  802dff:	eb cd                	jmp    802dce <ipc_recv+0xa2>
+
+0000000000802e01 <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  802e01:	55                   	push   %rbp
+  802e02:	48 89 e5             	mov    %rsp,%rbp
+  802e05:	41 57                	push   %r15
+  802e07:	41 56                	push   %r14
+  802e09:	41 55                	push   %r13
+  802e0b:	41 54                	push   %r12
+  802e0d:	53                   	push   %rbx
+  802e0e:	48 83 ec 18          	sub    $0x18,%rsp
+  802e12:	41 89 fd             	mov    %edi,%r13d
+  802e15:	89 75 cc             	mov    %esi,-0x34(%rbp)
+  802e18:	49 89 cc             	mov    %rcx,%r12
+  802e1b:	44 89 45 c8          	mov    %r8d,-0x38(%rbp)
+    // LAB 9: Your code here:
+    int res = 0;
+    while ((res = sys_ipc_try_send(to_env, val, !pg ? (void*)MAX_USER_ADDRESS : pg, size, perm)) < 0) {
+  802e1f:	48 85 d2             	test   %rdx,%rdx
+  802e22:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802e29:	00 00 00 
+  802e2c:	48 0f 45 c2          	cmovne %rdx,%rax
+  802e30:	48 89 c3             	mov    %rax,%rbx
+  802e33:	49 be dd 15 80 00 00 	movabs $0x8015dd,%r14
+  802e3a:	00 00 00 
+        if (res != -E_IPC_NOT_RECV) {
+            panic("sys_ipc_try_send failed: %i", res);
+        }
+        sys_yield();
+  802e3d:	49 bf a8 11 80 00 00 	movabs $0x8011a8,%r15
+  802e44:	00 00 00 
+    while ((res = sys_ipc_try_send(to_env, val, !pg ? (void*)MAX_USER_ADDRESS : pg, size, perm)) < 0) {
+  802e47:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  802e4a:	44 8b 45 c8          	mov    -0x38(%rbp),%r8d
+  802e4e:	4c 89 e1             	mov    %r12,%rcx
+  802e51:	48 89 da             	mov    %rbx,%rdx
+  802e54:	44 89 ef             	mov    %r13d,%edi
+  802e57:	41 ff d6             	call   *%r14
+  802e5a:	85 c0                	test   %eax,%eax
+  802e5c:	79 37                	jns    802e95 <ipc_send+0x94>
+        if (res != -E_IPC_NOT_RECV) {
+  802e5e:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  802e61:	75 05                	jne    802e68 <ipc_send+0x67>
+        sys_yield();
+  802e63:	41 ff d7             	call   *%r15
+  802e66:	eb df                	jmp    802e47 <ipc_send+0x46>
+            panic("sys_ipc_try_send failed: %i", res);
+  802e68:	89 c1                	mov    %eax,%ecx
+  802e6a:	48 ba 20 36 80 00 00 	movabs $0x803620,%rdx
+  802e71:	00 00 00 
+  802e74:	be 40 00 00 00       	mov    $0x40,%esi
+  802e79:	48 bf 3c 36 80 00 00 	movabs $0x80363c,%rdi
+  802e80:	00 00 00 
+  802e83:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e88:	49 b8 12 02 80 00 00 	movabs $0x800212,%r8
+  802e8f:	00 00 00 
+  802e92:	41 ff d0             	call   *%r8
+    }
+    return;
+}
+  802e95:	48 83 c4 18          	add    $0x18,%rsp
+  802e99:	5b                   	pop    %rbx
+  802e9a:	41 5c                	pop    %r12
+  802e9c:	41 5d                	pop    %r13
+  802e9e:	41 5e                	pop    %r14
+  802ea0:	41 5f                	pop    %r15
+  802ea2:	5d                   	pop    %rbp
+  802ea3:	c3                   	ret
+
+0000000000802ea4 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  802ea4:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  802ea9:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  802eb0:	00 00 00 
+  802eb3:	48 69 d0 d0 01 00 00 	imul   $0x1d0,%rax,%rdx
+  802eba:	48 01 ca             	add    %rcx,%rdx
+  802ebd:	8b 92 e8 00 00 00    	mov    0xe8(%rdx),%edx
+  802ec3:	39 fa                	cmp    %edi,%edx
+  802ec5:	74 12                	je     802ed9 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  802ec7:	48 83 c0 01          	add    $0x1,%rax
+  802ecb:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  802ed1:	75 e0                	jne    802eb3 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  802ed3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802ed8:	c3                   	ret
+            return envs[i].env_id;
+  802ed9:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+  802ee0:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  802ee7:	00 00 00 
+  802eea:	48 01 d0             	add    %rdx,%rax
+  802eed:	8b 80 e0 00 00 00    	mov    0xe0(%rax),%eax
+  802ef3:	c3                   	ret
+  802ef4:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000802ef8 <__rodata_start>:
+  802ef8:	72 61                	jb     802f5b <__rodata_start+0x63>
+  802efa:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802efb:	20 6f 6e             	and    %ch,0x6e(%rdi)
+  802efe:	20 74 77 6f          	and    %dh,0x6f(%rdi,%rsi,2)
+  802f02:	20 43 50             	and    %al,0x50(%rbx)
+  802f05:	55                   	push   %rbp
+  802f06:	73 20                	jae    802f28 <__rodata_start+0x30>
+  802f08:	61                   	(bad)
+  802f09:	74 20                	je     802f2b <__rodata_start+0x33>
+  802f0b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802f0c:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802f0d:	63 65 20             	movsxd 0x20(%rbp),%esp
+  802f10:	28 63 6f             	sub    %ah,0x6f(%rbx)
+  802f13:	75 6e                	jne    802f83 <__rodata_start+0x8b>
+  802f15:	74 65                	je     802f7c <__rodata_start+0x84>
+  802f17:	72 20                	jb     802f39 <__rodata_start+0x41>
+  802f19:	69 73 20 25 64 29 00 	imul   $0x296425,0x20(%rbx),%esi
+  802f20:	75 73                	jne    802f95 <__rodata_start+0x9d>
+  802f22:	65 72 2f             	gs jb  802f54 <__rodata_start+0x5c>
+  802f25:	73 74                	jae    802f9b <__rodata_start+0xa3>
+  802f27:	72 65                	jb     802f8e <__rodata_start+0x96>
+  802f29:	73 73                	jae    802f9e <__rodata_start+0xa6>
+  802f2b:	73 63                	jae    802f90 <__rodata_start+0x98>
+  802f2d:	68 65 64 2e 63       	push   $0x632e6465
+  802f32:	00 3c 75 6e 6b 6e 6f 	add    %bh,0x6f6e6b6e(,%rsi,2)
+  802f39:	77 6e                	ja     802fa9 <__rodata_start+0xb1>
+  802f3b:	3e 00 0f             	ds add %cl,(%rdi)
+  802f3e:	1f                   	(bad)
+  802f3f:	00 5b 25             	add    %bl,0x25(%rbx)
+  802f42:	30 38                	xor    %bh,(%rax)
+  802f44:	78 5d                	js     802fa3 <__rodata_start+0xab>
+  802f46:	20 75 73             	and    %dh,0x73(%rbp)
+  802f49:	65 72 20             	gs jb  802f6c <__rodata_start+0x74>
+  802f4c:	70 61                	jo     802faf <__rodata_start+0xb7>
+  802f4e:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802f4f:	69 63 20 69 6e 20 25 	imul   $0x25206e69,0x20(%rbx),%esp
+  802f56:	73 20                	jae    802f78 <__rodata_start+0x80>
+  802f58:	61                   	(bad)
+  802f59:	74 20                	je     802f7b <__rodata_start+0x83>
+  802f5b:	25 73 3a 25 64       	and    $0x64253a73,%eax
+  802f60:	3a 20                	cmp    (%rax),%ah
+  802f62:	00 30                	add    %dh,(%rax)
+  802f64:	31 32                	xor    %esi,(%rdx)
+  802f66:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  802f6d:	41                   	rex.B
+  802f6e:	42                   	rex.X
+  802f6f:	43                   	rex.XB
+  802f70:	44                   	rex.R
+  802f71:	45                   	rex.RB
+  802f72:	46 00 30             	rex.RX add %r14b,(%rax)
+  802f75:	31 32                	xor    %esi,(%rdx)
+  802f77:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  802f7e:	61                   	(bad)
+  802f7f:	62 63 64 65 66       	(bad)
+  802f84:	00 28                	add    %ch,(%rax)
+  802f86:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802f87:	75 6c                	jne    802ff5 <__rodata_start+0xfd>
+  802f89:	6c                   	insb   (%dx),%es:(%rdi)
+  802f8a:	29 00                	sub    %eax,(%rax)
+  802f8c:	65 72 72             	gs jb  803001 <__rodata_start+0x109>
+  802f8f:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802f90:	72 20                	jb     802fb2 <__rodata_start+0xba>
+  802f92:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  802f97:	73 70                	jae    803009 <__rodata_start+0x111>
+  802f99:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  802f9d:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  802fa4:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802fa5:	72 00                	jb     802fa7 <__rodata_start+0xaf>
+  802fa7:	62 61 64 20 65       	(bad)
+  802fac:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802fad:	76 69                	jbe    803018 <__rodata_start+0x120>
+  802faf:	72 6f                	jb     803020 <__rodata_start+0x128>
+  802fb1:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802fb2:	6d                   	insl   (%dx),%es:(%rdi)
+  802fb3:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  802fb5:	74 00                	je     802fb7 <__rodata_start+0xbf>
+  802fb7:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  802fbe:	20 70 61             	and    %dh,0x61(%rax)
+  802fc1:	72 61                	jb     803024 <__rodata_start+0x12c>
+  802fc3:	6d                   	insl   (%dx),%es:(%rdi)
+  802fc4:	65 74 65             	gs je  80302c <__rodata_start+0x134>
+  802fc7:	72 00                	jb     802fc9 <__rodata_start+0xd1>
+  802fc9:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802fca:	75 74                	jne    803040 <__rodata_start+0x148>
+  802fcc:	20 6f 66             	and    %ch,0x66(%rdi)
+  802fcf:	20 6d 65             	and    %ch,0x65(%rbp)
+  802fd2:	6d                   	insl   (%dx),%es:(%rdi)
+  802fd3:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802fd4:	72 79                	jb     80304f <__rodata_start+0x157>
+  802fd6:	00 6f 75             	add    %ch,0x75(%rdi)
+  802fd9:	74 20                	je     802ffb <__rodata_start+0x103>
+  802fdb:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802fdc:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  802fe0:	76 69                	jbe    80304b <__rodata_start+0x153>
+  802fe2:	72 6f                	jb     803053 <__rodata_start+0x15b>
+  802fe4:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802fe5:	6d                   	insl   (%dx),%es:(%rdi)
+  802fe6:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  802fe8:	74 73                	je     80305d <__rodata_start+0x165>
+  802fea:	00 63 6f             	add    %ah,0x6f(%rbx)
+  802fed:	72 72                	jb     803061 <__rodata_start+0x169>
+  802fef:	75 70                	jne    803061 <__rodata_start+0x169>
+  802ff1:	74 65                	je     803058 <__rodata_start+0x160>
+  802ff3:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  802ff8:	75 67                	jne    803061 <__rodata_start+0x169>
+  802ffa:	20 69 6e             	and    %ch,0x6e(%rcx)
+  802ffd:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  802fff:	00 73 65             	add    %dh,0x65(%rbx)
+  803002:	67 6d                	insl   (%dx),%es:(%edi)
+  803004:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803006:	74 61                	je     803069 <__rodata_start+0x171>
+  803008:	74 69                	je     803073 <__rodata_start+0x17b>
+  80300a:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80300b:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80300c:	20 66 61             	and    %ah,0x61(%rsi)
+  80300f:	75 6c                	jne    80307d <__rodata_start+0x185>
+  803011:	74 00                	je     803013 <__rodata_start+0x11b>
+  803013:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  80301a:	20 45 4c             	and    %al,0x4c(%rbp)
+  80301d:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  803021:	61                   	(bad)
+  803022:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  803027:	20 73 75             	and    %dh,0x75(%rbx)
+  80302a:	63 68 20             	movsxd 0x20(%rax),%ebp
+  80302d:	73 79                	jae    8030a8 <__rodata_start+0x1b0>
+  80302f:	73 74                	jae    8030a5 <__rodata_start+0x1ad>
+  803031:	65 6d                	gs insl (%dx),%es:(%rdi)
+  803033:	20 63 61             	and    %ah,0x61(%rbx)
+  803036:	6c                   	insb   (%dx),%es:(%rdi)
+  803037:	6c                   	insb   (%dx),%es:(%rdi)
+  803038:	00 65 6e             	add    %ah,0x6e(%rbp)
+  80303b:	74 72                	je     8030af <__rodata_start+0x1b7>
+  80303d:	79 20                	jns    80305f <__rodata_start+0x167>
+  80303f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803040:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803041:	74 20                	je     803063 <__rodata_start+0x16b>
+  803043:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  803045:	75 6e                	jne    8030b5 <__rodata_start+0x1bd>
+  803047:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  80304b:	76 20                	jbe    80306d <__rodata_start+0x175>
+  80304d:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  803054:	72 65                	jb     8030bb <__rodata_start+0x1c3>
+  803056:	63 76 69             	movsxd 0x69(%rsi),%esi
+  803059:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80305a:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  80305e:	65 78 70             	gs js  8030d1 <__rodata_start+0x1d9>
+  803061:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  803066:	20 65 6e             	and    %ah,0x6e(%rbp)
+  803069:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  80306d:	20 66 69             	and    %ah,0x69(%rsi)
+  803070:	6c                   	insb   (%dx),%es:(%rdi)
+  803071:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  803075:	20 66 72             	and    %ah,0x72(%rsi)
+  803078:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  80307d:	61                   	(bad)
+  80307e:	63 65 20             	movsxd 0x20(%rbp),%esp
+  803081:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803082:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803083:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  803087:	6b 00 74             	imul   $0x74,(%rax),%eax
+  80308a:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80308b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80308c:	20 6d 61             	and    %ch,0x61(%rbp)
+  80308f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803090:	79 20                	jns    8030b2 <__rodata_start+0x1ba>
+  803092:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  803099:	72 65                	jb     803100 <__rodata_start+0x208>
+  80309b:	20 6f 70             	and    %ch,0x70(%rdi)
+  80309e:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  8030a0:	00 66 69             	add    %ah,0x69(%rsi)
+  8030a3:	6c                   	insb   (%dx),%es:(%rdi)
+  8030a4:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  8030a8:	20 62 6c             	and    %ah,0x6c(%rdx)
+  8030ab:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8030ac:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  8030af:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8030b0:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8030b1:	74 20                	je     8030d3 <__rodata_start+0x1db>
+  8030b3:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  8030b5:	75 6e                	jne    803125 <__rodata_start+0x22d>
+  8030b7:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  8030bb:	76 61                	jbe    80311e <__rodata_start+0x226>
+  8030bd:	6c                   	insb   (%dx),%es:(%rdi)
+  8030be:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  8030c5:	00 
+  8030c6:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  8030cd:	72 65                	jb     803134 <__rodata_start+0x23c>
+  8030cf:	61                   	(bad)
+  8030d0:	64 79 20             	fs jns 8030f3 <__rodata_start+0x1fb>
+  8030d3:	65 78 69             	gs js  80313f <__rodata_start+0x247>
+  8030d6:	73 74                	jae    80314c <__rodata_start+0x254>
+  8030d8:	73 00                	jae    8030da <__rodata_start+0x1e2>
+  8030da:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8030db:	70 65                	jo     803142 <__rodata_start+0x24a>
+  8030dd:	72 61                	jb     803140 <__rodata_start+0x248>
+  8030df:	74 69                	je     80314a <__rodata_start+0x252>
+  8030e1:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8030e2:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8030e3:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  8030e6:	74 20                	je     803108 <__rodata_start+0x210>
+  8030e8:	73 75                	jae    80315f <__rodata_start+0x267>
+  8030ea:	70 70                	jo     80315c <__rodata_start+0x264>
+  8030ec:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8030ed:	72 74                	jb     803163 <__rodata_start+0x26b>
+  8030ef:	65 64 00 6f 70       	gs add %ch,%fs:0x70(%rdi)
+  8030f4:	65 72 61             	gs jb  803158 <__rodata_start+0x260>
+  8030f7:	74 69                	je     803162 <__rodata_start+0x26a>
+  8030f9:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8030fa:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8030fb:	20 69 6e             	and    %ch,0x6e(%rcx)
+  8030fe:	74 65                	je     803165 <__rodata_start+0x26d>
+  803100:	72 72                	jb     803174 <__rodata_start+0x27c>
+  803102:	75 70                	jne    803174 <__rodata_start+0x27c>
+  803104:	74 65                	je     80316b <__rodata_start+0x273>
+  803106:	64 00 6e 6f          	add    %ch,%fs:0x6f(%rsi)
+  80310a:	74 20                	je     80312c <__rodata_start+0x234>
+  80310c:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  80310e:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80310f:	75 67                	jne    803178 <__rodata_start+0x280>
+  803111:	68 20 43 50 55       	push   $0x55504320
+  803116:	20 74 69 6d          	and    %dh,0x6d(%rcx,%rbp,2)
+  80311a:	65 00 0f             	add    %cl,%gs:(%rdi)
+  80311d:	1f                   	(bad)
+  80311e:	40 00 4f 05          	rex add %cl,0x5(%rdi)
+  803122:	80 00 00             	addb   $0x0,(%rax)
+  803125:	00 00                	add    %al,(%rax)
+  803127:	00 90 0b 80 00 00    	add    %dl,0x800b(%rax)
+  80312d:	00 00                	add    %al,(%rax)
+  80312f:	00 80 0b 80 00 00    	add    %al,0x800b(%rax)
+  803135:	00 00                	add    %al,(%rax)
+  803137:	00 90 0b 80 00 00    	add    %dl,0x800b(%rax)
+  80313d:	00 00                	add    %al,(%rax)
+  80313f:	00 90 0b 80 00 00    	add    %dl,0x800b(%rax)
+  803145:	00 00                	add    %al,(%rax)
+  803147:	00 90 0b 80 00 00    	add    %dl,0x800b(%rax)
+  80314d:	00 00                	add    %al,(%rax)
+  80314f:	00 90 0b 80 00 00    	add    %dl,0x800b(%rax)
+  803155:	00 00                	add    %al,(%rax)
+  803157:	00 6e 05             	add    %ch,0x5(%rsi)
+  80315a:	80 00 00             	addb   $0x0,(%rax)
+  80315d:	00 00                	add    %al,(%rax)
+  80315f:	00 90 0b 80 00 00    	add    %dl,0x800b(%rax)
+  803165:	00 00                	add    %al,(%rax)
+  803167:	00 90 0b 80 00 00    	add    %dl,0x800b(%rax)
+  80316d:	00 00                	add    %al,(%rax)
+  80316f:	00 62 05             	add    %ah,0x5(%rdx)
+  803172:	80 00 00             	addb   $0x0,(%rax)
+  803175:	00 00                	add    %al,(%rax)
+  803177:	00 dc                	add    %bl,%ah
+  803179:	05 80 00 00 00       	add    $0x80,%eax
+  80317e:	00 00                	add    %al,(%rax)
+  803180:	90                   	nop
+  803181:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803187:	00 62 05             	add    %ah,0x5(%rdx)
+  80318a:	80 00 00             	addb   $0x0,(%rax)
+  80318d:	00 00                	add    %al,(%rax)
+  80318f:	00 a8 05 80 00 00    	add    %ch,0x8005(%rax)
+  803195:	00 00                	add    %al,(%rax)
+  803197:	00 a8 05 80 00 00    	add    %ch,0x8005(%rax)
+  80319d:	00 00                	add    %al,(%rax)
+  80319f:	00 a8 05 80 00 00    	add    %ch,0x8005(%rax)
+  8031a5:	00 00                	add    %al,(%rax)
+  8031a7:	00 a8 05 80 00 00    	add    %ch,0x8005(%rax)
+  8031ad:	00 00                	add    %al,(%rax)
+  8031af:	00 a8 05 80 00 00    	add    %ch,0x8005(%rax)
+  8031b5:	00 00                	add    %al,(%rax)
+  8031b7:	00 a8 05 80 00 00    	add    %ch,0x8005(%rax)
+  8031bd:	00 00                	add    %al,(%rax)
+  8031bf:	00 a8 05 80 00 00    	add    %ch,0x8005(%rax)
+  8031c5:	00 00                	add    %al,(%rax)
+  8031c7:	00 a8 05 80 00 00    	add    %ch,0x8005(%rax)
+  8031cd:	00 00                	add    %al,(%rax)
+  8031cf:	00 a8 05 80 00 00    	add    %ch,0x8005(%rax)
+  8031d5:	00 00                	add    %al,(%rax)
+  8031d7:	00 90 0b 80 00 00    	add    %dl,0x800b(%rax)
+  8031dd:	00 00                	add    %al,(%rax)
+  8031df:	00 90 0b 80 00 00    	add    %dl,0x800b(%rax)
+  8031e5:	00 00                	add    %al,(%rax)
+  8031e7:	00 90 0b 80 00 00    	add    %dl,0x800b(%rax)
+  8031ed:	00 00                	add    %al,(%rax)
+  8031ef:	00 90 0b 80 00 00    	add    %dl,0x800b(%rax)
+  8031f5:	00 00                	add    %al,(%rax)
+  8031f7:	00 90 0b 80 00 00    	add    %dl,0x800b(%rax)
+  8031fd:	00 00                	add    %al,(%rax)
+  8031ff:	00 90 0b 80 00 00    	add    %dl,0x800b(%rax)
+  803205:	00 00                	add    %al,(%rax)
+  803207:	00 90 0b 80 00 00    	add    %dl,0x800b(%rax)
+  80320d:	00 00                	add    %al,(%rax)
+  80320f:	00 90 0b 80 00 00    	add    %dl,0x800b(%rax)
+  803215:	00 00                	add    %al,(%rax)
+  803217:	00 90 0b 80 00 00    	add    %dl,0x800b(%rax)
+  80321d:	00 00                	add    %al,(%rax)
+  80321f:	00 90 0b 80 00 00    	add    %dl,0x800b(%rax)
+  803225:	00 00                	add    %al,(%rax)
+  803227:	00 90 0b 80 00 00    	add    %dl,0x800b(%rax)
+  80322d:	00 00                	add    %al,(%rax)
+  80322f:	00 90 0b 80 00 00    	add    %dl,0x800b(%rax)
+  803235:	00 00                	add    %al,(%rax)
+  803237:	00 90 0b 80 00 00    	add    %dl,0x800b(%rax)
+  80323d:	00 00                	add    %al,(%rax)
+  80323f:	00 90 0b 80 00 00    	add    %dl,0x800b(%rax)
+  803245:	00 00                	add    %al,(%rax)
+  803247:	00 90 0b 80 00 00    	add    %dl,0x800b(%rax)
+  80324d:	00 00                	add    %al,(%rax)
+  80324f:	00 90 0b 80 00 00    	add    %dl,0x800b(%rax)
+  803255:	00 00                	add    %al,(%rax)
+  803257:	00 90 0b 80 00 00    	add    %dl,0x800b(%rax)
+  80325d:	00 00                	add    %al,(%rax)
+  80325f:	00 90 0b 80 00 00    	add    %dl,0x800b(%rax)
+  803265:	00 00                	add    %al,(%rax)
+  803267:	00 90 0b 80 00 00    	add    %dl,0x800b(%rax)
+  80326d:	00 00                	add    %al,(%rax)
+  80326f:	00 90 0b 80 00 00    	add    %dl,0x800b(%rax)
+  803275:	00 00                	add    %al,(%rax)
+  803277:	00 90 0b 80 00 00    	add    %dl,0x800b(%rax)
+  80327d:	00 00                	add    %al,(%rax)
+  80327f:	00 90 0b 80 00 00    	add    %dl,0x800b(%rax)
+  803285:	00 00                	add    %al,(%rax)
+  803287:	00 90 0b 80 00 00    	add    %dl,0x800b(%rax)
+  80328d:	00 00                	add    %al,(%rax)
+  80328f:	00 90 0b 80 00 00    	add    %dl,0x800b(%rax)
+  803295:	00 00                	add    %al,(%rax)
+  803297:	00 90 0b 80 00 00    	add    %dl,0x800b(%rax)
+  80329d:	00 00                	add    %al,(%rax)
+  80329f:	00 90 0b 80 00 00    	add    %dl,0x800b(%rax)
+  8032a5:	00 00                	add    %al,(%rax)
+  8032a7:	00 90 0b 80 00 00    	add    %dl,0x800b(%rax)
+  8032ad:	00 00                	add    %al,(%rax)
+  8032af:	00 90 0b 80 00 00    	add    %dl,0x800b(%rax)
+  8032b5:	00 00                	add    %al,(%rax)
+  8032b7:	00 90 0b 80 00 00    	add    %dl,0x800b(%rax)
+  8032bd:	00 00                	add    %al,(%rax)
+  8032bf:	00 90 0b 80 00 00    	add    %dl,0x800b(%rax)
+  8032c5:	00 00                	add    %al,(%rax)
+  8032c7:	00 b3 0a 80 00 00    	add    %dh,0x800a(%rbx)
+  8032cd:	00 00                	add    %al,(%rax)
+  8032cf:	00 90 0b 80 00 00    	add    %dl,0x800b(%rax)
+  8032d5:	00 00                	add    %al,(%rax)
+  8032d7:	00 90 0b 80 00 00    	add    %dl,0x800b(%rax)
+  8032dd:	00 00                	add    %al,(%rax)
+  8032df:	00 90 0b 80 00 00    	add    %dl,0x800b(%rax)
+  8032e5:	00 00                	add    %al,(%rax)
+  8032e7:	00 90 0b 80 00 00    	add    %dl,0x800b(%rax)
+  8032ed:	00 00                	add    %al,(%rax)
+  8032ef:	00 90 0b 80 00 00    	add    %dl,0x800b(%rax)
+  8032f5:	00 00                	add    %al,(%rax)
+  8032f7:	00 90 0b 80 00 00    	add    %dl,0x800b(%rax)
+  8032fd:	00 00                	add    %al,(%rax)
+  8032ff:	00 90 0b 80 00 00    	add    %dl,0x800b(%rax)
+  803305:	00 00                	add    %al,(%rax)
+  803307:	00 90 0b 80 00 00    	add    %dl,0x800b(%rax)
+  80330d:	00 00                	add    %al,(%rax)
+  80330f:	00 90 0b 80 00 00    	add    %dl,0x800b(%rax)
+  803315:	00 00                	add    %al,(%rax)
+  803317:	00 90 0b 80 00 00    	add    %dl,0x800b(%rax)
+  80331d:	00 00                	add    %al,(%rax)
+  80331f:	00 ff                	add    %bh,%bh
+  803321:	05 80 00 00 00       	add    $0x80,%eax
+  803326:	00 00                	add    %al,(%rax)
+  803328:	ce                   	(bad)
+  803329:	07                   	(bad)
+  80332a:	80 00 00             	addb   $0x0,(%rax)
+  80332d:	00 00                	add    %al,(%rax)
+  80332f:	00 90 0b 80 00 00    	add    %dl,0x800b(%rax)
+  803335:	00 00                	add    %al,(%rax)
+  803337:	00 90 0b 80 00 00    	add    %dl,0x800b(%rax)
+  80333d:	00 00                	add    %al,(%rax)
+  80333f:	00 90 0b 80 00 00    	add    %dl,0x800b(%rax)
+  803345:	00 00                	add    %al,(%rax)
+  803347:	00 90 0b 80 00 00    	add    %dl,0x800b(%rax)
+  80334d:	00 00                	add    %al,(%rax)
+  80334f:	00 2e                	add    %ch,(%rsi)
+  803351:	06                   	(bad)
+  803352:	80 00 00             	addb   $0x0,(%rax)
+  803355:	00 00                	add    %al,(%rax)
+  803357:	00 90 0b 80 00 00    	add    %dl,0x800b(%rax)
+  80335d:	00 00                	add    %al,(%rax)
+  80335f:	00 90 0b 80 00 00    	add    %dl,0x800b(%rax)
+  803365:	00 00                	add    %al,(%rax)
+  803367:	00 f4                	add    %dh,%ah
+  803369:	05 80 00 00 00       	add    $0x80,%eax
+  80336e:	00 00                	add    %al,(%rax)
+  803370:	90                   	nop
+  803371:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803377:	00 90 0b 80 00 00    	add    %dl,0x800b(%rax)
+  80337d:	00 00                	add    %al,(%rax)
+  80337f:	00 76 09             	add    %dh,0x9(%rsi)
+  803382:	80 00 00             	addb   $0x0,(%rax)
+  803385:	00 00                	add    %al,(%rax)
+  803387:	00 40 0a             	add    %al,0xa(%rax)
+  80338a:	80 00 00             	addb   $0x0,(%rax)
+  80338d:	00 00                	add    %al,(%rax)
+  80338f:	00 90 0b 80 00 00    	add    %dl,0x800b(%rax)
+  803395:	00 00                	add    %al,(%rax)
+  803397:	00 90 0b 80 00 00    	add    %dl,0x800b(%rax)
+  80339d:	00 00                	add    %al,(%rax)
+  80339f:	00 c5                	add    %al,%ch
+  8033a1:	06                   	(bad)
+  8033a2:	80 00 00             	addb   $0x0,(%rax)
+  8033a5:	00 00                	add    %al,(%rax)
+  8033a7:	00 90 0b 80 00 00    	add    %dl,0x800b(%rax)
+  8033ad:	00 00                	add    %al,(%rax)
+  8033af:	00 a2 08 80 00 00    	add    %ah,0x8008(%rdx)
+  8033b5:	00 00                	add    %al,(%rax)
+  8033b7:	00 90 0b 80 00 00    	add    %dl,0x800b(%rax)
+  8033bd:	00 00                	add    %al,(%rax)
+  8033bf:	00 90 0b 80 00 00    	add    %dl,0x800b(%rax)
+  8033c5:	00 00                	add    %al,(%rax)
+  8033c7:	00 b3 0a 80 00 00    	add    %dh,0x800a(%rbx)
+  8033cd:	00 00                	add    %al,(%rax)
+  8033cf:	00 90 0b 80 00 00    	add    %dl,0x800b(%rax)
+  8033d5:	00 00                	add    %al,(%rax)
+  8033d7:	00 58 05             	add    %bl,0x5(%rax)
+  8033da:	80 00 00             	addb   $0x0,(%rax)
+  8033dd:	00 00                	add    %al,(%rax)
+	...
+
+00000000008033e0 <error_string>:
+	...
+  8033e8:	95 2f 80 00 00 00 00 00 a7 2f 80 00 00 00 00 00     ./......./......
+  8033f8:	b7 2f 80 00 00 00 00 00 c9 2f 80 00 00 00 00 00     ./......./......
+  803408:	d7 2f 80 00 00 00 00 00 eb 2f 80 00 00 00 00 00     ./......./......
+  803418:	00 30 80 00 00 00 00 00 13 30 80 00 00 00 00 00     .0.......0......
+  803428:	25 30 80 00 00 00 00 00 39 30 80 00 00 00 00 00     %0......90......
+  803438:	49 30 80 00 00 00 00 00 5c 30 80 00 00 00 00 00     I0......\0......
+  803448:	73 30 80 00 00 00 00 00 89 30 80 00 00 00 00 00     s0.......0......
+  803458:	a1 30 80 00 00 00 00 00 b9 30 80 00 00 00 00 00     .0.......0......
+  803468:	c6 30 80 00 00 00 00 00 90 34 80 00 00 00 00 00     .0.......4......
+  803478:	da 30 80 00 00 00 00 00 f2 30 80 00 00 00 00 00     .0.......0......
+  803488:	08 31 80 00 00 00 00 00 66 69 6c 65 20 69 73 20     .1......file is 
+  803498:	6e 6f 74 20 61 20 76 61 6c 69 64 20 65 78 65 63     not a valid exec
+  8034a8:	75 74 61 62 6c 65 00 90 73 79 73 63 61 6c 6c 20     utable..syscall 
+  8034b8:	25 7a 64 20 72 65 74 75 72 6e 65 64 20 25 7a 64     %zd returned %zd
+  8034c8:	20 28 3e 20 30 29 00 6c 69 62 2f 73 79 73 63 61      (> 0).lib/sysca
+  8034d8:	6c 6c 2e 63 00 46 6f 72 6b 20 64 6f 75 62 6c 65     ll.c.Fork double
+  8034e8:	20 66 61 75 6c 74 00 6c 69 62 2f 66 6f 72 6b 2e      fault.lib/fork.
+  8034f8:	63 00 73 66 6f 72 6b 28 29 20 69 73 20 6e 6f 74     c.sfork() is not
+  803508:	20 69 6d 70 6c 65 6d 65 6e 74 65 64 00 0f 1f 00      implemented....
+  803518:	5b 25 30 38 78 5d 20 75 6e 6b 6e 6f 77 6e 20 64     [%08x] unknown d
+  803528:	65 76 69 63 65 20 74 79 70 65 20 25 64 0a 00 00     evice type %d...
+  803538:	5b 25 30 38 78 5d 20 66 74 72 75 6e 63 61 74 65     [%08x] ftruncate
+  803548:	20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65 0a      %d -- bad mode.
+  803558:	00 5b 25 30 38 78 5d 20 72 65 61 64 20 25 64 20     .[%08x] read %d 
+  803568:	2d 2d 20 62 61 64 20 6d 6f 64 65 0a 00 5b 25 30     -- bad mode..[%0
+  803578:	38 78 5d 20 77 72 69 74 65 20 25 64 20 2d 2d 20     8x] write %d -- 
+  803588:	62 61 64 20 6d 6f 64 65 0a 00 66 2e 0f 1f 84 00     bad mode..f.....
+  803598:	00 00 00 00 0f 1f 40 00                             ......@.
+
+00000000008035a0 <devtab>:
+  8035a0:	20 40 80 00 00 00 00 00 60 40 80 00 00 00 00 00      @......`@......
+  8035b0:	a0 40 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .@..............
+  8035c0:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  8035d0:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  8035e0:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  8035f0:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  803600:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  803610:	3d 20 32 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73 00     = 2.<cons>.cons.
+  803620:	73 79 73 5f 69 70 63 5f 74 72 79 5f 73 65 6e 64     sys_ipc_try_send
+  803630:	20 66 61 69 6c 65 64 3a 20 25 69 00 6c 69 62 2f      failed: %i.lib/
+  803640:	69 70 63 2e 63 00 66 2e 0f 1f 84 00 00 00 00 00     ipc.c.f.........
+  803650:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803660:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803670:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803680:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803690:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8036a0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8036b0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8036c0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8036d0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8036e0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8036f0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803700:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803710:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803720:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803730:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803740:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803750:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803760:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803770:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803780:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803790:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8037a0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8037b0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8037c0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8037d0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8037e0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8037f0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803800:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803810:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803820:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803830:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803840:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803850:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803860:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803870:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803880:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803890:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8038a0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8038b0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8038c0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8038d0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8038e0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8038f0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803900:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803910:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803920:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803930:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803940:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803950:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803960:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803970:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803980:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803990:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8039a0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8039b0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8039c0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8039d0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8039e0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8039f0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803a00:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803a10:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803a20:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803a30:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803a40:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803a50:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803a60:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803a70:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803a80:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803a90:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803aa0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803ab0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803ac0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803ad0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803ae0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803af0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803b00:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803b10:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803b20:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803b30:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803b40:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803b50:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803b60:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803b70:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803b80:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803b90:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803ba0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803bb0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803bc0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803bd0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803be0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803bf0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803c00:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803c10:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803c20:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803c30:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803c40:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803c50:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803c60:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803c70:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803c80:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803c90:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803ca0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803cb0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803cc0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803cd0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803ce0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803cf0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803d00:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803d10:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803d20:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803d30:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803d40:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803d50:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803d60:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803d70:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803d80:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803d90:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803da0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803db0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803dc0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803dd0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803de0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803df0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803e00:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803e10:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803e20:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803e30:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803e40:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803e50:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803e60:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803e70:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803e80:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803e90:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803ea0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803eb0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803ec0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803ed0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803ee0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803ef0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803f00:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803f10:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803f20:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803f30:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803f40:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803f50:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803f60:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803f70:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803f80:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803f90:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803fa0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803fb0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803fc0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803fd0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803fe0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803ff0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
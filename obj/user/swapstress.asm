@@ -0,0 +1,6208 @@
+
+obj/user/swapstress:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 d8 02 00 00       	call   8002fb <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <check>:
+#define STRESS_SIZE_MB 1024
+
+static size_t
+check(uint64_t *buf, size_t size, uint64_t seed) {
+    size_t bad = 0;
+    for (size_t i = 0; i < size; i += PAGE_SIZE)
+  800025:	48 85 f6             	test   %rsi,%rsi
+  800028:	74 2a                	je     800054 <check+0x2f>
+  80002a:	b8 00 00 00 00       	mov    $0x0,%eax
+    size_t bad = 0;
+  80002f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800035:	eb 0b                	jmp    800042 <check+0x1d>
+    for (size_t i = 0; i < size; i += PAGE_SIZE)
+  800037:	48 05 00 10 00 00    	add    $0x1000,%rax
+  80003d:	48 39 f0             	cmp    %rsi,%rax
+  800040:	73 15                	jae    800057 <check+0x32>
+        if (buf[i / sizeof *buf] != (i ^ seed)) bad++;
+  800042:	48 89 d1             	mov    %rdx,%rcx
+  800045:	48 31 c1             	xor    %rax,%rcx
+  800048:	48 39 0c 07          	cmp    %rcx,(%rdi,%rax,1)
+  80004c:	74 e9                	je     800037 <check+0x12>
+  80004e:	49 83 c0 01          	add    $0x1,%r8
+  800052:	eb e3                	jmp    800037 <check+0x12>
+    size_t bad = 0;
+  800054:	49 89 f0             	mov    %rsi,%r8
+    return bad;
+}
+  800057:	4c 89 c0             	mov    %r8,%rax
+  80005a:	c3                   	ret
+
+000000000080005b <umain>:
+
+void
+umain(int argc, char **argv) {
+  80005b:	55                   	push   %rbp
+  80005c:	48 89 e5             	mov    %rsp,%rbp
+  80005f:	41 56                	push   %r14
+  800061:	41 55                	push   %r13
+  800063:	41 54                	push   %r12
+  800065:	53                   	push   %rbx
+    size_t size_mb = argc > 1 ? strtol(argv[1], NULL, 0) : STRESS_SIZE_MB;
+  800066:	41 be 00 04 00 00    	mov    $0x400,%r14d
+  80006c:	83 ff 01             	cmp    $0x1,%edi
+  80006f:	0f 8f 85 01 00 00    	jg     8001fa <umain+0x19f>
+    size_t size = size_mb * 1024 * 1024;
+  800075:	4c 89 f3             	mov    %r14,%rbx
+  800078:	48 c1 e3 14          	shl    $0x14,%rbx
+    uint64_t *buf = (uint64_t *)STRESS_BASE;
+
+    int res = sys_alloc_region(CURENVID, buf, size, PROT_RW | ALLOC_ZERO);
+  80007c:	b9 06 00 10 00       	mov    $0x100006,%ecx
+  800081:	48 89 da             	mov    %rbx,%rdx
+  800084:	48 be 00 00 00 00 01 	movabs $0x100000000,%rsi
+  80008b:	00 00 00 
+  80008e:	bf 00 00 00 00       	mov    $0x0,%edi
+  800093:	48 b8 ec 13 80 00 00 	movabs $0x8013ec,%rax
+  80009a:	00 00 00 
+  80009d:	ff d0                	call   *%rax
+    if (res < 0) panic("sys_alloc_region: %i", res);
+  80009f:	85 c0                	test   %eax,%eax
+  8000a1:	0f 88 75 01 00 00    	js     80021c <umain+0x1c1>
+}
+
+static inline uint64_t __attribute__((always_inline))
+read_tsc(void) {
+    uint32_t lo, hi;
+    asm volatile("rdtsc"
+  8000a7:	0f 31                	rdtsc
+                 : "=a"(lo), "=d"(hi));
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  8000a9:	48 c1 e2 20          	shl    $0x20,%rdx
+  8000ad:	89 c0                	mov    %eax,%eax
+  8000af:	48 09 c2             	or     %rax,%rdx
+  8000b2:	49 89 d4             	mov    %rdx,%r12
+
+    uint64_t start = read_tsc();
+    for (size_t i = 0; i < size; i += PAGE_SIZE)
+  8000b5:	48 85 db             	test   %rbx,%rbx
+  8000b8:	74 28                	je     8000e2 <umain+0x87>
+  8000ba:	b8 00 00 00 00       	mov    $0x0,%eax
+        buf[i / sizeof *buf] = i ^ 0x5A5A5A5A;
+  8000bf:	48 b9 00 00 00 00 01 	movabs $0x100000000,%rcx
+  8000c6:	00 00 00 
+  8000c9:	48 89 c2             	mov    %rax,%rdx
+  8000cc:	48 81 f2 5a 5a 5a 5a 	xor    $0x5a5a5a5a,%rdx
+  8000d3:	48 89 14 08          	mov    %rdx,(%rax,%rcx,1)
+    for (size_t i = 0; i < size; i += PAGE_SIZE)
+  8000d7:	48 05 00 10 00 00    	add    $0x1000,%rax
+  8000dd:	48 39 d8             	cmp    %rbx,%rax
+  8000e0:	72 e7                	jb     8000c9 <umain+0x6e>
+    size_t bad = check(buf, size, 0x5A5A5A5A);
+  8000e2:	ba 5a 5a 5a 5a       	mov    $0x5a5a5a5a,%edx
+  8000e7:	48 89 de             	mov    %rbx,%rsi
+  8000ea:	48 bf 00 00 00 00 01 	movabs $0x100000000,%rdi
+  8000f1:	00 00 00 
+  8000f4:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8000fb:	00 00 00 
+  8000fe:	ff d0                	call   *%rax
+  800100:	49 89 c5             	mov    %rax,%r13
+    asm volatile("rdtsc"
+  800103:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  800105:	48 c1 e2 20          	shl    $0x20,%rdx
+  800109:	89 c0                	mov    %eax,%eax
+  80010b:	48 09 c2             	or     %rax,%rdx
+    cprintf("swapstress: %lu MB written and checked in %lu cycles, %lu bad pages\n",
+            (unsigned long)size_mb, (unsigned long)(read_tsc() - start), (unsigned long)bad);
+  80010e:	4c 29 e2             	sub    %r12,%rdx
+    cprintf("swapstress: %lu MB written and checked in %lu cycles, %lu bad pages\n",
+  800111:	4c 89 e9             	mov    %r13,%rcx
+  800114:	4c 89 f6             	mov    %r14,%rsi
+  800117:	48 bf d0 31 80 00 00 	movabs $0x8031d0,%rdi
+  80011e:	00 00 00 
+  800121:	b8 00 00 00 00       	mov    $0x0,%eax
+  800126:	49 b8 17 05 80 00 00 	movabs $0x800517,%r8
+  80012d:	00 00 00 
+  800130:	41 ff d0             	call   *%r8
+
+    envid_t child = fork();
+  800133:	48 b8 27 18 80 00 00 	movabs $0x801827,%rax
+  80013a:	00 00 00 
+  80013d:	ff d0                	call   *%rax
+    if (child < 0) panic("fork: %i", child);
+  80013f:	85 c0                	test   %eax,%eax
+  800141:	0f 88 02 01 00 00    	js     800249 <umain+0x1ee>
+
+    /* Child overwrites every other page, so some of
+     * swapped pages stay shared and some are copied */
+    if (!child) {
+  800147:	0f 85 29 01 00 00    	jne    800276 <umain+0x21b>
+        for (size_t i = 0; i < size; i += 2 * PAGE_SIZE)
+  80014d:	48 85 db             	test   %rbx,%rbx
+  800150:	74 4b                	je     80019d <umain+0x142>
+  800152:	48 8d 53 ff          	lea    -0x1(%rbx),%rdx
+  800156:	48 c1 ea 0d          	shr    $0xd,%rdx
+  80015a:	48 81 c2 01 00 08 00 	add    $0x80001,%rdx
+  800161:	48 c1 e2 0d          	shl    $0xd,%rdx
+  800165:	48 b8 00 00 00 00 01 	movabs $0x100000000,%rax
+  80016c:	00 00 00 
+            buf[i / sizeof *buf] ^= 0x5A5A5A5A;
+  80016f:	48 81 30 5a 5a 5a 5a 	xorq   $0x5a5a5a5a,(%rax)
+        for (size_t i = 0; i < size; i += 2 * PAGE_SIZE)
+  800176:	48 05 00 20 00 00    	add    $0x2000,%rax
+  80017c:	48 39 c2             	cmp    %rax,%rdx
+  80017f:	75 ee                	jne    80016f <umain+0x114>
+  800181:	48 b8 00 00 00 00 01 	movabs $0x100000000,%rax
+  800188:	00 00 00 
+        for (size_t i = 0; i < size; i += 2 * PAGE_SIZE)
+            buf[i / sizeof *buf] ^= 0x5A5A5A5A;
+  80018b:	48 81 30 5a 5a 5a 5a 	xorq   $0x5a5a5a5a,(%rax)
+        for (size_t i = 0; i < size; i += 2 * PAGE_SIZE)
+  800192:	48 05 00 20 00 00    	add    $0x2000,%rax
+  800198:	48 39 c2             	cmp    %rax,%rdx
+  80019b:	75 ee                	jne    80018b <umain+0x130>
+        bad += check(buf, size, 0x5A5A5A5A);
+  80019d:	ba 5a 5a 5a 5a       	mov    $0x5a5a5a5a,%edx
+  8001a2:	48 89 de             	mov    %rbx,%rsi
+  8001a5:	48 bf 00 00 00 00 01 	movabs $0x100000000,%rdi
+  8001ac:	00 00 00 
+  8001af:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8001b6:	00 00 00 
+  8001b9:	ff d0                	call   *%rax
+        cprintf("swapstress: child %s\n", bad ? "FAILED" : "OK");
+  8001bb:	4c 01 e8             	add    %r13,%rax
+  8001be:	48 be 6f 31 80 00 00 	movabs $0x80316f,%rsi
+  8001c5:	00 00 00 
+  8001c8:	48 b8 68 31 80 00 00 	movabs $0x803168,%rax
+  8001cf:	00 00 00 
+  8001d2:	48 0f 45 f0          	cmovne %rax,%rsi
+  8001d6:	48 bf a2 31 80 00 00 	movabs $0x8031a2,%rdi
+  8001dd:	00 00 00 
+  8001e0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001e5:	48 ba 17 05 80 00 00 	movabs $0x800517,%rdx
+  8001ec:	00 00 00 
+  8001ef:	ff d2                	call   *%rdx
+    wait(child);
+    bad += check(buf, size, 0x5A5A5A5A);
+    cprintf("swapstress: parent %s\n", bad ? "FAILED" : "OK");
+
+    sys_unmap_region(CURENVID, buf, size);
+}
+  8001f1:	5b                   	pop    %rbx
+  8001f2:	41 5c                	pop    %r12
+  8001f4:	41 5d                	pop    %r13
+  8001f6:	41 5e                	pop    %r14
+  8001f8:	5d                   	pop    %rbp
+  8001f9:	c3                   	ret
+    size_t size_mb = argc > 1 ? strtol(argv[1], NULL, 0) : STRESS_SIZE_MB;
+  8001fa:	48 8b 7e 08          	mov    0x8(%rsi),%rdi
+  8001fe:	ba 00 00 00 00       	mov    $0x0,%edx
+  800203:	be 00 00 00 00       	mov    $0x0,%esi
+  800208:	48 b8 ad 11 80 00 00 	movabs $0x8011ad,%rax
+  80020f:	00 00 00 
+  800212:	ff d0                	call   *%rax
+  800214:	49 89 c6             	mov    %rax,%r14
+  800217:	e9 59 fe ff ff       	jmp    800075 <umain+0x1a>
+    if (res < 0) panic("sys_alloc_region: %i", res);
+  80021c:	89 c1                	mov    %eax,%ecx
+  80021e:	48 ba 72 31 80 00 00 	movabs $0x803172,%rdx
+  800225:	00 00 00 
+  800228:	be 1e 00 00 00       	mov    $0x1e,%esi
+  80022d:	48 bf 87 31 80 00 00 	movabs $0x803187,%rdi
+  800234:	00 00 00 
+  800237:	b8 00 00 00 00       	mov    $0x0,%eax
+  80023c:	49 b8 c7 03 80 00 00 	movabs $0x8003c7,%r8
+  800243:	00 00 00 
+  800246:	41 ff d0             	call   *%r8
+    if (child < 0) panic("fork: %i", child);
+  800249:	89 c1                	mov    %eax,%ecx
+  80024b:	48 ba 99 31 80 00 00 	movabs $0x803199,%rdx
+  800252:	00 00 00 
+  800255:	be 28 00 00 00       	mov    $0x28,%esi
+  80025a:	48 bf 87 31 80 00 00 	movabs $0x803187,%rdi
+  800261:	00 00 00 
+  800264:	b8 00 00 00 00       	mov    $0x0,%eax
+  800269:	49 b8 c7 03 80 00 00 	movabs $0x8003c7,%r8
+  800270:	00 00 00 
+  800273:	41 ff d0             	call   *%r8
+    wait(child);
+  800276:	89 c7                	mov    %eax,%edi
+  800278:	48 b8 0e 2a 80 00 00 	movabs $0x802a0e,%rax
+  80027f:	00 00 00 
+  800282:	ff d0                	call   *%rax
+    bad += check(buf, size, 0x5A5A5A5A);
+  800284:	ba 5a 5a 5a 5a       	mov    $0x5a5a5a5a,%edx
+  800289:	48 89 de             	mov    %rbx,%rsi
+  80028c:	48 bf 00 00 00 00 01 	movabs $0x100000000,%rdi
+  800293:	00 00 00 
+  800296:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  80029d:	00 00 00 
+  8002a0:	ff d0                	call   *%rax
+    cprintf("swapstress: parent %s\n", bad ? "FAILED" : "OK");
+  8002a2:	4c 01 e8             	add    %r13,%rax
+  8002a5:	48 be 6f 31 80 00 00 	movabs $0x80316f,%rsi
+  8002ac:	00 00 00 
+  8002af:	48 b8 68 31 80 00 00 	movabs $0x803168,%rax
+  8002b6:	00 00 00 
+  8002b9:	48 0f 45 f0          	cmovne %rax,%rsi
+  8002bd:	48 bf b8 31 80 00 00 	movabs $0x8031b8,%rdi
+  8002c4:	00 00 00 
+  8002c7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002cc:	48 ba 17 05 80 00 00 	movabs $0x800517,%rdx
+  8002d3:	00 00 00 
+  8002d6:	ff d2                	call   *%rdx
+    sys_unmap_region(CURENVID, buf, size);
+  8002d8:	48 89 da             	mov    %rbx,%rdx
+  8002db:	48 be 00 00 00 00 01 	movabs $0x100000000,%rsi
+  8002e2:	00 00 00 
+  8002e5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8002ea:	48 b8 b8 14 80 00 00 	movabs $0x8014b8,%rax
+  8002f1:	00 00 00 
+  8002f4:	ff d0                	call   *%rax
+  8002f6:	e9 f6 fe ff ff       	jmp    8001f1 <umain+0x196>
+
+00000000008002fb <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  8002fb:	55                   	push   %rbp
+  8002fc:	48 89 e5             	mov    %rsp,%rbp
+  8002ff:	41 56                	push   %r14
+  800301:	41 55                	push   %r13
+  800303:	41 54                	push   %r12
+  800305:	53                   	push   %rbx
+  800306:	41 89 fd             	mov    %edi,%r13d
+  800309:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  80030c:	48 ba d8 40 80 00 00 	movabs $0x8040d8,%rdx
+  800313:	00 00 00 
+  800316:	48 b8 d8 40 80 00 00 	movabs $0x8040d8,%rax
+  80031d:	00 00 00 
+  800320:	48 39 c2             	cmp    %rax,%rdx
+  800323:	73 17                	jae    80033c <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  800325:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  800328:	49 89 c4             	mov    %rax,%r12
+  80032b:	48 83 c3 08          	add    $0x8,%rbx
+  80032f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800334:	ff 53 f8             	call   *-0x8(%rbx)
+  800337:	4c 39 e3             	cmp    %r12,%rbx
+  80033a:	72 ef                	jb     80032b <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+    envid_t this_env_id = sys_getenvid();
+  80033c:	48 b8 2c 13 80 00 00 	movabs $0x80132c,%rax
+  800343:	00 00 00 
+  800346:	ff d0                	call   *%rax
+    thisenv = &((struct Env*)UENVS)[ENVX(this_env_id)];
+  800348:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80034d:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+  800354:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  80035b:	00 00 00 
+  80035e:	48 01 d0             	add    %rdx,%rax
+  800361:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  800368:	00 00 00 
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  80036b:	45 85 ed             	test   %r13d,%r13d
+  80036e:	7e 0d                	jle    80037d <libmain+0x82>
+  800370:	49 8b 06             	mov    (%r14),%rax
+  800373:	48 a3 00 40 80 00 00 	movabs %rax,0x804000
+  80037a:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  80037d:	4c 89 f6             	mov    %r14,%rsi
+  800380:	44 89 ef             	mov    %r13d,%edi
+  800383:	48 b8 5b 00 80 00 00 	movabs $0x80005b,%rax
+  80038a:	00 00 00 
+  80038d:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  80038f:	48 b8 a4 03 80 00 00 	movabs $0x8003a4,%rax
+  800396:	00 00 00 
+  800399:	ff d0                	call   *%rax
+#endif
+}
+  80039b:	5b                   	pop    %rbx
+  80039c:	41 5c                	pop    %r12
+  80039e:	41 5d                	pop    %r13
+  8003a0:	41 5e                	pop    %r14
+  8003a2:	5d                   	pop    %rbp
+  8003a3:	c3                   	ret
+
+00000000008003a4 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8003a4:	55                   	push   %rbp
+  8003a5:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  8003a8:	48 b8 e4 1b 80 00 00 	movabs $0x801be4,%rax
+  8003af:	00 00 00 
+  8003b2:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  8003b4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8003b9:	48 b8 c1 12 80 00 00 	movabs $0x8012c1,%rax
+  8003c0:	00 00 00 
+  8003c3:	ff d0                	call   *%rax
+}
+  8003c5:	5d                   	pop    %rbp
+  8003c6:	c3                   	ret
+
+00000000008003c7 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  8003c7:	55                   	push   %rbp
+  8003c8:	48 89 e5             	mov    %rsp,%rbp
+  8003cb:	41 56                	push   %r14
+  8003cd:	41 55                	push   %r13
+  8003cf:	41 54                	push   %r12
+  8003d1:	53                   	push   %rbx
+  8003d2:	48 83 ec 50          	sub    $0x50,%rsp
+  8003d6:	49 89 fc             	mov    %rdi,%r12
+  8003d9:	41 89 f5             	mov    %esi,%r13d
+  8003dc:	48 89 d3             	mov    %rdx,%rbx
+  8003df:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  8003e3:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  8003e7:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  8003eb:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  8003f2:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8003f6:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  8003fa:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  8003fe:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  800402:	48 b8 00 40 80 00 00 	movabs $0x804000,%rax
+  800409:	00 00 00 
+  80040c:	4c 8b 30             	mov    (%rax),%r14
+  80040f:	48 b8 2c 13 80 00 00 	movabs $0x80132c,%rax
+  800416:	00 00 00 
+  800419:	ff d0                	call   *%rax
+  80041b:	89 c6                	mov    %eax,%esi
+  80041d:	45 89 e8             	mov    %r13d,%r8d
+  800420:	4c 89 e1             	mov    %r12,%rcx
+  800423:	4c 89 f2             	mov    %r14,%rdx
+  800426:	48 bf 20 32 80 00 00 	movabs $0x803220,%rdi
+  80042d:	00 00 00 
+  800430:	b8 00 00 00 00       	mov    $0x0,%eax
+  800435:	49 bc 17 05 80 00 00 	movabs $0x800517,%r12
+  80043c:	00 00 00 
+  80043f:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  800442:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  800446:	48 89 df             	mov    %rbx,%rdi
+  800449:	48 b8 b3 04 80 00 00 	movabs $0x8004b3,%rax
+  800450:	00 00 00 
+  800453:	ff d0                	call   *%rax
+    cprintf("\n");
+  800455:	48 bf 53 38 80 00 00 	movabs $0x803853,%rdi
+  80045c:	00 00 00 
+  80045f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800464:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  800467:	cc                   	int3
+  800468:	eb fd                	jmp    800467 <_panic+0xa0>
+
+000000000080046a <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  80046a:	55                   	push   %rbp
+  80046b:	48 89 e5             	mov    %rsp,%rbp
+  80046e:	53                   	push   %rbx
+  80046f:	48 83 ec 08          	sub    $0x8,%rsp
+  800473:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  800476:	8b 06                	mov    (%rsi),%eax
+  800478:	8d 50 01             	lea    0x1(%rax),%edx
+  80047b:	89 16                	mov    %edx,(%rsi)
+  80047d:	48 98                	cltq
+  80047f:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  800484:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  80048a:	74 0a                	je     800496 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  80048c:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  800490:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800494:	c9                   	leave
+  800495:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  800496:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  80049a:	be ff 00 00 00       	mov    $0xff,%esi
+  80049f:	48 b8 63 12 80 00 00 	movabs $0x801263,%rax
+  8004a6:	00 00 00 
+  8004a9:	ff d0                	call   *%rax
+        state->offset = 0;
+  8004ab:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  8004b1:	eb d9                	jmp    80048c <putch+0x22>
+
+00000000008004b3 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  8004b3:	55                   	push   %rbp
+  8004b4:	48 89 e5             	mov    %rsp,%rbp
+  8004b7:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  8004be:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  8004c1:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  8004c8:	b9 21 00 00 00       	mov    $0x21,%ecx
+  8004cd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004d2:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  8004d5:	48 89 f1             	mov    %rsi,%rcx
+  8004d8:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  8004df:	48 bf 6a 04 80 00 00 	movabs $0x80046a,%rdi
+  8004e6:	00 00 00 
+  8004e9:	48 b8 67 06 80 00 00 	movabs $0x800667,%rax
+  8004f0:	00 00 00 
+  8004f3:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  8004f5:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  8004fc:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  800503:	48 b8 63 12 80 00 00 	movabs $0x801263,%rax
+  80050a:	00 00 00 
+  80050d:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  80050f:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  800515:	c9                   	leave
+  800516:	c3                   	ret
+
+0000000000800517 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  800517:	55                   	push   %rbp
+  800518:	48 89 e5             	mov    %rsp,%rbp
+  80051b:	48 83 ec 50          	sub    $0x50,%rsp
+  80051f:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  800523:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  800527:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80052b:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80052f:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  800533:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  80053a:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80053e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800542:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800546:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  80054a:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  80054e:	48 b8 b3 04 80 00 00 	movabs $0x8004b3,%rax
+  800555:	00 00 00 
+  800558:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  80055a:	c9                   	leave
+  80055b:	c3                   	ret
+
+000000000080055c <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  80055c:	55                   	push   %rbp
+  80055d:	48 89 e5             	mov    %rsp,%rbp
+  800560:	41 57                	push   %r15
+  800562:	41 56                	push   %r14
+  800564:	41 55                	push   %r13
+  800566:	41 54                	push   %r12
+  800568:	53                   	push   %rbx
+  800569:	48 83 ec 18          	sub    $0x18,%rsp
+  80056d:	49 89 fc             	mov    %rdi,%r12
+  800570:	49 89 f5             	mov    %rsi,%r13
+  800573:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800577:	8b 45 10             	mov    0x10(%rbp),%eax
+  80057a:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  80057d:	41 89 cf             	mov    %ecx,%r15d
+  800580:	4c 39 fa             	cmp    %r15,%rdx
+  800583:	73 5b                	jae    8005e0 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  800585:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  800589:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  80058d:	85 db                	test   %ebx,%ebx
+  80058f:	7e 0e                	jle    80059f <print_num+0x43>
+            putch(padc, put_arg);
+  800591:	4c 89 ee             	mov    %r13,%rsi
+  800594:	44 89 f7             	mov    %r14d,%edi
+  800597:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  80059a:	83 eb 01             	sub    $0x1,%ebx
+  80059d:	75 f2                	jne    800591 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  80059f:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  8005a3:	48 b9 54 32 80 00 00 	movabs $0x803254,%rcx
+  8005aa:	00 00 00 
+  8005ad:	48 b8 43 32 80 00 00 	movabs $0x803243,%rax
+  8005b4:	00 00 00 
+  8005b7:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  8005bb:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8005bf:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005c4:	49 f7 f7             	div    %r15
+  8005c7:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  8005cb:	4c 89 ee             	mov    %r13,%rsi
+  8005ce:	41 ff d4             	call   *%r12
+}
+  8005d1:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8005d5:	5b                   	pop    %rbx
+  8005d6:	41 5c                	pop    %r12
+  8005d8:	41 5d                	pop    %r13
+  8005da:	41 5e                	pop    %r14
+  8005dc:	41 5f                	pop    %r15
+  8005de:	5d                   	pop    %rbp
+  8005df:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  8005e0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8005e4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005e9:	49 f7 f7             	div    %r15
+  8005ec:	48 83 ec 08          	sub    $0x8,%rsp
+  8005f0:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  8005f4:	52                   	push   %rdx
+  8005f5:	45 0f be c9          	movsbl %r9b,%r9d
+  8005f9:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  8005fd:	48 89 c2             	mov    %rax,%rdx
+  800600:	48 b8 5c 05 80 00 00 	movabs $0x80055c,%rax
+  800607:	00 00 00 
+  80060a:	ff d0                	call   *%rax
+  80060c:	48 83 c4 10          	add    $0x10,%rsp
+  800610:	eb 8d                	jmp    80059f <print_num+0x43>
+
+0000000000800612 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  800612:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  800616:	48 8b 06             	mov    (%rsi),%rax
+  800619:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  80061d:	73 0a                	jae    800629 <sprintputch+0x17>
+        *state->start++ = ch;
+  80061f:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800623:	48 89 16             	mov    %rdx,(%rsi)
+  800626:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  800629:	c3                   	ret
+
+000000000080062a <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  80062a:	55                   	push   %rbp
+  80062b:	48 89 e5             	mov    %rsp,%rbp
+  80062e:	48 83 ec 50          	sub    $0x50,%rsp
+  800632:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800636:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80063a:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  80063e:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800645:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800649:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80064d:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800651:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  800655:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800659:	48 b8 67 06 80 00 00 	movabs $0x800667,%rax
+  800660:	00 00 00 
+  800663:	ff d0                	call   *%rax
+}
+  800665:	c9                   	leave
+  800666:	c3                   	ret
+
+0000000000800667 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  800667:	55                   	push   %rbp
+  800668:	48 89 e5             	mov    %rsp,%rbp
+  80066b:	41 57                	push   %r15
+  80066d:	41 56                	push   %r14
+  80066f:	41 55                	push   %r13
+  800671:	41 54                	push   %r12
+  800673:	53                   	push   %rbx
+  800674:	48 83 ec 38          	sub    $0x38,%rsp
+  800678:	49 89 fe             	mov    %rdi,%r14
+  80067b:	49 89 f5             	mov    %rsi,%r13
+  80067e:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  800681:	48 8b 01             	mov    (%rcx),%rax
+  800684:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  800688:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  80068c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800690:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  800694:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  800698:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  80069c:	0f b6 3b             	movzbl (%rbx),%edi
+  80069f:	40 80 ff 25          	cmp    $0x25,%dil
+  8006a3:	74 18                	je     8006bd <vprintfmt+0x56>
+            if (!ch) return;
+  8006a5:	40 84 ff             	test   %dil,%dil
+  8006a8:	0f 84 b1 06 00 00    	je     800d5f <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  8006ae:	40 0f b6 ff          	movzbl %dil,%edi
+  8006b2:	4c 89 ee             	mov    %r13,%rsi
+  8006b5:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  8006b8:	4c 89 e3             	mov    %r12,%rbx
+  8006bb:	eb db                	jmp    800698 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  8006bd:	be 00 00 00 00       	mov    $0x0,%esi
+  8006c2:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  8006c6:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  8006cb:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8006d1:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  8006d8:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8006dc:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  8006e1:	41 0f b6 04 24       	movzbl (%r12),%eax
+  8006e6:	88 45 a0             	mov    %al,-0x60(%rbp)
+  8006e9:	83 e8 23             	sub    $0x23,%eax
+  8006ec:	3c 57                	cmp    $0x57,%al
+  8006ee:	0f 87 51 06 00 00    	ja     800d45 <vprintfmt+0x6de>
+  8006f4:	0f b6 c0             	movzbl %al,%eax
+  8006f7:	48 b9 00 34 80 00 00 	movabs $0x803400,%rcx
+  8006fe:	00 00 00 
+  800701:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  800704:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  800707:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  80070b:	eb cf                	jmp    8006dc <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  80070d:	49 89 dc             	mov    %rbx,%r12
+  800710:	be 01 00 00 00       	mov    $0x1,%esi
+  800715:	eb c5                	jmp    8006dc <vprintfmt+0x75>
+            padc = ch;
+  800717:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  80071b:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  80071e:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800721:	eb b9                	jmp    8006dc <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800723:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800726:	83 f8 2f             	cmp    $0x2f,%eax
+  800729:	77 24                	ja     80074f <vprintfmt+0xe8>
+  80072b:	89 c1                	mov    %eax,%ecx
+  80072d:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  800731:	83 c0 08             	add    $0x8,%eax
+  800734:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800737:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  80073a:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  80073d:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800741:	79 99                	jns    8006dc <vprintfmt+0x75>
+                width = precision;
+  800743:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  800747:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  80074d:	eb 8d                	jmp    8006dc <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  80074f:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  800753:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  800757:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80075b:	eb da                	jmp    800737 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  80075d:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  800762:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800766:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  80076c:	3c 39                	cmp    $0x39,%al
+  80076e:	77 1c                	ja     80078c <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  800770:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  800774:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  800778:	0f b6 c0             	movzbl %al,%eax
+  80077b:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800780:	0f b6 03             	movzbl (%rbx),%eax
+  800783:	3c 39                	cmp    $0x39,%al
+  800785:	76 e9                	jbe    800770 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  800787:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  80078a:	eb b1                	jmp    80073d <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  80078c:	49 89 dc             	mov    %rbx,%r12
+  80078f:	eb ac                	jmp    80073d <vprintfmt+0xd6>
+            width = MAX(0, width);
+  800791:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  800794:	85 c9                	test   %ecx,%ecx
+  800796:	b8 00 00 00 00       	mov    $0x0,%eax
+  80079b:	0f 49 c1             	cmovns %ecx,%eax
+  80079e:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  8007a1:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8007a4:	e9 33 ff ff ff       	jmp    8006dc <vprintfmt+0x75>
+            lflag++;
+  8007a9:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  8007ac:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8007af:	e9 28 ff ff ff       	jmp    8006dc <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  8007b4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007b7:	83 f8 2f             	cmp    $0x2f,%eax
+  8007ba:	77 19                	ja     8007d5 <vprintfmt+0x16e>
+  8007bc:	89 c2                	mov    %eax,%edx
+  8007be:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007c2:	83 c0 08             	add    $0x8,%eax
+  8007c5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007c8:	8b 3a                	mov    (%rdx),%edi
+  8007ca:	4c 89 ee             	mov    %r13,%rsi
+  8007cd:	41 ff d6             	call   *%r14
+            break;
+  8007d0:	e9 c3 fe ff ff       	jmp    800698 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  8007d5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007d9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007dd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007e1:	eb e5                	jmp    8007c8 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  8007e3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007e6:	83 f8 2f             	cmp    $0x2f,%eax
+  8007e9:	77 5a                	ja     800845 <vprintfmt+0x1de>
+  8007eb:	89 c2                	mov    %eax,%edx
+  8007ed:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007f1:	83 c0 08             	add    $0x8,%eax
+  8007f4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  8007f7:	8b 02                	mov    (%rdx),%eax
+  8007f9:	89 c1                	mov    %eax,%ecx
+  8007fb:	f7 d9                	neg    %ecx
+  8007fd:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  800800:	83 f9 15             	cmp    $0x15,%ecx
+  800803:	7f 4e                	jg     800853 <vprintfmt+0x1ec>
+  800805:	48 63 c1             	movslq %ecx,%rax
+  800808:	48 ba c0 36 80 00 00 	movabs $0x8036c0,%rdx
+  80080f:	00 00 00 
+  800812:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  800816:	48 85 c0             	test   %rax,%rax
+  800819:	74 38                	je     800853 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  80081b:	48 89 c1             	mov    %rax,%rcx
+  80081e:	48 ba b9 38 80 00 00 	movabs $0x8038b9,%rdx
+  800825:	00 00 00 
+  800828:	4c 89 ee             	mov    %r13,%rsi
+  80082b:	4c 89 f7             	mov    %r14,%rdi
+  80082e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800833:	49 b8 2a 06 80 00 00 	movabs $0x80062a,%r8
+  80083a:	00 00 00 
+  80083d:	41 ff d0             	call   *%r8
+  800840:	e9 53 fe ff ff       	jmp    800698 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  800845:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800849:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80084d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800851:	eb a4                	jmp    8007f7 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  800853:	48 ba 6c 32 80 00 00 	movabs $0x80326c,%rdx
+  80085a:	00 00 00 
+  80085d:	4c 89 ee             	mov    %r13,%rsi
+  800860:	4c 89 f7             	mov    %r14,%rdi
+  800863:	b8 00 00 00 00       	mov    $0x0,%eax
+  800868:	49 b8 2a 06 80 00 00 	movabs $0x80062a,%r8
+  80086f:	00 00 00 
+  800872:	41 ff d0             	call   *%r8
+  800875:	e9 1e fe ff ff       	jmp    800698 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  80087a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80087d:	83 f8 2f             	cmp    $0x2f,%eax
+  800880:	77 6c                	ja     8008ee <vprintfmt+0x287>
+  800882:	89 c2                	mov    %eax,%edx
+  800884:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800888:	83 c0 08             	add    $0x8,%eax
+  80088b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80088e:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  800891:	48 85 d2             	test   %rdx,%rdx
+  800894:	48 b8 65 32 80 00 00 	movabs $0x803265,%rax
+  80089b:	00 00 00 
+  80089e:	48 0f 45 c2          	cmovne %rdx,%rax
+  8008a2:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  8008a6:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8008aa:	7e 06                	jle    8008b2 <vprintfmt+0x24b>
+  8008ac:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  8008b0:	75 4a                	jne    8008fc <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8008b2:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8008b6:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8008ba:	0f b6 00             	movzbl (%rax),%eax
+  8008bd:	84 c0                	test   %al,%al
+  8008bf:	0f 85 9a 00 00 00    	jne    80095f <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  8008c5:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8008c8:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  8008cc:	85 c0                	test   %eax,%eax
+  8008ce:	0f 8e c4 fd ff ff    	jle    800698 <vprintfmt+0x31>
+  8008d4:	4c 89 ee             	mov    %r13,%rsi
+  8008d7:	bf 20 00 00 00       	mov    $0x20,%edi
+  8008dc:	41 ff d6             	call   *%r14
+  8008df:	41 83 ec 01          	sub    $0x1,%r12d
+  8008e3:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  8008e7:	75 eb                	jne    8008d4 <vprintfmt+0x26d>
+  8008e9:	e9 aa fd ff ff       	jmp    800698 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8008ee:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008f2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008f6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008fa:	eb 92                	jmp    80088e <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  8008fc:	49 63 f7             	movslq %r15d,%rsi
+  8008ff:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  800903:	48 b8 19 0e 80 00 00 	movabs $0x800e19,%rax
+  80090a:	00 00 00 
+  80090d:	ff d0                	call   *%rax
+  80090f:	48 89 c2             	mov    %rax,%rdx
+  800912:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800915:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  800917:	8d 70 ff             	lea    -0x1(%rax),%esi
+  80091a:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  80091d:	85 c0                	test   %eax,%eax
+  80091f:	7e 91                	jle    8008b2 <vprintfmt+0x24b>
+  800921:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  800926:	4c 89 ee             	mov    %r13,%rsi
+  800929:	44 89 e7             	mov    %r12d,%edi
+  80092c:	41 ff d6             	call   *%r14
+  80092f:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800933:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800936:	83 f8 ff             	cmp    $0xffffffff,%eax
+  800939:	75 eb                	jne    800926 <vprintfmt+0x2bf>
+  80093b:	e9 72 ff ff ff       	jmp    8008b2 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800940:	0f b6 f8             	movzbl %al,%edi
+  800943:	4c 89 ee             	mov    %r13,%rsi
+  800946:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800949:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  80094d:	49 83 c4 01          	add    $0x1,%r12
+  800951:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  800957:	84 c0                	test   %al,%al
+  800959:	0f 84 66 ff ff ff    	je     8008c5 <vprintfmt+0x25e>
+  80095f:	45 85 ff             	test   %r15d,%r15d
+  800962:	78 0a                	js     80096e <vprintfmt+0x307>
+  800964:	41 83 ef 01          	sub    $0x1,%r15d
+  800968:	0f 88 57 ff ff ff    	js     8008c5 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  80096e:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  800972:	74 cc                	je     800940 <vprintfmt+0x2d9>
+  800974:	8d 50 e0             	lea    -0x20(%rax),%edx
+  800977:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  80097c:	80 fa 5e             	cmp    $0x5e,%dl
+  80097f:	77 c2                	ja     800943 <vprintfmt+0x2dc>
+  800981:	eb bd                	jmp    800940 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  800983:	40 84 f6             	test   %sil,%sil
+  800986:	75 26                	jne    8009ae <vprintfmt+0x347>
+    switch (lflag) {
+  800988:	85 d2                	test   %edx,%edx
+  80098a:	74 59                	je     8009e5 <vprintfmt+0x37e>
+  80098c:	83 fa 01             	cmp    $0x1,%edx
+  80098f:	74 7b                	je     800a0c <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  800991:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800994:	83 f8 2f             	cmp    $0x2f,%eax
+  800997:	0f 87 96 00 00 00    	ja     800a33 <vprintfmt+0x3cc>
+  80099d:	89 c2                	mov    %eax,%edx
+  80099f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009a3:	83 c0 08             	add    $0x8,%eax
+  8009a6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009a9:	4c 8b 22             	mov    (%rdx),%r12
+  8009ac:	eb 17                	jmp    8009c5 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  8009ae:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009b1:	83 f8 2f             	cmp    $0x2f,%eax
+  8009b4:	77 21                	ja     8009d7 <vprintfmt+0x370>
+  8009b6:	89 c2                	mov    %eax,%edx
+  8009b8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009bc:	83 c0 08             	add    $0x8,%eax
+  8009bf:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009c2:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  8009c5:	4d 85 e4             	test   %r12,%r12
+  8009c8:	78 7a                	js     800a44 <vprintfmt+0x3dd>
+            num = i;
+  8009ca:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  8009cd:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  8009d2:	e9 50 02 00 00       	jmp    800c27 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8009d7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009db:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009df:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009e3:	eb dd                	jmp    8009c2 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  8009e5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009e8:	83 f8 2f             	cmp    $0x2f,%eax
+  8009eb:	77 11                	ja     8009fe <vprintfmt+0x397>
+  8009ed:	89 c2                	mov    %eax,%edx
+  8009ef:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009f3:	83 c0 08             	add    $0x8,%eax
+  8009f6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009f9:	4c 63 22             	movslq (%rdx),%r12
+  8009fc:	eb c7                	jmp    8009c5 <vprintfmt+0x35e>
+  8009fe:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a02:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a06:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a0a:	eb ed                	jmp    8009f9 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  800a0c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a0f:	83 f8 2f             	cmp    $0x2f,%eax
+  800a12:	77 11                	ja     800a25 <vprintfmt+0x3be>
+  800a14:	89 c2                	mov    %eax,%edx
+  800a16:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a1a:	83 c0 08             	add    $0x8,%eax
+  800a1d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a20:	4c 8b 22             	mov    (%rdx),%r12
+  800a23:	eb a0                	jmp    8009c5 <vprintfmt+0x35e>
+  800a25:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a29:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a2d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a31:	eb ed                	jmp    800a20 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  800a33:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a37:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a3b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a3f:	e9 65 ff ff ff       	jmp    8009a9 <vprintfmt+0x342>
+                putch('-', put_arg);
+  800a44:	4c 89 ee             	mov    %r13,%rsi
+  800a47:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800a4c:	41 ff d6             	call   *%r14
+                i = -i;
+  800a4f:	49 f7 dc             	neg    %r12
+  800a52:	e9 73 ff ff ff       	jmp    8009ca <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  800a57:	40 84 f6             	test   %sil,%sil
+  800a5a:	75 32                	jne    800a8e <vprintfmt+0x427>
+    switch (lflag) {
+  800a5c:	85 d2                	test   %edx,%edx
+  800a5e:	74 5d                	je     800abd <vprintfmt+0x456>
+  800a60:	83 fa 01             	cmp    $0x1,%edx
+  800a63:	0f 84 82 00 00 00    	je     800aeb <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  800a69:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a6c:	83 f8 2f             	cmp    $0x2f,%eax
+  800a6f:	0f 87 a5 00 00 00    	ja     800b1a <vprintfmt+0x4b3>
+  800a75:	89 c2                	mov    %eax,%edx
+  800a77:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a7b:	83 c0 08             	add    $0x8,%eax
+  800a7e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a81:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800a84:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  800a89:	e9 99 01 00 00       	jmp    800c27 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800a8e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a91:	83 f8 2f             	cmp    $0x2f,%eax
+  800a94:	77 19                	ja     800aaf <vprintfmt+0x448>
+  800a96:	89 c2                	mov    %eax,%edx
+  800a98:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a9c:	83 c0 08             	add    $0x8,%eax
+  800a9f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800aa2:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800aa5:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800aaa:	e9 78 01 00 00       	jmp    800c27 <vprintfmt+0x5c0>
+  800aaf:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ab3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ab7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800abb:	eb e5                	jmp    800aa2 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  800abd:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ac0:	83 f8 2f             	cmp    $0x2f,%eax
+  800ac3:	77 18                	ja     800add <vprintfmt+0x476>
+  800ac5:	89 c2                	mov    %eax,%edx
+  800ac7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800acb:	83 c0 08             	add    $0x8,%eax
+  800ace:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ad1:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800ad3:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  800ad8:	e9 4a 01 00 00       	jmp    800c27 <vprintfmt+0x5c0>
+  800add:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ae1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ae5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ae9:	eb e6                	jmp    800ad1 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  800aeb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800aee:	83 f8 2f             	cmp    $0x2f,%eax
+  800af1:	77 19                	ja     800b0c <vprintfmt+0x4a5>
+  800af3:	89 c2                	mov    %eax,%edx
+  800af5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800af9:	83 c0 08             	add    $0x8,%eax
+  800afc:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800aff:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800b02:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  800b07:	e9 1b 01 00 00       	jmp    800c27 <vprintfmt+0x5c0>
+  800b0c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b10:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b14:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b18:	eb e5                	jmp    800aff <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  800b1a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b1e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b22:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b26:	e9 56 ff ff ff       	jmp    800a81 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  800b2b:	40 84 f6             	test   %sil,%sil
+  800b2e:	75 2e                	jne    800b5e <vprintfmt+0x4f7>
+    switch (lflag) {
+  800b30:	85 d2                	test   %edx,%edx
+  800b32:	74 59                	je     800b8d <vprintfmt+0x526>
+  800b34:	83 fa 01             	cmp    $0x1,%edx
+  800b37:	74 7f                	je     800bb8 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  800b39:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b3c:	83 f8 2f             	cmp    $0x2f,%eax
+  800b3f:	0f 87 9f 00 00 00    	ja     800be4 <vprintfmt+0x57d>
+  800b45:	89 c2                	mov    %eax,%edx
+  800b47:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b4b:	83 c0 08             	add    $0x8,%eax
+  800b4e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b51:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800b54:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  800b59:	e9 c9 00 00 00       	jmp    800c27 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800b5e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b61:	83 f8 2f             	cmp    $0x2f,%eax
+  800b64:	77 19                	ja     800b7f <vprintfmt+0x518>
+  800b66:	89 c2                	mov    %eax,%edx
+  800b68:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b6c:	83 c0 08             	add    $0x8,%eax
+  800b6f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b72:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800b75:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800b7a:	e9 a8 00 00 00       	jmp    800c27 <vprintfmt+0x5c0>
+  800b7f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b83:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b87:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b8b:	eb e5                	jmp    800b72 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  800b8d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b90:	83 f8 2f             	cmp    $0x2f,%eax
+  800b93:	77 15                	ja     800baa <vprintfmt+0x543>
+  800b95:	89 c2                	mov    %eax,%edx
+  800b97:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b9b:	83 c0 08             	add    $0x8,%eax
+  800b9e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ba1:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  800ba3:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  800ba8:	eb 7d                	jmp    800c27 <vprintfmt+0x5c0>
+  800baa:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bae:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bb2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bb6:	eb e9                	jmp    800ba1 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  800bb8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bbb:	83 f8 2f             	cmp    $0x2f,%eax
+  800bbe:	77 16                	ja     800bd6 <vprintfmt+0x56f>
+  800bc0:	89 c2                	mov    %eax,%edx
+  800bc2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800bc6:	83 c0 08             	add    $0x8,%eax
+  800bc9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800bcc:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800bcf:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  800bd4:	eb 51                	jmp    800c27 <vprintfmt+0x5c0>
+  800bd6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bda:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bde:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800be2:	eb e8                	jmp    800bcc <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  800be4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800be8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bec:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bf0:	e9 5c ff ff ff       	jmp    800b51 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  800bf5:	4c 89 ee             	mov    %r13,%rsi
+  800bf8:	bf 30 00 00 00       	mov    $0x30,%edi
+  800bfd:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800c00:	4c 89 ee             	mov    %r13,%rsi
+  800c03:	bf 78 00 00 00       	mov    $0x78,%edi
+  800c08:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800c0b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c0e:	83 f8 2f             	cmp    $0x2f,%eax
+  800c11:	77 47                	ja     800c5a <vprintfmt+0x5f3>
+  800c13:	89 c2                	mov    %eax,%edx
+  800c15:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c19:	83 c0 08             	add    $0x8,%eax
+  800c1c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c1f:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800c22:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800c27:	48 83 ec 08          	sub    $0x8,%rsp
+  800c2b:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800c2f:	0f 94 c0             	sete   %al
+  800c32:	0f b6 c0             	movzbl %al,%eax
+  800c35:	50                   	push   %rax
+  800c36:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800c3b:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800c3f:	4c 89 ee             	mov    %r13,%rsi
+  800c42:	4c 89 f7             	mov    %r14,%rdi
+  800c45:	48 b8 5c 05 80 00 00 	movabs $0x80055c,%rax
+  800c4c:	00 00 00 
+  800c4f:	ff d0                	call   *%rax
+            break;
+  800c51:	48 83 c4 10          	add    $0x10,%rsp
+  800c55:	e9 3e fa ff ff       	jmp    800698 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800c5a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c5e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c62:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c66:	eb b7                	jmp    800c1f <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  800c68:	40 84 f6             	test   %sil,%sil
+  800c6b:	75 2b                	jne    800c98 <vprintfmt+0x631>
+    switch (lflag) {
+  800c6d:	85 d2                	test   %edx,%edx
+  800c6f:	74 56                	je     800cc7 <vprintfmt+0x660>
+  800c71:	83 fa 01             	cmp    $0x1,%edx
+  800c74:	74 7f                	je     800cf5 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800c76:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c79:	83 f8 2f             	cmp    $0x2f,%eax
+  800c7c:	0f 87 a2 00 00 00    	ja     800d24 <vprintfmt+0x6bd>
+  800c82:	89 c2                	mov    %eax,%edx
+  800c84:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c88:	83 c0 08             	add    $0x8,%eax
+  800c8b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c8e:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800c91:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800c96:	eb 8f                	jmp    800c27 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800c98:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c9b:	83 f8 2f             	cmp    $0x2f,%eax
+  800c9e:	77 19                	ja     800cb9 <vprintfmt+0x652>
+  800ca0:	89 c2                	mov    %eax,%edx
+  800ca2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ca6:	83 c0 08             	add    $0x8,%eax
+  800ca9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800cac:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800caf:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800cb4:	e9 6e ff ff ff       	jmp    800c27 <vprintfmt+0x5c0>
+  800cb9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800cbd:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800cc1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800cc5:	eb e5                	jmp    800cac <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800cc7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800cca:	83 f8 2f             	cmp    $0x2f,%eax
+  800ccd:	77 18                	ja     800ce7 <vprintfmt+0x680>
+  800ccf:	89 c2                	mov    %eax,%edx
+  800cd1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800cd5:	83 c0 08             	add    $0x8,%eax
+  800cd8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800cdb:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800cdd:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800ce2:	e9 40 ff ff ff       	jmp    800c27 <vprintfmt+0x5c0>
+  800ce7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ceb:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800cef:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800cf3:	eb e6                	jmp    800cdb <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800cf5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800cf8:	83 f8 2f             	cmp    $0x2f,%eax
+  800cfb:	77 19                	ja     800d16 <vprintfmt+0x6af>
+  800cfd:	89 c2                	mov    %eax,%edx
+  800cff:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d03:	83 c0 08             	add    $0x8,%eax
+  800d06:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d09:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800d0c:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800d11:	e9 11 ff ff ff       	jmp    800c27 <vprintfmt+0x5c0>
+  800d16:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d1a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d1e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d22:	eb e5                	jmp    800d09 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800d24:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d28:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d2c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d30:	e9 59 ff ff ff       	jmp    800c8e <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800d35:	4c 89 ee             	mov    %r13,%rsi
+  800d38:	bf 25 00 00 00       	mov    $0x25,%edi
+  800d3d:	41 ff d6             	call   *%r14
+            break;
+  800d40:	e9 53 f9 ff ff       	jmp    800698 <vprintfmt+0x31>
+            putch('%', put_arg);
+  800d45:	4c 89 ee             	mov    %r13,%rsi
+  800d48:	bf 25 00 00 00       	mov    $0x25,%edi
+  800d4d:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800d50:	48 83 eb 01          	sub    $0x1,%rbx
+  800d54:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800d58:	75 f6                	jne    800d50 <vprintfmt+0x6e9>
+  800d5a:	e9 39 f9 ff ff       	jmp    800698 <vprintfmt+0x31>
+}
+  800d5f:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800d63:	5b                   	pop    %rbx
+  800d64:	41 5c                	pop    %r12
+  800d66:	41 5d                	pop    %r13
+  800d68:	41 5e                	pop    %r14
+  800d6a:	41 5f                	pop    %r15
+  800d6c:	5d                   	pop    %rbp
+  800d6d:	c3                   	ret
+
+0000000000800d6e <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800d6e:	55                   	push   %rbp
+  800d6f:	48 89 e5             	mov    %rsp,%rbp
+  800d72:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800d76:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800d7a:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800d7f:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800d83:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800d8a:	48 85 ff             	test   %rdi,%rdi
+  800d8d:	74 2b                	je     800dba <vsnprintf+0x4c>
+  800d8f:	48 85 f6             	test   %rsi,%rsi
+  800d92:	74 26                	je     800dba <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800d94:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800d98:	48 bf 12 06 80 00 00 	movabs $0x800612,%rdi
+  800d9f:	00 00 00 
+  800da2:	48 b8 67 06 80 00 00 	movabs $0x800667,%rax
+  800da9:	00 00 00 
+  800dac:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800dae:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800db2:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800db5:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800db8:	c9                   	leave
+  800db9:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800dba:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800dbf:	eb f7                	jmp    800db8 <vsnprintf+0x4a>
+
+0000000000800dc1 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800dc1:	55                   	push   %rbp
+  800dc2:	48 89 e5             	mov    %rsp,%rbp
+  800dc5:	48 83 ec 50          	sub    $0x50,%rsp
+  800dc9:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800dcd:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800dd1:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800dd5:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800ddc:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800de0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800de4:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800de8:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800dec:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800df0:	48 b8 6e 0d 80 00 00 	movabs $0x800d6e,%rax
+  800df7:	00 00 00 
+  800dfa:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800dfc:	c9                   	leave
+  800dfd:	c3                   	ret
+
+0000000000800dfe <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800dfe:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800e01:	74 10                	je     800e13 <strlen+0x15>
+    size_t n = 0;
+  800e03:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800e08:	48 83 c0 01          	add    $0x1,%rax
+  800e0c:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800e10:	75 f6                	jne    800e08 <strlen+0xa>
+  800e12:	c3                   	ret
+    size_t n = 0;
+  800e13:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800e18:	c3                   	ret
+
+0000000000800e19 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800e19:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800e1c:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800e21:	48 85 f6             	test   %rsi,%rsi
+  800e24:	74 11                	je     800e37 <strnlen+0x1e>
+  800e26:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800e2a:	74 0c                	je     800e38 <strnlen+0x1f>
+  800e2c:	48 83 c2 01          	add    $0x1,%rdx
+  800e30:	48 39 d0             	cmp    %rdx,%rax
+  800e33:	75 f1                	jne    800e26 <strnlen+0xd>
+  800e35:	eb 04                	jmp    800e3b <strnlen+0x22>
+  800e37:	c3                   	ret
+  800e38:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800e3b:	c3                   	ret
+
+0000000000800e3c <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800e3c:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800e3f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e44:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800e48:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800e4b:	48 83 c2 01          	add    $0x1,%rdx
+  800e4f:	84 c9                	test   %cl,%cl
+  800e51:	75 f1                	jne    800e44 <strcpy+0x8>
+        ;
+    return res;
+}
+  800e53:	c3                   	ret
+
+0000000000800e54 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800e54:	55                   	push   %rbp
+  800e55:	48 89 e5             	mov    %rsp,%rbp
+  800e58:	41 54                	push   %r12
+  800e5a:	53                   	push   %rbx
+  800e5b:	48 89 fb             	mov    %rdi,%rbx
+  800e5e:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800e61:	48 b8 fe 0d 80 00 00 	movabs $0x800dfe,%rax
+  800e68:	00 00 00 
+  800e6b:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800e6d:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800e71:	4c 89 e6             	mov    %r12,%rsi
+  800e74:	48 b8 3c 0e 80 00 00 	movabs $0x800e3c,%rax
+  800e7b:	00 00 00 
+  800e7e:	ff d0                	call   *%rax
+    return dst;
+}
+  800e80:	48 89 d8             	mov    %rbx,%rax
+  800e83:	5b                   	pop    %rbx
+  800e84:	41 5c                	pop    %r12
+  800e86:	5d                   	pop    %rbp
+  800e87:	c3                   	ret
+
+0000000000800e88 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800e88:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800e8b:	48 85 d2             	test   %rdx,%rdx
+  800e8e:	74 1f                	je     800eaf <strncpy+0x27>
+  800e90:	48 01 fa             	add    %rdi,%rdx
+  800e93:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800e96:	48 83 c1 01          	add    $0x1,%rcx
+  800e9a:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800e9e:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800ea2:	41 80 f8 01          	cmp    $0x1,%r8b
+  800ea6:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800eaa:	48 39 ca             	cmp    %rcx,%rdx
+  800ead:	75 e7                	jne    800e96 <strncpy+0xe>
+    }
+    return ret;
+}
+  800eaf:	c3                   	ret
+
+0000000000800eb0 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800eb0:	48 89 f8             	mov    %rdi,%rax
+  800eb3:	48 85 d2             	test   %rdx,%rdx
+  800eb6:	74 24                	je     800edc <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800eb8:	48 83 ea 01          	sub    $0x1,%rdx
+  800ebc:	74 1b                	je     800ed9 <strlcpy+0x29>
+  800ebe:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800ec2:	0f b6 16             	movzbl (%rsi),%edx
+  800ec5:	84 d2                	test   %dl,%dl
+  800ec7:	74 10                	je     800ed9 <strlcpy+0x29>
+            *dst++ = *src++;
+  800ec9:	48 83 c6 01          	add    $0x1,%rsi
+  800ecd:	48 83 c0 01          	add    $0x1,%rax
+  800ed1:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800ed4:	48 39 c8             	cmp    %rcx,%rax
+  800ed7:	75 e9                	jne    800ec2 <strlcpy+0x12>
+        *dst = '\0';
+  800ed9:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800edc:	48 29 f8             	sub    %rdi,%rax
+}
+  800edf:	c3                   	ret
+
+0000000000800ee0 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800ee0:	0f b6 07             	movzbl (%rdi),%eax
+  800ee3:	84 c0                	test   %al,%al
+  800ee5:	74 13                	je     800efa <strcmp+0x1a>
+  800ee7:	38 06                	cmp    %al,(%rsi)
+  800ee9:	75 0f                	jne    800efa <strcmp+0x1a>
+  800eeb:	48 83 c7 01          	add    $0x1,%rdi
+  800eef:	48 83 c6 01          	add    $0x1,%rsi
+  800ef3:	0f b6 07             	movzbl (%rdi),%eax
+  800ef6:	84 c0                	test   %al,%al
+  800ef8:	75 ed                	jne    800ee7 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800efa:	0f b6 c0             	movzbl %al,%eax
+  800efd:	0f b6 16             	movzbl (%rsi),%edx
+  800f00:	29 d0                	sub    %edx,%eax
+}
+  800f02:	c3                   	ret
+
+0000000000800f03 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800f03:	48 85 d2             	test   %rdx,%rdx
+  800f06:	74 1f                	je     800f27 <strncmp+0x24>
+  800f08:	0f b6 07             	movzbl (%rdi),%eax
+  800f0b:	84 c0                	test   %al,%al
+  800f0d:	74 1e                	je     800f2d <strncmp+0x2a>
+  800f0f:	3a 06                	cmp    (%rsi),%al
+  800f11:	75 1a                	jne    800f2d <strncmp+0x2a>
+  800f13:	48 83 c7 01          	add    $0x1,%rdi
+  800f17:	48 83 c6 01          	add    $0x1,%rsi
+  800f1b:	48 83 ea 01          	sub    $0x1,%rdx
+  800f1f:	75 e7                	jne    800f08 <strncmp+0x5>
+
+    if (!n) return 0;
+  800f21:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f26:	c3                   	ret
+  800f27:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f2c:	c3                   	ret
+  800f2d:	48 85 d2             	test   %rdx,%rdx
+  800f30:	74 09                	je     800f3b <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800f32:	0f b6 07             	movzbl (%rdi),%eax
+  800f35:	0f b6 16             	movzbl (%rsi),%edx
+  800f38:	29 d0                	sub    %edx,%eax
+  800f3a:	c3                   	ret
+    if (!n) return 0;
+  800f3b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800f40:	c3                   	ret
+
+0000000000800f41 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800f41:	0f b6 17             	movzbl (%rdi),%edx
+  800f44:	84 d2                	test   %dl,%dl
+  800f46:	74 18                	je     800f60 <strchr+0x1f>
+        if (*str == c) {
+  800f48:	0f be d2             	movsbl %dl,%edx
+  800f4b:	39 f2                	cmp    %esi,%edx
+  800f4d:	74 17                	je     800f66 <strchr+0x25>
+    for (; *str; str++) {
+  800f4f:	48 83 c7 01          	add    $0x1,%rdi
+  800f53:	0f b6 17             	movzbl (%rdi),%edx
+  800f56:	84 d2                	test   %dl,%dl
+  800f58:	75 ee                	jne    800f48 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800f5a:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f5f:	c3                   	ret
+  800f60:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f65:	c3                   	ret
+  800f66:	48 89 f8             	mov    %rdi,%rax
+}
+  800f69:	c3                   	ret
+
+0000000000800f6a <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800f6a:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800f6d:	0f b6 17             	movzbl (%rdi),%edx
+  800f70:	84 d2                	test   %dl,%dl
+  800f72:	74 13                	je     800f87 <strfind+0x1d>
+  800f74:	0f be d2             	movsbl %dl,%edx
+  800f77:	39 f2                	cmp    %esi,%edx
+  800f79:	74 0b                	je     800f86 <strfind+0x1c>
+  800f7b:	48 83 c0 01          	add    $0x1,%rax
+  800f7f:	0f b6 10             	movzbl (%rax),%edx
+  800f82:	84 d2                	test   %dl,%dl
+  800f84:	75 ee                	jne    800f74 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800f86:	c3                   	ret
+  800f87:	c3                   	ret
+
+0000000000800f88 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800f88:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800f8b:	48 89 f8             	mov    %rdi,%rax
+  800f8e:	48 f7 d8             	neg    %rax
+  800f91:	83 e0 07             	and    $0x7,%eax
+  800f94:	49 89 d1             	mov    %rdx,%r9
+  800f97:	49 29 c1             	sub    %rax,%r9
+  800f9a:	78 36                	js     800fd2 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800f9c:	40 0f b6 c6          	movzbl %sil,%eax
+  800fa0:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800fa7:	01 01 01 
+  800faa:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800fae:	40 f6 c7 07          	test   $0x7,%dil
+  800fb2:	75 38                	jne    800fec <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800fb4:	4c 89 c9             	mov    %r9,%rcx
+  800fb7:	48 c1 f9 03          	sar    $0x3,%rcx
+  800fbb:	74 0c                	je     800fc9 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800fbd:	fc                   	cld
+  800fbe:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800fc1:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800fc5:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800fc9:	4d 85 c9             	test   %r9,%r9
+  800fcc:	75 45                	jne    801013 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800fce:	4c 89 c0             	mov    %r8,%rax
+  800fd1:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800fd2:	48 85 d2             	test   %rdx,%rdx
+  800fd5:	74 f7                	je     800fce <memset+0x46>
+  800fd7:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800fda:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800fdd:	48 83 c0 01          	add    $0x1,%rax
+  800fe1:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  800fe5:	48 39 c2             	cmp    %rax,%rdx
+  800fe8:	75 f3                	jne    800fdd <memset+0x55>
+  800fea:	eb e2                	jmp    800fce <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  800fec:	40 f6 c7 01          	test   $0x1,%dil
+  800ff0:	74 06                	je     800ff8 <memset+0x70>
+  800ff2:	88 07                	mov    %al,(%rdi)
+  800ff4:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800ff8:	40 f6 c7 02          	test   $0x2,%dil
+  800ffc:	74 07                	je     801005 <memset+0x7d>
+  800ffe:	66 89 07             	mov    %ax,(%rdi)
+  801001:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  801005:	40 f6 c7 04          	test   $0x4,%dil
+  801009:	74 a9                	je     800fb4 <memset+0x2c>
+  80100b:	89 07                	mov    %eax,(%rdi)
+  80100d:	48 83 c7 04          	add    $0x4,%rdi
+  801011:	eb a1                	jmp    800fb4 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  801013:	41 f6 c1 04          	test   $0x4,%r9b
+  801017:	74 06                	je     80101f <memset+0x97>
+  801019:	89 07                	mov    %eax,(%rdi)
+  80101b:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  80101f:	41 f6 c1 02          	test   $0x2,%r9b
+  801023:	74 07                	je     80102c <memset+0xa4>
+  801025:	66 89 07             	mov    %ax,(%rdi)
+  801028:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  80102c:	41 f6 c1 01          	test   $0x1,%r9b
+  801030:	74 9c                	je     800fce <memset+0x46>
+  801032:	88 07                	mov    %al,(%rdi)
+  801034:	eb 98                	jmp    800fce <memset+0x46>
+
+0000000000801036 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  801036:	48 89 f8             	mov    %rdi,%rax
+  801039:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  80103c:	48 39 fe             	cmp    %rdi,%rsi
+  80103f:	73 3b                	jae    80107c <memmove+0x46>
+  801041:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  801045:	48 39 d7             	cmp    %rdx,%rdi
+  801048:	73 32                	jae    80107c <memmove+0x46>
+        s += n;
+        d += n;
+  80104a:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  80104e:	48 89 d6             	mov    %rdx,%rsi
+  801051:	48 09 fe             	or     %rdi,%rsi
+  801054:	48 09 ce             	or     %rcx,%rsi
+  801057:	40 f6 c6 07          	test   $0x7,%sil
+  80105b:	75 12                	jne    80106f <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  80105d:	48 83 ef 08          	sub    $0x8,%rdi
+  801061:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  801065:	48 c1 e9 03          	shr    $0x3,%rcx
+  801069:	fd                   	std
+  80106a:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  80106d:	fc                   	cld
+  80106e:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  80106f:	48 83 ef 01          	sub    $0x1,%rdi
+  801073:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  801077:	fd                   	std
+  801078:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  80107a:	eb f1                	jmp    80106d <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  80107c:	48 89 f2             	mov    %rsi,%rdx
+  80107f:	48 09 c2             	or     %rax,%rdx
+  801082:	48 09 ca             	or     %rcx,%rdx
+  801085:	f6 c2 07             	test   $0x7,%dl
+  801088:	75 0c                	jne    801096 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  80108a:	48 c1 e9 03          	shr    $0x3,%rcx
+  80108e:	48 89 c7             	mov    %rax,%rdi
+  801091:	fc                   	cld
+  801092:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  801095:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  801096:	48 89 c7             	mov    %rax,%rdi
+  801099:	fc                   	cld
+  80109a:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  80109c:	c3                   	ret
+
+000000000080109d <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  80109d:	55                   	push   %rbp
+  80109e:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  8010a1:	48 b8 36 10 80 00 00 	movabs $0x801036,%rax
+  8010a8:	00 00 00 
+  8010ab:	ff d0                	call   *%rax
+}
+  8010ad:	5d                   	pop    %rbp
+  8010ae:	c3                   	ret
+
+00000000008010af <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  8010af:	55                   	push   %rbp
+  8010b0:	48 89 e5             	mov    %rsp,%rbp
+  8010b3:	41 57                	push   %r15
+  8010b5:	41 56                	push   %r14
+  8010b7:	41 55                	push   %r13
+  8010b9:	41 54                	push   %r12
+  8010bb:	53                   	push   %rbx
+  8010bc:	48 83 ec 08          	sub    $0x8,%rsp
+  8010c0:	49 89 fe             	mov    %rdi,%r14
+  8010c3:	49 89 f7             	mov    %rsi,%r15
+  8010c6:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  8010c9:	48 89 f7             	mov    %rsi,%rdi
+  8010cc:	48 b8 fe 0d 80 00 00 	movabs $0x800dfe,%rax
+  8010d3:	00 00 00 
+  8010d6:	ff d0                	call   *%rax
+  8010d8:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  8010db:	48 89 de             	mov    %rbx,%rsi
+  8010de:	4c 89 f7             	mov    %r14,%rdi
+  8010e1:	48 b8 19 0e 80 00 00 	movabs $0x800e19,%rax
+  8010e8:	00 00 00 
+  8010eb:	ff d0                	call   *%rax
+  8010ed:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  8010f0:	48 39 c3             	cmp    %rax,%rbx
+  8010f3:	74 36                	je     80112b <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  8010f5:	48 89 d8             	mov    %rbx,%rax
+  8010f8:	4c 29 e8             	sub    %r13,%rax
+  8010fb:	49 39 c4             	cmp    %rax,%r12
+  8010fe:	73 31                	jae    801131 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  801100:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  801105:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  801109:	4c 89 fe             	mov    %r15,%rsi
+  80110c:	48 b8 9d 10 80 00 00 	movabs $0x80109d,%rax
+  801113:	00 00 00 
+  801116:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  801118:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  80111c:	48 83 c4 08          	add    $0x8,%rsp
+  801120:	5b                   	pop    %rbx
+  801121:	41 5c                	pop    %r12
+  801123:	41 5d                	pop    %r13
+  801125:	41 5e                	pop    %r14
+  801127:	41 5f                	pop    %r15
+  801129:	5d                   	pop    %rbp
+  80112a:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  80112b:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  80112f:	eb eb                	jmp    80111c <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  801131:	48 83 eb 01          	sub    $0x1,%rbx
+  801135:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  801139:	48 89 da             	mov    %rbx,%rdx
+  80113c:	4c 89 fe             	mov    %r15,%rsi
+  80113f:	48 b8 9d 10 80 00 00 	movabs $0x80109d,%rax
+  801146:	00 00 00 
+  801149:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  80114b:	49 01 de             	add    %rbx,%r14
+  80114e:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  801153:	eb c3                	jmp    801118 <strlcat+0x69>
+
+0000000000801155 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  801155:	48 85 d2             	test   %rdx,%rdx
+  801158:	74 2d                	je     801187 <memcmp+0x32>
+  80115a:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  80115f:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  801163:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  801168:	44 38 c1             	cmp    %r8b,%cl
+  80116b:	75 0f                	jne    80117c <memcmp+0x27>
+    while (n-- > 0) {
+  80116d:	48 83 c0 01          	add    $0x1,%rax
+  801171:	48 39 c2             	cmp    %rax,%rdx
+  801174:	75 e9                	jne    80115f <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  801176:	b8 00 00 00 00       	mov    $0x0,%eax
+  80117b:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  80117c:	0f b6 c1             	movzbl %cl,%eax
+  80117f:	45 0f b6 c0          	movzbl %r8b,%r8d
+  801183:	44 29 c0             	sub    %r8d,%eax
+  801186:	c3                   	ret
+    return 0;
+  801187:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80118c:	c3                   	ret
+
+000000000080118d <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  80118d:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  801191:	48 39 c7             	cmp    %rax,%rdi
+  801194:	73 0f                	jae    8011a5 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  801196:	40 38 37             	cmp    %sil,(%rdi)
+  801199:	74 0e                	je     8011a9 <memfind+0x1c>
+    for (; src < end; src++) {
+  80119b:	48 83 c7 01          	add    $0x1,%rdi
+  80119f:	48 39 f8             	cmp    %rdi,%rax
+  8011a2:	75 f2                	jne    801196 <memfind+0x9>
+  8011a4:	c3                   	ret
+  8011a5:	48 89 f8             	mov    %rdi,%rax
+  8011a8:	c3                   	ret
+  8011a9:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  8011ac:	c3                   	ret
+
+00000000008011ad <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  8011ad:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  8011b0:	0f b6 37             	movzbl (%rdi),%esi
+  8011b3:	40 80 fe 20          	cmp    $0x20,%sil
+  8011b7:	74 06                	je     8011bf <strtol+0x12>
+  8011b9:	40 80 fe 09          	cmp    $0x9,%sil
+  8011bd:	75 13                	jne    8011d2 <strtol+0x25>
+  8011bf:	48 83 c7 01          	add    $0x1,%rdi
+  8011c3:	0f b6 37             	movzbl (%rdi),%esi
+  8011c6:	40 80 fe 20          	cmp    $0x20,%sil
+  8011ca:	74 f3                	je     8011bf <strtol+0x12>
+  8011cc:	40 80 fe 09          	cmp    $0x9,%sil
+  8011d0:	74 ed                	je     8011bf <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  8011d2:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  8011d5:	83 e0 fd             	and    $0xfffffffd,%eax
+  8011d8:	3c 01                	cmp    $0x1,%al
+  8011da:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8011de:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  8011e4:	75 0f                	jne    8011f5 <strtol+0x48>
+  8011e6:	80 3f 30             	cmpb   $0x30,(%rdi)
+  8011e9:	74 14                	je     8011ff <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  8011eb:	85 d2                	test   %edx,%edx
+  8011ed:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8011f2:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  8011f5:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  8011fa:	4c 63 ca             	movslq %edx,%r9
+  8011fd:	eb 36                	jmp    801235 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8011ff:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  801203:	74 0f                	je     801214 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  801205:	85 d2                	test   %edx,%edx
+  801207:	75 ec                	jne    8011f5 <strtol+0x48>
+        s++;
+  801209:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  80120d:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  801212:	eb e1                	jmp    8011f5 <strtol+0x48>
+        s += 2;
+  801214:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  801218:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  80121d:	eb d6                	jmp    8011f5 <strtol+0x48>
+            dig -= '0';
+  80121f:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  801222:	44 0f b6 c1          	movzbl %cl,%r8d
+  801226:	41 39 d0             	cmp    %edx,%r8d
+  801229:	7d 21                	jge    80124c <strtol+0x9f>
+        val = val * base + dig;
+  80122b:	49 0f af c1          	imul   %r9,%rax
+  80122f:	0f b6 c9             	movzbl %cl,%ecx
+  801232:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  801235:	48 83 c7 01          	add    $0x1,%rdi
+  801239:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  80123d:	80 f9 39             	cmp    $0x39,%cl
+  801240:	76 dd                	jbe    80121f <strtol+0x72>
+        else if (dig - 'a' < 27)
+  801242:	80 f9 7b             	cmp    $0x7b,%cl
+  801245:	77 05                	ja     80124c <strtol+0x9f>
+            dig -= 'a' - 10;
+  801247:	83 e9 57             	sub    $0x57,%ecx
+  80124a:	eb d6                	jmp    801222 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  80124c:	4d 85 d2             	test   %r10,%r10
+  80124f:	74 03                	je     801254 <strtol+0xa7>
+  801251:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  801254:	48 89 c2             	mov    %rax,%rdx
+  801257:	48 f7 da             	neg    %rdx
+  80125a:	40 80 fe 2d          	cmp    $0x2d,%sil
+  80125e:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  801262:	c3                   	ret
+
+0000000000801263 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  801263:	55                   	push   %rbp
+  801264:	48 89 e5             	mov    %rsp,%rbp
+  801267:	53                   	push   %rbx
+  801268:	48 89 fa             	mov    %rdi,%rdx
+  80126b:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80126e:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801273:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801278:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80127d:	be 00 00 00 00       	mov    $0x0,%esi
+  801282:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801288:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  80128a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80128e:	c9                   	leave
+  80128f:	c3                   	ret
+
+0000000000801290 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  801290:	55                   	push   %rbp
+  801291:	48 89 e5             	mov    %rsp,%rbp
+  801294:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801295:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80129a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80129f:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8012a4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012a9:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012ae:	be 00 00 00 00       	mov    $0x0,%esi
+  8012b3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8012b9:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  8012bb:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012bf:	c9                   	leave
+  8012c0:	c3                   	ret
+
+00000000008012c1 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  8012c1:	55                   	push   %rbp
+  8012c2:	48 89 e5             	mov    %rsp,%rbp
+  8012c5:	53                   	push   %rbx
+  8012c6:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  8012ca:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8012cd:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8012d2:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8012d7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012dc:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012e1:	be 00 00 00 00       	mov    $0x0,%esi
+  8012e6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8012ec:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8012ee:	48 85 c0             	test   %rax,%rax
+  8012f1:	7f 06                	jg     8012f9 <sys_env_destroy+0x38>
+}
+  8012f3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012f7:	c9                   	leave
+  8012f8:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8012f9:	49 89 c0             	mov    %rax,%r8
+  8012fc:	b9 03 00 00 00       	mov    $0x3,%ecx
+  801301:	48 ba 90 37 80 00 00 	movabs $0x803790,%rdx
+  801308:	00 00 00 
+  80130b:	be 26 00 00 00       	mov    $0x26,%esi
+  801310:	48 bf af 37 80 00 00 	movabs $0x8037af,%rdi
+  801317:	00 00 00 
+  80131a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80131f:	49 b9 c7 03 80 00 00 	movabs $0x8003c7,%r9
+  801326:	00 00 00 
+  801329:	41 ff d1             	call   *%r9
+
+000000000080132c <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  80132c:	55                   	push   %rbp
+  80132d:	48 89 e5             	mov    %rsp,%rbp
+  801330:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801331:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801336:	ba 00 00 00 00       	mov    $0x0,%edx
+  80133b:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801340:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801345:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80134a:	be 00 00 00 00       	mov    $0x0,%esi
+  80134f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801355:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  801357:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80135b:	c9                   	leave
+  80135c:	c3                   	ret
+
+000000000080135d <sys_yield>:
+
+void
+sys_yield(void) {
+  80135d:	55                   	push   %rbp
+  80135e:	48 89 e5             	mov    %rsp,%rbp
+  801361:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801362:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801367:	ba 00 00 00 00       	mov    $0x0,%edx
+  80136c:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801371:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801376:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80137b:	be 00 00 00 00       	mov    $0x0,%esi
+  801380:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801386:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  801388:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80138c:	c9                   	leave
+  80138d:	c3                   	ret
+
+000000000080138e <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  80138e:	55                   	push   %rbp
+  80138f:	48 89 e5             	mov    %rsp,%rbp
+  801392:	53                   	push   %rbx
+  801393:	48 89 fa             	mov    %rdi,%rdx
+  801396:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801399:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80139e:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  8013a5:	00 00 00 
+  8013a8:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013ad:	be 00 00 00 00       	mov    $0x0,%esi
+  8013b2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013b8:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  8013ba:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013be:	c9                   	leave
+  8013bf:	c3                   	ret
+
+00000000008013c0 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  8013c0:	55                   	push   %rbp
+  8013c1:	48 89 e5             	mov    %rsp,%rbp
+  8013c4:	53                   	push   %rbx
+  8013c5:	49 89 f8             	mov    %rdi,%r8
+  8013c8:	48 89 d3             	mov    %rdx,%rbx
+  8013cb:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8013ce:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8013d3:	4c 89 c2             	mov    %r8,%rdx
+  8013d6:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013d9:	be 00 00 00 00       	mov    $0x0,%esi
+  8013de:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013e4:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  8013e6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013ea:	c9                   	leave
+  8013eb:	c3                   	ret
+
+00000000008013ec <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  8013ec:	55                   	push   %rbp
+  8013ed:	48 89 e5             	mov    %rsp,%rbp
+  8013f0:	53                   	push   %rbx
+  8013f1:	48 83 ec 08          	sub    $0x8,%rsp
+  8013f5:	89 f8                	mov    %edi,%eax
+  8013f7:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  8013fa:	48 63 f9             	movslq %ecx,%rdi
+  8013fd:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801400:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801405:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801408:	be 00 00 00 00       	mov    $0x0,%esi
+  80140d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801413:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801415:	48 85 c0             	test   %rax,%rax
+  801418:	7f 06                	jg     801420 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  80141a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80141e:	c9                   	leave
+  80141f:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801420:	49 89 c0             	mov    %rax,%r8
+  801423:	b9 04 00 00 00       	mov    $0x4,%ecx
+  801428:	48 ba 90 37 80 00 00 	movabs $0x803790,%rdx
+  80142f:	00 00 00 
+  801432:	be 26 00 00 00       	mov    $0x26,%esi
+  801437:	48 bf af 37 80 00 00 	movabs $0x8037af,%rdi
+  80143e:	00 00 00 
+  801441:	b8 00 00 00 00       	mov    $0x0,%eax
+  801446:	49 b9 c7 03 80 00 00 	movabs $0x8003c7,%r9
+  80144d:	00 00 00 
+  801450:	41 ff d1             	call   *%r9
+
+0000000000801453 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801453:	55                   	push   %rbp
+  801454:	48 89 e5             	mov    %rsp,%rbp
+  801457:	53                   	push   %rbx
+  801458:	48 83 ec 08          	sub    $0x8,%rsp
+  80145c:	89 f8                	mov    %edi,%eax
+  80145e:	49 89 f2             	mov    %rsi,%r10
+  801461:	48 89 cf             	mov    %rcx,%rdi
+  801464:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  801467:	48 63 da             	movslq %edx,%rbx
+  80146a:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80146d:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801472:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801475:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  801478:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80147a:	48 85 c0             	test   %rax,%rax
+  80147d:	7f 06                	jg     801485 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  80147f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801483:	c9                   	leave
+  801484:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801485:	49 89 c0             	mov    %rax,%r8
+  801488:	b9 05 00 00 00       	mov    $0x5,%ecx
+  80148d:	48 ba 90 37 80 00 00 	movabs $0x803790,%rdx
+  801494:	00 00 00 
+  801497:	be 26 00 00 00       	mov    $0x26,%esi
+  80149c:	48 bf af 37 80 00 00 	movabs $0x8037af,%rdi
+  8014a3:	00 00 00 
+  8014a6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014ab:	49 b9 c7 03 80 00 00 	movabs $0x8003c7,%r9
+  8014b2:	00 00 00 
+  8014b5:	41 ff d1             	call   *%r9
+
+00000000008014b8 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  8014b8:	55                   	push   %rbp
+  8014b9:	48 89 e5             	mov    %rsp,%rbp
+  8014bc:	53                   	push   %rbx
+  8014bd:	48 83 ec 08          	sub    $0x8,%rsp
+  8014c1:	48 89 f1             	mov    %rsi,%rcx
+  8014c4:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  8014c7:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8014ca:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8014cf:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014d4:	be 00 00 00 00       	mov    $0x0,%esi
+  8014d9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014df:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8014e1:	48 85 c0             	test   %rax,%rax
+  8014e4:	7f 06                	jg     8014ec <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  8014e6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014ea:	c9                   	leave
+  8014eb:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8014ec:	49 89 c0             	mov    %rax,%r8
+  8014ef:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8014f4:	48 ba 90 37 80 00 00 	movabs $0x803790,%rdx
+  8014fb:	00 00 00 
+  8014fe:	be 26 00 00 00       	mov    $0x26,%esi
+  801503:	48 bf af 37 80 00 00 	movabs $0x8037af,%rdi
+  80150a:	00 00 00 
+  80150d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801512:	49 b9 c7 03 80 00 00 	movabs $0x8003c7,%r9
+  801519:	00 00 00 
+  80151c:	41 ff d1             	call   *%r9
+
+000000000080151f <sys_region_batch>:
+
+int
+sys_region_batch(const struct RegionOp *ops, size_t count) {
+  80151f:	55                   	push   %rbp
+  801520:	48 89 e5             	mov    %rsp,%rbp
+  801523:	53                   	push   %rbx
+  801524:	48 83 ec 08          	sub    $0x8,%rsp
+  801528:	48 89 fa             	mov    %rdi,%rdx
+  80152b:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80152e:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801533:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801538:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80153d:	be 00 00 00 00       	mov    $0x0,%esi
+  801542:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801548:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80154a:	48 85 c0             	test   %rax,%rax
+  80154d:	7f 06                	jg     801555 <sys_region_batch+0x36>
+        else
+            platform_asan_unpoison(va, ops[i].size);
+    }
+#endif
+    return res;
+}
+  80154f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801553:	c9                   	leave
+  801554:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801555:	49 89 c0             	mov    %rax,%r8
+  801558:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  80155d:	48 ba 90 37 80 00 00 	movabs $0x803790,%rdx
+  801564:	00 00 00 
+  801567:	be 26 00 00 00       	mov    $0x26,%esi
+  80156c:	48 bf af 37 80 00 00 	movabs $0x8037af,%rdi
+  801573:	00 00 00 
+  801576:	b8 00 00 00 00       	mov    $0x0,%eax
+  80157b:	49 b9 c7 03 80 00 00 	movabs $0x8003c7,%r9
+  801582:	00 00 00 
+  801585:	41 ff d1             	call   *%r9
+
+0000000000801588 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  801588:	55                   	push   %rbp
+  801589:	48 89 e5             	mov    %rsp,%rbp
+  80158c:	53                   	push   %rbx
+  80158d:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  801591:	48 63 ce             	movslq %esi,%rcx
+  801594:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801597:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80159c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015a1:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015a6:	be 00 00 00 00       	mov    $0x0,%esi
+  8015ab:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015b1:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8015b3:	48 85 c0             	test   %rax,%rax
+  8015b6:	7f 06                	jg     8015be <sys_env_set_status+0x36>
+}
+  8015b8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015bc:	c9                   	leave
+  8015bd:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8015be:	49 89 c0             	mov    %rax,%r8
+  8015c1:	b9 09 00 00 00       	mov    $0x9,%ecx
+  8015c6:	48 ba 90 37 80 00 00 	movabs $0x803790,%rdx
+  8015cd:	00 00 00 
+  8015d0:	be 26 00 00 00       	mov    $0x26,%esi
+  8015d5:	48 bf af 37 80 00 00 	movabs $0x8037af,%rdi
+  8015dc:	00 00 00 
+  8015df:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015e4:	49 b9 c7 03 80 00 00 	movabs $0x8003c7,%r9
+  8015eb:	00 00 00 
+  8015ee:	41 ff d1             	call   *%r9
+
+00000000008015f1 <sys_env_set_weight>:
+
+int
+sys_env_set_weight(envid_t envid, uint32_t weight) {
+  8015f1:	55                   	push   %rbp
+  8015f2:	48 89 e5             	mov    %rsp,%rbp
+  8015f5:	53                   	push   %rbx
+  8015f6:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_weight, 1, envid, weight, 0, 0, 0, 0);
+  8015fa:	89 f1                	mov    %esi,%ecx
+  8015fc:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8015ff:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801604:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801609:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80160e:	be 00 00 00 00       	mov    $0x0,%esi
+  801613:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801619:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80161b:	48 85 c0             	test   %rax,%rax
+  80161e:	7f 06                	jg     801626 <sys_env_set_weight+0x35>
+}
+  801620:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801624:	c9                   	leave
+  801625:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801626:	49 89 c0             	mov    %rax,%r8
+  801629:	b9 10 00 00 00       	mov    $0x10,%ecx
+  80162e:	48 ba 90 37 80 00 00 	movabs $0x803790,%rdx
+  801635:	00 00 00 
+  801638:	be 26 00 00 00       	mov    $0x26,%esi
+  80163d:	48 bf af 37 80 00 00 	movabs $0x8037af,%rdi
+  801644:	00 00 00 
+  801647:	b8 00 00 00 00       	mov    $0x0,%eax
+  80164c:	49 b9 c7 03 80 00 00 	movabs $0x8003c7,%r9
+  801653:	00 00 00 
+  801656:	41 ff d1             	call   *%r9
+
+0000000000801659 <sys_env_set_rt>:
+
+int
+sys_env_set_rt(envid_t envid, uint64_t period, uint64_t budget, uint64_t deadline) {
+  801659:	55                   	push   %rbp
+  80165a:	48 89 e5             	mov    %rsp,%rbp
+  80165d:	53                   	push   %rbx
+  80165e:	48 83 ec 08          	sub    $0x8,%rsp
+  801662:	89 f8                	mov    %edi,%eax
+  801664:	48 89 d3             	mov    %rdx,%rbx
+  801667:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_env_set_rt, 1, envid, period, budget, deadline, 0, 0);
+  80166a:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80166d:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801672:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801675:	be 00 00 00 00       	mov    $0x0,%esi
+  80167a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801680:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801682:	48 85 c0             	test   %rax,%rax
+  801685:	7f 06                	jg     80168d <sys_env_set_rt+0x34>
+}
+  801687:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80168b:	c9                   	leave
+  80168c:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80168d:	49 89 c0             	mov    %rax,%r8
+  801690:	b9 11 00 00 00       	mov    $0x11,%ecx
+  801695:	48 ba 90 37 80 00 00 	movabs $0x803790,%rdx
+  80169c:	00 00 00 
+  80169f:	be 26 00 00 00       	mov    $0x26,%esi
+  8016a4:	48 bf af 37 80 00 00 	movabs $0x8037af,%rdi
+  8016ab:	00 00 00 
+  8016ae:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016b3:	49 b9 c7 03 80 00 00 	movabs $0x8003c7,%r9
+  8016ba:	00 00 00 
+  8016bd:	41 ff d1             	call   *%r9
+
+00000000008016c0 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  8016c0:	55                   	push   %rbp
+  8016c1:	48 89 e5             	mov    %rsp,%rbp
+  8016c4:	53                   	push   %rbx
+  8016c5:	48 83 ec 08          	sub    $0x8,%rsp
+  8016c9:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  8016cc:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8016cf:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8016d4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016d9:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8016de:	be 00 00 00 00       	mov    $0x0,%esi
+  8016e3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8016e9:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8016eb:	48 85 c0             	test   %rax,%rax
+  8016ee:	7f 06                	jg     8016f6 <sys_env_set_trapframe+0x36>
+}
+  8016f0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8016f4:	c9                   	leave
+  8016f5:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8016f6:	49 89 c0             	mov    %rax,%r8
+  8016f9:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  8016fe:	48 ba 90 37 80 00 00 	movabs $0x803790,%rdx
+  801705:	00 00 00 
+  801708:	be 26 00 00 00       	mov    $0x26,%esi
+  80170d:	48 bf af 37 80 00 00 	movabs $0x8037af,%rdi
+  801714:	00 00 00 
+  801717:	b8 00 00 00 00       	mov    $0x0,%eax
+  80171c:	49 b9 c7 03 80 00 00 	movabs $0x8003c7,%r9
+  801723:	00 00 00 
+  801726:	41 ff d1             	call   *%r9
+
+0000000000801729 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  801729:	55                   	push   %rbp
+  80172a:	48 89 e5             	mov    %rsp,%rbp
+  80172d:	53                   	push   %rbx
+  80172e:	48 83 ec 08          	sub    $0x8,%rsp
+  801732:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  801735:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801738:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80173d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801742:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801747:	be 00 00 00 00       	mov    $0x0,%esi
+  80174c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801752:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801754:	48 85 c0             	test   %rax,%rax
+  801757:	7f 06                	jg     80175f <sys_env_set_pgfault_upcall+0x36>
+}
+  801759:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80175d:	c9                   	leave
+  80175e:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80175f:	49 89 c0             	mov    %rax,%r8
+  801762:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  801767:	48 ba 90 37 80 00 00 	movabs $0x803790,%rdx
+  80176e:	00 00 00 
+  801771:	be 26 00 00 00       	mov    $0x26,%esi
+  801776:	48 bf af 37 80 00 00 	movabs $0x8037af,%rdi
+  80177d:	00 00 00 
+  801780:	b8 00 00 00 00       	mov    $0x0,%eax
+  801785:	49 b9 c7 03 80 00 00 	movabs $0x8003c7,%r9
+  80178c:	00 00 00 
+  80178f:	41 ff d1             	call   *%r9
+
+0000000000801792 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  801792:	55                   	push   %rbp
+  801793:	48 89 e5             	mov    %rsp,%rbp
+  801796:	53                   	push   %rbx
+  801797:	89 f8                	mov    %edi,%eax
+  801799:	49 89 f1             	mov    %rsi,%r9
+  80179c:	48 89 d3             	mov    %rdx,%rbx
+  80179f:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  8017a2:	49 63 f0             	movslq %r8d,%rsi
+  8017a5:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8017a8:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8017ad:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8017b0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8017b6:	cd 30                	int    $0x30
+}
+  8017b8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8017bc:	c9                   	leave
+  8017bd:	c3                   	ret
+
+00000000008017be <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  8017be:	55                   	push   %rbp
+  8017bf:	48 89 e5             	mov    %rsp,%rbp
+  8017c2:	53                   	push   %rbx
+  8017c3:	48 83 ec 08          	sub    $0x8,%rsp
+  8017c7:	48 89 fa             	mov    %rdi,%rdx
+  8017ca:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8017cd:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8017d2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017d7:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8017dc:	be 00 00 00 00       	mov    $0x0,%esi
+  8017e1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8017e7:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8017e9:	48 85 c0             	test   %rax,%rax
+  8017ec:	7f 06                	jg     8017f4 <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8017ee:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8017f2:	c9                   	leave
+  8017f3:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8017f4:	49 89 c0             	mov    %rax,%r8
+  8017f7:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  8017fc:	48 ba 90 37 80 00 00 	movabs $0x803790,%rdx
+  801803:	00 00 00 
+  801806:	be 26 00 00 00       	mov    $0x26,%esi
+  80180b:	48 bf af 37 80 00 00 	movabs $0x8037af,%rdi
+  801812:	00 00 00 
+  801815:	b8 00 00 00 00       	mov    $0x0,%eax
+  80181a:	49 b9 c7 03 80 00 00 	movabs $0x8003c7,%r9
+  801821:	00 00 00 
+  801824:	41 ff d1             	call   *%r9
+
+0000000000801827 <fork>:
+ * Hint:
+ *   Use sys_map_region, it can perform address space copying in one call
+ *   Remember to fix "thisenv" in the child process.
+ */
+envid_t
+fork(void) {
+  801827:	55                   	push   %rbp
+  801828:	48 89 e5             	mov    %rsp,%rbp
+  80182b:	41 55                	push   %r13
+  80182d:	41 54                	push   %r12
+  80182f:	53                   	push   %rbx
+  801830:	48 83 ec 08          	sub    $0x8,%rsp
+
+/* This must be inlined. Exercise for reader: why? */
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+    envid_t ret;
+    asm volatile("int %2"
+  801834:	b8 08 00 00 00       	mov    $0x8,%eax
+  801839:	cd 30                	int    $0x30
+  80183b:	41 89 c5             	mov    %eax,%r13d
+    // LAB 9: Your code here
+
+    envid_t child_id = sys_exofork();
+    if (child_id < 0) {
+  80183e:	85 c0                	test   %eax,%eax
+  801840:	0f 88 ae 00 00 00    	js     8018f4 <fork+0xcd>
+  801846:	89 c3                	mov    %eax,%ebx
+        return child_id;
+    }
+    if (child_id == 0) {
+  801848:	0f 84 b4 00 00 00    	je     801902 <fork+0xdb>
+        thisenv = &envs[ENVX(sys_getenvid())];
+        return 0;
+    }
+    int res = sys_map_region(0, NULL, child_id, NULL, MAX_USER_ADDRESS, PROT_ALL | PROT_LAZY | PROT_COMBINE);
+  80184e:	41 b9 df 01 00 00    	mov    $0x1df,%r9d
+  801854:	49 b8 00 00 00 00 80 	movabs $0x8000000000,%r8
+  80185b:	00 00 00 
+  80185e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801863:	89 c2                	mov    %eax,%edx
+  801865:	be 00 00 00 00       	mov    $0x0,%esi
+  80186a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80186f:	48 b8 53 14 80 00 00 	movabs $0x801453,%rax
+  801876:	00 00 00 
+  801879:	ff d0                	call   *%rax
+  80187b:	41 89 c4             	mov    %eax,%r12d
+    if (res < 0) {
+  80187e:	85 c0                	test   %eax,%eax
+  801880:	78 5d                	js     8018df <fork+0xb8>
+        goto error;
+    }
+    res = sys_env_set_pgfault_upcall(child_id, envs[ENVX(sys_getenvid())].env_pgfault_upcall);
+  801882:	48 b8 2c 13 80 00 00 	movabs $0x80132c,%rax
+  801889:	00 00 00 
+  80188c:	ff d0                	call   *%rax
+  80188e:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801893:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+  80189a:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8018a1:	00 00 00 
+  8018a4:	48 01 d0             	add    %rdx,%rax
+  8018a7:	48 8b b0 88 01 00 00 	mov    0x188(%rax),%rsi
+  8018ae:	44 89 ef             	mov    %r13d,%edi
+  8018b1:	48 b8 29 17 80 00 00 	movabs $0x801729,%rax
+  8018b8:	00 00 00 
+  8018bb:	ff d0                	call   *%rax
+  8018bd:	41 89 c4             	mov    %eax,%r12d
+    if (res < 0) {
+  8018c0:	85 c0                	test   %eax,%eax
+  8018c2:	78 1b                	js     8018df <fork+0xb8>
+        goto error;
+    }
+    res = sys_env_set_status(child_id, ENV_RUNNABLE);
+  8018c4:	be 02 00 00 00       	mov    $0x2,%esi
+  8018c9:	44 89 ef             	mov    %r13d,%edi
+  8018cc:	48 b8 88 15 80 00 00 	movabs $0x801588,%rax
+  8018d3:	00 00 00 
+  8018d6:	ff d0                	call   *%rax
+  8018d8:	41 89 c4             	mov    %eax,%r12d
+    if (res < 0) {
+  8018db:	85 c0                	test   %eax,%eax
+  8018dd:	79 15                	jns    8018f4 <fork+0xcd>
+        goto error;
+    }
+    return child_id;
+error:
+    ;
+    int res2 = sys_env_destroy(child_id);
+  8018df:	89 df                	mov    %ebx,%edi
+  8018e1:	48 b8 c1 12 80 00 00 	movabs $0x8012c1,%rax
+  8018e8:	00 00 00 
+  8018eb:	ff d0                	call   *%rax
+    if (res2 < 0) {
+  8018ed:	85 c0                	test   %eax,%eax
+  8018ef:	78 42                	js     801933 <fork+0x10c>
+        panic("Fork double fault");
+    }
+    return res;
+  8018f1:	45 89 e5             	mov    %r12d,%r13d
+}
+  8018f4:	44 89 e8             	mov    %r13d,%eax
+  8018f7:	48 83 c4 08          	add    $0x8,%rsp
+  8018fb:	5b                   	pop    %rbx
+  8018fc:	41 5c                	pop    %r12
+  8018fe:	41 5d                	pop    %r13
+  801900:	5d                   	pop    %rbp
+  801901:	c3                   	ret
+        thisenv = &envs[ENVX(sys_getenvid())];
+  801902:	48 b8 2c 13 80 00 00 	movabs $0x80132c,%rax
+  801909:	00 00 00 
+  80190c:	ff d0                	call   *%rax
+  80190e:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801913:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+  80191a:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  801921:	00 00 00 
+  801924:	48 01 d0             	add    %rdx,%rax
+  801927:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  80192e:	00 00 00 
+        return 0;
+  801931:	eb c1                	jmp    8018f4 <fork+0xcd>
+        panic("Fork double fault");
+  801933:	48 ba bd 37 80 00 00 	movabs $0x8037bd,%rdx
+  80193a:	00 00 00 
+  80193d:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801942:	48 bf cf 37 80 00 00 	movabs $0x8037cf,%rdi
+  801949:	00 00 00 
+  80194c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801951:	48 b9 c7 03 80 00 00 	movabs $0x8003c7,%rcx
+  801958:	00 00 00 
+  80195b:	ff d1                	call   *%rcx
+
+000000000080195d <sfork>:
+
+envid_t
+sfork() {
+  80195d:	55                   	push   %rbp
+  80195e:	48 89 e5             	mov    %rsp,%rbp
+    panic("sfork() is not implemented");
+  801961:	48 ba da 37 80 00 00 	movabs $0x8037da,%rdx
+  801968:	00 00 00 
+  80196b:	be 36 00 00 00       	mov    $0x36,%esi
+  801970:	48 bf cf 37 80 00 00 	movabs $0x8037cf,%rdi
+  801977:	00 00 00 
+  80197a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80197f:	48 b9 c7 03 80 00 00 	movabs $0x8003c7,%rcx
+  801986:	00 00 00 
+  801989:	ff d1                	call   *%rcx
+
+000000000080198b <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80198b:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801992:	ff ff ff 
+  801995:	48 01 f8             	add    %rdi,%rax
+  801998:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  80199c:	c3                   	ret
+
+000000000080199d <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80199d:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8019a4:	ff ff ff 
+  8019a7:	48 01 f8             	add    %rdi,%rax
+  8019aa:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  8019ae:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  8019b4:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  8019b8:	c3                   	ret
+
+00000000008019b9 <fd_alloc_from>:
+}
+
+/* Like fd_alloc(), but only considers fds starting from fdnum,
+ * so that several fds can be found before their pages are allocated */
+int
+fd_alloc_from(int fdnum, struct Fd **fd_store) {
+  8019b9:	55                   	push   %rbp
+  8019ba:	48 89 e5             	mov    %rsp,%rbp
+  8019bd:	41 57                	push   %r15
+  8019bf:	41 56                	push   %r14
+  8019c1:	41 55                	push   %r13
+  8019c3:	41 54                	push   %r12
+  8019c5:	53                   	push   %rbx
+  8019c6:	48 83 ec 08          	sub    $0x8,%rsp
+  8019ca:	49 89 f7             	mov    %rsi,%r15
+    for (int i = MAX(fdnum, 0); i < MAXFD; i++) {
+  8019cd:	85 ff                	test   %edi,%edi
+  8019cf:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8019d5:	44 0f 49 e7          	cmovns %edi,%r12d
+  8019d9:	83 ff 1f             	cmp    $0x1f,%edi
+  8019dc:	7f 37                	jg     801a15 <fd_alloc_from+0x5c>
+  8019de:	49 63 dc             	movslq %r12d,%rbx
+  8019e1:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  8019e8:	48 c1 e3 0c          	shl    $0xc,%rbx
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  8019ec:	49 be 7b 2b 80 00 00 	movabs $0x802b7b,%r14
+  8019f3:	00 00 00 
+        struct Fd *fd = INDEX2FD(i);
+  8019f6:	49 89 dd             	mov    %rbx,%r13
+        if (!(get_prot(fd) & PROT_R)) {
+  8019f9:	48 89 df             	mov    %rbx,%rdi
+  8019fc:	41 ff d6             	call   *%r14
+  8019ff:	83 e0 04             	and    $0x4,%eax
+  801a02:	74 1c                	je     801a20 <fd_alloc_from+0x67>
+    for (int i = MAX(fdnum, 0); i < MAXFD; i++) {
+  801a04:	41 83 c4 01          	add    $0x1,%r12d
+  801a08:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801a0f:	41 83 fc 1f          	cmp    $0x1f,%r12d
+  801a13:	7e e1                	jle    8019f6 <fd_alloc_from+0x3d>
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  801a15:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801a1b:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  801a20:	4d 89 2f             	mov    %r13,(%r15)
+}
+  801a23:	48 83 c4 08          	add    $0x8,%rsp
+  801a27:	5b                   	pop    %rbx
+  801a28:	41 5c                	pop    %r12
+  801a2a:	41 5d                	pop    %r13
+  801a2c:	41 5e                	pop    %r14
+  801a2e:	41 5f                	pop    %r15
+  801a30:	5d                   	pop    %rbp
+  801a31:	c3                   	ret
+
+0000000000801a32 <fd_alloc>:
+fd_alloc(struct Fd **fd_store) {
+  801a32:	55                   	push   %rbp
+  801a33:	48 89 e5             	mov    %rsp,%rbp
+  801a36:	48 89 fe             	mov    %rdi,%rsi
+    return fd_alloc_from(0, fd_store);
+  801a39:	bf 00 00 00 00       	mov    $0x0,%edi
+  801a3e:	48 b8 b9 19 80 00 00 	movabs $0x8019b9,%rax
+  801a45:	00 00 00 
+  801a48:	ff d0                	call   *%rax
+}
+  801a4a:	5d                   	pop    %rbp
+  801a4b:	c3                   	ret
+
+0000000000801a4c <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  801a4c:	83 ff 1f             	cmp    $0x1f,%edi
+  801a4f:	77 39                	ja     801a8a <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  801a51:	55                   	push   %rbp
+  801a52:	48 89 e5             	mov    %rsp,%rbp
+  801a55:	41 54                	push   %r12
+  801a57:	53                   	push   %rbx
+  801a58:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  801a5b:	48 63 df             	movslq %edi,%rbx
+  801a5e:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  801a65:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  801a69:	48 89 df             	mov    %rbx,%rdi
+  801a6c:	48 b8 7b 2b 80 00 00 	movabs $0x802b7b,%rax
+  801a73:	00 00 00 
+  801a76:	ff d0                	call   *%rax
+  801a78:	a8 04                	test   $0x4,%al
+  801a7a:	74 14                	je     801a90 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  801a7c:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  801a80:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801a85:	5b                   	pop    %rbx
+  801a86:	41 5c                	pop    %r12
+  801a88:	5d                   	pop    %rbp
+  801a89:	c3                   	ret
+        return -E_INVAL;
+  801a8a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801a8f:	c3                   	ret
+        return -E_INVAL;
+  801a90:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801a95:	eb ee                	jmp    801a85 <fd_lookup+0x39>
+
+0000000000801a97 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  801a97:	55                   	push   %rbp
+  801a98:	48 89 e5             	mov    %rsp,%rbp
+  801a9b:	41 54                	push   %r12
+  801a9d:	53                   	push   %rbx
+  801a9e:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  801aa1:	48 b8 80 38 80 00 00 	movabs $0x803880,%rax
+  801aa8:	00 00 00 
+  801aab:	48 bb 20 40 80 00 00 	movabs $0x804020,%rbx
+  801ab2:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  801ab5:	39 3b                	cmp    %edi,(%rbx)
+  801ab7:	74 47                	je     801b00 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  801ab9:	48 83 c0 08          	add    $0x8,%rax
+  801abd:	48 8b 18             	mov    (%rax),%rbx
+  801ac0:	48 85 db             	test   %rbx,%rbx
+  801ac3:	75 f0                	jne    801ab5 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801ac5:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801acc:	00 00 00 
+  801acf:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+  801ad5:	89 fa                	mov    %edi,%edx
+  801ad7:	48 bf f8 37 80 00 00 	movabs $0x8037f8,%rdi
+  801ade:	00 00 00 
+  801ae1:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ae6:	48 b9 17 05 80 00 00 	movabs $0x800517,%rcx
+  801aed:	00 00 00 
+  801af0:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  801af2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  801af7:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  801afb:	5b                   	pop    %rbx
+  801afc:	41 5c                	pop    %r12
+  801afe:	5d                   	pop    %rbp
+  801aff:	c3                   	ret
+            return 0;
+  801b00:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b05:	eb f0                	jmp    801af7 <dev_lookup+0x60>
+
+0000000000801b07 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  801b07:	55                   	push   %rbp
+  801b08:	48 89 e5             	mov    %rsp,%rbp
+  801b0b:	41 55                	push   %r13
+  801b0d:	41 54                	push   %r12
+  801b0f:	53                   	push   %rbx
+  801b10:	48 83 ec 18          	sub    $0x18,%rsp
+  801b14:	48 89 fb             	mov    %rdi,%rbx
+  801b17:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801b1a:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  801b21:	ff ff ff 
+  801b24:	48 01 df             	add    %rbx,%rdi
+  801b27:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  801b2b:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801b2f:	48 b8 4c 1a 80 00 00 	movabs $0x801a4c,%rax
+  801b36:	00 00 00 
+  801b39:	ff d0                	call   *%rax
+  801b3b:	41 89 c5             	mov    %eax,%r13d
+  801b3e:	85 c0                	test   %eax,%eax
+  801b40:	78 06                	js     801b48 <fd_close+0x41>
+  801b42:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  801b46:	74 1a                	je     801b62 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  801b48:	45 84 e4             	test   %r12b,%r12b
+  801b4b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b50:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  801b54:	44 89 e8             	mov    %r13d,%eax
+  801b57:	48 83 c4 18          	add    $0x18,%rsp
+  801b5b:	5b                   	pop    %rbx
+  801b5c:	41 5c                	pop    %r12
+  801b5e:	41 5d                	pop    %r13
+  801b60:	5d                   	pop    %rbp
+  801b61:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801b62:	8b 3b                	mov    (%rbx),%edi
+  801b64:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801b68:	48 b8 97 1a 80 00 00 	movabs $0x801a97,%rax
+  801b6f:	00 00 00 
+  801b72:	ff d0                	call   *%rax
+  801b74:	41 89 c5             	mov    %eax,%r13d
+  801b77:	85 c0                	test   %eax,%eax
+  801b79:	78 1b                	js     801b96 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  801b7b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801b7f:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801b83:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801b89:	48 85 c0             	test   %rax,%rax
+  801b8c:	74 08                	je     801b96 <fd_close+0x8f>
+  801b8e:	48 89 df             	mov    %rbx,%rdi
+  801b91:	ff d0                	call   *%rax
+  801b93:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801b96:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801b9b:	48 89 de             	mov    %rbx,%rsi
+  801b9e:	bf 00 00 00 00       	mov    $0x0,%edi
+  801ba3:	48 b8 b8 14 80 00 00 	movabs $0x8014b8,%rax
+  801baa:	00 00 00 
+  801bad:	ff d0                	call   *%rax
+    return res;
+  801baf:	eb a3                	jmp    801b54 <fd_close+0x4d>
+
+0000000000801bb1 <close>:
+
+int
+close(int fdnum) {
+  801bb1:	55                   	push   %rbp
+  801bb2:	48 89 e5             	mov    %rsp,%rbp
+  801bb5:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  801bb9:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801bbd:	48 b8 4c 1a 80 00 00 	movabs $0x801a4c,%rax
+  801bc4:	00 00 00 
+  801bc7:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801bc9:	85 c0                	test   %eax,%eax
+  801bcb:	78 15                	js     801be2 <close+0x31>
+
+    return fd_close(fd, 1);
+  801bcd:	be 01 00 00 00       	mov    $0x1,%esi
+  801bd2:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801bd6:	48 b8 07 1b 80 00 00 	movabs $0x801b07,%rax
+  801bdd:	00 00 00 
+  801be0:	ff d0                	call   *%rax
+}
+  801be2:	c9                   	leave
+  801be3:	c3                   	ret
+
+0000000000801be4 <close_all>:
+
+void
+close_all(void) {
+  801be4:	55                   	push   %rbp
+  801be5:	48 89 e5             	mov    %rsp,%rbp
+  801be8:	41 54                	push   %r12
+  801bea:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  801beb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801bf0:	49 bc b1 1b 80 00 00 	movabs $0x801bb1,%r12
+  801bf7:	00 00 00 
+  801bfa:	89 df                	mov    %ebx,%edi
+  801bfc:	41 ff d4             	call   *%r12
+  801bff:	83 c3 01             	add    $0x1,%ebx
+  801c02:	83 fb 20             	cmp    $0x20,%ebx
+  801c05:	75 f3                	jne    801bfa <close_all+0x16>
+}
+  801c07:	5b                   	pop    %rbx
+  801c08:	41 5c                	pop    %r12
+  801c0a:	5d                   	pop    %rbp
+  801c0b:	c3                   	ret
+
+0000000000801c0c <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  801c0c:	55                   	push   %rbp
+  801c0d:	48 89 e5             	mov    %rsp,%rbp
+  801c10:	41 57                	push   %r15
+  801c12:	41 56                	push   %r14
+  801c14:	41 55                	push   %r13
+  801c16:	41 54                	push   %r12
+  801c18:	53                   	push   %rbx
+  801c19:	48 83 ec 18          	sub    $0x18,%rsp
+  801c1d:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  801c20:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801c24:	48 b8 4c 1a 80 00 00 	movabs $0x801a4c,%rax
+  801c2b:	00 00 00 
+  801c2e:	ff d0                	call   *%rax
+  801c30:	89 c3                	mov    %eax,%ebx
+  801c32:	85 c0                	test   %eax,%eax
+  801c34:	0f 88 b8 00 00 00    	js     801cf2 <dup+0xe6>
+    close(newfdnum);
+  801c3a:	44 89 e7             	mov    %r12d,%edi
+  801c3d:	48 b8 b1 1b 80 00 00 	movabs $0x801bb1,%rax
+  801c44:	00 00 00 
+  801c47:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  801c49:	4d 63 ec             	movslq %r12d,%r13
+  801c4c:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  801c53:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  801c57:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  801c5b:	4c 89 ff             	mov    %r15,%rdi
+  801c5e:	49 be 9d 19 80 00 00 	movabs $0x80199d,%r14
+  801c65:	00 00 00 
+  801c68:	41 ff d6             	call   *%r14
+  801c6b:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  801c6e:	4c 89 ef             	mov    %r13,%rdi
+  801c71:	41 ff d6             	call   *%r14
+  801c74:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  801c77:	48 89 df             	mov    %rbx,%rdi
+  801c7a:	48 b8 7b 2b 80 00 00 	movabs $0x802b7b,%rax
+  801c81:	00 00 00 
+  801c84:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  801c86:	a8 04                	test   $0x4,%al
+  801c88:	74 2b                	je     801cb5 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  801c8a:	41 89 c1             	mov    %eax,%r9d
+  801c8d:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801c93:	4c 89 f1             	mov    %r14,%rcx
+  801c96:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c9b:	48 89 de             	mov    %rbx,%rsi
+  801c9e:	bf 00 00 00 00       	mov    $0x0,%edi
+  801ca3:	48 b8 53 14 80 00 00 	movabs $0x801453,%rax
+  801caa:	00 00 00 
+  801cad:	ff d0                	call   *%rax
+  801caf:	89 c3                	mov    %eax,%ebx
+  801cb1:	85 c0                	test   %eax,%eax
+  801cb3:	78 4e                	js     801d03 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  801cb5:	4c 89 ff             	mov    %r15,%rdi
+  801cb8:	48 b8 7b 2b 80 00 00 	movabs $0x802b7b,%rax
+  801cbf:	00 00 00 
+  801cc2:	ff d0                	call   *%rax
+  801cc4:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801cc7:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801ccd:	4c 89 e9             	mov    %r13,%rcx
+  801cd0:	ba 00 00 00 00       	mov    $0x0,%edx
+  801cd5:	4c 89 fe             	mov    %r15,%rsi
+  801cd8:	bf 00 00 00 00       	mov    $0x0,%edi
+  801cdd:	48 b8 53 14 80 00 00 	movabs $0x801453,%rax
+  801ce4:	00 00 00 
+  801ce7:	ff d0                	call   *%rax
+  801ce9:	89 c3                	mov    %eax,%ebx
+  801ceb:	85 c0                	test   %eax,%eax
+  801ced:	78 14                	js     801d03 <dup+0xf7>
+
+    return newfdnum;
+  801cef:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  801cf2:	89 d8                	mov    %ebx,%eax
+  801cf4:	48 83 c4 18          	add    $0x18,%rsp
+  801cf8:	5b                   	pop    %rbx
+  801cf9:	41 5c                	pop    %r12
+  801cfb:	41 5d                	pop    %r13
+  801cfd:	41 5e                	pop    %r14
+  801cff:	41 5f                	pop    %r15
+  801d01:	5d                   	pop    %rbp
+  801d02:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  801d03:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801d08:	4c 89 ee             	mov    %r13,%rsi
+  801d0b:	bf 00 00 00 00       	mov    $0x0,%edi
+  801d10:	49 bc b8 14 80 00 00 	movabs $0x8014b8,%r12
+  801d17:	00 00 00 
+  801d1a:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  801d1d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801d22:	4c 89 f6             	mov    %r14,%rsi
+  801d25:	bf 00 00 00 00       	mov    $0x0,%edi
+  801d2a:	41 ff d4             	call   *%r12
+    return res;
+  801d2d:	eb c3                	jmp    801cf2 <dup+0xe6>
+
+0000000000801d2f <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  801d2f:	55                   	push   %rbp
+  801d30:	48 89 e5             	mov    %rsp,%rbp
+  801d33:	41 56                	push   %r14
+  801d35:	41 55                	push   %r13
+  801d37:	41 54                	push   %r12
+  801d39:	53                   	push   %rbx
+  801d3a:	48 83 ec 10          	sub    $0x10,%rsp
+  801d3e:	89 fb                	mov    %edi,%ebx
+  801d40:	49 89 f4             	mov    %rsi,%r12
+  801d43:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801d46:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801d4a:	48 b8 4c 1a 80 00 00 	movabs $0x801a4c,%rax
+  801d51:	00 00 00 
+  801d54:	ff d0                	call   *%rax
+  801d56:	85 c0                	test   %eax,%eax
+  801d58:	78 4c                	js     801da6 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801d5a:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801d5e:	41 8b 3e             	mov    (%r14),%edi
+  801d61:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801d65:	48 b8 97 1a 80 00 00 	movabs $0x801a97,%rax
+  801d6c:	00 00 00 
+  801d6f:	ff d0                	call   *%rax
+  801d71:	85 c0                	test   %eax,%eax
+  801d73:	78 35                	js     801daa <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801d75:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801d79:	83 e0 03             	and    $0x3,%eax
+  801d7c:	83 f8 01             	cmp    $0x1,%eax
+  801d7f:	74 2d                	je     801dae <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801d81:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801d85:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801d89:	48 85 c0             	test   %rax,%rax
+  801d8c:	74 56                	je     801de4 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  801d8e:	4c 89 ea             	mov    %r13,%rdx
+  801d91:	4c 89 e6             	mov    %r12,%rsi
+  801d94:	4c 89 f7             	mov    %r14,%rdi
+  801d97:	ff d0                	call   *%rax
+}
+  801d99:	48 83 c4 10          	add    $0x10,%rsp
+  801d9d:	5b                   	pop    %rbx
+  801d9e:	41 5c                	pop    %r12
+  801da0:	41 5d                	pop    %r13
+  801da2:	41 5e                	pop    %r14
+  801da4:	5d                   	pop    %rbp
+  801da5:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801da6:	48 98                	cltq
+  801da8:	eb ef                	jmp    801d99 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801daa:	48 98                	cltq
+  801dac:	eb eb                	jmp    801d99 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801dae:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801db5:	00 00 00 
+  801db8:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+  801dbe:	89 da                	mov    %ebx,%edx
+  801dc0:	48 bf 39 38 80 00 00 	movabs $0x803839,%rdi
+  801dc7:	00 00 00 
+  801dca:	b8 00 00 00 00       	mov    $0x0,%eax
+  801dcf:	48 b9 17 05 80 00 00 	movabs $0x800517,%rcx
+  801dd6:	00 00 00 
+  801dd9:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801ddb:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801de2:	eb b5                	jmp    801d99 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801de4:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801deb:	eb ac                	jmp    801d99 <read+0x6a>
+
+0000000000801ded <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801ded:	55                   	push   %rbp
+  801dee:	48 89 e5             	mov    %rsp,%rbp
+  801df1:	41 57                	push   %r15
+  801df3:	41 56                	push   %r14
+  801df5:	41 55                	push   %r13
+  801df7:	41 54                	push   %r12
+  801df9:	53                   	push   %rbx
+  801dfa:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  801dfe:	48 85 d2             	test   %rdx,%rdx
+  801e01:	74 54                	je     801e57 <readn+0x6a>
+  801e03:	41 89 fd             	mov    %edi,%r13d
+  801e06:	49 89 f6             	mov    %rsi,%r14
+  801e09:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  801e0c:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  801e11:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  801e16:	49 bf 2f 1d 80 00 00 	movabs $0x801d2f,%r15
+  801e1d:	00 00 00 
+  801e20:	4c 89 e2             	mov    %r12,%rdx
+  801e23:	48 29 f2             	sub    %rsi,%rdx
+  801e26:	4c 01 f6             	add    %r14,%rsi
+  801e29:	44 89 ef             	mov    %r13d,%edi
+  801e2c:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  801e2f:	85 c0                	test   %eax,%eax
+  801e31:	78 20                	js     801e53 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  801e33:	01 c3                	add    %eax,%ebx
+  801e35:	85 c0                	test   %eax,%eax
+  801e37:	74 08                	je     801e41 <readn+0x54>
+  801e39:	48 63 f3             	movslq %ebx,%rsi
+  801e3c:	4c 39 e6             	cmp    %r12,%rsi
+  801e3f:	72 df                	jb     801e20 <readn+0x33>
+    }
+    return res;
+  801e41:	48 63 c3             	movslq %ebx,%rax
+}
+  801e44:	48 83 c4 08          	add    $0x8,%rsp
+  801e48:	5b                   	pop    %rbx
+  801e49:	41 5c                	pop    %r12
+  801e4b:	41 5d                	pop    %r13
+  801e4d:	41 5e                	pop    %r14
+  801e4f:	41 5f                	pop    %r15
+  801e51:	5d                   	pop    %rbp
+  801e52:	c3                   	ret
+        if (inc < 0) return inc;
+  801e53:	48 98                	cltq
+  801e55:	eb ed                	jmp    801e44 <readn+0x57>
+    int inc = 1, res = 0;
+  801e57:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801e5c:	eb e3                	jmp    801e41 <readn+0x54>
+
+0000000000801e5e <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  801e5e:	55                   	push   %rbp
+  801e5f:	48 89 e5             	mov    %rsp,%rbp
+  801e62:	41 56                	push   %r14
+  801e64:	41 55                	push   %r13
+  801e66:	41 54                	push   %r12
+  801e68:	53                   	push   %rbx
+  801e69:	48 83 ec 10          	sub    $0x10,%rsp
+  801e6d:	89 fb                	mov    %edi,%ebx
+  801e6f:	49 89 f4             	mov    %rsi,%r12
+  801e72:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801e75:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801e79:	48 b8 4c 1a 80 00 00 	movabs $0x801a4c,%rax
+  801e80:	00 00 00 
+  801e83:	ff d0                	call   *%rax
+  801e85:	85 c0                	test   %eax,%eax
+  801e87:	78 47                	js     801ed0 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801e89:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801e8d:	41 8b 3e             	mov    (%r14),%edi
+  801e90:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801e94:	48 b8 97 1a 80 00 00 	movabs $0x801a97,%rax
+  801e9b:	00 00 00 
+  801e9e:	ff d0                	call   *%rax
+  801ea0:	85 c0                	test   %eax,%eax
+  801ea2:	78 30                	js     801ed4 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801ea4:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  801ea9:	74 2d                	je     801ed8 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801eab:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801eaf:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801eb3:	48 85 c0             	test   %rax,%rax
+  801eb6:	74 56                	je     801f0e <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  801eb8:	4c 89 ea             	mov    %r13,%rdx
+  801ebb:	4c 89 e6             	mov    %r12,%rsi
+  801ebe:	4c 89 f7             	mov    %r14,%rdi
+  801ec1:	ff d0                	call   *%rax
+}
+  801ec3:	48 83 c4 10          	add    $0x10,%rsp
+  801ec7:	5b                   	pop    %rbx
+  801ec8:	41 5c                	pop    %r12
+  801eca:	41 5d                	pop    %r13
+  801ecc:	41 5e                	pop    %r14
+  801ece:	5d                   	pop    %rbp
+  801ecf:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801ed0:	48 98                	cltq
+  801ed2:	eb ef                	jmp    801ec3 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801ed4:	48 98                	cltq
+  801ed6:	eb eb                	jmp    801ec3 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801ed8:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801edf:	00 00 00 
+  801ee2:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+  801ee8:	89 da                	mov    %ebx,%edx
+  801eea:	48 bf 55 38 80 00 00 	movabs $0x803855,%rdi
+  801ef1:	00 00 00 
+  801ef4:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ef9:	48 b9 17 05 80 00 00 	movabs $0x800517,%rcx
+  801f00:	00 00 00 
+  801f03:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801f05:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801f0c:	eb b5                	jmp    801ec3 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801f0e:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801f15:	eb ac                	jmp    801ec3 <write+0x65>
+
+0000000000801f17 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  801f17:	55                   	push   %rbp
+  801f18:	48 89 e5             	mov    %rsp,%rbp
+  801f1b:	53                   	push   %rbx
+  801f1c:	48 83 ec 18          	sub    $0x18,%rsp
+  801f20:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801f22:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801f26:	48 b8 4c 1a 80 00 00 	movabs $0x801a4c,%rax
+  801f2d:	00 00 00 
+  801f30:	ff d0                	call   *%rax
+  801f32:	85 c0                	test   %eax,%eax
+  801f34:	78 0c                	js     801f42 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  801f36:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801f3a:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  801f3d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801f42:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801f46:	c9                   	leave
+  801f47:	c3                   	ret
+
+0000000000801f48 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  801f48:	55                   	push   %rbp
+  801f49:	48 89 e5             	mov    %rsp,%rbp
+  801f4c:	41 55                	push   %r13
+  801f4e:	41 54                	push   %r12
+  801f50:	53                   	push   %rbx
+  801f51:	48 83 ec 18          	sub    $0x18,%rsp
+  801f55:	89 fb                	mov    %edi,%ebx
+  801f57:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801f5a:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801f5e:	48 b8 4c 1a 80 00 00 	movabs $0x801a4c,%rax
+  801f65:	00 00 00 
+  801f68:	ff d0                	call   *%rax
+  801f6a:	85 c0                	test   %eax,%eax
+  801f6c:	78 38                	js     801fa6 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801f6e:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  801f72:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  801f76:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801f7a:	48 b8 97 1a 80 00 00 	movabs $0x801a97,%rax
+  801f81:	00 00 00 
+  801f84:	ff d0                	call   *%rax
+  801f86:	85 c0                	test   %eax,%eax
+  801f88:	78 1c                	js     801fa6 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801f8a:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  801f8f:	74 20                	je     801fb1 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801f91:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801f95:	48 8b 40 30          	mov    0x30(%rax),%rax
+  801f99:	48 85 c0             	test   %rax,%rax
+  801f9c:	74 47                	je     801fe5 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  801f9e:	44 89 e6             	mov    %r12d,%esi
+  801fa1:	4c 89 ef             	mov    %r13,%rdi
+  801fa4:	ff d0                	call   *%rax
+}
+  801fa6:	48 83 c4 18          	add    $0x18,%rsp
+  801faa:	5b                   	pop    %rbx
+  801fab:	41 5c                	pop    %r12
+  801fad:	41 5d                	pop    %r13
+  801faf:	5d                   	pop    %rbp
+  801fb0:	c3                   	ret
+                thisenv->env_id, fdnum);
+  801fb1:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801fb8:	00 00 00 
+  801fbb:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801fc1:	89 da                	mov    %ebx,%edx
+  801fc3:	48 bf 18 38 80 00 00 	movabs $0x803818,%rdi
+  801fca:	00 00 00 
+  801fcd:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fd2:	48 b9 17 05 80 00 00 	movabs $0x800517,%rcx
+  801fd9:	00 00 00 
+  801fdc:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801fde:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801fe3:	eb c1                	jmp    801fa6 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801fe5:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801fea:	eb ba                	jmp    801fa6 <ftruncate+0x5e>
+
+0000000000801fec <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  801fec:	55                   	push   %rbp
+  801fed:	48 89 e5             	mov    %rsp,%rbp
+  801ff0:	41 54                	push   %r12
+  801ff2:	53                   	push   %rbx
+  801ff3:	48 83 ec 10          	sub    $0x10,%rsp
+  801ff7:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801ffa:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801ffe:	48 b8 4c 1a 80 00 00 	movabs $0x801a4c,%rax
+  802005:	00 00 00 
+  802008:	ff d0                	call   *%rax
+  80200a:	85 c0                	test   %eax,%eax
+  80200c:	78 4e                	js     80205c <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80200e:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  802012:	41 8b 3c 24          	mov    (%r12),%edi
+  802016:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  80201a:	48 b8 97 1a 80 00 00 	movabs $0x801a97,%rax
+  802021:	00 00 00 
+  802024:	ff d0                	call   *%rax
+  802026:	85 c0                	test   %eax,%eax
+  802028:	78 32                	js     80205c <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  80202a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80202e:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  802033:	74 30                	je     802065 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  802035:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  802038:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  80203f:	00 00 00 
+    stat->st_isdir = 0;
+  802042:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  802049:	00 00 00 
+    stat->st_dev = dev;
+  80204c:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  802053:	48 89 de             	mov    %rbx,%rsi
+  802056:	4c 89 e7             	mov    %r12,%rdi
+  802059:	ff 50 28             	call   *0x28(%rax)
+}
+  80205c:	48 83 c4 10          	add    $0x10,%rsp
+  802060:	5b                   	pop    %rbx
+  802061:	41 5c                	pop    %r12
+  802063:	5d                   	pop    %rbp
+  802064:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  802065:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80206a:	eb f0                	jmp    80205c <fstat+0x70>
+
+000000000080206c <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  80206c:	55                   	push   %rbp
+  80206d:	48 89 e5             	mov    %rsp,%rbp
+  802070:	41 54                	push   %r12
+  802072:	53                   	push   %rbx
+  802073:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  802076:	be 00 00 00 00       	mov    $0x0,%esi
+  80207b:	48 b8 4f 24 80 00 00 	movabs $0x80244f,%rax
+  802082:	00 00 00 
+  802085:	ff d0                	call   *%rax
+  802087:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  802089:	85 c0                	test   %eax,%eax
+  80208b:	78 25                	js     8020b2 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  80208d:	4c 89 e6             	mov    %r12,%rsi
+  802090:	89 c7                	mov    %eax,%edi
+  802092:	48 b8 ec 1f 80 00 00 	movabs $0x801fec,%rax
+  802099:	00 00 00 
+  80209c:	ff d0                	call   *%rax
+  80209e:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  8020a1:	89 df                	mov    %ebx,%edi
+  8020a3:	48 b8 b1 1b 80 00 00 	movabs $0x801bb1,%rax
+  8020aa:	00 00 00 
+  8020ad:	ff d0                	call   *%rax
+
+    return res;
+  8020af:	44 89 e3             	mov    %r12d,%ebx
+}
+  8020b2:	89 d8                	mov    %ebx,%eax
+  8020b4:	5b                   	pop    %rbx
+  8020b5:	41 5c                	pop    %r12
+  8020b7:	5d                   	pop    %rbp
+  8020b8:	c3                   	ret
+
+00000000008020b9 <fsipc>:
+ * response may be written back to fsipcbuf.
+ * type: request code, passed as the simple integer IPC value.
+ * dstva: virtual address at which to receive reply page, 0 if none.
+ * Returns result from the file server. */
+static int
+fsipc(unsigned type, void *dstva) {
+  8020b9:	55                   	push   %rbp
+  8020ba:	48 89 e5             	mov    %rsp,%rbp
+  8020bd:	41 54                	push   %r12
+  8020bf:	53                   	push   %rbx
+  8020c0:	48 83 ec 10          	sub    $0x10,%rsp
+  8020c4:	41 89 fc             	mov    %edi,%r12d
+  8020c7:	48 89 f3             	mov    %rsi,%rbx
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8020ca:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  8020d1:	00 00 00 
+  8020d4:	83 38 00             	cmpl   $0x0,(%rax)
+  8020d7:	74 5e                	je     802137 <fsipc+0x7e>
+    if (debug) {
+        cprintf("[%08x] fsipc %d %08x\n",
+                thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+    }
+
+    ipc_send(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW);
+  8020d9:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8020df:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8020e4:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  8020eb:	00 00 00 
+  8020ee:	44 89 e6             	mov    %r12d,%esi
+  8020f1:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  8020f8:	00 00 00 
+  8020fb:	8b 38                	mov    (%rax),%edi
+  8020fd:	48 b8 6f 30 80 00 00 	movabs $0x80306f,%rax
+  802104:	00 00 00 
+  802107:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  802109:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  802110:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  802111:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802116:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  80211a:	48 89 de             	mov    %rbx,%rsi
+  80211d:	bf 00 00 00 00       	mov    $0x0,%edi
+  802122:	48 b8 9a 2f 80 00 00 	movabs $0x802f9a,%rax
+  802129:	00 00 00 
+  80212c:	ff d0                	call   *%rax
+}
+  80212e:	48 83 c4 10          	add    $0x10,%rsp
+  802132:	5b                   	pop    %rbx
+  802133:	41 5c                	pop    %r12
+  802135:	5d                   	pop    %rbp
+  802136:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802137:	bf 03 00 00 00       	mov    $0x3,%edi
+  80213c:	48 b8 12 31 80 00 00 	movabs $0x803112,%rax
+  802143:	00 00 00 
+  802146:	ff d0                	call   *%rax
+  802148:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  80214f:	00 00 
+  802151:	eb 86                	jmp    8020d9 <fsipc+0x20>
+
+0000000000802153 <devfile_trunc>:
+    return 0;
+}
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  802153:	55                   	push   %rbp
+  802154:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802157:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  80215e:	00 00 00 
+  802161:	8b 57 0c             	mov    0xc(%rdi),%edx
+  802164:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  802166:	89 70 04             	mov    %esi,0x4(%rax)
+
+    return fsipc(FSREQ_SET_SIZE, NULL);
+  802169:	be 00 00 00 00       	mov    $0x0,%esi
+  80216e:	bf 02 00 00 00       	mov    $0x2,%edi
+  802173:	48 b8 b9 20 80 00 00 	movabs $0x8020b9,%rax
+  80217a:	00 00 00 
+  80217d:	ff d0                	call   *%rax
+}
+  80217f:	5d                   	pop    %rbp
+  802180:	c3                   	ret
+
+0000000000802181 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  802181:	55                   	push   %rbp
+  802182:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  802185:	8b 47 0c             	mov    0xc(%rdi),%eax
+  802188:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  80218f:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  802191:	be 00 00 00 00       	mov    $0x0,%esi
+  802196:	bf 06 00 00 00       	mov    $0x6,%edi
+  80219b:	48 b8 b9 20 80 00 00 	movabs $0x8020b9,%rax
+  8021a2:	00 00 00 
+  8021a5:	ff d0                	call   *%rax
+}
+  8021a7:	5d                   	pop    %rbp
+  8021a8:	c3                   	ret
+
+00000000008021a9 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  8021a9:	55                   	push   %rbp
+  8021aa:	48 89 e5             	mov    %rsp,%rbp
+  8021ad:	41 54                	push   %r12
+  8021af:	53                   	push   %rbx
+  8021b0:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8021b3:	8b 47 0c             	mov    0xc(%rdi),%eax
+  8021b6:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  8021bd:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  8021bf:	be 00 00 00 00       	mov    $0x0,%esi
+  8021c4:	bf 05 00 00 00       	mov    $0x5,%edi
+  8021c9:	48 b8 b9 20 80 00 00 	movabs $0x8020b9,%rax
+  8021d0:	00 00 00 
+  8021d3:	ff d0                	call   *%rax
+    if (res < 0) {
+  8021d5:	85 c0                	test   %eax,%eax
+  8021d7:	78 3d                	js     802216 <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8021d9:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  8021e0:	00 00 00 
+  8021e3:	4c 89 e6             	mov    %r12,%rsi
+  8021e6:	48 89 df             	mov    %rbx,%rdi
+  8021e9:	48 b8 3c 0e 80 00 00 	movabs $0x800e3c,%rax
+  8021f0:	00 00 00 
+  8021f3:	ff d0                	call   *%rax
+    st->st_size  = fsipcbuf.statRet.ret_size;
+  8021f5:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  8021fc:	00 
+  8021fd:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802203:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  80220a:	00 
+  80220b:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  802211:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802216:	5b                   	pop    %rbx
+  802217:	41 5c                	pop    %r12
+  802219:	5d                   	pop    %rbp
+  80221a:	c3                   	ret
+
+000000000080221b <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  80221b:	55                   	push   %rbp
+  80221c:	48 89 e5             	mov    %rsp,%rbp
+  80221f:	41 57                	push   %r15
+  802221:	41 56                	push   %r14
+  802223:	41 55                	push   %r13
+  802225:	41 54                	push   %r12
+  802227:	53                   	push   %rbx
+  802228:	48 83 ec 18          	sub    $0x18,%rsp
+  80222c:	49 89 fe             	mov    %rdi,%r14
+  80222f:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+  802233:	48 89 d3             	mov    %rdx,%rbx
+    while (n > sizeof(fsipcbuf.write.req_buf))
+  802236:	48 81 fa f0 0f 00 00 	cmp    $0xff0,%rdx
+  80223d:	0f 86 e4 00 00 00    	jbe    802327 <devfile_write+0x10c>
+  802243:	49 89 f4             	mov    %rsi,%r12
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802246:	49 bd 00 60 80 00 00 	movabs $0x806000,%r13
+  80224d:	00 00 00 
+        memcpy(fsipcbuf.write.req_buf, buf, sizeof(fsipcbuf.write.req_buf));
+  802250:	49 bf 9d 10 80 00 00 	movabs $0x80109d,%r15
+  802257:	00 00 00 
+  80225a:	eb 03                	jmp    80225f <devfile_write+0x44>
+        buf += sizeof(fsipcbuf.write.req_buf);
+  80225c:	49 89 f4             	mov    %rsi,%r12
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  80225f:	41 8b 46 0c          	mov    0xc(%r14),%eax
+  802263:	41 89 45 00          	mov    %eax,0x0(%r13)
+        fsipcbuf.write.req_n      = sizeof(fsipcbuf.write.req_buf);
+  802267:	49 c7 45 08 f0 0f 00 	movq   $0xff0,0x8(%r13)
+  80226e:	00 
+        memcpy(fsipcbuf.write.req_buf, buf, sizeof(fsipcbuf.write.req_buf));
+  80226f:	ba f0 0f 00 00       	mov    $0xff0,%edx
+  802274:	4c 89 e6             	mov    %r12,%rsi
+  802277:	48 bf 10 60 80 00 00 	movabs $0x806010,%rdi
+  80227e:	00 00 00 
+  802281:	41 ff d7             	call   *%r15
+        ssize_t res = fsipc(FSREQ_WRITE, NULL);
+  802284:	be 00 00 00 00       	mov    $0x0,%esi
+  802289:	bf 04 00 00 00       	mov    $0x4,%edi
+  80228e:	48 b8 b9 20 80 00 00 	movabs $0x8020b9,%rax
+  802295:	00 00 00 
+  802298:	ff d0                	call   *%rax
+  80229a:	48 63 d0             	movslq %eax,%rdx
+        if (res < 0 || res < sizeof(fsipcbuf.write.req_buf))
+  80229d:	3d ef 0f 00 00       	cmp    $0xfef,%eax
+  8022a2:	7e 71                	jle    802315 <devfile_write+0xfa>
+        buf += sizeof(fsipcbuf.write.req_buf);
+  8022a4:	49 8d b4 24 f0 0f 00 	lea    0xff0(%r12),%rsi
+  8022ab:	00 
+        n -= sizeof(fsipcbuf.write.req_buf);
+  8022ac:	48 81 eb f0 0f 00 00 	sub    $0xff0,%rbx
+    while (n > sizeof(fsipcbuf.write.req_buf))
+  8022b3:	48 81 fb f0 0f 00 00 	cmp    $0xff0,%rbx
+  8022ba:	77 a0                	ja     80225c <devfile_write+0x41>
+        written += sizeof(fsipcbuf.write.req_buf);
+  8022bc:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8022c0:	49 29 c4             	sub    %rax,%r12
+  8022c3:	4d 8d a4 24 f0 0f 00 	lea    0xff0(%r12),%r12
+  8022ca:	00 
+    fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8022cb:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  8022d2:	00 00 00 
+  8022d5:	41 8b 56 0c          	mov    0xc(%r14),%edx
+  8022d9:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.write.req_n      = n;
+  8022db:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    memcpy(fsipcbuf.write.req_buf, buf, n);
+  8022df:	48 89 da             	mov    %rbx,%rdx
+  8022e2:	48 8d 78 10          	lea    0x10(%rax),%rdi
+  8022e6:	48 b8 9d 10 80 00 00 	movabs $0x80109d,%rax
+  8022ed:	00 00 00 
+  8022f0:	ff d0                	call   *%rax
+    ssize_t res = fsipc(FSREQ_WRITE, NULL);
+  8022f2:	be 00 00 00 00       	mov    $0x0,%esi
+  8022f7:	bf 04 00 00 00       	mov    $0x4,%edi
+  8022fc:	48 b8 b9 20 80 00 00 	movabs $0x8020b9,%rax
+  802303:	00 00 00 
+  802306:	ff d0                	call   *%rax
+  802308:	48 63 d0             	movslq %eax,%rdx
+    written += res;
+  80230b:	49 01 d4             	add    %rdx,%r12
+  80230e:	48 85 d2             	test   %rdx,%rdx
+  802311:	49 0f 49 d4          	cmovns %r12,%rdx
+}
+  802315:	48 89 d0             	mov    %rdx,%rax
+  802318:	48 83 c4 18          	add    $0x18,%rsp
+  80231c:	5b                   	pop    %rbx
+  80231d:	41 5c                	pop    %r12
+  80231f:	41 5d                	pop    %r13
+  802321:	41 5e                	pop    %r14
+  802323:	41 5f                	pop    %r15
+  802325:	5d                   	pop    %rbp
+  802326:	c3                   	ret
+    while (n > sizeof(fsipcbuf.write.req_buf))
+  802327:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+    ssize_t written = 0;
+  80232b:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802331:	eb 98                	jmp    8022cb <devfile_write+0xb0>
+
+0000000000802333 <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  802333:	55                   	push   %rbp
+  802334:	48 89 e5             	mov    %rsp,%rbp
+  802337:	41 57                	push   %r15
+  802339:	41 56                	push   %r14
+  80233b:	41 55                	push   %r13
+  80233d:	41 54                	push   %r12
+  80233f:	53                   	push   %rbx
+  802340:	48 83 ec 18          	sub    $0x18,%rsp
+  802344:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  802348:	49 89 f6             	mov    %rsi,%r14
+  80234b:	49 89 d4             	mov    %rdx,%r12
+    while (n > sizeof(fsipcbuf.readRet.ret_buf))
+  80234e:	48 81 fa 00 10 00 00 	cmp    $0x1000,%rdx
+  802355:	0f 86 ea 00 00 00    	jbe    802445 <devfile_read+0x112>
+    ssize_t readsz = 0;
+  80235b:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  802362:	00 
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802363:	49 bf 00 60 80 00 00 	movabs $0x806000,%r15
+  80236a:	00 00 00 
+  80236d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802371:	8b 40 0c             	mov    0xc(%rax),%eax
+  802374:	41 89 07             	mov    %eax,(%r15)
+        fsipcbuf.read.req_n = sizeof(fsipcbuf.readRet.ret_buf);
+  802377:	49 c7 47 08 00 10 00 	movq   $0x1000,0x8(%r15)
+  80237e:	00 
+        ssize_t res = fsipc(FSREQ_READ, NULL);
+  80237f:	be 00 00 00 00       	mov    $0x0,%esi
+  802384:	bf 03 00 00 00       	mov    $0x3,%edi
+  802389:	48 b8 b9 20 80 00 00 	movabs $0x8020b9,%rax
+  802390:	00 00 00 
+  802393:	ff d0                	call   *%rax
+  802395:	4c 63 e8             	movslq %eax,%r13
+        if (res < 0)
+  802398:	4d 85 ed             	test   %r13,%r13
+  80239b:	0f 88 92 00 00 00    	js     802433 <devfile_read+0x100>
+        memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  8023a1:	4c 89 ea             	mov    %r13,%rdx
+  8023a4:	4c 89 fe             	mov    %r15,%rsi
+  8023a7:	4c 89 f7             	mov    %r14,%rdi
+  8023aa:	48 b8 9d 10 80 00 00 	movabs $0x80109d,%rax
+  8023b1:	00 00 00 
+  8023b4:	ff d0                	call   *%rax
+        if (res < sizeof(fsipcbuf.readRet.ret_buf))
+  8023b6:	49 81 fd ff 0f 00 00 	cmp    $0xfff,%r13
+  8023bd:	76 6d                	jbe    80242c <devfile_read+0xf9>
+        readsz += res;
+  8023bf:	4c 01 6d c0          	add    %r13,-0x40(%rbp)
+        buf += res;
+  8023c3:	4d 01 ee             	add    %r13,%r14
+        n -= res;
+  8023c6:	4d 29 ec             	sub    %r13,%r12
+    while (n > sizeof(fsipcbuf.readRet.ret_buf))
+  8023c9:	49 81 fc 00 10 00 00 	cmp    $0x1000,%r12
+  8023d0:	77 9b                	ja     80236d <devfile_read+0x3a>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8023d2:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  8023d9:	00 00 00 
+  8023dc:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  8023e0:	8b 51 0c             	mov    0xc(%rcx),%edx
+  8023e3:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.read.req_n = n;
+  8023e5:	4c 89 60 08          	mov    %r12,0x8(%rax)
+    ssize_t res = fsipc(FSREQ_READ, NULL);
+  8023e9:	be 00 00 00 00       	mov    $0x0,%esi
+  8023ee:	bf 03 00 00 00       	mov    $0x3,%edi
+  8023f3:	48 b8 b9 20 80 00 00 	movabs $0x8020b9,%rax
+  8023fa:	00 00 00 
+  8023fd:	ff d0                	call   *%rax
+  8023ff:	4c 63 e8             	movslq %eax,%r13
+    if (res < 0)
+  802402:	4d 85 ed             	test   %r13,%r13
+  802405:	78 2c                	js     802433 <devfile_read+0x100>
+    memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  802407:	4c 89 ea             	mov    %r13,%rdx
+  80240a:	48 be 00 60 80 00 00 	movabs $0x806000,%rsi
+  802411:	00 00 00 
+  802414:	4c 89 f7             	mov    %r14,%rdi
+  802417:	48 b8 9d 10 80 00 00 	movabs $0x80109d,%rax
+  80241e:	00 00 00 
+  802421:	ff d0                	call   *%rax
+    readsz += res;
+  802423:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802427:	49 01 c5             	add    %rax,%r13
+    return readsz;
+  80242a:	eb 07                	jmp    802433 <devfile_read+0x100>
+            return readsz + res;
+  80242c:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802430:	49 01 c5             	add    %rax,%r13
+}
+  802433:	4c 89 e8             	mov    %r13,%rax
+  802436:	48 83 c4 18          	add    $0x18,%rsp
+  80243a:	5b                   	pop    %rbx
+  80243b:	41 5c                	pop    %r12
+  80243d:	41 5d                	pop    %r13
+  80243f:	41 5e                	pop    %r14
+  802441:	41 5f                	pop    %r15
+  802443:	5d                   	pop    %rbp
+  802444:	c3                   	ret
+    ssize_t readsz = 0;
+  802445:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  80244c:	00 
+  80244d:	eb 83                	jmp    8023d2 <devfile_read+0x9f>
+
+000000000080244f <open>:
+open(const char *path, int mode) {
+  80244f:	55                   	push   %rbp
+  802450:	48 89 e5             	mov    %rsp,%rbp
+  802453:	41 55                	push   %r13
+  802455:	41 54                	push   %r12
+  802457:	53                   	push   %rbx
+  802458:	48 83 ec 18          	sub    $0x18,%rsp
+  80245c:	49 89 fc             	mov    %rdi,%r12
+  80245f:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  802462:	48 b8 fe 0d 80 00 00 	movabs $0x800dfe,%rax
+  802469:	00 00 00 
+  80246c:	ff d0                	call   *%rax
+  80246e:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802474:	0f 87 8a 00 00 00    	ja     802504 <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  80247a:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  80247e:	48 b8 32 1a 80 00 00 	movabs $0x801a32,%rax
+  802485:	00 00 00 
+  802488:	ff d0                	call   *%rax
+  80248a:	89 c3                	mov    %eax,%ebx
+  80248c:	85 c0                	test   %eax,%eax
+  80248e:	78 50                	js     8024e0 <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  802490:	4c 89 e6             	mov    %r12,%rsi
+  802493:	48 bb 00 60 80 00 00 	movabs $0x806000,%rbx
+  80249a:	00 00 00 
+  80249d:	48 89 df             	mov    %rbx,%rdi
+  8024a0:	48 b8 3c 0e 80 00 00 	movabs $0x800e3c,%rax
+  8024a7:	00 00 00 
+  8024aa:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  8024ac:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  8024b3:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8024b7:	bf 01 00 00 00       	mov    $0x1,%edi
+  8024bc:	48 b8 b9 20 80 00 00 	movabs $0x8020b9,%rax
+  8024c3:	00 00 00 
+  8024c6:	ff d0                	call   *%rax
+  8024c8:	89 c3                	mov    %eax,%ebx
+  8024ca:	85 c0                	test   %eax,%eax
+  8024cc:	78 1f                	js     8024ed <open+0x9e>
+    return fd2num(fd);
+  8024ce:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8024d2:	48 b8 8b 19 80 00 00 	movabs $0x80198b,%rax
+  8024d9:	00 00 00 
+  8024dc:	ff d0                	call   *%rax
+  8024de:	89 c3                	mov    %eax,%ebx
+}
+  8024e0:	89 d8                	mov    %ebx,%eax
+  8024e2:	48 83 c4 18          	add    $0x18,%rsp
+  8024e6:	5b                   	pop    %rbx
+  8024e7:	41 5c                	pop    %r12
+  8024e9:	41 5d                	pop    %r13
+  8024eb:	5d                   	pop    %rbp
+  8024ec:	c3                   	ret
+        fd_close(fd, 0);
+  8024ed:	be 00 00 00 00       	mov    $0x0,%esi
+  8024f2:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8024f6:	48 b8 07 1b 80 00 00 	movabs $0x801b07,%rax
+  8024fd:	00 00 00 
+  802500:	ff d0                	call   *%rax
+        return res;
+  802502:	eb dc                	jmp    8024e0 <open+0x91>
+        return -E_BAD_PATH;
+  802504:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  802509:	eb d5                	jmp    8024e0 <open+0x91>
+
+000000000080250b <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  80250b:	55                   	push   %rbp
+  80250c:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc(FSREQ_SYNC, NULL);
+  80250f:	be 00 00 00 00       	mov    $0x0,%esi
+  802514:	bf 08 00 00 00       	mov    $0x8,%edi
+  802519:	48 b8 b9 20 80 00 00 	movabs $0x8020b9,%rax
+  802520:	00 00 00 
+  802523:	ff d0                	call   *%rax
+}
+  802525:	5d                   	pop    %rbp
+  802526:	c3                   	ret
+
+0000000000802527 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  802527:	55                   	push   %rbp
+  802528:	48 89 e5             	mov    %rsp,%rbp
+  80252b:	41 54                	push   %r12
+  80252d:	53                   	push   %rbx
+  80252e:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802531:	48 b8 9d 19 80 00 00 	movabs $0x80199d,%rax
+  802538:	00 00 00 
+  80253b:	ff d0                	call   *%rax
+  80253d:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  802540:	48 be a0 38 80 00 00 	movabs $0x8038a0,%rsi
+  802547:	00 00 00 
+  80254a:	48 89 df             	mov    %rbx,%rdi
+  80254d:	48 b8 3c 0e 80 00 00 	movabs $0x800e3c,%rax
+  802554:	00 00 00 
+  802557:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  802559:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  80255e:	41 2b 04 24          	sub    (%r12),%eax
+  802562:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  802568:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  80256f:	00 00 00 
+    stat->st_dev = &devpipe;
+  802572:	48 b8 60 40 80 00 00 	movabs $0x804060,%rax
+  802579:	00 00 00 
+  80257c:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  802583:	b8 00 00 00 00       	mov    $0x0,%eax
+  802588:	5b                   	pop    %rbx
+  802589:	41 5c                	pop    %r12
+  80258b:	5d                   	pop    %rbp
+  80258c:	c3                   	ret
+
+000000000080258d <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  80258d:	55                   	push   %rbp
+  80258e:	48 89 e5             	mov    %rsp,%rbp
+  802591:	41 54                	push   %r12
+  802593:	53                   	push   %rbx
+  802594:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  802597:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80259c:	48 89 fe             	mov    %rdi,%rsi
+  80259f:	bf 00 00 00 00       	mov    $0x0,%edi
+  8025a4:	49 bc b8 14 80 00 00 	movabs $0x8014b8,%r12
+  8025ab:	00 00 00 
+  8025ae:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  8025b1:	48 89 df             	mov    %rbx,%rdi
+  8025b4:	48 b8 9d 19 80 00 00 	movabs $0x80199d,%rax
+  8025bb:	00 00 00 
+  8025be:	ff d0                	call   *%rax
+  8025c0:	48 89 c6             	mov    %rax,%rsi
+  8025c3:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8025c8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8025cd:	41 ff d4             	call   *%r12
+}
+  8025d0:	5b                   	pop    %rbx
+  8025d1:	41 5c                	pop    %r12
+  8025d3:	5d                   	pop    %rbp
+  8025d4:	c3                   	ret
+
+00000000008025d5 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8025d5:	55                   	push   %rbp
+  8025d6:	48 89 e5             	mov    %rsp,%rbp
+  8025d9:	41 57                	push   %r15
+  8025db:	41 56                	push   %r14
+  8025dd:	41 55                	push   %r13
+  8025df:	41 54                	push   %r12
+  8025e1:	53                   	push   %rbx
+  8025e2:	48 83 ec 18          	sub    $0x18,%rsp
+  8025e6:	49 89 fc             	mov    %rdi,%r12
+  8025e9:	49 89 f5             	mov    %rsi,%r13
+  8025ec:	49 89 d7             	mov    %rdx,%r15
+  8025ef:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8025f3:	48 b8 9d 19 80 00 00 	movabs $0x80199d,%rax
+  8025fa:	00 00 00 
+  8025fd:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  8025ff:	4d 85 ff             	test   %r15,%r15
+  802602:	0f 84 af 00 00 00    	je     8026b7 <devpipe_write+0xe2>
+  802608:	48 89 c3             	mov    %rax,%rbx
+  80260b:	4c 89 f8             	mov    %r15,%rax
+  80260e:	4d 89 ef             	mov    %r13,%r15
+  802611:	4c 01 e8             	add    %r13,%rax
+  802614:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802618:	49 bd c0 13 80 00 00 	movabs $0x8013c0,%r13
+  80261f:	00 00 00 
+            sys_yield();
+  802622:	49 be 5d 13 80 00 00 	movabs $0x80135d,%r14
+  802629:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  80262c:	8b 73 04             	mov    0x4(%rbx),%esi
+  80262f:	48 63 ce             	movslq %esi,%rcx
+  802632:	48 63 03             	movslq (%rbx),%rax
+  802635:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  80263b:	48 39 c1             	cmp    %rax,%rcx
+  80263e:	72 2e                	jb     80266e <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802640:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802645:	48 89 da             	mov    %rbx,%rdx
+  802648:	be 00 10 00 00       	mov    $0x1000,%esi
+  80264d:	4c 89 e7             	mov    %r12,%rdi
+  802650:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  802653:	85 c0                	test   %eax,%eax
+  802655:	74 66                	je     8026bd <devpipe_write+0xe8>
+            sys_yield();
+  802657:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  80265a:	8b 73 04             	mov    0x4(%rbx),%esi
+  80265d:	48 63 ce             	movslq %esi,%rcx
+  802660:	48 63 03             	movslq (%rbx),%rax
+  802663:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  802669:	48 39 c1             	cmp    %rax,%rcx
+  80266c:	73 d2                	jae    802640 <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  80266e:	41 0f b6 3f          	movzbl (%r15),%edi
+  802672:	48 89 ca             	mov    %rcx,%rdx
+  802675:	48 c1 ea 03          	shr    $0x3,%rdx
+  802679:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  802680:	08 10 20 
+  802683:	48 f7 e2             	mul    %rdx
+  802686:	48 c1 ea 06          	shr    $0x6,%rdx
+  80268a:	48 89 d0             	mov    %rdx,%rax
+  80268d:	48 c1 e0 09          	shl    $0x9,%rax
+  802691:	48 29 d0             	sub    %rdx,%rax
+  802694:	48 c1 e0 03          	shl    $0x3,%rax
+  802698:	48 29 c1             	sub    %rax,%rcx
+  80269b:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  8026a0:	83 c6 01             	add    $0x1,%esi
+  8026a3:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8026a6:	49 83 c7 01          	add    $0x1,%r15
+  8026aa:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8026ae:	49 39 c7             	cmp    %rax,%r15
+  8026b1:	0f 85 75 ff ff ff    	jne    80262c <devpipe_write+0x57>
+    return n;
+  8026b7:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8026bb:	eb 05                	jmp    8026c2 <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  8026bd:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8026c2:	48 83 c4 18          	add    $0x18,%rsp
+  8026c6:	5b                   	pop    %rbx
+  8026c7:	41 5c                	pop    %r12
+  8026c9:	41 5d                	pop    %r13
+  8026cb:	41 5e                	pop    %r14
+  8026cd:	41 5f                	pop    %r15
+  8026cf:	5d                   	pop    %rbp
+  8026d0:	c3                   	ret
+
+00000000008026d1 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  8026d1:	55                   	push   %rbp
+  8026d2:	48 89 e5             	mov    %rsp,%rbp
+  8026d5:	41 57                	push   %r15
+  8026d7:	41 56                	push   %r14
+  8026d9:	41 55                	push   %r13
+  8026db:	41 54                	push   %r12
+  8026dd:	53                   	push   %rbx
+  8026de:	48 83 ec 18          	sub    $0x18,%rsp
+  8026e2:	49 89 fc             	mov    %rdi,%r12
+  8026e5:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  8026e9:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8026ed:	48 b8 9d 19 80 00 00 	movabs $0x80199d,%rax
+  8026f4:	00 00 00 
+  8026f7:	ff d0                	call   *%rax
+  8026f9:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  8026fc:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802702:	49 bd c0 13 80 00 00 	movabs $0x8013c0,%r13
+  802709:	00 00 00 
+            sys_yield();
+  80270c:	49 be 5d 13 80 00 00 	movabs $0x80135d,%r14
+  802713:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  802716:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  80271b:	74 7d                	je     80279a <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  80271d:	8b 03                	mov    (%rbx),%eax
+  80271f:	3b 43 04             	cmp    0x4(%rbx),%eax
+  802722:	75 26                	jne    80274a <devpipe_read+0x79>
+            if (i > 0) return i;
+  802724:	4d 85 ff             	test   %r15,%r15
+  802727:	75 77                	jne    8027a0 <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802729:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80272e:	48 89 da             	mov    %rbx,%rdx
+  802731:	be 00 10 00 00       	mov    $0x1000,%esi
+  802736:	4c 89 e7             	mov    %r12,%rdi
+  802739:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  80273c:	85 c0                	test   %eax,%eax
+  80273e:	74 72                	je     8027b2 <devpipe_read+0xe1>
+            sys_yield();
+  802740:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  802743:	8b 03                	mov    (%rbx),%eax
+  802745:	3b 43 04             	cmp    0x4(%rbx),%eax
+  802748:	74 df                	je     802729 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  80274a:	48 63 c8             	movslq %eax,%rcx
+  80274d:	48 89 ca             	mov    %rcx,%rdx
+  802750:	48 c1 ea 03          	shr    $0x3,%rdx
+  802754:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  80275b:	08 10 20 
+  80275e:	48 89 d0             	mov    %rdx,%rax
+  802761:	48 f7 e6             	mul    %rsi
+  802764:	48 c1 ea 06          	shr    $0x6,%rdx
+  802768:	48 89 d0             	mov    %rdx,%rax
+  80276b:	48 c1 e0 09          	shl    $0x9,%rax
+  80276f:	48 29 d0             	sub    %rdx,%rax
+  802772:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  802779:	00 
+  80277a:	48 89 c8             	mov    %rcx,%rax
+  80277d:	48 29 d0             	sub    %rdx,%rax
+  802780:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  802785:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  802789:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  80278d:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  802790:	49 83 c7 01          	add    $0x1,%r15
+  802794:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  802798:	75 83                	jne    80271d <devpipe_read+0x4c>
+    return n;
+  80279a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80279e:	eb 03                	jmp    8027a3 <devpipe_read+0xd2>
+            if (i > 0) return i;
+  8027a0:	4c 89 f8             	mov    %r15,%rax
+}
+  8027a3:	48 83 c4 18          	add    $0x18,%rsp
+  8027a7:	5b                   	pop    %rbx
+  8027a8:	41 5c                	pop    %r12
+  8027aa:	41 5d                	pop    %r13
+  8027ac:	41 5e                	pop    %r14
+  8027ae:	41 5f                	pop    %r15
+  8027b0:	5d                   	pop    %rbp
+  8027b1:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  8027b2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027b7:	eb ea                	jmp    8027a3 <devpipe_read+0xd2>
+
+00000000008027b9 <pipe>:
+pipe(int pfd[2]) {
+  8027b9:	55                   	push   %rbp
+  8027ba:	48 89 e5             	mov    %rsp,%rbp
+  8027bd:	41 55                	push   %r13
+  8027bf:	41 54                	push   %r12
+  8027c1:	53                   	push   %rbx
+  8027c2:	48 81 ec b8 00 00 00 	sub    $0xb8,%rsp
+  8027c9:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8027cc:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  8027d0:	48 b8 32 1a 80 00 00 	movabs $0x801a32,%rax
+  8027d7:	00 00 00 
+  8027da:	ff d0                	call   *%rax
+  8027dc:	89 c3                	mov    %eax,%ebx
+  8027de:	85 c0                	test   %eax,%eax
+  8027e0:	0f 88 51 01 00 00    	js     802937 <pipe+0x17e>
+        (res = fd_alloc_from(fd2num(fd0) + 1, &fd1)) < 0) goto err;
+  8027e6:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8027ea:	48 b8 8b 19 80 00 00 	movabs $0x80198b,%rax
+  8027f1:	00 00 00 
+  8027f4:	ff d0                	call   *%rax
+  8027f6:	8d 78 01             	lea    0x1(%rax),%edi
+  8027f9:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8027fd:	48 b8 b9 19 80 00 00 	movabs $0x8019b9,%rax
+  802804:	00 00 00 
+  802807:	ff d0                	call   *%rax
+  802809:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  80280b:	85 c0                	test   %eax,%eax
+  80280d:	0f 88 24 01 00 00    	js     802937 <pipe+0x17e>
+    va = fd2data(fd0);
+  802813:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802817:	48 bb 9d 19 80 00 00 	movabs $0x80199d,%rbx
+  80281e:	00 00 00 
+  802821:	ff d3                	call   *%rbx
+  802823:	49 89 c5             	mov    %rax,%r13
+    struct RegionOp ops[] = {
+  802826:	48 8d bd 30 ff ff ff 	lea    -0xd0(%rbp),%rdi
+  80282d:	b9 14 00 00 00       	mov    $0x14,%ecx
+  802832:	b8 00 00 00 00       	mov    $0x0,%eax
+  802837:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+  80283a:	c7 85 34 ff ff ff 46 	movl   $0x46,-0xcc(%rbp)
+  802841:	00 00 00 
+  802844:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802848:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+  80284f:	48 c7 85 50 ff ff ff 	movq   $0x1000,-0xb0(%rbp)
+  802856:	00 10 00 00 
+  80285a:	c7 85 5c ff ff ff 46 	movl   $0x46,-0xa4(%rbp)
+  802861:	00 00 00 
+            {.type = REGION_ALLOC, .dstva = (uintptr_t)fd1, .size = PAGE_SIZE, .perm = PROT_RW | PROT_SHARE},
+  802864:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+    struct RegionOp ops[] = {
+  802868:	48 89 bd 70 ff ff ff 	mov    %rdi,-0x90(%rbp)
+  80286f:	48 c7 85 78 ff ff ff 	movq   $0x1000,-0x88(%rbp)
+  802876:	00 10 00 00 
+  80287a:	c7 45 84 46 00 00 00 	movl   $0x46,-0x7c(%rbp)
+  802881:	4c 89 6d 98          	mov    %r13,-0x68(%rbp)
+  802885:	48 c7 45 a0 00 10 00 	movq   $0x1000,-0x60(%rbp)
+  80288c:	00 
+  80288d:	c7 45 a8 01 00 00 00 	movl   $0x1,-0x58(%rbp)
+  802894:	c7 45 ac 46 00 00 00 	movl   $0x46,-0x54(%rbp)
+  80289b:	4c 89 6d b8          	mov    %r13,-0x48(%rbp)
+            {.type = REGION_MAP, .srcva = (uintptr_t)va, .dstva = (uintptr_t)fd2data(fd1), .size = PAGE_SIZE, .perm = PROT_RW | PROT_SHARE},
+  80289f:	ff d3                	call   *%rbx
+    struct RegionOp ops[] = {
+  8028a1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8028a5:	48 c7 45 c8 00 10 00 	movq   $0x1000,-0x38(%rbp)
+  8028ac:	00 
+    if ((res = sys_region_batch(ops, sizeof ops / sizeof *ops)) < 0) goto err1;
+  8028ad:	be 04 00 00 00       	mov    $0x4,%esi
+  8028b2:	48 8d bd 30 ff ff ff 	lea    -0xd0(%rbp),%rdi
+  8028b9:	48 b8 1f 15 80 00 00 	movabs $0x80151f,%rax
+  8028c0:	00 00 00 
+  8028c3:	ff d0                	call   *%rax
+  8028c5:	89 c3                	mov    %eax,%ebx
+  8028c7:	85 c0                	test   %eax,%eax
+  8028c9:	0f 88 ad 00 00 00    	js     80297c <pipe+0x1c3>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8028cf:	be 00 10 00 00       	mov    $0x1000,%esi
+  8028d4:	4c 89 ef             	mov    %r13,%rdi
+  8028d7:	48 b8 8e 13 80 00 00 	movabs $0x80138e,%rax
+  8028de:	00 00 00 
+  8028e1:	ff d0                	call   *%rax
+  8028e3:	83 f8 02             	cmp    $0x2,%eax
+  8028e6:	75 5f                	jne    802947 <pipe+0x18e>
+    fd0->fd_dev_id = devpipe.dev_id;
+  8028e8:	a1 60 40 80 00 00 00 	movabs 0x804060,%eax
+  8028ef:	00 00 
+  8028f1:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8028f5:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  8028f7:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8028fb:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  802902:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  802906:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  802908:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80290c:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  802913:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802917:	48 bb 8b 19 80 00 00 	movabs $0x80198b,%rbx
+  80291e:	00 00 00 
+  802921:	ff d3                	call   *%rbx
+  802923:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  802927:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  80292b:	ff d3                	call   *%rbx
+  80292d:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  802932:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  802937:	89 d8                	mov    %ebx,%eax
+  802939:	48 81 c4 b8 00 00 00 	add    $0xb8,%rsp
+  802940:	5b                   	pop    %rbx
+  802941:	41 5c                	pop    %r12
+  802943:	41 5d                	pop    %r13
+  802945:	5d                   	pop    %rbp
+  802946:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  802947:	48 b9 d0 38 80 00 00 	movabs $0x8038d0,%rcx
+  80294e:	00 00 00 
+  802951:	48 ba a7 38 80 00 00 	movabs $0x8038a7,%rdx
+  802958:	00 00 00 
+  80295b:	be 33 00 00 00       	mov    $0x33,%esi
+  802960:	48 bf bc 38 80 00 00 	movabs $0x8038bc,%rdi
+  802967:	00 00 00 
+  80296a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80296f:	49 b8 c7 03 80 00 00 	movabs $0x8003c7,%r8
+  802976:	00 00 00 
+  802979:	41 ff d0             	call   *%r8
+        ops[i].type = REGION_UNMAP;
+  80297c:	c7 85 30 ff ff ff 02 	movl   $0x2,-0xd0(%rbp)
+  802983:	00 00 00 
+  802986:	c7 85 58 ff ff ff 02 	movl   $0x2,-0xa8(%rbp)
+  80298d:	00 00 00 
+  802990:	c7 45 80 02 00 00 00 	movl   $0x2,-0x80(%rbp)
+  802997:	c7 45 a8 02 00 00 00 	movl   $0x2,-0x58(%rbp)
+    sys_region_batch(ops, sizeof ops / sizeof *ops);
+  80299e:	be 04 00 00 00       	mov    $0x4,%esi
+  8029a3:	48 8d bd 30 ff ff ff 	lea    -0xd0(%rbp),%rdi
+  8029aa:	48 b8 1f 15 80 00 00 	movabs $0x80151f,%rax
+  8029b1:	00 00 00 
+  8029b4:	ff d0                	call   *%rax
+  8029b6:	e9 7c ff ff ff       	jmp    802937 <pipe+0x17e>
+
+00000000008029bb <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  8029bb:	55                   	push   %rbp
+  8029bc:	48 89 e5             	mov    %rsp,%rbp
+  8029bf:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8029c3:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8029c7:	48 b8 4c 1a 80 00 00 	movabs $0x801a4c,%rax
+  8029ce:	00 00 00 
+  8029d1:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8029d3:	85 c0                	test   %eax,%eax
+  8029d5:	78 35                	js     802a0c <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  8029d7:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8029db:	48 b8 9d 19 80 00 00 	movabs $0x80199d,%rax
+  8029e2:	00 00 00 
+  8029e5:	ff d0                	call   *%rax
+  8029e7:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8029ea:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8029ef:	be 00 10 00 00       	mov    $0x1000,%esi
+  8029f4:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8029f8:	48 b8 c0 13 80 00 00 	movabs $0x8013c0,%rax
+  8029ff:	00 00 00 
+  802a02:	ff d0                	call   *%rax
+  802a04:	85 c0                	test   %eax,%eax
+  802a06:	0f 94 c0             	sete   %al
+  802a09:	0f b6 c0             	movzbl %al,%eax
+}
+  802a0c:	c9                   	leave
+  802a0d:	c3                   	ret
+
+0000000000802a0e <wait>:
+#include <inc/lib.h>
+
+/* Waits until 'envid' exits. */
+void
+wait(envid_t envid) {
+  802a0e:	55                   	push   %rbp
+  802a0f:	48 89 e5             	mov    %rsp,%rbp
+  802a12:	41 55                	push   %r13
+  802a14:	41 54                	push   %r12
+  802a16:	53                   	push   %rbx
+  802a17:	48 83 ec 08          	sub    $0x8,%rsp
+    assert(envid != 0);
+  802a1b:	85 ff                	test   %edi,%edi
+  802a1d:	74 73                	je     802a92 <wait+0x84>
+  802a1f:	41 89 fc             	mov    %edi,%r12d
+
+    const volatile struct Env *env = &envs[ENVX(envid)];
+  802a22:	89 f8                	mov    %edi,%eax
+  802a24:	25 ff 03 00 00       	and    $0x3ff,%eax
+
+    while (env->env_id == envid &&
+  802a29:	89 f9                	mov    %edi,%ecx
+  802a2b:	81 e1 ff 03 00 00    	and    $0x3ff,%ecx
+  802a31:	48 69 c9 d0 01 00 00 	imul   $0x1d0,%rcx,%rcx
+  802a38:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  802a3f:	00 00 00 
+  802a42:	48 01 ca             	add    %rcx,%rdx
+  802a45:	8b 92 e0 00 00 00    	mov    0xe0(%rdx),%edx
+  802a4b:	39 d7                	cmp    %edx,%edi
+  802a4d:	75 38                	jne    802a87 <wait+0x79>
+           env->env_status != ENV_FREE) {
+  802a4f:	48 98                	cltq
+  802a51:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+  802a58:	48 bb 00 00 c0 1f 80 	movabs $0x801fc00000,%rbx
+  802a5f:	00 00 00 
+  802a62:	48 01 c3             	add    %rax,%rbx
+        sys_yield();
+  802a65:	49 bd 5d 13 80 00 00 	movabs $0x80135d,%r13
+  802a6c:	00 00 00 
+           env->env_status != ENV_FREE) {
+  802a6f:	8b 83 ec 00 00 00    	mov    0xec(%rbx),%eax
+    while (env->env_id == envid &&
+  802a75:	85 c0                	test   %eax,%eax
+  802a77:	74 0e                	je     802a87 <wait+0x79>
+        sys_yield();
+  802a79:	41 ff d5             	call   *%r13
+    while (env->env_id == envid &&
+  802a7c:	8b 83 e0 00 00 00    	mov    0xe0(%rbx),%eax
+  802a82:	44 39 e0             	cmp    %r12d,%eax
+  802a85:	74 e8                	je     802a6f <wait+0x61>
+    }
+}
+  802a87:	48 83 c4 08          	add    $0x8,%rsp
+  802a8b:	5b                   	pop    %rbx
+  802a8c:	41 5c                	pop    %r12
+  802a8e:	41 5d                	pop    %r13
+  802a90:	5d                   	pop    %rbp
+  802a91:	c3                   	ret
+    assert(envid != 0);
+  802a92:	48 b9 f4 38 80 00 00 	movabs $0x8038f4,%rcx
+  802a99:	00 00 00 
+  802a9c:	48 ba a7 38 80 00 00 	movabs $0x8038a7,%rdx
+  802aa3:	00 00 00 
+  802aa6:	be 06 00 00 00       	mov    $0x6,%esi
+  802aab:	48 bf ff 38 80 00 00 	movabs $0x8038ff,%rdi
+  802ab2:	00 00 00 
+  802ab5:	b8 00 00 00 00       	mov    $0x0,%eax
+  802aba:	49 b8 c7 03 80 00 00 	movabs $0x8003c7,%r8
+  802ac1:	00 00 00 
+  802ac4:	41 ff d0             	call   *%r8
+
+0000000000802ac7 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  802ac7:	48 89 f8             	mov    %rdi,%rax
+  802aca:	48 c1 e8 27          	shr    $0x27,%rax
+  802ace:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  802ad5:	01 00 00 
+  802ad8:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802adc:	f6 c2 01             	test   $0x1,%dl
+  802adf:	74 6d                	je     802b4e <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  802ae1:	48 89 f8             	mov    %rdi,%rax
+  802ae4:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802ae8:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802aef:	01 00 00 
+  802af2:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802af6:	f6 c2 01             	test   $0x1,%dl
+  802af9:	74 62                	je     802b5d <get_uvpt_entry+0x96>
+  802afb:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802b02:	01 00 00 
+  802b05:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802b09:	f6 c2 80             	test   $0x80,%dl
+  802b0c:	75 4f                	jne    802b5d <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  802b0e:	48 89 f8             	mov    %rdi,%rax
+  802b11:	48 c1 e8 15          	shr    $0x15,%rax
+  802b15:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802b1c:	01 00 00 
+  802b1f:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802b23:	f6 c2 01             	test   $0x1,%dl
+  802b26:	74 44                	je     802b6c <get_uvpt_entry+0xa5>
+  802b28:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802b2f:	01 00 00 
+  802b32:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802b36:	f6 c2 80             	test   $0x80,%dl
+  802b39:	75 31                	jne    802b6c <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  802b3b:	48 c1 ef 0c          	shr    $0xc,%rdi
+  802b3f:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802b46:	01 00 00 
+  802b49:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  802b4d:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  802b4e:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  802b55:	01 00 00 
+  802b58:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802b5c:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  802b5d:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802b64:	01 00 00 
+  802b67:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802b6b:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  802b6c:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802b73:	01 00 00 
+  802b76:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802b7a:	c3                   	ret
+
+0000000000802b7b <get_prot>:
+
+int
+get_prot(void *va) {
+  802b7b:	55                   	push   %rbp
+  802b7c:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  802b7f:	48 b8 c7 2a 80 00 00 	movabs $0x802ac7,%rax
+  802b86:	00 00 00 
+  802b89:	ff d0                	call   *%rax
+  802b8b:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  802b8e:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  802b93:	89 c1                	mov    %eax,%ecx
+  802b95:	83 c9 04             	or     $0x4,%ecx
+  802b98:	f6 c2 01             	test   $0x1,%dl
+  802b9b:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  802b9e:	89 c1                	mov    %eax,%ecx
+  802ba0:	83 c9 02             	or     $0x2,%ecx
+  802ba3:	f6 c2 02             	test   $0x2,%dl
+  802ba6:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  802ba9:	89 c1                	mov    %eax,%ecx
+  802bab:	83 c9 01             	or     $0x1,%ecx
+  802bae:	48 85 d2             	test   %rdx,%rdx
+  802bb1:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  802bb4:	89 c1                	mov    %eax,%ecx
+  802bb6:	83 c9 40             	or     $0x40,%ecx
+  802bb9:	f6 c6 04             	test   $0x4,%dh
+  802bbc:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  802bbf:	5d                   	pop    %rbp
+  802bc0:	c3                   	ret
+
+0000000000802bc1 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  802bc1:	55                   	push   %rbp
+  802bc2:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  802bc5:	48 b8 c7 2a 80 00 00 	movabs $0x802ac7,%rax
+  802bcc:	00 00 00 
+  802bcf:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  802bd1:	48 c1 e8 06          	shr    $0x6,%rax
+  802bd5:	83 e0 01             	and    $0x1,%eax
+}
+  802bd8:	5d                   	pop    %rbp
+  802bd9:	c3                   	ret
+
+0000000000802bda <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  802bda:	55                   	push   %rbp
+  802bdb:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  802bde:	48 b8 c7 2a 80 00 00 	movabs $0x802ac7,%rax
+  802be5:	00 00 00 
+  802be8:	ff d0                	call   *%rax
+  802bea:	83 e0 01             	and    $0x1,%eax
+}
+  802bed:	5d                   	pop    %rbp
+  802bee:	c3                   	ret
+
+0000000000802bef <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  802bef:	55                   	push   %rbp
+  802bf0:	48 89 e5             	mov    %rsp,%rbp
+  802bf3:	41 57                	push   %r15
+  802bf5:	41 56                	push   %r14
+  802bf7:	41 55                	push   %r13
+  802bf9:	41 54                	push   %r12
+  802bfb:	53                   	push   %rbx
+  802bfc:	48 83 ec 38          	sub    $0x38,%rsp
+  802c00:	49 89 f7             	mov    %rsi,%r15
+  802c03:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+                    }
+                    continue;
+                }
+                for (int ptei = 0; ptei < PT_ENTRY_COUNT; ptei++) {
+                    uintptr_t pte_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, pdei, ptei, 0);
+                    pte_t pte = uvpt[VPT(pte_addr)];
+  802c09:	49 bd 00 00 00 00 00 	movabs $0x10000000000,%r13
+  802c10:	01 00 00 
+  802c13:	4d 89 e6             	mov    %r12,%r14
+  802c16:	49 89 fc             	mov    %rdi,%r12
+  802c19:	e9 19 01 00 00       	jmp    802d37 <foreach_shared_region+0x148>
+  802c1e:	48 89 5d b0          	mov    %rbx,-0x50(%rbp)
+  802c22:	4c 89 75 a8          	mov    %r14,-0x58(%rbp)
+  802c26:	eb 52                	jmp    802c7a <foreach_shared_region+0x8b>
+                for (int ptei = 0; ptei < PT_ENTRY_COUNT; ptei++) {
+  802c28:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802c2f:	48 81 fb 00 00 20 00 	cmp    $0x200000,%rbx
+  802c36:	74 2e                	je     802c66 <foreach_shared_region+0x77>
+                    uintptr_t pte_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, pdei, ptei, 0);
+  802c38:	48 89 df             	mov    %rbx,%rdi
+  802c3b:	4c 09 f7             	or     %r14,%rdi
+                    pte_t pte = uvpt[VPT(pte_addr)];
+  802c3e:	48 89 f8             	mov    %rdi,%rax
+  802c41:	48 c1 e8 0c          	shr    $0xc,%rax
+  802c45:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+                    if ((pte & PTE_P) && (pte & PTE_SHARE)) {
+  802c4a:	25 01 04 00 00       	and    $0x401,%eax
+  802c4f:	48 3d 01 04 00 00    	cmp    $0x401,%rax
+  802c55:	75 d1                	jne    802c28 <foreach_shared_region+0x39>
+                        fun((void*)pte_addr, (void*)(pte_addr + PAGE_SIZE), arg);
+  802c57:	48 8d b7 00 10 00 00 	lea    0x1000(%rdi),%rsi
+  802c5e:	4c 89 fa             	mov    %r15,%rdx
+  802c61:	41 ff d4             	call   *%r12
+  802c64:	eb c2                	jmp    802c28 <foreach_shared_region+0x39>
+            for (int pdei = 0; pdei < PD_ENTRY_COUNT; pdei++) {
+  802c66:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  802c6d:	00 
+  802c6e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802c72:	48 3d 00 00 00 40    	cmp    $0x40000000,%rax
+  802c78:	74 46                	je     802cc0 <foreach_shared_region+0xd1>
+                uintptr_t pde_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, pdei, 0, 0);
+  802c7a:	4c 8b 75 c8          	mov    -0x38(%rbp),%r14
+  802c7e:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802c82:	49 09 c6             	or     %rax,%r14
+                pde_t pde = uvpd[VPD(pde_addr)];
+  802c85:	4c 89 f0             	mov    %r14,%rax
+  802c88:	48 c1 e8 15          	shr    $0x15,%rax
+  802c8c:	48 b9 00 00 00 80 00 	movabs $0x10080000000,%rcx
+  802c93:	01 00 00 
+  802c96:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+                if (!(pde & PTE_P)) {
+  802c9a:	a8 01                	test   $0x1,%al
+  802c9c:	74 c8                	je     802c66 <foreach_shared_region+0x77>
+                if (pde & PTE_PS) {
+  802c9e:	48 89 c3             	mov    %rax,%rbx
+  802ca1:	81 e3 80 00 00 00    	and    $0x80,%ebx
+  802ca7:	74 8f                	je     802c38 <foreach_shared_region+0x49>
+                    if (pde & PTE_SHARE) {
+  802ca9:	f6 c4 04             	test   $0x4,%ah
+  802cac:	74 b8                	je     802c66 <foreach_shared_region+0x77>
+                        fun((void*)pde_addr, (void*)(pde_addr + 1024 * 1024 * 2), arg);
+  802cae:	49 8d b6 00 00 20 00 	lea    0x200000(%r14),%rsi
+  802cb5:	4c 89 fa             	mov    %r15,%rdx
+  802cb8:	4c 89 f7             	mov    %r14,%rdi
+  802cbb:	41 ff d4             	call   *%r12
+  802cbe:	eb a6                	jmp    802c66 <foreach_shared_region+0x77>
+  802cc0:	48 8b 5d b0          	mov    -0x50(%rbp),%rbx
+  802cc4:	4c 8b 75 a8          	mov    -0x58(%rbp),%r14
+        for (int pdpei = 0; pdpei < PDP_ENTRY_COUNT; pdpei++) {
+  802cc8:	48 81 c3 00 00 00 40 	add    $0x40000000,%rbx
+  802ccf:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802cd6:	00 00 00 
+  802cd9:	48 39 c3             	cmp    %rax,%rbx
+  802cdc:	74 4c                	je     802d2a <foreach_shared_region+0x13b>
+            uintptr_t pdpe_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, 0, 0, 0);
+  802cde:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802ce2:	48 09 d8             	or     %rbx,%rax
+  802ce5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+            pdpe_t pdpe = uvpdp[VPDP(pdpe_addr)];
+  802ce9:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802ced:	48 b9 00 00 40 80 00 	movabs $0x10080400000,%rcx
+  802cf4:	01 00 00 
+  802cf7:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+            if (!(pdpe & PTE_P)) {
+  802cfb:	a8 01                	test   $0x1,%al
+  802cfd:	74 c9                	je     802cc8 <foreach_shared_region+0xd9>
+            if (pdpe & PTE_PS) {
+  802cff:	48 89 c1             	mov    %rax,%rcx
+  802d02:	81 e1 80 00 00 00    	and    $0x80,%ecx
+  802d08:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  802d0c:	0f 84 0c ff ff ff    	je     802c1e <foreach_shared_region+0x2f>
+                if (pdpe & PTE_SHARE) {
+  802d12:	f6 c4 04             	test   $0x4,%ah
+  802d15:	74 b1                	je     802cc8 <foreach_shared_region+0xd9>
+                    fun((void*)pdpe_addr, (void*)(pdpe_addr + 1024 * 1024 * 1024), arg); 
+  802d17:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  802d1b:	48 8d b7 00 00 00 40 	lea    0x40000000(%rdi),%rsi
+  802d22:	4c 89 fa             	mov    %r15,%rdx
+  802d25:	41 ff d4             	call   *%r12
+  802d28:	eb 9e                	jmp    802cc8 <foreach_shared_region+0xd9>
+    for (int pml4ei = 0; pml4ei < PML4_ENTRY_COUNT; pml4ei++) {
+  802d2a:	49 83 c6 01          	add    $0x1,%r14
+  802d2e:	49 81 fe 00 02 00 00 	cmp    $0x200,%r14
+  802d35:	74 24                	je     802d5b <foreach_shared_region+0x16c>
+        pml4e_t pml4e = uvpml4[VPML4(pml4_addr)];
+  802d37:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  802d3e:	01 00 00 
+  802d41:	4a 8b 04 f0          	mov    (%rax,%r14,8),%rax
+        if (!(pml4e & PTE_P)) {
+  802d45:	a8 01                	test   $0x1,%al
+  802d47:	74 e1                	je     802d2a <foreach_shared_region+0x13b>
+  802d49:	4c 89 f0             	mov    %r14,%rax
+  802d4c:	48 c1 e0 27          	shl    $0x27,%rax
+  802d50:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  802d54:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802d59:	eb 83                	jmp    802cde <foreach_shared_region+0xef>
+            }
+        }
+    }
+    
+    return 0;
+}
+  802d5b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d60:	48 83 c4 38          	add    $0x38,%rsp
+  802d64:	5b                   	pop    %rbx
+  802d65:	41 5c                	pop    %r12
+  802d67:	41 5d                	pop    %r13
+  802d69:	41 5e                	pop    %r14
+  802d6b:	41 5f                	pop    %r15
+  802d6d:	5d                   	pop    %rbp
+  802d6e:	c3                   	ret
+
+0000000000802d6f <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  802d6f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d74:	c3                   	ret
+
+0000000000802d75 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  802d75:	55                   	push   %rbp
+  802d76:	48 89 e5             	mov    %rsp,%rbp
+  802d79:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  802d7c:	48 be 0a 39 80 00 00 	movabs $0x80390a,%rsi
+  802d83:	00 00 00 
+  802d86:	48 b8 3c 0e 80 00 00 	movabs $0x800e3c,%rax
+  802d8d:	00 00 00 
+  802d90:	ff d0                	call   *%rax
+    return 0;
+}
+  802d92:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d97:	5d                   	pop    %rbp
+  802d98:	c3                   	ret
+
+0000000000802d99 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  802d99:	55                   	push   %rbp
+  802d9a:	48 89 e5             	mov    %rsp,%rbp
+  802d9d:	41 57                	push   %r15
+  802d9f:	41 56                	push   %r14
+  802da1:	41 55                	push   %r13
+  802da3:	41 54                	push   %r12
+  802da5:	53                   	push   %rbx
+  802da6:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  802dad:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  802db4:	48 85 d2             	test   %rdx,%rdx
+  802db7:	74 7a                	je     802e33 <devcons_write+0x9a>
+  802db9:	49 89 d6             	mov    %rdx,%r14
+  802dbc:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802dc2:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  802dc7:	49 bf 36 10 80 00 00 	movabs $0x801036,%r15
+  802dce:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  802dd1:	4c 89 f3             	mov    %r14,%rbx
+  802dd4:	48 29 f3             	sub    %rsi,%rbx
+  802dd7:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802ddc:	48 39 c3             	cmp    %rax,%rbx
+  802ddf:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  802de3:	4c 63 eb             	movslq %ebx,%r13
+  802de6:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  802ded:	48 01 c6             	add    %rax,%rsi
+  802df0:	4c 89 ea             	mov    %r13,%rdx
+  802df3:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802dfa:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  802dfd:	4c 89 ee             	mov    %r13,%rsi
+  802e00:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802e07:	48 b8 63 12 80 00 00 	movabs $0x801263,%rax
+  802e0e:	00 00 00 
+  802e11:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  802e13:	41 01 dc             	add    %ebx,%r12d
+  802e16:	49 63 f4             	movslq %r12d,%rsi
+  802e19:	4c 39 f6             	cmp    %r14,%rsi
+  802e1c:	72 b3                	jb     802dd1 <devcons_write+0x38>
+    return res;
+  802e1e:	49 63 c4             	movslq %r12d,%rax
+}
+  802e21:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  802e28:	5b                   	pop    %rbx
+  802e29:	41 5c                	pop    %r12
+  802e2b:	41 5d                	pop    %r13
+  802e2d:	41 5e                	pop    %r14
+  802e2f:	41 5f                	pop    %r15
+  802e31:	5d                   	pop    %rbp
+  802e32:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  802e33:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802e39:	eb e3                	jmp    802e1e <devcons_write+0x85>
+
+0000000000802e3b <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  802e3b:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  802e3e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802e43:	48 85 c0             	test   %rax,%rax
+  802e46:	74 55                	je     802e9d <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  802e48:	55                   	push   %rbp
+  802e49:	48 89 e5             	mov    %rsp,%rbp
+  802e4c:	41 55                	push   %r13
+  802e4e:	41 54                	push   %r12
+  802e50:	53                   	push   %rbx
+  802e51:	48 83 ec 08          	sub    $0x8,%rsp
+  802e55:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  802e58:	48 bb 90 12 80 00 00 	movabs $0x801290,%rbx
+  802e5f:	00 00 00 
+  802e62:	49 bc 5d 13 80 00 00 	movabs $0x80135d,%r12
+  802e69:	00 00 00 
+  802e6c:	eb 03                	jmp    802e71 <devcons_read+0x36>
+  802e6e:	41 ff d4             	call   *%r12
+  802e71:	ff d3                	call   *%rbx
+  802e73:	85 c0                	test   %eax,%eax
+  802e75:	74 f7                	je     802e6e <devcons_read+0x33>
+    if (c < 0) return c;
+  802e77:	48 63 d0             	movslq %eax,%rdx
+  802e7a:	78 13                	js     802e8f <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  802e7c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802e81:	83 f8 04             	cmp    $0x4,%eax
+  802e84:	74 09                	je     802e8f <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  802e86:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  802e8a:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  802e8f:	48 89 d0             	mov    %rdx,%rax
+  802e92:	48 83 c4 08          	add    $0x8,%rsp
+  802e96:	5b                   	pop    %rbx
+  802e97:	41 5c                	pop    %r12
+  802e99:	41 5d                	pop    %r13
+  802e9b:	5d                   	pop    %rbp
+  802e9c:	c3                   	ret
+  802e9d:	48 89 d0             	mov    %rdx,%rax
+  802ea0:	c3                   	ret
+
+0000000000802ea1 <cputchar>:
+cputchar(int ch) {
+  802ea1:	55                   	push   %rbp
+  802ea2:	48 89 e5             	mov    %rsp,%rbp
+  802ea5:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  802ea9:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  802ead:	be 01 00 00 00       	mov    $0x1,%esi
+  802eb2:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  802eb6:	48 b8 63 12 80 00 00 	movabs $0x801263,%rax
+  802ebd:	00 00 00 
+  802ec0:	ff d0                	call   *%rax
+}
+  802ec2:	c9                   	leave
+  802ec3:	c3                   	ret
+
+0000000000802ec4 <getchar>:
+getchar(void) {
+  802ec4:	55                   	push   %rbp
+  802ec5:	48 89 e5             	mov    %rsp,%rbp
+  802ec8:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  802ecc:	ba 01 00 00 00       	mov    $0x1,%edx
+  802ed1:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  802ed5:	bf 00 00 00 00       	mov    $0x0,%edi
+  802eda:	48 b8 2f 1d 80 00 00 	movabs $0x801d2f,%rax
+  802ee1:	00 00 00 
+  802ee4:	ff d0                	call   *%rax
+  802ee6:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  802ee8:	85 c0                	test   %eax,%eax
+  802eea:	78 06                	js     802ef2 <getchar+0x2e>
+  802eec:	74 08                	je     802ef6 <getchar+0x32>
+  802eee:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  802ef2:	89 d0                	mov    %edx,%eax
+  802ef4:	c9                   	leave
+  802ef5:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  802ef6:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  802efb:	eb f5                	jmp    802ef2 <getchar+0x2e>
+
+0000000000802efd <iscons>:
+iscons(int fdnum) {
+  802efd:	55                   	push   %rbp
+  802efe:	48 89 e5             	mov    %rsp,%rbp
+  802f01:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  802f05:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802f09:	48 b8 4c 1a 80 00 00 	movabs $0x801a4c,%rax
+  802f10:	00 00 00 
+  802f13:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802f15:	85 c0                	test   %eax,%eax
+  802f17:	78 18                	js     802f31 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  802f19:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802f1d:	48 b8 a0 40 80 00 00 	movabs $0x8040a0,%rax
+  802f24:	00 00 00 
+  802f27:	8b 00                	mov    (%rax),%eax
+  802f29:	39 02                	cmp    %eax,(%rdx)
+  802f2b:	0f 94 c0             	sete   %al
+  802f2e:	0f b6 c0             	movzbl %al,%eax
+}
+  802f31:	c9                   	leave
+  802f32:	c3                   	ret
+
+0000000000802f33 <opencons>:
+opencons(void) {
+  802f33:	55                   	push   %rbp
+  802f34:	48 89 e5             	mov    %rsp,%rbp
+  802f37:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802f3b:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  802f3f:	48 b8 32 1a 80 00 00 	movabs $0x801a32,%rax
+  802f46:	00 00 00 
+  802f49:	ff d0                	call   *%rax
+  802f4b:	85 c0                	test   %eax,%eax
+  802f4d:	78 49                	js     802f98 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  802f4f:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802f54:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802f59:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  802f5d:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f62:	48 b8 ec 13 80 00 00 	movabs $0x8013ec,%rax
+  802f69:	00 00 00 
+  802f6c:	ff d0                	call   *%rax
+  802f6e:	85 c0                	test   %eax,%eax
+  802f70:	78 26                	js     802f98 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  802f72:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802f76:	a1 a0 40 80 00 00 00 	movabs 0x8040a0,%eax
+  802f7d:	00 00 
+  802f7f:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  802f81:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802f85:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  802f8c:	48 b8 8b 19 80 00 00 	movabs $0x80198b,%rax
+  802f93:	00 00 00 
+  802f96:	ff d0                	call   *%rax
+}
+  802f98:	c9                   	leave
+  802f99:	c3                   	ret
+
+0000000000802f9a <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  802f9a:	55                   	push   %rbp
+  802f9b:	48 89 e5             	mov    %rsp,%rbp
+  802f9e:	41 55                	push   %r13
+  802fa0:	41 54                	push   %r12
+  802fa2:	53                   	push   %rbx
+  802fa3:	48 83 ec 08          	sub    $0x8,%rsp
+  802fa7:	49 89 fc             	mov    %rdi,%r12
+  802faa:	48 89 f7             	mov    %rsi,%rdi
+  802fad:	48 89 d3             	mov    %rdx,%rbx
+  802fb0:	49 89 cd             	mov    %rcx,%r13
+    // LAB 9: Your code here:
+    int res = sys_ipc_recv(!pg ? (void*)MAX_USER_ADDRESS : pg, !size ? 0 : *size);
+  802fb3:	be 00 00 00 00       	mov    $0x0,%esi
+  802fb8:	48 85 d2             	test   %rdx,%rdx
+  802fbb:	74 03                	je     802fc0 <ipc_recv+0x26>
+  802fbd:	48 8b 32             	mov    (%rdx),%rsi
+  802fc0:	48 85 ff             	test   %rdi,%rdi
+  802fc3:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802fca:	00 00 00 
+  802fcd:	48 0f 44 f8          	cmove  %rax,%rdi
+  802fd1:	48 b8 be 17 80 00 00 	movabs $0x8017be,%rax
+  802fd8:	00 00 00 
+  802fdb:	ff d0                	call   *%rax
+    if (res < 0) {
+  802fdd:	85 c0                	test   %eax,%eax
+  802fdf:	78 66                	js     803047 <ipc_recv+0xad>
+        if (size) {
+            *size = 0;
+        }
+        return res;
+    }
+    if (from_env_store) {
+  802fe1:	4d 85 e4             	test   %r12,%r12
+  802fe4:	74 14                	je     802ffa <ipc_recv+0x60>
+        *from_env_store = thisenv->env_ipc_from;
+  802fe6:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802fed:	00 00 00 
+  802ff0:	8b 80 ac 01 00 00    	mov    0x1ac(%rax),%eax
+  802ff6:	41 89 04 24          	mov    %eax,(%r12)
+    }
+    if (perm_store) {
+  802ffa:	4d 85 ed             	test   %r13,%r13
+  802ffd:	74 14                	je     803013 <ipc_recv+0x79>
+        *perm_store = thisenv->env_ipc_perm;
+  802fff:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  803006:	00 00 00 
+  803009:	8b 80 b0 01 00 00    	mov    0x1b0(%rax),%eax
+  80300f:	41 89 45 00          	mov    %eax,0x0(%r13)
+    }
+    if (size) {
+  803013:	48 85 db             	test   %rbx,%rbx
+  803016:	74 14                	je     80302c <ipc_recv+0x92>
+        *size = thisenv->env_ipc_maxsz;
+  803018:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  80301f:	00 00 00 
+  803022:	48 8b 80 a0 01 00 00 	mov    0x1a0(%rax),%rax
+  803029:	48 89 03             	mov    %rax,(%rbx)
+    }
+    return thisenv->env_ipc_value;
+  80302c:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  803033:	00 00 00 
+  803036:	8b 80 a8 01 00 00    	mov    0x1a8(%rax),%eax
+}
+  80303c:	48 83 c4 08          	add    $0x8,%rsp
+  803040:	5b                   	pop    %rbx
+  803041:	41 5c                	pop    %r12
+  803043:	41 5d                	pop    %r13
+  803045:	5d                   	pop    %rbp
+  803046:	c3                   	ret
+        if (from_env_store) {
+  803047:	4d 85 e4             	test   %r12,%r12
+  80304a:	74 08                	je     803054 <ipc_recv+0xba>
+            *from_env_store = 0;
+  80304c:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  803053:	00 
+        if (perm_store) {
+  803054:	4d 85 ed             	test   %r13,%r13
+  803057:	74 08                	je     803061 <ipc_recv+0xc7>
+            *perm_store = 0;
+  803059:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  803060:	00 
+        if (size) {
+  803061:	48 85 db             	test   %rbx,%rbx
+  803064:	74 d6                	je     80303c <ipc_recv+0xa2>
+            *size = 0;
+  803066:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  80306d:	eb cd                	jmp    80303c <ipc_recv+0xa2>
+
+000000000080306f <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  80306f:	55                   	push   %rbp
+  803070:	48 89 e5             	mov    %rsp,%rbp
+  803073:	41 57                	push   %r15
+  803075:	41 56                	push   %r14
+  803077:	41 55                	push   %r13
+  803079:	41 54                	push   %r12
+  80307b:	53                   	push   %rbx
+  80307c:	48 83 ec 18          	sub    $0x18,%rsp
+  803080:	41 89 fd             	mov    %edi,%r13d
+  803083:	89 75 cc             	mov    %esi,-0x34(%rbp)
+  803086:	49 89 cc             	mov    %rcx,%r12
+  803089:	44 89 45 c8          	mov    %r8d,-0x38(%rbp)
+    // LAB 9: Your code here:
+    int res = 0;
+    while ((res = sys_ipc_try_send(to_env, val, !pg ? (void*)MAX_USER_ADDRESS : pg, size, perm)) < 0) {
+  80308d:	48 85 d2             	test   %rdx,%rdx
+  803090:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803097:	00 00 00 
+  80309a:	48 0f 45 c2          	cmovne %rdx,%rax
+  80309e:	48 89 c3             	mov    %rax,%rbx
+  8030a1:	49 be 92 17 80 00 00 	movabs $0x801792,%r14
+  8030a8:	00 00 00 
+        if (res != -E_IPC_NOT_RECV) {
+            panic("sys_ipc_try_send failed: %i", res);
+        }
+        sys_yield();
+  8030ab:	49 bf 5d 13 80 00 00 	movabs $0x80135d,%r15
+  8030b2:	00 00 00 
+    while ((res = sys_ipc_try_send(to_env, val, !pg ? (void*)MAX_USER_ADDRESS : pg, size, perm)) < 0) {
+  8030b5:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  8030b8:	44 8b 45 c8          	mov    -0x38(%rbp),%r8d
+  8030bc:	4c 89 e1             	mov    %r12,%rcx
+  8030bf:	48 89 da             	mov    %rbx,%rdx
+  8030c2:	44 89 ef             	mov    %r13d,%edi
+  8030c5:	41 ff d6             	call   *%r14
+  8030c8:	85 c0                	test   %eax,%eax
+  8030ca:	79 37                	jns    803103 <ipc_send+0x94>
+        if (res != -E_IPC_NOT_RECV) {
+  8030cc:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  8030cf:	75 05                	jne    8030d6 <ipc_send+0x67>
+        sys_yield();
+  8030d1:	41 ff d7             	call   *%r15
+  8030d4:	eb df                	jmp    8030b5 <ipc_send+0x46>
+            panic("sys_ipc_try_send failed: %i", res);
+  8030d6:	89 c1                	mov    %eax,%ecx
+  8030d8:	48 ba 16 39 80 00 00 	movabs $0x803916,%rdx
+  8030df:	00 00 00 
+  8030e2:	be 40 00 00 00       	mov    $0x40,%esi
+  8030e7:	48 bf 32 39 80 00 00 	movabs $0x803932,%rdi
+  8030ee:	00 00 00 
+  8030f1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8030f6:	49 b8 c7 03 80 00 00 	movabs $0x8003c7,%r8
+  8030fd:	00 00 00 
+  803100:	41 ff d0             	call   *%r8
+    }
+    return;
+}
+  803103:	48 83 c4 18          	add    $0x18,%rsp
+  803107:	5b                   	pop    %rbx
+  803108:	41 5c                	pop    %r12
+  80310a:	41 5d                	pop    %r13
+  80310c:	41 5e                	pop    %r14
+  80310e:	41 5f                	pop    %r15
+  803110:	5d                   	pop    %rbp
+  803111:	c3                   	ret
+
+0000000000803112 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  803112:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  803117:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  80311e:	00 00 00 
+  803121:	48 69 d0 d0 01 00 00 	imul   $0x1d0,%rax,%rdx
+  803128:	48 01 ca             	add    %rcx,%rdx
+  80312b:	8b 92 e8 00 00 00    	mov    0xe8(%rdx),%edx
+  803131:	39 fa                	cmp    %edi,%edx
+  803133:	74 12                	je     803147 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  803135:	48 83 c0 01          	add    $0x1,%rax
+  803139:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  80313f:	75 e0                	jne    803121 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  803141:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803146:	c3                   	ret
+            return envs[i].env_id;
+  803147:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+  80314e:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  803155:	00 00 00 
+  803158:	48 01 d0             	add    %rdx,%rax
+  80315b:	8b 80 e0 00 00 00    	mov    0xe0(%rax),%eax
+  803161:	c3                   	ret
+  803162:	66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+
+0000000000803168 <__rodata_start>:
+  803168:	46                   	rex.RX
+  803169:	41                   	rex.B
+  80316a:	49                   	rex.WB
+  80316b:	4c                   	rex.WR
+  80316c:	45                   	rex.RB
+  80316d:	44 00 4f 4b          	add    %r9b,0x4b(%rdi)
+  803171:	00 73 79             	add    %dh,0x79(%rbx)
+  803174:	73 5f                	jae    8031d5 <__rodata_start+0x6d>
+  803176:	61                   	(bad)
+  803177:	6c                   	insb   (%dx),%es:(%rdi)
+  803178:	6c                   	insb   (%dx),%es:(%rdi)
+  803179:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80317a:	63 5f 72             	movsxd 0x72(%rdi),%ebx
+  80317d:	65 67 69 6f 6e 3a 20 	imul   $0x6925203a,%gs:0x6e(%edi),%ebp
+  803184:	25 69 
+  803186:	00 75 73             	add    %dh,0x73(%rbp)
+  803189:	65 72 2f             	gs jb  8031bb <__rodata_start+0x53>
+  80318c:	73 77                	jae    803205 <__rodata_start+0x9d>
+  80318e:	61                   	(bad)
+  80318f:	70 73                	jo     803204 <__rodata_start+0x9c>
+  803191:	74 72                	je     803205 <__rodata_start+0x9d>
+  803193:	65 73 73             	gs jae 803209 <__rodata_start+0xa1>
+  803196:	2e 63 00             	cs movsxd (%rax),%eax
+  803199:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  80319b:	72 6b                	jb     803208 <__rodata_start+0xa0>
+  80319d:	3a 20                	cmp    (%rax),%ah
+  80319f:	25 69 00 73 77       	and    $0x77730069,%eax
+  8031a4:	61                   	(bad)
+  8031a5:	70 73                	jo     80321a <__rodata_start+0xb2>
+  8031a7:	74 72                	je     80321b <__rodata_start+0xb3>
+  8031a9:	65 73 73             	gs jae 80321f <__rodata_start+0xb7>
+  8031ac:	3a 20                	cmp    (%rax),%ah
+  8031ae:	63 68 69             	movsxd 0x69(%rax),%ebp
+  8031b1:	6c                   	insb   (%dx),%es:(%rdi)
+  8031b2:	64 20 25 73 0a 00 73 	and    %ah,%fs:0x73000a73(%rip)        # 73803c2c <__bss_end+0x72ffbc2c>
+  8031b9:	77 61                	ja     80321c <__rodata_start+0xb4>
+  8031bb:	70 73                	jo     803230 <__rodata_start+0xc8>
+  8031bd:	74 72                	je     803231 <__rodata_start+0xc9>
+  8031bf:	65 73 73             	gs jae 803235 <__rodata_start+0xcd>
+  8031c2:	3a 20                	cmp    (%rax),%ah
+  8031c4:	70 61                	jo     803227 <__rodata_start+0xbf>
+  8031c6:	72 65                	jb     80322d <__rodata_start+0xc5>
+  8031c8:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8031c9:	74 20                	je     8031eb <__rodata_start+0x83>
+  8031cb:	25 73 0a 00 90       	and    $0x90000a73,%eax
+  8031d0:	73 77                	jae    803249 <__rodata_start+0xe1>
+  8031d2:	61                   	(bad)
+  8031d3:	70 73                	jo     803248 <__rodata_start+0xe0>
+  8031d5:	74 72                	je     803249 <__rodata_start+0xe1>
+  8031d7:	65 73 73             	gs jae 80324d <__rodata_start+0xe5>
+  8031da:	3a 20                	cmp    (%rax),%ah
+  8031dc:	25 6c 75 20 4d       	and    $0x4d20756c,%eax
+  8031e1:	42 20 77 72          	rex.X and %sil,0x72(%rdi)
+  8031e5:	69 74 74 65 6e 20 61 	imul   $0x6e61206e,0x65(%rsp,%rsi,2),%esi
+  8031ec:	6e 
+  8031ed:	64 20 63 68          	and    %ah,%fs:0x68(%rbx)
+  8031f1:	65 63 6b 65          	movsxd %gs:0x65(%rbx),%ebp
+  8031f5:	64 20 69 6e          	and    %ch,%fs:0x6e(%rcx)
+  8031f9:	20 25 6c 75 20 63    	and    %ah,0x6320756c(%rip)        # 63a0a76b <__bss_end+0x6320276b>
+  8031ff:	79 63                	jns    803264 <__rodata_start+0xfc>
+  803201:	6c                   	insb   (%dx),%es:(%rdi)
+  803202:	65 73 2c             	gs jae 803231 <__rodata_start+0xc9>
+  803205:	20 25 6c 75 20 62    	and    %ah,0x6220756c(%rip)        # 62a0a777 <__bss_end+0x62202777>
+  80320b:	61                   	(bad)
+  80320c:	64 20 70 61          	and    %dh,%fs:0x61(%rax)
+  803210:	67 65 73 0a          	addr32 gs jae 80321e <__rodata_start+0xb6>
+  803214:	00 3c 75 6e 6b 6e 6f 	add    %bh,0x6f6e6b6e(,%rsi,2)
+  80321b:	77 6e                	ja     80328b <__rodata_start+0x123>
+  80321d:	3e 00 90 5b 25 30 38 	ds add %dl,0x3830255b(%rax)
+  803224:	78 5d                	js     803283 <__rodata_start+0x11b>
+  803226:	20 75 73             	and    %dh,0x73(%rbp)
+  803229:	65 72 20             	gs jb  80324c <__rodata_start+0xe4>
+  80322c:	70 61                	jo     80328f <__rodata_start+0x127>
+  80322e:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80322f:	69 63 20 69 6e 20 25 	imul   $0x25206e69,0x20(%rbx),%esp
+  803236:	73 20                	jae    803258 <__rodata_start+0xf0>
+  803238:	61                   	(bad)
+  803239:	74 20                	je     80325b <__rodata_start+0xf3>
+  80323b:	25 73 3a 25 64       	and    $0x64253a73,%eax
+  803240:	3a 20                	cmp    (%rax),%ah
+  803242:	00 30                	add    %dh,(%rax)
+  803244:	31 32                	xor    %esi,(%rdx)
+  803246:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  80324d:	41                   	rex.B
+  80324e:	42                   	rex.X
+  80324f:	43                   	rex.XB
+  803250:	44                   	rex.R
+  803251:	45                   	rex.RB
+  803252:	46 00 30             	rex.RX add %r14b,(%rax)
+  803255:	31 32                	xor    %esi,(%rdx)
+  803257:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  80325e:	61                   	(bad)
+  80325f:	62 63 64 65 66       	(bad)
+  803264:	00 28                	add    %ch,(%rax)
+  803266:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803267:	75 6c                	jne    8032d5 <__rodata_start+0x16d>
+  803269:	6c                   	insb   (%dx),%es:(%rdi)
+  80326a:	29 00                	sub    %eax,(%rax)
+  80326c:	65 72 72             	gs jb  8032e1 <__rodata_start+0x179>
+  80326f:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803270:	72 20                	jb     803292 <__rodata_start+0x12a>
+  803272:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  803277:	73 70                	jae    8032e9 <__rodata_start+0x181>
+  803279:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  80327d:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  803284:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803285:	72 00                	jb     803287 <__rodata_start+0x11f>
+  803287:	62 61 64 20 65       	(bad)
+  80328c:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80328d:	76 69                	jbe    8032f8 <__rodata_start+0x190>
+  80328f:	72 6f                	jb     803300 <__rodata_start+0x198>
+  803291:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803292:	6d                   	insl   (%dx),%es:(%rdi)
+  803293:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803295:	74 00                	je     803297 <__rodata_start+0x12f>
+  803297:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  80329e:	20 70 61             	and    %dh,0x61(%rax)
+  8032a1:	72 61                	jb     803304 <__rodata_start+0x19c>
+  8032a3:	6d                   	insl   (%dx),%es:(%rdi)
+  8032a4:	65 74 65             	gs je  80330c <__rodata_start+0x1a4>
+  8032a7:	72 00                	jb     8032a9 <__rodata_start+0x141>
+  8032a9:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8032aa:	75 74                	jne    803320 <__rodata_start+0x1b8>
+  8032ac:	20 6f 66             	and    %ch,0x66(%rdi)
+  8032af:	20 6d 65             	and    %ch,0x65(%rbp)
+  8032b2:	6d                   	insl   (%dx),%es:(%rdi)
+  8032b3:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8032b4:	72 79                	jb     80332f <__rodata_start+0x1c7>
+  8032b6:	00 6f 75             	add    %ch,0x75(%rdi)
+  8032b9:	74 20                	je     8032db <__rodata_start+0x173>
+  8032bb:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8032bc:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  8032c0:	76 69                	jbe    80332b <__rodata_start+0x1c3>
+  8032c2:	72 6f                	jb     803333 <__rodata_start+0x1cb>
+  8032c4:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8032c5:	6d                   	insl   (%dx),%es:(%rdi)
+  8032c6:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  8032c8:	74 73                	je     80333d <__rodata_start+0x1d5>
+  8032ca:	00 63 6f             	add    %ah,0x6f(%rbx)
+  8032cd:	72 72                	jb     803341 <__rodata_start+0x1d9>
+  8032cf:	75 70                	jne    803341 <__rodata_start+0x1d9>
+  8032d1:	74 65                	je     803338 <__rodata_start+0x1d0>
+  8032d3:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  8032d8:	75 67                	jne    803341 <__rodata_start+0x1d9>
+  8032da:	20 69 6e             	and    %ch,0x6e(%rcx)
+  8032dd:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  8032df:	00 73 65             	add    %dh,0x65(%rbx)
+  8032e2:	67 6d                	insl   (%dx),%es:(%edi)
+  8032e4:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  8032e6:	74 61                	je     803349 <__rodata_start+0x1e1>
+  8032e8:	74 69                	je     803353 <__rodata_start+0x1eb>
+  8032ea:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8032eb:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8032ec:	20 66 61             	and    %ah,0x61(%rsi)
+  8032ef:	75 6c                	jne    80335d <__rodata_start+0x1f5>
+  8032f1:	74 00                	je     8032f3 <__rodata_start+0x18b>
+  8032f3:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  8032fa:	20 45 4c             	and    %al,0x4c(%rbp)
+  8032fd:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  803301:	61                   	(bad)
+  803302:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  803307:	20 73 75             	and    %dh,0x75(%rbx)
+  80330a:	63 68 20             	movsxd 0x20(%rax),%ebp
+  80330d:	73 79                	jae    803388 <__rodata_start+0x220>
+  80330f:	73 74                	jae    803385 <__rodata_start+0x21d>
+  803311:	65 6d                	gs insl (%dx),%es:(%rdi)
+  803313:	20 63 61             	and    %ah,0x61(%rbx)
+  803316:	6c                   	insb   (%dx),%es:(%rdi)
+  803317:	6c                   	insb   (%dx),%es:(%rdi)
+  803318:	00 65 6e             	add    %ah,0x6e(%rbp)
+  80331b:	74 72                	je     80338f <__rodata_start+0x227>
+  80331d:	79 20                	jns    80333f <__rodata_start+0x1d7>
+  80331f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803320:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803321:	74 20                	je     803343 <__rodata_start+0x1db>
+  803323:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  803325:	75 6e                	jne    803395 <__rodata_start+0x22d>
+  803327:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  80332b:	76 20                	jbe    80334d <__rodata_start+0x1e5>
+  80332d:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  803334:	72 65                	jb     80339b <__rodata_start+0x233>
+  803336:	63 76 69             	movsxd 0x69(%rsi),%esi
+  803339:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80333a:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  80333e:	65 78 70             	gs js  8033b1 <__rodata_start+0x249>
+  803341:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  803346:	20 65 6e             	and    %ah,0x6e(%rbp)
+  803349:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  80334d:	20 66 69             	and    %ah,0x69(%rsi)
+  803350:	6c                   	insb   (%dx),%es:(%rdi)
+  803351:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  803355:	20 66 72             	and    %ah,0x72(%rsi)
+  803358:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  80335d:	61                   	(bad)
+  80335e:	63 65 20             	movsxd 0x20(%rbp),%esp
+  803361:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803362:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803363:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  803367:	6b 00 74             	imul   $0x74,(%rax),%eax
+  80336a:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80336b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80336c:	20 6d 61             	and    %ch,0x61(%rbp)
+  80336f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803370:	79 20                	jns    803392 <__rodata_start+0x22a>
+  803372:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  803379:	72 65                	jb     8033e0 <__rodata_start+0x278>
+  80337b:	20 6f 70             	and    %ch,0x70(%rdi)
+  80337e:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803380:	00 66 69             	add    %ah,0x69(%rsi)
+  803383:	6c                   	insb   (%dx),%es:(%rdi)
+  803384:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  803388:	20 62 6c             	and    %ah,0x6c(%rdx)
+  80338b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80338c:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  80338f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803390:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803391:	74 20                	je     8033b3 <__rodata_start+0x24b>
+  803393:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  803395:	75 6e                	jne    803405 <__rodata_start+0x29d>
+  803397:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  80339b:	76 61                	jbe    8033fe <__rodata_start+0x296>
+  80339d:	6c                   	insb   (%dx),%es:(%rdi)
+  80339e:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  8033a5:	00 
+  8033a6:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  8033ad:	72 65                	jb     803414 <__rodata_start+0x2ac>
+  8033af:	61                   	(bad)
+  8033b0:	64 79 20             	fs jns 8033d3 <__rodata_start+0x26b>
+  8033b3:	65 78 69             	gs js  80341f <__rodata_start+0x2b7>
+  8033b6:	73 74                	jae    80342c <__rodata_start+0x2c4>
+  8033b8:	73 00                	jae    8033ba <__rodata_start+0x252>
+  8033ba:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8033bb:	70 65                	jo     803422 <__rodata_start+0x2ba>
+  8033bd:	72 61                	jb     803420 <__rodata_start+0x2b8>
+  8033bf:	74 69                	je     80342a <__rodata_start+0x2c2>
+  8033c1:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8033c2:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8033c3:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  8033c6:	74 20                	je     8033e8 <__rodata_start+0x280>
+  8033c8:	73 75                	jae    80343f <__rodata_start+0x2d7>
+  8033ca:	70 70                	jo     80343c <__rodata_start+0x2d4>
+  8033cc:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8033cd:	72 74                	jb     803443 <__rodata_start+0x2db>
+  8033cf:	65 64 00 6f 70       	gs add %ch,%fs:0x70(%rdi)
+  8033d4:	65 72 61             	gs jb  803438 <__rodata_start+0x2d0>
+  8033d7:	74 69                	je     803442 <__rodata_start+0x2da>
+  8033d9:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8033da:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8033db:	20 69 6e             	and    %ch,0x6e(%rcx)
+  8033de:	74 65                	je     803445 <__rodata_start+0x2dd>
+  8033e0:	72 72                	jb     803454 <__rodata_start+0x2ec>
+  8033e2:	75 70                	jne    803454 <__rodata_start+0x2ec>
+  8033e4:	74 65                	je     80344b <__rodata_start+0x2e3>
+  8033e6:	64 00 6e 6f          	add    %ch,%fs:0x6f(%rsi)
+  8033ea:	74 20                	je     80340c <__rodata_start+0x2a4>
+  8033ec:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  8033ee:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8033ef:	75 67                	jne    803458 <__rodata_start+0x2f0>
+  8033f1:	68 20 43 50 55       	push   $0x55504320
+  8033f6:	20 74 69 6d          	and    %dh,0x6d(%rcx,%rbp,2)
+  8033fa:	65 00 0f             	add    %cl,%gs:(%rdi)
+  8033fd:	1f                   	(bad)
+  8033fe:	40 00 04 07          	rex add %al,(%rdi,%rax,1)
+  803402:	80 00 00             	addb   $0x0,(%rax)
+  803405:	00 00                	add    %al,(%rax)
+  803407:	00 45 0d             	add    %al,0xd(%rbp)
+  80340a:	80 00 00             	addb   $0x0,(%rax)
+  80340d:	00 00                	add    %al,(%rax)
+  80340f:	00 35 0d 80 00 00    	add    %dh,0x800d(%rip)        # 80b422 <__bss_end+0x3422>
+  803415:	00 00                	add    %al,(%rax)
+  803417:	00 45 0d             	add    %al,0xd(%rbp)
+  80341a:	80 00 00             	addb   $0x0,(%rax)
+  80341d:	00 00                	add    %al,(%rax)
+  80341f:	00 45 0d             	add    %al,0xd(%rbp)
+  803422:	80 00 00             	addb   $0x0,(%rax)
+  803425:	00 00                	add    %al,(%rax)
+  803427:	00 45 0d             	add    %al,0xd(%rbp)
+  80342a:	80 00 00             	addb   $0x0,(%rax)
+  80342d:	00 00                	add    %al,(%rax)
+  80342f:	00 45 0d             	add    %al,0xd(%rbp)
+  803432:	80 00 00             	addb   $0x0,(%rax)
+  803435:	00 00                	add    %al,(%rax)
+  803437:	00 23                	add    %ah,(%rbx)
+  803439:	07                   	(bad)
+  80343a:	80 00 00             	addb   $0x0,(%rax)
+  80343d:	00 00                	add    %al,(%rax)
+  80343f:	00 45 0d             	add    %al,0xd(%rbp)
+  803442:	80 00 00             	addb   $0x0,(%rax)
+  803445:	00 00                	add    %al,(%rax)
+  803447:	00 45 0d             	add    %al,0xd(%rbp)
+  80344a:	80 00 00             	addb   $0x0,(%rax)
+  80344d:	00 00                	add    %al,(%rax)
+  80344f:	00 17                	add    %dl,(%rdi)
+  803451:	07                   	(bad)
+  803452:	80 00 00             	addb   $0x0,(%rax)
+  803455:	00 00                	add    %al,(%rax)
+  803457:	00 91 07 80 00 00    	add    %dl,0x8007(%rcx)
+  80345d:	00 00                	add    %al,(%rax)
+  80345f:	00 45 0d             	add    %al,0xd(%rbp)
+  803462:	80 00 00             	addb   $0x0,(%rax)
+  803465:	00 00                	add    %al,(%rax)
+  803467:	00 17                	add    %dl,(%rdi)
+  803469:	07                   	(bad)
+  80346a:	80 00 00             	addb   $0x0,(%rax)
+  80346d:	00 00                	add    %al,(%rax)
+  80346f:	00 5d 07             	add    %bl,0x7(%rbp)
+  803472:	80 00 00             	addb   $0x0,(%rax)
+  803475:	00 00                	add    %al,(%rax)
+  803477:	00 5d 07             	add    %bl,0x7(%rbp)
+  80347a:	80 00 00             	addb   $0x0,(%rax)
+  80347d:	00 00                	add    %al,(%rax)
+  80347f:	00 5d 07             	add    %bl,0x7(%rbp)
+  803482:	80 00 00             	addb   $0x0,(%rax)
+  803485:	00 00                	add    %al,(%rax)
+  803487:	00 5d 07             	add    %bl,0x7(%rbp)
+  80348a:	80 00 00             	addb   $0x0,(%rax)
+  80348d:	00 00                	add    %al,(%rax)
+  80348f:	00 5d 07             	add    %bl,0x7(%rbp)
+  803492:	80 00 00             	addb   $0x0,(%rax)
+  803495:	00 00                	add    %al,(%rax)
+  803497:	00 5d 07             	add    %bl,0x7(%rbp)
+  80349a:	80 00 00             	addb   $0x0,(%rax)
+  80349d:	00 00                	add    %al,(%rax)
+  80349f:	00 5d 07             	add    %bl,0x7(%rbp)
+  8034a2:	80 00 00             	addb   $0x0,(%rax)
+  8034a5:	00 00                	add    %al,(%rax)
+  8034a7:	00 5d 07             	add    %bl,0x7(%rbp)
+  8034aa:	80 00 00             	addb   $0x0,(%rax)
+  8034ad:	00 00                	add    %al,(%rax)
+  8034af:	00 5d 07             	add    %bl,0x7(%rbp)
+  8034b2:	80 00 00             	addb   $0x0,(%rax)
+  8034b5:	00 00                	add    %al,(%rax)
+  8034b7:	00 45 0d             	add    %al,0xd(%rbp)
+  8034ba:	80 00 00             	addb   $0x0,(%rax)
+  8034bd:	00 00                	add    %al,(%rax)
+  8034bf:	00 45 0d             	add    %al,0xd(%rbp)
+  8034c2:	80 00 00             	addb   $0x0,(%rax)
+  8034c5:	00 00                	add    %al,(%rax)
+  8034c7:	00 45 0d             	add    %al,0xd(%rbp)
+  8034ca:	80 00 00             	addb   $0x0,(%rax)
+  8034cd:	00 00                	add    %al,(%rax)
+  8034cf:	00 45 0d             	add    %al,0xd(%rbp)
+  8034d2:	80 00 00             	addb   $0x0,(%rax)
+  8034d5:	00 00                	add    %al,(%rax)
+  8034d7:	00 45 0d             	add    %al,0xd(%rbp)
+  8034da:	80 00 00             	addb   $0x0,(%rax)
+  8034dd:	00 00                	add    %al,(%rax)
+  8034df:	00 45 0d             	add    %al,0xd(%rbp)
+  8034e2:	80 00 00             	addb   $0x0,(%rax)
+  8034e5:	00 00                	add    %al,(%rax)
+  8034e7:	00 45 0d             	add    %al,0xd(%rbp)
+  8034ea:	80 00 00             	addb   $0x0,(%rax)
+  8034ed:	00 00                	add    %al,(%rax)
+  8034ef:	00 45 0d             	add    %al,0xd(%rbp)
+  8034f2:	80 00 00             	addb   $0x0,(%rax)
+  8034f5:	00 00                	add    %al,(%rax)
+  8034f7:	00 45 0d             	add    %al,0xd(%rbp)
+  8034fa:	80 00 00             	addb   $0x0,(%rax)
+  8034fd:	00 00                	add    %al,(%rax)
+  8034ff:	00 45 0d             	add    %al,0xd(%rbp)
+  803502:	80 00 00             	addb   $0x0,(%rax)
+  803505:	00 00                	add    %al,(%rax)
+  803507:	00 45 0d             	add    %al,0xd(%rbp)
+  80350a:	80 00 00             	addb   $0x0,(%rax)
+  80350d:	00 00                	add    %al,(%rax)
+  80350f:	00 45 0d             	add    %al,0xd(%rbp)
+  803512:	80 00 00             	addb   $0x0,(%rax)
+  803515:	00 00                	add    %al,(%rax)
+  803517:	00 45 0d             	add    %al,0xd(%rbp)
+  80351a:	80 00 00             	addb   $0x0,(%rax)
+  80351d:	00 00                	add    %al,(%rax)
+  80351f:	00 45 0d             	add    %al,0xd(%rbp)
+  803522:	80 00 00             	addb   $0x0,(%rax)
+  803525:	00 00                	add    %al,(%rax)
+  803527:	00 45 0d             	add    %al,0xd(%rbp)
+  80352a:	80 00 00             	addb   $0x0,(%rax)
+  80352d:	00 00                	add    %al,(%rax)
+  80352f:	00 45 0d             	add    %al,0xd(%rbp)
+  803532:	80 00 00             	addb   $0x0,(%rax)
+  803535:	00 00                	add    %al,(%rax)
+  803537:	00 45 0d             	add    %al,0xd(%rbp)
+  80353a:	80 00 00             	addb   $0x0,(%rax)
+  80353d:	00 00                	add    %al,(%rax)
+  80353f:	00 45 0d             	add    %al,0xd(%rbp)
+  803542:	80 00 00             	addb   $0x0,(%rax)
+  803545:	00 00                	add    %al,(%rax)
+  803547:	00 45 0d             	add    %al,0xd(%rbp)
+  80354a:	80 00 00             	addb   $0x0,(%rax)
+  80354d:	00 00                	add    %al,(%rax)
+  80354f:	00 45 0d             	add    %al,0xd(%rbp)
+  803552:	80 00 00             	addb   $0x0,(%rax)
+  803555:	00 00                	add    %al,(%rax)
+  803557:	00 45 0d             	add    %al,0xd(%rbp)
+  80355a:	80 00 00             	addb   $0x0,(%rax)
+  80355d:	00 00                	add    %al,(%rax)
+  80355f:	00 45 0d             	add    %al,0xd(%rbp)
+  803562:	80 00 00             	addb   $0x0,(%rax)
+  803565:	00 00                	add    %al,(%rax)
+  803567:	00 45 0d             	add    %al,0xd(%rbp)
+  80356a:	80 00 00             	addb   $0x0,(%rax)
+  80356d:	00 00                	add    %al,(%rax)
+  80356f:	00 45 0d             	add    %al,0xd(%rbp)
+  803572:	80 00 00             	addb   $0x0,(%rax)
+  803575:	00 00                	add    %al,(%rax)
+  803577:	00 45 0d             	add    %al,0xd(%rbp)
+  80357a:	80 00 00             	addb   $0x0,(%rax)
+  80357d:	00 00                	add    %al,(%rax)
+  80357f:	00 45 0d             	add    %al,0xd(%rbp)
+  803582:	80 00 00             	addb   $0x0,(%rax)
+  803585:	00 00                	add    %al,(%rax)
+  803587:	00 45 0d             	add    %al,0xd(%rbp)
+  80358a:	80 00 00             	addb   $0x0,(%rax)
+  80358d:	00 00                	add    %al,(%rax)
+  80358f:	00 45 0d             	add    %al,0xd(%rbp)
+  803592:	80 00 00             	addb   $0x0,(%rax)
+  803595:	00 00                	add    %al,(%rax)
+  803597:	00 45 0d             	add    %al,0xd(%rbp)
+  80359a:	80 00 00             	addb   $0x0,(%rax)
+  80359d:	00 00                	add    %al,(%rax)
+  80359f:	00 45 0d             	add    %al,0xd(%rbp)
+  8035a2:	80 00 00             	addb   $0x0,(%rax)
+  8035a5:	00 00                	add    %al,(%rax)
+  8035a7:	00 68 0c             	add    %ch,0xc(%rax)
+  8035aa:	80 00 00             	addb   $0x0,(%rax)
+  8035ad:	00 00                	add    %al,(%rax)
+  8035af:	00 45 0d             	add    %al,0xd(%rbp)
+  8035b2:	80 00 00             	addb   $0x0,(%rax)
+  8035b5:	00 00                	add    %al,(%rax)
+  8035b7:	00 45 0d             	add    %al,0xd(%rbp)
+  8035ba:	80 00 00             	addb   $0x0,(%rax)
+  8035bd:	00 00                	add    %al,(%rax)
+  8035bf:	00 45 0d             	add    %al,0xd(%rbp)
+  8035c2:	80 00 00             	addb   $0x0,(%rax)
+  8035c5:	00 00                	add    %al,(%rax)
+  8035c7:	00 45 0d             	add    %al,0xd(%rbp)
+  8035ca:	80 00 00             	addb   $0x0,(%rax)
+  8035cd:	00 00                	add    %al,(%rax)
+  8035cf:	00 45 0d             	add    %al,0xd(%rbp)
+  8035d2:	80 00 00             	addb   $0x0,(%rax)
+  8035d5:	00 00                	add    %al,(%rax)
+  8035d7:	00 45 0d             	add    %al,0xd(%rbp)
+  8035da:	80 00 00             	addb   $0x0,(%rax)
+  8035dd:	00 00                	add    %al,(%rax)
+  8035df:	00 45 0d             	add    %al,0xd(%rbp)
+  8035e2:	80 00 00             	addb   $0x0,(%rax)
+  8035e5:	00 00                	add    %al,(%rax)
+  8035e7:	00 45 0d             	add    %al,0xd(%rbp)
+  8035ea:	80 00 00             	addb   $0x0,(%rax)
+  8035ed:	00 00                	add    %al,(%rax)
+  8035ef:	00 45 0d             	add    %al,0xd(%rbp)
+  8035f2:	80 00 00             	addb   $0x0,(%rax)
+  8035f5:	00 00                	add    %al,(%rax)
+  8035f7:	00 45 0d             	add    %al,0xd(%rbp)
+  8035fa:	80 00 00             	addb   $0x0,(%rax)
+  8035fd:	00 00                	add    %al,(%rax)
+  8035ff:	00 b4 07 80 00 00 00 	add    %dh,0x80(%rdi,%rax,1)
+  803606:	00 00                	add    %al,(%rax)
+  803608:	83 09 80             	orl    $0xffffff80,(%rcx)
+  80360b:	00 00                	add    %al,(%rax)
+  80360d:	00 00                	add    %al,(%rax)
+  80360f:	00 45 0d             	add    %al,0xd(%rbp)
+  803612:	80 00 00             	addb   $0x0,(%rax)
+  803615:	00 00                	add    %al,(%rax)
+  803617:	00 45 0d             	add    %al,0xd(%rbp)
+  80361a:	80 00 00             	addb   $0x0,(%rax)
+  80361d:	00 00                	add    %al,(%rax)
+  80361f:	00 45 0d             	add    %al,0xd(%rbp)
+  803622:	80 00 00             	addb   $0x0,(%rax)
+  803625:	00 00                	add    %al,(%rax)
+  803627:	00 45 0d             	add    %al,0xd(%rbp)
+  80362a:	80 00 00             	addb   $0x0,(%rax)
+  80362d:	00 00                	add    %al,(%rax)
+  80362f:	00 e3                	add    %ah,%bl
+  803631:	07                   	(bad)
+  803632:	80 00 00             	addb   $0x0,(%rax)
+  803635:	00 00                	add    %al,(%rax)
+  803637:	00 45 0d             	add    %al,0xd(%rbp)
+  80363a:	80 00 00             	addb   $0x0,(%rax)
+  80363d:	00 00                	add    %al,(%rax)
+  80363f:	00 45 0d             	add    %al,0xd(%rbp)
+  803642:	80 00 00             	addb   $0x0,(%rax)
+  803645:	00 00                	add    %al,(%rax)
+  803647:	00 a9 07 80 00 00    	add    %ch,0x8007(%rcx)
+  80364d:	00 00                	add    %al,(%rax)
+  80364f:	00 45 0d             	add    %al,0xd(%rbp)
+  803652:	80 00 00             	addb   $0x0,(%rax)
+  803655:	00 00                	add    %al,(%rax)
+  803657:	00 45 0d             	add    %al,0xd(%rbp)
+  80365a:	80 00 00             	addb   $0x0,(%rax)
+  80365d:	00 00                	add    %al,(%rax)
+  80365f:	00 2b                	add    %ch,(%rbx)
+  803661:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803667:	00 f5                	add    %dh,%ch
+  803669:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  80366f:	00 45 0d             	add    %al,0xd(%rbp)
+  803672:	80 00 00             	addb   $0x0,(%rax)
+  803675:	00 00                	add    %al,(%rax)
+  803677:	00 45 0d             	add    %al,0xd(%rbp)
+  80367a:	80 00 00             	addb   $0x0,(%rax)
+  80367d:	00 00                	add    %al,(%rax)
+  80367f:	00 7a 08             	add    %bh,0x8(%rdx)
+  803682:	80 00 00             	addb   $0x0,(%rax)
+  803685:	00 00                	add    %al,(%rax)
+  803687:	00 45 0d             	add    %al,0xd(%rbp)
+  80368a:	80 00 00             	addb   $0x0,(%rax)
+  80368d:	00 00                	add    %al,(%rax)
+  80368f:	00 57 0a             	add    %dl,0xa(%rdi)
+  803692:	80 00 00             	addb   $0x0,(%rax)
+  803695:	00 00                	add    %al,(%rax)
+  803697:	00 45 0d             	add    %al,0xd(%rbp)
+  80369a:	80 00 00             	addb   $0x0,(%rax)
+  80369d:	00 00                	add    %al,(%rax)
+  80369f:	00 45 0d             	add    %al,0xd(%rbp)
+  8036a2:	80 00 00             	addb   $0x0,(%rax)
+  8036a5:	00 00                	add    %al,(%rax)
+  8036a7:	00 68 0c             	add    %ch,0xc(%rax)
+  8036aa:	80 00 00             	addb   $0x0,(%rax)
+  8036ad:	00 00                	add    %al,(%rax)
+  8036af:	00 45 0d             	add    %al,0xd(%rbp)
+  8036b2:	80 00 00             	addb   $0x0,(%rax)
+  8036b5:	00 00                	add    %al,(%rax)
+  8036b7:	00 0d 07 80 00 00    	add    %cl,0x8007(%rip)        # 80b6c4 <__bss_end+0x36c4>
+  8036bd:	00 00                	add    %al,(%rax)
+	...
+
+00000000008036c0 <error_string>:
+	...
+  8036c8:	75 32 80 00 00 00 00 00 87 32 80 00 00 00 00 00     u2.......2......
+  8036d8:	97 32 80 00 00 00 00 00 a9 32 80 00 00 00 00 00     .2.......2......
+  8036e8:	b7 32 80 00 00 00 00 00 cb 32 80 00 00 00 00 00     .2.......2......
+  8036f8:	e0 32 80 00 00 00 00 00 f3 32 80 00 00 00 00 00     .2.......2......
+  803708:	05 33 80 00 00 00 00 00 19 33 80 00 00 00 00 00     .3.......3......
+  803718:	29 33 80 00 00 00 00 00 3c 33 80 00 00 00 00 00     )3......<3......
+  803728:	53 33 80 00 00 00 00 00 69 33 80 00 00 00 00 00     S3......i3......
+  803738:	81 33 80 00 00 00 00 00 99 33 80 00 00 00 00 00     .3.......3......
+  803748:	a6 33 80 00 00 00 00 00 70 37 80 00 00 00 00 00     .3......p7......
+  803758:	ba 33 80 00 00 00 00 00 d2 33 80 00 00 00 00 00     .3.......3......
+  803768:	e8 33 80 00 00 00 00 00 66 69 6c 65 20 69 73 20     .3......file is 
+  803778:	6e 6f 74 20 61 20 76 61 6c 69 64 20 65 78 65 63     not a valid exec
+  803788:	75 74 61 62 6c 65 00 90 73 79 73 63 61 6c 6c 20     utable..syscall 
+  803798:	25 7a 64 20 72 65 74 75 72 6e 65 64 20 25 7a 64     %zd returned %zd
+  8037a8:	20 28 3e 20 30 29 00 6c 69 62 2f 73 79 73 63 61      (> 0).lib/sysca
+  8037b8:	6c 6c 2e 63 00 46 6f 72 6b 20 64 6f 75 62 6c 65     ll.c.Fork double
+  8037c8:	20 66 61 75 6c 74 00 6c 69 62 2f 66 6f 72 6b 2e      fault.lib/fork.
+  8037d8:	63 00 73 66 6f 72 6b 28 29 20 69 73 20 6e 6f 74     c.sfork() is not
+  8037e8:	20 69 6d 70 6c 65 6d 65 6e 74 65 64 00 0f 1f 00      implemented....
+  8037f8:	5b 25 30 38 78 5d 20 75 6e 6b 6e 6f 77 6e 20 64     [%08x] unknown d
+  803808:	65 76 69 63 65 20 74 79 70 65 20 25 64 0a 00 00     evice type %d...
+  803818:	5b 25 30 38 78 5d 20 66 74 72 75 6e 63 61 74 65     [%08x] ftruncate
+  803828:	20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65 0a      %d -- bad mode.
+  803838:	00 5b 25 30 38 78 5d 20 72 65 61 64 20 25 64 20     .[%08x] read %d 
+  803848:	2d 2d 20 62 61 64 20 6d 6f 64 65 0a 00 5b 25 30     -- bad mode..[%0
+  803858:	38 78 5d 20 77 72 69 74 65 20 25 64 20 2d 2d 20     8x] write %d -- 
+  803868:	62 61 64 20 6d 6f 64 65 0a 00 66 2e 0f 1f 84 00     bad mode..f.....
+  803878:	00 00 00 00 0f 1f 40 00                             ......@.
+
+0000000000803880 <devtab>:
+  803880:	20 40 80 00 00 00 00 00 60 40 80 00 00 00 00 00      @......`@......
+  803890:	a0 40 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .@..............
+  8038a0:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  8038b0:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  8038c0:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  8038d0:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  8038e0:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  8038f0:	3d 20 32 00 65 6e 76 69 64 20 21 3d 20 30 00 6c     = 2.envid != 0.l
+  803900:	69 62 2f 77 61 69 74 2e 63 00 3c 63 6f 6e 73 3e     ib/wait.c.<cons>
+  803910:	00 63 6f 6e 73 00 73 79 73 5f 69 70 63 5f 74 72     .cons.sys_ipc_tr
+  803920:	79 5f 73 65 6e 64 20 66 61 69 6c 65 64 3a 20 25     y_send failed: %
+  803930:	69 00 6c 69 62 2f 69 70 63 2e 63 00 66 2e 0f 1f     i.lib/ipc.c.f...
+  803940:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803950:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803960:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803970:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803980:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803990:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8039a0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8039b0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8039c0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8039d0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8039e0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8039f0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803a00:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803a10:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803a20:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803a30:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803a40:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803a50:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803a60:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803a70:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803a80:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803a90:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803aa0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803ab0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803ac0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803ad0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803ae0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803af0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803b00:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803b10:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803b20:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803b30:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803b40:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803b50:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803b60:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803b70:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803b80:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803b90:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803ba0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803bb0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803bc0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803bd0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803be0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803bf0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803c00:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803c10:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803c20:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803c30:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803c40:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803c50:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803c60:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803c70:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803c80:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803c90:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803ca0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803cb0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803cc0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803cd0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803ce0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803cf0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803d00:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803d10:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803d20:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803d30:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803d40:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803d50:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803d60:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803d70:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803d80:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803d90:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803da0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803db0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803dc0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803dd0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803de0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803df0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803e00:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803e10:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803e20:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803e30:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803e40:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803e50:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803e60:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803e70:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803e80:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803e90:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803ea0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803eb0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803ec0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803ed0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803ee0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803ef0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803f00:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803f10:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803f20:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803f30:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803f40:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803f50:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803f60:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803f70:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803f80:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803f90:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803fa0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803fb0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803fc0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803fd0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803fe0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803ff0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 90     ....f.........f.
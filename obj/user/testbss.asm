@@ -0,0 +1,5825 @@
+
+obj/user/testbss:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 35 01 00 00       	call   800158 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+#define ARRAYSIZE (1024 * 1024)
+
+uint32_t bigarray[ARRAYSIZE];
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+    int i;
+
+    cprintf("Making sure bss works right...\n");
+  800029:	48 bf a8 2d 80 00 00 	movabs $0x802da8,%rdi
+  800030:	00 00 00 
+  800033:	b8 00 00 00 00       	mov    $0x0,%eax
+  800038:	48 ba 74 03 80 00 00 	movabs $0x800374,%rdx
+  80003f:	00 00 00 
+  800042:	ff d2                	call   *%rdx
+  800044:	b9 00 00 00 00       	mov    $0x0,%ecx
+    for (i = 0; i < ARRAYSIZE; i++)
+        if (bigarray[i] != 0)
+  800049:	48 b8 00 50 80 00 00 	movabs $0x805000,%rax
+  800050:	00 00 00 
+  800053:	83 3c 88 00          	cmpl   $0x0,(%rax,%rcx,4)
+  800057:	0f 85 a5 00 00 00    	jne    800102 <umain+0xdd>
+    for (i = 0; i < ARRAYSIZE; i++)
+  80005d:	48 83 c1 01          	add    $0x1,%rcx
+  800061:	48 81 f9 00 00 10 00 	cmp    $0x100000,%rcx
+  800068:	75 e9                	jne    800053 <umain+0x2e>
+  80006a:	b8 00 00 00 00       	mov    $0x0,%eax
+            panic("bigarray[%d] isn't cleared!\n", i);
+    for (i = 0; i < ARRAYSIZE; i++)
+        bigarray[i] = i;
+  80006f:	48 ba 00 50 80 00 00 	movabs $0x805000,%rdx
+  800076:	00 00 00 
+  800079:	89 04 82             	mov    %eax,(%rdx,%rax,4)
+    for (i = 0; i < ARRAYSIZE; i++)
+  80007c:	48 83 c0 01          	add    $0x1,%rax
+  800080:	48 3d 00 00 10 00    	cmp    $0x100000,%rax
+  800086:	75 f1                	jne    800079 <umain+0x54>
+  800088:	b9 00 00 00 00       	mov    $0x0,%ecx
+    for (i = 0; i < ARRAYSIZE; i++)
+        if (bigarray[i] != i)
+  80008d:	48 b8 00 50 80 00 00 	movabs $0x805000,%rax
+  800094:	00 00 00 
+  800097:	39 0c 88             	cmp    %ecx,(%rax,%rcx,4)
+  80009a:	0f 85 8d 00 00 00    	jne    80012d <umain+0x108>
+    for (i = 0; i < ARRAYSIZE; i++)
+  8000a0:	48 83 c1 01          	add    $0x1,%rcx
+  8000a4:	48 81 f9 00 00 10 00 	cmp    $0x100000,%rcx
+  8000ab:	75 ea                	jne    800097 <umain+0x72>
+            panic("bigarray[%d] didn't hold its value!\n", i);
+
+    cprintf("Yes, good.  Now doing a wild write off the end...\n");
+  8000ad:	48 bf f0 2d 80 00 00 	movabs $0x802df0,%rdi
+  8000b4:	00 00 00 
+  8000b7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000bc:	48 ba 74 03 80 00 00 	movabs $0x800374,%rdx
+  8000c3:	00 00 00 
+  8000c6:	ff d2                	call   *%rdx
+
+    /* Accessing via subscript operator ([]) will result in -Warray-bounds warning. */
+    *((volatile uint32_t *)bigarray + ARRAYSIZE + 0x800000) = 0;
+  8000c8:	48 b8 00 50 c0 02 00 	movabs $0x2c05000,%rax
+  8000cf:	00 00 00 
+  8000d2:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    panic("SHOULD HAVE TRAPPED!!!");
+  8000d8:	48 ba 4f 2e 80 00 00 	movabs $0x802e4f,%rdx
+  8000df:	00 00 00 
+  8000e2:	be 1b 00 00 00       	mov    $0x1b,%esi
+  8000e7:	48 bf 40 2e 80 00 00 	movabs $0x802e40,%rdi
+  8000ee:	00 00 00 
+  8000f1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000f6:	48 b9 24 02 80 00 00 	movabs $0x800224,%rcx
+  8000fd:	00 00 00 
+  800100:	ff d1                	call   *%rcx
+            panic("bigarray[%d] isn't cleared!\n", i);
+  800102:	48 ba 23 2e 80 00 00 	movabs $0x802e23,%rdx
+  800109:	00 00 00 
+  80010c:	be 10 00 00 00       	mov    $0x10,%esi
+  800111:	48 bf 40 2e 80 00 00 	movabs $0x802e40,%rdi
+  800118:	00 00 00 
+  80011b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800120:	49 b8 24 02 80 00 00 	movabs $0x800224,%r8
+  800127:	00 00 00 
+  80012a:	41 ff d0             	call   *%r8
+            panic("bigarray[%d] didn't hold its value!\n", i);
+  80012d:	48 ba c8 2d 80 00 00 	movabs $0x802dc8,%rdx
+  800134:	00 00 00 
+  800137:	be 15 00 00 00       	mov    $0x15,%esi
+  80013c:	48 bf 40 2e 80 00 00 	movabs $0x802e40,%rdi
+  800143:	00 00 00 
+  800146:	b8 00 00 00 00       	mov    $0x0,%eax
+  80014b:	49 b8 24 02 80 00 00 	movabs $0x800224,%r8
+  800152:	00 00 00 
+  800155:	41 ff d0             	call   *%r8
+
+0000000000800158 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800158:	55                   	push   %rbp
+  800159:	48 89 e5             	mov    %rsp,%rbp
+  80015c:	41 56                	push   %r14
+  80015e:	41 55                	push   %r13
+  800160:	41 54                	push   %r12
+  800162:	53                   	push   %rbx
+  800163:	41 89 fd             	mov    %edi,%r13d
+  800166:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800169:	48 ba d8 40 80 00 00 	movabs $0x8040d8,%rdx
+  800170:	00 00 00 
+  800173:	48 b8 d8 40 80 00 00 	movabs $0x8040d8,%rax
+  80017a:	00 00 00 
+  80017d:	48 39 c2             	cmp    %rax,%rdx
+  800180:	73 17                	jae    800199 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  800182:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  800185:	49 89 c4             	mov    %rax,%r12
+  800188:	48 83 c3 08          	add    $0x8,%rbx
+  80018c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800191:	ff 53 f8             	call   *-0x8(%rbx)
+  800194:	4c 39 e3             	cmp    %r12,%rbx
+  800197:	72 ef                	jb     800188 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+    envid_t this_env_id = sys_getenvid();
+  800199:	48 b8 89 11 80 00 00 	movabs $0x801189,%rax
+  8001a0:	00 00 00 
+  8001a3:	ff d0                	call   *%rax
+    thisenv = &((struct Env*)UENVS)[ENVX(this_env_id)];
+  8001a5:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8001aa:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+  8001b1:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8001b8:	00 00 00 
+  8001bb:	48 01 d0             	add    %rdx,%rax
+  8001be:	48 a3 00 50 c0 00 00 	movabs %rax,0xc05000
+  8001c5:	00 00 00 
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8001c8:	45 85 ed             	test   %r13d,%r13d
+  8001cb:	7e 0d                	jle    8001da <libmain+0x82>
+  8001cd:	49 8b 06             	mov    (%r14),%rax
+  8001d0:	48 a3 00 40 80 00 00 	movabs %rax,0x804000
+  8001d7:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8001da:	4c 89 f6             	mov    %r14,%rsi
+  8001dd:	44 89 ef             	mov    %r13d,%edi
+  8001e0:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8001e7:	00 00 00 
+  8001ea:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8001ec:	48 b8 01 02 80 00 00 	movabs $0x800201,%rax
+  8001f3:	00 00 00 
+  8001f6:	ff d0                	call   *%rax
+#endif
+}
+  8001f8:	5b                   	pop    %rbx
+  8001f9:	41 5c                	pop    %r12
+  8001fb:	41 5d                	pop    %r13
+  8001fd:	41 5e                	pop    %r14
+  8001ff:	5d                   	pop    %rbp
+  800200:	c3                   	ret
+
+0000000000800201 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  800201:	55                   	push   %rbp
+  800202:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  800205:	48 b8 dd 18 80 00 00 	movabs $0x8018dd,%rax
+  80020c:	00 00 00 
+  80020f:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  800211:	bf 00 00 00 00       	mov    $0x0,%edi
+  800216:	48 b8 1e 11 80 00 00 	movabs $0x80111e,%rax
+  80021d:	00 00 00 
+  800220:	ff d0                	call   *%rax
+}
+  800222:	5d                   	pop    %rbp
+  800223:	c3                   	ret
+
+0000000000800224 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  800224:	55                   	push   %rbp
+  800225:	48 89 e5             	mov    %rsp,%rbp
+  800228:	41 56                	push   %r14
+  80022a:	41 55                	push   %r13
+  80022c:	41 54                	push   %r12
+  80022e:	53                   	push   %rbx
+  80022f:	48 83 ec 50          	sub    $0x50,%rsp
+  800233:	49 89 fc             	mov    %rdi,%r12
+  800236:	41 89 f5             	mov    %esi,%r13d
+  800239:	48 89 d3             	mov    %rdx,%rbx
+  80023c:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  800240:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  800244:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800248:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  80024f:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800253:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  800257:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  80025b:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  80025f:	48 b8 00 40 80 00 00 	movabs $0x804000,%rax
+  800266:	00 00 00 
+  800269:	4c 8b 30             	mov    (%rax),%r14
+  80026c:	48 b8 89 11 80 00 00 	movabs $0x801189,%rax
+  800273:	00 00 00 
+  800276:	ff d0                	call   *%rax
+  800278:	89 c6                	mov    %eax,%esi
+  80027a:	45 89 e8             	mov    %r13d,%r8d
+  80027d:	4c 89 e1             	mov    %r12,%rcx
+  800280:	4c 89 f2             	mov    %r14,%rdx
+  800283:	48 bf 70 2e 80 00 00 	movabs $0x802e70,%rdi
+  80028a:	00 00 00 
+  80028d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800292:	49 bc 74 03 80 00 00 	movabs $0x800374,%r12
+  800299:	00 00 00 
+  80029c:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  80029f:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  8002a3:	48 89 df             	mov    %rbx,%rdi
+  8002a6:	48 b8 10 03 80 00 00 	movabs $0x800310,%rax
+  8002ad:	00 00 00 
+  8002b0:	ff d0                	call   *%rax
+    cprintf("\n");
+  8002b2:	48 bf 3e 2e 80 00 00 	movabs $0x802e3e,%rdi
+  8002b9:	00 00 00 
+  8002bc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002c1:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  8002c4:	cc                   	int3
+  8002c5:	eb fd                	jmp    8002c4 <_panic+0xa0>
+
+00000000008002c7 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  8002c7:	55                   	push   %rbp
+  8002c8:	48 89 e5             	mov    %rsp,%rbp
+  8002cb:	53                   	push   %rbx
+  8002cc:	48 83 ec 08          	sub    $0x8,%rsp
+  8002d0:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  8002d3:	8b 06                	mov    (%rsi),%eax
+  8002d5:	8d 50 01             	lea    0x1(%rax),%edx
+  8002d8:	89 16                	mov    %edx,(%rsi)
+  8002da:	48 98                	cltq
+  8002dc:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  8002e1:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  8002e7:	74 0a                	je     8002f3 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  8002e9:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  8002ed:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8002f1:	c9                   	leave
+  8002f2:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  8002f3:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  8002f7:	be ff 00 00 00       	mov    $0xff,%esi
+  8002fc:	48 b8 c0 10 80 00 00 	movabs $0x8010c0,%rax
+  800303:	00 00 00 
+  800306:	ff d0                	call   *%rax
+        state->offset = 0;
+  800308:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  80030e:	eb d9                	jmp    8002e9 <putch+0x22>
+
+0000000000800310 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  800310:	55                   	push   %rbp
+  800311:	48 89 e5             	mov    %rsp,%rbp
+  800314:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  80031b:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  80031e:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  800325:	b9 21 00 00 00       	mov    $0x21,%ecx
+  80032a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80032f:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  800332:	48 89 f1             	mov    %rsi,%rcx
+  800335:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  80033c:	48 bf c7 02 80 00 00 	movabs $0x8002c7,%rdi
+  800343:	00 00 00 
+  800346:	48 b8 c4 04 80 00 00 	movabs $0x8004c4,%rax
+  80034d:	00 00 00 
+  800350:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  800352:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  800359:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  800360:	48 b8 c0 10 80 00 00 	movabs $0x8010c0,%rax
+  800367:	00 00 00 
+  80036a:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  80036c:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  800372:	c9                   	leave
+  800373:	c3                   	ret
+
+0000000000800374 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  800374:	55                   	push   %rbp
+  800375:	48 89 e5             	mov    %rsp,%rbp
+  800378:	48 83 ec 50          	sub    $0x50,%rsp
+  80037c:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  800380:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  800384:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800388:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80038c:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  800390:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  800397:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80039b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80039f:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8003a3:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  8003a7:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  8003ab:	48 b8 10 03 80 00 00 	movabs $0x800310,%rax
+  8003b2:	00 00 00 
+  8003b5:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  8003b7:	c9                   	leave
+  8003b8:	c3                   	ret
+
+00000000008003b9 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  8003b9:	55                   	push   %rbp
+  8003ba:	48 89 e5             	mov    %rsp,%rbp
+  8003bd:	41 57                	push   %r15
+  8003bf:	41 56                	push   %r14
+  8003c1:	41 55                	push   %r13
+  8003c3:	41 54                	push   %r12
+  8003c5:	53                   	push   %rbx
+  8003c6:	48 83 ec 18          	sub    $0x18,%rsp
+  8003ca:	49 89 fc             	mov    %rdi,%r12
+  8003cd:	49 89 f5             	mov    %rsi,%r13
+  8003d0:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8003d4:	8b 45 10             	mov    0x10(%rbp),%eax
+  8003d7:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  8003da:	41 89 cf             	mov    %ecx,%r15d
+  8003dd:	4c 39 fa             	cmp    %r15,%rdx
+  8003e0:	73 5b                	jae    80043d <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  8003e2:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  8003e6:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  8003ea:	85 db                	test   %ebx,%ebx
+  8003ec:	7e 0e                	jle    8003fc <print_num+0x43>
+            putch(padc, put_arg);
+  8003ee:	4c 89 ee             	mov    %r13,%rsi
+  8003f1:	44 89 f7             	mov    %r14d,%edi
+  8003f4:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  8003f7:	83 eb 01             	sub    $0x1,%ebx
+  8003fa:	75 f2                	jne    8003ee <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  8003fc:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  800400:	48 b9 a4 2e 80 00 00 	movabs $0x802ea4,%rcx
+  800407:	00 00 00 
+  80040a:	48 b8 93 2e 80 00 00 	movabs $0x802e93,%rax
+  800411:	00 00 00 
+  800414:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  800418:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80041c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800421:	49 f7 f7             	div    %r15
+  800424:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  800428:	4c 89 ee             	mov    %r13,%rsi
+  80042b:	41 ff d4             	call   *%r12
+}
+  80042e:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800432:	5b                   	pop    %rbx
+  800433:	41 5c                	pop    %r12
+  800435:	41 5d                	pop    %r13
+  800437:	41 5e                	pop    %r14
+  800439:	41 5f                	pop    %r15
+  80043b:	5d                   	pop    %rbp
+  80043c:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  80043d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800441:	ba 00 00 00 00       	mov    $0x0,%edx
+  800446:	49 f7 f7             	div    %r15
+  800449:	48 83 ec 08          	sub    $0x8,%rsp
+  80044d:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  800451:	52                   	push   %rdx
+  800452:	45 0f be c9          	movsbl %r9b,%r9d
+  800456:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  80045a:	48 89 c2             	mov    %rax,%rdx
+  80045d:	48 b8 b9 03 80 00 00 	movabs $0x8003b9,%rax
+  800464:	00 00 00 
+  800467:	ff d0                	call   *%rax
+  800469:	48 83 c4 10          	add    $0x10,%rsp
+  80046d:	eb 8d                	jmp    8003fc <print_num+0x43>
+
+000000000080046f <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  80046f:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  800473:	48 8b 06             	mov    (%rsi),%rax
+  800476:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  80047a:	73 0a                	jae    800486 <sprintputch+0x17>
+        *state->start++ = ch;
+  80047c:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800480:	48 89 16             	mov    %rdx,(%rsi)
+  800483:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  800486:	c3                   	ret
+
+0000000000800487 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  800487:	55                   	push   %rbp
+  800488:	48 89 e5             	mov    %rsp,%rbp
+  80048b:	48 83 ec 50          	sub    $0x50,%rsp
+  80048f:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800493:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800497:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  80049b:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8004a2:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8004a6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8004aa:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8004ae:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  8004b2:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8004b6:	48 b8 c4 04 80 00 00 	movabs $0x8004c4,%rax
+  8004bd:	00 00 00 
+  8004c0:	ff d0                	call   *%rax
+}
+  8004c2:	c9                   	leave
+  8004c3:	c3                   	ret
+
+00000000008004c4 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  8004c4:	55                   	push   %rbp
+  8004c5:	48 89 e5             	mov    %rsp,%rbp
+  8004c8:	41 57                	push   %r15
+  8004ca:	41 56                	push   %r14
+  8004cc:	41 55                	push   %r13
+  8004ce:	41 54                	push   %r12
+  8004d0:	53                   	push   %rbx
+  8004d1:	48 83 ec 38          	sub    $0x38,%rsp
+  8004d5:	49 89 fe             	mov    %rdi,%r14
+  8004d8:	49 89 f5             	mov    %rsi,%r13
+  8004db:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  8004de:	48 8b 01             	mov    (%rcx),%rax
+  8004e1:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8004e5:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  8004e9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8004ed:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  8004f1:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  8004f5:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  8004f9:	0f b6 3b             	movzbl (%rbx),%edi
+  8004fc:	40 80 ff 25          	cmp    $0x25,%dil
+  800500:	74 18                	je     80051a <vprintfmt+0x56>
+            if (!ch) return;
+  800502:	40 84 ff             	test   %dil,%dil
+  800505:	0f 84 b1 06 00 00    	je     800bbc <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  80050b:	40 0f b6 ff          	movzbl %dil,%edi
+  80050f:	4c 89 ee             	mov    %r13,%rsi
+  800512:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  800515:	4c 89 e3             	mov    %r12,%rbx
+  800518:	eb db                	jmp    8004f5 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  80051a:	be 00 00 00 00       	mov    $0x0,%esi
+  80051f:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  800523:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  800528:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  80052e:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  800535:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800539:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  80053e:	41 0f b6 04 24       	movzbl (%r12),%eax
+  800543:	88 45 a0             	mov    %al,-0x60(%rbp)
+  800546:	83 e8 23             	sub    $0x23,%eax
+  800549:	3c 57                	cmp    $0x57,%al
+  80054b:	0f 87 51 06 00 00    	ja     800ba2 <vprintfmt+0x6de>
+  800551:	0f b6 c0             	movzbl %al,%eax
+  800554:	48 b9 60 30 80 00 00 	movabs $0x803060,%rcx
+  80055b:	00 00 00 
+  80055e:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  800561:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  800564:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  800568:	eb cf                	jmp    800539 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  80056a:	49 89 dc             	mov    %rbx,%r12
+  80056d:	be 01 00 00 00       	mov    $0x1,%esi
+  800572:	eb c5                	jmp    800539 <vprintfmt+0x75>
+            padc = ch;
+  800574:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  800578:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  80057b:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80057e:	eb b9                	jmp    800539 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800580:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800583:	83 f8 2f             	cmp    $0x2f,%eax
+  800586:	77 24                	ja     8005ac <vprintfmt+0xe8>
+  800588:	89 c1                	mov    %eax,%ecx
+  80058a:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  80058e:	83 c0 08             	add    $0x8,%eax
+  800591:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800594:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  800597:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  80059a:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  80059e:	79 99                	jns    800539 <vprintfmt+0x75>
+                width = precision;
+  8005a0:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  8005a4:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8005aa:	eb 8d                	jmp    800539 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8005ac:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8005b0:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  8005b4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8005b8:	eb da                	jmp    800594 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  8005ba:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  8005bf:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8005c3:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  8005c9:	3c 39                	cmp    $0x39,%al
+  8005cb:	77 1c                	ja     8005e9 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  8005cd:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  8005d1:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  8005d5:	0f b6 c0             	movzbl %al,%eax
+  8005d8:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8005dd:	0f b6 03             	movzbl (%rbx),%eax
+  8005e0:	3c 39                	cmp    $0x39,%al
+  8005e2:	76 e9                	jbe    8005cd <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  8005e4:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  8005e7:	eb b1                	jmp    80059a <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  8005e9:	49 89 dc             	mov    %rbx,%r12
+  8005ec:	eb ac                	jmp    80059a <vprintfmt+0xd6>
+            width = MAX(0, width);
+  8005ee:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  8005f1:	85 c9                	test   %ecx,%ecx
+  8005f3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005f8:	0f 49 c1             	cmovns %ecx,%eax
+  8005fb:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  8005fe:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800601:	e9 33 ff ff ff       	jmp    800539 <vprintfmt+0x75>
+            lflag++;
+  800606:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  800609:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80060c:	e9 28 ff ff ff       	jmp    800539 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  800611:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800614:	83 f8 2f             	cmp    $0x2f,%eax
+  800617:	77 19                	ja     800632 <vprintfmt+0x16e>
+  800619:	89 c2                	mov    %eax,%edx
+  80061b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80061f:	83 c0 08             	add    $0x8,%eax
+  800622:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800625:	8b 3a                	mov    (%rdx),%edi
+  800627:	4c 89 ee             	mov    %r13,%rsi
+  80062a:	41 ff d6             	call   *%r14
+            break;
+  80062d:	e9 c3 fe ff ff       	jmp    8004f5 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  800632:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800636:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80063a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80063e:	eb e5                	jmp    800625 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  800640:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800643:	83 f8 2f             	cmp    $0x2f,%eax
+  800646:	77 5a                	ja     8006a2 <vprintfmt+0x1de>
+  800648:	89 c2                	mov    %eax,%edx
+  80064a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80064e:	83 c0 08             	add    $0x8,%eax
+  800651:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  800654:	8b 02                	mov    (%rdx),%eax
+  800656:	89 c1                	mov    %eax,%ecx
+  800658:	f7 d9                	neg    %ecx
+  80065a:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  80065d:	83 f9 15             	cmp    $0x15,%ecx
+  800660:	7f 4e                	jg     8006b0 <vprintfmt+0x1ec>
+  800662:	48 63 c1             	movslq %ecx,%rax
+  800665:	48 ba 20 33 80 00 00 	movabs $0x803320,%rdx
+  80066c:	00 00 00 
+  80066f:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  800673:	48 85 c0             	test   %rax,%rax
+  800676:	74 38                	je     8006b0 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  800678:	48 89 c1             	mov    %rax,%rcx
+  80067b:	48 ba d9 34 80 00 00 	movabs $0x8034d9,%rdx
+  800682:	00 00 00 
+  800685:	4c 89 ee             	mov    %r13,%rsi
+  800688:	4c 89 f7             	mov    %r14,%rdi
+  80068b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800690:	49 b8 87 04 80 00 00 	movabs $0x800487,%r8
+  800697:	00 00 00 
+  80069a:	41 ff d0             	call   *%r8
+  80069d:	e9 53 fe ff ff       	jmp    8004f5 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  8006a2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8006a6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006aa:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006ae:	eb a4                	jmp    800654 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  8006b0:	48 ba bc 2e 80 00 00 	movabs $0x802ebc,%rdx
+  8006b7:	00 00 00 
+  8006ba:	4c 89 ee             	mov    %r13,%rsi
+  8006bd:	4c 89 f7             	mov    %r14,%rdi
+  8006c0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006c5:	49 b8 87 04 80 00 00 	movabs $0x800487,%r8
+  8006cc:	00 00 00 
+  8006cf:	41 ff d0             	call   *%r8
+  8006d2:	e9 1e fe ff ff       	jmp    8004f5 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8006d7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006da:	83 f8 2f             	cmp    $0x2f,%eax
+  8006dd:	77 6c                	ja     80074b <vprintfmt+0x287>
+  8006df:	89 c2                	mov    %eax,%edx
+  8006e1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8006e5:	83 c0 08             	add    $0x8,%eax
+  8006e8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8006eb:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  8006ee:	48 85 d2             	test   %rdx,%rdx
+  8006f1:	48 b8 b5 2e 80 00 00 	movabs $0x802eb5,%rax
+  8006f8:	00 00 00 
+  8006fb:	48 0f 45 c2          	cmovne %rdx,%rax
+  8006ff:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  800703:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800707:	7e 06                	jle    80070f <vprintfmt+0x24b>
+  800709:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  80070d:	75 4a                	jne    800759 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  80070f:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800713:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  800717:	0f b6 00             	movzbl (%rax),%eax
+  80071a:	84 c0                	test   %al,%al
+  80071c:	0f 85 9a 00 00 00    	jne    8007bc <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  800722:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800725:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  800729:	85 c0                	test   %eax,%eax
+  80072b:	0f 8e c4 fd ff ff    	jle    8004f5 <vprintfmt+0x31>
+  800731:	4c 89 ee             	mov    %r13,%rsi
+  800734:	bf 20 00 00 00       	mov    $0x20,%edi
+  800739:	41 ff d6             	call   *%r14
+  80073c:	41 83 ec 01          	sub    $0x1,%r12d
+  800740:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  800744:	75 eb                	jne    800731 <vprintfmt+0x26d>
+  800746:	e9 aa fd ff ff       	jmp    8004f5 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  80074b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80074f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800753:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800757:	eb 92                	jmp    8006eb <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  800759:	49 63 f7             	movslq %r15d,%rsi
+  80075c:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  800760:	48 b8 76 0c 80 00 00 	movabs $0x800c76,%rax
+  800767:	00 00 00 
+  80076a:	ff d0                	call   *%rax
+  80076c:	48 89 c2             	mov    %rax,%rdx
+  80076f:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800772:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  800774:	8d 70 ff             	lea    -0x1(%rax),%esi
+  800777:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  80077a:	85 c0                	test   %eax,%eax
+  80077c:	7e 91                	jle    80070f <vprintfmt+0x24b>
+  80077e:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  800783:	4c 89 ee             	mov    %r13,%rsi
+  800786:	44 89 e7             	mov    %r12d,%edi
+  800789:	41 ff d6             	call   *%r14
+  80078c:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800790:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800793:	83 f8 ff             	cmp    $0xffffffff,%eax
+  800796:	75 eb                	jne    800783 <vprintfmt+0x2bf>
+  800798:	e9 72 ff ff ff       	jmp    80070f <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  80079d:	0f b6 f8             	movzbl %al,%edi
+  8007a0:	4c 89 ee             	mov    %r13,%rsi
+  8007a3:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8007a6:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8007aa:	49 83 c4 01          	add    $0x1,%r12
+  8007ae:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  8007b4:	84 c0                	test   %al,%al
+  8007b6:	0f 84 66 ff ff ff    	je     800722 <vprintfmt+0x25e>
+  8007bc:	45 85 ff             	test   %r15d,%r15d
+  8007bf:	78 0a                	js     8007cb <vprintfmt+0x307>
+  8007c1:	41 83 ef 01          	sub    $0x1,%r15d
+  8007c5:	0f 88 57 ff ff ff    	js     800722 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8007cb:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  8007cf:	74 cc                	je     80079d <vprintfmt+0x2d9>
+  8007d1:	8d 50 e0             	lea    -0x20(%rax),%edx
+  8007d4:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  8007d9:	80 fa 5e             	cmp    $0x5e,%dl
+  8007dc:	77 c2                	ja     8007a0 <vprintfmt+0x2dc>
+  8007de:	eb bd                	jmp    80079d <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  8007e0:	40 84 f6             	test   %sil,%sil
+  8007e3:	75 26                	jne    80080b <vprintfmt+0x347>
+    switch (lflag) {
+  8007e5:	85 d2                	test   %edx,%edx
+  8007e7:	74 59                	je     800842 <vprintfmt+0x37e>
+  8007e9:	83 fa 01             	cmp    $0x1,%edx
+  8007ec:	74 7b                	je     800869 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  8007ee:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007f1:	83 f8 2f             	cmp    $0x2f,%eax
+  8007f4:	0f 87 96 00 00 00    	ja     800890 <vprintfmt+0x3cc>
+  8007fa:	89 c2                	mov    %eax,%edx
+  8007fc:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800800:	83 c0 08             	add    $0x8,%eax
+  800803:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800806:	4c 8b 22             	mov    (%rdx),%r12
+  800809:	eb 17                	jmp    800822 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  80080b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80080e:	83 f8 2f             	cmp    $0x2f,%eax
+  800811:	77 21                	ja     800834 <vprintfmt+0x370>
+  800813:	89 c2                	mov    %eax,%edx
+  800815:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800819:	83 c0 08             	add    $0x8,%eax
+  80081c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80081f:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  800822:	4d 85 e4             	test   %r12,%r12
+  800825:	78 7a                	js     8008a1 <vprintfmt+0x3dd>
+            num = i;
+  800827:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  80082a:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  80082f:	e9 50 02 00 00       	jmp    800a84 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800834:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800838:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80083c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800840:	eb dd                	jmp    80081f <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  800842:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800845:	83 f8 2f             	cmp    $0x2f,%eax
+  800848:	77 11                	ja     80085b <vprintfmt+0x397>
+  80084a:	89 c2                	mov    %eax,%edx
+  80084c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800850:	83 c0 08             	add    $0x8,%eax
+  800853:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800856:	4c 63 22             	movslq (%rdx),%r12
+  800859:	eb c7                	jmp    800822 <vprintfmt+0x35e>
+  80085b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80085f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800863:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800867:	eb ed                	jmp    800856 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  800869:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80086c:	83 f8 2f             	cmp    $0x2f,%eax
+  80086f:	77 11                	ja     800882 <vprintfmt+0x3be>
+  800871:	89 c2                	mov    %eax,%edx
+  800873:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800877:	83 c0 08             	add    $0x8,%eax
+  80087a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80087d:	4c 8b 22             	mov    (%rdx),%r12
+  800880:	eb a0                	jmp    800822 <vprintfmt+0x35e>
+  800882:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800886:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80088a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80088e:	eb ed                	jmp    80087d <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  800890:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800894:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800898:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80089c:	e9 65 ff ff ff       	jmp    800806 <vprintfmt+0x342>
+                putch('-', put_arg);
+  8008a1:	4c 89 ee             	mov    %r13,%rsi
+  8008a4:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  8008a9:	41 ff d6             	call   *%r14
+                i = -i;
+  8008ac:	49 f7 dc             	neg    %r12
+  8008af:	e9 73 ff ff ff       	jmp    800827 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  8008b4:	40 84 f6             	test   %sil,%sil
+  8008b7:	75 32                	jne    8008eb <vprintfmt+0x427>
+    switch (lflag) {
+  8008b9:	85 d2                	test   %edx,%edx
+  8008bb:	74 5d                	je     80091a <vprintfmt+0x456>
+  8008bd:	83 fa 01             	cmp    $0x1,%edx
+  8008c0:	0f 84 82 00 00 00    	je     800948 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  8008c6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008c9:	83 f8 2f             	cmp    $0x2f,%eax
+  8008cc:	0f 87 a5 00 00 00    	ja     800977 <vprintfmt+0x4b3>
+  8008d2:	89 c2                	mov    %eax,%edx
+  8008d4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008d8:	83 c0 08             	add    $0x8,%eax
+  8008db:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008de:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8008e1:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  8008e6:	e9 99 01 00 00       	jmp    800a84 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8008eb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008ee:	83 f8 2f             	cmp    $0x2f,%eax
+  8008f1:	77 19                	ja     80090c <vprintfmt+0x448>
+  8008f3:	89 c2                	mov    %eax,%edx
+  8008f5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008f9:	83 c0 08             	add    $0x8,%eax
+  8008fc:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008ff:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800902:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800907:	e9 78 01 00 00       	jmp    800a84 <vprintfmt+0x5c0>
+  80090c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800910:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800914:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800918:	eb e5                	jmp    8008ff <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  80091a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80091d:	83 f8 2f             	cmp    $0x2f,%eax
+  800920:	77 18                	ja     80093a <vprintfmt+0x476>
+  800922:	89 c2                	mov    %eax,%edx
+  800924:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800928:	83 c0 08             	add    $0x8,%eax
+  80092b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80092e:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800930:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  800935:	e9 4a 01 00 00       	jmp    800a84 <vprintfmt+0x5c0>
+  80093a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80093e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800942:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800946:	eb e6                	jmp    80092e <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  800948:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80094b:	83 f8 2f             	cmp    $0x2f,%eax
+  80094e:	77 19                	ja     800969 <vprintfmt+0x4a5>
+  800950:	89 c2                	mov    %eax,%edx
+  800952:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800956:	83 c0 08             	add    $0x8,%eax
+  800959:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80095c:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  80095f:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  800964:	e9 1b 01 00 00       	jmp    800a84 <vprintfmt+0x5c0>
+  800969:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80096d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800971:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800975:	eb e5                	jmp    80095c <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  800977:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80097b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80097f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800983:	e9 56 ff ff ff       	jmp    8008de <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  800988:	40 84 f6             	test   %sil,%sil
+  80098b:	75 2e                	jne    8009bb <vprintfmt+0x4f7>
+    switch (lflag) {
+  80098d:	85 d2                	test   %edx,%edx
+  80098f:	74 59                	je     8009ea <vprintfmt+0x526>
+  800991:	83 fa 01             	cmp    $0x1,%edx
+  800994:	74 7f                	je     800a15 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  800996:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800999:	83 f8 2f             	cmp    $0x2f,%eax
+  80099c:	0f 87 9f 00 00 00    	ja     800a41 <vprintfmt+0x57d>
+  8009a2:	89 c2                	mov    %eax,%edx
+  8009a4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009a8:	83 c0 08             	add    $0x8,%eax
+  8009ab:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009ae:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8009b1:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  8009b6:	e9 c9 00 00 00       	jmp    800a84 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8009bb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009be:	83 f8 2f             	cmp    $0x2f,%eax
+  8009c1:	77 19                	ja     8009dc <vprintfmt+0x518>
+  8009c3:	89 c2                	mov    %eax,%edx
+  8009c5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009c9:	83 c0 08             	add    $0x8,%eax
+  8009cc:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009cf:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8009d2:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8009d7:	e9 a8 00 00 00       	jmp    800a84 <vprintfmt+0x5c0>
+  8009dc:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009e0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009e4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009e8:	eb e5                	jmp    8009cf <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  8009ea:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009ed:	83 f8 2f             	cmp    $0x2f,%eax
+  8009f0:	77 15                	ja     800a07 <vprintfmt+0x543>
+  8009f2:	89 c2                	mov    %eax,%edx
+  8009f4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009f8:	83 c0 08             	add    $0x8,%eax
+  8009fb:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009fe:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  800a00:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  800a05:	eb 7d                	jmp    800a84 <vprintfmt+0x5c0>
+  800a07:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a0b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a0f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a13:	eb e9                	jmp    8009fe <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  800a15:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a18:	83 f8 2f             	cmp    $0x2f,%eax
+  800a1b:	77 16                	ja     800a33 <vprintfmt+0x56f>
+  800a1d:	89 c2                	mov    %eax,%edx
+  800a1f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a23:	83 c0 08             	add    $0x8,%eax
+  800a26:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a29:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800a2c:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  800a31:	eb 51                	jmp    800a84 <vprintfmt+0x5c0>
+  800a33:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a37:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a3b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a3f:	eb e8                	jmp    800a29 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  800a41:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a45:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a49:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a4d:	e9 5c ff ff ff       	jmp    8009ae <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  800a52:	4c 89 ee             	mov    %r13,%rsi
+  800a55:	bf 30 00 00 00       	mov    $0x30,%edi
+  800a5a:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800a5d:	4c 89 ee             	mov    %r13,%rsi
+  800a60:	bf 78 00 00 00       	mov    $0x78,%edi
+  800a65:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800a68:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a6b:	83 f8 2f             	cmp    $0x2f,%eax
+  800a6e:	77 47                	ja     800ab7 <vprintfmt+0x5f3>
+  800a70:	89 c2                	mov    %eax,%edx
+  800a72:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a76:	83 c0 08             	add    $0x8,%eax
+  800a79:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a7c:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800a7f:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800a84:	48 83 ec 08          	sub    $0x8,%rsp
+  800a88:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800a8c:	0f 94 c0             	sete   %al
+  800a8f:	0f b6 c0             	movzbl %al,%eax
+  800a92:	50                   	push   %rax
+  800a93:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800a98:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800a9c:	4c 89 ee             	mov    %r13,%rsi
+  800a9f:	4c 89 f7             	mov    %r14,%rdi
+  800aa2:	48 b8 b9 03 80 00 00 	movabs $0x8003b9,%rax
+  800aa9:	00 00 00 
+  800aac:	ff d0                	call   *%rax
+            break;
+  800aae:	48 83 c4 10          	add    $0x10,%rsp
+  800ab2:	e9 3e fa ff ff       	jmp    8004f5 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800ab7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800abb:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800abf:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ac3:	eb b7                	jmp    800a7c <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  800ac5:	40 84 f6             	test   %sil,%sil
+  800ac8:	75 2b                	jne    800af5 <vprintfmt+0x631>
+    switch (lflag) {
+  800aca:	85 d2                	test   %edx,%edx
+  800acc:	74 56                	je     800b24 <vprintfmt+0x660>
+  800ace:	83 fa 01             	cmp    $0x1,%edx
+  800ad1:	74 7f                	je     800b52 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800ad3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ad6:	83 f8 2f             	cmp    $0x2f,%eax
+  800ad9:	0f 87 a2 00 00 00    	ja     800b81 <vprintfmt+0x6bd>
+  800adf:	89 c2                	mov    %eax,%edx
+  800ae1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ae5:	83 c0 08             	add    $0x8,%eax
+  800ae8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800aeb:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800aee:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800af3:	eb 8f                	jmp    800a84 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800af5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800af8:	83 f8 2f             	cmp    $0x2f,%eax
+  800afb:	77 19                	ja     800b16 <vprintfmt+0x652>
+  800afd:	89 c2                	mov    %eax,%edx
+  800aff:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b03:	83 c0 08             	add    $0x8,%eax
+  800b06:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b09:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800b0c:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800b11:	e9 6e ff ff ff       	jmp    800a84 <vprintfmt+0x5c0>
+  800b16:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b1a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b1e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b22:	eb e5                	jmp    800b09 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800b24:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b27:	83 f8 2f             	cmp    $0x2f,%eax
+  800b2a:	77 18                	ja     800b44 <vprintfmt+0x680>
+  800b2c:	89 c2                	mov    %eax,%edx
+  800b2e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b32:	83 c0 08             	add    $0x8,%eax
+  800b35:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b38:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800b3a:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800b3f:	e9 40 ff ff ff       	jmp    800a84 <vprintfmt+0x5c0>
+  800b44:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b48:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b4c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b50:	eb e6                	jmp    800b38 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800b52:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b55:	83 f8 2f             	cmp    $0x2f,%eax
+  800b58:	77 19                	ja     800b73 <vprintfmt+0x6af>
+  800b5a:	89 c2                	mov    %eax,%edx
+  800b5c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b60:	83 c0 08             	add    $0x8,%eax
+  800b63:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b66:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800b69:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800b6e:	e9 11 ff ff ff       	jmp    800a84 <vprintfmt+0x5c0>
+  800b73:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b77:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b7b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b7f:	eb e5                	jmp    800b66 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800b81:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b85:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b89:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b8d:	e9 59 ff ff ff       	jmp    800aeb <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800b92:	4c 89 ee             	mov    %r13,%rsi
+  800b95:	bf 25 00 00 00       	mov    $0x25,%edi
+  800b9a:	41 ff d6             	call   *%r14
+            break;
+  800b9d:	e9 53 f9 ff ff       	jmp    8004f5 <vprintfmt+0x31>
+            putch('%', put_arg);
+  800ba2:	4c 89 ee             	mov    %r13,%rsi
+  800ba5:	bf 25 00 00 00       	mov    $0x25,%edi
+  800baa:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800bad:	48 83 eb 01          	sub    $0x1,%rbx
+  800bb1:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800bb5:	75 f6                	jne    800bad <vprintfmt+0x6e9>
+  800bb7:	e9 39 f9 ff ff       	jmp    8004f5 <vprintfmt+0x31>
+}
+  800bbc:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800bc0:	5b                   	pop    %rbx
+  800bc1:	41 5c                	pop    %r12
+  800bc3:	41 5d                	pop    %r13
+  800bc5:	41 5e                	pop    %r14
+  800bc7:	41 5f                	pop    %r15
+  800bc9:	5d                   	pop    %rbp
+  800bca:	c3                   	ret
+
+0000000000800bcb <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800bcb:	55                   	push   %rbp
+  800bcc:	48 89 e5             	mov    %rsp,%rbp
+  800bcf:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800bd3:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800bd7:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800bdc:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800be0:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800be7:	48 85 ff             	test   %rdi,%rdi
+  800bea:	74 2b                	je     800c17 <vsnprintf+0x4c>
+  800bec:	48 85 f6             	test   %rsi,%rsi
+  800bef:	74 26                	je     800c17 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800bf1:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800bf5:	48 bf 6f 04 80 00 00 	movabs $0x80046f,%rdi
+  800bfc:	00 00 00 
+  800bff:	48 b8 c4 04 80 00 00 	movabs $0x8004c4,%rax
+  800c06:	00 00 00 
+  800c09:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800c0b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800c0f:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800c12:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800c15:	c9                   	leave
+  800c16:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800c17:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800c1c:	eb f7                	jmp    800c15 <vsnprintf+0x4a>
+
+0000000000800c1e <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800c1e:	55                   	push   %rbp
+  800c1f:	48 89 e5             	mov    %rsp,%rbp
+  800c22:	48 83 ec 50          	sub    $0x50,%rsp
+  800c26:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800c2a:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800c2e:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800c32:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800c39:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800c3d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c41:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800c45:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800c49:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800c4d:	48 b8 cb 0b 80 00 00 	movabs $0x800bcb,%rax
+  800c54:	00 00 00 
+  800c57:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800c59:	c9                   	leave
+  800c5a:	c3                   	ret
+
+0000000000800c5b <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800c5b:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800c5e:	74 10                	je     800c70 <strlen+0x15>
+    size_t n = 0;
+  800c60:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800c65:	48 83 c0 01          	add    $0x1,%rax
+  800c69:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800c6d:	75 f6                	jne    800c65 <strlen+0xa>
+  800c6f:	c3                   	ret
+    size_t n = 0;
+  800c70:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800c75:	c3                   	ret
+
+0000000000800c76 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800c76:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800c79:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800c7e:	48 85 f6             	test   %rsi,%rsi
+  800c81:	74 11                	je     800c94 <strnlen+0x1e>
+  800c83:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800c87:	74 0c                	je     800c95 <strnlen+0x1f>
+  800c89:	48 83 c2 01          	add    $0x1,%rdx
+  800c8d:	48 39 d0             	cmp    %rdx,%rax
+  800c90:	75 f1                	jne    800c83 <strnlen+0xd>
+  800c92:	eb 04                	jmp    800c98 <strnlen+0x22>
+  800c94:	c3                   	ret
+  800c95:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800c98:	c3                   	ret
+
+0000000000800c99 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800c99:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800c9c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ca1:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800ca5:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800ca8:	48 83 c2 01          	add    $0x1,%rdx
+  800cac:	84 c9                	test   %cl,%cl
+  800cae:	75 f1                	jne    800ca1 <strcpy+0x8>
+        ;
+    return res;
+}
+  800cb0:	c3                   	ret
+
+0000000000800cb1 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800cb1:	55                   	push   %rbp
+  800cb2:	48 89 e5             	mov    %rsp,%rbp
+  800cb5:	41 54                	push   %r12
+  800cb7:	53                   	push   %rbx
+  800cb8:	48 89 fb             	mov    %rdi,%rbx
+  800cbb:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800cbe:	48 b8 5b 0c 80 00 00 	movabs $0x800c5b,%rax
+  800cc5:	00 00 00 
+  800cc8:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800cca:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800cce:	4c 89 e6             	mov    %r12,%rsi
+  800cd1:	48 b8 99 0c 80 00 00 	movabs $0x800c99,%rax
+  800cd8:	00 00 00 
+  800cdb:	ff d0                	call   *%rax
+    return dst;
+}
+  800cdd:	48 89 d8             	mov    %rbx,%rax
+  800ce0:	5b                   	pop    %rbx
+  800ce1:	41 5c                	pop    %r12
+  800ce3:	5d                   	pop    %rbp
+  800ce4:	c3                   	ret
+
+0000000000800ce5 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800ce5:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800ce8:	48 85 d2             	test   %rdx,%rdx
+  800ceb:	74 1f                	je     800d0c <strncpy+0x27>
+  800ced:	48 01 fa             	add    %rdi,%rdx
+  800cf0:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800cf3:	48 83 c1 01          	add    $0x1,%rcx
+  800cf7:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800cfb:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800cff:	41 80 f8 01          	cmp    $0x1,%r8b
+  800d03:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800d07:	48 39 ca             	cmp    %rcx,%rdx
+  800d0a:	75 e7                	jne    800cf3 <strncpy+0xe>
+    }
+    return ret;
+}
+  800d0c:	c3                   	ret
+
+0000000000800d0d <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800d0d:	48 89 f8             	mov    %rdi,%rax
+  800d10:	48 85 d2             	test   %rdx,%rdx
+  800d13:	74 24                	je     800d39 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800d15:	48 83 ea 01          	sub    $0x1,%rdx
+  800d19:	74 1b                	je     800d36 <strlcpy+0x29>
+  800d1b:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800d1f:	0f b6 16             	movzbl (%rsi),%edx
+  800d22:	84 d2                	test   %dl,%dl
+  800d24:	74 10                	je     800d36 <strlcpy+0x29>
+            *dst++ = *src++;
+  800d26:	48 83 c6 01          	add    $0x1,%rsi
+  800d2a:	48 83 c0 01          	add    $0x1,%rax
+  800d2e:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800d31:	48 39 c8             	cmp    %rcx,%rax
+  800d34:	75 e9                	jne    800d1f <strlcpy+0x12>
+        *dst = '\0';
+  800d36:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800d39:	48 29 f8             	sub    %rdi,%rax
+}
+  800d3c:	c3                   	ret
+
+0000000000800d3d <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800d3d:	0f b6 07             	movzbl (%rdi),%eax
+  800d40:	84 c0                	test   %al,%al
+  800d42:	74 13                	je     800d57 <strcmp+0x1a>
+  800d44:	38 06                	cmp    %al,(%rsi)
+  800d46:	75 0f                	jne    800d57 <strcmp+0x1a>
+  800d48:	48 83 c7 01          	add    $0x1,%rdi
+  800d4c:	48 83 c6 01          	add    $0x1,%rsi
+  800d50:	0f b6 07             	movzbl (%rdi),%eax
+  800d53:	84 c0                	test   %al,%al
+  800d55:	75 ed                	jne    800d44 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800d57:	0f b6 c0             	movzbl %al,%eax
+  800d5a:	0f b6 16             	movzbl (%rsi),%edx
+  800d5d:	29 d0                	sub    %edx,%eax
+}
+  800d5f:	c3                   	ret
+
+0000000000800d60 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800d60:	48 85 d2             	test   %rdx,%rdx
+  800d63:	74 1f                	je     800d84 <strncmp+0x24>
+  800d65:	0f b6 07             	movzbl (%rdi),%eax
+  800d68:	84 c0                	test   %al,%al
+  800d6a:	74 1e                	je     800d8a <strncmp+0x2a>
+  800d6c:	3a 06                	cmp    (%rsi),%al
+  800d6e:	75 1a                	jne    800d8a <strncmp+0x2a>
+  800d70:	48 83 c7 01          	add    $0x1,%rdi
+  800d74:	48 83 c6 01          	add    $0x1,%rsi
+  800d78:	48 83 ea 01          	sub    $0x1,%rdx
+  800d7c:	75 e7                	jne    800d65 <strncmp+0x5>
+
+    if (!n) return 0;
+  800d7e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d83:	c3                   	ret
+  800d84:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d89:	c3                   	ret
+  800d8a:	48 85 d2             	test   %rdx,%rdx
+  800d8d:	74 09                	je     800d98 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800d8f:	0f b6 07             	movzbl (%rdi),%eax
+  800d92:	0f b6 16             	movzbl (%rsi),%edx
+  800d95:	29 d0                	sub    %edx,%eax
+  800d97:	c3                   	ret
+    if (!n) return 0;
+  800d98:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800d9d:	c3                   	ret
+
+0000000000800d9e <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800d9e:	0f b6 17             	movzbl (%rdi),%edx
+  800da1:	84 d2                	test   %dl,%dl
+  800da3:	74 18                	je     800dbd <strchr+0x1f>
+        if (*str == c) {
+  800da5:	0f be d2             	movsbl %dl,%edx
+  800da8:	39 f2                	cmp    %esi,%edx
+  800daa:	74 17                	je     800dc3 <strchr+0x25>
+    for (; *str; str++) {
+  800dac:	48 83 c7 01          	add    $0x1,%rdi
+  800db0:	0f b6 17             	movzbl (%rdi),%edx
+  800db3:	84 d2                	test   %dl,%dl
+  800db5:	75 ee                	jne    800da5 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800db7:	b8 00 00 00 00       	mov    $0x0,%eax
+  800dbc:	c3                   	ret
+  800dbd:	b8 00 00 00 00       	mov    $0x0,%eax
+  800dc2:	c3                   	ret
+  800dc3:	48 89 f8             	mov    %rdi,%rax
+}
+  800dc6:	c3                   	ret
+
+0000000000800dc7 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800dc7:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800dca:	0f b6 17             	movzbl (%rdi),%edx
+  800dcd:	84 d2                	test   %dl,%dl
+  800dcf:	74 13                	je     800de4 <strfind+0x1d>
+  800dd1:	0f be d2             	movsbl %dl,%edx
+  800dd4:	39 f2                	cmp    %esi,%edx
+  800dd6:	74 0b                	je     800de3 <strfind+0x1c>
+  800dd8:	48 83 c0 01          	add    $0x1,%rax
+  800ddc:	0f b6 10             	movzbl (%rax),%edx
+  800ddf:	84 d2                	test   %dl,%dl
+  800de1:	75 ee                	jne    800dd1 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800de3:	c3                   	ret
+  800de4:	c3                   	ret
+
+0000000000800de5 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800de5:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800de8:	48 89 f8             	mov    %rdi,%rax
+  800deb:	48 f7 d8             	neg    %rax
+  800dee:	83 e0 07             	and    $0x7,%eax
+  800df1:	49 89 d1             	mov    %rdx,%r9
+  800df4:	49 29 c1             	sub    %rax,%r9
+  800df7:	78 36                	js     800e2f <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800df9:	40 0f b6 c6          	movzbl %sil,%eax
+  800dfd:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800e04:	01 01 01 
+  800e07:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800e0b:	40 f6 c7 07          	test   $0x7,%dil
+  800e0f:	75 38                	jne    800e49 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800e11:	4c 89 c9             	mov    %r9,%rcx
+  800e14:	48 c1 f9 03          	sar    $0x3,%rcx
+  800e18:	74 0c                	je     800e26 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800e1a:	fc                   	cld
+  800e1b:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800e1e:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800e22:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800e26:	4d 85 c9             	test   %r9,%r9
+  800e29:	75 45                	jne    800e70 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800e2b:	4c 89 c0             	mov    %r8,%rax
+  800e2e:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800e2f:	48 85 d2             	test   %rdx,%rdx
+  800e32:	74 f7                	je     800e2b <memset+0x46>
+  800e34:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800e37:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800e3a:	48 83 c0 01          	add    $0x1,%rax
+  800e3e:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  800e42:	48 39 c2             	cmp    %rax,%rdx
+  800e45:	75 f3                	jne    800e3a <memset+0x55>
+  800e47:	eb e2                	jmp    800e2b <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  800e49:	40 f6 c7 01          	test   $0x1,%dil
+  800e4d:	74 06                	je     800e55 <memset+0x70>
+  800e4f:	88 07                	mov    %al,(%rdi)
+  800e51:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800e55:	40 f6 c7 02          	test   $0x2,%dil
+  800e59:	74 07                	je     800e62 <memset+0x7d>
+  800e5b:	66 89 07             	mov    %ax,(%rdi)
+  800e5e:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800e62:	40 f6 c7 04          	test   $0x4,%dil
+  800e66:	74 a9                	je     800e11 <memset+0x2c>
+  800e68:	89 07                	mov    %eax,(%rdi)
+  800e6a:	48 83 c7 04          	add    $0x4,%rdi
+  800e6e:	eb a1                	jmp    800e11 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800e70:	41 f6 c1 04          	test   $0x4,%r9b
+  800e74:	74 06                	je     800e7c <memset+0x97>
+  800e76:	89 07                	mov    %eax,(%rdi)
+  800e78:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800e7c:	41 f6 c1 02          	test   $0x2,%r9b
+  800e80:	74 07                	je     800e89 <memset+0xa4>
+  800e82:	66 89 07             	mov    %ax,(%rdi)
+  800e85:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  800e89:	41 f6 c1 01          	test   $0x1,%r9b
+  800e8d:	74 9c                	je     800e2b <memset+0x46>
+  800e8f:	88 07                	mov    %al,(%rdi)
+  800e91:	eb 98                	jmp    800e2b <memset+0x46>
+
+0000000000800e93 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  800e93:	48 89 f8             	mov    %rdi,%rax
+  800e96:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  800e99:	48 39 fe             	cmp    %rdi,%rsi
+  800e9c:	73 3b                	jae    800ed9 <memmove+0x46>
+  800e9e:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  800ea2:	48 39 d7             	cmp    %rdx,%rdi
+  800ea5:	73 32                	jae    800ed9 <memmove+0x46>
+        s += n;
+        d += n;
+  800ea7:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800eab:	48 89 d6             	mov    %rdx,%rsi
+  800eae:	48 09 fe             	or     %rdi,%rsi
+  800eb1:	48 09 ce             	or     %rcx,%rsi
+  800eb4:	40 f6 c6 07          	test   $0x7,%sil
+  800eb8:	75 12                	jne    800ecc <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  800eba:	48 83 ef 08          	sub    $0x8,%rdi
+  800ebe:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  800ec2:	48 c1 e9 03          	shr    $0x3,%rcx
+  800ec6:	fd                   	std
+  800ec7:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  800eca:	fc                   	cld
+  800ecb:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  800ecc:	48 83 ef 01          	sub    $0x1,%rdi
+  800ed0:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  800ed4:	fd                   	std
+  800ed5:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  800ed7:	eb f1                	jmp    800eca <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800ed9:	48 89 f2             	mov    %rsi,%rdx
+  800edc:	48 09 c2             	or     %rax,%rdx
+  800edf:	48 09 ca             	or     %rcx,%rdx
+  800ee2:	f6 c2 07             	test   $0x7,%dl
+  800ee5:	75 0c                	jne    800ef3 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  800ee7:	48 c1 e9 03          	shr    $0x3,%rcx
+  800eeb:	48 89 c7             	mov    %rax,%rdi
+  800eee:	fc                   	cld
+  800eef:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  800ef2:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  800ef3:	48 89 c7             	mov    %rax,%rdi
+  800ef6:	fc                   	cld
+  800ef7:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  800ef9:	c3                   	ret
+
+0000000000800efa <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  800efa:	55                   	push   %rbp
+  800efb:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  800efe:	48 b8 93 0e 80 00 00 	movabs $0x800e93,%rax
+  800f05:	00 00 00 
+  800f08:	ff d0                	call   *%rax
+}
+  800f0a:	5d                   	pop    %rbp
+  800f0b:	c3                   	ret
+
+0000000000800f0c <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  800f0c:	55                   	push   %rbp
+  800f0d:	48 89 e5             	mov    %rsp,%rbp
+  800f10:	41 57                	push   %r15
+  800f12:	41 56                	push   %r14
+  800f14:	41 55                	push   %r13
+  800f16:	41 54                	push   %r12
+  800f18:	53                   	push   %rbx
+  800f19:	48 83 ec 08          	sub    $0x8,%rsp
+  800f1d:	49 89 fe             	mov    %rdi,%r14
+  800f20:	49 89 f7             	mov    %rsi,%r15
+  800f23:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  800f26:	48 89 f7             	mov    %rsi,%rdi
+  800f29:	48 b8 5b 0c 80 00 00 	movabs $0x800c5b,%rax
+  800f30:	00 00 00 
+  800f33:	ff d0                	call   *%rax
+  800f35:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  800f38:	48 89 de             	mov    %rbx,%rsi
+  800f3b:	4c 89 f7             	mov    %r14,%rdi
+  800f3e:	48 b8 76 0c 80 00 00 	movabs $0x800c76,%rax
+  800f45:	00 00 00 
+  800f48:	ff d0                	call   *%rax
+  800f4a:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  800f4d:	48 39 c3             	cmp    %rax,%rbx
+  800f50:	74 36                	je     800f88 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  800f52:	48 89 d8             	mov    %rbx,%rax
+  800f55:	4c 29 e8             	sub    %r13,%rax
+  800f58:	49 39 c4             	cmp    %rax,%r12
+  800f5b:	73 31                	jae    800f8e <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  800f5d:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  800f62:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800f66:	4c 89 fe             	mov    %r15,%rsi
+  800f69:	48 b8 fa 0e 80 00 00 	movabs $0x800efa,%rax
+  800f70:	00 00 00 
+  800f73:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  800f75:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  800f79:	48 83 c4 08          	add    $0x8,%rsp
+  800f7d:	5b                   	pop    %rbx
+  800f7e:	41 5c                	pop    %r12
+  800f80:	41 5d                	pop    %r13
+  800f82:	41 5e                	pop    %r14
+  800f84:	41 5f                	pop    %r15
+  800f86:	5d                   	pop    %rbp
+  800f87:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  800f88:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800f8c:	eb eb                	jmp    800f79 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  800f8e:	48 83 eb 01          	sub    $0x1,%rbx
+  800f92:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800f96:	48 89 da             	mov    %rbx,%rdx
+  800f99:	4c 89 fe             	mov    %r15,%rsi
+  800f9c:	48 b8 fa 0e 80 00 00 	movabs $0x800efa,%rax
+  800fa3:	00 00 00 
+  800fa6:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  800fa8:	49 01 de             	add    %rbx,%r14
+  800fab:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  800fb0:	eb c3                	jmp    800f75 <strlcat+0x69>
+
+0000000000800fb2 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  800fb2:	48 85 d2             	test   %rdx,%rdx
+  800fb5:	74 2d                	je     800fe4 <memcmp+0x32>
+  800fb7:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  800fbc:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800fc0:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  800fc5:	44 38 c1             	cmp    %r8b,%cl
+  800fc8:	75 0f                	jne    800fd9 <memcmp+0x27>
+    while (n-- > 0) {
+  800fca:	48 83 c0 01          	add    $0x1,%rax
+  800fce:	48 39 c2             	cmp    %rax,%rdx
+  800fd1:	75 e9                	jne    800fbc <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  800fd3:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fd8:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  800fd9:	0f b6 c1             	movzbl %cl,%eax
+  800fdc:	45 0f b6 c0          	movzbl %r8b,%r8d
+  800fe0:	44 29 c0             	sub    %r8d,%eax
+  800fe3:	c3                   	ret
+    return 0;
+  800fe4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800fe9:	c3                   	ret
+
+0000000000800fea <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  800fea:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  800fee:	48 39 c7             	cmp    %rax,%rdi
+  800ff1:	73 0f                	jae    801002 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  800ff3:	40 38 37             	cmp    %sil,(%rdi)
+  800ff6:	74 0e                	je     801006 <memfind+0x1c>
+    for (; src < end; src++) {
+  800ff8:	48 83 c7 01          	add    $0x1,%rdi
+  800ffc:	48 39 f8             	cmp    %rdi,%rax
+  800fff:	75 f2                	jne    800ff3 <memfind+0x9>
+  801001:	c3                   	ret
+  801002:	48 89 f8             	mov    %rdi,%rax
+  801005:	c3                   	ret
+  801006:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  801009:	c3                   	ret
+
+000000000080100a <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  80100a:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  80100d:	0f b6 37             	movzbl (%rdi),%esi
+  801010:	40 80 fe 20          	cmp    $0x20,%sil
+  801014:	74 06                	je     80101c <strtol+0x12>
+  801016:	40 80 fe 09          	cmp    $0x9,%sil
+  80101a:	75 13                	jne    80102f <strtol+0x25>
+  80101c:	48 83 c7 01          	add    $0x1,%rdi
+  801020:	0f b6 37             	movzbl (%rdi),%esi
+  801023:	40 80 fe 20          	cmp    $0x20,%sil
+  801027:	74 f3                	je     80101c <strtol+0x12>
+  801029:	40 80 fe 09          	cmp    $0x9,%sil
+  80102d:	74 ed                	je     80101c <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  80102f:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  801032:	83 e0 fd             	and    $0xfffffffd,%eax
+  801035:	3c 01                	cmp    $0x1,%al
+  801037:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  80103b:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  801041:	75 0f                	jne    801052 <strtol+0x48>
+  801043:	80 3f 30             	cmpb   $0x30,(%rdi)
+  801046:	74 14                	je     80105c <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  801048:	85 d2                	test   %edx,%edx
+  80104a:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80104f:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  801052:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  801057:	4c 63 ca             	movslq %edx,%r9
+  80105a:	eb 36                	jmp    801092 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  80105c:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  801060:	74 0f                	je     801071 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  801062:	85 d2                	test   %edx,%edx
+  801064:	75 ec                	jne    801052 <strtol+0x48>
+        s++;
+  801066:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  80106a:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  80106f:	eb e1                	jmp    801052 <strtol+0x48>
+        s += 2;
+  801071:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  801075:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  80107a:	eb d6                	jmp    801052 <strtol+0x48>
+            dig -= '0';
+  80107c:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  80107f:	44 0f b6 c1          	movzbl %cl,%r8d
+  801083:	41 39 d0             	cmp    %edx,%r8d
+  801086:	7d 21                	jge    8010a9 <strtol+0x9f>
+        val = val * base + dig;
+  801088:	49 0f af c1          	imul   %r9,%rax
+  80108c:	0f b6 c9             	movzbl %cl,%ecx
+  80108f:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  801092:	48 83 c7 01          	add    $0x1,%rdi
+  801096:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  80109a:	80 f9 39             	cmp    $0x39,%cl
+  80109d:	76 dd                	jbe    80107c <strtol+0x72>
+        else if (dig - 'a' < 27)
+  80109f:	80 f9 7b             	cmp    $0x7b,%cl
+  8010a2:	77 05                	ja     8010a9 <strtol+0x9f>
+            dig -= 'a' - 10;
+  8010a4:	83 e9 57             	sub    $0x57,%ecx
+  8010a7:	eb d6                	jmp    80107f <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  8010a9:	4d 85 d2             	test   %r10,%r10
+  8010ac:	74 03                	je     8010b1 <strtol+0xa7>
+  8010ae:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  8010b1:	48 89 c2             	mov    %rax,%rdx
+  8010b4:	48 f7 da             	neg    %rdx
+  8010b7:	40 80 fe 2d          	cmp    $0x2d,%sil
+  8010bb:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  8010bf:	c3                   	ret
+
+00000000008010c0 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  8010c0:	55                   	push   %rbp
+  8010c1:	48 89 e5             	mov    %rsp,%rbp
+  8010c4:	53                   	push   %rbx
+  8010c5:	48 89 fa             	mov    %rdi,%rdx
+  8010c8:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8010cb:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8010d0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010d5:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8010da:	be 00 00 00 00       	mov    $0x0,%esi
+  8010df:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8010e5:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  8010e7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8010eb:	c9                   	leave
+  8010ec:	c3                   	ret
+
+00000000008010ed <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  8010ed:	55                   	push   %rbp
+  8010ee:	48 89 e5             	mov    %rsp,%rbp
+  8010f1:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8010f2:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8010f7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010fc:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801101:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801106:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80110b:	be 00 00 00 00       	mov    $0x0,%esi
+  801110:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801116:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  801118:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80111c:	c9                   	leave
+  80111d:	c3                   	ret
+
+000000000080111e <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  80111e:	55                   	push   %rbp
+  80111f:	48 89 e5             	mov    %rsp,%rbp
+  801122:	53                   	push   %rbx
+  801123:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  801127:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80112a:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80112f:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801134:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801139:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80113e:	be 00 00 00 00       	mov    $0x0,%esi
+  801143:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801149:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80114b:	48 85 c0             	test   %rax,%rax
+  80114e:	7f 06                	jg     801156 <sys_env_destroy+0x38>
+}
+  801150:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801154:	c9                   	leave
+  801155:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801156:	49 89 c0             	mov    %rax,%r8
+  801159:	b9 03 00 00 00       	mov    $0x3,%ecx
+  80115e:	48 ba f0 33 80 00 00 	movabs $0x8033f0,%rdx
+  801165:	00 00 00 
+  801168:	be 26 00 00 00       	mov    $0x26,%esi
+  80116d:	48 bf 0f 34 80 00 00 	movabs $0x80340f,%rdi
+  801174:	00 00 00 
+  801177:	b8 00 00 00 00       	mov    $0x0,%eax
+  80117c:	49 b9 24 02 80 00 00 	movabs $0x800224,%r9
+  801183:	00 00 00 
+  801186:	41 ff d1             	call   *%r9
+
+0000000000801189 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  801189:	55                   	push   %rbp
+  80118a:	48 89 e5             	mov    %rsp,%rbp
+  80118d:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80118e:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801193:	ba 00 00 00 00       	mov    $0x0,%edx
+  801198:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80119d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011a2:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8011a7:	be 00 00 00 00       	mov    $0x0,%esi
+  8011ac:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8011b2:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  8011b4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8011b8:	c9                   	leave
+  8011b9:	c3                   	ret
+
+00000000008011ba <sys_yield>:
+
+void
+sys_yield(void) {
+  8011ba:	55                   	push   %rbp
+  8011bb:	48 89 e5             	mov    %rsp,%rbp
+  8011be:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8011bf:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8011c4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011c9:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8011ce:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011d3:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8011d8:	be 00 00 00 00       	mov    $0x0,%esi
+  8011dd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8011e3:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  8011e5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8011e9:	c9                   	leave
+  8011ea:	c3                   	ret
+
+00000000008011eb <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  8011eb:	55                   	push   %rbp
+  8011ec:	48 89 e5             	mov    %rsp,%rbp
+  8011ef:	53                   	push   %rbx
+  8011f0:	48 89 fa             	mov    %rdi,%rdx
+  8011f3:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8011f6:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8011fb:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  801202:	00 00 00 
+  801205:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80120a:	be 00 00 00 00       	mov    $0x0,%esi
+  80120f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801215:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  801217:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80121b:	c9                   	leave
+  80121c:	c3                   	ret
+
+000000000080121d <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  80121d:	55                   	push   %rbp
+  80121e:	48 89 e5             	mov    %rsp,%rbp
+  801221:	53                   	push   %rbx
+  801222:	49 89 f8             	mov    %rdi,%r8
+  801225:	48 89 d3             	mov    %rdx,%rbx
+  801228:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80122b:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801230:	4c 89 c2             	mov    %r8,%rdx
+  801233:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801236:	be 00 00 00 00       	mov    $0x0,%esi
+  80123b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801241:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  801243:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801247:	c9                   	leave
+  801248:	c3                   	ret
+
+0000000000801249 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  801249:	55                   	push   %rbp
+  80124a:	48 89 e5             	mov    %rsp,%rbp
+  80124d:	53                   	push   %rbx
+  80124e:	48 83 ec 08          	sub    $0x8,%rsp
+  801252:	89 f8                	mov    %edi,%eax
+  801254:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  801257:	48 63 f9             	movslq %ecx,%rdi
+  80125a:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80125d:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801262:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801265:	be 00 00 00 00       	mov    $0x0,%esi
+  80126a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801270:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801272:	48 85 c0             	test   %rax,%rax
+  801275:	7f 06                	jg     80127d <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  801277:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80127b:	c9                   	leave
+  80127c:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80127d:	49 89 c0             	mov    %rax,%r8
+  801280:	b9 04 00 00 00       	mov    $0x4,%ecx
+  801285:	48 ba f0 33 80 00 00 	movabs $0x8033f0,%rdx
+  80128c:	00 00 00 
+  80128f:	be 26 00 00 00       	mov    $0x26,%esi
+  801294:	48 bf 0f 34 80 00 00 	movabs $0x80340f,%rdi
+  80129b:	00 00 00 
+  80129e:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012a3:	49 b9 24 02 80 00 00 	movabs $0x800224,%r9
+  8012aa:	00 00 00 
+  8012ad:	41 ff d1             	call   *%r9
+
+00000000008012b0 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8012b0:	55                   	push   %rbp
+  8012b1:	48 89 e5             	mov    %rsp,%rbp
+  8012b4:	53                   	push   %rbx
+  8012b5:	48 83 ec 08          	sub    $0x8,%rsp
+  8012b9:	89 f8                	mov    %edi,%eax
+  8012bb:	49 89 f2             	mov    %rsi,%r10
+  8012be:	48 89 cf             	mov    %rcx,%rdi
+  8012c1:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  8012c4:	48 63 da             	movslq %edx,%rbx
+  8012c7:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8012ca:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8012cf:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012d2:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  8012d5:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8012d7:	48 85 c0             	test   %rax,%rax
+  8012da:	7f 06                	jg     8012e2 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8012dc:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012e0:	c9                   	leave
+  8012e1:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8012e2:	49 89 c0             	mov    %rax,%r8
+  8012e5:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8012ea:	48 ba f0 33 80 00 00 	movabs $0x8033f0,%rdx
+  8012f1:	00 00 00 
+  8012f4:	be 26 00 00 00       	mov    $0x26,%esi
+  8012f9:	48 bf 0f 34 80 00 00 	movabs $0x80340f,%rdi
+  801300:	00 00 00 
+  801303:	b8 00 00 00 00       	mov    $0x0,%eax
+  801308:	49 b9 24 02 80 00 00 	movabs $0x800224,%r9
+  80130f:	00 00 00 
+  801312:	41 ff d1             	call   *%r9
+
+0000000000801315 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  801315:	55                   	push   %rbp
+  801316:	48 89 e5             	mov    %rsp,%rbp
+  801319:	53                   	push   %rbx
+  80131a:	48 83 ec 08          	sub    $0x8,%rsp
+  80131e:	48 89 f1             	mov    %rsi,%rcx
+  801321:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  801324:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801327:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80132c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801331:	be 00 00 00 00       	mov    $0x0,%esi
+  801336:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80133c:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80133e:	48 85 c0             	test   %rax,%rax
+  801341:	7f 06                	jg     801349 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  801343:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801347:	c9                   	leave
+  801348:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801349:	49 89 c0             	mov    %rax,%r8
+  80134c:	b9 06 00 00 00       	mov    $0x6,%ecx
+  801351:	48 ba f0 33 80 00 00 	movabs $0x8033f0,%rdx
+  801358:	00 00 00 
+  80135b:	be 26 00 00 00       	mov    $0x26,%esi
+  801360:	48 bf 0f 34 80 00 00 	movabs $0x80340f,%rdi
+  801367:	00 00 00 
+  80136a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80136f:	49 b9 24 02 80 00 00 	movabs $0x800224,%r9
+  801376:	00 00 00 
+  801379:	41 ff d1             	call   *%r9
+
+000000000080137c <sys_region_batch>:
+
+int
+sys_region_batch(const struct RegionOp *ops, size_t count) {
+  80137c:	55                   	push   %rbp
+  80137d:	48 89 e5             	mov    %rsp,%rbp
+  801380:	53                   	push   %rbx
+  801381:	48 83 ec 08          	sub    $0x8,%rsp
+  801385:	48 89 fa             	mov    %rdi,%rdx
+  801388:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80138b:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801390:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801395:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80139a:	be 00 00 00 00       	mov    $0x0,%esi
+  80139f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013a5:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8013a7:	48 85 c0             	test   %rax,%rax
+  8013aa:	7f 06                	jg     8013b2 <sys_region_batch+0x36>
+        else
+            platform_asan_unpoison(va, ops[i].size);
+    }
+#endif
+    return res;
+}
+  8013ac:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013b0:	c9                   	leave
+  8013b1:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8013b2:	49 89 c0             	mov    %rax,%r8
+  8013b5:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  8013ba:	48 ba f0 33 80 00 00 	movabs $0x8033f0,%rdx
+  8013c1:	00 00 00 
+  8013c4:	be 26 00 00 00       	mov    $0x26,%esi
+  8013c9:	48 bf 0f 34 80 00 00 	movabs $0x80340f,%rdi
+  8013d0:	00 00 00 
+  8013d3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013d8:	49 b9 24 02 80 00 00 	movabs $0x800224,%r9
+  8013df:	00 00 00 
+  8013e2:	41 ff d1             	call   *%r9
+
+00000000008013e5 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  8013e5:	55                   	push   %rbp
+  8013e6:	48 89 e5             	mov    %rsp,%rbp
+  8013e9:	53                   	push   %rbx
+  8013ea:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  8013ee:	48 63 ce             	movslq %esi,%rcx
+  8013f1:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8013f4:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8013f9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013fe:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801403:	be 00 00 00 00       	mov    $0x0,%esi
+  801408:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80140e:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801410:	48 85 c0             	test   %rax,%rax
+  801413:	7f 06                	jg     80141b <sys_env_set_status+0x36>
+}
+  801415:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801419:	c9                   	leave
+  80141a:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80141b:	49 89 c0             	mov    %rax,%r8
+  80141e:	b9 09 00 00 00       	mov    $0x9,%ecx
+  801423:	48 ba f0 33 80 00 00 	movabs $0x8033f0,%rdx
+  80142a:	00 00 00 
+  80142d:	be 26 00 00 00       	mov    $0x26,%esi
+  801432:	48 bf 0f 34 80 00 00 	movabs $0x80340f,%rdi
+  801439:	00 00 00 
+  80143c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801441:	49 b9 24 02 80 00 00 	movabs $0x800224,%r9
+  801448:	00 00 00 
+  80144b:	41 ff d1             	call   *%r9
+
+000000000080144e <sys_env_set_weight>:
+
+int
+sys_env_set_weight(envid_t envid, uint32_t weight) {
+  80144e:	55                   	push   %rbp
+  80144f:	48 89 e5             	mov    %rsp,%rbp
+  801452:	53                   	push   %rbx
+  801453:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_weight, 1, envid, weight, 0, 0, 0, 0);
+  801457:	89 f1                	mov    %esi,%ecx
+  801459:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80145c:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801461:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801466:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80146b:	be 00 00 00 00       	mov    $0x0,%esi
+  801470:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801476:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801478:	48 85 c0             	test   %rax,%rax
+  80147b:	7f 06                	jg     801483 <sys_env_set_weight+0x35>
+}
+  80147d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801481:	c9                   	leave
+  801482:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801483:	49 89 c0             	mov    %rax,%r8
+  801486:	b9 10 00 00 00       	mov    $0x10,%ecx
+  80148b:	48 ba f0 33 80 00 00 	movabs $0x8033f0,%rdx
+  801492:	00 00 00 
+  801495:	be 26 00 00 00       	mov    $0x26,%esi
+  80149a:	48 bf 0f 34 80 00 00 	movabs $0x80340f,%rdi
+  8014a1:	00 00 00 
+  8014a4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014a9:	49 b9 24 02 80 00 00 	movabs $0x800224,%r9
+  8014b0:	00 00 00 
+  8014b3:	41 ff d1             	call   *%r9
+
+00000000008014b6 <sys_env_set_rt>:
+
+int
+sys_env_set_rt(envid_t envid, uint64_t period, uint64_t budget, uint64_t deadline) {
+  8014b6:	55                   	push   %rbp
+  8014b7:	48 89 e5             	mov    %rsp,%rbp
+  8014ba:	53                   	push   %rbx
+  8014bb:	48 83 ec 08          	sub    $0x8,%rsp
+  8014bf:	89 f8                	mov    %edi,%eax
+  8014c1:	48 89 d3             	mov    %rdx,%rbx
+  8014c4:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_env_set_rt, 1, envid, period, budget, deadline, 0, 0);
+  8014c7:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8014ca:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8014cf:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014d2:	be 00 00 00 00       	mov    $0x0,%esi
+  8014d7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014dd:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8014df:	48 85 c0             	test   %rax,%rax
+  8014e2:	7f 06                	jg     8014ea <sys_env_set_rt+0x34>
+}
+  8014e4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014e8:	c9                   	leave
+  8014e9:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8014ea:	49 89 c0             	mov    %rax,%r8
+  8014ed:	b9 11 00 00 00       	mov    $0x11,%ecx
+  8014f2:	48 ba f0 33 80 00 00 	movabs $0x8033f0,%rdx
+  8014f9:	00 00 00 
+  8014fc:	be 26 00 00 00       	mov    $0x26,%esi
+  801501:	48 bf 0f 34 80 00 00 	movabs $0x80340f,%rdi
+  801508:	00 00 00 
+  80150b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801510:	49 b9 24 02 80 00 00 	movabs $0x800224,%r9
+  801517:	00 00 00 
+  80151a:	41 ff d1             	call   *%r9
+
+000000000080151d <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  80151d:	55                   	push   %rbp
+  80151e:	48 89 e5             	mov    %rsp,%rbp
+  801521:	53                   	push   %rbx
+  801522:	48 83 ec 08          	sub    $0x8,%rsp
+  801526:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  801529:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80152c:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801531:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801536:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80153b:	be 00 00 00 00       	mov    $0x0,%esi
+  801540:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801546:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801548:	48 85 c0             	test   %rax,%rax
+  80154b:	7f 06                	jg     801553 <sys_env_set_trapframe+0x36>
+}
+  80154d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801551:	c9                   	leave
+  801552:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801553:	49 89 c0             	mov    %rax,%r8
+  801556:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  80155b:	48 ba f0 33 80 00 00 	movabs $0x8033f0,%rdx
+  801562:	00 00 00 
+  801565:	be 26 00 00 00       	mov    $0x26,%esi
+  80156a:	48 bf 0f 34 80 00 00 	movabs $0x80340f,%rdi
+  801571:	00 00 00 
+  801574:	b8 00 00 00 00       	mov    $0x0,%eax
+  801579:	49 b9 24 02 80 00 00 	movabs $0x800224,%r9
+  801580:	00 00 00 
+  801583:	41 ff d1             	call   *%r9
+
+0000000000801586 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  801586:	55                   	push   %rbp
+  801587:	48 89 e5             	mov    %rsp,%rbp
+  80158a:	53                   	push   %rbx
+  80158b:	48 83 ec 08          	sub    $0x8,%rsp
+  80158f:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  801592:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801595:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80159a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80159f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015a4:	be 00 00 00 00       	mov    $0x0,%esi
+  8015a9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015af:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8015b1:	48 85 c0             	test   %rax,%rax
+  8015b4:	7f 06                	jg     8015bc <sys_env_set_pgfault_upcall+0x36>
+}
+  8015b6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015ba:	c9                   	leave
+  8015bb:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8015bc:	49 89 c0             	mov    %rax,%r8
+  8015bf:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  8015c4:	48 ba f0 33 80 00 00 	movabs $0x8033f0,%rdx
+  8015cb:	00 00 00 
+  8015ce:	be 26 00 00 00       	mov    $0x26,%esi
+  8015d3:	48 bf 0f 34 80 00 00 	movabs $0x80340f,%rdi
+  8015da:	00 00 00 
+  8015dd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015e2:	49 b9 24 02 80 00 00 	movabs $0x800224,%r9
+  8015e9:	00 00 00 
+  8015ec:	41 ff d1             	call   *%r9
+
+00000000008015ef <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  8015ef:	55                   	push   %rbp
+  8015f0:	48 89 e5             	mov    %rsp,%rbp
+  8015f3:	53                   	push   %rbx
+  8015f4:	89 f8                	mov    %edi,%eax
+  8015f6:	49 89 f1             	mov    %rsi,%r9
+  8015f9:	48 89 d3             	mov    %rdx,%rbx
+  8015fc:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  8015ff:	49 63 f0             	movslq %r8d,%rsi
+  801602:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801605:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80160a:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80160d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801613:	cd 30                	int    $0x30
+}
+  801615:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801619:	c9                   	leave
+  80161a:	c3                   	ret
+
+000000000080161b <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  80161b:	55                   	push   %rbp
+  80161c:	48 89 e5             	mov    %rsp,%rbp
+  80161f:	53                   	push   %rbx
+  801620:	48 83 ec 08          	sub    $0x8,%rsp
+  801624:	48 89 fa             	mov    %rdi,%rdx
+  801627:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80162a:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80162f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801634:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801639:	be 00 00 00 00       	mov    $0x0,%esi
+  80163e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801644:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801646:	48 85 c0             	test   %rax,%rax
+  801649:	7f 06                	jg     801651 <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  80164b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80164f:	c9                   	leave
+  801650:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801651:	49 89 c0             	mov    %rax,%r8
+  801654:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  801659:	48 ba f0 33 80 00 00 	movabs $0x8033f0,%rdx
+  801660:	00 00 00 
+  801663:	be 26 00 00 00       	mov    $0x26,%esi
+  801668:	48 bf 0f 34 80 00 00 	movabs $0x80340f,%rdi
+  80166f:	00 00 00 
+  801672:	b8 00 00 00 00       	mov    $0x0,%eax
+  801677:	49 b9 24 02 80 00 00 	movabs $0x800224,%r9
+  80167e:	00 00 00 
+  801681:	41 ff d1             	call   *%r9
+
+0000000000801684 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801684:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  80168b:	ff ff ff 
+  80168e:	48 01 f8             	add    %rdi,%rax
+  801691:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  801695:	c3                   	ret
+
+0000000000801696 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801696:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  80169d:	ff ff ff 
+  8016a0:	48 01 f8             	add    %rdi,%rax
+  8016a3:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  8016a7:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  8016ad:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  8016b1:	c3                   	ret
+
+00000000008016b2 <fd_alloc_from>:
+}
+
+/* Like fd_alloc(), but only considers fds starting from fdnum,
+ * so that several fds can be found before their pages are allocated */
+int
+fd_alloc_from(int fdnum, struct Fd **fd_store) {
+  8016b2:	55                   	push   %rbp
+  8016b3:	48 89 e5             	mov    %rsp,%rbp
+  8016b6:	41 57                	push   %r15
+  8016b8:	41 56                	push   %r14
+  8016ba:	41 55                	push   %r13
+  8016bc:	41 54                	push   %r12
+  8016be:	53                   	push   %rbx
+  8016bf:	48 83 ec 08          	sub    $0x8,%rsp
+  8016c3:	49 89 f7             	mov    %rsi,%r15
+    for (int i = MAX(fdnum, 0); i < MAXFD; i++) {
+  8016c6:	85 ff                	test   %edi,%edi
+  8016c8:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8016ce:	44 0f 49 e7          	cmovns %edi,%r12d
+  8016d2:	83 ff 1f             	cmp    $0x1f,%edi
+  8016d5:	7f 37                	jg     80170e <fd_alloc_from+0x5c>
+  8016d7:	49 63 dc             	movslq %r12d,%rbx
+  8016da:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  8016e1:	48 c1 e3 0c          	shl    $0xc,%rbx
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  8016e5:	49 be bb 27 80 00 00 	movabs $0x8027bb,%r14
+  8016ec:	00 00 00 
+        struct Fd *fd = INDEX2FD(i);
+  8016ef:	49 89 dd             	mov    %rbx,%r13
+        if (!(get_prot(fd) & PROT_R)) {
+  8016f2:	48 89 df             	mov    %rbx,%rdi
+  8016f5:	41 ff d6             	call   *%r14
+  8016f8:	83 e0 04             	and    $0x4,%eax
+  8016fb:	74 1c                	je     801719 <fd_alloc_from+0x67>
+    for (int i = MAX(fdnum, 0); i < MAXFD; i++) {
+  8016fd:	41 83 c4 01          	add    $0x1,%r12d
+  801701:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801708:	41 83 fc 1f          	cmp    $0x1f,%r12d
+  80170c:	7e e1                	jle    8016ef <fd_alloc_from+0x3d>
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  80170e:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801714:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  801719:	4d 89 2f             	mov    %r13,(%r15)
+}
+  80171c:	48 83 c4 08          	add    $0x8,%rsp
+  801720:	5b                   	pop    %rbx
+  801721:	41 5c                	pop    %r12
+  801723:	41 5d                	pop    %r13
+  801725:	41 5e                	pop    %r14
+  801727:	41 5f                	pop    %r15
+  801729:	5d                   	pop    %rbp
+  80172a:	c3                   	ret
+
+000000000080172b <fd_alloc>:
+fd_alloc(struct Fd **fd_store) {
+  80172b:	55                   	push   %rbp
+  80172c:	48 89 e5             	mov    %rsp,%rbp
+  80172f:	48 89 fe             	mov    %rdi,%rsi
+    return fd_alloc_from(0, fd_store);
+  801732:	bf 00 00 00 00       	mov    $0x0,%edi
+  801737:	48 b8 b2 16 80 00 00 	movabs $0x8016b2,%rax
+  80173e:	00 00 00 
+  801741:	ff d0                	call   *%rax
+}
+  801743:	5d                   	pop    %rbp
+  801744:	c3                   	ret
+
+0000000000801745 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  801745:	83 ff 1f             	cmp    $0x1f,%edi
+  801748:	77 39                	ja     801783 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  80174a:	55                   	push   %rbp
+  80174b:	48 89 e5             	mov    %rsp,%rbp
+  80174e:	41 54                	push   %r12
+  801750:	53                   	push   %rbx
+  801751:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  801754:	48 63 df             	movslq %edi,%rbx
+  801757:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  80175e:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  801762:	48 89 df             	mov    %rbx,%rdi
+  801765:	48 b8 bb 27 80 00 00 	movabs $0x8027bb,%rax
+  80176c:	00 00 00 
+  80176f:	ff d0                	call   *%rax
+  801771:	a8 04                	test   $0x4,%al
+  801773:	74 14                	je     801789 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  801775:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  801779:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80177e:	5b                   	pop    %rbx
+  80177f:	41 5c                	pop    %r12
+  801781:	5d                   	pop    %rbp
+  801782:	c3                   	ret
+        return -E_INVAL;
+  801783:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801788:	c3                   	ret
+        return -E_INVAL;
+  801789:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80178e:	eb ee                	jmp    80177e <fd_lookup+0x39>
+
+0000000000801790 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  801790:	55                   	push   %rbp
+  801791:	48 89 e5             	mov    %rsp,%rbp
+  801794:	41 54                	push   %r12
+  801796:	53                   	push   %rbx
+  801797:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  80179a:	48 b8 a0 34 80 00 00 	movabs $0x8034a0,%rax
+  8017a1:	00 00 00 
+  8017a4:	48 bb 20 40 80 00 00 	movabs $0x804020,%rbx
+  8017ab:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  8017ae:	39 3b                	cmp    %edi,(%rbx)
+  8017b0:	74 47                	je     8017f9 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  8017b2:	48 83 c0 08          	add    $0x8,%rax
+  8017b6:	48 8b 18             	mov    (%rax),%rbx
+  8017b9:	48 85 db             	test   %rbx,%rbx
+  8017bc:	75 f0                	jne    8017ae <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8017be:	48 a1 00 50 c0 00 00 	movabs 0xc05000,%rax
+  8017c5:	00 00 00 
+  8017c8:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+  8017ce:	89 fa                	mov    %edi,%edx
+  8017d0:	48 bf 20 34 80 00 00 	movabs $0x803420,%rdi
+  8017d7:	00 00 00 
+  8017da:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017df:	48 b9 74 03 80 00 00 	movabs $0x800374,%rcx
+  8017e6:	00 00 00 
+  8017e9:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  8017eb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  8017f0:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  8017f4:	5b                   	pop    %rbx
+  8017f5:	41 5c                	pop    %r12
+  8017f7:	5d                   	pop    %rbp
+  8017f8:	c3                   	ret
+            return 0;
+  8017f9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017fe:	eb f0                	jmp    8017f0 <dev_lookup+0x60>
+
+0000000000801800 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  801800:	55                   	push   %rbp
+  801801:	48 89 e5             	mov    %rsp,%rbp
+  801804:	41 55                	push   %r13
+  801806:	41 54                	push   %r12
+  801808:	53                   	push   %rbx
+  801809:	48 83 ec 18          	sub    $0x18,%rsp
+  80180d:	48 89 fb             	mov    %rdi,%rbx
+  801810:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801813:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  80181a:	ff ff ff 
+  80181d:	48 01 df             	add    %rbx,%rdi
+  801820:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  801824:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801828:	48 b8 45 17 80 00 00 	movabs $0x801745,%rax
+  80182f:	00 00 00 
+  801832:	ff d0                	call   *%rax
+  801834:	41 89 c5             	mov    %eax,%r13d
+  801837:	85 c0                	test   %eax,%eax
+  801839:	78 06                	js     801841 <fd_close+0x41>
+  80183b:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  80183f:	74 1a                	je     80185b <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  801841:	45 84 e4             	test   %r12b,%r12b
+  801844:	b8 00 00 00 00       	mov    $0x0,%eax
+  801849:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  80184d:	44 89 e8             	mov    %r13d,%eax
+  801850:	48 83 c4 18          	add    $0x18,%rsp
+  801854:	5b                   	pop    %rbx
+  801855:	41 5c                	pop    %r12
+  801857:	41 5d                	pop    %r13
+  801859:	5d                   	pop    %rbp
+  80185a:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  80185b:	8b 3b                	mov    (%rbx),%edi
+  80185d:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801861:	48 b8 90 17 80 00 00 	movabs $0x801790,%rax
+  801868:	00 00 00 
+  80186b:	ff d0                	call   *%rax
+  80186d:	41 89 c5             	mov    %eax,%r13d
+  801870:	85 c0                	test   %eax,%eax
+  801872:	78 1b                	js     80188f <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  801874:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801878:	48 8b 40 20          	mov    0x20(%rax),%rax
+  80187c:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801882:	48 85 c0             	test   %rax,%rax
+  801885:	74 08                	je     80188f <fd_close+0x8f>
+  801887:	48 89 df             	mov    %rbx,%rdi
+  80188a:	ff d0                	call   *%rax
+  80188c:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  80188f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801894:	48 89 de             	mov    %rbx,%rsi
+  801897:	bf 00 00 00 00       	mov    $0x0,%edi
+  80189c:	48 b8 15 13 80 00 00 	movabs $0x801315,%rax
+  8018a3:	00 00 00 
+  8018a6:	ff d0                	call   *%rax
+    return res;
+  8018a8:	eb a3                	jmp    80184d <fd_close+0x4d>
+
+00000000008018aa <close>:
+
+int
+close(int fdnum) {
+  8018aa:	55                   	push   %rbp
+  8018ab:	48 89 e5             	mov    %rsp,%rbp
+  8018ae:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  8018b2:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8018b6:	48 b8 45 17 80 00 00 	movabs $0x801745,%rax
+  8018bd:	00 00 00 
+  8018c0:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8018c2:	85 c0                	test   %eax,%eax
+  8018c4:	78 15                	js     8018db <close+0x31>
+
+    return fd_close(fd, 1);
+  8018c6:	be 01 00 00 00       	mov    $0x1,%esi
+  8018cb:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8018cf:	48 b8 00 18 80 00 00 	movabs $0x801800,%rax
+  8018d6:	00 00 00 
+  8018d9:	ff d0                	call   *%rax
+}
+  8018db:	c9                   	leave
+  8018dc:	c3                   	ret
+
+00000000008018dd <close_all>:
+
+void
+close_all(void) {
+  8018dd:	55                   	push   %rbp
+  8018de:	48 89 e5             	mov    %rsp,%rbp
+  8018e1:	41 54                	push   %r12
+  8018e3:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  8018e4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8018e9:	49 bc aa 18 80 00 00 	movabs $0x8018aa,%r12
+  8018f0:	00 00 00 
+  8018f3:	89 df                	mov    %ebx,%edi
+  8018f5:	41 ff d4             	call   *%r12
+  8018f8:	83 c3 01             	add    $0x1,%ebx
+  8018fb:	83 fb 20             	cmp    $0x20,%ebx
+  8018fe:	75 f3                	jne    8018f3 <close_all+0x16>
+}
+  801900:	5b                   	pop    %rbx
+  801901:	41 5c                	pop    %r12
+  801903:	5d                   	pop    %rbp
+  801904:	c3                   	ret
+
+0000000000801905 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  801905:	55                   	push   %rbp
+  801906:	48 89 e5             	mov    %rsp,%rbp
+  801909:	41 57                	push   %r15
+  80190b:	41 56                	push   %r14
+  80190d:	41 55                	push   %r13
+  80190f:	41 54                	push   %r12
+  801911:	53                   	push   %rbx
+  801912:	48 83 ec 18          	sub    $0x18,%rsp
+  801916:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  801919:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  80191d:	48 b8 45 17 80 00 00 	movabs $0x801745,%rax
+  801924:	00 00 00 
+  801927:	ff d0                	call   *%rax
+  801929:	89 c3                	mov    %eax,%ebx
+  80192b:	85 c0                	test   %eax,%eax
+  80192d:	0f 88 b8 00 00 00    	js     8019eb <dup+0xe6>
+    close(newfdnum);
+  801933:	44 89 e7             	mov    %r12d,%edi
+  801936:	48 b8 aa 18 80 00 00 	movabs $0x8018aa,%rax
+  80193d:	00 00 00 
+  801940:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  801942:	4d 63 ec             	movslq %r12d,%r13
+  801945:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  80194c:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  801950:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  801954:	4c 89 ff             	mov    %r15,%rdi
+  801957:	49 be 96 16 80 00 00 	movabs $0x801696,%r14
+  80195e:	00 00 00 
+  801961:	41 ff d6             	call   *%r14
+  801964:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  801967:	4c 89 ef             	mov    %r13,%rdi
+  80196a:	41 ff d6             	call   *%r14
+  80196d:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  801970:	48 89 df             	mov    %rbx,%rdi
+  801973:	48 b8 bb 27 80 00 00 	movabs $0x8027bb,%rax
+  80197a:	00 00 00 
+  80197d:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  80197f:	a8 04                	test   $0x4,%al
+  801981:	74 2b                	je     8019ae <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  801983:	41 89 c1             	mov    %eax,%r9d
+  801986:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  80198c:	4c 89 f1             	mov    %r14,%rcx
+  80198f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801994:	48 89 de             	mov    %rbx,%rsi
+  801997:	bf 00 00 00 00       	mov    $0x0,%edi
+  80199c:	48 b8 b0 12 80 00 00 	movabs $0x8012b0,%rax
+  8019a3:	00 00 00 
+  8019a6:	ff d0                	call   *%rax
+  8019a8:	89 c3                	mov    %eax,%ebx
+  8019aa:	85 c0                	test   %eax,%eax
+  8019ac:	78 4e                	js     8019fc <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  8019ae:	4c 89 ff             	mov    %r15,%rdi
+  8019b1:	48 b8 bb 27 80 00 00 	movabs $0x8027bb,%rax
+  8019b8:	00 00 00 
+  8019bb:	ff d0                	call   *%rax
+  8019bd:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  8019c0:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8019c6:	4c 89 e9             	mov    %r13,%rcx
+  8019c9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8019ce:	4c 89 fe             	mov    %r15,%rsi
+  8019d1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8019d6:	48 b8 b0 12 80 00 00 	movabs $0x8012b0,%rax
+  8019dd:	00 00 00 
+  8019e0:	ff d0                	call   *%rax
+  8019e2:	89 c3                	mov    %eax,%ebx
+  8019e4:	85 c0                	test   %eax,%eax
+  8019e6:	78 14                	js     8019fc <dup+0xf7>
+
+    return newfdnum;
+  8019e8:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  8019eb:	89 d8                	mov    %ebx,%eax
+  8019ed:	48 83 c4 18          	add    $0x18,%rsp
+  8019f1:	5b                   	pop    %rbx
+  8019f2:	41 5c                	pop    %r12
+  8019f4:	41 5d                	pop    %r13
+  8019f6:	41 5e                	pop    %r14
+  8019f8:	41 5f                	pop    %r15
+  8019fa:	5d                   	pop    %rbp
+  8019fb:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  8019fc:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801a01:	4c 89 ee             	mov    %r13,%rsi
+  801a04:	bf 00 00 00 00       	mov    $0x0,%edi
+  801a09:	49 bc 15 13 80 00 00 	movabs $0x801315,%r12
+  801a10:	00 00 00 
+  801a13:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  801a16:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801a1b:	4c 89 f6             	mov    %r14,%rsi
+  801a1e:	bf 00 00 00 00       	mov    $0x0,%edi
+  801a23:	41 ff d4             	call   *%r12
+    return res;
+  801a26:	eb c3                	jmp    8019eb <dup+0xe6>
+
+0000000000801a28 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  801a28:	55                   	push   %rbp
+  801a29:	48 89 e5             	mov    %rsp,%rbp
+  801a2c:	41 56                	push   %r14
+  801a2e:	41 55                	push   %r13
+  801a30:	41 54                	push   %r12
+  801a32:	53                   	push   %rbx
+  801a33:	48 83 ec 10          	sub    $0x10,%rsp
+  801a37:	89 fb                	mov    %edi,%ebx
+  801a39:	49 89 f4             	mov    %rsi,%r12
+  801a3c:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801a3f:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801a43:	48 b8 45 17 80 00 00 	movabs $0x801745,%rax
+  801a4a:	00 00 00 
+  801a4d:	ff d0                	call   *%rax
+  801a4f:	85 c0                	test   %eax,%eax
+  801a51:	78 4c                	js     801a9f <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801a53:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801a57:	41 8b 3e             	mov    (%r14),%edi
+  801a5a:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801a5e:	48 b8 90 17 80 00 00 	movabs $0x801790,%rax
+  801a65:	00 00 00 
+  801a68:	ff d0                	call   *%rax
+  801a6a:	85 c0                	test   %eax,%eax
+  801a6c:	78 35                	js     801aa3 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801a6e:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801a72:	83 e0 03             	and    $0x3,%eax
+  801a75:	83 f8 01             	cmp    $0x1,%eax
+  801a78:	74 2d                	je     801aa7 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801a7a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801a7e:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801a82:	48 85 c0             	test   %rax,%rax
+  801a85:	74 56                	je     801add <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  801a87:	4c 89 ea             	mov    %r13,%rdx
+  801a8a:	4c 89 e6             	mov    %r12,%rsi
+  801a8d:	4c 89 f7             	mov    %r14,%rdi
+  801a90:	ff d0                	call   *%rax
+}
+  801a92:	48 83 c4 10          	add    $0x10,%rsp
+  801a96:	5b                   	pop    %rbx
+  801a97:	41 5c                	pop    %r12
+  801a99:	41 5d                	pop    %r13
+  801a9b:	41 5e                	pop    %r14
+  801a9d:	5d                   	pop    %rbp
+  801a9e:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801a9f:	48 98                	cltq
+  801aa1:	eb ef                	jmp    801a92 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801aa3:	48 98                	cltq
+  801aa5:	eb eb                	jmp    801a92 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801aa7:	48 a1 00 50 c0 00 00 	movabs 0xc05000,%rax
+  801aae:	00 00 00 
+  801ab1:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+  801ab7:	89 da                	mov    %ebx,%edx
+  801ab9:	48 bf 61 34 80 00 00 	movabs $0x803461,%rdi
+  801ac0:	00 00 00 
+  801ac3:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ac8:	48 b9 74 03 80 00 00 	movabs $0x800374,%rcx
+  801acf:	00 00 00 
+  801ad2:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801ad4:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801adb:	eb b5                	jmp    801a92 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801add:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801ae4:	eb ac                	jmp    801a92 <read+0x6a>
+
+0000000000801ae6 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801ae6:	55                   	push   %rbp
+  801ae7:	48 89 e5             	mov    %rsp,%rbp
+  801aea:	41 57                	push   %r15
+  801aec:	41 56                	push   %r14
+  801aee:	41 55                	push   %r13
+  801af0:	41 54                	push   %r12
+  801af2:	53                   	push   %rbx
+  801af3:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  801af7:	48 85 d2             	test   %rdx,%rdx
+  801afa:	74 54                	je     801b50 <readn+0x6a>
+  801afc:	41 89 fd             	mov    %edi,%r13d
+  801aff:	49 89 f6             	mov    %rsi,%r14
+  801b02:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  801b05:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  801b0a:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  801b0f:	49 bf 28 1a 80 00 00 	movabs $0x801a28,%r15
+  801b16:	00 00 00 
+  801b19:	4c 89 e2             	mov    %r12,%rdx
+  801b1c:	48 29 f2             	sub    %rsi,%rdx
+  801b1f:	4c 01 f6             	add    %r14,%rsi
+  801b22:	44 89 ef             	mov    %r13d,%edi
+  801b25:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  801b28:	85 c0                	test   %eax,%eax
+  801b2a:	78 20                	js     801b4c <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  801b2c:	01 c3                	add    %eax,%ebx
+  801b2e:	85 c0                	test   %eax,%eax
+  801b30:	74 08                	je     801b3a <readn+0x54>
+  801b32:	48 63 f3             	movslq %ebx,%rsi
+  801b35:	4c 39 e6             	cmp    %r12,%rsi
+  801b38:	72 df                	jb     801b19 <readn+0x33>
+    }
+    return res;
+  801b3a:	48 63 c3             	movslq %ebx,%rax
+}
+  801b3d:	48 83 c4 08          	add    $0x8,%rsp
+  801b41:	5b                   	pop    %rbx
+  801b42:	41 5c                	pop    %r12
+  801b44:	41 5d                	pop    %r13
+  801b46:	41 5e                	pop    %r14
+  801b48:	41 5f                	pop    %r15
+  801b4a:	5d                   	pop    %rbp
+  801b4b:	c3                   	ret
+        if (inc < 0) return inc;
+  801b4c:	48 98                	cltq
+  801b4e:	eb ed                	jmp    801b3d <readn+0x57>
+    int inc = 1, res = 0;
+  801b50:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b55:	eb e3                	jmp    801b3a <readn+0x54>
+
+0000000000801b57 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  801b57:	55                   	push   %rbp
+  801b58:	48 89 e5             	mov    %rsp,%rbp
+  801b5b:	41 56                	push   %r14
+  801b5d:	41 55                	push   %r13
+  801b5f:	41 54                	push   %r12
+  801b61:	53                   	push   %rbx
+  801b62:	48 83 ec 10          	sub    $0x10,%rsp
+  801b66:	89 fb                	mov    %edi,%ebx
+  801b68:	49 89 f4             	mov    %rsi,%r12
+  801b6b:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801b6e:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801b72:	48 b8 45 17 80 00 00 	movabs $0x801745,%rax
+  801b79:	00 00 00 
+  801b7c:	ff d0                	call   *%rax
+  801b7e:	85 c0                	test   %eax,%eax
+  801b80:	78 47                	js     801bc9 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801b82:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801b86:	41 8b 3e             	mov    (%r14),%edi
+  801b89:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801b8d:	48 b8 90 17 80 00 00 	movabs $0x801790,%rax
+  801b94:	00 00 00 
+  801b97:	ff d0                	call   *%rax
+  801b99:	85 c0                	test   %eax,%eax
+  801b9b:	78 30                	js     801bcd <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801b9d:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  801ba2:	74 2d                	je     801bd1 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801ba4:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801ba8:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801bac:	48 85 c0             	test   %rax,%rax
+  801baf:	74 56                	je     801c07 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  801bb1:	4c 89 ea             	mov    %r13,%rdx
+  801bb4:	4c 89 e6             	mov    %r12,%rsi
+  801bb7:	4c 89 f7             	mov    %r14,%rdi
+  801bba:	ff d0                	call   *%rax
+}
+  801bbc:	48 83 c4 10          	add    $0x10,%rsp
+  801bc0:	5b                   	pop    %rbx
+  801bc1:	41 5c                	pop    %r12
+  801bc3:	41 5d                	pop    %r13
+  801bc5:	41 5e                	pop    %r14
+  801bc7:	5d                   	pop    %rbp
+  801bc8:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801bc9:	48 98                	cltq
+  801bcb:	eb ef                	jmp    801bbc <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801bcd:	48 98                	cltq
+  801bcf:	eb eb                	jmp    801bbc <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801bd1:	48 a1 00 50 c0 00 00 	movabs 0xc05000,%rax
+  801bd8:	00 00 00 
+  801bdb:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+  801be1:	89 da                	mov    %ebx,%edx
+  801be3:	48 bf 7d 34 80 00 00 	movabs $0x80347d,%rdi
+  801bea:	00 00 00 
+  801bed:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bf2:	48 b9 74 03 80 00 00 	movabs $0x800374,%rcx
+  801bf9:	00 00 00 
+  801bfc:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801bfe:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801c05:	eb b5                	jmp    801bbc <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801c07:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801c0e:	eb ac                	jmp    801bbc <write+0x65>
+
+0000000000801c10 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  801c10:	55                   	push   %rbp
+  801c11:	48 89 e5             	mov    %rsp,%rbp
+  801c14:	53                   	push   %rbx
+  801c15:	48 83 ec 18          	sub    $0x18,%rsp
+  801c19:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801c1b:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801c1f:	48 b8 45 17 80 00 00 	movabs $0x801745,%rax
+  801c26:	00 00 00 
+  801c29:	ff d0                	call   *%rax
+  801c2b:	85 c0                	test   %eax,%eax
+  801c2d:	78 0c                	js     801c3b <seek+0x2b>
+
+    fd->fd_offset = offset;
+  801c2f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801c33:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  801c36:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801c3b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801c3f:	c9                   	leave
+  801c40:	c3                   	ret
+
+0000000000801c41 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  801c41:	55                   	push   %rbp
+  801c42:	48 89 e5             	mov    %rsp,%rbp
+  801c45:	41 55                	push   %r13
+  801c47:	41 54                	push   %r12
+  801c49:	53                   	push   %rbx
+  801c4a:	48 83 ec 18          	sub    $0x18,%rsp
+  801c4e:	89 fb                	mov    %edi,%ebx
+  801c50:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801c53:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801c57:	48 b8 45 17 80 00 00 	movabs $0x801745,%rax
+  801c5e:	00 00 00 
+  801c61:	ff d0                	call   *%rax
+  801c63:	85 c0                	test   %eax,%eax
+  801c65:	78 38                	js     801c9f <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801c67:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  801c6b:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  801c6f:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801c73:	48 b8 90 17 80 00 00 	movabs $0x801790,%rax
+  801c7a:	00 00 00 
+  801c7d:	ff d0                	call   *%rax
+  801c7f:	85 c0                	test   %eax,%eax
+  801c81:	78 1c                	js     801c9f <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801c83:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  801c88:	74 20                	je     801caa <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801c8a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801c8e:	48 8b 40 30          	mov    0x30(%rax),%rax
+  801c92:	48 85 c0             	test   %rax,%rax
+  801c95:	74 47                	je     801cde <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  801c97:	44 89 e6             	mov    %r12d,%esi
+  801c9a:	4c 89 ef             	mov    %r13,%rdi
+  801c9d:	ff d0                	call   *%rax
+}
+  801c9f:	48 83 c4 18          	add    $0x18,%rsp
+  801ca3:	5b                   	pop    %rbx
+  801ca4:	41 5c                	pop    %r12
+  801ca6:	41 5d                	pop    %r13
+  801ca8:	5d                   	pop    %rbp
+  801ca9:	c3                   	ret
+                thisenv->env_id, fdnum);
+  801caa:	48 a1 00 50 c0 00 00 	movabs 0xc05000,%rax
+  801cb1:	00 00 00 
+  801cb4:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801cba:	89 da                	mov    %ebx,%edx
+  801cbc:	48 bf 40 34 80 00 00 	movabs $0x803440,%rdi
+  801cc3:	00 00 00 
+  801cc6:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ccb:	48 b9 74 03 80 00 00 	movabs $0x800374,%rcx
+  801cd2:	00 00 00 
+  801cd5:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801cd7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801cdc:	eb c1                	jmp    801c9f <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801cde:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801ce3:	eb ba                	jmp    801c9f <ftruncate+0x5e>
+
+0000000000801ce5 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  801ce5:	55                   	push   %rbp
+  801ce6:	48 89 e5             	mov    %rsp,%rbp
+  801ce9:	41 54                	push   %r12
+  801ceb:	53                   	push   %rbx
+  801cec:	48 83 ec 10          	sub    $0x10,%rsp
+  801cf0:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801cf3:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801cf7:	48 b8 45 17 80 00 00 	movabs $0x801745,%rax
+  801cfe:	00 00 00 
+  801d01:	ff d0                	call   *%rax
+  801d03:	85 c0                	test   %eax,%eax
+  801d05:	78 4e                	js     801d55 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801d07:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801d0b:	41 8b 3c 24          	mov    (%r12),%edi
+  801d0f:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801d13:	48 b8 90 17 80 00 00 	movabs $0x801790,%rax
+  801d1a:	00 00 00 
+  801d1d:	ff d0                	call   *%rax
+  801d1f:	85 c0                	test   %eax,%eax
+  801d21:	78 32                	js     801d55 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801d23:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801d27:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  801d2c:	74 30                	je     801d5e <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  801d2e:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  801d31:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  801d38:	00 00 00 
+    stat->st_isdir = 0;
+  801d3b:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  801d42:	00 00 00 
+    stat->st_dev = dev;
+  801d45:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  801d4c:	48 89 de             	mov    %rbx,%rsi
+  801d4f:	4c 89 e7             	mov    %r12,%rdi
+  801d52:	ff 50 28             	call   *0x28(%rax)
+}
+  801d55:	48 83 c4 10          	add    $0x10,%rsp
+  801d59:	5b                   	pop    %rbx
+  801d5a:	41 5c                	pop    %r12
+  801d5c:	5d                   	pop    %rbp
+  801d5d:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801d5e:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801d63:	eb f0                	jmp    801d55 <fstat+0x70>
+
+0000000000801d65 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  801d65:	55                   	push   %rbp
+  801d66:	48 89 e5             	mov    %rsp,%rbp
+  801d69:	41 54                	push   %r12
+  801d6b:	53                   	push   %rbx
+  801d6c:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  801d6f:	be 00 00 00 00       	mov    $0x0,%esi
+  801d74:	48 b8 48 21 80 00 00 	movabs $0x802148,%rax
+  801d7b:	00 00 00 
+  801d7e:	ff d0                	call   *%rax
+  801d80:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  801d82:	85 c0                	test   %eax,%eax
+  801d84:	78 25                	js     801dab <stat+0x46>
+
+    int res = fstat(fd, stat);
+  801d86:	4c 89 e6             	mov    %r12,%rsi
+  801d89:	89 c7                	mov    %eax,%edi
+  801d8b:	48 b8 e5 1c 80 00 00 	movabs $0x801ce5,%rax
+  801d92:	00 00 00 
+  801d95:	ff d0                	call   *%rax
+  801d97:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  801d9a:	89 df                	mov    %ebx,%edi
+  801d9c:	48 b8 aa 18 80 00 00 	movabs $0x8018aa,%rax
+  801da3:	00 00 00 
+  801da6:	ff d0                	call   *%rax
+
+    return res;
+  801da8:	44 89 e3             	mov    %r12d,%ebx
+}
+  801dab:	89 d8                	mov    %ebx,%eax
+  801dad:	5b                   	pop    %rbx
+  801dae:	41 5c                	pop    %r12
+  801db0:	5d                   	pop    %rbp
+  801db1:	c3                   	ret
+
+0000000000801db2 <fsipc>:
+ * response may be written back to fsipcbuf.
+ * type: request code, passed as the simple integer IPC value.
+ * dstva: virtual address at which to receive reply page, 0 if none.
+ * Returns result from the file server. */
+static int
+fsipc(unsigned type, void *dstva) {
+  801db2:	55                   	push   %rbp
+  801db3:	48 89 e5             	mov    %rsp,%rbp
+  801db6:	41 54                	push   %r12
+  801db8:	53                   	push   %rbx
+  801db9:	48 83 ec 10          	sub    $0x10,%rsp
+  801dbd:	41 89 fc             	mov    %edi,%r12d
+  801dc0:	48 89 f3             	mov    %rsi,%rbx
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  801dc3:	48 b8 00 70 c0 00 00 	movabs $0xc07000,%rax
+  801dca:	00 00 00 
+  801dcd:	83 38 00             	cmpl   $0x0,(%rax)
+  801dd0:	74 5e                	je     801e30 <fsipc+0x7e>
+    if (debug) {
+        cprintf("[%08x] fsipc %d %08x\n",
+                thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+    }
+
+    ipc_send(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW);
+  801dd2:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  801dd8:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  801ddd:	48 ba 00 60 c0 00 00 	movabs $0xc06000,%rdx
+  801de4:	00 00 00 
+  801de7:	44 89 e6             	mov    %r12d,%esi
+  801dea:	48 b8 00 70 c0 00 00 	movabs $0xc07000,%rax
+  801df1:	00 00 00 
+  801df4:	8b 38                	mov    (%rax),%edi
+  801df6:	48 b8 af 2c 80 00 00 	movabs $0x802caf,%rax
+  801dfd:	00 00 00 
+  801e00:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  801e02:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  801e09:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  801e0a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801e0f:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  801e13:	48 89 de             	mov    %rbx,%rsi
+  801e16:	bf 00 00 00 00       	mov    $0x0,%edi
+  801e1b:	48 b8 da 2b 80 00 00 	movabs $0x802bda,%rax
+  801e22:	00 00 00 
+  801e25:	ff d0                	call   *%rax
+}
+  801e27:	48 83 c4 10          	add    $0x10,%rsp
+  801e2b:	5b                   	pop    %rbx
+  801e2c:	41 5c                	pop    %r12
+  801e2e:	5d                   	pop    %rbp
+  801e2f:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  801e30:	bf 03 00 00 00       	mov    $0x3,%edi
+  801e35:	48 b8 52 2d 80 00 00 	movabs $0x802d52,%rax
+  801e3c:	00 00 00 
+  801e3f:	ff d0                	call   *%rax
+  801e41:	a3 00 70 c0 00 00 00 	movabs %eax,0xc07000
+  801e48:	00 00 
+  801e4a:	eb 86                	jmp    801dd2 <fsipc+0x20>
+
+0000000000801e4c <devfile_trunc>:
+    return 0;
+}
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  801e4c:	55                   	push   %rbp
+  801e4d:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801e50:	48 b8 00 60 c0 00 00 	movabs $0xc06000,%rax
+  801e57:	00 00 00 
+  801e5a:	8b 57 0c             	mov    0xc(%rdi),%edx
+  801e5d:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  801e5f:	89 70 04             	mov    %esi,0x4(%rax)
+
+    return fsipc(FSREQ_SET_SIZE, NULL);
+  801e62:	be 00 00 00 00       	mov    $0x0,%esi
+  801e67:	bf 02 00 00 00       	mov    $0x2,%edi
+  801e6c:	48 b8 b2 1d 80 00 00 	movabs $0x801db2,%rax
+  801e73:	00 00 00 
+  801e76:	ff d0                	call   *%rax
+}
+  801e78:	5d                   	pop    %rbp
+  801e79:	c3                   	ret
+
+0000000000801e7a <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  801e7a:	55                   	push   %rbp
+  801e7b:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801e7e:	8b 47 0c             	mov    0xc(%rdi),%eax
+  801e81:	a3 00 60 c0 00 00 00 	movabs %eax,0xc06000
+  801e88:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  801e8a:	be 00 00 00 00       	mov    $0x0,%esi
+  801e8f:	bf 06 00 00 00       	mov    $0x6,%edi
+  801e94:	48 b8 b2 1d 80 00 00 	movabs $0x801db2,%rax
+  801e9b:	00 00 00 
+  801e9e:	ff d0                	call   *%rax
+}
+  801ea0:	5d                   	pop    %rbp
+  801ea1:	c3                   	ret
+
+0000000000801ea2 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  801ea2:	55                   	push   %rbp
+  801ea3:	48 89 e5             	mov    %rsp,%rbp
+  801ea6:	41 54                	push   %r12
+  801ea8:	53                   	push   %rbx
+  801ea9:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801eac:	8b 47 0c             	mov    0xc(%rdi),%eax
+  801eaf:	a3 00 60 c0 00 00 00 	movabs %eax,0xc06000
+  801eb6:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  801eb8:	be 00 00 00 00       	mov    $0x0,%esi
+  801ebd:	bf 05 00 00 00       	mov    $0x5,%edi
+  801ec2:	48 b8 b2 1d 80 00 00 	movabs $0x801db2,%rax
+  801ec9:	00 00 00 
+  801ecc:	ff d0                	call   *%rax
+    if (res < 0) {
+  801ece:	85 c0                	test   %eax,%eax
+  801ed0:	78 3d                	js     801f0f <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801ed2:	49 bc 00 60 c0 00 00 	movabs $0xc06000,%r12
+  801ed9:	00 00 00 
+  801edc:	4c 89 e6             	mov    %r12,%rsi
+  801edf:	48 89 df             	mov    %rbx,%rdi
+  801ee2:	48 b8 99 0c 80 00 00 	movabs $0x800c99,%rax
+  801ee9:	00 00 00 
+  801eec:	ff d0                	call   *%rax
+    st->st_size  = fsipcbuf.statRet.ret_size;
+  801eee:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  801ef5:	00 
+  801ef6:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801efc:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  801f03:	00 
+  801f04:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  801f0a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801f0f:	5b                   	pop    %rbx
+  801f10:	41 5c                	pop    %r12
+  801f12:	5d                   	pop    %rbp
+  801f13:	c3                   	ret
+
+0000000000801f14 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  801f14:	55                   	push   %rbp
+  801f15:	48 89 e5             	mov    %rsp,%rbp
+  801f18:	41 57                	push   %r15
+  801f1a:	41 56                	push   %r14
+  801f1c:	41 55                	push   %r13
+  801f1e:	41 54                	push   %r12
+  801f20:	53                   	push   %rbx
+  801f21:	48 83 ec 18          	sub    $0x18,%rsp
+  801f25:	49 89 fe             	mov    %rdi,%r14
+  801f28:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+  801f2c:	48 89 d3             	mov    %rdx,%rbx
+    while (n > sizeof(fsipcbuf.write.req_buf))
+  801f2f:	48 81 fa f0 0f 00 00 	cmp    $0xff0,%rdx
+  801f36:	0f 86 e4 00 00 00    	jbe    802020 <devfile_write+0x10c>
+  801f3c:	49 89 f4             	mov    %rsi,%r12
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801f3f:	49 bd 00 60 c0 00 00 	movabs $0xc06000,%r13
+  801f46:	00 00 00 
+        memcpy(fsipcbuf.write.req_buf, buf, sizeof(fsipcbuf.write.req_buf));
+  801f49:	49 bf fa 0e 80 00 00 	movabs $0x800efa,%r15
+  801f50:	00 00 00 
+  801f53:	eb 03                	jmp    801f58 <devfile_write+0x44>
+        buf += sizeof(fsipcbuf.write.req_buf);
+  801f55:	49 89 f4             	mov    %rsi,%r12
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801f58:	41 8b 46 0c          	mov    0xc(%r14),%eax
+  801f5c:	41 89 45 00          	mov    %eax,0x0(%r13)
+        fsipcbuf.write.req_n      = sizeof(fsipcbuf.write.req_buf);
+  801f60:	49 c7 45 08 f0 0f 00 	movq   $0xff0,0x8(%r13)
+  801f67:	00 
+        memcpy(fsipcbuf.write.req_buf, buf, sizeof(fsipcbuf.write.req_buf));
+  801f68:	ba f0 0f 00 00       	mov    $0xff0,%edx
+  801f6d:	4c 89 e6             	mov    %r12,%rsi
+  801f70:	48 bf 10 60 c0 00 00 	movabs $0xc06010,%rdi
+  801f77:	00 00 00 
+  801f7a:	41 ff d7             	call   *%r15
+        ssize_t res = fsipc(FSREQ_WRITE, NULL);
+  801f7d:	be 00 00 00 00       	mov    $0x0,%esi
+  801f82:	bf 04 00 00 00       	mov    $0x4,%edi
+  801f87:	48 b8 b2 1d 80 00 00 	movabs $0x801db2,%rax
+  801f8e:	00 00 00 
+  801f91:	ff d0                	call   *%rax
+  801f93:	48 63 d0             	movslq %eax,%rdx
+        if (res < 0 || res < sizeof(fsipcbuf.write.req_buf))
+  801f96:	3d ef 0f 00 00       	cmp    $0xfef,%eax
+  801f9b:	7e 71                	jle    80200e <devfile_write+0xfa>
+        buf += sizeof(fsipcbuf.write.req_buf);
+  801f9d:	49 8d b4 24 f0 0f 00 	lea    0xff0(%r12),%rsi
+  801fa4:	00 
+        n -= sizeof(fsipcbuf.write.req_buf);
+  801fa5:	48 81 eb f0 0f 00 00 	sub    $0xff0,%rbx
+    while (n > sizeof(fsipcbuf.write.req_buf))
+  801fac:	48 81 fb f0 0f 00 00 	cmp    $0xff0,%rbx
+  801fb3:	77 a0                	ja     801f55 <devfile_write+0x41>
+        written += sizeof(fsipcbuf.write.req_buf);
+  801fb5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801fb9:	49 29 c4             	sub    %rax,%r12
+  801fbc:	4d 8d a4 24 f0 0f 00 	lea    0xff0(%r12),%r12
+  801fc3:	00 
+    fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801fc4:	48 b8 00 60 c0 00 00 	movabs $0xc06000,%rax
+  801fcb:	00 00 00 
+  801fce:	41 8b 56 0c          	mov    0xc(%r14),%edx
+  801fd2:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.write.req_n      = n;
+  801fd4:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    memcpy(fsipcbuf.write.req_buf, buf, n);
+  801fd8:	48 89 da             	mov    %rbx,%rdx
+  801fdb:	48 8d 78 10          	lea    0x10(%rax),%rdi
+  801fdf:	48 b8 fa 0e 80 00 00 	movabs $0x800efa,%rax
+  801fe6:	00 00 00 
+  801fe9:	ff d0                	call   *%rax
+    ssize_t res = fsipc(FSREQ_WRITE, NULL);
+  801feb:	be 00 00 00 00       	mov    $0x0,%esi
+  801ff0:	bf 04 00 00 00       	mov    $0x4,%edi
+  801ff5:	48 b8 b2 1d 80 00 00 	movabs $0x801db2,%rax
+  801ffc:	00 00 00 
+  801fff:	ff d0                	call   *%rax
+  802001:	48 63 d0             	movslq %eax,%rdx
+    written += res;
+  802004:	49 01 d4             	add    %rdx,%r12
+  802007:	48 85 d2             	test   %rdx,%rdx
+  80200a:	49 0f 49 d4          	cmovns %r12,%rdx
+}
+  80200e:	48 89 d0             	mov    %rdx,%rax
+  802011:	48 83 c4 18          	add    $0x18,%rsp
+  802015:	5b                   	pop    %rbx
+  802016:	41 5c                	pop    %r12
+  802018:	41 5d                	pop    %r13
+  80201a:	41 5e                	pop    %r14
+  80201c:	41 5f                	pop    %r15
+  80201e:	5d                   	pop    %rbp
+  80201f:	c3                   	ret
+    while (n > sizeof(fsipcbuf.write.req_buf))
+  802020:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+    ssize_t written = 0;
+  802024:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80202a:	eb 98                	jmp    801fc4 <devfile_write+0xb0>
+
+000000000080202c <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  80202c:	55                   	push   %rbp
+  80202d:	48 89 e5             	mov    %rsp,%rbp
+  802030:	41 57                	push   %r15
+  802032:	41 56                	push   %r14
+  802034:	41 55                	push   %r13
+  802036:	41 54                	push   %r12
+  802038:	53                   	push   %rbx
+  802039:	48 83 ec 18          	sub    $0x18,%rsp
+  80203d:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  802041:	49 89 f6             	mov    %rsi,%r14
+  802044:	49 89 d4             	mov    %rdx,%r12
+    while (n > sizeof(fsipcbuf.readRet.ret_buf))
+  802047:	48 81 fa 00 10 00 00 	cmp    $0x1000,%rdx
+  80204e:	0f 86 ea 00 00 00    	jbe    80213e <devfile_read+0x112>
+    ssize_t readsz = 0;
+  802054:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  80205b:	00 
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  80205c:	49 bf 00 60 c0 00 00 	movabs $0xc06000,%r15
+  802063:	00 00 00 
+  802066:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80206a:	8b 40 0c             	mov    0xc(%rax),%eax
+  80206d:	41 89 07             	mov    %eax,(%r15)
+        fsipcbuf.read.req_n = sizeof(fsipcbuf.readRet.ret_buf);
+  802070:	49 c7 47 08 00 10 00 	movq   $0x1000,0x8(%r15)
+  802077:	00 
+        ssize_t res = fsipc(FSREQ_READ, NULL);
+  802078:	be 00 00 00 00       	mov    $0x0,%esi
+  80207d:	bf 03 00 00 00       	mov    $0x3,%edi
+  802082:	48 b8 b2 1d 80 00 00 	movabs $0x801db2,%rax
+  802089:	00 00 00 
+  80208c:	ff d0                	call   *%rax
+  80208e:	4c 63 e8             	movslq %eax,%r13
+        if (res < 0)
+  802091:	4d 85 ed             	test   %r13,%r13
+  802094:	0f 88 92 00 00 00    	js     80212c <devfile_read+0x100>
+        memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  80209a:	4c 89 ea             	mov    %r13,%rdx
+  80209d:	4c 89 fe             	mov    %r15,%rsi
+  8020a0:	4c 89 f7             	mov    %r14,%rdi
+  8020a3:	48 b8 fa 0e 80 00 00 	movabs $0x800efa,%rax
+  8020aa:	00 00 00 
+  8020ad:	ff d0                	call   *%rax
+        if (res < sizeof(fsipcbuf.readRet.ret_buf))
+  8020af:	49 81 fd ff 0f 00 00 	cmp    $0xfff,%r13
+  8020b6:	76 6d                	jbe    802125 <devfile_read+0xf9>
+        readsz += res;
+  8020b8:	4c 01 6d c0          	add    %r13,-0x40(%rbp)
+        buf += res;
+  8020bc:	4d 01 ee             	add    %r13,%r14
+        n -= res;
+  8020bf:	4d 29 ec             	sub    %r13,%r12
+    while (n > sizeof(fsipcbuf.readRet.ret_buf))
+  8020c2:	49 81 fc 00 10 00 00 	cmp    $0x1000,%r12
+  8020c9:	77 9b                	ja     802066 <devfile_read+0x3a>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8020cb:	48 b8 00 60 c0 00 00 	movabs $0xc06000,%rax
+  8020d2:	00 00 00 
+  8020d5:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  8020d9:	8b 51 0c             	mov    0xc(%rcx),%edx
+  8020dc:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.read.req_n = n;
+  8020de:	4c 89 60 08          	mov    %r12,0x8(%rax)
+    ssize_t res = fsipc(FSREQ_READ, NULL);
+  8020e2:	be 00 00 00 00       	mov    $0x0,%esi
+  8020e7:	bf 03 00 00 00       	mov    $0x3,%edi
+  8020ec:	48 b8 b2 1d 80 00 00 	movabs $0x801db2,%rax
+  8020f3:	00 00 00 
+  8020f6:	ff d0                	call   *%rax
+  8020f8:	4c 63 e8             	movslq %eax,%r13
+    if (res < 0)
+  8020fb:	4d 85 ed             	test   %r13,%r13
+  8020fe:	78 2c                	js     80212c <devfile_read+0x100>
+    memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  802100:	4c 89 ea             	mov    %r13,%rdx
+  802103:	48 be 00 60 c0 00 00 	movabs $0xc06000,%rsi
+  80210a:	00 00 00 
+  80210d:	4c 89 f7             	mov    %r14,%rdi
+  802110:	48 b8 fa 0e 80 00 00 	movabs $0x800efa,%rax
+  802117:	00 00 00 
+  80211a:	ff d0                	call   *%rax
+    readsz += res;
+  80211c:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802120:	49 01 c5             	add    %rax,%r13
+    return readsz;
+  802123:	eb 07                	jmp    80212c <devfile_read+0x100>
+            return readsz + res;
+  802125:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802129:	49 01 c5             	add    %rax,%r13
+}
+  80212c:	4c 89 e8             	mov    %r13,%rax
+  80212f:	48 83 c4 18          	add    $0x18,%rsp
+  802133:	5b                   	pop    %rbx
+  802134:	41 5c                	pop    %r12
+  802136:	41 5d                	pop    %r13
+  802138:	41 5e                	pop    %r14
+  80213a:	41 5f                	pop    %r15
+  80213c:	5d                   	pop    %rbp
+  80213d:	c3                   	ret
+    ssize_t readsz = 0;
+  80213e:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  802145:	00 
+  802146:	eb 83                	jmp    8020cb <devfile_read+0x9f>
+
+0000000000802148 <open>:
+open(const char *path, int mode) {
+  802148:	55                   	push   %rbp
+  802149:	48 89 e5             	mov    %rsp,%rbp
+  80214c:	41 55                	push   %r13
+  80214e:	41 54                	push   %r12
+  802150:	53                   	push   %rbx
+  802151:	48 83 ec 18          	sub    $0x18,%rsp
+  802155:	49 89 fc             	mov    %rdi,%r12
+  802158:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  80215b:	48 b8 5b 0c 80 00 00 	movabs $0x800c5b,%rax
+  802162:	00 00 00 
+  802165:	ff d0                	call   *%rax
+  802167:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  80216d:	0f 87 8a 00 00 00    	ja     8021fd <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802173:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802177:	48 b8 2b 17 80 00 00 	movabs $0x80172b,%rax
+  80217e:	00 00 00 
+  802181:	ff d0                	call   *%rax
+  802183:	89 c3                	mov    %eax,%ebx
+  802185:	85 c0                	test   %eax,%eax
+  802187:	78 50                	js     8021d9 <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  802189:	4c 89 e6             	mov    %r12,%rsi
+  80218c:	48 bb 00 60 c0 00 00 	movabs $0xc06000,%rbx
+  802193:	00 00 00 
+  802196:	48 89 df             	mov    %rbx,%rdi
+  802199:	48 b8 99 0c 80 00 00 	movabs $0x800c99,%rax
+  8021a0:	00 00 00 
+  8021a3:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  8021a5:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  8021ac:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8021b0:	bf 01 00 00 00       	mov    $0x1,%edi
+  8021b5:	48 b8 b2 1d 80 00 00 	movabs $0x801db2,%rax
+  8021bc:	00 00 00 
+  8021bf:	ff d0                	call   *%rax
+  8021c1:	89 c3                	mov    %eax,%ebx
+  8021c3:	85 c0                	test   %eax,%eax
+  8021c5:	78 1f                	js     8021e6 <open+0x9e>
+    return fd2num(fd);
+  8021c7:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8021cb:	48 b8 84 16 80 00 00 	movabs $0x801684,%rax
+  8021d2:	00 00 00 
+  8021d5:	ff d0                	call   *%rax
+  8021d7:	89 c3                	mov    %eax,%ebx
+}
+  8021d9:	89 d8                	mov    %ebx,%eax
+  8021db:	48 83 c4 18          	add    $0x18,%rsp
+  8021df:	5b                   	pop    %rbx
+  8021e0:	41 5c                	pop    %r12
+  8021e2:	41 5d                	pop    %r13
+  8021e4:	5d                   	pop    %rbp
+  8021e5:	c3                   	ret
+        fd_close(fd, 0);
+  8021e6:	be 00 00 00 00       	mov    $0x0,%esi
+  8021eb:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8021ef:	48 b8 00 18 80 00 00 	movabs $0x801800,%rax
+  8021f6:	00 00 00 
+  8021f9:	ff d0                	call   *%rax
+        return res;
+  8021fb:	eb dc                	jmp    8021d9 <open+0x91>
+        return -E_BAD_PATH;
+  8021fd:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  802202:	eb d5                	jmp    8021d9 <open+0x91>
+
+0000000000802204 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  802204:	55                   	push   %rbp
+  802205:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc(FSREQ_SYNC, NULL);
+  802208:	be 00 00 00 00       	mov    $0x0,%esi
+  80220d:	bf 08 00 00 00       	mov    $0x8,%edi
+  802212:	48 b8 b2 1d 80 00 00 	movabs $0x801db2,%rax
+  802219:	00 00 00 
+  80221c:	ff d0                	call   *%rax
+}
+  80221e:	5d                   	pop    %rbp
+  80221f:	c3                   	ret
+
+0000000000802220 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  802220:	55                   	push   %rbp
+  802221:	48 89 e5             	mov    %rsp,%rbp
+  802224:	41 54                	push   %r12
+  802226:	53                   	push   %rbx
+  802227:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80222a:	48 b8 96 16 80 00 00 	movabs $0x801696,%rax
+  802231:	00 00 00 
+  802234:	ff d0                	call   *%rax
+  802236:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  802239:	48 be c0 34 80 00 00 	movabs $0x8034c0,%rsi
+  802240:	00 00 00 
+  802243:	48 89 df             	mov    %rbx,%rdi
+  802246:	48 b8 99 0c 80 00 00 	movabs $0x800c99,%rax
+  80224d:	00 00 00 
+  802250:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  802252:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  802257:	41 2b 04 24          	sub    (%r12),%eax
+  80225b:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  802261:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  802268:	00 00 00 
+    stat->st_dev = &devpipe;
+  80226b:	48 b8 60 40 80 00 00 	movabs $0x804060,%rax
+  802272:	00 00 00 
+  802275:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  80227c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802281:	5b                   	pop    %rbx
+  802282:	41 5c                	pop    %r12
+  802284:	5d                   	pop    %rbp
+  802285:	c3                   	ret
+
+0000000000802286 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  802286:	55                   	push   %rbp
+  802287:	48 89 e5             	mov    %rsp,%rbp
+  80228a:	41 54                	push   %r12
+  80228c:	53                   	push   %rbx
+  80228d:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  802290:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802295:	48 89 fe             	mov    %rdi,%rsi
+  802298:	bf 00 00 00 00       	mov    $0x0,%edi
+  80229d:	49 bc 15 13 80 00 00 	movabs $0x801315,%r12
+  8022a4:	00 00 00 
+  8022a7:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  8022aa:	48 89 df             	mov    %rbx,%rdi
+  8022ad:	48 b8 96 16 80 00 00 	movabs $0x801696,%rax
+  8022b4:	00 00 00 
+  8022b7:	ff d0                	call   *%rax
+  8022b9:	48 89 c6             	mov    %rax,%rsi
+  8022bc:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8022c1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8022c6:	41 ff d4             	call   *%r12
+}
+  8022c9:	5b                   	pop    %rbx
+  8022ca:	41 5c                	pop    %r12
+  8022cc:	5d                   	pop    %rbp
+  8022cd:	c3                   	ret
+
+00000000008022ce <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8022ce:	55                   	push   %rbp
+  8022cf:	48 89 e5             	mov    %rsp,%rbp
+  8022d2:	41 57                	push   %r15
+  8022d4:	41 56                	push   %r14
+  8022d6:	41 55                	push   %r13
+  8022d8:	41 54                	push   %r12
+  8022da:	53                   	push   %rbx
+  8022db:	48 83 ec 18          	sub    $0x18,%rsp
+  8022df:	49 89 fc             	mov    %rdi,%r12
+  8022e2:	49 89 f5             	mov    %rsi,%r13
+  8022e5:	49 89 d7             	mov    %rdx,%r15
+  8022e8:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8022ec:	48 b8 96 16 80 00 00 	movabs $0x801696,%rax
+  8022f3:	00 00 00 
+  8022f6:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  8022f8:	4d 85 ff             	test   %r15,%r15
+  8022fb:	0f 84 af 00 00 00    	je     8023b0 <devpipe_write+0xe2>
+  802301:	48 89 c3             	mov    %rax,%rbx
+  802304:	4c 89 f8             	mov    %r15,%rax
+  802307:	4d 89 ef             	mov    %r13,%r15
+  80230a:	4c 01 e8             	add    %r13,%rax
+  80230d:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802311:	49 bd 1d 12 80 00 00 	movabs $0x80121d,%r13
+  802318:	00 00 00 
+            sys_yield();
+  80231b:	49 be ba 11 80 00 00 	movabs $0x8011ba,%r14
+  802322:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  802325:	8b 73 04             	mov    0x4(%rbx),%esi
+  802328:	48 63 ce             	movslq %esi,%rcx
+  80232b:	48 63 03             	movslq (%rbx),%rax
+  80232e:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  802334:	48 39 c1             	cmp    %rax,%rcx
+  802337:	72 2e                	jb     802367 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802339:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80233e:	48 89 da             	mov    %rbx,%rdx
+  802341:	be 00 10 00 00       	mov    $0x1000,%esi
+  802346:	4c 89 e7             	mov    %r12,%rdi
+  802349:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  80234c:	85 c0                	test   %eax,%eax
+  80234e:	74 66                	je     8023b6 <devpipe_write+0xe8>
+            sys_yield();
+  802350:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  802353:	8b 73 04             	mov    0x4(%rbx),%esi
+  802356:	48 63 ce             	movslq %esi,%rcx
+  802359:	48 63 03             	movslq (%rbx),%rax
+  80235c:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  802362:	48 39 c1             	cmp    %rax,%rcx
+  802365:	73 d2                	jae    802339 <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  802367:	41 0f b6 3f          	movzbl (%r15),%edi
+  80236b:	48 89 ca             	mov    %rcx,%rdx
+  80236e:	48 c1 ea 03          	shr    $0x3,%rdx
+  802372:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  802379:	08 10 20 
+  80237c:	48 f7 e2             	mul    %rdx
+  80237f:	48 c1 ea 06          	shr    $0x6,%rdx
+  802383:	48 89 d0             	mov    %rdx,%rax
+  802386:	48 c1 e0 09          	shl    $0x9,%rax
+  80238a:	48 29 d0             	sub    %rdx,%rax
+  80238d:	48 c1 e0 03          	shl    $0x3,%rax
+  802391:	48 29 c1             	sub    %rax,%rcx
+  802394:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  802399:	83 c6 01             	add    $0x1,%esi
+  80239c:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  80239f:	49 83 c7 01          	add    $0x1,%r15
+  8023a3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8023a7:	49 39 c7             	cmp    %rax,%r15
+  8023aa:	0f 85 75 ff ff ff    	jne    802325 <devpipe_write+0x57>
+    return n;
+  8023b0:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8023b4:	eb 05                	jmp    8023bb <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  8023b6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8023bb:	48 83 c4 18          	add    $0x18,%rsp
+  8023bf:	5b                   	pop    %rbx
+  8023c0:	41 5c                	pop    %r12
+  8023c2:	41 5d                	pop    %r13
+  8023c4:	41 5e                	pop    %r14
+  8023c6:	41 5f                	pop    %r15
+  8023c8:	5d                   	pop    %rbp
+  8023c9:	c3                   	ret
+
+00000000008023ca <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  8023ca:	55                   	push   %rbp
+  8023cb:	48 89 e5             	mov    %rsp,%rbp
+  8023ce:	41 57                	push   %r15
+  8023d0:	41 56                	push   %r14
+  8023d2:	41 55                	push   %r13
+  8023d4:	41 54                	push   %r12
+  8023d6:	53                   	push   %rbx
+  8023d7:	48 83 ec 18          	sub    $0x18,%rsp
+  8023db:	49 89 fc             	mov    %rdi,%r12
+  8023de:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  8023e2:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8023e6:	48 b8 96 16 80 00 00 	movabs $0x801696,%rax
+  8023ed:	00 00 00 
+  8023f0:	ff d0                	call   *%rax
+  8023f2:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  8023f5:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8023fb:	49 bd 1d 12 80 00 00 	movabs $0x80121d,%r13
+  802402:	00 00 00 
+            sys_yield();
+  802405:	49 be ba 11 80 00 00 	movabs $0x8011ba,%r14
+  80240c:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  80240f:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  802414:	74 7d                	je     802493 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  802416:	8b 03                	mov    (%rbx),%eax
+  802418:	3b 43 04             	cmp    0x4(%rbx),%eax
+  80241b:	75 26                	jne    802443 <devpipe_read+0x79>
+            if (i > 0) return i;
+  80241d:	4d 85 ff             	test   %r15,%r15
+  802420:	75 77                	jne    802499 <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802422:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802427:	48 89 da             	mov    %rbx,%rdx
+  80242a:	be 00 10 00 00       	mov    $0x1000,%esi
+  80242f:	4c 89 e7             	mov    %r12,%rdi
+  802432:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  802435:	85 c0                	test   %eax,%eax
+  802437:	74 72                	je     8024ab <devpipe_read+0xe1>
+            sys_yield();
+  802439:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  80243c:	8b 03                	mov    (%rbx),%eax
+  80243e:	3b 43 04             	cmp    0x4(%rbx),%eax
+  802441:	74 df                	je     802422 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802443:	48 63 c8             	movslq %eax,%rcx
+  802446:	48 89 ca             	mov    %rcx,%rdx
+  802449:	48 c1 ea 03          	shr    $0x3,%rdx
+  80244d:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  802454:	08 10 20 
+  802457:	48 89 d0             	mov    %rdx,%rax
+  80245a:	48 f7 e6             	mul    %rsi
+  80245d:	48 c1 ea 06          	shr    $0x6,%rdx
+  802461:	48 89 d0             	mov    %rdx,%rax
+  802464:	48 c1 e0 09          	shl    $0x9,%rax
+  802468:	48 29 d0             	sub    %rdx,%rax
+  80246b:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  802472:	00 
+  802473:	48 89 c8             	mov    %rcx,%rax
+  802476:	48 29 d0             	sub    %rdx,%rax
+  802479:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  80247e:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  802482:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  802486:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  802489:	49 83 c7 01          	add    $0x1,%r15
+  80248d:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  802491:	75 83                	jne    802416 <devpipe_read+0x4c>
+    return n;
+  802493:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802497:	eb 03                	jmp    80249c <devpipe_read+0xd2>
+            if (i > 0) return i;
+  802499:	4c 89 f8             	mov    %r15,%rax
+}
+  80249c:	48 83 c4 18          	add    $0x18,%rsp
+  8024a0:	5b                   	pop    %rbx
+  8024a1:	41 5c                	pop    %r12
+  8024a3:	41 5d                	pop    %r13
+  8024a5:	41 5e                	pop    %r14
+  8024a7:	41 5f                	pop    %r15
+  8024a9:	5d                   	pop    %rbp
+  8024aa:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  8024ab:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024b0:	eb ea                	jmp    80249c <devpipe_read+0xd2>
+
+00000000008024b2 <pipe>:
+pipe(int pfd[2]) {
+  8024b2:	55                   	push   %rbp
+  8024b3:	48 89 e5             	mov    %rsp,%rbp
+  8024b6:	41 55                	push   %r13
+  8024b8:	41 54                	push   %r12
+  8024ba:	53                   	push   %rbx
+  8024bb:	48 81 ec b8 00 00 00 	sub    $0xb8,%rsp
+  8024c2:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8024c5:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  8024c9:	48 b8 2b 17 80 00 00 	movabs $0x80172b,%rax
+  8024d0:	00 00 00 
+  8024d3:	ff d0                	call   *%rax
+  8024d5:	89 c3                	mov    %eax,%ebx
+  8024d7:	85 c0                	test   %eax,%eax
+  8024d9:	0f 88 51 01 00 00    	js     802630 <pipe+0x17e>
+        (res = fd_alloc_from(fd2num(fd0) + 1, &fd1)) < 0) goto err;
+  8024df:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8024e3:	48 b8 84 16 80 00 00 	movabs $0x801684,%rax
+  8024ea:	00 00 00 
+  8024ed:	ff d0                	call   *%rax
+  8024ef:	8d 78 01             	lea    0x1(%rax),%edi
+  8024f2:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8024f6:	48 b8 b2 16 80 00 00 	movabs $0x8016b2,%rax
+  8024fd:	00 00 00 
+  802500:	ff d0                	call   *%rax
+  802502:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  802504:	85 c0                	test   %eax,%eax
+  802506:	0f 88 24 01 00 00    	js     802630 <pipe+0x17e>
+    va = fd2data(fd0);
+  80250c:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802510:	48 bb 96 16 80 00 00 	movabs $0x801696,%rbx
+  802517:	00 00 00 
+  80251a:	ff d3                	call   *%rbx
+  80251c:	49 89 c5             	mov    %rax,%r13
+    struct RegionOp ops[] = {
+  80251f:	48 8d bd 30 ff ff ff 	lea    -0xd0(%rbp),%rdi
+  802526:	b9 14 00 00 00       	mov    $0x14,%ecx
+  80252b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802530:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+  802533:	c7 85 34 ff ff ff 46 	movl   $0x46,-0xcc(%rbp)
+  80253a:	00 00 00 
+  80253d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802541:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+  802548:	48 c7 85 50 ff ff ff 	movq   $0x1000,-0xb0(%rbp)
+  80254f:	00 10 00 00 
+  802553:	c7 85 5c ff ff ff 46 	movl   $0x46,-0xa4(%rbp)
+  80255a:	00 00 00 
+            {.type = REGION_ALLOC, .dstva = (uintptr_t)fd1, .size = PAGE_SIZE, .perm = PROT_RW | PROT_SHARE},
+  80255d:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+    struct RegionOp ops[] = {
+  802561:	48 89 bd 70 ff ff ff 	mov    %rdi,-0x90(%rbp)
+  802568:	48 c7 85 78 ff ff ff 	movq   $0x1000,-0x88(%rbp)
+  80256f:	00 10 00 00 
+  802573:	c7 45 84 46 00 00 00 	movl   $0x46,-0x7c(%rbp)
+  80257a:	4c 89 6d 98          	mov    %r13,-0x68(%rbp)
+  80257e:	48 c7 45 a0 00 10 00 	movq   $0x1000,-0x60(%rbp)
+  802585:	00 
+  802586:	c7 45 a8 01 00 00 00 	movl   $0x1,-0x58(%rbp)
+  80258d:	c7 45 ac 46 00 00 00 	movl   $0x46,-0x54(%rbp)
+  802594:	4c 89 6d b8          	mov    %r13,-0x48(%rbp)
+            {.type = REGION_MAP, .srcva = (uintptr_t)va, .dstva = (uintptr_t)fd2data(fd1), .size = PAGE_SIZE, .perm = PROT_RW | PROT_SHARE},
+  802598:	ff d3                	call   *%rbx
+    struct RegionOp ops[] = {
+  80259a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80259e:	48 c7 45 c8 00 10 00 	movq   $0x1000,-0x38(%rbp)
+  8025a5:	00 
+    if ((res = sys_region_batch(ops, sizeof ops / sizeof *ops)) < 0) goto err1;
+  8025a6:	be 04 00 00 00       	mov    $0x4,%esi
+  8025ab:	48 8d bd 30 ff ff ff 	lea    -0xd0(%rbp),%rdi
+  8025b2:	48 b8 7c 13 80 00 00 	movabs $0x80137c,%rax
+  8025b9:	00 00 00 
+  8025bc:	ff d0                	call   *%rax
+  8025be:	89 c3                	mov    %eax,%ebx
+  8025c0:	85 c0                	test   %eax,%eax
+  8025c2:	0f 88 ad 00 00 00    	js     802675 <pipe+0x1c3>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8025c8:	be 00 10 00 00       	mov    $0x1000,%esi
+  8025cd:	4c 89 ef             	mov    %r13,%rdi
+  8025d0:	48 b8 eb 11 80 00 00 	movabs $0x8011eb,%rax
+  8025d7:	00 00 00 
+  8025da:	ff d0                	call   *%rax
+  8025dc:	83 f8 02             	cmp    $0x2,%eax
+  8025df:	75 5f                	jne    802640 <pipe+0x18e>
+    fd0->fd_dev_id = devpipe.dev_id;
+  8025e1:	a1 60 40 80 00 00 00 	movabs 0x804060,%eax
+  8025e8:	00 00 
+  8025ea:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8025ee:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  8025f0:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8025f4:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  8025fb:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8025ff:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  802601:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802605:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  80260c:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802610:	48 bb 84 16 80 00 00 	movabs $0x801684,%rbx
+  802617:	00 00 00 
+  80261a:	ff d3                	call   *%rbx
+  80261c:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  802620:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  802624:	ff d3                	call   *%rbx
+  802626:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  80262b:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  802630:	89 d8                	mov    %ebx,%eax
+  802632:	48 81 c4 b8 00 00 00 	add    $0xb8,%rsp
+  802639:	5b                   	pop    %rbx
+  80263a:	41 5c                	pop    %r12
+  80263c:	41 5d                	pop    %r13
+  80263e:	5d                   	pop    %rbp
+  80263f:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  802640:	48 b9 f0 34 80 00 00 	movabs $0x8034f0,%rcx
+  802647:	00 00 00 
+  80264a:	48 ba c7 34 80 00 00 	movabs $0x8034c7,%rdx
+  802651:	00 00 00 
+  802654:	be 33 00 00 00       	mov    $0x33,%esi
+  802659:	48 bf dc 34 80 00 00 	movabs $0x8034dc,%rdi
+  802660:	00 00 00 
+  802663:	b8 00 00 00 00       	mov    $0x0,%eax
+  802668:	49 b8 24 02 80 00 00 	movabs $0x800224,%r8
+  80266f:	00 00 00 
+  802672:	41 ff d0             	call   *%r8
+        ops[i].type = REGION_UNMAP;
+  802675:	c7 85 30 ff ff ff 02 	movl   $0x2,-0xd0(%rbp)
+  80267c:	00 00 00 
+  80267f:	c7 85 58 ff ff ff 02 	movl   $0x2,-0xa8(%rbp)
+  802686:	00 00 00 
+  802689:	c7 45 80 02 00 00 00 	movl   $0x2,-0x80(%rbp)
+  802690:	c7 45 a8 02 00 00 00 	movl   $0x2,-0x58(%rbp)
+    sys_region_batch(ops, sizeof ops / sizeof *ops);
+  802697:	be 04 00 00 00       	mov    $0x4,%esi
+  80269c:	48 8d bd 30 ff ff ff 	lea    -0xd0(%rbp),%rdi
+  8026a3:	48 b8 7c 13 80 00 00 	movabs $0x80137c,%rax
+  8026aa:	00 00 00 
+  8026ad:	ff d0                	call   *%rax
+  8026af:	e9 7c ff ff ff       	jmp    802630 <pipe+0x17e>
+
+00000000008026b4 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  8026b4:	55                   	push   %rbp
+  8026b5:	48 89 e5             	mov    %rsp,%rbp
+  8026b8:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8026bc:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8026c0:	48 b8 45 17 80 00 00 	movabs $0x801745,%rax
+  8026c7:	00 00 00 
+  8026ca:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8026cc:	85 c0                	test   %eax,%eax
+  8026ce:	78 35                	js     802705 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  8026d0:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8026d4:	48 b8 96 16 80 00 00 	movabs $0x801696,%rax
+  8026db:	00 00 00 
+  8026de:	ff d0                	call   *%rax
+  8026e0:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8026e3:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8026e8:	be 00 10 00 00       	mov    $0x1000,%esi
+  8026ed:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8026f1:	48 b8 1d 12 80 00 00 	movabs $0x80121d,%rax
+  8026f8:	00 00 00 
+  8026fb:	ff d0                	call   *%rax
+  8026fd:	85 c0                	test   %eax,%eax
+  8026ff:	0f 94 c0             	sete   %al
+  802702:	0f b6 c0             	movzbl %al,%eax
+}
+  802705:	c9                   	leave
+  802706:	c3                   	ret
+
+0000000000802707 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  802707:	48 89 f8             	mov    %rdi,%rax
+  80270a:	48 c1 e8 27          	shr    $0x27,%rax
+  80270e:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  802715:	01 00 00 
+  802718:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80271c:	f6 c2 01             	test   $0x1,%dl
+  80271f:	74 6d                	je     80278e <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  802721:	48 89 f8             	mov    %rdi,%rax
+  802724:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802728:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  80272f:	01 00 00 
+  802732:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802736:	f6 c2 01             	test   $0x1,%dl
+  802739:	74 62                	je     80279d <get_uvpt_entry+0x96>
+  80273b:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802742:	01 00 00 
+  802745:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802749:	f6 c2 80             	test   $0x80,%dl
+  80274c:	75 4f                	jne    80279d <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  80274e:	48 89 f8             	mov    %rdi,%rax
+  802751:	48 c1 e8 15          	shr    $0x15,%rax
+  802755:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  80275c:	01 00 00 
+  80275f:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802763:	f6 c2 01             	test   $0x1,%dl
+  802766:	74 44                	je     8027ac <get_uvpt_entry+0xa5>
+  802768:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  80276f:	01 00 00 
+  802772:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802776:	f6 c2 80             	test   $0x80,%dl
+  802779:	75 31                	jne    8027ac <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  80277b:	48 c1 ef 0c          	shr    $0xc,%rdi
+  80277f:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802786:	01 00 00 
+  802789:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  80278d:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  80278e:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  802795:	01 00 00 
+  802798:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80279c:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  80279d:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8027a4:	01 00 00 
+  8027a7:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8027ab:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8027ac:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8027b3:	01 00 00 
+  8027b6:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8027ba:	c3                   	ret
+
+00000000008027bb <get_prot>:
+
+int
+get_prot(void *va) {
+  8027bb:	55                   	push   %rbp
+  8027bc:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8027bf:	48 b8 07 27 80 00 00 	movabs $0x802707,%rax
+  8027c6:	00 00 00 
+  8027c9:	ff d0                	call   *%rax
+  8027cb:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  8027ce:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  8027d3:	89 c1                	mov    %eax,%ecx
+  8027d5:	83 c9 04             	or     $0x4,%ecx
+  8027d8:	f6 c2 01             	test   $0x1,%dl
+  8027db:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  8027de:	89 c1                	mov    %eax,%ecx
+  8027e0:	83 c9 02             	or     $0x2,%ecx
+  8027e3:	f6 c2 02             	test   $0x2,%dl
+  8027e6:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  8027e9:	89 c1                	mov    %eax,%ecx
+  8027eb:	83 c9 01             	or     $0x1,%ecx
+  8027ee:	48 85 d2             	test   %rdx,%rdx
+  8027f1:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  8027f4:	89 c1                	mov    %eax,%ecx
+  8027f6:	83 c9 40             	or     $0x40,%ecx
+  8027f9:	f6 c6 04             	test   $0x4,%dh
+  8027fc:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  8027ff:	5d                   	pop    %rbp
+  802800:	c3                   	ret
+
+0000000000802801 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  802801:	55                   	push   %rbp
+  802802:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  802805:	48 b8 07 27 80 00 00 	movabs $0x802707,%rax
+  80280c:	00 00 00 
+  80280f:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  802811:	48 c1 e8 06          	shr    $0x6,%rax
+  802815:	83 e0 01             	and    $0x1,%eax
+}
+  802818:	5d                   	pop    %rbp
+  802819:	c3                   	ret
+
+000000000080281a <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  80281a:	55                   	push   %rbp
+  80281b:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  80281e:	48 b8 07 27 80 00 00 	movabs $0x802707,%rax
+  802825:	00 00 00 
+  802828:	ff d0                	call   *%rax
+  80282a:	83 e0 01             	and    $0x1,%eax
+}
+  80282d:	5d                   	pop    %rbp
+  80282e:	c3                   	ret
+
+000000000080282f <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  80282f:	55                   	push   %rbp
+  802830:	48 89 e5             	mov    %rsp,%rbp
+  802833:	41 57                	push   %r15
+  802835:	41 56                	push   %r14
+  802837:	41 55                	push   %r13
+  802839:	41 54                	push   %r12
+  80283b:	53                   	push   %rbx
+  80283c:	48 83 ec 38          	sub    $0x38,%rsp
+  802840:	49 89 f7             	mov    %rsi,%r15
+  802843:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+                    }
+                    continue;
+                }
+                for (int ptei = 0; ptei < PT_ENTRY_COUNT; ptei++) {
+                    uintptr_t pte_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, pdei, ptei, 0);
+                    pte_t pte = uvpt[VPT(pte_addr)];
+  802849:	49 bd 00 00 00 00 00 	movabs $0x10000000000,%r13
+  802850:	01 00 00 
+  802853:	4d 89 e6             	mov    %r12,%r14
+  802856:	49 89 fc             	mov    %rdi,%r12
+  802859:	e9 19 01 00 00       	jmp    802977 <foreach_shared_region+0x148>
+  80285e:	48 89 5d b0          	mov    %rbx,-0x50(%rbp)
+  802862:	4c 89 75 a8          	mov    %r14,-0x58(%rbp)
+  802866:	eb 52                	jmp    8028ba <foreach_shared_region+0x8b>
+                for (int ptei = 0; ptei < PT_ENTRY_COUNT; ptei++) {
+  802868:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  80286f:	48 81 fb 00 00 20 00 	cmp    $0x200000,%rbx
+  802876:	74 2e                	je     8028a6 <foreach_shared_region+0x77>
+                    uintptr_t pte_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, pdei, ptei, 0);
+  802878:	48 89 df             	mov    %rbx,%rdi
+  80287b:	4c 09 f7             	or     %r14,%rdi
+                    pte_t pte = uvpt[VPT(pte_addr)];
+  80287e:	48 89 f8             	mov    %rdi,%rax
+  802881:	48 c1 e8 0c          	shr    $0xc,%rax
+  802885:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+                    if ((pte & PTE_P) && (pte & PTE_SHARE)) {
+  80288a:	25 01 04 00 00       	and    $0x401,%eax
+  80288f:	48 3d 01 04 00 00    	cmp    $0x401,%rax
+  802895:	75 d1                	jne    802868 <foreach_shared_region+0x39>
+                        fun((void*)pte_addr, (void*)(pte_addr + PAGE_SIZE), arg);
+  802897:	48 8d b7 00 10 00 00 	lea    0x1000(%rdi),%rsi
+  80289e:	4c 89 fa             	mov    %r15,%rdx
+  8028a1:	41 ff d4             	call   *%r12
+  8028a4:	eb c2                	jmp    802868 <foreach_shared_region+0x39>
+            for (int pdei = 0; pdei < PD_ENTRY_COUNT; pdei++) {
+  8028a6:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  8028ad:	00 
+  8028ae:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8028b2:	48 3d 00 00 00 40    	cmp    $0x40000000,%rax
+  8028b8:	74 46                	je     802900 <foreach_shared_region+0xd1>
+                uintptr_t pde_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, pdei, 0, 0);
+  8028ba:	4c 8b 75 c8          	mov    -0x38(%rbp),%r14
+  8028be:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8028c2:	49 09 c6             	or     %rax,%r14
+                pde_t pde = uvpd[VPD(pde_addr)];
+  8028c5:	4c 89 f0             	mov    %r14,%rax
+  8028c8:	48 c1 e8 15          	shr    $0x15,%rax
+  8028cc:	48 b9 00 00 00 80 00 	movabs $0x10080000000,%rcx
+  8028d3:	01 00 00 
+  8028d6:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+                if (!(pde & PTE_P)) {
+  8028da:	a8 01                	test   $0x1,%al
+  8028dc:	74 c8                	je     8028a6 <foreach_shared_region+0x77>
+                if (pde & PTE_PS) {
+  8028de:	48 89 c3             	mov    %rax,%rbx
+  8028e1:	81 e3 80 00 00 00    	and    $0x80,%ebx
+  8028e7:	74 8f                	je     802878 <foreach_shared_region+0x49>
+                    if (pde & PTE_SHARE) {
+  8028e9:	f6 c4 04             	test   $0x4,%ah
+  8028ec:	74 b8                	je     8028a6 <foreach_shared_region+0x77>
+                        fun((void*)pde_addr, (void*)(pde_addr + 1024 * 1024 * 2), arg);
+  8028ee:	49 8d b6 00 00 20 00 	lea    0x200000(%r14),%rsi
+  8028f5:	4c 89 fa             	mov    %r15,%rdx
+  8028f8:	4c 89 f7             	mov    %r14,%rdi
+  8028fb:	41 ff d4             	call   *%r12
+  8028fe:	eb a6                	jmp    8028a6 <foreach_shared_region+0x77>
+  802900:	48 8b 5d b0          	mov    -0x50(%rbp),%rbx
+  802904:	4c 8b 75 a8          	mov    -0x58(%rbp),%r14
+        for (int pdpei = 0; pdpei < PDP_ENTRY_COUNT; pdpei++) {
+  802908:	48 81 c3 00 00 00 40 	add    $0x40000000,%rbx
+  80290f:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802916:	00 00 00 
+  802919:	48 39 c3             	cmp    %rax,%rbx
+  80291c:	74 4c                	je     80296a <foreach_shared_region+0x13b>
+            uintptr_t pdpe_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, 0, 0, 0);
+  80291e:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802922:	48 09 d8             	or     %rbx,%rax
+  802925:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+            pdpe_t pdpe = uvpdp[VPDP(pdpe_addr)];
+  802929:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80292d:	48 b9 00 00 40 80 00 	movabs $0x10080400000,%rcx
+  802934:	01 00 00 
+  802937:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+            if (!(pdpe & PTE_P)) {
+  80293b:	a8 01                	test   $0x1,%al
+  80293d:	74 c9                	je     802908 <foreach_shared_region+0xd9>
+            if (pdpe & PTE_PS) {
+  80293f:	48 89 c1             	mov    %rax,%rcx
+  802942:	81 e1 80 00 00 00    	and    $0x80,%ecx
+  802948:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  80294c:	0f 84 0c ff ff ff    	je     80285e <foreach_shared_region+0x2f>
+                if (pdpe & PTE_SHARE) {
+  802952:	f6 c4 04             	test   $0x4,%ah
+  802955:	74 b1                	je     802908 <foreach_shared_region+0xd9>
+                    fun((void*)pdpe_addr, (void*)(pdpe_addr + 1024 * 1024 * 1024), arg); 
+  802957:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  80295b:	48 8d b7 00 00 00 40 	lea    0x40000000(%rdi),%rsi
+  802962:	4c 89 fa             	mov    %r15,%rdx
+  802965:	41 ff d4             	call   *%r12
+  802968:	eb 9e                	jmp    802908 <foreach_shared_region+0xd9>
+    for (int pml4ei = 0; pml4ei < PML4_ENTRY_COUNT; pml4ei++) {
+  80296a:	49 83 c6 01          	add    $0x1,%r14
+  80296e:	49 81 fe 00 02 00 00 	cmp    $0x200,%r14
+  802975:	74 24                	je     80299b <foreach_shared_region+0x16c>
+        pml4e_t pml4e = uvpml4[VPML4(pml4_addr)];
+  802977:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  80297e:	01 00 00 
+  802981:	4a 8b 04 f0          	mov    (%rax,%r14,8),%rax
+        if (!(pml4e & PTE_P)) {
+  802985:	a8 01                	test   $0x1,%al
+  802987:	74 e1                	je     80296a <foreach_shared_region+0x13b>
+  802989:	4c 89 f0             	mov    %r14,%rax
+  80298c:	48 c1 e0 27          	shl    $0x27,%rax
+  802990:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  802994:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802999:	eb 83                	jmp    80291e <foreach_shared_region+0xef>
+            }
+        }
+    }
+    
+    return 0;
+}
+  80299b:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029a0:	48 83 c4 38          	add    $0x38,%rsp
+  8029a4:	5b                   	pop    %rbx
+  8029a5:	41 5c                	pop    %r12
+  8029a7:	41 5d                	pop    %r13
+  8029a9:	41 5e                	pop    %r14
+  8029ab:	41 5f                	pop    %r15
+  8029ad:	5d                   	pop    %rbp
+  8029ae:	c3                   	ret
+
+00000000008029af <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  8029af:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029b4:	c3                   	ret
+
+00000000008029b5 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  8029b5:	55                   	push   %rbp
+  8029b6:	48 89 e5             	mov    %rsp,%rbp
+  8029b9:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  8029bc:	48 be 14 35 80 00 00 	movabs $0x803514,%rsi
+  8029c3:	00 00 00 
+  8029c6:	48 b8 99 0c 80 00 00 	movabs $0x800c99,%rax
+  8029cd:	00 00 00 
+  8029d0:	ff d0                	call   *%rax
+    return 0;
+}
+  8029d2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029d7:	5d                   	pop    %rbp
+  8029d8:	c3                   	ret
+
+00000000008029d9 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8029d9:	55                   	push   %rbp
+  8029da:	48 89 e5             	mov    %rsp,%rbp
+  8029dd:	41 57                	push   %r15
+  8029df:	41 56                	push   %r14
+  8029e1:	41 55                	push   %r13
+  8029e3:	41 54                	push   %r12
+  8029e5:	53                   	push   %rbx
+  8029e6:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  8029ed:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  8029f4:	48 85 d2             	test   %rdx,%rdx
+  8029f7:	74 7a                	je     802a73 <devcons_write+0x9a>
+  8029f9:	49 89 d6             	mov    %rdx,%r14
+  8029fc:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802a02:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  802a07:	49 bf 93 0e 80 00 00 	movabs $0x800e93,%r15
+  802a0e:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  802a11:	4c 89 f3             	mov    %r14,%rbx
+  802a14:	48 29 f3             	sub    %rsi,%rbx
+  802a17:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802a1c:	48 39 c3             	cmp    %rax,%rbx
+  802a1f:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  802a23:	4c 63 eb             	movslq %ebx,%r13
+  802a26:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  802a2d:	48 01 c6             	add    %rax,%rsi
+  802a30:	4c 89 ea             	mov    %r13,%rdx
+  802a33:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802a3a:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  802a3d:	4c 89 ee             	mov    %r13,%rsi
+  802a40:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802a47:	48 b8 c0 10 80 00 00 	movabs $0x8010c0,%rax
+  802a4e:	00 00 00 
+  802a51:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  802a53:	41 01 dc             	add    %ebx,%r12d
+  802a56:	49 63 f4             	movslq %r12d,%rsi
+  802a59:	4c 39 f6             	cmp    %r14,%rsi
+  802a5c:	72 b3                	jb     802a11 <devcons_write+0x38>
+    return res;
+  802a5e:	49 63 c4             	movslq %r12d,%rax
+}
+  802a61:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  802a68:	5b                   	pop    %rbx
+  802a69:	41 5c                	pop    %r12
+  802a6b:	41 5d                	pop    %r13
+  802a6d:	41 5e                	pop    %r14
+  802a6f:	41 5f                	pop    %r15
+  802a71:	5d                   	pop    %rbp
+  802a72:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  802a73:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802a79:	eb e3                	jmp    802a5e <devcons_write+0x85>
+
+0000000000802a7b <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  802a7b:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  802a7e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a83:	48 85 c0             	test   %rax,%rax
+  802a86:	74 55                	je     802add <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  802a88:	55                   	push   %rbp
+  802a89:	48 89 e5             	mov    %rsp,%rbp
+  802a8c:	41 55                	push   %r13
+  802a8e:	41 54                	push   %r12
+  802a90:	53                   	push   %rbx
+  802a91:	48 83 ec 08          	sub    $0x8,%rsp
+  802a95:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  802a98:	48 bb ed 10 80 00 00 	movabs $0x8010ed,%rbx
+  802a9f:	00 00 00 
+  802aa2:	49 bc ba 11 80 00 00 	movabs $0x8011ba,%r12
+  802aa9:	00 00 00 
+  802aac:	eb 03                	jmp    802ab1 <devcons_read+0x36>
+  802aae:	41 ff d4             	call   *%r12
+  802ab1:	ff d3                	call   *%rbx
+  802ab3:	85 c0                	test   %eax,%eax
+  802ab5:	74 f7                	je     802aae <devcons_read+0x33>
+    if (c < 0) return c;
+  802ab7:	48 63 d0             	movslq %eax,%rdx
+  802aba:	78 13                	js     802acf <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  802abc:	ba 00 00 00 00       	mov    $0x0,%edx
+  802ac1:	83 f8 04             	cmp    $0x4,%eax
+  802ac4:	74 09                	je     802acf <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  802ac6:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  802aca:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  802acf:	48 89 d0             	mov    %rdx,%rax
+  802ad2:	48 83 c4 08          	add    $0x8,%rsp
+  802ad6:	5b                   	pop    %rbx
+  802ad7:	41 5c                	pop    %r12
+  802ad9:	41 5d                	pop    %r13
+  802adb:	5d                   	pop    %rbp
+  802adc:	c3                   	ret
+  802add:	48 89 d0             	mov    %rdx,%rax
+  802ae0:	c3                   	ret
+
+0000000000802ae1 <cputchar>:
+cputchar(int ch) {
+  802ae1:	55                   	push   %rbp
+  802ae2:	48 89 e5             	mov    %rsp,%rbp
+  802ae5:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  802ae9:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  802aed:	be 01 00 00 00       	mov    $0x1,%esi
+  802af2:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  802af6:	48 b8 c0 10 80 00 00 	movabs $0x8010c0,%rax
+  802afd:	00 00 00 
+  802b00:	ff d0                	call   *%rax
+}
+  802b02:	c9                   	leave
+  802b03:	c3                   	ret
+
+0000000000802b04 <getchar>:
+getchar(void) {
+  802b04:	55                   	push   %rbp
+  802b05:	48 89 e5             	mov    %rsp,%rbp
+  802b08:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  802b0c:	ba 01 00 00 00       	mov    $0x1,%edx
+  802b11:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  802b15:	bf 00 00 00 00       	mov    $0x0,%edi
+  802b1a:	48 b8 28 1a 80 00 00 	movabs $0x801a28,%rax
+  802b21:	00 00 00 
+  802b24:	ff d0                	call   *%rax
+  802b26:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  802b28:	85 c0                	test   %eax,%eax
+  802b2a:	78 06                	js     802b32 <getchar+0x2e>
+  802b2c:	74 08                	je     802b36 <getchar+0x32>
+  802b2e:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  802b32:	89 d0                	mov    %edx,%eax
+  802b34:	c9                   	leave
+  802b35:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  802b36:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  802b3b:	eb f5                	jmp    802b32 <getchar+0x2e>
+
+0000000000802b3d <iscons>:
+iscons(int fdnum) {
+  802b3d:	55                   	push   %rbp
+  802b3e:	48 89 e5             	mov    %rsp,%rbp
+  802b41:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  802b45:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802b49:	48 b8 45 17 80 00 00 	movabs $0x801745,%rax
+  802b50:	00 00 00 
+  802b53:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802b55:	85 c0                	test   %eax,%eax
+  802b57:	78 18                	js     802b71 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  802b59:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802b5d:	48 b8 a0 40 80 00 00 	movabs $0x8040a0,%rax
+  802b64:	00 00 00 
+  802b67:	8b 00                	mov    (%rax),%eax
+  802b69:	39 02                	cmp    %eax,(%rdx)
+  802b6b:	0f 94 c0             	sete   %al
+  802b6e:	0f b6 c0             	movzbl %al,%eax
+}
+  802b71:	c9                   	leave
+  802b72:	c3                   	ret
+
+0000000000802b73 <opencons>:
+opencons(void) {
+  802b73:	55                   	push   %rbp
+  802b74:	48 89 e5             	mov    %rsp,%rbp
+  802b77:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802b7b:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  802b7f:	48 b8 2b 17 80 00 00 	movabs $0x80172b,%rax
+  802b86:	00 00 00 
+  802b89:	ff d0                	call   *%rax
+  802b8b:	85 c0                	test   %eax,%eax
+  802b8d:	78 49                	js     802bd8 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  802b8f:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802b94:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802b99:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  802b9d:	bf 00 00 00 00       	mov    $0x0,%edi
+  802ba2:	48 b8 49 12 80 00 00 	movabs $0x801249,%rax
+  802ba9:	00 00 00 
+  802bac:	ff d0                	call   *%rax
+  802bae:	85 c0                	test   %eax,%eax
+  802bb0:	78 26                	js     802bd8 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  802bb2:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802bb6:	a1 a0 40 80 00 00 00 	movabs 0x8040a0,%eax
+  802bbd:	00 00 
+  802bbf:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  802bc1:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802bc5:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  802bcc:	48 b8 84 16 80 00 00 	movabs $0x801684,%rax
+  802bd3:	00 00 00 
+  802bd6:	ff d0                	call   *%rax
+}
+  802bd8:	c9                   	leave
+  802bd9:	c3                   	ret
+
+0000000000802bda <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  802bda:	55                   	push   %rbp
+  802bdb:	48 89 e5             	mov    %rsp,%rbp
+  802bde:	41 55                	push   %r13
+  802be0:	41 54                	push   %r12
+  802be2:	53                   	push   %rbx
+  802be3:	48 83 ec 08          	sub    $0x8,%rsp
+  802be7:	49 89 fc             	mov    %rdi,%r12
+  802bea:	48 89 f7             	mov    %rsi,%rdi
+  802bed:	48 89 d3             	mov    %rdx,%rbx
+  802bf0:	49 89 cd             	mov    %rcx,%r13
+    // LAB 9: Your code here:
+    int res = sys_ipc_recv(!pg ? (void*)MAX_USER_ADDRESS : pg, !size ? 0 : *size);
+  802bf3:	be 00 00 00 00       	mov    $0x0,%esi
+  802bf8:	48 85 d2             	test   %rdx,%rdx
+  802bfb:	74 03                	je     802c00 <ipc_recv+0x26>
+  802bfd:	48 8b 32             	mov    (%rdx),%rsi
+  802c00:	48 85 ff             	test   %rdi,%rdi
+  802c03:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802c0a:	00 00 00 
+  802c0d:	48 0f 44 f8          	cmove  %rax,%rdi
+  802c11:	48 b8 1b 16 80 00 00 	movabs $0x80161b,%rax
+  802c18:	00 00 00 
+  802c1b:	ff d0                	call   *%rax
+    if (res < 0) {
+  802c1d:	85 c0                	test   %eax,%eax
+  802c1f:	78 66                	js     802c87 <ipc_recv+0xad>
+        if (size) {
+            *size = 0;
+        }
+        return res;
+    }
+    if (from_env_store) {
+  802c21:	4d 85 e4             	test   %r12,%r12
+  802c24:	74 14                	je     802c3a <ipc_recv+0x60>
+        *from_env_store = thisenv->env_ipc_from;
+  802c26:	48 a1 00 50 c0 00 00 	movabs 0xc05000,%rax
+  802c2d:	00 00 00 
+  802c30:	8b 80 ac 01 00 00    	mov    0x1ac(%rax),%eax
+  802c36:	41 89 04 24          	mov    %eax,(%r12)
+    }
+    if (perm_store) {
+  802c3a:	4d 85 ed             	test   %r13,%r13
+  802c3d:	74 14                	je     802c53 <ipc_recv+0x79>
+        *perm_store = thisenv->env_ipc_perm;
+  802c3f:	48 a1 00 50 c0 00 00 	movabs 0xc05000,%rax
+  802c46:	00 00 00 
+  802c49:	8b 80 b0 01 00 00    	mov    0x1b0(%rax),%eax
+  802c4f:	41 89 45 00          	mov    %eax,0x0(%r13)
+    }
+    if (size) {
+  802c53:	48 85 db             	test   %rbx,%rbx
+  802c56:	74 14                	je     802c6c <ipc_recv+0x92>
+        *size = thisenv->env_ipc_maxsz;
+  802c58:	48 a1 00 50 c0 00 00 	movabs 0xc05000,%rax
+  802c5f:	00 00 00 
+  802c62:	48 8b 80 a0 01 00 00 	mov    0x1a0(%rax),%rax
+  802c69:	48 89 03             	mov    %rax,(%rbx)
+    }
+    return thisenv->env_ipc_value;
+  802c6c:	48 a1 00 50 c0 00 00 	movabs 0xc05000,%rax
+  802c73:	00 00 00 
+  802c76:	8b 80 a8 01 00 00    	mov    0x1a8(%rax),%eax
+}
+  802c7c:	48 83 c4 08          	add    $0x8,%rsp
+  802c80:	5b                   	pop    %rbx
+  802c81:	41 5c                	pop    %r12
+  802c83:	41 5d                	pop    %r13
+  802c85:	5d                   	pop    %rbp
+  802c86:	c3                   	ret
+        if (from_env_store) {
+  802c87:	4d 85 e4             	test   %r12,%r12
+  802c8a:	74 08                	je     802c94 <ipc_recv+0xba>
+            *from_env_store = 0;
+  802c8c:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  802c93:	00 
+        if (perm_store) {
+  802c94:	4d 85 ed             	test   %r13,%r13
+  802c97:	74 08                	je     802ca1 <ipc_recv+0xc7>
+            *perm_store = 0;
+  802c99:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  802ca0:	00 
+        if (size) {
+  802ca1:	48 85 db             	test   %rbx,%rbx
+  802ca4:	74 d6                	je     802c7c <ipc_recv+0xa2>
+            *size = 0;
+  802ca6:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  802cad:	eb cd                	jmp    802c7c <ipc_recv+0xa2>
+
+0000000000802caf <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  802caf:	55                   	push   %rbp
+  802cb0:	48 89 e5             	mov    %rsp,%rbp
+  802cb3:	41 57                	push   %r15
+  802cb5:	41 56                	push   %r14
+  802cb7:	41 55                	push   %r13
+  802cb9:	41 54                	push   %r12
+  802cbb:	53                   	push   %rbx
+  802cbc:	48 83 ec 18          	sub    $0x18,%rsp
+  802cc0:	41 89 fd             	mov    %edi,%r13d
+  802cc3:	89 75 cc             	mov    %esi,-0x34(%rbp)
+  802cc6:	49 89 cc             	mov    %rcx,%r12
+  802cc9:	44 89 45 c8          	mov    %r8d,-0x38(%rbp)
+    // LAB 9: Your code here:
+    int res = 0;
+    while ((res = sys_ipc_try_send(to_env, val, !pg ? (void*)MAX_USER_ADDRESS : pg, size, perm)) < 0) {
+  802ccd:	48 85 d2             	test   %rdx,%rdx
+  802cd0:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802cd7:	00 00 00 
+  802cda:	48 0f 45 c2          	cmovne %rdx,%rax
+  802cde:	48 89 c3             	mov    %rax,%rbx
+  802ce1:	49 be ef 15 80 00 00 	movabs $0x8015ef,%r14
+  802ce8:	00 00 00 
+        if (res != -E_IPC_NOT_RECV) {
+            panic("sys_ipc_try_send failed: %i", res);
+        }
+        sys_yield();
+  802ceb:	49 bf ba 11 80 00 00 	movabs $0x8011ba,%r15
+  802cf2:	00 00 00 
+    while ((res = sys_ipc_try_send(to_env, val, !pg ? (void*)MAX_USER_ADDRESS : pg, size, perm)) < 0) {
+  802cf5:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  802cf8:	44 8b 45 c8          	mov    -0x38(%rbp),%r8d
+  802cfc:	4c 89 e1             	mov    %r12,%rcx
+  802cff:	48 89 da             	mov    %rbx,%rdx
+  802d02:	44 89 ef             	mov    %r13d,%edi
+  802d05:	41 ff d6             	call   *%r14
+  802d08:	85 c0                	test   %eax,%eax
+  802d0a:	79 37                	jns    802d43 <ipc_send+0x94>
+        if (res != -E_IPC_NOT_RECV) {
+  802d0c:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  802d0f:	75 05                	jne    802d16 <ipc_send+0x67>
+        sys_yield();
+  802d11:	41 ff d7             	call   *%r15
+  802d14:	eb df                	jmp    802cf5 <ipc_send+0x46>
+            panic("sys_ipc_try_send failed: %i", res);
+  802d16:	89 c1                	mov    %eax,%ecx
+  802d18:	48 ba 20 35 80 00 00 	movabs $0x803520,%rdx
+  802d1f:	00 00 00 
+  802d22:	be 40 00 00 00       	mov    $0x40,%esi
+  802d27:	48 bf 3c 35 80 00 00 	movabs $0x80353c,%rdi
+  802d2e:	00 00 00 
+  802d31:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d36:	49 b8 24 02 80 00 00 	movabs $0x800224,%r8
+  802d3d:	00 00 00 
+  802d40:	41 ff d0             	call   *%r8
+    }
+    return;
+}
+  802d43:	48 83 c4 18          	add    $0x18,%rsp
+  802d47:	5b                   	pop    %rbx
+  802d48:	41 5c                	pop    %r12
+  802d4a:	41 5d                	pop    %r13
+  802d4c:	41 5e                	pop    %r14
+  802d4e:	41 5f                	pop    %r15
+  802d50:	5d                   	pop    %rbp
+  802d51:	c3                   	ret
+
+0000000000802d52 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  802d52:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  802d57:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  802d5e:	00 00 00 
+  802d61:	48 69 d0 d0 01 00 00 	imul   $0x1d0,%rax,%rdx
+  802d68:	48 01 ca             	add    %rcx,%rdx
+  802d6b:	8b 92 e8 00 00 00    	mov    0xe8(%rdx),%edx
+  802d71:	39 fa                	cmp    %edi,%edx
+  802d73:	74 12                	je     802d87 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  802d75:	48 83 c0 01          	add    $0x1,%rax
+  802d79:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  802d7f:	75 e0                	jne    802d61 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  802d81:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802d86:	c3                   	ret
+            return envs[i].env_id;
+  802d87:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+  802d8e:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  802d95:	00 00 00 
+  802d98:	48 01 d0             	add    %rdx,%rax
+  802d9b:	8b 80 e0 00 00 00    	mov    0xe0(%rax),%eax
+  802da1:	c3                   	ret
+  802da2:	66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+
+0000000000802da8 <__rodata_start>:
+  802da8:	4d 61                	rex.WRB (bad)
+  802daa:	6b 69 6e 67          	imul   $0x67,0x6e(%rcx),%ebp
+  802dae:	20 73 75             	and    %dh,0x75(%rbx)
+  802db1:	72 65                	jb     802e18 <__rodata_start+0x70>
+  802db3:	20 62 73             	and    %ah,0x73(%rdx)
+  802db6:	73 20                	jae    802dd8 <__rodata_start+0x30>
+  802db8:	77 6f                	ja     802e29 <__rodata_start+0x81>
+  802dba:	72 6b                	jb     802e27 <__rodata_start+0x7f>
+  802dbc:	73 20                	jae    802dde <__rodata_start+0x36>
+  802dbe:	72 69                	jb     802e29 <__rodata_start+0x81>
+  802dc0:	67 68 74 2e 2e 2e    	addr32 push $0x2e2e2e74
+  802dc6:	0a 00                	or     (%rax),%al
+  802dc8:	62                   	(bad)
+  802dc9:	69 67 61 72 72 61 79 	imul   $0x79617272,0x61(%rdi),%esp
+  802dd0:	5b                   	pop    %rbx
+  802dd1:	25 64 5d 20 64       	and    $0x64205d64,%eax
+  802dd6:	69 64 6e 27 74 20 68 	imul   $0x6f682074,0x27(%rsi,%rbp,2),%esp
+  802ddd:	6f 
+  802dde:	6c                   	insb   (%dx),%es:(%rdi)
+  802ddf:	64 20 69 74          	and    %ch,%fs:0x74(%rcx)
+  802de3:	73 20                	jae    802e05 <__rodata_start+0x5d>
+  802de5:	76 61                	jbe    802e48 <__rodata_start+0xa0>
+  802de7:	6c                   	insb   (%dx),%es:(%rdi)
+  802de8:	75 65                	jne    802e4f <__rodata_start+0xa7>
+  802dea:	21 0a                	and    %ecx,(%rdx)
+  802dec:	00 00                	add    %al,(%rax)
+  802dee:	00 00                	add    %al,(%rax)
+  802df0:	59                   	pop    %rcx
+  802df1:	65 73 2c             	gs jae 802e20 <__rodata_start+0x78>
+  802df4:	20 67 6f             	and    %ah,0x6f(%rdi)
+  802df7:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802df8:	64 2e 20 20          	fs and %ah,%fs:(%rax)
+  802dfc:	4e 6f                	rex.WRX outsl %ds:(%rsi),(%dx)
+  802dfe:	77 20                	ja     802e20 <__rodata_start+0x78>
+  802e00:	64 6f                	outsl  %fs:(%rsi),(%dx)
+  802e02:	69 6e 67 20 61 20 77 	imul   $0x77206120,0x67(%rsi),%ebp
+  802e09:	69 6c 64 20 77 72 69 	imul   $0x74697277,0x20(%rsp,%riz,2),%ebp
+  802e10:	74 
+  802e11:	65 20 6f 66          	and    %ch,%gs:0x66(%rdi)
+  802e15:	66 20 74 68 65       	data16 and %dh,0x65(%rax,%rbp,2)
+  802e1a:	20 65 6e             	and    %ah,0x6e(%rbp)
+  802e1d:	64 2e 2e 2e 0a 00    	fs cs cs or %fs:(%rax),%al
+  802e23:	62                   	(bad)
+  802e24:	69 67 61 72 72 61 79 	imul   $0x79617272,0x61(%rdi),%esp
+  802e2b:	5b                   	pop    %rbx
+  802e2c:	25 64 5d 20 69       	and    $0x69205d64,%eax
+  802e31:	73 6e                	jae    802ea1 <__rodata_start+0xf9>
+  802e33:	27                   	(bad)
+  802e34:	74 20                	je     802e56 <__rodata_start+0xae>
+  802e36:	63 6c 65 61          	movsxd 0x61(%rbp,%riz,2),%ebp
+  802e3a:	72 65                	jb     802ea1 <__rodata_start+0xf9>
+  802e3c:	64 21 0a             	and    %ecx,%fs:(%rdx)
+  802e3f:	00 75 73             	add    %dh,0x73(%rbp)
+  802e42:	65 72 2f             	gs jb  802e74 <__rodata_start+0xcc>
+  802e45:	74 65                	je     802eac <__rodata_start+0x104>
+  802e47:	73 74                	jae    802ebd <__rodata_start+0x115>
+  802e49:	62 73                	(bad)
+  802e4b:	73 2e                	jae    802e7b <__rodata_start+0xd3>
+  802e4d:	63 00                	movsxd (%rax),%eax
+  802e4f:	53                   	push   %rbx
+  802e50:	48                   	rex.W
+  802e51:	4f 55                	rex.WRXB push %r13
+  802e53:	4c                   	rex.WR
+  802e54:	44 20 48 41          	and    %r9b,0x41(%rax)
+  802e58:	56                   	push   %rsi
+  802e59:	45 20 54 52 41       	and    %r10b,0x41(%r10,%rdx,2)
+  802e5e:	50                   	push   %rax
+  802e5f:	50                   	push   %rax
+  802e60:	45                   	rex.RB
+  802e61:	44 21 21             	and    %r12d,(%rcx)
+  802e64:	21 00                	and    %eax,(%rax)
+  802e66:	3c 75                	cmp    $0x75,%al
+  802e68:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802e69:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  802e6d:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802e6e:	3e 00 5b 25          	ds add %bl,0x25(%rbx)
+  802e72:	30 38                	xor    %bh,(%rax)
+  802e74:	78 5d                	js     802ed3 <__rodata_start+0x12b>
+  802e76:	20 75 73             	and    %dh,0x73(%rbp)
+  802e79:	65 72 20             	gs jb  802e9c <__rodata_start+0xf4>
+  802e7c:	70 61                	jo     802edf <__rodata_start+0x137>
+  802e7e:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802e7f:	69 63 20 69 6e 20 25 	imul   $0x25206e69,0x20(%rbx),%esp
+  802e86:	73 20                	jae    802ea8 <__rodata_start+0x100>
+  802e88:	61                   	(bad)
+  802e89:	74 20                	je     802eab <__rodata_start+0x103>
+  802e8b:	25 73 3a 25 64       	and    $0x64253a73,%eax
+  802e90:	3a 20                	cmp    (%rax),%ah
+  802e92:	00 30                	add    %dh,(%rax)
+  802e94:	31 32                	xor    %esi,(%rdx)
+  802e96:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  802e9d:	41                   	rex.B
+  802e9e:	42                   	rex.X
+  802e9f:	43                   	rex.XB
+  802ea0:	44                   	rex.R
+  802ea1:	45                   	rex.RB
+  802ea2:	46 00 30             	rex.RX add %r14b,(%rax)
+  802ea5:	31 32                	xor    %esi,(%rdx)
+  802ea7:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  802eae:	61                   	(bad)
+  802eaf:	62 63 64 65 66       	(bad)
+  802eb4:	00 28                	add    %ch,(%rax)
+  802eb6:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802eb7:	75 6c                	jne    802f25 <__rodata_start+0x17d>
+  802eb9:	6c                   	insb   (%dx),%es:(%rdi)
+  802eba:	29 00                	sub    %eax,(%rax)
+  802ebc:	65 72 72             	gs jb  802f31 <__rodata_start+0x189>
+  802ebf:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802ec0:	72 20                	jb     802ee2 <__rodata_start+0x13a>
+  802ec2:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  802ec7:	73 70                	jae    802f39 <__rodata_start+0x191>
+  802ec9:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  802ecd:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  802ed4:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802ed5:	72 00                	jb     802ed7 <__rodata_start+0x12f>
+  802ed7:	62 61 64 20 65       	(bad)
+  802edc:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802edd:	76 69                	jbe    802f48 <__rodata_start+0x1a0>
+  802edf:	72 6f                	jb     802f50 <__rodata_start+0x1a8>
+  802ee1:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802ee2:	6d                   	insl   (%dx),%es:(%rdi)
+  802ee3:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  802ee5:	74 00                	je     802ee7 <__rodata_start+0x13f>
+  802ee7:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  802eee:	20 70 61             	and    %dh,0x61(%rax)
+  802ef1:	72 61                	jb     802f54 <__rodata_start+0x1ac>
+  802ef3:	6d                   	insl   (%dx),%es:(%rdi)
+  802ef4:	65 74 65             	gs je  802f5c <__rodata_start+0x1b4>
+  802ef7:	72 00                	jb     802ef9 <__rodata_start+0x151>
+  802ef9:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802efa:	75 74                	jne    802f70 <__rodata_start+0x1c8>
+  802efc:	20 6f 66             	and    %ch,0x66(%rdi)
+  802eff:	20 6d 65             	and    %ch,0x65(%rbp)
+  802f02:	6d                   	insl   (%dx),%es:(%rdi)
+  802f03:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802f04:	72 79                	jb     802f7f <__rodata_start+0x1d7>
+  802f06:	00 6f 75             	add    %ch,0x75(%rdi)
+  802f09:	74 20                	je     802f2b <__rodata_start+0x183>
+  802f0b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802f0c:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  802f10:	76 69                	jbe    802f7b <__rodata_start+0x1d3>
+  802f12:	72 6f                	jb     802f83 <__rodata_start+0x1db>
+  802f14:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802f15:	6d                   	insl   (%dx),%es:(%rdi)
+  802f16:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  802f18:	74 73                	je     802f8d <__rodata_start+0x1e5>
+  802f1a:	00 63 6f             	add    %ah,0x6f(%rbx)
+  802f1d:	72 72                	jb     802f91 <__rodata_start+0x1e9>
+  802f1f:	75 70                	jne    802f91 <__rodata_start+0x1e9>
+  802f21:	74 65                	je     802f88 <__rodata_start+0x1e0>
+  802f23:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  802f28:	75 67                	jne    802f91 <__rodata_start+0x1e9>
+  802f2a:	20 69 6e             	and    %ch,0x6e(%rcx)
+  802f2d:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  802f2f:	00 73 65             	add    %dh,0x65(%rbx)
+  802f32:	67 6d                	insl   (%dx),%es:(%edi)
+  802f34:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  802f36:	74 61                	je     802f99 <__rodata_start+0x1f1>
+  802f38:	74 69                	je     802fa3 <__rodata_start+0x1fb>
+  802f3a:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802f3b:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802f3c:	20 66 61             	and    %ah,0x61(%rsi)
+  802f3f:	75 6c                	jne    802fad <__rodata_start+0x205>
+  802f41:	74 00                	je     802f43 <__rodata_start+0x19b>
+  802f43:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  802f4a:	20 45 4c             	and    %al,0x4c(%rbp)
+  802f4d:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  802f51:	61                   	(bad)
+  802f52:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  802f57:	20 73 75             	and    %dh,0x75(%rbx)
+  802f5a:	63 68 20             	movsxd 0x20(%rax),%ebp
+  802f5d:	73 79                	jae    802fd8 <__rodata_start+0x230>
+  802f5f:	73 74                	jae    802fd5 <__rodata_start+0x22d>
+  802f61:	65 6d                	gs insl (%dx),%es:(%rdi)
+  802f63:	20 63 61             	and    %ah,0x61(%rbx)
+  802f66:	6c                   	insb   (%dx),%es:(%rdi)
+  802f67:	6c                   	insb   (%dx),%es:(%rdi)
+  802f68:	00 65 6e             	add    %ah,0x6e(%rbp)
+  802f6b:	74 72                	je     802fdf <__rodata_start+0x237>
+  802f6d:	79 20                	jns    802f8f <__rodata_start+0x1e7>
+  802f6f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802f70:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802f71:	74 20                	je     802f93 <__rodata_start+0x1eb>
+  802f73:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  802f75:	75 6e                	jne    802fe5 <__rodata_start+0x23d>
+  802f77:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  802f7b:	76 20                	jbe    802f9d <__rodata_start+0x1f5>
+  802f7d:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  802f84:	72 65                	jb     802feb <__rodata_start+0x243>
+  802f86:	63 76 69             	movsxd 0x69(%rsi),%esi
+  802f89:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802f8a:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  802f8e:	65 78 70             	gs js  803001 <__rodata_start+0x259>
+  802f91:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  802f96:	20 65 6e             	and    %ah,0x6e(%rbp)
+  802f99:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  802f9d:	20 66 69             	and    %ah,0x69(%rsi)
+  802fa0:	6c                   	insb   (%dx),%es:(%rdi)
+  802fa1:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  802fa5:	20 66 72             	and    %ah,0x72(%rsi)
+  802fa8:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  802fad:	61                   	(bad)
+  802fae:	63 65 20             	movsxd 0x20(%rbp),%esp
+  802fb1:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802fb2:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802fb3:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  802fb7:	6b 00 74             	imul   $0x74,(%rax),%eax
+  802fba:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802fbb:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802fbc:	20 6d 61             	and    %ch,0x61(%rbp)
+  802fbf:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802fc0:	79 20                	jns    802fe2 <__rodata_start+0x23a>
+  802fc2:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  802fc9:	72 65                	jb     803030 <__rodata_start+0x288>
+  802fcb:	20 6f 70             	and    %ch,0x70(%rdi)
+  802fce:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  802fd0:	00 66 69             	add    %ah,0x69(%rsi)
+  802fd3:	6c                   	insb   (%dx),%es:(%rdi)
+  802fd4:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  802fd8:	20 62 6c             	and    %ah,0x6c(%rdx)
+  802fdb:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802fdc:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  802fdf:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802fe0:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802fe1:	74 20                	je     803003 <__rodata_start+0x25b>
+  802fe3:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  802fe5:	75 6e                	jne    803055 <__rodata_start+0x2ad>
+  802fe7:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  802feb:	76 61                	jbe    80304e <__rodata_start+0x2a6>
+  802fed:	6c                   	insb   (%dx),%es:(%rdi)
+  802fee:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  802ff5:	00 
+  802ff6:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  802ffd:	72 65                	jb     803064 <__rodata_start+0x2bc>
+  802fff:	61                   	(bad)
+  803000:	64 79 20             	fs jns 803023 <__rodata_start+0x27b>
+  803003:	65 78 69             	gs js  80306f <__rodata_start+0x2c7>
+  803006:	73 74                	jae    80307c <__rodata_start+0x2d4>
+  803008:	73 00                	jae    80300a <__rodata_start+0x262>
+  80300a:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80300b:	70 65                	jo     803072 <__rodata_start+0x2ca>
+  80300d:	72 61                	jb     803070 <__rodata_start+0x2c8>
+  80300f:	74 69                	je     80307a <__rodata_start+0x2d2>
+  803011:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803012:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803013:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  803016:	74 20                	je     803038 <__rodata_start+0x290>
+  803018:	73 75                	jae    80308f <__rodata_start+0x2e7>
+  80301a:	70 70                	jo     80308c <__rodata_start+0x2e4>
+  80301c:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80301d:	72 74                	jb     803093 <__rodata_start+0x2eb>
+  80301f:	65 64 00 6f 70       	gs add %ch,%fs:0x70(%rdi)
+  803024:	65 72 61             	gs jb  803088 <__rodata_start+0x2e0>
+  803027:	74 69                	je     803092 <__rodata_start+0x2ea>
+  803029:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80302a:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80302b:	20 69 6e             	and    %ch,0x6e(%rcx)
+  80302e:	74 65                	je     803095 <__rodata_start+0x2ed>
+  803030:	72 72                	jb     8030a4 <__rodata_start+0x2fc>
+  803032:	75 70                	jne    8030a4 <__rodata_start+0x2fc>
+  803034:	74 65                	je     80309b <__rodata_start+0x2f3>
+  803036:	64 00 6e 6f          	add    %ch,%fs:0x6f(%rsi)
+  80303a:	74 20                	je     80305c <__rodata_start+0x2b4>
+  80303c:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  80303e:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80303f:	75 67                	jne    8030a8 <__rodata_start+0x300>
+  803041:	68 20 43 50 55       	push   $0x55504320
+  803046:	20 74 69 6d          	and    %dh,0x6d(%rcx,%rbp,2)
+  80304a:	65 00 66 2e          	add    %ah,%gs:0x2e(%rsi)
+  80304e:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+  803055:	00 
+  803056:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80305d:	00 00 00 
+  803060:	61                   	(bad)
+  803061:	05 80 00 00 00       	add    $0x80,%eax
+  803066:	00 00                	add    %al,(%rax)
+  803068:	a2 0b 80 00 00 00 00 	movabs %al,0x920000000000800b
+  80306f:	00 92 
+  803071:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803077:	00 a2 0b 80 00 00    	add    %ah,0x800b(%rdx)
+  80307d:	00 00                	add    %al,(%rax)
+  80307f:	00 a2 0b 80 00 00    	add    %ah,0x800b(%rdx)
+  803085:	00 00                	add    %al,(%rax)
+  803087:	00 a2 0b 80 00 00    	add    %ah,0x800b(%rdx)
+  80308d:	00 00                	add    %al,(%rax)
+  80308f:	00 a2 0b 80 00 00    	add    %ah,0x800b(%rdx)
+  803095:	00 00                	add    %al,(%rax)
+  803097:	00 80 05 80 00 00    	add    %al,0x8005(%rax)
+  80309d:	00 00                	add    %al,(%rax)
+  80309f:	00 a2 0b 80 00 00    	add    %ah,0x800b(%rdx)
+  8030a5:	00 00                	add    %al,(%rax)
+  8030a7:	00 a2 0b 80 00 00    	add    %ah,0x800b(%rdx)
+  8030ad:	00 00                	add    %al,(%rax)
+  8030af:	00 74 05 80          	add    %dh,-0x80(%rbp,%rax,1)
+  8030b3:	00 00                	add    %al,(%rax)
+  8030b5:	00 00                	add    %al,(%rax)
+  8030b7:	00 ee                	add    %ch,%dh
+  8030b9:	05 80 00 00 00       	add    $0x80,%eax
+  8030be:	00 00                	add    %al,(%rax)
+  8030c0:	a2 0b 80 00 00 00 00 	movabs %al,0x740000000000800b
+  8030c7:	00 74 
+  8030c9:	05 80 00 00 00       	add    $0x80,%eax
+  8030ce:	00 00                	add    %al,(%rax)
+  8030d0:	ba 05 80 00 00       	mov    $0x8005,%edx
+  8030d5:	00 00                	add    %al,(%rax)
+  8030d7:	00 ba 05 80 00 00    	add    %bh,0x8005(%rdx)
+  8030dd:	00 00                	add    %al,(%rax)
+  8030df:	00 ba 05 80 00 00    	add    %bh,0x8005(%rdx)
+  8030e5:	00 00                	add    %al,(%rax)
+  8030e7:	00 ba 05 80 00 00    	add    %bh,0x8005(%rdx)
+  8030ed:	00 00                	add    %al,(%rax)
+  8030ef:	00 ba 05 80 00 00    	add    %bh,0x8005(%rdx)
+  8030f5:	00 00                	add    %al,(%rax)
+  8030f7:	00 ba 05 80 00 00    	add    %bh,0x8005(%rdx)
+  8030fd:	00 00                	add    %al,(%rax)
+  8030ff:	00 ba 05 80 00 00    	add    %bh,0x8005(%rdx)
+  803105:	00 00                	add    %al,(%rax)
+  803107:	00 ba 05 80 00 00    	add    %bh,0x8005(%rdx)
+  80310d:	00 00                	add    %al,(%rax)
+  80310f:	00 ba 05 80 00 00    	add    %bh,0x8005(%rdx)
+  803115:	00 00                	add    %al,(%rax)
+  803117:	00 a2 0b 80 00 00    	add    %ah,0x800b(%rdx)
+  80311d:	00 00                	add    %al,(%rax)
+  80311f:	00 a2 0b 80 00 00    	add    %ah,0x800b(%rdx)
+  803125:	00 00                	add    %al,(%rax)
+  803127:	00 a2 0b 80 00 00    	add    %ah,0x800b(%rdx)
+  80312d:	00 00                	add    %al,(%rax)
+  80312f:	00 a2 0b 80 00 00    	add    %ah,0x800b(%rdx)
+  803135:	00 00                	add    %al,(%rax)
+  803137:	00 a2 0b 80 00 00    	add    %ah,0x800b(%rdx)
+  80313d:	00 00                	add    %al,(%rax)
+  80313f:	00 a2 0b 80 00 00    	add    %ah,0x800b(%rdx)
+  803145:	00 00                	add    %al,(%rax)
+  803147:	00 a2 0b 80 00 00    	add    %ah,0x800b(%rdx)
+  80314d:	00 00                	add    %al,(%rax)
+  80314f:	00 a2 0b 80 00 00    	add    %ah,0x800b(%rdx)
+  803155:	00 00                	add    %al,(%rax)
+  803157:	00 a2 0b 80 00 00    	add    %ah,0x800b(%rdx)
+  80315d:	00 00                	add    %al,(%rax)
+  80315f:	00 a2 0b 80 00 00    	add    %ah,0x800b(%rdx)
+  803165:	00 00                	add    %al,(%rax)
+  803167:	00 a2 0b 80 00 00    	add    %ah,0x800b(%rdx)
+  80316d:	00 00                	add    %al,(%rax)
+  80316f:	00 a2 0b 80 00 00    	add    %ah,0x800b(%rdx)
+  803175:	00 00                	add    %al,(%rax)
+  803177:	00 a2 0b 80 00 00    	add    %ah,0x800b(%rdx)
+  80317d:	00 00                	add    %al,(%rax)
+  80317f:	00 a2 0b 80 00 00    	add    %ah,0x800b(%rdx)
+  803185:	00 00                	add    %al,(%rax)
+  803187:	00 a2 0b 80 00 00    	add    %ah,0x800b(%rdx)
+  80318d:	00 00                	add    %al,(%rax)
+  80318f:	00 a2 0b 80 00 00    	add    %ah,0x800b(%rdx)
+  803195:	00 00                	add    %al,(%rax)
+  803197:	00 a2 0b 80 00 00    	add    %ah,0x800b(%rdx)
+  80319d:	00 00                	add    %al,(%rax)
+  80319f:	00 a2 0b 80 00 00    	add    %ah,0x800b(%rdx)
+  8031a5:	00 00                	add    %al,(%rax)
+  8031a7:	00 a2 0b 80 00 00    	add    %ah,0x800b(%rdx)
+  8031ad:	00 00                	add    %al,(%rax)
+  8031af:	00 a2 0b 80 00 00    	add    %ah,0x800b(%rdx)
+  8031b5:	00 00                	add    %al,(%rax)
+  8031b7:	00 a2 0b 80 00 00    	add    %ah,0x800b(%rdx)
+  8031bd:	00 00                	add    %al,(%rax)
+  8031bf:	00 a2 0b 80 00 00    	add    %ah,0x800b(%rdx)
+  8031c5:	00 00                	add    %al,(%rax)
+  8031c7:	00 a2 0b 80 00 00    	add    %ah,0x800b(%rdx)
+  8031cd:	00 00                	add    %al,(%rax)
+  8031cf:	00 a2 0b 80 00 00    	add    %ah,0x800b(%rdx)
+  8031d5:	00 00                	add    %al,(%rax)
+  8031d7:	00 a2 0b 80 00 00    	add    %ah,0x800b(%rdx)
+  8031dd:	00 00                	add    %al,(%rax)
+  8031df:	00 a2 0b 80 00 00    	add    %ah,0x800b(%rdx)
+  8031e5:	00 00                	add    %al,(%rax)
+  8031e7:	00 a2 0b 80 00 00    	add    %ah,0x800b(%rdx)
+  8031ed:	00 00                	add    %al,(%rax)
+  8031ef:	00 a2 0b 80 00 00    	add    %ah,0x800b(%rdx)
+  8031f5:	00 00                	add    %al,(%rax)
+  8031f7:	00 a2 0b 80 00 00    	add    %ah,0x800b(%rdx)
+  8031fd:	00 00                	add    %al,(%rax)
+  8031ff:	00 a2 0b 80 00 00    	add    %ah,0x800b(%rdx)
+  803205:	00 00                	add    %al,(%rax)
+  803207:	00 c5                	add    %al,%ch
+  803209:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80320f:	00 a2 0b 80 00 00    	add    %ah,0x800b(%rdx)
+  803215:	00 00                	add    %al,(%rax)
+  803217:	00 a2 0b 80 00 00    	add    %ah,0x800b(%rdx)
+  80321d:	00 00                	add    %al,(%rax)
+  80321f:	00 a2 0b 80 00 00    	add    %ah,0x800b(%rdx)
+  803225:	00 00                	add    %al,(%rax)
+  803227:	00 a2 0b 80 00 00    	add    %ah,0x800b(%rdx)
+  80322d:	00 00                	add    %al,(%rax)
+  80322f:	00 a2 0b 80 00 00    	add    %ah,0x800b(%rdx)
+  803235:	00 00                	add    %al,(%rax)
+  803237:	00 a2 0b 80 00 00    	add    %ah,0x800b(%rdx)
+  80323d:	00 00                	add    %al,(%rax)
+  80323f:	00 a2 0b 80 00 00    	add    %ah,0x800b(%rdx)
+  803245:	00 00                	add    %al,(%rax)
+  803247:	00 a2 0b 80 00 00    	add    %ah,0x800b(%rdx)
+  80324d:	00 00                	add    %al,(%rax)
+  80324f:	00 a2 0b 80 00 00    	add    %ah,0x800b(%rdx)
+  803255:	00 00                	add    %al,(%rax)
+  803257:	00 a2 0b 80 00 00    	add    %ah,0x800b(%rdx)
+  80325d:	00 00                	add    %al,(%rax)
+  80325f:	00 11                	add    %dl,(%rcx)
+  803261:	06                   	(bad)
+  803262:	80 00 00             	addb   $0x0,(%rax)
+  803265:	00 00                	add    %al,(%rax)
+  803267:	00 e0                	add    %ah,%al
+  803269:	07                   	(bad)
+  80326a:	80 00 00             	addb   $0x0,(%rax)
+  80326d:	00 00                	add    %al,(%rax)
+  80326f:	00 a2 0b 80 00 00    	add    %ah,0x800b(%rdx)
+  803275:	00 00                	add    %al,(%rax)
+  803277:	00 a2 0b 80 00 00    	add    %ah,0x800b(%rdx)
+  80327d:	00 00                	add    %al,(%rax)
+  80327f:	00 a2 0b 80 00 00    	add    %ah,0x800b(%rdx)
+  803285:	00 00                	add    %al,(%rax)
+  803287:	00 a2 0b 80 00 00    	add    %ah,0x800b(%rdx)
+  80328d:	00 00                	add    %al,(%rax)
+  80328f:	00 40 06             	add    %al,0x6(%rax)
+  803292:	80 00 00             	addb   $0x0,(%rax)
+  803295:	00 00                	add    %al,(%rax)
+  803297:	00 a2 0b 80 00 00    	add    %ah,0x800b(%rdx)
+  80329d:	00 00                	add    %al,(%rax)
+  80329f:	00 a2 0b 80 00 00    	add    %ah,0x800b(%rdx)
+  8032a5:	00 00                	add    %al,(%rax)
+  8032a7:	00 06                	add    %al,(%rsi)
+  8032a9:	06                   	(bad)
+  8032aa:	80 00 00             	addb   $0x0,(%rax)
+  8032ad:	00 00                	add    %al,(%rax)
+  8032af:	00 a2 0b 80 00 00    	add    %ah,0x800b(%rdx)
+  8032b5:	00 00                	add    %al,(%rax)
+  8032b7:	00 a2 0b 80 00 00    	add    %ah,0x800b(%rdx)
+  8032bd:	00 00                	add    %al,(%rax)
+  8032bf:	00 88 09 80 00 00    	add    %cl,0x8009(%rax)
+  8032c5:	00 00                	add    %al,(%rax)
+  8032c7:	00 52 0a             	add    %dl,0xa(%rdx)
+  8032ca:	80 00 00             	addb   $0x0,(%rax)
+  8032cd:	00 00                	add    %al,(%rax)
+  8032cf:	00 a2 0b 80 00 00    	add    %ah,0x800b(%rdx)
+  8032d5:	00 00                	add    %al,(%rax)
+  8032d7:	00 a2 0b 80 00 00    	add    %ah,0x800b(%rdx)
+  8032dd:	00 00                	add    %al,(%rax)
+  8032df:	00 d7                	add    %dl,%bh
+  8032e1:	06                   	(bad)
+  8032e2:	80 00 00             	addb   $0x0,(%rax)
+  8032e5:	00 00                	add    %al,(%rax)
+  8032e7:	00 a2 0b 80 00 00    	add    %ah,0x800b(%rdx)
+  8032ed:	00 00                	add    %al,(%rax)
+  8032ef:	00 b4 08 80 00 00 00 	add    %dh,0x80(%rax,%rcx,1)
+  8032f6:	00 00                	add    %al,(%rax)
+  8032f8:	a2 0b 80 00 00 00 00 	movabs %al,0xa20000000000800b
+  8032ff:	00 a2 
+  803301:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803307:	00 c5                	add    %al,%ch
+  803309:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80330f:	00 a2 0b 80 00 00    	add    %ah,0x800b(%rdx)
+  803315:	00 00                	add    %al,(%rax)
+  803317:	00 6a 05             	add    %ch,0x5(%rdx)
+  80331a:	80 00 00             	addb   $0x0,(%rax)
+  80331d:	00 00                	add    %al,(%rax)
+	...
+
+0000000000803320 <error_string>:
+	...
+  803328:	c5 2e 80 00 00 00 00 00 d7 2e 80 00 00 00 00 00     ................
+  803338:	e7 2e 80 00 00 00 00 00 f9 2e 80 00 00 00 00 00     ................
+  803348:	07 2f 80 00 00 00 00 00 1b 2f 80 00 00 00 00 00     ./......./......
+  803358:	30 2f 80 00 00 00 00 00 43 2f 80 00 00 00 00 00     0/......C/......
+  803368:	55 2f 80 00 00 00 00 00 69 2f 80 00 00 00 00 00     U/......i/......
+  803378:	79 2f 80 00 00 00 00 00 8c 2f 80 00 00 00 00 00     y/......./......
+  803388:	a3 2f 80 00 00 00 00 00 b9 2f 80 00 00 00 00 00     ./......./......
+  803398:	d1 2f 80 00 00 00 00 00 e9 2f 80 00 00 00 00 00     ./......./......
+  8033a8:	f6 2f 80 00 00 00 00 00 d0 33 80 00 00 00 00 00     ./.......3......
+  8033b8:	0a 30 80 00 00 00 00 00 22 30 80 00 00 00 00 00     .0......"0......
+  8033c8:	38 30 80 00 00 00 00 00 66 69 6c 65 20 69 73 20     80......file is 
+  8033d8:	6e 6f 74 20 61 20 76 61 6c 69 64 20 65 78 65 63     not a valid exec
+  8033e8:	75 74 61 62 6c 65 00 90 73 79 73 63 61 6c 6c 20     utable..syscall 
+  8033f8:	25 7a 64 20 72 65 74 75 72 6e 65 64 20 25 7a 64     %zd returned %zd
+  803408:	20 28 3e 20 30 29 00 6c 69 62 2f 73 79 73 63 61      (> 0).lib/sysca
+  803418:	6c 6c 2e 63 00 0f 1f 00 5b 25 30 38 78 5d 20 75     ll.c....[%08x] u
+  803428:	6e 6b 6e 6f 77 6e 20 64 65 76 69 63 65 20 74 79     nknown device ty
+  803438:	70 65 20 25 64 0a 00 00 5b 25 30 38 78 5d 20 66     pe %d...[%08x] f
+  803448:	74 72 75 6e 63 61 74 65 20 25 64 20 2d 2d 20 62     truncate %d -- b
+  803458:	61 64 20 6d 6f 64 65 0a 00 5b 25 30 38 78 5d 20     ad mode..[%08x] 
+  803468:	72 65 61 64 20 25 64 20 2d 2d 20 62 61 64 20 6d     read %d -- bad m
+  803478:	6f 64 65 0a 00 5b 25 30 38 78 5d 20 77 72 69 74     ode..[%08x] writ
+  803488:	65 20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65     e %d -- bad mode
+  803498:	0a 00 66 0f 1f 44 00 00                             ..f..D..
+
+00000000008034a0 <devtab>:
+  8034a0:	20 40 80 00 00 00 00 00 60 40 80 00 00 00 00 00      @......`@......
+  8034b0:	a0 40 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .@..............
+  8034c0:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  8034d0:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  8034e0:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  8034f0:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  803500:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  803510:	3d 20 32 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73 00     = 2.<cons>.cons.
+  803520:	73 79 73 5f 69 70 63 5f 74 72 79 5f 73 65 6e 64     sys_ipc_try_send
+  803530:	20 66 61 69 6c 65 64 3a 20 25 69 00 6c 69 62 2f      failed: %i.lib/
+  803540:	69 70 63 2e 63 00 66 2e 0f 1f 84 00 00 00 00 00     ipc.c.f.........
+  803550:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803560:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803570:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803580:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803590:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8035a0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8035b0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8035c0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8035d0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8035e0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8035f0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803600:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803610:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803620:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803630:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803640:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803650:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803660:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803670:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803680:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803690:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8036a0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8036b0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8036c0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8036d0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8036e0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8036f0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803700:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803710:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803720:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803730:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803740:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803750:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803760:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803770:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803780:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803790:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8037a0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8037b0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8037c0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8037d0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8037e0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8037f0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803800:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803810:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803820:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803830:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803840:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803850:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803860:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803870:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803880:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803890:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8038a0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8038b0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8038c0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8038d0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8038e0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8038f0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803900:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803910:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803920:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803930:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803940:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803950:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803960:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803970:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803980:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803990:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8039a0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8039b0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8039c0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8039d0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8039e0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8039f0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803a00:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803a10:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803a20:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803a30:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803a40:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803a50:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803a60:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803a70:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803a80:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803a90:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803aa0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803ab0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803ac0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803ad0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803ae0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803af0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803b00:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803b10:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803b20:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803b30:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803b40:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803b50:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803b60:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803b70:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803b80:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803b90:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803ba0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803bb0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803bc0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803bd0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803be0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803bf0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803c00:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803c10:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803c20:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803c30:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803c40:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803c50:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803c60:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803c70:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803c80:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803c90:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803ca0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803cb0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803cc0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803cd0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803ce0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803cf0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803d00:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803d10:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803d20:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803d30:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803d40:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803d50:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803d60:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803d70:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803d80:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803d90:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803da0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803db0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803dc0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803dd0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803de0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803df0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803e00:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803e10:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803e20:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803e30:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803e40:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803e50:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803e60:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803e70:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803e80:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803e90:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803ea0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803eb0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803ec0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803ed0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803ee0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803ef0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803f00:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803f10:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803f20:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803f30:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803f40:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803f50:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803f60:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803f70:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803f80:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803f90:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803fa0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803fb0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803fc0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803fd0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803fe0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803ff0:	66 2e 0f 1f 84 00 00 00 00 00 66 0f 1f 44 00 00     f.........f..D..
@@ -0,0 +1,6197 @@
+
+obj/user/testfdsharing:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 cf 02 00 00       	call   8002f2 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+#include <inc/lib.h>
+
+char buf[512], buf2[512];
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 56                	push   %r14
+  80002b:	41 55                	push   %r13
+  80002d:	41 54                	push   %r12
+  80002f:	53                   	push   %rbx
+    int fd, r, n, n2;
+
+    if ((fd = open("motd", O_RDONLY)) < 0)
+  800030:	be 00 00 00 00       	mov    $0x0,%esi
+  800035:	48 bf 60 31 80 00 00 	movabs $0x803160,%rdi
+  80003c:	00 00 00 
+  80003f:	48 b8 46 24 80 00 00 	movabs $0x802446,%rax
+  800046:	00 00 00 
+  800049:	ff d0                	call   *%rax
+  80004b:	89 c3                	mov    %eax,%ebx
+  80004d:	85 c0                	test   %eax,%eax
+  80004f:	0f 88 8a 01 00 00    	js     8001df <umain+0x1ba>
+        panic("open motd: %i", fd);
+    seek(fd, 0);
+  800055:	be 00 00 00 00       	mov    $0x0,%esi
+  80005a:	89 c7                	mov    %eax,%edi
+  80005c:	48 b8 0e 1f 80 00 00 	movabs $0x801f0e,%rax
+  800063:	00 00 00 
+  800066:	ff d0                	call   *%rax
+    if ((n = readn(fd, buf, sizeof buf)) <= 0)
+  800068:	ba 00 02 00 00       	mov    $0x200,%edx
+  80006d:	48 be 00 52 80 00 00 	movabs $0x805200,%rsi
+  800074:	00 00 00 
+  800077:	89 df                	mov    %ebx,%edi
+  800079:	48 b8 e4 1d 80 00 00 	movabs $0x801de4,%rax
+  800080:	00 00 00 
+  800083:	ff d0                	call   *%rax
+  800085:	49 89 c4             	mov    %rax,%r12
+  800088:	41 89 c6             	mov    %eax,%r14d
+  80008b:	85 c0                	test   %eax,%eax
+  80008d:	0f 8e 79 01 00 00    	jle    80020c <umain+0x1e7>
+        panic("readn: %i", n);
+
+    if ((r = fork()) < 0)
+  800093:	48 b8 1e 18 80 00 00 	movabs $0x80181e,%rax
+  80009a:	00 00 00 
+  80009d:	ff d0                	call   *%rax
+  80009f:	41 89 c5             	mov    %eax,%r13d
+  8000a2:	85 c0                	test   %eax,%eax
+  8000a4:	0f 88 8f 01 00 00    	js     800239 <umain+0x214>
+        panic("fork: %i", r);
+    if (r == 0) {
+  8000aa:	0f 85 c7 00 00 00    	jne    800177 <umain+0x152>
+        seek(fd, 0);
+  8000b0:	be 00 00 00 00       	mov    $0x0,%esi
+  8000b5:	89 df                	mov    %ebx,%edi
+  8000b7:	48 b8 0e 1f 80 00 00 	movabs $0x801f0e,%rax
+  8000be:	00 00 00 
+  8000c1:	ff d0                	call   *%rax
+        cprintf("going to read in child (might page fault if your sharing is buggy)\n");
+  8000c3:	48 bf d0 31 80 00 00 	movabs $0x8031d0,%rdi
+  8000ca:	00 00 00 
+  8000cd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000d2:	48 ba 0e 05 80 00 00 	movabs $0x80050e,%rdx
+  8000d9:	00 00 00 
+  8000dc:	ff d2                	call   *%rdx
+        if ((n2 = readn(fd, buf2, sizeof buf2)) != n)
+  8000de:	ba 00 02 00 00       	mov    $0x200,%edx
+  8000e3:	48 be 00 50 80 00 00 	movabs $0x805000,%rsi
+  8000ea:	00 00 00 
+  8000ed:	89 df                	mov    %ebx,%edi
+  8000ef:	48 b8 e4 1d 80 00 00 	movabs $0x801de4,%rax
+  8000f6:	00 00 00 
+  8000f9:	ff d0                	call   *%rax
+  8000fb:	41 39 c4             	cmp    %eax,%r12d
+  8000fe:	0f 85 62 01 00 00    	jne    800266 <umain+0x241>
+            panic("read in parent got %d, read in child got %d", n, n2);
+        if (memcmp(buf, buf2, n) != 0)
+  800104:	49 63 d4             	movslq %r12d,%rdx
+  800107:	48 be 00 50 80 00 00 	movabs $0x805000,%rsi
+  80010e:	00 00 00 
+  800111:	48 bf 00 52 80 00 00 	movabs $0x805200,%rdi
+  800118:	00 00 00 
+  80011b:	48 b8 4c 11 80 00 00 	movabs $0x80114c,%rax
+  800122:	00 00 00 
+  800125:	ff d0                	call   *%rax
+  800127:	85 c0                	test   %eax,%eax
+  800129:	0f 85 68 01 00 00    	jne    800297 <umain+0x272>
+            panic("read in parent got different bytes from read in child");
+        cprintf("read in child succeeded\n");
+  80012f:	48 bf 9b 31 80 00 00 	movabs $0x80319b,%rdi
+  800136:	00 00 00 
+  800139:	b8 00 00 00 00       	mov    $0x0,%eax
+  80013e:	48 ba 0e 05 80 00 00 	movabs $0x80050e,%rdx
+  800145:	00 00 00 
+  800148:	ff d2                	call   *%rdx
+        seek(fd, 0);
+  80014a:	be 00 00 00 00       	mov    $0x0,%esi
+  80014f:	89 df                	mov    %ebx,%edi
+  800151:	48 b8 0e 1f 80 00 00 	movabs $0x801f0e,%rax
+  800158:	00 00 00 
+  80015b:	ff d0                	call   *%rax
+        close(fd);
+  80015d:	89 df                	mov    %ebx,%edi
+  80015f:	48 b8 a8 1b 80 00 00 	movabs $0x801ba8,%rax
+  800166:	00 00 00 
+  800169:	ff d0                	call   *%rax
+        exit();
+  80016b:	48 b8 9b 03 80 00 00 	movabs $0x80039b,%rax
+  800172:	00 00 00 
+  800175:	ff d0                	call   *%rax
+    }
+    wait(r);
+  800177:	44 89 ef             	mov    %r13d,%edi
+  80017a:	48 b8 05 2a 80 00 00 	movabs $0x802a05,%rax
+  800181:	00 00 00 
+  800184:	ff d0                	call   *%rax
+    if ((n2 = readn(fd, buf2, sizeof buf2)) != n)
+  800186:	ba 00 02 00 00       	mov    $0x200,%edx
+  80018b:	48 be 00 50 80 00 00 	movabs $0x805000,%rsi
+  800192:	00 00 00 
+  800195:	89 df                	mov    %ebx,%edi
+  800197:	48 b8 e4 1d 80 00 00 	movabs $0x801de4,%rax
+  80019e:	00 00 00 
+  8001a1:	ff d0                	call   *%rax
+  8001a3:	41 39 c4             	cmp    %eax,%r12d
+  8001a6:	0f 85 15 01 00 00    	jne    8002c1 <umain+0x29c>
+        panic("read in parent got %d, then got %d", n, n2);
+    cprintf("read in parent succeeded\n");
+  8001ac:	48 bf b4 31 80 00 00 	movabs $0x8031b4,%rdi
+  8001b3:	00 00 00 
+  8001b6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001bb:	48 ba 0e 05 80 00 00 	movabs $0x80050e,%rdx
+  8001c2:	00 00 00 
+  8001c5:	ff d2                	call   *%rdx
+    close(fd);
+  8001c7:	89 df                	mov    %ebx,%edi
+  8001c9:	48 b8 a8 1b 80 00 00 	movabs $0x801ba8,%rax
+  8001d0:	00 00 00 
+  8001d3:	ff d0                	call   *%rax
+
+#include <inc/types.h>
+
+static inline void __attribute__((always_inline))
+breakpoint(void) {
+    asm volatile("int3");
+  8001d5:	cc                   	int3
+
+    breakpoint();
+}
+  8001d6:	5b                   	pop    %rbx
+  8001d7:	41 5c                	pop    %r12
+  8001d9:	41 5d                	pop    %r13
+  8001db:	41 5e                	pop    %r14
+  8001dd:	5d                   	pop    %rbp
+  8001de:	c3                   	ret
+        panic("open motd: %i", fd);
+  8001df:	89 c1                	mov    %eax,%ecx
+  8001e1:	48 ba 65 31 80 00 00 	movabs $0x803165,%rdx
+  8001e8:	00 00 00 
+  8001eb:	be 0b 00 00 00       	mov    $0xb,%esi
+  8001f0:	48 bf 73 31 80 00 00 	movabs $0x803173,%rdi
+  8001f7:	00 00 00 
+  8001fa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001ff:	49 b8 be 03 80 00 00 	movabs $0x8003be,%r8
+  800206:	00 00 00 
+  800209:	41 ff d0             	call   *%r8
+        panic("readn: %i", n);
+  80020c:	89 c1                	mov    %eax,%ecx
+  80020e:	48 ba 88 31 80 00 00 	movabs $0x803188,%rdx
+  800215:	00 00 00 
+  800218:	be 0e 00 00 00       	mov    $0xe,%esi
+  80021d:	48 bf 73 31 80 00 00 	movabs $0x803173,%rdi
+  800224:	00 00 00 
+  800227:	b8 00 00 00 00       	mov    $0x0,%eax
+  80022c:	49 b8 be 03 80 00 00 	movabs $0x8003be,%r8
+  800233:	00 00 00 
+  800236:	41 ff d0             	call   *%r8
+        panic("fork: %i", r);
+  800239:	89 c1                	mov    %eax,%ecx
+  80023b:	48 ba 92 31 80 00 00 	movabs $0x803192,%rdx
+  800242:	00 00 00 
+  800245:	be 11 00 00 00       	mov    $0x11,%esi
+  80024a:	48 bf 73 31 80 00 00 	movabs $0x803173,%rdi
+  800251:	00 00 00 
+  800254:	b8 00 00 00 00       	mov    $0x0,%eax
+  800259:	49 b8 be 03 80 00 00 	movabs $0x8003be,%r8
+  800260:	00 00 00 
+  800263:	41 ff d0             	call   *%r8
+            panic("read in parent got %d, read in child got %d", n, n2);
+  800266:	41 89 c0             	mov    %eax,%r8d
+  800269:	44 89 e1             	mov    %r12d,%ecx
+  80026c:	48 ba 18 32 80 00 00 	movabs $0x803218,%rdx
+  800273:	00 00 00 
+  800276:	be 16 00 00 00       	mov    $0x16,%esi
+  80027b:	48 bf 73 31 80 00 00 	movabs $0x803173,%rdi
+  800282:	00 00 00 
+  800285:	b8 00 00 00 00       	mov    $0x0,%eax
+  80028a:	49 b9 be 03 80 00 00 	movabs $0x8003be,%r9
+  800291:	00 00 00 
+  800294:	41 ff d1             	call   *%r9
+            panic("read in parent got different bytes from read in child");
+  800297:	48 ba 48 32 80 00 00 	movabs $0x803248,%rdx
+  80029e:	00 00 00 
+  8002a1:	be 18 00 00 00       	mov    $0x18,%esi
+  8002a6:	48 bf 73 31 80 00 00 	movabs $0x803173,%rdi
+  8002ad:	00 00 00 
+  8002b0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002b5:	48 b9 be 03 80 00 00 	movabs $0x8003be,%rcx
+  8002bc:	00 00 00 
+  8002bf:	ff d1                	call   *%rcx
+        panic("read in parent got %d, then got %d", n, n2);
+  8002c1:	41 89 c0             	mov    %eax,%r8d
+  8002c4:	44 89 f1             	mov    %r14d,%ecx
+  8002c7:	48 ba 80 32 80 00 00 	movabs $0x803280,%rdx
+  8002ce:	00 00 00 
+  8002d1:	be 20 00 00 00       	mov    $0x20,%esi
+  8002d6:	48 bf 73 31 80 00 00 	movabs $0x803173,%rdi
+  8002dd:	00 00 00 
+  8002e0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002e5:	49 b9 be 03 80 00 00 	movabs $0x8003be,%r9
+  8002ec:	00 00 00 
+  8002ef:	41 ff d1             	call   *%r9
+
+00000000008002f2 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  8002f2:	55                   	push   %rbp
+  8002f3:	48 89 e5             	mov    %rsp,%rbp
+  8002f6:	41 56                	push   %r14
+  8002f8:	41 55                	push   %r13
+  8002fa:	41 54                	push   %r12
+  8002fc:	53                   	push   %rbx
+  8002fd:	41 89 fd             	mov    %edi,%r13d
+  800300:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800303:	48 ba d8 40 80 00 00 	movabs $0x8040d8,%rdx
+  80030a:	00 00 00 
+  80030d:	48 b8 d8 40 80 00 00 	movabs $0x8040d8,%rax
+  800314:	00 00 00 
+  800317:	48 39 c2             	cmp    %rax,%rdx
+  80031a:	73 17                	jae    800333 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  80031c:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  80031f:	49 89 c4             	mov    %rax,%r12
+  800322:	48 83 c3 08          	add    $0x8,%rbx
+  800326:	b8 00 00 00 00       	mov    $0x0,%eax
+  80032b:	ff 53 f8             	call   *-0x8(%rbx)
+  80032e:	4c 39 e3             	cmp    %r12,%rbx
+  800331:	72 ef                	jb     800322 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+    envid_t this_env_id = sys_getenvid();
+  800333:	48 b8 23 13 80 00 00 	movabs $0x801323,%rax
+  80033a:	00 00 00 
+  80033d:	ff d0                	call   *%rax
+    thisenv = &((struct Env*)UENVS)[ENVX(this_env_id)];
+  80033f:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800344:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+  80034b:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  800352:	00 00 00 
+  800355:	48 01 d0             	add    %rdx,%rax
+  800358:	48 a3 00 54 80 00 00 	movabs %rax,0x805400
+  80035f:	00 00 00 
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  800362:	45 85 ed             	test   %r13d,%r13d
+  800365:	7e 0d                	jle    800374 <libmain+0x82>
+  800367:	49 8b 06             	mov    (%r14),%rax
+  80036a:	48 a3 00 40 80 00 00 	movabs %rax,0x804000
+  800371:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  800374:	4c 89 f6             	mov    %r14,%rsi
+  800377:	44 89 ef             	mov    %r13d,%edi
+  80037a:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  800381:	00 00 00 
+  800384:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  800386:	48 b8 9b 03 80 00 00 	movabs $0x80039b,%rax
+  80038d:	00 00 00 
+  800390:	ff d0                	call   *%rax
+#endif
+}
+  800392:	5b                   	pop    %rbx
+  800393:	41 5c                	pop    %r12
+  800395:	41 5d                	pop    %r13
+  800397:	41 5e                	pop    %r14
+  800399:	5d                   	pop    %rbp
+  80039a:	c3                   	ret
+
+000000000080039b <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  80039b:	55                   	push   %rbp
+  80039c:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  80039f:	48 b8 db 1b 80 00 00 	movabs $0x801bdb,%rax
+  8003a6:	00 00 00 
+  8003a9:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  8003ab:	bf 00 00 00 00       	mov    $0x0,%edi
+  8003b0:	48 b8 b8 12 80 00 00 	movabs $0x8012b8,%rax
+  8003b7:	00 00 00 
+  8003ba:	ff d0                	call   *%rax
+}
+  8003bc:	5d                   	pop    %rbp
+  8003bd:	c3                   	ret
+
+00000000008003be <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  8003be:	55                   	push   %rbp
+  8003bf:	48 89 e5             	mov    %rsp,%rbp
+  8003c2:	41 56                	push   %r14
+  8003c4:	41 55                	push   %r13
+  8003c6:	41 54                	push   %r12
+  8003c8:	53                   	push   %rbx
+  8003c9:	48 83 ec 50          	sub    $0x50,%rsp
+  8003cd:	49 89 fc             	mov    %rdi,%r12
+  8003d0:	41 89 f5             	mov    %esi,%r13d
+  8003d3:	48 89 d3             	mov    %rdx,%rbx
+  8003d6:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  8003da:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  8003de:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  8003e2:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  8003e9:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8003ed:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  8003f1:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  8003f5:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  8003f9:	48 b8 00 40 80 00 00 	movabs $0x804000,%rax
+  800400:	00 00 00 
+  800403:	4c 8b 30             	mov    (%rax),%r14
+  800406:	48 b8 23 13 80 00 00 	movabs $0x801323,%rax
+  80040d:	00 00 00 
+  800410:	ff d0                	call   *%rax
+  800412:	89 c6                	mov    %eax,%esi
+  800414:	45 89 e8             	mov    %r13d,%r8d
+  800417:	4c 89 e1             	mov    %r12,%rcx
+  80041a:	4c 89 f2             	mov    %r14,%rdx
+  80041d:	48 bf b0 32 80 00 00 	movabs $0x8032b0,%rdi
+  800424:	00 00 00 
+  800427:	b8 00 00 00 00       	mov    $0x0,%eax
+  80042c:	49 bc 0e 05 80 00 00 	movabs $0x80050e,%r12
+  800433:	00 00 00 
+  800436:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  800439:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  80043d:	48 89 df             	mov    %rbx,%rdi
+  800440:	48 b8 aa 04 80 00 00 	movabs $0x8004aa,%rax
+  800447:	00 00 00 
+  80044a:	ff d0                	call   *%rax
+    cprintf("\n");
+  80044c:	48 bf b2 31 80 00 00 	movabs $0x8031b2,%rdi
+  800453:	00 00 00 
+  800456:	b8 00 00 00 00       	mov    $0x0,%eax
+  80045b:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  80045e:	cc                   	int3
+  80045f:	eb fd                	jmp    80045e <_panic+0xa0>
+
+0000000000800461 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  800461:	55                   	push   %rbp
+  800462:	48 89 e5             	mov    %rsp,%rbp
+  800465:	53                   	push   %rbx
+  800466:	48 83 ec 08          	sub    $0x8,%rsp
+  80046a:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  80046d:	8b 06                	mov    (%rsi),%eax
+  80046f:	8d 50 01             	lea    0x1(%rax),%edx
+  800472:	89 16                	mov    %edx,(%rsi)
+  800474:	48 98                	cltq
+  800476:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  80047b:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  800481:	74 0a                	je     80048d <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  800483:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  800487:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80048b:	c9                   	leave
+  80048c:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  80048d:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  800491:	be ff 00 00 00       	mov    $0xff,%esi
+  800496:	48 b8 5a 12 80 00 00 	movabs $0x80125a,%rax
+  80049d:	00 00 00 
+  8004a0:	ff d0                	call   *%rax
+        state->offset = 0;
+  8004a2:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  8004a8:	eb d9                	jmp    800483 <putch+0x22>
+
+00000000008004aa <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  8004aa:	55                   	push   %rbp
+  8004ab:	48 89 e5             	mov    %rsp,%rbp
+  8004ae:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  8004b5:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  8004b8:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  8004bf:	b9 21 00 00 00       	mov    $0x21,%ecx
+  8004c4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004c9:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  8004cc:	48 89 f1             	mov    %rsi,%rcx
+  8004cf:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  8004d6:	48 bf 61 04 80 00 00 	movabs $0x800461,%rdi
+  8004dd:	00 00 00 
+  8004e0:	48 b8 5e 06 80 00 00 	movabs $0x80065e,%rax
+  8004e7:	00 00 00 
+  8004ea:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  8004ec:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  8004f3:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  8004fa:	48 b8 5a 12 80 00 00 	movabs $0x80125a,%rax
+  800501:	00 00 00 
+  800504:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  800506:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  80050c:	c9                   	leave
+  80050d:	c3                   	ret
+
+000000000080050e <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  80050e:	55                   	push   %rbp
+  80050f:	48 89 e5             	mov    %rsp,%rbp
+  800512:	48 83 ec 50          	sub    $0x50,%rsp
+  800516:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  80051a:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  80051e:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800522:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800526:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  80052a:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  800531:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800535:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800539:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80053d:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  800541:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  800545:	48 b8 aa 04 80 00 00 	movabs $0x8004aa,%rax
+  80054c:	00 00 00 
+  80054f:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  800551:	c9                   	leave
+  800552:	c3                   	ret
+
+0000000000800553 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  800553:	55                   	push   %rbp
+  800554:	48 89 e5             	mov    %rsp,%rbp
+  800557:	41 57                	push   %r15
+  800559:	41 56                	push   %r14
+  80055b:	41 55                	push   %r13
+  80055d:	41 54                	push   %r12
+  80055f:	53                   	push   %rbx
+  800560:	48 83 ec 18          	sub    $0x18,%rsp
+  800564:	49 89 fc             	mov    %rdi,%r12
+  800567:	49 89 f5             	mov    %rsi,%r13
+  80056a:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  80056e:	8b 45 10             	mov    0x10(%rbp),%eax
+  800571:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  800574:	41 89 cf             	mov    %ecx,%r15d
+  800577:	4c 39 fa             	cmp    %r15,%rdx
+  80057a:	73 5b                	jae    8005d7 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  80057c:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  800580:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  800584:	85 db                	test   %ebx,%ebx
+  800586:	7e 0e                	jle    800596 <print_num+0x43>
+            putch(padc, put_arg);
+  800588:	4c 89 ee             	mov    %r13,%rsi
+  80058b:	44 89 f7             	mov    %r14d,%edi
+  80058e:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  800591:	83 eb 01             	sub    $0x1,%ebx
+  800594:	75 f2                	jne    800588 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  800596:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  80059a:	48 b9 e4 32 80 00 00 	movabs $0x8032e4,%rcx
+  8005a1:	00 00 00 
+  8005a4:	48 b8 d3 32 80 00 00 	movabs $0x8032d3,%rax
+  8005ab:	00 00 00 
+  8005ae:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  8005b2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8005b6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005bb:	49 f7 f7             	div    %r15
+  8005be:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  8005c2:	4c 89 ee             	mov    %r13,%rsi
+  8005c5:	41 ff d4             	call   *%r12
+}
+  8005c8:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8005cc:	5b                   	pop    %rbx
+  8005cd:	41 5c                	pop    %r12
+  8005cf:	41 5d                	pop    %r13
+  8005d1:	41 5e                	pop    %r14
+  8005d3:	41 5f                	pop    %r15
+  8005d5:	5d                   	pop    %rbp
+  8005d6:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  8005d7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8005db:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005e0:	49 f7 f7             	div    %r15
+  8005e3:	48 83 ec 08          	sub    $0x8,%rsp
+  8005e7:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  8005eb:	52                   	push   %rdx
+  8005ec:	45 0f be c9          	movsbl %r9b,%r9d
+  8005f0:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  8005f4:	48 89 c2             	mov    %rax,%rdx
+  8005f7:	48 b8 53 05 80 00 00 	movabs $0x800553,%rax
+  8005fe:	00 00 00 
+  800601:	ff d0                	call   *%rax
+  800603:	48 83 c4 10          	add    $0x10,%rsp
+  800607:	eb 8d                	jmp    800596 <print_num+0x43>
+
+0000000000800609 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  800609:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  80060d:	48 8b 06             	mov    (%rsi),%rax
+  800610:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  800614:	73 0a                	jae    800620 <sprintputch+0x17>
+        *state->start++ = ch;
+  800616:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80061a:	48 89 16             	mov    %rdx,(%rsi)
+  80061d:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  800620:	c3                   	ret
+
+0000000000800621 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  800621:	55                   	push   %rbp
+  800622:	48 89 e5             	mov    %rsp,%rbp
+  800625:	48 83 ec 50          	sub    $0x50,%rsp
+  800629:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80062d:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800631:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  800635:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  80063c:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800640:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800644:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800648:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  80064c:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800650:	48 b8 5e 06 80 00 00 	movabs $0x80065e,%rax
+  800657:	00 00 00 
+  80065a:	ff d0                	call   *%rax
+}
+  80065c:	c9                   	leave
+  80065d:	c3                   	ret
+
+000000000080065e <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  80065e:	55                   	push   %rbp
+  80065f:	48 89 e5             	mov    %rsp,%rbp
+  800662:	41 57                	push   %r15
+  800664:	41 56                	push   %r14
+  800666:	41 55                	push   %r13
+  800668:	41 54                	push   %r12
+  80066a:	53                   	push   %rbx
+  80066b:	48 83 ec 38          	sub    $0x38,%rsp
+  80066f:	49 89 fe             	mov    %rdi,%r14
+  800672:	49 89 f5             	mov    %rsi,%r13
+  800675:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  800678:	48 8b 01             	mov    (%rcx),%rax
+  80067b:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  80067f:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800683:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800687:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  80068b:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  80068f:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  800693:	0f b6 3b             	movzbl (%rbx),%edi
+  800696:	40 80 ff 25          	cmp    $0x25,%dil
+  80069a:	74 18                	je     8006b4 <vprintfmt+0x56>
+            if (!ch) return;
+  80069c:	40 84 ff             	test   %dil,%dil
+  80069f:	0f 84 b1 06 00 00    	je     800d56 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  8006a5:	40 0f b6 ff          	movzbl %dil,%edi
+  8006a9:	4c 89 ee             	mov    %r13,%rsi
+  8006ac:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  8006af:	4c 89 e3             	mov    %r12,%rbx
+  8006b2:	eb db                	jmp    80068f <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  8006b4:	be 00 00 00 00       	mov    $0x0,%esi
+  8006b9:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  8006bd:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  8006c2:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8006c8:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  8006cf:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8006d3:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  8006d8:	41 0f b6 04 24       	movzbl (%r12),%eax
+  8006dd:	88 45 a0             	mov    %al,-0x60(%rbp)
+  8006e0:	83 e8 23             	sub    $0x23,%eax
+  8006e3:	3c 57                	cmp    $0x57,%al
+  8006e5:	0f 87 51 06 00 00    	ja     800d3c <vprintfmt+0x6de>
+  8006eb:	0f b6 c0             	movzbl %al,%eax
+  8006ee:	48 b9 a0 34 80 00 00 	movabs $0x8034a0,%rcx
+  8006f5:	00 00 00 
+  8006f8:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  8006fb:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  8006fe:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  800702:	eb cf                	jmp    8006d3 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  800704:	49 89 dc             	mov    %rbx,%r12
+  800707:	be 01 00 00 00       	mov    $0x1,%esi
+  80070c:	eb c5                	jmp    8006d3 <vprintfmt+0x75>
+            padc = ch;
+  80070e:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  800712:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800715:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800718:	eb b9                	jmp    8006d3 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  80071a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80071d:	83 f8 2f             	cmp    $0x2f,%eax
+  800720:	77 24                	ja     800746 <vprintfmt+0xe8>
+  800722:	89 c1                	mov    %eax,%ecx
+  800724:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  800728:	83 c0 08             	add    $0x8,%eax
+  80072b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80072e:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  800731:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  800734:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800738:	79 99                	jns    8006d3 <vprintfmt+0x75>
+                width = precision;
+  80073a:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  80073e:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800744:	eb 8d                	jmp    8006d3 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800746:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80074a:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  80074e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800752:	eb da                	jmp    80072e <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  800754:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  800759:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  80075d:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  800763:	3c 39                	cmp    $0x39,%al
+  800765:	77 1c                	ja     800783 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  800767:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  80076b:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  80076f:	0f b6 c0             	movzbl %al,%eax
+  800772:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800777:	0f b6 03             	movzbl (%rbx),%eax
+  80077a:	3c 39                	cmp    $0x39,%al
+  80077c:	76 e9                	jbe    800767 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  80077e:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  800781:	eb b1                	jmp    800734 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  800783:	49 89 dc             	mov    %rbx,%r12
+  800786:	eb ac                	jmp    800734 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  800788:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  80078b:	85 c9                	test   %ecx,%ecx
+  80078d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800792:	0f 49 c1             	cmovns %ecx,%eax
+  800795:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  800798:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80079b:	e9 33 ff ff ff       	jmp    8006d3 <vprintfmt+0x75>
+            lflag++;
+  8007a0:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  8007a3:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8007a6:	e9 28 ff ff ff       	jmp    8006d3 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  8007ab:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007ae:	83 f8 2f             	cmp    $0x2f,%eax
+  8007b1:	77 19                	ja     8007cc <vprintfmt+0x16e>
+  8007b3:	89 c2                	mov    %eax,%edx
+  8007b5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007b9:	83 c0 08             	add    $0x8,%eax
+  8007bc:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007bf:	8b 3a                	mov    (%rdx),%edi
+  8007c1:	4c 89 ee             	mov    %r13,%rsi
+  8007c4:	41 ff d6             	call   *%r14
+            break;
+  8007c7:	e9 c3 fe ff ff       	jmp    80068f <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  8007cc:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007d0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007d4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007d8:	eb e5                	jmp    8007bf <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  8007da:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007dd:	83 f8 2f             	cmp    $0x2f,%eax
+  8007e0:	77 5a                	ja     80083c <vprintfmt+0x1de>
+  8007e2:	89 c2                	mov    %eax,%edx
+  8007e4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007e8:	83 c0 08             	add    $0x8,%eax
+  8007eb:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  8007ee:	8b 02                	mov    (%rdx),%eax
+  8007f0:	89 c1                	mov    %eax,%ecx
+  8007f2:	f7 d9                	neg    %ecx
+  8007f4:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  8007f7:	83 f9 15             	cmp    $0x15,%ecx
+  8007fa:	7f 4e                	jg     80084a <vprintfmt+0x1ec>
+  8007fc:	48 63 c1             	movslq %ecx,%rax
+  8007ff:	48 ba 60 37 80 00 00 	movabs $0x803760,%rdx
+  800806:	00 00 00 
+  800809:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80080d:	48 85 c0             	test   %rax,%rax
+  800810:	74 38                	je     80084a <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  800812:	48 89 c1             	mov    %rax,%rcx
+  800815:	48 ba 59 39 80 00 00 	movabs $0x803959,%rdx
+  80081c:	00 00 00 
+  80081f:	4c 89 ee             	mov    %r13,%rsi
+  800822:	4c 89 f7             	mov    %r14,%rdi
+  800825:	b8 00 00 00 00       	mov    $0x0,%eax
+  80082a:	49 b8 21 06 80 00 00 	movabs $0x800621,%r8
+  800831:	00 00 00 
+  800834:	41 ff d0             	call   *%r8
+  800837:	e9 53 fe ff ff       	jmp    80068f <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  80083c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800840:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800844:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800848:	eb a4                	jmp    8007ee <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  80084a:	48 ba fc 32 80 00 00 	movabs $0x8032fc,%rdx
+  800851:	00 00 00 
+  800854:	4c 89 ee             	mov    %r13,%rsi
+  800857:	4c 89 f7             	mov    %r14,%rdi
+  80085a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80085f:	49 b8 21 06 80 00 00 	movabs $0x800621,%r8
+  800866:	00 00 00 
+  800869:	41 ff d0             	call   *%r8
+  80086c:	e9 1e fe ff ff       	jmp    80068f <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800871:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800874:	83 f8 2f             	cmp    $0x2f,%eax
+  800877:	77 6c                	ja     8008e5 <vprintfmt+0x287>
+  800879:	89 c2                	mov    %eax,%edx
+  80087b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80087f:	83 c0 08             	add    $0x8,%eax
+  800882:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800885:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  800888:	48 85 d2             	test   %rdx,%rdx
+  80088b:	48 b8 f5 32 80 00 00 	movabs $0x8032f5,%rax
+  800892:	00 00 00 
+  800895:	48 0f 45 c2          	cmovne %rdx,%rax
+  800899:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  80089d:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8008a1:	7e 06                	jle    8008a9 <vprintfmt+0x24b>
+  8008a3:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  8008a7:	75 4a                	jne    8008f3 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8008a9:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8008ad:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8008b1:	0f b6 00             	movzbl (%rax),%eax
+  8008b4:	84 c0                	test   %al,%al
+  8008b6:	0f 85 9a 00 00 00    	jne    800956 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  8008bc:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8008bf:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  8008c3:	85 c0                	test   %eax,%eax
+  8008c5:	0f 8e c4 fd ff ff    	jle    80068f <vprintfmt+0x31>
+  8008cb:	4c 89 ee             	mov    %r13,%rsi
+  8008ce:	bf 20 00 00 00       	mov    $0x20,%edi
+  8008d3:	41 ff d6             	call   *%r14
+  8008d6:	41 83 ec 01          	sub    $0x1,%r12d
+  8008da:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  8008de:	75 eb                	jne    8008cb <vprintfmt+0x26d>
+  8008e0:	e9 aa fd ff ff       	jmp    80068f <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8008e5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008e9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008ed:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008f1:	eb 92                	jmp    800885 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  8008f3:	49 63 f7             	movslq %r15d,%rsi
+  8008f6:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  8008fa:	48 b8 10 0e 80 00 00 	movabs $0x800e10,%rax
+  800901:	00 00 00 
+  800904:	ff d0                	call   *%rax
+  800906:	48 89 c2             	mov    %rax,%rdx
+  800909:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80090c:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  80090e:	8d 70 ff             	lea    -0x1(%rax),%esi
+  800911:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  800914:	85 c0                	test   %eax,%eax
+  800916:	7e 91                	jle    8008a9 <vprintfmt+0x24b>
+  800918:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  80091d:	4c 89 ee             	mov    %r13,%rsi
+  800920:	44 89 e7             	mov    %r12d,%edi
+  800923:	41 ff d6             	call   *%r14
+  800926:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  80092a:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80092d:	83 f8 ff             	cmp    $0xffffffff,%eax
+  800930:	75 eb                	jne    80091d <vprintfmt+0x2bf>
+  800932:	e9 72 ff ff ff       	jmp    8008a9 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800937:	0f b6 f8             	movzbl %al,%edi
+  80093a:	4c 89 ee             	mov    %r13,%rsi
+  80093d:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800940:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800944:	49 83 c4 01          	add    $0x1,%r12
+  800948:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  80094e:	84 c0                	test   %al,%al
+  800950:	0f 84 66 ff ff ff    	je     8008bc <vprintfmt+0x25e>
+  800956:	45 85 ff             	test   %r15d,%r15d
+  800959:	78 0a                	js     800965 <vprintfmt+0x307>
+  80095b:	41 83 ef 01          	sub    $0x1,%r15d
+  80095f:	0f 88 57 ff ff ff    	js     8008bc <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800965:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  800969:	74 cc                	je     800937 <vprintfmt+0x2d9>
+  80096b:	8d 50 e0             	lea    -0x20(%rax),%edx
+  80096e:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800973:	80 fa 5e             	cmp    $0x5e,%dl
+  800976:	77 c2                	ja     80093a <vprintfmt+0x2dc>
+  800978:	eb bd                	jmp    800937 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  80097a:	40 84 f6             	test   %sil,%sil
+  80097d:	75 26                	jne    8009a5 <vprintfmt+0x347>
+    switch (lflag) {
+  80097f:	85 d2                	test   %edx,%edx
+  800981:	74 59                	je     8009dc <vprintfmt+0x37e>
+  800983:	83 fa 01             	cmp    $0x1,%edx
+  800986:	74 7b                	je     800a03 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  800988:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80098b:	83 f8 2f             	cmp    $0x2f,%eax
+  80098e:	0f 87 96 00 00 00    	ja     800a2a <vprintfmt+0x3cc>
+  800994:	89 c2                	mov    %eax,%edx
+  800996:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80099a:	83 c0 08             	add    $0x8,%eax
+  80099d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009a0:	4c 8b 22             	mov    (%rdx),%r12
+  8009a3:	eb 17                	jmp    8009bc <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  8009a5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009a8:	83 f8 2f             	cmp    $0x2f,%eax
+  8009ab:	77 21                	ja     8009ce <vprintfmt+0x370>
+  8009ad:	89 c2                	mov    %eax,%edx
+  8009af:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009b3:	83 c0 08             	add    $0x8,%eax
+  8009b6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009b9:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  8009bc:	4d 85 e4             	test   %r12,%r12
+  8009bf:	78 7a                	js     800a3b <vprintfmt+0x3dd>
+            num = i;
+  8009c1:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  8009c4:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  8009c9:	e9 50 02 00 00       	jmp    800c1e <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8009ce:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009d2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009d6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009da:	eb dd                	jmp    8009b9 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  8009dc:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009df:	83 f8 2f             	cmp    $0x2f,%eax
+  8009e2:	77 11                	ja     8009f5 <vprintfmt+0x397>
+  8009e4:	89 c2                	mov    %eax,%edx
+  8009e6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009ea:	83 c0 08             	add    $0x8,%eax
+  8009ed:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009f0:	4c 63 22             	movslq (%rdx),%r12
+  8009f3:	eb c7                	jmp    8009bc <vprintfmt+0x35e>
+  8009f5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009f9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009fd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a01:	eb ed                	jmp    8009f0 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  800a03:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a06:	83 f8 2f             	cmp    $0x2f,%eax
+  800a09:	77 11                	ja     800a1c <vprintfmt+0x3be>
+  800a0b:	89 c2                	mov    %eax,%edx
+  800a0d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a11:	83 c0 08             	add    $0x8,%eax
+  800a14:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a17:	4c 8b 22             	mov    (%rdx),%r12
+  800a1a:	eb a0                	jmp    8009bc <vprintfmt+0x35e>
+  800a1c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a20:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a24:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a28:	eb ed                	jmp    800a17 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  800a2a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a2e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a32:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a36:	e9 65 ff ff ff       	jmp    8009a0 <vprintfmt+0x342>
+                putch('-', put_arg);
+  800a3b:	4c 89 ee             	mov    %r13,%rsi
+  800a3e:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800a43:	41 ff d6             	call   *%r14
+                i = -i;
+  800a46:	49 f7 dc             	neg    %r12
+  800a49:	e9 73 ff ff ff       	jmp    8009c1 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  800a4e:	40 84 f6             	test   %sil,%sil
+  800a51:	75 32                	jne    800a85 <vprintfmt+0x427>
+    switch (lflag) {
+  800a53:	85 d2                	test   %edx,%edx
+  800a55:	74 5d                	je     800ab4 <vprintfmt+0x456>
+  800a57:	83 fa 01             	cmp    $0x1,%edx
+  800a5a:	0f 84 82 00 00 00    	je     800ae2 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  800a60:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a63:	83 f8 2f             	cmp    $0x2f,%eax
+  800a66:	0f 87 a5 00 00 00    	ja     800b11 <vprintfmt+0x4b3>
+  800a6c:	89 c2                	mov    %eax,%edx
+  800a6e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a72:	83 c0 08             	add    $0x8,%eax
+  800a75:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a78:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800a7b:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  800a80:	e9 99 01 00 00       	jmp    800c1e <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800a85:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a88:	83 f8 2f             	cmp    $0x2f,%eax
+  800a8b:	77 19                	ja     800aa6 <vprintfmt+0x448>
+  800a8d:	89 c2                	mov    %eax,%edx
+  800a8f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a93:	83 c0 08             	add    $0x8,%eax
+  800a96:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a99:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800a9c:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800aa1:	e9 78 01 00 00       	jmp    800c1e <vprintfmt+0x5c0>
+  800aa6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800aaa:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800aae:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ab2:	eb e5                	jmp    800a99 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  800ab4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ab7:	83 f8 2f             	cmp    $0x2f,%eax
+  800aba:	77 18                	ja     800ad4 <vprintfmt+0x476>
+  800abc:	89 c2                	mov    %eax,%edx
+  800abe:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ac2:	83 c0 08             	add    $0x8,%eax
+  800ac5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ac8:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800aca:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  800acf:	e9 4a 01 00 00       	jmp    800c1e <vprintfmt+0x5c0>
+  800ad4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ad8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800adc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ae0:	eb e6                	jmp    800ac8 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  800ae2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ae5:	83 f8 2f             	cmp    $0x2f,%eax
+  800ae8:	77 19                	ja     800b03 <vprintfmt+0x4a5>
+  800aea:	89 c2                	mov    %eax,%edx
+  800aec:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800af0:	83 c0 08             	add    $0x8,%eax
+  800af3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800af6:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800af9:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  800afe:	e9 1b 01 00 00       	jmp    800c1e <vprintfmt+0x5c0>
+  800b03:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b07:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b0b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b0f:	eb e5                	jmp    800af6 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  800b11:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b15:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b19:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b1d:	e9 56 ff ff ff       	jmp    800a78 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  800b22:	40 84 f6             	test   %sil,%sil
+  800b25:	75 2e                	jne    800b55 <vprintfmt+0x4f7>
+    switch (lflag) {
+  800b27:	85 d2                	test   %edx,%edx
+  800b29:	74 59                	je     800b84 <vprintfmt+0x526>
+  800b2b:	83 fa 01             	cmp    $0x1,%edx
+  800b2e:	74 7f                	je     800baf <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  800b30:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b33:	83 f8 2f             	cmp    $0x2f,%eax
+  800b36:	0f 87 9f 00 00 00    	ja     800bdb <vprintfmt+0x57d>
+  800b3c:	89 c2                	mov    %eax,%edx
+  800b3e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b42:	83 c0 08             	add    $0x8,%eax
+  800b45:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b48:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800b4b:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  800b50:	e9 c9 00 00 00       	jmp    800c1e <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800b55:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b58:	83 f8 2f             	cmp    $0x2f,%eax
+  800b5b:	77 19                	ja     800b76 <vprintfmt+0x518>
+  800b5d:	89 c2                	mov    %eax,%edx
+  800b5f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b63:	83 c0 08             	add    $0x8,%eax
+  800b66:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b69:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800b6c:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800b71:	e9 a8 00 00 00       	jmp    800c1e <vprintfmt+0x5c0>
+  800b76:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b7a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b7e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b82:	eb e5                	jmp    800b69 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  800b84:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b87:	83 f8 2f             	cmp    $0x2f,%eax
+  800b8a:	77 15                	ja     800ba1 <vprintfmt+0x543>
+  800b8c:	89 c2                	mov    %eax,%edx
+  800b8e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b92:	83 c0 08             	add    $0x8,%eax
+  800b95:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b98:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  800b9a:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  800b9f:	eb 7d                	jmp    800c1e <vprintfmt+0x5c0>
+  800ba1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ba5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ba9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bad:	eb e9                	jmp    800b98 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  800baf:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bb2:	83 f8 2f             	cmp    $0x2f,%eax
+  800bb5:	77 16                	ja     800bcd <vprintfmt+0x56f>
+  800bb7:	89 c2                	mov    %eax,%edx
+  800bb9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800bbd:	83 c0 08             	add    $0x8,%eax
+  800bc0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800bc3:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800bc6:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  800bcb:	eb 51                	jmp    800c1e <vprintfmt+0x5c0>
+  800bcd:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bd1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bd5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bd9:	eb e8                	jmp    800bc3 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  800bdb:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bdf:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800be3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800be7:	e9 5c ff ff ff       	jmp    800b48 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  800bec:	4c 89 ee             	mov    %r13,%rsi
+  800bef:	bf 30 00 00 00       	mov    $0x30,%edi
+  800bf4:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800bf7:	4c 89 ee             	mov    %r13,%rsi
+  800bfa:	bf 78 00 00 00       	mov    $0x78,%edi
+  800bff:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800c02:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c05:	83 f8 2f             	cmp    $0x2f,%eax
+  800c08:	77 47                	ja     800c51 <vprintfmt+0x5f3>
+  800c0a:	89 c2                	mov    %eax,%edx
+  800c0c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c10:	83 c0 08             	add    $0x8,%eax
+  800c13:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c16:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800c19:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800c1e:	48 83 ec 08          	sub    $0x8,%rsp
+  800c22:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800c26:	0f 94 c0             	sete   %al
+  800c29:	0f b6 c0             	movzbl %al,%eax
+  800c2c:	50                   	push   %rax
+  800c2d:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800c32:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800c36:	4c 89 ee             	mov    %r13,%rsi
+  800c39:	4c 89 f7             	mov    %r14,%rdi
+  800c3c:	48 b8 53 05 80 00 00 	movabs $0x800553,%rax
+  800c43:	00 00 00 
+  800c46:	ff d0                	call   *%rax
+            break;
+  800c48:	48 83 c4 10          	add    $0x10,%rsp
+  800c4c:	e9 3e fa ff ff       	jmp    80068f <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800c51:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c55:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c59:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c5d:	eb b7                	jmp    800c16 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  800c5f:	40 84 f6             	test   %sil,%sil
+  800c62:	75 2b                	jne    800c8f <vprintfmt+0x631>
+    switch (lflag) {
+  800c64:	85 d2                	test   %edx,%edx
+  800c66:	74 56                	je     800cbe <vprintfmt+0x660>
+  800c68:	83 fa 01             	cmp    $0x1,%edx
+  800c6b:	74 7f                	je     800cec <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800c6d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c70:	83 f8 2f             	cmp    $0x2f,%eax
+  800c73:	0f 87 a2 00 00 00    	ja     800d1b <vprintfmt+0x6bd>
+  800c79:	89 c2                	mov    %eax,%edx
+  800c7b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c7f:	83 c0 08             	add    $0x8,%eax
+  800c82:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c85:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800c88:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800c8d:	eb 8f                	jmp    800c1e <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800c8f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c92:	83 f8 2f             	cmp    $0x2f,%eax
+  800c95:	77 19                	ja     800cb0 <vprintfmt+0x652>
+  800c97:	89 c2                	mov    %eax,%edx
+  800c99:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c9d:	83 c0 08             	add    $0x8,%eax
+  800ca0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ca3:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800ca6:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800cab:	e9 6e ff ff ff       	jmp    800c1e <vprintfmt+0x5c0>
+  800cb0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800cb4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800cb8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800cbc:	eb e5                	jmp    800ca3 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800cbe:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800cc1:	83 f8 2f             	cmp    $0x2f,%eax
+  800cc4:	77 18                	ja     800cde <vprintfmt+0x680>
+  800cc6:	89 c2                	mov    %eax,%edx
+  800cc8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ccc:	83 c0 08             	add    $0x8,%eax
+  800ccf:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800cd2:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800cd4:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800cd9:	e9 40 ff ff ff       	jmp    800c1e <vprintfmt+0x5c0>
+  800cde:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ce2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ce6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800cea:	eb e6                	jmp    800cd2 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800cec:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800cef:	83 f8 2f             	cmp    $0x2f,%eax
+  800cf2:	77 19                	ja     800d0d <vprintfmt+0x6af>
+  800cf4:	89 c2                	mov    %eax,%edx
+  800cf6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800cfa:	83 c0 08             	add    $0x8,%eax
+  800cfd:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d00:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800d03:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800d08:	e9 11 ff ff ff       	jmp    800c1e <vprintfmt+0x5c0>
+  800d0d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d11:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d15:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d19:	eb e5                	jmp    800d00 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800d1b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d1f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d23:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d27:	e9 59 ff ff ff       	jmp    800c85 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800d2c:	4c 89 ee             	mov    %r13,%rsi
+  800d2f:	bf 25 00 00 00       	mov    $0x25,%edi
+  800d34:	41 ff d6             	call   *%r14
+            break;
+  800d37:	e9 53 f9 ff ff       	jmp    80068f <vprintfmt+0x31>
+            putch('%', put_arg);
+  800d3c:	4c 89 ee             	mov    %r13,%rsi
+  800d3f:	bf 25 00 00 00       	mov    $0x25,%edi
+  800d44:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800d47:	48 83 eb 01          	sub    $0x1,%rbx
+  800d4b:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800d4f:	75 f6                	jne    800d47 <vprintfmt+0x6e9>
+  800d51:	e9 39 f9 ff ff       	jmp    80068f <vprintfmt+0x31>
+}
+  800d56:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800d5a:	5b                   	pop    %rbx
+  800d5b:	41 5c                	pop    %r12
+  800d5d:	41 5d                	pop    %r13
+  800d5f:	41 5e                	pop    %r14
+  800d61:	41 5f                	pop    %r15
+  800d63:	5d                   	pop    %rbp
+  800d64:	c3                   	ret
+
+0000000000800d65 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800d65:	55                   	push   %rbp
+  800d66:	48 89 e5             	mov    %rsp,%rbp
+  800d69:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800d6d:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800d71:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800d76:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800d7a:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800d81:	48 85 ff             	test   %rdi,%rdi
+  800d84:	74 2b                	je     800db1 <vsnprintf+0x4c>
+  800d86:	48 85 f6             	test   %rsi,%rsi
+  800d89:	74 26                	je     800db1 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800d8b:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800d8f:	48 bf 09 06 80 00 00 	movabs $0x800609,%rdi
+  800d96:	00 00 00 
+  800d99:	48 b8 5e 06 80 00 00 	movabs $0x80065e,%rax
+  800da0:	00 00 00 
+  800da3:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800da5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800da9:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800dac:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800daf:	c9                   	leave
+  800db0:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800db1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800db6:	eb f7                	jmp    800daf <vsnprintf+0x4a>
+
+0000000000800db8 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800db8:	55                   	push   %rbp
+  800db9:	48 89 e5             	mov    %rsp,%rbp
+  800dbc:	48 83 ec 50          	sub    $0x50,%rsp
+  800dc0:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800dc4:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800dc8:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800dcc:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800dd3:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800dd7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ddb:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800ddf:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800de3:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800de7:	48 b8 65 0d 80 00 00 	movabs $0x800d65,%rax
+  800dee:	00 00 00 
+  800df1:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800df3:	c9                   	leave
+  800df4:	c3                   	ret
+
+0000000000800df5 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800df5:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800df8:	74 10                	je     800e0a <strlen+0x15>
+    size_t n = 0;
+  800dfa:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800dff:	48 83 c0 01          	add    $0x1,%rax
+  800e03:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800e07:	75 f6                	jne    800dff <strlen+0xa>
+  800e09:	c3                   	ret
+    size_t n = 0;
+  800e0a:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800e0f:	c3                   	ret
+
+0000000000800e10 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800e10:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800e13:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800e18:	48 85 f6             	test   %rsi,%rsi
+  800e1b:	74 11                	je     800e2e <strnlen+0x1e>
+  800e1d:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800e21:	74 0c                	je     800e2f <strnlen+0x1f>
+  800e23:	48 83 c2 01          	add    $0x1,%rdx
+  800e27:	48 39 d0             	cmp    %rdx,%rax
+  800e2a:	75 f1                	jne    800e1d <strnlen+0xd>
+  800e2c:	eb 04                	jmp    800e32 <strnlen+0x22>
+  800e2e:	c3                   	ret
+  800e2f:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800e32:	c3                   	ret
+
+0000000000800e33 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800e33:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800e36:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e3b:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800e3f:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800e42:	48 83 c2 01          	add    $0x1,%rdx
+  800e46:	84 c9                	test   %cl,%cl
+  800e48:	75 f1                	jne    800e3b <strcpy+0x8>
+        ;
+    return res;
+}
+  800e4a:	c3                   	ret
+
+0000000000800e4b <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800e4b:	55                   	push   %rbp
+  800e4c:	48 89 e5             	mov    %rsp,%rbp
+  800e4f:	41 54                	push   %r12
+  800e51:	53                   	push   %rbx
+  800e52:	48 89 fb             	mov    %rdi,%rbx
+  800e55:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800e58:	48 b8 f5 0d 80 00 00 	movabs $0x800df5,%rax
+  800e5f:	00 00 00 
+  800e62:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800e64:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800e68:	4c 89 e6             	mov    %r12,%rsi
+  800e6b:	48 b8 33 0e 80 00 00 	movabs $0x800e33,%rax
+  800e72:	00 00 00 
+  800e75:	ff d0                	call   *%rax
+    return dst;
+}
+  800e77:	48 89 d8             	mov    %rbx,%rax
+  800e7a:	5b                   	pop    %rbx
+  800e7b:	41 5c                	pop    %r12
+  800e7d:	5d                   	pop    %rbp
+  800e7e:	c3                   	ret
+
+0000000000800e7f <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800e7f:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800e82:	48 85 d2             	test   %rdx,%rdx
+  800e85:	74 1f                	je     800ea6 <strncpy+0x27>
+  800e87:	48 01 fa             	add    %rdi,%rdx
+  800e8a:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800e8d:	48 83 c1 01          	add    $0x1,%rcx
+  800e91:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800e95:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800e99:	41 80 f8 01          	cmp    $0x1,%r8b
+  800e9d:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800ea1:	48 39 ca             	cmp    %rcx,%rdx
+  800ea4:	75 e7                	jne    800e8d <strncpy+0xe>
+    }
+    return ret;
+}
+  800ea6:	c3                   	ret
+
+0000000000800ea7 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800ea7:	48 89 f8             	mov    %rdi,%rax
+  800eaa:	48 85 d2             	test   %rdx,%rdx
+  800ead:	74 24                	je     800ed3 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800eaf:	48 83 ea 01          	sub    $0x1,%rdx
+  800eb3:	74 1b                	je     800ed0 <strlcpy+0x29>
+  800eb5:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800eb9:	0f b6 16             	movzbl (%rsi),%edx
+  800ebc:	84 d2                	test   %dl,%dl
+  800ebe:	74 10                	je     800ed0 <strlcpy+0x29>
+            *dst++ = *src++;
+  800ec0:	48 83 c6 01          	add    $0x1,%rsi
+  800ec4:	48 83 c0 01          	add    $0x1,%rax
+  800ec8:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800ecb:	48 39 c8             	cmp    %rcx,%rax
+  800ece:	75 e9                	jne    800eb9 <strlcpy+0x12>
+        *dst = '\0';
+  800ed0:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800ed3:	48 29 f8             	sub    %rdi,%rax
+}
+  800ed6:	c3                   	ret
+
+0000000000800ed7 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800ed7:	0f b6 07             	movzbl (%rdi),%eax
+  800eda:	84 c0                	test   %al,%al
+  800edc:	74 13                	je     800ef1 <strcmp+0x1a>
+  800ede:	38 06                	cmp    %al,(%rsi)
+  800ee0:	75 0f                	jne    800ef1 <strcmp+0x1a>
+  800ee2:	48 83 c7 01          	add    $0x1,%rdi
+  800ee6:	48 83 c6 01          	add    $0x1,%rsi
+  800eea:	0f b6 07             	movzbl (%rdi),%eax
+  800eed:	84 c0                	test   %al,%al
+  800eef:	75 ed                	jne    800ede <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800ef1:	0f b6 c0             	movzbl %al,%eax
+  800ef4:	0f b6 16             	movzbl (%rsi),%edx
+  800ef7:	29 d0                	sub    %edx,%eax
+}
+  800ef9:	c3                   	ret
+
+0000000000800efa <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800efa:	48 85 d2             	test   %rdx,%rdx
+  800efd:	74 1f                	je     800f1e <strncmp+0x24>
+  800eff:	0f b6 07             	movzbl (%rdi),%eax
+  800f02:	84 c0                	test   %al,%al
+  800f04:	74 1e                	je     800f24 <strncmp+0x2a>
+  800f06:	3a 06                	cmp    (%rsi),%al
+  800f08:	75 1a                	jne    800f24 <strncmp+0x2a>
+  800f0a:	48 83 c7 01          	add    $0x1,%rdi
+  800f0e:	48 83 c6 01          	add    $0x1,%rsi
+  800f12:	48 83 ea 01          	sub    $0x1,%rdx
+  800f16:	75 e7                	jne    800eff <strncmp+0x5>
+
+    if (!n) return 0;
+  800f18:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f1d:	c3                   	ret
+  800f1e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f23:	c3                   	ret
+  800f24:	48 85 d2             	test   %rdx,%rdx
+  800f27:	74 09                	je     800f32 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800f29:	0f b6 07             	movzbl (%rdi),%eax
+  800f2c:	0f b6 16             	movzbl (%rsi),%edx
+  800f2f:	29 d0                	sub    %edx,%eax
+  800f31:	c3                   	ret
+    if (!n) return 0;
+  800f32:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800f37:	c3                   	ret
+
+0000000000800f38 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800f38:	0f b6 17             	movzbl (%rdi),%edx
+  800f3b:	84 d2                	test   %dl,%dl
+  800f3d:	74 18                	je     800f57 <strchr+0x1f>
+        if (*str == c) {
+  800f3f:	0f be d2             	movsbl %dl,%edx
+  800f42:	39 f2                	cmp    %esi,%edx
+  800f44:	74 17                	je     800f5d <strchr+0x25>
+    for (; *str; str++) {
+  800f46:	48 83 c7 01          	add    $0x1,%rdi
+  800f4a:	0f b6 17             	movzbl (%rdi),%edx
+  800f4d:	84 d2                	test   %dl,%dl
+  800f4f:	75 ee                	jne    800f3f <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800f51:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f56:	c3                   	ret
+  800f57:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f5c:	c3                   	ret
+  800f5d:	48 89 f8             	mov    %rdi,%rax
+}
+  800f60:	c3                   	ret
+
+0000000000800f61 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800f61:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800f64:	0f b6 17             	movzbl (%rdi),%edx
+  800f67:	84 d2                	test   %dl,%dl
+  800f69:	74 13                	je     800f7e <strfind+0x1d>
+  800f6b:	0f be d2             	movsbl %dl,%edx
+  800f6e:	39 f2                	cmp    %esi,%edx
+  800f70:	74 0b                	je     800f7d <strfind+0x1c>
+  800f72:	48 83 c0 01          	add    $0x1,%rax
+  800f76:	0f b6 10             	movzbl (%rax),%edx
+  800f79:	84 d2                	test   %dl,%dl
+  800f7b:	75 ee                	jne    800f6b <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800f7d:	c3                   	ret
+  800f7e:	c3                   	ret
+
+0000000000800f7f <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800f7f:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800f82:	48 89 f8             	mov    %rdi,%rax
+  800f85:	48 f7 d8             	neg    %rax
+  800f88:	83 e0 07             	and    $0x7,%eax
+  800f8b:	49 89 d1             	mov    %rdx,%r9
+  800f8e:	49 29 c1             	sub    %rax,%r9
+  800f91:	78 36                	js     800fc9 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800f93:	40 0f b6 c6          	movzbl %sil,%eax
+  800f97:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800f9e:	01 01 01 
+  800fa1:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800fa5:	40 f6 c7 07          	test   $0x7,%dil
+  800fa9:	75 38                	jne    800fe3 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800fab:	4c 89 c9             	mov    %r9,%rcx
+  800fae:	48 c1 f9 03          	sar    $0x3,%rcx
+  800fb2:	74 0c                	je     800fc0 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800fb4:	fc                   	cld
+  800fb5:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800fb8:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800fbc:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800fc0:	4d 85 c9             	test   %r9,%r9
+  800fc3:	75 45                	jne    80100a <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800fc5:	4c 89 c0             	mov    %r8,%rax
+  800fc8:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800fc9:	48 85 d2             	test   %rdx,%rdx
+  800fcc:	74 f7                	je     800fc5 <memset+0x46>
+  800fce:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800fd1:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800fd4:	48 83 c0 01          	add    $0x1,%rax
+  800fd8:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  800fdc:	48 39 c2             	cmp    %rax,%rdx
+  800fdf:	75 f3                	jne    800fd4 <memset+0x55>
+  800fe1:	eb e2                	jmp    800fc5 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  800fe3:	40 f6 c7 01          	test   $0x1,%dil
+  800fe7:	74 06                	je     800fef <memset+0x70>
+  800fe9:	88 07                	mov    %al,(%rdi)
+  800feb:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800fef:	40 f6 c7 02          	test   $0x2,%dil
+  800ff3:	74 07                	je     800ffc <memset+0x7d>
+  800ff5:	66 89 07             	mov    %ax,(%rdi)
+  800ff8:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800ffc:	40 f6 c7 04          	test   $0x4,%dil
+  801000:	74 a9                	je     800fab <memset+0x2c>
+  801002:	89 07                	mov    %eax,(%rdi)
+  801004:	48 83 c7 04          	add    $0x4,%rdi
+  801008:	eb a1                	jmp    800fab <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  80100a:	41 f6 c1 04          	test   $0x4,%r9b
+  80100e:	74 06                	je     801016 <memset+0x97>
+  801010:	89 07                	mov    %eax,(%rdi)
+  801012:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  801016:	41 f6 c1 02          	test   $0x2,%r9b
+  80101a:	74 07                	je     801023 <memset+0xa4>
+  80101c:	66 89 07             	mov    %ax,(%rdi)
+  80101f:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  801023:	41 f6 c1 01          	test   $0x1,%r9b
+  801027:	74 9c                	je     800fc5 <memset+0x46>
+  801029:	88 07                	mov    %al,(%rdi)
+  80102b:	eb 98                	jmp    800fc5 <memset+0x46>
+
+000000000080102d <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  80102d:	48 89 f8             	mov    %rdi,%rax
+  801030:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  801033:	48 39 fe             	cmp    %rdi,%rsi
+  801036:	73 3b                	jae    801073 <memmove+0x46>
+  801038:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  80103c:	48 39 d7             	cmp    %rdx,%rdi
+  80103f:	73 32                	jae    801073 <memmove+0x46>
+        s += n;
+        d += n;
+  801041:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  801045:	48 89 d6             	mov    %rdx,%rsi
+  801048:	48 09 fe             	or     %rdi,%rsi
+  80104b:	48 09 ce             	or     %rcx,%rsi
+  80104e:	40 f6 c6 07          	test   $0x7,%sil
+  801052:	75 12                	jne    801066 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  801054:	48 83 ef 08          	sub    $0x8,%rdi
+  801058:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  80105c:	48 c1 e9 03          	shr    $0x3,%rcx
+  801060:	fd                   	std
+  801061:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  801064:	fc                   	cld
+  801065:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  801066:	48 83 ef 01          	sub    $0x1,%rdi
+  80106a:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  80106e:	fd                   	std
+  80106f:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  801071:	eb f1                	jmp    801064 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  801073:	48 89 f2             	mov    %rsi,%rdx
+  801076:	48 09 c2             	or     %rax,%rdx
+  801079:	48 09 ca             	or     %rcx,%rdx
+  80107c:	f6 c2 07             	test   $0x7,%dl
+  80107f:	75 0c                	jne    80108d <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  801081:	48 c1 e9 03          	shr    $0x3,%rcx
+  801085:	48 89 c7             	mov    %rax,%rdi
+  801088:	fc                   	cld
+  801089:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  80108c:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  80108d:	48 89 c7             	mov    %rax,%rdi
+  801090:	fc                   	cld
+  801091:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  801093:	c3                   	ret
+
+0000000000801094 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  801094:	55                   	push   %rbp
+  801095:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  801098:	48 b8 2d 10 80 00 00 	movabs $0x80102d,%rax
+  80109f:	00 00 00 
+  8010a2:	ff d0                	call   *%rax
+}
+  8010a4:	5d                   	pop    %rbp
+  8010a5:	c3                   	ret
+
+00000000008010a6 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  8010a6:	55                   	push   %rbp
+  8010a7:	48 89 e5             	mov    %rsp,%rbp
+  8010aa:	41 57                	push   %r15
+  8010ac:	41 56                	push   %r14
+  8010ae:	41 55                	push   %r13
+  8010b0:	41 54                	push   %r12
+  8010b2:	53                   	push   %rbx
+  8010b3:	48 83 ec 08          	sub    $0x8,%rsp
+  8010b7:	49 89 fe             	mov    %rdi,%r14
+  8010ba:	49 89 f7             	mov    %rsi,%r15
+  8010bd:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  8010c0:	48 89 f7             	mov    %rsi,%rdi
+  8010c3:	48 b8 f5 0d 80 00 00 	movabs $0x800df5,%rax
+  8010ca:	00 00 00 
+  8010cd:	ff d0                	call   *%rax
+  8010cf:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  8010d2:	48 89 de             	mov    %rbx,%rsi
+  8010d5:	4c 89 f7             	mov    %r14,%rdi
+  8010d8:	48 b8 10 0e 80 00 00 	movabs $0x800e10,%rax
+  8010df:	00 00 00 
+  8010e2:	ff d0                	call   *%rax
+  8010e4:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  8010e7:	48 39 c3             	cmp    %rax,%rbx
+  8010ea:	74 36                	je     801122 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  8010ec:	48 89 d8             	mov    %rbx,%rax
+  8010ef:	4c 29 e8             	sub    %r13,%rax
+  8010f2:	49 39 c4             	cmp    %rax,%r12
+  8010f5:	73 31                	jae    801128 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  8010f7:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  8010fc:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  801100:	4c 89 fe             	mov    %r15,%rsi
+  801103:	48 b8 94 10 80 00 00 	movabs $0x801094,%rax
+  80110a:	00 00 00 
+  80110d:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  80110f:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  801113:	48 83 c4 08          	add    $0x8,%rsp
+  801117:	5b                   	pop    %rbx
+  801118:	41 5c                	pop    %r12
+  80111a:	41 5d                	pop    %r13
+  80111c:	41 5e                	pop    %r14
+  80111e:	41 5f                	pop    %r15
+  801120:	5d                   	pop    %rbp
+  801121:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  801122:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  801126:	eb eb                	jmp    801113 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  801128:	48 83 eb 01          	sub    $0x1,%rbx
+  80112c:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  801130:	48 89 da             	mov    %rbx,%rdx
+  801133:	4c 89 fe             	mov    %r15,%rsi
+  801136:	48 b8 94 10 80 00 00 	movabs $0x801094,%rax
+  80113d:	00 00 00 
+  801140:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  801142:	49 01 de             	add    %rbx,%r14
+  801145:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  80114a:	eb c3                	jmp    80110f <strlcat+0x69>
+
+000000000080114c <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  80114c:	48 85 d2             	test   %rdx,%rdx
+  80114f:	74 2d                	je     80117e <memcmp+0x32>
+  801151:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  801156:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  80115a:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  80115f:	44 38 c1             	cmp    %r8b,%cl
+  801162:	75 0f                	jne    801173 <memcmp+0x27>
+    while (n-- > 0) {
+  801164:	48 83 c0 01          	add    $0x1,%rax
+  801168:	48 39 c2             	cmp    %rax,%rdx
+  80116b:	75 e9                	jne    801156 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  80116d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801172:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  801173:	0f b6 c1             	movzbl %cl,%eax
+  801176:	45 0f b6 c0          	movzbl %r8b,%r8d
+  80117a:	44 29 c0             	sub    %r8d,%eax
+  80117d:	c3                   	ret
+    return 0;
+  80117e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801183:	c3                   	ret
+
+0000000000801184 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  801184:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  801188:	48 39 c7             	cmp    %rax,%rdi
+  80118b:	73 0f                	jae    80119c <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  80118d:	40 38 37             	cmp    %sil,(%rdi)
+  801190:	74 0e                	je     8011a0 <memfind+0x1c>
+    for (; src < end; src++) {
+  801192:	48 83 c7 01          	add    $0x1,%rdi
+  801196:	48 39 f8             	cmp    %rdi,%rax
+  801199:	75 f2                	jne    80118d <memfind+0x9>
+  80119b:	c3                   	ret
+  80119c:	48 89 f8             	mov    %rdi,%rax
+  80119f:	c3                   	ret
+  8011a0:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  8011a3:	c3                   	ret
+
+00000000008011a4 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  8011a4:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  8011a7:	0f b6 37             	movzbl (%rdi),%esi
+  8011aa:	40 80 fe 20          	cmp    $0x20,%sil
+  8011ae:	74 06                	je     8011b6 <strtol+0x12>
+  8011b0:	40 80 fe 09          	cmp    $0x9,%sil
+  8011b4:	75 13                	jne    8011c9 <strtol+0x25>
+  8011b6:	48 83 c7 01          	add    $0x1,%rdi
+  8011ba:	0f b6 37             	movzbl (%rdi),%esi
+  8011bd:	40 80 fe 20          	cmp    $0x20,%sil
+  8011c1:	74 f3                	je     8011b6 <strtol+0x12>
+  8011c3:	40 80 fe 09          	cmp    $0x9,%sil
+  8011c7:	74 ed                	je     8011b6 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  8011c9:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  8011cc:	83 e0 fd             	and    $0xfffffffd,%eax
+  8011cf:	3c 01                	cmp    $0x1,%al
+  8011d1:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8011d5:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  8011db:	75 0f                	jne    8011ec <strtol+0x48>
+  8011dd:	80 3f 30             	cmpb   $0x30,(%rdi)
+  8011e0:	74 14                	je     8011f6 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  8011e2:	85 d2                	test   %edx,%edx
+  8011e4:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8011e9:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  8011ec:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  8011f1:	4c 63 ca             	movslq %edx,%r9
+  8011f4:	eb 36                	jmp    80122c <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8011f6:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  8011fa:	74 0f                	je     80120b <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  8011fc:	85 d2                	test   %edx,%edx
+  8011fe:	75 ec                	jne    8011ec <strtol+0x48>
+        s++;
+  801200:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  801204:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  801209:	eb e1                	jmp    8011ec <strtol+0x48>
+        s += 2;
+  80120b:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  80120f:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  801214:	eb d6                	jmp    8011ec <strtol+0x48>
+            dig -= '0';
+  801216:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  801219:	44 0f b6 c1          	movzbl %cl,%r8d
+  80121d:	41 39 d0             	cmp    %edx,%r8d
+  801220:	7d 21                	jge    801243 <strtol+0x9f>
+        val = val * base + dig;
+  801222:	49 0f af c1          	imul   %r9,%rax
+  801226:	0f b6 c9             	movzbl %cl,%ecx
+  801229:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  80122c:	48 83 c7 01          	add    $0x1,%rdi
+  801230:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  801234:	80 f9 39             	cmp    $0x39,%cl
+  801237:	76 dd                	jbe    801216 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  801239:	80 f9 7b             	cmp    $0x7b,%cl
+  80123c:	77 05                	ja     801243 <strtol+0x9f>
+            dig -= 'a' - 10;
+  80123e:	83 e9 57             	sub    $0x57,%ecx
+  801241:	eb d6                	jmp    801219 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  801243:	4d 85 d2             	test   %r10,%r10
+  801246:	74 03                	je     80124b <strtol+0xa7>
+  801248:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  80124b:	48 89 c2             	mov    %rax,%rdx
+  80124e:	48 f7 da             	neg    %rdx
+  801251:	40 80 fe 2d          	cmp    $0x2d,%sil
+  801255:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  801259:	c3                   	ret
+
+000000000080125a <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  80125a:	55                   	push   %rbp
+  80125b:	48 89 e5             	mov    %rsp,%rbp
+  80125e:	53                   	push   %rbx
+  80125f:	48 89 fa             	mov    %rdi,%rdx
+  801262:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801265:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80126a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80126f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801274:	be 00 00 00 00       	mov    $0x0,%esi
+  801279:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80127f:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  801281:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801285:	c9                   	leave
+  801286:	c3                   	ret
+
+0000000000801287 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  801287:	55                   	push   %rbp
+  801288:	48 89 e5             	mov    %rsp,%rbp
+  80128b:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80128c:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801291:	ba 00 00 00 00       	mov    $0x0,%edx
+  801296:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80129b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012a0:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012a5:	be 00 00 00 00       	mov    $0x0,%esi
+  8012aa:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8012b0:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  8012b2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012b6:	c9                   	leave
+  8012b7:	c3                   	ret
+
+00000000008012b8 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  8012b8:	55                   	push   %rbp
+  8012b9:	48 89 e5             	mov    %rsp,%rbp
+  8012bc:	53                   	push   %rbx
+  8012bd:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  8012c1:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8012c4:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8012c9:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8012ce:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012d3:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012d8:	be 00 00 00 00       	mov    $0x0,%esi
+  8012dd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8012e3:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8012e5:	48 85 c0             	test   %rax,%rax
+  8012e8:	7f 06                	jg     8012f0 <sys_env_destroy+0x38>
+}
+  8012ea:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012ee:	c9                   	leave
+  8012ef:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8012f0:	49 89 c0             	mov    %rax,%r8
+  8012f3:	b9 03 00 00 00       	mov    $0x3,%ecx
+  8012f8:	48 ba 30 38 80 00 00 	movabs $0x803830,%rdx
+  8012ff:	00 00 00 
+  801302:	be 26 00 00 00       	mov    $0x26,%esi
+  801307:	48 bf 4f 38 80 00 00 	movabs $0x80384f,%rdi
+  80130e:	00 00 00 
+  801311:	b8 00 00 00 00       	mov    $0x0,%eax
+  801316:	49 b9 be 03 80 00 00 	movabs $0x8003be,%r9
+  80131d:	00 00 00 
+  801320:	41 ff d1             	call   *%r9
+
+0000000000801323 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  801323:	55                   	push   %rbp
+  801324:	48 89 e5             	mov    %rsp,%rbp
+  801327:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801328:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80132d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801332:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801337:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80133c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801341:	be 00 00 00 00       	mov    $0x0,%esi
+  801346:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80134c:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  80134e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801352:	c9                   	leave
+  801353:	c3                   	ret
+
+0000000000801354 <sys_yield>:
+
+void
+sys_yield(void) {
+  801354:	55                   	push   %rbp
+  801355:	48 89 e5             	mov    %rsp,%rbp
+  801358:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801359:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80135e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801363:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801368:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80136d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801372:	be 00 00 00 00       	mov    $0x0,%esi
+  801377:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80137d:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  80137f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801383:	c9                   	leave
+  801384:	c3                   	ret
+
+0000000000801385 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  801385:	55                   	push   %rbp
+  801386:	48 89 e5             	mov    %rsp,%rbp
+  801389:	53                   	push   %rbx
+  80138a:	48 89 fa             	mov    %rdi,%rdx
+  80138d:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801390:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801395:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  80139c:	00 00 00 
+  80139f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013a4:	be 00 00 00 00       	mov    $0x0,%esi
+  8013a9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013af:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  8013b1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013b5:	c9                   	leave
+  8013b6:	c3                   	ret
+
+00000000008013b7 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  8013b7:	55                   	push   %rbp
+  8013b8:	48 89 e5             	mov    %rsp,%rbp
+  8013bb:	53                   	push   %rbx
+  8013bc:	49 89 f8             	mov    %rdi,%r8
+  8013bf:	48 89 d3             	mov    %rdx,%rbx
+  8013c2:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8013c5:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8013ca:	4c 89 c2             	mov    %r8,%rdx
+  8013cd:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013d0:	be 00 00 00 00       	mov    $0x0,%esi
+  8013d5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013db:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  8013dd:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013e1:	c9                   	leave
+  8013e2:	c3                   	ret
+
+00000000008013e3 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  8013e3:	55                   	push   %rbp
+  8013e4:	48 89 e5             	mov    %rsp,%rbp
+  8013e7:	53                   	push   %rbx
+  8013e8:	48 83 ec 08          	sub    $0x8,%rsp
+  8013ec:	89 f8                	mov    %edi,%eax
+  8013ee:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  8013f1:	48 63 f9             	movslq %ecx,%rdi
+  8013f4:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8013f7:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8013fc:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013ff:	be 00 00 00 00       	mov    $0x0,%esi
+  801404:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80140a:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80140c:	48 85 c0             	test   %rax,%rax
+  80140f:	7f 06                	jg     801417 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  801411:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801415:	c9                   	leave
+  801416:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801417:	49 89 c0             	mov    %rax,%r8
+  80141a:	b9 04 00 00 00       	mov    $0x4,%ecx
+  80141f:	48 ba 30 38 80 00 00 	movabs $0x803830,%rdx
+  801426:	00 00 00 
+  801429:	be 26 00 00 00       	mov    $0x26,%esi
+  80142e:	48 bf 4f 38 80 00 00 	movabs $0x80384f,%rdi
+  801435:	00 00 00 
+  801438:	b8 00 00 00 00       	mov    $0x0,%eax
+  80143d:	49 b9 be 03 80 00 00 	movabs $0x8003be,%r9
+  801444:	00 00 00 
+  801447:	41 ff d1             	call   *%r9
+
+000000000080144a <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  80144a:	55                   	push   %rbp
+  80144b:	48 89 e5             	mov    %rsp,%rbp
+  80144e:	53                   	push   %rbx
+  80144f:	48 83 ec 08          	sub    $0x8,%rsp
+  801453:	89 f8                	mov    %edi,%eax
+  801455:	49 89 f2             	mov    %rsi,%r10
+  801458:	48 89 cf             	mov    %rcx,%rdi
+  80145b:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  80145e:	48 63 da             	movslq %edx,%rbx
+  801461:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801464:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801469:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80146c:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  80146f:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801471:	48 85 c0             	test   %rax,%rax
+  801474:	7f 06                	jg     80147c <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  801476:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80147a:	c9                   	leave
+  80147b:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80147c:	49 89 c0             	mov    %rax,%r8
+  80147f:	b9 05 00 00 00       	mov    $0x5,%ecx
+  801484:	48 ba 30 38 80 00 00 	movabs $0x803830,%rdx
+  80148b:	00 00 00 
+  80148e:	be 26 00 00 00       	mov    $0x26,%esi
+  801493:	48 bf 4f 38 80 00 00 	movabs $0x80384f,%rdi
+  80149a:	00 00 00 
+  80149d:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014a2:	49 b9 be 03 80 00 00 	movabs $0x8003be,%r9
+  8014a9:	00 00 00 
+  8014ac:	41 ff d1             	call   *%r9
+
+00000000008014af <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  8014af:	55                   	push   %rbp
+  8014b0:	48 89 e5             	mov    %rsp,%rbp
+  8014b3:	53                   	push   %rbx
+  8014b4:	48 83 ec 08          	sub    $0x8,%rsp
+  8014b8:	48 89 f1             	mov    %rsi,%rcx
+  8014bb:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  8014be:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8014c1:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8014c6:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014cb:	be 00 00 00 00       	mov    $0x0,%esi
+  8014d0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014d6:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8014d8:	48 85 c0             	test   %rax,%rax
+  8014db:	7f 06                	jg     8014e3 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  8014dd:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014e1:	c9                   	leave
+  8014e2:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8014e3:	49 89 c0             	mov    %rax,%r8
+  8014e6:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8014eb:	48 ba 30 38 80 00 00 	movabs $0x803830,%rdx
+  8014f2:	00 00 00 
+  8014f5:	be 26 00 00 00       	mov    $0x26,%esi
+  8014fa:	48 bf 4f 38 80 00 00 	movabs $0x80384f,%rdi
+  801501:	00 00 00 
+  801504:	b8 00 00 00 00       	mov    $0x0,%eax
+  801509:	49 b9 be 03 80 00 00 	movabs $0x8003be,%r9
+  801510:	00 00 00 
+  801513:	41 ff d1             	call   *%r9
+
+0000000000801516 <sys_region_batch>:
+
+int
+sys_region_batch(const struct RegionOp *ops, size_t count) {
+  801516:	55                   	push   %rbp
+  801517:	48 89 e5             	mov    %rsp,%rbp
+  80151a:	53                   	push   %rbx
+  80151b:	48 83 ec 08          	sub    $0x8,%rsp
+  80151f:	48 89 fa             	mov    %rdi,%rdx
+  801522:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801525:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80152a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80152f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801534:	be 00 00 00 00       	mov    $0x0,%esi
+  801539:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80153f:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801541:	48 85 c0             	test   %rax,%rax
+  801544:	7f 06                	jg     80154c <sys_region_batch+0x36>
+        else
+            platform_asan_unpoison(va, ops[i].size);
+    }
+#endif
+    return res;
+}
+  801546:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80154a:	c9                   	leave
+  80154b:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80154c:	49 89 c0             	mov    %rax,%r8
+  80154f:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  801554:	48 ba 30 38 80 00 00 	movabs $0x803830,%rdx
+  80155b:	00 00 00 
+  80155e:	be 26 00 00 00       	mov    $0x26,%esi
+  801563:	48 bf 4f 38 80 00 00 	movabs $0x80384f,%rdi
+  80156a:	00 00 00 
+  80156d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801572:	49 b9 be 03 80 00 00 	movabs $0x8003be,%r9
+  801579:	00 00 00 
+  80157c:	41 ff d1             	call   *%r9
+
+000000000080157f <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  80157f:	55                   	push   %rbp
+  801580:	48 89 e5             	mov    %rsp,%rbp
+  801583:	53                   	push   %rbx
+  801584:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  801588:	48 63 ce             	movslq %esi,%rcx
+  80158b:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80158e:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801593:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801598:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80159d:	be 00 00 00 00       	mov    $0x0,%esi
+  8015a2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015a8:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8015aa:	48 85 c0             	test   %rax,%rax
+  8015ad:	7f 06                	jg     8015b5 <sys_env_set_status+0x36>
+}
+  8015af:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015b3:	c9                   	leave
+  8015b4:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8015b5:	49 89 c0             	mov    %rax,%r8
+  8015b8:	b9 09 00 00 00       	mov    $0x9,%ecx
+  8015bd:	48 ba 30 38 80 00 00 	movabs $0x803830,%rdx
+  8015c4:	00 00 00 
+  8015c7:	be 26 00 00 00       	mov    $0x26,%esi
+  8015cc:	48 bf 4f 38 80 00 00 	movabs $0x80384f,%rdi
+  8015d3:	00 00 00 
+  8015d6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015db:	49 b9 be 03 80 00 00 	movabs $0x8003be,%r9
+  8015e2:	00 00 00 
+  8015e5:	41 ff d1             	call   *%r9
+
+00000000008015e8 <sys_env_set_weight>:
+
+int
+sys_env_set_weight(envid_t envid, uint32_t weight) {
+  8015e8:	55                   	push   %rbp
+  8015e9:	48 89 e5             	mov    %rsp,%rbp
+  8015ec:	53                   	push   %rbx
+  8015ed:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_weight, 1, envid, weight, 0, 0, 0, 0);
+  8015f1:	89 f1                	mov    %esi,%ecx
+  8015f3:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8015f6:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8015fb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801600:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801605:	be 00 00 00 00       	mov    $0x0,%esi
+  80160a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801610:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801612:	48 85 c0             	test   %rax,%rax
+  801615:	7f 06                	jg     80161d <sys_env_set_weight+0x35>
+}
+  801617:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80161b:	c9                   	leave
+  80161c:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80161d:	49 89 c0             	mov    %rax,%r8
+  801620:	b9 10 00 00 00       	mov    $0x10,%ecx
+  801625:	48 ba 30 38 80 00 00 	movabs $0x803830,%rdx
+  80162c:	00 00 00 
+  80162f:	be 26 00 00 00       	mov    $0x26,%esi
+  801634:	48 bf 4f 38 80 00 00 	movabs $0x80384f,%rdi
+  80163b:	00 00 00 
+  80163e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801643:	49 b9 be 03 80 00 00 	movabs $0x8003be,%r9
+  80164a:	00 00 00 
+  80164d:	41 ff d1             	call   *%r9
+
+0000000000801650 <sys_env_set_rt>:
+
+int
+sys_env_set_rt(envid_t envid, uint64_t period, uint64_t budget, uint64_t deadline) {
+  801650:	55                   	push   %rbp
+  801651:	48 89 e5             	mov    %rsp,%rbp
+  801654:	53                   	push   %rbx
+  801655:	48 83 ec 08          	sub    $0x8,%rsp
+  801659:	89 f8                	mov    %edi,%eax
+  80165b:	48 89 d3             	mov    %rdx,%rbx
+  80165e:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_env_set_rt, 1, envid, period, budget, deadline, 0, 0);
+  801661:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801664:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801669:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80166c:	be 00 00 00 00       	mov    $0x0,%esi
+  801671:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801677:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801679:	48 85 c0             	test   %rax,%rax
+  80167c:	7f 06                	jg     801684 <sys_env_set_rt+0x34>
+}
+  80167e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801682:	c9                   	leave
+  801683:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801684:	49 89 c0             	mov    %rax,%r8
+  801687:	b9 11 00 00 00       	mov    $0x11,%ecx
+  80168c:	48 ba 30 38 80 00 00 	movabs $0x803830,%rdx
+  801693:	00 00 00 
+  801696:	be 26 00 00 00       	mov    $0x26,%esi
+  80169b:	48 bf 4f 38 80 00 00 	movabs $0x80384f,%rdi
+  8016a2:	00 00 00 
+  8016a5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016aa:	49 b9 be 03 80 00 00 	movabs $0x8003be,%r9
+  8016b1:	00 00 00 
+  8016b4:	41 ff d1             	call   *%r9
+
+00000000008016b7 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  8016b7:	55                   	push   %rbp
+  8016b8:	48 89 e5             	mov    %rsp,%rbp
+  8016bb:	53                   	push   %rbx
+  8016bc:	48 83 ec 08          	sub    $0x8,%rsp
+  8016c0:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  8016c3:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8016c6:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8016cb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016d0:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8016d5:	be 00 00 00 00       	mov    $0x0,%esi
+  8016da:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8016e0:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8016e2:	48 85 c0             	test   %rax,%rax
+  8016e5:	7f 06                	jg     8016ed <sys_env_set_trapframe+0x36>
+}
+  8016e7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8016eb:	c9                   	leave
+  8016ec:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8016ed:	49 89 c0             	mov    %rax,%r8
+  8016f0:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  8016f5:	48 ba 30 38 80 00 00 	movabs $0x803830,%rdx
+  8016fc:	00 00 00 
+  8016ff:	be 26 00 00 00       	mov    $0x26,%esi
+  801704:	48 bf 4f 38 80 00 00 	movabs $0x80384f,%rdi
+  80170b:	00 00 00 
+  80170e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801713:	49 b9 be 03 80 00 00 	movabs $0x8003be,%r9
+  80171a:	00 00 00 
+  80171d:	41 ff d1             	call   *%r9
+
+0000000000801720 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  801720:	55                   	push   %rbp
+  801721:	48 89 e5             	mov    %rsp,%rbp
+  801724:	53                   	push   %rbx
+  801725:	48 83 ec 08          	sub    $0x8,%rsp
+  801729:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  80172c:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80172f:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801734:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801739:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80173e:	be 00 00 00 00       	mov    $0x0,%esi
+  801743:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801749:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80174b:	48 85 c0             	test   %rax,%rax
+  80174e:	7f 06                	jg     801756 <sys_env_set_pgfault_upcall+0x36>
+}
+  801750:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801754:	c9                   	leave
+  801755:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801756:	49 89 c0             	mov    %rax,%r8
+  801759:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  80175e:	48 ba 30 38 80 00 00 	movabs $0x803830,%rdx
+  801765:	00 00 00 
+  801768:	be 26 00 00 00       	mov    $0x26,%esi
+  80176d:	48 bf 4f 38 80 00 00 	movabs $0x80384f,%rdi
+  801774:	00 00 00 
+  801777:	b8 00 00 00 00       	mov    $0x0,%eax
+  80177c:	49 b9 be 03 80 00 00 	movabs $0x8003be,%r9
+  801783:	00 00 00 
+  801786:	41 ff d1             	call   *%r9
+
+0000000000801789 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  801789:	55                   	push   %rbp
+  80178a:	48 89 e5             	mov    %rsp,%rbp
+  80178d:	53                   	push   %rbx
+  80178e:	89 f8                	mov    %edi,%eax
+  801790:	49 89 f1             	mov    %rsi,%r9
+  801793:	48 89 d3             	mov    %rdx,%rbx
+  801796:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  801799:	49 63 f0             	movslq %r8d,%rsi
+  80179c:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80179f:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8017a4:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8017a7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8017ad:	cd 30                	int    $0x30
+}
+  8017af:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8017b3:	c9                   	leave
+  8017b4:	c3                   	ret
+
+00000000008017b5 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  8017b5:	55                   	push   %rbp
+  8017b6:	48 89 e5             	mov    %rsp,%rbp
+  8017b9:	53                   	push   %rbx
+  8017ba:	48 83 ec 08          	sub    $0x8,%rsp
+  8017be:	48 89 fa             	mov    %rdi,%rdx
+  8017c1:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8017c4:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8017c9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017ce:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8017d3:	be 00 00 00 00       	mov    $0x0,%esi
+  8017d8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8017de:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8017e0:	48 85 c0             	test   %rax,%rax
+  8017e3:	7f 06                	jg     8017eb <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8017e5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8017e9:	c9                   	leave
+  8017ea:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8017eb:	49 89 c0             	mov    %rax,%r8
+  8017ee:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  8017f3:	48 ba 30 38 80 00 00 	movabs $0x803830,%rdx
+  8017fa:	00 00 00 
+  8017fd:	be 26 00 00 00       	mov    $0x26,%esi
+  801802:	48 bf 4f 38 80 00 00 	movabs $0x80384f,%rdi
+  801809:	00 00 00 
+  80180c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801811:	49 b9 be 03 80 00 00 	movabs $0x8003be,%r9
+  801818:	00 00 00 
+  80181b:	41 ff d1             	call   *%r9
+
+000000000080181e <fork>:
+ * Hint:
+ *   Use sys_map_region, it can perform address space copying in one call
+ *   Remember to fix "thisenv" in the child process.
+ */
+envid_t
+fork(void) {
+  80181e:	55                   	push   %rbp
+  80181f:	48 89 e5             	mov    %rsp,%rbp
+  801822:	41 55                	push   %r13
+  801824:	41 54                	push   %r12
+  801826:	53                   	push   %rbx
+  801827:	48 83 ec 08          	sub    $0x8,%rsp
+
+/* This must be inlined. Exercise for reader: why? */
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+    envid_t ret;
+    asm volatile("int %2"
+  80182b:	b8 08 00 00 00       	mov    $0x8,%eax
+  801830:	cd 30                	int    $0x30
+  801832:	41 89 c5             	mov    %eax,%r13d
+    // LAB 9: Your code here
+
+    envid_t child_id = sys_exofork();
+    if (child_id < 0) {
+  801835:	85 c0                	test   %eax,%eax
+  801837:	0f 88 ae 00 00 00    	js     8018eb <fork+0xcd>
+  80183d:	89 c3                	mov    %eax,%ebx
+        return child_id;
+    }
+    if (child_id == 0) {
+  80183f:	0f 84 b4 00 00 00    	je     8018f9 <fork+0xdb>
+        thisenv = &envs[ENVX(sys_getenvid())];
+        return 0;
+    }
+    int res = sys_map_region(0, NULL, child_id, NULL, MAX_USER_ADDRESS, PROT_ALL | PROT_LAZY | PROT_COMBINE);
+  801845:	41 b9 df 01 00 00    	mov    $0x1df,%r9d
+  80184b:	49 b8 00 00 00 00 80 	movabs $0x8000000000,%r8
+  801852:	00 00 00 
+  801855:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80185a:	89 c2                	mov    %eax,%edx
+  80185c:	be 00 00 00 00       	mov    $0x0,%esi
+  801861:	bf 00 00 00 00       	mov    $0x0,%edi
+  801866:	48 b8 4a 14 80 00 00 	movabs $0x80144a,%rax
+  80186d:	00 00 00 
+  801870:	ff d0                	call   *%rax
+  801872:	41 89 c4             	mov    %eax,%r12d
+    if (res < 0) {
+  801875:	85 c0                	test   %eax,%eax
+  801877:	78 5d                	js     8018d6 <fork+0xb8>
+        goto error;
+    }
+    res = sys_env_set_pgfault_upcall(child_id, envs[ENVX(sys_getenvid())].env_pgfault_upcall);
+  801879:	48 b8 23 13 80 00 00 	movabs $0x801323,%rax
+  801880:	00 00 00 
+  801883:	ff d0                	call   *%rax
+  801885:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80188a:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+  801891:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  801898:	00 00 00 
+  80189b:	48 01 d0             	add    %rdx,%rax
+  80189e:	48 8b b0 88 01 00 00 	mov    0x188(%rax),%rsi
+  8018a5:	44 89 ef             	mov    %r13d,%edi
+  8018a8:	48 b8 20 17 80 00 00 	movabs $0x801720,%rax
+  8018af:	00 00 00 
+  8018b2:	ff d0                	call   *%rax
+  8018b4:	41 89 c4             	mov    %eax,%r12d
+    if (res < 0) {
+  8018b7:	85 c0                	test   %eax,%eax
+  8018b9:	78 1b                	js     8018d6 <fork+0xb8>
+        goto error;
+    }
+    res = sys_env_set_status(child_id, ENV_RUNNABLE);
+  8018bb:	be 02 00 00 00       	mov    $0x2,%esi
+  8018c0:	44 89 ef             	mov    %r13d,%edi
+  8018c3:	48 b8 7f 15 80 00 00 	movabs $0x80157f,%rax
+  8018ca:	00 00 00 
+  8018cd:	ff d0                	call   *%rax
+  8018cf:	41 89 c4             	mov    %eax,%r12d
+    if (res < 0) {
+  8018d2:	85 c0                	test   %eax,%eax
+  8018d4:	79 15                	jns    8018eb <fork+0xcd>
+        goto error;
+    }
+    return child_id;
+error:
+    ;
+    int res2 = sys_env_destroy(child_id);
+  8018d6:	89 df                	mov    %ebx,%edi
+  8018d8:	48 b8 b8 12 80 00 00 	movabs $0x8012b8,%rax
+  8018df:	00 00 00 
+  8018e2:	ff d0                	call   *%rax
+    if (res2 < 0) {
+  8018e4:	85 c0                	test   %eax,%eax
+  8018e6:	78 42                	js     80192a <fork+0x10c>
+        panic("Fork double fault");
+    }
+    return res;
+  8018e8:	45 89 e5             	mov    %r12d,%r13d
+}
+  8018eb:	44 89 e8             	mov    %r13d,%eax
+  8018ee:	48 83 c4 08          	add    $0x8,%rsp
+  8018f2:	5b                   	pop    %rbx
+  8018f3:	41 5c                	pop    %r12
+  8018f5:	41 5d                	pop    %r13
+  8018f7:	5d                   	pop    %rbp
+  8018f8:	c3                   	ret
+        thisenv = &envs[ENVX(sys_getenvid())];
+  8018f9:	48 b8 23 13 80 00 00 	movabs $0x801323,%rax
+  801900:	00 00 00 
+  801903:	ff d0                	call   *%rax
+  801905:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80190a:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+  801911:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  801918:	00 00 00 
+  80191b:	48 01 d0             	add    %rdx,%rax
+  80191e:	48 a3 00 54 80 00 00 	movabs %rax,0x805400
+  801925:	00 00 00 
+        return 0;
+  801928:	eb c1                	jmp    8018eb <fork+0xcd>
+        panic("Fork double fault");
+  80192a:	48 ba 5d 38 80 00 00 	movabs $0x80385d,%rdx
+  801931:	00 00 00 
+  801934:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801939:	48 bf 6f 38 80 00 00 	movabs $0x80386f,%rdi
+  801940:	00 00 00 
+  801943:	b8 00 00 00 00       	mov    $0x0,%eax
+  801948:	48 b9 be 03 80 00 00 	movabs $0x8003be,%rcx
+  80194f:	00 00 00 
+  801952:	ff d1                	call   *%rcx
+
+0000000000801954 <sfork>:
+
+envid_t
+sfork() {
+  801954:	55                   	push   %rbp
+  801955:	48 89 e5             	mov    %rsp,%rbp
+    panic("sfork() is not implemented");
+  801958:	48 ba 7a 38 80 00 00 	movabs $0x80387a,%rdx
+  80195f:	00 00 00 
+  801962:	be 36 00 00 00       	mov    $0x36,%esi
+  801967:	48 bf 6f 38 80 00 00 	movabs $0x80386f,%rdi
+  80196e:	00 00 00 
+  801971:	b8 00 00 00 00       	mov    $0x0,%eax
+  801976:	48 b9 be 03 80 00 00 	movabs $0x8003be,%rcx
+  80197d:	00 00 00 
+  801980:	ff d1                	call   *%rcx
+
+0000000000801982 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801982:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801989:	ff ff ff 
+  80198c:	48 01 f8             	add    %rdi,%rax
+  80198f:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  801993:	c3                   	ret
+
+0000000000801994 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801994:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  80199b:	ff ff ff 
+  80199e:	48 01 f8             	add    %rdi,%rax
+  8019a1:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  8019a5:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  8019ab:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  8019af:	c3                   	ret
+
+00000000008019b0 <fd_alloc_from>:
+}
+
+/* Like fd_alloc(), but only considers fds starting from fdnum,
+ * so that several fds can be found before their pages are allocated */
+int
+fd_alloc_from(int fdnum, struct Fd **fd_store) {
+  8019b0:	55                   	push   %rbp
+  8019b1:	48 89 e5             	mov    %rsp,%rbp
+  8019b4:	41 57                	push   %r15
+  8019b6:	41 56                	push   %r14
+  8019b8:	41 55                	push   %r13
+  8019ba:	41 54                	push   %r12
+  8019bc:	53                   	push   %rbx
+  8019bd:	48 83 ec 08          	sub    $0x8,%rsp
+  8019c1:	49 89 f7             	mov    %rsi,%r15
+    for (int i = MAX(fdnum, 0); i < MAXFD; i++) {
+  8019c4:	85 ff                	test   %edi,%edi
+  8019c6:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8019cc:	44 0f 49 e7          	cmovns %edi,%r12d
+  8019d0:	83 ff 1f             	cmp    $0x1f,%edi
+  8019d3:	7f 37                	jg     801a0c <fd_alloc_from+0x5c>
+  8019d5:	49 63 dc             	movslq %r12d,%rbx
+  8019d8:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  8019df:	48 c1 e3 0c          	shl    $0xc,%rbx
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  8019e3:	49 be 72 2b 80 00 00 	movabs $0x802b72,%r14
+  8019ea:	00 00 00 
+        struct Fd *fd = INDEX2FD(i);
+  8019ed:	49 89 dd             	mov    %rbx,%r13
+        if (!(get_prot(fd) & PROT_R)) {
+  8019f0:	48 89 df             	mov    %rbx,%rdi
+  8019f3:	41 ff d6             	call   *%r14
+  8019f6:	83 e0 04             	and    $0x4,%eax
+  8019f9:	74 1c                	je     801a17 <fd_alloc_from+0x67>
+    for (int i = MAX(fdnum, 0); i < MAXFD; i++) {
+  8019fb:	41 83 c4 01          	add    $0x1,%r12d
+  8019ff:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801a06:	41 83 fc 1f          	cmp    $0x1f,%r12d
+  801a0a:	7e e1                	jle    8019ed <fd_alloc_from+0x3d>
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  801a0c:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801a12:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  801a17:	4d 89 2f             	mov    %r13,(%r15)
+}
+  801a1a:	48 83 c4 08          	add    $0x8,%rsp
+  801a1e:	5b                   	pop    %rbx
+  801a1f:	41 5c                	pop    %r12
+  801a21:	41 5d                	pop    %r13
+  801a23:	41 5e                	pop    %r14
+  801a25:	41 5f                	pop    %r15
+  801a27:	5d                   	pop    %rbp
+  801a28:	c3                   	ret
+
+0000000000801a29 <fd_alloc>:
+fd_alloc(struct Fd **fd_store) {
+  801a29:	55                   	push   %rbp
+  801a2a:	48 89 e5             	mov    %rsp,%rbp
+  801a2d:	48 89 fe             	mov    %rdi,%rsi
+    return fd_alloc_from(0, fd_store);
+  801a30:	bf 00 00 00 00       	mov    $0x0,%edi
+  801a35:	48 b8 b0 19 80 00 00 	movabs $0x8019b0,%rax
+  801a3c:	00 00 00 
+  801a3f:	ff d0                	call   *%rax
+}
+  801a41:	5d                   	pop    %rbp
+  801a42:	c3                   	ret
+
+0000000000801a43 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  801a43:	83 ff 1f             	cmp    $0x1f,%edi
+  801a46:	77 39                	ja     801a81 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  801a48:	55                   	push   %rbp
+  801a49:	48 89 e5             	mov    %rsp,%rbp
+  801a4c:	41 54                	push   %r12
+  801a4e:	53                   	push   %rbx
+  801a4f:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  801a52:	48 63 df             	movslq %edi,%rbx
+  801a55:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  801a5c:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  801a60:	48 89 df             	mov    %rbx,%rdi
+  801a63:	48 b8 72 2b 80 00 00 	movabs $0x802b72,%rax
+  801a6a:	00 00 00 
+  801a6d:	ff d0                	call   *%rax
+  801a6f:	a8 04                	test   $0x4,%al
+  801a71:	74 14                	je     801a87 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  801a73:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  801a77:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801a7c:	5b                   	pop    %rbx
+  801a7d:	41 5c                	pop    %r12
+  801a7f:	5d                   	pop    %rbp
+  801a80:	c3                   	ret
+        return -E_INVAL;
+  801a81:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801a86:	c3                   	ret
+        return -E_INVAL;
+  801a87:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801a8c:	eb ee                	jmp    801a7c <fd_lookup+0x39>
+
+0000000000801a8e <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  801a8e:	55                   	push   %rbp
+  801a8f:	48 89 e5             	mov    %rsp,%rbp
+  801a92:	41 54                	push   %r12
+  801a94:	53                   	push   %rbx
+  801a95:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  801a98:	48 b8 20 39 80 00 00 	movabs $0x803920,%rax
+  801a9f:	00 00 00 
+  801aa2:	48 bb 20 40 80 00 00 	movabs $0x804020,%rbx
+  801aa9:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  801aac:	39 3b                	cmp    %edi,(%rbx)
+  801aae:	74 47                	je     801af7 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  801ab0:	48 83 c0 08          	add    $0x8,%rax
+  801ab4:	48 8b 18             	mov    (%rax),%rbx
+  801ab7:	48 85 db             	test   %rbx,%rbx
+  801aba:	75 f0                	jne    801aac <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801abc:	48 a1 00 54 80 00 00 	movabs 0x805400,%rax
+  801ac3:	00 00 00 
+  801ac6:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+  801acc:	89 fa                	mov    %edi,%edx
+  801ace:	48 bf 98 38 80 00 00 	movabs $0x803898,%rdi
+  801ad5:	00 00 00 
+  801ad8:	b8 00 00 00 00       	mov    $0x0,%eax
+  801add:	48 b9 0e 05 80 00 00 	movabs $0x80050e,%rcx
+  801ae4:	00 00 00 
+  801ae7:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  801ae9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  801aee:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  801af2:	5b                   	pop    %rbx
+  801af3:	41 5c                	pop    %r12
+  801af5:	5d                   	pop    %rbp
+  801af6:	c3                   	ret
+            return 0;
+  801af7:	b8 00 00 00 00       	mov    $0x0,%eax
+  801afc:	eb f0                	jmp    801aee <dev_lookup+0x60>
+
+0000000000801afe <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  801afe:	55                   	push   %rbp
+  801aff:	48 89 e5             	mov    %rsp,%rbp
+  801b02:	41 55                	push   %r13
+  801b04:	41 54                	push   %r12
+  801b06:	53                   	push   %rbx
+  801b07:	48 83 ec 18          	sub    $0x18,%rsp
+  801b0b:	48 89 fb             	mov    %rdi,%rbx
+  801b0e:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801b11:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  801b18:	ff ff ff 
+  801b1b:	48 01 df             	add    %rbx,%rdi
+  801b1e:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  801b22:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801b26:	48 b8 43 1a 80 00 00 	movabs $0x801a43,%rax
+  801b2d:	00 00 00 
+  801b30:	ff d0                	call   *%rax
+  801b32:	41 89 c5             	mov    %eax,%r13d
+  801b35:	85 c0                	test   %eax,%eax
+  801b37:	78 06                	js     801b3f <fd_close+0x41>
+  801b39:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  801b3d:	74 1a                	je     801b59 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  801b3f:	45 84 e4             	test   %r12b,%r12b
+  801b42:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b47:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  801b4b:	44 89 e8             	mov    %r13d,%eax
+  801b4e:	48 83 c4 18          	add    $0x18,%rsp
+  801b52:	5b                   	pop    %rbx
+  801b53:	41 5c                	pop    %r12
+  801b55:	41 5d                	pop    %r13
+  801b57:	5d                   	pop    %rbp
+  801b58:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801b59:	8b 3b                	mov    (%rbx),%edi
+  801b5b:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801b5f:	48 b8 8e 1a 80 00 00 	movabs $0x801a8e,%rax
+  801b66:	00 00 00 
+  801b69:	ff d0                	call   *%rax
+  801b6b:	41 89 c5             	mov    %eax,%r13d
+  801b6e:	85 c0                	test   %eax,%eax
+  801b70:	78 1b                	js     801b8d <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  801b72:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801b76:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801b7a:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801b80:	48 85 c0             	test   %rax,%rax
+  801b83:	74 08                	je     801b8d <fd_close+0x8f>
+  801b85:	48 89 df             	mov    %rbx,%rdi
+  801b88:	ff d0                	call   *%rax
+  801b8a:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801b8d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801b92:	48 89 de             	mov    %rbx,%rsi
+  801b95:	bf 00 00 00 00       	mov    $0x0,%edi
+  801b9a:	48 b8 af 14 80 00 00 	movabs $0x8014af,%rax
+  801ba1:	00 00 00 
+  801ba4:	ff d0                	call   *%rax
+    return res;
+  801ba6:	eb a3                	jmp    801b4b <fd_close+0x4d>
+
+0000000000801ba8 <close>:
+
+int
+close(int fdnum) {
+  801ba8:	55                   	push   %rbp
+  801ba9:	48 89 e5             	mov    %rsp,%rbp
+  801bac:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  801bb0:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801bb4:	48 b8 43 1a 80 00 00 	movabs $0x801a43,%rax
+  801bbb:	00 00 00 
+  801bbe:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801bc0:	85 c0                	test   %eax,%eax
+  801bc2:	78 15                	js     801bd9 <close+0x31>
+
+    return fd_close(fd, 1);
+  801bc4:	be 01 00 00 00       	mov    $0x1,%esi
+  801bc9:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801bcd:	48 b8 fe 1a 80 00 00 	movabs $0x801afe,%rax
+  801bd4:	00 00 00 
+  801bd7:	ff d0                	call   *%rax
+}
+  801bd9:	c9                   	leave
+  801bda:	c3                   	ret
+
+0000000000801bdb <close_all>:
+
+void
+close_all(void) {
+  801bdb:	55                   	push   %rbp
+  801bdc:	48 89 e5             	mov    %rsp,%rbp
+  801bdf:	41 54                	push   %r12
+  801be1:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  801be2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801be7:	49 bc a8 1b 80 00 00 	movabs $0x801ba8,%r12
+  801bee:	00 00 00 
+  801bf1:	89 df                	mov    %ebx,%edi
+  801bf3:	41 ff d4             	call   *%r12
+  801bf6:	83 c3 01             	add    $0x1,%ebx
+  801bf9:	83 fb 20             	cmp    $0x20,%ebx
+  801bfc:	75 f3                	jne    801bf1 <close_all+0x16>
+}
+  801bfe:	5b                   	pop    %rbx
+  801bff:	41 5c                	pop    %r12
+  801c01:	5d                   	pop    %rbp
+  801c02:	c3                   	ret
+
+0000000000801c03 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  801c03:	55                   	push   %rbp
+  801c04:	48 89 e5             	mov    %rsp,%rbp
+  801c07:	41 57                	push   %r15
+  801c09:	41 56                	push   %r14
+  801c0b:	41 55                	push   %r13
+  801c0d:	41 54                	push   %r12
+  801c0f:	53                   	push   %rbx
+  801c10:	48 83 ec 18          	sub    $0x18,%rsp
+  801c14:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  801c17:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801c1b:	48 b8 43 1a 80 00 00 	movabs $0x801a43,%rax
+  801c22:	00 00 00 
+  801c25:	ff d0                	call   *%rax
+  801c27:	89 c3                	mov    %eax,%ebx
+  801c29:	85 c0                	test   %eax,%eax
+  801c2b:	0f 88 b8 00 00 00    	js     801ce9 <dup+0xe6>
+    close(newfdnum);
+  801c31:	44 89 e7             	mov    %r12d,%edi
+  801c34:	48 b8 a8 1b 80 00 00 	movabs $0x801ba8,%rax
+  801c3b:	00 00 00 
+  801c3e:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  801c40:	4d 63 ec             	movslq %r12d,%r13
+  801c43:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  801c4a:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  801c4e:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  801c52:	4c 89 ff             	mov    %r15,%rdi
+  801c55:	49 be 94 19 80 00 00 	movabs $0x801994,%r14
+  801c5c:	00 00 00 
+  801c5f:	41 ff d6             	call   *%r14
+  801c62:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  801c65:	4c 89 ef             	mov    %r13,%rdi
+  801c68:	41 ff d6             	call   *%r14
+  801c6b:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  801c6e:	48 89 df             	mov    %rbx,%rdi
+  801c71:	48 b8 72 2b 80 00 00 	movabs $0x802b72,%rax
+  801c78:	00 00 00 
+  801c7b:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  801c7d:	a8 04                	test   $0x4,%al
+  801c7f:	74 2b                	je     801cac <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  801c81:	41 89 c1             	mov    %eax,%r9d
+  801c84:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801c8a:	4c 89 f1             	mov    %r14,%rcx
+  801c8d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c92:	48 89 de             	mov    %rbx,%rsi
+  801c95:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c9a:	48 b8 4a 14 80 00 00 	movabs $0x80144a,%rax
+  801ca1:	00 00 00 
+  801ca4:	ff d0                	call   *%rax
+  801ca6:	89 c3                	mov    %eax,%ebx
+  801ca8:	85 c0                	test   %eax,%eax
+  801caa:	78 4e                	js     801cfa <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  801cac:	4c 89 ff             	mov    %r15,%rdi
+  801caf:	48 b8 72 2b 80 00 00 	movabs $0x802b72,%rax
+  801cb6:	00 00 00 
+  801cb9:	ff d0                	call   *%rax
+  801cbb:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801cbe:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801cc4:	4c 89 e9             	mov    %r13,%rcx
+  801cc7:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ccc:	4c 89 fe             	mov    %r15,%rsi
+  801ccf:	bf 00 00 00 00       	mov    $0x0,%edi
+  801cd4:	48 b8 4a 14 80 00 00 	movabs $0x80144a,%rax
+  801cdb:	00 00 00 
+  801cde:	ff d0                	call   *%rax
+  801ce0:	89 c3                	mov    %eax,%ebx
+  801ce2:	85 c0                	test   %eax,%eax
+  801ce4:	78 14                	js     801cfa <dup+0xf7>
+
+    return newfdnum;
+  801ce6:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  801ce9:	89 d8                	mov    %ebx,%eax
+  801ceb:	48 83 c4 18          	add    $0x18,%rsp
+  801cef:	5b                   	pop    %rbx
+  801cf0:	41 5c                	pop    %r12
+  801cf2:	41 5d                	pop    %r13
+  801cf4:	41 5e                	pop    %r14
+  801cf6:	41 5f                	pop    %r15
+  801cf8:	5d                   	pop    %rbp
+  801cf9:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  801cfa:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801cff:	4c 89 ee             	mov    %r13,%rsi
+  801d02:	bf 00 00 00 00       	mov    $0x0,%edi
+  801d07:	49 bc af 14 80 00 00 	movabs $0x8014af,%r12
+  801d0e:	00 00 00 
+  801d11:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  801d14:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801d19:	4c 89 f6             	mov    %r14,%rsi
+  801d1c:	bf 00 00 00 00       	mov    $0x0,%edi
+  801d21:	41 ff d4             	call   *%r12
+    return res;
+  801d24:	eb c3                	jmp    801ce9 <dup+0xe6>
+
+0000000000801d26 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  801d26:	55                   	push   %rbp
+  801d27:	48 89 e5             	mov    %rsp,%rbp
+  801d2a:	41 56                	push   %r14
+  801d2c:	41 55                	push   %r13
+  801d2e:	41 54                	push   %r12
+  801d30:	53                   	push   %rbx
+  801d31:	48 83 ec 10          	sub    $0x10,%rsp
+  801d35:	89 fb                	mov    %edi,%ebx
+  801d37:	49 89 f4             	mov    %rsi,%r12
+  801d3a:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801d3d:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801d41:	48 b8 43 1a 80 00 00 	movabs $0x801a43,%rax
+  801d48:	00 00 00 
+  801d4b:	ff d0                	call   *%rax
+  801d4d:	85 c0                	test   %eax,%eax
+  801d4f:	78 4c                	js     801d9d <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801d51:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801d55:	41 8b 3e             	mov    (%r14),%edi
+  801d58:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801d5c:	48 b8 8e 1a 80 00 00 	movabs $0x801a8e,%rax
+  801d63:	00 00 00 
+  801d66:	ff d0                	call   *%rax
+  801d68:	85 c0                	test   %eax,%eax
+  801d6a:	78 35                	js     801da1 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801d6c:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801d70:	83 e0 03             	and    $0x3,%eax
+  801d73:	83 f8 01             	cmp    $0x1,%eax
+  801d76:	74 2d                	je     801da5 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801d78:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801d7c:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801d80:	48 85 c0             	test   %rax,%rax
+  801d83:	74 56                	je     801ddb <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  801d85:	4c 89 ea             	mov    %r13,%rdx
+  801d88:	4c 89 e6             	mov    %r12,%rsi
+  801d8b:	4c 89 f7             	mov    %r14,%rdi
+  801d8e:	ff d0                	call   *%rax
+}
+  801d90:	48 83 c4 10          	add    $0x10,%rsp
+  801d94:	5b                   	pop    %rbx
+  801d95:	41 5c                	pop    %r12
+  801d97:	41 5d                	pop    %r13
+  801d99:	41 5e                	pop    %r14
+  801d9b:	5d                   	pop    %rbp
+  801d9c:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801d9d:	48 98                	cltq
+  801d9f:	eb ef                	jmp    801d90 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801da1:	48 98                	cltq
+  801da3:	eb eb                	jmp    801d90 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801da5:	48 a1 00 54 80 00 00 	movabs 0x805400,%rax
+  801dac:	00 00 00 
+  801daf:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+  801db5:	89 da                	mov    %ebx,%edx
+  801db7:	48 bf d9 38 80 00 00 	movabs $0x8038d9,%rdi
+  801dbe:	00 00 00 
+  801dc1:	b8 00 00 00 00       	mov    $0x0,%eax
+  801dc6:	48 b9 0e 05 80 00 00 	movabs $0x80050e,%rcx
+  801dcd:	00 00 00 
+  801dd0:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801dd2:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801dd9:	eb b5                	jmp    801d90 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801ddb:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801de2:	eb ac                	jmp    801d90 <read+0x6a>
+
+0000000000801de4 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801de4:	55                   	push   %rbp
+  801de5:	48 89 e5             	mov    %rsp,%rbp
+  801de8:	41 57                	push   %r15
+  801dea:	41 56                	push   %r14
+  801dec:	41 55                	push   %r13
+  801dee:	41 54                	push   %r12
+  801df0:	53                   	push   %rbx
+  801df1:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  801df5:	48 85 d2             	test   %rdx,%rdx
+  801df8:	74 54                	je     801e4e <readn+0x6a>
+  801dfa:	41 89 fd             	mov    %edi,%r13d
+  801dfd:	49 89 f6             	mov    %rsi,%r14
+  801e00:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  801e03:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  801e08:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  801e0d:	49 bf 26 1d 80 00 00 	movabs $0x801d26,%r15
+  801e14:	00 00 00 
+  801e17:	4c 89 e2             	mov    %r12,%rdx
+  801e1a:	48 29 f2             	sub    %rsi,%rdx
+  801e1d:	4c 01 f6             	add    %r14,%rsi
+  801e20:	44 89 ef             	mov    %r13d,%edi
+  801e23:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  801e26:	85 c0                	test   %eax,%eax
+  801e28:	78 20                	js     801e4a <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  801e2a:	01 c3                	add    %eax,%ebx
+  801e2c:	85 c0                	test   %eax,%eax
+  801e2e:	74 08                	je     801e38 <readn+0x54>
+  801e30:	48 63 f3             	movslq %ebx,%rsi
+  801e33:	4c 39 e6             	cmp    %r12,%rsi
+  801e36:	72 df                	jb     801e17 <readn+0x33>
+    }
+    return res;
+  801e38:	48 63 c3             	movslq %ebx,%rax
+}
+  801e3b:	48 83 c4 08          	add    $0x8,%rsp
+  801e3f:	5b                   	pop    %rbx
+  801e40:	41 5c                	pop    %r12
+  801e42:	41 5d                	pop    %r13
+  801e44:	41 5e                	pop    %r14
+  801e46:	41 5f                	pop    %r15
+  801e48:	5d                   	pop    %rbp
+  801e49:	c3                   	ret
+        if (inc < 0) return inc;
+  801e4a:	48 98                	cltq
+  801e4c:	eb ed                	jmp    801e3b <readn+0x57>
+    int inc = 1, res = 0;
+  801e4e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801e53:	eb e3                	jmp    801e38 <readn+0x54>
+
+0000000000801e55 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  801e55:	55                   	push   %rbp
+  801e56:	48 89 e5             	mov    %rsp,%rbp
+  801e59:	41 56                	push   %r14
+  801e5b:	41 55                	push   %r13
+  801e5d:	41 54                	push   %r12
+  801e5f:	53                   	push   %rbx
+  801e60:	48 83 ec 10          	sub    $0x10,%rsp
+  801e64:	89 fb                	mov    %edi,%ebx
+  801e66:	49 89 f4             	mov    %rsi,%r12
+  801e69:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801e6c:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801e70:	48 b8 43 1a 80 00 00 	movabs $0x801a43,%rax
+  801e77:	00 00 00 
+  801e7a:	ff d0                	call   *%rax
+  801e7c:	85 c0                	test   %eax,%eax
+  801e7e:	78 47                	js     801ec7 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801e80:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801e84:	41 8b 3e             	mov    (%r14),%edi
+  801e87:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801e8b:	48 b8 8e 1a 80 00 00 	movabs $0x801a8e,%rax
+  801e92:	00 00 00 
+  801e95:	ff d0                	call   *%rax
+  801e97:	85 c0                	test   %eax,%eax
+  801e99:	78 30                	js     801ecb <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801e9b:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  801ea0:	74 2d                	je     801ecf <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801ea2:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801ea6:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801eaa:	48 85 c0             	test   %rax,%rax
+  801ead:	74 56                	je     801f05 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  801eaf:	4c 89 ea             	mov    %r13,%rdx
+  801eb2:	4c 89 e6             	mov    %r12,%rsi
+  801eb5:	4c 89 f7             	mov    %r14,%rdi
+  801eb8:	ff d0                	call   *%rax
+}
+  801eba:	48 83 c4 10          	add    $0x10,%rsp
+  801ebe:	5b                   	pop    %rbx
+  801ebf:	41 5c                	pop    %r12
+  801ec1:	41 5d                	pop    %r13
+  801ec3:	41 5e                	pop    %r14
+  801ec5:	5d                   	pop    %rbp
+  801ec6:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801ec7:	48 98                	cltq
+  801ec9:	eb ef                	jmp    801eba <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801ecb:	48 98                	cltq
+  801ecd:	eb eb                	jmp    801eba <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801ecf:	48 a1 00 54 80 00 00 	movabs 0x805400,%rax
+  801ed6:	00 00 00 
+  801ed9:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+  801edf:	89 da                	mov    %ebx,%edx
+  801ee1:	48 bf f5 38 80 00 00 	movabs $0x8038f5,%rdi
+  801ee8:	00 00 00 
+  801eeb:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ef0:	48 b9 0e 05 80 00 00 	movabs $0x80050e,%rcx
+  801ef7:	00 00 00 
+  801efa:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801efc:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801f03:	eb b5                	jmp    801eba <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801f05:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801f0c:	eb ac                	jmp    801eba <write+0x65>
+
+0000000000801f0e <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  801f0e:	55                   	push   %rbp
+  801f0f:	48 89 e5             	mov    %rsp,%rbp
+  801f12:	53                   	push   %rbx
+  801f13:	48 83 ec 18          	sub    $0x18,%rsp
+  801f17:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801f19:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801f1d:	48 b8 43 1a 80 00 00 	movabs $0x801a43,%rax
+  801f24:	00 00 00 
+  801f27:	ff d0                	call   *%rax
+  801f29:	85 c0                	test   %eax,%eax
+  801f2b:	78 0c                	js     801f39 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  801f2d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801f31:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  801f34:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801f39:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801f3d:	c9                   	leave
+  801f3e:	c3                   	ret
+
+0000000000801f3f <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  801f3f:	55                   	push   %rbp
+  801f40:	48 89 e5             	mov    %rsp,%rbp
+  801f43:	41 55                	push   %r13
+  801f45:	41 54                	push   %r12
+  801f47:	53                   	push   %rbx
+  801f48:	48 83 ec 18          	sub    $0x18,%rsp
+  801f4c:	89 fb                	mov    %edi,%ebx
+  801f4e:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801f51:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801f55:	48 b8 43 1a 80 00 00 	movabs $0x801a43,%rax
+  801f5c:	00 00 00 
+  801f5f:	ff d0                	call   *%rax
+  801f61:	85 c0                	test   %eax,%eax
+  801f63:	78 38                	js     801f9d <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801f65:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  801f69:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  801f6d:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801f71:	48 b8 8e 1a 80 00 00 	movabs $0x801a8e,%rax
+  801f78:	00 00 00 
+  801f7b:	ff d0                	call   *%rax
+  801f7d:	85 c0                	test   %eax,%eax
+  801f7f:	78 1c                	js     801f9d <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801f81:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  801f86:	74 20                	je     801fa8 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801f88:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801f8c:	48 8b 40 30          	mov    0x30(%rax),%rax
+  801f90:	48 85 c0             	test   %rax,%rax
+  801f93:	74 47                	je     801fdc <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  801f95:	44 89 e6             	mov    %r12d,%esi
+  801f98:	4c 89 ef             	mov    %r13,%rdi
+  801f9b:	ff d0                	call   *%rax
+}
+  801f9d:	48 83 c4 18          	add    $0x18,%rsp
+  801fa1:	5b                   	pop    %rbx
+  801fa2:	41 5c                	pop    %r12
+  801fa4:	41 5d                	pop    %r13
+  801fa6:	5d                   	pop    %rbp
+  801fa7:	c3                   	ret
+                thisenv->env_id, fdnum);
+  801fa8:	48 a1 00 54 80 00 00 	movabs 0x805400,%rax
+  801faf:	00 00 00 
+  801fb2:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801fb8:	89 da                	mov    %ebx,%edx
+  801fba:	48 bf b8 38 80 00 00 	movabs $0x8038b8,%rdi
+  801fc1:	00 00 00 
+  801fc4:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fc9:	48 b9 0e 05 80 00 00 	movabs $0x80050e,%rcx
+  801fd0:	00 00 00 
+  801fd3:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801fd5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801fda:	eb c1                	jmp    801f9d <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801fdc:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801fe1:	eb ba                	jmp    801f9d <ftruncate+0x5e>
+
+0000000000801fe3 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  801fe3:	55                   	push   %rbp
+  801fe4:	48 89 e5             	mov    %rsp,%rbp
+  801fe7:	41 54                	push   %r12
+  801fe9:	53                   	push   %rbx
+  801fea:	48 83 ec 10          	sub    $0x10,%rsp
+  801fee:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801ff1:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801ff5:	48 b8 43 1a 80 00 00 	movabs $0x801a43,%rax
+  801ffc:	00 00 00 
+  801fff:	ff d0                	call   *%rax
+  802001:	85 c0                	test   %eax,%eax
+  802003:	78 4e                	js     802053 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802005:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  802009:	41 8b 3c 24          	mov    (%r12),%edi
+  80200d:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  802011:	48 b8 8e 1a 80 00 00 	movabs $0x801a8e,%rax
+  802018:	00 00 00 
+  80201b:	ff d0                	call   *%rax
+  80201d:	85 c0                	test   %eax,%eax
+  80201f:	78 32                	js     802053 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  802021:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802025:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  80202a:	74 30                	je     80205c <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  80202c:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  80202f:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  802036:	00 00 00 
+    stat->st_isdir = 0;
+  802039:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  802040:	00 00 00 
+    stat->st_dev = dev;
+  802043:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  80204a:	48 89 de             	mov    %rbx,%rsi
+  80204d:	4c 89 e7             	mov    %r12,%rdi
+  802050:	ff 50 28             	call   *0x28(%rax)
+}
+  802053:	48 83 c4 10          	add    $0x10,%rsp
+  802057:	5b                   	pop    %rbx
+  802058:	41 5c                	pop    %r12
+  80205a:	5d                   	pop    %rbp
+  80205b:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  80205c:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802061:	eb f0                	jmp    802053 <fstat+0x70>
+
+0000000000802063 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  802063:	55                   	push   %rbp
+  802064:	48 89 e5             	mov    %rsp,%rbp
+  802067:	41 54                	push   %r12
+  802069:	53                   	push   %rbx
+  80206a:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  80206d:	be 00 00 00 00       	mov    $0x0,%esi
+  802072:	48 b8 46 24 80 00 00 	movabs $0x802446,%rax
+  802079:	00 00 00 
+  80207c:	ff d0                	call   *%rax
+  80207e:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  802080:	85 c0                	test   %eax,%eax
+  802082:	78 25                	js     8020a9 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  802084:	4c 89 e6             	mov    %r12,%rsi
+  802087:	89 c7                	mov    %eax,%edi
+  802089:	48 b8 e3 1f 80 00 00 	movabs $0x801fe3,%rax
+  802090:	00 00 00 
+  802093:	ff d0                	call   *%rax
+  802095:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  802098:	89 df                	mov    %ebx,%edi
+  80209a:	48 b8 a8 1b 80 00 00 	movabs $0x801ba8,%rax
+  8020a1:	00 00 00 
+  8020a4:	ff d0                	call   *%rax
+
+    return res;
+  8020a6:	44 89 e3             	mov    %r12d,%ebx
+}
+  8020a9:	89 d8                	mov    %ebx,%eax
+  8020ab:	5b                   	pop    %rbx
+  8020ac:	41 5c                	pop    %r12
+  8020ae:	5d                   	pop    %rbp
+  8020af:	c3                   	ret
+
+00000000008020b0 <fsipc>:
+ * response may be written back to fsipcbuf.
+ * type: request code, passed as the simple integer IPC value.
+ * dstva: virtual address at which to receive reply page, 0 if none.
+ * Returns result from the file server. */
+static int
+fsipc(unsigned type, void *dstva) {
+  8020b0:	55                   	push   %rbp
+  8020b1:	48 89 e5             	mov    %rsp,%rbp
+  8020b4:	41 54                	push   %r12
+  8020b6:	53                   	push   %rbx
+  8020b7:	48 83 ec 10          	sub    $0x10,%rsp
+  8020bb:	41 89 fc             	mov    %edi,%r12d
+  8020be:	48 89 f3             	mov    %rsi,%rbx
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8020c1:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  8020c8:	00 00 00 
+  8020cb:	83 38 00             	cmpl   $0x0,(%rax)
+  8020ce:	74 5e                	je     80212e <fsipc+0x7e>
+    if (debug) {
+        cprintf("[%08x] fsipc %d %08x\n",
+                thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+    }
+
+    ipc_send(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW);
+  8020d0:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8020d6:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8020db:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  8020e2:	00 00 00 
+  8020e5:	44 89 e6             	mov    %r12d,%esi
+  8020e8:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  8020ef:	00 00 00 
+  8020f2:	8b 38                	mov    (%rax),%edi
+  8020f4:	48 b8 66 30 80 00 00 	movabs $0x803066,%rax
+  8020fb:	00 00 00 
+  8020fe:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  802100:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  802107:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  802108:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80210d:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  802111:	48 89 de             	mov    %rbx,%rsi
+  802114:	bf 00 00 00 00       	mov    $0x0,%edi
+  802119:	48 b8 91 2f 80 00 00 	movabs $0x802f91,%rax
+  802120:	00 00 00 
+  802123:	ff d0                	call   *%rax
+}
+  802125:	48 83 c4 10          	add    $0x10,%rsp
+  802129:	5b                   	pop    %rbx
+  80212a:	41 5c                	pop    %r12
+  80212c:	5d                   	pop    %rbp
+  80212d:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  80212e:	bf 03 00 00 00       	mov    $0x3,%edi
+  802133:	48 b8 09 31 80 00 00 	movabs $0x803109,%rax
+  80213a:	00 00 00 
+  80213d:	ff d0                	call   *%rax
+  80213f:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  802146:	00 00 
+  802148:	eb 86                	jmp    8020d0 <fsipc+0x20>
+
+000000000080214a <devfile_trunc>:
+    return 0;
+}
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  80214a:	55                   	push   %rbp
+  80214b:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  80214e:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  802155:	00 00 00 
+  802158:	8b 57 0c             	mov    0xc(%rdi),%edx
+  80215b:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  80215d:	89 70 04             	mov    %esi,0x4(%rax)
+
+    return fsipc(FSREQ_SET_SIZE, NULL);
+  802160:	be 00 00 00 00       	mov    $0x0,%esi
+  802165:	bf 02 00 00 00       	mov    $0x2,%edi
+  80216a:	48 b8 b0 20 80 00 00 	movabs $0x8020b0,%rax
+  802171:	00 00 00 
+  802174:	ff d0                	call   *%rax
+}
+  802176:	5d                   	pop    %rbp
+  802177:	c3                   	ret
+
+0000000000802178 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  802178:	55                   	push   %rbp
+  802179:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  80217c:	8b 47 0c             	mov    0xc(%rdi),%eax
+  80217f:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  802186:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  802188:	be 00 00 00 00       	mov    $0x0,%esi
+  80218d:	bf 06 00 00 00       	mov    $0x6,%edi
+  802192:	48 b8 b0 20 80 00 00 	movabs $0x8020b0,%rax
+  802199:	00 00 00 
+  80219c:	ff d0                	call   *%rax
+}
+  80219e:	5d                   	pop    %rbp
+  80219f:	c3                   	ret
+
+00000000008021a0 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  8021a0:	55                   	push   %rbp
+  8021a1:	48 89 e5             	mov    %rsp,%rbp
+  8021a4:	41 54                	push   %r12
+  8021a6:	53                   	push   %rbx
+  8021a7:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8021aa:	8b 47 0c             	mov    0xc(%rdi),%eax
+  8021ad:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  8021b4:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  8021b6:	be 00 00 00 00       	mov    $0x0,%esi
+  8021bb:	bf 05 00 00 00       	mov    $0x5,%edi
+  8021c0:	48 b8 b0 20 80 00 00 	movabs $0x8020b0,%rax
+  8021c7:	00 00 00 
+  8021ca:	ff d0                	call   *%rax
+    if (res < 0) {
+  8021cc:	85 c0                	test   %eax,%eax
+  8021ce:	78 3d                	js     80220d <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8021d0:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  8021d7:	00 00 00 
+  8021da:	4c 89 e6             	mov    %r12,%rsi
+  8021dd:	48 89 df             	mov    %rbx,%rdi
+  8021e0:	48 b8 33 0e 80 00 00 	movabs $0x800e33,%rax
+  8021e7:	00 00 00 
+  8021ea:	ff d0                	call   *%rax
+    st->st_size  = fsipcbuf.statRet.ret_size;
+  8021ec:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  8021f3:	00 
+  8021f4:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8021fa:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  802201:	00 
+  802202:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  802208:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80220d:	5b                   	pop    %rbx
+  80220e:	41 5c                	pop    %r12
+  802210:	5d                   	pop    %rbp
+  802211:	c3                   	ret
+
+0000000000802212 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  802212:	55                   	push   %rbp
+  802213:	48 89 e5             	mov    %rsp,%rbp
+  802216:	41 57                	push   %r15
+  802218:	41 56                	push   %r14
+  80221a:	41 55                	push   %r13
+  80221c:	41 54                	push   %r12
+  80221e:	53                   	push   %rbx
+  80221f:	48 83 ec 18          	sub    $0x18,%rsp
+  802223:	49 89 fe             	mov    %rdi,%r14
+  802226:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+  80222a:	48 89 d3             	mov    %rdx,%rbx
+    while (n > sizeof(fsipcbuf.write.req_buf))
+  80222d:	48 81 fa f0 0f 00 00 	cmp    $0xff0,%rdx
+  802234:	0f 86 e4 00 00 00    	jbe    80231e <devfile_write+0x10c>
+  80223a:	49 89 f4             	mov    %rsi,%r12
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  80223d:	49 bd 00 60 80 00 00 	movabs $0x806000,%r13
+  802244:	00 00 00 
+        memcpy(fsipcbuf.write.req_buf, buf, sizeof(fsipcbuf.write.req_buf));
+  802247:	49 bf 94 10 80 00 00 	movabs $0x801094,%r15
+  80224e:	00 00 00 
+  802251:	eb 03                	jmp    802256 <devfile_write+0x44>
+        buf += sizeof(fsipcbuf.write.req_buf);
+  802253:	49 89 f4             	mov    %rsi,%r12
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802256:	41 8b 46 0c          	mov    0xc(%r14),%eax
+  80225a:	41 89 45 00          	mov    %eax,0x0(%r13)
+        fsipcbuf.write.req_n      = sizeof(fsipcbuf.write.req_buf);
+  80225e:	49 c7 45 08 f0 0f 00 	movq   $0xff0,0x8(%r13)
+  802265:	00 
+        memcpy(fsipcbuf.write.req_buf, buf, sizeof(fsipcbuf.write.req_buf));
+  802266:	ba f0 0f 00 00       	mov    $0xff0,%edx
+  80226b:	4c 89 e6             	mov    %r12,%rsi
+  80226e:	48 bf 10 60 80 00 00 	movabs $0x806010,%rdi
+  802275:	00 00 00 
+  802278:	41 ff d7             	call   *%r15
+        ssize_t res = fsipc(FSREQ_WRITE, NULL);
+  80227b:	be 00 00 00 00       	mov    $0x0,%esi
+  802280:	bf 04 00 00 00       	mov    $0x4,%edi
+  802285:	48 b8 b0 20 80 00 00 	movabs $0x8020b0,%rax
+  80228c:	00 00 00 
+  80228f:	ff d0                	call   *%rax
+  802291:	48 63 d0             	movslq %eax,%rdx
+        if (res < 0 || res < sizeof(fsipcbuf.write.req_buf))
+  802294:	3d ef 0f 00 00       	cmp    $0xfef,%eax
+  802299:	7e 71                	jle    80230c <devfile_write+0xfa>
+        buf += sizeof(fsipcbuf.write.req_buf);
+  80229b:	49 8d b4 24 f0 0f 00 	lea    0xff0(%r12),%rsi
+  8022a2:	00 
+        n -= sizeof(fsipcbuf.write.req_buf);
+  8022a3:	48 81 eb f0 0f 00 00 	sub    $0xff0,%rbx
+    while (n > sizeof(fsipcbuf.write.req_buf))
+  8022aa:	48 81 fb f0 0f 00 00 	cmp    $0xff0,%rbx
+  8022b1:	77 a0                	ja     802253 <devfile_write+0x41>
+        written += sizeof(fsipcbuf.write.req_buf);
+  8022b3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8022b7:	49 29 c4             	sub    %rax,%r12
+  8022ba:	4d 8d a4 24 f0 0f 00 	lea    0xff0(%r12),%r12
+  8022c1:	00 
+    fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8022c2:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  8022c9:	00 00 00 
+  8022cc:	41 8b 56 0c          	mov    0xc(%r14),%edx
+  8022d0:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.write.req_n      = n;
+  8022d2:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    memcpy(fsipcbuf.write.req_buf, buf, n);
+  8022d6:	48 89 da             	mov    %rbx,%rdx
+  8022d9:	48 8d 78 10          	lea    0x10(%rax),%rdi
+  8022dd:	48 b8 94 10 80 00 00 	movabs $0x801094,%rax
+  8022e4:	00 00 00 
+  8022e7:	ff d0                	call   *%rax
+    ssize_t res = fsipc(FSREQ_WRITE, NULL);
+  8022e9:	be 00 00 00 00       	mov    $0x0,%esi
+  8022ee:	bf 04 00 00 00       	mov    $0x4,%edi
+  8022f3:	48 b8 b0 20 80 00 00 	movabs $0x8020b0,%rax
+  8022fa:	00 00 00 
+  8022fd:	ff d0                	call   *%rax
+  8022ff:	48 63 d0             	movslq %eax,%rdx
+    written += res;
+  802302:	49 01 d4             	add    %rdx,%r12
+  802305:	48 85 d2             	test   %rdx,%rdx
+  802308:	49 0f 49 d4          	cmovns %r12,%rdx
+}
+  80230c:	48 89 d0             	mov    %rdx,%rax
+  80230f:	48 83 c4 18          	add    $0x18,%rsp
+  802313:	5b                   	pop    %rbx
+  802314:	41 5c                	pop    %r12
+  802316:	41 5d                	pop    %r13
+  802318:	41 5e                	pop    %r14
+  80231a:	41 5f                	pop    %r15
+  80231c:	5d                   	pop    %rbp
+  80231d:	c3                   	ret
+    while (n > sizeof(fsipcbuf.write.req_buf))
+  80231e:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+    ssize_t written = 0;
+  802322:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802328:	eb 98                	jmp    8022c2 <devfile_write+0xb0>
+
+000000000080232a <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  80232a:	55                   	push   %rbp
+  80232b:	48 89 e5             	mov    %rsp,%rbp
+  80232e:	41 57                	push   %r15
+  802330:	41 56                	push   %r14
+  802332:	41 55                	push   %r13
+  802334:	41 54                	push   %r12
+  802336:	53                   	push   %rbx
+  802337:	48 83 ec 18          	sub    $0x18,%rsp
+  80233b:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  80233f:	49 89 f6             	mov    %rsi,%r14
+  802342:	49 89 d4             	mov    %rdx,%r12
+    while (n > sizeof(fsipcbuf.readRet.ret_buf))
+  802345:	48 81 fa 00 10 00 00 	cmp    $0x1000,%rdx
+  80234c:	0f 86 ea 00 00 00    	jbe    80243c <devfile_read+0x112>
+    ssize_t readsz = 0;
+  802352:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  802359:	00 
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  80235a:	49 bf 00 60 80 00 00 	movabs $0x806000,%r15
+  802361:	00 00 00 
+  802364:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802368:	8b 40 0c             	mov    0xc(%rax),%eax
+  80236b:	41 89 07             	mov    %eax,(%r15)
+        fsipcbuf.read.req_n = sizeof(fsipcbuf.readRet.ret_buf);
+  80236e:	49 c7 47 08 00 10 00 	movq   $0x1000,0x8(%r15)
+  802375:	00 
+        ssize_t res = fsipc(FSREQ_READ, NULL);
+  802376:	be 00 00 00 00       	mov    $0x0,%esi
+  80237b:	bf 03 00 00 00       	mov    $0x3,%edi
+  802380:	48 b8 b0 20 80 00 00 	movabs $0x8020b0,%rax
+  802387:	00 00 00 
+  80238a:	ff d0                	call   *%rax
+  80238c:	4c 63 e8             	movslq %eax,%r13
+        if (res < 0)
+  80238f:	4d 85 ed             	test   %r13,%r13
+  802392:	0f 88 92 00 00 00    	js     80242a <devfile_read+0x100>
+        memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  802398:	4c 89 ea             	mov    %r13,%rdx
+  80239b:	4c 89 fe             	mov    %r15,%rsi
+  80239e:	4c 89 f7             	mov    %r14,%rdi
+  8023a1:	48 b8 94 10 80 00 00 	movabs $0x801094,%rax
+  8023a8:	00 00 00 
+  8023ab:	ff d0                	call   *%rax
+        if (res < sizeof(fsipcbuf.readRet.ret_buf))
+  8023ad:	49 81 fd ff 0f 00 00 	cmp    $0xfff,%r13
+  8023b4:	76 6d                	jbe    802423 <devfile_read+0xf9>
+        readsz += res;
+  8023b6:	4c 01 6d c0          	add    %r13,-0x40(%rbp)
+        buf += res;
+  8023ba:	4d 01 ee             	add    %r13,%r14
+        n -= res;
+  8023bd:	4d 29 ec             	sub    %r13,%r12
+    while (n > sizeof(fsipcbuf.readRet.ret_buf))
+  8023c0:	49 81 fc 00 10 00 00 	cmp    $0x1000,%r12
+  8023c7:	77 9b                	ja     802364 <devfile_read+0x3a>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8023c9:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  8023d0:	00 00 00 
+  8023d3:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  8023d7:	8b 51 0c             	mov    0xc(%rcx),%edx
+  8023da:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.read.req_n = n;
+  8023dc:	4c 89 60 08          	mov    %r12,0x8(%rax)
+    ssize_t res = fsipc(FSREQ_READ, NULL);
+  8023e0:	be 00 00 00 00       	mov    $0x0,%esi
+  8023e5:	bf 03 00 00 00       	mov    $0x3,%edi
+  8023ea:	48 b8 b0 20 80 00 00 	movabs $0x8020b0,%rax
+  8023f1:	00 00 00 
+  8023f4:	ff d0                	call   *%rax
+  8023f6:	4c 63 e8             	movslq %eax,%r13
+    if (res < 0)
+  8023f9:	4d 85 ed             	test   %r13,%r13
+  8023fc:	78 2c                	js     80242a <devfile_read+0x100>
+    memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  8023fe:	4c 89 ea             	mov    %r13,%rdx
+  802401:	48 be 00 60 80 00 00 	movabs $0x806000,%rsi
+  802408:	00 00 00 
+  80240b:	4c 89 f7             	mov    %r14,%rdi
+  80240e:	48 b8 94 10 80 00 00 	movabs $0x801094,%rax
+  802415:	00 00 00 
+  802418:	ff d0                	call   *%rax
+    readsz += res;
+  80241a:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80241e:	49 01 c5             	add    %rax,%r13
+    return readsz;
+  802421:	eb 07                	jmp    80242a <devfile_read+0x100>
+            return readsz + res;
+  802423:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802427:	49 01 c5             	add    %rax,%r13
+}
+  80242a:	4c 89 e8             	mov    %r13,%rax
+  80242d:	48 83 c4 18          	add    $0x18,%rsp
+  802431:	5b                   	pop    %rbx
+  802432:	41 5c                	pop    %r12
+  802434:	41 5d                	pop    %r13
+  802436:	41 5e                	pop    %r14
+  802438:	41 5f                	pop    %r15
+  80243a:	5d                   	pop    %rbp
+  80243b:	c3                   	ret
+    ssize_t readsz = 0;
+  80243c:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  802443:	00 
+  802444:	eb 83                	jmp    8023c9 <devfile_read+0x9f>
+
+0000000000802446 <open>:
+open(const char *path, int mode) {
+  802446:	55                   	push   %rbp
+  802447:	48 89 e5             	mov    %rsp,%rbp
+  80244a:	41 55                	push   %r13
+  80244c:	41 54                	push   %r12
+  80244e:	53                   	push   %rbx
+  80244f:	48 83 ec 18          	sub    $0x18,%rsp
+  802453:	49 89 fc             	mov    %rdi,%r12
+  802456:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  802459:	48 b8 f5 0d 80 00 00 	movabs $0x800df5,%rax
+  802460:	00 00 00 
+  802463:	ff d0                	call   *%rax
+  802465:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  80246b:	0f 87 8a 00 00 00    	ja     8024fb <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802471:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802475:	48 b8 29 1a 80 00 00 	movabs $0x801a29,%rax
+  80247c:	00 00 00 
+  80247f:	ff d0                	call   *%rax
+  802481:	89 c3                	mov    %eax,%ebx
+  802483:	85 c0                	test   %eax,%eax
+  802485:	78 50                	js     8024d7 <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  802487:	4c 89 e6             	mov    %r12,%rsi
+  80248a:	48 bb 00 60 80 00 00 	movabs $0x806000,%rbx
+  802491:	00 00 00 
+  802494:	48 89 df             	mov    %rbx,%rdi
+  802497:	48 b8 33 0e 80 00 00 	movabs $0x800e33,%rax
+  80249e:	00 00 00 
+  8024a1:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  8024a3:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  8024aa:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8024ae:	bf 01 00 00 00       	mov    $0x1,%edi
+  8024b3:	48 b8 b0 20 80 00 00 	movabs $0x8020b0,%rax
+  8024ba:	00 00 00 
+  8024bd:	ff d0                	call   *%rax
+  8024bf:	89 c3                	mov    %eax,%ebx
+  8024c1:	85 c0                	test   %eax,%eax
+  8024c3:	78 1f                	js     8024e4 <open+0x9e>
+    return fd2num(fd);
+  8024c5:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8024c9:	48 b8 82 19 80 00 00 	movabs $0x801982,%rax
+  8024d0:	00 00 00 
+  8024d3:	ff d0                	call   *%rax
+  8024d5:	89 c3                	mov    %eax,%ebx
+}
+  8024d7:	89 d8                	mov    %ebx,%eax
+  8024d9:	48 83 c4 18          	add    $0x18,%rsp
+  8024dd:	5b                   	pop    %rbx
+  8024de:	41 5c                	pop    %r12
+  8024e0:	41 5d                	pop    %r13
+  8024e2:	5d                   	pop    %rbp
+  8024e3:	c3                   	ret
+        fd_close(fd, 0);
+  8024e4:	be 00 00 00 00       	mov    $0x0,%esi
+  8024e9:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8024ed:	48 b8 fe 1a 80 00 00 	movabs $0x801afe,%rax
+  8024f4:	00 00 00 
+  8024f7:	ff d0                	call   *%rax
+        return res;
+  8024f9:	eb dc                	jmp    8024d7 <open+0x91>
+        return -E_BAD_PATH;
+  8024fb:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  802500:	eb d5                	jmp    8024d7 <open+0x91>
+
+0000000000802502 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  802502:	55                   	push   %rbp
+  802503:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc(FSREQ_SYNC, NULL);
+  802506:	be 00 00 00 00       	mov    $0x0,%esi
+  80250b:	bf 08 00 00 00       	mov    $0x8,%edi
+  802510:	48 b8 b0 20 80 00 00 	movabs $0x8020b0,%rax
+  802517:	00 00 00 
+  80251a:	ff d0                	call   *%rax
+}
+  80251c:	5d                   	pop    %rbp
+  80251d:	c3                   	ret
+
+000000000080251e <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  80251e:	55                   	push   %rbp
+  80251f:	48 89 e5             	mov    %rsp,%rbp
+  802522:	41 54                	push   %r12
+  802524:	53                   	push   %rbx
+  802525:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802528:	48 b8 94 19 80 00 00 	movabs $0x801994,%rax
+  80252f:	00 00 00 
+  802532:	ff d0                	call   *%rax
+  802534:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  802537:	48 be 40 39 80 00 00 	movabs $0x803940,%rsi
+  80253e:	00 00 00 
+  802541:	48 89 df             	mov    %rbx,%rdi
+  802544:	48 b8 33 0e 80 00 00 	movabs $0x800e33,%rax
+  80254b:	00 00 00 
+  80254e:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  802550:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  802555:	41 2b 04 24          	sub    (%r12),%eax
+  802559:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  80255f:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  802566:	00 00 00 
+    stat->st_dev = &devpipe;
+  802569:	48 b8 60 40 80 00 00 	movabs $0x804060,%rax
+  802570:	00 00 00 
+  802573:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  80257a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80257f:	5b                   	pop    %rbx
+  802580:	41 5c                	pop    %r12
+  802582:	5d                   	pop    %rbp
+  802583:	c3                   	ret
+
+0000000000802584 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  802584:	55                   	push   %rbp
+  802585:	48 89 e5             	mov    %rsp,%rbp
+  802588:	41 54                	push   %r12
+  80258a:	53                   	push   %rbx
+  80258b:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  80258e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802593:	48 89 fe             	mov    %rdi,%rsi
+  802596:	bf 00 00 00 00       	mov    $0x0,%edi
+  80259b:	49 bc af 14 80 00 00 	movabs $0x8014af,%r12
+  8025a2:	00 00 00 
+  8025a5:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  8025a8:	48 89 df             	mov    %rbx,%rdi
+  8025ab:	48 b8 94 19 80 00 00 	movabs $0x801994,%rax
+  8025b2:	00 00 00 
+  8025b5:	ff d0                	call   *%rax
+  8025b7:	48 89 c6             	mov    %rax,%rsi
+  8025ba:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8025bf:	bf 00 00 00 00       	mov    $0x0,%edi
+  8025c4:	41 ff d4             	call   *%r12
+}
+  8025c7:	5b                   	pop    %rbx
+  8025c8:	41 5c                	pop    %r12
+  8025ca:	5d                   	pop    %rbp
+  8025cb:	c3                   	ret
+
+00000000008025cc <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8025cc:	55                   	push   %rbp
+  8025cd:	48 89 e5             	mov    %rsp,%rbp
+  8025d0:	41 57                	push   %r15
+  8025d2:	41 56                	push   %r14
+  8025d4:	41 55                	push   %r13
+  8025d6:	41 54                	push   %r12
+  8025d8:	53                   	push   %rbx
+  8025d9:	48 83 ec 18          	sub    $0x18,%rsp
+  8025dd:	49 89 fc             	mov    %rdi,%r12
+  8025e0:	49 89 f5             	mov    %rsi,%r13
+  8025e3:	49 89 d7             	mov    %rdx,%r15
+  8025e6:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8025ea:	48 b8 94 19 80 00 00 	movabs $0x801994,%rax
+  8025f1:	00 00 00 
+  8025f4:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  8025f6:	4d 85 ff             	test   %r15,%r15
+  8025f9:	0f 84 af 00 00 00    	je     8026ae <devpipe_write+0xe2>
+  8025ff:	48 89 c3             	mov    %rax,%rbx
+  802602:	4c 89 f8             	mov    %r15,%rax
+  802605:	4d 89 ef             	mov    %r13,%r15
+  802608:	4c 01 e8             	add    %r13,%rax
+  80260b:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80260f:	49 bd b7 13 80 00 00 	movabs $0x8013b7,%r13
+  802616:	00 00 00 
+            sys_yield();
+  802619:	49 be 54 13 80 00 00 	movabs $0x801354,%r14
+  802620:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  802623:	8b 73 04             	mov    0x4(%rbx),%esi
+  802626:	48 63 ce             	movslq %esi,%rcx
+  802629:	48 63 03             	movslq (%rbx),%rax
+  80262c:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  802632:	48 39 c1             	cmp    %rax,%rcx
+  802635:	72 2e                	jb     802665 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802637:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80263c:	48 89 da             	mov    %rbx,%rdx
+  80263f:	be 00 10 00 00       	mov    $0x1000,%esi
+  802644:	4c 89 e7             	mov    %r12,%rdi
+  802647:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  80264a:	85 c0                	test   %eax,%eax
+  80264c:	74 66                	je     8026b4 <devpipe_write+0xe8>
+            sys_yield();
+  80264e:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  802651:	8b 73 04             	mov    0x4(%rbx),%esi
+  802654:	48 63 ce             	movslq %esi,%rcx
+  802657:	48 63 03             	movslq (%rbx),%rax
+  80265a:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  802660:	48 39 c1             	cmp    %rax,%rcx
+  802663:	73 d2                	jae    802637 <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  802665:	41 0f b6 3f          	movzbl (%r15),%edi
+  802669:	48 89 ca             	mov    %rcx,%rdx
+  80266c:	48 c1 ea 03          	shr    $0x3,%rdx
+  802670:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  802677:	08 10 20 
+  80267a:	48 f7 e2             	mul    %rdx
+  80267d:	48 c1 ea 06          	shr    $0x6,%rdx
+  802681:	48 89 d0             	mov    %rdx,%rax
+  802684:	48 c1 e0 09          	shl    $0x9,%rax
+  802688:	48 29 d0             	sub    %rdx,%rax
+  80268b:	48 c1 e0 03          	shl    $0x3,%rax
+  80268f:	48 29 c1             	sub    %rax,%rcx
+  802692:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  802697:	83 c6 01             	add    $0x1,%esi
+  80269a:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  80269d:	49 83 c7 01          	add    $0x1,%r15
+  8026a1:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8026a5:	49 39 c7             	cmp    %rax,%r15
+  8026a8:	0f 85 75 ff ff ff    	jne    802623 <devpipe_write+0x57>
+    return n;
+  8026ae:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8026b2:	eb 05                	jmp    8026b9 <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  8026b4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8026b9:	48 83 c4 18          	add    $0x18,%rsp
+  8026bd:	5b                   	pop    %rbx
+  8026be:	41 5c                	pop    %r12
+  8026c0:	41 5d                	pop    %r13
+  8026c2:	41 5e                	pop    %r14
+  8026c4:	41 5f                	pop    %r15
+  8026c6:	5d                   	pop    %rbp
+  8026c7:	c3                   	ret
+
+00000000008026c8 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  8026c8:	55                   	push   %rbp
+  8026c9:	48 89 e5             	mov    %rsp,%rbp
+  8026cc:	41 57                	push   %r15
+  8026ce:	41 56                	push   %r14
+  8026d0:	41 55                	push   %r13
+  8026d2:	41 54                	push   %r12
+  8026d4:	53                   	push   %rbx
+  8026d5:	48 83 ec 18          	sub    $0x18,%rsp
+  8026d9:	49 89 fc             	mov    %rdi,%r12
+  8026dc:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  8026e0:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8026e4:	48 b8 94 19 80 00 00 	movabs $0x801994,%rax
+  8026eb:	00 00 00 
+  8026ee:	ff d0                	call   *%rax
+  8026f0:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  8026f3:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8026f9:	49 bd b7 13 80 00 00 	movabs $0x8013b7,%r13
+  802700:	00 00 00 
+            sys_yield();
+  802703:	49 be 54 13 80 00 00 	movabs $0x801354,%r14
+  80270a:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  80270d:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  802712:	74 7d                	je     802791 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  802714:	8b 03                	mov    (%rbx),%eax
+  802716:	3b 43 04             	cmp    0x4(%rbx),%eax
+  802719:	75 26                	jne    802741 <devpipe_read+0x79>
+            if (i > 0) return i;
+  80271b:	4d 85 ff             	test   %r15,%r15
+  80271e:	75 77                	jne    802797 <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802720:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802725:	48 89 da             	mov    %rbx,%rdx
+  802728:	be 00 10 00 00       	mov    $0x1000,%esi
+  80272d:	4c 89 e7             	mov    %r12,%rdi
+  802730:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  802733:	85 c0                	test   %eax,%eax
+  802735:	74 72                	je     8027a9 <devpipe_read+0xe1>
+            sys_yield();
+  802737:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  80273a:	8b 03                	mov    (%rbx),%eax
+  80273c:	3b 43 04             	cmp    0x4(%rbx),%eax
+  80273f:	74 df                	je     802720 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802741:	48 63 c8             	movslq %eax,%rcx
+  802744:	48 89 ca             	mov    %rcx,%rdx
+  802747:	48 c1 ea 03          	shr    $0x3,%rdx
+  80274b:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  802752:	08 10 20 
+  802755:	48 89 d0             	mov    %rdx,%rax
+  802758:	48 f7 e6             	mul    %rsi
+  80275b:	48 c1 ea 06          	shr    $0x6,%rdx
+  80275f:	48 89 d0             	mov    %rdx,%rax
+  802762:	48 c1 e0 09          	shl    $0x9,%rax
+  802766:	48 29 d0             	sub    %rdx,%rax
+  802769:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  802770:	00 
+  802771:	48 89 c8             	mov    %rcx,%rax
+  802774:	48 29 d0             	sub    %rdx,%rax
+  802777:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  80277c:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  802780:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  802784:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  802787:	49 83 c7 01          	add    $0x1,%r15
+  80278b:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  80278f:	75 83                	jne    802714 <devpipe_read+0x4c>
+    return n;
+  802791:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802795:	eb 03                	jmp    80279a <devpipe_read+0xd2>
+            if (i > 0) return i;
+  802797:	4c 89 f8             	mov    %r15,%rax
+}
+  80279a:	48 83 c4 18          	add    $0x18,%rsp
+  80279e:	5b                   	pop    %rbx
+  80279f:	41 5c                	pop    %r12
+  8027a1:	41 5d                	pop    %r13
+  8027a3:	41 5e                	pop    %r14
+  8027a5:	41 5f                	pop    %r15
+  8027a7:	5d                   	pop    %rbp
+  8027a8:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  8027a9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027ae:	eb ea                	jmp    80279a <devpipe_read+0xd2>
+
+00000000008027b0 <pipe>:
+pipe(int pfd[2]) {
+  8027b0:	55                   	push   %rbp
+  8027b1:	48 89 e5             	mov    %rsp,%rbp
+  8027b4:	41 55                	push   %r13
+  8027b6:	41 54                	push   %r12
+  8027b8:	53                   	push   %rbx
+  8027b9:	48 81 ec b8 00 00 00 	sub    $0xb8,%rsp
+  8027c0:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8027c3:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  8027c7:	48 b8 29 1a 80 00 00 	movabs $0x801a29,%rax
+  8027ce:	00 00 00 
+  8027d1:	ff d0                	call   *%rax
+  8027d3:	89 c3                	mov    %eax,%ebx
+  8027d5:	85 c0                	test   %eax,%eax
+  8027d7:	0f 88 51 01 00 00    	js     80292e <pipe+0x17e>
+        (res = fd_alloc_from(fd2num(fd0) + 1, &fd1)) < 0) goto err;
+  8027dd:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8027e1:	48 b8 82 19 80 00 00 	movabs $0x801982,%rax
+  8027e8:	00 00 00 
+  8027eb:	ff d0                	call   *%rax
+  8027ed:	8d 78 01             	lea    0x1(%rax),%edi
+  8027f0:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8027f4:	48 b8 b0 19 80 00 00 	movabs $0x8019b0,%rax
+  8027fb:	00 00 00 
+  8027fe:	ff d0                	call   *%rax
+  802800:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  802802:	85 c0                	test   %eax,%eax
+  802804:	0f 88 24 01 00 00    	js     80292e <pipe+0x17e>
+    va = fd2data(fd0);
+  80280a:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80280e:	48 bb 94 19 80 00 00 	movabs $0x801994,%rbx
+  802815:	00 00 00 
+  802818:	ff d3                	call   *%rbx
+  80281a:	49 89 c5             	mov    %rax,%r13
+    struct RegionOp ops[] = {
+  80281d:	48 8d bd 30 ff ff ff 	lea    -0xd0(%rbp),%rdi
+  802824:	b9 14 00 00 00       	mov    $0x14,%ecx
+  802829:	b8 00 00 00 00       	mov    $0x0,%eax
+  80282e:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+  802831:	c7 85 34 ff ff ff 46 	movl   $0x46,-0xcc(%rbp)
+  802838:	00 00 00 
+  80283b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80283f:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+  802846:	48 c7 85 50 ff ff ff 	movq   $0x1000,-0xb0(%rbp)
+  80284d:	00 10 00 00 
+  802851:	c7 85 5c ff ff ff 46 	movl   $0x46,-0xa4(%rbp)
+  802858:	00 00 00 
+            {.type = REGION_ALLOC, .dstva = (uintptr_t)fd1, .size = PAGE_SIZE, .perm = PROT_RW | PROT_SHARE},
+  80285b:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+    struct RegionOp ops[] = {
+  80285f:	48 89 bd 70 ff ff ff 	mov    %rdi,-0x90(%rbp)
+  802866:	48 c7 85 78 ff ff ff 	movq   $0x1000,-0x88(%rbp)
+  80286d:	00 10 00 00 
+  802871:	c7 45 84 46 00 00 00 	movl   $0x46,-0x7c(%rbp)
+  802878:	4c 89 6d 98          	mov    %r13,-0x68(%rbp)
+  80287c:	48 c7 45 a0 00 10 00 	movq   $0x1000,-0x60(%rbp)
+  802883:	00 
+  802884:	c7 45 a8 01 00 00 00 	movl   $0x1,-0x58(%rbp)
+  80288b:	c7 45 ac 46 00 00 00 	movl   $0x46,-0x54(%rbp)
+  802892:	4c 89 6d b8          	mov    %r13,-0x48(%rbp)
+            {.type = REGION_MAP, .srcva = (uintptr_t)va, .dstva = (uintptr_t)fd2data(fd1), .size = PAGE_SIZE, .perm = PROT_RW | PROT_SHARE},
+  802896:	ff d3                	call   *%rbx
+    struct RegionOp ops[] = {
+  802898:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80289c:	48 c7 45 c8 00 10 00 	movq   $0x1000,-0x38(%rbp)
+  8028a3:	00 
+    if ((res = sys_region_batch(ops, sizeof ops / sizeof *ops)) < 0) goto err1;
+  8028a4:	be 04 00 00 00       	mov    $0x4,%esi
+  8028a9:	48 8d bd 30 ff ff ff 	lea    -0xd0(%rbp),%rdi
+  8028b0:	48 b8 16 15 80 00 00 	movabs $0x801516,%rax
+  8028b7:	00 00 00 
+  8028ba:	ff d0                	call   *%rax
+  8028bc:	89 c3                	mov    %eax,%ebx
+  8028be:	85 c0                	test   %eax,%eax
+  8028c0:	0f 88 ad 00 00 00    	js     802973 <pipe+0x1c3>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8028c6:	be 00 10 00 00       	mov    $0x1000,%esi
+  8028cb:	4c 89 ef             	mov    %r13,%rdi
+  8028ce:	48 b8 85 13 80 00 00 	movabs $0x801385,%rax
+  8028d5:	00 00 00 
+  8028d8:	ff d0                	call   *%rax
+  8028da:	83 f8 02             	cmp    $0x2,%eax
+  8028dd:	75 5f                	jne    80293e <pipe+0x18e>
+    fd0->fd_dev_id = devpipe.dev_id;
+  8028df:	a1 60 40 80 00 00 00 	movabs 0x804060,%eax
+  8028e6:	00 00 
+  8028e8:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8028ec:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  8028ee:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8028f2:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  8028f9:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8028fd:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  8028ff:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802903:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  80290a:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80290e:	48 bb 82 19 80 00 00 	movabs $0x801982,%rbx
+  802915:	00 00 00 
+  802918:	ff d3                	call   *%rbx
+  80291a:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  80291e:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  802922:	ff d3                	call   *%rbx
+  802924:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  802929:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  80292e:	89 d8                	mov    %ebx,%eax
+  802930:	48 81 c4 b8 00 00 00 	add    $0xb8,%rsp
+  802937:	5b                   	pop    %rbx
+  802938:	41 5c                	pop    %r12
+  80293a:	41 5d                	pop    %r13
+  80293c:	5d                   	pop    %rbp
+  80293d:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  80293e:	48 b9 70 39 80 00 00 	movabs $0x803970,%rcx
+  802945:	00 00 00 
+  802948:	48 ba 47 39 80 00 00 	movabs $0x803947,%rdx
+  80294f:	00 00 00 
+  802952:	be 33 00 00 00       	mov    $0x33,%esi
+  802957:	48 bf 5c 39 80 00 00 	movabs $0x80395c,%rdi
+  80295e:	00 00 00 
+  802961:	b8 00 00 00 00       	mov    $0x0,%eax
+  802966:	49 b8 be 03 80 00 00 	movabs $0x8003be,%r8
+  80296d:	00 00 00 
+  802970:	41 ff d0             	call   *%r8
+        ops[i].type = REGION_UNMAP;
+  802973:	c7 85 30 ff ff ff 02 	movl   $0x2,-0xd0(%rbp)
+  80297a:	00 00 00 
+  80297d:	c7 85 58 ff ff ff 02 	movl   $0x2,-0xa8(%rbp)
+  802984:	00 00 00 
+  802987:	c7 45 80 02 00 00 00 	movl   $0x2,-0x80(%rbp)
+  80298e:	c7 45 a8 02 00 00 00 	movl   $0x2,-0x58(%rbp)
+    sys_region_batch(ops, sizeof ops / sizeof *ops);
+  802995:	be 04 00 00 00       	mov    $0x4,%esi
+  80299a:	48 8d bd 30 ff ff ff 	lea    -0xd0(%rbp),%rdi
+  8029a1:	48 b8 16 15 80 00 00 	movabs $0x801516,%rax
+  8029a8:	00 00 00 
+  8029ab:	ff d0                	call   *%rax
+  8029ad:	e9 7c ff ff ff       	jmp    80292e <pipe+0x17e>
+
+00000000008029b2 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  8029b2:	55                   	push   %rbp
+  8029b3:	48 89 e5             	mov    %rsp,%rbp
+  8029b6:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8029ba:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8029be:	48 b8 43 1a 80 00 00 	movabs $0x801a43,%rax
+  8029c5:	00 00 00 
+  8029c8:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8029ca:	85 c0                	test   %eax,%eax
+  8029cc:	78 35                	js     802a03 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  8029ce:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8029d2:	48 b8 94 19 80 00 00 	movabs $0x801994,%rax
+  8029d9:	00 00 00 
+  8029dc:	ff d0                	call   *%rax
+  8029de:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8029e1:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8029e6:	be 00 10 00 00       	mov    $0x1000,%esi
+  8029eb:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8029ef:	48 b8 b7 13 80 00 00 	movabs $0x8013b7,%rax
+  8029f6:	00 00 00 
+  8029f9:	ff d0                	call   *%rax
+  8029fb:	85 c0                	test   %eax,%eax
+  8029fd:	0f 94 c0             	sete   %al
+  802a00:	0f b6 c0             	movzbl %al,%eax
+}
+  802a03:	c9                   	leave
+  802a04:	c3                   	ret
+
+0000000000802a05 <wait>:
+#include <inc/lib.h>
+
+/* Waits until 'envid' exits. */
+void
+wait(envid_t envid) {
+  802a05:	55                   	push   %rbp
+  802a06:	48 89 e5             	mov    %rsp,%rbp
+  802a09:	41 55                	push   %r13
+  802a0b:	41 54                	push   %r12
+  802a0d:	53                   	push   %rbx
+  802a0e:	48 83 ec 08          	sub    $0x8,%rsp
+    assert(envid != 0);
+  802a12:	85 ff                	test   %edi,%edi
+  802a14:	74 73                	je     802a89 <wait+0x84>
+  802a16:	41 89 fc             	mov    %edi,%r12d
+
+    const volatile struct Env *env = &envs[ENVX(envid)];
+  802a19:	89 f8                	mov    %edi,%eax
+  802a1b:	25 ff 03 00 00       	and    $0x3ff,%eax
+
+    while (env->env_id == envid &&
+  802a20:	89 f9                	mov    %edi,%ecx
+  802a22:	81 e1 ff 03 00 00    	and    $0x3ff,%ecx
+  802a28:	48 69 c9 d0 01 00 00 	imul   $0x1d0,%rcx,%rcx
+  802a2f:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  802a36:	00 00 00 
+  802a39:	48 01 ca             	add    %rcx,%rdx
+  802a3c:	8b 92 e0 00 00 00    	mov    0xe0(%rdx),%edx
+  802a42:	39 d7                	cmp    %edx,%edi
+  802a44:	75 38                	jne    802a7e <wait+0x79>
+           env->env_status != ENV_FREE) {
+  802a46:	48 98                	cltq
+  802a48:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+  802a4f:	48 bb 00 00 c0 1f 80 	movabs $0x801fc00000,%rbx
+  802a56:	00 00 00 
+  802a59:	48 01 c3             	add    %rax,%rbx
+        sys_yield();
+  802a5c:	49 bd 54 13 80 00 00 	movabs $0x801354,%r13
+  802a63:	00 00 00 
+           env->env_status != ENV_FREE) {
+  802a66:	8b 83 ec 00 00 00    	mov    0xec(%rbx),%eax
+    while (env->env_id == envid &&
+  802a6c:	85 c0                	test   %eax,%eax
+  802a6e:	74 0e                	je     802a7e <wait+0x79>
+        sys_yield();
+  802a70:	41 ff d5             	call   *%r13
+    while (env->env_id == envid &&
+  802a73:	8b 83 e0 00 00 00    	mov    0xe0(%rbx),%eax
+  802a79:	44 39 e0             	cmp    %r12d,%eax
+  802a7c:	74 e8                	je     802a66 <wait+0x61>
+    }
+}
+  802a7e:	48 83 c4 08          	add    $0x8,%rsp
+  802a82:	5b                   	pop    %rbx
+  802a83:	41 5c                	pop    %r12
+  802a85:	41 5d                	pop    %r13
+  802a87:	5d                   	pop    %rbp
+  802a88:	c3                   	ret
+    assert(envid != 0);
+  802a89:	48 b9 94 39 80 00 00 	movabs $0x803994,%rcx
+  802a90:	00 00 00 
+  802a93:	48 ba 47 39 80 00 00 	movabs $0x803947,%rdx
+  802a9a:	00 00 00 
+  802a9d:	be 06 00 00 00       	mov    $0x6,%esi
+  802aa2:	48 bf 9f 39 80 00 00 	movabs $0x80399f,%rdi
+  802aa9:	00 00 00 
+  802aac:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ab1:	49 b8 be 03 80 00 00 	movabs $0x8003be,%r8
+  802ab8:	00 00 00 
+  802abb:	41 ff d0             	call   *%r8
+
+0000000000802abe <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  802abe:	48 89 f8             	mov    %rdi,%rax
+  802ac1:	48 c1 e8 27          	shr    $0x27,%rax
+  802ac5:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  802acc:	01 00 00 
+  802acf:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802ad3:	f6 c2 01             	test   $0x1,%dl
+  802ad6:	74 6d                	je     802b45 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  802ad8:	48 89 f8             	mov    %rdi,%rax
+  802adb:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802adf:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802ae6:	01 00 00 
+  802ae9:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802aed:	f6 c2 01             	test   $0x1,%dl
+  802af0:	74 62                	je     802b54 <get_uvpt_entry+0x96>
+  802af2:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802af9:	01 00 00 
+  802afc:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802b00:	f6 c2 80             	test   $0x80,%dl
+  802b03:	75 4f                	jne    802b54 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  802b05:	48 89 f8             	mov    %rdi,%rax
+  802b08:	48 c1 e8 15          	shr    $0x15,%rax
+  802b0c:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802b13:	01 00 00 
+  802b16:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802b1a:	f6 c2 01             	test   $0x1,%dl
+  802b1d:	74 44                	je     802b63 <get_uvpt_entry+0xa5>
+  802b1f:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802b26:	01 00 00 
+  802b29:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802b2d:	f6 c2 80             	test   $0x80,%dl
+  802b30:	75 31                	jne    802b63 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  802b32:	48 c1 ef 0c          	shr    $0xc,%rdi
+  802b36:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802b3d:	01 00 00 
+  802b40:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  802b44:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  802b45:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  802b4c:	01 00 00 
+  802b4f:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802b53:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  802b54:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802b5b:	01 00 00 
+  802b5e:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802b62:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  802b63:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802b6a:	01 00 00 
+  802b6d:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802b71:	c3                   	ret
+
+0000000000802b72 <get_prot>:
+
+int
+get_prot(void *va) {
+  802b72:	55                   	push   %rbp
+  802b73:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  802b76:	48 b8 be 2a 80 00 00 	movabs $0x802abe,%rax
+  802b7d:	00 00 00 
+  802b80:	ff d0                	call   *%rax
+  802b82:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  802b85:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  802b8a:	89 c1                	mov    %eax,%ecx
+  802b8c:	83 c9 04             	or     $0x4,%ecx
+  802b8f:	f6 c2 01             	test   $0x1,%dl
+  802b92:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  802b95:	89 c1                	mov    %eax,%ecx
+  802b97:	83 c9 02             	or     $0x2,%ecx
+  802b9a:	f6 c2 02             	test   $0x2,%dl
+  802b9d:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  802ba0:	89 c1                	mov    %eax,%ecx
+  802ba2:	83 c9 01             	or     $0x1,%ecx
+  802ba5:	48 85 d2             	test   %rdx,%rdx
+  802ba8:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  802bab:	89 c1                	mov    %eax,%ecx
+  802bad:	83 c9 40             	or     $0x40,%ecx
+  802bb0:	f6 c6 04             	test   $0x4,%dh
+  802bb3:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  802bb6:	5d                   	pop    %rbp
+  802bb7:	c3                   	ret
+
+0000000000802bb8 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  802bb8:	55                   	push   %rbp
+  802bb9:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  802bbc:	48 b8 be 2a 80 00 00 	movabs $0x802abe,%rax
+  802bc3:	00 00 00 
+  802bc6:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  802bc8:	48 c1 e8 06          	shr    $0x6,%rax
+  802bcc:	83 e0 01             	and    $0x1,%eax
+}
+  802bcf:	5d                   	pop    %rbp
+  802bd0:	c3                   	ret
+
+0000000000802bd1 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  802bd1:	55                   	push   %rbp
+  802bd2:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  802bd5:	48 b8 be 2a 80 00 00 	movabs $0x802abe,%rax
+  802bdc:	00 00 00 
+  802bdf:	ff d0                	call   *%rax
+  802be1:	83 e0 01             	and    $0x1,%eax
+}
+  802be4:	5d                   	pop    %rbp
+  802be5:	c3                   	ret
+
+0000000000802be6 <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  802be6:	55                   	push   %rbp
+  802be7:	48 89 e5             	mov    %rsp,%rbp
+  802bea:	41 57                	push   %r15
+  802bec:	41 56                	push   %r14
+  802bee:	41 55                	push   %r13
+  802bf0:	41 54                	push   %r12
+  802bf2:	53                   	push   %rbx
+  802bf3:	48 83 ec 38          	sub    $0x38,%rsp
+  802bf7:	49 89 f7             	mov    %rsi,%r15
+  802bfa:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+                    }
+                    continue;
+                }
+                for (int ptei = 0; ptei < PT_ENTRY_COUNT; ptei++) {
+                    uintptr_t pte_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, pdei, ptei, 0);
+                    pte_t pte = uvpt[VPT(pte_addr)];
+  802c00:	49 bd 00 00 00 00 00 	movabs $0x10000000000,%r13
+  802c07:	01 00 00 
+  802c0a:	4d 89 e6             	mov    %r12,%r14
+  802c0d:	49 89 fc             	mov    %rdi,%r12
+  802c10:	e9 19 01 00 00       	jmp    802d2e <foreach_shared_region+0x148>
+  802c15:	48 89 5d b0          	mov    %rbx,-0x50(%rbp)
+  802c19:	4c 89 75 a8          	mov    %r14,-0x58(%rbp)
+  802c1d:	eb 52                	jmp    802c71 <foreach_shared_region+0x8b>
+                for (int ptei = 0; ptei < PT_ENTRY_COUNT; ptei++) {
+  802c1f:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802c26:	48 81 fb 00 00 20 00 	cmp    $0x200000,%rbx
+  802c2d:	74 2e                	je     802c5d <foreach_shared_region+0x77>
+                    uintptr_t pte_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, pdei, ptei, 0);
+  802c2f:	48 89 df             	mov    %rbx,%rdi
+  802c32:	4c 09 f7             	or     %r14,%rdi
+                    pte_t pte = uvpt[VPT(pte_addr)];
+  802c35:	48 89 f8             	mov    %rdi,%rax
+  802c38:	48 c1 e8 0c          	shr    $0xc,%rax
+  802c3c:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+                    if ((pte & PTE_P) && (pte & PTE_SHARE)) {
+  802c41:	25 01 04 00 00       	and    $0x401,%eax
+  802c46:	48 3d 01 04 00 00    	cmp    $0x401,%rax
+  802c4c:	75 d1                	jne    802c1f <foreach_shared_region+0x39>
+                        fun((void*)pte_addr, (void*)(pte_addr + PAGE_SIZE), arg);
+  802c4e:	48 8d b7 00 10 00 00 	lea    0x1000(%rdi),%rsi
+  802c55:	4c 89 fa             	mov    %r15,%rdx
+  802c58:	41 ff d4             	call   *%r12
+  802c5b:	eb c2                	jmp    802c1f <foreach_shared_region+0x39>
+            for (int pdei = 0; pdei < PD_ENTRY_COUNT; pdei++) {
+  802c5d:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  802c64:	00 
+  802c65:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802c69:	48 3d 00 00 00 40    	cmp    $0x40000000,%rax
+  802c6f:	74 46                	je     802cb7 <foreach_shared_region+0xd1>
+                uintptr_t pde_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, pdei, 0, 0);
+  802c71:	4c 8b 75 c8          	mov    -0x38(%rbp),%r14
+  802c75:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802c79:	49 09 c6             	or     %rax,%r14
+                pde_t pde = uvpd[VPD(pde_addr)];
+  802c7c:	4c 89 f0             	mov    %r14,%rax
+  802c7f:	48 c1 e8 15          	shr    $0x15,%rax
+  802c83:	48 b9 00 00 00 80 00 	movabs $0x10080000000,%rcx
+  802c8a:	01 00 00 
+  802c8d:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+                if (!(pde & PTE_P)) {
+  802c91:	a8 01                	test   $0x1,%al
+  802c93:	74 c8                	je     802c5d <foreach_shared_region+0x77>
+                if (pde & PTE_PS) {
+  802c95:	48 89 c3             	mov    %rax,%rbx
+  802c98:	81 e3 80 00 00 00    	and    $0x80,%ebx
+  802c9e:	74 8f                	je     802c2f <foreach_shared_region+0x49>
+                    if (pde & PTE_SHARE) {
+  802ca0:	f6 c4 04             	test   $0x4,%ah
+  802ca3:	74 b8                	je     802c5d <foreach_shared_region+0x77>
+                        fun((void*)pde_addr, (void*)(pde_addr + 1024 * 1024 * 2), arg);
+  802ca5:	49 8d b6 00 00 20 00 	lea    0x200000(%r14),%rsi
+  802cac:	4c 89 fa             	mov    %r15,%rdx
+  802caf:	4c 89 f7             	mov    %r14,%rdi
+  802cb2:	41 ff d4             	call   *%r12
+  802cb5:	eb a6                	jmp    802c5d <foreach_shared_region+0x77>
+  802cb7:	48 8b 5d b0          	mov    -0x50(%rbp),%rbx
+  802cbb:	4c 8b 75 a8          	mov    -0x58(%rbp),%r14
+        for (int pdpei = 0; pdpei < PDP_ENTRY_COUNT; pdpei++) {
+  802cbf:	48 81 c3 00 00 00 40 	add    $0x40000000,%rbx
+  802cc6:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802ccd:	00 00 00 
+  802cd0:	48 39 c3             	cmp    %rax,%rbx
+  802cd3:	74 4c                	je     802d21 <foreach_shared_region+0x13b>
+            uintptr_t pdpe_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, 0, 0, 0);
+  802cd5:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802cd9:	48 09 d8             	or     %rbx,%rax
+  802cdc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+            pdpe_t pdpe = uvpdp[VPDP(pdpe_addr)];
+  802ce0:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802ce4:	48 b9 00 00 40 80 00 	movabs $0x10080400000,%rcx
+  802ceb:	01 00 00 
+  802cee:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+            if (!(pdpe & PTE_P)) {
+  802cf2:	a8 01                	test   $0x1,%al
+  802cf4:	74 c9                	je     802cbf <foreach_shared_region+0xd9>
+            if (pdpe & PTE_PS) {
+  802cf6:	48 89 c1             	mov    %rax,%rcx
+  802cf9:	81 e1 80 00 00 00    	and    $0x80,%ecx
+  802cff:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  802d03:	0f 84 0c ff ff ff    	je     802c15 <foreach_shared_region+0x2f>
+                if (pdpe & PTE_SHARE) {
+  802d09:	f6 c4 04             	test   $0x4,%ah
+  802d0c:	74 b1                	je     802cbf <foreach_shared_region+0xd9>
+                    fun((void*)pdpe_addr, (void*)(pdpe_addr + 1024 * 1024 * 1024), arg); 
+  802d0e:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  802d12:	48 8d b7 00 00 00 40 	lea    0x40000000(%rdi),%rsi
+  802d19:	4c 89 fa             	mov    %r15,%rdx
+  802d1c:	41 ff d4             	call   *%r12
+  802d1f:	eb 9e                	jmp    802cbf <foreach_shared_region+0xd9>
+    for (int pml4ei = 0; pml4ei < PML4_ENTRY_COUNT; pml4ei++) {
+  802d21:	49 83 c6 01          	add    $0x1,%r14
+  802d25:	49 81 fe 00 02 00 00 	cmp    $0x200,%r14
+  802d2c:	74 24                	je     802d52 <foreach_shared_region+0x16c>
+        pml4e_t pml4e = uvpml4[VPML4(pml4_addr)];
+  802d2e:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  802d35:	01 00 00 
+  802d38:	4a 8b 04 f0          	mov    (%rax,%r14,8),%rax
+        if (!(pml4e & PTE_P)) {
+  802d3c:	a8 01                	test   $0x1,%al
+  802d3e:	74 e1                	je     802d21 <foreach_shared_region+0x13b>
+  802d40:	4c 89 f0             	mov    %r14,%rax
+  802d43:	48 c1 e0 27          	shl    $0x27,%rax
+  802d47:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  802d4b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802d50:	eb 83                	jmp    802cd5 <foreach_shared_region+0xef>
+            }
+        }
+    }
+    
+    return 0;
+}
+  802d52:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d57:	48 83 c4 38          	add    $0x38,%rsp
+  802d5b:	5b                   	pop    %rbx
+  802d5c:	41 5c                	pop    %r12
+  802d5e:	41 5d                	pop    %r13
+  802d60:	41 5e                	pop    %r14
+  802d62:	41 5f                	pop    %r15
+  802d64:	5d                   	pop    %rbp
+  802d65:	c3                   	ret
+
+0000000000802d66 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  802d66:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d6b:	c3                   	ret
+
+0000000000802d6c <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  802d6c:	55                   	push   %rbp
+  802d6d:	48 89 e5             	mov    %rsp,%rbp
+  802d70:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  802d73:	48 be aa 39 80 00 00 	movabs $0x8039aa,%rsi
+  802d7a:	00 00 00 
+  802d7d:	48 b8 33 0e 80 00 00 	movabs $0x800e33,%rax
+  802d84:	00 00 00 
+  802d87:	ff d0                	call   *%rax
+    return 0;
+}
+  802d89:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d8e:	5d                   	pop    %rbp
+  802d8f:	c3                   	ret
+
+0000000000802d90 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  802d90:	55                   	push   %rbp
+  802d91:	48 89 e5             	mov    %rsp,%rbp
+  802d94:	41 57                	push   %r15
+  802d96:	41 56                	push   %r14
+  802d98:	41 55                	push   %r13
+  802d9a:	41 54                	push   %r12
+  802d9c:	53                   	push   %rbx
+  802d9d:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  802da4:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  802dab:	48 85 d2             	test   %rdx,%rdx
+  802dae:	74 7a                	je     802e2a <devcons_write+0x9a>
+  802db0:	49 89 d6             	mov    %rdx,%r14
+  802db3:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802db9:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  802dbe:	49 bf 2d 10 80 00 00 	movabs $0x80102d,%r15
+  802dc5:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  802dc8:	4c 89 f3             	mov    %r14,%rbx
+  802dcb:	48 29 f3             	sub    %rsi,%rbx
+  802dce:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802dd3:	48 39 c3             	cmp    %rax,%rbx
+  802dd6:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  802dda:	4c 63 eb             	movslq %ebx,%r13
+  802ddd:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  802de4:	48 01 c6             	add    %rax,%rsi
+  802de7:	4c 89 ea             	mov    %r13,%rdx
+  802dea:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802df1:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  802df4:	4c 89 ee             	mov    %r13,%rsi
+  802df7:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802dfe:	48 b8 5a 12 80 00 00 	movabs $0x80125a,%rax
+  802e05:	00 00 00 
+  802e08:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  802e0a:	41 01 dc             	add    %ebx,%r12d
+  802e0d:	49 63 f4             	movslq %r12d,%rsi
+  802e10:	4c 39 f6             	cmp    %r14,%rsi
+  802e13:	72 b3                	jb     802dc8 <devcons_write+0x38>
+    return res;
+  802e15:	49 63 c4             	movslq %r12d,%rax
+}
+  802e18:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  802e1f:	5b                   	pop    %rbx
+  802e20:	41 5c                	pop    %r12
+  802e22:	41 5d                	pop    %r13
+  802e24:	41 5e                	pop    %r14
+  802e26:	41 5f                	pop    %r15
+  802e28:	5d                   	pop    %rbp
+  802e29:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  802e2a:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802e30:	eb e3                	jmp    802e15 <devcons_write+0x85>
+
+0000000000802e32 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  802e32:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  802e35:	ba 00 00 00 00       	mov    $0x0,%edx
+  802e3a:	48 85 c0             	test   %rax,%rax
+  802e3d:	74 55                	je     802e94 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  802e3f:	55                   	push   %rbp
+  802e40:	48 89 e5             	mov    %rsp,%rbp
+  802e43:	41 55                	push   %r13
+  802e45:	41 54                	push   %r12
+  802e47:	53                   	push   %rbx
+  802e48:	48 83 ec 08          	sub    $0x8,%rsp
+  802e4c:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  802e4f:	48 bb 87 12 80 00 00 	movabs $0x801287,%rbx
+  802e56:	00 00 00 
+  802e59:	49 bc 54 13 80 00 00 	movabs $0x801354,%r12
+  802e60:	00 00 00 
+  802e63:	eb 03                	jmp    802e68 <devcons_read+0x36>
+  802e65:	41 ff d4             	call   *%r12
+  802e68:	ff d3                	call   *%rbx
+  802e6a:	85 c0                	test   %eax,%eax
+  802e6c:	74 f7                	je     802e65 <devcons_read+0x33>
+    if (c < 0) return c;
+  802e6e:	48 63 d0             	movslq %eax,%rdx
+  802e71:	78 13                	js     802e86 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  802e73:	ba 00 00 00 00       	mov    $0x0,%edx
+  802e78:	83 f8 04             	cmp    $0x4,%eax
+  802e7b:	74 09                	je     802e86 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  802e7d:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  802e81:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  802e86:	48 89 d0             	mov    %rdx,%rax
+  802e89:	48 83 c4 08          	add    $0x8,%rsp
+  802e8d:	5b                   	pop    %rbx
+  802e8e:	41 5c                	pop    %r12
+  802e90:	41 5d                	pop    %r13
+  802e92:	5d                   	pop    %rbp
+  802e93:	c3                   	ret
+  802e94:	48 89 d0             	mov    %rdx,%rax
+  802e97:	c3                   	ret
+
+0000000000802e98 <cputchar>:
+cputchar(int ch) {
+  802e98:	55                   	push   %rbp
+  802e99:	48 89 e5             	mov    %rsp,%rbp
+  802e9c:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  802ea0:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  802ea4:	be 01 00 00 00       	mov    $0x1,%esi
+  802ea9:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  802ead:	48 b8 5a 12 80 00 00 	movabs $0x80125a,%rax
+  802eb4:	00 00 00 
+  802eb7:	ff d0                	call   *%rax
+}
+  802eb9:	c9                   	leave
+  802eba:	c3                   	ret
+
+0000000000802ebb <getchar>:
+getchar(void) {
+  802ebb:	55                   	push   %rbp
+  802ebc:	48 89 e5             	mov    %rsp,%rbp
+  802ebf:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  802ec3:	ba 01 00 00 00       	mov    $0x1,%edx
+  802ec8:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  802ecc:	bf 00 00 00 00       	mov    $0x0,%edi
+  802ed1:	48 b8 26 1d 80 00 00 	movabs $0x801d26,%rax
+  802ed8:	00 00 00 
+  802edb:	ff d0                	call   *%rax
+  802edd:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  802edf:	85 c0                	test   %eax,%eax
+  802ee1:	78 06                	js     802ee9 <getchar+0x2e>
+  802ee3:	74 08                	je     802eed <getchar+0x32>
+  802ee5:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  802ee9:	89 d0                	mov    %edx,%eax
+  802eeb:	c9                   	leave
+  802eec:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  802eed:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  802ef2:	eb f5                	jmp    802ee9 <getchar+0x2e>
+
+0000000000802ef4 <iscons>:
+iscons(int fdnum) {
+  802ef4:	55                   	push   %rbp
+  802ef5:	48 89 e5             	mov    %rsp,%rbp
+  802ef8:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  802efc:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802f00:	48 b8 43 1a 80 00 00 	movabs $0x801a43,%rax
+  802f07:	00 00 00 
+  802f0a:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802f0c:	85 c0                	test   %eax,%eax
+  802f0e:	78 18                	js     802f28 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  802f10:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802f14:	48 b8 a0 40 80 00 00 	movabs $0x8040a0,%rax
+  802f1b:	00 00 00 
+  802f1e:	8b 00                	mov    (%rax),%eax
+  802f20:	39 02                	cmp    %eax,(%rdx)
+  802f22:	0f 94 c0             	sete   %al
+  802f25:	0f b6 c0             	movzbl %al,%eax
+}
+  802f28:	c9                   	leave
+  802f29:	c3                   	ret
+
+0000000000802f2a <opencons>:
+opencons(void) {
+  802f2a:	55                   	push   %rbp
+  802f2b:	48 89 e5             	mov    %rsp,%rbp
+  802f2e:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802f32:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  802f36:	48 b8 29 1a 80 00 00 	movabs $0x801a29,%rax
+  802f3d:	00 00 00 
+  802f40:	ff d0                	call   *%rax
+  802f42:	85 c0                	test   %eax,%eax
+  802f44:	78 49                	js     802f8f <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  802f46:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802f4b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802f50:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  802f54:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f59:	48 b8 e3 13 80 00 00 	movabs $0x8013e3,%rax
+  802f60:	00 00 00 
+  802f63:	ff d0                	call   *%rax
+  802f65:	85 c0                	test   %eax,%eax
+  802f67:	78 26                	js     802f8f <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  802f69:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802f6d:	a1 a0 40 80 00 00 00 	movabs 0x8040a0,%eax
+  802f74:	00 00 
+  802f76:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  802f78:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802f7c:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  802f83:	48 b8 82 19 80 00 00 	movabs $0x801982,%rax
+  802f8a:	00 00 00 
+  802f8d:	ff d0                	call   *%rax
+}
+  802f8f:	c9                   	leave
+  802f90:	c3                   	ret
+
+0000000000802f91 <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  802f91:	55                   	push   %rbp
+  802f92:	48 89 e5             	mov    %rsp,%rbp
+  802f95:	41 55                	push   %r13
+  802f97:	41 54                	push   %r12
+  802f99:	53                   	push   %rbx
+  802f9a:	48 83 ec 08          	sub    $0x8,%rsp
+  802f9e:	49 89 fc             	mov    %rdi,%r12
+  802fa1:	48 89 f7             	mov    %rsi,%rdi
+  802fa4:	48 89 d3             	mov    %rdx,%rbx
+  802fa7:	49 89 cd             	mov    %rcx,%r13
+    // LAB 9: Your code here:
+    int res = sys_ipc_recv(!pg ? (void*)MAX_USER_ADDRESS : pg, !size ? 0 : *size);
+  802faa:	be 00 00 00 00       	mov    $0x0,%esi
+  802faf:	48 85 d2             	test   %rdx,%rdx
+  802fb2:	74 03                	je     802fb7 <ipc_recv+0x26>
+  802fb4:	48 8b 32             	mov    (%rdx),%rsi
+  802fb7:	48 85 ff             	test   %rdi,%rdi
+  802fba:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802fc1:	00 00 00 
+  802fc4:	48 0f 44 f8          	cmove  %rax,%rdi
+  802fc8:	48 b8 b5 17 80 00 00 	movabs $0x8017b5,%rax
+  802fcf:	00 00 00 
+  802fd2:	ff d0                	call   *%rax
+    if (res < 0) {
+  802fd4:	85 c0                	test   %eax,%eax
+  802fd6:	78 66                	js     80303e <ipc_recv+0xad>
+        if (size) {
+            *size = 0;
+        }
+        return res;
+    }
+    if (from_env_store) {
+  802fd8:	4d 85 e4             	test   %r12,%r12
+  802fdb:	74 14                	je     802ff1 <ipc_recv+0x60>
+        *from_env_store = thisenv->env_ipc_from;
+  802fdd:	48 a1 00 54 80 00 00 	movabs 0x805400,%rax
+  802fe4:	00 00 00 
+  802fe7:	8b 80 ac 01 00 00    	mov    0x1ac(%rax),%eax
+  802fed:	41 89 04 24          	mov    %eax,(%r12)
+    }
+    if (perm_store) {
+  802ff1:	4d 85 ed             	test   %r13,%r13
+  802ff4:	74 14                	je     80300a <ipc_recv+0x79>
+        *perm_store = thisenv->env_ipc_perm;
+  802ff6:	48 a1 00 54 80 00 00 	movabs 0x805400,%rax
+  802ffd:	00 00 00 
+  803000:	8b 80 b0 01 00 00    	mov    0x1b0(%rax),%eax
+  803006:	41 89 45 00          	mov    %eax,0x0(%r13)
+    }
+    if (size) {
+  80300a:	48 85 db             	test   %rbx,%rbx
+  80300d:	74 14                	je     803023 <ipc_recv+0x92>
+        *size = thisenv->env_ipc_maxsz;
+  80300f:	48 a1 00 54 80 00 00 	movabs 0x805400,%rax
+  803016:	00 00 00 
+  803019:	48 8b 80 a0 01 00 00 	mov    0x1a0(%rax),%rax
+  803020:	48 89 03             	mov    %rax,(%rbx)
+    }
+    return thisenv->env_ipc_value;
+  803023:	48 a1 00 54 80 00 00 	movabs 0x805400,%rax
+  80302a:	00 00 00 
+  80302d:	8b 80 a8 01 00 00    	mov    0x1a8(%rax),%eax
+}
+  803033:	48 83 c4 08          	add    $0x8,%rsp
+  803037:	5b                   	pop    %rbx
+  803038:	41 5c                	pop    %r12
+  80303a:	41 5d                	pop    %r13
+  80303c:	5d                   	pop    %rbp
+  80303d:	c3                   	ret
+        if (from_env_store) {
+  80303e:	4d 85 e4             	test   %r12,%r12
+  803041:	74 08                	je     80304b <ipc_recv+0xba>
+            *from_env_store = 0;
+  803043:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  80304a:	00 
+        if (perm_store) {
+  80304b:	4d 85 ed             	test   %r13,%r13
+  80304e:	74 08                	je     803058 <ipc_recv+0xc7>
+            *perm_store = 0;
+  803050:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  803057:	00 
+        if (size) {
+  803058:	48 85 db             	test   %rbx,%rbx
+  80305b:	74 d6                	je     803033 <ipc_recv+0xa2>
+            *size = 0;
+  80305d:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  803064:	eb cd                	jmp    803033 <ipc_recv+0xa2>
+
+0000000000803066 <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  803066:	55                   	push   %rbp
+  803067:	48 89 e5             	mov    %rsp,%rbp
+  80306a:	41 57                	push   %r15
+  80306c:	41 56                	push   %r14
+  80306e:	41 55                	push   %r13
+  803070:	41 54                	push   %r12
+  803072:	53                   	push   %rbx
+  803073:	48 83 ec 18          	sub    $0x18,%rsp
+  803077:	41 89 fd             	mov    %edi,%r13d
+  80307a:	89 75 cc             	mov    %esi,-0x34(%rbp)
+  80307d:	49 89 cc             	mov    %rcx,%r12
+  803080:	44 89 45 c8          	mov    %r8d,-0x38(%rbp)
+    // LAB 9: Your code here:
+    int res = 0;
+    while ((res = sys_ipc_try_send(to_env, val, !pg ? (void*)MAX_USER_ADDRESS : pg, size, perm)) < 0) {
+  803084:	48 85 d2             	test   %rdx,%rdx
+  803087:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80308e:	00 00 00 
+  803091:	48 0f 45 c2          	cmovne %rdx,%rax
+  803095:	48 89 c3             	mov    %rax,%rbx
+  803098:	49 be 89 17 80 00 00 	movabs $0x801789,%r14
+  80309f:	00 00 00 
+        if (res != -E_IPC_NOT_RECV) {
+            panic("sys_ipc_try_send failed: %i", res);
+        }
+        sys_yield();
+  8030a2:	49 bf 54 13 80 00 00 	movabs $0x801354,%r15
+  8030a9:	00 00 00 
+    while ((res = sys_ipc_try_send(to_env, val, !pg ? (void*)MAX_USER_ADDRESS : pg, size, perm)) < 0) {
+  8030ac:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  8030af:	44 8b 45 c8          	mov    -0x38(%rbp),%r8d
+  8030b3:	4c 89 e1             	mov    %r12,%rcx
+  8030b6:	48 89 da             	mov    %rbx,%rdx
+  8030b9:	44 89 ef             	mov    %r13d,%edi
+  8030bc:	41 ff d6             	call   *%r14
+  8030bf:	85 c0                	test   %eax,%eax
+  8030c1:	79 37                	jns    8030fa <ipc_send+0x94>
+        if (res != -E_IPC_NOT_RECV) {
+  8030c3:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  8030c6:	75 05                	jne    8030cd <ipc_send+0x67>
+        sys_yield();
+  8030c8:	41 ff d7             	call   *%r15
+  8030cb:	eb df                	jmp    8030ac <ipc_send+0x46>
+            panic("sys_ipc_try_send failed: %i", res);
+  8030cd:	89 c1                	mov    %eax,%ecx
+  8030cf:	48 ba b6 39 80 00 00 	movabs $0x8039b6,%rdx
+  8030d6:	00 00 00 
+  8030d9:	be 40 00 00 00       	mov    $0x40,%esi
+  8030de:	48 bf d2 39 80 00 00 	movabs $0x8039d2,%rdi
+  8030e5:	00 00 00 
+  8030e8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8030ed:	49 b8 be 03 80 00 00 	movabs $0x8003be,%r8
+  8030f4:	00 00 00 
+  8030f7:	41 ff d0             	call   *%r8
+    }
+    return;
+}
+  8030fa:	48 83 c4 18          	add    $0x18,%rsp
+  8030fe:	5b                   	pop    %rbx
+  8030ff:	41 5c                	pop    %r12
+  803101:	41 5d                	pop    %r13
+  803103:	41 5e                	pop    %r14
+  803105:	41 5f                	pop    %r15
+  803107:	5d                   	pop    %rbp
+  803108:	c3                   	ret
+
+0000000000803109 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  803109:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  80310e:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  803115:	00 00 00 
+  803118:	48 69 d0 d0 01 00 00 	imul   $0x1d0,%rax,%rdx
+  80311f:	48 01 ca             	add    %rcx,%rdx
+  803122:	8b 92 e8 00 00 00    	mov    0xe8(%rdx),%edx
+  803128:	39 fa                	cmp    %edi,%edx
+  80312a:	74 12                	je     80313e <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  80312c:	48 83 c0 01          	add    $0x1,%rax
+  803130:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  803136:	75 e0                	jne    803118 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  803138:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80313d:	c3                   	ret
+            return envs[i].env_id;
+  80313e:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+  803145:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  80314c:	00 00 00 
+  80314f:	48 01 d0             	add    %rdx,%rax
+  803152:	8b 80 e0 00 00 00    	mov    0xe0(%rax),%eax
+  803158:	c3                   	ret
+  803159:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000803160 <__rodata_start>:
+  803160:	6d                   	insl   (%dx),%es:(%rdi)
+  803161:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803162:	74 64                	je     8031c8 <__rodata_start+0x68>
+  803164:	00 6f 70             	add    %ch,0x70(%rdi)
+  803167:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803169:	20 6d 6f             	and    %ch,0x6f(%rbp)
+  80316c:	74 64                	je     8031d2 <__rodata_start+0x72>
+  80316e:	3a 20                	cmp    (%rax),%ah
+  803170:	25 69 00 75 73       	and    $0x73750069,%eax
+  803175:	65 72 2f             	gs jb  8031a7 <__rodata_start+0x47>
+  803178:	74 65                	je     8031df <__rodata_start+0x7f>
+  80317a:	73 74                	jae    8031f0 <__rodata_start+0x90>
+  80317c:	66 64 73 68          	data16 fs jae 8031e8 <__rodata_start+0x88>
+  803180:	61                   	(bad)
+  803181:	72 69                	jb     8031ec <__rodata_start+0x8c>
+  803183:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803184:	67 2e 63 00          	cs movsxd (%eax),%eax
+  803188:	72 65                	jb     8031ef <__rodata_start+0x8f>
+  80318a:	61                   	(bad)
+  80318b:	64 6e                	outsb  %fs:(%rsi),(%dx)
+  80318d:	3a 20                	cmp    (%rax),%ah
+  80318f:	25 69 00 66 6f       	and    $0x6f660069,%eax
+  803194:	72 6b                	jb     803201 <__rodata_start+0xa1>
+  803196:	3a 20                	cmp    (%rax),%ah
+  803198:	25 69 00 72 65       	and    $0x65720069,%eax
+  80319d:	61                   	(bad)
+  80319e:	64 20 69 6e          	and    %ch,%fs:0x6e(%rcx)
+  8031a2:	20 63 68             	and    %ah,0x68(%rbx)
+  8031a5:	69 6c 64 20 73 75 63 	imul   $0x63637573,0x20(%rsp,%riz,2),%ebp
+  8031ac:	63 
+  8031ad:	65 65 64 65 64 0a 00 	gs gs fs gs or %fs:(%rax),%al
+  8031b4:	72 65                	jb     80321b <__rodata_start+0xbb>
+  8031b6:	61                   	(bad)
+  8031b7:	64 20 69 6e          	and    %ch,%fs:0x6e(%rcx)
+  8031bb:	20 70 61             	and    %dh,0x61(%rax)
+  8031be:	72 65                	jb     803225 <__rodata_start+0xc5>
+  8031c0:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8031c1:	74 20                	je     8031e3 <__rodata_start+0x83>
+  8031c3:	73 75                	jae    80323a <__rodata_start+0xda>
+  8031c5:	63 63 65             	movsxd 0x65(%rbx),%esp
+  8031c8:	65 64 65 64 0a 00    	gs fs gs or %fs:(%rax),%al
+  8031ce:	66 90                	xchg   %ax,%ax
+  8031d0:	67 6f                	outsl  %ds:(%esi),(%dx)
+  8031d2:	69 6e 67 20 74 6f 20 	imul   $0x206f7420,0x67(%rsi),%ebp
+  8031d9:	72 65                	jb     803240 <__rodata_start+0xe0>
+  8031db:	61                   	(bad)
+  8031dc:	64 20 69 6e          	and    %ch,%fs:0x6e(%rcx)
+  8031e0:	20 63 68             	and    %ah,0x68(%rbx)
+  8031e3:	69 6c 64 20 28 6d 69 	imul   $0x67696d28,0x20(%rsp,%riz,2),%ebp
+  8031ea:	67 
+  8031eb:	68 74 20 70 61       	push   $0x61702074
+  8031f0:	67 65 20 66 61       	and    %ah,%gs:0x61(%esi)
+  8031f5:	75 6c                	jne    803263 <__rodata_start+0x103>
+  8031f7:	74 20                	je     803219 <__rodata_start+0xb9>
+  8031f9:	69 66 20 79 6f 75 72 	imul   $0x72756f79,0x20(%rsi),%esp
+  803200:	20 73 68             	and    %dh,0x68(%rbx)
+  803203:	61                   	(bad)
+  803204:	72 69                	jb     80326f <__rodata_start+0x10f>
+  803206:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803207:	67 20 69 73          	and    %ch,0x73(%ecx)
+  80320b:	20 62 75             	and    %ah,0x75(%rdx)
+  80320e:	67 67 79 29          	addr32 addr32 jns 80323b <__rodata_start+0xdb>
+  803212:	0a 00                	or     (%rax),%al
+  803214:	00 00                	add    %al,(%rax)
+  803216:	00 00                	add    %al,(%rax)
+  803218:	72 65                	jb     80327f <__rodata_start+0x11f>
+  80321a:	61                   	(bad)
+  80321b:	64 20 69 6e          	and    %ch,%fs:0x6e(%rcx)
+  80321f:	20 70 61             	and    %dh,0x61(%rax)
+  803222:	72 65                	jb     803289 <__rodata_start+0x129>
+  803224:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803225:	74 20                	je     803247 <__rodata_start+0xe7>
+  803227:	67 6f                	outsl  %ds:(%esi),(%dx)
+  803229:	74 20                	je     80324b <__rodata_start+0xeb>
+  80322b:	25 64 2c 20 72       	and    $0x72202c64,%eax
+  803230:	65 61                	gs (bad)
+  803232:	64 20 69 6e          	and    %ch,%fs:0x6e(%rcx)
+  803236:	20 63 68             	and    %ah,0x68(%rbx)
+  803239:	69 6c 64 20 67 6f 74 	imul   $0x20746f67,0x20(%rsp,%riz,2),%ebp
+  803240:	20 
+  803241:	25 64 00 00 00       	and    $0x64,%eax
+  803246:	00 00                	add    %al,(%rax)
+  803248:	72 65                	jb     8032af <__rodata_start+0x14f>
+  80324a:	61                   	(bad)
+  80324b:	64 20 69 6e          	and    %ch,%fs:0x6e(%rcx)
+  80324f:	20 70 61             	and    %dh,0x61(%rax)
+  803252:	72 65                	jb     8032b9 <__rodata_start+0x159>
+  803254:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803255:	74 20                	je     803277 <__rodata_start+0x117>
+  803257:	67 6f                	outsl  %ds:(%esi),(%dx)
+  803259:	74 20                	je     80327b <__rodata_start+0x11b>
+  80325b:	64 69 66 66 65 72 65 	imul   $0x6e657265,%fs:0x66(%rsi),%esp
+  803262:	6e 
+  803263:	74 20                	je     803285 <__rodata_start+0x125>
+  803265:	62                   	(bad)
+  803266:	79 74                	jns    8032dc <__rodata_start+0x17c>
+  803268:	65 73 20             	gs jae 80328b <__rodata_start+0x12b>
+  80326b:	66 72 6f             	data16 jb 8032dd <__rodata_start+0x17d>
+  80326e:	6d                   	insl   (%dx),%es:(%rdi)
+  80326f:	20 72 65             	and    %dh,0x65(%rdx)
+  803272:	61                   	(bad)
+  803273:	64 20 69 6e          	and    %ch,%fs:0x6e(%rcx)
+  803277:	20 63 68             	and    %ah,0x68(%rbx)
+  80327a:	69 6c 64 00 00 00 72 	imul   $0x65720000,0x0(%rsp,%riz,2),%ebp
+  803281:	65 
+  803282:	61                   	(bad)
+  803283:	64 20 69 6e          	and    %ch,%fs:0x6e(%rcx)
+  803287:	20 70 61             	and    %dh,0x61(%rax)
+  80328a:	72 65                	jb     8032f1 <__rodata_start+0x191>
+  80328c:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80328d:	74 20                	je     8032af <__rodata_start+0x14f>
+  80328f:	67 6f                	outsl  %ds:(%esi),(%dx)
+  803291:	74 20                	je     8032b3 <__rodata_start+0x153>
+  803293:	25 64 2c 20 74       	and    $0x74202c64,%eax
+  803298:	68 65 6e 20 67       	push   $0x67206e65
+  80329d:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80329e:	74 20                	je     8032c0 <__rodata_start+0x160>
+  8032a0:	25 64 00 3c 75       	and    $0x753c0064,%eax
+  8032a5:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8032a6:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  8032aa:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8032ab:	3e 00 0f             	ds add %cl,(%rdi)
+  8032ae:	1f                   	(bad)
+  8032af:	00 5b 25             	add    %bl,0x25(%rbx)
+  8032b2:	30 38                	xor    %bh,(%rax)
+  8032b4:	78 5d                	js     803313 <__rodata_start+0x1b3>
+  8032b6:	20 75 73             	and    %dh,0x73(%rbp)
+  8032b9:	65 72 20             	gs jb  8032dc <__rodata_start+0x17c>
+  8032bc:	70 61                	jo     80331f <__rodata_start+0x1bf>
+  8032be:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8032bf:	69 63 20 69 6e 20 25 	imul   $0x25206e69,0x20(%rbx),%esp
+  8032c6:	73 20                	jae    8032e8 <__rodata_start+0x188>
+  8032c8:	61                   	(bad)
+  8032c9:	74 20                	je     8032eb <__rodata_start+0x18b>
+  8032cb:	25 73 3a 25 64       	and    $0x64253a73,%eax
+  8032d0:	3a 20                	cmp    (%rax),%ah
+  8032d2:	00 30                	add    %dh,(%rax)
+  8032d4:	31 32                	xor    %esi,(%rdx)
+  8032d6:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  8032dd:	41                   	rex.B
+  8032de:	42                   	rex.X
+  8032df:	43                   	rex.XB
+  8032e0:	44                   	rex.R
+  8032e1:	45                   	rex.RB
+  8032e2:	46 00 30             	rex.RX add %r14b,(%rax)
+  8032e5:	31 32                	xor    %esi,(%rdx)
+  8032e7:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  8032ee:	61                   	(bad)
+  8032ef:	62 63 64 65 66       	(bad)
+  8032f4:	00 28                	add    %ch,(%rax)
+  8032f6:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8032f7:	75 6c                	jne    803365 <__rodata_start+0x205>
+  8032f9:	6c                   	insb   (%dx),%es:(%rdi)
+  8032fa:	29 00                	sub    %eax,(%rax)
+  8032fc:	65 72 72             	gs jb  803371 <__rodata_start+0x211>
+  8032ff:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803300:	72 20                	jb     803322 <__rodata_start+0x1c2>
+  803302:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  803307:	73 70                	jae    803379 <__rodata_start+0x219>
+  803309:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  80330d:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  803314:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803315:	72 00                	jb     803317 <__rodata_start+0x1b7>
+  803317:	62 61 64 20 65       	(bad)
+  80331c:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80331d:	76 69                	jbe    803388 <__rodata_start+0x228>
+  80331f:	72 6f                	jb     803390 <__rodata_start+0x230>
+  803321:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803322:	6d                   	insl   (%dx),%es:(%rdi)
+  803323:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803325:	74 00                	je     803327 <__rodata_start+0x1c7>
+  803327:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  80332e:	20 70 61             	and    %dh,0x61(%rax)
+  803331:	72 61                	jb     803394 <__rodata_start+0x234>
+  803333:	6d                   	insl   (%dx),%es:(%rdi)
+  803334:	65 74 65             	gs je  80339c <__rodata_start+0x23c>
+  803337:	72 00                	jb     803339 <__rodata_start+0x1d9>
+  803339:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80333a:	75 74                	jne    8033b0 <__rodata_start+0x250>
+  80333c:	20 6f 66             	and    %ch,0x66(%rdi)
+  80333f:	20 6d 65             	and    %ch,0x65(%rbp)
+  803342:	6d                   	insl   (%dx),%es:(%rdi)
+  803343:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803344:	72 79                	jb     8033bf <__rodata_start+0x25f>
+  803346:	00 6f 75             	add    %ch,0x75(%rdi)
+  803349:	74 20                	je     80336b <__rodata_start+0x20b>
+  80334b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80334c:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  803350:	76 69                	jbe    8033bb <__rodata_start+0x25b>
+  803352:	72 6f                	jb     8033c3 <__rodata_start+0x263>
+  803354:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803355:	6d                   	insl   (%dx),%es:(%rdi)
+  803356:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803358:	74 73                	je     8033cd <__rodata_start+0x26d>
+  80335a:	00 63 6f             	add    %ah,0x6f(%rbx)
+  80335d:	72 72                	jb     8033d1 <__rodata_start+0x271>
+  80335f:	75 70                	jne    8033d1 <__rodata_start+0x271>
+  803361:	74 65                	je     8033c8 <__rodata_start+0x268>
+  803363:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  803368:	75 67                	jne    8033d1 <__rodata_start+0x271>
+  80336a:	20 69 6e             	and    %ch,0x6e(%rcx)
+  80336d:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  80336f:	00 73 65             	add    %dh,0x65(%rbx)
+  803372:	67 6d                	insl   (%dx),%es:(%edi)
+  803374:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803376:	74 61                	je     8033d9 <__rodata_start+0x279>
+  803378:	74 69                	je     8033e3 <__rodata_start+0x283>
+  80337a:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80337b:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80337c:	20 66 61             	and    %ah,0x61(%rsi)
+  80337f:	75 6c                	jne    8033ed <__rodata_start+0x28d>
+  803381:	74 00                	je     803383 <__rodata_start+0x223>
+  803383:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  80338a:	20 45 4c             	and    %al,0x4c(%rbp)
+  80338d:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  803391:	61                   	(bad)
+  803392:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  803397:	20 73 75             	and    %dh,0x75(%rbx)
+  80339a:	63 68 20             	movsxd 0x20(%rax),%ebp
+  80339d:	73 79                	jae    803418 <__rodata_start+0x2b8>
+  80339f:	73 74                	jae    803415 <__rodata_start+0x2b5>
+  8033a1:	65 6d                	gs insl (%dx),%es:(%rdi)
+  8033a3:	20 63 61             	and    %ah,0x61(%rbx)
+  8033a6:	6c                   	insb   (%dx),%es:(%rdi)
+  8033a7:	6c                   	insb   (%dx),%es:(%rdi)
+  8033a8:	00 65 6e             	add    %ah,0x6e(%rbp)
+  8033ab:	74 72                	je     80341f <__rodata_start+0x2bf>
+  8033ad:	79 20                	jns    8033cf <__rodata_start+0x26f>
+  8033af:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8033b0:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8033b1:	74 20                	je     8033d3 <__rodata_start+0x273>
+  8033b3:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  8033b5:	75 6e                	jne    803425 <__rodata_start+0x2c5>
+  8033b7:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  8033bb:	76 20                	jbe    8033dd <__rodata_start+0x27d>
+  8033bd:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  8033c4:	72 65                	jb     80342b <__rodata_start+0x2cb>
+  8033c6:	63 76 69             	movsxd 0x69(%rsi),%esi
+  8033c9:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8033ca:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  8033ce:	65 78 70             	gs js  803441 <__rodata_start+0x2e1>
+  8033d1:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  8033d6:	20 65 6e             	and    %ah,0x6e(%rbp)
+  8033d9:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  8033dd:	20 66 69             	and    %ah,0x69(%rsi)
+  8033e0:	6c                   	insb   (%dx),%es:(%rdi)
+  8033e1:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  8033e5:	20 66 72             	and    %ah,0x72(%rsi)
+  8033e8:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  8033ed:	61                   	(bad)
+  8033ee:	63 65 20             	movsxd 0x20(%rbp),%esp
+  8033f1:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8033f2:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8033f3:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  8033f7:	6b 00 74             	imul   $0x74,(%rax),%eax
+  8033fa:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8033fb:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8033fc:	20 6d 61             	and    %ch,0x61(%rbp)
+  8033ff:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803400:	79 20                	jns    803422 <__rodata_start+0x2c2>
+  803402:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  803409:	72 65                	jb     803470 <__rodata_start+0x310>
+  80340b:	20 6f 70             	and    %ch,0x70(%rdi)
+  80340e:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803410:	00 66 69             	add    %ah,0x69(%rsi)
+  803413:	6c                   	insb   (%dx),%es:(%rdi)
+  803414:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  803418:	20 62 6c             	and    %ah,0x6c(%rdx)
+  80341b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80341c:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  80341f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803420:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803421:	74 20                	je     803443 <__rodata_start+0x2e3>
+  803423:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  803425:	75 6e                	jne    803495 <__rodata_start+0x335>
+  803427:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  80342b:	76 61                	jbe    80348e <__rodata_start+0x32e>
+  80342d:	6c                   	insb   (%dx),%es:(%rdi)
+  80342e:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  803435:	00 
+  803436:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  80343d:	72 65                	jb     8034a4 <__rodata_start+0x344>
+  80343f:	61                   	(bad)
+  803440:	64 79 20             	fs jns 803463 <__rodata_start+0x303>
+  803443:	65 78 69             	gs js  8034af <__rodata_start+0x34f>
+  803446:	73 74                	jae    8034bc <__rodata_start+0x35c>
+  803448:	73 00                	jae    80344a <__rodata_start+0x2ea>
+  80344a:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80344b:	70 65                	jo     8034b2 <__rodata_start+0x352>
+  80344d:	72 61                	jb     8034b0 <__rodata_start+0x350>
+  80344f:	74 69                	je     8034ba <__rodata_start+0x35a>
+  803451:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803452:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803453:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  803456:	74 20                	je     803478 <__rodata_start+0x318>
+  803458:	73 75                	jae    8034cf <__rodata_start+0x36f>
+  80345a:	70 70                	jo     8034cc <__rodata_start+0x36c>
+  80345c:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80345d:	72 74                	jb     8034d3 <__rodata_start+0x373>
+  80345f:	65 64 00 6f 70       	gs add %ch,%fs:0x70(%rdi)
+  803464:	65 72 61             	gs jb  8034c8 <__rodata_start+0x368>
+  803467:	74 69                	je     8034d2 <__rodata_start+0x372>
+  803469:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80346a:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80346b:	20 69 6e             	and    %ch,0x6e(%rcx)
+  80346e:	74 65                	je     8034d5 <__rodata_start+0x375>
+  803470:	72 72                	jb     8034e4 <__rodata_start+0x384>
+  803472:	75 70                	jne    8034e4 <__rodata_start+0x384>
+  803474:	74 65                	je     8034db <__rodata_start+0x37b>
+  803476:	64 00 6e 6f          	add    %ch,%fs:0x6f(%rsi)
+  80347a:	74 20                	je     80349c <__rodata_start+0x33c>
+  80347c:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  80347e:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80347f:	75 67                	jne    8034e8 <__rodata_start+0x388>
+  803481:	68 20 43 50 55       	push   $0x55504320
+  803486:	20 74 69 6d          	and    %dh,0x6d(%rcx,%rbp,2)
+  80348a:	65 00 66 2e          	add    %ah,%gs:0x2e(%rsi)
+  80348e:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+  803495:	00 
+  803496:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80349d:	00 00 00 
+  8034a0:	fb                   	sti
+  8034a1:	06                   	(bad)
+  8034a2:	80 00 00             	addb   $0x0,(%rax)
+  8034a5:	00 00                	add    %al,(%rax)
+  8034a7:	00 3c 0d 80 00 00 00 	add    %bh,0x80(,%rcx,1)
+  8034ae:	00 00                	add    %al,(%rax)
+  8034b0:	2c 0d                	sub    $0xd,%al
+  8034b2:	80 00 00             	addb   $0x0,(%rax)
+  8034b5:	00 00                	add    %al,(%rax)
+  8034b7:	00 3c 0d 80 00 00 00 	add    %bh,0x80(,%rcx,1)
+  8034be:	00 00                	add    %al,(%rax)
+  8034c0:	3c 0d                	cmp    $0xd,%al
+  8034c2:	80 00 00             	addb   $0x0,(%rax)
+  8034c5:	00 00                	add    %al,(%rax)
+  8034c7:	00 3c 0d 80 00 00 00 	add    %bh,0x80(,%rcx,1)
+  8034ce:	00 00                	add    %al,(%rax)
+  8034d0:	3c 0d                	cmp    $0xd,%al
+  8034d2:	80 00 00             	addb   $0x0,(%rax)
+  8034d5:	00 00                	add    %al,(%rax)
+  8034d7:	00 1a                	add    %bl,(%rdx)
+  8034d9:	07                   	(bad)
+  8034da:	80 00 00             	addb   $0x0,(%rax)
+  8034dd:	00 00                	add    %al,(%rax)
+  8034df:	00 3c 0d 80 00 00 00 	add    %bh,0x80(,%rcx,1)
+  8034e6:	00 00                	add    %al,(%rax)
+  8034e8:	3c 0d                	cmp    $0xd,%al
+  8034ea:	80 00 00             	addb   $0x0,(%rax)
+  8034ed:	00 00                	add    %al,(%rax)
+  8034ef:	00 0e                	add    %cl,(%rsi)
+  8034f1:	07                   	(bad)
+  8034f2:	80 00 00             	addb   $0x0,(%rax)
+  8034f5:	00 00                	add    %al,(%rax)
+  8034f7:	00 88 07 80 00 00    	add    %cl,0x8007(%rax)
+  8034fd:	00 00                	add    %al,(%rax)
+  8034ff:	00 3c 0d 80 00 00 00 	add    %bh,0x80(,%rcx,1)
+  803506:	00 00                	add    %al,(%rax)
+  803508:	0e                   	(bad)
+  803509:	07                   	(bad)
+  80350a:	80 00 00             	addb   $0x0,(%rax)
+  80350d:	00 00                	add    %al,(%rax)
+  80350f:	00 54 07 80          	add    %dl,-0x80(%rdi,%rax,1)
+  803513:	00 00                	add    %al,(%rax)
+  803515:	00 00                	add    %al,(%rax)
+  803517:	00 54 07 80          	add    %dl,-0x80(%rdi,%rax,1)
+  80351b:	00 00                	add    %al,(%rax)
+  80351d:	00 00                	add    %al,(%rax)
+  80351f:	00 54 07 80          	add    %dl,-0x80(%rdi,%rax,1)
+  803523:	00 00                	add    %al,(%rax)
+  803525:	00 00                	add    %al,(%rax)
+  803527:	00 54 07 80          	add    %dl,-0x80(%rdi,%rax,1)
+  80352b:	00 00                	add    %al,(%rax)
+  80352d:	00 00                	add    %al,(%rax)
+  80352f:	00 54 07 80          	add    %dl,-0x80(%rdi,%rax,1)
+  803533:	00 00                	add    %al,(%rax)
+  803535:	00 00                	add    %al,(%rax)
+  803537:	00 54 07 80          	add    %dl,-0x80(%rdi,%rax,1)
+  80353b:	00 00                	add    %al,(%rax)
+  80353d:	00 00                	add    %al,(%rax)
+  80353f:	00 54 07 80          	add    %dl,-0x80(%rdi,%rax,1)
+  803543:	00 00                	add    %al,(%rax)
+  803545:	00 00                	add    %al,(%rax)
+  803547:	00 54 07 80          	add    %dl,-0x80(%rdi,%rax,1)
+  80354b:	00 00                	add    %al,(%rax)
+  80354d:	00 00                	add    %al,(%rax)
+  80354f:	00 54 07 80          	add    %dl,-0x80(%rdi,%rax,1)
+  803553:	00 00                	add    %al,(%rax)
+  803555:	00 00                	add    %al,(%rax)
+  803557:	00 3c 0d 80 00 00 00 	add    %bh,0x80(,%rcx,1)
+  80355e:	00 00                	add    %al,(%rax)
+  803560:	3c 0d                	cmp    $0xd,%al
+  803562:	80 00 00             	addb   $0x0,(%rax)
+  803565:	00 00                	add    %al,(%rax)
+  803567:	00 3c 0d 80 00 00 00 	add    %bh,0x80(,%rcx,1)
+  80356e:	00 00                	add    %al,(%rax)
+  803570:	3c 0d                	cmp    $0xd,%al
+  803572:	80 00 00             	addb   $0x0,(%rax)
+  803575:	00 00                	add    %al,(%rax)
+  803577:	00 3c 0d 80 00 00 00 	add    %bh,0x80(,%rcx,1)
+  80357e:	00 00                	add    %al,(%rax)
+  803580:	3c 0d                	cmp    $0xd,%al
+  803582:	80 00 00             	addb   $0x0,(%rax)
+  803585:	00 00                	add    %al,(%rax)
+  803587:	00 3c 0d 80 00 00 00 	add    %bh,0x80(,%rcx,1)
+  80358e:	00 00                	add    %al,(%rax)
+  803590:	3c 0d                	cmp    $0xd,%al
+  803592:	80 00 00             	addb   $0x0,(%rax)
+  803595:	00 00                	add    %al,(%rax)
+  803597:	00 3c 0d 80 00 00 00 	add    %bh,0x80(,%rcx,1)
+  80359e:	00 00                	add    %al,(%rax)
+  8035a0:	3c 0d                	cmp    $0xd,%al
+  8035a2:	80 00 00             	addb   $0x0,(%rax)
+  8035a5:	00 00                	add    %al,(%rax)
+  8035a7:	00 3c 0d 80 00 00 00 	add    %bh,0x80(,%rcx,1)
+  8035ae:	00 00                	add    %al,(%rax)
+  8035b0:	3c 0d                	cmp    $0xd,%al
+  8035b2:	80 00 00             	addb   $0x0,(%rax)
+  8035b5:	00 00                	add    %al,(%rax)
+  8035b7:	00 3c 0d 80 00 00 00 	add    %bh,0x80(,%rcx,1)
+  8035be:	00 00                	add    %al,(%rax)
+  8035c0:	3c 0d                	cmp    $0xd,%al
+  8035c2:	80 00 00             	addb   $0x0,(%rax)
+  8035c5:	00 00                	add    %al,(%rax)
+  8035c7:	00 3c 0d 80 00 00 00 	add    %bh,0x80(,%rcx,1)
+  8035ce:	00 00                	add    %al,(%rax)
+  8035d0:	3c 0d                	cmp    $0xd,%al
+  8035d2:	80 00 00             	addb   $0x0,(%rax)
+  8035d5:	00 00                	add    %al,(%rax)
+  8035d7:	00 3c 0d 80 00 00 00 	add    %bh,0x80(,%rcx,1)
+  8035de:	00 00                	add    %al,(%rax)
+  8035e0:	3c 0d                	cmp    $0xd,%al
+  8035e2:	80 00 00             	addb   $0x0,(%rax)
+  8035e5:	00 00                	add    %al,(%rax)
+  8035e7:	00 3c 0d 80 00 00 00 	add    %bh,0x80(,%rcx,1)
+  8035ee:	00 00                	add    %al,(%rax)
+  8035f0:	3c 0d                	cmp    $0xd,%al
+  8035f2:	80 00 00             	addb   $0x0,(%rax)
+  8035f5:	00 00                	add    %al,(%rax)
+  8035f7:	00 3c 0d 80 00 00 00 	add    %bh,0x80(,%rcx,1)
+  8035fe:	00 00                	add    %al,(%rax)
+  803600:	3c 0d                	cmp    $0xd,%al
+  803602:	80 00 00             	addb   $0x0,(%rax)
+  803605:	00 00                	add    %al,(%rax)
+  803607:	00 3c 0d 80 00 00 00 	add    %bh,0x80(,%rcx,1)
+  80360e:	00 00                	add    %al,(%rax)
+  803610:	3c 0d                	cmp    $0xd,%al
+  803612:	80 00 00             	addb   $0x0,(%rax)
+  803615:	00 00                	add    %al,(%rax)
+  803617:	00 3c 0d 80 00 00 00 	add    %bh,0x80(,%rcx,1)
+  80361e:	00 00                	add    %al,(%rax)
+  803620:	3c 0d                	cmp    $0xd,%al
+  803622:	80 00 00             	addb   $0x0,(%rax)
+  803625:	00 00                	add    %al,(%rax)
+  803627:	00 3c 0d 80 00 00 00 	add    %bh,0x80(,%rcx,1)
+  80362e:	00 00                	add    %al,(%rax)
+  803630:	3c 0d                	cmp    $0xd,%al
+  803632:	80 00 00             	addb   $0x0,(%rax)
+  803635:	00 00                	add    %al,(%rax)
+  803637:	00 3c 0d 80 00 00 00 	add    %bh,0x80(,%rcx,1)
+  80363e:	00 00                	add    %al,(%rax)
+  803640:	3c 0d                	cmp    $0xd,%al
+  803642:	80 00 00             	addb   $0x0,(%rax)
+  803645:	00 00                	add    %al,(%rax)
+  803647:	00 5f 0c             	add    %bl,0xc(%rdi)
+  80364a:	80 00 00             	addb   $0x0,(%rax)
+  80364d:	00 00                	add    %al,(%rax)
+  80364f:	00 3c 0d 80 00 00 00 	add    %bh,0x80(,%rcx,1)
+  803656:	00 00                	add    %al,(%rax)
+  803658:	3c 0d                	cmp    $0xd,%al
+  80365a:	80 00 00             	addb   $0x0,(%rax)
+  80365d:	00 00                	add    %al,(%rax)
+  80365f:	00 3c 0d 80 00 00 00 	add    %bh,0x80(,%rcx,1)
+  803666:	00 00                	add    %al,(%rax)
+  803668:	3c 0d                	cmp    $0xd,%al
+  80366a:	80 00 00             	addb   $0x0,(%rax)
+  80366d:	00 00                	add    %al,(%rax)
+  80366f:	00 3c 0d 80 00 00 00 	add    %bh,0x80(,%rcx,1)
+  803676:	00 00                	add    %al,(%rax)
+  803678:	3c 0d                	cmp    $0xd,%al
+  80367a:	80 00 00             	addb   $0x0,(%rax)
+  80367d:	00 00                	add    %al,(%rax)
+  80367f:	00 3c 0d 80 00 00 00 	add    %bh,0x80(,%rcx,1)
+  803686:	00 00                	add    %al,(%rax)
+  803688:	3c 0d                	cmp    $0xd,%al
+  80368a:	80 00 00             	addb   $0x0,(%rax)
+  80368d:	00 00                	add    %al,(%rax)
+  80368f:	00 3c 0d 80 00 00 00 	add    %bh,0x80(,%rcx,1)
+  803696:	00 00                	add    %al,(%rax)
+  803698:	3c 0d                	cmp    $0xd,%al
+  80369a:	80 00 00             	addb   $0x0,(%rax)
+  80369d:	00 00                	add    %al,(%rax)
+  80369f:	00 ab 07 80 00 00    	add    %ch,0x8007(%rbx)
+  8036a5:	00 00                	add    %al,(%rax)
+  8036a7:	00 7a 09             	add    %bh,0x9(%rdx)
+  8036aa:	80 00 00             	addb   $0x0,(%rax)
+  8036ad:	00 00                	add    %al,(%rax)
+  8036af:	00 3c 0d 80 00 00 00 	add    %bh,0x80(,%rcx,1)
+  8036b6:	00 00                	add    %al,(%rax)
+  8036b8:	3c 0d                	cmp    $0xd,%al
+  8036ba:	80 00 00             	addb   $0x0,(%rax)
+  8036bd:	00 00                	add    %al,(%rax)
+  8036bf:	00 3c 0d 80 00 00 00 	add    %bh,0x80(,%rcx,1)
+  8036c6:	00 00                	add    %al,(%rax)
+  8036c8:	3c 0d                	cmp    $0xd,%al
+  8036ca:	80 00 00             	addb   $0x0,(%rax)
+  8036cd:	00 00                	add    %al,(%rax)
+  8036cf:	00 da                	add    %bl,%dl
+  8036d1:	07                   	(bad)
+  8036d2:	80 00 00             	addb   $0x0,(%rax)
+  8036d5:	00 00                	add    %al,(%rax)
+  8036d7:	00 3c 0d 80 00 00 00 	add    %bh,0x80(,%rcx,1)
+  8036de:	00 00                	add    %al,(%rax)
+  8036e0:	3c 0d                	cmp    $0xd,%al
+  8036e2:	80 00 00             	addb   $0x0,(%rax)
+  8036e5:	00 00                	add    %al,(%rax)
+  8036e7:	00 a0 07 80 00 00    	add    %ah,0x8007(%rax)
+  8036ed:	00 00                	add    %al,(%rax)
+  8036ef:	00 3c 0d 80 00 00 00 	add    %bh,0x80(,%rcx,1)
+  8036f6:	00 00                	add    %al,(%rax)
+  8036f8:	3c 0d                	cmp    $0xd,%al
+  8036fa:	80 00 00             	addb   $0x0,(%rax)
+  8036fd:	00 00                	add    %al,(%rax)
+  8036ff:	00 22                	add    %ah,(%rdx)
+  803701:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803707:	00 ec                	add    %ch,%ah
+  803709:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  80370f:	00 3c 0d 80 00 00 00 	add    %bh,0x80(,%rcx,1)
+  803716:	00 00                	add    %al,(%rax)
+  803718:	3c 0d                	cmp    $0xd,%al
+  80371a:	80 00 00             	addb   $0x0,(%rax)
+  80371d:	00 00                	add    %al,(%rax)
+  80371f:	00 71 08             	add    %dh,0x8(%rcx)
+  803722:	80 00 00             	addb   $0x0,(%rax)
+  803725:	00 00                	add    %al,(%rax)
+  803727:	00 3c 0d 80 00 00 00 	add    %bh,0x80(,%rcx,1)
+  80372e:	00 00                	add    %al,(%rax)
+  803730:	4e 0a 80 00 00 00 00 	rex.WRX or 0x0(%rax),%r8b
+  803737:	00 3c 0d 80 00 00 00 	add    %bh,0x80(,%rcx,1)
+  80373e:	00 00                	add    %al,(%rax)
+  803740:	3c 0d                	cmp    $0xd,%al
+  803742:	80 00 00             	addb   $0x0,(%rax)
+  803745:	00 00                	add    %al,(%rax)
+  803747:	00 5f 0c             	add    %bl,0xc(%rdi)
+  80374a:	80 00 00             	addb   $0x0,(%rax)
+  80374d:	00 00                	add    %al,(%rax)
+  80374f:	00 3c 0d 80 00 00 00 	add    %bh,0x80(,%rcx,1)
+  803756:	00 00                	add    %al,(%rax)
+  803758:	04 07                	add    $0x7,%al
+  80375a:	80 00 00             	addb   $0x0,(%rax)
+  80375d:	00 00                	add    %al,(%rax)
+	...
+
+0000000000803760 <error_string>:
+	...
+  803768:	05 33 80 00 00 00 00 00 17 33 80 00 00 00 00 00     .3.......3......
+  803778:	27 33 80 00 00 00 00 00 39 33 80 00 00 00 00 00     '3......93......
+  803788:	47 33 80 00 00 00 00 00 5b 33 80 00 00 00 00 00     G3......[3......
+  803798:	70 33 80 00 00 00 00 00 83 33 80 00 00 00 00 00     p3.......3......
+  8037a8:	95 33 80 00 00 00 00 00 a9 33 80 00 00 00 00 00     .3.......3......
+  8037b8:	b9 33 80 00 00 00 00 00 cc 33 80 00 00 00 00 00     .3.......3......
+  8037c8:	e3 33 80 00 00 00 00 00 f9 33 80 00 00 00 00 00     .3.......3......
+  8037d8:	11 34 80 00 00 00 00 00 29 34 80 00 00 00 00 00     .4......)4......
+  8037e8:	36 34 80 00 00 00 00 00 10 38 80 00 00 00 00 00     64.......8......
+  8037f8:	4a 34 80 00 00 00 00 00 62 34 80 00 00 00 00 00     J4......b4......
+  803808:	78 34 80 00 00 00 00 00 66 69 6c 65 20 69 73 20     x4......file is 
+  803818:	6e 6f 74 20 61 20 76 61 6c 69 64 20 65 78 65 63     not a valid exec
+  803828:	75 74 61 62 6c 65 00 90 73 79 73 63 61 6c 6c 20     utable..syscall 
+  803838:	25 7a 64 20 72 65 74 75 72 6e 65 64 20 25 7a 64     %zd returned %zd
+  803848:	20 28 3e 20 30 29 00 6c 69 62 2f 73 79 73 63 61      (> 0).lib/sysca
+  803858:	6c 6c 2e 63 00 46 6f 72 6b 20 64 6f 75 62 6c 65     ll.c.Fork double
+  803868:	20 66 61 75 6c 74 00 6c 69 62 2f 66 6f 72 6b 2e      fault.lib/fork.
+  803878:	63 00 73 66 6f 72 6b 28 29 20 69 73 20 6e 6f 74     c.sfork() is not
+  803888:	20 69 6d 70 6c 65 6d 65 6e 74 65 64 00 0f 1f 00      implemented....
+  803898:	5b 25 30 38 78 5d 20 75 6e 6b 6e 6f 77 6e 20 64     [%08x] unknown d
+  8038a8:	65 76 69 63 65 20 74 79 70 65 20 25 64 0a 00 00     evice type %d...
+  8038b8:	5b 25 30 38 78 5d 20 66 74 72 75 6e 63 61 74 65     [%08x] ftruncate
+  8038c8:	20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65 0a      %d -- bad mode.
+  8038d8:	00 5b 25 30 38 78 5d 20 72 65 61 64 20 25 64 20     .[%08x] read %d 
+  8038e8:	2d 2d 20 62 61 64 20 6d 6f 64 65 0a 00 5b 25 30     -- bad mode..[%0
+  8038f8:	38 78 5d 20 77 72 69 74 65 20 25 64 20 2d 2d 20     8x] write %d -- 
+  803908:	62 61 64 20 6d 6f 64 65 0a 00 66 2e 0f 1f 84 00     bad mode..f.....
+  803918:	00 00 00 00 0f 1f 40 00                             ......@.
+
+0000000000803920 <devtab>:
+  803920:	20 40 80 00 00 00 00 00 60 40 80 00 00 00 00 00      @......`@......
+  803930:	a0 40 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .@..............
+  803940:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  803950:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  803960:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  803970:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  803980:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  803990:	3d 20 32 00 65 6e 76 69 64 20 21 3d 20 30 00 6c     = 2.envid != 0.l
+  8039a0:	69 62 2f 77 61 69 74 2e 63 00 3c 63 6f 6e 73 3e     ib/wait.c.<cons>
+  8039b0:	00 63 6f 6e 73 00 73 79 73 5f 69 70 63 5f 74 72     .cons.sys_ipc_tr
+  8039c0:	79 5f 73 65 6e 64 20 66 61 69 6c 65 64 3a 20 25     y_send failed: %
+  8039d0:	69 00 6c 69 62 2f 69 70 63 2e 63 00 66 2e 0f 1f     i.lib/ipc.c.f...
+  8039e0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8039f0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803a00:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803a10:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803a20:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803a30:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803a40:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803a50:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803a60:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803a70:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803a80:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803a90:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803aa0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803ab0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803ac0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803ad0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803ae0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803af0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803b00:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803b10:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803b20:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803b30:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803b40:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803b50:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803b60:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803b70:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803b80:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803b90:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803ba0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803bb0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803bc0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803bd0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803be0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803bf0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803c00:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803c10:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803c20:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803c30:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803c40:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803c50:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803c60:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803c70:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803c80:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803c90:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803ca0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803cb0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803cc0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803cd0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803ce0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803cf0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803d00:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803d10:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803d20:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803d30:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803d40:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803d50:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803d60:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803d70:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803d80:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803d90:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803da0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803db0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803dc0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803dd0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803de0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803df0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803e00:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803e10:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803e20:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803e30:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803e40:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803e50:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803e60:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803e70:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803e80:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803e90:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803ea0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803eb0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803ec0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803ed0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803ee0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803ef0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803f00:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803f10:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803f20:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803f30:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803f40:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803f50:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803f60:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803f70:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803f80:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803f90:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803fa0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803fb0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803fc0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803fd0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803fe0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803ff0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 90     ....f.........f.
@@ -0,0 +1,6963 @@
+
+obj/user/testfile:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 8b 0a 00 00       	call   800aae <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <xopen>:
+const char *msg = "This is the NEW message of the day!\n\n";
+
+#define FVA ((struct Fd *)0xA000000)
+
+static int
+xopen(const char *path, int mode) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 54                	push   %r12
+  80002b:	53                   	push   %rbx
+  80002c:	48 83 ec 10          	sub    $0x10,%rsp
+  800030:	41 89 f4             	mov    %esi,%r12d
+    extern union Fsipc fsipcbuf;
+    envid_t fsenv;
+
+    strcpy(fsipcbuf.open.req_path, path);
+  800033:	48 89 fe             	mov    %rdi,%rsi
+  800036:	48 bb 00 70 80 00 00 	movabs $0x807000,%rbx
+  80003d:	00 00 00 
+  800040:	48 89 df             	mov    %rbx,%rdi
+  800043:	48 b8 ef 15 80 00 00 	movabs $0x8015ef,%rax
+  80004a:	00 00 00 
+  80004d:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  80004f:	44 89 a3 00 04 00 00 	mov    %r12d,0x400(%rbx)
+
+    fsenv = ipc_find_env(ENV_TYPE_FS);
+  800056:	bf 03 00 00 00       	mov    $0x3,%edi
+  80005b:	48 b8 52 21 80 00 00 	movabs $0x802152,%rax
+  800062:	00 00 00 
+  800065:	ff d0                	call   *%rax
+  800067:	89 c7                	mov    %eax,%edi
+    size_t sz = PAGE_SIZE;
+  800069:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  800070:	00 
+    ipc_send(fsenv, FSREQ_OPEN, &fsipcbuf, sz, PROT_RW);
+  800071:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  800077:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80007c:	48 89 da             	mov    %rbx,%rdx
+  80007f:	be 01 00 00 00       	mov    $0x1,%esi
+  800084:	48 b8 af 20 80 00 00 	movabs $0x8020af,%rax
+  80008b:	00 00 00 
+  80008e:	ff d0                	call   *%rax
+    return ipc_recv(NULL, FVA, &sz, NULL);
+  800090:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800095:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  800099:	be 00 00 00 0a       	mov    $0xa000000,%esi
+  80009e:	bf 00 00 00 00       	mov    $0x0,%edi
+  8000a3:	48 b8 da 1f 80 00 00 	movabs $0x801fda,%rax
+  8000aa:	00 00 00 
+  8000ad:	ff d0                	call   *%rax
+}
+  8000af:	48 83 c4 10          	add    $0x10,%rsp
+  8000b3:	5b                   	pop    %rbx
+  8000b4:	41 5c                	pop    %r12
+  8000b6:	5d                   	pop    %rbp
+  8000b7:	c3                   	ret
+
+00000000008000b8 <umain>:
+
+void
+umain(int argc, char **argv) {
+  8000b8:	55                   	push   %rbp
+  8000b9:	48 89 e5             	mov    %rsp,%rbp
+  8000bc:	41 55                	push   %r13
+  8000be:	41 54                	push   %r12
+  8000c0:	53                   	push   %rbx
+  8000c1:	48 81 ec a8 02 00 00 	sub    $0x2a8,%rsp
+    struct Fd fdcopy;
+    struct Stat st;
+    char buf[512];
+
+    /* We open files manually first, to avoid the FD layer */
+    if ((r = xopen("/not-found", O_RDONLY)) < 0 && r != -E_NOT_FOUND)
+  8000c8:	be 00 00 00 00       	mov    $0x0,%esi
+  8000cd:	48 bf f8 36 80 00 00 	movabs $0x8036f8,%rdi
+  8000d4:	00 00 00 
+  8000d7:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8000de:	00 00 00 
+  8000e1:	ff d0                	call   *%rax
+  8000e3:	48 63 c8             	movslq %eax,%rcx
+  8000e6:	48 85 c9             	test   %rcx,%rcx
+  8000e9:	0f 89 70 05 00 00    	jns    80065f <umain+0x5a7>
+  8000ef:	48 83 f9 f1          	cmp    $0xfffffffffffffff1,%rcx
+  8000f3:	0f 85 3b 05 00 00    	jne    800634 <umain+0x57c>
+        panic("serve_open /not-found: %ld", (long)r);
+    else if (r >= 0)
+        panic("serve_open /not-found succeeded!");
+
+    if ((r = xopen("/newmotd", O_RDONLY)) < 0)
+  8000f9:	be 00 00 00 00       	mov    $0x0,%esi
+  8000fe:	48 bf 2e 37 80 00 00 	movabs $0x80372e,%rdi
+  800105:	00 00 00 
+  800108:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  80010f:	00 00 00 
+  800112:	ff d0                	call   *%rax
+  800114:	48 63 c8             	movslq %eax,%rcx
+  800117:	48 85 c9             	test   %rcx,%rcx
+  80011a:	0f 88 69 05 00 00    	js     800689 <umain+0x5d1>
+        panic("serve_open /newmotd: %ld", (long)r);
+    if (FVA->fd_dev_id != 'f' || FVA->fd_offset != 0 || FVA->fd_omode != O_RDONLY)
+  800120:	83 3c 25 00 00 00 0a 	cmpl   $0x66,0xa000000
+  800127:	66 
+  800128:	0f 85 86 05 00 00    	jne    8006b4 <umain+0x5fc>
+  80012e:	83 3c 25 04 00 00 0a 	cmpl   $0x0,0xa000004
+  800135:	00 
+  800136:	0f 85 78 05 00 00    	jne    8006b4 <umain+0x5fc>
+  80013c:	83 3c 25 08 00 00 0a 	cmpl   $0x0,0xa000008
+  800143:	00 
+  800144:	0f 85 6a 05 00 00    	jne    8006b4 <umain+0x5fc>
+        panic("serve_open did not fill struct Fd correctly\n");
+    cprintf("serve_open is good\n");
+  80014a:	48 bf 50 37 80 00 00 	movabs $0x803750,%rdi
+  800151:	00 00 00 
+  800154:	b8 00 00 00 00       	mov    $0x0,%eax
+  800159:	48 ba ca 0c 80 00 00 	movabs $0x800cca,%rdx
+  800160:	00 00 00 
+  800163:	ff d2                	call   *%rdx
+
+    if ((r = devfile.dev_stat(FVA, &st)) < 0)
+  800165:	48 8d b5 40 ff ff ff 	lea    -0xc0(%rbp),%rsi
+  80016c:	bf 00 00 00 0a       	mov    $0xa000000,%edi
+  800171:	48 a1 48 50 80 00 00 	movabs 0x805048,%rax
+  800178:	00 00 00 
+  80017b:	ff d0                	call   *%rax
+  80017d:	48 63 c8             	movslq %eax,%rcx
+  800180:	48 85 c9             	test   %rcx,%rcx
+  800183:	0f 88 55 05 00 00    	js     8006de <umain+0x626>
+        panic("file_stat: %ld", (long)r);
+    if (strlen(msg) != st.st_size)
+  800189:	48 b8 00 50 80 00 00 	movabs $0x805000,%rax
+  800190:	00 00 00 
+  800193:	48 8b 38             	mov    (%rax),%rdi
+  800196:	48 b8 b1 15 80 00 00 	movabs $0x8015b1,%rax
+  80019d:	00 00 00 
+  8001a0:	ff d0                	call   *%rax
+  8001a2:	48 89 c2             	mov    %rax,%rdx
+  8001a5:	48 63 45 c0          	movslq -0x40(%rbp),%rax
+  8001a9:	48 39 c2             	cmp    %rax,%rdx
+  8001ac:	0f 85 57 05 00 00    	jne    800709 <umain+0x651>
+        panic("file_stat returned size %ld wanted %zd\n", (long)st.st_size, strlen(msg));
+    cprintf("file_stat is good\n");
+  8001b2:	48 bf 73 37 80 00 00 	movabs $0x803773,%rdi
+  8001b9:	00 00 00 
+  8001bc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001c1:	48 ba ca 0c 80 00 00 	movabs $0x800cca,%rdx
+  8001c8:	00 00 00 
+  8001cb:	ff d2                	call   *%rdx
+
+    memset(buf, 0, sizeof buf);
+  8001cd:	ba 00 02 00 00       	mov    $0x200,%edx
+  8001d2:	be 00 00 00 00       	mov    $0x0,%esi
+  8001d7:	48 8d bd 40 fd ff ff 	lea    -0x2c0(%rbp),%rdi
+  8001de:	48 b8 3b 17 80 00 00 	movabs $0x80173b,%rax
+  8001e5:	00 00 00 
+  8001e8:	ff d0                	call   *%rax
+    if ((r = devfile.dev_read(FVA, buf, sizeof buf)) < 0)
+  8001ea:	ba 00 02 00 00       	mov    $0x200,%edx
+  8001ef:	48 8d b5 40 fd ff ff 	lea    -0x2c0(%rbp),%rsi
+  8001f6:	bf 00 00 00 0a       	mov    $0xa000000,%edi
+  8001fb:	48 a1 30 50 80 00 00 	movabs 0x805030,%rax
+  800202:	00 00 00 
+  800205:	ff d0                	call   *%rax
+  800207:	48 85 c0             	test   %rax,%rax
+  80020a:	0f 88 44 05 00 00    	js     800754 <umain+0x69c>
+        panic("file_read: %ld", (long)r);
+    if (strcmp(buf, msg) != 0)
+  800210:	48 b8 00 50 80 00 00 	movabs $0x805000,%rax
+  800217:	00 00 00 
+  80021a:	48 8b 30             	mov    (%rax),%rsi
+  80021d:	48 8d bd 40 fd ff ff 	lea    -0x2c0(%rbp),%rdi
+  800224:	48 b8 93 16 80 00 00 	movabs $0x801693,%rax
+  80022b:	00 00 00 
+  80022e:	ff d0                	call   *%rax
+  800230:	85 c0                	test   %eax,%eax
+  800232:	0f 85 4a 05 00 00    	jne    800782 <umain+0x6ca>
+        panic("file_read returned wrong data");
+    cprintf("file_read is good\n");
+  800238:	48 bf b3 37 80 00 00 	movabs $0x8037b3,%rdi
+  80023f:	00 00 00 
+  800242:	b8 00 00 00 00       	mov    $0x0,%eax
+  800247:	48 ba ca 0c 80 00 00 	movabs $0x800cca,%rdx
+  80024e:	00 00 00 
+  800251:	ff d2                	call   *%rdx
+
+    if ((r = devfile.dev_close(FVA)) < 0)
+  800253:	bf 00 00 00 0a       	mov    $0xa000000,%edi
+  800258:	48 a1 40 50 80 00 00 	movabs 0x805040,%rax
+  80025f:	00 00 00 
+  800262:	ff d0                	call   *%rax
+  800264:	48 63 c8             	movslq %eax,%rcx
+  800267:	48 85 c9             	test   %rcx,%rcx
+  80026a:	0f 88 3c 05 00 00    	js     8007ac <umain+0x6f4>
+        panic("file_close: %ld", (long)r);
+    cprintf("file_close is good\n");
+  800270:	48 bf d6 37 80 00 00 	movabs $0x8037d6,%rdi
+  800277:	00 00 00 
+  80027a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80027f:	48 ba ca 0c 80 00 00 	movabs $0x800cca,%rdx
+  800286:	00 00 00 
+  800289:	ff d2                	call   *%rdx
+
+    /* We're about to unmap the FD, but still need a way to get
+     * the stale filenum to serve_read, so we make a local copy.
+     * The file server won't think it's stale until we unmap the
+     * FD page. */
+    fdcopy = *FVA;
+  80028b:	48 8b 04 25 00 00 00 	mov    0xa000000,%rax
+  800292:	0a 
+  800293:	48 8b 14 25 08 00 00 	mov    0xa000008,%rdx
+  80029a:	0a 
+  80029b:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  80029f:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+    sys_unmap_region(0, FVA, PAGE_SIZE);
+  8002a3:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8002a8:	be 00 00 00 0a       	mov    $0xa000000,%esi
+  8002ad:	bf 00 00 00 00       	mov    $0x0,%edi
+  8002b2:	48 b8 6b 1c 80 00 00 	movabs $0x801c6b,%rax
+  8002b9:	00 00 00 
+  8002bc:	ff d0                	call   *%rax
+
+    if ((r = devfile.dev_read(&fdcopy, buf, sizeof buf)) != -E_INVAL)
+  8002be:	ba 00 02 00 00       	mov    $0x200,%edx
+  8002c3:	48 8d b5 40 fd ff ff 	lea    -0x2c0(%rbp),%rsi
+  8002ca:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  8002ce:	48 a1 30 50 80 00 00 	movabs 0x805030,%rax
+  8002d5:	00 00 00 
+  8002d8:	ff d0                	call   *%rax
+  8002da:	48 83 f8 fd          	cmp    $0xfffffffffffffffd,%rax
+  8002de:	0f 85 f3 04 00 00    	jne    8007d7 <umain+0x71f>
+        panic("serve_read does not handle stale fileids correctly: %ld", (long)r);
+    cprintf("stale fileid is good\n");
+  8002e4:	48 bf ea 37 80 00 00 	movabs $0x8037ea,%rdi
+  8002eb:	00 00 00 
+  8002ee:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002f3:	48 ba ca 0c 80 00 00 	movabs $0x800cca,%rdx
+  8002fa:	00 00 00 
+  8002fd:	ff d2                	call   *%rdx
+
+    /* Try writing */
+    if ((r = xopen("/new-file", O_RDWR | O_CREAT)) < 0)
+  8002ff:	be 02 01 00 00       	mov    $0x102,%esi
+  800304:	48 bf 00 38 80 00 00 	movabs $0x803800,%rdi
+  80030b:	00 00 00 
+  80030e:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  800315:	00 00 00 
+  800318:	ff d0                	call   *%rax
+  80031a:	48 63 c8             	movslq %eax,%rcx
+  80031d:	48 85 c9             	test   %rcx,%rcx
+  800320:	0f 88 df 04 00 00    	js     800805 <umain+0x74d>
+        panic("serve_open /new-file: %ld", (long)r);
+
+    if ((r = devfile.dev_write(FVA, msg, strlen(msg))) != strlen(msg))
+  800326:	48 b8 38 50 80 00 00 	movabs $0x805038,%rax
+  80032d:	00 00 00 
+  800330:	48 8b 18             	mov    (%rax),%rbx
+  800333:	49 bc 00 50 80 00 00 	movabs $0x805000,%r12
+  80033a:	00 00 00 
+  80033d:	49 8b 3c 24          	mov    (%r12),%rdi
+  800341:	49 bd b1 15 80 00 00 	movabs $0x8015b1,%r13
+  800348:	00 00 00 
+  80034b:	41 ff d5             	call   *%r13
+  80034e:	48 89 c2             	mov    %rax,%rdx
+  800351:	49 8b 34 24          	mov    (%r12),%rsi
+  800355:	bf 00 00 00 0a       	mov    $0xa000000,%edi
+  80035a:	ff d3                	call   *%rbx
+  80035c:	48 89 c3             	mov    %rax,%rbx
+  80035f:	49 8b 3c 24          	mov    (%r12),%rdi
+  800363:	41 ff d5             	call   *%r13
+  800366:	48 39 c3             	cmp    %rax,%rbx
+  800369:	0f 85 c1 04 00 00    	jne    800830 <umain+0x778>
+        panic("file_write: %ld", (long)r);
+    cprintf("file_write is good\n");
+  80036f:	48 bf 34 38 80 00 00 	movabs $0x803834,%rdi
+  800376:	00 00 00 
+  800379:	b8 00 00 00 00       	mov    $0x0,%eax
+  80037e:	48 ba ca 0c 80 00 00 	movabs $0x800cca,%rdx
+  800385:	00 00 00 
+  800388:	ff d2                	call   *%rdx
+
+    FVA->fd_offset = 0;
+  80038a:	c7 04 25 04 00 00 0a 	movl   $0x0,0xa000004
+  800391:	00 00 00 00 
+    memset(buf, 0, sizeof buf);
+  800395:	ba 00 02 00 00       	mov    $0x200,%edx
+  80039a:	be 00 00 00 00       	mov    $0x0,%esi
+  80039f:	48 8d bd 40 fd ff ff 	lea    -0x2c0(%rbp),%rdi
+  8003a6:	48 b8 3b 17 80 00 00 	movabs $0x80173b,%rax
+  8003ad:	00 00 00 
+  8003b0:	ff d0                	call   *%rax
+    if ((r = devfile.dev_read(FVA, buf, sizeof buf)) < 0)
+  8003b2:	ba 00 02 00 00       	mov    $0x200,%edx
+  8003b7:	48 8d b5 40 fd ff ff 	lea    -0x2c0(%rbp),%rsi
+  8003be:	bf 00 00 00 0a       	mov    $0xa000000,%edi
+  8003c3:	48 a1 30 50 80 00 00 	movabs 0x805030,%rax
+  8003ca:	00 00 00 
+  8003cd:	ff d0                	call   *%rax
+  8003cf:	48 89 c3             	mov    %rax,%rbx
+  8003d2:	48 85 c0             	test   %rax,%rax
+  8003d5:	0f 88 83 04 00 00    	js     80085e <umain+0x7a6>
+        panic("file_read after file_write: %ld", (long)r);
+    if (r != strlen(msg))
+  8003db:	48 b8 00 50 80 00 00 	movabs $0x805000,%rax
+  8003e2:	00 00 00 
+  8003e5:	48 8b 38             	mov    (%rax),%rdi
+  8003e8:	48 b8 b1 15 80 00 00 	movabs $0x8015b1,%rax
+  8003ef:	00 00 00 
+  8003f2:	ff d0                	call   *%rax
+  8003f4:	48 39 d8             	cmp    %rbx,%rax
+  8003f7:	0f 85 8f 04 00 00    	jne    80088c <umain+0x7d4>
+        panic("file_read after file_write returned wrong length: %ld", (long)r);
+    if (strcmp(buf, msg) != 0)
+  8003fd:	48 b8 00 50 80 00 00 	movabs $0x805000,%rax
+  800404:	00 00 00 
+  800407:	48 8b 30             	mov    (%rax),%rsi
+  80040a:	48 8d bd 40 fd ff ff 	lea    -0x2c0(%rbp),%rdi
+  800411:	48 b8 93 16 80 00 00 	movabs $0x801693,%rax
+  800418:	00 00 00 
+  80041b:	ff d0                	call   *%rax
+  80041d:	85 c0                	test   %eax,%eax
+  80041f:	0f 85 95 04 00 00    	jne    8008ba <umain+0x802>
+        panic("file_read after file_write returned wrong data");
+    cprintf("file_read after file_write is good\n");
+  800425:	48 bf 08 3a 80 00 00 	movabs $0x803a08,%rdi
+  80042c:	00 00 00 
+  80042f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800434:	48 ba ca 0c 80 00 00 	movabs $0x800cca,%rdx
+  80043b:	00 00 00 
+  80043e:	ff d2                	call   *%rdx
+
+    /* Now we'll try out open */
+    if ((r = open("/not-found", O_RDONLY)) < 0 && r != -E_NOT_FOUND)
+  800440:	be 00 00 00 00       	mov    $0x0,%esi
+  800445:	48 bf f8 36 80 00 00 	movabs $0x8036f8,%rdi
+  80044c:	00 00 00 
+  80044f:	48 b8 66 2c 80 00 00 	movabs $0x802c66,%rax
+  800456:	00 00 00 
+  800459:	ff d0                	call   *%rax
+  80045b:	48 63 c8             	movslq %eax,%rcx
+  80045e:	48 85 c9             	test   %rcx,%rcx
+  800461:	0f 89 a8 04 00 00    	jns    80090f <umain+0x857>
+  800467:	48 83 f9 f1          	cmp    $0xfffffffffffffff1,%rcx
+  80046b:	0f 85 73 04 00 00    	jne    8008e4 <umain+0x82c>
+        panic("open /not-found: %ld", (long)r);
+    else if (r >= 0)
+        panic("open /not-found succeeded!");
+
+    if ((r = open("/newmotd", O_RDONLY)) < 0)
+  800471:	be 00 00 00 00       	mov    $0x0,%esi
+  800476:	48 bf 2e 37 80 00 00 	movabs $0x80372e,%rdi
+  80047d:	00 00 00 
+  800480:	48 b8 66 2c 80 00 00 	movabs $0x802c66,%rax
+  800487:	00 00 00 
+  80048a:	ff d0                	call   *%rax
+  80048c:	48 98                	cltq
+  80048e:	48 85 c0             	test   %rax,%rax
+  800491:	0f 88 a2 04 00 00    	js     800939 <umain+0x881>
+        panic("open /newmotd: %ld", (long)r);
+    fd = (struct Fd *)(0xD0000000 + r * PAGE_SIZE);
+  800497:	48 05 00 00 0d 00    	add    $0xd0000,%rax
+  80049d:	48 c1 e0 0c          	shl    $0xc,%rax
+    if (fd->fd_dev_id != 'f' || fd->fd_offset != 0 || fd->fd_omode != O_RDONLY)
+  8004a1:	83 38 66             	cmpl   $0x66,(%rax)
+  8004a4:	0f 85 bd 04 00 00    	jne    800967 <umain+0x8af>
+  8004aa:	83 78 04 00          	cmpl   $0x0,0x4(%rax)
+  8004ae:	0f 85 b3 04 00 00    	jne    800967 <umain+0x8af>
+  8004b4:	83 78 08 00          	cmpl   $0x0,0x8(%rax)
+  8004b8:	0f 85 a9 04 00 00    	jne    800967 <umain+0x8af>
+        panic("open did not fill struct Fd correctly\n");
+    cprintf("open is good\n");
+  8004be:	48 bf 56 37 80 00 00 	movabs $0x803756,%rdi
+  8004c5:	00 00 00 
+  8004c8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004cd:	48 ba ca 0c 80 00 00 	movabs $0x800cca,%rdx
+  8004d4:	00 00 00 
+  8004d7:	ff d2                	call   *%rdx
+
+    /* Try files with indirect blocks */
+    if ((f = open("/big", O_WRONLY | O_CREAT)) < 0)
+  8004d9:	be 01 01 00 00       	mov    $0x101,%esi
+  8004de:	48 bf 63 38 80 00 00 	movabs $0x803863,%rdi
+  8004e5:	00 00 00 
+  8004e8:	48 b8 66 2c 80 00 00 	movabs $0x802c66,%rax
+  8004ef:	00 00 00 
+  8004f2:	ff d0                	call   *%rax
+  8004f4:	41 89 c4             	mov    %eax,%r12d
+  8004f7:	48 63 c8             	movslq %eax,%rcx
+  8004fa:	48 85 c9             	test   %rcx,%rcx
+  8004fd:	0f 88 8e 04 00 00    	js     800991 <umain+0x8d9>
+        panic("creat /big: %ld", (long)f);
+    memset(buf, 0, sizeof(buf));
+  800503:	ba 00 02 00 00       	mov    $0x200,%edx
+  800508:	be 00 00 00 00       	mov    $0x0,%esi
+  80050d:	48 8d bd 40 fd ff ff 	lea    -0x2c0(%rbp),%rdi
+  800514:	48 b8 3b 17 80 00 00 	movabs $0x80173b,%rax
+  80051b:	00 00 00 
+  80051e:	ff d0                	call   *%rax
+    for (int64_t i = 0; i < (NDIRECT * 3) * BLKSIZE; i += sizeof(buf)) {
+  800520:	bb 00 00 00 00       	mov    $0x0,%ebx
+        *(int *)buf = i;
+        if ((r = write(f, buf, sizeof(buf))) < 0)
+  800525:	49 bd 75 26 80 00 00 	movabs $0x802675,%r13
+  80052c:	00 00 00 
+        *(int *)buf = i;
+  80052f:	89 9d 40 fd ff ff    	mov    %ebx,-0x2c0(%rbp)
+        if ((r = write(f, buf, sizeof(buf))) < 0)
+  800535:	ba 00 02 00 00       	mov    $0x200,%edx
+  80053a:	48 8d b5 40 fd ff ff 	lea    -0x2c0(%rbp),%rsi
+  800541:	44 89 e7             	mov    %r12d,%edi
+  800544:	41 ff d5             	call   *%r13
+  800547:	48 85 c0             	test   %rax,%rax
+  80054a:	0f 88 6c 04 00 00    	js     8009bc <umain+0x904>
+    for (int64_t i = 0; i < (NDIRECT * 3) * BLKSIZE; i += sizeof(buf)) {
+  800550:	48 8d 83 00 02 00 00 	lea    0x200(%rbx),%rax
+  800557:	48 89 c3             	mov    %rax,%rbx
+  80055a:	48 3d 00 e0 01 00    	cmp    $0x1e000,%rax
+  800560:	75 cd                	jne    80052f <umain+0x477>
+            panic("write /big@%ld: %ld", (long)i, (long)r);
+    }
+    close(f);
+  800562:	44 89 e7             	mov    %r12d,%edi
+  800565:	48 b8 c8 23 80 00 00 	movabs $0x8023c8,%rax
+  80056c:	00 00 00 
+  80056f:	ff d0                	call   *%rax
+
+    if ((f = open("/big", O_RDONLY)) < 0)
+  800571:	be 00 00 00 00       	mov    $0x0,%esi
+  800576:	48 bf 63 38 80 00 00 	movabs $0x803863,%rdi
+  80057d:	00 00 00 
+  800580:	48 b8 66 2c 80 00 00 	movabs $0x802c66,%rax
+  800587:	00 00 00 
+  80058a:	ff d0                	call   *%rax
+  80058c:	41 89 c4             	mov    %eax,%r12d
+  80058f:	48 63 c8             	movslq %eax,%rcx
+  800592:	48 85 c9             	test   %rcx,%rcx
+  800595:	0f 88 52 04 00 00    	js     8009ed <umain+0x935>
+        panic("open /big: %ld", (long)f);
+    for (int64_t i = 0; i < (NDIRECT * 3) * BLKSIZE; i += sizeof(buf)) {
+  80059b:	bb 00 00 00 00       	mov    $0x0,%ebx
+        *(int *)buf = i;
+        if ((r = readn(f, buf, sizeof(buf))) < 0)
+  8005a0:	49 bd 04 26 80 00 00 	movabs $0x802604,%r13
+  8005a7:	00 00 00 
+        *(int *)buf = i;
+  8005aa:	89 9d 40 fd ff ff    	mov    %ebx,-0x2c0(%rbp)
+        if ((r = readn(f, buf, sizeof(buf))) < 0)
+  8005b0:	ba 00 02 00 00       	mov    $0x200,%edx
+  8005b5:	48 8d b5 40 fd ff ff 	lea    -0x2c0(%rbp),%rsi
+  8005bc:	44 89 e7             	mov    %r12d,%edi
+  8005bf:	41 ff d5             	call   *%r13
+  8005c2:	48 85 c0             	test   %rax,%rax
+  8005c5:	0f 88 4d 04 00 00    	js     800a18 <umain+0x960>
+            panic("read /big@%ld: %ld", (long)i, (long)r);
+        if (r != sizeof(buf))
+  8005cb:	48 3d 00 02 00 00    	cmp    $0x200,%rax
+  8005d1:	0f 85 72 04 00 00    	jne    800a49 <umain+0x991>
+            panic("read /big from %ld returned %ld < %d bytes",
+                  (long)i, (long)r, (uint32_t)sizeof(buf));
+        if (*(int *)buf != i)
+  8005d7:	44 8b 85 40 fd ff ff 	mov    -0x2c0(%rbp),%r8d
+  8005de:	49 63 c0             	movslq %r8d,%rax
+  8005e1:	48 39 d8             	cmp    %rbx,%rax
+  8005e4:	0f 85 96 04 00 00    	jne    800a80 <umain+0x9c8>
+    for (int64_t i = 0; i < (NDIRECT * 3) * BLKSIZE; i += sizeof(buf)) {
+  8005ea:	48 8d 83 00 02 00 00 	lea    0x200(%rbx),%rax
+  8005f1:	48 89 c3             	mov    %rax,%rbx
+  8005f4:	48 3d 00 e0 01 00    	cmp    $0x1e000,%rax
+  8005fa:	75 ae                	jne    8005aa <umain+0x4f2>
+            panic("read /big from %ld returned bad data %d",
+                  (long)i, *(int *)buf);
+    }
+    close(f);
+  8005fc:	44 89 e7             	mov    %r12d,%edi
+  8005ff:	48 b8 c8 23 80 00 00 	movabs $0x8023c8,%rax
+  800606:	00 00 00 
+  800609:	ff d0                	call   *%rax
+    cprintf("large file is good\n");
+  80060b:	48 bf ae 38 80 00 00 	movabs $0x8038ae,%rdi
+  800612:	00 00 00 
+  800615:	b8 00 00 00 00       	mov    $0x0,%eax
+  80061a:	48 ba ca 0c 80 00 00 	movabs $0x800cca,%rdx
+  800621:	00 00 00 
+  800624:	ff d2                	call   *%rdx
+}
+  800626:	48 81 c4 a8 02 00 00 	add    $0x2a8,%rsp
+  80062d:	5b                   	pop    %rbx
+  80062e:	41 5c                	pop    %r12
+  800630:	41 5d                	pop    %r13
+  800632:	5d                   	pop    %rbp
+  800633:	c3                   	ret
+        panic("serve_open /not-found: %ld", (long)r);
+  800634:	48 ba 03 37 80 00 00 	movabs $0x803703,%rdx
+  80063b:	00 00 00 
+  80063e:	be 1f 00 00 00       	mov    $0x1f,%esi
+  800643:	48 bf 1e 37 80 00 00 	movabs $0x80371e,%rdi
+  80064a:	00 00 00 
+  80064d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800652:	49 b8 7a 0b 80 00 00 	movabs $0x800b7a,%r8
+  800659:	00 00 00 
+  80065c:	41 ff d0             	call   *%r8
+        panic("serve_open /not-found succeeded!");
+  80065f:	48 ba c8 38 80 00 00 	movabs $0x8038c8,%rdx
+  800666:	00 00 00 
+  800669:	be 21 00 00 00       	mov    $0x21,%esi
+  80066e:	48 bf 1e 37 80 00 00 	movabs $0x80371e,%rdi
+  800675:	00 00 00 
+  800678:	b8 00 00 00 00       	mov    $0x0,%eax
+  80067d:	48 b9 7a 0b 80 00 00 	movabs $0x800b7a,%rcx
+  800684:	00 00 00 
+  800687:	ff d1                	call   *%rcx
+        panic("serve_open /newmotd: %ld", (long)r);
+  800689:	48 ba 37 37 80 00 00 	movabs $0x803737,%rdx
+  800690:	00 00 00 
+  800693:	be 24 00 00 00       	mov    $0x24,%esi
+  800698:	48 bf 1e 37 80 00 00 	movabs $0x80371e,%rdi
+  80069f:	00 00 00 
+  8006a2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006a7:	49 b8 7a 0b 80 00 00 	movabs $0x800b7a,%r8
+  8006ae:	00 00 00 
+  8006b1:	41 ff d0             	call   *%r8
+        panic("serve_open did not fill struct Fd correctly\n");
+  8006b4:	48 ba f0 38 80 00 00 	movabs $0x8038f0,%rdx
+  8006bb:	00 00 00 
+  8006be:	be 26 00 00 00       	mov    $0x26,%esi
+  8006c3:	48 bf 1e 37 80 00 00 	movabs $0x80371e,%rdi
+  8006ca:	00 00 00 
+  8006cd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006d2:	48 b9 7a 0b 80 00 00 	movabs $0x800b7a,%rcx
+  8006d9:	00 00 00 
+  8006dc:	ff d1                	call   *%rcx
+        panic("file_stat: %ld", (long)r);
+  8006de:	48 ba 64 37 80 00 00 	movabs $0x803764,%rdx
+  8006e5:	00 00 00 
+  8006e8:	be 2a 00 00 00       	mov    $0x2a,%esi
+  8006ed:	48 bf 1e 37 80 00 00 	movabs $0x80371e,%rdi
+  8006f4:	00 00 00 
+  8006f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006fc:	49 b8 7a 0b 80 00 00 	movabs $0x800b7a,%r8
+  800703:	00 00 00 
+  800706:	41 ff d0             	call   *%r8
+        panic("file_stat returned size %ld wanted %zd\n", (long)st.st_size, strlen(msg));
+  800709:	48 b8 00 50 80 00 00 	movabs $0x805000,%rax
+  800710:	00 00 00 
+  800713:	48 8b 38             	mov    (%rax),%rdi
+  800716:	48 b8 b1 15 80 00 00 	movabs $0x8015b1,%rax
+  80071d:	00 00 00 
+  800720:	ff d0                	call   *%rax
+  800722:	49 89 c0             	mov    %rax,%r8
+  800725:	48 63 4d c0          	movslq -0x40(%rbp),%rcx
+  800729:	48 ba 20 39 80 00 00 	movabs $0x803920,%rdx
+  800730:	00 00 00 
+  800733:	be 2c 00 00 00       	mov    $0x2c,%esi
+  800738:	48 bf 1e 37 80 00 00 	movabs $0x80371e,%rdi
+  80073f:	00 00 00 
+  800742:	b8 00 00 00 00       	mov    $0x0,%eax
+  800747:	49 b9 7a 0b 80 00 00 	movabs $0x800b7a,%r9
+  80074e:	00 00 00 
+  800751:	41 ff d1             	call   *%r9
+        panic("file_read: %ld", (long)r);
+  800754:	48 89 c1             	mov    %rax,%rcx
+  800757:	48 ba 86 37 80 00 00 	movabs $0x803786,%rdx
+  80075e:	00 00 00 
+  800761:	be 31 00 00 00       	mov    $0x31,%esi
+  800766:	48 bf 1e 37 80 00 00 	movabs $0x80371e,%rdi
+  80076d:	00 00 00 
+  800770:	b8 00 00 00 00       	mov    $0x0,%eax
+  800775:	49 b8 7a 0b 80 00 00 	movabs $0x800b7a,%r8
+  80077c:	00 00 00 
+  80077f:	41 ff d0             	call   *%r8
+        panic("file_read returned wrong data");
+  800782:	48 ba 95 37 80 00 00 	movabs $0x803795,%rdx
+  800789:	00 00 00 
+  80078c:	be 33 00 00 00       	mov    $0x33,%esi
+  800791:	48 bf 1e 37 80 00 00 	movabs $0x80371e,%rdi
+  800798:	00 00 00 
+  80079b:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007a0:	48 b9 7a 0b 80 00 00 	movabs $0x800b7a,%rcx
+  8007a7:	00 00 00 
+  8007aa:	ff d1                	call   *%rcx
+        panic("file_close: %ld", (long)r);
+  8007ac:	48 ba c6 37 80 00 00 	movabs $0x8037c6,%rdx
+  8007b3:	00 00 00 
+  8007b6:	be 37 00 00 00       	mov    $0x37,%esi
+  8007bb:	48 bf 1e 37 80 00 00 	movabs $0x80371e,%rdi
+  8007c2:	00 00 00 
+  8007c5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007ca:	49 b8 7a 0b 80 00 00 	movabs $0x800b7a,%r8
+  8007d1:	00 00 00 
+  8007d4:	41 ff d0             	call   *%r8
+        panic("serve_read does not handle stale fileids correctly: %ld", (long)r);
+  8007d7:	48 89 c1             	mov    %rax,%rcx
+  8007da:	48 ba 48 39 80 00 00 	movabs $0x803948,%rdx
+  8007e1:	00 00 00 
+  8007e4:	be 42 00 00 00       	mov    $0x42,%esi
+  8007e9:	48 bf 1e 37 80 00 00 	movabs $0x80371e,%rdi
+  8007f0:	00 00 00 
+  8007f3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007f8:	49 b8 7a 0b 80 00 00 	movabs $0x800b7a,%r8
+  8007ff:	00 00 00 
+  800802:	41 ff d0             	call   *%r8
+        panic("serve_open /new-file: %ld", (long)r);
+  800805:	48 ba 0a 38 80 00 00 	movabs $0x80380a,%rdx
+  80080c:	00 00 00 
+  80080f:	be 47 00 00 00       	mov    $0x47,%esi
+  800814:	48 bf 1e 37 80 00 00 	movabs $0x80371e,%rdi
+  80081b:	00 00 00 
+  80081e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800823:	49 b8 7a 0b 80 00 00 	movabs $0x800b7a,%r8
+  80082a:	00 00 00 
+  80082d:	41 ff d0             	call   *%r8
+        panic("file_write: %ld", (long)r);
+  800830:	48 89 d9             	mov    %rbx,%rcx
+  800833:	48 ba 24 38 80 00 00 	movabs $0x803824,%rdx
+  80083a:	00 00 00 
+  80083d:	be 4a 00 00 00       	mov    $0x4a,%esi
+  800842:	48 bf 1e 37 80 00 00 	movabs $0x80371e,%rdi
+  800849:	00 00 00 
+  80084c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800851:	49 b8 7a 0b 80 00 00 	movabs $0x800b7a,%r8
+  800858:	00 00 00 
+  80085b:	41 ff d0             	call   *%r8
+        panic("file_read after file_write: %ld", (long)r);
+  80085e:	48 89 c1             	mov    %rax,%rcx
+  800861:	48 ba 80 39 80 00 00 	movabs $0x803980,%rdx
+  800868:	00 00 00 
+  80086b:	be 50 00 00 00       	mov    $0x50,%esi
+  800870:	48 bf 1e 37 80 00 00 	movabs $0x80371e,%rdi
+  800877:	00 00 00 
+  80087a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80087f:	49 b8 7a 0b 80 00 00 	movabs $0x800b7a,%r8
+  800886:	00 00 00 
+  800889:	41 ff d0             	call   *%r8
+        panic("file_read after file_write returned wrong length: %ld", (long)r);
+  80088c:	48 89 d9             	mov    %rbx,%rcx
+  80088f:	48 ba a0 39 80 00 00 	movabs $0x8039a0,%rdx
+  800896:	00 00 00 
+  800899:	be 52 00 00 00       	mov    $0x52,%esi
+  80089e:	48 bf 1e 37 80 00 00 	movabs $0x80371e,%rdi
+  8008a5:	00 00 00 
+  8008a8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008ad:	49 b8 7a 0b 80 00 00 	movabs $0x800b7a,%r8
+  8008b4:	00 00 00 
+  8008b7:	41 ff d0             	call   *%r8
+        panic("file_read after file_write returned wrong data");
+  8008ba:	48 ba d8 39 80 00 00 	movabs $0x8039d8,%rdx
+  8008c1:	00 00 00 
+  8008c4:	be 54 00 00 00       	mov    $0x54,%esi
+  8008c9:	48 bf 1e 37 80 00 00 	movabs $0x80371e,%rdi
+  8008d0:	00 00 00 
+  8008d3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008d8:	48 b9 7a 0b 80 00 00 	movabs $0x800b7a,%rcx
+  8008df:	00 00 00 
+  8008e2:	ff d1                	call   *%rcx
+        panic("open /not-found: %ld", (long)r);
+  8008e4:	48 ba 09 37 80 00 00 	movabs $0x803709,%rdx
+  8008eb:	00 00 00 
+  8008ee:	be 59 00 00 00       	mov    $0x59,%esi
+  8008f3:	48 bf 1e 37 80 00 00 	movabs $0x80371e,%rdi
+  8008fa:	00 00 00 
+  8008fd:	b8 00 00 00 00       	mov    $0x0,%eax
+  800902:	49 b8 7a 0b 80 00 00 	movabs $0x800b7a,%r8
+  800909:	00 00 00 
+  80090c:	41 ff d0             	call   *%r8
+        panic("open /not-found succeeded!");
+  80090f:	48 ba 48 38 80 00 00 	movabs $0x803848,%rdx
+  800916:	00 00 00 
+  800919:	be 5b 00 00 00       	mov    $0x5b,%esi
+  80091e:	48 bf 1e 37 80 00 00 	movabs $0x80371e,%rdi
+  800925:	00 00 00 
+  800928:	b8 00 00 00 00       	mov    $0x0,%eax
+  80092d:	48 b9 7a 0b 80 00 00 	movabs $0x800b7a,%rcx
+  800934:	00 00 00 
+  800937:	ff d1                	call   *%rcx
+        panic("open /newmotd: %ld", (long)r);
+  800939:	48 89 c1             	mov    %rax,%rcx
+  80093c:	48 ba 3d 37 80 00 00 	movabs $0x80373d,%rdx
+  800943:	00 00 00 
+  800946:	be 5e 00 00 00       	mov    $0x5e,%esi
+  80094b:	48 bf 1e 37 80 00 00 	movabs $0x80371e,%rdi
+  800952:	00 00 00 
+  800955:	b8 00 00 00 00       	mov    $0x0,%eax
+  80095a:	49 b8 7a 0b 80 00 00 	movabs $0x800b7a,%r8
+  800961:	00 00 00 
+  800964:	41 ff d0             	call   *%r8
+        panic("open did not fill struct Fd correctly\n");
+  800967:	48 ba 30 3a 80 00 00 	movabs $0x803a30,%rdx
+  80096e:	00 00 00 
+  800971:	be 61 00 00 00       	mov    $0x61,%esi
+  800976:	48 bf 1e 37 80 00 00 	movabs $0x80371e,%rdi
+  80097d:	00 00 00 
+  800980:	b8 00 00 00 00       	mov    $0x0,%eax
+  800985:	48 b9 7a 0b 80 00 00 	movabs $0x800b7a,%rcx
+  80098c:	00 00 00 
+  80098f:	ff d1                	call   *%rcx
+        panic("creat /big: %ld", (long)f);
+  800991:	48 ba 68 38 80 00 00 	movabs $0x803868,%rdx
+  800998:	00 00 00 
+  80099b:	be 66 00 00 00       	mov    $0x66,%esi
+  8009a0:	48 bf 1e 37 80 00 00 	movabs $0x80371e,%rdi
+  8009a7:	00 00 00 
+  8009aa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009af:	49 b8 7a 0b 80 00 00 	movabs $0x800b7a,%r8
+  8009b6:	00 00 00 
+  8009b9:	41 ff d0             	call   *%r8
+            panic("write /big@%ld: %ld", (long)i, (long)r);
+  8009bc:	49 89 c0             	mov    %rax,%r8
+  8009bf:	48 89 d9             	mov    %rbx,%rcx
+  8009c2:	48 ba 78 38 80 00 00 	movabs $0x803878,%rdx
+  8009c9:	00 00 00 
+  8009cc:	be 6b 00 00 00       	mov    $0x6b,%esi
+  8009d1:	48 bf 1e 37 80 00 00 	movabs $0x80371e,%rdi
+  8009d8:	00 00 00 
+  8009db:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009e0:	49 b9 7a 0b 80 00 00 	movabs $0x800b7a,%r9
+  8009e7:	00 00 00 
+  8009ea:	41 ff d1             	call   *%r9
+        panic("open /big: %ld", (long)f);
+  8009ed:	48 ba 8c 38 80 00 00 	movabs $0x80388c,%rdx
+  8009f4:	00 00 00 
+  8009f7:	be 70 00 00 00       	mov    $0x70,%esi
+  8009fc:	48 bf 1e 37 80 00 00 	movabs $0x80371e,%rdi
+  800a03:	00 00 00 
+  800a06:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a0b:	49 b8 7a 0b 80 00 00 	movabs $0x800b7a,%r8
+  800a12:	00 00 00 
+  800a15:	41 ff d0             	call   *%r8
+            panic("read /big@%ld: %ld", (long)i, (long)r);
+  800a18:	49 89 c0             	mov    %rax,%r8
+  800a1b:	48 89 d9             	mov    %rbx,%rcx
+  800a1e:	48 ba 9b 38 80 00 00 	movabs $0x80389b,%rdx
+  800a25:	00 00 00 
+  800a28:	be 74 00 00 00       	mov    $0x74,%esi
+  800a2d:	48 bf 1e 37 80 00 00 	movabs $0x80371e,%rdi
+  800a34:	00 00 00 
+  800a37:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a3c:	49 b9 7a 0b 80 00 00 	movabs $0x800b7a,%r9
+  800a43:	00 00 00 
+  800a46:	41 ff d1             	call   *%r9
+            panic("read /big from %ld returned %ld < %d bytes",
+  800a49:	41 b9 00 02 00 00    	mov    $0x200,%r9d
+  800a4f:	49 89 c0             	mov    %rax,%r8
+  800a52:	48 89 d9             	mov    %rbx,%rcx
+  800a55:	48 ba 58 3a 80 00 00 	movabs $0x803a58,%rdx
+  800a5c:	00 00 00 
+  800a5f:	be 76 00 00 00       	mov    $0x76,%esi
+  800a64:	48 bf 1e 37 80 00 00 	movabs $0x80371e,%rdi
+  800a6b:	00 00 00 
+  800a6e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a73:	49 ba 7a 0b 80 00 00 	movabs $0x800b7a,%r10
+  800a7a:	00 00 00 
+  800a7d:	41 ff d2             	call   *%r10
+            panic("read /big from %ld returned bad data %d",
+  800a80:	48 89 d9             	mov    %rbx,%rcx
+  800a83:	48 ba 88 3a 80 00 00 	movabs $0x803a88,%rdx
+  800a8a:	00 00 00 
+  800a8d:	be 79 00 00 00       	mov    $0x79,%esi
+  800a92:	48 bf 1e 37 80 00 00 	movabs $0x80371e,%rdi
+  800a99:	00 00 00 
+  800a9c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800aa1:	49 b9 7a 0b 80 00 00 	movabs $0x800b7a,%r9
+  800aa8:	00 00 00 
+  800aab:	41 ff d1             	call   *%r9
+
+0000000000800aae <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800aae:	55                   	push   %rbp
+  800aaf:	48 89 e5             	mov    %rsp,%rbp
+  800ab2:	41 56                	push   %r14
+  800ab4:	41 55                	push   %r13
+  800ab6:	41 54                	push   %r12
+  800ab8:	53                   	push   %rbx
+  800ab9:	41 89 fd             	mov    %edi,%r13d
+  800abc:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800abf:	48 ba d8 50 80 00 00 	movabs $0x8050d8,%rdx
+  800ac6:	00 00 00 
+  800ac9:	48 b8 d8 50 80 00 00 	movabs $0x8050d8,%rax
+  800ad0:	00 00 00 
+  800ad3:	48 39 c2             	cmp    %rax,%rdx
+  800ad6:	73 17                	jae    800aef <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  800ad8:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  800adb:	49 89 c4             	mov    %rax,%r12
+  800ade:	48 83 c3 08          	add    $0x8,%rbx
+  800ae2:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ae7:	ff 53 f8             	call   *-0x8(%rbx)
+  800aea:	4c 39 e3             	cmp    %r12,%rbx
+  800aed:	72 ef                	jb     800ade <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+    envid_t this_env_id = sys_getenvid();
+  800aef:	48 b8 df 1a 80 00 00 	movabs $0x801adf,%rax
+  800af6:	00 00 00 
+  800af9:	ff d0                	call   *%rax
+    thisenv = &((struct Env*)UENVS)[ENVX(this_env_id)];
+  800afb:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800b00:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+  800b07:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  800b0e:	00 00 00 
+  800b11:	48 01 d0             	add    %rdx,%rax
+  800b14:	48 a3 00 60 80 00 00 	movabs %rax,0x806000
+  800b1b:	00 00 00 
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  800b1e:	45 85 ed             	test   %r13d,%r13d
+  800b21:	7e 0d                	jle    800b30 <libmain+0x82>
+  800b23:	49 8b 06             	mov    (%r14),%rax
+  800b26:	48 a3 08 50 80 00 00 	movabs %rax,0x805008
+  800b2d:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  800b30:	4c 89 f6             	mov    %r14,%rsi
+  800b33:	44 89 ef             	mov    %r13d,%edi
+  800b36:	48 b8 b8 00 80 00 00 	movabs $0x8000b8,%rax
+  800b3d:	00 00 00 
+  800b40:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  800b42:	48 b8 57 0b 80 00 00 	movabs $0x800b57,%rax
+  800b49:	00 00 00 
+  800b4c:	ff d0                	call   *%rax
+#endif
+}
+  800b4e:	5b                   	pop    %rbx
+  800b4f:	41 5c                	pop    %r12
+  800b51:	41 5d                	pop    %r13
+  800b53:	41 5e                	pop    %r14
+  800b55:	5d                   	pop    %rbp
+  800b56:	c3                   	ret
+
+0000000000800b57 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  800b57:	55                   	push   %rbp
+  800b58:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  800b5b:	48 b8 fb 23 80 00 00 	movabs $0x8023fb,%rax
+  800b62:	00 00 00 
+  800b65:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  800b67:	bf 00 00 00 00       	mov    $0x0,%edi
+  800b6c:	48 b8 74 1a 80 00 00 	movabs $0x801a74,%rax
+  800b73:	00 00 00 
+  800b76:	ff d0                	call   *%rax
+}
+  800b78:	5d                   	pop    %rbp
+  800b79:	c3                   	ret
+
+0000000000800b7a <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  800b7a:	55                   	push   %rbp
+  800b7b:	48 89 e5             	mov    %rsp,%rbp
+  800b7e:	41 56                	push   %r14
+  800b80:	41 55                	push   %r13
+  800b82:	41 54                	push   %r12
+  800b84:	53                   	push   %rbx
+  800b85:	48 83 ec 50          	sub    $0x50,%rsp
+  800b89:	49 89 fc             	mov    %rdi,%r12
+  800b8c:	41 89 f5             	mov    %esi,%r13d
+  800b8f:	48 89 d3             	mov    %rdx,%rbx
+  800b92:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  800b96:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  800b9a:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800b9e:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  800ba5:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800ba9:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  800bad:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  800bb1:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  800bb5:	48 b8 08 50 80 00 00 	movabs $0x805008,%rax
+  800bbc:	00 00 00 
+  800bbf:	4c 8b 30             	mov    (%rax),%r14
+  800bc2:	48 b8 df 1a 80 00 00 	movabs $0x801adf,%rax
+  800bc9:	00 00 00 
+  800bcc:	ff d0                	call   *%rax
+  800bce:	89 c6                	mov    %eax,%esi
+  800bd0:	45 89 e8             	mov    %r13d,%r8d
+  800bd3:	4c 89 e1             	mov    %r12,%rcx
+  800bd6:	4c 89 f2             	mov    %r14,%rdx
+  800bd9:	48 bf e0 3a 80 00 00 	movabs $0x803ae0,%rdi
+  800be0:	00 00 00 
+  800be3:	b8 00 00 00 00       	mov    $0x0,%eax
+  800be8:	49 bc ca 0c 80 00 00 	movabs $0x800cca,%r12
+  800bef:	00 00 00 
+  800bf2:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  800bf5:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  800bf9:	48 89 df             	mov    %rbx,%rdi
+  800bfc:	48 b8 66 0c 80 00 00 	movabs $0x800c66,%rax
+  800c03:	00 00 00 
+  800c06:	ff d0                	call   *%rax
+    cprintf("\n");
+  800c08:	48 bf c4 37 80 00 00 	movabs $0x8037c4,%rdi
+  800c0f:	00 00 00 
+  800c12:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c17:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  800c1a:	cc                   	int3
+  800c1b:	eb fd                	jmp    800c1a <_panic+0xa0>
+
+0000000000800c1d <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  800c1d:	55                   	push   %rbp
+  800c1e:	48 89 e5             	mov    %rsp,%rbp
+  800c21:	53                   	push   %rbx
+  800c22:	48 83 ec 08          	sub    $0x8,%rsp
+  800c26:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  800c29:	8b 06                	mov    (%rsi),%eax
+  800c2b:	8d 50 01             	lea    0x1(%rax),%edx
+  800c2e:	89 16                	mov    %edx,(%rsi)
+  800c30:	48 98                	cltq
+  800c32:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  800c37:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  800c3d:	74 0a                	je     800c49 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  800c3f:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  800c43:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800c47:	c9                   	leave
+  800c48:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  800c49:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  800c4d:	be ff 00 00 00       	mov    $0xff,%esi
+  800c52:	48 b8 16 1a 80 00 00 	movabs $0x801a16,%rax
+  800c59:	00 00 00 
+  800c5c:	ff d0                	call   *%rax
+        state->offset = 0;
+  800c5e:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  800c64:	eb d9                	jmp    800c3f <putch+0x22>
+
+0000000000800c66 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  800c66:	55                   	push   %rbp
+  800c67:	48 89 e5             	mov    %rsp,%rbp
+  800c6a:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  800c71:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  800c74:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  800c7b:	b9 21 00 00 00       	mov    $0x21,%ecx
+  800c80:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c85:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  800c88:	48 89 f1             	mov    %rsi,%rcx
+  800c8b:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  800c92:	48 bf 1d 0c 80 00 00 	movabs $0x800c1d,%rdi
+  800c99:	00 00 00 
+  800c9c:	48 b8 1a 0e 80 00 00 	movabs $0x800e1a,%rax
+  800ca3:	00 00 00 
+  800ca6:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  800ca8:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  800caf:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  800cb6:	48 b8 16 1a 80 00 00 	movabs $0x801a16,%rax
+  800cbd:	00 00 00 
+  800cc0:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  800cc2:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  800cc8:	c9                   	leave
+  800cc9:	c3                   	ret
+
+0000000000800cca <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  800cca:	55                   	push   %rbp
+  800ccb:	48 89 e5             	mov    %rsp,%rbp
+  800cce:	48 83 ec 50          	sub    $0x50,%rsp
+  800cd2:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  800cd6:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  800cda:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800cde:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800ce2:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  800ce6:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  800ced:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800cf1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800cf5:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800cf9:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  800cfd:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  800d01:	48 b8 66 0c 80 00 00 	movabs $0x800c66,%rax
+  800d08:	00 00 00 
+  800d0b:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  800d0d:	c9                   	leave
+  800d0e:	c3                   	ret
+
+0000000000800d0f <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  800d0f:	55                   	push   %rbp
+  800d10:	48 89 e5             	mov    %rsp,%rbp
+  800d13:	41 57                	push   %r15
+  800d15:	41 56                	push   %r14
+  800d17:	41 55                	push   %r13
+  800d19:	41 54                	push   %r12
+  800d1b:	53                   	push   %rbx
+  800d1c:	48 83 ec 18          	sub    $0x18,%rsp
+  800d20:	49 89 fc             	mov    %rdi,%r12
+  800d23:	49 89 f5             	mov    %rsi,%r13
+  800d26:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800d2a:	8b 45 10             	mov    0x10(%rbp),%eax
+  800d2d:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  800d30:	41 89 cf             	mov    %ecx,%r15d
+  800d33:	4c 39 fa             	cmp    %r15,%rdx
+  800d36:	73 5b                	jae    800d93 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  800d38:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  800d3c:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  800d40:	85 db                	test   %ebx,%ebx
+  800d42:	7e 0e                	jle    800d52 <print_num+0x43>
+            putch(padc, put_arg);
+  800d44:	4c 89 ee             	mov    %r13,%rsi
+  800d47:	44 89 f7             	mov    %r14d,%edi
+  800d4a:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  800d4d:	83 eb 01             	sub    $0x1,%ebx
+  800d50:	75 f2                	jne    800d44 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  800d52:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  800d56:	48 b9 14 3b 80 00 00 	movabs $0x803b14,%rcx
+  800d5d:	00 00 00 
+  800d60:	48 b8 03 3b 80 00 00 	movabs $0x803b03,%rax
+  800d67:	00 00 00 
+  800d6a:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  800d6e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800d72:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d77:	49 f7 f7             	div    %r15
+  800d7a:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  800d7e:	4c 89 ee             	mov    %r13,%rsi
+  800d81:	41 ff d4             	call   *%r12
+}
+  800d84:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800d88:	5b                   	pop    %rbx
+  800d89:	41 5c                	pop    %r12
+  800d8b:	41 5d                	pop    %r13
+  800d8d:	41 5e                	pop    %r14
+  800d8f:	41 5f                	pop    %r15
+  800d91:	5d                   	pop    %rbp
+  800d92:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  800d93:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800d97:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d9c:	49 f7 f7             	div    %r15
+  800d9f:	48 83 ec 08          	sub    $0x8,%rsp
+  800da3:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  800da7:	52                   	push   %rdx
+  800da8:	45 0f be c9          	movsbl %r9b,%r9d
+  800dac:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  800db0:	48 89 c2             	mov    %rax,%rdx
+  800db3:	48 b8 0f 0d 80 00 00 	movabs $0x800d0f,%rax
+  800dba:	00 00 00 
+  800dbd:	ff d0                	call   *%rax
+  800dbf:	48 83 c4 10          	add    $0x10,%rsp
+  800dc3:	eb 8d                	jmp    800d52 <print_num+0x43>
+
+0000000000800dc5 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  800dc5:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  800dc9:	48 8b 06             	mov    (%rsi),%rax
+  800dcc:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  800dd0:	73 0a                	jae    800ddc <sprintputch+0x17>
+        *state->start++ = ch;
+  800dd2:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800dd6:	48 89 16             	mov    %rdx,(%rsi)
+  800dd9:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  800ddc:	c3                   	ret
+
+0000000000800ddd <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  800ddd:	55                   	push   %rbp
+  800dde:	48 89 e5             	mov    %rsp,%rbp
+  800de1:	48 83 ec 50          	sub    $0x50,%rsp
+  800de5:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800de9:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800ded:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  800df1:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800df8:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800dfc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e00:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800e04:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  800e08:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800e0c:	48 b8 1a 0e 80 00 00 	movabs $0x800e1a,%rax
+  800e13:	00 00 00 
+  800e16:	ff d0                	call   *%rax
+}
+  800e18:	c9                   	leave
+  800e19:	c3                   	ret
+
+0000000000800e1a <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  800e1a:	55                   	push   %rbp
+  800e1b:	48 89 e5             	mov    %rsp,%rbp
+  800e1e:	41 57                	push   %r15
+  800e20:	41 56                	push   %r14
+  800e22:	41 55                	push   %r13
+  800e24:	41 54                	push   %r12
+  800e26:	53                   	push   %rbx
+  800e27:	48 83 ec 38          	sub    $0x38,%rsp
+  800e2b:	49 89 fe             	mov    %rdi,%r14
+  800e2e:	49 89 f5             	mov    %rsi,%r13
+  800e31:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  800e34:	48 8b 01             	mov    (%rcx),%rax
+  800e37:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  800e3b:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800e3f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e43:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  800e47:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  800e4b:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  800e4f:	0f b6 3b             	movzbl (%rbx),%edi
+  800e52:	40 80 ff 25          	cmp    $0x25,%dil
+  800e56:	74 18                	je     800e70 <vprintfmt+0x56>
+            if (!ch) return;
+  800e58:	40 84 ff             	test   %dil,%dil
+  800e5b:	0f 84 b1 06 00 00    	je     801512 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  800e61:	40 0f b6 ff          	movzbl %dil,%edi
+  800e65:	4c 89 ee             	mov    %r13,%rsi
+  800e68:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  800e6b:	4c 89 e3             	mov    %r12,%rbx
+  800e6e:	eb db                	jmp    800e4b <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  800e70:	be 00 00 00 00       	mov    $0x0,%esi
+  800e75:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  800e79:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  800e7e:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800e84:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  800e8b:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800e8f:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  800e94:	41 0f b6 04 24       	movzbl (%r12),%eax
+  800e99:	88 45 a0             	mov    %al,-0x60(%rbp)
+  800e9c:	83 e8 23             	sub    $0x23,%eax
+  800e9f:	3c 57                	cmp    $0x57,%al
+  800ea1:	0f 87 51 06 00 00    	ja     8014f8 <vprintfmt+0x6de>
+  800ea7:	0f b6 c0             	movzbl %al,%eax
+  800eaa:	48 b9 c0 3c 80 00 00 	movabs $0x803cc0,%rcx
+  800eb1:	00 00 00 
+  800eb4:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  800eb7:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  800eba:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  800ebe:	eb cf                	jmp    800e8f <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  800ec0:	49 89 dc             	mov    %rbx,%r12
+  800ec3:	be 01 00 00 00       	mov    $0x1,%esi
+  800ec8:	eb c5                	jmp    800e8f <vprintfmt+0x75>
+            padc = ch;
+  800eca:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  800ece:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800ed1:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800ed4:	eb b9                	jmp    800e8f <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800ed6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ed9:	83 f8 2f             	cmp    $0x2f,%eax
+  800edc:	77 24                	ja     800f02 <vprintfmt+0xe8>
+  800ede:	89 c1                	mov    %eax,%ecx
+  800ee0:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  800ee4:	83 c0 08             	add    $0x8,%eax
+  800ee7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800eea:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  800eed:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  800ef0:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800ef4:	79 99                	jns    800e8f <vprintfmt+0x75>
+                width = precision;
+  800ef6:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  800efa:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800f00:	eb 8d                	jmp    800e8f <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800f02:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  800f06:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  800f0a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800f0e:	eb da                	jmp    800eea <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  800f10:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  800f15:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800f19:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  800f1f:	3c 39                	cmp    $0x39,%al
+  800f21:	77 1c                	ja     800f3f <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  800f23:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  800f27:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  800f2b:	0f b6 c0             	movzbl %al,%eax
+  800f2e:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800f33:	0f b6 03             	movzbl (%rbx),%eax
+  800f36:	3c 39                	cmp    $0x39,%al
+  800f38:	76 e9                	jbe    800f23 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  800f3a:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  800f3d:	eb b1                	jmp    800ef0 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  800f3f:	49 89 dc             	mov    %rbx,%r12
+  800f42:	eb ac                	jmp    800ef0 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  800f44:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  800f47:	85 c9                	test   %ecx,%ecx
+  800f49:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f4e:	0f 49 c1             	cmovns %ecx,%eax
+  800f51:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  800f54:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800f57:	e9 33 ff ff ff       	jmp    800e8f <vprintfmt+0x75>
+            lflag++;
+  800f5c:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  800f5f:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800f62:	e9 28 ff ff ff       	jmp    800e8f <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  800f67:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800f6a:	83 f8 2f             	cmp    $0x2f,%eax
+  800f6d:	77 19                	ja     800f88 <vprintfmt+0x16e>
+  800f6f:	89 c2                	mov    %eax,%edx
+  800f71:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800f75:	83 c0 08             	add    $0x8,%eax
+  800f78:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800f7b:	8b 3a                	mov    (%rdx),%edi
+  800f7d:	4c 89 ee             	mov    %r13,%rsi
+  800f80:	41 ff d6             	call   *%r14
+            break;
+  800f83:	e9 c3 fe ff ff       	jmp    800e4b <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  800f88:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800f8c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800f90:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800f94:	eb e5                	jmp    800f7b <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  800f96:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800f99:	83 f8 2f             	cmp    $0x2f,%eax
+  800f9c:	77 5a                	ja     800ff8 <vprintfmt+0x1de>
+  800f9e:	89 c2                	mov    %eax,%edx
+  800fa0:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800fa4:	83 c0 08             	add    $0x8,%eax
+  800fa7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  800faa:	8b 02                	mov    (%rdx),%eax
+  800fac:	89 c1                	mov    %eax,%ecx
+  800fae:	f7 d9                	neg    %ecx
+  800fb0:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  800fb3:	83 f9 15             	cmp    $0x15,%ecx
+  800fb6:	7f 4e                	jg     801006 <vprintfmt+0x1ec>
+  800fb8:	48 63 c1             	movslq %ecx,%rax
+  800fbb:	48 ba 80 3f 80 00 00 	movabs $0x803f80,%rdx
+  800fc2:	00 00 00 
+  800fc5:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  800fc9:	48 85 c0             	test   %rax,%rax
+  800fcc:	74 38                	je     801006 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  800fce:	48 89 c1             	mov    %rax,%rcx
+  800fd1:	48 ba 79 41 80 00 00 	movabs $0x804179,%rdx
+  800fd8:	00 00 00 
+  800fdb:	4c 89 ee             	mov    %r13,%rsi
+  800fde:	4c 89 f7             	mov    %r14,%rdi
+  800fe1:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fe6:	49 b8 dd 0d 80 00 00 	movabs $0x800ddd,%r8
+  800fed:	00 00 00 
+  800ff0:	41 ff d0             	call   *%r8
+  800ff3:	e9 53 fe ff ff       	jmp    800e4b <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  800ff8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ffc:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801000:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801004:	eb a4                	jmp    800faa <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  801006:	48 ba 2c 3b 80 00 00 	movabs $0x803b2c,%rdx
+  80100d:	00 00 00 
+  801010:	4c 89 ee             	mov    %r13,%rsi
+  801013:	4c 89 f7             	mov    %r14,%rdi
+  801016:	b8 00 00 00 00       	mov    $0x0,%eax
+  80101b:	49 b8 dd 0d 80 00 00 	movabs $0x800ddd,%r8
+  801022:	00 00 00 
+  801025:	41 ff d0             	call   *%r8
+  801028:	e9 1e fe ff ff       	jmp    800e4b <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  80102d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801030:	83 f8 2f             	cmp    $0x2f,%eax
+  801033:	77 6c                	ja     8010a1 <vprintfmt+0x287>
+  801035:	89 c2                	mov    %eax,%edx
+  801037:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80103b:	83 c0 08             	add    $0x8,%eax
+  80103e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801041:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  801044:	48 85 d2             	test   %rdx,%rdx
+  801047:	48 b8 25 3b 80 00 00 	movabs $0x803b25,%rax
+  80104e:	00 00 00 
+  801051:	48 0f 45 c2          	cmovne %rdx,%rax
+  801055:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  801059:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  80105d:	7e 06                	jle    801065 <vprintfmt+0x24b>
+  80105f:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  801063:	75 4a                	jne    8010af <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  801065:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  801069:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  80106d:	0f b6 00             	movzbl (%rax),%eax
+  801070:	84 c0                	test   %al,%al
+  801072:	0f 85 9a 00 00 00    	jne    801112 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  801078:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80107b:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  80107f:	85 c0                	test   %eax,%eax
+  801081:	0f 8e c4 fd ff ff    	jle    800e4b <vprintfmt+0x31>
+  801087:	4c 89 ee             	mov    %r13,%rsi
+  80108a:	bf 20 00 00 00       	mov    $0x20,%edi
+  80108f:	41 ff d6             	call   *%r14
+  801092:	41 83 ec 01          	sub    $0x1,%r12d
+  801096:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  80109a:	75 eb                	jne    801087 <vprintfmt+0x26d>
+  80109c:	e9 aa fd ff ff       	jmp    800e4b <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8010a1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8010a5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8010a9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8010ad:	eb 92                	jmp    801041 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  8010af:	49 63 f7             	movslq %r15d,%rsi
+  8010b2:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  8010b6:	48 b8 cc 15 80 00 00 	movabs $0x8015cc,%rax
+  8010bd:	00 00 00 
+  8010c0:	ff d0                	call   *%rax
+  8010c2:	48 89 c2             	mov    %rax,%rdx
+  8010c5:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8010c8:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  8010ca:	8d 70 ff             	lea    -0x1(%rax),%esi
+  8010cd:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  8010d0:	85 c0                	test   %eax,%eax
+  8010d2:	7e 91                	jle    801065 <vprintfmt+0x24b>
+  8010d4:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  8010d9:	4c 89 ee             	mov    %r13,%rsi
+  8010dc:	44 89 e7             	mov    %r12d,%edi
+  8010df:	41 ff d6             	call   *%r14
+  8010e2:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8010e6:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8010e9:	83 f8 ff             	cmp    $0xffffffff,%eax
+  8010ec:	75 eb                	jne    8010d9 <vprintfmt+0x2bf>
+  8010ee:	e9 72 ff ff ff       	jmp    801065 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8010f3:	0f b6 f8             	movzbl %al,%edi
+  8010f6:	4c 89 ee             	mov    %r13,%rsi
+  8010f9:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8010fc:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  801100:	49 83 c4 01          	add    $0x1,%r12
+  801104:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  80110a:	84 c0                	test   %al,%al
+  80110c:	0f 84 66 ff ff ff    	je     801078 <vprintfmt+0x25e>
+  801112:	45 85 ff             	test   %r15d,%r15d
+  801115:	78 0a                	js     801121 <vprintfmt+0x307>
+  801117:	41 83 ef 01          	sub    $0x1,%r15d
+  80111b:	0f 88 57 ff ff ff    	js     801078 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  801121:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  801125:	74 cc                	je     8010f3 <vprintfmt+0x2d9>
+  801127:	8d 50 e0             	lea    -0x20(%rax),%edx
+  80112a:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  80112f:	80 fa 5e             	cmp    $0x5e,%dl
+  801132:	77 c2                	ja     8010f6 <vprintfmt+0x2dc>
+  801134:	eb bd                	jmp    8010f3 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  801136:	40 84 f6             	test   %sil,%sil
+  801139:	75 26                	jne    801161 <vprintfmt+0x347>
+    switch (lflag) {
+  80113b:	85 d2                	test   %edx,%edx
+  80113d:	74 59                	je     801198 <vprintfmt+0x37e>
+  80113f:	83 fa 01             	cmp    $0x1,%edx
+  801142:	74 7b                	je     8011bf <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  801144:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801147:	83 f8 2f             	cmp    $0x2f,%eax
+  80114a:	0f 87 96 00 00 00    	ja     8011e6 <vprintfmt+0x3cc>
+  801150:	89 c2                	mov    %eax,%edx
+  801152:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801156:	83 c0 08             	add    $0x8,%eax
+  801159:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80115c:	4c 8b 22             	mov    (%rdx),%r12
+  80115f:	eb 17                	jmp    801178 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  801161:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801164:	83 f8 2f             	cmp    $0x2f,%eax
+  801167:	77 21                	ja     80118a <vprintfmt+0x370>
+  801169:	89 c2                	mov    %eax,%edx
+  80116b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80116f:	83 c0 08             	add    $0x8,%eax
+  801172:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801175:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  801178:	4d 85 e4             	test   %r12,%r12
+  80117b:	78 7a                	js     8011f7 <vprintfmt+0x3dd>
+            num = i;
+  80117d:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  801180:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  801185:	e9 50 02 00 00       	jmp    8013da <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  80118a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80118e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801192:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801196:	eb dd                	jmp    801175 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  801198:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80119b:	83 f8 2f             	cmp    $0x2f,%eax
+  80119e:	77 11                	ja     8011b1 <vprintfmt+0x397>
+  8011a0:	89 c2                	mov    %eax,%edx
+  8011a2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8011a6:	83 c0 08             	add    $0x8,%eax
+  8011a9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8011ac:	4c 63 22             	movslq (%rdx),%r12
+  8011af:	eb c7                	jmp    801178 <vprintfmt+0x35e>
+  8011b1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8011b5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8011b9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8011bd:	eb ed                	jmp    8011ac <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  8011bf:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8011c2:	83 f8 2f             	cmp    $0x2f,%eax
+  8011c5:	77 11                	ja     8011d8 <vprintfmt+0x3be>
+  8011c7:	89 c2                	mov    %eax,%edx
+  8011c9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8011cd:	83 c0 08             	add    $0x8,%eax
+  8011d0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8011d3:	4c 8b 22             	mov    (%rdx),%r12
+  8011d6:	eb a0                	jmp    801178 <vprintfmt+0x35e>
+  8011d8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8011dc:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8011e0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8011e4:	eb ed                	jmp    8011d3 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  8011e6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8011ea:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8011ee:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8011f2:	e9 65 ff ff ff       	jmp    80115c <vprintfmt+0x342>
+                putch('-', put_arg);
+  8011f7:	4c 89 ee             	mov    %r13,%rsi
+  8011fa:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  8011ff:	41 ff d6             	call   *%r14
+                i = -i;
+  801202:	49 f7 dc             	neg    %r12
+  801205:	e9 73 ff ff ff       	jmp    80117d <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  80120a:	40 84 f6             	test   %sil,%sil
+  80120d:	75 32                	jne    801241 <vprintfmt+0x427>
+    switch (lflag) {
+  80120f:	85 d2                	test   %edx,%edx
+  801211:	74 5d                	je     801270 <vprintfmt+0x456>
+  801213:	83 fa 01             	cmp    $0x1,%edx
+  801216:	0f 84 82 00 00 00    	je     80129e <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  80121c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80121f:	83 f8 2f             	cmp    $0x2f,%eax
+  801222:	0f 87 a5 00 00 00    	ja     8012cd <vprintfmt+0x4b3>
+  801228:	89 c2                	mov    %eax,%edx
+  80122a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80122e:	83 c0 08             	add    $0x8,%eax
+  801231:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801234:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  801237:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  80123c:	e9 99 01 00 00       	jmp    8013da <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  801241:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801244:	83 f8 2f             	cmp    $0x2f,%eax
+  801247:	77 19                	ja     801262 <vprintfmt+0x448>
+  801249:	89 c2                	mov    %eax,%edx
+  80124b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80124f:	83 c0 08             	add    $0x8,%eax
+  801252:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801255:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  801258:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  80125d:	e9 78 01 00 00       	jmp    8013da <vprintfmt+0x5c0>
+  801262:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801266:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80126a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80126e:	eb e5                	jmp    801255 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  801270:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801273:	83 f8 2f             	cmp    $0x2f,%eax
+  801276:	77 18                	ja     801290 <vprintfmt+0x476>
+  801278:	89 c2                	mov    %eax,%edx
+  80127a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80127e:	83 c0 08             	add    $0x8,%eax
+  801281:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801284:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  801286:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  80128b:	e9 4a 01 00 00       	jmp    8013da <vprintfmt+0x5c0>
+  801290:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801294:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801298:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80129c:	eb e6                	jmp    801284 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  80129e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8012a1:	83 f8 2f             	cmp    $0x2f,%eax
+  8012a4:	77 19                	ja     8012bf <vprintfmt+0x4a5>
+  8012a6:	89 c2                	mov    %eax,%edx
+  8012a8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8012ac:	83 c0 08             	add    $0x8,%eax
+  8012af:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8012b2:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8012b5:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  8012ba:	e9 1b 01 00 00       	jmp    8013da <vprintfmt+0x5c0>
+  8012bf:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8012c3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8012c7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8012cb:	eb e5                	jmp    8012b2 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  8012cd:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8012d1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8012d5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8012d9:	e9 56 ff ff ff       	jmp    801234 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  8012de:	40 84 f6             	test   %sil,%sil
+  8012e1:	75 2e                	jne    801311 <vprintfmt+0x4f7>
+    switch (lflag) {
+  8012e3:	85 d2                	test   %edx,%edx
+  8012e5:	74 59                	je     801340 <vprintfmt+0x526>
+  8012e7:	83 fa 01             	cmp    $0x1,%edx
+  8012ea:	74 7f                	je     80136b <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  8012ec:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8012ef:	83 f8 2f             	cmp    $0x2f,%eax
+  8012f2:	0f 87 9f 00 00 00    	ja     801397 <vprintfmt+0x57d>
+  8012f8:	89 c2                	mov    %eax,%edx
+  8012fa:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8012fe:	83 c0 08             	add    $0x8,%eax
+  801301:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801304:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  801307:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  80130c:	e9 c9 00 00 00       	jmp    8013da <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  801311:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801314:	83 f8 2f             	cmp    $0x2f,%eax
+  801317:	77 19                	ja     801332 <vprintfmt+0x518>
+  801319:	89 c2                	mov    %eax,%edx
+  80131b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80131f:	83 c0 08             	add    $0x8,%eax
+  801322:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801325:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  801328:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  80132d:	e9 a8 00 00 00       	jmp    8013da <vprintfmt+0x5c0>
+  801332:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801336:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80133a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80133e:	eb e5                	jmp    801325 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  801340:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801343:	83 f8 2f             	cmp    $0x2f,%eax
+  801346:	77 15                	ja     80135d <vprintfmt+0x543>
+  801348:	89 c2                	mov    %eax,%edx
+  80134a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80134e:	83 c0 08             	add    $0x8,%eax
+  801351:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801354:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  801356:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  80135b:	eb 7d                	jmp    8013da <vprintfmt+0x5c0>
+  80135d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801361:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801365:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801369:	eb e9                	jmp    801354 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  80136b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80136e:	83 f8 2f             	cmp    $0x2f,%eax
+  801371:	77 16                	ja     801389 <vprintfmt+0x56f>
+  801373:	89 c2                	mov    %eax,%edx
+  801375:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801379:	83 c0 08             	add    $0x8,%eax
+  80137c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80137f:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  801382:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  801387:	eb 51                	jmp    8013da <vprintfmt+0x5c0>
+  801389:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80138d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801391:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801395:	eb e8                	jmp    80137f <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  801397:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80139b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80139f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8013a3:	e9 5c ff ff ff       	jmp    801304 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  8013a8:	4c 89 ee             	mov    %r13,%rsi
+  8013ab:	bf 30 00 00 00       	mov    $0x30,%edi
+  8013b0:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  8013b3:	4c 89 ee             	mov    %r13,%rsi
+  8013b6:	bf 78 00 00 00       	mov    $0x78,%edi
+  8013bb:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  8013be:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8013c1:	83 f8 2f             	cmp    $0x2f,%eax
+  8013c4:	77 47                	ja     80140d <vprintfmt+0x5f3>
+  8013c6:	89 c2                	mov    %eax,%edx
+  8013c8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8013cc:	83 c0 08             	add    $0x8,%eax
+  8013cf:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8013d2:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8013d5:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  8013da:	48 83 ec 08          	sub    $0x8,%rsp
+  8013de:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  8013e2:	0f 94 c0             	sete   %al
+  8013e5:	0f b6 c0             	movzbl %al,%eax
+  8013e8:	50                   	push   %rax
+  8013e9:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  8013ee:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  8013f2:	4c 89 ee             	mov    %r13,%rsi
+  8013f5:	4c 89 f7             	mov    %r14,%rdi
+  8013f8:	48 b8 0f 0d 80 00 00 	movabs $0x800d0f,%rax
+  8013ff:	00 00 00 
+  801402:	ff d0                	call   *%rax
+            break;
+  801404:	48 83 c4 10          	add    $0x10,%rsp
+  801408:	e9 3e fa ff ff       	jmp    800e4b <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  80140d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801411:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801415:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801419:	eb b7                	jmp    8013d2 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  80141b:	40 84 f6             	test   %sil,%sil
+  80141e:	75 2b                	jne    80144b <vprintfmt+0x631>
+    switch (lflag) {
+  801420:	85 d2                	test   %edx,%edx
+  801422:	74 56                	je     80147a <vprintfmt+0x660>
+  801424:	83 fa 01             	cmp    $0x1,%edx
+  801427:	74 7f                	je     8014a8 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  801429:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80142c:	83 f8 2f             	cmp    $0x2f,%eax
+  80142f:	0f 87 a2 00 00 00    	ja     8014d7 <vprintfmt+0x6bd>
+  801435:	89 c2                	mov    %eax,%edx
+  801437:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80143b:	83 c0 08             	add    $0x8,%eax
+  80143e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801441:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  801444:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  801449:	eb 8f                	jmp    8013da <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  80144b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80144e:	83 f8 2f             	cmp    $0x2f,%eax
+  801451:	77 19                	ja     80146c <vprintfmt+0x652>
+  801453:	89 c2                	mov    %eax,%edx
+  801455:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801459:	83 c0 08             	add    $0x8,%eax
+  80145c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80145f:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  801462:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  801467:	e9 6e ff ff ff       	jmp    8013da <vprintfmt+0x5c0>
+  80146c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801470:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801474:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801478:	eb e5                	jmp    80145f <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  80147a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80147d:	83 f8 2f             	cmp    $0x2f,%eax
+  801480:	77 18                	ja     80149a <vprintfmt+0x680>
+  801482:	89 c2                	mov    %eax,%edx
+  801484:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801488:	83 c0 08             	add    $0x8,%eax
+  80148b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80148e:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  801490:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  801495:	e9 40 ff ff ff       	jmp    8013da <vprintfmt+0x5c0>
+  80149a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80149e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8014a2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8014a6:	eb e6                	jmp    80148e <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  8014a8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8014ab:	83 f8 2f             	cmp    $0x2f,%eax
+  8014ae:	77 19                	ja     8014c9 <vprintfmt+0x6af>
+  8014b0:	89 c2                	mov    %eax,%edx
+  8014b2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8014b6:	83 c0 08             	add    $0x8,%eax
+  8014b9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8014bc:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8014bf:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  8014c4:	e9 11 ff ff ff       	jmp    8013da <vprintfmt+0x5c0>
+  8014c9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8014cd:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8014d1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8014d5:	eb e5                	jmp    8014bc <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  8014d7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8014db:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8014df:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8014e3:	e9 59 ff ff ff       	jmp    801441 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  8014e8:	4c 89 ee             	mov    %r13,%rsi
+  8014eb:	bf 25 00 00 00       	mov    $0x25,%edi
+  8014f0:	41 ff d6             	call   *%r14
+            break;
+  8014f3:	e9 53 f9 ff ff       	jmp    800e4b <vprintfmt+0x31>
+            putch('%', put_arg);
+  8014f8:	4c 89 ee             	mov    %r13,%rsi
+  8014fb:	bf 25 00 00 00       	mov    $0x25,%edi
+  801500:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  801503:	48 83 eb 01          	sub    $0x1,%rbx
+  801507:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  80150b:	75 f6                	jne    801503 <vprintfmt+0x6e9>
+  80150d:	e9 39 f9 ff ff       	jmp    800e4b <vprintfmt+0x31>
+}
+  801512:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  801516:	5b                   	pop    %rbx
+  801517:	41 5c                	pop    %r12
+  801519:	41 5d                	pop    %r13
+  80151b:	41 5e                	pop    %r14
+  80151d:	41 5f                	pop    %r15
+  80151f:	5d                   	pop    %rbp
+  801520:	c3                   	ret
+
+0000000000801521 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  801521:	55                   	push   %rbp
+  801522:	48 89 e5             	mov    %rsp,%rbp
+  801525:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  801529:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80152d:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  801532:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  801536:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  80153d:	48 85 ff             	test   %rdi,%rdi
+  801540:	74 2b                	je     80156d <vsnprintf+0x4c>
+  801542:	48 85 f6             	test   %rsi,%rsi
+  801545:	74 26                	je     80156d <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  801547:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80154b:	48 bf c5 0d 80 00 00 	movabs $0x800dc5,%rdi
+  801552:	00 00 00 
+  801555:	48 b8 1a 0e 80 00 00 	movabs $0x800e1a,%rax
+  80155c:	00 00 00 
+  80155f:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  801561:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801565:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  801568:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  80156b:	c9                   	leave
+  80156c:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  80156d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801572:	eb f7                	jmp    80156b <vsnprintf+0x4a>
+
+0000000000801574 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  801574:	55                   	push   %rbp
+  801575:	48 89 e5             	mov    %rsp,%rbp
+  801578:	48 83 ec 50          	sub    $0x50,%rsp
+  80157c:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801580:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  801584:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  801588:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  80158f:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801593:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801597:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80159b:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  80159f:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8015a3:	48 b8 21 15 80 00 00 	movabs $0x801521,%rax
+  8015aa:	00 00 00 
+  8015ad:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  8015af:	c9                   	leave
+  8015b0:	c3                   	ret
+
+00000000008015b1 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  8015b1:	80 3f 00             	cmpb   $0x0,(%rdi)
+  8015b4:	74 10                	je     8015c6 <strlen+0x15>
+    size_t n = 0;
+  8015b6:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  8015bb:	48 83 c0 01          	add    $0x1,%rax
+  8015bf:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  8015c3:	75 f6                	jne    8015bb <strlen+0xa>
+  8015c5:	c3                   	ret
+    size_t n = 0;
+  8015c6:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  8015cb:	c3                   	ret
+
+00000000008015cc <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  8015cc:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  8015cf:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  8015d4:	48 85 f6             	test   %rsi,%rsi
+  8015d7:	74 11                	je     8015ea <strnlen+0x1e>
+  8015d9:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  8015dd:	74 0c                	je     8015eb <strnlen+0x1f>
+  8015df:	48 83 c2 01          	add    $0x1,%rdx
+  8015e3:	48 39 d0             	cmp    %rdx,%rax
+  8015e6:	75 f1                	jne    8015d9 <strnlen+0xd>
+  8015e8:	eb 04                	jmp    8015ee <strnlen+0x22>
+  8015ea:	c3                   	ret
+  8015eb:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  8015ee:	c3                   	ret
+
+00000000008015ef <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  8015ef:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  8015f2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015f7:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  8015fb:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  8015fe:	48 83 c2 01          	add    $0x1,%rdx
+  801602:	84 c9                	test   %cl,%cl
+  801604:	75 f1                	jne    8015f7 <strcpy+0x8>
+        ;
+    return res;
+}
+  801606:	c3                   	ret
+
+0000000000801607 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  801607:	55                   	push   %rbp
+  801608:	48 89 e5             	mov    %rsp,%rbp
+  80160b:	41 54                	push   %r12
+  80160d:	53                   	push   %rbx
+  80160e:	48 89 fb             	mov    %rdi,%rbx
+  801611:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  801614:	48 b8 b1 15 80 00 00 	movabs $0x8015b1,%rax
+  80161b:	00 00 00 
+  80161e:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  801620:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  801624:	4c 89 e6             	mov    %r12,%rsi
+  801627:	48 b8 ef 15 80 00 00 	movabs $0x8015ef,%rax
+  80162e:	00 00 00 
+  801631:	ff d0                	call   *%rax
+    return dst;
+}
+  801633:	48 89 d8             	mov    %rbx,%rax
+  801636:	5b                   	pop    %rbx
+  801637:	41 5c                	pop    %r12
+  801639:	5d                   	pop    %rbp
+  80163a:	c3                   	ret
+
+000000000080163b <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  80163b:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  80163e:	48 85 d2             	test   %rdx,%rdx
+  801641:	74 1f                	je     801662 <strncpy+0x27>
+  801643:	48 01 fa             	add    %rdi,%rdx
+  801646:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  801649:	48 83 c1 01          	add    $0x1,%rcx
+  80164d:	44 0f b6 06          	movzbl (%rsi),%r8d
+  801651:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  801655:	41 80 f8 01          	cmp    $0x1,%r8b
+  801659:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  80165d:	48 39 ca             	cmp    %rcx,%rdx
+  801660:	75 e7                	jne    801649 <strncpy+0xe>
+    }
+    return ret;
+}
+  801662:	c3                   	ret
+
+0000000000801663 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  801663:	48 89 f8             	mov    %rdi,%rax
+  801666:	48 85 d2             	test   %rdx,%rdx
+  801669:	74 24                	je     80168f <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  80166b:	48 83 ea 01          	sub    $0x1,%rdx
+  80166f:	74 1b                	je     80168c <strlcpy+0x29>
+  801671:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  801675:	0f b6 16             	movzbl (%rsi),%edx
+  801678:	84 d2                	test   %dl,%dl
+  80167a:	74 10                	je     80168c <strlcpy+0x29>
+            *dst++ = *src++;
+  80167c:	48 83 c6 01          	add    $0x1,%rsi
+  801680:	48 83 c0 01          	add    $0x1,%rax
+  801684:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  801687:	48 39 c8             	cmp    %rcx,%rax
+  80168a:	75 e9                	jne    801675 <strlcpy+0x12>
+        *dst = '\0';
+  80168c:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  80168f:	48 29 f8             	sub    %rdi,%rax
+}
+  801692:	c3                   	ret
+
+0000000000801693 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  801693:	0f b6 07             	movzbl (%rdi),%eax
+  801696:	84 c0                	test   %al,%al
+  801698:	74 13                	je     8016ad <strcmp+0x1a>
+  80169a:	38 06                	cmp    %al,(%rsi)
+  80169c:	75 0f                	jne    8016ad <strcmp+0x1a>
+  80169e:	48 83 c7 01          	add    $0x1,%rdi
+  8016a2:	48 83 c6 01          	add    $0x1,%rsi
+  8016a6:	0f b6 07             	movzbl (%rdi),%eax
+  8016a9:	84 c0                	test   %al,%al
+  8016ab:	75 ed                	jne    80169a <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  8016ad:	0f b6 c0             	movzbl %al,%eax
+  8016b0:	0f b6 16             	movzbl (%rsi),%edx
+  8016b3:	29 d0                	sub    %edx,%eax
+}
+  8016b5:	c3                   	ret
+
+00000000008016b6 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  8016b6:	48 85 d2             	test   %rdx,%rdx
+  8016b9:	74 1f                	je     8016da <strncmp+0x24>
+  8016bb:	0f b6 07             	movzbl (%rdi),%eax
+  8016be:	84 c0                	test   %al,%al
+  8016c0:	74 1e                	je     8016e0 <strncmp+0x2a>
+  8016c2:	3a 06                	cmp    (%rsi),%al
+  8016c4:	75 1a                	jne    8016e0 <strncmp+0x2a>
+  8016c6:	48 83 c7 01          	add    $0x1,%rdi
+  8016ca:	48 83 c6 01          	add    $0x1,%rsi
+  8016ce:	48 83 ea 01          	sub    $0x1,%rdx
+  8016d2:	75 e7                	jne    8016bb <strncmp+0x5>
+
+    if (!n) return 0;
+  8016d4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016d9:	c3                   	ret
+  8016da:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016df:	c3                   	ret
+  8016e0:	48 85 d2             	test   %rdx,%rdx
+  8016e3:	74 09                	je     8016ee <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  8016e5:	0f b6 07             	movzbl (%rdi),%eax
+  8016e8:	0f b6 16             	movzbl (%rsi),%edx
+  8016eb:	29 d0                	sub    %edx,%eax
+  8016ed:	c3                   	ret
+    if (!n) return 0;
+  8016ee:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8016f3:	c3                   	ret
+
+00000000008016f4 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  8016f4:	0f b6 17             	movzbl (%rdi),%edx
+  8016f7:	84 d2                	test   %dl,%dl
+  8016f9:	74 18                	je     801713 <strchr+0x1f>
+        if (*str == c) {
+  8016fb:	0f be d2             	movsbl %dl,%edx
+  8016fe:	39 f2                	cmp    %esi,%edx
+  801700:	74 17                	je     801719 <strchr+0x25>
+    for (; *str; str++) {
+  801702:	48 83 c7 01          	add    $0x1,%rdi
+  801706:	0f b6 17             	movzbl (%rdi),%edx
+  801709:	84 d2                	test   %dl,%dl
+  80170b:	75 ee                	jne    8016fb <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  80170d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801712:	c3                   	ret
+  801713:	b8 00 00 00 00       	mov    $0x0,%eax
+  801718:	c3                   	ret
+  801719:	48 89 f8             	mov    %rdi,%rax
+}
+  80171c:	c3                   	ret
+
+000000000080171d <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  80171d:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  801720:	0f b6 17             	movzbl (%rdi),%edx
+  801723:	84 d2                	test   %dl,%dl
+  801725:	74 13                	je     80173a <strfind+0x1d>
+  801727:	0f be d2             	movsbl %dl,%edx
+  80172a:	39 f2                	cmp    %esi,%edx
+  80172c:	74 0b                	je     801739 <strfind+0x1c>
+  80172e:	48 83 c0 01          	add    $0x1,%rax
+  801732:	0f b6 10             	movzbl (%rax),%edx
+  801735:	84 d2                	test   %dl,%dl
+  801737:	75 ee                	jne    801727 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  801739:	c3                   	ret
+  80173a:	c3                   	ret
+
+000000000080173b <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  80173b:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  80173e:	48 89 f8             	mov    %rdi,%rax
+  801741:	48 f7 d8             	neg    %rax
+  801744:	83 e0 07             	and    $0x7,%eax
+  801747:	49 89 d1             	mov    %rdx,%r9
+  80174a:	49 29 c1             	sub    %rax,%r9
+  80174d:	78 36                	js     801785 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  80174f:	40 0f b6 c6          	movzbl %sil,%eax
+  801753:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  80175a:	01 01 01 
+  80175d:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  801761:	40 f6 c7 07          	test   $0x7,%dil
+  801765:	75 38                	jne    80179f <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  801767:	4c 89 c9             	mov    %r9,%rcx
+  80176a:	48 c1 f9 03          	sar    $0x3,%rcx
+  80176e:	74 0c                	je     80177c <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  801770:	fc                   	cld
+  801771:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  801774:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  801778:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  80177c:	4d 85 c9             	test   %r9,%r9
+  80177f:	75 45                	jne    8017c6 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  801781:	4c 89 c0             	mov    %r8,%rax
+  801784:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  801785:	48 85 d2             	test   %rdx,%rdx
+  801788:	74 f7                	je     801781 <memset+0x46>
+  80178a:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  80178d:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  801790:	48 83 c0 01          	add    $0x1,%rax
+  801794:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  801798:	48 39 c2             	cmp    %rax,%rdx
+  80179b:	75 f3                	jne    801790 <memset+0x55>
+  80179d:	eb e2                	jmp    801781 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  80179f:	40 f6 c7 01          	test   $0x1,%dil
+  8017a3:	74 06                	je     8017ab <memset+0x70>
+  8017a5:	88 07                	mov    %al,(%rdi)
+  8017a7:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  8017ab:	40 f6 c7 02          	test   $0x2,%dil
+  8017af:	74 07                	je     8017b8 <memset+0x7d>
+  8017b1:	66 89 07             	mov    %ax,(%rdi)
+  8017b4:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  8017b8:	40 f6 c7 04          	test   $0x4,%dil
+  8017bc:	74 a9                	je     801767 <memset+0x2c>
+  8017be:	89 07                	mov    %eax,(%rdi)
+  8017c0:	48 83 c7 04          	add    $0x4,%rdi
+  8017c4:	eb a1                	jmp    801767 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  8017c6:	41 f6 c1 04          	test   $0x4,%r9b
+  8017ca:	74 06                	je     8017d2 <memset+0x97>
+  8017cc:	89 07                	mov    %eax,(%rdi)
+  8017ce:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  8017d2:	41 f6 c1 02          	test   $0x2,%r9b
+  8017d6:	74 07                	je     8017df <memset+0xa4>
+  8017d8:	66 89 07             	mov    %ax,(%rdi)
+  8017db:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  8017df:	41 f6 c1 01          	test   $0x1,%r9b
+  8017e3:	74 9c                	je     801781 <memset+0x46>
+  8017e5:	88 07                	mov    %al,(%rdi)
+  8017e7:	eb 98                	jmp    801781 <memset+0x46>
+
+00000000008017e9 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  8017e9:	48 89 f8             	mov    %rdi,%rax
+  8017ec:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  8017ef:	48 39 fe             	cmp    %rdi,%rsi
+  8017f2:	73 3b                	jae    80182f <memmove+0x46>
+  8017f4:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  8017f8:	48 39 d7             	cmp    %rdx,%rdi
+  8017fb:	73 32                	jae    80182f <memmove+0x46>
+        s += n;
+        d += n;
+  8017fd:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  801801:	48 89 d6             	mov    %rdx,%rsi
+  801804:	48 09 fe             	or     %rdi,%rsi
+  801807:	48 09 ce             	or     %rcx,%rsi
+  80180a:	40 f6 c6 07          	test   $0x7,%sil
+  80180e:	75 12                	jne    801822 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  801810:	48 83 ef 08          	sub    $0x8,%rdi
+  801814:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  801818:	48 c1 e9 03          	shr    $0x3,%rcx
+  80181c:	fd                   	std
+  80181d:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  801820:	fc                   	cld
+  801821:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  801822:	48 83 ef 01          	sub    $0x1,%rdi
+  801826:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  80182a:	fd                   	std
+  80182b:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  80182d:	eb f1                	jmp    801820 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  80182f:	48 89 f2             	mov    %rsi,%rdx
+  801832:	48 09 c2             	or     %rax,%rdx
+  801835:	48 09 ca             	or     %rcx,%rdx
+  801838:	f6 c2 07             	test   $0x7,%dl
+  80183b:	75 0c                	jne    801849 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  80183d:	48 c1 e9 03          	shr    $0x3,%rcx
+  801841:	48 89 c7             	mov    %rax,%rdi
+  801844:	fc                   	cld
+  801845:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  801848:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  801849:	48 89 c7             	mov    %rax,%rdi
+  80184c:	fc                   	cld
+  80184d:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  80184f:	c3                   	ret
+
+0000000000801850 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  801850:	55                   	push   %rbp
+  801851:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  801854:	48 b8 e9 17 80 00 00 	movabs $0x8017e9,%rax
+  80185b:	00 00 00 
+  80185e:	ff d0                	call   *%rax
+}
+  801860:	5d                   	pop    %rbp
+  801861:	c3                   	ret
+
+0000000000801862 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  801862:	55                   	push   %rbp
+  801863:	48 89 e5             	mov    %rsp,%rbp
+  801866:	41 57                	push   %r15
+  801868:	41 56                	push   %r14
+  80186a:	41 55                	push   %r13
+  80186c:	41 54                	push   %r12
+  80186e:	53                   	push   %rbx
+  80186f:	48 83 ec 08          	sub    $0x8,%rsp
+  801873:	49 89 fe             	mov    %rdi,%r14
+  801876:	49 89 f7             	mov    %rsi,%r15
+  801879:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  80187c:	48 89 f7             	mov    %rsi,%rdi
+  80187f:	48 b8 b1 15 80 00 00 	movabs $0x8015b1,%rax
+  801886:	00 00 00 
+  801889:	ff d0                	call   *%rax
+  80188b:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  80188e:	48 89 de             	mov    %rbx,%rsi
+  801891:	4c 89 f7             	mov    %r14,%rdi
+  801894:	48 b8 cc 15 80 00 00 	movabs $0x8015cc,%rax
+  80189b:	00 00 00 
+  80189e:	ff d0                	call   *%rax
+  8018a0:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  8018a3:	48 39 c3             	cmp    %rax,%rbx
+  8018a6:	74 36                	je     8018de <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  8018a8:	48 89 d8             	mov    %rbx,%rax
+  8018ab:	4c 29 e8             	sub    %r13,%rax
+  8018ae:	49 39 c4             	cmp    %rax,%r12
+  8018b1:	73 31                	jae    8018e4 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  8018b3:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  8018b8:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8018bc:	4c 89 fe             	mov    %r15,%rsi
+  8018bf:	48 b8 50 18 80 00 00 	movabs $0x801850,%rax
+  8018c6:	00 00 00 
+  8018c9:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  8018cb:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  8018cf:	48 83 c4 08          	add    $0x8,%rsp
+  8018d3:	5b                   	pop    %rbx
+  8018d4:	41 5c                	pop    %r12
+  8018d6:	41 5d                	pop    %r13
+  8018d8:	41 5e                	pop    %r14
+  8018da:	41 5f                	pop    %r15
+  8018dc:	5d                   	pop    %rbp
+  8018dd:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  8018de:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  8018e2:	eb eb                	jmp    8018cf <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  8018e4:	48 83 eb 01          	sub    $0x1,%rbx
+  8018e8:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8018ec:	48 89 da             	mov    %rbx,%rdx
+  8018ef:	4c 89 fe             	mov    %r15,%rsi
+  8018f2:	48 b8 50 18 80 00 00 	movabs $0x801850,%rax
+  8018f9:	00 00 00 
+  8018fc:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  8018fe:	49 01 de             	add    %rbx,%r14
+  801901:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  801906:	eb c3                	jmp    8018cb <strlcat+0x69>
+
+0000000000801908 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  801908:	48 85 d2             	test   %rdx,%rdx
+  80190b:	74 2d                	je     80193a <memcmp+0x32>
+  80190d:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  801912:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  801916:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  80191b:	44 38 c1             	cmp    %r8b,%cl
+  80191e:	75 0f                	jne    80192f <memcmp+0x27>
+    while (n-- > 0) {
+  801920:	48 83 c0 01          	add    $0x1,%rax
+  801924:	48 39 c2             	cmp    %rax,%rdx
+  801927:	75 e9                	jne    801912 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  801929:	b8 00 00 00 00       	mov    $0x0,%eax
+  80192e:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  80192f:	0f b6 c1             	movzbl %cl,%eax
+  801932:	45 0f b6 c0          	movzbl %r8b,%r8d
+  801936:	44 29 c0             	sub    %r8d,%eax
+  801939:	c3                   	ret
+    return 0;
+  80193a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80193f:	c3                   	ret
+
+0000000000801940 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  801940:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  801944:	48 39 c7             	cmp    %rax,%rdi
+  801947:	73 0f                	jae    801958 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  801949:	40 38 37             	cmp    %sil,(%rdi)
+  80194c:	74 0e                	je     80195c <memfind+0x1c>
+    for (; src < end; src++) {
+  80194e:	48 83 c7 01          	add    $0x1,%rdi
+  801952:	48 39 f8             	cmp    %rdi,%rax
+  801955:	75 f2                	jne    801949 <memfind+0x9>
+  801957:	c3                   	ret
+  801958:	48 89 f8             	mov    %rdi,%rax
+  80195b:	c3                   	ret
+  80195c:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  80195f:	c3                   	ret
+
+0000000000801960 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  801960:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  801963:	0f b6 37             	movzbl (%rdi),%esi
+  801966:	40 80 fe 20          	cmp    $0x20,%sil
+  80196a:	74 06                	je     801972 <strtol+0x12>
+  80196c:	40 80 fe 09          	cmp    $0x9,%sil
+  801970:	75 13                	jne    801985 <strtol+0x25>
+  801972:	48 83 c7 01          	add    $0x1,%rdi
+  801976:	0f b6 37             	movzbl (%rdi),%esi
+  801979:	40 80 fe 20          	cmp    $0x20,%sil
+  80197d:	74 f3                	je     801972 <strtol+0x12>
+  80197f:	40 80 fe 09          	cmp    $0x9,%sil
+  801983:	74 ed                	je     801972 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  801985:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  801988:	83 e0 fd             	and    $0xfffffffd,%eax
+  80198b:	3c 01                	cmp    $0x1,%al
+  80198d:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801991:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  801997:	75 0f                	jne    8019a8 <strtol+0x48>
+  801999:	80 3f 30             	cmpb   $0x30,(%rdi)
+  80199c:	74 14                	je     8019b2 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  80199e:	85 d2                	test   %edx,%edx
+  8019a0:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8019a5:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  8019a8:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  8019ad:	4c 63 ca             	movslq %edx,%r9
+  8019b0:	eb 36                	jmp    8019e8 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8019b2:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  8019b6:	74 0f                	je     8019c7 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  8019b8:	85 d2                	test   %edx,%edx
+  8019ba:	75 ec                	jne    8019a8 <strtol+0x48>
+        s++;
+  8019bc:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  8019c0:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  8019c5:	eb e1                	jmp    8019a8 <strtol+0x48>
+        s += 2;
+  8019c7:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  8019cb:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  8019d0:	eb d6                	jmp    8019a8 <strtol+0x48>
+            dig -= '0';
+  8019d2:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  8019d5:	44 0f b6 c1          	movzbl %cl,%r8d
+  8019d9:	41 39 d0             	cmp    %edx,%r8d
+  8019dc:	7d 21                	jge    8019ff <strtol+0x9f>
+        val = val * base + dig;
+  8019de:	49 0f af c1          	imul   %r9,%rax
+  8019e2:	0f b6 c9             	movzbl %cl,%ecx
+  8019e5:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  8019e8:	48 83 c7 01          	add    $0x1,%rdi
+  8019ec:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  8019f0:	80 f9 39             	cmp    $0x39,%cl
+  8019f3:	76 dd                	jbe    8019d2 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  8019f5:	80 f9 7b             	cmp    $0x7b,%cl
+  8019f8:	77 05                	ja     8019ff <strtol+0x9f>
+            dig -= 'a' - 10;
+  8019fa:	83 e9 57             	sub    $0x57,%ecx
+  8019fd:	eb d6                	jmp    8019d5 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  8019ff:	4d 85 d2             	test   %r10,%r10
+  801a02:	74 03                	je     801a07 <strtol+0xa7>
+  801a04:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  801a07:	48 89 c2             	mov    %rax,%rdx
+  801a0a:	48 f7 da             	neg    %rdx
+  801a0d:	40 80 fe 2d          	cmp    $0x2d,%sil
+  801a11:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  801a15:	c3                   	ret
+
+0000000000801a16 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  801a16:	55                   	push   %rbp
+  801a17:	48 89 e5             	mov    %rsp,%rbp
+  801a1a:	53                   	push   %rbx
+  801a1b:	48 89 fa             	mov    %rdi,%rdx
+  801a1e:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801a21:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801a26:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a2b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801a30:	be 00 00 00 00       	mov    $0x0,%esi
+  801a35:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801a3b:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  801a3d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801a41:	c9                   	leave
+  801a42:	c3                   	ret
+
+0000000000801a43 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  801a43:	55                   	push   %rbp
+  801a44:	48 89 e5             	mov    %rsp,%rbp
+  801a47:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801a48:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801a4d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a52:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801a57:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a5c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801a61:	be 00 00 00 00       	mov    $0x0,%esi
+  801a66:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801a6c:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  801a6e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801a72:	c9                   	leave
+  801a73:	c3                   	ret
+
+0000000000801a74 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  801a74:	55                   	push   %rbp
+  801a75:	48 89 e5             	mov    %rsp,%rbp
+  801a78:	53                   	push   %rbx
+  801a79:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  801a7d:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801a80:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801a85:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801a8a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a8f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801a94:	be 00 00 00 00       	mov    $0x0,%esi
+  801a99:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801a9f:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801aa1:	48 85 c0             	test   %rax,%rax
+  801aa4:	7f 06                	jg     801aac <sys_env_destroy+0x38>
+}
+  801aa6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801aaa:	c9                   	leave
+  801aab:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801aac:	49 89 c0             	mov    %rax,%r8
+  801aaf:	b9 03 00 00 00       	mov    $0x3,%ecx
+  801ab4:	48 ba 50 40 80 00 00 	movabs $0x804050,%rdx
+  801abb:	00 00 00 
+  801abe:	be 26 00 00 00       	mov    $0x26,%esi
+  801ac3:	48 bf 6f 40 80 00 00 	movabs $0x80406f,%rdi
+  801aca:	00 00 00 
+  801acd:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ad2:	49 b9 7a 0b 80 00 00 	movabs $0x800b7a,%r9
+  801ad9:	00 00 00 
+  801adc:	41 ff d1             	call   *%r9
+
+0000000000801adf <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  801adf:	55                   	push   %rbp
+  801ae0:	48 89 e5             	mov    %rsp,%rbp
+  801ae3:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801ae4:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801ae9:	ba 00 00 00 00       	mov    $0x0,%edx
+  801aee:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801af3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801af8:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801afd:	be 00 00 00 00       	mov    $0x0,%esi
+  801b02:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801b08:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  801b0a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801b0e:	c9                   	leave
+  801b0f:	c3                   	ret
+
+0000000000801b10 <sys_yield>:
+
+void
+sys_yield(void) {
+  801b10:	55                   	push   %rbp
+  801b11:	48 89 e5             	mov    %rsp,%rbp
+  801b14:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801b15:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801b1a:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b1f:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801b24:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b29:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801b2e:	be 00 00 00 00       	mov    $0x0,%esi
+  801b33:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801b39:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  801b3b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801b3f:	c9                   	leave
+  801b40:	c3                   	ret
+
+0000000000801b41 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  801b41:	55                   	push   %rbp
+  801b42:	48 89 e5             	mov    %rsp,%rbp
+  801b45:	53                   	push   %rbx
+  801b46:	48 89 fa             	mov    %rdi,%rdx
+  801b49:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801b4c:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801b51:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  801b58:	00 00 00 
+  801b5b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801b60:	be 00 00 00 00       	mov    $0x0,%esi
+  801b65:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801b6b:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  801b6d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801b71:	c9                   	leave
+  801b72:	c3                   	ret
+
+0000000000801b73 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  801b73:	55                   	push   %rbp
+  801b74:	48 89 e5             	mov    %rsp,%rbp
+  801b77:	53                   	push   %rbx
+  801b78:	49 89 f8             	mov    %rdi,%r8
+  801b7b:	48 89 d3             	mov    %rdx,%rbx
+  801b7e:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801b81:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801b86:	4c 89 c2             	mov    %r8,%rdx
+  801b89:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801b8c:	be 00 00 00 00       	mov    $0x0,%esi
+  801b91:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801b97:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  801b99:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801b9d:	c9                   	leave
+  801b9e:	c3                   	ret
+
+0000000000801b9f <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  801b9f:	55                   	push   %rbp
+  801ba0:	48 89 e5             	mov    %rsp,%rbp
+  801ba3:	53                   	push   %rbx
+  801ba4:	48 83 ec 08          	sub    $0x8,%rsp
+  801ba8:	89 f8                	mov    %edi,%eax
+  801baa:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  801bad:	48 63 f9             	movslq %ecx,%rdi
+  801bb0:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801bb3:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801bb8:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801bbb:	be 00 00 00 00       	mov    $0x0,%esi
+  801bc0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801bc6:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801bc8:	48 85 c0             	test   %rax,%rax
+  801bcb:	7f 06                	jg     801bd3 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  801bcd:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801bd1:	c9                   	leave
+  801bd2:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801bd3:	49 89 c0             	mov    %rax,%r8
+  801bd6:	b9 04 00 00 00       	mov    $0x4,%ecx
+  801bdb:	48 ba 50 40 80 00 00 	movabs $0x804050,%rdx
+  801be2:	00 00 00 
+  801be5:	be 26 00 00 00       	mov    $0x26,%esi
+  801bea:	48 bf 6f 40 80 00 00 	movabs $0x80406f,%rdi
+  801bf1:	00 00 00 
+  801bf4:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bf9:	49 b9 7a 0b 80 00 00 	movabs $0x800b7a,%r9
+  801c00:	00 00 00 
+  801c03:	41 ff d1             	call   *%r9
+
+0000000000801c06 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801c06:	55                   	push   %rbp
+  801c07:	48 89 e5             	mov    %rsp,%rbp
+  801c0a:	53                   	push   %rbx
+  801c0b:	48 83 ec 08          	sub    $0x8,%rsp
+  801c0f:	89 f8                	mov    %edi,%eax
+  801c11:	49 89 f2             	mov    %rsi,%r10
+  801c14:	48 89 cf             	mov    %rcx,%rdi
+  801c17:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  801c1a:	48 63 da             	movslq %edx,%rbx
+  801c1d:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801c20:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801c25:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801c28:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  801c2b:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801c2d:	48 85 c0             	test   %rax,%rax
+  801c30:	7f 06                	jg     801c38 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  801c32:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801c36:	c9                   	leave
+  801c37:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801c38:	49 89 c0             	mov    %rax,%r8
+  801c3b:	b9 05 00 00 00       	mov    $0x5,%ecx
+  801c40:	48 ba 50 40 80 00 00 	movabs $0x804050,%rdx
+  801c47:	00 00 00 
+  801c4a:	be 26 00 00 00       	mov    $0x26,%esi
+  801c4f:	48 bf 6f 40 80 00 00 	movabs $0x80406f,%rdi
+  801c56:	00 00 00 
+  801c59:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c5e:	49 b9 7a 0b 80 00 00 	movabs $0x800b7a,%r9
+  801c65:	00 00 00 
+  801c68:	41 ff d1             	call   *%r9
+
+0000000000801c6b <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  801c6b:	55                   	push   %rbp
+  801c6c:	48 89 e5             	mov    %rsp,%rbp
+  801c6f:	53                   	push   %rbx
+  801c70:	48 83 ec 08          	sub    $0x8,%rsp
+  801c74:	48 89 f1             	mov    %rsi,%rcx
+  801c77:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  801c7a:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801c7d:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801c82:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801c87:	be 00 00 00 00       	mov    $0x0,%esi
+  801c8c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801c92:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801c94:	48 85 c0             	test   %rax,%rax
+  801c97:	7f 06                	jg     801c9f <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  801c99:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801c9d:	c9                   	leave
+  801c9e:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801c9f:	49 89 c0             	mov    %rax,%r8
+  801ca2:	b9 06 00 00 00       	mov    $0x6,%ecx
+  801ca7:	48 ba 50 40 80 00 00 	movabs $0x804050,%rdx
+  801cae:	00 00 00 
+  801cb1:	be 26 00 00 00       	mov    $0x26,%esi
+  801cb6:	48 bf 6f 40 80 00 00 	movabs $0x80406f,%rdi
+  801cbd:	00 00 00 
+  801cc0:	b8 00 00 00 00       	mov    $0x0,%eax
+  801cc5:	49 b9 7a 0b 80 00 00 	movabs $0x800b7a,%r9
+  801ccc:	00 00 00 
+  801ccf:	41 ff d1             	call   *%r9
+
+0000000000801cd2 <sys_region_batch>:
+
+int
+sys_region_batch(const struct RegionOp *ops, size_t count) {
+  801cd2:	55                   	push   %rbp
+  801cd3:	48 89 e5             	mov    %rsp,%rbp
+  801cd6:	53                   	push   %rbx
+  801cd7:	48 83 ec 08          	sub    $0x8,%rsp
+  801cdb:	48 89 fa             	mov    %rdi,%rdx
+  801cde:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801ce1:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801ce6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801ceb:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801cf0:	be 00 00 00 00       	mov    $0x0,%esi
+  801cf5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801cfb:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801cfd:	48 85 c0             	test   %rax,%rax
+  801d00:	7f 06                	jg     801d08 <sys_region_batch+0x36>
+        else
+            platform_asan_unpoison(va, ops[i].size);
+    }
+#endif
+    return res;
+}
+  801d02:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801d06:	c9                   	leave
+  801d07:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801d08:	49 89 c0             	mov    %rax,%r8
+  801d0b:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  801d10:	48 ba 50 40 80 00 00 	movabs $0x804050,%rdx
+  801d17:	00 00 00 
+  801d1a:	be 26 00 00 00       	mov    $0x26,%esi
+  801d1f:	48 bf 6f 40 80 00 00 	movabs $0x80406f,%rdi
+  801d26:	00 00 00 
+  801d29:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d2e:	49 b9 7a 0b 80 00 00 	movabs $0x800b7a,%r9
+  801d35:	00 00 00 
+  801d38:	41 ff d1             	call   *%r9
+
+0000000000801d3b <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  801d3b:	55                   	push   %rbp
+  801d3c:	48 89 e5             	mov    %rsp,%rbp
+  801d3f:	53                   	push   %rbx
+  801d40:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  801d44:	48 63 ce             	movslq %esi,%rcx
+  801d47:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801d4a:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801d4f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801d54:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801d59:	be 00 00 00 00       	mov    $0x0,%esi
+  801d5e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801d64:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801d66:	48 85 c0             	test   %rax,%rax
+  801d69:	7f 06                	jg     801d71 <sys_env_set_status+0x36>
+}
+  801d6b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801d6f:	c9                   	leave
+  801d70:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801d71:	49 89 c0             	mov    %rax,%r8
+  801d74:	b9 09 00 00 00       	mov    $0x9,%ecx
+  801d79:	48 ba 50 40 80 00 00 	movabs $0x804050,%rdx
+  801d80:	00 00 00 
+  801d83:	be 26 00 00 00       	mov    $0x26,%esi
+  801d88:	48 bf 6f 40 80 00 00 	movabs $0x80406f,%rdi
+  801d8f:	00 00 00 
+  801d92:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d97:	49 b9 7a 0b 80 00 00 	movabs $0x800b7a,%r9
+  801d9e:	00 00 00 
+  801da1:	41 ff d1             	call   *%r9
+
+0000000000801da4 <sys_env_set_weight>:
+
+int
+sys_env_set_weight(envid_t envid, uint32_t weight) {
+  801da4:	55                   	push   %rbp
+  801da5:	48 89 e5             	mov    %rsp,%rbp
+  801da8:	53                   	push   %rbx
+  801da9:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_weight, 1, envid, weight, 0, 0, 0, 0);
+  801dad:	89 f1                	mov    %esi,%ecx
+  801daf:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801db2:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801db7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801dbc:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801dc1:	be 00 00 00 00       	mov    $0x0,%esi
+  801dc6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801dcc:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801dce:	48 85 c0             	test   %rax,%rax
+  801dd1:	7f 06                	jg     801dd9 <sys_env_set_weight+0x35>
+}
+  801dd3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801dd7:	c9                   	leave
+  801dd8:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801dd9:	49 89 c0             	mov    %rax,%r8
+  801ddc:	b9 10 00 00 00       	mov    $0x10,%ecx
+  801de1:	48 ba 50 40 80 00 00 	movabs $0x804050,%rdx
+  801de8:	00 00 00 
+  801deb:	be 26 00 00 00       	mov    $0x26,%esi
+  801df0:	48 bf 6f 40 80 00 00 	movabs $0x80406f,%rdi
+  801df7:	00 00 00 
+  801dfa:	b8 00 00 00 00       	mov    $0x0,%eax
+  801dff:	49 b9 7a 0b 80 00 00 	movabs $0x800b7a,%r9
+  801e06:	00 00 00 
+  801e09:	41 ff d1             	call   *%r9
+
+0000000000801e0c <sys_env_set_rt>:
+
+int
+sys_env_set_rt(envid_t envid, uint64_t period, uint64_t budget, uint64_t deadline) {
+  801e0c:	55                   	push   %rbp
+  801e0d:	48 89 e5             	mov    %rsp,%rbp
+  801e10:	53                   	push   %rbx
+  801e11:	48 83 ec 08          	sub    $0x8,%rsp
+  801e15:	89 f8                	mov    %edi,%eax
+  801e17:	48 89 d3             	mov    %rdx,%rbx
+  801e1a:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_env_set_rt, 1, envid, period, budget, deadline, 0, 0);
+  801e1d:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801e20:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801e25:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801e28:	be 00 00 00 00       	mov    $0x0,%esi
+  801e2d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801e33:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801e35:	48 85 c0             	test   %rax,%rax
+  801e38:	7f 06                	jg     801e40 <sys_env_set_rt+0x34>
+}
+  801e3a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801e3e:	c9                   	leave
+  801e3f:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801e40:	49 89 c0             	mov    %rax,%r8
+  801e43:	b9 11 00 00 00       	mov    $0x11,%ecx
+  801e48:	48 ba 50 40 80 00 00 	movabs $0x804050,%rdx
+  801e4f:	00 00 00 
+  801e52:	be 26 00 00 00       	mov    $0x26,%esi
+  801e57:	48 bf 6f 40 80 00 00 	movabs $0x80406f,%rdi
+  801e5e:	00 00 00 
+  801e61:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e66:	49 b9 7a 0b 80 00 00 	movabs $0x800b7a,%r9
+  801e6d:	00 00 00 
+  801e70:	41 ff d1             	call   *%r9
+
+0000000000801e73 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  801e73:	55                   	push   %rbp
+  801e74:	48 89 e5             	mov    %rsp,%rbp
+  801e77:	53                   	push   %rbx
+  801e78:	48 83 ec 08          	sub    $0x8,%rsp
+  801e7c:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  801e7f:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801e82:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801e87:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801e8c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801e91:	be 00 00 00 00       	mov    $0x0,%esi
+  801e96:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801e9c:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801e9e:	48 85 c0             	test   %rax,%rax
+  801ea1:	7f 06                	jg     801ea9 <sys_env_set_trapframe+0x36>
+}
+  801ea3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801ea7:	c9                   	leave
+  801ea8:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801ea9:	49 89 c0             	mov    %rax,%r8
+  801eac:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  801eb1:	48 ba 50 40 80 00 00 	movabs $0x804050,%rdx
+  801eb8:	00 00 00 
+  801ebb:	be 26 00 00 00       	mov    $0x26,%esi
+  801ec0:	48 bf 6f 40 80 00 00 	movabs $0x80406f,%rdi
+  801ec7:	00 00 00 
+  801eca:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ecf:	49 b9 7a 0b 80 00 00 	movabs $0x800b7a,%r9
+  801ed6:	00 00 00 
+  801ed9:	41 ff d1             	call   *%r9
+
+0000000000801edc <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  801edc:	55                   	push   %rbp
+  801edd:	48 89 e5             	mov    %rsp,%rbp
+  801ee0:	53                   	push   %rbx
+  801ee1:	48 83 ec 08          	sub    $0x8,%rsp
+  801ee5:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  801ee8:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801eeb:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801ef0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801ef5:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801efa:	be 00 00 00 00       	mov    $0x0,%esi
+  801eff:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801f05:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801f07:	48 85 c0             	test   %rax,%rax
+  801f0a:	7f 06                	jg     801f12 <sys_env_set_pgfault_upcall+0x36>
+}
+  801f0c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801f10:	c9                   	leave
+  801f11:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801f12:	49 89 c0             	mov    %rax,%r8
+  801f15:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  801f1a:	48 ba 50 40 80 00 00 	movabs $0x804050,%rdx
+  801f21:	00 00 00 
+  801f24:	be 26 00 00 00       	mov    $0x26,%esi
+  801f29:	48 bf 6f 40 80 00 00 	movabs $0x80406f,%rdi
+  801f30:	00 00 00 
+  801f33:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f38:	49 b9 7a 0b 80 00 00 	movabs $0x800b7a,%r9
+  801f3f:	00 00 00 
+  801f42:	41 ff d1             	call   *%r9
+
+0000000000801f45 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  801f45:	55                   	push   %rbp
+  801f46:	48 89 e5             	mov    %rsp,%rbp
+  801f49:	53                   	push   %rbx
+  801f4a:	89 f8                	mov    %edi,%eax
+  801f4c:	49 89 f1             	mov    %rsi,%r9
+  801f4f:	48 89 d3             	mov    %rdx,%rbx
+  801f52:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  801f55:	49 63 f0             	movslq %r8d,%rsi
+  801f58:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801f5b:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801f60:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801f63:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801f69:	cd 30                	int    $0x30
+}
+  801f6b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801f6f:	c9                   	leave
+  801f70:	c3                   	ret
+
+0000000000801f71 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  801f71:	55                   	push   %rbp
+  801f72:	48 89 e5             	mov    %rsp,%rbp
+  801f75:	53                   	push   %rbx
+  801f76:	48 83 ec 08          	sub    $0x8,%rsp
+  801f7a:	48 89 fa             	mov    %rdi,%rdx
+  801f7d:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801f80:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801f85:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801f8a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801f8f:	be 00 00 00 00       	mov    $0x0,%esi
+  801f94:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801f9a:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801f9c:	48 85 c0             	test   %rax,%rax
+  801f9f:	7f 06                	jg     801fa7 <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801fa1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801fa5:	c9                   	leave
+  801fa6:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801fa7:	49 89 c0             	mov    %rax,%r8
+  801faa:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  801faf:	48 ba 50 40 80 00 00 	movabs $0x804050,%rdx
+  801fb6:	00 00 00 
+  801fb9:	be 26 00 00 00       	mov    $0x26,%esi
+  801fbe:	48 bf 6f 40 80 00 00 	movabs $0x80406f,%rdi
+  801fc5:	00 00 00 
+  801fc8:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fcd:	49 b9 7a 0b 80 00 00 	movabs $0x800b7a,%r9
+  801fd4:	00 00 00 
+  801fd7:	41 ff d1             	call   *%r9
+
+0000000000801fda <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  801fda:	55                   	push   %rbp
+  801fdb:	48 89 e5             	mov    %rsp,%rbp
+  801fde:	41 55                	push   %r13
+  801fe0:	41 54                	push   %r12
+  801fe2:	53                   	push   %rbx
+  801fe3:	48 83 ec 08          	sub    $0x8,%rsp
+  801fe7:	49 89 fc             	mov    %rdi,%r12
+  801fea:	48 89 f7             	mov    %rsi,%rdi
+  801fed:	48 89 d3             	mov    %rdx,%rbx
+  801ff0:	49 89 cd             	mov    %rcx,%r13
+    // LAB 9: Your code here:
+    int res = sys_ipc_recv(!pg ? (void*)MAX_USER_ADDRESS : pg, !size ? 0 : *size);
+  801ff3:	be 00 00 00 00       	mov    $0x0,%esi
+  801ff8:	48 85 d2             	test   %rdx,%rdx
+  801ffb:	74 03                	je     802000 <ipc_recv+0x26>
+  801ffd:	48 8b 32             	mov    (%rdx),%rsi
+  802000:	48 85 ff             	test   %rdi,%rdi
+  802003:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80200a:	00 00 00 
+  80200d:	48 0f 44 f8          	cmove  %rax,%rdi
+  802011:	48 b8 71 1f 80 00 00 	movabs $0x801f71,%rax
+  802018:	00 00 00 
+  80201b:	ff d0                	call   *%rax
+    if (res < 0) {
+  80201d:	85 c0                	test   %eax,%eax
+  80201f:	78 66                	js     802087 <ipc_recv+0xad>
+        if (size) {
+            *size = 0;
+        }
+        return res;
+    }
+    if (from_env_store) {
+  802021:	4d 85 e4             	test   %r12,%r12
+  802024:	74 14                	je     80203a <ipc_recv+0x60>
+        *from_env_store = thisenv->env_ipc_from;
+  802026:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  80202d:	00 00 00 
+  802030:	8b 80 ac 01 00 00    	mov    0x1ac(%rax),%eax
+  802036:	41 89 04 24          	mov    %eax,(%r12)
+    }
+    if (perm_store) {
+  80203a:	4d 85 ed             	test   %r13,%r13
+  80203d:	74 14                	je     802053 <ipc_recv+0x79>
+        *perm_store = thisenv->env_ipc_perm;
+  80203f:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  802046:	00 00 00 
+  802049:	8b 80 b0 01 00 00    	mov    0x1b0(%rax),%eax
+  80204f:	41 89 45 00          	mov    %eax,0x0(%r13)
+    }
+    if (size) {
+  802053:	48 85 db             	test   %rbx,%rbx
+  802056:	74 14                	je     80206c <ipc_recv+0x92>
+        *size = thisenv->env_ipc_maxsz;
+  802058:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  80205f:	00 00 00 
+  802062:	48 8b 80 a0 01 00 00 	mov    0x1a0(%rax),%rax
+  802069:	48 89 03             	mov    %rax,(%rbx)
+    }
+    return thisenv->env_ipc_value;
+  80206c:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  802073:	00 00 00 
+  802076:	8b 80 a8 01 00 00    	mov    0x1a8(%rax),%eax
+}
+  80207c:	48 83 c4 08          	add    $0x8,%rsp
+  802080:	5b                   	pop    %rbx
+  802081:	41 5c                	pop    %r12
+  802083:	41 5d                	pop    %r13
+  802085:	5d                   	pop    %rbp
+  802086:	c3                   	ret
+        if (from_env_store) {
+  802087:	4d 85 e4             	test   %r12,%r12
+  80208a:	74 08                	je     802094 <ipc_recv+0xba>
+            *from_env_store = 0;
+  80208c:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  802093:	00 
+        if (perm_store) {
+  802094:	4d 85 ed             	test   %r13,%r13
+  802097:	74 08                	je     8020a1 <ipc_recv+0xc7>
+            *perm_store = 0;
+  802099:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  8020a0:	00 
+        if (size) {
+  8020a1:	48 85 db             	test   %rbx,%rbx
+  8020a4:	74 d6                	je     80207c <ipc_recv+0xa2>
+            *size = 0;
+  8020a6:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  8020ad:	eb cd                	jmp    80207c <ipc_recv+0xa2>
+
+00000000008020af <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  8020af:	55                   	push   %rbp
+  8020b0:	48 89 e5             	mov    %rsp,%rbp
+  8020b3:	41 57                	push   %r15
+  8020b5:	41 56                	push   %r14
+  8020b7:	41 55                	push   %r13
+  8020b9:	41 54                	push   %r12
+  8020bb:	53                   	push   %rbx
+  8020bc:	48 83 ec 18          	sub    $0x18,%rsp
+  8020c0:	41 89 fd             	mov    %edi,%r13d
+  8020c3:	89 75 cc             	mov    %esi,-0x34(%rbp)
+  8020c6:	49 89 cc             	mov    %rcx,%r12
+  8020c9:	44 89 45 c8          	mov    %r8d,-0x38(%rbp)
+    // LAB 9: Your code here:
+    int res = 0;
+    while ((res = sys_ipc_try_send(to_env, val, !pg ? (void*)MAX_USER_ADDRESS : pg, size, perm)) < 0) {
+  8020cd:	48 85 d2             	test   %rdx,%rdx
+  8020d0:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8020d7:	00 00 00 
+  8020da:	48 0f 45 c2          	cmovne %rdx,%rax
+  8020de:	48 89 c3             	mov    %rax,%rbx
+  8020e1:	49 be 45 1f 80 00 00 	movabs $0x801f45,%r14
+  8020e8:	00 00 00 
+        if (res != -E_IPC_NOT_RECV) {
+            panic("sys_ipc_try_send failed: %i", res);
+        }
+        sys_yield();
+  8020eb:	49 bf 10 1b 80 00 00 	movabs $0x801b10,%r15
+  8020f2:	00 00 00 
+    while ((res = sys_ipc_try_send(to_env, val, !pg ? (void*)MAX_USER_ADDRESS : pg, size, perm)) < 0) {
+  8020f5:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  8020f8:	44 8b 45 c8          	mov    -0x38(%rbp),%r8d
+  8020fc:	4c 89 e1             	mov    %r12,%rcx
+  8020ff:	48 89 da             	mov    %rbx,%rdx
+  802102:	44 89 ef             	mov    %r13d,%edi
+  802105:	41 ff d6             	call   *%r14
+  802108:	85 c0                	test   %eax,%eax
+  80210a:	79 37                	jns    802143 <ipc_send+0x94>
+        if (res != -E_IPC_NOT_RECV) {
+  80210c:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  80210f:	75 05                	jne    802116 <ipc_send+0x67>
+        sys_yield();
+  802111:	41 ff d7             	call   *%r15
+  802114:	eb df                	jmp    8020f5 <ipc_send+0x46>
+            panic("sys_ipc_try_send failed: %i", res);
+  802116:	89 c1                	mov    %eax,%ecx
+  802118:	48 ba 7d 40 80 00 00 	movabs $0x80407d,%rdx
+  80211f:	00 00 00 
+  802122:	be 40 00 00 00       	mov    $0x40,%esi
+  802127:	48 bf 99 40 80 00 00 	movabs $0x804099,%rdi
+  80212e:	00 00 00 
+  802131:	b8 00 00 00 00       	mov    $0x0,%eax
+  802136:	49 b8 7a 0b 80 00 00 	movabs $0x800b7a,%r8
+  80213d:	00 00 00 
+  802140:	41 ff d0             	call   *%r8
+    }
+    return;
+}
+  802143:	48 83 c4 18          	add    $0x18,%rsp
+  802147:	5b                   	pop    %rbx
+  802148:	41 5c                	pop    %r12
+  80214a:	41 5d                	pop    %r13
+  80214c:	41 5e                	pop    %r14
+  80214e:	41 5f                	pop    %r15
+  802150:	5d                   	pop    %rbp
+  802151:	c3                   	ret
+
+0000000000802152 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  802152:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  802157:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  80215e:	00 00 00 
+  802161:	48 69 d0 d0 01 00 00 	imul   $0x1d0,%rax,%rdx
+  802168:	48 01 ca             	add    %rcx,%rdx
+  80216b:	8b 92 e8 00 00 00    	mov    0xe8(%rdx),%edx
+  802171:	39 fa                	cmp    %edi,%edx
+  802173:	74 12                	je     802187 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  802175:	48 83 c0 01          	add    $0x1,%rax
+  802179:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  80217f:	75 e0                	jne    802161 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  802181:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802186:	c3                   	ret
+            return envs[i].env_id;
+  802187:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+  80218e:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  802195:	00 00 00 
+  802198:	48 01 d0             	add    %rdx,%rax
+  80219b:	8b 80 e0 00 00 00    	mov    0xe0(%rax),%eax
+  8021a1:	c3                   	ret
+
+00000000008021a2 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8021a2:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8021a9:	ff ff ff 
+  8021ac:	48 01 f8             	add    %rdi,%rax
+  8021af:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  8021b3:	c3                   	ret
+
+00000000008021b4 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8021b4:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8021bb:	ff ff ff 
+  8021be:	48 01 f8             	add    %rdi,%rax
+  8021c1:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  8021c5:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  8021cb:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  8021cf:	c3                   	ret
+
+00000000008021d0 <fd_alloc_from>:
+}
+
+/* Like fd_alloc(), but only considers fds starting from fdnum,
+ * so that several fds can be found before their pages are allocated */
+int
+fd_alloc_from(int fdnum, struct Fd **fd_store) {
+  8021d0:	55                   	push   %rbp
+  8021d1:	48 89 e5             	mov    %rsp,%rbp
+  8021d4:	41 57                	push   %r15
+  8021d6:	41 56                	push   %r14
+  8021d8:	41 55                	push   %r13
+  8021da:	41 54                	push   %r12
+  8021dc:	53                   	push   %rbx
+  8021dd:	48 83 ec 08          	sub    $0x8,%rsp
+  8021e1:	49 89 f7             	mov    %rsi,%r15
+    for (int i = MAX(fdnum, 0); i < MAXFD; i++) {
+  8021e4:	85 ff                	test   %edi,%edi
+  8021e6:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8021ec:	44 0f 49 e7          	cmovns %edi,%r12d
+  8021f0:	83 ff 1f             	cmp    $0x1f,%edi
+  8021f3:	7f 37                	jg     80222c <fd_alloc_from+0x5c>
+  8021f5:	49 63 dc             	movslq %r12d,%rbx
+  8021f8:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  8021ff:	48 c1 e3 0c          	shl    $0xc,%rbx
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  802203:	49 be d9 32 80 00 00 	movabs $0x8032d9,%r14
+  80220a:	00 00 00 
+        struct Fd *fd = INDEX2FD(i);
+  80220d:	49 89 dd             	mov    %rbx,%r13
+        if (!(get_prot(fd) & PROT_R)) {
+  802210:	48 89 df             	mov    %rbx,%rdi
+  802213:	41 ff d6             	call   *%r14
+  802216:	83 e0 04             	and    $0x4,%eax
+  802219:	74 1c                	je     802237 <fd_alloc_from+0x67>
+    for (int i = MAX(fdnum, 0); i < MAXFD; i++) {
+  80221b:	41 83 c4 01          	add    $0x1,%r12d
+  80221f:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802226:	41 83 fc 1f          	cmp    $0x1f,%r12d
+  80222a:	7e e1                	jle    80220d <fd_alloc_from+0x3d>
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  80222c:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  802232:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  802237:	4d 89 2f             	mov    %r13,(%r15)
+}
+  80223a:	48 83 c4 08          	add    $0x8,%rsp
+  80223e:	5b                   	pop    %rbx
+  80223f:	41 5c                	pop    %r12
+  802241:	41 5d                	pop    %r13
+  802243:	41 5e                	pop    %r14
+  802245:	41 5f                	pop    %r15
+  802247:	5d                   	pop    %rbp
+  802248:	c3                   	ret
+
+0000000000802249 <fd_alloc>:
+fd_alloc(struct Fd **fd_store) {
+  802249:	55                   	push   %rbp
+  80224a:	48 89 e5             	mov    %rsp,%rbp
+  80224d:	48 89 fe             	mov    %rdi,%rsi
+    return fd_alloc_from(0, fd_store);
+  802250:	bf 00 00 00 00       	mov    $0x0,%edi
+  802255:	48 b8 d0 21 80 00 00 	movabs $0x8021d0,%rax
+  80225c:	00 00 00 
+  80225f:	ff d0                	call   *%rax
+}
+  802261:	5d                   	pop    %rbp
+  802262:	c3                   	ret
+
+0000000000802263 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  802263:	83 ff 1f             	cmp    $0x1f,%edi
+  802266:	77 39                	ja     8022a1 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  802268:	55                   	push   %rbp
+  802269:	48 89 e5             	mov    %rsp,%rbp
+  80226c:	41 54                	push   %r12
+  80226e:	53                   	push   %rbx
+  80226f:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  802272:	48 63 df             	movslq %edi,%rbx
+  802275:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  80227c:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  802280:	48 89 df             	mov    %rbx,%rdi
+  802283:	48 b8 d9 32 80 00 00 	movabs $0x8032d9,%rax
+  80228a:	00 00 00 
+  80228d:	ff d0                	call   *%rax
+  80228f:	a8 04                	test   $0x4,%al
+  802291:	74 14                	je     8022a7 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  802293:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  802297:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80229c:	5b                   	pop    %rbx
+  80229d:	41 5c                	pop    %r12
+  80229f:	5d                   	pop    %rbp
+  8022a0:	c3                   	ret
+        return -E_INVAL;
+  8022a1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8022a6:	c3                   	ret
+        return -E_INVAL;
+  8022a7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8022ac:	eb ee                	jmp    80229c <fd_lookup+0x39>
+
+00000000008022ae <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  8022ae:	55                   	push   %rbp
+  8022af:	48 89 e5             	mov    %rsp,%rbp
+  8022b2:	41 54                	push   %r12
+  8022b4:	53                   	push   %rbx
+  8022b5:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  8022b8:	48 b8 40 41 80 00 00 	movabs $0x804140,%rax
+  8022bf:	00 00 00 
+  8022c2:	48 bb 20 50 80 00 00 	movabs $0x805020,%rbx
+  8022c9:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  8022cc:	39 3b                	cmp    %edi,(%rbx)
+  8022ce:	74 47                	je     802317 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  8022d0:	48 83 c0 08          	add    $0x8,%rax
+  8022d4:	48 8b 18             	mov    (%rax),%rbx
+  8022d7:	48 85 db             	test   %rbx,%rbx
+  8022da:	75 f0                	jne    8022cc <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8022dc:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  8022e3:	00 00 00 
+  8022e6:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+  8022ec:	89 fa                	mov    %edi,%edx
+  8022ee:	48 bf a8 40 80 00 00 	movabs $0x8040a8,%rdi
+  8022f5:	00 00 00 
+  8022f8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022fd:	48 b9 ca 0c 80 00 00 	movabs $0x800cca,%rcx
+  802304:	00 00 00 
+  802307:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  802309:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  80230e:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  802312:	5b                   	pop    %rbx
+  802313:	41 5c                	pop    %r12
+  802315:	5d                   	pop    %rbp
+  802316:	c3                   	ret
+            return 0;
+  802317:	b8 00 00 00 00       	mov    $0x0,%eax
+  80231c:	eb f0                	jmp    80230e <dev_lookup+0x60>
+
+000000000080231e <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  80231e:	55                   	push   %rbp
+  80231f:	48 89 e5             	mov    %rsp,%rbp
+  802322:	41 55                	push   %r13
+  802324:	41 54                	push   %r12
+  802326:	53                   	push   %rbx
+  802327:	48 83 ec 18          	sub    $0x18,%rsp
+  80232b:	48 89 fb             	mov    %rdi,%rbx
+  80232e:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  802331:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  802338:	ff ff ff 
+  80233b:	48 01 df             	add    %rbx,%rdi
+  80233e:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  802342:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802346:	48 b8 63 22 80 00 00 	movabs $0x802263,%rax
+  80234d:	00 00 00 
+  802350:	ff d0                	call   *%rax
+  802352:	41 89 c5             	mov    %eax,%r13d
+  802355:	85 c0                	test   %eax,%eax
+  802357:	78 06                	js     80235f <fd_close+0x41>
+  802359:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  80235d:	74 1a                	je     802379 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  80235f:	45 84 e4             	test   %r12b,%r12b
+  802362:	b8 00 00 00 00       	mov    $0x0,%eax
+  802367:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  80236b:	44 89 e8             	mov    %r13d,%eax
+  80236e:	48 83 c4 18          	add    $0x18,%rsp
+  802372:	5b                   	pop    %rbx
+  802373:	41 5c                	pop    %r12
+  802375:	41 5d                	pop    %r13
+  802377:	5d                   	pop    %rbp
+  802378:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  802379:	8b 3b                	mov    (%rbx),%edi
+  80237b:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80237f:	48 b8 ae 22 80 00 00 	movabs $0x8022ae,%rax
+  802386:	00 00 00 
+  802389:	ff d0                	call   *%rax
+  80238b:	41 89 c5             	mov    %eax,%r13d
+  80238e:	85 c0                	test   %eax,%eax
+  802390:	78 1b                	js     8023ad <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  802392:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802396:	48 8b 40 20          	mov    0x20(%rax),%rax
+  80239a:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  8023a0:	48 85 c0             	test   %rax,%rax
+  8023a3:	74 08                	je     8023ad <fd_close+0x8f>
+  8023a5:	48 89 df             	mov    %rbx,%rdi
+  8023a8:	ff d0                	call   *%rax
+  8023aa:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8023ad:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8023b2:	48 89 de             	mov    %rbx,%rsi
+  8023b5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8023ba:	48 b8 6b 1c 80 00 00 	movabs $0x801c6b,%rax
+  8023c1:	00 00 00 
+  8023c4:	ff d0                	call   *%rax
+    return res;
+  8023c6:	eb a3                	jmp    80236b <fd_close+0x4d>
+
+00000000008023c8 <close>:
+
+int
+close(int fdnum) {
+  8023c8:	55                   	push   %rbp
+  8023c9:	48 89 e5             	mov    %rsp,%rbp
+  8023cc:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  8023d0:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8023d4:	48 b8 63 22 80 00 00 	movabs $0x802263,%rax
+  8023db:	00 00 00 
+  8023de:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8023e0:	85 c0                	test   %eax,%eax
+  8023e2:	78 15                	js     8023f9 <close+0x31>
+
+    return fd_close(fd, 1);
+  8023e4:	be 01 00 00 00       	mov    $0x1,%esi
+  8023e9:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8023ed:	48 b8 1e 23 80 00 00 	movabs $0x80231e,%rax
+  8023f4:	00 00 00 
+  8023f7:	ff d0                	call   *%rax
+}
+  8023f9:	c9                   	leave
+  8023fa:	c3                   	ret
+
+00000000008023fb <close_all>:
+
+void
+close_all(void) {
+  8023fb:	55                   	push   %rbp
+  8023fc:	48 89 e5             	mov    %rsp,%rbp
+  8023ff:	41 54                	push   %r12
+  802401:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  802402:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802407:	49 bc c8 23 80 00 00 	movabs $0x8023c8,%r12
+  80240e:	00 00 00 
+  802411:	89 df                	mov    %ebx,%edi
+  802413:	41 ff d4             	call   *%r12
+  802416:	83 c3 01             	add    $0x1,%ebx
+  802419:	83 fb 20             	cmp    $0x20,%ebx
+  80241c:	75 f3                	jne    802411 <close_all+0x16>
+}
+  80241e:	5b                   	pop    %rbx
+  80241f:	41 5c                	pop    %r12
+  802421:	5d                   	pop    %rbp
+  802422:	c3                   	ret
+
+0000000000802423 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  802423:	55                   	push   %rbp
+  802424:	48 89 e5             	mov    %rsp,%rbp
+  802427:	41 57                	push   %r15
+  802429:	41 56                	push   %r14
+  80242b:	41 55                	push   %r13
+  80242d:	41 54                	push   %r12
+  80242f:	53                   	push   %rbx
+  802430:	48 83 ec 18          	sub    $0x18,%rsp
+  802434:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  802437:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  80243b:	48 b8 63 22 80 00 00 	movabs $0x802263,%rax
+  802442:	00 00 00 
+  802445:	ff d0                	call   *%rax
+  802447:	89 c3                	mov    %eax,%ebx
+  802449:	85 c0                	test   %eax,%eax
+  80244b:	0f 88 b8 00 00 00    	js     802509 <dup+0xe6>
+    close(newfdnum);
+  802451:	44 89 e7             	mov    %r12d,%edi
+  802454:	48 b8 c8 23 80 00 00 	movabs $0x8023c8,%rax
+  80245b:	00 00 00 
+  80245e:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  802460:	4d 63 ec             	movslq %r12d,%r13
+  802463:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  80246a:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  80246e:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  802472:	4c 89 ff             	mov    %r15,%rdi
+  802475:	49 be b4 21 80 00 00 	movabs $0x8021b4,%r14
+  80247c:	00 00 00 
+  80247f:	41 ff d6             	call   *%r14
+  802482:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  802485:	4c 89 ef             	mov    %r13,%rdi
+  802488:	41 ff d6             	call   *%r14
+  80248b:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  80248e:	48 89 df             	mov    %rbx,%rdi
+  802491:	48 b8 d9 32 80 00 00 	movabs $0x8032d9,%rax
+  802498:	00 00 00 
+  80249b:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  80249d:	a8 04                	test   $0x4,%al
+  80249f:	74 2b                	je     8024cc <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  8024a1:	41 89 c1             	mov    %eax,%r9d
+  8024a4:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8024aa:	4c 89 f1             	mov    %r14,%rcx
+  8024ad:	ba 00 00 00 00       	mov    $0x0,%edx
+  8024b2:	48 89 de             	mov    %rbx,%rsi
+  8024b5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8024ba:	48 b8 06 1c 80 00 00 	movabs $0x801c06,%rax
+  8024c1:	00 00 00 
+  8024c4:	ff d0                	call   *%rax
+  8024c6:	89 c3                	mov    %eax,%ebx
+  8024c8:	85 c0                	test   %eax,%eax
+  8024ca:	78 4e                	js     80251a <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  8024cc:	4c 89 ff             	mov    %r15,%rdi
+  8024cf:	48 b8 d9 32 80 00 00 	movabs $0x8032d9,%rax
+  8024d6:	00 00 00 
+  8024d9:	ff d0                	call   *%rax
+  8024db:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  8024de:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8024e4:	4c 89 e9             	mov    %r13,%rcx
+  8024e7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8024ec:	4c 89 fe             	mov    %r15,%rsi
+  8024ef:	bf 00 00 00 00       	mov    $0x0,%edi
+  8024f4:	48 b8 06 1c 80 00 00 	movabs $0x801c06,%rax
+  8024fb:	00 00 00 
+  8024fe:	ff d0                	call   *%rax
+  802500:	89 c3                	mov    %eax,%ebx
+  802502:	85 c0                	test   %eax,%eax
+  802504:	78 14                	js     80251a <dup+0xf7>
+
+    return newfdnum;
+  802506:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  802509:	89 d8                	mov    %ebx,%eax
+  80250b:	48 83 c4 18          	add    $0x18,%rsp
+  80250f:	5b                   	pop    %rbx
+  802510:	41 5c                	pop    %r12
+  802512:	41 5d                	pop    %r13
+  802514:	41 5e                	pop    %r14
+  802516:	41 5f                	pop    %r15
+  802518:	5d                   	pop    %rbp
+  802519:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  80251a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80251f:	4c 89 ee             	mov    %r13,%rsi
+  802522:	bf 00 00 00 00       	mov    $0x0,%edi
+  802527:	49 bc 6b 1c 80 00 00 	movabs $0x801c6b,%r12
+  80252e:	00 00 00 
+  802531:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  802534:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802539:	4c 89 f6             	mov    %r14,%rsi
+  80253c:	bf 00 00 00 00       	mov    $0x0,%edi
+  802541:	41 ff d4             	call   *%r12
+    return res;
+  802544:	eb c3                	jmp    802509 <dup+0xe6>
+
+0000000000802546 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  802546:	55                   	push   %rbp
+  802547:	48 89 e5             	mov    %rsp,%rbp
+  80254a:	41 56                	push   %r14
+  80254c:	41 55                	push   %r13
+  80254e:	41 54                	push   %r12
+  802550:	53                   	push   %rbx
+  802551:	48 83 ec 10          	sub    $0x10,%rsp
+  802555:	89 fb                	mov    %edi,%ebx
+  802557:	49 89 f4             	mov    %rsi,%r12
+  80255a:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80255d:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802561:	48 b8 63 22 80 00 00 	movabs $0x802263,%rax
+  802568:	00 00 00 
+  80256b:	ff d0                	call   *%rax
+  80256d:	85 c0                	test   %eax,%eax
+  80256f:	78 4c                	js     8025bd <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802571:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  802575:	41 8b 3e             	mov    (%r14),%edi
+  802578:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80257c:	48 b8 ae 22 80 00 00 	movabs $0x8022ae,%rax
+  802583:	00 00 00 
+  802586:	ff d0                	call   *%rax
+  802588:	85 c0                	test   %eax,%eax
+  80258a:	78 35                	js     8025c1 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  80258c:	41 8b 46 08          	mov    0x8(%r14),%eax
+  802590:	83 e0 03             	and    $0x3,%eax
+  802593:	83 f8 01             	cmp    $0x1,%eax
+  802596:	74 2d                	je     8025c5 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  802598:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80259c:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8025a0:	48 85 c0             	test   %rax,%rax
+  8025a3:	74 56                	je     8025fb <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  8025a5:	4c 89 ea             	mov    %r13,%rdx
+  8025a8:	4c 89 e6             	mov    %r12,%rsi
+  8025ab:	4c 89 f7             	mov    %r14,%rdi
+  8025ae:	ff d0                	call   *%rax
+}
+  8025b0:	48 83 c4 10          	add    $0x10,%rsp
+  8025b4:	5b                   	pop    %rbx
+  8025b5:	41 5c                	pop    %r12
+  8025b7:	41 5d                	pop    %r13
+  8025b9:	41 5e                	pop    %r14
+  8025bb:	5d                   	pop    %rbp
+  8025bc:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8025bd:	48 98                	cltq
+  8025bf:	eb ef                	jmp    8025b0 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8025c1:	48 98                	cltq
+  8025c3:	eb eb                	jmp    8025b0 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8025c5:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  8025cc:	00 00 00 
+  8025cf:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+  8025d5:	89 da                	mov    %ebx,%edx
+  8025d7:	48 bf e9 40 80 00 00 	movabs $0x8040e9,%rdi
+  8025de:	00 00 00 
+  8025e1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025e6:	48 b9 ca 0c 80 00 00 	movabs $0x800cca,%rcx
+  8025ed:	00 00 00 
+  8025f0:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8025f2:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8025f9:	eb b5                	jmp    8025b0 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  8025fb:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  802602:	eb ac                	jmp    8025b0 <read+0x6a>
+
+0000000000802604 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  802604:	55                   	push   %rbp
+  802605:	48 89 e5             	mov    %rsp,%rbp
+  802608:	41 57                	push   %r15
+  80260a:	41 56                	push   %r14
+  80260c:	41 55                	push   %r13
+  80260e:	41 54                	push   %r12
+  802610:	53                   	push   %rbx
+  802611:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  802615:	48 85 d2             	test   %rdx,%rdx
+  802618:	74 54                	je     80266e <readn+0x6a>
+  80261a:	41 89 fd             	mov    %edi,%r13d
+  80261d:	49 89 f6             	mov    %rsi,%r14
+  802620:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  802623:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  802628:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  80262d:	49 bf 46 25 80 00 00 	movabs $0x802546,%r15
+  802634:	00 00 00 
+  802637:	4c 89 e2             	mov    %r12,%rdx
+  80263a:	48 29 f2             	sub    %rsi,%rdx
+  80263d:	4c 01 f6             	add    %r14,%rsi
+  802640:	44 89 ef             	mov    %r13d,%edi
+  802643:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  802646:	85 c0                	test   %eax,%eax
+  802648:	78 20                	js     80266a <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  80264a:	01 c3                	add    %eax,%ebx
+  80264c:	85 c0                	test   %eax,%eax
+  80264e:	74 08                	je     802658 <readn+0x54>
+  802650:	48 63 f3             	movslq %ebx,%rsi
+  802653:	4c 39 e6             	cmp    %r12,%rsi
+  802656:	72 df                	jb     802637 <readn+0x33>
+    }
+    return res;
+  802658:	48 63 c3             	movslq %ebx,%rax
+}
+  80265b:	48 83 c4 08          	add    $0x8,%rsp
+  80265f:	5b                   	pop    %rbx
+  802660:	41 5c                	pop    %r12
+  802662:	41 5d                	pop    %r13
+  802664:	41 5e                	pop    %r14
+  802666:	41 5f                	pop    %r15
+  802668:	5d                   	pop    %rbp
+  802669:	c3                   	ret
+        if (inc < 0) return inc;
+  80266a:	48 98                	cltq
+  80266c:	eb ed                	jmp    80265b <readn+0x57>
+    int inc = 1, res = 0;
+  80266e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802673:	eb e3                	jmp    802658 <readn+0x54>
+
+0000000000802675 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  802675:	55                   	push   %rbp
+  802676:	48 89 e5             	mov    %rsp,%rbp
+  802679:	41 56                	push   %r14
+  80267b:	41 55                	push   %r13
+  80267d:	41 54                	push   %r12
+  80267f:	53                   	push   %rbx
+  802680:	48 83 ec 10          	sub    $0x10,%rsp
+  802684:	89 fb                	mov    %edi,%ebx
+  802686:	49 89 f4             	mov    %rsi,%r12
+  802689:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80268c:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802690:	48 b8 63 22 80 00 00 	movabs $0x802263,%rax
+  802697:	00 00 00 
+  80269a:	ff d0                	call   *%rax
+  80269c:	85 c0                	test   %eax,%eax
+  80269e:	78 47                	js     8026e7 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8026a0:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  8026a4:	41 8b 3e             	mov    (%r14),%edi
+  8026a7:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8026ab:	48 b8 ae 22 80 00 00 	movabs $0x8022ae,%rax
+  8026b2:	00 00 00 
+  8026b5:	ff d0                	call   *%rax
+  8026b7:	85 c0                	test   %eax,%eax
+  8026b9:	78 30                	js     8026eb <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8026bb:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  8026c0:	74 2d                	je     8026ef <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  8026c2:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8026c6:	48 8b 40 18          	mov    0x18(%rax),%rax
+  8026ca:	48 85 c0             	test   %rax,%rax
+  8026cd:	74 56                	je     802725 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  8026cf:	4c 89 ea             	mov    %r13,%rdx
+  8026d2:	4c 89 e6             	mov    %r12,%rsi
+  8026d5:	4c 89 f7             	mov    %r14,%rdi
+  8026d8:	ff d0                	call   *%rax
+}
+  8026da:	48 83 c4 10          	add    $0x10,%rsp
+  8026de:	5b                   	pop    %rbx
+  8026df:	41 5c                	pop    %r12
+  8026e1:	41 5d                	pop    %r13
+  8026e3:	41 5e                	pop    %r14
+  8026e5:	5d                   	pop    %rbp
+  8026e6:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8026e7:	48 98                	cltq
+  8026e9:	eb ef                	jmp    8026da <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8026eb:	48 98                	cltq
+  8026ed:	eb eb                	jmp    8026da <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8026ef:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  8026f6:	00 00 00 
+  8026f9:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+  8026ff:	89 da                	mov    %ebx,%edx
+  802701:	48 bf 05 41 80 00 00 	movabs $0x804105,%rdi
+  802708:	00 00 00 
+  80270b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802710:	48 b9 ca 0c 80 00 00 	movabs $0x800cca,%rcx
+  802717:	00 00 00 
+  80271a:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  80271c:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802723:	eb b5                	jmp    8026da <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  802725:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  80272c:	eb ac                	jmp    8026da <write+0x65>
+
+000000000080272e <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  80272e:	55                   	push   %rbp
+  80272f:	48 89 e5             	mov    %rsp,%rbp
+  802732:	53                   	push   %rbx
+  802733:	48 83 ec 18          	sub    $0x18,%rsp
+  802737:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802739:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80273d:	48 b8 63 22 80 00 00 	movabs $0x802263,%rax
+  802744:	00 00 00 
+  802747:	ff d0                	call   *%rax
+  802749:	85 c0                	test   %eax,%eax
+  80274b:	78 0c                	js     802759 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  80274d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802751:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  802754:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802759:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80275d:	c9                   	leave
+  80275e:	c3                   	ret
+
+000000000080275f <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  80275f:	55                   	push   %rbp
+  802760:	48 89 e5             	mov    %rsp,%rbp
+  802763:	41 55                	push   %r13
+  802765:	41 54                	push   %r12
+  802767:	53                   	push   %rbx
+  802768:	48 83 ec 18          	sub    $0x18,%rsp
+  80276c:	89 fb                	mov    %edi,%ebx
+  80276e:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802771:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802775:	48 b8 63 22 80 00 00 	movabs $0x802263,%rax
+  80277c:	00 00 00 
+  80277f:	ff d0                	call   *%rax
+  802781:	85 c0                	test   %eax,%eax
+  802783:	78 38                	js     8027bd <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802785:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  802789:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  80278d:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802791:	48 b8 ae 22 80 00 00 	movabs $0x8022ae,%rax
+  802798:	00 00 00 
+  80279b:	ff d0                	call   *%rax
+  80279d:	85 c0                	test   %eax,%eax
+  80279f:	78 1c                	js     8027bd <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8027a1:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  8027a6:	74 20                	je     8027c8 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  8027a8:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8027ac:	48 8b 40 30          	mov    0x30(%rax),%rax
+  8027b0:	48 85 c0             	test   %rax,%rax
+  8027b3:	74 47                	je     8027fc <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  8027b5:	44 89 e6             	mov    %r12d,%esi
+  8027b8:	4c 89 ef             	mov    %r13,%rdi
+  8027bb:	ff d0                	call   *%rax
+}
+  8027bd:	48 83 c4 18          	add    $0x18,%rsp
+  8027c1:	5b                   	pop    %rbx
+  8027c2:	41 5c                	pop    %r12
+  8027c4:	41 5d                	pop    %r13
+  8027c6:	5d                   	pop    %rbp
+  8027c7:	c3                   	ret
+                thisenv->env_id, fdnum);
+  8027c8:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  8027cf:	00 00 00 
+  8027d2:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8027d8:	89 da                	mov    %ebx,%edx
+  8027da:	48 bf c8 40 80 00 00 	movabs $0x8040c8,%rdi
+  8027e1:	00 00 00 
+  8027e4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027e9:	48 b9 ca 0c 80 00 00 	movabs $0x800cca,%rcx
+  8027f0:	00 00 00 
+  8027f3:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8027f5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8027fa:	eb c1                	jmp    8027bd <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  8027fc:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802801:	eb ba                	jmp    8027bd <ftruncate+0x5e>
+
+0000000000802803 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  802803:	55                   	push   %rbp
+  802804:	48 89 e5             	mov    %rsp,%rbp
+  802807:	41 54                	push   %r12
+  802809:	53                   	push   %rbx
+  80280a:	48 83 ec 10          	sub    $0x10,%rsp
+  80280e:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802811:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802815:	48 b8 63 22 80 00 00 	movabs $0x802263,%rax
+  80281c:	00 00 00 
+  80281f:	ff d0                	call   *%rax
+  802821:	85 c0                	test   %eax,%eax
+  802823:	78 4e                	js     802873 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802825:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  802829:	41 8b 3c 24          	mov    (%r12),%edi
+  80282d:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  802831:	48 b8 ae 22 80 00 00 	movabs $0x8022ae,%rax
+  802838:	00 00 00 
+  80283b:	ff d0                	call   *%rax
+  80283d:	85 c0                	test   %eax,%eax
+  80283f:	78 32                	js     802873 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  802841:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802845:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  80284a:	74 30                	je     80287c <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  80284c:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  80284f:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  802856:	00 00 00 
+    stat->st_isdir = 0;
+  802859:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  802860:	00 00 00 
+    stat->st_dev = dev;
+  802863:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  80286a:	48 89 de             	mov    %rbx,%rsi
+  80286d:	4c 89 e7             	mov    %r12,%rdi
+  802870:	ff 50 28             	call   *0x28(%rax)
+}
+  802873:	48 83 c4 10          	add    $0x10,%rsp
+  802877:	5b                   	pop    %rbx
+  802878:	41 5c                	pop    %r12
+  80287a:	5d                   	pop    %rbp
+  80287b:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  80287c:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802881:	eb f0                	jmp    802873 <fstat+0x70>
+
+0000000000802883 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  802883:	55                   	push   %rbp
+  802884:	48 89 e5             	mov    %rsp,%rbp
+  802887:	41 54                	push   %r12
+  802889:	53                   	push   %rbx
+  80288a:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  80288d:	be 00 00 00 00       	mov    $0x0,%esi
+  802892:	48 b8 66 2c 80 00 00 	movabs $0x802c66,%rax
+  802899:	00 00 00 
+  80289c:	ff d0                	call   *%rax
+  80289e:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  8028a0:	85 c0                	test   %eax,%eax
+  8028a2:	78 25                	js     8028c9 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  8028a4:	4c 89 e6             	mov    %r12,%rsi
+  8028a7:	89 c7                	mov    %eax,%edi
+  8028a9:	48 b8 03 28 80 00 00 	movabs $0x802803,%rax
+  8028b0:	00 00 00 
+  8028b3:	ff d0                	call   *%rax
+  8028b5:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  8028b8:	89 df                	mov    %ebx,%edi
+  8028ba:	48 b8 c8 23 80 00 00 	movabs $0x8023c8,%rax
+  8028c1:	00 00 00 
+  8028c4:	ff d0                	call   *%rax
+
+    return res;
+  8028c6:	44 89 e3             	mov    %r12d,%ebx
+}
+  8028c9:	89 d8                	mov    %ebx,%eax
+  8028cb:	5b                   	pop    %rbx
+  8028cc:	41 5c                	pop    %r12
+  8028ce:	5d                   	pop    %rbp
+  8028cf:	c3                   	ret
+
+00000000008028d0 <fsipc>:
+ * response may be written back to fsipcbuf.
+ * type: request code, passed as the simple integer IPC value.
+ * dstva: virtual address at which to receive reply page, 0 if none.
+ * Returns result from the file server. */
+static int
+fsipc(unsigned type, void *dstva) {
+  8028d0:	55                   	push   %rbp
+  8028d1:	48 89 e5             	mov    %rsp,%rbp
+  8028d4:	41 54                	push   %r12
+  8028d6:	53                   	push   %rbx
+  8028d7:	48 83 ec 10          	sub    $0x10,%rsp
+  8028db:	41 89 fc             	mov    %edi,%r12d
+  8028de:	48 89 f3             	mov    %rsi,%rbx
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8028e1:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  8028e8:	00 00 00 
+  8028eb:	83 38 00             	cmpl   $0x0,(%rax)
+  8028ee:	74 5e                	je     80294e <fsipc+0x7e>
+    if (debug) {
+        cprintf("[%08x] fsipc %d %08x\n",
+                thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+    }
+
+    ipc_send(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW);
+  8028f0:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8028f6:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8028fb:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  802902:	00 00 00 
+  802905:	44 89 e6             	mov    %r12d,%esi
+  802908:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  80290f:	00 00 00 
+  802912:	8b 38                	mov    (%rax),%edi
+  802914:	48 b8 af 20 80 00 00 	movabs $0x8020af,%rax
+  80291b:	00 00 00 
+  80291e:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  802920:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  802927:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  802928:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80292d:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  802931:	48 89 de             	mov    %rbx,%rsi
+  802934:	bf 00 00 00 00       	mov    $0x0,%edi
+  802939:	48 b8 da 1f 80 00 00 	movabs $0x801fda,%rax
+  802940:	00 00 00 
+  802943:	ff d0                	call   *%rax
+}
+  802945:	48 83 c4 10          	add    $0x10,%rsp
+  802949:	5b                   	pop    %rbx
+  80294a:	41 5c                	pop    %r12
+  80294c:	5d                   	pop    %rbp
+  80294d:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  80294e:	bf 03 00 00 00       	mov    $0x3,%edi
+  802953:	48 b8 52 21 80 00 00 	movabs $0x802152,%rax
+  80295a:	00 00 00 
+  80295d:	ff d0                	call   *%rax
+  80295f:	a3 00 80 80 00 00 00 	movabs %eax,0x808000
+  802966:	00 00 
+  802968:	eb 86                	jmp    8028f0 <fsipc+0x20>
+
+000000000080296a <devfile_trunc>:
+    return 0;
+}
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  80296a:	55                   	push   %rbp
+  80296b:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  80296e:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  802975:	00 00 00 
+  802978:	8b 57 0c             	mov    0xc(%rdi),%edx
+  80297b:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  80297d:	89 70 04             	mov    %esi,0x4(%rax)
+
+    return fsipc(FSREQ_SET_SIZE, NULL);
+  802980:	be 00 00 00 00       	mov    $0x0,%esi
+  802985:	bf 02 00 00 00       	mov    $0x2,%edi
+  80298a:	48 b8 d0 28 80 00 00 	movabs $0x8028d0,%rax
+  802991:	00 00 00 
+  802994:	ff d0                	call   *%rax
+}
+  802996:	5d                   	pop    %rbp
+  802997:	c3                   	ret
+
+0000000000802998 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  802998:	55                   	push   %rbp
+  802999:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  80299c:	8b 47 0c             	mov    0xc(%rdi),%eax
+  80299f:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  8029a6:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  8029a8:	be 00 00 00 00       	mov    $0x0,%esi
+  8029ad:	bf 06 00 00 00       	mov    $0x6,%edi
+  8029b2:	48 b8 d0 28 80 00 00 	movabs $0x8028d0,%rax
+  8029b9:	00 00 00 
+  8029bc:	ff d0                	call   *%rax
+}
+  8029be:	5d                   	pop    %rbp
+  8029bf:	c3                   	ret
+
+00000000008029c0 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  8029c0:	55                   	push   %rbp
+  8029c1:	48 89 e5             	mov    %rsp,%rbp
+  8029c4:	41 54                	push   %r12
+  8029c6:	53                   	push   %rbx
+  8029c7:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8029ca:	8b 47 0c             	mov    0xc(%rdi),%eax
+  8029cd:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  8029d4:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  8029d6:	be 00 00 00 00       	mov    $0x0,%esi
+  8029db:	bf 05 00 00 00       	mov    $0x5,%edi
+  8029e0:	48 b8 d0 28 80 00 00 	movabs $0x8028d0,%rax
+  8029e7:	00 00 00 
+  8029ea:	ff d0                	call   *%rax
+    if (res < 0) {
+  8029ec:	85 c0                	test   %eax,%eax
+  8029ee:	78 3d                	js     802a2d <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8029f0:	49 bc 00 70 80 00 00 	movabs $0x807000,%r12
+  8029f7:	00 00 00 
+  8029fa:	4c 89 e6             	mov    %r12,%rsi
+  8029fd:	48 89 df             	mov    %rbx,%rdi
+  802a00:	48 b8 ef 15 80 00 00 	movabs $0x8015ef,%rax
+  802a07:	00 00 00 
+  802a0a:	ff d0                	call   *%rax
+    st->st_size  = fsipcbuf.statRet.ret_size;
+  802a0c:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  802a13:	00 
+  802a14:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802a1a:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  802a21:	00 
+  802a22:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  802a28:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802a2d:	5b                   	pop    %rbx
+  802a2e:	41 5c                	pop    %r12
+  802a30:	5d                   	pop    %rbp
+  802a31:	c3                   	ret
+
+0000000000802a32 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  802a32:	55                   	push   %rbp
+  802a33:	48 89 e5             	mov    %rsp,%rbp
+  802a36:	41 57                	push   %r15
+  802a38:	41 56                	push   %r14
+  802a3a:	41 55                	push   %r13
+  802a3c:	41 54                	push   %r12
+  802a3e:	53                   	push   %rbx
+  802a3f:	48 83 ec 18          	sub    $0x18,%rsp
+  802a43:	49 89 fe             	mov    %rdi,%r14
+  802a46:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+  802a4a:	48 89 d3             	mov    %rdx,%rbx
+    while (n > sizeof(fsipcbuf.write.req_buf))
+  802a4d:	48 81 fa f0 0f 00 00 	cmp    $0xff0,%rdx
+  802a54:	0f 86 e4 00 00 00    	jbe    802b3e <devfile_write+0x10c>
+  802a5a:	49 89 f4             	mov    %rsi,%r12
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802a5d:	49 bd 00 70 80 00 00 	movabs $0x807000,%r13
+  802a64:	00 00 00 
+        memcpy(fsipcbuf.write.req_buf, buf, sizeof(fsipcbuf.write.req_buf));
+  802a67:	49 bf 50 18 80 00 00 	movabs $0x801850,%r15
+  802a6e:	00 00 00 
+  802a71:	eb 03                	jmp    802a76 <devfile_write+0x44>
+        buf += sizeof(fsipcbuf.write.req_buf);
+  802a73:	49 89 f4             	mov    %rsi,%r12
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802a76:	41 8b 46 0c          	mov    0xc(%r14),%eax
+  802a7a:	41 89 45 00          	mov    %eax,0x0(%r13)
+        fsipcbuf.write.req_n      = sizeof(fsipcbuf.write.req_buf);
+  802a7e:	49 c7 45 08 f0 0f 00 	movq   $0xff0,0x8(%r13)
+  802a85:	00 
+        memcpy(fsipcbuf.write.req_buf, buf, sizeof(fsipcbuf.write.req_buf));
+  802a86:	ba f0 0f 00 00       	mov    $0xff0,%edx
+  802a8b:	4c 89 e6             	mov    %r12,%rsi
+  802a8e:	48 bf 10 70 80 00 00 	movabs $0x807010,%rdi
+  802a95:	00 00 00 
+  802a98:	41 ff d7             	call   *%r15
+        ssize_t res = fsipc(FSREQ_WRITE, NULL);
+  802a9b:	be 00 00 00 00       	mov    $0x0,%esi
+  802aa0:	bf 04 00 00 00       	mov    $0x4,%edi
+  802aa5:	48 b8 d0 28 80 00 00 	movabs $0x8028d0,%rax
+  802aac:	00 00 00 
+  802aaf:	ff d0                	call   *%rax
+  802ab1:	48 63 d0             	movslq %eax,%rdx
+        if (res < 0 || res < sizeof(fsipcbuf.write.req_buf))
+  802ab4:	3d ef 0f 00 00       	cmp    $0xfef,%eax
+  802ab9:	7e 71                	jle    802b2c <devfile_write+0xfa>
+        buf += sizeof(fsipcbuf.write.req_buf);
+  802abb:	49 8d b4 24 f0 0f 00 	lea    0xff0(%r12),%rsi
+  802ac2:	00 
+        n -= sizeof(fsipcbuf.write.req_buf);
+  802ac3:	48 81 eb f0 0f 00 00 	sub    $0xff0,%rbx
+    while (n > sizeof(fsipcbuf.write.req_buf))
+  802aca:	48 81 fb f0 0f 00 00 	cmp    $0xff0,%rbx
+  802ad1:	77 a0                	ja     802a73 <devfile_write+0x41>
+        written += sizeof(fsipcbuf.write.req_buf);
+  802ad3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802ad7:	49 29 c4             	sub    %rax,%r12
+  802ada:	4d 8d a4 24 f0 0f 00 	lea    0xff0(%r12),%r12
+  802ae1:	00 
+    fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802ae2:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  802ae9:	00 00 00 
+  802aec:	41 8b 56 0c          	mov    0xc(%r14),%edx
+  802af0:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.write.req_n      = n;
+  802af2:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    memcpy(fsipcbuf.write.req_buf, buf, n);
+  802af6:	48 89 da             	mov    %rbx,%rdx
+  802af9:	48 8d 78 10          	lea    0x10(%rax),%rdi
+  802afd:	48 b8 50 18 80 00 00 	movabs $0x801850,%rax
+  802b04:	00 00 00 
+  802b07:	ff d0                	call   *%rax
+    ssize_t res = fsipc(FSREQ_WRITE, NULL);
+  802b09:	be 00 00 00 00       	mov    $0x0,%esi
+  802b0e:	bf 04 00 00 00       	mov    $0x4,%edi
+  802b13:	48 b8 d0 28 80 00 00 	movabs $0x8028d0,%rax
+  802b1a:	00 00 00 
+  802b1d:	ff d0                	call   *%rax
+  802b1f:	48 63 d0             	movslq %eax,%rdx
+    written += res;
+  802b22:	49 01 d4             	add    %rdx,%r12
+  802b25:	48 85 d2             	test   %rdx,%rdx
+  802b28:	49 0f 49 d4          	cmovns %r12,%rdx
+}
+  802b2c:	48 89 d0             	mov    %rdx,%rax
+  802b2f:	48 83 c4 18          	add    $0x18,%rsp
+  802b33:	5b                   	pop    %rbx
+  802b34:	41 5c                	pop    %r12
+  802b36:	41 5d                	pop    %r13
+  802b38:	41 5e                	pop    %r14
+  802b3a:	41 5f                	pop    %r15
+  802b3c:	5d                   	pop    %rbp
+  802b3d:	c3                   	ret
+    while (n > sizeof(fsipcbuf.write.req_buf))
+  802b3e:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+    ssize_t written = 0;
+  802b42:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802b48:	eb 98                	jmp    802ae2 <devfile_write+0xb0>
+
+0000000000802b4a <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  802b4a:	55                   	push   %rbp
+  802b4b:	48 89 e5             	mov    %rsp,%rbp
+  802b4e:	41 57                	push   %r15
+  802b50:	41 56                	push   %r14
+  802b52:	41 55                	push   %r13
+  802b54:	41 54                	push   %r12
+  802b56:	53                   	push   %rbx
+  802b57:	48 83 ec 18          	sub    $0x18,%rsp
+  802b5b:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  802b5f:	49 89 f6             	mov    %rsi,%r14
+  802b62:	49 89 d4             	mov    %rdx,%r12
+    while (n > sizeof(fsipcbuf.readRet.ret_buf))
+  802b65:	48 81 fa 00 10 00 00 	cmp    $0x1000,%rdx
+  802b6c:	0f 86 ea 00 00 00    	jbe    802c5c <devfile_read+0x112>
+    ssize_t readsz = 0;
+  802b72:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  802b79:	00 
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802b7a:	49 bf 00 70 80 00 00 	movabs $0x807000,%r15
+  802b81:	00 00 00 
+  802b84:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802b88:	8b 40 0c             	mov    0xc(%rax),%eax
+  802b8b:	41 89 07             	mov    %eax,(%r15)
+        fsipcbuf.read.req_n = sizeof(fsipcbuf.readRet.ret_buf);
+  802b8e:	49 c7 47 08 00 10 00 	movq   $0x1000,0x8(%r15)
+  802b95:	00 
+        ssize_t res = fsipc(FSREQ_READ, NULL);
+  802b96:	be 00 00 00 00       	mov    $0x0,%esi
+  802b9b:	bf 03 00 00 00       	mov    $0x3,%edi
+  802ba0:	48 b8 d0 28 80 00 00 	movabs $0x8028d0,%rax
+  802ba7:	00 00 00 
+  802baa:	ff d0                	call   *%rax
+  802bac:	4c 63 e8             	movslq %eax,%r13
+        if (res < 0)
+  802baf:	4d 85 ed             	test   %r13,%r13
+  802bb2:	0f 88 92 00 00 00    	js     802c4a <devfile_read+0x100>
+        memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  802bb8:	4c 89 ea             	mov    %r13,%rdx
+  802bbb:	4c 89 fe             	mov    %r15,%rsi
+  802bbe:	4c 89 f7             	mov    %r14,%rdi
+  802bc1:	48 b8 50 18 80 00 00 	movabs $0x801850,%rax
+  802bc8:	00 00 00 
+  802bcb:	ff d0                	call   *%rax
+        if (res < sizeof(fsipcbuf.readRet.ret_buf))
+  802bcd:	49 81 fd ff 0f 00 00 	cmp    $0xfff,%r13
+  802bd4:	76 6d                	jbe    802c43 <devfile_read+0xf9>
+        readsz += res;
+  802bd6:	4c 01 6d c0          	add    %r13,-0x40(%rbp)
+        buf += res;
+  802bda:	4d 01 ee             	add    %r13,%r14
+        n -= res;
+  802bdd:	4d 29 ec             	sub    %r13,%r12
+    while (n > sizeof(fsipcbuf.readRet.ret_buf))
+  802be0:	49 81 fc 00 10 00 00 	cmp    $0x1000,%r12
+  802be7:	77 9b                	ja     802b84 <devfile_read+0x3a>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802be9:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  802bf0:	00 00 00 
+  802bf3:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  802bf7:	8b 51 0c             	mov    0xc(%rcx),%edx
+  802bfa:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.read.req_n = n;
+  802bfc:	4c 89 60 08          	mov    %r12,0x8(%rax)
+    ssize_t res = fsipc(FSREQ_READ, NULL);
+  802c00:	be 00 00 00 00       	mov    $0x0,%esi
+  802c05:	bf 03 00 00 00       	mov    $0x3,%edi
+  802c0a:	48 b8 d0 28 80 00 00 	movabs $0x8028d0,%rax
+  802c11:	00 00 00 
+  802c14:	ff d0                	call   *%rax
+  802c16:	4c 63 e8             	movslq %eax,%r13
+    if (res < 0)
+  802c19:	4d 85 ed             	test   %r13,%r13
+  802c1c:	78 2c                	js     802c4a <devfile_read+0x100>
+    memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  802c1e:	4c 89 ea             	mov    %r13,%rdx
+  802c21:	48 be 00 70 80 00 00 	movabs $0x807000,%rsi
+  802c28:	00 00 00 
+  802c2b:	4c 89 f7             	mov    %r14,%rdi
+  802c2e:	48 b8 50 18 80 00 00 	movabs $0x801850,%rax
+  802c35:	00 00 00 
+  802c38:	ff d0                	call   *%rax
+    readsz += res;
+  802c3a:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802c3e:	49 01 c5             	add    %rax,%r13
+    return readsz;
+  802c41:	eb 07                	jmp    802c4a <devfile_read+0x100>
+            return readsz + res;
+  802c43:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802c47:	49 01 c5             	add    %rax,%r13
+}
+  802c4a:	4c 89 e8             	mov    %r13,%rax
+  802c4d:	48 83 c4 18          	add    $0x18,%rsp
+  802c51:	5b                   	pop    %rbx
+  802c52:	41 5c                	pop    %r12
+  802c54:	41 5d                	pop    %r13
+  802c56:	41 5e                	pop    %r14
+  802c58:	41 5f                	pop    %r15
+  802c5a:	5d                   	pop    %rbp
+  802c5b:	c3                   	ret
+    ssize_t readsz = 0;
+  802c5c:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  802c63:	00 
+  802c64:	eb 83                	jmp    802be9 <devfile_read+0x9f>
+
+0000000000802c66 <open>:
+open(const char *path, int mode) {
+  802c66:	55                   	push   %rbp
+  802c67:	48 89 e5             	mov    %rsp,%rbp
+  802c6a:	41 55                	push   %r13
+  802c6c:	41 54                	push   %r12
+  802c6e:	53                   	push   %rbx
+  802c6f:	48 83 ec 18          	sub    $0x18,%rsp
+  802c73:	49 89 fc             	mov    %rdi,%r12
+  802c76:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  802c79:	48 b8 b1 15 80 00 00 	movabs $0x8015b1,%rax
+  802c80:	00 00 00 
+  802c83:	ff d0                	call   *%rax
+  802c85:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802c8b:	0f 87 8a 00 00 00    	ja     802d1b <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802c91:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802c95:	48 b8 49 22 80 00 00 	movabs $0x802249,%rax
+  802c9c:	00 00 00 
+  802c9f:	ff d0                	call   *%rax
+  802ca1:	89 c3                	mov    %eax,%ebx
+  802ca3:	85 c0                	test   %eax,%eax
+  802ca5:	78 50                	js     802cf7 <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  802ca7:	4c 89 e6             	mov    %r12,%rsi
+  802caa:	48 bb 00 70 80 00 00 	movabs $0x807000,%rbx
+  802cb1:	00 00 00 
+  802cb4:	48 89 df             	mov    %rbx,%rdi
+  802cb7:	48 b8 ef 15 80 00 00 	movabs $0x8015ef,%rax
+  802cbe:	00 00 00 
+  802cc1:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  802cc3:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  802cca:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802cce:	bf 01 00 00 00       	mov    $0x1,%edi
+  802cd3:	48 b8 d0 28 80 00 00 	movabs $0x8028d0,%rax
+  802cda:	00 00 00 
+  802cdd:	ff d0                	call   *%rax
+  802cdf:	89 c3                	mov    %eax,%ebx
+  802ce1:	85 c0                	test   %eax,%eax
+  802ce3:	78 1f                	js     802d04 <open+0x9e>
+    return fd2num(fd);
+  802ce5:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802ce9:	48 b8 a2 21 80 00 00 	movabs $0x8021a2,%rax
+  802cf0:	00 00 00 
+  802cf3:	ff d0                	call   *%rax
+  802cf5:	89 c3                	mov    %eax,%ebx
+}
+  802cf7:	89 d8                	mov    %ebx,%eax
+  802cf9:	48 83 c4 18          	add    $0x18,%rsp
+  802cfd:	5b                   	pop    %rbx
+  802cfe:	41 5c                	pop    %r12
+  802d00:	41 5d                	pop    %r13
+  802d02:	5d                   	pop    %rbp
+  802d03:	c3                   	ret
+        fd_close(fd, 0);
+  802d04:	be 00 00 00 00       	mov    $0x0,%esi
+  802d09:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802d0d:	48 b8 1e 23 80 00 00 	movabs $0x80231e,%rax
+  802d14:	00 00 00 
+  802d17:	ff d0                	call   *%rax
+        return res;
+  802d19:	eb dc                	jmp    802cf7 <open+0x91>
+        return -E_BAD_PATH;
+  802d1b:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  802d20:	eb d5                	jmp    802cf7 <open+0x91>
+
+0000000000802d22 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  802d22:	55                   	push   %rbp
+  802d23:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc(FSREQ_SYNC, NULL);
+  802d26:	be 00 00 00 00       	mov    $0x0,%esi
+  802d2b:	bf 08 00 00 00       	mov    $0x8,%edi
+  802d30:	48 b8 d0 28 80 00 00 	movabs $0x8028d0,%rax
+  802d37:	00 00 00 
+  802d3a:	ff d0                	call   *%rax
+}
+  802d3c:	5d                   	pop    %rbp
+  802d3d:	c3                   	ret
+
+0000000000802d3e <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  802d3e:	55                   	push   %rbp
+  802d3f:	48 89 e5             	mov    %rsp,%rbp
+  802d42:	41 54                	push   %r12
+  802d44:	53                   	push   %rbx
+  802d45:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802d48:	48 b8 b4 21 80 00 00 	movabs $0x8021b4,%rax
+  802d4f:	00 00 00 
+  802d52:	ff d0                	call   *%rax
+  802d54:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  802d57:	48 be 60 41 80 00 00 	movabs $0x804160,%rsi
+  802d5e:	00 00 00 
+  802d61:	48 89 df             	mov    %rbx,%rdi
+  802d64:	48 b8 ef 15 80 00 00 	movabs $0x8015ef,%rax
+  802d6b:	00 00 00 
+  802d6e:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  802d70:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  802d75:	41 2b 04 24          	sub    (%r12),%eax
+  802d79:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  802d7f:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  802d86:	00 00 00 
+    stat->st_dev = &devpipe;
+  802d89:	48 b8 60 50 80 00 00 	movabs $0x805060,%rax
+  802d90:	00 00 00 
+  802d93:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  802d9a:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d9f:	5b                   	pop    %rbx
+  802da0:	41 5c                	pop    %r12
+  802da2:	5d                   	pop    %rbp
+  802da3:	c3                   	ret
+
+0000000000802da4 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  802da4:	55                   	push   %rbp
+  802da5:	48 89 e5             	mov    %rsp,%rbp
+  802da8:	41 54                	push   %r12
+  802daa:	53                   	push   %rbx
+  802dab:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  802dae:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802db3:	48 89 fe             	mov    %rdi,%rsi
+  802db6:	bf 00 00 00 00       	mov    $0x0,%edi
+  802dbb:	49 bc 6b 1c 80 00 00 	movabs $0x801c6b,%r12
+  802dc2:	00 00 00 
+  802dc5:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  802dc8:	48 89 df             	mov    %rbx,%rdi
+  802dcb:	48 b8 b4 21 80 00 00 	movabs $0x8021b4,%rax
+  802dd2:	00 00 00 
+  802dd5:	ff d0                	call   *%rax
+  802dd7:	48 89 c6             	mov    %rax,%rsi
+  802dda:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802ddf:	bf 00 00 00 00       	mov    $0x0,%edi
+  802de4:	41 ff d4             	call   *%r12
+}
+  802de7:	5b                   	pop    %rbx
+  802de8:	41 5c                	pop    %r12
+  802dea:	5d                   	pop    %rbp
+  802deb:	c3                   	ret
+
+0000000000802dec <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  802dec:	55                   	push   %rbp
+  802ded:	48 89 e5             	mov    %rsp,%rbp
+  802df0:	41 57                	push   %r15
+  802df2:	41 56                	push   %r14
+  802df4:	41 55                	push   %r13
+  802df6:	41 54                	push   %r12
+  802df8:	53                   	push   %rbx
+  802df9:	48 83 ec 18          	sub    $0x18,%rsp
+  802dfd:	49 89 fc             	mov    %rdi,%r12
+  802e00:	49 89 f5             	mov    %rsi,%r13
+  802e03:	49 89 d7             	mov    %rdx,%r15
+  802e06:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802e0a:	48 b8 b4 21 80 00 00 	movabs $0x8021b4,%rax
+  802e11:	00 00 00 
+  802e14:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  802e16:	4d 85 ff             	test   %r15,%r15
+  802e19:	0f 84 af 00 00 00    	je     802ece <devpipe_write+0xe2>
+  802e1f:	48 89 c3             	mov    %rax,%rbx
+  802e22:	4c 89 f8             	mov    %r15,%rax
+  802e25:	4d 89 ef             	mov    %r13,%r15
+  802e28:	4c 01 e8             	add    %r13,%rax
+  802e2b:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802e2f:	49 bd 73 1b 80 00 00 	movabs $0x801b73,%r13
+  802e36:	00 00 00 
+            sys_yield();
+  802e39:	49 be 10 1b 80 00 00 	movabs $0x801b10,%r14
+  802e40:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  802e43:	8b 73 04             	mov    0x4(%rbx),%esi
+  802e46:	48 63 ce             	movslq %esi,%rcx
+  802e49:	48 63 03             	movslq (%rbx),%rax
+  802e4c:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  802e52:	48 39 c1             	cmp    %rax,%rcx
+  802e55:	72 2e                	jb     802e85 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802e57:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802e5c:	48 89 da             	mov    %rbx,%rdx
+  802e5f:	be 00 10 00 00       	mov    $0x1000,%esi
+  802e64:	4c 89 e7             	mov    %r12,%rdi
+  802e67:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  802e6a:	85 c0                	test   %eax,%eax
+  802e6c:	74 66                	je     802ed4 <devpipe_write+0xe8>
+            sys_yield();
+  802e6e:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  802e71:	8b 73 04             	mov    0x4(%rbx),%esi
+  802e74:	48 63 ce             	movslq %esi,%rcx
+  802e77:	48 63 03             	movslq (%rbx),%rax
+  802e7a:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  802e80:	48 39 c1             	cmp    %rax,%rcx
+  802e83:	73 d2                	jae    802e57 <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  802e85:	41 0f b6 3f          	movzbl (%r15),%edi
+  802e89:	48 89 ca             	mov    %rcx,%rdx
+  802e8c:	48 c1 ea 03          	shr    $0x3,%rdx
+  802e90:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  802e97:	08 10 20 
+  802e9a:	48 f7 e2             	mul    %rdx
+  802e9d:	48 c1 ea 06          	shr    $0x6,%rdx
+  802ea1:	48 89 d0             	mov    %rdx,%rax
+  802ea4:	48 c1 e0 09          	shl    $0x9,%rax
+  802ea8:	48 29 d0             	sub    %rdx,%rax
+  802eab:	48 c1 e0 03          	shl    $0x3,%rax
+  802eaf:	48 29 c1             	sub    %rax,%rcx
+  802eb2:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  802eb7:	83 c6 01             	add    $0x1,%esi
+  802eba:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  802ebd:	49 83 c7 01          	add    $0x1,%r15
+  802ec1:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802ec5:	49 39 c7             	cmp    %rax,%r15
+  802ec8:	0f 85 75 ff ff ff    	jne    802e43 <devpipe_write+0x57>
+    return n;
+  802ece:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802ed2:	eb 05                	jmp    802ed9 <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  802ed4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802ed9:	48 83 c4 18          	add    $0x18,%rsp
+  802edd:	5b                   	pop    %rbx
+  802ede:	41 5c                	pop    %r12
+  802ee0:	41 5d                	pop    %r13
+  802ee2:	41 5e                	pop    %r14
+  802ee4:	41 5f                	pop    %r15
+  802ee6:	5d                   	pop    %rbp
+  802ee7:	c3                   	ret
+
+0000000000802ee8 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  802ee8:	55                   	push   %rbp
+  802ee9:	48 89 e5             	mov    %rsp,%rbp
+  802eec:	41 57                	push   %r15
+  802eee:	41 56                	push   %r14
+  802ef0:	41 55                	push   %r13
+  802ef2:	41 54                	push   %r12
+  802ef4:	53                   	push   %rbx
+  802ef5:	48 83 ec 18          	sub    $0x18,%rsp
+  802ef9:	49 89 fc             	mov    %rdi,%r12
+  802efc:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  802f00:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802f04:	48 b8 b4 21 80 00 00 	movabs $0x8021b4,%rax
+  802f0b:	00 00 00 
+  802f0e:	ff d0                	call   *%rax
+  802f10:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  802f13:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802f19:	49 bd 73 1b 80 00 00 	movabs $0x801b73,%r13
+  802f20:	00 00 00 
+            sys_yield();
+  802f23:	49 be 10 1b 80 00 00 	movabs $0x801b10,%r14
+  802f2a:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  802f2d:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  802f32:	74 7d                	je     802fb1 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  802f34:	8b 03                	mov    (%rbx),%eax
+  802f36:	3b 43 04             	cmp    0x4(%rbx),%eax
+  802f39:	75 26                	jne    802f61 <devpipe_read+0x79>
+            if (i > 0) return i;
+  802f3b:	4d 85 ff             	test   %r15,%r15
+  802f3e:	75 77                	jne    802fb7 <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802f40:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802f45:	48 89 da             	mov    %rbx,%rdx
+  802f48:	be 00 10 00 00       	mov    $0x1000,%esi
+  802f4d:	4c 89 e7             	mov    %r12,%rdi
+  802f50:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  802f53:	85 c0                	test   %eax,%eax
+  802f55:	74 72                	je     802fc9 <devpipe_read+0xe1>
+            sys_yield();
+  802f57:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  802f5a:	8b 03                	mov    (%rbx),%eax
+  802f5c:	3b 43 04             	cmp    0x4(%rbx),%eax
+  802f5f:	74 df                	je     802f40 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802f61:	48 63 c8             	movslq %eax,%rcx
+  802f64:	48 89 ca             	mov    %rcx,%rdx
+  802f67:	48 c1 ea 03          	shr    $0x3,%rdx
+  802f6b:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  802f72:	08 10 20 
+  802f75:	48 89 d0             	mov    %rdx,%rax
+  802f78:	48 f7 e6             	mul    %rsi
+  802f7b:	48 c1 ea 06          	shr    $0x6,%rdx
+  802f7f:	48 89 d0             	mov    %rdx,%rax
+  802f82:	48 c1 e0 09          	shl    $0x9,%rax
+  802f86:	48 29 d0             	sub    %rdx,%rax
+  802f89:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  802f90:	00 
+  802f91:	48 89 c8             	mov    %rcx,%rax
+  802f94:	48 29 d0             	sub    %rdx,%rax
+  802f97:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  802f9c:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  802fa0:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  802fa4:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  802fa7:	49 83 c7 01          	add    $0x1,%r15
+  802fab:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  802faf:	75 83                	jne    802f34 <devpipe_read+0x4c>
+    return n;
+  802fb1:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802fb5:	eb 03                	jmp    802fba <devpipe_read+0xd2>
+            if (i > 0) return i;
+  802fb7:	4c 89 f8             	mov    %r15,%rax
+}
+  802fba:	48 83 c4 18          	add    $0x18,%rsp
+  802fbe:	5b                   	pop    %rbx
+  802fbf:	41 5c                	pop    %r12
+  802fc1:	41 5d                	pop    %r13
+  802fc3:	41 5e                	pop    %r14
+  802fc5:	41 5f                	pop    %r15
+  802fc7:	5d                   	pop    %rbp
+  802fc8:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  802fc9:	b8 00 00 00 00       	mov    $0x0,%eax
+  802fce:	eb ea                	jmp    802fba <devpipe_read+0xd2>
+
+0000000000802fd0 <pipe>:
+pipe(int pfd[2]) {
+  802fd0:	55                   	push   %rbp
+  802fd1:	48 89 e5             	mov    %rsp,%rbp
+  802fd4:	41 55                	push   %r13
+  802fd6:	41 54                	push   %r12
+  802fd8:	53                   	push   %rbx
+  802fd9:	48 81 ec b8 00 00 00 	sub    $0xb8,%rsp
+  802fe0:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  802fe3:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802fe7:	48 b8 49 22 80 00 00 	movabs $0x802249,%rax
+  802fee:	00 00 00 
+  802ff1:	ff d0                	call   *%rax
+  802ff3:	89 c3                	mov    %eax,%ebx
+  802ff5:	85 c0                	test   %eax,%eax
+  802ff7:	0f 88 51 01 00 00    	js     80314e <pipe+0x17e>
+        (res = fd_alloc_from(fd2num(fd0) + 1, &fd1)) < 0) goto err;
+  802ffd:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803001:	48 b8 a2 21 80 00 00 	movabs $0x8021a2,%rax
+  803008:	00 00 00 
+  80300b:	ff d0                	call   *%rax
+  80300d:	8d 78 01             	lea    0x1(%rax),%edi
+  803010:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  803014:	48 b8 d0 21 80 00 00 	movabs $0x8021d0,%rax
+  80301b:	00 00 00 
+  80301e:	ff d0                	call   *%rax
+  803020:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803022:	85 c0                	test   %eax,%eax
+  803024:	0f 88 24 01 00 00    	js     80314e <pipe+0x17e>
+    va = fd2data(fd0);
+  80302a:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80302e:	48 bb b4 21 80 00 00 	movabs $0x8021b4,%rbx
+  803035:	00 00 00 
+  803038:	ff d3                	call   *%rbx
+  80303a:	49 89 c5             	mov    %rax,%r13
+    struct RegionOp ops[] = {
+  80303d:	48 8d bd 30 ff ff ff 	lea    -0xd0(%rbp),%rdi
+  803044:	b9 14 00 00 00       	mov    $0x14,%ecx
+  803049:	b8 00 00 00 00       	mov    $0x0,%eax
+  80304e:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+  803051:	c7 85 34 ff ff ff 46 	movl   $0x46,-0xcc(%rbp)
+  803058:	00 00 00 
+  80305b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80305f:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+  803066:	48 c7 85 50 ff ff ff 	movq   $0x1000,-0xb0(%rbp)
+  80306d:	00 10 00 00 
+  803071:	c7 85 5c ff ff ff 46 	movl   $0x46,-0xa4(%rbp)
+  803078:	00 00 00 
+            {.type = REGION_ALLOC, .dstva = (uintptr_t)fd1, .size = PAGE_SIZE, .perm = PROT_RW | PROT_SHARE},
+  80307b:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+    struct RegionOp ops[] = {
+  80307f:	48 89 bd 70 ff ff ff 	mov    %rdi,-0x90(%rbp)
+  803086:	48 c7 85 78 ff ff ff 	movq   $0x1000,-0x88(%rbp)
+  80308d:	00 10 00 00 
+  803091:	c7 45 84 46 00 00 00 	movl   $0x46,-0x7c(%rbp)
+  803098:	4c 89 6d 98          	mov    %r13,-0x68(%rbp)
+  80309c:	48 c7 45 a0 00 10 00 	movq   $0x1000,-0x60(%rbp)
+  8030a3:	00 
+  8030a4:	c7 45 a8 01 00 00 00 	movl   $0x1,-0x58(%rbp)
+  8030ab:	c7 45 ac 46 00 00 00 	movl   $0x46,-0x54(%rbp)
+  8030b2:	4c 89 6d b8          	mov    %r13,-0x48(%rbp)
+            {.type = REGION_MAP, .srcva = (uintptr_t)va, .dstva = (uintptr_t)fd2data(fd1), .size = PAGE_SIZE, .perm = PROT_RW | PROT_SHARE},
+  8030b6:	ff d3                	call   *%rbx
+    struct RegionOp ops[] = {
+  8030b8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8030bc:	48 c7 45 c8 00 10 00 	movq   $0x1000,-0x38(%rbp)
+  8030c3:	00 
+    if ((res = sys_region_batch(ops, sizeof ops / sizeof *ops)) < 0) goto err1;
+  8030c4:	be 04 00 00 00       	mov    $0x4,%esi
+  8030c9:	48 8d bd 30 ff ff ff 	lea    -0xd0(%rbp),%rdi
+  8030d0:	48 b8 d2 1c 80 00 00 	movabs $0x801cd2,%rax
+  8030d7:	00 00 00 
+  8030da:	ff d0                	call   *%rax
+  8030dc:	89 c3                	mov    %eax,%ebx
+  8030de:	85 c0                	test   %eax,%eax
+  8030e0:	0f 88 ad 00 00 00    	js     803193 <pipe+0x1c3>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8030e6:	be 00 10 00 00       	mov    $0x1000,%esi
+  8030eb:	4c 89 ef             	mov    %r13,%rdi
+  8030ee:	48 b8 41 1b 80 00 00 	movabs $0x801b41,%rax
+  8030f5:	00 00 00 
+  8030f8:	ff d0                	call   *%rax
+  8030fa:	83 f8 02             	cmp    $0x2,%eax
+  8030fd:	75 5f                	jne    80315e <pipe+0x18e>
+    fd0->fd_dev_id = devpipe.dev_id;
+  8030ff:	a1 60 50 80 00 00 00 	movabs 0x805060,%eax
+  803106:	00 00 
+  803108:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80310c:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  80310e:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803112:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  803119:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  80311d:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  80311f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803123:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  80312a:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80312e:	48 bb a2 21 80 00 00 	movabs $0x8021a2,%rbx
+  803135:	00 00 00 
+  803138:	ff d3                	call   *%rbx
+  80313a:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  80313e:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  803142:	ff d3                	call   *%rbx
+  803144:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  803149:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  80314e:	89 d8                	mov    %ebx,%eax
+  803150:	48 81 c4 b8 00 00 00 	add    $0xb8,%rsp
+  803157:	5b                   	pop    %rbx
+  803158:	41 5c                	pop    %r12
+  80315a:	41 5d                	pop    %r13
+  80315c:	5d                   	pop    %rbp
+  80315d:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  80315e:	48 b9 90 41 80 00 00 	movabs $0x804190,%rcx
+  803165:	00 00 00 
+  803168:	48 ba 67 41 80 00 00 	movabs $0x804167,%rdx
+  80316f:	00 00 00 
+  803172:	be 33 00 00 00       	mov    $0x33,%esi
+  803177:	48 bf 7c 41 80 00 00 	movabs $0x80417c,%rdi
+  80317e:	00 00 00 
+  803181:	b8 00 00 00 00       	mov    $0x0,%eax
+  803186:	49 b8 7a 0b 80 00 00 	movabs $0x800b7a,%r8
+  80318d:	00 00 00 
+  803190:	41 ff d0             	call   *%r8
+        ops[i].type = REGION_UNMAP;
+  803193:	c7 85 30 ff ff ff 02 	movl   $0x2,-0xd0(%rbp)
+  80319a:	00 00 00 
+  80319d:	c7 85 58 ff ff ff 02 	movl   $0x2,-0xa8(%rbp)
+  8031a4:	00 00 00 
+  8031a7:	c7 45 80 02 00 00 00 	movl   $0x2,-0x80(%rbp)
+  8031ae:	c7 45 a8 02 00 00 00 	movl   $0x2,-0x58(%rbp)
+    sys_region_batch(ops, sizeof ops / sizeof *ops);
+  8031b5:	be 04 00 00 00       	mov    $0x4,%esi
+  8031ba:	48 8d bd 30 ff ff ff 	lea    -0xd0(%rbp),%rdi
+  8031c1:	48 b8 d2 1c 80 00 00 	movabs $0x801cd2,%rax
+  8031c8:	00 00 00 
+  8031cb:	ff d0                	call   *%rax
+  8031cd:	e9 7c ff ff ff       	jmp    80314e <pipe+0x17e>
+
+00000000008031d2 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  8031d2:	55                   	push   %rbp
+  8031d3:	48 89 e5             	mov    %rsp,%rbp
+  8031d6:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8031da:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8031de:	48 b8 63 22 80 00 00 	movabs $0x802263,%rax
+  8031e5:	00 00 00 
+  8031e8:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8031ea:	85 c0                	test   %eax,%eax
+  8031ec:	78 35                	js     803223 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  8031ee:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8031f2:	48 b8 b4 21 80 00 00 	movabs $0x8021b4,%rax
+  8031f9:	00 00 00 
+  8031fc:	ff d0                	call   *%rax
+  8031fe:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803201:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803206:	be 00 10 00 00       	mov    $0x1000,%esi
+  80320b:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80320f:	48 b8 73 1b 80 00 00 	movabs $0x801b73,%rax
+  803216:	00 00 00 
+  803219:	ff d0                	call   *%rax
+  80321b:	85 c0                	test   %eax,%eax
+  80321d:	0f 94 c0             	sete   %al
+  803220:	0f b6 c0             	movzbl %al,%eax
+}
+  803223:	c9                   	leave
+  803224:	c3                   	ret
+
+0000000000803225 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803225:	48 89 f8             	mov    %rdi,%rax
+  803228:	48 c1 e8 27          	shr    $0x27,%rax
+  80322c:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  803233:	01 00 00 
+  803236:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80323a:	f6 c2 01             	test   $0x1,%dl
+  80323d:	74 6d                	je     8032ac <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  80323f:	48 89 f8             	mov    %rdi,%rax
+  803242:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803246:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  80324d:	01 00 00 
+  803250:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803254:	f6 c2 01             	test   $0x1,%dl
+  803257:	74 62                	je     8032bb <get_uvpt_entry+0x96>
+  803259:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  803260:	01 00 00 
+  803263:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803267:	f6 c2 80             	test   $0x80,%dl
+  80326a:	75 4f                	jne    8032bb <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  80326c:	48 89 f8             	mov    %rdi,%rax
+  80326f:	48 c1 e8 15          	shr    $0x15,%rax
+  803273:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  80327a:	01 00 00 
+  80327d:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803281:	f6 c2 01             	test   $0x1,%dl
+  803284:	74 44                	je     8032ca <get_uvpt_entry+0xa5>
+  803286:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  80328d:	01 00 00 
+  803290:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803294:	f6 c2 80             	test   $0x80,%dl
+  803297:	75 31                	jne    8032ca <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  803299:	48 c1 ef 0c          	shr    $0xc,%rdi
+  80329d:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8032a4:	01 00 00 
+  8032a7:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  8032ab:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8032ac:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  8032b3:	01 00 00 
+  8032b6:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8032ba:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8032bb:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8032c2:	01 00 00 
+  8032c5:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8032c9:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8032ca:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8032d1:	01 00 00 
+  8032d4:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8032d8:	c3                   	ret
+
+00000000008032d9 <get_prot>:
+
+int
+get_prot(void *va) {
+  8032d9:	55                   	push   %rbp
+  8032da:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8032dd:	48 b8 25 32 80 00 00 	movabs $0x803225,%rax
+  8032e4:	00 00 00 
+  8032e7:	ff d0                	call   *%rax
+  8032e9:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  8032ec:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  8032f1:	89 c1                	mov    %eax,%ecx
+  8032f3:	83 c9 04             	or     $0x4,%ecx
+  8032f6:	f6 c2 01             	test   $0x1,%dl
+  8032f9:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  8032fc:	89 c1                	mov    %eax,%ecx
+  8032fe:	83 c9 02             	or     $0x2,%ecx
+  803301:	f6 c2 02             	test   $0x2,%dl
+  803304:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  803307:	89 c1                	mov    %eax,%ecx
+  803309:	83 c9 01             	or     $0x1,%ecx
+  80330c:	48 85 d2             	test   %rdx,%rdx
+  80330f:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  803312:	89 c1                	mov    %eax,%ecx
+  803314:	83 c9 40             	or     $0x40,%ecx
+  803317:	f6 c6 04             	test   $0x4,%dh
+  80331a:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  80331d:	5d                   	pop    %rbp
+  80331e:	c3                   	ret
+
+000000000080331f <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  80331f:	55                   	push   %rbp
+  803320:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803323:	48 b8 25 32 80 00 00 	movabs $0x803225,%rax
+  80332a:	00 00 00 
+  80332d:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  80332f:	48 c1 e8 06          	shr    $0x6,%rax
+  803333:	83 e0 01             	and    $0x1,%eax
+}
+  803336:	5d                   	pop    %rbp
+  803337:	c3                   	ret
+
+0000000000803338 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  803338:	55                   	push   %rbp
+  803339:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  80333c:	48 b8 25 32 80 00 00 	movabs $0x803225,%rax
+  803343:	00 00 00 
+  803346:	ff d0                	call   *%rax
+  803348:	83 e0 01             	and    $0x1,%eax
+}
+  80334b:	5d                   	pop    %rbp
+  80334c:	c3                   	ret
+
+000000000080334d <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  80334d:	55                   	push   %rbp
+  80334e:	48 89 e5             	mov    %rsp,%rbp
+  803351:	41 57                	push   %r15
+  803353:	41 56                	push   %r14
+  803355:	41 55                	push   %r13
+  803357:	41 54                	push   %r12
+  803359:	53                   	push   %rbx
+  80335a:	48 83 ec 38          	sub    $0x38,%rsp
+  80335e:	49 89 f7             	mov    %rsi,%r15
+  803361:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+                    }
+                    continue;
+                }
+                for (int ptei = 0; ptei < PT_ENTRY_COUNT; ptei++) {
+                    uintptr_t pte_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, pdei, ptei, 0);
+                    pte_t pte = uvpt[VPT(pte_addr)];
+  803367:	49 bd 00 00 00 00 00 	movabs $0x10000000000,%r13
+  80336e:	01 00 00 
+  803371:	4d 89 e6             	mov    %r12,%r14
+  803374:	49 89 fc             	mov    %rdi,%r12
+  803377:	e9 19 01 00 00       	jmp    803495 <foreach_shared_region+0x148>
+  80337c:	48 89 5d b0          	mov    %rbx,-0x50(%rbp)
+  803380:	4c 89 75 a8          	mov    %r14,-0x58(%rbp)
+  803384:	eb 52                	jmp    8033d8 <foreach_shared_region+0x8b>
+                for (int ptei = 0; ptei < PT_ENTRY_COUNT; ptei++) {
+  803386:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  80338d:	48 81 fb 00 00 20 00 	cmp    $0x200000,%rbx
+  803394:	74 2e                	je     8033c4 <foreach_shared_region+0x77>
+                    uintptr_t pte_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, pdei, ptei, 0);
+  803396:	48 89 df             	mov    %rbx,%rdi
+  803399:	4c 09 f7             	or     %r14,%rdi
+                    pte_t pte = uvpt[VPT(pte_addr)];
+  80339c:	48 89 f8             	mov    %rdi,%rax
+  80339f:	48 c1 e8 0c          	shr    $0xc,%rax
+  8033a3:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+                    if ((pte & PTE_P) && (pte & PTE_SHARE)) {
+  8033a8:	25 01 04 00 00       	and    $0x401,%eax
+  8033ad:	48 3d 01 04 00 00    	cmp    $0x401,%rax
+  8033b3:	75 d1                	jne    803386 <foreach_shared_region+0x39>
+                        fun((void*)pte_addr, (void*)(pte_addr + PAGE_SIZE), arg);
+  8033b5:	48 8d b7 00 10 00 00 	lea    0x1000(%rdi),%rsi
+  8033bc:	4c 89 fa             	mov    %r15,%rdx
+  8033bf:	41 ff d4             	call   *%r12
+  8033c2:	eb c2                	jmp    803386 <foreach_shared_region+0x39>
+            for (int pdei = 0; pdei < PD_ENTRY_COUNT; pdei++) {
+  8033c4:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  8033cb:	00 
+  8033cc:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8033d0:	48 3d 00 00 00 40    	cmp    $0x40000000,%rax
+  8033d6:	74 46                	je     80341e <foreach_shared_region+0xd1>
+                uintptr_t pde_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, pdei, 0, 0);
+  8033d8:	4c 8b 75 c8          	mov    -0x38(%rbp),%r14
+  8033dc:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8033e0:	49 09 c6             	or     %rax,%r14
+                pde_t pde = uvpd[VPD(pde_addr)];
+  8033e3:	4c 89 f0             	mov    %r14,%rax
+  8033e6:	48 c1 e8 15          	shr    $0x15,%rax
+  8033ea:	48 b9 00 00 00 80 00 	movabs $0x10080000000,%rcx
+  8033f1:	01 00 00 
+  8033f4:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+                if (!(pde & PTE_P)) {
+  8033f8:	a8 01                	test   $0x1,%al
+  8033fa:	74 c8                	je     8033c4 <foreach_shared_region+0x77>
+                if (pde & PTE_PS) {
+  8033fc:	48 89 c3             	mov    %rax,%rbx
+  8033ff:	81 e3 80 00 00 00    	and    $0x80,%ebx
+  803405:	74 8f                	je     803396 <foreach_shared_region+0x49>
+                    if (pde & PTE_SHARE) {
+  803407:	f6 c4 04             	test   $0x4,%ah
+  80340a:	74 b8                	je     8033c4 <foreach_shared_region+0x77>
+                        fun((void*)pde_addr, (void*)(pde_addr + 1024 * 1024 * 2), arg);
+  80340c:	49 8d b6 00 00 20 00 	lea    0x200000(%r14),%rsi
+  803413:	4c 89 fa             	mov    %r15,%rdx
+  803416:	4c 89 f7             	mov    %r14,%rdi
+  803419:	41 ff d4             	call   *%r12
+  80341c:	eb a6                	jmp    8033c4 <foreach_shared_region+0x77>
+  80341e:	48 8b 5d b0          	mov    -0x50(%rbp),%rbx
+  803422:	4c 8b 75 a8          	mov    -0x58(%rbp),%r14
+        for (int pdpei = 0; pdpei < PDP_ENTRY_COUNT; pdpei++) {
+  803426:	48 81 c3 00 00 00 40 	add    $0x40000000,%rbx
+  80342d:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803434:	00 00 00 
+  803437:	48 39 c3             	cmp    %rax,%rbx
+  80343a:	74 4c                	je     803488 <foreach_shared_region+0x13b>
+            uintptr_t pdpe_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, 0, 0, 0);
+  80343c:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  803440:	48 09 d8             	or     %rbx,%rax
+  803443:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+            pdpe_t pdpe = uvpdp[VPDP(pdpe_addr)];
+  803447:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80344b:	48 b9 00 00 40 80 00 	movabs $0x10080400000,%rcx
+  803452:	01 00 00 
+  803455:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+            if (!(pdpe & PTE_P)) {
+  803459:	a8 01                	test   $0x1,%al
+  80345b:	74 c9                	je     803426 <foreach_shared_region+0xd9>
+            if (pdpe & PTE_PS) {
+  80345d:	48 89 c1             	mov    %rax,%rcx
+  803460:	81 e1 80 00 00 00    	and    $0x80,%ecx
+  803466:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  80346a:	0f 84 0c ff ff ff    	je     80337c <foreach_shared_region+0x2f>
+                if (pdpe & PTE_SHARE) {
+  803470:	f6 c4 04             	test   $0x4,%ah
+  803473:	74 b1                	je     803426 <foreach_shared_region+0xd9>
+                    fun((void*)pdpe_addr, (void*)(pdpe_addr + 1024 * 1024 * 1024), arg); 
+  803475:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  803479:	48 8d b7 00 00 00 40 	lea    0x40000000(%rdi),%rsi
+  803480:	4c 89 fa             	mov    %r15,%rdx
+  803483:	41 ff d4             	call   *%r12
+  803486:	eb 9e                	jmp    803426 <foreach_shared_region+0xd9>
+    for (int pml4ei = 0; pml4ei < PML4_ENTRY_COUNT; pml4ei++) {
+  803488:	49 83 c6 01          	add    $0x1,%r14
+  80348c:	49 81 fe 00 02 00 00 	cmp    $0x200,%r14
+  803493:	74 24                	je     8034b9 <foreach_shared_region+0x16c>
+        pml4e_t pml4e = uvpml4[VPML4(pml4_addr)];
+  803495:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  80349c:	01 00 00 
+  80349f:	4a 8b 04 f0          	mov    (%rax,%r14,8),%rax
+        if (!(pml4e & PTE_P)) {
+  8034a3:	a8 01                	test   $0x1,%al
+  8034a5:	74 e1                	je     803488 <foreach_shared_region+0x13b>
+  8034a7:	4c 89 f0             	mov    %r14,%rax
+  8034aa:	48 c1 e0 27          	shl    $0x27,%rax
+  8034ae:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8034b2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8034b7:	eb 83                	jmp    80343c <foreach_shared_region+0xef>
+            }
+        }
+    }
+    
+    return 0;
+}
+  8034b9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8034be:	48 83 c4 38          	add    $0x38,%rsp
+  8034c2:	5b                   	pop    %rbx
+  8034c3:	41 5c                	pop    %r12
+  8034c5:	41 5d                	pop    %r13
+  8034c7:	41 5e                	pop    %r14
+  8034c9:	41 5f                	pop    %r15
+  8034cb:	5d                   	pop    %rbp
+  8034cc:	c3                   	ret
+
+00000000008034cd <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  8034cd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8034d2:	c3                   	ret
+
+00000000008034d3 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  8034d3:	55                   	push   %rbp
+  8034d4:	48 89 e5             	mov    %rsp,%rbp
+  8034d7:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  8034da:	48 be b4 41 80 00 00 	movabs $0x8041b4,%rsi
+  8034e1:	00 00 00 
+  8034e4:	48 b8 ef 15 80 00 00 	movabs $0x8015ef,%rax
+  8034eb:	00 00 00 
+  8034ee:	ff d0                	call   *%rax
+    return 0;
+}
+  8034f0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8034f5:	5d                   	pop    %rbp
+  8034f6:	c3                   	ret
+
+00000000008034f7 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8034f7:	55                   	push   %rbp
+  8034f8:	48 89 e5             	mov    %rsp,%rbp
+  8034fb:	41 57                	push   %r15
+  8034fd:	41 56                	push   %r14
+  8034ff:	41 55                	push   %r13
+  803501:	41 54                	push   %r12
+  803503:	53                   	push   %rbx
+  803504:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  80350b:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  803512:	48 85 d2             	test   %rdx,%rdx
+  803515:	74 7a                	je     803591 <devcons_write+0x9a>
+  803517:	49 89 d6             	mov    %rdx,%r14
+  80351a:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  803520:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  803525:	49 bf e9 17 80 00 00 	movabs $0x8017e9,%r15
+  80352c:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  80352f:	4c 89 f3             	mov    %r14,%rbx
+  803532:	48 29 f3             	sub    %rsi,%rbx
+  803535:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  80353a:	48 39 c3             	cmp    %rax,%rbx
+  80353d:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  803541:	4c 63 eb             	movslq %ebx,%r13
+  803544:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  80354b:	48 01 c6             	add    %rax,%rsi
+  80354e:	4c 89 ea             	mov    %r13,%rdx
+  803551:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  803558:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  80355b:	4c 89 ee             	mov    %r13,%rsi
+  80355e:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  803565:	48 b8 16 1a 80 00 00 	movabs $0x801a16,%rax
+  80356c:	00 00 00 
+  80356f:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  803571:	41 01 dc             	add    %ebx,%r12d
+  803574:	49 63 f4             	movslq %r12d,%rsi
+  803577:	4c 39 f6             	cmp    %r14,%rsi
+  80357a:	72 b3                	jb     80352f <devcons_write+0x38>
+    return res;
+  80357c:	49 63 c4             	movslq %r12d,%rax
+}
+  80357f:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  803586:	5b                   	pop    %rbx
+  803587:	41 5c                	pop    %r12
+  803589:	41 5d                	pop    %r13
+  80358b:	41 5e                	pop    %r14
+  80358d:	41 5f                	pop    %r15
+  80358f:	5d                   	pop    %rbp
+  803590:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  803591:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  803597:	eb e3                	jmp    80357c <devcons_write+0x85>
+
+0000000000803599 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  803599:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  80359c:	ba 00 00 00 00       	mov    $0x0,%edx
+  8035a1:	48 85 c0             	test   %rax,%rax
+  8035a4:	74 55                	je     8035fb <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8035a6:	55                   	push   %rbp
+  8035a7:	48 89 e5             	mov    %rsp,%rbp
+  8035aa:	41 55                	push   %r13
+  8035ac:	41 54                	push   %r12
+  8035ae:	53                   	push   %rbx
+  8035af:	48 83 ec 08          	sub    $0x8,%rsp
+  8035b3:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  8035b6:	48 bb 43 1a 80 00 00 	movabs $0x801a43,%rbx
+  8035bd:	00 00 00 
+  8035c0:	49 bc 10 1b 80 00 00 	movabs $0x801b10,%r12
+  8035c7:	00 00 00 
+  8035ca:	eb 03                	jmp    8035cf <devcons_read+0x36>
+  8035cc:	41 ff d4             	call   *%r12
+  8035cf:	ff d3                	call   *%rbx
+  8035d1:	85 c0                	test   %eax,%eax
+  8035d3:	74 f7                	je     8035cc <devcons_read+0x33>
+    if (c < 0) return c;
+  8035d5:	48 63 d0             	movslq %eax,%rdx
+  8035d8:	78 13                	js     8035ed <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  8035da:	ba 00 00 00 00       	mov    $0x0,%edx
+  8035df:	83 f8 04             	cmp    $0x4,%eax
+  8035e2:	74 09                	je     8035ed <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  8035e4:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  8035e8:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  8035ed:	48 89 d0             	mov    %rdx,%rax
+  8035f0:	48 83 c4 08          	add    $0x8,%rsp
+  8035f4:	5b                   	pop    %rbx
+  8035f5:	41 5c                	pop    %r12
+  8035f7:	41 5d                	pop    %r13
+  8035f9:	5d                   	pop    %rbp
+  8035fa:	c3                   	ret
+  8035fb:	48 89 d0             	mov    %rdx,%rax
+  8035fe:	c3                   	ret
+
+00000000008035ff <cputchar>:
+cputchar(int ch) {
+  8035ff:	55                   	push   %rbp
+  803600:	48 89 e5             	mov    %rsp,%rbp
+  803603:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  803607:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  80360b:	be 01 00 00 00       	mov    $0x1,%esi
+  803610:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  803614:	48 b8 16 1a 80 00 00 	movabs $0x801a16,%rax
+  80361b:	00 00 00 
+  80361e:	ff d0                	call   *%rax
+}
+  803620:	c9                   	leave
+  803621:	c3                   	ret
+
+0000000000803622 <getchar>:
+getchar(void) {
+  803622:	55                   	push   %rbp
+  803623:	48 89 e5             	mov    %rsp,%rbp
+  803626:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  80362a:	ba 01 00 00 00       	mov    $0x1,%edx
+  80362f:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  803633:	bf 00 00 00 00       	mov    $0x0,%edi
+  803638:	48 b8 46 25 80 00 00 	movabs $0x802546,%rax
+  80363f:	00 00 00 
+  803642:	ff d0                	call   *%rax
+  803644:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  803646:	85 c0                	test   %eax,%eax
+  803648:	78 06                	js     803650 <getchar+0x2e>
+  80364a:	74 08                	je     803654 <getchar+0x32>
+  80364c:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  803650:	89 d0                	mov    %edx,%eax
+  803652:	c9                   	leave
+  803653:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  803654:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  803659:	eb f5                	jmp    803650 <getchar+0x2e>
+
+000000000080365b <iscons>:
+iscons(int fdnum) {
+  80365b:	55                   	push   %rbp
+  80365c:	48 89 e5             	mov    %rsp,%rbp
+  80365f:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803663:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803667:	48 b8 63 22 80 00 00 	movabs $0x802263,%rax
+  80366e:	00 00 00 
+  803671:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803673:	85 c0                	test   %eax,%eax
+  803675:	78 18                	js     80368f <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  803677:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80367b:	48 b8 a0 50 80 00 00 	movabs $0x8050a0,%rax
+  803682:	00 00 00 
+  803685:	8b 00                	mov    (%rax),%eax
+  803687:	39 02                	cmp    %eax,(%rdx)
+  803689:	0f 94 c0             	sete   %al
+  80368c:	0f b6 c0             	movzbl %al,%eax
+}
+  80368f:	c9                   	leave
+  803690:	c3                   	ret
+
+0000000000803691 <opencons>:
+opencons(void) {
+  803691:	55                   	push   %rbp
+  803692:	48 89 e5             	mov    %rsp,%rbp
+  803695:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  803699:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  80369d:	48 b8 49 22 80 00 00 	movabs $0x802249,%rax
+  8036a4:	00 00 00 
+  8036a7:	ff d0                	call   *%rax
+  8036a9:	85 c0                	test   %eax,%eax
+  8036ab:	78 49                	js     8036f6 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  8036ad:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8036b2:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8036b7:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  8036bb:	bf 00 00 00 00       	mov    $0x0,%edi
+  8036c0:	48 b8 9f 1b 80 00 00 	movabs $0x801b9f,%rax
+  8036c7:	00 00 00 
+  8036ca:	ff d0                	call   *%rax
+  8036cc:	85 c0                	test   %eax,%eax
+  8036ce:	78 26                	js     8036f6 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  8036d0:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8036d4:	a1 a0 50 80 00 00 00 	movabs 0x8050a0,%eax
+  8036db:	00 00 
+  8036dd:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  8036df:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8036e3:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  8036ea:	48 b8 a2 21 80 00 00 	movabs $0x8021a2,%rax
+  8036f1:	00 00 00 
+  8036f4:	ff d0                	call   *%rax
+}
+  8036f6:	c9                   	leave
+  8036f7:	c3                   	ret
+
+00000000008036f8 <__rodata_start>:
+  8036f8:	2f                   	(bad)
+  8036f9:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8036fa:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8036fb:	74 2d                	je     80372a <__rodata_start+0x32>
+  8036fd:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  8036ff:	75 6e                	jne    80376f <__rodata_start+0x77>
+  803701:	64 00 73 65          	add    %dh,%fs:0x65(%rbx)
+  803705:	72 76                	jb     80377d <__rodata_start+0x85>
+  803707:	65 5f                	gs pop %rdi
+  803709:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80370a:	70 65                	jo     803771 <__rodata_start+0x79>
+  80370c:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80370d:	20 2f                	and    %ch,(%rdi)
+  80370f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803710:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803711:	74 2d                	je     803740 <__rodata_start+0x48>
+  803713:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  803715:	75 6e                	jne    803785 <__rodata_start+0x8d>
+  803717:	64 3a 20             	cmp    %fs:(%rax),%ah
+  80371a:	25 6c 64 00 75       	and    $0x7500646c,%eax
+  80371f:	73 65                	jae    803786 <__rodata_start+0x8e>
+  803721:	72 2f                	jb     803752 <__rodata_start+0x5a>
+  803723:	74 65                	je     80378a <__rodata_start+0x92>
+  803725:	73 74                	jae    80379b <__rodata_start+0xa3>
+  803727:	66 69 6c 65 2e 63 00 	imul   $0x63,0x2e(%rbp,%riz,2),%bp
+  80372e:	2f                   	(bad)
+  80372f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803730:	65 77 6d             	gs ja  8037a0 <__rodata_start+0xa8>
+  803733:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803734:	74 64                	je     80379a <__rodata_start+0xa2>
+  803736:	00 73 65             	add    %dh,0x65(%rbx)
+  803739:	72 76                	jb     8037b1 <__rodata_start+0xb9>
+  80373b:	65 5f                	gs pop %rdi
+  80373d:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80373e:	70 65                	jo     8037a5 <__rodata_start+0xad>
+  803740:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803741:	20 2f                	and    %ch,(%rdi)
+  803743:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803744:	65 77 6d             	gs ja  8037b4 <__rodata_start+0xbc>
+  803747:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803748:	74 64                	je     8037ae <__rodata_start+0xb6>
+  80374a:	3a 20                	cmp    (%rax),%ah
+  80374c:	25 6c 64 00 73       	and    $0x7300646c,%eax
+  803751:	65 72 76             	gs jb  8037ca <__rodata_start+0xd2>
+  803754:	65 5f                	gs pop %rdi
+  803756:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803757:	70 65                	jo     8037be <__rodata_start+0xc6>
+  803759:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80375a:	20 69 73             	and    %ch,0x73(%rcx)
+  80375d:	20 67 6f             	and    %ah,0x6f(%rdi)
+  803760:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803761:	64 0a 00             	or     %fs:(%rax),%al
+  803764:	66 69 6c 65 5f 73 74 	imul   $0x7473,0x5f(%rbp,%riz,2),%bp
+  80376b:	61                   	(bad)
+  80376c:	74 3a                	je     8037a8 <__rodata_start+0xb0>
+  80376e:	20 25 6c 64 00 66    	and    %ah,0x6600646c(%rip)        # 66809be0 <__bss_end+0x66000be0>
+  803774:	69 6c 65 5f 73 74 61 	imul   $0x74617473,0x5f(%rbp,%riz,2),%ebp
+  80377b:	74 
+  80377c:	20 69 73             	and    %ch,0x73(%rcx)
+  80377f:	20 67 6f             	and    %ah,0x6f(%rdi)
+  803782:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803783:	64 0a 00             	or     %fs:(%rax),%al
+  803786:	66 69 6c 65 5f 72 65 	imul   $0x6572,0x5f(%rbp,%riz,2),%bp
+  80378d:	61                   	(bad)
+  80378e:	64 3a 20             	cmp    %fs:(%rax),%ah
+  803791:	25 6c 64 00 66       	and    $0x6600646c,%eax
+  803796:	69 6c 65 5f 72 65 61 	imul   $0x64616572,0x5f(%rbp,%riz,2),%ebp
+  80379d:	64 
+  80379e:	20 72 65             	and    %dh,0x65(%rdx)
+  8037a1:	74 75                	je     803818 <__rodata_start+0x120>
+  8037a3:	72 6e                	jb     803813 <__rodata_start+0x11b>
+  8037a5:	65 64 20 77 72       	gs and %dh,%fs:0x72(%rdi)
+  8037aa:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8037ab:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8037ac:	67 20 64 61 74       	and    %ah,0x74(%ecx,%eiz,2)
+  8037b1:	61                   	(bad)
+  8037b2:	00 66 69             	add    %ah,0x69(%rsi)
+  8037b5:	6c                   	insb   (%dx),%es:(%rdi)
+  8037b6:	65 5f                	gs pop %rdi
+  8037b8:	72 65                	jb     80381f <__rodata_start+0x127>
+  8037ba:	61                   	(bad)
+  8037bb:	64 20 69 73          	and    %ch,%fs:0x73(%rcx)
+  8037bf:	20 67 6f             	and    %ah,0x6f(%rdi)
+  8037c2:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8037c3:	64 0a 00             	or     %fs:(%rax),%al
+  8037c6:	66 69 6c 65 5f 63 6c 	imul   $0x6c63,0x5f(%rbp,%riz,2),%bp
+  8037cd:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8037ce:	73 65                	jae    803835 <__rodata_start+0x13d>
+  8037d0:	3a 20                	cmp    (%rax),%ah
+  8037d2:	25 6c 64 00 66       	and    $0x6600646c,%eax
+  8037d7:	69 6c 65 5f 63 6c 6f 	imul   $0x736f6c63,0x5f(%rbp,%riz,2),%ebp
+  8037de:	73 
+  8037df:	65 20 69 73          	and    %ch,%gs:0x73(%rcx)
+  8037e3:	20 67 6f             	and    %ah,0x6f(%rdi)
+  8037e6:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8037e7:	64 0a 00             	or     %fs:(%rax),%al
+  8037ea:	73 74                	jae    803860 <__rodata_start+0x168>
+  8037ec:	61                   	(bad)
+  8037ed:	6c                   	insb   (%dx),%es:(%rdi)
+  8037ee:	65 20 66 69          	and    %ah,%gs:0x69(%rsi)
+  8037f2:	6c                   	insb   (%dx),%es:(%rdi)
+  8037f3:	65 69 64 20 69 73 20 	imul   $0x6f672073,%gs:0x69(%rax,%riz,1),%esp
+  8037fa:	67 6f 
+  8037fc:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8037fd:	64 0a 00             	or     %fs:(%rax),%al
+  803800:	2f                   	(bad)
+  803801:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803802:	65 77 2d             	gs ja  803832 <__rodata_start+0x13a>
+  803805:	66 69 6c 65 00 73 65 	imul   $0x6573,0x0(%rbp,%riz,2),%bp
+  80380c:	72 76                	jb     803884 <__rodata_start+0x18c>
+  80380e:	65 5f                	gs pop %rdi
+  803810:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803811:	70 65                	jo     803878 <__rodata_start+0x180>
+  803813:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803814:	20 2f                	and    %ch,(%rdi)
+  803816:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803817:	65 77 2d             	gs ja  803847 <__rodata_start+0x14f>
+  80381a:	66 69 6c 65 3a 20 25 	imul   $0x2520,0x3a(%rbp,%riz,2),%bp
+  803821:	6c                   	insb   (%dx),%es:(%rdi)
+  803822:	64 00 66 69          	add    %ah,%fs:0x69(%rsi)
+  803826:	6c                   	insb   (%dx),%es:(%rdi)
+  803827:	65 5f                	gs pop %rdi
+  803829:	77 72                	ja     80389d <__rodata_start+0x1a5>
+  80382b:	69 74 65 3a 20 25 6c 	imul   $0x646c2520,0x3a(%rbp,%riz,2),%esi
+  803832:	64 
+  803833:	00 66 69             	add    %ah,0x69(%rsi)
+  803836:	6c                   	insb   (%dx),%es:(%rdi)
+  803837:	65 5f                	gs pop %rdi
+  803839:	77 72                	ja     8038ad <__rodata_start+0x1b5>
+  80383b:	69 74 65 20 69 73 20 	imul   $0x67207369,0x20(%rbp,%riz,2),%esi
+  803842:	67 
+  803843:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803844:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803845:	64 0a 00             	or     %fs:(%rax),%al
+  803848:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803849:	70 65                	jo     8038b0 <__rodata_start+0x1b8>
+  80384b:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80384c:	20 2f                	and    %ch,(%rdi)
+  80384e:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80384f:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803850:	74 2d                	je     80387f <__rodata_start+0x187>
+  803852:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  803854:	75 6e                	jne    8038c4 <__rodata_start+0x1cc>
+  803856:	64 20 73 75          	and    %dh,%fs:0x75(%rbx)
+  80385a:	63 63 65             	movsxd 0x65(%rbx),%esp
+  80385d:	65 64 65 64 21 00    	gs fs gs and %eax,%fs:(%rax)
+  803863:	2f                   	(bad)
+  803864:	62                   	(bad)
+  803865:	69 67 00 63 72 65 61 	imul   $0x61657263,0x0(%rdi),%esp
+  80386c:	74 20                	je     80388e <__rodata_start+0x196>
+  80386e:	2f                   	(bad)
+  80386f:	62                   	(bad)
+  803870:	69 67 3a 20 25 6c 64 	imul   $0x646c2520,0x3a(%rdi),%esp
+  803877:	00 77 72             	add    %dh,0x72(%rdi)
+  80387a:	69 74 65 20 2f 62 69 	imul   $0x6769622f,0x20(%rbp,%riz,2),%esi
+  803881:	67 
+  803882:	40 25 6c 64 3a 20    	rex and $0x203a646c,%eax
+  803888:	25 6c 64 00 6f       	and    $0x6f00646c,%eax
+  80388d:	70 65                	jo     8038f4 <__rodata_start+0x1fc>
+  80388f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803890:	20 2f                	and    %ch,(%rdi)
+  803892:	62                   	(bad)
+  803893:	69 67 3a 20 25 6c 64 	imul   $0x646c2520,0x3a(%rdi),%esp
+  80389a:	00 72 65             	add    %dh,0x65(%rdx)
+  80389d:	61                   	(bad)
+  80389e:	64 20 2f             	and    %ch,%fs:(%rdi)
+  8038a1:	62                   	(bad)
+  8038a2:	69 67 40 25 6c 64 3a 	imul   $0x3a646c25,0x40(%rdi),%esp
+  8038a9:	20 25 6c 64 00 6c    	and    %ah,0x6c00646c(%rip)        # 6c809d1b <__bss_end+0x6c000d1b>
+  8038af:	61                   	(bad)
+  8038b0:	72 67                	jb     803919 <__rodata_start+0x221>
+  8038b2:	65 20 66 69          	and    %ah,%gs:0x69(%rsi)
+  8038b6:	6c                   	insb   (%dx),%es:(%rdi)
+  8038b7:	65 20 69 73          	and    %ch,%gs:0x73(%rcx)
+  8038bb:	20 67 6f             	and    %ah,0x6f(%rdi)
+  8038be:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8038bf:	64 0a 00             	or     %fs:(%rax),%al
+  8038c2:	66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+  8038c8:	73 65                	jae    80392f <__rodata_start+0x237>
+  8038ca:	72 76                	jb     803942 <__rodata_start+0x24a>
+  8038cc:	65 5f                	gs pop %rdi
+  8038ce:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8038cf:	70 65                	jo     803936 <__rodata_start+0x23e>
+  8038d1:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8038d2:	20 2f                	and    %ch,(%rdi)
+  8038d4:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8038d5:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8038d6:	74 2d                	je     803905 <__rodata_start+0x20d>
+  8038d8:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  8038da:	75 6e                	jne    80394a <__rodata_start+0x252>
+  8038dc:	64 20 73 75          	and    %dh,%fs:0x75(%rbx)
+  8038e0:	63 63 65             	movsxd 0x65(%rbx),%esp
+  8038e3:	65 64 65 64 21 00    	gs fs gs and %eax,%fs:(%rax)
+  8038e9:	00 00                	add    %al,(%rax)
+  8038eb:	00 00                	add    %al,(%rax)
+  8038ed:	00 00                	add    %al,(%rax)
+  8038ef:	00 73 65             	add    %dh,0x65(%rbx)
+  8038f2:	72 76                	jb     80396a <__rodata_start+0x272>
+  8038f4:	65 5f                	gs pop %rdi
+  8038f6:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8038f7:	70 65                	jo     80395e <__rodata_start+0x266>
+  8038f9:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8038fa:	20 64 69 64          	and    %ah,0x64(%rcx,%rbp,2)
+  8038fe:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  803901:	74 20                	je     803923 <__rodata_start+0x22b>
+  803903:	66 69 6c 6c 20 73 74 	imul   $0x7473,0x20(%rsp,%rbp,2),%bp
+  80390a:	72 75                	jb     803981 <__rodata_start+0x289>
+  80390c:	63 74 20 46          	movsxd 0x46(%rax,%riz,1),%esi
+  803910:	64 20 63 6f          	and    %ah,%fs:0x6f(%rbx)
+  803914:	72 72                	jb     803988 <__rodata_start+0x290>
+  803916:	65 63 74 6c 79       	movsxd %gs:0x79(%rsp,%rbp,2),%esi
+  80391b:	0a 00                	or     (%rax),%al
+  80391d:	00 00                	add    %al,(%rax)
+  80391f:	00 66 69             	add    %ah,0x69(%rsi)
+  803922:	6c                   	insb   (%dx),%es:(%rdi)
+  803923:	65 5f                	gs pop %rdi
+  803925:	73 74                	jae    80399b <__rodata_start+0x2a3>
+  803927:	61                   	(bad)
+  803928:	74 20                	je     80394a <__rodata_start+0x252>
+  80392a:	72 65                	jb     803991 <__rodata_start+0x299>
+  80392c:	74 75                	je     8039a3 <__rodata_start+0x2ab>
+  80392e:	72 6e                	jb     80399e <__rodata_start+0x2a6>
+  803930:	65 64 20 73 69       	gs and %dh,%fs:0x69(%rbx)
+  803935:	7a 65                	jp     80399c <__rodata_start+0x2a4>
+  803937:	20 25 6c 64 20 77    	and    %ah,0x7720646c(%rip)        # 77a09da9 <__bss_end+0x77200da9>
+  80393d:	61                   	(bad)
+  80393e:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80393f:	74 65                	je     8039a6 <__rodata_start+0x2ae>
+  803941:	64 20 25 7a 64 0a 00 	and    %ah,%fs:0xa647a(%rip)        # 8a9dc2 <__bss_end+0xa0dc2>
+  803948:	73 65                	jae    8039af <__rodata_start+0x2b7>
+  80394a:	72 76                	jb     8039c2 <__rodata_start+0x2ca>
+  80394c:	65 5f                	gs pop %rdi
+  80394e:	72 65                	jb     8039b5 <__rodata_start+0x2bd>
+  803950:	61                   	(bad)
+  803951:	64 20 64 6f 65       	and    %ah,%fs:0x65(%rdi,%rbp,2)
+  803956:	73 20                	jae    803978 <__rodata_start+0x280>
+  803958:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803959:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80395a:	74 20                	je     80397c <__rodata_start+0x284>
+  80395c:	68 61 6e 64 6c       	push   $0x6c646e61
+  803961:	65 20 73 74          	and    %dh,%gs:0x74(%rbx)
+  803965:	61                   	(bad)
+  803966:	6c                   	insb   (%dx),%es:(%rdi)
+  803967:	65 20 66 69          	and    %ah,%gs:0x69(%rsi)
+  80396b:	6c                   	insb   (%dx),%es:(%rdi)
+  80396c:	65 69 64 73 20 63 6f 	imul   $0x72726f63,%gs:0x20(%rbx,%rsi,2),%esp
+  803973:	72 72 
+  803975:	65 63 74 6c 79       	movsxd %gs:0x79(%rsp,%rbp,2),%esi
+  80397a:	3a 20                	cmp    (%rax),%ah
+  80397c:	25 6c 64 00 66       	and    $0x6600646c,%eax
+  803981:	69 6c 65 5f 72 65 61 	imul   $0x64616572,0x5f(%rbp,%riz,2),%ebp
+  803988:	64 
+  803989:	20 61 66             	and    %ah,0x66(%rcx)
+  80398c:	74 65                	je     8039f3 <__rodata_start+0x2fb>
+  80398e:	72 20                	jb     8039b0 <__rodata_start+0x2b8>
+  803990:	66 69 6c 65 5f 77 72 	imul   $0x7277,0x5f(%rbp,%riz,2),%bp
+  803997:	69 74 65 3a 20 25 6c 	imul   $0x646c2520,0x3a(%rbp,%riz,2),%esi
+  80399e:	64 
+  80399f:	00 66 69             	add    %ah,0x69(%rsi)
+  8039a2:	6c                   	insb   (%dx),%es:(%rdi)
+  8039a3:	65 5f                	gs pop %rdi
+  8039a5:	72 65                	jb     803a0c <__rodata_start+0x314>
+  8039a7:	61                   	(bad)
+  8039a8:	64 20 61 66          	and    %ah,%fs:0x66(%rcx)
+  8039ac:	74 65                	je     803a13 <__rodata_start+0x31b>
+  8039ae:	72 20                	jb     8039d0 <__rodata_start+0x2d8>
+  8039b0:	66 69 6c 65 5f 77 72 	imul   $0x7277,0x5f(%rbp,%riz,2),%bp
+  8039b7:	69 74 65 20 72 65 74 	imul   $0x75746572,0x20(%rbp,%riz,2),%esi
+  8039be:	75 
+  8039bf:	72 6e                	jb     803a2f <__rodata_start+0x337>
+  8039c1:	65 64 20 77 72       	gs and %dh,%fs:0x72(%rdi)
+  8039c6:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8039c7:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8039c8:	67 20 6c 65 6e       	and    %ch,0x6e(%ebp,%eiz,2)
+  8039cd:	67 74 68             	addr32 je 803a38 <__rodata_start+0x340>
+  8039d0:	3a 20                	cmp    (%rax),%ah
+  8039d2:	25 6c 64 00 00       	and    $0x646c,%eax
+  8039d7:	00 66 69             	add    %ah,0x69(%rsi)
+  8039da:	6c                   	insb   (%dx),%es:(%rdi)
+  8039db:	65 5f                	gs pop %rdi
+  8039dd:	72 65                	jb     803a44 <__rodata_start+0x34c>
+  8039df:	61                   	(bad)
+  8039e0:	64 20 61 66          	and    %ah,%fs:0x66(%rcx)
+  8039e4:	74 65                	je     803a4b <__rodata_start+0x353>
+  8039e6:	72 20                	jb     803a08 <__rodata_start+0x310>
+  8039e8:	66 69 6c 65 5f 77 72 	imul   $0x7277,0x5f(%rbp,%riz,2),%bp
+  8039ef:	69 74 65 20 72 65 74 	imul   $0x75746572,0x20(%rbp,%riz,2),%esi
+  8039f6:	75 
+  8039f7:	72 6e                	jb     803a67 <__rodata_start+0x36f>
+  8039f9:	65 64 20 77 72       	gs and %dh,%fs:0x72(%rdi)
+  8039fe:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8039ff:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803a00:	67 20 64 61 74       	and    %ah,0x74(%ecx,%eiz,2)
+  803a05:	61                   	(bad)
+  803a06:	00 00                	add    %al,(%rax)
+  803a08:	66 69 6c 65 5f 72 65 	imul   $0x6572,0x5f(%rbp,%riz,2),%bp
+  803a0f:	61                   	(bad)
+  803a10:	64 20 61 66          	and    %ah,%fs:0x66(%rcx)
+  803a14:	74 65                	je     803a7b <__rodata_start+0x383>
+  803a16:	72 20                	jb     803a38 <__rodata_start+0x340>
+  803a18:	66 69 6c 65 5f 77 72 	imul   $0x7277,0x5f(%rbp,%riz,2),%bp
+  803a1f:	69 74 65 20 69 73 20 	imul   $0x67207369,0x20(%rbp,%riz,2),%esi
+  803a26:	67 
+  803a27:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803a28:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803a29:	64 0a 00             	or     %fs:(%rax),%al
+  803a2c:	00 00                	add    %al,(%rax)
+  803a2e:	00 00                	add    %al,(%rax)
+  803a30:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803a31:	70 65                	jo     803a98 <__rodata_start+0x3a0>
+  803a33:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803a34:	20 64 69 64          	and    %ah,0x64(%rcx,%rbp,2)
+  803a38:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  803a3b:	74 20                	je     803a5d <__rodata_start+0x365>
+  803a3d:	66 69 6c 6c 20 73 74 	imul   $0x7473,0x20(%rsp,%rbp,2),%bp
+  803a44:	72 75                	jb     803abb <__rodata_start+0x3c3>
+  803a46:	63 74 20 46          	movsxd 0x46(%rax,%riz,1),%esi
+  803a4a:	64 20 63 6f          	and    %ah,%fs:0x6f(%rbx)
+  803a4e:	72 72                	jb     803ac2 <__rodata_start+0x3ca>
+  803a50:	65 63 74 6c 79       	movsxd %gs:0x79(%rsp,%rbp,2),%esi
+  803a55:	0a 00                	or     (%rax),%al
+  803a57:	00 72 65             	add    %dh,0x65(%rdx)
+  803a5a:	61                   	(bad)
+  803a5b:	64 20 2f             	and    %ch,%fs:(%rdi)
+  803a5e:	62                   	(bad)
+  803a5f:	69 67 20 66 72 6f 6d 	imul   $0x6d6f7266,0x20(%rdi),%esp
+  803a66:	20 25 6c 64 20 72    	and    %ah,0x7220646c(%rip)        # 72a09ed8 <__bss_end+0x72200ed8>
+  803a6c:	65 74 75             	gs je  803ae4 <__rodata_start+0x3ec>
+  803a6f:	72 6e                	jb     803adf <__rodata_start+0x3e7>
+  803a71:	65 64 20 25 6c 64 20 	gs and %ah,%fs:0x3c20646c(%rip)        # 3ca09ee5 <__bss_end+0x3c200ee5>
+  803a78:	3c 
+  803a79:	20 25 64 20 62 79    	and    %ah,0x79622064(%rip)        # 79e25ae3 <__bss_end+0x7961cae3>
+  803a7f:	74 65                	je     803ae6 <__rodata_start+0x3ee>
+  803a81:	73 00                	jae    803a83 <__rodata_start+0x38b>
+  803a83:	00 00                	add    %al,(%rax)
+  803a85:	00 00                	add    %al,(%rax)
+  803a87:	00 72 65             	add    %dh,0x65(%rdx)
+  803a8a:	61                   	(bad)
+  803a8b:	64 20 2f             	and    %ch,%fs:(%rdi)
+  803a8e:	62                   	(bad)
+  803a8f:	69 67 20 66 72 6f 6d 	imul   $0x6d6f7266,0x20(%rdi),%esp
+  803a96:	20 25 6c 64 20 72    	and    %ah,0x7220646c(%rip)        # 72a09f08 <__bss_end+0x72200f08>
+  803a9c:	65 74 75             	gs je  803b14 <__rodata_start+0x41c>
+  803a9f:	72 6e                	jb     803b0f <__rodata_start+0x417>
+  803aa1:	65 64 20 62 61       	gs and %ah,%fs:0x61(%rdx)
+  803aa6:	64 20 64 61 74       	and    %ah,%fs:0x74(%rcx,%riz,2)
+  803aab:	61                   	(bad)
+  803aac:	20 25 64 00 54 68    	and    %ah,0x68540064(%rip)        # 68d43b16 <__bss_end+0x6853ab16>
+  803ab2:	69 73 20 69 73 20 74 	imul   $0x74207369,0x20(%rbx),%esi
+  803ab9:	68 65 20 4e 45       	push   $0x454e2065
+  803abe:	57                   	push   %rdi
+  803abf:	20 6d 65             	and    %ch,0x65(%rbp)
+  803ac2:	73 73                	jae    803b37 <__rodata_start+0x43f>
+  803ac4:	61                   	(bad)
+  803ac5:	67 65 20 6f 66       	and    %ch,%gs:0x66(%edi)
+  803aca:	20 74 68 65          	and    %dh,0x65(%rax,%rbp,2)
+  803ace:	20 64 61 79          	and    %ah,0x79(%rcx,%riz,2)
+  803ad2:	21 0a                	and    %ecx,(%rdx)
+  803ad4:	0a 00                	or     (%rax),%al
+  803ad6:	3c 75                	cmp    $0x75,%al
+  803ad8:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803ad9:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  803add:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803ade:	3e 00 5b 25          	ds add %bl,0x25(%rbx)
+  803ae2:	30 38                	xor    %bh,(%rax)
+  803ae4:	78 5d                	js     803b43 <__rodata_start+0x44b>
+  803ae6:	20 75 73             	and    %dh,0x73(%rbp)
+  803ae9:	65 72 20             	gs jb  803b0c <__rodata_start+0x414>
+  803aec:	70 61                	jo     803b4f <__rodata_start+0x457>
+  803aee:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803aef:	69 63 20 69 6e 20 25 	imul   $0x25206e69,0x20(%rbx),%esp
+  803af6:	73 20                	jae    803b18 <__rodata_start+0x420>
+  803af8:	61                   	(bad)
+  803af9:	74 20                	je     803b1b <__rodata_start+0x423>
+  803afb:	25 73 3a 25 64       	and    $0x64253a73,%eax
+  803b00:	3a 20                	cmp    (%rax),%ah
+  803b02:	00 30                	add    %dh,(%rax)
+  803b04:	31 32                	xor    %esi,(%rdx)
+  803b06:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  803b0d:	41                   	rex.B
+  803b0e:	42                   	rex.X
+  803b0f:	43                   	rex.XB
+  803b10:	44                   	rex.R
+  803b11:	45                   	rex.RB
+  803b12:	46 00 30             	rex.RX add %r14b,(%rax)
+  803b15:	31 32                	xor    %esi,(%rdx)
+  803b17:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  803b1e:	61                   	(bad)
+  803b1f:	62 63 64 65 66       	(bad)
+  803b24:	00 28                	add    %ch,(%rax)
+  803b26:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803b27:	75 6c                	jne    803b95 <__rodata_start+0x49d>
+  803b29:	6c                   	insb   (%dx),%es:(%rdi)
+  803b2a:	29 00                	sub    %eax,(%rax)
+  803b2c:	65 72 72             	gs jb  803ba1 <__rodata_start+0x4a9>
+  803b2f:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803b30:	72 20                	jb     803b52 <__rodata_start+0x45a>
+  803b32:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  803b37:	73 70                	jae    803ba9 <__rodata_start+0x4b1>
+  803b39:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  803b3d:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  803b44:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803b45:	72 00                	jb     803b47 <__rodata_start+0x44f>
+  803b47:	62 61 64 20 65       	(bad)
+  803b4c:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803b4d:	76 69                	jbe    803bb8 <__rodata_start+0x4c0>
+  803b4f:	72 6f                	jb     803bc0 <__rodata_start+0x4c8>
+  803b51:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803b52:	6d                   	insl   (%dx),%es:(%rdi)
+  803b53:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803b55:	74 00                	je     803b57 <__rodata_start+0x45f>
+  803b57:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  803b5e:	20 70 61             	and    %dh,0x61(%rax)
+  803b61:	72 61                	jb     803bc4 <__rodata_start+0x4cc>
+  803b63:	6d                   	insl   (%dx),%es:(%rdi)
+  803b64:	65 74 65             	gs je  803bcc <__rodata_start+0x4d4>
+  803b67:	72 00                	jb     803b69 <__rodata_start+0x471>
+  803b69:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803b6a:	75 74                	jne    803be0 <__rodata_start+0x4e8>
+  803b6c:	20 6f 66             	and    %ch,0x66(%rdi)
+  803b6f:	20 6d 65             	and    %ch,0x65(%rbp)
+  803b72:	6d                   	insl   (%dx),%es:(%rdi)
+  803b73:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803b74:	72 79                	jb     803bef <__rodata_start+0x4f7>
+  803b76:	00 6f 75             	add    %ch,0x75(%rdi)
+  803b79:	74 20                	je     803b9b <__rodata_start+0x4a3>
+  803b7b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803b7c:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  803b80:	76 69                	jbe    803beb <__rodata_start+0x4f3>
+  803b82:	72 6f                	jb     803bf3 <__rodata_start+0x4fb>
+  803b84:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803b85:	6d                   	insl   (%dx),%es:(%rdi)
+  803b86:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803b88:	74 73                	je     803bfd <__rodata_start+0x505>
+  803b8a:	00 63 6f             	add    %ah,0x6f(%rbx)
+  803b8d:	72 72                	jb     803c01 <__rodata_start+0x509>
+  803b8f:	75 70                	jne    803c01 <__rodata_start+0x509>
+  803b91:	74 65                	je     803bf8 <__rodata_start+0x500>
+  803b93:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  803b98:	75 67                	jne    803c01 <__rodata_start+0x509>
+  803b9a:	20 69 6e             	and    %ch,0x6e(%rcx)
+  803b9d:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  803b9f:	00 73 65             	add    %dh,0x65(%rbx)
+  803ba2:	67 6d                	insl   (%dx),%es:(%edi)
+  803ba4:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803ba6:	74 61                	je     803c09 <__rodata_start+0x511>
+  803ba8:	74 69                	je     803c13 <__rodata_start+0x51b>
+  803baa:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803bab:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803bac:	20 66 61             	and    %ah,0x61(%rsi)
+  803baf:	75 6c                	jne    803c1d <__rodata_start+0x525>
+  803bb1:	74 00                	je     803bb3 <__rodata_start+0x4bb>
+  803bb3:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  803bba:	20 45 4c             	and    %al,0x4c(%rbp)
+  803bbd:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  803bc1:	61                   	(bad)
+  803bc2:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  803bc7:	20 73 75             	and    %dh,0x75(%rbx)
+  803bca:	63 68 20             	movsxd 0x20(%rax),%ebp
+  803bcd:	73 79                	jae    803c48 <__rodata_start+0x550>
+  803bcf:	73 74                	jae    803c45 <__rodata_start+0x54d>
+  803bd1:	65 6d                	gs insl (%dx),%es:(%rdi)
+  803bd3:	20 63 61             	and    %ah,0x61(%rbx)
+  803bd6:	6c                   	insb   (%dx),%es:(%rdi)
+  803bd7:	6c                   	insb   (%dx),%es:(%rdi)
+  803bd8:	00 65 6e             	add    %ah,0x6e(%rbp)
+  803bdb:	74 72                	je     803c4f <__rodata_start+0x557>
+  803bdd:	79 20                	jns    803bff <__rodata_start+0x507>
+  803bdf:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803be0:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803be1:	74 20                	je     803c03 <__rodata_start+0x50b>
+  803be3:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  803be5:	75 6e                	jne    803c55 <__rodata_start+0x55d>
+  803be7:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  803beb:	76 20                	jbe    803c0d <__rodata_start+0x515>
+  803bed:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  803bf4:	72 65                	jb     803c5b <__rodata_start+0x563>
+  803bf6:	63 76 69             	movsxd 0x69(%rsi),%esi
+  803bf9:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803bfa:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  803bfe:	65 78 70             	gs js  803c71 <__rodata_start+0x579>
+  803c01:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  803c06:	20 65 6e             	and    %ah,0x6e(%rbp)
+  803c09:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  803c0d:	20 66 69             	and    %ah,0x69(%rsi)
+  803c10:	6c                   	insb   (%dx),%es:(%rdi)
+  803c11:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  803c15:	20 66 72             	and    %ah,0x72(%rsi)
+  803c18:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  803c1d:	61                   	(bad)
+  803c1e:	63 65 20             	movsxd 0x20(%rbp),%esp
+  803c21:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803c22:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803c23:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  803c27:	6b 00 74             	imul   $0x74,(%rax),%eax
+  803c2a:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803c2b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803c2c:	20 6d 61             	and    %ch,0x61(%rbp)
+  803c2f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803c30:	79 20                	jns    803c52 <__rodata_start+0x55a>
+  803c32:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  803c39:	72 65                	jb     803ca0 <__rodata_start+0x5a8>
+  803c3b:	20 6f 70             	and    %ch,0x70(%rdi)
+  803c3e:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803c40:	00 66 69             	add    %ah,0x69(%rsi)
+  803c43:	6c                   	insb   (%dx),%es:(%rdi)
+  803c44:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  803c48:	20 62 6c             	and    %ah,0x6c(%rdx)
+  803c4b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803c4c:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  803c4f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803c50:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803c51:	74 20                	je     803c73 <__rodata_start+0x57b>
+  803c53:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  803c55:	75 6e                	jne    803cc5 <__rodata_start+0x5cd>
+  803c57:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  803c5b:	76 61                	jbe    803cbe <__rodata_start+0x5c6>
+  803c5d:	6c                   	insb   (%dx),%es:(%rdi)
+  803c5e:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  803c65:	00 
+  803c66:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  803c6d:	72 65                	jb     803cd4 <__rodata_start+0x5dc>
+  803c6f:	61                   	(bad)
+  803c70:	64 79 20             	fs jns 803c93 <__rodata_start+0x59b>
+  803c73:	65 78 69             	gs js  803cdf <__rodata_start+0x5e7>
+  803c76:	73 74                	jae    803cec <__rodata_start+0x5f4>
+  803c78:	73 00                	jae    803c7a <__rodata_start+0x582>
+  803c7a:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803c7b:	70 65                	jo     803ce2 <__rodata_start+0x5ea>
+  803c7d:	72 61                	jb     803ce0 <__rodata_start+0x5e8>
+  803c7f:	74 69                	je     803cea <__rodata_start+0x5f2>
+  803c81:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803c82:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803c83:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  803c86:	74 20                	je     803ca8 <__rodata_start+0x5b0>
+  803c88:	73 75                	jae    803cff <__rodata_start+0x607>
+  803c8a:	70 70                	jo     803cfc <__rodata_start+0x604>
+  803c8c:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803c8d:	72 74                	jb     803d03 <__rodata_start+0x60b>
+  803c8f:	65 64 00 6f 70       	gs add %ch,%fs:0x70(%rdi)
+  803c94:	65 72 61             	gs jb  803cf8 <__rodata_start+0x600>
+  803c97:	74 69                	je     803d02 <__rodata_start+0x60a>
+  803c99:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803c9a:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803c9b:	20 69 6e             	and    %ch,0x6e(%rcx)
+  803c9e:	74 65                	je     803d05 <__rodata_start+0x60d>
+  803ca0:	72 72                	jb     803d14 <__rodata_start+0x61c>
+  803ca2:	75 70                	jne    803d14 <__rodata_start+0x61c>
+  803ca4:	74 65                	je     803d0b <__rodata_start+0x613>
+  803ca6:	64 00 6e 6f          	add    %ch,%fs:0x6f(%rsi)
+  803caa:	74 20                	je     803ccc <__rodata_start+0x5d4>
+  803cac:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803cae:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803caf:	75 67                	jne    803d18 <__rodata_start+0x620>
+  803cb1:	68 20 43 50 55       	push   $0x55504320
+  803cb6:	20 74 69 6d          	and    %dh,0x6d(%rcx,%rbp,2)
+  803cba:	65 00 0f             	add    %cl,%gs:(%rdi)
+  803cbd:	1f                   	(bad)
+  803cbe:	40 00 b7 0e 80 00 00 	add    %sil,0x800e(%rdi)
+  803cc5:	00 00                	add    %al,(%rax)
+  803cc7:	00 f8                	add    %bh,%al
+  803cc9:	14 80                	adc    $0x80,%al
+  803ccb:	00 00                	add    %al,(%rax)
+  803ccd:	00 00                	add    %al,(%rax)
+  803ccf:	00 e8                	add    %ch,%al
+  803cd1:	14 80                	adc    $0x80,%al
+  803cd3:	00 00                	add    %al,(%rax)
+  803cd5:	00 00                	add    %al,(%rax)
+  803cd7:	00 f8                	add    %bh,%al
+  803cd9:	14 80                	adc    $0x80,%al
+  803cdb:	00 00                	add    %al,(%rax)
+  803cdd:	00 00                	add    %al,(%rax)
+  803cdf:	00 f8                	add    %bh,%al
+  803ce1:	14 80                	adc    $0x80,%al
+  803ce3:	00 00                	add    %al,(%rax)
+  803ce5:	00 00                	add    %al,(%rax)
+  803ce7:	00 f8                	add    %bh,%al
+  803ce9:	14 80                	adc    $0x80,%al
+  803ceb:	00 00                	add    %al,(%rax)
+  803ced:	00 00                	add    %al,(%rax)
+  803cef:	00 f8                	add    %bh,%al
+  803cf1:	14 80                	adc    $0x80,%al
+  803cf3:	00 00                	add    %al,(%rax)
+  803cf5:	00 00                	add    %al,(%rax)
+  803cf7:	00 d6                	add    %dl,%dh
+  803cf9:	0e                   	(bad)
+  803cfa:	80 00 00             	addb   $0x0,(%rax)
+  803cfd:	00 00                	add    %al,(%rax)
+  803cff:	00 f8                	add    %bh,%al
+  803d01:	14 80                	adc    $0x80,%al
+  803d03:	00 00                	add    %al,(%rax)
+  803d05:	00 00                	add    %al,(%rax)
+  803d07:	00 f8                	add    %bh,%al
+  803d09:	14 80                	adc    $0x80,%al
+  803d0b:	00 00                	add    %al,(%rax)
+  803d0d:	00 00                	add    %al,(%rax)
+  803d0f:	00 ca                	add    %cl,%dl
+  803d11:	0e                   	(bad)
+  803d12:	80 00 00             	addb   $0x0,(%rax)
+  803d15:	00 00                	add    %al,(%rax)
+  803d17:	00 44 0f 80          	add    %al,-0x80(%rdi,%rcx,1)
+  803d1b:	00 00                	add    %al,(%rax)
+  803d1d:	00 00                	add    %al,(%rax)
+  803d1f:	00 f8                	add    %bh,%al
+  803d21:	14 80                	adc    $0x80,%al
+  803d23:	00 00                	add    %al,(%rax)
+  803d25:	00 00                	add    %al,(%rax)
+  803d27:	00 ca                	add    %cl,%dl
+  803d29:	0e                   	(bad)
+  803d2a:	80 00 00             	addb   $0x0,(%rax)
+  803d2d:	00 00                	add    %al,(%rax)
+  803d2f:	00 10                	add    %dl,(%rax)
+  803d31:	0f 80 00 00 00 00    	jo     803d37 <__rodata_start+0x63f>
+  803d37:	00 10                	add    %dl,(%rax)
+  803d39:	0f 80 00 00 00 00    	jo     803d3f <__rodata_start+0x647>
+  803d3f:	00 10                	add    %dl,(%rax)
+  803d41:	0f 80 00 00 00 00    	jo     803d47 <__rodata_start+0x64f>
+  803d47:	00 10                	add    %dl,(%rax)
+  803d49:	0f 80 00 00 00 00    	jo     803d4f <__rodata_start+0x657>
+  803d4f:	00 10                	add    %dl,(%rax)
+  803d51:	0f 80 00 00 00 00    	jo     803d57 <__rodata_start+0x65f>
+  803d57:	00 10                	add    %dl,(%rax)
+  803d59:	0f 80 00 00 00 00    	jo     803d5f <__rodata_start+0x667>
+  803d5f:	00 10                	add    %dl,(%rax)
+  803d61:	0f 80 00 00 00 00    	jo     803d67 <__rodata_start+0x66f>
+  803d67:	00 10                	add    %dl,(%rax)
+  803d69:	0f 80 00 00 00 00    	jo     803d6f <__rodata_start+0x677>
+  803d6f:	00 10                	add    %dl,(%rax)
+  803d71:	0f 80 00 00 00 00    	jo     803d77 <__rodata_start+0x67f>
+  803d77:	00 f8                	add    %bh,%al
+  803d79:	14 80                	adc    $0x80,%al
+  803d7b:	00 00                	add    %al,(%rax)
+  803d7d:	00 00                	add    %al,(%rax)
+  803d7f:	00 f8                	add    %bh,%al
+  803d81:	14 80                	adc    $0x80,%al
+  803d83:	00 00                	add    %al,(%rax)
+  803d85:	00 00                	add    %al,(%rax)
+  803d87:	00 f8                	add    %bh,%al
+  803d89:	14 80                	adc    $0x80,%al
+  803d8b:	00 00                	add    %al,(%rax)
+  803d8d:	00 00                	add    %al,(%rax)
+  803d8f:	00 f8                	add    %bh,%al
+  803d91:	14 80                	adc    $0x80,%al
+  803d93:	00 00                	add    %al,(%rax)
+  803d95:	00 00                	add    %al,(%rax)
+  803d97:	00 f8                	add    %bh,%al
+  803d99:	14 80                	adc    $0x80,%al
+  803d9b:	00 00                	add    %al,(%rax)
+  803d9d:	00 00                	add    %al,(%rax)
+  803d9f:	00 f8                	add    %bh,%al
+  803da1:	14 80                	adc    $0x80,%al
+  803da3:	00 00                	add    %al,(%rax)
+  803da5:	00 00                	add    %al,(%rax)
+  803da7:	00 f8                	add    %bh,%al
+  803da9:	14 80                	adc    $0x80,%al
+  803dab:	00 00                	add    %al,(%rax)
+  803dad:	00 00                	add    %al,(%rax)
+  803daf:	00 f8                	add    %bh,%al
+  803db1:	14 80                	adc    $0x80,%al
+  803db3:	00 00                	add    %al,(%rax)
+  803db5:	00 00                	add    %al,(%rax)
+  803db7:	00 f8                	add    %bh,%al
+  803db9:	14 80                	adc    $0x80,%al
+  803dbb:	00 00                	add    %al,(%rax)
+  803dbd:	00 00                	add    %al,(%rax)
+  803dbf:	00 f8                	add    %bh,%al
+  803dc1:	14 80                	adc    $0x80,%al
+  803dc3:	00 00                	add    %al,(%rax)
+  803dc5:	00 00                	add    %al,(%rax)
+  803dc7:	00 f8                	add    %bh,%al
+  803dc9:	14 80                	adc    $0x80,%al
+  803dcb:	00 00                	add    %al,(%rax)
+  803dcd:	00 00                	add    %al,(%rax)
+  803dcf:	00 f8                	add    %bh,%al
+  803dd1:	14 80                	adc    $0x80,%al
+  803dd3:	00 00                	add    %al,(%rax)
+  803dd5:	00 00                	add    %al,(%rax)
+  803dd7:	00 f8                	add    %bh,%al
+  803dd9:	14 80                	adc    $0x80,%al
+  803ddb:	00 00                	add    %al,(%rax)
+  803ddd:	00 00                	add    %al,(%rax)
+  803ddf:	00 f8                	add    %bh,%al
+  803de1:	14 80                	adc    $0x80,%al
+  803de3:	00 00                	add    %al,(%rax)
+  803de5:	00 00                	add    %al,(%rax)
+  803de7:	00 f8                	add    %bh,%al
+  803de9:	14 80                	adc    $0x80,%al
+  803deb:	00 00                	add    %al,(%rax)
+  803ded:	00 00                	add    %al,(%rax)
+  803def:	00 f8                	add    %bh,%al
+  803df1:	14 80                	adc    $0x80,%al
+  803df3:	00 00                	add    %al,(%rax)
+  803df5:	00 00                	add    %al,(%rax)
+  803df7:	00 f8                	add    %bh,%al
+  803df9:	14 80                	adc    $0x80,%al
+  803dfb:	00 00                	add    %al,(%rax)
+  803dfd:	00 00                	add    %al,(%rax)
+  803dff:	00 f8                	add    %bh,%al
+  803e01:	14 80                	adc    $0x80,%al
+  803e03:	00 00                	add    %al,(%rax)
+  803e05:	00 00                	add    %al,(%rax)
+  803e07:	00 f8                	add    %bh,%al
+  803e09:	14 80                	adc    $0x80,%al
+  803e0b:	00 00                	add    %al,(%rax)
+  803e0d:	00 00                	add    %al,(%rax)
+  803e0f:	00 f8                	add    %bh,%al
+  803e11:	14 80                	adc    $0x80,%al
+  803e13:	00 00                	add    %al,(%rax)
+  803e15:	00 00                	add    %al,(%rax)
+  803e17:	00 f8                	add    %bh,%al
+  803e19:	14 80                	adc    $0x80,%al
+  803e1b:	00 00                	add    %al,(%rax)
+  803e1d:	00 00                	add    %al,(%rax)
+  803e1f:	00 f8                	add    %bh,%al
+  803e21:	14 80                	adc    $0x80,%al
+  803e23:	00 00                	add    %al,(%rax)
+  803e25:	00 00                	add    %al,(%rax)
+  803e27:	00 f8                	add    %bh,%al
+  803e29:	14 80                	adc    $0x80,%al
+  803e2b:	00 00                	add    %al,(%rax)
+  803e2d:	00 00                	add    %al,(%rax)
+  803e2f:	00 f8                	add    %bh,%al
+  803e31:	14 80                	adc    $0x80,%al
+  803e33:	00 00                	add    %al,(%rax)
+  803e35:	00 00                	add    %al,(%rax)
+  803e37:	00 f8                	add    %bh,%al
+  803e39:	14 80                	adc    $0x80,%al
+  803e3b:	00 00                	add    %al,(%rax)
+  803e3d:	00 00                	add    %al,(%rax)
+  803e3f:	00 f8                	add    %bh,%al
+  803e41:	14 80                	adc    $0x80,%al
+  803e43:	00 00                	add    %al,(%rax)
+  803e45:	00 00                	add    %al,(%rax)
+  803e47:	00 f8                	add    %bh,%al
+  803e49:	14 80                	adc    $0x80,%al
+  803e4b:	00 00                	add    %al,(%rax)
+  803e4d:	00 00                	add    %al,(%rax)
+  803e4f:	00 f8                	add    %bh,%al
+  803e51:	14 80                	adc    $0x80,%al
+  803e53:	00 00                	add    %al,(%rax)
+  803e55:	00 00                	add    %al,(%rax)
+  803e57:	00 f8                	add    %bh,%al
+  803e59:	14 80                	adc    $0x80,%al
+  803e5b:	00 00                	add    %al,(%rax)
+  803e5d:	00 00                	add    %al,(%rax)
+  803e5f:	00 f8                	add    %bh,%al
+  803e61:	14 80                	adc    $0x80,%al
+  803e63:	00 00                	add    %al,(%rax)
+  803e65:	00 00                	add    %al,(%rax)
+  803e67:	00 1b                	add    %bl,(%rbx)
+  803e69:	14 80                	adc    $0x80,%al
+  803e6b:	00 00                	add    %al,(%rax)
+  803e6d:	00 00                	add    %al,(%rax)
+  803e6f:	00 f8                	add    %bh,%al
+  803e71:	14 80                	adc    $0x80,%al
+  803e73:	00 00                	add    %al,(%rax)
+  803e75:	00 00                	add    %al,(%rax)
+  803e77:	00 f8                	add    %bh,%al
+  803e79:	14 80                	adc    $0x80,%al
+  803e7b:	00 00                	add    %al,(%rax)
+  803e7d:	00 00                	add    %al,(%rax)
+  803e7f:	00 f8                	add    %bh,%al
+  803e81:	14 80                	adc    $0x80,%al
+  803e83:	00 00                	add    %al,(%rax)
+  803e85:	00 00                	add    %al,(%rax)
+  803e87:	00 f8                	add    %bh,%al
+  803e89:	14 80                	adc    $0x80,%al
+  803e8b:	00 00                	add    %al,(%rax)
+  803e8d:	00 00                	add    %al,(%rax)
+  803e8f:	00 f8                	add    %bh,%al
+  803e91:	14 80                	adc    $0x80,%al
+  803e93:	00 00                	add    %al,(%rax)
+  803e95:	00 00                	add    %al,(%rax)
+  803e97:	00 f8                	add    %bh,%al
+  803e99:	14 80                	adc    $0x80,%al
+  803e9b:	00 00                	add    %al,(%rax)
+  803e9d:	00 00                	add    %al,(%rax)
+  803e9f:	00 f8                	add    %bh,%al
+  803ea1:	14 80                	adc    $0x80,%al
+  803ea3:	00 00                	add    %al,(%rax)
+  803ea5:	00 00                	add    %al,(%rax)
+  803ea7:	00 f8                	add    %bh,%al
+  803ea9:	14 80                	adc    $0x80,%al
+  803eab:	00 00                	add    %al,(%rax)
+  803ead:	00 00                	add    %al,(%rax)
+  803eaf:	00 f8                	add    %bh,%al
+  803eb1:	14 80                	adc    $0x80,%al
+  803eb3:	00 00                	add    %al,(%rax)
+  803eb5:	00 00                	add    %al,(%rax)
+  803eb7:	00 f8                	add    %bh,%al
+  803eb9:	14 80                	adc    $0x80,%al
+  803ebb:	00 00                	add    %al,(%rax)
+  803ebd:	00 00                	add    %al,(%rax)
+  803ebf:	00 67 0f             	add    %ah,0xf(%rdi)
+  803ec2:	80 00 00             	addb   $0x0,(%rax)
+  803ec5:	00 00                	add    %al,(%rax)
+  803ec7:	00 36                	add    %dh,(%rsi)
+  803ec9:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  803ecf:	00 f8                	add    %bh,%al
+  803ed1:	14 80                	adc    $0x80,%al
+  803ed3:	00 00                	add    %al,(%rax)
+  803ed5:	00 00                	add    %al,(%rax)
+  803ed7:	00 f8                	add    %bh,%al
+  803ed9:	14 80                	adc    $0x80,%al
+  803edb:	00 00                	add    %al,(%rax)
+  803edd:	00 00                	add    %al,(%rax)
+  803edf:	00 f8                	add    %bh,%al
+  803ee1:	14 80                	adc    $0x80,%al
+  803ee3:	00 00                	add    %al,(%rax)
+  803ee5:	00 00                	add    %al,(%rax)
+  803ee7:	00 f8                	add    %bh,%al
+  803ee9:	14 80                	adc    $0x80,%al
+  803eeb:	00 00                	add    %al,(%rax)
+  803eed:	00 00                	add    %al,(%rax)
+  803eef:	00 96 0f 80 00 00    	add    %dl,0x800f(%rsi)
+  803ef5:	00 00                	add    %al,(%rax)
+  803ef7:	00 f8                	add    %bh,%al
+  803ef9:	14 80                	adc    $0x80,%al
+  803efb:	00 00                	add    %al,(%rax)
+  803efd:	00 00                	add    %al,(%rax)
+  803eff:	00 f8                	add    %bh,%al
+  803f01:	14 80                	adc    $0x80,%al
+  803f03:	00 00                	add    %al,(%rax)
+  803f05:	00 00                	add    %al,(%rax)
+  803f07:	00 5c 0f 80          	add    %bl,-0x80(%rdi,%rcx,1)
+  803f0b:	00 00                	add    %al,(%rax)
+  803f0d:	00 00                	add    %al,(%rax)
+  803f0f:	00 f8                	add    %bh,%al
+  803f11:	14 80                	adc    $0x80,%al
+  803f13:	00 00                	add    %al,(%rax)
+  803f15:	00 00                	add    %al,(%rax)
+  803f17:	00 f8                	add    %bh,%al
+  803f19:	14 80                	adc    $0x80,%al
+  803f1b:	00 00                	add    %al,(%rax)
+  803f1d:	00 00                	add    %al,(%rax)
+  803f1f:	00 de                	add    %bl,%dh
+  803f21:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  803f27:	00 a8 13 80 00 00    	add    %ch,0x8013(%rax)
+  803f2d:	00 00                	add    %al,(%rax)
+  803f2f:	00 f8                	add    %bh,%al
+  803f31:	14 80                	adc    $0x80,%al
+  803f33:	00 00                	add    %al,(%rax)
+  803f35:	00 00                	add    %al,(%rax)
+  803f37:	00 f8                	add    %bh,%al
+  803f39:	14 80                	adc    $0x80,%al
+  803f3b:	00 00                	add    %al,(%rax)
+  803f3d:	00 00                	add    %al,(%rax)
+  803f3f:	00 2d 10 80 00 00    	add    %ch,0x8010(%rip)        # 80bf55 <__bss_end+0x2f55>
+  803f45:	00 00                	add    %al,(%rax)
+  803f47:	00 f8                	add    %bh,%al
+  803f49:	14 80                	adc    $0x80,%al
+  803f4b:	00 00                	add    %al,(%rax)
+  803f4d:	00 00                	add    %al,(%rax)
+  803f4f:	00 0a                	add    %cl,(%rdx)
+  803f51:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  803f57:	00 f8                	add    %bh,%al
+  803f59:	14 80                	adc    $0x80,%al
+  803f5b:	00 00                	add    %al,(%rax)
+  803f5d:	00 00                	add    %al,(%rax)
+  803f5f:	00 f8                	add    %bh,%al
+  803f61:	14 80                	adc    $0x80,%al
+  803f63:	00 00                	add    %al,(%rax)
+  803f65:	00 00                	add    %al,(%rax)
+  803f67:	00 1b                	add    %bl,(%rbx)
+  803f69:	14 80                	adc    $0x80,%al
+  803f6b:	00 00                	add    %al,(%rax)
+  803f6d:	00 00                	add    %al,(%rax)
+  803f6f:	00 f8                	add    %bh,%al
+  803f71:	14 80                	adc    $0x80,%al
+  803f73:	00 00                	add    %al,(%rax)
+  803f75:	00 00                	add    %al,(%rax)
+  803f77:	00 c0                	add    %al,%al
+  803f79:	0e                   	(bad)
+  803f7a:	80 00 00             	addb   $0x0,(%rax)
+  803f7d:	00 00                	add    %al,(%rax)
+	...
+
+0000000000803f80 <error_string>:
+	...
+  803f88:	35 3b 80 00 00 00 00 00 47 3b 80 00 00 00 00 00     5;......G;......
+  803f98:	57 3b 80 00 00 00 00 00 69 3b 80 00 00 00 00 00     W;......i;......
+  803fa8:	77 3b 80 00 00 00 00 00 8b 3b 80 00 00 00 00 00     w;.......;......
+  803fb8:	a0 3b 80 00 00 00 00 00 b3 3b 80 00 00 00 00 00     .;.......;......
+  803fc8:	c5 3b 80 00 00 00 00 00 d9 3b 80 00 00 00 00 00     .;.......;......
+  803fd8:	e9 3b 80 00 00 00 00 00 fc 3b 80 00 00 00 00 00     .;.......;......
+  803fe8:	13 3c 80 00 00 00 00 00 29 3c 80 00 00 00 00 00     .<......)<......
+  803ff8:	41 3c 80 00 00 00 00 00 59 3c 80 00 00 00 00 00     A<......Y<......
+  804008:	66 3c 80 00 00 00 00 00 30 40 80 00 00 00 00 00     f<......0@......
+  804018:	7a 3c 80 00 00 00 00 00 92 3c 80 00 00 00 00 00     z<.......<......
+  804028:	a8 3c 80 00 00 00 00 00 66 69 6c 65 20 69 73 20     .<......file is 
+  804038:	6e 6f 74 20 61 20 76 61 6c 69 64 20 65 78 65 63     not a valid exec
+  804048:	75 74 61 62 6c 65 00 90 73 79 73 63 61 6c 6c 20     utable..syscall 
+  804058:	25 7a 64 20 72 65 74 75 72 6e 65 64 20 25 7a 64     %zd returned %zd
+  804068:	20 28 3e 20 30 29 00 6c 69 62 2f 73 79 73 63 61      (> 0).lib/sysca
+  804078:	6c 6c 2e 63 00 73 79 73 5f 69 70 63 5f 74 72 79     ll.c.sys_ipc_try
+  804088:	5f 73 65 6e 64 20 66 61 69 6c 65 64 3a 20 25 69     _send failed: %i
+  804098:	00 6c 69 62 2f 69 70 63 2e 63 00 0f 1f 44 00 00     .lib/ipc.c...D..
+  8040a8:	5b 25 30 38 78 5d 20 75 6e 6b 6e 6f 77 6e 20 64     [%08x] unknown d
+  8040b8:	65 76 69 63 65 20 74 79 70 65 20 25 64 0a 00 00     evice type %d...
+  8040c8:	5b 25 30 38 78 5d 20 66 74 72 75 6e 63 61 74 65     [%08x] ftruncate
+  8040d8:	20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65 0a      %d -- bad mode.
+  8040e8:	00 5b 25 30 38 78 5d 20 72 65 61 64 20 25 64 20     .[%08x] read %d 
+  8040f8:	2d 2d 20 62 61 64 20 6d 6f 64 65 0a 00 5b 25 30     -- bad mode..[%0
+  804108:	38 78 5d 20 77 72 69 74 65 20 25 64 20 2d 2d 20     8x] write %d -- 
+  804118:	62 61 64 20 6d 6f 64 65 0a 00 66 2e 0f 1f 84 00     bad mode..f.....
+  804128:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804138:	0f 1f 84 00 00 00 00 00                             ........
+
+0000000000804140 <devtab>:
+  804140:	20 50 80 00 00 00 00 00 60 50 80 00 00 00 00 00      P......`P......
+  804150:	a0 50 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .P..............
+  804160:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  804170:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  804180:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  804190:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  8041a0:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  8041b0:	3d 20 32 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73 00     = 2.<cons>.cons.
+  8041c0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8041d0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8041e0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8041f0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804200:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804210:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804220:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804230:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804240:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804250:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804260:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804270:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804280:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804290:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8042a0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8042b0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8042c0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8042d0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8042e0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8042f0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804300:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804310:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804320:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804330:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804340:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804350:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804360:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804370:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804380:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804390:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8043a0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8043b0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8043c0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8043d0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8043e0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8043f0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804400:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804410:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804420:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804430:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804440:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804450:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804460:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804470:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804480:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804490:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8044a0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8044b0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8044c0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8044d0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8044e0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8044f0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804500:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804510:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804520:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804530:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804540:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804550:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804560:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804570:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804580:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804590:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8045a0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8045b0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8045c0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8045d0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8045e0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8045f0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804600:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804610:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804620:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804630:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804640:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804650:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804660:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804670:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804680:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804690:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8046a0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8046b0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8046c0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8046d0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8046e0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8046f0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804700:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804710:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804720:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804730:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804740:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804750:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804760:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804770:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804780:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804790:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8047a0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8047b0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8047c0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8047d0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8047e0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8047f0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804800:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804810:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804820:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804830:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804840:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804850:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804860:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804870:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804880:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804890:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8048a0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8048b0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8048c0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8048d0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8048e0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8048f0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804900:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804910:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804920:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804930:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804940:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804950:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804960:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804970:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804980:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804990:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8049a0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8049b0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8049c0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8049d0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8049e0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8049f0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804a00:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804a10:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804a20:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804a30:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804a40:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804a50:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804a60:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804a70:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804a80:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804a90:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804aa0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804ab0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804ac0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804ad0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804ae0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804af0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804b00:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804b10:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804b20:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804b30:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804b40:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804b50:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804b60:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804b70:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804b80:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804b90:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804ba0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804bb0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804bc0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804bd0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804be0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804bf0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804c00:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804c10:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804c20:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804c30:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804c40:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804c50:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804c60:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804c70:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804c80:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804c90:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804ca0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804cb0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804cc0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804cd0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804ce0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804cf0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804d00:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804d10:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804d20:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804d30:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804d40:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804d50:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804d60:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804d70:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804d80:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804d90:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804da0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804db0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804dc0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804dd0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804de0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804df0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804e00:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804e10:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804e20:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804e30:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804e40:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804e50:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804e60:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804e70:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804e80:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804e90:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804ea0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804eb0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804ec0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804ed0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804ee0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804ef0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804f00:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804f10:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804f20:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804f30:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804f40:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804f50:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804f60:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804f70:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804f80:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804f90:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804fa0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804fb0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804fc0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804fd0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804fe0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804ff0:	0f 1f 84 00 00 00 00 00 0f 1f 84 00 00 00 00 00     ................
@@ -0,0 +1,6143 @@
+
+obj/user/testkbd:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 71 03 00 00       	call   800394 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 56                	push   %r14
+  80002b:	41 55                	push   %r13
+  80002d:	41 54                	push   %r12
+  80002f:	53                   	push   %rbx
+  800030:	bb 0a 00 00 00       	mov    $0xa,%ebx
+    int r;
+
+    /* Spin for a bit to let the console quiet */
+    for (int i = 0; i < 10; ++i)
+        sys_yield();
+  800035:	49 bc 40 15 80 00 00 	movabs $0x801540,%r12
+  80003c:	00 00 00 
+  80003f:	41 ff d4             	call   *%r12
+    for (int i = 0; i < 10; ++i)
+  800042:	83 eb 01             	sub    $0x1,%ebx
+  800045:	75 f8                	jne    80003f <umain+0x1a>
+
+    close(0);
+  800047:	bf 00 00 00 00       	mov    $0x0,%edi
+  80004c:	48 b8 30 1c 80 00 00 	movabs $0x801c30,%rax
+  800053:	00 00 00 
+  800056:	ff d0                	call   *%rax
+    if ((r = opencons()) < 0)
+  800058:	48 b8 2d 03 80 00 00 	movabs $0x80032d,%rax
+  80005f:	00 00 00 
+  800062:	ff d0                	call   *%rax
+  800064:	85 c0                	test   %eax,%eax
+  800066:	78 2f                	js     800097 <umain+0x72>
+        panic("opencons: %i", r);
+    if (r != 0)
+  800068:	74 5a                	je     8000c4 <umain+0x9f>
+        panic("first opencons used fd %d", r);
+  80006a:	89 c1                	mov    %eax,%ecx
+  80006c:	48 ba c4 30 80 00 00 	movabs $0x8030c4,%rdx
+  800073:	00 00 00 
+  800076:	be 10 00 00 00       	mov    $0x10,%esi
+  80007b:	48 bf b5 30 80 00 00 	movabs $0x8030b5,%rdi
+  800082:	00 00 00 
+  800085:	b8 00 00 00 00       	mov    $0x0,%eax
+  80008a:	49 b8 60 04 80 00 00 	movabs $0x800460,%r8
+  800091:	00 00 00 
+  800094:	41 ff d0             	call   *%r8
+        panic("opencons: %i", r);
+  800097:	89 c1                	mov    %eax,%ecx
+  800099:	48 ba a8 30 80 00 00 	movabs $0x8030a8,%rdx
+  8000a0:	00 00 00 
+  8000a3:	be 0e 00 00 00       	mov    $0xe,%esi
+  8000a8:	48 bf b5 30 80 00 00 	movabs $0x8030b5,%rdi
+  8000af:	00 00 00 
+  8000b2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000b7:	49 b8 60 04 80 00 00 	movabs $0x800460,%r8
+  8000be:	00 00 00 
+  8000c1:	41 ff d0             	call   *%r8
+    if ((r = dup(0, 1)) < 0)
+  8000c4:	be 01 00 00 00       	mov    $0x1,%esi
+  8000c9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8000ce:	48 b8 8b 1c 80 00 00 	movabs $0x801c8b,%rax
+  8000d5:	00 00 00 
+  8000d8:	ff d0                	call   *%rax
+        panic("dup: %i", r);
+
+    for (;;) {
+        char *buf;
+
+        buf = readline("Type a line: ");
+  8000da:	49 bc e6 30 80 00 00 	movabs $0x8030e6,%r12
+  8000e1:	00 00 00 
+  8000e4:	48 bb fc 12 80 00 00 	movabs $0x8012fc,%rbx
+  8000eb:	00 00 00 
+        if (buf != NULL)
+            fprintf(1, "%s\n", buf);
+        else
+            fprintf(1, "(end of file received)\n");
+  8000ee:	49 be f8 30 80 00 00 	movabs $0x8030f8,%r14
+  8000f5:	00 00 00 
+  8000f8:	49 bd bc 26 80 00 00 	movabs $0x8026bc,%r13
+  8000ff:	00 00 00 
+    if ((r = dup(0, 1)) < 0)
+  800102:	85 c0                	test   %eax,%eax
+  800104:	79 44                	jns    80014a <umain+0x125>
+        panic("dup: %i", r);
+  800106:	89 c1                	mov    %eax,%ecx
+  800108:	48 ba de 30 80 00 00 	movabs $0x8030de,%rdx
+  80010f:	00 00 00 
+  800112:	be 12 00 00 00       	mov    $0x12,%esi
+  800117:	48 bf b5 30 80 00 00 	movabs $0x8030b5,%rdi
+  80011e:	00 00 00 
+  800121:	b8 00 00 00 00       	mov    $0x0,%eax
+  800126:	49 b8 60 04 80 00 00 	movabs $0x800460,%r8
+  80012d:	00 00 00 
+  800130:	41 ff d0             	call   *%r8
+            fprintf(1, "%s\n", buf);
+  800133:	48 be f4 30 80 00 00 	movabs $0x8030f4,%rsi
+  80013a:	00 00 00 
+  80013d:	bf 01 00 00 00       	mov    $0x1,%edi
+  800142:	b8 00 00 00 00       	mov    $0x0,%eax
+  800147:	41 ff d5             	call   *%r13
+        buf = readline("Type a line: ");
+  80014a:	4c 89 e7             	mov    %r12,%rdi
+  80014d:	ff d3                	call   *%rbx
+  80014f:	48 89 c2             	mov    %rax,%rdx
+        if (buf != NULL)
+  800152:	48 85 c0             	test   %rax,%rax
+  800155:	75 dc                	jne    800133 <umain+0x10e>
+            fprintf(1, "(end of file received)\n");
+  800157:	4c 89 f6             	mov    %r14,%rsi
+  80015a:	bf 01 00 00 00       	mov    $0x1,%edi
+  80015f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800164:	41 ff d5             	call   *%r13
+  800167:	eb e1                	jmp    80014a <umain+0x125>
+
+0000000000800169 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  800169:	b8 00 00 00 00       	mov    $0x0,%eax
+  80016e:	c3                   	ret
+
+000000000080016f <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  80016f:	55                   	push   %rbp
+  800170:	48 89 e5             	mov    %rsp,%rbp
+  800173:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  800176:	48 be 10 31 80 00 00 	movabs $0x803110,%rsi
+  80017d:	00 00 00 
+  800180:	48 b8 d5 0e 80 00 00 	movabs $0x800ed5,%rax
+  800187:	00 00 00 
+  80018a:	ff d0                	call   *%rax
+    return 0;
+}
+  80018c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800191:	5d                   	pop    %rbp
+  800192:	c3                   	ret
+
+0000000000800193 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  800193:	55                   	push   %rbp
+  800194:	48 89 e5             	mov    %rsp,%rbp
+  800197:	41 57                	push   %r15
+  800199:	41 56                	push   %r14
+  80019b:	41 55                	push   %r13
+  80019d:	41 54                	push   %r12
+  80019f:	53                   	push   %rbx
+  8001a0:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  8001a7:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  8001ae:	48 85 d2             	test   %rdx,%rdx
+  8001b1:	74 7a                	je     80022d <devcons_write+0x9a>
+  8001b3:	49 89 d6             	mov    %rdx,%r14
+  8001b6:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8001bc:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  8001c1:	49 bf cf 10 80 00 00 	movabs $0x8010cf,%r15
+  8001c8:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  8001cb:	4c 89 f3             	mov    %r14,%rbx
+  8001ce:	48 29 f3             	sub    %rsi,%rbx
+  8001d1:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8001d6:	48 39 c3             	cmp    %rax,%rbx
+  8001d9:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  8001dd:	4c 63 eb             	movslq %ebx,%r13
+  8001e0:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  8001e7:	48 01 c6             	add    %rax,%rsi
+  8001ea:	4c 89 ea             	mov    %r13,%rdx
+  8001ed:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  8001f4:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  8001f7:	4c 89 ee             	mov    %r13,%rsi
+  8001fa:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  800201:	48 b8 46 14 80 00 00 	movabs $0x801446,%rax
+  800208:	00 00 00 
+  80020b:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  80020d:	41 01 dc             	add    %ebx,%r12d
+  800210:	49 63 f4             	movslq %r12d,%rsi
+  800213:	4c 39 f6             	cmp    %r14,%rsi
+  800216:	72 b3                	jb     8001cb <devcons_write+0x38>
+    return res;
+  800218:	49 63 c4             	movslq %r12d,%rax
+}
+  80021b:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  800222:	5b                   	pop    %rbx
+  800223:	41 5c                	pop    %r12
+  800225:	41 5d                	pop    %r13
+  800227:	41 5e                	pop    %r14
+  800229:	41 5f                	pop    %r15
+  80022b:	5d                   	pop    %rbp
+  80022c:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  80022d:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  800233:	eb e3                	jmp    800218 <devcons_write+0x85>
+
+0000000000800235 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  800235:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  800238:	ba 00 00 00 00       	mov    $0x0,%edx
+  80023d:	48 85 c0             	test   %rax,%rax
+  800240:	74 55                	je     800297 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  800242:	55                   	push   %rbp
+  800243:	48 89 e5             	mov    %rsp,%rbp
+  800246:	41 55                	push   %r13
+  800248:	41 54                	push   %r12
+  80024a:	53                   	push   %rbx
+  80024b:	48 83 ec 08          	sub    $0x8,%rsp
+  80024f:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  800252:	48 bb 73 14 80 00 00 	movabs $0x801473,%rbx
+  800259:	00 00 00 
+  80025c:	49 bc 40 15 80 00 00 	movabs $0x801540,%r12
+  800263:	00 00 00 
+  800266:	eb 03                	jmp    80026b <devcons_read+0x36>
+  800268:	41 ff d4             	call   *%r12
+  80026b:	ff d3                	call   *%rbx
+  80026d:	85 c0                	test   %eax,%eax
+  80026f:	74 f7                	je     800268 <devcons_read+0x33>
+    if (c < 0) return c;
+  800271:	48 63 d0             	movslq %eax,%rdx
+  800274:	78 13                	js     800289 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  800276:	ba 00 00 00 00       	mov    $0x0,%edx
+  80027b:	83 f8 04             	cmp    $0x4,%eax
+  80027e:	74 09                	je     800289 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  800280:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  800284:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  800289:	48 89 d0             	mov    %rdx,%rax
+  80028c:	48 83 c4 08          	add    $0x8,%rsp
+  800290:	5b                   	pop    %rbx
+  800291:	41 5c                	pop    %r12
+  800293:	41 5d                	pop    %r13
+  800295:	5d                   	pop    %rbp
+  800296:	c3                   	ret
+  800297:	48 89 d0             	mov    %rdx,%rax
+  80029a:	c3                   	ret
+
+000000000080029b <cputchar>:
+cputchar(int ch) {
+  80029b:	55                   	push   %rbp
+  80029c:	48 89 e5             	mov    %rsp,%rbp
+  80029f:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  8002a3:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  8002a7:	be 01 00 00 00       	mov    $0x1,%esi
+  8002ac:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  8002b0:	48 b8 46 14 80 00 00 	movabs $0x801446,%rax
+  8002b7:	00 00 00 
+  8002ba:	ff d0                	call   *%rax
+}
+  8002bc:	c9                   	leave
+  8002bd:	c3                   	ret
+
+00000000008002be <getchar>:
+getchar(void) {
+  8002be:	55                   	push   %rbp
+  8002bf:	48 89 e5             	mov    %rsp,%rbp
+  8002c2:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  8002c6:	ba 01 00 00 00       	mov    $0x1,%edx
+  8002cb:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  8002cf:	bf 00 00 00 00       	mov    $0x0,%edi
+  8002d4:	48 b8 ae 1d 80 00 00 	movabs $0x801dae,%rax
+  8002db:	00 00 00 
+  8002de:	ff d0                	call   *%rax
+  8002e0:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  8002e2:	85 c0                	test   %eax,%eax
+  8002e4:	78 06                	js     8002ec <getchar+0x2e>
+  8002e6:	74 08                	je     8002f0 <getchar+0x32>
+  8002e8:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  8002ec:	89 d0                	mov    %edx,%eax
+  8002ee:	c9                   	leave
+  8002ef:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  8002f0:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  8002f5:	eb f5                	jmp    8002ec <getchar+0x2e>
+
+00000000008002f7 <iscons>:
+iscons(int fdnum) {
+  8002f7:	55                   	push   %rbp
+  8002f8:	48 89 e5             	mov    %rsp,%rbp
+  8002fb:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8002ff:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  800303:	48 b8 cb 1a 80 00 00 	movabs $0x801acb,%rax
+  80030a:	00 00 00 
+  80030d:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80030f:	85 c0                	test   %eax,%eax
+  800311:	78 18                	js     80032b <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  800313:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800317:	48 b8 00 40 80 00 00 	movabs $0x804000,%rax
+  80031e:	00 00 00 
+  800321:	8b 00                	mov    (%rax),%eax
+  800323:	39 02                	cmp    %eax,(%rdx)
+  800325:	0f 94 c0             	sete   %al
+  800328:	0f b6 c0             	movzbl %al,%eax
+}
+  80032b:	c9                   	leave
+  80032c:	c3                   	ret
+
+000000000080032d <opencons>:
+opencons(void) {
+  80032d:	55                   	push   %rbp
+  80032e:	48 89 e5             	mov    %rsp,%rbp
+  800331:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  800335:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  800339:	48 b8 b1 1a 80 00 00 	movabs $0x801ab1,%rax
+  800340:	00 00 00 
+  800343:	ff d0                	call   *%rax
+  800345:	85 c0                	test   %eax,%eax
+  800347:	78 49                	js     800392 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  800349:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80034e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800353:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  800357:	bf 00 00 00 00       	mov    $0x0,%edi
+  80035c:	48 b8 cf 15 80 00 00 	movabs $0x8015cf,%rax
+  800363:	00 00 00 
+  800366:	ff d0                	call   *%rax
+  800368:	85 c0                	test   %eax,%eax
+  80036a:	78 26                	js     800392 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  80036c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800370:	a1 00 40 80 00 00 00 	movabs 0x804000,%eax
+  800377:	00 00 
+  800379:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  80037b:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80037f:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  800386:	48 b8 0a 1a 80 00 00 	movabs $0x801a0a,%rax
+  80038d:	00 00 00 
+  800390:	ff d0                	call   *%rax
+}
+  800392:	c9                   	leave
+  800393:	c3                   	ret
+
+0000000000800394 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800394:	55                   	push   %rbp
+  800395:	48 89 e5             	mov    %rsp,%rbp
+  800398:	41 56                	push   %r14
+  80039a:	41 55                	push   %r13
+  80039c:	41 54                	push   %r12
+  80039e:	53                   	push   %rbx
+  80039f:	41 89 fd             	mov    %edi,%r13d
+  8003a2:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  8003a5:	48 ba b8 40 80 00 00 	movabs $0x8040b8,%rdx
+  8003ac:	00 00 00 
+  8003af:	48 b8 b8 40 80 00 00 	movabs $0x8040b8,%rax
+  8003b6:	00 00 00 
+  8003b9:	48 39 c2             	cmp    %rax,%rdx
+  8003bc:	73 17                	jae    8003d5 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  8003be:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  8003c1:	49 89 c4             	mov    %rax,%r12
+  8003c4:	48 83 c3 08          	add    $0x8,%rbx
+  8003c8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003cd:	ff 53 f8             	call   *-0x8(%rbx)
+  8003d0:	4c 39 e3             	cmp    %r12,%rbx
+  8003d3:	72 ef                	jb     8003c4 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+    envid_t this_env_id = sys_getenvid();
+  8003d5:	48 b8 0f 15 80 00 00 	movabs $0x80150f,%rax
+  8003dc:	00 00 00 
+  8003df:	ff d0                	call   *%rax
+    thisenv = &((struct Env*)UENVS)[ENVX(this_env_id)];
+  8003e1:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8003e6:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+  8003ed:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8003f4:	00 00 00 
+  8003f7:	48 01 d0             	add    %rdx,%rax
+  8003fa:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  800401:	00 00 00 
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  800404:	45 85 ed             	test   %r13d,%r13d
+  800407:	7e 0d                	jle    800416 <libmain+0x82>
+  800409:	49 8b 06             	mov    (%r14),%rax
+  80040c:	48 a3 38 40 80 00 00 	movabs %rax,0x804038
+  800413:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  800416:	4c 89 f6             	mov    %r14,%rsi
+  800419:	44 89 ef             	mov    %r13d,%edi
+  80041c:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  800423:	00 00 00 
+  800426:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  800428:	48 b8 3d 04 80 00 00 	movabs $0x80043d,%rax
+  80042f:	00 00 00 
+  800432:	ff d0                	call   *%rax
+#endif
+}
+  800434:	5b                   	pop    %rbx
+  800435:	41 5c                	pop    %r12
+  800437:	41 5d                	pop    %r13
+  800439:	41 5e                	pop    %r14
+  80043b:	5d                   	pop    %rbp
+  80043c:	c3                   	ret
+
+000000000080043d <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  80043d:	55                   	push   %rbp
+  80043e:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  800441:	48 b8 63 1c 80 00 00 	movabs $0x801c63,%rax
+  800448:	00 00 00 
+  80044b:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  80044d:	bf 00 00 00 00       	mov    $0x0,%edi
+  800452:	48 b8 a4 14 80 00 00 	movabs $0x8014a4,%rax
+  800459:	00 00 00 
+  80045c:	ff d0                	call   *%rax
+}
+  80045e:	5d                   	pop    %rbp
+  80045f:	c3                   	ret
+
+0000000000800460 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  800460:	55                   	push   %rbp
+  800461:	48 89 e5             	mov    %rsp,%rbp
+  800464:	41 56                	push   %r14
+  800466:	41 55                	push   %r13
+  800468:	41 54                	push   %r12
+  80046a:	53                   	push   %rbx
+  80046b:	48 83 ec 50          	sub    $0x50,%rsp
+  80046f:	49 89 fc             	mov    %rdi,%r12
+  800472:	41 89 f5             	mov    %esi,%r13d
+  800475:	48 89 d3             	mov    %rdx,%rbx
+  800478:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  80047c:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  800480:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800484:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  80048b:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80048f:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  800493:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  800497:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  80049b:	48 b8 38 40 80 00 00 	movabs $0x804038,%rax
+  8004a2:	00 00 00 
+  8004a5:	4c 8b 30             	mov    (%rax),%r14
+  8004a8:	48 b8 0f 15 80 00 00 	movabs $0x80150f,%rax
+  8004af:	00 00 00 
+  8004b2:	ff d0                	call   *%rax
+  8004b4:	89 c6                	mov    %eax,%esi
+  8004b6:	45 89 e8             	mov    %r13d,%r8d
+  8004b9:	4c 89 e1             	mov    %r12,%rcx
+  8004bc:	4c 89 f2             	mov    %r14,%rdx
+  8004bf:	48 bf 28 31 80 00 00 	movabs $0x803128,%rdi
+  8004c6:	00 00 00 
+  8004c9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004ce:	49 bc b0 05 80 00 00 	movabs $0x8005b0,%r12
+  8004d5:	00 00 00 
+  8004d8:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  8004db:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  8004df:	48 89 df             	mov    %rbx,%rdi
+  8004e2:	48 b8 4c 05 80 00 00 	movabs $0x80054c,%rax
+  8004e9:	00 00 00 
+  8004ec:	ff d0                	call   *%rax
+    cprintf("\n");
+  8004ee:	48 bf 0e 31 80 00 00 	movabs $0x80310e,%rdi
+  8004f5:	00 00 00 
+  8004f8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004fd:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  800500:	cc                   	int3
+  800501:	eb fd                	jmp    800500 <_panic+0xa0>
+
+0000000000800503 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  800503:	55                   	push   %rbp
+  800504:	48 89 e5             	mov    %rsp,%rbp
+  800507:	53                   	push   %rbx
+  800508:	48 83 ec 08          	sub    $0x8,%rsp
+  80050c:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  80050f:	8b 06                	mov    (%rsi),%eax
+  800511:	8d 50 01             	lea    0x1(%rax),%edx
+  800514:	89 16                	mov    %edx,(%rsi)
+  800516:	48 98                	cltq
+  800518:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  80051d:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  800523:	74 0a                	je     80052f <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  800525:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  800529:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80052d:	c9                   	leave
+  80052e:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  80052f:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  800533:	be ff 00 00 00       	mov    $0xff,%esi
+  800538:	48 b8 46 14 80 00 00 	movabs $0x801446,%rax
+  80053f:	00 00 00 
+  800542:	ff d0                	call   *%rax
+        state->offset = 0;
+  800544:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  80054a:	eb d9                	jmp    800525 <putch+0x22>
+
+000000000080054c <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  80054c:	55                   	push   %rbp
+  80054d:	48 89 e5             	mov    %rsp,%rbp
+  800550:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  800557:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  80055a:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  800561:	b9 21 00 00 00       	mov    $0x21,%ecx
+  800566:	b8 00 00 00 00       	mov    $0x0,%eax
+  80056b:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  80056e:	48 89 f1             	mov    %rsi,%rcx
+  800571:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  800578:	48 bf 03 05 80 00 00 	movabs $0x800503,%rdi
+  80057f:	00 00 00 
+  800582:	48 b8 00 07 80 00 00 	movabs $0x800700,%rax
+  800589:	00 00 00 
+  80058c:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  80058e:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  800595:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  80059c:	48 b8 46 14 80 00 00 	movabs $0x801446,%rax
+  8005a3:	00 00 00 
+  8005a6:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  8005a8:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  8005ae:	c9                   	leave
+  8005af:	c3                   	ret
+
+00000000008005b0 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  8005b0:	55                   	push   %rbp
+  8005b1:	48 89 e5             	mov    %rsp,%rbp
+  8005b4:	48 83 ec 50          	sub    $0x50,%rsp
+  8005b8:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8005bc:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8005c0:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8005c4:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8005c8:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  8005cc:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  8005d3:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8005d7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8005db:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8005df:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  8005e3:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  8005e7:	48 b8 4c 05 80 00 00 	movabs $0x80054c,%rax
+  8005ee:	00 00 00 
+  8005f1:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  8005f3:	c9                   	leave
+  8005f4:	c3                   	ret
+
+00000000008005f5 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  8005f5:	55                   	push   %rbp
+  8005f6:	48 89 e5             	mov    %rsp,%rbp
+  8005f9:	41 57                	push   %r15
+  8005fb:	41 56                	push   %r14
+  8005fd:	41 55                	push   %r13
+  8005ff:	41 54                	push   %r12
+  800601:	53                   	push   %rbx
+  800602:	48 83 ec 18          	sub    $0x18,%rsp
+  800606:	49 89 fc             	mov    %rdi,%r12
+  800609:	49 89 f5             	mov    %rsi,%r13
+  80060c:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800610:	8b 45 10             	mov    0x10(%rbp),%eax
+  800613:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  800616:	41 89 cf             	mov    %ecx,%r15d
+  800619:	4c 39 fa             	cmp    %r15,%rdx
+  80061c:	73 5b                	jae    800679 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  80061e:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  800622:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  800626:	85 db                	test   %ebx,%ebx
+  800628:	7e 0e                	jle    800638 <print_num+0x43>
+            putch(padc, put_arg);
+  80062a:	4c 89 ee             	mov    %r13,%rsi
+  80062d:	44 89 f7             	mov    %r14d,%edi
+  800630:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  800633:	83 eb 01             	sub    $0x1,%ebx
+  800636:	75 f2                	jne    80062a <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  800638:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  80063c:	48 b9 5c 31 80 00 00 	movabs $0x80315c,%rcx
+  800643:	00 00 00 
+  800646:	48 b8 4b 31 80 00 00 	movabs $0x80314b,%rax
+  80064d:	00 00 00 
+  800650:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  800654:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800658:	ba 00 00 00 00       	mov    $0x0,%edx
+  80065d:	49 f7 f7             	div    %r15
+  800660:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  800664:	4c 89 ee             	mov    %r13,%rsi
+  800667:	41 ff d4             	call   *%r12
+}
+  80066a:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  80066e:	5b                   	pop    %rbx
+  80066f:	41 5c                	pop    %r12
+  800671:	41 5d                	pop    %r13
+  800673:	41 5e                	pop    %r14
+  800675:	41 5f                	pop    %r15
+  800677:	5d                   	pop    %rbp
+  800678:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  800679:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80067d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800682:	49 f7 f7             	div    %r15
+  800685:	48 83 ec 08          	sub    $0x8,%rsp
+  800689:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  80068d:	52                   	push   %rdx
+  80068e:	45 0f be c9          	movsbl %r9b,%r9d
+  800692:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  800696:	48 89 c2             	mov    %rax,%rdx
+  800699:	48 b8 f5 05 80 00 00 	movabs $0x8005f5,%rax
+  8006a0:	00 00 00 
+  8006a3:	ff d0                	call   *%rax
+  8006a5:	48 83 c4 10          	add    $0x10,%rsp
+  8006a9:	eb 8d                	jmp    800638 <print_num+0x43>
+
+00000000008006ab <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  8006ab:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  8006af:	48 8b 06             	mov    (%rsi),%rax
+  8006b2:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  8006b6:	73 0a                	jae    8006c2 <sprintputch+0x17>
+        *state->start++ = ch;
+  8006b8:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8006bc:	48 89 16             	mov    %rdx,(%rsi)
+  8006bf:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  8006c2:	c3                   	ret
+
+00000000008006c3 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  8006c3:	55                   	push   %rbp
+  8006c4:	48 89 e5             	mov    %rsp,%rbp
+  8006c7:	48 83 ec 50          	sub    $0x50,%rsp
+  8006cb:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8006cf:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8006d3:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  8006d7:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8006de:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8006e2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006e6:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8006ea:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  8006ee:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8006f2:	48 b8 00 07 80 00 00 	movabs $0x800700,%rax
+  8006f9:	00 00 00 
+  8006fc:	ff d0                	call   *%rax
+}
+  8006fe:	c9                   	leave
+  8006ff:	c3                   	ret
+
+0000000000800700 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  800700:	55                   	push   %rbp
+  800701:	48 89 e5             	mov    %rsp,%rbp
+  800704:	41 57                	push   %r15
+  800706:	41 56                	push   %r14
+  800708:	41 55                	push   %r13
+  80070a:	41 54                	push   %r12
+  80070c:	53                   	push   %rbx
+  80070d:	48 83 ec 38          	sub    $0x38,%rsp
+  800711:	49 89 fe             	mov    %rdi,%r14
+  800714:	49 89 f5             	mov    %rsi,%r13
+  800717:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  80071a:	48 8b 01             	mov    (%rcx),%rax
+  80071d:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  800721:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800725:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800729:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  80072d:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  800731:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  800735:	0f b6 3b             	movzbl (%rbx),%edi
+  800738:	40 80 ff 25          	cmp    $0x25,%dil
+  80073c:	74 18                	je     800756 <vprintfmt+0x56>
+            if (!ch) return;
+  80073e:	40 84 ff             	test   %dil,%dil
+  800741:	0f 84 b1 06 00 00    	je     800df8 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  800747:	40 0f b6 ff          	movzbl %dil,%edi
+  80074b:	4c 89 ee             	mov    %r13,%rsi
+  80074e:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  800751:	4c 89 e3             	mov    %r12,%rbx
+  800754:	eb db                	jmp    800731 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  800756:	be 00 00 00 00       	mov    $0x0,%esi
+  80075b:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  80075f:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  800764:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  80076a:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  800771:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800775:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  80077a:	41 0f b6 04 24       	movzbl (%r12),%eax
+  80077f:	88 45 a0             	mov    %al,-0x60(%rbp)
+  800782:	83 e8 23             	sub    $0x23,%eax
+  800785:	3c 57                	cmp    $0x57,%al
+  800787:	0f 87 51 06 00 00    	ja     800dde <vprintfmt+0x6de>
+  80078d:	0f b6 c0             	movzbl %al,%eax
+  800790:	48 b9 20 33 80 00 00 	movabs $0x803320,%rcx
+  800797:	00 00 00 
+  80079a:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  80079d:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  8007a0:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  8007a4:	eb cf                	jmp    800775 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  8007a6:	49 89 dc             	mov    %rbx,%r12
+  8007a9:	be 01 00 00 00       	mov    $0x1,%esi
+  8007ae:	eb c5                	jmp    800775 <vprintfmt+0x75>
+            padc = ch;
+  8007b0:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  8007b4:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8007b7:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8007ba:	eb b9                	jmp    800775 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8007bc:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007bf:	83 f8 2f             	cmp    $0x2f,%eax
+  8007c2:	77 24                	ja     8007e8 <vprintfmt+0xe8>
+  8007c4:	89 c1                	mov    %eax,%ecx
+  8007c6:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  8007ca:	83 c0 08             	add    $0x8,%eax
+  8007cd:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007d0:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  8007d3:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  8007d6:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8007da:	79 99                	jns    800775 <vprintfmt+0x75>
+                width = precision;
+  8007dc:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  8007e0:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8007e6:	eb 8d                	jmp    800775 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8007e8:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8007ec:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  8007f0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007f4:	eb da                	jmp    8007d0 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  8007f6:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  8007fb:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8007ff:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  800805:	3c 39                	cmp    $0x39,%al
+  800807:	77 1c                	ja     800825 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  800809:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  80080d:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  800811:	0f b6 c0             	movzbl %al,%eax
+  800814:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800819:	0f b6 03             	movzbl (%rbx),%eax
+  80081c:	3c 39                	cmp    $0x39,%al
+  80081e:	76 e9                	jbe    800809 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  800820:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  800823:	eb b1                	jmp    8007d6 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  800825:	49 89 dc             	mov    %rbx,%r12
+  800828:	eb ac                	jmp    8007d6 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  80082a:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  80082d:	85 c9                	test   %ecx,%ecx
+  80082f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800834:	0f 49 c1             	cmovns %ecx,%eax
+  800837:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  80083a:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80083d:	e9 33 ff ff ff       	jmp    800775 <vprintfmt+0x75>
+            lflag++;
+  800842:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  800845:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800848:	e9 28 ff ff ff       	jmp    800775 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  80084d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800850:	83 f8 2f             	cmp    $0x2f,%eax
+  800853:	77 19                	ja     80086e <vprintfmt+0x16e>
+  800855:	89 c2                	mov    %eax,%edx
+  800857:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80085b:	83 c0 08             	add    $0x8,%eax
+  80085e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800861:	8b 3a                	mov    (%rdx),%edi
+  800863:	4c 89 ee             	mov    %r13,%rsi
+  800866:	41 ff d6             	call   *%r14
+            break;
+  800869:	e9 c3 fe ff ff       	jmp    800731 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  80086e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800872:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800876:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80087a:	eb e5                	jmp    800861 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  80087c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80087f:	83 f8 2f             	cmp    $0x2f,%eax
+  800882:	77 5a                	ja     8008de <vprintfmt+0x1de>
+  800884:	89 c2                	mov    %eax,%edx
+  800886:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80088a:	83 c0 08             	add    $0x8,%eax
+  80088d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  800890:	8b 02                	mov    (%rdx),%eax
+  800892:	89 c1                	mov    %eax,%ecx
+  800894:	f7 d9                	neg    %ecx
+  800896:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  800899:	83 f9 15             	cmp    $0x15,%ecx
+  80089c:	7f 4e                	jg     8008ec <vprintfmt+0x1ec>
+  80089e:	48 63 c1             	movslq %ecx,%rax
+  8008a1:	48 ba e0 35 80 00 00 	movabs $0x8035e0,%rdx
+  8008a8:	00 00 00 
+  8008ab:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8008af:	48 85 c0             	test   %rax,%rax
+  8008b2:	74 38                	je     8008ec <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  8008b4:	48 89 c1             	mov    %rax,%rcx
+  8008b7:	48 ba b9 37 80 00 00 	movabs $0x8037b9,%rdx
+  8008be:	00 00 00 
+  8008c1:	4c 89 ee             	mov    %r13,%rsi
+  8008c4:	4c 89 f7             	mov    %r14,%rdi
+  8008c7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008cc:	49 b8 c3 06 80 00 00 	movabs $0x8006c3,%r8
+  8008d3:	00 00 00 
+  8008d6:	41 ff d0             	call   *%r8
+  8008d9:	e9 53 fe ff ff       	jmp    800731 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  8008de:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008e2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008e6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008ea:	eb a4                	jmp    800890 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  8008ec:	48 ba 74 31 80 00 00 	movabs $0x803174,%rdx
+  8008f3:	00 00 00 
+  8008f6:	4c 89 ee             	mov    %r13,%rsi
+  8008f9:	4c 89 f7             	mov    %r14,%rdi
+  8008fc:	b8 00 00 00 00       	mov    $0x0,%eax
+  800901:	49 b8 c3 06 80 00 00 	movabs $0x8006c3,%r8
+  800908:	00 00 00 
+  80090b:	41 ff d0             	call   *%r8
+  80090e:	e9 1e fe ff ff       	jmp    800731 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800913:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800916:	83 f8 2f             	cmp    $0x2f,%eax
+  800919:	77 6c                	ja     800987 <vprintfmt+0x287>
+  80091b:	89 c2                	mov    %eax,%edx
+  80091d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800921:	83 c0 08             	add    $0x8,%eax
+  800924:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800927:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  80092a:	48 85 d2             	test   %rdx,%rdx
+  80092d:	48 b8 6d 31 80 00 00 	movabs $0x80316d,%rax
+  800934:	00 00 00 
+  800937:	48 0f 45 c2          	cmovne %rdx,%rax
+  80093b:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  80093f:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800943:	7e 06                	jle    80094b <vprintfmt+0x24b>
+  800945:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  800949:	75 4a                	jne    800995 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  80094b:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  80094f:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  800953:	0f b6 00             	movzbl (%rax),%eax
+  800956:	84 c0                	test   %al,%al
+  800958:	0f 85 9a 00 00 00    	jne    8009f8 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  80095e:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800961:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  800965:	85 c0                	test   %eax,%eax
+  800967:	0f 8e c4 fd ff ff    	jle    800731 <vprintfmt+0x31>
+  80096d:	4c 89 ee             	mov    %r13,%rsi
+  800970:	bf 20 00 00 00       	mov    $0x20,%edi
+  800975:	41 ff d6             	call   *%r14
+  800978:	41 83 ec 01          	sub    $0x1,%r12d
+  80097c:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  800980:	75 eb                	jne    80096d <vprintfmt+0x26d>
+  800982:	e9 aa fd ff ff       	jmp    800731 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800987:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80098b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80098f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800993:	eb 92                	jmp    800927 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  800995:	49 63 f7             	movslq %r15d,%rsi
+  800998:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  80099c:	48 b8 b2 0e 80 00 00 	movabs $0x800eb2,%rax
+  8009a3:	00 00 00 
+  8009a6:	ff d0                	call   *%rax
+  8009a8:	48 89 c2             	mov    %rax,%rdx
+  8009ab:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8009ae:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  8009b0:	8d 70 ff             	lea    -0x1(%rax),%esi
+  8009b3:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  8009b6:	85 c0                	test   %eax,%eax
+  8009b8:	7e 91                	jle    80094b <vprintfmt+0x24b>
+  8009ba:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  8009bf:	4c 89 ee             	mov    %r13,%rsi
+  8009c2:	44 89 e7             	mov    %r12d,%edi
+  8009c5:	41 ff d6             	call   *%r14
+  8009c8:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8009cc:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8009cf:	83 f8 ff             	cmp    $0xffffffff,%eax
+  8009d2:	75 eb                	jne    8009bf <vprintfmt+0x2bf>
+  8009d4:	e9 72 ff ff ff       	jmp    80094b <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8009d9:	0f b6 f8             	movzbl %al,%edi
+  8009dc:	4c 89 ee             	mov    %r13,%rsi
+  8009df:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8009e2:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8009e6:	49 83 c4 01          	add    $0x1,%r12
+  8009ea:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  8009f0:	84 c0                	test   %al,%al
+  8009f2:	0f 84 66 ff ff ff    	je     80095e <vprintfmt+0x25e>
+  8009f8:	45 85 ff             	test   %r15d,%r15d
+  8009fb:	78 0a                	js     800a07 <vprintfmt+0x307>
+  8009fd:	41 83 ef 01          	sub    $0x1,%r15d
+  800a01:	0f 88 57 ff ff ff    	js     80095e <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800a07:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  800a0b:	74 cc                	je     8009d9 <vprintfmt+0x2d9>
+  800a0d:	8d 50 e0             	lea    -0x20(%rax),%edx
+  800a10:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800a15:	80 fa 5e             	cmp    $0x5e,%dl
+  800a18:	77 c2                	ja     8009dc <vprintfmt+0x2dc>
+  800a1a:	eb bd                	jmp    8009d9 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  800a1c:	40 84 f6             	test   %sil,%sil
+  800a1f:	75 26                	jne    800a47 <vprintfmt+0x347>
+    switch (lflag) {
+  800a21:	85 d2                	test   %edx,%edx
+  800a23:	74 59                	je     800a7e <vprintfmt+0x37e>
+  800a25:	83 fa 01             	cmp    $0x1,%edx
+  800a28:	74 7b                	je     800aa5 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  800a2a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a2d:	83 f8 2f             	cmp    $0x2f,%eax
+  800a30:	0f 87 96 00 00 00    	ja     800acc <vprintfmt+0x3cc>
+  800a36:	89 c2                	mov    %eax,%edx
+  800a38:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a3c:	83 c0 08             	add    $0x8,%eax
+  800a3f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a42:	4c 8b 22             	mov    (%rdx),%r12
+  800a45:	eb 17                	jmp    800a5e <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  800a47:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a4a:	83 f8 2f             	cmp    $0x2f,%eax
+  800a4d:	77 21                	ja     800a70 <vprintfmt+0x370>
+  800a4f:	89 c2                	mov    %eax,%edx
+  800a51:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a55:	83 c0 08             	add    $0x8,%eax
+  800a58:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a5b:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  800a5e:	4d 85 e4             	test   %r12,%r12
+  800a61:	78 7a                	js     800add <vprintfmt+0x3dd>
+            num = i;
+  800a63:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  800a66:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  800a6b:	e9 50 02 00 00       	jmp    800cc0 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800a70:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a74:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a78:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a7c:	eb dd                	jmp    800a5b <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  800a7e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a81:	83 f8 2f             	cmp    $0x2f,%eax
+  800a84:	77 11                	ja     800a97 <vprintfmt+0x397>
+  800a86:	89 c2                	mov    %eax,%edx
+  800a88:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a8c:	83 c0 08             	add    $0x8,%eax
+  800a8f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a92:	4c 63 22             	movslq (%rdx),%r12
+  800a95:	eb c7                	jmp    800a5e <vprintfmt+0x35e>
+  800a97:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a9b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a9f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800aa3:	eb ed                	jmp    800a92 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  800aa5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800aa8:	83 f8 2f             	cmp    $0x2f,%eax
+  800aab:	77 11                	ja     800abe <vprintfmt+0x3be>
+  800aad:	89 c2                	mov    %eax,%edx
+  800aaf:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ab3:	83 c0 08             	add    $0x8,%eax
+  800ab6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ab9:	4c 8b 22             	mov    (%rdx),%r12
+  800abc:	eb a0                	jmp    800a5e <vprintfmt+0x35e>
+  800abe:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ac2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ac6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800aca:	eb ed                	jmp    800ab9 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  800acc:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ad0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ad4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ad8:	e9 65 ff ff ff       	jmp    800a42 <vprintfmt+0x342>
+                putch('-', put_arg);
+  800add:	4c 89 ee             	mov    %r13,%rsi
+  800ae0:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800ae5:	41 ff d6             	call   *%r14
+                i = -i;
+  800ae8:	49 f7 dc             	neg    %r12
+  800aeb:	e9 73 ff ff ff       	jmp    800a63 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  800af0:	40 84 f6             	test   %sil,%sil
+  800af3:	75 32                	jne    800b27 <vprintfmt+0x427>
+    switch (lflag) {
+  800af5:	85 d2                	test   %edx,%edx
+  800af7:	74 5d                	je     800b56 <vprintfmt+0x456>
+  800af9:	83 fa 01             	cmp    $0x1,%edx
+  800afc:	0f 84 82 00 00 00    	je     800b84 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  800b02:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b05:	83 f8 2f             	cmp    $0x2f,%eax
+  800b08:	0f 87 a5 00 00 00    	ja     800bb3 <vprintfmt+0x4b3>
+  800b0e:	89 c2                	mov    %eax,%edx
+  800b10:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b14:	83 c0 08             	add    $0x8,%eax
+  800b17:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b1a:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800b1d:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  800b22:	e9 99 01 00 00       	jmp    800cc0 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800b27:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b2a:	83 f8 2f             	cmp    $0x2f,%eax
+  800b2d:	77 19                	ja     800b48 <vprintfmt+0x448>
+  800b2f:	89 c2                	mov    %eax,%edx
+  800b31:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b35:	83 c0 08             	add    $0x8,%eax
+  800b38:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b3b:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800b3e:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800b43:	e9 78 01 00 00       	jmp    800cc0 <vprintfmt+0x5c0>
+  800b48:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b4c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b50:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b54:	eb e5                	jmp    800b3b <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  800b56:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b59:	83 f8 2f             	cmp    $0x2f,%eax
+  800b5c:	77 18                	ja     800b76 <vprintfmt+0x476>
+  800b5e:	89 c2                	mov    %eax,%edx
+  800b60:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b64:	83 c0 08             	add    $0x8,%eax
+  800b67:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b6a:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800b6c:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  800b71:	e9 4a 01 00 00       	jmp    800cc0 <vprintfmt+0x5c0>
+  800b76:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b7a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b7e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b82:	eb e6                	jmp    800b6a <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  800b84:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b87:	83 f8 2f             	cmp    $0x2f,%eax
+  800b8a:	77 19                	ja     800ba5 <vprintfmt+0x4a5>
+  800b8c:	89 c2                	mov    %eax,%edx
+  800b8e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b92:	83 c0 08             	add    $0x8,%eax
+  800b95:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b98:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800b9b:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  800ba0:	e9 1b 01 00 00       	jmp    800cc0 <vprintfmt+0x5c0>
+  800ba5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ba9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bad:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bb1:	eb e5                	jmp    800b98 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  800bb3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bb7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bbb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bbf:	e9 56 ff ff ff       	jmp    800b1a <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  800bc4:	40 84 f6             	test   %sil,%sil
+  800bc7:	75 2e                	jne    800bf7 <vprintfmt+0x4f7>
+    switch (lflag) {
+  800bc9:	85 d2                	test   %edx,%edx
+  800bcb:	74 59                	je     800c26 <vprintfmt+0x526>
+  800bcd:	83 fa 01             	cmp    $0x1,%edx
+  800bd0:	74 7f                	je     800c51 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  800bd2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bd5:	83 f8 2f             	cmp    $0x2f,%eax
+  800bd8:	0f 87 9f 00 00 00    	ja     800c7d <vprintfmt+0x57d>
+  800bde:	89 c2                	mov    %eax,%edx
+  800be0:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800be4:	83 c0 08             	add    $0x8,%eax
+  800be7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800bea:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800bed:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  800bf2:	e9 c9 00 00 00       	jmp    800cc0 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800bf7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bfa:	83 f8 2f             	cmp    $0x2f,%eax
+  800bfd:	77 19                	ja     800c18 <vprintfmt+0x518>
+  800bff:	89 c2                	mov    %eax,%edx
+  800c01:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c05:	83 c0 08             	add    $0x8,%eax
+  800c08:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c0b:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800c0e:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800c13:	e9 a8 00 00 00       	jmp    800cc0 <vprintfmt+0x5c0>
+  800c18:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c1c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c20:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c24:	eb e5                	jmp    800c0b <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  800c26:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c29:	83 f8 2f             	cmp    $0x2f,%eax
+  800c2c:	77 15                	ja     800c43 <vprintfmt+0x543>
+  800c2e:	89 c2                	mov    %eax,%edx
+  800c30:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c34:	83 c0 08             	add    $0x8,%eax
+  800c37:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c3a:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  800c3c:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  800c41:	eb 7d                	jmp    800cc0 <vprintfmt+0x5c0>
+  800c43:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c47:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c4b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c4f:	eb e9                	jmp    800c3a <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  800c51:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c54:	83 f8 2f             	cmp    $0x2f,%eax
+  800c57:	77 16                	ja     800c6f <vprintfmt+0x56f>
+  800c59:	89 c2                	mov    %eax,%edx
+  800c5b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c5f:	83 c0 08             	add    $0x8,%eax
+  800c62:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c65:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800c68:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  800c6d:	eb 51                	jmp    800cc0 <vprintfmt+0x5c0>
+  800c6f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c73:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c77:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c7b:	eb e8                	jmp    800c65 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  800c7d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c81:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c85:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c89:	e9 5c ff ff ff       	jmp    800bea <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  800c8e:	4c 89 ee             	mov    %r13,%rsi
+  800c91:	bf 30 00 00 00       	mov    $0x30,%edi
+  800c96:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800c99:	4c 89 ee             	mov    %r13,%rsi
+  800c9c:	bf 78 00 00 00       	mov    $0x78,%edi
+  800ca1:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800ca4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ca7:	83 f8 2f             	cmp    $0x2f,%eax
+  800caa:	77 47                	ja     800cf3 <vprintfmt+0x5f3>
+  800cac:	89 c2                	mov    %eax,%edx
+  800cae:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800cb2:	83 c0 08             	add    $0x8,%eax
+  800cb5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800cb8:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800cbb:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800cc0:	48 83 ec 08          	sub    $0x8,%rsp
+  800cc4:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800cc8:	0f 94 c0             	sete   %al
+  800ccb:	0f b6 c0             	movzbl %al,%eax
+  800cce:	50                   	push   %rax
+  800ccf:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800cd4:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800cd8:	4c 89 ee             	mov    %r13,%rsi
+  800cdb:	4c 89 f7             	mov    %r14,%rdi
+  800cde:	48 b8 f5 05 80 00 00 	movabs $0x8005f5,%rax
+  800ce5:	00 00 00 
+  800ce8:	ff d0                	call   *%rax
+            break;
+  800cea:	48 83 c4 10          	add    $0x10,%rsp
+  800cee:	e9 3e fa ff ff       	jmp    800731 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800cf3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800cf7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800cfb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800cff:	eb b7                	jmp    800cb8 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  800d01:	40 84 f6             	test   %sil,%sil
+  800d04:	75 2b                	jne    800d31 <vprintfmt+0x631>
+    switch (lflag) {
+  800d06:	85 d2                	test   %edx,%edx
+  800d08:	74 56                	je     800d60 <vprintfmt+0x660>
+  800d0a:	83 fa 01             	cmp    $0x1,%edx
+  800d0d:	74 7f                	je     800d8e <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800d0f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d12:	83 f8 2f             	cmp    $0x2f,%eax
+  800d15:	0f 87 a2 00 00 00    	ja     800dbd <vprintfmt+0x6bd>
+  800d1b:	89 c2                	mov    %eax,%edx
+  800d1d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d21:	83 c0 08             	add    $0x8,%eax
+  800d24:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d27:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800d2a:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800d2f:	eb 8f                	jmp    800cc0 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800d31:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d34:	83 f8 2f             	cmp    $0x2f,%eax
+  800d37:	77 19                	ja     800d52 <vprintfmt+0x652>
+  800d39:	89 c2                	mov    %eax,%edx
+  800d3b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d3f:	83 c0 08             	add    $0x8,%eax
+  800d42:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d45:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800d48:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800d4d:	e9 6e ff ff ff       	jmp    800cc0 <vprintfmt+0x5c0>
+  800d52:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d56:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d5a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d5e:	eb e5                	jmp    800d45 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800d60:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d63:	83 f8 2f             	cmp    $0x2f,%eax
+  800d66:	77 18                	ja     800d80 <vprintfmt+0x680>
+  800d68:	89 c2                	mov    %eax,%edx
+  800d6a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d6e:	83 c0 08             	add    $0x8,%eax
+  800d71:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d74:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800d76:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800d7b:	e9 40 ff ff ff       	jmp    800cc0 <vprintfmt+0x5c0>
+  800d80:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d84:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d88:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d8c:	eb e6                	jmp    800d74 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800d8e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d91:	83 f8 2f             	cmp    $0x2f,%eax
+  800d94:	77 19                	ja     800daf <vprintfmt+0x6af>
+  800d96:	89 c2                	mov    %eax,%edx
+  800d98:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d9c:	83 c0 08             	add    $0x8,%eax
+  800d9f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800da2:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800da5:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800daa:	e9 11 ff ff ff       	jmp    800cc0 <vprintfmt+0x5c0>
+  800daf:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800db3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800db7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800dbb:	eb e5                	jmp    800da2 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800dbd:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800dc1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800dc5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800dc9:	e9 59 ff ff ff       	jmp    800d27 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800dce:	4c 89 ee             	mov    %r13,%rsi
+  800dd1:	bf 25 00 00 00       	mov    $0x25,%edi
+  800dd6:	41 ff d6             	call   *%r14
+            break;
+  800dd9:	e9 53 f9 ff ff       	jmp    800731 <vprintfmt+0x31>
+            putch('%', put_arg);
+  800dde:	4c 89 ee             	mov    %r13,%rsi
+  800de1:	bf 25 00 00 00       	mov    $0x25,%edi
+  800de6:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800de9:	48 83 eb 01          	sub    $0x1,%rbx
+  800ded:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800df1:	75 f6                	jne    800de9 <vprintfmt+0x6e9>
+  800df3:	e9 39 f9 ff ff       	jmp    800731 <vprintfmt+0x31>
+}
+  800df8:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800dfc:	5b                   	pop    %rbx
+  800dfd:	41 5c                	pop    %r12
+  800dff:	41 5d                	pop    %r13
+  800e01:	41 5e                	pop    %r14
+  800e03:	41 5f                	pop    %r15
+  800e05:	5d                   	pop    %rbp
+  800e06:	c3                   	ret
+
+0000000000800e07 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800e07:	55                   	push   %rbp
+  800e08:	48 89 e5             	mov    %rsp,%rbp
+  800e0b:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800e0f:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800e13:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800e18:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800e1c:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800e23:	48 85 ff             	test   %rdi,%rdi
+  800e26:	74 2b                	je     800e53 <vsnprintf+0x4c>
+  800e28:	48 85 f6             	test   %rsi,%rsi
+  800e2b:	74 26                	je     800e53 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800e2d:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800e31:	48 bf ab 06 80 00 00 	movabs $0x8006ab,%rdi
+  800e38:	00 00 00 
+  800e3b:	48 b8 00 07 80 00 00 	movabs $0x800700,%rax
+  800e42:	00 00 00 
+  800e45:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800e47:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800e4b:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800e4e:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800e51:	c9                   	leave
+  800e52:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800e53:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800e58:	eb f7                	jmp    800e51 <vsnprintf+0x4a>
+
+0000000000800e5a <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800e5a:	55                   	push   %rbp
+  800e5b:	48 89 e5             	mov    %rsp,%rbp
+  800e5e:	48 83 ec 50          	sub    $0x50,%rsp
+  800e62:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800e66:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800e6a:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800e6e:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800e75:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800e79:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e7d:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800e81:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800e85:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800e89:	48 b8 07 0e 80 00 00 	movabs $0x800e07,%rax
+  800e90:	00 00 00 
+  800e93:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800e95:	c9                   	leave
+  800e96:	c3                   	ret
+
+0000000000800e97 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800e97:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800e9a:	74 10                	je     800eac <strlen+0x15>
+    size_t n = 0;
+  800e9c:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800ea1:	48 83 c0 01          	add    $0x1,%rax
+  800ea5:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800ea9:	75 f6                	jne    800ea1 <strlen+0xa>
+  800eab:	c3                   	ret
+    size_t n = 0;
+  800eac:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800eb1:	c3                   	ret
+
+0000000000800eb2 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800eb2:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800eb5:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800eba:	48 85 f6             	test   %rsi,%rsi
+  800ebd:	74 11                	je     800ed0 <strnlen+0x1e>
+  800ebf:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800ec3:	74 0c                	je     800ed1 <strnlen+0x1f>
+  800ec5:	48 83 c2 01          	add    $0x1,%rdx
+  800ec9:	48 39 d0             	cmp    %rdx,%rax
+  800ecc:	75 f1                	jne    800ebf <strnlen+0xd>
+  800ece:	eb 04                	jmp    800ed4 <strnlen+0x22>
+  800ed0:	c3                   	ret
+  800ed1:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800ed4:	c3                   	ret
+
+0000000000800ed5 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800ed5:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800ed8:	ba 00 00 00 00       	mov    $0x0,%edx
+  800edd:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800ee1:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800ee4:	48 83 c2 01          	add    $0x1,%rdx
+  800ee8:	84 c9                	test   %cl,%cl
+  800eea:	75 f1                	jne    800edd <strcpy+0x8>
+        ;
+    return res;
+}
+  800eec:	c3                   	ret
+
+0000000000800eed <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800eed:	55                   	push   %rbp
+  800eee:	48 89 e5             	mov    %rsp,%rbp
+  800ef1:	41 54                	push   %r12
+  800ef3:	53                   	push   %rbx
+  800ef4:	48 89 fb             	mov    %rdi,%rbx
+  800ef7:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800efa:	48 b8 97 0e 80 00 00 	movabs $0x800e97,%rax
+  800f01:	00 00 00 
+  800f04:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800f06:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800f0a:	4c 89 e6             	mov    %r12,%rsi
+  800f0d:	48 b8 d5 0e 80 00 00 	movabs $0x800ed5,%rax
+  800f14:	00 00 00 
+  800f17:	ff d0                	call   *%rax
+    return dst;
+}
+  800f19:	48 89 d8             	mov    %rbx,%rax
+  800f1c:	5b                   	pop    %rbx
+  800f1d:	41 5c                	pop    %r12
+  800f1f:	5d                   	pop    %rbp
+  800f20:	c3                   	ret
+
+0000000000800f21 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800f21:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800f24:	48 85 d2             	test   %rdx,%rdx
+  800f27:	74 1f                	je     800f48 <strncpy+0x27>
+  800f29:	48 01 fa             	add    %rdi,%rdx
+  800f2c:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800f2f:	48 83 c1 01          	add    $0x1,%rcx
+  800f33:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800f37:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800f3b:	41 80 f8 01          	cmp    $0x1,%r8b
+  800f3f:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800f43:	48 39 ca             	cmp    %rcx,%rdx
+  800f46:	75 e7                	jne    800f2f <strncpy+0xe>
+    }
+    return ret;
+}
+  800f48:	c3                   	ret
+
+0000000000800f49 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800f49:	48 89 f8             	mov    %rdi,%rax
+  800f4c:	48 85 d2             	test   %rdx,%rdx
+  800f4f:	74 24                	je     800f75 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800f51:	48 83 ea 01          	sub    $0x1,%rdx
+  800f55:	74 1b                	je     800f72 <strlcpy+0x29>
+  800f57:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800f5b:	0f b6 16             	movzbl (%rsi),%edx
+  800f5e:	84 d2                	test   %dl,%dl
+  800f60:	74 10                	je     800f72 <strlcpy+0x29>
+            *dst++ = *src++;
+  800f62:	48 83 c6 01          	add    $0x1,%rsi
+  800f66:	48 83 c0 01          	add    $0x1,%rax
+  800f6a:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800f6d:	48 39 c8             	cmp    %rcx,%rax
+  800f70:	75 e9                	jne    800f5b <strlcpy+0x12>
+        *dst = '\0';
+  800f72:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800f75:	48 29 f8             	sub    %rdi,%rax
+}
+  800f78:	c3                   	ret
+
+0000000000800f79 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800f79:	0f b6 07             	movzbl (%rdi),%eax
+  800f7c:	84 c0                	test   %al,%al
+  800f7e:	74 13                	je     800f93 <strcmp+0x1a>
+  800f80:	38 06                	cmp    %al,(%rsi)
+  800f82:	75 0f                	jne    800f93 <strcmp+0x1a>
+  800f84:	48 83 c7 01          	add    $0x1,%rdi
+  800f88:	48 83 c6 01          	add    $0x1,%rsi
+  800f8c:	0f b6 07             	movzbl (%rdi),%eax
+  800f8f:	84 c0                	test   %al,%al
+  800f91:	75 ed                	jne    800f80 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800f93:	0f b6 c0             	movzbl %al,%eax
+  800f96:	0f b6 16             	movzbl (%rsi),%edx
+  800f99:	29 d0                	sub    %edx,%eax
+}
+  800f9b:	c3                   	ret
+
+0000000000800f9c <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800f9c:	48 85 d2             	test   %rdx,%rdx
+  800f9f:	74 1f                	je     800fc0 <strncmp+0x24>
+  800fa1:	0f b6 07             	movzbl (%rdi),%eax
+  800fa4:	84 c0                	test   %al,%al
+  800fa6:	74 1e                	je     800fc6 <strncmp+0x2a>
+  800fa8:	3a 06                	cmp    (%rsi),%al
+  800faa:	75 1a                	jne    800fc6 <strncmp+0x2a>
+  800fac:	48 83 c7 01          	add    $0x1,%rdi
+  800fb0:	48 83 c6 01          	add    $0x1,%rsi
+  800fb4:	48 83 ea 01          	sub    $0x1,%rdx
+  800fb8:	75 e7                	jne    800fa1 <strncmp+0x5>
+
+    if (!n) return 0;
+  800fba:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fbf:	c3                   	ret
+  800fc0:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fc5:	c3                   	ret
+  800fc6:	48 85 d2             	test   %rdx,%rdx
+  800fc9:	74 09                	je     800fd4 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800fcb:	0f b6 07             	movzbl (%rdi),%eax
+  800fce:	0f b6 16             	movzbl (%rsi),%edx
+  800fd1:	29 d0                	sub    %edx,%eax
+  800fd3:	c3                   	ret
+    if (!n) return 0;
+  800fd4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800fd9:	c3                   	ret
+
+0000000000800fda <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800fda:	0f b6 17             	movzbl (%rdi),%edx
+  800fdd:	84 d2                	test   %dl,%dl
+  800fdf:	74 18                	je     800ff9 <strchr+0x1f>
+        if (*str == c) {
+  800fe1:	0f be d2             	movsbl %dl,%edx
+  800fe4:	39 f2                	cmp    %esi,%edx
+  800fe6:	74 17                	je     800fff <strchr+0x25>
+    for (; *str; str++) {
+  800fe8:	48 83 c7 01          	add    $0x1,%rdi
+  800fec:	0f b6 17             	movzbl (%rdi),%edx
+  800fef:	84 d2                	test   %dl,%dl
+  800ff1:	75 ee                	jne    800fe1 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800ff3:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ff8:	c3                   	ret
+  800ff9:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ffe:	c3                   	ret
+  800fff:	48 89 f8             	mov    %rdi,%rax
+}
+  801002:	c3                   	ret
+
+0000000000801003 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  801003:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  801006:	0f b6 17             	movzbl (%rdi),%edx
+  801009:	84 d2                	test   %dl,%dl
+  80100b:	74 13                	je     801020 <strfind+0x1d>
+  80100d:	0f be d2             	movsbl %dl,%edx
+  801010:	39 f2                	cmp    %esi,%edx
+  801012:	74 0b                	je     80101f <strfind+0x1c>
+  801014:	48 83 c0 01          	add    $0x1,%rax
+  801018:	0f b6 10             	movzbl (%rax),%edx
+  80101b:	84 d2                	test   %dl,%dl
+  80101d:	75 ee                	jne    80100d <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  80101f:	c3                   	ret
+  801020:	c3                   	ret
+
+0000000000801021 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  801021:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  801024:	48 89 f8             	mov    %rdi,%rax
+  801027:	48 f7 d8             	neg    %rax
+  80102a:	83 e0 07             	and    $0x7,%eax
+  80102d:	49 89 d1             	mov    %rdx,%r9
+  801030:	49 29 c1             	sub    %rax,%r9
+  801033:	78 36                	js     80106b <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  801035:	40 0f b6 c6          	movzbl %sil,%eax
+  801039:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  801040:	01 01 01 
+  801043:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  801047:	40 f6 c7 07          	test   $0x7,%dil
+  80104b:	75 38                	jne    801085 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  80104d:	4c 89 c9             	mov    %r9,%rcx
+  801050:	48 c1 f9 03          	sar    $0x3,%rcx
+  801054:	74 0c                	je     801062 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  801056:	fc                   	cld
+  801057:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  80105a:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  80105e:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  801062:	4d 85 c9             	test   %r9,%r9
+  801065:	75 45                	jne    8010ac <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  801067:	4c 89 c0             	mov    %r8,%rax
+  80106a:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  80106b:	48 85 d2             	test   %rdx,%rdx
+  80106e:	74 f7                	je     801067 <memset+0x46>
+  801070:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  801073:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  801076:	48 83 c0 01          	add    $0x1,%rax
+  80107a:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  80107e:	48 39 c2             	cmp    %rax,%rdx
+  801081:	75 f3                	jne    801076 <memset+0x55>
+  801083:	eb e2                	jmp    801067 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  801085:	40 f6 c7 01          	test   $0x1,%dil
+  801089:	74 06                	je     801091 <memset+0x70>
+  80108b:	88 07                	mov    %al,(%rdi)
+  80108d:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  801091:	40 f6 c7 02          	test   $0x2,%dil
+  801095:	74 07                	je     80109e <memset+0x7d>
+  801097:	66 89 07             	mov    %ax,(%rdi)
+  80109a:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  80109e:	40 f6 c7 04          	test   $0x4,%dil
+  8010a2:	74 a9                	je     80104d <memset+0x2c>
+  8010a4:	89 07                	mov    %eax,(%rdi)
+  8010a6:	48 83 c7 04          	add    $0x4,%rdi
+  8010aa:	eb a1                	jmp    80104d <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  8010ac:	41 f6 c1 04          	test   $0x4,%r9b
+  8010b0:	74 06                	je     8010b8 <memset+0x97>
+  8010b2:	89 07                	mov    %eax,(%rdi)
+  8010b4:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  8010b8:	41 f6 c1 02          	test   $0x2,%r9b
+  8010bc:	74 07                	je     8010c5 <memset+0xa4>
+  8010be:	66 89 07             	mov    %ax,(%rdi)
+  8010c1:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  8010c5:	41 f6 c1 01          	test   $0x1,%r9b
+  8010c9:	74 9c                	je     801067 <memset+0x46>
+  8010cb:	88 07                	mov    %al,(%rdi)
+  8010cd:	eb 98                	jmp    801067 <memset+0x46>
+
+00000000008010cf <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  8010cf:	48 89 f8             	mov    %rdi,%rax
+  8010d2:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  8010d5:	48 39 fe             	cmp    %rdi,%rsi
+  8010d8:	73 3b                	jae    801115 <memmove+0x46>
+  8010da:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  8010de:	48 39 d7             	cmp    %rdx,%rdi
+  8010e1:	73 32                	jae    801115 <memmove+0x46>
+        s += n;
+        d += n;
+  8010e3:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  8010e7:	48 89 d6             	mov    %rdx,%rsi
+  8010ea:	48 09 fe             	or     %rdi,%rsi
+  8010ed:	48 09 ce             	or     %rcx,%rsi
+  8010f0:	40 f6 c6 07          	test   $0x7,%sil
+  8010f4:	75 12                	jne    801108 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  8010f6:	48 83 ef 08          	sub    $0x8,%rdi
+  8010fa:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  8010fe:	48 c1 e9 03          	shr    $0x3,%rcx
+  801102:	fd                   	std
+  801103:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  801106:	fc                   	cld
+  801107:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  801108:	48 83 ef 01          	sub    $0x1,%rdi
+  80110c:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  801110:	fd                   	std
+  801111:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  801113:	eb f1                	jmp    801106 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  801115:	48 89 f2             	mov    %rsi,%rdx
+  801118:	48 09 c2             	or     %rax,%rdx
+  80111b:	48 09 ca             	or     %rcx,%rdx
+  80111e:	f6 c2 07             	test   $0x7,%dl
+  801121:	75 0c                	jne    80112f <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  801123:	48 c1 e9 03          	shr    $0x3,%rcx
+  801127:	48 89 c7             	mov    %rax,%rdi
+  80112a:	fc                   	cld
+  80112b:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  80112e:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  80112f:	48 89 c7             	mov    %rax,%rdi
+  801132:	fc                   	cld
+  801133:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  801135:	c3                   	ret
+
+0000000000801136 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  801136:	55                   	push   %rbp
+  801137:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  80113a:	48 b8 cf 10 80 00 00 	movabs $0x8010cf,%rax
+  801141:	00 00 00 
+  801144:	ff d0                	call   *%rax
+}
+  801146:	5d                   	pop    %rbp
+  801147:	c3                   	ret
+
+0000000000801148 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  801148:	55                   	push   %rbp
+  801149:	48 89 e5             	mov    %rsp,%rbp
+  80114c:	41 57                	push   %r15
+  80114e:	41 56                	push   %r14
+  801150:	41 55                	push   %r13
+  801152:	41 54                	push   %r12
+  801154:	53                   	push   %rbx
+  801155:	48 83 ec 08          	sub    $0x8,%rsp
+  801159:	49 89 fe             	mov    %rdi,%r14
+  80115c:	49 89 f7             	mov    %rsi,%r15
+  80115f:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  801162:	48 89 f7             	mov    %rsi,%rdi
+  801165:	48 b8 97 0e 80 00 00 	movabs $0x800e97,%rax
+  80116c:	00 00 00 
+  80116f:	ff d0                	call   *%rax
+  801171:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  801174:	48 89 de             	mov    %rbx,%rsi
+  801177:	4c 89 f7             	mov    %r14,%rdi
+  80117a:	48 b8 b2 0e 80 00 00 	movabs $0x800eb2,%rax
+  801181:	00 00 00 
+  801184:	ff d0                	call   *%rax
+  801186:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  801189:	48 39 c3             	cmp    %rax,%rbx
+  80118c:	74 36                	je     8011c4 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  80118e:	48 89 d8             	mov    %rbx,%rax
+  801191:	4c 29 e8             	sub    %r13,%rax
+  801194:	49 39 c4             	cmp    %rax,%r12
+  801197:	73 31                	jae    8011ca <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  801199:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  80119e:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8011a2:	4c 89 fe             	mov    %r15,%rsi
+  8011a5:	48 b8 36 11 80 00 00 	movabs $0x801136,%rax
+  8011ac:	00 00 00 
+  8011af:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  8011b1:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  8011b5:	48 83 c4 08          	add    $0x8,%rsp
+  8011b9:	5b                   	pop    %rbx
+  8011ba:	41 5c                	pop    %r12
+  8011bc:	41 5d                	pop    %r13
+  8011be:	41 5e                	pop    %r14
+  8011c0:	41 5f                	pop    %r15
+  8011c2:	5d                   	pop    %rbp
+  8011c3:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  8011c4:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  8011c8:	eb eb                	jmp    8011b5 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  8011ca:	48 83 eb 01          	sub    $0x1,%rbx
+  8011ce:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8011d2:	48 89 da             	mov    %rbx,%rdx
+  8011d5:	4c 89 fe             	mov    %r15,%rsi
+  8011d8:	48 b8 36 11 80 00 00 	movabs $0x801136,%rax
+  8011df:	00 00 00 
+  8011e2:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  8011e4:	49 01 de             	add    %rbx,%r14
+  8011e7:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  8011ec:	eb c3                	jmp    8011b1 <strlcat+0x69>
+
+00000000008011ee <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  8011ee:	48 85 d2             	test   %rdx,%rdx
+  8011f1:	74 2d                	je     801220 <memcmp+0x32>
+  8011f3:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  8011f8:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  8011fc:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  801201:	44 38 c1             	cmp    %r8b,%cl
+  801204:	75 0f                	jne    801215 <memcmp+0x27>
+    while (n-- > 0) {
+  801206:	48 83 c0 01          	add    $0x1,%rax
+  80120a:	48 39 c2             	cmp    %rax,%rdx
+  80120d:	75 e9                	jne    8011f8 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  80120f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801214:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  801215:	0f b6 c1             	movzbl %cl,%eax
+  801218:	45 0f b6 c0          	movzbl %r8b,%r8d
+  80121c:	44 29 c0             	sub    %r8d,%eax
+  80121f:	c3                   	ret
+    return 0;
+  801220:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801225:	c3                   	ret
+
+0000000000801226 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  801226:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  80122a:	48 39 c7             	cmp    %rax,%rdi
+  80122d:	73 0f                	jae    80123e <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  80122f:	40 38 37             	cmp    %sil,(%rdi)
+  801232:	74 0e                	je     801242 <memfind+0x1c>
+    for (; src < end; src++) {
+  801234:	48 83 c7 01          	add    $0x1,%rdi
+  801238:	48 39 f8             	cmp    %rdi,%rax
+  80123b:	75 f2                	jne    80122f <memfind+0x9>
+  80123d:	c3                   	ret
+  80123e:	48 89 f8             	mov    %rdi,%rax
+  801241:	c3                   	ret
+  801242:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  801245:	c3                   	ret
+
+0000000000801246 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  801246:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  801249:	0f b6 37             	movzbl (%rdi),%esi
+  80124c:	40 80 fe 20          	cmp    $0x20,%sil
+  801250:	74 06                	je     801258 <strtol+0x12>
+  801252:	40 80 fe 09          	cmp    $0x9,%sil
+  801256:	75 13                	jne    80126b <strtol+0x25>
+  801258:	48 83 c7 01          	add    $0x1,%rdi
+  80125c:	0f b6 37             	movzbl (%rdi),%esi
+  80125f:	40 80 fe 20          	cmp    $0x20,%sil
+  801263:	74 f3                	je     801258 <strtol+0x12>
+  801265:	40 80 fe 09          	cmp    $0x9,%sil
+  801269:	74 ed                	je     801258 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  80126b:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  80126e:	83 e0 fd             	and    $0xfffffffd,%eax
+  801271:	3c 01                	cmp    $0x1,%al
+  801273:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801277:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  80127d:	75 0f                	jne    80128e <strtol+0x48>
+  80127f:	80 3f 30             	cmpb   $0x30,(%rdi)
+  801282:	74 14                	je     801298 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  801284:	85 d2                	test   %edx,%edx
+  801286:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80128b:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  80128e:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  801293:	4c 63 ca             	movslq %edx,%r9
+  801296:	eb 36                	jmp    8012ce <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801298:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  80129c:	74 0f                	je     8012ad <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  80129e:	85 d2                	test   %edx,%edx
+  8012a0:	75 ec                	jne    80128e <strtol+0x48>
+        s++;
+  8012a2:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  8012a6:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  8012ab:	eb e1                	jmp    80128e <strtol+0x48>
+        s += 2;
+  8012ad:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  8012b1:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  8012b6:	eb d6                	jmp    80128e <strtol+0x48>
+            dig -= '0';
+  8012b8:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  8012bb:	44 0f b6 c1          	movzbl %cl,%r8d
+  8012bf:	41 39 d0             	cmp    %edx,%r8d
+  8012c2:	7d 21                	jge    8012e5 <strtol+0x9f>
+        val = val * base + dig;
+  8012c4:	49 0f af c1          	imul   %r9,%rax
+  8012c8:	0f b6 c9             	movzbl %cl,%ecx
+  8012cb:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  8012ce:	48 83 c7 01          	add    $0x1,%rdi
+  8012d2:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  8012d6:	80 f9 39             	cmp    $0x39,%cl
+  8012d9:	76 dd                	jbe    8012b8 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  8012db:	80 f9 7b             	cmp    $0x7b,%cl
+  8012de:	77 05                	ja     8012e5 <strtol+0x9f>
+            dig -= 'a' - 10;
+  8012e0:	83 e9 57             	sub    $0x57,%ecx
+  8012e3:	eb d6                	jmp    8012bb <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  8012e5:	4d 85 d2             	test   %r10,%r10
+  8012e8:	74 03                	je     8012ed <strtol+0xa7>
+  8012ea:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  8012ed:	48 89 c2             	mov    %rax,%rdx
+  8012f0:	48 f7 da             	neg    %rdx
+  8012f3:	40 80 fe 2d          	cmp    $0x2d,%sil
+  8012f7:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  8012fb:	c3                   	ret
+
+00000000008012fc <readline>:
+#define BUFLEN 1024
+
+static char buf[BUFLEN];
+
+char *
+readline(const char *prompt) {
+  8012fc:	55                   	push   %rbp
+  8012fd:	48 89 e5             	mov    %rsp,%rbp
+  801300:	41 57                	push   %r15
+  801302:	41 56                	push   %r14
+  801304:	41 55                	push   %r13
+  801306:	41 54                	push   %r12
+  801308:	53                   	push   %rbx
+  801309:	48 83 ec 08          	sub    $0x8,%rsp
+    if (prompt) {
+  80130d:	48 85 ff             	test   %rdi,%rdi
+  801310:	74 23                	je     801335 <readline+0x39>
+#if JOS_KERNEL
+        cprintf("%s", prompt);
+#else
+        fprintf(1, "%s", prompt);
+  801312:	48 89 fa             	mov    %rdi,%rdx
+  801315:	48 be b9 37 80 00 00 	movabs $0x8037b9,%rsi
+  80131c:	00 00 00 
+  80131f:	bf 01 00 00 00       	mov    $0x1,%edi
+  801324:	b8 00 00 00 00       	mov    $0x0,%eax
+  801329:	48 b9 bc 26 80 00 00 	movabs $0x8026bc,%rcx
+  801330:	00 00 00 
+  801333:	ff d1                	call   *%rcx
+#endif
+    }
+
+    bool echo = iscons(0);
+  801335:	bf 00 00 00 00       	mov    $0x0,%edi
+  80133a:	48 b8 f7 02 80 00 00 	movabs $0x8002f7,%rax
+  801341:	00 00 00 
+  801344:	ff d0                	call   *%rax
+  801346:	41 89 c6             	mov    %eax,%r14d
+
+    for (size_t i = 0;;) {
+  801349:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+        int c = getchar();
+  80134f:	49 bd be 02 80 00 00 	movabs $0x8002be,%r13
+  801356:	00 00 00 
+                cprintf("read error: %i\n", c);
+            return NULL;
+        } else if ((c == '\b' || c == '\x7F')) {
+            if (i) {
+                if (echo) {
+                    cputchar('\b');
+  801359:	49 bf 9b 02 80 00 00 	movabs $0x80029b,%r15
+  801360:	00 00 00 
+  801363:	eb 46                	jmp    8013ab <readline+0xaf>
+            return NULL;
+  801365:	b8 00 00 00 00       	mov    $0x0,%eax
+            if (c != -E_EOF)
+  80136a:	83 fb f4             	cmp    $0xfffffff4,%ebx
+  80136d:	75 0f                	jne    80137e <readline+0x82>
+            }
+            buf[i] = 0;
+            return buf;
+        }
+    }
+}
+  80136f:	48 83 c4 08          	add    $0x8,%rsp
+  801373:	5b                   	pop    %rbx
+  801374:	41 5c                	pop    %r12
+  801376:	41 5d                	pop    %r13
+  801378:	41 5e                	pop    %r14
+  80137a:	41 5f                	pop    %r15
+  80137c:	5d                   	pop    %rbp
+  80137d:	c3                   	ret
+                cprintf("read error: %i\n", c);
+  80137e:	89 de                	mov    %ebx,%esi
+  801380:	48 bf af 36 80 00 00 	movabs $0x8036af,%rdi
+  801387:	00 00 00 
+  80138a:	48 ba b0 05 80 00 00 	movabs $0x8005b0,%rdx
+  801391:	00 00 00 
+  801394:	ff d2                	call   *%rdx
+            return NULL;
+  801396:	b8 00 00 00 00       	mov    $0x0,%eax
+  80139b:	eb d2                	jmp    80136f <readline+0x73>
+            if (i) {
+  80139d:	4d 85 e4             	test   %r12,%r12
+  8013a0:	74 09                	je     8013ab <readline+0xaf>
+                if (echo) {
+  8013a2:	45 85 f6             	test   %r14d,%r14d
+  8013a5:	75 3f                	jne    8013e6 <readline+0xea>
+                i--;
+  8013a7:	49 83 ec 01          	sub    $0x1,%r12
+        int c = getchar();
+  8013ab:	41 ff d5             	call   *%r13
+  8013ae:	89 c3                	mov    %eax,%ebx
+        if (c < 0) {
+  8013b0:	85 c0                	test   %eax,%eax
+  8013b2:	78 b1                	js     801365 <readline+0x69>
+        } else if ((c == '\b' || c == '\x7F')) {
+  8013b4:	83 f8 08             	cmp    $0x8,%eax
+  8013b7:	74 e4                	je     80139d <readline+0xa1>
+  8013b9:	83 f8 7f             	cmp    $0x7f,%eax
+  8013bc:	74 df                	je     80139d <readline+0xa1>
+        } else if (c >= ' ') {
+  8013be:	83 f8 1f             	cmp    $0x1f,%eax
+  8013c1:	7e 4d                	jle    801410 <readline+0x114>
+            if (i < BUFLEN - 1) {
+  8013c3:	49 81 fc fe 03 00 00 	cmp    $0x3fe,%r12
+  8013ca:	77 df                	ja     8013ab <readline+0xaf>
+                if (echo) {
+  8013cc:	45 85 f6             	test   %r14d,%r14d
+  8013cf:	75 2f                	jne    801400 <readline+0x104>
+                buf[i++] = (char)c;
+  8013d1:	48 b8 20 50 80 00 00 	movabs $0x805020,%rax
+  8013d8:	00 00 00 
+  8013db:	42 88 1c 20          	mov    %bl,(%rax,%r12,1)
+  8013df:	4d 8d 64 24 01       	lea    0x1(%r12),%r12
+  8013e4:	eb c5                	jmp    8013ab <readline+0xaf>
+                    cputchar('\b');
+  8013e6:	bf 08 00 00 00       	mov    $0x8,%edi
+  8013eb:	41 ff d7             	call   *%r15
+                    cputchar(' ');
+  8013ee:	bf 20 00 00 00       	mov    $0x20,%edi
+  8013f3:	41 ff d7             	call   *%r15
+                    cputchar('\b');
+  8013f6:	bf 08 00 00 00       	mov    $0x8,%edi
+  8013fb:	41 ff d7             	call   *%r15
+  8013fe:	eb a7                	jmp    8013a7 <readline+0xab>
+                    cputchar(c);
+  801400:	89 c7                	mov    %eax,%edi
+  801402:	48 b8 9b 02 80 00 00 	movabs $0x80029b,%rax
+  801409:	00 00 00 
+  80140c:	ff d0                	call   *%rax
+  80140e:	eb c1                	jmp    8013d1 <readline+0xd5>
+        } else if (c == '\n' || c == '\r') {
+  801410:	83 f8 0a             	cmp    $0xa,%eax
+  801413:	74 05                	je     80141a <readline+0x11e>
+  801415:	83 f8 0d             	cmp    $0xd,%eax
+  801418:	75 91                	jne    8013ab <readline+0xaf>
+            if (echo) {
+  80141a:	45 85 f6             	test   %r14d,%r14d
+  80141d:	75 14                	jne    801433 <readline+0x137>
+            buf[i] = 0;
+  80141f:	48 b8 20 50 80 00 00 	movabs $0x805020,%rax
+  801426:	00 00 00 
+  801429:	42 c6 04 20 00       	movb   $0x0,(%rax,%r12,1)
+            return buf;
+  80142e:	e9 3c ff ff ff       	jmp    80136f <readline+0x73>
+                cputchar('\n');
+  801433:	bf 0a 00 00 00       	mov    $0xa,%edi
+  801438:	48 b8 9b 02 80 00 00 	movabs $0x80029b,%rax
+  80143f:	00 00 00 
+  801442:	ff d0                	call   *%rax
+  801444:	eb d9                	jmp    80141f <readline+0x123>
+
+0000000000801446 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  801446:	55                   	push   %rbp
+  801447:	48 89 e5             	mov    %rsp,%rbp
+  80144a:	53                   	push   %rbx
+  80144b:	48 89 fa             	mov    %rdi,%rdx
+  80144e:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801451:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801456:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80145b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801460:	be 00 00 00 00       	mov    $0x0,%esi
+  801465:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80146b:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  80146d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801471:	c9                   	leave
+  801472:	c3                   	ret
+
+0000000000801473 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  801473:	55                   	push   %rbp
+  801474:	48 89 e5             	mov    %rsp,%rbp
+  801477:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801478:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80147d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801482:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801487:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80148c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801491:	be 00 00 00 00       	mov    $0x0,%esi
+  801496:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80149c:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  80149e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014a2:	c9                   	leave
+  8014a3:	c3                   	ret
+
+00000000008014a4 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  8014a4:	55                   	push   %rbp
+  8014a5:	48 89 e5             	mov    %rsp,%rbp
+  8014a8:	53                   	push   %rbx
+  8014a9:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  8014ad:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8014b0:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8014b5:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8014ba:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014bf:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014c4:	be 00 00 00 00       	mov    $0x0,%esi
+  8014c9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014cf:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8014d1:	48 85 c0             	test   %rax,%rax
+  8014d4:	7f 06                	jg     8014dc <sys_env_destroy+0x38>
+}
+  8014d6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014da:	c9                   	leave
+  8014db:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8014dc:	49 89 c0             	mov    %rax,%r8
+  8014df:	b9 03 00 00 00       	mov    $0x3,%ecx
+  8014e4:	48 ba c0 36 80 00 00 	movabs $0x8036c0,%rdx
+  8014eb:	00 00 00 
+  8014ee:	be 26 00 00 00       	mov    $0x26,%esi
+  8014f3:	48 bf df 36 80 00 00 	movabs $0x8036df,%rdi
+  8014fa:	00 00 00 
+  8014fd:	b8 00 00 00 00       	mov    $0x0,%eax
+  801502:	49 b9 60 04 80 00 00 	movabs $0x800460,%r9
+  801509:	00 00 00 
+  80150c:	41 ff d1             	call   *%r9
+
+000000000080150f <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  80150f:	55                   	push   %rbp
+  801510:	48 89 e5             	mov    %rsp,%rbp
+  801513:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801514:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801519:	ba 00 00 00 00       	mov    $0x0,%edx
+  80151e:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801523:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801528:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80152d:	be 00 00 00 00       	mov    $0x0,%esi
+  801532:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801538:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  80153a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80153e:	c9                   	leave
+  80153f:	c3                   	ret
+
+0000000000801540 <sys_yield>:
+
+void
+sys_yield(void) {
+  801540:	55                   	push   %rbp
+  801541:	48 89 e5             	mov    %rsp,%rbp
+  801544:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801545:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80154a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80154f:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801554:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801559:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80155e:	be 00 00 00 00       	mov    $0x0,%esi
+  801563:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801569:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  80156b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80156f:	c9                   	leave
+  801570:	c3                   	ret
+
+0000000000801571 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  801571:	55                   	push   %rbp
+  801572:	48 89 e5             	mov    %rsp,%rbp
+  801575:	53                   	push   %rbx
+  801576:	48 89 fa             	mov    %rdi,%rdx
+  801579:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80157c:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801581:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  801588:	00 00 00 
+  80158b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801590:	be 00 00 00 00       	mov    $0x0,%esi
+  801595:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80159b:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  80159d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015a1:	c9                   	leave
+  8015a2:	c3                   	ret
+
+00000000008015a3 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  8015a3:	55                   	push   %rbp
+  8015a4:	48 89 e5             	mov    %rsp,%rbp
+  8015a7:	53                   	push   %rbx
+  8015a8:	49 89 f8             	mov    %rdi,%r8
+  8015ab:	48 89 d3             	mov    %rdx,%rbx
+  8015ae:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8015b1:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8015b6:	4c 89 c2             	mov    %r8,%rdx
+  8015b9:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015bc:	be 00 00 00 00       	mov    $0x0,%esi
+  8015c1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015c7:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  8015c9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015cd:	c9                   	leave
+  8015ce:	c3                   	ret
+
+00000000008015cf <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  8015cf:	55                   	push   %rbp
+  8015d0:	48 89 e5             	mov    %rsp,%rbp
+  8015d3:	53                   	push   %rbx
+  8015d4:	48 83 ec 08          	sub    $0x8,%rsp
+  8015d8:	89 f8                	mov    %edi,%eax
+  8015da:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  8015dd:	48 63 f9             	movslq %ecx,%rdi
+  8015e0:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8015e3:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8015e8:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015eb:	be 00 00 00 00       	mov    $0x0,%esi
+  8015f0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015f6:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8015f8:	48 85 c0             	test   %rax,%rax
+  8015fb:	7f 06                	jg     801603 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  8015fd:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801601:	c9                   	leave
+  801602:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801603:	49 89 c0             	mov    %rax,%r8
+  801606:	b9 04 00 00 00       	mov    $0x4,%ecx
+  80160b:	48 ba c0 36 80 00 00 	movabs $0x8036c0,%rdx
+  801612:	00 00 00 
+  801615:	be 26 00 00 00       	mov    $0x26,%esi
+  80161a:	48 bf df 36 80 00 00 	movabs $0x8036df,%rdi
+  801621:	00 00 00 
+  801624:	b8 00 00 00 00       	mov    $0x0,%eax
+  801629:	49 b9 60 04 80 00 00 	movabs $0x800460,%r9
+  801630:	00 00 00 
+  801633:	41 ff d1             	call   *%r9
+
+0000000000801636 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801636:	55                   	push   %rbp
+  801637:	48 89 e5             	mov    %rsp,%rbp
+  80163a:	53                   	push   %rbx
+  80163b:	48 83 ec 08          	sub    $0x8,%rsp
+  80163f:	89 f8                	mov    %edi,%eax
+  801641:	49 89 f2             	mov    %rsi,%r10
+  801644:	48 89 cf             	mov    %rcx,%rdi
+  801647:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  80164a:	48 63 da             	movslq %edx,%rbx
+  80164d:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801650:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801655:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801658:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  80165b:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80165d:	48 85 c0             	test   %rax,%rax
+  801660:	7f 06                	jg     801668 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  801662:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801666:	c9                   	leave
+  801667:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801668:	49 89 c0             	mov    %rax,%r8
+  80166b:	b9 05 00 00 00       	mov    $0x5,%ecx
+  801670:	48 ba c0 36 80 00 00 	movabs $0x8036c0,%rdx
+  801677:	00 00 00 
+  80167a:	be 26 00 00 00       	mov    $0x26,%esi
+  80167f:	48 bf df 36 80 00 00 	movabs $0x8036df,%rdi
+  801686:	00 00 00 
+  801689:	b8 00 00 00 00       	mov    $0x0,%eax
+  80168e:	49 b9 60 04 80 00 00 	movabs $0x800460,%r9
+  801695:	00 00 00 
+  801698:	41 ff d1             	call   *%r9
+
+000000000080169b <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  80169b:	55                   	push   %rbp
+  80169c:	48 89 e5             	mov    %rsp,%rbp
+  80169f:	53                   	push   %rbx
+  8016a0:	48 83 ec 08          	sub    $0x8,%rsp
+  8016a4:	48 89 f1             	mov    %rsi,%rcx
+  8016a7:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  8016aa:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8016ad:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8016b2:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8016b7:	be 00 00 00 00       	mov    $0x0,%esi
+  8016bc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8016c2:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8016c4:	48 85 c0             	test   %rax,%rax
+  8016c7:	7f 06                	jg     8016cf <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  8016c9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8016cd:	c9                   	leave
+  8016ce:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8016cf:	49 89 c0             	mov    %rax,%r8
+  8016d2:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8016d7:	48 ba c0 36 80 00 00 	movabs $0x8036c0,%rdx
+  8016de:	00 00 00 
+  8016e1:	be 26 00 00 00       	mov    $0x26,%esi
+  8016e6:	48 bf df 36 80 00 00 	movabs $0x8036df,%rdi
+  8016ed:	00 00 00 
+  8016f0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016f5:	49 b9 60 04 80 00 00 	movabs $0x800460,%r9
+  8016fc:	00 00 00 
+  8016ff:	41 ff d1             	call   *%r9
+
+0000000000801702 <sys_region_batch>:
+
+int
+sys_region_batch(const struct RegionOp *ops, size_t count) {
+  801702:	55                   	push   %rbp
+  801703:	48 89 e5             	mov    %rsp,%rbp
+  801706:	53                   	push   %rbx
+  801707:	48 83 ec 08          	sub    $0x8,%rsp
+  80170b:	48 89 fa             	mov    %rdi,%rdx
+  80170e:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801711:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801716:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80171b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801720:	be 00 00 00 00       	mov    $0x0,%esi
+  801725:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80172b:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80172d:	48 85 c0             	test   %rax,%rax
+  801730:	7f 06                	jg     801738 <sys_region_batch+0x36>
+        else
+            platform_asan_unpoison(va, ops[i].size);
+    }
+#endif
+    return res;
+}
+  801732:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801736:	c9                   	leave
+  801737:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801738:	49 89 c0             	mov    %rax,%r8
+  80173b:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  801740:	48 ba c0 36 80 00 00 	movabs $0x8036c0,%rdx
+  801747:	00 00 00 
+  80174a:	be 26 00 00 00       	mov    $0x26,%esi
+  80174f:	48 bf df 36 80 00 00 	movabs $0x8036df,%rdi
+  801756:	00 00 00 
+  801759:	b8 00 00 00 00       	mov    $0x0,%eax
+  80175e:	49 b9 60 04 80 00 00 	movabs $0x800460,%r9
+  801765:	00 00 00 
+  801768:	41 ff d1             	call   *%r9
+
+000000000080176b <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  80176b:	55                   	push   %rbp
+  80176c:	48 89 e5             	mov    %rsp,%rbp
+  80176f:	53                   	push   %rbx
+  801770:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  801774:	48 63 ce             	movslq %esi,%rcx
+  801777:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80177a:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80177f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801784:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801789:	be 00 00 00 00       	mov    $0x0,%esi
+  80178e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801794:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801796:	48 85 c0             	test   %rax,%rax
+  801799:	7f 06                	jg     8017a1 <sys_env_set_status+0x36>
+}
+  80179b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80179f:	c9                   	leave
+  8017a0:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8017a1:	49 89 c0             	mov    %rax,%r8
+  8017a4:	b9 09 00 00 00       	mov    $0x9,%ecx
+  8017a9:	48 ba c0 36 80 00 00 	movabs $0x8036c0,%rdx
+  8017b0:	00 00 00 
+  8017b3:	be 26 00 00 00       	mov    $0x26,%esi
+  8017b8:	48 bf df 36 80 00 00 	movabs $0x8036df,%rdi
+  8017bf:	00 00 00 
+  8017c2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017c7:	49 b9 60 04 80 00 00 	movabs $0x800460,%r9
+  8017ce:	00 00 00 
+  8017d1:	41 ff d1             	call   *%r9
+
+00000000008017d4 <sys_env_set_weight>:
+
+int
+sys_env_set_weight(envid_t envid, uint32_t weight) {
+  8017d4:	55                   	push   %rbp
+  8017d5:	48 89 e5             	mov    %rsp,%rbp
+  8017d8:	53                   	push   %rbx
+  8017d9:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_weight, 1, envid, weight, 0, 0, 0, 0);
+  8017dd:	89 f1                	mov    %esi,%ecx
+  8017df:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8017e2:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8017e7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017ec:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8017f1:	be 00 00 00 00       	mov    $0x0,%esi
+  8017f6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8017fc:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8017fe:	48 85 c0             	test   %rax,%rax
+  801801:	7f 06                	jg     801809 <sys_env_set_weight+0x35>
+}
+  801803:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801807:	c9                   	leave
+  801808:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801809:	49 89 c0             	mov    %rax,%r8
+  80180c:	b9 10 00 00 00       	mov    $0x10,%ecx
+  801811:	48 ba c0 36 80 00 00 	movabs $0x8036c0,%rdx
+  801818:	00 00 00 
+  80181b:	be 26 00 00 00       	mov    $0x26,%esi
+  801820:	48 bf df 36 80 00 00 	movabs $0x8036df,%rdi
+  801827:	00 00 00 
+  80182a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80182f:	49 b9 60 04 80 00 00 	movabs $0x800460,%r9
+  801836:	00 00 00 
+  801839:	41 ff d1             	call   *%r9
+
+000000000080183c <sys_env_set_rt>:
+
+int
+sys_env_set_rt(envid_t envid, uint64_t period, uint64_t budget, uint64_t deadline) {
+  80183c:	55                   	push   %rbp
+  80183d:	48 89 e5             	mov    %rsp,%rbp
+  801840:	53                   	push   %rbx
+  801841:	48 83 ec 08          	sub    $0x8,%rsp
+  801845:	89 f8                	mov    %edi,%eax
+  801847:	48 89 d3             	mov    %rdx,%rbx
+  80184a:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_env_set_rt, 1, envid, period, budget, deadline, 0, 0);
+  80184d:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801850:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801855:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801858:	be 00 00 00 00       	mov    $0x0,%esi
+  80185d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801863:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801865:	48 85 c0             	test   %rax,%rax
+  801868:	7f 06                	jg     801870 <sys_env_set_rt+0x34>
+}
+  80186a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80186e:	c9                   	leave
+  80186f:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801870:	49 89 c0             	mov    %rax,%r8
+  801873:	b9 11 00 00 00       	mov    $0x11,%ecx
+  801878:	48 ba c0 36 80 00 00 	movabs $0x8036c0,%rdx
+  80187f:	00 00 00 
+  801882:	be 26 00 00 00       	mov    $0x26,%esi
+  801887:	48 bf df 36 80 00 00 	movabs $0x8036df,%rdi
+  80188e:	00 00 00 
+  801891:	b8 00 00 00 00       	mov    $0x0,%eax
+  801896:	49 b9 60 04 80 00 00 	movabs $0x800460,%r9
+  80189d:	00 00 00 
+  8018a0:	41 ff d1             	call   *%r9
+
+00000000008018a3 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  8018a3:	55                   	push   %rbp
+  8018a4:	48 89 e5             	mov    %rsp,%rbp
+  8018a7:	53                   	push   %rbx
+  8018a8:	48 83 ec 08          	sub    $0x8,%rsp
+  8018ac:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  8018af:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8018b2:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8018b7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8018bc:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8018c1:	be 00 00 00 00       	mov    $0x0,%esi
+  8018c6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8018cc:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8018ce:	48 85 c0             	test   %rax,%rax
+  8018d1:	7f 06                	jg     8018d9 <sys_env_set_trapframe+0x36>
+}
+  8018d3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8018d7:	c9                   	leave
+  8018d8:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8018d9:	49 89 c0             	mov    %rax,%r8
+  8018dc:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  8018e1:	48 ba c0 36 80 00 00 	movabs $0x8036c0,%rdx
+  8018e8:	00 00 00 
+  8018eb:	be 26 00 00 00       	mov    $0x26,%esi
+  8018f0:	48 bf df 36 80 00 00 	movabs $0x8036df,%rdi
+  8018f7:	00 00 00 
+  8018fa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018ff:	49 b9 60 04 80 00 00 	movabs $0x800460,%r9
+  801906:	00 00 00 
+  801909:	41 ff d1             	call   *%r9
+
+000000000080190c <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  80190c:	55                   	push   %rbp
+  80190d:	48 89 e5             	mov    %rsp,%rbp
+  801910:	53                   	push   %rbx
+  801911:	48 83 ec 08          	sub    $0x8,%rsp
+  801915:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  801918:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80191b:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801920:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801925:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80192a:	be 00 00 00 00       	mov    $0x0,%esi
+  80192f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801935:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801937:	48 85 c0             	test   %rax,%rax
+  80193a:	7f 06                	jg     801942 <sys_env_set_pgfault_upcall+0x36>
+}
+  80193c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801940:	c9                   	leave
+  801941:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801942:	49 89 c0             	mov    %rax,%r8
+  801945:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  80194a:	48 ba c0 36 80 00 00 	movabs $0x8036c0,%rdx
+  801951:	00 00 00 
+  801954:	be 26 00 00 00       	mov    $0x26,%esi
+  801959:	48 bf df 36 80 00 00 	movabs $0x8036df,%rdi
+  801960:	00 00 00 
+  801963:	b8 00 00 00 00       	mov    $0x0,%eax
+  801968:	49 b9 60 04 80 00 00 	movabs $0x800460,%r9
+  80196f:	00 00 00 
+  801972:	41 ff d1             	call   *%r9
+
+0000000000801975 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  801975:	55                   	push   %rbp
+  801976:	48 89 e5             	mov    %rsp,%rbp
+  801979:	53                   	push   %rbx
+  80197a:	89 f8                	mov    %edi,%eax
+  80197c:	49 89 f1             	mov    %rsi,%r9
+  80197f:	48 89 d3             	mov    %rdx,%rbx
+  801982:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  801985:	49 63 f0             	movslq %r8d,%rsi
+  801988:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80198b:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801990:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801993:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801999:	cd 30                	int    $0x30
+}
+  80199b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80199f:	c9                   	leave
+  8019a0:	c3                   	ret
+
+00000000008019a1 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  8019a1:	55                   	push   %rbp
+  8019a2:	48 89 e5             	mov    %rsp,%rbp
+  8019a5:	53                   	push   %rbx
+  8019a6:	48 83 ec 08          	sub    $0x8,%rsp
+  8019aa:	48 89 fa             	mov    %rdi,%rdx
+  8019ad:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8019b0:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8019b5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8019ba:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8019bf:	be 00 00 00 00       	mov    $0x0,%esi
+  8019c4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8019ca:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8019cc:	48 85 c0             	test   %rax,%rax
+  8019cf:	7f 06                	jg     8019d7 <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8019d1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8019d5:	c9                   	leave
+  8019d6:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8019d7:	49 89 c0             	mov    %rax,%r8
+  8019da:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  8019df:	48 ba c0 36 80 00 00 	movabs $0x8036c0,%rdx
+  8019e6:	00 00 00 
+  8019e9:	be 26 00 00 00       	mov    $0x26,%esi
+  8019ee:	48 bf df 36 80 00 00 	movabs $0x8036df,%rdi
+  8019f5:	00 00 00 
+  8019f8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019fd:	49 b9 60 04 80 00 00 	movabs $0x800460,%r9
+  801a04:	00 00 00 
+  801a07:	41 ff d1             	call   *%r9
+
+0000000000801a0a <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801a0a:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801a11:	ff ff ff 
+  801a14:	48 01 f8             	add    %rdi,%rax
+  801a17:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  801a1b:	c3                   	ret
+
+0000000000801a1c <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801a1c:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801a23:	ff ff ff 
+  801a26:	48 01 f8             	add    %rdi,%rax
+  801a29:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  801a2d:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  801a33:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  801a37:	c3                   	ret
+
+0000000000801a38 <fd_alloc_from>:
+}
+
+/* Like fd_alloc(), but only considers fds starting from fdnum,
+ * so that several fds can be found before their pages are allocated */
+int
+fd_alloc_from(int fdnum, struct Fd **fd_store) {
+  801a38:	55                   	push   %rbp
+  801a39:	48 89 e5             	mov    %rsp,%rbp
+  801a3c:	41 57                	push   %r15
+  801a3e:	41 56                	push   %r14
+  801a40:	41 55                	push   %r13
+  801a42:	41 54                	push   %r12
+  801a44:	53                   	push   %rbx
+  801a45:	48 83 ec 08          	sub    $0x8,%rsp
+  801a49:	49 89 f7             	mov    %rsi,%r15
+    for (int i = MAX(fdnum, 0); i < MAXFD; i++) {
+  801a4c:	85 ff                	test   %edi,%edi
+  801a4e:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  801a54:	44 0f 49 e7          	cmovns %edi,%r12d
+  801a58:	83 ff 1f             	cmp    $0x1f,%edi
+  801a5b:	7f 37                	jg     801a94 <fd_alloc_from+0x5c>
+  801a5d:	49 63 dc             	movslq %r12d,%rbx
+  801a60:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  801a67:	48 c1 e3 0c          	shl    $0xc,%rbx
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  801a6b:	49 be e5 2c 80 00 00 	movabs $0x802ce5,%r14
+  801a72:	00 00 00 
+        struct Fd *fd = INDEX2FD(i);
+  801a75:	49 89 dd             	mov    %rbx,%r13
+        if (!(get_prot(fd) & PROT_R)) {
+  801a78:	48 89 df             	mov    %rbx,%rdi
+  801a7b:	41 ff d6             	call   *%r14
+  801a7e:	83 e0 04             	and    $0x4,%eax
+  801a81:	74 1c                	je     801a9f <fd_alloc_from+0x67>
+    for (int i = MAX(fdnum, 0); i < MAXFD; i++) {
+  801a83:	41 83 c4 01          	add    $0x1,%r12d
+  801a87:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801a8e:	41 83 fc 1f          	cmp    $0x1f,%r12d
+  801a92:	7e e1                	jle    801a75 <fd_alloc_from+0x3d>
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  801a94:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801a9a:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  801a9f:	4d 89 2f             	mov    %r13,(%r15)
+}
+  801aa2:	48 83 c4 08          	add    $0x8,%rsp
+  801aa6:	5b                   	pop    %rbx
+  801aa7:	41 5c                	pop    %r12
+  801aa9:	41 5d                	pop    %r13
+  801aab:	41 5e                	pop    %r14
+  801aad:	41 5f                	pop    %r15
+  801aaf:	5d                   	pop    %rbp
+  801ab0:	c3                   	ret
+
+0000000000801ab1 <fd_alloc>:
+fd_alloc(struct Fd **fd_store) {
+  801ab1:	55                   	push   %rbp
+  801ab2:	48 89 e5             	mov    %rsp,%rbp
+  801ab5:	48 89 fe             	mov    %rdi,%rsi
+    return fd_alloc_from(0, fd_store);
+  801ab8:	bf 00 00 00 00       	mov    $0x0,%edi
+  801abd:	48 b8 38 1a 80 00 00 	movabs $0x801a38,%rax
+  801ac4:	00 00 00 
+  801ac7:	ff d0                	call   *%rax
+}
+  801ac9:	5d                   	pop    %rbp
+  801aca:	c3                   	ret
+
+0000000000801acb <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  801acb:	83 ff 1f             	cmp    $0x1f,%edi
+  801ace:	77 39                	ja     801b09 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  801ad0:	55                   	push   %rbp
+  801ad1:	48 89 e5             	mov    %rsp,%rbp
+  801ad4:	41 54                	push   %r12
+  801ad6:	53                   	push   %rbx
+  801ad7:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  801ada:	48 63 df             	movslq %edi,%rbx
+  801add:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  801ae4:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  801ae8:	48 89 df             	mov    %rbx,%rdi
+  801aeb:	48 b8 e5 2c 80 00 00 	movabs $0x802ce5,%rax
+  801af2:	00 00 00 
+  801af5:	ff d0                	call   *%rax
+  801af7:	a8 04                	test   $0x4,%al
+  801af9:	74 14                	je     801b0f <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  801afb:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  801aff:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801b04:	5b                   	pop    %rbx
+  801b05:	41 5c                	pop    %r12
+  801b07:	5d                   	pop    %rbp
+  801b08:	c3                   	ret
+        return -E_INVAL;
+  801b09:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801b0e:	c3                   	ret
+        return -E_INVAL;
+  801b0f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801b14:	eb ee                	jmp    801b04 <fd_lookup+0x39>
+
+0000000000801b16 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  801b16:	55                   	push   %rbp
+  801b17:	48 89 e5             	mov    %rsp,%rbp
+  801b1a:	41 54                	push   %r12
+  801b1c:	53                   	push   %rbx
+  801b1d:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  801b20:	48 b8 80 37 80 00 00 	movabs $0x803780,%rax
+  801b27:	00 00 00 
+  801b2a:	48 bb 40 40 80 00 00 	movabs $0x804040,%rbx
+  801b31:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  801b34:	39 3b                	cmp    %edi,(%rbx)
+  801b36:	74 47                	je     801b7f <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  801b38:	48 83 c0 08          	add    $0x8,%rax
+  801b3c:	48 8b 18             	mov    (%rax),%rbx
+  801b3f:	48 85 db             	test   %rbx,%rbx
+  801b42:	75 f0                	jne    801b34 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801b44:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801b4b:	00 00 00 
+  801b4e:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+  801b54:	89 fa                	mov    %edi,%edx
+  801b56:	48 bf f0 36 80 00 00 	movabs $0x8036f0,%rdi
+  801b5d:	00 00 00 
+  801b60:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b65:	48 b9 b0 05 80 00 00 	movabs $0x8005b0,%rcx
+  801b6c:	00 00 00 
+  801b6f:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  801b71:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  801b76:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  801b7a:	5b                   	pop    %rbx
+  801b7b:	41 5c                	pop    %r12
+  801b7d:	5d                   	pop    %rbp
+  801b7e:	c3                   	ret
+            return 0;
+  801b7f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b84:	eb f0                	jmp    801b76 <dev_lookup+0x60>
+
+0000000000801b86 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  801b86:	55                   	push   %rbp
+  801b87:	48 89 e5             	mov    %rsp,%rbp
+  801b8a:	41 55                	push   %r13
+  801b8c:	41 54                	push   %r12
+  801b8e:	53                   	push   %rbx
+  801b8f:	48 83 ec 18          	sub    $0x18,%rsp
+  801b93:	48 89 fb             	mov    %rdi,%rbx
+  801b96:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801b99:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  801ba0:	ff ff ff 
+  801ba3:	48 01 df             	add    %rbx,%rdi
+  801ba6:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  801baa:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801bae:	48 b8 cb 1a 80 00 00 	movabs $0x801acb,%rax
+  801bb5:	00 00 00 
+  801bb8:	ff d0                	call   *%rax
+  801bba:	41 89 c5             	mov    %eax,%r13d
+  801bbd:	85 c0                	test   %eax,%eax
+  801bbf:	78 06                	js     801bc7 <fd_close+0x41>
+  801bc1:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  801bc5:	74 1a                	je     801be1 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  801bc7:	45 84 e4             	test   %r12b,%r12b
+  801bca:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bcf:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  801bd3:	44 89 e8             	mov    %r13d,%eax
+  801bd6:	48 83 c4 18          	add    $0x18,%rsp
+  801bda:	5b                   	pop    %rbx
+  801bdb:	41 5c                	pop    %r12
+  801bdd:	41 5d                	pop    %r13
+  801bdf:	5d                   	pop    %rbp
+  801be0:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801be1:	8b 3b                	mov    (%rbx),%edi
+  801be3:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801be7:	48 b8 16 1b 80 00 00 	movabs $0x801b16,%rax
+  801bee:	00 00 00 
+  801bf1:	ff d0                	call   *%rax
+  801bf3:	41 89 c5             	mov    %eax,%r13d
+  801bf6:	85 c0                	test   %eax,%eax
+  801bf8:	78 1b                	js     801c15 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  801bfa:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801bfe:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801c02:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801c08:	48 85 c0             	test   %rax,%rax
+  801c0b:	74 08                	je     801c15 <fd_close+0x8f>
+  801c0d:	48 89 df             	mov    %rbx,%rdi
+  801c10:	ff d0                	call   *%rax
+  801c12:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801c15:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801c1a:	48 89 de             	mov    %rbx,%rsi
+  801c1d:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c22:	48 b8 9b 16 80 00 00 	movabs $0x80169b,%rax
+  801c29:	00 00 00 
+  801c2c:	ff d0                	call   *%rax
+    return res;
+  801c2e:	eb a3                	jmp    801bd3 <fd_close+0x4d>
+
+0000000000801c30 <close>:
+
+int
+close(int fdnum) {
+  801c30:	55                   	push   %rbp
+  801c31:	48 89 e5             	mov    %rsp,%rbp
+  801c34:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  801c38:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801c3c:	48 b8 cb 1a 80 00 00 	movabs $0x801acb,%rax
+  801c43:	00 00 00 
+  801c46:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801c48:	85 c0                	test   %eax,%eax
+  801c4a:	78 15                	js     801c61 <close+0x31>
+
+    return fd_close(fd, 1);
+  801c4c:	be 01 00 00 00       	mov    $0x1,%esi
+  801c51:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801c55:	48 b8 86 1b 80 00 00 	movabs $0x801b86,%rax
+  801c5c:	00 00 00 
+  801c5f:	ff d0                	call   *%rax
+}
+  801c61:	c9                   	leave
+  801c62:	c3                   	ret
+
+0000000000801c63 <close_all>:
+
+void
+close_all(void) {
+  801c63:	55                   	push   %rbp
+  801c64:	48 89 e5             	mov    %rsp,%rbp
+  801c67:	41 54                	push   %r12
+  801c69:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  801c6a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801c6f:	49 bc 30 1c 80 00 00 	movabs $0x801c30,%r12
+  801c76:	00 00 00 
+  801c79:	89 df                	mov    %ebx,%edi
+  801c7b:	41 ff d4             	call   *%r12
+  801c7e:	83 c3 01             	add    $0x1,%ebx
+  801c81:	83 fb 20             	cmp    $0x20,%ebx
+  801c84:	75 f3                	jne    801c79 <close_all+0x16>
+}
+  801c86:	5b                   	pop    %rbx
+  801c87:	41 5c                	pop    %r12
+  801c89:	5d                   	pop    %rbp
+  801c8a:	c3                   	ret
+
+0000000000801c8b <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  801c8b:	55                   	push   %rbp
+  801c8c:	48 89 e5             	mov    %rsp,%rbp
+  801c8f:	41 57                	push   %r15
+  801c91:	41 56                	push   %r14
+  801c93:	41 55                	push   %r13
+  801c95:	41 54                	push   %r12
+  801c97:	53                   	push   %rbx
+  801c98:	48 83 ec 18          	sub    $0x18,%rsp
+  801c9c:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  801c9f:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801ca3:	48 b8 cb 1a 80 00 00 	movabs $0x801acb,%rax
+  801caa:	00 00 00 
+  801cad:	ff d0                	call   *%rax
+  801caf:	89 c3                	mov    %eax,%ebx
+  801cb1:	85 c0                	test   %eax,%eax
+  801cb3:	0f 88 b8 00 00 00    	js     801d71 <dup+0xe6>
+    close(newfdnum);
+  801cb9:	44 89 e7             	mov    %r12d,%edi
+  801cbc:	48 b8 30 1c 80 00 00 	movabs $0x801c30,%rax
+  801cc3:	00 00 00 
+  801cc6:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  801cc8:	4d 63 ec             	movslq %r12d,%r13
+  801ccb:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  801cd2:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  801cd6:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  801cda:	4c 89 ff             	mov    %r15,%rdi
+  801cdd:	49 be 1c 1a 80 00 00 	movabs $0x801a1c,%r14
+  801ce4:	00 00 00 
+  801ce7:	41 ff d6             	call   *%r14
+  801cea:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  801ced:	4c 89 ef             	mov    %r13,%rdi
+  801cf0:	41 ff d6             	call   *%r14
+  801cf3:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  801cf6:	48 89 df             	mov    %rbx,%rdi
+  801cf9:	48 b8 e5 2c 80 00 00 	movabs $0x802ce5,%rax
+  801d00:	00 00 00 
+  801d03:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  801d05:	a8 04                	test   $0x4,%al
+  801d07:	74 2b                	je     801d34 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  801d09:	41 89 c1             	mov    %eax,%r9d
+  801d0c:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801d12:	4c 89 f1             	mov    %r14,%rcx
+  801d15:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d1a:	48 89 de             	mov    %rbx,%rsi
+  801d1d:	bf 00 00 00 00       	mov    $0x0,%edi
+  801d22:	48 b8 36 16 80 00 00 	movabs $0x801636,%rax
+  801d29:	00 00 00 
+  801d2c:	ff d0                	call   *%rax
+  801d2e:	89 c3                	mov    %eax,%ebx
+  801d30:	85 c0                	test   %eax,%eax
+  801d32:	78 4e                	js     801d82 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  801d34:	4c 89 ff             	mov    %r15,%rdi
+  801d37:	48 b8 e5 2c 80 00 00 	movabs $0x802ce5,%rax
+  801d3e:	00 00 00 
+  801d41:	ff d0                	call   *%rax
+  801d43:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801d46:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801d4c:	4c 89 e9             	mov    %r13,%rcx
+  801d4f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d54:	4c 89 fe             	mov    %r15,%rsi
+  801d57:	bf 00 00 00 00       	mov    $0x0,%edi
+  801d5c:	48 b8 36 16 80 00 00 	movabs $0x801636,%rax
+  801d63:	00 00 00 
+  801d66:	ff d0                	call   *%rax
+  801d68:	89 c3                	mov    %eax,%ebx
+  801d6a:	85 c0                	test   %eax,%eax
+  801d6c:	78 14                	js     801d82 <dup+0xf7>
+
+    return newfdnum;
+  801d6e:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  801d71:	89 d8                	mov    %ebx,%eax
+  801d73:	48 83 c4 18          	add    $0x18,%rsp
+  801d77:	5b                   	pop    %rbx
+  801d78:	41 5c                	pop    %r12
+  801d7a:	41 5d                	pop    %r13
+  801d7c:	41 5e                	pop    %r14
+  801d7e:	41 5f                	pop    %r15
+  801d80:	5d                   	pop    %rbp
+  801d81:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  801d82:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801d87:	4c 89 ee             	mov    %r13,%rsi
+  801d8a:	bf 00 00 00 00       	mov    $0x0,%edi
+  801d8f:	49 bc 9b 16 80 00 00 	movabs $0x80169b,%r12
+  801d96:	00 00 00 
+  801d99:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  801d9c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801da1:	4c 89 f6             	mov    %r14,%rsi
+  801da4:	bf 00 00 00 00       	mov    $0x0,%edi
+  801da9:	41 ff d4             	call   *%r12
+    return res;
+  801dac:	eb c3                	jmp    801d71 <dup+0xe6>
+
+0000000000801dae <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  801dae:	55                   	push   %rbp
+  801daf:	48 89 e5             	mov    %rsp,%rbp
+  801db2:	41 56                	push   %r14
+  801db4:	41 55                	push   %r13
+  801db6:	41 54                	push   %r12
+  801db8:	53                   	push   %rbx
+  801db9:	48 83 ec 10          	sub    $0x10,%rsp
+  801dbd:	89 fb                	mov    %edi,%ebx
+  801dbf:	49 89 f4             	mov    %rsi,%r12
+  801dc2:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801dc5:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801dc9:	48 b8 cb 1a 80 00 00 	movabs $0x801acb,%rax
+  801dd0:	00 00 00 
+  801dd3:	ff d0                	call   *%rax
+  801dd5:	85 c0                	test   %eax,%eax
+  801dd7:	78 4c                	js     801e25 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801dd9:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801ddd:	41 8b 3e             	mov    (%r14),%edi
+  801de0:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801de4:	48 b8 16 1b 80 00 00 	movabs $0x801b16,%rax
+  801deb:	00 00 00 
+  801dee:	ff d0                	call   *%rax
+  801df0:	85 c0                	test   %eax,%eax
+  801df2:	78 35                	js     801e29 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801df4:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801df8:	83 e0 03             	and    $0x3,%eax
+  801dfb:	83 f8 01             	cmp    $0x1,%eax
+  801dfe:	74 2d                	je     801e2d <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801e00:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801e04:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801e08:	48 85 c0             	test   %rax,%rax
+  801e0b:	74 56                	je     801e63 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  801e0d:	4c 89 ea             	mov    %r13,%rdx
+  801e10:	4c 89 e6             	mov    %r12,%rsi
+  801e13:	4c 89 f7             	mov    %r14,%rdi
+  801e16:	ff d0                	call   *%rax
+}
+  801e18:	48 83 c4 10          	add    $0x10,%rsp
+  801e1c:	5b                   	pop    %rbx
+  801e1d:	41 5c                	pop    %r12
+  801e1f:	41 5d                	pop    %r13
+  801e21:	41 5e                	pop    %r14
+  801e23:	5d                   	pop    %rbp
+  801e24:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801e25:	48 98                	cltq
+  801e27:	eb ef                	jmp    801e18 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801e29:	48 98                	cltq
+  801e2b:	eb eb                	jmp    801e18 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801e2d:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801e34:	00 00 00 
+  801e37:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+  801e3d:	89 da                	mov    %ebx,%edx
+  801e3f:	48 bf 31 37 80 00 00 	movabs $0x803731,%rdi
+  801e46:	00 00 00 
+  801e49:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e4e:	48 b9 b0 05 80 00 00 	movabs $0x8005b0,%rcx
+  801e55:	00 00 00 
+  801e58:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801e5a:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801e61:	eb b5                	jmp    801e18 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801e63:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801e6a:	eb ac                	jmp    801e18 <read+0x6a>
+
+0000000000801e6c <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801e6c:	55                   	push   %rbp
+  801e6d:	48 89 e5             	mov    %rsp,%rbp
+  801e70:	41 57                	push   %r15
+  801e72:	41 56                	push   %r14
+  801e74:	41 55                	push   %r13
+  801e76:	41 54                	push   %r12
+  801e78:	53                   	push   %rbx
+  801e79:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  801e7d:	48 85 d2             	test   %rdx,%rdx
+  801e80:	74 54                	je     801ed6 <readn+0x6a>
+  801e82:	41 89 fd             	mov    %edi,%r13d
+  801e85:	49 89 f6             	mov    %rsi,%r14
+  801e88:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  801e8b:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  801e90:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  801e95:	49 bf ae 1d 80 00 00 	movabs $0x801dae,%r15
+  801e9c:	00 00 00 
+  801e9f:	4c 89 e2             	mov    %r12,%rdx
+  801ea2:	48 29 f2             	sub    %rsi,%rdx
+  801ea5:	4c 01 f6             	add    %r14,%rsi
+  801ea8:	44 89 ef             	mov    %r13d,%edi
+  801eab:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  801eae:	85 c0                	test   %eax,%eax
+  801eb0:	78 20                	js     801ed2 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  801eb2:	01 c3                	add    %eax,%ebx
+  801eb4:	85 c0                	test   %eax,%eax
+  801eb6:	74 08                	je     801ec0 <readn+0x54>
+  801eb8:	48 63 f3             	movslq %ebx,%rsi
+  801ebb:	4c 39 e6             	cmp    %r12,%rsi
+  801ebe:	72 df                	jb     801e9f <readn+0x33>
+    }
+    return res;
+  801ec0:	48 63 c3             	movslq %ebx,%rax
+}
+  801ec3:	48 83 c4 08          	add    $0x8,%rsp
+  801ec7:	5b                   	pop    %rbx
+  801ec8:	41 5c                	pop    %r12
+  801eca:	41 5d                	pop    %r13
+  801ecc:	41 5e                	pop    %r14
+  801ece:	41 5f                	pop    %r15
+  801ed0:	5d                   	pop    %rbp
+  801ed1:	c3                   	ret
+        if (inc < 0) return inc;
+  801ed2:	48 98                	cltq
+  801ed4:	eb ed                	jmp    801ec3 <readn+0x57>
+    int inc = 1, res = 0;
+  801ed6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801edb:	eb e3                	jmp    801ec0 <readn+0x54>
+
+0000000000801edd <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  801edd:	55                   	push   %rbp
+  801ede:	48 89 e5             	mov    %rsp,%rbp
+  801ee1:	41 56                	push   %r14
+  801ee3:	41 55                	push   %r13
+  801ee5:	41 54                	push   %r12
+  801ee7:	53                   	push   %rbx
+  801ee8:	48 83 ec 10          	sub    $0x10,%rsp
+  801eec:	89 fb                	mov    %edi,%ebx
+  801eee:	49 89 f4             	mov    %rsi,%r12
+  801ef1:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801ef4:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801ef8:	48 b8 cb 1a 80 00 00 	movabs $0x801acb,%rax
+  801eff:	00 00 00 
+  801f02:	ff d0                	call   *%rax
+  801f04:	85 c0                	test   %eax,%eax
+  801f06:	78 47                	js     801f4f <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801f08:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801f0c:	41 8b 3e             	mov    (%r14),%edi
+  801f0f:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801f13:	48 b8 16 1b 80 00 00 	movabs $0x801b16,%rax
+  801f1a:	00 00 00 
+  801f1d:	ff d0                	call   *%rax
+  801f1f:	85 c0                	test   %eax,%eax
+  801f21:	78 30                	js     801f53 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801f23:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  801f28:	74 2d                	je     801f57 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801f2a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801f2e:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801f32:	48 85 c0             	test   %rax,%rax
+  801f35:	74 56                	je     801f8d <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  801f37:	4c 89 ea             	mov    %r13,%rdx
+  801f3a:	4c 89 e6             	mov    %r12,%rsi
+  801f3d:	4c 89 f7             	mov    %r14,%rdi
+  801f40:	ff d0                	call   *%rax
+}
+  801f42:	48 83 c4 10          	add    $0x10,%rsp
+  801f46:	5b                   	pop    %rbx
+  801f47:	41 5c                	pop    %r12
+  801f49:	41 5d                	pop    %r13
+  801f4b:	41 5e                	pop    %r14
+  801f4d:	5d                   	pop    %rbp
+  801f4e:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801f4f:	48 98                	cltq
+  801f51:	eb ef                	jmp    801f42 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801f53:	48 98                	cltq
+  801f55:	eb eb                	jmp    801f42 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801f57:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801f5e:	00 00 00 
+  801f61:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+  801f67:	89 da                	mov    %ebx,%edx
+  801f69:	48 bf 4d 37 80 00 00 	movabs $0x80374d,%rdi
+  801f70:	00 00 00 
+  801f73:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f78:	48 b9 b0 05 80 00 00 	movabs $0x8005b0,%rcx
+  801f7f:	00 00 00 
+  801f82:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801f84:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801f8b:	eb b5                	jmp    801f42 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801f8d:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801f94:	eb ac                	jmp    801f42 <write+0x65>
+
+0000000000801f96 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  801f96:	55                   	push   %rbp
+  801f97:	48 89 e5             	mov    %rsp,%rbp
+  801f9a:	53                   	push   %rbx
+  801f9b:	48 83 ec 18          	sub    $0x18,%rsp
+  801f9f:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801fa1:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801fa5:	48 b8 cb 1a 80 00 00 	movabs $0x801acb,%rax
+  801fac:	00 00 00 
+  801faf:	ff d0                	call   *%rax
+  801fb1:	85 c0                	test   %eax,%eax
+  801fb3:	78 0c                	js     801fc1 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  801fb5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801fb9:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  801fbc:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801fc1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801fc5:	c9                   	leave
+  801fc6:	c3                   	ret
+
+0000000000801fc7 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  801fc7:	55                   	push   %rbp
+  801fc8:	48 89 e5             	mov    %rsp,%rbp
+  801fcb:	41 55                	push   %r13
+  801fcd:	41 54                	push   %r12
+  801fcf:	53                   	push   %rbx
+  801fd0:	48 83 ec 18          	sub    $0x18,%rsp
+  801fd4:	89 fb                	mov    %edi,%ebx
+  801fd6:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801fd9:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801fdd:	48 b8 cb 1a 80 00 00 	movabs $0x801acb,%rax
+  801fe4:	00 00 00 
+  801fe7:	ff d0                	call   *%rax
+  801fe9:	85 c0                	test   %eax,%eax
+  801feb:	78 38                	js     802025 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801fed:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  801ff1:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  801ff5:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801ff9:	48 b8 16 1b 80 00 00 	movabs $0x801b16,%rax
+  802000:	00 00 00 
+  802003:	ff d0                	call   *%rax
+  802005:	85 c0                	test   %eax,%eax
+  802007:	78 1c                	js     802025 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802009:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  80200e:	74 20                	je     802030 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  802010:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802014:	48 8b 40 30          	mov    0x30(%rax),%rax
+  802018:	48 85 c0             	test   %rax,%rax
+  80201b:	74 47                	je     802064 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  80201d:	44 89 e6             	mov    %r12d,%esi
+  802020:	4c 89 ef             	mov    %r13,%rdi
+  802023:	ff d0                	call   *%rax
+}
+  802025:	48 83 c4 18          	add    $0x18,%rsp
+  802029:	5b                   	pop    %rbx
+  80202a:	41 5c                	pop    %r12
+  80202c:	41 5d                	pop    %r13
+  80202e:	5d                   	pop    %rbp
+  80202f:	c3                   	ret
+                thisenv->env_id, fdnum);
+  802030:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802037:	00 00 00 
+  80203a:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  802040:	89 da                	mov    %ebx,%edx
+  802042:	48 bf 10 37 80 00 00 	movabs $0x803710,%rdi
+  802049:	00 00 00 
+  80204c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802051:	48 b9 b0 05 80 00 00 	movabs $0x8005b0,%rcx
+  802058:	00 00 00 
+  80205b:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  80205d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802062:	eb c1                	jmp    802025 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  802064:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802069:	eb ba                	jmp    802025 <ftruncate+0x5e>
+
+000000000080206b <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  80206b:	55                   	push   %rbp
+  80206c:	48 89 e5             	mov    %rsp,%rbp
+  80206f:	41 54                	push   %r12
+  802071:	53                   	push   %rbx
+  802072:	48 83 ec 10          	sub    $0x10,%rsp
+  802076:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802079:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80207d:	48 b8 cb 1a 80 00 00 	movabs $0x801acb,%rax
+  802084:	00 00 00 
+  802087:	ff d0                	call   *%rax
+  802089:	85 c0                	test   %eax,%eax
+  80208b:	78 4e                	js     8020db <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80208d:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  802091:	41 8b 3c 24          	mov    (%r12),%edi
+  802095:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  802099:	48 b8 16 1b 80 00 00 	movabs $0x801b16,%rax
+  8020a0:	00 00 00 
+  8020a3:	ff d0                	call   *%rax
+  8020a5:	85 c0                	test   %eax,%eax
+  8020a7:	78 32                	js     8020db <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  8020a9:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8020ad:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  8020b2:	74 30                	je     8020e4 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  8020b4:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  8020b7:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  8020be:	00 00 00 
+    stat->st_isdir = 0;
+  8020c1:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8020c8:	00 00 00 
+    stat->st_dev = dev;
+  8020cb:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  8020d2:	48 89 de             	mov    %rbx,%rsi
+  8020d5:	4c 89 e7             	mov    %r12,%rdi
+  8020d8:	ff 50 28             	call   *0x28(%rax)
+}
+  8020db:	48 83 c4 10          	add    $0x10,%rsp
+  8020df:	5b                   	pop    %rbx
+  8020e0:	41 5c                	pop    %r12
+  8020e2:	5d                   	pop    %rbp
+  8020e3:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  8020e4:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8020e9:	eb f0                	jmp    8020db <fstat+0x70>
+
+00000000008020eb <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  8020eb:	55                   	push   %rbp
+  8020ec:	48 89 e5             	mov    %rsp,%rbp
+  8020ef:	41 54                	push   %r12
+  8020f1:	53                   	push   %rbx
+  8020f2:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  8020f5:	be 00 00 00 00       	mov    $0x0,%esi
+  8020fa:	48 b8 ce 24 80 00 00 	movabs $0x8024ce,%rax
+  802101:	00 00 00 
+  802104:	ff d0                	call   *%rax
+  802106:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  802108:	85 c0                	test   %eax,%eax
+  80210a:	78 25                	js     802131 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  80210c:	4c 89 e6             	mov    %r12,%rsi
+  80210f:	89 c7                	mov    %eax,%edi
+  802111:	48 b8 6b 20 80 00 00 	movabs $0x80206b,%rax
+  802118:	00 00 00 
+  80211b:	ff d0                	call   *%rax
+  80211d:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  802120:	89 df                	mov    %ebx,%edi
+  802122:	48 b8 30 1c 80 00 00 	movabs $0x801c30,%rax
+  802129:	00 00 00 
+  80212c:	ff d0                	call   *%rax
+
+    return res;
+  80212e:	44 89 e3             	mov    %r12d,%ebx
+}
+  802131:	89 d8                	mov    %ebx,%eax
+  802133:	5b                   	pop    %rbx
+  802134:	41 5c                	pop    %r12
+  802136:	5d                   	pop    %rbp
+  802137:	c3                   	ret
+
+0000000000802138 <fsipc>:
+ * response may be written back to fsipcbuf.
+ * type: request code, passed as the simple integer IPC value.
+ * dstva: virtual address at which to receive reply page, 0 if none.
+ * Returns result from the file server. */
+static int
+fsipc(unsigned type, void *dstva) {
+  802138:	55                   	push   %rbp
+  802139:	48 89 e5             	mov    %rsp,%rbp
+  80213c:	41 54                	push   %r12
+  80213e:	53                   	push   %rbx
+  80213f:	48 83 ec 10          	sub    $0x10,%rsp
+  802143:	41 89 fc             	mov    %edi,%r12d
+  802146:	48 89 f3             	mov    %rsi,%rbx
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802149:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  802150:	00 00 00 
+  802153:	83 38 00             	cmpl   $0x0,(%rax)
+  802156:	74 5e                	je     8021b6 <fsipc+0x7e>
+    if (debug) {
+        cprintf("[%08x] fsipc %d %08x\n",
+                thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+    }
+
+    ipc_send(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW);
+  802158:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  80215e:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802163:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  80216a:	00 00 00 
+  80216d:	44 89 e6             	mov    %r12d,%esi
+  802170:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  802177:	00 00 00 
+  80217a:	8b 38                	mov    (%rax),%edi
+  80217c:	48 b8 ae 2f 80 00 00 	movabs $0x802fae,%rax
+  802183:	00 00 00 
+  802186:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  802188:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  80218f:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  802190:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802195:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  802199:	48 89 de             	mov    %rbx,%rsi
+  80219c:	bf 00 00 00 00       	mov    $0x0,%edi
+  8021a1:	48 b8 d9 2e 80 00 00 	movabs $0x802ed9,%rax
+  8021a8:	00 00 00 
+  8021ab:	ff d0                	call   *%rax
+}
+  8021ad:	48 83 c4 10          	add    $0x10,%rsp
+  8021b1:	5b                   	pop    %rbx
+  8021b2:	41 5c                	pop    %r12
+  8021b4:	5d                   	pop    %rbp
+  8021b5:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8021b6:	bf 03 00 00 00       	mov    $0x3,%edi
+  8021bb:	48 b8 51 30 80 00 00 	movabs $0x803051,%rax
+  8021c2:	00 00 00 
+  8021c5:	ff d0                	call   *%rax
+  8021c7:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  8021ce:	00 00 
+  8021d0:	eb 86                	jmp    802158 <fsipc+0x20>
+
+00000000008021d2 <devfile_trunc>:
+    return 0;
+}
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  8021d2:	55                   	push   %rbp
+  8021d3:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  8021d6:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  8021dd:	00 00 00 
+  8021e0:	8b 57 0c             	mov    0xc(%rdi),%edx
+  8021e3:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  8021e5:	89 70 04             	mov    %esi,0x4(%rax)
+
+    return fsipc(FSREQ_SET_SIZE, NULL);
+  8021e8:	be 00 00 00 00       	mov    $0x0,%esi
+  8021ed:	bf 02 00 00 00       	mov    $0x2,%edi
+  8021f2:	48 b8 38 21 80 00 00 	movabs $0x802138,%rax
+  8021f9:	00 00 00 
+  8021fc:	ff d0                	call   *%rax
+}
+  8021fe:	5d                   	pop    %rbp
+  8021ff:	c3                   	ret
+
+0000000000802200 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  802200:	55                   	push   %rbp
+  802201:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  802204:	8b 47 0c             	mov    0xc(%rdi),%eax
+  802207:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  80220e:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  802210:	be 00 00 00 00       	mov    $0x0,%esi
+  802215:	bf 06 00 00 00       	mov    $0x6,%edi
+  80221a:	48 b8 38 21 80 00 00 	movabs $0x802138,%rax
+  802221:	00 00 00 
+  802224:	ff d0                	call   *%rax
+}
+  802226:	5d                   	pop    %rbp
+  802227:	c3                   	ret
+
+0000000000802228 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  802228:	55                   	push   %rbp
+  802229:	48 89 e5             	mov    %rsp,%rbp
+  80222c:	41 54                	push   %r12
+  80222e:	53                   	push   %rbx
+  80222f:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802232:	8b 47 0c             	mov    0xc(%rdi),%eax
+  802235:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  80223c:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  80223e:	be 00 00 00 00       	mov    $0x0,%esi
+  802243:	bf 05 00 00 00       	mov    $0x5,%edi
+  802248:	48 b8 38 21 80 00 00 	movabs $0x802138,%rax
+  80224f:	00 00 00 
+  802252:	ff d0                	call   *%rax
+    if (res < 0) {
+  802254:	85 c0                	test   %eax,%eax
+  802256:	78 3d                	js     802295 <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802258:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  80225f:	00 00 00 
+  802262:	4c 89 e6             	mov    %r12,%rsi
+  802265:	48 89 df             	mov    %rbx,%rdi
+  802268:	48 b8 d5 0e 80 00 00 	movabs $0x800ed5,%rax
+  80226f:	00 00 00 
+  802272:	ff d0                	call   *%rax
+    st->st_size  = fsipcbuf.statRet.ret_size;
+  802274:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  80227b:	00 
+  80227c:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802282:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  802289:	00 
+  80228a:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  802290:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802295:	5b                   	pop    %rbx
+  802296:	41 5c                	pop    %r12
+  802298:	5d                   	pop    %rbp
+  802299:	c3                   	ret
+
+000000000080229a <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  80229a:	55                   	push   %rbp
+  80229b:	48 89 e5             	mov    %rsp,%rbp
+  80229e:	41 57                	push   %r15
+  8022a0:	41 56                	push   %r14
+  8022a2:	41 55                	push   %r13
+  8022a4:	41 54                	push   %r12
+  8022a6:	53                   	push   %rbx
+  8022a7:	48 83 ec 18          	sub    $0x18,%rsp
+  8022ab:	49 89 fe             	mov    %rdi,%r14
+  8022ae:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+  8022b2:	48 89 d3             	mov    %rdx,%rbx
+    while (n > sizeof(fsipcbuf.write.req_buf))
+  8022b5:	48 81 fa f0 0f 00 00 	cmp    $0xff0,%rdx
+  8022bc:	0f 86 e4 00 00 00    	jbe    8023a6 <devfile_write+0x10c>
+  8022c2:	49 89 f4             	mov    %rsi,%r12
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8022c5:	49 bd 00 60 80 00 00 	movabs $0x806000,%r13
+  8022cc:	00 00 00 
+        memcpy(fsipcbuf.write.req_buf, buf, sizeof(fsipcbuf.write.req_buf));
+  8022cf:	49 bf 36 11 80 00 00 	movabs $0x801136,%r15
+  8022d6:	00 00 00 
+  8022d9:	eb 03                	jmp    8022de <devfile_write+0x44>
+        buf += sizeof(fsipcbuf.write.req_buf);
+  8022db:	49 89 f4             	mov    %rsi,%r12
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8022de:	41 8b 46 0c          	mov    0xc(%r14),%eax
+  8022e2:	41 89 45 00          	mov    %eax,0x0(%r13)
+        fsipcbuf.write.req_n      = sizeof(fsipcbuf.write.req_buf);
+  8022e6:	49 c7 45 08 f0 0f 00 	movq   $0xff0,0x8(%r13)
+  8022ed:	00 
+        memcpy(fsipcbuf.write.req_buf, buf, sizeof(fsipcbuf.write.req_buf));
+  8022ee:	ba f0 0f 00 00       	mov    $0xff0,%edx
+  8022f3:	4c 89 e6             	mov    %r12,%rsi
+  8022f6:	48 bf 10 60 80 00 00 	movabs $0x806010,%rdi
+  8022fd:	00 00 00 
+  802300:	41 ff d7             	call   *%r15
+        ssize_t res = fsipc(FSREQ_WRITE, NULL);
+  802303:	be 00 00 00 00       	mov    $0x0,%esi
+  802308:	bf 04 00 00 00       	mov    $0x4,%edi
+  80230d:	48 b8 38 21 80 00 00 	movabs $0x802138,%rax
+  802314:	00 00 00 
+  802317:	ff d0                	call   *%rax
+  802319:	48 63 d0             	movslq %eax,%rdx
+        if (res < 0 || res < sizeof(fsipcbuf.write.req_buf))
+  80231c:	3d ef 0f 00 00       	cmp    $0xfef,%eax
+  802321:	7e 71                	jle    802394 <devfile_write+0xfa>
+        buf += sizeof(fsipcbuf.write.req_buf);
+  802323:	49 8d b4 24 f0 0f 00 	lea    0xff0(%r12),%rsi
+  80232a:	00 
+        n -= sizeof(fsipcbuf.write.req_buf);
+  80232b:	48 81 eb f0 0f 00 00 	sub    $0xff0,%rbx
+    while (n > sizeof(fsipcbuf.write.req_buf))
+  802332:	48 81 fb f0 0f 00 00 	cmp    $0xff0,%rbx
+  802339:	77 a0                	ja     8022db <devfile_write+0x41>
+        written += sizeof(fsipcbuf.write.req_buf);
+  80233b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80233f:	49 29 c4             	sub    %rax,%r12
+  802342:	4d 8d a4 24 f0 0f 00 	lea    0xff0(%r12),%r12
+  802349:	00 
+    fsipcbuf.write.req_fileid = fd->fd_file.id;
+  80234a:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  802351:	00 00 00 
+  802354:	41 8b 56 0c          	mov    0xc(%r14),%edx
+  802358:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.write.req_n      = n;
+  80235a:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    memcpy(fsipcbuf.write.req_buf, buf, n);
+  80235e:	48 89 da             	mov    %rbx,%rdx
+  802361:	48 8d 78 10          	lea    0x10(%rax),%rdi
+  802365:	48 b8 36 11 80 00 00 	movabs $0x801136,%rax
+  80236c:	00 00 00 
+  80236f:	ff d0                	call   *%rax
+    ssize_t res = fsipc(FSREQ_WRITE, NULL);
+  802371:	be 00 00 00 00       	mov    $0x0,%esi
+  802376:	bf 04 00 00 00       	mov    $0x4,%edi
+  80237b:	48 b8 38 21 80 00 00 	movabs $0x802138,%rax
+  802382:	00 00 00 
+  802385:	ff d0                	call   *%rax
+  802387:	48 63 d0             	movslq %eax,%rdx
+    written += res;
+  80238a:	49 01 d4             	add    %rdx,%r12
+  80238d:	48 85 d2             	test   %rdx,%rdx
+  802390:	49 0f 49 d4          	cmovns %r12,%rdx
+}
+  802394:	48 89 d0             	mov    %rdx,%rax
+  802397:	48 83 c4 18          	add    $0x18,%rsp
+  80239b:	5b                   	pop    %rbx
+  80239c:	41 5c                	pop    %r12
+  80239e:	41 5d                	pop    %r13
+  8023a0:	41 5e                	pop    %r14
+  8023a2:	41 5f                	pop    %r15
+  8023a4:	5d                   	pop    %rbp
+  8023a5:	c3                   	ret
+    while (n > sizeof(fsipcbuf.write.req_buf))
+  8023a6:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+    ssize_t written = 0;
+  8023aa:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8023b0:	eb 98                	jmp    80234a <devfile_write+0xb0>
+
+00000000008023b2 <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  8023b2:	55                   	push   %rbp
+  8023b3:	48 89 e5             	mov    %rsp,%rbp
+  8023b6:	41 57                	push   %r15
+  8023b8:	41 56                	push   %r14
+  8023ba:	41 55                	push   %r13
+  8023bc:	41 54                	push   %r12
+  8023be:	53                   	push   %rbx
+  8023bf:	48 83 ec 18          	sub    $0x18,%rsp
+  8023c3:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  8023c7:	49 89 f6             	mov    %rsi,%r14
+  8023ca:	49 89 d4             	mov    %rdx,%r12
+    while (n > sizeof(fsipcbuf.readRet.ret_buf))
+  8023cd:	48 81 fa 00 10 00 00 	cmp    $0x1000,%rdx
+  8023d4:	0f 86 ea 00 00 00    	jbe    8024c4 <devfile_read+0x112>
+    ssize_t readsz = 0;
+  8023da:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  8023e1:	00 
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8023e2:	49 bf 00 60 80 00 00 	movabs $0x806000,%r15
+  8023e9:	00 00 00 
+  8023ec:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8023f0:	8b 40 0c             	mov    0xc(%rax),%eax
+  8023f3:	41 89 07             	mov    %eax,(%r15)
+        fsipcbuf.read.req_n = sizeof(fsipcbuf.readRet.ret_buf);
+  8023f6:	49 c7 47 08 00 10 00 	movq   $0x1000,0x8(%r15)
+  8023fd:	00 
+        ssize_t res = fsipc(FSREQ_READ, NULL);
+  8023fe:	be 00 00 00 00       	mov    $0x0,%esi
+  802403:	bf 03 00 00 00       	mov    $0x3,%edi
+  802408:	48 b8 38 21 80 00 00 	movabs $0x802138,%rax
+  80240f:	00 00 00 
+  802412:	ff d0                	call   *%rax
+  802414:	4c 63 e8             	movslq %eax,%r13
+        if (res < 0)
+  802417:	4d 85 ed             	test   %r13,%r13
+  80241a:	0f 88 92 00 00 00    	js     8024b2 <devfile_read+0x100>
+        memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  802420:	4c 89 ea             	mov    %r13,%rdx
+  802423:	4c 89 fe             	mov    %r15,%rsi
+  802426:	4c 89 f7             	mov    %r14,%rdi
+  802429:	48 b8 36 11 80 00 00 	movabs $0x801136,%rax
+  802430:	00 00 00 
+  802433:	ff d0                	call   *%rax
+        if (res < sizeof(fsipcbuf.readRet.ret_buf))
+  802435:	49 81 fd ff 0f 00 00 	cmp    $0xfff,%r13
+  80243c:	76 6d                	jbe    8024ab <devfile_read+0xf9>
+        readsz += res;
+  80243e:	4c 01 6d c0          	add    %r13,-0x40(%rbp)
+        buf += res;
+  802442:	4d 01 ee             	add    %r13,%r14
+        n -= res;
+  802445:	4d 29 ec             	sub    %r13,%r12
+    while (n > sizeof(fsipcbuf.readRet.ret_buf))
+  802448:	49 81 fc 00 10 00 00 	cmp    $0x1000,%r12
+  80244f:	77 9b                	ja     8023ec <devfile_read+0x3a>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802451:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  802458:	00 00 00 
+  80245b:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  80245f:	8b 51 0c             	mov    0xc(%rcx),%edx
+  802462:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.read.req_n = n;
+  802464:	4c 89 60 08          	mov    %r12,0x8(%rax)
+    ssize_t res = fsipc(FSREQ_READ, NULL);
+  802468:	be 00 00 00 00       	mov    $0x0,%esi
+  80246d:	bf 03 00 00 00       	mov    $0x3,%edi
+  802472:	48 b8 38 21 80 00 00 	movabs $0x802138,%rax
+  802479:	00 00 00 
+  80247c:	ff d0                	call   *%rax
+  80247e:	4c 63 e8             	movslq %eax,%r13
+    if (res < 0)
+  802481:	4d 85 ed             	test   %r13,%r13
+  802484:	78 2c                	js     8024b2 <devfile_read+0x100>
+    memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  802486:	4c 89 ea             	mov    %r13,%rdx
+  802489:	48 be 00 60 80 00 00 	movabs $0x806000,%rsi
+  802490:	00 00 00 
+  802493:	4c 89 f7             	mov    %r14,%rdi
+  802496:	48 b8 36 11 80 00 00 	movabs $0x801136,%rax
+  80249d:	00 00 00 
+  8024a0:	ff d0                	call   *%rax
+    readsz += res;
+  8024a2:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8024a6:	49 01 c5             	add    %rax,%r13
+    return readsz;
+  8024a9:	eb 07                	jmp    8024b2 <devfile_read+0x100>
+            return readsz + res;
+  8024ab:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8024af:	49 01 c5             	add    %rax,%r13
+}
+  8024b2:	4c 89 e8             	mov    %r13,%rax
+  8024b5:	48 83 c4 18          	add    $0x18,%rsp
+  8024b9:	5b                   	pop    %rbx
+  8024ba:	41 5c                	pop    %r12
+  8024bc:	41 5d                	pop    %r13
+  8024be:	41 5e                	pop    %r14
+  8024c0:	41 5f                	pop    %r15
+  8024c2:	5d                   	pop    %rbp
+  8024c3:	c3                   	ret
+    ssize_t readsz = 0;
+  8024c4:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  8024cb:	00 
+  8024cc:	eb 83                	jmp    802451 <devfile_read+0x9f>
+
+00000000008024ce <open>:
+open(const char *path, int mode) {
+  8024ce:	55                   	push   %rbp
+  8024cf:	48 89 e5             	mov    %rsp,%rbp
+  8024d2:	41 55                	push   %r13
+  8024d4:	41 54                	push   %r12
+  8024d6:	53                   	push   %rbx
+  8024d7:	48 83 ec 18          	sub    $0x18,%rsp
+  8024db:	49 89 fc             	mov    %rdi,%r12
+  8024de:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  8024e1:	48 b8 97 0e 80 00 00 	movabs $0x800e97,%rax
+  8024e8:	00 00 00 
+  8024eb:	ff d0                	call   *%rax
+  8024ed:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  8024f3:	0f 87 8a 00 00 00    	ja     802583 <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8024f9:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  8024fd:	48 b8 b1 1a 80 00 00 	movabs $0x801ab1,%rax
+  802504:	00 00 00 
+  802507:	ff d0                	call   *%rax
+  802509:	89 c3                	mov    %eax,%ebx
+  80250b:	85 c0                	test   %eax,%eax
+  80250d:	78 50                	js     80255f <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  80250f:	4c 89 e6             	mov    %r12,%rsi
+  802512:	48 bb 00 60 80 00 00 	movabs $0x806000,%rbx
+  802519:	00 00 00 
+  80251c:	48 89 df             	mov    %rbx,%rdi
+  80251f:	48 b8 d5 0e 80 00 00 	movabs $0x800ed5,%rax
+  802526:	00 00 00 
+  802529:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  80252b:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  802532:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802536:	bf 01 00 00 00       	mov    $0x1,%edi
+  80253b:	48 b8 38 21 80 00 00 	movabs $0x802138,%rax
+  802542:	00 00 00 
+  802545:	ff d0                	call   *%rax
+  802547:	89 c3                	mov    %eax,%ebx
+  802549:	85 c0                	test   %eax,%eax
+  80254b:	78 1f                	js     80256c <open+0x9e>
+    return fd2num(fd);
+  80254d:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802551:	48 b8 0a 1a 80 00 00 	movabs $0x801a0a,%rax
+  802558:	00 00 00 
+  80255b:	ff d0                	call   *%rax
+  80255d:	89 c3                	mov    %eax,%ebx
+}
+  80255f:	89 d8                	mov    %ebx,%eax
+  802561:	48 83 c4 18          	add    $0x18,%rsp
+  802565:	5b                   	pop    %rbx
+  802566:	41 5c                	pop    %r12
+  802568:	41 5d                	pop    %r13
+  80256a:	5d                   	pop    %rbp
+  80256b:	c3                   	ret
+        fd_close(fd, 0);
+  80256c:	be 00 00 00 00       	mov    $0x0,%esi
+  802571:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802575:	48 b8 86 1b 80 00 00 	movabs $0x801b86,%rax
+  80257c:	00 00 00 
+  80257f:	ff d0                	call   *%rax
+        return res;
+  802581:	eb dc                	jmp    80255f <open+0x91>
+        return -E_BAD_PATH;
+  802583:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  802588:	eb d5                	jmp    80255f <open+0x91>
+
+000000000080258a <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  80258a:	55                   	push   %rbp
+  80258b:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc(FSREQ_SYNC, NULL);
+  80258e:	be 00 00 00 00       	mov    $0x0,%esi
+  802593:	bf 08 00 00 00       	mov    $0x8,%edi
+  802598:	48 b8 38 21 80 00 00 	movabs $0x802138,%rax
+  80259f:	00 00 00 
+  8025a2:	ff d0                	call   *%rax
+}
+  8025a4:	5d                   	pop    %rbp
+  8025a5:	c3                   	ret
+
+00000000008025a6 <writebuf>:
+    char buf[PRINTBUFSZ];
+};
+
+static void
+writebuf(struct printbuf *state) {
+    if (state->error > 0) {
+  8025a6:	83 7f 10 00          	cmpl   $0x0,0x10(%rdi)
+  8025aa:	7f 01                	jg     8025ad <writebuf+0x7>
+  8025ac:	c3                   	ret
+writebuf(struct printbuf *state) {
+  8025ad:	55                   	push   %rbp
+  8025ae:	48 89 e5             	mov    %rsp,%rbp
+  8025b1:	53                   	push   %rbx
+  8025b2:	48 83 ec 08          	sub    $0x8,%rsp
+  8025b6:	48 89 fb             	mov    %rdi,%rbx
+        ssize_t result = write(state->fd, state->buf, state->offset);
+  8025b9:	48 63 57 04          	movslq 0x4(%rdi),%rdx
+  8025bd:	48 8d 77 14          	lea    0x14(%rdi),%rsi
+  8025c1:	8b 3f                	mov    (%rdi),%edi
+  8025c3:	48 b8 dd 1e 80 00 00 	movabs $0x801edd,%rax
+  8025ca:	00 00 00 
+  8025cd:	ff d0                	call   *%rax
+        if (result > 0) state->result += result;
+  8025cf:	48 85 c0             	test   %rax,%rax
+  8025d2:	7e 04                	jle    8025d8 <writebuf+0x32>
+  8025d4:	48 01 43 08          	add    %rax,0x8(%rbx)
+
+        /* Error, or wrote less than supplied */
+        if (result != state->offset)
+  8025d8:	48 63 53 04          	movslq 0x4(%rbx),%rdx
+  8025dc:	48 39 c2             	cmp    %rax,%rdx
+  8025df:	74 0f                	je     8025f0 <writebuf+0x4a>
+            state->error = MIN(0, result);
+  8025e1:	48 85 c0             	test   %rax,%rax
+  8025e4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8025e9:	48 0f 4f c2          	cmovg  %rdx,%rax
+  8025ed:	89 43 10             	mov    %eax,0x10(%rbx)
+    }
+}
+  8025f0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8025f4:	c9                   	leave
+  8025f5:	c3                   	ret
+
+00000000008025f6 <putch>:
+
+static void
+putch(int ch, void *arg) {
+    struct printbuf *state = (struct printbuf *)arg;
+    state->buf[state->offset++] = ch;
+  8025f6:	8b 46 04             	mov    0x4(%rsi),%eax
+  8025f9:	8d 50 01             	lea    0x1(%rax),%edx
+  8025fc:	89 56 04             	mov    %edx,0x4(%rsi)
+  8025ff:	48 98                	cltq
+  802601:	40 88 7c 06 14       	mov    %dil,0x14(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ) {
+  802606:	81 fa 00 01 00 00    	cmp    $0x100,%edx
+  80260c:	74 01                	je     80260f <putch+0x19>
+  80260e:	c3                   	ret
+putch(int ch, void *arg) {
+  80260f:	55                   	push   %rbp
+  802610:	48 89 e5             	mov    %rsp,%rbp
+  802613:	53                   	push   %rbx
+  802614:	48 83 ec 08          	sub    $0x8,%rsp
+  802618:	48 89 f3             	mov    %rsi,%rbx
+        writebuf(state);
+  80261b:	48 89 f7             	mov    %rsi,%rdi
+  80261e:	48 b8 a6 25 80 00 00 	movabs $0x8025a6,%rax
+  802625:	00 00 00 
+  802628:	ff d0                	call   *%rax
+        state->offset = 0;
+  80262a:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%rbx)
+    }
+}
+  802631:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802635:	c9                   	leave
+  802636:	c3                   	ret
+
+0000000000802637 <vfprintf>:
+
+int
+vfprintf(int fd, const char *fmt, va_list ap) {
+  802637:	55                   	push   %rbp
+  802638:	48 89 e5             	mov    %rsp,%rbp
+  80263b:	48 81 ec 20 01 00 00 	sub    $0x120,%rsp
+  802642:	48 89 d1             	mov    %rdx,%rcx
+    struct printbuf state;
+    state.fd = fd;
+  802645:	89 bd e8 fe ff ff    	mov    %edi,-0x118(%rbp)
+    state.offset = 0;
+  80264b:	c7 85 ec fe ff ff 00 	movl   $0x0,-0x114(%rbp)
+  802652:	00 00 00 
+    state.result = 0;
+  802655:	48 c7 85 f0 fe ff ff 	movq   $0x0,-0x110(%rbp)
+  80265c:	00 00 00 00 
+    state.error = 1;
+  802660:	c7 85 f8 fe ff ff 01 	movl   $0x1,-0x108(%rbp)
+  802667:	00 00 00 
+
+    vprintfmt(putch, &state, fmt, ap);
+  80266a:	48 89 f2             	mov    %rsi,%rdx
+  80266d:	48 8d b5 e8 fe ff ff 	lea    -0x118(%rbp),%rsi
+  802674:	48 bf f6 25 80 00 00 	movabs $0x8025f6,%rdi
+  80267b:	00 00 00 
+  80267e:	48 b8 00 07 80 00 00 	movabs $0x800700,%rax
+  802685:	00 00 00 
+  802688:	ff d0                	call   *%rax
+    if (state.offset > 0) writebuf(&state);
+  80268a:	83 bd ec fe ff ff 00 	cmpl   $0x0,-0x114(%rbp)
+  802691:	7f 14                	jg     8026a7 <vfprintf+0x70>
+
+    return (state.result ? state.result : state.error);
+  802693:	48 8b 85 f0 fe ff ff 	mov    -0x110(%rbp),%rax
+  80269a:	48 85 c0             	test   %rax,%rax
+  80269d:	75 06                	jne    8026a5 <vfprintf+0x6e>
+  80269f:	8b 85 f8 fe ff ff    	mov    -0x108(%rbp),%eax
+}
+  8026a5:	c9                   	leave
+  8026a6:	c3                   	ret
+    if (state.offset > 0) writebuf(&state);
+  8026a7:	48 8d bd e8 fe ff ff 	lea    -0x118(%rbp),%rdi
+  8026ae:	48 b8 a6 25 80 00 00 	movabs $0x8025a6,%rax
+  8026b5:	00 00 00 
+  8026b8:	ff d0                	call   *%rax
+  8026ba:	eb d7                	jmp    802693 <vfprintf+0x5c>
+
+00000000008026bc <fprintf>:
+
+int
+fprintf(int fd, const char *fmt, ...) {
+  8026bc:	55                   	push   %rbp
+  8026bd:	48 89 e5             	mov    %rsp,%rbp
+  8026c0:	48 83 ec 50          	sub    $0x50,%rsp
+  8026c4:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8026c8:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8026cc:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8026d0:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  8026d4:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  8026db:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8026df:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8026e3:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8026e7:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(fd, fmt, ap);
+  8026eb:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  8026ef:	48 b8 37 26 80 00 00 	movabs $0x802637,%rax
+  8026f6:	00 00 00 
+  8026f9:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  8026fb:	c9                   	leave
+  8026fc:	c3                   	ret
+
+00000000008026fd <printf>:
+
+int
+printf(const char *fmt, ...) {
+  8026fd:	55                   	push   %rbp
+  8026fe:	48 89 e5             	mov    %rsp,%rbp
+  802701:	48 83 ec 50          	sub    $0x50,%rsp
+  802705:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  802709:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  80270d:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  802711:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  802715:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  802719:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  802720:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802724:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802728:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80272c:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(1, fmt, ap);
+  802730:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  802734:	48 89 fe             	mov    %rdi,%rsi
+  802737:	bf 01 00 00 00       	mov    $0x1,%edi
+  80273c:	48 b8 37 26 80 00 00 	movabs $0x802637,%rax
+  802743:	00 00 00 
+  802746:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  802748:	c9                   	leave
+  802749:	c3                   	ret
+
+000000000080274a <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  80274a:	55                   	push   %rbp
+  80274b:	48 89 e5             	mov    %rsp,%rbp
+  80274e:	41 54                	push   %r12
+  802750:	53                   	push   %rbx
+  802751:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802754:	48 b8 1c 1a 80 00 00 	movabs $0x801a1c,%rax
+  80275b:	00 00 00 
+  80275e:	ff d0                	call   *%rax
+  802760:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  802763:	48 be a0 37 80 00 00 	movabs $0x8037a0,%rsi
+  80276a:	00 00 00 
+  80276d:	48 89 df             	mov    %rbx,%rdi
+  802770:	48 b8 d5 0e 80 00 00 	movabs $0x800ed5,%rax
+  802777:	00 00 00 
+  80277a:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  80277c:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  802781:	41 2b 04 24          	sub    (%r12),%eax
+  802785:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  80278b:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  802792:	00 00 00 
+    stat->st_dev = &devpipe;
+  802795:	48 b8 80 40 80 00 00 	movabs $0x804080,%rax
+  80279c:	00 00 00 
+  80279f:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  8027a6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027ab:	5b                   	pop    %rbx
+  8027ac:	41 5c                	pop    %r12
+  8027ae:	5d                   	pop    %rbp
+  8027af:	c3                   	ret
+
+00000000008027b0 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  8027b0:	55                   	push   %rbp
+  8027b1:	48 89 e5             	mov    %rsp,%rbp
+  8027b4:	41 54                	push   %r12
+  8027b6:	53                   	push   %rbx
+  8027b7:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8027ba:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8027bf:	48 89 fe             	mov    %rdi,%rsi
+  8027c2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8027c7:	49 bc 9b 16 80 00 00 	movabs $0x80169b,%r12
+  8027ce:	00 00 00 
+  8027d1:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  8027d4:	48 89 df             	mov    %rbx,%rdi
+  8027d7:	48 b8 1c 1a 80 00 00 	movabs $0x801a1c,%rax
+  8027de:	00 00 00 
+  8027e1:	ff d0                	call   *%rax
+  8027e3:	48 89 c6             	mov    %rax,%rsi
+  8027e6:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8027eb:	bf 00 00 00 00       	mov    $0x0,%edi
+  8027f0:	41 ff d4             	call   *%r12
+}
+  8027f3:	5b                   	pop    %rbx
+  8027f4:	41 5c                	pop    %r12
+  8027f6:	5d                   	pop    %rbp
+  8027f7:	c3                   	ret
+
+00000000008027f8 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8027f8:	55                   	push   %rbp
+  8027f9:	48 89 e5             	mov    %rsp,%rbp
+  8027fc:	41 57                	push   %r15
+  8027fe:	41 56                	push   %r14
+  802800:	41 55                	push   %r13
+  802802:	41 54                	push   %r12
+  802804:	53                   	push   %rbx
+  802805:	48 83 ec 18          	sub    $0x18,%rsp
+  802809:	49 89 fc             	mov    %rdi,%r12
+  80280c:	49 89 f5             	mov    %rsi,%r13
+  80280f:	49 89 d7             	mov    %rdx,%r15
+  802812:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802816:	48 b8 1c 1a 80 00 00 	movabs $0x801a1c,%rax
+  80281d:	00 00 00 
+  802820:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  802822:	4d 85 ff             	test   %r15,%r15
+  802825:	0f 84 af 00 00 00    	je     8028da <devpipe_write+0xe2>
+  80282b:	48 89 c3             	mov    %rax,%rbx
+  80282e:	4c 89 f8             	mov    %r15,%rax
+  802831:	4d 89 ef             	mov    %r13,%r15
+  802834:	4c 01 e8             	add    %r13,%rax
+  802837:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80283b:	49 bd a3 15 80 00 00 	movabs $0x8015a3,%r13
+  802842:	00 00 00 
+            sys_yield();
+  802845:	49 be 40 15 80 00 00 	movabs $0x801540,%r14
+  80284c:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  80284f:	8b 73 04             	mov    0x4(%rbx),%esi
+  802852:	48 63 ce             	movslq %esi,%rcx
+  802855:	48 63 03             	movslq (%rbx),%rax
+  802858:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  80285e:	48 39 c1             	cmp    %rax,%rcx
+  802861:	72 2e                	jb     802891 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802863:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802868:	48 89 da             	mov    %rbx,%rdx
+  80286b:	be 00 10 00 00       	mov    $0x1000,%esi
+  802870:	4c 89 e7             	mov    %r12,%rdi
+  802873:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  802876:	85 c0                	test   %eax,%eax
+  802878:	74 66                	je     8028e0 <devpipe_write+0xe8>
+            sys_yield();
+  80287a:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  80287d:	8b 73 04             	mov    0x4(%rbx),%esi
+  802880:	48 63 ce             	movslq %esi,%rcx
+  802883:	48 63 03             	movslq (%rbx),%rax
+  802886:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  80288c:	48 39 c1             	cmp    %rax,%rcx
+  80288f:	73 d2                	jae    802863 <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  802891:	41 0f b6 3f          	movzbl (%r15),%edi
+  802895:	48 89 ca             	mov    %rcx,%rdx
+  802898:	48 c1 ea 03          	shr    $0x3,%rdx
+  80289c:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  8028a3:	08 10 20 
+  8028a6:	48 f7 e2             	mul    %rdx
+  8028a9:	48 c1 ea 06          	shr    $0x6,%rdx
+  8028ad:	48 89 d0             	mov    %rdx,%rax
+  8028b0:	48 c1 e0 09          	shl    $0x9,%rax
+  8028b4:	48 29 d0             	sub    %rdx,%rax
+  8028b7:	48 c1 e0 03          	shl    $0x3,%rax
+  8028bb:	48 29 c1             	sub    %rax,%rcx
+  8028be:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  8028c3:	83 c6 01             	add    $0x1,%esi
+  8028c6:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8028c9:	49 83 c7 01          	add    $0x1,%r15
+  8028cd:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8028d1:	49 39 c7             	cmp    %rax,%r15
+  8028d4:	0f 85 75 ff ff ff    	jne    80284f <devpipe_write+0x57>
+    return n;
+  8028da:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8028de:	eb 05                	jmp    8028e5 <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  8028e0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8028e5:	48 83 c4 18          	add    $0x18,%rsp
+  8028e9:	5b                   	pop    %rbx
+  8028ea:	41 5c                	pop    %r12
+  8028ec:	41 5d                	pop    %r13
+  8028ee:	41 5e                	pop    %r14
+  8028f0:	41 5f                	pop    %r15
+  8028f2:	5d                   	pop    %rbp
+  8028f3:	c3                   	ret
+
+00000000008028f4 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  8028f4:	55                   	push   %rbp
+  8028f5:	48 89 e5             	mov    %rsp,%rbp
+  8028f8:	41 57                	push   %r15
+  8028fa:	41 56                	push   %r14
+  8028fc:	41 55                	push   %r13
+  8028fe:	41 54                	push   %r12
+  802900:	53                   	push   %rbx
+  802901:	48 83 ec 18          	sub    $0x18,%rsp
+  802905:	49 89 fc             	mov    %rdi,%r12
+  802908:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  80290c:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802910:	48 b8 1c 1a 80 00 00 	movabs $0x801a1c,%rax
+  802917:	00 00 00 
+  80291a:	ff d0                	call   *%rax
+  80291c:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  80291f:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802925:	49 bd a3 15 80 00 00 	movabs $0x8015a3,%r13
+  80292c:	00 00 00 
+            sys_yield();
+  80292f:	49 be 40 15 80 00 00 	movabs $0x801540,%r14
+  802936:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  802939:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  80293e:	74 7d                	je     8029bd <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  802940:	8b 03                	mov    (%rbx),%eax
+  802942:	3b 43 04             	cmp    0x4(%rbx),%eax
+  802945:	75 26                	jne    80296d <devpipe_read+0x79>
+            if (i > 0) return i;
+  802947:	4d 85 ff             	test   %r15,%r15
+  80294a:	75 77                	jne    8029c3 <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80294c:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802951:	48 89 da             	mov    %rbx,%rdx
+  802954:	be 00 10 00 00       	mov    $0x1000,%esi
+  802959:	4c 89 e7             	mov    %r12,%rdi
+  80295c:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  80295f:	85 c0                	test   %eax,%eax
+  802961:	74 72                	je     8029d5 <devpipe_read+0xe1>
+            sys_yield();
+  802963:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  802966:	8b 03                	mov    (%rbx),%eax
+  802968:	3b 43 04             	cmp    0x4(%rbx),%eax
+  80296b:	74 df                	je     80294c <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  80296d:	48 63 c8             	movslq %eax,%rcx
+  802970:	48 89 ca             	mov    %rcx,%rdx
+  802973:	48 c1 ea 03          	shr    $0x3,%rdx
+  802977:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  80297e:	08 10 20 
+  802981:	48 89 d0             	mov    %rdx,%rax
+  802984:	48 f7 e6             	mul    %rsi
+  802987:	48 c1 ea 06          	shr    $0x6,%rdx
+  80298b:	48 89 d0             	mov    %rdx,%rax
+  80298e:	48 c1 e0 09          	shl    $0x9,%rax
+  802992:	48 29 d0             	sub    %rdx,%rax
+  802995:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  80299c:	00 
+  80299d:	48 89 c8             	mov    %rcx,%rax
+  8029a0:	48 29 d0             	sub    %rdx,%rax
+  8029a3:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  8029a8:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8029ac:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  8029b0:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8029b3:	49 83 c7 01          	add    $0x1,%r15
+  8029b7:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  8029bb:	75 83                	jne    802940 <devpipe_read+0x4c>
+    return n;
+  8029bd:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8029c1:	eb 03                	jmp    8029c6 <devpipe_read+0xd2>
+            if (i > 0) return i;
+  8029c3:	4c 89 f8             	mov    %r15,%rax
+}
+  8029c6:	48 83 c4 18          	add    $0x18,%rsp
+  8029ca:	5b                   	pop    %rbx
+  8029cb:	41 5c                	pop    %r12
+  8029cd:	41 5d                	pop    %r13
+  8029cf:	41 5e                	pop    %r14
+  8029d1:	41 5f                	pop    %r15
+  8029d3:	5d                   	pop    %rbp
+  8029d4:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  8029d5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029da:	eb ea                	jmp    8029c6 <devpipe_read+0xd2>
+
+00000000008029dc <pipe>:
+pipe(int pfd[2]) {
+  8029dc:	55                   	push   %rbp
+  8029dd:	48 89 e5             	mov    %rsp,%rbp
+  8029e0:	41 55                	push   %r13
+  8029e2:	41 54                	push   %r12
+  8029e4:	53                   	push   %rbx
+  8029e5:	48 81 ec b8 00 00 00 	sub    $0xb8,%rsp
+  8029ec:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8029ef:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  8029f3:	48 b8 b1 1a 80 00 00 	movabs $0x801ab1,%rax
+  8029fa:	00 00 00 
+  8029fd:	ff d0                	call   *%rax
+  8029ff:	89 c3                	mov    %eax,%ebx
+  802a01:	85 c0                	test   %eax,%eax
+  802a03:	0f 88 51 01 00 00    	js     802b5a <pipe+0x17e>
+        (res = fd_alloc_from(fd2num(fd0) + 1, &fd1)) < 0) goto err;
+  802a09:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802a0d:	48 b8 0a 1a 80 00 00 	movabs $0x801a0a,%rax
+  802a14:	00 00 00 
+  802a17:	ff d0                	call   *%rax
+  802a19:	8d 78 01             	lea    0x1(%rax),%edi
+  802a1c:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802a20:	48 b8 38 1a 80 00 00 	movabs $0x801a38,%rax
+  802a27:	00 00 00 
+  802a2a:	ff d0                	call   *%rax
+  802a2c:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  802a2e:	85 c0                	test   %eax,%eax
+  802a30:	0f 88 24 01 00 00    	js     802b5a <pipe+0x17e>
+    va = fd2data(fd0);
+  802a36:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802a3a:	48 bb 1c 1a 80 00 00 	movabs $0x801a1c,%rbx
+  802a41:	00 00 00 
+  802a44:	ff d3                	call   *%rbx
+  802a46:	49 89 c5             	mov    %rax,%r13
+    struct RegionOp ops[] = {
+  802a49:	48 8d bd 30 ff ff ff 	lea    -0xd0(%rbp),%rdi
+  802a50:	b9 14 00 00 00       	mov    $0x14,%ecx
+  802a55:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a5a:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+  802a5d:	c7 85 34 ff ff ff 46 	movl   $0x46,-0xcc(%rbp)
+  802a64:	00 00 00 
+  802a67:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802a6b:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+  802a72:	48 c7 85 50 ff ff ff 	movq   $0x1000,-0xb0(%rbp)
+  802a79:	00 10 00 00 
+  802a7d:	c7 85 5c ff ff ff 46 	movl   $0x46,-0xa4(%rbp)
+  802a84:	00 00 00 
+            {.type = REGION_ALLOC, .dstva = (uintptr_t)fd1, .size = PAGE_SIZE, .perm = PROT_RW | PROT_SHARE},
+  802a87:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+    struct RegionOp ops[] = {
+  802a8b:	48 89 bd 70 ff ff ff 	mov    %rdi,-0x90(%rbp)
+  802a92:	48 c7 85 78 ff ff ff 	movq   $0x1000,-0x88(%rbp)
+  802a99:	00 10 00 00 
+  802a9d:	c7 45 84 46 00 00 00 	movl   $0x46,-0x7c(%rbp)
+  802aa4:	4c 89 6d 98          	mov    %r13,-0x68(%rbp)
+  802aa8:	48 c7 45 a0 00 10 00 	movq   $0x1000,-0x60(%rbp)
+  802aaf:	00 
+  802ab0:	c7 45 a8 01 00 00 00 	movl   $0x1,-0x58(%rbp)
+  802ab7:	c7 45 ac 46 00 00 00 	movl   $0x46,-0x54(%rbp)
+  802abe:	4c 89 6d b8          	mov    %r13,-0x48(%rbp)
+            {.type = REGION_MAP, .srcva = (uintptr_t)va, .dstva = (uintptr_t)fd2data(fd1), .size = PAGE_SIZE, .perm = PROT_RW | PROT_SHARE},
+  802ac2:	ff d3                	call   *%rbx
+    struct RegionOp ops[] = {
+  802ac4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802ac8:	48 c7 45 c8 00 10 00 	movq   $0x1000,-0x38(%rbp)
+  802acf:	00 
+    if ((res = sys_region_batch(ops, sizeof ops / sizeof *ops)) < 0) goto err1;
+  802ad0:	be 04 00 00 00       	mov    $0x4,%esi
+  802ad5:	48 8d bd 30 ff ff ff 	lea    -0xd0(%rbp),%rdi
+  802adc:	48 b8 02 17 80 00 00 	movabs $0x801702,%rax
+  802ae3:	00 00 00 
+  802ae6:	ff d0                	call   *%rax
+  802ae8:	89 c3                	mov    %eax,%ebx
+  802aea:	85 c0                	test   %eax,%eax
+  802aec:	0f 88 ad 00 00 00    	js     802b9f <pipe+0x1c3>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  802af2:	be 00 10 00 00       	mov    $0x1000,%esi
+  802af7:	4c 89 ef             	mov    %r13,%rdi
+  802afa:	48 b8 71 15 80 00 00 	movabs $0x801571,%rax
+  802b01:	00 00 00 
+  802b04:	ff d0                	call   *%rax
+  802b06:	83 f8 02             	cmp    $0x2,%eax
+  802b09:	75 5f                	jne    802b6a <pipe+0x18e>
+    fd0->fd_dev_id = devpipe.dev_id;
+  802b0b:	a1 80 40 80 00 00 00 	movabs 0x804080,%eax
+  802b12:	00 00 
+  802b14:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802b18:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  802b1a:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802b1e:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  802b25:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  802b29:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  802b2b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802b2f:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  802b36:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802b3a:	48 bb 0a 1a 80 00 00 	movabs $0x801a0a,%rbx
+  802b41:	00 00 00 
+  802b44:	ff d3                	call   *%rbx
+  802b46:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  802b4a:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  802b4e:	ff d3                	call   *%rbx
+  802b50:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  802b55:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  802b5a:	89 d8                	mov    %ebx,%eax
+  802b5c:	48 81 c4 b8 00 00 00 	add    $0xb8,%rsp
+  802b63:	5b                   	pop    %rbx
+  802b64:	41 5c                	pop    %r12
+  802b66:	41 5d                	pop    %r13
+  802b68:	5d                   	pop    %rbp
+  802b69:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  802b6a:	48 b9 d0 37 80 00 00 	movabs $0x8037d0,%rcx
+  802b71:	00 00 00 
+  802b74:	48 ba a7 37 80 00 00 	movabs $0x8037a7,%rdx
+  802b7b:	00 00 00 
+  802b7e:	be 33 00 00 00       	mov    $0x33,%esi
+  802b83:	48 bf bc 37 80 00 00 	movabs $0x8037bc,%rdi
+  802b8a:	00 00 00 
+  802b8d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b92:	49 b8 60 04 80 00 00 	movabs $0x800460,%r8
+  802b99:	00 00 00 
+  802b9c:	41 ff d0             	call   *%r8
+        ops[i].type = REGION_UNMAP;
+  802b9f:	c7 85 30 ff ff ff 02 	movl   $0x2,-0xd0(%rbp)
+  802ba6:	00 00 00 
+  802ba9:	c7 85 58 ff ff ff 02 	movl   $0x2,-0xa8(%rbp)
+  802bb0:	00 00 00 
+  802bb3:	c7 45 80 02 00 00 00 	movl   $0x2,-0x80(%rbp)
+  802bba:	c7 45 a8 02 00 00 00 	movl   $0x2,-0x58(%rbp)
+    sys_region_batch(ops, sizeof ops / sizeof *ops);
+  802bc1:	be 04 00 00 00       	mov    $0x4,%esi
+  802bc6:	48 8d bd 30 ff ff ff 	lea    -0xd0(%rbp),%rdi
+  802bcd:	48 b8 02 17 80 00 00 	movabs $0x801702,%rax
+  802bd4:	00 00 00 
+  802bd7:	ff d0                	call   *%rax
+  802bd9:	e9 7c ff ff ff       	jmp    802b5a <pipe+0x17e>
+
+0000000000802bde <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  802bde:	55                   	push   %rbp
+  802bdf:	48 89 e5             	mov    %rsp,%rbp
+  802be2:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  802be6:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802bea:	48 b8 cb 1a 80 00 00 	movabs $0x801acb,%rax
+  802bf1:	00 00 00 
+  802bf4:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802bf6:	85 c0                	test   %eax,%eax
+  802bf8:	78 35                	js     802c2f <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  802bfa:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802bfe:	48 b8 1c 1a 80 00 00 	movabs $0x801a1c,%rax
+  802c05:	00 00 00 
+  802c08:	ff d0                	call   *%rax
+  802c0a:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802c0d:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802c12:	be 00 10 00 00       	mov    $0x1000,%esi
+  802c17:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802c1b:	48 b8 a3 15 80 00 00 	movabs $0x8015a3,%rax
+  802c22:	00 00 00 
+  802c25:	ff d0                	call   *%rax
+  802c27:	85 c0                	test   %eax,%eax
+  802c29:	0f 94 c0             	sete   %al
+  802c2c:	0f b6 c0             	movzbl %al,%eax
+}
+  802c2f:	c9                   	leave
+  802c30:	c3                   	ret
+
+0000000000802c31 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  802c31:	48 89 f8             	mov    %rdi,%rax
+  802c34:	48 c1 e8 27          	shr    $0x27,%rax
+  802c38:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  802c3f:	01 00 00 
+  802c42:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802c46:	f6 c2 01             	test   $0x1,%dl
+  802c49:	74 6d                	je     802cb8 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  802c4b:	48 89 f8             	mov    %rdi,%rax
+  802c4e:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802c52:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802c59:	01 00 00 
+  802c5c:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802c60:	f6 c2 01             	test   $0x1,%dl
+  802c63:	74 62                	je     802cc7 <get_uvpt_entry+0x96>
+  802c65:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802c6c:	01 00 00 
+  802c6f:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802c73:	f6 c2 80             	test   $0x80,%dl
+  802c76:	75 4f                	jne    802cc7 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  802c78:	48 89 f8             	mov    %rdi,%rax
+  802c7b:	48 c1 e8 15          	shr    $0x15,%rax
+  802c7f:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802c86:	01 00 00 
+  802c89:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802c8d:	f6 c2 01             	test   $0x1,%dl
+  802c90:	74 44                	je     802cd6 <get_uvpt_entry+0xa5>
+  802c92:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802c99:	01 00 00 
+  802c9c:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802ca0:	f6 c2 80             	test   $0x80,%dl
+  802ca3:	75 31                	jne    802cd6 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  802ca5:	48 c1 ef 0c          	shr    $0xc,%rdi
+  802ca9:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802cb0:	01 00 00 
+  802cb3:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  802cb7:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  802cb8:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  802cbf:	01 00 00 
+  802cc2:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802cc6:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  802cc7:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802cce:	01 00 00 
+  802cd1:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802cd5:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  802cd6:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802cdd:	01 00 00 
+  802ce0:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802ce4:	c3                   	ret
+
+0000000000802ce5 <get_prot>:
+
+int
+get_prot(void *va) {
+  802ce5:	55                   	push   %rbp
+  802ce6:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  802ce9:	48 b8 31 2c 80 00 00 	movabs $0x802c31,%rax
+  802cf0:	00 00 00 
+  802cf3:	ff d0                	call   *%rax
+  802cf5:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  802cf8:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  802cfd:	89 c1                	mov    %eax,%ecx
+  802cff:	83 c9 04             	or     $0x4,%ecx
+  802d02:	f6 c2 01             	test   $0x1,%dl
+  802d05:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  802d08:	89 c1                	mov    %eax,%ecx
+  802d0a:	83 c9 02             	or     $0x2,%ecx
+  802d0d:	f6 c2 02             	test   $0x2,%dl
+  802d10:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  802d13:	89 c1                	mov    %eax,%ecx
+  802d15:	83 c9 01             	or     $0x1,%ecx
+  802d18:	48 85 d2             	test   %rdx,%rdx
+  802d1b:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  802d1e:	89 c1                	mov    %eax,%ecx
+  802d20:	83 c9 40             	or     $0x40,%ecx
+  802d23:	f6 c6 04             	test   $0x4,%dh
+  802d26:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  802d29:	5d                   	pop    %rbp
+  802d2a:	c3                   	ret
+
+0000000000802d2b <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  802d2b:	55                   	push   %rbp
+  802d2c:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  802d2f:	48 b8 31 2c 80 00 00 	movabs $0x802c31,%rax
+  802d36:	00 00 00 
+  802d39:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  802d3b:	48 c1 e8 06          	shr    $0x6,%rax
+  802d3f:	83 e0 01             	and    $0x1,%eax
+}
+  802d42:	5d                   	pop    %rbp
+  802d43:	c3                   	ret
+
+0000000000802d44 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  802d44:	55                   	push   %rbp
+  802d45:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  802d48:	48 b8 31 2c 80 00 00 	movabs $0x802c31,%rax
+  802d4f:	00 00 00 
+  802d52:	ff d0                	call   *%rax
+  802d54:	83 e0 01             	and    $0x1,%eax
+}
+  802d57:	5d                   	pop    %rbp
+  802d58:	c3                   	ret
+
+0000000000802d59 <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  802d59:	55                   	push   %rbp
+  802d5a:	48 89 e5             	mov    %rsp,%rbp
+  802d5d:	41 57                	push   %r15
+  802d5f:	41 56                	push   %r14
+  802d61:	41 55                	push   %r13
+  802d63:	41 54                	push   %r12
+  802d65:	53                   	push   %rbx
+  802d66:	48 83 ec 38          	sub    $0x38,%rsp
+  802d6a:	49 89 f7             	mov    %rsi,%r15
+  802d6d:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+                    }
+                    continue;
+                }
+                for (int ptei = 0; ptei < PT_ENTRY_COUNT; ptei++) {
+                    uintptr_t pte_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, pdei, ptei, 0);
+                    pte_t pte = uvpt[VPT(pte_addr)];
+  802d73:	49 bd 00 00 00 00 00 	movabs $0x10000000000,%r13
+  802d7a:	01 00 00 
+  802d7d:	4d 89 e6             	mov    %r12,%r14
+  802d80:	49 89 fc             	mov    %rdi,%r12
+  802d83:	e9 19 01 00 00       	jmp    802ea1 <foreach_shared_region+0x148>
+  802d88:	48 89 5d b0          	mov    %rbx,-0x50(%rbp)
+  802d8c:	4c 89 75 a8          	mov    %r14,-0x58(%rbp)
+  802d90:	eb 52                	jmp    802de4 <foreach_shared_region+0x8b>
+                for (int ptei = 0; ptei < PT_ENTRY_COUNT; ptei++) {
+  802d92:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802d99:	48 81 fb 00 00 20 00 	cmp    $0x200000,%rbx
+  802da0:	74 2e                	je     802dd0 <foreach_shared_region+0x77>
+                    uintptr_t pte_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, pdei, ptei, 0);
+  802da2:	48 89 df             	mov    %rbx,%rdi
+  802da5:	4c 09 f7             	or     %r14,%rdi
+                    pte_t pte = uvpt[VPT(pte_addr)];
+  802da8:	48 89 f8             	mov    %rdi,%rax
+  802dab:	48 c1 e8 0c          	shr    $0xc,%rax
+  802daf:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+                    if ((pte & PTE_P) && (pte & PTE_SHARE)) {
+  802db4:	25 01 04 00 00       	and    $0x401,%eax
+  802db9:	48 3d 01 04 00 00    	cmp    $0x401,%rax
+  802dbf:	75 d1                	jne    802d92 <foreach_shared_region+0x39>
+                        fun((void*)pte_addr, (void*)(pte_addr + PAGE_SIZE), arg);
+  802dc1:	48 8d b7 00 10 00 00 	lea    0x1000(%rdi),%rsi
+  802dc8:	4c 89 fa             	mov    %r15,%rdx
+  802dcb:	41 ff d4             	call   *%r12
+  802dce:	eb c2                	jmp    802d92 <foreach_shared_region+0x39>
+            for (int pdei = 0; pdei < PD_ENTRY_COUNT; pdei++) {
+  802dd0:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  802dd7:	00 
+  802dd8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802ddc:	48 3d 00 00 00 40    	cmp    $0x40000000,%rax
+  802de2:	74 46                	je     802e2a <foreach_shared_region+0xd1>
+                uintptr_t pde_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, pdei, 0, 0);
+  802de4:	4c 8b 75 c8          	mov    -0x38(%rbp),%r14
+  802de8:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802dec:	49 09 c6             	or     %rax,%r14
+                pde_t pde = uvpd[VPD(pde_addr)];
+  802def:	4c 89 f0             	mov    %r14,%rax
+  802df2:	48 c1 e8 15          	shr    $0x15,%rax
+  802df6:	48 b9 00 00 00 80 00 	movabs $0x10080000000,%rcx
+  802dfd:	01 00 00 
+  802e00:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+                if (!(pde & PTE_P)) {
+  802e04:	a8 01                	test   $0x1,%al
+  802e06:	74 c8                	je     802dd0 <foreach_shared_region+0x77>
+                if (pde & PTE_PS) {
+  802e08:	48 89 c3             	mov    %rax,%rbx
+  802e0b:	81 e3 80 00 00 00    	and    $0x80,%ebx
+  802e11:	74 8f                	je     802da2 <foreach_shared_region+0x49>
+                    if (pde & PTE_SHARE) {
+  802e13:	f6 c4 04             	test   $0x4,%ah
+  802e16:	74 b8                	je     802dd0 <foreach_shared_region+0x77>
+                        fun((void*)pde_addr, (void*)(pde_addr + 1024 * 1024 * 2), arg);
+  802e18:	49 8d b6 00 00 20 00 	lea    0x200000(%r14),%rsi
+  802e1f:	4c 89 fa             	mov    %r15,%rdx
+  802e22:	4c 89 f7             	mov    %r14,%rdi
+  802e25:	41 ff d4             	call   *%r12
+  802e28:	eb a6                	jmp    802dd0 <foreach_shared_region+0x77>
+  802e2a:	48 8b 5d b0          	mov    -0x50(%rbp),%rbx
+  802e2e:	4c 8b 75 a8          	mov    -0x58(%rbp),%r14
+        for (int pdpei = 0; pdpei < PDP_ENTRY_COUNT; pdpei++) {
+  802e32:	48 81 c3 00 00 00 40 	add    $0x40000000,%rbx
+  802e39:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802e40:	00 00 00 
+  802e43:	48 39 c3             	cmp    %rax,%rbx
+  802e46:	74 4c                	je     802e94 <foreach_shared_region+0x13b>
+            uintptr_t pdpe_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, 0, 0, 0);
+  802e48:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802e4c:	48 09 d8             	or     %rbx,%rax
+  802e4f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+            pdpe_t pdpe = uvpdp[VPDP(pdpe_addr)];
+  802e53:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802e57:	48 b9 00 00 40 80 00 	movabs $0x10080400000,%rcx
+  802e5e:	01 00 00 
+  802e61:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+            if (!(pdpe & PTE_P)) {
+  802e65:	a8 01                	test   $0x1,%al
+  802e67:	74 c9                	je     802e32 <foreach_shared_region+0xd9>
+            if (pdpe & PTE_PS) {
+  802e69:	48 89 c1             	mov    %rax,%rcx
+  802e6c:	81 e1 80 00 00 00    	and    $0x80,%ecx
+  802e72:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  802e76:	0f 84 0c ff ff ff    	je     802d88 <foreach_shared_region+0x2f>
+                if (pdpe & PTE_SHARE) {
+  802e7c:	f6 c4 04             	test   $0x4,%ah
+  802e7f:	74 b1                	je     802e32 <foreach_shared_region+0xd9>
+                    fun((void*)pdpe_addr, (void*)(pdpe_addr + 1024 * 1024 * 1024), arg); 
+  802e81:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  802e85:	48 8d b7 00 00 00 40 	lea    0x40000000(%rdi),%rsi
+  802e8c:	4c 89 fa             	mov    %r15,%rdx
+  802e8f:	41 ff d4             	call   *%r12
+  802e92:	eb 9e                	jmp    802e32 <foreach_shared_region+0xd9>
+    for (int pml4ei = 0; pml4ei < PML4_ENTRY_COUNT; pml4ei++) {
+  802e94:	49 83 c6 01          	add    $0x1,%r14
+  802e98:	49 81 fe 00 02 00 00 	cmp    $0x200,%r14
+  802e9f:	74 24                	je     802ec5 <foreach_shared_region+0x16c>
+        pml4e_t pml4e = uvpml4[VPML4(pml4_addr)];
+  802ea1:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  802ea8:	01 00 00 
+  802eab:	4a 8b 04 f0          	mov    (%rax,%r14,8),%rax
+        if (!(pml4e & PTE_P)) {
+  802eaf:	a8 01                	test   $0x1,%al
+  802eb1:	74 e1                	je     802e94 <foreach_shared_region+0x13b>
+  802eb3:	4c 89 f0             	mov    %r14,%rax
+  802eb6:	48 c1 e0 27          	shl    $0x27,%rax
+  802eba:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  802ebe:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802ec3:	eb 83                	jmp    802e48 <foreach_shared_region+0xef>
+            }
+        }
+    }
+    
+    return 0;
+}
+  802ec5:	b8 00 00 00 00       	mov    $0x0,%eax
+  802eca:	48 83 c4 38          	add    $0x38,%rsp
+  802ece:	5b                   	pop    %rbx
+  802ecf:	41 5c                	pop    %r12
+  802ed1:	41 5d                	pop    %r13
+  802ed3:	41 5e                	pop    %r14
+  802ed5:	41 5f                	pop    %r15
+  802ed7:	5d                   	pop    %rbp
+  802ed8:	c3                   	ret
+
+0000000000802ed9 <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  802ed9:	55                   	push   %rbp
+  802eda:	48 89 e5             	mov    %rsp,%rbp
+  802edd:	41 55                	push   %r13
+  802edf:	41 54                	push   %r12
+  802ee1:	53                   	push   %rbx
+  802ee2:	48 83 ec 08          	sub    $0x8,%rsp
+  802ee6:	49 89 fc             	mov    %rdi,%r12
+  802ee9:	48 89 f7             	mov    %rsi,%rdi
+  802eec:	48 89 d3             	mov    %rdx,%rbx
+  802eef:	49 89 cd             	mov    %rcx,%r13
+    // LAB 9: Your code here:
+    int res = sys_ipc_recv(!pg ? (void*)MAX_USER_ADDRESS : pg, !size ? 0 : *size);
+  802ef2:	be 00 00 00 00       	mov    $0x0,%esi
+  802ef7:	48 85 d2             	test   %rdx,%rdx
+  802efa:	74 03                	je     802eff <ipc_recv+0x26>
+  802efc:	48 8b 32             	mov    (%rdx),%rsi
+  802eff:	48 85 ff             	test   %rdi,%rdi
+  802f02:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802f09:	00 00 00 
+  802f0c:	48 0f 44 f8          	cmove  %rax,%rdi
+  802f10:	48 b8 a1 19 80 00 00 	movabs $0x8019a1,%rax
+  802f17:	00 00 00 
+  802f1a:	ff d0                	call   *%rax
+    if (res < 0) {
+  802f1c:	85 c0                	test   %eax,%eax
+  802f1e:	78 66                	js     802f86 <ipc_recv+0xad>
+        if (size) {
+            *size = 0;
+        }
+        return res;
+    }
+    if (from_env_store) {
+  802f20:	4d 85 e4             	test   %r12,%r12
+  802f23:	74 14                	je     802f39 <ipc_recv+0x60>
+        *from_env_store = thisenv->env_ipc_from;
+  802f25:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802f2c:	00 00 00 
+  802f2f:	8b 80 ac 01 00 00    	mov    0x1ac(%rax),%eax
+  802f35:	41 89 04 24          	mov    %eax,(%r12)
+    }
+    if (perm_store) {
+  802f39:	4d 85 ed             	test   %r13,%r13
+  802f3c:	74 14                	je     802f52 <ipc_recv+0x79>
+        *perm_store = thisenv->env_ipc_perm;
+  802f3e:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802f45:	00 00 00 
+  802f48:	8b 80 b0 01 00 00    	mov    0x1b0(%rax),%eax
+  802f4e:	41 89 45 00          	mov    %eax,0x0(%r13)
+    }
+    if (size) {
+  802f52:	48 85 db             	test   %rbx,%rbx
+  802f55:	74 14                	je     802f6b <ipc_recv+0x92>
+        *size = thisenv->env_ipc_maxsz;
+  802f57:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802f5e:	00 00 00 
+  802f61:	48 8b 80 a0 01 00 00 	mov    0x1a0(%rax),%rax
+  802f68:	48 89 03             	mov    %rax,(%rbx)
+    }
+    return thisenv->env_ipc_value;
+  802f6b:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802f72:	00 00 00 
+  802f75:	8b 80 a8 01 00 00    	mov    0x1a8(%rax),%eax
+}
+  802f7b:	48 83 c4 08          	add    $0x8,%rsp
+  802f7f:	5b                   	pop    %rbx
+  802f80:	41 5c                	pop    %r12
+  802f82:	41 5d                	pop    %r13
+  802f84:	5d                   	pop    %rbp
+  802f85:	c3                   	ret
+        if (from_env_store) {
+  802f86:	4d 85 e4             	test   %r12,%r12
+  802f89:	74 08                	je     802f93 <ipc_recv+0xba>
+            *from_env_store = 0;
+  802f8b:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  802f92:	00 
+        if (perm_store) {
+  802f93:	4d 85 ed             	test   %r13,%r13
+  802f96:	74 08                	je     802fa0 <ipc_recv+0xc7>
+            *perm_store = 0;
+  802f98:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  802f9f:	00 
+        if (size) {
+  802fa0:	48 85 db             	test   %rbx,%rbx
+  802fa3:	74 d6                	je     802f7b <ipc_recv+0xa2>
+            *size = 0;
+  802fa5:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  802fac:	eb cd                	jmp    802f7b <ipc_recv+0xa2>
+
+0000000000802fae <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  802fae:	55                   	push   %rbp
+  802faf:	48 89 e5             	mov    %rsp,%rbp
+  802fb2:	41 57                	push   %r15
+  802fb4:	41 56                	push   %r14
+  802fb6:	41 55                	push   %r13
+  802fb8:	41 54                	push   %r12
+  802fba:	53                   	push   %rbx
+  802fbb:	48 83 ec 18          	sub    $0x18,%rsp
+  802fbf:	41 89 fd             	mov    %edi,%r13d
+  802fc2:	89 75 cc             	mov    %esi,-0x34(%rbp)
+  802fc5:	49 89 cc             	mov    %rcx,%r12
+  802fc8:	44 89 45 c8          	mov    %r8d,-0x38(%rbp)
+    // LAB 9: Your code here:
+    int res = 0;
+    while ((res = sys_ipc_try_send(to_env, val, !pg ? (void*)MAX_USER_ADDRESS : pg, size, perm)) < 0) {
+  802fcc:	48 85 d2             	test   %rdx,%rdx
+  802fcf:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802fd6:	00 00 00 
+  802fd9:	48 0f 45 c2          	cmovne %rdx,%rax
+  802fdd:	48 89 c3             	mov    %rax,%rbx
+  802fe0:	49 be 75 19 80 00 00 	movabs $0x801975,%r14
+  802fe7:	00 00 00 
+        if (res != -E_IPC_NOT_RECV) {
+            panic("sys_ipc_try_send failed: %i", res);
+        }
+        sys_yield();
+  802fea:	49 bf 40 15 80 00 00 	movabs $0x801540,%r15
+  802ff1:	00 00 00 
+    while ((res = sys_ipc_try_send(to_env, val, !pg ? (void*)MAX_USER_ADDRESS : pg, size, perm)) < 0) {
+  802ff4:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  802ff7:	44 8b 45 c8          	mov    -0x38(%rbp),%r8d
+  802ffb:	4c 89 e1             	mov    %r12,%rcx
+  802ffe:	48 89 da             	mov    %rbx,%rdx
+  803001:	44 89 ef             	mov    %r13d,%edi
+  803004:	41 ff d6             	call   *%r14
+  803007:	85 c0                	test   %eax,%eax
+  803009:	79 37                	jns    803042 <ipc_send+0x94>
+        if (res != -E_IPC_NOT_RECV) {
+  80300b:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  80300e:	75 05                	jne    803015 <ipc_send+0x67>
+        sys_yield();
+  803010:	41 ff d7             	call   *%r15
+  803013:	eb df                	jmp    802ff4 <ipc_send+0x46>
+            panic("sys_ipc_try_send failed: %i", res);
+  803015:	89 c1                	mov    %eax,%ecx
+  803017:	48 ba f4 37 80 00 00 	movabs $0x8037f4,%rdx
+  80301e:	00 00 00 
+  803021:	be 40 00 00 00       	mov    $0x40,%esi
+  803026:	48 bf 10 38 80 00 00 	movabs $0x803810,%rdi
+  80302d:	00 00 00 
+  803030:	b8 00 00 00 00       	mov    $0x0,%eax
+  803035:	49 b8 60 04 80 00 00 	movabs $0x800460,%r8
+  80303c:	00 00 00 
+  80303f:	41 ff d0             	call   *%r8
+    }
+    return;
+}
+  803042:	48 83 c4 18          	add    $0x18,%rsp
+  803046:	5b                   	pop    %rbx
+  803047:	41 5c                	pop    %r12
+  803049:	41 5d                	pop    %r13
+  80304b:	41 5e                	pop    %r14
+  80304d:	41 5f                	pop    %r15
+  80304f:	5d                   	pop    %rbp
+  803050:	c3                   	ret
+
+0000000000803051 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  803051:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  803056:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  80305d:	00 00 00 
+  803060:	48 69 d0 d0 01 00 00 	imul   $0x1d0,%rax,%rdx
+  803067:	48 01 ca             	add    %rcx,%rdx
+  80306a:	8b 92 e8 00 00 00    	mov    0xe8(%rdx),%edx
+  803070:	39 fa                	cmp    %edi,%edx
+  803072:	74 12                	je     803086 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  803074:	48 83 c0 01          	add    $0x1,%rax
+  803078:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  80307e:	75 e0                	jne    803060 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  803080:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803085:	c3                   	ret
+            return envs[i].env_id;
+  803086:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+  80308d:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  803094:	00 00 00 
+  803097:	48 01 d0             	add    %rdx,%rax
+  80309a:	8b 80 e0 00 00 00    	mov    0xe0(%rax),%eax
+  8030a0:	c3                   	ret
+  8030a1:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+00000000008030a8 <__rodata_start>:
+  8030a8:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8030a9:	70 65                	jo     803110 <__rodata_start+0x68>
+  8030ab:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8030ac:	63 6f 6e             	movsxd 0x6e(%rdi),%ebp
+  8030af:	73 3a                	jae    8030eb <__rodata_start+0x43>
+  8030b1:	20 25 69 00 75 73    	and    %ah,0x73750069(%rip)        # 73f53120 <__bss_end+0x7374b120>
+  8030b7:	65 72 2f             	gs jb  8030e9 <__rodata_start+0x41>
+  8030ba:	74 65                	je     803121 <__rodata_start+0x79>
+  8030bc:	73 74                	jae    803132 <__rodata_start+0x8a>
+  8030be:	6b 62 64 2e          	imul   $0x2e,0x64(%rdx),%esp
+  8030c2:	63 00                	movsxd (%rax),%eax
+  8030c4:	66 69 72 73 74 20    	imul   $0x2074,0x73(%rdx),%si
+  8030ca:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8030cb:	70 65                	jo     803132 <__rodata_start+0x8a>
+  8030cd:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8030ce:	63 6f 6e             	movsxd 0x6e(%rdi),%ebp
+  8030d1:	73 20                	jae    8030f3 <__rodata_start+0x4b>
+  8030d3:	75 73                	jne    803148 <__rodata_start+0xa0>
+  8030d5:	65 64 20 66 64       	gs and %ah,%fs:0x64(%rsi)
+  8030da:	20 25 64 00 64 75    	and    %ah,0x75640064(%rip)        # 75e43144 <__bss_end+0x7563b144>
+  8030e0:	70 3a                	jo     80311c <__rodata_start+0x74>
+  8030e2:	20 25 69 00 54 79    	and    %ah,0x79540069(%rip)        # 79d43151 <__bss_end+0x7953b151>
+  8030e8:	70 65                	jo     80314f <__rodata_start+0xa7>
+  8030ea:	20 61 20             	and    %ah,0x20(%rcx)
+  8030ed:	6c                   	insb   (%dx),%es:(%rdi)
+  8030ee:	69 6e 65 3a 20 00 25 	imul   $0x2500203a,0x65(%rsi),%ebp
+  8030f5:	73 0a                	jae    803101 <__rodata_start+0x59>
+  8030f7:	00 28                	add    %ch,(%rax)
+  8030f9:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  8030fb:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  8030ff:	20 66 69             	and    %ah,0x69(%rsi)
+  803102:	6c                   	insb   (%dx),%es:(%rdi)
+  803103:	65 20 72 65          	and    %dh,%gs:0x65(%rdx)
+  803107:	63 65 69             	movsxd 0x69(%rbp),%esp
+  80310a:	76 65                	jbe    803171 <__rodata_start+0xc9>
+  80310c:	64 29 0a             	sub    %ecx,%fs:(%rdx)
+  80310f:	00 3c 63             	add    %bh,(%rbx,%riz,2)
+  803112:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803113:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803114:	73 3e                	jae    803154 <__rodata_start+0xac>
+  803116:	00 63 6f             	add    %ah,0x6f(%rbx)
+  803119:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80311a:	73 00                	jae    80311c <__rodata_start+0x74>
+  80311c:	3c 75                	cmp    $0x75,%al
+  80311e:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80311f:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  803123:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803124:	3e 00 66 90          	ds add %ah,-0x70(%rsi)
+  803128:	5b                   	pop    %rbx
+  803129:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  80312e:	20 75 73             	and    %dh,0x73(%rbp)
+  803131:	65 72 20             	gs jb  803154 <__rodata_start+0xac>
+  803134:	70 61                	jo     803197 <__rodata_start+0xef>
+  803136:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803137:	69 63 20 69 6e 20 25 	imul   $0x25206e69,0x20(%rbx),%esp
+  80313e:	73 20                	jae    803160 <__rodata_start+0xb8>
+  803140:	61                   	(bad)
+  803141:	74 20                	je     803163 <__rodata_start+0xbb>
+  803143:	25 73 3a 25 64       	and    $0x64253a73,%eax
+  803148:	3a 20                	cmp    (%rax),%ah
+  80314a:	00 30                	add    %dh,(%rax)
+  80314c:	31 32                	xor    %esi,(%rdx)
+  80314e:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  803155:	41                   	rex.B
+  803156:	42                   	rex.X
+  803157:	43                   	rex.XB
+  803158:	44                   	rex.R
+  803159:	45                   	rex.RB
+  80315a:	46 00 30             	rex.RX add %r14b,(%rax)
+  80315d:	31 32                	xor    %esi,(%rdx)
+  80315f:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  803166:	61                   	(bad)
+  803167:	62 63 64 65 66       	(bad)
+  80316c:	00 28                	add    %ch,(%rax)
+  80316e:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80316f:	75 6c                	jne    8031dd <__rodata_start+0x135>
+  803171:	6c                   	insb   (%dx),%es:(%rdi)
+  803172:	29 00                	sub    %eax,(%rax)
+  803174:	65 72 72             	gs jb  8031e9 <__rodata_start+0x141>
+  803177:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803178:	72 20                	jb     80319a <__rodata_start+0xf2>
+  80317a:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  80317f:	73 70                	jae    8031f1 <__rodata_start+0x149>
+  803181:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  803185:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  80318c:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80318d:	72 00                	jb     80318f <__rodata_start+0xe7>
+  80318f:	62 61 64 20 65       	(bad)
+  803194:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803195:	76 69                	jbe    803200 <__rodata_start+0x158>
+  803197:	72 6f                	jb     803208 <__rodata_start+0x160>
+  803199:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80319a:	6d                   	insl   (%dx),%es:(%rdi)
+  80319b:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  80319d:	74 00                	je     80319f <__rodata_start+0xf7>
+  80319f:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  8031a6:	20 70 61             	and    %dh,0x61(%rax)
+  8031a9:	72 61                	jb     80320c <__rodata_start+0x164>
+  8031ab:	6d                   	insl   (%dx),%es:(%rdi)
+  8031ac:	65 74 65             	gs je  803214 <__rodata_start+0x16c>
+  8031af:	72 00                	jb     8031b1 <__rodata_start+0x109>
+  8031b1:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8031b2:	75 74                	jne    803228 <__rodata_start+0x180>
+  8031b4:	20 6f 66             	and    %ch,0x66(%rdi)
+  8031b7:	20 6d 65             	and    %ch,0x65(%rbp)
+  8031ba:	6d                   	insl   (%dx),%es:(%rdi)
+  8031bb:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8031bc:	72 79                	jb     803237 <__rodata_start+0x18f>
+  8031be:	00 6f 75             	add    %ch,0x75(%rdi)
+  8031c1:	74 20                	je     8031e3 <__rodata_start+0x13b>
+  8031c3:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8031c4:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  8031c8:	76 69                	jbe    803233 <__rodata_start+0x18b>
+  8031ca:	72 6f                	jb     80323b <__rodata_start+0x193>
+  8031cc:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8031cd:	6d                   	insl   (%dx),%es:(%rdi)
+  8031ce:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  8031d0:	74 73                	je     803245 <__rodata_start+0x19d>
+  8031d2:	00 63 6f             	add    %ah,0x6f(%rbx)
+  8031d5:	72 72                	jb     803249 <__rodata_start+0x1a1>
+  8031d7:	75 70                	jne    803249 <__rodata_start+0x1a1>
+  8031d9:	74 65                	je     803240 <__rodata_start+0x198>
+  8031db:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  8031e0:	75 67                	jne    803249 <__rodata_start+0x1a1>
+  8031e2:	20 69 6e             	and    %ch,0x6e(%rcx)
+  8031e5:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  8031e7:	00 73 65             	add    %dh,0x65(%rbx)
+  8031ea:	67 6d                	insl   (%dx),%es:(%edi)
+  8031ec:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  8031ee:	74 61                	je     803251 <__rodata_start+0x1a9>
+  8031f0:	74 69                	je     80325b <__rodata_start+0x1b3>
+  8031f2:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8031f3:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8031f4:	20 66 61             	and    %ah,0x61(%rsi)
+  8031f7:	75 6c                	jne    803265 <__rodata_start+0x1bd>
+  8031f9:	74 00                	je     8031fb <__rodata_start+0x153>
+  8031fb:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  803202:	20 45 4c             	and    %al,0x4c(%rbp)
+  803205:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  803209:	61                   	(bad)
+  80320a:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  80320f:	20 73 75             	and    %dh,0x75(%rbx)
+  803212:	63 68 20             	movsxd 0x20(%rax),%ebp
+  803215:	73 79                	jae    803290 <__rodata_start+0x1e8>
+  803217:	73 74                	jae    80328d <__rodata_start+0x1e5>
+  803219:	65 6d                	gs insl (%dx),%es:(%rdi)
+  80321b:	20 63 61             	and    %ah,0x61(%rbx)
+  80321e:	6c                   	insb   (%dx),%es:(%rdi)
+  80321f:	6c                   	insb   (%dx),%es:(%rdi)
+  803220:	00 65 6e             	add    %ah,0x6e(%rbp)
+  803223:	74 72                	je     803297 <__rodata_start+0x1ef>
+  803225:	79 20                	jns    803247 <__rodata_start+0x19f>
+  803227:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803228:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803229:	74 20                	je     80324b <__rodata_start+0x1a3>
+  80322b:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  80322d:	75 6e                	jne    80329d <__rodata_start+0x1f5>
+  80322f:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  803233:	76 20                	jbe    803255 <__rodata_start+0x1ad>
+  803235:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  80323c:	72 65                	jb     8032a3 <__rodata_start+0x1fb>
+  80323e:	63 76 69             	movsxd 0x69(%rsi),%esi
+  803241:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803242:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  803246:	65 78 70             	gs js  8032b9 <__rodata_start+0x211>
+  803249:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  80324e:	20 65 6e             	and    %ah,0x6e(%rbp)
+  803251:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  803255:	20 66 69             	and    %ah,0x69(%rsi)
+  803258:	6c                   	insb   (%dx),%es:(%rdi)
+  803259:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  80325d:	20 66 72             	and    %ah,0x72(%rsi)
+  803260:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  803265:	61                   	(bad)
+  803266:	63 65 20             	movsxd 0x20(%rbp),%esp
+  803269:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80326a:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80326b:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  80326f:	6b 00 74             	imul   $0x74,(%rax),%eax
+  803272:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803273:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803274:	20 6d 61             	and    %ch,0x61(%rbp)
+  803277:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803278:	79 20                	jns    80329a <__rodata_start+0x1f2>
+  80327a:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  803281:	72 65                	jb     8032e8 <__rodata_start+0x240>
+  803283:	20 6f 70             	and    %ch,0x70(%rdi)
+  803286:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803288:	00 66 69             	add    %ah,0x69(%rsi)
+  80328b:	6c                   	insb   (%dx),%es:(%rdi)
+  80328c:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  803290:	20 62 6c             	and    %ah,0x6c(%rdx)
+  803293:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803294:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  803297:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803298:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803299:	74 20                	je     8032bb <__rodata_start+0x213>
+  80329b:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  80329d:	75 6e                	jne    80330d <__rodata_start+0x265>
+  80329f:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  8032a3:	76 61                	jbe    803306 <__rodata_start+0x25e>
+  8032a5:	6c                   	insb   (%dx),%es:(%rdi)
+  8032a6:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  8032ad:	00 
+  8032ae:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  8032b5:	72 65                	jb     80331c <__rodata_start+0x274>
+  8032b7:	61                   	(bad)
+  8032b8:	64 79 20             	fs jns 8032db <__rodata_start+0x233>
+  8032bb:	65 78 69             	gs js  803327 <__rodata_start+0x27f>
+  8032be:	73 74                	jae    803334 <__rodata_start+0x28c>
+  8032c0:	73 00                	jae    8032c2 <__rodata_start+0x21a>
+  8032c2:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8032c3:	70 65                	jo     80332a <__rodata_start+0x282>
+  8032c5:	72 61                	jb     803328 <__rodata_start+0x280>
+  8032c7:	74 69                	je     803332 <__rodata_start+0x28a>
+  8032c9:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8032ca:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8032cb:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  8032ce:	74 20                	je     8032f0 <__rodata_start+0x248>
+  8032d0:	73 75                	jae    803347 <__rodata_start+0x29f>
+  8032d2:	70 70                	jo     803344 <__rodata_start+0x29c>
+  8032d4:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8032d5:	72 74                	jb     80334b <__rodata_start+0x2a3>
+  8032d7:	65 64 00 6f 70       	gs add %ch,%fs:0x70(%rdi)
+  8032dc:	65 72 61             	gs jb  803340 <__rodata_start+0x298>
+  8032df:	74 69                	je     80334a <__rodata_start+0x2a2>
+  8032e1:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8032e2:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8032e3:	20 69 6e             	and    %ch,0x6e(%rcx)
+  8032e6:	74 65                	je     80334d <__rodata_start+0x2a5>
+  8032e8:	72 72                	jb     80335c <__rodata_start+0x2b4>
+  8032ea:	75 70                	jne    80335c <__rodata_start+0x2b4>
+  8032ec:	74 65                	je     803353 <__rodata_start+0x2ab>
+  8032ee:	64 00 6e 6f          	add    %ch,%fs:0x6f(%rsi)
+  8032f2:	74 20                	je     803314 <__rodata_start+0x26c>
+  8032f4:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  8032f6:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8032f7:	75 67                	jne    803360 <__rodata_start+0x2b8>
+  8032f9:	68 20 43 50 55       	push   $0x55504320
+  8032fe:	20 74 69 6d          	and    %dh,0x6d(%rcx,%rbp,2)
+  803302:	65 00 66 2e          	add    %ah,%gs:0x2e(%rsi)
+  803306:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+  80330d:	00 
+  80330e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  803315:	00 00 00 
+  803318:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+  80331f:	00 
+  803320:	9d                   	popf
+  803321:	07                   	(bad)
+  803322:	80 00 00             	addb   $0x0,(%rax)
+  803325:	00 00                	add    %al,(%rax)
+  803327:	00 de                	add    %bl,%dh
+  803329:	0d 80 00 00 00       	or     $0x80,%eax
+  80332e:	00 00                	add    %al,(%rax)
+  803330:	ce                   	(bad)
+  803331:	0d 80 00 00 00       	or     $0x80,%eax
+  803336:	00 00                	add    %al,(%rax)
+  803338:	de 0d 80 00 00 00    	fimuls 0x80(%rip)        # 8033be <__rodata_start+0x316>
+  80333e:	00 00                	add    %al,(%rax)
+  803340:	de 0d 80 00 00 00    	fimuls 0x80(%rip)        # 8033c6 <__rodata_start+0x31e>
+  803346:	00 00                	add    %al,(%rax)
+  803348:	de 0d 80 00 00 00    	fimuls 0x80(%rip)        # 8033ce <__rodata_start+0x326>
+  80334e:	00 00                	add    %al,(%rax)
+  803350:	de 0d 80 00 00 00    	fimuls 0x80(%rip)        # 8033d6 <__rodata_start+0x32e>
+  803356:	00 00                	add    %al,(%rax)
+  803358:	bc 07 80 00 00       	mov    $0x8007,%esp
+  80335d:	00 00                	add    %al,(%rax)
+  80335f:	00 de                	add    %bl,%dh
+  803361:	0d 80 00 00 00       	or     $0x80,%eax
+  803366:	00 00                	add    %al,(%rax)
+  803368:	de 0d 80 00 00 00    	fimuls 0x80(%rip)        # 8033ee <__rodata_start+0x346>
+  80336e:	00 00                	add    %al,(%rax)
+  803370:	b0 07                	mov    $0x7,%al
+  803372:	80 00 00             	addb   $0x0,(%rax)
+  803375:	00 00                	add    %al,(%rax)
+  803377:	00 2a                	add    %ch,(%rdx)
+  803379:	08 80 00 00 00 00    	or     %al,0x0(%rax)
+  80337f:	00 de                	add    %bl,%dh
+  803381:	0d 80 00 00 00       	or     $0x80,%eax
+  803386:	00 00                	add    %al,(%rax)
+  803388:	b0 07                	mov    $0x7,%al
+  80338a:	80 00 00             	addb   $0x0,(%rax)
+  80338d:	00 00                	add    %al,(%rax)
+  80338f:	00 f6                	add    %dh,%dh
+  803391:	07                   	(bad)
+  803392:	80 00 00             	addb   $0x0,(%rax)
+  803395:	00 00                	add    %al,(%rax)
+  803397:	00 f6                	add    %dh,%dh
+  803399:	07                   	(bad)
+  80339a:	80 00 00             	addb   $0x0,(%rax)
+  80339d:	00 00                	add    %al,(%rax)
+  80339f:	00 f6                	add    %dh,%dh
+  8033a1:	07                   	(bad)
+  8033a2:	80 00 00             	addb   $0x0,(%rax)
+  8033a5:	00 00                	add    %al,(%rax)
+  8033a7:	00 f6                	add    %dh,%dh
+  8033a9:	07                   	(bad)
+  8033aa:	80 00 00             	addb   $0x0,(%rax)
+  8033ad:	00 00                	add    %al,(%rax)
+  8033af:	00 f6                	add    %dh,%dh
+  8033b1:	07                   	(bad)
+  8033b2:	80 00 00             	addb   $0x0,(%rax)
+  8033b5:	00 00                	add    %al,(%rax)
+  8033b7:	00 f6                	add    %dh,%dh
+  8033b9:	07                   	(bad)
+  8033ba:	80 00 00             	addb   $0x0,(%rax)
+  8033bd:	00 00                	add    %al,(%rax)
+  8033bf:	00 f6                	add    %dh,%dh
+  8033c1:	07                   	(bad)
+  8033c2:	80 00 00             	addb   $0x0,(%rax)
+  8033c5:	00 00                	add    %al,(%rax)
+  8033c7:	00 f6                	add    %dh,%dh
+  8033c9:	07                   	(bad)
+  8033ca:	80 00 00             	addb   $0x0,(%rax)
+  8033cd:	00 00                	add    %al,(%rax)
+  8033cf:	00 f6                	add    %dh,%dh
+  8033d1:	07                   	(bad)
+  8033d2:	80 00 00             	addb   $0x0,(%rax)
+  8033d5:	00 00                	add    %al,(%rax)
+  8033d7:	00 de                	add    %bl,%dh
+  8033d9:	0d 80 00 00 00       	or     $0x80,%eax
+  8033de:	00 00                	add    %al,(%rax)
+  8033e0:	de 0d 80 00 00 00    	fimuls 0x80(%rip)        # 803466 <__rodata_start+0x3be>
+  8033e6:	00 00                	add    %al,(%rax)
+  8033e8:	de 0d 80 00 00 00    	fimuls 0x80(%rip)        # 80346e <__rodata_start+0x3c6>
+  8033ee:	00 00                	add    %al,(%rax)
+  8033f0:	de 0d 80 00 00 00    	fimuls 0x80(%rip)        # 803476 <__rodata_start+0x3ce>
+  8033f6:	00 00                	add    %al,(%rax)
+  8033f8:	de 0d 80 00 00 00    	fimuls 0x80(%rip)        # 80347e <__rodata_start+0x3d6>
+  8033fe:	00 00                	add    %al,(%rax)
+  803400:	de 0d 80 00 00 00    	fimuls 0x80(%rip)        # 803486 <__rodata_start+0x3de>
+  803406:	00 00                	add    %al,(%rax)
+  803408:	de 0d 80 00 00 00    	fimuls 0x80(%rip)        # 80348e <__rodata_start+0x3e6>
+  80340e:	00 00                	add    %al,(%rax)
+  803410:	de 0d 80 00 00 00    	fimuls 0x80(%rip)        # 803496 <__rodata_start+0x3ee>
+  803416:	00 00                	add    %al,(%rax)
+  803418:	de 0d 80 00 00 00    	fimuls 0x80(%rip)        # 80349e <__rodata_start+0x3f6>
+  80341e:	00 00                	add    %al,(%rax)
+  803420:	de 0d 80 00 00 00    	fimuls 0x80(%rip)        # 8034a6 <__rodata_start+0x3fe>
+  803426:	00 00                	add    %al,(%rax)
+  803428:	de 0d 80 00 00 00    	fimuls 0x80(%rip)        # 8034ae <__rodata_start+0x406>
+  80342e:	00 00                	add    %al,(%rax)
+  803430:	de 0d 80 00 00 00    	fimuls 0x80(%rip)        # 8034b6 <__rodata_start+0x40e>
+  803436:	00 00                	add    %al,(%rax)
+  803438:	de 0d 80 00 00 00    	fimuls 0x80(%rip)        # 8034be <__rodata_start+0x416>
+  80343e:	00 00                	add    %al,(%rax)
+  803440:	de 0d 80 00 00 00    	fimuls 0x80(%rip)        # 8034c6 <__rodata_start+0x41e>
+  803446:	00 00                	add    %al,(%rax)
+  803448:	de 0d 80 00 00 00    	fimuls 0x80(%rip)        # 8034ce <__rodata_start+0x426>
+  80344e:	00 00                	add    %al,(%rax)
+  803450:	de 0d 80 00 00 00    	fimuls 0x80(%rip)        # 8034d6 <__rodata_start+0x42e>
+  803456:	00 00                	add    %al,(%rax)
+  803458:	de 0d 80 00 00 00    	fimuls 0x80(%rip)        # 8034de <__rodata_start+0x436>
+  80345e:	00 00                	add    %al,(%rax)
+  803460:	de 0d 80 00 00 00    	fimuls 0x80(%rip)        # 8034e6 <__rodata_start+0x43e>
+  803466:	00 00                	add    %al,(%rax)
+  803468:	de 0d 80 00 00 00    	fimuls 0x80(%rip)        # 8034ee <__rodata_start+0x446>
+  80346e:	00 00                	add    %al,(%rax)
+  803470:	de 0d 80 00 00 00    	fimuls 0x80(%rip)        # 8034f6 <__rodata_start+0x44e>
+  803476:	00 00                	add    %al,(%rax)
+  803478:	de 0d 80 00 00 00    	fimuls 0x80(%rip)        # 8034fe <__rodata_start+0x456>
+  80347e:	00 00                	add    %al,(%rax)
+  803480:	de 0d 80 00 00 00    	fimuls 0x80(%rip)        # 803506 <__rodata_start+0x45e>
+  803486:	00 00                	add    %al,(%rax)
+  803488:	de 0d 80 00 00 00    	fimuls 0x80(%rip)        # 80350e <__rodata_start+0x466>
+  80348e:	00 00                	add    %al,(%rax)
+  803490:	de 0d 80 00 00 00    	fimuls 0x80(%rip)        # 803516 <__rodata_start+0x46e>
+  803496:	00 00                	add    %al,(%rax)
+  803498:	de 0d 80 00 00 00    	fimuls 0x80(%rip)        # 80351e <__rodata_start+0x476>
+  80349e:	00 00                	add    %al,(%rax)
+  8034a0:	de 0d 80 00 00 00    	fimuls 0x80(%rip)        # 803526 <__rodata_start+0x47e>
+  8034a6:	00 00                	add    %al,(%rax)
+  8034a8:	de 0d 80 00 00 00    	fimuls 0x80(%rip)        # 80352e <__rodata_start+0x486>
+  8034ae:	00 00                	add    %al,(%rax)
+  8034b0:	de 0d 80 00 00 00    	fimuls 0x80(%rip)        # 803536 <__rodata_start+0x48e>
+  8034b6:	00 00                	add    %al,(%rax)
+  8034b8:	de 0d 80 00 00 00    	fimuls 0x80(%rip)        # 80353e <__rodata_start+0x496>
+  8034be:	00 00                	add    %al,(%rax)
+  8034c0:	de 0d 80 00 00 00    	fimuls 0x80(%rip)        # 803546 <__rodata_start+0x49e>
+  8034c6:	00 00                	add    %al,(%rax)
+  8034c8:	01 0d 80 00 00 00    	add    %ecx,0x80(%rip)        # 80354e <__rodata_start+0x4a6>
+  8034ce:	00 00                	add    %al,(%rax)
+  8034d0:	de 0d 80 00 00 00    	fimuls 0x80(%rip)        # 803556 <__rodata_start+0x4ae>
+  8034d6:	00 00                	add    %al,(%rax)
+  8034d8:	de 0d 80 00 00 00    	fimuls 0x80(%rip)        # 80355e <__rodata_start+0x4b6>
+  8034de:	00 00                	add    %al,(%rax)
+  8034e0:	de 0d 80 00 00 00    	fimuls 0x80(%rip)        # 803566 <__rodata_start+0x4be>
+  8034e6:	00 00                	add    %al,(%rax)
+  8034e8:	de 0d 80 00 00 00    	fimuls 0x80(%rip)        # 80356e <__rodata_start+0x4c6>
+  8034ee:	00 00                	add    %al,(%rax)
+  8034f0:	de 0d 80 00 00 00    	fimuls 0x80(%rip)        # 803576 <__rodata_start+0x4ce>
+  8034f6:	00 00                	add    %al,(%rax)
+  8034f8:	de 0d 80 00 00 00    	fimuls 0x80(%rip)        # 80357e <__rodata_start+0x4d6>
+  8034fe:	00 00                	add    %al,(%rax)
+  803500:	de 0d 80 00 00 00    	fimuls 0x80(%rip)        # 803586 <__rodata_start+0x4de>
+  803506:	00 00                	add    %al,(%rax)
+  803508:	de 0d 80 00 00 00    	fimuls 0x80(%rip)        # 80358e <__rodata_start+0x4e6>
+  80350e:	00 00                	add    %al,(%rax)
+  803510:	de 0d 80 00 00 00    	fimuls 0x80(%rip)        # 803596 <__rodata_start+0x4ee>
+  803516:	00 00                	add    %al,(%rax)
+  803518:	de 0d 80 00 00 00    	fimuls 0x80(%rip)        # 80359e <__rodata_start+0x4f6>
+  80351e:	00 00                	add    %al,(%rax)
+  803520:	4d 08 80 00 00 00 00 	rex.WRB or %r8b,0x0(%r8)
+  803527:	00 1c 0a             	add    %bl,(%rdx,%rcx,1)
+  80352a:	80 00 00             	addb   $0x0,(%rax)
+  80352d:	00 00                	add    %al,(%rax)
+  80352f:	00 de                	add    %bl,%dh
+  803531:	0d 80 00 00 00       	or     $0x80,%eax
+  803536:	00 00                	add    %al,(%rax)
+  803538:	de 0d 80 00 00 00    	fimuls 0x80(%rip)        # 8035be <__rodata_start+0x516>
+  80353e:	00 00                	add    %al,(%rax)
+  803540:	de 0d 80 00 00 00    	fimuls 0x80(%rip)        # 8035c6 <__rodata_start+0x51e>
+  803546:	00 00                	add    %al,(%rax)
+  803548:	de 0d 80 00 00 00    	fimuls 0x80(%rip)        # 8035ce <__rodata_start+0x526>
+  80354e:	00 00                	add    %al,(%rax)
+  803550:	7c 08                	jl     80355a <__rodata_start+0x4b2>
+  803552:	80 00 00             	addb   $0x0,(%rax)
+  803555:	00 00                	add    %al,(%rax)
+  803557:	00 de                	add    %bl,%dh
+  803559:	0d 80 00 00 00       	or     $0x80,%eax
+  80355e:	00 00                	add    %al,(%rax)
+  803560:	de 0d 80 00 00 00    	fimuls 0x80(%rip)        # 8035e6 <error_string+0x6>
+  803566:	00 00                	add    %al,(%rax)
+  803568:	42 08 80 00 00 00 00 	rex.X or %al,0x0(%rax)
+  80356f:	00 de                	add    %bl,%dh
+  803571:	0d 80 00 00 00       	or     $0x80,%eax
+  803576:	00 00                	add    %al,(%rax)
+  803578:	de 0d 80 00 00 00    	fimuls 0x80(%rip)        # 8035fe <error_string+0x1e>
+  80357e:	00 00                	add    %al,(%rax)
+  803580:	c4                   	(bad)
+  803581:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803587:	00 8e 0c 80 00 00    	add    %cl,0x800c(%rsi)
+  80358d:	00 00                	add    %al,(%rax)
+  80358f:	00 de                	add    %bl,%dh
+  803591:	0d 80 00 00 00       	or     $0x80,%eax
+  803596:	00 00                	add    %al,(%rax)
+  803598:	de 0d 80 00 00 00    	fimuls 0x80(%rip)        # 80361e <error_string+0x3e>
+  80359e:	00 00                	add    %al,(%rax)
+  8035a0:	13 09                	adc    (%rcx),%ecx
+  8035a2:	80 00 00             	addb   $0x0,(%rax)
+  8035a5:	00 00                	add    %al,(%rax)
+  8035a7:	00 de                	add    %bl,%dh
+  8035a9:	0d 80 00 00 00       	or     $0x80,%eax
+  8035ae:	00 00                	add    %al,(%rax)
+  8035b0:	f0 0a 80 00 00 00 00 	lock or 0x0(%rax),%al
+  8035b7:	00 de                	add    %bl,%dh
+  8035b9:	0d 80 00 00 00       	or     $0x80,%eax
+  8035be:	00 00                	add    %al,(%rax)
+  8035c0:	de 0d 80 00 00 00    	fimuls 0x80(%rip)        # 803646 <error_string+0x66>
+  8035c6:	00 00                	add    %al,(%rax)
+  8035c8:	01 0d 80 00 00 00    	add    %ecx,0x80(%rip)        # 80364e <error_string+0x6e>
+  8035ce:	00 00                	add    %al,(%rax)
+  8035d0:	de 0d 80 00 00 00    	fimuls 0x80(%rip)        # 803656 <error_string+0x76>
+  8035d6:	00 00                	add    %al,(%rax)
+  8035d8:	a6                   	cmpsb  %es:(%rdi),%ds:(%rsi)
+  8035d9:	07                   	(bad)
+  8035da:	80 00 00             	addb   $0x0,(%rax)
+  8035dd:	00 00                	add    %al,(%rax)
+	...
+
+00000000008035e0 <error_string>:
+	...
+  8035e8:	7d 31 80 00 00 00 00 00 8f 31 80 00 00 00 00 00     }1.......1......
+  8035f8:	9f 31 80 00 00 00 00 00 b1 31 80 00 00 00 00 00     .1.......1......
+  803608:	bf 31 80 00 00 00 00 00 d3 31 80 00 00 00 00 00     .1.......1......
+  803618:	e8 31 80 00 00 00 00 00 fb 31 80 00 00 00 00 00     .1.......1......
+  803628:	0d 32 80 00 00 00 00 00 21 32 80 00 00 00 00 00     .2......!2......
+  803638:	31 32 80 00 00 00 00 00 44 32 80 00 00 00 00 00     12......D2......
+  803648:	5b 32 80 00 00 00 00 00 71 32 80 00 00 00 00 00     [2......q2......
+  803658:	89 32 80 00 00 00 00 00 a1 32 80 00 00 00 00 00     .2.......2......
+  803668:	ae 32 80 00 00 00 00 00 90 36 80 00 00 00 00 00     .2.......6......
+  803678:	c2 32 80 00 00 00 00 00 da 32 80 00 00 00 00 00     .2.......2......
+  803688:	f0 32 80 00 00 00 00 00 66 69 6c 65 20 69 73 20     .2......file is 
+  803698:	6e 6f 74 20 61 20 76 61 6c 69 64 20 65 78 65 63     not a valid exec
+  8036a8:	75 74 61 62 6c 65 00 72 65 61 64 20 65 72 72 6f     utable.read erro
+  8036b8:	72 3a 20 25 69 0a 00 90 73 79 73 63 61 6c 6c 20     r: %i...syscall 
+  8036c8:	25 7a 64 20 72 65 74 75 72 6e 65 64 20 25 7a 64     %zd returned %zd
+  8036d8:	20 28 3e 20 30 29 00 6c 69 62 2f 73 79 73 63 61      (> 0).lib/sysca
+  8036e8:	6c 6c 2e 63 00 0f 1f 00 5b 25 30 38 78 5d 20 75     ll.c....[%08x] u
+  8036f8:	6e 6b 6e 6f 77 6e 20 64 65 76 69 63 65 20 74 79     nknown device ty
+  803708:	70 65 20 25 64 0a 00 00 5b 25 30 38 78 5d 20 66     pe %d...[%08x] f
+  803718:	74 72 75 6e 63 61 74 65 20 25 64 20 2d 2d 20 62     truncate %d -- b
+  803728:	61 64 20 6d 6f 64 65 0a 00 5b 25 30 38 78 5d 20     ad mode..[%08x] 
+  803738:	72 65 61 64 20 25 64 20 2d 2d 20 62 61 64 20 6d     read %d -- bad m
+  803748:	6f 64 65 0a 00 5b 25 30 38 78 5d 20 77 72 69 74     ode..[%08x] writ
+  803758:	65 20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65     e %d -- bad mode
+  803768:	0a 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803778:	84 00 00 00 00 00 66 90                             ......f.
+
+0000000000803780 <devtab>:
+  803780:	40 40 80 00 00 00 00 00 80 40 80 00 00 00 00 00     @@.......@......
+  803790:	00 40 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .@..............
+  8037a0:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  8037b0:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  8037c0:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  8037d0:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  8037e0:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  8037f0:	3d 20 32 00 73 79 73 5f 69 70 63 5f 74 72 79 5f     = 2.sys_ipc_try_
+  803800:	73 65 6e 64 20 66 61 69 6c 65 64 3a 20 25 69 00     send failed: %i.
+  803810:	6c 69 62 2f 69 70 63 2e 63 00 66 2e 0f 1f 84 00     lib/ipc.c.f.....
+  803820:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803830:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803840:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803850:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803860:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803870:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803880:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803890:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8038a0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8038b0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8038c0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8038d0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8038e0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8038f0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803900:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803910:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803920:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803930:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803940:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803950:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803960:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803970:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803980:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803990:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8039a0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8039b0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8039c0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8039d0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8039e0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8039f0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803a00:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803a10:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803a20:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803a30:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803a40:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803a50:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803a60:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803a70:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803a80:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803a90:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803aa0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803ab0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803ac0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803ad0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803ae0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803af0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803b00:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803b10:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803b20:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803b30:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803b40:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803b50:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803b60:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803b70:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803b80:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803b90:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803ba0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803bb0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803bc0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803bd0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803be0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803bf0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803c00:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803c10:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803c20:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803c30:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803c40:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803c50:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803c60:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803c70:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803c80:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803c90:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803ca0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803cb0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803cc0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803cd0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803ce0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803cf0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803d00:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803d10:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803d20:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803d30:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803d40:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803d50:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803d60:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803d70:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803d80:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803d90:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803da0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803db0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803dc0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803dd0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803de0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803df0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803e00:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803e10:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803e20:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803e30:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803e40:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803e50:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803e60:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803e70:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803e80:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803e90:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803ea0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803eb0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803ec0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803ed0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803ee0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803ef0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803f00:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803f10:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803f20:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803f30:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803f40:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803f50:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803f60:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803f70:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803f80:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803f90:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803fa0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803fb0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803fc0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803fd0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803fe0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803ff0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 90     ....f.........f.
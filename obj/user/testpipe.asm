@@ -0,0 +1,6365 @@
+
+obj/user/testpipe:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 85 04 00 00       	call   8004a8 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+#include <inc/lib.h>
+
+char *msg = "Now is the time for all good men to come to the aid of their party.";
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 57                	push   %r15
+  80002b:	41 56                	push   %r14
+  80002d:	41 55                	push   %r13
+  80002f:	41 54                	push   %r12
+  800031:	53                   	push   %rbx
+  800032:	48 83 ec 78          	sub    $0x78,%rsp
+    char buf[100];
+    int i, pid, p[2];
+
+    binaryname = "pipereadeof";
+  800036:	48 b8 10 33 80 00 00 	movabs $0x803310,%rax
+  80003d:	00 00 00 
+  800040:	48 a3 08 40 80 00 00 	movabs %rax,0x804008
+  800047:	00 00 00 
+
+    if ((i = pipe(p)) < 0)
+  80004a:	48 8d bd 64 ff ff ff 	lea    -0x9c(%rbp),%rdi
+  800051:	48 b8 66 29 80 00 00 	movabs $0x802966,%rax
+  800058:	00 00 00 
+  80005b:	ff d0                	call   *%rax
+  80005d:	41 89 c4             	mov    %eax,%r12d
+  800060:	85 c0                	test   %eax,%eax
+  800062:	0f 88 b3 01 00 00    	js     80021b <umain+0x1f6>
+        panic("pipe: %i", i);
+
+    if ((pid = fork()) < 0)
+  800068:	48 b8 d4 19 80 00 00 	movabs $0x8019d4,%rax
+  80006f:	00 00 00 
+  800072:	ff d0                	call   *%rax
+  800074:	89 c3                	mov    %eax,%ebx
+  800076:	85 c0                	test   %eax,%eax
+  800078:	0f 88 ca 01 00 00    	js     800248 <umain+0x223>
+        panic("fork: %i", i);
+
+    if (pid == 0) {
+  80007e:	0f 85 49 02 00 00    	jne    8002cd <umain+0x2a8>
+        cprintf("[%08x] pipereadeof close %d\n", thisenv->env_id, p[1]);
+  800084:	49 bd 00 50 80 00 00 	movabs $0x805000,%r13
+  80008b:	00 00 00 
+  80008e:	49 8b 45 00          	mov    0x0(%r13),%rax
+  800092:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+  800098:	8b 95 68 ff ff ff    	mov    -0x98(%rbp),%edx
+  80009e:	48 bf 3e 33 80 00 00 	movabs $0x80333e,%rdi
+  8000a5:	00 00 00 
+  8000a8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000ad:	49 bc c4 06 80 00 00 	movabs $0x8006c4,%r12
+  8000b4:	00 00 00 
+  8000b7:	41 ff d4             	call   *%r12
+        close(p[1]);
+  8000ba:	8b bd 68 ff ff ff    	mov    -0x98(%rbp),%edi
+  8000c0:	48 b8 5e 1d 80 00 00 	movabs $0x801d5e,%rax
+  8000c7:	00 00 00 
+  8000ca:	ff d0                	call   *%rax
+        cprintf("[%08x] pipereadeof readn %d\n", thisenv->env_id, p[0]);
+  8000cc:	49 8b 45 00          	mov    0x0(%r13),%rax
+  8000d0:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+  8000d6:	8b 95 64 ff ff ff    	mov    -0x9c(%rbp),%edx
+  8000dc:	48 bf 5b 33 80 00 00 	movabs $0x80335b,%rdi
+  8000e3:	00 00 00 
+  8000e6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000eb:	41 ff d4             	call   *%r12
+        i = readn(p[0], buf, sizeof buf - 1);
+  8000ee:	ba 63 00 00 00       	mov    $0x63,%edx
+  8000f3:	48 8d b5 6c ff ff ff 	lea    -0x94(%rbp),%rsi
+  8000fa:	8b bd 64 ff ff ff    	mov    -0x9c(%rbp),%edi
+  800100:	48 b8 9a 1f 80 00 00 	movabs $0x801f9a,%rax
+  800107:	00 00 00 
+  80010a:	ff d0                	call   *%rax
+  80010c:	41 89 c4             	mov    %eax,%r12d
+        if (i < 0)
+  80010f:	85 c0                	test   %eax,%eax
+  800111:	0f 88 5f 01 00 00    	js     800276 <umain+0x251>
+            panic("read: %i", i);
+        buf[i] = 0;
+  800117:	48 98                	cltq
+  800119:	c6 84 05 6c ff ff ff 	movb   $0x0,-0x94(%rbp,%rax,1)
+  800120:	00 
+        if (strcmp(buf, msg) == 0)
+  800121:	48 b8 00 40 80 00 00 	movabs $0x804000,%rax
+  800128:	00 00 00 
+  80012b:	48 8b 30             	mov    (%rax),%rsi
+  80012e:	48 8d bd 6c ff ff ff 	lea    -0x94(%rbp),%rdi
+  800135:	48 b8 8d 10 80 00 00 	movabs $0x80108d,%rax
+  80013c:	00 00 00 
+  80013f:	ff d0                	call   *%rax
+  800141:	85 c0                	test   %eax,%eax
+  800143:	0f 85 5a 01 00 00    	jne    8002a3 <umain+0x27e>
+            cprintf("\npipe read closed properly\n");
+  800149:	48 bf 81 33 80 00 00 	movabs $0x803381,%rdi
+  800150:	00 00 00 
+  800153:	48 ba c4 06 80 00 00 	movabs $0x8006c4,%rdx
+  80015a:	00 00 00 
+  80015d:	ff d2                	call   *%rdx
+        else
+            cprintf("\ngot %d bytes: %s\n", i, buf);
+        exit();
+  80015f:	48 b8 51 05 80 00 00 	movabs $0x800551,%rax
+  800166:	00 00 00 
+  800169:	ff d0                	call   *%rax
+        cprintf("[%08x] pipereadeof write %d\n", thisenv->env_id, p[1]);
+        if ((i = write(p[1], msg, strlen(msg))) != strlen(msg))
+            panic("write: %i", i);
+        close(p[1]);
+    }
+    wait(pid);
+  80016b:	89 df                	mov    %ebx,%edi
+  80016d:	48 b8 bb 2b 80 00 00 	movabs $0x802bbb,%rax
+  800174:	00 00 00 
+  800177:	ff d0                	call   *%rax
+
+    binaryname = "pipewriteeof";
+  800179:	48 b8 d7 33 80 00 00 	movabs $0x8033d7,%rax
+  800180:	00 00 00 
+  800183:	48 a3 08 40 80 00 00 	movabs %rax,0x804008
+  80018a:	00 00 00 
+    if ((i = pipe(p)) < 0)
+  80018d:	48 8d bd 64 ff ff ff 	lea    -0x9c(%rbp),%rdi
+  800194:	48 b8 66 29 80 00 00 	movabs $0x802966,%rax
+  80019b:	00 00 00 
+  80019e:	ff d0                	call   *%rax
+  8001a0:	41 89 c4             	mov    %eax,%r12d
+  8001a3:	85 c0                	test   %eax,%eax
+  8001a5:	0f 88 1a 02 00 00    	js     8003c5 <umain+0x3a0>
+        panic("pipe: %i", i);
+
+    if ((pid = fork()) < 0)
+  8001ab:	48 b8 d4 19 80 00 00 	movabs $0x8019d4,%rax
+  8001b2:	00 00 00 
+  8001b5:	ff d0                	call   *%rax
+  8001b7:	89 c3                	mov    %eax,%ebx
+  8001b9:	85 c0                	test   %eax,%eax
+  8001bb:	0f 88 31 02 00 00    	js     8003f2 <umain+0x3cd>
+        panic("fork: %i", i);
+
+    if (pid == 0) {
+  8001c1:	0f 84 59 02 00 00    	je     800420 <umain+0x3fb>
+                break;
+        }
+        cprintf("\npipe write closed properly\n");
+        exit();
+    }
+    close(p[0]);
+  8001c7:	8b bd 64 ff ff ff    	mov    -0x9c(%rbp),%edi
+  8001cd:	49 bc 5e 1d 80 00 00 	movabs $0x801d5e,%r12
+  8001d4:	00 00 00 
+  8001d7:	41 ff d4             	call   *%r12
+    close(p[1]);
+  8001da:	8b bd 68 ff ff ff    	mov    -0x98(%rbp),%edi
+  8001e0:	41 ff d4             	call   *%r12
+    wait(pid);
+  8001e3:	89 df                	mov    %ebx,%edi
+  8001e5:	48 b8 bb 2b 80 00 00 	movabs $0x802bbb,%rax
+  8001ec:	00 00 00 
+  8001ef:	ff d0                	call   *%rax
+
+    cprintf("pipe tests passed\n");
+  8001f1:	48 bf 05 34 80 00 00 	movabs $0x803405,%rdi
+  8001f8:	00 00 00 
+  8001fb:	b8 00 00 00 00       	mov    $0x0,%eax
+  800200:	48 ba c4 06 80 00 00 	movabs $0x8006c4,%rdx
+  800207:	00 00 00 
+  80020a:	ff d2                	call   *%rdx
+}
+  80020c:	48 83 c4 78          	add    $0x78,%rsp
+  800210:	5b                   	pop    %rbx
+  800211:	41 5c                	pop    %r12
+  800213:	41 5d                	pop    %r13
+  800215:	41 5e                	pop    %r14
+  800217:	41 5f                	pop    %r15
+  800219:	5d                   	pop    %rbp
+  80021a:	c3                   	ret
+        panic("pipe: %i", i);
+  80021b:	89 c1                	mov    %eax,%ecx
+  80021d:	48 ba 1c 33 80 00 00 	movabs $0x80331c,%rdx
+  800224:	00 00 00 
+  800227:	be 0d 00 00 00       	mov    $0xd,%esi
+  80022c:	48 bf 25 33 80 00 00 	movabs $0x803325,%rdi
+  800233:	00 00 00 
+  800236:	b8 00 00 00 00       	mov    $0x0,%eax
+  80023b:	49 b8 74 05 80 00 00 	movabs $0x800574,%r8
+  800242:	00 00 00 
+  800245:	41 ff d0             	call   *%r8
+        panic("fork: %i", i);
+  800248:	44 89 e1             	mov    %r12d,%ecx
+  80024b:	48 ba 35 33 80 00 00 	movabs $0x803335,%rdx
+  800252:	00 00 00 
+  800255:	be 10 00 00 00       	mov    $0x10,%esi
+  80025a:	48 bf 25 33 80 00 00 	movabs $0x803325,%rdi
+  800261:	00 00 00 
+  800264:	b8 00 00 00 00       	mov    $0x0,%eax
+  800269:	49 b8 74 05 80 00 00 	movabs $0x800574,%r8
+  800270:	00 00 00 
+  800273:	41 ff d0             	call   *%r8
+            panic("read: %i", i);
+  800276:	89 c1                	mov    %eax,%ecx
+  800278:	48 ba 78 33 80 00 00 	movabs $0x803378,%rdx
+  80027f:	00 00 00 
+  800282:	be 18 00 00 00       	mov    $0x18,%esi
+  800287:	48 bf 25 33 80 00 00 	movabs $0x803325,%rdi
+  80028e:	00 00 00 
+  800291:	b8 00 00 00 00       	mov    $0x0,%eax
+  800296:	49 b8 74 05 80 00 00 	movabs $0x800574,%r8
+  80029d:	00 00 00 
+  8002a0:	41 ff d0             	call   *%r8
+            cprintf("\ngot %d bytes: %s\n", i, buf);
+  8002a3:	48 8d 95 6c ff ff ff 	lea    -0x94(%rbp),%rdx
+  8002aa:	44 89 e6             	mov    %r12d,%esi
+  8002ad:	48 bf 9d 33 80 00 00 	movabs $0x80339d,%rdi
+  8002b4:	00 00 00 
+  8002b7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002bc:	48 b9 c4 06 80 00 00 	movabs $0x8006c4,%rcx
+  8002c3:	00 00 00 
+  8002c6:	ff d1                	call   *%rcx
+  8002c8:	e9 92 fe ff ff       	jmp    80015f <umain+0x13a>
+        cprintf("[%08x] pipereadeof close %d\n", thisenv->env_id, p[0]);
+  8002cd:	49 bd 00 50 80 00 00 	movabs $0x805000,%r13
+  8002d4:	00 00 00 
+  8002d7:	49 8b 45 00          	mov    0x0(%r13),%rax
+  8002db:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+  8002e1:	8b 95 64 ff ff ff    	mov    -0x9c(%rbp),%edx
+  8002e7:	48 bf 3e 33 80 00 00 	movabs $0x80333e,%rdi
+  8002ee:	00 00 00 
+  8002f1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002f6:	49 bc c4 06 80 00 00 	movabs $0x8006c4,%r12
+  8002fd:	00 00 00 
+  800300:	41 ff d4             	call   *%r12
+        close(p[0]);
+  800303:	8b bd 64 ff ff ff    	mov    -0x9c(%rbp),%edi
+  800309:	48 b8 5e 1d 80 00 00 	movabs $0x801d5e,%rax
+  800310:	00 00 00 
+  800313:	ff d0                	call   *%rax
+        cprintf("[%08x] pipereadeof write %d\n", thisenv->env_id, p[1]);
+  800315:	49 8b 45 00          	mov    0x0(%r13),%rax
+  800319:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+  80031f:	8b 95 68 ff ff ff    	mov    -0x98(%rbp),%edx
+  800325:	48 bf b0 33 80 00 00 	movabs $0x8033b0,%rdi
+  80032c:	00 00 00 
+  80032f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800334:	41 ff d4             	call   *%r12
+        if ((i = write(p[1], msg, strlen(msg))) != strlen(msg))
+  800337:	49 bd 00 40 80 00 00 	movabs $0x804000,%r13
+  80033e:	00 00 00 
+  800341:	49 8b 7d 00          	mov    0x0(%r13),%rdi
+  800345:	49 bf ab 0f 80 00 00 	movabs $0x800fab,%r15
+  80034c:	00 00 00 
+  80034f:	41 ff d7             	call   *%r15
+  800352:	48 89 c2             	mov    %rax,%rdx
+  800355:	49 8b 75 00          	mov    0x0(%r13),%rsi
+  800359:	8b bd 68 ff ff ff    	mov    -0x98(%rbp),%edi
+  80035f:	48 b8 0b 20 80 00 00 	movabs $0x80200b,%rax
+  800366:	00 00 00 
+  800369:	ff d0                	call   *%rax
+  80036b:	49 89 c4             	mov    %rax,%r12
+  80036e:	41 89 c6             	mov    %eax,%r14d
+  800371:	49 8b 7d 00          	mov    0x0(%r13),%rdi
+  800375:	41 ff d7             	call   *%r15
+  800378:	4d 63 e4             	movslq %r12d,%r12
+  80037b:	49 39 c4             	cmp    %rax,%r12
+  80037e:	75 17                	jne    800397 <umain+0x372>
+        close(p[1]);
+  800380:	8b bd 68 ff ff ff    	mov    -0x98(%rbp),%edi
+  800386:	48 b8 5e 1d 80 00 00 	movabs $0x801d5e,%rax
+  80038d:	00 00 00 
+  800390:	ff d0                	call   *%rax
+  800392:	e9 d4 fd ff ff       	jmp    80016b <umain+0x146>
+            panic("write: %i", i);
+  800397:	44 89 f1             	mov    %r14d,%ecx
+  80039a:	48 ba cd 33 80 00 00 	movabs $0x8033cd,%rdx
+  8003a1:	00 00 00 
+  8003a4:	be 24 00 00 00       	mov    $0x24,%esi
+  8003a9:	48 bf 25 33 80 00 00 	movabs $0x803325,%rdi
+  8003b0:	00 00 00 
+  8003b3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003b8:	49 b8 74 05 80 00 00 	movabs $0x800574,%r8
+  8003bf:	00 00 00 
+  8003c2:	41 ff d0             	call   *%r8
+        panic("pipe: %i", i);
+  8003c5:	89 c1                	mov    %eax,%ecx
+  8003c7:	48 ba 1c 33 80 00 00 	movabs $0x80331c,%rdx
+  8003ce:	00 00 00 
+  8003d1:	be 2b 00 00 00       	mov    $0x2b,%esi
+  8003d6:	48 bf 25 33 80 00 00 	movabs $0x803325,%rdi
+  8003dd:	00 00 00 
+  8003e0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003e5:	49 b8 74 05 80 00 00 	movabs $0x800574,%r8
+  8003ec:	00 00 00 
+  8003ef:	41 ff d0             	call   *%r8
+        panic("fork: %i", i);
+  8003f2:	44 89 e1             	mov    %r12d,%ecx
+  8003f5:	48 ba 35 33 80 00 00 	movabs $0x803335,%rdx
+  8003fc:	00 00 00 
+  8003ff:	be 2e 00 00 00       	mov    $0x2e,%esi
+  800404:	48 bf 25 33 80 00 00 	movabs $0x803325,%rdi
+  80040b:	00 00 00 
+  80040e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800413:	49 b8 74 05 80 00 00 	movabs $0x800574,%r8
+  80041a:	00 00 00 
+  80041d:	41 ff d0             	call   *%r8
+        close(p[0]);
+  800420:	8b bd 64 ff ff ff    	mov    -0x9c(%rbp),%edi
+  800426:	48 b8 5e 1d 80 00 00 	movabs $0x801d5e,%rax
+  80042d:	00 00 00 
+  800430:	ff d0                	call   *%rax
+            cprintf(".");
+  800432:	49 bf e4 33 80 00 00 	movabs $0x8033e4,%r15
+  800439:	00 00 00 
+  80043c:	49 be c4 06 80 00 00 	movabs $0x8006c4,%r14
+  800443:	00 00 00 
+            if (write(p[1], "x", 1) != 1)
+  800446:	49 bd e6 33 80 00 00 	movabs $0x8033e6,%r13
+  80044d:	00 00 00 
+  800450:	49 bc 0b 20 80 00 00 	movabs $0x80200b,%r12
+  800457:	00 00 00 
+            cprintf(".");
+  80045a:	4c 89 ff             	mov    %r15,%rdi
+  80045d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800462:	41 ff d6             	call   *%r14
+            if (write(p[1], "x", 1) != 1)
+  800465:	ba 01 00 00 00       	mov    $0x1,%edx
+  80046a:	4c 89 ee             	mov    %r13,%rsi
+  80046d:	8b bd 68 ff ff ff    	mov    -0x98(%rbp),%edi
+  800473:	41 ff d4             	call   *%r12
+  800476:	48 83 f8 01          	cmp    $0x1,%rax
+  80047a:	74 de                	je     80045a <umain+0x435>
+        cprintf("\npipe write closed properly\n");
+  80047c:	48 bf e8 33 80 00 00 	movabs $0x8033e8,%rdi
+  800483:	00 00 00 
+  800486:	b8 00 00 00 00       	mov    $0x0,%eax
+  80048b:	48 ba c4 06 80 00 00 	movabs $0x8006c4,%rdx
+  800492:	00 00 00 
+  800495:	ff d2                	call   *%rdx
+        exit();
+  800497:	48 b8 51 05 80 00 00 	movabs $0x800551,%rax
+  80049e:	00 00 00 
+  8004a1:	ff d0                	call   *%rax
+  8004a3:	e9 1f fd ff ff       	jmp    8001c7 <umain+0x1a2>
+
+00000000008004a8 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  8004a8:	55                   	push   %rbp
+  8004a9:	48 89 e5             	mov    %rsp,%rbp
+  8004ac:	41 56                	push   %r14
+  8004ae:	41 55                	push   %r13
+  8004b0:	41 54                	push   %r12
+  8004b2:	53                   	push   %rbx
+  8004b3:	41 89 fd             	mov    %edi,%r13d
+  8004b6:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  8004b9:	48 ba d8 40 80 00 00 	movabs $0x8040d8,%rdx
+  8004c0:	00 00 00 
+  8004c3:	48 b8 d8 40 80 00 00 	movabs $0x8040d8,%rax
+  8004ca:	00 00 00 
+  8004cd:	48 39 c2             	cmp    %rax,%rdx
+  8004d0:	73 17                	jae    8004e9 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  8004d2:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  8004d5:	49 89 c4             	mov    %rax,%r12
+  8004d8:	48 83 c3 08          	add    $0x8,%rbx
+  8004dc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004e1:	ff 53 f8             	call   *-0x8(%rbx)
+  8004e4:	4c 39 e3             	cmp    %r12,%rbx
+  8004e7:	72 ef                	jb     8004d8 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+    envid_t this_env_id = sys_getenvid();
+  8004e9:	48 b8 d9 14 80 00 00 	movabs $0x8014d9,%rax
+  8004f0:	00 00 00 
+  8004f3:	ff d0                	call   *%rax
+    thisenv = &((struct Env*)UENVS)[ENVX(this_env_id)];
+  8004f5:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8004fa:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+  800501:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  800508:	00 00 00 
+  80050b:	48 01 d0             	add    %rdx,%rax
+  80050e:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  800515:	00 00 00 
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  800518:	45 85 ed             	test   %r13d,%r13d
+  80051b:	7e 0d                	jle    80052a <libmain+0x82>
+  80051d:	49 8b 06             	mov    (%r14),%rax
+  800520:	48 a3 08 40 80 00 00 	movabs %rax,0x804008
+  800527:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  80052a:	4c 89 f6             	mov    %r14,%rsi
+  80052d:	44 89 ef             	mov    %r13d,%edi
+  800530:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  800537:	00 00 00 
+  80053a:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  80053c:	48 b8 51 05 80 00 00 	movabs $0x800551,%rax
+  800543:	00 00 00 
+  800546:	ff d0                	call   *%rax
+#endif
+}
+  800548:	5b                   	pop    %rbx
+  800549:	41 5c                	pop    %r12
+  80054b:	41 5d                	pop    %r13
+  80054d:	41 5e                	pop    %r14
+  80054f:	5d                   	pop    %rbp
+  800550:	c3                   	ret
+
+0000000000800551 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  800551:	55                   	push   %rbp
+  800552:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  800555:	48 b8 91 1d 80 00 00 	movabs $0x801d91,%rax
+  80055c:	00 00 00 
+  80055f:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  800561:	bf 00 00 00 00       	mov    $0x0,%edi
+  800566:	48 b8 6e 14 80 00 00 	movabs $0x80146e,%rax
+  80056d:	00 00 00 
+  800570:	ff d0                	call   *%rax
+}
+  800572:	5d                   	pop    %rbp
+  800573:	c3                   	ret
+
+0000000000800574 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  800574:	55                   	push   %rbp
+  800575:	48 89 e5             	mov    %rsp,%rbp
+  800578:	41 56                	push   %r14
+  80057a:	41 55                	push   %r13
+  80057c:	41 54                	push   %r12
+  80057e:	53                   	push   %rbx
+  80057f:	48 83 ec 50          	sub    $0x50,%rsp
+  800583:	49 89 fc             	mov    %rdi,%r12
+  800586:	41 89 f5             	mov    %esi,%r13d
+  800589:	48 89 d3             	mov    %rdx,%rbx
+  80058c:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  800590:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  800594:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800598:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  80059f:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8005a3:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  8005a7:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  8005ab:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  8005af:	48 b8 08 40 80 00 00 	movabs $0x804008,%rax
+  8005b6:	00 00 00 
+  8005b9:	4c 8b 30             	mov    (%rax),%r14
+  8005bc:	48 b8 d9 14 80 00 00 	movabs $0x8014d9,%rax
+  8005c3:	00 00 00 
+  8005c6:	ff d0                	call   *%rax
+  8005c8:	89 c6                	mov    %eax,%esi
+  8005ca:	45 89 e8             	mov    %r13d,%r8d
+  8005cd:	4c 89 e1             	mov    %r12,%rcx
+  8005d0:	4c 89 f2             	mov    %r14,%rdx
+  8005d3:	48 bf 68 34 80 00 00 	movabs $0x803468,%rdi
+  8005da:	00 00 00 
+  8005dd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005e2:	49 bc c4 06 80 00 00 	movabs $0x8006c4,%r12
+  8005e9:	00 00 00 
+  8005ec:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  8005ef:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  8005f3:	48 89 df             	mov    %rbx,%rdi
+  8005f6:	48 b8 60 06 80 00 00 	movabs $0x800660,%rax
+  8005fd:	00 00 00 
+  800600:	ff d0                	call   *%rax
+    cprintf("\n");
+  800602:	48 bf 59 33 80 00 00 	movabs $0x803359,%rdi
+  800609:	00 00 00 
+  80060c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800611:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  800614:	cc                   	int3
+  800615:	eb fd                	jmp    800614 <_panic+0xa0>
+
+0000000000800617 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  800617:	55                   	push   %rbp
+  800618:	48 89 e5             	mov    %rsp,%rbp
+  80061b:	53                   	push   %rbx
+  80061c:	48 83 ec 08          	sub    $0x8,%rsp
+  800620:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  800623:	8b 06                	mov    (%rsi),%eax
+  800625:	8d 50 01             	lea    0x1(%rax),%edx
+  800628:	89 16                	mov    %edx,(%rsi)
+  80062a:	48 98                	cltq
+  80062c:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  800631:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  800637:	74 0a                	je     800643 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  800639:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  80063d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800641:	c9                   	leave
+  800642:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  800643:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  800647:	be ff 00 00 00       	mov    $0xff,%esi
+  80064c:	48 b8 10 14 80 00 00 	movabs $0x801410,%rax
+  800653:	00 00 00 
+  800656:	ff d0                	call   *%rax
+        state->offset = 0;
+  800658:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  80065e:	eb d9                	jmp    800639 <putch+0x22>
+
+0000000000800660 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  800660:	55                   	push   %rbp
+  800661:	48 89 e5             	mov    %rsp,%rbp
+  800664:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  80066b:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  80066e:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  800675:	b9 21 00 00 00       	mov    $0x21,%ecx
+  80067a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80067f:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  800682:	48 89 f1             	mov    %rsi,%rcx
+  800685:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  80068c:	48 bf 17 06 80 00 00 	movabs $0x800617,%rdi
+  800693:	00 00 00 
+  800696:	48 b8 14 08 80 00 00 	movabs $0x800814,%rax
+  80069d:	00 00 00 
+  8006a0:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  8006a2:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  8006a9:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  8006b0:	48 b8 10 14 80 00 00 	movabs $0x801410,%rax
+  8006b7:	00 00 00 
+  8006ba:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  8006bc:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  8006c2:	c9                   	leave
+  8006c3:	c3                   	ret
+
+00000000008006c4 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  8006c4:	55                   	push   %rbp
+  8006c5:	48 89 e5             	mov    %rsp,%rbp
+  8006c8:	48 83 ec 50          	sub    $0x50,%rsp
+  8006cc:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8006d0:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8006d4:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8006d8:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8006dc:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  8006e0:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  8006e7:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8006eb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006ef:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8006f3:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  8006f7:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  8006fb:	48 b8 60 06 80 00 00 	movabs $0x800660,%rax
+  800702:	00 00 00 
+  800705:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  800707:	c9                   	leave
+  800708:	c3                   	ret
+
+0000000000800709 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  800709:	55                   	push   %rbp
+  80070a:	48 89 e5             	mov    %rsp,%rbp
+  80070d:	41 57                	push   %r15
+  80070f:	41 56                	push   %r14
+  800711:	41 55                	push   %r13
+  800713:	41 54                	push   %r12
+  800715:	53                   	push   %rbx
+  800716:	48 83 ec 18          	sub    $0x18,%rsp
+  80071a:	49 89 fc             	mov    %rdi,%r12
+  80071d:	49 89 f5             	mov    %rsi,%r13
+  800720:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800724:	8b 45 10             	mov    0x10(%rbp),%eax
+  800727:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  80072a:	41 89 cf             	mov    %ecx,%r15d
+  80072d:	4c 39 fa             	cmp    %r15,%rdx
+  800730:	73 5b                	jae    80078d <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  800732:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  800736:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  80073a:	85 db                	test   %ebx,%ebx
+  80073c:	7e 0e                	jle    80074c <print_num+0x43>
+            putch(padc, put_arg);
+  80073e:	4c 89 ee             	mov    %r13,%rsi
+  800741:	44 89 f7             	mov    %r14d,%edi
+  800744:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  800747:	83 eb 01             	sub    $0x1,%ebx
+  80074a:	75 f2                	jne    80073e <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  80074c:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  800750:	48 b9 9c 34 80 00 00 	movabs $0x80349c,%rcx
+  800757:	00 00 00 
+  80075a:	48 b8 8b 34 80 00 00 	movabs $0x80348b,%rax
+  800761:	00 00 00 
+  800764:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  800768:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80076c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800771:	49 f7 f7             	div    %r15
+  800774:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  800778:	4c 89 ee             	mov    %r13,%rsi
+  80077b:	41 ff d4             	call   *%r12
+}
+  80077e:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800782:	5b                   	pop    %rbx
+  800783:	41 5c                	pop    %r12
+  800785:	41 5d                	pop    %r13
+  800787:	41 5e                	pop    %r14
+  800789:	41 5f                	pop    %r15
+  80078b:	5d                   	pop    %rbp
+  80078c:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  80078d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800791:	ba 00 00 00 00       	mov    $0x0,%edx
+  800796:	49 f7 f7             	div    %r15
+  800799:	48 83 ec 08          	sub    $0x8,%rsp
+  80079d:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  8007a1:	52                   	push   %rdx
+  8007a2:	45 0f be c9          	movsbl %r9b,%r9d
+  8007a6:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  8007aa:	48 89 c2             	mov    %rax,%rdx
+  8007ad:	48 b8 09 07 80 00 00 	movabs $0x800709,%rax
+  8007b4:	00 00 00 
+  8007b7:	ff d0                	call   *%rax
+  8007b9:	48 83 c4 10          	add    $0x10,%rsp
+  8007bd:	eb 8d                	jmp    80074c <print_num+0x43>
+
+00000000008007bf <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  8007bf:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  8007c3:	48 8b 06             	mov    (%rsi),%rax
+  8007c6:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  8007ca:	73 0a                	jae    8007d6 <sprintputch+0x17>
+        *state->start++ = ch;
+  8007cc:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8007d0:	48 89 16             	mov    %rdx,(%rsi)
+  8007d3:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  8007d6:	c3                   	ret
+
+00000000008007d7 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  8007d7:	55                   	push   %rbp
+  8007d8:	48 89 e5             	mov    %rsp,%rbp
+  8007db:	48 83 ec 50          	sub    $0x50,%rsp
+  8007df:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8007e3:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8007e7:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  8007eb:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8007f2:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8007f6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007fa:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8007fe:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  800802:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800806:	48 b8 14 08 80 00 00 	movabs $0x800814,%rax
+  80080d:	00 00 00 
+  800810:	ff d0                	call   *%rax
+}
+  800812:	c9                   	leave
+  800813:	c3                   	ret
+
+0000000000800814 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  800814:	55                   	push   %rbp
+  800815:	48 89 e5             	mov    %rsp,%rbp
+  800818:	41 57                	push   %r15
+  80081a:	41 56                	push   %r14
+  80081c:	41 55                	push   %r13
+  80081e:	41 54                	push   %r12
+  800820:	53                   	push   %rbx
+  800821:	48 83 ec 38          	sub    $0x38,%rsp
+  800825:	49 89 fe             	mov    %rdi,%r14
+  800828:	49 89 f5             	mov    %rsi,%r13
+  80082b:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  80082e:	48 8b 01             	mov    (%rcx),%rax
+  800831:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  800835:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800839:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80083d:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  800841:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  800845:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  800849:	0f b6 3b             	movzbl (%rbx),%edi
+  80084c:	40 80 ff 25          	cmp    $0x25,%dil
+  800850:	74 18                	je     80086a <vprintfmt+0x56>
+            if (!ch) return;
+  800852:	40 84 ff             	test   %dil,%dil
+  800855:	0f 84 b1 06 00 00    	je     800f0c <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  80085b:	40 0f b6 ff          	movzbl %dil,%edi
+  80085f:	4c 89 ee             	mov    %r13,%rsi
+  800862:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  800865:	4c 89 e3             	mov    %r12,%rbx
+  800868:	eb db                	jmp    800845 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  80086a:	be 00 00 00 00       	mov    $0x0,%esi
+  80086f:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  800873:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  800878:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  80087e:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  800885:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800889:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  80088e:	41 0f b6 04 24       	movzbl (%r12),%eax
+  800893:	88 45 a0             	mov    %al,-0x60(%rbp)
+  800896:	83 e8 23             	sub    $0x23,%eax
+  800899:	3c 57                	cmp    $0x57,%al
+  80089b:	0f 87 51 06 00 00    	ja     800ef2 <vprintfmt+0x6de>
+  8008a1:	0f b6 c0             	movzbl %al,%eax
+  8008a4:	48 b9 60 36 80 00 00 	movabs $0x803660,%rcx
+  8008ab:	00 00 00 
+  8008ae:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  8008b1:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  8008b4:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  8008b8:	eb cf                	jmp    800889 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  8008ba:	49 89 dc             	mov    %rbx,%r12
+  8008bd:	be 01 00 00 00       	mov    $0x1,%esi
+  8008c2:	eb c5                	jmp    800889 <vprintfmt+0x75>
+            padc = ch;
+  8008c4:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  8008c8:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8008cb:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8008ce:	eb b9                	jmp    800889 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8008d0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008d3:	83 f8 2f             	cmp    $0x2f,%eax
+  8008d6:	77 24                	ja     8008fc <vprintfmt+0xe8>
+  8008d8:	89 c1                	mov    %eax,%ecx
+  8008da:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  8008de:	83 c0 08             	add    $0x8,%eax
+  8008e1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008e4:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  8008e7:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  8008ea:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8008ee:	79 99                	jns    800889 <vprintfmt+0x75>
+                width = precision;
+  8008f0:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  8008f4:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8008fa:	eb 8d                	jmp    800889 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8008fc:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  800900:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  800904:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800908:	eb da                	jmp    8008e4 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  80090a:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  80090f:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800913:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  800919:	3c 39                	cmp    $0x39,%al
+  80091b:	77 1c                	ja     800939 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  80091d:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  800921:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  800925:	0f b6 c0             	movzbl %al,%eax
+  800928:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  80092d:	0f b6 03             	movzbl (%rbx),%eax
+  800930:	3c 39                	cmp    $0x39,%al
+  800932:	76 e9                	jbe    80091d <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  800934:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  800937:	eb b1                	jmp    8008ea <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  800939:	49 89 dc             	mov    %rbx,%r12
+  80093c:	eb ac                	jmp    8008ea <vprintfmt+0xd6>
+            width = MAX(0, width);
+  80093e:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  800941:	85 c9                	test   %ecx,%ecx
+  800943:	b8 00 00 00 00       	mov    $0x0,%eax
+  800948:	0f 49 c1             	cmovns %ecx,%eax
+  80094b:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  80094e:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800951:	e9 33 ff ff ff       	jmp    800889 <vprintfmt+0x75>
+            lflag++;
+  800956:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  800959:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80095c:	e9 28 ff ff ff       	jmp    800889 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  800961:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800964:	83 f8 2f             	cmp    $0x2f,%eax
+  800967:	77 19                	ja     800982 <vprintfmt+0x16e>
+  800969:	89 c2                	mov    %eax,%edx
+  80096b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80096f:	83 c0 08             	add    $0x8,%eax
+  800972:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800975:	8b 3a                	mov    (%rdx),%edi
+  800977:	4c 89 ee             	mov    %r13,%rsi
+  80097a:	41 ff d6             	call   *%r14
+            break;
+  80097d:	e9 c3 fe ff ff       	jmp    800845 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  800982:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800986:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80098a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80098e:	eb e5                	jmp    800975 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  800990:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800993:	83 f8 2f             	cmp    $0x2f,%eax
+  800996:	77 5a                	ja     8009f2 <vprintfmt+0x1de>
+  800998:	89 c2                	mov    %eax,%edx
+  80099a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80099e:	83 c0 08             	add    $0x8,%eax
+  8009a1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  8009a4:	8b 02                	mov    (%rdx),%eax
+  8009a6:	89 c1                	mov    %eax,%ecx
+  8009a8:	f7 d9                	neg    %ecx
+  8009aa:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  8009ad:	83 f9 15             	cmp    $0x15,%ecx
+  8009b0:	7f 4e                	jg     800a00 <vprintfmt+0x1ec>
+  8009b2:	48 63 c1             	movslq %ecx,%rax
+  8009b5:	48 ba 20 39 80 00 00 	movabs $0x803920,%rdx
+  8009bc:	00 00 00 
+  8009bf:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8009c3:	48 85 c0             	test   %rax,%rax
+  8009c6:	74 38                	je     800a00 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  8009c8:	48 89 c1             	mov    %rax,%rcx
+  8009cb:	48 ba 19 3b 80 00 00 	movabs $0x803b19,%rdx
+  8009d2:	00 00 00 
+  8009d5:	4c 89 ee             	mov    %r13,%rsi
+  8009d8:	4c 89 f7             	mov    %r14,%rdi
+  8009db:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009e0:	49 b8 d7 07 80 00 00 	movabs $0x8007d7,%r8
+  8009e7:	00 00 00 
+  8009ea:	41 ff d0             	call   *%r8
+  8009ed:	e9 53 fe ff ff       	jmp    800845 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  8009f2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009f6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009fa:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009fe:	eb a4                	jmp    8009a4 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  800a00:	48 ba b4 34 80 00 00 	movabs $0x8034b4,%rdx
+  800a07:	00 00 00 
+  800a0a:	4c 89 ee             	mov    %r13,%rsi
+  800a0d:	4c 89 f7             	mov    %r14,%rdi
+  800a10:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a15:	49 b8 d7 07 80 00 00 	movabs $0x8007d7,%r8
+  800a1c:	00 00 00 
+  800a1f:	41 ff d0             	call   *%r8
+  800a22:	e9 1e fe ff ff       	jmp    800845 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800a27:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a2a:	83 f8 2f             	cmp    $0x2f,%eax
+  800a2d:	77 6c                	ja     800a9b <vprintfmt+0x287>
+  800a2f:	89 c2                	mov    %eax,%edx
+  800a31:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a35:	83 c0 08             	add    $0x8,%eax
+  800a38:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a3b:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  800a3e:	48 85 d2             	test   %rdx,%rdx
+  800a41:	48 b8 ad 34 80 00 00 	movabs $0x8034ad,%rax
+  800a48:	00 00 00 
+  800a4b:	48 0f 45 c2          	cmovne %rdx,%rax
+  800a4f:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  800a53:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800a57:	7e 06                	jle    800a5f <vprintfmt+0x24b>
+  800a59:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  800a5d:	75 4a                	jne    800aa9 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800a5f:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800a63:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  800a67:	0f b6 00             	movzbl (%rax),%eax
+  800a6a:	84 c0                	test   %al,%al
+  800a6c:	0f 85 9a 00 00 00    	jne    800b0c <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  800a72:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800a75:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  800a79:	85 c0                	test   %eax,%eax
+  800a7b:	0f 8e c4 fd ff ff    	jle    800845 <vprintfmt+0x31>
+  800a81:	4c 89 ee             	mov    %r13,%rsi
+  800a84:	bf 20 00 00 00       	mov    $0x20,%edi
+  800a89:	41 ff d6             	call   *%r14
+  800a8c:	41 83 ec 01          	sub    $0x1,%r12d
+  800a90:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  800a94:	75 eb                	jne    800a81 <vprintfmt+0x26d>
+  800a96:	e9 aa fd ff ff       	jmp    800845 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800a9b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a9f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800aa3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800aa7:	eb 92                	jmp    800a3b <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  800aa9:	49 63 f7             	movslq %r15d,%rsi
+  800aac:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  800ab0:	48 b8 c6 0f 80 00 00 	movabs $0x800fc6,%rax
+  800ab7:	00 00 00 
+  800aba:	ff d0                	call   *%rax
+  800abc:	48 89 c2             	mov    %rax,%rdx
+  800abf:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800ac2:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  800ac4:	8d 70 ff             	lea    -0x1(%rax),%esi
+  800ac7:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  800aca:	85 c0                	test   %eax,%eax
+  800acc:	7e 91                	jle    800a5f <vprintfmt+0x24b>
+  800ace:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  800ad3:	4c 89 ee             	mov    %r13,%rsi
+  800ad6:	44 89 e7             	mov    %r12d,%edi
+  800ad9:	41 ff d6             	call   *%r14
+  800adc:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800ae0:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800ae3:	83 f8 ff             	cmp    $0xffffffff,%eax
+  800ae6:	75 eb                	jne    800ad3 <vprintfmt+0x2bf>
+  800ae8:	e9 72 ff ff ff       	jmp    800a5f <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800aed:	0f b6 f8             	movzbl %al,%edi
+  800af0:	4c 89 ee             	mov    %r13,%rsi
+  800af3:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800af6:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800afa:	49 83 c4 01          	add    $0x1,%r12
+  800afe:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  800b04:	84 c0                	test   %al,%al
+  800b06:	0f 84 66 ff ff ff    	je     800a72 <vprintfmt+0x25e>
+  800b0c:	45 85 ff             	test   %r15d,%r15d
+  800b0f:	78 0a                	js     800b1b <vprintfmt+0x307>
+  800b11:	41 83 ef 01          	sub    $0x1,%r15d
+  800b15:	0f 88 57 ff ff ff    	js     800a72 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800b1b:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  800b1f:	74 cc                	je     800aed <vprintfmt+0x2d9>
+  800b21:	8d 50 e0             	lea    -0x20(%rax),%edx
+  800b24:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800b29:	80 fa 5e             	cmp    $0x5e,%dl
+  800b2c:	77 c2                	ja     800af0 <vprintfmt+0x2dc>
+  800b2e:	eb bd                	jmp    800aed <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  800b30:	40 84 f6             	test   %sil,%sil
+  800b33:	75 26                	jne    800b5b <vprintfmt+0x347>
+    switch (lflag) {
+  800b35:	85 d2                	test   %edx,%edx
+  800b37:	74 59                	je     800b92 <vprintfmt+0x37e>
+  800b39:	83 fa 01             	cmp    $0x1,%edx
+  800b3c:	74 7b                	je     800bb9 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  800b3e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b41:	83 f8 2f             	cmp    $0x2f,%eax
+  800b44:	0f 87 96 00 00 00    	ja     800be0 <vprintfmt+0x3cc>
+  800b4a:	89 c2                	mov    %eax,%edx
+  800b4c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b50:	83 c0 08             	add    $0x8,%eax
+  800b53:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b56:	4c 8b 22             	mov    (%rdx),%r12
+  800b59:	eb 17                	jmp    800b72 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  800b5b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b5e:	83 f8 2f             	cmp    $0x2f,%eax
+  800b61:	77 21                	ja     800b84 <vprintfmt+0x370>
+  800b63:	89 c2                	mov    %eax,%edx
+  800b65:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b69:	83 c0 08             	add    $0x8,%eax
+  800b6c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b6f:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  800b72:	4d 85 e4             	test   %r12,%r12
+  800b75:	78 7a                	js     800bf1 <vprintfmt+0x3dd>
+            num = i;
+  800b77:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  800b7a:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  800b7f:	e9 50 02 00 00       	jmp    800dd4 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800b84:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b88:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b8c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b90:	eb dd                	jmp    800b6f <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  800b92:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b95:	83 f8 2f             	cmp    $0x2f,%eax
+  800b98:	77 11                	ja     800bab <vprintfmt+0x397>
+  800b9a:	89 c2                	mov    %eax,%edx
+  800b9c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ba0:	83 c0 08             	add    $0x8,%eax
+  800ba3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ba6:	4c 63 22             	movslq (%rdx),%r12
+  800ba9:	eb c7                	jmp    800b72 <vprintfmt+0x35e>
+  800bab:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800baf:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bb3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bb7:	eb ed                	jmp    800ba6 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  800bb9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bbc:	83 f8 2f             	cmp    $0x2f,%eax
+  800bbf:	77 11                	ja     800bd2 <vprintfmt+0x3be>
+  800bc1:	89 c2                	mov    %eax,%edx
+  800bc3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800bc7:	83 c0 08             	add    $0x8,%eax
+  800bca:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800bcd:	4c 8b 22             	mov    (%rdx),%r12
+  800bd0:	eb a0                	jmp    800b72 <vprintfmt+0x35e>
+  800bd2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bd6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bda:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bde:	eb ed                	jmp    800bcd <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  800be0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800be4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800be8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bec:	e9 65 ff ff ff       	jmp    800b56 <vprintfmt+0x342>
+                putch('-', put_arg);
+  800bf1:	4c 89 ee             	mov    %r13,%rsi
+  800bf4:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800bf9:	41 ff d6             	call   *%r14
+                i = -i;
+  800bfc:	49 f7 dc             	neg    %r12
+  800bff:	e9 73 ff ff ff       	jmp    800b77 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  800c04:	40 84 f6             	test   %sil,%sil
+  800c07:	75 32                	jne    800c3b <vprintfmt+0x427>
+    switch (lflag) {
+  800c09:	85 d2                	test   %edx,%edx
+  800c0b:	74 5d                	je     800c6a <vprintfmt+0x456>
+  800c0d:	83 fa 01             	cmp    $0x1,%edx
+  800c10:	0f 84 82 00 00 00    	je     800c98 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  800c16:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c19:	83 f8 2f             	cmp    $0x2f,%eax
+  800c1c:	0f 87 a5 00 00 00    	ja     800cc7 <vprintfmt+0x4b3>
+  800c22:	89 c2                	mov    %eax,%edx
+  800c24:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c28:	83 c0 08             	add    $0x8,%eax
+  800c2b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c2e:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800c31:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  800c36:	e9 99 01 00 00       	jmp    800dd4 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800c3b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c3e:	83 f8 2f             	cmp    $0x2f,%eax
+  800c41:	77 19                	ja     800c5c <vprintfmt+0x448>
+  800c43:	89 c2                	mov    %eax,%edx
+  800c45:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c49:	83 c0 08             	add    $0x8,%eax
+  800c4c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c4f:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800c52:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800c57:	e9 78 01 00 00       	jmp    800dd4 <vprintfmt+0x5c0>
+  800c5c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c60:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c64:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c68:	eb e5                	jmp    800c4f <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  800c6a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c6d:	83 f8 2f             	cmp    $0x2f,%eax
+  800c70:	77 18                	ja     800c8a <vprintfmt+0x476>
+  800c72:	89 c2                	mov    %eax,%edx
+  800c74:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c78:	83 c0 08             	add    $0x8,%eax
+  800c7b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c7e:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800c80:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  800c85:	e9 4a 01 00 00       	jmp    800dd4 <vprintfmt+0x5c0>
+  800c8a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c8e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c92:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c96:	eb e6                	jmp    800c7e <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  800c98:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c9b:	83 f8 2f             	cmp    $0x2f,%eax
+  800c9e:	77 19                	ja     800cb9 <vprintfmt+0x4a5>
+  800ca0:	89 c2                	mov    %eax,%edx
+  800ca2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ca6:	83 c0 08             	add    $0x8,%eax
+  800ca9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800cac:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800caf:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  800cb4:	e9 1b 01 00 00       	jmp    800dd4 <vprintfmt+0x5c0>
+  800cb9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800cbd:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800cc1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800cc5:	eb e5                	jmp    800cac <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  800cc7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ccb:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ccf:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800cd3:	e9 56 ff ff ff       	jmp    800c2e <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  800cd8:	40 84 f6             	test   %sil,%sil
+  800cdb:	75 2e                	jne    800d0b <vprintfmt+0x4f7>
+    switch (lflag) {
+  800cdd:	85 d2                	test   %edx,%edx
+  800cdf:	74 59                	je     800d3a <vprintfmt+0x526>
+  800ce1:	83 fa 01             	cmp    $0x1,%edx
+  800ce4:	74 7f                	je     800d65 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  800ce6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ce9:	83 f8 2f             	cmp    $0x2f,%eax
+  800cec:	0f 87 9f 00 00 00    	ja     800d91 <vprintfmt+0x57d>
+  800cf2:	89 c2                	mov    %eax,%edx
+  800cf4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800cf8:	83 c0 08             	add    $0x8,%eax
+  800cfb:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800cfe:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800d01:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  800d06:	e9 c9 00 00 00       	jmp    800dd4 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800d0b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d0e:	83 f8 2f             	cmp    $0x2f,%eax
+  800d11:	77 19                	ja     800d2c <vprintfmt+0x518>
+  800d13:	89 c2                	mov    %eax,%edx
+  800d15:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d19:	83 c0 08             	add    $0x8,%eax
+  800d1c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d1f:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800d22:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800d27:	e9 a8 00 00 00       	jmp    800dd4 <vprintfmt+0x5c0>
+  800d2c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d30:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d34:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d38:	eb e5                	jmp    800d1f <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  800d3a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d3d:	83 f8 2f             	cmp    $0x2f,%eax
+  800d40:	77 15                	ja     800d57 <vprintfmt+0x543>
+  800d42:	89 c2                	mov    %eax,%edx
+  800d44:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d48:	83 c0 08             	add    $0x8,%eax
+  800d4b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d4e:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  800d50:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  800d55:	eb 7d                	jmp    800dd4 <vprintfmt+0x5c0>
+  800d57:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d5b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d5f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d63:	eb e9                	jmp    800d4e <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  800d65:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d68:	83 f8 2f             	cmp    $0x2f,%eax
+  800d6b:	77 16                	ja     800d83 <vprintfmt+0x56f>
+  800d6d:	89 c2                	mov    %eax,%edx
+  800d6f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d73:	83 c0 08             	add    $0x8,%eax
+  800d76:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d79:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800d7c:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  800d81:	eb 51                	jmp    800dd4 <vprintfmt+0x5c0>
+  800d83:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d87:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d8b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d8f:	eb e8                	jmp    800d79 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  800d91:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d95:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d99:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d9d:	e9 5c ff ff ff       	jmp    800cfe <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  800da2:	4c 89 ee             	mov    %r13,%rsi
+  800da5:	bf 30 00 00 00       	mov    $0x30,%edi
+  800daa:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800dad:	4c 89 ee             	mov    %r13,%rsi
+  800db0:	bf 78 00 00 00       	mov    $0x78,%edi
+  800db5:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800db8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800dbb:	83 f8 2f             	cmp    $0x2f,%eax
+  800dbe:	77 47                	ja     800e07 <vprintfmt+0x5f3>
+  800dc0:	89 c2                	mov    %eax,%edx
+  800dc2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800dc6:	83 c0 08             	add    $0x8,%eax
+  800dc9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800dcc:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800dcf:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800dd4:	48 83 ec 08          	sub    $0x8,%rsp
+  800dd8:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800ddc:	0f 94 c0             	sete   %al
+  800ddf:	0f b6 c0             	movzbl %al,%eax
+  800de2:	50                   	push   %rax
+  800de3:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800de8:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800dec:	4c 89 ee             	mov    %r13,%rsi
+  800def:	4c 89 f7             	mov    %r14,%rdi
+  800df2:	48 b8 09 07 80 00 00 	movabs $0x800709,%rax
+  800df9:	00 00 00 
+  800dfc:	ff d0                	call   *%rax
+            break;
+  800dfe:	48 83 c4 10          	add    $0x10,%rsp
+  800e02:	e9 3e fa ff ff       	jmp    800845 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800e07:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800e0b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800e0f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e13:	eb b7                	jmp    800dcc <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  800e15:	40 84 f6             	test   %sil,%sil
+  800e18:	75 2b                	jne    800e45 <vprintfmt+0x631>
+    switch (lflag) {
+  800e1a:	85 d2                	test   %edx,%edx
+  800e1c:	74 56                	je     800e74 <vprintfmt+0x660>
+  800e1e:	83 fa 01             	cmp    $0x1,%edx
+  800e21:	74 7f                	je     800ea2 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800e23:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800e26:	83 f8 2f             	cmp    $0x2f,%eax
+  800e29:	0f 87 a2 00 00 00    	ja     800ed1 <vprintfmt+0x6bd>
+  800e2f:	89 c2                	mov    %eax,%edx
+  800e31:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800e35:	83 c0 08             	add    $0x8,%eax
+  800e38:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800e3b:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800e3e:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800e43:	eb 8f                	jmp    800dd4 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800e45:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800e48:	83 f8 2f             	cmp    $0x2f,%eax
+  800e4b:	77 19                	ja     800e66 <vprintfmt+0x652>
+  800e4d:	89 c2                	mov    %eax,%edx
+  800e4f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800e53:	83 c0 08             	add    $0x8,%eax
+  800e56:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800e59:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800e5c:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800e61:	e9 6e ff ff ff       	jmp    800dd4 <vprintfmt+0x5c0>
+  800e66:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800e6a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800e6e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e72:	eb e5                	jmp    800e59 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800e74:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800e77:	83 f8 2f             	cmp    $0x2f,%eax
+  800e7a:	77 18                	ja     800e94 <vprintfmt+0x680>
+  800e7c:	89 c2                	mov    %eax,%edx
+  800e7e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800e82:	83 c0 08             	add    $0x8,%eax
+  800e85:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800e88:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800e8a:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800e8f:	e9 40 ff ff ff       	jmp    800dd4 <vprintfmt+0x5c0>
+  800e94:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800e98:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800e9c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ea0:	eb e6                	jmp    800e88 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800ea2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ea5:	83 f8 2f             	cmp    $0x2f,%eax
+  800ea8:	77 19                	ja     800ec3 <vprintfmt+0x6af>
+  800eaa:	89 c2                	mov    %eax,%edx
+  800eac:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800eb0:	83 c0 08             	add    $0x8,%eax
+  800eb3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800eb6:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800eb9:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800ebe:	e9 11 ff ff ff       	jmp    800dd4 <vprintfmt+0x5c0>
+  800ec3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ec7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ecb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ecf:	eb e5                	jmp    800eb6 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800ed1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ed5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ed9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800edd:	e9 59 ff ff ff       	jmp    800e3b <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800ee2:	4c 89 ee             	mov    %r13,%rsi
+  800ee5:	bf 25 00 00 00       	mov    $0x25,%edi
+  800eea:	41 ff d6             	call   *%r14
+            break;
+  800eed:	e9 53 f9 ff ff       	jmp    800845 <vprintfmt+0x31>
+            putch('%', put_arg);
+  800ef2:	4c 89 ee             	mov    %r13,%rsi
+  800ef5:	bf 25 00 00 00       	mov    $0x25,%edi
+  800efa:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800efd:	48 83 eb 01          	sub    $0x1,%rbx
+  800f01:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800f05:	75 f6                	jne    800efd <vprintfmt+0x6e9>
+  800f07:	e9 39 f9 ff ff       	jmp    800845 <vprintfmt+0x31>
+}
+  800f0c:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800f10:	5b                   	pop    %rbx
+  800f11:	41 5c                	pop    %r12
+  800f13:	41 5d                	pop    %r13
+  800f15:	41 5e                	pop    %r14
+  800f17:	41 5f                	pop    %r15
+  800f19:	5d                   	pop    %rbp
+  800f1a:	c3                   	ret
+
+0000000000800f1b <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800f1b:	55                   	push   %rbp
+  800f1c:	48 89 e5             	mov    %rsp,%rbp
+  800f1f:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800f23:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800f27:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800f2c:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800f30:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800f37:	48 85 ff             	test   %rdi,%rdi
+  800f3a:	74 2b                	je     800f67 <vsnprintf+0x4c>
+  800f3c:	48 85 f6             	test   %rsi,%rsi
+  800f3f:	74 26                	je     800f67 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800f41:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800f45:	48 bf bf 07 80 00 00 	movabs $0x8007bf,%rdi
+  800f4c:	00 00 00 
+  800f4f:	48 b8 14 08 80 00 00 	movabs $0x800814,%rax
+  800f56:	00 00 00 
+  800f59:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800f5b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800f5f:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800f62:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800f65:	c9                   	leave
+  800f66:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800f67:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800f6c:	eb f7                	jmp    800f65 <vsnprintf+0x4a>
+
+0000000000800f6e <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800f6e:	55                   	push   %rbp
+  800f6f:	48 89 e5             	mov    %rsp,%rbp
+  800f72:	48 83 ec 50          	sub    $0x50,%rsp
+  800f76:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800f7a:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800f7e:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800f82:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800f89:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800f8d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800f91:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800f95:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800f99:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800f9d:	48 b8 1b 0f 80 00 00 	movabs $0x800f1b,%rax
+  800fa4:	00 00 00 
+  800fa7:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800fa9:	c9                   	leave
+  800faa:	c3                   	ret
+
+0000000000800fab <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800fab:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800fae:	74 10                	je     800fc0 <strlen+0x15>
+    size_t n = 0;
+  800fb0:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800fb5:	48 83 c0 01          	add    $0x1,%rax
+  800fb9:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800fbd:	75 f6                	jne    800fb5 <strlen+0xa>
+  800fbf:	c3                   	ret
+    size_t n = 0;
+  800fc0:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800fc5:	c3                   	ret
+
+0000000000800fc6 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800fc6:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800fc9:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800fce:	48 85 f6             	test   %rsi,%rsi
+  800fd1:	74 11                	je     800fe4 <strnlen+0x1e>
+  800fd3:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800fd7:	74 0c                	je     800fe5 <strnlen+0x1f>
+  800fd9:	48 83 c2 01          	add    $0x1,%rdx
+  800fdd:	48 39 d0             	cmp    %rdx,%rax
+  800fe0:	75 f1                	jne    800fd3 <strnlen+0xd>
+  800fe2:	eb 04                	jmp    800fe8 <strnlen+0x22>
+  800fe4:	c3                   	ret
+  800fe5:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800fe8:	c3                   	ret
+
+0000000000800fe9 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800fe9:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800fec:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ff1:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800ff5:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800ff8:	48 83 c2 01          	add    $0x1,%rdx
+  800ffc:	84 c9                	test   %cl,%cl
+  800ffe:	75 f1                	jne    800ff1 <strcpy+0x8>
+        ;
+    return res;
+}
+  801000:	c3                   	ret
+
+0000000000801001 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  801001:	55                   	push   %rbp
+  801002:	48 89 e5             	mov    %rsp,%rbp
+  801005:	41 54                	push   %r12
+  801007:	53                   	push   %rbx
+  801008:	48 89 fb             	mov    %rdi,%rbx
+  80100b:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  80100e:	48 b8 ab 0f 80 00 00 	movabs $0x800fab,%rax
+  801015:	00 00 00 
+  801018:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  80101a:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  80101e:	4c 89 e6             	mov    %r12,%rsi
+  801021:	48 b8 e9 0f 80 00 00 	movabs $0x800fe9,%rax
+  801028:	00 00 00 
+  80102b:	ff d0                	call   *%rax
+    return dst;
+}
+  80102d:	48 89 d8             	mov    %rbx,%rax
+  801030:	5b                   	pop    %rbx
+  801031:	41 5c                	pop    %r12
+  801033:	5d                   	pop    %rbp
+  801034:	c3                   	ret
+
+0000000000801035 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  801035:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  801038:	48 85 d2             	test   %rdx,%rdx
+  80103b:	74 1f                	je     80105c <strncpy+0x27>
+  80103d:	48 01 fa             	add    %rdi,%rdx
+  801040:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  801043:	48 83 c1 01          	add    $0x1,%rcx
+  801047:	44 0f b6 06          	movzbl (%rsi),%r8d
+  80104b:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  80104f:	41 80 f8 01          	cmp    $0x1,%r8b
+  801053:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  801057:	48 39 ca             	cmp    %rcx,%rdx
+  80105a:	75 e7                	jne    801043 <strncpy+0xe>
+    }
+    return ret;
+}
+  80105c:	c3                   	ret
+
+000000000080105d <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  80105d:	48 89 f8             	mov    %rdi,%rax
+  801060:	48 85 d2             	test   %rdx,%rdx
+  801063:	74 24                	je     801089 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  801065:	48 83 ea 01          	sub    $0x1,%rdx
+  801069:	74 1b                	je     801086 <strlcpy+0x29>
+  80106b:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  80106f:	0f b6 16             	movzbl (%rsi),%edx
+  801072:	84 d2                	test   %dl,%dl
+  801074:	74 10                	je     801086 <strlcpy+0x29>
+            *dst++ = *src++;
+  801076:	48 83 c6 01          	add    $0x1,%rsi
+  80107a:	48 83 c0 01          	add    $0x1,%rax
+  80107e:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  801081:	48 39 c8             	cmp    %rcx,%rax
+  801084:	75 e9                	jne    80106f <strlcpy+0x12>
+        *dst = '\0';
+  801086:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  801089:	48 29 f8             	sub    %rdi,%rax
+}
+  80108c:	c3                   	ret
+
+000000000080108d <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  80108d:	0f b6 07             	movzbl (%rdi),%eax
+  801090:	84 c0                	test   %al,%al
+  801092:	74 13                	je     8010a7 <strcmp+0x1a>
+  801094:	38 06                	cmp    %al,(%rsi)
+  801096:	75 0f                	jne    8010a7 <strcmp+0x1a>
+  801098:	48 83 c7 01          	add    $0x1,%rdi
+  80109c:	48 83 c6 01          	add    $0x1,%rsi
+  8010a0:	0f b6 07             	movzbl (%rdi),%eax
+  8010a3:	84 c0                	test   %al,%al
+  8010a5:	75 ed                	jne    801094 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  8010a7:	0f b6 c0             	movzbl %al,%eax
+  8010aa:	0f b6 16             	movzbl (%rsi),%edx
+  8010ad:	29 d0                	sub    %edx,%eax
+}
+  8010af:	c3                   	ret
+
+00000000008010b0 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  8010b0:	48 85 d2             	test   %rdx,%rdx
+  8010b3:	74 1f                	je     8010d4 <strncmp+0x24>
+  8010b5:	0f b6 07             	movzbl (%rdi),%eax
+  8010b8:	84 c0                	test   %al,%al
+  8010ba:	74 1e                	je     8010da <strncmp+0x2a>
+  8010bc:	3a 06                	cmp    (%rsi),%al
+  8010be:	75 1a                	jne    8010da <strncmp+0x2a>
+  8010c0:	48 83 c7 01          	add    $0x1,%rdi
+  8010c4:	48 83 c6 01          	add    $0x1,%rsi
+  8010c8:	48 83 ea 01          	sub    $0x1,%rdx
+  8010cc:	75 e7                	jne    8010b5 <strncmp+0x5>
+
+    if (!n) return 0;
+  8010ce:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010d3:	c3                   	ret
+  8010d4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010d9:	c3                   	ret
+  8010da:	48 85 d2             	test   %rdx,%rdx
+  8010dd:	74 09                	je     8010e8 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  8010df:	0f b6 07             	movzbl (%rdi),%eax
+  8010e2:	0f b6 16             	movzbl (%rsi),%edx
+  8010e5:	29 d0                	sub    %edx,%eax
+  8010e7:	c3                   	ret
+    if (!n) return 0;
+  8010e8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8010ed:	c3                   	ret
+
+00000000008010ee <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  8010ee:	0f b6 17             	movzbl (%rdi),%edx
+  8010f1:	84 d2                	test   %dl,%dl
+  8010f3:	74 18                	je     80110d <strchr+0x1f>
+        if (*str == c) {
+  8010f5:	0f be d2             	movsbl %dl,%edx
+  8010f8:	39 f2                	cmp    %esi,%edx
+  8010fa:	74 17                	je     801113 <strchr+0x25>
+    for (; *str; str++) {
+  8010fc:	48 83 c7 01          	add    $0x1,%rdi
+  801100:	0f b6 17             	movzbl (%rdi),%edx
+  801103:	84 d2                	test   %dl,%dl
+  801105:	75 ee                	jne    8010f5 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  801107:	b8 00 00 00 00       	mov    $0x0,%eax
+  80110c:	c3                   	ret
+  80110d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801112:	c3                   	ret
+  801113:	48 89 f8             	mov    %rdi,%rax
+}
+  801116:	c3                   	ret
+
+0000000000801117 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  801117:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  80111a:	0f b6 17             	movzbl (%rdi),%edx
+  80111d:	84 d2                	test   %dl,%dl
+  80111f:	74 13                	je     801134 <strfind+0x1d>
+  801121:	0f be d2             	movsbl %dl,%edx
+  801124:	39 f2                	cmp    %esi,%edx
+  801126:	74 0b                	je     801133 <strfind+0x1c>
+  801128:	48 83 c0 01          	add    $0x1,%rax
+  80112c:	0f b6 10             	movzbl (%rax),%edx
+  80112f:	84 d2                	test   %dl,%dl
+  801131:	75 ee                	jne    801121 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  801133:	c3                   	ret
+  801134:	c3                   	ret
+
+0000000000801135 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  801135:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  801138:	48 89 f8             	mov    %rdi,%rax
+  80113b:	48 f7 d8             	neg    %rax
+  80113e:	83 e0 07             	and    $0x7,%eax
+  801141:	49 89 d1             	mov    %rdx,%r9
+  801144:	49 29 c1             	sub    %rax,%r9
+  801147:	78 36                	js     80117f <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  801149:	40 0f b6 c6          	movzbl %sil,%eax
+  80114d:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  801154:	01 01 01 
+  801157:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  80115b:	40 f6 c7 07          	test   $0x7,%dil
+  80115f:	75 38                	jne    801199 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  801161:	4c 89 c9             	mov    %r9,%rcx
+  801164:	48 c1 f9 03          	sar    $0x3,%rcx
+  801168:	74 0c                	je     801176 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  80116a:	fc                   	cld
+  80116b:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  80116e:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  801172:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  801176:	4d 85 c9             	test   %r9,%r9
+  801179:	75 45                	jne    8011c0 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  80117b:	4c 89 c0             	mov    %r8,%rax
+  80117e:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  80117f:	48 85 d2             	test   %rdx,%rdx
+  801182:	74 f7                	je     80117b <memset+0x46>
+  801184:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  801187:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  80118a:	48 83 c0 01          	add    $0x1,%rax
+  80118e:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  801192:	48 39 c2             	cmp    %rax,%rdx
+  801195:	75 f3                	jne    80118a <memset+0x55>
+  801197:	eb e2                	jmp    80117b <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  801199:	40 f6 c7 01          	test   $0x1,%dil
+  80119d:	74 06                	je     8011a5 <memset+0x70>
+  80119f:	88 07                	mov    %al,(%rdi)
+  8011a1:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  8011a5:	40 f6 c7 02          	test   $0x2,%dil
+  8011a9:	74 07                	je     8011b2 <memset+0x7d>
+  8011ab:	66 89 07             	mov    %ax,(%rdi)
+  8011ae:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  8011b2:	40 f6 c7 04          	test   $0x4,%dil
+  8011b6:	74 a9                	je     801161 <memset+0x2c>
+  8011b8:	89 07                	mov    %eax,(%rdi)
+  8011ba:	48 83 c7 04          	add    $0x4,%rdi
+  8011be:	eb a1                	jmp    801161 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  8011c0:	41 f6 c1 04          	test   $0x4,%r9b
+  8011c4:	74 06                	je     8011cc <memset+0x97>
+  8011c6:	89 07                	mov    %eax,(%rdi)
+  8011c8:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  8011cc:	41 f6 c1 02          	test   $0x2,%r9b
+  8011d0:	74 07                	je     8011d9 <memset+0xa4>
+  8011d2:	66 89 07             	mov    %ax,(%rdi)
+  8011d5:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  8011d9:	41 f6 c1 01          	test   $0x1,%r9b
+  8011dd:	74 9c                	je     80117b <memset+0x46>
+  8011df:	88 07                	mov    %al,(%rdi)
+  8011e1:	eb 98                	jmp    80117b <memset+0x46>
+
+00000000008011e3 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  8011e3:	48 89 f8             	mov    %rdi,%rax
+  8011e6:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  8011e9:	48 39 fe             	cmp    %rdi,%rsi
+  8011ec:	73 3b                	jae    801229 <memmove+0x46>
+  8011ee:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  8011f2:	48 39 d7             	cmp    %rdx,%rdi
+  8011f5:	73 32                	jae    801229 <memmove+0x46>
+        s += n;
+        d += n;
+  8011f7:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  8011fb:	48 89 d6             	mov    %rdx,%rsi
+  8011fe:	48 09 fe             	or     %rdi,%rsi
+  801201:	48 09 ce             	or     %rcx,%rsi
+  801204:	40 f6 c6 07          	test   $0x7,%sil
+  801208:	75 12                	jne    80121c <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  80120a:	48 83 ef 08          	sub    $0x8,%rdi
+  80120e:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  801212:	48 c1 e9 03          	shr    $0x3,%rcx
+  801216:	fd                   	std
+  801217:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  80121a:	fc                   	cld
+  80121b:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  80121c:	48 83 ef 01          	sub    $0x1,%rdi
+  801220:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  801224:	fd                   	std
+  801225:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  801227:	eb f1                	jmp    80121a <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  801229:	48 89 f2             	mov    %rsi,%rdx
+  80122c:	48 09 c2             	or     %rax,%rdx
+  80122f:	48 09 ca             	or     %rcx,%rdx
+  801232:	f6 c2 07             	test   $0x7,%dl
+  801235:	75 0c                	jne    801243 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  801237:	48 c1 e9 03          	shr    $0x3,%rcx
+  80123b:	48 89 c7             	mov    %rax,%rdi
+  80123e:	fc                   	cld
+  80123f:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  801242:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  801243:	48 89 c7             	mov    %rax,%rdi
+  801246:	fc                   	cld
+  801247:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  801249:	c3                   	ret
+
+000000000080124a <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  80124a:	55                   	push   %rbp
+  80124b:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  80124e:	48 b8 e3 11 80 00 00 	movabs $0x8011e3,%rax
+  801255:	00 00 00 
+  801258:	ff d0                	call   *%rax
+}
+  80125a:	5d                   	pop    %rbp
+  80125b:	c3                   	ret
+
+000000000080125c <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  80125c:	55                   	push   %rbp
+  80125d:	48 89 e5             	mov    %rsp,%rbp
+  801260:	41 57                	push   %r15
+  801262:	41 56                	push   %r14
+  801264:	41 55                	push   %r13
+  801266:	41 54                	push   %r12
+  801268:	53                   	push   %rbx
+  801269:	48 83 ec 08          	sub    $0x8,%rsp
+  80126d:	49 89 fe             	mov    %rdi,%r14
+  801270:	49 89 f7             	mov    %rsi,%r15
+  801273:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  801276:	48 89 f7             	mov    %rsi,%rdi
+  801279:	48 b8 ab 0f 80 00 00 	movabs $0x800fab,%rax
+  801280:	00 00 00 
+  801283:	ff d0                	call   *%rax
+  801285:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  801288:	48 89 de             	mov    %rbx,%rsi
+  80128b:	4c 89 f7             	mov    %r14,%rdi
+  80128e:	48 b8 c6 0f 80 00 00 	movabs $0x800fc6,%rax
+  801295:	00 00 00 
+  801298:	ff d0                	call   *%rax
+  80129a:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  80129d:	48 39 c3             	cmp    %rax,%rbx
+  8012a0:	74 36                	je     8012d8 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  8012a2:	48 89 d8             	mov    %rbx,%rax
+  8012a5:	4c 29 e8             	sub    %r13,%rax
+  8012a8:	49 39 c4             	cmp    %rax,%r12
+  8012ab:	73 31                	jae    8012de <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  8012ad:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  8012b2:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8012b6:	4c 89 fe             	mov    %r15,%rsi
+  8012b9:	48 b8 4a 12 80 00 00 	movabs $0x80124a,%rax
+  8012c0:	00 00 00 
+  8012c3:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  8012c5:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  8012c9:	48 83 c4 08          	add    $0x8,%rsp
+  8012cd:	5b                   	pop    %rbx
+  8012ce:	41 5c                	pop    %r12
+  8012d0:	41 5d                	pop    %r13
+  8012d2:	41 5e                	pop    %r14
+  8012d4:	41 5f                	pop    %r15
+  8012d6:	5d                   	pop    %rbp
+  8012d7:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  8012d8:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  8012dc:	eb eb                	jmp    8012c9 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  8012de:	48 83 eb 01          	sub    $0x1,%rbx
+  8012e2:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8012e6:	48 89 da             	mov    %rbx,%rdx
+  8012e9:	4c 89 fe             	mov    %r15,%rsi
+  8012ec:	48 b8 4a 12 80 00 00 	movabs $0x80124a,%rax
+  8012f3:	00 00 00 
+  8012f6:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  8012f8:	49 01 de             	add    %rbx,%r14
+  8012fb:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  801300:	eb c3                	jmp    8012c5 <strlcat+0x69>
+
+0000000000801302 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  801302:	48 85 d2             	test   %rdx,%rdx
+  801305:	74 2d                	je     801334 <memcmp+0x32>
+  801307:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  80130c:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  801310:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  801315:	44 38 c1             	cmp    %r8b,%cl
+  801318:	75 0f                	jne    801329 <memcmp+0x27>
+    while (n-- > 0) {
+  80131a:	48 83 c0 01          	add    $0x1,%rax
+  80131e:	48 39 c2             	cmp    %rax,%rdx
+  801321:	75 e9                	jne    80130c <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  801323:	b8 00 00 00 00       	mov    $0x0,%eax
+  801328:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  801329:	0f b6 c1             	movzbl %cl,%eax
+  80132c:	45 0f b6 c0          	movzbl %r8b,%r8d
+  801330:	44 29 c0             	sub    %r8d,%eax
+  801333:	c3                   	ret
+    return 0;
+  801334:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801339:	c3                   	ret
+
+000000000080133a <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  80133a:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  80133e:	48 39 c7             	cmp    %rax,%rdi
+  801341:	73 0f                	jae    801352 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  801343:	40 38 37             	cmp    %sil,(%rdi)
+  801346:	74 0e                	je     801356 <memfind+0x1c>
+    for (; src < end; src++) {
+  801348:	48 83 c7 01          	add    $0x1,%rdi
+  80134c:	48 39 f8             	cmp    %rdi,%rax
+  80134f:	75 f2                	jne    801343 <memfind+0x9>
+  801351:	c3                   	ret
+  801352:	48 89 f8             	mov    %rdi,%rax
+  801355:	c3                   	ret
+  801356:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  801359:	c3                   	ret
+
+000000000080135a <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  80135a:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  80135d:	0f b6 37             	movzbl (%rdi),%esi
+  801360:	40 80 fe 20          	cmp    $0x20,%sil
+  801364:	74 06                	je     80136c <strtol+0x12>
+  801366:	40 80 fe 09          	cmp    $0x9,%sil
+  80136a:	75 13                	jne    80137f <strtol+0x25>
+  80136c:	48 83 c7 01          	add    $0x1,%rdi
+  801370:	0f b6 37             	movzbl (%rdi),%esi
+  801373:	40 80 fe 20          	cmp    $0x20,%sil
+  801377:	74 f3                	je     80136c <strtol+0x12>
+  801379:	40 80 fe 09          	cmp    $0x9,%sil
+  80137d:	74 ed                	je     80136c <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  80137f:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  801382:	83 e0 fd             	and    $0xfffffffd,%eax
+  801385:	3c 01                	cmp    $0x1,%al
+  801387:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  80138b:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  801391:	75 0f                	jne    8013a2 <strtol+0x48>
+  801393:	80 3f 30             	cmpb   $0x30,(%rdi)
+  801396:	74 14                	je     8013ac <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  801398:	85 d2                	test   %edx,%edx
+  80139a:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80139f:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  8013a2:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  8013a7:	4c 63 ca             	movslq %edx,%r9
+  8013aa:	eb 36                	jmp    8013e2 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8013ac:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  8013b0:	74 0f                	je     8013c1 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  8013b2:	85 d2                	test   %edx,%edx
+  8013b4:	75 ec                	jne    8013a2 <strtol+0x48>
+        s++;
+  8013b6:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  8013ba:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  8013bf:	eb e1                	jmp    8013a2 <strtol+0x48>
+        s += 2;
+  8013c1:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  8013c5:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  8013ca:	eb d6                	jmp    8013a2 <strtol+0x48>
+            dig -= '0';
+  8013cc:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  8013cf:	44 0f b6 c1          	movzbl %cl,%r8d
+  8013d3:	41 39 d0             	cmp    %edx,%r8d
+  8013d6:	7d 21                	jge    8013f9 <strtol+0x9f>
+        val = val * base + dig;
+  8013d8:	49 0f af c1          	imul   %r9,%rax
+  8013dc:	0f b6 c9             	movzbl %cl,%ecx
+  8013df:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  8013e2:	48 83 c7 01          	add    $0x1,%rdi
+  8013e6:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  8013ea:	80 f9 39             	cmp    $0x39,%cl
+  8013ed:	76 dd                	jbe    8013cc <strtol+0x72>
+        else if (dig - 'a' < 27)
+  8013ef:	80 f9 7b             	cmp    $0x7b,%cl
+  8013f2:	77 05                	ja     8013f9 <strtol+0x9f>
+            dig -= 'a' - 10;
+  8013f4:	83 e9 57             	sub    $0x57,%ecx
+  8013f7:	eb d6                	jmp    8013cf <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  8013f9:	4d 85 d2             	test   %r10,%r10
+  8013fc:	74 03                	je     801401 <strtol+0xa7>
+  8013fe:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  801401:	48 89 c2             	mov    %rax,%rdx
+  801404:	48 f7 da             	neg    %rdx
+  801407:	40 80 fe 2d          	cmp    $0x2d,%sil
+  80140b:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  80140f:	c3                   	ret
+
+0000000000801410 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  801410:	55                   	push   %rbp
+  801411:	48 89 e5             	mov    %rsp,%rbp
+  801414:	53                   	push   %rbx
+  801415:	48 89 fa             	mov    %rdi,%rdx
+  801418:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80141b:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801420:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801425:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80142a:	be 00 00 00 00       	mov    $0x0,%esi
+  80142f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801435:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  801437:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80143b:	c9                   	leave
+  80143c:	c3                   	ret
+
+000000000080143d <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  80143d:	55                   	push   %rbp
+  80143e:	48 89 e5             	mov    %rsp,%rbp
+  801441:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801442:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801447:	ba 00 00 00 00       	mov    $0x0,%edx
+  80144c:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801451:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801456:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80145b:	be 00 00 00 00       	mov    $0x0,%esi
+  801460:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801466:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  801468:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80146c:	c9                   	leave
+  80146d:	c3                   	ret
+
+000000000080146e <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  80146e:	55                   	push   %rbp
+  80146f:	48 89 e5             	mov    %rsp,%rbp
+  801472:	53                   	push   %rbx
+  801473:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  801477:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80147a:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80147f:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801484:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801489:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80148e:	be 00 00 00 00       	mov    $0x0,%esi
+  801493:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801499:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80149b:	48 85 c0             	test   %rax,%rax
+  80149e:	7f 06                	jg     8014a6 <sys_env_destroy+0x38>
+}
+  8014a0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014a4:	c9                   	leave
+  8014a5:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8014a6:	49 89 c0             	mov    %rax,%r8
+  8014a9:	b9 03 00 00 00       	mov    $0x3,%ecx
+  8014ae:	48 ba f0 39 80 00 00 	movabs $0x8039f0,%rdx
+  8014b5:	00 00 00 
+  8014b8:	be 26 00 00 00       	mov    $0x26,%esi
+  8014bd:	48 bf 0f 3a 80 00 00 	movabs $0x803a0f,%rdi
+  8014c4:	00 00 00 
+  8014c7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014cc:	49 b9 74 05 80 00 00 	movabs $0x800574,%r9
+  8014d3:	00 00 00 
+  8014d6:	41 ff d1             	call   *%r9
+
+00000000008014d9 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  8014d9:	55                   	push   %rbp
+  8014da:	48 89 e5             	mov    %rsp,%rbp
+  8014dd:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8014de:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8014e3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014e8:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8014ed:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014f2:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014f7:	be 00 00 00 00       	mov    $0x0,%esi
+  8014fc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801502:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  801504:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801508:	c9                   	leave
+  801509:	c3                   	ret
+
+000000000080150a <sys_yield>:
+
+void
+sys_yield(void) {
+  80150a:	55                   	push   %rbp
+  80150b:	48 89 e5             	mov    %rsp,%rbp
+  80150e:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80150f:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801514:	ba 00 00 00 00       	mov    $0x0,%edx
+  801519:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80151e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801523:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801528:	be 00 00 00 00       	mov    $0x0,%esi
+  80152d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801533:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  801535:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801539:	c9                   	leave
+  80153a:	c3                   	ret
+
+000000000080153b <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  80153b:	55                   	push   %rbp
+  80153c:	48 89 e5             	mov    %rsp,%rbp
+  80153f:	53                   	push   %rbx
+  801540:	48 89 fa             	mov    %rdi,%rdx
+  801543:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801546:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80154b:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  801552:	00 00 00 
+  801555:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80155a:	be 00 00 00 00       	mov    $0x0,%esi
+  80155f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801565:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  801567:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80156b:	c9                   	leave
+  80156c:	c3                   	ret
+
+000000000080156d <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  80156d:	55                   	push   %rbp
+  80156e:	48 89 e5             	mov    %rsp,%rbp
+  801571:	53                   	push   %rbx
+  801572:	49 89 f8             	mov    %rdi,%r8
+  801575:	48 89 d3             	mov    %rdx,%rbx
+  801578:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80157b:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801580:	4c 89 c2             	mov    %r8,%rdx
+  801583:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801586:	be 00 00 00 00       	mov    $0x0,%esi
+  80158b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801591:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  801593:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801597:	c9                   	leave
+  801598:	c3                   	ret
+
+0000000000801599 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  801599:	55                   	push   %rbp
+  80159a:	48 89 e5             	mov    %rsp,%rbp
+  80159d:	53                   	push   %rbx
+  80159e:	48 83 ec 08          	sub    $0x8,%rsp
+  8015a2:	89 f8                	mov    %edi,%eax
+  8015a4:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  8015a7:	48 63 f9             	movslq %ecx,%rdi
+  8015aa:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8015ad:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8015b2:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015b5:	be 00 00 00 00       	mov    $0x0,%esi
+  8015ba:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015c0:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8015c2:	48 85 c0             	test   %rax,%rax
+  8015c5:	7f 06                	jg     8015cd <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  8015c7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015cb:	c9                   	leave
+  8015cc:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8015cd:	49 89 c0             	mov    %rax,%r8
+  8015d0:	b9 04 00 00 00       	mov    $0x4,%ecx
+  8015d5:	48 ba f0 39 80 00 00 	movabs $0x8039f0,%rdx
+  8015dc:	00 00 00 
+  8015df:	be 26 00 00 00       	mov    $0x26,%esi
+  8015e4:	48 bf 0f 3a 80 00 00 	movabs $0x803a0f,%rdi
+  8015eb:	00 00 00 
+  8015ee:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015f3:	49 b9 74 05 80 00 00 	movabs $0x800574,%r9
+  8015fa:	00 00 00 
+  8015fd:	41 ff d1             	call   *%r9
+
+0000000000801600 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801600:	55                   	push   %rbp
+  801601:	48 89 e5             	mov    %rsp,%rbp
+  801604:	53                   	push   %rbx
+  801605:	48 83 ec 08          	sub    $0x8,%rsp
+  801609:	89 f8                	mov    %edi,%eax
+  80160b:	49 89 f2             	mov    %rsi,%r10
+  80160e:	48 89 cf             	mov    %rcx,%rdi
+  801611:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  801614:	48 63 da             	movslq %edx,%rbx
+  801617:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80161a:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80161f:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801622:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  801625:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801627:	48 85 c0             	test   %rax,%rax
+  80162a:	7f 06                	jg     801632 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  80162c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801630:	c9                   	leave
+  801631:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801632:	49 89 c0             	mov    %rax,%r8
+  801635:	b9 05 00 00 00       	mov    $0x5,%ecx
+  80163a:	48 ba f0 39 80 00 00 	movabs $0x8039f0,%rdx
+  801641:	00 00 00 
+  801644:	be 26 00 00 00       	mov    $0x26,%esi
+  801649:	48 bf 0f 3a 80 00 00 	movabs $0x803a0f,%rdi
+  801650:	00 00 00 
+  801653:	b8 00 00 00 00       	mov    $0x0,%eax
+  801658:	49 b9 74 05 80 00 00 	movabs $0x800574,%r9
+  80165f:	00 00 00 
+  801662:	41 ff d1             	call   *%r9
+
+0000000000801665 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  801665:	55                   	push   %rbp
+  801666:	48 89 e5             	mov    %rsp,%rbp
+  801669:	53                   	push   %rbx
+  80166a:	48 83 ec 08          	sub    $0x8,%rsp
+  80166e:	48 89 f1             	mov    %rsi,%rcx
+  801671:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  801674:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801677:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80167c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801681:	be 00 00 00 00       	mov    $0x0,%esi
+  801686:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80168c:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80168e:	48 85 c0             	test   %rax,%rax
+  801691:	7f 06                	jg     801699 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  801693:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801697:	c9                   	leave
+  801698:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801699:	49 89 c0             	mov    %rax,%r8
+  80169c:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8016a1:	48 ba f0 39 80 00 00 	movabs $0x8039f0,%rdx
+  8016a8:	00 00 00 
+  8016ab:	be 26 00 00 00       	mov    $0x26,%esi
+  8016b0:	48 bf 0f 3a 80 00 00 	movabs $0x803a0f,%rdi
+  8016b7:	00 00 00 
+  8016ba:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016bf:	49 b9 74 05 80 00 00 	movabs $0x800574,%r9
+  8016c6:	00 00 00 
+  8016c9:	41 ff d1             	call   *%r9
+
+00000000008016cc <sys_region_batch>:
+
+int
+sys_region_batch(const struct RegionOp *ops, size_t count) {
+  8016cc:	55                   	push   %rbp
+  8016cd:	48 89 e5             	mov    %rsp,%rbp
+  8016d0:	53                   	push   %rbx
+  8016d1:	48 83 ec 08          	sub    $0x8,%rsp
+  8016d5:	48 89 fa             	mov    %rdi,%rdx
+  8016d8:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8016db:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8016e0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016e5:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8016ea:	be 00 00 00 00       	mov    $0x0,%esi
+  8016ef:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8016f5:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8016f7:	48 85 c0             	test   %rax,%rax
+  8016fa:	7f 06                	jg     801702 <sys_region_batch+0x36>
+        else
+            platform_asan_unpoison(va, ops[i].size);
+    }
+#endif
+    return res;
+}
+  8016fc:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801700:	c9                   	leave
+  801701:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801702:	49 89 c0             	mov    %rax,%r8
+  801705:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  80170a:	48 ba f0 39 80 00 00 	movabs $0x8039f0,%rdx
+  801711:	00 00 00 
+  801714:	be 26 00 00 00       	mov    $0x26,%esi
+  801719:	48 bf 0f 3a 80 00 00 	movabs $0x803a0f,%rdi
+  801720:	00 00 00 
+  801723:	b8 00 00 00 00       	mov    $0x0,%eax
+  801728:	49 b9 74 05 80 00 00 	movabs $0x800574,%r9
+  80172f:	00 00 00 
+  801732:	41 ff d1             	call   *%r9
+
+0000000000801735 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  801735:	55                   	push   %rbp
+  801736:	48 89 e5             	mov    %rsp,%rbp
+  801739:	53                   	push   %rbx
+  80173a:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  80173e:	48 63 ce             	movslq %esi,%rcx
+  801741:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801744:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801749:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80174e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801753:	be 00 00 00 00       	mov    $0x0,%esi
+  801758:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80175e:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801760:	48 85 c0             	test   %rax,%rax
+  801763:	7f 06                	jg     80176b <sys_env_set_status+0x36>
+}
+  801765:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801769:	c9                   	leave
+  80176a:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80176b:	49 89 c0             	mov    %rax,%r8
+  80176e:	b9 09 00 00 00       	mov    $0x9,%ecx
+  801773:	48 ba f0 39 80 00 00 	movabs $0x8039f0,%rdx
+  80177a:	00 00 00 
+  80177d:	be 26 00 00 00       	mov    $0x26,%esi
+  801782:	48 bf 0f 3a 80 00 00 	movabs $0x803a0f,%rdi
+  801789:	00 00 00 
+  80178c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801791:	49 b9 74 05 80 00 00 	movabs $0x800574,%r9
+  801798:	00 00 00 
+  80179b:	41 ff d1             	call   *%r9
+
+000000000080179e <sys_env_set_weight>:
+
+int
+sys_env_set_weight(envid_t envid, uint32_t weight) {
+  80179e:	55                   	push   %rbp
+  80179f:	48 89 e5             	mov    %rsp,%rbp
+  8017a2:	53                   	push   %rbx
+  8017a3:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_weight, 1, envid, weight, 0, 0, 0, 0);
+  8017a7:	89 f1                	mov    %esi,%ecx
+  8017a9:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8017ac:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8017b1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017b6:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8017bb:	be 00 00 00 00       	mov    $0x0,%esi
+  8017c0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8017c6:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8017c8:	48 85 c0             	test   %rax,%rax
+  8017cb:	7f 06                	jg     8017d3 <sys_env_set_weight+0x35>
+}
+  8017cd:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8017d1:	c9                   	leave
+  8017d2:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8017d3:	49 89 c0             	mov    %rax,%r8
+  8017d6:	b9 10 00 00 00       	mov    $0x10,%ecx
+  8017db:	48 ba f0 39 80 00 00 	movabs $0x8039f0,%rdx
+  8017e2:	00 00 00 
+  8017e5:	be 26 00 00 00       	mov    $0x26,%esi
+  8017ea:	48 bf 0f 3a 80 00 00 	movabs $0x803a0f,%rdi
+  8017f1:	00 00 00 
+  8017f4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017f9:	49 b9 74 05 80 00 00 	movabs $0x800574,%r9
+  801800:	00 00 00 
+  801803:	41 ff d1             	call   *%r9
+
+0000000000801806 <sys_env_set_rt>:
+
+int
+sys_env_set_rt(envid_t envid, uint64_t period, uint64_t budget, uint64_t deadline) {
+  801806:	55                   	push   %rbp
+  801807:	48 89 e5             	mov    %rsp,%rbp
+  80180a:	53                   	push   %rbx
+  80180b:	48 83 ec 08          	sub    $0x8,%rsp
+  80180f:	89 f8                	mov    %edi,%eax
+  801811:	48 89 d3             	mov    %rdx,%rbx
+  801814:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_env_set_rt, 1, envid, period, budget, deadline, 0, 0);
+  801817:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80181a:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80181f:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801822:	be 00 00 00 00       	mov    $0x0,%esi
+  801827:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80182d:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80182f:	48 85 c0             	test   %rax,%rax
+  801832:	7f 06                	jg     80183a <sys_env_set_rt+0x34>
+}
+  801834:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801838:	c9                   	leave
+  801839:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80183a:	49 89 c0             	mov    %rax,%r8
+  80183d:	b9 11 00 00 00       	mov    $0x11,%ecx
+  801842:	48 ba f0 39 80 00 00 	movabs $0x8039f0,%rdx
+  801849:	00 00 00 
+  80184c:	be 26 00 00 00       	mov    $0x26,%esi
+  801851:	48 bf 0f 3a 80 00 00 	movabs $0x803a0f,%rdi
+  801858:	00 00 00 
+  80185b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801860:	49 b9 74 05 80 00 00 	movabs $0x800574,%r9
+  801867:	00 00 00 
+  80186a:	41 ff d1             	call   *%r9
+
+000000000080186d <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  80186d:	55                   	push   %rbp
+  80186e:	48 89 e5             	mov    %rsp,%rbp
+  801871:	53                   	push   %rbx
+  801872:	48 83 ec 08          	sub    $0x8,%rsp
+  801876:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  801879:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80187c:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801881:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801886:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80188b:	be 00 00 00 00       	mov    $0x0,%esi
+  801890:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801896:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801898:	48 85 c0             	test   %rax,%rax
+  80189b:	7f 06                	jg     8018a3 <sys_env_set_trapframe+0x36>
+}
+  80189d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8018a1:	c9                   	leave
+  8018a2:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8018a3:	49 89 c0             	mov    %rax,%r8
+  8018a6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  8018ab:	48 ba f0 39 80 00 00 	movabs $0x8039f0,%rdx
+  8018b2:	00 00 00 
+  8018b5:	be 26 00 00 00       	mov    $0x26,%esi
+  8018ba:	48 bf 0f 3a 80 00 00 	movabs $0x803a0f,%rdi
+  8018c1:	00 00 00 
+  8018c4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018c9:	49 b9 74 05 80 00 00 	movabs $0x800574,%r9
+  8018d0:	00 00 00 
+  8018d3:	41 ff d1             	call   *%r9
+
+00000000008018d6 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  8018d6:	55                   	push   %rbp
+  8018d7:	48 89 e5             	mov    %rsp,%rbp
+  8018da:	53                   	push   %rbx
+  8018db:	48 83 ec 08          	sub    $0x8,%rsp
+  8018df:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  8018e2:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8018e5:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8018ea:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8018ef:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8018f4:	be 00 00 00 00       	mov    $0x0,%esi
+  8018f9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8018ff:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801901:	48 85 c0             	test   %rax,%rax
+  801904:	7f 06                	jg     80190c <sys_env_set_pgfault_upcall+0x36>
+}
+  801906:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80190a:	c9                   	leave
+  80190b:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80190c:	49 89 c0             	mov    %rax,%r8
+  80190f:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  801914:	48 ba f0 39 80 00 00 	movabs $0x8039f0,%rdx
+  80191b:	00 00 00 
+  80191e:	be 26 00 00 00       	mov    $0x26,%esi
+  801923:	48 bf 0f 3a 80 00 00 	movabs $0x803a0f,%rdi
+  80192a:	00 00 00 
+  80192d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801932:	49 b9 74 05 80 00 00 	movabs $0x800574,%r9
+  801939:	00 00 00 
+  80193c:	41 ff d1             	call   *%r9
+
+000000000080193f <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  80193f:	55                   	push   %rbp
+  801940:	48 89 e5             	mov    %rsp,%rbp
+  801943:	53                   	push   %rbx
+  801944:	89 f8                	mov    %edi,%eax
+  801946:	49 89 f1             	mov    %rsi,%r9
+  801949:	48 89 d3             	mov    %rdx,%rbx
+  80194c:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  80194f:	49 63 f0             	movslq %r8d,%rsi
+  801952:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801955:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80195a:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80195d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801963:	cd 30                	int    $0x30
+}
+  801965:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801969:	c9                   	leave
+  80196a:	c3                   	ret
+
+000000000080196b <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  80196b:	55                   	push   %rbp
+  80196c:	48 89 e5             	mov    %rsp,%rbp
+  80196f:	53                   	push   %rbx
+  801970:	48 83 ec 08          	sub    $0x8,%rsp
+  801974:	48 89 fa             	mov    %rdi,%rdx
+  801977:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80197a:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80197f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801984:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801989:	be 00 00 00 00       	mov    $0x0,%esi
+  80198e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801994:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801996:	48 85 c0             	test   %rax,%rax
+  801999:	7f 06                	jg     8019a1 <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  80199b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80199f:	c9                   	leave
+  8019a0:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8019a1:	49 89 c0             	mov    %rax,%r8
+  8019a4:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  8019a9:	48 ba f0 39 80 00 00 	movabs $0x8039f0,%rdx
+  8019b0:	00 00 00 
+  8019b3:	be 26 00 00 00       	mov    $0x26,%esi
+  8019b8:	48 bf 0f 3a 80 00 00 	movabs $0x803a0f,%rdi
+  8019bf:	00 00 00 
+  8019c2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019c7:	49 b9 74 05 80 00 00 	movabs $0x800574,%r9
+  8019ce:	00 00 00 
+  8019d1:	41 ff d1             	call   *%r9
+
+00000000008019d4 <fork>:
+ * Hint:
+ *   Use sys_map_region, it can perform address space copying in one call
+ *   Remember to fix "thisenv" in the child process.
+ */
+envid_t
+fork(void) {
+  8019d4:	55                   	push   %rbp
+  8019d5:	48 89 e5             	mov    %rsp,%rbp
+  8019d8:	41 55                	push   %r13
+  8019da:	41 54                	push   %r12
+  8019dc:	53                   	push   %rbx
+  8019dd:	48 83 ec 08          	sub    $0x8,%rsp
+
+/* This must be inlined. Exercise for reader: why? */
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+    envid_t ret;
+    asm volatile("int %2"
+  8019e1:	b8 08 00 00 00       	mov    $0x8,%eax
+  8019e6:	cd 30                	int    $0x30
+  8019e8:	41 89 c5             	mov    %eax,%r13d
+    // LAB 9: Your code here
+
+    envid_t child_id = sys_exofork();
+    if (child_id < 0) {
+  8019eb:	85 c0                	test   %eax,%eax
+  8019ed:	0f 88 ae 00 00 00    	js     801aa1 <fork+0xcd>
+  8019f3:	89 c3                	mov    %eax,%ebx
+        return child_id;
+    }
+    if (child_id == 0) {
+  8019f5:	0f 84 b4 00 00 00    	je     801aaf <fork+0xdb>
+        thisenv = &envs[ENVX(sys_getenvid())];
+        return 0;
+    }
+    int res = sys_map_region(0, NULL, child_id, NULL, MAX_USER_ADDRESS, PROT_ALL | PROT_LAZY | PROT_COMBINE);
+  8019fb:	41 b9 df 01 00 00    	mov    $0x1df,%r9d
+  801a01:	49 b8 00 00 00 00 80 	movabs $0x8000000000,%r8
+  801a08:	00 00 00 
+  801a0b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801a10:	89 c2                	mov    %eax,%edx
+  801a12:	be 00 00 00 00       	mov    $0x0,%esi
+  801a17:	bf 00 00 00 00       	mov    $0x0,%edi
+  801a1c:	48 b8 00 16 80 00 00 	movabs $0x801600,%rax
+  801a23:	00 00 00 
+  801a26:	ff d0                	call   *%rax
+  801a28:	41 89 c4             	mov    %eax,%r12d
+    if (res < 0) {
+  801a2b:	85 c0                	test   %eax,%eax
+  801a2d:	78 5d                	js     801a8c <fork+0xb8>
+        goto error;
+    }
+    res = sys_env_set_pgfault_upcall(child_id, envs[ENVX(sys_getenvid())].env_pgfault_upcall);
+  801a2f:	48 b8 d9 14 80 00 00 	movabs $0x8014d9,%rax
+  801a36:	00 00 00 
+  801a39:	ff d0                	call   *%rax
+  801a3b:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801a40:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+  801a47:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  801a4e:	00 00 00 
+  801a51:	48 01 d0             	add    %rdx,%rax
+  801a54:	48 8b b0 88 01 00 00 	mov    0x188(%rax),%rsi
+  801a5b:	44 89 ef             	mov    %r13d,%edi
+  801a5e:	48 b8 d6 18 80 00 00 	movabs $0x8018d6,%rax
+  801a65:	00 00 00 
+  801a68:	ff d0                	call   *%rax
+  801a6a:	41 89 c4             	mov    %eax,%r12d
+    if (res < 0) {
+  801a6d:	85 c0                	test   %eax,%eax
+  801a6f:	78 1b                	js     801a8c <fork+0xb8>
+        goto error;
+    }
+    res = sys_env_set_status(child_id, ENV_RUNNABLE);
+  801a71:	be 02 00 00 00       	mov    $0x2,%esi
+  801a76:	44 89 ef             	mov    %r13d,%edi
+  801a79:	48 b8 35 17 80 00 00 	movabs $0x801735,%rax
+  801a80:	00 00 00 
+  801a83:	ff d0                	call   *%rax
+  801a85:	41 89 c4             	mov    %eax,%r12d
+    if (res < 0) {
+  801a88:	85 c0                	test   %eax,%eax
+  801a8a:	79 15                	jns    801aa1 <fork+0xcd>
+        goto error;
+    }
+    return child_id;
+error:
+    ;
+    int res2 = sys_env_destroy(child_id);
+  801a8c:	89 df                	mov    %ebx,%edi
+  801a8e:	48 b8 6e 14 80 00 00 	movabs $0x80146e,%rax
+  801a95:	00 00 00 
+  801a98:	ff d0                	call   *%rax
+    if (res2 < 0) {
+  801a9a:	85 c0                	test   %eax,%eax
+  801a9c:	78 42                	js     801ae0 <fork+0x10c>
+        panic("Fork double fault");
+    }
+    return res;
+  801a9e:	45 89 e5             	mov    %r12d,%r13d
+}
+  801aa1:	44 89 e8             	mov    %r13d,%eax
+  801aa4:	48 83 c4 08          	add    $0x8,%rsp
+  801aa8:	5b                   	pop    %rbx
+  801aa9:	41 5c                	pop    %r12
+  801aab:	41 5d                	pop    %r13
+  801aad:	5d                   	pop    %rbp
+  801aae:	c3                   	ret
+        thisenv = &envs[ENVX(sys_getenvid())];
+  801aaf:	48 b8 d9 14 80 00 00 	movabs $0x8014d9,%rax
+  801ab6:	00 00 00 
+  801ab9:	ff d0                	call   *%rax
+  801abb:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801ac0:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+  801ac7:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  801ace:	00 00 00 
+  801ad1:	48 01 d0             	add    %rdx,%rax
+  801ad4:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  801adb:	00 00 00 
+        return 0;
+  801ade:	eb c1                	jmp    801aa1 <fork+0xcd>
+        panic("Fork double fault");
+  801ae0:	48 ba 1d 3a 80 00 00 	movabs $0x803a1d,%rdx
+  801ae7:	00 00 00 
+  801aea:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801aef:	48 bf 2f 3a 80 00 00 	movabs $0x803a2f,%rdi
+  801af6:	00 00 00 
+  801af9:	b8 00 00 00 00       	mov    $0x0,%eax
+  801afe:	48 b9 74 05 80 00 00 	movabs $0x800574,%rcx
+  801b05:	00 00 00 
+  801b08:	ff d1                	call   *%rcx
+
+0000000000801b0a <sfork>:
+
+envid_t
+sfork() {
+  801b0a:	55                   	push   %rbp
+  801b0b:	48 89 e5             	mov    %rsp,%rbp
+    panic("sfork() is not implemented");
+  801b0e:	48 ba 3a 3a 80 00 00 	movabs $0x803a3a,%rdx
+  801b15:	00 00 00 
+  801b18:	be 36 00 00 00       	mov    $0x36,%esi
+  801b1d:	48 bf 2f 3a 80 00 00 	movabs $0x803a2f,%rdi
+  801b24:	00 00 00 
+  801b27:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b2c:	48 b9 74 05 80 00 00 	movabs $0x800574,%rcx
+  801b33:	00 00 00 
+  801b36:	ff d1                	call   *%rcx
+
+0000000000801b38 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801b38:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801b3f:	ff ff ff 
+  801b42:	48 01 f8             	add    %rdi,%rax
+  801b45:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  801b49:	c3                   	ret
+
+0000000000801b4a <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801b4a:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801b51:	ff ff ff 
+  801b54:	48 01 f8             	add    %rdi,%rax
+  801b57:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  801b5b:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  801b61:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  801b65:	c3                   	ret
+
+0000000000801b66 <fd_alloc_from>:
+}
+
+/* Like fd_alloc(), but only considers fds starting from fdnum,
+ * so that several fds can be found before their pages are allocated */
+int
+fd_alloc_from(int fdnum, struct Fd **fd_store) {
+  801b66:	55                   	push   %rbp
+  801b67:	48 89 e5             	mov    %rsp,%rbp
+  801b6a:	41 57                	push   %r15
+  801b6c:	41 56                	push   %r14
+  801b6e:	41 55                	push   %r13
+  801b70:	41 54                	push   %r12
+  801b72:	53                   	push   %rbx
+  801b73:	48 83 ec 08          	sub    $0x8,%rsp
+  801b77:	49 89 f7             	mov    %rsi,%r15
+    for (int i = MAX(fdnum, 0); i < MAXFD; i++) {
+  801b7a:	85 ff                	test   %edi,%edi
+  801b7c:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  801b82:	44 0f 49 e7          	cmovns %edi,%r12d
+  801b86:	83 ff 1f             	cmp    $0x1f,%edi
+  801b89:	7f 37                	jg     801bc2 <fd_alloc_from+0x5c>
+  801b8b:	49 63 dc             	movslq %r12d,%rbx
+  801b8e:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  801b95:	48 c1 e3 0c          	shl    $0xc,%rbx
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  801b99:	49 be 28 2d 80 00 00 	movabs $0x802d28,%r14
+  801ba0:	00 00 00 
+        struct Fd *fd = INDEX2FD(i);
+  801ba3:	49 89 dd             	mov    %rbx,%r13
+        if (!(get_prot(fd) & PROT_R)) {
+  801ba6:	48 89 df             	mov    %rbx,%rdi
+  801ba9:	41 ff d6             	call   *%r14
+  801bac:	83 e0 04             	and    $0x4,%eax
+  801baf:	74 1c                	je     801bcd <fd_alloc_from+0x67>
+    for (int i = MAX(fdnum, 0); i < MAXFD; i++) {
+  801bb1:	41 83 c4 01          	add    $0x1,%r12d
+  801bb5:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801bbc:	41 83 fc 1f          	cmp    $0x1f,%r12d
+  801bc0:	7e e1                	jle    801ba3 <fd_alloc_from+0x3d>
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  801bc2:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801bc8:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  801bcd:	4d 89 2f             	mov    %r13,(%r15)
+}
+  801bd0:	48 83 c4 08          	add    $0x8,%rsp
+  801bd4:	5b                   	pop    %rbx
+  801bd5:	41 5c                	pop    %r12
+  801bd7:	41 5d                	pop    %r13
+  801bd9:	41 5e                	pop    %r14
+  801bdb:	41 5f                	pop    %r15
+  801bdd:	5d                   	pop    %rbp
+  801bde:	c3                   	ret
+
+0000000000801bdf <fd_alloc>:
+fd_alloc(struct Fd **fd_store) {
+  801bdf:	55                   	push   %rbp
+  801be0:	48 89 e5             	mov    %rsp,%rbp
+  801be3:	48 89 fe             	mov    %rdi,%rsi
+    return fd_alloc_from(0, fd_store);
+  801be6:	bf 00 00 00 00       	mov    $0x0,%edi
+  801beb:	48 b8 66 1b 80 00 00 	movabs $0x801b66,%rax
+  801bf2:	00 00 00 
+  801bf5:	ff d0                	call   *%rax
+}
+  801bf7:	5d                   	pop    %rbp
+  801bf8:	c3                   	ret
+
+0000000000801bf9 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  801bf9:	83 ff 1f             	cmp    $0x1f,%edi
+  801bfc:	77 39                	ja     801c37 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  801bfe:	55                   	push   %rbp
+  801bff:	48 89 e5             	mov    %rsp,%rbp
+  801c02:	41 54                	push   %r12
+  801c04:	53                   	push   %rbx
+  801c05:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  801c08:	48 63 df             	movslq %edi,%rbx
+  801c0b:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  801c12:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  801c16:	48 89 df             	mov    %rbx,%rdi
+  801c19:	48 b8 28 2d 80 00 00 	movabs $0x802d28,%rax
+  801c20:	00 00 00 
+  801c23:	ff d0                	call   *%rax
+  801c25:	a8 04                	test   $0x4,%al
+  801c27:	74 14                	je     801c3d <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  801c29:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  801c2d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801c32:	5b                   	pop    %rbx
+  801c33:	41 5c                	pop    %r12
+  801c35:	5d                   	pop    %rbp
+  801c36:	c3                   	ret
+        return -E_INVAL;
+  801c37:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801c3c:	c3                   	ret
+        return -E_INVAL;
+  801c3d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801c42:	eb ee                	jmp    801c32 <fd_lookup+0x39>
+
+0000000000801c44 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  801c44:	55                   	push   %rbp
+  801c45:	48 89 e5             	mov    %rsp,%rbp
+  801c48:	41 54                	push   %r12
+  801c4a:	53                   	push   %rbx
+  801c4b:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  801c4e:	48 b8 e0 3a 80 00 00 	movabs $0x803ae0,%rax
+  801c55:	00 00 00 
+  801c58:	48 bb 20 40 80 00 00 	movabs $0x804020,%rbx
+  801c5f:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  801c62:	39 3b                	cmp    %edi,(%rbx)
+  801c64:	74 47                	je     801cad <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  801c66:	48 83 c0 08          	add    $0x8,%rax
+  801c6a:	48 8b 18             	mov    (%rax),%rbx
+  801c6d:	48 85 db             	test   %rbx,%rbx
+  801c70:	75 f0                	jne    801c62 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801c72:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801c79:	00 00 00 
+  801c7c:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+  801c82:	89 fa                	mov    %edi,%edx
+  801c84:	48 bf 58 3a 80 00 00 	movabs $0x803a58,%rdi
+  801c8b:	00 00 00 
+  801c8e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c93:	48 b9 c4 06 80 00 00 	movabs $0x8006c4,%rcx
+  801c9a:	00 00 00 
+  801c9d:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  801c9f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  801ca4:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  801ca8:	5b                   	pop    %rbx
+  801ca9:	41 5c                	pop    %r12
+  801cab:	5d                   	pop    %rbp
+  801cac:	c3                   	ret
+            return 0;
+  801cad:	b8 00 00 00 00       	mov    $0x0,%eax
+  801cb2:	eb f0                	jmp    801ca4 <dev_lookup+0x60>
+
+0000000000801cb4 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  801cb4:	55                   	push   %rbp
+  801cb5:	48 89 e5             	mov    %rsp,%rbp
+  801cb8:	41 55                	push   %r13
+  801cba:	41 54                	push   %r12
+  801cbc:	53                   	push   %rbx
+  801cbd:	48 83 ec 18          	sub    $0x18,%rsp
+  801cc1:	48 89 fb             	mov    %rdi,%rbx
+  801cc4:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801cc7:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  801cce:	ff ff ff 
+  801cd1:	48 01 df             	add    %rbx,%rdi
+  801cd4:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  801cd8:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801cdc:	48 b8 f9 1b 80 00 00 	movabs $0x801bf9,%rax
+  801ce3:	00 00 00 
+  801ce6:	ff d0                	call   *%rax
+  801ce8:	41 89 c5             	mov    %eax,%r13d
+  801ceb:	85 c0                	test   %eax,%eax
+  801ced:	78 06                	js     801cf5 <fd_close+0x41>
+  801cef:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  801cf3:	74 1a                	je     801d0f <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  801cf5:	45 84 e4             	test   %r12b,%r12b
+  801cf8:	b8 00 00 00 00       	mov    $0x0,%eax
+  801cfd:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  801d01:	44 89 e8             	mov    %r13d,%eax
+  801d04:	48 83 c4 18          	add    $0x18,%rsp
+  801d08:	5b                   	pop    %rbx
+  801d09:	41 5c                	pop    %r12
+  801d0b:	41 5d                	pop    %r13
+  801d0d:	5d                   	pop    %rbp
+  801d0e:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801d0f:	8b 3b                	mov    (%rbx),%edi
+  801d11:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801d15:	48 b8 44 1c 80 00 00 	movabs $0x801c44,%rax
+  801d1c:	00 00 00 
+  801d1f:	ff d0                	call   *%rax
+  801d21:	41 89 c5             	mov    %eax,%r13d
+  801d24:	85 c0                	test   %eax,%eax
+  801d26:	78 1b                	js     801d43 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  801d28:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801d2c:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801d30:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801d36:	48 85 c0             	test   %rax,%rax
+  801d39:	74 08                	je     801d43 <fd_close+0x8f>
+  801d3b:	48 89 df             	mov    %rbx,%rdi
+  801d3e:	ff d0                	call   *%rax
+  801d40:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801d43:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801d48:	48 89 de             	mov    %rbx,%rsi
+  801d4b:	bf 00 00 00 00       	mov    $0x0,%edi
+  801d50:	48 b8 65 16 80 00 00 	movabs $0x801665,%rax
+  801d57:	00 00 00 
+  801d5a:	ff d0                	call   *%rax
+    return res;
+  801d5c:	eb a3                	jmp    801d01 <fd_close+0x4d>
+
+0000000000801d5e <close>:
+
+int
+close(int fdnum) {
+  801d5e:	55                   	push   %rbp
+  801d5f:	48 89 e5             	mov    %rsp,%rbp
+  801d62:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  801d66:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801d6a:	48 b8 f9 1b 80 00 00 	movabs $0x801bf9,%rax
+  801d71:	00 00 00 
+  801d74:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801d76:	85 c0                	test   %eax,%eax
+  801d78:	78 15                	js     801d8f <close+0x31>
+
+    return fd_close(fd, 1);
+  801d7a:	be 01 00 00 00       	mov    $0x1,%esi
+  801d7f:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801d83:	48 b8 b4 1c 80 00 00 	movabs $0x801cb4,%rax
+  801d8a:	00 00 00 
+  801d8d:	ff d0                	call   *%rax
+}
+  801d8f:	c9                   	leave
+  801d90:	c3                   	ret
+
+0000000000801d91 <close_all>:
+
+void
+close_all(void) {
+  801d91:	55                   	push   %rbp
+  801d92:	48 89 e5             	mov    %rsp,%rbp
+  801d95:	41 54                	push   %r12
+  801d97:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  801d98:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801d9d:	49 bc 5e 1d 80 00 00 	movabs $0x801d5e,%r12
+  801da4:	00 00 00 
+  801da7:	89 df                	mov    %ebx,%edi
+  801da9:	41 ff d4             	call   *%r12
+  801dac:	83 c3 01             	add    $0x1,%ebx
+  801daf:	83 fb 20             	cmp    $0x20,%ebx
+  801db2:	75 f3                	jne    801da7 <close_all+0x16>
+}
+  801db4:	5b                   	pop    %rbx
+  801db5:	41 5c                	pop    %r12
+  801db7:	5d                   	pop    %rbp
+  801db8:	c3                   	ret
+
+0000000000801db9 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  801db9:	55                   	push   %rbp
+  801dba:	48 89 e5             	mov    %rsp,%rbp
+  801dbd:	41 57                	push   %r15
+  801dbf:	41 56                	push   %r14
+  801dc1:	41 55                	push   %r13
+  801dc3:	41 54                	push   %r12
+  801dc5:	53                   	push   %rbx
+  801dc6:	48 83 ec 18          	sub    $0x18,%rsp
+  801dca:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  801dcd:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801dd1:	48 b8 f9 1b 80 00 00 	movabs $0x801bf9,%rax
+  801dd8:	00 00 00 
+  801ddb:	ff d0                	call   *%rax
+  801ddd:	89 c3                	mov    %eax,%ebx
+  801ddf:	85 c0                	test   %eax,%eax
+  801de1:	0f 88 b8 00 00 00    	js     801e9f <dup+0xe6>
+    close(newfdnum);
+  801de7:	44 89 e7             	mov    %r12d,%edi
+  801dea:	48 b8 5e 1d 80 00 00 	movabs $0x801d5e,%rax
+  801df1:	00 00 00 
+  801df4:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  801df6:	4d 63 ec             	movslq %r12d,%r13
+  801df9:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  801e00:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  801e04:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  801e08:	4c 89 ff             	mov    %r15,%rdi
+  801e0b:	49 be 4a 1b 80 00 00 	movabs $0x801b4a,%r14
+  801e12:	00 00 00 
+  801e15:	41 ff d6             	call   *%r14
+  801e18:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  801e1b:	4c 89 ef             	mov    %r13,%rdi
+  801e1e:	41 ff d6             	call   *%r14
+  801e21:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  801e24:	48 89 df             	mov    %rbx,%rdi
+  801e27:	48 b8 28 2d 80 00 00 	movabs $0x802d28,%rax
+  801e2e:	00 00 00 
+  801e31:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  801e33:	a8 04                	test   $0x4,%al
+  801e35:	74 2b                	je     801e62 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  801e37:	41 89 c1             	mov    %eax,%r9d
+  801e3a:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801e40:	4c 89 f1             	mov    %r14,%rcx
+  801e43:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e48:	48 89 de             	mov    %rbx,%rsi
+  801e4b:	bf 00 00 00 00       	mov    $0x0,%edi
+  801e50:	48 b8 00 16 80 00 00 	movabs $0x801600,%rax
+  801e57:	00 00 00 
+  801e5a:	ff d0                	call   *%rax
+  801e5c:	89 c3                	mov    %eax,%ebx
+  801e5e:	85 c0                	test   %eax,%eax
+  801e60:	78 4e                	js     801eb0 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  801e62:	4c 89 ff             	mov    %r15,%rdi
+  801e65:	48 b8 28 2d 80 00 00 	movabs $0x802d28,%rax
+  801e6c:	00 00 00 
+  801e6f:	ff d0                	call   *%rax
+  801e71:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801e74:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801e7a:	4c 89 e9             	mov    %r13,%rcx
+  801e7d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e82:	4c 89 fe             	mov    %r15,%rsi
+  801e85:	bf 00 00 00 00       	mov    $0x0,%edi
+  801e8a:	48 b8 00 16 80 00 00 	movabs $0x801600,%rax
+  801e91:	00 00 00 
+  801e94:	ff d0                	call   *%rax
+  801e96:	89 c3                	mov    %eax,%ebx
+  801e98:	85 c0                	test   %eax,%eax
+  801e9a:	78 14                	js     801eb0 <dup+0xf7>
+
+    return newfdnum;
+  801e9c:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  801e9f:	89 d8                	mov    %ebx,%eax
+  801ea1:	48 83 c4 18          	add    $0x18,%rsp
+  801ea5:	5b                   	pop    %rbx
+  801ea6:	41 5c                	pop    %r12
+  801ea8:	41 5d                	pop    %r13
+  801eaa:	41 5e                	pop    %r14
+  801eac:	41 5f                	pop    %r15
+  801eae:	5d                   	pop    %rbp
+  801eaf:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  801eb0:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801eb5:	4c 89 ee             	mov    %r13,%rsi
+  801eb8:	bf 00 00 00 00       	mov    $0x0,%edi
+  801ebd:	49 bc 65 16 80 00 00 	movabs $0x801665,%r12
+  801ec4:	00 00 00 
+  801ec7:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  801eca:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801ecf:	4c 89 f6             	mov    %r14,%rsi
+  801ed2:	bf 00 00 00 00       	mov    $0x0,%edi
+  801ed7:	41 ff d4             	call   *%r12
+    return res;
+  801eda:	eb c3                	jmp    801e9f <dup+0xe6>
+
+0000000000801edc <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  801edc:	55                   	push   %rbp
+  801edd:	48 89 e5             	mov    %rsp,%rbp
+  801ee0:	41 56                	push   %r14
+  801ee2:	41 55                	push   %r13
+  801ee4:	41 54                	push   %r12
+  801ee6:	53                   	push   %rbx
+  801ee7:	48 83 ec 10          	sub    $0x10,%rsp
+  801eeb:	89 fb                	mov    %edi,%ebx
+  801eed:	49 89 f4             	mov    %rsi,%r12
+  801ef0:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801ef3:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801ef7:	48 b8 f9 1b 80 00 00 	movabs $0x801bf9,%rax
+  801efe:	00 00 00 
+  801f01:	ff d0                	call   *%rax
+  801f03:	85 c0                	test   %eax,%eax
+  801f05:	78 4c                	js     801f53 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801f07:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801f0b:	41 8b 3e             	mov    (%r14),%edi
+  801f0e:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801f12:	48 b8 44 1c 80 00 00 	movabs $0x801c44,%rax
+  801f19:	00 00 00 
+  801f1c:	ff d0                	call   *%rax
+  801f1e:	85 c0                	test   %eax,%eax
+  801f20:	78 35                	js     801f57 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801f22:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801f26:	83 e0 03             	and    $0x3,%eax
+  801f29:	83 f8 01             	cmp    $0x1,%eax
+  801f2c:	74 2d                	je     801f5b <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801f2e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801f32:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801f36:	48 85 c0             	test   %rax,%rax
+  801f39:	74 56                	je     801f91 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  801f3b:	4c 89 ea             	mov    %r13,%rdx
+  801f3e:	4c 89 e6             	mov    %r12,%rsi
+  801f41:	4c 89 f7             	mov    %r14,%rdi
+  801f44:	ff d0                	call   *%rax
+}
+  801f46:	48 83 c4 10          	add    $0x10,%rsp
+  801f4a:	5b                   	pop    %rbx
+  801f4b:	41 5c                	pop    %r12
+  801f4d:	41 5d                	pop    %r13
+  801f4f:	41 5e                	pop    %r14
+  801f51:	5d                   	pop    %rbp
+  801f52:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801f53:	48 98                	cltq
+  801f55:	eb ef                	jmp    801f46 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801f57:	48 98                	cltq
+  801f59:	eb eb                	jmp    801f46 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801f5b:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801f62:	00 00 00 
+  801f65:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+  801f6b:	89 da                	mov    %ebx,%edx
+  801f6d:	48 bf 99 3a 80 00 00 	movabs $0x803a99,%rdi
+  801f74:	00 00 00 
+  801f77:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f7c:	48 b9 c4 06 80 00 00 	movabs $0x8006c4,%rcx
+  801f83:	00 00 00 
+  801f86:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801f88:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801f8f:	eb b5                	jmp    801f46 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801f91:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801f98:	eb ac                	jmp    801f46 <read+0x6a>
+
+0000000000801f9a <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801f9a:	55                   	push   %rbp
+  801f9b:	48 89 e5             	mov    %rsp,%rbp
+  801f9e:	41 57                	push   %r15
+  801fa0:	41 56                	push   %r14
+  801fa2:	41 55                	push   %r13
+  801fa4:	41 54                	push   %r12
+  801fa6:	53                   	push   %rbx
+  801fa7:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  801fab:	48 85 d2             	test   %rdx,%rdx
+  801fae:	74 54                	je     802004 <readn+0x6a>
+  801fb0:	41 89 fd             	mov    %edi,%r13d
+  801fb3:	49 89 f6             	mov    %rsi,%r14
+  801fb6:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  801fb9:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  801fbe:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  801fc3:	49 bf dc 1e 80 00 00 	movabs $0x801edc,%r15
+  801fca:	00 00 00 
+  801fcd:	4c 89 e2             	mov    %r12,%rdx
+  801fd0:	48 29 f2             	sub    %rsi,%rdx
+  801fd3:	4c 01 f6             	add    %r14,%rsi
+  801fd6:	44 89 ef             	mov    %r13d,%edi
+  801fd9:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  801fdc:	85 c0                	test   %eax,%eax
+  801fde:	78 20                	js     802000 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  801fe0:	01 c3                	add    %eax,%ebx
+  801fe2:	85 c0                	test   %eax,%eax
+  801fe4:	74 08                	je     801fee <readn+0x54>
+  801fe6:	48 63 f3             	movslq %ebx,%rsi
+  801fe9:	4c 39 e6             	cmp    %r12,%rsi
+  801fec:	72 df                	jb     801fcd <readn+0x33>
+    }
+    return res;
+  801fee:	48 63 c3             	movslq %ebx,%rax
+}
+  801ff1:	48 83 c4 08          	add    $0x8,%rsp
+  801ff5:	5b                   	pop    %rbx
+  801ff6:	41 5c                	pop    %r12
+  801ff8:	41 5d                	pop    %r13
+  801ffa:	41 5e                	pop    %r14
+  801ffc:	41 5f                	pop    %r15
+  801ffe:	5d                   	pop    %rbp
+  801fff:	c3                   	ret
+        if (inc < 0) return inc;
+  802000:	48 98                	cltq
+  802002:	eb ed                	jmp    801ff1 <readn+0x57>
+    int inc = 1, res = 0;
+  802004:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802009:	eb e3                	jmp    801fee <readn+0x54>
+
+000000000080200b <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  80200b:	55                   	push   %rbp
+  80200c:	48 89 e5             	mov    %rsp,%rbp
+  80200f:	41 56                	push   %r14
+  802011:	41 55                	push   %r13
+  802013:	41 54                	push   %r12
+  802015:	53                   	push   %rbx
+  802016:	48 83 ec 10          	sub    $0x10,%rsp
+  80201a:	89 fb                	mov    %edi,%ebx
+  80201c:	49 89 f4             	mov    %rsi,%r12
+  80201f:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802022:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802026:	48 b8 f9 1b 80 00 00 	movabs $0x801bf9,%rax
+  80202d:	00 00 00 
+  802030:	ff d0                	call   *%rax
+  802032:	85 c0                	test   %eax,%eax
+  802034:	78 47                	js     80207d <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802036:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  80203a:	41 8b 3e             	mov    (%r14),%edi
+  80203d:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802041:	48 b8 44 1c 80 00 00 	movabs $0x801c44,%rax
+  802048:	00 00 00 
+  80204b:	ff d0                	call   *%rax
+  80204d:	85 c0                	test   %eax,%eax
+  80204f:	78 30                	js     802081 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802051:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  802056:	74 2d                	je     802085 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  802058:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80205c:	48 8b 40 18          	mov    0x18(%rax),%rax
+  802060:	48 85 c0             	test   %rax,%rax
+  802063:	74 56                	je     8020bb <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  802065:	4c 89 ea             	mov    %r13,%rdx
+  802068:	4c 89 e6             	mov    %r12,%rsi
+  80206b:	4c 89 f7             	mov    %r14,%rdi
+  80206e:	ff d0                	call   *%rax
+}
+  802070:	48 83 c4 10          	add    $0x10,%rsp
+  802074:	5b                   	pop    %rbx
+  802075:	41 5c                	pop    %r12
+  802077:	41 5d                	pop    %r13
+  802079:	41 5e                	pop    %r14
+  80207b:	5d                   	pop    %rbp
+  80207c:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80207d:	48 98                	cltq
+  80207f:	eb ef                	jmp    802070 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802081:	48 98                	cltq
+  802083:	eb eb                	jmp    802070 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  802085:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  80208c:	00 00 00 
+  80208f:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+  802095:	89 da                	mov    %ebx,%edx
+  802097:	48 bf b5 3a 80 00 00 	movabs $0x803ab5,%rdi
+  80209e:	00 00 00 
+  8020a1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020a6:	48 b9 c4 06 80 00 00 	movabs $0x8006c4,%rcx
+  8020ad:	00 00 00 
+  8020b0:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8020b2:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8020b9:	eb b5                	jmp    802070 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  8020bb:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  8020c2:	eb ac                	jmp    802070 <write+0x65>
+
+00000000008020c4 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  8020c4:	55                   	push   %rbp
+  8020c5:	48 89 e5             	mov    %rsp,%rbp
+  8020c8:	53                   	push   %rbx
+  8020c9:	48 83 ec 18          	sub    $0x18,%rsp
+  8020cd:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8020cf:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8020d3:	48 b8 f9 1b 80 00 00 	movabs $0x801bf9,%rax
+  8020da:	00 00 00 
+  8020dd:	ff d0                	call   *%rax
+  8020df:	85 c0                	test   %eax,%eax
+  8020e1:	78 0c                	js     8020ef <seek+0x2b>
+
+    fd->fd_offset = offset;
+  8020e3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8020e7:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  8020ea:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8020ef:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8020f3:	c9                   	leave
+  8020f4:	c3                   	ret
+
+00000000008020f5 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  8020f5:	55                   	push   %rbp
+  8020f6:	48 89 e5             	mov    %rsp,%rbp
+  8020f9:	41 55                	push   %r13
+  8020fb:	41 54                	push   %r12
+  8020fd:	53                   	push   %rbx
+  8020fe:	48 83 ec 18          	sub    $0x18,%rsp
+  802102:	89 fb                	mov    %edi,%ebx
+  802104:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802107:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80210b:	48 b8 f9 1b 80 00 00 	movabs $0x801bf9,%rax
+  802112:	00 00 00 
+  802115:	ff d0                	call   *%rax
+  802117:	85 c0                	test   %eax,%eax
+  802119:	78 38                	js     802153 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80211b:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  80211f:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  802123:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802127:	48 b8 44 1c 80 00 00 	movabs $0x801c44,%rax
+  80212e:	00 00 00 
+  802131:	ff d0                	call   *%rax
+  802133:	85 c0                	test   %eax,%eax
+  802135:	78 1c                	js     802153 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802137:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  80213c:	74 20                	je     80215e <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  80213e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802142:	48 8b 40 30          	mov    0x30(%rax),%rax
+  802146:	48 85 c0             	test   %rax,%rax
+  802149:	74 47                	je     802192 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  80214b:	44 89 e6             	mov    %r12d,%esi
+  80214e:	4c 89 ef             	mov    %r13,%rdi
+  802151:	ff d0                	call   *%rax
+}
+  802153:	48 83 c4 18          	add    $0x18,%rsp
+  802157:	5b                   	pop    %rbx
+  802158:	41 5c                	pop    %r12
+  80215a:	41 5d                	pop    %r13
+  80215c:	5d                   	pop    %rbp
+  80215d:	c3                   	ret
+                thisenv->env_id, fdnum);
+  80215e:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802165:	00 00 00 
+  802168:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  80216e:	89 da                	mov    %ebx,%edx
+  802170:	48 bf 78 3a 80 00 00 	movabs $0x803a78,%rdi
+  802177:	00 00 00 
+  80217a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80217f:	48 b9 c4 06 80 00 00 	movabs $0x8006c4,%rcx
+  802186:	00 00 00 
+  802189:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  80218b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802190:	eb c1                	jmp    802153 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  802192:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802197:	eb ba                	jmp    802153 <ftruncate+0x5e>
+
+0000000000802199 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  802199:	55                   	push   %rbp
+  80219a:	48 89 e5             	mov    %rsp,%rbp
+  80219d:	41 54                	push   %r12
+  80219f:	53                   	push   %rbx
+  8021a0:	48 83 ec 10          	sub    $0x10,%rsp
+  8021a4:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8021a7:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8021ab:	48 b8 f9 1b 80 00 00 	movabs $0x801bf9,%rax
+  8021b2:	00 00 00 
+  8021b5:	ff d0                	call   *%rax
+  8021b7:	85 c0                	test   %eax,%eax
+  8021b9:	78 4e                	js     802209 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8021bb:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  8021bf:	41 8b 3c 24          	mov    (%r12),%edi
+  8021c3:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  8021c7:	48 b8 44 1c 80 00 00 	movabs $0x801c44,%rax
+  8021ce:	00 00 00 
+  8021d1:	ff d0                	call   *%rax
+  8021d3:	85 c0                	test   %eax,%eax
+  8021d5:	78 32                	js     802209 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  8021d7:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8021db:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  8021e0:	74 30                	je     802212 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  8021e2:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  8021e5:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  8021ec:	00 00 00 
+    stat->st_isdir = 0;
+  8021ef:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8021f6:	00 00 00 
+    stat->st_dev = dev;
+  8021f9:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  802200:	48 89 de             	mov    %rbx,%rsi
+  802203:	4c 89 e7             	mov    %r12,%rdi
+  802206:	ff 50 28             	call   *0x28(%rax)
+}
+  802209:	48 83 c4 10          	add    $0x10,%rsp
+  80220d:	5b                   	pop    %rbx
+  80220e:	41 5c                	pop    %r12
+  802210:	5d                   	pop    %rbp
+  802211:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  802212:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802217:	eb f0                	jmp    802209 <fstat+0x70>
+
+0000000000802219 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  802219:	55                   	push   %rbp
+  80221a:	48 89 e5             	mov    %rsp,%rbp
+  80221d:	41 54                	push   %r12
+  80221f:	53                   	push   %rbx
+  802220:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  802223:	be 00 00 00 00       	mov    $0x0,%esi
+  802228:	48 b8 fc 25 80 00 00 	movabs $0x8025fc,%rax
+  80222f:	00 00 00 
+  802232:	ff d0                	call   *%rax
+  802234:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  802236:	85 c0                	test   %eax,%eax
+  802238:	78 25                	js     80225f <stat+0x46>
+
+    int res = fstat(fd, stat);
+  80223a:	4c 89 e6             	mov    %r12,%rsi
+  80223d:	89 c7                	mov    %eax,%edi
+  80223f:	48 b8 99 21 80 00 00 	movabs $0x802199,%rax
+  802246:	00 00 00 
+  802249:	ff d0                	call   *%rax
+  80224b:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  80224e:	89 df                	mov    %ebx,%edi
+  802250:	48 b8 5e 1d 80 00 00 	movabs $0x801d5e,%rax
+  802257:	00 00 00 
+  80225a:	ff d0                	call   *%rax
+
+    return res;
+  80225c:	44 89 e3             	mov    %r12d,%ebx
+}
+  80225f:	89 d8                	mov    %ebx,%eax
+  802261:	5b                   	pop    %rbx
+  802262:	41 5c                	pop    %r12
+  802264:	5d                   	pop    %rbp
+  802265:	c3                   	ret
+
+0000000000802266 <fsipc>:
+ * response may be written back to fsipcbuf.
+ * type: request code, passed as the simple integer IPC value.
+ * dstva: virtual address at which to receive reply page, 0 if none.
+ * Returns result from the file server. */
+static int
+fsipc(unsigned type, void *dstva) {
+  802266:	55                   	push   %rbp
+  802267:	48 89 e5             	mov    %rsp,%rbp
+  80226a:	41 54                	push   %r12
+  80226c:	53                   	push   %rbx
+  80226d:	48 83 ec 10          	sub    $0x10,%rsp
+  802271:	41 89 fc             	mov    %edi,%r12d
+  802274:	48 89 f3             	mov    %rsi,%rbx
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802277:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  80227e:	00 00 00 
+  802281:	83 38 00             	cmpl   $0x0,(%rax)
+  802284:	74 5e                	je     8022e4 <fsipc+0x7e>
+    if (debug) {
+        cprintf("[%08x] fsipc %d %08x\n",
+                thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+    }
+
+    ipc_send(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW);
+  802286:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  80228c:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802291:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  802298:	00 00 00 
+  80229b:	44 89 e6             	mov    %r12d,%esi
+  80229e:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  8022a5:	00 00 00 
+  8022a8:	8b 38                	mov    (%rax),%edi
+  8022aa:	48 b8 1c 32 80 00 00 	movabs $0x80321c,%rax
+  8022b1:	00 00 00 
+  8022b4:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  8022b6:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  8022bd:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  8022be:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8022c3:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  8022c7:	48 89 de             	mov    %rbx,%rsi
+  8022ca:	bf 00 00 00 00       	mov    $0x0,%edi
+  8022cf:	48 b8 47 31 80 00 00 	movabs $0x803147,%rax
+  8022d6:	00 00 00 
+  8022d9:	ff d0                	call   *%rax
+}
+  8022db:	48 83 c4 10          	add    $0x10,%rsp
+  8022df:	5b                   	pop    %rbx
+  8022e0:	41 5c                	pop    %r12
+  8022e2:	5d                   	pop    %rbp
+  8022e3:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8022e4:	bf 03 00 00 00       	mov    $0x3,%edi
+  8022e9:	48 b8 bf 32 80 00 00 	movabs $0x8032bf,%rax
+  8022f0:	00 00 00 
+  8022f3:	ff d0                	call   *%rax
+  8022f5:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  8022fc:	00 00 
+  8022fe:	eb 86                	jmp    802286 <fsipc+0x20>
+
+0000000000802300 <devfile_trunc>:
+    return 0;
+}
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  802300:	55                   	push   %rbp
+  802301:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802304:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  80230b:	00 00 00 
+  80230e:	8b 57 0c             	mov    0xc(%rdi),%edx
+  802311:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  802313:	89 70 04             	mov    %esi,0x4(%rax)
+
+    return fsipc(FSREQ_SET_SIZE, NULL);
+  802316:	be 00 00 00 00       	mov    $0x0,%esi
+  80231b:	bf 02 00 00 00       	mov    $0x2,%edi
+  802320:	48 b8 66 22 80 00 00 	movabs $0x802266,%rax
+  802327:	00 00 00 
+  80232a:	ff d0                	call   *%rax
+}
+  80232c:	5d                   	pop    %rbp
+  80232d:	c3                   	ret
+
+000000000080232e <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  80232e:	55                   	push   %rbp
+  80232f:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  802332:	8b 47 0c             	mov    0xc(%rdi),%eax
+  802335:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  80233c:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  80233e:	be 00 00 00 00       	mov    $0x0,%esi
+  802343:	bf 06 00 00 00       	mov    $0x6,%edi
+  802348:	48 b8 66 22 80 00 00 	movabs $0x802266,%rax
+  80234f:	00 00 00 
+  802352:	ff d0                	call   *%rax
+}
+  802354:	5d                   	pop    %rbp
+  802355:	c3                   	ret
+
+0000000000802356 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  802356:	55                   	push   %rbp
+  802357:	48 89 e5             	mov    %rsp,%rbp
+  80235a:	41 54                	push   %r12
+  80235c:	53                   	push   %rbx
+  80235d:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802360:	8b 47 0c             	mov    0xc(%rdi),%eax
+  802363:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  80236a:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  80236c:	be 00 00 00 00       	mov    $0x0,%esi
+  802371:	bf 05 00 00 00       	mov    $0x5,%edi
+  802376:	48 b8 66 22 80 00 00 	movabs $0x802266,%rax
+  80237d:	00 00 00 
+  802380:	ff d0                	call   *%rax
+    if (res < 0) {
+  802382:	85 c0                	test   %eax,%eax
+  802384:	78 3d                	js     8023c3 <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802386:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  80238d:	00 00 00 
+  802390:	4c 89 e6             	mov    %r12,%rsi
+  802393:	48 89 df             	mov    %rbx,%rdi
+  802396:	48 b8 e9 0f 80 00 00 	movabs $0x800fe9,%rax
+  80239d:	00 00 00 
+  8023a0:	ff d0                	call   *%rax
+    st->st_size  = fsipcbuf.statRet.ret_size;
+  8023a2:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  8023a9:	00 
+  8023aa:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8023b0:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  8023b7:	00 
+  8023b8:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  8023be:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8023c3:	5b                   	pop    %rbx
+  8023c4:	41 5c                	pop    %r12
+  8023c6:	5d                   	pop    %rbp
+  8023c7:	c3                   	ret
+
+00000000008023c8 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  8023c8:	55                   	push   %rbp
+  8023c9:	48 89 e5             	mov    %rsp,%rbp
+  8023cc:	41 57                	push   %r15
+  8023ce:	41 56                	push   %r14
+  8023d0:	41 55                	push   %r13
+  8023d2:	41 54                	push   %r12
+  8023d4:	53                   	push   %rbx
+  8023d5:	48 83 ec 18          	sub    $0x18,%rsp
+  8023d9:	49 89 fe             	mov    %rdi,%r14
+  8023dc:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+  8023e0:	48 89 d3             	mov    %rdx,%rbx
+    while (n > sizeof(fsipcbuf.write.req_buf))
+  8023e3:	48 81 fa f0 0f 00 00 	cmp    $0xff0,%rdx
+  8023ea:	0f 86 e4 00 00 00    	jbe    8024d4 <devfile_write+0x10c>
+  8023f0:	49 89 f4             	mov    %rsi,%r12
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8023f3:	49 bd 00 60 80 00 00 	movabs $0x806000,%r13
+  8023fa:	00 00 00 
+        memcpy(fsipcbuf.write.req_buf, buf, sizeof(fsipcbuf.write.req_buf));
+  8023fd:	49 bf 4a 12 80 00 00 	movabs $0x80124a,%r15
+  802404:	00 00 00 
+  802407:	eb 03                	jmp    80240c <devfile_write+0x44>
+        buf += sizeof(fsipcbuf.write.req_buf);
+  802409:	49 89 f4             	mov    %rsi,%r12
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  80240c:	41 8b 46 0c          	mov    0xc(%r14),%eax
+  802410:	41 89 45 00          	mov    %eax,0x0(%r13)
+        fsipcbuf.write.req_n      = sizeof(fsipcbuf.write.req_buf);
+  802414:	49 c7 45 08 f0 0f 00 	movq   $0xff0,0x8(%r13)
+  80241b:	00 
+        memcpy(fsipcbuf.write.req_buf, buf, sizeof(fsipcbuf.write.req_buf));
+  80241c:	ba f0 0f 00 00       	mov    $0xff0,%edx
+  802421:	4c 89 e6             	mov    %r12,%rsi
+  802424:	48 bf 10 60 80 00 00 	movabs $0x806010,%rdi
+  80242b:	00 00 00 
+  80242e:	41 ff d7             	call   *%r15
+        ssize_t res = fsipc(FSREQ_WRITE, NULL);
+  802431:	be 00 00 00 00       	mov    $0x0,%esi
+  802436:	bf 04 00 00 00       	mov    $0x4,%edi
+  80243b:	48 b8 66 22 80 00 00 	movabs $0x802266,%rax
+  802442:	00 00 00 
+  802445:	ff d0                	call   *%rax
+  802447:	48 63 d0             	movslq %eax,%rdx
+        if (res < 0 || res < sizeof(fsipcbuf.write.req_buf))
+  80244a:	3d ef 0f 00 00       	cmp    $0xfef,%eax
+  80244f:	7e 71                	jle    8024c2 <devfile_write+0xfa>
+        buf += sizeof(fsipcbuf.write.req_buf);
+  802451:	49 8d b4 24 f0 0f 00 	lea    0xff0(%r12),%rsi
+  802458:	00 
+        n -= sizeof(fsipcbuf.write.req_buf);
+  802459:	48 81 eb f0 0f 00 00 	sub    $0xff0,%rbx
+    while (n > sizeof(fsipcbuf.write.req_buf))
+  802460:	48 81 fb f0 0f 00 00 	cmp    $0xff0,%rbx
+  802467:	77 a0                	ja     802409 <devfile_write+0x41>
+        written += sizeof(fsipcbuf.write.req_buf);
+  802469:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80246d:	49 29 c4             	sub    %rax,%r12
+  802470:	4d 8d a4 24 f0 0f 00 	lea    0xff0(%r12),%r12
+  802477:	00 
+    fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802478:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  80247f:	00 00 00 
+  802482:	41 8b 56 0c          	mov    0xc(%r14),%edx
+  802486:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.write.req_n      = n;
+  802488:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    memcpy(fsipcbuf.write.req_buf, buf, n);
+  80248c:	48 89 da             	mov    %rbx,%rdx
+  80248f:	48 8d 78 10          	lea    0x10(%rax),%rdi
+  802493:	48 b8 4a 12 80 00 00 	movabs $0x80124a,%rax
+  80249a:	00 00 00 
+  80249d:	ff d0                	call   *%rax
+    ssize_t res = fsipc(FSREQ_WRITE, NULL);
+  80249f:	be 00 00 00 00       	mov    $0x0,%esi
+  8024a4:	bf 04 00 00 00       	mov    $0x4,%edi
+  8024a9:	48 b8 66 22 80 00 00 	movabs $0x802266,%rax
+  8024b0:	00 00 00 
+  8024b3:	ff d0                	call   *%rax
+  8024b5:	48 63 d0             	movslq %eax,%rdx
+    written += res;
+  8024b8:	49 01 d4             	add    %rdx,%r12
+  8024bb:	48 85 d2             	test   %rdx,%rdx
+  8024be:	49 0f 49 d4          	cmovns %r12,%rdx
+}
+  8024c2:	48 89 d0             	mov    %rdx,%rax
+  8024c5:	48 83 c4 18          	add    $0x18,%rsp
+  8024c9:	5b                   	pop    %rbx
+  8024ca:	41 5c                	pop    %r12
+  8024cc:	41 5d                	pop    %r13
+  8024ce:	41 5e                	pop    %r14
+  8024d0:	41 5f                	pop    %r15
+  8024d2:	5d                   	pop    %rbp
+  8024d3:	c3                   	ret
+    while (n > sizeof(fsipcbuf.write.req_buf))
+  8024d4:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+    ssize_t written = 0;
+  8024d8:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8024de:	eb 98                	jmp    802478 <devfile_write+0xb0>
+
+00000000008024e0 <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  8024e0:	55                   	push   %rbp
+  8024e1:	48 89 e5             	mov    %rsp,%rbp
+  8024e4:	41 57                	push   %r15
+  8024e6:	41 56                	push   %r14
+  8024e8:	41 55                	push   %r13
+  8024ea:	41 54                	push   %r12
+  8024ec:	53                   	push   %rbx
+  8024ed:	48 83 ec 18          	sub    $0x18,%rsp
+  8024f1:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  8024f5:	49 89 f6             	mov    %rsi,%r14
+  8024f8:	49 89 d4             	mov    %rdx,%r12
+    while (n > sizeof(fsipcbuf.readRet.ret_buf))
+  8024fb:	48 81 fa 00 10 00 00 	cmp    $0x1000,%rdx
+  802502:	0f 86 ea 00 00 00    	jbe    8025f2 <devfile_read+0x112>
+    ssize_t readsz = 0;
+  802508:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  80250f:	00 
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802510:	49 bf 00 60 80 00 00 	movabs $0x806000,%r15
+  802517:	00 00 00 
+  80251a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80251e:	8b 40 0c             	mov    0xc(%rax),%eax
+  802521:	41 89 07             	mov    %eax,(%r15)
+        fsipcbuf.read.req_n = sizeof(fsipcbuf.readRet.ret_buf);
+  802524:	49 c7 47 08 00 10 00 	movq   $0x1000,0x8(%r15)
+  80252b:	00 
+        ssize_t res = fsipc(FSREQ_READ, NULL);
+  80252c:	be 00 00 00 00       	mov    $0x0,%esi
+  802531:	bf 03 00 00 00       	mov    $0x3,%edi
+  802536:	48 b8 66 22 80 00 00 	movabs $0x802266,%rax
+  80253d:	00 00 00 
+  802540:	ff d0                	call   *%rax
+  802542:	4c 63 e8             	movslq %eax,%r13
+        if (res < 0)
+  802545:	4d 85 ed             	test   %r13,%r13
+  802548:	0f 88 92 00 00 00    	js     8025e0 <devfile_read+0x100>
+        memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  80254e:	4c 89 ea             	mov    %r13,%rdx
+  802551:	4c 89 fe             	mov    %r15,%rsi
+  802554:	4c 89 f7             	mov    %r14,%rdi
+  802557:	48 b8 4a 12 80 00 00 	movabs $0x80124a,%rax
+  80255e:	00 00 00 
+  802561:	ff d0                	call   *%rax
+        if (res < sizeof(fsipcbuf.readRet.ret_buf))
+  802563:	49 81 fd ff 0f 00 00 	cmp    $0xfff,%r13
+  80256a:	76 6d                	jbe    8025d9 <devfile_read+0xf9>
+        readsz += res;
+  80256c:	4c 01 6d c0          	add    %r13,-0x40(%rbp)
+        buf += res;
+  802570:	4d 01 ee             	add    %r13,%r14
+        n -= res;
+  802573:	4d 29 ec             	sub    %r13,%r12
+    while (n > sizeof(fsipcbuf.readRet.ret_buf))
+  802576:	49 81 fc 00 10 00 00 	cmp    $0x1000,%r12
+  80257d:	77 9b                	ja     80251a <devfile_read+0x3a>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  80257f:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  802586:	00 00 00 
+  802589:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  80258d:	8b 51 0c             	mov    0xc(%rcx),%edx
+  802590:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.read.req_n = n;
+  802592:	4c 89 60 08          	mov    %r12,0x8(%rax)
+    ssize_t res = fsipc(FSREQ_READ, NULL);
+  802596:	be 00 00 00 00       	mov    $0x0,%esi
+  80259b:	bf 03 00 00 00       	mov    $0x3,%edi
+  8025a0:	48 b8 66 22 80 00 00 	movabs $0x802266,%rax
+  8025a7:	00 00 00 
+  8025aa:	ff d0                	call   *%rax
+  8025ac:	4c 63 e8             	movslq %eax,%r13
+    if (res < 0)
+  8025af:	4d 85 ed             	test   %r13,%r13
+  8025b2:	78 2c                	js     8025e0 <devfile_read+0x100>
+    memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  8025b4:	4c 89 ea             	mov    %r13,%rdx
+  8025b7:	48 be 00 60 80 00 00 	movabs $0x806000,%rsi
+  8025be:	00 00 00 
+  8025c1:	4c 89 f7             	mov    %r14,%rdi
+  8025c4:	48 b8 4a 12 80 00 00 	movabs $0x80124a,%rax
+  8025cb:	00 00 00 
+  8025ce:	ff d0                	call   *%rax
+    readsz += res;
+  8025d0:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8025d4:	49 01 c5             	add    %rax,%r13
+    return readsz;
+  8025d7:	eb 07                	jmp    8025e0 <devfile_read+0x100>
+            return readsz + res;
+  8025d9:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8025dd:	49 01 c5             	add    %rax,%r13
+}
+  8025e0:	4c 89 e8             	mov    %r13,%rax
+  8025e3:	48 83 c4 18          	add    $0x18,%rsp
+  8025e7:	5b                   	pop    %rbx
+  8025e8:	41 5c                	pop    %r12
+  8025ea:	41 5d                	pop    %r13
+  8025ec:	41 5e                	pop    %r14
+  8025ee:	41 5f                	pop    %r15
+  8025f0:	5d                   	pop    %rbp
+  8025f1:	c3                   	ret
+    ssize_t readsz = 0;
+  8025f2:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  8025f9:	00 
+  8025fa:	eb 83                	jmp    80257f <devfile_read+0x9f>
+
+00000000008025fc <open>:
+open(const char *path, int mode) {
+  8025fc:	55                   	push   %rbp
+  8025fd:	48 89 e5             	mov    %rsp,%rbp
+  802600:	41 55                	push   %r13
+  802602:	41 54                	push   %r12
+  802604:	53                   	push   %rbx
+  802605:	48 83 ec 18          	sub    $0x18,%rsp
+  802609:	49 89 fc             	mov    %rdi,%r12
+  80260c:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  80260f:	48 b8 ab 0f 80 00 00 	movabs $0x800fab,%rax
+  802616:	00 00 00 
+  802619:	ff d0                	call   *%rax
+  80261b:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802621:	0f 87 8a 00 00 00    	ja     8026b1 <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802627:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  80262b:	48 b8 df 1b 80 00 00 	movabs $0x801bdf,%rax
+  802632:	00 00 00 
+  802635:	ff d0                	call   *%rax
+  802637:	89 c3                	mov    %eax,%ebx
+  802639:	85 c0                	test   %eax,%eax
+  80263b:	78 50                	js     80268d <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  80263d:	4c 89 e6             	mov    %r12,%rsi
+  802640:	48 bb 00 60 80 00 00 	movabs $0x806000,%rbx
+  802647:	00 00 00 
+  80264a:	48 89 df             	mov    %rbx,%rdi
+  80264d:	48 b8 e9 0f 80 00 00 	movabs $0x800fe9,%rax
+  802654:	00 00 00 
+  802657:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  802659:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  802660:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802664:	bf 01 00 00 00       	mov    $0x1,%edi
+  802669:	48 b8 66 22 80 00 00 	movabs $0x802266,%rax
+  802670:	00 00 00 
+  802673:	ff d0                	call   *%rax
+  802675:	89 c3                	mov    %eax,%ebx
+  802677:	85 c0                	test   %eax,%eax
+  802679:	78 1f                	js     80269a <open+0x9e>
+    return fd2num(fd);
+  80267b:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80267f:	48 b8 38 1b 80 00 00 	movabs $0x801b38,%rax
+  802686:	00 00 00 
+  802689:	ff d0                	call   *%rax
+  80268b:	89 c3                	mov    %eax,%ebx
+}
+  80268d:	89 d8                	mov    %ebx,%eax
+  80268f:	48 83 c4 18          	add    $0x18,%rsp
+  802693:	5b                   	pop    %rbx
+  802694:	41 5c                	pop    %r12
+  802696:	41 5d                	pop    %r13
+  802698:	5d                   	pop    %rbp
+  802699:	c3                   	ret
+        fd_close(fd, 0);
+  80269a:	be 00 00 00 00       	mov    $0x0,%esi
+  80269f:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8026a3:	48 b8 b4 1c 80 00 00 	movabs $0x801cb4,%rax
+  8026aa:	00 00 00 
+  8026ad:	ff d0                	call   *%rax
+        return res;
+  8026af:	eb dc                	jmp    80268d <open+0x91>
+        return -E_BAD_PATH;
+  8026b1:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  8026b6:	eb d5                	jmp    80268d <open+0x91>
+
+00000000008026b8 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  8026b8:	55                   	push   %rbp
+  8026b9:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc(FSREQ_SYNC, NULL);
+  8026bc:	be 00 00 00 00       	mov    $0x0,%esi
+  8026c1:	bf 08 00 00 00       	mov    $0x8,%edi
+  8026c6:	48 b8 66 22 80 00 00 	movabs $0x802266,%rax
+  8026cd:	00 00 00 
+  8026d0:	ff d0                	call   *%rax
+}
+  8026d2:	5d                   	pop    %rbp
+  8026d3:	c3                   	ret
+
+00000000008026d4 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  8026d4:	55                   	push   %rbp
+  8026d5:	48 89 e5             	mov    %rsp,%rbp
+  8026d8:	41 54                	push   %r12
+  8026da:	53                   	push   %rbx
+  8026db:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8026de:	48 b8 4a 1b 80 00 00 	movabs $0x801b4a,%rax
+  8026e5:	00 00 00 
+  8026e8:	ff d0                	call   *%rax
+  8026ea:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  8026ed:	48 be 00 3b 80 00 00 	movabs $0x803b00,%rsi
+  8026f4:	00 00 00 
+  8026f7:	48 89 df             	mov    %rbx,%rdi
+  8026fa:	48 b8 e9 0f 80 00 00 	movabs $0x800fe9,%rax
+  802701:	00 00 00 
+  802704:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  802706:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  80270b:	41 2b 04 24          	sub    (%r12),%eax
+  80270f:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  802715:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  80271c:	00 00 00 
+    stat->st_dev = &devpipe;
+  80271f:	48 b8 60 40 80 00 00 	movabs $0x804060,%rax
+  802726:	00 00 00 
+  802729:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  802730:	b8 00 00 00 00       	mov    $0x0,%eax
+  802735:	5b                   	pop    %rbx
+  802736:	41 5c                	pop    %r12
+  802738:	5d                   	pop    %rbp
+  802739:	c3                   	ret
+
+000000000080273a <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  80273a:	55                   	push   %rbp
+  80273b:	48 89 e5             	mov    %rsp,%rbp
+  80273e:	41 54                	push   %r12
+  802740:	53                   	push   %rbx
+  802741:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  802744:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802749:	48 89 fe             	mov    %rdi,%rsi
+  80274c:	bf 00 00 00 00       	mov    $0x0,%edi
+  802751:	49 bc 65 16 80 00 00 	movabs $0x801665,%r12
+  802758:	00 00 00 
+  80275b:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  80275e:	48 89 df             	mov    %rbx,%rdi
+  802761:	48 b8 4a 1b 80 00 00 	movabs $0x801b4a,%rax
+  802768:	00 00 00 
+  80276b:	ff d0                	call   *%rax
+  80276d:	48 89 c6             	mov    %rax,%rsi
+  802770:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802775:	bf 00 00 00 00       	mov    $0x0,%edi
+  80277a:	41 ff d4             	call   *%r12
+}
+  80277d:	5b                   	pop    %rbx
+  80277e:	41 5c                	pop    %r12
+  802780:	5d                   	pop    %rbp
+  802781:	c3                   	ret
+
+0000000000802782 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  802782:	55                   	push   %rbp
+  802783:	48 89 e5             	mov    %rsp,%rbp
+  802786:	41 57                	push   %r15
+  802788:	41 56                	push   %r14
+  80278a:	41 55                	push   %r13
+  80278c:	41 54                	push   %r12
+  80278e:	53                   	push   %rbx
+  80278f:	48 83 ec 18          	sub    $0x18,%rsp
+  802793:	49 89 fc             	mov    %rdi,%r12
+  802796:	49 89 f5             	mov    %rsi,%r13
+  802799:	49 89 d7             	mov    %rdx,%r15
+  80279c:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8027a0:	48 b8 4a 1b 80 00 00 	movabs $0x801b4a,%rax
+  8027a7:	00 00 00 
+  8027aa:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  8027ac:	4d 85 ff             	test   %r15,%r15
+  8027af:	0f 84 af 00 00 00    	je     802864 <devpipe_write+0xe2>
+  8027b5:	48 89 c3             	mov    %rax,%rbx
+  8027b8:	4c 89 f8             	mov    %r15,%rax
+  8027bb:	4d 89 ef             	mov    %r13,%r15
+  8027be:	4c 01 e8             	add    %r13,%rax
+  8027c1:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8027c5:	49 bd 6d 15 80 00 00 	movabs $0x80156d,%r13
+  8027cc:	00 00 00 
+            sys_yield();
+  8027cf:	49 be 0a 15 80 00 00 	movabs $0x80150a,%r14
+  8027d6:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  8027d9:	8b 73 04             	mov    0x4(%rbx),%esi
+  8027dc:	48 63 ce             	movslq %esi,%rcx
+  8027df:	48 63 03             	movslq (%rbx),%rax
+  8027e2:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  8027e8:	48 39 c1             	cmp    %rax,%rcx
+  8027eb:	72 2e                	jb     80281b <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8027ed:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8027f2:	48 89 da             	mov    %rbx,%rdx
+  8027f5:	be 00 10 00 00       	mov    $0x1000,%esi
+  8027fa:	4c 89 e7             	mov    %r12,%rdi
+  8027fd:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  802800:	85 c0                	test   %eax,%eax
+  802802:	74 66                	je     80286a <devpipe_write+0xe8>
+            sys_yield();
+  802804:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  802807:	8b 73 04             	mov    0x4(%rbx),%esi
+  80280a:	48 63 ce             	movslq %esi,%rcx
+  80280d:	48 63 03             	movslq (%rbx),%rax
+  802810:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  802816:	48 39 c1             	cmp    %rax,%rcx
+  802819:	73 d2                	jae    8027ed <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  80281b:	41 0f b6 3f          	movzbl (%r15),%edi
+  80281f:	48 89 ca             	mov    %rcx,%rdx
+  802822:	48 c1 ea 03          	shr    $0x3,%rdx
+  802826:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  80282d:	08 10 20 
+  802830:	48 f7 e2             	mul    %rdx
+  802833:	48 c1 ea 06          	shr    $0x6,%rdx
+  802837:	48 89 d0             	mov    %rdx,%rax
+  80283a:	48 c1 e0 09          	shl    $0x9,%rax
+  80283e:	48 29 d0             	sub    %rdx,%rax
+  802841:	48 c1 e0 03          	shl    $0x3,%rax
+  802845:	48 29 c1             	sub    %rax,%rcx
+  802848:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  80284d:	83 c6 01             	add    $0x1,%esi
+  802850:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  802853:	49 83 c7 01          	add    $0x1,%r15
+  802857:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80285b:	49 39 c7             	cmp    %rax,%r15
+  80285e:	0f 85 75 ff ff ff    	jne    8027d9 <devpipe_write+0x57>
+    return n;
+  802864:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802868:	eb 05                	jmp    80286f <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  80286a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80286f:	48 83 c4 18          	add    $0x18,%rsp
+  802873:	5b                   	pop    %rbx
+  802874:	41 5c                	pop    %r12
+  802876:	41 5d                	pop    %r13
+  802878:	41 5e                	pop    %r14
+  80287a:	41 5f                	pop    %r15
+  80287c:	5d                   	pop    %rbp
+  80287d:	c3                   	ret
+
+000000000080287e <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  80287e:	55                   	push   %rbp
+  80287f:	48 89 e5             	mov    %rsp,%rbp
+  802882:	41 57                	push   %r15
+  802884:	41 56                	push   %r14
+  802886:	41 55                	push   %r13
+  802888:	41 54                	push   %r12
+  80288a:	53                   	push   %rbx
+  80288b:	48 83 ec 18          	sub    $0x18,%rsp
+  80288f:	49 89 fc             	mov    %rdi,%r12
+  802892:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  802896:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80289a:	48 b8 4a 1b 80 00 00 	movabs $0x801b4a,%rax
+  8028a1:	00 00 00 
+  8028a4:	ff d0                	call   *%rax
+  8028a6:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  8028a9:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8028af:	49 bd 6d 15 80 00 00 	movabs $0x80156d,%r13
+  8028b6:	00 00 00 
+            sys_yield();
+  8028b9:	49 be 0a 15 80 00 00 	movabs $0x80150a,%r14
+  8028c0:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  8028c3:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  8028c8:	74 7d                	je     802947 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  8028ca:	8b 03                	mov    (%rbx),%eax
+  8028cc:	3b 43 04             	cmp    0x4(%rbx),%eax
+  8028cf:	75 26                	jne    8028f7 <devpipe_read+0x79>
+            if (i > 0) return i;
+  8028d1:	4d 85 ff             	test   %r15,%r15
+  8028d4:	75 77                	jne    80294d <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8028d6:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8028db:	48 89 da             	mov    %rbx,%rdx
+  8028de:	be 00 10 00 00       	mov    $0x1000,%esi
+  8028e3:	4c 89 e7             	mov    %r12,%rdi
+  8028e6:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  8028e9:	85 c0                	test   %eax,%eax
+  8028eb:	74 72                	je     80295f <devpipe_read+0xe1>
+            sys_yield();
+  8028ed:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  8028f0:	8b 03                	mov    (%rbx),%eax
+  8028f2:	3b 43 04             	cmp    0x4(%rbx),%eax
+  8028f5:	74 df                	je     8028d6 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  8028f7:	48 63 c8             	movslq %eax,%rcx
+  8028fa:	48 89 ca             	mov    %rcx,%rdx
+  8028fd:	48 c1 ea 03          	shr    $0x3,%rdx
+  802901:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  802908:	08 10 20 
+  80290b:	48 89 d0             	mov    %rdx,%rax
+  80290e:	48 f7 e6             	mul    %rsi
+  802911:	48 c1 ea 06          	shr    $0x6,%rdx
+  802915:	48 89 d0             	mov    %rdx,%rax
+  802918:	48 c1 e0 09          	shl    $0x9,%rax
+  80291c:	48 29 d0             	sub    %rdx,%rax
+  80291f:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  802926:	00 
+  802927:	48 89 c8             	mov    %rcx,%rax
+  80292a:	48 29 d0             	sub    %rdx,%rax
+  80292d:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  802932:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  802936:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  80293a:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  80293d:	49 83 c7 01          	add    $0x1,%r15
+  802941:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  802945:	75 83                	jne    8028ca <devpipe_read+0x4c>
+    return n;
+  802947:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80294b:	eb 03                	jmp    802950 <devpipe_read+0xd2>
+            if (i > 0) return i;
+  80294d:	4c 89 f8             	mov    %r15,%rax
+}
+  802950:	48 83 c4 18          	add    $0x18,%rsp
+  802954:	5b                   	pop    %rbx
+  802955:	41 5c                	pop    %r12
+  802957:	41 5d                	pop    %r13
+  802959:	41 5e                	pop    %r14
+  80295b:	41 5f                	pop    %r15
+  80295d:	5d                   	pop    %rbp
+  80295e:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  80295f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802964:	eb ea                	jmp    802950 <devpipe_read+0xd2>
+
+0000000000802966 <pipe>:
+pipe(int pfd[2]) {
+  802966:	55                   	push   %rbp
+  802967:	48 89 e5             	mov    %rsp,%rbp
+  80296a:	41 55                	push   %r13
+  80296c:	41 54                	push   %r12
+  80296e:	53                   	push   %rbx
+  80296f:	48 81 ec b8 00 00 00 	sub    $0xb8,%rsp
+  802976:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  802979:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  80297d:	48 b8 df 1b 80 00 00 	movabs $0x801bdf,%rax
+  802984:	00 00 00 
+  802987:	ff d0                	call   *%rax
+  802989:	89 c3                	mov    %eax,%ebx
+  80298b:	85 c0                	test   %eax,%eax
+  80298d:	0f 88 51 01 00 00    	js     802ae4 <pipe+0x17e>
+        (res = fd_alloc_from(fd2num(fd0) + 1, &fd1)) < 0) goto err;
+  802993:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802997:	48 b8 38 1b 80 00 00 	movabs $0x801b38,%rax
+  80299e:	00 00 00 
+  8029a1:	ff d0                	call   *%rax
+  8029a3:	8d 78 01             	lea    0x1(%rax),%edi
+  8029a6:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8029aa:	48 b8 66 1b 80 00 00 	movabs $0x801b66,%rax
+  8029b1:	00 00 00 
+  8029b4:	ff d0                	call   *%rax
+  8029b6:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8029b8:	85 c0                	test   %eax,%eax
+  8029ba:	0f 88 24 01 00 00    	js     802ae4 <pipe+0x17e>
+    va = fd2data(fd0);
+  8029c0:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8029c4:	48 bb 4a 1b 80 00 00 	movabs $0x801b4a,%rbx
+  8029cb:	00 00 00 
+  8029ce:	ff d3                	call   *%rbx
+  8029d0:	49 89 c5             	mov    %rax,%r13
+    struct RegionOp ops[] = {
+  8029d3:	48 8d bd 30 ff ff ff 	lea    -0xd0(%rbp),%rdi
+  8029da:	b9 14 00 00 00       	mov    $0x14,%ecx
+  8029df:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029e4:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+  8029e7:	c7 85 34 ff ff ff 46 	movl   $0x46,-0xcc(%rbp)
+  8029ee:	00 00 00 
+  8029f1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8029f5:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+  8029fc:	48 c7 85 50 ff ff ff 	movq   $0x1000,-0xb0(%rbp)
+  802a03:	00 10 00 00 
+  802a07:	c7 85 5c ff ff ff 46 	movl   $0x46,-0xa4(%rbp)
+  802a0e:	00 00 00 
+            {.type = REGION_ALLOC, .dstva = (uintptr_t)fd1, .size = PAGE_SIZE, .perm = PROT_RW | PROT_SHARE},
+  802a11:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+    struct RegionOp ops[] = {
+  802a15:	48 89 bd 70 ff ff ff 	mov    %rdi,-0x90(%rbp)
+  802a1c:	48 c7 85 78 ff ff ff 	movq   $0x1000,-0x88(%rbp)
+  802a23:	00 10 00 00 
+  802a27:	c7 45 84 46 00 00 00 	movl   $0x46,-0x7c(%rbp)
+  802a2e:	4c 89 6d 98          	mov    %r13,-0x68(%rbp)
+  802a32:	48 c7 45 a0 00 10 00 	movq   $0x1000,-0x60(%rbp)
+  802a39:	00 
+  802a3a:	c7 45 a8 01 00 00 00 	movl   $0x1,-0x58(%rbp)
+  802a41:	c7 45 ac 46 00 00 00 	movl   $0x46,-0x54(%rbp)
+  802a48:	4c 89 6d b8          	mov    %r13,-0x48(%rbp)
+            {.type = REGION_MAP, .srcva = (uintptr_t)va, .dstva = (uintptr_t)fd2data(fd1), .size = PAGE_SIZE, .perm = PROT_RW | PROT_SHARE},
+  802a4c:	ff d3                	call   *%rbx
+    struct RegionOp ops[] = {
+  802a4e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802a52:	48 c7 45 c8 00 10 00 	movq   $0x1000,-0x38(%rbp)
+  802a59:	00 
+    if ((res = sys_region_batch(ops, sizeof ops / sizeof *ops)) < 0) goto err1;
+  802a5a:	be 04 00 00 00       	mov    $0x4,%esi
+  802a5f:	48 8d bd 30 ff ff ff 	lea    -0xd0(%rbp),%rdi
+  802a66:	48 b8 cc 16 80 00 00 	movabs $0x8016cc,%rax
+  802a6d:	00 00 00 
+  802a70:	ff d0                	call   *%rax
+  802a72:	89 c3                	mov    %eax,%ebx
+  802a74:	85 c0                	test   %eax,%eax
+  802a76:	0f 88 ad 00 00 00    	js     802b29 <pipe+0x1c3>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  802a7c:	be 00 10 00 00       	mov    $0x1000,%esi
+  802a81:	4c 89 ef             	mov    %r13,%rdi
+  802a84:	48 b8 3b 15 80 00 00 	movabs $0x80153b,%rax
+  802a8b:	00 00 00 
+  802a8e:	ff d0                	call   *%rax
+  802a90:	83 f8 02             	cmp    $0x2,%eax
+  802a93:	75 5f                	jne    802af4 <pipe+0x18e>
+    fd0->fd_dev_id = devpipe.dev_id;
+  802a95:	a1 60 40 80 00 00 00 	movabs 0x804060,%eax
+  802a9c:	00 00 
+  802a9e:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802aa2:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  802aa4:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802aa8:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  802aaf:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  802ab3:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  802ab5:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802ab9:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  802ac0:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802ac4:	48 bb 38 1b 80 00 00 	movabs $0x801b38,%rbx
+  802acb:	00 00 00 
+  802ace:	ff d3                	call   *%rbx
+  802ad0:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  802ad4:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  802ad8:	ff d3                	call   *%rbx
+  802ada:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  802adf:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  802ae4:	89 d8                	mov    %ebx,%eax
+  802ae6:	48 81 c4 b8 00 00 00 	add    $0xb8,%rsp
+  802aed:	5b                   	pop    %rbx
+  802aee:	41 5c                	pop    %r12
+  802af0:	41 5d                	pop    %r13
+  802af2:	5d                   	pop    %rbp
+  802af3:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  802af4:	48 b9 30 3b 80 00 00 	movabs $0x803b30,%rcx
+  802afb:	00 00 00 
+  802afe:	48 ba 07 3b 80 00 00 	movabs $0x803b07,%rdx
+  802b05:	00 00 00 
+  802b08:	be 33 00 00 00       	mov    $0x33,%esi
+  802b0d:	48 bf 1c 3b 80 00 00 	movabs $0x803b1c,%rdi
+  802b14:	00 00 00 
+  802b17:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b1c:	49 b8 74 05 80 00 00 	movabs $0x800574,%r8
+  802b23:	00 00 00 
+  802b26:	41 ff d0             	call   *%r8
+        ops[i].type = REGION_UNMAP;
+  802b29:	c7 85 30 ff ff ff 02 	movl   $0x2,-0xd0(%rbp)
+  802b30:	00 00 00 
+  802b33:	c7 85 58 ff ff ff 02 	movl   $0x2,-0xa8(%rbp)
+  802b3a:	00 00 00 
+  802b3d:	c7 45 80 02 00 00 00 	movl   $0x2,-0x80(%rbp)
+  802b44:	c7 45 a8 02 00 00 00 	movl   $0x2,-0x58(%rbp)
+    sys_region_batch(ops, sizeof ops / sizeof *ops);
+  802b4b:	be 04 00 00 00       	mov    $0x4,%esi
+  802b50:	48 8d bd 30 ff ff ff 	lea    -0xd0(%rbp),%rdi
+  802b57:	48 b8 cc 16 80 00 00 	movabs $0x8016cc,%rax
+  802b5e:	00 00 00 
+  802b61:	ff d0                	call   *%rax
+  802b63:	e9 7c ff ff ff       	jmp    802ae4 <pipe+0x17e>
+
+0000000000802b68 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  802b68:	55                   	push   %rbp
+  802b69:	48 89 e5             	mov    %rsp,%rbp
+  802b6c:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  802b70:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802b74:	48 b8 f9 1b 80 00 00 	movabs $0x801bf9,%rax
+  802b7b:	00 00 00 
+  802b7e:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802b80:	85 c0                	test   %eax,%eax
+  802b82:	78 35                	js     802bb9 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  802b84:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802b88:	48 b8 4a 1b 80 00 00 	movabs $0x801b4a,%rax
+  802b8f:	00 00 00 
+  802b92:	ff d0                	call   *%rax
+  802b94:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802b97:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802b9c:	be 00 10 00 00       	mov    $0x1000,%esi
+  802ba1:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802ba5:	48 b8 6d 15 80 00 00 	movabs $0x80156d,%rax
+  802bac:	00 00 00 
+  802baf:	ff d0                	call   *%rax
+  802bb1:	85 c0                	test   %eax,%eax
+  802bb3:	0f 94 c0             	sete   %al
+  802bb6:	0f b6 c0             	movzbl %al,%eax
+}
+  802bb9:	c9                   	leave
+  802bba:	c3                   	ret
+
+0000000000802bbb <wait>:
+#include <inc/lib.h>
+
+/* Waits until 'envid' exits. */
+void
+wait(envid_t envid) {
+  802bbb:	55                   	push   %rbp
+  802bbc:	48 89 e5             	mov    %rsp,%rbp
+  802bbf:	41 55                	push   %r13
+  802bc1:	41 54                	push   %r12
+  802bc3:	53                   	push   %rbx
+  802bc4:	48 83 ec 08          	sub    $0x8,%rsp
+    assert(envid != 0);
+  802bc8:	85 ff                	test   %edi,%edi
+  802bca:	74 73                	je     802c3f <wait+0x84>
+  802bcc:	41 89 fc             	mov    %edi,%r12d
+
+    const volatile struct Env *env = &envs[ENVX(envid)];
+  802bcf:	89 f8                	mov    %edi,%eax
+  802bd1:	25 ff 03 00 00       	and    $0x3ff,%eax
+
+    while (env->env_id == envid &&
+  802bd6:	89 f9                	mov    %edi,%ecx
+  802bd8:	81 e1 ff 03 00 00    	and    $0x3ff,%ecx
+  802bde:	48 69 c9 d0 01 00 00 	imul   $0x1d0,%rcx,%rcx
+  802be5:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  802bec:	00 00 00 
+  802bef:	48 01 ca             	add    %rcx,%rdx
+  802bf2:	8b 92 e0 00 00 00    	mov    0xe0(%rdx),%edx
+  802bf8:	39 d7                	cmp    %edx,%edi
+  802bfa:	75 38                	jne    802c34 <wait+0x79>
+           env->env_status != ENV_FREE) {
+  802bfc:	48 98                	cltq
+  802bfe:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+  802c05:	48 bb 00 00 c0 1f 80 	movabs $0x801fc00000,%rbx
+  802c0c:	00 00 00 
+  802c0f:	48 01 c3             	add    %rax,%rbx
+        sys_yield();
+  802c12:	49 bd 0a 15 80 00 00 	movabs $0x80150a,%r13
+  802c19:	00 00 00 
+           env->env_status != ENV_FREE) {
+  802c1c:	8b 83 ec 00 00 00    	mov    0xec(%rbx),%eax
+    while (env->env_id == envid &&
+  802c22:	85 c0                	test   %eax,%eax
+  802c24:	74 0e                	je     802c34 <wait+0x79>
+        sys_yield();
+  802c26:	41 ff d5             	call   *%r13
+    while (env->env_id == envid &&
+  802c29:	8b 83 e0 00 00 00    	mov    0xe0(%rbx),%eax
+  802c2f:	44 39 e0             	cmp    %r12d,%eax
+  802c32:	74 e8                	je     802c1c <wait+0x61>
+    }
+}
+  802c34:	48 83 c4 08          	add    $0x8,%rsp
+  802c38:	5b                   	pop    %rbx
+  802c39:	41 5c                	pop    %r12
+  802c3b:	41 5d                	pop    %r13
+  802c3d:	5d                   	pop    %rbp
+  802c3e:	c3                   	ret
+    assert(envid != 0);
+  802c3f:	48 b9 54 3b 80 00 00 	movabs $0x803b54,%rcx
+  802c46:	00 00 00 
+  802c49:	48 ba 07 3b 80 00 00 	movabs $0x803b07,%rdx
+  802c50:	00 00 00 
+  802c53:	be 06 00 00 00       	mov    $0x6,%esi
+  802c58:	48 bf 5f 3b 80 00 00 	movabs $0x803b5f,%rdi
+  802c5f:	00 00 00 
+  802c62:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c67:	49 b8 74 05 80 00 00 	movabs $0x800574,%r8
+  802c6e:	00 00 00 
+  802c71:	41 ff d0             	call   *%r8
+
+0000000000802c74 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  802c74:	48 89 f8             	mov    %rdi,%rax
+  802c77:	48 c1 e8 27          	shr    $0x27,%rax
+  802c7b:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  802c82:	01 00 00 
+  802c85:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802c89:	f6 c2 01             	test   $0x1,%dl
+  802c8c:	74 6d                	je     802cfb <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  802c8e:	48 89 f8             	mov    %rdi,%rax
+  802c91:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802c95:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802c9c:	01 00 00 
+  802c9f:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802ca3:	f6 c2 01             	test   $0x1,%dl
+  802ca6:	74 62                	je     802d0a <get_uvpt_entry+0x96>
+  802ca8:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802caf:	01 00 00 
+  802cb2:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802cb6:	f6 c2 80             	test   $0x80,%dl
+  802cb9:	75 4f                	jne    802d0a <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  802cbb:	48 89 f8             	mov    %rdi,%rax
+  802cbe:	48 c1 e8 15          	shr    $0x15,%rax
+  802cc2:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802cc9:	01 00 00 
+  802ccc:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802cd0:	f6 c2 01             	test   $0x1,%dl
+  802cd3:	74 44                	je     802d19 <get_uvpt_entry+0xa5>
+  802cd5:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802cdc:	01 00 00 
+  802cdf:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802ce3:	f6 c2 80             	test   $0x80,%dl
+  802ce6:	75 31                	jne    802d19 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  802ce8:	48 c1 ef 0c          	shr    $0xc,%rdi
+  802cec:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802cf3:	01 00 00 
+  802cf6:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  802cfa:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  802cfb:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  802d02:	01 00 00 
+  802d05:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802d09:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  802d0a:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802d11:	01 00 00 
+  802d14:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802d18:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  802d19:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802d20:	01 00 00 
+  802d23:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802d27:	c3                   	ret
+
+0000000000802d28 <get_prot>:
+
+int
+get_prot(void *va) {
+  802d28:	55                   	push   %rbp
+  802d29:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  802d2c:	48 b8 74 2c 80 00 00 	movabs $0x802c74,%rax
+  802d33:	00 00 00 
+  802d36:	ff d0                	call   *%rax
+  802d38:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  802d3b:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  802d40:	89 c1                	mov    %eax,%ecx
+  802d42:	83 c9 04             	or     $0x4,%ecx
+  802d45:	f6 c2 01             	test   $0x1,%dl
+  802d48:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  802d4b:	89 c1                	mov    %eax,%ecx
+  802d4d:	83 c9 02             	or     $0x2,%ecx
+  802d50:	f6 c2 02             	test   $0x2,%dl
+  802d53:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  802d56:	89 c1                	mov    %eax,%ecx
+  802d58:	83 c9 01             	or     $0x1,%ecx
+  802d5b:	48 85 d2             	test   %rdx,%rdx
+  802d5e:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  802d61:	89 c1                	mov    %eax,%ecx
+  802d63:	83 c9 40             	or     $0x40,%ecx
+  802d66:	f6 c6 04             	test   $0x4,%dh
+  802d69:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  802d6c:	5d                   	pop    %rbp
+  802d6d:	c3                   	ret
+
+0000000000802d6e <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  802d6e:	55                   	push   %rbp
+  802d6f:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  802d72:	48 b8 74 2c 80 00 00 	movabs $0x802c74,%rax
+  802d79:	00 00 00 
+  802d7c:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  802d7e:	48 c1 e8 06          	shr    $0x6,%rax
+  802d82:	83 e0 01             	and    $0x1,%eax
+}
+  802d85:	5d                   	pop    %rbp
+  802d86:	c3                   	ret
+
+0000000000802d87 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  802d87:	55                   	push   %rbp
+  802d88:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  802d8b:	48 b8 74 2c 80 00 00 	movabs $0x802c74,%rax
+  802d92:	00 00 00 
+  802d95:	ff d0                	call   *%rax
+  802d97:	83 e0 01             	and    $0x1,%eax
+}
+  802d9a:	5d                   	pop    %rbp
+  802d9b:	c3                   	ret
+
+0000000000802d9c <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  802d9c:	55                   	push   %rbp
+  802d9d:	48 89 e5             	mov    %rsp,%rbp
+  802da0:	41 57                	push   %r15
+  802da2:	41 56                	push   %r14
+  802da4:	41 55                	push   %r13
+  802da6:	41 54                	push   %r12
+  802da8:	53                   	push   %rbx
+  802da9:	48 83 ec 38          	sub    $0x38,%rsp
+  802dad:	49 89 f7             	mov    %rsi,%r15
+  802db0:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+                    }
+                    continue;
+                }
+                for (int ptei = 0; ptei < PT_ENTRY_COUNT; ptei++) {
+                    uintptr_t pte_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, pdei, ptei, 0);
+                    pte_t pte = uvpt[VPT(pte_addr)];
+  802db6:	49 bd 00 00 00 00 00 	movabs $0x10000000000,%r13
+  802dbd:	01 00 00 
+  802dc0:	4d 89 e6             	mov    %r12,%r14
+  802dc3:	49 89 fc             	mov    %rdi,%r12
+  802dc6:	e9 19 01 00 00       	jmp    802ee4 <foreach_shared_region+0x148>
+  802dcb:	48 89 5d b0          	mov    %rbx,-0x50(%rbp)
+  802dcf:	4c 89 75 a8          	mov    %r14,-0x58(%rbp)
+  802dd3:	eb 52                	jmp    802e27 <foreach_shared_region+0x8b>
+                for (int ptei = 0; ptei < PT_ENTRY_COUNT; ptei++) {
+  802dd5:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802ddc:	48 81 fb 00 00 20 00 	cmp    $0x200000,%rbx
+  802de3:	74 2e                	je     802e13 <foreach_shared_region+0x77>
+                    uintptr_t pte_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, pdei, ptei, 0);
+  802de5:	48 89 df             	mov    %rbx,%rdi
+  802de8:	4c 09 f7             	or     %r14,%rdi
+                    pte_t pte = uvpt[VPT(pte_addr)];
+  802deb:	48 89 f8             	mov    %rdi,%rax
+  802dee:	48 c1 e8 0c          	shr    $0xc,%rax
+  802df2:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+                    if ((pte & PTE_P) && (pte & PTE_SHARE)) {
+  802df7:	25 01 04 00 00       	and    $0x401,%eax
+  802dfc:	48 3d 01 04 00 00    	cmp    $0x401,%rax
+  802e02:	75 d1                	jne    802dd5 <foreach_shared_region+0x39>
+                        fun((void*)pte_addr, (void*)(pte_addr + PAGE_SIZE), arg);
+  802e04:	48 8d b7 00 10 00 00 	lea    0x1000(%rdi),%rsi
+  802e0b:	4c 89 fa             	mov    %r15,%rdx
+  802e0e:	41 ff d4             	call   *%r12
+  802e11:	eb c2                	jmp    802dd5 <foreach_shared_region+0x39>
+            for (int pdei = 0; pdei < PD_ENTRY_COUNT; pdei++) {
+  802e13:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  802e1a:	00 
+  802e1b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802e1f:	48 3d 00 00 00 40    	cmp    $0x40000000,%rax
+  802e25:	74 46                	je     802e6d <foreach_shared_region+0xd1>
+                uintptr_t pde_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, pdei, 0, 0);
+  802e27:	4c 8b 75 c8          	mov    -0x38(%rbp),%r14
+  802e2b:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802e2f:	49 09 c6             	or     %rax,%r14
+                pde_t pde = uvpd[VPD(pde_addr)];
+  802e32:	4c 89 f0             	mov    %r14,%rax
+  802e35:	48 c1 e8 15          	shr    $0x15,%rax
+  802e39:	48 b9 00 00 00 80 00 	movabs $0x10080000000,%rcx
+  802e40:	01 00 00 
+  802e43:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+                if (!(pde & PTE_P)) {
+  802e47:	a8 01                	test   $0x1,%al
+  802e49:	74 c8                	je     802e13 <foreach_shared_region+0x77>
+                if (pde & PTE_PS) {
+  802e4b:	48 89 c3             	mov    %rax,%rbx
+  802e4e:	81 e3 80 00 00 00    	and    $0x80,%ebx
+  802e54:	74 8f                	je     802de5 <foreach_shared_region+0x49>
+                    if (pde & PTE_SHARE) {
+  802e56:	f6 c4 04             	test   $0x4,%ah
+  802e59:	74 b8                	je     802e13 <foreach_shared_region+0x77>
+                        fun((void*)pde_addr, (void*)(pde_addr + 1024 * 1024 * 2), arg);
+  802e5b:	49 8d b6 00 00 20 00 	lea    0x200000(%r14),%rsi
+  802e62:	4c 89 fa             	mov    %r15,%rdx
+  802e65:	4c 89 f7             	mov    %r14,%rdi
+  802e68:	41 ff d4             	call   *%r12
+  802e6b:	eb a6                	jmp    802e13 <foreach_shared_region+0x77>
+  802e6d:	48 8b 5d b0          	mov    -0x50(%rbp),%rbx
+  802e71:	4c 8b 75 a8          	mov    -0x58(%rbp),%r14
+        for (int pdpei = 0; pdpei < PDP_ENTRY_COUNT; pdpei++) {
+  802e75:	48 81 c3 00 00 00 40 	add    $0x40000000,%rbx
+  802e7c:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802e83:	00 00 00 
+  802e86:	48 39 c3             	cmp    %rax,%rbx
+  802e89:	74 4c                	je     802ed7 <foreach_shared_region+0x13b>
+            uintptr_t pdpe_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, 0, 0, 0);
+  802e8b:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802e8f:	48 09 d8             	or     %rbx,%rax
+  802e92:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+            pdpe_t pdpe = uvpdp[VPDP(pdpe_addr)];
+  802e96:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802e9a:	48 b9 00 00 40 80 00 	movabs $0x10080400000,%rcx
+  802ea1:	01 00 00 
+  802ea4:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+            if (!(pdpe & PTE_P)) {
+  802ea8:	a8 01                	test   $0x1,%al
+  802eaa:	74 c9                	je     802e75 <foreach_shared_region+0xd9>
+            if (pdpe & PTE_PS) {
+  802eac:	48 89 c1             	mov    %rax,%rcx
+  802eaf:	81 e1 80 00 00 00    	and    $0x80,%ecx
+  802eb5:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  802eb9:	0f 84 0c ff ff ff    	je     802dcb <foreach_shared_region+0x2f>
+                if (pdpe & PTE_SHARE) {
+  802ebf:	f6 c4 04             	test   $0x4,%ah
+  802ec2:	74 b1                	je     802e75 <foreach_shared_region+0xd9>
+                    fun((void*)pdpe_addr, (void*)(pdpe_addr + 1024 * 1024 * 1024), arg); 
+  802ec4:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  802ec8:	48 8d b7 00 00 00 40 	lea    0x40000000(%rdi),%rsi
+  802ecf:	4c 89 fa             	mov    %r15,%rdx
+  802ed2:	41 ff d4             	call   *%r12
+  802ed5:	eb 9e                	jmp    802e75 <foreach_shared_region+0xd9>
+    for (int pml4ei = 0; pml4ei < PML4_ENTRY_COUNT; pml4ei++) {
+  802ed7:	49 83 c6 01          	add    $0x1,%r14
+  802edb:	49 81 fe 00 02 00 00 	cmp    $0x200,%r14
+  802ee2:	74 24                	je     802f08 <foreach_shared_region+0x16c>
+        pml4e_t pml4e = uvpml4[VPML4(pml4_addr)];
+  802ee4:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  802eeb:	01 00 00 
+  802eee:	4a 8b 04 f0          	mov    (%rax,%r14,8),%rax
+        if (!(pml4e & PTE_P)) {
+  802ef2:	a8 01                	test   $0x1,%al
+  802ef4:	74 e1                	je     802ed7 <foreach_shared_region+0x13b>
+  802ef6:	4c 89 f0             	mov    %r14,%rax
+  802ef9:	48 c1 e0 27          	shl    $0x27,%rax
+  802efd:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  802f01:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802f06:	eb 83                	jmp    802e8b <foreach_shared_region+0xef>
+            }
+        }
+    }
+    
+    return 0;
+}
+  802f08:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f0d:	48 83 c4 38          	add    $0x38,%rsp
+  802f11:	5b                   	pop    %rbx
+  802f12:	41 5c                	pop    %r12
+  802f14:	41 5d                	pop    %r13
+  802f16:	41 5e                	pop    %r14
+  802f18:	41 5f                	pop    %r15
+  802f1a:	5d                   	pop    %rbp
+  802f1b:	c3                   	ret
+
+0000000000802f1c <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  802f1c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f21:	c3                   	ret
+
+0000000000802f22 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  802f22:	55                   	push   %rbp
+  802f23:	48 89 e5             	mov    %rsp,%rbp
+  802f26:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  802f29:	48 be 6a 3b 80 00 00 	movabs $0x803b6a,%rsi
+  802f30:	00 00 00 
+  802f33:	48 b8 e9 0f 80 00 00 	movabs $0x800fe9,%rax
+  802f3a:	00 00 00 
+  802f3d:	ff d0                	call   *%rax
+    return 0;
+}
+  802f3f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f44:	5d                   	pop    %rbp
+  802f45:	c3                   	ret
+
+0000000000802f46 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  802f46:	55                   	push   %rbp
+  802f47:	48 89 e5             	mov    %rsp,%rbp
+  802f4a:	41 57                	push   %r15
+  802f4c:	41 56                	push   %r14
+  802f4e:	41 55                	push   %r13
+  802f50:	41 54                	push   %r12
+  802f52:	53                   	push   %rbx
+  802f53:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  802f5a:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  802f61:	48 85 d2             	test   %rdx,%rdx
+  802f64:	74 7a                	je     802fe0 <devcons_write+0x9a>
+  802f66:	49 89 d6             	mov    %rdx,%r14
+  802f69:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802f6f:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  802f74:	49 bf e3 11 80 00 00 	movabs $0x8011e3,%r15
+  802f7b:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  802f7e:	4c 89 f3             	mov    %r14,%rbx
+  802f81:	48 29 f3             	sub    %rsi,%rbx
+  802f84:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802f89:	48 39 c3             	cmp    %rax,%rbx
+  802f8c:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  802f90:	4c 63 eb             	movslq %ebx,%r13
+  802f93:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  802f9a:	48 01 c6             	add    %rax,%rsi
+  802f9d:	4c 89 ea             	mov    %r13,%rdx
+  802fa0:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802fa7:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  802faa:	4c 89 ee             	mov    %r13,%rsi
+  802fad:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802fb4:	48 b8 10 14 80 00 00 	movabs $0x801410,%rax
+  802fbb:	00 00 00 
+  802fbe:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  802fc0:	41 01 dc             	add    %ebx,%r12d
+  802fc3:	49 63 f4             	movslq %r12d,%rsi
+  802fc6:	4c 39 f6             	cmp    %r14,%rsi
+  802fc9:	72 b3                	jb     802f7e <devcons_write+0x38>
+    return res;
+  802fcb:	49 63 c4             	movslq %r12d,%rax
+}
+  802fce:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  802fd5:	5b                   	pop    %rbx
+  802fd6:	41 5c                	pop    %r12
+  802fd8:	41 5d                	pop    %r13
+  802fda:	41 5e                	pop    %r14
+  802fdc:	41 5f                	pop    %r15
+  802fde:	5d                   	pop    %rbp
+  802fdf:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  802fe0:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802fe6:	eb e3                	jmp    802fcb <devcons_write+0x85>
+
+0000000000802fe8 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  802fe8:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  802feb:	ba 00 00 00 00       	mov    $0x0,%edx
+  802ff0:	48 85 c0             	test   %rax,%rax
+  802ff3:	74 55                	je     80304a <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  802ff5:	55                   	push   %rbp
+  802ff6:	48 89 e5             	mov    %rsp,%rbp
+  802ff9:	41 55                	push   %r13
+  802ffb:	41 54                	push   %r12
+  802ffd:	53                   	push   %rbx
+  802ffe:	48 83 ec 08          	sub    $0x8,%rsp
+  803002:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  803005:	48 bb 3d 14 80 00 00 	movabs $0x80143d,%rbx
+  80300c:	00 00 00 
+  80300f:	49 bc 0a 15 80 00 00 	movabs $0x80150a,%r12
+  803016:	00 00 00 
+  803019:	eb 03                	jmp    80301e <devcons_read+0x36>
+  80301b:	41 ff d4             	call   *%r12
+  80301e:	ff d3                	call   *%rbx
+  803020:	85 c0                	test   %eax,%eax
+  803022:	74 f7                	je     80301b <devcons_read+0x33>
+    if (c < 0) return c;
+  803024:	48 63 d0             	movslq %eax,%rdx
+  803027:	78 13                	js     80303c <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  803029:	ba 00 00 00 00       	mov    $0x0,%edx
+  80302e:	83 f8 04             	cmp    $0x4,%eax
+  803031:	74 09                	je     80303c <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  803033:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  803037:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  80303c:	48 89 d0             	mov    %rdx,%rax
+  80303f:	48 83 c4 08          	add    $0x8,%rsp
+  803043:	5b                   	pop    %rbx
+  803044:	41 5c                	pop    %r12
+  803046:	41 5d                	pop    %r13
+  803048:	5d                   	pop    %rbp
+  803049:	c3                   	ret
+  80304a:	48 89 d0             	mov    %rdx,%rax
+  80304d:	c3                   	ret
+
+000000000080304e <cputchar>:
+cputchar(int ch) {
+  80304e:	55                   	push   %rbp
+  80304f:	48 89 e5             	mov    %rsp,%rbp
+  803052:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  803056:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  80305a:	be 01 00 00 00       	mov    $0x1,%esi
+  80305f:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  803063:	48 b8 10 14 80 00 00 	movabs $0x801410,%rax
+  80306a:	00 00 00 
+  80306d:	ff d0                	call   *%rax
+}
+  80306f:	c9                   	leave
+  803070:	c3                   	ret
+
+0000000000803071 <getchar>:
+getchar(void) {
+  803071:	55                   	push   %rbp
+  803072:	48 89 e5             	mov    %rsp,%rbp
+  803075:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  803079:	ba 01 00 00 00       	mov    $0x1,%edx
+  80307e:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  803082:	bf 00 00 00 00       	mov    $0x0,%edi
+  803087:	48 b8 dc 1e 80 00 00 	movabs $0x801edc,%rax
+  80308e:	00 00 00 
+  803091:	ff d0                	call   *%rax
+  803093:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  803095:	85 c0                	test   %eax,%eax
+  803097:	78 06                	js     80309f <getchar+0x2e>
+  803099:	74 08                	je     8030a3 <getchar+0x32>
+  80309b:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  80309f:	89 d0                	mov    %edx,%eax
+  8030a1:	c9                   	leave
+  8030a2:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  8030a3:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  8030a8:	eb f5                	jmp    80309f <getchar+0x2e>
+
+00000000008030aa <iscons>:
+iscons(int fdnum) {
+  8030aa:	55                   	push   %rbp
+  8030ab:	48 89 e5             	mov    %rsp,%rbp
+  8030ae:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8030b2:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8030b6:	48 b8 f9 1b 80 00 00 	movabs $0x801bf9,%rax
+  8030bd:	00 00 00 
+  8030c0:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8030c2:	85 c0                	test   %eax,%eax
+  8030c4:	78 18                	js     8030de <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  8030c6:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8030ca:	48 b8 a0 40 80 00 00 	movabs $0x8040a0,%rax
+  8030d1:	00 00 00 
+  8030d4:	8b 00                	mov    (%rax),%eax
+  8030d6:	39 02                	cmp    %eax,(%rdx)
+  8030d8:	0f 94 c0             	sete   %al
+  8030db:	0f b6 c0             	movzbl %al,%eax
+}
+  8030de:	c9                   	leave
+  8030df:	c3                   	ret
+
+00000000008030e0 <opencons>:
+opencons(void) {
+  8030e0:	55                   	push   %rbp
+  8030e1:	48 89 e5             	mov    %rsp,%rbp
+  8030e4:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8030e8:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  8030ec:	48 b8 df 1b 80 00 00 	movabs $0x801bdf,%rax
+  8030f3:	00 00 00 
+  8030f6:	ff d0                	call   *%rax
+  8030f8:	85 c0                	test   %eax,%eax
+  8030fa:	78 49                	js     803145 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  8030fc:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803101:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803106:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  80310a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80310f:	48 b8 99 15 80 00 00 	movabs $0x801599,%rax
+  803116:	00 00 00 
+  803119:	ff d0                	call   *%rax
+  80311b:	85 c0                	test   %eax,%eax
+  80311d:	78 26                	js     803145 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  80311f:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803123:	a1 a0 40 80 00 00 00 	movabs 0x8040a0,%eax
+  80312a:	00 00 
+  80312c:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  80312e:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803132:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  803139:	48 b8 38 1b 80 00 00 	movabs $0x801b38,%rax
+  803140:	00 00 00 
+  803143:	ff d0                	call   *%rax
+}
+  803145:	c9                   	leave
+  803146:	c3                   	ret
+
+0000000000803147 <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  803147:	55                   	push   %rbp
+  803148:	48 89 e5             	mov    %rsp,%rbp
+  80314b:	41 55                	push   %r13
+  80314d:	41 54                	push   %r12
+  80314f:	53                   	push   %rbx
+  803150:	48 83 ec 08          	sub    $0x8,%rsp
+  803154:	49 89 fc             	mov    %rdi,%r12
+  803157:	48 89 f7             	mov    %rsi,%rdi
+  80315a:	48 89 d3             	mov    %rdx,%rbx
+  80315d:	49 89 cd             	mov    %rcx,%r13
+    // LAB 9: Your code here:
+    int res = sys_ipc_recv(!pg ? (void*)MAX_USER_ADDRESS : pg, !size ? 0 : *size);
+  803160:	be 00 00 00 00       	mov    $0x0,%esi
+  803165:	48 85 d2             	test   %rdx,%rdx
+  803168:	74 03                	je     80316d <ipc_recv+0x26>
+  80316a:	48 8b 32             	mov    (%rdx),%rsi
+  80316d:	48 85 ff             	test   %rdi,%rdi
+  803170:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803177:	00 00 00 
+  80317a:	48 0f 44 f8          	cmove  %rax,%rdi
+  80317e:	48 b8 6b 19 80 00 00 	movabs $0x80196b,%rax
+  803185:	00 00 00 
+  803188:	ff d0                	call   *%rax
+    if (res < 0) {
+  80318a:	85 c0                	test   %eax,%eax
+  80318c:	78 66                	js     8031f4 <ipc_recv+0xad>
+        if (size) {
+            *size = 0;
+        }
+        return res;
+    }
+    if (from_env_store) {
+  80318e:	4d 85 e4             	test   %r12,%r12
+  803191:	74 14                	je     8031a7 <ipc_recv+0x60>
+        *from_env_store = thisenv->env_ipc_from;
+  803193:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  80319a:	00 00 00 
+  80319d:	8b 80 ac 01 00 00    	mov    0x1ac(%rax),%eax
+  8031a3:	41 89 04 24          	mov    %eax,(%r12)
+    }
+    if (perm_store) {
+  8031a7:	4d 85 ed             	test   %r13,%r13
+  8031aa:	74 14                	je     8031c0 <ipc_recv+0x79>
+        *perm_store = thisenv->env_ipc_perm;
+  8031ac:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  8031b3:	00 00 00 
+  8031b6:	8b 80 b0 01 00 00    	mov    0x1b0(%rax),%eax
+  8031bc:	41 89 45 00          	mov    %eax,0x0(%r13)
+    }
+    if (size) {
+  8031c0:	48 85 db             	test   %rbx,%rbx
+  8031c3:	74 14                	je     8031d9 <ipc_recv+0x92>
+        *size = thisenv->env_ipc_maxsz;
+  8031c5:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  8031cc:	00 00 00 
+  8031cf:	48 8b 80 a0 01 00 00 	mov    0x1a0(%rax),%rax
+  8031d6:	48 89 03             	mov    %rax,(%rbx)
+    }
+    return thisenv->env_ipc_value;
+  8031d9:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  8031e0:	00 00 00 
+  8031e3:	8b 80 a8 01 00 00    	mov    0x1a8(%rax),%eax
+}
+  8031e9:	48 83 c4 08          	add    $0x8,%rsp
+  8031ed:	5b                   	pop    %rbx
+  8031ee:	41 5c                	pop    %r12
+  8031f0:	41 5d                	pop    %r13
+  8031f2:	5d                   	pop    %rbp
+  8031f3:	c3                   	ret
+        if (from_env_store) {
+  8031f4:	4d 85 e4             	test   %r12,%r12
+  8031f7:	74 08                	je     803201 <ipc_recv+0xba>
+            *from_env_store = 0;
+  8031f9:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  803200:	00 
+        if (perm_store) {
+  803201:	4d 85 ed             	test   %r13,%r13
+  803204:	74 08                	je     80320e <ipc_recv+0xc7>
+            *perm_store = 0;
+  803206:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  80320d:	00 
+        if (size) {
+  80320e:	48 85 db             	test   %rbx,%rbx
+  803211:	74 d6                	je     8031e9 <ipc_recv+0xa2>
+            *size = 0;
+  803213:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  80321a:	eb cd                	jmp    8031e9 <ipc_recv+0xa2>
+
+000000000080321c <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  80321c:	55                   	push   %rbp
+  80321d:	48 89 e5             	mov    %rsp,%rbp
+  803220:	41 57                	push   %r15
+  803222:	41 56                	push   %r14
+  803224:	41 55                	push   %r13
+  803226:	41 54                	push   %r12
+  803228:	53                   	push   %rbx
+  803229:	48 83 ec 18          	sub    $0x18,%rsp
+  80322d:	41 89 fd             	mov    %edi,%r13d
+  803230:	89 75 cc             	mov    %esi,-0x34(%rbp)
+  803233:	49 89 cc             	mov    %rcx,%r12
+  803236:	44 89 45 c8          	mov    %r8d,-0x38(%rbp)
+    // LAB 9: Your code here:
+    int res = 0;
+    while ((res = sys_ipc_try_send(to_env, val, !pg ? (void*)MAX_USER_ADDRESS : pg, size, perm)) < 0) {
+  80323a:	48 85 d2             	test   %rdx,%rdx
+  80323d:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803244:	00 00 00 
+  803247:	48 0f 45 c2          	cmovne %rdx,%rax
+  80324b:	48 89 c3             	mov    %rax,%rbx
+  80324e:	49 be 3f 19 80 00 00 	movabs $0x80193f,%r14
+  803255:	00 00 00 
+        if (res != -E_IPC_NOT_RECV) {
+            panic("sys_ipc_try_send failed: %i", res);
+        }
+        sys_yield();
+  803258:	49 bf 0a 15 80 00 00 	movabs $0x80150a,%r15
+  80325f:	00 00 00 
+    while ((res = sys_ipc_try_send(to_env, val, !pg ? (void*)MAX_USER_ADDRESS : pg, size, perm)) < 0) {
+  803262:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  803265:	44 8b 45 c8          	mov    -0x38(%rbp),%r8d
+  803269:	4c 89 e1             	mov    %r12,%rcx
+  80326c:	48 89 da             	mov    %rbx,%rdx
+  80326f:	44 89 ef             	mov    %r13d,%edi
+  803272:	41 ff d6             	call   *%r14
+  803275:	85 c0                	test   %eax,%eax
+  803277:	79 37                	jns    8032b0 <ipc_send+0x94>
+        if (res != -E_IPC_NOT_RECV) {
+  803279:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  80327c:	75 05                	jne    803283 <ipc_send+0x67>
+        sys_yield();
+  80327e:	41 ff d7             	call   *%r15
+  803281:	eb df                	jmp    803262 <ipc_send+0x46>
+            panic("sys_ipc_try_send failed: %i", res);
+  803283:	89 c1                	mov    %eax,%ecx
+  803285:	48 ba 76 3b 80 00 00 	movabs $0x803b76,%rdx
+  80328c:	00 00 00 
+  80328f:	be 40 00 00 00       	mov    $0x40,%esi
+  803294:	48 bf 92 3b 80 00 00 	movabs $0x803b92,%rdi
+  80329b:	00 00 00 
+  80329e:	b8 00 00 00 00       	mov    $0x0,%eax
+  8032a3:	49 b8 74 05 80 00 00 	movabs $0x800574,%r8
+  8032aa:	00 00 00 
+  8032ad:	41 ff d0             	call   *%r8
+    }
+    return;
+}
+  8032b0:	48 83 c4 18          	add    $0x18,%rsp
+  8032b4:	5b                   	pop    %rbx
+  8032b5:	41 5c                	pop    %r12
+  8032b7:	41 5d                	pop    %r13
+  8032b9:	41 5e                	pop    %r14
+  8032bb:	41 5f                	pop    %r15
+  8032bd:	5d                   	pop    %rbp
+  8032be:	c3                   	ret
+
+00000000008032bf <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  8032bf:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  8032c4:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  8032cb:	00 00 00 
+  8032ce:	48 69 d0 d0 01 00 00 	imul   $0x1d0,%rax,%rdx
+  8032d5:	48 01 ca             	add    %rcx,%rdx
+  8032d8:	8b 92 e8 00 00 00    	mov    0xe8(%rdx),%edx
+  8032de:	39 fa                	cmp    %edi,%edx
+  8032e0:	74 12                	je     8032f4 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  8032e2:	48 83 c0 01          	add    $0x1,%rax
+  8032e6:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  8032ec:	75 e0                	jne    8032ce <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  8032ee:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8032f3:	c3                   	ret
+            return envs[i].env_id;
+  8032f4:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+  8032fb:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  803302:	00 00 00 
+  803305:	48 01 d0             	add    %rdx,%rax
+  803308:	8b 80 e0 00 00 00    	mov    0xe0(%rax),%eax
+  80330e:	c3                   	ret
+  80330f:	90                   	nop
+
+0000000000803310 <__rodata_start>:
+  803310:	70 69                	jo     80337b <__rodata_start+0x6b>
+  803312:	70 65                	jo     803379 <__rodata_start+0x69>
+  803314:	72 65                	jb     80337b <__rodata_start+0x6b>
+  803316:	61                   	(bad)
+  803317:	64 65 6f             	fs outsl %gs:(%rsi),(%dx)
+  80331a:	66 00 70 69          	data16 add %dh,0x69(%rax)
+  80331e:	70 65                	jo     803385 <__rodata_start+0x75>
+  803320:	3a 20                	cmp    (%rax),%ah
+  803322:	25 69 00 75 73       	and    $0x73750069,%eax
+  803327:	65 72 2f             	gs jb  803359 <__rodata_start+0x49>
+  80332a:	74 65                	je     803391 <__rodata_start+0x81>
+  80332c:	73 74                	jae    8033a2 <__rodata_start+0x92>
+  80332e:	70 69                	jo     803399 <__rodata_start+0x89>
+  803330:	70 65                	jo     803397 <__rodata_start+0x87>
+  803332:	2e 63 00             	cs movsxd (%rax),%eax
+  803335:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  803337:	72 6b                	jb     8033a4 <__rodata_start+0x94>
+  803339:	3a 20                	cmp    (%rax),%ah
+  80333b:	25 69 00 5b 25       	and    $0x255b0069,%eax
+  803340:	30 38                	xor    %bh,(%rax)
+  803342:	78 5d                	js     8033a1 <__rodata_start+0x91>
+  803344:	20 70 69             	and    %dh,0x69(%rax)
+  803347:	70 65                	jo     8033ae <__rodata_start+0x9e>
+  803349:	72 65                	jb     8033b0 <__rodata_start+0xa0>
+  80334b:	61                   	(bad)
+  80334c:	64 65 6f             	fs outsl %gs:(%rsi),(%dx)
+  80334f:	66 20 63 6c          	data16 and %ah,0x6c(%rbx)
+  803353:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803354:	73 65                	jae    8033bb <__rodata_start+0xab>
+  803356:	20 25 64 0a 00 5b    	and    %ah,0x5b000a64(%rip)        # 5b803dc0 <__bss_end+0x5affbdc0>
+  80335c:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  803361:	20 70 69             	and    %dh,0x69(%rax)
+  803364:	70 65                	jo     8033cb <__rodata_start+0xbb>
+  803366:	72 65                	jb     8033cd <__rodata_start+0xbd>
+  803368:	61                   	(bad)
+  803369:	64 65 6f             	fs outsl %gs:(%rsi),(%dx)
+  80336c:	66 20 72 65          	data16 and %dh,0x65(%rdx)
+  803370:	61                   	(bad)
+  803371:	64 6e                	outsb  %fs:(%rsi),(%dx)
+  803373:	20 25 64 0a 00 72    	and    %ah,0x72000a64(%rip)        # 72803ddd <__bss_end+0x71ffbddd>
+  803379:	65 61                	gs (bad)
+  80337b:	64 3a 20             	cmp    %fs:(%rax),%ah
+  80337e:	25 69 00 0a 70       	and    $0x700a0069,%eax
+  803383:	69 70 65 20 72 65 61 	imul   $0x61657220,0x65(%rax),%esi
+  80338a:	64 20 63 6c          	and    %ah,%fs:0x6c(%rbx)
+  80338e:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80338f:	73 65                	jae    8033f6 <__rodata_start+0xe6>
+  803391:	64 20 70 72          	and    %dh,%fs:0x72(%rax)
+  803395:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803396:	70 65                	jo     8033fd <__rodata_start+0xed>
+  803398:	72 6c                	jb     803406 <__rodata_start+0xf6>
+  80339a:	79 0a                	jns    8033a6 <__rodata_start+0x96>
+  80339c:	00 0a                	add    %cl,(%rdx)
+  80339e:	67 6f                	outsl  %ds:(%esi),(%dx)
+  8033a0:	74 20                	je     8033c2 <__rodata_start+0xb2>
+  8033a2:	25 64 20 62 79       	and    $0x79622064,%eax
+  8033a7:	74 65                	je     80340e <__rodata_start+0xfe>
+  8033a9:	73 3a                	jae    8033e5 <__rodata_start+0xd5>
+  8033ab:	20 25 73 0a 00 5b    	and    %ah,0x5b000a73(%rip)        # 5b803e24 <__bss_end+0x5affbe24>
+  8033b1:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  8033b6:	20 70 69             	and    %dh,0x69(%rax)
+  8033b9:	70 65                	jo     803420 <__rodata_start+0x110>
+  8033bb:	72 65                	jb     803422 <__rodata_start+0x112>
+  8033bd:	61                   	(bad)
+  8033be:	64 65 6f             	fs outsl %gs:(%rsi),(%dx)
+  8033c1:	66 20 77 72          	data16 and %dh,0x72(%rdi)
+  8033c5:	69 74 65 20 25 64 0a 	imul   $0xa6425,0x20(%rbp,%riz,2),%esi
+  8033cc:	00 
+  8033cd:	77 72                	ja     803441 <__rodata_start+0x131>
+  8033cf:	69 74 65 3a 20 25 69 	imul   $0x692520,0x3a(%rbp,%riz,2),%esi
+  8033d6:	00 
+  8033d7:	70 69                	jo     803442 <__rodata_start+0x132>
+  8033d9:	70 65                	jo     803440 <__rodata_start+0x130>
+  8033db:	77 72                	ja     80344f <__rodata_start+0x13f>
+  8033dd:	69 74 65 65 6f 66 00 	imul   $0x2e00666f,0x65(%rbp,%riz,2),%esi
+  8033e4:	2e 
+  8033e5:	00 78 00             	add    %bh,0x0(%rax)
+  8033e8:	0a 70 69             	or     0x69(%rax),%dh
+  8033eb:	70 65                	jo     803452 <__rodata_start+0x142>
+  8033ed:	20 77 72             	and    %dh,0x72(%rdi)
+  8033f0:	69 74 65 20 63 6c 6f 	imul   $0x736f6c63,0x20(%rbp,%riz,2),%esi
+  8033f7:	73 
+  8033f8:	65 64 20 70 72       	gs and %dh,%fs:0x72(%rax)
+  8033fd:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8033fe:	70 65                	jo     803465 <__rodata_start+0x155>
+  803400:	72 6c                	jb     80346e <__rodata_start+0x15e>
+  803402:	79 0a                	jns    80340e <__rodata_start+0xfe>
+  803404:	00 70 69             	add    %dh,0x69(%rax)
+  803407:	70 65                	jo     80346e <__rodata_start+0x15e>
+  803409:	20 74 65 73          	and    %dh,0x73(%rbp,%riz,2)
+  80340d:	74 73                	je     803482 <__rodata_start+0x172>
+  80340f:	20 70 61             	and    %dh,0x61(%rax)
+  803412:	73 73                	jae    803487 <__rodata_start+0x177>
+  803414:	65 64 0a 00          	gs or  %fs:(%rax),%al
+  803418:	4e 6f                	rex.WRX outsl %ds:(%rsi),(%dx)
+  80341a:	77 20                	ja     80343c <__rodata_start+0x12c>
+  80341c:	69 73 20 74 68 65 20 	imul   $0x20656874,0x20(%rbx),%esi
+  803423:	74 69                	je     80348e <__rodata_start+0x17e>
+  803425:	6d                   	insl   (%dx),%es:(%rdi)
+  803426:	65 20 66 6f          	and    %ah,%gs:0x6f(%rsi)
+  80342a:	72 20                	jb     80344c <__rodata_start+0x13c>
+  80342c:	61                   	(bad)
+  80342d:	6c                   	insb   (%dx),%es:(%rdi)
+  80342e:	6c                   	insb   (%dx),%es:(%rdi)
+  80342f:	20 67 6f             	and    %ah,0x6f(%rdi)
+  803432:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803433:	64 20 6d 65          	and    %ch,%fs:0x65(%rbp)
+  803437:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803438:	20 74 6f 20          	and    %dh,0x20(%rdi,%rbp,2)
+  80343c:	63 6f 6d             	movsxd 0x6d(%rdi),%ebp
+  80343f:	65 20 74 6f 20       	and    %dh,%gs:0x20(%rdi,%rbp,2)
+  803444:	74 68                	je     8034ae <__rodata_start+0x19e>
+  803446:	65 20 61 69          	and    %ah,%gs:0x69(%rcx)
+  80344a:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  80344e:	20 74 68 65          	and    %dh,0x65(%rax,%rbp,2)
+  803452:	69 72 20 70 61 72 74 	imul   $0x74726170,0x20(%rdx),%esi
+  803459:	79 2e                	jns    803489 <__rodata_start+0x179>
+  80345b:	00 3c 75 6e 6b 6e 6f 	add    %bh,0x6f6e6b6e(,%rsi,2)
+  803462:	77 6e                	ja     8034d2 <__rodata_start+0x1c2>
+  803464:	3e 00 66 90          	ds add %ah,-0x70(%rsi)
+  803468:	5b                   	pop    %rbx
+  803469:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  80346e:	20 75 73             	and    %dh,0x73(%rbp)
+  803471:	65 72 20             	gs jb  803494 <__rodata_start+0x184>
+  803474:	70 61                	jo     8034d7 <__rodata_start+0x1c7>
+  803476:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803477:	69 63 20 69 6e 20 25 	imul   $0x25206e69,0x20(%rbx),%esp
+  80347e:	73 20                	jae    8034a0 <__rodata_start+0x190>
+  803480:	61                   	(bad)
+  803481:	74 20                	je     8034a3 <__rodata_start+0x193>
+  803483:	25 73 3a 25 64       	and    $0x64253a73,%eax
+  803488:	3a 20                	cmp    (%rax),%ah
+  80348a:	00 30                	add    %dh,(%rax)
+  80348c:	31 32                	xor    %esi,(%rdx)
+  80348e:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  803495:	41                   	rex.B
+  803496:	42                   	rex.X
+  803497:	43                   	rex.XB
+  803498:	44                   	rex.R
+  803499:	45                   	rex.RB
+  80349a:	46 00 30             	rex.RX add %r14b,(%rax)
+  80349d:	31 32                	xor    %esi,(%rdx)
+  80349f:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  8034a6:	61                   	(bad)
+  8034a7:	62 63 64 65 66       	(bad)
+  8034ac:	00 28                	add    %ch,(%rax)
+  8034ae:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8034af:	75 6c                	jne    80351d <__rodata_start+0x20d>
+  8034b1:	6c                   	insb   (%dx),%es:(%rdi)
+  8034b2:	29 00                	sub    %eax,(%rax)
+  8034b4:	65 72 72             	gs jb  803529 <__rodata_start+0x219>
+  8034b7:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8034b8:	72 20                	jb     8034da <__rodata_start+0x1ca>
+  8034ba:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  8034bf:	73 70                	jae    803531 <__rodata_start+0x221>
+  8034c1:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  8034c5:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  8034cc:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8034cd:	72 00                	jb     8034cf <__rodata_start+0x1bf>
+  8034cf:	62 61 64 20 65       	(bad)
+  8034d4:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8034d5:	76 69                	jbe    803540 <__rodata_start+0x230>
+  8034d7:	72 6f                	jb     803548 <__rodata_start+0x238>
+  8034d9:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8034da:	6d                   	insl   (%dx),%es:(%rdi)
+  8034db:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  8034dd:	74 00                	je     8034df <__rodata_start+0x1cf>
+  8034df:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  8034e6:	20 70 61             	and    %dh,0x61(%rax)
+  8034e9:	72 61                	jb     80354c <__rodata_start+0x23c>
+  8034eb:	6d                   	insl   (%dx),%es:(%rdi)
+  8034ec:	65 74 65             	gs je  803554 <__rodata_start+0x244>
+  8034ef:	72 00                	jb     8034f1 <__rodata_start+0x1e1>
+  8034f1:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8034f2:	75 74                	jne    803568 <__rodata_start+0x258>
+  8034f4:	20 6f 66             	and    %ch,0x66(%rdi)
+  8034f7:	20 6d 65             	and    %ch,0x65(%rbp)
+  8034fa:	6d                   	insl   (%dx),%es:(%rdi)
+  8034fb:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8034fc:	72 79                	jb     803577 <__rodata_start+0x267>
+  8034fe:	00 6f 75             	add    %ch,0x75(%rdi)
+  803501:	74 20                	je     803523 <__rodata_start+0x213>
+  803503:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803504:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  803508:	76 69                	jbe    803573 <__rodata_start+0x263>
+  80350a:	72 6f                	jb     80357b <__rodata_start+0x26b>
+  80350c:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80350d:	6d                   	insl   (%dx),%es:(%rdi)
+  80350e:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803510:	74 73                	je     803585 <__rodata_start+0x275>
+  803512:	00 63 6f             	add    %ah,0x6f(%rbx)
+  803515:	72 72                	jb     803589 <__rodata_start+0x279>
+  803517:	75 70                	jne    803589 <__rodata_start+0x279>
+  803519:	74 65                	je     803580 <__rodata_start+0x270>
+  80351b:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  803520:	75 67                	jne    803589 <__rodata_start+0x279>
+  803522:	20 69 6e             	and    %ch,0x6e(%rcx)
+  803525:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  803527:	00 73 65             	add    %dh,0x65(%rbx)
+  80352a:	67 6d                	insl   (%dx),%es:(%edi)
+  80352c:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  80352e:	74 61                	je     803591 <__rodata_start+0x281>
+  803530:	74 69                	je     80359b <__rodata_start+0x28b>
+  803532:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803533:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803534:	20 66 61             	and    %ah,0x61(%rsi)
+  803537:	75 6c                	jne    8035a5 <__rodata_start+0x295>
+  803539:	74 00                	je     80353b <__rodata_start+0x22b>
+  80353b:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  803542:	20 45 4c             	and    %al,0x4c(%rbp)
+  803545:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  803549:	61                   	(bad)
+  80354a:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  80354f:	20 73 75             	and    %dh,0x75(%rbx)
+  803552:	63 68 20             	movsxd 0x20(%rax),%ebp
+  803555:	73 79                	jae    8035d0 <__rodata_start+0x2c0>
+  803557:	73 74                	jae    8035cd <__rodata_start+0x2bd>
+  803559:	65 6d                	gs insl (%dx),%es:(%rdi)
+  80355b:	20 63 61             	and    %ah,0x61(%rbx)
+  80355e:	6c                   	insb   (%dx),%es:(%rdi)
+  80355f:	6c                   	insb   (%dx),%es:(%rdi)
+  803560:	00 65 6e             	add    %ah,0x6e(%rbp)
+  803563:	74 72                	je     8035d7 <__rodata_start+0x2c7>
+  803565:	79 20                	jns    803587 <__rodata_start+0x277>
+  803567:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803568:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803569:	74 20                	je     80358b <__rodata_start+0x27b>
+  80356b:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  80356d:	75 6e                	jne    8035dd <__rodata_start+0x2cd>
+  80356f:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  803573:	76 20                	jbe    803595 <__rodata_start+0x285>
+  803575:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  80357c:	72 65                	jb     8035e3 <__rodata_start+0x2d3>
+  80357e:	63 76 69             	movsxd 0x69(%rsi),%esi
+  803581:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803582:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  803586:	65 78 70             	gs js  8035f9 <__rodata_start+0x2e9>
+  803589:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  80358e:	20 65 6e             	and    %ah,0x6e(%rbp)
+  803591:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  803595:	20 66 69             	and    %ah,0x69(%rsi)
+  803598:	6c                   	insb   (%dx),%es:(%rdi)
+  803599:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  80359d:	20 66 72             	and    %ah,0x72(%rsi)
+  8035a0:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  8035a5:	61                   	(bad)
+  8035a6:	63 65 20             	movsxd 0x20(%rbp),%esp
+  8035a9:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8035aa:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8035ab:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  8035af:	6b 00 74             	imul   $0x74,(%rax),%eax
+  8035b2:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8035b3:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8035b4:	20 6d 61             	and    %ch,0x61(%rbp)
+  8035b7:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8035b8:	79 20                	jns    8035da <__rodata_start+0x2ca>
+  8035ba:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  8035c1:	72 65                	jb     803628 <__rodata_start+0x318>
+  8035c3:	20 6f 70             	and    %ch,0x70(%rdi)
+  8035c6:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  8035c8:	00 66 69             	add    %ah,0x69(%rsi)
+  8035cb:	6c                   	insb   (%dx),%es:(%rdi)
+  8035cc:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  8035d0:	20 62 6c             	and    %ah,0x6c(%rdx)
+  8035d3:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8035d4:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  8035d7:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8035d8:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8035d9:	74 20                	je     8035fb <__rodata_start+0x2eb>
+  8035db:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  8035dd:	75 6e                	jne    80364d <__rodata_start+0x33d>
+  8035df:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  8035e3:	76 61                	jbe    803646 <__rodata_start+0x336>
+  8035e5:	6c                   	insb   (%dx),%es:(%rdi)
+  8035e6:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  8035ed:	00 
+  8035ee:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  8035f5:	72 65                	jb     80365c <__rodata_start+0x34c>
+  8035f7:	61                   	(bad)
+  8035f8:	64 79 20             	fs jns 80361b <__rodata_start+0x30b>
+  8035fb:	65 78 69             	gs js  803667 <__rodata_start+0x357>
+  8035fe:	73 74                	jae    803674 <__rodata_start+0x364>
+  803600:	73 00                	jae    803602 <__rodata_start+0x2f2>
+  803602:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803603:	70 65                	jo     80366a <__rodata_start+0x35a>
+  803605:	72 61                	jb     803668 <__rodata_start+0x358>
+  803607:	74 69                	je     803672 <__rodata_start+0x362>
+  803609:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80360a:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80360b:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  80360e:	74 20                	je     803630 <__rodata_start+0x320>
+  803610:	73 75                	jae    803687 <__rodata_start+0x377>
+  803612:	70 70                	jo     803684 <__rodata_start+0x374>
+  803614:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803615:	72 74                	jb     80368b <__rodata_start+0x37b>
+  803617:	65 64 00 6f 70       	gs add %ch,%fs:0x70(%rdi)
+  80361c:	65 72 61             	gs jb  803680 <__rodata_start+0x370>
+  80361f:	74 69                	je     80368a <__rodata_start+0x37a>
+  803621:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803622:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803623:	20 69 6e             	and    %ch,0x6e(%rcx)
+  803626:	74 65                	je     80368d <__rodata_start+0x37d>
+  803628:	72 72                	jb     80369c <__rodata_start+0x38c>
+  80362a:	75 70                	jne    80369c <__rodata_start+0x38c>
+  80362c:	74 65                	je     803693 <__rodata_start+0x383>
+  80362e:	64 00 6e 6f          	add    %ch,%fs:0x6f(%rsi)
+  803632:	74 20                	je     803654 <__rodata_start+0x344>
+  803634:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803636:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803637:	75 67                	jne    8036a0 <__rodata_start+0x390>
+  803639:	68 20 43 50 55       	push   $0x55504320
+  80363e:	20 74 69 6d          	and    %dh,0x6d(%rcx,%rbp,2)
+  803642:	65 00 66 2e          	add    %ah,%gs:0x2e(%rsi)
+  803646:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+  80364d:	00 
+  80364e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  803655:	00 00 00 
+  803658:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+  80365f:	00 
+  803660:	b1 08                	mov    $0x8,%cl
+  803662:	80 00 00             	addb   $0x0,(%rax)
+  803665:	00 00                	add    %al,(%rax)
+  803667:	00 f2                	add    %dh,%dl
+  803669:	0e                   	(bad)
+  80366a:	80 00 00             	addb   $0x0,(%rax)
+  80366d:	00 00                	add    %al,(%rax)
+  80366f:	00 e2                	add    %ah,%dl
+  803671:	0e                   	(bad)
+  803672:	80 00 00             	addb   $0x0,(%rax)
+  803675:	00 00                	add    %al,(%rax)
+  803677:	00 f2                	add    %dh,%dl
+  803679:	0e                   	(bad)
+  80367a:	80 00 00             	addb   $0x0,(%rax)
+  80367d:	00 00                	add    %al,(%rax)
+  80367f:	00 f2                	add    %dh,%dl
+  803681:	0e                   	(bad)
+  803682:	80 00 00             	addb   $0x0,(%rax)
+  803685:	00 00                	add    %al,(%rax)
+  803687:	00 f2                	add    %dh,%dl
+  803689:	0e                   	(bad)
+  80368a:	80 00 00             	addb   $0x0,(%rax)
+  80368d:	00 00                	add    %al,(%rax)
+  80368f:	00 f2                	add    %dh,%dl
+  803691:	0e                   	(bad)
+  803692:	80 00 00             	addb   $0x0,(%rax)
+  803695:	00 00                	add    %al,(%rax)
+  803697:	00 d0                	add    %dl,%al
+  803699:	08 80 00 00 00 00    	or     %al,0x0(%rax)
+  80369f:	00 f2                	add    %dh,%dl
+  8036a1:	0e                   	(bad)
+  8036a2:	80 00 00             	addb   $0x0,(%rax)
+  8036a5:	00 00                	add    %al,(%rax)
+  8036a7:	00 f2                	add    %dh,%dl
+  8036a9:	0e                   	(bad)
+  8036aa:	80 00 00             	addb   $0x0,(%rax)
+  8036ad:	00 00                	add    %al,(%rax)
+  8036af:	00 c4                	add    %al,%ah
+  8036b1:	08 80 00 00 00 00    	or     %al,0x0(%rax)
+  8036b7:	00 3e                	add    %bh,(%rsi)
+  8036b9:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  8036bf:	00 f2                	add    %dh,%dl
+  8036c1:	0e                   	(bad)
+  8036c2:	80 00 00             	addb   $0x0,(%rax)
+  8036c5:	00 00                	add    %al,(%rax)
+  8036c7:	00 c4                	add    %al,%ah
+  8036c9:	08 80 00 00 00 00    	or     %al,0x0(%rax)
+  8036cf:	00 0a                	add    %cl,(%rdx)
+  8036d1:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  8036d7:	00 0a                	add    %cl,(%rdx)
+  8036d9:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  8036df:	00 0a                	add    %cl,(%rdx)
+  8036e1:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  8036e7:	00 0a                	add    %cl,(%rdx)
+  8036e9:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  8036ef:	00 0a                	add    %cl,(%rdx)
+  8036f1:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  8036f7:	00 0a                	add    %cl,(%rdx)
+  8036f9:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  8036ff:	00 0a                	add    %cl,(%rdx)
+  803701:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803707:	00 0a                	add    %cl,(%rdx)
+  803709:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  80370f:	00 0a                	add    %cl,(%rdx)
+  803711:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  803717:	00 f2                	add    %dh,%dl
+  803719:	0e                   	(bad)
+  80371a:	80 00 00             	addb   $0x0,(%rax)
+  80371d:	00 00                	add    %al,(%rax)
+  80371f:	00 f2                	add    %dh,%dl
+  803721:	0e                   	(bad)
+  803722:	80 00 00             	addb   $0x0,(%rax)
+  803725:	00 00                	add    %al,(%rax)
+  803727:	00 f2                	add    %dh,%dl
+  803729:	0e                   	(bad)
+  80372a:	80 00 00             	addb   $0x0,(%rax)
+  80372d:	00 00                	add    %al,(%rax)
+  80372f:	00 f2                	add    %dh,%dl
+  803731:	0e                   	(bad)
+  803732:	80 00 00             	addb   $0x0,(%rax)
+  803735:	00 00                	add    %al,(%rax)
+  803737:	00 f2                	add    %dh,%dl
+  803739:	0e                   	(bad)
+  80373a:	80 00 00             	addb   $0x0,(%rax)
+  80373d:	00 00                	add    %al,(%rax)
+  80373f:	00 f2                	add    %dh,%dl
+  803741:	0e                   	(bad)
+  803742:	80 00 00             	addb   $0x0,(%rax)
+  803745:	00 00                	add    %al,(%rax)
+  803747:	00 f2                	add    %dh,%dl
+  803749:	0e                   	(bad)
+  80374a:	80 00 00             	addb   $0x0,(%rax)
+  80374d:	00 00                	add    %al,(%rax)
+  80374f:	00 f2                	add    %dh,%dl
+  803751:	0e                   	(bad)
+  803752:	80 00 00             	addb   $0x0,(%rax)
+  803755:	00 00                	add    %al,(%rax)
+  803757:	00 f2                	add    %dh,%dl
+  803759:	0e                   	(bad)
+  80375a:	80 00 00             	addb   $0x0,(%rax)
+  80375d:	00 00                	add    %al,(%rax)
+  80375f:	00 f2                	add    %dh,%dl
+  803761:	0e                   	(bad)
+  803762:	80 00 00             	addb   $0x0,(%rax)
+  803765:	00 00                	add    %al,(%rax)
+  803767:	00 f2                	add    %dh,%dl
+  803769:	0e                   	(bad)
+  80376a:	80 00 00             	addb   $0x0,(%rax)
+  80376d:	00 00                	add    %al,(%rax)
+  80376f:	00 f2                	add    %dh,%dl
+  803771:	0e                   	(bad)
+  803772:	80 00 00             	addb   $0x0,(%rax)
+  803775:	00 00                	add    %al,(%rax)
+  803777:	00 f2                	add    %dh,%dl
+  803779:	0e                   	(bad)
+  80377a:	80 00 00             	addb   $0x0,(%rax)
+  80377d:	00 00                	add    %al,(%rax)
+  80377f:	00 f2                	add    %dh,%dl
+  803781:	0e                   	(bad)
+  803782:	80 00 00             	addb   $0x0,(%rax)
+  803785:	00 00                	add    %al,(%rax)
+  803787:	00 f2                	add    %dh,%dl
+  803789:	0e                   	(bad)
+  80378a:	80 00 00             	addb   $0x0,(%rax)
+  80378d:	00 00                	add    %al,(%rax)
+  80378f:	00 f2                	add    %dh,%dl
+  803791:	0e                   	(bad)
+  803792:	80 00 00             	addb   $0x0,(%rax)
+  803795:	00 00                	add    %al,(%rax)
+  803797:	00 f2                	add    %dh,%dl
+  803799:	0e                   	(bad)
+  80379a:	80 00 00             	addb   $0x0,(%rax)
+  80379d:	00 00                	add    %al,(%rax)
+  80379f:	00 f2                	add    %dh,%dl
+  8037a1:	0e                   	(bad)
+  8037a2:	80 00 00             	addb   $0x0,(%rax)
+  8037a5:	00 00                	add    %al,(%rax)
+  8037a7:	00 f2                	add    %dh,%dl
+  8037a9:	0e                   	(bad)
+  8037aa:	80 00 00             	addb   $0x0,(%rax)
+  8037ad:	00 00                	add    %al,(%rax)
+  8037af:	00 f2                	add    %dh,%dl
+  8037b1:	0e                   	(bad)
+  8037b2:	80 00 00             	addb   $0x0,(%rax)
+  8037b5:	00 00                	add    %al,(%rax)
+  8037b7:	00 f2                	add    %dh,%dl
+  8037b9:	0e                   	(bad)
+  8037ba:	80 00 00             	addb   $0x0,(%rax)
+  8037bd:	00 00                	add    %al,(%rax)
+  8037bf:	00 f2                	add    %dh,%dl
+  8037c1:	0e                   	(bad)
+  8037c2:	80 00 00             	addb   $0x0,(%rax)
+  8037c5:	00 00                	add    %al,(%rax)
+  8037c7:	00 f2                	add    %dh,%dl
+  8037c9:	0e                   	(bad)
+  8037ca:	80 00 00             	addb   $0x0,(%rax)
+  8037cd:	00 00                	add    %al,(%rax)
+  8037cf:	00 f2                	add    %dh,%dl
+  8037d1:	0e                   	(bad)
+  8037d2:	80 00 00             	addb   $0x0,(%rax)
+  8037d5:	00 00                	add    %al,(%rax)
+  8037d7:	00 f2                	add    %dh,%dl
+  8037d9:	0e                   	(bad)
+  8037da:	80 00 00             	addb   $0x0,(%rax)
+  8037dd:	00 00                	add    %al,(%rax)
+  8037df:	00 f2                	add    %dh,%dl
+  8037e1:	0e                   	(bad)
+  8037e2:	80 00 00             	addb   $0x0,(%rax)
+  8037e5:	00 00                	add    %al,(%rax)
+  8037e7:	00 f2                	add    %dh,%dl
+  8037e9:	0e                   	(bad)
+  8037ea:	80 00 00             	addb   $0x0,(%rax)
+  8037ed:	00 00                	add    %al,(%rax)
+  8037ef:	00 f2                	add    %dh,%dl
+  8037f1:	0e                   	(bad)
+  8037f2:	80 00 00             	addb   $0x0,(%rax)
+  8037f5:	00 00                	add    %al,(%rax)
+  8037f7:	00 f2                	add    %dh,%dl
+  8037f9:	0e                   	(bad)
+  8037fa:	80 00 00             	addb   $0x0,(%rax)
+  8037fd:	00 00                	add    %al,(%rax)
+  8037ff:	00 f2                	add    %dh,%dl
+  803801:	0e                   	(bad)
+  803802:	80 00 00             	addb   $0x0,(%rax)
+  803805:	00 00                	add    %al,(%rax)
+  803807:	00 15 0e 80 00 00    	add    %dl,0x800e(%rip)        # 80b81b <__bss_end+0x381b>
+  80380d:	00 00                	add    %al,(%rax)
+  80380f:	00 f2                	add    %dh,%dl
+  803811:	0e                   	(bad)
+  803812:	80 00 00             	addb   $0x0,(%rax)
+  803815:	00 00                	add    %al,(%rax)
+  803817:	00 f2                	add    %dh,%dl
+  803819:	0e                   	(bad)
+  80381a:	80 00 00             	addb   $0x0,(%rax)
+  80381d:	00 00                	add    %al,(%rax)
+  80381f:	00 f2                	add    %dh,%dl
+  803821:	0e                   	(bad)
+  803822:	80 00 00             	addb   $0x0,(%rax)
+  803825:	00 00                	add    %al,(%rax)
+  803827:	00 f2                	add    %dh,%dl
+  803829:	0e                   	(bad)
+  80382a:	80 00 00             	addb   $0x0,(%rax)
+  80382d:	00 00                	add    %al,(%rax)
+  80382f:	00 f2                	add    %dh,%dl
+  803831:	0e                   	(bad)
+  803832:	80 00 00             	addb   $0x0,(%rax)
+  803835:	00 00                	add    %al,(%rax)
+  803837:	00 f2                	add    %dh,%dl
+  803839:	0e                   	(bad)
+  80383a:	80 00 00             	addb   $0x0,(%rax)
+  80383d:	00 00                	add    %al,(%rax)
+  80383f:	00 f2                	add    %dh,%dl
+  803841:	0e                   	(bad)
+  803842:	80 00 00             	addb   $0x0,(%rax)
+  803845:	00 00                	add    %al,(%rax)
+  803847:	00 f2                	add    %dh,%dl
+  803849:	0e                   	(bad)
+  80384a:	80 00 00             	addb   $0x0,(%rax)
+  80384d:	00 00                	add    %al,(%rax)
+  80384f:	00 f2                	add    %dh,%dl
+  803851:	0e                   	(bad)
+  803852:	80 00 00             	addb   $0x0,(%rax)
+  803855:	00 00                	add    %al,(%rax)
+  803857:	00 f2                	add    %dh,%dl
+  803859:	0e                   	(bad)
+  80385a:	80 00 00             	addb   $0x0,(%rax)
+  80385d:	00 00                	add    %al,(%rax)
+  80385f:	00 61 09             	add    %ah,0x9(%rcx)
+  803862:	80 00 00             	addb   $0x0,(%rax)
+  803865:	00 00                	add    %al,(%rax)
+  803867:	00 30                	add    %dh,(%rax)
+  803869:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  80386f:	00 f2                	add    %dh,%dl
+  803871:	0e                   	(bad)
+  803872:	80 00 00             	addb   $0x0,(%rax)
+  803875:	00 00                	add    %al,(%rax)
+  803877:	00 f2                	add    %dh,%dl
+  803879:	0e                   	(bad)
+  80387a:	80 00 00             	addb   $0x0,(%rax)
+  80387d:	00 00                	add    %al,(%rax)
+  80387f:	00 f2                	add    %dh,%dl
+  803881:	0e                   	(bad)
+  803882:	80 00 00             	addb   $0x0,(%rax)
+  803885:	00 00                	add    %al,(%rax)
+  803887:	00 f2                	add    %dh,%dl
+  803889:	0e                   	(bad)
+  80388a:	80 00 00             	addb   $0x0,(%rax)
+  80388d:	00 00                	add    %al,(%rax)
+  80388f:	00 90 09 80 00 00    	add    %dl,0x8009(%rax)
+  803895:	00 00                	add    %al,(%rax)
+  803897:	00 f2                	add    %dh,%dl
+  803899:	0e                   	(bad)
+  80389a:	80 00 00             	addb   $0x0,(%rax)
+  80389d:	00 00                	add    %al,(%rax)
+  80389f:	00 f2                	add    %dh,%dl
+  8038a1:	0e                   	(bad)
+  8038a2:	80 00 00             	addb   $0x0,(%rax)
+  8038a5:	00 00                	add    %al,(%rax)
+  8038a7:	00 56 09             	add    %dl,0x9(%rsi)
+  8038aa:	80 00 00             	addb   $0x0,(%rax)
+  8038ad:	00 00                	add    %al,(%rax)
+  8038af:	00 f2                	add    %dh,%dl
+  8038b1:	0e                   	(bad)
+  8038b2:	80 00 00             	addb   $0x0,(%rax)
+  8038b5:	00 00                	add    %al,(%rax)
+  8038b7:	00 f2                	add    %dh,%dl
+  8038b9:	0e                   	(bad)
+  8038ba:	80 00 00             	addb   $0x0,(%rax)
+  8038bd:	00 00                	add    %al,(%rax)
+  8038bf:	00 d8                	add    %bl,%al
+  8038c1:	0c 80                	or     $0x80,%al
+  8038c3:	00 00                	add    %al,(%rax)
+  8038c5:	00 00                	add    %al,(%rax)
+  8038c7:	00 a2 0d 80 00 00    	add    %ah,0x800d(%rdx)
+  8038cd:	00 00                	add    %al,(%rax)
+  8038cf:	00 f2                	add    %dh,%dl
+  8038d1:	0e                   	(bad)
+  8038d2:	80 00 00             	addb   $0x0,(%rax)
+  8038d5:	00 00                	add    %al,(%rax)
+  8038d7:	00 f2                	add    %dh,%dl
+  8038d9:	0e                   	(bad)
+  8038da:	80 00 00             	addb   $0x0,(%rax)
+  8038dd:	00 00                	add    %al,(%rax)
+  8038df:	00 27                	add    %ah,(%rdi)
+  8038e1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8038e7:	00 f2                	add    %dh,%dl
+  8038e9:	0e                   	(bad)
+  8038ea:	80 00 00             	addb   $0x0,(%rax)
+  8038ed:	00 00                	add    %al,(%rax)
+  8038ef:	00 04 0c             	add    %al,(%rsp,%rcx,1)
+  8038f2:	80 00 00             	addb   $0x0,(%rax)
+  8038f5:	00 00                	add    %al,(%rax)
+  8038f7:	00 f2                	add    %dh,%dl
+  8038f9:	0e                   	(bad)
+  8038fa:	80 00 00             	addb   $0x0,(%rax)
+  8038fd:	00 00                	add    %al,(%rax)
+  8038ff:	00 f2                	add    %dh,%dl
+  803901:	0e                   	(bad)
+  803902:	80 00 00             	addb   $0x0,(%rax)
+  803905:	00 00                	add    %al,(%rax)
+  803907:	00 15 0e 80 00 00    	add    %dl,0x800e(%rip)        # 80b91b <__bss_end+0x391b>
+  80390d:	00 00                	add    %al,(%rax)
+  80390f:	00 f2                	add    %dh,%dl
+  803911:	0e                   	(bad)
+  803912:	80 00 00             	addb   $0x0,(%rax)
+  803915:	00 00                	add    %al,(%rax)
+  803917:	00 ba 08 80 00 00    	add    %bh,0x8008(%rdx)
+  80391d:	00 00                	add    %al,(%rax)
+	...
+
+0000000000803920 <error_string>:
+	...
+  803928:	bd 34 80 00 00 00 00 00 cf 34 80 00 00 00 00 00     .4.......4......
+  803938:	df 34 80 00 00 00 00 00 f1 34 80 00 00 00 00 00     .4.......4......
+  803948:	ff 34 80 00 00 00 00 00 13 35 80 00 00 00 00 00     .4.......5......
+  803958:	28 35 80 00 00 00 00 00 3b 35 80 00 00 00 00 00     (5......;5......
+  803968:	4d 35 80 00 00 00 00 00 61 35 80 00 00 00 00 00     M5......a5......
+  803978:	71 35 80 00 00 00 00 00 84 35 80 00 00 00 00 00     q5.......5......
+  803988:	9b 35 80 00 00 00 00 00 b1 35 80 00 00 00 00 00     .5.......5......
+  803998:	c9 35 80 00 00 00 00 00 e1 35 80 00 00 00 00 00     .5.......5......
+  8039a8:	ee 35 80 00 00 00 00 00 d0 39 80 00 00 00 00 00     .5.......9......
+  8039b8:	02 36 80 00 00 00 00 00 1a 36 80 00 00 00 00 00     .6.......6......
+  8039c8:	30 36 80 00 00 00 00 00 66 69 6c 65 20 69 73 20     06......file is 
+  8039d8:	6e 6f 74 20 61 20 76 61 6c 69 64 20 65 78 65 63     not a valid exec
+  8039e8:	75 74 61 62 6c 65 00 90 73 79 73 63 61 6c 6c 20     utable..syscall 
+  8039f8:	25 7a 64 20 72 65 74 75 72 6e 65 64 20 25 7a 64     %zd returned %zd
+  803a08:	20 28 3e 20 30 29 00 6c 69 62 2f 73 79 73 63 61      (> 0).lib/sysca
+  803a18:	6c 6c 2e 63 00 46 6f 72 6b 20 64 6f 75 62 6c 65     ll.c.Fork double
+  803a28:	20 66 61 75 6c 74 00 6c 69 62 2f 66 6f 72 6b 2e      fault.lib/fork.
+  803a38:	63 00 73 66 6f 72 6b 28 29 20 69 73 20 6e 6f 74     c.sfork() is not
+  803a48:	20 69 6d 70 6c 65 6d 65 6e 74 65 64 00 0f 1f 00      implemented....
+  803a58:	5b 25 30 38 78 5d 20 75 6e 6b 6e 6f 77 6e 20 64     [%08x] unknown d
+  803a68:	65 76 69 63 65 20 74 79 70 65 20 25 64 0a 00 00     evice type %d...
+  803a78:	5b 25 30 38 78 5d 20 66 74 72 75 6e 63 61 74 65     [%08x] ftruncate
+  803a88:	20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65 0a      %d -- bad mode.
+  803a98:	00 5b 25 30 38 78 5d 20 72 65 61 64 20 25 64 20     .[%08x] read %d 
+  803aa8:	2d 2d 20 62 61 64 20 6d 6f 64 65 0a 00 5b 25 30     -- bad mode..[%0
+  803ab8:	38 78 5d 20 77 72 69 74 65 20 25 64 20 2d 2d 20     8x] write %d -- 
+  803ac8:	62 61 64 20 6d 6f 64 65 0a 00 66 2e 0f 1f 84 00     bad mode..f.....
+  803ad8:	00 00 00 00 0f 1f 40 00                             ......@.
+
+0000000000803ae0 <devtab>:
+  803ae0:	20 40 80 00 00 00 00 00 60 40 80 00 00 00 00 00      @......`@......
+  803af0:	a0 40 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .@..............
+  803b00:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  803b10:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  803b20:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  803b30:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  803b40:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  803b50:	3d 20 32 00 65 6e 76 69 64 20 21 3d 20 30 00 6c     = 2.envid != 0.l
+  803b60:	69 62 2f 77 61 69 74 2e 63 00 3c 63 6f 6e 73 3e     ib/wait.c.<cons>
+  803b70:	00 63 6f 6e 73 00 73 79 73 5f 69 70 63 5f 74 72     .cons.sys_ipc_tr
+  803b80:	79 5f 73 65 6e 64 20 66 61 69 6c 65 64 3a 20 25     y_send failed: %
+  803b90:	69 00 6c 69 62 2f 69 70 63 2e 63 00 66 2e 0f 1f     i.lib/ipc.c.f...
+  803ba0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803bb0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803bc0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803bd0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803be0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803bf0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803c00:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803c10:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803c20:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803c30:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803c40:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803c50:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803c60:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803c70:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803c80:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803c90:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803ca0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803cb0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803cc0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803cd0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803ce0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803cf0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803d00:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803d10:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803d20:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803d30:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803d40:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803d50:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803d60:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803d70:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803d80:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803d90:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803da0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803db0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803dc0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803dd0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803de0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803df0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803e00:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803e10:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803e20:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803e30:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803e40:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803e50:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803e60:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803e70:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803e80:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803e90:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803ea0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803eb0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803ec0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803ed0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803ee0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803ef0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803f00:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803f10:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803f20:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803f30:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803f40:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803f50:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803f60:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803f70:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803f80:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803f90:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803fa0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803fb0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803fc0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803fd0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803fe0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803ff0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 0f 1f 40 00     ..f...........@.
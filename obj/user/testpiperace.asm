@@ -0,0 +1,6106 @@
+
+obj/user/testpiperace:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 29 03 00 00       	call   80034c <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 57                	push   %r15
+  80002b:	41 56                	push   %r14
+  80002d:	41 55                	push   %r13
+  80002f:	41 54                	push   %r12
+  800031:	53                   	push   %rbx
+  800032:	48 83 ec 28          	sub    $0x28,%rsp
+    int p[2], r, pid, i, max;
+    void *va;
+    struct Fd *fd;
+    const volatile struct Env *kid;
+
+    cprintf("testing for dup race...\n");
+  800036:	48 bf 00 31 80 00 00 	movabs $0x803100,%rdi
+  80003d:	00 00 00 
+  800040:	b8 00 00 00 00       	mov    $0x0,%eax
+  800045:	48 ba 68 05 80 00 00 	movabs $0x800568,%rdx
+  80004c:	00 00 00 
+  80004f:	ff d2                	call   *%rdx
+    if ((r = pipe(p)) < 0)
+  800051:	48 8d 7d c8          	lea    -0x38(%rbp),%rdi
+  800055:	48 b8 d2 29 80 00 00 	movabs $0x8029d2,%rax
+  80005c:	00 00 00 
+  80005f:	ff d0                	call   *%rax
+  800061:	85 c0                	test   %eax,%eax
+  800063:	0f 88 7f 01 00 00    	js     8001e8 <umain+0x1c3>
+        panic("pipe: %i", r);
+    max = 200;
+    if ((r = fork()) < 0)
+  800069:	48 b8 78 18 80 00 00 	movabs $0x801878,%rax
+  800070:	00 00 00 
+  800073:	ff d0                	call   *%rax
+  800075:	89 45 bc             	mov    %eax,-0x44(%rbp)
+  800078:	85 c0                	test   %eax,%eax
+  80007a:	0f 88 95 01 00 00    	js     800215 <umain+0x1f0>
+        panic("fork: %i", r);
+    if (r == 0) {
+  800080:	83 7d bc 00          	cmpl   $0x0,-0x44(%rbp)
+  800084:	0f 84 b8 01 00 00    	je     800242 <umain+0x21d>
+        }
+        /* do something to be not runnable besides exiting */
+        ipc_recv(0, 0, 0, 0);
+    }
+    pid = r;
+    cprintf("pid is %d\n", pid);
+  80008a:	8b 5d bc             	mov    -0x44(%rbp),%ebx
+  80008d:	89 de                	mov    %ebx,%esi
+  80008f:	48 bf 5a 31 80 00 00 	movabs $0x80315a,%rdi
+  800096:	00 00 00 
+  800099:	b8 00 00 00 00       	mov    $0x0,%eax
+  80009e:	49 bc 68 05 80 00 00 	movabs $0x800568,%r12
+  8000a5:	00 00 00 
+  8000a8:	41 ff d4             	call   *%r12
+    va = 0;
+    kid = &envs[ENVX(pid)];
+  8000ab:	41 89 dd             	mov    %ebx,%r13d
+  8000ae:	41 81 e5 ff 03 00 00 	and    $0x3ff,%r13d
+    cprintf("kid is %d\n", (int32_t)(kid - envs));
+  8000b5:	81 e3 ff 03 00 00    	and    $0x3ff,%ebx
+  8000bb:	48 69 db d0 01 00 00 	imul   $0x1d0,%rbx,%rbx
+  8000c2:	48 89 de             	mov    %rbx,%rsi
+  8000c5:	48 c1 fe 04          	sar    $0x4,%rsi
+  8000c9:	69 f6 35 c2 72 4f    	imul   $0x4f72c235,%esi,%esi
+  8000cf:	48 bf 65 31 80 00 00 	movabs $0x803165,%rdi
+  8000d6:	00 00 00 
+  8000d9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000de:	41 ff d4             	call   *%r12
+    dup(p[0], 10);
+  8000e1:	be 0a 00 00 00       	mov    $0xa,%esi
+  8000e6:	8b 7d c8             	mov    -0x38(%rbp),%edi
+  8000e9:	48 b8 25 1e 80 00 00 	movabs $0x801e25,%rax
+  8000f0:	00 00 00 
+  8000f3:	ff d0                	call   *%rax
+    while (kid->env_status == ENV_RUNNABLE)
+  8000f5:	48 b8 00 00 c0 1f 80 	movabs $0x801fc00000,%rax
+  8000fc:	00 00 00 
+  8000ff:	48 01 d8             	add    %rbx,%rax
+  800102:	8b 80 ec 00 00 00    	mov    0xec(%rax),%eax
+  800108:	83 f8 02             	cmp    $0x2,%eax
+  80010b:	75 37                	jne    800144 <umain+0x11f>
+        dup(p[0], 10);
+  80010d:	49 bc 25 1e 80 00 00 	movabs $0x801e25,%r12
+  800114:	00 00 00 
+    while (kid->env_status == ENV_RUNNABLE)
+  800117:	4d 63 ed             	movslq %r13d,%r13
+  80011a:	4d 69 ed d0 01 00 00 	imul   $0x1d0,%r13,%r13
+  800121:	48 bb 00 00 c0 1f 80 	movabs $0x801fc00000,%rbx
+  800128:	00 00 00 
+  80012b:	4c 01 eb             	add    %r13,%rbx
+        dup(p[0], 10);
+  80012e:	be 0a 00 00 00       	mov    $0xa,%esi
+  800133:	8b 7d c8             	mov    -0x38(%rbp),%edi
+  800136:	41 ff d4             	call   *%r12
+    while (kid->env_status == ENV_RUNNABLE)
+  800139:	8b 83 ec 00 00 00    	mov    0xec(%rbx),%eax
+  80013f:	83 f8 02             	cmp    $0x2,%eax
+  800142:	74 ea                	je     80012e <umain+0x109>
+
+    cprintf("child done with loop\n");
+  800144:	48 bf 70 31 80 00 00 	movabs $0x803170,%rdi
+  80014b:	00 00 00 
+  80014e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800153:	48 ba 68 05 80 00 00 	movabs $0x800568,%rdx
+  80015a:	00 00 00 
+  80015d:	ff d2                	call   *%rdx
+    if (pipeisclosed(p[0]))
+  80015f:	8b 7d c8             	mov    -0x38(%rbp),%edi
+  800162:	48 b8 d4 2b 80 00 00 	movabs $0x802bd4,%rax
+  800169:	00 00 00 
+  80016c:	ff d0                	call   *%rax
+  80016e:	85 c0                	test   %eax,%eax
+  800170:	0f 85 5a 01 00 00    	jne    8002d0 <umain+0x2ab>
+        panic("somehow the other end of p[0] got closed!");
+    if ((r = fd_lookup(p[0], &fd)) < 0)
+  800176:	48 8d 75 c0          	lea    -0x40(%rbp),%rsi
+  80017a:	8b 7d c8             	mov    -0x38(%rbp),%edi
+  80017d:	48 b8 65 1c 80 00 00 	movabs $0x801c65,%rax
+  800184:	00 00 00 
+  800187:	ff d0                	call   *%rax
+  800189:	85 c0                	test   %eax,%eax
+  80018b:	0f 88 69 01 00 00    	js     8002fa <umain+0x2d5>
+        panic("cannot look up p[0]: %i", r);
+    va = fd2data(fd);
+  800191:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  800195:	48 b8 b6 1b 80 00 00 	movabs $0x801bb6,%rax
+  80019c:	00 00 00 
+  80019f:	ff d0                	call   *%rax
+  8001a1:	48 89 c7             	mov    %rax,%rdi
+    if (sys_region_refs(va, PAGE_SIZE) != 3 + 1)
+  8001a4:	be 00 10 00 00       	mov    $0x1000,%esi
+  8001a9:	48 b8 df 13 80 00 00 	movabs $0x8013df,%rax
+  8001b0:	00 00 00 
+  8001b3:	ff d0                	call   *%rax
+  8001b5:	83 f8 04             	cmp    $0x4,%eax
+  8001b8:	0f 84 69 01 00 00    	je     800327 <umain+0x302>
+        cprintf("\nchild detected race\n");
+  8001be:	48 bf 9e 31 80 00 00 	movabs $0x80319e,%rdi
+  8001c5:	00 00 00 
+  8001c8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001cd:	48 ba 68 05 80 00 00 	movabs $0x800568,%rdx
+  8001d4:	00 00 00 
+  8001d7:	ff d2                	call   *%rdx
+    else
+        cprintf("\nrace didn't happen (number of tests: %d)\n", max);
+}
+  8001d9:	48 83 c4 28          	add    $0x28,%rsp
+  8001dd:	5b                   	pop    %rbx
+  8001de:	41 5c                	pop    %r12
+  8001e0:	41 5d                	pop    %r13
+  8001e2:	41 5e                	pop    %r14
+  8001e4:	41 5f                	pop    %r15
+  8001e6:	5d                   	pop    %rbp
+  8001e7:	c3                   	ret
+        panic("pipe: %i", r);
+  8001e8:	89 c1                	mov    %eax,%ecx
+  8001ea:	48 ba 19 31 80 00 00 	movabs $0x803119,%rdx
+  8001f1:	00 00 00 
+  8001f4:	be 0c 00 00 00       	mov    $0xc,%esi
+  8001f9:	48 bf 22 31 80 00 00 	movabs $0x803122,%rdi
+  800200:	00 00 00 
+  800203:	b8 00 00 00 00       	mov    $0x0,%eax
+  800208:	49 b8 18 04 80 00 00 	movabs $0x800418,%r8
+  80020f:	00 00 00 
+  800212:	41 ff d0             	call   *%r8
+        panic("fork: %i", r);
+  800215:	89 c1                	mov    %eax,%ecx
+  800217:	48 ba 36 31 80 00 00 	movabs $0x803136,%rdx
+  80021e:	00 00 00 
+  800221:	be 0f 00 00 00       	mov    $0xf,%esi
+  800226:	48 bf 22 31 80 00 00 	movabs $0x803122,%rdi
+  80022d:	00 00 00 
+  800230:	b8 00 00 00 00       	mov    $0x0,%eax
+  800235:	49 b8 18 04 80 00 00 	movabs $0x800418,%r8
+  80023c:	00 00 00 
+  80023f:	41 ff d0             	call   *%r8
+        close(p[1]);
+  800242:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  800245:	48 b8 ca 1d 80 00 00 	movabs $0x801dca,%rax
+  80024c:	00 00 00 
+  80024f:	ff d0                	call   *%rax
+  800251:	bb c8 00 00 00       	mov    $0xc8,%ebx
+            if (pipeisclosed(p[0])) {
+  800256:	49 bc d4 2b 80 00 00 	movabs $0x802bd4,%r12
+  80025d:	00 00 00 
+                cprintf("RACE: pipe appears closed\n");
+  800260:	49 bf 3f 31 80 00 00 	movabs $0x80313f,%r15
+  800267:	00 00 00 
+  80026a:	49 be 68 05 80 00 00 	movabs $0x800568,%r14
+  800271:	00 00 00 
+                exit();
+  800274:	49 bd f5 03 80 00 00 	movabs $0x8003f5,%r13
+  80027b:	00 00 00 
+  80027e:	eb 11                	jmp    800291 <umain+0x26c>
+            sys_yield();
+  800280:	48 b8 ae 13 80 00 00 	movabs $0x8013ae,%rax
+  800287:	00 00 00 
+  80028a:	ff d0                	call   *%rax
+        for (i = 0; i < max; i++) {
+  80028c:	83 eb 01             	sub    $0x1,%ebx
+  80028f:	74 1a                	je     8002ab <umain+0x286>
+            if (pipeisclosed(p[0])) {
+  800291:	8b 7d c8             	mov    -0x38(%rbp),%edi
+  800294:	41 ff d4             	call   *%r12
+  800297:	85 c0                	test   %eax,%eax
+  800299:	74 e5                	je     800280 <umain+0x25b>
+                cprintf("RACE: pipe appears closed\n");
+  80029b:	4c 89 ff             	mov    %r15,%rdi
+  80029e:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002a3:	41 ff d6             	call   *%r14
+                exit();
+  8002a6:	41 ff d5             	call   *%r13
+  8002a9:	eb d5                	jmp    800280 <umain+0x25b>
+        ipc_recv(0, 0, 0, 0);
+  8002ab:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8002b0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8002b5:	be 00 00 00 00       	mov    $0x0,%esi
+  8002ba:	bf 00 00 00 00       	mov    $0x0,%edi
+  8002bf:	48 b8 dc 19 80 00 00 	movabs $0x8019dc,%rax
+  8002c6:	00 00 00 
+  8002c9:	ff d0                	call   *%rax
+  8002cb:	e9 ba fd ff ff       	jmp    80008a <umain+0x65>
+        panic("somehow the other end of p[0] got closed!");
+  8002d0:	48 ba b8 31 80 00 00 	movabs $0x8031b8,%rdx
+  8002d7:	00 00 00 
+  8002da:	be 38 00 00 00       	mov    $0x38,%esi
+  8002df:	48 bf 22 31 80 00 00 	movabs $0x803122,%rdi
+  8002e6:	00 00 00 
+  8002e9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002ee:	48 b9 18 04 80 00 00 	movabs $0x800418,%rcx
+  8002f5:	00 00 00 
+  8002f8:	ff d1                	call   *%rcx
+        panic("cannot look up p[0]: %i", r);
+  8002fa:	89 c1                	mov    %eax,%ecx
+  8002fc:	48 ba 86 31 80 00 00 	movabs $0x803186,%rdx
+  800303:	00 00 00 
+  800306:	be 3a 00 00 00       	mov    $0x3a,%esi
+  80030b:	48 bf 22 31 80 00 00 	movabs $0x803122,%rdi
+  800312:	00 00 00 
+  800315:	b8 00 00 00 00       	mov    $0x0,%eax
+  80031a:	49 b8 18 04 80 00 00 	movabs $0x800418,%r8
+  800321:	00 00 00 
+  800324:	41 ff d0             	call   *%r8
+        cprintf("\nrace didn't happen (number of tests: %d)\n", max);
+  800327:	be c8 00 00 00       	mov    $0xc8,%esi
+  80032c:	48 bf e8 31 80 00 00 	movabs $0x8031e8,%rdi
+  800333:	00 00 00 
+  800336:	b8 00 00 00 00       	mov    $0x0,%eax
+  80033b:	48 ba 68 05 80 00 00 	movabs $0x800568,%rdx
+  800342:	00 00 00 
+  800345:	ff d2                	call   *%rdx
+}
+  800347:	e9 8d fe ff ff       	jmp    8001d9 <umain+0x1b4>
+
+000000000080034c <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  80034c:	55                   	push   %rbp
+  80034d:	48 89 e5             	mov    %rsp,%rbp
+  800350:	41 56                	push   %r14
+  800352:	41 55                	push   %r13
+  800354:	41 54                	push   %r12
+  800356:	53                   	push   %rbx
+  800357:	41 89 fd             	mov    %edi,%r13d
+  80035a:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  80035d:	48 ba d8 40 80 00 00 	movabs $0x8040d8,%rdx
+  800364:	00 00 00 
+  800367:	48 b8 d8 40 80 00 00 	movabs $0x8040d8,%rax
+  80036e:	00 00 00 
+  800371:	48 39 c2             	cmp    %rax,%rdx
+  800374:	73 17                	jae    80038d <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  800376:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  800379:	49 89 c4             	mov    %rax,%r12
+  80037c:	48 83 c3 08          	add    $0x8,%rbx
+  800380:	b8 00 00 00 00       	mov    $0x0,%eax
+  800385:	ff 53 f8             	call   *-0x8(%rbx)
+  800388:	4c 39 e3             	cmp    %r12,%rbx
+  80038b:	72 ef                	jb     80037c <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+    envid_t this_env_id = sys_getenvid();
+  80038d:	48 b8 7d 13 80 00 00 	movabs $0x80137d,%rax
+  800394:	00 00 00 
+  800397:	ff d0                	call   *%rax
+    thisenv = &((struct Env*)UENVS)[ENVX(this_env_id)];
+  800399:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80039e:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+  8003a5:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8003ac:	00 00 00 
+  8003af:	48 01 d0             	add    %rdx,%rax
+  8003b2:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  8003b9:	00 00 00 
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8003bc:	45 85 ed             	test   %r13d,%r13d
+  8003bf:	7e 0d                	jle    8003ce <libmain+0x82>
+  8003c1:	49 8b 06             	mov    (%r14),%rax
+  8003c4:	48 a3 00 40 80 00 00 	movabs %rax,0x804000
+  8003cb:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8003ce:	4c 89 f6             	mov    %r14,%rsi
+  8003d1:	44 89 ef             	mov    %r13d,%edi
+  8003d4:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8003db:	00 00 00 
+  8003de:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8003e0:	48 b8 f5 03 80 00 00 	movabs $0x8003f5,%rax
+  8003e7:	00 00 00 
+  8003ea:	ff d0                	call   *%rax
+#endif
+}
+  8003ec:	5b                   	pop    %rbx
+  8003ed:	41 5c                	pop    %r12
+  8003ef:	41 5d                	pop    %r13
+  8003f1:	41 5e                	pop    %r14
+  8003f3:	5d                   	pop    %rbp
+  8003f4:	c3                   	ret
+
+00000000008003f5 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8003f5:	55                   	push   %rbp
+  8003f6:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  8003f9:	48 b8 fd 1d 80 00 00 	movabs $0x801dfd,%rax
+  800400:	00 00 00 
+  800403:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  800405:	bf 00 00 00 00       	mov    $0x0,%edi
+  80040a:	48 b8 12 13 80 00 00 	movabs $0x801312,%rax
+  800411:	00 00 00 
+  800414:	ff d0                	call   *%rax
+}
+  800416:	5d                   	pop    %rbp
+  800417:	c3                   	ret
+
+0000000000800418 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  800418:	55                   	push   %rbp
+  800419:	48 89 e5             	mov    %rsp,%rbp
+  80041c:	41 56                	push   %r14
+  80041e:	41 55                	push   %r13
+  800420:	41 54                	push   %r12
+  800422:	53                   	push   %rbx
+  800423:	48 83 ec 50          	sub    $0x50,%rsp
+  800427:	49 89 fc             	mov    %rdi,%r12
+  80042a:	41 89 f5             	mov    %esi,%r13d
+  80042d:	48 89 d3             	mov    %rdx,%rbx
+  800430:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  800434:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  800438:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  80043c:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  800443:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800447:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  80044b:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  80044f:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  800453:	48 b8 00 40 80 00 00 	movabs $0x804000,%rax
+  80045a:	00 00 00 
+  80045d:	4c 8b 30             	mov    (%rax),%r14
+  800460:	48 b8 7d 13 80 00 00 	movabs $0x80137d,%rax
+  800467:	00 00 00 
+  80046a:	ff d0                	call   *%rax
+  80046c:	89 c6                	mov    %eax,%esi
+  80046e:	45 89 e8             	mov    %r13d,%r8d
+  800471:	4c 89 e1             	mov    %r12,%rcx
+  800474:	4c 89 f2             	mov    %r14,%rdx
+  800477:	48 bf 20 32 80 00 00 	movabs $0x803220,%rdi
+  80047e:	00 00 00 
+  800481:	b8 00 00 00 00       	mov    $0x0,%eax
+  800486:	49 bc 68 05 80 00 00 	movabs $0x800568,%r12
+  80048d:	00 00 00 
+  800490:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  800493:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  800497:	48 89 df             	mov    %rbx,%rdi
+  80049a:	48 b8 04 05 80 00 00 	movabs $0x800504,%rax
+  8004a1:	00 00 00 
+  8004a4:	ff d0                	call   *%rax
+    cprintf("\n");
+  8004a6:	48 bf 17 31 80 00 00 	movabs $0x803117,%rdi
+  8004ad:	00 00 00 
+  8004b0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004b5:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  8004b8:	cc                   	int3
+  8004b9:	eb fd                	jmp    8004b8 <_panic+0xa0>
+
+00000000008004bb <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  8004bb:	55                   	push   %rbp
+  8004bc:	48 89 e5             	mov    %rsp,%rbp
+  8004bf:	53                   	push   %rbx
+  8004c0:	48 83 ec 08          	sub    $0x8,%rsp
+  8004c4:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  8004c7:	8b 06                	mov    (%rsi),%eax
+  8004c9:	8d 50 01             	lea    0x1(%rax),%edx
+  8004cc:	89 16                	mov    %edx,(%rsi)
+  8004ce:	48 98                	cltq
+  8004d0:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  8004d5:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  8004db:	74 0a                	je     8004e7 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  8004dd:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  8004e1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8004e5:	c9                   	leave
+  8004e6:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  8004e7:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  8004eb:	be ff 00 00 00       	mov    $0xff,%esi
+  8004f0:	48 b8 b4 12 80 00 00 	movabs $0x8012b4,%rax
+  8004f7:	00 00 00 
+  8004fa:	ff d0                	call   *%rax
+        state->offset = 0;
+  8004fc:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  800502:	eb d9                	jmp    8004dd <putch+0x22>
+
+0000000000800504 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  800504:	55                   	push   %rbp
+  800505:	48 89 e5             	mov    %rsp,%rbp
+  800508:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  80050f:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  800512:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  800519:	b9 21 00 00 00       	mov    $0x21,%ecx
+  80051e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800523:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  800526:	48 89 f1             	mov    %rsi,%rcx
+  800529:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  800530:	48 bf bb 04 80 00 00 	movabs $0x8004bb,%rdi
+  800537:	00 00 00 
+  80053a:	48 b8 b8 06 80 00 00 	movabs $0x8006b8,%rax
+  800541:	00 00 00 
+  800544:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  800546:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  80054d:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  800554:	48 b8 b4 12 80 00 00 	movabs $0x8012b4,%rax
+  80055b:	00 00 00 
+  80055e:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  800560:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  800566:	c9                   	leave
+  800567:	c3                   	ret
+
+0000000000800568 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  800568:	55                   	push   %rbp
+  800569:	48 89 e5             	mov    %rsp,%rbp
+  80056c:	48 83 ec 50          	sub    $0x50,%rsp
+  800570:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  800574:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  800578:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80057c:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800580:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  800584:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  80058b:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80058f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800593:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800597:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  80059b:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  80059f:	48 b8 04 05 80 00 00 	movabs $0x800504,%rax
+  8005a6:	00 00 00 
+  8005a9:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  8005ab:	c9                   	leave
+  8005ac:	c3                   	ret
+
+00000000008005ad <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  8005ad:	55                   	push   %rbp
+  8005ae:	48 89 e5             	mov    %rsp,%rbp
+  8005b1:	41 57                	push   %r15
+  8005b3:	41 56                	push   %r14
+  8005b5:	41 55                	push   %r13
+  8005b7:	41 54                	push   %r12
+  8005b9:	53                   	push   %rbx
+  8005ba:	48 83 ec 18          	sub    $0x18,%rsp
+  8005be:	49 89 fc             	mov    %rdi,%r12
+  8005c1:	49 89 f5             	mov    %rsi,%r13
+  8005c4:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8005c8:	8b 45 10             	mov    0x10(%rbp),%eax
+  8005cb:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  8005ce:	41 89 cf             	mov    %ecx,%r15d
+  8005d1:	4c 39 fa             	cmp    %r15,%rdx
+  8005d4:	73 5b                	jae    800631 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  8005d6:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  8005da:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  8005de:	85 db                	test   %ebx,%ebx
+  8005e0:	7e 0e                	jle    8005f0 <print_num+0x43>
+            putch(padc, put_arg);
+  8005e2:	4c 89 ee             	mov    %r13,%rsi
+  8005e5:	44 89 f7             	mov    %r14d,%edi
+  8005e8:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  8005eb:	83 eb 01             	sub    $0x1,%ebx
+  8005ee:	75 f2                	jne    8005e2 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  8005f0:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  8005f4:	48 b9 54 32 80 00 00 	movabs $0x803254,%rcx
+  8005fb:	00 00 00 
+  8005fe:	48 b8 43 32 80 00 00 	movabs $0x803243,%rax
+  800605:	00 00 00 
+  800608:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  80060c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800610:	ba 00 00 00 00       	mov    $0x0,%edx
+  800615:	49 f7 f7             	div    %r15
+  800618:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  80061c:	4c 89 ee             	mov    %r13,%rsi
+  80061f:	41 ff d4             	call   *%r12
+}
+  800622:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800626:	5b                   	pop    %rbx
+  800627:	41 5c                	pop    %r12
+  800629:	41 5d                	pop    %r13
+  80062b:	41 5e                	pop    %r14
+  80062d:	41 5f                	pop    %r15
+  80062f:	5d                   	pop    %rbp
+  800630:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  800631:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800635:	ba 00 00 00 00       	mov    $0x0,%edx
+  80063a:	49 f7 f7             	div    %r15
+  80063d:	48 83 ec 08          	sub    $0x8,%rsp
+  800641:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  800645:	52                   	push   %rdx
+  800646:	45 0f be c9          	movsbl %r9b,%r9d
+  80064a:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  80064e:	48 89 c2             	mov    %rax,%rdx
+  800651:	48 b8 ad 05 80 00 00 	movabs $0x8005ad,%rax
+  800658:	00 00 00 
+  80065b:	ff d0                	call   *%rax
+  80065d:	48 83 c4 10          	add    $0x10,%rsp
+  800661:	eb 8d                	jmp    8005f0 <print_num+0x43>
+
+0000000000800663 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  800663:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  800667:	48 8b 06             	mov    (%rsi),%rax
+  80066a:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  80066e:	73 0a                	jae    80067a <sprintputch+0x17>
+        *state->start++ = ch;
+  800670:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800674:	48 89 16             	mov    %rdx,(%rsi)
+  800677:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  80067a:	c3                   	ret
+
+000000000080067b <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  80067b:	55                   	push   %rbp
+  80067c:	48 89 e5             	mov    %rsp,%rbp
+  80067f:	48 83 ec 50          	sub    $0x50,%rsp
+  800683:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800687:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80068b:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  80068f:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800696:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80069a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80069e:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8006a2:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  8006a6:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8006aa:	48 b8 b8 06 80 00 00 	movabs $0x8006b8,%rax
+  8006b1:	00 00 00 
+  8006b4:	ff d0                	call   *%rax
+}
+  8006b6:	c9                   	leave
+  8006b7:	c3                   	ret
+
+00000000008006b8 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  8006b8:	55                   	push   %rbp
+  8006b9:	48 89 e5             	mov    %rsp,%rbp
+  8006bc:	41 57                	push   %r15
+  8006be:	41 56                	push   %r14
+  8006c0:	41 55                	push   %r13
+  8006c2:	41 54                	push   %r12
+  8006c4:	53                   	push   %rbx
+  8006c5:	48 83 ec 38          	sub    $0x38,%rsp
+  8006c9:	49 89 fe             	mov    %rdi,%r14
+  8006cc:	49 89 f5             	mov    %rsi,%r13
+  8006cf:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  8006d2:	48 8b 01             	mov    (%rcx),%rax
+  8006d5:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8006d9:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  8006dd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006e1:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  8006e5:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  8006e9:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  8006ed:	0f b6 3b             	movzbl (%rbx),%edi
+  8006f0:	40 80 ff 25          	cmp    $0x25,%dil
+  8006f4:	74 18                	je     80070e <vprintfmt+0x56>
+            if (!ch) return;
+  8006f6:	40 84 ff             	test   %dil,%dil
+  8006f9:	0f 84 b1 06 00 00    	je     800db0 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  8006ff:	40 0f b6 ff          	movzbl %dil,%edi
+  800703:	4c 89 ee             	mov    %r13,%rsi
+  800706:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  800709:	4c 89 e3             	mov    %r12,%rbx
+  80070c:	eb db                	jmp    8006e9 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  80070e:	be 00 00 00 00       	mov    $0x0,%esi
+  800713:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  800717:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  80071c:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800722:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  800729:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  80072d:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  800732:	41 0f b6 04 24       	movzbl (%r12),%eax
+  800737:	88 45 a0             	mov    %al,-0x60(%rbp)
+  80073a:	83 e8 23             	sub    $0x23,%eax
+  80073d:	3c 57                	cmp    $0x57,%al
+  80073f:	0f 87 51 06 00 00    	ja     800d96 <vprintfmt+0x6de>
+  800745:	0f b6 c0             	movzbl %al,%eax
+  800748:	48 b9 00 34 80 00 00 	movabs $0x803400,%rcx
+  80074f:	00 00 00 
+  800752:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  800755:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  800758:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  80075c:	eb cf                	jmp    80072d <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  80075e:	49 89 dc             	mov    %rbx,%r12
+  800761:	be 01 00 00 00       	mov    $0x1,%esi
+  800766:	eb c5                	jmp    80072d <vprintfmt+0x75>
+            padc = ch;
+  800768:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  80076c:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  80076f:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800772:	eb b9                	jmp    80072d <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800774:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800777:	83 f8 2f             	cmp    $0x2f,%eax
+  80077a:	77 24                	ja     8007a0 <vprintfmt+0xe8>
+  80077c:	89 c1                	mov    %eax,%ecx
+  80077e:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  800782:	83 c0 08             	add    $0x8,%eax
+  800785:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800788:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  80078b:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  80078e:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800792:	79 99                	jns    80072d <vprintfmt+0x75>
+                width = precision;
+  800794:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  800798:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  80079e:	eb 8d                	jmp    80072d <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8007a0:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8007a4:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  8007a8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007ac:	eb da                	jmp    800788 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  8007ae:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  8007b3:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8007b7:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  8007bd:	3c 39                	cmp    $0x39,%al
+  8007bf:	77 1c                	ja     8007dd <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  8007c1:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  8007c5:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  8007c9:	0f b6 c0             	movzbl %al,%eax
+  8007cc:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8007d1:	0f b6 03             	movzbl (%rbx),%eax
+  8007d4:	3c 39                	cmp    $0x39,%al
+  8007d6:	76 e9                	jbe    8007c1 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  8007d8:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  8007db:	eb b1                	jmp    80078e <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  8007dd:	49 89 dc             	mov    %rbx,%r12
+  8007e0:	eb ac                	jmp    80078e <vprintfmt+0xd6>
+            width = MAX(0, width);
+  8007e2:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  8007e5:	85 c9                	test   %ecx,%ecx
+  8007e7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007ec:	0f 49 c1             	cmovns %ecx,%eax
+  8007ef:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  8007f2:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8007f5:	e9 33 ff ff ff       	jmp    80072d <vprintfmt+0x75>
+            lflag++;
+  8007fa:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  8007fd:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800800:	e9 28 ff ff ff       	jmp    80072d <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  800805:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800808:	83 f8 2f             	cmp    $0x2f,%eax
+  80080b:	77 19                	ja     800826 <vprintfmt+0x16e>
+  80080d:	89 c2                	mov    %eax,%edx
+  80080f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800813:	83 c0 08             	add    $0x8,%eax
+  800816:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800819:	8b 3a                	mov    (%rdx),%edi
+  80081b:	4c 89 ee             	mov    %r13,%rsi
+  80081e:	41 ff d6             	call   *%r14
+            break;
+  800821:	e9 c3 fe ff ff       	jmp    8006e9 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  800826:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80082a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80082e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800832:	eb e5                	jmp    800819 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  800834:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800837:	83 f8 2f             	cmp    $0x2f,%eax
+  80083a:	77 5a                	ja     800896 <vprintfmt+0x1de>
+  80083c:	89 c2                	mov    %eax,%edx
+  80083e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800842:	83 c0 08             	add    $0x8,%eax
+  800845:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  800848:	8b 02                	mov    (%rdx),%eax
+  80084a:	89 c1                	mov    %eax,%ecx
+  80084c:	f7 d9                	neg    %ecx
+  80084e:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  800851:	83 f9 15             	cmp    $0x15,%ecx
+  800854:	7f 4e                	jg     8008a4 <vprintfmt+0x1ec>
+  800856:	48 63 c1             	movslq %ecx,%rax
+  800859:	48 ba c0 36 80 00 00 	movabs $0x8036c0,%rdx
+  800860:	00 00 00 
+  800863:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  800867:	48 85 c0             	test   %rax,%rax
+  80086a:	74 38                	je     8008a4 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  80086c:	48 89 c1             	mov    %rax,%rcx
+  80086f:	48 ba d9 38 80 00 00 	movabs $0x8038d9,%rdx
+  800876:	00 00 00 
+  800879:	4c 89 ee             	mov    %r13,%rsi
+  80087c:	4c 89 f7             	mov    %r14,%rdi
+  80087f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800884:	49 b8 7b 06 80 00 00 	movabs $0x80067b,%r8
+  80088b:	00 00 00 
+  80088e:	41 ff d0             	call   *%r8
+  800891:	e9 53 fe ff ff       	jmp    8006e9 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  800896:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80089a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80089e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008a2:	eb a4                	jmp    800848 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  8008a4:	48 ba 6c 32 80 00 00 	movabs $0x80326c,%rdx
+  8008ab:	00 00 00 
+  8008ae:	4c 89 ee             	mov    %r13,%rsi
+  8008b1:	4c 89 f7             	mov    %r14,%rdi
+  8008b4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008b9:	49 b8 7b 06 80 00 00 	movabs $0x80067b,%r8
+  8008c0:	00 00 00 
+  8008c3:	41 ff d0             	call   *%r8
+  8008c6:	e9 1e fe ff ff       	jmp    8006e9 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8008cb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008ce:	83 f8 2f             	cmp    $0x2f,%eax
+  8008d1:	77 6c                	ja     80093f <vprintfmt+0x287>
+  8008d3:	89 c2                	mov    %eax,%edx
+  8008d5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008d9:	83 c0 08             	add    $0x8,%eax
+  8008dc:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008df:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  8008e2:	48 85 d2             	test   %rdx,%rdx
+  8008e5:	48 b8 65 32 80 00 00 	movabs $0x803265,%rax
+  8008ec:	00 00 00 
+  8008ef:	48 0f 45 c2          	cmovne %rdx,%rax
+  8008f3:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  8008f7:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8008fb:	7e 06                	jle    800903 <vprintfmt+0x24b>
+  8008fd:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  800901:	75 4a                	jne    80094d <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800903:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800907:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  80090b:	0f b6 00             	movzbl (%rax),%eax
+  80090e:	84 c0                	test   %al,%al
+  800910:	0f 85 9a 00 00 00    	jne    8009b0 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  800916:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800919:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  80091d:	85 c0                	test   %eax,%eax
+  80091f:	0f 8e c4 fd ff ff    	jle    8006e9 <vprintfmt+0x31>
+  800925:	4c 89 ee             	mov    %r13,%rsi
+  800928:	bf 20 00 00 00       	mov    $0x20,%edi
+  80092d:	41 ff d6             	call   *%r14
+  800930:	41 83 ec 01          	sub    $0x1,%r12d
+  800934:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  800938:	75 eb                	jne    800925 <vprintfmt+0x26d>
+  80093a:	e9 aa fd ff ff       	jmp    8006e9 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  80093f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800943:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800947:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80094b:	eb 92                	jmp    8008df <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  80094d:	49 63 f7             	movslq %r15d,%rsi
+  800950:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  800954:	48 b8 6a 0e 80 00 00 	movabs $0x800e6a,%rax
+  80095b:	00 00 00 
+  80095e:	ff d0                	call   *%rax
+  800960:	48 89 c2             	mov    %rax,%rdx
+  800963:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800966:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  800968:	8d 70 ff             	lea    -0x1(%rax),%esi
+  80096b:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  80096e:	85 c0                	test   %eax,%eax
+  800970:	7e 91                	jle    800903 <vprintfmt+0x24b>
+  800972:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  800977:	4c 89 ee             	mov    %r13,%rsi
+  80097a:	44 89 e7             	mov    %r12d,%edi
+  80097d:	41 ff d6             	call   *%r14
+  800980:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800984:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800987:	83 f8 ff             	cmp    $0xffffffff,%eax
+  80098a:	75 eb                	jne    800977 <vprintfmt+0x2bf>
+  80098c:	e9 72 ff ff ff       	jmp    800903 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800991:	0f b6 f8             	movzbl %al,%edi
+  800994:	4c 89 ee             	mov    %r13,%rsi
+  800997:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  80099a:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  80099e:	49 83 c4 01          	add    $0x1,%r12
+  8009a2:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  8009a8:	84 c0                	test   %al,%al
+  8009aa:	0f 84 66 ff ff ff    	je     800916 <vprintfmt+0x25e>
+  8009b0:	45 85 ff             	test   %r15d,%r15d
+  8009b3:	78 0a                	js     8009bf <vprintfmt+0x307>
+  8009b5:	41 83 ef 01          	sub    $0x1,%r15d
+  8009b9:	0f 88 57 ff ff ff    	js     800916 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8009bf:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  8009c3:	74 cc                	je     800991 <vprintfmt+0x2d9>
+  8009c5:	8d 50 e0             	lea    -0x20(%rax),%edx
+  8009c8:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  8009cd:	80 fa 5e             	cmp    $0x5e,%dl
+  8009d0:	77 c2                	ja     800994 <vprintfmt+0x2dc>
+  8009d2:	eb bd                	jmp    800991 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  8009d4:	40 84 f6             	test   %sil,%sil
+  8009d7:	75 26                	jne    8009ff <vprintfmt+0x347>
+    switch (lflag) {
+  8009d9:	85 d2                	test   %edx,%edx
+  8009db:	74 59                	je     800a36 <vprintfmt+0x37e>
+  8009dd:	83 fa 01             	cmp    $0x1,%edx
+  8009e0:	74 7b                	je     800a5d <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  8009e2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009e5:	83 f8 2f             	cmp    $0x2f,%eax
+  8009e8:	0f 87 96 00 00 00    	ja     800a84 <vprintfmt+0x3cc>
+  8009ee:	89 c2                	mov    %eax,%edx
+  8009f0:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009f4:	83 c0 08             	add    $0x8,%eax
+  8009f7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009fa:	4c 8b 22             	mov    (%rdx),%r12
+  8009fd:	eb 17                	jmp    800a16 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  8009ff:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a02:	83 f8 2f             	cmp    $0x2f,%eax
+  800a05:	77 21                	ja     800a28 <vprintfmt+0x370>
+  800a07:	89 c2                	mov    %eax,%edx
+  800a09:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a0d:	83 c0 08             	add    $0x8,%eax
+  800a10:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a13:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  800a16:	4d 85 e4             	test   %r12,%r12
+  800a19:	78 7a                	js     800a95 <vprintfmt+0x3dd>
+            num = i;
+  800a1b:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  800a1e:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  800a23:	e9 50 02 00 00       	jmp    800c78 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800a28:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a2c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a30:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a34:	eb dd                	jmp    800a13 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  800a36:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a39:	83 f8 2f             	cmp    $0x2f,%eax
+  800a3c:	77 11                	ja     800a4f <vprintfmt+0x397>
+  800a3e:	89 c2                	mov    %eax,%edx
+  800a40:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a44:	83 c0 08             	add    $0x8,%eax
+  800a47:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a4a:	4c 63 22             	movslq (%rdx),%r12
+  800a4d:	eb c7                	jmp    800a16 <vprintfmt+0x35e>
+  800a4f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a53:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a57:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a5b:	eb ed                	jmp    800a4a <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  800a5d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a60:	83 f8 2f             	cmp    $0x2f,%eax
+  800a63:	77 11                	ja     800a76 <vprintfmt+0x3be>
+  800a65:	89 c2                	mov    %eax,%edx
+  800a67:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a6b:	83 c0 08             	add    $0x8,%eax
+  800a6e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a71:	4c 8b 22             	mov    (%rdx),%r12
+  800a74:	eb a0                	jmp    800a16 <vprintfmt+0x35e>
+  800a76:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a7a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a7e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a82:	eb ed                	jmp    800a71 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  800a84:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a88:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a8c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a90:	e9 65 ff ff ff       	jmp    8009fa <vprintfmt+0x342>
+                putch('-', put_arg);
+  800a95:	4c 89 ee             	mov    %r13,%rsi
+  800a98:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800a9d:	41 ff d6             	call   *%r14
+                i = -i;
+  800aa0:	49 f7 dc             	neg    %r12
+  800aa3:	e9 73 ff ff ff       	jmp    800a1b <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  800aa8:	40 84 f6             	test   %sil,%sil
+  800aab:	75 32                	jne    800adf <vprintfmt+0x427>
+    switch (lflag) {
+  800aad:	85 d2                	test   %edx,%edx
+  800aaf:	74 5d                	je     800b0e <vprintfmt+0x456>
+  800ab1:	83 fa 01             	cmp    $0x1,%edx
+  800ab4:	0f 84 82 00 00 00    	je     800b3c <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  800aba:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800abd:	83 f8 2f             	cmp    $0x2f,%eax
+  800ac0:	0f 87 a5 00 00 00    	ja     800b6b <vprintfmt+0x4b3>
+  800ac6:	89 c2                	mov    %eax,%edx
+  800ac8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800acc:	83 c0 08             	add    $0x8,%eax
+  800acf:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ad2:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800ad5:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  800ada:	e9 99 01 00 00       	jmp    800c78 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800adf:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ae2:	83 f8 2f             	cmp    $0x2f,%eax
+  800ae5:	77 19                	ja     800b00 <vprintfmt+0x448>
+  800ae7:	89 c2                	mov    %eax,%edx
+  800ae9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800aed:	83 c0 08             	add    $0x8,%eax
+  800af0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800af3:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800af6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800afb:	e9 78 01 00 00       	jmp    800c78 <vprintfmt+0x5c0>
+  800b00:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b04:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b08:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b0c:	eb e5                	jmp    800af3 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  800b0e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b11:	83 f8 2f             	cmp    $0x2f,%eax
+  800b14:	77 18                	ja     800b2e <vprintfmt+0x476>
+  800b16:	89 c2                	mov    %eax,%edx
+  800b18:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b1c:	83 c0 08             	add    $0x8,%eax
+  800b1f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b22:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800b24:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  800b29:	e9 4a 01 00 00       	jmp    800c78 <vprintfmt+0x5c0>
+  800b2e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b32:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b36:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b3a:	eb e6                	jmp    800b22 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  800b3c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b3f:	83 f8 2f             	cmp    $0x2f,%eax
+  800b42:	77 19                	ja     800b5d <vprintfmt+0x4a5>
+  800b44:	89 c2                	mov    %eax,%edx
+  800b46:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b4a:	83 c0 08             	add    $0x8,%eax
+  800b4d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b50:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800b53:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  800b58:	e9 1b 01 00 00       	jmp    800c78 <vprintfmt+0x5c0>
+  800b5d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b61:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b65:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b69:	eb e5                	jmp    800b50 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  800b6b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b6f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b73:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b77:	e9 56 ff ff ff       	jmp    800ad2 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  800b7c:	40 84 f6             	test   %sil,%sil
+  800b7f:	75 2e                	jne    800baf <vprintfmt+0x4f7>
+    switch (lflag) {
+  800b81:	85 d2                	test   %edx,%edx
+  800b83:	74 59                	je     800bde <vprintfmt+0x526>
+  800b85:	83 fa 01             	cmp    $0x1,%edx
+  800b88:	74 7f                	je     800c09 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  800b8a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b8d:	83 f8 2f             	cmp    $0x2f,%eax
+  800b90:	0f 87 9f 00 00 00    	ja     800c35 <vprintfmt+0x57d>
+  800b96:	89 c2                	mov    %eax,%edx
+  800b98:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b9c:	83 c0 08             	add    $0x8,%eax
+  800b9f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ba2:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800ba5:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  800baa:	e9 c9 00 00 00       	jmp    800c78 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800baf:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bb2:	83 f8 2f             	cmp    $0x2f,%eax
+  800bb5:	77 19                	ja     800bd0 <vprintfmt+0x518>
+  800bb7:	89 c2                	mov    %eax,%edx
+  800bb9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800bbd:	83 c0 08             	add    $0x8,%eax
+  800bc0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800bc3:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800bc6:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800bcb:	e9 a8 00 00 00       	jmp    800c78 <vprintfmt+0x5c0>
+  800bd0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bd4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bd8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bdc:	eb e5                	jmp    800bc3 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  800bde:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800be1:	83 f8 2f             	cmp    $0x2f,%eax
+  800be4:	77 15                	ja     800bfb <vprintfmt+0x543>
+  800be6:	89 c2                	mov    %eax,%edx
+  800be8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800bec:	83 c0 08             	add    $0x8,%eax
+  800bef:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800bf2:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  800bf4:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  800bf9:	eb 7d                	jmp    800c78 <vprintfmt+0x5c0>
+  800bfb:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bff:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c03:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c07:	eb e9                	jmp    800bf2 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  800c09:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c0c:	83 f8 2f             	cmp    $0x2f,%eax
+  800c0f:	77 16                	ja     800c27 <vprintfmt+0x56f>
+  800c11:	89 c2                	mov    %eax,%edx
+  800c13:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c17:	83 c0 08             	add    $0x8,%eax
+  800c1a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c1d:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800c20:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  800c25:	eb 51                	jmp    800c78 <vprintfmt+0x5c0>
+  800c27:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c2b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c2f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c33:	eb e8                	jmp    800c1d <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  800c35:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c39:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c3d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c41:	e9 5c ff ff ff       	jmp    800ba2 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  800c46:	4c 89 ee             	mov    %r13,%rsi
+  800c49:	bf 30 00 00 00       	mov    $0x30,%edi
+  800c4e:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800c51:	4c 89 ee             	mov    %r13,%rsi
+  800c54:	bf 78 00 00 00       	mov    $0x78,%edi
+  800c59:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800c5c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c5f:	83 f8 2f             	cmp    $0x2f,%eax
+  800c62:	77 47                	ja     800cab <vprintfmt+0x5f3>
+  800c64:	89 c2                	mov    %eax,%edx
+  800c66:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c6a:	83 c0 08             	add    $0x8,%eax
+  800c6d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c70:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800c73:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800c78:	48 83 ec 08          	sub    $0x8,%rsp
+  800c7c:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800c80:	0f 94 c0             	sete   %al
+  800c83:	0f b6 c0             	movzbl %al,%eax
+  800c86:	50                   	push   %rax
+  800c87:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800c8c:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800c90:	4c 89 ee             	mov    %r13,%rsi
+  800c93:	4c 89 f7             	mov    %r14,%rdi
+  800c96:	48 b8 ad 05 80 00 00 	movabs $0x8005ad,%rax
+  800c9d:	00 00 00 
+  800ca0:	ff d0                	call   *%rax
+            break;
+  800ca2:	48 83 c4 10          	add    $0x10,%rsp
+  800ca6:	e9 3e fa ff ff       	jmp    8006e9 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800cab:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800caf:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800cb3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800cb7:	eb b7                	jmp    800c70 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  800cb9:	40 84 f6             	test   %sil,%sil
+  800cbc:	75 2b                	jne    800ce9 <vprintfmt+0x631>
+    switch (lflag) {
+  800cbe:	85 d2                	test   %edx,%edx
+  800cc0:	74 56                	je     800d18 <vprintfmt+0x660>
+  800cc2:	83 fa 01             	cmp    $0x1,%edx
+  800cc5:	74 7f                	je     800d46 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800cc7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800cca:	83 f8 2f             	cmp    $0x2f,%eax
+  800ccd:	0f 87 a2 00 00 00    	ja     800d75 <vprintfmt+0x6bd>
+  800cd3:	89 c2                	mov    %eax,%edx
+  800cd5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800cd9:	83 c0 08             	add    $0x8,%eax
+  800cdc:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800cdf:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800ce2:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800ce7:	eb 8f                	jmp    800c78 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800ce9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800cec:	83 f8 2f             	cmp    $0x2f,%eax
+  800cef:	77 19                	ja     800d0a <vprintfmt+0x652>
+  800cf1:	89 c2                	mov    %eax,%edx
+  800cf3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800cf7:	83 c0 08             	add    $0x8,%eax
+  800cfa:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800cfd:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800d00:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800d05:	e9 6e ff ff ff       	jmp    800c78 <vprintfmt+0x5c0>
+  800d0a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d0e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d12:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d16:	eb e5                	jmp    800cfd <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800d18:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d1b:	83 f8 2f             	cmp    $0x2f,%eax
+  800d1e:	77 18                	ja     800d38 <vprintfmt+0x680>
+  800d20:	89 c2                	mov    %eax,%edx
+  800d22:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d26:	83 c0 08             	add    $0x8,%eax
+  800d29:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d2c:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800d2e:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800d33:	e9 40 ff ff ff       	jmp    800c78 <vprintfmt+0x5c0>
+  800d38:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d3c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d40:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d44:	eb e6                	jmp    800d2c <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800d46:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d49:	83 f8 2f             	cmp    $0x2f,%eax
+  800d4c:	77 19                	ja     800d67 <vprintfmt+0x6af>
+  800d4e:	89 c2                	mov    %eax,%edx
+  800d50:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d54:	83 c0 08             	add    $0x8,%eax
+  800d57:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d5a:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800d5d:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800d62:	e9 11 ff ff ff       	jmp    800c78 <vprintfmt+0x5c0>
+  800d67:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d6b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d6f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d73:	eb e5                	jmp    800d5a <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800d75:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d79:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d7d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d81:	e9 59 ff ff ff       	jmp    800cdf <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800d86:	4c 89 ee             	mov    %r13,%rsi
+  800d89:	bf 25 00 00 00       	mov    $0x25,%edi
+  800d8e:	41 ff d6             	call   *%r14
+            break;
+  800d91:	e9 53 f9 ff ff       	jmp    8006e9 <vprintfmt+0x31>
+            putch('%', put_arg);
+  800d96:	4c 89 ee             	mov    %r13,%rsi
+  800d99:	bf 25 00 00 00       	mov    $0x25,%edi
+  800d9e:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800da1:	48 83 eb 01          	sub    $0x1,%rbx
+  800da5:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800da9:	75 f6                	jne    800da1 <vprintfmt+0x6e9>
+  800dab:	e9 39 f9 ff ff       	jmp    8006e9 <vprintfmt+0x31>
+}
+  800db0:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800db4:	5b                   	pop    %rbx
+  800db5:	41 5c                	pop    %r12
+  800db7:	41 5d                	pop    %r13
+  800db9:	41 5e                	pop    %r14
+  800dbb:	41 5f                	pop    %r15
+  800dbd:	5d                   	pop    %rbp
+  800dbe:	c3                   	ret
+
+0000000000800dbf <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800dbf:	55                   	push   %rbp
+  800dc0:	48 89 e5             	mov    %rsp,%rbp
+  800dc3:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800dc7:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800dcb:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800dd0:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800dd4:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800ddb:	48 85 ff             	test   %rdi,%rdi
+  800dde:	74 2b                	je     800e0b <vsnprintf+0x4c>
+  800de0:	48 85 f6             	test   %rsi,%rsi
+  800de3:	74 26                	je     800e0b <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800de5:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800de9:	48 bf 63 06 80 00 00 	movabs $0x800663,%rdi
+  800df0:	00 00 00 
+  800df3:	48 b8 b8 06 80 00 00 	movabs $0x8006b8,%rax
+  800dfa:	00 00 00 
+  800dfd:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800dff:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800e03:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800e06:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800e09:	c9                   	leave
+  800e0a:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800e0b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800e10:	eb f7                	jmp    800e09 <vsnprintf+0x4a>
+
+0000000000800e12 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800e12:	55                   	push   %rbp
+  800e13:	48 89 e5             	mov    %rsp,%rbp
+  800e16:	48 83 ec 50          	sub    $0x50,%rsp
+  800e1a:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800e1e:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800e22:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800e26:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800e2d:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800e31:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e35:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800e39:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800e3d:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800e41:	48 b8 bf 0d 80 00 00 	movabs $0x800dbf,%rax
+  800e48:	00 00 00 
+  800e4b:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800e4d:	c9                   	leave
+  800e4e:	c3                   	ret
+
+0000000000800e4f <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800e4f:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800e52:	74 10                	je     800e64 <strlen+0x15>
+    size_t n = 0;
+  800e54:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800e59:	48 83 c0 01          	add    $0x1,%rax
+  800e5d:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800e61:	75 f6                	jne    800e59 <strlen+0xa>
+  800e63:	c3                   	ret
+    size_t n = 0;
+  800e64:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800e69:	c3                   	ret
+
+0000000000800e6a <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800e6a:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800e6d:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800e72:	48 85 f6             	test   %rsi,%rsi
+  800e75:	74 11                	je     800e88 <strnlen+0x1e>
+  800e77:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800e7b:	74 0c                	je     800e89 <strnlen+0x1f>
+  800e7d:	48 83 c2 01          	add    $0x1,%rdx
+  800e81:	48 39 d0             	cmp    %rdx,%rax
+  800e84:	75 f1                	jne    800e77 <strnlen+0xd>
+  800e86:	eb 04                	jmp    800e8c <strnlen+0x22>
+  800e88:	c3                   	ret
+  800e89:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800e8c:	c3                   	ret
+
+0000000000800e8d <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800e8d:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800e90:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e95:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800e99:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800e9c:	48 83 c2 01          	add    $0x1,%rdx
+  800ea0:	84 c9                	test   %cl,%cl
+  800ea2:	75 f1                	jne    800e95 <strcpy+0x8>
+        ;
+    return res;
+}
+  800ea4:	c3                   	ret
+
+0000000000800ea5 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800ea5:	55                   	push   %rbp
+  800ea6:	48 89 e5             	mov    %rsp,%rbp
+  800ea9:	41 54                	push   %r12
+  800eab:	53                   	push   %rbx
+  800eac:	48 89 fb             	mov    %rdi,%rbx
+  800eaf:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800eb2:	48 b8 4f 0e 80 00 00 	movabs $0x800e4f,%rax
+  800eb9:	00 00 00 
+  800ebc:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800ebe:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800ec2:	4c 89 e6             	mov    %r12,%rsi
+  800ec5:	48 b8 8d 0e 80 00 00 	movabs $0x800e8d,%rax
+  800ecc:	00 00 00 
+  800ecf:	ff d0                	call   *%rax
+    return dst;
+}
+  800ed1:	48 89 d8             	mov    %rbx,%rax
+  800ed4:	5b                   	pop    %rbx
+  800ed5:	41 5c                	pop    %r12
+  800ed7:	5d                   	pop    %rbp
+  800ed8:	c3                   	ret
+
+0000000000800ed9 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800ed9:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800edc:	48 85 d2             	test   %rdx,%rdx
+  800edf:	74 1f                	je     800f00 <strncpy+0x27>
+  800ee1:	48 01 fa             	add    %rdi,%rdx
+  800ee4:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800ee7:	48 83 c1 01          	add    $0x1,%rcx
+  800eeb:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800eef:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800ef3:	41 80 f8 01          	cmp    $0x1,%r8b
+  800ef7:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800efb:	48 39 ca             	cmp    %rcx,%rdx
+  800efe:	75 e7                	jne    800ee7 <strncpy+0xe>
+    }
+    return ret;
+}
+  800f00:	c3                   	ret
+
+0000000000800f01 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800f01:	48 89 f8             	mov    %rdi,%rax
+  800f04:	48 85 d2             	test   %rdx,%rdx
+  800f07:	74 24                	je     800f2d <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800f09:	48 83 ea 01          	sub    $0x1,%rdx
+  800f0d:	74 1b                	je     800f2a <strlcpy+0x29>
+  800f0f:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800f13:	0f b6 16             	movzbl (%rsi),%edx
+  800f16:	84 d2                	test   %dl,%dl
+  800f18:	74 10                	je     800f2a <strlcpy+0x29>
+            *dst++ = *src++;
+  800f1a:	48 83 c6 01          	add    $0x1,%rsi
+  800f1e:	48 83 c0 01          	add    $0x1,%rax
+  800f22:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800f25:	48 39 c8             	cmp    %rcx,%rax
+  800f28:	75 e9                	jne    800f13 <strlcpy+0x12>
+        *dst = '\0';
+  800f2a:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800f2d:	48 29 f8             	sub    %rdi,%rax
+}
+  800f30:	c3                   	ret
+
+0000000000800f31 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800f31:	0f b6 07             	movzbl (%rdi),%eax
+  800f34:	84 c0                	test   %al,%al
+  800f36:	74 13                	je     800f4b <strcmp+0x1a>
+  800f38:	38 06                	cmp    %al,(%rsi)
+  800f3a:	75 0f                	jne    800f4b <strcmp+0x1a>
+  800f3c:	48 83 c7 01          	add    $0x1,%rdi
+  800f40:	48 83 c6 01          	add    $0x1,%rsi
+  800f44:	0f b6 07             	movzbl (%rdi),%eax
+  800f47:	84 c0                	test   %al,%al
+  800f49:	75 ed                	jne    800f38 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800f4b:	0f b6 c0             	movzbl %al,%eax
+  800f4e:	0f b6 16             	movzbl (%rsi),%edx
+  800f51:	29 d0                	sub    %edx,%eax
+}
+  800f53:	c3                   	ret
+
+0000000000800f54 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800f54:	48 85 d2             	test   %rdx,%rdx
+  800f57:	74 1f                	je     800f78 <strncmp+0x24>
+  800f59:	0f b6 07             	movzbl (%rdi),%eax
+  800f5c:	84 c0                	test   %al,%al
+  800f5e:	74 1e                	je     800f7e <strncmp+0x2a>
+  800f60:	3a 06                	cmp    (%rsi),%al
+  800f62:	75 1a                	jne    800f7e <strncmp+0x2a>
+  800f64:	48 83 c7 01          	add    $0x1,%rdi
+  800f68:	48 83 c6 01          	add    $0x1,%rsi
+  800f6c:	48 83 ea 01          	sub    $0x1,%rdx
+  800f70:	75 e7                	jne    800f59 <strncmp+0x5>
+
+    if (!n) return 0;
+  800f72:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f77:	c3                   	ret
+  800f78:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f7d:	c3                   	ret
+  800f7e:	48 85 d2             	test   %rdx,%rdx
+  800f81:	74 09                	je     800f8c <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800f83:	0f b6 07             	movzbl (%rdi),%eax
+  800f86:	0f b6 16             	movzbl (%rsi),%edx
+  800f89:	29 d0                	sub    %edx,%eax
+  800f8b:	c3                   	ret
+    if (!n) return 0;
+  800f8c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800f91:	c3                   	ret
+
+0000000000800f92 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800f92:	0f b6 17             	movzbl (%rdi),%edx
+  800f95:	84 d2                	test   %dl,%dl
+  800f97:	74 18                	je     800fb1 <strchr+0x1f>
+        if (*str == c) {
+  800f99:	0f be d2             	movsbl %dl,%edx
+  800f9c:	39 f2                	cmp    %esi,%edx
+  800f9e:	74 17                	je     800fb7 <strchr+0x25>
+    for (; *str; str++) {
+  800fa0:	48 83 c7 01          	add    $0x1,%rdi
+  800fa4:	0f b6 17             	movzbl (%rdi),%edx
+  800fa7:	84 d2                	test   %dl,%dl
+  800fa9:	75 ee                	jne    800f99 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800fab:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fb0:	c3                   	ret
+  800fb1:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fb6:	c3                   	ret
+  800fb7:	48 89 f8             	mov    %rdi,%rax
+}
+  800fba:	c3                   	ret
+
+0000000000800fbb <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800fbb:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800fbe:	0f b6 17             	movzbl (%rdi),%edx
+  800fc1:	84 d2                	test   %dl,%dl
+  800fc3:	74 13                	je     800fd8 <strfind+0x1d>
+  800fc5:	0f be d2             	movsbl %dl,%edx
+  800fc8:	39 f2                	cmp    %esi,%edx
+  800fca:	74 0b                	je     800fd7 <strfind+0x1c>
+  800fcc:	48 83 c0 01          	add    $0x1,%rax
+  800fd0:	0f b6 10             	movzbl (%rax),%edx
+  800fd3:	84 d2                	test   %dl,%dl
+  800fd5:	75 ee                	jne    800fc5 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800fd7:	c3                   	ret
+  800fd8:	c3                   	ret
+
+0000000000800fd9 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800fd9:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800fdc:	48 89 f8             	mov    %rdi,%rax
+  800fdf:	48 f7 d8             	neg    %rax
+  800fe2:	83 e0 07             	and    $0x7,%eax
+  800fe5:	49 89 d1             	mov    %rdx,%r9
+  800fe8:	49 29 c1             	sub    %rax,%r9
+  800feb:	78 36                	js     801023 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800fed:	40 0f b6 c6          	movzbl %sil,%eax
+  800ff1:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800ff8:	01 01 01 
+  800ffb:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800fff:	40 f6 c7 07          	test   $0x7,%dil
+  801003:	75 38                	jne    80103d <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  801005:	4c 89 c9             	mov    %r9,%rcx
+  801008:	48 c1 f9 03          	sar    $0x3,%rcx
+  80100c:	74 0c                	je     80101a <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  80100e:	fc                   	cld
+  80100f:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  801012:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  801016:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  80101a:	4d 85 c9             	test   %r9,%r9
+  80101d:	75 45                	jne    801064 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  80101f:	4c 89 c0             	mov    %r8,%rax
+  801022:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  801023:	48 85 d2             	test   %rdx,%rdx
+  801026:	74 f7                	je     80101f <memset+0x46>
+  801028:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  80102b:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  80102e:	48 83 c0 01          	add    $0x1,%rax
+  801032:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  801036:	48 39 c2             	cmp    %rax,%rdx
+  801039:	75 f3                	jne    80102e <memset+0x55>
+  80103b:	eb e2                	jmp    80101f <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  80103d:	40 f6 c7 01          	test   $0x1,%dil
+  801041:	74 06                	je     801049 <memset+0x70>
+  801043:	88 07                	mov    %al,(%rdi)
+  801045:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  801049:	40 f6 c7 02          	test   $0x2,%dil
+  80104d:	74 07                	je     801056 <memset+0x7d>
+  80104f:	66 89 07             	mov    %ax,(%rdi)
+  801052:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  801056:	40 f6 c7 04          	test   $0x4,%dil
+  80105a:	74 a9                	je     801005 <memset+0x2c>
+  80105c:	89 07                	mov    %eax,(%rdi)
+  80105e:	48 83 c7 04          	add    $0x4,%rdi
+  801062:	eb a1                	jmp    801005 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  801064:	41 f6 c1 04          	test   $0x4,%r9b
+  801068:	74 06                	je     801070 <memset+0x97>
+  80106a:	89 07                	mov    %eax,(%rdi)
+  80106c:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  801070:	41 f6 c1 02          	test   $0x2,%r9b
+  801074:	74 07                	je     80107d <memset+0xa4>
+  801076:	66 89 07             	mov    %ax,(%rdi)
+  801079:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  80107d:	41 f6 c1 01          	test   $0x1,%r9b
+  801081:	74 9c                	je     80101f <memset+0x46>
+  801083:	88 07                	mov    %al,(%rdi)
+  801085:	eb 98                	jmp    80101f <memset+0x46>
+
+0000000000801087 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  801087:	48 89 f8             	mov    %rdi,%rax
+  80108a:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  80108d:	48 39 fe             	cmp    %rdi,%rsi
+  801090:	73 3b                	jae    8010cd <memmove+0x46>
+  801092:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  801096:	48 39 d7             	cmp    %rdx,%rdi
+  801099:	73 32                	jae    8010cd <memmove+0x46>
+        s += n;
+        d += n;
+  80109b:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  80109f:	48 89 d6             	mov    %rdx,%rsi
+  8010a2:	48 09 fe             	or     %rdi,%rsi
+  8010a5:	48 09 ce             	or     %rcx,%rsi
+  8010a8:	40 f6 c6 07          	test   $0x7,%sil
+  8010ac:	75 12                	jne    8010c0 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  8010ae:	48 83 ef 08          	sub    $0x8,%rdi
+  8010b2:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  8010b6:	48 c1 e9 03          	shr    $0x3,%rcx
+  8010ba:	fd                   	std
+  8010bb:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  8010be:	fc                   	cld
+  8010bf:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  8010c0:	48 83 ef 01          	sub    $0x1,%rdi
+  8010c4:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  8010c8:	fd                   	std
+  8010c9:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  8010cb:	eb f1                	jmp    8010be <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  8010cd:	48 89 f2             	mov    %rsi,%rdx
+  8010d0:	48 09 c2             	or     %rax,%rdx
+  8010d3:	48 09 ca             	or     %rcx,%rdx
+  8010d6:	f6 c2 07             	test   $0x7,%dl
+  8010d9:	75 0c                	jne    8010e7 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  8010db:	48 c1 e9 03          	shr    $0x3,%rcx
+  8010df:	48 89 c7             	mov    %rax,%rdi
+  8010e2:	fc                   	cld
+  8010e3:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  8010e6:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  8010e7:	48 89 c7             	mov    %rax,%rdi
+  8010ea:	fc                   	cld
+  8010eb:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  8010ed:	c3                   	ret
+
+00000000008010ee <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  8010ee:	55                   	push   %rbp
+  8010ef:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  8010f2:	48 b8 87 10 80 00 00 	movabs $0x801087,%rax
+  8010f9:	00 00 00 
+  8010fc:	ff d0                	call   *%rax
+}
+  8010fe:	5d                   	pop    %rbp
+  8010ff:	c3                   	ret
+
+0000000000801100 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  801100:	55                   	push   %rbp
+  801101:	48 89 e5             	mov    %rsp,%rbp
+  801104:	41 57                	push   %r15
+  801106:	41 56                	push   %r14
+  801108:	41 55                	push   %r13
+  80110a:	41 54                	push   %r12
+  80110c:	53                   	push   %rbx
+  80110d:	48 83 ec 08          	sub    $0x8,%rsp
+  801111:	49 89 fe             	mov    %rdi,%r14
+  801114:	49 89 f7             	mov    %rsi,%r15
+  801117:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  80111a:	48 89 f7             	mov    %rsi,%rdi
+  80111d:	48 b8 4f 0e 80 00 00 	movabs $0x800e4f,%rax
+  801124:	00 00 00 
+  801127:	ff d0                	call   *%rax
+  801129:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  80112c:	48 89 de             	mov    %rbx,%rsi
+  80112f:	4c 89 f7             	mov    %r14,%rdi
+  801132:	48 b8 6a 0e 80 00 00 	movabs $0x800e6a,%rax
+  801139:	00 00 00 
+  80113c:	ff d0                	call   *%rax
+  80113e:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  801141:	48 39 c3             	cmp    %rax,%rbx
+  801144:	74 36                	je     80117c <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  801146:	48 89 d8             	mov    %rbx,%rax
+  801149:	4c 29 e8             	sub    %r13,%rax
+  80114c:	49 39 c4             	cmp    %rax,%r12
+  80114f:	73 31                	jae    801182 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  801151:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  801156:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  80115a:	4c 89 fe             	mov    %r15,%rsi
+  80115d:	48 b8 ee 10 80 00 00 	movabs $0x8010ee,%rax
+  801164:	00 00 00 
+  801167:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  801169:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  80116d:	48 83 c4 08          	add    $0x8,%rsp
+  801171:	5b                   	pop    %rbx
+  801172:	41 5c                	pop    %r12
+  801174:	41 5d                	pop    %r13
+  801176:	41 5e                	pop    %r14
+  801178:	41 5f                	pop    %r15
+  80117a:	5d                   	pop    %rbp
+  80117b:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  80117c:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  801180:	eb eb                	jmp    80116d <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  801182:	48 83 eb 01          	sub    $0x1,%rbx
+  801186:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  80118a:	48 89 da             	mov    %rbx,%rdx
+  80118d:	4c 89 fe             	mov    %r15,%rsi
+  801190:	48 b8 ee 10 80 00 00 	movabs $0x8010ee,%rax
+  801197:	00 00 00 
+  80119a:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  80119c:	49 01 de             	add    %rbx,%r14
+  80119f:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  8011a4:	eb c3                	jmp    801169 <strlcat+0x69>
+
+00000000008011a6 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  8011a6:	48 85 d2             	test   %rdx,%rdx
+  8011a9:	74 2d                	je     8011d8 <memcmp+0x32>
+  8011ab:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  8011b0:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  8011b4:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  8011b9:	44 38 c1             	cmp    %r8b,%cl
+  8011bc:	75 0f                	jne    8011cd <memcmp+0x27>
+    while (n-- > 0) {
+  8011be:	48 83 c0 01          	add    $0x1,%rax
+  8011c2:	48 39 c2             	cmp    %rax,%rdx
+  8011c5:	75 e9                	jne    8011b0 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  8011c7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011cc:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  8011cd:	0f b6 c1             	movzbl %cl,%eax
+  8011d0:	45 0f b6 c0          	movzbl %r8b,%r8d
+  8011d4:	44 29 c0             	sub    %r8d,%eax
+  8011d7:	c3                   	ret
+    return 0;
+  8011d8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8011dd:	c3                   	ret
+
+00000000008011de <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  8011de:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  8011e2:	48 39 c7             	cmp    %rax,%rdi
+  8011e5:	73 0f                	jae    8011f6 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  8011e7:	40 38 37             	cmp    %sil,(%rdi)
+  8011ea:	74 0e                	je     8011fa <memfind+0x1c>
+    for (; src < end; src++) {
+  8011ec:	48 83 c7 01          	add    $0x1,%rdi
+  8011f0:	48 39 f8             	cmp    %rdi,%rax
+  8011f3:	75 f2                	jne    8011e7 <memfind+0x9>
+  8011f5:	c3                   	ret
+  8011f6:	48 89 f8             	mov    %rdi,%rax
+  8011f9:	c3                   	ret
+  8011fa:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  8011fd:	c3                   	ret
+
+00000000008011fe <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  8011fe:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  801201:	0f b6 37             	movzbl (%rdi),%esi
+  801204:	40 80 fe 20          	cmp    $0x20,%sil
+  801208:	74 06                	je     801210 <strtol+0x12>
+  80120a:	40 80 fe 09          	cmp    $0x9,%sil
+  80120e:	75 13                	jne    801223 <strtol+0x25>
+  801210:	48 83 c7 01          	add    $0x1,%rdi
+  801214:	0f b6 37             	movzbl (%rdi),%esi
+  801217:	40 80 fe 20          	cmp    $0x20,%sil
+  80121b:	74 f3                	je     801210 <strtol+0x12>
+  80121d:	40 80 fe 09          	cmp    $0x9,%sil
+  801221:	74 ed                	je     801210 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  801223:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  801226:	83 e0 fd             	and    $0xfffffffd,%eax
+  801229:	3c 01                	cmp    $0x1,%al
+  80122b:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  80122f:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  801235:	75 0f                	jne    801246 <strtol+0x48>
+  801237:	80 3f 30             	cmpb   $0x30,(%rdi)
+  80123a:	74 14                	je     801250 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  80123c:	85 d2                	test   %edx,%edx
+  80123e:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801243:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  801246:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  80124b:	4c 63 ca             	movslq %edx,%r9
+  80124e:	eb 36                	jmp    801286 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801250:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  801254:	74 0f                	je     801265 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  801256:	85 d2                	test   %edx,%edx
+  801258:	75 ec                	jne    801246 <strtol+0x48>
+        s++;
+  80125a:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  80125e:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  801263:	eb e1                	jmp    801246 <strtol+0x48>
+        s += 2;
+  801265:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  801269:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  80126e:	eb d6                	jmp    801246 <strtol+0x48>
+            dig -= '0';
+  801270:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  801273:	44 0f b6 c1          	movzbl %cl,%r8d
+  801277:	41 39 d0             	cmp    %edx,%r8d
+  80127a:	7d 21                	jge    80129d <strtol+0x9f>
+        val = val * base + dig;
+  80127c:	49 0f af c1          	imul   %r9,%rax
+  801280:	0f b6 c9             	movzbl %cl,%ecx
+  801283:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  801286:	48 83 c7 01          	add    $0x1,%rdi
+  80128a:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  80128e:	80 f9 39             	cmp    $0x39,%cl
+  801291:	76 dd                	jbe    801270 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  801293:	80 f9 7b             	cmp    $0x7b,%cl
+  801296:	77 05                	ja     80129d <strtol+0x9f>
+            dig -= 'a' - 10;
+  801298:	83 e9 57             	sub    $0x57,%ecx
+  80129b:	eb d6                	jmp    801273 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  80129d:	4d 85 d2             	test   %r10,%r10
+  8012a0:	74 03                	je     8012a5 <strtol+0xa7>
+  8012a2:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  8012a5:	48 89 c2             	mov    %rax,%rdx
+  8012a8:	48 f7 da             	neg    %rdx
+  8012ab:	40 80 fe 2d          	cmp    $0x2d,%sil
+  8012af:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  8012b3:	c3                   	ret
+
+00000000008012b4 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  8012b4:	55                   	push   %rbp
+  8012b5:	48 89 e5             	mov    %rsp,%rbp
+  8012b8:	53                   	push   %rbx
+  8012b9:	48 89 fa             	mov    %rdi,%rdx
+  8012bc:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8012bf:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8012c4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012c9:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012ce:	be 00 00 00 00       	mov    $0x0,%esi
+  8012d3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8012d9:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  8012db:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012df:	c9                   	leave
+  8012e0:	c3                   	ret
+
+00000000008012e1 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  8012e1:	55                   	push   %rbp
+  8012e2:	48 89 e5             	mov    %rsp,%rbp
+  8012e5:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8012e6:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8012eb:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012f0:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8012f5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012fa:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012ff:	be 00 00 00 00       	mov    $0x0,%esi
+  801304:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80130a:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  80130c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801310:	c9                   	leave
+  801311:	c3                   	ret
+
+0000000000801312 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  801312:	55                   	push   %rbp
+  801313:	48 89 e5             	mov    %rsp,%rbp
+  801316:	53                   	push   %rbx
+  801317:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  80131b:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80131e:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801323:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801328:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80132d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801332:	be 00 00 00 00       	mov    $0x0,%esi
+  801337:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80133d:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80133f:	48 85 c0             	test   %rax,%rax
+  801342:	7f 06                	jg     80134a <sys_env_destroy+0x38>
+}
+  801344:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801348:	c9                   	leave
+  801349:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80134a:	49 89 c0             	mov    %rax,%r8
+  80134d:	b9 03 00 00 00       	mov    $0x3,%ecx
+  801352:	48 ba 90 37 80 00 00 	movabs $0x803790,%rdx
+  801359:	00 00 00 
+  80135c:	be 26 00 00 00       	mov    $0x26,%esi
+  801361:	48 bf af 37 80 00 00 	movabs $0x8037af,%rdi
+  801368:	00 00 00 
+  80136b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801370:	49 b9 18 04 80 00 00 	movabs $0x800418,%r9
+  801377:	00 00 00 
+  80137a:	41 ff d1             	call   *%r9
+
+000000000080137d <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  80137d:	55                   	push   %rbp
+  80137e:	48 89 e5             	mov    %rsp,%rbp
+  801381:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801382:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801387:	ba 00 00 00 00       	mov    $0x0,%edx
+  80138c:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801391:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801396:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80139b:	be 00 00 00 00       	mov    $0x0,%esi
+  8013a0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013a6:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  8013a8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013ac:	c9                   	leave
+  8013ad:	c3                   	ret
+
+00000000008013ae <sys_yield>:
+
+void
+sys_yield(void) {
+  8013ae:	55                   	push   %rbp
+  8013af:	48 89 e5             	mov    %rsp,%rbp
+  8013b2:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8013b3:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8013b8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8013bd:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8013c2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013c7:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013cc:	be 00 00 00 00       	mov    $0x0,%esi
+  8013d1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013d7:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  8013d9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013dd:	c9                   	leave
+  8013de:	c3                   	ret
+
+00000000008013df <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  8013df:	55                   	push   %rbp
+  8013e0:	48 89 e5             	mov    %rsp,%rbp
+  8013e3:	53                   	push   %rbx
+  8013e4:	48 89 fa             	mov    %rdi,%rdx
+  8013e7:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8013ea:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8013ef:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  8013f6:	00 00 00 
+  8013f9:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013fe:	be 00 00 00 00       	mov    $0x0,%esi
+  801403:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801409:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  80140b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80140f:	c9                   	leave
+  801410:	c3                   	ret
+
+0000000000801411 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  801411:	55                   	push   %rbp
+  801412:	48 89 e5             	mov    %rsp,%rbp
+  801415:	53                   	push   %rbx
+  801416:	49 89 f8             	mov    %rdi,%r8
+  801419:	48 89 d3             	mov    %rdx,%rbx
+  80141c:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80141f:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801424:	4c 89 c2             	mov    %r8,%rdx
+  801427:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80142a:	be 00 00 00 00       	mov    $0x0,%esi
+  80142f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801435:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  801437:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80143b:	c9                   	leave
+  80143c:	c3                   	ret
+
+000000000080143d <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  80143d:	55                   	push   %rbp
+  80143e:	48 89 e5             	mov    %rsp,%rbp
+  801441:	53                   	push   %rbx
+  801442:	48 83 ec 08          	sub    $0x8,%rsp
+  801446:	89 f8                	mov    %edi,%eax
+  801448:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  80144b:	48 63 f9             	movslq %ecx,%rdi
+  80144e:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801451:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801456:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801459:	be 00 00 00 00       	mov    $0x0,%esi
+  80145e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801464:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801466:	48 85 c0             	test   %rax,%rax
+  801469:	7f 06                	jg     801471 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  80146b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80146f:	c9                   	leave
+  801470:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801471:	49 89 c0             	mov    %rax,%r8
+  801474:	b9 04 00 00 00       	mov    $0x4,%ecx
+  801479:	48 ba 90 37 80 00 00 	movabs $0x803790,%rdx
+  801480:	00 00 00 
+  801483:	be 26 00 00 00       	mov    $0x26,%esi
+  801488:	48 bf af 37 80 00 00 	movabs $0x8037af,%rdi
+  80148f:	00 00 00 
+  801492:	b8 00 00 00 00       	mov    $0x0,%eax
+  801497:	49 b9 18 04 80 00 00 	movabs $0x800418,%r9
+  80149e:	00 00 00 
+  8014a1:	41 ff d1             	call   *%r9
+
+00000000008014a4 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8014a4:	55                   	push   %rbp
+  8014a5:	48 89 e5             	mov    %rsp,%rbp
+  8014a8:	53                   	push   %rbx
+  8014a9:	48 83 ec 08          	sub    $0x8,%rsp
+  8014ad:	89 f8                	mov    %edi,%eax
+  8014af:	49 89 f2             	mov    %rsi,%r10
+  8014b2:	48 89 cf             	mov    %rcx,%rdi
+  8014b5:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  8014b8:	48 63 da             	movslq %edx,%rbx
+  8014bb:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8014be:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8014c3:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014c6:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  8014c9:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8014cb:	48 85 c0             	test   %rax,%rax
+  8014ce:	7f 06                	jg     8014d6 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8014d0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014d4:	c9                   	leave
+  8014d5:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8014d6:	49 89 c0             	mov    %rax,%r8
+  8014d9:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8014de:	48 ba 90 37 80 00 00 	movabs $0x803790,%rdx
+  8014e5:	00 00 00 
+  8014e8:	be 26 00 00 00       	mov    $0x26,%esi
+  8014ed:	48 bf af 37 80 00 00 	movabs $0x8037af,%rdi
+  8014f4:	00 00 00 
+  8014f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014fc:	49 b9 18 04 80 00 00 	movabs $0x800418,%r9
+  801503:	00 00 00 
+  801506:	41 ff d1             	call   *%r9
+
+0000000000801509 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  801509:	55                   	push   %rbp
+  80150a:	48 89 e5             	mov    %rsp,%rbp
+  80150d:	53                   	push   %rbx
+  80150e:	48 83 ec 08          	sub    $0x8,%rsp
+  801512:	48 89 f1             	mov    %rsi,%rcx
+  801515:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  801518:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80151b:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801520:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801525:	be 00 00 00 00       	mov    $0x0,%esi
+  80152a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801530:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801532:	48 85 c0             	test   %rax,%rax
+  801535:	7f 06                	jg     80153d <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  801537:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80153b:	c9                   	leave
+  80153c:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80153d:	49 89 c0             	mov    %rax,%r8
+  801540:	b9 06 00 00 00       	mov    $0x6,%ecx
+  801545:	48 ba 90 37 80 00 00 	movabs $0x803790,%rdx
+  80154c:	00 00 00 
+  80154f:	be 26 00 00 00       	mov    $0x26,%esi
+  801554:	48 bf af 37 80 00 00 	movabs $0x8037af,%rdi
+  80155b:	00 00 00 
+  80155e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801563:	49 b9 18 04 80 00 00 	movabs $0x800418,%r9
+  80156a:	00 00 00 
+  80156d:	41 ff d1             	call   *%r9
+
+0000000000801570 <sys_region_batch>:
+
+int
+sys_region_batch(const struct RegionOp *ops, size_t count) {
+  801570:	55                   	push   %rbp
+  801571:	48 89 e5             	mov    %rsp,%rbp
+  801574:	53                   	push   %rbx
+  801575:	48 83 ec 08          	sub    $0x8,%rsp
+  801579:	48 89 fa             	mov    %rdi,%rdx
+  80157c:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80157f:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801584:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801589:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80158e:	be 00 00 00 00       	mov    $0x0,%esi
+  801593:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801599:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80159b:	48 85 c0             	test   %rax,%rax
+  80159e:	7f 06                	jg     8015a6 <sys_region_batch+0x36>
+        else
+            platform_asan_unpoison(va, ops[i].size);
+    }
+#endif
+    return res;
+}
+  8015a0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015a4:	c9                   	leave
+  8015a5:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8015a6:	49 89 c0             	mov    %rax,%r8
+  8015a9:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  8015ae:	48 ba 90 37 80 00 00 	movabs $0x803790,%rdx
+  8015b5:	00 00 00 
+  8015b8:	be 26 00 00 00       	mov    $0x26,%esi
+  8015bd:	48 bf af 37 80 00 00 	movabs $0x8037af,%rdi
+  8015c4:	00 00 00 
+  8015c7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015cc:	49 b9 18 04 80 00 00 	movabs $0x800418,%r9
+  8015d3:	00 00 00 
+  8015d6:	41 ff d1             	call   *%r9
+
+00000000008015d9 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  8015d9:	55                   	push   %rbp
+  8015da:	48 89 e5             	mov    %rsp,%rbp
+  8015dd:	53                   	push   %rbx
+  8015de:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  8015e2:	48 63 ce             	movslq %esi,%rcx
+  8015e5:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8015e8:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8015ed:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015f2:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015f7:	be 00 00 00 00       	mov    $0x0,%esi
+  8015fc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801602:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801604:	48 85 c0             	test   %rax,%rax
+  801607:	7f 06                	jg     80160f <sys_env_set_status+0x36>
+}
+  801609:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80160d:	c9                   	leave
+  80160e:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80160f:	49 89 c0             	mov    %rax,%r8
+  801612:	b9 09 00 00 00       	mov    $0x9,%ecx
+  801617:	48 ba 90 37 80 00 00 	movabs $0x803790,%rdx
+  80161e:	00 00 00 
+  801621:	be 26 00 00 00       	mov    $0x26,%esi
+  801626:	48 bf af 37 80 00 00 	movabs $0x8037af,%rdi
+  80162d:	00 00 00 
+  801630:	b8 00 00 00 00       	mov    $0x0,%eax
+  801635:	49 b9 18 04 80 00 00 	movabs $0x800418,%r9
+  80163c:	00 00 00 
+  80163f:	41 ff d1             	call   *%r9
+
+0000000000801642 <sys_env_set_weight>:
+
+int
+sys_env_set_weight(envid_t envid, uint32_t weight) {
+  801642:	55                   	push   %rbp
+  801643:	48 89 e5             	mov    %rsp,%rbp
+  801646:	53                   	push   %rbx
+  801647:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_weight, 1, envid, weight, 0, 0, 0, 0);
+  80164b:	89 f1                	mov    %esi,%ecx
+  80164d:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801650:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801655:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80165a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80165f:	be 00 00 00 00       	mov    $0x0,%esi
+  801664:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80166a:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80166c:	48 85 c0             	test   %rax,%rax
+  80166f:	7f 06                	jg     801677 <sys_env_set_weight+0x35>
+}
+  801671:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801675:	c9                   	leave
+  801676:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801677:	49 89 c0             	mov    %rax,%r8
+  80167a:	b9 10 00 00 00       	mov    $0x10,%ecx
+  80167f:	48 ba 90 37 80 00 00 	movabs $0x803790,%rdx
+  801686:	00 00 00 
+  801689:	be 26 00 00 00       	mov    $0x26,%esi
+  80168e:	48 bf af 37 80 00 00 	movabs $0x8037af,%rdi
+  801695:	00 00 00 
+  801698:	b8 00 00 00 00       	mov    $0x0,%eax
+  80169d:	49 b9 18 04 80 00 00 	movabs $0x800418,%r9
+  8016a4:	00 00 00 
+  8016a7:	41 ff d1             	call   *%r9
+
+00000000008016aa <sys_env_set_rt>:
+
+int
+sys_env_set_rt(envid_t envid, uint64_t period, uint64_t budget, uint64_t deadline) {
+  8016aa:	55                   	push   %rbp
+  8016ab:	48 89 e5             	mov    %rsp,%rbp
+  8016ae:	53                   	push   %rbx
+  8016af:	48 83 ec 08          	sub    $0x8,%rsp
+  8016b3:	89 f8                	mov    %edi,%eax
+  8016b5:	48 89 d3             	mov    %rdx,%rbx
+  8016b8:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_env_set_rt, 1, envid, period, budget, deadline, 0, 0);
+  8016bb:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8016be:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8016c3:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8016c6:	be 00 00 00 00       	mov    $0x0,%esi
+  8016cb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8016d1:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8016d3:	48 85 c0             	test   %rax,%rax
+  8016d6:	7f 06                	jg     8016de <sys_env_set_rt+0x34>
+}
+  8016d8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8016dc:	c9                   	leave
+  8016dd:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8016de:	49 89 c0             	mov    %rax,%r8
+  8016e1:	b9 11 00 00 00       	mov    $0x11,%ecx
+  8016e6:	48 ba 90 37 80 00 00 	movabs $0x803790,%rdx
+  8016ed:	00 00 00 
+  8016f0:	be 26 00 00 00       	mov    $0x26,%esi
+  8016f5:	48 bf af 37 80 00 00 	movabs $0x8037af,%rdi
+  8016fc:	00 00 00 
+  8016ff:	b8 00 00 00 00       	mov    $0x0,%eax
+  801704:	49 b9 18 04 80 00 00 	movabs $0x800418,%r9
+  80170b:	00 00 00 
+  80170e:	41 ff d1             	call   *%r9
+
+0000000000801711 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  801711:	55                   	push   %rbp
+  801712:	48 89 e5             	mov    %rsp,%rbp
+  801715:	53                   	push   %rbx
+  801716:	48 83 ec 08          	sub    $0x8,%rsp
+  80171a:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  80171d:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801720:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801725:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80172a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80172f:	be 00 00 00 00       	mov    $0x0,%esi
+  801734:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80173a:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80173c:	48 85 c0             	test   %rax,%rax
+  80173f:	7f 06                	jg     801747 <sys_env_set_trapframe+0x36>
+}
+  801741:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801745:	c9                   	leave
+  801746:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801747:	49 89 c0             	mov    %rax,%r8
+  80174a:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  80174f:	48 ba 90 37 80 00 00 	movabs $0x803790,%rdx
+  801756:	00 00 00 
+  801759:	be 26 00 00 00       	mov    $0x26,%esi
+  80175e:	48 bf af 37 80 00 00 	movabs $0x8037af,%rdi
+  801765:	00 00 00 
+  801768:	b8 00 00 00 00       	mov    $0x0,%eax
+  80176d:	49 b9 18 04 80 00 00 	movabs $0x800418,%r9
+  801774:	00 00 00 
+  801777:	41 ff d1             	call   *%r9
+
+000000000080177a <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  80177a:	55                   	push   %rbp
+  80177b:	48 89 e5             	mov    %rsp,%rbp
+  80177e:	53                   	push   %rbx
+  80177f:	48 83 ec 08          	sub    $0x8,%rsp
+  801783:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  801786:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801789:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80178e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801793:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801798:	be 00 00 00 00       	mov    $0x0,%esi
+  80179d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8017a3:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8017a5:	48 85 c0             	test   %rax,%rax
+  8017a8:	7f 06                	jg     8017b0 <sys_env_set_pgfault_upcall+0x36>
+}
+  8017aa:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8017ae:	c9                   	leave
+  8017af:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8017b0:	49 89 c0             	mov    %rax,%r8
+  8017b3:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  8017b8:	48 ba 90 37 80 00 00 	movabs $0x803790,%rdx
+  8017bf:	00 00 00 
+  8017c2:	be 26 00 00 00       	mov    $0x26,%esi
+  8017c7:	48 bf af 37 80 00 00 	movabs $0x8037af,%rdi
+  8017ce:	00 00 00 
+  8017d1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017d6:	49 b9 18 04 80 00 00 	movabs $0x800418,%r9
+  8017dd:	00 00 00 
+  8017e0:	41 ff d1             	call   *%r9
+
+00000000008017e3 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  8017e3:	55                   	push   %rbp
+  8017e4:	48 89 e5             	mov    %rsp,%rbp
+  8017e7:	53                   	push   %rbx
+  8017e8:	89 f8                	mov    %edi,%eax
+  8017ea:	49 89 f1             	mov    %rsi,%r9
+  8017ed:	48 89 d3             	mov    %rdx,%rbx
+  8017f0:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  8017f3:	49 63 f0             	movslq %r8d,%rsi
+  8017f6:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8017f9:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8017fe:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801801:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801807:	cd 30                	int    $0x30
+}
+  801809:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80180d:	c9                   	leave
+  80180e:	c3                   	ret
+
+000000000080180f <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  80180f:	55                   	push   %rbp
+  801810:	48 89 e5             	mov    %rsp,%rbp
+  801813:	53                   	push   %rbx
+  801814:	48 83 ec 08          	sub    $0x8,%rsp
+  801818:	48 89 fa             	mov    %rdi,%rdx
+  80181b:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80181e:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801823:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801828:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80182d:	be 00 00 00 00       	mov    $0x0,%esi
+  801832:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801838:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80183a:	48 85 c0             	test   %rax,%rax
+  80183d:	7f 06                	jg     801845 <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  80183f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801843:	c9                   	leave
+  801844:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801845:	49 89 c0             	mov    %rax,%r8
+  801848:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  80184d:	48 ba 90 37 80 00 00 	movabs $0x803790,%rdx
+  801854:	00 00 00 
+  801857:	be 26 00 00 00       	mov    $0x26,%esi
+  80185c:	48 bf af 37 80 00 00 	movabs $0x8037af,%rdi
+  801863:	00 00 00 
+  801866:	b8 00 00 00 00       	mov    $0x0,%eax
+  80186b:	49 b9 18 04 80 00 00 	movabs $0x800418,%r9
+  801872:	00 00 00 
+  801875:	41 ff d1             	call   *%r9
+
+0000000000801878 <fork>:
+ * Hint:
+ *   Use sys_map_region, it can perform address space copying in one call
+ *   Remember to fix "thisenv" in the child process.
+ */
+envid_t
+fork(void) {
+  801878:	55                   	push   %rbp
+  801879:	48 89 e5             	mov    %rsp,%rbp
+  80187c:	41 55                	push   %r13
+  80187e:	41 54                	push   %r12
+  801880:	53                   	push   %rbx
+  801881:	48 83 ec 08          	sub    $0x8,%rsp
+
+/* This must be inlined. Exercise for reader: why? */
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+    envid_t ret;
+    asm volatile("int %2"
+  801885:	b8 08 00 00 00       	mov    $0x8,%eax
+  80188a:	cd 30                	int    $0x30
+  80188c:	41 89 c5             	mov    %eax,%r13d
+    // LAB 9: Your code here
+
+    envid_t child_id = sys_exofork();
+    if (child_id < 0) {
+  80188f:	85 c0                	test   %eax,%eax
+  801891:	0f 88 ae 00 00 00    	js     801945 <fork+0xcd>
+  801897:	89 c3                	mov    %eax,%ebx
+        return child_id;
+    }
+    if (child_id == 0) {
+  801899:	0f 84 b4 00 00 00    	je     801953 <fork+0xdb>
+        thisenv = &envs[ENVX(sys_getenvid())];
+        return 0;
+    }
+    int res = sys_map_region(0, NULL, child_id, NULL, MAX_USER_ADDRESS, PROT_ALL | PROT_LAZY | PROT_COMBINE);
+  80189f:	41 b9 df 01 00 00    	mov    $0x1df,%r9d
+  8018a5:	49 b8 00 00 00 00 80 	movabs $0x8000000000,%r8
+  8018ac:	00 00 00 
+  8018af:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8018b4:	89 c2                	mov    %eax,%edx
+  8018b6:	be 00 00 00 00       	mov    $0x0,%esi
+  8018bb:	bf 00 00 00 00       	mov    $0x0,%edi
+  8018c0:	48 b8 a4 14 80 00 00 	movabs $0x8014a4,%rax
+  8018c7:	00 00 00 
+  8018ca:	ff d0                	call   *%rax
+  8018cc:	41 89 c4             	mov    %eax,%r12d
+    if (res < 0) {
+  8018cf:	85 c0                	test   %eax,%eax
+  8018d1:	78 5d                	js     801930 <fork+0xb8>
+        goto error;
+    }
+    res = sys_env_set_pgfault_upcall(child_id, envs[ENVX(sys_getenvid())].env_pgfault_upcall);
+  8018d3:	48 b8 7d 13 80 00 00 	movabs $0x80137d,%rax
+  8018da:	00 00 00 
+  8018dd:	ff d0                	call   *%rax
+  8018df:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8018e4:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+  8018eb:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8018f2:	00 00 00 
+  8018f5:	48 01 d0             	add    %rdx,%rax
+  8018f8:	48 8b b0 88 01 00 00 	mov    0x188(%rax),%rsi
+  8018ff:	44 89 ef             	mov    %r13d,%edi
+  801902:	48 b8 7a 17 80 00 00 	movabs $0x80177a,%rax
+  801909:	00 00 00 
+  80190c:	ff d0                	call   *%rax
+  80190e:	41 89 c4             	mov    %eax,%r12d
+    if (res < 0) {
+  801911:	85 c0                	test   %eax,%eax
+  801913:	78 1b                	js     801930 <fork+0xb8>
+        goto error;
+    }
+    res = sys_env_set_status(child_id, ENV_RUNNABLE);
+  801915:	be 02 00 00 00       	mov    $0x2,%esi
+  80191a:	44 89 ef             	mov    %r13d,%edi
+  80191d:	48 b8 d9 15 80 00 00 	movabs $0x8015d9,%rax
+  801924:	00 00 00 
+  801927:	ff d0                	call   *%rax
+  801929:	41 89 c4             	mov    %eax,%r12d
+    if (res < 0) {
+  80192c:	85 c0                	test   %eax,%eax
+  80192e:	79 15                	jns    801945 <fork+0xcd>
+        goto error;
+    }
+    return child_id;
+error:
+    ;
+    int res2 = sys_env_destroy(child_id);
+  801930:	89 df                	mov    %ebx,%edi
+  801932:	48 b8 12 13 80 00 00 	movabs $0x801312,%rax
+  801939:	00 00 00 
+  80193c:	ff d0                	call   *%rax
+    if (res2 < 0) {
+  80193e:	85 c0                	test   %eax,%eax
+  801940:	78 42                	js     801984 <fork+0x10c>
+        panic("Fork double fault");
+    }
+    return res;
+  801942:	45 89 e5             	mov    %r12d,%r13d
+}
+  801945:	44 89 e8             	mov    %r13d,%eax
+  801948:	48 83 c4 08          	add    $0x8,%rsp
+  80194c:	5b                   	pop    %rbx
+  80194d:	41 5c                	pop    %r12
+  80194f:	41 5d                	pop    %r13
+  801951:	5d                   	pop    %rbp
+  801952:	c3                   	ret
+        thisenv = &envs[ENVX(sys_getenvid())];
+  801953:	48 b8 7d 13 80 00 00 	movabs $0x80137d,%rax
+  80195a:	00 00 00 
+  80195d:	ff d0                	call   *%rax
+  80195f:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801964:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+  80196b:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  801972:	00 00 00 
+  801975:	48 01 d0             	add    %rdx,%rax
+  801978:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  80197f:	00 00 00 
+        return 0;
+  801982:	eb c1                	jmp    801945 <fork+0xcd>
+        panic("Fork double fault");
+  801984:	48 ba bd 37 80 00 00 	movabs $0x8037bd,%rdx
+  80198b:	00 00 00 
+  80198e:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801993:	48 bf cf 37 80 00 00 	movabs $0x8037cf,%rdi
+  80199a:	00 00 00 
+  80199d:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019a2:	48 b9 18 04 80 00 00 	movabs $0x800418,%rcx
+  8019a9:	00 00 00 
+  8019ac:	ff d1                	call   *%rcx
+
+00000000008019ae <sfork>:
+
+envid_t
+sfork() {
+  8019ae:	55                   	push   %rbp
+  8019af:	48 89 e5             	mov    %rsp,%rbp
+    panic("sfork() is not implemented");
+  8019b2:	48 ba da 37 80 00 00 	movabs $0x8037da,%rdx
+  8019b9:	00 00 00 
+  8019bc:	be 36 00 00 00       	mov    $0x36,%esi
+  8019c1:	48 bf cf 37 80 00 00 	movabs $0x8037cf,%rdi
+  8019c8:	00 00 00 
+  8019cb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019d0:	48 b9 18 04 80 00 00 	movabs $0x800418,%rcx
+  8019d7:	00 00 00 
+  8019da:	ff d1                	call   *%rcx
+
+00000000008019dc <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  8019dc:	55                   	push   %rbp
+  8019dd:	48 89 e5             	mov    %rsp,%rbp
+  8019e0:	41 55                	push   %r13
+  8019e2:	41 54                	push   %r12
+  8019e4:	53                   	push   %rbx
+  8019e5:	48 83 ec 08          	sub    $0x8,%rsp
+  8019e9:	49 89 fc             	mov    %rdi,%r12
+  8019ec:	48 89 f7             	mov    %rsi,%rdi
+  8019ef:	48 89 d3             	mov    %rdx,%rbx
+  8019f2:	49 89 cd             	mov    %rcx,%r13
+    // LAB 9: Your code here:
+    int res = sys_ipc_recv(!pg ? (void*)MAX_USER_ADDRESS : pg, !size ? 0 : *size);
+  8019f5:	be 00 00 00 00       	mov    $0x0,%esi
+  8019fa:	48 85 d2             	test   %rdx,%rdx
+  8019fd:	74 03                	je     801a02 <ipc_recv+0x26>
+  8019ff:	48 8b 32             	mov    (%rdx),%rsi
+  801a02:	48 85 ff             	test   %rdi,%rdi
+  801a05:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  801a0c:	00 00 00 
+  801a0f:	48 0f 44 f8          	cmove  %rax,%rdi
+  801a13:	48 b8 0f 18 80 00 00 	movabs $0x80180f,%rax
+  801a1a:	00 00 00 
+  801a1d:	ff d0                	call   *%rax
+    if (res < 0) {
+  801a1f:	85 c0                	test   %eax,%eax
+  801a21:	78 66                	js     801a89 <ipc_recv+0xad>
+        if (size) {
+            *size = 0;
+        }
+        return res;
+    }
+    if (from_env_store) {
+  801a23:	4d 85 e4             	test   %r12,%r12
+  801a26:	74 14                	je     801a3c <ipc_recv+0x60>
+        *from_env_store = thisenv->env_ipc_from;
+  801a28:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801a2f:	00 00 00 
+  801a32:	8b 80 ac 01 00 00    	mov    0x1ac(%rax),%eax
+  801a38:	41 89 04 24          	mov    %eax,(%r12)
+    }
+    if (perm_store) {
+  801a3c:	4d 85 ed             	test   %r13,%r13
+  801a3f:	74 14                	je     801a55 <ipc_recv+0x79>
+        *perm_store = thisenv->env_ipc_perm;
+  801a41:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801a48:	00 00 00 
+  801a4b:	8b 80 b0 01 00 00    	mov    0x1b0(%rax),%eax
+  801a51:	41 89 45 00          	mov    %eax,0x0(%r13)
+    }
+    if (size) {
+  801a55:	48 85 db             	test   %rbx,%rbx
+  801a58:	74 14                	je     801a6e <ipc_recv+0x92>
+        *size = thisenv->env_ipc_maxsz;
+  801a5a:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801a61:	00 00 00 
+  801a64:	48 8b 80 a0 01 00 00 	mov    0x1a0(%rax),%rax
+  801a6b:	48 89 03             	mov    %rax,(%rbx)
+    }
+    return thisenv->env_ipc_value;
+  801a6e:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801a75:	00 00 00 
+  801a78:	8b 80 a8 01 00 00    	mov    0x1a8(%rax),%eax
+}
+  801a7e:	48 83 c4 08          	add    $0x8,%rsp
+  801a82:	5b                   	pop    %rbx
+  801a83:	41 5c                	pop    %r12
+  801a85:	41 5d                	pop    %r13
+  801a87:	5d                   	pop    %rbp
+  801a88:	c3                   	ret
+        if (from_env_store) {
+  801a89:	4d 85 e4             	test   %r12,%r12
+  801a8c:	74 08                	je     801a96 <ipc_recv+0xba>
+            *from_env_store = 0;
+  801a8e:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  801a95:	00 
+        if (perm_store) {
+  801a96:	4d 85 ed             	test   %r13,%r13
+  801a99:	74 08                	je     801aa3 <ipc_recv+0xc7>
+            *perm_store = 0;
+  801a9b:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  801aa2:	00 
+        if (size) {
+  801aa3:	48 85 db             	test   %rbx,%rbx
+  801aa6:	74 d6                	je     801a7e <ipc_recv+0xa2>
+            *size = 0;
+  801aa8:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  801aaf:	eb cd                	jmp    801a7e <ipc_recv+0xa2>
+
+0000000000801ab1 <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  801ab1:	55                   	push   %rbp
+  801ab2:	48 89 e5             	mov    %rsp,%rbp
+  801ab5:	41 57                	push   %r15
+  801ab7:	41 56                	push   %r14
+  801ab9:	41 55                	push   %r13
+  801abb:	41 54                	push   %r12
+  801abd:	53                   	push   %rbx
+  801abe:	48 83 ec 18          	sub    $0x18,%rsp
+  801ac2:	41 89 fd             	mov    %edi,%r13d
+  801ac5:	89 75 cc             	mov    %esi,-0x34(%rbp)
+  801ac8:	49 89 cc             	mov    %rcx,%r12
+  801acb:	44 89 45 c8          	mov    %r8d,-0x38(%rbp)
+    // LAB 9: Your code here:
+    int res = 0;
+    while ((res = sys_ipc_try_send(to_env, val, !pg ? (void*)MAX_USER_ADDRESS : pg, size, perm)) < 0) {
+  801acf:	48 85 d2             	test   %rdx,%rdx
+  801ad2:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  801ad9:	00 00 00 
+  801adc:	48 0f 45 c2          	cmovne %rdx,%rax
+  801ae0:	48 89 c3             	mov    %rax,%rbx
+  801ae3:	49 be e3 17 80 00 00 	movabs $0x8017e3,%r14
+  801aea:	00 00 00 
+        if (res != -E_IPC_NOT_RECV) {
+            panic("sys_ipc_try_send failed: %i", res);
+        }
+        sys_yield();
+  801aed:	49 bf ae 13 80 00 00 	movabs $0x8013ae,%r15
+  801af4:	00 00 00 
+    while ((res = sys_ipc_try_send(to_env, val, !pg ? (void*)MAX_USER_ADDRESS : pg, size, perm)) < 0) {
+  801af7:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  801afa:	44 8b 45 c8          	mov    -0x38(%rbp),%r8d
+  801afe:	4c 89 e1             	mov    %r12,%rcx
+  801b01:	48 89 da             	mov    %rbx,%rdx
+  801b04:	44 89 ef             	mov    %r13d,%edi
+  801b07:	41 ff d6             	call   *%r14
+  801b0a:	85 c0                	test   %eax,%eax
+  801b0c:	79 37                	jns    801b45 <ipc_send+0x94>
+        if (res != -E_IPC_NOT_RECV) {
+  801b0e:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  801b11:	75 05                	jne    801b18 <ipc_send+0x67>
+        sys_yield();
+  801b13:	41 ff d7             	call   *%r15
+  801b16:	eb df                	jmp    801af7 <ipc_send+0x46>
+            panic("sys_ipc_try_send failed: %i", res);
+  801b18:	89 c1                	mov    %eax,%ecx
+  801b1a:	48 ba f5 37 80 00 00 	movabs $0x8037f5,%rdx
+  801b21:	00 00 00 
+  801b24:	be 40 00 00 00       	mov    $0x40,%esi
+  801b29:	48 bf 11 38 80 00 00 	movabs $0x803811,%rdi
+  801b30:	00 00 00 
+  801b33:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b38:	49 b8 18 04 80 00 00 	movabs $0x800418,%r8
+  801b3f:	00 00 00 
+  801b42:	41 ff d0             	call   *%r8
+    }
+    return;
+}
+  801b45:	48 83 c4 18          	add    $0x18,%rsp
+  801b49:	5b                   	pop    %rbx
+  801b4a:	41 5c                	pop    %r12
+  801b4c:	41 5d                	pop    %r13
+  801b4e:	41 5e                	pop    %r14
+  801b50:	41 5f                	pop    %r15
+  801b52:	5d                   	pop    %rbp
+  801b53:	c3                   	ret
+
+0000000000801b54 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  801b54:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  801b59:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  801b60:	00 00 00 
+  801b63:	48 69 d0 d0 01 00 00 	imul   $0x1d0,%rax,%rdx
+  801b6a:	48 01 ca             	add    %rcx,%rdx
+  801b6d:	8b 92 e8 00 00 00    	mov    0xe8(%rdx),%edx
+  801b73:	39 fa                	cmp    %edi,%edx
+  801b75:	74 12                	je     801b89 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  801b77:	48 83 c0 01          	add    $0x1,%rax
+  801b7b:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  801b81:	75 e0                	jne    801b63 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  801b83:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801b88:	c3                   	ret
+            return envs[i].env_id;
+  801b89:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+  801b90:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  801b97:	00 00 00 
+  801b9a:	48 01 d0             	add    %rdx,%rax
+  801b9d:	8b 80 e0 00 00 00    	mov    0xe0(%rax),%eax
+  801ba3:	c3                   	ret
+
+0000000000801ba4 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801ba4:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801bab:	ff ff ff 
+  801bae:	48 01 f8             	add    %rdi,%rax
+  801bb1:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  801bb5:	c3                   	ret
+
+0000000000801bb6 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801bb6:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801bbd:	ff ff ff 
+  801bc0:	48 01 f8             	add    %rdi,%rax
+  801bc3:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  801bc7:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  801bcd:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  801bd1:	c3                   	ret
+
+0000000000801bd2 <fd_alloc_from>:
+}
+
+/* Like fd_alloc(), but only considers fds starting from fdnum,
+ * so that several fds can be found before their pages are allocated */
+int
+fd_alloc_from(int fdnum, struct Fd **fd_store) {
+  801bd2:	55                   	push   %rbp
+  801bd3:	48 89 e5             	mov    %rsp,%rbp
+  801bd6:	41 57                	push   %r15
+  801bd8:	41 56                	push   %r14
+  801bda:	41 55                	push   %r13
+  801bdc:	41 54                	push   %r12
+  801bde:	53                   	push   %rbx
+  801bdf:	48 83 ec 08          	sub    $0x8,%rsp
+  801be3:	49 89 f7             	mov    %rsi,%r15
+    for (int i = MAX(fdnum, 0); i < MAXFD; i++) {
+  801be6:	85 ff                	test   %edi,%edi
+  801be8:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  801bee:	44 0f 49 e7          	cmovns %edi,%r12d
+  801bf2:	83 ff 1f             	cmp    $0x1f,%edi
+  801bf5:	7f 37                	jg     801c2e <fd_alloc_from+0x5c>
+  801bf7:	49 63 dc             	movslq %r12d,%rbx
+  801bfa:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  801c01:	48 c1 e3 0c          	shl    $0xc,%rbx
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  801c05:	49 be db 2c 80 00 00 	movabs $0x802cdb,%r14
+  801c0c:	00 00 00 
+        struct Fd *fd = INDEX2FD(i);
+  801c0f:	49 89 dd             	mov    %rbx,%r13
+        if (!(get_prot(fd) & PROT_R)) {
+  801c12:	48 89 df             	mov    %rbx,%rdi
+  801c15:	41 ff d6             	call   *%r14
+  801c18:	83 e0 04             	and    $0x4,%eax
+  801c1b:	74 1c                	je     801c39 <fd_alloc_from+0x67>
+    for (int i = MAX(fdnum, 0); i < MAXFD; i++) {
+  801c1d:	41 83 c4 01          	add    $0x1,%r12d
+  801c21:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801c28:	41 83 fc 1f          	cmp    $0x1f,%r12d
+  801c2c:	7e e1                	jle    801c0f <fd_alloc_from+0x3d>
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  801c2e:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801c34:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  801c39:	4d 89 2f             	mov    %r13,(%r15)
+}
+  801c3c:	48 83 c4 08          	add    $0x8,%rsp
+  801c40:	5b                   	pop    %rbx
+  801c41:	41 5c                	pop    %r12
+  801c43:	41 5d                	pop    %r13
+  801c45:	41 5e                	pop    %r14
+  801c47:	41 5f                	pop    %r15
+  801c49:	5d                   	pop    %rbp
+  801c4a:	c3                   	ret
+
+0000000000801c4b <fd_alloc>:
+fd_alloc(struct Fd **fd_store) {
+  801c4b:	55                   	push   %rbp
+  801c4c:	48 89 e5             	mov    %rsp,%rbp
+  801c4f:	48 89 fe             	mov    %rdi,%rsi
+    return fd_alloc_from(0, fd_store);
+  801c52:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c57:	48 b8 d2 1b 80 00 00 	movabs $0x801bd2,%rax
+  801c5e:	00 00 00 
+  801c61:	ff d0                	call   *%rax
+}
+  801c63:	5d                   	pop    %rbp
+  801c64:	c3                   	ret
+
+0000000000801c65 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  801c65:	83 ff 1f             	cmp    $0x1f,%edi
+  801c68:	77 39                	ja     801ca3 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  801c6a:	55                   	push   %rbp
+  801c6b:	48 89 e5             	mov    %rsp,%rbp
+  801c6e:	41 54                	push   %r12
+  801c70:	53                   	push   %rbx
+  801c71:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  801c74:	48 63 df             	movslq %edi,%rbx
+  801c77:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  801c7e:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  801c82:	48 89 df             	mov    %rbx,%rdi
+  801c85:	48 b8 db 2c 80 00 00 	movabs $0x802cdb,%rax
+  801c8c:	00 00 00 
+  801c8f:	ff d0                	call   *%rax
+  801c91:	a8 04                	test   $0x4,%al
+  801c93:	74 14                	je     801ca9 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  801c95:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  801c99:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801c9e:	5b                   	pop    %rbx
+  801c9f:	41 5c                	pop    %r12
+  801ca1:	5d                   	pop    %rbp
+  801ca2:	c3                   	ret
+        return -E_INVAL;
+  801ca3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801ca8:	c3                   	ret
+        return -E_INVAL;
+  801ca9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801cae:	eb ee                	jmp    801c9e <fd_lookup+0x39>
+
+0000000000801cb0 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  801cb0:	55                   	push   %rbp
+  801cb1:	48 89 e5             	mov    %rsp,%rbp
+  801cb4:	41 54                	push   %r12
+  801cb6:	53                   	push   %rbx
+  801cb7:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  801cba:	48 b8 a0 38 80 00 00 	movabs $0x8038a0,%rax
+  801cc1:	00 00 00 
+  801cc4:	48 bb 20 40 80 00 00 	movabs $0x804020,%rbx
+  801ccb:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  801cce:	39 3b                	cmp    %edi,(%rbx)
+  801cd0:	74 47                	je     801d19 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  801cd2:	48 83 c0 08          	add    $0x8,%rax
+  801cd6:	48 8b 18             	mov    (%rax),%rbx
+  801cd9:	48 85 db             	test   %rbx,%rbx
+  801cdc:	75 f0                	jne    801cce <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801cde:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801ce5:	00 00 00 
+  801ce8:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+  801cee:	89 fa                	mov    %edi,%edx
+  801cf0:	48 bf 20 38 80 00 00 	movabs $0x803820,%rdi
+  801cf7:	00 00 00 
+  801cfa:	b8 00 00 00 00       	mov    $0x0,%eax
+  801cff:	48 b9 68 05 80 00 00 	movabs $0x800568,%rcx
+  801d06:	00 00 00 
+  801d09:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  801d0b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  801d10:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  801d14:	5b                   	pop    %rbx
+  801d15:	41 5c                	pop    %r12
+  801d17:	5d                   	pop    %rbp
+  801d18:	c3                   	ret
+            return 0;
+  801d19:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d1e:	eb f0                	jmp    801d10 <dev_lookup+0x60>
+
+0000000000801d20 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  801d20:	55                   	push   %rbp
+  801d21:	48 89 e5             	mov    %rsp,%rbp
+  801d24:	41 55                	push   %r13
+  801d26:	41 54                	push   %r12
+  801d28:	53                   	push   %rbx
+  801d29:	48 83 ec 18          	sub    $0x18,%rsp
+  801d2d:	48 89 fb             	mov    %rdi,%rbx
+  801d30:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801d33:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  801d3a:	ff ff ff 
+  801d3d:	48 01 df             	add    %rbx,%rdi
+  801d40:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  801d44:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801d48:	48 b8 65 1c 80 00 00 	movabs $0x801c65,%rax
+  801d4f:	00 00 00 
+  801d52:	ff d0                	call   *%rax
+  801d54:	41 89 c5             	mov    %eax,%r13d
+  801d57:	85 c0                	test   %eax,%eax
+  801d59:	78 06                	js     801d61 <fd_close+0x41>
+  801d5b:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  801d5f:	74 1a                	je     801d7b <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  801d61:	45 84 e4             	test   %r12b,%r12b
+  801d64:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d69:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  801d6d:	44 89 e8             	mov    %r13d,%eax
+  801d70:	48 83 c4 18          	add    $0x18,%rsp
+  801d74:	5b                   	pop    %rbx
+  801d75:	41 5c                	pop    %r12
+  801d77:	41 5d                	pop    %r13
+  801d79:	5d                   	pop    %rbp
+  801d7a:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801d7b:	8b 3b                	mov    (%rbx),%edi
+  801d7d:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801d81:	48 b8 b0 1c 80 00 00 	movabs $0x801cb0,%rax
+  801d88:	00 00 00 
+  801d8b:	ff d0                	call   *%rax
+  801d8d:	41 89 c5             	mov    %eax,%r13d
+  801d90:	85 c0                	test   %eax,%eax
+  801d92:	78 1b                	js     801daf <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  801d94:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801d98:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801d9c:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801da2:	48 85 c0             	test   %rax,%rax
+  801da5:	74 08                	je     801daf <fd_close+0x8f>
+  801da7:	48 89 df             	mov    %rbx,%rdi
+  801daa:	ff d0                	call   *%rax
+  801dac:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801daf:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801db4:	48 89 de             	mov    %rbx,%rsi
+  801db7:	bf 00 00 00 00       	mov    $0x0,%edi
+  801dbc:	48 b8 09 15 80 00 00 	movabs $0x801509,%rax
+  801dc3:	00 00 00 
+  801dc6:	ff d0                	call   *%rax
+    return res;
+  801dc8:	eb a3                	jmp    801d6d <fd_close+0x4d>
+
+0000000000801dca <close>:
+
+int
+close(int fdnum) {
+  801dca:	55                   	push   %rbp
+  801dcb:	48 89 e5             	mov    %rsp,%rbp
+  801dce:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  801dd2:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801dd6:	48 b8 65 1c 80 00 00 	movabs $0x801c65,%rax
+  801ddd:	00 00 00 
+  801de0:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801de2:	85 c0                	test   %eax,%eax
+  801de4:	78 15                	js     801dfb <close+0x31>
+
+    return fd_close(fd, 1);
+  801de6:	be 01 00 00 00       	mov    $0x1,%esi
+  801deb:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801def:	48 b8 20 1d 80 00 00 	movabs $0x801d20,%rax
+  801df6:	00 00 00 
+  801df9:	ff d0                	call   *%rax
+}
+  801dfb:	c9                   	leave
+  801dfc:	c3                   	ret
+
+0000000000801dfd <close_all>:
+
+void
+close_all(void) {
+  801dfd:	55                   	push   %rbp
+  801dfe:	48 89 e5             	mov    %rsp,%rbp
+  801e01:	41 54                	push   %r12
+  801e03:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  801e04:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801e09:	49 bc ca 1d 80 00 00 	movabs $0x801dca,%r12
+  801e10:	00 00 00 
+  801e13:	89 df                	mov    %ebx,%edi
+  801e15:	41 ff d4             	call   *%r12
+  801e18:	83 c3 01             	add    $0x1,%ebx
+  801e1b:	83 fb 20             	cmp    $0x20,%ebx
+  801e1e:	75 f3                	jne    801e13 <close_all+0x16>
+}
+  801e20:	5b                   	pop    %rbx
+  801e21:	41 5c                	pop    %r12
+  801e23:	5d                   	pop    %rbp
+  801e24:	c3                   	ret
+
+0000000000801e25 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  801e25:	55                   	push   %rbp
+  801e26:	48 89 e5             	mov    %rsp,%rbp
+  801e29:	41 57                	push   %r15
+  801e2b:	41 56                	push   %r14
+  801e2d:	41 55                	push   %r13
+  801e2f:	41 54                	push   %r12
+  801e31:	53                   	push   %rbx
+  801e32:	48 83 ec 18          	sub    $0x18,%rsp
+  801e36:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  801e39:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801e3d:	48 b8 65 1c 80 00 00 	movabs $0x801c65,%rax
+  801e44:	00 00 00 
+  801e47:	ff d0                	call   *%rax
+  801e49:	89 c3                	mov    %eax,%ebx
+  801e4b:	85 c0                	test   %eax,%eax
+  801e4d:	0f 88 b8 00 00 00    	js     801f0b <dup+0xe6>
+    close(newfdnum);
+  801e53:	44 89 e7             	mov    %r12d,%edi
+  801e56:	48 b8 ca 1d 80 00 00 	movabs $0x801dca,%rax
+  801e5d:	00 00 00 
+  801e60:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  801e62:	4d 63 ec             	movslq %r12d,%r13
+  801e65:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  801e6c:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  801e70:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  801e74:	4c 89 ff             	mov    %r15,%rdi
+  801e77:	49 be b6 1b 80 00 00 	movabs $0x801bb6,%r14
+  801e7e:	00 00 00 
+  801e81:	41 ff d6             	call   *%r14
+  801e84:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  801e87:	4c 89 ef             	mov    %r13,%rdi
+  801e8a:	41 ff d6             	call   *%r14
+  801e8d:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  801e90:	48 89 df             	mov    %rbx,%rdi
+  801e93:	48 b8 db 2c 80 00 00 	movabs $0x802cdb,%rax
+  801e9a:	00 00 00 
+  801e9d:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  801e9f:	a8 04                	test   $0x4,%al
+  801ea1:	74 2b                	je     801ece <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  801ea3:	41 89 c1             	mov    %eax,%r9d
+  801ea6:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801eac:	4c 89 f1             	mov    %r14,%rcx
+  801eaf:	ba 00 00 00 00       	mov    $0x0,%edx
+  801eb4:	48 89 de             	mov    %rbx,%rsi
+  801eb7:	bf 00 00 00 00       	mov    $0x0,%edi
+  801ebc:	48 b8 a4 14 80 00 00 	movabs $0x8014a4,%rax
+  801ec3:	00 00 00 
+  801ec6:	ff d0                	call   *%rax
+  801ec8:	89 c3                	mov    %eax,%ebx
+  801eca:	85 c0                	test   %eax,%eax
+  801ecc:	78 4e                	js     801f1c <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  801ece:	4c 89 ff             	mov    %r15,%rdi
+  801ed1:	48 b8 db 2c 80 00 00 	movabs $0x802cdb,%rax
+  801ed8:	00 00 00 
+  801edb:	ff d0                	call   *%rax
+  801edd:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801ee0:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801ee6:	4c 89 e9             	mov    %r13,%rcx
+  801ee9:	ba 00 00 00 00       	mov    $0x0,%edx
+  801eee:	4c 89 fe             	mov    %r15,%rsi
+  801ef1:	bf 00 00 00 00       	mov    $0x0,%edi
+  801ef6:	48 b8 a4 14 80 00 00 	movabs $0x8014a4,%rax
+  801efd:	00 00 00 
+  801f00:	ff d0                	call   *%rax
+  801f02:	89 c3                	mov    %eax,%ebx
+  801f04:	85 c0                	test   %eax,%eax
+  801f06:	78 14                	js     801f1c <dup+0xf7>
+
+    return newfdnum;
+  801f08:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  801f0b:	89 d8                	mov    %ebx,%eax
+  801f0d:	48 83 c4 18          	add    $0x18,%rsp
+  801f11:	5b                   	pop    %rbx
+  801f12:	41 5c                	pop    %r12
+  801f14:	41 5d                	pop    %r13
+  801f16:	41 5e                	pop    %r14
+  801f18:	41 5f                	pop    %r15
+  801f1a:	5d                   	pop    %rbp
+  801f1b:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  801f1c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801f21:	4c 89 ee             	mov    %r13,%rsi
+  801f24:	bf 00 00 00 00       	mov    $0x0,%edi
+  801f29:	49 bc 09 15 80 00 00 	movabs $0x801509,%r12
+  801f30:	00 00 00 
+  801f33:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  801f36:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801f3b:	4c 89 f6             	mov    %r14,%rsi
+  801f3e:	bf 00 00 00 00       	mov    $0x0,%edi
+  801f43:	41 ff d4             	call   *%r12
+    return res;
+  801f46:	eb c3                	jmp    801f0b <dup+0xe6>
+
+0000000000801f48 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  801f48:	55                   	push   %rbp
+  801f49:	48 89 e5             	mov    %rsp,%rbp
+  801f4c:	41 56                	push   %r14
+  801f4e:	41 55                	push   %r13
+  801f50:	41 54                	push   %r12
+  801f52:	53                   	push   %rbx
+  801f53:	48 83 ec 10          	sub    $0x10,%rsp
+  801f57:	89 fb                	mov    %edi,%ebx
+  801f59:	49 89 f4             	mov    %rsi,%r12
+  801f5c:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801f5f:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801f63:	48 b8 65 1c 80 00 00 	movabs $0x801c65,%rax
+  801f6a:	00 00 00 
+  801f6d:	ff d0                	call   *%rax
+  801f6f:	85 c0                	test   %eax,%eax
+  801f71:	78 4c                	js     801fbf <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801f73:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801f77:	41 8b 3e             	mov    (%r14),%edi
+  801f7a:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801f7e:	48 b8 b0 1c 80 00 00 	movabs $0x801cb0,%rax
+  801f85:	00 00 00 
+  801f88:	ff d0                	call   *%rax
+  801f8a:	85 c0                	test   %eax,%eax
+  801f8c:	78 35                	js     801fc3 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801f8e:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801f92:	83 e0 03             	and    $0x3,%eax
+  801f95:	83 f8 01             	cmp    $0x1,%eax
+  801f98:	74 2d                	je     801fc7 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801f9a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801f9e:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801fa2:	48 85 c0             	test   %rax,%rax
+  801fa5:	74 56                	je     801ffd <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  801fa7:	4c 89 ea             	mov    %r13,%rdx
+  801faa:	4c 89 e6             	mov    %r12,%rsi
+  801fad:	4c 89 f7             	mov    %r14,%rdi
+  801fb0:	ff d0                	call   *%rax
+}
+  801fb2:	48 83 c4 10          	add    $0x10,%rsp
+  801fb6:	5b                   	pop    %rbx
+  801fb7:	41 5c                	pop    %r12
+  801fb9:	41 5d                	pop    %r13
+  801fbb:	41 5e                	pop    %r14
+  801fbd:	5d                   	pop    %rbp
+  801fbe:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801fbf:	48 98                	cltq
+  801fc1:	eb ef                	jmp    801fb2 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801fc3:	48 98                	cltq
+  801fc5:	eb eb                	jmp    801fb2 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801fc7:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801fce:	00 00 00 
+  801fd1:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+  801fd7:	89 da                	mov    %ebx,%edx
+  801fd9:	48 bf 61 38 80 00 00 	movabs $0x803861,%rdi
+  801fe0:	00 00 00 
+  801fe3:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fe8:	48 b9 68 05 80 00 00 	movabs $0x800568,%rcx
+  801fef:	00 00 00 
+  801ff2:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801ff4:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801ffb:	eb b5                	jmp    801fb2 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801ffd:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  802004:	eb ac                	jmp    801fb2 <read+0x6a>
+
+0000000000802006 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  802006:	55                   	push   %rbp
+  802007:	48 89 e5             	mov    %rsp,%rbp
+  80200a:	41 57                	push   %r15
+  80200c:	41 56                	push   %r14
+  80200e:	41 55                	push   %r13
+  802010:	41 54                	push   %r12
+  802012:	53                   	push   %rbx
+  802013:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  802017:	48 85 d2             	test   %rdx,%rdx
+  80201a:	74 54                	je     802070 <readn+0x6a>
+  80201c:	41 89 fd             	mov    %edi,%r13d
+  80201f:	49 89 f6             	mov    %rsi,%r14
+  802022:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  802025:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  80202a:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  80202f:	49 bf 48 1f 80 00 00 	movabs $0x801f48,%r15
+  802036:	00 00 00 
+  802039:	4c 89 e2             	mov    %r12,%rdx
+  80203c:	48 29 f2             	sub    %rsi,%rdx
+  80203f:	4c 01 f6             	add    %r14,%rsi
+  802042:	44 89 ef             	mov    %r13d,%edi
+  802045:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  802048:	85 c0                	test   %eax,%eax
+  80204a:	78 20                	js     80206c <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  80204c:	01 c3                	add    %eax,%ebx
+  80204e:	85 c0                	test   %eax,%eax
+  802050:	74 08                	je     80205a <readn+0x54>
+  802052:	48 63 f3             	movslq %ebx,%rsi
+  802055:	4c 39 e6             	cmp    %r12,%rsi
+  802058:	72 df                	jb     802039 <readn+0x33>
+    }
+    return res;
+  80205a:	48 63 c3             	movslq %ebx,%rax
+}
+  80205d:	48 83 c4 08          	add    $0x8,%rsp
+  802061:	5b                   	pop    %rbx
+  802062:	41 5c                	pop    %r12
+  802064:	41 5d                	pop    %r13
+  802066:	41 5e                	pop    %r14
+  802068:	41 5f                	pop    %r15
+  80206a:	5d                   	pop    %rbp
+  80206b:	c3                   	ret
+        if (inc < 0) return inc;
+  80206c:	48 98                	cltq
+  80206e:	eb ed                	jmp    80205d <readn+0x57>
+    int inc = 1, res = 0;
+  802070:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802075:	eb e3                	jmp    80205a <readn+0x54>
+
+0000000000802077 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  802077:	55                   	push   %rbp
+  802078:	48 89 e5             	mov    %rsp,%rbp
+  80207b:	41 56                	push   %r14
+  80207d:	41 55                	push   %r13
+  80207f:	41 54                	push   %r12
+  802081:	53                   	push   %rbx
+  802082:	48 83 ec 10          	sub    $0x10,%rsp
+  802086:	89 fb                	mov    %edi,%ebx
+  802088:	49 89 f4             	mov    %rsi,%r12
+  80208b:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80208e:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802092:	48 b8 65 1c 80 00 00 	movabs $0x801c65,%rax
+  802099:	00 00 00 
+  80209c:	ff d0                	call   *%rax
+  80209e:	85 c0                	test   %eax,%eax
+  8020a0:	78 47                	js     8020e9 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8020a2:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  8020a6:	41 8b 3e             	mov    (%r14),%edi
+  8020a9:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8020ad:	48 b8 b0 1c 80 00 00 	movabs $0x801cb0,%rax
+  8020b4:	00 00 00 
+  8020b7:	ff d0                	call   *%rax
+  8020b9:	85 c0                	test   %eax,%eax
+  8020bb:	78 30                	js     8020ed <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8020bd:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  8020c2:	74 2d                	je     8020f1 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  8020c4:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8020c8:	48 8b 40 18          	mov    0x18(%rax),%rax
+  8020cc:	48 85 c0             	test   %rax,%rax
+  8020cf:	74 56                	je     802127 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  8020d1:	4c 89 ea             	mov    %r13,%rdx
+  8020d4:	4c 89 e6             	mov    %r12,%rsi
+  8020d7:	4c 89 f7             	mov    %r14,%rdi
+  8020da:	ff d0                	call   *%rax
+}
+  8020dc:	48 83 c4 10          	add    $0x10,%rsp
+  8020e0:	5b                   	pop    %rbx
+  8020e1:	41 5c                	pop    %r12
+  8020e3:	41 5d                	pop    %r13
+  8020e5:	41 5e                	pop    %r14
+  8020e7:	5d                   	pop    %rbp
+  8020e8:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8020e9:	48 98                	cltq
+  8020eb:	eb ef                	jmp    8020dc <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8020ed:	48 98                	cltq
+  8020ef:	eb eb                	jmp    8020dc <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8020f1:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  8020f8:	00 00 00 
+  8020fb:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+  802101:	89 da                	mov    %ebx,%edx
+  802103:	48 bf 7d 38 80 00 00 	movabs $0x80387d,%rdi
+  80210a:	00 00 00 
+  80210d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802112:	48 b9 68 05 80 00 00 	movabs $0x800568,%rcx
+  802119:	00 00 00 
+  80211c:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  80211e:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802125:	eb b5                	jmp    8020dc <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  802127:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  80212e:	eb ac                	jmp    8020dc <write+0x65>
+
+0000000000802130 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  802130:	55                   	push   %rbp
+  802131:	48 89 e5             	mov    %rsp,%rbp
+  802134:	53                   	push   %rbx
+  802135:	48 83 ec 18          	sub    $0x18,%rsp
+  802139:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80213b:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80213f:	48 b8 65 1c 80 00 00 	movabs $0x801c65,%rax
+  802146:	00 00 00 
+  802149:	ff d0                	call   *%rax
+  80214b:	85 c0                	test   %eax,%eax
+  80214d:	78 0c                	js     80215b <seek+0x2b>
+
+    fd->fd_offset = offset;
+  80214f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802153:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  802156:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80215b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80215f:	c9                   	leave
+  802160:	c3                   	ret
+
+0000000000802161 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  802161:	55                   	push   %rbp
+  802162:	48 89 e5             	mov    %rsp,%rbp
+  802165:	41 55                	push   %r13
+  802167:	41 54                	push   %r12
+  802169:	53                   	push   %rbx
+  80216a:	48 83 ec 18          	sub    $0x18,%rsp
+  80216e:	89 fb                	mov    %edi,%ebx
+  802170:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802173:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802177:	48 b8 65 1c 80 00 00 	movabs $0x801c65,%rax
+  80217e:	00 00 00 
+  802181:	ff d0                	call   *%rax
+  802183:	85 c0                	test   %eax,%eax
+  802185:	78 38                	js     8021bf <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802187:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  80218b:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  80218f:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802193:	48 b8 b0 1c 80 00 00 	movabs $0x801cb0,%rax
+  80219a:	00 00 00 
+  80219d:	ff d0                	call   *%rax
+  80219f:	85 c0                	test   %eax,%eax
+  8021a1:	78 1c                	js     8021bf <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8021a3:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  8021a8:	74 20                	je     8021ca <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  8021aa:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8021ae:	48 8b 40 30          	mov    0x30(%rax),%rax
+  8021b2:	48 85 c0             	test   %rax,%rax
+  8021b5:	74 47                	je     8021fe <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  8021b7:	44 89 e6             	mov    %r12d,%esi
+  8021ba:	4c 89 ef             	mov    %r13,%rdi
+  8021bd:	ff d0                	call   *%rax
+}
+  8021bf:	48 83 c4 18          	add    $0x18,%rsp
+  8021c3:	5b                   	pop    %rbx
+  8021c4:	41 5c                	pop    %r12
+  8021c6:	41 5d                	pop    %r13
+  8021c8:	5d                   	pop    %rbp
+  8021c9:	c3                   	ret
+                thisenv->env_id, fdnum);
+  8021ca:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  8021d1:	00 00 00 
+  8021d4:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8021da:	89 da                	mov    %ebx,%edx
+  8021dc:	48 bf 40 38 80 00 00 	movabs $0x803840,%rdi
+  8021e3:	00 00 00 
+  8021e6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021eb:	48 b9 68 05 80 00 00 	movabs $0x800568,%rcx
+  8021f2:	00 00 00 
+  8021f5:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8021f7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8021fc:	eb c1                	jmp    8021bf <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  8021fe:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802203:	eb ba                	jmp    8021bf <ftruncate+0x5e>
+
+0000000000802205 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  802205:	55                   	push   %rbp
+  802206:	48 89 e5             	mov    %rsp,%rbp
+  802209:	41 54                	push   %r12
+  80220b:	53                   	push   %rbx
+  80220c:	48 83 ec 10          	sub    $0x10,%rsp
+  802210:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802213:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802217:	48 b8 65 1c 80 00 00 	movabs $0x801c65,%rax
+  80221e:	00 00 00 
+  802221:	ff d0                	call   *%rax
+  802223:	85 c0                	test   %eax,%eax
+  802225:	78 4e                	js     802275 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802227:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  80222b:	41 8b 3c 24          	mov    (%r12),%edi
+  80222f:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  802233:	48 b8 b0 1c 80 00 00 	movabs $0x801cb0,%rax
+  80223a:	00 00 00 
+  80223d:	ff d0                	call   *%rax
+  80223f:	85 c0                	test   %eax,%eax
+  802241:	78 32                	js     802275 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  802243:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802247:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  80224c:	74 30                	je     80227e <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  80224e:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  802251:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  802258:	00 00 00 
+    stat->st_isdir = 0;
+  80225b:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  802262:	00 00 00 
+    stat->st_dev = dev;
+  802265:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  80226c:	48 89 de             	mov    %rbx,%rsi
+  80226f:	4c 89 e7             	mov    %r12,%rdi
+  802272:	ff 50 28             	call   *0x28(%rax)
+}
+  802275:	48 83 c4 10          	add    $0x10,%rsp
+  802279:	5b                   	pop    %rbx
+  80227a:	41 5c                	pop    %r12
+  80227c:	5d                   	pop    %rbp
+  80227d:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  80227e:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802283:	eb f0                	jmp    802275 <fstat+0x70>
+
+0000000000802285 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  802285:	55                   	push   %rbp
+  802286:	48 89 e5             	mov    %rsp,%rbp
+  802289:	41 54                	push   %r12
+  80228b:	53                   	push   %rbx
+  80228c:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  80228f:	be 00 00 00 00       	mov    $0x0,%esi
+  802294:	48 b8 68 26 80 00 00 	movabs $0x802668,%rax
+  80229b:	00 00 00 
+  80229e:	ff d0                	call   *%rax
+  8022a0:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  8022a2:	85 c0                	test   %eax,%eax
+  8022a4:	78 25                	js     8022cb <stat+0x46>
+
+    int res = fstat(fd, stat);
+  8022a6:	4c 89 e6             	mov    %r12,%rsi
+  8022a9:	89 c7                	mov    %eax,%edi
+  8022ab:	48 b8 05 22 80 00 00 	movabs $0x802205,%rax
+  8022b2:	00 00 00 
+  8022b5:	ff d0                	call   *%rax
+  8022b7:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  8022ba:	89 df                	mov    %ebx,%edi
+  8022bc:	48 b8 ca 1d 80 00 00 	movabs $0x801dca,%rax
+  8022c3:	00 00 00 
+  8022c6:	ff d0                	call   *%rax
+
+    return res;
+  8022c8:	44 89 e3             	mov    %r12d,%ebx
+}
+  8022cb:	89 d8                	mov    %ebx,%eax
+  8022cd:	5b                   	pop    %rbx
+  8022ce:	41 5c                	pop    %r12
+  8022d0:	5d                   	pop    %rbp
+  8022d1:	c3                   	ret
+
+00000000008022d2 <fsipc>:
+ * response may be written back to fsipcbuf.
+ * type: request code, passed as the simple integer IPC value.
+ * dstva: virtual address at which to receive reply page, 0 if none.
+ * Returns result from the file server. */
+static int
+fsipc(unsigned type, void *dstva) {
+  8022d2:	55                   	push   %rbp
+  8022d3:	48 89 e5             	mov    %rsp,%rbp
+  8022d6:	41 54                	push   %r12
+  8022d8:	53                   	push   %rbx
+  8022d9:	48 83 ec 10          	sub    $0x10,%rsp
+  8022dd:	41 89 fc             	mov    %edi,%r12d
+  8022e0:	48 89 f3             	mov    %rsi,%rbx
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8022e3:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  8022ea:	00 00 00 
+  8022ed:	83 38 00             	cmpl   $0x0,(%rax)
+  8022f0:	74 5e                	je     802350 <fsipc+0x7e>
+    if (debug) {
+        cprintf("[%08x] fsipc %d %08x\n",
+                thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+    }
+
+    ipc_send(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW);
+  8022f2:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8022f8:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8022fd:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  802304:	00 00 00 
+  802307:	44 89 e6             	mov    %r12d,%esi
+  80230a:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  802311:	00 00 00 
+  802314:	8b 38                	mov    (%rax),%edi
+  802316:	48 b8 b1 1a 80 00 00 	movabs $0x801ab1,%rax
+  80231d:	00 00 00 
+  802320:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  802322:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  802329:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  80232a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80232f:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  802333:	48 89 de             	mov    %rbx,%rsi
+  802336:	bf 00 00 00 00       	mov    $0x0,%edi
+  80233b:	48 b8 dc 19 80 00 00 	movabs $0x8019dc,%rax
+  802342:	00 00 00 
+  802345:	ff d0                	call   *%rax
+}
+  802347:	48 83 c4 10          	add    $0x10,%rsp
+  80234b:	5b                   	pop    %rbx
+  80234c:	41 5c                	pop    %r12
+  80234e:	5d                   	pop    %rbp
+  80234f:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802350:	bf 03 00 00 00       	mov    $0x3,%edi
+  802355:	48 b8 54 1b 80 00 00 	movabs $0x801b54,%rax
+  80235c:	00 00 00 
+  80235f:	ff d0                	call   *%rax
+  802361:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  802368:	00 00 
+  80236a:	eb 86                	jmp    8022f2 <fsipc+0x20>
+
+000000000080236c <devfile_trunc>:
+    return 0;
+}
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  80236c:	55                   	push   %rbp
+  80236d:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802370:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  802377:	00 00 00 
+  80237a:	8b 57 0c             	mov    0xc(%rdi),%edx
+  80237d:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  80237f:	89 70 04             	mov    %esi,0x4(%rax)
+
+    return fsipc(FSREQ_SET_SIZE, NULL);
+  802382:	be 00 00 00 00       	mov    $0x0,%esi
+  802387:	bf 02 00 00 00       	mov    $0x2,%edi
+  80238c:	48 b8 d2 22 80 00 00 	movabs $0x8022d2,%rax
+  802393:	00 00 00 
+  802396:	ff d0                	call   *%rax
+}
+  802398:	5d                   	pop    %rbp
+  802399:	c3                   	ret
+
+000000000080239a <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  80239a:	55                   	push   %rbp
+  80239b:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  80239e:	8b 47 0c             	mov    0xc(%rdi),%eax
+  8023a1:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  8023a8:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  8023aa:	be 00 00 00 00       	mov    $0x0,%esi
+  8023af:	bf 06 00 00 00       	mov    $0x6,%edi
+  8023b4:	48 b8 d2 22 80 00 00 	movabs $0x8022d2,%rax
+  8023bb:	00 00 00 
+  8023be:	ff d0                	call   *%rax
+}
+  8023c0:	5d                   	pop    %rbp
+  8023c1:	c3                   	ret
+
+00000000008023c2 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  8023c2:	55                   	push   %rbp
+  8023c3:	48 89 e5             	mov    %rsp,%rbp
+  8023c6:	41 54                	push   %r12
+  8023c8:	53                   	push   %rbx
+  8023c9:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8023cc:	8b 47 0c             	mov    0xc(%rdi),%eax
+  8023cf:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  8023d6:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  8023d8:	be 00 00 00 00       	mov    $0x0,%esi
+  8023dd:	bf 05 00 00 00       	mov    $0x5,%edi
+  8023e2:	48 b8 d2 22 80 00 00 	movabs $0x8022d2,%rax
+  8023e9:	00 00 00 
+  8023ec:	ff d0                	call   *%rax
+    if (res < 0) {
+  8023ee:	85 c0                	test   %eax,%eax
+  8023f0:	78 3d                	js     80242f <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8023f2:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  8023f9:	00 00 00 
+  8023fc:	4c 89 e6             	mov    %r12,%rsi
+  8023ff:	48 89 df             	mov    %rbx,%rdi
+  802402:	48 b8 8d 0e 80 00 00 	movabs $0x800e8d,%rax
+  802409:	00 00 00 
+  80240c:	ff d0                	call   *%rax
+    st->st_size  = fsipcbuf.statRet.ret_size;
+  80240e:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  802415:	00 
+  802416:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  80241c:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  802423:	00 
+  802424:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  80242a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80242f:	5b                   	pop    %rbx
+  802430:	41 5c                	pop    %r12
+  802432:	5d                   	pop    %rbp
+  802433:	c3                   	ret
+
+0000000000802434 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  802434:	55                   	push   %rbp
+  802435:	48 89 e5             	mov    %rsp,%rbp
+  802438:	41 57                	push   %r15
+  80243a:	41 56                	push   %r14
+  80243c:	41 55                	push   %r13
+  80243e:	41 54                	push   %r12
+  802440:	53                   	push   %rbx
+  802441:	48 83 ec 18          	sub    $0x18,%rsp
+  802445:	49 89 fe             	mov    %rdi,%r14
+  802448:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+  80244c:	48 89 d3             	mov    %rdx,%rbx
+    while (n > sizeof(fsipcbuf.write.req_buf))
+  80244f:	48 81 fa f0 0f 00 00 	cmp    $0xff0,%rdx
+  802456:	0f 86 e4 00 00 00    	jbe    802540 <devfile_write+0x10c>
+  80245c:	49 89 f4             	mov    %rsi,%r12
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  80245f:	49 bd 00 60 80 00 00 	movabs $0x806000,%r13
+  802466:	00 00 00 
+        memcpy(fsipcbuf.write.req_buf, buf, sizeof(fsipcbuf.write.req_buf));
+  802469:	49 bf ee 10 80 00 00 	movabs $0x8010ee,%r15
+  802470:	00 00 00 
+  802473:	eb 03                	jmp    802478 <devfile_write+0x44>
+        buf += sizeof(fsipcbuf.write.req_buf);
+  802475:	49 89 f4             	mov    %rsi,%r12
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802478:	41 8b 46 0c          	mov    0xc(%r14),%eax
+  80247c:	41 89 45 00          	mov    %eax,0x0(%r13)
+        fsipcbuf.write.req_n      = sizeof(fsipcbuf.write.req_buf);
+  802480:	49 c7 45 08 f0 0f 00 	movq   $0xff0,0x8(%r13)
+  802487:	00 
+        memcpy(fsipcbuf.write.req_buf, buf, sizeof(fsipcbuf.write.req_buf));
+  802488:	ba f0 0f 00 00       	mov    $0xff0,%edx
+  80248d:	4c 89 e6             	mov    %r12,%rsi
+  802490:	48 bf 10 60 80 00 00 	movabs $0x806010,%rdi
+  802497:	00 00 00 
+  80249a:	41 ff d7             	call   *%r15
+        ssize_t res = fsipc(FSREQ_WRITE, NULL);
+  80249d:	be 00 00 00 00       	mov    $0x0,%esi
+  8024a2:	bf 04 00 00 00       	mov    $0x4,%edi
+  8024a7:	48 b8 d2 22 80 00 00 	movabs $0x8022d2,%rax
+  8024ae:	00 00 00 
+  8024b1:	ff d0                	call   *%rax
+  8024b3:	48 63 d0             	movslq %eax,%rdx
+        if (res < 0 || res < sizeof(fsipcbuf.write.req_buf))
+  8024b6:	3d ef 0f 00 00       	cmp    $0xfef,%eax
+  8024bb:	7e 71                	jle    80252e <devfile_write+0xfa>
+        buf += sizeof(fsipcbuf.write.req_buf);
+  8024bd:	49 8d b4 24 f0 0f 00 	lea    0xff0(%r12),%rsi
+  8024c4:	00 
+        n -= sizeof(fsipcbuf.write.req_buf);
+  8024c5:	48 81 eb f0 0f 00 00 	sub    $0xff0,%rbx
+    while (n > sizeof(fsipcbuf.write.req_buf))
+  8024cc:	48 81 fb f0 0f 00 00 	cmp    $0xff0,%rbx
+  8024d3:	77 a0                	ja     802475 <devfile_write+0x41>
+        written += sizeof(fsipcbuf.write.req_buf);
+  8024d5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8024d9:	49 29 c4             	sub    %rax,%r12
+  8024dc:	4d 8d a4 24 f0 0f 00 	lea    0xff0(%r12),%r12
+  8024e3:	00 
+    fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8024e4:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  8024eb:	00 00 00 
+  8024ee:	41 8b 56 0c          	mov    0xc(%r14),%edx
+  8024f2:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.write.req_n      = n;
+  8024f4:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    memcpy(fsipcbuf.write.req_buf, buf, n);
+  8024f8:	48 89 da             	mov    %rbx,%rdx
+  8024fb:	48 8d 78 10          	lea    0x10(%rax),%rdi
+  8024ff:	48 b8 ee 10 80 00 00 	movabs $0x8010ee,%rax
+  802506:	00 00 00 
+  802509:	ff d0                	call   *%rax
+    ssize_t res = fsipc(FSREQ_WRITE, NULL);
+  80250b:	be 00 00 00 00       	mov    $0x0,%esi
+  802510:	bf 04 00 00 00       	mov    $0x4,%edi
+  802515:	48 b8 d2 22 80 00 00 	movabs $0x8022d2,%rax
+  80251c:	00 00 00 
+  80251f:	ff d0                	call   *%rax
+  802521:	48 63 d0             	movslq %eax,%rdx
+    written += res;
+  802524:	49 01 d4             	add    %rdx,%r12
+  802527:	48 85 d2             	test   %rdx,%rdx
+  80252a:	49 0f 49 d4          	cmovns %r12,%rdx
+}
+  80252e:	48 89 d0             	mov    %rdx,%rax
+  802531:	48 83 c4 18          	add    $0x18,%rsp
+  802535:	5b                   	pop    %rbx
+  802536:	41 5c                	pop    %r12
+  802538:	41 5d                	pop    %r13
+  80253a:	41 5e                	pop    %r14
+  80253c:	41 5f                	pop    %r15
+  80253e:	5d                   	pop    %rbp
+  80253f:	c3                   	ret
+    while (n > sizeof(fsipcbuf.write.req_buf))
+  802540:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+    ssize_t written = 0;
+  802544:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80254a:	eb 98                	jmp    8024e4 <devfile_write+0xb0>
+
+000000000080254c <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  80254c:	55                   	push   %rbp
+  80254d:	48 89 e5             	mov    %rsp,%rbp
+  802550:	41 57                	push   %r15
+  802552:	41 56                	push   %r14
+  802554:	41 55                	push   %r13
+  802556:	41 54                	push   %r12
+  802558:	53                   	push   %rbx
+  802559:	48 83 ec 18          	sub    $0x18,%rsp
+  80255d:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  802561:	49 89 f6             	mov    %rsi,%r14
+  802564:	49 89 d4             	mov    %rdx,%r12
+    while (n > sizeof(fsipcbuf.readRet.ret_buf))
+  802567:	48 81 fa 00 10 00 00 	cmp    $0x1000,%rdx
+  80256e:	0f 86 ea 00 00 00    	jbe    80265e <devfile_read+0x112>
+    ssize_t readsz = 0;
+  802574:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  80257b:	00 
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  80257c:	49 bf 00 60 80 00 00 	movabs $0x806000,%r15
+  802583:	00 00 00 
+  802586:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80258a:	8b 40 0c             	mov    0xc(%rax),%eax
+  80258d:	41 89 07             	mov    %eax,(%r15)
+        fsipcbuf.read.req_n = sizeof(fsipcbuf.readRet.ret_buf);
+  802590:	49 c7 47 08 00 10 00 	movq   $0x1000,0x8(%r15)
+  802597:	00 
+        ssize_t res = fsipc(FSREQ_READ, NULL);
+  802598:	be 00 00 00 00       	mov    $0x0,%esi
+  80259d:	bf 03 00 00 00       	mov    $0x3,%edi
+  8025a2:	48 b8 d2 22 80 00 00 	movabs $0x8022d2,%rax
+  8025a9:	00 00 00 
+  8025ac:	ff d0                	call   *%rax
+  8025ae:	4c 63 e8             	movslq %eax,%r13
+        if (res < 0)
+  8025b1:	4d 85 ed             	test   %r13,%r13
+  8025b4:	0f 88 92 00 00 00    	js     80264c <devfile_read+0x100>
+        memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  8025ba:	4c 89 ea             	mov    %r13,%rdx
+  8025bd:	4c 89 fe             	mov    %r15,%rsi
+  8025c0:	4c 89 f7             	mov    %r14,%rdi
+  8025c3:	48 b8 ee 10 80 00 00 	movabs $0x8010ee,%rax
+  8025ca:	00 00 00 
+  8025cd:	ff d0                	call   *%rax
+        if (res < sizeof(fsipcbuf.readRet.ret_buf))
+  8025cf:	49 81 fd ff 0f 00 00 	cmp    $0xfff,%r13
+  8025d6:	76 6d                	jbe    802645 <devfile_read+0xf9>
+        readsz += res;
+  8025d8:	4c 01 6d c0          	add    %r13,-0x40(%rbp)
+        buf += res;
+  8025dc:	4d 01 ee             	add    %r13,%r14
+        n -= res;
+  8025df:	4d 29 ec             	sub    %r13,%r12
+    while (n > sizeof(fsipcbuf.readRet.ret_buf))
+  8025e2:	49 81 fc 00 10 00 00 	cmp    $0x1000,%r12
+  8025e9:	77 9b                	ja     802586 <devfile_read+0x3a>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8025eb:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  8025f2:	00 00 00 
+  8025f5:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  8025f9:	8b 51 0c             	mov    0xc(%rcx),%edx
+  8025fc:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.read.req_n = n;
+  8025fe:	4c 89 60 08          	mov    %r12,0x8(%rax)
+    ssize_t res = fsipc(FSREQ_READ, NULL);
+  802602:	be 00 00 00 00       	mov    $0x0,%esi
+  802607:	bf 03 00 00 00       	mov    $0x3,%edi
+  80260c:	48 b8 d2 22 80 00 00 	movabs $0x8022d2,%rax
+  802613:	00 00 00 
+  802616:	ff d0                	call   *%rax
+  802618:	4c 63 e8             	movslq %eax,%r13
+    if (res < 0)
+  80261b:	4d 85 ed             	test   %r13,%r13
+  80261e:	78 2c                	js     80264c <devfile_read+0x100>
+    memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  802620:	4c 89 ea             	mov    %r13,%rdx
+  802623:	48 be 00 60 80 00 00 	movabs $0x806000,%rsi
+  80262a:	00 00 00 
+  80262d:	4c 89 f7             	mov    %r14,%rdi
+  802630:	48 b8 ee 10 80 00 00 	movabs $0x8010ee,%rax
+  802637:	00 00 00 
+  80263a:	ff d0                	call   *%rax
+    readsz += res;
+  80263c:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802640:	49 01 c5             	add    %rax,%r13
+    return readsz;
+  802643:	eb 07                	jmp    80264c <devfile_read+0x100>
+            return readsz + res;
+  802645:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802649:	49 01 c5             	add    %rax,%r13
+}
+  80264c:	4c 89 e8             	mov    %r13,%rax
+  80264f:	48 83 c4 18          	add    $0x18,%rsp
+  802653:	5b                   	pop    %rbx
+  802654:	41 5c                	pop    %r12
+  802656:	41 5d                	pop    %r13
+  802658:	41 5e                	pop    %r14
+  80265a:	41 5f                	pop    %r15
+  80265c:	5d                   	pop    %rbp
+  80265d:	c3                   	ret
+    ssize_t readsz = 0;
+  80265e:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  802665:	00 
+  802666:	eb 83                	jmp    8025eb <devfile_read+0x9f>
+
+0000000000802668 <open>:
+open(const char *path, int mode) {
+  802668:	55                   	push   %rbp
+  802669:	48 89 e5             	mov    %rsp,%rbp
+  80266c:	41 55                	push   %r13
+  80266e:	41 54                	push   %r12
+  802670:	53                   	push   %rbx
+  802671:	48 83 ec 18          	sub    $0x18,%rsp
+  802675:	49 89 fc             	mov    %rdi,%r12
+  802678:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  80267b:	48 b8 4f 0e 80 00 00 	movabs $0x800e4f,%rax
+  802682:	00 00 00 
+  802685:	ff d0                	call   *%rax
+  802687:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  80268d:	0f 87 8a 00 00 00    	ja     80271d <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802693:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802697:	48 b8 4b 1c 80 00 00 	movabs $0x801c4b,%rax
+  80269e:	00 00 00 
+  8026a1:	ff d0                	call   *%rax
+  8026a3:	89 c3                	mov    %eax,%ebx
+  8026a5:	85 c0                	test   %eax,%eax
+  8026a7:	78 50                	js     8026f9 <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  8026a9:	4c 89 e6             	mov    %r12,%rsi
+  8026ac:	48 bb 00 60 80 00 00 	movabs $0x806000,%rbx
+  8026b3:	00 00 00 
+  8026b6:	48 89 df             	mov    %rbx,%rdi
+  8026b9:	48 b8 8d 0e 80 00 00 	movabs $0x800e8d,%rax
+  8026c0:	00 00 00 
+  8026c3:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  8026c5:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  8026cc:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8026d0:	bf 01 00 00 00       	mov    $0x1,%edi
+  8026d5:	48 b8 d2 22 80 00 00 	movabs $0x8022d2,%rax
+  8026dc:	00 00 00 
+  8026df:	ff d0                	call   *%rax
+  8026e1:	89 c3                	mov    %eax,%ebx
+  8026e3:	85 c0                	test   %eax,%eax
+  8026e5:	78 1f                	js     802706 <open+0x9e>
+    return fd2num(fd);
+  8026e7:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8026eb:	48 b8 a4 1b 80 00 00 	movabs $0x801ba4,%rax
+  8026f2:	00 00 00 
+  8026f5:	ff d0                	call   *%rax
+  8026f7:	89 c3                	mov    %eax,%ebx
+}
+  8026f9:	89 d8                	mov    %ebx,%eax
+  8026fb:	48 83 c4 18          	add    $0x18,%rsp
+  8026ff:	5b                   	pop    %rbx
+  802700:	41 5c                	pop    %r12
+  802702:	41 5d                	pop    %r13
+  802704:	5d                   	pop    %rbp
+  802705:	c3                   	ret
+        fd_close(fd, 0);
+  802706:	be 00 00 00 00       	mov    $0x0,%esi
+  80270b:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80270f:	48 b8 20 1d 80 00 00 	movabs $0x801d20,%rax
+  802716:	00 00 00 
+  802719:	ff d0                	call   *%rax
+        return res;
+  80271b:	eb dc                	jmp    8026f9 <open+0x91>
+        return -E_BAD_PATH;
+  80271d:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  802722:	eb d5                	jmp    8026f9 <open+0x91>
+
+0000000000802724 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  802724:	55                   	push   %rbp
+  802725:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc(FSREQ_SYNC, NULL);
+  802728:	be 00 00 00 00       	mov    $0x0,%esi
+  80272d:	bf 08 00 00 00       	mov    $0x8,%edi
+  802732:	48 b8 d2 22 80 00 00 	movabs $0x8022d2,%rax
+  802739:	00 00 00 
+  80273c:	ff d0                	call   *%rax
+}
+  80273e:	5d                   	pop    %rbp
+  80273f:	c3                   	ret
+
+0000000000802740 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  802740:	55                   	push   %rbp
+  802741:	48 89 e5             	mov    %rsp,%rbp
+  802744:	41 54                	push   %r12
+  802746:	53                   	push   %rbx
+  802747:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80274a:	48 b8 b6 1b 80 00 00 	movabs $0x801bb6,%rax
+  802751:	00 00 00 
+  802754:	ff d0                	call   *%rax
+  802756:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  802759:	48 be c0 38 80 00 00 	movabs $0x8038c0,%rsi
+  802760:	00 00 00 
+  802763:	48 89 df             	mov    %rbx,%rdi
+  802766:	48 b8 8d 0e 80 00 00 	movabs $0x800e8d,%rax
+  80276d:	00 00 00 
+  802770:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  802772:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  802777:	41 2b 04 24          	sub    (%r12),%eax
+  80277b:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  802781:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  802788:	00 00 00 
+    stat->st_dev = &devpipe;
+  80278b:	48 b8 60 40 80 00 00 	movabs $0x804060,%rax
+  802792:	00 00 00 
+  802795:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  80279c:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027a1:	5b                   	pop    %rbx
+  8027a2:	41 5c                	pop    %r12
+  8027a4:	5d                   	pop    %rbp
+  8027a5:	c3                   	ret
+
+00000000008027a6 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  8027a6:	55                   	push   %rbp
+  8027a7:	48 89 e5             	mov    %rsp,%rbp
+  8027aa:	41 54                	push   %r12
+  8027ac:	53                   	push   %rbx
+  8027ad:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8027b0:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8027b5:	48 89 fe             	mov    %rdi,%rsi
+  8027b8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8027bd:	49 bc 09 15 80 00 00 	movabs $0x801509,%r12
+  8027c4:	00 00 00 
+  8027c7:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  8027ca:	48 89 df             	mov    %rbx,%rdi
+  8027cd:	48 b8 b6 1b 80 00 00 	movabs $0x801bb6,%rax
+  8027d4:	00 00 00 
+  8027d7:	ff d0                	call   *%rax
+  8027d9:	48 89 c6             	mov    %rax,%rsi
+  8027dc:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8027e1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8027e6:	41 ff d4             	call   *%r12
+}
+  8027e9:	5b                   	pop    %rbx
+  8027ea:	41 5c                	pop    %r12
+  8027ec:	5d                   	pop    %rbp
+  8027ed:	c3                   	ret
+
+00000000008027ee <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8027ee:	55                   	push   %rbp
+  8027ef:	48 89 e5             	mov    %rsp,%rbp
+  8027f2:	41 57                	push   %r15
+  8027f4:	41 56                	push   %r14
+  8027f6:	41 55                	push   %r13
+  8027f8:	41 54                	push   %r12
+  8027fa:	53                   	push   %rbx
+  8027fb:	48 83 ec 18          	sub    $0x18,%rsp
+  8027ff:	49 89 fc             	mov    %rdi,%r12
+  802802:	49 89 f5             	mov    %rsi,%r13
+  802805:	49 89 d7             	mov    %rdx,%r15
+  802808:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80280c:	48 b8 b6 1b 80 00 00 	movabs $0x801bb6,%rax
+  802813:	00 00 00 
+  802816:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  802818:	4d 85 ff             	test   %r15,%r15
+  80281b:	0f 84 af 00 00 00    	je     8028d0 <devpipe_write+0xe2>
+  802821:	48 89 c3             	mov    %rax,%rbx
+  802824:	4c 89 f8             	mov    %r15,%rax
+  802827:	4d 89 ef             	mov    %r13,%r15
+  80282a:	4c 01 e8             	add    %r13,%rax
+  80282d:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802831:	49 bd 11 14 80 00 00 	movabs $0x801411,%r13
+  802838:	00 00 00 
+            sys_yield();
+  80283b:	49 be ae 13 80 00 00 	movabs $0x8013ae,%r14
+  802842:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  802845:	8b 73 04             	mov    0x4(%rbx),%esi
+  802848:	48 63 ce             	movslq %esi,%rcx
+  80284b:	48 63 03             	movslq (%rbx),%rax
+  80284e:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  802854:	48 39 c1             	cmp    %rax,%rcx
+  802857:	72 2e                	jb     802887 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802859:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80285e:	48 89 da             	mov    %rbx,%rdx
+  802861:	be 00 10 00 00       	mov    $0x1000,%esi
+  802866:	4c 89 e7             	mov    %r12,%rdi
+  802869:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  80286c:	85 c0                	test   %eax,%eax
+  80286e:	74 66                	je     8028d6 <devpipe_write+0xe8>
+            sys_yield();
+  802870:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  802873:	8b 73 04             	mov    0x4(%rbx),%esi
+  802876:	48 63 ce             	movslq %esi,%rcx
+  802879:	48 63 03             	movslq (%rbx),%rax
+  80287c:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  802882:	48 39 c1             	cmp    %rax,%rcx
+  802885:	73 d2                	jae    802859 <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  802887:	41 0f b6 3f          	movzbl (%r15),%edi
+  80288b:	48 89 ca             	mov    %rcx,%rdx
+  80288e:	48 c1 ea 03          	shr    $0x3,%rdx
+  802892:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  802899:	08 10 20 
+  80289c:	48 f7 e2             	mul    %rdx
+  80289f:	48 c1 ea 06          	shr    $0x6,%rdx
+  8028a3:	48 89 d0             	mov    %rdx,%rax
+  8028a6:	48 c1 e0 09          	shl    $0x9,%rax
+  8028aa:	48 29 d0             	sub    %rdx,%rax
+  8028ad:	48 c1 e0 03          	shl    $0x3,%rax
+  8028b1:	48 29 c1             	sub    %rax,%rcx
+  8028b4:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  8028b9:	83 c6 01             	add    $0x1,%esi
+  8028bc:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8028bf:	49 83 c7 01          	add    $0x1,%r15
+  8028c3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8028c7:	49 39 c7             	cmp    %rax,%r15
+  8028ca:	0f 85 75 ff ff ff    	jne    802845 <devpipe_write+0x57>
+    return n;
+  8028d0:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8028d4:	eb 05                	jmp    8028db <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  8028d6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8028db:	48 83 c4 18          	add    $0x18,%rsp
+  8028df:	5b                   	pop    %rbx
+  8028e0:	41 5c                	pop    %r12
+  8028e2:	41 5d                	pop    %r13
+  8028e4:	41 5e                	pop    %r14
+  8028e6:	41 5f                	pop    %r15
+  8028e8:	5d                   	pop    %rbp
+  8028e9:	c3                   	ret
+
+00000000008028ea <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  8028ea:	55                   	push   %rbp
+  8028eb:	48 89 e5             	mov    %rsp,%rbp
+  8028ee:	41 57                	push   %r15
+  8028f0:	41 56                	push   %r14
+  8028f2:	41 55                	push   %r13
+  8028f4:	41 54                	push   %r12
+  8028f6:	53                   	push   %rbx
+  8028f7:	48 83 ec 18          	sub    $0x18,%rsp
+  8028fb:	49 89 fc             	mov    %rdi,%r12
+  8028fe:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  802902:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802906:	48 b8 b6 1b 80 00 00 	movabs $0x801bb6,%rax
+  80290d:	00 00 00 
+  802910:	ff d0                	call   *%rax
+  802912:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  802915:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80291b:	49 bd 11 14 80 00 00 	movabs $0x801411,%r13
+  802922:	00 00 00 
+            sys_yield();
+  802925:	49 be ae 13 80 00 00 	movabs $0x8013ae,%r14
+  80292c:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  80292f:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  802934:	74 7d                	je     8029b3 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  802936:	8b 03                	mov    (%rbx),%eax
+  802938:	3b 43 04             	cmp    0x4(%rbx),%eax
+  80293b:	75 26                	jne    802963 <devpipe_read+0x79>
+            if (i > 0) return i;
+  80293d:	4d 85 ff             	test   %r15,%r15
+  802940:	75 77                	jne    8029b9 <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802942:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802947:	48 89 da             	mov    %rbx,%rdx
+  80294a:	be 00 10 00 00       	mov    $0x1000,%esi
+  80294f:	4c 89 e7             	mov    %r12,%rdi
+  802952:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  802955:	85 c0                	test   %eax,%eax
+  802957:	74 72                	je     8029cb <devpipe_read+0xe1>
+            sys_yield();
+  802959:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  80295c:	8b 03                	mov    (%rbx),%eax
+  80295e:	3b 43 04             	cmp    0x4(%rbx),%eax
+  802961:	74 df                	je     802942 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802963:	48 63 c8             	movslq %eax,%rcx
+  802966:	48 89 ca             	mov    %rcx,%rdx
+  802969:	48 c1 ea 03          	shr    $0x3,%rdx
+  80296d:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  802974:	08 10 20 
+  802977:	48 89 d0             	mov    %rdx,%rax
+  80297a:	48 f7 e6             	mul    %rsi
+  80297d:	48 c1 ea 06          	shr    $0x6,%rdx
+  802981:	48 89 d0             	mov    %rdx,%rax
+  802984:	48 c1 e0 09          	shl    $0x9,%rax
+  802988:	48 29 d0             	sub    %rdx,%rax
+  80298b:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  802992:	00 
+  802993:	48 89 c8             	mov    %rcx,%rax
+  802996:	48 29 d0             	sub    %rdx,%rax
+  802999:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  80299e:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8029a2:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  8029a6:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8029a9:	49 83 c7 01          	add    $0x1,%r15
+  8029ad:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  8029b1:	75 83                	jne    802936 <devpipe_read+0x4c>
+    return n;
+  8029b3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8029b7:	eb 03                	jmp    8029bc <devpipe_read+0xd2>
+            if (i > 0) return i;
+  8029b9:	4c 89 f8             	mov    %r15,%rax
+}
+  8029bc:	48 83 c4 18          	add    $0x18,%rsp
+  8029c0:	5b                   	pop    %rbx
+  8029c1:	41 5c                	pop    %r12
+  8029c3:	41 5d                	pop    %r13
+  8029c5:	41 5e                	pop    %r14
+  8029c7:	41 5f                	pop    %r15
+  8029c9:	5d                   	pop    %rbp
+  8029ca:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  8029cb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029d0:	eb ea                	jmp    8029bc <devpipe_read+0xd2>
+
+00000000008029d2 <pipe>:
+pipe(int pfd[2]) {
+  8029d2:	55                   	push   %rbp
+  8029d3:	48 89 e5             	mov    %rsp,%rbp
+  8029d6:	41 55                	push   %r13
+  8029d8:	41 54                	push   %r12
+  8029da:	53                   	push   %rbx
+  8029db:	48 81 ec b8 00 00 00 	sub    $0xb8,%rsp
+  8029e2:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8029e5:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  8029e9:	48 b8 4b 1c 80 00 00 	movabs $0x801c4b,%rax
+  8029f0:	00 00 00 
+  8029f3:	ff d0                	call   *%rax
+  8029f5:	89 c3                	mov    %eax,%ebx
+  8029f7:	85 c0                	test   %eax,%eax
+  8029f9:	0f 88 51 01 00 00    	js     802b50 <pipe+0x17e>
+        (res = fd_alloc_from(fd2num(fd0) + 1, &fd1)) < 0) goto err;
+  8029ff:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802a03:	48 b8 a4 1b 80 00 00 	movabs $0x801ba4,%rax
+  802a0a:	00 00 00 
+  802a0d:	ff d0                	call   *%rax
+  802a0f:	8d 78 01             	lea    0x1(%rax),%edi
+  802a12:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802a16:	48 b8 d2 1b 80 00 00 	movabs $0x801bd2,%rax
+  802a1d:	00 00 00 
+  802a20:	ff d0                	call   *%rax
+  802a22:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  802a24:	85 c0                	test   %eax,%eax
+  802a26:	0f 88 24 01 00 00    	js     802b50 <pipe+0x17e>
+    va = fd2data(fd0);
+  802a2c:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802a30:	48 bb b6 1b 80 00 00 	movabs $0x801bb6,%rbx
+  802a37:	00 00 00 
+  802a3a:	ff d3                	call   *%rbx
+  802a3c:	49 89 c5             	mov    %rax,%r13
+    struct RegionOp ops[] = {
+  802a3f:	48 8d bd 30 ff ff ff 	lea    -0xd0(%rbp),%rdi
+  802a46:	b9 14 00 00 00       	mov    $0x14,%ecx
+  802a4b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a50:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+  802a53:	c7 85 34 ff ff ff 46 	movl   $0x46,-0xcc(%rbp)
+  802a5a:	00 00 00 
+  802a5d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802a61:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+  802a68:	48 c7 85 50 ff ff ff 	movq   $0x1000,-0xb0(%rbp)
+  802a6f:	00 10 00 00 
+  802a73:	c7 85 5c ff ff ff 46 	movl   $0x46,-0xa4(%rbp)
+  802a7a:	00 00 00 
+            {.type = REGION_ALLOC, .dstva = (uintptr_t)fd1, .size = PAGE_SIZE, .perm = PROT_RW | PROT_SHARE},
+  802a7d:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+    struct RegionOp ops[] = {
+  802a81:	48 89 bd 70 ff ff ff 	mov    %rdi,-0x90(%rbp)
+  802a88:	48 c7 85 78 ff ff ff 	movq   $0x1000,-0x88(%rbp)
+  802a8f:	00 10 00 00 
+  802a93:	c7 45 84 46 00 00 00 	movl   $0x46,-0x7c(%rbp)
+  802a9a:	4c 89 6d 98          	mov    %r13,-0x68(%rbp)
+  802a9e:	48 c7 45 a0 00 10 00 	movq   $0x1000,-0x60(%rbp)
+  802aa5:	00 
+  802aa6:	c7 45 a8 01 00 00 00 	movl   $0x1,-0x58(%rbp)
+  802aad:	c7 45 ac 46 00 00 00 	movl   $0x46,-0x54(%rbp)
+  802ab4:	4c 89 6d b8          	mov    %r13,-0x48(%rbp)
+            {.type = REGION_MAP, .srcva = (uintptr_t)va, .dstva = (uintptr_t)fd2data(fd1), .size = PAGE_SIZE, .perm = PROT_RW | PROT_SHARE},
+  802ab8:	ff d3                	call   *%rbx
+    struct RegionOp ops[] = {
+  802aba:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802abe:	48 c7 45 c8 00 10 00 	movq   $0x1000,-0x38(%rbp)
+  802ac5:	00 
+    if ((res = sys_region_batch(ops, sizeof ops / sizeof *ops)) < 0) goto err1;
+  802ac6:	be 04 00 00 00       	mov    $0x4,%esi
+  802acb:	48 8d bd 30 ff ff ff 	lea    -0xd0(%rbp),%rdi
+  802ad2:	48 b8 70 15 80 00 00 	movabs $0x801570,%rax
+  802ad9:	00 00 00 
+  802adc:	ff d0                	call   *%rax
+  802ade:	89 c3                	mov    %eax,%ebx
+  802ae0:	85 c0                	test   %eax,%eax
+  802ae2:	0f 88 ad 00 00 00    	js     802b95 <pipe+0x1c3>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  802ae8:	be 00 10 00 00       	mov    $0x1000,%esi
+  802aed:	4c 89 ef             	mov    %r13,%rdi
+  802af0:	48 b8 df 13 80 00 00 	movabs $0x8013df,%rax
+  802af7:	00 00 00 
+  802afa:	ff d0                	call   *%rax
+  802afc:	83 f8 02             	cmp    $0x2,%eax
+  802aff:	75 5f                	jne    802b60 <pipe+0x18e>
+    fd0->fd_dev_id = devpipe.dev_id;
+  802b01:	a1 60 40 80 00 00 00 	movabs 0x804060,%eax
+  802b08:	00 00 
+  802b0a:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802b0e:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  802b10:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802b14:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  802b1b:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  802b1f:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  802b21:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802b25:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  802b2c:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802b30:	48 bb a4 1b 80 00 00 	movabs $0x801ba4,%rbx
+  802b37:	00 00 00 
+  802b3a:	ff d3                	call   *%rbx
+  802b3c:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  802b40:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  802b44:	ff d3                	call   *%rbx
+  802b46:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  802b4b:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  802b50:	89 d8                	mov    %ebx,%eax
+  802b52:	48 81 c4 b8 00 00 00 	add    $0xb8,%rsp
+  802b59:	5b                   	pop    %rbx
+  802b5a:	41 5c                	pop    %r12
+  802b5c:	41 5d                	pop    %r13
+  802b5e:	5d                   	pop    %rbp
+  802b5f:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  802b60:	48 b9 f0 38 80 00 00 	movabs $0x8038f0,%rcx
+  802b67:	00 00 00 
+  802b6a:	48 ba c7 38 80 00 00 	movabs $0x8038c7,%rdx
+  802b71:	00 00 00 
+  802b74:	be 33 00 00 00       	mov    $0x33,%esi
+  802b79:	48 bf dc 38 80 00 00 	movabs $0x8038dc,%rdi
+  802b80:	00 00 00 
+  802b83:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b88:	49 b8 18 04 80 00 00 	movabs $0x800418,%r8
+  802b8f:	00 00 00 
+  802b92:	41 ff d0             	call   *%r8
+        ops[i].type = REGION_UNMAP;
+  802b95:	c7 85 30 ff ff ff 02 	movl   $0x2,-0xd0(%rbp)
+  802b9c:	00 00 00 
+  802b9f:	c7 85 58 ff ff ff 02 	movl   $0x2,-0xa8(%rbp)
+  802ba6:	00 00 00 
+  802ba9:	c7 45 80 02 00 00 00 	movl   $0x2,-0x80(%rbp)
+  802bb0:	c7 45 a8 02 00 00 00 	movl   $0x2,-0x58(%rbp)
+    sys_region_batch(ops, sizeof ops / sizeof *ops);
+  802bb7:	be 04 00 00 00       	mov    $0x4,%esi
+  802bbc:	48 8d bd 30 ff ff ff 	lea    -0xd0(%rbp),%rdi
+  802bc3:	48 b8 70 15 80 00 00 	movabs $0x801570,%rax
+  802bca:	00 00 00 
+  802bcd:	ff d0                	call   *%rax
+  802bcf:	e9 7c ff ff ff       	jmp    802b50 <pipe+0x17e>
+
+0000000000802bd4 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  802bd4:	55                   	push   %rbp
+  802bd5:	48 89 e5             	mov    %rsp,%rbp
+  802bd8:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  802bdc:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802be0:	48 b8 65 1c 80 00 00 	movabs $0x801c65,%rax
+  802be7:	00 00 00 
+  802bea:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802bec:	85 c0                	test   %eax,%eax
+  802bee:	78 35                	js     802c25 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  802bf0:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802bf4:	48 b8 b6 1b 80 00 00 	movabs $0x801bb6,%rax
+  802bfb:	00 00 00 
+  802bfe:	ff d0                	call   *%rax
+  802c00:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802c03:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802c08:	be 00 10 00 00       	mov    $0x1000,%esi
+  802c0d:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802c11:	48 b8 11 14 80 00 00 	movabs $0x801411,%rax
+  802c18:	00 00 00 
+  802c1b:	ff d0                	call   *%rax
+  802c1d:	85 c0                	test   %eax,%eax
+  802c1f:	0f 94 c0             	sete   %al
+  802c22:	0f b6 c0             	movzbl %al,%eax
+}
+  802c25:	c9                   	leave
+  802c26:	c3                   	ret
+
+0000000000802c27 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  802c27:	48 89 f8             	mov    %rdi,%rax
+  802c2a:	48 c1 e8 27          	shr    $0x27,%rax
+  802c2e:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  802c35:	01 00 00 
+  802c38:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802c3c:	f6 c2 01             	test   $0x1,%dl
+  802c3f:	74 6d                	je     802cae <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  802c41:	48 89 f8             	mov    %rdi,%rax
+  802c44:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802c48:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802c4f:	01 00 00 
+  802c52:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802c56:	f6 c2 01             	test   $0x1,%dl
+  802c59:	74 62                	je     802cbd <get_uvpt_entry+0x96>
+  802c5b:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802c62:	01 00 00 
+  802c65:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802c69:	f6 c2 80             	test   $0x80,%dl
+  802c6c:	75 4f                	jne    802cbd <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  802c6e:	48 89 f8             	mov    %rdi,%rax
+  802c71:	48 c1 e8 15          	shr    $0x15,%rax
+  802c75:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802c7c:	01 00 00 
+  802c7f:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802c83:	f6 c2 01             	test   $0x1,%dl
+  802c86:	74 44                	je     802ccc <get_uvpt_entry+0xa5>
+  802c88:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802c8f:	01 00 00 
+  802c92:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802c96:	f6 c2 80             	test   $0x80,%dl
+  802c99:	75 31                	jne    802ccc <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  802c9b:	48 c1 ef 0c          	shr    $0xc,%rdi
+  802c9f:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802ca6:	01 00 00 
+  802ca9:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  802cad:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  802cae:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  802cb5:	01 00 00 
+  802cb8:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802cbc:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  802cbd:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802cc4:	01 00 00 
+  802cc7:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802ccb:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  802ccc:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802cd3:	01 00 00 
+  802cd6:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802cda:	c3                   	ret
+
+0000000000802cdb <get_prot>:
+
+int
+get_prot(void *va) {
+  802cdb:	55                   	push   %rbp
+  802cdc:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  802cdf:	48 b8 27 2c 80 00 00 	movabs $0x802c27,%rax
+  802ce6:	00 00 00 
+  802ce9:	ff d0                	call   *%rax
+  802ceb:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  802cee:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  802cf3:	89 c1                	mov    %eax,%ecx
+  802cf5:	83 c9 04             	or     $0x4,%ecx
+  802cf8:	f6 c2 01             	test   $0x1,%dl
+  802cfb:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  802cfe:	89 c1                	mov    %eax,%ecx
+  802d00:	83 c9 02             	or     $0x2,%ecx
+  802d03:	f6 c2 02             	test   $0x2,%dl
+  802d06:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  802d09:	89 c1                	mov    %eax,%ecx
+  802d0b:	83 c9 01             	or     $0x1,%ecx
+  802d0e:	48 85 d2             	test   %rdx,%rdx
+  802d11:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  802d14:	89 c1                	mov    %eax,%ecx
+  802d16:	83 c9 40             	or     $0x40,%ecx
+  802d19:	f6 c6 04             	test   $0x4,%dh
+  802d1c:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  802d1f:	5d                   	pop    %rbp
+  802d20:	c3                   	ret
+
+0000000000802d21 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  802d21:	55                   	push   %rbp
+  802d22:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  802d25:	48 b8 27 2c 80 00 00 	movabs $0x802c27,%rax
+  802d2c:	00 00 00 
+  802d2f:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  802d31:	48 c1 e8 06          	shr    $0x6,%rax
+  802d35:	83 e0 01             	and    $0x1,%eax
+}
+  802d38:	5d                   	pop    %rbp
+  802d39:	c3                   	ret
+
+0000000000802d3a <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  802d3a:	55                   	push   %rbp
+  802d3b:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  802d3e:	48 b8 27 2c 80 00 00 	movabs $0x802c27,%rax
+  802d45:	00 00 00 
+  802d48:	ff d0                	call   *%rax
+  802d4a:	83 e0 01             	and    $0x1,%eax
+}
+  802d4d:	5d                   	pop    %rbp
+  802d4e:	c3                   	ret
+
+0000000000802d4f <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  802d4f:	55                   	push   %rbp
+  802d50:	48 89 e5             	mov    %rsp,%rbp
+  802d53:	41 57                	push   %r15
+  802d55:	41 56                	push   %r14
+  802d57:	41 55                	push   %r13
+  802d59:	41 54                	push   %r12
+  802d5b:	53                   	push   %rbx
+  802d5c:	48 83 ec 38          	sub    $0x38,%rsp
+  802d60:	49 89 f7             	mov    %rsi,%r15
+  802d63:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+                    }
+                    continue;
+                }
+                for (int ptei = 0; ptei < PT_ENTRY_COUNT; ptei++) {
+                    uintptr_t pte_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, pdei, ptei, 0);
+                    pte_t pte = uvpt[VPT(pte_addr)];
+  802d69:	49 bd 00 00 00 00 00 	movabs $0x10000000000,%r13
+  802d70:	01 00 00 
+  802d73:	4d 89 e6             	mov    %r12,%r14
+  802d76:	49 89 fc             	mov    %rdi,%r12
+  802d79:	e9 19 01 00 00       	jmp    802e97 <foreach_shared_region+0x148>
+  802d7e:	48 89 5d b0          	mov    %rbx,-0x50(%rbp)
+  802d82:	4c 89 75 a8          	mov    %r14,-0x58(%rbp)
+  802d86:	eb 52                	jmp    802dda <foreach_shared_region+0x8b>
+                for (int ptei = 0; ptei < PT_ENTRY_COUNT; ptei++) {
+  802d88:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802d8f:	48 81 fb 00 00 20 00 	cmp    $0x200000,%rbx
+  802d96:	74 2e                	je     802dc6 <foreach_shared_region+0x77>
+                    uintptr_t pte_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, pdei, ptei, 0);
+  802d98:	48 89 df             	mov    %rbx,%rdi
+  802d9b:	4c 09 f7             	or     %r14,%rdi
+                    pte_t pte = uvpt[VPT(pte_addr)];
+  802d9e:	48 89 f8             	mov    %rdi,%rax
+  802da1:	48 c1 e8 0c          	shr    $0xc,%rax
+  802da5:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+                    if ((pte & PTE_P) && (pte & PTE_SHARE)) {
+  802daa:	25 01 04 00 00       	and    $0x401,%eax
+  802daf:	48 3d 01 04 00 00    	cmp    $0x401,%rax
+  802db5:	75 d1                	jne    802d88 <foreach_shared_region+0x39>
+                        fun((void*)pte_addr, (void*)(pte_addr + PAGE_SIZE), arg);
+  802db7:	48 8d b7 00 10 00 00 	lea    0x1000(%rdi),%rsi
+  802dbe:	4c 89 fa             	mov    %r15,%rdx
+  802dc1:	41 ff d4             	call   *%r12
+  802dc4:	eb c2                	jmp    802d88 <foreach_shared_region+0x39>
+            for (int pdei = 0; pdei < PD_ENTRY_COUNT; pdei++) {
+  802dc6:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  802dcd:	00 
+  802dce:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802dd2:	48 3d 00 00 00 40    	cmp    $0x40000000,%rax
+  802dd8:	74 46                	je     802e20 <foreach_shared_region+0xd1>
+                uintptr_t pde_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, pdei, 0, 0);
+  802dda:	4c 8b 75 c8          	mov    -0x38(%rbp),%r14
+  802dde:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802de2:	49 09 c6             	or     %rax,%r14
+                pde_t pde = uvpd[VPD(pde_addr)];
+  802de5:	4c 89 f0             	mov    %r14,%rax
+  802de8:	48 c1 e8 15          	shr    $0x15,%rax
+  802dec:	48 b9 00 00 00 80 00 	movabs $0x10080000000,%rcx
+  802df3:	01 00 00 
+  802df6:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+                if (!(pde & PTE_P)) {
+  802dfa:	a8 01                	test   $0x1,%al
+  802dfc:	74 c8                	je     802dc6 <foreach_shared_region+0x77>
+                if (pde & PTE_PS) {
+  802dfe:	48 89 c3             	mov    %rax,%rbx
+  802e01:	81 e3 80 00 00 00    	and    $0x80,%ebx
+  802e07:	74 8f                	je     802d98 <foreach_shared_region+0x49>
+                    if (pde & PTE_SHARE) {
+  802e09:	f6 c4 04             	test   $0x4,%ah
+  802e0c:	74 b8                	je     802dc6 <foreach_shared_region+0x77>
+                        fun((void*)pde_addr, (void*)(pde_addr + 1024 * 1024 * 2), arg);
+  802e0e:	49 8d b6 00 00 20 00 	lea    0x200000(%r14),%rsi
+  802e15:	4c 89 fa             	mov    %r15,%rdx
+  802e18:	4c 89 f7             	mov    %r14,%rdi
+  802e1b:	41 ff d4             	call   *%r12
+  802e1e:	eb a6                	jmp    802dc6 <foreach_shared_region+0x77>
+  802e20:	48 8b 5d b0          	mov    -0x50(%rbp),%rbx
+  802e24:	4c 8b 75 a8          	mov    -0x58(%rbp),%r14
+        for (int pdpei = 0; pdpei < PDP_ENTRY_COUNT; pdpei++) {
+  802e28:	48 81 c3 00 00 00 40 	add    $0x40000000,%rbx
+  802e2f:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802e36:	00 00 00 
+  802e39:	48 39 c3             	cmp    %rax,%rbx
+  802e3c:	74 4c                	je     802e8a <foreach_shared_region+0x13b>
+            uintptr_t pdpe_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, 0, 0, 0);
+  802e3e:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802e42:	48 09 d8             	or     %rbx,%rax
+  802e45:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+            pdpe_t pdpe = uvpdp[VPDP(pdpe_addr)];
+  802e49:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802e4d:	48 b9 00 00 40 80 00 	movabs $0x10080400000,%rcx
+  802e54:	01 00 00 
+  802e57:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+            if (!(pdpe & PTE_P)) {
+  802e5b:	a8 01                	test   $0x1,%al
+  802e5d:	74 c9                	je     802e28 <foreach_shared_region+0xd9>
+            if (pdpe & PTE_PS) {
+  802e5f:	48 89 c1             	mov    %rax,%rcx
+  802e62:	81 e1 80 00 00 00    	and    $0x80,%ecx
+  802e68:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  802e6c:	0f 84 0c ff ff ff    	je     802d7e <foreach_shared_region+0x2f>
+                if (pdpe & PTE_SHARE) {
+  802e72:	f6 c4 04             	test   $0x4,%ah
+  802e75:	74 b1                	je     802e28 <foreach_shared_region+0xd9>
+                    fun((void*)pdpe_addr, (void*)(pdpe_addr + 1024 * 1024 * 1024), arg); 
+  802e77:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  802e7b:	48 8d b7 00 00 00 40 	lea    0x40000000(%rdi),%rsi
+  802e82:	4c 89 fa             	mov    %r15,%rdx
+  802e85:	41 ff d4             	call   *%r12
+  802e88:	eb 9e                	jmp    802e28 <foreach_shared_region+0xd9>
+    for (int pml4ei = 0; pml4ei < PML4_ENTRY_COUNT; pml4ei++) {
+  802e8a:	49 83 c6 01          	add    $0x1,%r14
+  802e8e:	49 81 fe 00 02 00 00 	cmp    $0x200,%r14
+  802e95:	74 24                	je     802ebb <foreach_shared_region+0x16c>
+        pml4e_t pml4e = uvpml4[VPML4(pml4_addr)];
+  802e97:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  802e9e:	01 00 00 
+  802ea1:	4a 8b 04 f0          	mov    (%rax,%r14,8),%rax
+        if (!(pml4e & PTE_P)) {
+  802ea5:	a8 01                	test   $0x1,%al
+  802ea7:	74 e1                	je     802e8a <foreach_shared_region+0x13b>
+  802ea9:	4c 89 f0             	mov    %r14,%rax
+  802eac:	48 c1 e0 27          	shl    $0x27,%rax
+  802eb0:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  802eb4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802eb9:	eb 83                	jmp    802e3e <foreach_shared_region+0xef>
+            }
+        }
+    }
+    
+    return 0;
+}
+  802ebb:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ec0:	48 83 c4 38          	add    $0x38,%rsp
+  802ec4:	5b                   	pop    %rbx
+  802ec5:	41 5c                	pop    %r12
+  802ec7:	41 5d                	pop    %r13
+  802ec9:	41 5e                	pop    %r14
+  802ecb:	41 5f                	pop    %r15
+  802ecd:	5d                   	pop    %rbp
+  802ece:	c3                   	ret
+
+0000000000802ecf <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  802ecf:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ed4:	c3                   	ret
+
+0000000000802ed5 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  802ed5:	55                   	push   %rbp
+  802ed6:	48 89 e5             	mov    %rsp,%rbp
+  802ed9:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  802edc:	48 be 14 39 80 00 00 	movabs $0x803914,%rsi
+  802ee3:	00 00 00 
+  802ee6:	48 b8 8d 0e 80 00 00 	movabs $0x800e8d,%rax
+  802eed:	00 00 00 
+  802ef0:	ff d0                	call   *%rax
+    return 0;
+}
+  802ef2:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ef7:	5d                   	pop    %rbp
+  802ef8:	c3                   	ret
+
+0000000000802ef9 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  802ef9:	55                   	push   %rbp
+  802efa:	48 89 e5             	mov    %rsp,%rbp
+  802efd:	41 57                	push   %r15
+  802eff:	41 56                	push   %r14
+  802f01:	41 55                	push   %r13
+  802f03:	41 54                	push   %r12
+  802f05:	53                   	push   %rbx
+  802f06:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  802f0d:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  802f14:	48 85 d2             	test   %rdx,%rdx
+  802f17:	74 7a                	je     802f93 <devcons_write+0x9a>
+  802f19:	49 89 d6             	mov    %rdx,%r14
+  802f1c:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802f22:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  802f27:	49 bf 87 10 80 00 00 	movabs $0x801087,%r15
+  802f2e:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  802f31:	4c 89 f3             	mov    %r14,%rbx
+  802f34:	48 29 f3             	sub    %rsi,%rbx
+  802f37:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802f3c:	48 39 c3             	cmp    %rax,%rbx
+  802f3f:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  802f43:	4c 63 eb             	movslq %ebx,%r13
+  802f46:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  802f4d:	48 01 c6             	add    %rax,%rsi
+  802f50:	4c 89 ea             	mov    %r13,%rdx
+  802f53:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802f5a:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  802f5d:	4c 89 ee             	mov    %r13,%rsi
+  802f60:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802f67:	48 b8 b4 12 80 00 00 	movabs $0x8012b4,%rax
+  802f6e:	00 00 00 
+  802f71:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  802f73:	41 01 dc             	add    %ebx,%r12d
+  802f76:	49 63 f4             	movslq %r12d,%rsi
+  802f79:	4c 39 f6             	cmp    %r14,%rsi
+  802f7c:	72 b3                	jb     802f31 <devcons_write+0x38>
+    return res;
+  802f7e:	49 63 c4             	movslq %r12d,%rax
+}
+  802f81:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  802f88:	5b                   	pop    %rbx
+  802f89:	41 5c                	pop    %r12
+  802f8b:	41 5d                	pop    %r13
+  802f8d:	41 5e                	pop    %r14
+  802f8f:	41 5f                	pop    %r15
+  802f91:	5d                   	pop    %rbp
+  802f92:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  802f93:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802f99:	eb e3                	jmp    802f7e <devcons_write+0x85>
+
+0000000000802f9b <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  802f9b:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  802f9e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802fa3:	48 85 c0             	test   %rax,%rax
+  802fa6:	74 55                	je     802ffd <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  802fa8:	55                   	push   %rbp
+  802fa9:	48 89 e5             	mov    %rsp,%rbp
+  802fac:	41 55                	push   %r13
+  802fae:	41 54                	push   %r12
+  802fb0:	53                   	push   %rbx
+  802fb1:	48 83 ec 08          	sub    $0x8,%rsp
+  802fb5:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  802fb8:	48 bb e1 12 80 00 00 	movabs $0x8012e1,%rbx
+  802fbf:	00 00 00 
+  802fc2:	49 bc ae 13 80 00 00 	movabs $0x8013ae,%r12
+  802fc9:	00 00 00 
+  802fcc:	eb 03                	jmp    802fd1 <devcons_read+0x36>
+  802fce:	41 ff d4             	call   *%r12
+  802fd1:	ff d3                	call   *%rbx
+  802fd3:	85 c0                	test   %eax,%eax
+  802fd5:	74 f7                	je     802fce <devcons_read+0x33>
+    if (c < 0) return c;
+  802fd7:	48 63 d0             	movslq %eax,%rdx
+  802fda:	78 13                	js     802fef <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  802fdc:	ba 00 00 00 00       	mov    $0x0,%edx
+  802fe1:	83 f8 04             	cmp    $0x4,%eax
+  802fe4:	74 09                	je     802fef <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  802fe6:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  802fea:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  802fef:	48 89 d0             	mov    %rdx,%rax
+  802ff2:	48 83 c4 08          	add    $0x8,%rsp
+  802ff6:	5b                   	pop    %rbx
+  802ff7:	41 5c                	pop    %r12
+  802ff9:	41 5d                	pop    %r13
+  802ffb:	5d                   	pop    %rbp
+  802ffc:	c3                   	ret
+  802ffd:	48 89 d0             	mov    %rdx,%rax
+  803000:	c3                   	ret
+
+0000000000803001 <cputchar>:
+cputchar(int ch) {
+  803001:	55                   	push   %rbp
+  803002:	48 89 e5             	mov    %rsp,%rbp
+  803005:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  803009:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  80300d:	be 01 00 00 00       	mov    $0x1,%esi
+  803012:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  803016:	48 b8 b4 12 80 00 00 	movabs $0x8012b4,%rax
+  80301d:	00 00 00 
+  803020:	ff d0                	call   *%rax
+}
+  803022:	c9                   	leave
+  803023:	c3                   	ret
+
+0000000000803024 <getchar>:
+getchar(void) {
+  803024:	55                   	push   %rbp
+  803025:	48 89 e5             	mov    %rsp,%rbp
+  803028:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  80302c:	ba 01 00 00 00       	mov    $0x1,%edx
+  803031:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  803035:	bf 00 00 00 00       	mov    $0x0,%edi
+  80303a:	48 b8 48 1f 80 00 00 	movabs $0x801f48,%rax
+  803041:	00 00 00 
+  803044:	ff d0                	call   *%rax
+  803046:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  803048:	85 c0                	test   %eax,%eax
+  80304a:	78 06                	js     803052 <getchar+0x2e>
+  80304c:	74 08                	je     803056 <getchar+0x32>
+  80304e:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  803052:	89 d0                	mov    %edx,%eax
+  803054:	c9                   	leave
+  803055:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  803056:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  80305b:	eb f5                	jmp    803052 <getchar+0x2e>
+
+000000000080305d <iscons>:
+iscons(int fdnum) {
+  80305d:	55                   	push   %rbp
+  80305e:	48 89 e5             	mov    %rsp,%rbp
+  803061:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803065:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803069:	48 b8 65 1c 80 00 00 	movabs $0x801c65,%rax
+  803070:	00 00 00 
+  803073:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803075:	85 c0                	test   %eax,%eax
+  803077:	78 18                	js     803091 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  803079:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80307d:	48 b8 a0 40 80 00 00 	movabs $0x8040a0,%rax
+  803084:	00 00 00 
+  803087:	8b 00                	mov    (%rax),%eax
+  803089:	39 02                	cmp    %eax,(%rdx)
+  80308b:	0f 94 c0             	sete   %al
+  80308e:	0f b6 c0             	movzbl %al,%eax
+}
+  803091:	c9                   	leave
+  803092:	c3                   	ret
+
+0000000000803093 <opencons>:
+opencons(void) {
+  803093:	55                   	push   %rbp
+  803094:	48 89 e5             	mov    %rsp,%rbp
+  803097:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  80309b:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  80309f:	48 b8 4b 1c 80 00 00 	movabs $0x801c4b,%rax
+  8030a6:	00 00 00 
+  8030a9:	ff d0                	call   *%rax
+  8030ab:	85 c0                	test   %eax,%eax
+  8030ad:	78 49                	js     8030f8 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  8030af:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8030b4:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8030b9:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  8030bd:	bf 00 00 00 00       	mov    $0x0,%edi
+  8030c2:	48 b8 3d 14 80 00 00 	movabs $0x80143d,%rax
+  8030c9:	00 00 00 
+  8030cc:	ff d0                	call   *%rax
+  8030ce:	85 c0                	test   %eax,%eax
+  8030d0:	78 26                	js     8030f8 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  8030d2:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8030d6:	a1 a0 40 80 00 00 00 	movabs 0x8040a0,%eax
+  8030dd:	00 00 
+  8030df:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  8030e1:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8030e5:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  8030ec:	48 b8 a4 1b 80 00 00 	movabs $0x801ba4,%rax
+  8030f3:	00 00 00 
+  8030f6:	ff d0                	call   *%rax
+}
+  8030f8:	c9                   	leave
+  8030f9:	c3                   	ret
+  8030fa:	66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+
+0000000000803100 <__rodata_start>:
+  803100:	74 65                	je     803167 <__rodata_start+0x67>
+  803102:	73 74                	jae    803178 <__rodata_start+0x78>
+  803104:	69 6e 67 20 66 6f 72 	imul   $0x726f6620,0x67(%rsi),%ebp
+  80310b:	20 64 75 70          	and    %ah,0x70(%rbp,%rsi,2)
+  80310f:	20 72 61             	and    %dh,0x61(%rdx)
+  803112:	63 65 2e             	movsxd 0x2e(%rbp),%esp
+  803115:	2e 2e 0a 00          	cs cs or (%rax),%al
+  803119:	70 69                	jo     803184 <__rodata_start+0x84>
+  80311b:	70 65                	jo     803182 <__rodata_start+0x82>
+  80311d:	3a 20                	cmp    (%rax),%ah
+  80311f:	25 69 00 75 73       	and    $0x73750069,%eax
+  803124:	65 72 2f             	gs jb  803156 <__rodata_start+0x56>
+  803127:	74 65                	je     80318e <__rodata_start+0x8e>
+  803129:	73 74                	jae    80319f <__rodata_start+0x9f>
+  80312b:	70 69                	jo     803196 <__rodata_start+0x96>
+  80312d:	70 65                	jo     803194 <__rodata_start+0x94>
+  80312f:	72 61                	jb     803192 <__rodata_start+0x92>
+  803131:	63 65 2e             	movsxd 0x2e(%rbp),%esp
+  803134:	63 00                	movsxd (%rax),%eax
+  803136:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  803138:	72 6b                	jb     8031a5 <__rodata_start+0xa5>
+  80313a:	3a 20                	cmp    (%rax),%ah
+  80313c:	25 69 00 52 41       	and    $0x41520069,%eax
+  803141:	43                   	rex.XB
+  803142:	45 3a 20             	cmp    (%r8),%r12b
+  803145:	70 69                	jo     8031b0 <__rodata_start+0xb0>
+  803147:	70 65                	jo     8031ae <__rodata_start+0xae>
+  803149:	20 61 70             	and    %ah,0x70(%rcx)
+  80314c:	70 65                	jo     8031b3 <__rodata_start+0xb3>
+  80314e:	61                   	(bad)
+  80314f:	72 73                	jb     8031c4 <__rodata_start+0xc4>
+  803151:	20 63 6c             	and    %ah,0x6c(%rbx)
+  803154:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803155:	73 65                	jae    8031bc <__rodata_start+0xbc>
+  803157:	64 0a 00             	or     %fs:(%rax),%al
+  80315a:	70 69                	jo     8031c5 <__rodata_start+0xc5>
+  80315c:	64 20 69 73          	and    %ch,%fs:0x73(%rcx)
+  803160:	20 25 64 0a 00 6b    	and    %ah,0x6b000a64(%rip)        # 6b803bca <__bss_end+0x6affbbca>
+  803166:	69 64 20 69 73 20 25 	imul   $0x64252073,0x69(%rax,%riz,1),%esp
+  80316d:	64 
+  80316e:	0a 00                	or     (%rax),%al
+  803170:	63 68 69             	movsxd 0x69(%rax),%ebp
+  803173:	6c                   	insb   (%dx),%es:(%rdi)
+  803174:	64 20 64 6f 6e       	and    %ah,%fs:0x6e(%rdi,%rbp,2)
+  803179:	65 20 77 69          	and    %dh,%gs:0x69(%rdi)
+  80317d:	74 68                	je     8031e7 <__rodata_start+0xe7>
+  80317f:	20 6c 6f 6f          	and    %ch,0x6f(%rdi,%rbp,2)
+  803183:	70 0a                	jo     80318f <__rodata_start+0x8f>
+  803185:	00 63 61             	add    %ah,0x61(%rbx)
+  803188:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803189:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80318a:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80318b:	74 20                	je     8031ad <__rodata_start+0xad>
+  80318d:	6c                   	insb   (%dx),%es:(%rdi)
+  80318e:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80318f:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803190:	6b 20 75             	imul   $0x75,(%rax),%esp
+  803193:	70 20                	jo     8031b5 <__rodata_start+0xb5>
+  803195:	70 5b                	jo     8031f2 <__rodata_start+0xf2>
+  803197:	30 5d 3a             	xor    %bl,0x3a(%rbp)
+  80319a:	20 25 69 00 0a 63    	and    %ah,0x630a0069(%rip)        # 638a3209 <__bss_end+0x6309b209>
+  8031a0:	68 69 6c 64 20       	push   $0x20646c69
+  8031a5:	64 65 74 65          	fs gs je 80320e <__rodata_start+0x10e>
+  8031a9:	63 74 65 64          	movsxd 0x64(%rbp,%riz,2),%esi
+  8031ad:	20 72 61             	and    %dh,0x61(%rdx)
+  8031b0:	63 65 0a             	movsxd 0xa(%rbp),%esp
+  8031b3:	00 0f                	add    %cl,(%rdi)
+  8031b5:	1f                   	(bad)
+  8031b6:	40 00 73 6f          	add    %sil,0x6f(%rbx)
+  8031ba:	6d                   	insl   (%dx),%es:(%rdi)
+  8031bb:	65 68 6f 77 20 74    	gs push $0x7420776f
+  8031c1:	68 65 20 6f 74       	push   $0x746f2065
+  8031c6:	68 65 72 20 65       	push   $0x65207265
+  8031cb:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8031cc:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  8031d0:	20 70 5b             	and    %dh,0x5b(%rax)
+  8031d3:	30 5d 20             	xor    %bl,0x20(%rbp)
+  8031d6:	67 6f                	outsl  %ds:(%esi),(%dx)
+  8031d8:	74 20                	je     8031fa <__rodata_start+0xfa>
+  8031da:	63 6c 6f 73          	movsxd 0x73(%rdi,%rbp,2),%ebp
+  8031de:	65 64 21 00          	gs and %eax,%fs:(%rax)
+  8031e2:	00 00                	add    %al,(%rax)
+  8031e4:	00 00                	add    %al,(%rax)
+  8031e6:	00 00                	add    %al,(%rax)
+  8031e8:	0a 72 61             	or     0x61(%rdx),%dh
+  8031eb:	63 65 20             	movsxd 0x20(%rbp),%esp
+  8031ee:	64 69 64 6e 27 74 20 	imul   $0x61682074,%fs:0x27(%rsi,%rbp,2),%esp
+  8031f5:	68 61 
+  8031f7:	70 70                	jo     803269 <__rodata_start+0x169>
+  8031f9:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  8031fb:	20 28                	and    %ch,(%rax)
+  8031fd:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8031fe:	75 6d                	jne    80326d <__rodata_start+0x16d>
+  803200:	62 65                	(bad)
+  803202:	72 20                	jb     803224 <__rodata_start+0x124>
+  803204:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803205:	66 20 74 65 73       	data16 and %dh,0x73(%rbp,%riz,2)
+  80320a:	74 73                	je     80327f <__rodata_start+0x17f>
+  80320c:	3a 20                	cmp    (%rax),%ah
+  80320e:	25 64 29 0a 00       	and    $0xa2964,%eax
+  803213:	3c 75                	cmp    $0x75,%al
+  803215:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803216:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  80321a:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80321b:	3e 00 0f             	ds add %cl,(%rdi)
+  80321e:	1f                   	(bad)
+  80321f:	00 5b 25             	add    %bl,0x25(%rbx)
+  803222:	30 38                	xor    %bh,(%rax)
+  803224:	78 5d                	js     803283 <__rodata_start+0x183>
+  803226:	20 75 73             	and    %dh,0x73(%rbp)
+  803229:	65 72 20             	gs jb  80324c <__rodata_start+0x14c>
+  80322c:	70 61                	jo     80328f <__rodata_start+0x18f>
+  80322e:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80322f:	69 63 20 69 6e 20 25 	imul   $0x25206e69,0x20(%rbx),%esp
+  803236:	73 20                	jae    803258 <__rodata_start+0x158>
+  803238:	61                   	(bad)
+  803239:	74 20                	je     80325b <__rodata_start+0x15b>
+  80323b:	25 73 3a 25 64       	and    $0x64253a73,%eax
+  803240:	3a 20                	cmp    (%rax),%ah
+  803242:	00 30                	add    %dh,(%rax)
+  803244:	31 32                	xor    %esi,(%rdx)
+  803246:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  80324d:	41                   	rex.B
+  80324e:	42                   	rex.X
+  80324f:	43                   	rex.XB
+  803250:	44                   	rex.R
+  803251:	45                   	rex.RB
+  803252:	46 00 30             	rex.RX add %r14b,(%rax)
+  803255:	31 32                	xor    %esi,(%rdx)
+  803257:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  80325e:	61                   	(bad)
+  80325f:	62 63 64 65 66       	(bad)
+  803264:	00 28                	add    %ch,(%rax)
+  803266:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803267:	75 6c                	jne    8032d5 <__rodata_start+0x1d5>
+  803269:	6c                   	insb   (%dx),%es:(%rdi)
+  80326a:	29 00                	sub    %eax,(%rax)
+  80326c:	65 72 72             	gs jb  8032e1 <__rodata_start+0x1e1>
+  80326f:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803270:	72 20                	jb     803292 <__rodata_start+0x192>
+  803272:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  803277:	73 70                	jae    8032e9 <__rodata_start+0x1e9>
+  803279:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  80327d:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  803284:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803285:	72 00                	jb     803287 <__rodata_start+0x187>
+  803287:	62 61 64 20 65       	(bad)
+  80328c:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80328d:	76 69                	jbe    8032f8 <__rodata_start+0x1f8>
+  80328f:	72 6f                	jb     803300 <__rodata_start+0x200>
+  803291:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803292:	6d                   	insl   (%dx),%es:(%rdi)
+  803293:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803295:	74 00                	je     803297 <__rodata_start+0x197>
+  803297:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  80329e:	20 70 61             	and    %dh,0x61(%rax)
+  8032a1:	72 61                	jb     803304 <__rodata_start+0x204>
+  8032a3:	6d                   	insl   (%dx),%es:(%rdi)
+  8032a4:	65 74 65             	gs je  80330c <__rodata_start+0x20c>
+  8032a7:	72 00                	jb     8032a9 <__rodata_start+0x1a9>
+  8032a9:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8032aa:	75 74                	jne    803320 <__rodata_start+0x220>
+  8032ac:	20 6f 66             	and    %ch,0x66(%rdi)
+  8032af:	20 6d 65             	and    %ch,0x65(%rbp)
+  8032b2:	6d                   	insl   (%dx),%es:(%rdi)
+  8032b3:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8032b4:	72 79                	jb     80332f <__rodata_start+0x22f>
+  8032b6:	00 6f 75             	add    %ch,0x75(%rdi)
+  8032b9:	74 20                	je     8032db <__rodata_start+0x1db>
+  8032bb:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8032bc:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  8032c0:	76 69                	jbe    80332b <__rodata_start+0x22b>
+  8032c2:	72 6f                	jb     803333 <__rodata_start+0x233>
+  8032c4:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8032c5:	6d                   	insl   (%dx),%es:(%rdi)
+  8032c6:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  8032c8:	74 73                	je     80333d <__rodata_start+0x23d>
+  8032ca:	00 63 6f             	add    %ah,0x6f(%rbx)
+  8032cd:	72 72                	jb     803341 <__rodata_start+0x241>
+  8032cf:	75 70                	jne    803341 <__rodata_start+0x241>
+  8032d1:	74 65                	je     803338 <__rodata_start+0x238>
+  8032d3:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  8032d8:	75 67                	jne    803341 <__rodata_start+0x241>
+  8032da:	20 69 6e             	and    %ch,0x6e(%rcx)
+  8032dd:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  8032df:	00 73 65             	add    %dh,0x65(%rbx)
+  8032e2:	67 6d                	insl   (%dx),%es:(%edi)
+  8032e4:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  8032e6:	74 61                	je     803349 <__rodata_start+0x249>
+  8032e8:	74 69                	je     803353 <__rodata_start+0x253>
+  8032ea:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8032eb:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8032ec:	20 66 61             	and    %ah,0x61(%rsi)
+  8032ef:	75 6c                	jne    80335d <__rodata_start+0x25d>
+  8032f1:	74 00                	je     8032f3 <__rodata_start+0x1f3>
+  8032f3:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  8032fa:	20 45 4c             	and    %al,0x4c(%rbp)
+  8032fd:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  803301:	61                   	(bad)
+  803302:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  803307:	20 73 75             	and    %dh,0x75(%rbx)
+  80330a:	63 68 20             	movsxd 0x20(%rax),%ebp
+  80330d:	73 79                	jae    803388 <__rodata_start+0x288>
+  80330f:	73 74                	jae    803385 <__rodata_start+0x285>
+  803311:	65 6d                	gs insl (%dx),%es:(%rdi)
+  803313:	20 63 61             	and    %ah,0x61(%rbx)
+  803316:	6c                   	insb   (%dx),%es:(%rdi)
+  803317:	6c                   	insb   (%dx),%es:(%rdi)
+  803318:	00 65 6e             	add    %ah,0x6e(%rbp)
+  80331b:	74 72                	je     80338f <__rodata_start+0x28f>
+  80331d:	79 20                	jns    80333f <__rodata_start+0x23f>
+  80331f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803320:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803321:	74 20                	je     803343 <__rodata_start+0x243>
+  803323:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  803325:	75 6e                	jne    803395 <__rodata_start+0x295>
+  803327:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  80332b:	76 20                	jbe    80334d <__rodata_start+0x24d>
+  80332d:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  803334:	72 65                	jb     80339b <__rodata_start+0x29b>
+  803336:	63 76 69             	movsxd 0x69(%rsi),%esi
+  803339:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80333a:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  80333e:	65 78 70             	gs js  8033b1 <__rodata_start+0x2b1>
+  803341:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  803346:	20 65 6e             	and    %ah,0x6e(%rbp)
+  803349:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  80334d:	20 66 69             	and    %ah,0x69(%rsi)
+  803350:	6c                   	insb   (%dx),%es:(%rdi)
+  803351:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  803355:	20 66 72             	and    %ah,0x72(%rsi)
+  803358:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  80335d:	61                   	(bad)
+  80335e:	63 65 20             	movsxd 0x20(%rbp),%esp
+  803361:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803362:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803363:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  803367:	6b 00 74             	imul   $0x74,(%rax),%eax
+  80336a:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80336b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80336c:	20 6d 61             	and    %ch,0x61(%rbp)
+  80336f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803370:	79 20                	jns    803392 <__rodata_start+0x292>
+  803372:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  803379:	72 65                	jb     8033e0 <__rodata_start+0x2e0>
+  80337b:	20 6f 70             	and    %ch,0x70(%rdi)
+  80337e:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803380:	00 66 69             	add    %ah,0x69(%rsi)
+  803383:	6c                   	insb   (%dx),%es:(%rdi)
+  803384:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  803388:	20 62 6c             	and    %ah,0x6c(%rdx)
+  80338b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80338c:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  80338f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803390:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803391:	74 20                	je     8033b3 <__rodata_start+0x2b3>
+  803393:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  803395:	75 6e                	jne    803405 <__rodata_start+0x305>
+  803397:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  80339b:	76 61                	jbe    8033fe <__rodata_start+0x2fe>
+  80339d:	6c                   	insb   (%dx),%es:(%rdi)
+  80339e:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  8033a5:	00 
+  8033a6:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  8033ad:	72 65                	jb     803414 <__rodata_start+0x314>
+  8033af:	61                   	(bad)
+  8033b0:	64 79 20             	fs jns 8033d3 <__rodata_start+0x2d3>
+  8033b3:	65 78 69             	gs js  80341f <__rodata_start+0x31f>
+  8033b6:	73 74                	jae    80342c <__rodata_start+0x32c>
+  8033b8:	73 00                	jae    8033ba <__rodata_start+0x2ba>
+  8033ba:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8033bb:	70 65                	jo     803422 <__rodata_start+0x322>
+  8033bd:	72 61                	jb     803420 <__rodata_start+0x320>
+  8033bf:	74 69                	je     80342a <__rodata_start+0x32a>
+  8033c1:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8033c2:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8033c3:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  8033c6:	74 20                	je     8033e8 <__rodata_start+0x2e8>
+  8033c8:	73 75                	jae    80343f <__rodata_start+0x33f>
+  8033ca:	70 70                	jo     80343c <__rodata_start+0x33c>
+  8033cc:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8033cd:	72 74                	jb     803443 <__rodata_start+0x343>
+  8033cf:	65 64 00 6f 70       	gs add %ch,%fs:0x70(%rdi)
+  8033d4:	65 72 61             	gs jb  803438 <__rodata_start+0x338>
+  8033d7:	74 69                	je     803442 <__rodata_start+0x342>
+  8033d9:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8033da:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8033db:	20 69 6e             	and    %ch,0x6e(%rcx)
+  8033de:	74 65                	je     803445 <__rodata_start+0x345>
+  8033e0:	72 72                	jb     803454 <__rodata_start+0x354>
+  8033e2:	75 70                	jne    803454 <__rodata_start+0x354>
+  8033e4:	74 65                	je     80344b <__rodata_start+0x34b>
+  8033e6:	64 00 6e 6f          	add    %ch,%fs:0x6f(%rsi)
+  8033ea:	74 20                	je     80340c <__rodata_start+0x30c>
+  8033ec:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  8033ee:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8033ef:	75 67                	jne    803458 <__rodata_start+0x358>
+  8033f1:	68 20 43 50 55       	push   $0x55504320
+  8033f6:	20 74 69 6d          	and    %dh,0x6d(%rcx,%rbp,2)
+  8033fa:	65 00 0f             	add    %cl,%gs:(%rdi)
+  8033fd:	1f                   	(bad)
+  8033fe:	40 00 55 07          	rex add %dl,0x7(%rbp)
+  803402:	80 00 00             	addb   $0x0,(%rax)
+  803405:	00 00                	add    %al,(%rax)
+  803407:	00 96 0d 80 00 00    	add    %dl,0x800d(%rsi)
+  80340d:	00 00                	add    %al,(%rax)
+  80340f:	00 86 0d 80 00 00    	add    %al,0x800d(%rsi)
+  803415:	00 00                	add    %al,(%rax)
+  803417:	00 96 0d 80 00 00    	add    %dl,0x800d(%rsi)
+  80341d:	00 00                	add    %al,(%rax)
+  80341f:	00 96 0d 80 00 00    	add    %dl,0x800d(%rsi)
+  803425:	00 00                	add    %al,(%rax)
+  803427:	00 96 0d 80 00 00    	add    %dl,0x800d(%rsi)
+  80342d:	00 00                	add    %al,(%rax)
+  80342f:	00 96 0d 80 00 00    	add    %dl,0x800d(%rsi)
+  803435:	00 00                	add    %al,(%rax)
+  803437:	00 74 07 80          	add    %dh,-0x80(%rdi,%rax,1)
+  80343b:	00 00                	add    %al,(%rax)
+  80343d:	00 00                	add    %al,(%rax)
+  80343f:	00 96 0d 80 00 00    	add    %dl,0x800d(%rsi)
+  803445:	00 00                	add    %al,(%rax)
+  803447:	00 96 0d 80 00 00    	add    %dl,0x800d(%rsi)
+  80344d:	00 00                	add    %al,(%rax)
+  80344f:	00 68 07             	add    %ch,0x7(%rax)
+  803452:	80 00 00             	addb   $0x0,(%rax)
+  803455:	00 00                	add    %al,(%rax)
+  803457:	00 e2                	add    %ah,%dl
+  803459:	07                   	(bad)
+  80345a:	80 00 00             	addb   $0x0,(%rax)
+  80345d:	00 00                	add    %al,(%rax)
+  80345f:	00 96 0d 80 00 00    	add    %dl,0x800d(%rsi)
+  803465:	00 00                	add    %al,(%rax)
+  803467:	00 68 07             	add    %ch,0x7(%rax)
+  80346a:	80 00 00             	addb   $0x0,(%rax)
+  80346d:	00 00                	add    %al,(%rax)
+  80346f:	00 ae 07 80 00 00    	add    %ch,0x8007(%rsi)
+  803475:	00 00                	add    %al,(%rax)
+  803477:	00 ae 07 80 00 00    	add    %ch,0x8007(%rsi)
+  80347d:	00 00                	add    %al,(%rax)
+  80347f:	00 ae 07 80 00 00    	add    %ch,0x8007(%rsi)
+  803485:	00 00                	add    %al,(%rax)
+  803487:	00 ae 07 80 00 00    	add    %ch,0x8007(%rsi)
+  80348d:	00 00                	add    %al,(%rax)
+  80348f:	00 ae 07 80 00 00    	add    %ch,0x8007(%rsi)
+  803495:	00 00                	add    %al,(%rax)
+  803497:	00 ae 07 80 00 00    	add    %ch,0x8007(%rsi)
+  80349d:	00 00                	add    %al,(%rax)
+  80349f:	00 ae 07 80 00 00    	add    %ch,0x8007(%rsi)
+  8034a5:	00 00                	add    %al,(%rax)
+  8034a7:	00 ae 07 80 00 00    	add    %ch,0x8007(%rsi)
+  8034ad:	00 00                	add    %al,(%rax)
+  8034af:	00 ae 07 80 00 00    	add    %ch,0x8007(%rsi)
+  8034b5:	00 00                	add    %al,(%rax)
+  8034b7:	00 96 0d 80 00 00    	add    %dl,0x800d(%rsi)
+  8034bd:	00 00                	add    %al,(%rax)
+  8034bf:	00 96 0d 80 00 00    	add    %dl,0x800d(%rsi)
+  8034c5:	00 00                	add    %al,(%rax)
+  8034c7:	00 96 0d 80 00 00    	add    %dl,0x800d(%rsi)
+  8034cd:	00 00                	add    %al,(%rax)
+  8034cf:	00 96 0d 80 00 00    	add    %dl,0x800d(%rsi)
+  8034d5:	00 00                	add    %al,(%rax)
+  8034d7:	00 96 0d 80 00 00    	add    %dl,0x800d(%rsi)
+  8034dd:	00 00                	add    %al,(%rax)
+  8034df:	00 96 0d 80 00 00    	add    %dl,0x800d(%rsi)
+  8034e5:	00 00                	add    %al,(%rax)
+  8034e7:	00 96 0d 80 00 00    	add    %dl,0x800d(%rsi)
+  8034ed:	00 00                	add    %al,(%rax)
+  8034ef:	00 96 0d 80 00 00    	add    %dl,0x800d(%rsi)
+  8034f5:	00 00                	add    %al,(%rax)
+  8034f7:	00 96 0d 80 00 00    	add    %dl,0x800d(%rsi)
+  8034fd:	00 00                	add    %al,(%rax)
+  8034ff:	00 96 0d 80 00 00    	add    %dl,0x800d(%rsi)
+  803505:	00 00                	add    %al,(%rax)
+  803507:	00 96 0d 80 00 00    	add    %dl,0x800d(%rsi)
+  80350d:	00 00                	add    %al,(%rax)
+  80350f:	00 96 0d 80 00 00    	add    %dl,0x800d(%rsi)
+  803515:	00 00                	add    %al,(%rax)
+  803517:	00 96 0d 80 00 00    	add    %dl,0x800d(%rsi)
+  80351d:	00 00                	add    %al,(%rax)
+  80351f:	00 96 0d 80 00 00    	add    %dl,0x800d(%rsi)
+  803525:	00 00                	add    %al,(%rax)
+  803527:	00 96 0d 80 00 00    	add    %dl,0x800d(%rsi)
+  80352d:	00 00                	add    %al,(%rax)
+  80352f:	00 96 0d 80 00 00    	add    %dl,0x800d(%rsi)
+  803535:	00 00                	add    %al,(%rax)
+  803537:	00 96 0d 80 00 00    	add    %dl,0x800d(%rsi)
+  80353d:	00 00                	add    %al,(%rax)
+  80353f:	00 96 0d 80 00 00    	add    %dl,0x800d(%rsi)
+  803545:	00 00                	add    %al,(%rax)
+  803547:	00 96 0d 80 00 00    	add    %dl,0x800d(%rsi)
+  80354d:	00 00                	add    %al,(%rax)
+  80354f:	00 96 0d 80 00 00    	add    %dl,0x800d(%rsi)
+  803555:	00 00                	add    %al,(%rax)
+  803557:	00 96 0d 80 00 00    	add    %dl,0x800d(%rsi)
+  80355d:	00 00                	add    %al,(%rax)
+  80355f:	00 96 0d 80 00 00    	add    %dl,0x800d(%rsi)
+  803565:	00 00                	add    %al,(%rax)
+  803567:	00 96 0d 80 00 00    	add    %dl,0x800d(%rsi)
+  80356d:	00 00                	add    %al,(%rax)
+  80356f:	00 96 0d 80 00 00    	add    %dl,0x800d(%rsi)
+  803575:	00 00                	add    %al,(%rax)
+  803577:	00 96 0d 80 00 00    	add    %dl,0x800d(%rsi)
+  80357d:	00 00                	add    %al,(%rax)
+  80357f:	00 96 0d 80 00 00    	add    %dl,0x800d(%rsi)
+  803585:	00 00                	add    %al,(%rax)
+  803587:	00 96 0d 80 00 00    	add    %dl,0x800d(%rsi)
+  80358d:	00 00                	add    %al,(%rax)
+  80358f:	00 96 0d 80 00 00    	add    %dl,0x800d(%rsi)
+  803595:	00 00                	add    %al,(%rax)
+  803597:	00 96 0d 80 00 00    	add    %dl,0x800d(%rsi)
+  80359d:	00 00                	add    %al,(%rax)
+  80359f:	00 96 0d 80 00 00    	add    %dl,0x800d(%rsi)
+  8035a5:	00 00                	add    %al,(%rax)
+  8035a7:	00 b9 0c 80 00 00    	add    %bh,0x800c(%rcx)
+  8035ad:	00 00                	add    %al,(%rax)
+  8035af:	00 96 0d 80 00 00    	add    %dl,0x800d(%rsi)
+  8035b5:	00 00                	add    %al,(%rax)
+  8035b7:	00 96 0d 80 00 00    	add    %dl,0x800d(%rsi)
+  8035bd:	00 00                	add    %al,(%rax)
+  8035bf:	00 96 0d 80 00 00    	add    %dl,0x800d(%rsi)
+  8035c5:	00 00                	add    %al,(%rax)
+  8035c7:	00 96 0d 80 00 00    	add    %dl,0x800d(%rsi)
+  8035cd:	00 00                	add    %al,(%rax)
+  8035cf:	00 96 0d 80 00 00    	add    %dl,0x800d(%rsi)
+  8035d5:	00 00                	add    %al,(%rax)
+  8035d7:	00 96 0d 80 00 00    	add    %dl,0x800d(%rsi)
+  8035dd:	00 00                	add    %al,(%rax)
+  8035df:	00 96 0d 80 00 00    	add    %dl,0x800d(%rsi)
+  8035e5:	00 00                	add    %al,(%rax)
+  8035e7:	00 96 0d 80 00 00    	add    %dl,0x800d(%rsi)
+  8035ed:	00 00                	add    %al,(%rax)
+  8035ef:	00 96 0d 80 00 00    	add    %dl,0x800d(%rsi)
+  8035f5:	00 00                	add    %al,(%rax)
+  8035f7:	00 96 0d 80 00 00    	add    %dl,0x800d(%rsi)
+  8035fd:	00 00                	add    %al,(%rax)
+  8035ff:	00 05 08 80 00 00    	add    %al,0x8008(%rip)        # 80b60d <__bss_end+0x360d>
+  803605:	00 00                	add    %al,(%rax)
+  803607:	00 d4                	add    %dl,%ah
+  803609:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  80360f:	00 96 0d 80 00 00    	add    %dl,0x800d(%rsi)
+  803615:	00 00                	add    %al,(%rax)
+  803617:	00 96 0d 80 00 00    	add    %dl,0x800d(%rsi)
+  80361d:	00 00                	add    %al,(%rax)
+  80361f:	00 96 0d 80 00 00    	add    %dl,0x800d(%rsi)
+  803625:	00 00                	add    %al,(%rax)
+  803627:	00 96 0d 80 00 00    	add    %dl,0x800d(%rsi)
+  80362d:	00 00                	add    %al,(%rax)
+  80362f:	00 34 08             	add    %dh,(%rax,%rcx,1)
+  803632:	80 00 00             	addb   $0x0,(%rax)
+  803635:	00 00                	add    %al,(%rax)
+  803637:	00 96 0d 80 00 00    	add    %dl,0x800d(%rsi)
+  80363d:	00 00                	add    %al,(%rax)
+  80363f:	00 96 0d 80 00 00    	add    %dl,0x800d(%rsi)
+  803645:	00 00                	add    %al,(%rax)
+  803647:	00 fa                	add    %bh,%dl
+  803649:	07                   	(bad)
+  80364a:	80 00 00             	addb   $0x0,(%rax)
+  80364d:	00 00                	add    %al,(%rax)
+  80364f:	00 96 0d 80 00 00    	add    %dl,0x800d(%rsi)
+  803655:	00 00                	add    %al,(%rax)
+  803657:	00 96 0d 80 00 00    	add    %dl,0x800d(%rsi)
+  80365d:	00 00                	add    %al,(%rax)
+  80365f:	00 7c 0b 80          	add    %bh,-0x80(%rbx,%rcx,1)
+  803663:	00 00                	add    %al,(%rax)
+  803665:	00 00                	add    %al,(%rax)
+  803667:	00 46 0c             	add    %al,0xc(%rsi)
+  80366a:	80 00 00             	addb   $0x0,(%rax)
+  80366d:	00 00                	add    %al,(%rax)
+  80366f:	00 96 0d 80 00 00    	add    %dl,0x800d(%rsi)
+  803675:	00 00                	add    %al,(%rax)
+  803677:	00 96 0d 80 00 00    	add    %dl,0x800d(%rsi)
+  80367d:	00 00                	add    %al,(%rax)
+  80367f:	00 cb                	add    %cl,%bl
+  803681:	08 80 00 00 00 00    	or     %al,0x0(%rax)
+  803687:	00 96 0d 80 00 00    	add    %dl,0x800d(%rsi)
+  80368d:	00 00                	add    %al,(%rax)
+  80368f:	00 a8 0a 80 00 00    	add    %ch,0x800a(%rax)
+  803695:	00 00                	add    %al,(%rax)
+  803697:	00 96 0d 80 00 00    	add    %dl,0x800d(%rsi)
+  80369d:	00 00                	add    %al,(%rax)
+  80369f:	00 96 0d 80 00 00    	add    %dl,0x800d(%rsi)
+  8036a5:	00 00                	add    %al,(%rax)
+  8036a7:	00 b9 0c 80 00 00    	add    %bh,0x800c(%rcx)
+  8036ad:	00 00                	add    %al,(%rax)
+  8036af:	00 96 0d 80 00 00    	add    %dl,0x800d(%rsi)
+  8036b5:	00 00                	add    %al,(%rax)
+  8036b7:	00 5e 07             	add    %bl,0x7(%rsi)
+  8036ba:	80 00 00             	addb   $0x0,(%rax)
+  8036bd:	00 00                	add    %al,(%rax)
+	...
+
+00000000008036c0 <error_string>:
+	...
+  8036c8:	75 32 80 00 00 00 00 00 87 32 80 00 00 00 00 00     u2.......2......
+  8036d8:	97 32 80 00 00 00 00 00 a9 32 80 00 00 00 00 00     .2.......2......
+  8036e8:	b7 32 80 00 00 00 00 00 cb 32 80 00 00 00 00 00     .2.......2......
+  8036f8:	e0 32 80 00 00 00 00 00 f3 32 80 00 00 00 00 00     .2.......2......
+  803708:	05 33 80 00 00 00 00 00 19 33 80 00 00 00 00 00     .3.......3......
+  803718:	29 33 80 00 00 00 00 00 3c 33 80 00 00 00 00 00     )3......<3......
+  803728:	53 33 80 00 00 00 00 00 69 33 80 00 00 00 00 00     S3......i3......
+  803738:	81 33 80 00 00 00 00 00 99 33 80 00 00 00 00 00     .3.......3......
+  803748:	a6 33 80 00 00 00 00 00 70 37 80 00 00 00 00 00     .3......p7......
+  803758:	ba 33 80 00 00 00 00 00 d2 33 80 00 00 00 00 00     .3.......3......
+  803768:	e8 33 80 00 00 00 00 00 66 69 6c 65 20 69 73 20     .3......file is 
+  803778:	6e 6f 74 20 61 20 76 61 6c 69 64 20 65 78 65 63     not a valid exec
+  803788:	75 74 61 62 6c 65 00 90 73 79 73 63 61 6c 6c 20     utable..syscall 
+  803798:	25 7a 64 20 72 65 74 75 72 6e 65 64 20 25 7a 64     %zd returned %zd
+  8037a8:	20 28 3e 20 30 29 00 6c 69 62 2f 73 79 73 63 61      (> 0).lib/sysca
+  8037b8:	6c 6c 2e 63 00 46 6f 72 6b 20 64 6f 75 62 6c 65     ll.c.Fork double
+  8037c8:	20 66 61 75 6c 74 00 6c 69 62 2f 66 6f 72 6b 2e      fault.lib/fork.
+  8037d8:	63 00 73 66 6f 72 6b 28 29 20 69 73 20 6e 6f 74     c.sfork() is not
+  8037e8:	20 69 6d 70 6c 65 6d 65 6e 74 65 64 00 73 79 73      implemented.sys
+  8037f8:	5f 69 70 63 5f 74 72 79 5f 73 65 6e 64 20 66 61     _ipc_try_send fa
+  803808:	69 6c 65 64 3a 20 25 69 00 6c 69 62 2f 69 70 63     iled: %i.lib/ipc
+  803818:	2e 63 00 0f 1f 44 00 00 5b 25 30 38 78 5d 20 75     .c...D..[%08x] u
+  803828:	6e 6b 6e 6f 77 6e 20 64 65 76 69 63 65 20 74 79     nknown device ty
+  803838:	70 65 20 25 64 0a 00 00 5b 25 30 38 78 5d 20 66     pe %d...[%08x] f
+  803848:	74 72 75 6e 63 61 74 65 20 25 64 20 2d 2d 20 62     truncate %d -- b
+  803858:	61 64 20 6d 6f 64 65 0a 00 5b 25 30 38 78 5d 20     ad mode..[%08x] 
+  803868:	72 65 61 64 20 25 64 20 2d 2d 20 62 61 64 20 6d     read %d -- bad m
+  803878:	6f 64 65 0a 00 5b 25 30 38 78 5d 20 77 72 69 74     ode..[%08x] writ
+  803888:	65 20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65     e %d -- bad mode
+  803898:	0a 00 66 0f 1f 44 00 00                             ..f..D..
+
+00000000008038a0 <devtab>:
+  8038a0:	20 40 80 00 00 00 00 00 60 40 80 00 00 00 00 00      @......`@......
+  8038b0:	a0 40 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .@..............
+  8038c0:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  8038d0:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  8038e0:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  8038f0:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  803900:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  803910:	3d 20 32 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73 00     = 2.<cons>.cons.
+  803920:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803930:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803940:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803950:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803960:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803970:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803980:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803990:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8039a0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8039b0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8039c0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8039d0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8039e0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8039f0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803a00:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803a10:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803a20:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803a30:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803a40:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803a50:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803a60:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803a70:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803a80:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803a90:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803aa0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803ab0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803ac0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803ad0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803ae0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803af0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803b00:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803b10:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803b20:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803b30:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803b40:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803b50:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803b60:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803b70:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803b80:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803b90:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803ba0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803bb0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803bc0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803bd0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803be0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803bf0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803c00:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803c10:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803c20:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803c30:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803c40:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803c50:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803c60:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803c70:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803c80:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803c90:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803ca0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803cb0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803cc0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803cd0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803ce0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803cf0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803d00:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803d10:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803d20:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803d30:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803d40:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803d50:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803d60:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803d70:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803d80:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803d90:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803da0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803db0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803dc0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803dd0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803de0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803df0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803e00:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803e10:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803e20:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803e30:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803e40:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803e50:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803e60:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803e70:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803e80:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803e90:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803ea0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803eb0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803ec0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803ed0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803ee0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803ef0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803f00:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803f10:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803f20:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803f30:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803f40:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803f50:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803f60:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803f70:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803f80:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803f90:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803fa0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803fb0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803fc0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803fd0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803fe0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803ff0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
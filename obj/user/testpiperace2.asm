@@ -0,0 +1,6112 @@
+
+obj/user/testpiperace2:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 b5 02 00 00       	call   8002d8 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 57                	push   %r15
+  80002b:	41 56                	push   %r14
+  80002d:	41 55                	push   %r13
+  80002f:	41 54                	push   %r12
+  800031:	53                   	push   %rbx
+  800032:	48 83 ec 28          	sub    $0x28,%rsp
+    int p[2], r, i;
+    struct Fd *fd;
+    const volatile struct Env *kid;
+
+    cprintf("testing for pipeisclosed race...\n");
+  800036:	48 bf 88 30 80 00 00 	movabs $0x803088,%rdi
+  80003d:	00 00 00 
+  800040:	b8 00 00 00 00       	mov    $0x0,%eax
+  800045:	48 ba f4 04 80 00 00 	movabs $0x8004f4,%rdx
+  80004c:	00 00 00 
+  80004f:	ff d2                	call   *%rdx
+    if ((r = pipe(p)) < 0)
+  800051:	48 8d 7d c8          	lea    -0x38(%rbp),%rdi
+  800055:	48 b8 96 27 80 00 00 	movabs $0x802796,%rax
+  80005c:	00 00 00 
+  80005f:	ff d0                	call   *%rax
+  800061:	85 c0                	test   %eax,%eax
+  800063:	0f 88 98 00 00 00    	js     800101 <umain+0xdc>
+        panic("pipe: %i", r);
+    if ((r = fork()) < 0)
+  800069:	48 b8 04 18 80 00 00 	movabs $0x801804,%rax
+  800070:	00 00 00 
+  800073:	ff d0                	call   *%rax
+  800075:	89 45 bc             	mov    %eax,-0x44(%rbp)
+  800078:	85 c0                	test   %eax,%eax
+  80007a:	0f 88 ae 00 00 00    	js     80012e <umain+0x109>
+        panic("fork: %i", r);
+    if (r == 0) {
+  800080:	83 7d bc 00          	cmpl   $0x0,-0x44(%rbp)
+  800084:	0f 84 d1 00 00 00    	je     80015b <umain+0x136>
+     * it shouldn't.
+     *
+     * So either way, pipeisclosed is going give a wrong answer. */
+
+    kid = &envs[ENVX(r)];
+    while (kid->env_status == ENV_RUNNABLE) {
+  80008a:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  80008d:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800092:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+  800099:	48 bb 00 00 c0 1f 80 	movabs $0x801fc00000,%rbx
+  8000a0:	00 00 00 
+  8000a3:	48 01 c3             	add    %rax,%rbx
+        if (pipeisclosed(p[0]) != 0) {
+  8000a6:	49 bc 98 29 80 00 00 	movabs $0x802998,%r12
+  8000ad:	00 00 00 
+    while (kid->env_status == ENV_RUNNABLE) {
+  8000b0:	8b 83 ec 00 00 00    	mov    0xec(%rbx),%eax
+  8000b6:	83 f8 02             	cmp    $0x2,%eax
+  8000b9:	0f 85 43 01 00 00    	jne    800202 <umain+0x1dd>
+        if (pipeisclosed(p[0]) != 0) {
+  8000bf:	8b 7d c8             	mov    -0x38(%rbp),%edi
+  8000c2:	41 ff d4             	call   *%r12
+  8000c5:	85 c0                	test   %eax,%eax
+  8000c7:	74 e7                	je     8000b0 <umain+0x8b>
+            cprintf("\nRACE: pipe appears closed\n");
+  8000c9:	48 bf 05 31 80 00 00 	movabs $0x803105,%rdi
+  8000d0:	00 00 00 
+  8000d3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000d8:	48 ba f4 04 80 00 00 	movabs $0x8004f4,%rdx
+  8000df:	00 00 00 
+  8000e2:	ff d2                	call   *%rdx
+            sys_env_destroy(r);
+  8000e4:	8b 7d bc             	mov    -0x44(%rbp),%edi
+  8000e7:	48 b8 9e 12 80 00 00 	movabs $0x80129e,%rax
+  8000ee:	00 00 00 
+  8000f1:	ff d0                	call   *%rax
+            exit();
+  8000f3:	48 b8 81 03 80 00 00 	movabs $0x800381,%rax
+  8000fa:	00 00 00 
+  8000fd:	ff d0                	call   *%rax
+  8000ff:	eb af                	jmp    8000b0 <umain+0x8b>
+        panic("pipe: %i", r);
+  800101:	89 c1                	mov    %eax,%ecx
+  800103:	48 ba da 30 80 00 00 	movabs $0x8030da,%rdx
+  80010a:	00 00 00 
+  80010d:	be 0c 00 00 00       	mov    $0xc,%esi
+  800112:	48 bf e3 30 80 00 00 	movabs $0x8030e3,%rdi
+  800119:	00 00 00 
+  80011c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800121:	49 b8 a4 03 80 00 00 	movabs $0x8003a4,%r8
+  800128:	00 00 00 
+  80012b:	41 ff d0             	call   *%r8
+        panic("fork: %i", r);
+  80012e:	89 c1                	mov    %eax,%ecx
+  800130:	48 ba f8 30 80 00 00 	movabs $0x8030f8,%rdx
+  800137:	00 00 00 
+  80013a:	be 0e 00 00 00       	mov    $0xe,%esi
+  80013f:	48 bf e3 30 80 00 00 	movabs $0x8030e3,%rdi
+  800146:	00 00 00 
+  800149:	b8 00 00 00 00       	mov    $0x0,%eax
+  80014e:	49 b8 a4 03 80 00 00 	movabs $0x8003a4,%r8
+  800155:	00 00 00 
+  800158:	41 ff d0             	call   *%r8
+        close(p[1]);
+  80015b:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  80015e:	48 b8 8e 1b 80 00 00 	movabs $0x801b8e,%rax
+  800165:	00 00 00 
+  800168:	ff d0                	call   *%rax
+        for (i = 0; i < 200; i++) {
+  80016a:	8b 5d bc             	mov    -0x44(%rbp),%ebx
+                cprintf("%d.", i);
+  80016d:	49 bf 01 31 80 00 00 	movabs $0x803101,%r15
+  800174:	00 00 00 
+  800177:	49 be f4 04 80 00 00 	movabs $0x8004f4,%r14
+  80017e:	00 00 00 
+            dup(p[0], 10);
+  800181:	49 bd e9 1b 80 00 00 	movabs $0x801be9,%r13
+  800188:	00 00 00 
+            sys_yield();
+  80018b:	49 bc 3a 13 80 00 00 	movabs $0x80133a,%r12
+  800192:	00 00 00 
+  800195:	eb 2d                	jmp    8001c4 <umain+0x19f>
+            dup(p[0], 10);
+  800197:	be 0a 00 00 00       	mov    $0xa,%esi
+  80019c:	8b 7d c8             	mov    -0x38(%rbp),%edi
+  80019f:	41 ff d5             	call   *%r13
+            sys_yield();
+  8001a2:	41 ff d4             	call   *%r12
+            close(10);
+  8001a5:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8001aa:	48 b8 8e 1b 80 00 00 	movabs $0x801b8e,%rax
+  8001b1:	00 00 00 
+  8001b4:	ff d0                	call   *%rax
+            sys_yield();
+  8001b6:	41 ff d4             	call   *%r12
+        for (i = 0; i < 200; i++) {
+  8001b9:	83 c3 01             	add    $0x1,%ebx
+  8001bc:	81 fb c8 00 00 00    	cmp    $0xc8,%ebx
+  8001c2:	74 2d                	je     8001f1 <umain+0x1cc>
+            if (i % 10 == 0)
+  8001c4:	48 63 c3             	movslq %ebx,%rax
+  8001c7:	48 69 c0 67 66 66 66 	imul   $0x66666667,%rax,%rax
+  8001ce:	48 c1 f8 22          	sar    $0x22,%rax
+  8001d2:	89 da                	mov    %ebx,%edx
+  8001d4:	c1 fa 1f             	sar    $0x1f,%edx
+  8001d7:	29 d0                	sub    %edx,%eax
+  8001d9:	8d 04 80             	lea    (%rax,%rax,4),%eax
+  8001dc:	01 c0                	add    %eax,%eax
+  8001de:	39 c3                	cmp    %eax,%ebx
+  8001e0:	75 b5                	jne    800197 <umain+0x172>
+                cprintf("%d.", i);
+  8001e2:	89 de                	mov    %ebx,%esi
+  8001e4:	4c 89 ff             	mov    %r15,%rdi
+  8001e7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001ec:	41 ff d6             	call   *%r14
+  8001ef:	eb a6                	jmp    800197 <umain+0x172>
+        exit();
+  8001f1:	48 b8 81 03 80 00 00 	movabs $0x800381,%rax
+  8001f8:	00 00 00 
+  8001fb:	ff d0                	call   *%rax
+  8001fd:	e9 88 fe ff ff       	jmp    80008a <umain+0x65>
+        }
+    }
+    cprintf("child done with loop\n");
+  800202:	48 bf 21 31 80 00 00 	movabs $0x803121,%rdi
+  800209:	00 00 00 
+  80020c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800211:	48 ba f4 04 80 00 00 	movabs $0x8004f4,%rdx
+  800218:	00 00 00 
+  80021b:	ff d2                	call   *%rdx
+    if (pipeisclosed(p[0]))
+  80021d:	8b 7d c8             	mov    -0x38(%rbp),%edi
+  800220:	48 b8 98 29 80 00 00 	movabs $0x802998,%rax
+  800227:	00 00 00 
+  80022a:	ff d0                	call   *%rax
+  80022c:	85 c0                	test   %eax,%eax
+  80022e:	75 51                	jne    800281 <umain+0x25c>
+        panic("somehow the other end of p[0] got closed!");
+    if ((r = fd_lookup(p[0], &fd)) < 0)
+  800230:	48 8d 75 c0          	lea    -0x40(%rbp),%rsi
+  800234:	8b 7d c8             	mov    -0x38(%rbp),%edi
+  800237:	48 b8 29 1a 80 00 00 	movabs $0x801a29,%rax
+  80023e:	00 00 00 
+  800241:	ff d0                	call   *%rax
+  800243:	85 c0                	test   %eax,%eax
+  800245:	78 64                	js     8002ab <umain+0x286>
+        panic("cannot look up p[0]: %i", r);
+    USED(fd2data(fd));
+  800247:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  80024b:	48 b8 7a 19 80 00 00 	movabs $0x80197a,%rax
+  800252:	00 00 00 
+  800255:	ff d0                	call   *%rax
+    cprintf("race didn't happen\n");
+  800257:	48 bf 4f 31 80 00 00 	movabs $0x80314f,%rdi
+  80025e:	00 00 00 
+  800261:	b8 00 00 00 00       	mov    $0x0,%eax
+  800266:	48 ba f4 04 80 00 00 	movabs $0x8004f4,%rdx
+  80026d:	00 00 00 
+  800270:	ff d2                	call   *%rdx
+}
+  800272:	48 83 c4 28          	add    $0x28,%rsp
+  800276:	5b                   	pop    %rbx
+  800277:	41 5c                	pop    %r12
+  800279:	41 5d                	pop    %r13
+  80027b:	41 5e                	pop    %r14
+  80027d:	41 5f                	pop    %r15
+  80027f:	5d                   	pop    %rbp
+  800280:	c3                   	ret
+        panic("somehow the other end of p[0] got closed!");
+  800281:	48 ba b0 30 80 00 00 	movabs $0x8030b0,%rdx
+  800288:	00 00 00 
+  80028b:	be 40 00 00 00       	mov    $0x40,%esi
+  800290:	48 bf e3 30 80 00 00 	movabs $0x8030e3,%rdi
+  800297:	00 00 00 
+  80029a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80029f:	48 b9 a4 03 80 00 00 	movabs $0x8003a4,%rcx
+  8002a6:	00 00 00 
+  8002a9:	ff d1                	call   *%rcx
+        panic("cannot look up p[0]: %i", r);
+  8002ab:	89 c1                	mov    %eax,%ecx
+  8002ad:	48 ba 37 31 80 00 00 	movabs $0x803137,%rdx
+  8002b4:	00 00 00 
+  8002b7:	be 42 00 00 00       	mov    $0x42,%esi
+  8002bc:	48 bf e3 30 80 00 00 	movabs $0x8030e3,%rdi
+  8002c3:	00 00 00 
+  8002c6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002cb:	49 b8 a4 03 80 00 00 	movabs $0x8003a4,%r8
+  8002d2:	00 00 00 
+  8002d5:	41 ff d0             	call   *%r8
+
+00000000008002d8 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  8002d8:	55                   	push   %rbp
+  8002d9:	48 89 e5             	mov    %rsp,%rbp
+  8002dc:	41 56                	push   %r14
+  8002de:	41 55                	push   %r13
+  8002e0:	41 54                	push   %r12
+  8002e2:	53                   	push   %rbx
+  8002e3:	41 89 fd             	mov    %edi,%r13d
+  8002e6:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  8002e9:	48 ba d8 40 80 00 00 	movabs $0x8040d8,%rdx
+  8002f0:	00 00 00 
+  8002f3:	48 b8 d8 40 80 00 00 	movabs $0x8040d8,%rax
+  8002fa:	00 00 00 
+  8002fd:	48 39 c2             	cmp    %rax,%rdx
+  800300:	73 17                	jae    800319 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  800302:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  800305:	49 89 c4             	mov    %rax,%r12
+  800308:	48 83 c3 08          	add    $0x8,%rbx
+  80030c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800311:	ff 53 f8             	call   *-0x8(%rbx)
+  800314:	4c 39 e3             	cmp    %r12,%rbx
+  800317:	72 ef                	jb     800308 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+    envid_t this_env_id = sys_getenvid();
+  800319:	48 b8 09 13 80 00 00 	movabs $0x801309,%rax
+  800320:	00 00 00 
+  800323:	ff d0                	call   *%rax
+    thisenv = &((struct Env*)UENVS)[ENVX(this_env_id)];
+  800325:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80032a:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+  800331:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  800338:	00 00 00 
+  80033b:	48 01 d0             	add    %rdx,%rax
+  80033e:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  800345:	00 00 00 
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  800348:	45 85 ed             	test   %r13d,%r13d
+  80034b:	7e 0d                	jle    80035a <libmain+0x82>
+  80034d:	49 8b 06             	mov    (%r14),%rax
+  800350:	48 a3 00 40 80 00 00 	movabs %rax,0x804000
+  800357:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  80035a:	4c 89 f6             	mov    %r14,%rsi
+  80035d:	44 89 ef             	mov    %r13d,%edi
+  800360:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  800367:	00 00 00 
+  80036a:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  80036c:	48 b8 81 03 80 00 00 	movabs $0x800381,%rax
+  800373:	00 00 00 
+  800376:	ff d0                	call   *%rax
+#endif
+}
+  800378:	5b                   	pop    %rbx
+  800379:	41 5c                	pop    %r12
+  80037b:	41 5d                	pop    %r13
+  80037d:	41 5e                	pop    %r14
+  80037f:	5d                   	pop    %rbp
+  800380:	c3                   	ret
+
+0000000000800381 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  800381:	55                   	push   %rbp
+  800382:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  800385:	48 b8 c1 1b 80 00 00 	movabs $0x801bc1,%rax
+  80038c:	00 00 00 
+  80038f:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  800391:	bf 00 00 00 00       	mov    $0x0,%edi
+  800396:	48 b8 9e 12 80 00 00 	movabs $0x80129e,%rax
+  80039d:	00 00 00 
+  8003a0:	ff d0                	call   *%rax
+}
+  8003a2:	5d                   	pop    %rbp
+  8003a3:	c3                   	ret
+
+00000000008003a4 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  8003a4:	55                   	push   %rbp
+  8003a5:	48 89 e5             	mov    %rsp,%rbp
+  8003a8:	41 56                	push   %r14
+  8003aa:	41 55                	push   %r13
+  8003ac:	41 54                	push   %r12
+  8003ae:	53                   	push   %rbx
+  8003af:	48 83 ec 50          	sub    $0x50,%rsp
+  8003b3:	49 89 fc             	mov    %rdi,%r12
+  8003b6:	41 89 f5             	mov    %esi,%r13d
+  8003b9:	48 89 d3             	mov    %rdx,%rbx
+  8003bc:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  8003c0:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  8003c4:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  8003c8:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  8003cf:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8003d3:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  8003d7:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  8003db:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  8003df:	48 b8 00 40 80 00 00 	movabs $0x804000,%rax
+  8003e6:	00 00 00 
+  8003e9:	4c 8b 30             	mov    (%rax),%r14
+  8003ec:	48 b8 09 13 80 00 00 	movabs $0x801309,%rax
+  8003f3:	00 00 00 
+  8003f6:	ff d0                	call   *%rax
+  8003f8:	89 c6                	mov    %eax,%esi
+  8003fa:	45 89 e8             	mov    %r13d,%r8d
+  8003fd:	4c 89 e1             	mov    %r12,%rcx
+  800400:	4c 89 f2             	mov    %r14,%rdx
+  800403:	48 bf 70 31 80 00 00 	movabs $0x803170,%rdi
+  80040a:	00 00 00 
+  80040d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800412:	49 bc f4 04 80 00 00 	movabs $0x8004f4,%r12
+  800419:	00 00 00 
+  80041c:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  80041f:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  800423:	48 89 df             	mov    %rbx,%rdi
+  800426:	48 b8 90 04 80 00 00 	movabs $0x800490,%rax
+  80042d:	00 00 00 
+  800430:	ff d0                	call   *%rax
+    cprintf("\n");
+  800432:	48 bf 1f 31 80 00 00 	movabs $0x80311f,%rdi
+  800439:	00 00 00 
+  80043c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800441:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  800444:	cc                   	int3
+  800445:	eb fd                	jmp    800444 <_panic+0xa0>
+
+0000000000800447 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  800447:	55                   	push   %rbp
+  800448:	48 89 e5             	mov    %rsp,%rbp
+  80044b:	53                   	push   %rbx
+  80044c:	48 83 ec 08          	sub    $0x8,%rsp
+  800450:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  800453:	8b 06                	mov    (%rsi),%eax
+  800455:	8d 50 01             	lea    0x1(%rax),%edx
+  800458:	89 16                	mov    %edx,(%rsi)
+  80045a:	48 98                	cltq
+  80045c:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  800461:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  800467:	74 0a                	je     800473 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  800469:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  80046d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800471:	c9                   	leave
+  800472:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  800473:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  800477:	be ff 00 00 00       	mov    $0xff,%esi
+  80047c:	48 b8 40 12 80 00 00 	movabs $0x801240,%rax
+  800483:	00 00 00 
+  800486:	ff d0                	call   *%rax
+        state->offset = 0;
+  800488:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  80048e:	eb d9                	jmp    800469 <putch+0x22>
+
+0000000000800490 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  800490:	55                   	push   %rbp
+  800491:	48 89 e5             	mov    %rsp,%rbp
+  800494:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  80049b:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  80049e:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  8004a5:	b9 21 00 00 00       	mov    $0x21,%ecx
+  8004aa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004af:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  8004b2:	48 89 f1             	mov    %rsi,%rcx
+  8004b5:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  8004bc:	48 bf 47 04 80 00 00 	movabs $0x800447,%rdi
+  8004c3:	00 00 00 
+  8004c6:	48 b8 44 06 80 00 00 	movabs $0x800644,%rax
+  8004cd:	00 00 00 
+  8004d0:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  8004d2:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  8004d9:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  8004e0:	48 b8 40 12 80 00 00 	movabs $0x801240,%rax
+  8004e7:	00 00 00 
+  8004ea:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  8004ec:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  8004f2:	c9                   	leave
+  8004f3:	c3                   	ret
+
+00000000008004f4 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  8004f4:	55                   	push   %rbp
+  8004f5:	48 89 e5             	mov    %rsp,%rbp
+  8004f8:	48 83 ec 50          	sub    $0x50,%rsp
+  8004fc:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  800500:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  800504:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800508:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80050c:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  800510:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  800517:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80051b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80051f:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800523:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  800527:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  80052b:	48 b8 90 04 80 00 00 	movabs $0x800490,%rax
+  800532:	00 00 00 
+  800535:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  800537:	c9                   	leave
+  800538:	c3                   	ret
+
+0000000000800539 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  800539:	55                   	push   %rbp
+  80053a:	48 89 e5             	mov    %rsp,%rbp
+  80053d:	41 57                	push   %r15
+  80053f:	41 56                	push   %r14
+  800541:	41 55                	push   %r13
+  800543:	41 54                	push   %r12
+  800545:	53                   	push   %rbx
+  800546:	48 83 ec 18          	sub    $0x18,%rsp
+  80054a:	49 89 fc             	mov    %rdi,%r12
+  80054d:	49 89 f5             	mov    %rsi,%r13
+  800550:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800554:	8b 45 10             	mov    0x10(%rbp),%eax
+  800557:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  80055a:	41 89 cf             	mov    %ecx,%r15d
+  80055d:	4c 39 fa             	cmp    %r15,%rdx
+  800560:	73 5b                	jae    8005bd <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  800562:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  800566:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  80056a:	85 db                	test   %ebx,%ebx
+  80056c:	7e 0e                	jle    80057c <print_num+0x43>
+            putch(padc, put_arg);
+  80056e:	4c 89 ee             	mov    %r13,%rsi
+  800571:	44 89 f7             	mov    %r14d,%edi
+  800574:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  800577:	83 eb 01             	sub    $0x1,%ebx
+  80057a:	75 f2                	jne    80056e <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  80057c:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  800580:	48 b9 a4 31 80 00 00 	movabs $0x8031a4,%rcx
+  800587:	00 00 00 
+  80058a:	48 b8 93 31 80 00 00 	movabs $0x803193,%rax
+  800591:	00 00 00 
+  800594:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  800598:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80059c:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005a1:	49 f7 f7             	div    %r15
+  8005a4:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  8005a8:	4c 89 ee             	mov    %r13,%rsi
+  8005ab:	41 ff d4             	call   *%r12
+}
+  8005ae:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8005b2:	5b                   	pop    %rbx
+  8005b3:	41 5c                	pop    %r12
+  8005b5:	41 5d                	pop    %r13
+  8005b7:	41 5e                	pop    %r14
+  8005b9:	41 5f                	pop    %r15
+  8005bb:	5d                   	pop    %rbp
+  8005bc:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  8005bd:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8005c1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005c6:	49 f7 f7             	div    %r15
+  8005c9:	48 83 ec 08          	sub    $0x8,%rsp
+  8005cd:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  8005d1:	52                   	push   %rdx
+  8005d2:	45 0f be c9          	movsbl %r9b,%r9d
+  8005d6:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  8005da:	48 89 c2             	mov    %rax,%rdx
+  8005dd:	48 b8 39 05 80 00 00 	movabs $0x800539,%rax
+  8005e4:	00 00 00 
+  8005e7:	ff d0                	call   *%rax
+  8005e9:	48 83 c4 10          	add    $0x10,%rsp
+  8005ed:	eb 8d                	jmp    80057c <print_num+0x43>
+
+00000000008005ef <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  8005ef:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  8005f3:	48 8b 06             	mov    (%rsi),%rax
+  8005f6:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  8005fa:	73 0a                	jae    800606 <sprintputch+0x17>
+        *state->start++ = ch;
+  8005fc:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800600:	48 89 16             	mov    %rdx,(%rsi)
+  800603:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  800606:	c3                   	ret
+
+0000000000800607 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  800607:	55                   	push   %rbp
+  800608:	48 89 e5             	mov    %rsp,%rbp
+  80060b:	48 83 ec 50          	sub    $0x50,%rsp
+  80060f:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800613:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800617:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  80061b:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800622:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800626:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80062a:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80062e:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  800632:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800636:	48 b8 44 06 80 00 00 	movabs $0x800644,%rax
+  80063d:	00 00 00 
+  800640:	ff d0                	call   *%rax
+}
+  800642:	c9                   	leave
+  800643:	c3                   	ret
+
+0000000000800644 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  800644:	55                   	push   %rbp
+  800645:	48 89 e5             	mov    %rsp,%rbp
+  800648:	41 57                	push   %r15
+  80064a:	41 56                	push   %r14
+  80064c:	41 55                	push   %r13
+  80064e:	41 54                	push   %r12
+  800650:	53                   	push   %rbx
+  800651:	48 83 ec 38          	sub    $0x38,%rsp
+  800655:	49 89 fe             	mov    %rdi,%r14
+  800658:	49 89 f5             	mov    %rsi,%r13
+  80065b:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  80065e:	48 8b 01             	mov    (%rcx),%rax
+  800661:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  800665:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800669:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80066d:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  800671:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  800675:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  800679:	0f b6 3b             	movzbl (%rbx),%edi
+  80067c:	40 80 ff 25          	cmp    $0x25,%dil
+  800680:	74 18                	je     80069a <vprintfmt+0x56>
+            if (!ch) return;
+  800682:	40 84 ff             	test   %dil,%dil
+  800685:	0f 84 b1 06 00 00    	je     800d3c <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  80068b:	40 0f b6 ff          	movzbl %dil,%edi
+  80068f:	4c 89 ee             	mov    %r13,%rsi
+  800692:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  800695:	4c 89 e3             	mov    %r12,%rbx
+  800698:	eb db                	jmp    800675 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  80069a:	be 00 00 00 00       	mov    $0x0,%esi
+  80069f:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  8006a3:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  8006a8:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8006ae:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  8006b5:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8006b9:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  8006be:	41 0f b6 04 24       	movzbl (%r12),%eax
+  8006c3:	88 45 a0             	mov    %al,-0x60(%rbp)
+  8006c6:	83 e8 23             	sub    $0x23,%eax
+  8006c9:	3c 57                	cmp    $0x57,%al
+  8006cb:	0f 87 51 06 00 00    	ja     800d22 <vprintfmt+0x6de>
+  8006d1:	0f b6 c0             	movzbl %al,%eax
+  8006d4:	48 b9 60 33 80 00 00 	movabs $0x803360,%rcx
+  8006db:	00 00 00 
+  8006de:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  8006e1:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  8006e4:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  8006e8:	eb cf                	jmp    8006b9 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  8006ea:	49 89 dc             	mov    %rbx,%r12
+  8006ed:	be 01 00 00 00       	mov    $0x1,%esi
+  8006f2:	eb c5                	jmp    8006b9 <vprintfmt+0x75>
+            padc = ch;
+  8006f4:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  8006f8:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8006fb:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8006fe:	eb b9                	jmp    8006b9 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800700:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800703:	83 f8 2f             	cmp    $0x2f,%eax
+  800706:	77 24                	ja     80072c <vprintfmt+0xe8>
+  800708:	89 c1                	mov    %eax,%ecx
+  80070a:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  80070e:	83 c0 08             	add    $0x8,%eax
+  800711:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800714:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  800717:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  80071a:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  80071e:	79 99                	jns    8006b9 <vprintfmt+0x75>
+                width = precision;
+  800720:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  800724:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  80072a:	eb 8d                	jmp    8006b9 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  80072c:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  800730:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  800734:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800738:	eb da                	jmp    800714 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  80073a:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  80073f:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800743:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  800749:	3c 39                	cmp    $0x39,%al
+  80074b:	77 1c                	ja     800769 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  80074d:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  800751:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  800755:	0f b6 c0             	movzbl %al,%eax
+  800758:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  80075d:	0f b6 03             	movzbl (%rbx),%eax
+  800760:	3c 39                	cmp    $0x39,%al
+  800762:	76 e9                	jbe    80074d <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  800764:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  800767:	eb b1                	jmp    80071a <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  800769:	49 89 dc             	mov    %rbx,%r12
+  80076c:	eb ac                	jmp    80071a <vprintfmt+0xd6>
+            width = MAX(0, width);
+  80076e:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  800771:	85 c9                	test   %ecx,%ecx
+  800773:	b8 00 00 00 00       	mov    $0x0,%eax
+  800778:	0f 49 c1             	cmovns %ecx,%eax
+  80077b:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  80077e:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800781:	e9 33 ff ff ff       	jmp    8006b9 <vprintfmt+0x75>
+            lflag++;
+  800786:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  800789:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80078c:	e9 28 ff ff ff       	jmp    8006b9 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  800791:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800794:	83 f8 2f             	cmp    $0x2f,%eax
+  800797:	77 19                	ja     8007b2 <vprintfmt+0x16e>
+  800799:	89 c2                	mov    %eax,%edx
+  80079b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80079f:	83 c0 08             	add    $0x8,%eax
+  8007a2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007a5:	8b 3a                	mov    (%rdx),%edi
+  8007a7:	4c 89 ee             	mov    %r13,%rsi
+  8007aa:	41 ff d6             	call   *%r14
+            break;
+  8007ad:	e9 c3 fe ff ff       	jmp    800675 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  8007b2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007b6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007ba:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007be:	eb e5                	jmp    8007a5 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  8007c0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007c3:	83 f8 2f             	cmp    $0x2f,%eax
+  8007c6:	77 5a                	ja     800822 <vprintfmt+0x1de>
+  8007c8:	89 c2                	mov    %eax,%edx
+  8007ca:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007ce:	83 c0 08             	add    $0x8,%eax
+  8007d1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  8007d4:	8b 02                	mov    (%rdx),%eax
+  8007d6:	89 c1                	mov    %eax,%ecx
+  8007d8:	f7 d9                	neg    %ecx
+  8007da:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  8007dd:	83 f9 15             	cmp    $0x15,%ecx
+  8007e0:	7f 4e                	jg     800830 <vprintfmt+0x1ec>
+  8007e2:	48 63 c1             	movslq %ecx,%rax
+  8007e5:	48 ba 20 36 80 00 00 	movabs $0x803620,%rdx
+  8007ec:	00 00 00 
+  8007ef:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8007f3:	48 85 c0             	test   %rax,%rax
+  8007f6:	74 38                	je     800830 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  8007f8:	48 89 c1             	mov    %rax,%rcx
+  8007fb:	48 ba 19 38 80 00 00 	movabs $0x803819,%rdx
+  800802:	00 00 00 
+  800805:	4c 89 ee             	mov    %r13,%rsi
+  800808:	4c 89 f7             	mov    %r14,%rdi
+  80080b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800810:	49 b8 07 06 80 00 00 	movabs $0x800607,%r8
+  800817:	00 00 00 
+  80081a:	41 ff d0             	call   *%r8
+  80081d:	e9 53 fe ff ff       	jmp    800675 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  800822:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800826:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80082a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80082e:	eb a4                	jmp    8007d4 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  800830:	48 ba bc 31 80 00 00 	movabs $0x8031bc,%rdx
+  800837:	00 00 00 
+  80083a:	4c 89 ee             	mov    %r13,%rsi
+  80083d:	4c 89 f7             	mov    %r14,%rdi
+  800840:	b8 00 00 00 00       	mov    $0x0,%eax
+  800845:	49 b8 07 06 80 00 00 	movabs $0x800607,%r8
+  80084c:	00 00 00 
+  80084f:	41 ff d0             	call   *%r8
+  800852:	e9 1e fe ff ff       	jmp    800675 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800857:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80085a:	83 f8 2f             	cmp    $0x2f,%eax
+  80085d:	77 6c                	ja     8008cb <vprintfmt+0x287>
+  80085f:	89 c2                	mov    %eax,%edx
+  800861:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800865:	83 c0 08             	add    $0x8,%eax
+  800868:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80086b:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  80086e:	48 85 d2             	test   %rdx,%rdx
+  800871:	48 b8 b5 31 80 00 00 	movabs $0x8031b5,%rax
+  800878:	00 00 00 
+  80087b:	48 0f 45 c2          	cmovne %rdx,%rax
+  80087f:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  800883:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800887:	7e 06                	jle    80088f <vprintfmt+0x24b>
+  800889:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  80088d:	75 4a                	jne    8008d9 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  80088f:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800893:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  800897:	0f b6 00             	movzbl (%rax),%eax
+  80089a:	84 c0                	test   %al,%al
+  80089c:	0f 85 9a 00 00 00    	jne    80093c <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  8008a2:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8008a5:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  8008a9:	85 c0                	test   %eax,%eax
+  8008ab:	0f 8e c4 fd ff ff    	jle    800675 <vprintfmt+0x31>
+  8008b1:	4c 89 ee             	mov    %r13,%rsi
+  8008b4:	bf 20 00 00 00       	mov    $0x20,%edi
+  8008b9:	41 ff d6             	call   *%r14
+  8008bc:	41 83 ec 01          	sub    $0x1,%r12d
+  8008c0:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  8008c4:	75 eb                	jne    8008b1 <vprintfmt+0x26d>
+  8008c6:	e9 aa fd ff ff       	jmp    800675 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8008cb:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008cf:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008d3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008d7:	eb 92                	jmp    80086b <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  8008d9:	49 63 f7             	movslq %r15d,%rsi
+  8008dc:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  8008e0:	48 b8 f6 0d 80 00 00 	movabs $0x800df6,%rax
+  8008e7:	00 00 00 
+  8008ea:	ff d0                	call   *%rax
+  8008ec:	48 89 c2             	mov    %rax,%rdx
+  8008ef:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8008f2:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  8008f4:	8d 70 ff             	lea    -0x1(%rax),%esi
+  8008f7:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  8008fa:	85 c0                	test   %eax,%eax
+  8008fc:	7e 91                	jle    80088f <vprintfmt+0x24b>
+  8008fe:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  800903:	4c 89 ee             	mov    %r13,%rsi
+  800906:	44 89 e7             	mov    %r12d,%edi
+  800909:	41 ff d6             	call   *%r14
+  80090c:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800910:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800913:	83 f8 ff             	cmp    $0xffffffff,%eax
+  800916:	75 eb                	jne    800903 <vprintfmt+0x2bf>
+  800918:	e9 72 ff ff ff       	jmp    80088f <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  80091d:	0f b6 f8             	movzbl %al,%edi
+  800920:	4c 89 ee             	mov    %r13,%rsi
+  800923:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800926:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  80092a:	49 83 c4 01          	add    $0x1,%r12
+  80092e:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  800934:	84 c0                	test   %al,%al
+  800936:	0f 84 66 ff ff ff    	je     8008a2 <vprintfmt+0x25e>
+  80093c:	45 85 ff             	test   %r15d,%r15d
+  80093f:	78 0a                	js     80094b <vprintfmt+0x307>
+  800941:	41 83 ef 01          	sub    $0x1,%r15d
+  800945:	0f 88 57 ff ff ff    	js     8008a2 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  80094b:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  80094f:	74 cc                	je     80091d <vprintfmt+0x2d9>
+  800951:	8d 50 e0             	lea    -0x20(%rax),%edx
+  800954:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800959:	80 fa 5e             	cmp    $0x5e,%dl
+  80095c:	77 c2                	ja     800920 <vprintfmt+0x2dc>
+  80095e:	eb bd                	jmp    80091d <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  800960:	40 84 f6             	test   %sil,%sil
+  800963:	75 26                	jne    80098b <vprintfmt+0x347>
+    switch (lflag) {
+  800965:	85 d2                	test   %edx,%edx
+  800967:	74 59                	je     8009c2 <vprintfmt+0x37e>
+  800969:	83 fa 01             	cmp    $0x1,%edx
+  80096c:	74 7b                	je     8009e9 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  80096e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800971:	83 f8 2f             	cmp    $0x2f,%eax
+  800974:	0f 87 96 00 00 00    	ja     800a10 <vprintfmt+0x3cc>
+  80097a:	89 c2                	mov    %eax,%edx
+  80097c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800980:	83 c0 08             	add    $0x8,%eax
+  800983:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800986:	4c 8b 22             	mov    (%rdx),%r12
+  800989:	eb 17                	jmp    8009a2 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  80098b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80098e:	83 f8 2f             	cmp    $0x2f,%eax
+  800991:	77 21                	ja     8009b4 <vprintfmt+0x370>
+  800993:	89 c2                	mov    %eax,%edx
+  800995:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800999:	83 c0 08             	add    $0x8,%eax
+  80099c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80099f:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  8009a2:	4d 85 e4             	test   %r12,%r12
+  8009a5:	78 7a                	js     800a21 <vprintfmt+0x3dd>
+            num = i;
+  8009a7:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  8009aa:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  8009af:	e9 50 02 00 00       	jmp    800c04 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8009b4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009b8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009bc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009c0:	eb dd                	jmp    80099f <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  8009c2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009c5:	83 f8 2f             	cmp    $0x2f,%eax
+  8009c8:	77 11                	ja     8009db <vprintfmt+0x397>
+  8009ca:	89 c2                	mov    %eax,%edx
+  8009cc:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009d0:	83 c0 08             	add    $0x8,%eax
+  8009d3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009d6:	4c 63 22             	movslq (%rdx),%r12
+  8009d9:	eb c7                	jmp    8009a2 <vprintfmt+0x35e>
+  8009db:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009df:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009e3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009e7:	eb ed                	jmp    8009d6 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  8009e9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009ec:	83 f8 2f             	cmp    $0x2f,%eax
+  8009ef:	77 11                	ja     800a02 <vprintfmt+0x3be>
+  8009f1:	89 c2                	mov    %eax,%edx
+  8009f3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009f7:	83 c0 08             	add    $0x8,%eax
+  8009fa:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009fd:	4c 8b 22             	mov    (%rdx),%r12
+  800a00:	eb a0                	jmp    8009a2 <vprintfmt+0x35e>
+  800a02:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a06:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a0a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a0e:	eb ed                	jmp    8009fd <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  800a10:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a14:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a18:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a1c:	e9 65 ff ff ff       	jmp    800986 <vprintfmt+0x342>
+                putch('-', put_arg);
+  800a21:	4c 89 ee             	mov    %r13,%rsi
+  800a24:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800a29:	41 ff d6             	call   *%r14
+                i = -i;
+  800a2c:	49 f7 dc             	neg    %r12
+  800a2f:	e9 73 ff ff ff       	jmp    8009a7 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  800a34:	40 84 f6             	test   %sil,%sil
+  800a37:	75 32                	jne    800a6b <vprintfmt+0x427>
+    switch (lflag) {
+  800a39:	85 d2                	test   %edx,%edx
+  800a3b:	74 5d                	je     800a9a <vprintfmt+0x456>
+  800a3d:	83 fa 01             	cmp    $0x1,%edx
+  800a40:	0f 84 82 00 00 00    	je     800ac8 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  800a46:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a49:	83 f8 2f             	cmp    $0x2f,%eax
+  800a4c:	0f 87 a5 00 00 00    	ja     800af7 <vprintfmt+0x4b3>
+  800a52:	89 c2                	mov    %eax,%edx
+  800a54:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a58:	83 c0 08             	add    $0x8,%eax
+  800a5b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a5e:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800a61:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  800a66:	e9 99 01 00 00       	jmp    800c04 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800a6b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a6e:	83 f8 2f             	cmp    $0x2f,%eax
+  800a71:	77 19                	ja     800a8c <vprintfmt+0x448>
+  800a73:	89 c2                	mov    %eax,%edx
+  800a75:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a79:	83 c0 08             	add    $0x8,%eax
+  800a7c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a7f:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800a82:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800a87:	e9 78 01 00 00       	jmp    800c04 <vprintfmt+0x5c0>
+  800a8c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a90:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a94:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a98:	eb e5                	jmp    800a7f <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  800a9a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a9d:	83 f8 2f             	cmp    $0x2f,%eax
+  800aa0:	77 18                	ja     800aba <vprintfmt+0x476>
+  800aa2:	89 c2                	mov    %eax,%edx
+  800aa4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800aa8:	83 c0 08             	add    $0x8,%eax
+  800aab:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800aae:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800ab0:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  800ab5:	e9 4a 01 00 00       	jmp    800c04 <vprintfmt+0x5c0>
+  800aba:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800abe:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ac2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ac6:	eb e6                	jmp    800aae <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  800ac8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800acb:	83 f8 2f             	cmp    $0x2f,%eax
+  800ace:	77 19                	ja     800ae9 <vprintfmt+0x4a5>
+  800ad0:	89 c2                	mov    %eax,%edx
+  800ad2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ad6:	83 c0 08             	add    $0x8,%eax
+  800ad9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800adc:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800adf:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  800ae4:	e9 1b 01 00 00       	jmp    800c04 <vprintfmt+0x5c0>
+  800ae9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800aed:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800af1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800af5:	eb e5                	jmp    800adc <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  800af7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800afb:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800aff:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b03:	e9 56 ff ff ff       	jmp    800a5e <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  800b08:	40 84 f6             	test   %sil,%sil
+  800b0b:	75 2e                	jne    800b3b <vprintfmt+0x4f7>
+    switch (lflag) {
+  800b0d:	85 d2                	test   %edx,%edx
+  800b0f:	74 59                	je     800b6a <vprintfmt+0x526>
+  800b11:	83 fa 01             	cmp    $0x1,%edx
+  800b14:	74 7f                	je     800b95 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  800b16:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b19:	83 f8 2f             	cmp    $0x2f,%eax
+  800b1c:	0f 87 9f 00 00 00    	ja     800bc1 <vprintfmt+0x57d>
+  800b22:	89 c2                	mov    %eax,%edx
+  800b24:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b28:	83 c0 08             	add    $0x8,%eax
+  800b2b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b2e:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800b31:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  800b36:	e9 c9 00 00 00       	jmp    800c04 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800b3b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b3e:	83 f8 2f             	cmp    $0x2f,%eax
+  800b41:	77 19                	ja     800b5c <vprintfmt+0x518>
+  800b43:	89 c2                	mov    %eax,%edx
+  800b45:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b49:	83 c0 08             	add    $0x8,%eax
+  800b4c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b4f:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800b52:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800b57:	e9 a8 00 00 00       	jmp    800c04 <vprintfmt+0x5c0>
+  800b5c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b60:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b64:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b68:	eb e5                	jmp    800b4f <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  800b6a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b6d:	83 f8 2f             	cmp    $0x2f,%eax
+  800b70:	77 15                	ja     800b87 <vprintfmt+0x543>
+  800b72:	89 c2                	mov    %eax,%edx
+  800b74:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b78:	83 c0 08             	add    $0x8,%eax
+  800b7b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b7e:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  800b80:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  800b85:	eb 7d                	jmp    800c04 <vprintfmt+0x5c0>
+  800b87:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b8b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b8f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b93:	eb e9                	jmp    800b7e <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  800b95:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b98:	83 f8 2f             	cmp    $0x2f,%eax
+  800b9b:	77 16                	ja     800bb3 <vprintfmt+0x56f>
+  800b9d:	89 c2                	mov    %eax,%edx
+  800b9f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ba3:	83 c0 08             	add    $0x8,%eax
+  800ba6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ba9:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800bac:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  800bb1:	eb 51                	jmp    800c04 <vprintfmt+0x5c0>
+  800bb3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bb7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bbb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bbf:	eb e8                	jmp    800ba9 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  800bc1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bc5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bc9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bcd:	e9 5c ff ff ff       	jmp    800b2e <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  800bd2:	4c 89 ee             	mov    %r13,%rsi
+  800bd5:	bf 30 00 00 00       	mov    $0x30,%edi
+  800bda:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800bdd:	4c 89 ee             	mov    %r13,%rsi
+  800be0:	bf 78 00 00 00       	mov    $0x78,%edi
+  800be5:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800be8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800beb:	83 f8 2f             	cmp    $0x2f,%eax
+  800bee:	77 47                	ja     800c37 <vprintfmt+0x5f3>
+  800bf0:	89 c2                	mov    %eax,%edx
+  800bf2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800bf6:	83 c0 08             	add    $0x8,%eax
+  800bf9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800bfc:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800bff:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800c04:	48 83 ec 08          	sub    $0x8,%rsp
+  800c08:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800c0c:	0f 94 c0             	sete   %al
+  800c0f:	0f b6 c0             	movzbl %al,%eax
+  800c12:	50                   	push   %rax
+  800c13:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800c18:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800c1c:	4c 89 ee             	mov    %r13,%rsi
+  800c1f:	4c 89 f7             	mov    %r14,%rdi
+  800c22:	48 b8 39 05 80 00 00 	movabs $0x800539,%rax
+  800c29:	00 00 00 
+  800c2c:	ff d0                	call   *%rax
+            break;
+  800c2e:	48 83 c4 10          	add    $0x10,%rsp
+  800c32:	e9 3e fa ff ff       	jmp    800675 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800c37:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c3b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c3f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c43:	eb b7                	jmp    800bfc <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  800c45:	40 84 f6             	test   %sil,%sil
+  800c48:	75 2b                	jne    800c75 <vprintfmt+0x631>
+    switch (lflag) {
+  800c4a:	85 d2                	test   %edx,%edx
+  800c4c:	74 56                	je     800ca4 <vprintfmt+0x660>
+  800c4e:	83 fa 01             	cmp    $0x1,%edx
+  800c51:	74 7f                	je     800cd2 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800c53:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c56:	83 f8 2f             	cmp    $0x2f,%eax
+  800c59:	0f 87 a2 00 00 00    	ja     800d01 <vprintfmt+0x6bd>
+  800c5f:	89 c2                	mov    %eax,%edx
+  800c61:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c65:	83 c0 08             	add    $0x8,%eax
+  800c68:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c6b:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800c6e:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800c73:	eb 8f                	jmp    800c04 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800c75:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c78:	83 f8 2f             	cmp    $0x2f,%eax
+  800c7b:	77 19                	ja     800c96 <vprintfmt+0x652>
+  800c7d:	89 c2                	mov    %eax,%edx
+  800c7f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c83:	83 c0 08             	add    $0x8,%eax
+  800c86:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c89:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800c8c:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800c91:	e9 6e ff ff ff       	jmp    800c04 <vprintfmt+0x5c0>
+  800c96:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c9a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c9e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ca2:	eb e5                	jmp    800c89 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800ca4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ca7:	83 f8 2f             	cmp    $0x2f,%eax
+  800caa:	77 18                	ja     800cc4 <vprintfmt+0x680>
+  800cac:	89 c2                	mov    %eax,%edx
+  800cae:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800cb2:	83 c0 08             	add    $0x8,%eax
+  800cb5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800cb8:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800cba:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800cbf:	e9 40 ff ff ff       	jmp    800c04 <vprintfmt+0x5c0>
+  800cc4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800cc8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ccc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800cd0:	eb e6                	jmp    800cb8 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800cd2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800cd5:	83 f8 2f             	cmp    $0x2f,%eax
+  800cd8:	77 19                	ja     800cf3 <vprintfmt+0x6af>
+  800cda:	89 c2                	mov    %eax,%edx
+  800cdc:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ce0:	83 c0 08             	add    $0x8,%eax
+  800ce3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ce6:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800ce9:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800cee:	e9 11 ff ff ff       	jmp    800c04 <vprintfmt+0x5c0>
+  800cf3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800cf7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800cfb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800cff:	eb e5                	jmp    800ce6 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800d01:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d05:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d09:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d0d:	e9 59 ff ff ff       	jmp    800c6b <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800d12:	4c 89 ee             	mov    %r13,%rsi
+  800d15:	bf 25 00 00 00       	mov    $0x25,%edi
+  800d1a:	41 ff d6             	call   *%r14
+            break;
+  800d1d:	e9 53 f9 ff ff       	jmp    800675 <vprintfmt+0x31>
+            putch('%', put_arg);
+  800d22:	4c 89 ee             	mov    %r13,%rsi
+  800d25:	bf 25 00 00 00       	mov    $0x25,%edi
+  800d2a:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800d2d:	48 83 eb 01          	sub    $0x1,%rbx
+  800d31:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800d35:	75 f6                	jne    800d2d <vprintfmt+0x6e9>
+  800d37:	e9 39 f9 ff ff       	jmp    800675 <vprintfmt+0x31>
+}
+  800d3c:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800d40:	5b                   	pop    %rbx
+  800d41:	41 5c                	pop    %r12
+  800d43:	41 5d                	pop    %r13
+  800d45:	41 5e                	pop    %r14
+  800d47:	41 5f                	pop    %r15
+  800d49:	5d                   	pop    %rbp
+  800d4a:	c3                   	ret
+
+0000000000800d4b <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800d4b:	55                   	push   %rbp
+  800d4c:	48 89 e5             	mov    %rsp,%rbp
+  800d4f:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800d53:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800d57:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800d5c:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800d60:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800d67:	48 85 ff             	test   %rdi,%rdi
+  800d6a:	74 2b                	je     800d97 <vsnprintf+0x4c>
+  800d6c:	48 85 f6             	test   %rsi,%rsi
+  800d6f:	74 26                	je     800d97 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800d71:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800d75:	48 bf ef 05 80 00 00 	movabs $0x8005ef,%rdi
+  800d7c:	00 00 00 
+  800d7f:	48 b8 44 06 80 00 00 	movabs $0x800644,%rax
+  800d86:	00 00 00 
+  800d89:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800d8b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800d8f:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800d92:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800d95:	c9                   	leave
+  800d96:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800d97:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800d9c:	eb f7                	jmp    800d95 <vsnprintf+0x4a>
+
+0000000000800d9e <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800d9e:	55                   	push   %rbp
+  800d9f:	48 89 e5             	mov    %rsp,%rbp
+  800da2:	48 83 ec 50          	sub    $0x50,%rsp
+  800da6:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800daa:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800dae:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800db2:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800db9:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800dbd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800dc1:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800dc5:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800dc9:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800dcd:	48 b8 4b 0d 80 00 00 	movabs $0x800d4b,%rax
+  800dd4:	00 00 00 
+  800dd7:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800dd9:	c9                   	leave
+  800dda:	c3                   	ret
+
+0000000000800ddb <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800ddb:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800dde:	74 10                	je     800df0 <strlen+0x15>
+    size_t n = 0;
+  800de0:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800de5:	48 83 c0 01          	add    $0x1,%rax
+  800de9:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800ded:	75 f6                	jne    800de5 <strlen+0xa>
+  800def:	c3                   	ret
+    size_t n = 0;
+  800df0:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800df5:	c3                   	ret
+
+0000000000800df6 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800df6:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800df9:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800dfe:	48 85 f6             	test   %rsi,%rsi
+  800e01:	74 11                	je     800e14 <strnlen+0x1e>
+  800e03:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800e07:	74 0c                	je     800e15 <strnlen+0x1f>
+  800e09:	48 83 c2 01          	add    $0x1,%rdx
+  800e0d:	48 39 d0             	cmp    %rdx,%rax
+  800e10:	75 f1                	jne    800e03 <strnlen+0xd>
+  800e12:	eb 04                	jmp    800e18 <strnlen+0x22>
+  800e14:	c3                   	ret
+  800e15:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800e18:	c3                   	ret
+
+0000000000800e19 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800e19:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800e1c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e21:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800e25:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800e28:	48 83 c2 01          	add    $0x1,%rdx
+  800e2c:	84 c9                	test   %cl,%cl
+  800e2e:	75 f1                	jne    800e21 <strcpy+0x8>
+        ;
+    return res;
+}
+  800e30:	c3                   	ret
+
+0000000000800e31 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800e31:	55                   	push   %rbp
+  800e32:	48 89 e5             	mov    %rsp,%rbp
+  800e35:	41 54                	push   %r12
+  800e37:	53                   	push   %rbx
+  800e38:	48 89 fb             	mov    %rdi,%rbx
+  800e3b:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800e3e:	48 b8 db 0d 80 00 00 	movabs $0x800ddb,%rax
+  800e45:	00 00 00 
+  800e48:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800e4a:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800e4e:	4c 89 e6             	mov    %r12,%rsi
+  800e51:	48 b8 19 0e 80 00 00 	movabs $0x800e19,%rax
+  800e58:	00 00 00 
+  800e5b:	ff d0                	call   *%rax
+    return dst;
+}
+  800e5d:	48 89 d8             	mov    %rbx,%rax
+  800e60:	5b                   	pop    %rbx
+  800e61:	41 5c                	pop    %r12
+  800e63:	5d                   	pop    %rbp
+  800e64:	c3                   	ret
+
+0000000000800e65 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800e65:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800e68:	48 85 d2             	test   %rdx,%rdx
+  800e6b:	74 1f                	je     800e8c <strncpy+0x27>
+  800e6d:	48 01 fa             	add    %rdi,%rdx
+  800e70:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800e73:	48 83 c1 01          	add    $0x1,%rcx
+  800e77:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800e7b:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800e7f:	41 80 f8 01          	cmp    $0x1,%r8b
+  800e83:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800e87:	48 39 ca             	cmp    %rcx,%rdx
+  800e8a:	75 e7                	jne    800e73 <strncpy+0xe>
+    }
+    return ret;
+}
+  800e8c:	c3                   	ret
+
+0000000000800e8d <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800e8d:	48 89 f8             	mov    %rdi,%rax
+  800e90:	48 85 d2             	test   %rdx,%rdx
+  800e93:	74 24                	je     800eb9 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800e95:	48 83 ea 01          	sub    $0x1,%rdx
+  800e99:	74 1b                	je     800eb6 <strlcpy+0x29>
+  800e9b:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800e9f:	0f b6 16             	movzbl (%rsi),%edx
+  800ea2:	84 d2                	test   %dl,%dl
+  800ea4:	74 10                	je     800eb6 <strlcpy+0x29>
+            *dst++ = *src++;
+  800ea6:	48 83 c6 01          	add    $0x1,%rsi
+  800eaa:	48 83 c0 01          	add    $0x1,%rax
+  800eae:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800eb1:	48 39 c8             	cmp    %rcx,%rax
+  800eb4:	75 e9                	jne    800e9f <strlcpy+0x12>
+        *dst = '\0';
+  800eb6:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800eb9:	48 29 f8             	sub    %rdi,%rax
+}
+  800ebc:	c3                   	ret
+
+0000000000800ebd <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800ebd:	0f b6 07             	movzbl (%rdi),%eax
+  800ec0:	84 c0                	test   %al,%al
+  800ec2:	74 13                	je     800ed7 <strcmp+0x1a>
+  800ec4:	38 06                	cmp    %al,(%rsi)
+  800ec6:	75 0f                	jne    800ed7 <strcmp+0x1a>
+  800ec8:	48 83 c7 01          	add    $0x1,%rdi
+  800ecc:	48 83 c6 01          	add    $0x1,%rsi
+  800ed0:	0f b6 07             	movzbl (%rdi),%eax
+  800ed3:	84 c0                	test   %al,%al
+  800ed5:	75 ed                	jne    800ec4 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800ed7:	0f b6 c0             	movzbl %al,%eax
+  800eda:	0f b6 16             	movzbl (%rsi),%edx
+  800edd:	29 d0                	sub    %edx,%eax
+}
+  800edf:	c3                   	ret
+
+0000000000800ee0 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800ee0:	48 85 d2             	test   %rdx,%rdx
+  800ee3:	74 1f                	je     800f04 <strncmp+0x24>
+  800ee5:	0f b6 07             	movzbl (%rdi),%eax
+  800ee8:	84 c0                	test   %al,%al
+  800eea:	74 1e                	je     800f0a <strncmp+0x2a>
+  800eec:	3a 06                	cmp    (%rsi),%al
+  800eee:	75 1a                	jne    800f0a <strncmp+0x2a>
+  800ef0:	48 83 c7 01          	add    $0x1,%rdi
+  800ef4:	48 83 c6 01          	add    $0x1,%rsi
+  800ef8:	48 83 ea 01          	sub    $0x1,%rdx
+  800efc:	75 e7                	jne    800ee5 <strncmp+0x5>
+
+    if (!n) return 0;
+  800efe:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f03:	c3                   	ret
+  800f04:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f09:	c3                   	ret
+  800f0a:	48 85 d2             	test   %rdx,%rdx
+  800f0d:	74 09                	je     800f18 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800f0f:	0f b6 07             	movzbl (%rdi),%eax
+  800f12:	0f b6 16             	movzbl (%rsi),%edx
+  800f15:	29 d0                	sub    %edx,%eax
+  800f17:	c3                   	ret
+    if (!n) return 0;
+  800f18:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800f1d:	c3                   	ret
+
+0000000000800f1e <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800f1e:	0f b6 17             	movzbl (%rdi),%edx
+  800f21:	84 d2                	test   %dl,%dl
+  800f23:	74 18                	je     800f3d <strchr+0x1f>
+        if (*str == c) {
+  800f25:	0f be d2             	movsbl %dl,%edx
+  800f28:	39 f2                	cmp    %esi,%edx
+  800f2a:	74 17                	je     800f43 <strchr+0x25>
+    for (; *str; str++) {
+  800f2c:	48 83 c7 01          	add    $0x1,%rdi
+  800f30:	0f b6 17             	movzbl (%rdi),%edx
+  800f33:	84 d2                	test   %dl,%dl
+  800f35:	75 ee                	jne    800f25 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800f37:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f3c:	c3                   	ret
+  800f3d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f42:	c3                   	ret
+  800f43:	48 89 f8             	mov    %rdi,%rax
+}
+  800f46:	c3                   	ret
+
+0000000000800f47 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800f47:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800f4a:	0f b6 17             	movzbl (%rdi),%edx
+  800f4d:	84 d2                	test   %dl,%dl
+  800f4f:	74 13                	je     800f64 <strfind+0x1d>
+  800f51:	0f be d2             	movsbl %dl,%edx
+  800f54:	39 f2                	cmp    %esi,%edx
+  800f56:	74 0b                	je     800f63 <strfind+0x1c>
+  800f58:	48 83 c0 01          	add    $0x1,%rax
+  800f5c:	0f b6 10             	movzbl (%rax),%edx
+  800f5f:	84 d2                	test   %dl,%dl
+  800f61:	75 ee                	jne    800f51 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800f63:	c3                   	ret
+  800f64:	c3                   	ret
+
+0000000000800f65 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800f65:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800f68:	48 89 f8             	mov    %rdi,%rax
+  800f6b:	48 f7 d8             	neg    %rax
+  800f6e:	83 e0 07             	and    $0x7,%eax
+  800f71:	49 89 d1             	mov    %rdx,%r9
+  800f74:	49 29 c1             	sub    %rax,%r9
+  800f77:	78 36                	js     800faf <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800f79:	40 0f b6 c6          	movzbl %sil,%eax
+  800f7d:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800f84:	01 01 01 
+  800f87:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800f8b:	40 f6 c7 07          	test   $0x7,%dil
+  800f8f:	75 38                	jne    800fc9 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800f91:	4c 89 c9             	mov    %r9,%rcx
+  800f94:	48 c1 f9 03          	sar    $0x3,%rcx
+  800f98:	74 0c                	je     800fa6 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800f9a:	fc                   	cld
+  800f9b:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800f9e:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800fa2:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800fa6:	4d 85 c9             	test   %r9,%r9
+  800fa9:	75 45                	jne    800ff0 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800fab:	4c 89 c0             	mov    %r8,%rax
+  800fae:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800faf:	48 85 d2             	test   %rdx,%rdx
+  800fb2:	74 f7                	je     800fab <memset+0x46>
+  800fb4:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800fb7:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800fba:	48 83 c0 01          	add    $0x1,%rax
+  800fbe:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  800fc2:	48 39 c2             	cmp    %rax,%rdx
+  800fc5:	75 f3                	jne    800fba <memset+0x55>
+  800fc7:	eb e2                	jmp    800fab <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  800fc9:	40 f6 c7 01          	test   $0x1,%dil
+  800fcd:	74 06                	je     800fd5 <memset+0x70>
+  800fcf:	88 07                	mov    %al,(%rdi)
+  800fd1:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800fd5:	40 f6 c7 02          	test   $0x2,%dil
+  800fd9:	74 07                	je     800fe2 <memset+0x7d>
+  800fdb:	66 89 07             	mov    %ax,(%rdi)
+  800fde:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800fe2:	40 f6 c7 04          	test   $0x4,%dil
+  800fe6:	74 a9                	je     800f91 <memset+0x2c>
+  800fe8:	89 07                	mov    %eax,(%rdi)
+  800fea:	48 83 c7 04          	add    $0x4,%rdi
+  800fee:	eb a1                	jmp    800f91 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800ff0:	41 f6 c1 04          	test   $0x4,%r9b
+  800ff4:	74 06                	je     800ffc <memset+0x97>
+  800ff6:	89 07                	mov    %eax,(%rdi)
+  800ff8:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800ffc:	41 f6 c1 02          	test   $0x2,%r9b
+  801000:	74 07                	je     801009 <memset+0xa4>
+  801002:	66 89 07             	mov    %ax,(%rdi)
+  801005:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  801009:	41 f6 c1 01          	test   $0x1,%r9b
+  80100d:	74 9c                	je     800fab <memset+0x46>
+  80100f:	88 07                	mov    %al,(%rdi)
+  801011:	eb 98                	jmp    800fab <memset+0x46>
+
+0000000000801013 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  801013:	48 89 f8             	mov    %rdi,%rax
+  801016:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  801019:	48 39 fe             	cmp    %rdi,%rsi
+  80101c:	73 3b                	jae    801059 <memmove+0x46>
+  80101e:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  801022:	48 39 d7             	cmp    %rdx,%rdi
+  801025:	73 32                	jae    801059 <memmove+0x46>
+        s += n;
+        d += n;
+  801027:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  80102b:	48 89 d6             	mov    %rdx,%rsi
+  80102e:	48 09 fe             	or     %rdi,%rsi
+  801031:	48 09 ce             	or     %rcx,%rsi
+  801034:	40 f6 c6 07          	test   $0x7,%sil
+  801038:	75 12                	jne    80104c <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  80103a:	48 83 ef 08          	sub    $0x8,%rdi
+  80103e:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  801042:	48 c1 e9 03          	shr    $0x3,%rcx
+  801046:	fd                   	std
+  801047:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  80104a:	fc                   	cld
+  80104b:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  80104c:	48 83 ef 01          	sub    $0x1,%rdi
+  801050:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  801054:	fd                   	std
+  801055:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  801057:	eb f1                	jmp    80104a <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  801059:	48 89 f2             	mov    %rsi,%rdx
+  80105c:	48 09 c2             	or     %rax,%rdx
+  80105f:	48 09 ca             	or     %rcx,%rdx
+  801062:	f6 c2 07             	test   $0x7,%dl
+  801065:	75 0c                	jne    801073 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  801067:	48 c1 e9 03          	shr    $0x3,%rcx
+  80106b:	48 89 c7             	mov    %rax,%rdi
+  80106e:	fc                   	cld
+  80106f:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  801072:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  801073:	48 89 c7             	mov    %rax,%rdi
+  801076:	fc                   	cld
+  801077:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  801079:	c3                   	ret
+
+000000000080107a <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  80107a:	55                   	push   %rbp
+  80107b:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  80107e:	48 b8 13 10 80 00 00 	movabs $0x801013,%rax
+  801085:	00 00 00 
+  801088:	ff d0                	call   *%rax
+}
+  80108a:	5d                   	pop    %rbp
+  80108b:	c3                   	ret
+
+000000000080108c <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  80108c:	55                   	push   %rbp
+  80108d:	48 89 e5             	mov    %rsp,%rbp
+  801090:	41 57                	push   %r15
+  801092:	41 56                	push   %r14
+  801094:	41 55                	push   %r13
+  801096:	41 54                	push   %r12
+  801098:	53                   	push   %rbx
+  801099:	48 83 ec 08          	sub    $0x8,%rsp
+  80109d:	49 89 fe             	mov    %rdi,%r14
+  8010a0:	49 89 f7             	mov    %rsi,%r15
+  8010a3:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  8010a6:	48 89 f7             	mov    %rsi,%rdi
+  8010a9:	48 b8 db 0d 80 00 00 	movabs $0x800ddb,%rax
+  8010b0:	00 00 00 
+  8010b3:	ff d0                	call   *%rax
+  8010b5:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  8010b8:	48 89 de             	mov    %rbx,%rsi
+  8010bb:	4c 89 f7             	mov    %r14,%rdi
+  8010be:	48 b8 f6 0d 80 00 00 	movabs $0x800df6,%rax
+  8010c5:	00 00 00 
+  8010c8:	ff d0                	call   *%rax
+  8010ca:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  8010cd:	48 39 c3             	cmp    %rax,%rbx
+  8010d0:	74 36                	je     801108 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  8010d2:	48 89 d8             	mov    %rbx,%rax
+  8010d5:	4c 29 e8             	sub    %r13,%rax
+  8010d8:	49 39 c4             	cmp    %rax,%r12
+  8010db:	73 31                	jae    80110e <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  8010dd:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  8010e2:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8010e6:	4c 89 fe             	mov    %r15,%rsi
+  8010e9:	48 b8 7a 10 80 00 00 	movabs $0x80107a,%rax
+  8010f0:	00 00 00 
+  8010f3:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  8010f5:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  8010f9:	48 83 c4 08          	add    $0x8,%rsp
+  8010fd:	5b                   	pop    %rbx
+  8010fe:	41 5c                	pop    %r12
+  801100:	41 5d                	pop    %r13
+  801102:	41 5e                	pop    %r14
+  801104:	41 5f                	pop    %r15
+  801106:	5d                   	pop    %rbp
+  801107:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  801108:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  80110c:	eb eb                	jmp    8010f9 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  80110e:	48 83 eb 01          	sub    $0x1,%rbx
+  801112:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  801116:	48 89 da             	mov    %rbx,%rdx
+  801119:	4c 89 fe             	mov    %r15,%rsi
+  80111c:	48 b8 7a 10 80 00 00 	movabs $0x80107a,%rax
+  801123:	00 00 00 
+  801126:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  801128:	49 01 de             	add    %rbx,%r14
+  80112b:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  801130:	eb c3                	jmp    8010f5 <strlcat+0x69>
+
+0000000000801132 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  801132:	48 85 d2             	test   %rdx,%rdx
+  801135:	74 2d                	je     801164 <memcmp+0x32>
+  801137:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  80113c:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  801140:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  801145:	44 38 c1             	cmp    %r8b,%cl
+  801148:	75 0f                	jne    801159 <memcmp+0x27>
+    while (n-- > 0) {
+  80114a:	48 83 c0 01          	add    $0x1,%rax
+  80114e:	48 39 c2             	cmp    %rax,%rdx
+  801151:	75 e9                	jne    80113c <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  801153:	b8 00 00 00 00       	mov    $0x0,%eax
+  801158:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  801159:	0f b6 c1             	movzbl %cl,%eax
+  80115c:	45 0f b6 c0          	movzbl %r8b,%r8d
+  801160:	44 29 c0             	sub    %r8d,%eax
+  801163:	c3                   	ret
+    return 0;
+  801164:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801169:	c3                   	ret
+
+000000000080116a <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  80116a:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  80116e:	48 39 c7             	cmp    %rax,%rdi
+  801171:	73 0f                	jae    801182 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  801173:	40 38 37             	cmp    %sil,(%rdi)
+  801176:	74 0e                	je     801186 <memfind+0x1c>
+    for (; src < end; src++) {
+  801178:	48 83 c7 01          	add    $0x1,%rdi
+  80117c:	48 39 f8             	cmp    %rdi,%rax
+  80117f:	75 f2                	jne    801173 <memfind+0x9>
+  801181:	c3                   	ret
+  801182:	48 89 f8             	mov    %rdi,%rax
+  801185:	c3                   	ret
+  801186:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  801189:	c3                   	ret
+
+000000000080118a <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  80118a:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  80118d:	0f b6 37             	movzbl (%rdi),%esi
+  801190:	40 80 fe 20          	cmp    $0x20,%sil
+  801194:	74 06                	je     80119c <strtol+0x12>
+  801196:	40 80 fe 09          	cmp    $0x9,%sil
+  80119a:	75 13                	jne    8011af <strtol+0x25>
+  80119c:	48 83 c7 01          	add    $0x1,%rdi
+  8011a0:	0f b6 37             	movzbl (%rdi),%esi
+  8011a3:	40 80 fe 20          	cmp    $0x20,%sil
+  8011a7:	74 f3                	je     80119c <strtol+0x12>
+  8011a9:	40 80 fe 09          	cmp    $0x9,%sil
+  8011ad:	74 ed                	je     80119c <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  8011af:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  8011b2:	83 e0 fd             	and    $0xfffffffd,%eax
+  8011b5:	3c 01                	cmp    $0x1,%al
+  8011b7:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8011bb:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  8011c1:	75 0f                	jne    8011d2 <strtol+0x48>
+  8011c3:	80 3f 30             	cmpb   $0x30,(%rdi)
+  8011c6:	74 14                	je     8011dc <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  8011c8:	85 d2                	test   %edx,%edx
+  8011ca:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8011cf:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  8011d2:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  8011d7:	4c 63 ca             	movslq %edx,%r9
+  8011da:	eb 36                	jmp    801212 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8011dc:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  8011e0:	74 0f                	je     8011f1 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  8011e2:	85 d2                	test   %edx,%edx
+  8011e4:	75 ec                	jne    8011d2 <strtol+0x48>
+        s++;
+  8011e6:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  8011ea:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  8011ef:	eb e1                	jmp    8011d2 <strtol+0x48>
+        s += 2;
+  8011f1:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  8011f5:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  8011fa:	eb d6                	jmp    8011d2 <strtol+0x48>
+            dig -= '0';
+  8011fc:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  8011ff:	44 0f b6 c1          	movzbl %cl,%r8d
+  801203:	41 39 d0             	cmp    %edx,%r8d
+  801206:	7d 21                	jge    801229 <strtol+0x9f>
+        val = val * base + dig;
+  801208:	49 0f af c1          	imul   %r9,%rax
+  80120c:	0f b6 c9             	movzbl %cl,%ecx
+  80120f:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  801212:	48 83 c7 01          	add    $0x1,%rdi
+  801216:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  80121a:	80 f9 39             	cmp    $0x39,%cl
+  80121d:	76 dd                	jbe    8011fc <strtol+0x72>
+        else if (dig - 'a' < 27)
+  80121f:	80 f9 7b             	cmp    $0x7b,%cl
+  801222:	77 05                	ja     801229 <strtol+0x9f>
+            dig -= 'a' - 10;
+  801224:	83 e9 57             	sub    $0x57,%ecx
+  801227:	eb d6                	jmp    8011ff <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  801229:	4d 85 d2             	test   %r10,%r10
+  80122c:	74 03                	je     801231 <strtol+0xa7>
+  80122e:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  801231:	48 89 c2             	mov    %rax,%rdx
+  801234:	48 f7 da             	neg    %rdx
+  801237:	40 80 fe 2d          	cmp    $0x2d,%sil
+  80123b:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  80123f:	c3                   	ret
+
+0000000000801240 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  801240:	55                   	push   %rbp
+  801241:	48 89 e5             	mov    %rsp,%rbp
+  801244:	53                   	push   %rbx
+  801245:	48 89 fa             	mov    %rdi,%rdx
+  801248:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80124b:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801250:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801255:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80125a:	be 00 00 00 00       	mov    $0x0,%esi
+  80125f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801265:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  801267:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80126b:	c9                   	leave
+  80126c:	c3                   	ret
+
+000000000080126d <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  80126d:	55                   	push   %rbp
+  80126e:	48 89 e5             	mov    %rsp,%rbp
+  801271:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801272:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801277:	ba 00 00 00 00       	mov    $0x0,%edx
+  80127c:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801281:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801286:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80128b:	be 00 00 00 00       	mov    $0x0,%esi
+  801290:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801296:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  801298:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80129c:	c9                   	leave
+  80129d:	c3                   	ret
+
+000000000080129e <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  80129e:	55                   	push   %rbp
+  80129f:	48 89 e5             	mov    %rsp,%rbp
+  8012a2:	53                   	push   %rbx
+  8012a3:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  8012a7:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8012aa:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8012af:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8012b4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012b9:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012be:	be 00 00 00 00       	mov    $0x0,%esi
+  8012c3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8012c9:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8012cb:	48 85 c0             	test   %rax,%rax
+  8012ce:	7f 06                	jg     8012d6 <sys_env_destroy+0x38>
+}
+  8012d0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012d4:	c9                   	leave
+  8012d5:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8012d6:	49 89 c0             	mov    %rax,%r8
+  8012d9:	b9 03 00 00 00       	mov    $0x3,%ecx
+  8012de:	48 ba f0 36 80 00 00 	movabs $0x8036f0,%rdx
+  8012e5:	00 00 00 
+  8012e8:	be 26 00 00 00       	mov    $0x26,%esi
+  8012ed:	48 bf 0f 37 80 00 00 	movabs $0x80370f,%rdi
+  8012f4:	00 00 00 
+  8012f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012fc:	49 b9 a4 03 80 00 00 	movabs $0x8003a4,%r9
+  801303:	00 00 00 
+  801306:	41 ff d1             	call   *%r9
+
+0000000000801309 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  801309:	55                   	push   %rbp
+  80130a:	48 89 e5             	mov    %rsp,%rbp
+  80130d:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80130e:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801313:	ba 00 00 00 00       	mov    $0x0,%edx
+  801318:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80131d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801322:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801327:	be 00 00 00 00       	mov    $0x0,%esi
+  80132c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801332:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  801334:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801338:	c9                   	leave
+  801339:	c3                   	ret
+
+000000000080133a <sys_yield>:
+
+void
+sys_yield(void) {
+  80133a:	55                   	push   %rbp
+  80133b:	48 89 e5             	mov    %rsp,%rbp
+  80133e:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80133f:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801344:	ba 00 00 00 00       	mov    $0x0,%edx
+  801349:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80134e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801353:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801358:	be 00 00 00 00       	mov    $0x0,%esi
+  80135d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801363:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  801365:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801369:	c9                   	leave
+  80136a:	c3                   	ret
+
+000000000080136b <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  80136b:	55                   	push   %rbp
+  80136c:	48 89 e5             	mov    %rsp,%rbp
+  80136f:	53                   	push   %rbx
+  801370:	48 89 fa             	mov    %rdi,%rdx
+  801373:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801376:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80137b:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  801382:	00 00 00 
+  801385:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80138a:	be 00 00 00 00       	mov    $0x0,%esi
+  80138f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801395:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  801397:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80139b:	c9                   	leave
+  80139c:	c3                   	ret
+
+000000000080139d <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  80139d:	55                   	push   %rbp
+  80139e:	48 89 e5             	mov    %rsp,%rbp
+  8013a1:	53                   	push   %rbx
+  8013a2:	49 89 f8             	mov    %rdi,%r8
+  8013a5:	48 89 d3             	mov    %rdx,%rbx
+  8013a8:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8013ab:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8013b0:	4c 89 c2             	mov    %r8,%rdx
+  8013b3:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013b6:	be 00 00 00 00       	mov    $0x0,%esi
+  8013bb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013c1:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  8013c3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013c7:	c9                   	leave
+  8013c8:	c3                   	ret
+
+00000000008013c9 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  8013c9:	55                   	push   %rbp
+  8013ca:	48 89 e5             	mov    %rsp,%rbp
+  8013cd:	53                   	push   %rbx
+  8013ce:	48 83 ec 08          	sub    $0x8,%rsp
+  8013d2:	89 f8                	mov    %edi,%eax
+  8013d4:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  8013d7:	48 63 f9             	movslq %ecx,%rdi
+  8013da:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8013dd:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8013e2:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013e5:	be 00 00 00 00       	mov    $0x0,%esi
+  8013ea:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013f0:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8013f2:	48 85 c0             	test   %rax,%rax
+  8013f5:	7f 06                	jg     8013fd <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  8013f7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013fb:	c9                   	leave
+  8013fc:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8013fd:	49 89 c0             	mov    %rax,%r8
+  801400:	b9 04 00 00 00       	mov    $0x4,%ecx
+  801405:	48 ba f0 36 80 00 00 	movabs $0x8036f0,%rdx
+  80140c:	00 00 00 
+  80140f:	be 26 00 00 00       	mov    $0x26,%esi
+  801414:	48 bf 0f 37 80 00 00 	movabs $0x80370f,%rdi
+  80141b:	00 00 00 
+  80141e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801423:	49 b9 a4 03 80 00 00 	movabs $0x8003a4,%r9
+  80142a:	00 00 00 
+  80142d:	41 ff d1             	call   *%r9
+
+0000000000801430 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801430:	55                   	push   %rbp
+  801431:	48 89 e5             	mov    %rsp,%rbp
+  801434:	53                   	push   %rbx
+  801435:	48 83 ec 08          	sub    $0x8,%rsp
+  801439:	89 f8                	mov    %edi,%eax
+  80143b:	49 89 f2             	mov    %rsi,%r10
+  80143e:	48 89 cf             	mov    %rcx,%rdi
+  801441:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  801444:	48 63 da             	movslq %edx,%rbx
+  801447:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80144a:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80144f:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801452:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  801455:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801457:	48 85 c0             	test   %rax,%rax
+  80145a:	7f 06                	jg     801462 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  80145c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801460:	c9                   	leave
+  801461:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801462:	49 89 c0             	mov    %rax,%r8
+  801465:	b9 05 00 00 00       	mov    $0x5,%ecx
+  80146a:	48 ba f0 36 80 00 00 	movabs $0x8036f0,%rdx
+  801471:	00 00 00 
+  801474:	be 26 00 00 00       	mov    $0x26,%esi
+  801479:	48 bf 0f 37 80 00 00 	movabs $0x80370f,%rdi
+  801480:	00 00 00 
+  801483:	b8 00 00 00 00       	mov    $0x0,%eax
+  801488:	49 b9 a4 03 80 00 00 	movabs $0x8003a4,%r9
+  80148f:	00 00 00 
+  801492:	41 ff d1             	call   *%r9
+
+0000000000801495 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  801495:	55                   	push   %rbp
+  801496:	48 89 e5             	mov    %rsp,%rbp
+  801499:	53                   	push   %rbx
+  80149a:	48 83 ec 08          	sub    $0x8,%rsp
+  80149e:	48 89 f1             	mov    %rsi,%rcx
+  8014a1:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  8014a4:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8014a7:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8014ac:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014b1:	be 00 00 00 00       	mov    $0x0,%esi
+  8014b6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014bc:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8014be:	48 85 c0             	test   %rax,%rax
+  8014c1:	7f 06                	jg     8014c9 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  8014c3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014c7:	c9                   	leave
+  8014c8:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8014c9:	49 89 c0             	mov    %rax,%r8
+  8014cc:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8014d1:	48 ba f0 36 80 00 00 	movabs $0x8036f0,%rdx
+  8014d8:	00 00 00 
+  8014db:	be 26 00 00 00       	mov    $0x26,%esi
+  8014e0:	48 bf 0f 37 80 00 00 	movabs $0x80370f,%rdi
+  8014e7:	00 00 00 
+  8014ea:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014ef:	49 b9 a4 03 80 00 00 	movabs $0x8003a4,%r9
+  8014f6:	00 00 00 
+  8014f9:	41 ff d1             	call   *%r9
+
+00000000008014fc <sys_region_batch>:
+
+int
+sys_region_batch(const struct RegionOp *ops, size_t count) {
+  8014fc:	55                   	push   %rbp
+  8014fd:	48 89 e5             	mov    %rsp,%rbp
+  801500:	53                   	push   %rbx
+  801501:	48 83 ec 08          	sub    $0x8,%rsp
+  801505:	48 89 fa             	mov    %rdi,%rdx
+  801508:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80150b:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801510:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801515:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80151a:	be 00 00 00 00       	mov    $0x0,%esi
+  80151f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801525:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801527:	48 85 c0             	test   %rax,%rax
+  80152a:	7f 06                	jg     801532 <sys_region_batch+0x36>
+        else
+            platform_asan_unpoison(va, ops[i].size);
+    }
+#endif
+    return res;
+}
+  80152c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801530:	c9                   	leave
+  801531:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801532:	49 89 c0             	mov    %rax,%r8
+  801535:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  80153a:	48 ba f0 36 80 00 00 	movabs $0x8036f0,%rdx
+  801541:	00 00 00 
+  801544:	be 26 00 00 00       	mov    $0x26,%esi
+  801549:	48 bf 0f 37 80 00 00 	movabs $0x80370f,%rdi
+  801550:	00 00 00 
+  801553:	b8 00 00 00 00       	mov    $0x0,%eax
+  801558:	49 b9 a4 03 80 00 00 	movabs $0x8003a4,%r9
+  80155f:	00 00 00 
+  801562:	41 ff d1             	call   *%r9
+
+0000000000801565 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  801565:	55                   	push   %rbp
+  801566:	48 89 e5             	mov    %rsp,%rbp
+  801569:	53                   	push   %rbx
+  80156a:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  80156e:	48 63 ce             	movslq %esi,%rcx
+  801571:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801574:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801579:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80157e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801583:	be 00 00 00 00       	mov    $0x0,%esi
+  801588:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80158e:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801590:	48 85 c0             	test   %rax,%rax
+  801593:	7f 06                	jg     80159b <sys_env_set_status+0x36>
+}
+  801595:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801599:	c9                   	leave
+  80159a:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80159b:	49 89 c0             	mov    %rax,%r8
+  80159e:	b9 09 00 00 00       	mov    $0x9,%ecx
+  8015a3:	48 ba f0 36 80 00 00 	movabs $0x8036f0,%rdx
+  8015aa:	00 00 00 
+  8015ad:	be 26 00 00 00       	mov    $0x26,%esi
+  8015b2:	48 bf 0f 37 80 00 00 	movabs $0x80370f,%rdi
+  8015b9:	00 00 00 
+  8015bc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015c1:	49 b9 a4 03 80 00 00 	movabs $0x8003a4,%r9
+  8015c8:	00 00 00 
+  8015cb:	41 ff d1             	call   *%r9
+
+00000000008015ce <sys_env_set_weight>:
+
+int
+sys_env_set_weight(envid_t envid, uint32_t weight) {
+  8015ce:	55                   	push   %rbp
+  8015cf:	48 89 e5             	mov    %rsp,%rbp
+  8015d2:	53                   	push   %rbx
+  8015d3:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_weight, 1, envid, weight, 0, 0, 0, 0);
+  8015d7:	89 f1                	mov    %esi,%ecx
+  8015d9:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8015dc:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8015e1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015e6:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015eb:	be 00 00 00 00       	mov    $0x0,%esi
+  8015f0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015f6:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8015f8:	48 85 c0             	test   %rax,%rax
+  8015fb:	7f 06                	jg     801603 <sys_env_set_weight+0x35>
+}
+  8015fd:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801601:	c9                   	leave
+  801602:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801603:	49 89 c0             	mov    %rax,%r8
+  801606:	b9 10 00 00 00       	mov    $0x10,%ecx
+  80160b:	48 ba f0 36 80 00 00 	movabs $0x8036f0,%rdx
+  801612:	00 00 00 
+  801615:	be 26 00 00 00       	mov    $0x26,%esi
+  80161a:	48 bf 0f 37 80 00 00 	movabs $0x80370f,%rdi
+  801621:	00 00 00 
+  801624:	b8 00 00 00 00       	mov    $0x0,%eax
+  801629:	49 b9 a4 03 80 00 00 	movabs $0x8003a4,%r9
+  801630:	00 00 00 
+  801633:	41 ff d1             	call   *%r9
+
+0000000000801636 <sys_env_set_rt>:
+
+int
+sys_env_set_rt(envid_t envid, uint64_t period, uint64_t budget, uint64_t deadline) {
+  801636:	55                   	push   %rbp
+  801637:	48 89 e5             	mov    %rsp,%rbp
+  80163a:	53                   	push   %rbx
+  80163b:	48 83 ec 08          	sub    $0x8,%rsp
+  80163f:	89 f8                	mov    %edi,%eax
+  801641:	48 89 d3             	mov    %rdx,%rbx
+  801644:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_env_set_rt, 1, envid, period, budget, deadline, 0, 0);
+  801647:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80164a:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80164f:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801652:	be 00 00 00 00       	mov    $0x0,%esi
+  801657:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80165d:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80165f:	48 85 c0             	test   %rax,%rax
+  801662:	7f 06                	jg     80166a <sys_env_set_rt+0x34>
+}
+  801664:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801668:	c9                   	leave
+  801669:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80166a:	49 89 c0             	mov    %rax,%r8
+  80166d:	b9 11 00 00 00       	mov    $0x11,%ecx
+  801672:	48 ba f0 36 80 00 00 	movabs $0x8036f0,%rdx
+  801679:	00 00 00 
+  80167c:	be 26 00 00 00       	mov    $0x26,%esi
+  801681:	48 bf 0f 37 80 00 00 	movabs $0x80370f,%rdi
+  801688:	00 00 00 
+  80168b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801690:	49 b9 a4 03 80 00 00 	movabs $0x8003a4,%r9
+  801697:	00 00 00 
+  80169a:	41 ff d1             	call   *%r9
+
+000000000080169d <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  80169d:	55                   	push   %rbp
+  80169e:	48 89 e5             	mov    %rsp,%rbp
+  8016a1:	53                   	push   %rbx
+  8016a2:	48 83 ec 08          	sub    $0x8,%rsp
+  8016a6:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  8016a9:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8016ac:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8016b1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016b6:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8016bb:	be 00 00 00 00       	mov    $0x0,%esi
+  8016c0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8016c6:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8016c8:	48 85 c0             	test   %rax,%rax
+  8016cb:	7f 06                	jg     8016d3 <sys_env_set_trapframe+0x36>
+}
+  8016cd:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8016d1:	c9                   	leave
+  8016d2:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8016d3:	49 89 c0             	mov    %rax,%r8
+  8016d6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  8016db:	48 ba f0 36 80 00 00 	movabs $0x8036f0,%rdx
+  8016e2:	00 00 00 
+  8016e5:	be 26 00 00 00       	mov    $0x26,%esi
+  8016ea:	48 bf 0f 37 80 00 00 	movabs $0x80370f,%rdi
+  8016f1:	00 00 00 
+  8016f4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016f9:	49 b9 a4 03 80 00 00 	movabs $0x8003a4,%r9
+  801700:	00 00 00 
+  801703:	41 ff d1             	call   *%r9
+
+0000000000801706 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  801706:	55                   	push   %rbp
+  801707:	48 89 e5             	mov    %rsp,%rbp
+  80170a:	53                   	push   %rbx
+  80170b:	48 83 ec 08          	sub    $0x8,%rsp
+  80170f:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  801712:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801715:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80171a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80171f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801724:	be 00 00 00 00       	mov    $0x0,%esi
+  801729:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80172f:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801731:	48 85 c0             	test   %rax,%rax
+  801734:	7f 06                	jg     80173c <sys_env_set_pgfault_upcall+0x36>
+}
+  801736:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80173a:	c9                   	leave
+  80173b:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80173c:	49 89 c0             	mov    %rax,%r8
+  80173f:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  801744:	48 ba f0 36 80 00 00 	movabs $0x8036f0,%rdx
+  80174b:	00 00 00 
+  80174e:	be 26 00 00 00       	mov    $0x26,%esi
+  801753:	48 bf 0f 37 80 00 00 	movabs $0x80370f,%rdi
+  80175a:	00 00 00 
+  80175d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801762:	49 b9 a4 03 80 00 00 	movabs $0x8003a4,%r9
+  801769:	00 00 00 
+  80176c:	41 ff d1             	call   *%r9
+
+000000000080176f <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  80176f:	55                   	push   %rbp
+  801770:	48 89 e5             	mov    %rsp,%rbp
+  801773:	53                   	push   %rbx
+  801774:	89 f8                	mov    %edi,%eax
+  801776:	49 89 f1             	mov    %rsi,%r9
+  801779:	48 89 d3             	mov    %rdx,%rbx
+  80177c:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  80177f:	49 63 f0             	movslq %r8d,%rsi
+  801782:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801785:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80178a:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80178d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801793:	cd 30                	int    $0x30
+}
+  801795:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801799:	c9                   	leave
+  80179a:	c3                   	ret
+
+000000000080179b <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  80179b:	55                   	push   %rbp
+  80179c:	48 89 e5             	mov    %rsp,%rbp
+  80179f:	53                   	push   %rbx
+  8017a0:	48 83 ec 08          	sub    $0x8,%rsp
+  8017a4:	48 89 fa             	mov    %rdi,%rdx
+  8017a7:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8017aa:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8017af:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017b4:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8017b9:	be 00 00 00 00       	mov    $0x0,%esi
+  8017be:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8017c4:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8017c6:	48 85 c0             	test   %rax,%rax
+  8017c9:	7f 06                	jg     8017d1 <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8017cb:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8017cf:	c9                   	leave
+  8017d0:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8017d1:	49 89 c0             	mov    %rax,%r8
+  8017d4:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  8017d9:	48 ba f0 36 80 00 00 	movabs $0x8036f0,%rdx
+  8017e0:	00 00 00 
+  8017e3:	be 26 00 00 00       	mov    $0x26,%esi
+  8017e8:	48 bf 0f 37 80 00 00 	movabs $0x80370f,%rdi
+  8017ef:	00 00 00 
+  8017f2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017f7:	49 b9 a4 03 80 00 00 	movabs $0x8003a4,%r9
+  8017fe:	00 00 00 
+  801801:	41 ff d1             	call   *%r9
+
+0000000000801804 <fork>:
+ * Hint:
+ *   Use sys_map_region, it can perform address space copying in one call
+ *   Remember to fix "thisenv" in the child process.
+ */
+envid_t
+fork(void) {
+  801804:	55                   	push   %rbp
+  801805:	48 89 e5             	mov    %rsp,%rbp
+  801808:	41 55                	push   %r13
+  80180a:	41 54                	push   %r12
+  80180c:	53                   	push   %rbx
+  80180d:	48 83 ec 08          	sub    $0x8,%rsp
+
+/* This must be inlined. Exercise for reader: why? */
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+    envid_t ret;
+    asm volatile("int %2"
+  801811:	b8 08 00 00 00       	mov    $0x8,%eax
+  801816:	cd 30                	int    $0x30
+  801818:	41 89 c5             	mov    %eax,%r13d
+    // LAB 9: Your code here
+
+    envid_t child_id = sys_exofork();
+    if (child_id < 0) {
+  80181b:	85 c0                	test   %eax,%eax
+  80181d:	0f 88 ae 00 00 00    	js     8018d1 <fork+0xcd>
+  801823:	89 c3                	mov    %eax,%ebx
+        return child_id;
+    }
+    if (child_id == 0) {
+  801825:	0f 84 b4 00 00 00    	je     8018df <fork+0xdb>
+        thisenv = &envs[ENVX(sys_getenvid())];
+        return 0;
+    }
+    int res = sys_map_region(0, NULL, child_id, NULL, MAX_USER_ADDRESS, PROT_ALL | PROT_LAZY | PROT_COMBINE);
+  80182b:	41 b9 df 01 00 00    	mov    $0x1df,%r9d
+  801831:	49 b8 00 00 00 00 80 	movabs $0x8000000000,%r8
+  801838:	00 00 00 
+  80183b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801840:	89 c2                	mov    %eax,%edx
+  801842:	be 00 00 00 00       	mov    $0x0,%esi
+  801847:	bf 00 00 00 00       	mov    $0x0,%edi
+  80184c:	48 b8 30 14 80 00 00 	movabs $0x801430,%rax
+  801853:	00 00 00 
+  801856:	ff d0                	call   *%rax
+  801858:	41 89 c4             	mov    %eax,%r12d
+    if (res < 0) {
+  80185b:	85 c0                	test   %eax,%eax
+  80185d:	78 5d                	js     8018bc <fork+0xb8>
+        goto error;
+    }
+    res = sys_env_set_pgfault_upcall(child_id, envs[ENVX(sys_getenvid())].env_pgfault_upcall);
+  80185f:	48 b8 09 13 80 00 00 	movabs $0x801309,%rax
+  801866:	00 00 00 
+  801869:	ff d0                	call   *%rax
+  80186b:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801870:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+  801877:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  80187e:	00 00 00 
+  801881:	48 01 d0             	add    %rdx,%rax
+  801884:	48 8b b0 88 01 00 00 	mov    0x188(%rax),%rsi
+  80188b:	44 89 ef             	mov    %r13d,%edi
+  80188e:	48 b8 06 17 80 00 00 	movabs $0x801706,%rax
+  801895:	00 00 00 
+  801898:	ff d0                	call   *%rax
+  80189a:	41 89 c4             	mov    %eax,%r12d
+    if (res < 0) {
+  80189d:	85 c0                	test   %eax,%eax
+  80189f:	78 1b                	js     8018bc <fork+0xb8>
+        goto error;
+    }
+    res = sys_env_set_status(child_id, ENV_RUNNABLE);
+  8018a1:	be 02 00 00 00       	mov    $0x2,%esi
+  8018a6:	44 89 ef             	mov    %r13d,%edi
+  8018a9:	48 b8 65 15 80 00 00 	movabs $0x801565,%rax
+  8018b0:	00 00 00 
+  8018b3:	ff d0                	call   *%rax
+  8018b5:	41 89 c4             	mov    %eax,%r12d
+    if (res < 0) {
+  8018b8:	85 c0                	test   %eax,%eax
+  8018ba:	79 15                	jns    8018d1 <fork+0xcd>
+        goto error;
+    }
+    return child_id;
+error:
+    ;
+    int res2 = sys_env_destroy(child_id);
+  8018bc:	89 df                	mov    %ebx,%edi
+  8018be:	48 b8 9e 12 80 00 00 	movabs $0x80129e,%rax
+  8018c5:	00 00 00 
+  8018c8:	ff d0                	call   *%rax
+    if (res2 < 0) {
+  8018ca:	85 c0                	test   %eax,%eax
+  8018cc:	78 42                	js     801910 <fork+0x10c>
+        panic("Fork double fault");
+    }
+    return res;
+  8018ce:	45 89 e5             	mov    %r12d,%r13d
+}
+  8018d1:	44 89 e8             	mov    %r13d,%eax
+  8018d4:	48 83 c4 08          	add    $0x8,%rsp
+  8018d8:	5b                   	pop    %rbx
+  8018d9:	41 5c                	pop    %r12
+  8018db:	41 5d                	pop    %r13
+  8018dd:	5d                   	pop    %rbp
+  8018de:	c3                   	ret
+        thisenv = &envs[ENVX(sys_getenvid())];
+  8018df:	48 b8 09 13 80 00 00 	movabs $0x801309,%rax
+  8018e6:	00 00 00 
+  8018e9:	ff d0                	call   *%rax
+  8018eb:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8018f0:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+  8018f7:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8018fe:	00 00 00 
+  801901:	48 01 d0             	add    %rdx,%rax
+  801904:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  80190b:	00 00 00 
+        return 0;
+  80190e:	eb c1                	jmp    8018d1 <fork+0xcd>
+        panic("Fork double fault");
+  801910:	48 ba 1d 37 80 00 00 	movabs $0x80371d,%rdx
+  801917:	00 00 00 
+  80191a:	be 2f 00 00 00       	mov    $0x2f,%esi
+  80191f:	48 bf 2f 37 80 00 00 	movabs $0x80372f,%rdi
+  801926:	00 00 00 
+  801929:	b8 00 00 00 00       	mov    $0x0,%eax
+  80192e:	48 b9 a4 03 80 00 00 	movabs $0x8003a4,%rcx
+  801935:	00 00 00 
+  801938:	ff d1                	call   *%rcx
+
+000000000080193a <sfork>:
+
+envid_t
+sfork() {
+  80193a:	55                   	push   %rbp
+  80193b:	48 89 e5             	mov    %rsp,%rbp
+    panic("sfork() is not implemented");
+  80193e:	48 ba 3a 37 80 00 00 	movabs $0x80373a,%rdx
+  801945:	00 00 00 
+  801948:	be 36 00 00 00       	mov    $0x36,%esi
+  80194d:	48 bf 2f 37 80 00 00 	movabs $0x80372f,%rdi
+  801954:	00 00 00 
+  801957:	b8 00 00 00 00       	mov    $0x0,%eax
+  80195c:	48 b9 a4 03 80 00 00 	movabs $0x8003a4,%rcx
+  801963:	00 00 00 
+  801966:	ff d1                	call   *%rcx
+
+0000000000801968 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801968:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  80196f:	ff ff ff 
+  801972:	48 01 f8             	add    %rdi,%rax
+  801975:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  801979:	c3                   	ret
+
+000000000080197a <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80197a:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801981:	ff ff ff 
+  801984:	48 01 f8             	add    %rdi,%rax
+  801987:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  80198b:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  801991:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  801995:	c3                   	ret
+
+0000000000801996 <fd_alloc_from>:
+}
+
+/* Like fd_alloc(), but only considers fds starting from fdnum,
+ * so that several fds can be found before their pages are allocated */
+int
+fd_alloc_from(int fdnum, struct Fd **fd_store) {
+  801996:	55                   	push   %rbp
+  801997:	48 89 e5             	mov    %rsp,%rbp
+  80199a:	41 57                	push   %r15
+  80199c:	41 56                	push   %r14
+  80199e:	41 55                	push   %r13
+  8019a0:	41 54                	push   %r12
+  8019a2:	53                   	push   %rbx
+  8019a3:	48 83 ec 08          	sub    $0x8,%rsp
+  8019a7:	49 89 f7             	mov    %rsi,%r15
+    for (int i = MAX(fdnum, 0); i < MAXFD; i++) {
+  8019aa:	85 ff                	test   %edi,%edi
+  8019ac:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8019b2:	44 0f 49 e7          	cmovns %edi,%r12d
+  8019b6:	83 ff 1f             	cmp    $0x1f,%edi
+  8019b9:	7f 37                	jg     8019f2 <fd_alloc_from+0x5c>
+  8019bb:	49 63 dc             	movslq %r12d,%rbx
+  8019be:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  8019c5:	48 c1 e3 0c          	shl    $0xc,%rbx
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  8019c9:	49 be 9f 2a 80 00 00 	movabs $0x802a9f,%r14
+  8019d0:	00 00 00 
+        struct Fd *fd = INDEX2FD(i);
+  8019d3:	49 89 dd             	mov    %rbx,%r13
+        if (!(get_prot(fd) & PROT_R)) {
+  8019d6:	48 89 df             	mov    %rbx,%rdi
+  8019d9:	41 ff d6             	call   *%r14
+  8019dc:	83 e0 04             	and    $0x4,%eax
+  8019df:	74 1c                	je     8019fd <fd_alloc_from+0x67>
+    for (int i = MAX(fdnum, 0); i < MAXFD; i++) {
+  8019e1:	41 83 c4 01          	add    $0x1,%r12d
+  8019e5:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8019ec:	41 83 fc 1f          	cmp    $0x1f,%r12d
+  8019f0:	7e e1                	jle    8019d3 <fd_alloc_from+0x3d>
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  8019f2:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  8019f8:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  8019fd:	4d 89 2f             	mov    %r13,(%r15)
+}
+  801a00:	48 83 c4 08          	add    $0x8,%rsp
+  801a04:	5b                   	pop    %rbx
+  801a05:	41 5c                	pop    %r12
+  801a07:	41 5d                	pop    %r13
+  801a09:	41 5e                	pop    %r14
+  801a0b:	41 5f                	pop    %r15
+  801a0d:	5d                   	pop    %rbp
+  801a0e:	c3                   	ret
+
+0000000000801a0f <fd_alloc>:
+fd_alloc(struct Fd **fd_store) {
+  801a0f:	55                   	push   %rbp
+  801a10:	48 89 e5             	mov    %rsp,%rbp
+  801a13:	48 89 fe             	mov    %rdi,%rsi
+    return fd_alloc_from(0, fd_store);
+  801a16:	bf 00 00 00 00       	mov    $0x0,%edi
+  801a1b:	48 b8 96 19 80 00 00 	movabs $0x801996,%rax
+  801a22:	00 00 00 
+  801a25:	ff d0                	call   *%rax
+}
+  801a27:	5d                   	pop    %rbp
+  801a28:	c3                   	ret
+
+0000000000801a29 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  801a29:	83 ff 1f             	cmp    $0x1f,%edi
+  801a2c:	77 39                	ja     801a67 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  801a2e:	55                   	push   %rbp
+  801a2f:	48 89 e5             	mov    %rsp,%rbp
+  801a32:	41 54                	push   %r12
+  801a34:	53                   	push   %rbx
+  801a35:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  801a38:	48 63 df             	movslq %edi,%rbx
+  801a3b:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  801a42:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  801a46:	48 89 df             	mov    %rbx,%rdi
+  801a49:	48 b8 9f 2a 80 00 00 	movabs $0x802a9f,%rax
+  801a50:	00 00 00 
+  801a53:	ff d0                	call   *%rax
+  801a55:	a8 04                	test   $0x4,%al
+  801a57:	74 14                	je     801a6d <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  801a59:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  801a5d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801a62:	5b                   	pop    %rbx
+  801a63:	41 5c                	pop    %r12
+  801a65:	5d                   	pop    %rbp
+  801a66:	c3                   	ret
+        return -E_INVAL;
+  801a67:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801a6c:	c3                   	ret
+        return -E_INVAL;
+  801a6d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801a72:	eb ee                	jmp    801a62 <fd_lookup+0x39>
+
+0000000000801a74 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  801a74:	55                   	push   %rbp
+  801a75:	48 89 e5             	mov    %rsp,%rbp
+  801a78:	41 54                	push   %r12
+  801a7a:	53                   	push   %rbx
+  801a7b:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  801a7e:	48 b8 e0 37 80 00 00 	movabs $0x8037e0,%rax
+  801a85:	00 00 00 
+  801a88:	48 bb 20 40 80 00 00 	movabs $0x804020,%rbx
+  801a8f:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  801a92:	39 3b                	cmp    %edi,(%rbx)
+  801a94:	74 47                	je     801add <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  801a96:	48 83 c0 08          	add    $0x8,%rax
+  801a9a:	48 8b 18             	mov    (%rax),%rbx
+  801a9d:	48 85 db             	test   %rbx,%rbx
+  801aa0:	75 f0                	jne    801a92 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801aa2:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801aa9:	00 00 00 
+  801aac:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+  801ab2:	89 fa                	mov    %edi,%edx
+  801ab4:	48 bf 58 37 80 00 00 	movabs $0x803758,%rdi
+  801abb:	00 00 00 
+  801abe:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ac3:	48 b9 f4 04 80 00 00 	movabs $0x8004f4,%rcx
+  801aca:	00 00 00 
+  801acd:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  801acf:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  801ad4:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  801ad8:	5b                   	pop    %rbx
+  801ad9:	41 5c                	pop    %r12
+  801adb:	5d                   	pop    %rbp
+  801adc:	c3                   	ret
+            return 0;
+  801add:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ae2:	eb f0                	jmp    801ad4 <dev_lookup+0x60>
+
+0000000000801ae4 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  801ae4:	55                   	push   %rbp
+  801ae5:	48 89 e5             	mov    %rsp,%rbp
+  801ae8:	41 55                	push   %r13
+  801aea:	41 54                	push   %r12
+  801aec:	53                   	push   %rbx
+  801aed:	48 83 ec 18          	sub    $0x18,%rsp
+  801af1:	48 89 fb             	mov    %rdi,%rbx
+  801af4:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801af7:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  801afe:	ff ff ff 
+  801b01:	48 01 df             	add    %rbx,%rdi
+  801b04:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  801b08:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801b0c:	48 b8 29 1a 80 00 00 	movabs $0x801a29,%rax
+  801b13:	00 00 00 
+  801b16:	ff d0                	call   *%rax
+  801b18:	41 89 c5             	mov    %eax,%r13d
+  801b1b:	85 c0                	test   %eax,%eax
+  801b1d:	78 06                	js     801b25 <fd_close+0x41>
+  801b1f:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  801b23:	74 1a                	je     801b3f <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  801b25:	45 84 e4             	test   %r12b,%r12b
+  801b28:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b2d:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  801b31:	44 89 e8             	mov    %r13d,%eax
+  801b34:	48 83 c4 18          	add    $0x18,%rsp
+  801b38:	5b                   	pop    %rbx
+  801b39:	41 5c                	pop    %r12
+  801b3b:	41 5d                	pop    %r13
+  801b3d:	5d                   	pop    %rbp
+  801b3e:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801b3f:	8b 3b                	mov    (%rbx),%edi
+  801b41:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801b45:	48 b8 74 1a 80 00 00 	movabs $0x801a74,%rax
+  801b4c:	00 00 00 
+  801b4f:	ff d0                	call   *%rax
+  801b51:	41 89 c5             	mov    %eax,%r13d
+  801b54:	85 c0                	test   %eax,%eax
+  801b56:	78 1b                	js     801b73 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  801b58:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801b5c:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801b60:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801b66:	48 85 c0             	test   %rax,%rax
+  801b69:	74 08                	je     801b73 <fd_close+0x8f>
+  801b6b:	48 89 df             	mov    %rbx,%rdi
+  801b6e:	ff d0                	call   *%rax
+  801b70:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801b73:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801b78:	48 89 de             	mov    %rbx,%rsi
+  801b7b:	bf 00 00 00 00       	mov    $0x0,%edi
+  801b80:	48 b8 95 14 80 00 00 	movabs $0x801495,%rax
+  801b87:	00 00 00 
+  801b8a:	ff d0                	call   *%rax
+    return res;
+  801b8c:	eb a3                	jmp    801b31 <fd_close+0x4d>
+
+0000000000801b8e <close>:
+
+int
+close(int fdnum) {
+  801b8e:	55                   	push   %rbp
+  801b8f:	48 89 e5             	mov    %rsp,%rbp
+  801b92:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  801b96:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801b9a:	48 b8 29 1a 80 00 00 	movabs $0x801a29,%rax
+  801ba1:	00 00 00 
+  801ba4:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801ba6:	85 c0                	test   %eax,%eax
+  801ba8:	78 15                	js     801bbf <close+0x31>
+
+    return fd_close(fd, 1);
+  801baa:	be 01 00 00 00       	mov    $0x1,%esi
+  801baf:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801bb3:	48 b8 e4 1a 80 00 00 	movabs $0x801ae4,%rax
+  801bba:	00 00 00 
+  801bbd:	ff d0                	call   *%rax
+}
+  801bbf:	c9                   	leave
+  801bc0:	c3                   	ret
+
+0000000000801bc1 <close_all>:
+
+void
+close_all(void) {
+  801bc1:	55                   	push   %rbp
+  801bc2:	48 89 e5             	mov    %rsp,%rbp
+  801bc5:	41 54                	push   %r12
+  801bc7:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  801bc8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801bcd:	49 bc 8e 1b 80 00 00 	movabs $0x801b8e,%r12
+  801bd4:	00 00 00 
+  801bd7:	89 df                	mov    %ebx,%edi
+  801bd9:	41 ff d4             	call   *%r12
+  801bdc:	83 c3 01             	add    $0x1,%ebx
+  801bdf:	83 fb 20             	cmp    $0x20,%ebx
+  801be2:	75 f3                	jne    801bd7 <close_all+0x16>
+}
+  801be4:	5b                   	pop    %rbx
+  801be5:	41 5c                	pop    %r12
+  801be7:	5d                   	pop    %rbp
+  801be8:	c3                   	ret
+
+0000000000801be9 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  801be9:	55                   	push   %rbp
+  801bea:	48 89 e5             	mov    %rsp,%rbp
+  801bed:	41 57                	push   %r15
+  801bef:	41 56                	push   %r14
+  801bf1:	41 55                	push   %r13
+  801bf3:	41 54                	push   %r12
+  801bf5:	53                   	push   %rbx
+  801bf6:	48 83 ec 18          	sub    $0x18,%rsp
+  801bfa:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  801bfd:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801c01:	48 b8 29 1a 80 00 00 	movabs $0x801a29,%rax
+  801c08:	00 00 00 
+  801c0b:	ff d0                	call   *%rax
+  801c0d:	89 c3                	mov    %eax,%ebx
+  801c0f:	85 c0                	test   %eax,%eax
+  801c11:	0f 88 b8 00 00 00    	js     801ccf <dup+0xe6>
+    close(newfdnum);
+  801c17:	44 89 e7             	mov    %r12d,%edi
+  801c1a:	48 b8 8e 1b 80 00 00 	movabs $0x801b8e,%rax
+  801c21:	00 00 00 
+  801c24:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  801c26:	4d 63 ec             	movslq %r12d,%r13
+  801c29:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  801c30:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  801c34:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  801c38:	4c 89 ff             	mov    %r15,%rdi
+  801c3b:	49 be 7a 19 80 00 00 	movabs $0x80197a,%r14
+  801c42:	00 00 00 
+  801c45:	41 ff d6             	call   *%r14
+  801c48:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  801c4b:	4c 89 ef             	mov    %r13,%rdi
+  801c4e:	41 ff d6             	call   *%r14
+  801c51:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  801c54:	48 89 df             	mov    %rbx,%rdi
+  801c57:	48 b8 9f 2a 80 00 00 	movabs $0x802a9f,%rax
+  801c5e:	00 00 00 
+  801c61:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  801c63:	a8 04                	test   $0x4,%al
+  801c65:	74 2b                	je     801c92 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  801c67:	41 89 c1             	mov    %eax,%r9d
+  801c6a:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801c70:	4c 89 f1             	mov    %r14,%rcx
+  801c73:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c78:	48 89 de             	mov    %rbx,%rsi
+  801c7b:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c80:	48 b8 30 14 80 00 00 	movabs $0x801430,%rax
+  801c87:	00 00 00 
+  801c8a:	ff d0                	call   *%rax
+  801c8c:	89 c3                	mov    %eax,%ebx
+  801c8e:	85 c0                	test   %eax,%eax
+  801c90:	78 4e                	js     801ce0 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  801c92:	4c 89 ff             	mov    %r15,%rdi
+  801c95:	48 b8 9f 2a 80 00 00 	movabs $0x802a9f,%rax
+  801c9c:	00 00 00 
+  801c9f:	ff d0                	call   *%rax
+  801ca1:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801ca4:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801caa:	4c 89 e9             	mov    %r13,%rcx
+  801cad:	ba 00 00 00 00       	mov    $0x0,%edx
+  801cb2:	4c 89 fe             	mov    %r15,%rsi
+  801cb5:	bf 00 00 00 00       	mov    $0x0,%edi
+  801cba:	48 b8 30 14 80 00 00 	movabs $0x801430,%rax
+  801cc1:	00 00 00 
+  801cc4:	ff d0                	call   *%rax
+  801cc6:	89 c3                	mov    %eax,%ebx
+  801cc8:	85 c0                	test   %eax,%eax
+  801cca:	78 14                	js     801ce0 <dup+0xf7>
+
+    return newfdnum;
+  801ccc:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  801ccf:	89 d8                	mov    %ebx,%eax
+  801cd1:	48 83 c4 18          	add    $0x18,%rsp
+  801cd5:	5b                   	pop    %rbx
+  801cd6:	41 5c                	pop    %r12
+  801cd8:	41 5d                	pop    %r13
+  801cda:	41 5e                	pop    %r14
+  801cdc:	41 5f                	pop    %r15
+  801cde:	5d                   	pop    %rbp
+  801cdf:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  801ce0:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801ce5:	4c 89 ee             	mov    %r13,%rsi
+  801ce8:	bf 00 00 00 00       	mov    $0x0,%edi
+  801ced:	49 bc 95 14 80 00 00 	movabs $0x801495,%r12
+  801cf4:	00 00 00 
+  801cf7:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  801cfa:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801cff:	4c 89 f6             	mov    %r14,%rsi
+  801d02:	bf 00 00 00 00       	mov    $0x0,%edi
+  801d07:	41 ff d4             	call   *%r12
+    return res;
+  801d0a:	eb c3                	jmp    801ccf <dup+0xe6>
+
+0000000000801d0c <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  801d0c:	55                   	push   %rbp
+  801d0d:	48 89 e5             	mov    %rsp,%rbp
+  801d10:	41 56                	push   %r14
+  801d12:	41 55                	push   %r13
+  801d14:	41 54                	push   %r12
+  801d16:	53                   	push   %rbx
+  801d17:	48 83 ec 10          	sub    $0x10,%rsp
+  801d1b:	89 fb                	mov    %edi,%ebx
+  801d1d:	49 89 f4             	mov    %rsi,%r12
+  801d20:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801d23:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801d27:	48 b8 29 1a 80 00 00 	movabs $0x801a29,%rax
+  801d2e:	00 00 00 
+  801d31:	ff d0                	call   *%rax
+  801d33:	85 c0                	test   %eax,%eax
+  801d35:	78 4c                	js     801d83 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801d37:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801d3b:	41 8b 3e             	mov    (%r14),%edi
+  801d3e:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801d42:	48 b8 74 1a 80 00 00 	movabs $0x801a74,%rax
+  801d49:	00 00 00 
+  801d4c:	ff d0                	call   *%rax
+  801d4e:	85 c0                	test   %eax,%eax
+  801d50:	78 35                	js     801d87 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801d52:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801d56:	83 e0 03             	and    $0x3,%eax
+  801d59:	83 f8 01             	cmp    $0x1,%eax
+  801d5c:	74 2d                	je     801d8b <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801d5e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801d62:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801d66:	48 85 c0             	test   %rax,%rax
+  801d69:	74 56                	je     801dc1 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  801d6b:	4c 89 ea             	mov    %r13,%rdx
+  801d6e:	4c 89 e6             	mov    %r12,%rsi
+  801d71:	4c 89 f7             	mov    %r14,%rdi
+  801d74:	ff d0                	call   *%rax
+}
+  801d76:	48 83 c4 10          	add    $0x10,%rsp
+  801d7a:	5b                   	pop    %rbx
+  801d7b:	41 5c                	pop    %r12
+  801d7d:	41 5d                	pop    %r13
+  801d7f:	41 5e                	pop    %r14
+  801d81:	5d                   	pop    %rbp
+  801d82:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801d83:	48 98                	cltq
+  801d85:	eb ef                	jmp    801d76 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801d87:	48 98                	cltq
+  801d89:	eb eb                	jmp    801d76 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801d8b:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801d92:	00 00 00 
+  801d95:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+  801d9b:	89 da                	mov    %ebx,%edx
+  801d9d:	48 bf 99 37 80 00 00 	movabs $0x803799,%rdi
+  801da4:	00 00 00 
+  801da7:	b8 00 00 00 00       	mov    $0x0,%eax
+  801dac:	48 b9 f4 04 80 00 00 	movabs $0x8004f4,%rcx
+  801db3:	00 00 00 
+  801db6:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801db8:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801dbf:	eb b5                	jmp    801d76 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801dc1:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801dc8:	eb ac                	jmp    801d76 <read+0x6a>
+
+0000000000801dca <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801dca:	55                   	push   %rbp
+  801dcb:	48 89 e5             	mov    %rsp,%rbp
+  801dce:	41 57                	push   %r15
+  801dd0:	41 56                	push   %r14
+  801dd2:	41 55                	push   %r13
+  801dd4:	41 54                	push   %r12
+  801dd6:	53                   	push   %rbx
+  801dd7:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  801ddb:	48 85 d2             	test   %rdx,%rdx
+  801dde:	74 54                	je     801e34 <readn+0x6a>
+  801de0:	41 89 fd             	mov    %edi,%r13d
+  801de3:	49 89 f6             	mov    %rsi,%r14
+  801de6:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  801de9:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  801dee:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  801df3:	49 bf 0c 1d 80 00 00 	movabs $0x801d0c,%r15
+  801dfa:	00 00 00 
+  801dfd:	4c 89 e2             	mov    %r12,%rdx
+  801e00:	48 29 f2             	sub    %rsi,%rdx
+  801e03:	4c 01 f6             	add    %r14,%rsi
+  801e06:	44 89 ef             	mov    %r13d,%edi
+  801e09:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  801e0c:	85 c0                	test   %eax,%eax
+  801e0e:	78 20                	js     801e30 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  801e10:	01 c3                	add    %eax,%ebx
+  801e12:	85 c0                	test   %eax,%eax
+  801e14:	74 08                	je     801e1e <readn+0x54>
+  801e16:	48 63 f3             	movslq %ebx,%rsi
+  801e19:	4c 39 e6             	cmp    %r12,%rsi
+  801e1c:	72 df                	jb     801dfd <readn+0x33>
+    }
+    return res;
+  801e1e:	48 63 c3             	movslq %ebx,%rax
+}
+  801e21:	48 83 c4 08          	add    $0x8,%rsp
+  801e25:	5b                   	pop    %rbx
+  801e26:	41 5c                	pop    %r12
+  801e28:	41 5d                	pop    %r13
+  801e2a:	41 5e                	pop    %r14
+  801e2c:	41 5f                	pop    %r15
+  801e2e:	5d                   	pop    %rbp
+  801e2f:	c3                   	ret
+        if (inc < 0) return inc;
+  801e30:	48 98                	cltq
+  801e32:	eb ed                	jmp    801e21 <readn+0x57>
+    int inc = 1, res = 0;
+  801e34:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801e39:	eb e3                	jmp    801e1e <readn+0x54>
+
+0000000000801e3b <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  801e3b:	55                   	push   %rbp
+  801e3c:	48 89 e5             	mov    %rsp,%rbp
+  801e3f:	41 56                	push   %r14
+  801e41:	41 55                	push   %r13
+  801e43:	41 54                	push   %r12
+  801e45:	53                   	push   %rbx
+  801e46:	48 83 ec 10          	sub    $0x10,%rsp
+  801e4a:	89 fb                	mov    %edi,%ebx
+  801e4c:	49 89 f4             	mov    %rsi,%r12
+  801e4f:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801e52:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801e56:	48 b8 29 1a 80 00 00 	movabs $0x801a29,%rax
+  801e5d:	00 00 00 
+  801e60:	ff d0                	call   *%rax
+  801e62:	85 c0                	test   %eax,%eax
+  801e64:	78 47                	js     801ead <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801e66:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801e6a:	41 8b 3e             	mov    (%r14),%edi
+  801e6d:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801e71:	48 b8 74 1a 80 00 00 	movabs $0x801a74,%rax
+  801e78:	00 00 00 
+  801e7b:	ff d0                	call   *%rax
+  801e7d:	85 c0                	test   %eax,%eax
+  801e7f:	78 30                	js     801eb1 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801e81:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  801e86:	74 2d                	je     801eb5 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801e88:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801e8c:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801e90:	48 85 c0             	test   %rax,%rax
+  801e93:	74 56                	je     801eeb <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  801e95:	4c 89 ea             	mov    %r13,%rdx
+  801e98:	4c 89 e6             	mov    %r12,%rsi
+  801e9b:	4c 89 f7             	mov    %r14,%rdi
+  801e9e:	ff d0                	call   *%rax
+}
+  801ea0:	48 83 c4 10          	add    $0x10,%rsp
+  801ea4:	5b                   	pop    %rbx
+  801ea5:	41 5c                	pop    %r12
+  801ea7:	41 5d                	pop    %r13
+  801ea9:	41 5e                	pop    %r14
+  801eab:	5d                   	pop    %rbp
+  801eac:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801ead:	48 98                	cltq
+  801eaf:	eb ef                	jmp    801ea0 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801eb1:	48 98                	cltq
+  801eb3:	eb eb                	jmp    801ea0 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801eb5:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801ebc:	00 00 00 
+  801ebf:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+  801ec5:	89 da                	mov    %ebx,%edx
+  801ec7:	48 bf b5 37 80 00 00 	movabs $0x8037b5,%rdi
+  801ece:	00 00 00 
+  801ed1:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ed6:	48 b9 f4 04 80 00 00 	movabs $0x8004f4,%rcx
+  801edd:	00 00 00 
+  801ee0:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801ee2:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801ee9:	eb b5                	jmp    801ea0 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801eeb:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801ef2:	eb ac                	jmp    801ea0 <write+0x65>
+
+0000000000801ef4 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  801ef4:	55                   	push   %rbp
+  801ef5:	48 89 e5             	mov    %rsp,%rbp
+  801ef8:	53                   	push   %rbx
+  801ef9:	48 83 ec 18          	sub    $0x18,%rsp
+  801efd:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801eff:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801f03:	48 b8 29 1a 80 00 00 	movabs $0x801a29,%rax
+  801f0a:	00 00 00 
+  801f0d:	ff d0                	call   *%rax
+  801f0f:	85 c0                	test   %eax,%eax
+  801f11:	78 0c                	js     801f1f <seek+0x2b>
+
+    fd->fd_offset = offset;
+  801f13:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801f17:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  801f1a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801f1f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801f23:	c9                   	leave
+  801f24:	c3                   	ret
+
+0000000000801f25 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  801f25:	55                   	push   %rbp
+  801f26:	48 89 e5             	mov    %rsp,%rbp
+  801f29:	41 55                	push   %r13
+  801f2b:	41 54                	push   %r12
+  801f2d:	53                   	push   %rbx
+  801f2e:	48 83 ec 18          	sub    $0x18,%rsp
+  801f32:	89 fb                	mov    %edi,%ebx
+  801f34:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801f37:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801f3b:	48 b8 29 1a 80 00 00 	movabs $0x801a29,%rax
+  801f42:	00 00 00 
+  801f45:	ff d0                	call   *%rax
+  801f47:	85 c0                	test   %eax,%eax
+  801f49:	78 38                	js     801f83 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801f4b:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  801f4f:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  801f53:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801f57:	48 b8 74 1a 80 00 00 	movabs $0x801a74,%rax
+  801f5e:	00 00 00 
+  801f61:	ff d0                	call   *%rax
+  801f63:	85 c0                	test   %eax,%eax
+  801f65:	78 1c                	js     801f83 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801f67:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  801f6c:	74 20                	je     801f8e <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801f6e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801f72:	48 8b 40 30          	mov    0x30(%rax),%rax
+  801f76:	48 85 c0             	test   %rax,%rax
+  801f79:	74 47                	je     801fc2 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  801f7b:	44 89 e6             	mov    %r12d,%esi
+  801f7e:	4c 89 ef             	mov    %r13,%rdi
+  801f81:	ff d0                	call   *%rax
+}
+  801f83:	48 83 c4 18          	add    $0x18,%rsp
+  801f87:	5b                   	pop    %rbx
+  801f88:	41 5c                	pop    %r12
+  801f8a:	41 5d                	pop    %r13
+  801f8c:	5d                   	pop    %rbp
+  801f8d:	c3                   	ret
+                thisenv->env_id, fdnum);
+  801f8e:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801f95:	00 00 00 
+  801f98:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801f9e:	89 da                	mov    %ebx,%edx
+  801fa0:	48 bf 78 37 80 00 00 	movabs $0x803778,%rdi
+  801fa7:	00 00 00 
+  801faa:	b8 00 00 00 00       	mov    $0x0,%eax
+  801faf:	48 b9 f4 04 80 00 00 	movabs $0x8004f4,%rcx
+  801fb6:	00 00 00 
+  801fb9:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801fbb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801fc0:	eb c1                	jmp    801f83 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801fc2:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801fc7:	eb ba                	jmp    801f83 <ftruncate+0x5e>
+
+0000000000801fc9 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  801fc9:	55                   	push   %rbp
+  801fca:	48 89 e5             	mov    %rsp,%rbp
+  801fcd:	41 54                	push   %r12
+  801fcf:	53                   	push   %rbx
+  801fd0:	48 83 ec 10          	sub    $0x10,%rsp
+  801fd4:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801fd7:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801fdb:	48 b8 29 1a 80 00 00 	movabs $0x801a29,%rax
+  801fe2:	00 00 00 
+  801fe5:	ff d0                	call   *%rax
+  801fe7:	85 c0                	test   %eax,%eax
+  801fe9:	78 4e                	js     802039 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801feb:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801fef:	41 8b 3c 24          	mov    (%r12),%edi
+  801ff3:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801ff7:	48 b8 74 1a 80 00 00 	movabs $0x801a74,%rax
+  801ffe:	00 00 00 
+  802001:	ff d0                	call   *%rax
+  802003:	85 c0                	test   %eax,%eax
+  802005:	78 32                	js     802039 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  802007:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80200b:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  802010:	74 30                	je     802042 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  802012:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  802015:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  80201c:	00 00 00 
+    stat->st_isdir = 0;
+  80201f:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  802026:	00 00 00 
+    stat->st_dev = dev;
+  802029:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  802030:	48 89 de             	mov    %rbx,%rsi
+  802033:	4c 89 e7             	mov    %r12,%rdi
+  802036:	ff 50 28             	call   *0x28(%rax)
+}
+  802039:	48 83 c4 10          	add    $0x10,%rsp
+  80203d:	5b                   	pop    %rbx
+  80203e:	41 5c                	pop    %r12
+  802040:	5d                   	pop    %rbp
+  802041:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  802042:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802047:	eb f0                	jmp    802039 <fstat+0x70>
+
+0000000000802049 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  802049:	55                   	push   %rbp
+  80204a:	48 89 e5             	mov    %rsp,%rbp
+  80204d:	41 54                	push   %r12
+  80204f:	53                   	push   %rbx
+  802050:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  802053:	be 00 00 00 00       	mov    $0x0,%esi
+  802058:	48 b8 2c 24 80 00 00 	movabs $0x80242c,%rax
+  80205f:	00 00 00 
+  802062:	ff d0                	call   *%rax
+  802064:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  802066:	85 c0                	test   %eax,%eax
+  802068:	78 25                	js     80208f <stat+0x46>
+
+    int res = fstat(fd, stat);
+  80206a:	4c 89 e6             	mov    %r12,%rsi
+  80206d:	89 c7                	mov    %eax,%edi
+  80206f:	48 b8 c9 1f 80 00 00 	movabs $0x801fc9,%rax
+  802076:	00 00 00 
+  802079:	ff d0                	call   *%rax
+  80207b:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  80207e:	89 df                	mov    %ebx,%edi
+  802080:	48 b8 8e 1b 80 00 00 	movabs $0x801b8e,%rax
+  802087:	00 00 00 
+  80208a:	ff d0                	call   *%rax
+
+    return res;
+  80208c:	44 89 e3             	mov    %r12d,%ebx
+}
+  80208f:	89 d8                	mov    %ebx,%eax
+  802091:	5b                   	pop    %rbx
+  802092:	41 5c                	pop    %r12
+  802094:	5d                   	pop    %rbp
+  802095:	c3                   	ret
+
+0000000000802096 <fsipc>:
+ * response may be written back to fsipcbuf.
+ * type: request code, passed as the simple integer IPC value.
+ * dstva: virtual address at which to receive reply page, 0 if none.
+ * Returns result from the file server. */
+static int
+fsipc(unsigned type, void *dstva) {
+  802096:	55                   	push   %rbp
+  802097:	48 89 e5             	mov    %rsp,%rbp
+  80209a:	41 54                	push   %r12
+  80209c:	53                   	push   %rbx
+  80209d:	48 83 ec 10          	sub    $0x10,%rsp
+  8020a1:	41 89 fc             	mov    %edi,%r12d
+  8020a4:	48 89 f3             	mov    %rsi,%rbx
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8020a7:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  8020ae:	00 00 00 
+  8020b1:	83 38 00             	cmpl   $0x0,(%rax)
+  8020b4:	74 5e                	je     802114 <fsipc+0x7e>
+    if (debug) {
+        cprintf("[%08x] fsipc %d %08x\n",
+                thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+    }
+
+    ipc_send(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW);
+  8020b6:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8020bc:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8020c1:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  8020c8:	00 00 00 
+  8020cb:	44 89 e6             	mov    %r12d,%esi
+  8020ce:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  8020d5:	00 00 00 
+  8020d8:	8b 38                	mov    (%rax),%edi
+  8020da:	48 b8 93 2f 80 00 00 	movabs $0x802f93,%rax
+  8020e1:	00 00 00 
+  8020e4:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  8020e6:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  8020ed:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  8020ee:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8020f3:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  8020f7:	48 89 de             	mov    %rbx,%rsi
+  8020fa:	bf 00 00 00 00       	mov    $0x0,%edi
+  8020ff:	48 b8 be 2e 80 00 00 	movabs $0x802ebe,%rax
+  802106:	00 00 00 
+  802109:	ff d0                	call   *%rax
+}
+  80210b:	48 83 c4 10          	add    $0x10,%rsp
+  80210f:	5b                   	pop    %rbx
+  802110:	41 5c                	pop    %r12
+  802112:	5d                   	pop    %rbp
+  802113:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802114:	bf 03 00 00 00       	mov    $0x3,%edi
+  802119:	48 b8 36 30 80 00 00 	movabs $0x803036,%rax
+  802120:	00 00 00 
+  802123:	ff d0                	call   *%rax
+  802125:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  80212c:	00 00 
+  80212e:	eb 86                	jmp    8020b6 <fsipc+0x20>
+
+0000000000802130 <devfile_trunc>:
+    return 0;
+}
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  802130:	55                   	push   %rbp
+  802131:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802134:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  80213b:	00 00 00 
+  80213e:	8b 57 0c             	mov    0xc(%rdi),%edx
+  802141:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  802143:	89 70 04             	mov    %esi,0x4(%rax)
+
+    return fsipc(FSREQ_SET_SIZE, NULL);
+  802146:	be 00 00 00 00       	mov    $0x0,%esi
+  80214b:	bf 02 00 00 00       	mov    $0x2,%edi
+  802150:	48 b8 96 20 80 00 00 	movabs $0x802096,%rax
+  802157:	00 00 00 
+  80215a:	ff d0                	call   *%rax
+}
+  80215c:	5d                   	pop    %rbp
+  80215d:	c3                   	ret
+
+000000000080215e <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  80215e:	55                   	push   %rbp
+  80215f:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  802162:	8b 47 0c             	mov    0xc(%rdi),%eax
+  802165:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  80216c:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  80216e:	be 00 00 00 00       	mov    $0x0,%esi
+  802173:	bf 06 00 00 00       	mov    $0x6,%edi
+  802178:	48 b8 96 20 80 00 00 	movabs $0x802096,%rax
+  80217f:	00 00 00 
+  802182:	ff d0                	call   *%rax
+}
+  802184:	5d                   	pop    %rbp
+  802185:	c3                   	ret
+
+0000000000802186 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  802186:	55                   	push   %rbp
+  802187:	48 89 e5             	mov    %rsp,%rbp
+  80218a:	41 54                	push   %r12
+  80218c:	53                   	push   %rbx
+  80218d:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802190:	8b 47 0c             	mov    0xc(%rdi),%eax
+  802193:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  80219a:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  80219c:	be 00 00 00 00       	mov    $0x0,%esi
+  8021a1:	bf 05 00 00 00       	mov    $0x5,%edi
+  8021a6:	48 b8 96 20 80 00 00 	movabs $0x802096,%rax
+  8021ad:	00 00 00 
+  8021b0:	ff d0                	call   *%rax
+    if (res < 0) {
+  8021b2:	85 c0                	test   %eax,%eax
+  8021b4:	78 3d                	js     8021f3 <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8021b6:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  8021bd:	00 00 00 
+  8021c0:	4c 89 e6             	mov    %r12,%rsi
+  8021c3:	48 89 df             	mov    %rbx,%rdi
+  8021c6:	48 b8 19 0e 80 00 00 	movabs $0x800e19,%rax
+  8021cd:	00 00 00 
+  8021d0:	ff d0                	call   *%rax
+    st->st_size  = fsipcbuf.statRet.ret_size;
+  8021d2:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  8021d9:	00 
+  8021da:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8021e0:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  8021e7:	00 
+  8021e8:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  8021ee:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8021f3:	5b                   	pop    %rbx
+  8021f4:	41 5c                	pop    %r12
+  8021f6:	5d                   	pop    %rbp
+  8021f7:	c3                   	ret
+
+00000000008021f8 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  8021f8:	55                   	push   %rbp
+  8021f9:	48 89 e5             	mov    %rsp,%rbp
+  8021fc:	41 57                	push   %r15
+  8021fe:	41 56                	push   %r14
+  802200:	41 55                	push   %r13
+  802202:	41 54                	push   %r12
+  802204:	53                   	push   %rbx
+  802205:	48 83 ec 18          	sub    $0x18,%rsp
+  802209:	49 89 fe             	mov    %rdi,%r14
+  80220c:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+  802210:	48 89 d3             	mov    %rdx,%rbx
+    while (n > sizeof(fsipcbuf.write.req_buf))
+  802213:	48 81 fa f0 0f 00 00 	cmp    $0xff0,%rdx
+  80221a:	0f 86 e4 00 00 00    	jbe    802304 <devfile_write+0x10c>
+  802220:	49 89 f4             	mov    %rsi,%r12
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802223:	49 bd 00 60 80 00 00 	movabs $0x806000,%r13
+  80222a:	00 00 00 
+        memcpy(fsipcbuf.write.req_buf, buf, sizeof(fsipcbuf.write.req_buf));
+  80222d:	49 bf 7a 10 80 00 00 	movabs $0x80107a,%r15
+  802234:	00 00 00 
+  802237:	eb 03                	jmp    80223c <devfile_write+0x44>
+        buf += sizeof(fsipcbuf.write.req_buf);
+  802239:	49 89 f4             	mov    %rsi,%r12
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  80223c:	41 8b 46 0c          	mov    0xc(%r14),%eax
+  802240:	41 89 45 00          	mov    %eax,0x0(%r13)
+        fsipcbuf.write.req_n      = sizeof(fsipcbuf.write.req_buf);
+  802244:	49 c7 45 08 f0 0f 00 	movq   $0xff0,0x8(%r13)
+  80224b:	00 
+        memcpy(fsipcbuf.write.req_buf, buf, sizeof(fsipcbuf.write.req_buf));
+  80224c:	ba f0 0f 00 00       	mov    $0xff0,%edx
+  802251:	4c 89 e6             	mov    %r12,%rsi
+  802254:	48 bf 10 60 80 00 00 	movabs $0x806010,%rdi
+  80225b:	00 00 00 
+  80225e:	41 ff d7             	call   *%r15
+        ssize_t res = fsipc(FSREQ_WRITE, NULL);
+  802261:	be 00 00 00 00       	mov    $0x0,%esi
+  802266:	bf 04 00 00 00       	mov    $0x4,%edi
+  80226b:	48 b8 96 20 80 00 00 	movabs $0x802096,%rax
+  802272:	00 00 00 
+  802275:	ff d0                	call   *%rax
+  802277:	48 63 d0             	movslq %eax,%rdx
+        if (res < 0 || res < sizeof(fsipcbuf.write.req_buf))
+  80227a:	3d ef 0f 00 00       	cmp    $0xfef,%eax
+  80227f:	7e 71                	jle    8022f2 <devfile_write+0xfa>
+        buf += sizeof(fsipcbuf.write.req_buf);
+  802281:	49 8d b4 24 f0 0f 00 	lea    0xff0(%r12),%rsi
+  802288:	00 
+        n -= sizeof(fsipcbuf.write.req_buf);
+  802289:	48 81 eb f0 0f 00 00 	sub    $0xff0,%rbx
+    while (n > sizeof(fsipcbuf.write.req_buf))
+  802290:	48 81 fb f0 0f 00 00 	cmp    $0xff0,%rbx
+  802297:	77 a0                	ja     802239 <devfile_write+0x41>
+        written += sizeof(fsipcbuf.write.req_buf);
+  802299:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80229d:	49 29 c4             	sub    %rax,%r12
+  8022a0:	4d 8d a4 24 f0 0f 00 	lea    0xff0(%r12),%r12
+  8022a7:	00 
+    fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8022a8:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  8022af:	00 00 00 
+  8022b2:	41 8b 56 0c          	mov    0xc(%r14),%edx
+  8022b6:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.write.req_n      = n;
+  8022b8:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    memcpy(fsipcbuf.write.req_buf, buf, n);
+  8022bc:	48 89 da             	mov    %rbx,%rdx
+  8022bf:	48 8d 78 10          	lea    0x10(%rax),%rdi
+  8022c3:	48 b8 7a 10 80 00 00 	movabs $0x80107a,%rax
+  8022ca:	00 00 00 
+  8022cd:	ff d0                	call   *%rax
+    ssize_t res = fsipc(FSREQ_WRITE, NULL);
+  8022cf:	be 00 00 00 00       	mov    $0x0,%esi
+  8022d4:	bf 04 00 00 00       	mov    $0x4,%edi
+  8022d9:	48 b8 96 20 80 00 00 	movabs $0x802096,%rax
+  8022e0:	00 00 00 
+  8022e3:	ff d0                	call   *%rax
+  8022e5:	48 63 d0             	movslq %eax,%rdx
+    written += res;
+  8022e8:	49 01 d4             	add    %rdx,%r12
+  8022eb:	48 85 d2             	test   %rdx,%rdx
+  8022ee:	49 0f 49 d4          	cmovns %r12,%rdx
+}
+  8022f2:	48 89 d0             	mov    %rdx,%rax
+  8022f5:	48 83 c4 18          	add    $0x18,%rsp
+  8022f9:	5b                   	pop    %rbx
+  8022fa:	41 5c                	pop    %r12
+  8022fc:	41 5d                	pop    %r13
+  8022fe:	41 5e                	pop    %r14
+  802300:	41 5f                	pop    %r15
+  802302:	5d                   	pop    %rbp
+  802303:	c3                   	ret
+    while (n > sizeof(fsipcbuf.write.req_buf))
+  802304:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+    ssize_t written = 0;
+  802308:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80230e:	eb 98                	jmp    8022a8 <devfile_write+0xb0>
+
+0000000000802310 <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  802310:	55                   	push   %rbp
+  802311:	48 89 e5             	mov    %rsp,%rbp
+  802314:	41 57                	push   %r15
+  802316:	41 56                	push   %r14
+  802318:	41 55                	push   %r13
+  80231a:	41 54                	push   %r12
+  80231c:	53                   	push   %rbx
+  80231d:	48 83 ec 18          	sub    $0x18,%rsp
+  802321:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  802325:	49 89 f6             	mov    %rsi,%r14
+  802328:	49 89 d4             	mov    %rdx,%r12
+    while (n > sizeof(fsipcbuf.readRet.ret_buf))
+  80232b:	48 81 fa 00 10 00 00 	cmp    $0x1000,%rdx
+  802332:	0f 86 ea 00 00 00    	jbe    802422 <devfile_read+0x112>
+    ssize_t readsz = 0;
+  802338:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  80233f:	00 
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802340:	49 bf 00 60 80 00 00 	movabs $0x806000,%r15
+  802347:	00 00 00 
+  80234a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80234e:	8b 40 0c             	mov    0xc(%rax),%eax
+  802351:	41 89 07             	mov    %eax,(%r15)
+        fsipcbuf.read.req_n = sizeof(fsipcbuf.readRet.ret_buf);
+  802354:	49 c7 47 08 00 10 00 	movq   $0x1000,0x8(%r15)
+  80235b:	00 
+        ssize_t res = fsipc(FSREQ_READ, NULL);
+  80235c:	be 00 00 00 00       	mov    $0x0,%esi
+  802361:	bf 03 00 00 00       	mov    $0x3,%edi
+  802366:	48 b8 96 20 80 00 00 	movabs $0x802096,%rax
+  80236d:	00 00 00 
+  802370:	ff d0                	call   *%rax
+  802372:	4c 63 e8             	movslq %eax,%r13
+        if (res < 0)
+  802375:	4d 85 ed             	test   %r13,%r13
+  802378:	0f 88 92 00 00 00    	js     802410 <devfile_read+0x100>
+        memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  80237e:	4c 89 ea             	mov    %r13,%rdx
+  802381:	4c 89 fe             	mov    %r15,%rsi
+  802384:	4c 89 f7             	mov    %r14,%rdi
+  802387:	48 b8 7a 10 80 00 00 	movabs $0x80107a,%rax
+  80238e:	00 00 00 
+  802391:	ff d0                	call   *%rax
+        if (res < sizeof(fsipcbuf.readRet.ret_buf))
+  802393:	49 81 fd ff 0f 00 00 	cmp    $0xfff,%r13
+  80239a:	76 6d                	jbe    802409 <devfile_read+0xf9>
+        readsz += res;
+  80239c:	4c 01 6d c0          	add    %r13,-0x40(%rbp)
+        buf += res;
+  8023a0:	4d 01 ee             	add    %r13,%r14
+        n -= res;
+  8023a3:	4d 29 ec             	sub    %r13,%r12
+    while (n > sizeof(fsipcbuf.readRet.ret_buf))
+  8023a6:	49 81 fc 00 10 00 00 	cmp    $0x1000,%r12
+  8023ad:	77 9b                	ja     80234a <devfile_read+0x3a>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8023af:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  8023b6:	00 00 00 
+  8023b9:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  8023bd:	8b 51 0c             	mov    0xc(%rcx),%edx
+  8023c0:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.read.req_n = n;
+  8023c2:	4c 89 60 08          	mov    %r12,0x8(%rax)
+    ssize_t res = fsipc(FSREQ_READ, NULL);
+  8023c6:	be 00 00 00 00       	mov    $0x0,%esi
+  8023cb:	bf 03 00 00 00       	mov    $0x3,%edi
+  8023d0:	48 b8 96 20 80 00 00 	movabs $0x802096,%rax
+  8023d7:	00 00 00 
+  8023da:	ff d0                	call   *%rax
+  8023dc:	4c 63 e8             	movslq %eax,%r13
+    if (res < 0)
+  8023df:	4d 85 ed             	test   %r13,%r13
+  8023e2:	78 2c                	js     802410 <devfile_read+0x100>
+    memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  8023e4:	4c 89 ea             	mov    %r13,%rdx
+  8023e7:	48 be 00 60 80 00 00 	movabs $0x806000,%rsi
+  8023ee:	00 00 00 
+  8023f1:	4c 89 f7             	mov    %r14,%rdi
+  8023f4:	48 b8 7a 10 80 00 00 	movabs $0x80107a,%rax
+  8023fb:	00 00 00 
+  8023fe:	ff d0                	call   *%rax
+    readsz += res;
+  802400:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802404:	49 01 c5             	add    %rax,%r13
+    return readsz;
+  802407:	eb 07                	jmp    802410 <devfile_read+0x100>
+            return readsz + res;
+  802409:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80240d:	49 01 c5             	add    %rax,%r13
+}
+  802410:	4c 89 e8             	mov    %r13,%rax
+  802413:	48 83 c4 18          	add    $0x18,%rsp
+  802417:	5b                   	pop    %rbx
+  802418:	41 5c                	pop    %r12
+  80241a:	41 5d                	pop    %r13
+  80241c:	41 5e                	pop    %r14
+  80241e:	41 5f                	pop    %r15
+  802420:	5d                   	pop    %rbp
+  802421:	c3                   	ret
+    ssize_t readsz = 0;
+  802422:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  802429:	00 
+  80242a:	eb 83                	jmp    8023af <devfile_read+0x9f>
+
+000000000080242c <open>:
+open(const char *path, int mode) {
+  80242c:	55                   	push   %rbp
+  80242d:	48 89 e5             	mov    %rsp,%rbp
+  802430:	41 55                	push   %r13
+  802432:	41 54                	push   %r12
+  802434:	53                   	push   %rbx
+  802435:	48 83 ec 18          	sub    $0x18,%rsp
+  802439:	49 89 fc             	mov    %rdi,%r12
+  80243c:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  80243f:	48 b8 db 0d 80 00 00 	movabs $0x800ddb,%rax
+  802446:	00 00 00 
+  802449:	ff d0                	call   *%rax
+  80244b:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802451:	0f 87 8a 00 00 00    	ja     8024e1 <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802457:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  80245b:	48 b8 0f 1a 80 00 00 	movabs $0x801a0f,%rax
+  802462:	00 00 00 
+  802465:	ff d0                	call   *%rax
+  802467:	89 c3                	mov    %eax,%ebx
+  802469:	85 c0                	test   %eax,%eax
+  80246b:	78 50                	js     8024bd <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  80246d:	4c 89 e6             	mov    %r12,%rsi
+  802470:	48 bb 00 60 80 00 00 	movabs $0x806000,%rbx
+  802477:	00 00 00 
+  80247a:	48 89 df             	mov    %rbx,%rdi
+  80247d:	48 b8 19 0e 80 00 00 	movabs $0x800e19,%rax
+  802484:	00 00 00 
+  802487:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  802489:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  802490:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802494:	bf 01 00 00 00       	mov    $0x1,%edi
+  802499:	48 b8 96 20 80 00 00 	movabs $0x802096,%rax
+  8024a0:	00 00 00 
+  8024a3:	ff d0                	call   *%rax
+  8024a5:	89 c3                	mov    %eax,%ebx
+  8024a7:	85 c0                	test   %eax,%eax
+  8024a9:	78 1f                	js     8024ca <open+0x9e>
+    return fd2num(fd);
+  8024ab:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8024af:	48 b8 68 19 80 00 00 	movabs $0x801968,%rax
+  8024b6:	00 00 00 
+  8024b9:	ff d0                	call   *%rax
+  8024bb:	89 c3                	mov    %eax,%ebx
+}
+  8024bd:	89 d8                	mov    %ebx,%eax
+  8024bf:	48 83 c4 18          	add    $0x18,%rsp
+  8024c3:	5b                   	pop    %rbx
+  8024c4:	41 5c                	pop    %r12
+  8024c6:	41 5d                	pop    %r13
+  8024c8:	5d                   	pop    %rbp
+  8024c9:	c3                   	ret
+        fd_close(fd, 0);
+  8024ca:	be 00 00 00 00       	mov    $0x0,%esi
+  8024cf:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8024d3:	48 b8 e4 1a 80 00 00 	movabs $0x801ae4,%rax
+  8024da:	00 00 00 
+  8024dd:	ff d0                	call   *%rax
+        return res;
+  8024df:	eb dc                	jmp    8024bd <open+0x91>
+        return -E_BAD_PATH;
+  8024e1:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  8024e6:	eb d5                	jmp    8024bd <open+0x91>
+
+00000000008024e8 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  8024e8:	55                   	push   %rbp
+  8024e9:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc(FSREQ_SYNC, NULL);
+  8024ec:	be 00 00 00 00       	mov    $0x0,%esi
+  8024f1:	bf 08 00 00 00       	mov    $0x8,%edi
+  8024f6:	48 b8 96 20 80 00 00 	movabs $0x802096,%rax
+  8024fd:	00 00 00 
+  802500:	ff d0                	call   *%rax
+}
+  802502:	5d                   	pop    %rbp
+  802503:	c3                   	ret
+
+0000000000802504 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  802504:	55                   	push   %rbp
+  802505:	48 89 e5             	mov    %rsp,%rbp
+  802508:	41 54                	push   %r12
+  80250a:	53                   	push   %rbx
+  80250b:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80250e:	48 b8 7a 19 80 00 00 	movabs $0x80197a,%rax
+  802515:	00 00 00 
+  802518:	ff d0                	call   *%rax
+  80251a:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  80251d:	48 be 00 38 80 00 00 	movabs $0x803800,%rsi
+  802524:	00 00 00 
+  802527:	48 89 df             	mov    %rbx,%rdi
+  80252a:	48 b8 19 0e 80 00 00 	movabs $0x800e19,%rax
+  802531:	00 00 00 
+  802534:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  802536:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  80253b:	41 2b 04 24          	sub    (%r12),%eax
+  80253f:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  802545:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  80254c:	00 00 00 
+    stat->st_dev = &devpipe;
+  80254f:	48 b8 60 40 80 00 00 	movabs $0x804060,%rax
+  802556:	00 00 00 
+  802559:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  802560:	b8 00 00 00 00       	mov    $0x0,%eax
+  802565:	5b                   	pop    %rbx
+  802566:	41 5c                	pop    %r12
+  802568:	5d                   	pop    %rbp
+  802569:	c3                   	ret
+
+000000000080256a <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  80256a:	55                   	push   %rbp
+  80256b:	48 89 e5             	mov    %rsp,%rbp
+  80256e:	41 54                	push   %r12
+  802570:	53                   	push   %rbx
+  802571:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  802574:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802579:	48 89 fe             	mov    %rdi,%rsi
+  80257c:	bf 00 00 00 00       	mov    $0x0,%edi
+  802581:	49 bc 95 14 80 00 00 	movabs $0x801495,%r12
+  802588:	00 00 00 
+  80258b:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  80258e:	48 89 df             	mov    %rbx,%rdi
+  802591:	48 b8 7a 19 80 00 00 	movabs $0x80197a,%rax
+  802598:	00 00 00 
+  80259b:	ff d0                	call   *%rax
+  80259d:	48 89 c6             	mov    %rax,%rsi
+  8025a0:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8025a5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8025aa:	41 ff d4             	call   *%r12
+}
+  8025ad:	5b                   	pop    %rbx
+  8025ae:	41 5c                	pop    %r12
+  8025b0:	5d                   	pop    %rbp
+  8025b1:	c3                   	ret
+
+00000000008025b2 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8025b2:	55                   	push   %rbp
+  8025b3:	48 89 e5             	mov    %rsp,%rbp
+  8025b6:	41 57                	push   %r15
+  8025b8:	41 56                	push   %r14
+  8025ba:	41 55                	push   %r13
+  8025bc:	41 54                	push   %r12
+  8025be:	53                   	push   %rbx
+  8025bf:	48 83 ec 18          	sub    $0x18,%rsp
+  8025c3:	49 89 fc             	mov    %rdi,%r12
+  8025c6:	49 89 f5             	mov    %rsi,%r13
+  8025c9:	49 89 d7             	mov    %rdx,%r15
+  8025cc:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8025d0:	48 b8 7a 19 80 00 00 	movabs $0x80197a,%rax
+  8025d7:	00 00 00 
+  8025da:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  8025dc:	4d 85 ff             	test   %r15,%r15
+  8025df:	0f 84 af 00 00 00    	je     802694 <devpipe_write+0xe2>
+  8025e5:	48 89 c3             	mov    %rax,%rbx
+  8025e8:	4c 89 f8             	mov    %r15,%rax
+  8025eb:	4d 89 ef             	mov    %r13,%r15
+  8025ee:	4c 01 e8             	add    %r13,%rax
+  8025f1:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8025f5:	49 bd 9d 13 80 00 00 	movabs $0x80139d,%r13
+  8025fc:	00 00 00 
+            sys_yield();
+  8025ff:	49 be 3a 13 80 00 00 	movabs $0x80133a,%r14
+  802606:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  802609:	8b 73 04             	mov    0x4(%rbx),%esi
+  80260c:	48 63 ce             	movslq %esi,%rcx
+  80260f:	48 63 03             	movslq (%rbx),%rax
+  802612:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  802618:	48 39 c1             	cmp    %rax,%rcx
+  80261b:	72 2e                	jb     80264b <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80261d:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802622:	48 89 da             	mov    %rbx,%rdx
+  802625:	be 00 10 00 00       	mov    $0x1000,%esi
+  80262a:	4c 89 e7             	mov    %r12,%rdi
+  80262d:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  802630:	85 c0                	test   %eax,%eax
+  802632:	74 66                	je     80269a <devpipe_write+0xe8>
+            sys_yield();
+  802634:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  802637:	8b 73 04             	mov    0x4(%rbx),%esi
+  80263a:	48 63 ce             	movslq %esi,%rcx
+  80263d:	48 63 03             	movslq (%rbx),%rax
+  802640:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  802646:	48 39 c1             	cmp    %rax,%rcx
+  802649:	73 d2                	jae    80261d <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  80264b:	41 0f b6 3f          	movzbl (%r15),%edi
+  80264f:	48 89 ca             	mov    %rcx,%rdx
+  802652:	48 c1 ea 03          	shr    $0x3,%rdx
+  802656:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  80265d:	08 10 20 
+  802660:	48 f7 e2             	mul    %rdx
+  802663:	48 c1 ea 06          	shr    $0x6,%rdx
+  802667:	48 89 d0             	mov    %rdx,%rax
+  80266a:	48 c1 e0 09          	shl    $0x9,%rax
+  80266e:	48 29 d0             	sub    %rdx,%rax
+  802671:	48 c1 e0 03          	shl    $0x3,%rax
+  802675:	48 29 c1             	sub    %rax,%rcx
+  802678:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  80267d:	83 c6 01             	add    $0x1,%esi
+  802680:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  802683:	49 83 c7 01          	add    $0x1,%r15
+  802687:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80268b:	49 39 c7             	cmp    %rax,%r15
+  80268e:	0f 85 75 ff ff ff    	jne    802609 <devpipe_write+0x57>
+    return n;
+  802694:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802698:	eb 05                	jmp    80269f <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  80269a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80269f:	48 83 c4 18          	add    $0x18,%rsp
+  8026a3:	5b                   	pop    %rbx
+  8026a4:	41 5c                	pop    %r12
+  8026a6:	41 5d                	pop    %r13
+  8026a8:	41 5e                	pop    %r14
+  8026aa:	41 5f                	pop    %r15
+  8026ac:	5d                   	pop    %rbp
+  8026ad:	c3                   	ret
+
+00000000008026ae <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  8026ae:	55                   	push   %rbp
+  8026af:	48 89 e5             	mov    %rsp,%rbp
+  8026b2:	41 57                	push   %r15
+  8026b4:	41 56                	push   %r14
+  8026b6:	41 55                	push   %r13
+  8026b8:	41 54                	push   %r12
+  8026ba:	53                   	push   %rbx
+  8026bb:	48 83 ec 18          	sub    $0x18,%rsp
+  8026bf:	49 89 fc             	mov    %rdi,%r12
+  8026c2:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  8026c6:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8026ca:	48 b8 7a 19 80 00 00 	movabs $0x80197a,%rax
+  8026d1:	00 00 00 
+  8026d4:	ff d0                	call   *%rax
+  8026d6:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  8026d9:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8026df:	49 bd 9d 13 80 00 00 	movabs $0x80139d,%r13
+  8026e6:	00 00 00 
+            sys_yield();
+  8026e9:	49 be 3a 13 80 00 00 	movabs $0x80133a,%r14
+  8026f0:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  8026f3:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  8026f8:	74 7d                	je     802777 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  8026fa:	8b 03                	mov    (%rbx),%eax
+  8026fc:	3b 43 04             	cmp    0x4(%rbx),%eax
+  8026ff:	75 26                	jne    802727 <devpipe_read+0x79>
+            if (i > 0) return i;
+  802701:	4d 85 ff             	test   %r15,%r15
+  802704:	75 77                	jne    80277d <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802706:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80270b:	48 89 da             	mov    %rbx,%rdx
+  80270e:	be 00 10 00 00       	mov    $0x1000,%esi
+  802713:	4c 89 e7             	mov    %r12,%rdi
+  802716:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  802719:	85 c0                	test   %eax,%eax
+  80271b:	74 72                	je     80278f <devpipe_read+0xe1>
+            sys_yield();
+  80271d:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  802720:	8b 03                	mov    (%rbx),%eax
+  802722:	3b 43 04             	cmp    0x4(%rbx),%eax
+  802725:	74 df                	je     802706 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802727:	48 63 c8             	movslq %eax,%rcx
+  80272a:	48 89 ca             	mov    %rcx,%rdx
+  80272d:	48 c1 ea 03          	shr    $0x3,%rdx
+  802731:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  802738:	08 10 20 
+  80273b:	48 89 d0             	mov    %rdx,%rax
+  80273e:	48 f7 e6             	mul    %rsi
+  802741:	48 c1 ea 06          	shr    $0x6,%rdx
+  802745:	48 89 d0             	mov    %rdx,%rax
+  802748:	48 c1 e0 09          	shl    $0x9,%rax
+  80274c:	48 29 d0             	sub    %rdx,%rax
+  80274f:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  802756:	00 
+  802757:	48 89 c8             	mov    %rcx,%rax
+  80275a:	48 29 d0             	sub    %rdx,%rax
+  80275d:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  802762:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  802766:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  80276a:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  80276d:	49 83 c7 01          	add    $0x1,%r15
+  802771:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  802775:	75 83                	jne    8026fa <devpipe_read+0x4c>
+    return n;
+  802777:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80277b:	eb 03                	jmp    802780 <devpipe_read+0xd2>
+            if (i > 0) return i;
+  80277d:	4c 89 f8             	mov    %r15,%rax
+}
+  802780:	48 83 c4 18          	add    $0x18,%rsp
+  802784:	5b                   	pop    %rbx
+  802785:	41 5c                	pop    %r12
+  802787:	41 5d                	pop    %r13
+  802789:	41 5e                	pop    %r14
+  80278b:	41 5f                	pop    %r15
+  80278d:	5d                   	pop    %rbp
+  80278e:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  80278f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802794:	eb ea                	jmp    802780 <devpipe_read+0xd2>
+
+0000000000802796 <pipe>:
+pipe(int pfd[2]) {
+  802796:	55                   	push   %rbp
+  802797:	48 89 e5             	mov    %rsp,%rbp
+  80279a:	41 55                	push   %r13
+  80279c:	41 54                	push   %r12
+  80279e:	53                   	push   %rbx
+  80279f:	48 81 ec b8 00 00 00 	sub    $0xb8,%rsp
+  8027a6:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8027a9:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  8027ad:	48 b8 0f 1a 80 00 00 	movabs $0x801a0f,%rax
+  8027b4:	00 00 00 
+  8027b7:	ff d0                	call   *%rax
+  8027b9:	89 c3                	mov    %eax,%ebx
+  8027bb:	85 c0                	test   %eax,%eax
+  8027bd:	0f 88 51 01 00 00    	js     802914 <pipe+0x17e>
+        (res = fd_alloc_from(fd2num(fd0) + 1, &fd1)) < 0) goto err;
+  8027c3:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8027c7:	48 b8 68 19 80 00 00 	movabs $0x801968,%rax
+  8027ce:	00 00 00 
+  8027d1:	ff d0                	call   *%rax
+  8027d3:	8d 78 01             	lea    0x1(%rax),%edi
+  8027d6:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8027da:	48 b8 96 19 80 00 00 	movabs $0x801996,%rax
+  8027e1:	00 00 00 
+  8027e4:	ff d0                	call   *%rax
+  8027e6:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8027e8:	85 c0                	test   %eax,%eax
+  8027ea:	0f 88 24 01 00 00    	js     802914 <pipe+0x17e>
+    va = fd2data(fd0);
+  8027f0:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8027f4:	48 bb 7a 19 80 00 00 	movabs $0x80197a,%rbx
+  8027fb:	00 00 00 
+  8027fe:	ff d3                	call   *%rbx
+  802800:	49 89 c5             	mov    %rax,%r13
+    struct RegionOp ops[] = {
+  802803:	48 8d bd 30 ff ff ff 	lea    -0xd0(%rbp),%rdi
+  80280a:	b9 14 00 00 00       	mov    $0x14,%ecx
+  80280f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802814:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+  802817:	c7 85 34 ff ff ff 46 	movl   $0x46,-0xcc(%rbp)
+  80281e:	00 00 00 
+  802821:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802825:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+  80282c:	48 c7 85 50 ff ff ff 	movq   $0x1000,-0xb0(%rbp)
+  802833:	00 10 00 00 
+  802837:	c7 85 5c ff ff ff 46 	movl   $0x46,-0xa4(%rbp)
+  80283e:	00 00 00 
+            {.type = REGION_ALLOC, .dstva = (uintptr_t)fd1, .size = PAGE_SIZE, .perm = PROT_RW | PROT_SHARE},
+  802841:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+    struct RegionOp ops[] = {
+  802845:	48 89 bd 70 ff ff ff 	mov    %rdi,-0x90(%rbp)
+  80284c:	48 c7 85 78 ff ff ff 	movq   $0x1000,-0x88(%rbp)
+  802853:	00 10 00 00 
+  802857:	c7 45 84 46 00 00 00 	movl   $0x46,-0x7c(%rbp)
+  80285e:	4c 89 6d 98          	mov    %r13,-0x68(%rbp)
+  802862:	48 c7 45 a0 00 10 00 	movq   $0x1000,-0x60(%rbp)
+  802869:	00 
+  80286a:	c7 45 a8 01 00 00 00 	movl   $0x1,-0x58(%rbp)
+  802871:	c7 45 ac 46 00 00 00 	movl   $0x46,-0x54(%rbp)
+  802878:	4c 89 6d b8          	mov    %r13,-0x48(%rbp)
+            {.type = REGION_MAP, .srcva = (uintptr_t)va, .dstva = (uintptr_t)fd2data(fd1), .size = PAGE_SIZE, .perm = PROT_RW | PROT_SHARE},
+  80287c:	ff d3                	call   *%rbx
+    struct RegionOp ops[] = {
+  80287e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802882:	48 c7 45 c8 00 10 00 	movq   $0x1000,-0x38(%rbp)
+  802889:	00 
+    if ((res = sys_region_batch(ops, sizeof ops / sizeof *ops)) < 0) goto err1;
+  80288a:	be 04 00 00 00       	mov    $0x4,%esi
+  80288f:	48 8d bd 30 ff ff ff 	lea    -0xd0(%rbp),%rdi
+  802896:	48 b8 fc 14 80 00 00 	movabs $0x8014fc,%rax
+  80289d:	00 00 00 
+  8028a0:	ff d0                	call   *%rax
+  8028a2:	89 c3                	mov    %eax,%ebx
+  8028a4:	85 c0                	test   %eax,%eax
+  8028a6:	0f 88 ad 00 00 00    	js     802959 <pipe+0x1c3>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8028ac:	be 00 10 00 00       	mov    $0x1000,%esi
+  8028b1:	4c 89 ef             	mov    %r13,%rdi
+  8028b4:	48 b8 6b 13 80 00 00 	movabs $0x80136b,%rax
+  8028bb:	00 00 00 
+  8028be:	ff d0                	call   *%rax
+  8028c0:	83 f8 02             	cmp    $0x2,%eax
+  8028c3:	75 5f                	jne    802924 <pipe+0x18e>
+    fd0->fd_dev_id = devpipe.dev_id;
+  8028c5:	a1 60 40 80 00 00 00 	movabs 0x804060,%eax
+  8028cc:	00 00 
+  8028ce:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8028d2:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  8028d4:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8028d8:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  8028df:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8028e3:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  8028e5:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8028e9:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  8028f0:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8028f4:	48 bb 68 19 80 00 00 	movabs $0x801968,%rbx
+  8028fb:	00 00 00 
+  8028fe:	ff d3                	call   *%rbx
+  802900:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  802904:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  802908:	ff d3                	call   *%rbx
+  80290a:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  80290f:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  802914:	89 d8                	mov    %ebx,%eax
+  802916:	48 81 c4 b8 00 00 00 	add    $0xb8,%rsp
+  80291d:	5b                   	pop    %rbx
+  80291e:	41 5c                	pop    %r12
+  802920:	41 5d                	pop    %r13
+  802922:	5d                   	pop    %rbp
+  802923:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  802924:	48 b9 30 38 80 00 00 	movabs $0x803830,%rcx
+  80292b:	00 00 00 
+  80292e:	48 ba 07 38 80 00 00 	movabs $0x803807,%rdx
+  802935:	00 00 00 
+  802938:	be 33 00 00 00       	mov    $0x33,%esi
+  80293d:	48 bf 1c 38 80 00 00 	movabs $0x80381c,%rdi
+  802944:	00 00 00 
+  802947:	b8 00 00 00 00       	mov    $0x0,%eax
+  80294c:	49 b8 a4 03 80 00 00 	movabs $0x8003a4,%r8
+  802953:	00 00 00 
+  802956:	41 ff d0             	call   *%r8
+        ops[i].type = REGION_UNMAP;
+  802959:	c7 85 30 ff ff ff 02 	movl   $0x2,-0xd0(%rbp)
+  802960:	00 00 00 
+  802963:	c7 85 58 ff ff ff 02 	movl   $0x2,-0xa8(%rbp)
+  80296a:	00 00 00 
+  80296d:	c7 45 80 02 00 00 00 	movl   $0x2,-0x80(%rbp)
+  802974:	c7 45 a8 02 00 00 00 	movl   $0x2,-0x58(%rbp)
+    sys_region_batch(ops, sizeof ops / sizeof *ops);
+  80297b:	be 04 00 00 00       	mov    $0x4,%esi
+  802980:	48 8d bd 30 ff ff ff 	lea    -0xd0(%rbp),%rdi
+  802987:	48 b8 fc 14 80 00 00 	movabs $0x8014fc,%rax
+  80298e:	00 00 00 
+  802991:	ff d0                	call   *%rax
+  802993:	e9 7c ff ff ff       	jmp    802914 <pipe+0x17e>
+
+0000000000802998 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  802998:	55                   	push   %rbp
+  802999:	48 89 e5             	mov    %rsp,%rbp
+  80299c:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8029a0:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8029a4:	48 b8 29 1a 80 00 00 	movabs $0x801a29,%rax
+  8029ab:	00 00 00 
+  8029ae:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8029b0:	85 c0                	test   %eax,%eax
+  8029b2:	78 35                	js     8029e9 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  8029b4:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8029b8:	48 b8 7a 19 80 00 00 	movabs $0x80197a,%rax
+  8029bf:	00 00 00 
+  8029c2:	ff d0                	call   *%rax
+  8029c4:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8029c7:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8029cc:	be 00 10 00 00       	mov    $0x1000,%esi
+  8029d1:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8029d5:	48 b8 9d 13 80 00 00 	movabs $0x80139d,%rax
+  8029dc:	00 00 00 
+  8029df:	ff d0                	call   *%rax
+  8029e1:	85 c0                	test   %eax,%eax
+  8029e3:	0f 94 c0             	sete   %al
+  8029e6:	0f b6 c0             	movzbl %al,%eax
+}
+  8029e9:	c9                   	leave
+  8029ea:	c3                   	ret
+
+00000000008029eb <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8029eb:	48 89 f8             	mov    %rdi,%rax
+  8029ee:	48 c1 e8 27          	shr    $0x27,%rax
+  8029f2:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  8029f9:	01 00 00 
+  8029fc:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802a00:	f6 c2 01             	test   $0x1,%dl
+  802a03:	74 6d                	je     802a72 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  802a05:	48 89 f8             	mov    %rdi,%rax
+  802a08:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802a0c:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802a13:	01 00 00 
+  802a16:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802a1a:	f6 c2 01             	test   $0x1,%dl
+  802a1d:	74 62                	je     802a81 <get_uvpt_entry+0x96>
+  802a1f:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802a26:	01 00 00 
+  802a29:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802a2d:	f6 c2 80             	test   $0x80,%dl
+  802a30:	75 4f                	jne    802a81 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  802a32:	48 89 f8             	mov    %rdi,%rax
+  802a35:	48 c1 e8 15          	shr    $0x15,%rax
+  802a39:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802a40:	01 00 00 
+  802a43:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802a47:	f6 c2 01             	test   $0x1,%dl
+  802a4a:	74 44                	je     802a90 <get_uvpt_entry+0xa5>
+  802a4c:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802a53:	01 00 00 
+  802a56:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802a5a:	f6 c2 80             	test   $0x80,%dl
+  802a5d:	75 31                	jne    802a90 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  802a5f:	48 c1 ef 0c          	shr    $0xc,%rdi
+  802a63:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802a6a:	01 00 00 
+  802a6d:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  802a71:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  802a72:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  802a79:	01 00 00 
+  802a7c:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802a80:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  802a81:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802a88:	01 00 00 
+  802a8b:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802a8f:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  802a90:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802a97:	01 00 00 
+  802a9a:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802a9e:	c3                   	ret
+
+0000000000802a9f <get_prot>:
+
+int
+get_prot(void *va) {
+  802a9f:	55                   	push   %rbp
+  802aa0:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  802aa3:	48 b8 eb 29 80 00 00 	movabs $0x8029eb,%rax
+  802aaa:	00 00 00 
+  802aad:	ff d0                	call   *%rax
+  802aaf:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  802ab2:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  802ab7:	89 c1                	mov    %eax,%ecx
+  802ab9:	83 c9 04             	or     $0x4,%ecx
+  802abc:	f6 c2 01             	test   $0x1,%dl
+  802abf:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  802ac2:	89 c1                	mov    %eax,%ecx
+  802ac4:	83 c9 02             	or     $0x2,%ecx
+  802ac7:	f6 c2 02             	test   $0x2,%dl
+  802aca:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  802acd:	89 c1                	mov    %eax,%ecx
+  802acf:	83 c9 01             	or     $0x1,%ecx
+  802ad2:	48 85 d2             	test   %rdx,%rdx
+  802ad5:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  802ad8:	89 c1                	mov    %eax,%ecx
+  802ada:	83 c9 40             	or     $0x40,%ecx
+  802add:	f6 c6 04             	test   $0x4,%dh
+  802ae0:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  802ae3:	5d                   	pop    %rbp
+  802ae4:	c3                   	ret
+
+0000000000802ae5 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  802ae5:	55                   	push   %rbp
+  802ae6:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  802ae9:	48 b8 eb 29 80 00 00 	movabs $0x8029eb,%rax
+  802af0:	00 00 00 
+  802af3:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  802af5:	48 c1 e8 06          	shr    $0x6,%rax
+  802af9:	83 e0 01             	and    $0x1,%eax
+}
+  802afc:	5d                   	pop    %rbp
+  802afd:	c3                   	ret
+
+0000000000802afe <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  802afe:	55                   	push   %rbp
+  802aff:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  802b02:	48 b8 eb 29 80 00 00 	movabs $0x8029eb,%rax
+  802b09:	00 00 00 
+  802b0c:	ff d0                	call   *%rax
+  802b0e:	83 e0 01             	and    $0x1,%eax
+}
+  802b11:	5d                   	pop    %rbp
+  802b12:	c3                   	ret
+
+0000000000802b13 <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  802b13:	55                   	push   %rbp
+  802b14:	48 89 e5             	mov    %rsp,%rbp
+  802b17:	41 57                	push   %r15
+  802b19:	41 56                	push   %r14
+  802b1b:	41 55                	push   %r13
+  802b1d:	41 54                	push   %r12
+  802b1f:	53                   	push   %rbx
+  802b20:	48 83 ec 38          	sub    $0x38,%rsp
+  802b24:	49 89 f7             	mov    %rsi,%r15
+  802b27:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+                    }
+                    continue;
+                }
+                for (int ptei = 0; ptei < PT_ENTRY_COUNT; ptei++) {
+                    uintptr_t pte_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, pdei, ptei, 0);
+                    pte_t pte = uvpt[VPT(pte_addr)];
+  802b2d:	49 bd 00 00 00 00 00 	movabs $0x10000000000,%r13
+  802b34:	01 00 00 
+  802b37:	4d 89 e6             	mov    %r12,%r14
+  802b3a:	49 89 fc             	mov    %rdi,%r12
+  802b3d:	e9 19 01 00 00       	jmp    802c5b <foreach_shared_region+0x148>
+  802b42:	48 89 5d b0          	mov    %rbx,-0x50(%rbp)
+  802b46:	4c 89 75 a8          	mov    %r14,-0x58(%rbp)
+  802b4a:	eb 52                	jmp    802b9e <foreach_shared_region+0x8b>
+                for (int ptei = 0; ptei < PT_ENTRY_COUNT; ptei++) {
+  802b4c:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802b53:	48 81 fb 00 00 20 00 	cmp    $0x200000,%rbx
+  802b5a:	74 2e                	je     802b8a <foreach_shared_region+0x77>
+                    uintptr_t pte_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, pdei, ptei, 0);
+  802b5c:	48 89 df             	mov    %rbx,%rdi
+  802b5f:	4c 09 f7             	or     %r14,%rdi
+                    pte_t pte = uvpt[VPT(pte_addr)];
+  802b62:	48 89 f8             	mov    %rdi,%rax
+  802b65:	48 c1 e8 0c          	shr    $0xc,%rax
+  802b69:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+                    if ((pte & PTE_P) && (pte & PTE_SHARE)) {
+  802b6e:	25 01 04 00 00       	and    $0x401,%eax
+  802b73:	48 3d 01 04 00 00    	cmp    $0x401,%rax
+  802b79:	75 d1                	jne    802b4c <foreach_shared_region+0x39>
+                        fun((void*)pte_addr, (void*)(pte_addr + PAGE_SIZE), arg);
+  802b7b:	48 8d b7 00 10 00 00 	lea    0x1000(%rdi),%rsi
+  802b82:	4c 89 fa             	mov    %r15,%rdx
+  802b85:	41 ff d4             	call   *%r12
+  802b88:	eb c2                	jmp    802b4c <foreach_shared_region+0x39>
+            for (int pdei = 0; pdei < PD_ENTRY_COUNT; pdei++) {
+  802b8a:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  802b91:	00 
+  802b92:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802b96:	48 3d 00 00 00 40    	cmp    $0x40000000,%rax
+  802b9c:	74 46                	je     802be4 <foreach_shared_region+0xd1>
+                uintptr_t pde_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, pdei, 0, 0);
+  802b9e:	4c 8b 75 c8          	mov    -0x38(%rbp),%r14
+  802ba2:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802ba6:	49 09 c6             	or     %rax,%r14
+                pde_t pde = uvpd[VPD(pde_addr)];
+  802ba9:	4c 89 f0             	mov    %r14,%rax
+  802bac:	48 c1 e8 15          	shr    $0x15,%rax
+  802bb0:	48 b9 00 00 00 80 00 	movabs $0x10080000000,%rcx
+  802bb7:	01 00 00 
+  802bba:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+                if (!(pde & PTE_P)) {
+  802bbe:	a8 01                	test   $0x1,%al
+  802bc0:	74 c8                	je     802b8a <foreach_shared_region+0x77>
+                if (pde & PTE_PS) {
+  802bc2:	48 89 c3             	mov    %rax,%rbx
+  802bc5:	81 e3 80 00 00 00    	and    $0x80,%ebx
+  802bcb:	74 8f                	je     802b5c <foreach_shared_region+0x49>
+                    if (pde & PTE_SHARE) {
+  802bcd:	f6 c4 04             	test   $0x4,%ah
+  802bd0:	74 b8                	je     802b8a <foreach_shared_region+0x77>
+                        fun((void*)pde_addr, (void*)(pde_addr + 1024 * 1024 * 2), arg);
+  802bd2:	49 8d b6 00 00 20 00 	lea    0x200000(%r14),%rsi
+  802bd9:	4c 89 fa             	mov    %r15,%rdx
+  802bdc:	4c 89 f7             	mov    %r14,%rdi
+  802bdf:	41 ff d4             	call   *%r12
+  802be2:	eb a6                	jmp    802b8a <foreach_shared_region+0x77>
+  802be4:	48 8b 5d b0          	mov    -0x50(%rbp),%rbx
+  802be8:	4c 8b 75 a8          	mov    -0x58(%rbp),%r14
+        for (int pdpei = 0; pdpei < PDP_ENTRY_COUNT; pdpei++) {
+  802bec:	48 81 c3 00 00 00 40 	add    $0x40000000,%rbx
+  802bf3:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802bfa:	00 00 00 
+  802bfd:	48 39 c3             	cmp    %rax,%rbx
+  802c00:	74 4c                	je     802c4e <foreach_shared_region+0x13b>
+            uintptr_t pdpe_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, 0, 0, 0);
+  802c02:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802c06:	48 09 d8             	or     %rbx,%rax
+  802c09:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+            pdpe_t pdpe = uvpdp[VPDP(pdpe_addr)];
+  802c0d:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802c11:	48 b9 00 00 40 80 00 	movabs $0x10080400000,%rcx
+  802c18:	01 00 00 
+  802c1b:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+            if (!(pdpe & PTE_P)) {
+  802c1f:	a8 01                	test   $0x1,%al
+  802c21:	74 c9                	je     802bec <foreach_shared_region+0xd9>
+            if (pdpe & PTE_PS) {
+  802c23:	48 89 c1             	mov    %rax,%rcx
+  802c26:	81 e1 80 00 00 00    	and    $0x80,%ecx
+  802c2c:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  802c30:	0f 84 0c ff ff ff    	je     802b42 <foreach_shared_region+0x2f>
+                if (pdpe & PTE_SHARE) {
+  802c36:	f6 c4 04             	test   $0x4,%ah
+  802c39:	74 b1                	je     802bec <foreach_shared_region+0xd9>
+                    fun((void*)pdpe_addr, (void*)(pdpe_addr + 1024 * 1024 * 1024), arg); 
+  802c3b:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  802c3f:	48 8d b7 00 00 00 40 	lea    0x40000000(%rdi),%rsi
+  802c46:	4c 89 fa             	mov    %r15,%rdx
+  802c49:	41 ff d4             	call   *%r12
+  802c4c:	eb 9e                	jmp    802bec <foreach_shared_region+0xd9>
+    for (int pml4ei = 0; pml4ei < PML4_ENTRY_COUNT; pml4ei++) {
+  802c4e:	49 83 c6 01          	add    $0x1,%r14
+  802c52:	49 81 fe 00 02 00 00 	cmp    $0x200,%r14
+  802c59:	74 24                	je     802c7f <foreach_shared_region+0x16c>
+        pml4e_t pml4e = uvpml4[VPML4(pml4_addr)];
+  802c5b:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  802c62:	01 00 00 
+  802c65:	4a 8b 04 f0          	mov    (%rax,%r14,8),%rax
+        if (!(pml4e & PTE_P)) {
+  802c69:	a8 01                	test   $0x1,%al
+  802c6b:	74 e1                	je     802c4e <foreach_shared_region+0x13b>
+  802c6d:	4c 89 f0             	mov    %r14,%rax
+  802c70:	48 c1 e0 27          	shl    $0x27,%rax
+  802c74:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  802c78:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802c7d:	eb 83                	jmp    802c02 <foreach_shared_region+0xef>
+            }
+        }
+    }
+    
+    return 0;
+}
+  802c7f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c84:	48 83 c4 38          	add    $0x38,%rsp
+  802c88:	5b                   	pop    %rbx
+  802c89:	41 5c                	pop    %r12
+  802c8b:	41 5d                	pop    %r13
+  802c8d:	41 5e                	pop    %r14
+  802c8f:	41 5f                	pop    %r15
+  802c91:	5d                   	pop    %rbp
+  802c92:	c3                   	ret
+
+0000000000802c93 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  802c93:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c98:	c3                   	ret
+
+0000000000802c99 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  802c99:	55                   	push   %rbp
+  802c9a:	48 89 e5             	mov    %rsp,%rbp
+  802c9d:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  802ca0:	48 be 54 38 80 00 00 	movabs $0x803854,%rsi
+  802ca7:	00 00 00 
+  802caa:	48 b8 19 0e 80 00 00 	movabs $0x800e19,%rax
+  802cb1:	00 00 00 
+  802cb4:	ff d0                	call   *%rax
+    return 0;
+}
+  802cb6:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cbb:	5d                   	pop    %rbp
+  802cbc:	c3                   	ret
+
+0000000000802cbd <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  802cbd:	55                   	push   %rbp
+  802cbe:	48 89 e5             	mov    %rsp,%rbp
+  802cc1:	41 57                	push   %r15
+  802cc3:	41 56                	push   %r14
+  802cc5:	41 55                	push   %r13
+  802cc7:	41 54                	push   %r12
+  802cc9:	53                   	push   %rbx
+  802cca:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  802cd1:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  802cd8:	48 85 d2             	test   %rdx,%rdx
+  802cdb:	74 7a                	je     802d57 <devcons_write+0x9a>
+  802cdd:	49 89 d6             	mov    %rdx,%r14
+  802ce0:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802ce6:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  802ceb:	49 bf 13 10 80 00 00 	movabs $0x801013,%r15
+  802cf2:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  802cf5:	4c 89 f3             	mov    %r14,%rbx
+  802cf8:	48 29 f3             	sub    %rsi,%rbx
+  802cfb:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802d00:	48 39 c3             	cmp    %rax,%rbx
+  802d03:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  802d07:	4c 63 eb             	movslq %ebx,%r13
+  802d0a:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  802d11:	48 01 c6             	add    %rax,%rsi
+  802d14:	4c 89 ea             	mov    %r13,%rdx
+  802d17:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802d1e:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  802d21:	4c 89 ee             	mov    %r13,%rsi
+  802d24:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802d2b:	48 b8 40 12 80 00 00 	movabs $0x801240,%rax
+  802d32:	00 00 00 
+  802d35:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  802d37:	41 01 dc             	add    %ebx,%r12d
+  802d3a:	49 63 f4             	movslq %r12d,%rsi
+  802d3d:	4c 39 f6             	cmp    %r14,%rsi
+  802d40:	72 b3                	jb     802cf5 <devcons_write+0x38>
+    return res;
+  802d42:	49 63 c4             	movslq %r12d,%rax
+}
+  802d45:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  802d4c:	5b                   	pop    %rbx
+  802d4d:	41 5c                	pop    %r12
+  802d4f:	41 5d                	pop    %r13
+  802d51:	41 5e                	pop    %r14
+  802d53:	41 5f                	pop    %r15
+  802d55:	5d                   	pop    %rbp
+  802d56:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  802d57:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802d5d:	eb e3                	jmp    802d42 <devcons_write+0x85>
+
+0000000000802d5f <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  802d5f:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  802d62:	ba 00 00 00 00       	mov    $0x0,%edx
+  802d67:	48 85 c0             	test   %rax,%rax
+  802d6a:	74 55                	je     802dc1 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  802d6c:	55                   	push   %rbp
+  802d6d:	48 89 e5             	mov    %rsp,%rbp
+  802d70:	41 55                	push   %r13
+  802d72:	41 54                	push   %r12
+  802d74:	53                   	push   %rbx
+  802d75:	48 83 ec 08          	sub    $0x8,%rsp
+  802d79:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  802d7c:	48 bb 6d 12 80 00 00 	movabs $0x80126d,%rbx
+  802d83:	00 00 00 
+  802d86:	49 bc 3a 13 80 00 00 	movabs $0x80133a,%r12
+  802d8d:	00 00 00 
+  802d90:	eb 03                	jmp    802d95 <devcons_read+0x36>
+  802d92:	41 ff d4             	call   *%r12
+  802d95:	ff d3                	call   *%rbx
+  802d97:	85 c0                	test   %eax,%eax
+  802d99:	74 f7                	je     802d92 <devcons_read+0x33>
+    if (c < 0) return c;
+  802d9b:	48 63 d0             	movslq %eax,%rdx
+  802d9e:	78 13                	js     802db3 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  802da0:	ba 00 00 00 00       	mov    $0x0,%edx
+  802da5:	83 f8 04             	cmp    $0x4,%eax
+  802da8:	74 09                	je     802db3 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  802daa:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  802dae:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  802db3:	48 89 d0             	mov    %rdx,%rax
+  802db6:	48 83 c4 08          	add    $0x8,%rsp
+  802dba:	5b                   	pop    %rbx
+  802dbb:	41 5c                	pop    %r12
+  802dbd:	41 5d                	pop    %r13
+  802dbf:	5d                   	pop    %rbp
+  802dc0:	c3                   	ret
+  802dc1:	48 89 d0             	mov    %rdx,%rax
+  802dc4:	c3                   	ret
+
+0000000000802dc5 <cputchar>:
+cputchar(int ch) {
+  802dc5:	55                   	push   %rbp
+  802dc6:	48 89 e5             	mov    %rsp,%rbp
+  802dc9:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  802dcd:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  802dd1:	be 01 00 00 00       	mov    $0x1,%esi
+  802dd6:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  802dda:	48 b8 40 12 80 00 00 	movabs $0x801240,%rax
+  802de1:	00 00 00 
+  802de4:	ff d0                	call   *%rax
+}
+  802de6:	c9                   	leave
+  802de7:	c3                   	ret
+
+0000000000802de8 <getchar>:
+getchar(void) {
+  802de8:	55                   	push   %rbp
+  802de9:	48 89 e5             	mov    %rsp,%rbp
+  802dec:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  802df0:	ba 01 00 00 00       	mov    $0x1,%edx
+  802df5:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  802df9:	bf 00 00 00 00       	mov    $0x0,%edi
+  802dfe:	48 b8 0c 1d 80 00 00 	movabs $0x801d0c,%rax
+  802e05:	00 00 00 
+  802e08:	ff d0                	call   *%rax
+  802e0a:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  802e0c:	85 c0                	test   %eax,%eax
+  802e0e:	78 06                	js     802e16 <getchar+0x2e>
+  802e10:	74 08                	je     802e1a <getchar+0x32>
+  802e12:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  802e16:	89 d0                	mov    %edx,%eax
+  802e18:	c9                   	leave
+  802e19:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  802e1a:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  802e1f:	eb f5                	jmp    802e16 <getchar+0x2e>
+
+0000000000802e21 <iscons>:
+iscons(int fdnum) {
+  802e21:	55                   	push   %rbp
+  802e22:	48 89 e5             	mov    %rsp,%rbp
+  802e25:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  802e29:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802e2d:	48 b8 29 1a 80 00 00 	movabs $0x801a29,%rax
+  802e34:	00 00 00 
+  802e37:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802e39:	85 c0                	test   %eax,%eax
+  802e3b:	78 18                	js     802e55 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  802e3d:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802e41:	48 b8 a0 40 80 00 00 	movabs $0x8040a0,%rax
+  802e48:	00 00 00 
+  802e4b:	8b 00                	mov    (%rax),%eax
+  802e4d:	39 02                	cmp    %eax,(%rdx)
+  802e4f:	0f 94 c0             	sete   %al
+  802e52:	0f b6 c0             	movzbl %al,%eax
+}
+  802e55:	c9                   	leave
+  802e56:	c3                   	ret
+
+0000000000802e57 <opencons>:
+opencons(void) {
+  802e57:	55                   	push   %rbp
+  802e58:	48 89 e5             	mov    %rsp,%rbp
+  802e5b:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802e5f:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  802e63:	48 b8 0f 1a 80 00 00 	movabs $0x801a0f,%rax
+  802e6a:	00 00 00 
+  802e6d:	ff d0                	call   *%rax
+  802e6f:	85 c0                	test   %eax,%eax
+  802e71:	78 49                	js     802ebc <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  802e73:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802e78:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802e7d:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  802e81:	bf 00 00 00 00       	mov    $0x0,%edi
+  802e86:	48 b8 c9 13 80 00 00 	movabs $0x8013c9,%rax
+  802e8d:	00 00 00 
+  802e90:	ff d0                	call   *%rax
+  802e92:	85 c0                	test   %eax,%eax
+  802e94:	78 26                	js     802ebc <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  802e96:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802e9a:	a1 a0 40 80 00 00 00 	movabs 0x8040a0,%eax
+  802ea1:	00 00 
+  802ea3:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  802ea5:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802ea9:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  802eb0:	48 b8 68 19 80 00 00 	movabs $0x801968,%rax
+  802eb7:	00 00 00 
+  802eba:	ff d0                	call   *%rax
+}
+  802ebc:	c9                   	leave
+  802ebd:	c3                   	ret
+
+0000000000802ebe <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  802ebe:	55                   	push   %rbp
+  802ebf:	48 89 e5             	mov    %rsp,%rbp
+  802ec2:	41 55                	push   %r13
+  802ec4:	41 54                	push   %r12
+  802ec6:	53                   	push   %rbx
+  802ec7:	48 83 ec 08          	sub    $0x8,%rsp
+  802ecb:	49 89 fc             	mov    %rdi,%r12
+  802ece:	48 89 f7             	mov    %rsi,%rdi
+  802ed1:	48 89 d3             	mov    %rdx,%rbx
+  802ed4:	49 89 cd             	mov    %rcx,%r13
+    // LAB 9: Your code here:
+    int res = sys_ipc_recv(!pg ? (void*)MAX_USER_ADDRESS : pg, !size ? 0 : *size);
+  802ed7:	be 00 00 00 00       	mov    $0x0,%esi
+  802edc:	48 85 d2             	test   %rdx,%rdx
+  802edf:	74 03                	je     802ee4 <ipc_recv+0x26>
+  802ee1:	48 8b 32             	mov    (%rdx),%rsi
+  802ee4:	48 85 ff             	test   %rdi,%rdi
+  802ee7:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802eee:	00 00 00 
+  802ef1:	48 0f 44 f8          	cmove  %rax,%rdi
+  802ef5:	48 b8 9b 17 80 00 00 	movabs $0x80179b,%rax
+  802efc:	00 00 00 
+  802eff:	ff d0                	call   *%rax
+    if (res < 0) {
+  802f01:	85 c0                	test   %eax,%eax
+  802f03:	78 66                	js     802f6b <ipc_recv+0xad>
+        if (size) {
+            *size = 0;
+        }
+        return res;
+    }
+    if (from_env_store) {
+  802f05:	4d 85 e4             	test   %r12,%r12
+  802f08:	74 14                	je     802f1e <ipc_recv+0x60>
+        *from_env_store = thisenv->env_ipc_from;
+  802f0a:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802f11:	00 00 00 
+  802f14:	8b 80 ac 01 00 00    	mov    0x1ac(%rax),%eax
+  802f1a:	41 89 04 24          	mov    %eax,(%r12)
+    }
+    if (perm_store) {
+  802f1e:	4d 85 ed             	test   %r13,%r13
+  802f21:	74 14                	je     802f37 <ipc_recv+0x79>
+        *perm_store = thisenv->env_ipc_perm;
+  802f23:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802f2a:	00 00 00 
+  802f2d:	8b 80 b0 01 00 00    	mov    0x1b0(%rax),%eax
+  802f33:	41 89 45 00          	mov    %eax,0x0(%r13)
+    }
+    if (size) {
+  802f37:	48 85 db             	test   %rbx,%rbx
+  802f3a:	74 14                	je     802f50 <ipc_recv+0x92>
+        *size = thisenv->env_ipc_maxsz;
+  802f3c:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802f43:	00 00 00 
+  802f46:	48 8b 80 a0 01 00 00 	mov    0x1a0(%rax),%rax
+  802f4d:	48 89 03             	mov    %rax,(%rbx)
+    }
+    return thisenv->env_ipc_value;
+  802f50:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802f57:	00 00 00 
+  802f5a:	8b 80 a8 01 00 00    	mov    0x1a8(%rax),%eax
+}
+  802f60:	48 83 c4 08          	add    $0x8,%rsp
+  802f64:	5b                   	pop    %rbx
+  802f65:	41 5c                	pop    %r12
+  802f67:	41 5d                	pop    %r13
+  802f69:	5d                   	pop    %rbp
+  802f6a:	c3                   	ret
+        if (from_env_store) {
+  802f6b:	4d 85 e4             	test   %r12,%r12
+  802f6e:	74 08                	je     802f78 <ipc_recv+0xba>
+            *from_env_store = 0;
+  802f70:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  802f77:	00 
+        if (perm_store) {
+  802f78:	4d 85 ed             	test   %r13,%r13
+  802f7b:	74 08                	je     802f85 <ipc_recv+0xc7>
+            *perm_store = 0;
+  802f7d:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  802f84:	00 
+        if (size) {
+  802f85:	48 85 db             	test   %rbx,%rbx
+  802f88:	74 d6                	je     802f60 <ipc_recv+0xa2>
+            *size = 0;
+  802f8a:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  802f91:	eb cd                	jmp    802f60 <ipc_recv+0xa2>
+
+0000000000802f93 <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  802f93:	55                   	push   %rbp
+  802f94:	48 89 e5             	mov    %rsp,%rbp
+  802f97:	41 57                	push   %r15
+  802f99:	41 56                	push   %r14
+  802f9b:	41 55                	push   %r13
+  802f9d:	41 54                	push   %r12
+  802f9f:	53                   	push   %rbx
+  802fa0:	48 83 ec 18          	sub    $0x18,%rsp
+  802fa4:	41 89 fd             	mov    %edi,%r13d
+  802fa7:	89 75 cc             	mov    %esi,-0x34(%rbp)
+  802faa:	49 89 cc             	mov    %rcx,%r12
+  802fad:	44 89 45 c8          	mov    %r8d,-0x38(%rbp)
+    // LAB 9: Your code here:
+    int res = 0;
+    while ((res = sys_ipc_try_send(to_env, val, !pg ? (void*)MAX_USER_ADDRESS : pg, size, perm)) < 0) {
+  802fb1:	48 85 d2             	test   %rdx,%rdx
+  802fb4:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802fbb:	00 00 00 
+  802fbe:	48 0f 45 c2          	cmovne %rdx,%rax
+  802fc2:	48 89 c3             	mov    %rax,%rbx
+  802fc5:	49 be 6f 17 80 00 00 	movabs $0x80176f,%r14
+  802fcc:	00 00 00 
+        if (res != -E_IPC_NOT_RECV) {
+            panic("sys_ipc_try_send failed: %i", res);
+        }
+        sys_yield();
+  802fcf:	49 bf 3a 13 80 00 00 	movabs $0x80133a,%r15
+  802fd6:	00 00 00 
+    while ((res = sys_ipc_try_send(to_env, val, !pg ? (void*)MAX_USER_ADDRESS : pg, size, perm)) < 0) {
+  802fd9:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  802fdc:	44 8b 45 c8          	mov    -0x38(%rbp),%r8d
+  802fe0:	4c 89 e1             	mov    %r12,%rcx
+  802fe3:	48 89 da             	mov    %rbx,%rdx
+  802fe6:	44 89 ef             	mov    %r13d,%edi
+  802fe9:	41 ff d6             	call   *%r14
+  802fec:	85 c0                	test   %eax,%eax
+  802fee:	79 37                	jns    803027 <ipc_send+0x94>
+        if (res != -E_IPC_NOT_RECV) {
+  802ff0:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  802ff3:	75 05                	jne    802ffa <ipc_send+0x67>
+        sys_yield();
+  802ff5:	41 ff d7             	call   *%r15
+  802ff8:	eb df                	jmp    802fd9 <ipc_send+0x46>
+            panic("sys_ipc_try_send failed: %i", res);
+  802ffa:	89 c1                	mov    %eax,%ecx
+  802ffc:	48 ba 60 38 80 00 00 	movabs $0x803860,%rdx
+  803003:	00 00 00 
+  803006:	be 40 00 00 00       	mov    $0x40,%esi
+  80300b:	48 bf 7c 38 80 00 00 	movabs $0x80387c,%rdi
+  803012:	00 00 00 
+  803015:	b8 00 00 00 00       	mov    $0x0,%eax
+  80301a:	49 b8 a4 03 80 00 00 	movabs $0x8003a4,%r8
+  803021:	00 00 00 
+  803024:	41 ff d0             	call   *%r8
+    }
+    return;
+}
+  803027:	48 83 c4 18          	add    $0x18,%rsp
+  80302b:	5b                   	pop    %rbx
+  80302c:	41 5c                	pop    %r12
+  80302e:	41 5d                	pop    %r13
+  803030:	41 5e                	pop    %r14
+  803032:	41 5f                	pop    %r15
+  803034:	5d                   	pop    %rbp
+  803035:	c3                   	ret
+
+0000000000803036 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  803036:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  80303b:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  803042:	00 00 00 
+  803045:	48 69 d0 d0 01 00 00 	imul   $0x1d0,%rax,%rdx
+  80304c:	48 01 ca             	add    %rcx,%rdx
+  80304f:	8b 92 e8 00 00 00    	mov    0xe8(%rdx),%edx
+  803055:	39 fa                	cmp    %edi,%edx
+  803057:	74 12                	je     80306b <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  803059:	48 83 c0 01          	add    $0x1,%rax
+  80305d:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  803063:	75 e0                	jne    803045 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  803065:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80306a:	c3                   	ret
+            return envs[i].env_id;
+  80306b:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+  803072:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  803079:	00 00 00 
+  80307c:	48 01 d0             	add    %rdx,%rax
+  80307f:	8b 80 e0 00 00 00    	mov    0xe0(%rax),%eax
+  803085:	c3                   	ret
+  803086:	66 90                	xchg   %ax,%ax
+
+0000000000803088 <__rodata_start>:
+  803088:	74 65                	je     8030ef <__rodata_start+0x67>
+  80308a:	73 74                	jae    803100 <__rodata_start+0x78>
+  80308c:	69 6e 67 20 66 6f 72 	imul   $0x726f6620,0x67(%rsi),%ebp
+  803093:	20 70 69             	and    %dh,0x69(%rax)
+  803096:	70 65                	jo     8030fd <__rodata_start+0x75>
+  803098:	69 73 63 6c 6f 73 65 	imul   $0x65736f6c,0x63(%rbx),%esi
+  80309f:	64 20 72 61          	and    %dh,%fs:0x61(%rdx)
+  8030a3:	63 65 2e             	movsxd 0x2e(%rbp),%esp
+  8030a6:	2e 2e 0a 00          	cs cs or (%rax),%al
+  8030aa:	00 00                	add    %al,(%rax)
+  8030ac:	00 00                	add    %al,(%rax)
+  8030ae:	00 00                	add    %al,(%rax)
+  8030b0:	73 6f                	jae    803121 <__rodata_start+0x99>
+  8030b2:	6d                   	insl   (%dx),%es:(%rdi)
+  8030b3:	65 68 6f 77 20 74    	gs push $0x7420776f
+  8030b9:	68 65 20 6f 74       	push   $0x746f2065
+  8030be:	68 65 72 20 65       	push   $0x65207265
+  8030c3:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8030c4:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  8030c8:	20 70 5b             	and    %dh,0x5b(%rax)
+  8030cb:	30 5d 20             	xor    %bl,0x20(%rbp)
+  8030ce:	67 6f                	outsl  %ds:(%esi),(%dx)
+  8030d0:	74 20                	je     8030f2 <__rodata_start+0x6a>
+  8030d2:	63 6c 6f 73          	movsxd 0x73(%rdi,%rbp,2),%ebp
+  8030d6:	65 64 21 00          	gs and %eax,%fs:(%rax)
+  8030da:	70 69                	jo     803145 <__rodata_start+0xbd>
+  8030dc:	70 65                	jo     803143 <__rodata_start+0xbb>
+  8030de:	3a 20                	cmp    (%rax),%ah
+  8030e0:	25 69 00 75 73       	and    $0x73750069,%eax
+  8030e5:	65 72 2f             	gs jb  803117 <__rodata_start+0x8f>
+  8030e8:	74 65                	je     80314f <__rodata_start+0xc7>
+  8030ea:	73 74                	jae    803160 <__rodata_start+0xd8>
+  8030ec:	70 69                	jo     803157 <__rodata_start+0xcf>
+  8030ee:	70 65                	jo     803155 <__rodata_start+0xcd>
+  8030f0:	72 61                	jb     803153 <__rodata_start+0xcb>
+  8030f2:	63 65 32             	movsxd 0x32(%rbp),%esp
+  8030f5:	2e 63 00             	cs movsxd (%rax),%eax
+  8030f8:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  8030fa:	72 6b                	jb     803167 <__rodata_start+0xdf>
+  8030fc:	3a 20                	cmp    (%rax),%ah
+  8030fe:	25 69 00 25 64       	and    $0x64250069,%eax
+  803103:	2e 00 0a             	cs add %cl,(%rdx)
+  803106:	52                   	push   %rdx
+  803107:	41                   	rex.B
+  803108:	43                   	rex.XB
+  803109:	45 3a 20             	cmp    (%r8),%r12b
+  80310c:	70 69                	jo     803177 <__rodata_start+0xef>
+  80310e:	70 65                	jo     803175 <__rodata_start+0xed>
+  803110:	20 61 70             	and    %ah,0x70(%rcx)
+  803113:	70 65                	jo     80317a <__rodata_start+0xf2>
+  803115:	61                   	(bad)
+  803116:	72 73                	jb     80318b <__rodata_start+0x103>
+  803118:	20 63 6c             	and    %ah,0x6c(%rbx)
+  80311b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80311c:	73 65                	jae    803183 <__rodata_start+0xfb>
+  80311e:	64 0a 00             	or     %fs:(%rax),%al
+  803121:	63 68 69             	movsxd 0x69(%rax),%ebp
+  803124:	6c                   	insb   (%dx),%es:(%rdi)
+  803125:	64 20 64 6f 6e       	and    %ah,%fs:0x6e(%rdi,%rbp,2)
+  80312a:	65 20 77 69          	and    %dh,%gs:0x69(%rdi)
+  80312e:	74 68                	je     803198 <__rodata_start+0x110>
+  803130:	20 6c 6f 6f          	and    %ch,0x6f(%rdi,%rbp,2)
+  803134:	70 0a                	jo     803140 <__rodata_start+0xb8>
+  803136:	00 63 61             	add    %ah,0x61(%rbx)
+  803139:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80313a:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80313b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80313c:	74 20                	je     80315e <__rodata_start+0xd6>
+  80313e:	6c                   	insb   (%dx),%es:(%rdi)
+  80313f:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803140:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803141:	6b 20 75             	imul   $0x75,(%rax),%esp
+  803144:	70 20                	jo     803166 <__rodata_start+0xde>
+  803146:	70 5b                	jo     8031a3 <__rodata_start+0x11b>
+  803148:	30 5d 3a             	xor    %bl,0x3a(%rbp)
+  80314b:	20 25 69 00 72 61    	and    %ah,0x61720069(%rip)        # 61f231ba <__bss_end+0x6171b1ba>
+  803151:	63 65 20             	movsxd 0x20(%rbp),%esp
+  803154:	64 69 64 6e 27 74 20 	imul   $0x61682074,%fs:0x27(%rsi,%rbp,2),%esp
+  80315b:	68 61 
+  80315d:	70 70                	jo     8031cf <__rodata_start+0x147>
+  80315f:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803161:	0a 00                	or     (%rax),%al
+  803163:	3c 75                	cmp    $0x75,%al
+  803165:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803166:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  80316a:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80316b:	3e 00 0f             	ds add %cl,(%rdi)
+  80316e:	1f                   	(bad)
+  80316f:	00 5b 25             	add    %bl,0x25(%rbx)
+  803172:	30 38                	xor    %bh,(%rax)
+  803174:	78 5d                	js     8031d3 <__rodata_start+0x14b>
+  803176:	20 75 73             	and    %dh,0x73(%rbp)
+  803179:	65 72 20             	gs jb  80319c <__rodata_start+0x114>
+  80317c:	70 61                	jo     8031df <__rodata_start+0x157>
+  80317e:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80317f:	69 63 20 69 6e 20 25 	imul   $0x25206e69,0x20(%rbx),%esp
+  803186:	73 20                	jae    8031a8 <__rodata_start+0x120>
+  803188:	61                   	(bad)
+  803189:	74 20                	je     8031ab <__rodata_start+0x123>
+  80318b:	25 73 3a 25 64       	and    $0x64253a73,%eax
+  803190:	3a 20                	cmp    (%rax),%ah
+  803192:	00 30                	add    %dh,(%rax)
+  803194:	31 32                	xor    %esi,(%rdx)
+  803196:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  80319d:	41                   	rex.B
+  80319e:	42                   	rex.X
+  80319f:	43                   	rex.XB
+  8031a0:	44                   	rex.R
+  8031a1:	45                   	rex.RB
+  8031a2:	46 00 30             	rex.RX add %r14b,(%rax)
+  8031a5:	31 32                	xor    %esi,(%rdx)
+  8031a7:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  8031ae:	61                   	(bad)
+  8031af:	62 63 64 65 66       	(bad)
+  8031b4:	00 28                	add    %ch,(%rax)
+  8031b6:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8031b7:	75 6c                	jne    803225 <__rodata_start+0x19d>
+  8031b9:	6c                   	insb   (%dx),%es:(%rdi)
+  8031ba:	29 00                	sub    %eax,(%rax)
+  8031bc:	65 72 72             	gs jb  803231 <__rodata_start+0x1a9>
+  8031bf:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8031c0:	72 20                	jb     8031e2 <__rodata_start+0x15a>
+  8031c2:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  8031c7:	73 70                	jae    803239 <__rodata_start+0x1b1>
+  8031c9:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  8031cd:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  8031d4:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8031d5:	72 00                	jb     8031d7 <__rodata_start+0x14f>
+  8031d7:	62 61 64 20 65       	(bad)
+  8031dc:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8031dd:	76 69                	jbe    803248 <__rodata_start+0x1c0>
+  8031df:	72 6f                	jb     803250 <__rodata_start+0x1c8>
+  8031e1:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8031e2:	6d                   	insl   (%dx),%es:(%rdi)
+  8031e3:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  8031e5:	74 00                	je     8031e7 <__rodata_start+0x15f>
+  8031e7:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  8031ee:	20 70 61             	and    %dh,0x61(%rax)
+  8031f1:	72 61                	jb     803254 <__rodata_start+0x1cc>
+  8031f3:	6d                   	insl   (%dx),%es:(%rdi)
+  8031f4:	65 74 65             	gs je  80325c <__rodata_start+0x1d4>
+  8031f7:	72 00                	jb     8031f9 <__rodata_start+0x171>
+  8031f9:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8031fa:	75 74                	jne    803270 <__rodata_start+0x1e8>
+  8031fc:	20 6f 66             	and    %ch,0x66(%rdi)
+  8031ff:	20 6d 65             	and    %ch,0x65(%rbp)
+  803202:	6d                   	insl   (%dx),%es:(%rdi)
+  803203:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803204:	72 79                	jb     80327f <__rodata_start+0x1f7>
+  803206:	00 6f 75             	add    %ch,0x75(%rdi)
+  803209:	74 20                	je     80322b <__rodata_start+0x1a3>
+  80320b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80320c:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  803210:	76 69                	jbe    80327b <__rodata_start+0x1f3>
+  803212:	72 6f                	jb     803283 <__rodata_start+0x1fb>
+  803214:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803215:	6d                   	insl   (%dx),%es:(%rdi)
+  803216:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803218:	74 73                	je     80328d <__rodata_start+0x205>
+  80321a:	00 63 6f             	add    %ah,0x6f(%rbx)
+  80321d:	72 72                	jb     803291 <__rodata_start+0x209>
+  80321f:	75 70                	jne    803291 <__rodata_start+0x209>
+  803221:	74 65                	je     803288 <__rodata_start+0x200>
+  803223:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  803228:	75 67                	jne    803291 <__rodata_start+0x209>
+  80322a:	20 69 6e             	and    %ch,0x6e(%rcx)
+  80322d:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  80322f:	00 73 65             	add    %dh,0x65(%rbx)
+  803232:	67 6d                	insl   (%dx),%es:(%edi)
+  803234:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803236:	74 61                	je     803299 <__rodata_start+0x211>
+  803238:	74 69                	je     8032a3 <__rodata_start+0x21b>
+  80323a:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80323b:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80323c:	20 66 61             	and    %ah,0x61(%rsi)
+  80323f:	75 6c                	jne    8032ad <__rodata_start+0x225>
+  803241:	74 00                	je     803243 <__rodata_start+0x1bb>
+  803243:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  80324a:	20 45 4c             	and    %al,0x4c(%rbp)
+  80324d:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  803251:	61                   	(bad)
+  803252:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  803257:	20 73 75             	and    %dh,0x75(%rbx)
+  80325a:	63 68 20             	movsxd 0x20(%rax),%ebp
+  80325d:	73 79                	jae    8032d8 <__rodata_start+0x250>
+  80325f:	73 74                	jae    8032d5 <__rodata_start+0x24d>
+  803261:	65 6d                	gs insl (%dx),%es:(%rdi)
+  803263:	20 63 61             	and    %ah,0x61(%rbx)
+  803266:	6c                   	insb   (%dx),%es:(%rdi)
+  803267:	6c                   	insb   (%dx),%es:(%rdi)
+  803268:	00 65 6e             	add    %ah,0x6e(%rbp)
+  80326b:	74 72                	je     8032df <__rodata_start+0x257>
+  80326d:	79 20                	jns    80328f <__rodata_start+0x207>
+  80326f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803270:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803271:	74 20                	je     803293 <__rodata_start+0x20b>
+  803273:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  803275:	75 6e                	jne    8032e5 <__rodata_start+0x25d>
+  803277:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  80327b:	76 20                	jbe    80329d <__rodata_start+0x215>
+  80327d:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  803284:	72 65                	jb     8032eb <__rodata_start+0x263>
+  803286:	63 76 69             	movsxd 0x69(%rsi),%esi
+  803289:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80328a:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  80328e:	65 78 70             	gs js  803301 <__rodata_start+0x279>
+  803291:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  803296:	20 65 6e             	and    %ah,0x6e(%rbp)
+  803299:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  80329d:	20 66 69             	and    %ah,0x69(%rsi)
+  8032a0:	6c                   	insb   (%dx),%es:(%rdi)
+  8032a1:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  8032a5:	20 66 72             	and    %ah,0x72(%rsi)
+  8032a8:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  8032ad:	61                   	(bad)
+  8032ae:	63 65 20             	movsxd 0x20(%rbp),%esp
+  8032b1:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8032b2:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8032b3:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  8032b7:	6b 00 74             	imul   $0x74,(%rax),%eax
+  8032ba:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8032bb:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8032bc:	20 6d 61             	and    %ch,0x61(%rbp)
+  8032bf:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8032c0:	79 20                	jns    8032e2 <__rodata_start+0x25a>
+  8032c2:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  8032c9:	72 65                	jb     803330 <__rodata_start+0x2a8>
+  8032cb:	20 6f 70             	and    %ch,0x70(%rdi)
+  8032ce:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  8032d0:	00 66 69             	add    %ah,0x69(%rsi)
+  8032d3:	6c                   	insb   (%dx),%es:(%rdi)
+  8032d4:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  8032d8:	20 62 6c             	and    %ah,0x6c(%rdx)
+  8032db:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8032dc:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  8032df:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8032e0:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8032e1:	74 20                	je     803303 <__rodata_start+0x27b>
+  8032e3:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  8032e5:	75 6e                	jne    803355 <__rodata_start+0x2cd>
+  8032e7:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  8032eb:	76 61                	jbe    80334e <__rodata_start+0x2c6>
+  8032ed:	6c                   	insb   (%dx),%es:(%rdi)
+  8032ee:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  8032f5:	00 
+  8032f6:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  8032fd:	72 65                	jb     803364 <__rodata_start+0x2dc>
+  8032ff:	61                   	(bad)
+  803300:	64 79 20             	fs jns 803323 <__rodata_start+0x29b>
+  803303:	65 78 69             	gs js  80336f <__rodata_start+0x2e7>
+  803306:	73 74                	jae    80337c <__rodata_start+0x2f4>
+  803308:	73 00                	jae    80330a <__rodata_start+0x282>
+  80330a:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80330b:	70 65                	jo     803372 <__rodata_start+0x2ea>
+  80330d:	72 61                	jb     803370 <__rodata_start+0x2e8>
+  80330f:	74 69                	je     80337a <__rodata_start+0x2f2>
+  803311:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803312:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803313:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  803316:	74 20                	je     803338 <__rodata_start+0x2b0>
+  803318:	73 75                	jae    80338f <__rodata_start+0x307>
+  80331a:	70 70                	jo     80338c <__rodata_start+0x304>
+  80331c:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80331d:	72 74                	jb     803393 <__rodata_start+0x30b>
+  80331f:	65 64 00 6f 70       	gs add %ch,%fs:0x70(%rdi)
+  803324:	65 72 61             	gs jb  803388 <__rodata_start+0x300>
+  803327:	74 69                	je     803392 <__rodata_start+0x30a>
+  803329:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80332a:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80332b:	20 69 6e             	and    %ch,0x6e(%rcx)
+  80332e:	74 65                	je     803395 <__rodata_start+0x30d>
+  803330:	72 72                	jb     8033a4 <__rodata_start+0x31c>
+  803332:	75 70                	jne    8033a4 <__rodata_start+0x31c>
+  803334:	74 65                	je     80339b <__rodata_start+0x313>
+  803336:	64 00 6e 6f          	add    %ch,%fs:0x6f(%rsi)
+  80333a:	74 20                	je     80335c <__rodata_start+0x2d4>
+  80333c:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  80333e:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80333f:	75 67                	jne    8033a8 <__rodata_start+0x320>
+  803341:	68 20 43 50 55       	push   $0x55504320
+  803346:	20 74 69 6d          	and    %dh,0x6d(%rcx,%rbp,2)
+  80334a:	65 00 66 2e          	add    %ah,%gs:0x2e(%rsi)
+  80334e:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+  803355:	00 
+  803356:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80335d:	00 00 00 
+  803360:	e1 06                	loope  803368 <__rodata_start+0x2e0>
+  803362:	80 00 00             	addb   $0x0,(%rax)
+  803365:	00 00                	add    %al,(%rax)
+  803367:	00 22                	add    %ah,(%rdx)
+  803369:	0d 80 00 00 00       	or     $0x80,%eax
+  80336e:	00 00                	add    %al,(%rax)
+  803370:	12 0d 80 00 00 00    	adc    0x80(%rip),%cl        # 8033f6 <__rodata_start+0x36e>
+  803376:	00 00                	add    %al,(%rax)
+  803378:	22 0d 80 00 00 00    	and    0x80(%rip),%cl        # 8033fe <__rodata_start+0x376>
+  80337e:	00 00                	add    %al,(%rax)
+  803380:	22 0d 80 00 00 00    	and    0x80(%rip),%cl        # 803406 <__rodata_start+0x37e>
+  803386:	00 00                	add    %al,(%rax)
+  803388:	22 0d 80 00 00 00    	and    0x80(%rip),%cl        # 80340e <__rodata_start+0x386>
+  80338e:	00 00                	add    %al,(%rax)
+  803390:	22 0d 80 00 00 00    	and    0x80(%rip),%cl        # 803416 <__rodata_start+0x38e>
+  803396:	00 00                	add    %al,(%rax)
+  803398:	00 07                	add    %al,(%rdi)
+  80339a:	80 00 00             	addb   $0x0,(%rax)
+  80339d:	00 00                	add    %al,(%rax)
+  80339f:	00 22                	add    %ah,(%rdx)
+  8033a1:	0d 80 00 00 00       	or     $0x80,%eax
+  8033a6:	00 00                	add    %al,(%rax)
+  8033a8:	22 0d 80 00 00 00    	and    0x80(%rip),%cl        # 80342e <__rodata_start+0x3a6>
+  8033ae:	00 00                	add    %al,(%rax)
+  8033b0:	f4                   	hlt
+  8033b1:	06                   	(bad)
+  8033b2:	80 00 00             	addb   $0x0,(%rax)
+  8033b5:	00 00                	add    %al,(%rax)
+  8033b7:	00 6e 07             	add    %ch,0x7(%rsi)
+  8033ba:	80 00 00             	addb   $0x0,(%rax)
+  8033bd:	00 00                	add    %al,(%rax)
+  8033bf:	00 22                	add    %ah,(%rdx)
+  8033c1:	0d 80 00 00 00       	or     $0x80,%eax
+  8033c6:	00 00                	add    %al,(%rax)
+  8033c8:	f4                   	hlt
+  8033c9:	06                   	(bad)
+  8033ca:	80 00 00             	addb   $0x0,(%rax)
+  8033cd:	00 00                	add    %al,(%rax)
+  8033cf:	00 3a                	add    %bh,(%rdx)
+  8033d1:	07                   	(bad)
+  8033d2:	80 00 00             	addb   $0x0,(%rax)
+  8033d5:	00 00                	add    %al,(%rax)
+  8033d7:	00 3a                	add    %bh,(%rdx)
+  8033d9:	07                   	(bad)
+  8033da:	80 00 00             	addb   $0x0,(%rax)
+  8033dd:	00 00                	add    %al,(%rax)
+  8033df:	00 3a                	add    %bh,(%rdx)
+  8033e1:	07                   	(bad)
+  8033e2:	80 00 00             	addb   $0x0,(%rax)
+  8033e5:	00 00                	add    %al,(%rax)
+  8033e7:	00 3a                	add    %bh,(%rdx)
+  8033e9:	07                   	(bad)
+  8033ea:	80 00 00             	addb   $0x0,(%rax)
+  8033ed:	00 00                	add    %al,(%rax)
+  8033ef:	00 3a                	add    %bh,(%rdx)
+  8033f1:	07                   	(bad)
+  8033f2:	80 00 00             	addb   $0x0,(%rax)
+  8033f5:	00 00                	add    %al,(%rax)
+  8033f7:	00 3a                	add    %bh,(%rdx)
+  8033f9:	07                   	(bad)
+  8033fa:	80 00 00             	addb   $0x0,(%rax)
+  8033fd:	00 00                	add    %al,(%rax)
+  8033ff:	00 3a                	add    %bh,(%rdx)
+  803401:	07                   	(bad)
+  803402:	80 00 00             	addb   $0x0,(%rax)
+  803405:	00 00                	add    %al,(%rax)
+  803407:	00 3a                	add    %bh,(%rdx)
+  803409:	07                   	(bad)
+  80340a:	80 00 00             	addb   $0x0,(%rax)
+  80340d:	00 00                	add    %al,(%rax)
+  80340f:	00 3a                	add    %bh,(%rdx)
+  803411:	07                   	(bad)
+  803412:	80 00 00             	addb   $0x0,(%rax)
+  803415:	00 00                	add    %al,(%rax)
+  803417:	00 22                	add    %ah,(%rdx)
+  803419:	0d 80 00 00 00       	or     $0x80,%eax
+  80341e:	00 00                	add    %al,(%rax)
+  803420:	22 0d 80 00 00 00    	and    0x80(%rip),%cl        # 8034a6 <__rodata_start+0x41e>
+  803426:	00 00                	add    %al,(%rax)
+  803428:	22 0d 80 00 00 00    	and    0x80(%rip),%cl        # 8034ae <__rodata_start+0x426>
+  80342e:	00 00                	add    %al,(%rax)
+  803430:	22 0d 80 00 00 00    	and    0x80(%rip),%cl        # 8034b6 <__rodata_start+0x42e>
+  803436:	00 00                	add    %al,(%rax)
+  803438:	22 0d 80 00 00 00    	and    0x80(%rip),%cl        # 8034be <__rodata_start+0x436>
+  80343e:	00 00                	add    %al,(%rax)
+  803440:	22 0d 80 00 00 00    	and    0x80(%rip),%cl        # 8034c6 <__rodata_start+0x43e>
+  803446:	00 00                	add    %al,(%rax)
+  803448:	22 0d 80 00 00 00    	and    0x80(%rip),%cl        # 8034ce <__rodata_start+0x446>
+  80344e:	00 00                	add    %al,(%rax)
+  803450:	22 0d 80 00 00 00    	and    0x80(%rip),%cl        # 8034d6 <__rodata_start+0x44e>
+  803456:	00 00                	add    %al,(%rax)
+  803458:	22 0d 80 00 00 00    	and    0x80(%rip),%cl        # 8034de <__rodata_start+0x456>
+  80345e:	00 00                	add    %al,(%rax)
+  803460:	22 0d 80 00 00 00    	and    0x80(%rip),%cl        # 8034e6 <__rodata_start+0x45e>
+  803466:	00 00                	add    %al,(%rax)
+  803468:	22 0d 80 00 00 00    	and    0x80(%rip),%cl        # 8034ee <__rodata_start+0x466>
+  80346e:	00 00                	add    %al,(%rax)
+  803470:	22 0d 80 00 00 00    	and    0x80(%rip),%cl        # 8034f6 <__rodata_start+0x46e>
+  803476:	00 00                	add    %al,(%rax)
+  803478:	22 0d 80 00 00 00    	and    0x80(%rip),%cl        # 8034fe <__rodata_start+0x476>
+  80347e:	00 00                	add    %al,(%rax)
+  803480:	22 0d 80 00 00 00    	and    0x80(%rip),%cl        # 803506 <__rodata_start+0x47e>
+  803486:	00 00                	add    %al,(%rax)
+  803488:	22 0d 80 00 00 00    	and    0x80(%rip),%cl        # 80350e <__rodata_start+0x486>
+  80348e:	00 00                	add    %al,(%rax)
+  803490:	22 0d 80 00 00 00    	and    0x80(%rip),%cl        # 803516 <__rodata_start+0x48e>
+  803496:	00 00                	add    %al,(%rax)
+  803498:	22 0d 80 00 00 00    	and    0x80(%rip),%cl        # 80351e <__rodata_start+0x496>
+  80349e:	00 00                	add    %al,(%rax)
+  8034a0:	22 0d 80 00 00 00    	and    0x80(%rip),%cl        # 803526 <__rodata_start+0x49e>
+  8034a6:	00 00                	add    %al,(%rax)
+  8034a8:	22 0d 80 00 00 00    	and    0x80(%rip),%cl        # 80352e <__rodata_start+0x4a6>
+  8034ae:	00 00                	add    %al,(%rax)
+  8034b0:	22 0d 80 00 00 00    	and    0x80(%rip),%cl        # 803536 <__rodata_start+0x4ae>
+  8034b6:	00 00                	add    %al,(%rax)
+  8034b8:	22 0d 80 00 00 00    	and    0x80(%rip),%cl        # 80353e <__rodata_start+0x4b6>
+  8034be:	00 00                	add    %al,(%rax)
+  8034c0:	22 0d 80 00 00 00    	and    0x80(%rip),%cl        # 803546 <__rodata_start+0x4be>
+  8034c6:	00 00                	add    %al,(%rax)
+  8034c8:	22 0d 80 00 00 00    	and    0x80(%rip),%cl        # 80354e <__rodata_start+0x4c6>
+  8034ce:	00 00                	add    %al,(%rax)
+  8034d0:	22 0d 80 00 00 00    	and    0x80(%rip),%cl        # 803556 <__rodata_start+0x4ce>
+  8034d6:	00 00                	add    %al,(%rax)
+  8034d8:	22 0d 80 00 00 00    	and    0x80(%rip),%cl        # 80355e <__rodata_start+0x4d6>
+  8034de:	00 00                	add    %al,(%rax)
+  8034e0:	22 0d 80 00 00 00    	and    0x80(%rip),%cl        # 803566 <__rodata_start+0x4de>
+  8034e6:	00 00                	add    %al,(%rax)
+  8034e8:	22 0d 80 00 00 00    	and    0x80(%rip),%cl        # 80356e <__rodata_start+0x4e6>
+  8034ee:	00 00                	add    %al,(%rax)
+  8034f0:	22 0d 80 00 00 00    	and    0x80(%rip),%cl        # 803576 <__rodata_start+0x4ee>
+  8034f6:	00 00                	add    %al,(%rax)
+  8034f8:	22 0d 80 00 00 00    	and    0x80(%rip),%cl        # 80357e <__rodata_start+0x4f6>
+  8034fe:	00 00                	add    %al,(%rax)
+  803500:	22 0d 80 00 00 00    	and    0x80(%rip),%cl        # 803586 <__rodata_start+0x4fe>
+  803506:	00 00                	add    %al,(%rax)
+  803508:	45 0c 80             	rex.RB or $0x80,%al
+  80350b:	00 00                	add    %al,(%rax)
+  80350d:	00 00                	add    %al,(%rax)
+  80350f:	00 22                	add    %ah,(%rdx)
+  803511:	0d 80 00 00 00       	or     $0x80,%eax
+  803516:	00 00                	add    %al,(%rax)
+  803518:	22 0d 80 00 00 00    	and    0x80(%rip),%cl        # 80359e <__rodata_start+0x516>
+  80351e:	00 00                	add    %al,(%rax)
+  803520:	22 0d 80 00 00 00    	and    0x80(%rip),%cl        # 8035a6 <__rodata_start+0x51e>
+  803526:	00 00                	add    %al,(%rax)
+  803528:	22 0d 80 00 00 00    	and    0x80(%rip),%cl        # 8035ae <__rodata_start+0x526>
+  80352e:	00 00                	add    %al,(%rax)
+  803530:	22 0d 80 00 00 00    	and    0x80(%rip),%cl        # 8035b6 <__rodata_start+0x52e>
+  803536:	00 00                	add    %al,(%rax)
+  803538:	22 0d 80 00 00 00    	and    0x80(%rip),%cl        # 8035be <__rodata_start+0x536>
+  80353e:	00 00                	add    %al,(%rax)
+  803540:	22 0d 80 00 00 00    	and    0x80(%rip),%cl        # 8035c6 <__rodata_start+0x53e>
+  803546:	00 00                	add    %al,(%rax)
+  803548:	22 0d 80 00 00 00    	and    0x80(%rip),%cl        # 8035ce <__rodata_start+0x546>
+  80354e:	00 00                	add    %al,(%rax)
+  803550:	22 0d 80 00 00 00    	and    0x80(%rip),%cl        # 8035d6 <__rodata_start+0x54e>
+  803556:	00 00                	add    %al,(%rax)
+  803558:	22 0d 80 00 00 00    	and    0x80(%rip),%cl        # 8035de <__rodata_start+0x556>
+  80355e:	00 00                	add    %al,(%rax)
+  803560:	91                   	xchg   %eax,%ecx
+  803561:	07                   	(bad)
+  803562:	80 00 00             	addb   $0x0,(%rax)
+  803565:	00 00                	add    %al,(%rax)
+  803567:	00 60 09             	add    %ah,0x9(%rax)
+  80356a:	80 00 00             	addb   $0x0,(%rax)
+  80356d:	00 00                	add    %al,(%rax)
+  80356f:	00 22                	add    %ah,(%rdx)
+  803571:	0d 80 00 00 00       	or     $0x80,%eax
+  803576:	00 00                	add    %al,(%rax)
+  803578:	22 0d 80 00 00 00    	and    0x80(%rip),%cl        # 8035fe <__rodata_start+0x576>
+  80357e:	00 00                	add    %al,(%rax)
+  803580:	22 0d 80 00 00 00    	and    0x80(%rip),%cl        # 803606 <__rodata_start+0x57e>
+  803586:	00 00                	add    %al,(%rax)
+  803588:	22 0d 80 00 00 00    	and    0x80(%rip),%cl        # 80360e <__rodata_start+0x586>
+  80358e:	00 00                	add    %al,(%rax)
+  803590:	c0 07 80             	rolb   $0x80,(%rdi)
+  803593:	00 00                	add    %al,(%rax)
+  803595:	00 00                	add    %al,(%rax)
+  803597:	00 22                	add    %ah,(%rdx)
+  803599:	0d 80 00 00 00       	or     $0x80,%eax
+  80359e:	00 00                	add    %al,(%rax)
+  8035a0:	22 0d 80 00 00 00    	and    0x80(%rip),%cl        # 803626 <error_string+0x6>
+  8035a6:	00 00                	add    %al,(%rax)
+  8035a8:	86 07                	xchg   %al,(%rdi)
+  8035aa:	80 00 00             	addb   $0x0,(%rax)
+  8035ad:	00 00                	add    %al,(%rax)
+  8035af:	00 22                	add    %ah,(%rdx)
+  8035b1:	0d 80 00 00 00       	or     $0x80,%eax
+  8035b6:	00 00                	add    %al,(%rax)
+  8035b8:	22 0d 80 00 00 00    	and    0x80(%rip),%cl        # 80363e <error_string+0x1e>
+  8035be:	00 00                	add    %al,(%rax)
+  8035c0:	08 0b                	or     %cl,(%rbx)
+  8035c2:	80 00 00             	addb   $0x0,(%rax)
+  8035c5:	00 00                	add    %al,(%rax)
+  8035c7:	00 d2                	add    %dl,%dl
+  8035c9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  8035cf:	00 22                	add    %ah,(%rdx)
+  8035d1:	0d 80 00 00 00       	or     $0x80,%eax
+  8035d6:	00 00                	add    %al,(%rax)
+  8035d8:	22 0d 80 00 00 00    	and    0x80(%rip),%cl        # 80365e <error_string+0x3e>
+  8035de:	00 00                	add    %al,(%rax)
+  8035e0:	57                   	push   %rdi
+  8035e1:	08 80 00 00 00 00    	or     %al,0x0(%rax)
+  8035e7:	00 22                	add    %ah,(%rdx)
+  8035e9:	0d 80 00 00 00       	or     $0x80,%eax
+  8035ee:	00 00                	add    %al,(%rax)
+  8035f0:	34 0a                	xor    $0xa,%al
+  8035f2:	80 00 00             	addb   $0x0,(%rax)
+  8035f5:	00 00                	add    %al,(%rax)
+  8035f7:	00 22                	add    %ah,(%rdx)
+  8035f9:	0d 80 00 00 00       	or     $0x80,%eax
+  8035fe:	00 00                	add    %al,(%rax)
+  803600:	22 0d 80 00 00 00    	and    0x80(%rip),%cl        # 803686 <error_string+0x66>
+  803606:	00 00                	add    %al,(%rax)
+  803608:	45 0c 80             	rex.RB or $0x80,%al
+  80360b:	00 00                	add    %al,(%rax)
+  80360d:	00 00                	add    %al,(%rax)
+  80360f:	00 22                	add    %ah,(%rdx)
+  803611:	0d 80 00 00 00       	or     $0x80,%eax
+  803616:	00 00                	add    %al,(%rax)
+  803618:	ea                   	(bad)
+  803619:	06                   	(bad)
+  80361a:	80 00 00             	addb   $0x0,(%rax)
+  80361d:	00 00                	add    %al,(%rax)
+	...
+
+0000000000803620 <error_string>:
+	...
+  803628:	c5 31 80 00 00 00 00 00 d7 31 80 00 00 00 00 00     .1.......1......
+  803638:	e7 31 80 00 00 00 00 00 f9 31 80 00 00 00 00 00     .1.......1......
+  803648:	07 32 80 00 00 00 00 00 1b 32 80 00 00 00 00 00     .2.......2......
+  803658:	30 32 80 00 00 00 00 00 43 32 80 00 00 00 00 00     02......C2......
+  803668:	55 32 80 00 00 00 00 00 69 32 80 00 00 00 00 00     U2......i2......
+  803678:	79 32 80 00 00 00 00 00 8c 32 80 00 00 00 00 00     y2.......2......
+  803688:	a3 32 80 00 00 00 00 00 b9 32 80 00 00 00 00 00     .2.......2......
+  803698:	d1 32 80 00 00 00 00 00 e9 32 80 00 00 00 00 00     .2.......2......
+  8036a8:	f6 32 80 00 00 00 00 00 d0 36 80 00 00 00 00 00     .2.......6......
+  8036b8:	0a 33 80 00 00 00 00 00 22 33 80 00 00 00 00 00     .3......"3......
+  8036c8:	38 33 80 00 00 00 00 00 66 69 6c 65 20 69 73 20     83......file is 
+  8036d8:	6e 6f 74 20 61 20 76 61 6c 69 64 20 65 78 65 63     not a valid exec
+  8036e8:	75 74 61 62 6c 65 00 90 73 79 73 63 61 6c 6c 20     utable..syscall 
+  8036f8:	25 7a 64 20 72 65 74 75 72 6e 65 64 20 25 7a 64     %zd returned %zd
+  803708:	20 28 3e 20 30 29 00 6c 69 62 2f 73 79 73 63 61      (> 0).lib/sysca
+  803718:	6c 6c 2e 63 00 46 6f 72 6b 20 64 6f 75 62 6c 65     ll.c.Fork double
+  803728:	20 66 61 75 6c 74 00 6c 69 62 2f 66 6f 72 6b 2e      fault.lib/fork.
+  803738:	63 00 73 66 6f 72 6b 28 29 20 69 73 20 6e 6f 74     c.sfork() is not
+  803748:	20 69 6d 70 6c 65 6d 65 6e 74 65 64 00 0f 1f 00      implemented....
+  803758:	5b 25 30 38 78 5d 20 75 6e 6b 6e 6f 77 6e 20 64     [%08x] unknown d
+  803768:	65 76 69 63 65 20 74 79 70 65 20 25 64 0a 00 00     evice type %d...
+  803778:	5b 25 30 38 78 5d 20 66 74 72 75 6e 63 61 74 65     [%08x] ftruncate
+  803788:	20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65 0a      %d -- bad mode.
+  803798:	00 5b 25 30 38 78 5d 20 72 65 61 64 20 25 64 20     .[%08x] read %d 
+  8037a8:	2d 2d 20 62 61 64 20 6d 6f 64 65 0a 00 5b 25 30     -- bad mode..[%0
+  8037b8:	38 78 5d 20 77 72 69 74 65 20 25 64 20 2d 2d 20     8x] write %d -- 
+  8037c8:	62 61 64 20 6d 6f 64 65 0a 00 66 2e 0f 1f 84 00     bad mode..f.....
+  8037d8:	00 00 00 00 0f 1f 40 00                             ......@.
+
+00000000008037e0 <devtab>:
+  8037e0:	20 40 80 00 00 00 00 00 60 40 80 00 00 00 00 00      @......`@......
+  8037f0:	a0 40 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .@..............
+  803800:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  803810:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  803820:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  803830:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  803840:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  803850:	3d 20 32 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73 00     = 2.<cons>.cons.
+  803860:	73 79 73 5f 69 70 63 5f 74 72 79 5f 73 65 6e 64     sys_ipc_try_send
+  803870:	20 66 61 69 6c 65 64 3a 20 25 69 00 6c 69 62 2f      failed: %i.lib/
+  803880:	69 70 63 2e 63 00 66 2e 0f 1f 84 00 00 00 00 00     ipc.c.f.........
+  803890:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8038a0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8038b0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8038c0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8038d0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8038e0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8038f0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803900:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803910:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803920:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803930:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803940:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803950:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803960:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803970:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803980:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803990:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8039a0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8039b0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8039c0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8039d0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8039e0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8039f0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803a00:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803a10:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803a20:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803a30:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803a40:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803a50:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803a60:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803a70:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803a80:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803a90:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803aa0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803ab0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803ac0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803ad0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803ae0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803af0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803b00:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803b10:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803b20:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803b30:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803b40:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803b50:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803b60:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803b70:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803b80:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803b90:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803ba0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803bb0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803bc0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803bd0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803be0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803bf0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803c00:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803c10:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803c20:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803c30:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803c40:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803c50:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803c60:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803c70:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803c80:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803c90:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803ca0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803cb0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803cc0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803cd0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803ce0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803cf0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803d00:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803d10:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803d20:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803d30:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803d40:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803d50:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803d60:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803d70:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803d80:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803d90:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803da0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803db0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803dc0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803dd0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803de0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803df0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803e00:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803e10:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803e20:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803e30:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803e40:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803e50:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803e60:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803e70:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803e80:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803e90:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803ea0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803eb0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803ec0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803ed0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803ee0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803ef0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803f00:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803f10:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803f20:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803f30:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803f40:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803f50:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803f60:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803f70:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803f80:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803f90:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803fa0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803fb0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803fc0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803fd0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803fe0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803ff0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 0f 1f 40 00     ..f...........@.
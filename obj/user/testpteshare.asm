@@ -0,0 +1,7122 @@
+
+obj/user/testpteshare:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 54 02 00 00       	call   800277 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <childofspawn>:
+
+    breakpoint();
+}
+
+void
+childofspawn(void) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+    strcpy(VA, msg2);
+  800029:	48 b8 00 50 80 00 00 	movabs $0x805000,%rax
+  800030:	00 00 00 
+  800033:	48 8b 30             	mov    (%rax),%rsi
+  800036:	bf 00 00 00 0a       	mov    $0xa000000,%edi
+  80003b:	48 b8 b8 0d 80 00 00 	movabs $0x800db8,%rax
+  800042:	00 00 00 
+  800045:	ff d0                	call   *%rax
+    exit();
+  800047:	48 b8 20 03 80 00 00 	movabs $0x800320,%rax
+  80004e:	00 00 00 
+  800051:	ff d0                	call   *%rax
+}
+  800053:	5d                   	pop    %rbp
+  800054:	c3                   	ret
+
+0000000000800055 <umain>:
+umain(int argc, char **argv) {
+  800055:	55                   	push   %rbp
+  800056:	48 89 e5             	mov    %rsp,%rbp
+  800059:	53                   	push   %rbx
+  80005a:	48 83 ec 08          	sub    $0x8,%rsp
+    if (argc != 0)
+  80005e:	85 ff                	test   %edi,%edi
+  800060:	0f 85 4a 01 00 00    	jne    8001b0 <umain+0x15b>
+    if ((r = sys_alloc_region(0, VA, PAGE_SIZE, PROT_SHARE | PROT_RW)) < 0)
+  800066:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80006b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800070:	be 00 00 00 0a       	mov    $0xa000000,%esi
+  800075:	bf 00 00 00 00       	mov    $0x0,%edi
+  80007a:	48 b8 68 13 80 00 00 	movabs $0x801368,%rax
+  800081:	00 00 00 
+  800084:	ff d0                	call   *%rax
+  800086:	85 c0                	test   %eax,%eax
+  800088:	0f 88 33 01 00 00    	js     8001c1 <umain+0x16c>
+    if ((r = fork()) < 0)
+  80008e:	48 b8 a3 17 80 00 00 	movabs $0x8017a3,%rax
+  800095:	00 00 00 
+  800098:	ff d0                	call   *%rax
+  80009a:	89 c3                	mov    %eax,%ebx
+  80009c:	85 c0                	test   %eax,%eax
+  80009e:	0f 88 4a 01 00 00    	js     8001ee <umain+0x199>
+    if (r == 0) {
+  8000a4:	0f 84 71 01 00 00    	je     80021b <umain+0x1c6>
+    wait(r);
+  8000aa:	89 df                	mov    %ebx,%edi
+  8000ac:	48 b8 9a 33 80 00 00 	movabs $0x80339a,%rax
+  8000b3:	00 00 00 
+  8000b6:	ff d0                	call   *%rax
+    cprintf("fork handles PTE_SHARE %s\n", strcmp(VA, msg) == 0 ? "right" : "wrong");
+  8000b8:	48 b8 08 50 80 00 00 	movabs $0x805008,%rax
+  8000bf:	00 00 00 
+  8000c2:	48 8b 30             	mov    (%rax),%rsi
+  8000c5:	bf 00 00 00 0a       	mov    $0xa000000,%edi
+  8000ca:	48 b8 5c 0e 80 00 00 	movabs $0x800e5c,%rax
+  8000d1:	00 00 00 
+  8000d4:	ff d0                	call   *%rax
+  8000d6:	85 c0                	test   %eax,%eax
+  8000d8:	48 be f6 3a 80 00 00 	movabs $0x803af6,%rsi
+  8000df:	00 00 00 
+  8000e2:	48 b8 f0 3a 80 00 00 	movabs $0x803af0,%rax
+  8000e9:	00 00 00 
+  8000ec:	48 0f 44 f0          	cmove  %rax,%rsi
+  8000f0:	48 bf 2c 3b 80 00 00 	movabs $0x803b2c,%rdi
+  8000f7:	00 00 00 
+  8000fa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000ff:	48 ba 93 04 80 00 00 	movabs $0x800493,%rdx
+  800106:	00 00 00 
+  800109:	ff d2                	call   *%rdx
+    if ((r = spawnl("/testpteshare", "testpteshare", "arg", 0)) < 0)
+  80010b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800110:	48 ba 47 3b 80 00 00 	movabs $0x803b47,%rdx
+  800117:	00 00 00 
+  80011a:	48 be 4c 3b 80 00 00 	movabs $0x803b4c,%rsi
+  800121:	00 00 00 
+  800124:	48 bf 4b 3b 80 00 00 	movabs $0x803b4b,%rdi
+  80012b:	00 00 00 
+  80012e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800133:	49 b8 a9 2d 80 00 00 	movabs $0x802da9,%r8
+  80013a:	00 00 00 
+  80013d:	41 ff d0             	call   *%r8
+  800140:	89 c7                	mov    %eax,%edi
+  800142:	85 c0                	test   %eax,%eax
+  800144:	0f 88 00 01 00 00    	js     80024a <umain+0x1f5>
+    wait(r);
+  80014a:	48 b8 9a 33 80 00 00 	movabs $0x80339a,%rax
+  800151:	00 00 00 
+  800154:	ff d0                	call   *%rax
+    cprintf("spawn handles PTE_SHARE %s\n", strcmp(VA, msg2) == 0 ? "right" : "wrong");
+  800156:	48 b8 00 50 80 00 00 	movabs $0x805000,%rax
+  80015d:	00 00 00 
+  800160:	48 8b 30             	mov    (%rax),%rsi
+  800163:	bf 00 00 00 0a       	mov    $0xa000000,%edi
+  800168:	48 b8 5c 0e 80 00 00 	movabs $0x800e5c,%rax
+  80016f:	00 00 00 
+  800172:	ff d0                	call   *%rax
+  800174:	85 c0                	test   %eax,%eax
+  800176:	48 be f6 3a 80 00 00 	movabs $0x803af6,%rsi
+  80017d:	00 00 00 
+  800180:	48 b8 f0 3a 80 00 00 	movabs $0x803af0,%rax
+  800187:	00 00 00 
+  80018a:	48 0f 44 f0          	cmove  %rax,%rsi
+  80018e:	48 bf 63 3b 80 00 00 	movabs $0x803b63,%rdi
+  800195:	00 00 00 
+  800198:	b8 00 00 00 00       	mov    $0x0,%eax
+  80019d:	48 ba 93 04 80 00 00 	movabs $0x800493,%rdx
+  8001a4:	00 00 00 
+  8001a7:	ff d2                	call   *%rdx
+
+#include <inc/types.h>
+
+static inline void __attribute__((always_inline))
+breakpoint(void) {
+    asm volatile("int3");
+  8001a9:	cc                   	int3
+}
+  8001aa:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8001ae:	c9                   	leave
+  8001af:	c3                   	ret
+        childofspawn();
+  8001b0:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8001b7:	00 00 00 
+  8001ba:	ff d0                	call   *%rax
+  8001bc:	e9 a5 fe ff ff       	jmp    800066 <umain+0x11>
+        panic("sys_page_alloc: %i", r);
+  8001c1:	89 c1                	mov    %eax,%ecx
+  8001c3:	48 ba fc 3a 80 00 00 	movabs $0x803afc,%rdx
+  8001ca:	00 00 00 
+  8001cd:	be 12 00 00 00       	mov    $0x12,%esi
+  8001d2:	48 bf 0f 3b 80 00 00 	movabs $0x803b0f,%rdi
+  8001d9:	00 00 00 
+  8001dc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001e1:	49 b8 43 03 80 00 00 	movabs $0x800343,%r8
+  8001e8:	00 00 00 
+  8001eb:	41 ff d0             	call   *%r8
+        panic("fork: %i", r);
+  8001ee:	89 c1                	mov    %eax,%ecx
+  8001f0:	48 ba 23 3b 80 00 00 	movabs $0x803b23,%rdx
+  8001f7:	00 00 00 
+  8001fa:	be 16 00 00 00       	mov    $0x16,%esi
+  8001ff:	48 bf 0f 3b 80 00 00 	movabs $0x803b0f,%rdi
+  800206:	00 00 00 
+  800209:	b8 00 00 00 00       	mov    $0x0,%eax
+  80020e:	49 b8 43 03 80 00 00 	movabs $0x800343,%r8
+  800215:	00 00 00 
+  800218:	41 ff d0             	call   *%r8
+        strcpy(VA, msg);
+  80021b:	48 b8 08 50 80 00 00 	movabs $0x805008,%rax
+  800222:	00 00 00 
+  800225:	48 8b 30             	mov    (%rax),%rsi
+  800228:	bf 00 00 00 0a       	mov    $0xa000000,%edi
+  80022d:	48 b8 b8 0d 80 00 00 	movabs $0x800db8,%rax
+  800234:	00 00 00 
+  800237:	ff d0                	call   *%rax
+        exit();
+  800239:	48 b8 20 03 80 00 00 	movabs $0x800320,%rax
+  800240:	00 00 00 
+  800243:	ff d0                	call   *%rax
+  800245:	e9 60 fe ff ff       	jmp    8000aa <umain+0x55>
+        panic("spawn: %i", r);
+  80024a:	89 c1                	mov    %eax,%ecx
+  80024c:	48 ba 59 3b 80 00 00 	movabs $0x803b59,%rdx
+  800253:	00 00 00 
+  800256:	be 20 00 00 00       	mov    $0x20,%esi
+  80025b:	48 bf 0f 3b 80 00 00 	movabs $0x803b0f,%rdi
+  800262:	00 00 00 
+  800265:	b8 00 00 00 00       	mov    $0x0,%eax
+  80026a:	49 b8 43 03 80 00 00 	movabs $0x800343,%r8
+  800271:	00 00 00 
+  800274:	41 ff d0             	call   *%r8
+
+0000000000800277 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800277:	55                   	push   %rbp
+  800278:	48 89 e5             	mov    %rsp,%rbp
+  80027b:	41 56                	push   %r14
+  80027d:	41 55                	push   %r13
+  80027f:	41 54                	push   %r12
+  800281:	53                   	push   %rbx
+  800282:	41 89 fd             	mov    %edi,%r13d
+  800285:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800288:	48 ba d8 50 80 00 00 	movabs $0x8050d8,%rdx
+  80028f:	00 00 00 
+  800292:	48 b8 d8 50 80 00 00 	movabs $0x8050d8,%rax
+  800299:	00 00 00 
+  80029c:	48 39 c2             	cmp    %rax,%rdx
+  80029f:	73 17                	jae    8002b8 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  8002a1:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  8002a4:	49 89 c4             	mov    %rax,%r12
+  8002a7:	48 83 c3 08          	add    $0x8,%rbx
+  8002ab:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002b0:	ff 53 f8             	call   *-0x8(%rbx)
+  8002b3:	4c 39 e3             	cmp    %r12,%rbx
+  8002b6:	72 ef                	jb     8002a7 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+    envid_t this_env_id = sys_getenvid();
+  8002b8:	48 b8 a8 12 80 00 00 	movabs $0x8012a8,%rax
+  8002bf:	00 00 00 
+  8002c2:	ff d0                	call   *%rax
+    thisenv = &((struct Env*)UENVS)[ENVX(this_env_id)];
+  8002c4:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8002c9:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+  8002d0:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8002d7:	00 00 00 
+  8002da:	48 01 d0             	add    %rdx,%rax
+  8002dd:	48 a3 00 60 80 00 00 	movabs %rax,0x806000
+  8002e4:	00 00 00 
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8002e7:	45 85 ed             	test   %r13d,%r13d
+  8002ea:	7e 0d                	jle    8002f9 <libmain+0x82>
+  8002ec:	49 8b 06             	mov    (%r14),%rax
+  8002ef:	48 a3 10 50 80 00 00 	movabs %rax,0x805010
+  8002f6:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8002f9:	4c 89 f6             	mov    %r14,%rsi
+  8002fc:	44 89 ef             	mov    %r13d,%edi
+  8002ff:	48 b8 55 00 80 00 00 	movabs $0x800055,%rax
+  800306:	00 00 00 
+  800309:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  80030b:	48 b8 20 03 80 00 00 	movabs $0x800320,%rax
+  800312:	00 00 00 
+  800315:	ff d0                	call   *%rax
+#endif
+}
+  800317:	5b                   	pop    %rbx
+  800318:	41 5c                	pop    %r12
+  80031a:	41 5d                	pop    %r13
+  80031c:	41 5e                	pop    %r14
+  80031e:	5d                   	pop    %rbp
+  80031f:	c3                   	ret
+
+0000000000800320 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  800320:	55                   	push   %rbp
+  800321:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  800324:	48 b8 60 1b 80 00 00 	movabs $0x801b60,%rax
+  80032b:	00 00 00 
+  80032e:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  800330:	bf 00 00 00 00       	mov    $0x0,%edi
+  800335:	48 b8 3d 12 80 00 00 	movabs $0x80123d,%rax
+  80033c:	00 00 00 
+  80033f:	ff d0                	call   *%rax
+}
+  800341:	5d                   	pop    %rbp
+  800342:	c3                   	ret
+
+0000000000800343 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  800343:	55                   	push   %rbp
+  800344:	48 89 e5             	mov    %rsp,%rbp
+  800347:	41 56                	push   %r14
+  800349:	41 55                	push   %r13
+  80034b:	41 54                	push   %r12
+  80034d:	53                   	push   %rbx
+  80034e:	48 83 ec 50          	sub    $0x50,%rsp
+  800352:	49 89 fc             	mov    %rdi,%r12
+  800355:	41 89 f5             	mov    %esi,%r13d
+  800358:	48 89 d3             	mov    %rdx,%rbx
+  80035b:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  80035f:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  800363:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800367:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  80036e:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800372:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  800376:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  80037a:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  80037e:	48 b8 10 50 80 00 00 	movabs $0x805010,%rax
+  800385:	00 00 00 
+  800388:	4c 8b 30             	mov    (%rax),%r14
+  80038b:	48 b8 a8 12 80 00 00 	movabs $0x8012a8,%rax
+  800392:	00 00 00 
+  800395:	ff d0                	call   *%rax
+  800397:	89 c6                	mov    %eax,%esi
+  800399:	45 89 e8             	mov    %r13d,%r8d
+  80039c:	4c 89 e1             	mov    %r12,%rcx
+  80039f:	4c 89 f2             	mov    %r14,%rdx
+  8003a2:	48 bf a8 3b 80 00 00 	movabs $0x803ba8,%rdi
+  8003a9:	00 00 00 
+  8003ac:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003b1:	49 bc 93 04 80 00 00 	movabs $0x800493,%r12
+  8003b8:	00 00 00 
+  8003bb:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  8003be:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  8003c2:	48 89 df             	mov    %rbx,%rdi
+  8003c5:	48 b8 2f 04 80 00 00 	movabs $0x80042f,%rax
+  8003cc:	00 00 00 
+  8003cf:	ff d0                	call   *%rax
+    cprintf("\n");
+  8003d1:	48 bf 8d 3b 80 00 00 	movabs $0x803b8d,%rdi
+  8003d8:	00 00 00 
+  8003db:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003e0:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  8003e3:	cc                   	int3
+  8003e4:	eb fd                	jmp    8003e3 <_panic+0xa0>
+
+00000000008003e6 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  8003e6:	55                   	push   %rbp
+  8003e7:	48 89 e5             	mov    %rsp,%rbp
+  8003ea:	53                   	push   %rbx
+  8003eb:	48 83 ec 08          	sub    $0x8,%rsp
+  8003ef:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  8003f2:	8b 06                	mov    (%rsi),%eax
+  8003f4:	8d 50 01             	lea    0x1(%rax),%edx
+  8003f7:	89 16                	mov    %edx,(%rsi)
+  8003f9:	48 98                	cltq
+  8003fb:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  800400:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  800406:	74 0a                	je     800412 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  800408:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  80040c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800410:	c9                   	leave
+  800411:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  800412:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  800416:	be ff 00 00 00       	mov    $0xff,%esi
+  80041b:	48 b8 df 11 80 00 00 	movabs $0x8011df,%rax
+  800422:	00 00 00 
+  800425:	ff d0                	call   *%rax
+        state->offset = 0;
+  800427:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  80042d:	eb d9                	jmp    800408 <putch+0x22>
+
+000000000080042f <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  80042f:	55                   	push   %rbp
+  800430:	48 89 e5             	mov    %rsp,%rbp
+  800433:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  80043a:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  80043d:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  800444:	b9 21 00 00 00       	mov    $0x21,%ecx
+  800449:	b8 00 00 00 00       	mov    $0x0,%eax
+  80044e:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  800451:	48 89 f1             	mov    %rsi,%rcx
+  800454:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  80045b:	48 bf e6 03 80 00 00 	movabs $0x8003e6,%rdi
+  800462:	00 00 00 
+  800465:	48 b8 e3 05 80 00 00 	movabs $0x8005e3,%rax
+  80046c:	00 00 00 
+  80046f:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  800471:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  800478:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  80047f:	48 b8 df 11 80 00 00 	movabs $0x8011df,%rax
+  800486:	00 00 00 
+  800489:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  80048b:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  800491:	c9                   	leave
+  800492:	c3                   	ret
+
+0000000000800493 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  800493:	55                   	push   %rbp
+  800494:	48 89 e5             	mov    %rsp,%rbp
+  800497:	48 83 ec 50          	sub    $0x50,%rsp
+  80049b:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  80049f:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8004a3:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8004a7:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8004ab:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  8004af:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  8004b6:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8004ba:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8004be:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8004c2:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  8004c6:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  8004ca:	48 b8 2f 04 80 00 00 	movabs $0x80042f,%rax
+  8004d1:	00 00 00 
+  8004d4:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  8004d6:	c9                   	leave
+  8004d7:	c3                   	ret
+
+00000000008004d8 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  8004d8:	55                   	push   %rbp
+  8004d9:	48 89 e5             	mov    %rsp,%rbp
+  8004dc:	41 57                	push   %r15
+  8004de:	41 56                	push   %r14
+  8004e0:	41 55                	push   %r13
+  8004e2:	41 54                	push   %r12
+  8004e4:	53                   	push   %rbx
+  8004e5:	48 83 ec 18          	sub    $0x18,%rsp
+  8004e9:	49 89 fc             	mov    %rdi,%r12
+  8004ec:	49 89 f5             	mov    %rsi,%r13
+  8004ef:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8004f3:	8b 45 10             	mov    0x10(%rbp),%eax
+  8004f6:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  8004f9:	41 89 cf             	mov    %ecx,%r15d
+  8004fc:	4c 39 fa             	cmp    %r15,%rdx
+  8004ff:	73 5b                	jae    80055c <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  800501:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  800505:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  800509:	85 db                	test   %ebx,%ebx
+  80050b:	7e 0e                	jle    80051b <print_num+0x43>
+            putch(padc, put_arg);
+  80050d:	4c 89 ee             	mov    %r13,%rsi
+  800510:	44 89 f7             	mov    %r14d,%edi
+  800513:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  800516:	83 eb 01             	sub    $0x1,%ebx
+  800519:	75 f2                	jne    80050d <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  80051b:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  80051f:	48 b9 dc 3b 80 00 00 	movabs $0x803bdc,%rcx
+  800526:	00 00 00 
+  800529:	48 b8 cb 3b 80 00 00 	movabs $0x803bcb,%rax
+  800530:	00 00 00 
+  800533:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  800537:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80053b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800540:	49 f7 f7             	div    %r15
+  800543:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  800547:	4c 89 ee             	mov    %r13,%rsi
+  80054a:	41 ff d4             	call   *%r12
+}
+  80054d:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800551:	5b                   	pop    %rbx
+  800552:	41 5c                	pop    %r12
+  800554:	41 5d                	pop    %r13
+  800556:	41 5e                	pop    %r14
+  800558:	41 5f                	pop    %r15
+  80055a:	5d                   	pop    %rbp
+  80055b:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  80055c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800560:	ba 00 00 00 00       	mov    $0x0,%edx
+  800565:	49 f7 f7             	div    %r15
+  800568:	48 83 ec 08          	sub    $0x8,%rsp
+  80056c:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  800570:	52                   	push   %rdx
+  800571:	45 0f be c9          	movsbl %r9b,%r9d
+  800575:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  800579:	48 89 c2             	mov    %rax,%rdx
+  80057c:	48 b8 d8 04 80 00 00 	movabs $0x8004d8,%rax
+  800583:	00 00 00 
+  800586:	ff d0                	call   *%rax
+  800588:	48 83 c4 10          	add    $0x10,%rsp
+  80058c:	eb 8d                	jmp    80051b <print_num+0x43>
+
+000000000080058e <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  80058e:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  800592:	48 8b 06             	mov    (%rsi),%rax
+  800595:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  800599:	73 0a                	jae    8005a5 <sprintputch+0x17>
+        *state->start++ = ch;
+  80059b:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80059f:	48 89 16             	mov    %rdx,(%rsi)
+  8005a2:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  8005a5:	c3                   	ret
+
+00000000008005a6 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  8005a6:	55                   	push   %rbp
+  8005a7:	48 89 e5             	mov    %rsp,%rbp
+  8005aa:	48 83 ec 50          	sub    $0x50,%rsp
+  8005ae:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8005b2:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8005b6:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  8005ba:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8005c1:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8005c5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8005c9:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8005cd:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  8005d1:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8005d5:	48 b8 e3 05 80 00 00 	movabs $0x8005e3,%rax
+  8005dc:	00 00 00 
+  8005df:	ff d0                	call   *%rax
+}
+  8005e1:	c9                   	leave
+  8005e2:	c3                   	ret
+
+00000000008005e3 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  8005e3:	55                   	push   %rbp
+  8005e4:	48 89 e5             	mov    %rsp,%rbp
+  8005e7:	41 57                	push   %r15
+  8005e9:	41 56                	push   %r14
+  8005eb:	41 55                	push   %r13
+  8005ed:	41 54                	push   %r12
+  8005ef:	53                   	push   %rbx
+  8005f0:	48 83 ec 38          	sub    $0x38,%rsp
+  8005f4:	49 89 fe             	mov    %rdi,%r14
+  8005f7:	49 89 f5             	mov    %rsi,%r13
+  8005fa:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  8005fd:	48 8b 01             	mov    (%rcx),%rax
+  800600:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  800604:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800608:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80060c:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  800610:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  800614:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  800618:	0f b6 3b             	movzbl (%rbx),%edi
+  80061b:	40 80 ff 25          	cmp    $0x25,%dil
+  80061f:	74 18                	je     800639 <vprintfmt+0x56>
+            if (!ch) return;
+  800621:	40 84 ff             	test   %dil,%dil
+  800624:	0f 84 b1 06 00 00    	je     800cdb <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  80062a:	40 0f b6 ff          	movzbl %dil,%edi
+  80062e:	4c 89 ee             	mov    %r13,%rsi
+  800631:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  800634:	4c 89 e3             	mov    %r12,%rbx
+  800637:	eb db                	jmp    800614 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  800639:	be 00 00 00 00       	mov    $0x0,%esi
+  80063e:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  800642:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  800647:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  80064d:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  800654:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800658:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  80065d:	41 0f b6 04 24       	movzbl (%r12),%eax
+  800662:	88 45 a0             	mov    %al,-0x60(%rbp)
+  800665:	83 e8 23             	sub    $0x23,%eax
+  800668:	3c 57                	cmp    $0x57,%al
+  80066a:	0f 87 51 06 00 00    	ja     800cc1 <vprintfmt+0x6de>
+  800670:	0f b6 c0             	movzbl %al,%eax
+  800673:	48 b9 a0 3d 80 00 00 	movabs $0x803da0,%rcx
+  80067a:	00 00 00 
+  80067d:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  800680:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  800683:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  800687:	eb cf                	jmp    800658 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  800689:	49 89 dc             	mov    %rbx,%r12
+  80068c:	be 01 00 00 00       	mov    $0x1,%esi
+  800691:	eb c5                	jmp    800658 <vprintfmt+0x75>
+            padc = ch;
+  800693:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  800697:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  80069a:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80069d:	eb b9                	jmp    800658 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  80069f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006a2:	83 f8 2f             	cmp    $0x2f,%eax
+  8006a5:	77 24                	ja     8006cb <vprintfmt+0xe8>
+  8006a7:	89 c1                	mov    %eax,%ecx
+  8006a9:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  8006ad:	83 c0 08             	add    $0x8,%eax
+  8006b0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8006b3:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  8006b6:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  8006b9:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8006bd:	79 99                	jns    800658 <vprintfmt+0x75>
+                width = precision;
+  8006bf:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  8006c3:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8006c9:	eb 8d                	jmp    800658 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8006cb:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8006cf:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  8006d3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006d7:	eb da                	jmp    8006b3 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  8006d9:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  8006de:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8006e2:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  8006e8:	3c 39                	cmp    $0x39,%al
+  8006ea:	77 1c                	ja     800708 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  8006ec:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  8006f0:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  8006f4:	0f b6 c0             	movzbl %al,%eax
+  8006f7:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8006fc:	0f b6 03             	movzbl (%rbx),%eax
+  8006ff:	3c 39                	cmp    $0x39,%al
+  800701:	76 e9                	jbe    8006ec <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  800703:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  800706:	eb b1                	jmp    8006b9 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  800708:	49 89 dc             	mov    %rbx,%r12
+  80070b:	eb ac                	jmp    8006b9 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  80070d:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  800710:	85 c9                	test   %ecx,%ecx
+  800712:	b8 00 00 00 00       	mov    $0x0,%eax
+  800717:	0f 49 c1             	cmovns %ecx,%eax
+  80071a:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  80071d:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800720:	e9 33 ff ff ff       	jmp    800658 <vprintfmt+0x75>
+            lflag++;
+  800725:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  800728:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80072b:	e9 28 ff ff ff       	jmp    800658 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  800730:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800733:	83 f8 2f             	cmp    $0x2f,%eax
+  800736:	77 19                	ja     800751 <vprintfmt+0x16e>
+  800738:	89 c2                	mov    %eax,%edx
+  80073a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80073e:	83 c0 08             	add    $0x8,%eax
+  800741:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800744:	8b 3a                	mov    (%rdx),%edi
+  800746:	4c 89 ee             	mov    %r13,%rsi
+  800749:	41 ff d6             	call   *%r14
+            break;
+  80074c:	e9 c3 fe ff ff       	jmp    800614 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  800751:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800755:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800759:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80075d:	eb e5                	jmp    800744 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  80075f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800762:	83 f8 2f             	cmp    $0x2f,%eax
+  800765:	77 5a                	ja     8007c1 <vprintfmt+0x1de>
+  800767:	89 c2                	mov    %eax,%edx
+  800769:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80076d:	83 c0 08             	add    $0x8,%eax
+  800770:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  800773:	8b 02                	mov    (%rdx),%eax
+  800775:	89 c1                	mov    %eax,%ecx
+  800777:	f7 d9                	neg    %ecx
+  800779:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  80077c:	83 f9 15             	cmp    $0x15,%ecx
+  80077f:	7f 4e                	jg     8007cf <vprintfmt+0x1ec>
+  800781:	48 63 c1             	movslq %ecx,%rax
+  800784:	48 ba 60 40 80 00 00 	movabs $0x804060,%rdx
+  80078b:	00 00 00 
+  80078e:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  800792:	48 85 c0             	test   %rax,%rax
+  800795:	74 38                	je     8007cf <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  800797:	48 89 c1             	mov    %rax,%rcx
+  80079a:	48 ba cc 42 80 00 00 	movabs $0x8042cc,%rdx
+  8007a1:	00 00 00 
+  8007a4:	4c 89 ee             	mov    %r13,%rsi
+  8007a7:	4c 89 f7             	mov    %r14,%rdi
+  8007aa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007af:	49 b8 a6 05 80 00 00 	movabs $0x8005a6,%r8
+  8007b6:	00 00 00 
+  8007b9:	41 ff d0             	call   *%r8
+  8007bc:	e9 53 fe ff ff       	jmp    800614 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  8007c1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007c5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007c9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007cd:	eb a4                	jmp    800773 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  8007cf:	48 ba f4 3b 80 00 00 	movabs $0x803bf4,%rdx
+  8007d6:	00 00 00 
+  8007d9:	4c 89 ee             	mov    %r13,%rsi
+  8007dc:	4c 89 f7             	mov    %r14,%rdi
+  8007df:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007e4:	49 b8 a6 05 80 00 00 	movabs $0x8005a6,%r8
+  8007eb:	00 00 00 
+  8007ee:	41 ff d0             	call   *%r8
+  8007f1:	e9 1e fe ff ff       	jmp    800614 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8007f6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007f9:	83 f8 2f             	cmp    $0x2f,%eax
+  8007fc:	77 6c                	ja     80086a <vprintfmt+0x287>
+  8007fe:	89 c2                	mov    %eax,%edx
+  800800:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800804:	83 c0 08             	add    $0x8,%eax
+  800807:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80080a:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  80080d:	48 85 d2             	test   %rdx,%rdx
+  800810:	48 b8 ed 3b 80 00 00 	movabs $0x803bed,%rax
+  800817:	00 00 00 
+  80081a:	48 0f 45 c2          	cmovne %rdx,%rax
+  80081e:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  800822:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800826:	7e 06                	jle    80082e <vprintfmt+0x24b>
+  800828:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  80082c:	75 4a                	jne    800878 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  80082e:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800832:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  800836:	0f b6 00             	movzbl (%rax),%eax
+  800839:	84 c0                	test   %al,%al
+  80083b:	0f 85 9a 00 00 00    	jne    8008db <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  800841:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800844:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  800848:	85 c0                	test   %eax,%eax
+  80084a:	0f 8e c4 fd ff ff    	jle    800614 <vprintfmt+0x31>
+  800850:	4c 89 ee             	mov    %r13,%rsi
+  800853:	bf 20 00 00 00       	mov    $0x20,%edi
+  800858:	41 ff d6             	call   *%r14
+  80085b:	41 83 ec 01          	sub    $0x1,%r12d
+  80085f:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  800863:	75 eb                	jne    800850 <vprintfmt+0x26d>
+  800865:	e9 aa fd ff ff       	jmp    800614 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  80086a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80086e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800872:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800876:	eb 92                	jmp    80080a <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  800878:	49 63 f7             	movslq %r15d,%rsi
+  80087b:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  80087f:	48 b8 95 0d 80 00 00 	movabs $0x800d95,%rax
+  800886:	00 00 00 
+  800889:	ff d0                	call   *%rax
+  80088b:	48 89 c2             	mov    %rax,%rdx
+  80088e:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800891:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  800893:	8d 70 ff             	lea    -0x1(%rax),%esi
+  800896:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  800899:	85 c0                	test   %eax,%eax
+  80089b:	7e 91                	jle    80082e <vprintfmt+0x24b>
+  80089d:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  8008a2:	4c 89 ee             	mov    %r13,%rsi
+  8008a5:	44 89 e7             	mov    %r12d,%edi
+  8008a8:	41 ff d6             	call   *%r14
+  8008ab:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8008af:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8008b2:	83 f8 ff             	cmp    $0xffffffff,%eax
+  8008b5:	75 eb                	jne    8008a2 <vprintfmt+0x2bf>
+  8008b7:	e9 72 ff ff ff       	jmp    80082e <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8008bc:	0f b6 f8             	movzbl %al,%edi
+  8008bf:	4c 89 ee             	mov    %r13,%rsi
+  8008c2:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8008c5:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8008c9:	49 83 c4 01          	add    $0x1,%r12
+  8008cd:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  8008d3:	84 c0                	test   %al,%al
+  8008d5:	0f 84 66 ff ff ff    	je     800841 <vprintfmt+0x25e>
+  8008db:	45 85 ff             	test   %r15d,%r15d
+  8008de:	78 0a                	js     8008ea <vprintfmt+0x307>
+  8008e0:	41 83 ef 01          	sub    $0x1,%r15d
+  8008e4:	0f 88 57 ff ff ff    	js     800841 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8008ea:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  8008ee:	74 cc                	je     8008bc <vprintfmt+0x2d9>
+  8008f0:	8d 50 e0             	lea    -0x20(%rax),%edx
+  8008f3:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  8008f8:	80 fa 5e             	cmp    $0x5e,%dl
+  8008fb:	77 c2                	ja     8008bf <vprintfmt+0x2dc>
+  8008fd:	eb bd                	jmp    8008bc <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  8008ff:	40 84 f6             	test   %sil,%sil
+  800902:	75 26                	jne    80092a <vprintfmt+0x347>
+    switch (lflag) {
+  800904:	85 d2                	test   %edx,%edx
+  800906:	74 59                	je     800961 <vprintfmt+0x37e>
+  800908:	83 fa 01             	cmp    $0x1,%edx
+  80090b:	74 7b                	je     800988 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  80090d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800910:	83 f8 2f             	cmp    $0x2f,%eax
+  800913:	0f 87 96 00 00 00    	ja     8009af <vprintfmt+0x3cc>
+  800919:	89 c2                	mov    %eax,%edx
+  80091b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80091f:	83 c0 08             	add    $0x8,%eax
+  800922:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800925:	4c 8b 22             	mov    (%rdx),%r12
+  800928:	eb 17                	jmp    800941 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  80092a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80092d:	83 f8 2f             	cmp    $0x2f,%eax
+  800930:	77 21                	ja     800953 <vprintfmt+0x370>
+  800932:	89 c2                	mov    %eax,%edx
+  800934:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800938:	83 c0 08             	add    $0x8,%eax
+  80093b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80093e:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  800941:	4d 85 e4             	test   %r12,%r12
+  800944:	78 7a                	js     8009c0 <vprintfmt+0x3dd>
+            num = i;
+  800946:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  800949:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  80094e:	e9 50 02 00 00       	jmp    800ba3 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800953:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800957:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80095b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80095f:	eb dd                	jmp    80093e <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  800961:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800964:	83 f8 2f             	cmp    $0x2f,%eax
+  800967:	77 11                	ja     80097a <vprintfmt+0x397>
+  800969:	89 c2                	mov    %eax,%edx
+  80096b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80096f:	83 c0 08             	add    $0x8,%eax
+  800972:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800975:	4c 63 22             	movslq (%rdx),%r12
+  800978:	eb c7                	jmp    800941 <vprintfmt+0x35e>
+  80097a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80097e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800982:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800986:	eb ed                	jmp    800975 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  800988:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80098b:	83 f8 2f             	cmp    $0x2f,%eax
+  80098e:	77 11                	ja     8009a1 <vprintfmt+0x3be>
+  800990:	89 c2                	mov    %eax,%edx
+  800992:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800996:	83 c0 08             	add    $0x8,%eax
+  800999:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80099c:	4c 8b 22             	mov    (%rdx),%r12
+  80099f:	eb a0                	jmp    800941 <vprintfmt+0x35e>
+  8009a1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009a5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009a9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009ad:	eb ed                	jmp    80099c <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  8009af:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009b3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009b7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009bb:	e9 65 ff ff ff       	jmp    800925 <vprintfmt+0x342>
+                putch('-', put_arg);
+  8009c0:	4c 89 ee             	mov    %r13,%rsi
+  8009c3:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  8009c8:	41 ff d6             	call   *%r14
+                i = -i;
+  8009cb:	49 f7 dc             	neg    %r12
+  8009ce:	e9 73 ff ff ff       	jmp    800946 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  8009d3:	40 84 f6             	test   %sil,%sil
+  8009d6:	75 32                	jne    800a0a <vprintfmt+0x427>
+    switch (lflag) {
+  8009d8:	85 d2                	test   %edx,%edx
+  8009da:	74 5d                	je     800a39 <vprintfmt+0x456>
+  8009dc:	83 fa 01             	cmp    $0x1,%edx
+  8009df:	0f 84 82 00 00 00    	je     800a67 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  8009e5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009e8:	83 f8 2f             	cmp    $0x2f,%eax
+  8009eb:	0f 87 a5 00 00 00    	ja     800a96 <vprintfmt+0x4b3>
+  8009f1:	89 c2                	mov    %eax,%edx
+  8009f3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009f7:	83 c0 08             	add    $0x8,%eax
+  8009fa:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009fd:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800a00:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  800a05:	e9 99 01 00 00       	jmp    800ba3 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800a0a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a0d:	83 f8 2f             	cmp    $0x2f,%eax
+  800a10:	77 19                	ja     800a2b <vprintfmt+0x448>
+  800a12:	89 c2                	mov    %eax,%edx
+  800a14:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a18:	83 c0 08             	add    $0x8,%eax
+  800a1b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a1e:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800a21:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800a26:	e9 78 01 00 00       	jmp    800ba3 <vprintfmt+0x5c0>
+  800a2b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a2f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a33:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a37:	eb e5                	jmp    800a1e <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  800a39:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a3c:	83 f8 2f             	cmp    $0x2f,%eax
+  800a3f:	77 18                	ja     800a59 <vprintfmt+0x476>
+  800a41:	89 c2                	mov    %eax,%edx
+  800a43:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a47:	83 c0 08             	add    $0x8,%eax
+  800a4a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a4d:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800a4f:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  800a54:	e9 4a 01 00 00       	jmp    800ba3 <vprintfmt+0x5c0>
+  800a59:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a5d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a61:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a65:	eb e6                	jmp    800a4d <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  800a67:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a6a:	83 f8 2f             	cmp    $0x2f,%eax
+  800a6d:	77 19                	ja     800a88 <vprintfmt+0x4a5>
+  800a6f:	89 c2                	mov    %eax,%edx
+  800a71:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a75:	83 c0 08             	add    $0x8,%eax
+  800a78:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a7b:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800a7e:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  800a83:	e9 1b 01 00 00       	jmp    800ba3 <vprintfmt+0x5c0>
+  800a88:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a8c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a90:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a94:	eb e5                	jmp    800a7b <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  800a96:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a9a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a9e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800aa2:	e9 56 ff ff ff       	jmp    8009fd <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  800aa7:	40 84 f6             	test   %sil,%sil
+  800aaa:	75 2e                	jne    800ada <vprintfmt+0x4f7>
+    switch (lflag) {
+  800aac:	85 d2                	test   %edx,%edx
+  800aae:	74 59                	je     800b09 <vprintfmt+0x526>
+  800ab0:	83 fa 01             	cmp    $0x1,%edx
+  800ab3:	74 7f                	je     800b34 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  800ab5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ab8:	83 f8 2f             	cmp    $0x2f,%eax
+  800abb:	0f 87 9f 00 00 00    	ja     800b60 <vprintfmt+0x57d>
+  800ac1:	89 c2                	mov    %eax,%edx
+  800ac3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ac7:	83 c0 08             	add    $0x8,%eax
+  800aca:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800acd:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800ad0:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  800ad5:	e9 c9 00 00 00       	jmp    800ba3 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800ada:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800add:	83 f8 2f             	cmp    $0x2f,%eax
+  800ae0:	77 19                	ja     800afb <vprintfmt+0x518>
+  800ae2:	89 c2                	mov    %eax,%edx
+  800ae4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ae8:	83 c0 08             	add    $0x8,%eax
+  800aeb:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800aee:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800af1:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800af6:	e9 a8 00 00 00       	jmp    800ba3 <vprintfmt+0x5c0>
+  800afb:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800aff:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b03:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b07:	eb e5                	jmp    800aee <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  800b09:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b0c:	83 f8 2f             	cmp    $0x2f,%eax
+  800b0f:	77 15                	ja     800b26 <vprintfmt+0x543>
+  800b11:	89 c2                	mov    %eax,%edx
+  800b13:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b17:	83 c0 08             	add    $0x8,%eax
+  800b1a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b1d:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  800b1f:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  800b24:	eb 7d                	jmp    800ba3 <vprintfmt+0x5c0>
+  800b26:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b2a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b2e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b32:	eb e9                	jmp    800b1d <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  800b34:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b37:	83 f8 2f             	cmp    $0x2f,%eax
+  800b3a:	77 16                	ja     800b52 <vprintfmt+0x56f>
+  800b3c:	89 c2                	mov    %eax,%edx
+  800b3e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b42:	83 c0 08             	add    $0x8,%eax
+  800b45:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b48:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800b4b:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  800b50:	eb 51                	jmp    800ba3 <vprintfmt+0x5c0>
+  800b52:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b56:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b5a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b5e:	eb e8                	jmp    800b48 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  800b60:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b64:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b68:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b6c:	e9 5c ff ff ff       	jmp    800acd <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  800b71:	4c 89 ee             	mov    %r13,%rsi
+  800b74:	bf 30 00 00 00       	mov    $0x30,%edi
+  800b79:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800b7c:	4c 89 ee             	mov    %r13,%rsi
+  800b7f:	bf 78 00 00 00       	mov    $0x78,%edi
+  800b84:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800b87:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b8a:	83 f8 2f             	cmp    $0x2f,%eax
+  800b8d:	77 47                	ja     800bd6 <vprintfmt+0x5f3>
+  800b8f:	89 c2                	mov    %eax,%edx
+  800b91:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b95:	83 c0 08             	add    $0x8,%eax
+  800b98:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b9b:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800b9e:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800ba3:	48 83 ec 08          	sub    $0x8,%rsp
+  800ba7:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800bab:	0f 94 c0             	sete   %al
+  800bae:	0f b6 c0             	movzbl %al,%eax
+  800bb1:	50                   	push   %rax
+  800bb2:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800bb7:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800bbb:	4c 89 ee             	mov    %r13,%rsi
+  800bbe:	4c 89 f7             	mov    %r14,%rdi
+  800bc1:	48 b8 d8 04 80 00 00 	movabs $0x8004d8,%rax
+  800bc8:	00 00 00 
+  800bcb:	ff d0                	call   *%rax
+            break;
+  800bcd:	48 83 c4 10          	add    $0x10,%rsp
+  800bd1:	e9 3e fa ff ff       	jmp    800614 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800bd6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bda:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bde:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800be2:	eb b7                	jmp    800b9b <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  800be4:	40 84 f6             	test   %sil,%sil
+  800be7:	75 2b                	jne    800c14 <vprintfmt+0x631>
+    switch (lflag) {
+  800be9:	85 d2                	test   %edx,%edx
+  800beb:	74 56                	je     800c43 <vprintfmt+0x660>
+  800bed:	83 fa 01             	cmp    $0x1,%edx
+  800bf0:	74 7f                	je     800c71 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800bf2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bf5:	83 f8 2f             	cmp    $0x2f,%eax
+  800bf8:	0f 87 a2 00 00 00    	ja     800ca0 <vprintfmt+0x6bd>
+  800bfe:	89 c2                	mov    %eax,%edx
+  800c00:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c04:	83 c0 08             	add    $0x8,%eax
+  800c07:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c0a:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800c0d:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800c12:	eb 8f                	jmp    800ba3 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800c14:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c17:	83 f8 2f             	cmp    $0x2f,%eax
+  800c1a:	77 19                	ja     800c35 <vprintfmt+0x652>
+  800c1c:	89 c2                	mov    %eax,%edx
+  800c1e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c22:	83 c0 08             	add    $0x8,%eax
+  800c25:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c28:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800c2b:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800c30:	e9 6e ff ff ff       	jmp    800ba3 <vprintfmt+0x5c0>
+  800c35:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c39:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c3d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c41:	eb e5                	jmp    800c28 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800c43:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c46:	83 f8 2f             	cmp    $0x2f,%eax
+  800c49:	77 18                	ja     800c63 <vprintfmt+0x680>
+  800c4b:	89 c2                	mov    %eax,%edx
+  800c4d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c51:	83 c0 08             	add    $0x8,%eax
+  800c54:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c57:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800c59:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800c5e:	e9 40 ff ff ff       	jmp    800ba3 <vprintfmt+0x5c0>
+  800c63:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c67:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c6b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c6f:	eb e6                	jmp    800c57 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800c71:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c74:	83 f8 2f             	cmp    $0x2f,%eax
+  800c77:	77 19                	ja     800c92 <vprintfmt+0x6af>
+  800c79:	89 c2                	mov    %eax,%edx
+  800c7b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c7f:	83 c0 08             	add    $0x8,%eax
+  800c82:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c85:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800c88:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800c8d:	e9 11 ff ff ff       	jmp    800ba3 <vprintfmt+0x5c0>
+  800c92:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c96:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c9a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c9e:	eb e5                	jmp    800c85 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800ca0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ca4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ca8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800cac:	e9 59 ff ff ff       	jmp    800c0a <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800cb1:	4c 89 ee             	mov    %r13,%rsi
+  800cb4:	bf 25 00 00 00       	mov    $0x25,%edi
+  800cb9:	41 ff d6             	call   *%r14
+            break;
+  800cbc:	e9 53 f9 ff ff       	jmp    800614 <vprintfmt+0x31>
+            putch('%', put_arg);
+  800cc1:	4c 89 ee             	mov    %r13,%rsi
+  800cc4:	bf 25 00 00 00       	mov    $0x25,%edi
+  800cc9:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800ccc:	48 83 eb 01          	sub    $0x1,%rbx
+  800cd0:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800cd4:	75 f6                	jne    800ccc <vprintfmt+0x6e9>
+  800cd6:	e9 39 f9 ff ff       	jmp    800614 <vprintfmt+0x31>
+}
+  800cdb:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800cdf:	5b                   	pop    %rbx
+  800ce0:	41 5c                	pop    %r12
+  800ce2:	41 5d                	pop    %r13
+  800ce4:	41 5e                	pop    %r14
+  800ce6:	41 5f                	pop    %r15
+  800ce8:	5d                   	pop    %rbp
+  800ce9:	c3                   	ret
+
+0000000000800cea <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800cea:	55                   	push   %rbp
+  800ceb:	48 89 e5             	mov    %rsp,%rbp
+  800cee:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800cf2:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800cf6:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800cfb:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800cff:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800d06:	48 85 ff             	test   %rdi,%rdi
+  800d09:	74 2b                	je     800d36 <vsnprintf+0x4c>
+  800d0b:	48 85 f6             	test   %rsi,%rsi
+  800d0e:	74 26                	je     800d36 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800d10:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800d14:	48 bf 8e 05 80 00 00 	movabs $0x80058e,%rdi
+  800d1b:	00 00 00 
+  800d1e:	48 b8 e3 05 80 00 00 	movabs $0x8005e3,%rax
+  800d25:	00 00 00 
+  800d28:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800d2a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800d2e:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800d31:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800d34:	c9                   	leave
+  800d35:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800d36:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800d3b:	eb f7                	jmp    800d34 <vsnprintf+0x4a>
+
+0000000000800d3d <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800d3d:	55                   	push   %rbp
+  800d3e:	48 89 e5             	mov    %rsp,%rbp
+  800d41:	48 83 ec 50          	sub    $0x50,%rsp
+  800d45:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800d49:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800d4d:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800d51:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800d58:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800d5c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d60:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800d64:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800d68:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800d6c:	48 b8 ea 0c 80 00 00 	movabs $0x800cea,%rax
+  800d73:	00 00 00 
+  800d76:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800d78:	c9                   	leave
+  800d79:	c3                   	ret
+
+0000000000800d7a <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800d7a:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800d7d:	74 10                	je     800d8f <strlen+0x15>
+    size_t n = 0;
+  800d7f:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800d84:	48 83 c0 01          	add    $0x1,%rax
+  800d88:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800d8c:	75 f6                	jne    800d84 <strlen+0xa>
+  800d8e:	c3                   	ret
+    size_t n = 0;
+  800d8f:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800d94:	c3                   	ret
+
+0000000000800d95 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800d95:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800d98:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800d9d:	48 85 f6             	test   %rsi,%rsi
+  800da0:	74 11                	je     800db3 <strnlen+0x1e>
+  800da2:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800da6:	74 0c                	je     800db4 <strnlen+0x1f>
+  800da8:	48 83 c2 01          	add    $0x1,%rdx
+  800dac:	48 39 d0             	cmp    %rdx,%rax
+  800daf:	75 f1                	jne    800da2 <strnlen+0xd>
+  800db1:	eb 04                	jmp    800db7 <strnlen+0x22>
+  800db3:	c3                   	ret
+  800db4:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800db7:	c3                   	ret
+
+0000000000800db8 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800db8:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800dbb:	ba 00 00 00 00       	mov    $0x0,%edx
+  800dc0:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800dc4:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800dc7:	48 83 c2 01          	add    $0x1,%rdx
+  800dcb:	84 c9                	test   %cl,%cl
+  800dcd:	75 f1                	jne    800dc0 <strcpy+0x8>
+        ;
+    return res;
+}
+  800dcf:	c3                   	ret
+
+0000000000800dd0 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800dd0:	55                   	push   %rbp
+  800dd1:	48 89 e5             	mov    %rsp,%rbp
+  800dd4:	41 54                	push   %r12
+  800dd6:	53                   	push   %rbx
+  800dd7:	48 89 fb             	mov    %rdi,%rbx
+  800dda:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800ddd:	48 b8 7a 0d 80 00 00 	movabs $0x800d7a,%rax
+  800de4:	00 00 00 
+  800de7:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800de9:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800ded:	4c 89 e6             	mov    %r12,%rsi
+  800df0:	48 b8 b8 0d 80 00 00 	movabs $0x800db8,%rax
+  800df7:	00 00 00 
+  800dfa:	ff d0                	call   *%rax
+    return dst;
+}
+  800dfc:	48 89 d8             	mov    %rbx,%rax
+  800dff:	5b                   	pop    %rbx
+  800e00:	41 5c                	pop    %r12
+  800e02:	5d                   	pop    %rbp
+  800e03:	c3                   	ret
+
+0000000000800e04 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800e04:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800e07:	48 85 d2             	test   %rdx,%rdx
+  800e0a:	74 1f                	je     800e2b <strncpy+0x27>
+  800e0c:	48 01 fa             	add    %rdi,%rdx
+  800e0f:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800e12:	48 83 c1 01          	add    $0x1,%rcx
+  800e16:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800e1a:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800e1e:	41 80 f8 01          	cmp    $0x1,%r8b
+  800e22:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800e26:	48 39 ca             	cmp    %rcx,%rdx
+  800e29:	75 e7                	jne    800e12 <strncpy+0xe>
+    }
+    return ret;
+}
+  800e2b:	c3                   	ret
+
+0000000000800e2c <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800e2c:	48 89 f8             	mov    %rdi,%rax
+  800e2f:	48 85 d2             	test   %rdx,%rdx
+  800e32:	74 24                	je     800e58 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800e34:	48 83 ea 01          	sub    $0x1,%rdx
+  800e38:	74 1b                	je     800e55 <strlcpy+0x29>
+  800e3a:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800e3e:	0f b6 16             	movzbl (%rsi),%edx
+  800e41:	84 d2                	test   %dl,%dl
+  800e43:	74 10                	je     800e55 <strlcpy+0x29>
+            *dst++ = *src++;
+  800e45:	48 83 c6 01          	add    $0x1,%rsi
+  800e49:	48 83 c0 01          	add    $0x1,%rax
+  800e4d:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800e50:	48 39 c8             	cmp    %rcx,%rax
+  800e53:	75 e9                	jne    800e3e <strlcpy+0x12>
+        *dst = '\0';
+  800e55:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800e58:	48 29 f8             	sub    %rdi,%rax
+}
+  800e5b:	c3                   	ret
+
+0000000000800e5c <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800e5c:	0f b6 07             	movzbl (%rdi),%eax
+  800e5f:	84 c0                	test   %al,%al
+  800e61:	74 13                	je     800e76 <strcmp+0x1a>
+  800e63:	38 06                	cmp    %al,(%rsi)
+  800e65:	75 0f                	jne    800e76 <strcmp+0x1a>
+  800e67:	48 83 c7 01          	add    $0x1,%rdi
+  800e6b:	48 83 c6 01          	add    $0x1,%rsi
+  800e6f:	0f b6 07             	movzbl (%rdi),%eax
+  800e72:	84 c0                	test   %al,%al
+  800e74:	75 ed                	jne    800e63 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800e76:	0f b6 c0             	movzbl %al,%eax
+  800e79:	0f b6 16             	movzbl (%rsi),%edx
+  800e7c:	29 d0                	sub    %edx,%eax
+}
+  800e7e:	c3                   	ret
+
+0000000000800e7f <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800e7f:	48 85 d2             	test   %rdx,%rdx
+  800e82:	74 1f                	je     800ea3 <strncmp+0x24>
+  800e84:	0f b6 07             	movzbl (%rdi),%eax
+  800e87:	84 c0                	test   %al,%al
+  800e89:	74 1e                	je     800ea9 <strncmp+0x2a>
+  800e8b:	3a 06                	cmp    (%rsi),%al
+  800e8d:	75 1a                	jne    800ea9 <strncmp+0x2a>
+  800e8f:	48 83 c7 01          	add    $0x1,%rdi
+  800e93:	48 83 c6 01          	add    $0x1,%rsi
+  800e97:	48 83 ea 01          	sub    $0x1,%rdx
+  800e9b:	75 e7                	jne    800e84 <strncmp+0x5>
+
+    if (!n) return 0;
+  800e9d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ea2:	c3                   	ret
+  800ea3:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ea8:	c3                   	ret
+  800ea9:	48 85 d2             	test   %rdx,%rdx
+  800eac:	74 09                	je     800eb7 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800eae:	0f b6 07             	movzbl (%rdi),%eax
+  800eb1:	0f b6 16             	movzbl (%rsi),%edx
+  800eb4:	29 d0                	sub    %edx,%eax
+  800eb6:	c3                   	ret
+    if (!n) return 0;
+  800eb7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800ebc:	c3                   	ret
+
+0000000000800ebd <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800ebd:	0f b6 17             	movzbl (%rdi),%edx
+  800ec0:	84 d2                	test   %dl,%dl
+  800ec2:	74 18                	je     800edc <strchr+0x1f>
+        if (*str == c) {
+  800ec4:	0f be d2             	movsbl %dl,%edx
+  800ec7:	39 f2                	cmp    %esi,%edx
+  800ec9:	74 17                	je     800ee2 <strchr+0x25>
+    for (; *str; str++) {
+  800ecb:	48 83 c7 01          	add    $0x1,%rdi
+  800ecf:	0f b6 17             	movzbl (%rdi),%edx
+  800ed2:	84 d2                	test   %dl,%dl
+  800ed4:	75 ee                	jne    800ec4 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800ed6:	b8 00 00 00 00       	mov    $0x0,%eax
+  800edb:	c3                   	ret
+  800edc:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ee1:	c3                   	ret
+  800ee2:	48 89 f8             	mov    %rdi,%rax
+}
+  800ee5:	c3                   	ret
+
+0000000000800ee6 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800ee6:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800ee9:	0f b6 17             	movzbl (%rdi),%edx
+  800eec:	84 d2                	test   %dl,%dl
+  800eee:	74 13                	je     800f03 <strfind+0x1d>
+  800ef0:	0f be d2             	movsbl %dl,%edx
+  800ef3:	39 f2                	cmp    %esi,%edx
+  800ef5:	74 0b                	je     800f02 <strfind+0x1c>
+  800ef7:	48 83 c0 01          	add    $0x1,%rax
+  800efb:	0f b6 10             	movzbl (%rax),%edx
+  800efe:	84 d2                	test   %dl,%dl
+  800f00:	75 ee                	jne    800ef0 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800f02:	c3                   	ret
+  800f03:	c3                   	ret
+
+0000000000800f04 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800f04:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800f07:	48 89 f8             	mov    %rdi,%rax
+  800f0a:	48 f7 d8             	neg    %rax
+  800f0d:	83 e0 07             	and    $0x7,%eax
+  800f10:	49 89 d1             	mov    %rdx,%r9
+  800f13:	49 29 c1             	sub    %rax,%r9
+  800f16:	78 36                	js     800f4e <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800f18:	40 0f b6 c6          	movzbl %sil,%eax
+  800f1c:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800f23:	01 01 01 
+  800f26:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800f2a:	40 f6 c7 07          	test   $0x7,%dil
+  800f2e:	75 38                	jne    800f68 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800f30:	4c 89 c9             	mov    %r9,%rcx
+  800f33:	48 c1 f9 03          	sar    $0x3,%rcx
+  800f37:	74 0c                	je     800f45 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800f39:	fc                   	cld
+  800f3a:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800f3d:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800f41:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800f45:	4d 85 c9             	test   %r9,%r9
+  800f48:	75 45                	jne    800f8f <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800f4a:	4c 89 c0             	mov    %r8,%rax
+  800f4d:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800f4e:	48 85 d2             	test   %rdx,%rdx
+  800f51:	74 f7                	je     800f4a <memset+0x46>
+  800f53:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800f56:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800f59:	48 83 c0 01          	add    $0x1,%rax
+  800f5d:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  800f61:	48 39 c2             	cmp    %rax,%rdx
+  800f64:	75 f3                	jne    800f59 <memset+0x55>
+  800f66:	eb e2                	jmp    800f4a <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  800f68:	40 f6 c7 01          	test   $0x1,%dil
+  800f6c:	74 06                	je     800f74 <memset+0x70>
+  800f6e:	88 07                	mov    %al,(%rdi)
+  800f70:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800f74:	40 f6 c7 02          	test   $0x2,%dil
+  800f78:	74 07                	je     800f81 <memset+0x7d>
+  800f7a:	66 89 07             	mov    %ax,(%rdi)
+  800f7d:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800f81:	40 f6 c7 04          	test   $0x4,%dil
+  800f85:	74 a9                	je     800f30 <memset+0x2c>
+  800f87:	89 07                	mov    %eax,(%rdi)
+  800f89:	48 83 c7 04          	add    $0x4,%rdi
+  800f8d:	eb a1                	jmp    800f30 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800f8f:	41 f6 c1 04          	test   $0x4,%r9b
+  800f93:	74 06                	je     800f9b <memset+0x97>
+  800f95:	89 07                	mov    %eax,(%rdi)
+  800f97:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800f9b:	41 f6 c1 02          	test   $0x2,%r9b
+  800f9f:	74 07                	je     800fa8 <memset+0xa4>
+  800fa1:	66 89 07             	mov    %ax,(%rdi)
+  800fa4:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  800fa8:	41 f6 c1 01          	test   $0x1,%r9b
+  800fac:	74 9c                	je     800f4a <memset+0x46>
+  800fae:	88 07                	mov    %al,(%rdi)
+  800fb0:	eb 98                	jmp    800f4a <memset+0x46>
+
+0000000000800fb2 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  800fb2:	48 89 f8             	mov    %rdi,%rax
+  800fb5:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  800fb8:	48 39 fe             	cmp    %rdi,%rsi
+  800fbb:	73 3b                	jae    800ff8 <memmove+0x46>
+  800fbd:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  800fc1:	48 39 d7             	cmp    %rdx,%rdi
+  800fc4:	73 32                	jae    800ff8 <memmove+0x46>
+        s += n;
+        d += n;
+  800fc6:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800fca:	48 89 d6             	mov    %rdx,%rsi
+  800fcd:	48 09 fe             	or     %rdi,%rsi
+  800fd0:	48 09 ce             	or     %rcx,%rsi
+  800fd3:	40 f6 c6 07          	test   $0x7,%sil
+  800fd7:	75 12                	jne    800feb <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  800fd9:	48 83 ef 08          	sub    $0x8,%rdi
+  800fdd:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  800fe1:	48 c1 e9 03          	shr    $0x3,%rcx
+  800fe5:	fd                   	std
+  800fe6:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  800fe9:	fc                   	cld
+  800fea:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  800feb:	48 83 ef 01          	sub    $0x1,%rdi
+  800fef:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  800ff3:	fd                   	std
+  800ff4:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  800ff6:	eb f1                	jmp    800fe9 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800ff8:	48 89 f2             	mov    %rsi,%rdx
+  800ffb:	48 09 c2             	or     %rax,%rdx
+  800ffe:	48 09 ca             	or     %rcx,%rdx
+  801001:	f6 c2 07             	test   $0x7,%dl
+  801004:	75 0c                	jne    801012 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  801006:	48 c1 e9 03          	shr    $0x3,%rcx
+  80100a:	48 89 c7             	mov    %rax,%rdi
+  80100d:	fc                   	cld
+  80100e:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  801011:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  801012:	48 89 c7             	mov    %rax,%rdi
+  801015:	fc                   	cld
+  801016:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  801018:	c3                   	ret
+
+0000000000801019 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  801019:	55                   	push   %rbp
+  80101a:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  80101d:	48 b8 b2 0f 80 00 00 	movabs $0x800fb2,%rax
+  801024:	00 00 00 
+  801027:	ff d0                	call   *%rax
+}
+  801029:	5d                   	pop    %rbp
+  80102a:	c3                   	ret
+
+000000000080102b <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  80102b:	55                   	push   %rbp
+  80102c:	48 89 e5             	mov    %rsp,%rbp
+  80102f:	41 57                	push   %r15
+  801031:	41 56                	push   %r14
+  801033:	41 55                	push   %r13
+  801035:	41 54                	push   %r12
+  801037:	53                   	push   %rbx
+  801038:	48 83 ec 08          	sub    $0x8,%rsp
+  80103c:	49 89 fe             	mov    %rdi,%r14
+  80103f:	49 89 f7             	mov    %rsi,%r15
+  801042:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  801045:	48 89 f7             	mov    %rsi,%rdi
+  801048:	48 b8 7a 0d 80 00 00 	movabs $0x800d7a,%rax
+  80104f:	00 00 00 
+  801052:	ff d0                	call   *%rax
+  801054:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  801057:	48 89 de             	mov    %rbx,%rsi
+  80105a:	4c 89 f7             	mov    %r14,%rdi
+  80105d:	48 b8 95 0d 80 00 00 	movabs $0x800d95,%rax
+  801064:	00 00 00 
+  801067:	ff d0                	call   *%rax
+  801069:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  80106c:	48 39 c3             	cmp    %rax,%rbx
+  80106f:	74 36                	je     8010a7 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  801071:	48 89 d8             	mov    %rbx,%rax
+  801074:	4c 29 e8             	sub    %r13,%rax
+  801077:	49 39 c4             	cmp    %rax,%r12
+  80107a:	73 31                	jae    8010ad <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  80107c:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  801081:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  801085:	4c 89 fe             	mov    %r15,%rsi
+  801088:	48 b8 19 10 80 00 00 	movabs $0x801019,%rax
+  80108f:	00 00 00 
+  801092:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  801094:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  801098:	48 83 c4 08          	add    $0x8,%rsp
+  80109c:	5b                   	pop    %rbx
+  80109d:	41 5c                	pop    %r12
+  80109f:	41 5d                	pop    %r13
+  8010a1:	41 5e                	pop    %r14
+  8010a3:	41 5f                	pop    %r15
+  8010a5:	5d                   	pop    %rbp
+  8010a6:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  8010a7:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  8010ab:	eb eb                	jmp    801098 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  8010ad:	48 83 eb 01          	sub    $0x1,%rbx
+  8010b1:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8010b5:	48 89 da             	mov    %rbx,%rdx
+  8010b8:	4c 89 fe             	mov    %r15,%rsi
+  8010bb:	48 b8 19 10 80 00 00 	movabs $0x801019,%rax
+  8010c2:	00 00 00 
+  8010c5:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  8010c7:	49 01 de             	add    %rbx,%r14
+  8010ca:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  8010cf:	eb c3                	jmp    801094 <strlcat+0x69>
+
+00000000008010d1 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  8010d1:	48 85 d2             	test   %rdx,%rdx
+  8010d4:	74 2d                	je     801103 <memcmp+0x32>
+  8010d6:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  8010db:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  8010df:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  8010e4:	44 38 c1             	cmp    %r8b,%cl
+  8010e7:	75 0f                	jne    8010f8 <memcmp+0x27>
+    while (n-- > 0) {
+  8010e9:	48 83 c0 01          	add    $0x1,%rax
+  8010ed:	48 39 c2             	cmp    %rax,%rdx
+  8010f0:	75 e9                	jne    8010db <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  8010f2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010f7:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  8010f8:	0f b6 c1             	movzbl %cl,%eax
+  8010fb:	45 0f b6 c0          	movzbl %r8b,%r8d
+  8010ff:	44 29 c0             	sub    %r8d,%eax
+  801102:	c3                   	ret
+    return 0;
+  801103:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801108:	c3                   	ret
+
+0000000000801109 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  801109:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  80110d:	48 39 c7             	cmp    %rax,%rdi
+  801110:	73 0f                	jae    801121 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  801112:	40 38 37             	cmp    %sil,(%rdi)
+  801115:	74 0e                	je     801125 <memfind+0x1c>
+    for (; src < end; src++) {
+  801117:	48 83 c7 01          	add    $0x1,%rdi
+  80111b:	48 39 f8             	cmp    %rdi,%rax
+  80111e:	75 f2                	jne    801112 <memfind+0x9>
+  801120:	c3                   	ret
+  801121:	48 89 f8             	mov    %rdi,%rax
+  801124:	c3                   	ret
+  801125:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  801128:	c3                   	ret
+
+0000000000801129 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  801129:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  80112c:	0f b6 37             	movzbl (%rdi),%esi
+  80112f:	40 80 fe 20          	cmp    $0x20,%sil
+  801133:	74 06                	je     80113b <strtol+0x12>
+  801135:	40 80 fe 09          	cmp    $0x9,%sil
+  801139:	75 13                	jne    80114e <strtol+0x25>
+  80113b:	48 83 c7 01          	add    $0x1,%rdi
+  80113f:	0f b6 37             	movzbl (%rdi),%esi
+  801142:	40 80 fe 20          	cmp    $0x20,%sil
+  801146:	74 f3                	je     80113b <strtol+0x12>
+  801148:	40 80 fe 09          	cmp    $0x9,%sil
+  80114c:	74 ed                	je     80113b <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  80114e:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  801151:	83 e0 fd             	and    $0xfffffffd,%eax
+  801154:	3c 01                	cmp    $0x1,%al
+  801156:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  80115a:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  801160:	75 0f                	jne    801171 <strtol+0x48>
+  801162:	80 3f 30             	cmpb   $0x30,(%rdi)
+  801165:	74 14                	je     80117b <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  801167:	85 d2                	test   %edx,%edx
+  801169:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80116e:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  801171:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  801176:	4c 63 ca             	movslq %edx,%r9
+  801179:	eb 36                	jmp    8011b1 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  80117b:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  80117f:	74 0f                	je     801190 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  801181:	85 d2                	test   %edx,%edx
+  801183:	75 ec                	jne    801171 <strtol+0x48>
+        s++;
+  801185:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  801189:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  80118e:	eb e1                	jmp    801171 <strtol+0x48>
+        s += 2;
+  801190:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  801194:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  801199:	eb d6                	jmp    801171 <strtol+0x48>
+            dig -= '0';
+  80119b:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  80119e:	44 0f b6 c1          	movzbl %cl,%r8d
+  8011a2:	41 39 d0             	cmp    %edx,%r8d
+  8011a5:	7d 21                	jge    8011c8 <strtol+0x9f>
+        val = val * base + dig;
+  8011a7:	49 0f af c1          	imul   %r9,%rax
+  8011ab:	0f b6 c9             	movzbl %cl,%ecx
+  8011ae:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  8011b1:	48 83 c7 01          	add    $0x1,%rdi
+  8011b5:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  8011b9:	80 f9 39             	cmp    $0x39,%cl
+  8011bc:	76 dd                	jbe    80119b <strtol+0x72>
+        else if (dig - 'a' < 27)
+  8011be:	80 f9 7b             	cmp    $0x7b,%cl
+  8011c1:	77 05                	ja     8011c8 <strtol+0x9f>
+            dig -= 'a' - 10;
+  8011c3:	83 e9 57             	sub    $0x57,%ecx
+  8011c6:	eb d6                	jmp    80119e <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  8011c8:	4d 85 d2             	test   %r10,%r10
+  8011cb:	74 03                	je     8011d0 <strtol+0xa7>
+  8011cd:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  8011d0:	48 89 c2             	mov    %rax,%rdx
+  8011d3:	48 f7 da             	neg    %rdx
+  8011d6:	40 80 fe 2d          	cmp    $0x2d,%sil
+  8011da:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  8011de:	c3                   	ret
+
+00000000008011df <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  8011df:	55                   	push   %rbp
+  8011e0:	48 89 e5             	mov    %rsp,%rbp
+  8011e3:	53                   	push   %rbx
+  8011e4:	48 89 fa             	mov    %rdi,%rdx
+  8011e7:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8011ea:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8011ef:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011f4:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8011f9:	be 00 00 00 00       	mov    $0x0,%esi
+  8011fe:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801204:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  801206:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80120a:	c9                   	leave
+  80120b:	c3                   	ret
+
+000000000080120c <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  80120c:	55                   	push   %rbp
+  80120d:	48 89 e5             	mov    %rsp,%rbp
+  801210:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801211:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801216:	ba 00 00 00 00       	mov    $0x0,%edx
+  80121b:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801220:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801225:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80122a:	be 00 00 00 00       	mov    $0x0,%esi
+  80122f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801235:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  801237:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80123b:	c9                   	leave
+  80123c:	c3                   	ret
+
+000000000080123d <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  80123d:	55                   	push   %rbp
+  80123e:	48 89 e5             	mov    %rsp,%rbp
+  801241:	53                   	push   %rbx
+  801242:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  801246:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801249:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80124e:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801253:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801258:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80125d:	be 00 00 00 00       	mov    $0x0,%esi
+  801262:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801268:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80126a:	48 85 c0             	test   %rax,%rax
+  80126d:	7f 06                	jg     801275 <sys_env_destroy+0x38>
+}
+  80126f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801273:	c9                   	leave
+  801274:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801275:	49 89 c0             	mov    %rax,%r8
+  801278:	b9 03 00 00 00       	mov    $0x3,%ecx
+  80127d:	48 ba 30 41 80 00 00 	movabs $0x804130,%rdx
+  801284:	00 00 00 
+  801287:	be 26 00 00 00       	mov    $0x26,%esi
+  80128c:	48 bf 4f 41 80 00 00 	movabs $0x80414f,%rdi
+  801293:	00 00 00 
+  801296:	b8 00 00 00 00       	mov    $0x0,%eax
+  80129b:	49 b9 43 03 80 00 00 	movabs $0x800343,%r9
+  8012a2:	00 00 00 
+  8012a5:	41 ff d1             	call   *%r9
+
+00000000008012a8 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  8012a8:	55                   	push   %rbp
+  8012a9:	48 89 e5             	mov    %rsp,%rbp
+  8012ac:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8012ad:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8012b2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012b7:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8012bc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012c1:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012c6:	be 00 00 00 00       	mov    $0x0,%esi
+  8012cb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8012d1:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  8012d3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012d7:	c9                   	leave
+  8012d8:	c3                   	ret
+
+00000000008012d9 <sys_yield>:
+
+void
+sys_yield(void) {
+  8012d9:	55                   	push   %rbp
+  8012da:	48 89 e5             	mov    %rsp,%rbp
+  8012dd:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8012de:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8012e3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012e8:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8012ed:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012f2:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012f7:	be 00 00 00 00       	mov    $0x0,%esi
+  8012fc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801302:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  801304:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801308:	c9                   	leave
+  801309:	c3                   	ret
+
+000000000080130a <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  80130a:	55                   	push   %rbp
+  80130b:	48 89 e5             	mov    %rsp,%rbp
+  80130e:	53                   	push   %rbx
+  80130f:	48 89 fa             	mov    %rdi,%rdx
+  801312:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801315:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80131a:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  801321:	00 00 00 
+  801324:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801329:	be 00 00 00 00       	mov    $0x0,%esi
+  80132e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801334:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  801336:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80133a:	c9                   	leave
+  80133b:	c3                   	ret
+
+000000000080133c <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  80133c:	55                   	push   %rbp
+  80133d:	48 89 e5             	mov    %rsp,%rbp
+  801340:	53                   	push   %rbx
+  801341:	49 89 f8             	mov    %rdi,%r8
+  801344:	48 89 d3             	mov    %rdx,%rbx
+  801347:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80134a:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80134f:	4c 89 c2             	mov    %r8,%rdx
+  801352:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801355:	be 00 00 00 00       	mov    $0x0,%esi
+  80135a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801360:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  801362:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801366:	c9                   	leave
+  801367:	c3                   	ret
+
+0000000000801368 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  801368:	55                   	push   %rbp
+  801369:	48 89 e5             	mov    %rsp,%rbp
+  80136c:	53                   	push   %rbx
+  80136d:	48 83 ec 08          	sub    $0x8,%rsp
+  801371:	89 f8                	mov    %edi,%eax
+  801373:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  801376:	48 63 f9             	movslq %ecx,%rdi
+  801379:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80137c:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801381:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801384:	be 00 00 00 00       	mov    $0x0,%esi
+  801389:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80138f:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801391:	48 85 c0             	test   %rax,%rax
+  801394:	7f 06                	jg     80139c <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  801396:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80139a:	c9                   	leave
+  80139b:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80139c:	49 89 c0             	mov    %rax,%r8
+  80139f:	b9 04 00 00 00       	mov    $0x4,%ecx
+  8013a4:	48 ba 30 41 80 00 00 	movabs $0x804130,%rdx
+  8013ab:	00 00 00 
+  8013ae:	be 26 00 00 00       	mov    $0x26,%esi
+  8013b3:	48 bf 4f 41 80 00 00 	movabs $0x80414f,%rdi
+  8013ba:	00 00 00 
+  8013bd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013c2:	49 b9 43 03 80 00 00 	movabs $0x800343,%r9
+  8013c9:	00 00 00 
+  8013cc:	41 ff d1             	call   *%r9
+
+00000000008013cf <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8013cf:	55                   	push   %rbp
+  8013d0:	48 89 e5             	mov    %rsp,%rbp
+  8013d3:	53                   	push   %rbx
+  8013d4:	48 83 ec 08          	sub    $0x8,%rsp
+  8013d8:	89 f8                	mov    %edi,%eax
+  8013da:	49 89 f2             	mov    %rsi,%r10
+  8013dd:	48 89 cf             	mov    %rcx,%rdi
+  8013e0:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  8013e3:	48 63 da             	movslq %edx,%rbx
+  8013e6:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8013e9:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8013ee:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013f1:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  8013f4:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8013f6:	48 85 c0             	test   %rax,%rax
+  8013f9:	7f 06                	jg     801401 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8013fb:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013ff:	c9                   	leave
+  801400:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801401:	49 89 c0             	mov    %rax,%r8
+  801404:	b9 05 00 00 00       	mov    $0x5,%ecx
+  801409:	48 ba 30 41 80 00 00 	movabs $0x804130,%rdx
+  801410:	00 00 00 
+  801413:	be 26 00 00 00       	mov    $0x26,%esi
+  801418:	48 bf 4f 41 80 00 00 	movabs $0x80414f,%rdi
+  80141f:	00 00 00 
+  801422:	b8 00 00 00 00       	mov    $0x0,%eax
+  801427:	49 b9 43 03 80 00 00 	movabs $0x800343,%r9
+  80142e:	00 00 00 
+  801431:	41 ff d1             	call   *%r9
+
+0000000000801434 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  801434:	55                   	push   %rbp
+  801435:	48 89 e5             	mov    %rsp,%rbp
+  801438:	53                   	push   %rbx
+  801439:	48 83 ec 08          	sub    $0x8,%rsp
+  80143d:	48 89 f1             	mov    %rsi,%rcx
+  801440:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  801443:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801446:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80144b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801450:	be 00 00 00 00       	mov    $0x0,%esi
+  801455:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80145b:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80145d:	48 85 c0             	test   %rax,%rax
+  801460:	7f 06                	jg     801468 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  801462:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801466:	c9                   	leave
+  801467:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801468:	49 89 c0             	mov    %rax,%r8
+  80146b:	b9 06 00 00 00       	mov    $0x6,%ecx
+  801470:	48 ba 30 41 80 00 00 	movabs $0x804130,%rdx
+  801477:	00 00 00 
+  80147a:	be 26 00 00 00       	mov    $0x26,%esi
+  80147f:	48 bf 4f 41 80 00 00 	movabs $0x80414f,%rdi
+  801486:	00 00 00 
+  801489:	b8 00 00 00 00       	mov    $0x0,%eax
+  80148e:	49 b9 43 03 80 00 00 	movabs $0x800343,%r9
+  801495:	00 00 00 
+  801498:	41 ff d1             	call   *%r9
+
+000000000080149b <sys_region_batch>:
+
+int
+sys_region_batch(const struct RegionOp *ops, size_t count) {
+  80149b:	55                   	push   %rbp
+  80149c:	48 89 e5             	mov    %rsp,%rbp
+  80149f:	53                   	push   %rbx
+  8014a0:	48 83 ec 08          	sub    $0x8,%rsp
+  8014a4:	48 89 fa             	mov    %rdi,%rdx
+  8014a7:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8014aa:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8014af:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014b4:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014b9:	be 00 00 00 00       	mov    $0x0,%esi
+  8014be:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014c4:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8014c6:	48 85 c0             	test   %rax,%rax
+  8014c9:	7f 06                	jg     8014d1 <sys_region_batch+0x36>
+        else
+            platform_asan_unpoison(va, ops[i].size);
+    }
+#endif
+    return res;
+}
+  8014cb:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014cf:	c9                   	leave
+  8014d0:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8014d1:	49 89 c0             	mov    %rax,%r8
+  8014d4:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  8014d9:	48 ba 30 41 80 00 00 	movabs $0x804130,%rdx
+  8014e0:	00 00 00 
+  8014e3:	be 26 00 00 00       	mov    $0x26,%esi
+  8014e8:	48 bf 4f 41 80 00 00 	movabs $0x80414f,%rdi
+  8014ef:	00 00 00 
+  8014f2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014f7:	49 b9 43 03 80 00 00 	movabs $0x800343,%r9
+  8014fe:	00 00 00 
+  801501:	41 ff d1             	call   *%r9
+
+0000000000801504 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  801504:	55                   	push   %rbp
+  801505:	48 89 e5             	mov    %rsp,%rbp
+  801508:	53                   	push   %rbx
+  801509:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  80150d:	48 63 ce             	movslq %esi,%rcx
+  801510:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801513:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801518:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80151d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801522:	be 00 00 00 00       	mov    $0x0,%esi
+  801527:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80152d:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80152f:	48 85 c0             	test   %rax,%rax
+  801532:	7f 06                	jg     80153a <sys_env_set_status+0x36>
+}
+  801534:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801538:	c9                   	leave
+  801539:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80153a:	49 89 c0             	mov    %rax,%r8
+  80153d:	b9 09 00 00 00       	mov    $0x9,%ecx
+  801542:	48 ba 30 41 80 00 00 	movabs $0x804130,%rdx
+  801549:	00 00 00 
+  80154c:	be 26 00 00 00       	mov    $0x26,%esi
+  801551:	48 bf 4f 41 80 00 00 	movabs $0x80414f,%rdi
+  801558:	00 00 00 
+  80155b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801560:	49 b9 43 03 80 00 00 	movabs $0x800343,%r9
+  801567:	00 00 00 
+  80156a:	41 ff d1             	call   *%r9
+
+000000000080156d <sys_env_set_weight>:
+
+int
+sys_env_set_weight(envid_t envid, uint32_t weight) {
+  80156d:	55                   	push   %rbp
+  80156e:	48 89 e5             	mov    %rsp,%rbp
+  801571:	53                   	push   %rbx
+  801572:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_weight, 1, envid, weight, 0, 0, 0, 0);
+  801576:	89 f1                	mov    %esi,%ecx
+  801578:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80157b:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801580:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801585:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80158a:	be 00 00 00 00       	mov    $0x0,%esi
+  80158f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801595:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801597:	48 85 c0             	test   %rax,%rax
+  80159a:	7f 06                	jg     8015a2 <sys_env_set_weight+0x35>
+}
+  80159c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015a0:	c9                   	leave
+  8015a1:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8015a2:	49 89 c0             	mov    %rax,%r8
+  8015a5:	b9 10 00 00 00       	mov    $0x10,%ecx
+  8015aa:	48 ba 30 41 80 00 00 	movabs $0x804130,%rdx
+  8015b1:	00 00 00 
+  8015b4:	be 26 00 00 00       	mov    $0x26,%esi
+  8015b9:	48 bf 4f 41 80 00 00 	movabs $0x80414f,%rdi
+  8015c0:	00 00 00 
+  8015c3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015c8:	49 b9 43 03 80 00 00 	movabs $0x800343,%r9
+  8015cf:	00 00 00 
+  8015d2:	41 ff d1             	call   *%r9
+
+00000000008015d5 <sys_env_set_rt>:
+
+int
+sys_env_set_rt(envid_t envid, uint64_t period, uint64_t budget, uint64_t deadline) {
+  8015d5:	55                   	push   %rbp
+  8015d6:	48 89 e5             	mov    %rsp,%rbp
+  8015d9:	53                   	push   %rbx
+  8015da:	48 83 ec 08          	sub    $0x8,%rsp
+  8015de:	89 f8                	mov    %edi,%eax
+  8015e0:	48 89 d3             	mov    %rdx,%rbx
+  8015e3:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_env_set_rt, 1, envid, period, budget, deadline, 0, 0);
+  8015e6:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8015e9:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8015ee:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015f1:	be 00 00 00 00       	mov    $0x0,%esi
+  8015f6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015fc:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8015fe:	48 85 c0             	test   %rax,%rax
+  801601:	7f 06                	jg     801609 <sys_env_set_rt+0x34>
+}
+  801603:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801607:	c9                   	leave
+  801608:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801609:	49 89 c0             	mov    %rax,%r8
+  80160c:	b9 11 00 00 00       	mov    $0x11,%ecx
+  801611:	48 ba 30 41 80 00 00 	movabs $0x804130,%rdx
+  801618:	00 00 00 
+  80161b:	be 26 00 00 00       	mov    $0x26,%esi
+  801620:	48 bf 4f 41 80 00 00 	movabs $0x80414f,%rdi
+  801627:	00 00 00 
+  80162a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80162f:	49 b9 43 03 80 00 00 	movabs $0x800343,%r9
+  801636:	00 00 00 
+  801639:	41 ff d1             	call   *%r9
+
+000000000080163c <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  80163c:	55                   	push   %rbp
+  80163d:	48 89 e5             	mov    %rsp,%rbp
+  801640:	53                   	push   %rbx
+  801641:	48 83 ec 08          	sub    $0x8,%rsp
+  801645:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  801648:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80164b:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801650:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801655:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80165a:	be 00 00 00 00       	mov    $0x0,%esi
+  80165f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801665:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801667:	48 85 c0             	test   %rax,%rax
+  80166a:	7f 06                	jg     801672 <sys_env_set_trapframe+0x36>
+}
+  80166c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801670:	c9                   	leave
+  801671:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801672:	49 89 c0             	mov    %rax,%r8
+  801675:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  80167a:	48 ba 30 41 80 00 00 	movabs $0x804130,%rdx
+  801681:	00 00 00 
+  801684:	be 26 00 00 00       	mov    $0x26,%esi
+  801689:	48 bf 4f 41 80 00 00 	movabs $0x80414f,%rdi
+  801690:	00 00 00 
+  801693:	b8 00 00 00 00       	mov    $0x0,%eax
+  801698:	49 b9 43 03 80 00 00 	movabs $0x800343,%r9
+  80169f:	00 00 00 
+  8016a2:	41 ff d1             	call   *%r9
+
+00000000008016a5 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  8016a5:	55                   	push   %rbp
+  8016a6:	48 89 e5             	mov    %rsp,%rbp
+  8016a9:	53                   	push   %rbx
+  8016aa:	48 83 ec 08          	sub    $0x8,%rsp
+  8016ae:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  8016b1:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8016b4:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8016b9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016be:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8016c3:	be 00 00 00 00       	mov    $0x0,%esi
+  8016c8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8016ce:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8016d0:	48 85 c0             	test   %rax,%rax
+  8016d3:	7f 06                	jg     8016db <sys_env_set_pgfault_upcall+0x36>
+}
+  8016d5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8016d9:	c9                   	leave
+  8016da:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8016db:	49 89 c0             	mov    %rax,%r8
+  8016de:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  8016e3:	48 ba 30 41 80 00 00 	movabs $0x804130,%rdx
+  8016ea:	00 00 00 
+  8016ed:	be 26 00 00 00       	mov    $0x26,%esi
+  8016f2:	48 bf 4f 41 80 00 00 	movabs $0x80414f,%rdi
+  8016f9:	00 00 00 
+  8016fc:	b8 00 00 00 00       	mov    $0x0,%eax
+  801701:	49 b9 43 03 80 00 00 	movabs $0x800343,%r9
+  801708:	00 00 00 
+  80170b:	41 ff d1             	call   *%r9
+
+000000000080170e <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  80170e:	55                   	push   %rbp
+  80170f:	48 89 e5             	mov    %rsp,%rbp
+  801712:	53                   	push   %rbx
+  801713:	89 f8                	mov    %edi,%eax
+  801715:	49 89 f1             	mov    %rsi,%r9
+  801718:	48 89 d3             	mov    %rdx,%rbx
+  80171b:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  80171e:	49 63 f0             	movslq %r8d,%rsi
+  801721:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801724:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801729:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80172c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801732:	cd 30                	int    $0x30
+}
+  801734:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801738:	c9                   	leave
+  801739:	c3                   	ret
+
+000000000080173a <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  80173a:	55                   	push   %rbp
+  80173b:	48 89 e5             	mov    %rsp,%rbp
+  80173e:	53                   	push   %rbx
+  80173f:	48 83 ec 08          	sub    $0x8,%rsp
+  801743:	48 89 fa             	mov    %rdi,%rdx
+  801746:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801749:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80174e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801753:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801758:	be 00 00 00 00       	mov    $0x0,%esi
+  80175d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801763:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801765:	48 85 c0             	test   %rax,%rax
+  801768:	7f 06                	jg     801770 <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  80176a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80176e:	c9                   	leave
+  80176f:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801770:	49 89 c0             	mov    %rax,%r8
+  801773:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  801778:	48 ba 30 41 80 00 00 	movabs $0x804130,%rdx
+  80177f:	00 00 00 
+  801782:	be 26 00 00 00       	mov    $0x26,%esi
+  801787:	48 bf 4f 41 80 00 00 	movabs $0x80414f,%rdi
+  80178e:	00 00 00 
+  801791:	b8 00 00 00 00       	mov    $0x0,%eax
+  801796:	49 b9 43 03 80 00 00 	movabs $0x800343,%r9
+  80179d:	00 00 00 
+  8017a0:	41 ff d1             	call   *%r9
+
+00000000008017a3 <fork>:
+ * Hint:
+ *   Use sys_map_region, it can perform address space copying in one call
+ *   Remember to fix "thisenv" in the child process.
+ */
+envid_t
+fork(void) {
+  8017a3:	55                   	push   %rbp
+  8017a4:	48 89 e5             	mov    %rsp,%rbp
+  8017a7:	41 55                	push   %r13
+  8017a9:	41 54                	push   %r12
+  8017ab:	53                   	push   %rbx
+  8017ac:	48 83 ec 08          	sub    $0x8,%rsp
+
+/* This must be inlined. Exercise for reader: why? */
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+    envid_t ret;
+    asm volatile("int %2"
+  8017b0:	b8 08 00 00 00       	mov    $0x8,%eax
+  8017b5:	cd 30                	int    $0x30
+  8017b7:	41 89 c5             	mov    %eax,%r13d
+    // LAB 9: Your code here
+
+    envid_t child_id = sys_exofork();
+    if (child_id < 0) {
+  8017ba:	85 c0                	test   %eax,%eax
+  8017bc:	0f 88 ae 00 00 00    	js     801870 <fork+0xcd>
+  8017c2:	89 c3                	mov    %eax,%ebx
+        return child_id;
+    }
+    if (child_id == 0) {
+  8017c4:	0f 84 b4 00 00 00    	je     80187e <fork+0xdb>
+        thisenv = &envs[ENVX(sys_getenvid())];
+        return 0;
+    }
+    int res = sys_map_region(0, NULL, child_id, NULL, MAX_USER_ADDRESS, PROT_ALL | PROT_LAZY | PROT_COMBINE);
+  8017ca:	41 b9 df 01 00 00    	mov    $0x1df,%r9d
+  8017d0:	49 b8 00 00 00 00 80 	movabs $0x8000000000,%r8
+  8017d7:	00 00 00 
+  8017da:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8017df:	89 c2                	mov    %eax,%edx
+  8017e1:	be 00 00 00 00       	mov    $0x0,%esi
+  8017e6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8017eb:	48 b8 cf 13 80 00 00 	movabs $0x8013cf,%rax
+  8017f2:	00 00 00 
+  8017f5:	ff d0                	call   *%rax
+  8017f7:	41 89 c4             	mov    %eax,%r12d
+    if (res < 0) {
+  8017fa:	85 c0                	test   %eax,%eax
+  8017fc:	78 5d                	js     80185b <fork+0xb8>
+        goto error;
+    }
+    res = sys_env_set_pgfault_upcall(child_id, envs[ENVX(sys_getenvid())].env_pgfault_upcall);
+  8017fe:	48 b8 a8 12 80 00 00 	movabs $0x8012a8,%rax
+  801805:	00 00 00 
+  801808:	ff d0                	call   *%rax
+  80180a:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80180f:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+  801816:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  80181d:	00 00 00 
+  801820:	48 01 d0             	add    %rdx,%rax
+  801823:	48 8b b0 88 01 00 00 	mov    0x188(%rax),%rsi
+  80182a:	44 89 ef             	mov    %r13d,%edi
+  80182d:	48 b8 a5 16 80 00 00 	movabs $0x8016a5,%rax
+  801834:	00 00 00 
+  801837:	ff d0                	call   *%rax
+  801839:	41 89 c4             	mov    %eax,%r12d
+    if (res < 0) {
+  80183c:	85 c0                	test   %eax,%eax
+  80183e:	78 1b                	js     80185b <fork+0xb8>
+        goto error;
+    }
+    res = sys_env_set_status(child_id, ENV_RUNNABLE);
+  801840:	be 02 00 00 00       	mov    $0x2,%esi
+  801845:	44 89 ef             	mov    %r13d,%edi
+  801848:	48 b8 04 15 80 00 00 	movabs $0x801504,%rax
+  80184f:	00 00 00 
+  801852:	ff d0                	call   *%rax
+  801854:	41 89 c4             	mov    %eax,%r12d
+    if (res < 0) {
+  801857:	85 c0                	test   %eax,%eax
+  801859:	79 15                	jns    801870 <fork+0xcd>
+        goto error;
+    }
+    return child_id;
+error:
+    ;
+    int res2 = sys_env_destroy(child_id);
+  80185b:	89 df                	mov    %ebx,%edi
+  80185d:	48 b8 3d 12 80 00 00 	movabs $0x80123d,%rax
+  801864:	00 00 00 
+  801867:	ff d0                	call   *%rax
+    if (res2 < 0) {
+  801869:	85 c0                	test   %eax,%eax
+  80186b:	78 42                	js     8018af <fork+0x10c>
+        panic("Fork double fault");
+    }
+    return res;
+  80186d:	45 89 e5             	mov    %r12d,%r13d
+}
+  801870:	44 89 e8             	mov    %r13d,%eax
+  801873:	48 83 c4 08          	add    $0x8,%rsp
+  801877:	5b                   	pop    %rbx
+  801878:	41 5c                	pop    %r12
+  80187a:	41 5d                	pop    %r13
+  80187c:	5d                   	pop    %rbp
+  80187d:	c3                   	ret
+        thisenv = &envs[ENVX(sys_getenvid())];
+  80187e:	48 b8 a8 12 80 00 00 	movabs $0x8012a8,%rax
+  801885:	00 00 00 
+  801888:	ff d0                	call   *%rax
+  80188a:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80188f:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+  801896:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  80189d:	00 00 00 
+  8018a0:	48 01 d0             	add    %rdx,%rax
+  8018a3:	48 a3 00 60 80 00 00 	movabs %rax,0x806000
+  8018aa:	00 00 00 
+        return 0;
+  8018ad:	eb c1                	jmp    801870 <fork+0xcd>
+        panic("Fork double fault");
+  8018af:	48 ba 5d 41 80 00 00 	movabs $0x80415d,%rdx
+  8018b6:	00 00 00 
+  8018b9:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8018be:	48 bf 6f 41 80 00 00 	movabs $0x80416f,%rdi
+  8018c5:	00 00 00 
+  8018c8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018cd:	48 b9 43 03 80 00 00 	movabs $0x800343,%rcx
+  8018d4:	00 00 00 
+  8018d7:	ff d1                	call   *%rcx
+
+00000000008018d9 <sfork>:
+
+envid_t
+sfork() {
+  8018d9:	55                   	push   %rbp
+  8018da:	48 89 e5             	mov    %rsp,%rbp
+    panic("sfork() is not implemented");
+  8018dd:	48 ba 7a 41 80 00 00 	movabs $0x80417a,%rdx
+  8018e4:	00 00 00 
+  8018e7:	be 36 00 00 00       	mov    $0x36,%esi
+  8018ec:	48 bf 6f 41 80 00 00 	movabs $0x80416f,%rdi
+  8018f3:	00 00 00 
+  8018f6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018fb:	48 b9 43 03 80 00 00 	movabs $0x800343,%rcx
+  801902:	00 00 00 
+  801905:	ff d1                	call   *%rcx
+
+0000000000801907 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801907:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  80190e:	ff ff ff 
+  801911:	48 01 f8             	add    %rdi,%rax
+  801914:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  801918:	c3                   	ret
+
+0000000000801919 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801919:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801920:	ff ff ff 
+  801923:	48 01 f8             	add    %rdi,%rax
+  801926:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  80192a:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  801930:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  801934:	c3                   	ret
+
+0000000000801935 <fd_alloc_from>:
+}
+
+/* Like fd_alloc(), but only considers fds starting from fdnum,
+ * so that several fds can be found before their pages are allocated */
+int
+fd_alloc_from(int fdnum, struct Fd **fd_store) {
+  801935:	55                   	push   %rbp
+  801936:	48 89 e5             	mov    %rsp,%rbp
+  801939:	41 57                	push   %r15
+  80193b:	41 56                	push   %r14
+  80193d:	41 55                	push   %r13
+  80193f:	41 54                	push   %r12
+  801941:	53                   	push   %rbx
+  801942:	48 83 ec 08          	sub    $0x8,%rsp
+  801946:	49 89 f7             	mov    %rsi,%r15
+    for (int i = MAX(fdnum, 0); i < MAXFD; i++) {
+  801949:	85 ff                	test   %edi,%edi
+  80194b:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  801951:	44 0f 49 e7          	cmovns %edi,%r12d
+  801955:	83 ff 1f             	cmp    $0x1f,%edi
+  801958:	7f 37                	jg     801991 <fd_alloc_from+0x5c>
+  80195a:	49 63 dc             	movslq %r12d,%rbx
+  80195d:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  801964:	48 c1 e3 0c          	shl    $0xc,%rbx
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  801968:	49 be 07 35 80 00 00 	movabs $0x803507,%r14
+  80196f:	00 00 00 
+        struct Fd *fd = INDEX2FD(i);
+  801972:	49 89 dd             	mov    %rbx,%r13
+        if (!(get_prot(fd) & PROT_R)) {
+  801975:	48 89 df             	mov    %rbx,%rdi
+  801978:	41 ff d6             	call   *%r14
+  80197b:	83 e0 04             	and    $0x4,%eax
+  80197e:	74 1c                	je     80199c <fd_alloc_from+0x67>
+    for (int i = MAX(fdnum, 0); i < MAXFD; i++) {
+  801980:	41 83 c4 01          	add    $0x1,%r12d
+  801984:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  80198b:	41 83 fc 1f          	cmp    $0x1f,%r12d
+  80198f:	7e e1                	jle    801972 <fd_alloc_from+0x3d>
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  801991:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801997:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  80199c:	4d 89 2f             	mov    %r13,(%r15)
+}
+  80199f:	48 83 c4 08          	add    $0x8,%rsp
+  8019a3:	5b                   	pop    %rbx
+  8019a4:	41 5c                	pop    %r12
+  8019a6:	41 5d                	pop    %r13
+  8019a8:	41 5e                	pop    %r14
+  8019aa:	41 5f                	pop    %r15
+  8019ac:	5d                   	pop    %rbp
+  8019ad:	c3                   	ret
+
+00000000008019ae <fd_alloc>:
+fd_alloc(struct Fd **fd_store) {
+  8019ae:	55                   	push   %rbp
+  8019af:	48 89 e5             	mov    %rsp,%rbp
+  8019b2:	48 89 fe             	mov    %rdi,%rsi
+    return fd_alloc_from(0, fd_store);
+  8019b5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8019ba:	48 b8 35 19 80 00 00 	movabs $0x801935,%rax
+  8019c1:	00 00 00 
+  8019c4:	ff d0                	call   *%rax
+}
+  8019c6:	5d                   	pop    %rbp
+  8019c7:	c3                   	ret
+
+00000000008019c8 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  8019c8:	83 ff 1f             	cmp    $0x1f,%edi
+  8019cb:	77 39                	ja     801a06 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  8019cd:	55                   	push   %rbp
+  8019ce:	48 89 e5             	mov    %rsp,%rbp
+  8019d1:	41 54                	push   %r12
+  8019d3:	53                   	push   %rbx
+  8019d4:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  8019d7:	48 63 df             	movslq %edi,%rbx
+  8019da:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  8019e1:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  8019e5:	48 89 df             	mov    %rbx,%rdi
+  8019e8:	48 b8 07 35 80 00 00 	movabs $0x803507,%rax
+  8019ef:	00 00 00 
+  8019f2:	ff d0                	call   *%rax
+  8019f4:	a8 04                	test   $0x4,%al
+  8019f6:	74 14                	je     801a0c <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  8019f8:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  8019fc:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801a01:	5b                   	pop    %rbx
+  801a02:	41 5c                	pop    %r12
+  801a04:	5d                   	pop    %rbp
+  801a05:	c3                   	ret
+        return -E_INVAL;
+  801a06:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801a0b:	c3                   	ret
+        return -E_INVAL;
+  801a0c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801a11:	eb ee                	jmp    801a01 <fd_lookup+0x39>
+
+0000000000801a13 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  801a13:	55                   	push   %rbp
+  801a14:	48 89 e5             	mov    %rsp,%rbp
+  801a17:	41 54                	push   %r12
+  801a19:	53                   	push   %rbx
+  801a1a:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  801a1d:	48 b8 20 42 80 00 00 	movabs $0x804220,%rax
+  801a24:	00 00 00 
+  801a27:	48 bb 20 50 80 00 00 	movabs $0x805020,%rbx
+  801a2e:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  801a31:	39 3b                	cmp    %edi,(%rbx)
+  801a33:	74 47                	je     801a7c <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  801a35:	48 83 c0 08          	add    $0x8,%rax
+  801a39:	48 8b 18             	mov    (%rax),%rbx
+  801a3c:	48 85 db             	test   %rbx,%rbx
+  801a3f:	75 f0                	jne    801a31 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801a41:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  801a48:	00 00 00 
+  801a4b:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+  801a51:	89 fa                	mov    %edi,%edx
+  801a53:	48 bf 98 41 80 00 00 	movabs $0x804198,%rdi
+  801a5a:	00 00 00 
+  801a5d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a62:	48 b9 93 04 80 00 00 	movabs $0x800493,%rcx
+  801a69:	00 00 00 
+  801a6c:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  801a6e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  801a73:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  801a77:	5b                   	pop    %rbx
+  801a78:	41 5c                	pop    %r12
+  801a7a:	5d                   	pop    %rbp
+  801a7b:	c3                   	ret
+            return 0;
+  801a7c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a81:	eb f0                	jmp    801a73 <dev_lookup+0x60>
+
+0000000000801a83 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  801a83:	55                   	push   %rbp
+  801a84:	48 89 e5             	mov    %rsp,%rbp
+  801a87:	41 55                	push   %r13
+  801a89:	41 54                	push   %r12
+  801a8b:	53                   	push   %rbx
+  801a8c:	48 83 ec 18          	sub    $0x18,%rsp
+  801a90:	48 89 fb             	mov    %rdi,%rbx
+  801a93:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801a96:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  801a9d:	ff ff ff 
+  801aa0:	48 01 df             	add    %rbx,%rdi
+  801aa3:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  801aa7:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801aab:	48 b8 c8 19 80 00 00 	movabs $0x8019c8,%rax
+  801ab2:	00 00 00 
+  801ab5:	ff d0                	call   *%rax
+  801ab7:	41 89 c5             	mov    %eax,%r13d
+  801aba:	85 c0                	test   %eax,%eax
+  801abc:	78 06                	js     801ac4 <fd_close+0x41>
+  801abe:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  801ac2:	74 1a                	je     801ade <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  801ac4:	45 84 e4             	test   %r12b,%r12b
+  801ac7:	b8 00 00 00 00       	mov    $0x0,%eax
+  801acc:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  801ad0:	44 89 e8             	mov    %r13d,%eax
+  801ad3:	48 83 c4 18          	add    $0x18,%rsp
+  801ad7:	5b                   	pop    %rbx
+  801ad8:	41 5c                	pop    %r12
+  801ada:	41 5d                	pop    %r13
+  801adc:	5d                   	pop    %rbp
+  801add:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801ade:	8b 3b                	mov    (%rbx),%edi
+  801ae0:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801ae4:	48 b8 13 1a 80 00 00 	movabs $0x801a13,%rax
+  801aeb:	00 00 00 
+  801aee:	ff d0                	call   *%rax
+  801af0:	41 89 c5             	mov    %eax,%r13d
+  801af3:	85 c0                	test   %eax,%eax
+  801af5:	78 1b                	js     801b12 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  801af7:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801afb:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801aff:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801b05:	48 85 c0             	test   %rax,%rax
+  801b08:	74 08                	je     801b12 <fd_close+0x8f>
+  801b0a:	48 89 df             	mov    %rbx,%rdi
+  801b0d:	ff d0                	call   *%rax
+  801b0f:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801b12:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801b17:	48 89 de             	mov    %rbx,%rsi
+  801b1a:	bf 00 00 00 00       	mov    $0x0,%edi
+  801b1f:	48 b8 34 14 80 00 00 	movabs $0x801434,%rax
+  801b26:	00 00 00 
+  801b29:	ff d0                	call   *%rax
+    return res;
+  801b2b:	eb a3                	jmp    801ad0 <fd_close+0x4d>
+
+0000000000801b2d <close>:
+
+int
+close(int fdnum) {
+  801b2d:	55                   	push   %rbp
+  801b2e:	48 89 e5             	mov    %rsp,%rbp
+  801b31:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  801b35:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801b39:	48 b8 c8 19 80 00 00 	movabs $0x8019c8,%rax
+  801b40:	00 00 00 
+  801b43:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801b45:	85 c0                	test   %eax,%eax
+  801b47:	78 15                	js     801b5e <close+0x31>
+
+    return fd_close(fd, 1);
+  801b49:	be 01 00 00 00       	mov    $0x1,%esi
+  801b4e:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801b52:	48 b8 83 1a 80 00 00 	movabs $0x801a83,%rax
+  801b59:	00 00 00 
+  801b5c:	ff d0                	call   *%rax
+}
+  801b5e:	c9                   	leave
+  801b5f:	c3                   	ret
+
+0000000000801b60 <close_all>:
+
+void
+close_all(void) {
+  801b60:	55                   	push   %rbp
+  801b61:	48 89 e5             	mov    %rsp,%rbp
+  801b64:	41 54                	push   %r12
+  801b66:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  801b67:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b6c:	49 bc 2d 1b 80 00 00 	movabs $0x801b2d,%r12
+  801b73:	00 00 00 
+  801b76:	89 df                	mov    %ebx,%edi
+  801b78:	41 ff d4             	call   *%r12
+  801b7b:	83 c3 01             	add    $0x1,%ebx
+  801b7e:	83 fb 20             	cmp    $0x20,%ebx
+  801b81:	75 f3                	jne    801b76 <close_all+0x16>
+}
+  801b83:	5b                   	pop    %rbx
+  801b84:	41 5c                	pop    %r12
+  801b86:	5d                   	pop    %rbp
+  801b87:	c3                   	ret
+
+0000000000801b88 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  801b88:	55                   	push   %rbp
+  801b89:	48 89 e5             	mov    %rsp,%rbp
+  801b8c:	41 57                	push   %r15
+  801b8e:	41 56                	push   %r14
+  801b90:	41 55                	push   %r13
+  801b92:	41 54                	push   %r12
+  801b94:	53                   	push   %rbx
+  801b95:	48 83 ec 18          	sub    $0x18,%rsp
+  801b99:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  801b9c:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801ba0:	48 b8 c8 19 80 00 00 	movabs $0x8019c8,%rax
+  801ba7:	00 00 00 
+  801baa:	ff d0                	call   *%rax
+  801bac:	89 c3                	mov    %eax,%ebx
+  801bae:	85 c0                	test   %eax,%eax
+  801bb0:	0f 88 b8 00 00 00    	js     801c6e <dup+0xe6>
+    close(newfdnum);
+  801bb6:	44 89 e7             	mov    %r12d,%edi
+  801bb9:	48 b8 2d 1b 80 00 00 	movabs $0x801b2d,%rax
+  801bc0:	00 00 00 
+  801bc3:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  801bc5:	4d 63 ec             	movslq %r12d,%r13
+  801bc8:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  801bcf:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  801bd3:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  801bd7:	4c 89 ff             	mov    %r15,%rdi
+  801bda:	49 be 19 19 80 00 00 	movabs $0x801919,%r14
+  801be1:	00 00 00 
+  801be4:	41 ff d6             	call   *%r14
+  801be7:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  801bea:	4c 89 ef             	mov    %r13,%rdi
+  801bed:	41 ff d6             	call   *%r14
+  801bf0:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  801bf3:	48 89 df             	mov    %rbx,%rdi
+  801bf6:	48 b8 07 35 80 00 00 	movabs $0x803507,%rax
+  801bfd:	00 00 00 
+  801c00:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  801c02:	a8 04                	test   $0x4,%al
+  801c04:	74 2b                	je     801c31 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  801c06:	41 89 c1             	mov    %eax,%r9d
+  801c09:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801c0f:	4c 89 f1             	mov    %r14,%rcx
+  801c12:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c17:	48 89 de             	mov    %rbx,%rsi
+  801c1a:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c1f:	48 b8 cf 13 80 00 00 	movabs $0x8013cf,%rax
+  801c26:	00 00 00 
+  801c29:	ff d0                	call   *%rax
+  801c2b:	89 c3                	mov    %eax,%ebx
+  801c2d:	85 c0                	test   %eax,%eax
+  801c2f:	78 4e                	js     801c7f <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  801c31:	4c 89 ff             	mov    %r15,%rdi
+  801c34:	48 b8 07 35 80 00 00 	movabs $0x803507,%rax
+  801c3b:	00 00 00 
+  801c3e:	ff d0                	call   *%rax
+  801c40:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801c43:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801c49:	4c 89 e9             	mov    %r13,%rcx
+  801c4c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c51:	4c 89 fe             	mov    %r15,%rsi
+  801c54:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c59:	48 b8 cf 13 80 00 00 	movabs $0x8013cf,%rax
+  801c60:	00 00 00 
+  801c63:	ff d0                	call   *%rax
+  801c65:	89 c3                	mov    %eax,%ebx
+  801c67:	85 c0                	test   %eax,%eax
+  801c69:	78 14                	js     801c7f <dup+0xf7>
+
+    return newfdnum;
+  801c6b:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  801c6e:	89 d8                	mov    %ebx,%eax
+  801c70:	48 83 c4 18          	add    $0x18,%rsp
+  801c74:	5b                   	pop    %rbx
+  801c75:	41 5c                	pop    %r12
+  801c77:	41 5d                	pop    %r13
+  801c79:	41 5e                	pop    %r14
+  801c7b:	41 5f                	pop    %r15
+  801c7d:	5d                   	pop    %rbp
+  801c7e:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  801c7f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801c84:	4c 89 ee             	mov    %r13,%rsi
+  801c87:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c8c:	49 bc 34 14 80 00 00 	movabs $0x801434,%r12
+  801c93:	00 00 00 
+  801c96:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  801c99:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801c9e:	4c 89 f6             	mov    %r14,%rsi
+  801ca1:	bf 00 00 00 00       	mov    $0x0,%edi
+  801ca6:	41 ff d4             	call   *%r12
+    return res;
+  801ca9:	eb c3                	jmp    801c6e <dup+0xe6>
+
+0000000000801cab <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  801cab:	55                   	push   %rbp
+  801cac:	48 89 e5             	mov    %rsp,%rbp
+  801caf:	41 56                	push   %r14
+  801cb1:	41 55                	push   %r13
+  801cb3:	41 54                	push   %r12
+  801cb5:	53                   	push   %rbx
+  801cb6:	48 83 ec 10          	sub    $0x10,%rsp
+  801cba:	89 fb                	mov    %edi,%ebx
+  801cbc:	49 89 f4             	mov    %rsi,%r12
+  801cbf:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801cc2:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801cc6:	48 b8 c8 19 80 00 00 	movabs $0x8019c8,%rax
+  801ccd:	00 00 00 
+  801cd0:	ff d0                	call   *%rax
+  801cd2:	85 c0                	test   %eax,%eax
+  801cd4:	78 4c                	js     801d22 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801cd6:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801cda:	41 8b 3e             	mov    (%r14),%edi
+  801cdd:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801ce1:	48 b8 13 1a 80 00 00 	movabs $0x801a13,%rax
+  801ce8:	00 00 00 
+  801ceb:	ff d0                	call   *%rax
+  801ced:	85 c0                	test   %eax,%eax
+  801cef:	78 35                	js     801d26 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801cf1:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801cf5:	83 e0 03             	and    $0x3,%eax
+  801cf8:	83 f8 01             	cmp    $0x1,%eax
+  801cfb:	74 2d                	je     801d2a <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801cfd:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801d01:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801d05:	48 85 c0             	test   %rax,%rax
+  801d08:	74 56                	je     801d60 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  801d0a:	4c 89 ea             	mov    %r13,%rdx
+  801d0d:	4c 89 e6             	mov    %r12,%rsi
+  801d10:	4c 89 f7             	mov    %r14,%rdi
+  801d13:	ff d0                	call   *%rax
+}
+  801d15:	48 83 c4 10          	add    $0x10,%rsp
+  801d19:	5b                   	pop    %rbx
+  801d1a:	41 5c                	pop    %r12
+  801d1c:	41 5d                	pop    %r13
+  801d1e:	41 5e                	pop    %r14
+  801d20:	5d                   	pop    %rbp
+  801d21:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801d22:	48 98                	cltq
+  801d24:	eb ef                	jmp    801d15 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801d26:	48 98                	cltq
+  801d28:	eb eb                	jmp    801d15 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801d2a:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  801d31:	00 00 00 
+  801d34:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+  801d3a:	89 da                	mov    %ebx,%edx
+  801d3c:	48 bf d9 41 80 00 00 	movabs $0x8041d9,%rdi
+  801d43:	00 00 00 
+  801d46:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d4b:	48 b9 93 04 80 00 00 	movabs $0x800493,%rcx
+  801d52:	00 00 00 
+  801d55:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801d57:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801d5e:	eb b5                	jmp    801d15 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801d60:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801d67:	eb ac                	jmp    801d15 <read+0x6a>
+
+0000000000801d69 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801d69:	55                   	push   %rbp
+  801d6a:	48 89 e5             	mov    %rsp,%rbp
+  801d6d:	41 57                	push   %r15
+  801d6f:	41 56                	push   %r14
+  801d71:	41 55                	push   %r13
+  801d73:	41 54                	push   %r12
+  801d75:	53                   	push   %rbx
+  801d76:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  801d7a:	48 85 d2             	test   %rdx,%rdx
+  801d7d:	74 54                	je     801dd3 <readn+0x6a>
+  801d7f:	41 89 fd             	mov    %edi,%r13d
+  801d82:	49 89 f6             	mov    %rsi,%r14
+  801d85:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  801d88:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  801d8d:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  801d92:	49 bf ab 1c 80 00 00 	movabs $0x801cab,%r15
+  801d99:	00 00 00 
+  801d9c:	4c 89 e2             	mov    %r12,%rdx
+  801d9f:	48 29 f2             	sub    %rsi,%rdx
+  801da2:	4c 01 f6             	add    %r14,%rsi
+  801da5:	44 89 ef             	mov    %r13d,%edi
+  801da8:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  801dab:	85 c0                	test   %eax,%eax
+  801dad:	78 20                	js     801dcf <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  801daf:	01 c3                	add    %eax,%ebx
+  801db1:	85 c0                	test   %eax,%eax
+  801db3:	74 08                	je     801dbd <readn+0x54>
+  801db5:	48 63 f3             	movslq %ebx,%rsi
+  801db8:	4c 39 e6             	cmp    %r12,%rsi
+  801dbb:	72 df                	jb     801d9c <readn+0x33>
+    }
+    return res;
+  801dbd:	48 63 c3             	movslq %ebx,%rax
+}
+  801dc0:	48 83 c4 08          	add    $0x8,%rsp
+  801dc4:	5b                   	pop    %rbx
+  801dc5:	41 5c                	pop    %r12
+  801dc7:	41 5d                	pop    %r13
+  801dc9:	41 5e                	pop    %r14
+  801dcb:	41 5f                	pop    %r15
+  801dcd:	5d                   	pop    %rbp
+  801dce:	c3                   	ret
+        if (inc < 0) return inc;
+  801dcf:	48 98                	cltq
+  801dd1:	eb ed                	jmp    801dc0 <readn+0x57>
+    int inc = 1, res = 0;
+  801dd3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801dd8:	eb e3                	jmp    801dbd <readn+0x54>
+
+0000000000801dda <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  801dda:	55                   	push   %rbp
+  801ddb:	48 89 e5             	mov    %rsp,%rbp
+  801dde:	41 56                	push   %r14
+  801de0:	41 55                	push   %r13
+  801de2:	41 54                	push   %r12
+  801de4:	53                   	push   %rbx
+  801de5:	48 83 ec 10          	sub    $0x10,%rsp
+  801de9:	89 fb                	mov    %edi,%ebx
+  801deb:	49 89 f4             	mov    %rsi,%r12
+  801dee:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801df1:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801df5:	48 b8 c8 19 80 00 00 	movabs $0x8019c8,%rax
+  801dfc:	00 00 00 
+  801dff:	ff d0                	call   *%rax
+  801e01:	85 c0                	test   %eax,%eax
+  801e03:	78 47                	js     801e4c <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801e05:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801e09:	41 8b 3e             	mov    (%r14),%edi
+  801e0c:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801e10:	48 b8 13 1a 80 00 00 	movabs $0x801a13,%rax
+  801e17:	00 00 00 
+  801e1a:	ff d0                	call   *%rax
+  801e1c:	85 c0                	test   %eax,%eax
+  801e1e:	78 30                	js     801e50 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801e20:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  801e25:	74 2d                	je     801e54 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801e27:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801e2b:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801e2f:	48 85 c0             	test   %rax,%rax
+  801e32:	74 56                	je     801e8a <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  801e34:	4c 89 ea             	mov    %r13,%rdx
+  801e37:	4c 89 e6             	mov    %r12,%rsi
+  801e3a:	4c 89 f7             	mov    %r14,%rdi
+  801e3d:	ff d0                	call   *%rax
+}
+  801e3f:	48 83 c4 10          	add    $0x10,%rsp
+  801e43:	5b                   	pop    %rbx
+  801e44:	41 5c                	pop    %r12
+  801e46:	41 5d                	pop    %r13
+  801e48:	41 5e                	pop    %r14
+  801e4a:	5d                   	pop    %rbp
+  801e4b:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801e4c:	48 98                	cltq
+  801e4e:	eb ef                	jmp    801e3f <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801e50:	48 98                	cltq
+  801e52:	eb eb                	jmp    801e3f <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801e54:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  801e5b:	00 00 00 
+  801e5e:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+  801e64:	89 da                	mov    %ebx,%edx
+  801e66:	48 bf f5 41 80 00 00 	movabs $0x8041f5,%rdi
+  801e6d:	00 00 00 
+  801e70:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e75:	48 b9 93 04 80 00 00 	movabs $0x800493,%rcx
+  801e7c:	00 00 00 
+  801e7f:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801e81:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801e88:	eb b5                	jmp    801e3f <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801e8a:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801e91:	eb ac                	jmp    801e3f <write+0x65>
+
+0000000000801e93 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  801e93:	55                   	push   %rbp
+  801e94:	48 89 e5             	mov    %rsp,%rbp
+  801e97:	53                   	push   %rbx
+  801e98:	48 83 ec 18          	sub    $0x18,%rsp
+  801e9c:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801e9e:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801ea2:	48 b8 c8 19 80 00 00 	movabs $0x8019c8,%rax
+  801ea9:	00 00 00 
+  801eac:	ff d0                	call   *%rax
+  801eae:	85 c0                	test   %eax,%eax
+  801eb0:	78 0c                	js     801ebe <seek+0x2b>
+
+    fd->fd_offset = offset;
+  801eb2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801eb6:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  801eb9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801ebe:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801ec2:	c9                   	leave
+  801ec3:	c3                   	ret
+
+0000000000801ec4 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  801ec4:	55                   	push   %rbp
+  801ec5:	48 89 e5             	mov    %rsp,%rbp
+  801ec8:	41 55                	push   %r13
+  801eca:	41 54                	push   %r12
+  801ecc:	53                   	push   %rbx
+  801ecd:	48 83 ec 18          	sub    $0x18,%rsp
+  801ed1:	89 fb                	mov    %edi,%ebx
+  801ed3:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801ed6:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801eda:	48 b8 c8 19 80 00 00 	movabs $0x8019c8,%rax
+  801ee1:	00 00 00 
+  801ee4:	ff d0                	call   *%rax
+  801ee6:	85 c0                	test   %eax,%eax
+  801ee8:	78 38                	js     801f22 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801eea:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  801eee:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  801ef2:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801ef6:	48 b8 13 1a 80 00 00 	movabs $0x801a13,%rax
+  801efd:	00 00 00 
+  801f00:	ff d0                	call   *%rax
+  801f02:	85 c0                	test   %eax,%eax
+  801f04:	78 1c                	js     801f22 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801f06:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  801f0b:	74 20                	je     801f2d <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801f0d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801f11:	48 8b 40 30          	mov    0x30(%rax),%rax
+  801f15:	48 85 c0             	test   %rax,%rax
+  801f18:	74 47                	je     801f61 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  801f1a:	44 89 e6             	mov    %r12d,%esi
+  801f1d:	4c 89 ef             	mov    %r13,%rdi
+  801f20:	ff d0                	call   *%rax
+}
+  801f22:	48 83 c4 18          	add    $0x18,%rsp
+  801f26:	5b                   	pop    %rbx
+  801f27:	41 5c                	pop    %r12
+  801f29:	41 5d                	pop    %r13
+  801f2b:	5d                   	pop    %rbp
+  801f2c:	c3                   	ret
+                thisenv->env_id, fdnum);
+  801f2d:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  801f34:	00 00 00 
+  801f37:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801f3d:	89 da                	mov    %ebx,%edx
+  801f3f:	48 bf b8 41 80 00 00 	movabs $0x8041b8,%rdi
+  801f46:	00 00 00 
+  801f49:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f4e:	48 b9 93 04 80 00 00 	movabs $0x800493,%rcx
+  801f55:	00 00 00 
+  801f58:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801f5a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801f5f:	eb c1                	jmp    801f22 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801f61:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801f66:	eb ba                	jmp    801f22 <ftruncate+0x5e>
+
+0000000000801f68 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  801f68:	55                   	push   %rbp
+  801f69:	48 89 e5             	mov    %rsp,%rbp
+  801f6c:	41 54                	push   %r12
+  801f6e:	53                   	push   %rbx
+  801f6f:	48 83 ec 10          	sub    $0x10,%rsp
+  801f73:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801f76:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801f7a:	48 b8 c8 19 80 00 00 	movabs $0x8019c8,%rax
+  801f81:	00 00 00 
+  801f84:	ff d0                	call   *%rax
+  801f86:	85 c0                	test   %eax,%eax
+  801f88:	78 4e                	js     801fd8 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801f8a:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801f8e:	41 8b 3c 24          	mov    (%r12),%edi
+  801f92:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801f96:	48 b8 13 1a 80 00 00 	movabs $0x801a13,%rax
+  801f9d:	00 00 00 
+  801fa0:	ff d0                	call   *%rax
+  801fa2:	85 c0                	test   %eax,%eax
+  801fa4:	78 32                	js     801fd8 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801fa6:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801faa:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  801faf:	74 30                	je     801fe1 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  801fb1:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  801fb4:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  801fbb:	00 00 00 
+    stat->st_isdir = 0;
+  801fbe:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  801fc5:	00 00 00 
+    stat->st_dev = dev;
+  801fc8:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  801fcf:	48 89 de             	mov    %rbx,%rsi
+  801fd2:	4c 89 e7             	mov    %r12,%rdi
+  801fd5:	ff 50 28             	call   *0x28(%rax)
+}
+  801fd8:	48 83 c4 10          	add    $0x10,%rsp
+  801fdc:	5b                   	pop    %rbx
+  801fdd:	41 5c                	pop    %r12
+  801fdf:	5d                   	pop    %rbp
+  801fe0:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801fe1:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801fe6:	eb f0                	jmp    801fd8 <fstat+0x70>
+
+0000000000801fe8 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  801fe8:	55                   	push   %rbp
+  801fe9:	48 89 e5             	mov    %rsp,%rbp
+  801fec:	41 54                	push   %r12
+  801fee:	53                   	push   %rbx
+  801fef:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  801ff2:	be 00 00 00 00       	mov    $0x0,%esi
+  801ff7:	48 b8 cb 23 80 00 00 	movabs $0x8023cb,%rax
+  801ffe:	00 00 00 
+  802001:	ff d0                	call   *%rax
+  802003:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  802005:	85 c0                	test   %eax,%eax
+  802007:	78 25                	js     80202e <stat+0x46>
+
+    int res = fstat(fd, stat);
+  802009:	4c 89 e6             	mov    %r12,%rsi
+  80200c:	89 c7                	mov    %eax,%edi
+  80200e:	48 b8 68 1f 80 00 00 	movabs $0x801f68,%rax
+  802015:	00 00 00 
+  802018:	ff d0                	call   *%rax
+  80201a:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  80201d:	89 df                	mov    %ebx,%edi
+  80201f:	48 b8 2d 1b 80 00 00 	movabs $0x801b2d,%rax
+  802026:	00 00 00 
+  802029:	ff d0                	call   *%rax
+
+    return res;
+  80202b:	44 89 e3             	mov    %r12d,%ebx
+}
+  80202e:	89 d8                	mov    %ebx,%eax
+  802030:	5b                   	pop    %rbx
+  802031:	41 5c                	pop    %r12
+  802033:	5d                   	pop    %rbp
+  802034:	c3                   	ret
+
+0000000000802035 <fsipc>:
+ * response may be written back to fsipcbuf.
+ * type: request code, passed as the simple integer IPC value.
+ * dstva: virtual address at which to receive reply page, 0 if none.
+ * Returns result from the file server. */
+static int
+fsipc(unsigned type, void *dstva) {
+  802035:	55                   	push   %rbp
+  802036:	48 89 e5             	mov    %rsp,%rbp
+  802039:	41 54                	push   %r12
+  80203b:	53                   	push   %rbx
+  80203c:	48 83 ec 10          	sub    $0x10,%rsp
+  802040:	41 89 fc             	mov    %edi,%r12d
+  802043:	48 89 f3             	mov    %rsi,%rbx
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802046:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  80204d:	00 00 00 
+  802050:	83 38 00             	cmpl   $0x0,(%rax)
+  802053:	74 5e                	je     8020b3 <fsipc+0x7e>
+    if (debug) {
+        cprintf("[%08x] fsipc %d %08x\n",
+                thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+    }
+
+    ipc_send(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW);
+  802055:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  80205b:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802060:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  802067:	00 00 00 
+  80206a:	44 89 e6             	mov    %r12d,%esi
+  80206d:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  802074:	00 00 00 
+  802077:	8b 38                	mov    (%rax),%edi
+  802079:	48 b8 fb 39 80 00 00 	movabs $0x8039fb,%rax
+  802080:	00 00 00 
+  802083:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  802085:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  80208c:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  80208d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802092:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  802096:	48 89 de             	mov    %rbx,%rsi
+  802099:	bf 00 00 00 00       	mov    $0x0,%edi
+  80209e:	48 b8 26 39 80 00 00 	movabs $0x803926,%rax
+  8020a5:	00 00 00 
+  8020a8:	ff d0                	call   *%rax
+}
+  8020aa:	48 83 c4 10          	add    $0x10,%rsp
+  8020ae:	5b                   	pop    %rbx
+  8020af:	41 5c                	pop    %r12
+  8020b1:	5d                   	pop    %rbp
+  8020b2:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8020b3:	bf 03 00 00 00       	mov    $0x3,%edi
+  8020b8:	48 b8 9e 3a 80 00 00 	movabs $0x803a9e,%rax
+  8020bf:	00 00 00 
+  8020c2:	ff d0                	call   *%rax
+  8020c4:	a3 00 80 80 00 00 00 	movabs %eax,0x808000
+  8020cb:	00 00 
+  8020cd:	eb 86                	jmp    802055 <fsipc+0x20>
+
+00000000008020cf <devfile_trunc>:
+    return 0;
+}
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  8020cf:	55                   	push   %rbp
+  8020d0:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  8020d3:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  8020da:	00 00 00 
+  8020dd:	8b 57 0c             	mov    0xc(%rdi),%edx
+  8020e0:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  8020e2:	89 70 04             	mov    %esi,0x4(%rax)
+
+    return fsipc(FSREQ_SET_SIZE, NULL);
+  8020e5:	be 00 00 00 00       	mov    $0x0,%esi
+  8020ea:	bf 02 00 00 00       	mov    $0x2,%edi
+  8020ef:	48 b8 35 20 80 00 00 	movabs $0x802035,%rax
+  8020f6:	00 00 00 
+  8020f9:	ff d0                	call   *%rax
+}
+  8020fb:	5d                   	pop    %rbp
+  8020fc:	c3                   	ret
+
+00000000008020fd <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  8020fd:	55                   	push   %rbp
+  8020fe:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  802101:	8b 47 0c             	mov    0xc(%rdi),%eax
+  802104:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  80210b:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  80210d:	be 00 00 00 00       	mov    $0x0,%esi
+  802112:	bf 06 00 00 00       	mov    $0x6,%edi
+  802117:	48 b8 35 20 80 00 00 	movabs $0x802035,%rax
+  80211e:	00 00 00 
+  802121:	ff d0                	call   *%rax
+}
+  802123:	5d                   	pop    %rbp
+  802124:	c3                   	ret
+
+0000000000802125 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  802125:	55                   	push   %rbp
+  802126:	48 89 e5             	mov    %rsp,%rbp
+  802129:	41 54                	push   %r12
+  80212b:	53                   	push   %rbx
+  80212c:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  80212f:	8b 47 0c             	mov    0xc(%rdi),%eax
+  802132:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  802139:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  80213b:	be 00 00 00 00       	mov    $0x0,%esi
+  802140:	bf 05 00 00 00       	mov    $0x5,%edi
+  802145:	48 b8 35 20 80 00 00 	movabs $0x802035,%rax
+  80214c:	00 00 00 
+  80214f:	ff d0                	call   *%rax
+    if (res < 0) {
+  802151:	85 c0                	test   %eax,%eax
+  802153:	78 3d                	js     802192 <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802155:	49 bc 00 70 80 00 00 	movabs $0x807000,%r12
+  80215c:	00 00 00 
+  80215f:	4c 89 e6             	mov    %r12,%rsi
+  802162:	48 89 df             	mov    %rbx,%rdi
+  802165:	48 b8 b8 0d 80 00 00 	movabs $0x800db8,%rax
+  80216c:	00 00 00 
+  80216f:	ff d0                	call   *%rax
+    st->st_size  = fsipcbuf.statRet.ret_size;
+  802171:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  802178:	00 
+  802179:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  80217f:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  802186:	00 
+  802187:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  80218d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802192:	5b                   	pop    %rbx
+  802193:	41 5c                	pop    %r12
+  802195:	5d                   	pop    %rbp
+  802196:	c3                   	ret
+
+0000000000802197 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  802197:	55                   	push   %rbp
+  802198:	48 89 e5             	mov    %rsp,%rbp
+  80219b:	41 57                	push   %r15
+  80219d:	41 56                	push   %r14
+  80219f:	41 55                	push   %r13
+  8021a1:	41 54                	push   %r12
+  8021a3:	53                   	push   %rbx
+  8021a4:	48 83 ec 18          	sub    $0x18,%rsp
+  8021a8:	49 89 fe             	mov    %rdi,%r14
+  8021ab:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+  8021af:	48 89 d3             	mov    %rdx,%rbx
+    while (n > sizeof(fsipcbuf.write.req_buf))
+  8021b2:	48 81 fa f0 0f 00 00 	cmp    $0xff0,%rdx
+  8021b9:	0f 86 e4 00 00 00    	jbe    8022a3 <devfile_write+0x10c>
+  8021bf:	49 89 f4             	mov    %rsi,%r12
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8021c2:	49 bd 00 70 80 00 00 	movabs $0x807000,%r13
+  8021c9:	00 00 00 
+        memcpy(fsipcbuf.write.req_buf, buf, sizeof(fsipcbuf.write.req_buf));
+  8021cc:	49 bf 19 10 80 00 00 	movabs $0x801019,%r15
+  8021d3:	00 00 00 
+  8021d6:	eb 03                	jmp    8021db <devfile_write+0x44>
+        buf += sizeof(fsipcbuf.write.req_buf);
+  8021d8:	49 89 f4             	mov    %rsi,%r12
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8021db:	41 8b 46 0c          	mov    0xc(%r14),%eax
+  8021df:	41 89 45 00          	mov    %eax,0x0(%r13)
+        fsipcbuf.write.req_n      = sizeof(fsipcbuf.write.req_buf);
+  8021e3:	49 c7 45 08 f0 0f 00 	movq   $0xff0,0x8(%r13)
+  8021ea:	00 
+        memcpy(fsipcbuf.write.req_buf, buf, sizeof(fsipcbuf.write.req_buf));
+  8021eb:	ba f0 0f 00 00       	mov    $0xff0,%edx
+  8021f0:	4c 89 e6             	mov    %r12,%rsi
+  8021f3:	48 bf 10 70 80 00 00 	movabs $0x807010,%rdi
+  8021fa:	00 00 00 
+  8021fd:	41 ff d7             	call   *%r15
+        ssize_t res = fsipc(FSREQ_WRITE, NULL);
+  802200:	be 00 00 00 00       	mov    $0x0,%esi
+  802205:	bf 04 00 00 00       	mov    $0x4,%edi
+  80220a:	48 b8 35 20 80 00 00 	movabs $0x802035,%rax
+  802211:	00 00 00 
+  802214:	ff d0                	call   *%rax
+  802216:	48 63 d0             	movslq %eax,%rdx
+        if (res < 0 || res < sizeof(fsipcbuf.write.req_buf))
+  802219:	3d ef 0f 00 00       	cmp    $0xfef,%eax
+  80221e:	7e 71                	jle    802291 <devfile_write+0xfa>
+        buf += sizeof(fsipcbuf.write.req_buf);
+  802220:	49 8d b4 24 f0 0f 00 	lea    0xff0(%r12),%rsi
+  802227:	00 
+        n -= sizeof(fsipcbuf.write.req_buf);
+  802228:	48 81 eb f0 0f 00 00 	sub    $0xff0,%rbx
+    while (n > sizeof(fsipcbuf.write.req_buf))
+  80222f:	48 81 fb f0 0f 00 00 	cmp    $0xff0,%rbx
+  802236:	77 a0                	ja     8021d8 <devfile_write+0x41>
+        written += sizeof(fsipcbuf.write.req_buf);
+  802238:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80223c:	49 29 c4             	sub    %rax,%r12
+  80223f:	4d 8d a4 24 f0 0f 00 	lea    0xff0(%r12),%r12
+  802246:	00 
+    fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802247:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  80224e:	00 00 00 
+  802251:	41 8b 56 0c          	mov    0xc(%r14),%edx
+  802255:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.write.req_n      = n;
+  802257:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    memcpy(fsipcbuf.write.req_buf, buf, n);
+  80225b:	48 89 da             	mov    %rbx,%rdx
+  80225e:	48 8d 78 10          	lea    0x10(%rax),%rdi
+  802262:	48 b8 19 10 80 00 00 	movabs $0x801019,%rax
+  802269:	00 00 00 
+  80226c:	ff d0                	call   *%rax
+    ssize_t res = fsipc(FSREQ_WRITE, NULL);
+  80226e:	be 00 00 00 00       	mov    $0x0,%esi
+  802273:	bf 04 00 00 00       	mov    $0x4,%edi
+  802278:	48 b8 35 20 80 00 00 	movabs $0x802035,%rax
+  80227f:	00 00 00 
+  802282:	ff d0                	call   *%rax
+  802284:	48 63 d0             	movslq %eax,%rdx
+    written += res;
+  802287:	49 01 d4             	add    %rdx,%r12
+  80228a:	48 85 d2             	test   %rdx,%rdx
+  80228d:	49 0f 49 d4          	cmovns %r12,%rdx
+}
+  802291:	48 89 d0             	mov    %rdx,%rax
+  802294:	48 83 c4 18          	add    $0x18,%rsp
+  802298:	5b                   	pop    %rbx
+  802299:	41 5c                	pop    %r12
+  80229b:	41 5d                	pop    %r13
+  80229d:	41 5e                	pop    %r14
+  80229f:	41 5f                	pop    %r15
+  8022a1:	5d                   	pop    %rbp
+  8022a2:	c3                   	ret
+    while (n > sizeof(fsipcbuf.write.req_buf))
+  8022a3:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+    ssize_t written = 0;
+  8022a7:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8022ad:	eb 98                	jmp    802247 <devfile_write+0xb0>
+
+00000000008022af <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  8022af:	55                   	push   %rbp
+  8022b0:	48 89 e5             	mov    %rsp,%rbp
+  8022b3:	41 57                	push   %r15
+  8022b5:	41 56                	push   %r14
+  8022b7:	41 55                	push   %r13
+  8022b9:	41 54                	push   %r12
+  8022bb:	53                   	push   %rbx
+  8022bc:	48 83 ec 18          	sub    $0x18,%rsp
+  8022c0:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  8022c4:	49 89 f6             	mov    %rsi,%r14
+  8022c7:	49 89 d4             	mov    %rdx,%r12
+    while (n > sizeof(fsipcbuf.readRet.ret_buf))
+  8022ca:	48 81 fa 00 10 00 00 	cmp    $0x1000,%rdx
+  8022d1:	0f 86 ea 00 00 00    	jbe    8023c1 <devfile_read+0x112>
+    ssize_t readsz = 0;
+  8022d7:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  8022de:	00 
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8022df:	49 bf 00 70 80 00 00 	movabs $0x807000,%r15
+  8022e6:	00 00 00 
+  8022e9:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8022ed:	8b 40 0c             	mov    0xc(%rax),%eax
+  8022f0:	41 89 07             	mov    %eax,(%r15)
+        fsipcbuf.read.req_n = sizeof(fsipcbuf.readRet.ret_buf);
+  8022f3:	49 c7 47 08 00 10 00 	movq   $0x1000,0x8(%r15)
+  8022fa:	00 
+        ssize_t res = fsipc(FSREQ_READ, NULL);
+  8022fb:	be 00 00 00 00       	mov    $0x0,%esi
+  802300:	bf 03 00 00 00       	mov    $0x3,%edi
+  802305:	48 b8 35 20 80 00 00 	movabs $0x802035,%rax
+  80230c:	00 00 00 
+  80230f:	ff d0                	call   *%rax
+  802311:	4c 63 e8             	movslq %eax,%r13
+        if (res < 0)
+  802314:	4d 85 ed             	test   %r13,%r13
+  802317:	0f 88 92 00 00 00    	js     8023af <devfile_read+0x100>
+        memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  80231d:	4c 89 ea             	mov    %r13,%rdx
+  802320:	4c 89 fe             	mov    %r15,%rsi
+  802323:	4c 89 f7             	mov    %r14,%rdi
+  802326:	48 b8 19 10 80 00 00 	movabs $0x801019,%rax
+  80232d:	00 00 00 
+  802330:	ff d0                	call   *%rax
+        if (res < sizeof(fsipcbuf.readRet.ret_buf))
+  802332:	49 81 fd ff 0f 00 00 	cmp    $0xfff,%r13
+  802339:	76 6d                	jbe    8023a8 <devfile_read+0xf9>
+        readsz += res;
+  80233b:	4c 01 6d c0          	add    %r13,-0x40(%rbp)
+        buf += res;
+  80233f:	4d 01 ee             	add    %r13,%r14
+        n -= res;
+  802342:	4d 29 ec             	sub    %r13,%r12
+    while (n > sizeof(fsipcbuf.readRet.ret_buf))
+  802345:	49 81 fc 00 10 00 00 	cmp    $0x1000,%r12
+  80234c:	77 9b                	ja     8022e9 <devfile_read+0x3a>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  80234e:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  802355:	00 00 00 
+  802358:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  80235c:	8b 51 0c             	mov    0xc(%rcx),%edx
+  80235f:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.read.req_n = n;
+  802361:	4c 89 60 08          	mov    %r12,0x8(%rax)
+    ssize_t res = fsipc(FSREQ_READ, NULL);
+  802365:	be 00 00 00 00       	mov    $0x0,%esi
+  80236a:	bf 03 00 00 00       	mov    $0x3,%edi
+  80236f:	48 b8 35 20 80 00 00 	movabs $0x802035,%rax
+  802376:	00 00 00 
+  802379:	ff d0                	call   *%rax
+  80237b:	4c 63 e8             	movslq %eax,%r13
+    if (res < 0)
+  80237e:	4d 85 ed             	test   %r13,%r13
+  802381:	78 2c                	js     8023af <devfile_read+0x100>
+    memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  802383:	4c 89 ea             	mov    %r13,%rdx
+  802386:	48 be 00 70 80 00 00 	movabs $0x807000,%rsi
+  80238d:	00 00 00 
+  802390:	4c 89 f7             	mov    %r14,%rdi
+  802393:	48 b8 19 10 80 00 00 	movabs $0x801019,%rax
+  80239a:	00 00 00 
+  80239d:	ff d0                	call   *%rax
+    readsz += res;
+  80239f:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8023a3:	49 01 c5             	add    %rax,%r13
+    return readsz;
+  8023a6:	eb 07                	jmp    8023af <devfile_read+0x100>
+            return readsz + res;
+  8023a8:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8023ac:	49 01 c5             	add    %rax,%r13
+}
+  8023af:	4c 89 e8             	mov    %r13,%rax
+  8023b2:	48 83 c4 18          	add    $0x18,%rsp
+  8023b6:	5b                   	pop    %rbx
+  8023b7:	41 5c                	pop    %r12
+  8023b9:	41 5d                	pop    %r13
+  8023bb:	41 5e                	pop    %r14
+  8023bd:	41 5f                	pop    %r15
+  8023bf:	5d                   	pop    %rbp
+  8023c0:	c3                   	ret
+    ssize_t readsz = 0;
+  8023c1:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  8023c8:	00 
+  8023c9:	eb 83                	jmp    80234e <devfile_read+0x9f>
+
+00000000008023cb <open>:
+open(const char *path, int mode) {
+  8023cb:	55                   	push   %rbp
+  8023cc:	48 89 e5             	mov    %rsp,%rbp
+  8023cf:	41 55                	push   %r13
+  8023d1:	41 54                	push   %r12
+  8023d3:	53                   	push   %rbx
+  8023d4:	48 83 ec 18          	sub    $0x18,%rsp
+  8023d8:	49 89 fc             	mov    %rdi,%r12
+  8023db:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  8023de:	48 b8 7a 0d 80 00 00 	movabs $0x800d7a,%rax
+  8023e5:	00 00 00 
+  8023e8:	ff d0                	call   *%rax
+  8023ea:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  8023f0:	0f 87 8a 00 00 00    	ja     802480 <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8023f6:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  8023fa:	48 b8 ae 19 80 00 00 	movabs $0x8019ae,%rax
+  802401:	00 00 00 
+  802404:	ff d0                	call   *%rax
+  802406:	89 c3                	mov    %eax,%ebx
+  802408:	85 c0                	test   %eax,%eax
+  80240a:	78 50                	js     80245c <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  80240c:	4c 89 e6             	mov    %r12,%rsi
+  80240f:	48 bb 00 70 80 00 00 	movabs $0x807000,%rbx
+  802416:	00 00 00 
+  802419:	48 89 df             	mov    %rbx,%rdi
+  80241c:	48 b8 b8 0d 80 00 00 	movabs $0x800db8,%rax
+  802423:	00 00 00 
+  802426:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  802428:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  80242f:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802433:	bf 01 00 00 00       	mov    $0x1,%edi
+  802438:	48 b8 35 20 80 00 00 	movabs $0x802035,%rax
+  80243f:	00 00 00 
+  802442:	ff d0                	call   *%rax
+  802444:	89 c3                	mov    %eax,%ebx
+  802446:	85 c0                	test   %eax,%eax
+  802448:	78 1f                	js     802469 <open+0x9e>
+    return fd2num(fd);
+  80244a:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80244e:	48 b8 07 19 80 00 00 	movabs $0x801907,%rax
+  802455:	00 00 00 
+  802458:	ff d0                	call   *%rax
+  80245a:	89 c3                	mov    %eax,%ebx
+}
+  80245c:	89 d8                	mov    %ebx,%eax
+  80245e:	48 83 c4 18          	add    $0x18,%rsp
+  802462:	5b                   	pop    %rbx
+  802463:	41 5c                	pop    %r12
+  802465:	41 5d                	pop    %r13
+  802467:	5d                   	pop    %rbp
+  802468:	c3                   	ret
+        fd_close(fd, 0);
+  802469:	be 00 00 00 00       	mov    $0x0,%esi
+  80246e:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802472:	48 b8 83 1a 80 00 00 	movabs $0x801a83,%rax
+  802479:	00 00 00 
+  80247c:	ff d0                	call   *%rax
+        return res;
+  80247e:	eb dc                	jmp    80245c <open+0x91>
+        return -E_BAD_PATH;
+  802480:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  802485:	eb d5                	jmp    80245c <open+0x91>
+
+0000000000802487 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  802487:	55                   	push   %rbp
+  802488:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc(FSREQ_SYNC, NULL);
+  80248b:	be 00 00 00 00       	mov    $0x0,%esi
+  802490:	bf 08 00 00 00       	mov    $0x8,%edi
+  802495:	48 b8 35 20 80 00 00 	movabs $0x802035,%rax
+  80249c:	00 00 00 
+  80249f:	ff d0                	call   *%rax
+}
+  8024a1:	5d                   	pop    %rbp
+  8024a2:	c3                   	ret
+
+00000000008024a3 <region_flush>:
+ * sys_region_batch() call right before memory at UTEMP is reused */
+static struct RegionOp region_queue[REGION_BATCH_MAX];
+static size_t region_queued;
+
+static int
+region_flush(void) {
+  8024a3:	55                   	push   %rbp
+  8024a4:	48 89 e5             	mov    %rsp,%rbp
+  8024a7:	41 56                	push   %r14
+  8024a9:	41 55                	push   %r13
+  8024ab:	41 54                	push   %r12
+  8024ad:	53                   	push   %rbx
+    int res = region_queued ? sys_region_batch(region_queue, region_queued) : 0;
+  8024ae:	48 b8 20 80 80 00 00 	movabs $0x808020,%rax
+  8024b5:	00 00 00 
+  8024b8:	48 8b 30             	mov    (%rax),%rsi
+  8024bb:	41 be 00 00 00 00    	mov    $0x0,%r14d
+  8024c1:	48 85 f6             	test   %rsi,%rsi
+  8024c4:	74 6d                	je     802533 <region_flush+0x90>
+  8024c6:	48 bf 40 80 80 00 00 	movabs $0x808040,%rdi
+  8024cd:	00 00 00 
+  8024d0:	48 b8 9b 14 80 00 00 	movabs $0x80149b,%rax
+  8024d7:	00 00 00 
+  8024da:	ff d0                	call   *%rax
+  8024dc:	41 89 c6             	mov    %eax,%r14d
+
+    /* Operations following the failed one are not performed,
+     * but memory at UTEMP still has to be unmapped from ours */
+    for (size_t i = 0; res < 0 && i < region_queued; i++) {
+  8024df:	85 c0                	test   %eax,%eax
+  8024e1:	79 50                	jns    802533 <region_flush+0x90>
+  8024e3:	48 bb 40 80 80 00 00 	movabs $0x808040,%rbx
+  8024ea:	00 00 00 
+  8024ed:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8024f3:	49 bd 20 80 80 00 00 	movabs $0x808020,%r13
+  8024fa:	00 00 00 
+  8024fd:	eb 08                	jmp    802507 <region_flush+0x64>
+  8024ff:	49 83 c4 01          	add    $0x1,%r12
+  802503:	48 83 c3 28          	add    $0x28,%rbx
+  802507:	4d 3b 65 00          	cmp    0x0(%r13),%r12
+  80250b:	73 26                	jae    802533 <region_flush+0x90>
+        struct RegionOp *op = &region_queue[i];
+        if (op->type == REGION_UNMAP && !op->dstenv)
+  80250d:	83 3b 02             	cmpl   $0x2,(%rbx)
+  802510:	75 ed                	jne    8024ff <region_flush+0x5c>
+  802512:	83 7b 0c 00          	cmpl   $0x0,0xc(%rbx)
+  802516:	75 e7                	jne    8024ff <region_flush+0x5c>
+            sys_unmap_region(0, (void *)op->dstva, op->size);
+  802518:	48 8b 53 20          	mov    0x20(%rbx),%rdx
+  80251c:	48 8b 73 18          	mov    0x18(%rbx),%rsi
+  802520:	bf 00 00 00 00       	mov    $0x0,%edi
+  802525:	48 b8 34 14 80 00 00 	movabs $0x801434,%rax
+  80252c:	00 00 00 
+  80252f:	ff d0                	call   *%rax
+  802531:	eb cc                	jmp    8024ff <region_flush+0x5c>
+    }
+    region_queued = 0;
+  802533:	48 b8 20 80 80 00 00 	movabs $0x808020,%rax
+  80253a:	00 00 00 
+  80253d:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+    return res;
+}
+  802544:	44 89 f0             	mov    %r14d,%eax
+  802547:	5b                   	pop    %rbx
+  802548:	41 5c                	pop    %r12
+  80254a:	41 5d                	pop    %r13
+  80254c:	41 5e                	pop    %r14
+  80254e:	5d                   	pop    %rbp
+  80254f:	c3                   	ret
+
+0000000000802550 <region_queue_op>:
+
+static int
+region_queue_op(int type, envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  802550:	55                   	push   %rbp
+  802551:	48 89 e5             	mov    %rsp,%rbp
+  802554:	41 57                	push   %r15
+  802556:	41 56                	push   %r14
+  802558:	41 55                	push   %r13
+  80255a:	41 54                	push   %r12
+  80255c:	53                   	push   %rbx
+  80255d:	48 83 ec 18          	sub    $0x18,%rsp
+  802561:	41 89 ff             	mov    %edi,%r15d
+  802564:	41 89 f6             	mov    %esi,%r14d
+  802567:	49 89 d4             	mov    %rdx,%r12
+  80256a:	41 89 cd             	mov    %ecx,%r13d
+  80256d:	4c 89 c3             	mov    %r8,%rbx
+  802570:	4c 89 4d c8          	mov    %r9,-0x38(%rbp)
+    int res = region_queued == REGION_BATCH_MAX ? region_flush() : 0;
+  802574:	bf 00 00 00 00       	mov    $0x0,%edi
+  802579:	48 b8 20 80 80 00 00 	movabs $0x808020,%rax
+  802580:	00 00 00 
+  802583:	48 83 38 10          	cmpq   $0x10,(%rax)
+  802587:	74 66                	je     8025ef <region_queue_op+0x9f>
+    region_queue[region_queued++] = (struct RegionOp){
+  802589:	48 b8 20 80 80 00 00 	movabs $0x808020,%rax
+  802590:	00 00 00 
+  802593:	48 8b 08             	mov    (%rax),%rcx
+  802596:	48 8d 51 01          	lea    0x1(%rcx),%rdx
+  80259a:	48 89 10             	mov    %rdx,(%rax)
+  80259d:	48 be 40 80 80 00 00 	movabs $0x808040,%rsi
+  8025a4:	00 00 00 
+  8025a7:	48 8d 14 8d 00 00 00 	lea    0x0(,%rcx,4),%rdx
+  8025ae:	00 
+  8025af:	48 8d 04 0a          	lea    (%rdx,%rcx,1),%rax
+  8025b3:	48 8d 04 c6          	lea    (%rsi,%rax,8),%rax
+  8025b7:	44 89 38             	mov    %r15d,(%rax)
+  8025ba:	44 8b 45 10          	mov    0x10(%rbp),%r8d
+  8025be:	44 89 40 04          	mov    %r8d,0x4(%rax)
+  8025c2:	44 89 70 08          	mov    %r14d,0x8(%rax)
+  8025c6:	44 89 68 0c          	mov    %r13d,0xc(%rax)
+  8025ca:	4c 89 60 10          	mov    %r12,0x10(%rax)
+  8025ce:	48 89 58 18          	mov    %rbx,0x18(%rax)
+  8025d2:	48 01 ca             	add    %rcx,%rdx
+  8025d5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8025d9:	48 89 44 d6 20       	mov    %rax,0x20(%rsi,%rdx,8)
+            .srcva = (uintptr_t)srcva,
+            .dstva = (uintptr_t)dstva,
+            .size = size,
+    };
+    return res;
+}
+  8025de:	89 f8                	mov    %edi,%eax
+  8025e0:	48 83 c4 18          	add    $0x18,%rsp
+  8025e4:	5b                   	pop    %rbx
+  8025e5:	41 5c                	pop    %r12
+  8025e7:	41 5d                	pop    %r13
+  8025e9:	41 5e                	pop    %r14
+  8025eb:	41 5f                	pop    %r15
+  8025ed:	5d                   	pop    %rbp
+  8025ee:	c3                   	ret
+    int res = region_queued == REGION_BATCH_MAX ? region_flush() : 0;
+  8025ef:	48 b8 a3 24 80 00 00 	movabs $0x8024a3,%rax
+  8025f6:	00 00 00 
+  8025f9:	ff d0                	call   *%rax
+  8025fb:	89 c7                	mov    %eax,%edi
+  8025fd:	eb 8a                	jmp    802589 <region_queue_op+0x39>
+
+00000000008025ff <copy_shared_region>:
+    int unmap = region_queue_op(REGION_UNMAP, 0, NULL, 0, UTEMP, USER_STACK_SIZE, 0);
+    return res < 0 ? res : unmap;
+}
+
+static int
+copy_shared_region(void *start, void *end, void *arg) {
+  8025ff:	55                   	push   %rbp
+  802600:	48 89 e5             	mov    %rsp,%rbp
+  802603:	41 55                	push   %r13
+  802605:	41 54                	push   %r12
+  802607:	53                   	push   %rbx
+  802608:	48 83 ec 08          	sub    $0x8,%rsp
+  80260c:	48 89 fb             	mov    %rdi,%rbx
+  80260f:	49 89 f4             	mov    %rsi,%r12
+    envid_t child = *(envid_t *)arg;
+  802612:	44 8b 2a             	mov    (%rdx),%r13d
+    return region_queue_op(REGION_MAP, 0, start, child, start, end - start, get_prot(start));
+  802615:	48 b8 07 35 80 00 00 	movabs $0x803507,%rax
+  80261c:	00 00 00 
+  80261f:	ff d0                	call   *%rax
+  802621:	48 83 ec 08          	sub    $0x8,%rsp
+  802625:	50                   	push   %rax
+  802626:	4d 89 e1             	mov    %r12,%r9
+  802629:	49 29 d9             	sub    %rbx,%r9
+  80262c:	49 89 d8             	mov    %rbx,%r8
+  80262f:	44 89 e9             	mov    %r13d,%ecx
+  802632:	48 89 da             	mov    %rbx,%rdx
+  802635:	be 00 00 00 00       	mov    $0x0,%esi
+  80263a:	bf 01 00 00 00       	mov    $0x1,%edi
+  80263f:	48 b8 50 25 80 00 00 	movabs $0x802550,%rax
+  802646:	00 00 00 
+  802649:	ff d0                	call   *%rax
+}
+  80264b:	48 8d 65 e8          	lea    -0x18(%rbp),%rsp
+  80264f:	5b                   	pop    %rbx
+  802650:	41 5c                	pop    %r12
+  802652:	41 5d                	pop    %r13
+  802654:	5d                   	pop    %rbp
+  802655:	c3                   	ret
+
+0000000000802656 <spawn>:
+spawn(const char *prog, const char **argv) {
+  802656:	55                   	push   %rbp
+  802657:	48 89 e5             	mov    %rsp,%rbp
+  80265a:	41 57                	push   %r15
+  80265c:	41 56                	push   %r14
+  80265e:	41 55                	push   %r13
+  802660:	41 54                	push   %r12
+  802662:	53                   	push   %rbx
+  802663:	48 81 ec 08 03 00 00 	sub    $0x308,%rsp
+  80266a:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(prog, O_RDONLY);
+  80266d:	be 00 00 00 00       	mov    $0x0,%esi
+  802672:	48 b8 cb 23 80 00 00 	movabs $0x8023cb,%rax
+  802679:	00 00 00 
+  80267c:	ff d0                	call   *%rax
+  80267e:	89 85 fc fc ff ff    	mov    %eax,-0x304(%rbp)
+    if (fd < 0) return fd;
+  802684:	85 c0                	test   %eax,%eax
+  802686:	0f 88 08 07 00 00    	js     802d94 <spawn+0x73e>
+  80268c:	89 c7                	mov    %eax,%edi
+    res = readn(fd, elf_buf, sizeof(elf_buf));
+  80268e:	ba 00 02 00 00       	mov    $0x200,%edx
+  802693:	48 8d b5 d0 fd ff ff 	lea    -0x230(%rbp),%rsi
+  80269a:	48 b8 69 1d 80 00 00 	movabs $0x801d69,%rax
+  8026a1:	00 00 00 
+  8026a4:	ff d0                	call   *%rax
+  8026a6:	89 c6                	mov    %eax,%esi
+    if (res != sizeof(elf_buf)) {
+  8026a8:	3d 00 02 00 00       	cmp    $0x200,%eax
+  8026ad:	0f 85 d2 02 00 00    	jne    802985 <spawn+0x32f>
+        elf->e_elf[1] != 1 /* little endian */ ||
+  8026b3:	48 b8 ff ff ff ff ff 	movabs $0xffffffffffffff,%rax
+  8026ba:	ff ff 00 
+  8026bd:	48 23 85 d0 fd ff ff 	and    -0x230(%rbp),%rax
+    if (elf->e_magic != ELF_MAGIC ||
+  8026c4:	48 ba 7f 45 4c 46 02 	movabs $0x10102464c457f,%rdx
+  8026cb:	01 01 00 
+  8026ce:	48 39 d0             	cmp    %rdx,%rax
+  8026d1:	0f 85 ea 02 00 00    	jne    8029c1 <spawn+0x36b>
+        elf->e_type != ET_EXEC /* executable */ ||
+  8026d7:	81 bd e0 fd ff ff 02 	cmpl   $0x3e0002,-0x220(%rbp)
+  8026de:	00 3e 00 
+  8026e1:	0f 85 da 02 00 00    	jne    8029c1 <spawn+0x36b>
+  8026e7:	b8 08 00 00 00       	mov    $0x8,%eax
+  8026ec:	cd 30                	int    $0x30
+  8026ee:	89 85 f0 fc ff ff    	mov    %eax,-0x310(%rbp)
+  8026f4:	89 c3                	mov    %eax,%ebx
+    if ((int)(res = sys_exofork()) < 0) goto error2;
+  8026f6:	85 c0                	test   %eax,%eax
+  8026f8:	0f 88 7e 06 00 00    	js     802d7c <spawn+0x726>
+    envid_t child = res;
+  8026fe:	89 85 cc fd ff ff    	mov    %eax,-0x234(%rbp)
+    struct Trapframe child_tf = envs[ENVX(child)].env_tf;
+  802704:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802709:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+  802710:	48 be 00 00 c0 1f 80 	movabs $0x801fc00000,%rsi
+  802717:	00 00 00 
+  80271a:	48 01 c6             	add    %rax,%rsi
+  80271d:	48 8b 06             	mov    (%rsi),%rax
+  802720:	48 89 85 0c fd ff ff 	mov    %rax,-0x2f4(%rbp)
+  802727:	48 8b 86 b8 00 00 00 	mov    0xb8(%rsi),%rax
+  80272e:	48 89 85 c4 fd ff ff 	mov    %rax,-0x23c(%rbp)
+  802735:	48 8d bd 10 fd ff ff 	lea    -0x2f0(%rbp),%rdi
+  80273c:	48 c7 c1 fc ff ff ff 	mov    $0xfffffffffffffffc,%rcx
+  802743:	48 29 ce             	sub    %rcx,%rsi
+  802746:	81 c1 c0 00 00 00    	add    $0xc0,%ecx
+  80274c:	c1 e9 03             	shr    $0x3,%ecx
+  80274f:	89 c9                	mov    %ecx,%ecx
+  802751:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+    child_tf.tf_rip = elf->e_entry;
+  802754:	48 8b 85 e8 fd ff ff 	mov    -0x218(%rbp),%rax
+  80275b:	48 89 85 a4 fd ff ff 	mov    %rax,-0x25c(%rbp)
+    for (argc = 0; argv[argc] != 0; argc++)
+  802762:	49 8b 3c 24          	mov    (%r12),%rdi
+  802766:	48 85 ff             	test   %rdi,%rdi
+  802769:	0f 84 99 02 00 00    	je     802a08 <spawn+0x3b2>
+  80276f:	41 bd 01 00 00 00    	mov    $0x1,%r13d
+    string_size = 0;
+  802775:	41 be 00 00 00 00    	mov    $0x0,%r14d
+        string_size += strlen(argv[argc]) + 1;
+  80277b:	49 bf 7a 0d 80 00 00 	movabs $0x800d7a,%r15
+  802782:	00 00 00 
+  802785:	41 ff d7             	call   *%r15
+  802788:	4a 8d 1c 30          	lea    (%rax,%r14,1),%rbx
+  80278c:	4c 8d 73 01          	lea    0x1(%rbx),%r14
+    for (argc = 0; argv[argc] != 0; argc++)
+  802790:	4c 89 e8             	mov    %r13,%rax
+  802793:	49 83 c5 01          	add    $0x1,%r13
+  802797:	4b 8b 7c ec f8       	mov    -0x8(%r12,%r13,8),%rdi
+  80279c:	48 85 ff             	test   %rdi,%rdi
+  80279f:	75 e4                	jne    802785 <spawn+0x12f>
+    string_store = (char *)UTEMP + USER_STACK_SIZE - string_size;
+  8027a1:	48 89 c2             	mov    %rax,%rdx
+  8027a4:	48 89 85 e8 fc ff ff 	mov    %rax,-0x318(%rbp)
+  8027ab:	48 f7 d3             	not    %rbx
+  8027ae:	48 81 c3 00 00 41 00 	add    $0x410000,%rbx
+    argv_store = (uintptr_t *)(ROUNDDOWN(string_store, sizeof(uintptr_t)) - sizeof(uintptr_t) * (argc + 1));
+  8027b5:	48 89 d9             	mov    %rbx,%rcx
+  8027b8:	48 83 e1 f8          	and    $0xfffffffffffffff8,%rcx
+  8027bc:	48 89 8d e0 fc ff ff 	mov    %rcx,-0x320(%rbp)
+  8027c3:	83 c0 01             	add    $0x1,%eax
+  8027c6:	48 98                	cltq
+  8027c8:	48 c1 e0 03          	shl    $0x3,%rax
+  8027cc:	48 29 c1             	sub    %rax,%rcx
+  8027cf:	49 89 cf             	mov    %rcx,%r15
+    if ((void *)(argv_store - 2) < (void *)UTEMP) return -E_NO_MEM;
+  8027d2:	48 8d 41 f0          	lea    -0x10(%rcx),%rax
+  8027d6:	48 3d ff ff 3f 00    	cmp    $0x3fffff,%rax
+  8027dc:	0f 86 73 05 00 00    	jbe    802d55 <spawn+0x6ff>
+    for (argc = 0; argv[argc] != 0; argc++)
+  8027e2:	41 89 d6             	mov    %edx,%r14d
+    if ((res = region_queue_op(REGION_ALLOC, 0, NULL, 0, UTEMP, USER_STACK_SIZE, PROT_RW)) < 0 ||
+  8027e5:	48 83 ec 08          	sub    $0x8,%rsp
+  8027e9:	6a 06                	push   $0x6
+  8027eb:	41 b9 00 00 01 00    	mov    $0x10000,%r9d
+  8027f1:	41 b8 00 00 40 00    	mov    $0x400000,%r8d
+  8027f7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8027fc:	ba 00 00 00 00       	mov    $0x0,%edx
+  802801:	be 00 00 00 00       	mov    $0x0,%esi
+  802806:	bf 00 00 00 00       	mov    $0x0,%edi
+  80280b:	48 b8 50 25 80 00 00 	movabs $0x802550,%rax
+  802812:	00 00 00 
+  802815:	ff d0                	call   *%rax
+  802817:	41 89 c5             	mov    %eax,%r13d
+  80281a:	48 83 c4 10          	add    $0x10,%rsp
+  80281e:	85 c0                	test   %eax,%eax
+  802820:	0f 88 35 05 00 00    	js     802d5b <spawn+0x705>
+        (res = region_flush()) < 0) return res;
+  802826:	48 b8 a3 24 80 00 00 	movabs $0x8024a3,%rax
+  80282d:	00 00 00 
+  802830:	ff d0                	call   *%rax
+  802832:	41 89 c5             	mov    %eax,%r13d
+    if ((res = region_queue_op(REGION_ALLOC, 0, NULL, 0, UTEMP, USER_STACK_SIZE, PROT_RW)) < 0 ||
+  802835:	85 c0                	test   %eax,%eax
+  802837:	0f 88 1e 05 00 00    	js     802d5b <spawn+0x705>
+    for (i = 0; i < argc; i++) {
+  80283d:	45 85 f6             	test   %r14d,%r14d
+  802840:	7e 55                	jle    802897 <spawn+0x241>
+  802842:	4d 89 fd             	mov    %r15,%r13
+  802845:	4d 63 f6             	movslq %r14d,%r14
+  802848:	4f 8d 34 f7          	lea    (%r15,%r14,8),%r14
+        argv_store[i] = UTEMP2USTACK(string_store);
+  80284c:	48 b8 00 70 fe ff 7f 	movabs $0x7ffffe7000,%rax
+  802853:	00 00 00 
+  802856:	48 8d 84 03 00 00 c0 	lea    -0x400000(%rbx,%rax,1),%rax
+  80285d:	ff 
+  80285e:	49 89 45 00          	mov    %rax,0x0(%r13)
+        strcpy(string_store, argv[i]);
+  802862:	49 8b 34 24          	mov    (%r12),%rsi
+  802866:	48 89 df             	mov    %rbx,%rdi
+  802869:	48 b8 b8 0d 80 00 00 	movabs $0x800db8,%rax
+  802870:	00 00 00 
+  802873:	ff d0                	call   *%rax
+        string_store += strlen(argv[i]) + 1;
+  802875:	49 8b 3c 24          	mov    (%r12),%rdi
+  802879:	48 b8 7a 0d 80 00 00 	movabs $0x800d7a,%rax
+  802880:	00 00 00 
+  802883:	ff d0                	call   *%rax
+  802885:	48 8d 5c 03 01       	lea    0x1(%rbx,%rax,1),%rbx
+    for (i = 0; i < argc; i++) {
+  80288a:	49 83 c5 08          	add    $0x8,%r13
+  80288e:	49 83 c4 08          	add    $0x8,%r12
+  802892:	4d 39 f5             	cmp    %r14,%r13
+  802895:	75 b5                	jne    80284c <spawn+0x1f6>
+    argv_store[argc] = 0;
+  802897:	48 8b 85 e0 fc ff ff 	mov    -0x320(%rbp),%rax
+  80289e:	48 c7 40 f8 00 00 00 	movq   $0x0,-0x8(%rax)
+  8028a5:	00 
+    assert(string_store == (char *)UTEMP + USER_STACK_SIZE);
+  8028a6:	48 81 fb 00 00 41 00 	cmp    $0x410000,%rbx
+  8028ad:	0f 85 81 01 00 00    	jne    802a34 <spawn+0x3de>
+    argv_store[-1] = UTEMP2USTACK(argv_store);
+  8028b3:	49 b8 00 70 fe ff 7f 	movabs $0x7ffffe7000,%r8
+  8028ba:	00 00 00 
+  8028bd:	4b 8d 84 07 00 00 c0 	lea    -0x400000(%r15,%r8,1),%rax
+  8028c4:	ff 
+  8028c5:	49 89 47 f8          	mov    %rax,-0x8(%r15)
+    argv_store[-2] = argc;
+  8028c9:	48 8b 85 e8 fc ff ff 	mov    -0x318(%rbp),%rax
+  8028d0:	49 89 47 f0          	mov    %rax,-0x10(%r15)
+    tf->tf_rsp = UTEMP2USTACK(&argv_store[-2]);
+  8028d4:	48 b8 f0 6f fe ff 7f 	movabs $0x7ffffe6ff0,%rax
+  8028db:	00 00 00 
+  8028de:	49 8d 84 07 00 00 c0 	lea    -0x400000(%r15,%rax,1),%rax
+  8028e5:	ff 
+  8028e6:	48 89 85 bc fd ff ff 	mov    %rax,-0x244(%rbp)
+    res = region_queue_op(REGION_MAP, 0, UTEMP, child, (void *)(USER_STACK_TOP - USER_STACK_SIZE),
+  8028ed:	48 83 ec 08          	sub    $0x8,%rsp
+  8028f1:	6a 06                	push   $0x6
+  8028f3:	41 b9 00 00 01 00    	mov    $0x10000,%r9d
+  8028f9:	8b 8d f0 fc ff ff    	mov    -0x310(%rbp),%ecx
+  8028ff:	ba 00 00 40 00       	mov    $0x400000,%edx
+  802904:	be 00 00 00 00       	mov    $0x0,%esi
+  802909:	bf 01 00 00 00       	mov    $0x1,%edi
+  80290e:	48 bb 50 25 80 00 00 	movabs $0x802550,%rbx
+  802915:	00 00 00 
+  802918:	ff d3                	call   *%rbx
+  80291a:	41 89 c5             	mov    %eax,%r13d
+    int unmap = region_queue_op(REGION_UNMAP, 0, NULL, 0, UTEMP, USER_STACK_SIZE, 0);
+  80291d:	c7 04 24 00 00 00 00 	movl   $0x0,(%rsp)
+  802924:	41 b9 00 00 01 00    	mov    $0x10000,%r9d
+  80292a:	41 b8 00 00 40 00    	mov    $0x400000,%r8d
+  802930:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802935:	ba 00 00 00 00       	mov    $0x0,%edx
+  80293a:	be 00 00 00 00       	mov    $0x0,%esi
+  80293f:	bf 02 00 00 00       	mov    $0x2,%edi
+  802944:	ff d3                	call   *%rbx
+  802946:	89 c3                	mov    %eax,%ebx
+    return res < 0 ? res : unmap;
+  802948:	48 83 c4 10          	add    $0x10,%rsp
+  80294c:	45 85 ed             	test   %r13d,%r13d
+  80294f:	0f 88 06 04 00 00    	js     802d5b <spawn+0x705>
+    if ((res = init_stack(child, argv, &child_tf)) < 0) goto error;
+  802955:	85 c0                	test   %eax,%eax
+  802957:	0f 88 01 04 00 00    	js     802d5e <spawn+0x708>
+    struct Proghdr *ph = (struct Proghdr *)(elf_buf + elf->e_phoff);
+  80295d:	48 8b 85 f0 fd ff ff 	mov    -0x210(%rbp),%rax
+  802964:	4c 8d ac 05 d0 fd ff 	lea    -0x230(%rbp,%rax,1),%r13
+  80296b:	ff 
+    for (size_t i = 0; i < elf->e_phnum; i++, ph++) {
+  80296c:	66 83 bd 08 fe ff ff 	cmpw   $0x0,-0x1f8(%rbp)
+  802973:	00 
+  802974:	0f 84 c8 02 00 00    	je     802c42 <spawn+0x5ec>
+  80297a:	41 be 00 00 00 00    	mov    $0x0,%r14d
+  802980:	e9 63 01 00 00       	jmp    802ae8 <spawn+0x492>
+        cprintf("Wrong ELF header size or read error: %i\n", res);
+  802985:	48 bf 40 42 80 00 00 	movabs $0x804240,%rdi
+  80298c:	00 00 00 
+  80298f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802994:	48 ba 93 04 80 00 00 	movabs $0x800493,%rdx
+  80299b:	00 00 00 
+  80299e:	ff d2                	call   *%rdx
+        close(fd);
+  8029a0:	8b bd fc fc ff ff    	mov    -0x304(%rbp),%edi
+  8029a6:	48 b8 2d 1b 80 00 00 	movabs $0x801b2d,%rax
+  8029ad:	00 00 00 
+  8029b0:	ff d0                	call   *%rax
+        return -E_NOT_EXEC;
+  8029b2:	c7 85 fc fc ff ff ee 	movl   $0xffffffee,-0x304(%rbp)
+  8029b9:	ff ff ff 
+  8029bc:	e9 d3 03 00 00       	jmp    802d94 <spawn+0x73e>
+        cprintf("Elf magic %08x want %08x\n", elf->e_magic, ELF_MAGIC);
+  8029c1:	ba 7f 45 4c 46       	mov    $0x464c457f,%edx
+  8029c6:	8b b5 d0 fd ff ff    	mov    -0x230(%rbp),%esi
+  8029cc:	48 bf a0 42 80 00 00 	movabs $0x8042a0,%rdi
+  8029d3:	00 00 00 
+  8029d6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029db:	48 b9 93 04 80 00 00 	movabs $0x800493,%rcx
+  8029e2:	00 00 00 
+  8029e5:	ff d1                	call   *%rcx
+        close(fd);
+  8029e7:	8b bd fc fc ff ff    	mov    -0x304(%rbp),%edi
+  8029ed:	48 b8 2d 1b 80 00 00 	movabs $0x801b2d,%rax
+  8029f4:	00 00 00 
+  8029f7:	ff d0                	call   *%rax
+        return -E_NOT_EXEC;
+  8029f9:	c7 85 fc fc ff ff ee 	movl   $0xffffffee,-0x304(%rbp)
+  802a00:	ff ff ff 
+  802a03:	e9 8c 03 00 00       	jmp    802d94 <spawn+0x73e>
+    for (argc = 0; argv[argc] != 0; argc++)
+  802a08:	48 c7 85 e8 fc ff ff 	movq   $0x0,-0x318(%rbp)
+  802a0f:	00 00 00 00 
+  802a13:	41 be 00 00 00 00    	mov    $0x0,%r14d
+    argv_store = (uintptr_t *)(ROUNDDOWN(string_store, sizeof(uintptr_t)) - sizeof(uintptr_t) * (argc + 1));
+  802a19:	41 bf f8 ff 40 00    	mov    $0x40fff8,%r15d
+  802a1f:	48 c7 85 e0 fc ff ff 	movq   $0x410000,-0x320(%rbp)
+  802a26:	00 00 41 00 
+    string_store = (char *)UTEMP + USER_STACK_SIZE - string_size;
+  802a2a:	bb 00 00 41 00       	mov    $0x410000,%ebx
+  802a2f:	e9 b1 fd ff ff       	jmp    8027e5 <spawn+0x18f>
+    assert(string_store == (char *)UTEMP + USER_STACK_SIZE);
+  802a34:	48 b9 70 42 80 00 00 	movabs $0x804270,%rcx
+  802a3b:	00 00 00 
+  802a3e:	48 ba ba 42 80 00 00 	movabs $0x8042ba,%rdx
+  802a45:	00 00 00 
+  802a48:	be 16 01 00 00       	mov    $0x116,%esi
+  802a4d:	48 bf cf 42 80 00 00 	movabs $0x8042cf,%rdi
+  802a54:	00 00 00 
+  802a57:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a5c:	49 b8 43 03 80 00 00 	movabs $0x800343,%r8
+  802a63:	00 00 00 
+  802a66:	41 ff d0             	call   *%r8
+    }
+    res = readn(fd, UTEMP, filesz);
+    if (res < 0) {
+        goto cleanup;
+    }
+    res = region_queue_op(REGION_MAP, 0, UTEMP, child, (void *)va, memsz, perm);
+  802a69:	48 83 ec 08          	sub    $0x8,%rsp
+  802a6d:	41 54                	push   %r12
+  802a6f:	4d 89 f9             	mov    %r15,%r9
+  802a72:	4c 8b 85 f0 fc ff ff 	mov    -0x310(%rbp),%r8
+  802a79:	8b 8d e8 fc ff ff    	mov    -0x318(%rbp),%ecx
+  802a7f:	ba 00 00 40 00       	mov    $0x400000,%edx
+  802a84:	be 00 00 00 00       	mov    $0x0,%esi
+  802a89:	bf 01 00 00 00       	mov    $0x1,%edi
+  802a8e:	49 bc 50 25 80 00 00 	movabs $0x802550,%r12
+  802a95:	00 00 00 
+  802a98:	41 ff d4             	call   *%r12
+  802a9b:	89 c3                	mov    %eax,%ebx
+    if (res < 0) {
+        goto cleanup;
+    }
+cleanup:
+    region_queue_op(REGION_UNMAP, 0, NULL, 0, UTEMP, memsz, 0);
+  802a9d:	c7 04 24 00 00 00 00 	movl   $0x0,(%rsp)
+  802aa4:	4d 89 f9             	mov    %r15,%r9
+  802aa7:	41 b8 00 00 40 00    	mov    $0x400000,%r8d
+  802aad:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802ab2:	ba 00 00 00 00       	mov    $0x0,%edx
+  802ab7:	be 00 00 00 00       	mov    $0x0,%esi
+  802abc:	bf 02 00 00 00       	mov    $0x2,%edi
+  802ac1:	41 ff d4             	call   *%r12
+        if ((res = map_segment(child, ph->p_va, ph->p_memsz,
+  802ac4:	48 83 c4 10          	add    $0x10,%rsp
+  802ac8:	85 db                	test   %ebx,%ebx
+  802aca:	0f 88 8e 02 00 00    	js     802d5e <spawn+0x708>
+    for (size_t i = 0; i < elf->e_phnum; i++, ph++) {
+  802ad0:	49 83 c6 01          	add    $0x1,%r14
+  802ad4:	49 83 c5 38          	add    $0x38,%r13
+  802ad8:	0f b7 85 08 fe ff ff 	movzwl -0x1f8(%rbp),%eax
+  802adf:	49 39 c6             	cmp    %rax,%r14
+  802ae2:	0f 83 5a 01 00 00    	jae    802c42 <spawn+0x5ec>
+        if (ph->p_type != ELF_PROG_LOAD) continue;
+  802ae8:	41 83 7d 00 01       	cmpl   $0x1,0x0(%r13)
+  802aed:	75 e1                	jne    802ad0 <spawn+0x47a>
+        if (ph->p_flags & ELF_PROG_FLAG_WRITE) perm |= PROT_W;
+  802aef:	41 8b 45 04          	mov    0x4(%r13),%eax
+  802af3:	41 89 c4             	mov    %eax,%r12d
+  802af6:	41 83 e4 02          	and    $0x2,%r12d
+        if (ph->p_flags & ELF_PROG_FLAG_READ) perm |= PROT_R;
+  802afa:	44 89 e2             	mov    %r12d,%edx
+  802afd:	83 ca 04             	or     $0x4,%edx
+  802b00:	a8 04                	test   $0x4,%al
+  802b02:	44 0f 45 e2          	cmovne %edx,%r12d
+        if (ph->p_flags & ELF_PROG_FLAG_EXEC) perm |= PROT_X;
+  802b06:	44 89 e2             	mov    %r12d,%edx
+  802b09:	83 ca 01             	or     $0x1,%edx
+  802b0c:	a8 01                	test   $0x1,%al
+  802b0e:	44 0f 45 e2          	cmovne %edx,%r12d
+        if ((res = map_segment(child, ph->p_va, ph->p_memsz,
+  802b12:	49 8b 45 08          	mov    0x8(%r13),%rax
+  802b16:	89 85 e0 fc ff ff    	mov    %eax,-0x320(%rbp)
+  802b1c:	49 8b 5d 20          	mov    0x20(%r13),%rbx
+  802b20:	48 89 9d d8 fc ff ff 	mov    %rbx,-0x328(%rbp)
+  802b27:	4d 8b 7d 28          	mov    0x28(%r13),%r15
+  802b2b:	49 8b 75 10          	mov    0x10(%r13),%rsi
+  802b2f:	48 89 b5 f0 fc ff ff 	mov    %rsi,-0x310(%rbp)
+  802b36:	8b 8d cc fd ff ff    	mov    -0x234(%rbp),%ecx
+  802b3c:	89 8d e8 fc ff ff    	mov    %ecx,-0x318(%rbp)
+    if (res) {
+  802b42:	89 f2                	mov    %esi,%edx
+  802b44:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  802b4a:	74 22                	je     802b6e <spawn+0x518>
+        va -= res;
+  802b4c:	48 63 ca             	movslq %edx,%rcx
+  802b4f:	48 29 ce             	sub    %rcx,%rsi
+  802b52:	48 89 b5 f0 fc ff ff 	mov    %rsi,-0x310(%rbp)
+        memsz += res;
+  802b59:	49 01 cf             	add    %rcx,%r15
+        filesz += res;
+  802b5c:	48 01 cb             	add    %rcx,%rbx
+  802b5f:	48 89 9d d8 fc ff ff 	mov    %rbx,-0x328(%rbp)
+        fileoffset -= res;
+  802b66:	29 d0                	sub    %edx,%eax
+  802b68:	89 85 e0 fc ff ff    	mov    %eax,-0x320(%rbp)
+    res = region_queue_op(REGION_ALLOC, 0, NULL, 0, UTEMP, memsz, PROT_RW | PROT_X | ALLOC_ZERO);
+  802b6e:	48 83 ec 08          	sub    $0x8,%rsp
+  802b72:	68 07 00 10 00       	push   $0x100007
+  802b77:	4d 89 f9             	mov    %r15,%r9
+  802b7a:	41 b8 00 00 40 00    	mov    $0x400000,%r8d
+  802b80:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802b85:	ba 00 00 00 00       	mov    $0x0,%edx
+  802b8a:	be 00 00 00 00       	mov    $0x0,%esi
+  802b8f:	bf 00 00 00 00       	mov    $0x0,%edi
+  802b94:	48 b8 50 25 80 00 00 	movabs $0x802550,%rax
+  802b9b:	00 00 00 
+  802b9e:	ff d0                	call   *%rax
+  802ba0:	89 c3                	mov    %eax,%ebx
+    if (res < 0 || (res = region_flush()) < 0) {
+  802ba2:	48 83 c4 10          	add    $0x10,%rsp
+  802ba6:	85 c0                	test   %eax,%eax
+  802ba8:	0f 88 b0 01 00 00    	js     802d5e <spawn+0x708>
+  802bae:	48 b9 a3 24 80 00 00 	movabs $0x8024a3,%rcx
+  802bb5:	00 00 00 
+  802bb8:	ff d1                	call   *%rcx
+  802bba:	89 c3                	mov    %eax,%ebx
+  802bbc:	85 c0                	test   %eax,%eax
+  802bbe:	0f 88 9a 01 00 00    	js     802d5e <spawn+0x708>
+    res = seek(fd, fileoffset);
+  802bc4:	8b b5 e0 fc ff ff    	mov    -0x320(%rbp),%esi
+  802bca:	8b bd fc fc ff ff    	mov    -0x304(%rbp),%edi
+  802bd0:	48 b9 93 1e 80 00 00 	movabs $0x801e93,%rcx
+  802bd7:	00 00 00 
+  802bda:	ff d1                	call   *%rcx
+  802bdc:	89 c3                	mov    %eax,%ebx
+    if (res < 0) {
+  802bde:	85 c0                	test   %eax,%eax
+  802be0:	78 28                	js     802c0a <spawn+0x5b4>
+    res = readn(fd, UTEMP, filesz);
+  802be2:	48 8b 95 d8 fc ff ff 	mov    -0x328(%rbp),%rdx
+  802be9:	be 00 00 40 00       	mov    $0x400000,%esi
+  802bee:	8b bd fc fc ff ff    	mov    -0x304(%rbp),%edi
+  802bf4:	48 b9 69 1d 80 00 00 	movabs $0x801d69,%rcx
+  802bfb:	00 00 00 
+  802bfe:	ff d1                	call   *%rcx
+  802c00:	89 c3                	mov    %eax,%ebx
+    if (res < 0) {
+  802c02:	85 c0                	test   %eax,%eax
+  802c04:	0f 89 5f fe ff ff    	jns    802a69 <spawn+0x413>
+    region_queue_op(REGION_UNMAP, 0, NULL, 0, UTEMP, memsz, 0);
+  802c0a:	48 83 ec 08          	sub    $0x8,%rsp
+  802c0e:	6a 00                	push   $0x0
+  802c10:	4d 89 f9             	mov    %r15,%r9
+  802c13:	41 b8 00 00 40 00    	mov    $0x400000,%r8d
+  802c19:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802c1e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802c23:	be 00 00 00 00       	mov    $0x0,%esi
+  802c28:	bf 02 00 00 00       	mov    $0x2,%edi
+  802c2d:	48 b8 50 25 80 00 00 	movabs $0x802550,%rax
+  802c34:	00 00 00 
+  802c37:	ff d0                	call   *%rax
+  802c39:	48 83 c4 10          	add    $0x10,%rsp
+  802c3d:	e9 1c 01 00 00       	jmp    802d5e <spawn+0x708>
+    close(fd);
+  802c42:	8b bd fc fc ff ff    	mov    -0x304(%rbp),%edi
+  802c48:	48 b8 2d 1b 80 00 00 	movabs $0x801b2d,%rax
+  802c4f:	00 00 00 
+  802c52:	ff d0                	call   *%rax
+    if ((res = foreach_shared_region(copy_shared_region, &child)) < 0 ||
+  802c54:	48 8d b5 cc fd ff ff 	lea    -0x234(%rbp),%rsi
+  802c5b:	48 bf ff 25 80 00 00 	movabs $0x8025ff,%rdi
+  802c62:	00 00 00 
+  802c65:	48 b8 7b 35 80 00 00 	movabs $0x80357b,%rax
+  802c6c:	00 00 00 
+  802c6f:	ff d0                	call   *%rax
+  802c71:	85 c0                	test   %eax,%eax
+  802c73:	78 59                	js     802cce <spawn+0x678>
+        (res = region_flush()) < 0)
+  802c75:	48 b8 a3 24 80 00 00 	movabs $0x8024a3,%rax
+  802c7c:	00 00 00 
+  802c7f:	ff d0                	call   *%rax
+    if ((res = foreach_shared_region(copy_shared_region, &child)) < 0 ||
+  802c81:	85 c0                	test   %eax,%eax
+  802c83:	78 49                	js     802cce <spawn+0x678>
+    if ((res = sys_env_set_trapframe(child, &child_tf)) < 0)
+  802c85:	48 8d b5 0c fd ff ff 	lea    -0x2f4(%rbp),%rsi
+  802c8c:	8b bd cc fd ff ff    	mov    -0x234(%rbp),%edi
+  802c92:	48 b8 3c 16 80 00 00 	movabs $0x80163c,%rax
+  802c99:	00 00 00 
+  802c9c:	ff d0                	call   *%rax
+  802c9e:	85 c0                	test   %eax,%eax
+  802ca0:	78 59                	js     802cfb <spawn+0x6a5>
+    if ((res = sys_env_set_status(child, ENV_RUNNABLE)) < 0)
+  802ca2:	be 02 00 00 00       	mov    $0x2,%esi
+  802ca7:	8b bd cc fd ff ff    	mov    -0x234(%rbp),%edi
+  802cad:	48 b8 04 15 80 00 00 	movabs $0x801504,%rax
+  802cb4:	00 00 00 
+  802cb7:	ff d0                	call   *%rax
+  802cb9:	85 c0                	test   %eax,%eax
+  802cbb:	78 6b                	js     802d28 <spawn+0x6d2>
+    return child;
+  802cbd:	8b 85 cc fd ff ff    	mov    -0x234(%rbp),%eax
+  802cc3:	89 85 fc fc ff ff    	mov    %eax,-0x304(%rbp)
+  802cc9:	e9 c6 00 00 00       	jmp    802d94 <spawn+0x73e>
+        panic("copy_shared_region: %i", res);
+  802cce:	89 c1                	mov    %eax,%ecx
+  802cd0:	48 ba db 42 80 00 00 	movabs $0x8042db,%rdx
+  802cd7:	00 00 00 
+  802cda:	be a8 00 00 00       	mov    $0xa8,%esi
+  802cdf:	48 bf cf 42 80 00 00 	movabs $0x8042cf,%rdi
+  802ce6:	00 00 00 
+  802ce9:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cee:	49 b8 43 03 80 00 00 	movabs $0x800343,%r8
+  802cf5:	00 00 00 
+  802cf8:	41 ff d0             	call   *%r8
+        panic("sys_env_set_trapframe: %i", res);
+  802cfb:	89 c1                	mov    %eax,%ecx
+  802cfd:	48 ba f2 42 80 00 00 	movabs $0x8042f2,%rdx
+  802d04:	00 00 00 
+  802d07:	be ab 00 00 00       	mov    $0xab,%esi
+  802d0c:	48 bf cf 42 80 00 00 	movabs $0x8042cf,%rdi
+  802d13:	00 00 00 
+  802d16:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d1b:	49 b8 43 03 80 00 00 	movabs $0x800343,%r8
+  802d22:	00 00 00 
+  802d25:	41 ff d0             	call   *%r8
+        panic("sys_env_set_status: %i", res);
+  802d28:	89 c1                	mov    %eax,%ecx
+  802d2a:	48 ba 0c 43 80 00 00 	movabs $0x80430c,%rdx
+  802d31:	00 00 00 
+  802d34:	be ae 00 00 00       	mov    $0xae,%esi
+  802d39:	48 bf cf 42 80 00 00 	movabs $0x8042cf,%rdi
+  802d40:	00 00 00 
+  802d43:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d48:	49 b8 43 03 80 00 00 	movabs $0x800343,%r8
+  802d4f:	00 00 00 
+  802d52:	41 ff d0             	call   *%r8
+    if ((void *)(argv_store - 2) < (void *)UTEMP) return -E_NO_MEM;
+  802d55:	41 bd fc ff ff ff    	mov    $0xfffffffc,%r13d
+    for (size_t i = 0; i < elf->e_phnum; i++, ph++) {
+  802d5b:	44 89 eb             	mov    %r13d,%ebx
+    region_flush();
+  802d5e:	48 b8 a3 24 80 00 00 	movabs $0x8024a3,%rax
+  802d65:	00 00 00 
+  802d68:	ff d0                	call   *%rax
+    sys_env_destroy(child);
+  802d6a:	8b bd cc fd ff ff    	mov    -0x234(%rbp),%edi
+  802d70:	48 b8 3d 12 80 00 00 	movabs $0x80123d,%rax
+  802d77:	00 00 00 
+  802d7a:	ff d0                	call   *%rax
+    close(fd);
+  802d7c:	8b bd fc fc ff ff    	mov    -0x304(%rbp),%edi
+  802d82:	48 b8 2d 1b 80 00 00 	movabs $0x801b2d,%rax
+  802d89:	00 00 00 
+  802d8c:	ff d0                	call   *%rax
+    return res;
+  802d8e:	89 9d fc fc ff ff    	mov    %ebx,-0x304(%rbp)
+}
+  802d94:	8b 85 fc fc ff ff    	mov    -0x304(%rbp),%eax
+  802d9a:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  802d9e:	5b                   	pop    %rbx
+  802d9f:	41 5c                	pop    %r12
+  802da1:	41 5d                	pop    %r13
+  802da3:	41 5e                	pop    %r14
+  802da5:	41 5f                	pop    %r15
+  802da7:	5d                   	pop    %rbp
+  802da8:	c3                   	ret
+
+0000000000802da9 <spawnl>:
+spawnl(const char *prog, const char *arg0, ...) {
+  802da9:	55                   	push   %rbp
+  802daa:	48 89 e5             	mov    %rsp,%rbp
+  802dad:	48 83 ec 50          	sub    $0x50,%rsp
+  802db1:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  802db5:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  802db9:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  802dbd:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(vl, arg0);
+  802dc1:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  802dc8:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802dcc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802dd0:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  802dd4:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int argc = 0;
+  802dd8:	b9 00 00 00 00       	mov    $0x0,%ecx
+    while (va_arg(vl, void *) != NULL) argc++;
+  802ddd:	eb 15                	jmp    802df4 <spawnl+0x4b>
+  802ddf:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802de3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802de7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802deb:	48 83 3a 00          	cmpq   $0x0,(%rdx)
+  802def:	74 1c                	je     802e0d <spawnl+0x64>
+  802df1:	83 c1 01             	add    $0x1,%ecx
+  802df4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802df7:	83 f8 2f             	cmp    $0x2f,%eax
+  802dfa:	77 e3                	ja     802ddf <spawnl+0x36>
+  802dfc:	89 c2                	mov    %eax,%edx
+  802dfe:	4c 8d 55 d0          	lea    -0x30(%rbp),%r10
+  802e02:	4c 01 d2             	add    %r10,%rdx
+  802e05:	83 c0 08             	add    $0x8,%eax
+  802e08:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802e0b:	eb de                	jmp    802deb <spawnl+0x42>
+    const char *argv[argc + 2];
+  802e0d:	8d 41 02             	lea    0x2(%rcx),%eax
+  802e10:	48 98                	cltq
+  802e12:	48 8d 04 c5 0f 00 00 	lea    0xf(,%rax,8),%rax
+  802e19:	00 
+  802e1a:	48 83 e0 f0          	and    $0xfffffffffffffff0,%rax
+  802e1e:	48 29 c4             	sub    %rax,%rsp
+  802e21:	4c 8d 44 24 07       	lea    0x7(%rsp),%r8
+  802e26:	4c 89 c0             	mov    %r8,%rax
+  802e29:	48 c1 e8 03          	shr    $0x3,%rax
+  802e2d:	49 83 e0 f8          	and    $0xfffffffffffffff8,%r8
+    argv[0] = arg0;
+  802e31:	48 89 34 c5 00 00 00 	mov    %rsi,0x0(,%rax,8)
+  802e38:	00 
+    argv[argc + 1] = NULL;
+  802e39:	8d 41 01             	lea    0x1(%rcx),%eax
+  802e3c:	48 98                	cltq
+  802e3e:	49 c7 04 c0 00 00 00 	movq   $0x0,(%r8,%rax,8)
+  802e45:	00 
+    va_start(vl, arg0);
+  802e46:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  802e4d:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802e51:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802e55:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  802e59:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    for (i = 0; i < argc; i++) {
+  802e5d:	85 c9                	test   %ecx,%ecx
+  802e5f:	74 41                	je     802ea2 <spawnl+0xf9>
+        argv[i + 1] = va_arg(vl, const char *);
+  802e61:	49 89 c1             	mov    %rax,%r9
+  802e64:	49 8d 40 08          	lea    0x8(%r8),%rax
+  802e68:	8d 51 ff             	lea    -0x1(%rcx),%edx
+  802e6b:	49 8d 74 d0 10       	lea    0x10(%r8,%rdx,8),%rsi
+  802e70:	eb 1b                	jmp    802e8d <spawnl+0xe4>
+  802e72:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  802e76:	48 8d 51 08          	lea    0x8(%rcx),%rdx
+  802e7a:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  802e7e:	48 8b 11             	mov    (%rcx),%rdx
+  802e81:	48 89 10             	mov    %rdx,(%rax)
+    for (i = 0; i < argc; i++) {
+  802e84:	48 83 c0 08          	add    $0x8,%rax
+  802e88:	48 39 f0             	cmp    %rsi,%rax
+  802e8b:	74 15                	je     802ea2 <spawnl+0xf9>
+        argv[i + 1] = va_arg(vl, const char *);
+  802e8d:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  802e90:	83 fa 2f             	cmp    $0x2f,%edx
+  802e93:	77 dd                	ja     802e72 <spawnl+0xc9>
+  802e95:	89 d1                	mov    %edx,%ecx
+  802e97:	4c 01 c9             	add    %r9,%rcx
+  802e9a:	83 c2 08             	add    $0x8,%edx
+  802e9d:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  802ea0:	eb dc                	jmp    802e7e <spawnl+0xd5>
+    return spawn(prog, argv);
+  802ea2:	4c 89 c6             	mov    %r8,%rsi
+  802ea5:	48 b8 56 26 80 00 00 	movabs $0x802656,%rax
+  802eac:	00 00 00 
+  802eaf:	ff d0                	call   *%rax
+}
+  802eb1:	c9                   	leave
+  802eb2:	c3                   	ret
+
+0000000000802eb3 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  802eb3:	55                   	push   %rbp
+  802eb4:	48 89 e5             	mov    %rsp,%rbp
+  802eb7:	41 54                	push   %r12
+  802eb9:	53                   	push   %rbx
+  802eba:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802ebd:	48 b8 19 19 80 00 00 	movabs $0x801919,%rax
+  802ec4:	00 00 00 
+  802ec7:	ff d0                	call   *%rax
+  802ec9:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  802ecc:	48 be 23 43 80 00 00 	movabs $0x804323,%rsi
+  802ed3:	00 00 00 
+  802ed6:	48 89 df             	mov    %rbx,%rdi
+  802ed9:	48 b8 b8 0d 80 00 00 	movabs $0x800db8,%rax
+  802ee0:	00 00 00 
+  802ee3:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  802ee5:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  802eea:	41 2b 04 24          	sub    (%r12),%eax
+  802eee:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  802ef4:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  802efb:	00 00 00 
+    stat->st_dev = &devpipe;
+  802efe:	48 b8 60 50 80 00 00 	movabs $0x805060,%rax
+  802f05:	00 00 00 
+  802f08:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  802f0f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f14:	5b                   	pop    %rbx
+  802f15:	41 5c                	pop    %r12
+  802f17:	5d                   	pop    %rbp
+  802f18:	c3                   	ret
+
+0000000000802f19 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  802f19:	55                   	push   %rbp
+  802f1a:	48 89 e5             	mov    %rsp,%rbp
+  802f1d:	41 54                	push   %r12
+  802f1f:	53                   	push   %rbx
+  802f20:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  802f23:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802f28:	48 89 fe             	mov    %rdi,%rsi
+  802f2b:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f30:	49 bc 34 14 80 00 00 	movabs $0x801434,%r12
+  802f37:	00 00 00 
+  802f3a:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  802f3d:	48 89 df             	mov    %rbx,%rdi
+  802f40:	48 b8 19 19 80 00 00 	movabs $0x801919,%rax
+  802f47:	00 00 00 
+  802f4a:	ff d0                	call   *%rax
+  802f4c:	48 89 c6             	mov    %rax,%rsi
+  802f4f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802f54:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f59:	41 ff d4             	call   *%r12
+}
+  802f5c:	5b                   	pop    %rbx
+  802f5d:	41 5c                	pop    %r12
+  802f5f:	5d                   	pop    %rbp
+  802f60:	c3                   	ret
+
+0000000000802f61 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  802f61:	55                   	push   %rbp
+  802f62:	48 89 e5             	mov    %rsp,%rbp
+  802f65:	41 57                	push   %r15
+  802f67:	41 56                	push   %r14
+  802f69:	41 55                	push   %r13
+  802f6b:	41 54                	push   %r12
+  802f6d:	53                   	push   %rbx
+  802f6e:	48 83 ec 18          	sub    $0x18,%rsp
+  802f72:	49 89 fc             	mov    %rdi,%r12
+  802f75:	49 89 f5             	mov    %rsi,%r13
+  802f78:	49 89 d7             	mov    %rdx,%r15
+  802f7b:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802f7f:	48 b8 19 19 80 00 00 	movabs $0x801919,%rax
+  802f86:	00 00 00 
+  802f89:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  802f8b:	4d 85 ff             	test   %r15,%r15
+  802f8e:	0f 84 af 00 00 00    	je     803043 <devpipe_write+0xe2>
+  802f94:	48 89 c3             	mov    %rax,%rbx
+  802f97:	4c 89 f8             	mov    %r15,%rax
+  802f9a:	4d 89 ef             	mov    %r13,%r15
+  802f9d:	4c 01 e8             	add    %r13,%rax
+  802fa0:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802fa4:	49 bd 3c 13 80 00 00 	movabs $0x80133c,%r13
+  802fab:	00 00 00 
+            sys_yield();
+  802fae:	49 be d9 12 80 00 00 	movabs $0x8012d9,%r14
+  802fb5:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  802fb8:	8b 73 04             	mov    0x4(%rbx),%esi
+  802fbb:	48 63 ce             	movslq %esi,%rcx
+  802fbe:	48 63 03             	movslq (%rbx),%rax
+  802fc1:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  802fc7:	48 39 c1             	cmp    %rax,%rcx
+  802fca:	72 2e                	jb     802ffa <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802fcc:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802fd1:	48 89 da             	mov    %rbx,%rdx
+  802fd4:	be 00 10 00 00       	mov    $0x1000,%esi
+  802fd9:	4c 89 e7             	mov    %r12,%rdi
+  802fdc:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  802fdf:	85 c0                	test   %eax,%eax
+  802fe1:	74 66                	je     803049 <devpipe_write+0xe8>
+            sys_yield();
+  802fe3:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  802fe6:	8b 73 04             	mov    0x4(%rbx),%esi
+  802fe9:	48 63 ce             	movslq %esi,%rcx
+  802fec:	48 63 03             	movslq (%rbx),%rax
+  802fef:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  802ff5:	48 39 c1             	cmp    %rax,%rcx
+  802ff8:	73 d2                	jae    802fcc <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  802ffa:	41 0f b6 3f          	movzbl (%r15),%edi
+  802ffe:	48 89 ca             	mov    %rcx,%rdx
+  803001:	48 c1 ea 03          	shr    $0x3,%rdx
+  803005:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  80300c:	08 10 20 
+  80300f:	48 f7 e2             	mul    %rdx
+  803012:	48 c1 ea 06          	shr    $0x6,%rdx
+  803016:	48 89 d0             	mov    %rdx,%rax
+  803019:	48 c1 e0 09          	shl    $0x9,%rax
+  80301d:	48 29 d0             	sub    %rdx,%rax
+  803020:	48 c1 e0 03          	shl    $0x3,%rax
+  803024:	48 29 c1             	sub    %rax,%rcx
+  803027:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  80302c:	83 c6 01             	add    $0x1,%esi
+  80302f:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803032:	49 83 c7 01          	add    $0x1,%r15
+  803036:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80303a:	49 39 c7             	cmp    %rax,%r15
+  80303d:	0f 85 75 ff ff ff    	jne    802fb8 <devpipe_write+0x57>
+    return n;
+  803043:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803047:	eb 05                	jmp    80304e <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  803049:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80304e:	48 83 c4 18          	add    $0x18,%rsp
+  803052:	5b                   	pop    %rbx
+  803053:	41 5c                	pop    %r12
+  803055:	41 5d                	pop    %r13
+  803057:	41 5e                	pop    %r14
+  803059:	41 5f                	pop    %r15
+  80305b:	5d                   	pop    %rbp
+  80305c:	c3                   	ret
+
+000000000080305d <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  80305d:	55                   	push   %rbp
+  80305e:	48 89 e5             	mov    %rsp,%rbp
+  803061:	41 57                	push   %r15
+  803063:	41 56                	push   %r14
+  803065:	41 55                	push   %r13
+  803067:	41 54                	push   %r12
+  803069:	53                   	push   %rbx
+  80306a:	48 83 ec 18          	sub    $0x18,%rsp
+  80306e:	49 89 fc             	mov    %rdi,%r12
+  803071:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  803075:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803079:	48 b8 19 19 80 00 00 	movabs $0x801919,%rax
+  803080:	00 00 00 
+  803083:	ff d0                	call   *%rax
+  803085:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  803088:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80308e:	49 bd 3c 13 80 00 00 	movabs $0x80133c,%r13
+  803095:	00 00 00 
+            sys_yield();
+  803098:	49 be d9 12 80 00 00 	movabs $0x8012d9,%r14
+  80309f:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  8030a2:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  8030a7:	74 7d                	je     803126 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  8030a9:	8b 03                	mov    (%rbx),%eax
+  8030ab:	3b 43 04             	cmp    0x4(%rbx),%eax
+  8030ae:	75 26                	jne    8030d6 <devpipe_read+0x79>
+            if (i > 0) return i;
+  8030b0:	4d 85 ff             	test   %r15,%r15
+  8030b3:	75 77                	jne    80312c <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8030b5:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8030ba:	48 89 da             	mov    %rbx,%rdx
+  8030bd:	be 00 10 00 00       	mov    $0x1000,%esi
+  8030c2:	4c 89 e7             	mov    %r12,%rdi
+  8030c5:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  8030c8:	85 c0                	test   %eax,%eax
+  8030ca:	74 72                	je     80313e <devpipe_read+0xe1>
+            sys_yield();
+  8030cc:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  8030cf:	8b 03                	mov    (%rbx),%eax
+  8030d1:	3b 43 04             	cmp    0x4(%rbx),%eax
+  8030d4:	74 df                	je     8030b5 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  8030d6:	48 63 c8             	movslq %eax,%rcx
+  8030d9:	48 89 ca             	mov    %rcx,%rdx
+  8030dc:	48 c1 ea 03          	shr    $0x3,%rdx
+  8030e0:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  8030e7:	08 10 20 
+  8030ea:	48 89 d0             	mov    %rdx,%rax
+  8030ed:	48 f7 e6             	mul    %rsi
+  8030f0:	48 c1 ea 06          	shr    $0x6,%rdx
+  8030f4:	48 89 d0             	mov    %rdx,%rax
+  8030f7:	48 c1 e0 09          	shl    $0x9,%rax
+  8030fb:	48 29 d0             	sub    %rdx,%rax
+  8030fe:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  803105:	00 
+  803106:	48 89 c8             	mov    %rcx,%rax
+  803109:	48 29 d0             	sub    %rdx,%rax
+  80310c:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  803111:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  803115:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  803119:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  80311c:	49 83 c7 01          	add    $0x1,%r15
+  803120:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  803124:	75 83                	jne    8030a9 <devpipe_read+0x4c>
+    return n;
+  803126:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80312a:	eb 03                	jmp    80312f <devpipe_read+0xd2>
+            if (i > 0) return i;
+  80312c:	4c 89 f8             	mov    %r15,%rax
+}
+  80312f:	48 83 c4 18          	add    $0x18,%rsp
+  803133:	5b                   	pop    %rbx
+  803134:	41 5c                	pop    %r12
+  803136:	41 5d                	pop    %r13
+  803138:	41 5e                	pop    %r14
+  80313a:	41 5f                	pop    %r15
+  80313c:	5d                   	pop    %rbp
+  80313d:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  80313e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803143:	eb ea                	jmp    80312f <devpipe_read+0xd2>
+
+0000000000803145 <pipe>:
+pipe(int pfd[2]) {
+  803145:	55                   	push   %rbp
+  803146:	48 89 e5             	mov    %rsp,%rbp
+  803149:	41 55                	push   %r13
+  80314b:	41 54                	push   %r12
+  80314d:	53                   	push   %rbx
+  80314e:	48 81 ec b8 00 00 00 	sub    $0xb8,%rsp
+  803155:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803158:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  80315c:	48 b8 ae 19 80 00 00 	movabs $0x8019ae,%rax
+  803163:	00 00 00 
+  803166:	ff d0                	call   *%rax
+  803168:	89 c3                	mov    %eax,%ebx
+  80316a:	85 c0                	test   %eax,%eax
+  80316c:	0f 88 51 01 00 00    	js     8032c3 <pipe+0x17e>
+        (res = fd_alloc_from(fd2num(fd0) + 1, &fd1)) < 0) goto err;
+  803172:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803176:	48 b8 07 19 80 00 00 	movabs $0x801907,%rax
+  80317d:	00 00 00 
+  803180:	ff d0                	call   *%rax
+  803182:	8d 78 01             	lea    0x1(%rax),%edi
+  803185:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  803189:	48 b8 35 19 80 00 00 	movabs $0x801935,%rax
+  803190:	00 00 00 
+  803193:	ff d0                	call   *%rax
+  803195:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803197:	85 c0                	test   %eax,%eax
+  803199:	0f 88 24 01 00 00    	js     8032c3 <pipe+0x17e>
+    va = fd2data(fd0);
+  80319f:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8031a3:	48 bb 19 19 80 00 00 	movabs $0x801919,%rbx
+  8031aa:	00 00 00 
+  8031ad:	ff d3                	call   *%rbx
+  8031af:	49 89 c5             	mov    %rax,%r13
+    struct RegionOp ops[] = {
+  8031b2:	48 8d bd 30 ff ff ff 	lea    -0xd0(%rbp),%rdi
+  8031b9:	b9 14 00 00 00       	mov    $0x14,%ecx
+  8031be:	b8 00 00 00 00       	mov    $0x0,%eax
+  8031c3:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+  8031c6:	c7 85 34 ff ff ff 46 	movl   $0x46,-0xcc(%rbp)
+  8031cd:	00 00 00 
+  8031d0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8031d4:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+  8031db:	48 c7 85 50 ff ff ff 	movq   $0x1000,-0xb0(%rbp)
+  8031e2:	00 10 00 00 
+  8031e6:	c7 85 5c ff ff ff 46 	movl   $0x46,-0xa4(%rbp)
+  8031ed:	00 00 00 
+            {.type = REGION_ALLOC, .dstva = (uintptr_t)fd1, .size = PAGE_SIZE, .perm = PROT_RW | PROT_SHARE},
+  8031f0:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+    struct RegionOp ops[] = {
+  8031f4:	48 89 bd 70 ff ff ff 	mov    %rdi,-0x90(%rbp)
+  8031fb:	48 c7 85 78 ff ff ff 	movq   $0x1000,-0x88(%rbp)
+  803202:	00 10 00 00 
+  803206:	c7 45 84 46 00 00 00 	movl   $0x46,-0x7c(%rbp)
+  80320d:	4c 89 6d 98          	mov    %r13,-0x68(%rbp)
+  803211:	48 c7 45 a0 00 10 00 	movq   $0x1000,-0x60(%rbp)
+  803218:	00 
+  803219:	c7 45 a8 01 00 00 00 	movl   $0x1,-0x58(%rbp)
+  803220:	c7 45 ac 46 00 00 00 	movl   $0x46,-0x54(%rbp)
+  803227:	4c 89 6d b8          	mov    %r13,-0x48(%rbp)
+            {.type = REGION_MAP, .srcva = (uintptr_t)va, .dstva = (uintptr_t)fd2data(fd1), .size = PAGE_SIZE, .perm = PROT_RW | PROT_SHARE},
+  80322b:	ff d3                	call   *%rbx
+    struct RegionOp ops[] = {
+  80322d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803231:	48 c7 45 c8 00 10 00 	movq   $0x1000,-0x38(%rbp)
+  803238:	00 
+    if ((res = sys_region_batch(ops, sizeof ops / sizeof *ops)) < 0) goto err1;
+  803239:	be 04 00 00 00       	mov    $0x4,%esi
+  80323e:	48 8d bd 30 ff ff ff 	lea    -0xd0(%rbp),%rdi
+  803245:	48 b8 9b 14 80 00 00 	movabs $0x80149b,%rax
+  80324c:	00 00 00 
+  80324f:	ff d0                	call   *%rax
+  803251:	89 c3                	mov    %eax,%ebx
+  803253:	85 c0                	test   %eax,%eax
+  803255:	0f 88 ad 00 00 00    	js     803308 <pipe+0x1c3>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  80325b:	be 00 10 00 00       	mov    $0x1000,%esi
+  803260:	4c 89 ef             	mov    %r13,%rdi
+  803263:	48 b8 0a 13 80 00 00 	movabs $0x80130a,%rax
+  80326a:	00 00 00 
+  80326d:	ff d0                	call   *%rax
+  80326f:	83 f8 02             	cmp    $0x2,%eax
+  803272:	75 5f                	jne    8032d3 <pipe+0x18e>
+    fd0->fd_dev_id = devpipe.dev_id;
+  803274:	a1 60 50 80 00 00 00 	movabs 0x805060,%eax
+  80327b:	00 00 
+  80327d:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803281:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  803283:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803287:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  80328e:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  803292:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  803294:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803298:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  80329f:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8032a3:	48 bb 07 19 80 00 00 	movabs $0x801907,%rbx
+  8032aa:	00 00 00 
+  8032ad:	ff d3                	call   *%rbx
+  8032af:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  8032b3:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  8032b7:	ff d3                	call   *%rbx
+  8032b9:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  8032be:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  8032c3:	89 d8                	mov    %ebx,%eax
+  8032c5:	48 81 c4 b8 00 00 00 	add    $0xb8,%rsp
+  8032cc:	5b                   	pop    %rbx
+  8032cd:	41 5c                	pop    %r12
+  8032cf:	41 5d                	pop    %r13
+  8032d1:	5d                   	pop    %rbp
+  8032d2:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8032d3:	48 b9 40 43 80 00 00 	movabs $0x804340,%rcx
+  8032da:	00 00 00 
+  8032dd:	48 ba ba 42 80 00 00 	movabs $0x8042ba,%rdx
+  8032e4:	00 00 00 
+  8032e7:	be 33 00 00 00       	mov    $0x33,%esi
+  8032ec:	48 bf 2a 43 80 00 00 	movabs $0x80432a,%rdi
+  8032f3:	00 00 00 
+  8032f6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8032fb:	49 b8 43 03 80 00 00 	movabs $0x800343,%r8
+  803302:	00 00 00 
+  803305:	41 ff d0             	call   *%r8
+        ops[i].type = REGION_UNMAP;
+  803308:	c7 85 30 ff ff ff 02 	movl   $0x2,-0xd0(%rbp)
+  80330f:	00 00 00 
+  803312:	c7 85 58 ff ff ff 02 	movl   $0x2,-0xa8(%rbp)
+  803319:	00 00 00 
+  80331c:	c7 45 80 02 00 00 00 	movl   $0x2,-0x80(%rbp)
+  803323:	c7 45 a8 02 00 00 00 	movl   $0x2,-0x58(%rbp)
+    sys_region_batch(ops, sizeof ops / sizeof *ops);
+  80332a:	be 04 00 00 00       	mov    $0x4,%esi
+  80332f:	48 8d bd 30 ff ff ff 	lea    -0xd0(%rbp),%rdi
+  803336:	48 b8 9b 14 80 00 00 	movabs $0x80149b,%rax
+  80333d:	00 00 00 
+  803340:	ff d0                	call   *%rax
+  803342:	e9 7c ff ff ff       	jmp    8032c3 <pipe+0x17e>
+
+0000000000803347 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  803347:	55                   	push   %rbp
+  803348:	48 89 e5             	mov    %rsp,%rbp
+  80334b:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  80334f:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803353:	48 b8 c8 19 80 00 00 	movabs $0x8019c8,%rax
+  80335a:	00 00 00 
+  80335d:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80335f:	85 c0                	test   %eax,%eax
+  803361:	78 35                	js     803398 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  803363:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803367:	48 b8 19 19 80 00 00 	movabs $0x801919,%rax
+  80336e:	00 00 00 
+  803371:	ff d0                	call   *%rax
+  803373:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803376:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80337b:	be 00 10 00 00       	mov    $0x1000,%esi
+  803380:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803384:	48 b8 3c 13 80 00 00 	movabs $0x80133c,%rax
+  80338b:	00 00 00 
+  80338e:	ff d0                	call   *%rax
+  803390:	85 c0                	test   %eax,%eax
+  803392:	0f 94 c0             	sete   %al
+  803395:	0f b6 c0             	movzbl %al,%eax
+}
+  803398:	c9                   	leave
+  803399:	c3                   	ret
+
+000000000080339a <wait>:
+#include <inc/lib.h>
+
+/* Waits until 'envid' exits. */
+void
+wait(envid_t envid) {
+  80339a:	55                   	push   %rbp
+  80339b:	48 89 e5             	mov    %rsp,%rbp
+  80339e:	41 55                	push   %r13
+  8033a0:	41 54                	push   %r12
+  8033a2:	53                   	push   %rbx
+  8033a3:	48 83 ec 08          	sub    $0x8,%rsp
+    assert(envid != 0);
+  8033a7:	85 ff                	test   %edi,%edi
+  8033a9:	74 73                	je     80341e <wait+0x84>
+  8033ab:	41 89 fc             	mov    %edi,%r12d
+
+    const volatile struct Env *env = &envs[ENVX(envid)];
+  8033ae:	89 f8                	mov    %edi,%eax
+  8033b0:	25 ff 03 00 00       	and    $0x3ff,%eax
+
+    while (env->env_id == envid &&
+  8033b5:	89 f9                	mov    %edi,%ecx
+  8033b7:	81 e1 ff 03 00 00    	and    $0x3ff,%ecx
+  8033bd:	48 69 c9 d0 01 00 00 	imul   $0x1d0,%rcx,%rcx
+  8033c4:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8033cb:	00 00 00 
+  8033ce:	48 01 ca             	add    %rcx,%rdx
+  8033d1:	8b 92 e0 00 00 00    	mov    0xe0(%rdx),%edx
+  8033d7:	39 d7                	cmp    %edx,%edi
+  8033d9:	75 38                	jne    803413 <wait+0x79>
+           env->env_status != ENV_FREE) {
+  8033db:	48 98                	cltq
+  8033dd:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+  8033e4:	48 bb 00 00 c0 1f 80 	movabs $0x801fc00000,%rbx
+  8033eb:	00 00 00 
+  8033ee:	48 01 c3             	add    %rax,%rbx
+        sys_yield();
+  8033f1:	49 bd d9 12 80 00 00 	movabs $0x8012d9,%r13
+  8033f8:	00 00 00 
+           env->env_status != ENV_FREE) {
+  8033fb:	8b 83 ec 00 00 00    	mov    0xec(%rbx),%eax
+    while (env->env_id == envid &&
+  803401:	85 c0                	test   %eax,%eax
+  803403:	74 0e                	je     803413 <wait+0x79>
+        sys_yield();
+  803405:	41 ff d5             	call   *%r13
+    while (env->env_id == envid &&
+  803408:	8b 83 e0 00 00 00    	mov    0xe0(%rbx),%eax
+  80340e:	44 39 e0             	cmp    %r12d,%eax
+  803411:	74 e8                	je     8033fb <wait+0x61>
+    }
+}
+  803413:	48 83 c4 08          	add    $0x8,%rsp
+  803417:	5b                   	pop    %rbx
+  803418:	41 5c                	pop    %r12
+  80341a:	41 5d                	pop    %r13
+  80341c:	5d                   	pop    %rbp
+  80341d:	c3                   	ret
+    assert(envid != 0);
+  80341e:	48 b9 64 43 80 00 00 	movabs $0x804364,%rcx
+  803425:	00 00 00 
+  803428:	48 ba ba 42 80 00 00 	movabs $0x8042ba,%rdx
+  80342f:	00 00 00 
+  803432:	be 06 00 00 00       	mov    $0x6,%esi
+  803437:	48 bf 6f 43 80 00 00 	movabs $0x80436f,%rdi
+  80343e:	00 00 00 
+  803441:	b8 00 00 00 00       	mov    $0x0,%eax
+  803446:	49 b8 43 03 80 00 00 	movabs $0x800343,%r8
+  80344d:	00 00 00 
+  803450:	41 ff d0             	call   *%r8
+
+0000000000803453 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803453:	48 89 f8             	mov    %rdi,%rax
+  803456:	48 c1 e8 27          	shr    $0x27,%rax
+  80345a:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  803461:	01 00 00 
+  803464:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803468:	f6 c2 01             	test   $0x1,%dl
+  80346b:	74 6d                	je     8034da <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  80346d:	48 89 f8             	mov    %rdi,%rax
+  803470:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803474:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  80347b:	01 00 00 
+  80347e:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803482:	f6 c2 01             	test   $0x1,%dl
+  803485:	74 62                	je     8034e9 <get_uvpt_entry+0x96>
+  803487:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  80348e:	01 00 00 
+  803491:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803495:	f6 c2 80             	test   $0x80,%dl
+  803498:	75 4f                	jne    8034e9 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  80349a:	48 89 f8             	mov    %rdi,%rax
+  80349d:	48 c1 e8 15          	shr    $0x15,%rax
+  8034a1:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8034a8:	01 00 00 
+  8034ab:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8034af:	f6 c2 01             	test   $0x1,%dl
+  8034b2:	74 44                	je     8034f8 <get_uvpt_entry+0xa5>
+  8034b4:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8034bb:	01 00 00 
+  8034be:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8034c2:	f6 c2 80             	test   $0x80,%dl
+  8034c5:	75 31                	jne    8034f8 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  8034c7:	48 c1 ef 0c          	shr    $0xc,%rdi
+  8034cb:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8034d2:	01 00 00 
+  8034d5:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  8034d9:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8034da:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  8034e1:	01 00 00 
+  8034e4:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8034e8:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8034e9:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8034f0:	01 00 00 
+  8034f3:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8034f7:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8034f8:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8034ff:	01 00 00 
+  803502:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803506:	c3                   	ret
+
+0000000000803507 <get_prot>:
+
+int
+get_prot(void *va) {
+  803507:	55                   	push   %rbp
+  803508:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  80350b:	48 b8 53 34 80 00 00 	movabs $0x803453,%rax
+  803512:	00 00 00 
+  803515:	ff d0                	call   *%rax
+  803517:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  80351a:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  80351f:	89 c1                	mov    %eax,%ecx
+  803521:	83 c9 04             	or     $0x4,%ecx
+  803524:	f6 c2 01             	test   $0x1,%dl
+  803527:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  80352a:	89 c1                	mov    %eax,%ecx
+  80352c:	83 c9 02             	or     $0x2,%ecx
+  80352f:	f6 c2 02             	test   $0x2,%dl
+  803532:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  803535:	89 c1                	mov    %eax,%ecx
+  803537:	83 c9 01             	or     $0x1,%ecx
+  80353a:	48 85 d2             	test   %rdx,%rdx
+  80353d:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  803540:	89 c1                	mov    %eax,%ecx
+  803542:	83 c9 40             	or     $0x40,%ecx
+  803545:	f6 c6 04             	test   $0x4,%dh
+  803548:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  80354b:	5d                   	pop    %rbp
+  80354c:	c3                   	ret
+
+000000000080354d <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  80354d:	55                   	push   %rbp
+  80354e:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803551:	48 b8 53 34 80 00 00 	movabs $0x803453,%rax
+  803558:	00 00 00 
+  80355b:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  80355d:	48 c1 e8 06          	shr    $0x6,%rax
+  803561:	83 e0 01             	and    $0x1,%eax
+}
+  803564:	5d                   	pop    %rbp
+  803565:	c3                   	ret
+
+0000000000803566 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  803566:	55                   	push   %rbp
+  803567:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  80356a:	48 b8 53 34 80 00 00 	movabs $0x803453,%rax
+  803571:	00 00 00 
+  803574:	ff d0                	call   *%rax
+  803576:	83 e0 01             	and    $0x1,%eax
+}
+  803579:	5d                   	pop    %rbp
+  80357a:	c3                   	ret
+
+000000000080357b <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  80357b:	55                   	push   %rbp
+  80357c:	48 89 e5             	mov    %rsp,%rbp
+  80357f:	41 57                	push   %r15
+  803581:	41 56                	push   %r14
+  803583:	41 55                	push   %r13
+  803585:	41 54                	push   %r12
+  803587:	53                   	push   %rbx
+  803588:	48 83 ec 38          	sub    $0x38,%rsp
+  80358c:	49 89 f7             	mov    %rsi,%r15
+  80358f:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+                    }
+                    continue;
+                }
+                for (int ptei = 0; ptei < PT_ENTRY_COUNT; ptei++) {
+                    uintptr_t pte_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, pdei, ptei, 0);
+                    pte_t pte = uvpt[VPT(pte_addr)];
+  803595:	49 bd 00 00 00 00 00 	movabs $0x10000000000,%r13
+  80359c:	01 00 00 
+  80359f:	4d 89 e6             	mov    %r12,%r14
+  8035a2:	49 89 fc             	mov    %rdi,%r12
+  8035a5:	e9 19 01 00 00       	jmp    8036c3 <foreach_shared_region+0x148>
+  8035aa:	48 89 5d b0          	mov    %rbx,-0x50(%rbp)
+  8035ae:	4c 89 75 a8          	mov    %r14,-0x58(%rbp)
+  8035b2:	eb 52                	jmp    803606 <foreach_shared_region+0x8b>
+                for (int ptei = 0; ptei < PT_ENTRY_COUNT; ptei++) {
+  8035b4:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8035bb:	48 81 fb 00 00 20 00 	cmp    $0x200000,%rbx
+  8035c2:	74 2e                	je     8035f2 <foreach_shared_region+0x77>
+                    uintptr_t pte_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, pdei, ptei, 0);
+  8035c4:	48 89 df             	mov    %rbx,%rdi
+  8035c7:	4c 09 f7             	or     %r14,%rdi
+                    pte_t pte = uvpt[VPT(pte_addr)];
+  8035ca:	48 89 f8             	mov    %rdi,%rax
+  8035cd:	48 c1 e8 0c          	shr    $0xc,%rax
+  8035d1:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+                    if ((pte & PTE_P) && (pte & PTE_SHARE)) {
+  8035d6:	25 01 04 00 00       	and    $0x401,%eax
+  8035db:	48 3d 01 04 00 00    	cmp    $0x401,%rax
+  8035e1:	75 d1                	jne    8035b4 <foreach_shared_region+0x39>
+                        fun((void*)pte_addr, (void*)(pte_addr + PAGE_SIZE), arg);
+  8035e3:	48 8d b7 00 10 00 00 	lea    0x1000(%rdi),%rsi
+  8035ea:	4c 89 fa             	mov    %r15,%rdx
+  8035ed:	41 ff d4             	call   *%r12
+  8035f0:	eb c2                	jmp    8035b4 <foreach_shared_region+0x39>
+            for (int pdei = 0; pdei < PD_ENTRY_COUNT; pdei++) {
+  8035f2:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  8035f9:	00 
+  8035fa:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8035fe:	48 3d 00 00 00 40    	cmp    $0x40000000,%rax
+  803604:	74 46                	je     80364c <foreach_shared_region+0xd1>
+                uintptr_t pde_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, pdei, 0, 0);
+  803606:	4c 8b 75 c8          	mov    -0x38(%rbp),%r14
+  80360a:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80360e:	49 09 c6             	or     %rax,%r14
+                pde_t pde = uvpd[VPD(pde_addr)];
+  803611:	4c 89 f0             	mov    %r14,%rax
+  803614:	48 c1 e8 15          	shr    $0x15,%rax
+  803618:	48 b9 00 00 00 80 00 	movabs $0x10080000000,%rcx
+  80361f:	01 00 00 
+  803622:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+                if (!(pde & PTE_P)) {
+  803626:	a8 01                	test   $0x1,%al
+  803628:	74 c8                	je     8035f2 <foreach_shared_region+0x77>
+                if (pde & PTE_PS) {
+  80362a:	48 89 c3             	mov    %rax,%rbx
+  80362d:	81 e3 80 00 00 00    	and    $0x80,%ebx
+  803633:	74 8f                	je     8035c4 <foreach_shared_region+0x49>
+                    if (pde & PTE_SHARE) {
+  803635:	f6 c4 04             	test   $0x4,%ah
+  803638:	74 b8                	je     8035f2 <foreach_shared_region+0x77>
+                        fun((void*)pde_addr, (void*)(pde_addr + 1024 * 1024 * 2), arg);
+  80363a:	49 8d b6 00 00 20 00 	lea    0x200000(%r14),%rsi
+  803641:	4c 89 fa             	mov    %r15,%rdx
+  803644:	4c 89 f7             	mov    %r14,%rdi
+  803647:	41 ff d4             	call   *%r12
+  80364a:	eb a6                	jmp    8035f2 <foreach_shared_region+0x77>
+  80364c:	48 8b 5d b0          	mov    -0x50(%rbp),%rbx
+  803650:	4c 8b 75 a8          	mov    -0x58(%rbp),%r14
+        for (int pdpei = 0; pdpei < PDP_ENTRY_COUNT; pdpei++) {
+  803654:	48 81 c3 00 00 00 40 	add    $0x40000000,%rbx
+  80365b:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803662:	00 00 00 
+  803665:	48 39 c3             	cmp    %rax,%rbx
+  803668:	74 4c                	je     8036b6 <foreach_shared_region+0x13b>
+            uintptr_t pdpe_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, 0, 0, 0);
+  80366a:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  80366e:	48 09 d8             	or     %rbx,%rax
+  803671:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+            pdpe_t pdpe = uvpdp[VPDP(pdpe_addr)];
+  803675:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803679:	48 b9 00 00 40 80 00 	movabs $0x10080400000,%rcx
+  803680:	01 00 00 
+  803683:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+            if (!(pdpe & PTE_P)) {
+  803687:	a8 01                	test   $0x1,%al
+  803689:	74 c9                	je     803654 <foreach_shared_region+0xd9>
+            if (pdpe & PTE_PS) {
+  80368b:	48 89 c1             	mov    %rax,%rcx
+  80368e:	81 e1 80 00 00 00    	and    $0x80,%ecx
+  803694:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  803698:	0f 84 0c ff ff ff    	je     8035aa <foreach_shared_region+0x2f>
+                if (pdpe & PTE_SHARE) {
+  80369e:	f6 c4 04             	test   $0x4,%ah
+  8036a1:	74 b1                	je     803654 <foreach_shared_region+0xd9>
+                    fun((void*)pdpe_addr, (void*)(pdpe_addr + 1024 * 1024 * 1024), arg); 
+  8036a3:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  8036a7:	48 8d b7 00 00 00 40 	lea    0x40000000(%rdi),%rsi
+  8036ae:	4c 89 fa             	mov    %r15,%rdx
+  8036b1:	41 ff d4             	call   *%r12
+  8036b4:	eb 9e                	jmp    803654 <foreach_shared_region+0xd9>
+    for (int pml4ei = 0; pml4ei < PML4_ENTRY_COUNT; pml4ei++) {
+  8036b6:	49 83 c6 01          	add    $0x1,%r14
+  8036ba:	49 81 fe 00 02 00 00 	cmp    $0x200,%r14
+  8036c1:	74 24                	je     8036e7 <foreach_shared_region+0x16c>
+        pml4e_t pml4e = uvpml4[VPML4(pml4_addr)];
+  8036c3:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  8036ca:	01 00 00 
+  8036cd:	4a 8b 04 f0          	mov    (%rax,%r14,8),%rax
+        if (!(pml4e & PTE_P)) {
+  8036d1:	a8 01                	test   $0x1,%al
+  8036d3:	74 e1                	je     8036b6 <foreach_shared_region+0x13b>
+  8036d5:	4c 89 f0             	mov    %r14,%rax
+  8036d8:	48 c1 e0 27          	shl    $0x27,%rax
+  8036dc:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8036e0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8036e5:	eb 83                	jmp    80366a <foreach_shared_region+0xef>
+            }
+        }
+    }
+    
+    return 0;
+}
+  8036e7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8036ec:	48 83 c4 38          	add    $0x38,%rsp
+  8036f0:	5b                   	pop    %rbx
+  8036f1:	41 5c                	pop    %r12
+  8036f3:	41 5d                	pop    %r13
+  8036f5:	41 5e                	pop    %r14
+  8036f7:	41 5f                	pop    %r15
+  8036f9:	5d                   	pop    %rbp
+  8036fa:	c3                   	ret
+
+00000000008036fb <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  8036fb:	b8 00 00 00 00       	mov    $0x0,%eax
+  803700:	c3                   	ret
+
+0000000000803701 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  803701:	55                   	push   %rbp
+  803702:	48 89 e5             	mov    %rsp,%rbp
+  803705:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  803708:	48 be 7a 43 80 00 00 	movabs $0x80437a,%rsi
+  80370f:	00 00 00 
+  803712:	48 b8 b8 0d 80 00 00 	movabs $0x800db8,%rax
+  803719:	00 00 00 
+  80371c:	ff d0                	call   *%rax
+    return 0;
+}
+  80371e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803723:	5d                   	pop    %rbp
+  803724:	c3                   	ret
+
+0000000000803725 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  803725:	55                   	push   %rbp
+  803726:	48 89 e5             	mov    %rsp,%rbp
+  803729:	41 57                	push   %r15
+  80372b:	41 56                	push   %r14
+  80372d:	41 55                	push   %r13
+  80372f:	41 54                	push   %r12
+  803731:	53                   	push   %rbx
+  803732:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  803739:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  803740:	48 85 d2             	test   %rdx,%rdx
+  803743:	74 7a                	je     8037bf <devcons_write+0x9a>
+  803745:	49 89 d6             	mov    %rdx,%r14
+  803748:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80374e:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  803753:	49 bf b2 0f 80 00 00 	movabs $0x800fb2,%r15
+  80375a:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  80375d:	4c 89 f3             	mov    %r14,%rbx
+  803760:	48 29 f3             	sub    %rsi,%rbx
+  803763:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  803768:	48 39 c3             	cmp    %rax,%rbx
+  80376b:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  80376f:	4c 63 eb             	movslq %ebx,%r13
+  803772:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  803779:	48 01 c6             	add    %rax,%rsi
+  80377c:	4c 89 ea             	mov    %r13,%rdx
+  80377f:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  803786:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  803789:	4c 89 ee             	mov    %r13,%rsi
+  80378c:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  803793:	48 b8 df 11 80 00 00 	movabs $0x8011df,%rax
+  80379a:	00 00 00 
+  80379d:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  80379f:	41 01 dc             	add    %ebx,%r12d
+  8037a2:	49 63 f4             	movslq %r12d,%rsi
+  8037a5:	4c 39 f6             	cmp    %r14,%rsi
+  8037a8:	72 b3                	jb     80375d <devcons_write+0x38>
+    return res;
+  8037aa:	49 63 c4             	movslq %r12d,%rax
+}
+  8037ad:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  8037b4:	5b                   	pop    %rbx
+  8037b5:	41 5c                	pop    %r12
+  8037b7:	41 5d                	pop    %r13
+  8037b9:	41 5e                	pop    %r14
+  8037bb:	41 5f                	pop    %r15
+  8037bd:	5d                   	pop    %rbp
+  8037be:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  8037bf:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8037c5:	eb e3                	jmp    8037aa <devcons_write+0x85>
+
+00000000008037c7 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8037c7:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  8037ca:	ba 00 00 00 00       	mov    $0x0,%edx
+  8037cf:	48 85 c0             	test   %rax,%rax
+  8037d2:	74 55                	je     803829 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8037d4:	55                   	push   %rbp
+  8037d5:	48 89 e5             	mov    %rsp,%rbp
+  8037d8:	41 55                	push   %r13
+  8037da:	41 54                	push   %r12
+  8037dc:	53                   	push   %rbx
+  8037dd:	48 83 ec 08          	sub    $0x8,%rsp
+  8037e1:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  8037e4:	48 bb 0c 12 80 00 00 	movabs $0x80120c,%rbx
+  8037eb:	00 00 00 
+  8037ee:	49 bc d9 12 80 00 00 	movabs $0x8012d9,%r12
+  8037f5:	00 00 00 
+  8037f8:	eb 03                	jmp    8037fd <devcons_read+0x36>
+  8037fa:	41 ff d4             	call   *%r12
+  8037fd:	ff d3                	call   *%rbx
+  8037ff:	85 c0                	test   %eax,%eax
+  803801:	74 f7                	je     8037fa <devcons_read+0x33>
+    if (c < 0) return c;
+  803803:	48 63 d0             	movslq %eax,%rdx
+  803806:	78 13                	js     80381b <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  803808:	ba 00 00 00 00       	mov    $0x0,%edx
+  80380d:	83 f8 04             	cmp    $0x4,%eax
+  803810:	74 09                	je     80381b <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  803812:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  803816:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  80381b:	48 89 d0             	mov    %rdx,%rax
+  80381e:	48 83 c4 08          	add    $0x8,%rsp
+  803822:	5b                   	pop    %rbx
+  803823:	41 5c                	pop    %r12
+  803825:	41 5d                	pop    %r13
+  803827:	5d                   	pop    %rbp
+  803828:	c3                   	ret
+  803829:	48 89 d0             	mov    %rdx,%rax
+  80382c:	c3                   	ret
+
+000000000080382d <cputchar>:
+cputchar(int ch) {
+  80382d:	55                   	push   %rbp
+  80382e:	48 89 e5             	mov    %rsp,%rbp
+  803831:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  803835:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  803839:	be 01 00 00 00       	mov    $0x1,%esi
+  80383e:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  803842:	48 b8 df 11 80 00 00 	movabs $0x8011df,%rax
+  803849:	00 00 00 
+  80384c:	ff d0                	call   *%rax
+}
+  80384e:	c9                   	leave
+  80384f:	c3                   	ret
+
+0000000000803850 <getchar>:
+getchar(void) {
+  803850:	55                   	push   %rbp
+  803851:	48 89 e5             	mov    %rsp,%rbp
+  803854:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  803858:	ba 01 00 00 00       	mov    $0x1,%edx
+  80385d:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  803861:	bf 00 00 00 00       	mov    $0x0,%edi
+  803866:	48 b8 ab 1c 80 00 00 	movabs $0x801cab,%rax
+  80386d:	00 00 00 
+  803870:	ff d0                	call   *%rax
+  803872:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  803874:	85 c0                	test   %eax,%eax
+  803876:	78 06                	js     80387e <getchar+0x2e>
+  803878:	74 08                	je     803882 <getchar+0x32>
+  80387a:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  80387e:	89 d0                	mov    %edx,%eax
+  803880:	c9                   	leave
+  803881:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  803882:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  803887:	eb f5                	jmp    80387e <getchar+0x2e>
+
+0000000000803889 <iscons>:
+iscons(int fdnum) {
+  803889:	55                   	push   %rbp
+  80388a:	48 89 e5             	mov    %rsp,%rbp
+  80388d:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803891:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803895:	48 b8 c8 19 80 00 00 	movabs $0x8019c8,%rax
+  80389c:	00 00 00 
+  80389f:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8038a1:	85 c0                	test   %eax,%eax
+  8038a3:	78 18                	js     8038bd <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  8038a5:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8038a9:	48 b8 a0 50 80 00 00 	movabs $0x8050a0,%rax
+  8038b0:	00 00 00 
+  8038b3:	8b 00                	mov    (%rax),%eax
+  8038b5:	39 02                	cmp    %eax,(%rdx)
+  8038b7:	0f 94 c0             	sete   %al
+  8038ba:	0f b6 c0             	movzbl %al,%eax
+}
+  8038bd:	c9                   	leave
+  8038be:	c3                   	ret
+
+00000000008038bf <opencons>:
+opencons(void) {
+  8038bf:	55                   	push   %rbp
+  8038c0:	48 89 e5             	mov    %rsp,%rbp
+  8038c3:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8038c7:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  8038cb:	48 b8 ae 19 80 00 00 	movabs $0x8019ae,%rax
+  8038d2:	00 00 00 
+  8038d5:	ff d0                	call   *%rax
+  8038d7:	85 c0                	test   %eax,%eax
+  8038d9:	78 49                	js     803924 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  8038db:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8038e0:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8038e5:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  8038e9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8038ee:	48 b8 68 13 80 00 00 	movabs $0x801368,%rax
+  8038f5:	00 00 00 
+  8038f8:	ff d0                	call   *%rax
+  8038fa:	85 c0                	test   %eax,%eax
+  8038fc:	78 26                	js     803924 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  8038fe:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803902:	a1 a0 50 80 00 00 00 	movabs 0x8050a0,%eax
+  803909:	00 00 
+  80390b:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  80390d:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803911:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  803918:	48 b8 07 19 80 00 00 	movabs $0x801907,%rax
+  80391f:	00 00 00 
+  803922:	ff d0                	call   *%rax
+}
+  803924:	c9                   	leave
+  803925:	c3                   	ret
+
+0000000000803926 <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  803926:	55                   	push   %rbp
+  803927:	48 89 e5             	mov    %rsp,%rbp
+  80392a:	41 55                	push   %r13
+  80392c:	41 54                	push   %r12
+  80392e:	53                   	push   %rbx
+  80392f:	48 83 ec 08          	sub    $0x8,%rsp
+  803933:	49 89 fc             	mov    %rdi,%r12
+  803936:	48 89 f7             	mov    %rsi,%rdi
+  803939:	48 89 d3             	mov    %rdx,%rbx
+  80393c:	49 89 cd             	mov    %rcx,%r13
+    // LAB 9: Your code here:
+    int res = sys_ipc_recv(!pg ? (void*)MAX_USER_ADDRESS : pg, !size ? 0 : *size);
+  80393f:	be 00 00 00 00       	mov    $0x0,%esi
+  803944:	48 85 d2             	test   %rdx,%rdx
+  803947:	74 03                	je     80394c <ipc_recv+0x26>
+  803949:	48 8b 32             	mov    (%rdx),%rsi
+  80394c:	48 85 ff             	test   %rdi,%rdi
+  80394f:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803956:	00 00 00 
+  803959:	48 0f 44 f8          	cmove  %rax,%rdi
+  80395d:	48 b8 3a 17 80 00 00 	movabs $0x80173a,%rax
+  803964:	00 00 00 
+  803967:	ff d0                	call   *%rax
+    if (res < 0) {
+  803969:	85 c0                	test   %eax,%eax
+  80396b:	78 66                	js     8039d3 <ipc_recv+0xad>
+        if (size) {
+            *size = 0;
+        }
+        return res;
+    }
+    if (from_env_store) {
+  80396d:	4d 85 e4             	test   %r12,%r12
+  803970:	74 14                	je     803986 <ipc_recv+0x60>
+        *from_env_store = thisenv->env_ipc_from;
+  803972:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  803979:	00 00 00 
+  80397c:	8b 80 ac 01 00 00    	mov    0x1ac(%rax),%eax
+  803982:	41 89 04 24          	mov    %eax,(%r12)
+    }
+    if (perm_store) {
+  803986:	4d 85 ed             	test   %r13,%r13
+  803989:	74 14                	je     80399f <ipc_recv+0x79>
+        *perm_store = thisenv->env_ipc_perm;
+  80398b:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  803992:	00 00 00 
+  803995:	8b 80 b0 01 00 00    	mov    0x1b0(%rax),%eax
+  80399b:	41 89 45 00          	mov    %eax,0x0(%r13)
+    }
+    if (size) {
+  80399f:	48 85 db             	test   %rbx,%rbx
+  8039a2:	74 14                	je     8039b8 <ipc_recv+0x92>
+        *size = thisenv->env_ipc_maxsz;
+  8039a4:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  8039ab:	00 00 00 
+  8039ae:	48 8b 80 a0 01 00 00 	mov    0x1a0(%rax),%rax
+  8039b5:	48 89 03             	mov    %rax,(%rbx)
+    }
+    return thisenv->env_ipc_value;
+  8039b8:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  8039bf:	00 00 00 
+  8039c2:	8b 80 a8 01 00 00    	mov    0x1a8(%rax),%eax
+}
+  8039c8:	48 83 c4 08          	add    $0x8,%rsp
+  8039cc:	5b                   	pop    %rbx
+  8039cd:	41 5c                	pop    %r12
+  8039cf:	41 5d                	pop    %r13
+  8039d1:	5d                   	pop    %rbp
+  8039d2:	c3                   	ret
+        if (from_env_store) {
+  8039d3:	4d 85 e4             	test   %r12,%r12
+  8039d6:	74 08                	je     8039e0 <ipc_recv+0xba>
+            *from_env_store = 0;
+  8039d8:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  8039df:	00 
+        if (perm_store) {
+  8039e0:	4d 85 ed             	test   %r13,%r13
+  8039e3:	74 08                	je     8039ed <ipc_recv+0xc7>
+            *perm_store = 0;
+  8039e5:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  8039ec:	00 
+        if (size) {
+  8039ed:	48 85 db             	test   %rbx,%rbx
+  8039f0:	74 d6                	je     8039c8 <ipc_recv+0xa2>
+            *size = 0;
+  8039f2:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  8039f9:	eb cd                	jmp    8039c8 <ipc_recv+0xa2>
+
+00000000008039fb <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  8039fb:	55                   	push   %rbp
+  8039fc:	48 89 e5             	mov    %rsp,%rbp
+  8039ff:	41 57                	push   %r15
+  803a01:	41 56                	push   %r14
+  803a03:	41 55                	push   %r13
+  803a05:	41 54                	push   %r12
+  803a07:	53                   	push   %rbx
+  803a08:	48 83 ec 18          	sub    $0x18,%rsp
+  803a0c:	41 89 fd             	mov    %edi,%r13d
+  803a0f:	89 75 cc             	mov    %esi,-0x34(%rbp)
+  803a12:	49 89 cc             	mov    %rcx,%r12
+  803a15:	44 89 45 c8          	mov    %r8d,-0x38(%rbp)
+    // LAB 9: Your code here:
+    int res = 0;
+    while ((res = sys_ipc_try_send(to_env, val, !pg ? (void*)MAX_USER_ADDRESS : pg, size, perm)) < 0) {
+  803a19:	48 85 d2             	test   %rdx,%rdx
+  803a1c:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803a23:	00 00 00 
+  803a26:	48 0f 45 c2          	cmovne %rdx,%rax
+  803a2a:	48 89 c3             	mov    %rax,%rbx
+  803a2d:	49 be 0e 17 80 00 00 	movabs $0x80170e,%r14
+  803a34:	00 00 00 
+        if (res != -E_IPC_NOT_RECV) {
+            panic("sys_ipc_try_send failed: %i", res);
+        }
+        sys_yield();
+  803a37:	49 bf d9 12 80 00 00 	movabs $0x8012d9,%r15
+  803a3e:	00 00 00 
+    while ((res = sys_ipc_try_send(to_env, val, !pg ? (void*)MAX_USER_ADDRESS : pg, size, perm)) < 0) {
+  803a41:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  803a44:	44 8b 45 c8          	mov    -0x38(%rbp),%r8d
+  803a48:	4c 89 e1             	mov    %r12,%rcx
+  803a4b:	48 89 da             	mov    %rbx,%rdx
+  803a4e:	44 89 ef             	mov    %r13d,%edi
+  803a51:	41 ff d6             	call   *%r14
+  803a54:	85 c0                	test   %eax,%eax
+  803a56:	79 37                	jns    803a8f <ipc_send+0x94>
+        if (res != -E_IPC_NOT_RECV) {
+  803a58:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  803a5b:	75 05                	jne    803a62 <ipc_send+0x67>
+        sys_yield();
+  803a5d:	41 ff d7             	call   *%r15
+  803a60:	eb df                	jmp    803a41 <ipc_send+0x46>
+            panic("sys_ipc_try_send failed: %i", res);
+  803a62:	89 c1                	mov    %eax,%ecx
+  803a64:	48 ba 86 43 80 00 00 	movabs $0x804386,%rdx
+  803a6b:	00 00 00 
+  803a6e:	be 40 00 00 00       	mov    $0x40,%esi
+  803a73:	48 bf a2 43 80 00 00 	movabs $0x8043a2,%rdi
+  803a7a:	00 00 00 
+  803a7d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a82:	49 b8 43 03 80 00 00 	movabs $0x800343,%r8
+  803a89:	00 00 00 
+  803a8c:	41 ff d0             	call   *%r8
+    }
+    return;
+}
+  803a8f:	48 83 c4 18          	add    $0x18,%rsp
+  803a93:	5b                   	pop    %rbx
+  803a94:	41 5c                	pop    %r12
+  803a96:	41 5d                	pop    %r13
+  803a98:	41 5e                	pop    %r14
+  803a9a:	41 5f                	pop    %r15
+  803a9c:	5d                   	pop    %rbp
+  803a9d:	c3                   	ret
+
+0000000000803a9e <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  803a9e:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  803aa3:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  803aaa:	00 00 00 
+  803aad:	48 69 d0 d0 01 00 00 	imul   $0x1d0,%rax,%rdx
+  803ab4:	48 01 ca             	add    %rcx,%rdx
+  803ab7:	8b 92 e8 00 00 00    	mov    0xe8(%rdx),%edx
+  803abd:	39 fa                	cmp    %edi,%edx
+  803abf:	74 12                	je     803ad3 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  803ac1:	48 83 c0 01          	add    $0x1,%rax
+  803ac5:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  803acb:	75 e0                	jne    803aad <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  803acd:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803ad2:	c3                   	ret
+            return envs[i].env_id;
+  803ad3:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+  803ada:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  803ae1:	00 00 00 
+  803ae4:	48 01 d0             	add    %rdx,%rax
+  803ae7:	8b 80 e0 00 00 00    	mov    0xe0(%rax),%eax
+  803aed:	c3                   	ret
+  803aee:	66 90                	xchg   %ax,%ax
+
+0000000000803af0 <__rodata_start>:
+  803af0:	72 69                	jb     803b5b <__rodata_start+0x6b>
+  803af2:	67 68 74 00 77 72    	addr32 push $0x72770074
+  803af8:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803af9:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803afa:	67 00 73 79          	add    %dh,0x79(%ebx)
+  803afe:	73 5f                	jae    803b5f <__rodata_start+0x6f>
+  803b00:	70 61                	jo     803b63 <__rodata_start+0x73>
+  803b02:	67 65 5f             	addr32 gs pop %rdi
+  803b05:	61                   	(bad)
+  803b06:	6c                   	insb   (%dx),%es:(%rdi)
+  803b07:	6c                   	insb   (%dx),%es:(%rdi)
+  803b08:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803b09:	63 3a                	movsxd (%rdx),%edi
+  803b0b:	20 25 69 00 75 73    	and    %ah,0x73750069(%rip)        # 73f53b7a <__bss_end+0x7374ab7a>
+  803b11:	65 72 2f             	gs jb  803b43 <__rodata_start+0x53>
+  803b14:	74 65                	je     803b7b <__rodata_start+0x8b>
+  803b16:	73 74                	jae    803b8c <__rodata_start+0x9c>
+  803b18:	70 74                	jo     803b8e <__rodata_start+0x9e>
+  803b1a:	65 73 68             	gs jae 803b85 <__rodata_start+0x95>
+  803b1d:	61                   	(bad)
+  803b1e:	72 65                	jb     803b85 <__rodata_start+0x95>
+  803b20:	2e 63 00             	cs movsxd (%rax),%eax
+  803b23:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  803b25:	72 6b                	jb     803b92 <__rodata_start+0xa2>
+  803b27:	3a 20                	cmp    (%rax),%ah
+  803b29:	25 69 00 66 6f       	and    $0x6f660069,%eax
+  803b2e:	72 6b                	jb     803b9b <__rodata_start+0xab>
+  803b30:	20 68 61             	and    %ch,0x61(%rax)
+  803b33:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803b34:	64 6c                	fs insb (%dx),%es:(%rdi)
+  803b36:	65 73 20             	gs jae 803b59 <__rodata_start+0x69>
+  803b39:	50                   	push   %rax
+  803b3a:	54                   	push   %rsp
+  803b3b:	45 5f                	rex.RB pop %r15
+  803b3d:	53                   	push   %rbx
+  803b3e:	48                   	rex.W
+  803b3f:	41 52                	push   %r10
+  803b41:	45 20 25 73 0a 00 61 	and    %r12b,0x61000a73(%rip)        # 618045bb <__bss_end+0x60ffb5bb>
+  803b48:	72 67                	jb     803bb1 <__rodata_start+0xc1>
+  803b4a:	00 2f                	add    %ch,(%rdi)
+  803b4c:	74 65                	je     803bb3 <__rodata_start+0xc3>
+  803b4e:	73 74                	jae    803bc4 <__rodata_start+0xd4>
+  803b50:	70 74                	jo     803bc6 <__rodata_start+0xd6>
+  803b52:	65 73 68             	gs jae 803bbd <__rodata_start+0xcd>
+  803b55:	61                   	(bad)
+  803b56:	72 65                	jb     803bbd <__rodata_start+0xcd>
+  803b58:	00 73 70             	add    %dh,0x70(%rbx)
+  803b5b:	61                   	(bad)
+  803b5c:	77 6e                	ja     803bcc <__rodata_start+0xdc>
+  803b5e:	3a 20                	cmp    (%rax),%ah
+  803b60:	25 69 00 73 70       	and    $0x70730069,%eax
+  803b65:	61                   	(bad)
+  803b66:	77 6e                	ja     803bd6 <__rodata_start+0xe6>
+  803b68:	20 68 61             	and    %ch,0x61(%rax)
+  803b6b:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803b6c:	64 6c                	fs insb (%dx),%es:(%rdi)
+  803b6e:	65 73 20             	gs jae 803b91 <__rodata_start+0xa1>
+  803b71:	50                   	push   %rax
+  803b72:	54                   	push   %rsp
+  803b73:	45 5f                	rex.RB pop %r15
+  803b75:	53                   	push   %rbx
+  803b76:	48                   	rex.W
+  803b77:	41 52                	push   %r10
+  803b79:	45 20 25 73 0a 00 67 	and    %r12b,0x67000a73(%rip)        # 678045f3 <__bss_end+0x66ffb5f3>
+  803b80:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803b81:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803b82:	64 62                	fs (bad)
+  803b84:	79 65                	jns    803beb <__rodata_start+0xfb>
+  803b86:	2c 20                	sub    $0x20,%al
+  803b88:	77 6f                	ja     803bf9 <__rodata_start+0x109>
+  803b8a:	72 6c                	jb     803bf8 <__rodata_start+0x108>
+  803b8c:	64 0a 00             	or     %fs:(%rax),%al
+  803b8f:	68 65 6c 6c 6f       	push   $0x6f6c6c65
+  803b94:	2c 20                	sub    $0x20,%al
+  803b96:	77 6f                	ja     803c07 <__rodata_start+0x117>
+  803b98:	72 6c                	jb     803c06 <__rodata_start+0x116>
+  803b9a:	64 0a 00             	or     %fs:(%rax),%al
+  803b9d:	3c 75                	cmp    $0x75,%al
+  803b9f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803ba0:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  803ba4:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803ba5:	3e 00 90 5b 25 30 38 	ds add %dl,0x3830255b(%rax)
+  803bac:	78 5d                	js     803c0b <__rodata_start+0x11b>
+  803bae:	20 75 73             	and    %dh,0x73(%rbp)
+  803bb1:	65 72 20             	gs jb  803bd4 <__rodata_start+0xe4>
+  803bb4:	70 61                	jo     803c17 <__rodata_start+0x127>
+  803bb6:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803bb7:	69 63 20 69 6e 20 25 	imul   $0x25206e69,0x20(%rbx),%esp
+  803bbe:	73 20                	jae    803be0 <__rodata_start+0xf0>
+  803bc0:	61                   	(bad)
+  803bc1:	74 20                	je     803be3 <__rodata_start+0xf3>
+  803bc3:	25 73 3a 25 64       	and    $0x64253a73,%eax
+  803bc8:	3a 20                	cmp    (%rax),%ah
+  803bca:	00 30                	add    %dh,(%rax)
+  803bcc:	31 32                	xor    %esi,(%rdx)
+  803bce:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  803bd5:	41                   	rex.B
+  803bd6:	42                   	rex.X
+  803bd7:	43                   	rex.XB
+  803bd8:	44                   	rex.R
+  803bd9:	45                   	rex.RB
+  803bda:	46 00 30             	rex.RX add %r14b,(%rax)
+  803bdd:	31 32                	xor    %esi,(%rdx)
+  803bdf:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  803be6:	61                   	(bad)
+  803be7:	62 63 64 65 66       	(bad)
+  803bec:	00 28                	add    %ch,(%rax)
+  803bee:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803bef:	75 6c                	jne    803c5d <__rodata_start+0x16d>
+  803bf1:	6c                   	insb   (%dx),%es:(%rdi)
+  803bf2:	29 00                	sub    %eax,(%rax)
+  803bf4:	65 72 72             	gs jb  803c69 <__rodata_start+0x179>
+  803bf7:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803bf8:	72 20                	jb     803c1a <__rodata_start+0x12a>
+  803bfa:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  803bff:	73 70                	jae    803c71 <__rodata_start+0x181>
+  803c01:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  803c05:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  803c0c:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803c0d:	72 00                	jb     803c0f <__rodata_start+0x11f>
+  803c0f:	62 61 64 20 65       	(bad)
+  803c14:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803c15:	76 69                	jbe    803c80 <__rodata_start+0x190>
+  803c17:	72 6f                	jb     803c88 <__rodata_start+0x198>
+  803c19:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803c1a:	6d                   	insl   (%dx),%es:(%rdi)
+  803c1b:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803c1d:	74 00                	je     803c1f <__rodata_start+0x12f>
+  803c1f:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  803c26:	20 70 61             	and    %dh,0x61(%rax)
+  803c29:	72 61                	jb     803c8c <__rodata_start+0x19c>
+  803c2b:	6d                   	insl   (%dx),%es:(%rdi)
+  803c2c:	65 74 65             	gs je  803c94 <__rodata_start+0x1a4>
+  803c2f:	72 00                	jb     803c31 <__rodata_start+0x141>
+  803c31:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803c32:	75 74                	jne    803ca8 <__rodata_start+0x1b8>
+  803c34:	20 6f 66             	and    %ch,0x66(%rdi)
+  803c37:	20 6d 65             	and    %ch,0x65(%rbp)
+  803c3a:	6d                   	insl   (%dx),%es:(%rdi)
+  803c3b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803c3c:	72 79                	jb     803cb7 <__rodata_start+0x1c7>
+  803c3e:	00 6f 75             	add    %ch,0x75(%rdi)
+  803c41:	74 20                	je     803c63 <__rodata_start+0x173>
+  803c43:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803c44:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  803c48:	76 69                	jbe    803cb3 <__rodata_start+0x1c3>
+  803c4a:	72 6f                	jb     803cbb <__rodata_start+0x1cb>
+  803c4c:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803c4d:	6d                   	insl   (%dx),%es:(%rdi)
+  803c4e:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803c50:	74 73                	je     803cc5 <__rodata_start+0x1d5>
+  803c52:	00 63 6f             	add    %ah,0x6f(%rbx)
+  803c55:	72 72                	jb     803cc9 <__rodata_start+0x1d9>
+  803c57:	75 70                	jne    803cc9 <__rodata_start+0x1d9>
+  803c59:	74 65                	je     803cc0 <__rodata_start+0x1d0>
+  803c5b:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  803c60:	75 67                	jne    803cc9 <__rodata_start+0x1d9>
+  803c62:	20 69 6e             	and    %ch,0x6e(%rcx)
+  803c65:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  803c67:	00 73 65             	add    %dh,0x65(%rbx)
+  803c6a:	67 6d                	insl   (%dx),%es:(%edi)
+  803c6c:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803c6e:	74 61                	je     803cd1 <__rodata_start+0x1e1>
+  803c70:	74 69                	je     803cdb <__rodata_start+0x1eb>
+  803c72:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803c73:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803c74:	20 66 61             	and    %ah,0x61(%rsi)
+  803c77:	75 6c                	jne    803ce5 <__rodata_start+0x1f5>
+  803c79:	74 00                	je     803c7b <__rodata_start+0x18b>
+  803c7b:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  803c82:	20 45 4c             	and    %al,0x4c(%rbp)
+  803c85:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  803c89:	61                   	(bad)
+  803c8a:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  803c8f:	20 73 75             	and    %dh,0x75(%rbx)
+  803c92:	63 68 20             	movsxd 0x20(%rax),%ebp
+  803c95:	73 79                	jae    803d10 <__rodata_start+0x220>
+  803c97:	73 74                	jae    803d0d <__rodata_start+0x21d>
+  803c99:	65 6d                	gs insl (%dx),%es:(%rdi)
+  803c9b:	20 63 61             	and    %ah,0x61(%rbx)
+  803c9e:	6c                   	insb   (%dx),%es:(%rdi)
+  803c9f:	6c                   	insb   (%dx),%es:(%rdi)
+  803ca0:	00 65 6e             	add    %ah,0x6e(%rbp)
+  803ca3:	74 72                	je     803d17 <__rodata_start+0x227>
+  803ca5:	79 20                	jns    803cc7 <__rodata_start+0x1d7>
+  803ca7:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803ca8:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803ca9:	74 20                	je     803ccb <__rodata_start+0x1db>
+  803cab:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  803cad:	75 6e                	jne    803d1d <__rodata_start+0x22d>
+  803caf:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  803cb3:	76 20                	jbe    803cd5 <__rodata_start+0x1e5>
+  803cb5:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  803cbc:	72 65                	jb     803d23 <__rodata_start+0x233>
+  803cbe:	63 76 69             	movsxd 0x69(%rsi),%esi
+  803cc1:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803cc2:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  803cc6:	65 78 70             	gs js  803d39 <__rodata_start+0x249>
+  803cc9:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  803cce:	20 65 6e             	and    %ah,0x6e(%rbp)
+  803cd1:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  803cd5:	20 66 69             	and    %ah,0x69(%rsi)
+  803cd8:	6c                   	insb   (%dx),%es:(%rdi)
+  803cd9:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  803cdd:	20 66 72             	and    %ah,0x72(%rsi)
+  803ce0:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  803ce5:	61                   	(bad)
+  803ce6:	63 65 20             	movsxd 0x20(%rbp),%esp
+  803ce9:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803cea:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803ceb:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  803cef:	6b 00 74             	imul   $0x74,(%rax),%eax
+  803cf2:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803cf3:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803cf4:	20 6d 61             	and    %ch,0x61(%rbp)
+  803cf7:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803cf8:	79 20                	jns    803d1a <__rodata_start+0x22a>
+  803cfa:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  803d01:	72 65                	jb     803d68 <__rodata_start+0x278>
+  803d03:	20 6f 70             	and    %ch,0x70(%rdi)
+  803d06:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803d08:	00 66 69             	add    %ah,0x69(%rsi)
+  803d0b:	6c                   	insb   (%dx),%es:(%rdi)
+  803d0c:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  803d10:	20 62 6c             	and    %ah,0x6c(%rdx)
+  803d13:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803d14:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  803d17:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803d18:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803d19:	74 20                	je     803d3b <__rodata_start+0x24b>
+  803d1b:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  803d1d:	75 6e                	jne    803d8d <__rodata_start+0x29d>
+  803d1f:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  803d23:	76 61                	jbe    803d86 <__rodata_start+0x296>
+  803d25:	6c                   	insb   (%dx),%es:(%rdi)
+  803d26:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  803d2d:	00 
+  803d2e:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  803d35:	72 65                	jb     803d9c <__rodata_start+0x2ac>
+  803d37:	61                   	(bad)
+  803d38:	64 79 20             	fs jns 803d5b <__rodata_start+0x26b>
+  803d3b:	65 78 69             	gs js  803da7 <__rodata_start+0x2b7>
+  803d3e:	73 74                	jae    803db4 <__rodata_start+0x2c4>
+  803d40:	73 00                	jae    803d42 <__rodata_start+0x252>
+  803d42:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803d43:	70 65                	jo     803daa <__rodata_start+0x2ba>
+  803d45:	72 61                	jb     803da8 <__rodata_start+0x2b8>
+  803d47:	74 69                	je     803db2 <__rodata_start+0x2c2>
+  803d49:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803d4a:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803d4b:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  803d4e:	74 20                	je     803d70 <__rodata_start+0x280>
+  803d50:	73 75                	jae    803dc7 <__rodata_start+0x2d7>
+  803d52:	70 70                	jo     803dc4 <__rodata_start+0x2d4>
+  803d54:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803d55:	72 74                	jb     803dcb <__rodata_start+0x2db>
+  803d57:	65 64 00 6f 70       	gs add %ch,%fs:0x70(%rdi)
+  803d5c:	65 72 61             	gs jb  803dc0 <__rodata_start+0x2d0>
+  803d5f:	74 69                	je     803dca <__rodata_start+0x2da>
+  803d61:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803d62:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803d63:	20 69 6e             	and    %ch,0x6e(%rcx)
+  803d66:	74 65                	je     803dcd <__rodata_start+0x2dd>
+  803d68:	72 72                	jb     803ddc <__rodata_start+0x2ec>
+  803d6a:	75 70                	jne    803ddc <__rodata_start+0x2ec>
+  803d6c:	74 65                	je     803dd3 <__rodata_start+0x2e3>
+  803d6e:	64 00 6e 6f          	add    %ch,%fs:0x6f(%rsi)
+  803d72:	74 20                	je     803d94 <__rodata_start+0x2a4>
+  803d74:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803d76:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803d77:	75 67                	jne    803de0 <__rodata_start+0x2f0>
+  803d79:	68 20 43 50 55       	push   $0x55504320
+  803d7e:	20 74 69 6d          	and    %dh,0x6d(%rcx,%rbp,2)
+  803d82:	65 00 66 2e          	add    %ah,%gs:0x2e(%rsi)
+  803d86:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+  803d8d:	00 
+  803d8e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  803d95:	00 00 00 
+  803d98:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+  803d9f:	00 
+  803da0:	80 06 80             	addb   $0x80,(%rsi)
+  803da3:	00 00                	add    %al,(%rax)
+  803da5:	00 00                	add    %al,(%rax)
+  803da7:	00 c1                	add    %al,%cl
+  803da9:	0c 80                	or     $0x80,%al
+  803dab:	00 00                	add    %al,(%rax)
+  803dad:	00 00                	add    %al,(%rax)
+  803daf:	00 b1 0c 80 00 00    	add    %dh,0x800c(%rcx)
+  803db5:	00 00                	add    %al,(%rax)
+  803db7:	00 c1                	add    %al,%cl
+  803db9:	0c 80                	or     $0x80,%al
+  803dbb:	00 00                	add    %al,(%rax)
+  803dbd:	00 00                	add    %al,(%rax)
+  803dbf:	00 c1                	add    %al,%cl
+  803dc1:	0c 80                	or     $0x80,%al
+  803dc3:	00 00                	add    %al,(%rax)
+  803dc5:	00 00                	add    %al,(%rax)
+  803dc7:	00 c1                	add    %al,%cl
+  803dc9:	0c 80                	or     $0x80,%al
+  803dcb:	00 00                	add    %al,(%rax)
+  803dcd:	00 00                	add    %al,(%rax)
+  803dcf:	00 c1                	add    %al,%cl
+  803dd1:	0c 80                	or     $0x80,%al
+  803dd3:	00 00                	add    %al,(%rax)
+  803dd5:	00 00                	add    %al,(%rax)
+  803dd7:	00 9f 06 80 00 00    	add    %bl,0x8006(%rdi)
+  803ddd:	00 00                	add    %al,(%rax)
+  803ddf:	00 c1                	add    %al,%cl
+  803de1:	0c 80                	or     $0x80,%al
+  803de3:	00 00                	add    %al,(%rax)
+  803de5:	00 00                	add    %al,(%rax)
+  803de7:	00 c1                	add    %al,%cl
+  803de9:	0c 80                	or     $0x80,%al
+  803deb:	00 00                	add    %al,(%rax)
+  803ded:	00 00                	add    %al,(%rax)
+  803def:	00 93 06 80 00 00    	add    %dl,0x8006(%rbx)
+  803df5:	00 00                	add    %al,(%rax)
+  803df7:	00 0d 07 80 00 00    	add    %cl,0x8007(%rip)        # 80be04 <__bss_end+0x2e04>
+  803dfd:	00 00                	add    %al,(%rax)
+  803dff:	00 c1                	add    %al,%cl
+  803e01:	0c 80                	or     $0x80,%al
+  803e03:	00 00                	add    %al,(%rax)
+  803e05:	00 00                	add    %al,(%rax)
+  803e07:	00 93 06 80 00 00    	add    %dl,0x8006(%rbx)
+  803e0d:	00 00                	add    %al,(%rax)
+  803e0f:	00 d9                	add    %bl,%cl
+  803e11:	06                   	(bad)
+  803e12:	80 00 00             	addb   $0x0,(%rax)
+  803e15:	00 00                	add    %al,(%rax)
+  803e17:	00 d9                	add    %bl,%cl
+  803e19:	06                   	(bad)
+  803e1a:	80 00 00             	addb   $0x0,(%rax)
+  803e1d:	00 00                	add    %al,(%rax)
+  803e1f:	00 d9                	add    %bl,%cl
+  803e21:	06                   	(bad)
+  803e22:	80 00 00             	addb   $0x0,(%rax)
+  803e25:	00 00                	add    %al,(%rax)
+  803e27:	00 d9                	add    %bl,%cl
+  803e29:	06                   	(bad)
+  803e2a:	80 00 00             	addb   $0x0,(%rax)
+  803e2d:	00 00                	add    %al,(%rax)
+  803e2f:	00 d9                	add    %bl,%cl
+  803e31:	06                   	(bad)
+  803e32:	80 00 00             	addb   $0x0,(%rax)
+  803e35:	00 00                	add    %al,(%rax)
+  803e37:	00 d9                	add    %bl,%cl
+  803e39:	06                   	(bad)
+  803e3a:	80 00 00             	addb   $0x0,(%rax)
+  803e3d:	00 00                	add    %al,(%rax)
+  803e3f:	00 d9                	add    %bl,%cl
+  803e41:	06                   	(bad)
+  803e42:	80 00 00             	addb   $0x0,(%rax)
+  803e45:	00 00                	add    %al,(%rax)
+  803e47:	00 d9                	add    %bl,%cl
+  803e49:	06                   	(bad)
+  803e4a:	80 00 00             	addb   $0x0,(%rax)
+  803e4d:	00 00                	add    %al,(%rax)
+  803e4f:	00 d9                	add    %bl,%cl
+  803e51:	06                   	(bad)
+  803e52:	80 00 00             	addb   $0x0,(%rax)
+  803e55:	00 00                	add    %al,(%rax)
+  803e57:	00 c1                	add    %al,%cl
+  803e59:	0c 80                	or     $0x80,%al
+  803e5b:	00 00                	add    %al,(%rax)
+  803e5d:	00 00                	add    %al,(%rax)
+  803e5f:	00 c1                	add    %al,%cl
+  803e61:	0c 80                	or     $0x80,%al
+  803e63:	00 00                	add    %al,(%rax)
+  803e65:	00 00                	add    %al,(%rax)
+  803e67:	00 c1                	add    %al,%cl
+  803e69:	0c 80                	or     $0x80,%al
+  803e6b:	00 00                	add    %al,(%rax)
+  803e6d:	00 00                	add    %al,(%rax)
+  803e6f:	00 c1                	add    %al,%cl
+  803e71:	0c 80                	or     $0x80,%al
+  803e73:	00 00                	add    %al,(%rax)
+  803e75:	00 00                	add    %al,(%rax)
+  803e77:	00 c1                	add    %al,%cl
+  803e79:	0c 80                	or     $0x80,%al
+  803e7b:	00 00                	add    %al,(%rax)
+  803e7d:	00 00                	add    %al,(%rax)
+  803e7f:	00 c1                	add    %al,%cl
+  803e81:	0c 80                	or     $0x80,%al
+  803e83:	00 00                	add    %al,(%rax)
+  803e85:	00 00                	add    %al,(%rax)
+  803e87:	00 c1                	add    %al,%cl
+  803e89:	0c 80                	or     $0x80,%al
+  803e8b:	00 00                	add    %al,(%rax)
+  803e8d:	00 00                	add    %al,(%rax)
+  803e8f:	00 c1                	add    %al,%cl
+  803e91:	0c 80                	or     $0x80,%al
+  803e93:	00 00                	add    %al,(%rax)
+  803e95:	00 00                	add    %al,(%rax)
+  803e97:	00 c1                	add    %al,%cl
+  803e99:	0c 80                	or     $0x80,%al
+  803e9b:	00 00                	add    %al,(%rax)
+  803e9d:	00 00                	add    %al,(%rax)
+  803e9f:	00 c1                	add    %al,%cl
+  803ea1:	0c 80                	or     $0x80,%al
+  803ea3:	00 00                	add    %al,(%rax)
+  803ea5:	00 00                	add    %al,(%rax)
+  803ea7:	00 c1                	add    %al,%cl
+  803ea9:	0c 80                	or     $0x80,%al
+  803eab:	00 00                	add    %al,(%rax)
+  803ead:	00 00                	add    %al,(%rax)
+  803eaf:	00 c1                	add    %al,%cl
+  803eb1:	0c 80                	or     $0x80,%al
+  803eb3:	00 00                	add    %al,(%rax)
+  803eb5:	00 00                	add    %al,(%rax)
+  803eb7:	00 c1                	add    %al,%cl
+  803eb9:	0c 80                	or     $0x80,%al
+  803ebb:	00 00                	add    %al,(%rax)
+  803ebd:	00 00                	add    %al,(%rax)
+  803ebf:	00 c1                	add    %al,%cl
+  803ec1:	0c 80                	or     $0x80,%al
+  803ec3:	00 00                	add    %al,(%rax)
+  803ec5:	00 00                	add    %al,(%rax)
+  803ec7:	00 c1                	add    %al,%cl
+  803ec9:	0c 80                	or     $0x80,%al
+  803ecb:	00 00                	add    %al,(%rax)
+  803ecd:	00 00                	add    %al,(%rax)
+  803ecf:	00 c1                	add    %al,%cl
+  803ed1:	0c 80                	or     $0x80,%al
+  803ed3:	00 00                	add    %al,(%rax)
+  803ed5:	00 00                	add    %al,(%rax)
+  803ed7:	00 c1                	add    %al,%cl
+  803ed9:	0c 80                	or     $0x80,%al
+  803edb:	00 00                	add    %al,(%rax)
+  803edd:	00 00                	add    %al,(%rax)
+  803edf:	00 c1                	add    %al,%cl
+  803ee1:	0c 80                	or     $0x80,%al
+  803ee3:	00 00                	add    %al,(%rax)
+  803ee5:	00 00                	add    %al,(%rax)
+  803ee7:	00 c1                	add    %al,%cl
+  803ee9:	0c 80                	or     $0x80,%al
+  803eeb:	00 00                	add    %al,(%rax)
+  803eed:	00 00                	add    %al,(%rax)
+  803eef:	00 c1                	add    %al,%cl
+  803ef1:	0c 80                	or     $0x80,%al
+  803ef3:	00 00                	add    %al,(%rax)
+  803ef5:	00 00                	add    %al,(%rax)
+  803ef7:	00 c1                	add    %al,%cl
+  803ef9:	0c 80                	or     $0x80,%al
+  803efb:	00 00                	add    %al,(%rax)
+  803efd:	00 00                	add    %al,(%rax)
+  803eff:	00 c1                	add    %al,%cl
+  803f01:	0c 80                	or     $0x80,%al
+  803f03:	00 00                	add    %al,(%rax)
+  803f05:	00 00                	add    %al,(%rax)
+  803f07:	00 c1                	add    %al,%cl
+  803f09:	0c 80                	or     $0x80,%al
+  803f0b:	00 00                	add    %al,(%rax)
+  803f0d:	00 00                	add    %al,(%rax)
+  803f0f:	00 c1                	add    %al,%cl
+  803f11:	0c 80                	or     $0x80,%al
+  803f13:	00 00                	add    %al,(%rax)
+  803f15:	00 00                	add    %al,(%rax)
+  803f17:	00 c1                	add    %al,%cl
+  803f19:	0c 80                	or     $0x80,%al
+  803f1b:	00 00                	add    %al,(%rax)
+  803f1d:	00 00                	add    %al,(%rax)
+  803f1f:	00 c1                	add    %al,%cl
+  803f21:	0c 80                	or     $0x80,%al
+  803f23:	00 00                	add    %al,(%rax)
+  803f25:	00 00                	add    %al,(%rax)
+  803f27:	00 c1                	add    %al,%cl
+  803f29:	0c 80                	or     $0x80,%al
+  803f2b:	00 00                	add    %al,(%rax)
+  803f2d:	00 00                	add    %al,(%rax)
+  803f2f:	00 c1                	add    %al,%cl
+  803f31:	0c 80                	or     $0x80,%al
+  803f33:	00 00                	add    %al,(%rax)
+  803f35:	00 00                	add    %al,(%rax)
+  803f37:	00 c1                	add    %al,%cl
+  803f39:	0c 80                	or     $0x80,%al
+  803f3b:	00 00                	add    %al,(%rax)
+  803f3d:	00 00                	add    %al,(%rax)
+  803f3f:	00 c1                	add    %al,%cl
+  803f41:	0c 80                	or     $0x80,%al
+  803f43:	00 00                	add    %al,(%rax)
+  803f45:	00 00                	add    %al,(%rax)
+  803f47:	00 e4                	add    %ah,%ah
+  803f49:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  803f4f:	00 c1                	add    %al,%cl
+  803f51:	0c 80                	or     $0x80,%al
+  803f53:	00 00                	add    %al,(%rax)
+  803f55:	00 00                	add    %al,(%rax)
+  803f57:	00 c1                	add    %al,%cl
+  803f59:	0c 80                	or     $0x80,%al
+  803f5b:	00 00                	add    %al,(%rax)
+  803f5d:	00 00                	add    %al,(%rax)
+  803f5f:	00 c1                	add    %al,%cl
+  803f61:	0c 80                	or     $0x80,%al
+  803f63:	00 00                	add    %al,(%rax)
+  803f65:	00 00                	add    %al,(%rax)
+  803f67:	00 c1                	add    %al,%cl
+  803f69:	0c 80                	or     $0x80,%al
+  803f6b:	00 00                	add    %al,(%rax)
+  803f6d:	00 00                	add    %al,(%rax)
+  803f6f:	00 c1                	add    %al,%cl
+  803f71:	0c 80                	or     $0x80,%al
+  803f73:	00 00                	add    %al,(%rax)
+  803f75:	00 00                	add    %al,(%rax)
+  803f77:	00 c1                	add    %al,%cl
+  803f79:	0c 80                	or     $0x80,%al
+  803f7b:	00 00                	add    %al,(%rax)
+  803f7d:	00 00                	add    %al,(%rax)
+  803f7f:	00 c1                	add    %al,%cl
+  803f81:	0c 80                	or     $0x80,%al
+  803f83:	00 00                	add    %al,(%rax)
+  803f85:	00 00                	add    %al,(%rax)
+  803f87:	00 c1                	add    %al,%cl
+  803f89:	0c 80                	or     $0x80,%al
+  803f8b:	00 00                	add    %al,(%rax)
+  803f8d:	00 00                	add    %al,(%rax)
+  803f8f:	00 c1                	add    %al,%cl
+  803f91:	0c 80                	or     $0x80,%al
+  803f93:	00 00                	add    %al,(%rax)
+  803f95:	00 00                	add    %al,(%rax)
+  803f97:	00 c1                	add    %al,%cl
+  803f99:	0c 80                	or     $0x80,%al
+  803f9b:	00 00                	add    %al,(%rax)
+  803f9d:	00 00                	add    %al,(%rax)
+  803f9f:	00 30                	add    %dh,(%rax)
+  803fa1:	07                   	(bad)
+  803fa2:	80 00 00             	addb   $0x0,(%rax)
+  803fa5:	00 00                	add    %al,(%rax)
+  803fa7:	00 ff                	add    %bh,%bh
+  803fa9:	08 80 00 00 00 00    	or     %al,0x0(%rax)
+  803faf:	00 c1                	add    %al,%cl
+  803fb1:	0c 80                	or     $0x80,%al
+  803fb3:	00 00                	add    %al,(%rax)
+  803fb5:	00 00                	add    %al,(%rax)
+  803fb7:	00 c1                	add    %al,%cl
+  803fb9:	0c 80                	or     $0x80,%al
+  803fbb:	00 00                	add    %al,(%rax)
+  803fbd:	00 00                	add    %al,(%rax)
+  803fbf:	00 c1                	add    %al,%cl
+  803fc1:	0c 80                	or     $0x80,%al
+  803fc3:	00 00                	add    %al,(%rax)
+  803fc5:	00 00                	add    %al,(%rax)
+  803fc7:	00 c1                	add    %al,%cl
+  803fc9:	0c 80                	or     $0x80,%al
+  803fcb:	00 00                	add    %al,(%rax)
+  803fcd:	00 00                	add    %al,(%rax)
+  803fcf:	00 5f 07             	add    %bl,0x7(%rdi)
+  803fd2:	80 00 00             	addb   $0x0,(%rax)
+  803fd5:	00 00                	add    %al,(%rax)
+  803fd7:	00 c1                	add    %al,%cl
+  803fd9:	0c 80                	or     $0x80,%al
+  803fdb:	00 00                	add    %al,(%rax)
+  803fdd:	00 00                	add    %al,(%rax)
+  803fdf:	00 c1                	add    %al,%cl
+  803fe1:	0c 80                	or     $0x80,%al
+  803fe3:	00 00                	add    %al,(%rax)
+  803fe5:	00 00                	add    %al,(%rax)
+  803fe7:	00 25 07 80 00 00    	add    %ah,0x8007(%rip)        # 80bff4 <__bss_end+0x2ff4>
+  803fed:	00 00                	add    %al,(%rax)
+  803fef:	00 c1                	add    %al,%cl
+  803ff1:	0c 80                	or     $0x80,%al
+  803ff3:	00 00                	add    %al,(%rax)
+  803ff5:	00 00                	add    %al,(%rax)
+  803ff7:	00 c1                	add    %al,%cl
+  803ff9:	0c 80                	or     $0x80,%al
+  803ffb:	00 00                	add    %al,(%rax)
+  803ffd:	00 00                	add    %al,(%rax)
+  803fff:	00 a7 0a 80 00 00    	add    %ah,0x800a(%rdi)
+  804005:	00 00                	add    %al,(%rax)
+  804007:	00 71 0b             	add    %dh,0xb(%rcx)
+  80400a:	80 00 00             	addb   $0x0,(%rax)
+  80400d:	00 00                	add    %al,(%rax)
+  80400f:	00 c1                	add    %al,%cl
+  804011:	0c 80                	or     $0x80,%al
+  804013:	00 00                	add    %al,(%rax)
+  804015:	00 00                	add    %al,(%rax)
+  804017:	00 c1                	add    %al,%cl
+  804019:	0c 80                	or     $0x80,%al
+  80401b:	00 00                	add    %al,(%rax)
+  80401d:	00 00                	add    %al,(%rax)
+  80401f:	00 f6                	add    %dh,%dh
+  804021:	07                   	(bad)
+  804022:	80 00 00             	addb   $0x0,(%rax)
+  804025:	00 00                	add    %al,(%rax)
+  804027:	00 c1                	add    %al,%cl
+  804029:	0c 80                	or     $0x80,%al
+  80402b:	00 00                	add    %al,(%rax)
+  80402d:	00 00                	add    %al,(%rax)
+  80402f:	00 d3                	add    %dl,%bl
+  804031:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  804037:	00 c1                	add    %al,%cl
+  804039:	0c 80                	or     $0x80,%al
+  80403b:	00 00                	add    %al,(%rax)
+  80403d:	00 00                	add    %al,(%rax)
+  80403f:	00 c1                	add    %al,%cl
+  804041:	0c 80                	or     $0x80,%al
+  804043:	00 00                	add    %al,(%rax)
+  804045:	00 00                	add    %al,(%rax)
+  804047:	00 e4                	add    %ah,%ah
+  804049:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  80404f:	00 c1                	add    %al,%cl
+  804051:	0c 80                	or     $0x80,%al
+  804053:	00 00                	add    %al,(%rax)
+  804055:	00 00                	add    %al,(%rax)
+  804057:	00 89 06 80 00 00    	add    %cl,0x8006(%rcx)
+  80405d:	00 00                	add    %al,(%rax)
+	...
+
+0000000000804060 <error_string>:
+	...
+  804068:	fd 3b 80 00 00 00 00 00 0f 3c 80 00 00 00 00 00     .;.......<......
+  804078:	1f 3c 80 00 00 00 00 00 31 3c 80 00 00 00 00 00     .<......1<......
+  804088:	3f 3c 80 00 00 00 00 00 53 3c 80 00 00 00 00 00     ?<......S<......
+  804098:	68 3c 80 00 00 00 00 00 7b 3c 80 00 00 00 00 00     h<......{<......
+  8040a8:	8d 3c 80 00 00 00 00 00 a1 3c 80 00 00 00 00 00     .<.......<......
+  8040b8:	b1 3c 80 00 00 00 00 00 c4 3c 80 00 00 00 00 00     .<.......<......
+  8040c8:	db 3c 80 00 00 00 00 00 f1 3c 80 00 00 00 00 00     .<.......<......
+  8040d8:	09 3d 80 00 00 00 00 00 21 3d 80 00 00 00 00 00     .=......!=......
+  8040e8:	2e 3d 80 00 00 00 00 00 10 41 80 00 00 00 00 00     .=.......A......
+  8040f8:	42 3d 80 00 00 00 00 00 5a 3d 80 00 00 00 00 00     B=......Z=......
+  804108:	70 3d 80 00 00 00 00 00 66 69 6c 65 20 69 73 20     p=......file is 
+  804118:	6e 6f 74 20 61 20 76 61 6c 69 64 20 65 78 65 63     not a valid exec
+  804128:	75 74 61 62 6c 65 00 90 73 79 73 63 61 6c 6c 20     utable..syscall 
+  804138:	25 7a 64 20 72 65 74 75 72 6e 65 64 20 25 7a 64     %zd returned %zd
+  804148:	20 28 3e 20 30 29 00 6c 69 62 2f 73 79 73 63 61      (> 0).lib/sysca
+  804158:	6c 6c 2e 63 00 46 6f 72 6b 20 64 6f 75 62 6c 65     ll.c.Fork double
+  804168:	20 66 61 75 6c 74 00 6c 69 62 2f 66 6f 72 6b 2e      fault.lib/fork.
+  804178:	63 00 73 66 6f 72 6b 28 29 20 69 73 20 6e 6f 74     c.sfork() is not
+  804188:	20 69 6d 70 6c 65 6d 65 6e 74 65 64 00 0f 1f 00      implemented....
+  804198:	5b 25 30 38 78 5d 20 75 6e 6b 6e 6f 77 6e 20 64     [%08x] unknown d
+  8041a8:	65 76 69 63 65 20 74 79 70 65 20 25 64 0a 00 00     evice type %d...
+  8041b8:	5b 25 30 38 78 5d 20 66 74 72 75 6e 63 61 74 65     [%08x] ftruncate
+  8041c8:	20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65 0a      %d -- bad mode.
+  8041d8:	00 5b 25 30 38 78 5d 20 72 65 61 64 20 25 64 20     .[%08x] read %d 
+  8041e8:	2d 2d 20 62 61 64 20 6d 6f 64 65 0a 00 5b 25 30     -- bad mode..[%0
+  8041f8:	38 78 5d 20 77 72 69 74 65 20 25 64 20 2d 2d 20     8x] write %d -- 
+  804208:	62 61 64 20 6d 6f 64 65 0a 00 66 2e 0f 1f 84 00     bad mode..f.....
+  804218:	00 00 00 00 0f 1f 40 00                             ......@.
+
+0000000000804220 <devtab>:
+  804220:	20 50 80 00 00 00 00 00 60 50 80 00 00 00 00 00      P......`P......
+  804230:	a0 50 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .P..............
+  804240:	57 72 6f 6e 67 20 45 4c 46 20 68 65 61 64 65 72     Wrong ELF header
+  804250:	20 73 69 7a 65 20 6f 72 20 72 65 61 64 20 65 72      size or read er
+  804260:	72 6f 72 3a 20 25 69 0a 00 00 00 00 00 00 00 00     ror: %i.........
+  804270:	73 74 72 69 6e 67 5f 73 74 6f 72 65 20 3d 3d 20     string_store == 
+  804280:	28 63 68 61 72 20 2a 29 55 54 45 4d 50 20 2b 20     (char *)UTEMP + 
+  804290:	55 53 45 52 5f 53 54 41 43 4b 5f 53 49 5a 45 00     USER_STACK_SIZE.
+  8042a0:	45 6c 66 20 6d 61 67 69 63 20 25 30 38 78 20 77     Elf magic %08x w
+  8042b0:	61 6e 74 20 25 30 38 78 0a 00 61 73 73 65 72 74     ant %08x..assert
+  8042c0:	69 6f 6e 20 66 61 69 6c 65 64 3a 20 25 73 00 6c     ion failed: %s.l
+  8042d0:	69 62 2f 73 70 61 77 6e 2e 63 00 63 6f 70 79 5f     ib/spawn.c.copy_
+  8042e0:	73 68 61 72 65 64 5f 72 65 67 69 6f 6e 3a 20 25     shared_region: %
+  8042f0:	69 00 73 79 73 5f 65 6e 76 5f 73 65 74 5f 74 72     i.sys_env_set_tr
+  804300:	61 70 66 72 61 6d 65 3a 20 25 69 00 73 79 73 5f     apframe: %i.sys_
+  804310:	65 6e 76 5f 73 65 74 5f 73 74 61 74 75 73 3a 20     env_set_status: 
+  804320:	25 69 00 3c 70 69 70 65 3e 00 6c 69 62 2f 70 69     %i.<pipe>.lib/pi
+  804330:	70 65 2e 63 00 70 69 70 65 00 66 0f 1f 44 00 00     pe.c.pipe.f..D..
+  804340:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  804350:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  804360:	3d 20 32 00 65 6e 76 69 64 20 21 3d 20 30 00 6c     = 2.envid != 0.l
+  804370:	69 62 2f 77 61 69 74 2e 63 00 3c 63 6f 6e 73 3e     ib/wait.c.<cons>
+  804380:	00 63 6f 6e 73 00 73 79 73 5f 69 70 63 5f 74 72     .cons.sys_ipc_tr
+  804390:	79 5f 73 65 6e 64 20 66 61 69 6c 65 64 3a 20 25     y_send failed: %
+  8043a0:	69 00 6c 69 62 2f 69 70 63 2e 63 00 66 2e 0f 1f     i.lib/ipc.c.f...
+  8043b0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8043c0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8043d0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8043e0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8043f0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804400:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804410:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804420:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804430:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804440:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804450:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804460:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804470:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804480:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804490:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8044a0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8044b0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8044c0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8044d0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8044e0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8044f0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804500:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804510:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804520:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804530:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804540:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804550:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804560:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804570:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804580:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804590:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8045a0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8045b0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8045c0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8045d0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8045e0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8045f0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804600:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804610:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804620:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804630:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804640:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804650:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804660:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804670:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804680:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804690:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8046a0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8046b0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8046c0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8046d0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8046e0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8046f0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804700:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804710:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804720:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804730:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804740:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804750:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804760:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804770:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804780:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804790:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8047a0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8047b0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8047c0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8047d0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8047e0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8047f0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804800:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804810:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804820:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804830:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804840:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804850:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804860:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804870:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804880:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804890:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8048a0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8048b0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8048c0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8048d0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8048e0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8048f0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804900:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804910:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804920:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804930:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804940:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804950:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804960:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804970:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804980:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804990:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8049a0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8049b0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8049c0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8049d0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8049e0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8049f0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804a00:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804a10:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804a20:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804a30:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804a40:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804a50:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804a60:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804a70:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804a80:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804a90:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804aa0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804ab0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804ac0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804ad0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804ae0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804af0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804b00:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804b10:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804b20:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804b30:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804b40:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804b50:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804b60:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804b70:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804b80:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804b90:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804ba0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804bb0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804bc0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804bd0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804be0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804bf0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804c00:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804c10:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804c20:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804c30:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804c40:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804c50:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804c60:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804c70:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804c80:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804c90:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804ca0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804cb0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804cc0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804cd0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804ce0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804cf0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804d00:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804d10:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804d20:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804d30:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804d40:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804d50:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804d60:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804d70:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804d80:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804d90:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804da0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804db0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804dc0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804dd0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804de0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804df0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804e00:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804e10:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804e20:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804e30:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804e40:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804e50:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804e60:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804e70:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804e80:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804e90:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804ea0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804eb0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804ec0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804ed0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804ee0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804ef0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804f00:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804f10:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804f20:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804f30:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804f40:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804f50:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804f60:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804f70:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804f80:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804f90:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804fa0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804fb0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804fc0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804fd0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804fe0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804ff0:	66 2e 0f 1f 84 00 00 00 00 00 66 0f 1f 44 00 00     f.........f..D..
@@ -0,0 +1,7265 @@
+
+obj/user/testshell:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 e5 06 00 00       	call   800708 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <wrong>:
+
+    breakpoint();
+}
+
+void
+wrong(int rfd, int kfd, int off, char c1, char c2) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 57                	push   %r15
+  80002b:	41 56                	push   %r14
+  80002d:	41 55                	push   %r13
+  80002f:	41 54                	push   %r12
+  800031:	53                   	push   %rbx
+  800032:	48 81 ec 88 00 00 00 	sub    $0x88,%rsp
+  800039:	89 fb                	mov    %edi,%ebx
+  80003b:	41 89 f4             	mov    %esi,%r12d
+  80003e:	41 89 d6             	mov    %edx,%r14d
+  800041:	41 89 cd             	mov    %ecx,%r13d
+  800044:	44 89 85 5c ff ff ff 	mov    %r8d,-0xa4(%rbp)
+    char buf[100];
+    int n;
+
+    seek(rfd, off);
+  80004b:	89 d6                	mov    %edx,%esi
+  80004d:	49 bf 24 23 80 00 00 	movabs $0x802324,%r15
+  800054:	00 00 00 
+  800057:	41 ff d7             	call   *%r15
+    seek(kfd, off);
+  80005a:	44 89 f6             	mov    %r14d,%esi
+  80005d:	44 89 e7             	mov    %r12d,%edi
+  800060:	41 ff d7             	call   *%r15
+
+    cprintf("shell produced incorrect output.\n");
+  800063:	48 bf 58 3d 80 00 00 	movabs $0x803d58,%rdi
+  80006a:	00 00 00 
+  80006d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800072:	49 be 24 09 80 00 00 	movabs $0x800924,%r14
+  800079:	00 00 00 
+  80007c:	41 ff d6             	call   *%r14
+    cprintf("expected:\n===\n%c", c1);
+  80007f:	41 0f be f5          	movsbl %r13b,%esi
+  800083:	48 bf cb 3d 80 00 00 	movabs $0x803dcb,%rdi
+  80008a:	00 00 00 
+  80008d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800092:	41 ff d6             	call   *%r14
+    while ((n = read(kfd, buf, sizeof buf - 1)) > 0)
+  800095:	49 bd 3c 21 80 00 00 	movabs $0x80213c,%r13
+  80009c:	00 00 00 
+        sys_cputs(buf, n);
+  80009f:	49 be 70 16 80 00 00 	movabs $0x801670,%r14
+  8000a6:	00 00 00 
+    while ((n = read(kfd, buf, sizeof buf - 1)) > 0)
+  8000a9:	eb 0d                	jmp    8000b8 <wrong+0x93>
+        sys_cputs(buf, n);
+  8000ab:	48 63 f0             	movslq %eax,%rsi
+  8000ae:	48 8d bd 6c ff ff ff 	lea    -0x94(%rbp),%rdi
+  8000b5:	41 ff d6             	call   *%r14
+    while ((n = read(kfd, buf, sizeof buf - 1)) > 0)
+  8000b8:	ba 63 00 00 00       	mov    $0x63,%edx
+  8000bd:	48 8d b5 6c ff ff ff 	lea    -0x94(%rbp),%rsi
+  8000c4:	44 89 e7             	mov    %r12d,%edi
+  8000c7:	41 ff d5             	call   *%r13
+  8000ca:	85 c0                	test   %eax,%eax
+  8000cc:	7f dd                	jg     8000ab <wrong+0x86>
+    cprintf("===\ngot:\n===\n%c", c2);
+  8000ce:	0f be b5 5c ff ff ff 	movsbl -0xa4(%rbp),%esi
+  8000d5:	48 bf dc 3d 80 00 00 	movabs $0x803ddc,%rdi
+  8000dc:	00 00 00 
+  8000df:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000e4:	48 ba 24 09 80 00 00 	movabs $0x800924,%rdx
+  8000eb:	00 00 00 
+  8000ee:	ff d2                	call   *%rdx
+    while ((n = read(rfd, buf, sizeof buf - 1)) > 0)
+  8000f0:	49 bc 3c 21 80 00 00 	movabs $0x80213c,%r12
+  8000f7:	00 00 00 
+        sys_cputs(buf, n);
+  8000fa:	49 bd 70 16 80 00 00 	movabs $0x801670,%r13
+  800101:	00 00 00 
+    while ((n = read(rfd, buf, sizeof buf - 1)) > 0)
+  800104:	eb 0d                	jmp    800113 <wrong+0xee>
+        sys_cputs(buf, n);
+  800106:	48 63 f0             	movslq %eax,%rsi
+  800109:	48 8d bd 6c ff ff ff 	lea    -0x94(%rbp),%rdi
+  800110:	41 ff d5             	call   *%r13
+    while ((n = read(rfd, buf, sizeof buf - 1)) > 0)
+  800113:	ba 63 00 00 00       	mov    $0x63,%edx
+  800118:	48 8d b5 6c ff ff ff 	lea    -0x94(%rbp),%rsi
+  80011f:	89 df                	mov    %ebx,%edi
+  800121:	41 ff d4             	call   *%r12
+  800124:	85 c0                	test   %eax,%eax
+  800126:	7f de                	jg     800106 <wrong+0xe1>
+    cprintf("===\n");
+  800128:	48 bf ec 3d 80 00 00 	movabs $0x803dec,%rdi
+  80012f:	00 00 00 
+  800132:	b8 00 00 00 00       	mov    $0x0,%eax
+  800137:	48 ba 24 09 80 00 00 	movabs $0x800924,%rdx
+  80013e:	00 00 00 
+  800141:	ff d2                	call   *%rdx
+    exit();
+  800143:	48 b8 b1 07 80 00 00 	movabs $0x8007b1,%rax
+  80014a:	00 00 00 
+  80014d:	ff d0                	call   *%rax
+}
+  80014f:	48 81 c4 88 00 00 00 	add    $0x88,%rsp
+  800156:	5b                   	pop    %rbx
+  800157:	41 5c                	pop    %r12
+  800159:	41 5d                	pop    %r13
+  80015b:	41 5e                	pop    %r14
+  80015d:	41 5f                	pop    %r15
+  80015f:	5d                   	pop    %rbp
+  800160:	c3                   	ret
+
+0000000000800161 <umain>:
+umain(int argc, char **argv) {
+  800161:	55                   	push   %rbp
+  800162:	48 89 e5             	mov    %rsp,%rbp
+  800165:	41 57                	push   %r15
+  800167:	41 56                	push   %r14
+  800169:	41 55                	push   %r13
+  80016b:	41 54                	push   %r12
+  80016d:	53                   	push   %rbx
+  80016e:	48 83 ec 28          	sub    $0x28,%rsp
+    close(0);
+  800172:	bf 00 00 00 00       	mov    $0x0,%edi
+  800177:	48 bb be 1f 80 00 00 	movabs $0x801fbe,%rbx
+  80017e:	00 00 00 
+  800181:	ff d3                	call   *%rbx
+    close(1);
+  800183:	bf 01 00 00 00       	mov    $0x1,%edi
+  800188:	ff d3                	call   *%rbx
+    opencons();
+  80018a:	48 bb a1 06 80 00 00 	movabs $0x8006a1,%rbx
+  800191:	00 00 00 
+  800194:	ff d3                	call   *%rbx
+    opencons();
+  800196:	ff d3                	call   *%rbx
+    if ((rfd = open("testshell.sh", O_RDONLY)) < 0)
+  800198:	be 00 00 00 00       	mov    $0x0,%esi
+  80019d:	48 bf f1 3d 80 00 00 	movabs $0x803df1,%rdi
+  8001a4:	00 00 00 
+  8001a7:	48 b8 5c 28 80 00 00 	movabs $0x80285c,%rax
+  8001ae:	00 00 00 
+  8001b1:	ff d0                	call   *%rax
+  8001b3:	89 c3                	mov    %eax,%ebx
+  8001b5:	85 c0                	test   %eax,%eax
+  8001b7:	0f 88 4c 01 00 00    	js     800309 <umain+0x1a8>
+    if ((wfd = pipe(pfds)) < 0)
+  8001bd:	48 8d 7d c4          	lea    -0x3c(%rbp),%rdi
+  8001c1:	48 b8 d6 35 80 00 00 	movabs $0x8035d6,%rax
+  8001c8:	00 00 00 
+  8001cb:	ff d0                	call   *%rax
+  8001cd:	85 c0                	test   %eax,%eax
+  8001cf:	0f 88 61 01 00 00    	js     800336 <umain+0x1d5>
+    wfd = pfds[1];
+  8001d5:	44 8b 65 c8          	mov    -0x38(%rbp),%r12d
+    cprintf("running sh -x < testshell.sh | cat\n");
+  8001d9:	48 bf 80 3d 80 00 00 	movabs $0x803d80,%rdi
+  8001e0:	00 00 00 
+  8001e3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001e8:	48 ba 24 09 80 00 00 	movabs $0x800924,%rdx
+  8001ef:	00 00 00 
+  8001f2:	ff d2                	call   *%rdx
+    if ((r = fork()) < 0)
+  8001f4:	48 b8 34 1c 80 00 00 	movabs $0x801c34,%rax
+  8001fb:	00 00 00 
+  8001fe:	ff d0                	call   *%rax
+  800200:	85 c0                	test   %eax,%eax
+  800202:	0f 88 5b 01 00 00    	js     800363 <umain+0x202>
+    if (r == 0) {
+  800208:	0f 85 a9 00 00 00    	jne    8002b7 <umain+0x156>
+        dup(rfd, 0);
+  80020e:	be 00 00 00 00       	mov    $0x0,%esi
+  800213:	89 df                	mov    %ebx,%edi
+  800215:	49 bd 19 20 80 00 00 	movabs $0x802019,%r13
+  80021c:	00 00 00 
+  80021f:	41 ff d5             	call   *%r13
+        dup(wfd, 1);
+  800222:	be 01 00 00 00       	mov    $0x1,%esi
+  800227:	44 89 e7             	mov    %r12d,%edi
+  80022a:	41 ff d5             	call   *%r13
+        close(rfd);
+  80022d:	89 df                	mov    %ebx,%edi
+  80022f:	49 bd be 1f 80 00 00 	movabs $0x801fbe,%r13
+  800236:	00 00 00 
+  800239:	41 ff d5             	call   *%r13
+        close(wfd);
+  80023c:	44 89 e7             	mov    %r12d,%edi
+  80023f:	41 ff d5             	call   *%r13
+        if ((r = spawnl("/sh", "sh", "-x", 0)) < 0)
+  800242:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800247:	48 ba 37 3e 80 00 00 	movabs $0x803e37,%rdx
+  80024e:	00 00 00 
+  800251:	48 be fb 3d 80 00 00 	movabs $0x803dfb,%rsi
+  800258:	00 00 00 
+  80025b:	48 bf 3a 3e 80 00 00 	movabs $0x803e3a,%rdi
+  800262:	00 00 00 
+  800265:	b8 00 00 00 00       	mov    $0x0,%eax
+  80026a:	49 b8 3a 32 80 00 00 	movabs $0x80323a,%r8
+  800271:	00 00 00 
+  800274:	41 ff d0             	call   *%r8
+  800277:	41 89 c5             	mov    %eax,%r13d
+  80027a:	85 c0                	test   %eax,%eax
+  80027c:	0f 88 0e 01 00 00    	js     800390 <umain+0x22f>
+        close(0);
+  800282:	bf 00 00 00 00       	mov    $0x0,%edi
+  800287:	49 be be 1f 80 00 00 	movabs $0x801fbe,%r14
+  80028e:	00 00 00 
+  800291:	41 ff d6             	call   *%r14
+        close(1);
+  800294:	bf 01 00 00 00       	mov    $0x1,%edi
+  800299:	41 ff d6             	call   *%r14
+        wait(r);
+  80029c:	44 89 ef             	mov    %r13d,%edi
+  80029f:	48 b8 2b 38 80 00 00 	movabs $0x80382b,%rax
+  8002a6:	00 00 00 
+  8002a9:	ff d0                	call   *%rax
+        exit();
+  8002ab:	48 b8 b1 07 80 00 00 	movabs $0x8007b1,%rax
+  8002b2:	00 00 00 
+  8002b5:	ff d0                	call   *%rax
+    close(rfd);
+  8002b7:	89 df                	mov    %ebx,%edi
+  8002b9:	48 bb be 1f 80 00 00 	movabs $0x801fbe,%rbx
+  8002c0:	00 00 00 
+  8002c3:	ff d3                	call   *%rbx
+    close(wfd);
+  8002c5:	44 89 e7             	mov    %r12d,%edi
+  8002c8:	ff d3                	call   *%rbx
+    rfd = pfds[0];
+  8002ca:	44 8b 7d c4          	mov    -0x3c(%rbp),%r15d
+    if ((kfd = open("testshell.key", O_RDONLY)) < 0)
+  8002ce:	be 00 00 00 00       	mov    $0x0,%esi
+  8002d3:	48 bf 48 3e 80 00 00 	movabs $0x803e48,%rdi
+  8002da:	00 00 00 
+  8002dd:	48 b8 5c 28 80 00 00 	movabs $0x80285c,%rax
+  8002e4:	00 00 00 
+  8002e7:	ff d0                	call   *%rax
+  8002e9:	41 89 c6             	mov    %eax,%r14d
+  8002ec:	85 c0                	test   %eax,%eax
+  8002ee:	0f 88 c9 00 00 00    	js     8003bd <umain+0x25c>
+    for (off = 0;; off++) {
+  8002f4:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+        n1 = read(rfd, &c1, 1);
+  8002fa:	49 bd 3c 21 80 00 00 	movabs $0x80213c,%r13
+  800301:	00 00 00 
+  800304:	e9 5c 01 00 00       	jmp    800465 <umain+0x304>
+        panic("open testshell.sh: %i", rfd);
+  800309:	89 c1                	mov    %eax,%ecx
+  80030b:	48 ba fe 3d 80 00 00 	movabs $0x803dfe,%rdx
+  800312:	00 00 00 
+  800315:	be 12 00 00 00       	mov    $0x12,%esi
+  80031a:	48 bf 14 3e 80 00 00 	movabs $0x803e14,%rdi
+  800321:	00 00 00 
+  800324:	b8 00 00 00 00       	mov    $0x0,%eax
+  800329:	49 b8 d4 07 80 00 00 	movabs $0x8007d4,%r8
+  800330:	00 00 00 
+  800333:	41 ff d0             	call   *%r8
+        panic("pipe: %i", wfd);
+  800336:	89 c1                	mov    %eax,%ecx
+  800338:	48 ba 25 3e 80 00 00 	movabs $0x803e25,%rdx
+  80033f:	00 00 00 
+  800342:	be 14 00 00 00       	mov    $0x14,%esi
+  800347:	48 bf 14 3e 80 00 00 	movabs $0x803e14,%rdi
+  80034e:	00 00 00 
+  800351:	b8 00 00 00 00       	mov    $0x0,%eax
+  800356:	49 b8 d4 07 80 00 00 	movabs $0x8007d4,%r8
+  80035d:	00 00 00 
+  800360:	41 ff d0             	call   *%r8
+        panic("fork: %i", r);
+  800363:	89 c1                	mov    %eax,%ecx
+  800365:	48 ba 2e 3e 80 00 00 	movabs $0x803e2e,%rdx
+  80036c:	00 00 00 
+  80036f:	be 19 00 00 00       	mov    $0x19,%esi
+  800374:	48 bf 14 3e 80 00 00 	movabs $0x803e14,%rdi
+  80037b:	00 00 00 
+  80037e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800383:	49 b8 d4 07 80 00 00 	movabs $0x8007d4,%r8
+  80038a:	00 00 00 
+  80038d:	41 ff d0             	call   *%r8
+            panic("spawn: %i", r);
+  800390:	89 c1                	mov    %eax,%ecx
+  800392:	48 ba 3e 3e 80 00 00 	movabs $0x803e3e,%rdx
+  800399:	00 00 00 
+  80039c:	be 20 00 00 00       	mov    $0x20,%esi
+  8003a1:	48 bf 14 3e 80 00 00 	movabs $0x803e14,%rdi
+  8003a8:	00 00 00 
+  8003ab:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003b0:	49 b8 d4 07 80 00 00 	movabs $0x8007d4,%r8
+  8003b7:	00 00 00 
+  8003ba:	41 ff d0             	call   *%r8
+        panic("open testshell.key for reading: %i", kfd);
+  8003bd:	89 c1                	mov    %eax,%ecx
+  8003bf:	48 ba a8 3d 80 00 00 	movabs $0x803da8,%rdx
+  8003c6:	00 00 00 
+  8003c9:	be 2b 00 00 00       	mov    $0x2b,%esi
+  8003ce:	48 bf 14 3e 80 00 00 	movabs $0x803e14,%rdi
+  8003d5:	00 00 00 
+  8003d8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003dd:	49 b8 d4 07 80 00 00 	movabs $0x8007d4,%r8
+  8003e4:	00 00 00 
+  8003e7:	41 ff d0             	call   *%r8
+            panic("reading testshell.out: %i", n1);
+  8003ea:	8b 4d bc             	mov    -0x44(%rbp),%ecx
+  8003ed:	48 ba 56 3e 80 00 00 	movabs $0x803e56,%rdx
+  8003f4:	00 00 00 
+  8003f7:	be 32 00 00 00       	mov    $0x32,%esi
+  8003fc:	48 bf 14 3e 80 00 00 	movabs $0x803e14,%rdi
+  800403:	00 00 00 
+  800406:	b8 00 00 00 00       	mov    $0x0,%eax
+  80040b:	49 b8 d4 07 80 00 00 	movabs $0x8007d4,%r8
+  800412:	00 00 00 
+  800415:	41 ff d0             	call   *%r8
+            panic("reading testshell.key: %i", n2);
+  800418:	48 ba 70 3e 80 00 00 	movabs $0x803e70,%rdx
+  80041f:	00 00 00 
+  800422:	be 34 00 00 00       	mov    $0x34,%esi
+  800427:	48 bf 14 3e 80 00 00 	movabs $0x803e14,%rdi
+  80042e:	00 00 00 
+  800431:	b8 00 00 00 00       	mov    $0x0,%eax
+  800436:	49 b8 d4 07 80 00 00 	movabs $0x8007d4,%r8
+  80043d:	00 00 00 
+  800440:	41 ff d0             	call   *%r8
+            wrong(rfd, kfd, off, c1, c2);
+  800443:	0f be 4d cf          	movsbl -0x31(%rbp),%ecx
+  800447:	44 0f be 45 ce       	movsbl -0x32(%rbp),%r8d
+  80044c:	44 89 e2             	mov    %r12d,%edx
+  80044f:	44 89 f6             	mov    %r14d,%esi
+  800452:	44 89 ff             	mov    %r15d,%edi
+  800455:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  80045c:	00 00 00 
+  80045f:	ff d0                	call   *%rax
+    for (off = 0;; off++) {
+  800461:	41 83 c4 01          	add    $0x1,%r12d
+        n1 = read(rfd, &c1, 1);
+  800465:	ba 01 00 00 00       	mov    $0x1,%edx
+  80046a:	48 8d 75 cf          	lea    -0x31(%rbp),%rsi
+  80046e:	44 89 ff             	mov    %r15d,%edi
+  800471:	41 ff d5             	call   *%r13
+  800474:	48 89 c3             	mov    %rax,%rbx
+  800477:	89 45 bc             	mov    %eax,-0x44(%rbp)
+        n2 = read(kfd, &c2, 1);
+  80047a:	ba 01 00 00 00       	mov    $0x1,%edx
+  80047f:	48 8d 75 ce          	lea    -0x32(%rbp),%rsi
+  800483:	44 89 f7             	mov    %r14d,%edi
+  800486:	41 ff d5             	call   *%r13
+  800489:	89 c1                	mov    %eax,%ecx
+        if (n1 < 0)
+  80048b:	85 db                	test   %ebx,%ebx
+  80048d:	0f 88 57 ff ff ff    	js     8003ea <umain+0x289>
+        if (n2 < 0)
+  800493:	85 c0                	test   %eax,%eax
+  800495:	78 81                	js     800418 <umain+0x2b7>
+        if (n1 == 0 && n2 == 0)
+  800497:	89 c2                	mov    %eax,%edx
+  800499:	09 da                	or     %ebx,%edx
+  80049b:	74 15                	je     8004b2 <umain+0x351>
+        if (n1 != 1 || n2 != 1 || c1 != c2) {
+  80049d:	83 fb 01             	cmp    $0x1,%ebx
+  8004a0:	75 a1                	jne    800443 <umain+0x2e2>
+  8004a2:	83 f8 01             	cmp    $0x1,%eax
+  8004a5:	75 9c                	jne    800443 <umain+0x2e2>
+  8004a7:	0f b6 45 ce          	movzbl -0x32(%rbp),%eax
+  8004ab:	38 45 cf             	cmp    %al,-0x31(%rbp)
+  8004ae:	75 93                	jne    800443 <umain+0x2e2>
+  8004b0:	eb af                	jmp    800461 <umain+0x300>
+    cprintf("shell ran correctly\n");
+  8004b2:	48 bf 8a 3e 80 00 00 	movabs $0x803e8a,%rdi
+  8004b9:	00 00 00 
+  8004bc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004c1:	48 ba 24 09 80 00 00 	movabs $0x800924,%rdx
+  8004c8:	00 00 00 
+  8004cb:	ff d2                	call   *%rdx
+
+#include <inc/types.h>
+
+static inline void __attribute__((always_inline))
+breakpoint(void) {
+    asm volatile("int3");
+  8004cd:	cc                   	int3
+}
+  8004ce:	48 83 c4 28          	add    $0x28,%rsp
+  8004d2:	5b                   	pop    %rbx
+  8004d3:	41 5c                	pop    %r12
+  8004d5:	41 5d                	pop    %r13
+  8004d7:	41 5e                	pop    %r14
+  8004d9:	41 5f                	pop    %r15
+  8004db:	5d                   	pop    %rbp
+  8004dc:	c3                   	ret
+
+00000000008004dd <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  8004dd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004e2:	c3                   	ret
+
+00000000008004e3 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  8004e3:	55                   	push   %rbp
+  8004e4:	48 89 e5             	mov    %rsp,%rbp
+  8004e7:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  8004ea:	48 be 9f 3e 80 00 00 	movabs $0x803e9f,%rsi
+  8004f1:	00 00 00 
+  8004f4:	48 b8 49 12 80 00 00 	movabs $0x801249,%rax
+  8004fb:	00 00 00 
+  8004fe:	ff d0                	call   *%rax
+    return 0;
+}
+  800500:	b8 00 00 00 00       	mov    $0x0,%eax
+  800505:	5d                   	pop    %rbp
+  800506:	c3                   	ret
+
+0000000000800507 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  800507:	55                   	push   %rbp
+  800508:	48 89 e5             	mov    %rsp,%rbp
+  80050b:	41 57                	push   %r15
+  80050d:	41 56                	push   %r14
+  80050f:	41 55                	push   %r13
+  800511:	41 54                	push   %r12
+  800513:	53                   	push   %rbx
+  800514:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  80051b:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  800522:	48 85 d2             	test   %rdx,%rdx
+  800525:	74 7a                	je     8005a1 <devcons_write+0x9a>
+  800527:	49 89 d6             	mov    %rdx,%r14
+  80052a:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  800530:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  800535:	49 bf 43 14 80 00 00 	movabs $0x801443,%r15
+  80053c:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  80053f:	4c 89 f3             	mov    %r14,%rbx
+  800542:	48 29 f3             	sub    %rsi,%rbx
+  800545:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  80054a:	48 39 c3             	cmp    %rax,%rbx
+  80054d:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  800551:	4c 63 eb             	movslq %ebx,%r13
+  800554:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  80055b:	48 01 c6             	add    %rax,%rsi
+  80055e:	4c 89 ea             	mov    %r13,%rdx
+  800561:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  800568:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  80056b:	4c 89 ee             	mov    %r13,%rsi
+  80056e:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  800575:	48 b8 70 16 80 00 00 	movabs $0x801670,%rax
+  80057c:	00 00 00 
+  80057f:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  800581:	41 01 dc             	add    %ebx,%r12d
+  800584:	49 63 f4             	movslq %r12d,%rsi
+  800587:	4c 39 f6             	cmp    %r14,%rsi
+  80058a:	72 b3                	jb     80053f <devcons_write+0x38>
+    return res;
+  80058c:	49 63 c4             	movslq %r12d,%rax
+}
+  80058f:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  800596:	5b                   	pop    %rbx
+  800597:	41 5c                	pop    %r12
+  800599:	41 5d                	pop    %r13
+  80059b:	41 5e                	pop    %r14
+  80059d:	41 5f                	pop    %r15
+  80059f:	5d                   	pop    %rbp
+  8005a0:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  8005a1:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8005a7:	eb e3                	jmp    80058c <devcons_write+0x85>
+
+00000000008005a9 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8005a9:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  8005ac:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005b1:	48 85 c0             	test   %rax,%rax
+  8005b4:	74 55                	je     80060b <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8005b6:	55                   	push   %rbp
+  8005b7:	48 89 e5             	mov    %rsp,%rbp
+  8005ba:	41 55                	push   %r13
+  8005bc:	41 54                	push   %r12
+  8005be:	53                   	push   %rbx
+  8005bf:	48 83 ec 08          	sub    $0x8,%rsp
+  8005c3:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  8005c6:	48 bb 9d 16 80 00 00 	movabs $0x80169d,%rbx
+  8005cd:	00 00 00 
+  8005d0:	49 bc 6a 17 80 00 00 	movabs $0x80176a,%r12
+  8005d7:	00 00 00 
+  8005da:	eb 03                	jmp    8005df <devcons_read+0x36>
+  8005dc:	41 ff d4             	call   *%r12
+  8005df:	ff d3                	call   *%rbx
+  8005e1:	85 c0                	test   %eax,%eax
+  8005e3:	74 f7                	je     8005dc <devcons_read+0x33>
+    if (c < 0) return c;
+  8005e5:	48 63 d0             	movslq %eax,%rdx
+  8005e8:	78 13                	js     8005fd <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  8005ea:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005ef:	83 f8 04             	cmp    $0x4,%eax
+  8005f2:	74 09                	je     8005fd <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  8005f4:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  8005f8:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  8005fd:	48 89 d0             	mov    %rdx,%rax
+  800600:	48 83 c4 08          	add    $0x8,%rsp
+  800604:	5b                   	pop    %rbx
+  800605:	41 5c                	pop    %r12
+  800607:	41 5d                	pop    %r13
+  800609:	5d                   	pop    %rbp
+  80060a:	c3                   	ret
+  80060b:	48 89 d0             	mov    %rdx,%rax
+  80060e:	c3                   	ret
+
+000000000080060f <cputchar>:
+cputchar(int ch) {
+  80060f:	55                   	push   %rbp
+  800610:	48 89 e5             	mov    %rsp,%rbp
+  800613:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  800617:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  80061b:	be 01 00 00 00       	mov    $0x1,%esi
+  800620:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  800624:	48 b8 70 16 80 00 00 	movabs $0x801670,%rax
+  80062b:	00 00 00 
+  80062e:	ff d0                	call   *%rax
+}
+  800630:	c9                   	leave
+  800631:	c3                   	ret
+
+0000000000800632 <getchar>:
+getchar(void) {
+  800632:	55                   	push   %rbp
+  800633:	48 89 e5             	mov    %rsp,%rbp
+  800636:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  80063a:	ba 01 00 00 00       	mov    $0x1,%edx
+  80063f:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  800643:	bf 00 00 00 00       	mov    $0x0,%edi
+  800648:	48 b8 3c 21 80 00 00 	movabs $0x80213c,%rax
+  80064f:	00 00 00 
+  800652:	ff d0                	call   *%rax
+  800654:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  800656:	85 c0                	test   %eax,%eax
+  800658:	78 06                	js     800660 <getchar+0x2e>
+  80065a:	74 08                	je     800664 <getchar+0x32>
+  80065c:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  800660:	89 d0                	mov    %edx,%eax
+  800662:	c9                   	leave
+  800663:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  800664:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  800669:	eb f5                	jmp    800660 <getchar+0x2e>
+
+000000000080066b <iscons>:
+iscons(int fdnum) {
+  80066b:	55                   	push   %rbp
+  80066c:	48 89 e5             	mov    %rsp,%rbp
+  80066f:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  800673:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  800677:	48 b8 59 1e 80 00 00 	movabs $0x801e59,%rax
+  80067e:	00 00 00 
+  800681:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  800683:	85 c0                	test   %eax,%eax
+  800685:	78 18                	js     80069f <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  800687:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80068b:	48 b8 00 50 80 00 00 	movabs $0x805000,%rax
+  800692:	00 00 00 
+  800695:	8b 00                	mov    (%rax),%eax
+  800697:	39 02                	cmp    %eax,(%rdx)
+  800699:	0f 94 c0             	sete   %al
+  80069c:	0f b6 c0             	movzbl %al,%eax
+}
+  80069f:	c9                   	leave
+  8006a0:	c3                   	ret
+
+00000000008006a1 <opencons>:
+opencons(void) {
+  8006a1:	55                   	push   %rbp
+  8006a2:	48 89 e5             	mov    %rsp,%rbp
+  8006a5:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8006a9:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  8006ad:	48 b8 3f 1e 80 00 00 	movabs $0x801e3f,%rax
+  8006b4:	00 00 00 
+  8006b7:	ff d0                	call   *%rax
+  8006b9:	85 c0                	test   %eax,%eax
+  8006bb:	78 49                	js     800706 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  8006bd:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8006c2:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8006c7:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  8006cb:	bf 00 00 00 00       	mov    $0x0,%edi
+  8006d0:	48 b8 f9 17 80 00 00 	movabs $0x8017f9,%rax
+  8006d7:	00 00 00 
+  8006da:	ff d0                	call   *%rax
+  8006dc:	85 c0                	test   %eax,%eax
+  8006de:	78 26                	js     800706 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  8006e0:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8006e4:	a1 00 50 80 00 00 00 	movabs 0x805000,%eax
+  8006eb:	00 00 
+  8006ed:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  8006ef:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8006f3:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  8006fa:	48 b8 98 1d 80 00 00 	movabs $0x801d98,%rax
+  800701:	00 00 00 
+  800704:	ff d0                	call   *%rax
+}
+  800706:	c9                   	leave
+  800707:	c3                   	ret
+
+0000000000800708 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800708:	55                   	push   %rbp
+  800709:	48 89 e5             	mov    %rsp,%rbp
+  80070c:	41 56                	push   %r14
+  80070e:	41 55                	push   %r13
+  800710:	41 54                	push   %r12
+  800712:	53                   	push   %rbx
+  800713:	41 89 fd             	mov    %edi,%r13d
+  800716:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800719:	48 ba b8 50 80 00 00 	movabs $0x8050b8,%rdx
+  800720:	00 00 00 
+  800723:	48 b8 b8 50 80 00 00 	movabs $0x8050b8,%rax
+  80072a:	00 00 00 
+  80072d:	48 39 c2             	cmp    %rax,%rdx
+  800730:	73 17                	jae    800749 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  800732:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  800735:	49 89 c4             	mov    %rax,%r12
+  800738:	48 83 c3 08          	add    $0x8,%rbx
+  80073c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800741:	ff 53 f8             	call   *-0x8(%rbx)
+  800744:	4c 39 e3             	cmp    %r12,%rbx
+  800747:	72 ef                	jb     800738 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+    envid_t this_env_id = sys_getenvid();
+  800749:	48 b8 39 17 80 00 00 	movabs $0x801739,%rax
+  800750:	00 00 00 
+  800753:	ff d0                	call   *%rax
+    thisenv = &((struct Env*)UENVS)[ENVX(this_env_id)];
+  800755:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80075a:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+  800761:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  800768:	00 00 00 
+  80076b:	48 01 d0             	add    %rdx,%rax
+  80076e:	48 a3 00 60 80 00 00 	movabs %rax,0x806000
+  800775:	00 00 00 
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  800778:	45 85 ed             	test   %r13d,%r13d
+  80077b:	7e 0d                	jle    80078a <libmain+0x82>
+  80077d:	49 8b 06             	mov    (%r14),%rax
+  800780:	48 a3 38 50 80 00 00 	movabs %rax,0x805038
+  800787:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  80078a:	4c 89 f6             	mov    %r14,%rsi
+  80078d:	44 89 ef             	mov    %r13d,%edi
+  800790:	48 b8 61 01 80 00 00 	movabs $0x800161,%rax
+  800797:	00 00 00 
+  80079a:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  80079c:	48 b8 b1 07 80 00 00 	movabs $0x8007b1,%rax
+  8007a3:	00 00 00 
+  8007a6:	ff d0                	call   *%rax
+#endif
+}
+  8007a8:	5b                   	pop    %rbx
+  8007a9:	41 5c                	pop    %r12
+  8007ab:	41 5d                	pop    %r13
+  8007ad:	41 5e                	pop    %r14
+  8007af:	5d                   	pop    %rbp
+  8007b0:	c3                   	ret
+
+00000000008007b1 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8007b1:	55                   	push   %rbp
+  8007b2:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  8007b5:	48 b8 f1 1f 80 00 00 	movabs $0x801ff1,%rax
+  8007bc:	00 00 00 
+  8007bf:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  8007c1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8007c6:	48 b8 ce 16 80 00 00 	movabs $0x8016ce,%rax
+  8007cd:	00 00 00 
+  8007d0:	ff d0                	call   *%rax
+}
+  8007d2:	5d                   	pop    %rbp
+  8007d3:	c3                   	ret
+
+00000000008007d4 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  8007d4:	55                   	push   %rbp
+  8007d5:	48 89 e5             	mov    %rsp,%rbp
+  8007d8:	41 56                	push   %r14
+  8007da:	41 55                	push   %r13
+  8007dc:	41 54                	push   %r12
+  8007de:	53                   	push   %rbx
+  8007df:	48 83 ec 50          	sub    $0x50,%rsp
+  8007e3:	49 89 fc             	mov    %rdi,%r12
+  8007e6:	41 89 f5             	mov    %esi,%r13d
+  8007e9:	48 89 d3             	mov    %rdx,%rbx
+  8007ec:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  8007f0:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  8007f4:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  8007f8:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  8007ff:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800803:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  800807:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  80080b:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  80080f:	48 b8 38 50 80 00 00 	movabs $0x805038,%rax
+  800816:	00 00 00 
+  800819:	4c 8b 30             	mov    (%rax),%r14
+  80081c:	48 b8 39 17 80 00 00 	movabs $0x801739,%rax
+  800823:	00 00 00 
+  800826:	ff d0                	call   *%rax
+  800828:	89 c6                	mov    %eax,%esi
+  80082a:	45 89 e8             	mov    %r13d,%r8d
+  80082d:	4c 89 e1             	mov    %r12,%rcx
+  800830:	4c 89 f2             	mov    %r14,%rdx
+  800833:	48 bf b8 3e 80 00 00 	movabs $0x803eb8,%rdi
+  80083a:	00 00 00 
+  80083d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800842:	49 bc 24 09 80 00 00 	movabs $0x800924,%r12
+  800849:	00 00 00 
+  80084c:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  80084f:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  800853:	48 89 df             	mov    %rbx,%rdi
+  800856:	48 b8 c0 08 80 00 00 	movabs $0x8008c0,%rax
+  80085d:	00 00 00 
+  800860:	ff d0                	call   *%rax
+    cprintf("\n");
+  800862:	48 bf ef 3d 80 00 00 	movabs $0x803def,%rdi
+  800869:	00 00 00 
+  80086c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800871:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  800874:	cc                   	int3
+  800875:	eb fd                	jmp    800874 <_panic+0xa0>
+
+0000000000800877 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  800877:	55                   	push   %rbp
+  800878:	48 89 e5             	mov    %rsp,%rbp
+  80087b:	53                   	push   %rbx
+  80087c:	48 83 ec 08          	sub    $0x8,%rsp
+  800880:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  800883:	8b 06                	mov    (%rsi),%eax
+  800885:	8d 50 01             	lea    0x1(%rax),%edx
+  800888:	89 16                	mov    %edx,(%rsi)
+  80088a:	48 98                	cltq
+  80088c:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  800891:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  800897:	74 0a                	je     8008a3 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  800899:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  80089d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8008a1:	c9                   	leave
+  8008a2:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  8008a3:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  8008a7:	be ff 00 00 00       	mov    $0xff,%esi
+  8008ac:	48 b8 70 16 80 00 00 	movabs $0x801670,%rax
+  8008b3:	00 00 00 
+  8008b6:	ff d0                	call   *%rax
+        state->offset = 0;
+  8008b8:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  8008be:	eb d9                	jmp    800899 <putch+0x22>
+
+00000000008008c0 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  8008c0:	55                   	push   %rbp
+  8008c1:	48 89 e5             	mov    %rsp,%rbp
+  8008c4:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  8008cb:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  8008ce:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  8008d5:	b9 21 00 00 00       	mov    $0x21,%ecx
+  8008da:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008df:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  8008e2:	48 89 f1             	mov    %rsi,%rcx
+  8008e5:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  8008ec:	48 bf 77 08 80 00 00 	movabs $0x800877,%rdi
+  8008f3:	00 00 00 
+  8008f6:	48 b8 74 0a 80 00 00 	movabs $0x800a74,%rax
+  8008fd:	00 00 00 
+  800900:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  800902:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  800909:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  800910:	48 b8 70 16 80 00 00 	movabs $0x801670,%rax
+  800917:	00 00 00 
+  80091a:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  80091c:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  800922:	c9                   	leave
+  800923:	c3                   	ret
+
+0000000000800924 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  800924:	55                   	push   %rbp
+  800925:	48 89 e5             	mov    %rsp,%rbp
+  800928:	48 83 ec 50          	sub    $0x50,%rsp
+  80092c:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  800930:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  800934:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800938:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80093c:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  800940:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  800947:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80094b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80094f:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800953:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  800957:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  80095b:	48 b8 c0 08 80 00 00 	movabs $0x8008c0,%rax
+  800962:	00 00 00 
+  800965:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  800967:	c9                   	leave
+  800968:	c3                   	ret
+
+0000000000800969 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  800969:	55                   	push   %rbp
+  80096a:	48 89 e5             	mov    %rsp,%rbp
+  80096d:	41 57                	push   %r15
+  80096f:	41 56                	push   %r14
+  800971:	41 55                	push   %r13
+  800973:	41 54                	push   %r12
+  800975:	53                   	push   %rbx
+  800976:	48 83 ec 18          	sub    $0x18,%rsp
+  80097a:	49 89 fc             	mov    %rdi,%r12
+  80097d:	49 89 f5             	mov    %rsi,%r13
+  800980:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800984:	8b 45 10             	mov    0x10(%rbp),%eax
+  800987:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  80098a:	41 89 cf             	mov    %ecx,%r15d
+  80098d:	4c 39 fa             	cmp    %r15,%rdx
+  800990:	73 5b                	jae    8009ed <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  800992:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  800996:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  80099a:	85 db                	test   %ebx,%ebx
+  80099c:	7e 0e                	jle    8009ac <print_num+0x43>
+            putch(padc, put_arg);
+  80099e:	4c 89 ee             	mov    %r13,%rsi
+  8009a1:	44 89 f7             	mov    %r14d,%edi
+  8009a4:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  8009a7:	83 eb 01             	sub    $0x1,%ebx
+  8009aa:	75 f2                	jne    80099e <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  8009ac:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  8009b0:	48 b9 ec 3e 80 00 00 	movabs $0x803eec,%rcx
+  8009b7:	00 00 00 
+  8009ba:	48 b8 db 3e 80 00 00 	movabs $0x803edb,%rax
+  8009c1:	00 00 00 
+  8009c4:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  8009c8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8009cc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8009d1:	49 f7 f7             	div    %r15
+  8009d4:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  8009d8:	4c 89 ee             	mov    %r13,%rsi
+  8009db:	41 ff d4             	call   *%r12
+}
+  8009de:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8009e2:	5b                   	pop    %rbx
+  8009e3:	41 5c                	pop    %r12
+  8009e5:	41 5d                	pop    %r13
+  8009e7:	41 5e                	pop    %r14
+  8009e9:	41 5f                	pop    %r15
+  8009eb:	5d                   	pop    %rbp
+  8009ec:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  8009ed:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8009f1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8009f6:	49 f7 f7             	div    %r15
+  8009f9:	48 83 ec 08          	sub    $0x8,%rsp
+  8009fd:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  800a01:	52                   	push   %rdx
+  800a02:	45 0f be c9          	movsbl %r9b,%r9d
+  800a06:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  800a0a:	48 89 c2             	mov    %rax,%rdx
+  800a0d:	48 b8 69 09 80 00 00 	movabs $0x800969,%rax
+  800a14:	00 00 00 
+  800a17:	ff d0                	call   *%rax
+  800a19:	48 83 c4 10          	add    $0x10,%rsp
+  800a1d:	eb 8d                	jmp    8009ac <print_num+0x43>
+
+0000000000800a1f <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  800a1f:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  800a23:	48 8b 06             	mov    (%rsi),%rax
+  800a26:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  800a2a:	73 0a                	jae    800a36 <sprintputch+0x17>
+        *state->start++ = ch;
+  800a2c:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800a30:	48 89 16             	mov    %rdx,(%rsi)
+  800a33:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  800a36:	c3                   	ret
+
+0000000000800a37 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  800a37:	55                   	push   %rbp
+  800a38:	48 89 e5             	mov    %rsp,%rbp
+  800a3b:	48 83 ec 50          	sub    $0x50,%rsp
+  800a3f:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800a43:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800a47:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  800a4b:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800a52:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800a56:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a5a:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800a5e:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  800a62:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800a66:	48 b8 74 0a 80 00 00 	movabs $0x800a74,%rax
+  800a6d:	00 00 00 
+  800a70:	ff d0                	call   *%rax
+}
+  800a72:	c9                   	leave
+  800a73:	c3                   	ret
+
+0000000000800a74 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  800a74:	55                   	push   %rbp
+  800a75:	48 89 e5             	mov    %rsp,%rbp
+  800a78:	41 57                	push   %r15
+  800a7a:	41 56                	push   %r14
+  800a7c:	41 55                	push   %r13
+  800a7e:	41 54                	push   %r12
+  800a80:	53                   	push   %rbx
+  800a81:	48 83 ec 38          	sub    $0x38,%rsp
+  800a85:	49 89 fe             	mov    %rdi,%r14
+  800a88:	49 89 f5             	mov    %rsi,%r13
+  800a8b:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  800a8e:	48 8b 01             	mov    (%rcx),%rax
+  800a91:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  800a95:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800a99:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a9d:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  800aa1:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  800aa5:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  800aa9:	0f b6 3b             	movzbl (%rbx),%edi
+  800aac:	40 80 ff 25          	cmp    $0x25,%dil
+  800ab0:	74 18                	je     800aca <vprintfmt+0x56>
+            if (!ch) return;
+  800ab2:	40 84 ff             	test   %dil,%dil
+  800ab5:	0f 84 b1 06 00 00    	je     80116c <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  800abb:	40 0f b6 ff          	movzbl %dil,%edi
+  800abf:	4c 89 ee             	mov    %r13,%rsi
+  800ac2:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  800ac5:	4c 89 e3             	mov    %r12,%rbx
+  800ac8:	eb db                	jmp    800aa5 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  800aca:	be 00 00 00 00       	mov    $0x0,%esi
+  800acf:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  800ad3:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  800ad8:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800ade:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  800ae5:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800ae9:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  800aee:	41 0f b6 04 24       	movzbl (%r12),%eax
+  800af3:	88 45 a0             	mov    %al,-0x60(%rbp)
+  800af6:	83 e8 23             	sub    $0x23,%eax
+  800af9:	3c 57                	cmp    $0x57,%al
+  800afb:	0f 87 51 06 00 00    	ja     801152 <vprintfmt+0x6de>
+  800b01:	0f b6 c0             	movzbl %al,%eax
+  800b04:	48 b9 a0 40 80 00 00 	movabs $0x8040a0,%rcx
+  800b0b:	00 00 00 
+  800b0e:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  800b11:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  800b14:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  800b18:	eb cf                	jmp    800ae9 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  800b1a:	49 89 dc             	mov    %rbx,%r12
+  800b1d:	be 01 00 00 00       	mov    $0x1,%esi
+  800b22:	eb c5                	jmp    800ae9 <vprintfmt+0x75>
+            padc = ch;
+  800b24:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  800b28:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800b2b:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800b2e:	eb b9                	jmp    800ae9 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800b30:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b33:	83 f8 2f             	cmp    $0x2f,%eax
+  800b36:	77 24                	ja     800b5c <vprintfmt+0xe8>
+  800b38:	89 c1                	mov    %eax,%ecx
+  800b3a:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  800b3e:	83 c0 08             	add    $0x8,%eax
+  800b41:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b44:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  800b47:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  800b4a:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800b4e:	79 99                	jns    800ae9 <vprintfmt+0x75>
+                width = precision;
+  800b50:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  800b54:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800b5a:	eb 8d                	jmp    800ae9 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800b5c:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  800b60:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  800b64:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b68:	eb da                	jmp    800b44 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  800b6a:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  800b6f:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800b73:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  800b79:	3c 39                	cmp    $0x39,%al
+  800b7b:	77 1c                	ja     800b99 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  800b7d:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  800b81:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  800b85:	0f b6 c0             	movzbl %al,%eax
+  800b88:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800b8d:	0f b6 03             	movzbl (%rbx),%eax
+  800b90:	3c 39                	cmp    $0x39,%al
+  800b92:	76 e9                	jbe    800b7d <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  800b94:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  800b97:	eb b1                	jmp    800b4a <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  800b99:	49 89 dc             	mov    %rbx,%r12
+  800b9c:	eb ac                	jmp    800b4a <vprintfmt+0xd6>
+            width = MAX(0, width);
+  800b9e:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  800ba1:	85 c9                	test   %ecx,%ecx
+  800ba3:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ba8:	0f 49 c1             	cmovns %ecx,%eax
+  800bab:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  800bae:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800bb1:	e9 33 ff ff ff       	jmp    800ae9 <vprintfmt+0x75>
+            lflag++;
+  800bb6:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  800bb9:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800bbc:	e9 28 ff ff ff       	jmp    800ae9 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  800bc1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bc4:	83 f8 2f             	cmp    $0x2f,%eax
+  800bc7:	77 19                	ja     800be2 <vprintfmt+0x16e>
+  800bc9:	89 c2                	mov    %eax,%edx
+  800bcb:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800bcf:	83 c0 08             	add    $0x8,%eax
+  800bd2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800bd5:	8b 3a                	mov    (%rdx),%edi
+  800bd7:	4c 89 ee             	mov    %r13,%rsi
+  800bda:	41 ff d6             	call   *%r14
+            break;
+  800bdd:	e9 c3 fe ff ff       	jmp    800aa5 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  800be2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800be6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bea:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bee:	eb e5                	jmp    800bd5 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  800bf0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bf3:	83 f8 2f             	cmp    $0x2f,%eax
+  800bf6:	77 5a                	ja     800c52 <vprintfmt+0x1de>
+  800bf8:	89 c2                	mov    %eax,%edx
+  800bfa:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800bfe:	83 c0 08             	add    $0x8,%eax
+  800c01:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  800c04:	8b 02                	mov    (%rdx),%eax
+  800c06:	89 c1                	mov    %eax,%ecx
+  800c08:	f7 d9                	neg    %ecx
+  800c0a:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  800c0d:	83 f9 15             	cmp    $0x15,%ecx
+  800c10:	7f 4e                	jg     800c60 <vprintfmt+0x1ec>
+  800c12:	48 63 c1             	movslq %ecx,%rax
+  800c15:	48 ba 60 43 80 00 00 	movabs $0x804360,%rdx
+  800c1c:	00 00 00 
+  800c1f:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  800c23:	48 85 c0             	test   %rax,%rax
+  800c26:	74 38                	je     800c60 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  800c28:	48 89 c1             	mov    %rax,%rcx
+  800c2b:	48 ba cc 45 80 00 00 	movabs $0x8045cc,%rdx
+  800c32:	00 00 00 
+  800c35:	4c 89 ee             	mov    %r13,%rsi
+  800c38:	4c 89 f7             	mov    %r14,%rdi
+  800c3b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c40:	49 b8 37 0a 80 00 00 	movabs $0x800a37,%r8
+  800c47:	00 00 00 
+  800c4a:	41 ff d0             	call   *%r8
+  800c4d:	e9 53 fe ff ff       	jmp    800aa5 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  800c52:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c56:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c5a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c5e:	eb a4                	jmp    800c04 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  800c60:	48 ba 04 3f 80 00 00 	movabs $0x803f04,%rdx
+  800c67:	00 00 00 
+  800c6a:	4c 89 ee             	mov    %r13,%rsi
+  800c6d:	4c 89 f7             	mov    %r14,%rdi
+  800c70:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c75:	49 b8 37 0a 80 00 00 	movabs $0x800a37,%r8
+  800c7c:	00 00 00 
+  800c7f:	41 ff d0             	call   *%r8
+  800c82:	e9 1e fe ff ff       	jmp    800aa5 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800c87:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c8a:	83 f8 2f             	cmp    $0x2f,%eax
+  800c8d:	77 6c                	ja     800cfb <vprintfmt+0x287>
+  800c8f:	89 c2                	mov    %eax,%edx
+  800c91:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c95:	83 c0 08             	add    $0x8,%eax
+  800c98:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c9b:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  800c9e:	48 85 d2             	test   %rdx,%rdx
+  800ca1:	48 b8 fd 3e 80 00 00 	movabs $0x803efd,%rax
+  800ca8:	00 00 00 
+  800cab:	48 0f 45 c2          	cmovne %rdx,%rax
+  800caf:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  800cb3:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800cb7:	7e 06                	jle    800cbf <vprintfmt+0x24b>
+  800cb9:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  800cbd:	75 4a                	jne    800d09 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800cbf:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800cc3:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  800cc7:	0f b6 00             	movzbl (%rax),%eax
+  800cca:	84 c0                	test   %al,%al
+  800ccc:	0f 85 9a 00 00 00    	jne    800d6c <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  800cd2:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800cd5:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  800cd9:	85 c0                	test   %eax,%eax
+  800cdb:	0f 8e c4 fd ff ff    	jle    800aa5 <vprintfmt+0x31>
+  800ce1:	4c 89 ee             	mov    %r13,%rsi
+  800ce4:	bf 20 00 00 00       	mov    $0x20,%edi
+  800ce9:	41 ff d6             	call   *%r14
+  800cec:	41 83 ec 01          	sub    $0x1,%r12d
+  800cf0:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  800cf4:	75 eb                	jne    800ce1 <vprintfmt+0x26d>
+  800cf6:	e9 aa fd ff ff       	jmp    800aa5 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800cfb:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800cff:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d03:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d07:	eb 92                	jmp    800c9b <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  800d09:	49 63 f7             	movslq %r15d,%rsi
+  800d0c:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  800d10:	48 b8 26 12 80 00 00 	movabs $0x801226,%rax
+  800d17:	00 00 00 
+  800d1a:	ff d0                	call   *%rax
+  800d1c:	48 89 c2             	mov    %rax,%rdx
+  800d1f:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800d22:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  800d24:	8d 70 ff             	lea    -0x1(%rax),%esi
+  800d27:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  800d2a:	85 c0                	test   %eax,%eax
+  800d2c:	7e 91                	jle    800cbf <vprintfmt+0x24b>
+  800d2e:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  800d33:	4c 89 ee             	mov    %r13,%rsi
+  800d36:	44 89 e7             	mov    %r12d,%edi
+  800d39:	41 ff d6             	call   *%r14
+  800d3c:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800d40:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800d43:	83 f8 ff             	cmp    $0xffffffff,%eax
+  800d46:	75 eb                	jne    800d33 <vprintfmt+0x2bf>
+  800d48:	e9 72 ff ff ff       	jmp    800cbf <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800d4d:	0f b6 f8             	movzbl %al,%edi
+  800d50:	4c 89 ee             	mov    %r13,%rsi
+  800d53:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800d56:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800d5a:	49 83 c4 01          	add    $0x1,%r12
+  800d5e:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  800d64:	84 c0                	test   %al,%al
+  800d66:	0f 84 66 ff ff ff    	je     800cd2 <vprintfmt+0x25e>
+  800d6c:	45 85 ff             	test   %r15d,%r15d
+  800d6f:	78 0a                	js     800d7b <vprintfmt+0x307>
+  800d71:	41 83 ef 01          	sub    $0x1,%r15d
+  800d75:	0f 88 57 ff ff ff    	js     800cd2 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800d7b:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  800d7f:	74 cc                	je     800d4d <vprintfmt+0x2d9>
+  800d81:	8d 50 e0             	lea    -0x20(%rax),%edx
+  800d84:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800d89:	80 fa 5e             	cmp    $0x5e,%dl
+  800d8c:	77 c2                	ja     800d50 <vprintfmt+0x2dc>
+  800d8e:	eb bd                	jmp    800d4d <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  800d90:	40 84 f6             	test   %sil,%sil
+  800d93:	75 26                	jne    800dbb <vprintfmt+0x347>
+    switch (lflag) {
+  800d95:	85 d2                	test   %edx,%edx
+  800d97:	74 59                	je     800df2 <vprintfmt+0x37e>
+  800d99:	83 fa 01             	cmp    $0x1,%edx
+  800d9c:	74 7b                	je     800e19 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  800d9e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800da1:	83 f8 2f             	cmp    $0x2f,%eax
+  800da4:	0f 87 96 00 00 00    	ja     800e40 <vprintfmt+0x3cc>
+  800daa:	89 c2                	mov    %eax,%edx
+  800dac:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800db0:	83 c0 08             	add    $0x8,%eax
+  800db3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800db6:	4c 8b 22             	mov    (%rdx),%r12
+  800db9:	eb 17                	jmp    800dd2 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  800dbb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800dbe:	83 f8 2f             	cmp    $0x2f,%eax
+  800dc1:	77 21                	ja     800de4 <vprintfmt+0x370>
+  800dc3:	89 c2                	mov    %eax,%edx
+  800dc5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800dc9:	83 c0 08             	add    $0x8,%eax
+  800dcc:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800dcf:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  800dd2:	4d 85 e4             	test   %r12,%r12
+  800dd5:	78 7a                	js     800e51 <vprintfmt+0x3dd>
+            num = i;
+  800dd7:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  800dda:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  800ddf:	e9 50 02 00 00       	jmp    801034 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800de4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800de8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800dec:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800df0:	eb dd                	jmp    800dcf <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  800df2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800df5:	83 f8 2f             	cmp    $0x2f,%eax
+  800df8:	77 11                	ja     800e0b <vprintfmt+0x397>
+  800dfa:	89 c2                	mov    %eax,%edx
+  800dfc:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800e00:	83 c0 08             	add    $0x8,%eax
+  800e03:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800e06:	4c 63 22             	movslq (%rdx),%r12
+  800e09:	eb c7                	jmp    800dd2 <vprintfmt+0x35e>
+  800e0b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800e0f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800e13:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e17:	eb ed                	jmp    800e06 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  800e19:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800e1c:	83 f8 2f             	cmp    $0x2f,%eax
+  800e1f:	77 11                	ja     800e32 <vprintfmt+0x3be>
+  800e21:	89 c2                	mov    %eax,%edx
+  800e23:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800e27:	83 c0 08             	add    $0x8,%eax
+  800e2a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800e2d:	4c 8b 22             	mov    (%rdx),%r12
+  800e30:	eb a0                	jmp    800dd2 <vprintfmt+0x35e>
+  800e32:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800e36:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800e3a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e3e:	eb ed                	jmp    800e2d <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  800e40:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800e44:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800e48:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e4c:	e9 65 ff ff ff       	jmp    800db6 <vprintfmt+0x342>
+                putch('-', put_arg);
+  800e51:	4c 89 ee             	mov    %r13,%rsi
+  800e54:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800e59:	41 ff d6             	call   *%r14
+                i = -i;
+  800e5c:	49 f7 dc             	neg    %r12
+  800e5f:	e9 73 ff ff ff       	jmp    800dd7 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  800e64:	40 84 f6             	test   %sil,%sil
+  800e67:	75 32                	jne    800e9b <vprintfmt+0x427>
+    switch (lflag) {
+  800e69:	85 d2                	test   %edx,%edx
+  800e6b:	74 5d                	je     800eca <vprintfmt+0x456>
+  800e6d:	83 fa 01             	cmp    $0x1,%edx
+  800e70:	0f 84 82 00 00 00    	je     800ef8 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  800e76:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800e79:	83 f8 2f             	cmp    $0x2f,%eax
+  800e7c:	0f 87 a5 00 00 00    	ja     800f27 <vprintfmt+0x4b3>
+  800e82:	89 c2                	mov    %eax,%edx
+  800e84:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800e88:	83 c0 08             	add    $0x8,%eax
+  800e8b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800e8e:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800e91:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  800e96:	e9 99 01 00 00       	jmp    801034 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800e9b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800e9e:	83 f8 2f             	cmp    $0x2f,%eax
+  800ea1:	77 19                	ja     800ebc <vprintfmt+0x448>
+  800ea3:	89 c2                	mov    %eax,%edx
+  800ea5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ea9:	83 c0 08             	add    $0x8,%eax
+  800eac:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800eaf:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800eb2:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800eb7:	e9 78 01 00 00       	jmp    801034 <vprintfmt+0x5c0>
+  800ebc:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ec0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ec4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ec8:	eb e5                	jmp    800eaf <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  800eca:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ecd:	83 f8 2f             	cmp    $0x2f,%eax
+  800ed0:	77 18                	ja     800eea <vprintfmt+0x476>
+  800ed2:	89 c2                	mov    %eax,%edx
+  800ed4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ed8:	83 c0 08             	add    $0x8,%eax
+  800edb:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ede:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800ee0:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  800ee5:	e9 4a 01 00 00       	jmp    801034 <vprintfmt+0x5c0>
+  800eea:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800eee:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ef2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ef6:	eb e6                	jmp    800ede <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  800ef8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800efb:	83 f8 2f             	cmp    $0x2f,%eax
+  800efe:	77 19                	ja     800f19 <vprintfmt+0x4a5>
+  800f00:	89 c2                	mov    %eax,%edx
+  800f02:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800f06:	83 c0 08             	add    $0x8,%eax
+  800f09:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800f0c:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800f0f:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  800f14:	e9 1b 01 00 00       	jmp    801034 <vprintfmt+0x5c0>
+  800f19:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800f1d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800f21:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800f25:	eb e5                	jmp    800f0c <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  800f27:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800f2b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800f2f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800f33:	e9 56 ff ff ff       	jmp    800e8e <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  800f38:	40 84 f6             	test   %sil,%sil
+  800f3b:	75 2e                	jne    800f6b <vprintfmt+0x4f7>
+    switch (lflag) {
+  800f3d:	85 d2                	test   %edx,%edx
+  800f3f:	74 59                	je     800f9a <vprintfmt+0x526>
+  800f41:	83 fa 01             	cmp    $0x1,%edx
+  800f44:	74 7f                	je     800fc5 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  800f46:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800f49:	83 f8 2f             	cmp    $0x2f,%eax
+  800f4c:	0f 87 9f 00 00 00    	ja     800ff1 <vprintfmt+0x57d>
+  800f52:	89 c2                	mov    %eax,%edx
+  800f54:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800f58:	83 c0 08             	add    $0x8,%eax
+  800f5b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800f5e:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800f61:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  800f66:	e9 c9 00 00 00       	jmp    801034 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800f6b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800f6e:	83 f8 2f             	cmp    $0x2f,%eax
+  800f71:	77 19                	ja     800f8c <vprintfmt+0x518>
+  800f73:	89 c2                	mov    %eax,%edx
+  800f75:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800f79:	83 c0 08             	add    $0x8,%eax
+  800f7c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800f7f:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800f82:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800f87:	e9 a8 00 00 00       	jmp    801034 <vprintfmt+0x5c0>
+  800f8c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800f90:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800f94:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800f98:	eb e5                	jmp    800f7f <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  800f9a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800f9d:	83 f8 2f             	cmp    $0x2f,%eax
+  800fa0:	77 15                	ja     800fb7 <vprintfmt+0x543>
+  800fa2:	89 c2                	mov    %eax,%edx
+  800fa4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800fa8:	83 c0 08             	add    $0x8,%eax
+  800fab:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800fae:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  800fb0:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  800fb5:	eb 7d                	jmp    801034 <vprintfmt+0x5c0>
+  800fb7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800fbb:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800fbf:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800fc3:	eb e9                	jmp    800fae <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  800fc5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800fc8:	83 f8 2f             	cmp    $0x2f,%eax
+  800fcb:	77 16                	ja     800fe3 <vprintfmt+0x56f>
+  800fcd:	89 c2                	mov    %eax,%edx
+  800fcf:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800fd3:	83 c0 08             	add    $0x8,%eax
+  800fd6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800fd9:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800fdc:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  800fe1:	eb 51                	jmp    801034 <vprintfmt+0x5c0>
+  800fe3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800fe7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800feb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800fef:	eb e8                	jmp    800fd9 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  800ff1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ff5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ff9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ffd:	e9 5c ff ff ff       	jmp    800f5e <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  801002:	4c 89 ee             	mov    %r13,%rsi
+  801005:	bf 30 00 00 00       	mov    $0x30,%edi
+  80100a:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  80100d:	4c 89 ee             	mov    %r13,%rsi
+  801010:	bf 78 00 00 00       	mov    $0x78,%edi
+  801015:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  801018:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80101b:	83 f8 2f             	cmp    $0x2f,%eax
+  80101e:	77 47                	ja     801067 <vprintfmt+0x5f3>
+  801020:	89 c2                	mov    %eax,%edx
+  801022:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801026:	83 c0 08             	add    $0x8,%eax
+  801029:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80102c:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  80102f:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  801034:	48 83 ec 08          	sub    $0x8,%rsp
+  801038:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  80103c:	0f 94 c0             	sete   %al
+  80103f:	0f b6 c0             	movzbl %al,%eax
+  801042:	50                   	push   %rax
+  801043:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  801048:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  80104c:	4c 89 ee             	mov    %r13,%rsi
+  80104f:	4c 89 f7             	mov    %r14,%rdi
+  801052:	48 b8 69 09 80 00 00 	movabs $0x800969,%rax
+  801059:	00 00 00 
+  80105c:	ff d0                	call   *%rax
+            break;
+  80105e:	48 83 c4 10          	add    $0x10,%rsp
+  801062:	e9 3e fa ff ff       	jmp    800aa5 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  801067:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80106b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80106f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801073:	eb b7                	jmp    80102c <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  801075:	40 84 f6             	test   %sil,%sil
+  801078:	75 2b                	jne    8010a5 <vprintfmt+0x631>
+    switch (lflag) {
+  80107a:	85 d2                	test   %edx,%edx
+  80107c:	74 56                	je     8010d4 <vprintfmt+0x660>
+  80107e:	83 fa 01             	cmp    $0x1,%edx
+  801081:	74 7f                	je     801102 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  801083:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801086:	83 f8 2f             	cmp    $0x2f,%eax
+  801089:	0f 87 a2 00 00 00    	ja     801131 <vprintfmt+0x6bd>
+  80108f:	89 c2                	mov    %eax,%edx
+  801091:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801095:	83 c0 08             	add    $0x8,%eax
+  801098:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80109b:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  80109e:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  8010a3:	eb 8f                	jmp    801034 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8010a5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8010a8:	83 f8 2f             	cmp    $0x2f,%eax
+  8010ab:	77 19                	ja     8010c6 <vprintfmt+0x652>
+  8010ad:	89 c2                	mov    %eax,%edx
+  8010af:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8010b3:	83 c0 08             	add    $0x8,%eax
+  8010b6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8010b9:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8010bc:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8010c1:	e9 6e ff ff ff       	jmp    801034 <vprintfmt+0x5c0>
+  8010c6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8010ca:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8010ce:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8010d2:	eb e5                	jmp    8010b9 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  8010d4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8010d7:	83 f8 2f             	cmp    $0x2f,%eax
+  8010da:	77 18                	ja     8010f4 <vprintfmt+0x680>
+  8010dc:	89 c2                	mov    %eax,%edx
+  8010de:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8010e2:	83 c0 08             	add    $0x8,%eax
+  8010e5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8010e8:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  8010ea:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  8010ef:	e9 40 ff ff ff       	jmp    801034 <vprintfmt+0x5c0>
+  8010f4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8010f8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8010fc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801100:	eb e6                	jmp    8010e8 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  801102:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801105:	83 f8 2f             	cmp    $0x2f,%eax
+  801108:	77 19                	ja     801123 <vprintfmt+0x6af>
+  80110a:	89 c2                	mov    %eax,%edx
+  80110c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801110:	83 c0 08             	add    $0x8,%eax
+  801113:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801116:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  801119:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  80111e:	e9 11 ff ff ff       	jmp    801034 <vprintfmt+0x5c0>
+  801123:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801127:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80112b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80112f:	eb e5                	jmp    801116 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  801131:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801135:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801139:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80113d:	e9 59 ff ff ff       	jmp    80109b <vprintfmt+0x627>
+            putch(ch, put_arg);
+  801142:	4c 89 ee             	mov    %r13,%rsi
+  801145:	bf 25 00 00 00       	mov    $0x25,%edi
+  80114a:	41 ff d6             	call   *%r14
+            break;
+  80114d:	e9 53 f9 ff ff       	jmp    800aa5 <vprintfmt+0x31>
+            putch('%', put_arg);
+  801152:	4c 89 ee             	mov    %r13,%rsi
+  801155:	bf 25 00 00 00       	mov    $0x25,%edi
+  80115a:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  80115d:	48 83 eb 01          	sub    $0x1,%rbx
+  801161:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  801165:	75 f6                	jne    80115d <vprintfmt+0x6e9>
+  801167:	e9 39 f9 ff ff       	jmp    800aa5 <vprintfmt+0x31>
+}
+  80116c:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  801170:	5b                   	pop    %rbx
+  801171:	41 5c                	pop    %r12
+  801173:	41 5d                	pop    %r13
+  801175:	41 5e                	pop    %r14
+  801177:	41 5f                	pop    %r15
+  801179:	5d                   	pop    %rbp
+  80117a:	c3                   	ret
+
+000000000080117b <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  80117b:	55                   	push   %rbp
+  80117c:	48 89 e5             	mov    %rsp,%rbp
+  80117f:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  801183:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801187:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  80118c:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  801190:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  801197:	48 85 ff             	test   %rdi,%rdi
+  80119a:	74 2b                	je     8011c7 <vsnprintf+0x4c>
+  80119c:	48 85 f6             	test   %rsi,%rsi
+  80119f:	74 26                	je     8011c7 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  8011a1:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8011a5:	48 bf 1f 0a 80 00 00 	movabs $0x800a1f,%rdi
+  8011ac:	00 00 00 
+  8011af:	48 b8 74 0a 80 00 00 	movabs $0x800a74,%rax
+  8011b6:	00 00 00 
+  8011b9:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  8011bb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8011bf:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  8011c2:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  8011c5:	c9                   	leave
+  8011c6:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  8011c7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8011cc:	eb f7                	jmp    8011c5 <vsnprintf+0x4a>
+
+00000000008011ce <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  8011ce:	55                   	push   %rbp
+  8011cf:	48 89 e5             	mov    %rsp,%rbp
+  8011d2:	48 83 ec 50          	sub    $0x50,%rsp
+  8011d6:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8011da:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8011de:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  8011e2:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8011e9:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8011ed:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8011f1:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8011f5:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  8011f9:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8011fd:	48 b8 7b 11 80 00 00 	movabs $0x80117b,%rax
+  801204:	00 00 00 
+  801207:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  801209:	c9                   	leave
+  80120a:	c3                   	ret
+
+000000000080120b <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  80120b:	80 3f 00             	cmpb   $0x0,(%rdi)
+  80120e:	74 10                	je     801220 <strlen+0x15>
+    size_t n = 0;
+  801210:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  801215:	48 83 c0 01          	add    $0x1,%rax
+  801219:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  80121d:	75 f6                	jne    801215 <strlen+0xa>
+  80121f:	c3                   	ret
+    size_t n = 0;
+  801220:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  801225:	c3                   	ret
+
+0000000000801226 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  801226:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  801229:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  80122e:	48 85 f6             	test   %rsi,%rsi
+  801231:	74 11                	je     801244 <strnlen+0x1e>
+  801233:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  801237:	74 0c                	je     801245 <strnlen+0x1f>
+  801239:	48 83 c2 01          	add    $0x1,%rdx
+  80123d:	48 39 d0             	cmp    %rdx,%rax
+  801240:	75 f1                	jne    801233 <strnlen+0xd>
+  801242:	eb 04                	jmp    801248 <strnlen+0x22>
+  801244:	c3                   	ret
+  801245:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  801248:	c3                   	ret
+
+0000000000801249 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  801249:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  80124c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801251:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  801255:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  801258:	48 83 c2 01          	add    $0x1,%rdx
+  80125c:	84 c9                	test   %cl,%cl
+  80125e:	75 f1                	jne    801251 <strcpy+0x8>
+        ;
+    return res;
+}
+  801260:	c3                   	ret
+
+0000000000801261 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  801261:	55                   	push   %rbp
+  801262:	48 89 e5             	mov    %rsp,%rbp
+  801265:	41 54                	push   %r12
+  801267:	53                   	push   %rbx
+  801268:	48 89 fb             	mov    %rdi,%rbx
+  80126b:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  80126e:	48 b8 0b 12 80 00 00 	movabs $0x80120b,%rax
+  801275:	00 00 00 
+  801278:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  80127a:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  80127e:	4c 89 e6             	mov    %r12,%rsi
+  801281:	48 b8 49 12 80 00 00 	movabs $0x801249,%rax
+  801288:	00 00 00 
+  80128b:	ff d0                	call   *%rax
+    return dst;
+}
+  80128d:	48 89 d8             	mov    %rbx,%rax
+  801290:	5b                   	pop    %rbx
+  801291:	41 5c                	pop    %r12
+  801293:	5d                   	pop    %rbp
+  801294:	c3                   	ret
+
+0000000000801295 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  801295:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  801298:	48 85 d2             	test   %rdx,%rdx
+  80129b:	74 1f                	je     8012bc <strncpy+0x27>
+  80129d:	48 01 fa             	add    %rdi,%rdx
+  8012a0:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  8012a3:	48 83 c1 01          	add    $0x1,%rcx
+  8012a7:	44 0f b6 06          	movzbl (%rsi),%r8d
+  8012ab:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  8012af:	41 80 f8 01          	cmp    $0x1,%r8b
+  8012b3:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  8012b7:	48 39 ca             	cmp    %rcx,%rdx
+  8012ba:	75 e7                	jne    8012a3 <strncpy+0xe>
+    }
+    return ret;
+}
+  8012bc:	c3                   	ret
+
+00000000008012bd <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  8012bd:	48 89 f8             	mov    %rdi,%rax
+  8012c0:	48 85 d2             	test   %rdx,%rdx
+  8012c3:	74 24                	je     8012e9 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  8012c5:	48 83 ea 01          	sub    $0x1,%rdx
+  8012c9:	74 1b                	je     8012e6 <strlcpy+0x29>
+  8012cb:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  8012cf:	0f b6 16             	movzbl (%rsi),%edx
+  8012d2:	84 d2                	test   %dl,%dl
+  8012d4:	74 10                	je     8012e6 <strlcpy+0x29>
+            *dst++ = *src++;
+  8012d6:	48 83 c6 01          	add    $0x1,%rsi
+  8012da:	48 83 c0 01          	add    $0x1,%rax
+  8012de:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  8012e1:	48 39 c8             	cmp    %rcx,%rax
+  8012e4:	75 e9                	jne    8012cf <strlcpy+0x12>
+        *dst = '\0';
+  8012e6:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  8012e9:	48 29 f8             	sub    %rdi,%rax
+}
+  8012ec:	c3                   	ret
+
+00000000008012ed <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  8012ed:	0f b6 07             	movzbl (%rdi),%eax
+  8012f0:	84 c0                	test   %al,%al
+  8012f2:	74 13                	je     801307 <strcmp+0x1a>
+  8012f4:	38 06                	cmp    %al,(%rsi)
+  8012f6:	75 0f                	jne    801307 <strcmp+0x1a>
+  8012f8:	48 83 c7 01          	add    $0x1,%rdi
+  8012fc:	48 83 c6 01          	add    $0x1,%rsi
+  801300:	0f b6 07             	movzbl (%rdi),%eax
+  801303:	84 c0                	test   %al,%al
+  801305:	75 ed                	jne    8012f4 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  801307:	0f b6 c0             	movzbl %al,%eax
+  80130a:	0f b6 16             	movzbl (%rsi),%edx
+  80130d:	29 d0                	sub    %edx,%eax
+}
+  80130f:	c3                   	ret
+
+0000000000801310 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  801310:	48 85 d2             	test   %rdx,%rdx
+  801313:	74 1f                	je     801334 <strncmp+0x24>
+  801315:	0f b6 07             	movzbl (%rdi),%eax
+  801318:	84 c0                	test   %al,%al
+  80131a:	74 1e                	je     80133a <strncmp+0x2a>
+  80131c:	3a 06                	cmp    (%rsi),%al
+  80131e:	75 1a                	jne    80133a <strncmp+0x2a>
+  801320:	48 83 c7 01          	add    $0x1,%rdi
+  801324:	48 83 c6 01          	add    $0x1,%rsi
+  801328:	48 83 ea 01          	sub    $0x1,%rdx
+  80132c:	75 e7                	jne    801315 <strncmp+0x5>
+
+    if (!n) return 0;
+  80132e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801333:	c3                   	ret
+  801334:	b8 00 00 00 00       	mov    $0x0,%eax
+  801339:	c3                   	ret
+  80133a:	48 85 d2             	test   %rdx,%rdx
+  80133d:	74 09                	je     801348 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  80133f:	0f b6 07             	movzbl (%rdi),%eax
+  801342:	0f b6 16             	movzbl (%rsi),%edx
+  801345:	29 d0                	sub    %edx,%eax
+  801347:	c3                   	ret
+    if (!n) return 0;
+  801348:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80134d:	c3                   	ret
+
+000000000080134e <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  80134e:	0f b6 17             	movzbl (%rdi),%edx
+  801351:	84 d2                	test   %dl,%dl
+  801353:	74 18                	je     80136d <strchr+0x1f>
+        if (*str == c) {
+  801355:	0f be d2             	movsbl %dl,%edx
+  801358:	39 f2                	cmp    %esi,%edx
+  80135a:	74 17                	je     801373 <strchr+0x25>
+    for (; *str; str++) {
+  80135c:	48 83 c7 01          	add    $0x1,%rdi
+  801360:	0f b6 17             	movzbl (%rdi),%edx
+  801363:	84 d2                	test   %dl,%dl
+  801365:	75 ee                	jne    801355 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  801367:	b8 00 00 00 00       	mov    $0x0,%eax
+  80136c:	c3                   	ret
+  80136d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801372:	c3                   	ret
+  801373:	48 89 f8             	mov    %rdi,%rax
+}
+  801376:	c3                   	ret
+
+0000000000801377 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  801377:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  80137a:	0f b6 17             	movzbl (%rdi),%edx
+  80137d:	84 d2                	test   %dl,%dl
+  80137f:	74 13                	je     801394 <strfind+0x1d>
+  801381:	0f be d2             	movsbl %dl,%edx
+  801384:	39 f2                	cmp    %esi,%edx
+  801386:	74 0b                	je     801393 <strfind+0x1c>
+  801388:	48 83 c0 01          	add    $0x1,%rax
+  80138c:	0f b6 10             	movzbl (%rax),%edx
+  80138f:	84 d2                	test   %dl,%dl
+  801391:	75 ee                	jne    801381 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  801393:	c3                   	ret
+  801394:	c3                   	ret
+
+0000000000801395 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  801395:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  801398:	48 89 f8             	mov    %rdi,%rax
+  80139b:	48 f7 d8             	neg    %rax
+  80139e:	83 e0 07             	and    $0x7,%eax
+  8013a1:	49 89 d1             	mov    %rdx,%r9
+  8013a4:	49 29 c1             	sub    %rax,%r9
+  8013a7:	78 36                	js     8013df <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  8013a9:	40 0f b6 c6          	movzbl %sil,%eax
+  8013ad:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  8013b4:	01 01 01 
+  8013b7:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  8013bb:	40 f6 c7 07          	test   $0x7,%dil
+  8013bf:	75 38                	jne    8013f9 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  8013c1:	4c 89 c9             	mov    %r9,%rcx
+  8013c4:	48 c1 f9 03          	sar    $0x3,%rcx
+  8013c8:	74 0c                	je     8013d6 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  8013ca:	fc                   	cld
+  8013cb:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  8013ce:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  8013d2:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  8013d6:	4d 85 c9             	test   %r9,%r9
+  8013d9:	75 45                	jne    801420 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  8013db:	4c 89 c0             	mov    %r8,%rax
+  8013de:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  8013df:	48 85 d2             	test   %rdx,%rdx
+  8013e2:	74 f7                	je     8013db <memset+0x46>
+  8013e4:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  8013e7:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  8013ea:	48 83 c0 01          	add    $0x1,%rax
+  8013ee:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  8013f2:	48 39 c2             	cmp    %rax,%rdx
+  8013f5:	75 f3                	jne    8013ea <memset+0x55>
+  8013f7:	eb e2                	jmp    8013db <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  8013f9:	40 f6 c7 01          	test   $0x1,%dil
+  8013fd:	74 06                	je     801405 <memset+0x70>
+  8013ff:	88 07                	mov    %al,(%rdi)
+  801401:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  801405:	40 f6 c7 02          	test   $0x2,%dil
+  801409:	74 07                	je     801412 <memset+0x7d>
+  80140b:	66 89 07             	mov    %ax,(%rdi)
+  80140e:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  801412:	40 f6 c7 04          	test   $0x4,%dil
+  801416:	74 a9                	je     8013c1 <memset+0x2c>
+  801418:	89 07                	mov    %eax,(%rdi)
+  80141a:	48 83 c7 04          	add    $0x4,%rdi
+  80141e:	eb a1                	jmp    8013c1 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  801420:	41 f6 c1 04          	test   $0x4,%r9b
+  801424:	74 06                	je     80142c <memset+0x97>
+  801426:	89 07                	mov    %eax,(%rdi)
+  801428:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  80142c:	41 f6 c1 02          	test   $0x2,%r9b
+  801430:	74 07                	je     801439 <memset+0xa4>
+  801432:	66 89 07             	mov    %ax,(%rdi)
+  801435:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  801439:	41 f6 c1 01          	test   $0x1,%r9b
+  80143d:	74 9c                	je     8013db <memset+0x46>
+  80143f:	88 07                	mov    %al,(%rdi)
+  801441:	eb 98                	jmp    8013db <memset+0x46>
+
+0000000000801443 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  801443:	48 89 f8             	mov    %rdi,%rax
+  801446:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  801449:	48 39 fe             	cmp    %rdi,%rsi
+  80144c:	73 3b                	jae    801489 <memmove+0x46>
+  80144e:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  801452:	48 39 d7             	cmp    %rdx,%rdi
+  801455:	73 32                	jae    801489 <memmove+0x46>
+        s += n;
+        d += n;
+  801457:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  80145b:	48 89 d6             	mov    %rdx,%rsi
+  80145e:	48 09 fe             	or     %rdi,%rsi
+  801461:	48 09 ce             	or     %rcx,%rsi
+  801464:	40 f6 c6 07          	test   $0x7,%sil
+  801468:	75 12                	jne    80147c <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  80146a:	48 83 ef 08          	sub    $0x8,%rdi
+  80146e:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  801472:	48 c1 e9 03          	shr    $0x3,%rcx
+  801476:	fd                   	std
+  801477:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  80147a:	fc                   	cld
+  80147b:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  80147c:	48 83 ef 01          	sub    $0x1,%rdi
+  801480:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  801484:	fd                   	std
+  801485:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  801487:	eb f1                	jmp    80147a <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  801489:	48 89 f2             	mov    %rsi,%rdx
+  80148c:	48 09 c2             	or     %rax,%rdx
+  80148f:	48 09 ca             	or     %rcx,%rdx
+  801492:	f6 c2 07             	test   $0x7,%dl
+  801495:	75 0c                	jne    8014a3 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  801497:	48 c1 e9 03          	shr    $0x3,%rcx
+  80149b:	48 89 c7             	mov    %rax,%rdi
+  80149e:	fc                   	cld
+  80149f:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  8014a2:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  8014a3:	48 89 c7             	mov    %rax,%rdi
+  8014a6:	fc                   	cld
+  8014a7:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  8014a9:	c3                   	ret
+
+00000000008014aa <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  8014aa:	55                   	push   %rbp
+  8014ab:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  8014ae:	48 b8 43 14 80 00 00 	movabs $0x801443,%rax
+  8014b5:	00 00 00 
+  8014b8:	ff d0                	call   *%rax
+}
+  8014ba:	5d                   	pop    %rbp
+  8014bb:	c3                   	ret
+
+00000000008014bc <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  8014bc:	55                   	push   %rbp
+  8014bd:	48 89 e5             	mov    %rsp,%rbp
+  8014c0:	41 57                	push   %r15
+  8014c2:	41 56                	push   %r14
+  8014c4:	41 55                	push   %r13
+  8014c6:	41 54                	push   %r12
+  8014c8:	53                   	push   %rbx
+  8014c9:	48 83 ec 08          	sub    $0x8,%rsp
+  8014cd:	49 89 fe             	mov    %rdi,%r14
+  8014d0:	49 89 f7             	mov    %rsi,%r15
+  8014d3:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  8014d6:	48 89 f7             	mov    %rsi,%rdi
+  8014d9:	48 b8 0b 12 80 00 00 	movabs $0x80120b,%rax
+  8014e0:	00 00 00 
+  8014e3:	ff d0                	call   *%rax
+  8014e5:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  8014e8:	48 89 de             	mov    %rbx,%rsi
+  8014eb:	4c 89 f7             	mov    %r14,%rdi
+  8014ee:	48 b8 26 12 80 00 00 	movabs $0x801226,%rax
+  8014f5:	00 00 00 
+  8014f8:	ff d0                	call   *%rax
+  8014fa:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  8014fd:	48 39 c3             	cmp    %rax,%rbx
+  801500:	74 36                	je     801538 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  801502:	48 89 d8             	mov    %rbx,%rax
+  801505:	4c 29 e8             	sub    %r13,%rax
+  801508:	49 39 c4             	cmp    %rax,%r12
+  80150b:	73 31                	jae    80153e <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  80150d:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  801512:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  801516:	4c 89 fe             	mov    %r15,%rsi
+  801519:	48 b8 aa 14 80 00 00 	movabs $0x8014aa,%rax
+  801520:	00 00 00 
+  801523:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  801525:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  801529:	48 83 c4 08          	add    $0x8,%rsp
+  80152d:	5b                   	pop    %rbx
+  80152e:	41 5c                	pop    %r12
+  801530:	41 5d                	pop    %r13
+  801532:	41 5e                	pop    %r14
+  801534:	41 5f                	pop    %r15
+  801536:	5d                   	pop    %rbp
+  801537:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  801538:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  80153c:	eb eb                	jmp    801529 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  80153e:	48 83 eb 01          	sub    $0x1,%rbx
+  801542:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  801546:	48 89 da             	mov    %rbx,%rdx
+  801549:	4c 89 fe             	mov    %r15,%rsi
+  80154c:	48 b8 aa 14 80 00 00 	movabs $0x8014aa,%rax
+  801553:	00 00 00 
+  801556:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  801558:	49 01 de             	add    %rbx,%r14
+  80155b:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  801560:	eb c3                	jmp    801525 <strlcat+0x69>
+
+0000000000801562 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  801562:	48 85 d2             	test   %rdx,%rdx
+  801565:	74 2d                	je     801594 <memcmp+0x32>
+  801567:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  80156c:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  801570:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  801575:	44 38 c1             	cmp    %r8b,%cl
+  801578:	75 0f                	jne    801589 <memcmp+0x27>
+    while (n-- > 0) {
+  80157a:	48 83 c0 01          	add    $0x1,%rax
+  80157e:	48 39 c2             	cmp    %rax,%rdx
+  801581:	75 e9                	jne    80156c <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  801583:	b8 00 00 00 00       	mov    $0x0,%eax
+  801588:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  801589:	0f b6 c1             	movzbl %cl,%eax
+  80158c:	45 0f b6 c0          	movzbl %r8b,%r8d
+  801590:	44 29 c0             	sub    %r8d,%eax
+  801593:	c3                   	ret
+    return 0;
+  801594:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801599:	c3                   	ret
+
+000000000080159a <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  80159a:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  80159e:	48 39 c7             	cmp    %rax,%rdi
+  8015a1:	73 0f                	jae    8015b2 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  8015a3:	40 38 37             	cmp    %sil,(%rdi)
+  8015a6:	74 0e                	je     8015b6 <memfind+0x1c>
+    for (; src < end; src++) {
+  8015a8:	48 83 c7 01          	add    $0x1,%rdi
+  8015ac:	48 39 f8             	cmp    %rdi,%rax
+  8015af:	75 f2                	jne    8015a3 <memfind+0x9>
+  8015b1:	c3                   	ret
+  8015b2:	48 89 f8             	mov    %rdi,%rax
+  8015b5:	c3                   	ret
+  8015b6:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  8015b9:	c3                   	ret
+
+00000000008015ba <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  8015ba:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  8015bd:	0f b6 37             	movzbl (%rdi),%esi
+  8015c0:	40 80 fe 20          	cmp    $0x20,%sil
+  8015c4:	74 06                	je     8015cc <strtol+0x12>
+  8015c6:	40 80 fe 09          	cmp    $0x9,%sil
+  8015ca:	75 13                	jne    8015df <strtol+0x25>
+  8015cc:	48 83 c7 01          	add    $0x1,%rdi
+  8015d0:	0f b6 37             	movzbl (%rdi),%esi
+  8015d3:	40 80 fe 20          	cmp    $0x20,%sil
+  8015d7:	74 f3                	je     8015cc <strtol+0x12>
+  8015d9:	40 80 fe 09          	cmp    $0x9,%sil
+  8015dd:	74 ed                	je     8015cc <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  8015df:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  8015e2:	83 e0 fd             	and    $0xfffffffd,%eax
+  8015e5:	3c 01                	cmp    $0x1,%al
+  8015e7:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8015eb:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  8015f1:	75 0f                	jne    801602 <strtol+0x48>
+  8015f3:	80 3f 30             	cmpb   $0x30,(%rdi)
+  8015f6:	74 14                	je     80160c <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  8015f8:	85 d2                	test   %edx,%edx
+  8015fa:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8015ff:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  801602:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  801607:	4c 63 ca             	movslq %edx,%r9
+  80160a:	eb 36                	jmp    801642 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  80160c:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  801610:	74 0f                	je     801621 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  801612:	85 d2                	test   %edx,%edx
+  801614:	75 ec                	jne    801602 <strtol+0x48>
+        s++;
+  801616:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  80161a:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  80161f:	eb e1                	jmp    801602 <strtol+0x48>
+        s += 2;
+  801621:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  801625:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  80162a:	eb d6                	jmp    801602 <strtol+0x48>
+            dig -= '0';
+  80162c:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  80162f:	44 0f b6 c1          	movzbl %cl,%r8d
+  801633:	41 39 d0             	cmp    %edx,%r8d
+  801636:	7d 21                	jge    801659 <strtol+0x9f>
+        val = val * base + dig;
+  801638:	49 0f af c1          	imul   %r9,%rax
+  80163c:	0f b6 c9             	movzbl %cl,%ecx
+  80163f:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  801642:	48 83 c7 01          	add    $0x1,%rdi
+  801646:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  80164a:	80 f9 39             	cmp    $0x39,%cl
+  80164d:	76 dd                	jbe    80162c <strtol+0x72>
+        else if (dig - 'a' < 27)
+  80164f:	80 f9 7b             	cmp    $0x7b,%cl
+  801652:	77 05                	ja     801659 <strtol+0x9f>
+            dig -= 'a' - 10;
+  801654:	83 e9 57             	sub    $0x57,%ecx
+  801657:	eb d6                	jmp    80162f <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  801659:	4d 85 d2             	test   %r10,%r10
+  80165c:	74 03                	je     801661 <strtol+0xa7>
+  80165e:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  801661:	48 89 c2             	mov    %rax,%rdx
+  801664:	48 f7 da             	neg    %rdx
+  801667:	40 80 fe 2d          	cmp    $0x2d,%sil
+  80166b:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  80166f:	c3                   	ret
+
+0000000000801670 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  801670:	55                   	push   %rbp
+  801671:	48 89 e5             	mov    %rsp,%rbp
+  801674:	53                   	push   %rbx
+  801675:	48 89 fa             	mov    %rdi,%rdx
+  801678:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80167b:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801680:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801685:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80168a:	be 00 00 00 00       	mov    $0x0,%esi
+  80168f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801695:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  801697:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80169b:	c9                   	leave
+  80169c:	c3                   	ret
+
+000000000080169d <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  80169d:	55                   	push   %rbp
+  80169e:	48 89 e5             	mov    %rsp,%rbp
+  8016a1:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8016a2:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8016a7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8016ac:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8016b1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016b6:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8016bb:	be 00 00 00 00       	mov    $0x0,%esi
+  8016c0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8016c6:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  8016c8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8016cc:	c9                   	leave
+  8016cd:	c3                   	ret
+
+00000000008016ce <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  8016ce:	55                   	push   %rbp
+  8016cf:	48 89 e5             	mov    %rsp,%rbp
+  8016d2:	53                   	push   %rbx
+  8016d3:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  8016d7:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8016da:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8016df:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8016e4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016e9:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8016ee:	be 00 00 00 00       	mov    $0x0,%esi
+  8016f3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8016f9:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8016fb:	48 85 c0             	test   %rax,%rax
+  8016fe:	7f 06                	jg     801706 <sys_env_destroy+0x38>
+}
+  801700:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801704:	c9                   	leave
+  801705:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801706:	49 89 c0             	mov    %rax,%r8
+  801709:	b9 03 00 00 00       	mov    $0x3,%ecx
+  80170e:	48 ba 30 44 80 00 00 	movabs $0x804430,%rdx
+  801715:	00 00 00 
+  801718:	be 26 00 00 00       	mov    $0x26,%esi
+  80171d:	48 bf 4f 44 80 00 00 	movabs $0x80444f,%rdi
+  801724:	00 00 00 
+  801727:	b8 00 00 00 00       	mov    $0x0,%eax
+  80172c:	49 b9 d4 07 80 00 00 	movabs $0x8007d4,%r9
+  801733:	00 00 00 
+  801736:	41 ff d1             	call   *%r9
+
+0000000000801739 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  801739:	55                   	push   %rbp
+  80173a:	48 89 e5             	mov    %rsp,%rbp
+  80173d:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80173e:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801743:	ba 00 00 00 00       	mov    $0x0,%edx
+  801748:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80174d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801752:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801757:	be 00 00 00 00       	mov    $0x0,%esi
+  80175c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801762:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  801764:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801768:	c9                   	leave
+  801769:	c3                   	ret
+
+000000000080176a <sys_yield>:
+
+void
+sys_yield(void) {
+  80176a:	55                   	push   %rbp
+  80176b:	48 89 e5             	mov    %rsp,%rbp
+  80176e:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80176f:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801774:	ba 00 00 00 00       	mov    $0x0,%edx
+  801779:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80177e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801783:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801788:	be 00 00 00 00       	mov    $0x0,%esi
+  80178d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801793:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  801795:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801799:	c9                   	leave
+  80179a:	c3                   	ret
+
+000000000080179b <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  80179b:	55                   	push   %rbp
+  80179c:	48 89 e5             	mov    %rsp,%rbp
+  80179f:	53                   	push   %rbx
+  8017a0:	48 89 fa             	mov    %rdi,%rdx
+  8017a3:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8017a6:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8017ab:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  8017b2:	00 00 00 
+  8017b5:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8017ba:	be 00 00 00 00       	mov    $0x0,%esi
+  8017bf:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8017c5:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  8017c7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8017cb:	c9                   	leave
+  8017cc:	c3                   	ret
+
+00000000008017cd <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  8017cd:	55                   	push   %rbp
+  8017ce:	48 89 e5             	mov    %rsp,%rbp
+  8017d1:	53                   	push   %rbx
+  8017d2:	49 89 f8             	mov    %rdi,%r8
+  8017d5:	48 89 d3             	mov    %rdx,%rbx
+  8017d8:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8017db:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8017e0:	4c 89 c2             	mov    %r8,%rdx
+  8017e3:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8017e6:	be 00 00 00 00       	mov    $0x0,%esi
+  8017eb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8017f1:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  8017f3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8017f7:	c9                   	leave
+  8017f8:	c3                   	ret
+
+00000000008017f9 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  8017f9:	55                   	push   %rbp
+  8017fa:	48 89 e5             	mov    %rsp,%rbp
+  8017fd:	53                   	push   %rbx
+  8017fe:	48 83 ec 08          	sub    $0x8,%rsp
+  801802:	89 f8                	mov    %edi,%eax
+  801804:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  801807:	48 63 f9             	movslq %ecx,%rdi
+  80180a:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80180d:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801812:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801815:	be 00 00 00 00       	mov    $0x0,%esi
+  80181a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801820:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801822:	48 85 c0             	test   %rax,%rax
+  801825:	7f 06                	jg     80182d <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  801827:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80182b:	c9                   	leave
+  80182c:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80182d:	49 89 c0             	mov    %rax,%r8
+  801830:	b9 04 00 00 00       	mov    $0x4,%ecx
+  801835:	48 ba 30 44 80 00 00 	movabs $0x804430,%rdx
+  80183c:	00 00 00 
+  80183f:	be 26 00 00 00       	mov    $0x26,%esi
+  801844:	48 bf 4f 44 80 00 00 	movabs $0x80444f,%rdi
+  80184b:	00 00 00 
+  80184e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801853:	49 b9 d4 07 80 00 00 	movabs $0x8007d4,%r9
+  80185a:	00 00 00 
+  80185d:	41 ff d1             	call   *%r9
+
+0000000000801860 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801860:	55                   	push   %rbp
+  801861:	48 89 e5             	mov    %rsp,%rbp
+  801864:	53                   	push   %rbx
+  801865:	48 83 ec 08          	sub    $0x8,%rsp
+  801869:	89 f8                	mov    %edi,%eax
+  80186b:	49 89 f2             	mov    %rsi,%r10
+  80186e:	48 89 cf             	mov    %rcx,%rdi
+  801871:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  801874:	48 63 da             	movslq %edx,%rbx
+  801877:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80187a:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80187f:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801882:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  801885:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801887:	48 85 c0             	test   %rax,%rax
+  80188a:	7f 06                	jg     801892 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  80188c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801890:	c9                   	leave
+  801891:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801892:	49 89 c0             	mov    %rax,%r8
+  801895:	b9 05 00 00 00       	mov    $0x5,%ecx
+  80189a:	48 ba 30 44 80 00 00 	movabs $0x804430,%rdx
+  8018a1:	00 00 00 
+  8018a4:	be 26 00 00 00       	mov    $0x26,%esi
+  8018a9:	48 bf 4f 44 80 00 00 	movabs $0x80444f,%rdi
+  8018b0:	00 00 00 
+  8018b3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018b8:	49 b9 d4 07 80 00 00 	movabs $0x8007d4,%r9
+  8018bf:	00 00 00 
+  8018c2:	41 ff d1             	call   *%r9
+
+00000000008018c5 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  8018c5:	55                   	push   %rbp
+  8018c6:	48 89 e5             	mov    %rsp,%rbp
+  8018c9:	53                   	push   %rbx
+  8018ca:	48 83 ec 08          	sub    $0x8,%rsp
+  8018ce:	48 89 f1             	mov    %rsi,%rcx
+  8018d1:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  8018d4:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8018d7:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8018dc:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8018e1:	be 00 00 00 00       	mov    $0x0,%esi
+  8018e6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8018ec:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8018ee:	48 85 c0             	test   %rax,%rax
+  8018f1:	7f 06                	jg     8018f9 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  8018f3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8018f7:	c9                   	leave
+  8018f8:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8018f9:	49 89 c0             	mov    %rax,%r8
+  8018fc:	b9 06 00 00 00       	mov    $0x6,%ecx
+  801901:	48 ba 30 44 80 00 00 	movabs $0x804430,%rdx
+  801908:	00 00 00 
+  80190b:	be 26 00 00 00       	mov    $0x26,%esi
+  801910:	48 bf 4f 44 80 00 00 	movabs $0x80444f,%rdi
+  801917:	00 00 00 
+  80191a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80191f:	49 b9 d4 07 80 00 00 	movabs $0x8007d4,%r9
+  801926:	00 00 00 
+  801929:	41 ff d1             	call   *%r9
+
+000000000080192c <sys_region_batch>:
+
+int
+sys_region_batch(const struct RegionOp *ops, size_t count) {
+  80192c:	55                   	push   %rbp
+  80192d:	48 89 e5             	mov    %rsp,%rbp
+  801930:	53                   	push   %rbx
+  801931:	48 83 ec 08          	sub    $0x8,%rsp
+  801935:	48 89 fa             	mov    %rdi,%rdx
+  801938:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80193b:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801940:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801945:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80194a:	be 00 00 00 00       	mov    $0x0,%esi
+  80194f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801955:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801957:	48 85 c0             	test   %rax,%rax
+  80195a:	7f 06                	jg     801962 <sys_region_batch+0x36>
+        else
+            platform_asan_unpoison(va, ops[i].size);
+    }
+#endif
+    return res;
+}
+  80195c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801960:	c9                   	leave
+  801961:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801962:	49 89 c0             	mov    %rax,%r8
+  801965:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  80196a:	48 ba 30 44 80 00 00 	movabs $0x804430,%rdx
+  801971:	00 00 00 
+  801974:	be 26 00 00 00       	mov    $0x26,%esi
+  801979:	48 bf 4f 44 80 00 00 	movabs $0x80444f,%rdi
+  801980:	00 00 00 
+  801983:	b8 00 00 00 00       	mov    $0x0,%eax
+  801988:	49 b9 d4 07 80 00 00 	movabs $0x8007d4,%r9
+  80198f:	00 00 00 
+  801992:	41 ff d1             	call   *%r9
+
+0000000000801995 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  801995:	55                   	push   %rbp
+  801996:	48 89 e5             	mov    %rsp,%rbp
+  801999:	53                   	push   %rbx
+  80199a:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  80199e:	48 63 ce             	movslq %esi,%rcx
+  8019a1:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8019a4:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8019a9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8019ae:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8019b3:	be 00 00 00 00       	mov    $0x0,%esi
+  8019b8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8019be:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8019c0:	48 85 c0             	test   %rax,%rax
+  8019c3:	7f 06                	jg     8019cb <sys_env_set_status+0x36>
+}
+  8019c5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8019c9:	c9                   	leave
+  8019ca:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8019cb:	49 89 c0             	mov    %rax,%r8
+  8019ce:	b9 09 00 00 00       	mov    $0x9,%ecx
+  8019d3:	48 ba 30 44 80 00 00 	movabs $0x804430,%rdx
+  8019da:	00 00 00 
+  8019dd:	be 26 00 00 00       	mov    $0x26,%esi
+  8019e2:	48 bf 4f 44 80 00 00 	movabs $0x80444f,%rdi
+  8019e9:	00 00 00 
+  8019ec:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019f1:	49 b9 d4 07 80 00 00 	movabs $0x8007d4,%r9
+  8019f8:	00 00 00 
+  8019fb:	41 ff d1             	call   *%r9
+
+00000000008019fe <sys_env_set_weight>:
+
+int
+sys_env_set_weight(envid_t envid, uint32_t weight) {
+  8019fe:	55                   	push   %rbp
+  8019ff:	48 89 e5             	mov    %rsp,%rbp
+  801a02:	53                   	push   %rbx
+  801a03:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_weight, 1, envid, weight, 0, 0, 0, 0);
+  801a07:	89 f1                	mov    %esi,%ecx
+  801a09:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801a0c:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801a11:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a16:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801a1b:	be 00 00 00 00       	mov    $0x0,%esi
+  801a20:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801a26:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801a28:	48 85 c0             	test   %rax,%rax
+  801a2b:	7f 06                	jg     801a33 <sys_env_set_weight+0x35>
+}
+  801a2d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801a31:	c9                   	leave
+  801a32:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801a33:	49 89 c0             	mov    %rax,%r8
+  801a36:	b9 10 00 00 00       	mov    $0x10,%ecx
+  801a3b:	48 ba 30 44 80 00 00 	movabs $0x804430,%rdx
+  801a42:	00 00 00 
+  801a45:	be 26 00 00 00       	mov    $0x26,%esi
+  801a4a:	48 bf 4f 44 80 00 00 	movabs $0x80444f,%rdi
+  801a51:	00 00 00 
+  801a54:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a59:	49 b9 d4 07 80 00 00 	movabs $0x8007d4,%r9
+  801a60:	00 00 00 
+  801a63:	41 ff d1             	call   *%r9
+
+0000000000801a66 <sys_env_set_rt>:
+
+int
+sys_env_set_rt(envid_t envid, uint64_t period, uint64_t budget, uint64_t deadline) {
+  801a66:	55                   	push   %rbp
+  801a67:	48 89 e5             	mov    %rsp,%rbp
+  801a6a:	53                   	push   %rbx
+  801a6b:	48 83 ec 08          	sub    $0x8,%rsp
+  801a6f:	89 f8                	mov    %edi,%eax
+  801a71:	48 89 d3             	mov    %rdx,%rbx
+  801a74:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_env_set_rt, 1, envid, period, budget, deadline, 0, 0);
+  801a77:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801a7a:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801a7f:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801a82:	be 00 00 00 00       	mov    $0x0,%esi
+  801a87:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801a8d:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801a8f:	48 85 c0             	test   %rax,%rax
+  801a92:	7f 06                	jg     801a9a <sys_env_set_rt+0x34>
+}
+  801a94:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801a98:	c9                   	leave
+  801a99:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801a9a:	49 89 c0             	mov    %rax,%r8
+  801a9d:	b9 11 00 00 00       	mov    $0x11,%ecx
+  801aa2:	48 ba 30 44 80 00 00 	movabs $0x804430,%rdx
+  801aa9:	00 00 00 
+  801aac:	be 26 00 00 00       	mov    $0x26,%esi
+  801ab1:	48 bf 4f 44 80 00 00 	movabs $0x80444f,%rdi
+  801ab8:	00 00 00 
+  801abb:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ac0:	49 b9 d4 07 80 00 00 	movabs $0x8007d4,%r9
+  801ac7:	00 00 00 
+  801aca:	41 ff d1             	call   *%r9
+
+0000000000801acd <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  801acd:	55                   	push   %rbp
+  801ace:	48 89 e5             	mov    %rsp,%rbp
+  801ad1:	53                   	push   %rbx
+  801ad2:	48 83 ec 08          	sub    $0x8,%rsp
+  801ad6:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  801ad9:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801adc:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801ae1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801ae6:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801aeb:	be 00 00 00 00       	mov    $0x0,%esi
+  801af0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801af6:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801af8:	48 85 c0             	test   %rax,%rax
+  801afb:	7f 06                	jg     801b03 <sys_env_set_trapframe+0x36>
+}
+  801afd:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801b01:	c9                   	leave
+  801b02:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801b03:	49 89 c0             	mov    %rax,%r8
+  801b06:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  801b0b:	48 ba 30 44 80 00 00 	movabs $0x804430,%rdx
+  801b12:	00 00 00 
+  801b15:	be 26 00 00 00       	mov    $0x26,%esi
+  801b1a:	48 bf 4f 44 80 00 00 	movabs $0x80444f,%rdi
+  801b21:	00 00 00 
+  801b24:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b29:	49 b9 d4 07 80 00 00 	movabs $0x8007d4,%r9
+  801b30:	00 00 00 
+  801b33:	41 ff d1             	call   *%r9
+
+0000000000801b36 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  801b36:	55                   	push   %rbp
+  801b37:	48 89 e5             	mov    %rsp,%rbp
+  801b3a:	53                   	push   %rbx
+  801b3b:	48 83 ec 08          	sub    $0x8,%rsp
+  801b3f:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  801b42:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801b45:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801b4a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b4f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801b54:	be 00 00 00 00       	mov    $0x0,%esi
+  801b59:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801b5f:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801b61:	48 85 c0             	test   %rax,%rax
+  801b64:	7f 06                	jg     801b6c <sys_env_set_pgfault_upcall+0x36>
+}
+  801b66:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801b6a:	c9                   	leave
+  801b6b:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801b6c:	49 89 c0             	mov    %rax,%r8
+  801b6f:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  801b74:	48 ba 30 44 80 00 00 	movabs $0x804430,%rdx
+  801b7b:	00 00 00 
+  801b7e:	be 26 00 00 00       	mov    $0x26,%esi
+  801b83:	48 bf 4f 44 80 00 00 	movabs $0x80444f,%rdi
+  801b8a:	00 00 00 
+  801b8d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b92:	49 b9 d4 07 80 00 00 	movabs $0x8007d4,%r9
+  801b99:	00 00 00 
+  801b9c:	41 ff d1             	call   *%r9
+
+0000000000801b9f <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  801b9f:	55                   	push   %rbp
+  801ba0:	48 89 e5             	mov    %rsp,%rbp
+  801ba3:	53                   	push   %rbx
+  801ba4:	89 f8                	mov    %edi,%eax
+  801ba6:	49 89 f1             	mov    %rsi,%r9
+  801ba9:	48 89 d3             	mov    %rdx,%rbx
+  801bac:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  801baf:	49 63 f0             	movslq %r8d,%rsi
+  801bb2:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801bb5:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801bba:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801bbd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801bc3:	cd 30                	int    $0x30
+}
+  801bc5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801bc9:	c9                   	leave
+  801bca:	c3                   	ret
+
+0000000000801bcb <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  801bcb:	55                   	push   %rbp
+  801bcc:	48 89 e5             	mov    %rsp,%rbp
+  801bcf:	53                   	push   %rbx
+  801bd0:	48 83 ec 08          	sub    $0x8,%rsp
+  801bd4:	48 89 fa             	mov    %rdi,%rdx
+  801bd7:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801bda:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801bdf:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801be4:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801be9:	be 00 00 00 00       	mov    $0x0,%esi
+  801bee:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801bf4:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801bf6:	48 85 c0             	test   %rax,%rax
+  801bf9:	7f 06                	jg     801c01 <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801bfb:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801bff:	c9                   	leave
+  801c00:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801c01:	49 89 c0             	mov    %rax,%r8
+  801c04:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  801c09:	48 ba 30 44 80 00 00 	movabs $0x804430,%rdx
+  801c10:	00 00 00 
+  801c13:	be 26 00 00 00       	mov    $0x26,%esi
+  801c18:	48 bf 4f 44 80 00 00 	movabs $0x80444f,%rdi
+  801c1f:	00 00 00 
+  801c22:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c27:	49 b9 d4 07 80 00 00 	movabs $0x8007d4,%r9
+  801c2e:	00 00 00 
+  801c31:	41 ff d1             	call   *%r9
+
+0000000000801c34 <fork>:
+ * Hint:
+ *   Use sys_map_region, it can perform address space copying in one call
+ *   Remember to fix "thisenv" in the child process.
+ */
+envid_t
+fork(void) {
+  801c34:	55                   	push   %rbp
+  801c35:	48 89 e5             	mov    %rsp,%rbp
+  801c38:	41 55                	push   %r13
+  801c3a:	41 54                	push   %r12
+  801c3c:	53                   	push   %rbx
+  801c3d:	48 83 ec 08          	sub    $0x8,%rsp
+
+/* This must be inlined. Exercise for reader: why? */
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+    envid_t ret;
+    asm volatile("int %2"
+  801c41:	b8 08 00 00 00       	mov    $0x8,%eax
+  801c46:	cd 30                	int    $0x30
+  801c48:	41 89 c5             	mov    %eax,%r13d
+    // LAB 9: Your code here
+
+    envid_t child_id = sys_exofork();
+    if (child_id < 0) {
+  801c4b:	85 c0                	test   %eax,%eax
+  801c4d:	0f 88 ae 00 00 00    	js     801d01 <fork+0xcd>
+  801c53:	89 c3                	mov    %eax,%ebx
+        return child_id;
+    }
+    if (child_id == 0) {
+  801c55:	0f 84 b4 00 00 00    	je     801d0f <fork+0xdb>
+        thisenv = &envs[ENVX(sys_getenvid())];
+        return 0;
+    }
+    int res = sys_map_region(0, NULL, child_id, NULL, MAX_USER_ADDRESS, PROT_ALL | PROT_LAZY | PROT_COMBINE);
+  801c5b:	41 b9 df 01 00 00    	mov    $0x1df,%r9d
+  801c61:	49 b8 00 00 00 00 80 	movabs $0x8000000000,%r8
+  801c68:	00 00 00 
+  801c6b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801c70:	89 c2                	mov    %eax,%edx
+  801c72:	be 00 00 00 00       	mov    $0x0,%esi
+  801c77:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c7c:	48 b8 60 18 80 00 00 	movabs $0x801860,%rax
+  801c83:	00 00 00 
+  801c86:	ff d0                	call   *%rax
+  801c88:	41 89 c4             	mov    %eax,%r12d
+    if (res < 0) {
+  801c8b:	85 c0                	test   %eax,%eax
+  801c8d:	78 5d                	js     801cec <fork+0xb8>
+        goto error;
+    }
+    res = sys_env_set_pgfault_upcall(child_id, envs[ENVX(sys_getenvid())].env_pgfault_upcall);
+  801c8f:	48 b8 39 17 80 00 00 	movabs $0x801739,%rax
+  801c96:	00 00 00 
+  801c99:	ff d0                	call   *%rax
+  801c9b:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801ca0:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+  801ca7:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  801cae:	00 00 00 
+  801cb1:	48 01 d0             	add    %rdx,%rax
+  801cb4:	48 8b b0 88 01 00 00 	mov    0x188(%rax),%rsi
+  801cbb:	44 89 ef             	mov    %r13d,%edi
+  801cbe:	48 b8 36 1b 80 00 00 	movabs $0x801b36,%rax
+  801cc5:	00 00 00 
+  801cc8:	ff d0                	call   *%rax
+  801cca:	41 89 c4             	mov    %eax,%r12d
+    if (res < 0) {
+  801ccd:	85 c0                	test   %eax,%eax
+  801ccf:	78 1b                	js     801cec <fork+0xb8>
+        goto error;
+    }
+    res = sys_env_set_status(child_id, ENV_RUNNABLE);
+  801cd1:	be 02 00 00 00       	mov    $0x2,%esi
+  801cd6:	44 89 ef             	mov    %r13d,%edi
+  801cd9:	48 b8 95 19 80 00 00 	movabs $0x801995,%rax
+  801ce0:	00 00 00 
+  801ce3:	ff d0                	call   *%rax
+  801ce5:	41 89 c4             	mov    %eax,%r12d
+    if (res < 0) {
+  801ce8:	85 c0                	test   %eax,%eax
+  801cea:	79 15                	jns    801d01 <fork+0xcd>
+        goto error;
+    }
+    return child_id;
+error:
+    ;
+    int res2 = sys_env_destroy(child_id);
+  801cec:	89 df                	mov    %ebx,%edi
+  801cee:	48 b8 ce 16 80 00 00 	movabs $0x8016ce,%rax
+  801cf5:	00 00 00 
+  801cf8:	ff d0                	call   *%rax
+    if (res2 < 0) {
+  801cfa:	85 c0                	test   %eax,%eax
+  801cfc:	78 42                	js     801d40 <fork+0x10c>
+        panic("Fork double fault");
+    }
+    return res;
+  801cfe:	45 89 e5             	mov    %r12d,%r13d
+}
+  801d01:	44 89 e8             	mov    %r13d,%eax
+  801d04:	48 83 c4 08          	add    $0x8,%rsp
+  801d08:	5b                   	pop    %rbx
+  801d09:	41 5c                	pop    %r12
+  801d0b:	41 5d                	pop    %r13
+  801d0d:	5d                   	pop    %rbp
+  801d0e:	c3                   	ret
+        thisenv = &envs[ENVX(sys_getenvid())];
+  801d0f:	48 b8 39 17 80 00 00 	movabs $0x801739,%rax
+  801d16:	00 00 00 
+  801d19:	ff d0                	call   *%rax
+  801d1b:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801d20:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+  801d27:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  801d2e:	00 00 00 
+  801d31:	48 01 d0             	add    %rdx,%rax
+  801d34:	48 a3 00 60 80 00 00 	movabs %rax,0x806000
+  801d3b:	00 00 00 
+        return 0;
+  801d3e:	eb c1                	jmp    801d01 <fork+0xcd>
+        panic("Fork double fault");
+  801d40:	48 ba 5d 44 80 00 00 	movabs $0x80445d,%rdx
+  801d47:	00 00 00 
+  801d4a:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801d4f:	48 bf 6f 44 80 00 00 	movabs $0x80446f,%rdi
+  801d56:	00 00 00 
+  801d59:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d5e:	48 b9 d4 07 80 00 00 	movabs $0x8007d4,%rcx
+  801d65:	00 00 00 
+  801d68:	ff d1                	call   *%rcx
+
+0000000000801d6a <sfork>:
+
+envid_t
+sfork() {
+  801d6a:	55                   	push   %rbp
+  801d6b:	48 89 e5             	mov    %rsp,%rbp
+    panic("sfork() is not implemented");
+  801d6e:	48 ba 7a 44 80 00 00 	movabs $0x80447a,%rdx
+  801d75:	00 00 00 
+  801d78:	be 36 00 00 00       	mov    $0x36,%esi
+  801d7d:	48 bf 6f 44 80 00 00 	movabs $0x80446f,%rdi
+  801d84:	00 00 00 
+  801d87:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d8c:	48 b9 d4 07 80 00 00 	movabs $0x8007d4,%rcx
+  801d93:	00 00 00 
+  801d96:	ff d1                	call   *%rcx
+
+0000000000801d98 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801d98:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801d9f:	ff ff ff 
+  801da2:	48 01 f8             	add    %rdi,%rax
+  801da5:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  801da9:	c3                   	ret
+
+0000000000801daa <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801daa:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801db1:	ff ff ff 
+  801db4:	48 01 f8             	add    %rdi,%rax
+  801db7:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  801dbb:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  801dc1:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  801dc5:	c3                   	ret
+
+0000000000801dc6 <fd_alloc_from>:
+}
+
+/* Like fd_alloc(), but only considers fds starting from fdnum,
+ * so that several fds can be found before their pages are allocated */
+int
+fd_alloc_from(int fdnum, struct Fd **fd_store) {
+  801dc6:	55                   	push   %rbp
+  801dc7:	48 89 e5             	mov    %rsp,%rbp
+  801dca:	41 57                	push   %r15
+  801dcc:	41 56                	push   %r14
+  801dce:	41 55                	push   %r13
+  801dd0:	41 54                	push   %r12
+  801dd2:	53                   	push   %rbx
+  801dd3:	48 83 ec 08          	sub    $0x8,%rsp
+  801dd7:	49 89 f7             	mov    %rsi,%r15
+    for (int i = MAX(fdnum, 0); i < MAXFD; i++) {
+  801dda:	85 ff                	test   %edi,%edi
+  801ddc:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  801de2:	44 0f 49 e7          	cmovns %edi,%r12d
+  801de6:	83 ff 1f             	cmp    $0x1f,%edi
+  801de9:	7f 37                	jg     801e22 <fd_alloc_from+0x5c>
+  801deb:	49 63 dc             	movslq %r12d,%rbx
+  801dee:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  801df5:	48 c1 e3 0c          	shl    $0xc,%rbx
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  801df9:	49 be 98 39 80 00 00 	movabs $0x803998,%r14
+  801e00:	00 00 00 
+        struct Fd *fd = INDEX2FD(i);
+  801e03:	49 89 dd             	mov    %rbx,%r13
+        if (!(get_prot(fd) & PROT_R)) {
+  801e06:	48 89 df             	mov    %rbx,%rdi
+  801e09:	41 ff d6             	call   *%r14
+  801e0c:	83 e0 04             	and    $0x4,%eax
+  801e0f:	74 1c                	je     801e2d <fd_alloc_from+0x67>
+    for (int i = MAX(fdnum, 0); i < MAXFD; i++) {
+  801e11:	41 83 c4 01          	add    $0x1,%r12d
+  801e15:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801e1c:	41 83 fc 1f          	cmp    $0x1f,%r12d
+  801e20:	7e e1                	jle    801e03 <fd_alloc_from+0x3d>
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  801e22:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801e28:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  801e2d:	4d 89 2f             	mov    %r13,(%r15)
+}
+  801e30:	48 83 c4 08          	add    $0x8,%rsp
+  801e34:	5b                   	pop    %rbx
+  801e35:	41 5c                	pop    %r12
+  801e37:	41 5d                	pop    %r13
+  801e39:	41 5e                	pop    %r14
+  801e3b:	41 5f                	pop    %r15
+  801e3d:	5d                   	pop    %rbp
+  801e3e:	c3                   	ret
+
+0000000000801e3f <fd_alloc>:
+fd_alloc(struct Fd **fd_store) {
+  801e3f:	55                   	push   %rbp
+  801e40:	48 89 e5             	mov    %rsp,%rbp
+  801e43:	48 89 fe             	mov    %rdi,%rsi
+    return fd_alloc_from(0, fd_store);
+  801e46:	bf 00 00 00 00       	mov    $0x0,%edi
+  801e4b:	48 b8 c6 1d 80 00 00 	movabs $0x801dc6,%rax
+  801e52:	00 00 00 
+  801e55:	ff d0                	call   *%rax
+}
+  801e57:	5d                   	pop    %rbp
+  801e58:	c3                   	ret
+
+0000000000801e59 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  801e59:	83 ff 1f             	cmp    $0x1f,%edi
+  801e5c:	77 39                	ja     801e97 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  801e5e:	55                   	push   %rbp
+  801e5f:	48 89 e5             	mov    %rsp,%rbp
+  801e62:	41 54                	push   %r12
+  801e64:	53                   	push   %rbx
+  801e65:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  801e68:	48 63 df             	movslq %edi,%rbx
+  801e6b:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  801e72:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  801e76:	48 89 df             	mov    %rbx,%rdi
+  801e79:	48 b8 98 39 80 00 00 	movabs $0x803998,%rax
+  801e80:	00 00 00 
+  801e83:	ff d0                	call   *%rax
+  801e85:	a8 04                	test   $0x4,%al
+  801e87:	74 14                	je     801e9d <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  801e89:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  801e8d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801e92:	5b                   	pop    %rbx
+  801e93:	41 5c                	pop    %r12
+  801e95:	5d                   	pop    %rbp
+  801e96:	c3                   	ret
+        return -E_INVAL;
+  801e97:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801e9c:	c3                   	ret
+        return -E_INVAL;
+  801e9d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801ea2:	eb ee                	jmp    801e92 <fd_lookup+0x39>
+
+0000000000801ea4 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  801ea4:	55                   	push   %rbp
+  801ea5:	48 89 e5             	mov    %rsp,%rbp
+  801ea8:	41 54                	push   %r12
+  801eaa:	53                   	push   %rbx
+  801eab:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  801eae:	48 b8 20 45 80 00 00 	movabs $0x804520,%rax
+  801eb5:	00 00 00 
+  801eb8:	48 bb 40 50 80 00 00 	movabs $0x805040,%rbx
+  801ebf:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  801ec2:	39 3b                	cmp    %edi,(%rbx)
+  801ec4:	74 47                	je     801f0d <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  801ec6:	48 83 c0 08          	add    $0x8,%rax
+  801eca:	48 8b 18             	mov    (%rax),%rbx
+  801ecd:	48 85 db             	test   %rbx,%rbx
+  801ed0:	75 f0                	jne    801ec2 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801ed2:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  801ed9:	00 00 00 
+  801edc:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+  801ee2:	89 fa                	mov    %edi,%edx
+  801ee4:	48 bf 98 44 80 00 00 	movabs $0x804498,%rdi
+  801eeb:	00 00 00 
+  801eee:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ef3:	48 b9 24 09 80 00 00 	movabs $0x800924,%rcx
+  801efa:	00 00 00 
+  801efd:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  801eff:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  801f04:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  801f08:	5b                   	pop    %rbx
+  801f09:	41 5c                	pop    %r12
+  801f0b:	5d                   	pop    %rbp
+  801f0c:	c3                   	ret
+            return 0;
+  801f0d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f12:	eb f0                	jmp    801f04 <dev_lookup+0x60>
+
+0000000000801f14 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  801f14:	55                   	push   %rbp
+  801f15:	48 89 e5             	mov    %rsp,%rbp
+  801f18:	41 55                	push   %r13
+  801f1a:	41 54                	push   %r12
+  801f1c:	53                   	push   %rbx
+  801f1d:	48 83 ec 18          	sub    $0x18,%rsp
+  801f21:	48 89 fb             	mov    %rdi,%rbx
+  801f24:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801f27:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  801f2e:	ff ff ff 
+  801f31:	48 01 df             	add    %rbx,%rdi
+  801f34:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  801f38:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801f3c:	48 b8 59 1e 80 00 00 	movabs $0x801e59,%rax
+  801f43:	00 00 00 
+  801f46:	ff d0                	call   *%rax
+  801f48:	41 89 c5             	mov    %eax,%r13d
+  801f4b:	85 c0                	test   %eax,%eax
+  801f4d:	78 06                	js     801f55 <fd_close+0x41>
+  801f4f:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  801f53:	74 1a                	je     801f6f <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  801f55:	45 84 e4             	test   %r12b,%r12b
+  801f58:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f5d:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  801f61:	44 89 e8             	mov    %r13d,%eax
+  801f64:	48 83 c4 18          	add    $0x18,%rsp
+  801f68:	5b                   	pop    %rbx
+  801f69:	41 5c                	pop    %r12
+  801f6b:	41 5d                	pop    %r13
+  801f6d:	5d                   	pop    %rbp
+  801f6e:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801f6f:	8b 3b                	mov    (%rbx),%edi
+  801f71:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801f75:	48 b8 a4 1e 80 00 00 	movabs $0x801ea4,%rax
+  801f7c:	00 00 00 
+  801f7f:	ff d0                	call   *%rax
+  801f81:	41 89 c5             	mov    %eax,%r13d
+  801f84:	85 c0                	test   %eax,%eax
+  801f86:	78 1b                	js     801fa3 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  801f88:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801f8c:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801f90:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801f96:	48 85 c0             	test   %rax,%rax
+  801f99:	74 08                	je     801fa3 <fd_close+0x8f>
+  801f9b:	48 89 df             	mov    %rbx,%rdi
+  801f9e:	ff d0                	call   *%rax
+  801fa0:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801fa3:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801fa8:	48 89 de             	mov    %rbx,%rsi
+  801fab:	bf 00 00 00 00       	mov    $0x0,%edi
+  801fb0:	48 b8 c5 18 80 00 00 	movabs $0x8018c5,%rax
+  801fb7:	00 00 00 
+  801fba:	ff d0                	call   *%rax
+    return res;
+  801fbc:	eb a3                	jmp    801f61 <fd_close+0x4d>
+
+0000000000801fbe <close>:
+
+int
+close(int fdnum) {
+  801fbe:	55                   	push   %rbp
+  801fbf:	48 89 e5             	mov    %rsp,%rbp
+  801fc2:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  801fc6:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801fca:	48 b8 59 1e 80 00 00 	movabs $0x801e59,%rax
+  801fd1:	00 00 00 
+  801fd4:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801fd6:	85 c0                	test   %eax,%eax
+  801fd8:	78 15                	js     801fef <close+0x31>
+
+    return fd_close(fd, 1);
+  801fda:	be 01 00 00 00       	mov    $0x1,%esi
+  801fdf:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801fe3:	48 b8 14 1f 80 00 00 	movabs $0x801f14,%rax
+  801fea:	00 00 00 
+  801fed:	ff d0                	call   *%rax
+}
+  801fef:	c9                   	leave
+  801ff0:	c3                   	ret
+
+0000000000801ff1 <close_all>:
+
+void
+close_all(void) {
+  801ff1:	55                   	push   %rbp
+  801ff2:	48 89 e5             	mov    %rsp,%rbp
+  801ff5:	41 54                	push   %r12
+  801ff7:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  801ff8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801ffd:	49 bc be 1f 80 00 00 	movabs $0x801fbe,%r12
+  802004:	00 00 00 
+  802007:	89 df                	mov    %ebx,%edi
+  802009:	41 ff d4             	call   *%r12
+  80200c:	83 c3 01             	add    $0x1,%ebx
+  80200f:	83 fb 20             	cmp    $0x20,%ebx
+  802012:	75 f3                	jne    802007 <close_all+0x16>
+}
+  802014:	5b                   	pop    %rbx
+  802015:	41 5c                	pop    %r12
+  802017:	5d                   	pop    %rbp
+  802018:	c3                   	ret
+
+0000000000802019 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  802019:	55                   	push   %rbp
+  80201a:	48 89 e5             	mov    %rsp,%rbp
+  80201d:	41 57                	push   %r15
+  80201f:	41 56                	push   %r14
+  802021:	41 55                	push   %r13
+  802023:	41 54                	push   %r12
+  802025:	53                   	push   %rbx
+  802026:	48 83 ec 18          	sub    $0x18,%rsp
+  80202a:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  80202d:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  802031:	48 b8 59 1e 80 00 00 	movabs $0x801e59,%rax
+  802038:	00 00 00 
+  80203b:	ff d0                	call   *%rax
+  80203d:	89 c3                	mov    %eax,%ebx
+  80203f:	85 c0                	test   %eax,%eax
+  802041:	0f 88 b8 00 00 00    	js     8020ff <dup+0xe6>
+    close(newfdnum);
+  802047:	44 89 e7             	mov    %r12d,%edi
+  80204a:	48 b8 be 1f 80 00 00 	movabs $0x801fbe,%rax
+  802051:	00 00 00 
+  802054:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  802056:	4d 63 ec             	movslq %r12d,%r13
+  802059:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  802060:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  802064:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  802068:	4c 89 ff             	mov    %r15,%rdi
+  80206b:	49 be aa 1d 80 00 00 	movabs $0x801daa,%r14
+  802072:	00 00 00 
+  802075:	41 ff d6             	call   *%r14
+  802078:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  80207b:	4c 89 ef             	mov    %r13,%rdi
+  80207e:	41 ff d6             	call   *%r14
+  802081:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  802084:	48 89 df             	mov    %rbx,%rdi
+  802087:	48 b8 98 39 80 00 00 	movabs $0x803998,%rax
+  80208e:	00 00 00 
+  802091:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  802093:	a8 04                	test   $0x4,%al
+  802095:	74 2b                	je     8020c2 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  802097:	41 89 c1             	mov    %eax,%r9d
+  80209a:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8020a0:	4c 89 f1             	mov    %r14,%rcx
+  8020a3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8020a8:	48 89 de             	mov    %rbx,%rsi
+  8020ab:	bf 00 00 00 00       	mov    $0x0,%edi
+  8020b0:	48 b8 60 18 80 00 00 	movabs $0x801860,%rax
+  8020b7:	00 00 00 
+  8020ba:	ff d0                	call   *%rax
+  8020bc:	89 c3                	mov    %eax,%ebx
+  8020be:	85 c0                	test   %eax,%eax
+  8020c0:	78 4e                	js     802110 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  8020c2:	4c 89 ff             	mov    %r15,%rdi
+  8020c5:	48 b8 98 39 80 00 00 	movabs $0x803998,%rax
+  8020cc:	00 00 00 
+  8020cf:	ff d0                	call   *%rax
+  8020d1:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  8020d4:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8020da:	4c 89 e9             	mov    %r13,%rcx
+  8020dd:	ba 00 00 00 00       	mov    $0x0,%edx
+  8020e2:	4c 89 fe             	mov    %r15,%rsi
+  8020e5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8020ea:	48 b8 60 18 80 00 00 	movabs $0x801860,%rax
+  8020f1:	00 00 00 
+  8020f4:	ff d0                	call   *%rax
+  8020f6:	89 c3                	mov    %eax,%ebx
+  8020f8:	85 c0                	test   %eax,%eax
+  8020fa:	78 14                	js     802110 <dup+0xf7>
+
+    return newfdnum;
+  8020fc:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  8020ff:	89 d8                	mov    %ebx,%eax
+  802101:	48 83 c4 18          	add    $0x18,%rsp
+  802105:	5b                   	pop    %rbx
+  802106:	41 5c                	pop    %r12
+  802108:	41 5d                	pop    %r13
+  80210a:	41 5e                	pop    %r14
+  80210c:	41 5f                	pop    %r15
+  80210e:	5d                   	pop    %rbp
+  80210f:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  802110:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802115:	4c 89 ee             	mov    %r13,%rsi
+  802118:	bf 00 00 00 00       	mov    $0x0,%edi
+  80211d:	49 bc c5 18 80 00 00 	movabs $0x8018c5,%r12
+  802124:	00 00 00 
+  802127:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  80212a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80212f:	4c 89 f6             	mov    %r14,%rsi
+  802132:	bf 00 00 00 00       	mov    $0x0,%edi
+  802137:	41 ff d4             	call   *%r12
+    return res;
+  80213a:	eb c3                	jmp    8020ff <dup+0xe6>
+
+000000000080213c <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  80213c:	55                   	push   %rbp
+  80213d:	48 89 e5             	mov    %rsp,%rbp
+  802140:	41 56                	push   %r14
+  802142:	41 55                	push   %r13
+  802144:	41 54                	push   %r12
+  802146:	53                   	push   %rbx
+  802147:	48 83 ec 10          	sub    $0x10,%rsp
+  80214b:	89 fb                	mov    %edi,%ebx
+  80214d:	49 89 f4             	mov    %rsi,%r12
+  802150:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802153:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802157:	48 b8 59 1e 80 00 00 	movabs $0x801e59,%rax
+  80215e:	00 00 00 
+  802161:	ff d0                	call   *%rax
+  802163:	85 c0                	test   %eax,%eax
+  802165:	78 4c                	js     8021b3 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802167:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  80216b:	41 8b 3e             	mov    (%r14),%edi
+  80216e:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802172:	48 b8 a4 1e 80 00 00 	movabs $0x801ea4,%rax
+  802179:	00 00 00 
+  80217c:	ff d0                	call   *%rax
+  80217e:	85 c0                	test   %eax,%eax
+  802180:	78 35                	js     8021b7 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  802182:	41 8b 46 08          	mov    0x8(%r14),%eax
+  802186:	83 e0 03             	and    $0x3,%eax
+  802189:	83 f8 01             	cmp    $0x1,%eax
+  80218c:	74 2d                	je     8021bb <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  80218e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802192:	48 8b 40 10          	mov    0x10(%rax),%rax
+  802196:	48 85 c0             	test   %rax,%rax
+  802199:	74 56                	je     8021f1 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  80219b:	4c 89 ea             	mov    %r13,%rdx
+  80219e:	4c 89 e6             	mov    %r12,%rsi
+  8021a1:	4c 89 f7             	mov    %r14,%rdi
+  8021a4:	ff d0                	call   *%rax
+}
+  8021a6:	48 83 c4 10          	add    $0x10,%rsp
+  8021aa:	5b                   	pop    %rbx
+  8021ab:	41 5c                	pop    %r12
+  8021ad:	41 5d                	pop    %r13
+  8021af:	41 5e                	pop    %r14
+  8021b1:	5d                   	pop    %rbp
+  8021b2:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8021b3:	48 98                	cltq
+  8021b5:	eb ef                	jmp    8021a6 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8021b7:	48 98                	cltq
+  8021b9:	eb eb                	jmp    8021a6 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8021bb:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  8021c2:	00 00 00 
+  8021c5:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+  8021cb:	89 da                	mov    %ebx,%edx
+  8021cd:	48 bf d9 44 80 00 00 	movabs $0x8044d9,%rdi
+  8021d4:	00 00 00 
+  8021d7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021dc:	48 b9 24 09 80 00 00 	movabs $0x800924,%rcx
+  8021e3:	00 00 00 
+  8021e6:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8021e8:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8021ef:	eb b5                	jmp    8021a6 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  8021f1:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  8021f8:	eb ac                	jmp    8021a6 <read+0x6a>
+
+00000000008021fa <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  8021fa:	55                   	push   %rbp
+  8021fb:	48 89 e5             	mov    %rsp,%rbp
+  8021fe:	41 57                	push   %r15
+  802200:	41 56                	push   %r14
+  802202:	41 55                	push   %r13
+  802204:	41 54                	push   %r12
+  802206:	53                   	push   %rbx
+  802207:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  80220b:	48 85 d2             	test   %rdx,%rdx
+  80220e:	74 54                	je     802264 <readn+0x6a>
+  802210:	41 89 fd             	mov    %edi,%r13d
+  802213:	49 89 f6             	mov    %rsi,%r14
+  802216:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  802219:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  80221e:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  802223:	49 bf 3c 21 80 00 00 	movabs $0x80213c,%r15
+  80222a:	00 00 00 
+  80222d:	4c 89 e2             	mov    %r12,%rdx
+  802230:	48 29 f2             	sub    %rsi,%rdx
+  802233:	4c 01 f6             	add    %r14,%rsi
+  802236:	44 89 ef             	mov    %r13d,%edi
+  802239:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  80223c:	85 c0                	test   %eax,%eax
+  80223e:	78 20                	js     802260 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  802240:	01 c3                	add    %eax,%ebx
+  802242:	85 c0                	test   %eax,%eax
+  802244:	74 08                	je     80224e <readn+0x54>
+  802246:	48 63 f3             	movslq %ebx,%rsi
+  802249:	4c 39 e6             	cmp    %r12,%rsi
+  80224c:	72 df                	jb     80222d <readn+0x33>
+    }
+    return res;
+  80224e:	48 63 c3             	movslq %ebx,%rax
+}
+  802251:	48 83 c4 08          	add    $0x8,%rsp
+  802255:	5b                   	pop    %rbx
+  802256:	41 5c                	pop    %r12
+  802258:	41 5d                	pop    %r13
+  80225a:	41 5e                	pop    %r14
+  80225c:	41 5f                	pop    %r15
+  80225e:	5d                   	pop    %rbp
+  80225f:	c3                   	ret
+        if (inc < 0) return inc;
+  802260:	48 98                	cltq
+  802262:	eb ed                	jmp    802251 <readn+0x57>
+    int inc = 1, res = 0;
+  802264:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802269:	eb e3                	jmp    80224e <readn+0x54>
+
+000000000080226b <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  80226b:	55                   	push   %rbp
+  80226c:	48 89 e5             	mov    %rsp,%rbp
+  80226f:	41 56                	push   %r14
+  802271:	41 55                	push   %r13
+  802273:	41 54                	push   %r12
+  802275:	53                   	push   %rbx
+  802276:	48 83 ec 10          	sub    $0x10,%rsp
+  80227a:	89 fb                	mov    %edi,%ebx
+  80227c:	49 89 f4             	mov    %rsi,%r12
+  80227f:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802282:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802286:	48 b8 59 1e 80 00 00 	movabs $0x801e59,%rax
+  80228d:	00 00 00 
+  802290:	ff d0                	call   *%rax
+  802292:	85 c0                	test   %eax,%eax
+  802294:	78 47                	js     8022dd <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802296:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  80229a:	41 8b 3e             	mov    (%r14),%edi
+  80229d:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8022a1:	48 b8 a4 1e 80 00 00 	movabs $0x801ea4,%rax
+  8022a8:	00 00 00 
+  8022ab:	ff d0                	call   *%rax
+  8022ad:	85 c0                	test   %eax,%eax
+  8022af:	78 30                	js     8022e1 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8022b1:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  8022b6:	74 2d                	je     8022e5 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  8022b8:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8022bc:	48 8b 40 18          	mov    0x18(%rax),%rax
+  8022c0:	48 85 c0             	test   %rax,%rax
+  8022c3:	74 56                	je     80231b <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  8022c5:	4c 89 ea             	mov    %r13,%rdx
+  8022c8:	4c 89 e6             	mov    %r12,%rsi
+  8022cb:	4c 89 f7             	mov    %r14,%rdi
+  8022ce:	ff d0                	call   *%rax
+}
+  8022d0:	48 83 c4 10          	add    $0x10,%rsp
+  8022d4:	5b                   	pop    %rbx
+  8022d5:	41 5c                	pop    %r12
+  8022d7:	41 5d                	pop    %r13
+  8022d9:	41 5e                	pop    %r14
+  8022db:	5d                   	pop    %rbp
+  8022dc:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8022dd:	48 98                	cltq
+  8022df:	eb ef                	jmp    8022d0 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8022e1:	48 98                	cltq
+  8022e3:	eb eb                	jmp    8022d0 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8022e5:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  8022ec:	00 00 00 
+  8022ef:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+  8022f5:	89 da                	mov    %ebx,%edx
+  8022f7:	48 bf f5 44 80 00 00 	movabs $0x8044f5,%rdi
+  8022fe:	00 00 00 
+  802301:	b8 00 00 00 00       	mov    $0x0,%eax
+  802306:	48 b9 24 09 80 00 00 	movabs $0x800924,%rcx
+  80230d:	00 00 00 
+  802310:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  802312:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802319:	eb b5                	jmp    8022d0 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  80231b:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  802322:	eb ac                	jmp    8022d0 <write+0x65>
+
+0000000000802324 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  802324:	55                   	push   %rbp
+  802325:	48 89 e5             	mov    %rsp,%rbp
+  802328:	53                   	push   %rbx
+  802329:	48 83 ec 18          	sub    $0x18,%rsp
+  80232d:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80232f:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802333:	48 b8 59 1e 80 00 00 	movabs $0x801e59,%rax
+  80233a:	00 00 00 
+  80233d:	ff d0                	call   *%rax
+  80233f:	85 c0                	test   %eax,%eax
+  802341:	78 0c                	js     80234f <seek+0x2b>
+
+    fd->fd_offset = offset;
+  802343:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802347:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  80234a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80234f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802353:	c9                   	leave
+  802354:	c3                   	ret
+
+0000000000802355 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  802355:	55                   	push   %rbp
+  802356:	48 89 e5             	mov    %rsp,%rbp
+  802359:	41 55                	push   %r13
+  80235b:	41 54                	push   %r12
+  80235d:	53                   	push   %rbx
+  80235e:	48 83 ec 18          	sub    $0x18,%rsp
+  802362:	89 fb                	mov    %edi,%ebx
+  802364:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802367:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80236b:	48 b8 59 1e 80 00 00 	movabs $0x801e59,%rax
+  802372:	00 00 00 
+  802375:	ff d0                	call   *%rax
+  802377:	85 c0                	test   %eax,%eax
+  802379:	78 38                	js     8023b3 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80237b:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  80237f:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  802383:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802387:	48 b8 a4 1e 80 00 00 	movabs $0x801ea4,%rax
+  80238e:	00 00 00 
+  802391:	ff d0                	call   *%rax
+  802393:	85 c0                	test   %eax,%eax
+  802395:	78 1c                	js     8023b3 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802397:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  80239c:	74 20                	je     8023be <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  80239e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8023a2:	48 8b 40 30          	mov    0x30(%rax),%rax
+  8023a6:	48 85 c0             	test   %rax,%rax
+  8023a9:	74 47                	je     8023f2 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  8023ab:	44 89 e6             	mov    %r12d,%esi
+  8023ae:	4c 89 ef             	mov    %r13,%rdi
+  8023b1:	ff d0                	call   *%rax
+}
+  8023b3:	48 83 c4 18          	add    $0x18,%rsp
+  8023b7:	5b                   	pop    %rbx
+  8023b8:	41 5c                	pop    %r12
+  8023ba:	41 5d                	pop    %r13
+  8023bc:	5d                   	pop    %rbp
+  8023bd:	c3                   	ret
+                thisenv->env_id, fdnum);
+  8023be:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  8023c5:	00 00 00 
+  8023c8:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8023ce:	89 da                	mov    %ebx,%edx
+  8023d0:	48 bf b8 44 80 00 00 	movabs $0x8044b8,%rdi
+  8023d7:	00 00 00 
+  8023da:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023df:	48 b9 24 09 80 00 00 	movabs $0x800924,%rcx
+  8023e6:	00 00 00 
+  8023e9:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8023eb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8023f0:	eb c1                	jmp    8023b3 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  8023f2:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8023f7:	eb ba                	jmp    8023b3 <ftruncate+0x5e>
+
+00000000008023f9 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  8023f9:	55                   	push   %rbp
+  8023fa:	48 89 e5             	mov    %rsp,%rbp
+  8023fd:	41 54                	push   %r12
+  8023ff:	53                   	push   %rbx
+  802400:	48 83 ec 10          	sub    $0x10,%rsp
+  802404:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802407:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80240b:	48 b8 59 1e 80 00 00 	movabs $0x801e59,%rax
+  802412:	00 00 00 
+  802415:	ff d0                	call   *%rax
+  802417:	85 c0                	test   %eax,%eax
+  802419:	78 4e                	js     802469 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80241b:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  80241f:	41 8b 3c 24          	mov    (%r12),%edi
+  802423:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  802427:	48 b8 a4 1e 80 00 00 	movabs $0x801ea4,%rax
+  80242e:	00 00 00 
+  802431:	ff d0                	call   *%rax
+  802433:	85 c0                	test   %eax,%eax
+  802435:	78 32                	js     802469 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  802437:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80243b:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  802440:	74 30                	je     802472 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  802442:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  802445:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  80244c:	00 00 00 
+    stat->st_isdir = 0;
+  80244f:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  802456:	00 00 00 
+    stat->st_dev = dev;
+  802459:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  802460:	48 89 de             	mov    %rbx,%rsi
+  802463:	4c 89 e7             	mov    %r12,%rdi
+  802466:	ff 50 28             	call   *0x28(%rax)
+}
+  802469:	48 83 c4 10          	add    $0x10,%rsp
+  80246d:	5b                   	pop    %rbx
+  80246e:	41 5c                	pop    %r12
+  802470:	5d                   	pop    %rbp
+  802471:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  802472:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802477:	eb f0                	jmp    802469 <fstat+0x70>
+
+0000000000802479 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  802479:	55                   	push   %rbp
+  80247a:	48 89 e5             	mov    %rsp,%rbp
+  80247d:	41 54                	push   %r12
+  80247f:	53                   	push   %rbx
+  802480:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  802483:	be 00 00 00 00       	mov    $0x0,%esi
+  802488:	48 b8 5c 28 80 00 00 	movabs $0x80285c,%rax
+  80248f:	00 00 00 
+  802492:	ff d0                	call   *%rax
+  802494:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  802496:	85 c0                	test   %eax,%eax
+  802498:	78 25                	js     8024bf <stat+0x46>
+
+    int res = fstat(fd, stat);
+  80249a:	4c 89 e6             	mov    %r12,%rsi
+  80249d:	89 c7                	mov    %eax,%edi
+  80249f:	48 b8 f9 23 80 00 00 	movabs $0x8023f9,%rax
+  8024a6:	00 00 00 
+  8024a9:	ff d0                	call   *%rax
+  8024ab:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  8024ae:	89 df                	mov    %ebx,%edi
+  8024b0:	48 b8 be 1f 80 00 00 	movabs $0x801fbe,%rax
+  8024b7:	00 00 00 
+  8024ba:	ff d0                	call   *%rax
+
+    return res;
+  8024bc:	44 89 e3             	mov    %r12d,%ebx
+}
+  8024bf:	89 d8                	mov    %ebx,%eax
+  8024c1:	5b                   	pop    %rbx
+  8024c2:	41 5c                	pop    %r12
+  8024c4:	5d                   	pop    %rbp
+  8024c5:	c3                   	ret
+
+00000000008024c6 <fsipc>:
+ * response may be written back to fsipcbuf.
+ * type: request code, passed as the simple integer IPC value.
+ * dstva: virtual address at which to receive reply page, 0 if none.
+ * Returns result from the file server. */
+static int
+fsipc(unsigned type, void *dstva) {
+  8024c6:	55                   	push   %rbp
+  8024c7:	48 89 e5             	mov    %rsp,%rbp
+  8024ca:	41 54                	push   %r12
+  8024cc:	53                   	push   %rbx
+  8024cd:	48 83 ec 10          	sub    $0x10,%rsp
+  8024d1:	41 89 fc             	mov    %edi,%r12d
+  8024d4:	48 89 f3             	mov    %rsi,%rbx
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8024d7:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  8024de:	00 00 00 
+  8024e1:	83 38 00             	cmpl   $0x0,(%rax)
+  8024e4:	74 5e                	je     802544 <fsipc+0x7e>
+    if (debug) {
+        cprintf("[%08x] fsipc %d %08x\n",
+                thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+    }
+
+    ipc_send(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW);
+  8024e6:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8024ec:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8024f1:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  8024f8:	00 00 00 
+  8024fb:	44 89 e6             	mov    %r12d,%esi
+  8024fe:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  802505:	00 00 00 
+  802508:	8b 38                	mov    (%rax),%edi
+  80250a:	48 b8 61 3c 80 00 00 	movabs $0x803c61,%rax
+  802511:	00 00 00 
+  802514:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  802516:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  80251d:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  80251e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802523:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  802527:	48 89 de             	mov    %rbx,%rsi
+  80252a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80252f:	48 b8 8c 3b 80 00 00 	movabs $0x803b8c,%rax
+  802536:	00 00 00 
+  802539:	ff d0                	call   *%rax
+}
+  80253b:	48 83 c4 10          	add    $0x10,%rsp
+  80253f:	5b                   	pop    %rbx
+  802540:	41 5c                	pop    %r12
+  802542:	5d                   	pop    %rbp
+  802543:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  802544:	bf 03 00 00 00       	mov    $0x3,%edi
+  802549:	48 b8 04 3d 80 00 00 	movabs $0x803d04,%rax
+  802550:	00 00 00 
+  802553:	ff d0                	call   *%rax
+  802555:	a3 00 80 80 00 00 00 	movabs %eax,0x808000
+  80255c:	00 00 
+  80255e:	eb 86                	jmp    8024e6 <fsipc+0x20>
+
+0000000000802560 <devfile_trunc>:
+    return 0;
+}
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  802560:	55                   	push   %rbp
+  802561:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802564:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  80256b:	00 00 00 
+  80256e:	8b 57 0c             	mov    0xc(%rdi),%edx
+  802571:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  802573:	89 70 04             	mov    %esi,0x4(%rax)
+
+    return fsipc(FSREQ_SET_SIZE, NULL);
+  802576:	be 00 00 00 00       	mov    $0x0,%esi
+  80257b:	bf 02 00 00 00       	mov    $0x2,%edi
+  802580:	48 b8 c6 24 80 00 00 	movabs $0x8024c6,%rax
+  802587:	00 00 00 
+  80258a:	ff d0                	call   *%rax
+}
+  80258c:	5d                   	pop    %rbp
+  80258d:	c3                   	ret
+
+000000000080258e <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  80258e:	55                   	push   %rbp
+  80258f:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  802592:	8b 47 0c             	mov    0xc(%rdi),%eax
+  802595:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  80259c:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  80259e:	be 00 00 00 00       	mov    $0x0,%esi
+  8025a3:	bf 06 00 00 00       	mov    $0x6,%edi
+  8025a8:	48 b8 c6 24 80 00 00 	movabs $0x8024c6,%rax
+  8025af:	00 00 00 
+  8025b2:	ff d0                	call   *%rax
+}
+  8025b4:	5d                   	pop    %rbp
+  8025b5:	c3                   	ret
+
+00000000008025b6 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  8025b6:	55                   	push   %rbp
+  8025b7:	48 89 e5             	mov    %rsp,%rbp
+  8025ba:	41 54                	push   %r12
+  8025bc:	53                   	push   %rbx
+  8025bd:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8025c0:	8b 47 0c             	mov    0xc(%rdi),%eax
+  8025c3:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  8025ca:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  8025cc:	be 00 00 00 00       	mov    $0x0,%esi
+  8025d1:	bf 05 00 00 00       	mov    $0x5,%edi
+  8025d6:	48 b8 c6 24 80 00 00 	movabs $0x8024c6,%rax
+  8025dd:	00 00 00 
+  8025e0:	ff d0                	call   *%rax
+    if (res < 0) {
+  8025e2:	85 c0                	test   %eax,%eax
+  8025e4:	78 3d                	js     802623 <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8025e6:	49 bc 00 70 80 00 00 	movabs $0x807000,%r12
+  8025ed:	00 00 00 
+  8025f0:	4c 89 e6             	mov    %r12,%rsi
+  8025f3:	48 89 df             	mov    %rbx,%rdi
+  8025f6:	48 b8 49 12 80 00 00 	movabs $0x801249,%rax
+  8025fd:	00 00 00 
+  802600:	ff d0                	call   *%rax
+    st->st_size  = fsipcbuf.statRet.ret_size;
+  802602:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  802609:	00 
+  80260a:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802610:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  802617:	00 
+  802618:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  80261e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802623:	5b                   	pop    %rbx
+  802624:	41 5c                	pop    %r12
+  802626:	5d                   	pop    %rbp
+  802627:	c3                   	ret
+
+0000000000802628 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  802628:	55                   	push   %rbp
+  802629:	48 89 e5             	mov    %rsp,%rbp
+  80262c:	41 57                	push   %r15
+  80262e:	41 56                	push   %r14
+  802630:	41 55                	push   %r13
+  802632:	41 54                	push   %r12
+  802634:	53                   	push   %rbx
+  802635:	48 83 ec 18          	sub    $0x18,%rsp
+  802639:	49 89 fe             	mov    %rdi,%r14
+  80263c:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+  802640:	48 89 d3             	mov    %rdx,%rbx
+    while (n > sizeof(fsipcbuf.write.req_buf))
+  802643:	48 81 fa f0 0f 00 00 	cmp    $0xff0,%rdx
+  80264a:	0f 86 e4 00 00 00    	jbe    802734 <devfile_write+0x10c>
+  802650:	49 89 f4             	mov    %rsi,%r12
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802653:	49 bd 00 70 80 00 00 	movabs $0x807000,%r13
+  80265a:	00 00 00 
+        memcpy(fsipcbuf.write.req_buf, buf, sizeof(fsipcbuf.write.req_buf));
+  80265d:	49 bf aa 14 80 00 00 	movabs $0x8014aa,%r15
+  802664:	00 00 00 
+  802667:	eb 03                	jmp    80266c <devfile_write+0x44>
+        buf += sizeof(fsipcbuf.write.req_buf);
+  802669:	49 89 f4             	mov    %rsi,%r12
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  80266c:	41 8b 46 0c          	mov    0xc(%r14),%eax
+  802670:	41 89 45 00          	mov    %eax,0x0(%r13)
+        fsipcbuf.write.req_n      = sizeof(fsipcbuf.write.req_buf);
+  802674:	49 c7 45 08 f0 0f 00 	movq   $0xff0,0x8(%r13)
+  80267b:	00 
+        memcpy(fsipcbuf.write.req_buf, buf, sizeof(fsipcbuf.write.req_buf));
+  80267c:	ba f0 0f 00 00       	mov    $0xff0,%edx
+  802681:	4c 89 e6             	mov    %r12,%rsi
+  802684:	48 bf 10 70 80 00 00 	movabs $0x807010,%rdi
+  80268b:	00 00 00 
+  80268e:	41 ff d7             	call   *%r15
+        ssize_t res = fsipc(FSREQ_WRITE, NULL);
+  802691:	be 00 00 00 00       	mov    $0x0,%esi
+  802696:	bf 04 00 00 00       	mov    $0x4,%edi
+  80269b:	48 b8 c6 24 80 00 00 	movabs $0x8024c6,%rax
+  8026a2:	00 00 00 
+  8026a5:	ff d0                	call   *%rax
+  8026a7:	48 63 d0             	movslq %eax,%rdx
+        if (res < 0 || res < sizeof(fsipcbuf.write.req_buf))
+  8026aa:	3d ef 0f 00 00       	cmp    $0xfef,%eax
+  8026af:	7e 71                	jle    802722 <devfile_write+0xfa>
+        buf += sizeof(fsipcbuf.write.req_buf);
+  8026b1:	49 8d b4 24 f0 0f 00 	lea    0xff0(%r12),%rsi
+  8026b8:	00 
+        n -= sizeof(fsipcbuf.write.req_buf);
+  8026b9:	48 81 eb f0 0f 00 00 	sub    $0xff0,%rbx
+    while (n > sizeof(fsipcbuf.write.req_buf))
+  8026c0:	48 81 fb f0 0f 00 00 	cmp    $0xff0,%rbx
+  8026c7:	77 a0                	ja     802669 <devfile_write+0x41>
+        written += sizeof(fsipcbuf.write.req_buf);
+  8026c9:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8026cd:	49 29 c4             	sub    %rax,%r12
+  8026d0:	4d 8d a4 24 f0 0f 00 	lea    0xff0(%r12),%r12
+  8026d7:	00 
+    fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8026d8:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  8026df:	00 00 00 
+  8026e2:	41 8b 56 0c          	mov    0xc(%r14),%edx
+  8026e6:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.write.req_n      = n;
+  8026e8:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    memcpy(fsipcbuf.write.req_buf, buf, n);
+  8026ec:	48 89 da             	mov    %rbx,%rdx
+  8026ef:	48 8d 78 10          	lea    0x10(%rax),%rdi
+  8026f3:	48 b8 aa 14 80 00 00 	movabs $0x8014aa,%rax
+  8026fa:	00 00 00 
+  8026fd:	ff d0                	call   *%rax
+    ssize_t res = fsipc(FSREQ_WRITE, NULL);
+  8026ff:	be 00 00 00 00       	mov    $0x0,%esi
+  802704:	bf 04 00 00 00       	mov    $0x4,%edi
+  802709:	48 b8 c6 24 80 00 00 	movabs $0x8024c6,%rax
+  802710:	00 00 00 
+  802713:	ff d0                	call   *%rax
+  802715:	48 63 d0             	movslq %eax,%rdx
+    written += res;
+  802718:	49 01 d4             	add    %rdx,%r12
+  80271b:	48 85 d2             	test   %rdx,%rdx
+  80271e:	49 0f 49 d4          	cmovns %r12,%rdx
+}
+  802722:	48 89 d0             	mov    %rdx,%rax
+  802725:	48 83 c4 18          	add    $0x18,%rsp
+  802729:	5b                   	pop    %rbx
+  80272a:	41 5c                	pop    %r12
+  80272c:	41 5d                	pop    %r13
+  80272e:	41 5e                	pop    %r14
+  802730:	41 5f                	pop    %r15
+  802732:	5d                   	pop    %rbp
+  802733:	c3                   	ret
+    while (n > sizeof(fsipcbuf.write.req_buf))
+  802734:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+    ssize_t written = 0;
+  802738:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80273e:	eb 98                	jmp    8026d8 <devfile_write+0xb0>
+
+0000000000802740 <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  802740:	55                   	push   %rbp
+  802741:	48 89 e5             	mov    %rsp,%rbp
+  802744:	41 57                	push   %r15
+  802746:	41 56                	push   %r14
+  802748:	41 55                	push   %r13
+  80274a:	41 54                	push   %r12
+  80274c:	53                   	push   %rbx
+  80274d:	48 83 ec 18          	sub    $0x18,%rsp
+  802751:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  802755:	49 89 f6             	mov    %rsi,%r14
+  802758:	49 89 d4             	mov    %rdx,%r12
+    while (n > sizeof(fsipcbuf.readRet.ret_buf))
+  80275b:	48 81 fa 00 10 00 00 	cmp    $0x1000,%rdx
+  802762:	0f 86 ea 00 00 00    	jbe    802852 <devfile_read+0x112>
+    ssize_t readsz = 0;
+  802768:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  80276f:	00 
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802770:	49 bf 00 70 80 00 00 	movabs $0x807000,%r15
+  802777:	00 00 00 
+  80277a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80277e:	8b 40 0c             	mov    0xc(%rax),%eax
+  802781:	41 89 07             	mov    %eax,(%r15)
+        fsipcbuf.read.req_n = sizeof(fsipcbuf.readRet.ret_buf);
+  802784:	49 c7 47 08 00 10 00 	movq   $0x1000,0x8(%r15)
+  80278b:	00 
+        ssize_t res = fsipc(FSREQ_READ, NULL);
+  80278c:	be 00 00 00 00       	mov    $0x0,%esi
+  802791:	bf 03 00 00 00       	mov    $0x3,%edi
+  802796:	48 b8 c6 24 80 00 00 	movabs $0x8024c6,%rax
+  80279d:	00 00 00 
+  8027a0:	ff d0                	call   *%rax
+  8027a2:	4c 63 e8             	movslq %eax,%r13
+        if (res < 0)
+  8027a5:	4d 85 ed             	test   %r13,%r13
+  8027a8:	0f 88 92 00 00 00    	js     802840 <devfile_read+0x100>
+        memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  8027ae:	4c 89 ea             	mov    %r13,%rdx
+  8027b1:	4c 89 fe             	mov    %r15,%rsi
+  8027b4:	4c 89 f7             	mov    %r14,%rdi
+  8027b7:	48 b8 aa 14 80 00 00 	movabs $0x8014aa,%rax
+  8027be:	00 00 00 
+  8027c1:	ff d0                	call   *%rax
+        if (res < sizeof(fsipcbuf.readRet.ret_buf))
+  8027c3:	49 81 fd ff 0f 00 00 	cmp    $0xfff,%r13
+  8027ca:	76 6d                	jbe    802839 <devfile_read+0xf9>
+        readsz += res;
+  8027cc:	4c 01 6d c0          	add    %r13,-0x40(%rbp)
+        buf += res;
+  8027d0:	4d 01 ee             	add    %r13,%r14
+        n -= res;
+  8027d3:	4d 29 ec             	sub    %r13,%r12
+    while (n > sizeof(fsipcbuf.readRet.ret_buf))
+  8027d6:	49 81 fc 00 10 00 00 	cmp    $0x1000,%r12
+  8027dd:	77 9b                	ja     80277a <devfile_read+0x3a>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8027df:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  8027e6:	00 00 00 
+  8027e9:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  8027ed:	8b 51 0c             	mov    0xc(%rcx),%edx
+  8027f0:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.read.req_n = n;
+  8027f2:	4c 89 60 08          	mov    %r12,0x8(%rax)
+    ssize_t res = fsipc(FSREQ_READ, NULL);
+  8027f6:	be 00 00 00 00       	mov    $0x0,%esi
+  8027fb:	bf 03 00 00 00       	mov    $0x3,%edi
+  802800:	48 b8 c6 24 80 00 00 	movabs $0x8024c6,%rax
+  802807:	00 00 00 
+  80280a:	ff d0                	call   *%rax
+  80280c:	4c 63 e8             	movslq %eax,%r13
+    if (res < 0)
+  80280f:	4d 85 ed             	test   %r13,%r13
+  802812:	78 2c                	js     802840 <devfile_read+0x100>
+    memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  802814:	4c 89 ea             	mov    %r13,%rdx
+  802817:	48 be 00 70 80 00 00 	movabs $0x807000,%rsi
+  80281e:	00 00 00 
+  802821:	4c 89 f7             	mov    %r14,%rdi
+  802824:	48 b8 aa 14 80 00 00 	movabs $0x8014aa,%rax
+  80282b:	00 00 00 
+  80282e:	ff d0                	call   *%rax
+    readsz += res;
+  802830:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802834:	49 01 c5             	add    %rax,%r13
+    return readsz;
+  802837:	eb 07                	jmp    802840 <devfile_read+0x100>
+            return readsz + res;
+  802839:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80283d:	49 01 c5             	add    %rax,%r13
+}
+  802840:	4c 89 e8             	mov    %r13,%rax
+  802843:	48 83 c4 18          	add    $0x18,%rsp
+  802847:	5b                   	pop    %rbx
+  802848:	41 5c                	pop    %r12
+  80284a:	41 5d                	pop    %r13
+  80284c:	41 5e                	pop    %r14
+  80284e:	41 5f                	pop    %r15
+  802850:	5d                   	pop    %rbp
+  802851:	c3                   	ret
+    ssize_t readsz = 0;
+  802852:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  802859:	00 
+  80285a:	eb 83                	jmp    8027df <devfile_read+0x9f>
+
+000000000080285c <open>:
+open(const char *path, int mode) {
+  80285c:	55                   	push   %rbp
+  80285d:	48 89 e5             	mov    %rsp,%rbp
+  802860:	41 55                	push   %r13
+  802862:	41 54                	push   %r12
+  802864:	53                   	push   %rbx
+  802865:	48 83 ec 18          	sub    $0x18,%rsp
+  802869:	49 89 fc             	mov    %rdi,%r12
+  80286c:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  80286f:	48 b8 0b 12 80 00 00 	movabs $0x80120b,%rax
+  802876:	00 00 00 
+  802879:	ff d0                	call   *%rax
+  80287b:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802881:	0f 87 8a 00 00 00    	ja     802911 <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802887:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  80288b:	48 b8 3f 1e 80 00 00 	movabs $0x801e3f,%rax
+  802892:	00 00 00 
+  802895:	ff d0                	call   *%rax
+  802897:	89 c3                	mov    %eax,%ebx
+  802899:	85 c0                	test   %eax,%eax
+  80289b:	78 50                	js     8028ed <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  80289d:	4c 89 e6             	mov    %r12,%rsi
+  8028a0:	48 bb 00 70 80 00 00 	movabs $0x807000,%rbx
+  8028a7:	00 00 00 
+  8028aa:	48 89 df             	mov    %rbx,%rdi
+  8028ad:	48 b8 49 12 80 00 00 	movabs $0x801249,%rax
+  8028b4:	00 00 00 
+  8028b7:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  8028b9:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  8028c0:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8028c4:	bf 01 00 00 00       	mov    $0x1,%edi
+  8028c9:	48 b8 c6 24 80 00 00 	movabs $0x8024c6,%rax
+  8028d0:	00 00 00 
+  8028d3:	ff d0                	call   *%rax
+  8028d5:	89 c3                	mov    %eax,%ebx
+  8028d7:	85 c0                	test   %eax,%eax
+  8028d9:	78 1f                	js     8028fa <open+0x9e>
+    return fd2num(fd);
+  8028db:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8028df:	48 b8 98 1d 80 00 00 	movabs $0x801d98,%rax
+  8028e6:	00 00 00 
+  8028e9:	ff d0                	call   *%rax
+  8028eb:	89 c3                	mov    %eax,%ebx
+}
+  8028ed:	89 d8                	mov    %ebx,%eax
+  8028ef:	48 83 c4 18          	add    $0x18,%rsp
+  8028f3:	5b                   	pop    %rbx
+  8028f4:	41 5c                	pop    %r12
+  8028f6:	41 5d                	pop    %r13
+  8028f8:	5d                   	pop    %rbp
+  8028f9:	c3                   	ret
+        fd_close(fd, 0);
+  8028fa:	be 00 00 00 00       	mov    $0x0,%esi
+  8028ff:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802903:	48 b8 14 1f 80 00 00 	movabs $0x801f14,%rax
+  80290a:	00 00 00 
+  80290d:	ff d0                	call   *%rax
+        return res;
+  80290f:	eb dc                	jmp    8028ed <open+0x91>
+        return -E_BAD_PATH;
+  802911:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  802916:	eb d5                	jmp    8028ed <open+0x91>
+
+0000000000802918 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  802918:	55                   	push   %rbp
+  802919:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc(FSREQ_SYNC, NULL);
+  80291c:	be 00 00 00 00       	mov    $0x0,%esi
+  802921:	bf 08 00 00 00       	mov    $0x8,%edi
+  802926:	48 b8 c6 24 80 00 00 	movabs $0x8024c6,%rax
+  80292d:	00 00 00 
+  802930:	ff d0                	call   *%rax
+}
+  802932:	5d                   	pop    %rbp
+  802933:	c3                   	ret
+
+0000000000802934 <region_flush>:
+ * sys_region_batch() call right before memory at UTEMP is reused */
+static struct RegionOp region_queue[REGION_BATCH_MAX];
+static size_t region_queued;
+
+static int
+region_flush(void) {
+  802934:	55                   	push   %rbp
+  802935:	48 89 e5             	mov    %rsp,%rbp
+  802938:	41 56                	push   %r14
+  80293a:	41 55                	push   %r13
+  80293c:	41 54                	push   %r12
+  80293e:	53                   	push   %rbx
+    int res = region_queued ? sys_region_batch(region_queue, region_queued) : 0;
+  80293f:	48 b8 20 80 80 00 00 	movabs $0x808020,%rax
+  802946:	00 00 00 
+  802949:	48 8b 30             	mov    (%rax),%rsi
+  80294c:	41 be 00 00 00 00    	mov    $0x0,%r14d
+  802952:	48 85 f6             	test   %rsi,%rsi
+  802955:	74 6d                	je     8029c4 <region_flush+0x90>
+  802957:	48 bf 40 80 80 00 00 	movabs $0x808040,%rdi
+  80295e:	00 00 00 
+  802961:	48 b8 2c 19 80 00 00 	movabs $0x80192c,%rax
+  802968:	00 00 00 
+  80296b:	ff d0                	call   *%rax
+  80296d:	41 89 c6             	mov    %eax,%r14d
+
+    /* Operations following the failed one are not performed,
+     * but memory at UTEMP still has to be unmapped from ours */
+    for (size_t i = 0; res < 0 && i < region_queued; i++) {
+  802970:	85 c0                	test   %eax,%eax
+  802972:	79 50                	jns    8029c4 <region_flush+0x90>
+  802974:	48 bb 40 80 80 00 00 	movabs $0x808040,%rbx
+  80297b:	00 00 00 
+  80297e:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802984:	49 bd 20 80 80 00 00 	movabs $0x808020,%r13
+  80298b:	00 00 00 
+  80298e:	eb 08                	jmp    802998 <region_flush+0x64>
+  802990:	49 83 c4 01          	add    $0x1,%r12
+  802994:	48 83 c3 28          	add    $0x28,%rbx
+  802998:	4d 3b 65 00          	cmp    0x0(%r13),%r12
+  80299c:	73 26                	jae    8029c4 <region_flush+0x90>
+        struct RegionOp *op = &region_queue[i];
+        if (op->type == REGION_UNMAP && !op->dstenv)
+  80299e:	83 3b 02             	cmpl   $0x2,(%rbx)
+  8029a1:	75 ed                	jne    802990 <region_flush+0x5c>
+  8029a3:	83 7b 0c 00          	cmpl   $0x0,0xc(%rbx)
+  8029a7:	75 e7                	jne    802990 <region_flush+0x5c>
+            sys_unmap_region(0, (void *)op->dstva, op->size);
+  8029a9:	48 8b 53 20          	mov    0x20(%rbx),%rdx
+  8029ad:	48 8b 73 18          	mov    0x18(%rbx),%rsi
+  8029b1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8029b6:	48 b8 c5 18 80 00 00 	movabs $0x8018c5,%rax
+  8029bd:	00 00 00 
+  8029c0:	ff d0                	call   *%rax
+  8029c2:	eb cc                	jmp    802990 <region_flush+0x5c>
+    }
+    region_queued = 0;
+  8029c4:	48 b8 20 80 80 00 00 	movabs $0x808020,%rax
+  8029cb:	00 00 00 
+  8029ce:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+    return res;
+}
+  8029d5:	44 89 f0             	mov    %r14d,%eax
+  8029d8:	5b                   	pop    %rbx
+  8029d9:	41 5c                	pop    %r12
+  8029db:	41 5d                	pop    %r13
+  8029dd:	41 5e                	pop    %r14
+  8029df:	5d                   	pop    %rbp
+  8029e0:	c3                   	ret
+
+00000000008029e1 <region_queue_op>:
+
+static int
+region_queue_op(int type, envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8029e1:	55                   	push   %rbp
+  8029e2:	48 89 e5             	mov    %rsp,%rbp
+  8029e5:	41 57                	push   %r15
+  8029e7:	41 56                	push   %r14
+  8029e9:	41 55                	push   %r13
+  8029eb:	41 54                	push   %r12
+  8029ed:	53                   	push   %rbx
+  8029ee:	48 83 ec 18          	sub    $0x18,%rsp
+  8029f2:	41 89 ff             	mov    %edi,%r15d
+  8029f5:	41 89 f6             	mov    %esi,%r14d
+  8029f8:	49 89 d4             	mov    %rdx,%r12
+  8029fb:	41 89 cd             	mov    %ecx,%r13d
+  8029fe:	4c 89 c3             	mov    %r8,%rbx
+  802a01:	4c 89 4d c8          	mov    %r9,-0x38(%rbp)
+    int res = region_queued == REGION_BATCH_MAX ? region_flush() : 0;
+  802a05:	bf 00 00 00 00       	mov    $0x0,%edi
+  802a0a:	48 b8 20 80 80 00 00 	movabs $0x808020,%rax
+  802a11:	00 00 00 
+  802a14:	48 83 38 10          	cmpq   $0x10,(%rax)
+  802a18:	74 66                	je     802a80 <region_queue_op+0x9f>
+    region_queue[region_queued++] = (struct RegionOp){
+  802a1a:	48 b8 20 80 80 00 00 	movabs $0x808020,%rax
+  802a21:	00 00 00 
+  802a24:	48 8b 08             	mov    (%rax),%rcx
+  802a27:	48 8d 51 01          	lea    0x1(%rcx),%rdx
+  802a2b:	48 89 10             	mov    %rdx,(%rax)
+  802a2e:	48 be 40 80 80 00 00 	movabs $0x808040,%rsi
+  802a35:	00 00 00 
+  802a38:	48 8d 14 8d 00 00 00 	lea    0x0(,%rcx,4),%rdx
+  802a3f:	00 
+  802a40:	48 8d 04 0a          	lea    (%rdx,%rcx,1),%rax
+  802a44:	48 8d 04 c6          	lea    (%rsi,%rax,8),%rax
+  802a48:	44 89 38             	mov    %r15d,(%rax)
+  802a4b:	44 8b 45 10          	mov    0x10(%rbp),%r8d
+  802a4f:	44 89 40 04          	mov    %r8d,0x4(%rax)
+  802a53:	44 89 70 08          	mov    %r14d,0x8(%rax)
+  802a57:	44 89 68 0c          	mov    %r13d,0xc(%rax)
+  802a5b:	4c 89 60 10          	mov    %r12,0x10(%rax)
+  802a5f:	48 89 58 18          	mov    %rbx,0x18(%rax)
+  802a63:	48 01 ca             	add    %rcx,%rdx
+  802a66:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802a6a:	48 89 44 d6 20       	mov    %rax,0x20(%rsi,%rdx,8)
+            .srcva = (uintptr_t)srcva,
+            .dstva = (uintptr_t)dstva,
+            .size = size,
+    };
+    return res;
+}
+  802a6f:	89 f8                	mov    %edi,%eax
+  802a71:	48 83 c4 18          	add    $0x18,%rsp
+  802a75:	5b                   	pop    %rbx
+  802a76:	41 5c                	pop    %r12
+  802a78:	41 5d                	pop    %r13
+  802a7a:	41 5e                	pop    %r14
+  802a7c:	41 5f                	pop    %r15
+  802a7e:	5d                   	pop    %rbp
+  802a7f:	c3                   	ret
+    int res = region_queued == REGION_BATCH_MAX ? region_flush() : 0;
+  802a80:	48 b8 34 29 80 00 00 	movabs $0x802934,%rax
+  802a87:	00 00 00 
+  802a8a:	ff d0                	call   *%rax
+  802a8c:	89 c7                	mov    %eax,%edi
+  802a8e:	eb 8a                	jmp    802a1a <region_queue_op+0x39>
+
+0000000000802a90 <copy_shared_region>:
+    int unmap = region_queue_op(REGION_UNMAP, 0, NULL, 0, UTEMP, USER_STACK_SIZE, 0);
+    return res < 0 ? res : unmap;
+}
+
+static int
+copy_shared_region(void *start, void *end, void *arg) {
+  802a90:	55                   	push   %rbp
+  802a91:	48 89 e5             	mov    %rsp,%rbp
+  802a94:	41 55                	push   %r13
+  802a96:	41 54                	push   %r12
+  802a98:	53                   	push   %rbx
+  802a99:	48 83 ec 08          	sub    $0x8,%rsp
+  802a9d:	48 89 fb             	mov    %rdi,%rbx
+  802aa0:	49 89 f4             	mov    %rsi,%r12
+    envid_t child = *(envid_t *)arg;
+  802aa3:	44 8b 2a             	mov    (%rdx),%r13d
+    return region_queue_op(REGION_MAP, 0, start, child, start, end - start, get_prot(start));
+  802aa6:	48 b8 98 39 80 00 00 	movabs $0x803998,%rax
+  802aad:	00 00 00 
+  802ab0:	ff d0                	call   *%rax
+  802ab2:	48 83 ec 08          	sub    $0x8,%rsp
+  802ab6:	50                   	push   %rax
+  802ab7:	4d 89 e1             	mov    %r12,%r9
+  802aba:	49 29 d9             	sub    %rbx,%r9
+  802abd:	49 89 d8             	mov    %rbx,%r8
+  802ac0:	44 89 e9             	mov    %r13d,%ecx
+  802ac3:	48 89 da             	mov    %rbx,%rdx
+  802ac6:	be 00 00 00 00       	mov    $0x0,%esi
+  802acb:	bf 01 00 00 00       	mov    $0x1,%edi
+  802ad0:	48 b8 e1 29 80 00 00 	movabs $0x8029e1,%rax
+  802ad7:	00 00 00 
+  802ada:	ff d0                	call   *%rax
+}
+  802adc:	48 8d 65 e8          	lea    -0x18(%rbp),%rsp
+  802ae0:	5b                   	pop    %rbx
+  802ae1:	41 5c                	pop    %r12
+  802ae3:	41 5d                	pop    %r13
+  802ae5:	5d                   	pop    %rbp
+  802ae6:	c3                   	ret
+
+0000000000802ae7 <spawn>:
+spawn(const char *prog, const char **argv) {
+  802ae7:	55                   	push   %rbp
+  802ae8:	48 89 e5             	mov    %rsp,%rbp
+  802aeb:	41 57                	push   %r15
+  802aed:	41 56                	push   %r14
+  802aef:	41 55                	push   %r13
+  802af1:	41 54                	push   %r12
+  802af3:	53                   	push   %rbx
+  802af4:	48 81 ec 08 03 00 00 	sub    $0x308,%rsp
+  802afb:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(prog, O_RDONLY);
+  802afe:	be 00 00 00 00       	mov    $0x0,%esi
+  802b03:	48 b8 5c 28 80 00 00 	movabs $0x80285c,%rax
+  802b0a:	00 00 00 
+  802b0d:	ff d0                	call   *%rax
+  802b0f:	89 85 fc fc ff ff    	mov    %eax,-0x304(%rbp)
+    if (fd < 0) return fd;
+  802b15:	85 c0                	test   %eax,%eax
+  802b17:	0f 88 08 07 00 00    	js     803225 <spawn+0x73e>
+  802b1d:	89 c7                	mov    %eax,%edi
+    res = readn(fd, elf_buf, sizeof(elf_buf));
+  802b1f:	ba 00 02 00 00       	mov    $0x200,%edx
+  802b24:	48 8d b5 d0 fd ff ff 	lea    -0x230(%rbp),%rsi
+  802b2b:	48 b8 fa 21 80 00 00 	movabs $0x8021fa,%rax
+  802b32:	00 00 00 
+  802b35:	ff d0                	call   *%rax
+  802b37:	89 c6                	mov    %eax,%esi
+    if (res != sizeof(elf_buf)) {
+  802b39:	3d 00 02 00 00       	cmp    $0x200,%eax
+  802b3e:	0f 85 d2 02 00 00    	jne    802e16 <spawn+0x32f>
+        elf->e_elf[1] != 1 /* little endian */ ||
+  802b44:	48 b8 ff ff ff ff ff 	movabs $0xffffffffffffff,%rax
+  802b4b:	ff ff 00 
+  802b4e:	48 23 85 d0 fd ff ff 	and    -0x230(%rbp),%rax
+    if (elf->e_magic != ELF_MAGIC ||
+  802b55:	48 ba 7f 45 4c 46 02 	movabs $0x10102464c457f,%rdx
+  802b5c:	01 01 00 
+  802b5f:	48 39 d0             	cmp    %rdx,%rax
+  802b62:	0f 85 ea 02 00 00    	jne    802e52 <spawn+0x36b>
+        elf->e_type != ET_EXEC /* executable */ ||
+  802b68:	81 bd e0 fd ff ff 02 	cmpl   $0x3e0002,-0x220(%rbp)
+  802b6f:	00 3e 00 
+  802b72:	0f 85 da 02 00 00    	jne    802e52 <spawn+0x36b>
+  802b78:	b8 08 00 00 00       	mov    $0x8,%eax
+  802b7d:	cd 30                	int    $0x30
+  802b7f:	89 85 f0 fc ff ff    	mov    %eax,-0x310(%rbp)
+  802b85:	89 c3                	mov    %eax,%ebx
+    if ((int)(res = sys_exofork()) < 0) goto error2;
+  802b87:	85 c0                	test   %eax,%eax
+  802b89:	0f 88 7e 06 00 00    	js     80320d <spawn+0x726>
+    envid_t child = res;
+  802b8f:	89 85 cc fd ff ff    	mov    %eax,-0x234(%rbp)
+    struct Trapframe child_tf = envs[ENVX(child)].env_tf;
+  802b95:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802b9a:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+  802ba1:	48 be 00 00 c0 1f 80 	movabs $0x801fc00000,%rsi
+  802ba8:	00 00 00 
+  802bab:	48 01 c6             	add    %rax,%rsi
+  802bae:	48 8b 06             	mov    (%rsi),%rax
+  802bb1:	48 89 85 0c fd ff ff 	mov    %rax,-0x2f4(%rbp)
+  802bb8:	48 8b 86 b8 00 00 00 	mov    0xb8(%rsi),%rax
+  802bbf:	48 89 85 c4 fd ff ff 	mov    %rax,-0x23c(%rbp)
+  802bc6:	48 8d bd 10 fd ff ff 	lea    -0x2f0(%rbp),%rdi
+  802bcd:	48 c7 c1 fc ff ff ff 	mov    $0xfffffffffffffffc,%rcx
+  802bd4:	48 29 ce             	sub    %rcx,%rsi
+  802bd7:	81 c1 c0 00 00 00    	add    $0xc0,%ecx
+  802bdd:	c1 e9 03             	shr    $0x3,%ecx
+  802be0:	89 c9                	mov    %ecx,%ecx
+  802be2:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+    child_tf.tf_rip = elf->e_entry;
+  802be5:	48 8b 85 e8 fd ff ff 	mov    -0x218(%rbp),%rax
+  802bec:	48 89 85 a4 fd ff ff 	mov    %rax,-0x25c(%rbp)
+    for (argc = 0; argv[argc] != 0; argc++)
+  802bf3:	49 8b 3c 24          	mov    (%r12),%rdi
+  802bf7:	48 85 ff             	test   %rdi,%rdi
+  802bfa:	0f 84 99 02 00 00    	je     802e99 <spawn+0x3b2>
+  802c00:	41 bd 01 00 00 00    	mov    $0x1,%r13d
+    string_size = 0;
+  802c06:	41 be 00 00 00 00    	mov    $0x0,%r14d
+        string_size += strlen(argv[argc]) + 1;
+  802c0c:	49 bf 0b 12 80 00 00 	movabs $0x80120b,%r15
+  802c13:	00 00 00 
+  802c16:	41 ff d7             	call   *%r15
+  802c19:	4a 8d 1c 30          	lea    (%rax,%r14,1),%rbx
+  802c1d:	4c 8d 73 01          	lea    0x1(%rbx),%r14
+    for (argc = 0; argv[argc] != 0; argc++)
+  802c21:	4c 89 e8             	mov    %r13,%rax
+  802c24:	49 83 c5 01          	add    $0x1,%r13
+  802c28:	4b 8b 7c ec f8       	mov    -0x8(%r12,%r13,8),%rdi
+  802c2d:	48 85 ff             	test   %rdi,%rdi
+  802c30:	75 e4                	jne    802c16 <spawn+0x12f>
+    string_store = (char *)UTEMP + USER_STACK_SIZE - string_size;
+  802c32:	48 89 c2             	mov    %rax,%rdx
+  802c35:	48 89 85 e8 fc ff ff 	mov    %rax,-0x318(%rbp)
+  802c3c:	48 f7 d3             	not    %rbx
+  802c3f:	48 81 c3 00 00 41 00 	add    $0x410000,%rbx
+    argv_store = (uintptr_t *)(ROUNDDOWN(string_store, sizeof(uintptr_t)) - sizeof(uintptr_t) * (argc + 1));
+  802c46:	48 89 d9             	mov    %rbx,%rcx
+  802c49:	48 83 e1 f8          	and    $0xfffffffffffffff8,%rcx
+  802c4d:	48 89 8d e0 fc ff ff 	mov    %rcx,-0x320(%rbp)
+  802c54:	83 c0 01             	add    $0x1,%eax
+  802c57:	48 98                	cltq
+  802c59:	48 c1 e0 03          	shl    $0x3,%rax
+  802c5d:	48 29 c1             	sub    %rax,%rcx
+  802c60:	49 89 cf             	mov    %rcx,%r15
+    if ((void *)(argv_store - 2) < (void *)UTEMP) return -E_NO_MEM;
+  802c63:	48 8d 41 f0          	lea    -0x10(%rcx),%rax
+  802c67:	48 3d ff ff 3f 00    	cmp    $0x3fffff,%rax
+  802c6d:	0f 86 73 05 00 00    	jbe    8031e6 <spawn+0x6ff>
+    for (argc = 0; argv[argc] != 0; argc++)
+  802c73:	41 89 d6             	mov    %edx,%r14d
+    if ((res = region_queue_op(REGION_ALLOC, 0, NULL, 0, UTEMP, USER_STACK_SIZE, PROT_RW)) < 0 ||
+  802c76:	48 83 ec 08          	sub    $0x8,%rsp
+  802c7a:	6a 06                	push   $0x6
+  802c7c:	41 b9 00 00 01 00    	mov    $0x10000,%r9d
+  802c82:	41 b8 00 00 40 00    	mov    $0x400000,%r8d
+  802c88:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802c8d:	ba 00 00 00 00       	mov    $0x0,%edx
+  802c92:	be 00 00 00 00       	mov    $0x0,%esi
+  802c97:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c9c:	48 b8 e1 29 80 00 00 	movabs $0x8029e1,%rax
+  802ca3:	00 00 00 
+  802ca6:	ff d0                	call   *%rax
+  802ca8:	41 89 c5             	mov    %eax,%r13d
+  802cab:	48 83 c4 10          	add    $0x10,%rsp
+  802caf:	85 c0                	test   %eax,%eax
+  802cb1:	0f 88 35 05 00 00    	js     8031ec <spawn+0x705>
+        (res = region_flush()) < 0) return res;
+  802cb7:	48 b8 34 29 80 00 00 	movabs $0x802934,%rax
+  802cbe:	00 00 00 
+  802cc1:	ff d0                	call   *%rax
+  802cc3:	41 89 c5             	mov    %eax,%r13d
+    if ((res = region_queue_op(REGION_ALLOC, 0, NULL, 0, UTEMP, USER_STACK_SIZE, PROT_RW)) < 0 ||
+  802cc6:	85 c0                	test   %eax,%eax
+  802cc8:	0f 88 1e 05 00 00    	js     8031ec <spawn+0x705>
+    for (i = 0; i < argc; i++) {
+  802cce:	45 85 f6             	test   %r14d,%r14d
+  802cd1:	7e 55                	jle    802d28 <spawn+0x241>
+  802cd3:	4d 89 fd             	mov    %r15,%r13
+  802cd6:	4d 63 f6             	movslq %r14d,%r14
+  802cd9:	4f 8d 34 f7          	lea    (%r15,%r14,8),%r14
+        argv_store[i] = UTEMP2USTACK(string_store);
+  802cdd:	48 b8 00 70 fe ff 7f 	movabs $0x7ffffe7000,%rax
+  802ce4:	00 00 00 
+  802ce7:	48 8d 84 03 00 00 c0 	lea    -0x400000(%rbx,%rax,1),%rax
+  802cee:	ff 
+  802cef:	49 89 45 00          	mov    %rax,0x0(%r13)
+        strcpy(string_store, argv[i]);
+  802cf3:	49 8b 34 24          	mov    (%r12),%rsi
+  802cf7:	48 89 df             	mov    %rbx,%rdi
+  802cfa:	48 b8 49 12 80 00 00 	movabs $0x801249,%rax
+  802d01:	00 00 00 
+  802d04:	ff d0                	call   *%rax
+        string_store += strlen(argv[i]) + 1;
+  802d06:	49 8b 3c 24          	mov    (%r12),%rdi
+  802d0a:	48 b8 0b 12 80 00 00 	movabs $0x80120b,%rax
+  802d11:	00 00 00 
+  802d14:	ff d0                	call   *%rax
+  802d16:	48 8d 5c 03 01       	lea    0x1(%rbx,%rax,1),%rbx
+    for (i = 0; i < argc; i++) {
+  802d1b:	49 83 c5 08          	add    $0x8,%r13
+  802d1f:	49 83 c4 08          	add    $0x8,%r12
+  802d23:	4d 39 f5             	cmp    %r14,%r13
+  802d26:	75 b5                	jne    802cdd <spawn+0x1f6>
+    argv_store[argc] = 0;
+  802d28:	48 8b 85 e0 fc ff ff 	mov    -0x320(%rbp),%rax
+  802d2f:	48 c7 40 f8 00 00 00 	movq   $0x0,-0x8(%rax)
+  802d36:	00 
+    assert(string_store == (char *)UTEMP + USER_STACK_SIZE);
+  802d37:	48 81 fb 00 00 41 00 	cmp    $0x410000,%rbx
+  802d3e:	0f 85 81 01 00 00    	jne    802ec5 <spawn+0x3de>
+    argv_store[-1] = UTEMP2USTACK(argv_store);
+  802d44:	49 b8 00 70 fe ff 7f 	movabs $0x7ffffe7000,%r8
+  802d4b:	00 00 00 
+  802d4e:	4b 8d 84 07 00 00 c0 	lea    -0x400000(%r15,%r8,1),%rax
+  802d55:	ff 
+  802d56:	49 89 47 f8          	mov    %rax,-0x8(%r15)
+    argv_store[-2] = argc;
+  802d5a:	48 8b 85 e8 fc ff ff 	mov    -0x318(%rbp),%rax
+  802d61:	49 89 47 f0          	mov    %rax,-0x10(%r15)
+    tf->tf_rsp = UTEMP2USTACK(&argv_store[-2]);
+  802d65:	48 b8 f0 6f fe ff 7f 	movabs $0x7ffffe6ff0,%rax
+  802d6c:	00 00 00 
+  802d6f:	49 8d 84 07 00 00 c0 	lea    -0x400000(%r15,%rax,1),%rax
+  802d76:	ff 
+  802d77:	48 89 85 bc fd ff ff 	mov    %rax,-0x244(%rbp)
+    res = region_queue_op(REGION_MAP, 0, UTEMP, child, (void *)(USER_STACK_TOP - USER_STACK_SIZE),
+  802d7e:	48 83 ec 08          	sub    $0x8,%rsp
+  802d82:	6a 06                	push   $0x6
+  802d84:	41 b9 00 00 01 00    	mov    $0x10000,%r9d
+  802d8a:	8b 8d f0 fc ff ff    	mov    -0x310(%rbp),%ecx
+  802d90:	ba 00 00 40 00       	mov    $0x400000,%edx
+  802d95:	be 00 00 00 00       	mov    $0x0,%esi
+  802d9a:	bf 01 00 00 00       	mov    $0x1,%edi
+  802d9f:	48 bb e1 29 80 00 00 	movabs $0x8029e1,%rbx
+  802da6:	00 00 00 
+  802da9:	ff d3                	call   *%rbx
+  802dab:	41 89 c5             	mov    %eax,%r13d
+    int unmap = region_queue_op(REGION_UNMAP, 0, NULL, 0, UTEMP, USER_STACK_SIZE, 0);
+  802dae:	c7 04 24 00 00 00 00 	movl   $0x0,(%rsp)
+  802db5:	41 b9 00 00 01 00    	mov    $0x10000,%r9d
+  802dbb:	41 b8 00 00 40 00    	mov    $0x400000,%r8d
+  802dc1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802dc6:	ba 00 00 00 00       	mov    $0x0,%edx
+  802dcb:	be 00 00 00 00       	mov    $0x0,%esi
+  802dd0:	bf 02 00 00 00       	mov    $0x2,%edi
+  802dd5:	ff d3                	call   *%rbx
+  802dd7:	89 c3                	mov    %eax,%ebx
+    return res < 0 ? res : unmap;
+  802dd9:	48 83 c4 10          	add    $0x10,%rsp
+  802ddd:	45 85 ed             	test   %r13d,%r13d
+  802de0:	0f 88 06 04 00 00    	js     8031ec <spawn+0x705>
+    if ((res = init_stack(child, argv, &child_tf)) < 0) goto error;
+  802de6:	85 c0                	test   %eax,%eax
+  802de8:	0f 88 01 04 00 00    	js     8031ef <spawn+0x708>
+    struct Proghdr *ph = (struct Proghdr *)(elf_buf + elf->e_phoff);
+  802dee:	48 8b 85 f0 fd ff ff 	mov    -0x210(%rbp),%rax
+  802df5:	4c 8d ac 05 d0 fd ff 	lea    -0x230(%rbp,%rax,1),%r13
+  802dfc:	ff 
+    for (size_t i = 0; i < elf->e_phnum; i++, ph++) {
+  802dfd:	66 83 bd 08 fe ff ff 	cmpw   $0x0,-0x1f8(%rbp)
+  802e04:	00 
+  802e05:	0f 84 c8 02 00 00    	je     8030d3 <spawn+0x5ec>
+  802e0b:	41 be 00 00 00 00    	mov    $0x0,%r14d
+  802e11:	e9 63 01 00 00       	jmp    802f79 <spawn+0x492>
+        cprintf("Wrong ELF header size or read error: %i\n", res);
+  802e16:	48 bf 40 45 80 00 00 	movabs $0x804540,%rdi
+  802e1d:	00 00 00 
+  802e20:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e25:	48 ba 24 09 80 00 00 	movabs $0x800924,%rdx
+  802e2c:	00 00 00 
+  802e2f:	ff d2                	call   *%rdx
+        close(fd);
+  802e31:	8b bd fc fc ff ff    	mov    -0x304(%rbp),%edi
+  802e37:	48 b8 be 1f 80 00 00 	movabs $0x801fbe,%rax
+  802e3e:	00 00 00 
+  802e41:	ff d0                	call   *%rax
+        return -E_NOT_EXEC;
+  802e43:	c7 85 fc fc ff ff ee 	movl   $0xffffffee,-0x304(%rbp)
+  802e4a:	ff ff ff 
+  802e4d:	e9 d3 03 00 00       	jmp    803225 <spawn+0x73e>
+        cprintf("Elf magic %08x want %08x\n", elf->e_magic, ELF_MAGIC);
+  802e52:	ba 7f 45 4c 46       	mov    $0x464c457f,%edx
+  802e57:	8b b5 d0 fd ff ff    	mov    -0x230(%rbp),%esi
+  802e5d:	48 bf a0 45 80 00 00 	movabs $0x8045a0,%rdi
+  802e64:	00 00 00 
+  802e67:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e6c:	48 b9 24 09 80 00 00 	movabs $0x800924,%rcx
+  802e73:	00 00 00 
+  802e76:	ff d1                	call   *%rcx
+        close(fd);
+  802e78:	8b bd fc fc ff ff    	mov    -0x304(%rbp),%edi
+  802e7e:	48 b8 be 1f 80 00 00 	movabs $0x801fbe,%rax
+  802e85:	00 00 00 
+  802e88:	ff d0                	call   *%rax
+        return -E_NOT_EXEC;
+  802e8a:	c7 85 fc fc ff ff ee 	movl   $0xffffffee,-0x304(%rbp)
+  802e91:	ff ff ff 
+  802e94:	e9 8c 03 00 00       	jmp    803225 <spawn+0x73e>
+    for (argc = 0; argv[argc] != 0; argc++)
+  802e99:	48 c7 85 e8 fc ff ff 	movq   $0x0,-0x318(%rbp)
+  802ea0:	00 00 00 00 
+  802ea4:	41 be 00 00 00 00    	mov    $0x0,%r14d
+    argv_store = (uintptr_t *)(ROUNDDOWN(string_store, sizeof(uintptr_t)) - sizeof(uintptr_t) * (argc + 1));
+  802eaa:	41 bf f8 ff 40 00    	mov    $0x40fff8,%r15d
+  802eb0:	48 c7 85 e0 fc ff ff 	movq   $0x410000,-0x320(%rbp)
+  802eb7:	00 00 41 00 
+    string_store = (char *)UTEMP + USER_STACK_SIZE - string_size;
+  802ebb:	bb 00 00 41 00       	mov    $0x410000,%ebx
+  802ec0:	e9 b1 fd ff ff       	jmp    802c76 <spawn+0x18f>
+    assert(string_store == (char *)UTEMP + USER_STACK_SIZE);
+  802ec5:	48 b9 70 45 80 00 00 	movabs $0x804570,%rcx
+  802ecc:	00 00 00 
+  802ecf:	48 ba ba 45 80 00 00 	movabs $0x8045ba,%rdx
+  802ed6:	00 00 00 
+  802ed9:	be 16 01 00 00       	mov    $0x116,%esi
+  802ede:	48 bf cf 45 80 00 00 	movabs $0x8045cf,%rdi
+  802ee5:	00 00 00 
+  802ee8:	b8 00 00 00 00       	mov    $0x0,%eax
+  802eed:	49 b8 d4 07 80 00 00 	movabs $0x8007d4,%r8
+  802ef4:	00 00 00 
+  802ef7:	41 ff d0             	call   *%r8
+    }
+    res = readn(fd, UTEMP, filesz);
+    if (res < 0) {
+        goto cleanup;
+    }
+    res = region_queue_op(REGION_MAP, 0, UTEMP, child, (void *)va, memsz, perm);
+  802efa:	48 83 ec 08          	sub    $0x8,%rsp
+  802efe:	41 54                	push   %r12
+  802f00:	4d 89 f9             	mov    %r15,%r9
+  802f03:	4c 8b 85 f0 fc ff ff 	mov    -0x310(%rbp),%r8
+  802f0a:	8b 8d e8 fc ff ff    	mov    -0x318(%rbp),%ecx
+  802f10:	ba 00 00 40 00       	mov    $0x400000,%edx
+  802f15:	be 00 00 00 00       	mov    $0x0,%esi
+  802f1a:	bf 01 00 00 00       	mov    $0x1,%edi
+  802f1f:	49 bc e1 29 80 00 00 	movabs $0x8029e1,%r12
+  802f26:	00 00 00 
+  802f29:	41 ff d4             	call   *%r12
+  802f2c:	89 c3                	mov    %eax,%ebx
+    if (res < 0) {
+        goto cleanup;
+    }
+cleanup:
+    region_queue_op(REGION_UNMAP, 0, NULL, 0, UTEMP, memsz, 0);
+  802f2e:	c7 04 24 00 00 00 00 	movl   $0x0,(%rsp)
+  802f35:	4d 89 f9             	mov    %r15,%r9
+  802f38:	41 b8 00 00 40 00    	mov    $0x400000,%r8d
+  802f3e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802f43:	ba 00 00 00 00       	mov    $0x0,%edx
+  802f48:	be 00 00 00 00       	mov    $0x0,%esi
+  802f4d:	bf 02 00 00 00       	mov    $0x2,%edi
+  802f52:	41 ff d4             	call   *%r12
+        if ((res = map_segment(child, ph->p_va, ph->p_memsz,
+  802f55:	48 83 c4 10          	add    $0x10,%rsp
+  802f59:	85 db                	test   %ebx,%ebx
+  802f5b:	0f 88 8e 02 00 00    	js     8031ef <spawn+0x708>
+    for (size_t i = 0; i < elf->e_phnum; i++, ph++) {
+  802f61:	49 83 c6 01          	add    $0x1,%r14
+  802f65:	49 83 c5 38          	add    $0x38,%r13
+  802f69:	0f b7 85 08 fe ff ff 	movzwl -0x1f8(%rbp),%eax
+  802f70:	49 39 c6             	cmp    %rax,%r14
+  802f73:	0f 83 5a 01 00 00    	jae    8030d3 <spawn+0x5ec>
+        if (ph->p_type != ELF_PROG_LOAD) continue;
+  802f79:	41 83 7d 00 01       	cmpl   $0x1,0x0(%r13)
+  802f7e:	75 e1                	jne    802f61 <spawn+0x47a>
+        if (ph->p_flags & ELF_PROG_FLAG_WRITE) perm |= PROT_W;
+  802f80:	41 8b 45 04          	mov    0x4(%r13),%eax
+  802f84:	41 89 c4             	mov    %eax,%r12d
+  802f87:	41 83 e4 02          	and    $0x2,%r12d
+        if (ph->p_flags & ELF_PROG_FLAG_READ) perm |= PROT_R;
+  802f8b:	44 89 e2             	mov    %r12d,%edx
+  802f8e:	83 ca 04             	or     $0x4,%edx
+  802f91:	a8 04                	test   $0x4,%al
+  802f93:	44 0f 45 e2          	cmovne %edx,%r12d
+        if (ph->p_flags & ELF_PROG_FLAG_EXEC) perm |= PROT_X;
+  802f97:	44 89 e2             	mov    %r12d,%edx
+  802f9a:	83 ca 01             	or     $0x1,%edx
+  802f9d:	a8 01                	test   $0x1,%al
+  802f9f:	44 0f 45 e2          	cmovne %edx,%r12d
+        if ((res = map_segment(child, ph->p_va, ph->p_memsz,
+  802fa3:	49 8b 45 08          	mov    0x8(%r13),%rax
+  802fa7:	89 85 e0 fc ff ff    	mov    %eax,-0x320(%rbp)
+  802fad:	49 8b 5d 20          	mov    0x20(%r13),%rbx
+  802fb1:	48 89 9d d8 fc ff ff 	mov    %rbx,-0x328(%rbp)
+  802fb8:	4d 8b 7d 28          	mov    0x28(%r13),%r15
+  802fbc:	49 8b 75 10          	mov    0x10(%r13),%rsi
+  802fc0:	48 89 b5 f0 fc ff ff 	mov    %rsi,-0x310(%rbp)
+  802fc7:	8b 8d cc fd ff ff    	mov    -0x234(%rbp),%ecx
+  802fcd:	89 8d e8 fc ff ff    	mov    %ecx,-0x318(%rbp)
+    if (res) {
+  802fd3:	89 f2                	mov    %esi,%edx
+  802fd5:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  802fdb:	74 22                	je     802fff <spawn+0x518>
+        va -= res;
+  802fdd:	48 63 ca             	movslq %edx,%rcx
+  802fe0:	48 29 ce             	sub    %rcx,%rsi
+  802fe3:	48 89 b5 f0 fc ff ff 	mov    %rsi,-0x310(%rbp)
+        memsz += res;
+  802fea:	49 01 cf             	add    %rcx,%r15
+        filesz += res;
+  802fed:	48 01 cb             	add    %rcx,%rbx
+  802ff0:	48 89 9d d8 fc ff ff 	mov    %rbx,-0x328(%rbp)
+        fileoffset -= res;
+  802ff7:	29 d0                	sub    %edx,%eax
+  802ff9:	89 85 e0 fc ff ff    	mov    %eax,-0x320(%rbp)
+    res = region_queue_op(REGION_ALLOC, 0, NULL, 0, UTEMP, memsz, PROT_RW | PROT_X | ALLOC_ZERO);
+  802fff:	48 83 ec 08          	sub    $0x8,%rsp
+  803003:	68 07 00 10 00       	push   $0x100007
+  803008:	4d 89 f9             	mov    %r15,%r9
+  80300b:	41 b8 00 00 40 00    	mov    $0x400000,%r8d
+  803011:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803016:	ba 00 00 00 00       	mov    $0x0,%edx
+  80301b:	be 00 00 00 00       	mov    $0x0,%esi
+  803020:	bf 00 00 00 00       	mov    $0x0,%edi
+  803025:	48 b8 e1 29 80 00 00 	movabs $0x8029e1,%rax
+  80302c:	00 00 00 
+  80302f:	ff d0                	call   *%rax
+  803031:	89 c3                	mov    %eax,%ebx
+    if (res < 0 || (res = region_flush()) < 0) {
+  803033:	48 83 c4 10          	add    $0x10,%rsp
+  803037:	85 c0                	test   %eax,%eax
+  803039:	0f 88 b0 01 00 00    	js     8031ef <spawn+0x708>
+  80303f:	48 b9 34 29 80 00 00 	movabs $0x802934,%rcx
+  803046:	00 00 00 
+  803049:	ff d1                	call   *%rcx
+  80304b:	89 c3                	mov    %eax,%ebx
+  80304d:	85 c0                	test   %eax,%eax
+  80304f:	0f 88 9a 01 00 00    	js     8031ef <spawn+0x708>
+    res = seek(fd, fileoffset);
+  803055:	8b b5 e0 fc ff ff    	mov    -0x320(%rbp),%esi
+  80305b:	8b bd fc fc ff ff    	mov    -0x304(%rbp),%edi
+  803061:	48 b9 24 23 80 00 00 	movabs $0x802324,%rcx
+  803068:	00 00 00 
+  80306b:	ff d1                	call   *%rcx
+  80306d:	89 c3                	mov    %eax,%ebx
+    if (res < 0) {
+  80306f:	85 c0                	test   %eax,%eax
+  803071:	78 28                	js     80309b <spawn+0x5b4>
+    res = readn(fd, UTEMP, filesz);
+  803073:	48 8b 95 d8 fc ff ff 	mov    -0x328(%rbp),%rdx
+  80307a:	be 00 00 40 00       	mov    $0x400000,%esi
+  80307f:	8b bd fc fc ff ff    	mov    -0x304(%rbp),%edi
+  803085:	48 b9 fa 21 80 00 00 	movabs $0x8021fa,%rcx
+  80308c:	00 00 00 
+  80308f:	ff d1                	call   *%rcx
+  803091:	89 c3                	mov    %eax,%ebx
+    if (res < 0) {
+  803093:	85 c0                	test   %eax,%eax
+  803095:	0f 89 5f fe ff ff    	jns    802efa <spawn+0x413>
+    region_queue_op(REGION_UNMAP, 0, NULL, 0, UTEMP, memsz, 0);
+  80309b:	48 83 ec 08          	sub    $0x8,%rsp
+  80309f:	6a 00                	push   $0x0
+  8030a1:	4d 89 f9             	mov    %r15,%r9
+  8030a4:	41 b8 00 00 40 00    	mov    $0x400000,%r8d
+  8030aa:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8030af:	ba 00 00 00 00       	mov    $0x0,%edx
+  8030b4:	be 00 00 00 00       	mov    $0x0,%esi
+  8030b9:	bf 02 00 00 00       	mov    $0x2,%edi
+  8030be:	48 b8 e1 29 80 00 00 	movabs $0x8029e1,%rax
+  8030c5:	00 00 00 
+  8030c8:	ff d0                	call   *%rax
+  8030ca:	48 83 c4 10          	add    $0x10,%rsp
+  8030ce:	e9 1c 01 00 00       	jmp    8031ef <spawn+0x708>
+    close(fd);
+  8030d3:	8b bd fc fc ff ff    	mov    -0x304(%rbp),%edi
+  8030d9:	48 b8 be 1f 80 00 00 	movabs $0x801fbe,%rax
+  8030e0:	00 00 00 
+  8030e3:	ff d0                	call   *%rax
+    if ((res = foreach_shared_region(copy_shared_region, &child)) < 0 ||
+  8030e5:	48 8d b5 cc fd ff ff 	lea    -0x234(%rbp),%rsi
+  8030ec:	48 bf 90 2a 80 00 00 	movabs $0x802a90,%rdi
+  8030f3:	00 00 00 
+  8030f6:	48 b8 0c 3a 80 00 00 	movabs $0x803a0c,%rax
+  8030fd:	00 00 00 
+  803100:	ff d0                	call   *%rax
+  803102:	85 c0                	test   %eax,%eax
+  803104:	78 59                	js     80315f <spawn+0x678>
+        (res = region_flush()) < 0)
+  803106:	48 b8 34 29 80 00 00 	movabs $0x802934,%rax
+  80310d:	00 00 00 
+  803110:	ff d0                	call   *%rax
+    if ((res = foreach_shared_region(copy_shared_region, &child)) < 0 ||
+  803112:	85 c0                	test   %eax,%eax
+  803114:	78 49                	js     80315f <spawn+0x678>
+    if ((res = sys_env_set_trapframe(child, &child_tf)) < 0)
+  803116:	48 8d b5 0c fd ff ff 	lea    -0x2f4(%rbp),%rsi
+  80311d:	8b bd cc fd ff ff    	mov    -0x234(%rbp),%edi
+  803123:	48 b8 cd 1a 80 00 00 	movabs $0x801acd,%rax
+  80312a:	00 00 00 
+  80312d:	ff d0                	call   *%rax
+  80312f:	85 c0                	test   %eax,%eax
+  803131:	78 59                	js     80318c <spawn+0x6a5>
+    if ((res = sys_env_set_status(child, ENV_RUNNABLE)) < 0)
+  803133:	be 02 00 00 00       	mov    $0x2,%esi
+  803138:	8b bd cc fd ff ff    	mov    -0x234(%rbp),%edi
+  80313e:	48 b8 95 19 80 00 00 	movabs $0x801995,%rax
+  803145:	00 00 00 
+  803148:	ff d0                	call   *%rax
+  80314a:	85 c0                	test   %eax,%eax
+  80314c:	78 6b                	js     8031b9 <spawn+0x6d2>
+    return child;
+  80314e:	8b 85 cc fd ff ff    	mov    -0x234(%rbp),%eax
+  803154:	89 85 fc fc ff ff    	mov    %eax,-0x304(%rbp)
+  80315a:	e9 c6 00 00 00       	jmp    803225 <spawn+0x73e>
+        panic("copy_shared_region: %i", res);
+  80315f:	89 c1                	mov    %eax,%ecx
+  803161:	48 ba db 45 80 00 00 	movabs $0x8045db,%rdx
+  803168:	00 00 00 
+  80316b:	be a8 00 00 00       	mov    $0xa8,%esi
+  803170:	48 bf cf 45 80 00 00 	movabs $0x8045cf,%rdi
+  803177:	00 00 00 
+  80317a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80317f:	49 b8 d4 07 80 00 00 	movabs $0x8007d4,%r8
+  803186:	00 00 00 
+  803189:	41 ff d0             	call   *%r8
+        panic("sys_env_set_trapframe: %i", res);
+  80318c:	89 c1                	mov    %eax,%ecx
+  80318e:	48 ba f2 45 80 00 00 	movabs $0x8045f2,%rdx
+  803195:	00 00 00 
+  803198:	be ab 00 00 00       	mov    $0xab,%esi
+  80319d:	48 bf cf 45 80 00 00 	movabs $0x8045cf,%rdi
+  8031a4:	00 00 00 
+  8031a7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8031ac:	49 b8 d4 07 80 00 00 	movabs $0x8007d4,%r8
+  8031b3:	00 00 00 
+  8031b6:	41 ff d0             	call   *%r8
+        panic("sys_env_set_status: %i", res);
+  8031b9:	89 c1                	mov    %eax,%ecx
+  8031bb:	48 ba 0c 46 80 00 00 	movabs $0x80460c,%rdx
+  8031c2:	00 00 00 
+  8031c5:	be ae 00 00 00       	mov    $0xae,%esi
+  8031ca:	48 bf cf 45 80 00 00 	movabs $0x8045cf,%rdi
+  8031d1:	00 00 00 
+  8031d4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8031d9:	49 b8 d4 07 80 00 00 	movabs $0x8007d4,%r8
+  8031e0:	00 00 00 
+  8031e3:	41 ff d0             	call   *%r8
+    if ((void *)(argv_store - 2) < (void *)UTEMP) return -E_NO_MEM;
+  8031e6:	41 bd fc ff ff ff    	mov    $0xfffffffc,%r13d
+    for (size_t i = 0; i < elf->e_phnum; i++, ph++) {
+  8031ec:	44 89 eb             	mov    %r13d,%ebx
+    region_flush();
+  8031ef:	48 b8 34 29 80 00 00 	movabs $0x802934,%rax
+  8031f6:	00 00 00 
+  8031f9:	ff d0                	call   *%rax
+    sys_env_destroy(child);
+  8031fb:	8b bd cc fd ff ff    	mov    -0x234(%rbp),%edi
+  803201:	48 b8 ce 16 80 00 00 	movabs $0x8016ce,%rax
+  803208:	00 00 00 
+  80320b:	ff d0                	call   *%rax
+    close(fd);
+  80320d:	8b bd fc fc ff ff    	mov    -0x304(%rbp),%edi
+  803213:	48 b8 be 1f 80 00 00 	movabs $0x801fbe,%rax
+  80321a:	00 00 00 
+  80321d:	ff d0                	call   *%rax
+    return res;
+  80321f:	89 9d fc fc ff ff    	mov    %ebx,-0x304(%rbp)
+}
+  803225:	8b 85 fc fc ff ff    	mov    -0x304(%rbp),%eax
+  80322b:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  80322f:	5b                   	pop    %rbx
+  803230:	41 5c                	pop    %r12
+  803232:	41 5d                	pop    %r13
+  803234:	41 5e                	pop    %r14
+  803236:	41 5f                	pop    %r15
+  803238:	5d                   	pop    %rbp
+  803239:	c3                   	ret
+
+000000000080323a <spawnl>:
+spawnl(const char *prog, const char *arg0, ...) {
+  80323a:	55                   	push   %rbp
+  80323b:	48 89 e5             	mov    %rsp,%rbp
+  80323e:	48 83 ec 50          	sub    $0x50,%rsp
+  803242:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  803246:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80324a:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80324e:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(vl, arg0);
+  803252:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  803259:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80325d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803261:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  803265:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int argc = 0;
+  803269:	b9 00 00 00 00       	mov    $0x0,%ecx
+    while (va_arg(vl, void *) != NULL) argc++;
+  80326e:	eb 15                	jmp    803285 <spawnl+0x4b>
+  803270:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803274:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803278:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80327c:	48 83 3a 00          	cmpq   $0x0,(%rdx)
+  803280:	74 1c                	je     80329e <spawnl+0x64>
+  803282:	83 c1 01             	add    $0x1,%ecx
+  803285:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803288:	83 f8 2f             	cmp    $0x2f,%eax
+  80328b:	77 e3                	ja     803270 <spawnl+0x36>
+  80328d:	89 c2                	mov    %eax,%edx
+  80328f:	4c 8d 55 d0          	lea    -0x30(%rbp),%r10
+  803293:	4c 01 d2             	add    %r10,%rdx
+  803296:	83 c0 08             	add    $0x8,%eax
+  803299:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80329c:	eb de                	jmp    80327c <spawnl+0x42>
+    const char *argv[argc + 2];
+  80329e:	8d 41 02             	lea    0x2(%rcx),%eax
+  8032a1:	48 98                	cltq
+  8032a3:	48 8d 04 c5 0f 00 00 	lea    0xf(,%rax,8),%rax
+  8032aa:	00 
+  8032ab:	48 83 e0 f0          	and    $0xfffffffffffffff0,%rax
+  8032af:	48 29 c4             	sub    %rax,%rsp
+  8032b2:	4c 8d 44 24 07       	lea    0x7(%rsp),%r8
+  8032b7:	4c 89 c0             	mov    %r8,%rax
+  8032ba:	48 c1 e8 03          	shr    $0x3,%rax
+  8032be:	49 83 e0 f8          	and    $0xfffffffffffffff8,%r8
+    argv[0] = arg0;
+  8032c2:	48 89 34 c5 00 00 00 	mov    %rsi,0x0(,%rax,8)
+  8032c9:	00 
+    argv[argc + 1] = NULL;
+  8032ca:	8d 41 01             	lea    0x1(%rcx),%eax
+  8032cd:	48 98                	cltq
+  8032cf:	49 c7 04 c0 00 00 00 	movq   $0x0,(%r8,%rax,8)
+  8032d6:	00 
+    va_start(vl, arg0);
+  8032d7:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  8032de:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8032e2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8032e6:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8032ea:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    for (i = 0; i < argc; i++) {
+  8032ee:	85 c9                	test   %ecx,%ecx
+  8032f0:	74 41                	je     803333 <spawnl+0xf9>
+        argv[i + 1] = va_arg(vl, const char *);
+  8032f2:	49 89 c1             	mov    %rax,%r9
+  8032f5:	49 8d 40 08          	lea    0x8(%r8),%rax
+  8032f9:	8d 51 ff             	lea    -0x1(%rcx),%edx
+  8032fc:	49 8d 74 d0 10       	lea    0x10(%r8,%rdx,8),%rsi
+  803301:	eb 1b                	jmp    80331e <spawnl+0xe4>
+  803303:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  803307:	48 8d 51 08          	lea    0x8(%rcx),%rdx
+  80330b:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  80330f:	48 8b 11             	mov    (%rcx),%rdx
+  803312:	48 89 10             	mov    %rdx,(%rax)
+    for (i = 0; i < argc; i++) {
+  803315:	48 83 c0 08          	add    $0x8,%rax
+  803319:	48 39 f0             	cmp    %rsi,%rax
+  80331c:	74 15                	je     803333 <spawnl+0xf9>
+        argv[i + 1] = va_arg(vl, const char *);
+  80331e:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  803321:	83 fa 2f             	cmp    $0x2f,%edx
+  803324:	77 dd                	ja     803303 <spawnl+0xc9>
+  803326:	89 d1                	mov    %edx,%ecx
+  803328:	4c 01 c9             	add    %r9,%rcx
+  80332b:	83 c2 08             	add    $0x8,%edx
+  80332e:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  803331:	eb dc                	jmp    80330f <spawnl+0xd5>
+    return spawn(prog, argv);
+  803333:	4c 89 c6             	mov    %r8,%rsi
+  803336:	48 b8 e7 2a 80 00 00 	movabs $0x802ae7,%rax
+  80333d:	00 00 00 
+  803340:	ff d0                	call   *%rax
+}
+  803342:	c9                   	leave
+  803343:	c3                   	ret
+
+0000000000803344 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  803344:	55                   	push   %rbp
+  803345:	48 89 e5             	mov    %rsp,%rbp
+  803348:	41 54                	push   %r12
+  80334a:	53                   	push   %rbx
+  80334b:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80334e:	48 b8 aa 1d 80 00 00 	movabs $0x801daa,%rax
+  803355:	00 00 00 
+  803358:	ff d0                	call   *%rax
+  80335a:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  80335d:	48 be 23 46 80 00 00 	movabs $0x804623,%rsi
+  803364:	00 00 00 
+  803367:	48 89 df             	mov    %rbx,%rdi
+  80336a:	48 b8 49 12 80 00 00 	movabs $0x801249,%rax
+  803371:	00 00 00 
+  803374:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  803376:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  80337b:	41 2b 04 24          	sub    (%r12),%eax
+  80337f:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  803385:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  80338c:	00 00 00 
+    stat->st_dev = &devpipe;
+  80338f:	48 b8 80 50 80 00 00 	movabs $0x805080,%rax
+  803396:	00 00 00 
+  803399:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  8033a0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033a5:	5b                   	pop    %rbx
+  8033a6:	41 5c                	pop    %r12
+  8033a8:	5d                   	pop    %rbp
+  8033a9:	c3                   	ret
+
+00000000008033aa <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  8033aa:	55                   	push   %rbp
+  8033ab:	48 89 e5             	mov    %rsp,%rbp
+  8033ae:	41 54                	push   %r12
+  8033b0:	53                   	push   %rbx
+  8033b1:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8033b4:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8033b9:	48 89 fe             	mov    %rdi,%rsi
+  8033bc:	bf 00 00 00 00       	mov    $0x0,%edi
+  8033c1:	49 bc c5 18 80 00 00 	movabs $0x8018c5,%r12
+  8033c8:	00 00 00 
+  8033cb:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  8033ce:	48 89 df             	mov    %rbx,%rdi
+  8033d1:	48 b8 aa 1d 80 00 00 	movabs $0x801daa,%rax
+  8033d8:	00 00 00 
+  8033db:	ff d0                	call   *%rax
+  8033dd:	48 89 c6             	mov    %rax,%rsi
+  8033e0:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8033e5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8033ea:	41 ff d4             	call   *%r12
+}
+  8033ed:	5b                   	pop    %rbx
+  8033ee:	41 5c                	pop    %r12
+  8033f0:	5d                   	pop    %rbp
+  8033f1:	c3                   	ret
+
+00000000008033f2 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8033f2:	55                   	push   %rbp
+  8033f3:	48 89 e5             	mov    %rsp,%rbp
+  8033f6:	41 57                	push   %r15
+  8033f8:	41 56                	push   %r14
+  8033fa:	41 55                	push   %r13
+  8033fc:	41 54                	push   %r12
+  8033fe:	53                   	push   %rbx
+  8033ff:	48 83 ec 18          	sub    $0x18,%rsp
+  803403:	49 89 fc             	mov    %rdi,%r12
+  803406:	49 89 f5             	mov    %rsi,%r13
+  803409:	49 89 d7             	mov    %rdx,%r15
+  80340c:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803410:	48 b8 aa 1d 80 00 00 	movabs $0x801daa,%rax
+  803417:	00 00 00 
+  80341a:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  80341c:	4d 85 ff             	test   %r15,%r15
+  80341f:	0f 84 af 00 00 00    	je     8034d4 <devpipe_write+0xe2>
+  803425:	48 89 c3             	mov    %rax,%rbx
+  803428:	4c 89 f8             	mov    %r15,%rax
+  80342b:	4d 89 ef             	mov    %r13,%r15
+  80342e:	4c 01 e8             	add    %r13,%rax
+  803431:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803435:	49 bd cd 17 80 00 00 	movabs $0x8017cd,%r13
+  80343c:	00 00 00 
+            sys_yield();
+  80343f:	49 be 6a 17 80 00 00 	movabs $0x80176a,%r14
+  803446:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  803449:	8b 73 04             	mov    0x4(%rbx),%esi
+  80344c:	48 63 ce             	movslq %esi,%rcx
+  80344f:	48 63 03             	movslq (%rbx),%rax
+  803452:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  803458:	48 39 c1             	cmp    %rax,%rcx
+  80345b:	72 2e                	jb     80348b <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80345d:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803462:	48 89 da             	mov    %rbx,%rdx
+  803465:	be 00 10 00 00       	mov    $0x1000,%esi
+  80346a:	4c 89 e7             	mov    %r12,%rdi
+  80346d:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  803470:	85 c0                	test   %eax,%eax
+  803472:	74 66                	je     8034da <devpipe_write+0xe8>
+            sys_yield();
+  803474:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  803477:	8b 73 04             	mov    0x4(%rbx),%esi
+  80347a:	48 63 ce             	movslq %esi,%rcx
+  80347d:	48 63 03             	movslq (%rbx),%rax
+  803480:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  803486:	48 39 c1             	cmp    %rax,%rcx
+  803489:	73 d2                	jae    80345d <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  80348b:	41 0f b6 3f          	movzbl (%r15),%edi
+  80348f:	48 89 ca             	mov    %rcx,%rdx
+  803492:	48 c1 ea 03          	shr    $0x3,%rdx
+  803496:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  80349d:	08 10 20 
+  8034a0:	48 f7 e2             	mul    %rdx
+  8034a3:	48 c1 ea 06          	shr    $0x6,%rdx
+  8034a7:	48 89 d0             	mov    %rdx,%rax
+  8034aa:	48 c1 e0 09          	shl    $0x9,%rax
+  8034ae:	48 29 d0             	sub    %rdx,%rax
+  8034b1:	48 c1 e0 03          	shl    $0x3,%rax
+  8034b5:	48 29 c1             	sub    %rax,%rcx
+  8034b8:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  8034bd:	83 c6 01             	add    $0x1,%esi
+  8034c0:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8034c3:	49 83 c7 01          	add    $0x1,%r15
+  8034c7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8034cb:	49 39 c7             	cmp    %rax,%r15
+  8034ce:	0f 85 75 ff ff ff    	jne    803449 <devpipe_write+0x57>
+    return n;
+  8034d4:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8034d8:	eb 05                	jmp    8034df <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  8034da:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8034df:	48 83 c4 18          	add    $0x18,%rsp
+  8034e3:	5b                   	pop    %rbx
+  8034e4:	41 5c                	pop    %r12
+  8034e6:	41 5d                	pop    %r13
+  8034e8:	41 5e                	pop    %r14
+  8034ea:	41 5f                	pop    %r15
+  8034ec:	5d                   	pop    %rbp
+  8034ed:	c3                   	ret
+
+00000000008034ee <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  8034ee:	55                   	push   %rbp
+  8034ef:	48 89 e5             	mov    %rsp,%rbp
+  8034f2:	41 57                	push   %r15
+  8034f4:	41 56                	push   %r14
+  8034f6:	41 55                	push   %r13
+  8034f8:	41 54                	push   %r12
+  8034fa:	53                   	push   %rbx
+  8034fb:	48 83 ec 18          	sub    $0x18,%rsp
+  8034ff:	49 89 fc             	mov    %rdi,%r12
+  803502:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  803506:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80350a:	48 b8 aa 1d 80 00 00 	movabs $0x801daa,%rax
+  803511:	00 00 00 
+  803514:	ff d0                	call   *%rax
+  803516:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  803519:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80351f:	49 bd cd 17 80 00 00 	movabs $0x8017cd,%r13
+  803526:	00 00 00 
+            sys_yield();
+  803529:	49 be 6a 17 80 00 00 	movabs $0x80176a,%r14
+  803530:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  803533:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  803538:	74 7d                	je     8035b7 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  80353a:	8b 03                	mov    (%rbx),%eax
+  80353c:	3b 43 04             	cmp    0x4(%rbx),%eax
+  80353f:	75 26                	jne    803567 <devpipe_read+0x79>
+            if (i > 0) return i;
+  803541:	4d 85 ff             	test   %r15,%r15
+  803544:	75 77                	jne    8035bd <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803546:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80354b:	48 89 da             	mov    %rbx,%rdx
+  80354e:	be 00 10 00 00       	mov    $0x1000,%esi
+  803553:	4c 89 e7             	mov    %r12,%rdi
+  803556:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  803559:	85 c0                	test   %eax,%eax
+  80355b:	74 72                	je     8035cf <devpipe_read+0xe1>
+            sys_yield();
+  80355d:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  803560:	8b 03                	mov    (%rbx),%eax
+  803562:	3b 43 04             	cmp    0x4(%rbx),%eax
+  803565:	74 df                	je     803546 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  803567:	48 63 c8             	movslq %eax,%rcx
+  80356a:	48 89 ca             	mov    %rcx,%rdx
+  80356d:	48 c1 ea 03          	shr    $0x3,%rdx
+  803571:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  803578:	08 10 20 
+  80357b:	48 89 d0             	mov    %rdx,%rax
+  80357e:	48 f7 e6             	mul    %rsi
+  803581:	48 c1 ea 06          	shr    $0x6,%rdx
+  803585:	48 89 d0             	mov    %rdx,%rax
+  803588:	48 c1 e0 09          	shl    $0x9,%rax
+  80358c:	48 29 d0             	sub    %rdx,%rax
+  80358f:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  803596:	00 
+  803597:	48 89 c8             	mov    %rcx,%rax
+  80359a:	48 29 d0             	sub    %rdx,%rax
+  80359d:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  8035a2:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8035a6:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  8035aa:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8035ad:	49 83 c7 01          	add    $0x1,%r15
+  8035b1:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  8035b5:	75 83                	jne    80353a <devpipe_read+0x4c>
+    return n;
+  8035b7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8035bb:	eb 03                	jmp    8035c0 <devpipe_read+0xd2>
+            if (i > 0) return i;
+  8035bd:	4c 89 f8             	mov    %r15,%rax
+}
+  8035c0:	48 83 c4 18          	add    $0x18,%rsp
+  8035c4:	5b                   	pop    %rbx
+  8035c5:	41 5c                	pop    %r12
+  8035c7:	41 5d                	pop    %r13
+  8035c9:	41 5e                	pop    %r14
+  8035cb:	41 5f                	pop    %r15
+  8035cd:	5d                   	pop    %rbp
+  8035ce:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  8035cf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8035d4:	eb ea                	jmp    8035c0 <devpipe_read+0xd2>
+
+00000000008035d6 <pipe>:
+pipe(int pfd[2]) {
+  8035d6:	55                   	push   %rbp
+  8035d7:	48 89 e5             	mov    %rsp,%rbp
+  8035da:	41 55                	push   %r13
+  8035dc:	41 54                	push   %r12
+  8035de:	53                   	push   %rbx
+  8035df:	48 81 ec b8 00 00 00 	sub    $0xb8,%rsp
+  8035e6:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8035e9:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  8035ed:	48 b8 3f 1e 80 00 00 	movabs $0x801e3f,%rax
+  8035f4:	00 00 00 
+  8035f7:	ff d0                	call   *%rax
+  8035f9:	89 c3                	mov    %eax,%ebx
+  8035fb:	85 c0                	test   %eax,%eax
+  8035fd:	0f 88 51 01 00 00    	js     803754 <pipe+0x17e>
+        (res = fd_alloc_from(fd2num(fd0) + 1, &fd1)) < 0) goto err;
+  803603:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803607:	48 b8 98 1d 80 00 00 	movabs $0x801d98,%rax
+  80360e:	00 00 00 
+  803611:	ff d0                	call   *%rax
+  803613:	8d 78 01             	lea    0x1(%rax),%edi
+  803616:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80361a:	48 b8 c6 1d 80 00 00 	movabs $0x801dc6,%rax
+  803621:	00 00 00 
+  803624:	ff d0                	call   *%rax
+  803626:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803628:	85 c0                	test   %eax,%eax
+  80362a:	0f 88 24 01 00 00    	js     803754 <pipe+0x17e>
+    va = fd2data(fd0);
+  803630:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803634:	48 bb aa 1d 80 00 00 	movabs $0x801daa,%rbx
+  80363b:	00 00 00 
+  80363e:	ff d3                	call   *%rbx
+  803640:	49 89 c5             	mov    %rax,%r13
+    struct RegionOp ops[] = {
+  803643:	48 8d bd 30 ff ff ff 	lea    -0xd0(%rbp),%rdi
+  80364a:	b9 14 00 00 00       	mov    $0x14,%ecx
+  80364f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803654:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+  803657:	c7 85 34 ff ff ff 46 	movl   $0x46,-0xcc(%rbp)
+  80365e:	00 00 00 
+  803661:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803665:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+  80366c:	48 c7 85 50 ff ff ff 	movq   $0x1000,-0xb0(%rbp)
+  803673:	00 10 00 00 
+  803677:	c7 85 5c ff ff ff 46 	movl   $0x46,-0xa4(%rbp)
+  80367e:	00 00 00 
+            {.type = REGION_ALLOC, .dstva = (uintptr_t)fd1, .size = PAGE_SIZE, .perm = PROT_RW | PROT_SHARE},
+  803681:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+    struct RegionOp ops[] = {
+  803685:	48 89 bd 70 ff ff ff 	mov    %rdi,-0x90(%rbp)
+  80368c:	48 c7 85 78 ff ff ff 	movq   $0x1000,-0x88(%rbp)
+  803693:	00 10 00 00 
+  803697:	c7 45 84 46 00 00 00 	movl   $0x46,-0x7c(%rbp)
+  80369e:	4c 89 6d 98          	mov    %r13,-0x68(%rbp)
+  8036a2:	48 c7 45 a0 00 10 00 	movq   $0x1000,-0x60(%rbp)
+  8036a9:	00 
+  8036aa:	c7 45 a8 01 00 00 00 	movl   $0x1,-0x58(%rbp)
+  8036b1:	c7 45 ac 46 00 00 00 	movl   $0x46,-0x54(%rbp)
+  8036b8:	4c 89 6d b8          	mov    %r13,-0x48(%rbp)
+            {.type = REGION_MAP, .srcva = (uintptr_t)va, .dstva = (uintptr_t)fd2data(fd1), .size = PAGE_SIZE, .perm = PROT_RW | PROT_SHARE},
+  8036bc:	ff d3                	call   *%rbx
+    struct RegionOp ops[] = {
+  8036be:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8036c2:	48 c7 45 c8 00 10 00 	movq   $0x1000,-0x38(%rbp)
+  8036c9:	00 
+    if ((res = sys_region_batch(ops, sizeof ops / sizeof *ops)) < 0) goto err1;
+  8036ca:	be 04 00 00 00       	mov    $0x4,%esi
+  8036cf:	48 8d bd 30 ff ff ff 	lea    -0xd0(%rbp),%rdi
+  8036d6:	48 b8 2c 19 80 00 00 	movabs $0x80192c,%rax
+  8036dd:	00 00 00 
+  8036e0:	ff d0                	call   *%rax
+  8036e2:	89 c3                	mov    %eax,%ebx
+  8036e4:	85 c0                	test   %eax,%eax
+  8036e6:	0f 88 ad 00 00 00    	js     803799 <pipe+0x1c3>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8036ec:	be 00 10 00 00       	mov    $0x1000,%esi
+  8036f1:	4c 89 ef             	mov    %r13,%rdi
+  8036f4:	48 b8 9b 17 80 00 00 	movabs $0x80179b,%rax
+  8036fb:	00 00 00 
+  8036fe:	ff d0                	call   *%rax
+  803700:	83 f8 02             	cmp    $0x2,%eax
+  803703:	75 5f                	jne    803764 <pipe+0x18e>
+    fd0->fd_dev_id = devpipe.dev_id;
+  803705:	a1 80 50 80 00 00 00 	movabs 0x805080,%eax
+  80370c:	00 00 
+  80370e:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803712:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  803714:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803718:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  80371f:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  803723:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  803725:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803729:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  803730:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803734:	48 bb 98 1d 80 00 00 	movabs $0x801d98,%rbx
+  80373b:	00 00 00 
+  80373e:	ff d3                	call   *%rbx
+  803740:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  803744:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  803748:	ff d3                	call   *%rbx
+  80374a:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  80374f:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  803754:	89 d8                	mov    %ebx,%eax
+  803756:	48 81 c4 b8 00 00 00 	add    $0xb8,%rsp
+  80375d:	5b                   	pop    %rbx
+  80375e:	41 5c                	pop    %r12
+  803760:	41 5d                	pop    %r13
+  803762:	5d                   	pop    %rbp
+  803763:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803764:	48 b9 40 46 80 00 00 	movabs $0x804640,%rcx
+  80376b:	00 00 00 
+  80376e:	48 ba ba 45 80 00 00 	movabs $0x8045ba,%rdx
+  803775:	00 00 00 
+  803778:	be 33 00 00 00       	mov    $0x33,%esi
+  80377d:	48 bf 2a 46 80 00 00 	movabs $0x80462a,%rdi
+  803784:	00 00 00 
+  803787:	b8 00 00 00 00       	mov    $0x0,%eax
+  80378c:	49 b8 d4 07 80 00 00 	movabs $0x8007d4,%r8
+  803793:	00 00 00 
+  803796:	41 ff d0             	call   *%r8
+        ops[i].type = REGION_UNMAP;
+  803799:	c7 85 30 ff ff ff 02 	movl   $0x2,-0xd0(%rbp)
+  8037a0:	00 00 00 
+  8037a3:	c7 85 58 ff ff ff 02 	movl   $0x2,-0xa8(%rbp)
+  8037aa:	00 00 00 
+  8037ad:	c7 45 80 02 00 00 00 	movl   $0x2,-0x80(%rbp)
+  8037b4:	c7 45 a8 02 00 00 00 	movl   $0x2,-0x58(%rbp)
+    sys_region_batch(ops, sizeof ops / sizeof *ops);
+  8037bb:	be 04 00 00 00       	mov    $0x4,%esi
+  8037c0:	48 8d bd 30 ff ff ff 	lea    -0xd0(%rbp),%rdi
+  8037c7:	48 b8 2c 19 80 00 00 	movabs $0x80192c,%rax
+  8037ce:	00 00 00 
+  8037d1:	ff d0                	call   *%rax
+  8037d3:	e9 7c ff ff ff       	jmp    803754 <pipe+0x17e>
+
+00000000008037d8 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  8037d8:	55                   	push   %rbp
+  8037d9:	48 89 e5             	mov    %rsp,%rbp
+  8037dc:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8037e0:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8037e4:	48 b8 59 1e 80 00 00 	movabs $0x801e59,%rax
+  8037eb:	00 00 00 
+  8037ee:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8037f0:	85 c0                	test   %eax,%eax
+  8037f2:	78 35                	js     803829 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  8037f4:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8037f8:	48 b8 aa 1d 80 00 00 	movabs $0x801daa,%rax
+  8037ff:	00 00 00 
+  803802:	ff d0                	call   *%rax
+  803804:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803807:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80380c:	be 00 10 00 00       	mov    $0x1000,%esi
+  803811:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803815:	48 b8 cd 17 80 00 00 	movabs $0x8017cd,%rax
+  80381c:	00 00 00 
+  80381f:	ff d0                	call   *%rax
+  803821:	85 c0                	test   %eax,%eax
+  803823:	0f 94 c0             	sete   %al
+  803826:	0f b6 c0             	movzbl %al,%eax
+}
+  803829:	c9                   	leave
+  80382a:	c3                   	ret
+
+000000000080382b <wait>:
+#include <inc/lib.h>
+
+/* Waits until 'envid' exits. */
+void
+wait(envid_t envid) {
+  80382b:	55                   	push   %rbp
+  80382c:	48 89 e5             	mov    %rsp,%rbp
+  80382f:	41 55                	push   %r13
+  803831:	41 54                	push   %r12
+  803833:	53                   	push   %rbx
+  803834:	48 83 ec 08          	sub    $0x8,%rsp
+    assert(envid != 0);
+  803838:	85 ff                	test   %edi,%edi
+  80383a:	74 73                	je     8038af <wait+0x84>
+  80383c:	41 89 fc             	mov    %edi,%r12d
+
+    const volatile struct Env *env = &envs[ENVX(envid)];
+  80383f:	89 f8                	mov    %edi,%eax
+  803841:	25 ff 03 00 00       	and    $0x3ff,%eax
+
+    while (env->env_id == envid &&
+  803846:	89 f9                	mov    %edi,%ecx
+  803848:	81 e1 ff 03 00 00    	and    $0x3ff,%ecx
+  80384e:	48 69 c9 d0 01 00 00 	imul   $0x1d0,%rcx,%rcx
+  803855:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  80385c:	00 00 00 
+  80385f:	48 01 ca             	add    %rcx,%rdx
+  803862:	8b 92 e0 00 00 00    	mov    0xe0(%rdx),%edx
+  803868:	39 d7                	cmp    %edx,%edi
+  80386a:	75 38                	jne    8038a4 <wait+0x79>
+           env->env_status != ENV_FREE) {
+  80386c:	48 98                	cltq
+  80386e:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+  803875:	48 bb 00 00 c0 1f 80 	movabs $0x801fc00000,%rbx
+  80387c:	00 00 00 
+  80387f:	48 01 c3             	add    %rax,%rbx
+        sys_yield();
+  803882:	49 bd 6a 17 80 00 00 	movabs $0x80176a,%r13
+  803889:	00 00 00 
+           env->env_status != ENV_FREE) {
+  80388c:	8b 83 ec 00 00 00    	mov    0xec(%rbx),%eax
+    while (env->env_id == envid &&
+  803892:	85 c0                	test   %eax,%eax
+  803894:	74 0e                	je     8038a4 <wait+0x79>
+        sys_yield();
+  803896:	41 ff d5             	call   *%r13
+    while (env->env_id == envid &&
+  803899:	8b 83 e0 00 00 00    	mov    0xe0(%rbx),%eax
+  80389f:	44 39 e0             	cmp    %r12d,%eax
+  8038a2:	74 e8                	je     80388c <wait+0x61>
+    }
+}
+  8038a4:	48 83 c4 08          	add    $0x8,%rsp
+  8038a8:	5b                   	pop    %rbx
+  8038a9:	41 5c                	pop    %r12
+  8038ab:	41 5d                	pop    %r13
+  8038ad:	5d                   	pop    %rbp
+  8038ae:	c3                   	ret
+    assert(envid != 0);
+  8038af:	48 b9 64 46 80 00 00 	movabs $0x804664,%rcx
+  8038b6:	00 00 00 
+  8038b9:	48 ba ba 45 80 00 00 	movabs $0x8045ba,%rdx
+  8038c0:	00 00 00 
+  8038c3:	be 06 00 00 00       	mov    $0x6,%esi
+  8038c8:	48 bf 6f 46 80 00 00 	movabs $0x80466f,%rdi
+  8038cf:	00 00 00 
+  8038d2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8038d7:	49 b8 d4 07 80 00 00 	movabs $0x8007d4,%r8
+  8038de:	00 00 00 
+  8038e1:	41 ff d0             	call   *%r8
+
+00000000008038e4 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8038e4:	48 89 f8             	mov    %rdi,%rax
+  8038e7:	48 c1 e8 27          	shr    $0x27,%rax
+  8038eb:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  8038f2:	01 00 00 
+  8038f5:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8038f9:	f6 c2 01             	test   $0x1,%dl
+  8038fc:	74 6d                	je     80396b <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8038fe:	48 89 f8             	mov    %rdi,%rax
+  803901:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803905:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  80390c:	01 00 00 
+  80390f:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803913:	f6 c2 01             	test   $0x1,%dl
+  803916:	74 62                	je     80397a <get_uvpt_entry+0x96>
+  803918:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  80391f:	01 00 00 
+  803922:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803926:	f6 c2 80             	test   $0x80,%dl
+  803929:	75 4f                	jne    80397a <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  80392b:	48 89 f8             	mov    %rdi,%rax
+  80392e:	48 c1 e8 15          	shr    $0x15,%rax
+  803932:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  803939:	01 00 00 
+  80393c:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803940:	f6 c2 01             	test   $0x1,%dl
+  803943:	74 44                	je     803989 <get_uvpt_entry+0xa5>
+  803945:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  80394c:	01 00 00 
+  80394f:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803953:	f6 c2 80             	test   $0x80,%dl
+  803956:	75 31                	jne    803989 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  803958:	48 c1 ef 0c          	shr    $0xc,%rdi
+  80395c:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  803963:	01 00 00 
+  803966:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  80396a:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  80396b:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  803972:	01 00 00 
+  803975:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803979:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  80397a:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  803981:	01 00 00 
+  803984:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803988:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803989:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  803990:	01 00 00 
+  803993:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803997:	c3                   	ret
+
+0000000000803998 <get_prot>:
+
+int
+get_prot(void *va) {
+  803998:	55                   	push   %rbp
+  803999:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  80399c:	48 b8 e4 38 80 00 00 	movabs $0x8038e4,%rax
+  8039a3:	00 00 00 
+  8039a6:	ff d0                	call   *%rax
+  8039a8:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  8039ab:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  8039b0:	89 c1                	mov    %eax,%ecx
+  8039b2:	83 c9 04             	or     $0x4,%ecx
+  8039b5:	f6 c2 01             	test   $0x1,%dl
+  8039b8:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  8039bb:	89 c1                	mov    %eax,%ecx
+  8039bd:	83 c9 02             	or     $0x2,%ecx
+  8039c0:	f6 c2 02             	test   $0x2,%dl
+  8039c3:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  8039c6:	89 c1                	mov    %eax,%ecx
+  8039c8:	83 c9 01             	or     $0x1,%ecx
+  8039cb:	48 85 d2             	test   %rdx,%rdx
+  8039ce:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  8039d1:	89 c1                	mov    %eax,%ecx
+  8039d3:	83 c9 40             	or     $0x40,%ecx
+  8039d6:	f6 c6 04             	test   $0x4,%dh
+  8039d9:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  8039dc:	5d                   	pop    %rbp
+  8039dd:	c3                   	ret
+
+00000000008039de <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  8039de:	55                   	push   %rbp
+  8039df:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8039e2:	48 b8 e4 38 80 00 00 	movabs $0x8038e4,%rax
+  8039e9:	00 00 00 
+  8039ec:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  8039ee:	48 c1 e8 06          	shr    $0x6,%rax
+  8039f2:	83 e0 01             	and    $0x1,%eax
+}
+  8039f5:	5d                   	pop    %rbp
+  8039f6:	c3                   	ret
+
+00000000008039f7 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  8039f7:	55                   	push   %rbp
+  8039f8:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  8039fb:	48 b8 e4 38 80 00 00 	movabs $0x8038e4,%rax
+  803a02:	00 00 00 
+  803a05:	ff d0                	call   *%rax
+  803a07:	83 e0 01             	and    $0x1,%eax
+}
+  803a0a:	5d                   	pop    %rbp
+  803a0b:	c3                   	ret
+
+0000000000803a0c <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  803a0c:	55                   	push   %rbp
+  803a0d:	48 89 e5             	mov    %rsp,%rbp
+  803a10:	41 57                	push   %r15
+  803a12:	41 56                	push   %r14
+  803a14:	41 55                	push   %r13
+  803a16:	41 54                	push   %r12
+  803a18:	53                   	push   %rbx
+  803a19:	48 83 ec 38          	sub    $0x38,%rsp
+  803a1d:	49 89 f7             	mov    %rsi,%r15
+  803a20:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+                    }
+                    continue;
+                }
+                for (int ptei = 0; ptei < PT_ENTRY_COUNT; ptei++) {
+                    uintptr_t pte_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, pdei, ptei, 0);
+                    pte_t pte = uvpt[VPT(pte_addr)];
+  803a26:	49 bd 00 00 00 00 00 	movabs $0x10000000000,%r13
+  803a2d:	01 00 00 
+  803a30:	4d 89 e6             	mov    %r12,%r14
+  803a33:	49 89 fc             	mov    %rdi,%r12
+  803a36:	e9 19 01 00 00       	jmp    803b54 <foreach_shared_region+0x148>
+  803a3b:	48 89 5d b0          	mov    %rbx,-0x50(%rbp)
+  803a3f:	4c 89 75 a8          	mov    %r14,-0x58(%rbp)
+  803a43:	eb 52                	jmp    803a97 <foreach_shared_region+0x8b>
+                for (int ptei = 0; ptei < PT_ENTRY_COUNT; ptei++) {
+  803a45:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  803a4c:	48 81 fb 00 00 20 00 	cmp    $0x200000,%rbx
+  803a53:	74 2e                	je     803a83 <foreach_shared_region+0x77>
+                    uintptr_t pte_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, pdei, ptei, 0);
+  803a55:	48 89 df             	mov    %rbx,%rdi
+  803a58:	4c 09 f7             	or     %r14,%rdi
+                    pte_t pte = uvpt[VPT(pte_addr)];
+  803a5b:	48 89 f8             	mov    %rdi,%rax
+  803a5e:	48 c1 e8 0c          	shr    $0xc,%rax
+  803a62:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+                    if ((pte & PTE_P) && (pte & PTE_SHARE)) {
+  803a67:	25 01 04 00 00       	and    $0x401,%eax
+  803a6c:	48 3d 01 04 00 00    	cmp    $0x401,%rax
+  803a72:	75 d1                	jne    803a45 <foreach_shared_region+0x39>
+                        fun((void*)pte_addr, (void*)(pte_addr + PAGE_SIZE), arg);
+  803a74:	48 8d b7 00 10 00 00 	lea    0x1000(%rdi),%rsi
+  803a7b:	4c 89 fa             	mov    %r15,%rdx
+  803a7e:	41 ff d4             	call   *%r12
+  803a81:	eb c2                	jmp    803a45 <foreach_shared_region+0x39>
+            for (int pdei = 0; pdei < PD_ENTRY_COUNT; pdei++) {
+  803a83:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  803a8a:	00 
+  803a8b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803a8f:	48 3d 00 00 00 40    	cmp    $0x40000000,%rax
+  803a95:	74 46                	je     803add <foreach_shared_region+0xd1>
+                uintptr_t pde_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, pdei, 0, 0);
+  803a97:	4c 8b 75 c8          	mov    -0x38(%rbp),%r14
+  803a9b:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803a9f:	49 09 c6             	or     %rax,%r14
+                pde_t pde = uvpd[VPD(pde_addr)];
+  803aa2:	4c 89 f0             	mov    %r14,%rax
+  803aa5:	48 c1 e8 15          	shr    $0x15,%rax
+  803aa9:	48 b9 00 00 00 80 00 	movabs $0x10080000000,%rcx
+  803ab0:	01 00 00 
+  803ab3:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+                if (!(pde & PTE_P)) {
+  803ab7:	a8 01                	test   $0x1,%al
+  803ab9:	74 c8                	je     803a83 <foreach_shared_region+0x77>
+                if (pde & PTE_PS) {
+  803abb:	48 89 c3             	mov    %rax,%rbx
+  803abe:	81 e3 80 00 00 00    	and    $0x80,%ebx
+  803ac4:	74 8f                	je     803a55 <foreach_shared_region+0x49>
+                    if (pde & PTE_SHARE) {
+  803ac6:	f6 c4 04             	test   $0x4,%ah
+  803ac9:	74 b8                	je     803a83 <foreach_shared_region+0x77>
+                        fun((void*)pde_addr, (void*)(pde_addr + 1024 * 1024 * 2), arg);
+  803acb:	49 8d b6 00 00 20 00 	lea    0x200000(%r14),%rsi
+  803ad2:	4c 89 fa             	mov    %r15,%rdx
+  803ad5:	4c 89 f7             	mov    %r14,%rdi
+  803ad8:	41 ff d4             	call   *%r12
+  803adb:	eb a6                	jmp    803a83 <foreach_shared_region+0x77>
+  803add:	48 8b 5d b0          	mov    -0x50(%rbp),%rbx
+  803ae1:	4c 8b 75 a8          	mov    -0x58(%rbp),%r14
+        for (int pdpei = 0; pdpei < PDP_ENTRY_COUNT; pdpei++) {
+  803ae5:	48 81 c3 00 00 00 40 	add    $0x40000000,%rbx
+  803aec:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803af3:	00 00 00 
+  803af6:	48 39 c3             	cmp    %rax,%rbx
+  803af9:	74 4c                	je     803b47 <foreach_shared_region+0x13b>
+            uintptr_t pdpe_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, 0, 0, 0);
+  803afb:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  803aff:	48 09 d8             	or     %rbx,%rax
+  803b02:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+            pdpe_t pdpe = uvpdp[VPDP(pdpe_addr)];
+  803b06:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803b0a:	48 b9 00 00 40 80 00 	movabs $0x10080400000,%rcx
+  803b11:	01 00 00 
+  803b14:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+            if (!(pdpe & PTE_P)) {
+  803b18:	a8 01                	test   $0x1,%al
+  803b1a:	74 c9                	je     803ae5 <foreach_shared_region+0xd9>
+            if (pdpe & PTE_PS) {
+  803b1c:	48 89 c1             	mov    %rax,%rcx
+  803b1f:	81 e1 80 00 00 00    	and    $0x80,%ecx
+  803b25:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  803b29:	0f 84 0c ff ff ff    	je     803a3b <foreach_shared_region+0x2f>
+                if (pdpe & PTE_SHARE) {
+  803b2f:	f6 c4 04             	test   $0x4,%ah
+  803b32:	74 b1                	je     803ae5 <foreach_shared_region+0xd9>
+                    fun((void*)pdpe_addr, (void*)(pdpe_addr + 1024 * 1024 * 1024), arg); 
+  803b34:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  803b38:	48 8d b7 00 00 00 40 	lea    0x40000000(%rdi),%rsi
+  803b3f:	4c 89 fa             	mov    %r15,%rdx
+  803b42:	41 ff d4             	call   *%r12
+  803b45:	eb 9e                	jmp    803ae5 <foreach_shared_region+0xd9>
+    for (int pml4ei = 0; pml4ei < PML4_ENTRY_COUNT; pml4ei++) {
+  803b47:	49 83 c6 01          	add    $0x1,%r14
+  803b4b:	49 81 fe 00 02 00 00 	cmp    $0x200,%r14
+  803b52:	74 24                	je     803b78 <foreach_shared_region+0x16c>
+        pml4e_t pml4e = uvpml4[VPML4(pml4_addr)];
+  803b54:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  803b5b:	01 00 00 
+  803b5e:	4a 8b 04 f0          	mov    (%rax,%r14,8),%rax
+        if (!(pml4e & PTE_P)) {
+  803b62:	a8 01                	test   $0x1,%al
+  803b64:	74 e1                	je     803b47 <foreach_shared_region+0x13b>
+  803b66:	4c 89 f0             	mov    %r14,%rax
+  803b69:	48 c1 e0 27          	shl    $0x27,%rax
+  803b6d:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  803b71:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803b76:	eb 83                	jmp    803afb <foreach_shared_region+0xef>
+            }
+        }
+    }
+    
+    return 0;
+}
+  803b78:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b7d:	48 83 c4 38          	add    $0x38,%rsp
+  803b81:	5b                   	pop    %rbx
+  803b82:	41 5c                	pop    %r12
+  803b84:	41 5d                	pop    %r13
+  803b86:	41 5e                	pop    %r14
+  803b88:	41 5f                	pop    %r15
+  803b8a:	5d                   	pop    %rbp
+  803b8b:	c3                   	ret
+
+0000000000803b8c <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  803b8c:	55                   	push   %rbp
+  803b8d:	48 89 e5             	mov    %rsp,%rbp
+  803b90:	41 55                	push   %r13
+  803b92:	41 54                	push   %r12
+  803b94:	53                   	push   %rbx
+  803b95:	48 83 ec 08          	sub    $0x8,%rsp
+  803b99:	49 89 fc             	mov    %rdi,%r12
+  803b9c:	48 89 f7             	mov    %rsi,%rdi
+  803b9f:	48 89 d3             	mov    %rdx,%rbx
+  803ba2:	49 89 cd             	mov    %rcx,%r13
+    // LAB 9: Your code here:
+    int res = sys_ipc_recv(!pg ? (void*)MAX_USER_ADDRESS : pg, !size ? 0 : *size);
+  803ba5:	be 00 00 00 00       	mov    $0x0,%esi
+  803baa:	48 85 d2             	test   %rdx,%rdx
+  803bad:	74 03                	je     803bb2 <ipc_recv+0x26>
+  803baf:	48 8b 32             	mov    (%rdx),%rsi
+  803bb2:	48 85 ff             	test   %rdi,%rdi
+  803bb5:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803bbc:	00 00 00 
+  803bbf:	48 0f 44 f8          	cmove  %rax,%rdi
+  803bc3:	48 b8 cb 1b 80 00 00 	movabs $0x801bcb,%rax
+  803bca:	00 00 00 
+  803bcd:	ff d0                	call   *%rax
+    if (res < 0) {
+  803bcf:	85 c0                	test   %eax,%eax
+  803bd1:	78 66                	js     803c39 <ipc_recv+0xad>
+        if (size) {
+            *size = 0;
+        }
+        return res;
+    }
+    if (from_env_store) {
+  803bd3:	4d 85 e4             	test   %r12,%r12
+  803bd6:	74 14                	je     803bec <ipc_recv+0x60>
+        *from_env_store = thisenv->env_ipc_from;
+  803bd8:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  803bdf:	00 00 00 
+  803be2:	8b 80 ac 01 00 00    	mov    0x1ac(%rax),%eax
+  803be8:	41 89 04 24          	mov    %eax,(%r12)
+    }
+    if (perm_store) {
+  803bec:	4d 85 ed             	test   %r13,%r13
+  803bef:	74 14                	je     803c05 <ipc_recv+0x79>
+        *perm_store = thisenv->env_ipc_perm;
+  803bf1:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  803bf8:	00 00 00 
+  803bfb:	8b 80 b0 01 00 00    	mov    0x1b0(%rax),%eax
+  803c01:	41 89 45 00          	mov    %eax,0x0(%r13)
+    }
+    if (size) {
+  803c05:	48 85 db             	test   %rbx,%rbx
+  803c08:	74 14                	je     803c1e <ipc_recv+0x92>
+        *size = thisenv->env_ipc_maxsz;
+  803c0a:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  803c11:	00 00 00 
+  803c14:	48 8b 80 a0 01 00 00 	mov    0x1a0(%rax),%rax
+  803c1b:	48 89 03             	mov    %rax,(%rbx)
+    }
+    return thisenv->env_ipc_value;
+  803c1e:	48 a1 00 60 80 00 00 	movabs 0x806000,%rax
+  803c25:	00 00 00 
+  803c28:	8b 80 a8 01 00 00    	mov    0x1a8(%rax),%eax
+}
+  803c2e:	48 83 c4 08          	add    $0x8,%rsp
+  803c32:	5b                   	pop    %rbx
+  803c33:	41 5c                	pop    %r12
+  803c35:	41 5d                	pop    %r13
+  803c37:	5d                   	pop    %rbp
+  803c38:	c3                   	ret
+        if (from_env_store) {
+  803c39:	4d 85 e4             	test   %r12,%r12
+  803c3c:	74 08                	je     803c46 <ipc_recv+0xba>
+            *from_env_store = 0;
+  803c3e:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  803c45:	00 
+        if (perm_store) {
+  803c46:	4d 85 ed             	test   %r13,%r13
+  803c49:	74 08                	je     803c53 <ipc_recv+0xc7>
+            *perm_store = 0;
+  803c4b:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  803c52:	00 
+        if (size) {
+  803c53:	48 85 db             	test   %rbx,%rbx
+  803c56:	74 d6                	je     803c2e <ipc_recv+0xa2>
+            *size = 0;
+  803c58:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  803c5f:	eb cd                	jmp    803c2e <ipc_recv+0xa2>
+
+0000000000803c61 <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  803c61:	55                   	push   %rbp
+  803c62:	48 89 e5             	mov    %rsp,%rbp
+  803c65:	41 57                	push   %r15
+  803c67:	41 56                	push   %r14
+  803c69:	41 55                	push   %r13
+  803c6b:	41 54                	push   %r12
+  803c6d:	53                   	push   %rbx
+  803c6e:	48 83 ec 18          	sub    $0x18,%rsp
+  803c72:	41 89 fd             	mov    %edi,%r13d
+  803c75:	89 75 cc             	mov    %esi,-0x34(%rbp)
+  803c78:	49 89 cc             	mov    %rcx,%r12
+  803c7b:	44 89 45 c8          	mov    %r8d,-0x38(%rbp)
+    // LAB 9: Your code here:
+    int res = 0;
+    while ((res = sys_ipc_try_send(to_env, val, !pg ? (void*)MAX_USER_ADDRESS : pg, size, perm)) < 0) {
+  803c7f:	48 85 d2             	test   %rdx,%rdx
+  803c82:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803c89:	00 00 00 
+  803c8c:	48 0f 45 c2          	cmovne %rdx,%rax
+  803c90:	48 89 c3             	mov    %rax,%rbx
+  803c93:	49 be 9f 1b 80 00 00 	movabs $0x801b9f,%r14
+  803c9a:	00 00 00 
+        if (res != -E_IPC_NOT_RECV) {
+            panic("sys_ipc_try_send failed: %i", res);
+        }
+        sys_yield();
+  803c9d:	49 bf 6a 17 80 00 00 	movabs $0x80176a,%r15
+  803ca4:	00 00 00 
+    while ((res = sys_ipc_try_send(to_env, val, !pg ? (void*)MAX_USER_ADDRESS : pg, size, perm)) < 0) {
+  803ca7:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  803caa:	44 8b 45 c8          	mov    -0x38(%rbp),%r8d
+  803cae:	4c 89 e1             	mov    %r12,%rcx
+  803cb1:	48 89 da             	mov    %rbx,%rdx
+  803cb4:	44 89 ef             	mov    %r13d,%edi
+  803cb7:	41 ff d6             	call   *%r14
+  803cba:	85 c0                	test   %eax,%eax
+  803cbc:	79 37                	jns    803cf5 <ipc_send+0x94>
+        if (res != -E_IPC_NOT_RECV) {
+  803cbe:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  803cc1:	75 05                	jne    803cc8 <ipc_send+0x67>
+        sys_yield();
+  803cc3:	41 ff d7             	call   *%r15
+  803cc6:	eb df                	jmp    803ca7 <ipc_send+0x46>
+            panic("sys_ipc_try_send failed: %i", res);
+  803cc8:	89 c1                	mov    %eax,%ecx
+  803cca:	48 ba 7a 46 80 00 00 	movabs $0x80467a,%rdx
+  803cd1:	00 00 00 
+  803cd4:	be 40 00 00 00       	mov    $0x40,%esi
+  803cd9:	48 bf 96 46 80 00 00 	movabs $0x804696,%rdi
+  803ce0:	00 00 00 
+  803ce3:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ce8:	49 b8 d4 07 80 00 00 	movabs $0x8007d4,%r8
+  803cef:	00 00 00 
+  803cf2:	41 ff d0             	call   *%r8
+    }
+    return;
+}
+  803cf5:	48 83 c4 18          	add    $0x18,%rsp
+  803cf9:	5b                   	pop    %rbx
+  803cfa:	41 5c                	pop    %r12
+  803cfc:	41 5d                	pop    %r13
+  803cfe:	41 5e                	pop    %r14
+  803d00:	41 5f                	pop    %r15
+  803d02:	5d                   	pop    %rbp
+  803d03:	c3                   	ret
+
+0000000000803d04 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  803d04:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  803d09:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  803d10:	00 00 00 
+  803d13:	48 69 d0 d0 01 00 00 	imul   $0x1d0,%rax,%rdx
+  803d1a:	48 01 ca             	add    %rcx,%rdx
+  803d1d:	8b 92 e8 00 00 00    	mov    0xe8(%rdx),%edx
+  803d23:	39 fa                	cmp    %edi,%edx
+  803d25:	74 12                	je     803d39 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  803d27:	48 83 c0 01          	add    $0x1,%rax
+  803d2b:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  803d31:	75 e0                	jne    803d13 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  803d33:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803d38:	c3                   	ret
+            return envs[i].env_id;
+  803d39:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+  803d40:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  803d47:	00 00 00 
+  803d4a:	48 01 d0             	add    %rdx,%rax
+  803d4d:	8b 80 e0 00 00 00    	mov    0xe0(%rax),%eax
+  803d53:	c3                   	ret
+  803d54:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000803d58 <__rodata_start>:
+  803d58:	73 68                	jae    803dc2 <__rodata_start+0x6a>
+  803d5a:	65 6c                	gs insb (%dx),%es:(%rdi)
+  803d5c:	6c                   	insb   (%dx),%es:(%rdi)
+  803d5d:	20 70 72             	and    %dh,0x72(%rax)
+  803d60:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803d61:	64 75 63             	fs jne 803dc7 <__rodata_start+0x6f>
+  803d64:	65 64 20 69 6e       	gs and %ch,%fs:0x6e(%rcx)
+  803d69:	63 6f 72             	movsxd 0x72(%rdi),%ebp
+  803d6c:	72 65                	jb     803dd3 <__rodata_start+0x7b>
+  803d6e:	63 74 20 6f          	movsxd 0x6f(%rax,%riz,1),%esi
+  803d72:	75 74                	jne    803de8 <__rodata_start+0x90>
+  803d74:	70 75                	jo     803deb <__rodata_start+0x93>
+  803d76:	74 2e                	je     803da6 <__rodata_start+0x4e>
+  803d78:	0a 00                	or     (%rax),%al
+  803d7a:	00 00                	add    %al,(%rax)
+  803d7c:	00 00                	add    %al,(%rax)
+  803d7e:	00 00                	add    %al,(%rax)
+  803d80:	72 75                	jb     803df7 <__rodata_start+0x9f>
+  803d82:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803d83:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803d84:	69 6e 67 20 73 68 20 	imul   $0x20687320,0x67(%rsi),%ebp
+  803d8b:	2d 78 20 3c 20       	sub    $0x203c2078,%eax
+  803d90:	74 65                	je     803df7 <__rodata_start+0x9f>
+  803d92:	73 74                	jae    803e08 <__rodata_start+0xb0>
+  803d94:	73 68                	jae    803dfe <__rodata_start+0xa6>
+  803d96:	65 6c                	gs insb (%dx),%es:(%rdi)
+  803d98:	6c                   	insb   (%dx),%es:(%rdi)
+  803d99:	2e 73 68             	jae,pn 803e04 <__rodata_start+0xac>
+  803d9c:	20 7c 20 63          	and    %bh,0x63(%rax,%riz,1)
+  803da0:	61                   	(bad)
+  803da1:	74 0a                	je     803dad <__rodata_start+0x55>
+  803da3:	00 00                	add    %al,(%rax)
+  803da5:	00 00                	add    %al,(%rax)
+  803da7:	00 6f 70             	add    %ch,0x70(%rdi)
+  803daa:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803dac:	20 74 65 73          	and    %dh,0x73(%rbp,%riz,2)
+  803db0:	74 73                	je     803e25 <__rodata_start+0xcd>
+  803db2:	68 65 6c 6c 2e       	push   $0x2e6c6c65
+  803db7:	6b 65 79 20          	imul   $0x20,0x79(%rbp),%esp
+  803dbb:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  803dbd:	72 20                	jb     803ddf <__rodata_start+0x87>
+  803dbf:	72 65                	jb     803e26 <__rodata_start+0xce>
+  803dc1:	61                   	(bad)
+  803dc2:	64 69 6e 67 3a 20 25 	imul   $0x6925203a,%fs:0x67(%rsi),%ebp
+  803dc9:	69 
+  803dca:	00 65 78             	add    %ah,0x78(%rbp)
+  803dcd:	70 65                	jo     803e34 <__rodata_start+0xdc>
+  803dcf:	63 74 65 64          	movsxd 0x64(%rbp,%riz,2),%esi
+  803dd3:	3a 0a                	cmp    (%rdx),%cl
+  803dd5:	3d 3d 3d 0a 25       	cmp    $0x250a3d3d,%eax
+  803dda:	63 00                	movsxd (%rax),%eax
+  803ddc:	3d 3d 3d 0a 67       	cmp    $0x670a3d3d,%eax
+  803de1:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803de2:	74 3a                	je     803e1e <__rodata_start+0xc6>
+  803de4:	0a 3d 3d 3d 0a 25    	or     0x250a3d3d(%rip),%bh        # 258a7b27 <__bss_end+0x2509eb27>
+  803dea:	63 00                	movsxd (%rax),%eax
+  803dec:	3d 3d 3d 0a 00       	cmp    $0xa3d3d,%eax
+  803df1:	74 65                	je     803e58 <__rodata_start+0x100>
+  803df3:	73 74                	jae    803e69 <__rodata_start+0x111>
+  803df5:	73 68                	jae    803e5f <__rodata_start+0x107>
+  803df7:	65 6c                	gs insb (%dx),%es:(%rdi)
+  803df9:	6c                   	insb   (%dx),%es:(%rdi)
+  803dfa:	2e 73 68             	jae,pn 803e65 <__rodata_start+0x10d>
+  803dfd:	00 6f 70             	add    %ch,0x70(%rdi)
+  803e00:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803e02:	20 74 65 73          	and    %dh,0x73(%rbp,%riz,2)
+  803e06:	74 73                	je     803e7b <__rodata_start+0x123>
+  803e08:	68 65 6c 6c 2e       	push   $0x2e6c6c65
+  803e0d:	73 68                	jae    803e77 <__rodata_start+0x11f>
+  803e0f:	3a 20                	cmp    (%rax),%ah
+  803e11:	25 69 00 75 73       	and    $0x73750069,%eax
+  803e16:	65 72 2f             	gs jb  803e48 <__rodata_start+0xf0>
+  803e19:	74 65                	je     803e80 <__rodata_start+0x128>
+  803e1b:	73 74                	jae    803e91 <__rodata_start+0x139>
+  803e1d:	73 68                	jae    803e87 <__rodata_start+0x12f>
+  803e1f:	65 6c                	gs insb (%dx),%es:(%rdi)
+  803e21:	6c                   	insb   (%dx),%es:(%rdi)
+  803e22:	2e 63 00             	cs movsxd (%rax),%eax
+  803e25:	70 69                	jo     803e90 <__rodata_start+0x138>
+  803e27:	70 65                	jo     803e8e <__rodata_start+0x136>
+  803e29:	3a 20                	cmp    (%rax),%ah
+  803e2b:	25 69 00 66 6f       	and    $0x6f660069,%eax
+  803e30:	72 6b                	jb     803e9d <__rodata_start+0x145>
+  803e32:	3a 20                	cmp    (%rax),%ah
+  803e34:	25 69 00 2d 78       	and    $0x782d0069,%eax
+  803e39:	00 2f                	add    %ch,(%rdi)
+  803e3b:	73 68                	jae    803ea5 <__rodata_start+0x14d>
+  803e3d:	00 73 70             	add    %dh,0x70(%rbx)
+  803e40:	61                   	(bad)
+  803e41:	77 6e                	ja     803eb1 <__rodata_start+0x159>
+  803e43:	3a 20                	cmp    (%rax),%ah
+  803e45:	25 69 00 74 65       	and    $0x65740069,%eax
+  803e4a:	73 74                	jae    803ec0 <__rodata_start+0x168>
+  803e4c:	73 68                	jae    803eb6 <__rodata_start+0x15e>
+  803e4e:	65 6c                	gs insb (%dx),%es:(%rdi)
+  803e50:	6c                   	insb   (%dx),%es:(%rdi)
+  803e51:	2e 6b 65 79 00       	cs imul $0x0,0x79(%rbp),%esp
+  803e56:	72 65                	jb     803ebd <__rodata_start+0x165>
+  803e58:	61                   	(bad)
+  803e59:	64 69 6e 67 20 74 65 	imul   $0x73657420,%fs:0x67(%rsi),%ebp
+  803e60:	73 
+  803e61:	74 73                	je     803ed6 <__rodata_start+0x17e>
+  803e63:	68 65 6c 6c 2e       	push   $0x2e6c6c65
+  803e68:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803e69:	75 74                	jne    803edf <__rodata_start+0x187>
+  803e6b:	3a 20                	cmp    (%rax),%ah
+  803e6d:	25 69 00 72 65       	and    $0x65720069,%eax
+  803e72:	61                   	(bad)
+  803e73:	64 69 6e 67 20 74 65 	imul   $0x73657420,%fs:0x67(%rsi),%ebp
+  803e7a:	73 
+  803e7b:	74 73                	je     803ef0 <__rodata_start+0x198>
+  803e7d:	68 65 6c 6c 2e       	push   $0x2e6c6c65
+  803e82:	6b 65 79 3a          	imul   $0x3a,0x79(%rbp),%esp
+  803e86:	20 25 69 00 73 68    	and    %ah,0x68730069(%rip)        # 68f33ef5 <__bss_end+0x6872aef5>
+  803e8c:	65 6c                	gs insb (%dx),%es:(%rdi)
+  803e8e:	6c                   	insb   (%dx),%es:(%rdi)
+  803e8f:	20 72 61             	and    %dh,0x61(%rdx)
+  803e92:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803e93:	20 63 6f             	and    %ah,0x6f(%rbx)
+  803e96:	72 72                	jb     803f0a <__rodata_start+0x1b2>
+  803e98:	65 63 74 6c 79       	movsxd %gs:0x79(%rsp,%rbp,2),%esi
+  803e9d:	0a 00                	or     (%rax),%al
+  803e9f:	3c 63                	cmp    $0x63,%al
+  803ea1:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803ea2:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803ea3:	73 3e                	jae    803ee3 <__rodata_start+0x18b>
+  803ea5:	00 63 6f             	add    %ah,0x6f(%rbx)
+  803ea8:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803ea9:	73 00                	jae    803eab <__rodata_start+0x153>
+  803eab:	3c 75                	cmp    $0x75,%al
+  803ead:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803eae:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  803eb2:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803eb3:	3e 00 0f             	ds add %cl,(%rdi)
+  803eb6:	1f                   	(bad)
+  803eb7:	00 5b 25             	add    %bl,0x25(%rbx)
+  803eba:	30 38                	xor    %bh,(%rax)
+  803ebc:	78 5d                	js     803f1b <__rodata_start+0x1c3>
+  803ebe:	20 75 73             	and    %dh,0x73(%rbp)
+  803ec1:	65 72 20             	gs jb  803ee4 <__rodata_start+0x18c>
+  803ec4:	70 61                	jo     803f27 <__rodata_start+0x1cf>
+  803ec6:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803ec7:	69 63 20 69 6e 20 25 	imul   $0x25206e69,0x20(%rbx),%esp
+  803ece:	73 20                	jae    803ef0 <__rodata_start+0x198>
+  803ed0:	61                   	(bad)
+  803ed1:	74 20                	je     803ef3 <__rodata_start+0x19b>
+  803ed3:	25 73 3a 25 64       	and    $0x64253a73,%eax
+  803ed8:	3a 20                	cmp    (%rax),%ah
+  803eda:	00 30                	add    %dh,(%rax)
+  803edc:	31 32                	xor    %esi,(%rdx)
+  803ede:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  803ee5:	41                   	rex.B
+  803ee6:	42                   	rex.X
+  803ee7:	43                   	rex.XB
+  803ee8:	44                   	rex.R
+  803ee9:	45                   	rex.RB
+  803eea:	46 00 30             	rex.RX add %r14b,(%rax)
+  803eed:	31 32                	xor    %esi,(%rdx)
+  803eef:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  803ef6:	61                   	(bad)
+  803ef7:	62 63 64 65 66       	(bad)
+  803efc:	00 28                	add    %ch,(%rax)
+  803efe:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803eff:	75 6c                	jne    803f6d <__rodata_start+0x215>
+  803f01:	6c                   	insb   (%dx),%es:(%rdi)
+  803f02:	29 00                	sub    %eax,(%rax)
+  803f04:	65 72 72             	gs jb  803f79 <__rodata_start+0x221>
+  803f07:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803f08:	72 20                	jb     803f2a <__rodata_start+0x1d2>
+  803f0a:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  803f0f:	73 70                	jae    803f81 <__rodata_start+0x229>
+  803f11:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  803f15:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  803f1c:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803f1d:	72 00                	jb     803f1f <__rodata_start+0x1c7>
+  803f1f:	62 61 64 20 65       	(bad)
+  803f24:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803f25:	76 69                	jbe    803f90 <__rodata_start+0x238>
+  803f27:	72 6f                	jb     803f98 <__rodata_start+0x240>
+  803f29:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803f2a:	6d                   	insl   (%dx),%es:(%rdi)
+  803f2b:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803f2d:	74 00                	je     803f2f <__rodata_start+0x1d7>
+  803f2f:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  803f36:	20 70 61             	and    %dh,0x61(%rax)
+  803f39:	72 61                	jb     803f9c <__rodata_start+0x244>
+  803f3b:	6d                   	insl   (%dx),%es:(%rdi)
+  803f3c:	65 74 65             	gs je  803fa4 <__rodata_start+0x24c>
+  803f3f:	72 00                	jb     803f41 <__rodata_start+0x1e9>
+  803f41:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803f42:	75 74                	jne    803fb8 <__rodata_start+0x260>
+  803f44:	20 6f 66             	and    %ch,0x66(%rdi)
+  803f47:	20 6d 65             	and    %ch,0x65(%rbp)
+  803f4a:	6d                   	insl   (%dx),%es:(%rdi)
+  803f4b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803f4c:	72 79                	jb     803fc7 <__rodata_start+0x26f>
+  803f4e:	00 6f 75             	add    %ch,0x75(%rdi)
+  803f51:	74 20                	je     803f73 <__rodata_start+0x21b>
+  803f53:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803f54:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  803f58:	76 69                	jbe    803fc3 <__rodata_start+0x26b>
+  803f5a:	72 6f                	jb     803fcb <__rodata_start+0x273>
+  803f5c:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803f5d:	6d                   	insl   (%dx),%es:(%rdi)
+  803f5e:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803f60:	74 73                	je     803fd5 <__rodata_start+0x27d>
+  803f62:	00 63 6f             	add    %ah,0x6f(%rbx)
+  803f65:	72 72                	jb     803fd9 <__rodata_start+0x281>
+  803f67:	75 70                	jne    803fd9 <__rodata_start+0x281>
+  803f69:	74 65                	je     803fd0 <__rodata_start+0x278>
+  803f6b:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  803f70:	75 67                	jne    803fd9 <__rodata_start+0x281>
+  803f72:	20 69 6e             	and    %ch,0x6e(%rcx)
+  803f75:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  803f77:	00 73 65             	add    %dh,0x65(%rbx)
+  803f7a:	67 6d                	insl   (%dx),%es:(%edi)
+  803f7c:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  803f7e:	74 61                	je     803fe1 <__rodata_start+0x289>
+  803f80:	74 69                	je     803feb <__rodata_start+0x293>
+  803f82:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803f83:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803f84:	20 66 61             	and    %ah,0x61(%rsi)
+  803f87:	75 6c                	jne    803ff5 <__rodata_start+0x29d>
+  803f89:	74 00                	je     803f8b <__rodata_start+0x233>
+  803f8b:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  803f92:	20 45 4c             	and    %al,0x4c(%rbp)
+  803f95:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  803f99:	61                   	(bad)
+  803f9a:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  803f9f:	20 73 75             	and    %dh,0x75(%rbx)
+  803fa2:	63 68 20             	movsxd 0x20(%rax),%ebp
+  803fa5:	73 79                	jae    804020 <__rodata_start+0x2c8>
+  803fa7:	73 74                	jae    80401d <__rodata_start+0x2c5>
+  803fa9:	65 6d                	gs insl (%dx),%es:(%rdi)
+  803fab:	20 63 61             	and    %ah,0x61(%rbx)
+  803fae:	6c                   	insb   (%dx),%es:(%rdi)
+  803faf:	6c                   	insb   (%dx),%es:(%rdi)
+  803fb0:	00 65 6e             	add    %ah,0x6e(%rbp)
+  803fb3:	74 72                	je     804027 <__rodata_start+0x2cf>
+  803fb5:	79 20                	jns    803fd7 <__rodata_start+0x27f>
+  803fb7:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803fb8:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803fb9:	74 20                	je     803fdb <__rodata_start+0x283>
+  803fbb:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  803fbd:	75 6e                	jne    80402d <__rodata_start+0x2d5>
+  803fbf:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  803fc3:	76 20                	jbe    803fe5 <__rodata_start+0x28d>
+  803fc5:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  803fcc:	72 65                	jb     804033 <__rodata_start+0x2db>
+  803fce:	63 76 69             	movsxd 0x69(%rsi),%esi
+  803fd1:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803fd2:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  803fd6:	65 78 70             	gs js  804049 <__rodata_start+0x2f1>
+  803fd9:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  803fde:	20 65 6e             	and    %ah,0x6e(%rbp)
+  803fe1:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  803fe5:	20 66 69             	and    %ah,0x69(%rsi)
+  803fe8:	6c                   	insb   (%dx),%es:(%rdi)
+  803fe9:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  803fed:	20 66 72             	and    %ah,0x72(%rsi)
+  803ff0:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  803ff5:	61                   	(bad)
+  803ff6:	63 65 20             	movsxd 0x20(%rbp),%esp
+  803ff9:	6f                   	outsl  %ds:(%rsi),(%dx)
+  803ffa:	6e                   	outsb  %ds:(%rsi),(%dx)
+  803ffb:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  803fff:	6b 00 74             	imul   $0x74,(%rax),%eax
+  804002:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804003:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804004:	20 6d 61             	and    %ch,0x61(%rbp)
+  804007:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804008:	79 20                	jns    80402a <__rodata_start+0x2d2>
+  80400a:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  804011:	72 65                	jb     804078 <__rodata_start+0x320>
+  804013:	20 6f 70             	and    %ch,0x70(%rdi)
+  804016:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  804018:	00 66 69             	add    %ah,0x69(%rsi)
+  80401b:	6c                   	insb   (%dx),%es:(%rdi)
+  80401c:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  804020:	20 62 6c             	and    %ah,0x6c(%rdx)
+  804023:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804024:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  804027:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804028:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804029:	74 20                	je     80404b <__rodata_start+0x2f3>
+  80402b:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  80402d:	75 6e                	jne    80409d <__rodata_start+0x345>
+  80402f:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  804033:	76 61                	jbe    804096 <__rodata_start+0x33e>
+  804035:	6c                   	insb   (%dx),%es:(%rdi)
+  804036:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  80403d:	00 
+  80403e:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  804045:	72 65                	jb     8040ac <__rodata_start+0x354>
+  804047:	61                   	(bad)
+  804048:	64 79 20             	fs jns 80406b <__rodata_start+0x313>
+  80404b:	65 78 69             	gs js  8040b7 <__rodata_start+0x35f>
+  80404e:	73 74                	jae    8040c4 <__rodata_start+0x36c>
+  804050:	73 00                	jae    804052 <__rodata_start+0x2fa>
+  804052:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804053:	70 65                	jo     8040ba <__rodata_start+0x362>
+  804055:	72 61                	jb     8040b8 <__rodata_start+0x360>
+  804057:	74 69                	je     8040c2 <__rodata_start+0x36a>
+  804059:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80405a:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80405b:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  80405e:	74 20                	je     804080 <__rodata_start+0x328>
+  804060:	73 75                	jae    8040d7 <__rodata_start+0x37f>
+  804062:	70 70                	jo     8040d4 <__rodata_start+0x37c>
+  804064:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804065:	72 74                	jb     8040db <__rodata_start+0x383>
+  804067:	65 64 00 6f 70       	gs add %ch,%fs:0x70(%rdi)
+  80406c:	65 72 61             	gs jb  8040d0 <__rodata_start+0x378>
+  80406f:	74 69                	je     8040da <__rodata_start+0x382>
+  804071:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804072:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804073:	20 69 6e             	and    %ch,0x6e(%rcx)
+  804076:	74 65                	je     8040dd <__rodata_start+0x385>
+  804078:	72 72                	jb     8040ec <__rodata_start+0x394>
+  80407a:	75 70                	jne    8040ec <__rodata_start+0x394>
+  80407c:	74 65                	je     8040e3 <__rodata_start+0x38b>
+  80407e:	64 00 6e 6f          	add    %ch,%fs:0x6f(%rsi)
+  804082:	74 20                	je     8040a4 <__rodata_start+0x34c>
+  804084:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  804086:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804087:	75 67                	jne    8040f0 <__rodata_start+0x398>
+  804089:	68 20 43 50 55       	push   $0x55504320
+  80408e:	20 74 69 6d          	and    %dh,0x6d(%rcx,%rbp,2)
+  804092:	65 00 66 2e          	add    %ah,%gs:0x2e(%rsi)
+  804096:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+  80409d:	00 
+  80409e:	66 90                	xchg   %ax,%ax
+  8040a0:	11 0b                	adc    %ecx,(%rbx)
+  8040a2:	80 00 00             	addb   $0x0,(%rax)
+  8040a5:	00 00                	add    %al,(%rax)
+  8040a7:	00 52 11             	add    %dl,0x11(%rdx)
+  8040aa:	80 00 00             	addb   $0x0,(%rax)
+  8040ad:	00 00                	add    %al,(%rax)
+  8040af:	00 42 11             	add    %al,0x11(%rdx)
+  8040b2:	80 00 00             	addb   $0x0,(%rax)
+  8040b5:	00 00                	add    %al,(%rax)
+  8040b7:	00 52 11             	add    %dl,0x11(%rdx)
+  8040ba:	80 00 00             	addb   $0x0,(%rax)
+  8040bd:	00 00                	add    %al,(%rax)
+  8040bf:	00 52 11             	add    %dl,0x11(%rdx)
+  8040c2:	80 00 00             	addb   $0x0,(%rax)
+  8040c5:	00 00                	add    %al,(%rax)
+  8040c7:	00 52 11             	add    %dl,0x11(%rdx)
+  8040ca:	80 00 00             	addb   $0x0,(%rax)
+  8040cd:	00 00                	add    %al,(%rax)
+  8040cf:	00 52 11             	add    %dl,0x11(%rdx)
+  8040d2:	80 00 00             	addb   $0x0,(%rax)
+  8040d5:	00 00                	add    %al,(%rax)
+  8040d7:	00 30                	add    %dh,(%rax)
+  8040d9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  8040df:	00 52 11             	add    %dl,0x11(%rdx)
+  8040e2:	80 00 00             	addb   $0x0,(%rax)
+  8040e5:	00 00                	add    %al,(%rax)
+  8040e7:	00 52 11             	add    %dl,0x11(%rdx)
+  8040ea:	80 00 00             	addb   $0x0,(%rax)
+  8040ed:	00 00                	add    %al,(%rax)
+  8040ef:	00 24 0b             	add    %ah,(%rbx,%rcx,1)
+  8040f2:	80 00 00             	addb   $0x0,(%rax)
+  8040f5:	00 00                	add    %al,(%rax)
+  8040f7:	00 9e 0b 80 00 00    	add    %bl,0x800b(%rsi)
+  8040fd:	00 00                	add    %al,(%rax)
+  8040ff:	00 52 11             	add    %dl,0x11(%rdx)
+  804102:	80 00 00             	addb   $0x0,(%rax)
+  804105:	00 00                	add    %al,(%rax)
+  804107:	00 24 0b             	add    %ah,(%rbx,%rcx,1)
+  80410a:	80 00 00             	addb   $0x0,(%rax)
+  80410d:	00 00                	add    %al,(%rax)
+  80410f:	00 6a 0b             	add    %ch,0xb(%rdx)
+  804112:	80 00 00             	addb   $0x0,(%rax)
+  804115:	00 00                	add    %al,(%rax)
+  804117:	00 6a 0b             	add    %ch,0xb(%rdx)
+  80411a:	80 00 00             	addb   $0x0,(%rax)
+  80411d:	00 00                	add    %al,(%rax)
+  80411f:	00 6a 0b             	add    %ch,0xb(%rdx)
+  804122:	80 00 00             	addb   $0x0,(%rax)
+  804125:	00 00                	add    %al,(%rax)
+  804127:	00 6a 0b             	add    %ch,0xb(%rdx)
+  80412a:	80 00 00             	addb   $0x0,(%rax)
+  80412d:	00 00                	add    %al,(%rax)
+  80412f:	00 6a 0b             	add    %ch,0xb(%rdx)
+  804132:	80 00 00             	addb   $0x0,(%rax)
+  804135:	00 00                	add    %al,(%rax)
+  804137:	00 6a 0b             	add    %ch,0xb(%rdx)
+  80413a:	80 00 00             	addb   $0x0,(%rax)
+  80413d:	00 00                	add    %al,(%rax)
+  80413f:	00 6a 0b             	add    %ch,0xb(%rdx)
+  804142:	80 00 00             	addb   $0x0,(%rax)
+  804145:	00 00                	add    %al,(%rax)
+  804147:	00 6a 0b             	add    %ch,0xb(%rdx)
+  80414a:	80 00 00             	addb   $0x0,(%rax)
+  80414d:	00 00                	add    %al,(%rax)
+  80414f:	00 6a 0b             	add    %ch,0xb(%rdx)
+  804152:	80 00 00             	addb   $0x0,(%rax)
+  804155:	00 00                	add    %al,(%rax)
+  804157:	00 52 11             	add    %dl,0x11(%rdx)
+  80415a:	80 00 00             	addb   $0x0,(%rax)
+  80415d:	00 00                	add    %al,(%rax)
+  80415f:	00 52 11             	add    %dl,0x11(%rdx)
+  804162:	80 00 00             	addb   $0x0,(%rax)
+  804165:	00 00                	add    %al,(%rax)
+  804167:	00 52 11             	add    %dl,0x11(%rdx)
+  80416a:	80 00 00             	addb   $0x0,(%rax)
+  80416d:	00 00                	add    %al,(%rax)
+  80416f:	00 52 11             	add    %dl,0x11(%rdx)
+  804172:	80 00 00             	addb   $0x0,(%rax)
+  804175:	00 00                	add    %al,(%rax)
+  804177:	00 52 11             	add    %dl,0x11(%rdx)
+  80417a:	80 00 00             	addb   $0x0,(%rax)
+  80417d:	00 00                	add    %al,(%rax)
+  80417f:	00 52 11             	add    %dl,0x11(%rdx)
+  804182:	80 00 00             	addb   $0x0,(%rax)
+  804185:	00 00                	add    %al,(%rax)
+  804187:	00 52 11             	add    %dl,0x11(%rdx)
+  80418a:	80 00 00             	addb   $0x0,(%rax)
+  80418d:	00 00                	add    %al,(%rax)
+  80418f:	00 52 11             	add    %dl,0x11(%rdx)
+  804192:	80 00 00             	addb   $0x0,(%rax)
+  804195:	00 00                	add    %al,(%rax)
+  804197:	00 52 11             	add    %dl,0x11(%rdx)
+  80419a:	80 00 00             	addb   $0x0,(%rax)
+  80419d:	00 00                	add    %al,(%rax)
+  80419f:	00 52 11             	add    %dl,0x11(%rdx)
+  8041a2:	80 00 00             	addb   $0x0,(%rax)
+  8041a5:	00 00                	add    %al,(%rax)
+  8041a7:	00 52 11             	add    %dl,0x11(%rdx)
+  8041aa:	80 00 00             	addb   $0x0,(%rax)
+  8041ad:	00 00                	add    %al,(%rax)
+  8041af:	00 52 11             	add    %dl,0x11(%rdx)
+  8041b2:	80 00 00             	addb   $0x0,(%rax)
+  8041b5:	00 00                	add    %al,(%rax)
+  8041b7:	00 52 11             	add    %dl,0x11(%rdx)
+  8041ba:	80 00 00             	addb   $0x0,(%rax)
+  8041bd:	00 00                	add    %al,(%rax)
+  8041bf:	00 52 11             	add    %dl,0x11(%rdx)
+  8041c2:	80 00 00             	addb   $0x0,(%rax)
+  8041c5:	00 00                	add    %al,(%rax)
+  8041c7:	00 52 11             	add    %dl,0x11(%rdx)
+  8041ca:	80 00 00             	addb   $0x0,(%rax)
+  8041cd:	00 00                	add    %al,(%rax)
+  8041cf:	00 52 11             	add    %dl,0x11(%rdx)
+  8041d2:	80 00 00             	addb   $0x0,(%rax)
+  8041d5:	00 00                	add    %al,(%rax)
+  8041d7:	00 52 11             	add    %dl,0x11(%rdx)
+  8041da:	80 00 00             	addb   $0x0,(%rax)
+  8041dd:	00 00                	add    %al,(%rax)
+  8041df:	00 52 11             	add    %dl,0x11(%rdx)
+  8041e2:	80 00 00             	addb   $0x0,(%rax)
+  8041e5:	00 00                	add    %al,(%rax)
+  8041e7:	00 52 11             	add    %dl,0x11(%rdx)
+  8041ea:	80 00 00             	addb   $0x0,(%rax)
+  8041ed:	00 00                	add    %al,(%rax)
+  8041ef:	00 52 11             	add    %dl,0x11(%rdx)
+  8041f2:	80 00 00             	addb   $0x0,(%rax)
+  8041f5:	00 00                	add    %al,(%rax)
+  8041f7:	00 52 11             	add    %dl,0x11(%rdx)
+  8041fa:	80 00 00             	addb   $0x0,(%rax)
+  8041fd:	00 00                	add    %al,(%rax)
+  8041ff:	00 52 11             	add    %dl,0x11(%rdx)
+  804202:	80 00 00             	addb   $0x0,(%rax)
+  804205:	00 00                	add    %al,(%rax)
+  804207:	00 52 11             	add    %dl,0x11(%rdx)
+  80420a:	80 00 00             	addb   $0x0,(%rax)
+  80420d:	00 00                	add    %al,(%rax)
+  80420f:	00 52 11             	add    %dl,0x11(%rdx)
+  804212:	80 00 00             	addb   $0x0,(%rax)
+  804215:	00 00                	add    %al,(%rax)
+  804217:	00 52 11             	add    %dl,0x11(%rdx)
+  80421a:	80 00 00             	addb   $0x0,(%rax)
+  80421d:	00 00                	add    %al,(%rax)
+  80421f:	00 52 11             	add    %dl,0x11(%rdx)
+  804222:	80 00 00             	addb   $0x0,(%rax)
+  804225:	00 00                	add    %al,(%rax)
+  804227:	00 52 11             	add    %dl,0x11(%rdx)
+  80422a:	80 00 00             	addb   $0x0,(%rax)
+  80422d:	00 00                	add    %al,(%rax)
+  80422f:	00 52 11             	add    %dl,0x11(%rdx)
+  804232:	80 00 00             	addb   $0x0,(%rax)
+  804235:	00 00                	add    %al,(%rax)
+  804237:	00 52 11             	add    %dl,0x11(%rdx)
+  80423a:	80 00 00             	addb   $0x0,(%rax)
+  80423d:	00 00                	add    %al,(%rax)
+  80423f:	00 52 11             	add    %dl,0x11(%rdx)
+  804242:	80 00 00             	addb   $0x0,(%rax)
+  804245:	00 00                	add    %al,(%rax)
+  804247:	00 75 10             	add    %dh,0x10(%rbp)
+  80424a:	80 00 00             	addb   $0x0,(%rax)
+  80424d:	00 00                	add    %al,(%rax)
+  80424f:	00 52 11             	add    %dl,0x11(%rdx)
+  804252:	80 00 00             	addb   $0x0,(%rax)
+  804255:	00 00                	add    %al,(%rax)
+  804257:	00 52 11             	add    %dl,0x11(%rdx)
+  80425a:	80 00 00             	addb   $0x0,(%rax)
+  80425d:	00 00                	add    %al,(%rax)
+  80425f:	00 52 11             	add    %dl,0x11(%rdx)
+  804262:	80 00 00             	addb   $0x0,(%rax)
+  804265:	00 00                	add    %al,(%rax)
+  804267:	00 52 11             	add    %dl,0x11(%rdx)
+  80426a:	80 00 00             	addb   $0x0,(%rax)
+  80426d:	00 00                	add    %al,(%rax)
+  80426f:	00 52 11             	add    %dl,0x11(%rdx)
+  804272:	80 00 00             	addb   $0x0,(%rax)
+  804275:	00 00                	add    %al,(%rax)
+  804277:	00 52 11             	add    %dl,0x11(%rdx)
+  80427a:	80 00 00             	addb   $0x0,(%rax)
+  80427d:	00 00                	add    %al,(%rax)
+  80427f:	00 52 11             	add    %dl,0x11(%rdx)
+  804282:	80 00 00             	addb   $0x0,(%rax)
+  804285:	00 00                	add    %al,(%rax)
+  804287:	00 52 11             	add    %dl,0x11(%rdx)
+  80428a:	80 00 00             	addb   $0x0,(%rax)
+  80428d:	00 00                	add    %al,(%rax)
+  80428f:	00 52 11             	add    %dl,0x11(%rdx)
+  804292:	80 00 00             	addb   $0x0,(%rax)
+  804295:	00 00                	add    %al,(%rax)
+  804297:	00 52 11             	add    %dl,0x11(%rdx)
+  80429a:	80 00 00             	addb   $0x0,(%rax)
+  80429d:	00 00                	add    %al,(%rax)
+  80429f:	00 c1                	add    %al,%cl
+  8042a1:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  8042a7:	00 90 0d 80 00 00    	add    %dl,0x800d(%rax)
+  8042ad:	00 00                	add    %al,(%rax)
+  8042af:	00 52 11             	add    %dl,0x11(%rdx)
+  8042b2:	80 00 00             	addb   $0x0,(%rax)
+  8042b5:	00 00                	add    %al,(%rax)
+  8042b7:	00 52 11             	add    %dl,0x11(%rdx)
+  8042ba:	80 00 00             	addb   $0x0,(%rax)
+  8042bd:	00 00                	add    %al,(%rax)
+  8042bf:	00 52 11             	add    %dl,0x11(%rdx)
+  8042c2:	80 00 00             	addb   $0x0,(%rax)
+  8042c5:	00 00                	add    %al,(%rax)
+  8042c7:	00 52 11             	add    %dl,0x11(%rdx)
+  8042ca:	80 00 00             	addb   $0x0,(%rax)
+  8042cd:	00 00                	add    %al,(%rax)
+  8042cf:	00 f0                	add    %dh,%al
+  8042d1:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  8042d7:	00 52 11             	add    %dl,0x11(%rdx)
+  8042da:	80 00 00             	addb   $0x0,(%rax)
+  8042dd:	00 00                	add    %al,(%rax)
+  8042df:	00 52 11             	add    %dl,0x11(%rdx)
+  8042e2:	80 00 00             	addb   $0x0,(%rax)
+  8042e5:	00 00                	add    %al,(%rax)
+  8042e7:	00 b6 0b 80 00 00    	add    %dh,0x800b(%rsi)
+  8042ed:	00 00                	add    %al,(%rax)
+  8042ef:	00 52 11             	add    %dl,0x11(%rdx)
+  8042f2:	80 00 00             	addb   $0x0,(%rax)
+  8042f5:	00 00                	add    %al,(%rax)
+  8042f7:	00 52 11             	add    %dl,0x11(%rdx)
+  8042fa:	80 00 00             	addb   $0x0,(%rax)
+  8042fd:	00 00                	add    %al,(%rax)
+  8042ff:	00 38                	add    %bh,(%rax)
+  804301:	0f 80 00 00 00 00    	jo     804307 <__rodata_start+0x5af>
+  804307:	00 02                	add    %al,(%rdx)
+  804309:	10 80 00 00 00 00    	adc    %al,0x0(%rax)
+  80430f:	00 52 11             	add    %dl,0x11(%rdx)
+  804312:	80 00 00             	addb   $0x0,(%rax)
+  804315:	00 00                	add    %al,(%rax)
+  804317:	00 52 11             	add    %dl,0x11(%rdx)
+  80431a:	80 00 00             	addb   $0x0,(%rax)
+  80431d:	00 00                	add    %al,(%rax)
+  80431f:	00 87 0c 80 00 00    	add    %al,0x800c(%rdi)
+  804325:	00 00                	add    %al,(%rax)
+  804327:	00 52 11             	add    %dl,0x11(%rdx)
+  80432a:	80 00 00             	addb   $0x0,(%rax)
+  80432d:	00 00                	add    %al,(%rax)
+  80432f:	00 64 0e 80          	add    %ah,-0x80(%rsi,%rcx,1)
+  804333:	00 00                	add    %al,(%rax)
+  804335:	00 00                	add    %al,(%rax)
+  804337:	00 52 11             	add    %dl,0x11(%rdx)
+  80433a:	80 00 00             	addb   $0x0,(%rax)
+  80433d:	00 00                	add    %al,(%rax)
+  80433f:	00 52 11             	add    %dl,0x11(%rdx)
+  804342:	80 00 00             	addb   $0x0,(%rax)
+  804345:	00 00                	add    %al,(%rax)
+  804347:	00 75 10             	add    %dh,0x10(%rbp)
+  80434a:	80 00 00             	addb   $0x0,(%rax)
+  80434d:	00 00                	add    %al,(%rax)
+  80434f:	00 52 11             	add    %dl,0x11(%rdx)
+  804352:	80 00 00             	addb   $0x0,(%rax)
+  804355:	00 00                	add    %al,(%rax)
+  804357:	00 1a                	add    %bl,(%rdx)
+  804359:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+	...
+
+0000000000804360 <error_string>:
+	...
+  804368:	0d 3f 80 00 00 00 00 00 1f 3f 80 00 00 00 00 00     .?.......?......
+  804378:	2f 3f 80 00 00 00 00 00 41 3f 80 00 00 00 00 00     /?......A?......
+  804388:	4f 3f 80 00 00 00 00 00 63 3f 80 00 00 00 00 00     O?......c?......
+  804398:	78 3f 80 00 00 00 00 00 8b 3f 80 00 00 00 00 00     x?.......?......
+  8043a8:	9d 3f 80 00 00 00 00 00 b1 3f 80 00 00 00 00 00     .?.......?......
+  8043b8:	c1 3f 80 00 00 00 00 00 d4 3f 80 00 00 00 00 00     .?.......?......
+  8043c8:	eb 3f 80 00 00 00 00 00 01 40 80 00 00 00 00 00     .?.......@......
+  8043d8:	19 40 80 00 00 00 00 00 31 40 80 00 00 00 00 00     .@......1@......
+  8043e8:	3e 40 80 00 00 00 00 00 10 44 80 00 00 00 00 00     >@.......D......
+  8043f8:	52 40 80 00 00 00 00 00 6a 40 80 00 00 00 00 00     R@......j@......
+  804408:	80 40 80 00 00 00 00 00 66 69 6c 65 20 69 73 20     .@......file is 
+  804418:	6e 6f 74 20 61 20 76 61 6c 69 64 20 65 78 65 63     not a valid exec
+  804428:	75 74 61 62 6c 65 00 90 73 79 73 63 61 6c 6c 20     utable..syscall 
+  804438:	25 7a 64 20 72 65 74 75 72 6e 65 64 20 25 7a 64     %zd returned %zd
+  804448:	20 28 3e 20 30 29 00 6c 69 62 2f 73 79 73 63 61      (> 0).lib/sysca
+  804458:	6c 6c 2e 63 00 46 6f 72 6b 20 64 6f 75 62 6c 65     ll.c.Fork double
+  804468:	20 66 61 75 6c 74 00 6c 69 62 2f 66 6f 72 6b 2e      fault.lib/fork.
+  804478:	63 00 73 66 6f 72 6b 28 29 20 69 73 20 6e 6f 74     c.sfork() is not
+  804488:	20 69 6d 70 6c 65 6d 65 6e 74 65 64 00 0f 1f 00      implemented....
+  804498:	5b 25 30 38 78 5d 20 75 6e 6b 6e 6f 77 6e 20 64     [%08x] unknown d
+  8044a8:	65 76 69 63 65 20 74 79 70 65 20 25 64 0a 00 00     evice type %d...
+  8044b8:	5b 25 30 38 78 5d 20 66 74 72 75 6e 63 61 74 65     [%08x] ftruncate
+  8044c8:	20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65 0a      %d -- bad mode.
+  8044d8:	00 5b 25 30 38 78 5d 20 72 65 61 64 20 25 64 20     .[%08x] read %d 
+  8044e8:	2d 2d 20 62 61 64 20 6d 6f 64 65 0a 00 5b 25 30     -- bad mode..[%0
+  8044f8:	38 78 5d 20 77 72 69 74 65 20 25 64 20 2d 2d 20     8x] write %d -- 
+  804508:	62 61 64 20 6d 6f 64 65 0a 00 66 2e 0f 1f 84 00     bad mode..f.....
+  804518:	00 00 00 00 0f 1f 40 00                             ......@.
+
+0000000000804520 <devtab>:
+  804520:	40 50 80 00 00 00 00 00 80 50 80 00 00 00 00 00     @P.......P......
+  804530:	00 50 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .P..............
+  804540:	57 72 6f 6e 67 20 45 4c 46 20 68 65 61 64 65 72     Wrong ELF header
+  804550:	20 73 69 7a 65 20 6f 72 20 72 65 61 64 20 65 72      size or read er
+  804560:	72 6f 72 3a 20 25 69 0a 00 00 00 00 00 00 00 00     ror: %i.........
+  804570:	73 74 72 69 6e 67 5f 73 74 6f 72 65 20 3d 3d 20     string_store == 
+  804580:	28 63 68 61 72 20 2a 29 55 54 45 4d 50 20 2b 20     (char *)UTEMP + 
+  804590:	55 53 45 52 5f 53 54 41 43 4b 5f 53 49 5a 45 00     USER_STACK_SIZE.
+  8045a0:	45 6c 66 20 6d 61 67 69 63 20 25 30 38 78 20 77     Elf magic %08x w
+  8045b0:	61 6e 74 20 25 30 38 78 0a 00 61 73 73 65 72 74     ant %08x..assert
+  8045c0:	69 6f 6e 20 66 61 69 6c 65 64 3a 20 25 73 00 6c     ion failed: %s.l
+  8045d0:	69 62 2f 73 70 61 77 6e 2e 63 00 63 6f 70 79 5f     ib/spawn.c.copy_
+  8045e0:	73 68 61 72 65 64 5f 72 65 67 69 6f 6e 3a 20 25     shared_region: %
+  8045f0:	69 00 73 79 73 5f 65 6e 76 5f 73 65 74 5f 74 72     i.sys_env_set_tr
+  804600:	61 70 66 72 61 6d 65 3a 20 25 69 00 73 79 73 5f     apframe: %i.sys_
+  804610:	65 6e 76 5f 73 65 74 5f 73 74 61 74 75 73 3a 20     env_set_status: 
+  804620:	25 69 00 3c 70 69 70 65 3e 00 6c 69 62 2f 70 69     %i.<pipe>.lib/pi
+  804630:	70 65 2e 63 00 70 69 70 65 00 66 0f 1f 44 00 00     pe.c.pipe.f..D..
+  804640:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  804650:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  804660:	3d 20 32 00 65 6e 76 69 64 20 21 3d 20 30 00 6c     = 2.envid != 0.l
+  804670:	69 62 2f 77 61 69 74 2e 63 00 73 79 73 5f 69 70     ib/wait.c.sys_ip
+  804680:	63 5f 74 72 79 5f 73 65 6e 64 20 66 61 69 6c 65     c_try_send faile
+  804690:	64 3a 20 25 69 00 6c 69 62 2f 69 70 63 2e 63 00     d: %i.lib/ipc.c.
+  8046a0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8046b0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8046c0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8046d0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8046e0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8046f0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804700:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804710:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804720:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804730:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804740:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804750:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804760:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804770:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804780:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804790:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8047a0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8047b0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8047c0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8047d0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8047e0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8047f0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804800:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804810:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804820:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804830:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804840:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804850:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804860:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804870:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804880:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804890:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8048a0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8048b0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8048c0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8048d0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8048e0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8048f0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804900:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804910:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804920:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804930:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804940:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804950:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804960:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804970:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804980:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804990:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8049a0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8049b0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8049c0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8049d0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8049e0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8049f0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804a00:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804a10:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804a20:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804a30:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804a40:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804a50:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804a60:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804a70:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804a80:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804a90:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804aa0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804ab0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804ac0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804ad0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804ae0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804af0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804b00:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804b10:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804b20:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804b30:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804b40:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804b50:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804b60:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804b70:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804b80:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804b90:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804ba0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804bb0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804bc0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804bd0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804be0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804bf0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804c00:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804c10:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804c20:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804c30:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804c40:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804c50:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804c60:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804c70:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804c80:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804c90:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804ca0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804cb0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804cc0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804cd0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804ce0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804cf0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804d00:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804d10:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804d20:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804d30:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804d40:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804d50:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804d60:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804d70:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804d80:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804d90:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804da0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804db0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804dc0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804dd0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804de0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804df0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804e00:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804e10:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804e20:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804e30:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804e40:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804e50:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804e60:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804e70:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804e80:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804e90:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804ea0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804eb0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804ec0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804ed0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804ee0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804ef0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804f00:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804f10:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804f20:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804f30:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804f40:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804f50:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804f60:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804f70:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804f80:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804f90:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804fa0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804fb0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804fc0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804fd0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804fe0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804ff0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
@@ -0,0 +1,5761 @@
+
+obj/user/wfairness:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 ee 02 00 00       	call   800311 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+
+/* Weights relative to SCHED_WEIGHT_DEFAULT */
+static const uint32_t weights[NSPINNERS] = {1, 1, 2, 4};
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 57                	push   %r15
+  80002b:	41 56                	push   %r14
+  80002d:	41 55                	push   %r13
+  80002f:	41 54                	push   %r12
+  800031:	53                   	push   %rbx
+  800032:	48 83 ec 58          	sub    $0x58,%rsp
+    uint64_t duration = (argc > 1 ? strtol(argv[1], NULL, 0) : 2) * 1000000000ULL;
+  800036:	41 be 00 94 35 77    	mov    $0x77359400,%r14d
+  80003c:	83 ff 01             	cmp    $0x1,%edi
+  80003f:	0f 8f 48 02 00 00    	jg     80028d <umain+0x268>
+  800045:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+    envid_t spinners[NSPINNERS];
+    uint64_t start_runtime[NSPINNERS];
+    uint32_t total_weight = 0;
+  80004b:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+
+    for (int i = 0; i < NSPINNERS; i++) {
+        envid_t id = fork();
+  800051:	48 b8 3d 18 80 00 00 	movabs $0x80183d,%rax
+  800058:	00 00 00 
+  80005b:	ff d0                	call   *%rax
+  80005d:	89 c3                	mov    %eax,%ebx
+        if (id < 0) panic("fork: %i", id);
+  80005f:	85 c0                	test   %eax,%eax
+  800061:	0f 88 4c 02 00 00    	js     8002b3 <umain+0x28e>
+        if (!id)
+  800067:	0f 84 73 02 00 00    	je     8002e0 <umain+0x2bb>
+            for (;;) asm volatile("pause");
+
+        int res = sys_env_set_weight(id, weights[i] * SCHED_WEIGHT_DEFAULT);
+  80006d:	48 b8 40 31 80 00 00 	movabs $0x803140,%rax
+  800074:	00 00 00 
+  800077:	46 8b 2c 20          	mov    (%rax,%r12,1),%r13d
+  80007b:	44 89 ee             	mov    %r13d,%esi
+  80007e:	c1 e6 0a             	shl    $0xa,%esi
+  800081:	89 df                	mov    %ebx,%edi
+  800083:	48 b8 07 16 80 00 00 	movabs $0x801607,%rax
+  80008a:	00 00 00 
+  80008d:	ff d0                	call   *%rax
+        if (res < 0) panic("sys_env_set_weight: %i", res);
+  80008f:	85 c0                	test   %eax,%eax
+  800091:	0f 88 4d 02 00 00    	js     8002e4 <umain+0x2bf>
+        spinners[i] = id;
+  800097:	42 89 5c 25 c0       	mov    %ebx,-0x40(%rbp,%r12,1)
+        total_weight += weights[i];
+  80009c:	45 01 ef             	add    %r13d,%r15d
+    for (int i = 0; i < NSPINNERS; i++) {
+  80009f:	49 83 c4 04          	add    $0x4,%r12
+  8000a3:	49 83 fc 10          	cmp    $0x10,%r12
+  8000a7:	75 a8                	jne    800051 <umain+0x2c>
+    }
+
+    /* Parent only checks the time, so it runs rarely */
+    sys_env_set_weight(CURENVID, SCHED_WEIGHT_MIN);
+  8000a9:	be 01 00 00 00       	mov    $0x1,%esi
+  8000ae:	bf 00 00 00 00       	mov    $0x0,%edi
+  8000b3:	48 b8 07 16 80 00 00 	movabs $0x801607,%rax
+  8000ba:	00 00 00 
+  8000bd:	ff d0                	call   *%rax
+  8000bf:	ba 00 00 00 00       	mov    $0x0,%edx
+
+    for (int i = 0; i < NSPINNERS; i++)
+        start_runtime[i] = envs[ENVX(spinners[i])].env_runtime;
+  8000c4:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  8000cb:	00 00 00 
+  8000ce:	8b 44 95 c0          	mov    -0x40(%rbp,%rdx,4),%eax
+  8000d2:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8000d7:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+  8000de:	48 01 c8             	add    %rcx,%rax
+  8000e1:	48 8b 80 08 01 00 00 	mov    0x108(%rax),%rax
+  8000e8:	48 89 44 d5 a0       	mov    %rax,-0x60(%rbp,%rdx,8)
+    for (int i = 0; i < NSPINNERS; i++)
+  8000ed:	48 83 c2 01          	add    $0x1,%rdx
+  8000f1:	48 83 fa 04          	cmp    $0x4,%rdx
+  8000f5:	75 d7                	jne    8000ce <umain+0xa9>
+}
+
+static inline uint64_t __attribute__((always_inline))
+read_tsc(void) {
+    uint32_t lo, hi;
+    asm volatile("rdtsc"
+  8000f7:	0f 31                	rdtsc
+                 : "=a"(lo), "=d"(hi));
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  8000f9:	48 c1 e2 20          	shl    $0x20,%rdx
+  8000fd:	89 c0                	mov    %eax,%eax
+  8000ff:	48 09 c2             	or     %rax,%rdx
+  800102:	49 89 d4             	mov    %rdx,%r12
+    asm volatile("rdtsc"
+  800105:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  800107:	48 c1 e2 20          	shl    $0x20,%rdx
+  80010b:	89 c0                	mov    %eax,%eax
+  80010d:	48 09 c2             	or     %rax,%rdx
+    uint64_t start = read_tsc();
+    while (read_tsc() - start < duration) sys_yield();
+  800110:	4c 29 e2             	sub    %r12,%rdx
+  800113:	4c 39 f2             	cmp    %r14,%rdx
+  800116:	73 1f                	jae    800137 <umain+0x112>
+  800118:	48 bb 73 13 80 00 00 	movabs $0x801373,%rbx
+  80011f:	00 00 00 
+  800122:	ff d3                	call   *%rbx
+    asm volatile("rdtsc"
+  800124:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  800126:	48 c1 e2 20          	shl    $0x20,%rdx
+  80012a:	89 c0                	mov    %eax,%eax
+  80012c:	48 09 c2             	or     %rax,%rdx
+  80012f:	4c 29 e2             	sub    %r12,%rdx
+  800132:	4c 39 f2             	cmp    %r14,%rdx
+  800135:	72 eb                	jb     800122 <umain+0xfd>
+    sys_env_set_weight(CURENVID, SCHED_WEIGHT_MIN);
+  800137:	ba 00 00 00 00       	mov    $0x0,%edx
+
+    uint64_t runtime[NSPINNERS], total_runtime = 0;
+  80013c:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (int i = 0; i < NSPINNERS; i++) {
+        runtime[i] = envs[ENVX(spinners[i])].env_runtime - start_runtime[i];
+  800141:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  800148:	00 00 00 
+  80014b:	8b 44 95 c0          	mov    -0x40(%rbp,%rdx,4),%eax
+  80014f:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800154:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+  80015b:	48 01 c8             	add    %rcx,%rax
+  80015e:	48 8b 80 08 01 00 00 	mov    0x108(%rax),%rax
+  800165:	48 2b 44 d5 a0       	sub    -0x60(%rbp,%rdx,8),%rax
+  80016a:	48 89 44 d5 80       	mov    %rax,-0x80(%rbp,%rdx,8)
+        total_runtime += runtime[i];
+  80016f:	48 01 c3             	add    %rax,%rbx
+    for (int i = 0; i < NSPINNERS; i++) {
+  800172:	48 83 c2 01          	add    $0x1,%rdx
+  800176:	48 83 fa 04          	cmp    $0x4,%rdx
+  80017a:	75 cf                	jne    80014b <umain+0x126>
+    }
+    if (!total_runtime) total_runtime = 1;
+  80017c:	48 85 db             	test   %rbx,%rbx
+  80017f:	b8 01 00 00 00       	mov    $0x1,%eax
+  800184:	48 0f 44 d8          	cmove  %rax,%rbx
+    for (int i = 0; i < NSPINNERS; i++)
+  800188:	4c 8d 65 c0          	lea    -0x40(%rbp),%r12
+  80018c:	4c 8d 75 d0          	lea    -0x30(%rbp),%r14
+        sys_env_destroy(spinners[i]);
+  800190:	49 bd d7 12 80 00 00 	movabs $0x8012d7,%r13
+  800197:	00 00 00 
+  80019a:	41 8b 3c 24          	mov    (%r12),%edi
+  80019e:	41 ff d5             	call   *%r13
+    for (int i = 0; i < NSPINNERS; i++)
+  8001a1:	49 83 c4 04          	add    $0x4,%r12
+  8001a5:	4d 39 f4             	cmp    %r14,%r12
+  8001a8:	75 f0                	jne    80019a <umain+0x175>
+  8001aa:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+        cprintf("wfairness: env %08x weight %4u: %3lu.%lu%% of CPU (expected %lu.%lu%%)\n",
+                spinners[i], weights[i] * SCHED_WEIGHT_DEFAULT,
+                (unsigned long)(runtime[i] * 100 / total_runtime),
+                (unsigned long)(runtime[i] * 1000 / total_runtime % 10),
+                (unsigned long)(weights[i] * 100 / total_weight),
+                (unsigned long)(weights[i] * 1000 / total_weight % 10));
+  8001b0:	49 be 40 31 80 00 00 	movabs $0x803140,%r14
+  8001b7:	00 00 00 
+  8001ba:	41 bd cd cc cc cc    	mov    $0xcccccccd,%r13d
+  8001c0:	47 8b 1c 26          	mov    (%r14,%r12,1),%r11d
+                (unsigned long)(runtime[i] * 1000 / total_runtime % 10),
+  8001c4:	4a 8b 4c 65 80       	mov    -0x80(%rbp,%r12,2),%rcx
+                (unsigned long)(weights[i] * 100 / total_weight),
+  8001c9:	41 6b f3 64          	imul   $0x64,%r11d,%esi
+        cprintf("wfairness: env %08x weight %4u: %3lu.%lu%% of CPU (expected %lu.%lu%%)\n",
+  8001cd:	89 f0                	mov    %esi,%eax
+  8001cf:	ba 00 00 00 00       	mov    $0x0,%edx
+  8001d4:	41 f7 f7             	div    %r15d
+  8001d7:	49 89 c1             	mov    %rax,%r9
+                (unsigned long)(runtime[i] * 1000 / total_runtime % 10),
+  8001da:	48 69 c1 e8 03 00 00 	imul   $0x3e8,%rcx,%rax
+  8001e1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8001e6:	48 f7 f3             	div    %rbx
+  8001e9:	49 89 c0             	mov    %rax,%r8
+  8001ec:	48 b8 cd cc cc cc cc 	movabs $0xcccccccccccccccd,%rax
+  8001f3:	cc cc cc 
+  8001f6:	49 f7 e0             	mul    %r8
+  8001f9:	48 c1 ea 03          	shr    $0x3,%rdx
+  8001fd:	4c 8d 14 92          	lea    (%rdx,%rdx,4),%r10
+  800201:	4d 01 d2             	add    %r10,%r10
+                (unsigned long)(runtime[i] * 100 / total_runtime),
+  800204:	48 8d 04 89          	lea    (%rcx,%rcx,4),%rax
+  800208:	48 8d 04 80          	lea    (%rax,%rax,4),%rax
+  80020c:	48 c1 e0 02          	shl    $0x2,%rax
+  800210:	ba 00 00 00 00       	mov    $0x0,%edx
+  800215:	48 f7 f3             	div    %rbx
+  800218:	48 89 c1             	mov    %rax,%rcx
+        cprintf("wfairness: env %08x weight %4u: %3lu.%lu%% of CPU (expected %lu.%lu%%)\n",
+  80021b:	44 89 df             	mov    %r11d,%edi
+  80021e:	c1 e7 0a             	shl    $0xa,%edi
+  800221:	42 8b 74 25 c0       	mov    -0x40(%rbp,%r12,1),%esi
+  800226:	48 83 ec 08          	sub    $0x8,%rsp
+                (unsigned long)(weights[i] * 1000 / total_weight % 10));
+  80022a:	41 69 c3 e8 03 00 00 	imul   $0x3e8,%r11d,%eax
+  800231:	ba 00 00 00 00       	mov    $0x0,%edx
+  800236:	41 f7 f7             	div    %r15d
+  800239:	89 c2                	mov    %eax,%edx
+  80023b:	49 0f af d5          	imul   %r13,%rdx
+  80023f:	48 c1 ea 23          	shr    $0x23,%rdx
+  800243:	8d 14 92             	lea    (%rdx,%rdx,4),%edx
+  800246:	01 d2                	add    %edx,%edx
+        cprintf("wfairness: env %08x weight %4u: %3lu.%lu%% of CPU (expected %lu.%lu%%)\n",
+  800248:	29 d0                	sub    %edx,%eax
+  80024a:	50                   	push   %rax
+  80024b:	4d 29 d0             	sub    %r10,%r8
+  80024e:	89 fa                	mov    %edi,%edx
+  800250:	48 bf f8 30 80 00 00 	movabs $0x8030f8,%rdi
+  800257:	00 00 00 
+  80025a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80025f:	49 ba 2d 05 80 00 00 	movabs $0x80052d,%r10
+  800266:	00 00 00 
+  800269:	41 ff d2             	call   *%r10
+    for (int i = 0; i < NSPINNERS; i++) {
+  80026c:	49 83 c4 04          	add    $0x4,%r12
+  800270:	48 83 c4 10          	add    $0x10,%rsp
+  800274:	49 83 fc 10          	cmp    $0x10,%r12
+  800278:	0f 85 42 ff ff ff    	jne    8001c0 <umain+0x19b>
+    }
+}
+  80027e:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800282:	5b                   	pop    %rbx
+  800283:	41 5c                	pop    %r12
+  800285:	41 5d                	pop    %r13
+  800287:	41 5e                	pop    %r14
+  800289:	41 5f                	pop    %r15
+  80028b:	5d                   	pop    %rbp
+  80028c:	c3                   	ret
+    uint64_t duration = (argc > 1 ? strtol(argv[1], NULL, 0) : 2) * 1000000000ULL;
+  80028d:	48 8b 7e 08          	mov    0x8(%rsi),%rdi
+  800291:	ba 00 00 00 00       	mov    $0x0,%edx
+  800296:	be 00 00 00 00       	mov    $0x0,%esi
+  80029b:	48 b8 c3 11 80 00 00 	movabs $0x8011c3,%rax
+  8002a2:	00 00 00 
+  8002a5:	ff d0                	call   *%rax
+  8002a7:	4c 69 f0 00 ca 9a 3b 	imul   $0x3b9aca00,%rax,%r14
+  8002ae:	e9 92 fd ff ff       	jmp    800045 <umain+0x20>
+        if (id < 0) panic("fork: %i", id);
+  8002b3:	89 c1                	mov    %eax,%ecx
+  8002b5:	48 ba c0 30 80 00 00 	movabs $0x8030c0,%rdx
+  8002bc:	00 00 00 
+  8002bf:	be 19 00 00 00       	mov    $0x19,%esi
+  8002c4:	48 bf c9 30 80 00 00 	movabs $0x8030c9,%rdi
+  8002cb:	00 00 00 
+  8002ce:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002d3:	49 b8 dd 03 80 00 00 	movabs $0x8003dd,%r8
+  8002da:	00 00 00 
+  8002dd:	41 ff d0             	call   *%r8
+            for (;;) asm volatile("pause");
+  8002e0:	f3 90                	pause
+  8002e2:	eb fc                	jmp    8002e0 <umain+0x2bb>
+        if (res < 0) panic("sys_env_set_weight: %i", res);
+  8002e4:	89 c1                	mov    %eax,%ecx
+  8002e6:	48 ba da 30 80 00 00 	movabs $0x8030da,%rdx
+  8002ed:	00 00 00 
+  8002f0:	be 1e 00 00 00       	mov    $0x1e,%esi
+  8002f5:	48 bf c9 30 80 00 00 	movabs $0x8030c9,%rdi
+  8002fc:	00 00 00 
+  8002ff:	b8 00 00 00 00       	mov    $0x0,%eax
+  800304:	49 b8 dd 03 80 00 00 	movabs $0x8003dd,%r8
+  80030b:	00 00 00 
+  80030e:	41 ff d0             	call   *%r8
+
+0000000000800311 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800311:	55                   	push   %rbp
+  800312:	48 89 e5             	mov    %rsp,%rbp
+  800315:	41 56                	push   %r14
+  800317:	41 55                	push   %r13
+  800319:	41 54                	push   %r12
+  80031b:	53                   	push   %rbx
+  80031c:	41 89 fd             	mov    %edi,%r13d
+  80031f:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800322:	48 ba d8 40 80 00 00 	movabs $0x8040d8,%rdx
+  800329:	00 00 00 
+  80032c:	48 b8 d8 40 80 00 00 	movabs $0x8040d8,%rax
+  800333:	00 00 00 
+  800336:	48 39 c2             	cmp    %rax,%rdx
+  800339:	73 17                	jae    800352 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  80033b:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  80033e:	49 89 c4             	mov    %rax,%r12
+  800341:	48 83 c3 08          	add    $0x8,%rbx
+  800345:	b8 00 00 00 00       	mov    $0x0,%eax
+  80034a:	ff 53 f8             	call   *-0x8(%rbx)
+  80034d:	4c 39 e3             	cmp    %r12,%rbx
+  800350:	72 ef                	jb     800341 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+    envid_t this_env_id = sys_getenvid();
+  800352:	48 b8 42 13 80 00 00 	movabs $0x801342,%rax
+  800359:	00 00 00 
+  80035c:	ff d0                	call   *%rax
+    thisenv = &((struct Env*)UENVS)[ENVX(this_env_id)];
+  80035e:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800363:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+  80036a:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  800371:	00 00 00 
+  800374:	48 01 d0             	add    %rdx,%rax
+  800377:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  80037e:	00 00 00 
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  800381:	45 85 ed             	test   %r13d,%r13d
+  800384:	7e 0d                	jle    800393 <libmain+0x82>
+  800386:	49 8b 06             	mov    (%r14),%rax
+  800389:	48 a3 00 40 80 00 00 	movabs %rax,0x804000
+  800390:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  800393:	4c 89 f6             	mov    %r14,%rsi
+  800396:	44 89 ef             	mov    %r13d,%edi
+  800399:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8003a0:	00 00 00 
+  8003a3:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8003a5:	48 b8 ba 03 80 00 00 	movabs $0x8003ba,%rax
+  8003ac:	00 00 00 
+  8003af:	ff d0                	call   *%rax
+#endif
+}
+  8003b1:	5b                   	pop    %rbx
+  8003b2:	41 5c                	pop    %r12
+  8003b4:	41 5d                	pop    %r13
+  8003b6:	41 5e                	pop    %r14
+  8003b8:	5d                   	pop    %rbp
+  8003b9:	c3                   	ret
+
+00000000008003ba <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8003ba:	55                   	push   %rbp
+  8003bb:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  8003be:	48 b8 fa 1b 80 00 00 	movabs $0x801bfa,%rax
+  8003c5:	00 00 00 
+  8003c8:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  8003ca:	bf 00 00 00 00       	mov    $0x0,%edi
+  8003cf:	48 b8 d7 12 80 00 00 	movabs $0x8012d7,%rax
+  8003d6:	00 00 00 
+  8003d9:	ff d0                	call   *%rax
+}
+  8003db:	5d                   	pop    %rbp
+  8003dc:	c3                   	ret
+
+00000000008003dd <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  8003dd:	55                   	push   %rbp
+  8003de:	48 89 e5             	mov    %rsp,%rbp
+  8003e1:	41 56                	push   %r14
+  8003e3:	41 55                	push   %r13
+  8003e5:	41 54                	push   %r12
+  8003e7:	53                   	push   %rbx
+  8003e8:	48 83 ec 50          	sub    $0x50,%rsp
+  8003ec:	49 89 fc             	mov    %rdi,%r12
+  8003ef:	41 89 f5             	mov    %esi,%r13d
+  8003f2:	48 89 d3             	mov    %rdx,%rbx
+  8003f5:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  8003f9:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  8003fd:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800401:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  800408:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80040c:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  800410:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  800414:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  800418:	48 b8 00 40 80 00 00 	movabs $0x804000,%rax
+  80041f:	00 00 00 
+  800422:	4c 8b 30             	mov    (%rax),%r14
+  800425:	48 b8 42 13 80 00 00 	movabs $0x801342,%rax
+  80042c:	00 00 00 
+  80042f:	ff d0                	call   *%rax
+  800431:	89 c6                	mov    %eax,%esi
+  800433:	45 89 e8             	mov    %r13d,%r8d
+  800436:	4c 89 e1             	mov    %r12,%rcx
+  800439:	4c 89 f2             	mov    %r14,%rdx
+  80043c:	48 bf 60 31 80 00 00 	movabs $0x803160,%rdi
+  800443:	00 00 00 
+  800446:	b8 00 00 00 00       	mov    $0x0,%eax
+  80044b:	49 bc 2d 05 80 00 00 	movabs $0x80052d,%r12
+  800452:	00 00 00 
+  800455:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  800458:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  80045c:	48 89 df             	mov    %rbx,%rdi
+  80045f:	48 b8 c9 04 80 00 00 	movabs $0x8004c9,%rax
+  800466:	00 00 00 
+  800469:	ff d0                	call   *%rax
+    cprintf("\n");
+  80046b:	48 bf 93 37 80 00 00 	movabs $0x803793,%rdi
+  800472:	00 00 00 
+  800475:	b8 00 00 00 00       	mov    $0x0,%eax
+  80047a:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  80047d:	cc                   	int3
+  80047e:	eb fd                	jmp    80047d <_panic+0xa0>
+
+0000000000800480 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  800480:	55                   	push   %rbp
+  800481:	48 89 e5             	mov    %rsp,%rbp
+  800484:	53                   	push   %rbx
+  800485:	48 83 ec 08          	sub    $0x8,%rsp
+  800489:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  80048c:	8b 06                	mov    (%rsi),%eax
+  80048e:	8d 50 01             	lea    0x1(%rax),%edx
+  800491:	89 16                	mov    %edx,(%rsi)
+  800493:	48 98                	cltq
+  800495:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  80049a:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  8004a0:	74 0a                	je     8004ac <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  8004a2:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  8004a6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8004aa:	c9                   	leave
+  8004ab:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  8004ac:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  8004b0:	be ff 00 00 00       	mov    $0xff,%esi
+  8004b5:	48 b8 79 12 80 00 00 	movabs $0x801279,%rax
+  8004bc:	00 00 00 
+  8004bf:	ff d0                	call   *%rax
+        state->offset = 0;
+  8004c1:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  8004c7:	eb d9                	jmp    8004a2 <putch+0x22>
+
+00000000008004c9 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  8004c9:	55                   	push   %rbp
+  8004ca:	48 89 e5             	mov    %rsp,%rbp
+  8004cd:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  8004d4:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  8004d7:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  8004de:	b9 21 00 00 00       	mov    $0x21,%ecx
+  8004e3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004e8:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  8004eb:	48 89 f1             	mov    %rsi,%rcx
+  8004ee:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  8004f5:	48 bf 80 04 80 00 00 	movabs $0x800480,%rdi
+  8004fc:	00 00 00 
+  8004ff:	48 b8 7d 06 80 00 00 	movabs $0x80067d,%rax
+  800506:	00 00 00 
+  800509:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  80050b:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  800512:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  800519:	48 b8 79 12 80 00 00 	movabs $0x801279,%rax
+  800520:	00 00 00 
+  800523:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  800525:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  80052b:	c9                   	leave
+  80052c:	c3                   	ret
+
+000000000080052d <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  80052d:	55                   	push   %rbp
+  80052e:	48 89 e5             	mov    %rsp,%rbp
+  800531:	48 83 ec 50          	sub    $0x50,%rsp
+  800535:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  800539:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  80053d:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800541:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800545:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  800549:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  800550:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800554:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800558:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80055c:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  800560:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  800564:	48 b8 c9 04 80 00 00 	movabs $0x8004c9,%rax
+  80056b:	00 00 00 
+  80056e:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  800570:	c9                   	leave
+  800571:	c3                   	ret
+
+0000000000800572 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  800572:	55                   	push   %rbp
+  800573:	48 89 e5             	mov    %rsp,%rbp
+  800576:	41 57                	push   %r15
+  800578:	41 56                	push   %r14
+  80057a:	41 55                	push   %r13
+  80057c:	41 54                	push   %r12
+  80057e:	53                   	push   %rbx
+  80057f:	48 83 ec 18          	sub    $0x18,%rsp
+  800583:	49 89 fc             	mov    %rdi,%r12
+  800586:	49 89 f5             	mov    %rsi,%r13
+  800589:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  80058d:	8b 45 10             	mov    0x10(%rbp),%eax
+  800590:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  800593:	41 89 cf             	mov    %ecx,%r15d
+  800596:	4c 39 fa             	cmp    %r15,%rdx
+  800599:	73 5b                	jae    8005f6 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  80059b:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  80059f:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  8005a3:	85 db                	test   %ebx,%ebx
+  8005a5:	7e 0e                	jle    8005b5 <print_num+0x43>
+            putch(padc, put_arg);
+  8005a7:	4c 89 ee             	mov    %r13,%rsi
+  8005aa:	44 89 f7             	mov    %r14d,%edi
+  8005ad:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  8005b0:	83 eb 01             	sub    $0x1,%ebx
+  8005b3:	75 f2                	jne    8005a7 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  8005b5:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  8005b9:	48 b9 94 31 80 00 00 	movabs $0x803194,%rcx
+  8005c0:	00 00 00 
+  8005c3:	48 b8 83 31 80 00 00 	movabs $0x803183,%rax
+  8005ca:	00 00 00 
+  8005cd:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  8005d1:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8005d5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005da:	49 f7 f7             	div    %r15
+  8005dd:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  8005e1:	4c 89 ee             	mov    %r13,%rsi
+  8005e4:	41 ff d4             	call   *%r12
+}
+  8005e7:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8005eb:	5b                   	pop    %rbx
+  8005ec:	41 5c                	pop    %r12
+  8005ee:	41 5d                	pop    %r13
+  8005f0:	41 5e                	pop    %r14
+  8005f2:	41 5f                	pop    %r15
+  8005f4:	5d                   	pop    %rbp
+  8005f5:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  8005f6:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8005fa:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005ff:	49 f7 f7             	div    %r15
+  800602:	48 83 ec 08          	sub    $0x8,%rsp
+  800606:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  80060a:	52                   	push   %rdx
+  80060b:	45 0f be c9          	movsbl %r9b,%r9d
+  80060f:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  800613:	48 89 c2             	mov    %rax,%rdx
+  800616:	48 b8 72 05 80 00 00 	movabs $0x800572,%rax
+  80061d:	00 00 00 
+  800620:	ff d0                	call   *%rax
+  800622:	48 83 c4 10          	add    $0x10,%rsp
+  800626:	eb 8d                	jmp    8005b5 <print_num+0x43>
+
+0000000000800628 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  800628:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  80062c:	48 8b 06             	mov    (%rsi),%rax
+  80062f:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  800633:	73 0a                	jae    80063f <sprintputch+0x17>
+        *state->start++ = ch;
+  800635:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800639:	48 89 16             	mov    %rdx,(%rsi)
+  80063c:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  80063f:	c3                   	ret
+
+0000000000800640 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  800640:	55                   	push   %rbp
+  800641:	48 89 e5             	mov    %rsp,%rbp
+  800644:	48 83 ec 50          	sub    $0x50,%rsp
+  800648:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80064c:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800650:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  800654:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  80065b:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80065f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800663:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800667:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  80066b:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80066f:	48 b8 7d 06 80 00 00 	movabs $0x80067d,%rax
+  800676:	00 00 00 
+  800679:	ff d0                	call   *%rax
+}
+  80067b:	c9                   	leave
+  80067c:	c3                   	ret
+
+000000000080067d <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  80067d:	55                   	push   %rbp
+  80067e:	48 89 e5             	mov    %rsp,%rbp
+  800681:	41 57                	push   %r15
+  800683:	41 56                	push   %r14
+  800685:	41 55                	push   %r13
+  800687:	41 54                	push   %r12
+  800689:	53                   	push   %rbx
+  80068a:	48 83 ec 38          	sub    $0x38,%rsp
+  80068e:	49 89 fe             	mov    %rdi,%r14
+  800691:	49 89 f5             	mov    %rsi,%r13
+  800694:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  800697:	48 8b 01             	mov    (%rcx),%rax
+  80069a:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  80069e:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  8006a2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006a6:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  8006aa:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  8006ae:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  8006b2:	0f b6 3b             	movzbl (%rbx),%edi
+  8006b5:	40 80 ff 25          	cmp    $0x25,%dil
+  8006b9:	74 18                	je     8006d3 <vprintfmt+0x56>
+            if (!ch) return;
+  8006bb:	40 84 ff             	test   %dil,%dil
+  8006be:	0f 84 b1 06 00 00    	je     800d75 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  8006c4:	40 0f b6 ff          	movzbl %dil,%edi
+  8006c8:	4c 89 ee             	mov    %r13,%rsi
+  8006cb:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  8006ce:	4c 89 e3             	mov    %r12,%rbx
+  8006d1:	eb db                	jmp    8006ae <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  8006d3:	be 00 00 00 00       	mov    $0x0,%esi
+  8006d8:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  8006dc:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  8006e1:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8006e7:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  8006ee:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8006f2:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  8006f7:	41 0f b6 04 24       	movzbl (%r12),%eax
+  8006fc:	88 45 a0             	mov    %al,-0x60(%rbp)
+  8006ff:	83 e8 23             	sub    $0x23,%eax
+  800702:	3c 57                	cmp    $0x57,%al
+  800704:	0f 87 51 06 00 00    	ja     800d5b <vprintfmt+0x6de>
+  80070a:	0f b6 c0             	movzbl %al,%eax
+  80070d:	48 b9 40 33 80 00 00 	movabs $0x803340,%rcx
+  800714:	00 00 00 
+  800717:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  80071a:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  80071d:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  800721:	eb cf                	jmp    8006f2 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  800723:	49 89 dc             	mov    %rbx,%r12
+  800726:	be 01 00 00 00       	mov    $0x1,%esi
+  80072b:	eb c5                	jmp    8006f2 <vprintfmt+0x75>
+            padc = ch;
+  80072d:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  800731:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800734:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800737:	eb b9                	jmp    8006f2 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800739:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80073c:	83 f8 2f             	cmp    $0x2f,%eax
+  80073f:	77 24                	ja     800765 <vprintfmt+0xe8>
+  800741:	89 c1                	mov    %eax,%ecx
+  800743:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  800747:	83 c0 08             	add    $0x8,%eax
+  80074a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80074d:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  800750:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  800753:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800757:	79 99                	jns    8006f2 <vprintfmt+0x75>
+                width = precision;
+  800759:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  80075d:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800763:	eb 8d                	jmp    8006f2 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800765:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  800769:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  80076d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800771:	eb da                	jmp    80074d <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  800773:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  800778:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  80077c:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  800782:	3c 39                	cmp    $0x39,%al
+  800784:	77 1c                	ja     8007a2 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  800786:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  80078a:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  80078e:	0f b6 c0             	movzbl %al,%eax
+  800791:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800796:	0f b6 03             	movzbl (%rbx),%eax
+  800799:	3c 39                	cmp    $0x39,%al
+  80079b:	76 e9                	jbe    800786 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  80079d:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  8007a0:	eb b1                	jmp    800753 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  8007a2:	49 89 dc             	mov    %rbx,%r12
+  8007a5:	eb ac                	jmp    800753 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  8007a7:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  8007aa:	85 c9                	test   %ecx,%ecx
+  8007ac:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007b1:	0f 49 c1             	cmovns %ecx,%eax
+  8007b4:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  8007b7:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8007ba:	e9 33 ff ff ff       	jmp    8006f2 <vprintfmt+0x75>
+            lflag++;
+  8007bf:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  8007c2:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8007c5:	e9 28 ff ff ff       	jmp    8006f2 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  8007ca:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007cd:	83 f8 2f             	cmp    $0x2f,%eax
+  8007d0:	77 19                	ja     8007eb <vprintfmt+0x16e>
+  8007d2:	89 c2                	mov    %eax,%edx
+  8007d4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007d8:	83 c0 08             	add    $0x8,%eax
+  8007db:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007de:	8b 3a                	mov    (%rdx),%edi
+  8007e0:	4c 89 ee             	mov    %r13,%rsi
+  8007e3:	41 ff d6             	call   *%r14
+            break;
+  8007e6:	e9 c3 fe ff ff       	jmp    8006ae <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  8007eb:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007ef:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007f3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007f7:	eb e5                	jmp    8007de <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  8007f9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007fc:	83 f8 2f             	cmp    $0x2f,%eax
+  8007ff:	77 5a                	ja     80085b <vprintfmt+0x1de>
+  800801:	89 c2                	mov    %eax,%edx
+  800803:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800807:	83 c0 08             	add    $0x8,%eax
+  80080a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  80080d:	8b 02                	mov    (%rdx),%eax
+  80080f:	89 c1                	mov    %eax,%ecx
+  800811:	f7 d9                	neg    %ecx
+  800813:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  800816:	83 f9 15             	cmp    $0x15,%ecx
+  800819:	7f 4e                	jg     800869 <vprintfmt+0x1ec>
+  80081b:	48 63 c1             	movslq %ecx,%rax
+  80081e:	48 ba 00 36 80 00 00 	movabs $0x803600,%rdx
+  800825:	00 00 00 
+  800828:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80082c:	48 85 c0             	test   %rax,%rax
+  80082f:	74 38                	je     800869 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  800831:	48 89 c1             	mov    %rax,%rcx
+  800834:	48 ba f9 37 80 00 00 	movabs $0x8037f9,%rdx
+  80083b:	00 00 00 
+  80083e:	4c 89 ee             	mov    %r13,%rsi
+  800841:	4c 89 f7             	mov    %r14,%rdi
+  800844:	b8 00 00 00 00       	mov    $0x0,%eax
+  800849:	49 b8 40 06 80 00 00 	movabs $0x800640,%r8
+  800850:	00 00 00 
+  800853:	41 ff d0             	call   *%r8
+  800856:	e9 53 fe ff ff       	jmp    8006ae <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  80085b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80085f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800863:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800867:	eb a4                	jmp    80080d <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  800869:	48 ba ac 31 80 00 00 	movabs $0x8031ac,%rdx
+  800870:	00 00 00 
+  800873:	4c 89 ee             	mov    %r13,%rsi
+  800876:	4c 89 f7             	mov    %r14,%rdi
+  800879:	b8 00 00 00 00       	mov    $0x0,%eax
+  80087e:	49 b8 40 06 80 00 00 	movabs $0x800640,%r8
+  800885:	00 00 00 
+  800888:	41 ff d0             	call   *%r8
+  80088b:	e9 1e fe ff ff       	jmp    8006ae <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800890:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800893:	83 f8 2f             	cmp    $0x2f,%eax
+  800896:	77 6c                	ja     800904 <vprintfmt+0x287>
+  800898:	89 c2                	mov    %eax,%edx
+  80089a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80089e:	83 c0 08             	add    $0x8,%eax
+  8008a1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008a4:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  8008a7:	48 85 d2             	test   %rdx,%rdx
+  8008aa:	48 b8 a5 31 80 00 00 	movabs $0x8031a5,%rax
+  8008b1:	00 00 00 
+  8008b4:	48 0f 45 c2          	cmovne %rdx,%rax
+  8008b8:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  8008bc:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8008c0:	7e 06                	jle    8008c8 <vprintfmt+0x24b>
+  8008c2:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  8008c6:	75 4a                	jne    800912 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8008c8:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8008cc:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8008d0:	0f b6 00             	movzbl (%rax),%eax
+  8008d3:	84 c0                	test   %al,%al
+  8008d5:	0f 85 9a 00 00 00    	jne    800975 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  8008db:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8008de:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  8008e2:	85 c0                	test   %eax,%eax
+  8008e4:	0f 8e c4 fd ff ff    	jle    8006ae <vprintfmt+0x31>
+  8008ea:	4c 89 ee             	mov    %r13,%rsi
+  8008ed:	bf 20 00 00 00       	mov    $0x20,%edi
+  8008f2:	41 ff d6             	call   *%r14
+  8008f5:	41 83 ec 01          	sub    $0x1,%r12d
+  8008f9:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  8008fd:	75 eb                	jne    8008ea <vprintfmt+0x26d>
+  8008ff:	e9 aa fd ff ff       	jmp    8006ae <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800904:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800908:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80090c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800910:	eb 92                	jmp    8008a4 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  800912:	49 63 f7             	movslq %r15d,%rsi
+  800915:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  800919:	48 b8 2f 0e 80 00 00 	movabs $0x800e2f,%rax
+  800920:	00 00 00 
+  800923:	ff d0                	call   *%rax
+  800925:	48 89 c2             	mov    %rax,%rdx
+  800928:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80092b:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  80092d:	8d 70 ff             	lea    -0x1(%rax),%esi
+  800930:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  800933:	85 c0                	test   %eax,%eax
+  800935:	7e 91                	jle    8008c8 <vprintfmt+0x24b>
+  800937:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  80093c:	4c 89 ee             	mov    %r13,%rsi
+  80093f:	44 89 e7             	mov    %r12d,%edi
+  800942:	41 ff d6             	call   *%r14
+  800945:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800949:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80094c:	83 f8 ff             	cmp    $0xffffffff,%eax
+  80094f:	75 eb                	jne    80093c <vprintfmt+0x2bf>
+  800951:	e9 72 ff ff ff       	jmp    8008c8 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800956:	0f b6 f8             	movzbl %al,%edi
+  800959:	4c 89 ee             	mov    %r13,%rsi
+  80095c:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  80095f:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800963:	49 83 c4 01          	add    $0x1,%r12
+  800967:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  80096d:	84 c0                	test   %al,%al
+  80096f:	0f 84 66 ff ff ff    	je     8008db <vprintfmt+0x25e>
+  800975:	45 85 ff             	test   %r15d,%r15d
+  800978:	78 0a                	js     800984 <vprintfmt+0x307>
+  80097a:	41 83 ef 01          	sub    $0x1,%r15d
+  80097e:	0f 88 57 ff ff ff    	js     8008db <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800984:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  800988:	74 cc                	je     800956 <vprintfmt+0x2d9>
+  80098a:	8d 50 e0             	lea    -0x20(%rax),%edx
+  80098d:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800992:	80 fa 5e             	cmp    $0x5e,%dl
+  800995:	77 c2                	ja     800959 <vprintfmt+0x2dc>
+  800997:	eb bd                	jmp    800956 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  800999:	40 84 f6             	test   %sil,%sil
+  80099c:	75 26                	jne    8009c4 <vprintfmt+0x347>
+    switch (lflag) {
+  80099e:	85 d2                	test   %edx,%edx
+  8009a0:	74 59                	je     8009fb <vprintfmt+0x37e>
+  8009a2:	83 fa 01             	cmp    $0x1,%edx
+  8009a5:	74 7b                	je     800a22 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  8009a7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009aa:	83 f8 2f             	cmp    $0x2f,%eax
+  8009ad:	0f 87 96 00 00 00    	ja     800a49 <vprintfmt+0x3cc>
+  8009b3:	89 c2                	mov    %eax,%edx
+  8009b5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009b9:	83 c0 08             	add    $0x8,%eax
+  8009bc:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009bf:	4c 8b 22             	mov    (%rdx),%r12
+  8009c2:	eb 17                	jmp    8009db <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  8009c4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009c7:	83 f8 2f             	cmp    $0x2f,%eax
+  8009ca:	77 21                	ja     8009ed <vprintfmt+0x370>
+  8009cc:	89 c2                	mov    %eax,%edx
+  8009ce:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009d2:	83 c0 08             	add    $0x8,%eax
+  8009d5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009d8:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  8009db:	4d 85 e4             	test   %r12,%r12
+  8009de:	78 7a                	js     800a5a <vprintfmt+0x3dd>
+            num = i;
+  8009e0:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  8009e3:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  8009e8:	e9 50 02 00 00       	jmp    800c3d <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8009ed:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009f1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009f5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009f9:	eb dd                	jmp    8009d8 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  8009fb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009fe:	83 f8 2f             	cmp    $0x2f,%eax
+  800a01:	77 11                	ja     800a14 <vprintfmt+0x397>
+  800a03:	89 c2                	mov    %eax,%edx
+  800a05:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a09:	83 c0 08             	add    $0x8,%eax
+  800a0c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a0f:	4c 63 22             	movslq (%rdx),%r12
+  800a12:	eb c7                	jmp    8009db <vprintfmt+0x35e>
+  800a14:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a18:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a1c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a20:	eb ed                	jmp    800a0f <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  800a22:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a25:	83 f8 2f             	cmp    $0x2f,%eax
+  800a28:	77 11                	ja     800a3b <vprintfmt+0x3be>
+  800a2a:	89 c2                	mov    %eax,%edx
+  800a2c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a30:	83 c0 08             	add    $0x8,%eax
+  800a33:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a36:	4c 8b 22             	mov    (%rdx),%r12
+  800a39:	eb a0                	jmp    8009db <vprintfmt+0x35e>
+  800a3b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a3f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a43:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a47:	eb ed                	jmp    800a36 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  800a49:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a4d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a51:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a55:	e9 65 ff ff ff       	jmp    8009bf <vprintfmt+0x342>
+                putch('-', put_arg);
+  800a5a:	4c 89 ee             	mov    %r13,%rsi
+  800a5d:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800a62:	41 ff d6             	call   *%r14
+                i = -i;
+  800a65:	49 f7 dc             	neg    %r12
+  800a68:	e9 73 ff ff ff       	jmp    8009e0 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  800a6d:	40 84 f6             	test   %sil,%sil
+  800a70:	75 32                	jne    800aa4 <vprintfmt+0x427>
+    switch (lflag) {
+  800a72:	85 d2                	test   %edx,%edx
+  800a74:	74 5d                	je     800ad3 <vprintfmt+0x456>
+  800a76:	83 fa 01             	cmp    $0x1,%edx
+  800a79:	0f 84 82 00 00 00    	je     800b01 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  800a7f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a82:	83 f8 2f             	cmp    $0x2f,%eax
+  800a85:	0f 87 a5 00 00 00    	ja     800b30 <vprintfmt+0x4b3>
+  800a8b:	89 c2                	mov    %eax,%edx
+  800a8d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a91:	83 c0 08             	add    $0x8,%eax
+  800a94:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a97:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800a9a:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  800a9f:	e9 99 01 00 00       	jmp    800c3d <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800aa4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800aa7:	83 f8 2f             	cmp    $0x2f,%eax
+  800aaa:	77 19                	ja     800ac5 <vprintfmt+0x448>
+  800aac:	89 c2                	mov    %eax,%edx
+  800aae:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ab2:	83 c0 08             	add    $0x8,%eax
+  800ab5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ab8:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800abb:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800ac0:	e9 78 01 00 00       	jmp    800c3d <vprintfmt+0x5c0>
+  800ac5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ac9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800acd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ad1:	eb e5                	jmp    800ab8 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  800ad3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ad6:	83 f8 2f             	cmp    $0x2f,%eax
+  800ad9:	77 18                	ja     800af3 <vprintfmt+0x476>
+  800adb:	89 c2                	mov    %eax,%edx
+  800add:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ae1:	83 c0 08             	add    $0x8,%eax
+  800ae4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ae7:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800ae9:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  800aee:	e9 4a 01 00 00       	jmp    800c3d <vprintfmt+0x5c0>
+  800af3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800af7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800afb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800aff:	eb e6                	jmp    800ae7 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  800b01:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b04:	83 f8 2f             	cmp    $0x2f,%eax
+  800b07:	77 19                	ja     800b22 <vprintfmt+0x4a5>
+  800b09:	89 c2                	mov    %eax,%edx
+  800b0b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b0f:	83 c0 08             	add    $0x8,%eax
+  800b12:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b15:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800b18:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  800b1d:	e9 1b 01 00 00       	jmp    800c3d <vprintfmt+0x5c0>
+  800b22:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b26:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b2a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b2e:	eb e5                	jmp    800b15 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  800b30:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b34:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b38:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b3c:	e9 56 ff ff ff       	jmp    800a97 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  800b41:	40 84 f6             	test   %sil,%sil
+  800b44:	75 2e                	jne    800b74 <vprintfmt+0x4f7>
+    switch (lflag) {
+  800b46:	85 d2                	test   %edx,%edx
+  800b48:	74 59                	je     800ba3 <vprintfmt+0x526>
+  800b4a:	83 fa 01             	cmp    $0x1,%edx
+  800b4d:	74 7f                	je     800bce <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  800b4f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b52:	83 f8 2f             	cmp    $0x2f,%eax
+  800b55:	0f 87 9f 00 00 00    	ja     800bfa <vprintfmt+0x57d>
+  800b5b:	89 c2                	mov    %eax,%edx
+  800b5d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b61:	83 c0 08             	add    $0x8,%eax
+  800b64:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b67:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800b6a:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  800b6f:	e9 c9 00 00 00       	jmp    800c3d <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800b74:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b77:	83 f8 2f             	cmp    $0x2f,%eax
+  800b7a:	77 19                	ja     800b95 <vprintfmt+0x518>
+  800b7c:	89 c2                	mov    %eax,%edx
+  800b7e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b82:	83 c0 08             	add    $0x8,%eax
+  800b85:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b88:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800b8b:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800b90:	e9 a8 00 00 00       	jmp    800c3d <vprintfmt+0x5c0>
+  800b95:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b99:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b9d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ba1:	eb e5                	jmp    800b88 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  800ba3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ba6:	83 f8 2f             	cmp    $0x2f,%eax
+  800ba9:	77 15                	ja     800bc0 <vprintfmt+0x543>
+  800bab:	89 c2                	mov    %eax,%edx
+  800bad:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800bb1:	83 c0 08             	add    $0x8,%eax
+  800bb4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800bb7:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  800bb9:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  800bbe:	eb 7d                	jmp    800c3d <vprintfmt+0x5c0>
+  800bc0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bc4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bc8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bcc:	eb e9                	jmp    800bb7 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  800bce:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bd1:	83 f8 2f             	cmp    $0x2f,%eax
+  800bd4:	77 16                	ja     800bec <vprintfmt+0x56f>
+  800bd6:	89 c2                	mov    %eax,%edx
+  800bd8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800bdc:	83 c0 08             	add    $0x8,%eax
+  800bdf:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800be2:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800be5:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  800bea:	eb 51                	jmp    800c3d <vprintfmt+0x5c0>
+  800bec:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bf0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bf4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bf8:	eb e8                	jmp    800be2 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  800bfa:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bfe:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c02:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c06:	e9 5c ff ff ff       	jmp    800b67 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  800c0b:	4c 89 ee             	mov    %r13,%rsi
+  800c0e:	bf 30 00 00 00       	mov    $0x30,%edi
+  800c13:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800c16:	4c 89 ee             	mov    %r13,%rsi
+  800c19:	bf 78 00 00 00       	mov    $0x78,%edi
+  800c1e:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800c21:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c24:	83 f8 2f             	cmp    $0x2f,%eax
+  800c27:	77 47                	ja     800c70 <vprintfmt+0x5f3>
+  800c29:	89 c2                	mov    %eax,%edx
+  800c2b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c2f:	83 c0 08             	add    $0x8,%eax
+  800c32:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c35:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800c38:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800c3d:	48 83 ec 08          	sub    $0x8,%rsp
+  800c41:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800c45:	0f 94 c0             	sete   %al
+  800c48:	0f b6 c0             	movzbl %al,%eax
+  800c4b:	50                   	push   %rax
+  800c4c:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800c51:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800c55:	4c 89 ee             	mov    %r13,%rsi
+  800c58:	4c 89 f7             	mov    %r14,%rdi
+  800c5b:	48 b8 72 05 80 00 00 	movabs $0x800572,%rax
+  800c62:	00 00 00 
+  800c65:	ff d0                	call   *%rax
+            break;
+  800c67:	48 83 c4 10          	add    $0x10,%rsp
+  800c6b:	e9 3e fa ff ff       	jmp    8006ae <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800c70:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c74:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c78:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c7c:	eb b7                	jmp    800c35 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  800c7e:	40 84 f6             	test   %sil,%sil
+  800c81:	75 2b                	jne    800cae <vprintfmt+0x631>
+    switch (lflag) {
+  800c83:	85 d2                	test   %edx,%edx
+  800c85:	74 56                	je     800cdd <vprintfmt+0x660>
+  800c87:	83 fa 01             	cmp    $0x1,%edx
+  800c8a:	74 7f                	je     800d0b <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800c8c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c8f:	83 f8 2f             	cmp    $0x2f,%eax
+  800c92:	0f 87 a2 00 00 00    	ja     800d3a <vprintfmt+0x6bd>
+  800c98:	89 c2                	mov    %eax,%edx
+  800c9a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c9e:	83 c0 08             	add    $0x8,%eax
+  800ca1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ca4:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800ca7:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800cac:	eb 8f                	jmp    800c3d <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800cae:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800cb1:	83 f8 2f             	cmp    $0x2f,%eax
+  800cb4:	77 19                	ja     800ccf <vprintfmt+0x652>
+  800cb6:	89 c2                	mov    %eax,%edx
+  800cb8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800cbc:	83 c0 08             	add    $0x8,%eax
+  800cbf:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800cc2:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800cc5:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800cca:	e9 6e ff ff ff       	jmp    800c3d <vprintfmt+0x5c0>
+  800ccf:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800cd3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800cd7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800cdb:	eb e5                	jmp    800cc2 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800cdd:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ce0:	83 f8 2f             	cmp    $0x2f,%eax
+  800ce3:	77 18                	ja     800cfd <vprintfmt+0x680>
+  800ce5:	89 c2                	mov    %eax,%edx
+  800ce7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ceb:	83 c0 08             	add    $0x8,%eax
+  800cee:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800cf1:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800cf3:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800cf8:	e9 40 ff ff ff       	jmp    800c3d <vprintfmt+0x5c0>
+  800cfd:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d01:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d05:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d09:	eb e6                	jmp    800cf1 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800d0b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d0e:	83 f8 2f             	cmp    $0x2f,%eax
+  800d11:	77 19                	ja     800d2c <vprintfmt+0x6af>
+  800d13:	89 c2                	mov    %eax,%edx
+  800d15:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d19:	83 c0 08             	add    $0x8,%eax
+  800d1c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d1f:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800d22:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800d27:	e9 11 ff ff ff       	jmp    800c3d <vprintfmt+0x5c0>
+  800d2c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d30:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d34:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d38:	eb e5                	jmp    800d1f <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800d3a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d3e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d42:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d46:	e9 59 ff ff ff       	jmp    800ca4 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800d4b:	4c 89 ee             	mov    %r13,%rsi
+  800d4e:	bf 25 00 00 00       	mov    $0x25,%edi
+  800d53:	41 ff d6             	call   *%r14
+            break;
+  800d56:	e9 53 f9 ff ff       	jmp    8006ae <vprintfmt+0x31>
+            putch('%', put_arg);
+  800d5b:	4c 89 ee             	mov    %r13,%rsi
+  800d5e:	bf 25 00 00 00       	mov    $0x25,%edi
+  800d63:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800d66:	48 83 eb 01          	sub    $0x1,%rbx
+  800d6a:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800d6e:	75 f6                	jne    800d66 <vprintfmt+0x6e9>
+  800d70:	e9 39 f9 ff ff       	jmp    8006ae <vprintfmt+0x31>
+}
+  800d75:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800d79:	5b                   	pop    %rbx
+  800d7a:	41 5c                	pop    %r12
+  800d7c:	41 5d                	pop    %r13
+  800d7e:	41 5e                	pop    %r14
+  800d80:	41 5f                	pop    %r15
+  800d82:	5d                   	pop    %rbp
+  800d83:	c3                   	ret
+
+0000000000800d84 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800d84:	55                   	push   %rbp
+  800d85:	48 89 e5             	mov    %rsp,%rbp
+  800d88:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800d8c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800d90:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800d95:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800d99:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800da0:	48 85 ff             	test   %rdi,%rdi
+  800da3:	74 2b                	je     800dd0 <vsnprintf+0x4c>
+  800da5:	48 85 f6             	test   %rsi,%rsi
+  800da8:	74 26                	je     800dd0 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800daa:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800dae:	48 bf 28 06 80 00 00 	movabs $0x800628,%rdi
+  800db5:	00 00 00 
+  800db8:	48 b8 7d 06 80 00 00 	movabs $0x80067d,%rax
+  800dbf:	00 00 00 
+  800dc2:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800dc4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800dc8:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800dcb:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800dce:	c9                   	leave
+  800dcf:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800dd0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800dd5:	eb f7                	jmp    800dce <vsnprintf+0x4a>
+
+0000000000800dd7 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800dd7:	55                   	push   %rbp
+  800dd8:	48 89 e5             	mov    %rsp,%rbp
+  800ddb:	48 83 ec 50          	sub    $0x50,%rsp
+  800ddf:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800de3:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800de7:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800deb:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800df2:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800df6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800dfa:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800dfe:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800e02:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800e06:	48 b8 84 0d 80 00 00 	movabs $0x800d84,%rax
+  800e0d:	00 00 00 
+  800e10:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800e12:	c9                   	leave
+  800e13:	c3                   	ret
+
+0000000000800e14 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800e14:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800e17:	74 10                	je     800e29 <strlen+0x15>
+    size_t n = 0;
+  800e19:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800e1e:	48 83 c0 01          	add    $0x1,%rax
+  800e22:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800e26:	75 f6                	jne    800e1e <strlen+0xa>
+  800e28:	c3                   	ret
+    size_t n = 0;
+  800e29:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800e2e:	c3                   	ret
+
+0000000000800e2f <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800e2f:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800e32:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800e37:	48 85 f6             	test   %rsi,%rsi
+  800e3a:	74 11                	je     800e4d <strnlen+0x1e>
+  800e3c:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800e40:	74 0c                	je     800e4e <strnlen+0x1f>
+  800e42:	48 83 c2 01          	add    $0x1,%rdx
+  800e46:	48 39 d0             	cmp    %rdx,%rax
+  800e49:	75 f1                	jne    800e3c <strnlen+0xd>
+  800e4b:	eb 04                	jmp    800e51 <strnlen+0x22>
+  800e4d:	c3                   	ret
+  800e4e:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800e51:	c3                   	ret
+
+0000000000800e52 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800e52:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800e55:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e5a:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800e5e:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800e61:	48 83 c2 01          	add    $0x1,%rdx
+  800e65:	84 c9                	test   %cl,%cl
+  800e67:	75 f1                	jne    800e5a <strcpy+0x8>
+        ;
+    return res;
+}
+  800e69:	c3                   	ret
+
+0000000000800e6a <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800e6a:	55                   	push   %rbp
+  800e6b:	48 89 e5             	mov    %rsp,%rbp
+  800e6e:	41 54                	push   %r12
+  800e70:	53                   	push   %rbx
+  800e71:	48 89 fb             	mov    %rdi,%rbx
+  800e74:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800e77:	48 b8 14 0e 80 00 00 	movabs $0x800e14,%rax
+  800e7e:	00 00 00 
+  800e81:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800e83:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800e87:	4c 89 e6             	mov    %r12,%rsi
+  800e8a:	48 b8 52 0e 80 00 00 	movabs $0x800e52,%rax
+  800e91:	00 00 00 
+  800e94:	ff d0                	call   *%rax
+    return dst;
+}
+  800e96:	48 89 d8             	mov    %rbx,%rax
+  800e99:	5b                   	pop    %rbx
+  800e9a:	41 5c                	pop    %r12
+  800e9c:	5d                   	pop    %rbp
+  800e9d:	c3                   	ret
+
+0000000000800e9e <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800e9e:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800ea1:	48 85 d2             	test   %rdx,%rdx
+  800ea4:	74 1f                	je     800ec5 <strncpy+0x27>
+  800ea6:	48 01 fa             	add    %rdi,%rdx
+  800ea9:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800eac:	48 83 c1 01          	add    $0x1,%rcx
+  800eb0:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800eb4:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800eb8:	41 80 f8 01          	cmp    $0x1,%r8b
+  800ebc:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800ec0:	48 39 ca             	cmp    %rcx,%rdx
+  800ec3:	75 e7                	jne    800eac <strncpy+0xe>
+    }
+    return ret;
+}
+  800ec5:	c3                   	ret
+
+0000000000800ec6 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800ec6:	48 89 f8             	mov    %rdi,%rax
+  800ec9:	48 85 d2             	test   %rdx,%rdx
+  800ecc:	74 24                	je     800ef2 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800ece:	48 83 ea 01          	sub    $0x1,%rdx
+  800ed2:	74 1b                	je     800eef <strlcpy+0x29>
+  800ed4:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800ed8:	0f b6 16             	movzbl (%rsi),%edx
+  800edb:	84 d2                	test   %dl,%dl
+  800edd:	74 10                	je     800eef <strlcpy+0x29>
+            *dst++ = *src++;
+  800edf:	48 83 c6 01          	add    $0x1,%rsi
+  800ee3:	48 83 c0 01          	add    $0x1,%rax
+  800ee7:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800eea:	48 39 c8             	cmp    %rcx,%rax
+  800eed:	75 e9                	jne    800ed8 <strlcpy+0x12>
+        *dst = '\0';
+  800eef:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800ef2:	48 29 f8             	sub    %rdi,%rax
+}
+  800ef5:	c3                   	ret
+
+0000000000800ef6 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800ef6:	0f b6 07             	movzbl (%rdi),%eax
+  800ef9:	84 c0                	test   %al,%al
+  800efb:	74 13                	je     800f10 <strcmp+0x1a>
+  800efd:	38 06                	cmp    %al,(%rsi)
+  800eff:	75 0f                	jne    800f10 <strcmp+0x1a>
+  800f01:	48 83 c7 01          	add    $0x1,%rdi
+  800f05:	48 83 c6 01          	add    $0x1,%rsi
+  800f09:	0f b6 07             	movzbl (%rdi),%eax
+  800f0c:	84 c0                	test   %al,%al
+  800f0e:	75 ed                	jne    800efd <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800f10:	0f b6 c0             	movzbl %al,%eax
+  800f13:	0f b6 16             	movzbl (%rsi),%edx
+  800f16:	29 d0                	sub    %edx,%eax
+}
+  800f18:	c3                   	ret
+
+0000000000800f19 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800f19:	48 85 d2             	test   %rdx,%rdx
+  800f1c:	74 1f                	je     800f3d <strncmp+0x24>
+  800f1e:	0f b6 07             	movzbl (%rdi),%eax
+  800f21:	84 c0                	test   %al,%al
+  800f23:	74 1e                	je     800f43 <strncmp+0x2a>
+  800f25:	3a 06                	cmp    (%rsi),%al
+  800f27:	75 1a                	jne    800f43 <strncmp+0x2a>
+  800f29:	48 83 c7 01          	add    $0x1,%rdi
+  800f2d:	48 83 c6 01          	add    $0x1,%rsi
+  800f31:	48 83 ea 01          	sub    $0x1,%rdx
+  800f35:	75 e7                	jne    800f1e <strncmp+0x5>
+
+    if (!n) return 0;
+  800f37:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f3c:	c3                   	ret
+  800f3d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f42:	c3                   	ret
+  800f43:	48 85 d2             	test   %rdx,%rdx
+  800f46:	74 09                	je     800f51 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800f48:	0f b6 07             	movzbl (%rdi),%eax
+  800f4b:	0f b6 16             	movzbl (%rsi),%edx
+  800f4e:	29 d0                	sub    %edx,%eax
+  800f50:	c3                   	ret
+    if (!n) return 0;
+  800f51:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800f56:	c3                   	ret
+
+0000000000800f57 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800f57:	0f b6 17             	movzbl (%rdi),%edx
+  800f5a:	84 d2                	test   %dl,%dl
+  800f5c:	74 18                	je     800f76 <strchr+0x1f>
+        if (*str == c) {
+  800f5e:	0f be d2             	movsbl %dl,%edx
+  800f61:	39 f2                	cmp    %esi,%edx
+  800f63:	74 17                	je     800f7c <strchr+0x25>
+    for (; *str; str++) {
+  800f65:	48 83 c7 01          	add    $0x1,%rdi
+  800f69:	0f b6 17             	movzbl (%rdi),%edx
+  800f6c:	84 d2                	test   %dl,%dl
+  800f6e:	75 ee                	jne    800f5e <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800f70:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f75:	c3                   	ret
+  800f76:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f7b:	c3                   	ret
+  800f7c:	48 89 f8             	mov    %rdi,%rax
+}
+  800f7f:	c3                   	ret
+
+0000000000800f80 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800f80:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800f83:	0f b6 17             	movzbl (%rdi),%edx
+  800f86:	84 d2                	test   %dl,%dl
+  800f88:	74 13                	je     800f9d <strfind+0x1d>
+  800f8a:	0f be d2             	movsbl %dl,%edx
+  800f8d:	39 f2                	cmp    %esi,%edx
+  800f8f:	74 0b                	je     800f9c <strfind+0x1c>
+  800f91:	48 83 c0 01          	add    $0x1,%rax
+  800f95:	0f b6 10             	movzbl (%rax),%edx
+  800f98:	84 d2                	test   %dl,%dl
+  800f9a:	75 ee                	jne    800f8a <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800f9c:	c3                   	ret
+  800f9d:	c3                   	ret
+
+0000000000800f9e <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800f9e:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800fa1:	48 89 f8             	mov    %rdi,%rax
+  800fa4:	48 f7 d8             	neg    %rax
+  800fa7:	83 e0 07             	and    $0x7,%eax
+  800faa:	49 89 d1             	mov    %rdx,%r9
+  800fad:	49 29 c1             	sub    %rax,%r9
+  800fb0:	78 36                	js     800fe8 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800fb2:	40 0f b6 c6          	movzbl %sil,%eax
+  800fb6:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800fbd:	01 01 01 
+  800fc0:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800fc4:	40 f6 c7 07          	test   $0x7,%dil
+  800fc8:	75 38                	jne    801002 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800fca:	4c 89 c9             	mov    %r9,%rcx
+  800fcd:	48 c1 f9 03          	sar    $0x3,%rcx
+  800fd1:	74 0c                	je     800fdf <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800fd3:	fc                   	cld
+  800fd4:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800fd7:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800fdb:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800fdf:	4d 85 c9             	test   %r9,%r9
+  800fe2:	75 45                	jne    801029 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800fe4:	4c 89 c0             	mov    %r8,%rax
+  800fe7:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800fe8:	48 85 d2             	test   %rdx,%rdx
+  800feb:	74 f7                	je     800fe4 <memset+0x46>
+  800fed:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800ff0:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800ff3:	48 83 c0 01          	add    $0x1,%rax
+  800ff7:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  800ffb:	48 39 c2             	cmp    %rax,%rdx
+  800ffe:	75 f3                	jne    800ff3 <memset+0x55>
+  801000:	eb e2                	jmp    800fe4 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  801002:	40 f6 c7 01          	test   $0x1,%dil
+  801006:	74 06                	je     80100e <memset+0x70>
+  801008:	88 07                	mov    %al,(%rdi)
+  80100a:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  80100e:	40 f6 c7 02          	test   $0x2,%dil
+  801012:	74 07                	je     80101b <memset+0x7d>
+  801014:	66 89 07             	mov    %ax,(%rdi)
+  801017:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  80101b:	40 f6 c7 04          	test   $0x4,%dil
+  80101f:	74 a9                	je     800fca <memset+0x2c>
+  801021:	89 07                	mov    %eax,(%rdi)
+  801023:	48 83 c7 04          	add    $0x4,%rdi
+  801027:	eb a1                	jmp    800fca <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  801029:	41 f6 c1 04          	test   $0x4,%r9b
+  80102d:	74 06                	je     801035 <memset+0x97>
+  80102f:	89 07                	mov    %eax,(%rdi)
+  801031:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  801035:	41 f6 c1 02          	test   $0x2,%r9b
+  801039:	74 07                	je     801042 <memset+0xa4>
+  80103b:	66 89 07             	mov    %ax,(%rdi)
+  80103e:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  801042:	41 f6 c1 01          	test   $0x1,%r9b
+  801046:	74 9c                	je     800fe4 <memset+0x46>
+  801048:	88 07                	mov    %al,(%rdi)
+  80104a:	eb 98                	jmp    800fe4 <memset+0x46>
+
+000000000080104c <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  80104c:	48 89 f8             	mov    %rdi,%rax
+  80104f:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  801052:	48 39 fe             	cmp    %rdi,%rsi
+  801055:	73 3b                	jae    801092 <memmove+0x46>
+  801057:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  80105b:	48 39 d7             	cmp    %rdx,%rdi
+  80105e:	73 32                	jae    801092 <memmove+0x46>
+        s += n;
+        d += n;
+  801060:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  801064:	48 89 d6             	mov    %rdx,%rsi
+  801067:	48 09 fe             	or     %rdi,%rsi
+  80106a:	48 09 ce             	or     %rcx,%rsi
+  80106d:	40 f6 c6 07          	test   $0x7,%sil
+  801071:	75 12                	jne    801085 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  801073:	48 83 ef 08          	sub    $0x8,%rdi
+  801077:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  80107b:	48 c1 e9 03          	shr    $0x3,%rcx
+  80107f:	fd                   	std
+  801080:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  801083:	fc                   	cld
+  801084:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  801085:	48 83 ef 01          	sub    $0x1,%rdi
+  801089:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  80108d:	fd                   	std
+  80108e:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  801090:	eb f1                	jmp    801083 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  801092:	48 89 f2             	mov    %rsi,%rdx
+  801095:	48 09 c2             	or     %rax,%rdx
+  801098:	48 09 ca             	or     %rcx,%rdx
+  80109b:	f6 c2 07             	test   $0x7,%dl
+  80109e:	75 0c                	jne    8010ac <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  8010a0:	48 c1 e9 03          	shr    $0x3,%rcx
+  8010a4:	48 89 c7             	mov    %rax,%rdi
+  8010a7:	fc                   	cld
+  8010a8:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  8010ab:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  8010ac:	48 89 c7             	mov    %rax,%rdi
+  8010af:	fc                   	cld
+  8010b0:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  8010b2:	c3                   	ret
+
+00000000008010b3 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  8010b3:	55                   	push   %rbp
+  8010b4:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  8010b7:	48 b8 4c 10 80 00 00 	movabs $0x80104c,%rax
+  8010be:	00 00 00 
+  8010c1:	ff d0                	call   *%rax
+}
+  8010c3:	5d                   	pop    %rbp
+  8010c4:	c3                   	ret
+
+00000000008010c5 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  8010c5:	55                   	push   %rbp
+  8010c6:	48 89 e5             	mov    %rsp,%rbp
+  8010c9:	41 57                	push   %r15
+  8010cb:	41 56                	push   %r14
+  8010cd:	41 55                	push   %r13
+  8010cf:	41 54                	push   %r12
+  8010d1:	53                   	push   %rbx
+  8010d2:	48 83 ec 08          	sub    $0x8,%rsp
+  8010d6:	49 89 fe             	mov    %rdi,%r14
+  8010d9:	49 89 f7             	mov    %rsi,%r15
+  8010dc:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  8010df:	48 89 f7             	mov    %rsi,%rdi
+  8010e2:	48 b8 14 0e 80 00 00 	movabs $0x800e14,%rax
+  8010e9:	00 00 00 
+  8010ec:	ff d0                	call   *%rax
+  8010ee:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  8010f1:	48 89 de             	mov    %rbx,%rsi
+  8010f4:	4c 89 f7             	mov    %r14,%rdi
+  8010f7:	48 b8 2f 0e 80 00 00 	movabs $0x800e2f,%rax
+  8010fe:	00 00 00 
+  801101:	ff d0                	call   *%rax
+  801103:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  801106:	48 39 c3             	cmp    %rax,%rbx
+  801109:	74 36                	je     801141 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  80110b:	48 89 d8             	mov    %rbx,%rax
+  80110e:	4c 29 e8             	sub    %r13,%rax
+  801111:	49 39 c4             	cmp    %rax,%r12
+  801114:	73 31                	jae    801147 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  801116:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  80111b:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  80111f:	4c 89 fe             	mov    %r15,%rsi
+  801122:	48 b8 b3 10 80 00 00 	movabs $0x8010b3,%rax
+  801129:	00 00 00 
+  80112c:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  80112e:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  801132:	48 83 c4 08          	add    $0x8,%rsp
+  801136:	5b                   	pop    %rbx
+  801137:	41 5c                	pop    %r12
+  801139:	41 5d                	pop    %r13
+  80113b:	41 5e                	pop    %r14
+  80113d:	41 5f                	pop    %r15
+  80113f:	5d                   	pop    %rbp
+  801140:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  801141:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  801145:	eb eb                	jmp    801132 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  801147:	48 83 eb 01          	sub    $0x1,%rbx
+  80114b:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  80114f:	48 89 da             	mov    %rbx,%rdx
+  801152:	4c 89 fe             	mov    %r15,%rsi
+  801155:	48 b8 b3 10 80 00 00 	movabs $0x8010b3,%rax
+  80115c:	00 00 00 
+  80115f:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  801161:	49 01 de             	add    %rbx,%r14
+  801164:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  801169:	eb c3                	jmp    80112e <strlcat+0x69>
+
+000000000080116b <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  80116b:	48 85 d2             	test   %rdx,%rdx
+  80116e:	74 2d                	je     80119d <memcmp+0x32>
+  801170:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  801175:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  801179:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  80117e:	44 38 c1             	cmp    %r8b,%cl
+  801181:	75 0f                	jne    801192 <memcmp+0x27>
+    while (n-- > 0) {
+  801183:	48 83 c0 01          	add    $0x1,%rax
+  801187:	48 39 c2             	cmp    %rax,%rdx
+  80118a:	75 e9                	jne    801175 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  80118c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801191:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  801192:	0f b6 c1             	movzbl %cl,%eax
+  801195:	45 0f b6 c0          	movzbl %r8b,%r8d
+  801199:	44 29 c0             	sub    %r8d,%eax
+  80119c:	c3                   	ret
+    return 0;
+  80119d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8011a2:	c3                   	ret
+
+00000000008011a3 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  8011a3:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  8011a7:	48 39 c7             	cmp    %rax,%rdi
+  8011aa:	73 0f                	jae    8011bb <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  8011ac:	40 38 37             	cmp    %sil,(%rdi)
+  8011af:	74 0e                	je     8011bf <memfind+0x1c>
+    for (; src < end; src++) {
+  8011b1:	48 83 c7 01          	add    $0x1,%rdi
+  8011b5:	48 39 f8             	cmp    %rdi,%rax
+  8011b8:	75 f2                	jne    8011ac <memfind+0x9>
+  8011ba:	c3                   	ret
+  8011bb:	48 89 f8             	mov    %rdi,%rax
+  8011be:	c3                   	ret
+  8011bf:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  8011c2:	c3                   	ret
+
+00000000008011c3 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  8011c3:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  8011c6:	0f b6 37             	movzbl (%rdi),%esi
+  8011c9:	40 80 fe 20          	cmp    $0x20,%sil
+  8011cd:	74 06                	je     8011d5 <strtol+0x12>
+  8011cf:	40 80 fe 09          	cmp    $0x9,%sil
+  8011d3:	75 13                	jne    8011e8 <strtol+0x25>
+  8011d5:	48 83 c7 01          	add    $0x1,%rdi
+  8011d9:	0f b6 37             	movzbl (%rdi),%esi
+  8011dc:	40 80 fe 20          	cmp    $0x20,%sil
+  8011e0:	74 f3                	je     8011d5 <strtol+0x12>
+  8011e2:	40 80 fe 09          	cmp    $0x9,%sil
+  8011e6:	74 ed                	je     8011d5 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  8011e8:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  8011eb:	83 e0 fd             	and    $0xfffffffd,%eax
+  8011ee:	3c 01                	cmp    $0x1,%al
+  8011f0:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8011f4:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  8011fa:	75 0f                	jne    80120b <strtol+0x48>
+  8011fc:	80 3f 30             	cmpb   $0x30,(%rdi)
+  8011ff:	74 14                	je     801215 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  801201:	85 d2                	test   %edx,%edx
+  801203:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801208:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  80120b:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  801210:	4c 63 ca             	movslq %edx,%r9
+  801213:	eb 36                	jmp    80124b <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801215:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  801219:	74 0f                	je     80122a <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  80121b:	85 d2                	test   %edx,%edx
+  80121d:	75 ec                	jne    80120b <strtol+0x48>
+        s++;
+  80121f:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  801223:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  801228:	eb e1                	jmp    80120b <strtol+0x48>
+        s += 2;
+  80122a:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  80122e:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  801233:	eb d6                	jmp    80120b <strtol+0x48>
+            dig -= '0';
+  801235:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  801238:	44 0f b6 c1          	movzbl %cl,%r8d
+  80123c:	41 39 d0             	cmp    %edx,%r8d
+  80123f:	7d 21                	jge    801262 <strtol+0x9f>
+        val = val * base + dig;
+  801241:	49 0f af c1          	imul   %r9,%rax
+  801245:	0f b6 c9             	movzbl %cl,%ecx
+  801248:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  80124b:	48 83 c7 01          	add    $0x1,%rdi
+  80124f:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  801253:	80 f9 39             	cmp    $0x39,%cl
+  801256:	76 dd                	jbe    801235 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  801258:	80 f9 7b             	cmp    $0x7b,%cl
+  80125b:	77 05                	ja     801262 <strtol+0x9f>
+            dig -= 'a' - 10;
+  80125d:	83 e9 57             	sub    $0x57,%ecx
+  801260:	eb d6                	jmp    801238 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  801262:	4d 85 d2             	test   %r10,%r10
+  801265:	74 03                	je     80126a <strtol+0xa7>
+  801267:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  80126a:	48 89 c2             	mov    %rax,%rdx
+  80126d:	48 f7 da             	neg    %rdx
+  801270:	40 80 fe 2d          	cmp    $0x2d,%sil
+  801274:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  801278:	c3                   	ret
+
+0000000000801279 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  801279:	55                   	push   %rbp
+  80127a:	48 89 e5             	mov    %rsp,%rbp
+  80127d:	53                   	push   %rbx
+  80127e:	48 89 fa             	mov    %rdi,%rdx
+  801281:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801284:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801289:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80128e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801293:	be 00 00 00 00       	mov    $0x0,%esi
+  801298:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80129e:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  8012a0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012a4:	c9                   	leave
+  8012a5:	c3                   	ret
+
+00000000008012a6 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  8012a6:	55                   	push   %rbp
+  8012a7:	48 89 e5             	mov    %rsp,%rbp
+  8012aa:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8012ab:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8012b0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012b5:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8012ba:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012bf:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012c4:	be 00 00 00 00       	mov    $0x0,%esi
+  8012c9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8012cf:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  8012d1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012d5:	c9                   	leave
+  8012d6:	c3                   	ret
+
+00000000008012d7 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  8012d7:	55                   	push   %rbp
+  8012d8:	48 89 e5             	mov    %rsp,%rbp
+  8012db:	53                   	push   %rbx
+  8012dc:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  8012e0:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8012e3:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8012e8:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8012ed:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012f2:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012f7:	be 00 00 00 00       	mov    $0x0,%esi
+  8012fc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801302:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801304:	48 85 c0             	test   %rax,%rax
+  801307:	7f 06                	jg     80130f <sys_env_destroy+0x38>
+}
+  801309:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80130d:	c9                   	leave
+  80130e:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80130f:	49 89 c0             	mov    %rax,%r8
+  801312:	b9 03 00 00 00       	mov    $0x3,%ecx
+  801317:	48 ba d0 36 80 00 00 	movabs $0x8036d0,%rdx
+  80131e:	00 00 00 
+  801321:	be 26 00 00 00       	mov    $0x26,%esi
+  801326:	48 bf ef 36 80 00 00 	movabs $0x8036ef,%rdi
+  80132d:	00 00 00 
+  801330:	b8 00 00 00 00       	mov    $0x0,%eax
+  801335:	49 b9 dd 03 80 00 00 	movabs $0x8003dd,%r9
+  80133c:	00 00 00 
+  80133f:	41 ff d1             	call   *%r9
+
+0000000000801342 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  801342:	55                   	push   %rbp
+  801343:	48 89 e5             	mov    %rsp,%rbp
+  801346:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801347:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80134c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801351:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801356:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80135b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801360:	be 00 00 00 00       	mov    $0x0,%esi
+  801365:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80136b:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  80136d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801371:	c9                   	leave
+  801372:	c3                   	ret
+
+0000000000801373 <sys_yield>:
+
+void
+sys_yield(void) {
+  801373:	55                   	push   %rbp
+  801374:	48 89 e5             	mov    %rsp,%rbp
+  801377:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  801378:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80137d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801382:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801387:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80138c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801391:	be 00 00 00 00       	mov    $0x0,%esi
+  801396:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80139c:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  80139e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013a2:	c9                   	leave
+  8013a3:	c3                   	ret
+
+00000000008013a4 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  8013a4:	55                   	push   %rbp
+  8013a5:	48 89 e5             	mov    %rsp,%rbp
+  8013a8:	53                   	push   %rbx
+  8013a9:	48 89 fa             	mov    %rdi,%rdx
+  8013ac:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8013af:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8013b4:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  8013bb:	00 00 00 
+  8013be:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013c3:	be 00 00 00 00       	mov    $0x0,%esi
+  8013c8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013ce:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  8013d0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013d4:	c9                   	leave
+  8013d5:	c3                   	ret
+
+00000000008013d6 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  8013d6:	55                   	push   %rbp
+  8013d7:	48 89 e5             	mov    %rsp,%rbp
+  8013da:	53                   	push   %rbx
+  8013db:	49 89 f8             	mov    %rdi,%r8
+  8013de:	48 89 d3             	mov    %rdx,%rbx
+  8013e1:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8013e4:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8013e9:	4c 89 c2             	mov    %r8,%rdx
+  8013ec:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013ef:	be 00 00 00 00       	mov    $0x0,%esi
+  8013f4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013fa:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  8013fc:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801400:	c9                   	leave
+  801401:	c3                   	ret
+
+0000000000801402 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  801402:	55                   	push   %rbp
+  801403:	48 89 e5             	mov    %rsp,%rbp
+  801406:	53                   	push   %rbx
+  801407:	48 83 ec 08          	sub    $0x8,%rsp
+  80140b:	89 f8                	mov    %edi,%eax
+  80140d:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  801410:	48 63 f9             	movslq %ecx,%rdi
+  801413:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801416:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80141b:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80141e:	be 00 00 00 00       	mov    $0x0,%esi
+  801423:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801429:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80142b:	48 85 c0             	test   %rax,%rax
+  80142e:	7f 06                	jg     801436 <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  801430:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801434:	c9                   	leave
+  801435:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801436:	49 89 c0             	mov    %rax,%r8
+  801439:	b9 04 00 00 00       	mov    $0x4,%ecx
+  80143e:	48 ba d0 36 80 00 00 	movabs $0x8036d0,%rdx
+  801445:	00 00 00 
+  801448:	be 26 00 00 00       	mov    $0x26,%esi
+  80144d:	48 bf ef 36 80 00 00 	movabs $0x8036ef,%rdi
+  801454:	00 00 00 
+  801457:	b8 00 00 00 00       	mov    $0x0,%eax
+  80145c:	49 b9 dd 03 80 00 00 	movabs $0x8003dd,%r9
+  801463:	00 00 00 
+  801466:	41 ff d1             	call   *%r9
+
+0000000000801469 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801469:	55                   	push   %rbp
+  80146a:	48 89 e5             	mov    %rsp,%rbp
+  80146d:	53                   	push   %rbx
+  80146e:	48 83 ec 08          	sub    $0x8,%rsp
+  801472:	89 f8                	mov    %edi,%eax
+  801474:	49 89 f2             	mov    %rsi,%r10
+  801477:	48 89 cf             	mov    %rcx,%rdi
+  80147a:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  80147d:	48 63 da             	movslq %edx,%rbx
+  801480:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801483:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801488:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80148b:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  80148e:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801490:	48 85 c0             	test   %rax,%rax
+  801493:	7f 06                	jg     80149b <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  801495:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801499:	c9                   	leave
+  80149a:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80149b:	49 89 c0             	mov    %rax,%r8
+  80149e:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8014a3:	48 ba d0 36 80 00 00 	movabs $0x8036d0,%rdx
+  8014aa:	00 00 00 
+  8014ad:	be 26 00 00 00       	mov    $0x26,%esi
+  8014b2:	48 bf ef 36 80 00 00 	movabs $0x8036ef,%rdi
+  8014b9:	00 00 00 
+  8014bc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014c1:	49 b9 dd 03 80 00 00 	movabs $0x8003dd,%r9
+  8014c8:	00 00 00 
+  8014cb:	41 ff d1             	call   *%r9
+
+00000000008014ce <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  8014ce:	55                   	push   %rbp
+  8014cf:	48 89 e5             	mov    %rsp,%rbp
+  8014d2:	53                   	push   %rbx
+  8014d3:	48 83 ec 08          	sub    $0x8,%rsp
+  8014d7:	48 89 f1             	mov    %rsi,%rcx
+  8014da:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  8014dd:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8014e0:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8014e5:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014ea:	be 00 00 00 00       	mov    $0x0,%esi
+  8014ef:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8014f5:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8014f7:	48 85 c0             	test   %rax,%rax
+  8014fa:	7f 06                	jg     801502 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  8014fc:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801500:	c9                   	leave
+  801501:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801502:	49 89 c0             	mov    %rax,%r8
+  801505:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80150a:	48 ba d0 36 80 00 00 	movabs $0x8036d0,%rdx
+  801511:	00 00 00 
+  801514:	be 26 00 00 00       	mov    $0x26,%esi
+  801519:	48 bf ef 36 80 00 00 	movabs $0x8036ef,%rdi
+  801520:	00 00 00 
+  801523:	b8 00 00 00 00       	mov    $0x0,%eax
+  801528:	49 b9 dd 03 80 00 00 	movabs $0x8003dd,%r9
+  80152f:	00 00 00 
+  801532:	41 ff d1             	call   *%r9
+
+0000000000801535 <sys_region_batch>:
+
+int
+sys_region_batch(const struct RegionOp *ops, size_t count) {
+  801535:	55                   	push   %rbp
+  801536:	48 89 e5             	mov    %rsp,%rbp
+  801539:	53                   	push   %rbx
+  80153a:	48 83 ec 08          	sub    $0x8,%rsp
+  80153e:	48 89 fa             	mov    %rdi,%rdx
+  801541:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801544:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801549:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80154e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801553:	be 00 00 00 00       	mov    $0x0,%esi
+  801558:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80155e:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801560:	48 85 c0             	test   %rax,%rax
+  801563:	7f 06                	jg     80156b <sys_region_batch+0x36>
+        else
+            platform_asan_unpoison(va, ops[i].size);
+    }
+#endif
+    return res;
+}
+  801565:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801569:	c9                   	leave
+  80156a:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80156b:	49 89 c0             	mov    %rax,%r8
+  80156e:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  801573:	48 ba d0 36 80 00 00 	movabs $0x8036d0,%rdx
+  80157a:	00 00 00 
+  80157d:	be 26 00 00 00       	mov    $0x26,%esi
+  801582:	48 bf ef 36 80 00 00 	movabs $0x8036ef,%rdi
+  801589:	00 00 00 
+  80158c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801591:	49 b9 dd 03 80 00 00 	movabs $0x8003dd,%r9
+  801598:	00 00 00 
+  80159b:	41 ff d1             	call   *%r9
+
+000000000080159e <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  80159e:	55                   	push   %rbp
+  80159f:	48 89 e5             	mov    %rsp,%rbp
+  8015a2:	53                   	push   %rbx
+  8015a3:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  8015a7:	48 63 ce             	movslq %esi,%rcx
+  8015aa:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8015ad:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8015b2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015b7:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8015bc:	be 00 00 00 00       	mov    $0x0,%esi
+  8015c1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8015c7:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8015c9:	48 85 c0             	test   %rax,%rax
+  8015cc:	7f 06                	jg     8015d4 <sys_env_set_status+0x36>
+}
+  8015ce:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015d2:	c9                   	leave
+  8015d3:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8015d4:	49 89 c0             	mov    %rax,%r8
+  8015d7:	b9 09 00 00 00       	mov    $0x9,%ecx
+  8015dc:	48 ba d0 36 80 00 00 	movabs $0x8036d0,%rdx
+  8015e3:	00 00 00 
+  8015e6:	be 26 00 00 00       	mov    $0x26,%esi
+  8015eb:	48 bf ef 36 80 00 00 	movabs $0x8036ef,%rdi
+  8015f2:	00 00 00 
+  8015f5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015fa:	49 b9 dd 03 80 00 00 	movabs $0x8003dd,%r9
+  801601:	00 00 00 
+  801604:	41 ff d1             	call   *%r9
+
+0000000000801607 <sys_env_set_weight>:
+
+int
+sys_env_set_weight(envid_t envid, uint32_t weight) {
+  801607:	55                   	push   %rbp
+  801608:	48 89 e5             	mov    %rsp,%rbp
+  80160b:	53                   	push   %rbx
+  80160c:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_weight, 1, envid, weight, 0, 0, 0, 0);
+  801610:	89 f1                	mov    %esi,%ecx
+  801612:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801615:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80161a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80161f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801624:	be 00 00 00 00       	mov    $0x0,%esi
+  801629:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80162f:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801631:	48 85 c0             	test   %rax,%rax
+  801634:	7f 06                	jg     80163c <sys_env_set_weight+0x35>
+}
+  801636:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80163a:	c9                   	leave
+  80163b:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80163c:	49 89 c0             	mov    %rax,%r8
+  80163f:	b9 10 00 00 00       	mov    $0x10,%ecx
+  801644:	48 ba d0 36 80 00 00 	movabs $0x8036d0,%rdx
+  80164b:	00 00 00 
+  80164e:	be 26 00 00 00       	mov    $0x26,%esi
+  801653:	48 bf ef 36 80 00 00 	movabs $0x8036ef,%rdi
+  80165a:	00 00 00 
+  80165d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801662:	49 b9 dd 03 80 00 00 	movabs $0x8003dd,%r9
+  801669:	00 00 00 
+  80166c:	41 ff d1             	call   *%r9
+
+000000000080166f <sys_env_set_rt>:
+
+int
+sys_env_set_rt(envid_t envid, uint64_t period, uint64_t budget, uint64_t deadline) {
+  80166f:	55                   	push   %rbp
+  801670:	48 89 e5             	mov    %rsp,%rbp
+  801673:	53                   	push   %rbx
+  801674:	48 83 ec 08          	sub    $0x8,%rsp
+  801678:	89 f8                	mov    %edi,%eax
+  80167a:	48 89 d3             	mov    %rdx,%rbx
+  80167d:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_env_set_rt, 1, envid, period, budget, deadline, 0, 0);
+  801680:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801683:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801688:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80168b:	be 00 00 00 00       	mov    $0x0,%esi
+  801690:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801696:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801698:	48 85 c0             	test   %rax,%rax
+  80169b:	7f 06                	jg     8016a3 <sys_env_set_rt+0x34>
+}
+  80169d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8016a1:	c9                   	leave
+  8016a2:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8016a3:	49 89 c0             	mov    %rax,%r8
+  8016a6:	b9 11 00 00 00       	mov    $0x11,%ecx
+  8016ab:	48 ba d0 36 80 00 00 	movabs $0x8036d0,%rdx
+  8016b2:	00 00 00 
+  8016b5:	be 26 00 00 00       	mov    $0x26,%esi
+  8016ba:	48 bf ef 36 80 00 00 	movabs $0x8036ef,%rdi
+  8016c1:	00 00 00 
+  8016c4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016c9:	49 b9 dd 03 80 00 00 	movabs $0x8003dd,%r9
+  8016d0:	00 00 00 
+  8016d3:	41 ff d1             	call   *%r9
+
+00000000008016d6 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  8016d6:	55                   	push   %rbp
+  8016d7:	48 89 e5             	mov    %rsp,%rbp
+  8016da:	53                   	push   %rbx
+  8016db:	48 83 ec 08          	sub    $0x8,%rsp
+  8016df:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  8016e2:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8016e5:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8016ea:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016ef:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8016f4:	be 00 00 00 00       	mov    $0x0,%esi
+  8016f9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8016ff:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801701:	48 85 c0             	test   %rax,%rax
+  801704:	7f 06                	jg     80170c <sys_env_set_trapframe+0x36>
+}
+  801706:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80170a:	c9                   	leave
+  80170b:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80170c:	49 89 c0             	mov    %rax,%r8
+  80170f:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  801714:	48 ba d0 36 80 00 00 	movabs $0x8036d0,%rdx
+  80171b:	00 00 00 
+  80171e:	be 26 00 00 00       	mov    $0x26,%esi
+  801723:	48 bf ef 36 80 00 00 	movabs $0x8036ef,%rdi
+  80172a:	00 00 00 
+  80172d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801732:	49 b9 dd 03 80 00 00 	movabs $0x8003dd,%r9
+  801739:	00 00 00 
+  80173c:	41 ff d1             	call   *%r9
+
+000000000080173f <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  80173f:	55                   	push   %rbp
+  801740:	48 89 e5             	mov    %rsp,%rbp
+  801743:	53                   	push   %rbx
+  801744:	48 83 ec 08          	sub    $0x8,%rsp
+  801748:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  80174b:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80174e:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801753:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801758:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80175d:	be 00 00 00 00       	mov    $0x0,%esi
+  801762:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801768:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80176a:	48 85 c0             	test   %rax,%rax
+  80176d:	7f 06                	jg     801775 <sys_env_set_pgfault_upcall+0x36>
+}
+  80176f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801773:	c9                   	leave
+  801774:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801775:	49 89 c0             	mov    %rax,%r8
+  801778:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  80177d:	48 ba d0 36 80 00 00 	movabs $0x8036d0,%rdx
+  801784:	00 00 00 
+  801787:	be 26 00 00 00       	mov    $0x26,%esi
+  80178c:	48 bf ef 36 80 00 00 	movabs $0x8036ef,%rdi
+  801793:	00 00 00 
+  801796:	b8 00 00 00 00       	mov    $0x0,%eax
+  80179b:	49 b9 dd 03 80 00 00 	movabs $0x8003dd,%r9
+  8017a2:	00 00 00 
+  8017a5:	41 ff d1             	call   *%r9
+
+00000000008017a8 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  8017a8:	55                   	push   %rbp
+  8017a9:	48 89 e5             	mov    %rsp,%rbp
+  8017ac:	53                   	push   %rbx
+  8017ad:	89 f8                	mov    %edi,%eax
+  8017af:	49 89 f1             	mov    %rsi,%r9
+  8017b2:	48 89 d3             	mov    %rdx,%rbx
+  8017b5:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  8017b8:	49 63 f0             	movslq %r8d,%rsi
+  8017bb:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8017be:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8017c3:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8017c6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8017cc:	cd 30                	int    $0x30
+}
+  8017ce:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8017d2:	c9                   	leave
+  8017d3:	c3                   	ret
+
+00000000008017d4 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  8017d4:	55                   	push   %rbp
+  8017d5:	48 89 e5             	mov    %rsp,%rbp
+  8017d8:	53                   	push   %rbx
+  8017d9:	48 83 ec 08          	sub    $0x8,%rsp
+  8017dd:	48 89 fa             	mov    %rdi,%rdx
+  8017e0:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8017e3:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8017e8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017ed:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8017f2:	be 00 00 00 00       	mov    $0x0,%esi
+  8017f7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8017fd:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8017ff:	48 85 c0             	test   %rax,%rax
+  801802:	7f 06                	jg     80180a <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801804:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801808:	c9                   	leave
+  801809:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80180a:	49 89 c0             	mov    %rax,%r8
+  80180d:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  801812:	48 ba d0 36 80 00 00 	movabs $0x8036d0,%rdx
+  801819:	00 00 00 
+  80181c:	be 26 00 00 00       	mov    $0x26,%esi
+  801821:	48 bf ef 36 80 00 00 	movabs $0x8036ef,%rdi
+  801828:	00 00 00 
+  80182b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801830:	49 b9 dd 03 80 00 00 	movabs $0x8003dd,%r9
+  801837:	00 00 00 
+  80183a:	41 ff d1             	call   *%r9
+
+000000000080183d <fork>:
+ * Hint:
+ *   Use sys_map_region, it can perform address space copying in one call
+ *   Remember to fix "thisenv" in the child process.
+ */
+envid_t
+fork(void) {
+  80183d:	55                   	push   %rbp
+  80183e:	48 89 e5             	mov    %rsp,%rbp
+  801841:	41 55                	push   %r13
+  801843:	41 54                	push   %r12
+  801845:	53                   	push   %rbx
+  801846:	48 83 ec 08          	sub    $0x8,%rsp
+
+/* This must be inlined. Exercise for reader: why? */
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+    envid_t ret;
+    asm volatile("int %2"
+  80184a:	b8 08 00 00 00       	mov    $0x8,%eax
+  80184f:	cd 30                	int    $0x30
+  801851:	41 89 c5             	mov    %eax,%r13d
+    // LAB 9: Your code here
+
+    envid_t child_id = sys_exofork();
+    if (child_id < 0) {
+  801854:	85 c0                	test   %eax,%eax
+  801856:	0f 88 ae 00 00 00    	js     80190a <fork+0xcd>
+  80185c:	89 c3                	mov    %eax,%ebx
+        return child_id;
+    }
+    if (child_id == 0) {
+  80185e:	0f 84 b4 00 00 00    	je     801918 <fork+0xdb>
+        thisenv = &envs[ENVX(sys_getenvid())];
+        return 0;
+    }
+    int res = sys_map_region(0, NULL, child_id, NULL, MAX_USER_ADDRESS, PROT_ALL | PROT_LAZY | PROT_COMBINE);
+  801864:	41 b9 df 01 00 00    	mov    $0x1df,%r9d
+  80186a:	49 b8 00 00 00 00 80 	movabs $0x8000000000,%r8
+  801871:	00 00 00 
+  801874:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801879:	89 c2                	mov    %eax,%edx
+  80187b:	be 00 00 00 00       	mov    $0x0,%esi
+  801880:	bf 00 00 00 00       	mov    $0x0,%edi
+  801885:	48 b8 69 14 80 00 00 	movabs $0x801469,%rax
+  80188c:	00 00 00 
+  80188f:	ff d0                	call   *%rax
+  801891:	41 89 c4             	mov    %eax,%r12d
+    if (res < 0) {
+  801894:	85 c0                	test   %eax,%eax
+  801896:	78 5d                	js     8018f5 <fork+0xb8>
+        goto error;
+    }
+    res = sys_env_set_pgfault_upcall(child_id, envs[ENVX(sys_getenvid())].env_pgfault_upcall);
+  801898:	48 b8 42 13 80 00 00 	movabs $0x801342,%rax
+  80189f:	00 00 00 
+  8018a2:	ff d0                	call   *%rax
+  8018a4:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8018a9:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+  8018b0:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8018b7:	00 00 00 
+  8018ba:	48 01 d0             	add    %rdx,%rax
+  8018bd:	48 8b b0 88 01 00 00 	mov    0x188(%rax),%rsi
+  8018c4:	44 89 ef             	mov    %r13d,%edi
+  8018c7:	48 b8 3f 17 80 00 00 	movabs $0x80173f,%rax
+  8018ce:	00 00 00 
+  8018d1:	ff d0                	call   *%rax
+  8018d3:	41 89 c4             	mov    %eax,%r12d
+    if (res < 0) {
+  8018d6:	85 c0                	test   %eax,%eax
+  8018d8:	78 1b                	js     8018f5 <fork+0xb8>
+        goto error;
+    }
+    res = sys_env_set_status(child_id, ENV_RUNNABLE);
+  8018da:	be 02 00 00 00       	mov    $0x2,%esi
+  8018df:	44 89 ef             	mov    %r13d,%edi
+  8018e2:	48 b8 9e 15 80 00 00 	movabs $0x80159e,%rax
+  8018e9:	00 00 00 
+  8018ec:	ff d0                	call   *%rax
+  8018ee:	41 89 c4             	mov    %eax,%r12d
+    if (res < 0) {
+  8018f1:	85 c0                	test   %eax,%eax
+  8018f3:	79 15                	jns    80190a <fork+0xcd>
+        goto error;
+    }
+    return child_id;
+error:
+    ;
+    int res2 = sys_env_destroy(child_id);
+  8018f5:	89 df                	mov    %ebx,%edi
+  8018f7:	48 b8 d7 12 80 00 00 	movabs $0x8012d7,%rax
+  8018fe:	00 00 00 
+  801901:	ff d0                	call   *%rax
+    if (res2 < 0) {
+  801903:	85 c0                	test   %eax,%eax
+  801905:	78 42                	js     801949 <fork+0x10c>
+        panic("Fork double fault");
+    }
+    return res;
+  801907:	45 89 e5             	mov    %r12d,%r13d
+}
+  80190a:	44 89 e8             	mov    %r13d,%eax
+  80190d:	48 83 c4 08          	add    $0x8,%rsp
+  801911:	5b                   	pop    %rbx
+  801912:	41 5c                	pop    %r12
+  801914:	41 5d                	pop    %r13
+  801916:	5d                   	pop    %rbp
+  801917:	c3                   	ret
+        thisenv = &envs[ENVX(sys_getenvid())];
+  801918:	48 b8 42 13 80 00 00 	movabs $0x801342,%rax
+  80191f:	00 00 00 
+  801922:	ff d0                	call   *%rax
+  801924:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801929:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+  801930:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  801937:	00 00 00 
+  80193a:	48 01 d0             	add    %rdx,%rax
+  80193d:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  801944:	00 00 00 
+        return 0;
+  801947:	eb c1                	jmp    80190a <fork+0xcd>
+        panic("Fork double fault");
+  801949:	48 ba fd 36 80 00 00 	movabs $0x8036fd,%rdx
+  801950:	00 00 00 
+  801953:	be 2f 00 00 00       	mov    $0x2f,%esi
+  801958:	48 bf 0f 37 80 00 00 	movabs $0x80370f,%rdi
+  80195f:	00 00 00 
+  801962:	b8 00 00 00 00       	mov    $0x0,%eax
+  801967:	48 b9 dd 03 80 00 00 	movabs $0x8003dd,%rcx
+  80196e:	00 00 00 
+  801971:	ff d1                	call   *%rcx
+
+0000000000801973 <sfork>:
+
+envid_t
+sfork() {
+  801973:	55                   	push   %rbp
+  801974:	48 89 e5             	mov    %rsp,%rbp
+    panic("sfork() is not implemented");
+  801977:	48 ba 1a 37 80 00 00 	movabs $0x80371a,%rdx
+  80197e:	00 00 00 
+  801981:	be 36 00 00 00       	mov    $0x36,%esi
+  801986:	48 bf 0f 37 80 00 00 	movabs $0x80370f,%rdi
+  80198d:	00 00 00 
+  801990:	b8 00 00 00 00       	mov    $0x0,%eax
+  801995:	48 b9 dd 03 80 00 00 	movabs $0x8003dd,%rcx
+  80199c:	00 00 00 
+  80199f:	ff d1                	call   *%rcx
+
+00000000008019a1 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8019a1:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8019a8:	ff ff ff 
+  8019ab:	48 01 f8             	add    %rdi,%rax
+  8019ae:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  8019b2:	c3                   	ret
+
+00000000008019b3 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8019b3:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8019ba:	ff ff ff 
+  8019bd:	48 01 f8             	add    %rdi,%rax
+  8019c0:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  8019c4:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  8019ca:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  8019ce:	c3                   	ret
+
+00000000008019cf <fd_alloc_from>:
+}
+
+/* Like fd_alloc(), but only considers fds starting from fdnum,
+ * so that several fds can be found before their pages are allocated */
+int
+fd_alloc_from(int fdnum, struct Fd **fd_store) {
+  8019cf:	55                   	push   %rbp
+  8019d0:	48 89 e5             	mov    %rsp,%rbp
+  8019d3:	41 57                	push   %r15
+  8019d5:	41 56                	push   %r14
+  8019d7:	41 55                	push   %r13
+  8019d9:	41 54                	push   %r12
+  8019db:	53                   	push   %rbx
+  8019dc:	48 83 ec 08          	sub    $0x8,%rsp
+  8019e0:	49 89 f7             	mov    %rsi,%r15
+    for (int i = MAX(fdnum, 0); i < MAXFD; i++) {
+  8019e3:	85 ff                	test   %edi,%edi
+  8019e5:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8019eb:	44 0f 49 e7          	cmovns %edi,%r12d
+  8019ef:	83 ff 1f             	cmp    $0x1f,%edi
+  8019f2:	7f 37                	jg     801a2b <fd_alloc_from+0x5c>
+  8019f4:	49 63 dc             	movslq %r12d,%rbx
+  8019f7:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  8019fe:	48 c1 e3 0c          	shl    $0xc,%rbx
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  801a02:	49 be d8 2a 80 00 00 	movabs $0x802ad8,%r14
+  801a09:	00 00 00 
+        struct Fd *fd = INDEX2FD(i);
+  801a0c:	49 89 dd             	mov    %rbx,%r13
+        if (!(get_prot(fd) & PROT_R)) {
+  801a0f:	48 89 df             	mov    %rbx,%rdi
+  801a12:	41 ff d6             	call   *%r14
+  801a15:	83 e0 04             	and    $0x4,%eax
+  801a18:	74 1c                	je     801a36 <fd_alloc_from+0x67>
+    for (int i = MAX(fdnum, 0); i < MAXFD; i++) {
+  801a1a:	41 83 c4 01          	add    $0x1,%r12d
+  801a1e:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801a25:	41 83 fc 1f          	cmp    $0x1f,%r12d
+  801a29:	7e e1                	jle    801a0c <fd_alloc_from+0x3d>
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  801a2b:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801a31:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  801a36:	4d 89 2f             	mov    %r13,(%r15)
+}
+  801a39:	48 83 c4 08          	add    $0x8,%rsp
+  801a3d:	5b                   	pop    %rbx
+  801a3e:	41 5c                	pop    %r12
+  801a40:	41 5d                	pop    %r13
+  801a42:	41 5e                	pop    %r14
+  801a44:	41 5f                	pop    %r15
+  801a46:	5d                   	pop    %rbp
+  801a47:	c3                   	ret
+
+0000000000801a48 <fd_alloc>:
+fd_alloc(struct Fd **fd_store) {
+  801a48:	55                   	push   %rbp
+  801a49:	48 89 e5             	mov    %rsp,%rbp
+  801a4c:	48 89 fe             	mov    %rdi,%rsi
+    return fd_alloc_from(0, fd_store);
+  801a4f:	bf 00 00 00 00       	mov    $0x0,%edi
+  801a54:	48 b8 cf 19 80 00 00 	movabs $0x8019cf,%rax
+  801a5b:	00 00 00 
+  801a5e:	ff d0                	call   *%rax
+}
+  801a60:	5d                   	pop    %rbp
+  801a61:	c3                   	ret
+
+0000000000801a62 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  801a62:	83 ff 1f             	cmp    $0x1f,%edi
+  801a65:	77 39                	ja     801aa0 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  801a67:	55                   	push   %rbp
+  801a68:	48 89 e5             	mov    %rsp,%rbp
+  801a6b:	41 54                	push   %r12
+  801a6d:	53                   	push   %rbx
+  801a6e:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  801a71:	48 63 df             	movslq %edi,%rbx
+  801a74:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  801a7b:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  801a7f:	48 89 df             	mov    %rbx,%rdi
+  801a82:	48 b8 d8 2a 80 00 00 	movabs $0x802ad8,%rax
+  801a89:	00 00 00 
+  801a8c:	ff d0                	call   *%rax
+  801a8e:	a8 04                	test   $0x4,%al
+  801a90:	74 14                	je     801aa6 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  801a92:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  801a96:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801a9b:	5b                   	pop    %rbx
+  801a9c:	41 5c                	pop    %r12
+  801a9e:	5d                   	pop    %rbp
+  801a9f:	c3                   	ret
+        return -E_INVAL;
+  801aa0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801aa5:	c3                   	ret
+        return -E_INVAL;
+  801aa6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801aab:	eb ee                	jmp    801a9b <fd_lookup+0x39>
+
+0000000000801aad <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  801aad:	55                   	push   %rbp
+  801aae:	48 89 e5             	mov    %rsp,%rbp
+  801ab1:	41 54                	push   %r12
+  801ab3:	53                   	push   %rbx
+  801ab4:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  801ab7:	48 b8 c0 37 80 00 00 	movabs $0x8037c0,%rax
+  801abe:	00 00 00 
+  801ac1:	48 bb 20 40 80 00 00 	movabs $0x804020,%rbx
+  801ac8:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  801acb:	39 3b                	cmp    %edi,(%rbx)
+  801acd:	74 47                	je     801b16 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  801acf:	48 83 c0 08          	add    $0x8,%rax
+  801ad3:	48 8b 18             	mov    (%rax),%rbx
+  801ad6:	48 85 db             	test   %rbx,%rbx
+  801ad9:	75 f0                	jne    801acb <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801adb:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801ae2:	00 00 00 
+  801ae5:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+  801aeb:	89 fa                	mov    %edi,%edx
+  801aed:	48 bf 38 37 80 00 00 	movabs $0x803738,%rdi
+  801af4:	00 00 00 
+  801af7:	b8 00 00 00 00       	mov    $0x0,%eax
+  801afc:	48 b9 2d 05 80 00 00 	movabs $0x80052d,%rcx
+  801b03:	00 00 00 
+  801b06:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  801b08:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  801b0d:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  801b11:	5b                   	pop    %rbx
+  801b12:	41 5c                	pop    %r12
+  801b14:	5d                   	pop    %rbp
+  801b15:	c3                   	ret
+            return 0;
+  801b16:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b1b:	eb f0                	jmp    801b0d <dev_lookup+0x60>
+
+0000000000801b1d <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  801b1d:	55                   	push   %rbp
+  801b1e:	48 89 e5             	mov    %rsp,%rbp
+  801b21:	41 55                	push   %r13
+  801b23:	41 54                	push   %r12
+  801b25:	53                   	push   %rbx
+  801b26:	48 83 ec 18          	sub    $0x18,%rsp
+  801b2a:	48 89 fb             	mov    %rdi,%rbx
+  801b2d:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801b30:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  801b37:	ff ff ff 
+  801b3a:	48 01 df             	add    %rbx,%rdi
+  801b3d:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  801b41:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801b45:	48 b8 62 1a 80 00 00 	movabs $0x801a62,%rax
+  801b4c:	00 00 00 
+  801b4f:	ff d0                	call   *%rax
+  801b51:	41 89 c5             	mov    %eax,%r13d
+  801b54:	85 c0                	test   %eax,%eax
+  801b56:	78 06                	js     801b5e <fd_close+0x41>
+  801b58:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  801b5c:	74 1a                	je     801b78 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  801b5e:	45 84 e4             	test   %r12b,%r12b
+  801b61:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b66:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  801b6a:	44 89 e8             	mov    %r13d,%eax
+  801b6d:	48 83 c4 18          	add    $0x18,%rsp
+  801b71:	5b                   	pop    %rbx
+  801b72:	41 5c                	pop    %r12
+  801b74:	41 5d                	pop    %r13
+  801b76:	5d                   	pop    %rbp
+  801b77:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801b78:	8b 3b                	mov    (%rbx),%edi
+  801b7a:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801b7e:	48 b8 ad 1a 80 00 00 	movabs $0x801aad,%rax
+  801b85:	00 00 00 
+  801b88:	ff d0                	call   *%rax
+  801b8a:	41 89 c5             	mov    %eax,%r13d
+  801b8d:	85 c0                	test   %eax,%eax
+  801b8f:	78 1b                	js     801bac <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  801b91:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801b95:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801b99:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801b9f:	48 85 c0             	test   %rax,%rax
+  801ba2:	74 08                	je     801bac <fd_close+0x8f>
+  801ba4:	48 89 df             	mov    %rbx,%rdi
+  801ba7:	ff d0                	call   *%rax
+  801ba9:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801bac:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801bb1:	48 89 de             	mov    %rbx,%rsi
+  801bb4:	bf 00 00 00 00       	mov    $0x0,%edi
+  801bb9:	48 b8 ce 14 80 00 00 	movabs $0x8014ce,%rax
+  801bc0:	00 00 00 
+  801bc3:	ff d0                	call   *%rax
+    return res;
+  801bc5:	eb a3                	jmp    801b6a <fd_close+0x4d>
+
+0000000000801bc7 <close>:
+
+int
+close(int fdnum) {
+  801bc7:	55                   	push   %rbp
+  801bc8:	48 89 e5             	mov    %rsp,%rbp
+  801bcb:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  801bcf:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801bd3:	48 b8 62 1a 80 00 00 	movabs $0x801a62,%rax
+  801bda:	00 00 00 
+  801bdd:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801bdf:	85 c0                	test   %eax,%eax
+  801be1:	78 15                	js     801bf8 <close+0x31>
+
+    return fd_close(fd, 1);
+  801be3:	be 01 00 00 00       	mov    $0x1,%esi
+  801be8:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801bec:	48 b8 1d 1b 80 00 00 	movabs $0x801b1d,%rax
+  801bf3:	00 00 00 
+  801bf6:	ff d0                	call   *%rax
+}
+  801bf8:	c9                   	leave
+  801bf9:	c3                   	ret
+
+0000000000801bfa <close_all>:
+
+void
+close_all(void) {
+  801bfa:	55                   	push   %rbp
+  801bfb:	48 89 e5             	mov    %rsp,%rbp
+  801bfe:	41 54                	push   %r12
+  801c00:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  801c01:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801c06:	49 bc c7 1b 80 00 00 	movabs $0x801bc7,%r12
+  801c0d:	00 00 00 
+  801c10:	89 df                	mov    %ebx,%edi
+  801c12:	41 ff d4             	call   *%r12
+  801c15:	83 c3 01             	add    $0x1,%ebx
+  801c18:	83 fb 20             	cmp    $0x20,%ebx
+  801c1b:	75 f3                	jne    801c10 <close_all+0x16>
+}
+  801c1d:	5b                   	pop    %rbx
+  801c1e:	41 5c                	pop    %r12
+  801c20:	5d                   	pop    %rbp
+  801c21:	c3                   	ret
+
+0000000000801c22 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  801c22:	55                   	push   %rbp
+  801c23:	48 89 e5             	mov    %rsp,%rbp
+  801c26:	41 57                	push   %r15
+  801c28:	41 56                	push   %r14
+  801c2a:	41 55                	push   %r13
+  801c2c:	41 54                	push   %r12
+  801c2e:	53                   	push   %rbx
+  801c2f:	48 83 ec 18          	sub    $0x18,%rsp
+  801c33:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  801c36:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801c3a:	48 b8 62 1a 80 00 00 	movabs $0x801a62,%rax
+  801c41:	00 00 00 
+  801c44:	ff d0                	call   *%rax
+  801c46:	89 c3                	mov    %eax,%ebx
+  801c48:	85 c0                	test   %eax,%eax
+  801c4a:	0f 88 b8 00 00 00    	js     801d08 <dup+0xe6>
+    close(newfdnum);
+  801c50:	44 89 e7             	mov    %r12d,%edi
+  801c53:	48 b8 c7 1b 80 00 00 	movabs $0x801bc7,%rax
+  801c5a:	00 00 00 
+  801c5d:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  801c5f:	4d 63 ec             	movslq %r12d,%r13
+  801c62:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  801c69:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  801c6d:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  801c71:	4c 89 ff             	mov    %r15,%rdi
+  801c74:	49 be b3 19 80 00 00 	movabs $0x8019b3,%r14
+  801c7b:	00 00 00 
+  801c7e:	41 ff d6             	call   *%r14
+  801c81:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  801c84:	4c 89 ef             	mov    %r13,%rdi
+  801c87:	41 ff d6             	call   *%r14
+  801c8a:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  801c8d:	48 89 df             	mov    %rbx,%rdi
+  801c90:	48 b8 d8 2a 80 00 00 	movabs $0x802ad8,%rax
+  801c97:	00 00 00 
+  801c9a:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  801c9c:	a8 04                	test   $0x4,%al
+  801c9e:	74 2b                	je     801ccb <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  801ca0:	41 89 c1             	mov    %eax,%r9d
+  801ca3:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801ca9:	4c 89 f1             	mov    %r14,%rcx
+  801cac:	ba 00 00 00 00       	mov    $0x0,%edx
+  801cb1:	48 89 de             	mov    %rbx,%rsi
+  801cb4:	bf 00 00 00 00       	mov    $0x0,%edi
+  801cb9:	48 b8 69 14 80 00 00 	movabs $0x801469,%rax
+  801cc0:	00 00 00 
+  801cc3:	ff d0                	call   *%rax
+  801cc5:	89 c3                	mov    %eax,%ebx
+  801cc7:	85 c0                	test   %eax,%eax
+  801cc9:	78 4e                	js     801d19 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  801ccb:	4c 89 ff             	mov    %r15,%rdi
+  801cce:	48 b8 d8 2a 80 00 00 	movabs $0x802ad8,%rax
+  801cd5:	00 00 00 
+  801cd8:	ff d0                	call   *%rax
+  801cda:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801cdd:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801ce3:	4c 89 e9             	mov    %r13,%rcx
+  801ce6:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ceb:	4c 89 fe             	mov    %r15,%rsi
+  801cee:	bf 00 00 00 00       	mov    $0x0,%edi
+  801cf3:	48 b8 69 14 80 00 00 	movabs $0x801469,%rax
+  801cfa:	00 00 00 
+  801cfd:	ff d0                	call   *%rax
+  801cff:	89 c3                	mov    %eax,%ebx
+  801d01:	85 c0                	test   %eax,%eax
+  801d03:	78 14                	js     801d19 <dup+0xf7>
+
+    return newfdnum;
+  801d05:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  801d08:	89 d8                	mov    %ebx,%eax
+  801d0a:	48 83 c4 18          	add    $0x18,%rsp
+  801d0e:	5b                   	pop    %rbx
+  801d0f:	41 5c                	pop    %r12
+  801d11:	41 5d                	pop    %r13
+  801d13:	41 5e                	pop    %r14
+  801d15:	41 5f                	pop    %r15
+  801d17:	5d                   	pop    %rbp
+  801d18:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  801d19:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801d1e:	4c 89 ee             	mov    %r13,%rsi
+  801d21:	bf 00 00 00 00       	mov    $0x0,%edi
+  801d26:	49 bc ce 14 80 00 00 	movabs $0x8014ce,%r12
+  801d2d:	00 00 00 
+  801d30:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  801d33:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801d38:	4c 89 f6             	mov    %r14,%rsi
+  801d3b:	bf 00 00 00 00       	mov    $0x0,%edi
+  801d40:	41 ff d4             	call   *%r12
+    return res;
+  801d43:	eb c3                	jmp    801d08 <dup+0xe6>
+
+0000000000801d45 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  801d45:	55                   	push   %rbp
+  801d46:	48 89 e5             	mov    %rsp,%rbp
+  801d49:	41 56                	push   %r14
+  801d4b:	41 55                	push   %r13
+  801d4d:	41 54                	push   %r12
+  801d4f:	53                   	push   %rbx
+  801d50:	48 83 ec 10          	sub    $0x10,%rsp
+  801d54:	89 fb                	mov    %edi,%ebx
+  801d56:	49 89 f4             	mov    %rsi,%r12
+  801d59:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801d5c:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801d60:	48 b8 62 1a 80 00 00 	movabs $0x801a62,%rax
+  801d67:	00 00 00 
+  801d6a:	ff d0                	call   *%rax
+  801d6c:	85 c0                	test   %eax,%eax
+  801d6e:	78 4c                	js     801dbc <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801d70:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801d74:	41 8b 3e             	mov    (%r14),%edi
+  801d77:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801d7b:	48 b8 ad 1a 80 00 00 	movabs $0x801aad,%rax
+  801d82:	00 00 00 
+  801d85:	ff d0                	call   *%rax
+  801d87:	85 c0                	test   %eax,%eax
+  801d89:	78 35                	js     801dc0 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801d8b:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801d8f:	83 e0 03             	and    $0x3,%eax
+  801d92:	83 f8 01             	cmp    $0x1,%eax
+  801d95:	74 2d                	je     801dc4 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801d97:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801d9b:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801d9f:	48 85 c0             	test   %rax,%rax
+  801da2:	74 56                	je     801dfa <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  801da4:	4c 89 ea             	mov    %r13,%rdx
+  801da7:	4c 89 e6             	mov    %r12,%rsi
+  801daa:	4c 89 f7             	mov    %r14,%rdi
+  801dad:	ff d0                	call   *%rax
+}
+  801daf:	48 83 c4 10          	add    $0x10,%rsp
+  801db3:	5b                   	pop    %rbx
+  801db4:	41 5c                	pop    %r12
+  801db6:	41 5d                	pop    %r13
+  801db8:	41 5e                	pop    %r14
+  801dba:	5d                   	pop    %rbp
+  801dbb:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801dbc:	48 98                	cltq
+  801dbe:	eb ef                	jmp    801daf <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801dc0:	48 98                	cltq
+  801dc2:	eb eb                	jmp    801daf <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801dc4:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801dcb:	00 00 00 
+  801dce:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+  801dd4:	89 da                	mov    %ebx,%edx
+  801dd6:	48 bf 79 37 80 00 00 	movabs $0x803779,%rdi
+  801ddd:	00 00 00 
+  801de0:	b8 00 00 00 00       	mov    $0x0,%eax
+  801de5:	48 b9 2d 05 80 00 00 	movabs $0x80052d,%rcx
+  801dec:	00 00 00 
+  801def:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801df1:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801df8:	eb b5                	jmp    801daf <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801dfa:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801e01:	eb ac                	jmp    801daf <read+0x6a>
+
+0000000000801e03 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801e03:	55                   	push   %rbp
+  801e04:	48 89 e5             	mov    %rsp,%rbp
+  801e07:	41 57                	push   %r15
+  801e09:	41 56                	push   %r14
+  801e0b:	41 55                	push   %r13
+  801e0d:	41 54                	push   %r12
+  801e0f:	53                   	push   %rbx
+  801e10:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  801e14:	48 85 d2             	test   %rdx,%rdx
+  801e17:	74 54                	je     801e6d <readn+0x6a>
+  801e19:	41 89 fd             	mov    %edi,%r13d
+  801e1c:	49 89 f6             	mov    %rsi,%r14
+  801e1f:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  801e22:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  801e27:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  801e2c:	49 bf 45 1d 80 00 00 	movabs $0x801d45,%r15
+  801e33:	00 00 00 
+  801e36:	4c 89 e2             	mov    %r12,%rdx
+  801e39:	48 29 f2             	sub    %rsi,%rdx
+  801e3c:	4c 01 f6             	add    %r14,%rsi
+  801e3f:	44 89 ef             	mov    %r13d,%edi
+  801e42:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  801e45:	85 c0                	test   %eax,%eax
+  801e47:	78 20                	js     801e69 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  801e49:	01 c3                	add    %eax,%ebx
+  801e4b:	85 c0                	test   %eax,%eax
+  801e4d:	74 08                	je     801e57 <readn+0x54>
+  801e4f:	48 63 f3             	movslq %ebx,%rsi
+  801e52:	4c 39 e6             	cmp    %r12,%rsi
+  801e55:	72 df                	jb     801e36 <readn+0x33>
+    }
+    return res;
+  801e57:	48 63 c3             	movslq %ebx,%rax
+}
+  801e5a:	48 83 c4 08          	add    $0x8,%rsp
+  801e5e:	5b                   	pop    %rbx
+  801e5f:	41 5c                	pop    %r12
+  801e61:	41 5d                	pop    %r13
+  801e63:	41 5e                	pop    %r14
+  801e65:	41 5f                	pop    %r15
+  801e67:	5d                   	pop    %rbp
+  801e68:	c3                   	ret
+        if (inc < 0) return inc;
+  801e69:	48 98                	cltq
+  801e6b:	eb ed                	jmp    801e5a <readn+0x57>
+    int inc = 1, res = 0;
+  801e6d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801e72:	eb e3                	jmp    801e57 <readn+0x54>
+
+0000000000801e74 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  801e74:	55                   	push   %rbp
+  801e75:	48 89 e5             	mov    %rsp,%rbp
+  801e78:	41 56                	push   %r14
+  801e7a:	41 55                	push   %r13
+  801e7c:	41 54                	push   %r12
+  801e7e:	53                   	push   %rbx
+  801e7f:	48 83 ec 10          	sub    $0x10,%rsp
+  801e83:	89 fb                	mov    %edi,%ebx
+  801e85:	49 89 f4             	mov    %rsi,%r12
+  801e88:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801e8b:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801e8f:	48 b8 62 1a 80 00 00 	movabs $0x801a62,%rax
+  801e96:	00 00 00 
+  801e99:	ff d0                	call   *%rax
+  801e9b:	85 c0                	test   %eax,%eax
+  801e9d:	78 47                	js     801ee6 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801e9f:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801ea3:	41 8b 3e             	mov    (%r14),%edi
+  801ea6:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801eaa:	48 b8 ad 1a 80 00 00 	movabs $0x801aad,%rax
+  801eb1:	00 00 00 
+  801eb4:	ff d0                	call   *%rax
+  801eb6:	85 c0                	test   %eax,%eax
+  801eb8:	78 30                	js     801eea <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801eba:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  801ebf:	74 2d                	je     801eee <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801ec1:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801ec5:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801ec9:	48 85 c0             	test   %rax,%rax
+  801ecc:	74 56                	je     801f24 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  801ece:	4c 89 ea             	mov    %r13,%rdx
+  801ed1:	4c 89 e6             	mov    %r12,%rsi
+  801ed4:	4c 89 f7             	mov    %r14,%rdi
+  801ed7:	ff d0                	call   *%rax
+}
+  801ed9:	48 83 c4 10          	add    $0x10,%rsp
+  801edd:	5b                   	pop    %rbx
+  801ede:	41 5c                	pop    %r12
+  801ee0:	41 5d                	pop    %r13
+  801ee2:	41 5e                	pop    %r14
+  801ee4:	5d                   	pop    %rbp
+  801ee5:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801ee6:	48 98                	cltq
+  801ee8:	eb ef                	jmp    801ed9 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801eea:	48 98                	cltq
+  801eec:	eb eb                	jmp    801ed9 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801eee:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801ef5:	00 00 00 
+  801ef8:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+  801efe:	89 da                	mov    %ebx,%edx
+  801f00:	48 bf 95 37 80 00 00 	movabs $0x803795,%rdi
+  801f07:	00 00 00 
+  801f0a:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f0f:	48 b9 2d 05 80 00 00 	movabs $0x80052d,%rcx
+  801f16:	00 00 00 
+  801f19:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801f1b:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801f22:	eb b5                	jmp    801ed9 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801f24:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801f2b:	eb ac                	jmp    801ed9 <write+0x65>
+
+0000000000801f2d <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  801f2d:	55                   	push   %rbp
+  801f2e:	48 89 e5             	mov    %rsp,%rbp
+  801f31:	53                   	push   %rbx
+  801f32:	48 83 ec 18          	sub    $0x18,%rsp
+  801f36:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801f38:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801f3c:	48 b8 62 1a 80 00 00 	movabs $0x801a62,%rax
+  801f43:	00 00 00 
+  801f46:	ff d0                	call   *%rax
+  801f48:	85 c0                	test   %eax,%eax
+  801f4a:	78 0c                	js     801f58 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  801f4c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801f50:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  801f53:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801f58:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801f5c:	c9                   	leave
+  801f5d:	c3                   	ret
+
+0000000000801f5e <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  801f5e:	55                   	push   %rbp
+  801f5f:	48 89 e5             	mov    %rsp,%rbp
+  801f62:	41 55                	push   %r13
+  801f64:	41 54                	push   %r12
+  801f66:	53                   	push   %rbx
+  801f67:	48 83 ec 18          	sub    $0x18,%rsp
+  801f6b:	89 fb                	mov    %edi,%ebx
+  801f6d:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801f70:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801f74:	48 b8 62 1a 80 00 00 	movabs $0x801a62,%rax
+  801f7b:	00 00 00 
+  801f7e:	ff d0                	call   *%rax
+  801f80:	85 c0                	test   %eax,%eax
+  801f82:	78 38                	js     801fbc <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801f84:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  801f88:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  801f8c:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801f90:	48 b8 ad 1a 80 00 00 	movabs $0x801aad,%rax
+  801f97:	00 00 00 
+  801f9a:	ff d0                	call   *%rax
+  801f9c:	85 c0                	test   %eax,%eax
+  801f9e:	78 1c                	js     801fbc <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801fa0:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  801fa5:	74 20                	je     801fc7 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801fa7:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801fab:	48 8b 40 30          	mov    0x30(%rax),%rax
+  801faf:	48 85 c0             	test   %rax,%rax
+  801fb2:	74 47                	je     801ffb <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  801fb4:	44 89 e6             	mov    %r12d,%esi
+  801fb7:	4c 89 ef             	mov    %r13,%rdi
+  801fba:	ff d0                	call   *%rax
+}
+  801fbc:	48 83 c4 18          	add    $0x18,%rsp
+  801fc0:	5b                   	pop    %rbx
+  801fc1:	41 5c                	pop    %r12
+  801fc3:	41 5d                	pop    %r13
+  801fc5:	5d                   	pop    %rbp
+  801fc6:	c3                   	ret
+                thisenv->env_id, fdnum);
+  801fc7:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801fce:	00 00 00 
+  801fd1:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801fd7:	89 da                	mov    %ebx,%edx
+  801fd9:	48 bf 58 37 80 00 00 	movabs $0x803758,%rdi
+  801fe0:	00 00 00 
+  801fe3:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fe8:	48 b9 2d 05 80 00 00 	movabs $0x80052d,%rcx
+  801fef:	00 00 00 
+  801ff2:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801ff4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801ff9:	eb c1                	jmp    801fbc <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801ffb:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802000:	eb ba                	jmp    801fbc <ftruncate+0x5e>
+
+0000000000802002 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  802002:	55                   	push   %rbp
+  802003:	48 89 e5             	mov    %rsp,%rbp
+  802006:	41 54                	push   %r12
+  802008:	53                   	push   %rbx
+  802009:	48 83 ec 10          	sub    $0x10,%rsp
+  80200d:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802010:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802014:	48 b8 62 1a 80 00 00 	movabs $0x801a62,%rax
+  80201b:	00 00 00 
+  80201e:	ff d0                	call   *%rax
+  802020:	85 c0                	test   %eax,%eax
+  802022:	78 4e                	js     802072 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802024:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  802028:	41 8b 3c 24          	mov    (%r12),%edi
+  80202c:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  802030:	48 b8 ad 1a 80 00 00 	movabs $0x801aad,%rax
+  802037:	00 00 00 
+  80203a:	ff d0                	call   *%rax
+  80203c:	85 c0                	test   %eax,%eax
+  80203e:	78 32                	js     802072 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  802040:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802044:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  802049:	74 30                	je     80207b <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  80204b:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  80204e:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  802055:	00 00 00 
+    stat->st_isdir = 0;
+  802058:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  80205f:	00 00 00 
+    stat->st_dev = dev;
+  802062:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  802069:	48 89 de             	mov    %rbx,%rsi
+  80206c:	4c 89 e7             	mov    %r12,%rdi
+  80206f:	ff 50 28             	call   *0x28(%rax)
+}
+  802072:	48 83 c4 10          	add    $0x10,%rsp
+  802076:	5b                   	pop    %rbx
+  802077:	41 5c                	pop    %r12
+  802079:	5d                   	pop    %rbp
+  80207a:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  80207b:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802080:	eb f0                	jmp    802072 <fstat+0x70>
+
+0000000000802082 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  802082:	55                   	push   %rbp
+  802083:	48 89 e5             	mov    %rsp,%rbp
+  802086:	41 54                	push   %r12
+  802088:	53                   	push   %rbx
+  802089:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  80208c:	be 00 00 00 00       	mov    $0x0,%esi
+  802091:	48 b8 65 24 80 00 00 	movabs $0x802465,%rax
+  802098:	00 00 00 
+  80209b:	ff d0                	call   *%rax
+  80209d:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  80209f:	85 c0                	test   %eax,%eax
+  8020a1:	78 25                	js     8020c8 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  8020a3:	4c 89 e6             	mov    %r12,%rsi
+  8020a6:	89 c7                	mov    %eax,%edi
+  8020a8:	48 b8 02 20 80 00 00 	movabs $0x802002,%rax
+  8020af:	00 00 00 
+  8020b2:	ff d0                	call   *%rax
+  8020b4:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  8020b7:	89 df                	mov    %ebx,%edi
+  8020b9:	48 b8 c7 1b 80 00 00 	movabs $0x801bc7,%rax
+  8020c0:	00 00 00 
+  8020c3:	ff d0                	call   *%rax
+
+    return res;
+  8020c5:	44 89 e3             	mov    %r12d,%ebx
+}
+  8020c8:	89 d8                	mov    %ebx,%eax
+  8020ca:	5b                   	pop    %rbx
+  8020cb:	41 5c                	pop    %r12
+  8020cd:	5d                   	pop    %rbp
+  8020ce:	c3                   	ret
+
+00000000008020cf <fsipc>:
+ * response may be written back to fsipcbuf.
+ * type: request code, passed as the simple integer IPC value.
+ * dstva: virtual address at which to receive reply page, 0 if none.
+ * Returns result from the file server. */
+static int
+fsipc(unsigned type, void *dstva) {
+  8020cf:	55                   	push   %rbp
+  8020d0:	48 89 e5             	mov    %rsp,%rbp
+  8020d3:	41 54                	push   %r12
+  8020d5:	53                   	push   %rbx
+  8020d6:	48 83 ec 10          	sub    $0x10,%rsp
+  8020da:	41 89 fc             	mov    %edi,%r12d
+  8020dd:	48 89 f3             	mov    %rsi,%rbx
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8020e0:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  8020e7:	00 00 00 
+  8020ea:	83 38 00             	cmpl   $0x0,(%rax)
+  8020ed:	74 5e                	je     80214d <fsipc+0x7e>
+    if (debug) {
+        cprintf("[%08x] fsipc %d %08x\n",
+                thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+    }
+
+    ipc_send(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW);
+  8020ef:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8020f5:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8020fa:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  802101:	00 00 00 
+  802104:	44 89 e6             	mov    %r12d,%esi
+  802107:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  80210e:	00 00 00 
+  802111:	8b 38                	mov    (%rax),%edi
+  802113:	48 b8 cc 2f 80 00 00 	movabs $0x802fcc,%rax
+  80211a:	00 00 00 
+  80211d:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  80211f:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  802126:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  802127:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80212c:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  802130:	48 89 de             	mov    %rbx,%rsi
+  802133:	bf 00 00 00 00       	mov    $0x0,%edi
+  802138:	48 b8 f7 2e 80 00 00 	movabs $0x802ef7,%rax
+  80213f:	00 00 00 
+  802142:	ff d0                	call   *%rax
+}
+  802144:	48 83 c4 10          	add    $0x10,%rsp
+  802148:	5b                   	pop    %rbx
+  802149:	41 5c                	pop    %r12
+  80214b:	5d                   	pop    %rbp
+  80214c:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  80214d:	bf 03 00 00 00       	mov    $0x3,%edi
+  802152:	48 b8 6f 30 80 00 00 	movabs $0x80306f,%rax
+  802159:	00 00 00 
+  80215c:	ff d0                	call   *%rax
+  80215e:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  802165:	00 00 
+  802167:	eb 86                	jmp    8020ef <fsipc+0x20>
+
+0000000000802169 <devfile_trunc>:
+    return 0;
+}
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  802169:	55                   	push   %rbp
+  80216a:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  80216d:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  802174:	00 00 00 
+  802177:	8b 57 0c             	mov    0xc(%rdi),%edx
+  80217a:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  80217c:	89 70 04             	mov    %esi,0x4(%rax)
+
+    return fsipc(FSREQ_SET_SIZE, NULL);
+  80217f:	be 00 00 00 00       	mov    $0x0,%esi
+  802184:	bf 02 00 00 00       	mov    $0x2,%edi
+  802189:	48 b8 cf 20 80 00 00 	movabs $0x8020cf,%rax
+  802190:	00 00 00 
+  802193:	ff d0                	call   *%rax
+}
+  802195:	5d                   	pop    %rbp
+  802196:	c3                   	ret
+
+0000000000802197 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  802197:	55                   	push   %rbp
+  802198:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  80219b:	8b 47 0c             	mov    0xc(%rdi),%eax
+  80219e:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  8021a5:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  8021a7:	be 00 00 00 00       	mov    $0x0,%esi
+  8021ac:	bf 06 00 00 00       	mov    $0x6,%edi
+  8021b1:	48 b8 cf 20 80 00 00 	movabs $0x8020cf,%rax
+  8021b8:	00 00 00 
+  8021bb:	ff d0                	call   *%rax
+}
+  8021bd:	5d                   	pop    %rbp
+  8021be:	c3                   	ret
+
+00000000008021bf <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  8021bf:	55                   	push   %rbp
+  8021c0:	48 89 e5             	mov    %rsp,%rbp
+  8021c3:	41 54                	push   %r12
+  8021c5:	53                   	push   %rbx
+  8021c6:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8021c9:	8b 47 0c             	mov    0xc(%rdi),%eax
+  8021cc:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  8021d3:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  8021d5:	be 00 00 00 00       	mov    $0x0,%esi
+  8021da:	bf 05 00 00 00       	mov    $0x5,%edi
+  8021df:	48 b8 cf 20 80 00 00 	movabs $0x8020cf,%rax
+  8021e6:	00 00 00 
+  8021e9:	ff d0                	call   *%rax
+    if (res < 0) {
+  8021eb:	85 c0                	test   %eax,%eax
+  8021ed:	78 3d                	js     80222c <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8021ef:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  8021f6:	00 00 00 
+  8021f9:	4c 89 e6             	mov    %r12,%rsi
+  8021fc:	48 89 df             	mov    %rbx,%rdi
+  8021ff:	48 b8 52 0e 80 00 00 	movabs $0x800e52,%rax
+  802206:	00 00 00 
+  802209:	ff d0                	call   *%rax
+    st->st_size  = fsipcbuf.statRet.ret_size;
+  80220b:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  802212:	00 
+  802213:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802219:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  802220:	00 
+  802221:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  802227:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80222c:	5b                   	pop    %rbx
+  80222d:	41 5c                	pop    %r12
+  80222f:	5d                   	pop    %rbp
+  802230:	c3                   	ret
+
+0000000000802231 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  802231:	55                   	push   %rbp
+  802232:	48 89 e5             	mov    %rsp,%rbp
+  802235:	41 57                	push   %r15
+  802237:	41 56                	push   %r14
+  802239:	41 55                	push   %r13
+  80223b:	41 54                	push   %r12
+  80223d:	53                   	push   %rbx
+  80223e:	48 83 ec 18          	sub    $0x18,%rsp
+  802242:	49 89 fe             	mov    %rdi,%r14
+  802245:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+  802249:	48 89 d3             	mov    %rdx,%rbx
+    while (n > sizeof(fsipcbuf.write.req_buf))
+  80224c:	48 81 fa f0 0f 00 00 	cmp    $0xff0,%rdx
+  802253:	0f 86 e4 00 00 00    	jbe    80233d <devfile_write+0x10c>
+  802259:	49 89 f4             	mov    %rsi,%r12
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  80225c:	49 bd 00 60 80 00 00 	movabs $0x806000,%r13
+  802263:	00 00 00 
+        memcpy(fsipcbuf.write.req_buf, buf, sizeof(fsipcbuf.write.req_buf));
+  802266:	49 bf b3 10 80 00 00 	movabs $0x8010b3,%r15
+  80226d:	00 00 00 
+  802270:	eb 03                	jmp    802275 <devfile_write+0x44>
+        buf += sizeof(fsipcbuf.write.req_buf);
+  802272:	49 89 f4             	mov    %rsi,%r12
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802275:	41 8b 46 0c          	mov    0xc(%r14),%eax
+  802279:	41 89 45 00          	mov    %eax,0x0(%r13)
+        fsipcbuf.write.req_n      = sizeof(fsipcbuf.write.req_buf);
+  80227d:	49 c7 45 08 f0 0f 00 	movq   $0xff0,0x8(%r13)
+  802284:	00 
+        memcpy(fsipcbuf.write.req_buf, buf, sizeof(fsipcbuf.write.req_buf));
+  802285:	ba f0 0f 00 00       	mov    $0xff0,%edx
+  80228a:	4c 89 e6             	mov    %r12,%rsi
+  80228d:	48 bf 10 60 80 00 00 	movabs $0x806010,%rdi
+  802294:	00 00 00 
+  802297:	41 ff d7             	call   *%r15
+        ssize_t res = fsipc(FSREQ_WRITE, NULL);
+  80229a:	be 00 00 00 00       	mov    $0x0,%esi
+  80229f:	bf 04 00 00 00       	mov    $0x4,%edi
+  8022a4:	48 b8 cf 20 80 00 00 	movabs $0x8020cf,%rax
+  8022ab:	00 00 00 
+  8022ae:	ff d0                	call   *%rax
+  8022b0:	48 63 d0             	movslq %eax,%rdx
+        if (res < 0 || res < sizeof(fsipcbuf.write.req_buf))
+  8022b3:	3d ef 0f 00 00       	cmp    $0xfef,%eax
+  8022b8:	7e 71                	jle    80232b <devfile_write+0xfa>
+        buf += sizeof(fsipcbuf.write.req_buf);
+  8022ba:	49 8d b4 24 f0 0f 00 	lea    0xff0(%r12),%rsi
+  8022c1:	00 
+        n -= sizeof(fsipcbuf.write.req_buf);
+  8022c2:	48 81 eb f0 0f 00 00 	sub    $0xff0,%rbx
+    while (n > sizeof(fsipcbuf.write.req_buf))
+  8022c9:	48 81 fb f0 0f 00 00 	cmp    $0xff0,%rbx
+  8022d0:	77 a0                	ja     802272 <devfile_write+0x41>
+        written += sizeof(fsipcbuf.write.req_buf);
+  8022d2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8022d6:	49 29 c4             	sub    %rax,%r12
+  8022d9:	4d 8d a4 24 f0 0f 00 	lea    0xff0(%r12),%r12
+  8022e0:	00 
+    fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8022e1:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  8022e8:	00 00 00 
+  8022eb:	41 8b 56 0c          	mov    0xc(%r14),%edx
+  8022ef:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.write.req_n      = n;
+  8022f1:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    memcpy(fsipcbuf.write.req_buf, buf, n);
+  8022f5:	48 89 da             	mov    %rbx,%rdx
+  8022f8:	48 8d 78 10          	lea    0x10(%rax),%rdi
+  8022fc:	48 b8 b3 10 80 00 00 	movabs $0x8010b3,%rax
+  802303:	00 00 00 
+  802306:	ff d0                	call   *%rax
+    ssize_t res = fsipc(FSREQ_WRITE, NULL);
+  802308:	be 00 00 00 00       	mov    $0x0,%esi
+  80230d:	bf 04 00 00 00       	mov    $0x4,%edi
+  802312:	48 b8 cf 20 80 00 00 	movabs $0x8020cf,%rax
+  802319:	00 00 00 
+  80231c:	ff d0                	call   *%rax
+  80231e:	48 63 d0             	movslq %eax,%rdx
+    written += res;
+  802321:	49 01 d4             	add    %rdx,%r12
+  802324:	48 85 d2             	test   %rdx,%rdx
+  802327:	49 0f 49 d4          	cmovns %r12,%rdx
+}
+  80232b:	48 89 d0             	mov    %rdx,%rax
+  80232e:	48 83 c4 18          	add    $0x18,%rsp
+  802332:	5b                   	pop    %rbx
+  802333:	41 5c                	pop    %r12
+  802335:	41 5d                	pop    %r13
+  802337:	41 5e                	pop    %r14
+  802339:	41 5f                	pop    %r15
+  80233b:	5d                   	pop    %rbp
+  80233c:	c3                   	ret
+    while (n > sizeof(fsipcbuf.write.req_buf))
+  80233d:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+    ssize_t written = 0;
+  802341:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802347:	eb 98                	jmp    8022e1 <devfile_write+0xb0>
+
+0000000000802349 <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  802349:	55                   	push   %rbp
+  80234a:	48 89 e5             	mov    %rsp,%rbp
+  80234d:	41 57                	push   %r15
+  80234f:	41 56                	push   %r14
+  802351:	41 55                	push   %r13
+  802353:	41 54                	push   %r12
+  802355:	53                   	push   %rbx
+  802356:	48 83 ec 18          	sub    $0x18,%rsp
+  80235a:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  80235e:	49 89 f6             	mov    %rsi,%r14
+  802361:	49 89 d4             	mov    %rdx,%r12
+    while (n > sizeof(fsipcbuf.readRet.ret_buf))
+  802364:	48 81 fa 00 10 00 00 	cmp    $0x1000,%rdx
+  80236b:	0f 86 ea 00 00 00    	jbe    80245b <devfile_read+0x112>
+    ssize_t readsz = 0;
+  802371:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  802378:	00 
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802379:	49 bf 00 60 80 00 00 	movabs $0x806000,%r15
+  802380:	00 00 00 
+  802383:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802387:	8b 40 0c             	mov    0xc(%rax),%eax
+  80238a:	41 89 07             	mov    %eax,(%r15)
+        fsipcbuf.read.req_n = sizeof(fsipcbuf.readRet.ret_buf);
+  80238d:	49 c7 47 08 00 10 00 	movq   $0x1000,0x8(%r15)
+  802394:	00 
+        ssize_t res = fsipc(FSREQ_READ, NULL);
+  802395:	be 00 00 00 00       	mov    $0x0,%esi
+  80239a:	bf 03 00 00 00       	mov    $0x3,%edi
+  80239f:	48 b8 cf 20 80 00 00 	movabs $0x8020cf,%rax
+  8023a6:	00 00 00 
+  8023a9:	ff d0                	call   *%rax
+  8023ab:	4c 63 e8             	movslq %eax,%r13
+        if (res < 0)
+  8023ae:	4d 85 ed             	test   %r13,%r13
+  8023b1:	0f 88 92 00 00 00    	js     802449 <devfile_read+0x100>
+        memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  8023b7:	4c 89 ea             	mov    %r13,%rdx
+  8023ba:	4c 89 fe             	mov    %r15,%rsi
+  8023bd:	4c 89 f7             	mov    %r14,%rdi
+  8023c0:	48 b8 b3 10 80 00 00 	movabs $0x8010b3,%rax
+  8023c7:	00 00 00 
+  8023ca:	ff d0                	call   *%rax
+        if (res < sizeof(fsipcbuf.readRet.ret_buf))
+  8023cc:	49 81 fd ff 0f 00 00 	cmp    $0xfff,%r13
+  8023d3:	76 6d                	jbe    802442 <devfile_read+0xf9>
+        readsz += res;
+  8023d5:	4c 01 6d c0          	add    %r13,-0x40(%rbp)
+        buf += res;
+  8023d9:	4d 01 ee             	add    %r13,%r14
+        n -= res;
+  8023dc:	4d 29 ec             	sub    %r13,%r12
+    while (n > sizeof(fsipcbuf.readRet.ret_buf))
+  8023df:	49 81 fc 00 10 00 00 	cmp    $0x1000,%r12
+  8023e6:	77 9b                	ja     802383 <devfile_read+0x3a>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8023e8:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  8023ef:	00 00 00 
+  8023f2:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  8023f6:	8b 51 0c             	mov    0xc(%rcx),%edx
+  8023f9:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.read.req_n = n;
+  8023fb:	4c 89 60 08          	mov    %r12,0x8(%rax)
+    ssize_t res = fsipc(FSREQ_READ, NULL);
+  8023ff:	be 00 00 00 00       	mov    $0x0,%esi
+  802404:	bf 03 00 00 00       	mov    $0x3,%edi
+  802409:	48 b8 cf 20 80 00 00 	movabs $0x8020cf,%rax
+  802410:	00 00 00 
+  802413:	ff d0                	call   *%rax
+  802415:	4c 63 e8             	movslq %eax,%r13
+    if (res < 0)
+  802418:	4d 85 ed             	test   %r13,%r13
+  80241b:	78 2c                	js     802449 <devfile_read+0x100>
+    memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  80241d:	4c 89 ea             	mov    %r13,%rdx
+  802420:	48 be 00 60 80 00 00 	movabs $0x806000,%rsi
+  802427:	00 00 00 
+  80242a:	4c 89 f7             	mov    %r14,%rdi
+  80242d:	48 b8 b3 10 80 00 00 	movabs $0x8010b3,%rax
+  802434:	00 00 00 
+  802437:	ff d0                	call   *%rax
+    readsz += res;
+  802439:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80243d:	49 01 c5             	add    %rax,%r13
+    return readsz;
+  802440:	eb 07                	jmp    802449 <devfile_read+0x100>
+            return readsz + res;
+  802442:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802446:	49 01 c5             	add    %rax,%r13
+}
+  802449:	4c 89 e8             	mov    %r13,%rax
+  80244c:	48 83 c4 18          	add    $0x18,%rsp
+  802450:	5b                   	pop    %rbx
+  802451:	41 5c                	pop    %r12
+  802453:	41 5d                	pop    %r13
+  802455:	41 5e                	pop    %r14
+  802457:	41 5f                	pop    %r15
+  802459:	5d                   	pop    %rbp
+  80245a:	c3                   	ret
+    ssize_t readsz = 0;
+  80245b:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  802462:	00 
+  802463:	eb 83                	jmp    8023e8 <devfile_read+0x9f>
+
+0000000000802465 <open>:
+open(const char *path, int mode) {
+  802465:	55                   	push   %rbp
+  802466:	48 89 e5             	mov    %rsp,%rbp
+  802469:	41 55                	push   %r13
+  80246b:	41 54                	push   %r12
+  80246d:	53                   	push   %rbx
+  80246e:	48 83 ec 18          	sub    $0x18,%rsp
+  802472:	49 89 fc             	mov    %rdi,%r12
+  802475:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  802478:	48 b8 14 0e 80 00 00 	movabs $0x800e14,%rax
+  80247f:	00 00 00 
+  802482:	ff d0                	call   *%rax
+  802484:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  80248a:	0f 87 8a 00 00 00    	ja     80251a <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802490:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802494:	48 b8 48 1a 80 00 00 	movabs $0x801a48,%rax
+  80249b:	00 00 00 
+  80249e:	ff d0                	call   *%rax
+  8024a0:	89 c3                	mov    %eax,%ebx
+  8024a2:	85 c0                	test   %eax,%eax
+  8024a4:	78 50                	js     8024f6 <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  8024a6:	4c 89 e6             	mov    %r12,%rsi
+  8024a9:	48 bb 00 60 80 00 00 	movabs $0x806000,%rbx
+  8024b0:	00 00 00 
+  8024b3:	48 89 df             	mov    %rbx,%rdi
+  8024b6:	48 b8 52 0e 80 00 00 	movabs $0x800e52,%rax
+  8024bd:	00 00 00 
+  8024c0:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  8024c2:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  8024c9:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8024cd:	bf 01 00 00 00       	mov    $0x1,%edi
+  8024d2:	48 b8 cf 20 80 00 00 	movabs $0x8020cf,%rax
+  8024d9:	00 00 00 
+  8024dc:	ff d0                	call   *%rax
+  8024de:	89 c3                	mov    %eax,%ebx
+  8024e0:	85 c0                	test   %eax,%eax
+  8024e2:	78 1f                	js     802503 <open+0x9e>
+    return fd2num(fd);
+  8024e4:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8024e8:	48 b8 a1 19 80 00 00 	movabs $0x8019a1,%rax
+  8024ef:	00 00 00 
+  8024f2:	ff d0                	call   *%rax
+  8024f4:	89 c3                	mov    %eax,%ebx
+}
+  8024f6:	89 d8                	mov    %ebx,%eax
+  8024f8:	48 83 c4 18          	add    $0x18,%rsp
+  8024fc:	5b                   	pop    %rbx
+  8024fd:	41 5c                	pop    %r12
+  8024ff:	41 5d                	pop    %r13
+  802501:	5d                   	pop    %rbp
+  802502:	c3                   	ret
+        fd_close(fd, 0);
+  802503:	be 00 00 00 00       	mov    $0x0,%esi
+  802508:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80250c:	48 b8 1d 1b 80 00 00 	movabs $0x801b1d,%rax
+  802513:	00 00 00 
+  802516:	ff d0                	call   *%rax
+        return res;
+  802518:	eb dc                	jmp    8024f6 <open+0x91>
+        return -E_BAD_PATH;
+  80251a:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  80251f:	eb d5                	jmp    8024f6 <open+0x91>
+
+0000000000802521 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  802521:	55                   	push   %rbp
+  802522:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc(FSREQ_SYNC, NULL);
+  802525:	be 00 00 00 00       	mov    $0x0,%esi
+  80252a:	bf 08 00 00 00       	mov    $0x8,%edi
+  80252f:	48 b8 cf 20 80 00 00 	movabs $0x8020cf,%rax
+  802536:	00 00 00 
+  802539:	ff d0                	call   *%rax
+}
+  80253b:	5d                   	pop    %rbp
+  80253c:	c3                   	ret
+
+000000000080253d <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  80253d:	55                   	push   %rbp
+  80253e:	48 89 e5             	mov    %rsp,%rbp
+  802541:	41 54                	push   %r12
+  802543:	53                   	push   %rbx
+  802544:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802547:	48 b8 b3 19 80 00 00 	movabs $0x8019b3,%rax
+  80254e:	00 00 00 
+  802551:	ff d0                	call   *%rax
+  802553:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  802556:	48 be e0 37 80 00 00 	movabs $0x8037e0,%rsi
+  80255d:	00 00 00 
+  802560:	48 89 df             	mov    %rbx,%rdi
+  802563:	48 b8 52 0e 80 00 00 	movabs $0x800e52,%rax
+  80256a:	00 00 00 
+  80256d:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  80256f:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  802574:	41 2b 04 24          	sub    (%r12),%eax
+  802578:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  80257e:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  802585:	00 00 00 
+    stat->st_dev = &devpipe;
+  802588:	48 b8 60 40 80 00 00 	movabs $0x804060,%rax
+  80258f:	00 00 00 
+  802592:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  802599:	b8 00 00 00 00       	mov    $0x0,%eax
+  80259e:	5b                   	pop    %rbx
+  80259f:	41 5c                	pop    %r12
+  8025a1:	5d                   	pop    %rbp
+  8025a2:	c3                   	ret
+
+00000000008025a3 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  8025a3:	55                   	push   %rbp
+  8025a4:	48 89 e5             	mov    %rsp,%rbp
+  8025a7:	41 54                	push   %r12
+  8025a9:	53                   	push   %rbx
+  8025aa:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8025ad:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8025b2:	48 89 fe             	mov    %rdi,%rsi
+  8025b5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8025ba:	49 bc ce 14 80 00 00 	movabs $0x8014ce,%r12
+  8025c1:	00 00 00 
+  8025c4:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  8025c7:	48 89 df             	mov    %rbx,%rdi
+  8025ca:	48 b8 b3 19 80 00 00 	movabs $0x8019b3,%rax
+  8025d1:	00 00 00 
+  8025d4:	ff d0                	call   *%rax
+  8025d6:	48 89 c6             	mov    %rax,%rsi
+  8025d9:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8025de:	bf 00 00 00 00       	mov    $0x0,%edi
+  8025e3:	41 ff d4             	call   *%r12
+}
+  8025e6:	5b                   	pop    %rbx
+  8025e7:	41 5c                	pop    %r12
+  8025e9:	5d                   	pop    %rbp
+  8025ea:	c3                   	ret
+
+00000000008025eb <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8025eb:	55                   	push   %rbp
+  8025ec:	48 89 e5             	mov    %rsp,%rbp
+  8025ef:	41 57                	push   %r15
+  8025f1:	41 56                	push   %r14
+  8025f3:	41 55                	push   %r13
+  8025f5:	41 54                	push   %r12
+  8025f7:	53                   	push   %rbx
+  8025f8:	48 83 ec 18          	sub    $0x18,%rsp
+  8025fc:	49 89 fc             	mov    %rdi,%r12
+  8025ff:	49 89 f5             	mov    %rsi,%r13
+  802602:	49 89 d7             	mov    %rdx,%r15
+  802605:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802609:	48 b8 b3 19 80 00 00 	movabs $0x8019b3,%rax
+  802610:	00 00 00 
+  802613:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  802615:	4d 85 ff             	test   %r15,%r15
+  802618:	0f 84 af 00 00 00    	je     8026cd <devpipe_write+0xe2>
+  80261e:	48 89 c3             	mov    %rax,%rbx
+  802621:	4c 89 f8             	mov    %r15,%rax
+  802624:	4d 89 ef             	mov    %r13,%r15
+  802627:	4c 01 e8             	add    %r13,%rax
+  80262a:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80262e:	49 bd d6 13 80 00 00 	movabs $0x8013d6,%r13
+  802635:	00 00 00 
+            sys_yield();
+  802638:	49 be 73 13 80 00 00 	movabs $0x801373,%r14
+  80263f:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  802642:	8b 73 04             	mov    0x4(%rbx),%esi
+  802645:	48 63 ce             	movslq %esi,%rcx
+  802648:	48 63 03             	movslq (%rbx),%rax
+  80264b:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  802651:	48 39 c1             	cmp    %rax,%rcx
+  802654:	72 2e                	jb     802684 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802656:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80265b:	48 89 da             	mov    %rbx,%rdx
+  80265e:	be 00 10 00 00       	mov    $0x1000,%esi
+  802663:	4c 89 e7             	mov    %r12,%rdi
+  802666:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  802669:	85 c0                	test   %eax,%eax
+  80266b:	74 66                	je     8026d3 <devpipe_write+0xe8>
+            sys_yield();
+  80266d:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  802670:	8b 73 04             	mov    0x4(%rbx),%esi
+  802673:	48 63 ce             	movslq %esi,%rcx
+  802676:	48 63 03             	movslq (%rbx),%rax
+  802679:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  80267f:	48 39 c1             	cmp    %rax,%rcx
+  802682:	73 d2                	jae    802656 <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  802684:	41 0f b6 3f          	movzbl (%r15),%edi
+  802688:	48 89 ca             	mov    %rcx,%rdx
+  80268b:	48 c1 ea 03          	shr    $0x3,%rdx
+  80268f:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  802696:	08 10 20 
+  802699:	48 f7 e2             	mul    %rdx
+  80269c:	48 c1 ea 06          	shr    $0x6,%rdx
+  8026a0:	48 89 d0             	mov    %rdx,%rax
+  8026a3:	48 c1 e0 09          	shl    $0x9,%rax
+  8026a7:	48 29 d0             	sub    %rdx,%rax
+  8026aa:	48 c1 e0 03          	shl    $0x3,%rax
+  8026ae:	48 29 c1             	sub    %rax,%rcx
+  8026b1:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  8026b6:	83 c6 01             	add    $0x1,%esi
+  8026b9:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8026bc:	49 83 c7 01          	add    $0x1,%r15
+  8026c0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8026c4:	49 39 c7             	cmp    %rax,%r15
+  8026c7:	0f 85 75 ff ff ff    	jne    802642 <devpipe_write+0x57>
+    return n;
+  8026cd:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8026d1:	eb 05                	jmp    8026d8 <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  8026d3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8026d8:	48 83 c4 18          	add    $0x18,%rsp
+  8026dc:	5b                   	pop    %rbx
+  8026dd:	41 5c                	pop    %r12
+  8026df:	41 5d                	pop    %r13
+  8026e1:	41 5e                	pop    %r14
+  8026e3:	41 5f                	pop    %r15
+  8026e5:	5d                   	pop    %rbp
+  8026e6:	c3                   	ret
+
+00000000008026e7 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  8026e7:	55                   	push   %rbp
+  8026e8:	48 89 e5             	mov    %rsp,%rbp
+  8026eb:	41 57                	push   %r15
+  8026ed:	41 56                	push   %r14
+  8026ef:	41 55                	push   %r13
+  8026f1:	41 54                	push   %r12
+  8026f3:	53                   	push   %rbx
+  8026f4:	48 83 ec 18          	sub    $0x18,%rsp
+  8026f8:	49 89 fc             	mov    %rdi,%r12
+  8026fb:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  8026ff:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802703:	48 b8 b3 19 80 00 00 	movabs $0x8019b3,%rax
+  80270a:	00 00 00 
+  80270d:	ff d0                	call   *%rax
+  80270f:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  802712:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802718:	49 bd d6 13 80 00 00 	movabs $0x8013d6,%r13
+  80271f:	00 00 00 
+            sys_yield();
+  802722:	49 be 73 13 80 00 00 	movabs $0x801373,%r14
+  802729:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  80272c:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  802731:	74 7d                	je     8027b0 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  802733:	8b 03                	mov    (%rbx),%eax
+  802735:	3b 43 04             	cmp    0x4(%rbx),%eax
+  802738:	75 26                	jne    802760 <devpipe_read+0x79>
+            if (i > 0) return i;
+  80273a:	4d 85 ff             	test   %r15,%r15
+  80273d:	75 77                	jne    8027b6 <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80273f:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802744:	48 89 da             	mov    %rbx,%rdx
+  802747:	be 00 10 00 00       	mov    $0x1000,%esi
+  80274c:	4c 89 e7             	mov    %r12,%rdi
+  80274f:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  802752:	85 c0                	test   %eax,%eax
+  802754:	74 72                	je     8027c8 <devpipe_read+0xe1>
+            sys_yield();
+  802756:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  802759:	8b 03                	mov    (%rbx),%eax
+  80275b:	3b 43 04             	cmp    0x4(%rbx),%eax
+  80275e:	74 df                	je     80273f <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802760:	48 63 c8             	movslq %eax,%rcx
+  802763:	48 89 ca             	mov    %rcx,%rdx
+  802766:	48 c1 ea 03          	shr    $0x3,%rdx
+  80276a:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  802771:	08 10 20 
+  802774:	48 89 d0             	mov    %rdx,%rax
+  802777:	48 f7 e6             	mul    %rsi
+  80277a:	48 c1 ea 06          	shr    $0x6,%rdx
+  80277e:	48 89 d0             	mov    %rdx,%rax
+  802781:	48 c1 e0 09          	shl    $0x9,%rax
+  802785:	48 29 d0             	sub    %rdx,%rax
+  802788:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  80278f:	00 
+  802790:	48 89 c8             	mov    %rcx,%rax
+  802793:	48 29 d0             	sub    %rdx,%rax
+  802796:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  80279b:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80279f:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  8027a3:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8027a6:	49 83 c7 01          	add    $0x1,%r15
+  8027aa:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  8027ae:	75 83                	jne    802733 <devpipe_read+0x4c>
+    return n;
+  8027b0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8027b4:	eb 03                	jmp    8027b9 <devpipe_read+0xd2>
+            if (i > 0) return i;
+  8027b6:	4c 89 f8             	mov    %r15,%rax
+}
+  8027b9:	48 83 c4 18          	add    $0x18,%rsp
+  8027bd:	5b                   	pop    %rbx
+  8027be:	41 5c                	pop    %r12
+  8027c0:	41 5d                	pop    %r13
+  8027c2:	41 5e                	pop    %r14
+  8027c4:	41 5f                	pop    %r15
+  8027c6:	5d                   	pop    %rbp
+  8027c7:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  8027c8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027cd:	eb ea                	jmp    8027b9 <devpipe_read+0xd2>
+
+00000000008027cf <pipe>:
+pipe(int pfd[2]) {
+  8027cf:	55                   	push   %rbp
+  8027d0:	48 89 e5             	mov    %rsp,%rbp
+  8027d3:	41 55                	push   %r13
+  8027d5:	41 54                	push   %r12
+  8027d7:	53                   	push   %rbx
+  8027d8:	48 81 ec b8 00 00 00 	sub    $0xb8,%rsp
+  8027df:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8027e2:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  8027e6:	48 b8 48 1a 80 00 00 	movabs $0x801a48,%rax
+  8027ed:	00 00 00 
+  8027f0:	ff d0                	call   *%rax
+  8027f2:	89 c3                	mov    %eax,%ebx
+  8027f4:	85 c0                	test   %eax,%eax
+  8027f6:	0f 88 51 01 00 00    	js     80294d <pipe+0x17e>
+        (res = fd_alloc_from(fd2num(fd0) + 1, &fd1)) < 0) goto err;
+  8027fc:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802800:	48 b8 a1 19 80 00 00 	movabs $0x8019a1,%rax
+  802807:	00 00 00 
+  80280a:	ff d0                	call   *%rax
+  80280c:	8d 78 01             	lea    0x1(%rax),%edi
+  80280f:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802813:	48 b8 cf 19 80 00 00 	movabs $0x8019cf,%rax
+  80281a:	00 00 00 
+  80281d:	ff d0                	call   *%rax
+  80281f:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  802821:	85 c0                	test   %eax,%eax
+  802823:	0f 88 24 01 00 00    	js     80294d <pipe+0x17e>
+    va = fd2data(fd0);
+  802829:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80282d:	48 bb b3 19 80 00 00 	movabs $0x8019b3,%rbx
+  802834:	00 00 00 
+  802837:	ff d3                	call   *%rbx
+  802839:	49 89 c5             	mov    %rax,%r13
+    struct RegionOp ops[] = {
+  80283c:	48 8d bd 30 ff ff ff 	lea    -0xd0(%rbp),%rdi
+  802843:	b9 14 00 00 00       	mov    $0x14,%ecx
+  802848:	b8 00 00 00 00       	mov    $0x0,%eax
+  80284d:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+  802850:	c7 85 34 ff ff ff 46 	movl   $0x46,-0xcc(%rbp)
+  802857:	00 00 00 
+  80285a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80285e:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+  802865:	48 c7 85 50 ff ff ff 	movq   $0x1000,-0xb0(%rbp)
+  80286c:	00 10 00 00 
+  802870:	c7 85 5c ff ff ff 46 	movl   $0x46,-0xa4(%rbp)
+  802877:	00 00 00 
+            {.type = REGION_ALLOC, .dstva = (uintptr_t)fd1, .size = PAGE_SIZE, .perm = PROT_RW | PROT_SHARE},
+  80287a:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+    struct RegionOp ops[] = {
+  80287e:	48 89 bd 70 ff ff ff 	mov    %rdi,-0x90(%rbp)
+  802885:	48 c7 85 78 ff ff ff 	movq   $0x1000,-0x88(%rbp)
+  80288c:	00 10 00 00 
+  802890:	c7 45 84 46 00 00 00 	movl   $0x46,-0x7c(%rbp)
+  802897:	4c 89 6d 98          	mov    %r13,-0x68(%rbp)
+  80289b:	48 c7 45 a0 00 10 00 	movq   $0x1000,-0x60(%rbp)
+  8028a2:	00 
+  8028a3:	c7 45 a8 01 00 00 00 	movl   $0x1,-0x58(%rbp)
+  8028aa:	c7 45 ac 46 00 00 00 	movl   $0x46,-0x54(%rbp)
+  8028b1:	4c 89 6d b8          	mov    %r13,-0x48(%rbp)
+            {.type = REGION_MAP, .srcva = (uintptr_t)va, .dstva = (uintptr_t)fd2data(fd1), .size = PAGE_SIZE, .perm = PROT_RW | PROT_SHARE},
+  8028b5:	ff d3                	call   *%rbx
+    struct RegionOp ops[] = {
+  8028b7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8028bb:	48 c7 45 c8 00 10 00 	movq   $0x1000,-0x38(%rbp)
+  8028c2:	00 
+    if ((res = sys_region_batch(ops, sizeof ops / sizeof *ops)) < 0) goto err1;
+  8028c3:	be 04 00 00 00       	mov    $0x4,%esi
+  8028c8:	48 8d bd 30 ff ff ff 	lea    -0xd0(%rbp),%rdi
+  8028cf:	48 b8 35 15 80 00 00 	movabs $0x801535,%rax
+  8028d6:	00 00 00 
+  8028d9:	ff d0                	call   *%rax
+  8028db:	89 c3                	mov    %eax,%ebx
+  8028dd:	85 c0                	test   %eax,%eax
+  8028df:	0f 88 ad 00 00 00    	js     802992 <pipe+0x1c3>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8028e5:	be 00 10 00 00       	mov    $0x1000,%esi
+  8028ea:	4c 89 ef             	mov    %r13,%rdi
+  8028ed:	48 b8 a4 13 80 00 00 	movabs $0x8013a4,%rax
+  8028f4:	00 00 00 
+  8028f7:	ff d0                	call   *%rax
+  8028f9:	83 f8 02             	cmp    $0x2,%eax
+  8028fc:	75 5f                	jne    80295d <pipe+0x18e>
+    fd0->fd_dev_id = devpipe.dev_id;
+  8028fe:	a1 60 40 80 00 00 00 	movabs 0x804060,%eax
+  802905:	00 00 
+  802907:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80290b:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  80290d:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802911:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  802918:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  80291c:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  80291e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802922:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  802929:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80292d:	48 bb a1 19 80 00 00 	movabs $0x8019a1,%rbx
+  802934:	00 00 00 
+  802937:	ff d3                	call   *%rbx
+  802939:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  80293d:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  802941:	ff d3                	call   *%rbx
+  802943:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  802948:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  80294d:	89 d8                	mov    %ebx,%eax
+  80294f:	48 81 c4 b8 00 00 00 	add    $0xb8,%rsp
+  802956:	5b                   	pop    %rbx
+  802957:	41 5c                	pop    %r12
+  802959:	41 5d                	pop    %r13
+  80295b:	5d                   	pop    %rbp
+  80295c:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  80295d:	48 b9 10 38 80 00 00 	movabs $0x803810,%rcx
+  802964:	00 00 00 
+  802967:	48 ba e7 37 80 00 00 	movabs $0x8037e7,%rdx
+  80296e:	00 00 00 
+  802971:	be 33 00 00 00       	mov    $0x33,%esi
+  802976:	48 bf fc 37 80 00 00 	movabs $0x8037fc,%rdi
+  80297d:	00 00 00 
+  802980:	b8 00 00 00 00       	mov    $0x0,%eax
+  802985:	49 b8 dd 03 80 00 00 	movabs $0x8003dd,%r8
+  80298c:	00 00 00 
+  80298f:	41 ff d0             	call   *%r8
+        ops[i].type = REGION_UNMAP;
+  802992:	c7 85 30 ff ff ff 02 	movl   $0x2,-0xd0(%rbp)
+  802999:	00 00 00 
+  80299c:	c7 85 58 ff ff ff 02 	movl   $0x2,-0xa8(%rbp)
+  8029a3:	00 00 00 
+  8029a6:	c7 45 80 02 00 00 00 	movl   $0x2,-0x80(%rbp)
+  8029ad:	c7 45 a8 02 00 00 00 	movl   $0x2,-0x58(%rbp)
+    sys_region_batch(ops, sizeof ops / sizeof *ops);
+  8029b4:	be 04 00 00 00       	mov    $0x4,%esi
+  8029b9:	48 8d bd 30 ff ff ff 	lea    -0xd0(%rbp),%rdi
+  8029c0:	48 b8 35 15 80 00 00 	movabs $0x801535,%rax
+  8029c7:	00 00 00 
+  8029ca:	ff d0                	call   *%rax
+  8029cc:	e9 7c ff ff ff       	jmp    80294d <pipe+0x17e>
+
+00000000008029d1 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  8029d1:	55                   	push   %rbp
+  8029d2:	48 89 e5             	mov    %rsp,%rbp
+  8029d5:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8029d9:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8029dd:	48 b8 62 1a 80 00 00 	movabs $0x801a62,%rax
+  8029e4:	00 00 00 
+  8029e7:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8029e9:	85 c0                	test   %eax,%eax
+  8029eb:	78 35                	js     802a22 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  8029ed:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8029f1:	48 b8 b3 19 80 00 00 	movabs $0x8019b3,%rax
+  8029f8:	00 00 00 
+  8029fb:	ff d0                	call   *%rax
+  8029fd:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802a00:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802a05:	be 00 10 00 00       	mov    $0x1000,%esi
+  802a0a:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802a0e:	48 b8 d6 13 80 00 00 	movabs $0x8013d6,%rax
+  802a15:	00 00 00 
+  802a18:	ff d0                	call   *%rax
+  802a1a:	85 c0                	test   %eax,%eax
+  802a1c:	0f 94 c0             	sete   %al
+  802a1f:	0f b6 c0             	movzbl %al,%eax
+}
+  802a22:	c9                   	leave
+  802a23:	c3                   	ret
+
+0000000000802a24 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  802a24:	48 89 f8             	mov    %rdi,%rax
+  802a27:	48 c1 e8 27          	shr    $0x27,%rax
+  802a2b:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  802a32:	01 00 00 
+  802a35:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802a39:	f6 c2 01             	test   $0x1,%dl
+  802a3c:	74 6d                	je     802aab <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  802a3e:	48 89 f8             	mov    %rdi,%rax
+  802a41:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802a45:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802a4c:	01 00 00 
+  802a4f:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802a53:	f6 c2 01             	test   $0x1,%dl
+  802a56:	74 62                	je     802aba <get_uvpt_entry+0x96>
+  802a58:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802a5f:	01 00 00 
+  802a62:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802a66:	f6 c2 80             	test   $0x80,%dl
+  802a69:	75 4f                	jne    802aba <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  802a6b:	48 89 f8             	mov    %rdi,%rax
+  802a6e:	48 c1 e8 15          	shr    $0x15,%rax
+  802a72:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802a79:	01 00 00 
+  802a7c:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802a80:	f6 c2 01             	test   $0x1,%dl
+  802a83:	74 44                	je     802ac9 <get_uvpt_entry+0xa5>
+  802a85:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802a8c:	01 00 00 
+  802a8f:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802a93:	f6 c2 80             	test   $0x80,%dl
+  802a96:	75 31                	jne    802ac9 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  802a98:	48 c1 ef 0c          	shr    $0xc,%rdi
+  802a9c:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802aa3:	01 00 00 
+  802aa6:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  802aaa:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  802aab:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  802ab2:	01 00 00 
+  802ab5:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802ab9:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  802aba:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802ac1:	01 00 00 
+  802ac4:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802ac8:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  802ac9:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802ad0:	01 00 00 
+  802ad3:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802ad7:	c3                   	ret
+
+0000000000802ad8 <get_prot>:
+
+int
+get_prot(void *va) {
+  802ad8:	55                   	push   %rbp
+  802ad9:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  802adc:	48 b8 24 2a 80 00 00 	movabs $0x802a24,%rax
+  802ae3:	00 00 00 
+  802ae6:	ff d0                	call   *%rax
+  802ae8:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  802aeb:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  802af0:	89 c1                	mov    %eax,%ecx
+  802af2:	83 c9 04             	or     $0x4,%ecx
+  802af5:	f6 c2 01             	test   $0x1,%dl
+  802af8:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  802afb:	89 c1                	mov    %eax,%ecx
+  802afd:	83 c9 02             	or     $0x2,%ecx
+  802b00:	f6 c2 02             	test   $0x2,%dl
+  802b03:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  802b06:	89 c1                	mov    %eax,%ecx
+  802b08:	83 c9 01             	or     $0x1,%ecx
+  802b0b:	48 85 d2             	test   %rdx,%rdx
+  802b0e:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  802b11:	89 c1                	mov    %eax,%ecx
+  802b13:	83 c9 40             	or     $0x40,%ecx
+  802b16:	f6 c6 04             	test   $0x4,%dh
+  802b19:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  802b1c:	5d                   	pop    %rbp
+  802b1d:	c3                   	ret
+
+0000000000802b1e <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  802b1e:	55                   	push   %rbp
+  802b1f:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  802b22:	48 b8 24 2a 80 00 00 	movabs $0x802a24,%rax
+  802b29:	00 00 00 
+  802b2c:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  802b2e:	48 c1 e8 06          	shr    $0x6,%rax
+  802b32:	83 e0 01             	and    $0x1,%eax
+}
+  802b35:	5d                   	pop    %rbp
+  802b36:	c3                   	ret
+
+0000000000802b37 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  802b37:	55                   	push   %rbp
+  802b38:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  802b3b:	48 b8 24 2a 80 00 00 	movabs $0x802a24,%rax
+  802b42:	00 00 00 
+  802b45:	ff d0                	call   *%rax
+  802b47:	83 e0 01             	and    $0x1,%eax
+}
+  802b4a:	5d                   	pop    %rbp
+  802b4b:	c3                   	ret
+
+0000000000802b4c <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  802b4c:	55                   	push   %rbp
+  802b4d:	48 89 e5             	mov    %rsp,%rbp
+  802b50:	41 57                	push   %r15
+  802b52:	41 56                	push   %r14
+  802b54:	41 55                	push   %r13
+  802b56:	41 54                	push   %r12
+  802b58:	53                   	push   %rbx
+  802b59:	48 83 ec 38          	sub    $0x38,%rsp
+  802b5d:	49 89 f7             	mov    %rsi,%r15
+  802b60:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+                    }
+                    continue;
+                }
+                for (int ptei = 0; ptei < PT_ENTRY_COUNT; ptei++) {
+                    uintptr_t pte_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, pdei, ptei, 0);
+                    pte_t pte = uvpt[VPT(pte_addr)];
+  802b66:	49 bd 00 00 00 00 00 	movabs $0x10000000000,%r13
+  802b6d:	01 00 00 
+  802b70:	4d 89 e6             	mov    %r12,%r14
+  802b73:	49 89 fc             	mov    %rdi,%r12
+  802b76:	e9 19 01 00 00       	jmp    802c94 <foreach_shared_region+0x148>
+  802b7b:	48 89 5d b0          	mov    %rbx,-0x50(%rbp)
+  802b7f:	4c 89 75 a8          	mov    %r14,-0x58(%rbp)
+  802b83:	eb 52                	jmp    802bd7 <foreach_shared_region+0x8b>
+                for (int ptei = 0; ptei < PT_ENTRY_COUNT; ptei++) {
+  802b85:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802b8c:	48 81 fb 00 00 20 00 	cmp    $0x200000,%rbx
+  802b93:	74 2e                	je     802bc3 <foreach_shared_region+0x77>
+                    uintptr_t pte_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, pdei, ptei, 0);
+  802b95:	48 89 df             	mov    %rbx,%rdi
+  802b98:	4c 09 f7             	or     %r14,%rdi
+                    pte_t pte = uvpt[VPT(pte_addr)];
+  802b9b:	48 89 f8             	mov    %rdi,%rax
+  802b9e:	48 c1 e8 0c          	shr    $0xc,%rax
+  802ba2:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+                    if ((pte & PTE_P) && (pte & PTE_SHARE)) {
+  802ba7:	25 01 04 00 00       	and    $0x401,%eax
+  802bac:	48 3d 01 04 00 00    	cmp    $0x401,%rax
+  802bb2:	75 d1                	jne    802b85 <foreach_shared_region+0x39>
+                        fun((void*)pte_addr, (void*)(pte_addr + PAGE_SIZE), arg);
+  802bb4:	48 8d b7 00 10 00 00 	lea    0x1000(%rdi),%rsi
+  802bbb:	4c 89 fa             	mov    %r15,%rdx
+  802bbe:	41 ff d4             	call   *%r12
+  802bc1:	eb c2                	jmp    802b85 <foreach_shared_region+0x39>
+            for (int pdei = 0; pdei < PD_ENTRY_COUNT; pdei++) {
+  802bc3:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  802bca:	00 
+  802bcb:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802bcf:	48 3d 00 00 00 40    	cmp    $0x40000000,%rax
+  802bd5:	74 46                	je     802c1d <foreach_shared_region+0xd1>
+                uintptr_t pde_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, pdei, 0, 0);
+  802bd7:	4c 8b 75 c8          	mov    -0x38(%rbp),%r14
+  802bdb:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802bdf:	49 09 c6             	or     %rax,%r14
+                pde_t pde = uvpd[VPD(pde_addr)];
+  802be2:	4c 89 f0             	mov    %r14,%rax
+  802be5:	48 c1 e8 15          	shr    $0x15,%rax
+  802be9:	48 b9 00 00 00 80 00 	movabs $0x10080000000,%rcx
+  802bf0:	01 00 00 
+  802bf3:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+                if (!(pde & PTE_P)) {
+  802bf7:	a8 01                	test   $0x1,%al
+  802bf9:	74 c8                	je     802bc3 <foreach_shared_region+0x77>
+                if (pde & PTE_PS) {
+  802bfb:	48 89 c3             	mov    %rax,%rbx
+  802bfe:	81 e3 80 00 00 00    	and    $0x80,%ebx
+  802c04:	74 8f                	je     802b95 <foreach_shared_region+0x49>
+                    if (pde & PTE_SHARE) {
+  802c06:	f6 c4 04             	test   $0x4,%ah
+  802c09:	74 b8                	je     802bc3 <foreach_shared_region+0x77>
+                        fun((void*)pde_addr, (void*)(pde_addr + 1024 * 1024 * 2), arg);
+  802c0b:	49 8d b6 00 00 20 00 	lea    0x200000(%r14),%rsi
+  802c12:	4c 89 fa             	mov    %r15,%rdx
+  802c15:	4c 89 f7             	mov    %r14,%rdi
+  802c18:	41 ff d4             	call   *%r12
+  802c1b:	eb a6                	jmp    802bc3 <foreach_shared_region+0x77>
+  802c1d:	48 8b 5d b0          	mov    -0x50(%rbp),%rbx
+  802c21:	4c 8b 75 a8          	mov    -0x58(%rbp),%r14
+        for (int pdpei = 0; pdpei < PDP_ENTRY_COUNT; pdpei++) {
+  802c25:	48 81 c3 00 00 00 40 	add    $0x40000000,%rbx
+  802c2c:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802c33:	00 00 00 
+  802c36:	48 39 c3             	cmp    %rax,%rbx
+  802c39:	74 4c                	je     802c87 <foreach_shared_region+0x13b>
+            uintptr_t pdpe_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, 0, 0, 0);
+  802c3b:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802c3f:	48 09 d8             	or     %rbx,%rax
+  802c42:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+            pdpe_t pdpe = uvpdp[VPDP(pdpe_addr)];
+  802c46:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802c4a:	48 b9 00 00 40 80 00 	movabs $0x10080400000,%rcx
+  802c51:	01 00 00 
+  802c54:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+            if (!(pdpe & PTE_P)) {
+  802c58:	a8 01                	test   $0x1,%al
+  802c5a:	74 c9                	je     802c25 <foreach_shared_region+0xd9>
+            if (pdpe & PTE_PS) {
+  802c5c:	48 89 c1             	mov    %rax,%rcx
+  802c5f:	81 e1 80 00 00 00    	and    $0x80,%ecx
+  802c65:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  802c69:	0f 84 0c ff ff ff    	je     802b7b <foreach_shared_region+0x2f>
+                if (pdpe & PTE_SHARE) {
+  802c6f:	f6 c4 04             	test   $0x4,%ah
+  802c72:	74 b1                	je     802c25 <foreach_shared_region+0xd9>
+                    fun((void*)pdpe_addr, (void*)(pdpe_addr + 1024 * 1024 * 1024), arg); 
+  802c74:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  802c78:	48 8d b7 00 00 00 40 	lea    0x40000000(%rdi),%rsi
+  802c7f:	4c 89 fa             	mov    %r15,%rdx
+  802c82:	41 ff d4             	call   *%r12
+  802c85:	eb 9e                	jmp    802c25 <foreach_shared_region+0xd9>
+    for (int pml4ei = 0; pml4ei < PML4_ENTRY_COUNT; pml4ei++) {
+  802c87:	49 83 c6 01          	add    $0x1,%r14
+  802c8b:	49 81 fe 00 02 00 00 	cmp    $0x200,%r14
+  802c92:	74 24                	je     802cb8 <foreach_shared_region+0x16c>
+        pml4e_t pml4e = uvpml4[VPML4(pml4_addr)];
+  802c94:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  802c9b:	01 00 00 
+  802c9e:	4a 8b 04 f0          	mov    (%rax,%r14,8),%rax
+        if (!(pml4e & PTE_P)) {
+  802ca2:	a8 01                	test   $0x1,%al
+  802ca4:	74 e1                	je     802c87 <foreach_shared_region+0x13b>
+  802ca6:	4c 89 f0             	mov    %r14,%rax
+  802ca9:	48 c1 e0 27          	shl    $0x27,%rax
+  802cad:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  802cb1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802cb6:	eb 83                	jmp    802c3b <foreach_shared_region+0xef>
+            }
+        }
+    }
+    
+    return 0;
+}
+  802cb8:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cbd:	48 83 c4 38          	add    $0x38,%rsp
+  802cc1:	5b                   	pop    %rbx
+  802cc2:	41 5c                	pop    %r12
+  802cc4:	41 5d                	pop    %r13
+  802cc6:	41 5e                	pop    %r14
+  802cc8:	41 5f                	pop    %r15
+  802cca:	5d                   	pop    %rbp
+  802ccb:	c3                   	ret
+
+0000000000802ccc <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  802ccc:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cd1:	c3                   	ret
+
+0000000000802cd2 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  802cd2:	55                   	push   %rbp
+  802cd3:	48 89 e5             	mov    %rsp,%rbp
+  802cd6:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  802cd9:	48 be 34 38 80 00 00 	movabs $0x803834,%rsi
+  802ce0:	00 00 00 
+  802ce3:	48 b8 52 0e 80 00 00 	movabs $0x800e52,%rax
+  802cea:	00 00 00 
+  802ced:	ff d0                	call   *%rax
+    return 0;
+}
+  802cef:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cf4:	5d                   	pop    %rbp
+  802cf5:	c3                   	ret
+
+0000000000802cf6 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  802cf6:	55                   	push   %rbp
+  802cf7:	48 89 e5             	mov    %rsp,%rbp
+  802cfa:	41 57                	push   %r15
+  802cfc:	41 56                	push   %r14
+  802cfe:	41 55                	push   %r13
+  802d00:	41 54                	push   %r12
+  802d02:	53                   	push   %rbx
+  802d03:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  802d0a:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  802d11:	48 85 d2             	test   %rdx,%rdx
+  802d14:	74 7a                	je     802d90 <devcons_write+0x9a>
+  802d16:	49 89 d6             	mov    %rdx,%r14
+  802d19:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802d1f:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  802d24:	49 bf 4c 10 80 00 00 	movabs $0x80104c,%r15
+  802d2b:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  802d2e:	4c 89 f3             	mov    %r14,%rbx
+  802d31:	48 29 f3             	sub    %rsi,%rbx
+  802d34:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802d39:	48 39 c3             	cmp    %rax,%rbx
+  802d3c:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  802d40:	4c 63 eb             	movslq %ebx,%r13
+  802d43:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  802d4a:	48 01 c6             	add    %rax,%rsi
+  802d4d:	4c 89 ea             	mov    %r13,%rdx
+  802d50:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802d57:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  802d5a:	4c 89 ee             	mov    %r13,%rsi
+  802d5d:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802d64:	48 b8 79 12 80 00 00 	movabs $0x801279,%rax
+  802d6b:	00 00 00 
+  802d6e:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  802d70:	41 01 dc             	add    %ebx,%r12d
+  802d73:	49 63 f4             	movslq %r12d,%rsi
+  802d76:	4c 39 f6             	cmp    %r14,%rsi
+  802d79:	72 b3                	jb     802d2e <devcons_write+0x38>
+    return res;
+  802d7b:	49 63 c4             	movslq %r12d,%rax
+}
+  802d7e:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  802d85:	5b                   	pop    %rbx
+  802d86:	41 5c                	pop    %r12
+  802d88:	41 5d                	pop    %r13
+  802d8a:	41 5e                	pop    %r14
+  802d8c:	41 5f                	pop    %r15
+  802d8e:	5d                   	pop    %rbp
+  802d8f:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  802d90:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802d96:	eb e3                	jmp    802d7b <devcons_write+0x85>
+
+0000000000802d98 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  802d98:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  802d9b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802da0:	48 85 c0             	test   %rax,%rax
+  802da3:	74 55                	je     802dfa <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  802da5:	55                   	push   %rbp
+  802da6:	48 89 e5             	mov    %rsp,%rbp
+  802da9:	41 55                	push   %r13
+  802dab:	41 54                	push   %r12
+  802dad:	53                   	push   %rbx
+  802dae:	48 83 ec 08          	sub    $0x8,%rsp
+  802db2:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  802db5:	48 bb a6 12 80 00 00 	movabs $0x8012a6,%rbx
+  802dbc:	00 00 00 
+  802dbf:	49 bc 73 13 80 00 00 	movabs $0x801373,%r12
+  802dc6:	00 00 00 
+  802dc9:	eb 03                	jmp    802dce <devcons_read+0x36>
+  802dcb:	41 ff d4             	call   *%r12
+  802dce:	ff d3                	call   *%rbx
+  802dd0:	85 c0                	test   %eax,%eax
+  802dd2:	74 f7                	je     802dcb <devcons_read+0x33>
+    if (c < 0) return c;
+  802dd4:	48 63 d0             	movslq %eax,%rdx
+  802dd7:	78 13                	js     802dec <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  802dd9:	ba 00 00 00 00       	mov    $0x0,%edx
+  802dde:	83 f8 04             	cmp    $0x4,%eax
+  802de1:	74 09                	je     802dec <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  802de3:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  802de7:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  802dec:	48 89 d0             	mov    %rdx,%rax
+  802def:	48 83 c4 08          	add    $0x8,%rsp
+  802df3:	5b                   	pop    %rbx
+  802df4:	41 5c                	pop    %r12
+  802df6:	41 5d                	pop    %r13
+  802df8:	5d                   	pop    %rbp
+  802df9:	c3                   	ret
+  802dfa:	48 89 d0             	mov    %rdx,%rax
+  802dfd:	c3                   	ret
+
+0000000000802dfe <cputchar>:
+cputchar(int ch) {
+  802dfe:	55                   	push   %rbp
+  802dff:	48 89 e5             	mov    %rsp,%rbp
+  802e02:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  802e06:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  802e0a:	be 01 00 00 00       	mov    $0x1,%esi
+  802e0f:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  802e13:	48 b8 79 12 80 00 00 	movabs $0x801279,%rax
+  802e1a:	00 00 00 
+  802e1d:	ff d0                	call   *%rax
+}
+  802e1f:	c9                   	leave
+  802e20:	c3                   	ret
+
+0000000000802e21 <getchar>:
+getchar(void) {
+  802e21:	55                   	push   %rbp
+  802e22:	48 89 e5             	mov    %rsp,%rbp
+  802e25:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  802e29:	ba 01 00 00 00       	mov    $0x1,%edx
+  802e2e:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  802e32:	bf 00 00 00 00       	mov    $0x0,%edi
+  802e37:	48 b8 45 1d 80 00 00 	movabs $0x801d45,%rax
+  802e3e:	00 00 00 
+  802e41:	ff d0                	call   *%rax
+  802e43:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  802e45:	85 c0                	test   %eax,%eax
+  802e47:	78 06                	js     802e4f <getchar+0x2e>
+  802e49:	74 08                	je     802e53 <getchar+0x32>
+  802e4b:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  802e4f:	89 d0                	mov    %edx,%eax
+  802e51:	c9                   	leave
+  802e52:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  802e53:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  802e58:	eb f5                	jmp    802e4f <getchar+0x2e>
+
+0000000000802e5a <iscons>:
+iscons(int fdnum) {
+  802e5a:	55                   	push   %rbp
+  802e5b:	48 89 e5             	mov    %rsp,%rbp
+  802e5e:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  802e62:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802e66:	48 b8 62 1a 80 00 00 	movabs $0x801a62,%rax
+  802e6d:	00 00 00 
+  802e70:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802e72:	85 c0                	test   %eax,%eax
+  802e74:	78 18                	js     802e8e <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  802e76:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802e7a:	48 b8 a0 40 80 00 00 	movabs $0x8040a0,%rax
+  802e81:	00 00 00 
+  802e84:	8b 00                	mov    (%rax),%eax
+  802e86:	39 02                	cmp    %eax,(%rdx)
+  802e88:	0f 94 c0             	sete   %al
+  802e8b:	0f b6 c0             	movzbl %al,%eax
+}
+  802e8e:	c9                   	leave
+  802e8f:	c3                   	ret
+
+0000000000802e90 <opencons>:
+opencons(void) {
+  802e90:	55                   	push   %rbp
+  802e91:	48 89 e5             	mov    %rsp,%rbp
+  802e94:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802e98:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  802e9c:	48 b8 48 1a 80 00 00 	movabs $0x801a48,%rax
+  802ea3:	00 00 00 
+  802ea6:	ff d0                	call   *%rax
+  802ea8:	85 c0                	test   %eax,%eax
+  802eaa:	78 49                	js     802ef5 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  802eac:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802eb1:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802eb6:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  802eba:	bf 00 00 00 00       	mov    $0x0,%edi
+  802ebf:	48 b8 02 14 80 00 00 	movabs $0x801402,%rax
+  802ec6:	00 00 00 
+  802ec9:	ff d0                	call   *%rax
+  802ecb:	85 c0                	test   %eax,%eax
+  802ecd:	78 26                	js     802ef5 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  802ecf:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802ed3:	a1 a0 40 80 00 00 00 	movabs 0x8040a0,%eax
+  802eda:	00 00 
+  802edc:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  802ede:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802ee2:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  802ee9:	48 b8 a1 19 80 00 00 	movabs $0x8019a1,%rax
+  802ef0:	00 00 00 
+  802ef3:	ff d0                	call   *%rax
+}
+  802ef5:	c9                   	leave
+  802ef6:	c3                   	ret
+
+0000000000802ef7 <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  802ef7:	55                   	push   %rbp
+  802ef8:	48 89 e5             	mov    %rsp,%rbp
+  802efb:	41 55                	push   %r13
+  802efd:	41 54                	push   %r12
+  802eff:	53                   	push   %rbx
+  802f00:	48 83 ec 08          	sub    $0x8,%rsp
+  802f04:	49 89 fc             	mov    %rdi,%r12
+  802f07:	48 89 f7             	mov    %rsi,%rdi
+  802f0a:	48 89 d3             	mov    %rdx,%rbx
+  802f0d:	49 89 cd             	mov    %rcx,%r13
+    // LAB 9: Your code here:
+    int res = sys_ipc_recv(!pg ? (void*)MAX_USER_ADDRESS : pg, !size ? 0 : *size);
+  802f10:	be 00 00 00 00       	mov    $0x0,%esi
+  802f15:	48 85 d2             	test   %rdx,%rdx
+  802f18:	74 03                	je     802f1d <ipc_recv+0x26>
+  802f1a:	48 8b 32             	mov    (%rdx),%rsi
+  802f1d:	48 85 ff             	test   %rdi,%rdi
+  802f20:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802f27:	00 00 00 
+  802f2a:	48 0f 44 f8          	cmove  %rax,%rdi
+  802f2e:	48 b8 d4 17 80 00 00 	movabs $0x8017d4,%rax
+  802f35:	00 00 00 
+  802f38:	ff d0                	call   *%rax
+    if (res < 0) {
+  802f3a:	85 c0                	test   %eax,%eax
+  802f3c:	78 66                	js     802fa4 <ipc_recv+0xad>
+        if (size) {
+            *size = 0;
+        }
+        return res;
+    }
+    if (from_env_store) {
+  802f3e:	4d 85 e4             	test   %r12,%r12
+  802f41:	74 14                	je     802f57 <ipc_recv+0x60>
+        *from_env_store = thisenv->env_ipc_from;
+  802f43:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802f4a:	00 00 00 
+  802f4d:	8b 80 ac 01 00 00    	mov    0x1ac(%rax),%eax
+  802f53:	41 89 04 24          	mov    %eax,(%r12)
+    }
+    if (perm_store) {
+  802f57:	4d 85 ed             	test   %r13,%r13
+  802f5a:	74 14                	je     802f70 <ipc_recv+0x79>
+        *perm_store = thisenv->env_ipc_perm;
+  802f5c:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802f63:	00 00 00 
+  802f66:	8b 80 b0 01 00 00    	mov    0x1b0(%rax),%eax
+  802f6c:	41 89 45 00          	mov    %eax,0x0(%r13)
+    }
+    if (size) {
+  802f70:	48 85 db             	test   %rbx,%rbx
+  802f73:	74 14                	je     802f89 <ipc_recv+0x92>
+        *size = thisenv->env_ipc_maxsz;
+  802f75:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802f7c:	00 00 00 
+  802f7f:	48 8b 80 a0 01 00 00 	mov    0x1a0(%rax),%rax
+  802f86:	48 89 03             	mov    %rax,(%rbx)
+    }
+    return thisenv->env_ipc_value;
+  802f89:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802f90:	00 00 00 
+  802f93:	8b 80 a8 01 00 00    	mov    0x1a8(%rax),%eax
+}
+  802f99:	48 83 c4 08          	add    $0x8,%rsp
+  802f9d:	5b                   	pop    %rbx
+  802f9e:	41 5c                	pop    %r12
+  802fa0:	41 5d                	pop    %r13
+  802fa2:	5d                   	pop    %rbp
+  802fa3:	c3                   	ret
+        if (from_env_store) {
+  802fa4:	4d 85 e4             	test   %r12,%r12
+  802fa7:	74 08                	je     802fb1 <ipc_recv+0xba>
+            *from_env_store = 0;
+  802fa9:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  802fb0:	00 
+        if (perm_store) {
+  802fb1:	4d 85 ed             	test   %r13,%r13
+  802fb4:	74 08                	je     802fbe <ipc_recv+0xc7>
+            *perm_store = 0;
+  802fb6:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  802fbd:	00 
+        if (size) {
+  802fbe:	48 85 db             	test   %rbx,%rbx
+  802fc1:	74 d6                	je     802f99 <ipc_recv+0xa2>
+            *size = 0;
+  802fc3:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  802fca:	eb cd                	jmp    802f99 <ipc_recv+0xa2>
+
+0000000000802fcc <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  802fcc:	55                   	push   %rbp
+  802fcd:	48 89 e5             	mov    %rsp,%rbp
+  802fd0:	41 57                	push   %r15
+  802fd2:	41 56                	push   %r14
+  802fd4:	41 55                	push   %r13
+  802fd6:	41 54                	push   %r12
+  802fd8:	53                   	push   %rbx
+  802fd9:	48 83 ec 18          	sub    $0x18,%rsp
+  802fdd:	41 89 fd             	mov    %edi,%r13d
+  802fe0:	89 75 cc             	mov    %esi,-0x34(%rbp)
+  802fe3:	49 89 cc             	mov    %rcx,%r12
+  802fe6:	44 89 45 c8          	mov    %r8d,-0x38(%rbp)
+    // LAB 9: Your code here:
+    int res = 0;
+    while ((res = sys_ipc_try_send(to_env, val, !pg ? (void*)MAX_USER_ADDRESS : pg, size, perm)) < 0) {
+  802fea:	48 85 d2             	test   %rdx,%rdx
+  802fed:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802ff4:	00 00 00 
+  802ff7:	48 0f 45 c2          	cmovne %rdx,%rax
+  802ffb:	48 89 c3             	mov    %rax,%rbx
+  802ffe:	49 be a8 17 80 00 00 	movabs $0x8017a8,%r14
+  803005:	00 00 00 
+        if (res != -E_IPC_NOT_RECV) {
+            panic("sys_ipc_try_send failed: %i", res);
+        }
+        sys_yield();
+  803008:	49 bf 73 13 80 00 00 	movabs $0x801373,%r15
+  80300f:	00 00 00 
+    while ((res = sys_ipc_try_send(to_env, val, !pg ? (void*)MAX_USER_ADDRESS : pg, size, perm)) < 0) {
+  803012:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  803015:	44 8b 45 c8          	mov    -0x38(%rbp),%r8d
+  803019:	4c 89 e1             	mov    %r12,%rcx
+  80301c:	48 89 da             	mov    %rbx,%rdx
+  80301f:	44 89 ef             	mov    %r13d,%edi
+  803022:	41 ff d6             	call   *%r14
+  803025:	85 c0                	test   %eax,%eax
+  803027:	79 37                	jns    803060 <ipc_send+0x94>
+        if (res != -E_IPC_NOT_RECV) {
+  803029:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  80302c:	75 05                	jne    803033 <ipc_send+0x67>
+        sys_yield();
+  80302e:	41 ff d7             	call   *%r15
+  803031:	eb df                	jmp    803012 <ipc_send+0x46>
+            panic("sys_ipc_try_send failed: %i", res);
+  803033:	89 c1                	mov    %eax,%ecx
+  803035:	48 ba 40 38 80 00 00 	movabs $0x803840,%rdx
+  80303c:	00 00 00 
+  80303f:	be 40 00 00 00       	mov    $0x40,%esi
+  803044:	48 bf 5c 38 80 00 00 	movabs $0x80385c,%rdi
+  80304b:	00 00 00 
+  80304e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803053:	49 b8 dd 03 80 00 00 	movabs $0x8003dd,%r8
+  80305a:	00 00 00 
+  80305d:	41 ff d0             	call   *%r8
+    }
+    return;
+}
+  803060:	48 83 c4 18          	add    $0x18,%rsp
+  803064:	5b                   	pop    %rbx
+  803065:	41 5c                	pop    %r12
+  803067:	41 5d                	pop    %r13
+  803069:	41 5e                	pop    %r14
+  80306b:	41 5f                	pop    %r15
+  80306d:	5d                   	pop    %rbp
+  80306e:	c3                   	ret
+
+000000000080306f <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  80306f:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  803074:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  80307b:	00 00 00 
+  80307e:	48 69 d0 d0 01 00 00 	imul   $0x1d0,%rax,%rdx
+  803085:	48 01 ca             	add    %rcx,%rdx
+  803088:	8b 92 e8 00 00 00    	mov    0xe8(%rdx),%edx
+  80308e:	39 fa                	cmp    %edi,%edx
+  803090:	74 12                	je     8030a4 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  803092:	48 83 c0 01          	add    $0x1,%rax
+  803096:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  80309c:	75 e0                	jne    80307e <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  80309e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8030a3:	c3                   	ret
+            return envs[i].env_id;
+  8030a4:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+  8030ab:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8030b2:	00 00 00 
+  8030b5:	48 01 d0             	add    %rdx,%rax
+  8030b8:	8b 80 e0 00 00 00    	mov    0xe0(%rax),%eax
+  8030be:	c3                   	ret
+  8030bf:	90                   	nop
+
+00000000008030c0 <__rodata_start>:
+  8030c0:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  8030c2:	72 6b                	jb     80312f <__rodata_start+0x6f>
+  8030c4:	3a 20                	cmp    (%rax),%ah
+  8030c6:	25 69 00 75 73       	and    $0x73750069,%eax
+  8030cb:	65 72 2f             	gs jb  8030fd <__rodata_start+0x3d>
+  8030ce:	77 66                	ja     803136 <__rodata_start+0x76>
+  8030d0:	61                   	(bad)
+  8030d1:	69 72 6e 65 73 73 2e 	imul   $0x2e737365,0x6e(%rdx),%esi
+  8030d8:	63 00                	movsxd (%rax),%eax
+  8030da:	73 79                	jae    803155 <weights+0x15>
+  8030dc:	73 5f                	jae    80313d <__rodata_start+0x7d>
+  8030de:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  8030e0:	76 5f                	jbe    803141 <weights+0x1>
+  8030e2:	73 65                	jae    803149 <weights+0x9>
+  8030e4:	74 5f                	je     803145 <weights+0x5>
+  8030e6:	77 65                	ja     80314d <weights+0xd>
+  8030e8:	69 67 68 74 3a 20 25 	imul   $0x25203a74,0x68(%rdi),%esp
+  8030ef:	69 00 0f 1f 80 00    	imul   $0x801f0f,(%rax),%eax
+  8030f5:	00 00                	add    %al,(%rax)
+  8030f7:	00 77 66             	add    %dh,0x66(%rdi)
+  8030fa:	61                   	(bad)
+  8030fb:	69 72 6e 65 73 73 3a 	imul   $0x3a737365,0x6e(%rdx),%esi
+  803102:	20 65 6e             	and    %ah,0x6e(%rbp)
+  803105:	76 20                	jbe    803127 <__rodata_start+0x67>
+  803107:	25 30 38 78 20       	and    $0x20783830,%eax
+  80310c:	77 65                	ja     803173 <weights+0x33>
+  80310e:	69 67 68 74 20 25 34 	imul   $0x34252074,0x68(%rdi),%esp
+  803115:	75 3a                	jne    803151 <weights+0x11>
+  803117:	20 25 33 6c 75 2e    	and    %ah,0x2e756c33(%rip)        # 2ef59d50 <__bss_end+0x2e751d50>
+  80311d:	25 6c 75 25 25       	and    $0x2525756c,%eax
+  803122:	20 6f 66             	and    %ch,0x66(%rdi)
+  803125:	20 43 50             	and    %al,0x50(%rbx)
+  803128:	55                   	push   %rbp
+  803129:	20 28                	and    %ch,(%rax)
+  80312b:	65 78 70             	gs js  80319e <weights+0x5e>
+  80312e:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  803133:	20 25 6c 75 2e 25    	and    %ah,0x252e756c(%rip)        # 25aea6a5 <__bss_end+0x252e26a5>
+  803139:	6c                   	insb   (%dx),%es:(%rdi)
+  80313a:	75 25                	jne    803161 <weights+0x21>
+  80313c:	25                   	.byte 0x25
+  80313d:	29 0a                	sub    %ecx,(%rdx)
+	...
+
+0000000000803140 <weights>:
+  803140:	01 00 00 00 01 00 00 00 02 00 00 00 04 00 00 00     ................
+  803150:	3c 75 6e 6b 6e 6f 77 6e 3e 00 66 0f 1f 44 00 00     <unknown>.f..D..
+  803160:	5b 25 30 38 78 5d 20 75 73 65 72 20 70 61 6e 69     [%08x] user pani
+  803170:	63 20 69 6e 20 25 73 20 61 74 20 25 73 3a 25 64     c in %s at %s:%d
+  803180:	3a 20 00 30 31 32 33 34 35 36 37 38 39 41 42 43     : .0123456789ABC
+  803190:	44 45 46 00 30 31 32 33 34 35 36 37 38 39 61 62     DEF.0123456789ab
+  8031a0:	63 64 65 66 00 28 6e 75 6c 6c 29 00 65 72 72 6f     cdef.(null).erro
+  8031b0:	72 20 25 64 00 75 6e 73 70 65 63 69 66 69 65 64     r %d.unspecified
+  8031c0:	20 65 72 72 6f 72 00 62 61 64 20 65 6e 76 69 72      error.bad envir
+  8031d0:	6f 6e 6d 65 6e 74 00 69 6e 76 61 6c 69 64 20 70     onment.invalid p
+  8031e0:	61 72 61 6d 65 74 65 72 00 6f 75 74 20 6f 66 20     arameter.out of 
+  8031f0:	6d 65 6d 6f 72 79 00 6f 75 74 20 6f 66 20 65 6e     memory.out of en
+  803200:	76 69 72 6f 6e 6d 65 6e 74 73 00 63 6f 72 72 75     vironments.corru
+  803210:	70 74 65 64 20 64 65 62 75 67 20 69 6e 66 6f 00     pted debug info.
+  803220:	73 65 67 6d 65 6e 74 61 74 69 6f 6e 20 66 61 75     segmentation fau
+  803230:	6c 74 00 69 6e 76 61 6c 69 64 20 45 4c 46 20 69     lt.invalid ELF i
+  803240:	6d 61 67 65 00 6e 6f 20 73 75 63 68 20 73 79 73     mage.no such sys
+  803250:	74 65 6d 20 63 61 6c 6c 00 65 6e 74 72 79 20 6e     tem call.entry n
+  803260:	6f 74 20 66 6f 75 6e 64 00 65 6e 76 20 69 73 20     ot found.env is 
+  803270:	6e 6f 74 20 72 65 63 76 69 6e 67 00 75 6e 65 78     not recving.unex
+  803280:	70 65 63 74 65 64 20 65 6e 64 20 6f 66 20 66 69     pected end of fi
+  803290:	6c 65 00 6e 6f 20 66 72 65 65 20 73 70 61 63 65     le.no free space
+  8032a0:	20 6f 6e 20 64 69 73 6b 00 74 6f 6f 20 6d 61 6e      on disk.too man
+  8032b0:	79 20 66 69 6c 65 73 20 61 72 65 20 6f 70 65 6e     y files are open
+  8032c0:	00 66 69 6c 65 20 6f 72 20 62 6c 6f 63 6b 20 6e     .file or block n
+  8032d0:	6f 74 20 66 6f 75 6e 64 00 69 6e 76 61 6c 69 64     ot found.invalid
+  8032e0:	20 70 61 74 68 00 66 69 6c 65 20 61 6c 72 65 61      path.file alrea
+  8032f0:	64 79 20 65 78 69 73 74 73 00 6f 70 65 72 61 74     dy exists.operat
+  803300:	69 6f 6e 20 6e 6f 74 20 73 75 70 70 6f 72 74 65     ion not supporte
+  803310:	64 00 6f 70 65 72 61 74 69 6f 6e 20 69 6e 74 65     d.operation inte
+  803320:	72 72 75 70 74 65 64 00 6e 6f 74 20 65 6e 6f 75     rrupted.not enou
+  803330:	67 68 20 43 50 55 20 74 69 6d 65 00 0f 1f 40 00     gh CPU time...@.
+  803340:	1a 07 80 00 00 00 00 00 5b 0d 80 00 00 00 00 00     ........[.......
+  803350:	4b 0d 80 00 00 00 00 00 5b 0d 80 00 00 00 00 00     K.......[.......
+  803360:	5b 0d 80 00 00 00 00 00 5b 0d 80 00 00 00 00 00     [.......[.......
+  803370:	5b 0d 80 00 00 00 00 00 39 07 80 00 00 00 00 00     [.......9.......
+  803380:	5b 0d 80 00 00 00 00 00 5b 0d 80 00 00 00 00 00     [.......[.......
+  803390:	2d 07 80 00 00 00 00 00 a7 07 80 00 00 00 00 00     -...............
+  8033a0:	5b 0d 80 00 00 00 00 00 2d 07 80 00 00 00 00 00     [.......-.......
+  8033b0:	73 07 80 00 00 00 00 00 73 07 80 00 00 00 00 00     s.......s.......
+  8033c0:	73 07 80 00 00 00 00 00 73 07 80 00 00 00 00 00     s.......s.......
+  8033d0:	73 07 80 00 00 00 00 00 73 07 80 00 00 00 00 00     s.......s.......
+  8033e0:	73 07 80 00 00 00 00 00 73 07 80 00 00 00 00 00     s.......s.......
+  8033f0:	73 07 80 00 00 00 00 00 5b 0d 80 00 00 00 00 00     s.......[.......
+  803400:	5b 0d 80 00 00 00 00 00 5b 0d 80 00 00 00 00 00     [.......[.......
+  803410:	5b 0d 80 00 00 00 00 00 5b 0d 80 00 00 00 00 00     [.......[.......
+  803420:	5b 0d 80 00 00 00 00 00 5b 0d 80 00 00 00 00 00     [.......[.......
+  803430:	5b 0d 80 00 00 00 00 00 5b 0d 80 00 00 00 00 00     [.......[.......
+  803440:	5b 0d 80 00 00 00 00 00 5b 0d 80 00 00 00 00 00     [.......[.......
+  803450:	5b 0d 80 00 00 00 00 00 5b 0d 80 00 00 00 00 00     [.......[.......
+  803460:	5b 0d 80 00 00 00 00 00 5b 0d 80 00 00 00 00 00     [.......[.......
+  803470:	5b 0d 80 00 00 00 00 00 5b 0d 80 00 00 00 00 00     [.......[.......
+  803480:	5b 0d 80 00 00 00 00 00 5b 0d 80 00 00 00 00 00     [.......[.......
+  803490:	5b 0d 80 00 00 00 00 00 5b 0d 80 00 00 00 00 00     [.......[.......
+  8034a0:	5b 0d 80 00 00 00 00 00 5b 0d 80 00 00 00 00 00     [.......[.......
+  8034b0:	5b 0d 80 00 00 00 00 00 5b 0d 80 00 00 00 00 00     [.......[.......
+  8034c0:	5b 0d 80 00 00 00 00 00 5b 0d 80 00 00 00 00 00     [.......[.......
+  8034d0:	5b 0d 80 00 00 00 00 00 5b 0d 80 00 00 00 00 00     [.......[.......
+  8034e0:	5b 0d 80 00 00 00 00 00 7e 0c 80 00 00 00 00 00     [.......~.......
+  8034f0:	5b 0d 80 00 00 00 00 00 5b 0d 80 00 00 00 00 00     [.......[.......
+  803500:	5b 0d 80 00 00 00 00 00 5b 0d 80 00 00 00 00 00     [.......[.......
+  803510:	5b 0d 80 00 00 00 00 00 5b 0d 80 00 00 00 00 00     [.......[.......
+  803520:	5b 0d 80 00 00 00 00 00 5b 0d 80 00 00 00 00 00     [.......[.......
+  803530:	5b 0d 80 00 00 00 00 00 5b 0d 80 00 00 00 00 00     [.......[.......
+  803540:	ca 07 80 00 00 00 00 00 99 09 80 00 00 00 00 00     ................
+  803550:	5b 0d 80 00 00 00 00 00 5b 0d 80 00 00 00 00 00     [.......[.......
+  803560:	5b 0d 80 00 00 00 00 00 5b 0d 80 00 00 00 00 00     [.......[.......
+  803570:	f9 07 80 00 00 00 00 00 5b 0d 80 00 00 00 00 00     ........[.......
+  803580:	5b 0d 80 00 00 00 00 00 bf 07 80 00 00 00 00 00     [...............
+  803590:	5b 0d 80 00 00 00 00 00 5b 0d 80 00 00 00 00 00     [.......[.......
+  8035a0:	41 0b 80 00 00 00 00 00 0b 0c 80 00 00 00 00 00     A...............
+  8035b0:	5b 0d 80 00 00 00 00 00 5b 0d 80 00 00 00 00 00     [.......[.......
+  8035c0:	90 08 80 00 00 00 00 00 5b 0d 80 00 00 00 00 00     ........[.......
+  8035d0:	6d 0a 80 00 00 00 00 00 5b 0d 80 00 00 00 00 00     m.......[.......
+  8035e0:	5b 0d 80 00 00 00 00 00 7e 0c 80 00 00 00 00 00     [.......~.......
+  8035f0:	5b 0d 80 00 00 00 00 00 23 07 80 00 00 00 00 00     [.......#.......
+
+0000000000803600 <error_string>:
+	...
+  803608:	b5 31 80 00 00 00 00 00 c7 31 80 00 00 00 00 00     .1.......1......
+  803618:	d7 31 80 00 00 00 00 00 e9 31 80 00 00 00 00 00     .1.......1......
+  803628:	f7 31 80 00 00 00 00 00 0b 32 80 00 00 00 00 00     .1.......2......
+  803638:	20 32 80 00 00 00 00 00 33 32 80 00 00 00 00 00      2......32......
+  803648:	45 32 80 00 00 00 00 00 59 32 80 00 00 00 00 00     E2......Y2......
+  803658:	69 32 80 00 00 00 00 00 7c 32 80 00 00 00 00 00     i2......|2......
+  803668:	93 32 80 00 00 00 00 00 a9 32 80 00 00 00 00 00     .2.......2......
+  803678:	c1 32 80 00 00 00 00 00 d9 32 80 00 00 00 00 00     .2.......2......
+  803688:	e6 32 80 00 00 00 00 00 b0 36 80 00 00 00 00 00     .2.......6......
+  803698:	fa 32 80 00 00 00 00 00 12 33 80 00 00 00 00 00     .2.......3......
+  8036a8:	28 33 80 00 00 00 00 00 66 69 6c 65 20 69 73 20     (3......file is 
+  8036b8:	6e 6f 74 20 61 20 76 61 6c 69 64 20 65 78 65 63     not a valid exec
+  8036c8:	75 74 61 62 6c 65 00 90 73 79 73 63 61 6c 6c 20     utable..syscall 
+  8036d8:	25 7a 64 20 72 65 74 75 72 6e 65 64 20 25 7a 64     %zd returned %zd
+  8036e8:	20 28 3e 20 30 29 00 6c 69 62 2f 73 79 73 63 61      (> 0).lib/sysca
+  8036f8:	6c 6c 2e 63 00 46 6f 72 6b 20 64 6f 75 62 6c 65     ll.c.Fork double
+  803708:	20 66 61 75 6c 74 00 6c 69 62 2f 66 6f 72 6b 2e      fault.lib/fork.
+  803718:	63 00 73 66 6f 72 6b 28 29 20 69 73 20 6e 6f 74     c.sfork() is not
+  803728:	20 69 6d 70 6c 65 6d 65 6e 74 65 64 00 0f 1f 00      implemented....
+  803738:	5b 25 30 38 78 5d 20 75 6e 6b 6e 6f 77 6e 20 64     [%08x] unknown d
+  803748:	65 76 69 63 65 20 74 79 70 65 20 25 64 0a 00 00     evice type %d...
+  803758:	5b 25 30 38 78 5d 20 66 74 72 75 6e 63 61 74 65     [%08x] ftruncate
+  803768:	20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65 0a      %d -- bad mode.
+  803778:	00 5b 25 30 38 78 5d 20 72 65 61 64 20 25 64 20     .[%08x] read %d 
+  803788:	2d 2d 20 62 61 64 20 6d 6f 64 65 0a 00 5b 25 30     -- bad mode..[%0
+  803798:	38 78 5d 20 77 72 69 74 65 20 25 64 20 2d 2d 20     8x] write %d -- 
+  8037a8:	62 61 64 20 6d 6f 64 65 0a 00 66 2e 0f 1f 84 00     bad mode..f.....
+  8037b8:	00 00 00 00 0f 1f 40 00                             ......@.
+
+00000000008037c0 <devtab>:
+  8037c0:	20 40 80 00 00 00 00 00 60 40 80 00 00 00 00 00      @......`@......
+  8037d0:	a0 40 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .@..............
+  8037e0:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  8037f0:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  803800:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  803810:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  803820:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  803830:	3d 20 32 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73 00     = 2.<cons>.cons.
+  803840:	73 79 73 5f 69 70 63 5f 74 72 79 5f 73 65 6e 64     sys_ipc_try_send
+  803850:	20 66 61 69 6c 65 64 3a 20 25 69 00 6c 69 62 2f      failed: %i.lib/
+  803860:	69 70 63 2e 63 00 66 2e 0f 1f 84 00 00 00 00 00     ipc.c.f.........
+  803870:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803880:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803890:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8038a0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8038b0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8038c0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8038d0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8038e0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8038f0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803900:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803910:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803920:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803930:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803940:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803950:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803960:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803970:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803980:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803990:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8039a0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8039b0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8039c0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8039d0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8039e0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8039f0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803a00:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803a10:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803a20:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803a30:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803a40:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803a50:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803a60:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803a70:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803a80:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803a90:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803aa0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803ab0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803ac0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803ad0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803ae0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803af0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803b00:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803b10:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803b20:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803b30:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803b40:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803b50:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803b60:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803b70:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803b80:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803b90:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803ba0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803bb0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803bc0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803bd0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803be0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803bf0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803c00:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803c10:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803c20:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803c30:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803c40:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803c50:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803c60:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803c70:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803c80:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803c90:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803ca0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803cb0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803cc0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803cd0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803ce0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803cf0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803d00:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803d10:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803d20:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803d30:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803d40:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803d50:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803d60:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803d70:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803d80:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803d90:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803da0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803db0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803dc0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803dd0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803de0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803df0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803e00:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803e10:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803e20:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803e30:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803e40:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803e50:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803e60:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803e70:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803e80:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803e90:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803ea0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803eb0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803ec0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803ed0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803ee0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803ef0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803f00:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803f10:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803f20:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803f30:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803f40:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803f50:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803f60:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803f70:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803f80:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803f90:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803fa0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  803fb0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  803fc0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  803fd0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  803fe0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  803ff0:	66 2e 0f 1f 84 00 00 00 00 00 66 0f 1f 44 00 00     f.........f..D..
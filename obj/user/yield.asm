@@ -0,0 +1,5784 @@
+
+obj/user/yield:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 c6 00 00 00       	call   8000e9 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+/* yield the processor to other environments */
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 57                	push   %r15
+  80002b:	41 56                	push   %r14
+  80002d:	41 55                	push   %r13
+  80002f:	41 54                	push   %r12
+  800031:	53                   	push   %rbx
+  800032:	48 83 ec 08          	sub    $0x8,%rsp
+    cprintf("Hello, I am environment %08x.\n", thisenv->env_id);
+  800036:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  80003d:	00 00 00 
+  800040:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+  800046:	48 bf 38 2d 80 00 00 	movabs $0x802d38,%rdi
+  80004d:	00 00 00 
+  800050:	b8 00 00 00 00       	mov    $0x0,%eax
+  800055:	48 ba 62 02 80 00 00 	movabs $0x800262,%rdx
+  80005c:	00 00 00 
+  80005f:	ff d2                	call   *%rdx
+    for (int i = 0; i < 5; i++) {
+  800061:	bb 00 00 00 00       	mov    $0x0,%ebx
+        sys_yield();
+  800066:	49 bf a8 10 80 00 00 	movabs $0x8010a8,%r15
+  80006d:	00 00 00 
+        cprintf("Back in environment %08x, iteration %d.\n",
+                thisenv->env_id, i);
+  800070:	49 be 00 50 80 00 00 	movabs $0x805000,%r14
+  800077:	00 00 00 
+        cprintf("Back in environment %08x, iteration %d.\n",
+  80007a:	49 bd 58 2d 80 00 00 	movabs $0x802d58,%r13
+  800081:	00 00 00 
+  800084:	49 bc 62 02 80 00 00 	movabs $0x800262,%r12
+  80008b:	00 00 00 
+        sys_yield();
+  80008e:	41 ff d7             	call   *%r15
+                thisenv->env_id, i);
+  800091:	49 8b 06             	mov    (%r14),%rax
+  800094:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+        cprintf("Back in environment %08x, iteration %d.\n",
+  80009a:	89 da                	mov    %ebx,%edx
+  80009c:	4c 89 ef             	mov    %r13,%rdi
+  80009f:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000a4:	41 ff d4             	call   *%r12
+    for (int i = 0; i < 5; i++) {
+  8000a7:	83 c3 01             	add    $0x1,%ebx
+  8000aa:	83 fb 05             	cmp    $0x5,%ebx
+  8000ad:	75 df                	jne    80008e <umain+0x69>
+    }
+    cprintf("All done in environment %08x.\n", thisenv->env_id);
+  8000af:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  8000b6:	00 00 00 
+  8000b9:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+  8000bf:	48 bf 88 2d 80 00 00 	movabs $0x802d88,%rdi
+  8000c6:	00 00 00 
+  8000c9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000ce:	48 ba 62 02 80 00 00 	movabs $0x800262,%rdx
+  8000d5:	00 00 00 
+  8000d8:	ff d2                	call   *%rdx
+}
+  8000da:	48 83 c4 08          	add    $0x8,%rsp
+  8000de:	5b                   	pop    %rbx
+  8000df:	41 5c                	pop    %r12
+  8000e1:	41 5d                	pop    %r13
+  8000e3:	41 5e                	pop    %r14
+  8000e5:	41 5f                	pop    %r15
+  8000e7:	5d                   	pop    %rbp
+  8000e8:	c3                   	ret
+
+00000000008000e9 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  8000e9:	55                   	push   %rbp
+  8000ea:	48 89 e5             	mov    %rsp,%rbp
+  8000ed:	41 56                	push   %r14
+  8000ef:	41 55                	push   %r13
+  8000f1:	41 54                	push   %r12
+  8000f3:	53                   	push   %rbx
+  8000f4:	41 89 fd             	mov    %edi,%r13d
+  8000f7:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  8000fa:	48 ba d8 40 80 00 00 	movabs $0x8040d8,%rdx
+  800101:	00 00 00 
+  800104:	48 b8 d8 40 80 00 00 	movabs $0x8040d8,%rax
+  80010b:	00 00 00 
+  80010e:	48 39 c2             	cmp    %rax,%rdx
+  800111:	73 17                	jae    80012a <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  800113:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  800116:	49 89 c4             	mov    %rax,%r12
+  800119:	48 83 c3 08          	add    $0x8,%rbx
+  80011d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800122:	ff 53 f8             	call   *-0x8(%rbx)
+  800125:	4c 39 e3             	cmp    %r12,%rbx
+  800128:	72 ef                	jb     800119 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+    envid_t this_env_id = sys_getenvid();
+  80012a:	48 b8 77 10 80 00 00 	movabs $0x801077,%rax
+  800131:	00 00 00 
+  800134:	ff d0                	call   *%rax
+    thisenv = &((struct Env*)UENVS)[ENVX(this_env_id)];
+  800136:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80013b:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+  800142:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  800149:	00 00 00 
+  80014c:	48 01 d0             	add    %rdx,%rax
+  80014f:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  800156:	00 00 00 
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  800159:	45 85 ed             	test   %r13d,%r13d
+  80015c:	7e 0d                	jle    80016b <libmain+0x82>
+  80015e:	49 8b 06             	mov    (%r14),%rax
+  800161:	48 a3 00 40 80 00 00 	movabs %rax,0x804000
+  800168:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  80016b:	4c 89 f6             	mov    %r14,%rsi
+  80016e:	44 89 ef             	mov    %r13d,%edi
+  800171:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  800178:	00 00 00 
+  80017b:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  80017d:	48 b8 92 01 80 00 00 	movabs $0x800192,%rax
+  800184:	00 00 00 
+  800187:	ff d0                	call   *%rax
+#endif
+}
+  800189:	5b                   	pop    %rbx
+  80018a:	41 5c                	pop    %r12
+  80018c:	41 5d                	pop    %r13
+  80018e:	41 5e                	pop    %r14
+  800190:	5d                   	pop    %rbp
+  800191:	c3                   	ret
+
+0000000000800192 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  800192:	55                   	push   %rbp
+  800193:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  800196:	48 b8 cb 17 80 00 00 	movabs $0x8017cb,%rax
+  80019d:	00 00 00 
+  8001a0:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  8001a2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8001a7:	48 b8 0c 10 80 00 00 	movabs $0x80100c,%rax
+  8001ae:	00 00 00 
+  8001b1:	ff d0                	call   *%rax
+}
+  8001b3:	5d                   	pop    %rbp
+  8001b4:	c3                   	ret
+
+00000000008001b5 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  8001b5:	55                   	push   %rbp
+  8001b6:	48 89 e5             	mov    %rsp,%rbp
+  8001b9:	53                   	push   %rbx
+  8001ba:	48 83 ec 08          	sub    $0x8,%rsp
+  8001be:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  8001c1:	8b 06                	mov    (%rsi),%eax
+  8001c3:	8d 50 01             	lea    0x1(%rax),%edx
+  8001c6:	89 16                	mov    %edx,(%rsi)
+  8001c8:	48 98                	cltq
+  8001ca:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  8001cf:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  8001d5:	74 0a                	je     8001e1 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  8001d7:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  8001db:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8001df:	c9                   	leave
+  8001e0:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  8001e1:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  8001e5:	be ff 00 00 00       	mov    $0xff,%esi
+  8001ea:	48 b8 ae 0f 80 00 00 	movabs $0x800fae,%rax
+  8001f1:	00 00 00 
+  8001f4:	ff d0                	call   *%rax
+        state->offset = 0;
+  8001f6:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  8001fc:	eb d9                	jmp    8001d7 <putch+0x22>
+
+00000000008001fe <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  8001fe:	55                   	push   %rbp
+  8001ff:	48 89 e5             	mov    %rsp,%rbp
+  800202:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  800209:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  80020c:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  800213:	b9 21 00 00 00       	mov    $0x21,%ecx
+  800218:	b8 00 00 00 00       	mov    $0x0,%eax
+  80021d:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  800220:	48 89 f1             	mov    %rsi,%rcx
+  800223:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  80022a:	48 bf b5 01 80 00 00 	movabs $0x8001b5,%rdi
+  800231:	00 00 00 
+  800234:	48 b8 b2 03 80 00 00 	movabs $0x8003b2,%rax
+  80023b:	00 00 00 
+  80023e:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  800240:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  800247:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  80024e:	48 b8 ae 0f 80 00 00 	movabs $0x800fae,%rax
+  800255:	00 00 00 
+  800258:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  80025a:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  800260:	c9                   	leave
+  800261:	c3                   	ret
+
+0000000000800262 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  800262:	55                   	push   %rbp
+  800263:	48 89 e5             	mov    %rsp,%rbp
+  800266:	48 83 ec 50          	sub    $0x50,%rsp
+  80026a:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  80026e:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  800272:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800276:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80027a:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  80027e:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  800285:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800289:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80028d:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800291:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  800295:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  800299:	48 b8 fe 01 80 00 00 	movabs $0x8001fe,%rax
+  8002a0:	00 00 00 
+  8002a3:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  8002a5:	c9                   	leave
+  8002a6:	c3                   	ret
+
+00000000008002a7 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  8002a7:	55                   	push   %rbp
+  8002a8:	48 89 e5             	mov    %rsp,%rbp
+  8002ab:	41 57                	push   %r15
+  8002ad:	41 56                	push   %r14
+  8002af:	41 55                	push   %r13
+  8002b1:	41 54                	push   %r12
+  8002b3:	53                   	push   %rbx
+  8002b4:	48 83 ec 18          	sub    $0x18,%rsp
+  8002b8:	49 89 fc             	mov    %rdi,%r12
+  8002bb:	49 89 f5             	mov    %rsi,%r13
+  8002be:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8002c2:	8b 45 10             	mov    0x10(%rbp),%eax
+  8002c5:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  8002c8:	41 89 cf             	mov    %ecx,%r15d
+  8002cb:	4c 39 fa             	cmp    %r15,%rdx
+  8002ce:	73 5b                	jae    80032b <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  8002d0:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  8002d4:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  8002d8:	85 db                	test   %ebx,%ebx
+  8002da:	7e 0e                	jle    8002ea <print_num+0x43>
+            putch(padc, put_arg);
+  8002dc:	4c 89 ee             	mov    %r13,%rsi
+  8002df:	44 89 f7             	mov    %r14d,%edi
+  8002e2:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  8002e5:	83 eb 01             	sub    $0x1,%ebx
+  8002e8:	75 f2                	jne    8002dc <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  8002ea:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  8002ee:	48 b9 c2 2d 80 00 00 	movabs $0x802dc2,%rcx
+  8002f5:	00 00 00 
+  8002f8:	48 b8 b1 2d 80 00 00 	movabs $0x802db1,%rax
+  8002ff:	00 00 00 
+  800302:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  800306:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80030a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80030f:	49 f7 f7             	div    %r15
+  800312:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  800316:	4c 89 ee             	mov    %r13,%rsi
+  800319:	41 ff d4             	call   *%r12
+}
+  80031c:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800320:	5b                   	pop    %rbx
+  800321:	41 5c                	pop    %r12
+  800323:	41 5d                	pop    %r13
+  800325:	41 5e                	pop    %r14
+  800327:	41 5f                	pop    %r15
+  800329:	5d                   	pop    %rbp
+  80032a:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  80032b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80032f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800334:	49 f7 f7             	div    %r15
+  800337:	48 83 ec 08          	sub    $0x8,%rsp
+  80033b:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  80033f:	52                   	push   %rdx
+  800340:	45 0f be c9          	movsbl %r9b,%r9d
+  800344:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  800348:	48 89 c2             	mov    %rax,%rdx
+  80034b:	48 b8 a7 02 80 00 00 	movabs $0x8002a7,%rax
+  800352:	00 00 00 
+  800355:	ff d0                	call   *%rax
+  800357:	48 83 c4 10          	add    $0x10,%rsp
+  80035b:	eb 8d                	jmp    8002ea <print_num+0x43>
+
+000000000080035d <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  80035d:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  800361:	48 8b 06             	mov    (%rsi),%rax
+  800364:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  800368:	73 0a                	jae    800374 <sprintputch+0x17>
+        *state->start++ = ch;
+  80036a:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80036e:	48 89 16             	mov    %rdx,(%rsi)
+  800371:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  800374:	c3                   	ret
+
+0000000000800375 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  800375:	55                   	push   %rbp
+  800376:	48 89 e5             	mov    %rsp,%rbp
+  800379:	48 83 ec 50          	sub    $0x50,%rsp
+  80037d:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800381:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800385:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  800389:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800390:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800394:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800398:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80039c:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  8003a0:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8003a4:	48 b8 b2 03 80 00 00 	movabs $0x8003b2,%rax
+  8003ab:	00 00 00 
+  8003ae:	ff d0                	call   *%rax
+}
+  8003b0:	c9                   	leave
+  8003b1:	c3                   	ret
+
+00000000008003b2 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  8003b2:	55                   	push   %rbp
+  8003b3:	48 89 e5             	mov    %rsp,%rbp
+  8003b6:	41 57                	push   %r15
+  8003b8:	41 56                	push   %r14
+  8003ba:	41 55                	push   %r13
+  8003bc:	41 54                	push   %r12
+  8003be:	53                   	push   %rbx
+  8003bf:	48 83 ec 38          	sub    $0x38,%rsp
+  8003c3:	49 89 fe             	mov    %rdi,%r14
+  8003c6:	49 89 f5             	mov    %rsi,%r13
+  8003c9:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  8003cc:	48 8b 01             	mov    (%rcx),%rax
+  8003cf:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8003d3:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  8003d7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8003db:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  8003df:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  8003e3:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  8003e7:	0f b6 3b             	movzbl (%rbx),%edi
+  8003ea:	40 80 ff 25          	cmp    $0x25,%dil
+  8003ee:	74 18                	je     800408 <vprintfmt+0x56>
+            if (!ch) return;
+  8003f0:	40 84 ff             	test   %dil,%dil
+  8003f3:	0f 84 b1 06 00 00    	je     800aaa <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  8003f9:	40 0f b6 ff          	movzbl %dil,%edi
+  8003fd:	4c 89 ee             	mov    %r13,%rsi
+  800400:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  800403:	4c 89 e3             	mov    %r12,%rbx
+  800406:	eb db                	jmp    8003e3 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  800408:	be 00 00 00 00       	mov    $0x0,%esi
+  80040d:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  800411:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  800416:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  80041c:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  800423:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800427:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  80042c:	41 0f b6 04 24       	movzbl (%r12),%eax
+  800431:	88 45 a0             	mov    %al,-0x60(%rbp)
+  800434:	83 e8 23             	sub    $0x23,%eax
+  800437:	3c 57                	cmp    $0x57,%al
+  800439:	0f 87 51 06 00 00    	ja     800a90 <vprintfmt+0x6de>
+  80043f:	0f b6 c0             	movzbl %al,%eax
+  800442:	48 b9 80 2f 80 00 00 	movabs $0x802f80,%rcx
+  800449:	00 00 00 
+  80044c:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  80044f:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  800452:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  800456:	eb cf                	jmp    800427 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  800458:	49 89 dc             	mov    %rbx,%r12
+  80045b:	be 01 00 00 00       	mov    $0x1,%esi
+  800460:	eb c5                	jmp    800427 <vprintfmt+0x75>
+            padc = ch;
+  800462:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  800466:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800469:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80046c:	eb b9                	jmp    800427 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  80046e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800471:	83 f8 2f             	cmp    $0x2f,%eax
+  800474:	77 24                	ja     80049a <vprintfmt+0xe8>
+  800476:	89 c1                	mov    %eax,%ecx
+  800478:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  80047c:	83 c0 08             	add    $0x8,%eax
+  80047f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800482:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  800485:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  800488:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  80048c:	79 99                	jns    800427 <vprintfmt+0x75>
+                width = precision;
+  80048e:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  800492:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800498:	eb 8d                	jmp    800427 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  80049a:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80049e:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  8004a2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8004a6:	eb da                	jmp    800482 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  8004a8:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  8004ad:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8004b1:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  8004b7:	3c 39                	cmp    $0x39,%al
+  8004b9:	77 1c                	ja     8004d7 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  8004bb:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  8004bf:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  8004c3:	0f b6 c0             	movzbl %al,%eax
+  8004c6:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8004cb:	0f b6 03             	movzbl (%rbx),%eax
+  8004ce:	3c 39                	cmp    $0x39,%al
+  8004d0:	76 e9                	jbe    8004bb <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  8004d2:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  8004d5:	eb b1                	jmp    800488 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  8004d7:	49 89 dc             	mov    %rbx,%r12
+  8004da:	eb ac                	jmp    800488 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  8004dc:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  8004df:	85 c9                	test   %ecx,%ecx
+  8004e1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004e6:	0f 49 c1             	cmovns %ecx,%eax
+  8004e9:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  8004ec:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8004ef:	e9 33 ff ff ff       	jmp    800427 <vprintfmt+0x75>
+            lflag++;
+  8004f4:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  8004f7:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8004fa:	e9 28 ff ff ff       	jmp    800427 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  8004ff:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800502:	83 f8 2f             	cmp    $0x2f,%eax
+  800505:	77 19                	ja     800520 <vprintfmt+0x16e>
+  800507:	89 c2                	mov    %eax,%edx
+  800509:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80050d:	83 c0 08             	add    $0x8,%eax
+  800510:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800513:	8b 3a                	mov    (%rdx),%edi
+  800515:	4c 89 ee             	mov    %r13,%rsi
+  800518:	41 ff d6             	call   *%r14
+            break;
+  80051b:	e9 c3 fe ff ff       	jmp    8003e3 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  800520:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800524:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800528:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80052c:	eb e5                	jmp    800513 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  80052e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800531:	83 f8 2f             	cmp    $0x2f,%eax
+  800534:	77 5a                	ja     800590 <vprintfmt+0x1de>
+  800536:	89 c2                	mov    %eax,%edx
+  800538:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80053c:	83 c0 08             	add    $0x8,%eax
+  80053f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  800542:	8b 02                	mov    (%rdx),%eax
+  800544:	89 c1                	mov    %eax,%ecx
+  800546:	f7 d9                	neg    %ecx
+  800548:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  80054b:	83 f9 15             	cmp    $0x15,%ecx
+  80054e:	7f 4e                	jg     80059e <vprintfmt+0x1ec>
+  800550:	48 63 c1             	movslq %ecx,%rax
+  800553:	48 ba 40 32 80 00 00 	movabs $0x803240,%rdx
+  80055a:	00 00 00 
+  80055d:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  800561:	48 85 c0             	test   %rax,%rax
+  800564:	74 38                	je     80059e <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  800566:	48 89 c1             	mov    %rax,%rcx
+  800569:	48 ba f9 33 80 00 00 	movabs $0x8033f9,%rdx
+  800570:	00 00 00 
+  800573:	4c 89 ee             	mov    %r13,%rsi
+  800576:	4c 89 f7             	mov    %r14,%rdi
+  800579:	b8 00 00 00 00       	mov    $0x0,%eax
+  80057e:	49 b8 75 03 80 00 00 	movabs $0x800375,%r8
+  800585:	00 00 00 
+  800588:	41 ff d0             	call   *%r8
+  80058b:	e9 53 fe ff ff       	jmp    8003e3 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  800590:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800594:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800598:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80059c:	eb a4                	jmp    800542 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  80059e:	48 ba da 2d 80 00 00 	movabs $0x802dda,%rdx
+  8005a5:	00 00 00 
+  8005a8:	4c 89 ee             	mov    %r13,%rsi
+  8005ab:	4c 89 f7             	mov    %r14,%rdi
+  8005ae:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005b3:	49 b8 75 03 80 00 00 	movabs $0x800375,%r8
+  8005ba:	00 00 00 
+  8005bd:	41 ff d0             	call   *%r8
+  8005c0:	e9 1e fe ff ff       	jmp    8003e3 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8005c5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8005c8:	83 f8 2f             	cmp    $0x2f,%eax
+  8005cb:	77 6c                	ja     800639 <vprintfmt+0x287>
+  8005cd:	89 c2                	mov    %eax,%edx
+  8005cf:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8005d3:	83 c0 08             	add    $0x8,%eax
+  8005d6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8005d9:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  8005dc:	48 85 d2             	test   %rdx,%rdx
+  8005df:	48 b8 d3 2d 80 00 00 	movabs $0x802dd3,%rax
+  8005e6:	00 00 00 
+  8005e9:	48 0f 45 c2          	cmovne %rdx,%rax
+  8005ed:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  8005f1:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8005f5:	7e 06                	jle    8005fd <vprintfmt+0x24b>
+  8005f7:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  8005fb:	75 4a                	jne    800647 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8005fd:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800601:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  800605:	0f b6 00             	movzbl (%rax),%eax
+  800608:	84 c0                	test   %al,%al
+  80060a:	0f 85 9a 00 00 00    	jne    8006aa <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  800610:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800613:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  800617:	85 c0                	test   %eax,%eax
+  800619:	0f 8e c4 fd ff ff    	jle    8003e3 <vprintfmt+0x31>
+  80061f:	4c 89 ee             	mov    %r13,%rsi
+  800622:	bf 20 00 00 00       	mov    $0x20,%edi
+  800627:	41 ff d6             	call   *%r14
+  80062a:	41 83 ec 01          	sub    $0x1,%r12d
+  80062e:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  800632:	75 eb                	jne    80061f <vprintfmt+0x26d>
+  800634:	e9 aa fd ff ff       	jmp    8003e3 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800639:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80063d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800641:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800645:	eb 92                	jmp    8005d9 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  800647:	49 63 f7             	movslq %r15d,%rsi
+  80064a:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  80064e:	48 b8 64 0b 80 00 00 	movabs $0x800b64,%rax
+  800655:	00 00 00 
+  800658:	ff d0                	call   *%rax
+  80065a:	48 89 c2             	mov    %rax,%rdx
+  80065d:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800660:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  800662:	8d 70 ff             	lea    -0x1(%rax),%esi
+  800665:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  800668:	85 c0                	test   %eax,%eax
+  80066a:	7e 91                	jle    8005fd <vprintfmt+0x24b>
+  80066c:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  800671:	4c 89 ee             	mov    %r13,%rsi
+  800674:	44 89 e7             	mov    %r12d,%edi
+  800677:	41 ff d6             	call   *%r14
+  80067a:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  80067e:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800681:	83 f8 ff             	cmp    $0xffffffff,%eax
+  800684:	75 eb                	jne    800671 <vprintfmt+0x2bf>
+  800686:	e9 72 ff ff ff       	jmp    8005fd <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  80068b:	0f b6 f8             	movzbl %al,%edi
+  80068e:	4c 89 ee             	mov    %r13,%rsi
+  800691:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800694:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800698:	49 83 c4 01          	add    $0x1,%r12
+  80069c:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  8006a2:	84 c0                	test   %al,%al
+  8006a4:	0f 84 66 ff ff ff    	je     800610 <vprintfmt+0x25e>
+  8006aa:	45 85 ff             	test   %r15d,%r15d
+  8006ad:	78 0a                	js     8006b9 <vprintfmt+0x307>
+  8006af:	41 83 ef 01          	sub    $0x1,%r15d
+  8006b3:	0f 88 57 ff ff ff    	js     800610 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8006b9:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  8006bd:	74 cc                	je     80068b <vprintfmt+0x2d9>
+  8006bf:	8d 50 e0             	lea    -0x20(%rax),%edx
+  8006c2:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  8006c7:	80 fa 5e             	cmp    $0x5e,%dl
+  8006ca:	77 c2                	ja     80068e <vprintfmt+0x2dc>
+  8006cc:	eb bd                	jmp    80068b <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  8006ce:	40 84 f6             	test   %sil,%sil
+  8006d1:	75 26                	jne    8006f9 <vprintfmt+0x347>
+    switch (lflag) {
+  8006d3:	85 d2                	test   %edx,%edx
+  8006d5:	74 59                	je     800730 <vprintfmt+0x37e>
+  8006d7:	83 fa 01             	cmp    $0x1,%edx
+  8006da:	74 7b                	je     800757 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  8006dc:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006df:	83 f8 2f             	cmp    $0x2f,%eax
+  8006e2:	0f 87 96 00 00 00    	ja     80077e <vprintfmt+0x3cc>
+  8006e8:	89 c2                	mov    %eax,%edx
+  8006ea:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8006ee:	83 c0 08             	add    $0x8,%eax
+  8006f1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8006f4:	4c 8b 22             	mov    (%rdx),%r12
+  8006f7:	eb 17                	jmp    800710 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  8006f9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006fc:	83 f8 2f             	cmp    $0x2f,%eax
+  8006ff:	77 21                	ja     800722 <vprintfmt+0x370>
+  800701:	89 c2                	mov    %eax,%edx
+  800703:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800707:	83 c0 08             	add    $0x8,%eax
+  80070a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80070d:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  800710:	4d 85 e4             	test   %r12,%r12
+  800713:	78 7a                	js     80078f <vprintfmt+0x3dd>
+            num = i;
+  800715:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  800718:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  80071d:	e9 50 02 00 00       	jmp    800972 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800722:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800726:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80072a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80072e:	eb dd                	jmp    80070d <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  800730:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800733:	83 f8 2f             	cmp    $0x2f,%eax
+  800736:	77 11                	ja     800749 <vprintfmt+0x397>
+  800738:	89 c2                	mov    %eax,%edx
+  80073a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80073e:	83 c0 08             	add    $0x8,%eax
+  800741:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800744:	4c 63 22             	movslq (%rdx),%r12
+  800747:	eb c7                	jmp    800710 <vprintfmt+0x35e>
+  800749:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80074d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800751:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800755:	eb ed                	jmp    800744 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  800757:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80075a:	83 f8 2f             	cmp    $0x2f,%eax
+  80075d:	77 11                	ja     800770 <vprintfmt+0x3be>
+  80075f:	89 c2                	mov    %eax,%edx
+  800761:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800765:	83 c0 08             	add    $0x8,%eax
+  800768:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80076b:	4c 8b 22             	mov    (%rdx),%r12
+  80076e:	eb a0                	jmp    800710 <vprintfmt+0x35e>
+  800770:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800774:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800778:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80077c:	eb ed                	jmp    80076b <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  80077e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800782:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800786:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80078a:	e9 65 ff ff ff       	jmp    8006f4 <vprintfmt+0x342>
+                putch('-', put_arg);
+  80078f:	4c 89 ee             	mov    %r13,%rsi
+  800792:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800797:	41 ff d6             	call   *%r14
+                i = -i;
+  80079a:	49 f7 dc             	neg    %r12
+  80079d:	e9 73 ff ff ff       	jmp    800715 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  8007a2:	40 84 f6             	test   %sil,%sil
+  8007a5:	75 32                	jne    8007d9 <vprintfmt+0x427>
+    switch (lflag) {
+  8007a7:	85 d2                	test   %edx,%edx
+  8007a9:	74 5d                	je     800808 <vprintfmt+0x456>
+  8007ab:	83 fa 01             	cmp    $0x1,%edx
+  8007ae:	0f 84 82 00 00 00    	je     800836 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  8007b4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007b7:	83 f8 2f             	cmp    $0x2f,%eax
+  8007ba:	0f 87 a5 00 00 00    	ja     800865 <vprintfmt+0x4b3>
+  8007c0:	89 c2                	mov    %eax,%edx
+  8007c2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007c6:	83 c0 08             	add    $0x8,%eax
+  8007c9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007cc:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8007cf:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  8007d4:	e9 99 01 00 00       	jmp    800972 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8007d9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007dc:	83 f8 2f             	cmp    $0x2f,%eax
+  8007df:	77 19                	ja     8007fa <vprintfmt+0x448>
+  8007e1:	89 c2                	mov    %eax,%edx
+  8007e3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007e7:	83 c0 08             	add    $0x8,%eax
+  8007ea:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007ed:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8007f0:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8007f5:	e9 78 01 00 00       	jmp    800972 <vprintfmt+0x5c0>
+  8007fa:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007fe:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800802:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800806:	eb e5                	jmp    8007ed <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  800808:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80080b:	83 f8 2f             	cmp    $0x2f,%eax
+  80080e:	77 18                	ja     800828 <vprintfmt+0x476>
+  800810:	89 c2                	mov    %eax,%edx
+  800812:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800816:	83 c0 08             	add    $0x8,%eax
+  800819:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80081c:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  80081e:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  800823:	e9 4a 01 00 00       	jmp    800972 <vprintfmt+0x5c0>
+  800828:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80082c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800830:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800834:	eb e6                	jmp    80081c <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  800836:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800839:	83 f8 2f             	cmp    $0x2f,%eax
+  80083c:	77 19                	ja     800857 <vprintfmt+0x4a5>
+  80083e:	89 c2                	mov    %eax,%edx
+  800840:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800844:	83 c0 08             	add    $0x8,%eax
+  800847:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80084a:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  80084d:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  800852:	e9 1b 01 00 00       	jmp    800972 <vprintfmt+0x5c0>
+  800857:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80085b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80085f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800863:	eb e5                	jmp    80084a <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  800865:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800869:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80086d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800871:	e9 56 ff ff ff       	jmp    8007cc <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  800876:	40 84 f6             	test   %sil,%sil
+  800879:	75 2e                	jne    8008a9 <vprintfmt+0x4f7>
+    switch (lflag) {
+  80087b:	85 d2                	test   %edx,%edx
+  80087d:	74 59                	je     8008d8 <vprintfmt+0x526>
+  80087f:	83 fa 01             	cmp    $0x1,%edx
+  800882:	74 7f                	je     800903 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  800884:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800887:	83 f8 2f             	cmp    $0x2f,%eax
+  80088a:	0f 87 9f 00 00 00    	ja     80092f <vprintfmt+0x57d>
+  800890:	89 c2                	mov    %eax,%edx
+  800892:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800896:	83 c0 08             	add    $0x8,%eax
+  800899:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80089c:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  80089f:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  8008a4:	e9 c9 00 00 00       	jmp    800972 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8008a9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008ac:	83 f8 2f             	cmp    $0x2f,%eax
+  8008af:	77 19                	ja     8008ca <vprintfmt+0x518>
+  8008b1:	89 c2                	mov    %eax,%edx
+  8008b3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008b7:	83 c0 08             	add    $0x8,%eax
+  8008ba:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008bd:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8008c0:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8008c5:	e9 a8 00 00 00       	jmp    800972 <vprintfmt+0x5c0>
+  8008ca:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008ce:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008d2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008d6:	eb e5                	jmp    8008bd <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  8008d8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008db:	83 f8 2f             	cmp    $0x2f,%eax
+  8008de:	77 15                	ja     8008f5 <vprintfmt+0x543>
+  8008e0:	89 c2                	mov    %eax,%edx
+  8008e2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008e6:	83 c0 08             	add    $0x8,%eax
+  8008e9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008ec:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  8008ee:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  8008f3:	eb 7d                	jmp    800972 <vprintfmt+0x5c0>
+  8008f5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008f9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008fd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800901:	eb e9                	jmp    8008ec <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  800903:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800906:	83 f8 2f             	cmp    $0x2f,%eax
+  800909:	77 16                	ja     800921 <vprintfmt+0x56f>
+  80090b:	89 c2                	mov    %eax,%edx
+  80090d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800911:	83 c0 08             	add    $0x8,%eax
+  800914:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800917:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  80091a:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  80091f:	eb 51                	jmp    800972 <vprintfmt+0x5c0>
+  800921:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800925:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800929:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80092d:	eb e8                	jmp    800917 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  80092f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800933:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800937:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80093b:	e9 5c ff ff ff       	jmp    80089c <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  800940:	4c 89 ee             	mov    %r13,%rsi
+  800943:	bf 30 00 00 00       	mov    $0x30,%edi
+  800948:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  80094b:	4c 89 ee             	mov    %r13,%rsi
+  80094e:	bf 78 00 00 00       	mov    $0x78,%edi
+  800953:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800956:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800959:	83 f8 2f             	cmp    $0x2f,%eax
+  80095c:	77 47                	ja     8009a5 <vprintfmt+0x5f3>
+  80095e:	89 c2                	mov    %eax,%edx
+  800960:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800964:	83 c0 08             	add    $0x8,%eax
+  800967:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80096a:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  80096d:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800972:	48 83 ec 08          	sub    $0x8,%rsp
+  800976:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  80097a:	0f 94 c0             	sete   %al
+  80097d:	0f b6 c0             	movzbl %al,%eax
+  800980:	50                   	push   %rax
+  800981:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800986:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  80098a:	4c 89 ee             	mov    %r13,%rsi
+  80098d:	4c 89 f7             	mov    %r14,%rdi
+  800990:	48 b8 a7 02 80 00 00 	movabs $0x8002a7,%rax
+  800997:	00 00 00 
+  80099a:	ff d0                	call   *%rax
+            break;
+  80099c:	48 83 c4 10          	add    $0x10,%rsp
+  8009a0:	e9 3e fa ff ff       	jmp    8003e3 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  8009a5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009a9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009ad:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009b1:	eb b7                	jmp    80096a <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  8009b3:	40 84 f6             	test   %sil,%sil
+  8009b6:	75 2b                	jne    8009e3 <vprintfmt+0x631>
+    switch (lflag) {
+  8009b8:	85 d2                	test   %edx,%edx
+  8009ba:	74 56                	je     800a12 <vprintfmt+0x660>
+  8009bc:	83 fa 01             	cmp    $0x1,%edx
+  8009bf:	74 7f                	je     800a40 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  8009c1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009c4:	83 f8 2f             	cmp    $0x2f,%eax
+  8009c7:	0f 87 a2 00 00 00    	ja     800a6f <vprintfmt+0x6bd>
+  8009cd:	89 c2                	mov    %eax,%edx
+  8009cf:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009d3:	83 c0 08             	add    $0x8,%eax
+  8009d6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009d9:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8009dc:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  8009e1:	eb 8f                	jmp    800972 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8009e3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009e6:	83 f8 2f             	cmp    $0x2f,%eax
+  8009e9:	77 19                	ja     800a04 <vprintfmt+0x652>
+  8009eb:	89 c2                	mov    %eax,%edx
+  8009ed:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009f1:	83 c0 08             	add    $0x8,%eax
+  8009f4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009f7:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8009fa:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8009ff:	e9 6e ff ff ff       	jmp    800972 <vprintfmt+0x5c0>
+  800a04:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a08:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a0c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a10:	eb e5                	jmp    8009f7 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800a12:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a15:	83 f8 2f             	cmp    $0x2f,%eax
+  800a18:	77 18                	ja     800a32 <vprintfmt+0x680>
+  800a1a:	89 c2                	mov    %eax,%edx
+  800a1c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a20:	83 c0 08             	add    $0x8,%eax
+  800a23:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a26:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800a28:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800a2d:	e9 40 ff ff ff       	jmp    800972 <vprintfmt+0x5c0>
+  800a32:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a36:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a3a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a3e:	eb e6                	jmp    800a26 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800a40:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a43:	83 f8 2f             	cmp    $0x2f,%eax
+  800a46:	77 19                	ja     800a61 <vprintfmt+0x6af>
+  800a48:	89 c2                	mov    %eax,%edx
+  800a4a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a4e:	83 c0 08             	add    $0x8,%eax
+  800a51:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a54:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800a57:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800a5c:	e9 11 ff ff ff       	jmp    800972 <vprintfmt+0x5c0>
+  800a61:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a65:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a69:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a6d:	eb e5                	jmp    800a54 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800a6f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a73:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a77:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a7b:	e9 59 ff ff ff       	jmp    8009d9 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800a80:	4c 89 ee             	mov    %r13,%rsi
+  800a83:	bf 25 00 00 00       	mov    $0x25,%edi
+  800a88:	41 ff d6             	call   *%r14
+            break;
+  800a8b:	e9 53 f9 ff ff       	jmp    8003e3 <vprintfmt+0x31>
+            putch('%', put_arg);
+  800a90:	4c 89 ee             	mov    %r13,%rsi
+  800a93:	bf 25 00 00 00       	mov    $0x25,%edi
+  800a98:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800a9b:	48 83 eb 01          	sub    $0x1,%rbx
+  800a9f:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800aa3:	75 f6                	jne    800a9b <vprintfmt+0x6e9>
+  800aa5:	e9 39 f9 ff ff       	jmp    8003e3 <vprintfmt+0x31>
+}
+  800aaa:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800aae:	5b                   	pop    %rbx
+  800aaf:	41 5c                	pop    %r12
+  800ab1:	41 5d                	pop    %r13
+  800ab3:	41 5e                	pop    %r14
+  800ab5:	41 5f                	pop    %r15
+  800ab7:	5d                   	pop    %rbp
+  800ab8:	c3                   	ret
+
+0000000000800ab9 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800ab9:	55                   	push   %rbp
+  800aba:	48 89 e5             	mov    %rsp,%rbp
+  800abd:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800ac1:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800ac5:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800aca:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800ace:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800ad5:	48 85 ff             	test   %rdi,%rdi
+  800ad8:	74 2b                	je     800b05 <vsnprintf+0x4c>
+  800ada:	48 85 f6             	test   %rsi,%rsi
+  800add:	74 26                	je     800b05 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800adf:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800ae3:	48 bf 5d 03 80 00 00 	movabs $0x80035d,%rdi
+  800aea:	00 00 00 
+  800aed:	48 b8 b2 03 80 00 00 	movabs $0x8003b2,%rax
+  800af4:	00 00 00 
+  800af7:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800af9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800afd:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800b00:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800b03:	c9                   	leave
+  800b04:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800b05:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800b0a:	eb f7                	jmp    800b03 <vsnprintf+0x4a>
+
+0000000000800b0c <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800b0c:	55                   	push   %rbp
+  800b0d:	48 89 e5             	mov    %rsp,%rbp
+  800b10:	48 83 ec 50          	sub    $0x50,%rsp
+  800b14:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800b18:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800b1c:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800b20:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800b27:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800b2b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b2f:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800b33:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800b37:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800b3b:	48 b8 b9 0a 80 00 00 	movabs $0x800ab9,%rax
+  800b42:	00 00 00 
+  800b45:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800b47:	c9                   	leave
+  800b48:	c3                   	ret
+
+0000000000800b49 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800b49:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800b4c:	74 10                	je     800b5e <strlen+0x15>
+    size_t n = 0;
+  800b4e:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800b53:	48 83 c0 01          	add    $0x1,%rax
+  800b57:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800b5b:	75 f6                	jne    800b53 <strlen+0xa>
+  800b5d:	c3                   	ret
+    size_t n = 0;
+  800b5e:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800b63:	c3                   	ret
+
+0000000000800b64 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800b64:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800b67:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800b6c:	48 85 f6             	test   %rsi,%rsi
+  800b6f:	74 11                	je     800b82 <strnlen+0x1e>
+  800b71:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800b75:	74 0c                	je     800b83 <strnlen+0x1f>
+  800b77:	48 83 c2 01          	add    $0x1,%rdx
+  800b7b:	48 39 d0             	cmp    %rdx,%rax
+  800b7e:	75 f1                	jne    800b71 <strnlen+0xd>
+  800b80:	eb 04                	jmp    800b86 <strnlen+0x22>
+  800b82:	c3                   	ret
+  800b83:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800b86:	c3                   	ret
+
+0000000000800b87 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800b87:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800b8a:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b8f:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800b93:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800b96:	48 83 c2 01          	add    $0x1,%rdx
+  800b9a:	84 c9                	test   %cl,%cl
+  800b9c:	75 f1                	jne    800b8f <strcpy+0x8>
+        ;
+    return res;
+}
+  800b9e:	c3                   	ret
+
+0000000000800b9f <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800b9f:	55                   	push   %rbp
+  800ba0:	48 89 e5             	mov    %rsp,%rbp
+  800ba3:	41 54                	push   %r12
+  800ba5:	53                   	push   %rbx
+  800ba6:	48 89 fb             	mov    %rdi,%rbx
+  800ba9:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800bac:	48 b8 49 0b 80 00 00 	movabs $0x800b49,%rax
+  800bb3:	00 00 00 
+  800bb6:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800bb8:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800bbc:	4c 89 e6             	mov    %r12,%rsi
+  800bbf:	48 b8 87 0b 80 00 00 	movabs $0x800b87,%rax
+  800bc6:	00 00 00 
+  800bc9:	ff d0                	call   *%rax
+    return dst;
+}
+  800bcb:	48 89 d8             	mov    %rbx,%rax
+  800bce:	5b                   	pop    %rbx
+  800bcf:	41 5c                	pop    %r12
+  800bd1:	5d                   	pop    %rbp
+  800bd2:	c3                   	ret
+
+0000000000800bd3 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800bd3:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800bd6:	48 85 d2             	test   %rdx,%rdx
+  800bd9:	74 1f                	je     800bfa <strncpy+0x27>
+  800bdb:	48 01 fa             	add    %rdi,%rdx
+  800bde:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800be1:	48 83 c1 01          	add    $0x1,%rcx
+  800be5:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800be9:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800bed:	41 80 f8 01          	cmp    $0x1,%r8b
+  800bf1:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800bf5:	48 39 ca             	cmp    %rcx,%rdx
+  800bf8:	75 e7                	jne    800be1 <strncpy+0xe>
+    }
+    return ret;
+}
+  800bfa:	c3                   	ret
+
+0000000000800bfb <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800bfb:	48 89 f8             	mov    %rdi,%rax
+  800bfe:	48 85 d2             	test   %rdx,%rdx
+  800c01:	74 24                	je     800c27 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800c03:	48 83 ea 01          	sub    $0x1,%rdx
+  800c07:	74 1b                	je     800c24 <strlcpy+0x29>
+  800c09:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800c0d:	0f b6 16             	movzbl (%rsi),%edx
+  800c10:	84 d2                	test   %dl,%dl
+  800c12:	74 10                	je     800c24 <strlcpy+0x29>
+            *dst++ = *src++;
+  800c14:	48 83 c6 01          	add    $0x1,%rsi
+  800c18:	48 83 c0 01          	add    $0x1,%rax
+  800c1c:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800c1f:	48 39 c8             	cmp    %rcx,%rax
+  800c22:	75 e9                	jne    800c0d <strlcpy+0x12>
+        *dst = '\0';
+  800c24:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800c27:	48 29 f8             	sub    %rdi,%rax
+}
+  800c2a:	c3                   	ret
+
+0000000000800c2b <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800c2b:	0f b6 07             	movzbl (%rdi),%eax
+  800c2e:	84 c0                	test   %al,%al
+  800c30:	74 13                	je     800c45 <strcmp+0x1a>
+  800c32:	38 06                	cmp    %al,(%rsi)
+  800c34:	75 0f                	jne    800c45 <strcmp+0x1a>
+  800c36:	48 83 c7 01          	add    $0x1,%rdi
+  800c3a:	48 83 c6 01          	add    $0x1,%rsi
+  800c3e:	0f b6 07             	movzbl (%rdi),%eax
+  800c41:	84 c0                	test   %al,%al
+  800c43:	75 ed                	jne    800c32 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800c45:	0f b6 c0             	movzbl %al,%eax
+  800c48:	0f b6 16             	movzbl (%rsi),%edx
+  800c4b:	29 d0                	sub    %edx,%eax
+}
+  800c4d:	c3                   	ret
+
+0000000000800c4e <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800c4e:	48 85 d2             	test   %rdx,%rdx
+  800c51:	74 1f                	je     800c72 <strncmp+0x24>
+  800c53:	0f b6 07             	movzbl (%rdi),%eax
+  800c56:	84 c0                	test   %al,%al
+  800c58:	74 1e                	je     800c78 <strncmp+0x2a>
+  800c5a:	3a 06                	cmp    (%rsi),%al
+  800c5c:	75 1a                	jne    800c78 <strncmp+0x2a>
+  800c5e:	48 83 c7 01          	add    $0x1,%rdi
+  800c62:	48 83 c6 01          	add    $0x1,%rsi
+  800c66:	48 83 ea 01          	sub    $0x1,%rdx
+  800c6a:	75 e7                	jne    800c53 <strncmp+0x5>
+
+    if (!n) return 0;
+  800c6c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c71:	c3                   	ret
+  800c72:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c77:	c3                   	ret
+  800c78:	48 85 d2             	test   %rdx,%rdx
+  800c7b:	74 09                	je     800c86 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800c7d:	0f b6 07             	movzbl (%rdi),%eax
+  800c80:	0f b6 16             	movzbl (%rsi),%edx
+  800c83:	29 d0                	sub    %edx,%eax
+  800c85:	c3                   	ret
+    if (!n) return 0;
+  800c86:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800c8b:	c3                   	ret
+
+0000000000800c8c <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800c8c:	0f b6 17             	movzbl (%rdi),%edx
+  800c8f:	84 d2                	test   %dl,%dl
+  800c91:	74 18                	je     800cab <strchr+0x1f>
+        if (*str == c) {
+  800c93:	0f be d2             	movsbl %dl,%edx
+  800c96:	39 f2                	cmp    %esi,%edx
+  800c98:	74 17                	je     800cb1 <strchr+0x25>
+    for (; *str; str++) {
+  800c9a:	48 83 c7 01          	add    $0x1,%rdi
+  800c9e:	0f b6 17             	movzbl (%rdi),%edx
+  800ca1:	84 d2                	test   %dl,%dl
+  800ca3:	75 ee                	jne    800c93 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800ca5:	b8 00 00 00 00       	mov    $0x0,%eax
+  800caa:	c3                   	ret
+  800cab:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cb0:	c3                   	ret
+  800cb1:	48 89 f8             	mov    %rdi,%rax
+}
+  800cb4:	c3                   	ret
+
+0000000000800cb5 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800cb5:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800cb8:	0f b6 17             	movzbl (%rdi),%edx
+  800cbb:	84 d2                	test   %dl,%dl
+  800cbd:	74 13                	je     800cd2 <strfind+0x1d>
+  800cbf:	0f be d2             	movsbl %dl,%edx
+  800cc2:	39 f2                	cmp    %esi,%edx
+  800cc4:	74 0b                	je     800cd1 <strfind+0x1c>
+  800cc6:	48 83 c0 01          	add    $0x1,%rax
+  800cca:	0f b6 10             	movzbl (%rax),%edx
+  800ccd:	84 d2                	test   %dl,%dl
+  800ccf:	75 ee                	jne    800cbf <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800cd1:	c3                   	ret
+  800cd2:	c3                   	ret
+
+0000000000800cd3 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800cd3:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800cd6:	48 89 f8             	mov    %rdi,%rax
+  800cd9:	48 f7 d8             	neg    %rax
+  800cdc:	83 e0 07             	and    $0x7,%eax
+  800cdf:	49 89 d1             	mov    %rdx,%r9
+  800ce2:	49 29 c1             	sub    %rax,%r9
+  800ce5:	78 36                	js     800d1d <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800ce7:	40 0f b6 c6          	movzbl %sil,%eax
+  800ceb:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800cf2:	01 01 01 
+  800cf5:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800cf9:	40 f6 c7 07          	test   $0x7,%dil
+  800cfd:	75 38                	jne    800d37 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800cff:	4c 89 c9             	mov    %r9,%rcx
+  800d02:	48 c1 f9 03          	sar    $0x3,%rcx
+  800d06:	74 0c                	je     800d14 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800d08:	fc                   	cld
+  800d09:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800d0c:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800d10:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800d14:	4d 85 c9             	test   %r9,%r9
+  800d17:	75 45                	jne    800d5e <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800d19:	4c 89 c0             	mov    %r8,%rax
+  800d1c:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800d1d:	48 85 d2             	test   %rdx,%rdx
+  800d20:	74 f7                	je     800d19 <memset+0x46>
+  800d22:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800d25:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800d28:	48 83 c0 01          	add    $0x1,%rax
+  800d2c:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  800d30:	48 39 c2             	cmp    %rax,%rdx
+  800d33:	75 f3                	jne    800d28 <memset+0x55>
+  800d35:	eb e2                	jmp    800d19 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  800d37:	40 f6 c7 01          	test   $0x1,%dil
+  800d3b:	74 06                	je     800d43 <memset+0x70>
+  800d3d:	88 07                	mov    %al,(%rdi)
+  800d3f:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800d43:	40 f6 c7 02          	test   $0x2,%dil
+  800d47:	74 07                	je     800d50 <memset+0x7d>
+  800d49:	66 89 07             	mov    %ax,(%rdi)
+  800d4c:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800d50:	40 f6 c7 04          	test   $0x4,%dil
+  800d54:	74 a9                	je     800cff <memset+0x2c>
+  800d56:	89 07                	mov    %eax,(%rdi)
+  800d58:	48 83 c7 04          	add    $0x4,%rdi
+  800d5c:	eb a1                	jmp    800cff <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800d5e:	41 f6 c1 04          	test   $0x4,%r9b
+  800d62:	74 06                	je     800d6a <memset+0x97>
+  800d64:	89 07                	mov    %eax,(%rdi)
+  800d66:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800d6a:	41 f6 c1 02          	test   $0x2,%r9b
+  800d6e:	74 07                	je     800d77 <memset+0xa4>
+  800d70:	66 89 07             	mov    %ax,(%rdi)
+  800d73:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  800d77:	41 f6 c1 01          	test   $0x1,%r9b
+  800d7b:	74 9c                	je     800d19 <memset+0x46>
+  800d7d:	88 07                	mov    %al,(%rdi)
+  800d7f:	eb 98                	jmp    800d19 <memset+0x46>
+
+0000000000800d81 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  800d81:	48 89 f8             	mov    %rdi,%rax
+  800d84:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  800d87:	48 39 fe             	cmp    %rdi,%rsi
+  800d8a:	73 3b                	jae    800dc7 <memmove+0x46>
+  800d8c:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  800d90:	48 39 d7             	cmp    %rdx,%rdi
+  800d93:	73 32                	jae    800dc7 <memmove+0x46>
+        s += n;
+        d += n;
+  800d95:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800d99:	48 89 d6             	mov    %rdx,%rsi
+  800d9c:	48 09 fe             	or     %rdi,%rsi
+  800d9f:	48 09 ce             	or     %rcx,%rsi
+  800da2:	40 f6 c6 07          	test   $0x7,%sil
+  800da6:	75 12                	jne    800dba <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  800da8:	48 83 ef 08          	sub    $0x8,%rdi
+  800dac:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  800db0:	48 c1 e9 03          	shr    $0x3,%rcx
+  800db4:	fd                   	std
+  800db5:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  800db8:	fc                   	cld
+  800db9:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  800dba:	48 83 ef 01          	sub    $0x1,%rdi
+  800dbe:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  800dc2:	fd                   	std
+  800dc3:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  800dc5:	eb f1                	jmp    800db8 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800dc7:	48 89 f2             	mov    %rsi,%rdx
+  800dca:	48 09 c2             	or     %rax,%rdx
+  800dcd:	48 09 ca             	or     %rcx,%rdx
+  800dd0:	f6 c2 07             	test   $0x7,%dl
+  800dd3:	75 0c                	jne    800de1 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  800dd5:	48 c1 e9 03          	shr    $0x3,%rcx
+  800dd9:	48 89 c7             	mov    %rax,%rdi
+  800ddc:	fc                   	cld
+  800ddd:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  800de0:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  800de1:	48 89 c7             	mov    %rax,%rdi
+  800de4:	fc                   	cld
+  800de5:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  800de7:	c3                   	ret
+
+0000000000800de8 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  800de8:	55                   	push   %rbp
+  800de9:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  800dec:	48 b8 81 0d 80 00 00 	movabs $0x800d81,%rax
+  800df3:	00 00 00 
+  800df6:	ff d0                	call   *%rax
+}
+  800df8:	5d                   	pop    %rbp
+  800df9:	c3                   	ret
+
+0000000000800dfa <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  800dfa:	55                   	push   %rbp
+  800dfb:	48 89 e5             	mov    %rsp,%rbp
+  800dfe:	41 57                	push   %r15
+  800e00:	41 56                	push   %r14
+  800e02:	41 55                	push   %r13
+  800e04:	41 54                	push   %r12
+  800e06:	53                   	push   %rbx
+  800e07:	48 83 ec 08          	sub    $0x8,%rsp
+  800e0b:	49 89 fe             	mov    %rdi,%r14
+  800e0e:	49 89 f7             	mov    %rsi,%r15
+  800e11:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  800e14:	48 89 f7             	mov    %rsi,%rdi
+  800e17:	48 b8 49 0b 80 00 00 	movabs $0x800b49,%rax
+  800e1e:	00 00 00 
+  800e21:	ff d0                	call   *%rax
+  800e23:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  800e26:	48 89 de             	mov    %rbx,%rsi
+  800e29:	4c 89 f7             	mov    %r14,%rdi
+  800e2c:	48 b8 64 0b 80 00 00 	movabs $0x800b64,%rax
+  800e33:	00 00 00 
+  800e36:	ff d0                	call   *%rax
+  800e38:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  800e3b:	48 39 c3             	cmp    %rax,%rbx
+  800e3e:	74 36                	je     800e76 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  800e40:	48 89 d8             	mov    %rbx,%rax
+  800e43:	4c 29 e8             	sub    %r13,%rax
+  800e46:	49 39 c4             	cmp    %rax,%r12
+  800e49:	73 31                	jae    800e7c <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  800e4b:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  800e50:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800e54:	4c 89 fe             	mov    %r15,%rsi
+  800e57:	48 b8 e8 0d 80 00 00 	movabs $0x800de8,%rax
+  800e5e:	00 00 00 
+  800e61:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  800e63:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  800e67:	48 83 c4 08          	add    $0x8,%rsp
+  800e6b:	5b                   	pop    %rbx
+  800e6c:	41 5c                	pop    %r12
+  800e6e:	41 5d                	pop    %r13
+  800e70:	41 5e                	pop    %r14
+  800e72:	41 5f                	pop    %r15
+  800e74:	5d                   	pop    %rbp
+  800e75:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  800e76:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800e7a:	eb eb                	jmp    800e67 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  800e7c:	48 83 eb 01          	sub    $0x1,%rbx
+  800e80:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800e84:	48 89 da             	mov    %rbx,%rdx
+  800e87:	4c 89 fe             	mov    %r15,%rsi
+  800e8a:	48 b8 e8 0d 80 00 00 	movabs $0x800de8,%rax
+  800e91:	00 00 00 
+  800e94:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  800e96:	49 01 de             	add    %rbx,%r14
+  800e99:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  800e9e:	eb c3                	jmp    800e63 <strlcat+0x69>
+
+0000000000800ea0 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  800ea0:	48 85 d2             	test   %rdx,%rdx
+  800ea3:	74 2d                	je     800ed2 <memcmp+0x32>
+  800ea5:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  800eaa:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800eae:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  800eb3:	44 38 c1             	cmp    %r8b,%cl
+  800eb6:	75 0f                	jne    800ec7 <memcmp+0x27>
+    while (n-- > 0) {
+  800eb8:	48 83 c0 01          	add    $0x1,%rax
+  800ebc:	48 39 c2             	cmp    %rax,%rdx
+  800ebf:	75 e9                	jne    800eaa <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  800ec1:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ec6:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  800ec7:	0f b6 c1             	movzbl %cl,%eax
+  800eca:	45 0f b6 c0          	movzbl %r8b,%r8d
+  800ece:	44 29 c0             	sub    %r8d,%eax
+  800ed1:	c3                   	ret
+    return 0;
+  800ed2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800ed7:	c3                   	ret
+
+0000000000800ed8 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  800ed8:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  800edc:	48 39 c7             	cmp    %rax,%rdi
+  800edf:	73 0f                	jae    800ef0 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  800ee1:	40 38 37             	cmp    %sil,(%rdi)
+  800ee4:	74 0e                	je     800ef4 <memfind+0x1c>
+    for (; src < end; src++) {
+  800ee6:	48 83 c7 01          	add    $0x1,%rdi
+  800eea:	48 39 f8             	cmp    %rdi,%rax
+  800eed:	75 f2                	jne    800ee1 <memfind+0x9>
+  800eef:	c3                   	ret
+  800ef0:	48 89 f8             	mov    %rdi,%rax
+  800ef3:	c3                   	ret
+  800ef4:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  800ef7:	c3                   	ret
+
+0000000000800ef8 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  800ef8:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  800efb:	0f b6 37             	movzbl (%rdi),%esi
+  800efe:	40 80 fe 20          	cmp    $0x20,%sil
+  800f02:	74 06                	je     800f0a <strtol+0x12>
+  800f04:	40 80 fe 09          	cmp    $0x9,%sil
+  800f08:	75 13                	jne    800f1d <strtol+0x25>
+  800f0a:	48 83 c7 01          	add    $0x1,%rdi
+  800f0e:	0f b6 37             	movzbl (%rdi),%esi
+  800f11:	40 80 fe 20          	cmp    $0x20,%sil
+  800f15:	74 f3                	je     800f0a <strtol+0x12>
+  800f17:	40 80 fe 09          	cmp    $0x9,%sil
+  800f1b:	74 ed                	je     800f0a <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  800f1d:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  800f20:	83 e0 fd             	and    $0xfffffffd,%eax
+  800f23:	3c 01                	cmp    $0x1,%al
+  800f25:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  800f29:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  800f2f:	75 0f                	jne    800f40 <strtol+0x48>
+  800f31:	80 3f 30             	cmpb   $0x30,(%rdi)
+  800f34:	74 14                	je     800f4a <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  800f36:	85 d2                	test   %edx,%edx
+  800f38:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800f3d:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  800f40:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  800f45:	4c 63 ca             	movslq %edx,%r9
+  800f48:	eb 36                	jmp    800f80 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  800f4a:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  800f4e:	74 0f                	je     800f5f <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  800f50:	85 d2                	test   %edx,%edx
+  800f52:	75 ec                	jne    800f40 <strtol+0x48>
+        s++;
+  800f54:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  800f58:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  800f5d:	eb e1                	jmp    800f40 <strtol+0x48>
+        s += 2;
+  800f5f:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  800f63:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  800f68:	eb d6                	jmp    800f40 <strtol+0x48>
+            dig -= '0';
+  800f6a:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  800f6d:	44 0f b6 c1          	movzbl %cl,%r8d
+  800f71:	41 39 d0             	cmp    %edx,%r8d
+  800f74:	7d 21                	jge    800f97 <strtol+0x9f>
+        val = val * base + dig;
+  800f76:	49 0f af c1          	imul   %r9,%rax
+  800f7a:	0f b6 c9             	movzbl %cl,%ecx
+  800f7d:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  800f80:	48 83 c7 01          	add    $0x1,%rdi
+  800f84:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  800f88:	80 f9 39             	cmp    $0x39,%cl
+  800f8b:	76 dd                	jbe    800f6a <strtol+0x72>
+        else if (dig - 'a' < 27)
+  800f8d:	80 f9 7b             	cmp    $0x7b,%cl
+  800f90:	77 05                	ja     800f97 <strtol+0x9f>
+            dig -= 'a' - 10;
+  800f92:	83 e9 57             	sub    $0x57,%ecx
+  800f95:	eb d6                	jmp    800f6d <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  800f97:	4d 85 d2             	test   %r10,%r10
+  800f9a:	74 03                	je     800f9f <strtol+0xa7>
+  800f9c:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  800f9f:	48 89 c2             	mov    %rax,%rdx
+  800fa2:	48 f7 da             	neg    %rdx
+  800fa5:	40 80 fe 2d          	cmp    $0x2d,%sil
+  800fa9:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  800fad:	c3                   	ret
+
+0000000000800fae <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  800fae:	55                   	push   %rbp
+  800faf:	48 89 e5             	mov    %rsp,%rbp
+  800fb2:	53                   	push   %rbx
+  800fb3:	48 89 fa             	mov    %rdi,%rdx
+  800fb6:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  800fb9:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800fbe:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fc3:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800fc8:	be 00 00 00 00       	mov    $0x0,%esi
+  800fcd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  800fd3:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  800fd5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800fd9:	c9                   	leave
+  800fda:	c3                   	ret
+
+0000000000800fdb <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  800fdb:	55                   	push   %rbp
+  800fdc:	48 89 e5             	mov    %rsp,%rbp
+  800fdf:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  800fe0:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  800fe5:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fea:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  800fef:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ff4:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  800ff9:	be 00 00 00 00       	mov    $0x0,%esi
+  800ffe:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801004:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  801006:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80100a:	c9                   	leave
+  80100b:	c3                   	ret
+
+000000000080100c <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  80100c:	55                   	push   %rbp
+  80100d:	48 89 e5             	mov    %rsp,%rbp
+  801010:	53                   	push   %rbx
+  801011:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  801015:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801018:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80101d:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801022:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801027:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80102c:	be 00 00 00 00       	mov    $0x0,%esi
+  801031:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801037:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801039:	48 85 c0             	test   %rax,%rax
+  80103c:	7f 06                	jg     801044 <sys_env_destroy+0x38>
+}
+  80103e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801042:	c9                   	leave
+  801043:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801044:	49 89 c0             	mov    %rax,%r8
+  801047:	b9 03 00 00 00       	mov    $0x3,%ecx
+  80104c:	48 ba 10 33 80 00 00 	movabs $0x803310,%rdx
+  801053:	00 00 00 
+  801056:	be 26 00 00 00       	mov    $0x26,%esi
+  80105b:	48 bf 2f 33 80 00 00 	movabs $0x80332f,%rdi
+  801062:	00 00 00 
+  801065:	b8 00 00 00 00       	mov    $0x0,%eax
+  80106a:	49 b9 c8 2a 80 00 00 	movabs $0x802ac8,%r9
+  801071:	00 00 00 
+  801074:	41 ff d1             	call   *%r9
+
+0000000000801077 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  801077:	55                   	push   %rbp
+  801078:	48 89 e5             	mov    %rsp,%rbp
+  80107b:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80107c:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801081:	ba 00 00 00 00       	mov    $0x0,%edx
+  801086:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80108b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801090:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801095:	be 00 00 00 00       	mov    $0x0,%esi
+  80109a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8010a0:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  8010a2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8010a6:	c9                   	leave
+  8010a7:	c3                   	ret
+
+00000000008010a8 <sys_yield>:
+
+void
+sys_yield(void) {
+  8010a8:	55                   	push   %rbp
+  8010a9:	48 89 e5             	mov    %rsp,%rbp
+  8010ac:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8010ad:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8010b2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010b7:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8010bc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010c1:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8010c6:	be 00 00 00 00       	mov    $0x0,%esi
+  8010cb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8010d1:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  8010d3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8010d7:	c9                   	leave
+  8010d8:	c3                   	ret
+
+00000000008010d9 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  8010d9:	55                   	push   %rbp
+  8010da:	48 89 e5             	mov    %rsp,%rbp
+  8010dd:	53                   	push   %rbx
+  8010de:	48 89 fa             	mov    %rdi,%rdx
+  8010e1:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8010e4:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8010e9:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  8010f0:	00 00 00 
+  8010f3:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8010f8:	be 00 00 00 00       	mov    $0x0,%esi
+  8010fd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801103:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  801105:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801109:	c9                   	leave
+  80110a:	c3                   	ret
+
+000000000080110b <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  80110b:	55                   	push   %rbp
+  80110c:	48 89 e5             	mov    %rsp,%rbp
+  80110f:	53                   	push   %rbx
+  801110:	49 89 f8             	mov    %rdi,%r8
+  801113:	48 89 d3             	mov    %rdx,%rbx
+  801116:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801119:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80111e:	4c 89 c2             	mov    %r8,%rdx
+  801121:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801124:	be 00 00 00 00       	mov    $0x0,%esi
+  801129:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80112f:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  801131:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801135:	c9                   	leave
+  801136:	c3                   	ret
+
+0000000000801137 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  801137:	55                   	push   %rbp
+  801138:	48 89 e5             	mov    %rsp,%rbp
+  80113b:	53                   	push   %rbx
+  80113c:	48 83 ec 08          	sub    $0x8,%rsp
+  801140:	89 f8                	mov    %edi,%eax
+  801142:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  801145:	48 63 f9             	movslq %ecx,%rdi
+  801148:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80114b:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  801150:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801153:	be 00 00 00 00       	mov    $0x0,%esi
+  801158:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80115e:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801160:	48 85 c0             	test   %rax,%rax
+  801163:	7f 06                	jg     80116b <sys_alloc_region+0x34>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  801165:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801169:	c9                   	leave
+  80116a:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80116b:	49 89 c0             	mov    %rax,%r8
+  80116e:	b9 04 00 00 00       	mov    $0x4,%ecx
+  801173:	48 ba 10 33 80 00 00 	movabs $0x803310,%rdx
+  80117a:	00 00 00 
+  80117d:	be 26 00 00 00       	mov    $0x26,%esi
+  801182:	48 bf 2f 33 80 00 00 	movabs $0x80332f,%rdi
+  801189:	00 00 00 
+  80118c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801191:	49 b9 c8 2a 80 00 00 	movabs $0x802ac8,%r9
+  801198:	00 00 00 
+  80119b:	41 ff d1             	call   *%r9
+
+000000000080119e <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  80119e:	55                   	push   %rbp
+  80119f:	48 89 e5             	mov    %rsp,%rbp
+  8011a2:	53                   	push   %rbx
+  8011a3:	48 83 ec 08          	sub    $0x8,%rsp
+  8011a7:	89 f8                	mov    %edi,%eax
+  8011a9:	49 89 f2             	mov    %rsi,%r10
+  8011ac:	48 89 cf             	mov    %rcx,%rdi
+  8011af:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  8011b2:	48 63 da             	movslq %edx,%rbx
+  8011b5:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8011b8:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8011bd:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8011c0:	4d 63 c1             	movslq %r9d,%r8
+    asm volatile("int %1\n"
+  8011c3:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8011c5:	48 85 c0             	test   %rax,%rax
+  8011c8:	7f 06                	jg     8011d0 <sys_map_region+0x32>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8011ca:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8011ce:	c9                   	leave
+  8011cf:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8011d0:	49 89 c0             	mov    %rax,%r8
+  8011d3:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8011d8:	48 ba 10 33 80 00 00 	movabs $0x803310,%rdx
+  8011df:	00 00 00 
+  8011e2:	be 26 00 00 00       	mov    $0x26,%esi
+  8011e7:	48 bf 2f 33 80 00 00 	movabs $0x80332f,%rdi
+  8011ee:	00 00 00 
+  8011f1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011f6:	49 b9 c8 2a 80 00 00 	movabs $0x802ac8,%r9
+  8011fd:	00 00 00 
+  801200:	41 ff d1             	call   *%r9
+
+0000000000801203 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  801203:	55                   	push   %rbp
+  801204:	48 89 e5             	mov    %rsp,%rbp
+  801207:	53                   	push   %rbx
+  801208:	48 83 ec 08          	sub    $0x8,%rsp
+  80120c:	48 89 f1             	mov    %rsi,%rcx
+  80120f:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  801212:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801215:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80121a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  80121f:	be 00 00 00 00       	mov    $0x0,%esi
+  801224:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80122a:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80122c:	48 85 c0             	test   %rax,%rax
+  80122f:	7f 06                	jg     801237 <sys_unmap_region+0x34>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  801231:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801235:	c9                   	leave
+  801236:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801237:	49 89 c0             	mov    %rax,%r8
+  80123a:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80123f:	48 ba 10 33 80 00 00 	movabs $0x803310,%rdx
+  801246:	00 00 00 
+  801249:	be 26 00 00 00       	mov    $0x26,%esi
+  80124e:	48 bf 2f 33 80 00 00 	movabs $0x80332f,%rdi
+  801255:	00 00 00 
+  801258:	b8 00 00 00 00       	mov    $0x0,%eax
+  80125d:	49 b9 c8 2a 80 00 00 	movabs $0x802ac8,%r9
+  801264:	00 00 00 
+  801267:	41 ff d1             	call   *%r9
+
+000000000080126a <sys_region_batch>:
+
+int
+sys_region_batch(const struct RegionOp *ops, size_t count) {
+  80126a:	55                   	push   %rbp
+  80126b:	48 89 e5             	mov    %rsp,%rbp
+  80126e:	53                   	push   %rbx
+  80126f:	48 83 ec 08          	sub    $0x8,%rsp
+  801273:	48 89 fa             	mov    %rdi,%rdx
+  801276:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801279:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80127e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801283:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801288:	be 00 00 00 00       	mov    $0x0,%esi
+  80128d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801293:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801295:	48 85 c0             	test   %rax,%rax
+  801298:	7f 06                	jg     8012a0 <sys_region_batch+0x36>
+        else
+            platform_asan_unpoison(va, ops[i].size);
+    }
+#endif
+    return res;
+}
+  80129a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80129e:	c9                   	leave
+  80129f:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8012a0:	49 89 c0             	mov    %rax,%r8
+  8012a3:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  8012a8:	48 ba 10 33 80 00 00 	movabs $0x803310,%rdx
+  8012af:	00 00 00 
+  8012b2:	be 26 00 00 00       	mov    $0x26,%esi
+  8012b7:	48 bf 2f 33 80 00 00 	movabs $0x80332f,%rdi
+  8012be:	00 00 00 
+  8012c1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012c6:	49 b9 c8 2a 80 00 00 	movabs $0x802ac8,%r9
+  8012cd:	00 00 00 
+  8012d0:	41 ff d1             	call   *%r9
+
+00000000008012d3 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  8012d3:	55                   	push   %rbp
+  8012d4:	48 89 e5             	mov    %rsp,%rbp
+  8012d7:	53                   	push   %rbx
+  8012d8:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  8012dc:	48 63 ce             	movslq %esi,%rcx
+  8012df:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8012e2:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8012e7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012ec:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8012f1:	be 00 00 00 00       	mov    $0x0,%esi
+  8012f6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8012fc:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8012fe:	48 85 c0             	test   %rax,%rax
+  801301:	7f 06                	jg     801309 <sys_env_set_status+0x36>
+}
+  801303:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801307:	c9                   	leave
+  801308:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801309:	49 89 c0             	mov    %rax,%r8
+  80130c:	b9 09 00 00 00       	mov    $0x9,%ecx
+  801311:	48 ba 10 33 80 00 00 	movabs $0x803310,%rdx
+  801318:	00 00 00 
+  80131b:	be 26 00 00 00       	mov    $0x26,%esi
+  801320:	48 bf 2f 33 80 00 00 	movabs $0x80332f,%rdi
+  801327:	00 00 00 
+  80132a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80132f:	49 b9 c8 2a 80 00 00 	movabs $0x802ac8,%r9
+  801336:	00 00 00 
+  801339:	41 ff d1             	call   *%r9
+
+000000000080133c <sys_env_set_weight>:
+
+int
+sys_env_set_weight(envid_t envid, uint32_t weight) {
+  80133c:	55                   	push   %rbp
+  80133d:	48 89 e5             	mov    %rsp,%rbp
+  801340:	53                   	push   %rbx
+  801341:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_weight, 1, envid, weight, 0, 0, 0, 0);
+  801345:	89 f1                	mov    %esi,%ecx
+  801347:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80134a:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80134f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801354:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801359:	be 00 00 00 00       	mov    $0x0,%esi
+  80135e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801364:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801366:	48 85 c0             	test   %rax,%rax
+  801369:	7f 06                	jg     801371 <sys_env_set_weight+0x35>
+}
+  80136b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80136f:	c9                   	leave
+  801370:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801371:	49 89 c0             	mov    %rax,%r8
+  801374:	b9 10 00 00 00       	mov    $0x10,%ecx
+  801379:	48 ba 10 33 80 00 00 	movabs $0x803310,%rdx
+  801380:	00 00 00 
+  801383:	be 26 00 00 00       	mov    $0x26,%esi
+  801388:	48 bf 2f 33 80 00 00 	movabs $0x80332f,%rdi
+  80138f:	00 00 00 
+  801392:	b8 00 00 00 00       	mov    $0x0,%eax
+  801397:	49 b9 c8 2a 80 00 00 	movabs $0x802ac8,%r9
+  80139e:	00 00 00 
+  8013a1:	41 ff d1             	call   *%r9
+
+00000000008013a4 <sys_env_set_rt>:
+
+int
+sys_env_set_rt(envid_t envid, uint64_t period, uint64_t budget, uint64_t deadline) {
+  8013a4:	55                   	push   %rbp
+  8013a5:	48 89 e5             	mov    %rsp,%rbp
+  8013a8:	53                   	push   %rbx
+  8013a9:	48 83 ec 08          	sub    $0x8,%rsp
+  8013ad:	89 f8                	mov    %edi,%eax
+  8013af:	48 89 d3             	mov    %rdx,%rbx
+  8013b2:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_env_set_rt, 1, envid, period, budget, deadline, 0, 0);
+  8013b5:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8013b8:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8013bd:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8013c0:	be 00 00 00 00       	mov    $0x0,%esi
+  8013c5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  8013cb:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8013cd:	48 85 c0             	test   %rax,%rax
+  8013d0:	7f 06                	jg     8013d8 <sys_env_set_rt+0x34>
+}
+  8013d2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013d6:	c9                   	leave
+  8013d7:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8013d8:	49 89 c0             	mov    %rax,%r8
+  8013db:	b9 11 00 00 00       	mov    $0x11,%ecx
+  8013e0:	48 ba 10 33 80 00 00 	movabs $0x803310,%rdx
+  8013e7:	00 00 00 
+  8013ea:	be 26 00 00 00       	mov    $0x26,%esi
+  8013ef:	48 bf 2f 33 80 00 00 	movabs $0x80332f,%rdi
+  8013f6:	00 00 00 
+  8013f9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013fe:	49 b9 c8 2a 80 00 00 	movabs $0x802ac8,%r9
+  801405:	00 00 00 
+  801408:	41 ff d1             	call   *%r9
+
+000000000080140b <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  80140b:	55                   	push   %rbp
+  80140c:	48 89 e5             	mov    %rsp,%rbp
+  80140f:	53                   	push   %rbx
+  801410:	48 83 ec 08          	sub    $0x8,%rsp
+  801414:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  801417:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80141a:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80141f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801424:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801429:	be 00 00 00 00       	mov    $0x0,%esi
+  80142e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801434:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801436:	48 85 c0             	test   %rax,%rax
+  801439:	7f 06                	jg     801441 <sys_env_set_trapframe+0x36>
+}
+  80143b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80143f:	c9                   	leave
+  801440:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801441:	49 89 c0             	mov    %rax,%r8
+  801444:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  801449:	48 ba 10 33 80 00 00 	movabs $0x803310,%rdx
+  801450:	00 00 00 
+  801453:	be 26 00 00 00       	mov    $0x26,%esi
+  801458:	48 bf 2f 33 80 00 00 	movabs $0x80332f,%rdi
+  80145f:	00 00 00 
+  801462:	b8 00 00 00 00       	mov    $0x0,%eax
+  801467:	49 b9 c8 2a 80 00 00 	movabs $0x802ac8,%r9
+  80146e:	00 00 00 
+  801471:	41 ff d1             	call   *%r9
+
+0000000000801474 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  801474:	55                   	push   %rbp
+  801475:	48 89 e5             	mov    %rsp,%rbp
+  801478:	53                   	push   %rbx
+  801479:	48 83 ec 08          	sub    $0x8,%rsp
+  80147d:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  801480:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  801483:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  801488:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80148d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801492:	be 00 00 00 00       	mov    $0x0,%esi
+  801497:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  80149d:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80149f:	48 85 c0             	test   %rax,%rax
+  8014a2:	7f 06                	jg     8014aa <sys_env_set_pgfault_upcall+0x36>
+}
+  8014a4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014a8:	c9                   	leave
+  8014a9:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8014aa:	49 89 c0             	mov    %rax,%r8
+  8014ad:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  8014b2:	48 ba 10 33 80 00 00 	movabs $0x803310,%rdx
+  8014b9:	00 00 00 
+  8014bc:	be 26 00 00 00       	mov    $0x26,%esi
+  8014c1:	48 bf 2f 33 80 00 00 	movabs $0x80332f,%rdi
+  8014c8:	00 00 00 
+  8014cb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014d0:	49 b9 c8 2a 80 00 00 	movabs $0x802ac8,%r9
+  8014d7:	00 00 00 
+  8014da:	41 ff d1             	call   *%r9
+
+00000000008014dd <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  8014dd:	55                   	push   %rbp
+  8014de:	48 89 e5             	mov    %rsp,%rbp
+  8014e1:	53                   	push   %rbx
+  8014e2:	89 f8                	mov    %edi,%eax
+  8014e4:	49 89 f1             	mov    %rsi,%r9
+  8014e7:	48 89 d3             	mov    %rdx,%rbx
+  8014ea:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  8014ed:	49 63 f0             	movslq %r8d,%rsi
+  8014f0:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8014f3:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8014f8:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  8014fb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801501:	cd 30                	int    $0x30
+}
+  801503:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801507:	c9                   	leave
+  801508:	c3                   	ret
+
+0000000000801509 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  801509:	55                   	push   %rbp
+  80150a:	48 89 e5             	mov    %rsp,%rbp
+  80150d:	53                   	push   %rbx
+  80150e:	48 83 ec 08          	sub    $0x8,%rsp
+  801512:	48 89 fa             	mov    %rdi,%rdx
+  801515:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  801518:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80151d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801522:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+  801527:	be 00 00 00 00       	mov    $0x0,%esi
+  80152c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+    asm volatile("int %1\n"
+  801532:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  801534:	48 85 c0             	test   %rax,%rax
+  801537:	7f 06                	jg     80153f <sys_ipc_recv+0x36>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801539:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80153d:	c9                   	leave
+  80153e:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80153f:	49 89 c0             	mov    %rax,%r8
+  801542:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  801547:	48 ba 10 33 80 00 00 	movabs $0x803310,%rdx
+  80154e:	00 00 00 
+  801551:	be 26 00 00 00       	mov    $0x26,%esi
+  801556:	48 bf 2f 33 80 00 00 	movabs $0x80332f,%rdi
+  80155d:	00 00 00 
+  801560:	b8 00 00 00 00       	mov    $0x0,%eax
+  801565:	49 b9 c8 2a 80 00 00 	movabs $0x802ac8,%r9
+  80156c:	00 00 00 
+  80156f:	41 ff d1             	call   *%r9
+
+0000000000801572 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801572:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801579:	ff ff ff 
+  80157c:	48 01 f8             	add    %rdi,%rax
+  80157f:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  801583:	c3                   	ret
+
+0000000000801584 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801584:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  80158b:	ff ff ff 
+  80158e:	48 01 f8             	add    %rdi,%rax
+  801591:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  801595:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  80159b:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  80159f:	c3                   	ret
+
+00000000008015a0 <fd_alloc_from>:
+}
+
+/* Like fd_alloc(), but only considers fds starting from fdnum,
+ * so that several fds can be found before their pages are allocated */
+int
+fd_alloc_from(int fdnum, struct Fd **fd_store) {
+  8015a0:	55                   	push   %rbp
+  8015a1:	48 89 e5             	mov    %rsp,%rbp
+  8015a4:	41 57                	push   %r15
+  8015a6:	41 56                	push   %r14
+  8015a8:	41 55                	push   %r13
+  8015aa:	41 54                	push   %r12
+  8015ac:	53                   	push   %rbx
+  8015ad:	48 83 ec 08          	sub    $0x8,%rsp
+  8015b1:	49 89 f7             	mov    %rsi,%r15
+    for (int i = MAX(fdnum, 0); i < MAXFD; i++) {
+  8015b4:	85 ff                	test   %edi,%edi
+  8015b6:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8015bc:	44 0f 49 e7          	cmovns %edi,%r12d
+  8015c0:	83 ff 1f             	cmp    $0x1f,%edi
+  8015c3:	7f 37                	jg     8015fc <fd_alloc_from+0x5c>
+  8015c5:	49 63 dc             	movslq %r12d,%rbx
+  8015c8:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  8015cf:	48 c1 e3 0c          	shl    $0xc,%rbx
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  8015d3:	49 be a9 26 80 00 00 	movabs $0x8026a9,%r14
+  8015da:	00 00 00 
+        struct Fd *fd = INDEX2FD(i);
+  8015dd:	49 89 dd             	mov    %rbx,%r13
+        if (!(get_prot(fd) & PROT_R)) {
+  8015e0:	48 89 df             	mov    %rbx,%rdi
+  8015e3:	41 ff d6             	call   *%r14
+  8015e6:	83 e0 04             	and    $0x4,%eax
+  8015e9:	74 1c                	je     801607 <fd_alloc_from+0x67>
+    for (int i = MAX(fdnum, 0); i < MAXFD; i++) {
+  8015eb:	41 83 c4 01          	add    $0x1,%r12d
+  8015ef:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8015f6:	41 83 fc 1f          	cmp    $0x1f,%r12d
+  8015fa:	7e e1                	jle    8015dd <fd_alloc_from+0x3d>
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  8015fc:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801602:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  801607:	4d 89 2f             	mov    %r13,(%r15)
+}
+  80160a:	48 83 c4 08          	add    $0x8,%rsp
+  80160e:	5b                   	pop    %rbx
+  80160f:	41 5c                	pop    %r12
+  801611:	41 5d                	pop    %r13
+  801613:	41 5e                	pop    %r14
+  801615:	41 5f                	pop    %r15
+  801617:	5d                   	pop    %rbp
+  801618:	c3                   	ret
+
+0000000000801619 <fd_alloc>:
+fd_alloc(struct Fd **fd_store) {
+  801619:	55                   	push   %rbp
+  80161a:	48 89 e5             	mov    %rsp,%rbp
+  80161d:	48 89 fe             	mov    %rdi,%rsi
+    return fd_alloc_from(0, fd_store);
+  801620:	bf 00 00 00 00       	mov    $0x0,%edi
+  801625:	48 b8 a0 15 80 00 00 	movabs $0x8015a0,%rax
+  80162c:	00 00 00 
+  80162f:	ff d0                	call   *%rax
+}
+  801631:	5d                   	pop    %rbp
+  801632:	c3                   	ret
+
+0000000000801633 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  801633:	83 ff 1f             	cmp    $0x1f,%edi
+  801636:	77 39                	ja     801671 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  801638:	55                   	push   %rbp
+  801639:	48 89 e5             	mov    %rsp,%rbp
+  80163c:	41 54                	push   %r12
+  80163e:	53                   	push   %rbx
+  80163f:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  801642:	48 63 df             	movslq %edi,%rbx
+  801645:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  80164c:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  801650:	48 89 df             	mov    %rbx,%rdi
+  801653:	48 b8 a9 26 80 00 00 	movabs $0x8026a9,%rax
+  80165a:	00 00 00 
+  80165d:	ff d0                	call   *%rax
+  80165f:	a8 04                	test   $0x4,%al
+  801661:	74 14                	je     801677 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  801663:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  801667:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80166c:	5b                   	pop    %rbx
+  80166d:	41 5c                	pop    %r12
+  80166f:	5d                   	pop    %rbp
+  801670:	c3                   	ret
+        return -E_INVAL;
+  801671:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801676:	c3                   	ret
+        return -E_INVAL;
+  801677:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80167c:	eb ee                	jmp    80166c <fd_lookup+0x39>
+
+000000000080167e <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  80167e:	55                   	push   %rbp
+  80167f:	48 89 e5             	mov    %rsp,%rbp
+  801682:	41 54                	push   %r12
+  801684:	53                   	push   %rbx
+  801685:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  801688:	48 b8 c0 33 80 00 00 	movabs $0x8033c0,%rax
+  80168f:	00 00 00 
+  801692:	48 bb 20 40 80 00 00 	movabs $0x804020,%rbx
+  801699:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  80169c:	39 3b                	cmp    %edi,(%rbx)
+  80169e:	74 47                	je     8016e7 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  8016a0:	48 83 c0 08          	add    $0x8,%rax
+  8016a4:	48 8b 18             	mov    (%rax),%rbx
+  8016a7:	48 85 db             	test   %rbx,%rbx
+  8016aa:	75 f0                	jne    80169c <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8016ac:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  8016b3:	00 00 00 
+  8016b6:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+  8016bc:	89 fa                	mov    %edi,%edx
+  8016be:	48 bf 40 33 80 00 00 	movabs $0x803340,%rdi
+  8016c5:	00 00 00 
+  8016c8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016cd:	48 b9 62 02 80 00 00 	movabs $0x800262,%rcx
+  8016d4:	00 00 00 
+  8016d7:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  8016d9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  8016de:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  8016e2:	5b                   	pop    %rbx
+  8016e3:	41 5c                	pop    %r12
+  8016e5:	5d                   	pop    %rbp
+  8016e6:	c3                   	ret
+            return 0;
+  8016e7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016ec:	eb f0                	jmp    8016de <dev_lookup+0x60>
+
+00000000008016ee <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  8016ee:	55                   	push   %rbp
+  8016ef:	48 89 e5             	mov    %rsp,%rbp
+  8016f2:	41 55                	push   %r13
+  8016f4:	41 54                	push   %r12
+  8016f6:	53                   	push   %rbx
+  8016f7:	48 83 ec 18          	sub    $0x18,%rsp
+  8016fb:	48 89 fb             	mov    %rdi,%rbx
+  8016fe:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801701:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  801708:	ff ff ff 
+  80170b:	48 01 df             	add    %rbx,%rdi
+  80170e:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  801712:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801716:	48 b8 33 16 80 00 00 	movabs $0x801633,%rax
+  80171d:	00 00 00 
+  801720:	ff d0                	call   *%rax
+  801722:	41 89 c5             	mov    %eax,%r13d
+  801725:	85 c0                	test   %eax,%eax
+  801727:	78 06                	js     80172f <fd_close+0x41>
+  801729:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  80172d:	74 1a                	je     801749 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  80172f:	45 84 e4             	test   %r12b,%r12b
+  801732:	b8 00 00 00 00       	mov    $0x0,%eax
+  801737:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  80173b:	44 89 e8             	mov    %r13d,%eax
+  80173e:	48 83 c4 18          	add    $0x18,%rsp
+  801742:	5b                   	pop    %rbx
+  801743:	41 5c                	pop    %r12
+  801745:	41 5d                	pop    %r13
+  801747:	5d                   	pop    %rbp
+  801748:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801749:	8b 3b                	mov    (%rbx),%edi
+  80174b:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80174f:	48 b8 7e 16 80 00 00 	movabs $0x80167e,%rax
+  801756:	00 00 00 
+  801759:	ff d0                	call   *%rax
+  80175b:	41 89 c5             	mov    %eax,%r13d
+  80175e:	85 c0                	test   %eax,%eax
+  801760:	78 1b                	js     80177d <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  801762:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801766:	48 8b 40 20          	mov    0x20(%rax),%rax
+  80176a:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801770:	48 85 c0             	test   %rax,%rax
+  801773:	74 08                	je     80177d <fd_close+0x8f>
+  801775:	48 89 df             	mov    %rbx,%rdi
+  801778:	ff d0                	call   *%rax
+  80177a:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  80177d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801782:	48 89 de             	mov    %rbx,%rsi
+  801785:	bf 00 00 00 00       	mov    $0x0,%edi
+  80178a:	48 b8 03 12 80 00 00 	movabs $0x801203,%rax
+  801791:	00 00 00 
+  801794:	ff d0                	call   *%rax
+    return res;
+  801796:	eb a3                	jmp    80173b <fd_close+0x4d>
+
+0000000000801798 <close>:
+
+int
+close(int fdnum) {
+  801798:	55                   	push   %rbp
+  801799:	48 89 e5             	mov    %rsp,%rbp
+  80179c:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  8017a0:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8017a4:	48 b8 33 16 80 00 00 	movabs $0x801633,%rax
+  8017ab:	00 00 00 
+  8017ae:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8017b0:	85 c0                	test   %eax,%eax
+  8017b2:	78 15                	js     8017c9 <close+0x31>
+
+    return fd_close(fd, 1);
+  8017b4:	be 01 00 00 00       	mov    $0x1,%esi
+  8017b9:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8017bd:	48 b8 ee 16 80 00 00 	movabs $0x8016ee,%rax
+  8017c4:	00 00 00 
+  8017c7:	ff d0                	call   *%rax
+}
+  8017c9:	c9                   	leave
+  8017ca:	c3                   	ret
+
+00000000008017cb <close_all>:
+
+void
+close_all(void) {
+  8017cb:	55                   	push   %rbp
+  8017cc:	48 89 e5             	mov    %rsp,%rbp
+  8017cf:	41 54                	push   %r12
+  8017d1:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  8017d2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017d7:	49 bc 98 17 80 00 00 	movabs $0x801798,%r12
+  8017de:	00 00 00 
+  8017e1:	89 df                	mov    %ebx,%edi
+  8017e3:	41 ff d4             	call   *%r12
+  8017e6:	83 c3 01             	add    $0x1,%ebx
+  8017e9:	83 fb 20             	cmp    $0x20,%ebx
+  8017ec:	75 f3                	jne    8017e1 <close_all+0x16>
+}
+  8017ee:	5b                   	pop    %rbx
+  8017ef:	41 5c                	pop    %r12
+  8017f1:	5d                   	pop    %rbp
+  8017f2:	c3                   	ret
+
+00000000008017f3 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  8017f3:	55                   	push   %rbp
+  8017f4:	48 89 e5             	mov    %rsp,%rbp
+  8017f7:	41 57                	push   %r15
+  8017f9:	41 56                	push   %r14
+  8017fb:	41 55                	push   %r13
+  8017fd:	41 54                	push   %r12
+  8017ff:	53                   	push   %rbx
+  801800:	48 83 ec 18          	sub    $0x18,%rsp
+  801804:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  801807:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  80180b:	48 b8 33 16 80 00 00 	movabs $0x801633,%rax
+  801812:	00 00 00 
+  801815:	ff d0                	call   *%rax
+  801817:	89 c3                	mov    %eax,%ebx
+  801819:	85 c0                	test   %eax,%eax
+  80181b:	0f 88 b8 00 00 00    	js     8018d9 <dup+0xe6>
+    close(newfdnum);
+  801821:	44 89 e7             	mov    %r12d,%edi
+  801824:	48 b8 98 17 80 00 00 	movabs $0x801798,%rax
+  80182b:	00 00 00 
+  80182e:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  801830:	4d 63 ec             	movslq %r12d,%r13
+  801833:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  80183a:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  80183e:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  801842:	4c 89 ff             	mov    %r15,%rdi
+  801845:	49 be 84 15 80 00 00 	movabs $0x801584,%r14
+  80184c:	00 00 00 
+  80184f:	41 ff d6             	call   *%r14
+  801852:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  801855:	4c 89 ef             	mov    %r13,%rdi
+  801858:	41 ff d6             	call   *%r14
+  80185b:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  80185e:	48 89 df             	mov    %rbx,%rdi
+  801861:	48 b8 a9 26 80 00 00 	movabs $0x8026a9,%rax
+  801868:	00 00 00 
+  80186b:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  80186d:	a8 04                	test   $0x4,%al
+  80186f:	74 2b                	je     80189c <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  801871:	41 89 c1             	mov    %eax,%r9d
+  801874:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  80187a:	4c 89 f1             	mov    %r14,%rcx
+  80187d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801882:	48 89 de             	mov    %rbx,%rsi
+  801885:	bf 00 00 00 00       	mov    $0x0,%edi
+  80188a:	48 b8 9e 11 80 00 00 	movabs $0x80119e,%rax
+  801891:	00 00 00 
+  801894:	ff d0                	call   *%rax
+  801896:	89 c3                	mov    %eax,%ebx
+  801898:	85 c0                	test   %eax,%eax
+  80189a:	78 4e                	js     8018ea <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  80189c:	4c 89 ff             	mov    %r15,%rdi
+  80189f:	48 b8 a9 26 80 00 00 	movabs $0x8026a9,%rax
+  8018a6:	00 00 00 
+  8018a9:	ff d0                	call   *%rax
+  8018ab:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  8018ae:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8018b4:	4c 89 e9             	mov    %r13,%rcx
+  8018b7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8018bc:	4c 89 fe             	mov    %r15,%rsi
+  8018bf:	bf 00 00 00 00       	mov    $0x0,%edi
+  8018c4:	48 b8 9e 11 80 00 00 	movabs $0x80119e,%rax
+  8018cb:	00 00 00 
+  8018ce:	ff d0                	call   *%rax
+  8018d0:	89 c3                	mov    %eax,%ebx
+  8018d2:	85 c0                	test   %eax,%eax
+  8018d4:	78 14                	js     8018ea <dup+0xf7>
+
+    return newfdnum;
+  8018d6:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  8018d9:	89 d8                	mov    %ebx,%eax
+  8018db:	48 83 c4 18          	add    $0x18,%rsp
+  8018df:	5b                   	pop    %rbx
+  8018e0:	41 5c                	pop    %r12
+  8018e2:	41 5d                	pop    %r13
+  8018e4:	41 5e                	pop    %r14
+  8018e6:	41 5f                	pop    %r15
+  8018e8:	5d                   	pop    %rbp
+  8018e9:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  8018ea:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8018ef:	4c 89 ee             	mov    %r13,%rsi
+  8018f2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8018f7:	49 bc 03 12 80 00 00 	movabs $0x801203,%r12
+  8018fe:	00 00 00 
+  801901:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  801904:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801909:	4c 89 f6             	mov    %r14,%rsi
+  80190c:	bf 00 00 00 00       	mov    $0x0,%edi
+  801911:	41 ff d4             	call   *%r12
+    return res;
+  801914:	eb c3                	jmp    8018d9 <dup+0xe6>
+
+0000000000801916 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  801916:	55                   	push   %rbp
+  801917:	48 89 e5             	mov    %rsp,%rbp
+  80191a:	41 56                	push   %r14
+  80191c:	41 55                	push   %r13
+  80191e:	41 54                	push   %r12
+  801920:	53                   	push   %rbx
+  801921:	48 83 ec 10          	sub    $0x10,%rsp
+  801925:	89 fb                	mov    %edi,%ebx
+  801927:	49 89 f4             	mov    %rsi,%r12
+  80192a:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80192d:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801931:	48 b8 33 16 80 00 00 	movabs $0x801633,%rax
+  801938:	00 00 00 
+  80193b:	ff d0                	call   *%rax
+  80193d:	85 c0                	test   %eax,%eax
+  80193f:	78 4c                	js     80198d <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801941:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801945:	41 8b 3e             	mov    (%r14),%edi
+  801948:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80194c:	48 b8 7e 16 80 00 00 	movabs $0x80167e,%rax
+  801953:	00 00 00 
+  801956:	ff d0                	call   *%rax
+  801958:	85 c0                	test   %eax,%eax
+  80195a:	78 35                	js     801991 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  80195c:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801960:	83 e0 03             	and    $0x3,%eax
+  801963:	83 f8 01             	cmp    $0x1,%eax
+  801966:	74 2d                	je     801995 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801968:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80196c:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801970:	48 85 c0             	test   %rax,%rax
+  801973:	74 56                	je     8019cb <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  801975:	4c 89 ea             	mov    %r13,%rdx
+  801978:	4c 89 e6             	mov    %r12,%rsi
+  80197b:	4c 89 f7             	mov    %r14,%rdi
+  80197e:	ff d0                	call   *%rax
+}
+  801980:	48 83 c4 10          	add    $0x10,%rsp
+  801984:	5b                   	pop    %rbx
+  801985:	41 5c                	pop    %r12
+  801987:	41 5d                	pop    %r13
+  801989:	41 5e                	pop    %r14
+  80198b:	5d                   	pop    %rbp
+  80198c:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80198d:	48 98                	cltq
+  80198f:	eb ef                	jmp    801980 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801991:	48 98                	cltq
+  801993:	eb eb                	jmp    801980 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801995:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  80199c:	00 00 00 
+  80199f:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+  8019a5:	89 da                	mov    %ebx,%edx
+  8019a7:	48 bf 81 33 80 00 00 	movabs $0x803381,%rdi
+  8019ae:	00 00 00 
+  8019b1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019b6:	48 b9 62 02 80 00 00 	movabs $0x800262,%rcx
+  8019bd:	00 00 00 
+  8019c0:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8019c2:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8019c9:	eb b5                	jmp    801980 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  8019cb:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  8019d2:	eb ac                	jmp    801980 <read+0x6a>
+
+00000000008019d4 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  8019d4:	55                   	push   %rbp
+  8019d5:	48 89 e5             	mov    %rsp,%rbp
+  8019d8:	41 57                	push   %r15
+  8019da:	41 56                	push   %r14
+  8019dc:	41 55                	push   %r13
+  8019de:	41 54                	push   %r12
+  8019e0:	53                   	push   %rbx
+  8019e1:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  8019e5:	48 85 d2             	test   %rdx,%rdx
+  8019e8:	74 54                	je     801a3e <readn+0x6a>
+  8019ea:	41 89 fd             	mov    %edi,%r13d
+  8019ed:	49 89 f6             	mov    %rsi,%r14
+  8019f0:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  8019f3:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  8019f8:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  8019fd:	49 bf 16 19 80 00 00 	movabs $0x801916,%r15
+  801a04:	00 00 00 
+  801a07:	4c 89 e2             	mov    %r12,%rdx
+  801a0a:	48 29 f2             	sub    %rsi,%rdx
+  801a0d:	4c 01 f6             	add    %r14,%rsi
+  801a10:	44 89 ef             	mov    %r13d,%edi
+  801a13:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  801a16:	85 c0                	test   %eax,%eax
+  801a18:	78 20                	js     801a3a <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  801a1a:	01 c3                	add    %eax,%ebx
+  801a1c:	85 c0                	test   %eax,%eax
+  801a1e:	74 08                	je     801a28 <readn+0x54>
+  801a20:	48 63 f3             	movslq %ebx,%rsi
+  801a23:	4c 39 e6             	cmp    %r12,%rsi
+  801a26:	72 df                	jb     801a07 <readn+0x33>
+    }
+    return res;
+  801a28:	48 63 c3             	movslq %ebx,%rax
+}
+  801a2b:	48 83 c4 08          	add    $0x8,%rsp
+  801a2f:	5b                   	pop    %rbx
+  801a30:	41 5c                	pop    %r12
+  801a32:	41 5d                	pop    %r13
+  801a34:	41 5e                	pop    %r14
+  801a36:	41 5f                	pop    %r15
+  801a38:	5d                   	pop    %rbp
+  801a39:	c3                   	ret
+        if (inc < 0) return inc;
+  801a3a:	48 98                	cltq
+  801a3c:	eb ed                	jmp    801a2b <readn+0x57>
+    int inc = 1, res = 0;
+  801a3e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a43:	eb e3                	jmp    801a28 <readn+0x54>
+
+0000000000801a45 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  801a45:	55                   	push   %rbp
+  801a46:	48 89 e5             	mov    %rsp,%rbp
+  801a49:	41 56                	push   %r14
+  801a4b:	41 55                	push   %r13
+  801a4d:	41 54                	push   %r12
+  801a4f:	53                   	push   %rbx
+  801a50:	48 83 ec 10          	sub    $0x10,%rsp
+  801a54:	89 fb                	mov    %edi,%ebx
+  801a56:	49 89 f4             	mov    %rsi,%r12
+  801a59:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801a5c:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801a60:	48 b8 33 16 80 00 00 	movabs $0x801633,%rax
+  801a67:	00 00 00 
+  801a6a:	ff d0                	call   *%rax
+  801a6c:	85 c0                	test   %eax,%eax
+  801a6e:	78 47                	js     801ab7 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801a70:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801a74:	41 8b 3e             	mov    (%r14),%edi
+  801a77:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801a7b:	48 b8 7e 16 80 00 00 	movabs $0x80167e,%rax
+  801a82:	00 00 00 
+  801a85:	ff d0                	call   *%rax
+  801a87:	85 c0                	test   %eax,%eax
+  801a89:	78 30                	js     801abb <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801a8b:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  801a90:	74 2d                	je     801abf <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801a92:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801a96:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801a9a:	48 85 c0             	test   %rax,%rax
+  801a9d:	74 56                	je     801af5 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  801a9f:	4c 89 ea             	mov    %r13,%rdx
+  801aa2:	4c 89 e6             	mov    %r12,%rsi
+  801aa5:	4c 89 f7             	mov    %r14,%rdi
+  801aa8:	ff d0                	call   *%rax
+}
+  801aaa:	48 83 c4 10          	add    $0x10,%rsp
+  801aae:	5b                   	pop    %rbx
+  801aaf:	41 5c                	pop    %r12
+  801ab1:	41 5d                	pop    %r13
+  801ab3:	41 5e                	pop    %r14
+  801ab5:	5d                   	pop    %rbp
+  801ab6:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801ab7:	48 98                	cltq
+  801ab9:	eb ef                	jmp    801aaa <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801abb:	48 98                	cltq
+  801abd:	eb eb                	jmp    801aaa <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801abf:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801ac6:	00 00 00 
+  801ac9:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+  801acf:	89 da                	mov    %ebx,%edx
+  801ad1:	48 bf 9d 33 80 00 00 	movabs $0x80339d,%rdi
+  801ad8:	00 00 00 
+  801adb:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ae0:	48 b9 62 02 80 00 00 	movabs $0x800262,%rcx
+  801ae7:	00 00 00 
+  801aea:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801aec:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801af3:	eb b5                	jmp    801aaa <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801af5:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801afc:	eb ac                	jmp    801aaa <write+0x65>
+
+0000000000801afe <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  801afe:	55                   	push   %rbp
+  801aff:	48 89 e5             	mov    %rsp,%rbp
+  801b02:	53                   	push   %rbx
+  801b03:	48 83 ec 18          	sub    $0x18,%rsp
+  801b07:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801b09:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801b0d:	48 b8 33 16 80 00 00 	movabs $0x801633,%rax
+  801b14:	00 00 00 
+  801b17:	ff d0                	call   *%rax
+  801b19:	85 c0                	test   %eax,%eax
+  801b1b:	78 0c                	js     801b29 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  801b1d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801b21:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  801b24:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801b29:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801b2d:	c9                   	leave
+  801b2e:	c3                   	ret
+
+0000000000801b2f <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  801b2f:	55                   	push   %rbp
+  801b30:	48 89 e5             	mov    %rsp,%rbp
+  801b33:	41 55                	push   %r13
+  801b35:	41 54                	push   %r12
+  801b37:	53                   	push   %rbx
+  801b38:	48 83 ec 18          	sub    $0x18,%rsp
+  801b3c:	89 fb                	mov    %edi,%ebx
+  801b3e:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801b41:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801b45:	48 b8 33 16 80 00 00 	movabs $0x801633,%rax
+  801b4c:	00 00 00 
+  801b4f:	ff d0                	call   *%rax
+  801b51:	85 c0                	test   %eax,%eax
+  801b53:	78 38                	js     801b8d <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801b55:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  801b59:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  801b5d:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801b61:	48 b8 7e 16 80 00 00 	movabs $0x80167e,%rax
+  801b68:	00 00 00 
+  801b6b:	ff d0                	call   *%rax
+  801b6d:	85 c0                	test   %eax,%eax
+  801b6f:	78 1c                	js     801b8d <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801b71:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  801b76:	74 20                	je     801b98 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801b78:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801b7c:	48 8b 40 30          	mov    0x30(%rax),%rax
+  801b80:	48 85 c0             	test   %rax,%rax
+  801b83:	74 47                	je     801bcc <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  801b85:	44 89 e6             	mov    %r12d,%esi
+  801b88:	4c 89 ef             	mov    %r13,%rdi
+  801b8b:	ff d0                	call   *%rax
+}
+  801b8d:	48 83 c4 18          	add    $0x18,%rsp
+  801b91:	5b                   	pop    %rbx
+  801b92:	41 5c                	pop    %r12
+  801b94:	41 5d                	pop    %r13
+  801b96:	5d                   	pop    %rbp
+  801b97:	c3                   	ret
+                thisenv->env_id, fdnum);
+  801b98:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  801b9f:	00 00 00 
+  801ba2:	8b b0 e0 00 00 00    	mov    0xe0(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801ba8:	89 da                	mov    %ebx,%edx
+  801baa:	48 bf 60 33 80 00 00 	movabs $0x803360,%rdi
+  801bb1:	00 00 00 
+  801bb4:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bb9:	48 b9 62 02 80 00 00 	movabs $0x800262,%rcx
+  801bc0:	00 00 00 
+  801bc3:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801bc5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801bca:	eb c1                	jmp    801b8d <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801bcc:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801bd1:	eb ba                	jmp    801b8d <ftruncate+0x5e>
+
+0000000000801bd3 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  801bd3:	55                   	push   %rbp
+  801bd4:	48 89 e5             	mov    %rsp,%rbp
+  801bd7:	41 54                	push   %r12
+  801bd9:	53                   	push   %rbx
+  801bda:	48 83 ec 10          	sub    $0x10,%rsp
+  801bde:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801be1:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801be5:	48 b8 33 16 80 00 00 	movabs $0x801633,%rax
+  801bec:	00 00 00 
+  801bef:	ff d0                	call   *%rax
+  801bf1:	85 c0                	test   %eax,%eax
+  801bf3:	78 4e                	js     801c43 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801bf5:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801bf9:	41 8b 3c 24          	mov    (%r12),%edi
+  801bfd:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801c01:	48 b8 7e 16 80 00 00 	movabs $0x80167e,%rax
+  801c08:	00 00 00 
+  801c0b:	ff d0                	call   *%rax
+  801c0d:	85 c0                	test   %eax,%eax
+  801c0f:	78 32                	js     801c43 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801c11:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801c15:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  801c1a:	74 30                	je     801c4c <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  801c1c:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  801c1f:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  801c26:	00 00 00 
+    stat->st_isdir = 0;
+  801c29:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  801c30:	00 00 00 
+    stat->st_dev = dev;
+  801c33:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  801c3a:	48 89 de             	mov    %rbx,%rsi
+  801c3d:	4c 89 e7             	mov    %r12,%rdi
+  801c40:	ff 50 28             	call   *0x28(%rax)
+}
+  801c43:	48 83 c4 10          	add    $0x10,%rsp
+  801c47:	5b                   	pop    %rbx
+  801c48:	41 5c                	pop    %r12
+  801c4a:	5d                   	pop    %rbp
+  801c4b:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801c4c:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801c51:	eb f0                	jmp    801c43 <fstat+0x70>
+
+0000000000801c53 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  801c53:	55                   	push   %rbp
+  801c54:	48 89 e5             	mov    %rsp,%rbp
+  801c57:	41 54                	push   %r12
+  801c59:	53                   	push   %rbx
+  801c5a:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  801c5d:	be 00 00 00 00       	mov    $0x0,%esi
+  801c62:	48 b8 36 20 80 00 00 	movabs $0x802036,%rax
+  801c69:	00 00 00 
+  801c6c:	ff d0                	call   *%rax
+  801c6e:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  801c70:	85 c0                	test   %eax,%eax
+  801c72:	78 25                	js     801c99 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  801c74:	4c 89 e6             	mov    %r12,%rsi
+  801c77:	89 c7                	mov    %eax,%edi
+  801c79:	48 b8 d3 1b 80 00 00 	movabs $0x801bd3,%rax
+  801c80:	00 00 00 
+  801c83:	ff d0                	call   *%rax
+  801c85:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  801c88:	89 df                	mov    %ebx,%edi
+  801c8a:	48 b8 98 17 80 00 00 	movabs $0x801798,%rax
+  801c91:	00 00 00 
+  801c94:	ff d0                	call   *%rax
+
+    return res;
+  801c96:	44 89 e3             	mov    %r12d,%ebx
+}
+  801c99:	89 d8                	mov    %ebx,%eax
+  801c9b:	5b                   	pop    %rbx
+  801c9c:	41 5c                	pop    %r12
+  801c9e:	5d                   	pop    %rbp
+  801c9f:	c3                   	ret
+
+0000000000801ca0 <fsipc>:
+ * response may be written back to fsipcbuf.
+ * type: request code, passed as the simple integer IPC value.
+ * dstva: virtual address at which to receive reply page, 0 if none.
+ * Returns result from the file server. */
+static int
+fsipc(unsigned type, void *dstva) {
+  801ca0:	55                   	push   %rbp
+  801ca1:	48 89 e5             	mov    %rsp,%rbp
+  801ca4:	41 54                	push   %r12
+  801ca6:	53                   	push   %rbx
+  801ca7:	48 83 ec 10          	sub    $0x10,%rsp
+  801cab:	41 89 fc             	mov    %edi,%r12d
+  801cae:	48 89 f3             	mov    %rsi,%rbx
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  801cb1:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  801cb8:	00 00 00 
+  801cbb:	83 38 00             	cmpl   $0x0,(%rax)
+  801cbe:	74 5e                	je     801d1e <fsipc+0x7e>
+    if (debug) {
+        cprintf("[%08x] fsipc %d %08x\n",
+                thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+    }
+
+    ipc_send(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW);
+  801cc0:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  801cc6:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  801ccb:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  801cd2:	00 00 00 
+  801cd5:	44 89 e6             	mov    %r12d,%esi
+  801cd8:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  801cdf:	00 00 00 
+  801ce2:	8b 38                	mov    (%rax),%edi
+  801ce4:	48 b8 40 2c 80 00 00 	movabs $0x802c40,%rax
+  801ceb:	00 00 00 
+  801cee:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  801cf0:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  801cf7:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  801cf8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801cfd:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  801d01:	48 89 de             	mov    %rbx,%rsi
+  801d04:	bf 00 00 00 00       	mov    $0x0,%edi
+  801d09:	48 b8 6b 2b 80 00 00 	movabs $0x802b6b,%rax
+  801d10:	00 00 00 
+  801d13:	ff d0                	call   *%rax
+}
+  801d15:	48 83 c4 10          	add    $0x10,%rsp
+  801d19:	5b                   	pop    %rbx
+  801d1a:	41 5c                	pop    %r12
+  801d1c:	5d                   	pop    %rbp
+  801d1d:	c3                   	ret
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  801d1e:	bf 03 00 00 00       	mov    $0x3,%edi
+  801d23:	48 b8 e3 2c 80 00 00 	movabs $0x802ce3,%rax
+  801d2a:	00 00 00 
+  801d2d:	ff d0                	call   *%rax
+  801d2f:	a3 00 70 80 00 00 00 	movabs %eax,0x807000
+  801d36:	00 00 
+  801d38:	eb 86                	jmp    801cc0 <fsipc+0x20>
+
+0000000000801d3a <devfile_trunc>:
+    return 0;
+}
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  801d3a:	55                   	push   %rbp
+  801d3b:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801d3e:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  801d45:	00 00 00 
+  801d48:	8b 57 0c             	mov    0xc(%rdi),%edx
+  801d4b:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  801d4d:	89 70 04             	mov    %esi,0x4(%rax)
+
+    return fsipc(FSREQ_SET_SIZE, NULL);
+  801d50:	be 00 00 00 00       	mov    $0x0,%esi
+  801d55:	bf 02 00 00 00       	mov    $0x2,%edi
+  801d5a:	48 b8 a0 1c 80 00 00 	movabs $0x801ca0,%rax
+  801d61:	00 00 00 
+  801d64:	ff d0                	call   *%rax
+}
+  801d66:	5d                   	pop    %rbp
+  801d67:	c3                   	ret
+
+0000000000801d68 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  801d68:	55                   	push   %rbp
+  801d69:	48 89 e5             	mov    %rsp,%rbp
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801d6c:	8b 47 0c             	mov    0xc(%rdi),%eax
+  801d6f:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  801d76:	00 00 
+    return fsipc(FSREQ_FLUSH, NULL);
+  801d78:	be 00 00 00 00       	mov    $0x0,%esi
+  801d7d:	bf 06 00 00 00       	mov    $0x6,%edi
+  801d82:	48 b8 a0 1c 80 00 00 	movabs $0x801ca0,%rax
+  801d89:	00 00 00 
+  801d8c:	ff d0                	call   *%rax
+}
+  801d8e:	5d                   	pop    %rbp
+  801d8f:	c3                   	ret
+
+0000000000801d90 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  801d90:	55                   	push   %rbp
+  801d91:	48 89 e5             	mov    %rsp,%rbp
+  801d94:	41 54                	push   %r12
+  801d96:	53                   	push   %rbx
+  801d97:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801d9a:	8b 47 0c             	mov    0xc(%rdi),%eax
+  801d9d:	a3 00 60 80 00 00 00 	movabs %eax,0x806000
+  801da4:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL);
+  801da6:	be 00 00 00 00       	mov    $0x0,%esi
+  801dab:	bf 05 00 00 00       	mov    $0x5,%edi
+  801db0:	48 b8 a0 1c 80 00 00 	movabs $0x801ca0,%rax
+  801db7:	00 00 00 
+  801dba:	ff d0                	call   *%rax
+    if (res < 0) {
+  801dbc:	85 c0                	test   %eax,%eax
+  801dbe:	78 3d                	js     801dfd <devfile_stat+0x6d>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801dc0:	49 bc 00 60 80 00 00 	movabs $0x806000,%r12
+  801dc7:	00 00 00 
+  801dca:	4c 89 e6             	mov    %r12,%rsi
+  801dcd:	48 89 df             	mov    %rbx,%rdi
+  801dd0:	48 b8 87 0b 80 00 00 	movabs $0x800b87,%rax
+  801dd7:	00 00 00 
+  801dda:	ff d0                	call   *%rax
+    st->st_size  = fsipcbuf.statRet.ret_size;
+  801ddc:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  801de3:	00 
+  801de4:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801dea:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  801df1:	00 
+  801df2:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  801df8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801dfd:	5b                   	pop    %rbx
+  801dfe:	41 5c                	pop    %r12
+  801e00:	5d                   	pop    %rbp
+  801e01:	c3                   	ret
+
+0000000000801e02 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  801e02:	55                   	push   %rbp
+  801e03:	48 89 e5             	mov    %rsp,%rbp
+  801e06:	41 57                	push   %r15
+  801e08:	41 56                	push   %r14
+  801e0a:	41 55                	push   %r13
+  801e0c:	41 54                	push   %r12
+  801e0e:	53                   	push   %rbx
+  801e0f:	48 83 ec 18          	sub    $0x18,%rsp
+  801e13:	49 89 fe             	mov    %rdi,%r14
+  801e16:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+  801e1a:	48 89 d3             	mov    %rdx,%rbx
+    while (n > sizeof(fsipcbuf.write.req_buf))
+  801e1d:	48 81 fa f0 0f 00 00 	cmp    $0xff0,%rdx
+  801e24:	0f 86 e4 00 00 00    	jbe    801f0e <devfile_write+0x10c>
+  801e2a:	49 89 f4             	mov    %rsi,%r12
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801e2d:	49 bd 00 60 80 00 00 	movabs $0x806000,%r13
+  801e34:	00 00 00 
+        memcpy(fsipcbuf.write.req_buf, buf, sizeof(fsipcbuf.write.req_buf));
+  801e37:	49 bf e8 0d 80 00 00 	movabs $0x800de8,%r15
+  801e3e:	00 00 00 
+  801e41:	eb 03                	jmp    801e46 <devfile_write+0x44>
+        buf += sizeof(fsipcbuf.write.req_buf);
+  801e43:	49 89 f4             	mov    %rsi,%r12
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801e46:	41 8b 46 0c          	mov    0xc(%r14),%eax
+  801e4a:	41 89 45 00          	mov    %eax,0x0(%r13)
+        fsipcbuf.write.req_n      = sizeof(fsipcbuf.write.req_buf);
+  801e4e:	49 c7 45 08 f0 0f 00 	movq   $0xff0,0x8(%r13)
+  801e55:	00 
+        memcpy(fsipcbuf.write.req_buf, buf, sizeof(fsipcbuf.write.req_buf));
+  801e56:	ba f0 0f 00 00       	mov    $0xff0,%edx
+  801e5b:	4c 89 e6             	mov    %r12,%rsi
+  801e5e:	48 bf 10 60 80 00 00 	movabs $0x806010,%rdi
+  801e65:	00 00 00 
+  801e68:	41 ff d7             	call   *%r15
+        ssize_t res = fsipc(FSREQ_WRITE, NULL);
+  801e6b:	be 00 00 00 00       	mov    $0x0,%esi
+  801e70:	bf 04 00 00 00       	mov    $0x4,%edi
+  801e75:	48 b8 a0 1c 80 00 00 	movabs $0x801ca0,%rax
+  801e7c:	00 00 00 
+  801e7f:	ff d0                	call   *%rax
+  801e81:	48 63 d0             	movslq %eax,%rdx
+        if (res < 0 || res < sizeof(fsipcbuf.write.req_buf))
+  801e84:	3d ef 0f 00 00       	cmp    $0xfef,%eax
+  801e89:	7e 71                	jle    801efc <devfile_write+0xfa>
+        buf += sizeof(fsipcbuf.write.req_buf);
+  801e8b:	49 8d b4 24 f0 0f 00 	lea    0xff0(%r12),%rsi
+  801e92:	00 
+        n -= sizeof(fsipcbuf.write.req_buf);
+  801e93:	48 81 eb f0 0f 00 00 	sub    $0xff0,%rbx
+    while (n > sizeof(fsipcbuf.write.req_buf))
+  801e9a:	48 81 fb f0 0f 00 00 	cmp    $0xff0,%rbx
+  801ea1:	77 a0                	ja     801e43 <devfile_write+0x41>
+        written += sizeof(fsipcbuf.write.req_buf);
+  801ea3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801ea7:	49 29 c4             	sub    %rax,%r12
+  801eaa:	4d 8d a4 24 f0 0f 00 	lea    0xff0(%r12),%r12
+  801eb1:	00 
+    fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801eb2:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  801eb9:	00 00 00 
+  801ebc:	41 8b 56 0c          	mov    0xc(%r14),%edx
+  801ec0:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.write.req_n      = n;
+  801ec2:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    memcpy(fsipcbuf.write.req_buf, buf, n);
+  801ec6:	48 89 da             	mov    %rbx,%rdx
+  801ec9:	48 8d 78 10          	lea    0x10(%rax),%rdi
+  801ecd:	48 b8 e8 0d 80 00 00 	movabs $0x800de8,%rax
+  801ed4:	00 00 00 
+  801ed7:	ff d0                	call   *%rax
+    ssize_t res = fsipc(FSREQ_WRITE, NULL);
+  801ed9:	be 00 00 00 00       	mov    $0x0,%esi
+  801ede:	bf 04 00 00 00       	mov    $0x4,%edi
+  801ee3:	48 b8 a0 1c 80 00 00 	movabs $0x801ca0,%rax
+  801eea:	00 00 00 
+  801eed:	ff d0                	call   *%rax
+  801eef:	48 63 d0             	movslq %eax,%rdx
+    written += res;
+  801ef2:	49 01 d4             	add    %rdx,%r12
+  801ef5:	48 85 d2             	test   %rdx,%rdx
+  801ef8:	49 0f 49 d4          	cmovns %r12,%rdx
+}
+  801efc:	48 89 d0             	mov    %rdx,%rax
+  801eff:	48 83 c4 18          	add    $0x18,%rsp
+  801f03:	5b                   	pop    %rbx
+  801f04:	41 5c                	pop    %r12
+  801f06:	41 5d                	pop    %r13
+  801f08:	41 5e                	pop    %r14
+  801f0a:	41 5f                	pop    %r15
+  801f0c:	5d                   	pop    %rbp
+  801f0d:	c3                   	ret
+    while (n > sizeof(fsipcbuf.write.req_buf))
+  801f0e:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+    ssize_t written = 0;
+  801f12:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  801f18:	eb 98                	jmp    801eb2 <devfile_write+0xb0>
+
+0000000000801f1a <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  801f1a:	55                   	push   %rbp
+  801f1b:	48 89 e5             	mov    %rsp,%rbp
+  801f1e:	41 57                	push   %r15
+  801f20:	41 56                	push   %r14
+  801f22:	41 55                	push   %r13
+  801f24:	41 54                	push   %r12
+  801f26:	53                   	push   %rbx
+  801f27:	48 83 ec 18          	sub    $0x18,%rsp
+  801f2b:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  801f2f:	49 89 f6             	mov    %rsi,%r14
+  801f32:	49 89 d4             	mov    %rdx,%r12
+    while (n > sizeof(fsipcbuf.readRet.ret_buf))
+  801f35:	48 81 fa 00 10 00 00 	cmp    $0x1000,%rdx
+  801f3c:	0f 86 ea 00 00 00    	jbe    80202c <devfile_read+0x112>
+    ssize_t readsz = 0;
+  801f42:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  801f49:	00 
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801f4a:	49 bf 00 60 80 00 00 	movabs $0x806000,%r15
+  801f51:	00 00 00 
+  801f54:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801f58:	8b 40 0c             	mov    0xc(%rax),%eax
+  801f5b:	41 89 07             	mov    %eax,(%r15)
+        fsipcbuf.read.req_n = sizeof(fsipcbuf.readRet.ret_buf);
+  801f5e:	49 c7 47 08 00 10 00 	movq   $0x1000,0x8(%r15)
+  801f65:	00 
+        ssize_t res = fsipc(FSREQ_READ, NULL);
+  801f66:	be 00 00 00 00       	mov    $0x0,%esi
+  801f6b:	bf 03 00 00 00       	mov    $0x3,%edi
+  801f70:	48 b8 a0 1c 80 00 00 	movabs $0x801ca0,%rax
+  801f77:	00 00 00 
+  801f7a:	ff d0                	call   *%rax
+  801f7c:	4c 63 e8             	movslq %eax,%r13
+        if (res < 0)
+  801f7f:	4d 85 ed             	test   %r13,%r13
+  801f82:	0f 88 92 00 00 00    	js     80201a <devfile_read+0x100>
+        memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  801f88:	4c 89 ea             	mov    %r13,%rdx
+  801f8b:	4c 89 fe             	mov    %r15,%rsi
+  801f8e:	4c 89 f7             	mov    %r14,%rdi
+  801f91:	48 b8 e8 0d 80 00 00 	movabs $0x800de8,%rax
+  801f98:	00 00 00 
+  801f9b:	ff d0                	call   *%rax
+        if (res < sizeof(fsipcbuf.readRet.ret_buf))
+  801f9d:	49 81 fd ff 0f 00 00 	cmp    $0xfff,%r13
+  801fa4:	76 6d                	jbe    802013 <devfile_read+0xf9>
+        readsz += res;
+  801fa6:	4c 01 6d c0          	add    %r13,-0x40(%rbp)
+        buf += res;
+  801faa:	4d 01 ee             	add    %r13,%r14
+        n -= res;
+  801fad:	4d 29 ec             	sub    %r13,%r12
+    while (n > sizeof(fsipcbuf.readRet.ret_buf))
+  801fb0:	49 81 fc 00 10 00 00 	cmp    $0x1000,%r12
+  801fb7:	77 9b                	ja     801f54 <devfile_read+0x3a>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801fb9:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  801fc0:	00 00 00 
+  801fc3:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  801fc7:	8b 51 0c             	mov    0xc(%rcx),%edx
+  801fca:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.read.req_n = n;
+  801fcc:	4c 89 60 08          	mov    %r12,0x8(%rax)
+    ssize_t res = fsipc(FSREQ_READ, NULL);
+  801fd0:	be 00 00 00 00       	mov    $0x0,%esi
+  801fd5:	bf 03 00 00 00       	mov    $0x3,%edi
+  801fda:	48 b8 a0 1c 80 00 00 	movabs $0x801ca0,%rax
+  801fe1:	00 00 00 
+  801fe4:	ff d0                	call   *%rax
+  801fe6:	4c 63 e8             	movslq %eax,%r13
+    if (res < 0)
+  801fe9:	4d 85 ed             	test   %r13,%r13
+  801fec:	78 2c                	js     80201a <devfile_read+0x100>
+    memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  801fee:	4c 89 ea             	mov    %r13,%rdx
+  801ff1:	48 be 00 60 80 00 00 	movabs $0x806000,%rsi
+  801ff8:	00 00 00 
+  801ffb:	4c 89 f7             	mov    %r14,%rdi
+  801ffe:	48 b8 e8 0d 80 00 00 	movabs $0x800de8,%rax
+  802005:	00 00 00 
+  802008:	ff d0                	call   *%rax
+    readsz += res;
+  80200a:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80200e:	49 01 c5             	add    %rax,%r13
+    return readsz;
+  802011:	eb 07                	jmp    80201a <devfile_read+0x100>
+            return readsz + res;
+  802013:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802017:	49 01 c5             	add    %rax,%r13
+}
+  80201a:	4c 89 e8             	mov    %r13,%rax
+  80201d:	48 83 c4 18          	add    $0x18,%rsp
+  802021:	5b                   	pop    %rbx
+  802022:	41 5c                	pop    %r12
+  802024:	41 5d                	pop    %r13
+  802026:	41 5e                	pop    %r14
+  802028:	41 5f                	pop    %r15
+  80202a:	5d                   	pop    %rbp
+  80202b:	c3                   	ret
+    ssize_t readsz = 0;
+  80202c:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  802033:	00 
+  802034:	eb 83                	jmp    801fb9 <devfile_read+0x9f>
+
+0000000000802036 <open>:
+open(const char *path, int mode) {
+  802036:	55                   	push   %rbp
+  802037:	48 89 e5             	mov    %rsp,%rbp
+  80203a:	41 55                	push   %r13
+  80203c:	41 54                	push   %r12
+  80203e:	53                   	push   %rbx
+  80203f:	48 83 ec 18          	sub    $0x18,%rsp
+  802043:	49 89 fc             	mov    %rdi,%r12
+  802046:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  802049:	48 b8 49 0b 80 00 00 	movabs $0x800b49,%rax
+  802050:	00 00 00 
+  802053:	ff d0                	call   *%rax
+  802055:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  80205b:	0f 87 8a 00 00 00    	ja     8020eb <open+0xb5>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802061:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802065:	48 b8 19 16 80 00 00 	movabs $0x801619,%rax
+  80206c:	00 00 00 
+  80206f:	ff d0                	call   *%rax
+  802071:	89 c3                	mov    %eax,%ebx
+  802073:	85 c0                	test   %eax,%eax
+  802075:	78 50                	js     8020c7 <open+0x91>
+    strcpy(fsipcbuf.open.req_path, path);
+  802077:	4c 89 e6             	mov    %r12,%rsi
+  80207a:	48 bb 00 60 80 00 00 	movabs $0x806000,%rbx
+  802081:	00 00 00 
+  802084:	48 89 df             	mov    %rbx,%rdi
+  802087:	48 b8 87 0b 80 00 00 	movabs $0x800b87,%rax
+  80208e:	00 00 00 
+  802091:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  802093:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  80209a:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  80209e:	bf 01 00 00 00       	mov    $0x1,%edi
+  8020a3:	48 b8 a0 1c 80 00 00 	movabs $0x801ca0,%rax
+  8020aa:	00 00 00 
+  8020ad:	ff d0                	call   *%rax
+  8020af:	89 c3                	mov    %eax,%ebx
+  8020b1:	85 c0                	test   %eax,%eax
+  8020b3:	78 1f                	js     8020d4 <open+0x9e>
+    return fd2num(fd);
+  8020b5:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8020b9:	48 b8 72 15 80 00 00 	movabs $0x801572,%rax
+  8020c0:	00 00 00 
+  8020c3:	ff d0                	call   *%rax
+  8020c5:	89 c3                	mov    %eax,%ebx
+}
+  8020c7:	89 d8                	mov    %ebx,%eax
+  8020c9:	48 83 c4 18          	add    $0x18,%rsp
+  8020cd:	5b                   	pop    %rbx
+  8020ce:	41 5c                	pop    %r12
+  8020d0:	41 5d                	pop    %r13
+  8020d2:	5d                   	pop    %rbp
+  8020d3:	c3                   	ret
+        fd_close(fd, 0);
+  8020d4:	be 00 00 00 00       	mov    $0x0,%esi
+  8020d9:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8020dd:	48 b8 ee 16 80 00 00 	movabs $0x8016ee,%rax
+  8020e4:	00 00 00 
+  8020e7:	ff d0                	call   *%rax
+        return res;
+  8020e9:	eb dc                	jmp    8020c7 <open+0x91>
+        return -E_BAD_PATH;
+  8020eb:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  8020f0:	eb d5                	jmp    8020c7 <open+0x91>
+
+00000000008020f2 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  8020f2:	55                   	push   %rbp
+  8020f3:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc(FSREQ_SYNC, NULL);
+  8020f6:	be 00 00 00 00       	mov    $0x0,%esi
+  8020fb:	bf 08 00 00 00       	mov    $0x8,%edi
+  802100:	48 b8 a0 1c 80 00 00 	movabs $0x801ca0,%rax
+  802107:	00 00 00 
+  80210a:	ff d0                	call   *%rax
+}
+  80210c:	5d                   	pop    %rbp
+  80210d:	c3                   	ret
+
+000000000080210e <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  80210e:	55                   	push   %rbp
+  80210f:	48 89 e5             	mov    %rsp,%rbp
+  802112:	41 54                	push   %r12
+  802114:	53                   	push   %rbx
+  802115:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802118:	48 b8 84 15 80 00 00 	movabs $0x801584,%rax
+  80211f:	00 00 00 
+  802122:	ff d0                	call   *%rax
+  802124:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  802127:	48 be e0 33 80 00 00 	movabs $0x8033e0,%rsi
+  80212e:	00 00 00 
+  802131:	48 89 df             	mov    %rbx,%rdi
+  802134:	48 b8 87 0b 80 00 00 	movabs $0x800b87,%rax
+  80213b:	00 00 00 
+  80213e:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  802140:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  802145:	41 2b 04 24          	sub    (%r12),%eax
+  802149:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  80214f:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  802156:	00 00 00 
+    stat->st_dev = &devpipe;
+  802159:	48 b8 60 40 80 00 00 	movabs $0x804060,%rax
+  802160:	00 00 00 
+  802163:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  80216a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80216f:	5b                   	pop    %rbx
+  802170:	41 5c                	pop    %r12
+  802172:	5d                   	pop    %rbp
+  802173:	c3                   	ret
+
+0000000000802174 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  802174:	55                   	push   %rbp
+  802175:	48 89 e5             	mov    %rsp,%rbp
+  802178:	41 54                	push   %r12
+  80217a:	53                   	push   %rbx
+  80217b:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  80217e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802183:	48 89 fe             	mov    %rdi,%rsi
+  802186:	bf 00 00 00 00       	mov    $0x0,%edi
+  80218b:	49 bc 03 12 80 00 00 	movabs $0x801203,%r12
+  802192:	00 00 00 
+  802195:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  802198:	48 89 df             	mov    %rbx,%rdi
+  80219b:	48 b8 84 15 80 00 00 	movabs $0x801584,%rax
+  8021a2:	00 00 00 
+  8021a5:	ff d0                	call   *%rax
+  8021a7:	48 89 c6             	mov    %rax,%rsi
+  8021aa:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8021af:	bf 00 00 00 00       	mov    $0x0,%edi
+  8021b4:	41 ff d4             	call   *%r12
+}
+  8021b7:	5b                   	pop    %rbx
+  8021b8:	41 5c                	pop    %r12
+  8021ba:	5d                   	pop    %rbp
+  8021bb:	c3                   	ret
+
+00000000008021bc <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8021bc:	55                   	push   %rbp
+  8021bd:	48 89 e5             	mov    %rsp,%rbp
+  8021c0:	41 57                	push   %r15
+  8021c2:	41 56                	push   %r14
+  8021c4:	41 55                	push   %r13
+  8021c6:	41 54                	push   %r12
+  8021c8:	53                   	push   %rbx
+  8021c9:	48 83 ec 18          	sub    $0x18,%rsp
+  8021cd:	49 89 fc             	mov    %rdi,%r12
+  8021d0:	49 89 f5             	mov    %rsi,%r13
+  8021d3:	49 89 d7             	mov    %rdx,%r15
+  8021d6:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8021da:	48 b8 84 15 80 00 00 	movabs $0x801584,%rax
+  8021e1:	00 00 00 
+  8021e4:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  8021e6:	4d 85 ff             	test   %r15,%r15
+  8021e9:	0f 84 af 00 00 00    	je     80229e <devpipe_write+0xe2>
+  8021ef:	48 89 c3             	mov    %rax,%rbx
+  8021f2:	4c 89 f8             	mov    %r15,%rax
+  8021f5:	4d 89 ef             	mov    %r13,%r15
+  8021f8:	4c 01 e8             	add    %r13,%rax
+  8021fb:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8021ff:	49 bd 0b 11 80 00 00 	movabs $0x80110b,%r13
+  802206:	00 00 00 
+            sys_yield();
+  802209:	49 be a8 10 80 00 00 	movabs $0x8010a8,%r14
+  802210:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  802213:	8b 73 04             	mov    0x4(%rbx),%esi
+  802216:	48 63 ce             	movslq %esi,%rcx
+  802219:	48 63 03             	movslq (%rbx),%rax
+  80221c:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  802222:	48 39 c1             	cmp    %rax,%rcx
+  802225:	72 2e                	jb     802255 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802227:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80222c:	48 89 da             	mov    %rbx,%rdx
+  80222f:	be 00 10 00 00       	mov    $0x1000,%esi
+  802234:	4c 89 e7             	mov    %r12,%rdi
+  802237:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  80223a:	85 c0                	test   %eax,%eax
+  80223c:	74 66                	je     8022a4 <devpipe_write+0xe8>
+            sys_yield();
+  80223e:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  802241:	8b 73 04             	mov    0x4(%rbx),%esi
+  802244:	48 63 ce             	movslq %esi,%rcx
+  802247:	48 63 03             	movslq (%rbx),%rax
+  80224a:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  802250:	48 39 c1             	cmp    %rax,%rcx
+  802253:	73 d2                	jae    802227 <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  802255:	41 0f b6 3f          	movzbl (%r15),%edi
+  802259:	48 89 ca             	mov    %rcx,%rdx
+  80225c:	48 c1 ea 03          	shr    $0x3,%rdx
+  802260:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  802267:	08 10 20 
+  80226a:	48 f7 e2             	mul    %rdx
+  80226d:	48 c1 ea 06          	shr    $0x6,%rdx
+  802271:	48 89 d0             	mov    %rdx,%rax
+  802274:	48 c1 e0 09          	shl    $0x9,%rax
+  802278:	48 29 d0             	sub    %rdx,%rax
+  80227b:	48 c1 e0 03          	shl    $0x3,%rax
+  80227f:	48 29 c1             	sub    %rax,%rcx
+  802282:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  802287:	83 c6 01             	add    $0x1,%esi
+  80228a:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  80228d:	49 83 c7 01          	add    $0x1,%r15
+  802291:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802295:	49 39 c7             	cmp    %rax,%r15
+  802298:	0f 85 75 ff ff ff    	jne    802213 <devpipe_write+0x57>
+    return n;
+  80229e:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8022a2:	eb 05                	jmp    8022a9 <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  8022a4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8022a9:	48 83 c4 18          	add    $0x18,%rsp
+  8022ad:	5b                   	pop    %rbx
+  8022ae:	41 5c                	pop    %r12
+  8022b0:	41 5d                	pop    %r13
+  8022b2:	41 5e                	pop    %r14
+  8022b4:	41 5f                	pop    %r15
+  8022b6:	5d                   	pop    %rbp
+  8022b7:	c3                   	ret
+
+00000000008022b8 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  8022b8:	55                   	push   %rbp
+  8022b9:	48 89 e5             	mov    %rsp,%rbp
+  8022bc:	41 57                	push   %r15
+  8022be:	41 56                	push   %r14
+  8022c0:	41 55                	push   %r13
+  8022c2:	41 54                	push   %r12
+  8022c4:	53                   	push   %rbx
+  8022c5:	48 83 ec 18          	sub    $0x18,%rsp
+  8022c9:	49 89 fc             	mov    %rdi,%r12
+  8022cc:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  8022d0:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8022d4:	48 b8 84 15 80 00 00 	movabs $0x801584,%rax
+  8022db:	00 00 00 
+  8022de:	ff d0                	call   *%rax
+  8022e0:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  8022e3:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8022e9:	49 bd 0b 11 80 00 00 	movabs $0x80110b,%r13
+  8022f0:	00 00 00 
+            sys_yield();
+  8022f3:	49 be a8 10 80 00 00 	movabs $0x8010a8,%r14
+  8022fa:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  8022fd:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  802302:	74 7d                	je     802381 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  802304:	8b 03                	mov    (%rbx),%eax
+  802306:	3b 43 04             	cmp    0x4(%rbx),%eax
+  802309:	75 26                	jne    802331 <devpipe_read+0x79>
+            if (i > 0) return i;
+  80230b:	4d 85 ff             	test   %r15,%r15
+  80230e:	75 77                	jne    802387 <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802310:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802315:	48 89 da             	mov    %rbx,%rdx
+  802318:	be 00 10 00 00       	mov    $0x1000,%esi
+  80231d:	4c 89 e7             	mov    %r12,%rdi
+  802320:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  802323:	85 c0                	test   %eax,%eax
+  802325:	74 72                	je     802399 <devpipe_read+0xe1>
+            sys_yield();
+  802327:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  80232a:	8b 03                	mov    (%rbx),%eax
+  80232c:	3b 43 04             	cmp    0x4(%rbx),%eax
+  80232f:	74 df                	je     802310 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802331:	48 63 c8             	movslq %eax,%rcx
+  802334:	48 89 ca             	mov    %rcx,%rdx
+  802337:	48 c1 ea 03          	shr    $0x3,%rdx
+  80233b:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  802342:	08 10 20 
+  802345:	48 89 d0             	mov    %rdx,%rax
+  802348:	48 f7 e6             	mul    %rsi
+  80234b:	48 c1 ea 06          	shr    $0x6,%rdx
+  80234f:	48 89 d0             	mov    %rdx,%rax
+  802352:	48 c1 e0 09          	shl    $0x9,%rax
+  802356:	48 29 d0             	sub    %rdx,%rax
+  802359:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  802360:	00 
+  802361:	48 89 c8             	mov    %rcx,%rax
+  802364:	48 29 d0             	sub    %rdx,%rax
+  802367:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  80236c:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  802370:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  802374:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  802377:	49 83 c7 01          	add    $0x1,%r15
+  80237b:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  80237f:	75 83                	jne    802304 <devpipe_read+0x4c>
+    return n;
+  802381:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802385:	eb 03                	jmp    80238a <devpipe_read+0xd2>
+            if (i > 0) return i;
+  802387:	4c 89 f8             	mov    %r15,%rax
+}
+  80238a:	48 83 c4 18          	add    $0x18,%rsp
+  80238e:	5b                   	pop    %rbx
+  80238f:	41 5c                	pop    %r12
+  802391:	41 5d                	pop    %r13
+  802393:	41 5e                	pop    %r14
+  802395:	41 5f                	pop    %r15
+  802397:	5d                   	pop    %rbp
+  802398:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  802399:	b8 00 00 00 00       	mov    $0x0,%eax
+  80239e:	eb ea                	jmp    80238a <devpipe_read+0xd2>
+
+00000000008023a0 <pipe>:
+pipe(int pfd[2]) {
+  8023a0:	55                   	push   %rbp
+  8023a1:	48 89 e5             	mov    %rsp,%rbp
+  8023a4:	41 55                	push   %r13
+  8023a6:	41 54                	push   %r12
+  8023a8:	53                   	push   %rbx
+  8023a9:	48 81 ec b8 00 00 00 	sub    $0xb8,%rsp
+  8023b0:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8023b3:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  8023b7:	48 b8 19 16 80 00 00 	movabs $0x801619,%rax
+  8023be:	00 00 00 
+  8023c1:	ff d0                	call   *%rax
+  8023c3:	89 c3                	mov    %eax,%ebx
+  8023c5:	85 c0                	test   %eax,%eax
+  8023c7:	0f 88 51 01 00 00    	js     80251e <pipe+0x17e>
+        (res = fd_alloc_from(fd2num(fd0) + 1, &fd1)) < 0) goto err;
+  8023cd:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8023d1:	48 b8 72 15 80 00 00 	movabs $0x801572,%rax
+  8023d8:	00 00 00 
+  8023db:	ff d0                	call   *%rax
+  8023dd:	8d 78 01             	lea    0x1(%rax),%edi
+  8023e0:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8023e4:	48 b8 a0 15 80 00 00 	movabs $0x8015a0,%rax
+  8023eb:	00 00 00 
+  8023ee:	ff d0                	call   *%rax
+  8023f0:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8023f2:	85 c0                	test   %eax,%eax
+  8023f4:	0f 88 24 01 00 00    	js     80251e <pipe+0x17e>
+    va = fd2data(fd0);
+  8023fa:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8023fe:	48 bb 84 15 80 00 00 	movabs $0x801584,%rbx
+  802405:	00 00 00 
+  802408:	ff d3                	call   *%rbx
+  80240a:	49 89 c5             	mov    %rax,%r13
+    struct RegionOp ops[] = {
+  80240d:	48 8d bd 30 ff ff ff 	lea    -0xd0(%rbp),%rdi
+  802414:	b9 14 00 00 00       	mov    $0x14,%ecx
+  802419:	b8 00 00 00 00       	mov    $0x0,%eax
+  80241e:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+  802421:	c7 85 34 ff ff ff 46 	movl   $0x46,-0xcc(%rbp)
+  802428:	00 00 00 
+  80242b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80242f:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+  802436:	48 c7 85 50 ff ff ff 	movq   $0x1000,-0xb0(%rbp)
+  80243d:	00 10 00 00 
+  802441:	c7 85 5c ff ff ff 46 	movl   $0x46,-0xa4(%rbp)
+  802448:	00 00 00 
+            {.type = REGION_ALLOC, .dstva = (uintptr_t)fd1, .size = PAGE_SIZE, .perm = PROT_RW | PROT_SHARE},
+  80244b:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+    struct RegionOp ops[] = {
+  80244f:	48 89 bd 70 ff ff ff 	mov    %rdi,-0x90(%rbp)
+  802456:	48 c7 85 78 ff ff ff 	movq   $0x1000,-0x88(%rbp)
+  80245d:	00 10 00 00 
+  802461:	c7 45 84 46 00 00 00 	movl   $0x46,-0x7c(%rbp)
+  802468:	4c 89 6d 98          	mov    %r13,-0x68(%rbp)
+  80246c:	48 c7 45 a0 00 10 00 	movq   $0x1000,-0x60(%rbp)
+  802473:	00 
+  802474:	c7 45 a8 01 00 00 00 	movl   $0x1,-0x58(%rbp)
+  80247b:	c7 45 ac 46 00 00 00 	movl   $0x46,-0x54(%rbp)
+  802482:	4c 89 6d b8          	mov    %r13,-0x48(%rbp)
+            {.type = REGION_MAP, .srcva = (uintptr_t)va, .dstva = (uintptr_t)fd2data(fd1), .size = PAGE_SIZE, .perm = PROT_RW | PROT_SHARE},
+  802486:	ff d3                	call   *%rbx
+    struct RegionOp ops[] = {
+  802488:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80248c:	48 c7 45 c8 00 10 00 	movq   $0x1000,-0x38(%rbp)
+  802493:	00 
+    if ((res = sys_region_batch(ops, sizeof ops / sizeof *ops)) < 0) goto err1;
+  802494:	be 04 00 00 00       	mov    $0x4,%esi
+  802499:	48 8d bd 30 ff ff ff 	lea    -0xd0(%rbp),%rdi
+  8024a0:	48 b8 6a 12 80 00 00 	movabs $0x80126a,%rax
+  8024a7:	00 00 00 
+  8024aa:	ff d0                	call   *%rax
+  8024ac:	89 c3                	mov    %eax,%ebx
+  8024ae:	85 c0                	test   %eax,%eax
+  8024b0:	0f 88 ad 00 00 00    	js     802563 <pipe+0x1c3>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8024b6:	be 00 10 00 00       	mov    $0x1000,%esi
+  8024bb:	4c 89 ef             	mov    %r13,%rdi
+  8024be:	48 b8 d9 10 80 00 00 	movabs $0x8010d9,%rax
+  8024c5:	00 00 00 
+  8024c8:	ff d0                	call   *%rax
+  8024ca:	83 f8 02             	cmp    $0x2,%eax
+  8024cd:	75 5f                	jne    80252e <pipe+0x18e>
+    fd0->fd_dev_id = devpipe.dev_id;
+  8024cf:	a1 60 40 80 00 00 00 	movabs 0x804060,%eax
+  8024d6:	00 00 
+  8024d8:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8024dc:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  8024de:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8024e2:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  8024e9:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8024ed:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  8024ef:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8024f3:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  8024fa:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8024fe:	48 bb 72 15 80 00 00 	movabs $0x801572,%rbx
+  802505:	00 00 00 
+  802508:	ff d3                	call   *%rbx
+  80250a:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  80250e:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  802512:	ff d3                	call   *%rbx
+  802514:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  802519:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  80251e:	89 d8                	mov    %ebx,%eax
+  802520:	48 81 c4 b8 00 00 00 	add    $0xb8,%rsp
+  802527:	5b                   	pop    %rbx
+  802528:	41 5c                	pop    %r12
+  80252a:	41 5d                	pop    %r13
+  80252c:	5d                   	pop    %rbp
+  80252d:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  80252e:	48 b9 10 34 80 00 00 	movabs $0x803410,%rcx
+  802535:	00 00 00 
+  802538:	48 ba e7 33 80 00 00 	movabs $0x8033e7,%rdx
+  80253f:	00 00 00 
+  802542:	be 33 00 00 00       	mov    $0x33,%esi
+  802547:	48 bf fc 33 80 00 00 	movabs $0x8033fc,%rdi
+  80254e:	00 00 00 
+  802551:	b8 00 00 00 00       	mov    $0x0,%eax
+  802556:	49 b8 c8 2a 80 00 00 	movabs $0x802ac8,%r8
+  80255d:	00 00 00 
+  802560:	41 ff d0             	call   *%r8
+        ops[i].type = REGION_UNMAP;
+  802563:	c7 85 30 ff ff ff 02 	movl   $0x2,-0xd0(%rbp)
+  80256a:	00 00 00 
+  80256d:	c7 85 58 ff ff ff 02 	movl   $0x2,-0xa8(%rbp)
+  802574:	00 00 00 
+  802577:	c7 45 80 02 00 00 00 	movl   $0x2,-0x80(%rbp)
+  80257e:	c7 45 a8 02 00 00 00 	movl   $0x2,-0x58(%rbp)
+    sys_region_batch(ops, sizeof ops / sizeof *ops);
+  802585:	be 04 00 00 00       	mov    $0x4,%esi
+  80258a:	48 8d bd 30 ff ff ff 	lea    -0xd0(%rbp),%rdi
+  802591:	48 b8 6a 12 80 00 00 	movabs $0x80126a,%rax
+  802598:	00 00 00 
+  80259b:	ff d0                	call   *%rax
+  80259d:	e9 7c ff ff ff       	jmp    80251e <pipe+0x17e>
+
+00000000008025a2 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  8025a2:	55                   	push   %rbp
+  8025a3:	48 89 e5             	mov    %rsp,%rbp
+  8025a6:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8025aa:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8025ae:	48 b8 33 16 80 00 00 	movabs $0x801633,%rax
+  8025b5:	00 00 00 
+  8025b8:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8025ba:	85 c0                	test   %eax,%eax
+  8025bc:	78 35                	js     8025f3 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  8025be:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8025c2:	48 b8 84 15 80 00 00 	movabs $0x801584,%rax
+  8025c9:	00 00 00 
+  8025cc:	ff d0                	call   *%rax
+  8025ce:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8025d1:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8025d6:	be 00 10 00 00       	mov    $0x1000,%esi
+  8025db:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8025df:	48 b8 0b 11 80 00 00 	movabs $0x80110b,%rax
+  8025e6:	00 00 00 
+  8025e9:	ff d0                	call   *%rax
+  8025eb:	85 c0                	test   %eax,%eax
+  8025ed:	0f 94 c0             	sete   %al
+  8025f0:	0f b6 c0             	movzbl %al,%eax
+}
+  8025f3:	c9                   	leave
+  8025f4:	c3                   	ret
+
+00000000008025f5 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8025f5:	48 89 f8             	mov    %rdi,%rax
+  8025f8:	48 c1 e8 27          	shr    $0x27,%rax
+  8025fc:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  802603:	01 00 00 
+  802606:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80260a:	f6 c2 01             	test   $0x1,%dl
+  80260d:	74 6d                	je     80267c <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  80260f:	48 89 f8             	mov    %rdi,%rax
+  802612:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802616:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  80261d:	01 00 00 
+  802620:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802624:	f6 c2 01             	test   $0x1,%dl
+  802627:	74 62                	je     80268b <get_uvpt_entry+0x96>
+  802629:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802630:	01 00 00 
+  802633:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802637:	f6 c2 80             	test   $0x80,%dl
+  80263a:	75 4f                	jne    80268b <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  80263c:	48 89 f8             	mov    %rdi,%rax
+  80263f:	48 c1 e8 15          	shr    $0x15,%rax
+  802643:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  80264a:	01 00 00 
+  80264d:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802651:	f6 c2 01             	test   $0x1,%dl
+  802654:	74 44                	je     80269a <get_uvpt_entry+0xa5>
+  802656:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  80265d:	01 00 00 
+  802660:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802664:	f6 c2 80             	test   $0x80,%dl
+  802667:	75 31                	jne    80269a <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  802669:	48 c1 ef 0c          	shr    $0xc,%rdi
+  80266d:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802674:	01 00 00 
+  802677:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  80267b:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  80267c:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  802683:	01 00 00 
+  802686:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80268a:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  80268b:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802692:	01 00 00 
+  802695:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802699:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  80269a:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8026a1:	01 00 00 
+  8026a4:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8026a8:	c3                   	ret
+
+00000000008026a9 <get_prot>:
+
+int
+get_prot(void *va) {
+  8026a9:	55                   	push   %rbp
+  8026aa:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8026ad:	48 b8 f5 25 80 00 00 	movabs $0x8025f5,%rax
+  8026b4:	00 00 00 
+  8026b7:	ff d0                	call   *%rax
+  8026b9:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  8026bc:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  8026c1:	89 c1                	mov    %eax,%ecx
+  8026c3:	83 c9 04             	or     $0x4,%ecx
+  8026c6:	f6 c2 01             	test   $0x1,%dl
+  8026c9:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  8026cc:	89 c1                	mov    %eax,%ecx
+  8026ce:	83 c9 02             	or     $0x2,%ecx
+  8026d1:	f6 c2 02             	test   $0x2,%dl
+  8026d4:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  8026d7:	89 c1                	mov    %eax,%ecx
+  8026d9:	83 c9 01             	or     $0x1,%ecx
+  8026dc:	48 85 d2             	test   %rdx,%rdx
+  8026df:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  8026e2:	89 c1                	mov    %eax,%ecx
+  8026e4:	83 c9 40             	or     $0x40,%ecx
+  8026e7:	f6 c6 04             	test   $0x4,%dh
+  8026ea:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  8026ed:	5d                   	pop    %rbp
+  8026ee:	c3                   	ret
+
+00000000008026ef <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  8026ef:	55                   	push   %rbp
+  8026f0:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8026f3:	48 b8 f5 25 80 00 00 	movabs $0x8025f5,%rax
+  8026fa:	00 00 00 
+  8026fd:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  8026ff:	48 c1 e8 06          	shr    $0x6,%rax
+  802703:	83 e0 01             	and    $0x1,%eax
+}
+  802706:	5d                   	pop    %rbp
+  802707:	c3                   	ret
+
+0000000000802708 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  802708:	55                   	push   %rbp
+  802709:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  80270c:	48 b8 f5 25 80 00 00 	movabs $0x8025f5,%rax
+  802713:	00 00 00 
+  802716:	ff d0                	call   *%rax
+  802718:	83 e0 01             	and    $0x1,%eax
+}
+  80271b:	5d                   	pop    %rbp
+  80271c:	c3                   	ret
+
+000000000080271d <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  80271d:	55                   	push   %rbp
+  80271e:	48 89 e5             	mov    %rsp,%rbp
+  802721:	41 57                	push   %r15
+  802723:	41 56                	push   %r14
+  802725:	41 55                	push   %r13
+  802727:	41 54                	push   %r12
+  802729:	53                   	push   %rbx
+  80272a:	48 83 ec 38          	sub    $0x38,%rsp
+  80272e:	49 89 f7             	mov    %rsi,%r15
+  802731:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+                    }
+                    continue;
+                }
+                for (int ptei = 0; ptei < PT_ENTRY_COUNT; ptei++) {
+                    uintptr_t pte_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, pdei, ptei, 0);
+                    pte_t pte = uvpt[VPT(pte_addr)];
+  802737:	49 bd 00 00 00 00 00 	movabs $0x10000000000,%r13
+  80273e:	01 00 00 
+  802741:	4d 89 e6             	mov    %r12,%r14
+  802744:	49 89 fc             	mov    %rdi,%r12
+  802747:	e9 19 01 00 00       	jmp    802865 <foreach_shared_region+0x148>
+  80274c:	48 89 5d b0          	mov    %rbx,-0x50(%rbp)
+  802750:	4c 89 75 a8          	mov    %r14,-0x58(%rbp)
+  802754:	eb 52                	jmp    8027a8 <foreach_shared_region+0x8b>
+                for (int ptei = 0; ptei < PT_ENTRY_COUNT; ptei++) {
+  802756:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  80275d:	48 81 fb 00 00 20 00 	cmp    $0x200000,%rbx
+  802764:	74 2e                	je     802794 <foreach_shared_region+0x77>
+                    uintptr_t pte_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, pdei, ptei, 0);
+  802766:	48 89 df             	mov    %rbx,%rdi
+  802769:	4c 09 f7             	or     %r14,%rdi
+                    pte_t pte = uvpt[VPT(pte_addr)];
+  80276c:	48 89 f8             	mov    %rdi,%rax
+  80276f:	48 c1 e8 0c          	shr    $0xc,%rax
+  802773:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+                    if ((pte & PTE_P) && (pte & PTE_SHARE)) {
+  802778:	25 01 04 00 00       	and    $0x401,%eax
+  80277d:	48 3d 01 04 00 00    	cmp    $0x401,%rax
+  802783:	75 d1                	jne    802756 <foreach_shared_region+0x39>
+                        fun((void*)pte_addr, (void*)(pte_addr + PAGE_SIZE), arg);
+  802785:	48 8d b7 00 10 00 00 	lea    0x1000(%rdi),%rsi
+  80278c:	4c 89 fa             	mov    %r15,%rdx
+  80278f:	41 ff d4             	call   *%r12
+  802792:	eb c2                	jmp    802756 <foreach_shared_region+0x39>
+            for (int pdei = 0; pdei < PD_ENTRY_COUNT; pdei++) {
+  802794:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  80279b:	00 
+  80279c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8027a0:	48 3d 00 00 00 40    	cmp    $0x40000000,%rax
+  8027a6:	74 46                	je     8027ee <foreach_shared_region+0xd1>
+                uintptr_t pde_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, pdei, 0, 0);
+  8027a8:	4c 8b 75 c8          	mov    -0x38(%rbp),%r14
+  8027ac:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8027b0:	49 09 c6             	or     %rax,%r14
+                pde_t pde = uvpd[VPD(pde_addr)];
+  8027b3:	4c 89 f0             	mov    %r14,%rax
+  8027b6:	48 c1 e8 15          	shr    $0x15,%rax
+  8027ba:	48 b9 00 00 00 80 00 	movabs $0x10080000000,%rcx
+  8027c1:	01 00 00 
+  8027c4:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+                if (!(pde & PTE_P)) {
+  8027c8:	a8 01                	test   $0x1,%al
+  8027ca:	74 c8                	je     802794 <foreach_shared_region+0x77>
+                if (pde & PTE_PS) {
+  8027cc:	48 89 c3             	mov    %rax,%rbx
+  8027cf:	81 e3 80 00 00 00    	and    $0x80,%ebx
+  8027d5:	74 8f                	je     802766 <foreach_shared_region+0x49>
+                    if (pde & PTE_SHARE) {
+  8027d7:	f6 c4 04             	test   $0x4,%ah
+  8027da:	74 b8                	je     802794 <foreach_shared_region+0x77>
+                        fun((void*)pde_addr, (void*)(pde_addr + 1024 * 1024 * 2), arg);
+  8027dc:	49 8d b6 00 00 20 00 	lea    0x200000(%r14),%rsi
+  8027e3:	4c 89 fa             	mov    %r15,%rdx
+  8027e6:	4c 89 f7             	mov    %r14,%rdi
+  8027e9:	41 ff d4             	call   *%r12
+  8027ec:	eb a6                	jmp    802794 <foreach_shared_region+0x77>
+  8027ee:	48 8b 5d b0          	mov    -0x50(%rbp),%rbx
+  8027f2:	4c 8b 75 a8          	mov    -0x58(%rbp),%r14
+        for (int pdpei = 0; pdpei < PDP_ENTRY_COUNT; pdpei++) {
+  8027f6:	48 81 c3 00 00 00 40 	add    $0x40000000,%rbx
+  8027fd:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802804:	00 00 00 
+  802807:	48 39 c3             	cmp    %rax,%rbx
+  80280a:	74 4c                	je     802858 <foreach_shared_region+0x13b>
+            uintptr_t pdpe_addr = (uintptr_t)MAKE_ADDR(pml4ei, pdpei, 0, 0, 0);
+  80280c:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802810:	48 09 d8             	or     %rbx,%rax
+  802813:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+            pdpe_t pdpe = uvpdp[VPDP(pdpe_addr)];
+  802817:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80281b:	48 b9 00 00 40 80 00 	movabs $0x10080400000,%rcx
+  802822:	01 00 00 
+  802825:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+            if (!(pdpe & PTE_P)) {
+  802829:	a8 01                	test   $0x1,%al
+  80282b:	74 c9                	je     8027f6 <foreach_shared_region+0xd9>
+            if (pdpe & PTE_PS) {
+  80282d:	48 89 c1             	mov    %rax,%rcx
+  802830:	81 e1 80 00 00 00    	and    $0x80,%ecx
+  802836:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  80283a:	0f 84 0c ff ff ff    	je     80274c <foreach_shared_region+0x2f>
+                if (pdpe & PTE_SHARE) {
+  802840:	f6 c4 04             	test   $0x4,%ah
+  802843:	74 b1                	je     8027f6 <foreach_shared_region+0xd9>
+                    fun((void*)pdpe_addr, (void*)(pdpe_addr + 1024 * 1024 * 1024), arg); 
+  802845:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  802849:	48 8d b7 00 00 00 40 	lea    0x40000000(%rdi),%rsi
+  802850:	4c 89 fa             	mov    %r15,%rdx
+  802853:	41 ff d4             	call   *%r12
+  802856:	eb 9e                	jmp    8027f6 <foreach_shared_region+0xd9>
+    for (int pml4ei = 0; pml4ei < PML4_ENTRY_COUNT; pml4ei++) {
+  802858:	49 83 c6 01          	add    $0x1,%r14
+  80285c:	49 81 fe 00 02 00 00 	cmp    $0x200,%r14
+  802863:	74 24                	je     802889 <foreach_shared_region+0x16c>
+        pml4e_t pml4e = uvpml4[VPML4(pml4_addr)];
+  802865:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  80286c:	01 00 00 
+  80286f:	4a 8b 04 f0          	mov    (%rax,%r14,8),%rax
+        if (!(pml4e & PTE_P)) {
+  802873:	a8 01                	test   $0x1,%al
+  802875:	74 e1                	je     802858 <foreach_shared_region+0x13b>
+  802877:	4c 89 f0             	mov    %r14,%rax
+  80287a:	48 c1 e0 27          	shl    $0x27,%rax
+  80287e:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  802882:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802887:	eb 83                	jmp    80280c <foreach_shared_region+0xef>
+            }
+        }
+    }
+    
+    return 0;
+}
+  802889:	b8 00 00 00 00       	mov    $0x0,%eax
+  80288e:	48 83 c4 38          	add    $0x38,%rsp
+  802892:	5b                   	pop    %rbx
+  802893:	41 5c                	pop    %r12
+  802895:	41 5d                	pop    %r13
+  802897:	41 5e                	pop    %r14
+  802899:	41 5f                	pop    %r15
+  80289b:	5d                   	pop    %rbp
+  80289c:	c3                   	ret
+
+000000000080289d <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  80289d:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028a2:	c3                   	ret
+
+00000000008028a3 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  8028a3:	55                   	push   %rbp
+  8028a4:	48 89 e5             	mov    %rsp,%rbp
+  8028a7:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  8028aa:	48 be 34 34 80 00 00 	movabs $0x803434,%rsi
+  8028b1:	00 00 00 
+  8028b4:	48 b8 87 0b 80 00 00 	movabs $0x800b87,%rax
+  8028bb:	00 00 00 
+  8028be:	ff d0                	call   *%rax
+    return 0;
+}
+  8028c0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028c5:	5d                   	pop    %rbp
+  8028c6:	c3                   	ret
+
+00000000008028c7 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8028c7:	55                   	push   %rbp
+  8028c8:	48 89 e5             	mov    %rsp,%rbp
+  8028cb:	41 57                	push   %r15
+  8028cd:	41 56                	push   %r14
+  8028cf:	41 55                	push   %r13
+  8028d1:	41 54                	push   %r12
+  8028d3:	53                   	push   %rbx
+  8028d4:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  8028db:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  8028e2:	48 85 d2             	test   %rdx,%rdx
+  8028e5:	74 7a                	je     802961 <devcons_write+0x9a>
+  8028e7:	49 89 d6             	mov    %rdx,%r14
+  8028ea:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8028f0:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  8028f5:	49 bf 81 0d 80 00 00 	movabs $0x800d81,%r15
+  8028fc:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  8028ff:	4c 89 f3             	mov    %r14,%rbx
+  802902:	48 29 f3             	sub    %rsi,%rbx
+  802905:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  80290a:	48 39 c3             	cmp    %rax,%rbx
+  80290d:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  802911:	4c 63 eb             	movslq %ebx,%r13
+  802914:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  80291b:	48 01 c6             	add    %rax,%rsi
+  80291e:	4c 89 ea             	mov    %r13,%rdx
+  802921:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802928:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  80292b:	4c 89 ee             	mov    %r13,%rsi
+  80292e:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  802935:	48 b8 ae 0f 80 00 00 	movabs $0x800fae,%rax
+  80293c:	00 00 00 
+  80293f:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  802941:	41 01 dc             	add    %ebx,%r12d
+  802944:	49 63 f4             	movslq %r12d,%rsi
+  802947:	4c 39 f6             	cmp    %r14,%rsi
+  80294a:	72 b3                	jb     8028ff <devcons_write+0x38>
+    return res;
+  80294c:	49 63 c4             	movslq %r12d,%rax
+}
+  80294f:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  802956:	5b                   	pop    %rbx
+  802957:	41 5c                	pop    %r12
+  802959:	41 5d                	pop    %r13
+  80295b:	41 5e                	pop    %r14
+  80295d:	41 5f                	pop    %r15
+  80295f:	5d                   	pop    %rbp
+  802960:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  802961:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802967:	eb e3                	jmp    80294c <devcons_write+0x85>
+
+0000000000802969 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  802969:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  80296c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802971:	48 85 c0             	test   %rax,%rax
+  802974:	74 55                	je     8029cb <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  802976:	55                   	push   %rbp
+  802977:	48 89 e5             	mov    %rsp,%rbp
+  80297a:	41 55                	push   %r13
+  80297c:	41 54                	push   %r12
+  80297e:	53                   	push   %rbx
+  80297f:	48 83 ec 08          	sub    $0x8,%rsp
+  802983:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  802986:	48 bb db 0f 80 00 00 	movabs $0x800fdb,%rbx
+  80298d:	00 00 00 
+  802990:	49 bc a8 10 80 00 00 	movabs $0x8010a8,%r12
+  802997:	00 00 00 
+  80299a:	eb 03                	jmp    80299f <devcons_read+0x36>
+  80299c:	41 ff d4             	call   *%r12
+  80299f:	ff d3                	call   *%rbx
+  8029a1:	85 c0                	test   %eax,%eax
+  8029a3:	74 f7                	je     80299c <devcons_read+0x33>
+    if (c < 0) return c;
+  8029a5:	48 63 d0             	movslq %eax,%rdx
+  8029a8:	78 13                	js     8029bd <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  8029aa:	ba 00 00 00 00       	mov    $0x0,%edx
+  8029af:	83 f8 04             	cmp    $0x4,%eax
+  8029b2:	74 09                	je     8029bd <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  8029b4:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  8029b8:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  8029bd:	48 89 d0             	mov    %rdx,%rax
+  8029c0:	48 83 c4 08          	add    $0x8,%rsp
+  8029c4:	5b                   	pop    %rbx
+  8029c5:	41 5c                	pop    %r12
+  8029c7:	41 5d                	pop    %r13
+  8029c9:	5d                   	pop    %rbp
+  8029ca:	c3                   	ret
+  8029cb:	48 89 d0             	mov    %rdx,%rax
+  8029ce:	c3                   	ret
+
+00000000008029cf <cputchar>:
+cputchar(int ch) {
+  8029cf:	55                   	push   %rbp
+  8029d0:	48 89 e5             	mov    %rsp,%rbp
+  8029d3:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  8029d7:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  8029db:	be 01 00 00 00       	mov    $0x1,%esi
+  8029e0:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  8029e4:	48 b8 ae 0f 80 00 00 	movabs $0x800fae,%rax
+  8029eb:	00 00 00 
+  8029ee:	ff d0                	call   *%rax
+}
+  8029f0:	c9                   	leave
+  8029f1:	c3                   	ret
+
+00000000008029f2 <getchar>:
+getchar(void) {
+  8029f2:	55                   	push   %rbp
+  8029f3:	48 89 e5             	mov    %rsp,%rbp
+  8029f6:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  8029fa:	ba 01 00 00 00       	mov    $0x1,%edx
+  8029ff:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  802a03:	bf 00 00 00 00       	mov    $0x0,%edi
+  802a08:	48 b8 16 19 80 00 00 	movabs $0x801916,%rax
+  802a0f:	00 00 00 
+  802a12:	ff d0                	call   *%rax
+  802a14:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  802a16:	85 c0                	test   %eax,%eax
+  802a18:	78 06                	js     802a20 <getchar+0x2e>
+  802a1a:	74 08                	je     802a24 <getchar+0x32>
+  802a1c:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  802a20:	89 d0                	mov    %edx,%eax
+  802a22:	c9                   	leave
+  802a23:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  802a24:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  802a29:	eb f5                	jmp    802a20 <getchar+0x2e>
+
+0000000000802a2b <iscons>:
+iscons(int fdnum) {
+  802a2b:	55                   	push   %rbp
+  802a2c:	48 89 e5             	mov    %rsp,%rbp
+  802a2f:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  802a33:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802a37:	48 b8 33 16 80 00 00 	movabs $0x801633,%rax
+  802a3e:	00 00 00 
+  802a41:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802a43:	85 c0                	test   %eax,%eax
+  802a45:	78 18                	js     802a5f <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  802a47:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802a4b:	48 b8 a0 40 80 00 00 	movabs $0x8040a0,%rax
+  802a52:	00 00 00 
+  802a55:	8b 00                	mov    (%rax),%eax
+  802a57:	39 02                	cmp    %eax,(%rdx)
+  802a59:	0f 94 c0             	sete   %al
+  802a5c:	0f b6 c0             	movzbl %al,%eax
+}
+  802a5f:	c9                   	leave
+  802a60:	c3                   	ret
+
+0000000000802a61 <opencons>:
+opencons(void) {
+  802a61:	55                   	push   %rbp
+  802a62:	48 89 e5             	mov    %rsp,%rbp
+  802a65:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802a69:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  802a6d:	48 b8 19 16 80 00 00 	movabs $0x801619,%rax
+  802a74:	00 00 00 
+  802a77:	ff d0                	call   *%rax
+  802a79:	85 c0                	test   %eax,%eax
+  802a7b:	78 49                	js     802ac6 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  802a7d:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802a82:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802a87:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  802a8b:	bf 00 00 00 00       	mov    $0x0,%edi
+  802a90:	48 b8 37 11 80 00 00 	movabs $0x801137,%rax
+  802a97:	00 00 00 
+  802a9a:	ff d0                	call   *%rax
+  802a9c:	85 c0                	test   %eax,%eax
+  802a9e:	78 26                	js     802ac6 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  802aa0:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802aa4:	a1 a0 40 80 00 00 00 	movabs 0x8040a0,%eax
+  802aab:	00 00 
+  802aad:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  802aaf:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802ab3:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  802aba:	48 b8 72 15 80 00 00 	movabs $0x801572,%rax
+  802ac1:	00 00 00 
+  802ac4:	ff d0                	call   *%rax
+}
+  802ac6:	c9                   	leave
+  802ac7:	c3                   	ret
+
+0000000000802ac8 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  802ac8:	55                   	push   %rbp
+  802ac9:	48 89 e5             	mov    %rsp,%rbp
+  802acc:	41 56                	push   %r14
+  802ace:	41 55                	push   %r13
+  802ad0:	41 54                	push   %r12
+  802ad2:	53                   	push   %rbx
+  802ad3:	48 83 ec 50          	sub    $0x50,%rsp
+  802ad7:	49 89 fc             	mov    %rdi,%r12
+  802ada:	41 89 f5             	mov    %esi,%r13d
+  802add:	48 89 d3             	mov    %rdx,%rbx
+  802ae0:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  802ae4:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  802ae8:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  802aec:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  802af3:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802af7:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  802afb:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  802aff:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  802b03:	48 b8 00 40 80 00 00 	movabs $0x804000,%rax
+  802b0a:	00 00 00 
+  802b0d:	4c 8b 30             	mov    (%rax),%r14
+  802b10:	48 b8 77 10 80 00 00 	movabs $0x801077,%rax
+  802b17:	00 00 00 
+  802b1a:	ff d0                	call   *%rax
+  802b1c:	89 c6                	mov    %eax,%esi
+  802b1e:	45 89 e8             	mov    %r13d,%r8d
+  802b21:	4c 89 e1             	mov    %r12,%rcx
+  802b24:	4c 89 f2             	mov    %r14,%rdx
+  802b27:	48 bf 40 34 80 00 00 	movabs $0x803440,%rdi
+  802b2e:	00 00 00 
+  802b31:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b36:	49 bc 62 02 80 00 00 	movabs $0x800262,%r12
+  802b3d:	00 00 00 
+  802b40:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  802b43:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  802b47:	48 89 df             	mov    %rbx,%rdi
+  802b4a:	48 b8 fe 01 80 00 00 	movabs $0x8001fe,%rax
+  802b51:	00 00 00 
+  802b54:	ff d0                	call   *%rax
+    cprintf("\n");
+  802b56:	48 bf 9b 33 80 00 00 	movabs $0x80339b,%rdi
+  802b5d:	00 00 00 
+  802b60:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b65:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  802b68:	cc                   	int3
+  802b69:	eb fd                	jmp    802b68 <_panic+0xa0>
+
+0000000000802b6b <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  802b6b:	55                   	push   %rbp
+  802b6c:	48 89 e5             	mov    %rsp,%rbp
+  802b6f:	41 55                	push   %r13
+  802b71:	41 54                	push   %r12
+  802b73:	53                   	push   %rbx
+  802b74:	48 83 ec 08          	sub    $0x8,%rsp
+  802b78:	49 89 fc             	mov    %rdi,%r12
+  802b7b:	48 89 f7             	mov    %rsi,%rdi
+  802b7e:	48 89 d3             	mov    %rdx,%rbx
+  802b81:	49 89 cd             	mov    %rcx,%r13
+    // LAB 9: Your code here:
+    int res = sys_ipc_recv(!pg ? (void*)MAX_USER_ADDRESS : pg, !size ? 0 : *size);
+  802b84:	be 00 00 00 00       	mov    $0x0,%esi
+  802b89:	48 85 d2             	test   %rdx,%rdx
+  802b8c:	74 03                	je     802b91 <ipc_recv+0x26>
+  802b8e:	48 8b 32             	mov    (%rdx),%rsi
+  802b91:	48 85 ff             	test   %rdi,%rdi
+  802b94:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802b9b:	00 00 00 
+  802b9e:	48 0f 44 f8          	cmove  %rax,%rdi
+  802ba2:	48 b8 09 15 80 00 00 	movabs $0x801509,%rax
+  802ba9:	00 00 00 
+  802bac:	ff d0                	call   *%rax
+    if (res < 0) {
+  802bae:	85 c0                	test   %eax,%eax
+  802bb0:	78 66                	js     802c18 <ipc_recv+0xad>
+        if (size) {
+            *size = 0;
+        }
+        return res;
+    }
+    if (from_env_store) {
+  802bb2:	4d 85 e4             	test   %r12,%r12
+  802bb5:	74 14                	je     802bcb <ipc_recv+0x60>
+        *from_env_store = thisenv->env_ipc_from;
+  802bb7:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802bbe:	00 00 00 
+  802bc1:	8b 80 ac 01 00 00    	mov    0x1ac(%rax),%eax
+  802bc7:	41 89 04 24          	mov    %eax,(%r12)
+    }
+    if (perm_store) {
+  802bcb:	4d 85 ed             	test   %r13,%r13
+  802bce:	74 14                	je     802be4 <ipc_recv+0x79>
+        *perm_store = thisenv->env_ipc_perm;
+  802bd0:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802bd7:	00 00 00 
+  802bda:	8b 80 b0 01 00 00    	mov    0x1b0(%rax),%eax
+  802be0:	41 89 45 00          	mov    %eax,0x0(%r13)
+    }
+    if (size) {
+  802be4:	48 85 db             	test   %rbx,%rbx
+  802be7:	74 14                	je     802bfd <ipc_recv+0x92>
+        *size = thisenv->env_ipc_maxsz;
+  802be9:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802bf0:	00 00 00 
+  802bf3:	48 8b 80 a0 01 00 00 	mov    0x1a0(%rax),%rax
+  802bfa:	48 89 03             	mov    %rax,(%rbx)
+    }
+    return thisenv->env_ipc_value;
+  802bfd:	48 a1 00 50 80 00 00 	movabs 0x805000,%rax
+  802c04:	00 00 00 
+  802c07:	8b 80 a8 01 00 00    	mov    0x1a8(%rax),%eax
+}
+  802c0d:	48 83 c4 08          	add    $0x8,%rsp
+  802c11:	5b                   	pop    %rbx
+  802c12:	41 5c                	pop    %r12
+  802c14:	41 5d                	pop    %r13
+  802c16:	5d                   	pop    %rbp
+  802c17:	c3                   	ret
+        if (from_env_store) {
+  802c18:	4d 85 e4             	test   %r12,%r12
+  802c1b:	74 08                	je     802c25 <ipc_recv+0xba>
+            *from_env_store = 0;
+  802c1d:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  802c24:	00 
+        if (perm_store) {
+  802c25:	4d 85 ed             	test   %r13,%r13
+  802c28:	74 08                	je     802c32 <ipc_recv+0xc7>
+            *perm_store = 0;
+  802c2a:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  802c31:	00 
+        if (size) {
+  802c32:	48 85 db             	test   %rbx,%rbx
+  802c35:	74 d6                	je     802c0d <ipc_recv+0xa2>
+            *size = 0;
+  802c37:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  802c3e:	eb cd                	jmp    802c0d <ipc_recv+0xa2>
+
+0000000000802c40 <ipc_send>:
+ * Hint:
+ *   Use sys_yield() to be CPU-friendly.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  802c40:	55                   	push   %rbp
+  802c41:	48 89 e5             	mov    %rsp,%rbp
+  802c44:	41 57                	push   %r15
+  802c46:	41 56                	push   %r14
+  802c48:	41 55                	push   %r13
+  802c4a:	41 54                	push   %r12
+  802c4c:	53                   	push   %rbx
+  802c4d:	48 83 ec 18          	sub    $0x18,%rsp
+  802c51:	41 89 fd             	mov    %edi,%r13d
+  802c54:	89 75 cc             	mov    %esi,-0x34(%rbp)
+  802c57:	49 89 cc             	mov    %rcx,%r12
+  802c5a:	44 89 45 c8          	mov    %r8d,-0x38(%rbp)
+    // LAB 9: Your code here:
+    int res = 0;
+    while ((res = sys_ipc_try_send(to_env, val, !pg ? (void*)MAX_USER_ADDRESS : pg, size, perm)) < 0) {
+  802c5e:	48 85 d2             	test   %rdx,%rdx
+  802c61:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802c68:	00 00 00 
+  802c6b:	48 0f 45 c2          	cmovne %rdx,%rax
+  802c6f:	48 89 c3             	mov    %rax,%rbx
+  802c72:	49 be dd 14 80 00 00 	movabs $0x8014dd,%r14
+  802c79:	00 00 00 
+        if (res != -E_IPC_NOT_RECV) {
+            panic("sys_ipc_try_send failed: %i", res);
+        }
+        sys_yield();
+  802c7c:	49 bf a8 10 80 00 00 	movabs $0x8010a8,%r15
+  802c83:	00 00 00 
+    while ((res = sys_ipc_try_send(to_env, val, !pg ? (void*)MAX_USER_ADDRESS : pg, size, perm)) < 0) {
+  802c86:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  802c89:	44 8b 45 c8          	mov    -0x38(%rbp),%r8d
+  802c8d:	4c 89 e1             	mov    %r12,%rcx
+  802c90:	48 89 da             	mov    %rbx,%rdx
+  802c93:	44 89 ef             	mov    %r13d,%edi
+  802c96:	41 ff d6             	call   *%r14
+  802c99:	85 c0                	test   %eax,%eax
+  802c9b:	79 37                	jns    802cd4 <ipc_send+0x94>
+        if (res != -E_IPC_NOT_RECV) {
+  802c9d:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  802ca0:	75 05                	jne    802ca7 <ipc_send+0x67>
+        sys_yield();
+  802ca2:	41 ff d7             	call   *%r15
+  802ca5:	eb df                	jmp    802c86 <ipc_send+0x46>
+            panic("sys_ipc_try_send failed: %i", res);
+  802ca7:	89 c1                	mov    %eax,%ecx
+  802ca9:	48 ba 63 34 80 00 00 	movabs $0x803463,%rdx
+  802cb0:	00 00 00 
+  802cb3:	be 40 00 00 00       	mov    $0x40,%esi
+  802cb8:	48 bf 7f 34 80 00 00 	movabs $0x80347f,%rdi
+  802cbf:	00 00 00 
+  802cc2:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cc7:	49 b8 c8 2a 80 00 00 	movabs $0x802ac8,%r8
+  802cce:	00 00 00 
+  802cd1:	41 ff d0             	call   *%r8
+    }
+    return;
+}
+  802cd4:	48 83 c4 18          	add    $0x18,%rsp
+  802cd8:	5b                   	pop    %rbx
+  802cd9:	41 5c                	pop    %r12
+  802cdb:	41 5d                	pop    %r13
+  802cdd:	41 5e                	pop    %r14
+  802cdf:	41 5f                	pop    %r15
+  802ce1:	5d                   	pop    %rbp
+  802ce2:	c3                   	ret
+
+0000000000802ce3 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  802ce3:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  802ce8:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  802cef:	00 00 00 
+  802cf2:	48 69 d0 d0 01 00 00 	imul   $0x1d0,%rax,%rdx
+  802cf9:	48 01 ca             	add    %rcx,%rdx
+  802cfc:	8b 92 e8 00 00 00    	mov    0xe8(%rdx),%edx
+  802d02:	39 fa                	cmp    %edi,%edx
+  802d04:	74 12                	je     802d18 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  802d06:	48 83 c0 01          	add    $0x1,%rax
+  802d0a:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  802d10:	75 e0                	jne    802cf2 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  802d12:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802d17:	c3                   	ret
+            return envs[i].env_id;
+  802d18:	48 69 c0 d0 01 00 00 	imul   $0x1d0,%rax,%rax
+  802d1f:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  802d26:	00 00 00 
+  802d29:	48 01 d0             	add    %rdx,%rax
+  802d2c:	8b 80 e0 00 00 00    	mov    0xe0(%rax),%eax
+  802d32:	c3                   	ret
+  802d33:	0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+
+0000000000802d38 <__rodata_start>:
+  802d38:	48                   	rex.W
+  802d39:	65 6c                	gs insb (%dx),%es:(%rdi)
+  802d3b:	6c                   	insb   (%dx),%es:(%rdi)
+  802d3c:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802d3d:	2c 20                	sub    $0x20,%al
+  802d3f:	49 20 61 6d          	rex.WB and %spl,0x6d(%r9)
+  802d43:	20 65 6e             	and    %ah,0x6e(%rbp)
+  802d46:	76 69                	jbe    802db1 <__rodata_start+0x79>
+  802d48:	72 6f                	jb     802db9 <__rodata_start+0x81>
+  802d4a:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802d4b:	6d                   	insl   (%dx),%es:(%rdi)
+  802d4c:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  802d4e:	74 20                	je     802d70 <__rodata_start+0x38>
+  802d50:	25 30 38 78 2e       	and    $0x2e783830,%eax
+  802d55:	0a 00                	or     (%rax),%al
+  802d57:	00 42 61             	add    %al,0x61(%rdx)
+  802d5a:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  802d5d:	69 6e 20 65 6e 76 69 	imul   $0x69766e65,0x20(%rsi),%ebp
+  802d64:	72 6f                	jb     802dd5 <__rodata_start+0x9d>
+  802d66:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802d67:	6d                   	insl   (%dx),%es:(%rdi)
+  802d68:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  802d6a:	74 20                	je     802d8c <__rodata_start+0x54>
+  802d6c:	25 30 38 78 2c       	and    $0x2c783830,%eax
+  802d71:	20 69 74             	and    %ch,0x74(%rcx)
+  802d74:	65 72 61             	gs jb  802dd8 <__rodata_start+0xa0>
+  802d77:	74 69                	je     802de2 <__rodata_start+0xaa>
+  802d79:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802d7a:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802d7b:	20 25 64 2e 0a 00    	and    %ah,0xa2e64(%rip)        # 8a5be5 <__bss_end+0x9dbe5>
+  802d81:	00 00                	add    %al,(%rax)
+  802d83:	00 00                	add    %al,(%rax)
+  802d85:	00 00                	add    %al,(%rax)
+  802d87:	00 41 6c             	add    %al,0x6c(%rcx)
+  802d8a:	6c                   	insb   (%dx),%es:(%rdi)
+  802d8b:	20 64 6f 6e          	and    %ah,0x6e(%rdi,%rbp,2)
+  802d8f:	65 20 69 6e          	and    %ch,%gs:0x6e(%rcx)
+  802d93:	20 65 6e             	and    %ah,0x6e(%rbp)
+  802d96:	76 69                	jbe    802e01 <__rodata_start+0xc9>
+  802d98:	72 6f                	jb     802e09 <__rodata_start+0xd1>
+  802d9a:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802d9b:	6d                   	insl   (%dx),%es:(%rdi)
+  802d9c:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  802d9e:	74 20                	je     802dc0 <__rodata_start+0x88>
+  802da0:	25 30 38 78 2e       	and    $0x2e783830,%eax
+  802da5:	0a 00                	or     (%rax),%al
+  802da7:	3c 75                	cmp    $0x75,%al
+  802da9:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802daa:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  802dae:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802daf:	3e 00 30             	ds add %dh,(%rax)
+  802db2:	31 32                	xor    %esi,(%rdx)
+  802db4:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  802dbb:	41                   	rex.B
+  802dbc:	42                   	rex.X
+  802dbd:	43                   	rex.XB
+  802dbe:	44                   	rex.R
+  802dbf:	45                   	rex.RB
+  802dc0:	46 00 30             	rex.RX add %r14b,(%rax)
+  802dc3:	31 32                	xor    %esi,(%rdx)
+  802dc5:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  802dcc:	61                   	(bad)
+  802dcd:	62 63 64 65 66       	(bad)
+  802dd2:	00 28                	add    %ch,(%rax)
+  802dd4:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802dd5:	75 6c                	jne    802e43 <__rodata_start+0x10b>
+  802dd7:	6c                   	insb   (%dx),%es:(%rdi)
+  802dd8:	29 00                	sub    %eax,(%rax)
+  802dda:	65 72 72             	gs jb  802e4f <__rodata_start+0x117>
+  802ddd:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802dde:	72 20                	jb     802e00 <__rodata_start+0xc8>
+  802de0:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  802de5:	73 70                	jae    802e57 <__rodata_start+0x11f>
+  802de7:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  802deb:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  802df2:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802df3:	72 00                	jb     802df5 <__rodata_start+0xbd>
+  802df5:	62 61 64 20 65       	(bad)
+  802dfa:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802dfb:	76 69                	jbe    802e66 <__rodata_start+0x12e>
+  802dfd:	72 6f                	jb     802e6e <__rodata_start+0x136>
+  802dff:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802e00:	6d                   	insl   (%dx),%es:(%rdi)
+  802e01:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  802e03:	74 00                	je     802e05 <__rodata_start+0xcd>
+  802e05:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  802e0c:	20 70 61             	and    %dh,0x61(%rax)
+  802e0f:	72 61                	jb     802e72 <__rodata_start+0x13a>
+  802e11:	6d                   	insl   (%dx),%es:(%rdi)
+  802e12:	65 74 65             	gs je  802e7a <__rodata_start+0x142>
+  802e15:	72 00                	jb     802e17 <__rodata_start+0xdf>
+  802e17:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802e18:	75 74                	jne    802e8e <__rodata_start+0x156>
+  802e1a:	20 6f 66             	and    %ch,0x66(%rdi)
+  802e1d:	20 6d 65             	and    %ch,0x65(%rbp)
+  802e20:	6d                   	insl   (%dx),%es:(%rdi)
+  802e21:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802e22:	72 79                	jb     802e9d <__rodata_start+0x165>
+  802e24:	00 6f 75             	add    %ch,0x75(%rdi)
+  802e27:	74 20                	je     802e49 <__rodata_start+0x111>
+  802e29:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802e2a:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  802e2e:	76 69                	jbe    802e99 <__rodata_start+0x161>
+  802e30:	72 6f                	jb     802ea1 <__rodata_start+0x169>
+  802e32:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802e33:	6d                   	insl   (%dx),%es:(%rdi)
+  802e34:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  802e36:	74 73                	je     802eab <__rodata_start+0x173>
+  802e38:	00 63 6f             	add    %ah,0x6f(%rbx)
+  802e3b:	72 72                	jb     802eaf <__rodata_start+0x177>
+  802e3d:	75 70                	jne    802eaf <__rodata_start+0x177>
+  802e3f:	74 65                	je     802ea6 <__rodata_start+0x16e>
+  802e41:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  802e46:	75 67                	jne    802eaf <__rodata_start+0x177>
+  802e48:	20 69 6e             	and    %ch,0x6e(%rcx)
+  802e4b:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  802e4d:	00 73 65             	add    %dh,0x65(%rbx)
+  802e50:	67 6d                	insl   (%dx),%es:(%edi)
+  802e52:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  802e54:	74 61                	je     802eb7 <__rodata_start+0x17f>
+  802e56:	74 69                	je     802ec1 <__rodata_start+0x189>
+  802e58:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802e59:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802e5a:	20 66 61             	and    %ah,0x61(%rsi)
+  802e5d:	75 6c                	jne    802ecb <__rodata_start+0x193>
+  802e5f:	74 00                	je     802e61 <__rodata_start+0x129>
+  802e61:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  802e68:	20 45 4c             	and    %al,0x4c(%rbp)
+  802e6b:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  802e6f:	61                   	(bad)
+  802e70:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  802e75:	20 73 75             	and    %dh,0x75(%rbx)
+  802e78:	63 68 20             	movsxd 0x20(%rax),%ebp
+  802e7b:	73 79                	jae    802ef6 <__rodata_start+0x1be>
+  802e7d:	73 74                	jae    802ef3 <__rodata_start+0x1bb>
+  802e7f:	65 6d                	gs insl (%dx),%es:(%rdi)
+  802e81:	20 63 61             	and    %ah,0x61(%rbx)
+  802e84:	6c                   	insb   (%dx),%es:(%rdi)
+  802e85:	6c                   	insb   (%dx),%es:(%rdi)
+  802e86:	00 65 6e             	add    %ah,0x6e(%rbp)
+  802e89:	74 72                	je     802efd <__rodata_start+0x1c5>
+  802e8b:	79 20                	jns    802ead <__rodata_start+0x175>
+  802e8d:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802e8e:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802e8f:	74 20                	je     802eb1 <__rodata_start+0x179>
+  802e91:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  802e93:	75 6e                	jne    802f03 <__rodata_start+0x1cb>
+  802e95:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  802e99:	76 20                	jbe    802ebb <__rodata_start+0x183>
+  802e9b:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  802ea2:	72 65                	jb     802f09 <__rodata_start+0x1d1>
+  802ea4:	63 76 69             	movsxd 0x69(%rsi),%esi
+  802ea7:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802ea8:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  802eac:	65 78 70             	gs js  802f1f <__rodata_start+0x1e7>
+  802eaf:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  802eb4:	20 65 6e             	and    %ah,0x6e(%rbp)
+  802eb7:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  802ebb:	20 66 69             	and    %ah,0x69(%rsi)
+  802ebe:	6c                   	insb   (%dx),%es:(%rdi)
+  802ebf:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  802ec3:	20 66 72             	and    %ah,0x72(%rsi)
+  802ec6:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  802ecb:	61                   	(bad)
+  802ecc:	63 65 20             	movsxd 0x20(%rbp),%esp
+  802ecf:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802ed0:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802ed1:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  802ed5:	6b 00 74             	imul   $0x74,(%rax),%eax
+  802ed8:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802ed9:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802eda:	20 6d 61             	and    %ch,0x61(%rbp)
+  802edd:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802ede:	79 20                	jns    802f00 <__rodata_start+0x1c8>
+  802ee0:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  802ee7:	72 65                	jb     802f4e <__rodata_start+0x216>
+  802ee9:	20 6f 70             	and    %ch,0x70(%rdi)
+  802eec:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  802eee:	00 66 69             	add    %ah,0x69(%rsi)
+  802ef1:	6c                   	insb   (%dx),%es:(%rdi)
+  802ef2:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  802ef6:	20 62 6c             	and    %ah,0x6c(%rdx)
+  802ef9:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802efa:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  802efd:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802efe:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802eff:	74 20                	je     802f21 <__rodata_start+0x1e9>
+  802f01:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  802f03:	75 6e                	jne    802f73 <__rodata_start+0x23b>
+  802f05:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  802f09:	76 61                	jbe    802f6c <__rodata_start+0x234>
+  802f0b:	6c                   	insb   (%dx),%es:(%rdi)
+  802f0c:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  802f13:	00 
+  802f14:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  802f1b:	72 65                	jb     802f82 <__rodata_start+0x24a>
+  802f1d:	61                   	(bad)
+  802f1e:	64 79 20             	fs jns 802f41 <__rodata_start+0x209>
+  802f21:	65 78 69             	gs js  802f8d <__rodata_start+0x255>
+  802f24:	73 74                	jae    802f9a <__rodata_start+0x262>
+  802f26:	73 00                	jae    802f28 <__rodata_start+0x1f0>
+  802f28:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802f29:	70 65                	jo     802f90 <__rodata_start+0x258>
+  802f2b:	72 61                	jb     802f8e <__rodata_start+0x256>
+  802f2d:	74 69                	je     802f98 <__rodata_start+0x260>
+  802f2f:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802f30:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802f31:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  802f34:	74 20                	je     802f56 <__rodata_start+0x21e>
+  802f36:	73 75                	jae    802fad <__rodata_start+0x275>
+  802f38:	70 70                	jo     802faa <__rodata_start+0x272>
+  802f3a:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802f3b:	72 74                	jb     802fb1 <__rodata_start+0x279>
+  802f3d:	65 64 00 6f 70       	gs add %ch,%fs:0x70(%rdi)
+  802f42:	65 72 61             	gs jb  802fa6 <__rodata_start+0x26e>
+  802f45:	74 69                	je     802fb0 <__rodata_start+0x278>
+  802f47:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802f48:	6e                   	outsb  %ds:(%rsi),(%dx)
+  802f49:	20 69 6e             	and    %ch,0x6e(%rcx)
+  802f4c:	74 65                	je     802fb3 <__rodata_start+0x27b>
+  802f4e:	72 72                	jb     802fc2 <__rodata_start+0x28a>
+  802f50:	75 70                	jne    802fc2 <__rodata_start+0x28a>
+  802f52:	74 65                	je     802fb9 <__rodata_start+0x281>
+  802f54:	64 00 6e 6f          	add    %ch,%fs:0x6f(%rsi)
+  802f58:	74 20                	je     802f7a <__rodata_start+0x242>
+  802f5a:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  802f5c:	6f                   	outsl  %ds:(%rsi),(%dx)
+  802f5d:	75 67                	jne    802fc6 <__rodata_start+0x28e>
+  802f5f:	68 20 43 50 55       	push   $0x55504320
+  802f64:	20 74 69 6d          	and    %dh,0x6d(%rcx,%rbp,2)
+  802f68:	65 00 66 2e          	add    %ah,%gs:0x2e(%rsi)
+  802f6c:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+  802f73:	00 
+  802f74:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  802f7b:	00 00 00 
+  802f7e:	66 90                	xchg   %ax,%ax
+  802f80:	4f 04 80             	rex.WRXB add $0x80,%al
+  802f83:	00 00                	add    %al,(%rax)
+  802f85:	00 00                	add    %al,(%rax)
+  802f87:	00 90 0a 80 00 00    	add    %dl,0x800a(%rax)
+  802f8d:	00 00                	add    %al,(%rax)
+  802f8f:	00 80 0a 80 00 00    	add    %al,0x800a(%rax)
+  802f95:	00 00                	add    %al,(%rax)
+  802f97:	00 90 0a 80 00 00    	add    %dl,0x800a(%rax)
+  802f9d:	00 00                	add    %al,(%rax)
+  802f9f:	00 90 0a 80 00 00    	add    %dl,0x800a(%rax)
+  802fa5:	00 00                	add    %al,(%rax)
+  802fa7:	00 90 0a 80 00 00    	add    %dl,0x800a(%rax)
+  802fad:	00 00                	add    %al,(%rax)
+  802faf:	00 90 0a 80 00 00    	add    %dl,0x800a(%rax)
+  802fb5:	00 00                	add    %al,(%rax)
+  802fb7:	00 6e 04             	add    %ch,0x4(%rsi)
+  802fba:	80 00 00             	addb   $0x0,(%rax)
+  802fbd:	00 00                	add    %al,(%rax)
+  802fbf:	00 90 0a 80 00 00    	add    %dl,0x800a(%rax)
+  802fc5:	00 00                	add    %al,(%rax)
+  802fc7:	00 90 0a 80 00 00    	add    %dl,0x800a(%rax)
+  802fcd:	00 00                	add    %al,(%rax)
+  802fcf:	00 62 04             	add    %ah,0x4(%rdx)
+  802fd2:	80 00 00             	addb   $0x0,(%rax)
+  802fd5:	00 00                	add    %al,(%rax)
+  802fd7:	00 dc                	add    %bl,%ah
+  802fd9:	04 80                	add    $0x80,%al
+  802fdb:	00 00                	add    %al,(%rax)
+  802fdd:	00 00                	add    %al,(%rax)
+  802fdf:	00 90 0a 80 00 00    	add    %dl,0x800a(%rax)
+  802fe5:	00 00                	add    %al,(%rax)
+  802fe7:	00 62 04             	add    %ah,0x4(%rdx)
+  802fea:	80 00 00             	addb   $0x0,(%rax)
+  802fed:	00 00                	add    %al,(%rax)
+  802fef:	00 a8 04 80 00 00    	add    %ch,0x8004(%rax)
+  802ff5:	00 00                	add    %al,(%rax)
+  802ff7:	00 a8 04 80 00 00    	add    %ch,0x8004(%rax)
+  802ffd:	00 00                	add    %al,(%rax)
+  802fff:	00 a8 04 80 00 00    	add    %ch,0x8004(%rax)
+  803005:	00 00                	add    %al,(%rax)
+  803007:	00 a8 04 80 00 00    	add    %ch,0x8004(%rax)
+  80300d:	00 00                	add    %al,(%rax)
+  80300f:	00 a8 04 80 00 00    	add    %ch,0x8004(%rax)
+  803015:	00 00                	add    %al,(%rax)
+  803017:	00 a8 04 80 00 00    	add    %ch,0x8004(%rax)
+  80301d:	00 00                	add    %al,(%rax)
+  80301f:	00 a8 04 80 00 00    	add    %ch,0x8004(%rax)
+  803025:	00 00                	add    %al,(%rax)
+  803027:	00 a8 04 80 00 00    	add    %ch,0x8004(%rax)
+  80302d:	00 00                	add    %al,(%rax)
+  80302f:	00 a8 04 80 00 00    	add    %ch,0x8004(%rax)
+  803035:	00 00                	add    %al,(%rax)
+  803037:	00 90 0a 80 00 00    	add    %dl,0x800a(%rax)
+  80303d:	00 00                	add    %al,(%rax)
+  80303f:	00 90 0a 80 00 00    	add    %dl,0x800a(%rax)
+  803045:	00 00                	add    %al,(%rax)
+  803047:	00 90 0a 80 00 00    	add    %dl,0x800a(%rax)
+  80304d:	00 00                	add    %al,(%rax)
+  80304f:	00 90 0a 80 00 00    	add    %dl,0x800a(%rax)
+  803055:	00 00                	add    %al,(%rax)
+  803057:	00 90 0a 80 00 00    	add    %dl,0x800a(%rax)
+  80305d:	00 00                	add    %al,(%rax)
+  80305f:	00 90 0a 80 00 00    	add    %dl,0x800a(%rax)
+  803065:	00 00                	add    %al,(%rax)
+  803067:	00 90 0a 80 00 00    	add    %dl,0x800a(%rax)
+  80306d:	00 00                	add    %al,(%rax)
+  80306f:	00 90 0a 80 00 00    	add    %dl,0x800a(%rax)
+  803075:	00 00                	add    %al,(%rax)
+  803077:	00 90 0a 80 00 00    	add    %dl,0x800a(%rax)
+  80307d:	00 00                	add    %al,(%rax)
+  80307f:	00 90 0a 80 00 00    	add    %dl,0x800a(%rax)
+  803085:	00 00                	add    %al,(%rax)
+  803087:	00 90 0a 80 00 00    	add    %dl,0x800a(%rax)
+  80308d:	00 00                	add    %al,(%rax)
+  80308f:	00 90 0a 80 00 00    	add    %dl,0x800a(%rax)
+  803095:	00 00                	add    %al,(%rax)
+  803097:	00 90 0a 80 00 00    	add    %dl,0x800a(%rax)
+  80309d:	00 00                	add    %al,(%rax)
+  80309f:	00 90 0a 80 00 00    	add    %dl,0x800a(%rax)
+  8030a5:	00 00                	add    %al,(%rax)
+  8030a7:	00 90 0a 80 00 00    	add    %dl,0x800a(%rax)
+  8030ad:	00 00                	add    %al,(%rax)
+  8030af:	00 90 0a 80 00 00    	add    %dl,0x800a(%rax)
+  8030b5:	00 00                	add    %al,(%rax)
+  8030b7:	00 90 0a 80 00 00    	add    %dl,0x800a(%rax)
+  8030bd:	00 00                	add    %al,(%rax)
+  8030bf:	00 90 0a 80 00 00    	add    %dl,0x800a(%rax)
+  8030c5:	00 00                	add    %al,(%rax)
+  8030c7:	00 90 0a 80 00 00    	add    %dl,0x800a(%rax)
+  8030cd:	00 00                	add    %al,(%rax)
+  8030cf:	00 90 0a 80 00 00    	add    %dl,0x800a(%rax)
+  8030d5:	00 00                	add    %al,(%rax)
+  8030d7:	00 90 0a 80 00 00    	add    %dl,0x800a(%rax)
+  8030dd:	00 00                	add    %al,(%rax)
+  8030df:	00 90 0a 80 00 00    	add    %dl,0x800a(%rax)
+  8030e5:	00 00                	add    %al,(%rax)
+  8030e7:	00 90 0a 80 00 00    	add    %dl,0x800a(%rax)
+  8030ed:	00 00                	add    %al,(%rax)
+  8030ef:	00 90 0a 80 00 00    	add    %dl,0x800a(%rax)
+  8030f5:	00 00                	add    %al,(%rax)
+  8030f7:	00 90 0a 80 00 00    	add    %dl,0x800a(%rax)
+  8030fd:	00 00                	add    %al,(%rax)
+  8030ff:	00 90 0a 80 00 00    	add    %dl,0x800a(%rax)
+  803105:	00 00                	add    %al,(%rax)
+  803107:	00 90 0a 80 00 00    	add    %dl,0x800a(%rax)
+  80310d:	00 00                	add    %al,(%rax)
+  80310f:	00 90 0a 80 00 00    	add    %dl,0x800a(%rax)
+  803115:	00 00                	add    %al,(%rax)
+  803117:	00 90 0a 80 00 00    	add    %dl,0x800a(%rax)
+  80311d:	00 00                	add    %al,(%rax)
+  80311f:	00 90 0a 80 00 00    	add    %dl,0x800a(%rax)
+  803125:	00 00                	add    %al,(%rax)
+  803127:	00 b3 09 80 00 00    	add    %dh,0x8009(%rbx)
+  80312d:	00 00                	add    %al,(%rax)
+  80312f:	00 90 0a 80 00 00    	add    %dl,0x800a(%rax)
+  803135:	00 00                	add    %al,(%rax)
+  803137:	00 90 0a 80 00 00    	add    %dl,0x800a(%rax)
+  80313d:	00 00                	add    %al,(%rax)
+  80313f:	00 90 0a 80 00 00    	add    %dl,0x800a(%rax)
+  803145:	00 00                	add    %al,(%rax)
+  803147:	00 90 0a 80 00 00    	add    %dl,0x800a(%rax)
+  80314d:	00 00                	add    %al,(%rax)
+  80314f:	00 90 0a 80 00 00    	add    %dl,0x800a(%rax)
+  803155:	00 00                	add    %al,(%rax)
+  803157:	00 90 0a 80 00 00    	add    %dl,0x800a(%rax)
+  80315d:	00 00                	add    %al,(%rax)
+  80315f:	00 90 0a 80 00 00    	add    %dl,0x800a(%rax)
+  803165:	00 00                	add    %al,(%rax)
+  803167:	00 90 0a 80 00 00    	add    %dl,0x800a(%rax)
+  80316d:	00 00                	add    %al,(%rax)
+  80316f:	00 90 0a 80 00 00    	add    %dl,0x800a(%rax)
+  803175:	00 00                	add    %al,(%rax)
+  803177:	00 90 0a 80 00 00    	add    %dl,0x800a(%rax)
+  80317d:	00 00                	add    %al,(%rax)
+  80317f:	00 ff                	add    %bh,%bh
+  803181:	04 80                	add    $0x80,%al
+  803183:	00 00                	add    %al,(%rax)
+  803185:	00 00                	add    %al,(%rax)
+  803187:	00 ce                	add    %cl,%dh
+  803189:	06                   	(bad)
+  80318a:	80 00 00             	addb   $0x0,(%rax)
+  80318d:	00 00                	add    %al,(%rax)
+  80318f:	00 90 0a 80 00 00    	add    %dl,0x800a(%rax)
+  803195:	00 00                	add    %al,(%rax)
+  803197:	00 90 0a 80 00 00    	add    %dl,0x800a(%rax)
+  80319d:	00 00                	add    %al,(%rax)
+  80319f:	00 90 0a 80 00 00    	add    %dl,0x800a(%rax)
+  8031a5:	00 00                	add    %al,(%rax)
+  8031a7:	00 90 0a 80 00 00    	add    %dl,0x800a(%rax)
+  8031ad:	00 00                	add    %al,(%rax)
+  8031af:	00 2e                	add    %ch,(%rsi)
+  8031b1:	05 80 00 00 00       	add    $0x80,%eax
+  8031b6:	00 00                	add    %al,(%rax)
+  8031b8:	90                   	nop
+  8031b9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8031bf:	00 90 0a 80 00 00    	add    %dl,0x800a(%rax)
+  8031c5:	00 00                	add    %al,(%rax)
+  8031c7:	00 f4                	add    %dh,%ah
+  8031c9:	04 80                	add    $0x80,%al
+  8031cb:	00 00                	add    %al,(%rax)
+  8031cd:	00 00                	add    %al,(%rax)
+  8031cf:	00 90 0a 80 00 00    	add    %dl,0x800a(%rax)
+  8031d5:	00 00                	add    %al,(%rax)
+  8031d7:	00 90 0a 80 00 00    	add    %dl,0x800a(%rax)
+  8031dd:	00 00                	add    %al,(%rax)
+  8031df:	00 76 08             	add    %dh,0x8(%rsi)
+  8031e2:	80 00 00             	addb   $0x0,(%rax)
+  8031e5:	00 00                	add    %al,(%rax)
+  8031e7:	00 40 09             	add    %al,0x9(%rax)
+  8031ea:	80 00 00             	addb   $0x0,(%rax)
+  8031ed:	00 00                	add    %al,(%rax)
+  8031ef:	00 90 0a 80 00 00    	add    %dl,0x800a(%rax)
+  8031f5:	00 00                	add    %al,(%rax)
+  8031f7:	00 90 0a 80 00 00    	add    %dl,0x800a(%rax)
+  8031fd:	00 00                	add    %al,(%rax)
+  8031ff:	00 c5                	add    %al,%ch
+  803201:	05 80 00 00 00       	add    $0x80,%eax
+  803206:	00 00                	add    %al,(%rax)
+  803208:	90                   	nop
+  803209:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80320f:	00 a2 07 80 00 00    	add    %ah,0x8007(%rdx)
+  803215:	00 00                	add    %al,(%rax)
+  803217:	00 90 0a 80 00 00    	add    %dl,0x800a(%rax)
+  80321d:	00 00                	add    %al,(%rax)
+  80321f:	00 90 0a 80 00 00    	add    %dl,0x800a(%rax)
+  803225:	00 00                	add    %al,(%rax)
+  803227:	00 b3 09 80 00 00    	add    %dh,0x8009(%rbx)
+  80322d:	00 00                	add    %al,(%rax)
+  80322f:	00 90 0a 80 00 00    	add    %dl,0x800a(%rax)
+  803235:	00 00                	add    %al,(%rax)
+  803237:	00 58 04             	add    %bl,0x4(%rax)
+  80323a:	80 00 00             	addb   $0x0,(%rax)
+  80323d:	00 00                	add    %al,(%rax)
+	...
+
+0000000000803240 <error_string>:
+	...
+  803248:	e3 2d 80 00 00 00 00 00 f5 2d 80 00 00 00 00 00     .-.......-......
+  803258:	05 2e 80 00 00 00 00 00 17 2e 80 00 00 00 00 00     ................
+  803268:	25 2e 80 00 00 00 00 00 39 2e 80 00 00 00 00 00     %.......9.......
+  803278:	4e 2e 80 00 00 00 00 00 61 2e 80 00 00 00 00 00     N.......a.......
+  803288:	73 2e 80 00 00 00 00 00 87 2e 80 00 00 00 00 00     s...............
+  803298:	97 2e 80 00 00 00 00 00 aa 2e 80 00 00 00 00 00     ................
+  8032a8:	c1 2e 80 00 00 00 00 00 d7 2e 80 00 00 00 00 00     ................
+  8032b8:	ef 2e 80 00 00 00 00 00 07 2f 80 00 00 00 00 00     ........./......
+  8032c8:	14 2f 80 00 00 00 00 00 f0 32 80 00 00 00 00 00     ./.......2......
+  8032d8:	28 2f 80 00 00 00 00 00 40 2f 80 00 00 00 00 00     (/......@/......
+  8032e8:	56 2f 80 00 00 00 00 00 66 69 6c 65 20 69 73 20     V/......file is 
+  8032f8:	6e 6f 74 20 61 20 76 61 6c 69 64 20 65 78 65 63     not a valid exec
+  803308:	75 74 61 62 6c 65 00 90 73 79 73 63 61 6c 6c 20     utable..syscall 
+  803318:	25 7a 64 20 72 65 74 75 72 6e 65 64 20 25 7a 64     %zd returned %zd
+  803328:	20 28 3e 20 30 29 00 6c 69 62 2f 73 79 73 63 61      (> 0).lib/sysca
+  803338:	6c 6c 2e 63 00 0f 1f 00 5b 25 30 38 78 5d 20 75     ll.c....[%08x] u
+  803348:	6e 6b 6e 6f 77 6e 20 64 65 76 69 63 65 20 74 79     nknown device ty
+  803358:	70 65 20 25 64 0a 00 00 5b 25 30 38 78 5d 20 66     pe %d...[%08x] f
+  803368:	74 72 75 6e 63 61 74 65 20 25 64 20 2d 2d 20 62     truncate %d -- b
+  803378:	61 64 20 6d 6f 64 65 0a 00 5b 25 30 38 78 5d 20     ad mode..[%08x] 
+  803388:	72 65 61 64 20 25 64 20 2d 2d 20 62 61 64 20 6d     read %d -- bad m
+  803398:	6f 64 65 0a 00 5b 25 30 38 78 5d 20 77 72 69 74     ode..[%08x] writ
+  8033a8:	65 20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65     e %d -- bad mode
+  8033b8:	0a 00 66 0f 1f 44 00 00                             ..f..D..
+
+00000000008033c0 <devtab>:
+  8033c0:	20 40 80 00 00 00 00 00 60 40 80 00 00 00 00 00      @......`@......
+  8033d0:	a0 40 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .@..............
+  8033e0:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  8033f0:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  803400:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  803410:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  803420:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  803430:	3d 20 32 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73 00     = 2.<cons>.cons.
+  803440:	5b 25 30 38 78 5d 20 75 73 65 72 20 70 61 6e 69     [%08x] user pani
+  803450:	63 20 69 6e 20 25 73 20 61 74 20 25 73 3a 25 64     c in %s at %s:%d
+  803460:	3a 20 00 73 79 73 5f 69 70 63 5f 74 72 79 5f 73     : .sys_ipc_try_s
+  803470:	65 6e 64 20 66 61 69 6c 65 64 3a 20 25 69 00 6c     end failed: %i.l
+  803480:	69 62 2f 69 70 63 2e 63 00 66 2e 0f 1f 84 00 00     ib/ipc.c.f......
+  803490:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8034a0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8034b0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8034c0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8034d0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8034e0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8034f0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803500:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803510:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803520:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803530:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803540:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803550:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803560:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803570:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803580:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803590:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8035a0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8035b0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8035c0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8035d0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8035e0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8035f0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803600:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803610:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803620:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803630:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803640:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803650:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803660:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803670:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803680:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803690:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8036a0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8036b0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8036c0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8036d0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8036e0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8036f0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803700:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803710:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803720:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803730:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803740:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803750:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803760:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803770:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803780:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803790:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8037a0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8037b0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8037c0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8037d0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8037e0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8037f0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803800:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803810:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803820:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803830:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803840:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803850:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803860:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803870:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803880:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803890:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8038a0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8038b0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8038c0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8038d0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8038e0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8038f0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803900:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803910:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803920:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803930:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803940:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803950:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803960:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803970:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803980:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803990:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8039a0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8039b0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8039c0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8039d0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8039e0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8039f0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803a00:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803a10:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803a20:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803a30:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803a40:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803a50:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803a60:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803a70:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803a80:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803a90:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803aa0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803ab0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803ac0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803ad0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803ae0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803af0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803b00:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803b10:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803b20:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803b30:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803b40:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803b50:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803b60:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803b70:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803b80:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803b90:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803ba0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803bb0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803bc0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803bd0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803be0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803bf0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803c00:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803c10:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803c20:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803c30:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803c40:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803c50:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803c60:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803c70:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803c80:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803c90:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803ca0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803cb0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803cc0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803cd0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803ce0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803cf0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803d00:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803d10:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803d20:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803d30:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803d40:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803d50:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803d60:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803d70:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803d80:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803d90:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803da0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803db0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803dc0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803dd0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803de0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803df0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803e00:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803e10:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803e20:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803e30:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803e40:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803e50:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803e60:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803e70:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803e80:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803e90:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803ea0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803eb0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803ec0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803ed0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803ee0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803ef0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803f00:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803f10:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803f20:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803f30:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803f40:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803f50:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803f60:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803f70:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803f80:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803f90:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803fa0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  803fb0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  803fc0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  803fd0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  803fe0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  803ff0:	00 66 2e 0f 1f 84 00 00 00 00 00 0f 1f 44 00 00     .f...........D..
@@ -0,0 +1,36 @@
+/* Context switch benchmark.
+ * Ping-pong a counter between two processes and
+ * measure average cost of a round trip with TSC.
+ * Only need to start one of these -- splits into two with fork. */
+
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+#define ROUNDS 10000
+#define WARMUP 100
+
+void
+umain(int argc, char **argv) {
+    envid_t who;
+
+    if ((who = fork()) != 0) {
+        uint64_t start = 0;
+        for (uint32_t i = 0; i < WARMUP + ROUNDS; i++) {
+            if (i == WARMUP) start = read_tsc();
+            ipc_send(who, i, 0, 0, 0);
+            ipc_recv(&who, 0, 0, 0);
+        }
+        uint64_t cycles = read_tsc() - start;
+        ipc_send(who, WARMUP + ROUNDS, 0, 0, 0);
+
+        cprintf("ctxswitch: %d round trips, %lu cycles per round trip\n",
+                ROUNDS, (unsigned long)(cycles / ROUNDS));
+        return;
+    }
+
+    while (1) {
+        uint32_t i = ipc_recv(&who, 0, 0, 0);
+        if (i == WARMUP + ROUNDS) return;
+        ipc_send(who, i, 0, 0, 0);
+    }
+}
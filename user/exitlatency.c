@@ -0,0 +1,46 @@
+/* Scheduling latency during exit of a large environment.
+ * Child populates a 1GB region (size in megabytes can be
+ * passed as an argument) and exits, while parent keeps
+ * yielding and records the longest interval between two
+ * consecutive runs. Without deferred teardown the whole
+ * address space of the child is freed by a single
+ * scheduling decision, so this interval grows with its size. */
+
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+#define REGION_BASE    0x100000000ULL
+#define REGION_SIZE_MB 1024
+/* Number of yields measured after child exits */
+#define EXIT_SAMPLES 10000
+
+void
+umain(int argc, char **argv) {
+    size_t size = (argc > 1 ? strtol(argv[1], NULL, 0) : REGION_SIZE_MB) * 1024 * 1024;
+    uint8_t *buf = (uint8_t *)REGION_BASE;
+
+    envid_t child = fork();
+    if (child < 0) panic("fork: %i", child);
+
+    if (!child) {
+        int res = sys_alloc_region(CURENVID, buf, size, PROT_RW);
+        if (res < 0) panic("sys_alloc_region: %i", res);
+        for (size_t i = 0; i < size; i += PAGE_SIZE)
+            buf[i] = 1;
+        ipc_send(thisenv->env_parent_id, 0, NULL, 0, 0);
+        return;
+    }
+
+    ipc_recv(NULL, NULL, NULL, NULL);
+
+    uint64_t max = 0, prev = read_tsc();
+    for (size_t i = 0; i < EXIT_SAMPLES; i++) {
+        sys_yield();
+        uint64_t now = read_tsc();
+        max = MAX(max, now - prev);
+        prev = now;
+    }
+
+    cprintf("exitlatency: %lu MB child exited, longest scheduling gap %lu cycles\n",
+            (unsigned long)(size >> 20), (unsigned long)max);
+}
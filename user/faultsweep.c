@@ -0,0 +1,33 @@
+/* Lazy allocation benchmark.
+ * Sequentially touches every page of a large zero-filled
+ * region and reports number of page faults taken and
+ * average cost of first touch per megabyte.
+ * Region size in megabytes can be passed as an argument. */
+
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+#define SWEEP_BASE    0x100000000ULL
+#define SWEEP_SIZE_MB 256
+
+void
+umain(int argc, char **argv) {
+    size_t size_mb = argc > 1 ? strtol(argv[1], NULL, 0) : SWEEP_SIZE_MB;
+    size_t size = size_mb * 1024 * 1024;
+    uint8_t *buf = (uint8_t *)SWEEP_BASE;
+
+    int res = sys_alloc_region(CURENVID, buf, size, PROT_RW | ALLOC_ZERO);
+    if (res < 0) panic("sys_alloc_region: %i", res);
+
+    uint32_t faults = thisenv->env_pgfaults;
+    uint64_t start = read_tsc();
+    for (size_t i = 0; i < size; i += PAGE_SIZE)
+        buf[i] = 1;
+    uint64_t cycles = read_tsc() - start;
+    faults = thisenv->env_pgfaults - faults;
+
+    cprintf("faultsweep: %lu MB, %u faults, %lu cycles per MB\n",
+            (unsigned long)size_mb, faults, (unsigned long)(cycles / size_mb));
+
+    sys_unmap_region(CURENVID, buf, size);
+}
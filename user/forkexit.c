@@ -0,0 +1,44 @@
+/* Environment creation and exit benchmark.
+ * Measures the cost of sys_exofork() followed by sys_env_destroy()
+ * of the never started child, which is dominated by address space
+ * setup and teardown, and the cost of full fork() and exit().
+ * Number of iterations can be passed as an argument. */
+
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+#define FORKEXIT_ITERATIONS 256
+
+void
+umain(int argc, char **argv) {
+    size_t iterations = argc > 1 ? strtol(argv[1], NULL, 0) : FORKEXIT_ITERATIONS;
+    if (!iterations) iterations = 1;
+    uint64_t alloc_cycles = 0, free_cycles = 0, fork_cycles = 0;
+
+    for (size_t i = 0; i < iterations; i++) {
+        uint64_t start = read_tsc();
+        envid_t child = sys_exofork();
+        if (child < 0) panic("sys_exofork: %i", child);
+        /* Child is never made runnable */
+        if (!child) exit();
+        uint64_t mid = read_tsc();
+        int res = sys_env_destroy(child);
+        if (res < 0) panic("sys_env_destroy: %i", res);
+        alloc_cycles += mid - start;
+        free_cycles += read_tsc() - mid;
+    }
+
+    for (size_t i = 0; i < iterations; i++) {
+        uint64_t start = read_tsc();
+        envid_t child = fork();
+        if (child < 0) panic("fork: %i", child);
+        if (!child) exit();
+        wait(child);
+        fork_cycles += read_tsc() - start;
+    }
+
+    cprintf("forkexit: exofork %lu cycles, destroy %lu cycles, fork+exit+wait %lu cycles\n",
+            (unsigned long)(alloc_cycles / iterations),
+            (unsigned long)(free_cycles / iterations),
+            (unsigned long)(fork_cycles / iterations));
+}
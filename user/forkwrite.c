@@ -0,0 +1,51 @@
+/* Copy-on-write fault benchmark.
+ * Populates a region backed by huge pages, forks and measures
+ * latency of the first write to each shared page in the child.
+ * First half of the region is written sparsely (one byte per 2M),
+ * second half densely (every 4K). Compare results with huge page
+ * splitting switched on and off ('cowsplit' monitor command). */
+
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+#define REGION_BASE 0x100000000ULL
+#define REGION_SIZE (32 * HUGE_PAGE_SIZE)
+
+void
+umain(int argc, char **argv) {
+    uint8_t *buf = (uint8_t *)REGION_BASE;
+
+    int res = sys_alloc_region(CURENVID, buf, REGION_SIZE, PROT_RW | ALLOC_ZERO);
+    if (res < 0) panic("sys_alloc_region: %i", res);
+    for (size_t i = 0; i < REGION_SIZE; i += PAGE_SIZE)
+        buf[i] = 1;
+
+    uint64_t start = read_tsc();
+    envid_t child = fork();
+    if (child < 0) panic("fork: %i", child);
+
+    if (!child) {
+        uint64_t fork_cycles = read_tsc() - start;
+        uint8_t *sparse = buf, *dense = buf + REGION_SIZE / 2;
+
+        start = read_tsc();
+        for (size_t i = 0; i < REGION_SIZE / 2; i += HUGE_PAGE_SIZE)
+            sparse[i] = 2;
+        uint64_t sparse_cycles = read_tsc() - start;
+
+        start = read_tsc();
+        for (size_t i = 0; i < REGION_SIZE / 2; i += PAGE_SIZE)
+            dense[i] = 2;
+        uint64_t dense_cycles = read_tsc() - start;
+
+        cprintf("forkwrite: fork %lu cycles, sparse write %lu cycles per 2M page, "
+                "dense write %lu cycles per 2M page\n",
+                (unsigned long)fork_cycles,
+                (unsigned long)(sparse_cycles / (REGION_SIZE / 2 / HUGE_PAGE_SIZE)),
+                (unsigned long)(dense_cycles / (REGION_SIZE / 2 / HUGE_PAGE_SIZE)));
+        return;
+    }
+
+    wait(child);
+    sys_unmap_region(CURENVID, buf, REGION_SIZE);
+}
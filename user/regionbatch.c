@@ -0,0 +1,37 @@
+/* Counts system calls made by pipe() and spawn(), whose
+ * region operations are submitted with sys_region_batch() */
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+    int p[2];
+
+    uint32_t start = thisenv->env_syscalls;
+    int res = pipe(p);
+    if (res < 0) panic("pipe: %i", res);
+    uint32_t pipe_calls = thisenv->env_syscalls - start;
+    close(p[0]);
+    close(p[1]);
+
+    start = thisenv->env_syscalls;
+    envid_t child = spawnl("hello", "hello", 0);
+    if (child < 0) panic("spawn: %i", child);
+    uint32_t spawn_calls = thisenv->env_syscalls - start;
+    wait(child);
+
+    /* Operations before the failed one stay applied */
+    struct RegionOp ops[] = {
+            {.type = REGION_ALLOC, .dstva = (uintptr_t)UTEMP, .size = PAGE_SIZE, .perm = PROT_RW},
+            {.type = -1},
+    };
+    res = sys_region_batch(ops, 2);
+    if (res != -E_INVAL || !(get_prot(UTEMP) & PROT_R))
+        panic("sys_region_batch with bad operation: %i", res);
+    ops[0].type = REGION_UNMAP;
+    if ((res = sys_region_batch(ops, 1)) < 0 || get_prot(UTEMP) & PROT_R)
+        panic("sys_region_batch: %i", res);
+
+    cprintf("regionbatch: pipe %u system calls, spawn %u system calls (including file system IPC)\n",
+            pipe_calls, spawn_calls);
+}
@@ -0,0 +1,60 @@
+/* Wake-up jitter of a real-time environment.
+ * Puts itself into real-time class next to CPU bound environments,
+ * gives up the CPU every period and records how late it gets it
+ * back relative to the start of the next period. Also checks that
+ * reservations exceeding the CPU are not admitted. */
+
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+#define NSPINNERS 3
+#define NPERIODS  2000
+
+/* In TSC cycles */
+#define RT_PERIOD   (1ULL << 22)
+#define RT_BUDGET   (1ULL << 18)
+#define RT_DEADLINE (1ULL << 21)
+
+#define NBUCKETS 40
+
+void
+umain(int argc, char **argv) {
+    envid_t spinners[NSPINNERS];
+
+    for (int i = 0; i < NSPINNERS; i++) {
+        envid_t id = fork();
+        if (id < 0) panic("fork: %i", id);
+        if (!id)
+            for (;;) asm volatile("pause");
+        spinners[i] = id;
+    }
+
+    int res = sys_env_set_rt(CURENVID, RT_PERIOD, RT_BUDGET, RT_DEADLINE);
+    if (res < 0) panic("sys_env_set_rt: %i", res);
+
+    /* Together with this environment it's more than the whole CPU */
+    res = sys_env_set_rt(spinners[0], RT_PERIOD, RT_DEADLINE - RT_BUDGET, RT_DEADLINE);
+    cprintf("rtjitter: overloading reservation %s\n", res == -E_OVERLOAD ? "rejected" : "ADMITTED");
+
+    uint64_t hist[NBUCKETS] = {0};
+    uint64_t total = 0, worst = 0, missed = 0;
+    for (int i = 0; i < NPERIODS; i++) {
+        sys_yield();
+
+        uint64_t late = read_tsc() - thisenv->env_rt_release;
+        total += late;
+        worst = MAX(worst, late);
+        if (late > RT_DEADLINE) missed++;
+        hist[late ? MIN(63 - __builtin_clzll(late), NBUCKETS - 1) : 0]++;
+    }
+
+    sys_env_set_rt(CURENVID, 0, 0, 0);
+    for (int i = 0; i < NSPINNERS; i++)
+        sys_env_destroy(spinners[i]);
+
+    cprintf("rtjitter: %d periods of %lu cycles, wake-up latency avg %lu max %lu cycles, %lu deadlines missed\n",
+            NPERIODS, (unsigned long)RT_PERIOD, (unsigned long)(total / NPERIODS),
+            (unsigned long)worst, (unsigned long)missed);
+    for (int i = 0; i < NBUCKETS; i++)
+        if (hist[i]) cprintf("  < 2^%-2d cycles: %lu\n", i + 1, (unsigned long)hist[i]);
+}
@@ -0,0 +1,58 @@
+/* Scheduler benchmark.
+ * Measures round trip of sys_yield() between two busy
+ * environments, first alone and then with hundreds of idle
+ * environments (never made runnable) present in the system.
+ * Number of idle environments can be passed as an argument. */
+
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+#define SCHED_IDLE_ENVS  500
+#define SCHED_ITERATIONS 10000
+
+static envid_t idle[NENV];
+
+static uint64_t
+measure(void) {
+    envid_t partner = fork();
+    if (partner < 0) panic("fork: %i", partner);
+    if (!partner) {
+        for (;;) sys_yield();
+    }
+
+    /* Let partner start */
+    sys_yield();
+
+    uint64_t start = read_tsc();
+    for (size_t i = 0; i < SCHED_ITERATIONS; i++)
+        sys_yield();
+    uint64_t cycles = (read_tsc() - start) / SCHED_ITERATIONS;
+
+    sys_env_destroy(partner);
+    return cycles;
+}
+
+void
+umain(int argc, char **argv) {
+    size_t nidle = argc > 1 ? strtol(argv[1], NULL, 0) : SCHED_IDLE_ENVS;
+    nidle = MIN(nidle, NENV);
+
+    uint64_t alone = measure();
+
+    size_t created = 0;
+    for (; created < nidle; created++) {
+        envid_t env = sys_exofork();
+        if (env < 0) break;
+        /* Never runs */
+        if (!env) exit();
+        idle[created] = env;
+    }
+
+    uint64_t crowded = measure();
+
+    for (size_t i = 0; i < created; i++)
+        sys_env_destroy(idle[i]);
+
+    cprintf("schedbench: yield round trip %lu cycles alone, %lu cycles with %lu idle environments\n",
+            (unsigned long)alone, (unsigned long)crowded, (unsigned long)created);
+}
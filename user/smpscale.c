@@ -0,0 +1,70 @@
+/* Multiprocessor scaling benchmark.
+ * The same amount of work is split between NWORKERS environments
+ * twice: user mode computation and kernel bound fork/exit churn.
+ * Elapsed time is reported for both, and for computation also
+ * parallelism, that is CPU time of the workers divided by elapsed
+ * time (it's about 1 with a single CPU). Compare the output of
+ * "make run-smpscale CPUS=1" and "make run-smpscale CPUS=4". */
+
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+#define NWORKERS 8
+#define SPIN_ITERATIONS (1ULL << 28)
+#define FORKS 64
+
+static void
+compute(void) {
+    volatile uint64_t sum = 0;
+    for (uint64_t i = 0; i < SPIN_ITERATIONS / NWORKERS; i++)
+        sum += i;
+}
+
+static void
+forks(void) {
+    for (int i = 0; i < FORKS / NWORKERS; i++) {
+        envid_t id = fork();
+        if (id < 0) panic("fork: %i", id);
+        if (!id) exit();
+        wait(id);
+    }
+}
+
+/* Runs work in NWORKERS environments and waits for them.
+ * Returns elapsed cycles, CPU time of workers is stored in runtime */
+static uint64_t
+run(void (*work)(void), uint64_t *runtime) {
+    envid_t parent = sys_getenvid();
+    uint64_t start = read_tsc();
+
+    for (int i = 0; i < NWORKERS; i++) {
+        envid_t id = fork();
+        if (id < 0) panic("fork: %i", id);
+        if (!id) {
+            work();
+            /* CPU time is accounted when the CPU is given up */
+            sys_yield();
+            ipc_send(parent, thisenv->env_runtime >> 10, NULL, 0, 0);
+            exit();
+        }
+    }
+
+    *runtime = 0;
+    for (int i = 0; i < NWORKERS; i++)
+        *runtime += (uint64_t)ipc_recv(NULL, NULL, NULL, NULL) << 10;
+    return read_tsc() - start;
+}
+
+void
+umain(int argc, char **argv) {
+    uint64_t runtime;
+
+    uint64_t elapsed = run(compute, &runtime);
+    cprintf("smpscale: compute in %d envs: %lu Mcycles, parallelism %lu.%02lu\n",
+            NWORKERS, (unsigned long)(elapsed >> 20),
+            (unsigned long)(runtime / elapsed), (unsigned long)(runtime * 100 / elapsed % 100));
+
+    elapsed = run(forks, &runtime);
+    cprintf("smpscale: %d forks in %d envs: %lu Mcycles\n",
+            FORKS, NWORKERS, (unsigned long)(elapsed >> 20));
+}
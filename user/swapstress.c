@@ -0,0 +1,59 @@
+/* Swap stress test.
+ * Writes distinct contents to every page of a region twice
+ * as large as default guest memory (make qemu QEMUMEM=512M),
+ * then forks and checks contents in both parent and child,
+ * so that pages have to be evicted to swap and read back,
+ * including shared copy-on-write ones.
+ * Region size in megabytes can be passed as an argument. */
+
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+#define STRESS_BASE    0x100000000ULL
+#define STRESS_SIZE_MB 1024
+
+static size_t
+check(uint64_t *buf, size_t size, uint64_t seed) {
+    size_t bad = 0;
+    for (size_t i = 0; i < size; i += PAGE_SIZE)
+        if (buf[i / sizeof *buf] != (i ^ seed)) bad++;
+    return bad;
+}
+
+void
+umain(int argc, char **argv) {
+    size_t size_mb = argc > 1 ? strtol(argv[1], NULL, 0) : STRESS_SIZE_MB;
+    size_t size = size_mb * 1024 * 1024;
+    uint64_t *buf = (uint64_t *)STRESS_BASE;
+
+    int res = sys_alloc_region(CURENVID, buf, size, PROT_RW | ALLOC_ZERO);
+    if (res < 0) panic("sys_alloc_region: %i", res);
+
+    uint64_t start = read_tsc();
+    for (size_t i = 0; i < size; i += PAGE_SIZE)
+        buf[i / sizeof *buf] = i ^ 0x5A5A5A5A;
+    size_t bad = check(buf, size, 0x5A5A5A5A);
+    cprintf("swapstress: %lu MB written and checked in %lu cycles, %lu bad pages\n",
+            (unsigned long)size_mb, (unsigned long)(read_tsc() - start), (unsigned long)bad);
+
+    envid_t child = fork();
+    if (child < 0) panic("fork: %i", child);
+
+    /* Child overwrites every other page, so some of
+     * swapped pages stay shared and some are copied */
+    if (!child) {
+        for (size_t i = 0; i < size; i += 2 * PAGE_SIZE)
+            buf[i / sizeof *buf] ^= 0x5A5A5A5A;
+        for (size_t i = 0; i < size; i += 2 * PAGE_SIZE)
+            buf[i / sizeof *buf] ^= 0x5A5A5A5A;
+        bad += check(buf, size, 0x5A5A5A5A);
+        cprintf("swapstress: child %s\n", bad ? "FAILED" : "OK");
+        return;
+    }
+
+    wait(child);
+    bad += check(buf, size, 0x5A5A5A5A);
+    cprintf("swapstress: parent %s\n", bad ? "FAILED" : "OK");
+
+    sys_unmap_region(CURENVID, buf, size);
+}
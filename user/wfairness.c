@@ -0,0 +1,60 @@
+/* Weighted fairness of CPU time distribution.
+ * Forks CPU bound environments with different scheduling
+ * weights, lets them compete for the CPU for a while and
+ * reports the share of CPU time each of them actually got
+ * next to the share it should get according to its weight.
+ * Number of seconds (of TSC at 1GHz) can be passed as an argument. */
+
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+#define NSPINNERS 4
+
+/* Weights relative to SCHED_WEIGHT_DEFAULT */
+static const uint32_t weights[NSPINNERS] = {1, 1, 2, 4};
+
+void
+umain(int argc, char **argv) {
+    uint64_t duration = (argc > 1 ? strtol(argv[1], NULL, 0) : 2) * 1000000000ULL;
+    envid_t spinners[NSPINNERS];
+    uint64_t start_runtime[NSPINNERS];
+    uint32_t total_weight = 0;
+
+    for (int i = 0; i < NSPINNERS; i++) {
+        envid_t id = fork();
+        if (id < 0) panic("fork: %i", id);
+        if (!id)
+            for (;;) asm volatile("pause");
+
+        int res = sys_env_set_weight(id, weights[i] * SCHED_WEIGHT_DEFAULT);
+        if (res < 0) panic("sys_env_set_weight: %i", res);
+        spinners[i] = id;
+        total_weight += weights[i];
+    }
+
+    /* Parent only checks the time, so it runs rarely */
+    sys_env_set_weight(CURENVID, SCHED_WEIGHT_MIN);
+
+    for (int i = 0; i < NSPINNERS; i++)
+        start_runtime[i] = envs[ENVX(spinners[i])].env_runtime;
+    uint64_t start = read_tsc();
+    while (read_tsc() - start < duration) sys_yield();
+
+    uint64_t runtime[NSPINNERS], total_runtime = 0;
+    for (int i = 0; i < NSPINNERS; i++) {
+        runtime[i] = envs[ENVX(spinners[i])].env_runtime - start_runtime[i];
+        total_runtime += runtime[i];
+    }
+    if (!total_runtime) total_runtime = 1;
+    for (int i = 0; i < NSPINNERS; i++)
+        sys_env_destroy(spinners[i]);
+
+    for (int i = 0; i < NSPINNERS; i++) {
+        cprintf("wfairness: env %08x weight %4u: %3lu.%lu%% of CPU (expected %lu.%lu%%)\n",
+                spinners[i], weights[i] * SCHED_WEIGHT_DEFAULT,
+                (unsigned long)(runtime[i] * 100 / total_runtime),
+                (unsigned long)(runtime[i] * 1000 / total_runtime % 10),
+                (unsigned long)(weights[i] * 100 / total_weight),
+                (unsigned long)(weights[i] * 1000 / total_weight % 10));
+    }
+}